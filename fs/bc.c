@@ -1,6 +1,26 @@
 
 #include "fs.h"
 
+static struct SysBatch bc_batch;
+
+// The blocks in the cache, for CLOCK eviction: bc_blocks[0] through
+// bc_blocks[bc_nresident-1], swept by bc_hand.  The superblock and the
+// bitmap are never evicted and aren't listed.
+static uint32_t bc_blocks[BC_MAXCAPACITY];
+static uint32_t bc_nresident, bc_hand;
+static uint32_t bc_capacity = BC_CAPACITY;
+static uint32_t bc_hits, bc_misses, bc_evictions, bc_readahead;
+
+// Blocks that may be dirty, in no particular order.  Clean blocks are
+// mapped read-only, so the first write to one faults and bc_pgfault
+// makes it writable and lists it here.  Entries go stale when a block
+// is flushed or evicted; bc_dirty_collect drops those.  A block is
+// dirty only if it is mapped writable, so there's room for all of them.
+#define BC_MAXDIRTY	(BC_MAXCAPACITY + 64)
+static uint32_t bc_dirty[BC_MAXDIRTY];
+static uint32_t bc_ndirty;
+
+
 // Return the virtual address of this disk block.
 void*
 diskaddr(uint32_t blockno)
@@ -24,6 +44,227 @@ va_is_dirty(void *va)
 	return (uvpt[PGNUM(va)] & PTE_D) != 0;
 }
 
+// Is this virtual address mapped writable?
+static bool
+va_is_writable(void *va)
+{
+	return va_is_mapped(va) && (uvpt[PGNUM(va)] & PTE_W);
+}
+
+// Sort bc_dirty[0..n-1] (Shell sort).
+static void
+bc_dirty_sort(uint32_t n)
+{
+	uint32_t gap, i, j, b;
+
+	for (gap = 1; gap < n / 3; gap = gap * 3 + 1)
+		;
+	for (; gap > 0; gap /= 3)
+		for (i = gap; i < n; i++) {
+			b = bc_dirty[i];
+			for (j = i; j >= gap && bc_dirty[j - gap] > b; j -= gap)
+				bc_dirty[j] = bc_dirty[j - gap];
+			bc_dirty[j] = b;
+		}
+}
+
+// Sort the dirty list, dropping duplicates and blocks that are no
+// longer mapped writable.  Returns the new length.
+static uint32_t
+bc_dirty_collect(void)
+{
+	uint32_t i, n;
+
+	bc_dirty_sort(bc_ndirty);
+	for (i = n = 0; i < bc_ndirty; i++) {
+		if (n > 0 && bc_dirty[n - 1] == bc_dirty[i])
+			continue;
+		if (va_is_writable(diskaddr(bc_dirty[i])))
+			bc_dirty[n++] = bc_dirty[i];
+	}
+	return bc_ndirty = n;
+}
+
+// Note that 'blockno' is being made writable.
+static void
+bc_dirty_add(uint32_t blockno)
+{
+	if (bc_ndirty == BC_MAXDIRTY && bc_dirty_collect() == BC_MAXDIRTY)
+		panic("bc_dirty_add: dirty list full");
+	bc_dirty[bc_ndirty++] = blockno;
+}
+
+// Is this block kept in memory for good?  The superblock, the bitmap
+// and the journal are.
+static bool
+bc_pinned(uint32_t blockno)
+{
+	return super == 0 ||
+		blockno < 2 + (super->s_nblocks + BLKBITSIZE - 1) / BLKBITSIZE ||
+		(blockno >= super->s_journal &&
+		 blockno < super->s_journal + super->s_njournal);
+}
+
+// Evict one block with the CLOCK (second chance) policy.  The hand
+// sweeps the resident blocks; one accessed since the hand last passed
+// (PTE_A) loses its accessed bit and is skipped, and the first one
+// that wasn't is written out if dirty and unmapped.  A block in the
+// journal's running transaction can't be written home, or dropped
+// before the commit copies it, so the hand passes it over; committing
+// here could split a request across two transactions.
+//
+// Waiting for the disk lets other workers in, which may move the hand
+// or evict blocks themselves, so the sweep starts over after it.
+//
+// Returns whether it evicted a block: not if every resident block is
+// running, which only a cache about the size of a transaction sees.
+static bool
+bc_evict(void)
+{
+	uint32_t blockno, nrunning;
+	void *va;
+	int r;
+
+	nrunning = 0;
+	while (bc_nresident > 0) {
+		if (bc_hand >= bc_nresident)
+			bc_hand = 0;
+		blockno = bc_blocks[bc_hand];
+		va = diskaddr(blockno);
+		if (journal_running(blockno)) {
+			if (++nrunning >= bc_nresident)
+				return 0;
+			bc_hand++;
+			continue;
+		}
+		nrunning = 0;
+
+		// A block still queued for reading isn't mapped yet.
+		if (!va_is_mapped(va) && bio_pending(blockno)) {
+			if ((r = bio_wait(blockno)) < 0)
+				panic("bc_evict: %e", r);
+			continue;
+		}
+
+		if (va_is_mapped(va) && (uvpt[PGNUM(va)] & PTE_A)) {
+			// Remapping clears PTE_A, but also PTE_D, so
+			// write dirty blocks out (flush_block remaps).
+			if (va_is_dirty(va))
+				flush_block(va);
+			else if ((r = sys_page_map(0, va, 0, va,
+					uvpt[PGNUM(va)] & PTE_SYSCALL)) < 0)
+				panic("bc_evict: %e", r);
+			bc_hand++;
+			continue;
+		}
+
+		if (va_is_mapped(va)) {
+			if (va_is_dirty(va) || bio_pending(blockno)) {
+				flush_block(va);
+				if ((r = bio_wait(blockno)) < 0)
+					panic("bc_evict: %e", r);
+				continue;
+			}
+			// Nothing queued, so this waits only for the driver.
+			if ((r = bio_wait(blockno)) < 0)
+				panic("bc_evict: %e", r);
+			if ((r = sys_page_unmap(0, va)) < 0)
+				panic("bc_evict: %e", r);
+			bc_evictions++;
+		}
+		bc_blocks[bc_hand] = bc_blocks[--bc_nresident];
+		return 1;
+	}
+	return 0;
+}
+
+// Evict blocks until 'n' more fit in the cache, or until only blocks
+// the running transaction holds are left.
+static void
+bc_reserve(uint32_t n)
+{
+	while (bc_nresident > 0 && bc_nresident + n > bc_capacity)
+		if (!bc_evict())
+			break;
+}
+
+// Add 'blockno', which is being read in, to the resident blocks.
+// Call bc_reserve first.
+static void
+bc_track(uint32_t blockno)
+{
+	if (!bc_pinned(blockno))
+		bc_blocks[bc_nresident++] = blockno;
+}
+
+// Return the address of block 'blockno' for a file block lookup, and
+// count the lookup as a cache hit or miss.
+void*
+bc_lookup(uint32_t blockno)
+{
+	void *va = diskaddr(blockno);
+
+	if (va_is_mapped(va))
+		bc_hits++;
+	else
+		bc_misses++;
+	return va;
+}
+
+// Change the number of blocks the cache holds, evicting any extra.
+// Returns 0 on success, -E_INVAL if capacity is out of range.
+int
+bc_set_capacity(uint32_t capacity)
+{
+	if (capacity < BC_MINCAPACITY || capacity > BC_MAXCAPACITY)
+		return -E_INVAL;
+	bc_capacity = capacity;
+	bc_reserve(0);
+	return 0;
+}
+
+void
+bc_stats(struct Fsret_stats *ret)
+{
+	ret->ret_bc_capacity = bc_capacity;
+	ret->ret_bc_resident = bc_nresident;
+	ret->ret_bc_hits = bc_hits;
+	ret->ret_bc_misses = bc_misses;
+	ret->ret_bc_evictions = bc_evictions;
+	ret->ret_bc_readahead = bc_readahead;
+}
+
+// Get cached block 'blockno' ready to be mapped into a client
+// (FSREQ_READ_MAP): write it out if it's dirty, which maps it read-only.
+// The client can then keep the page; the next write to the block here
+// faults, and bc_pgfault gives the cache a copy of its own.  Returns
+// whether the block can be shared: not if the journal keeps it dirty,
+// in which case the client needs a copy.
+bool
+bc_share(uint32_t blockno)
+{
+	void *va = diskaddr(blockno);
+
+	if (va_is_writable(va))
+		bc_flush(blockno, 1);
+	return !va_is_writable(va);
+}
+
+// Replace the page at 'va', which some client has mapped, with a
+// writable copy, leaving the client the old contents.
+static void
+bc_unshare(void *va)
+{
+	int r;
+
+	if ((r = sys_page_alloc(0, UTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+		panic("bc_unshare: %e", r);
+	memmove(UTEMP, va, BLKSIZE);
+	if ((r = sys_page_map(0, UTEMP, 0, va, PTE_P | PTE_U | PTE_W)) < 0 ||
+	    (r = sys_page_unmap(0, UTEMP)) < 0)
+		panic("bc_unshare: %e", r);
+}
+
 // Fault any disk block that is read in to memory by
 // loading it from disk.
 static void
@@ -42,6 +283,24 @@ bc_pgfault(struct UTrapframe *utf)
 	if (super && blockno >= super->s_nblocks)
 		panic("reading non-existent block %08x\n", blockno);
 
+	// A write to a clean block: it's about to become dirty.  If
+	// a write of the block is queued, it can wait for the next one;
+	// if it's being written out, let that finish first.  A page a
+	// client has mapped is copied, so the client's view doesn't change.
+	if ((utf->utf_err & (FEC_PR | FEC_WR)) == (FEC_PR | FEC_WR)) {
+		addr = ROUNDDOWN(addr, PGSIZE);
+		bio_cancel(blockno);
+		if ((r = bio_wait(blockno)) < 0)
+			panic("in bc_pgfault, bio_wait: %e", r);
+		bc_dirty_add(blockno);
+		if (pageref(addr) > 1)
+			bc_unshare(addr);
+		else if ((r = sys_page_map(0, addr, 0, addr,
+					   PTE_P | PTE_U | PTE_W)) < 0)
+			panic("in bc_pgfault, sys_page_map: %e", r);
+		return;
+	}
+
 	// Allocate a page in the disk map region, read the contents
 	// of the block from the disk into that page.
 	// Hint: first round addr to page boundary. fs/ide.c has code to read
@@ -50,31 +309,206 @@ bc_pgfault(struct UTrapframe *utf)
 	// LAB 5: you code here:
   addr = ROUNDDOWN(addr, PGSIZE);
 
-  if ( (r = sys_page_alloc(0, addr, PTE_P | PTE_U | PTE_W)) < 0)
+	// The block may already be queued, by read-ahead or another
+	// worker; otherwise queue it.  Either way, wait only for this
+	// block.  The queue maps it read-only and clean, and checks that
+	// it was allocated.  Making room or waiting for the queue can let
+	// another worker read or queue it first, so check again after.
+  while (!va_is_mapped(addr) && !bio_pending(blockno)) {
+    bc_reserve(1);
+    if (va_is_mapped(addr) || bio_pending(blockno))
+      break;
+    if (bio_read(blockno, 1) == 1)
+      bc_track(blockno);
+    else
+      bio_step();
+  }
+  if ((r = bio_wait(blockno)) < 0)
     panic("bc_pgfault: %e\n", r);
 
-  if ( (r = ide_read(blockno * BLKSECTS, addr, BLKSECTS)) < 0)
-    panic("bc_pgfault: %e\n", r);
+	// Make it writable if this fault is a write.
+  if (utf->utf_err & FEC_WR) {
+    bc_dirty_add(blockno);
+    if ((r = sys_page_map(0, addr, 0, addr, PTE_P | PTE_U | PTE_W)) < 0)
+      panic("in bc_pgfault, sys_page_map: %e", r);
+  }
+}
+
+// How many blocks from 'blockno' on, up to 'n', are neither cached nor
+// queued?
+static uint32_t
+bc_absent(uint32_t blockno, uint32_t n)
+{
+	uint32_t i;
+
+	for (i = 0; i < n && !va_is_mapped(diskaddr(blockno + i)) &&
+		    !bio_pending(blockno + i); i++)
+		;
+	return i;
+}
+
+// Queue reads of the blocks among [blockno, blockno+nblocks) that are
+// neither cached nor queued, a run of consecutive blocks per request,
+// rather than a page fault and disk read per block.  Returns the number
+// of blocks queued.
+static uint32_t
+bc_fill(uint32_t blockno, uint32_t nblocks)
+{
+	uint32_t b, i, n, end, nread;
+
+	nread = 0;
+	end = blockno + nblocks;
+	for (b = blockno; b < end; b += n) {
+		if ((n = bc_absent(b, MIN(end - b, BC_MAXRUN))) == 0) {
+			n = 1;
+			continue;
+		}
+
+		// Make room before queueing any of the run, so that
+		// eviction can't pick blocks we're about to fill.  That
+		// can let another worker queue some of them first, and the
+		// queue may take only part of the run; look again for the
+		// rest.
+		bc_reserve(n);
+		if ((n = bc_absent(b, n)) == 0)
+			continue;
+		if ((n = bio_read(b, n)) == 0) {
+			bio_step();
+			continue;
+		}
+		for (i = 0; i < n; i++)
+			bc_track(b + i);
+		nread += n;
+	}
+	return nread;
+}
+
+// Bring blocks [blockno, blockno+nblocks) into the cache, counting
+// each as a lookup.
+void
+bc_read(uint32_t blockno, uint32_t nblocks)
+{
+	uint32_t b, nread;
+	int r;
+
+	nread = bc_fill(blockno, nblocks);
+	bc_misses += nread;
+	bc_hits += nblocks - nread;
 
-	// Clear the dirty bit for the disk block page since we just read the
-	// block from disk
-  if ((r = sys_page_map(0, addr, 0, addr, uvpt[PGNUM(addr)] & PTE_SYSCALL)) < 0)
-    panic("in bc_pgfault, sys_page_map: %e", r);
+	for (b = blockno; b < blockno + nblocks; b++)
+		if (bio_pending(b) && (r = bio_wait(b)) < 0)
+			panic("bc_read: %e", r);
+}
+
+// Queue reads of blocks [blockno, blockno+nblocks) ahead of their use,
+// without counting lookups.
+void
+bc_prefetch(uint32_t blockno, uint32_t nblocks)
+{
+	bc_readahead += bc_fill(blockno, nblocks);
+}
+
+// Fill blocks [blockno, blockno+nblocks) with zeros and queue their
+// writes, a run at a time, without reading them from the disk first:
+// blocks not cached get a fresh page.
+void
+bc_zero(uint32_t blockno, uint32_t nblocks)
+{
+	uint32_t b, i, n, end;
+	void *va;
+	int r;
+
+	end = blockno + nblocks;
+	for (b = blockno; b < end; b += n) {
+		n = MIN(end - b, BC_MAXRUN);
+		bc_reserve(n);
+		for (i = 0; i < n; i++) {
+			va = diskaddr(b + i);
+			if (!va_is_mapped(va) && bio_pending(b + i) &&
+			    (r = bio_wait(b + i)) < 0)
+				panic("bc_zero: %e", r);
+			if (!va_is_mapped(va)) {
+				if ((r = sys_page_alloc(0, va,
+							PTE_P | PTE_U | PTE_W)) < 0)
+					panic("bc_zero: %e", r);
+				bc_track(b + i);
+				bc_dirty_add(b + i);
+			}
+			// A cached block faults in bc_pgfault, as any write.
+			memset(va, 0, BLKSIZE);
+		}
+		bc_flush(b, n);
+	}
+}
+
+// Queue writes of the dirty blocks among [blockno, blockno+nblocks),
+// a run of consecutive dirty blocks per request, and map them read-only
+// again, which clears PTE_D.  Blocks in the journal's running
+// transaction are left dirty.
+void
+bc_flush(uint32_t blockno, uint32_t nblocks)
+{
+	uint32_t b, i, n, end;
+	void *va;
+	int r;
 
-	// Check that the block we read was allocated. (exercise for
-	// the reader: why do we do this *after* reading the block
-	// in?)
-	if (bitmap && block_is_free(blockno))
-		panic("reading free block %08x\n", blockno);
+	end = blockno + nblocks;
+	for (b = blockno; b < end; b += n) {
+		for (n = 0; b + n < end && n < BC_MAXRUN &&
+			    va_is_mapped(diskaddr(b + n)) &&
+			    va_is_dirty(diskaddr(b + n)) &&
+			    !journal_running(b + n); n++)
+			;
+		if (n == 0) {
+			// Writable but never written: just protect it.
+			va = diskaddr(b);
+			if (va_is_writable(va) && !va_is_dirty(va) &&
+			    (r = sys_page_map(0, va, 0, va, PTE_P | PTE_U)) < 0)
+				panic("bc_flush: %e", r);
+			n = 1;
+			continue;
+		}
+
+		// Protect the blocks first: queueing the write may wait, and
+		// another worker may evict them meanwhile.
+		for (i = 0; i < n; i++)
+			sysbatch_add(&bc_batch, SYS_page_map, 0,
+				     (uint32_t) diskaddr(b + i), 0,
+				     (uint32_t) diskaddr(b + i), PTE_P | PTE_U);
+		if ((r = sysbatch_flush(&bc_batch)) < 0)
+			panic("bc_flush: %e", r);
+		bio_write(b, n);
+	}
+}
+
+// Write back every dirty block, sorted by block number so that
+// consecutive blocks go out together.  Takes time in the number of
+// dirty blocks, not the size of the disk or the cache.  Blocks the
+// journal holds are left for its checkpoint.
+void
+bc_writeback(void)
+{
+	uint32_t i, n, run;
+
+	n = bc_dirty_collect();
+	for (i = 0; i < n; i += run) {
+		if (journal_holds(bc_dirty[i])) {
+			run = 1;
+			continue;
+		}
+		for (run = 1; i + run < n && run < BC_MAXRUN &&
+			    bc_dirty[i + run] == bc_dirty[i] + run &&
+			    !journal_holds(bc_dirty[i + run]); run++)
+			;
+		bc_flush(bc_dirty[i], run);
+	}
+	bc_ndirty = 0;
 }
 
 // Flush the contents of the block containing VA out to disk if
 // necessary, then clear the PTE_D bit using sys_page_map.
 // If the block is not in the block cache or is not dirty, does
 // nothing.
-// Hint: Use va_is_mapped, va_is_dirty, and ide_write.
-// Hint: Use the PTE_SYSCALL constant when calling sys_page_map.
-// Hint: Don't forget to round addr down.
 void
 flush_block(void *addr)
 {
@@ -83,20 +517,7 @@ flush_block(void *addr)
 	if (addr < (void*)DISKMAP || addr >= (void*)(DISKMAP + DISKSIZE))
 		panic("flush_block of bad va %08x", addr);
 
-	// LAB 5: Your code here.
-
-  // if not mapped, don't do anything
-  if (!va_is_mapped(addr) || !va_is_dirty(addr))
-    return;
-
-  int r;
-
-  addr = ROUNDDOWN(addr, PGSIZE);
-  if ( (r = ide_write(blockno * BLKSECTS, addr, BLKSECTS)) < 0)
-    panic("flush_block: %e", r);
-
-  if ((r = sys_page_map(0, addr, 0, addr, uvpt[PGNUM(addr)] & PTE_SYSCALL)) < 0)
-    panic("in bc_pgfault, sys_page_map: %e", r);
+	bc_flush(blockno, 1);
 }
 
 // Test that the block cache works, by smashing the superblock and
@@ -116,7 +537,8 @@ check_bc(void)
 	assert(va_is_mapped(diskaddr(1)));
 	assert(!va_is_dirty(diskaddr(1)));
 
-	// clear it out
+	// clear it out, once the write is done
+	bio_sync();
 	sys_page_unmap(0, diskaddr(1));
 	assert(!va_is_mapped(diskaddr(1)));
 
@@ -0,0 +1,349 @@
+/*
+ * Block I/O queue between the block cache and the disk driver.
+ *
+ * The cache queues reads and writes of runs of blocks here instead of
+ * calling the driver.  Adjacent requests in the same direction are
+ * merged, and the queue is served in C-LOOK order: upward from the
+ * last block the disk touched, then back to the lowest request.  It
+ * runs when the file server is done with a request (bio_run), when a
+ * caller needs a particular block (bio_wait), or when it fills up.
+ *
+ * A queued read is read into staging pages at bio_stageva and mapped
+ * at its disk address only once it completes, so touching a block
+ * that is still queued faults, and bc_pgfault waits for it.
+ *
+ * A worker reading from the disk lets go of fs_lock meanwhile, leaving
+ * its request queued but marked running, so that other workers wait
+ * for it rather than read the blocks again or run it themselves.
+ */
+
+#include "fs.h"
+
+// Requests queued at once
+#define BIO_MAXREQ	64
+
+// Queued reads land in BIO_STAGEPAGES pages at BIO_STAGEVA, indexed by
+// block number, so a run of blocks is a run of pages.  Blocks that are
+// BIO_STAGEPAGES apart share a page and can't be queued together.
+#define BIO_STAGEVA	0x0e000000
+#define BIO_STAGEPAGES	4096
+
+struct Bio {
+	bool b_busy;		// queued
+	bool b_write;
+	bool b_running;		// being read, without fs_lock
+	uint32_t b_blockno;
+	uint32_t b_nblocks;
+	uint32_t b_seq;		// arrival order, for BIO_SCHED_FIFO
+};
+
+static struct Bio bio_queue[BIO_MAXREQ];
+static uint32_t bio_nqueued;
+static uint32_t bio_seq;
+static uint32_t bio_head;		// block just past the last request run
+static int bio_sched = BIO_SCHED_CLOOK;
+static uint32_t bio_reqs, bio_merged, bio_reads, bio_seek;
+static uint32_t bio_writes, bio_written;
+
+static struct SysBatch bio_batch;
+
+static void *
+bio_stageva(uint32_t blockno)
+{
+	return (void *) (BIO_STAGEVA + (blockno % BIO_STAGEPAGES) * PGSIZE);
+}
+
+// The queued request covering 'blockno', or NULL.
+static struct Bio *
+bio_find(uint32_t blockno)
+{
+	struct Bio *b;
+
+	for (b = bio_queue; b < bio_queue + BIO_MAXREQ; b++)
+		if (b->b_busy && blockno >= b->b_blockno &&
+		    blockno < b->b_blockno + b->b_nblocks)
+			return b;
+	return NULL;
+}
+
+// Pick the request to run next: with C-LOOK, the lowest one at or past
+// the head, else the lowest one; with FIFO, the oldest.  Requests
+// already running don't count.  Returns NULL if there are none.
+static struct Bio *
+bio_next(void)
+{
+	struct Bio *b, *best, *lowest;
+
+	best = lowest = NULL;
+	for (b = bio_queue; b < bio_queue + BIO_MAXREQ; b++) {
+		if (!b->b_busy || b->b_running)
+			continue;
+		if (bio_sched == BIO_SCHED_FIFO) {
+			if (!best || b->b_seq < best->b_seq)
+				best = b;
+			continue;
+		}
+		if (!lowest || b->b_blockno < lowest->b_blockno)
+			lowest = b;
+		if (b->b_blockno >= bio_head &&
+		    (!best || b->b_blockno < best->b_blockno))
+			best = b;
+	}
+	return best ? best : lowest;
+}
+
+// Run request 'b' (from bio_next) and take it off the queue.  Writes
+// may still be in progress in the driver when this returns; reads are
+// done and mapped read-only at their disk addresses.  A read lets other
+// workers run meanwhile.
+static void
+bio_dispatch(struct Bio *b)
+{
+	uint32_t i, blockno, n;
+	int r;
+
+	blockno = b->b_blockno;
+	n = b->b_nblocks;
+
+	bio_seek += blockno > bio_head ? blockno - bio_head : bio_head - blockno;
+	bio_head = blockno + n;
+
+	if (b->b_write) {
+		b->b_busy = 0;
+		bio_nqueued--;
+		if ((r = disk_write(blockno * BLKSECTS, diskaddr(blockno),
+				    n * BLKSECTS)) < 0)
+			panic("bio_dispatch: %e", r);
+		bio_writes++;
+		bio_written += n;
+		return;
+	}
+
+	b->b_running = 1;
+	fs_unlock();
+	r = disk_read(blockno * BLKSECTS, bio_stageva(blockno), n * BLKSECTS);
+	// Enter the kernel before taking the lock back (see fs_lock),
+	// which also gives a worker waiting for it a turn.
+	sys_yield();
+	fs_lock();
+	b->b_running = 0;
+	b->b_busy = 0;
+	bio_nqueued--;
+	if (r < 0)
+		panic("bio_dispatch: %e", r);
+	bio_reads++;
+
+	// Move the blocks into the cache, read-only and clean.
+	for (i = 0; i < n; i++) {
+		sysbatch_add(&bio_batch, SYS_page_map, 0,
+			     (uint32_t) bio_stageva(blockno + i), 0,
+			     (uint32_t) diskaddr(blockno + i), PTE_P | PTE_U);
+		sysbatch_add(&bio_batch, SYS_page_unmap, 0,
+			     (uint32_t) bio_stageva(blockno + i), 0, 0, 0);
+	}
+	if ((r = sysbatch_flush(&bio_batch)) < 0)
+		panic("bio_dispatch: %e", r);
+
+	for (i = 0; i < n; i++)
+		if (bitmap && block_is_free(blockno + i))
+			panic("reading free block %08x\n", blockno + i);
+}
+
+// Can one request cover [blockno, blockno+n)?
+static bool
+bio_fits(uint32_t blockno, uint32_t n)
+{
+	return n <= BC_MAXRUN && blockno % BIO_STAGEPAGES + n <= BIO_STAGEPAGES;
+}
+
+// Queue a request, merging it into an adjacent one if it can.
+static void
+bio_add(uint32_t blockno, uint32_t n, bool write)
+{
+	struct Bio *b;
+
+	bio_reqs++;
+	if (bio_sched == BIO_SCHED_CLOOK) {
+		for (b = bio_queue; b < bio_queue + BIO_MAXREQ; b++) {
+			if (!b->b_busy || b->b_running || b->b_write != write ||
+			    !bio_fits(MIN(b->b_blockno, blockno), b->b_nblocks + n))
+				continue;
+			if (b->b_blockno + b->b_nblocks == blockno ||
+			    blockno + n == b->b_blockno) {
+				b->b_blockno = MIN(b->b_blockno, blockno);
+				b->b_nblocks += n;
+				bio_merged++;
+				return;
+			}
+		}
+	}
+
+	while (bio_nqueued == BIO_MAXREQ)
+		bio_step();
+	for (b = bio_queue; b->b_busy; b++)
+		;
+	b->b_busy = 1;
+	b->b_write = write;
+	b->b_blockno = blockno;
+	b->b_nblocks = n;
+	b->b_seq = bio_seq++;
+	bio_nqueued++;
+}
+
+// Queue a read of blocks [blockno, blockno+nblocks), which must not be
+// mapped or queued already.  They appear in the cache, read-only, once
+// the read runs.  Only as many are queued as can be without waiting,
+// which might let another worker queue the rest itself: a read that
+// shares staging pages with another still queued, or a full queue,
+// stops it.  Returns the number of blocks queued, from blockno on; the
+// caller can bio_step and check again if that's short.
+uint32_t
+bio_read(uint32_t blockno, uint32_t nblocks)
+{
+	uint32_t i, n, nread;
+	int r;
+
+	for (nread = 0; nread < nblocks; nread += n) {
+		n = MIN(MIN(nblocks - nread, BC_MAXRUN),
+			BIO_STAGEPAGES - (blockno + nread) % BIO_STAGEPAGES);
+		for (i = 0; i < n; i++)
+			if (va_is_mapped(bio_stageva(blockno + nread + i)))
+				break;
+		if ((n = i) == 0 || bio_nqueued == BIO_MAXREQ)
+			break;
+
+		for (i = 0; i < n; i++)
+			sysbatch_add(&bio_batch, SYS_page_alloc, 0,
+				     (uint32_t) bio_stageva(blockno + nread + i),
+				     PTE_P | PTE_U | PTE_W, 0, 0);
+		if ((r = sysbatch_flush(&bio_batch)) < 0)
+			panic("bio_read: %e", r);
+		bio_add(blockno + nread, n, 0);
+	}
+	return nread;
+}
+
+// Queue a write of the cached blocks [blockno, blockno+nblocks).  Keep
+// them read-only until the write runs (see bio_cancel and bio_wait).
+void
+bio_write(uint32_t blockno, uint32_t nblocks)
+{
+	uint32_t n;
+
+	for (; nblocks > 0; blockno += n, nblocks -= n) {
+		n = MIN(MIN(nblocks, BC_MAXRUN),
+			BIO_STAGEPAGES - blockno % BIO_STAGEPAGES);
+		bio_add(blockno, n, 1);
+	}
+}
+
+// Is a read or write of 'blockno' queued?
+bool
+bio_pending(uint32_t blockno)
+{
+	return bio_find(blockno) != NULL;
+}
+
+// Take 'blockno' out of a queued write, because it is about to change
+// again and will be written later anyway.  Returns whether it was
+// taken out.
+bool
+bio_cancel(uint32_t blockno)
+{
+	struct Bio *b, *nb;
+	uint32_t end;
+
+	if (!(b = bio_find(blockno)) || !b->b_write || b->b_running)
+		return 0;
+
+	end = b->b_blockno + b->b_nblocks;
+	if (blockno == b->b_blockno) {
+		b->b_blockno++;
+		b->b_nblocks--;
+	} else if (blockno == end - 1) {
+		b->b_nblocks--;
+	} else {
+		// In the middle: split the request in two, if there's room.
+		if (bio_nqueued == BIO_MAXREQ)
+			return 0;
+		for (nb = bio_queue; nb->b_busy; nb++)
+			;
+		*nb = *b;
+		nb->b_blockno = blockno + 1;
+		nb->b_nblocks = end - (blockno + 1);
+		b->b_nblocks = blockno - b->b_blockno;
+		bio_nqueued++;
+	}
+	if (b->b_nblocks == 0) {
+		b->b_busy = 0;
+		bio_nqueued--;
+	}
+	return 1;
+}
+
+// Run the next queued request, or if the others are all being read by
+// other workers, let those get on.
+void
+bio_step(void)
+{
+	struct Bio *b;
+
+	if ((b = bio_next()) != NULL)
+		bio_dispatch(b);
+	else
+		fs_yield();
+}
+
+// Run queued requests until none covers 'blockno', then wait for the
+// driver to finish writing it.  Returns 0, or < 0 if a write failed.
+int
+bio_wait(uint32_t blockno)
+{
+	while (bio_find(blockno))
+		bio_step();
+	return disk_sync_range(blockno * BLKSECTS, BLKSECTS);
+}
+
+// Run every queued request not already running, without waiting for
+// writes to finish.
+void
+bio_run(void)
+{
+	struct Bio *b;
+
+	while ((b = bio_next()) != NULL)
+		bio_dispatch(b);
+}
+
+// Run every queued request and wait until all writes are on disk.
+int
+bio_sync(void)
+{
+	while (bio_nqueued > 0)
+		bio_step();
+	return disk_sync();
+}
+
+// Set the queue's scheduling policy to 'sched' (BIO_SCHED_*).
+// Returns 0 on success, -E_INVAL if sched is unknown.
+int
+bio_set_sched(int sched)
+{
+	if (sched != BIO_SCHED_CLOOK && sched != BIO_SCHED_FIFO)
+		return -E_INVAL;
+	bio_run();
+	bio_sched = sched;
+	return 0;
+}
+
+void
+bio_stats(struct Fsret_stats *ret)
+{
+	ret->ret_bc_writes = bio_writes;
+	ret->ret_bc_written = bio_written;
+	ret->ret_bio_sched = bio_sched;
+	ret->ret_bio_reqs = bio_reqs;
+	ret->ret_bio_merged = bio_merged;
+	ret->ret_bio_reads = bio_reads;
+	ret->ret_bio_seek = bio_seek;
+}
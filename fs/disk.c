@@ -0,0 +1,90 @@
+/*
+ * The disk the file system lives on: a virtio-blk device if there is
+ * one (make VIRTIO=1), otherwise an IDE disk.  The drivers take one
+ * caller at a time; bio_dispatch calls disk_read without fs_lock.
+ */
+
+#include "fs.h"
+
+static bool use_virtio;
+static struct Lock disk_lock;
+
+void
+disk_init(void)
+{
+	if (virtio_blk_init() == 0) {
+		use_virtio = 1;
+		return;
+	}
+
+	// Find a JOS disk.  Use the second IDE disk (number 1) if available.
+	if (ide_probe_disk1())
+		ide_set_disk(1);
+	else
+		ide_set_disk(0);
+	ide_dma_init();
+}
+
+// Read 'nsecs' sectors starting at 'secno' into 'dst'.
+// Returns 0 on success, < 0 on error.
+int
+disk_read(uint32_t secno, void *dst, size_t nsecs)
+{
+	int r;
+
+	lock_acquire(&disk_lock);
+	if (use_virtio)
+		r = virtio_blk_read(secno, dst, nsecs);
+	else
+		r = ide_read(secno, dst, nsecs);
+	lock_release(&disk_lock);
+	return r;
+}
+
+// Write 'nsecs' sectors from 'src' starting at 'secno'.  The write may
+// still be in progress when this returns: 'src' must stay mapped and
+// unchanged until disk_sync or a disk_sync_range that covers it.
+// Returns 0 on success, < 0 on error (possibly an earlier write's).
+int
+disk_write(uint32_t secno, const void *src, size_t nsecs)
+{
+	int r;
+
+	lock_acquire(&disk_lock);
+	if (use_virtio)
+		r = virtio_blk_write(secno, src, nsecs);
+	else
+		r = ide_write(secno, src, nsecs);
+	lock_release(&disk_lock);
+	return r;
+}
+
+// Wait for every write in progress to finish.
+int
+disk_sync(void)
+{
+	int r;
+
+	lock_acquire(&disk_lock);
+	if (use_virtio)
+		r = virtio_blk_sync();
+	else
+		r = ide_sync();
+	lock_release(&disk_lock);
+	return r;
+}
+
+// Wait for the writes in progress to sectors [secno, secno+nsecs).
+int
+disk_sync_range(uint32_t secno, size_t nsecs)
+{
+	int r;
+
+	lock_acquire(&disk_lock);
+	if (use_virtio)
+		r = virtio_blk_sync_range(secno, nsecs);
+	else
+		r = ide_sync_range(secno, nsecs);
+	lock_release(&disk_lock);
+	return r;
+}
@@ -24,6 +24,12 @@ check_super(void)
 // Free block bitmap
 // --------------------------------------------------------------
 
+// Free blocks in each allocation group (AG_BLOCKS blocks), so that
+// searches skip full groups and new directories find empty ones.
+#define AG_MAX		(DISKSIZE / BLKSIZE / AG_BLOCKS)
+#define AG_WORDS	(AG_BLOCKS / 32)
+static uint32_t ag_nfree[AG_MAX];
+
 // Check to see if the block bitmap indicates that block 'blockno' is free.
 // Return 1 if the block is free, 0 if not.
 bool
@@ -43,42 +49,292 @@ free_block(uint32_t blockno)
 	// Blockno zero is the null pointer of block numbers.
 	if (blockno == 0)
 		panic("attempt to free zero block");
+	journal_dirty(&bitmap[blockno/32]);
+	journal_dirty(super);
+	if (!block_is_free(blockno)) {
+		super->s_nfree++;
+		ag_nfree[blockno / AG_BLOCKS]++;
+	}
 	bitmap[blockno/32] |= 1<<(blockno%32);
 }
 
-// Search the bitmap for a free block and allocate it.  When you
-// allocate a block, immediately flush the changed bitmap block
-// to disk.
+// A file being appended to keeps a window of free blocks past its last
+// one, which other files' blocks stay out of while there is room
+// elsewhere, so that files growing side by side don't interleave.
+// Windows live only in memory and go away when the file is closed or
+// truncated, or when the slot is needed for another file.
+#define PA_WINDOW	32
+#define PA_MAX		16
+
+struct Prealloc {
+	struct File *pa_file;	// NULL if the slot is free
+	uint32_t pa_start;	// [pa_start, pa_end) is reserved
+	uint32_t pa_end;
+};
+
+static struct Prealloc prealloc[PA_MAX];
+static uint32_t pa_next;	// slot to take next
+
+// Block at which alloc_block starts looking (next fit), so
+// allocations don't rescan the full words at the front of the disk.
+static uint32_t alloc_cursor;
+
+// Is 'blockno' in the window of a file other than 'f'?
+static bool
+pa_reserved(uint32_t blockno, struct File *f)
+{
+	int i;
+
+	for (i = 0; i < PA_MAX; i++)
+		if (prealloc[i].pa_file && prealloc[i].pa_file != f &&
+		    blockno >= prealloc[i].pa_start &&
+		    blockno < prealloc[i].pa_end)
+			return 1;
+	return 0;
+}
+
+static struct Prealloc *
+pa_find(struct File *f)
+{
+	int i;
+
+	for (i = 0; i < PA_MAX; i++)
+		if (prealloc[i].pa_file == f)
+			return &prealloc[i];
+	return NULL;
+}
+
+// Give 'f' a window starting at 'next': the free blocks from there, up
+// to PA_WINDOW of them and not into another file's window.
+static void
+pa_set(struct File *f, uint32_t next)
+{
+	struct Prealloc *pa;
+	uint32_t end;
+
+	for (end = next; end < next + PA_WINDOW && block_is_free(end) &&
+		     !pa_reserved(end, f); end++)
+		;
+	if ((pa = pa_find(f)) == NULL) {
+		if (end == next)
+			return;
+		pa = &prealloc[pa_next];
+		pa_next = (pa_next + 1) % PA_MAX;
+	}
+	pa->pa_file = end > next ? f : NULL;
+	pa->pa_start = next;
+	pa->pa_end = end;
+}
+
+// Give up f's window, if it has one.
+static void
+pa_drop(struct File *f)
+{
+	struct Prealloc *pa;
+
+	if ((pa = pa_find(f)) != NULL)
+		pa->pa_file = NULL;
+}
+
+// Find a free block at or after 'goal', wrapping around, a bitmap word
+// at a time and a group at a time past full groups.  Unless 'any', skip
+// blocks in the windows of files other than 'f'.  Returns the block, or
+// -E_NO_DISK if there is none.
+static int
+alloc_search(uint32_t goal, struct File *f, bool any)
+{
+	uint32_t nwords, w, n, bits, blockno;
+
+	nwords = (super->s_nblocks + 31) / 32;
+	w = goal / 32;
+	bits = bitmap[w] & (~0U << (goal % 32));
+	for (n = 0; n <= nwords; n++) {
+		for (; bits; bits &= bits - 1) {
+			// bits past the end of the disk don't count
+			blockno = w * 32 + __builtin_ctz(bits);
+			if (blockno < super->s_nblocks &&
+			    (any || !pa_reserved(blockno, f)))
+				return blockno;
+		}
+		if (++w >= nwords)
+			w = 0;
+		while (w % AG_WORDS == 0 && ag_nfree[w / AG_WORDS] == 0 &&
+		       n < nwords) {
+			w = w + AG_WORDS < nwords ? w + AG_WORDS : 0;
+			n += AG_WORDS;
+		}
+		bits = bitmap[w];
+	}
+	return -E_NO_DISK;
+}
+
+// Search the bitmap for a free block and allocate it, near 'goal' and
+// for file 'f' (NULL for metadata that belongs to no one file).  The
+// changed bitmap block goes into the journal's running transaction,
+// with the rest of the metadata the request changes.
+//
+// The search starts at goal and moves on to later groups, wrapping
+// around.  A block in another file's window is taken only if there is
+// nothing else.  super->s_nfree lets a full disk fail without
+// searching.  f's window moves to just past the block.
 //
 // Return block number allocated on success,
-// -E_NO_DISK if we are out of blocks.
+// -E_NO_DISK if we are out of blocks,
+// -E_AGAIN if the request in progress may only read (see fs_shared).
+int
+alloc_block_near(uint32_t goal, struct File *f)
+{
+	int r;
+
+	if (fs_shared())
+		return -E_AGAIN;
+	if (super->s_nfree == 0)
+		return -E_NO_DISK;
+
+	if (goal >= super->s_nblocks)
+		goal = 0;
+	if ((r = alloc_search(goal, f, 0)) < 0 &&
+	    (r = alloc_search(goal, f, 1)) < 0)
+		return r;
+	if ((r = alloc_block_at(r)) < 0)
+		return r;
+	if (f)
+		pa_set(f, r + 1);
+	return r;
+}
+
+// Allocate a block for metadata: next fit from the last block
+// allocated.  Returns as alloc_block_near.
 //
 // Hint: use free_block as an example for manipulating the bitmap.
 int
 alloc_block(void)
 {
-	// The bitmap consists of one or more blocks.  A single bitmap block
-	// contains the in-use bits for BLKBITSIZE blocks.  There are
-	// super->s_nblocks blocks in the disk altogether.
-
-	// LAB 5: Your code here.
-    uint32_t i;
+	return alloc_block_near(alloc_cursor, NULL);
+}
 
-    for (i = 0; i < super->s_nblocks; i++) {
-        if (block_is_free(i)) {
-            bitmap[i / 32] &= ~(1 << (i % 32));     // set bitmap free
-            flush_block(diskaddr(i));               // flush block entry
-            return i;
-        }
-    }
+// Allocate block 'blockno' if it is free.  Returns blockno on success,
+// -E_NO_DISK if it's in use or past the end of the disk, -E_AGAIN as
+// for alloc_block_near.
+int
+alloc_block_at(uint32_t blockno)
+{
+	if (fs_shared())
+		return -E_AGAIN;
+	if (!block_is_free(blockno))
+		return -E_NO_DISK;
+
+	journal_dirty(&bitmap[blockno/32]);
+	journal_dirty(super);
+	bitmap[blockno/32] &= ~(1<<(blockno%32));
+	super->s_nfree--;
+	ag_nfree[blockno / AG_BLOCKS]--;
+
+	// Replay would copy the block's old metadata over whatever it
+	// holds now, unless the journal has a newer copy.
+	if (journal_holds(blockno))
+		journal_dirty(diskaddr(blockno));
+	alloc_cursor = blockno;
+	return blockno;
+}
 
+// Find 'n' free blocks in a row at or after 'goal', wrapping around,
+// none in the window of a file other than 'f'.  Returns the first, or
+// -E_NO_DISK if there is no such run.
+static int
+alloc_search_run(uint32_t goal, struct File *f, uint32_t n)
+{
+	uint32_t b, i, start, len;
+
+	if (goal >= super->s_nblocks)
+		goal = 0;
+	start = len = 0;
+	for (i = 0, b = goal; i < super->s_nblocks + n; i++, b++) {
+		if (b == super->s_nblocks) {
+			b = 0;
+			len = 0;
+		}
+		if (b % 32 == 0 && bitmap[b / 32] == 0 &&
+		    b + 32 <= super->s_nblocks) {
+			// 32 blocks in use
+			b += 31;
+			i += 31;
+			len = 0;
+		} else if (block_is_free(b) && !pa_reserved(b, f)) {
+			if (len++ == 0)
+				start = b;
+			if (len == n)
+				return start;
+		} else
+			len = 0;
+	}
 	return -E_NO_DISK;
 }
 
+// Allocate the 'n' free blocks from 'start', a bitmap word at a time.
+static void
+alloc_run_at(uint32_t start, uint32_t n)
+{
+	uint32_t b, end, w, lo, hi, mask;
+
+	end = start + n;
+	journal_dirty(super);
+	for (b = start; b < end; b = (w + 1) * 32) {
+		w = b / 32;
+		lo = b % 32;
+		hi = MIN(end - w * 32, 32);
+		mask = (hi == 32 ? ~0U : (1U << hi) - 1) & ~((1U << lo) - 1);
+		journal_dirty(&bitmap[w]);
+		bitmap[w] &= ~mask;
+		ag_nfree[w / AG_WORDS] -= hi - lo;
+	}
+	super->s_nfree -= n;
+
+	for (b = start; b < end; b++)
+		if (journal_holds(b))
+			journal_dirty(diskaddr(b));
+	alloc_cursor = end - 1;
+}
+
+// Where f's first block should go: for a file, after the directory
+// block naming it; for a new directory, at the start of the group with
+// the most free blocks, so that directories and their files spread
+// over the disk.
+static uint32_t
+file_home(struct File *f)
+{
+	uint32_t g, best, ngroups;
+
+	if (f->f_type != FTYPE_DIR || f == &super->s_root)
+		return ((uint32_t) f - DISKMAP) / BLKSIZE;
+
+	ngroups = (super->s_nblocks + AG_BLOCKS - 1) / AG_BLOCKS;
+	for (g = best = 0; g < ngroups; g++)
+		if (ag_nfree[g] > ag_nfree[best])
+			best = g;
+	return best * AG_BLOCKS;
+}
+
+// Count the free blocks in the bitmap, setting ag_nfree on the way.
+static uint32_t
+count_free_blocks(void)
+{
+	uint32_t i, n;
+
+	n = 0;
+	memset(ag_nfree, 0, sizeof(ag_nfree));
+	for (i = 0; i < super->s_nblocks; i++)
+		if (block_is_free(i)) {
+			ag_nfree[i / AG_BLOCKS]++;
+			n++;
+		}
+	return n;
+}
+
 // Validate the file system bitmap.
 //
-// Check that all reserved blocks -- 0, 1, and the bitmap blocks themselves --
-// are all marked as in-use.
+// Check that all reserved blocks -- 0, 1, the bitmap blocks themselves
+// and the journal -- are all marked as in-use.
 void
 check_bitmap(void)
 {
@@ -92,6 +348,10 @@ check_bitmap(void)
 	assert(!block_is_free(0));
 	assert(!block_is_free(1));
 
+	// Make sure the journal is marked in-use
+	for (i = 0; i < super->s_njournal; i++)
+		assert(!block_is_free(super->s_journal + i));
+
 	cprintf("bitmap is good\n");
 }
 
@@ -107,77 +367,287 @@ fs_init(void)
 {
 	static_assert(sizeof(struct File) == 256);
 
-       // Find a JOS disk.  Use the second IDE disk (number 1) if availabl
-       if (ide_probe_disk1())
-               ide_set_disk(1);
-       else
-               ide_set_disk(0);
+	disk_init();
 	bc_init();
 
 	// Set "super" to point to the super block.
 	super = diskaddr(1);
 	check_super();
 
+	// Finish or undo the metadata updates a crash interrupted.
+	journal_init();
+
 	// Set "bitmap" to the beginning of the first bitmap block.
 	bitmap = diskaddr(2);
 	check_bitmap();
-	
+
+	// The free count is journaled with the bitmap, but recount in
+	// case the image predates that.  The groups' counts are only
+	// kept in memory.
+	if (super->s_nfree != count_free_blocks()) {
+		journal_dirty(super);
+		super->s_nfree = count_free_blocks();
+		journal_commit();
+	}
+
+}
+
+// Make sure the indirect block '*pbno' exists.  When 'alloc' is set
+// and it doesn't, allocate a cleared block for it.
+//
+// Returns 0 on success, -E_NOT_FOUND if the block is missing and alloc
+// was 0, -E_NO_DISK if there's no space on the disk for it.
+static int
+indirect_block(uint32_t *pbno, bool alloc)
+{
+	int r;
+
+	if (*pbno)
+		return 0;
+	if (!alloc)
+		return -E_NOT_FOUND;
+	if ((r = alloc_block()) < 0)
+		return r;
+	journal_dirty(diskaddr(r));
+	memset(diskaddr(r), 0, BLKSIZE);
+	journal_dirty(pbno);
+	*pbno = r;
+	return 0;
 }
 
 // Find the disk block number slot for the 'filebno'th block in file 'f'.
 // Set '*ppdiskbno' to point to that slot.
 // The slot will be one of the f->f_direct[] entries,
-// or an entry in the indirect block.
-// When 'alloc' is set, this function will allocate an indirect block
-// if necessary.
+// an entry in the indirect block, or an entry in one of the blocks
+// the double-indirect block points to.
+// When 'alloc' is set, this function will allocate indirect blocks
+// if necessary.  Only used for files without FILE_EXTENTS.
 //
 // Returns:
 //	0 on success (but note that *ppdiskbno might equal 0).
 //	-E_NOT_FOUND if the function needed to allocate an indirect block, but
 //		alloc was 0.
 //	-E_NO_DISK if there's no space on the disk for an indirect block.
-//	-E_INVAL if filebno is out of range (it's >= NDIRECT + NINDIRECT).
+//	-E_INVAL if filebno is out of range.
 //
 // Analogy: This is like pgdir_walk for files.
 // Hint: Don't forget to clear any block you allocate.
 static int
 file_block_walk(struct File *f, uint32_t filebno, uint32_t **ppdiskbno, bool alloc)
 {
-       // LAB 5: Your code here.
+	int r;
+	uint32_t *ind;
+
+	if (filebno < NDIRECT) {
+		if (ppdiskbno)
+			*ppdiskbno = &f->f_direct[filebno];
+		return 0;
+	}
+
+	filebno -= NDIRECT;
+	if (filebno < NINDIRECT) {
+		if ((r = indirect_block(&f->f_indirect, alloc)) < 0)
+			return r;
+		ind = (uint32_t *) diskaddr(f->f_indirect);
+		if (ppdiskbno)
+			*ppdiskbno = &ind[filebno];
+		return 0;
+	}
+
+	filebno -= NINDIRECT;
+	if (filebno >= NINDIRECT * NINDIRECT)
+		return -E_INVAL;
+	if ((r = indirect_block(&f->f_dindirect, alloc)) < 0)
+		return r;
+	ind = (uint32_t *) diskaddr(f->f_dindirect);
+	if ((r = indirect_block(&ind[filebno / NINDIRECT], alloc)) < 0)
+		return r;
+	ind = (uint32_t *) diskaddr(ind[filebno / NINDIRECT]);
+	if (ppdiskbno)
+		*ppdiskbno = &ind[filebno % NINDIRECT];
+	return 0;
+}
+
+// Find block 'filebno' of extent-mapped file 'f'.  Set *diskbno to its
+// disk block and return the number of blocks, counting it, left in its
+// extent.  Returns 0 if the extents don't reach filebno.
+static uint32_t
+extent_lookup(struct File *f, uint32_t filebno, uint32_t *diskbno)
+{
+	uint32_t i;
+	struct Extent *e;
 
-       if (filebno >= NDIRECT + NINDIRECT)
-           return -E_INVAL;
+	for (i = 0; i < f->f_nextent; i++) {
+		e = &f->f_extent[i];
+		if (filebno < e->e_len) {
+			*diskbno = e->e_start + filebno;
+			return e->e_len - filebno;
+		}
+		filebno -= e->e_len;
+	}
+	return 0;
+}
 
-       int r, block;
-       uint32_t i, *ind_block, *dblocks = f->f_direct;
+static void extent_truncate(struct File *f, uint32_t nblocks);
 
-       if (filebno < NDIRECT) {
-           // the requested block is in the direct blocks, so just get it
-           if (ppdiskbno) *ppdiskbno = &dblocks[filebno];
-           return 0;
-       }
+// Switch 'f' from extents to block pointers, because it has become too
+// fragmented for NEXTENT extents.
+//
+// Returns 0 on success, -E_NO_DISK if there isn't room for the indirect
+// blocks (in which case f keeps its extents).
+static int
+file_extents_to_tree(struct File *f)
+{
+	struct Extent ext[NEXTENT];
+	uint32_t i, j, n, bno, nind, *ptr;
+	int r;
 
-       if ( !(f->f_indirect) ) {
-           // we need to allocate a new indirect block
+	// Block pointers never map blocks past the end, so give back any
+	// file_allocate took.
+	extent_truncate(f, ROUNDUP(f->f_size, BLKSIZE) / BLKSIZE);
+	if (f->f_nextent < NEXTENT)
+		return 0;
+	bno = 0;
+	for (i = 0; i < f->f_nextent; i++)
+		bno += f->f_extent[i].e_len;
+
+	// Reserve the indirect blocks up front so we can't fail halfway.
+	nind = 0;
+	if (bno > NDIRECT)
+		nind++;
+	if (bno > NDIRECT + NINDIRECT)
+		nind += 1 + ROUNDUP(bno - NDIRECT - NINDIRECT, NINDIRECT) / NINDIRECT;
+	if (super->s_nfree < nind)
+		return -E_NO_DISK;
+
+	n = f->f_nextent;
+	journal_dirty(f);
+	memmove(ext, f->f_extent, sizeof(ext));
+	memset(f->f_extent, 0, sizeof(f->f_extent));
+	f->f_nextent = 0;
+	f->f_flags &= ~FILE_EXTENTS;
+
+	bno = 0;
+	for (i = 0; i < n; i++)
+		for (j = 0; j < ext[i].e_len; j++, bno++) {
+			if ((r = file_block_walk(f, bno, &ptr, 1)) < 0)
+				panic("file_extents_to_tree: %e", r);
+			journal_dirty(ptr);
+			*ptr = ext[i].e_start + j;
+		}
+	return 0;
+}
 
-           if (!alloc)
-               return -E_NOT_FOUND;
+// Grow the last extent of 'f' by a block, if the next disk block is
+// free and in no other file's window.  Returns whether it did.
+static bool
+extent_grow(struct File *f)
+{
+	struct Extent *e;
+	uint32_t next;
 
-           if ( (block = alloc_block()) < 0) 
-               return block;
+	if (f->f_nextent == 0)
+		return 0;
+	e = &f->f_extent[f->f_nextent - 1];
+	next = e->e_start + e->e_len;
+	if (!block_is_free(next) || pa_reserved(next, f) ||
+	    alloc_block_at(next) < 0)
+		return 0;
+	pa_set(f, next + 1);
+	journal_dirty(f);
+	e->e_len++;
+	return 1;
+}
+
+// Map one more block at the end of extent-mapped file 'f', growing its
+// last extent in place if extent_grow can.  If that fails and all
+// NEXTENT extents are in use, convert f to block pointers instead,
+// without adding a block.  Otherwise start a new extent as near as
+// possible.
+//
+// Returns 0 on success, -E_NO_DISK if the disk is full, -E_AGAIN as for
+// alloc_block_near.
+static int
+extent_append(struct File *f)
+{
+	struct Extent *e;
+	uint32_t next;
+	int r;
+
+	if (fs_shared())
+		return -E_AGAIN;
+
+	if (extent_grow(f))
+		return 0;
+	if (f->f_nextent == NEXTENT)
+		return file_extents_to_tree(f);
+
+	next = file_home(f);
+	if (f->f_nextent > 0) {
+		e = &f->f_extent[f->f_nextent - 1];
+		next = e->e_start + e->e_len;
+	}
+	if ((r = alloc_block_near(next, f)) < 0)
+		return r;
+	journal_dirty(f);
+	e = &f->f_extent[f->f_nextent++];
+	e->e_start = r;
+	e->e_len = 1;
+	return 0;
+}
+
+// Set *diskbno to the disk block holding block 'filebno' of 'f' and
+// return how many blocks from there on are consecutive on disk, without
+// allocating anything.  Returns 0 if filebno has no block yet.
+static uint32_t
+file_block_run(struct File *f, uint32_t filebno, uint32_t *diskbno)
+{
+	uint32_t *pdiskbno;
 
-           f->f_indirect = block;
-           memset(diskaddr(f->f_indirect), 0, BLKSIZE);
-       }
+	if (f->f_flags & FILE_INLINE)
+		return 0;
+	if (f->f_flags & FILE_EXTENTS)
+		return extent_lookup(f, filebno, diskbno);
+	if (file_block_walk(f, filebno, &pdiskbno, 0) < 0 || *pdiskbno == 0)
+		return 0;
+	*diskbno = *pdiskbno;
+	return 1;
+}
 
-       ind_block = (uint32_t *) diskaddr(f->f_indirect);
-       if (ppdiskbno) *ppdiskbno = &ind_block[filebno - NDIRECT];
+// Move the data of inline file 'f' out to a block of its own, so that
+// it can grow past NINLINE or be shared a page at a time.  The rest of
+// the block is zeroed, as the rest of f_data was.
+//
+// Returns 0 on success, -E_NO_DISK if the disk is full (in which case f
+// stays inline), -E_AGAIN as for alloc_block_near.
+static int
+file_inline_out(struct File *f)
+{
+	uint8_t data[NINLINE];
+	char *blk;
+	int r;
 
-       return 0;
+	if (fs_shared())
+		return -E_AGAIN;
+	journal_dirty(f);
+	memmove(data, f->f_data, sizeof(data));
+	memset(f->f_data, 0, sizeof(f->f_data));
+	f->f_flags = (f->f_flags & ~FILE_INLINE) | FILE_EXTENTS;
+	if (f->f_size == 0)
+		return 0;
+	if ((r = file_get_block(f, 0, &blk)) < 0) {
+		memmove(f->f_data, data, sizeof(data));
+		f->f_flags = (f->f_flags & ~FILE_EXTENTS) | FILE_INLINE;
+		return r;
+	}
+	memset(blk, 0, BLKSIZE);
+	memmove(blk, data, f->f_size);
+	return 0;
 }
 
 // Set *blk to the address in memory where the filebno'th
-// block of file 'f' would be mapped.
+// block of file 'f' would be mapped.  An inline file moves to a block
+// first.
 //
 // Returns 0 on success, < 0 on error.  Errors are:
 //	-E_NO_DISK if a block needed to be allocated but the disk is full.
@@ -187,29 +657,330 @@ file_block_walk(struct File *f, uint32_t filebno, uint32_t **ppdiskbno, bool all
 int
 file_get_block(struct File *f, uint32_t filebno, char **blk)
 {
-       // LAB 5: Your code here.
-       if (filebno >= NDIRECT + NINDIRECT)
-           return -E_INVAL;
+	// LAB 5: Your code here.
+	int r;
+	uint32_t diskbno, *pdiskbno;
 
-       int r;
-       uint32_t *pdiskbno;
+	if (filebno >= MAXFILESIZE / BLKSIZE)
+		return -E_INVAL;
+	if ((f->f_flags & FILE_INLINE) && (r = file_inline_out(f)) < 0)
+		return r;
 
-       if ( (r = file_block_walk(f, filebno, &pdiskbno, true)) < 0)
-           return r;
+	// Extents can't have holes, so map every block up to filebno.
+	// This stops if extent_append converts f to block pointers.
+	while (f->f_flags & FILE_EXTENTS) {
+		if (extent_lookup(f, filebno, &diskbno) > 0) {
+			*blk = bc_lookup(diskbno);
+			return 0;
+		}
+		if ((r = extent_append(f)) < 0)
+			return r;
+	}
 
-       if ( !(*pdiskbno) ) {
-           if ( (r = alloc_block()) < 0)
-               return -E_NO_DISK;
-           else
-               *pdiskbno = r;
-       }
+	if ((r = file_block_walk(f, filebno, &pdiskbno, true)) < 0)
+		return r;
 
-       *blk = diskaddr(*pdiskbno);
+	if (!*pdiskbno) {
+		// Just after the block before, if it has one.
+		if (filebno > 0 && file_block_run(f, filebno - 1, &diskbno) > 0)
+			diskbno++;
+		else
+			diskbno = file_home(f);
+		if ((r = alloc_block_near(diskbno, f)) < 0)
+			return r;
+		journal_dirty(pdiskbno);
+		*pdiskbno = r;
+	}
 
-       return 0;
+	*blk = bc_lookup(*pdiskbno);
+	return 0;
+}
+
+// Give 'f' the blocks for [offset, offset + len) ahead of writes there,
+// taking those past its last block as one run, with one pass over the
+// bitmap, if there is a run that long.  The size doesn't change: blocks
+// past the end stay the file's until it is written there or truncated,
+// and are zeroed now so that a write or size change past them can't
+// show what they held before.  Only extent-mapped files take blocks
+// past their end; a file that runs out of extents gets the rest as it
+// is written.
+//
+// Returns 0 on success, -E_INVAL if the range is bad, -E_NO_DISK if the
+// disk is full.
+int
+file_allocate(struct File *f, off_t offset, off_t len)
+{
+	uint32_t i, nblocks, mapped, goal;
+	struct Extent *e;
+	int r;
+
+	if (offset < 0 || len <= 0 || len > MAXFILESIZE - offset)
+		return -E_INVAL;
+	nblocks = ROUNDUP(offset + len, BLKSIZE) / BLKSIZE;
+	if (f->f_flags & FILE_INLINE) {
+		if (offset + len <= NINLINE)
+			return 0;
+		if ((r = file_inline_out(f)) < 0)
+			return r;
+	}
+	if (!(f->f_flags & FILE_EXTENTS))
+		return 0;
+
+	mapped = 0;
+	for (i = 0; i < f->f_nextent; i++)
+		mapped += f->f_extent[i].e_len;
+	if (mapped >= nblocks)
+		return 0;
+
+	e = f->f_nextent > 0 ? &f->f_extent[f->f_nextent - 1] : NULL;
+	goal = e ? e->e_start + e->e_len : file_home(f);
+	if ((r = alloc_search_run(goal, f, nblocks - mapped)) >= 0 &&
+	    ((e && r == goal) || f->f_nextent < NEXTENT)) {
+		alloc_run_at(r, nblocks - mapped);
+		journal_dirty(f);
+		if (!e || r != goal) {
+			e = &f->f_extent[f->f_nextent++];
+			e->e_start = r;
+			e->e_len = 0;
+		}
+		e->e_len += nblocks - mapped;
+		pa_set(f, r + nblocks - mapped);
+		bc_zero(r, nblocks - mapped);
+		return 0;
+	}
+
+	// No run that long: a block at a time, in as few extents as the
+	// disk allows.  Once they run out, stop rather than convert f to
+	// block pointers, which would give back what this took; the rest
+	// come as the file is written.  Each step adds one block at the end
+	// of the last extent.
+	for (; mapped < nblocks; mapped++) {
+		if (f->f_nextent == NEXTENT) {
+			if (!extent_grow(f))
+				break;
+		} else if ((r = extent_append(f)) < 0)
+			return r;
+		e = &f->f_extent[f->f_nextent - 1];
+		bc_zero(e->e_start + e->e_len - 1, 1);
+	}
+	return 0;
+}
+
+// Directories that grow to this many blocks get a hash index.
+#define DIRINDEX_MINBLOCKS	4
+
+// Set *file to entry 'ent' of dir.
+static int
+dir_entry(struct File *dir, uint32_t ent, struct File **file)
+{
+	int r;
+	char *blk;
+
+	if (ent >= dir->f_size / BLKSIZE * BLKFILES)
+		return -E_INVAL;
+	if ((r = file_get_block(dir, ent / BLKFILES, &blk)) < 0)
+		return r;
+	*file = (struct File *) blk + ent % BLKFILES;
+	return 0;
+}
+
+// Return dir's index, or NULL if it has none (or a bad one).
+static struct DirIndex *
+dir_index(struct File *dir)
+{
+	struct DirIndex *di;
+
+	if (!(dir->f_flags & FILE_DIRINDEX))
+		return NULL;
+	if (dir->f_index < 2 || dir->f_index >= super->s_nblocks)
+		return NULL;
+	di = diskaddr(dir->f_index);
+	if (di->di_magic != DIRINDEX_MAGIC || di->di_nslots < DIRSLOTS ||
+	    (di->di_nslots & (di->di_nslots - 1)) != 0 ||
+	    di->di_nslots / DIRSLOTS > DIRINDEX_MAXBLOCKS ||
+	    di->di_nentries >= di->di_nslots)
+		return NULL;
+	return di;
+}
+
+// Slot 'i' of the table in 'blocks'.
+static struct DirSlot *
+dir_slot(const uint32_t *blocks, uint32_t i)
+{
+	return (struct DirSlot *) diskaddr(blocks[i / DIRSLOTS]) + i % DIRSLOTS;
+}
+
+// Record in the 'nslots'-slot table in 'blocks' that entry 'ent' holds
+// a name hashing to 'h', journaling the change if 'log' is set.  The
+// table must have an empty slot.
+static void
+dir_slot_insert(const uint32_t *blocks, uint32_t nslots, uint32_t h,
+		uint32_t ent, bool log)
+{
+	struct DirSlot *ds;
+	uint32_t i;
+
+	for (i = h & (nslots - 1); ; i = (i + 1) & (nslots - 1)) {
+		ds = dir_slot(blocks, i);
+		if (ds->ds_ent == 0)
+			break;
+	}
+	if (log)
+		journal_dirty(ds);
+	ds->ds_hash = h;
+	ds->ds_ent = ent + 1;
+}
+
+// Look 'name' up in dir's index.  Only the slots with its hash are
+// followed, to at most one directory block each.
+static int
+dir_index_find(struct File *dir, struct DirIndex *di, const char *name,
+	       struct File **file)
+{
+	struct DirSlot *ds;
+	struct File *f;
+	uint32_t h, i, n;
+	int r;
+
+	h = dir_hash(name);
+	i = h & (di->di_nslots - 1);
+	for (n = 0; n < di->di_nslots; n++, i = (i + 1) & (di->di_nslots - 1)) {
+		ds = dir_slot(di->di_blocks, i);
+		if (ds->ds_ent == 0)
+			return -E_NOT_FOUND;
+		if (ds->ds_hash != h)
+			continue;
+		if ((r = dir_entry(dir, ds->ds_ent - 1, &f)) < 0)
+			return r;
+		if (strcmp(f->f_name, name) == 0) {
+			*file = f;
+			return 0;
+		}
+	}
+	return -E_NOT_FOUND;
+}
+
+// Free dir's index and go back to searching it in full.
+static void
+dir_index_drop(struct File *dir)
+{
+	struct DirIndex *di;
+	uint32_t i;
+
+	journal_dirty(dir);
+	if ((di = dir_index(dir)) != NULL) {
+		for (i = 0; i < di->di_nslots / DIRSLOTS; i++)
+			free_block(di->di_blocks[i]);
+		free_block(dir->f_index);
+	}
+	dir->f_flags &= ~FILE_DIRINDEX;
+	dir->f_index = 0;
+}
+
+// (Re)build dir's index with room for its entries to double.  The new
+// table is filled in before the index points at it, so it needn't go
+// through the journal; journal_commit writes it out before the header.
+//
+// Returns 0 on success, -E_NO_DISK if there isn't room, in which case
+// any old index is left alone.
+static int
+dir_index_build(struct File *dir)
+{
+	static uint32_t blocks[DIRINDEX_MAXBLOCKS];
+	struct DirIndex *di;
+	struct File *f;
+	uint32_t nent, n, nslots, nfree, ntab, i;
+	int r;
+
+	// Count the entries in use and find the first free one.
+	nent = dir->f_size / BLKSIZE * BLKFILES;
+	nfree = nent;
+	for (i = n = 0; i < nent; i++) {
+		if ((r = dir_entry(dir, i, &f)) < 0)
+			return r;
+		if (f->f_name[0] != '\0')
+			n++;
+		else if (nfree == nent)
+			nfree = i;
+	}
+
+	for (nslots = DIRSLOTS; nslots < 3 * (n + 1); nslots *= 2)
+		;
+	ntab = nslots / DIRSLOTS;
+	di = dir_index(dir);
+	if (ntab > DIRINDEX_MAXBLOCKS || super->s_nfree < ntab + !di)
+		return -E_NO_DISK;
+
+	// Fill in the new table.
+	for (i = 0; i < ntab; i++) {
+		if ((r = alloc_block()) < 0)
+			panic("dir_index_build: %e", r);
+		blocks[i] = r;
+		memset(diskaddr(r), 0, BLKSIZE);
+	}
+	for (i = 0; i < nent; i++) {
+		if ((r = dir_entry(dir, i, &f)) < 0)
+			panic("dir_index_build: %e", r);
+		if (f->f_name[0] != '\0')
+			dir_slot_insert(blocks, nslots, dir_hash(f->f_name), i, 0);
+	}
+
+	// Then point the header at it, reusing the header if there is one.
+	if (di) {
+		journal_dirty(di);
+		for (i = 0; i < di->di_nslots / DIRSLOTS; i++)
+			free_block(di->di_blocks[i]);
+	} else {
+		if ((r = alloc_block()) < 0)
+			panic("dir_index_build: %e", r);
+		di = diskaddr(r);
+		journal_dirty(di);
+		journal_dirty(dir);
+		dir->f_index = r;
+		dir->f_flags |= FILE_DIRINDEX;
+	}
+	memset(di, 0, BLKSIZE);
+	di->di_magic = DIRINDEX_MAGIC;
+	di->di_nslots = nslots;
+	di->di_nentries = n;
+	di->di_free = nfree;
+	memmove(di->di_blocks, blocks, ntab * sizeof(blocks[0]));
+	return 0;
+}
+
+// Entry 'ent' of dir has just been given a name: index it.  Builds an
+// index once dir reaches DIRINDEX_MINBLOCKS blocks, and a bigger one
+// when the table is half full.
+static void
+dir_index_add(struct File *dir, uint32_t ent)
+{
+	struct DirIndex *di;
+	struct File *f;
+
+	di = dir_index(dir);
+	if (!di && (dir->f_flags & FILE_DIRINDEX))
+		dir_index_drop(dir);
+
+	if ((!di && dir->f_size / BLKSIZE >= DIRINDEX_MINBLOCKS) ||
+	    (di && 2 * (di->di_nentries + 1) > di->di_nslots)) {
+		if (dir_index_build(dir) == 0)
+			return;
+		// Out of disk: keep the old table while it has room.
+		if (di && di->di_nentries + 2 > di->di_nslots)
+			dir_index_drop(dir);
+	}
+
+	if ((di = dir_index(dir)) == NULL || dir_entry(dir, ent, &f) < 0)
+		return;
+	dir_slot_insert(di->di_blocks, di->di_nslots, dir_hash(f->f_name),
+			ent, 1);
+	journal_dirty(di);
+	di->di_nentries++;
+	di->di_free = ent + 1;
 }
 
 // Try to find a file named "name" in dir.  If so, set *file to it.
+// Uses dir's index if it has one.
 //
 // Returns 0 and sets *file on success, < 0 on error.  Errors are:
 //	-E_NOT_FOUND if the file is not found
@@ -220,6 +991,10 @@ dir_lookup(struct File *dir, const char *name, struct File **file)
 	uint32_t i, j, nblock;
 	char *blk;
 	struct File *f;
+	struct DirIndex *di;
+
+	if ((di = dir_index(dir)) != NULL)
+		return dir_index_find(dir, di, name, file);
 
 	// Search dir for name.
 	// We maintain the invariant that the size of a directory-file
@@ -239,36 +1014,149 @@ dir_lookup(struct File *dir, const char *name, struct File **file)
 	return -E_NOT_FOUND;
 }
 
-// Set *file to point at a free File structure in dir.  The caller is
-// responsible for filling in the File fields.
+// Set *file to point at a free File structure in dir, and *ent to its
+// entry number.  An indexed directory is searched from di_free on.
+// The caller is responsible for filling in the File fields, then
+// calling dir_index_add.
 static int
-dir_alloc_file(struct File *dir, struct File **file)
+dir_alloc_file(struct File *dir, struct File **file, uint32_t *ent)
 {
 	int r;
-	uint32_t nblock, i, j;
+	uint32_t nblock, i, j, start;
 	char *blk;
 	struct File *f;
+	struct DirIndex *di;
 
 	assert((dir->f_size % BLKSIZE) == 0);
 	nblock = dir->f_size / BLKSIZE;
-	for (i = 0; i < nblock; i++) {
+	start = (di = dir_index(dir)) != NULL ?
+		MIN(di->di_free, nblock * BLKFILES) : 0;
+	for (i = start / BLKFILES; i < nblock; i++) {
 		if ((r = file_get_block(dir, i, &blk)) < 0)
 			return r;
 		f = (struct File*) blk;
 		for (j = 0; j < BLKFILES; j++)
-			if (f[j].f_name[0] == '\0') {
+			if (f[j].f_name[0] == '\0' && i * BLKFILES + j >= start) {
 				*file = &f[j];
+				*ent = i * BLKFILES + j;
 				return 0;
 			}
 	}
-	dir->f_size += BLKSIZE;
+	// Map the block before the size takes it in, so that no state
+	// has a directory block missing.
 	if ((r = file_get_block(dir, i, &blk)) < 0)
 		return r;
+	journal_dirty(dir);
+	dir->f_size += BLKSIZE;
+	// Whatever the block held before isn't a list of files.
+	journal_dirty(blk);
+	memset(blk, 0, BLKSIZE);
 	f = (struct File*) blk;
 	*file = &f[0];
+	*ent = i * BLKFILES;
 	return 0;
 }
 
+// --------------------------------------------------------------
+// Path lookup cache
+// --------------------------------------------------------------
+
+// walk_path looks each path element up in the cache before it searches
+// the directory.  An entry maps (directory, name) to the File, or to
+// NULL if the name isn't there, so that repeated misses (PATH-style
+// searches, O_CREAT probes) are cheap too.  Files live at fixed places
+// in the block cache's address range, so an entry stays right until the
+// directory changes; file_create replaces the entry for the new name.
+// The cache is direct-mapped: a collision just replaces the old entry.
+
+#define DCACHE_SIZE	256		// a power of 2
+
+struct Dentry {
+	struct File *dc_dir;		// NULL if the slot is unused
+	struct File *dc_file;		// NULL if the name isn't in dc_dir
+	uint32_t dc_hash;
+	char dc_name[MAXNAMELEN];
+};
+
+static struct Dentry dcache[DCACHE_SIZE];
+static bool dcache_off;
+static uint32_t dc_hits, dc_negative, dc_misses;
+
+static struct Dentry *
+dcache_slot(struct File *dir, uint32_t h)
+{
+	return &dcache[(h ^ ((uint32_t) dir >> 8)) & (DCACHE_SIZE - 1)];
+}
+
+// Remember that 'name' in dir is f, or isn't there if f is NULL.
+static void
+dcache_enter(struct File *dir, const char *name, struct File *f)
+{
+	uint32_t h = dir_hash(name);
+	struct Dentry *d = dcache_slot(dir, h);
+
+	if (dcache_off)
+		return;
+	d->dc_dir = dir;
+	d->dc_file = f;
+	d->dc_hash = h;
+	strcpy(d->dc_name, name);
+}
+
+// dir_lookup, answered from the cache when it can be.
+static int
+dcache_lookup(struct File *dir, const char *name, struct File **file)
+{
+	uint32_t h;
+	struct Dentry *d;
+	int r;
+
+	if (dcache_off)
+		return dir_lookup(dir, name, file);
+
+	h = dir_hash(name);
+	d = dcache_slot(dir, h);
+	if (d->dc_dir == dir && d->dc_hash == h &&
+	    strcmp(d->dc_name, name) == 0) {
+		dc_hits++;
+		if (d->dc_file == NULL) {
+			dc_negative++;
+			return -E_NOT_FOUND;
+		}
+		*file = d->dc_file;
+		return 0;
+	}
+
+	dc_misses++;
+	r = dir_lookup(dir, name, file);
+	if (r == 0)
+		dcache_enter(dir, name, *file);
+	else if (r == -E_NOT_FOUND)
+		dcache_enter(dir, name, NULL);
+	return r;
+}
+
+// Turn the cache on or off (DCACHE_*).  Turning it off empties it.
+int
+dcache_set(int setting)
+{
+	if (setting != DCACHE_ON && setting != DCACHE_OFF)
+		return -E_INVAL;
+	dcache_off = (setting == DCACHE_OFF);
+	if (dcache_off)
+		memset(dcache, 0, sizeof(dcache));
+	return 0;
+}
+
+// Report the cache's counters.
+void
+dcache_stats(struct Fsret_stats *ret)
+{
+	ret->ret_dc_hits = dc_hits;
+	ret->ret_dc_negative = dc_negative;
+	ret->ret_dc_misses = dc_misses;
+}
+
 // Skip over slashes.
 static const char*
 skip_slash(const char *p)
@@ -316,7 +1204,7 @@ walk_path(const char *path, struct File **pdir, struct File **pf, char *lastelem
 		if (dir->f_type != FTYPE_DIR)
 			return -E_NOT_FOUND;
 
-		if ((r = dir_lookup(dir, name, &f)) < 0) {
+		if ((r = dcache_lookup(dir, name, &f)) < 0) {
 			if (r == -E_NOT_FOUND && *path == '\0') {
 				if (pdir)
 					*pdir = dir;
@@ -345,18 +1233,24 @@ file_create(const char *path, struct File **pf)
 {
 	char name[MAXNAMELEN];
 	int r;
+	uint32_t ent;
 	struct File *dir, *f;
 
 	if ((r = walk_path(path, &dir, &f, name)) == 0)
 		return -E_FILE_EXISTS;
 	if (r != -E_NOT_FOUND || dir == 0)
 		return r;
-	if ((r = dir_alloc_file(dir, &f)) < 0)
+	if ((r = dir_alloc_file(dir, &f, &ent)) < 0)
 		return r;
 
+	journal_dirty(f);
+	memset(f, 0, sizeof(*f));
 	strcpy(f->f_name, name);
+	f->f_flags = FILE_EXTENTS;
+	pa_drop(f);
+	dir_index_add(dir, ent);
+	dcache_enter(dir, name, f);
 	*pf = f;
-	file_flush(dir);
 	return 0;
 }
 
@@ -377,16 +1271,31 @@ file_read(struct File *f, void *buf, size_t count, off_t offset)
 	int r, bn;
 	off_t pos;
 	char *blk;
+	uint32_t diskbno, n;
 
 	if (offset >= f->f_size)
 		return 0;
 
 	count = MIN(count, f->f_size - offset);
+	if (f->f_flags & FILE_INLINE) {
+		memmove(buf, f->f_data + offset, count);
+		return count;
+	}
 
+	// Copy a run of consecutive disk blocks at a time; their cache
+	// pages are consecutive too, and bc_read fills them with as few
+	// disk reads as possible.
 	for (pos = offset; pos < offset + count; ) {
-		if ((r = file_get_block(f, pos / BLKSIZE, &blk)) < 0)
-			return r;
-		bn = MIN(BLKSIZE - pos % BLKSIZE, offset + count - pos);
+		if ((n = file_block_run(f, pos / BLKSIZE, &diskbno)) > 0) {
+			n = MIN(n, (offset + count - 1) / BLKSIZE - pos / BLKSIZE + 1);
+			bc_read(diskbno, n);
+			blk = diskaddr(diskbno);
+		} else {
+			if ((r = file_get_block(f, pos / BLKSIZE, &blk)) < 0)
+				return r;
+			n = 1;
+		}
+		bn = MIN(n * BLKSIZE - pos % BLKSIZE, offset + count - pos);
 		memmove(buf, blk + pos % BLKSIZE, bn);
 		pos += bn;
 		buf += bn;
@@ -395,6 +1304,103 @@ file_read(struct File *f, void *buf, size_t count, off_t offset)
 	return count;
 }
 
+// Map the block of f at 'offset', which must be block-aligned, at
+// 'dstva', read-only, to send to a client.  That is the cache page
+// itself, made ready to share (bc_share), or else a fresh page holding
+// a copy: of a block the journal keeps dirty, or of an inline file's
+// data, which stays where it is.  Returns
+// how many of the page's bytes are in the file: 0 at the end of the
+// file, with nothing mapped, else at most BLKSIZE.
+int
+file_read_map(struct File *f, off_t offset, void *dstva)
+{
+	uint32_t diskbno;
+	char *blk;
+	int r;
+
+	if (offset < 0 || offset % BLKSIZE != 0)
+		return -E_INVAL;
+	if (offset >= f->f_size)
+		return 0;
+
+	if (f->f_flags & FILE_INLINE) {
+		if ((r = sys_page_alloc(0, dstva, PTE_P | PTE_U | PTE_W)) < 0)
+			return r;
+		memmove(dstva, f->f_data, f->f_size);
+		return f->f_size;
+	}
+
+	if (file_block_run(f, offset / BLKSIZE, &diskbno) > 0) {
+		bc_read(diskbno, 1);
+		blk = diskaddr(diskbno);
+	} else if ((r = file_get_block(f, offset / BLKSIZE, &blk)) < 0)
+		return r;
+	if (bc_share(((uint32_t) blk - DISKMAP) / BLKSIZE)) {
+		if ((r = sys_page_map(0, blk, 0, dstva, PTE_P | PTE_U)) < 0)
+			return r;
+	} else {
+		if ((r = sys_page_alloc(0, dstva, PTE_P | PTE_U | PTE_W)) < 0)
+			return r;
+		memmove(dstva, blk, BLKSIZE);
+	}
+	return MIN(BLKSIZE, f->f_size - offset);
+}
+
+// Read-ahead window bounds, in blocks.  The largest is what one
+// disk command can transfer.
+#define RA_MINWINDOW	4
+#define RA_MAXWINDOW	BC_MAXRUN
+
+// Read ahead of a read of 'count' bytes at 'offset' in f, if the reads
+// of this open file look sequential.  A read starting where the last
+// one ended doubles the window, up to RA_MAXWINDOW; any other read
+// turns read-ahead off.  When the read's first block isn't cached, the
+// window's blocks from there on are brought in with as few disk reads
+// as their layout allows, so a sequential reader touches the disk once
+// per window rather than once per block.
+void
+file_readahead(struct File *f, struct Readahead *ra, off_t offset, size_t count)
+{
+	uint32_t bno, end, n, diskbno;
+
+	if (offset == ra->ra_next)
+		ra->ra_window = MIN(MAX(ra->ra_window * 2, RA_MINWINDOW),
+				    RA_MAXWINDOW);
+	else
+		ra->ra_window = 0;
+	ra->ra_next = offset + count;
+
+	if (ra->ra_window == 0 || offset >= f->f_size)
+		return;
+
+	bno = offset / BLKSIZE;
+	if (file_block_run(f, bno, &diskbno) > 0 &&
+	    va_is_mapped(diskaddr(diskbno)))
+		return;
+
+	end = MIN(bno + ra->ra_window, (f->f_size + BLKSIZE - 1) / BLKSIZE);
+	for (; bno < end; bno += n) {
+		if ((n = file_block_run(f, bno, &diskbno)) == 0) {
+			n = 1;
+			continue;
+		}
+		n = MIN(n, end - bno);
+		bc_prefetch(diskbno, n);
+	}
+}
+
+// Queue a read of the block of f holding 'offset', if it isn't cached,
+// so that a later read of it doesn't wait for the disk.
+void
+file_prefetch(struct File *f, off_t offset)
+{
+	uint32_t diskbno;
+
+	if (offset < 0 || offset >= f->f_size)
+		return;
+	if (file_block_run(f, offset / BLKSIZE, &diskbno) > 0)
+		bc_prefetch(diskbno, 1);
+}
 
 // Write count bytes from buf into f, starting at seek position
 // offset.  This is meant to mimic the standard pwrite function.
@@ -411,6 +1417,11 @@ file_write(struct File *f, const void *buf, size_t count, off_t offset)
 	if (offset + count > f->f_size)
 		if ((r = file_set_size(f, offset + count)) < 0)
 			return r;
+	if (f->f_flags & FILE_INLINE) {
+		journal_dirty(f);
+		memmove(f->f_data + offset, buf, count);
+		return count;
+	}
 
 	for (pos = offset; pos < offset + count; ) {
 		if ((r = file_get_block(f, pos / BLKSIZE, &blk)) < 0)
@@ -425,88 +1436,206 @@ file_write(struct File *f, const void *buf, size_t count, off_t offset)
 }
 
 // Remove a block from file f.  If it's not there, just silently succeed.
+// Clear the pointer to it only if 'clear'; the caller leaves it when
+// it frees the indirect block that holds it too.
 // Returns 0 on success, < 0 on error.
 static int
-file_free_block(struct File *f, uint32_t filebno)
+file_free_block(struct File *f, uint32_t filebno, bool clear)
 {
 	int r;
 	uint32_t *ptr;
 
-	if ((r = file_block_walk(f, filebno, &ptr, 0)) < 0)
+	if ((r = file_block_walk(f, filebno, &ptr, 0)) == -E_NOT_FOUND)
+		return 0;
+	if (r < 0)
 		return r;
 	if (*ptr) {
+		if (clear)
+			journal_dirty(ptr);
 		free_block(*ptr);
-		*ptr = 0;
+		if (clear)
+			*ptr = 0;
 	}
 	return 0;
 }
 
+// Free the blocks of extent-mapped file 'f' past its first 'nblocks'.
+static void
+extent_truncate(struct File *f, uint32_t nblocks)
+{
+	uint32_t i, b, keep, base, n;
+	struct Extent *e;
+
+	journal_dirty(f);
+	base = n = 0;
+	for (i = 0; i < f->f_nextent; i++) {
+		e = &f->f_extent[i];
+		keep = nblocks > base ? MIN(nblocks - base, e->e_len) : 0;
+		base += e->e_len;
+		for (b = keep; b < e->e_len; b++)
+			free_block(e->e_start + b);
+		e->e_len = keep;
+		if (keep == 0)
+			e->e_start = 0;
+		else
+			n = i + 1;
+	}
+	f->f_nextent = n;
+}
+
 // Remove any blocks currently used by file 'f',
 // but not necessary for a file of size 'newsize'.
 // For both the old and new sizes, figure out the number of blocks required,
 // and then clear the blocks from new_nblocks to old_nblocks.
-// If the new_nblocks is no more than NDIRECT, and the indirect block has
-// been allocated (f->f_indirect != 0), then free the indirect block too.
-// (Remember to clear the f->f_indirect pointer so you'll know
-// whether it's valid!)
+// Then free the indirect blocks that no longer map anything, clearing
+// their pointers so you'll know whether they're valid.
+// A file truncated to nothing goes back to using extents.
 // Do not change f->f_size.
 static void
 file_truncate_blocks(struct File *f, off_t newsize)
 {
 	int r;
-	uint32_t bno, old_nblocks, new_nblocks;
+	uint32_t bno, first, i, old_nblocks, new_nblocks, *dind;
 
 	old_nblocks = (f->f_size + BLKSIZE - 1) / BLKSIZE;
 	new_nblocks = (newsize + BLKSIZE - 1) / BLKSIZE;
-	for (bno = new_nblocks; bno < old_nblocks; bno++)
-		if ((r = file_free_block(f, bno)) < 0)
+
+	pa_drop(f);
+	if (f->f_flags & FILE_EXTENTS) {
+		extent_truncate(f, new_nblocks);
+		return;
+	}
+
+	// An indirect block that maps nothing below new_nblocks goes too,
+	// so its pointers aren't cleared; that keeps the journal to a few
+	// blocks however big the file was.
+	for (bno = new_nblocks; bno < old_nblocks; bno++) {
+		first = bno < NDIRECT + NINDIRECT ? NDIRECT :
+			bno - (bno - NDIRECT - NINDIRECT) % NINDIRECT;
+		r = file_free_block(f, bno, bno < NDIRECT || first < new_nblocks);
+		if (r < 0)
 			cprintf("warning: file_free_block: %e", r);
+	}
 
 	if (new_nblocks <= NDIRECT && f->f_indirect) {
+		journal_dirty(f);
 		free_block(f->f_indirect);
 		f->f_indirect = 0;
 	}
+	if (f->f_dindirect) {
+		dind = (uint32_t *) diskaddr(f->f_dindirect);
+		for (i = 0; i < NINDIRECT; i++) {
+			bno = NDIRECT + NINDIRECT + i * NINDIRECT;
+			if (dind[i] && bno >= new_nblocks) {
+				journal_dirty(dind);
+				free_block(dind[i]);
+				dind[i] = 0;
+			}
+		}
+		if (new_nblocks <= NDIRECT + NINDIRECT) {
+			journal_dirty(f);
+			free_block(f->f_dindirect);
+			f->f_dindirect = 0;
+		}
+	}
+
+	if (new_nblocks == 0) {
+		journal_dirty(f);
+		f->f_flags |= FILE_EXTENTS;
+	}
+}
+
+// Move the first 'newsize' bytes of regular file 'f', which must be at
+// most NINLINE, into f_data and free its blocks.  f_data past the data
+// is zero, so growing an inline file needs no clearing.
+// Returns 0 on success, < 0 on error.
+static int
+file_inline_in(struct File *f, off_t newsize)
+{
+	uint8_t data[NINLINE];
+	ssize_t n;
+
+	memset(data, 0, sizeof(data));
+	if ((n = file_read(f, data, newsize, 0)) < 0)
+		return n;
+	file_truncate_blocks(f, 0);
+	journal_dirty(f);
+	memmove(f->f_data, data, sizeof(data));
+	f->f_flags = FILE_INLINE;
+	return 0;
 }
 
 // Set the size of file f, truncating or extending as necessary.
+// Regular files of at most NINLINE bytes keep their data inline: those
+// that shrink to it, and those that grow to it from no blocks (a file
+// with blocks fallocate reserved keeps them).
 int
 file_set_size(struct File *f, off_t newsize)
 {
-	if (f->f_size > newsize)
+	int r;
+
+	if (newsize < 0 || newsize > MAXFILESIZE)
+		return -E_INVAL;
+	if (f->f_flags & FILE_INLINE) {
+		if (newsize > NINLINE && (r = file_inline_out(f)) < 0)
+			return r;
+	} else if (f->f_type == FTYPE_REG && newsize <= NINLINE &&
+		   (f->f_size >= newsize || !(f->f_flags & FILE_EXTENTS) ||
+		    f->f_nextent == 0)) {
+		if ((r = file_inline_in(f, newsize)) < 0)
+			return r;
+	}
+	if (f->f_flags & FILE_INLINE) {
+		journal_dirty(f);
+		if (newsize < f->f_size)
+			memset(f->f_data + newsize, 0, f->f_size - newsize);
+		f->f_size = newsize;
+		return 0;
+	}
+	// Not growing: also free any blocks file_allocate left past the
+	// end.
+	if (f->f_size >= newsize)
 		file_truncate_blocks(f, newsize);
+	journal_dirty(f);
 	f->f_size = newsize;
-	flush_block(f);
 	return 0;
 }
 
 // Flush the contents and metadata of file f out to disk.
-// Loop over all the blocks in file.
-// Translate the file block number into a disk block number
-// and then check whether that disk block is dirty.  If so, write it out.
+// Loop over all the blocks in file, a run of consecutive disk blocks
+// at a time, and write out the ones that are dirty.  Then commit the
+// journal, which holds the file's metadata.  Clients flush on close,
+// so f's window for appends goes too.
 void
 file_flush(struct File *f)
 {
-	int i;
-	uint32_t *pdiskbno;
+	uint32_t i, n, diskbno, nblocks;
 
-	for (i = 0; i < (f->f_size + BLKSIZE - 1) / BLKSIZE; i++) {
-		if (file_block_walk(f, i, &pdiskbno, 0) < 0 ||
-		    pdiskbno == NULL || *pdiskbno == 0)
+	pa_drop(f);
+	nblocks = (f->f_size + BLKSIZE - 1) / BLKSIZE;
+	for (i = 0; i < nblocks; i += n) {
+		if ((n = file_block_run(f, i, &diskbno)) == 0) {
+			n = 1;
 			continue;
-		flush_block(diskaddr(*pdiskbno));
+		}
+		bc_flush(diskbno, MIN(n, nblocks - i));
 	}
-	flush_block(f);
-	if (f->f_indirect)
-		flush_block(diskaddr(f->f_indirect));
+	journal_commit();
 }
 
 
-// Sync the entire file system.  A big hammer.
+// Sync the entire file system.  A big hammer, but it only touches
+// the dirty blocks.  Returns once they are on disk, in their homes
+// rather than just in the journal.
 void
 fs_sync(void)
 {
-	int i;
-	for (i = 1; i < super->s_nblocks; i++)
-		flush_block(diskaddr(i));
+	int r;
+
+	journal_commit();
+	journal_checkpoint();
+	bc_writeback();
+	if ((r = bio_sync()) < 0)
+		panic("fs_sync: %e", r);
 }
 
@@ -8,41 +8,156 @@
  * server's address space at DISKMAP + (n*BLKSIZE). */
 #define DISKMAP		0x10000000
 
+/* The pages the disk drivers hand the device (fs/ide.c, fs/virtio.c)
+ * lie between DRIVERVA and DISKMAP; nothing else may map there. */
+#define DRIVERVA	0x0ffe0000
+
 /* Maximum disk size we can handle (3GB) */
 #define DISKSIZE	0xC0000000
 
+/* Blocks the block cache holds before it starts evicting, not counting
+ * the superblock and bitmap.  FSREQ_STATS can change it at run time,
+ * within [BC_MINCAPACITY, BC_MAXCAPACITY]. */
+#ifndef BC_CAPACITY
+#define BC_CAPACITY	1024
+#endif
+
+/* Most blocks one disk command transfers (no more than BC_MINCAPACITY) */
+#define BC_MAXRUN	(256 / BLKSECTS)
+
+/* How often the file server writes back dirty blocks, in milliseconds.
+ * It checks after each request. */
+#define BC_WRITEBACK_MS	1000
+
 struct Super *super;		// superblock
 uint32_t *bitmap;		// bitmap blocks mapped in memory
 
+/* lock.c */
+struct Lock {
+	volatile uint32_t l_locked;
+};
+
+void	lock_acquire(struct Lock *l);
+void	lock_release(struct Lock *l);
+void	fs_lock(void);
+void	fs_unlock(void);
+void	fs_yield(void);
+void	fs_begin(bool exclusive);
+void	fs_end(bool exclusive);
+bool	fs_shared(void);
+
+/* pci.c */
+struct PciFunc {
+	uint32_t pf_bus, pf_dev, pf_func;
+	uint32_t pf_id;			// device ID << 16 | vendor ID
+	uint32_t pf_class;		// class, subclass, prog IF, revision
+	uint32_t pf_bar[6];		// base address registers
+	uint32_t pf_irq;		// interrupt line
+};
+
+#define PCI_CLASS_STORAGE	0x01
+#define PCI_SUBCLASS_IDE	0x01
+
+#define PCI_COMMAND_IO		0x1
+#define PCI_COMMAND_MEM		0x2
+#define PCI_COMMAND_MASTER	0x4
+
+uint32_t pci_conf_read(struct PciFunc *f, uint32_t off);
+void	pci_conf_write(struct PciFunc *f, uint32_t off, uint32_t v);
+void	pci_enable(struct PciFunc *f, uint32_t flags);
+int	pci_find_class(uint8_t class, uint8_t subclass, struct PciFunc *f);
+int	pci_find_device(uint16_t vendor, uint16_t device, struct PciFunc *f);
+
+/* disk.c */
+void	disk_init(void);
+int	disk_read(uint32_t secno, void *dst, size_t nsecs);
+int	disk_write(uint32_t secno, const void *src, size_t nsecs);
+int	disk_sync(void);
+int	disk_sync_range(uint32_t secno, size_t nsecs);
+
+/* bio.c */
+uint32_t bio_read(uint32_t blockno, uint32_t nblocks);
+void	bio_write(uint32_t blockno, uint32_t nblocks);
+bool	bio_pending(uint32_t blockno);
+bool	bio_cancel(uint32_t blockno);
+int	bio_wait(uint32_t blockno);
+void	bio_step(void);
+void	bio_run(void);
+int	bio_sync(void);
+int	bio_set_sched(int sched);
+void	bio_stats(struct Fsret_stats *ret);
+
 /* ide.c */
 bool	ide_probe_disk1(void);
 void	ide_set_disk(int diskno);
+void	ide_dma_init(void);
 void	ide_set_partition(uint32_t first_sect, uint32_t nsect);
 int	ide_read(uint32_t secno, void *dst, size_t nsecs);
 int	ide_write(uint32_t secno, const void *src, size_t nsecs);
+int	ide_sync(void);
+int	ide_sync_range(uint32_t secno, size_t nsecs);
+
+/* virtio.c */
+int	virtio_blk_init(void);
+int	virtio_blk_read(uint32_t secno, void *dst, size_t nsecs);
+int	virtio_blk_write(uint32_t secno, const void *src, size_t nsecs);
+int	virtio_blk_sync(void);
+int	virtio_blk_sync_range(uint32_t secno, size_t nsecs);
 
 /* bc.c */
 void*	diskaddr(uint32_t blockno);
 bool	va_is_mapped(void *va);
 bool	va_is_dirty(void *va);
 void	flush_block(void *addr);
+void	bc_flush(uint32_t blockno, uint32_t nblocks);
+void	bc_writeback(void);
+void	bc_read(uint32_t blockno, uint32_t nblocks);
+void	bc_prefetch(uint32_t blockno, uint32_t nblocks);
+void	bc_zero(uint32_t blockno, uint32_t nblocks);
+void*	bc_lookup(uint32_t blockno);
+bool	bc_share(uint32_t blockno);
+int	bc_set_capacity(uint32_t capacity);
+void	bc_stats(struct Fsret_stats *ret);
 void	bc_init(void);
 
+/* journal.c */
+void	journal_init(void);
+void	journal_dirty(void *va);
+void	journal_commit(void);
+void	journal_checkpoint(void);
+bool	journal_full(void);
+bool	journal_running(uint32_t blockno);
+bool	journal_holds(uint32_t blockno);
+
+/* Read-ahead state for an open file (see file_readahead). */
+struct Readahead {
+	off_t ra_next;		// offset just past the last read
+	uint32_t ra_window;	// blocks to read ahead, 0 if not sequential
+};
+
 /* fs.c */
 void	fs_init(void);
 int	file_get_block(struct File *f, uint32_t file_blockno, char **pblk);
 int	file_create(const char *path, struct File **f);
 int	file_open(const char *path, struct File **f);
 ssize_t	file_read(struct File *f, void *buf, size_t count, off_t offset);
+int	file_read_map(struct File *f, off_t offset, void *dstva);
+void	file_readahead(struct File *f, struct Readahead *ra, off_t offset, size_t count);
+void	file_prefetch(struct File *f, off_t offset);
 int	file_write(struct File *f, const void *buf, size_t count, off_t offset);
 int	file_set_size(struct File *f, off_t newsize);
+int	file_allocate(struct File *f, off_t offset, off_t len);
 void	file_flush(struct File *f);
 int	file_remove(const char *path);
 void	fs_sync(void);
+int	dcache_set(int setting);
+void	dcache_stats(struct Fsret_stats *ret);
 
 /* int	map_block(uint32_t); */
 bool	block_is_free(uint32_t blockno);
 int	alloc_block(void);
+int	alloc_block_near(uint32_t goal, struct File *f);
+int	alloc_block_at(uint32_t blockno);
 
 /* test.c */
 void	fs_test(void);
@@ -0,0 +1,431 @@
+/*
+ * JOS file system checker
+ *
+ * Checks an image the way fs_init would find it after a crash: the
+ * journal is replayed first (in memory; the image isn't changed), then
+ * every file is walked and the blocks it uses are checked against the
+ * bitmap.  Exits 1 if the file system is inconsistent.
+ */
+
+// We don't actually want to define off_t!
+#define off_t xxx_off_t
+#define bool xxx_bool
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#undef off_t
+#undef bool
+
+// Prevent inc/types.h, included from inc/fs.h,
+// from attempting to redefine types defined in the host's inttypes.h.
+#define JOS_INC_TYPES_H
+// Typedef the types that inc/mmu.h needs.
+typedef uint32_t physaddr_t;
+typedef uint32_t off_t;
+typedef int bool;
+
+#include <inc/mmu.h>
+#include <inc/fs.h>
+
+#define MAXDEPTH 32
+#define JN_MAXLOG 256		// journal blocks fs/journal.c uses, at most
+
+uint32_t nblocks;
+char *disk;
+struct Super *super;
+uint32_t *bitmap;
+char *used;			// blocks found in use
+int nerrors, nwarnings;
+uint32_t nfiles;
+
+void
+error(const char *fmt, ...)
+{
+	va_list ap;
+
+	va_start(ap, fmt);
+	fprintf(stderr, "fsck: ");
+	vfprintf(stderr, fmt, ap);
+	va_end(ap);
+	fputc('\n', stderr);
+	nerrors++;
+}
+
+void
+warn(const char *fmt, ...)
+{
+	va_list ap;
+
+	va_start(ap, fmt);
+	fprintf(stderr, "fsck: warning: ");
+	vfprintf(stderr, fmt, ap);
+	va_end(ap);
+	fputc('\n', stderr);
+	nwarnings++;
+}
+
+void *
+block(uint32_t blockno)
+{
+	return disk + (size_t) blockno * BLKSIZE;
+}
+
+bool
+block_is_free(uint32_t blockno)
+{
+	return (bitmap[blockno / 32] & (1 << (blockno % 32))) != 0;
+}
+
+// Note that 'path' uses block 'blockno' for 'what'.  Returns whether the
+// block number is in range, so the caller can look inside it.
+bool
+use(uint32_t blockno, const char *path, const char *what)
+{
+	if (blockno == 0 || blockno >= nblocks) {
+		error("%s: %s block %u out of range", path, what, blockno);
+		return 0;
+	}
+	if (used[blockno])
+		error("%s: %s block %u is used twice", path, what, blockno);
+	else if (block_is_free(blockno))
+		error("%s: %s block %u is marked free", path, what, blockno);
+	used[blockno] = 1;
+	return 1;
+}
+
+// Replay the journal the way fs/journal.c does.
+void
+replay(void)
+{
+	struct JournalHeader *jh;
+	struct JournalDesc *jd;
+	uint32_t nlog, seq, b, i, sum, ntx;
+
+	if (super->s_journal == 0 || super->s_njournal < 2)
+		return;
+	if (super->s_journal >= nblocks ||
+	    super->s_njournal > nblocks - super->s_journal) {
+		error("journal [%u, +%u) out of range",
+		      super->s_journal, super->s_njournal);
+		super->s_njournal = 0;
+		return;
+	}
+
+	jh = block(super->s_journal);
+	if (jh->jh_magic != JOURNAL_MAGIC) {
+		error("bad journal magic number");
+		return;
+	}
+	nlog = (super->s_njournal < JN_MAXLOG ? super->s_njournal : JN_MAXLOG) - 1;
+	seq = jh->jh_seq;
+
+	ntx = 0;
+	for (b = 1; b < 1 + nlog; b += 1 + jd->jd_n) {
+		jd = block(super->s_journal + b);
+		if (jd->jd_magic != JDESC_MAGIC || jd->jd_seq != seq ||
+		    jd->jd_n == 0 || jd->jd_n > nlog - b)
+			break;
+		sum = journal_sum(0, &jd->jd_seq, BLKSIZE / 4 - 2);
+		for (i = 0; i < jd->jd_n; i++)
+			sum = journal_sum(sum, block(super->s_journal + b + 1 + i),
+					  BLKSIZE / 4);
+		if (sum != jd->jd_sum)
+			break;
+
+		for (i = 0; i < jd->jd_n; i++) {
+			if (jd->jd_blocks[i] < 1 || jd->jd_blocks[i] >= nblocks ||
+			    (jd->jd_blocks[i] >= super->s_journal &&
+			     jd->jd_blocks[i] < super->s_journal + 1 + nlog)) {
+				error("journal logs bad block %u", jd->jd_blocks[i]);
+				return;
+			}
+			memmove(block(jd->jd_blocks[i]),
+				block(super->s_journal + b + 1 + i), BLKSIZE);
+		}
+		seq++;
+		ntx++;
+	}
+	if (ntx > 0)
+		printf("fsck: replayed %u journal transactions\n", ntx);
+}
+
+// Return the disk block holding block 'filebno' of f, or 0 if none.
+uint32_t
+file_block(struct File *f, uint32_t filebno)
+{
+	uint32_t i, *ind;
+
+	if (f->f_flags & FILE_INLINE)
+		return 0;
+	if (f->f_flags & FILE_EXTENTS) {
+		for (i = 0; i < f->f_nextent && i < NEXTENT; i++) {
+			if (filebno < f->f_extent[i].e_len)
+				return f->f_extent[i].e_start + filebno;
+			filebno -= f->f_extent[i].e_len;
+		}
+		return 0;
+	}
+	if (filebno < NDIRECT)
+		return f->f_direct[filebno];
+	filebno -= NDIRECT;
+	if (filebno < NINDIRECT) {
+		if (f->f_indirect == 0 || f->f_indirect >= nblocks)
+			return 0;
+		return ((uint32_t *) block(f->f_indirect))[filebno];
+	}
+	filebno -= NINDIRECT;
+	if (filebno >= NINDIRECT * NINDIRECT ||
+	    f->f_dindirect == 0 || f->f_dindirect >= nblocks)
+		return 0;
+	ind = block(f->f_dindirect);
+	if (ind[filebno / NINDIRECT] == 0 || ind[filebno / NINDIRECT] >= nblocks)
+		return 0;
+	return ((uint32_t *) block(ind[filebno / NINDIRECT]))[filebno % NINDIRECT];
+}
+
+// Mark the blocks indirect block 'ind' points to as used; return how
+// many there are.
+uint32_t
+use_indirect(uint32_t *ind, const char *path)
+{
+	uint32_t i, n;
+
+	for (i = n = 0; i < NINDIRECT; i++)
+		if (ind[i]) {
+			use(ind[i], path, "data");
+			n++;
+		}
+	return n;
+}
+
+// Mark the blocks 'f' maps as used; return how many it maps.
+uint32_t
+use_blocks(struct File *f, const char *path)
+{
+	uint32_t i, j, n, *dind;
+
+	n = 0;
+	if (f->f_flags & FILE_INLINE)
+		return 0;
+	if (f->f_flags & FILE_EXTENTS) {
+		if (f->f_nextent > NEXTENT) {
+			error("%s: %u extents", path, f->f_nextent);
+			return 0;
+		}
+		for (i = 0; i < f->f_nextent; i++)
+			for (j = 0; j < f->f_extent[i].e_len; j++, n++)
+				if (!use(f->f_extent[i].e_start + j, path, "data"))
+					break;
+		return n;
+	}
+
+	for (i = 0; i < NDIRECT; i++)
+		if (f->f_direct[i] && use(f->f_direct[i], path, "data"))
+			n++;
+	if (f->f_indirect && use(f->f_indirect, path, "indirect"))
+		n += use_indirect(block(f->f_indirect), path);
+	if (f->f_dindirect && use(f->f_dindirect, path, "double-indirect")) {
+		dind = block(f->f_dindirect);
+		for (i = 0; i < NINDIRECT; i++)
+			if (dind[i] && use(dind[i], path, "indirect"))
+				n += use_indirect(block(dind[i]), path);
+	}
+	return n;
+}
+
+// Return directory f's index after marking its blocks used, or NULL
+// if it has none or a bad one.
+struct DirIndex *
+use_index(struct File *f, const char *path)
+{
+	struct DirIndex *di;
+	uint32_t i;
+
+	if (!(f->f_flags & FILE_DIRINDEX))
+		return NULL;
+	if (!use(f->f_index, path, "index"))
+		return NULL;
+	di = block(f->f_index);
+	if (di->di_magic != DIRINDEX_MAGIC || di->di_nslots < DIRSLOTS ||
+	    (di->di_nslots & (di->di_nslots - 1)) != 0 ||
+	    di->di_nslots / DIRSLOTS > DIRINDEX_MAXBLOCKS ||
+	    di->di_nentries >= di->di_nslots) {
+		error("%s: bad index header in block %u", path, f->f_index);
+		return NULL;
+	}
+	for (i = 0; i < di->di_nslots / DIRSLOTS; i++)
+		if (!use(di->di_blocks[i], path, "index"))
+			return NULL;
+	return di;
+}
+
+// Is entry 'ent', named 'name', in index 'di'?
+bool
+indexed(struct DirIndex *di, const char *name, uint32_t ent)
+{
+	struct DirSlot *ds;
+	uint32_t h, i, n;
+
+	h = dir_hash(name);
+	i = h & (di->di_nslots - 1);
+	for (n = 0; n < di->di_nslots; n++, i = (i + 1) & (di->di_nslots - 1)) {
+		ds = (struct DirSlot *) block(di->di_blocks[i / DIRSLOTS]) +
+			i % DIRSLOTS;
+		if (ds->ds_ent == 0)
+			return 0;
+		if (ds->ds_hash == h && ds->ds_ent == ent + 1)
+			return 1;
+	}
+	return 0;
+}
+
+void
+walk(struct File *f, const char *path, int depth)
+{
+	char child[MAXPATHLEN];
+	struct File *ents;
+	struct DirIndex *di;
+	uint32_t i, j, b, need;
+
+	nfiles++;
+	if ((int32_t) f->f_size < 0 || f->f_size > MAXFILESIZE) {
+		error("%s: bad size %d", path, f->f_size);
+		return;
+	}
+	if ((f->f_flags & FILE_INLINE) &&
+	    (f->f_type != FTYPE_REG || f->f_size > NINLINE)) {
+		error("%s: inline %s of %d bytes", path,
+		      f->f_type == FTYPE_REG ? "file" : "directory", f->f_size);
+		return;
+	}
+	need = (f->f_size + BLKSIZE - 1) / BLKSIZE;
+	// Extent files may map blocks past their size: fallocate reserves
+	// them ahead of the writes.
+	use_blocks(f, path);
+
+	if (f->f_type == FTYPE_REG)
+		return;
+	if (f->f_type != FTYPE_DIR) {
+		error("%s: bad type %u", path, f->f_type);
+		return;
+	}
+	if (f->f_size % BLKSIZE != 0) {
+		error("%s: directory size %d isn't a multiple of the block size",
+		      path, f->f_size);
+		return;
+	}
+	if (depth == MAXDEPTH) {
+		error("%s: directories nested too deep", path);
+		return;
+	}
+	di = use_index(f, path);
+
+	for (i = 0; i < need; i++) {
+		if ((b = file_block(f, i)) == 0 || b >= nblocks) {
+			error("%s: directory block %u is missing", path, i);
+			continue;
+		}
+		ents = block(b);
+		for (j = 0; j < BLKFILES; j++) {
+			if (ents[j].f_name[0] == '\0')
+				continue;
+			if (memchr(ents[j].f_name, '\0', MAXNAMELEN) == NULL) {
+				error("%s: unterminated name in block %u", path, b);
+				continue;
+			}
+			if (di && !indexed(di, ents[j].f_name, i * BLKFILES + j))
+				error("%s: %s is missing from the index", path,
+				      ents[j].f_name);
+			snprintf(child, sizeof(child), "%s%s%s", path,
+				 depth == 0 ? "" : "/", ents[j].f_name);
+			walk(&ents[j], child, depth + 1);
+		}
+	}
+}
+
+void
+usage(void)
+{
+	fprintf(stderr, "Usage: fsck fs.img\n");
+	exit(2);
+}
+
+int
+main(int argc, char **argv)
+{
+	int fd;
+	struct stat st;
+	uint32_t i, nbitblocks, nfree, nleaked;
+	ssize_t n;
+	size_t pos;
+
+	if (argc != 2)
+		usage();
+
+	if ((fd = open(argv[1], O_RDONLY)) < 0 || fstat(fd, &st) < 0) {
+		fprintf(stderr, "fsck: %s: %s\n", argv[1], strerror(errno));
+		exit(2);
+	}
+	if (st.st_size < 2 * BLKSIZE || (disk = malloc(st.st_size)) == NULL) {
+		fprintf(stderr, "fsck: %s: too small\n", argv[1]);
+		exit(2);
+	}
+	for (pos = 0; pos < st.st_size; pos += n)
+		if ((n = read(fd, disk + pos, st.st_size - pos)) <= 0) {
+			fprintf(stderr, "fsck: read %s: %s\n", argv[1],
+				n < 0 ? strerror(errno) : "unexpected EOF");
+			exit(2);
+		}
+	close(fd);
+
+	super = block(1);
+	if (super->s_magic != FS_MAGIC) {
+		error("bad file system magic number");
+		return 1;
+	}
+	nblocks = super->s_nblocks;
+	if (nblocks < 2 || (off_t) (st.st_size / BLKSIZE) < nblocks) {
+		error("%u blocks don't fit in the image", nblocks);
+		return 1;
+	}
+	bitmap = block(2);
+	nbitblocks = (nblocks + BLKBITSIZE - 1) / BLKBITSIZE;
+	used = calloc(nblocks, 1);
+
+	replay();
+
+	// The boot block, superblock, bitmap and journal.
+	if (block_is_free(0))
+		error("boot block is marked free");
+	used[0] = 1;
+	for (i = 1; i < 2 + nbitblocks; i++)
+		use(i, "/", "reserved");
+	for (i = 0; i < super->s_njournal; i++)
+		use(super->s_journal + i, "/", "journal");
+
+	walk(&super->s_root, "/", 0);
+
+	nfree = nleaked = 0;
+	for (i = 0; i < nblocks; i++) {
+		if (block_is_free(i))
+			nfree++;
+		else if (!used[i])
+			nleaked++;
+	}
+	if (nleaked > 0)
+		warn("%u blocks are allocated but unused", nleaked);
+	if (super->s_nfree != nfree)
+		warn("superblock counts %u free blocks, bitmap %u",
+		     super->s_nfree, nfree);
+
+	printf("fsck: %u files, %u blocks, %u free, %d errors, %d warnings\n",
+	       nfiles, nblocks, nfree, nerrors, nwarnings);
+	return nerrors ? 1 : 0;
+}
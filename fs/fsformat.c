@@ -33,12 +33,14 @@ typedef int bool;
 
 #define ROUNDUP(n, v) ((n) - 1 + (v) - ((n) - 1) % (v))
 #define MAX_DIR_ENTS 128
+#define NJOURNAL 64		// journal blocks, header included
 
 struct Dir
 {
 	struct File *f;
 	struct File *ents;
 	int n;
+	int max;
 };
 
 uint32_t nblocks;
@@ -92,6 +94,7 @@ void
 opendisk(const char *name)
 {
 	int r, diskfd, nbitblocks;
+	struct JournalHeader *jh;
 
 	if ((diskfd = open(name, O_RDWR | O_CREAT, 0666)) < 0)
 		panic("open %s: %s", name, strerror(errno));
@@ -118,6 +121,14 @@ opendisk(const char *name)
 	nbitblocks = (nblocks + BLKBITSIZE - 1) / BLKBITSIZE;
 	bitmap = alloc(nbitblocks * BLKSIZE);
 	memset(bitmap, 0xFF, nbitblocks * BLKSIZE);
+
+	// An empty journal: a header and zeroed blocks, which no
+	// transaction's checksum matches.
+	jh = alloc(NJOURNAL * BLKSIZE);
+	jh->jh_magic = JOURNAL_MAGIC;
+	jh->jh_seq = 1;
+	super->s_journal = blockof(jh);
+	super->s_njournal = NJOURNAL;
 }
 
 void
@@ -127,6 +138,7 @@ finishdisk(void)
 
 	for (i = 0; i < blockof(diskpos); ++i)
 		bitmap[i/32] &= ~(1<<(i%32));
+	super->s_nfree = nblocks - blockof(diskpos);
 
 	if ((r = msync(diskmap, nblocks * BLKSIZE, MS_SYNC)) < 0)
 		panic("msync: %s", strerror(errno));
@@ -135,46 +147,88 @@ finishdisk(void)
 void
 finishfile(struct File *f, uint32_t start, uint32_t len)
 {
-	int i;
+	// Files are written contiguously, so one extent maps them.
 	f->f_size = len;
-	len = ROUNDUP(len, BLKSIZE);
-	for (i = 0; i < len / BLKSIZE && i < NDIRECT; ++i)
-		f->f_direct[i] = start + i;
-	if (i == NDIRECT) {
-		uint32_t *ind = alloc(BLKSIZE);
-		f->f_indirect = blockof(ind);
-		for (; i < len / BLKSIZE; ++i)
-			ind[i - NDIRECT] = start + i;
+	f->f_flags = FILE_EXTENTS;
+	if (len > 0) {
+		f->f_nextent = 1;
+		f->f_extent[0].e_start = start;
+		f->f_extent[0].e_len = ROUNDUP(len, BLKSIZE) / BLKSIZE;
 	}
 }
 
+// Start directory 'f', which will hold 'max' entries.  Its blocks and
+// index go on the disk now, ahead of the files in it, the way the file
+// server places a file's blocks after the directory block naming it
+// (fs/fs.c).
 void
-startdir(struct File *f, struct Dir *dout)
+startdir(struct File *f, struct Dir *dout, int max)
 {
+	struct DirIndex *di;
+	struct DirSlot *tab;
+	uint32_t nslots, i;
+
+	if (max > MAX_DIR_ENTS)
+		panic("too many directory entries");
 	dout->f = f;
-	dout->ents = malloc(MAX_DIR_ENTS * sizeof *dout->ents);
+	dout->ents = alloc(max * sizeof *dout->ents);
 	dout->n = 0;
+	dout->max = max;
+	finishfile(f, blockof(dout->ents),
+		   ROUNDUP(max * sizeof(struct File), BLKSIZE));
+
+	for (nslots = DIRSLOTS; nslots < 3 * (max + 1); nslots *= 2)
+		;
+	di = alloc(BLKSIZE);
+	tab = alloc(nslots * sizeof(struct DirSlot));
+	di->di_magic = DIRINDEX_MAGIC;
+	di->di_nslots = nslots;
+	for (i = 0; i < nslots / DIRSLOTS; i++)
+		di->di_blocks[i] = blockof(tab) + i;
+	f->f_flags |= FILE_DIRINDEX;
+	f->f_index = blockof(di);
 }
 
 struct File *
 diradd(struct Dir *d, uint32_t type, const char *name)
 {
 	struct File *out = &d->ents[d->n++];
-	if (d->n > MAX_DIR_ENTS)
+	if (d->n > d->max)
 		panic("too many directory entries");
+	memset(out, 0, sizeof *out);
 	strcpy(out->f_name, name);
 	out->f_type = type;
 	return out;
 }
 
+// Fill in the hash index startdir laid out for directory 'f', whose
+// 'n' entries are at 'ents'.
+void
+indexdir(struct File *f, struct File *ents, int n)
+{
+	struct DirIndex *di;
+	struct DirSlot *tab;
+	uint32_t nslots, h, i, j;
+
+	di = (struct DirIndex *) (diskmap + f->f_index * BLKSIZE);
+	tab = (struct DirSlot *) (diskmap + di->di_blocks[0] * BLKSIZE);
+	nslots = di->di_nslots;
+	di->di_nentries = n;
+	di->di_free = n;
+
+	for (i = 0; i < n; i++) {
+		h = dir_hash(ents[i].f_name);
+		for (j = h & (nslots - 1); tab[j].ds_ent; j = (j + 1) & (nslots - 1))
+			;
+		tab[j].ds_hash = h;
+		tab[j].ds_ent = i + 1;
+	}
+}
+
 void
 finishdir(struct Dir *d)
 {
-	int size = d->n * sizeof(struct File);
-	struct File *start = alloc(size);
-	memmove(start, d->ents, size);
-	finishfile(d->f, blockof(start), ROUNDUP(size, BLKSIZE));
-	free(d->ents);
+	indexdir(d->f, d->ents, d->n);
 	d->ents = NULL;
 }
 
@@ -203,9 +257,16 @@ writefile(struct Dir *dir, const char *name)
 		last = name;
 
 	f = diradd(dir, FTYPE_REG, last);
-	start = alloc(st.st_size);
-	readn(fd, start, st.st_size);
-	finishfile(f, blockof(start), st.st_size);
+	if (st.st_size <= NINLINE) {
+		// Small enough to keep in the File, as the file server does.
+		readn(fd, f->f_data, st.st_size);
+		f->f_size = st.st_size;
+		f->f_flags = FILE_INLINE;
+	} else {
+		start = alloc(st.st_size);
+		readn(fd, start, st.st_size);
+		finishfile(f, blockof(start), st.st_size);
+	}
 	close(fd);
 }
 
@@ -229,12 +290,12 @@ main(int argc, char **argv)
 		usage();
 
 	nblocks = strtol(argv[2], &s, 0);
-	if (*s || s == argv[2] || nblocks < 2 || nblocks > 1024)
+	if (*s || s == argv[2] || nblocks < 2 || nblocks > BLKBITSIZE)
 		usage();
 
 	opendisk(argv[1]);
 
-	startdir(&super->s_root, &root);
+	startdir(&super->s_root, &root, argc - 3);
 	for (i = 3; i < argc; i++)
 		writefile(&root, argv[i]);
 	finishdir(&root);
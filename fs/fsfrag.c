@@ -0,0 +1,216 @@
+/*
+ * JOS file system fragmentation report
+ *
+ * Walks every file in an image and reports how its blocks lie on the
+ * disk: in how many runs of consecutive blocks, and how far the first
+ * is from the directory block naming the file.  Then shows how full
+ * each allocation group is.  The journal isn't replayed, so run it on
+ * an image the file server has synced.
+ */
+
+// We don't actually want to define off_t!
+#define off_t xxx_off_t
+#define bool xxx_bool
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#undef off_t
+#undef bool
+
+// Prevent inc/types.h, included from inc/fs.h,
+// from attempting to redefine types defined in the host's inttypes.h.
+#define JOS_INC_TYPES_H
+// Typedef the types that inc/mmu.h needs.
+typedef uint32_t physaddr_t;
+typedef uint32_t off_t;
+typedef int bool;
+
+#include <inc/mmu.h>
+#include <inc/fs.h>
+
+#define MAXDEPTH 32
+
+uint32_t nblocks;
+char *disk;
+struct Super *super;
+uint32_t *bitmap;
+bool verbose;
+
+// Totals over regular files with at least one block.
+uint32_t nfiles, nfrag, nfblocks, nruns;
+uint64_t distance;
+
+void *
+block(uint32_t blockno)
+{
+	return disk + (size_t) blockno * BLKSIZE;
+}
+
+bool
+block_is_free(uint32_t blockno)
+{
+	return (bitmap[blockno / 32] & (1 << (blockno % 32))) != 0;
+}
+
+// Return the disk block holding block 'filebno' of f, or 0 if none.
+uint32_t
+file_block(struct File *f, uint32_t filebno)
+{
+	uint32_t i, *ind;
+
+	if (f->f_flags & FILE_INLINE)
+		return 0;
+	if (f->f_flags & FILE_EXTENTS) {
+		for (i = 0; i < f->f_nextent && i < NEXTENT; i++) {
+			if (filebno < f->f_extent[i].e_len)
+				return f->f_extent[i].e_start + filebno;
+			filebno -= f->f_extent[i].e_len;
+		}
+		return 0;
+	}
+	if (filebno < NDIRECT)
+		return f->f_direct[filebno];
+	filebno -= NDIRECT;
+	if (filebno < NINDIRECT) {
+		if (f->f_indirect == 0 || f->f_indirect >= nblocks)
+			return 0;
+		return ((uint32_t *) block(f->f_indirect))[filebno];
+	}
+	filebno -= NINDIRECT;
+	if (filebno >= NINDIRECT * NINDIRECT ||
+	    f->f_dindirect == 0 || f->f_dindirect >= nblocks)
+		return 0;
+	ind = block(f->f_dindirect);
+	if (ind[filebno / NINDIRECT] == 0 || ind[filebno / NINDIRECT] >= nblocks)
+		return 0;
+	return ((uint32_t *) block(ind[filebno / NINDIRECT]))[filebno % NINDIRECT];
+}
+
+// Report on file 'f', named in directory block 'home', and if it is a
+// directory on the files in it.
+void
+walk(struct File *f, uint32_t home, const char *path, int depth)
+{
+	char child[MAXPATHLEN];
+	struct File *ents;
+	uint32_t i, j, b, prev, first, n, runs;
+
+	n = (f->f_size + BLKSIZE - 1) / BLKSIZE;
+	runs = 0;
+	first = prev = 0;
+	for (i = 0; i < n; i++) {
+		if ((b = file_block(f, i)) == 0 || b >= nblocks)
+			continue;
+		if (runs == 0)
+			first = b;
+		if (runs == 0 || b != prev + 1)
+			runs++;
+		prev = b;
+	}
+
+	if (f->f_type == FTYPE_REG && runs > 0) {
+		nfiles++;
+		nfblocks += n;
+		nruns += runs;
+		if (runs > 1)
+			nfrag++;
+		distance += first > home ? first - home : home - first;
+		if (verbose)
+			printf("%-32s %6u blocks %4u runs, group %u, "
+			       "%u blocks from its directory\n", path, n, runs,
+			       first / AG_BLOCKS,
+			       first > home ? first - home : home - first);
+	}
+
+	if (f->f_type != FTYPE_DIR || depth == MAXDEPTH)
+		return;
+	for (i = 0; i < n; i++) {
+		if ((b = file_block(f, i)) == 0 || b >= nblocks)
+			continue;
+		ents = block(b);
+		for (j = 0; j < BLKFILES; j++) {
+			if (ents[j].f_name[0] == '\0' ||
+			    memchr(ents[j].f_name, '\0', MAXNAMELEN) == NULL)
+				continue;
+			snprintf(child, sizeof(child), "%s%s%s", path,
+				 depth == 0 ? "" : "/", ents[j].f_name);
+			walk(&ents[j], b, child, depth + 1);
+		}
+	}
+}
+
+void
+usage(void)
+{
+	fprintf(stderr, "Usage: fsfrag [-v] fs.img\n");
+	exit(2);
+}
+
+int
+main(int argc, char **argv)
+{
+	int fd;
+	struct stat st;
+	uint32_t g, i, ngroups, nfree;
+	ssize_t n;
+	size_t pos;
+
+	if (argc == 3 && strcmp(argv[1], "-v") == 0) {
+		verbose = 1;
+		argc--;
+		argv++;
+	}
+	if (argc != 2)
+		usage();
+
+	if ((fd = open(argv[1], O_RDONLY)) < 0 || fstat(fd, &st) < 0) {
+		fprintf(stderr, "fsfrag: %s: %s\n", argv[1], strerror(errno));
+		exit(2);
+	}
+	if (st.st_size < 2 * BLKSIZE || (disk = malloc(st.st_size)) == NULL) {
+		fprintf(stderr, "fsfrag: %s: too small\n", argv[1]);
+		exit(2);
+	}
+	for (pos = 0; pos < st.st_size; pos += n)
+		if ((n = read(fd, disk + pos, st.st_size - pos)) <= 0) {
+			fprintf(stderr, "fsfrag: read %s: %s\n", argv[1],
+				n < 0 ? strerror(errno) : "unexpected EOF");
+			exit(2);
+		}
+	close(fd);
+
+	super = block(1);
+	nblocks = super->s_nblocks;
+	if (super->s_magic != FS_MAGIC || nblocks < 2 ||
+	    (off_t) (st.st_size / BLKSIZE) < nblocks) {
+		fprintf(stderr, "fsfrag: %s: not a file system image\n", argv[1]);
+		exit(2);
+	}
+	bitmap = block(2);
+
+	walk(&super->s_root, 1, "/", 0);
+
+	printf("fsfrag: %u files, %u blocks in %u runs (%u blocks/run), "
+	       "%u in more than one run\n", nfiles, nfblocks, nruns,
+	       nruns ? nfblocks / nruns : 0, nfrag);
+	printf("fsfrag: first blocks %u blocks from their directory on "
+	       "average\n", nfiles ? (uint32_t) (distance / nfiles) : 0);
+
+	ngroups = (nblocks + AG_BLOCKS - 1) / AG_BLOCKS;
+	for (g = 0; g < ngroups; g++) {
+		nfree = 0;
+		for (i = g * AG_BLOCKS; i < nblocks && i < (g + 1) * AG_BLOCKS; i++)
+			if (block_is_free(i))
+				nfree++;
+		printf("fsfrag: group %2u: %4u of %u blocks free\n", g, nfree,
+		       (g + 1) * AG_BLOCKS <= nblocks ? AG_BLOCKS :
+		       nblocks - g * AG_BLOCKS);
+	}
+	return 0;
+}
@@ -1,5 +1,7 @@
 /*
- * Minimal PIO-based (non-interrupt-driven) IDE driver code.
+ * Minimal IDE driver code.  Transfers of whole pages use bus-master DMA
+ * when the PCI IDE controller supports it, and sleep until IRQ 14
+ * rather than polling; anything else uses programmed I/O.
  * For information about what all this IDE/ATA magic means,
  * see the materials available on the class references page.
  */
@@ -12,8 +14,38 @@
 #define IDE_DF		0x20
 #define IDE_ERR		0x01
 
+// Bus-master IDE registers (primary channel), relative to bmbase
+#define BM_CMD		0
+#define BM_STATUS	2
+#define BM_PRDT		4
+
+#define BM_CMD_START	0x01
+#define BM_CMD_READ	0x08	// device to memory
+#define BM_ST_ACTIVE	0x01
+#define BM_ST_ERR	0x02
+#define BM_ST_IRQ	0x04
+
+// Physical region descriptor: one page of a DMA transfer
+struct Prd {
+	uint32_t prd_addr;
+	uint32_t prd_len;	// bytes (0 means 64K), PRD_EOT on the last
+};
+#define PRD_EOT		0x80000000
+
+// Page holding the PRD table, among the driver pages below DISKMAP
+#define IDE_PRDVA	0x0fffe000
+
+// How long to sleep before checking on a DMA transfer anyway
+#define IDE_TIMEOUT_MS	100
+
 static int diskno = 1;
 
+static uint16_t bmbase;			// bus-master ports, 0 if no DMA
+static uint32_t prdt_pa;		// physical address of the PRD table
+static volatile uint32_t ide_irqs;	// IRQ 14 count, kept by the kernel
+static bool dma_busy;			// a transfer is in flight
+static uint32_t dma_secno, dma_nsecs;	// and the sectors it covers
+
 static int
 ide_wait_ready(bool check_error)
 {
@@ -59,14 +91,42 @@ ide_set_disk(int d)
 	diskno = d;
 }
 
-
-int
-ide_read(uint32_t secno, void *dst, size_t nsecs)
+// Set up bus-master DMA on the primary channel, if the PCI IDE
+// controller can do it.  Otherwise the driver sticks to programmed I/O.
+void
+ide_dma_init(void)
 {
+	struct PciFunc f;
 	int r;
 
-	assert(nsecs <= 256);
+	// Bit 7 of the programming interface says it can bus master.
+	if (pci_find_class(PCI_CLASS_STORAGE, PCI_SUBCLASS_IDE, &f) < 0 ||
+	    !(f.pf_class & 0x8000) || !(f.pf_bar[4] & 1)) {
+		cprintf("IDE: no bus-master DMA, using PIO\n");
+		return;
+	}
+
+	static_assert(IDE_PRDVA >= DRIVERVA && IDE_PRDVA < DISKMAP);
+	if ((r = sys_page_alloc(0, (void *) IDE_PRDVA, PTE_P|PTE_U|PTE_W)) < 0)
+		panic("ide_dma_init: %e", r);
+	if ((r = sys_page_paddr((void *) IDE_PRDVA)) < 0)
+		panic("ide_dma_init: %e", r);
+	prdt_pa = r;
+	if ((r = sys_irq_listen(IRQ_IDE, &ide_irqs)) < 0)
+		panic("ide_dma_init: %e", r);
 
+	pci_enable(&f, PCI_COMMAND_IO | PCI_COMMAND_MASTER);
+	bmbase = f.pf_bar[4] & ~3;
+
+	// Let the drive interrupt (clear nIEN).
+	outb(0x3F6, 0);
+	cprintf("IDE: bus-master DMA at port %x\n", bmbase);
+}
+
+// Select the sectors and issue ATA command 'cmd'.
+static void
+ide_command(uint32_t secno, size_t nsecs, uint8_t cmd)
+{
 	ide_wait_ready(0);
 
 	outb(0x1F2, nsecs);
@@ -74,7 +134,115 @@ ide_read(uint32_t secno, void *dst, size_t nsecs)
 	outb(0x1F4, (secno >> 8) & 0xFF);
 	outb(0x1F5, (secno >> 16) & 0xFF);
 	outb(0x1F6, 0xE0 | ((diskno&1)<<4) | ((secno>>24)&0x0F));
-	outb(0x1F7, 0x20);	// CMD 0x20 means read sector
+	outb(0x1F7, cmd);
+}
+
+// Can this transfer use DMA?  It needs whole pages.
+static bool
+ide_dma_ok(const void *va, size_t nsecs)
+{
+	return bmbase && PGOFF(va) == 0 && nsecs > 0 && nsecs % BLKSECTS == 0;
+}
+
+// Wait for the DMA transfer in flight, if any, to finish, sleeping
+// until the drive interrupts.  Returns 0, or -1 if it failed.
+static int
+ide_dma_wait(void)
+{
+	uint32_t seen;
+	int st, r;
+
+	if (!dma_busy)
+		return 0;
+
+	// Read the IRQ count before the status, so an interrupt in
+	// between makes sys_chan_sleep return at once.
+	for (;;) {
+		seen = ide_irqs;
+		st = inb(bmbase + BM_STATUS);
+		if ((st & BM_ST_IRQ) || !(st & BM_ST_ACTIVE))
+			break;
+		sys_chan_sleep(&ide_irqs, seen, (void *) UTOP, IDE_TIMEOUT_MS);
+	}
+
+	outb(bmbase + BM_CMD, 0);
+	r = inb(0x1F7);		// also acknowledges the drive's interrupt
+	outb(bmbase + BM_STATUS, BM_ST_IRQ | BM_ST_ERR);
+	dma_busy = 0;
+
+	if ((st & BM_ST_ERR) || (r & (IDE_DF|IDE_ERR)))
+		return -1;
+	return 0;
+}
+
+// Start a DMA transfer of 'nsecs' sectors between the disk and the
+// pages at 'va', after any transfer already in flight.
+static int
+ide_dma_start(uint32_t secno, const void *va, size_t nsecs, bool write)
+{
+	struct Prd *prd = (struct Prd *) IDE_PRDVA;
+	uint32_t i, n;
+	int r, pa;
+
+	if ((r = ide_dma_wait()) < 0)
+		return r;
+
+	n = nsecs / BLKSECTS;
+	for (i = 0; i < n; i++) {
+		if ((pa = sys_page_paddr((char *) va + i * PGSIZE)) < 0)
+			return pa;
+		prd[i].prd_addr = pa;
+		prd[i].prd_len = PGSIZE | (i == n - 1 ? PRD_EOT : 0);
+	}
+
+	outl(bmbase + BM_PRDT, prdt_pa);
+	outb(bmbase + BM_CMD, write ? 0 : BM_CMD_READ);
+	outb(bmbase + BM_STATUS, BM_ST_IRQ | BM_ST_ERR);
+	ide_command(secno, nsecs, write ? 0xCA : 0xC8);	// WRITE/READ DMA
+	outb(bmbase + BM_CMD, (write ? 0 : BM_CMD_READ) | BM_CMD_START);
+
+	dma_busy = 1;
+	dma_secno = secno;
+	dma_nsecs = nsecs;
+	return 0;
+}
+
+// Wait for the transfer in flight to finish.  Returns 0, or -1 if it
+// failed.
+int
+ide_sync(void)
+{
+	return ide_dma_wait();
+}
+
+// Like ide_sync, but only wait if the transfer in flight touches
+// sectors [secno, secno+nsecs).
+int
+ide_sync_range(uint32_t secno, size_t nsecs)
+{
+	if (!dma_busy || secno + nsecs <= dma_secno ||
+	    dma_secno + dma_nsecs <= secno)
+		return 0;
+	return ide_dma_wait();
+}
+
+
+int
+ide_read(uint32_t secno, void *dst, size_t nsecs)
+{
+	int r;
+
+	assert(nsecs <= 256);
+
+	if (ide_dma_ok(dst, nsecs)) {
+		if ((r = ide_dma_start(secno, dst, nsecs, 0)) < 0)
+			return r;
+		return ide_dma_wait();
+	}
+	if ((r = ide_dma_wait()) < 0)
+		return r;
+
+	ide_command(secno, nsecs, 0x20);	// CMD 0x20 means read sector
 
 	for (; nsecs > 0; nsecs--, dst += SECTSIZE) {
 		if ((r = ide_wait_ready(1)) < 0)
@@ -85,6 +253,10 @@ ide_read(uint32_t secno, void *dst, size_t nsecs)
 	return 0;
 }
 
+// With DMA, ide_write returns once the transfer has started: the pages
+// at 'src' must stay mapped and unchanged until ide_sync, a matching
+// ide_sync_range, or the next ide_read or ide_write, which also report
+// an error in the transfer.
 int
 ide_write(uint32_t secno, const void *src, size_t nsecs)
 {
@@ -92,14 +264,12 @@ ide_write(uint32_t secno, const void *src, size_t nsecs)
 
 	assert(nsecs <= 256);
 
-	ide_wait_ready(0);
+	if (ide_dma_ok(src, nsecs))
+		return ide_dma_start(secno, src, nsecs, 1);
+	if ((r = ide_dma_wait()) < 0)
+		return r;
 
-	outb(0x1F2, nsecs);
-	outb(0x1F3, secno & 0xFF);
-	outb(0x1F4, (secno >> 8) & 0xFF);
-	outb(0x1F5, (secno >> 16) & 0xFF);
-	outb(0x1F6, 0xE0 | ((diskno&1)<<4) | ((secno>>24)&0x0F));
-	outb(0x1F7, 0x30);	// CMD 0x30 means write sector
+	ide_command(secno, nsecs, 0x30);	// CMD 0x30 means write sector
 
 	for (; nsecs > 0; nsecs--, src += SECTSIZE) {
 		if ((r = ide_wait_ready(1)) < 0)
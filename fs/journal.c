@@ -0,0 +1,313 @@
+/*
+ * Write-ahead journal for file system metadata.
+ *
+ * Code that is about to change the bitmap, the superblock, a directory
+ * block holding a struct File, or an indirect block calls journal_dirty
+ * first.  The blocks it names make up the running transaction, which
+ * is committed with one sequential write to the journal region that
+ * fsformat reserves: a descriptor block, then a copy of each block.
+ * The blocks themselves stay dirty in the cache and go to their home
+ * locations only at a checkpoint, when the journal is half full or on
+ * fs_sync, so a block changed by many requests is written home once.
+ *
+ * Until then the cache must not write them: blocks in the running
+ * transaction never, since that would put half a change on disk, and
+ * committed ones not by periodic writeback, which is the laziness.
+ * bc_flush skips running blocks, bc_writeback skips both and bc_evict
+ * passes running blocks over.  Data blocks are written before the
+ * transaction that points at them commits.
+ *
+ * A transaction holds whole requests: it commits between them, in the
+ * serve loop or on a flush or sync, never while one is changing
+ * things, since a crash could then leave half a change on disk.
+ *
+ * After a crash, fs_init replays the committed transactions that made
+ * it to disk in full (journal_init) and starts a new journal.
+ */
+
+#include "fs.h"
+
+// Most journal blocks used, header included
+#define JN_MAXLOG	256
+
+static uint32_t jn_start;		// header block, 0 if no journal
+static uint32_t jn_nlog;		// blocks after the header
+static uint32_t jn_maxtx;		// most blocks one commit can log
+static uint32_t jn_head;		// next free log block, from 1
+static uint32_t jn_seq;			// next transaction's jd_seq
+
+// Blocks in the running transaction, and blocks committed since the
+// last checkpoint.  A block can be in both.
+static uint32_t jn_running[JN_MAXLOG];
+static uint32_t jn_nrunning;
+static uint32_t jn_logged[JN_MAXLOG];
+static uint32_t jn_nlogged;
+
+// A worker is committing.  Commits run between requests that change
+// things, which run alone, but one waits for the disk with fs_lock let
+// go, so be sure.
+static bool jn_committing;
+
+static struct SysBatch jn_batch;
+
+static bool
+jn_find(uint32_t *list, uint32_t n, uint32_t blockno)
+{
+	uint32_t i;
+
+	for (i = 0; i < n; i++)
+		if (list[i] == blockno)
+			return 1;
+	return 0;
+}
+
+// Is 'blockno' in the running transaction?
+bool
+journal_running(uint32_t blockno)
+{
+	return jn_find(jn_running, jn_nrunning, blockno);
+}
+
+// Does the journal hold 'blockno' back from writeback: is it in the
+// running transaction or committed but not yet checkpointed?
+bool
+journal_holds(uint32_t blockno)
+{
+	return journal_running(blockno) ||
+		jn_find(jn_logged, jn_nlogged, blockno);
+}
+
+// Map journal blocks [b, b+n) writable, for the commit to fill in.
+// They are pinned in the cache, so they are always mapped.
+static void
+jn_writable(uint32_t b, uint32_t n)
+{
+	uint32_t i;
+	int r;
+
+	for (i = 0; i < n; i++)
+		sysbatch_add(&jn_batch, SYS_page_map, 0,
+			     (uint32_t) diskaddr(b + i), 0,
+			     (uint32_t) diskaddr(b + i), PTE_P | PTE_U | PTE_W);
+	if ((r = sysbatch_flush(&jn_batch)) < 0)
+		panic("journal: %e", r);
+}
+
+// Write the header, naming jn_seq as the first transaction, and wait.
+static void
+jn_write_header(void)
+{
+	struct JournalHeader *jh = diskaddr(jn_start);
+	int r;
+
+	jn_writable(jn_start, 1);
+	jh->jh_magic = JOURNAL_MAGIC;
+	jh->jh_seq = jn_seq;
+	bc_flush(jn_start, 1);
+	if ((r = bio_sync()) < 0)
+		panic("journal: %e", r);
+}
+
+// Write every committed block home and empty the journal.  The running
+// transaction must be empty.
+void
+journal_checkpoint(void)
+{
+	uint32_t i;
+	int r;
+
+	if (jn_start == 0 || jn_nlogged == 0)
+		return;
+	assert(jn_nrunning == 0);
+
+	// A logged block that isn't dirty (or cached) any more was
+	// written home by eviction.
+	for (i = 0; i < jn_nlogged; i++)
+		bc_flush(jn_logged[i], 1);
+	if ((r = bio_sync()) < 0)
+		panic("journal_checkpoint: %e", r);
+	jn_nlogged = 0;
+
+	jn_head = 1;
+	jn_write_header();
+}
+
+// Commit the running transaction: write back dirty data, then the
+// descriptor and copies of the transaction's blocks as one run, and
+// wait for them.  Checkpoint if that leaves less than half the journal
+// free, so that the next transaction always fits.  Without a journal,
+// just write back everything.
+static void
+jn_commit(void)
+{
+	struct JournalDesc *jd;
+	uint32_t i, n, sum;
+	int r;
+
+	if (jn_start == 0) {
+		bc_writeback();
+		return;
+	}
+	if (jn_nrunning == 0)
+		return;
+
+	// Ordered: the blocks the new metadata points to go first.
+	bc_writeback();
+	if ((r = bio_sync()) < 0)
+		panic("journal_commit: %e", r);
+
+	n = jn_nrunning;
+	assert(jn_head + 1 + n <= 1 + jn_nlog);
+	jn_writable(jn_start + jn_head, 1 + n);
+	jd = diskaddr(jn_start + jn_head);
+	memset(jd, 0, BLKSIZE);
+	jd->jd_magic = JDESC_MAGIC;
+	jd->jd_seq = jn_seq;
+	jd->jd_n = n;
+	for (i = 0; i < n; i++) {
+		jd->jd_blocks[i] = jn_running[i];
+		memmove(diskaddr(jn_start + jn_head + 1 + i),
+			diskaddr(jn_running[i]), BLKSIZE);
+	}
+	sum = journal_sum(0, &jd->jd_seq, BLKSIZE / 4 - 2);
+	for (i = 0; i < n; i++)
+		sum = journal_sum(sum, diskaddr(jn_start + jn_head + 1 + i),
+				  BLKSIZE / 4);
+	jd->jd_sum = sum;
+
+	bc_flush(jn_start + jn_head, 1 + n);
+	if ((r = bio_sync()) < 0)
+		panic("journal_commit: %e", r);
+
+	for (i = 0; i < n; i++)
+		if (!jn_find(jn_logged, jn_nlogged, jn_running[i]))
+			jn_logged[jn_nlogged++] = jn_running[i];
+	jn_nrunning = 0;
+	jn_head += 1 + n;
+	jn_seq++;
+
+	if (1 + jn_nlog - jn_head < jn_nlog / 2)
+		journal_checkpoint();
+}
+
+// Commit, once another worker's commit, which waits for the disk with
+// fs_lock let go, is done.  That may leave nothing to commit.
+void
+journal_commit(void)
+{
+	while (jn_committing)
+		fs_yield();
+	jn_committing = 1;
+	jn_commit();
+	jn_committing = 0;
+}
+
+// Add the block holding 'va' to the running transaction.  Call it just
+// before changing the block, with nothing that can fault in between.
+//
+// The serve loop commits before a request that changes things once a
+// quarter of jn_maxtx is taken, so the request has room for the rest.  Only one that changes more
+// metadata blocks than that (converting a big file to block pointers)
+// fills the transaction; it is committed then as a last resort, which
+// splits the request across two transactions.
+void
+journal_dirty(void *va)
+{
+	uint32_t blockno = ((uint32_t) va - DISKMAP) / BLKSIZE;
+
+	if (jn_start == 0 || journal_running(blockno))
+		return;
+
+	// Running blocks stay cached until they commit (bc_evict passes
+	// them over), so the commit can copy them without faulting.
+	(void) *(volatile char *) va;
+
+	if (jn_nrunning == jn_maxtx) {
+		cprintf("journal: request too big for one transaction\n");
+		journal_commit();
+	}
+	jn_running[jn_nrunning++] = blockno;
+}
+
+// Is the running transaction big enough to commit at the end of the
+// current request, rather than waiting for the writeback timer?  Past
+// this, the next request might not fit.
+bool
+journal_full(void)
+{
+	return jn_start != 0 && jn_nrunning >= jn_maxtx / 4;
+}
+
+// Replay the transactions that made it to disk in full, in order, and
+// start a new journal.  Returns the number replayed.
+static uint32_t
+jn_replay(void)
+{
+	struct JournalHeader *jh;
+	struct JournalDesc *jd;
+	uint32_t i, b, sum, ntx;
+	int r;
+
+	jh = diskaddr(jn_start);
+	if (jh->jh_magic != JOURNAL_MAGIC)
+		panic("bad journal magic number");
+	jn_seq = jh->jh_seq;
+
+	ntx = 0;
+	for (b = 1; b < 1 + jn_nlog; b += 1 + jd->jd_n) {
+		jd = diskaddr(jn_start + b);
+		if (jd->jd_magic != JDESC_MAGIC || jd->jd_seq != jn_seq ||
+		    jd->jd_n == 0 || jd->jd_n > jn_nlog - b)
+			break;
+		sum = journal_sum(0, &jd->jd_seq, BLKSIZE / 4 - 2);
+		for (i = 0; i < jd->jd_n; i++)
+			sum = journal_sum(sum, diskaddr(jn_start + b + 1 + i),
+					  BLKSIZE / 4);
+		if (sum != jd->jd_sum)
+			break;
+
+		for (i = 0; i < jd->jd_n; i++) {
+			if (jd->jd_blocks[i] < 1 ||
+			    jd->jd_blocks[i] >= super->s_nblocks ||
+			    (jd->jd_blocks[i] >= jn_start &&
+			     jd->jd_blocks[i] < jn_start + 1 + jn_nlog))
+				panic("journal logs bad block %08x",
+				      jd->jd_blocks[i]);
+			memmove(diskaddr(jd->jd_blocks[i]),
+				diskaddr(jn_start + b + 1 + i), BLKSIZE);
+			bc_flush(jd->jd_blocks[i], 1);
+		}
+		jn_seq++;
+		ntx++;
+	}
+	if ((r = bio_sync()) < 0)
+		panic("journal replay: %e", r);
+	return ntx;
+}
+
+// Find the journal, replay it, and start a new one.  Call with super
+// set, before anything reads the bitmap or the files.
+void
+journal_init(void)
+{
+	uint32_t ntx;
+
+	if (super->s_journal == 0 || super->s_njournal < 2) {
+		cprintf("warning: no journal, metadata is written in place\n");
+		return;
+	}
+	jn_start = super->s_journal;
+	jn_nlog = MIN(super->s_njournal, JN_MAXLOG) - 1;
+	// A commit takes a descriptor too, and starts with at least half
+	// the journal free (jn_commit checkpoints otherwise).
+	jn_maxtx = MAX(jn_nlog / 2, 2) - 1;
+
+	// The journal is pinned in the cache; read it in one go.
+	bc_read(jn_start, 1 + jn_nlog);
+
+	if ((ntx = jn_replay()) > 0)
+		cprintf("journal: replayed %d transactions\n", ntx);
+	jn_head = 1;
+	jn_write_header();
+	cprintf("journal is good\n");
+}
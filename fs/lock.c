@@ -0,0 +1,96 @@
+/*
+ * Locking between the file server's workers.
+ *
+ * The workers (serv.c) are environments sharing one address space, so
+ * the block cache, the open file table and everything else is common
+ * to them.  fs_lock guards all of it: a worker holds it whenever it
+ * runs file system code and lets go only to wait, for a client, for
+ * the disk to read a block (bio_dispatch), or for another worker.
+ *
+ * Waiting for the disk is what lets one worker's cache hit go ahead of
+ * another's miss, but the code around it must then expect the world to
+ * have moved on.  Requests that change the file system therefore run
+ * alone (fs_begin(1)), so that all a worker can find changed after a
+ * wait is which blocks are cached, never what a block says.
+ */
+
+#include <inc/x86.h>
+
+#include "fs.h"
+
+static struct Lock fs_biglock;
+static uint32_t fs_nshared;	// requests in progress that share
+static bool fs_exclusive;	// a request in progress, or waiting for
+				// the others to finish, runs alone
+
+void
+lock_acquire(struct Lock *l)
+{
+	while (xchg(&l->l_locked, 1) != 0)
+		sys_yield();
+}
+
+void
+lock_release(struct Lock *l)
+{
+	xchg(&l->l_locked, 0);
+}
+
+// Take fs_lock.  Another worker may have unmapped or protected cache
+// pages while this one didn't hold it, so it must have entered the
+// kernel since it last let go, which drops stale TLB entries.
+void
+fs_lock(void)
+{
+	lock_acquire(&fs_biglock);
+}
+
+void
+fs_unlock(void)
+{
+	lock_release(&fs_biglock);
+}
+
+// Let the other workers run for a while.
+void
+fs_yield(void)
+{
+	fs_unlock();
+	sys_yield();
+	fs_lock();
+}
+
+// Start serving a request that changes the file system if 'exclusive',
+// or only reads it if not.  A changing request waits for those in
+// progress to finish and keeps new ones out until fs_end.
+void
+fs_begin(bool exclusive)
+{
+	while (fs_exclusive)
+		fs_yield();
+	if (!exclusive) {
+		fs_nshared++;
+		return;
+	}
+	fs_exclusive = 1;
+	while (fs_nshared > 0)
+		fs_yield();
+}
+
+// Is the request in progress one that only reads?  Reading a hole would
+// allocate it; such a request gives up with -E_AGAIN and runs again
+// alone (serve).
+bool
+fs_shared(void)
+{
+	return fs_nshared > 0;
+}
+
+void
+fs_end(bool exclusive)
+{
+	if (exclusive)
+		fs_exclusive = 0;
+	else
+		fs_nshared--;
+}
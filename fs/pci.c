@@ -0,0 +1,106 @@
+/*
+ * Minimal PCI configuration space access for the file server, which
+ * has I/O privileges, using configuration mechanism #1.
+ */
+
+#include "fs.h"
+#include <inc/x86.h>
+
+#define PCI_CONF_ADDR	0xCF8
+#define PCI_CONF_DATA	0xCFC
+
+#define PCI_ID_REG	0x00
+#define PCI_COMMAND_REG	0x04
+#define PCI_CLASS_REG	0x08
+#define PCI_HEADER_REG	0x0C
+#define PCI_BAR0_REG	0x10
+#define PCI_INTR_REG	0x3C
+
+static uint32_t
+pci_conf_addr(struct PciFunc *f, uint32_t off)
+{
+	return 0x80000000 | (f->pf_bus << 16) | (f->pf_dev << 11) |
+		(f->pf_func << 8) | (off & 0xFC);
+}
+
+uint32_t
+pci_conf_read(struct PciFunc *f, uint32_t off)
+{
+	outl(PCI_CONF_ADDR, pci_conf_addr(f, off));
+	return inl(PCI_CONF_DATA);
+}
+
+void
+pci_conf_write(struct PciFunc *f, uint32_t off, uint32_t v)
+{
+	outl(PCI_CONF_ADDR, pci_conf_addr(f, off));
+	outl(PCI_CONF_DATA, v);
+}
+
+// Turn on the 'flags' bits (PCI_COMMAND_*) in f's command register.
+void
+pci_enable(struct PciFunc *f, uint32_t flags)
+{
+	pci_conf_write(f, PCI_COMMAND_REG,
+		       pci_conf_read(f, PCI_COMMAND_REG) | flags);
+}
+
+// Find the first function on any bus for which match(f, arg) holds,
+// and fill in *f.  Returns 0 on success, -E_NOT_FOUND if none does.
+static int
+pci_scan(bool (*match)(struct PciFunc *, uint32_t), uint32_t arg,
+	 struct PciFunc *f)
+{
+	uint32_t hdr, i;
+
+	for (f->pf_bus = 0; f->pf_bus < 256; f->pf_bus++)
+		for (f->pf_dev = 0; f->pf_dev < 32; f->pf_dev++)
+			for (f->pf_func = 0; f->pf_func < 8; f->pf_func++) {
+				f->pf_id = pci_conf_read(f, PCI_ID_REG);
+				if ((f->pf_id & 0xFFFF) == 0xFFFF) {
+					if (f->pf_func == 0)
+						break;
+					continue;
+				}
+				f->pf_class = pci_conf_read(f, PCI_CLASS_REG);
+				hdr = pci_conf_read(f, PCI_HEADER_REG) >> 16;
+
+				if (match(f, arg)) {
+					for (i = 0; i < 6; i++)
+						f->pf_bar[i] = pci_conf_read(f, PCI_BAR0_REG + 4 * i);
+					f->pf_irq = pci_conf_read(f, PCI_INTR_REG) & 0xFF;
+					return 0;
+				}
+
+				// Single-function device?
+				if (f->pf_func == 0 && !(hdr & 0x80))
+					break;
+			}
+	return -E_NOT_FOUND;
+}
+
+static bool
+match_class(struct PciFunc *f, uint32_t class)
+{
+	return (f->pf_class >> 16) == class;
+}
+
+// Find the first function of class 'class' and subclass 'subclass'.
+int
+pci_find_class(uint8_t class, uint8_t subclass, struct PciFunc *f)
+{
+	return pci_scan(match_class, (class << 8) | subclass, f);
+}
+
+static bool
+match_id(struct PciFunc *f, uint32_t id)
+{
+	return f->pf_id == id;
+}
+
+// Find the first function with vendor ID 'vendor' and device ID 'device'.
+int
+pci_find_device(uint16_t vendor, uint16_t device, struct PciFunc *f)
+{
+	return pci_scan(match_id, ((uint32_t) device << 16) | vendor, f);
+}
@@ -28,59 +28,141 @@
 //    communicate with the server.  File IDs are a lot like
 //    environment IDs in the kernel.  Use openfile_lookup to translate
 //    file IDs to struct OpenFile.
+//
+// Clients close a file by unmapping its Fd page, without telling the
+// server, so an entry is free again once only the server maps the
+// page.  Entries known to be free wait on openfile_free; when it runs
+// out, or a client reaches OPENFILE_PERCLIENT, openfile_reclaim looks
+// for the entries clients have let go since it last did.
 
 struct OpenFile {
 	uint32_t o_fileid;	// file id
 	struct File *o_file;	// mapped descriptor for open file
 	int o_mode;		// open mode
 	struct Fd *o_fd;	// Fd page
+	struct Readahead o_ra;	// read-ahead state
+	envid_t o_envid;	// client that opened it
+	bool o_free;		// on openfile_free
+	struct OpenFile *o_next;	// next on openfile_free
 };
 
 // Max number of open files in the file system at once
 #define MAXOPEN		1024
+// and opened by one client (its forks share them), twice what lib/fd.c
+// lets an environment have
+#define OPENFILE_PERCLIENT	64
 #define FILEVA		0xD0000000
 
+// Each worker has its own addresses for the pages of a request, and
+// for the cache pages serve_readv and serve_read_map send.  The data
+// pages of an FSREQ_WRITEV follow the request page, so the windows
+// stop below the driver pages: a receive replaces whatever it lands on.
+#define FSREQVA(w)	(DRIVERVA - ((w) + 1) * (1 + FSV_MAXPAGES) * PGSIZE)
+#define READVVA(w)	(0xD0800000 + (w) * FSV_MAXPAGES * PGSIZE)
+
+// Workers after the first run on a stack and an exception stack of
+// their own, a page each with an unmapped page below.
+#define WORKERVA	0xD1000000
+#define WORKERSTACK(w)	(WORKERVA + (w) * 4 * PGSIZE + 2 * PGSIZE)
+#define WORKERXSTACK(w)	(WORKERVA + (w) * 4 * PGSIZE + 4 * PGSIZE)
+
 // initialize to force into data section
 struct OpenFile opentab[MAXOPEN] = {
 	{ 0, 0, 1, 0 }
 };
 
-// Virtual address at which to receive page mappings containing client requests.
-union Fsipc *fsreq = (union Fsipc *)0x0ffff000;
+static struct OpenFile *openfile_free;
+static uint32_t openfile_nfree;
+static uint16_t openfile_nclient[NENV];	// entries held, by ENVX of opener
+static uint32_t openfile_nsweeps, openfile_nrefused;
+
+static struct SysBatch serv_batch;
+static unsigned serv_lastwb;
+static uint32_t serv_nrequests;
 
 void
 serve_init(void)
 {
 	int i;
 	uintptr_t va = FILEVA;
-	for (i = 0; i < MAXOPEN; i++) {
+	// Lowest entries first, as the scan that came before handed out.
+	for (i = MAXOPEN - 1; i >= 0; i--) {
 		opentab[i].o_fileid = i;
-		opentab[i].o_fd = (struct Fd*) va;
-		va += PGSIZE;
+		opentab[i].o_fd = (struct Fd*) (va + i * PGSIZE);
+		opentab[i].o_free = 1;
+		opentab[i].o_next = openfile_free;
+		openfile_free = &opentab[i];
 	}
+	openfile_nfree = MAXOPEN;
+}
+
+// Put open file 'o', which no client maps, on the free list.
+static void
+openfile_release(struct OpenFile *o)
+{
+	openfile_nclient[ENVX(o->o_envid)]--;
+	o->o_free = 1;
+	o->o_next = openfile_free;
+	openfile_free = o;
+	openfile_nfree++;
+}
+
+// Free the entries whose clients have closed them (or exited).  Opens
+// run alone, so no entry is on its way to a client meanwhile.
+static void
+openfile_reclaim(void)
+{
+	int i;
+
+	openfile_nsweeps++;
+	for (i = 0; i < MAXOPEN; i++)
+		if (!opentab[i].o_free && pageref(opentab[i].o_fd) <= 1)
+			openfile_release(&opentab[i]);
 }
 
-// Allocate an open file.
+// Allocate an open file for client 'envid'.  Takes the first free
+// entry, looking for the ones clients let go only when there are none,
+// or envid has OPENFILE_PERCLIENT.  Returns its file ID, or
+// -E_MAX_OPEN if the table or envid's share of it is full.
 int
-openfile_alloc(struct OpenFile **o)
+openfile_alloc(envid_t envid, struct OpenFile **po)
 {
-	int i, r;
-
-	// Find an available open-file table entry
-	for (i = 0; i < MAXOPEN; i++) {
-		switch (pageref(opentab[i].o_fd)) {
-		case 0:
-			if ((r = sys_page_alloc(0, opentab[i].o_fd, PTE_P|PTE_U|PTE_W)) < 0)
-				return r;
-			/* fall through */
-		case 1:
-			opentab[i].o_fileid += MAXOPEN;
-			*o = &opentab[i];
-			memset(opentab[i].o_fd, 0, PGSIZE);
-			return (*o)->o_fileid;
-		}
+	struct OpenFile *o;
+	int r;
+
+	if (!openfile_free ||
+	    openfile_nclient[ENVX(envid)] >= OPENFILE_PERCLIENT)
+		openfile_reclaim();
+	if (openfile_nclient[ENVX(envid)] >= OPENFILE_PERCLIENT) {
+		openfile_nrefused++;
+		return -E_MAX_OPEN;
 	}
-	return -E_MAX_OPEN;
+	if (!(o = openfile_free))
+		return -E_MAX_OPEN;
+
+	if (pageref(o->o_fd) == 0 &&
+	    (r = sys_page_alloc(0, o->o_fd, PTE_P|PTE_U|PTE_W)) < 0)
+		return r;
+	openfile_free = o->o_next;
+	openfile_nfree--;
+	openfile_nclient[ENVX(envid)]++;
+	o->o_free = 0;
+	o->o_envid = envid;
+	o->o_fileid += MAXOPEN;
+	memset(o->o_fd, 0, PGSIZE);
+	memset(&o->o_ra, 0, sizeof(o->o_ra));
+	*po = o;
+	return o->o_fileid;
+}
+
+// Report on the open file table, and on the entries 'envid' holds.
+static void
+openfile_stats(envid_t envid, struct Fsret_stats *ret)
+{
+	ret->ret_of_free = openfile_nfree;
+	ret->ret_of_mine = openfile_nclient[ENVX(envid)];
+	ret->ret_of_sweeps = openfile_nsweeps;
+	ret->ret_of_refused = openfile_nrefused;
 }
 
 // Look up an open file for envid.
@@ -96,64 +178,53 @@ openfile_lookup(envid_t envid, uint32_t fileid, struct OpenFile **po)
 	return 0;
 }
 
-// Open req->req_path in mode req->req_omode, storing the Fd page and
-// permissions to return to the calling environment in *pg_store and
-// *perm_store respectively.
-int
-serve_open(envid_t envid, struct Fsreq_open *req,
-	   void **pg_store, int *perm_store)
+// Open 'path' in mode 'omode' for 'envid' and fill out its Fd page.
+// Sets *po to the open file.  Returns 0 on success, < 0 on error.
+static int
+openfile_open(envid_t envid, const char *path, int omode,
+	      struct OpenFile **po)
 {
-	char path[MAXPATHLEN];
 	struct File *f;
-	int fileid;
 	int r;
 	struct OpenFile *o;
 
-	if (debug)
-		cprintf("serve_open %08x %s 0x%x\n", envid, req->req_path, req->req_omode);
-
-	// Copy in the path, making sure it's null-terminated
-	memmove(path, req->req_path, MAXPATHLEN);
-	path[MAXPATHLEN-1] = 0;
-
 	// Find an open file ID
-	if ((r = openfile_alloc(&o)) < 0) {
+	if ((r = openfile_alloc(envid, &o)) < 0) {
 		if (debug)
 			cprintf("openfile_alloc failed: %e", r);
 		return r;
 	}
-	fileid = r;
 
 	// Open the file
-	if (req->req_omode & O_CREAT) {
+	if (omode & O_CREAT) {
 		if ((r = file_create(path, &f)) < 0) {
-			if (!(req->req_omode & O_EXCL) && r == -E_FILE_EXISTS)
+			if (!(omode & O_EXCL) && r == -E_FILE_EXISTS)
 				goto try_open;
 			if (debug)
 				cprintf("file_create failed: %e", r);
-			return r;
+			goto fail;
 		}
 	} else {
 try_open:
 		if ((r = file_open(path, &f)) < 0) {
 			if (debug)
 				cprintf("file_open failed: %e", r);
-			return r;
+			goto fail;
 		}
 	}
 
 	// Truncate
-	if (req->req_omode & O_TRUNC) {
+	if (omode & O_TRUNC) {
 		if ((r = file_set_size(f, 0)) < 0) {
 			if (debug)
 				cprintf("file_set_size failed: %e", r);
-			return r;
+			goto fail;
 		}
 	}
 	if ((r = file_open(path, &f)) < 0) {
 		if (debug)
 			cprintf("file_open failed: %e", r);
-		return r;
+		goto fail;
 	}
 
 	// Save the file pointer
@@ -161,9 +232,37 @@ try_open:
 
 	// Fill out the Fd structure
 	o->o_fd->fd_file.id = o->o_fileid;
-	o->o_fd->fd_omode = req->req_omode & O_ACCMODE;
+	o->o_fd->fd_omode = omode & O_ACCMODE;
 	o->o_fd->fd_dev_id = devfile.dev_id;
-	o->o_mode = req->req_omode;
+	o->o_mode = omode;
+	*po = o;
+	return 0;
+
+fail:
+	openfile_release(o);
+	return r;
+}
+
+// Open req->req_path in mode req->req_omode, storing the Fd page and
+// permissions to return to the calling environment in *pg_store and
+// *perm_store respectively.
+int
+serve_open(envid_t envid, struct Fsreq_open *req,
+	   void **pg_store, int *perm_store)
+{
+	char path[MAXPATHLEN];
+	struct OpenFile *o;
+	int r;
+
+	if (debug)
+		cprintf("serve_open %08x %s 0x%x\n", envid, req->req_path, req->req_omode);
+
+	// Copy in the path, making sure it's null-terminated
+	memmove(path, req->req_path, MAXPATHLEN);
+	path[MAXPATHLEN-1] = 0;
+
+	if ((r = openfile_open(envid, path, req->req_omode, &o)) < 0)
+		return r;
 
 	if (debug)
 		cprintf("sending success, page %08x\n", (uintptr_t) o->o_fd);
@@ -220,6 +319,9 @@ serve_read(envid_t envid, union Fsipc *ipc)
     if ( (r = openfile_lookup(envid, req->req_fileid, &openfile)) < 0)
         return r;
 
+    file_readahead(openfile->o_file, &openfile->o_ra,
+                   openfile->o_fd->fd_offset, MIN(req->req_n, PGSIZE));
+
     if ( (count = file_read(openfile->o_file,
                     ret->ret_buf,
                     MIN(ipc->read.req_n, PGSIZE),
@@ -231,6 +333,118 @@ serve_read(envid_t envid, union Fsipc *ipc)
 	return count;
 }
 
+// Share the cache page holding req->req_offset of req->req_fileid with
+// the caller, read-only, instead of copying it (file_read_map).  The
+// page is mapped at 'dstva', since another worker may evict it from the
+// cache before the reply goes out; set *pg_store to that and
+// *perm_store to its permissions.  The seek position is the client's to update.  Returns
+// the number of the page's bytes that are in the file (0, and no page,
+// at the end), or < 0 on error.
+int
+serve_read_map(envid_t envid, struct Fsreq_read_map *req, void *dstva,
+	       void **pg_store, int *perm_store)
+{
+	struct OpenFile *o;
+	int n, r;
+
+	if (debug)
+		cprintf("serve_read_map %08x %08x %08x\n", envid,
+			req->req_fileid, req->req_offset);
+
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+		return r;
+	file_readahead(o->o_file, &o->o_ra, req->req_offset, PGSIZE);
+	if ((n = file_read_map(o->o_file, req->req_offset, dstva)) <= 0)
+		return n;
+	*pg_store = dstva;
+	*perm_store = PTE_P | PTE_U;
+	return n;
+}
+
+// Unmap 'npages' pages from 'va' on.
+static void
+serve_unmap(void *va, size_t npages)
+{
+	size_t i;
+	int r;
+
+	for (i = 0; i < npages; i++)
+		sysbatch_add(&serv_batch, SYS_page_unmap, 0,
+			     (uint32_t) va + i * PGSIZE, 0, 0, 0);
+	if ((r = sysbatch_flush(&serv_batch)) < 0)
+		panic("serve: unmap: %e", r);
+}
+
+// Send the cache pages holding bytes [req->req_offset,
+// req->req_offset + req->req_n) of req->req_fileid, stopping at the end
+// of the file or after FSV_MAXPAGES pages.  They are gathered at
+// 'dstva', read-only and, but for an inline file's, not copied; set
+// *pg_store, *npages_store and *perm_store to describe them.  The first
+// page holds the one at the offset rounded down to a page.  The seek position is the client's to
+// update.  Returns the number of bytes sent from req->req_offset on.
+int
+serve_readv(envid_t envid, struct Fsreq_readv *req, void *dstva,
+	    void **pg_store, size_t *npages_store, int *perm_store)
+{
+	struct OpenFile *o;
+	off_t start, end;
+	uint32_t i, n;
+	int r;
+
+	if (debug)
+		cprintf("serve_readv %08x %08x %08x %08x\n", envid,
+			req->req_fileid, req->req_offset, req->req_n);
+
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+		return r;
+	if (req->req_offset < 0)
+		return -E_INVAL;
+	start = ROUNDDOWN(req->req_offset, PGSIZE);
+	end = MIN(o->o_file->f_size, req->req_offset +
+		  MIN(req->req_n, FSV_MAXPAGES * PGSIZE - PGOFF(start)));
+	if (end <= req->req_offset)
+		return 0;
+	n = MIN(ROUNDUP(end - start, PGSIZE) / PGSIZE, FSV_MAXPAGES);
+
+	file_readahead(o->o_file, &o->o_ra, req->req_offset,
+		       end - req->req_offset);
+
+	// Map each page as soon as it's found: finding the next one may
+	// evict it from the cache.
+	for (i = 0; i < n; i++)
+		if ((r = file_read_map(o->o_file, start + i * PGSIZE,
+				       (char *) dstva + i * PGSIZE)) < 0) {
+			serve_unmap(dstva, i);
+			return r;
+		}
+	*pg_store = dstva;
+	*npages_store = n;
+	*perm_store = PTE_P | PTE_U;
+	return end - req->req_offset;
+}
+
+// Write req->req_n bytes from the 'npages' pages after the request to
+// req->req_fileid at the current seek position, as serve_write does.
+int
+serve_writev(envid_t envid, struct Fsreq_writev *req, size_t npages)
+{
+	struct OpenFile *o;
+	int r;
+
+	if (debug)
+		cprintf("serve_writev %08x %08x %08x\n", envid,
+			req->req_fileid, req->req_n);
+
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+		return r;
+	if (req->req_n > npages * PGSIZE)
+		return -E_INVAL;
+	if ((r = file_write(o->o_file, (char *) req + PGSIZE, req->req_n,
+			    o->o_fd->fd_offset)) < 0)
+		return r;
+	o->o_fd->fd_offset += r;
+	return r;
+}
 
 // Write req->req_n bytes from req->req_buf to req_fileid, starting at
 // the current seek position, and update the seek position
@@ -300,6 +514,22 @@ serve_flush(envid_t envid, struct Fsreq_flush *req)
 	return 0;
 }
 
+// Reserve the blocks of req->req_fileid from req->req_offset for
+// req->req_len bytes, so writes there won't need to allocate.
+int
+serve_fallocate(envid_t envid, struct Fsreq_fallocate *req)
+{
+	struct OpenFile *o;
+	int r;
+
+	if (debug)
+		cprintf("serve_fallocate %08x %08x %d %d\n", envid,
+			req->req_fileid, req->req_offset, req->req_len);
+
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+		return r;
+	return file_allocate(o->o_file, req->req_offset, req->req_len);
+}
 
 int
 serve_sync(envid_t envid, union Fsipc *req)
@@ -308,30 +538,280 @@ serve_sync(envid_t envid, union Fsipc *req)
 	return 0;
 }
 
+// Set the block cache capacity if req->req_bc_capacity is nonzero,
+// the disk scheduler if req->req_bio_sched is, and turn the path
+// lookup cache on or off if req->req_dcache is.  Then report the
+// caches' and the disk queue's statistics.
+int
+serve_stats(envid_t envid, union Fsipc *ipc)
+{
+	struct Fsreq_stats *req = &ipc->stats;
+	int r;
+
+	if (debug)
+		cprintf("serve_stats %08x %d %d %d\n", envid,
+			req->req_bc_capacity, req->req_bio_sched,
+			req->req_dcache);
+
+	if (req->req_bc_capacity &&
+	    (r = bc_set_capacity(req->req_bc_capacity)) < 0)
+		return r;
+	if (req->req_bio_sched && (r = bio_set_sched(req->req_bio_sched)) < 0)
+		return r;
+	if (req->req_dcache && (r = dcache_set(req->req_dcache)) < 0)
+		return r;
+	bc_stats(&ipc->statsRet);
+	bio_stats(&ipc->statsRet);
+	dcache_stats(&ipc->statsRet);
+	ipc->statsRet.ret_fs_requests = serv_nrequests;
+	ipc->statsRet.ret_fs_nfree = super->s_nfree;
+	openfile_stats(envid, &ipc->statsRet);
+	return 0;
+}
+
+// Queue reads of the blocks of req->req_fileid holding
+// req->req_offsets[0..req->req_n-1].  They run after the reply.
+int
+serve_prefetch(envid_t envid, union Fsipc *ipc)
+{
+	struct Fsreq_prefetch *req = &ipc->prefetch;
+	struct OpenFile *o;
+	uint32_t i;
+	int r;
+
+	if (debug)
+		cprintf("serve_prefetch %08x %08x %d\n", envid, req->req_fileid,
+			req->req_n);
+
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+		return r;
+	if (req->req_n > sizeof(req->req_offsets) / sizeof(off_t))
+		return -E_INVAL;
+	for (i = 0; i < req->req_n; i++)
+		file_prefetch(o->o_file, req->req_offsets[i]);
+	return 0;
+}
+
+// Run the steps of a compound request in order, stopping at the first
+// that fails, and set each step's op_ret.  The Fd page of an FSOP_OPEN
+// goes back in *pg_store if every step succeeded; otherwise, and for an
+// FSOP_OPEN_TEMP, the entry is freed straight away.  Returns the number
+// of steps that succeeded.
+static int
+serve_compound(envid_t envid, struct Fsreq_compound *req,
+	       void **pg_store, int *perm_store)
+{
+	struct OpenFile *opened[FSC_MAXOPS], *o, *keep, *temp;
+	struct Fsret_stat *st;
+	char path[MAXPATHLEN];
+	struct Fsop *op;
+	uint32_t i, nops, room;
+	bool didopen;
+	int r;
+
+	if (debug)
+		cprintf("serve_compound %08x %d\n", envid, req->req_nops);
+
+	nops = MIN(req->req_nops, FSC_MAXOPS);
+	keep = temp = NULL;
+	didopen = 0;
+	for (i = 0; i < nops; i++) {
+		op = &req->req_ops[i];
+		opened[i] = NULL;
+		// Every step has at least a byte of req_buf: a path needs
+		// room for its terminating NUL.
+		if (op->op_buf >= sizeof(req->req_buf)) {
+			r = -E_INVAL;
+			goto fail;
+		}
+		room = sizeof(req->req_buf) - op->op_buf;
+
+		if (op->op_type == FSOP_OPEN || op->op_type == FSOP_OPEN_TEMP) {
+			// Until the reply, nothing else maps the Fd page, so
+			// a second open could be handed the same entry.
+			if (didopen) {
+				r = -E_INVAL;
+				goto fail;
+			}
+			didopen = 1;
+			memmove(path, req->req_buf + op->op_buf,
+				MIN(room, MAXPATHLEN));
+			path[MIN(room, MAXPATHLEN) - 1] = 0;
+			if ((r = openfile_open(envid, path, op->op_arg, &o)) < 0)
+				goto fail;
+			opened[i] = o;
+			if (op->op_type == FSOP_OPEN)
+				keep = o;
+			else
+				temp = o;
+			op->op_ret = o->o_fileid;
+			continue;
+		}
+
+		if (op->op_step == 0)
+			r = openfile_lookup(envid, op->op_fileid, &o);
+		else if (op->op_step <= i && opened[op->op_step - 1])
+			o = opened[op->op_step - 1], r = 0;
+		else
+			r = -E_INVAL;
+		if (r < 0)
+			goto fail;
+
+		switch (op->op_type) {
+		case FSOP_STAT:
+			if (room < sizeof(*st)) {
+				r = -E_INVAL;
+				goto fail;
+			}
+			st = (struct Fsret_stat *) (req->req_buf + op->op_buf);
+			strcpy(st->ret_name, o->o_file->f_name);
+			st->ret_size = o->o_file->f_size;
+			st->ret_isdir = (o->o_file->f_type == FTYPE_DIR);
+			r = 0;
+			break;
+		case FSOP_READ:
+			r = file_read(o->o_file, req->req_buf + op->op_buf,
+				      MIN(op->op_arg, room), op->op_offset);
+			break;
+		default:
+			r = -E_INVAL;
+		}
+		if (r < 0)
+			goto fail;
+		op->op_ret = r;
+	}
+
+	if (keep) {
+		*pg_store = keep->o_fd;
+		*perm_store = PTE_P|PTE_U|PTE_W|PTE_SHARE;
+	}
+	if (temp)
+		openfile_release(temp);
+	return nops;
+
+fail:
+	if (keep)
+		openfile_release(keep);
+	if (temp)
+		openfile_release(temp);
+	op->op_ret = r;
+	return i;
+}
+
 typedef int (*fshandler)(envid_t envid, union Fsipc *req);
 
 fshandler handlers[] = {
-	// Open is handled specially because it passes pages
+	// Open, read map, readv, writev and compound are handled specially
+	// because they pass pages
 	/* [FSREQ_OPEN] =	(fshandler)serve_open, */
+	/* [FSREQ_READ_MAP] =	(fshandler)serve_read_map, */
+	/* [FSREQ_READV] =	(fshandler)serve_readv, */
+	/* [FSREQ_WRITEV] =	(fshandler)serve_writev, */
+	/* [FSREQ_COMPOUND] =	(fshandler)serve_compound, */
 	[FSREQ_READ] =		serve_read,
 	[FSREQ_STAT] =		serve_stat,
 	[FSREQ_FLUSH] =		(fshandler)serve_flush,
 	[FSREQ_WRITE] =		(fshandler)serve_write,
 	[FSREQ_SET_SIZE] =	(fshandler)serve_set_size,
-	[FSREQ_SYNC] =		serve_sync
+	[FSREQ_SYNC] =		serve_sync,
+	[FSREQ_STATS] =		serve_stats,
+	[FSREQ_PREFETCH] =	serve_prefetch,
+	[FSREQ_FALLOCATE] =	(fshandler)serve_fallocate
 };
 #define NHANDLERS (sizeof(handlers)/sizeof(handlers[0]))
 
-void
-serve(void)
+// Can a request run alongside others?  Those that only read the file
+// system can: they may find blocks read in or evicted under them, but
+// never changed.  Opening changes the open file table too.
+static bool
+serve_shared(uint32_t req)
 {
-	uint32_t req, whom;
+	return req == FSREQ_READ || req == FSREQ_READ_MAP ||
+		req == FSREQ_READV || req == FSREQ_STAT ||
+		req == FSREQ_PREFETCH;
+}
+
+// Receive a request at 'fsreq' for the worker whose Env is 'me'.  Like
+// ipc_recv_pages, which can't be used here: thisenv is the first
+// worker's.
+static uint32_t
+serve_recv(const volatile struct Env *me, union Fsipc *fsreq,
+	   size_t *npages, envid_t *whom, int *perm)
+{
+	if (sys_ipc_recv(fsreq, *npages) < 0) {
+		*npages = *whom = *perm = 0;
+		return 0;
+	}
+	*npages = me->env_ipc_npages;
+	*whom = me->env_ipc_from;
+	*perm = me->env_ipc_perm;
+	return me->env_ipc_value;
+}
+
+// Serve request 'req' from 'whom', whose request is 'nreq' pages at
+// 'fsreq'.  *pg_store, *npages_store and *perm_store get the pages to
+// send back with the reply, if any; 'readvva' is where FSREQ_READV and
+// FSREQ_READ_MAP put the cache pages they send.
+static int
+serve_dispatch(envid_t whom, uint32_t req, union Fsipc *fsreq, size_t nreq,
+	       void *readvva, void **pg_store, size_t *npages_store,
+	       int *perm_store)
+{
+	*pg_store = NULL;
+	*npages_store = 1;
+	if (req == FSREQ_OPEN)
+		return serve_open(whom, (struct Fsreq_open*)fsreq, pg_store,
+				  perm_store);
+	if (req == FSREQ_READ_MAP)
+		return serve_read_map(whom, &fsreq->read_map, readvva,
+				      pg_store, perm_store);
+	if (req == FSREQ_READV)
+		return serve_readv(whom, &fsreq->readv, readvva, pg_store,
+				   npages_store, perm_store);
+	if (req == FSREQ_WRITEV)
+		return serve_writev(whom, &fsreq->writev, nreq - 1);
+	if (req == FSREQ_COMPOUND)
+		return serve_compound(whom, &fsreq->compound, pg_store,
+				      perm_store);
+	if (req < NHANDLERS && handlers[req])
+		return handlers[req](whom, fsreq);
+	cprintf("Invalid request code %d from %08x\n", req, whom);
+	return -E_INVAL;
+}
+
+// Start a request, alone if 'excl'.  One that changes the file system
+// starts with room in the journal's running transaction, which doesn't
+// commit until it is done.
+static void
+serve_begin(bool excl)
+{
+	fs_begin(excl);
+	if (excl && journal_full())
+		journal_commit();
+}
+
+// Serve requests forever as worker 'w'.  Each runs under fs_lock, let
+// go while waiting for the client or the disk, and alone if it changes
+// the file system.  The disk requests it queued run, and the journal and
+// dirty blocks go out every so often, after the client has its reply.
+static void
+serve(int w)
+{
+	const volatile struct Env *me = &envs[ENVX(sys_getenvid())];
+	union Fsipc *fsreq = (union Fsipc *) FSREQVA(w);
+	void *readvva = (void *) READVVA(w);
+	envid_t whom;
+	uint32_t req;
 	int perm, r;
 	void *pg;
+	size_t nreq, npg;
+	struct Fsreq_read saved;
+	bool excl;
+	unsigned now;
 
 	while (1) {
-		perm = 0;
-		req = ipc_recv((int32_t *) &whom, fsreq, &perm);
+		nreq = 1 + FSV_MAXPAGES;
+		req = serve_recv(me, fsreq, &nreq, &whom, &perm);
 		if (debug)
 			cprintf("fs req %d from %08x [page %08x: %s]\n",
 				req, whom, uvpt[PGNUM(fsreq)], fsreq);
@@ -343,17 +823,83 @@ serve(void)
 			continue; // just leave it hanging...
 		}
 
-		pg = NULL;
-		if (req == FSREQ_OPEN) {
-			r = serve_open(whom, (struct Fsreq_open*)fsreq, &pg, &perm);
-		} else if (req < NHANDLERS && handlers[req]) {
-			r = handlers[req](whom, fsreq);
-		} else {
-			cprintf("Invalid request code %d from %08x\n", req, whom);
-			r = -E_INVAL;
+		fs_lock();
+		serv_nrequests++;
+		excl = !serve_shared(req);
+		serve_begin(excl);
+
+		// A shared request that would allocate a block, to read a
+		// hole, gives up and runs again alone.  serve_read overwrites
+		// its request with the data, so keep that.
+		saved = fsreq->read;
+		r = serve_dispatch(whom, req, fsreq, nreq, readvva,
+				   &pg, &npg, &perm);
+		if (r == -E_AGAIN && !excl) {
+			fs_end(0);
+			excl = 1;
+			serve_begin(1);
+			fsreq->read = saved;
+			r = serve_dispatch(whom, req, fsreq, nreq, readvva,
+					   &pg, &npg, &perm);
 		}
-		ipc_send(whom, r, pg, perm);
-		sys_page_unmap(0, fsreq);
+
+		fs_unlock();
+		ipc_send_pages(whom, r, pg, npg, perm);
+		fs_lock();
+
+		serve_unmap(fsreq, nreq);
+		if (pg == readvva)
+			serve_unmap(pg, npg);
+
+		// Run the disk requests this one queued.
+		bio_run();
+		fs_end(excl);
+
+		// Commit the journal and write back dirty blocks every so
+		// often.
+		now = sys_time_msec();
+		if (now - serv_lastwb >= BC_WRITEBACK_MS || journal_full()) {
+			fs_begin(1);
+			if (now - serv_lastwb >= BC_WRITEBACK_MS) {
+				journal_commit();
+				bc_writeback();
+				serv_lastwb = now;
+			} else if (journal_full())
+				journal_commit();
+			bio_run();
+			fs_end(1);
+		}
+		fs_unlock();
+	}
+}
+
+// Start workers 1 through FS_NWORKERS-1, sharing our address space.
+static void
+serve_start(void)
+{
+	uintptr_t *sp;
+	envid_t envid;
+	int w, r;
+
+	static_assert(FS_NWORKERS >= 1 && FS_NWORKERS <= FS_MAXWORKERS);
+	static_assert(READVVA(FS_MAXWORKERS) <= WORKERVA);
+	static_assert(FSREQVA(0) + (1 + FSV_MAXPAGES) * PGSIZE <= DRIVERVA);
+	for (w = 1; w < FS_NWORKERS; w++) {
+		if ((r = sys_page_alloc(0, (void *) (WORKERSTACK(w) - PGSIZE),
+					PTE_P | PTE_U | PTE_W)) < 0 ||
+		    (r = sys_page_alloc(0, (void *) (WORKERXSTACK(w) - PGSIZE),
+					PTE_P | PTE_U | PTE_W)) < 0)
+			panic("serve_start: %e", r);
+
+		// Call serve(w), with a return address that faults.
+		sp = (uintptr_t *) WORKERSTACK(w);
+		*--sp = w;
+		*--sp = 0;
+		if ((envid = sys_thread_create((void *) serve, sp,
+					       (void *) WORKERXSTACK(w))) < 0)
+			panic("serve_start: %e", envid);
+		if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+			panic("serve_start: %e", r);
 	}
 }
 
@@ -368,9 +914,14 @@ umain(int argc, char **argv)
 	outw(0x8A00, 0x8A00);
 	cprintf("FS can do I/O\n");
 
+	fs_lock();
 	serve_init();
 	fs_init();
         fs_test();
-	serve();
-}
+	serv_lastwb = sys_time_msec();
+	fs_unlock();
 
+	serve_start();
+	cprintf("FS has %d workers\n", FS_NWORKERS);
+	serve(0);
+}
@@ -11,13 +11,14 @@ fs_test(void)
   struct File *f;
   int r;
   char *blk;
-  uint32_t *bits;
+  uint32_t *bits, nfree, fblock;
 
   // back up bitmap
   if ((r = sys_page_alloc(0, (void*)PGSIZE, PTE_P|PTE_U|PTE_W)) < 0)
     panic("sys_page_alloc: %e", r);
   bits = (uint32_t*)PGSIZE;
   memmove(bits, bitmap, PGSIZE);
+  nfree = super->s_nfree;
   // allocate block
   if ((r = alloc_block()) < 0)
     panic("alloc_block: %e", r);
@@ -25,6 +26,8 @@ fs_test(void)
   assert(bits[r/32] & (1 << (r%32)));
   // and is not free any more
   assert(!(bitmap[r/32] & (1 << (r%32))));
+  // and was counted
+  assert(super->s_nfree == nfree - 1);
   cprintf("alloc_block is good\n");
 
   if ((r = file_open("/not-found", &f)) < 0 && r != -E_NOT_FOUND)
@@ -47,21 +50,23 @@ fs_test(void)
   assert(!(uvpt[PGNUM(blk)] & PTE_D));
   cprintf("file_flush is good\n");
 
+  // Metadata changes go into the journal, not straight to disk.
+  fblock = ((uint32_t) f - DISKMAP) / BLKSIZE;
   if ((r = file_set_size(f, 0)) < 0)
     panic("file_set_size: %e", r);
-  assert(f->f_direct[0] == 0);
-  assert(!(uvpt[PGNUM(f)] & PTE_D));
+  assert(f->f_nextent == 0 && f->f_direct[0] == 0);
+  assert(journal_running(fblock));
   cprintf("file_truncate is good\n");
 
   if ((r = file_set_size(f, strlen(msg))) < 0)
     panic("file_set_size 2: %e", r);
-  assert(!(uvpt[PGNUM(f)] & PTE_D));
+  assert(journal_running(fblock));
   if ((r = file_get_block(f, 0, &blk)) < 0)
     panic("file_get_block 2: %e", r);
   strcpy(blk, msg);
   assert((uvpt[PGNUM(blk)] & PTE_D));
   file_flush(f);
   assert(!(uvpt[PGNUM(blk)] & PTE_D));
-  assert(!(uvpt[PGNUM(f)] & PTE_D));
+  assert(!journal_running(fblock) && journal_holds(fblock));
   cprintf("file rewrite is good\n");
 }
@@ -0,0 +1,404 @@
+/*
+ * Legacy PCI virtio-blk driver.  One virtqueue carries up to VB_NREQ
+ * requests at once: a write returns as soon as it is queued, and a read
+ * waits only for itself.  The file server sleeps on the device's PCI
+ * interrupt, the way fs/ide.c sleeps on IRQ 14.
+ * See the "Virtio PCI Card Specification" v0.9.5 for the register and
+ * virtqueue layout.
+ */
+
+#include "fs.h"
+#include <inc/x86.h>
+
+#define VIRTIO_VENDOR		0x1AF4
+#define VIRTIO_BLK_DEVICE	0x1001	// transitional block device
+
+// Legacy virtio registers, relative to the I/O BAR
+#define VIRTIO_HOST_FEATURES	0
+#define VIRTIO_GUEST_FEATURES	4
+#define VIRTIO_QUEUE_PFN	8
+#define VIRTIO_QUEUE_SIZE	12
+#define VIRTIO_QUEUE_SEL	14
+#define VIRTIO_QUEUE_NOTIFY	16
+#define VIRTIO_STATUS		18
+#define VIRTIO_ISR		19
+#define VIRTIO_BLK_CAPACITY	20	// 64 bits, in sectors
+
+#define VIRTIO_ST_ACK		0x01
+#define VIRTIO_ST_DRIVER	0x02
+#define VIRTIO_ST_DRIVER_OK	0x04
+#define VIRTIO_ST_FAILED	0x80
+
+// Virtqueue layout: descriptors, then the available ring, then (on the
+// next page) the used ring, all physically contiguous.
+struct VringDesc {
+	uint64_t d_addr;
+	uint32_t d_len;
+	uint16_t d_flags;
+	uint16_t d_next;
+};
+#define VRING_DESC_NEXT		0x1
+#define VRING_DESC_WRITE	0x2	// the device writes this buffer
+
+struct VringAvail {
+	uint16_t a_flags;
+	uint16_t a_idx;
+	uint16_t a_ring[];
+};
+
+struct VringUsed {
+	uint16_t u_flags;
+	uint16_t u_idx;
+	struct {
+		uint32_t ue_id;		// head of the finished descriptor chain
+		uint32_t ue_len;
+	} u_ring[];
+};
+
+// Each request is a header, the data, and a status byte.
+struct VirtioBlkHdr {
+	uint32_t h_type;
+	uint32_t h_ioprio;
+	uint64_t h_sector;
+};
+#define VIRTIO_BLK_T_IN		0
+#define VIRTIO_BLK_T_OUT	1
+#define VIRTIO_BLK_S_OK		0
+
+// Where the virtqueue and the request headers live in the file server,
+// among the driver pages below DISKMAP
+#define VIRTIO_VQVA		0x0ffe0000
+#define VQ_MAXPAGES		16
+#define VIRTIO_HDRVA		0x0fffd000
+
+#define VB_NREQ			8	// requests in flight at once
+// Data descriptors one request can need: 256 sectors, page by page,
+// plus one if the buffer isn't page-aligned.
+#define VB_MAXSEGS		(256 * SECTSIZE / PGSIZE + 1)
+
+// How long to sleep before checking on the device anyway
+#define VB_TIMEOUT_MS		100
+
+// The part of each request the device reads and writes
+struct VbSlot {
+	struct VirtioBlkHdr s_hdr;
+	uint8_t s_status;
+	uint8_t s_pad[15];
+};
+
+// The driver's bookkeeping for each request
+static struct VbReq {
+	bool r_busy;		// submitted and not yet collected
+	bool r_done;		// the device has finished it
+	bool r_write;
+	uint16_t r_head;	// first descriptor
+	uint32_t r_secno, r_nsecs;
+} vb_reqs[VB_NREQ];
+
+static uint16_t vb_base;		// I/O ports, 0 if no device
+static uint16_t vq_size;		// descriptors in the queue
+static volatile struct VringDesc *vq_desc;
+static volatile struct VringAvail *vq_avail;
+static volatile struct VringUsed *vq_used;
+static uint16_t vq_free;		// free descriptors, chained by d_next
+static uint16_t vq_nfree;
+static uint16_t vq_last_used;		// next used ring entry to reap
+static volatile struct VbSlot *vb_slots = (struct VbSlot *) VIRTIO_HDRVA;
+static uint32_t vb_slots_pa;
+static volatile uint32_t vb_irqs;	// interrupt count, kept by the kernel
+static bool vb_polling;			// no interrupt: just yield
+static int vb_error;			// a queued write failed
+
+// Keep the compiler from reordering ring accesses; x86 doesn't.
+#define vb_barrier()	__asm __volatile("" : : : "memory")
+
+// Find the legacy virtio-blk device and set up its queue.
+// Returns 0 on success, < 0 if there's no usable device.
+int
+virtio_blk_init(void)
+{
+	struct PciFunc f;
+	uint32_t avail_off, used_off, npages, i;
+	uint64_t capacity;
+	int r;
+
+	if (pci_find_device(VIRTIO_VENDOR, VIRTIO_BLK_DEVICE, &f) < 0 ||
+	    !(f.pf_bar[0] & 1))
+		return -E_NOT_FOUND;
+
+	pci_enable(&f, PCI_COMMAND_IO | PCI_COMMAND_MASTER);
+	vb_base = f.pf_bar[0] & ~3;
+
+	// Reset, then tell the device we know how to drive it.  We need
+	// none of the optional features.
+	outb(vb_base + VIRTIO_STATUS, 0);
+	outb(vb_base + VIRTIO_STATUS, VIRTIO_ST_ACK);
+	outb(vb_base + VIRTIO_STATUS, VIRTIO_ST_ACK | VIRTIO_ST_DRIVER);
+	outl(vb_base + VIRTIO_GUEST_FEATURES, 0);
+
+	// A legacy device fixes the queue size; the driver just lays it out.
+	outw(vb_base + VIRTIO_QUEUE_SEL, 0);
+	vq_size = inw(vb_base + VIRTIO_QUEUE_SIZE);
+	avail_off = vq_size * sizeof(struct VringDesc);
+	used_off = ROUNDUP(avail_off + 6 + 2 * vq_size, PGSIZE);
+	npages = (used_off + ROUNDUP(6 + 8 * vq_size, PGSIZE)) / PGSIZE;
+	if (vq_size < VB_MAXSEGS + 2 || npages > VQ_MAXPAGES) {
+		cprintf("virtio-blk: can't use a queue of %d\n", vq_size);
+		goto fail;
+	}
+
+	static_assert(VIRTIO_VQVA >= DRIVERVA &&
+		      VIRTIO_VQVA + VQ_MAXPAGES * PGSIZE <= VIRTIO_HDRVA &&
+		      VIRTIO_HDRVA < DISKMAP);
+	if ((r = sys_page_alloc_contig((void *) VIRTIO_VQVA, npages,
+				       PTE_P|PTE_U|PTE_W)) < 0 ||
+	    (r = sys_page_alloc(0, (void *) VIRTIO_HDRVA,
+				PTE_P|PTE_U|PTE_W)) < 0 ||
+	    (r = sys_page_paddr((void *) VIRTIO_HDRVA)) < 0)
+		panic("virtio_blk_init: %e", r);
+	vb_slots_pa = r;
+	if ((r = sys_page_paddr((void *) VIRTIO_VQVA)) < 0)
+		panic("virtio_blk_init: %e", r);
+	outl(vb_base + VIRTIO_QUEUE_PFN, r >> PGSHIFT);
+
+	vq_desc = (struct VringDesc *) VIRTIO_VQVA;
+	vq_avail = (struct VringAvail *) (VIRTIO_VQVA + avail_off);
+	vq_used = (struct VringUsed *) (VIRTIO_VQVA + used_off);
+	for (i = 0; i < vq_size; i++)
+		vq_desc[i].d_next = i + 1;
+	vq_free = 0;
+	vq_nfree = vq_size;
+	vq_last_used = 0;
+
+	if ((r = sys_irq_listen(f.pf_irq, &vb_irqs)) < 0) {
+		cprintf("virtio-blk: can't listen for irq %d (%e), polling\n",
+			f.pf_irq, r);
+		vb_polling = 1;
+	}
+
+	outb(vb_base + VIRTIO_STATUS,
+	     VIRTIO_ST_ACK | VIRTIO_ST_DRIVER | VIRTIO_ST_DRIVER_OK);
+
+	capacity = inl(vb_base + VIRTIO_BLK_CAPACITY) |
+		((uint64_t) inl(vb_base + VIRTIO_BLK_CAPACITY + 4) << 32);
+	cprintf("virtio-blk: %u sectors, queue of %d, port %x, irq %d\n",
+		(uint32_t) capacity, vq_size, vb_base, f.pf_irq);
+	return 0;
+
+fail:
+	outb(vb_base + VIRTIO_STATUS, VIRTIO_ST_FAILED);
+	vb_base = 0;
+	return -E_NOT_FOUND;
+}
+
+// Collect the requests the device has finished.  Returns how many.
+static int
+vb_reap(void)
+{
+	struct VbReq *req;
+	uint16_t head, d;
+	int n;
+
+	// Reading the ISR acknowledges the interrupt.
+	inb(vb_base + VIRTIO_ISR);
+
+	for (n = 0; vq_last_used != vq_used->u_idx; n++) {
+		vb_barrier();
+		head = vq_used->u_ring[vq_last_used % vq_size].ue_id;
+		vq_last_used++;
+
+		for (req = vb_reqs; req < vb_reqs + VB_NREQ; req++)
+			if (req->r_busy && !req->r_done && req->r_head == head)
+				break;
+		if (req == vb_reqs + VB_NREQ)
+			panic("virtio-blk: device finished unknown request %d",
+			      head);
+
+		// Give the chain back to the free list.
+		for (d = head; vq_desc[d].d_flags & VRING_DESC_NEXT;
+		     d = vq_desc[d].d_next)
+			vq_nfree++;
+		vq_desc[d].d_next = vq_free;
+		vq_free = head;
+		vq_nfree++;
+
+		// Nobody waits for a write: it is done with once finished.
+		if (req->r_write) {
+			if (vb_slots[req - vb_reqs].s_status != VIRTIO_BLK_S_OK)
+				vb_error = -1;
+			req->r_busy = 0;
+		} else
+			req->r_done = 1;
+	}
+	return n;
+}
+
+// Wait for the device to finish at least one request.
+static void
+vb_wait(void)
+{
+	uint32_t seen;
+
+	// Read the interrupt count before reaping, so an interrupt in
+	// between makes sys_chan_sleep return at once.
+	for (;;) {
+		seen = vb_irqs;
+		if (vb_reap() > 0)
+			return;
+		if (vb_polling)
+			sys_yield();
+		else
+			sys_chan_sleep(&vb_irqs, seen, (void *) UTOP,
+				       VB_TIMEOUT_MS);
+	}
+}
+
+static uint16_t
+vq_alloc_desc(void)
+{
+	uint16_t d = vq_free;
+
+	vq_free = vq_desc[d].d_next;
+	vq_nfree--;
+	return d;
+}
+
+// Queue a request to move 'nsecs' sectors between the disk at 'secno'
+// and the memory at 'va', which must stay mapped until it is finished.
+// Returns the request, or < 0 on error.
+static int
+vb_submit(uint32_t secno, const void *va, size_t nsecs, bool write)
+{
+	struct VbReq *req;
+	volatile struct VbSlot *slot;
+	uintptr_t p, end;
+	uint16_t d, prev;
+	uint32_t len;
+	int pa;
+
+	assert(nsecs <= 256);
+
+	// Wait for a free request and enough descriptors.
+	for (;;) {
+		for (req = vb_reqs; req < vb_reqs + VB_NREQ; req++)
+			if (!req->r_busy)
+				break;
+		if (req < vb_reqs + VB_NREQ && vq_nfree >= VB_MAXSEGS + 2)
+			break;
+		vb_wait();
+	}
+	slot = &vb_slots[req - vb_reqs];
+	slot->s_hdr.h_type = write ? VIRTIO_BLK_T_OUT : VIRTIO_BLK_T_IN;
+	slot->s_hdr.h_ioprio = 0;
+	slot->s_hdr.h_sector = secno;
+	slot->s_status = 0xFF;
+
+	req->r_head = prev = vq_alloc_desc();
+	vq_desc[prev].d_addr = vb_slots_pa + PGOFF(&slot->s_hdr);
+	vq_desc[prev].d_len = sizeof(slot->s_hdr);
+	vq_desc[prev].d_flags = VRING_DESC_NEXT;
+
+	// One descriptor per page of data: the pages needn't be
+	// contiguous in physical memory.
+	end = (uintptr_t) va + nsecs * SECTSIZE;
+	for (p = (uintptr_t) va; p < end; p += len) {
+		len = MIN(end - p, PGSIZE - PGOFF(p));
+		if ((pa = sys_page_paddr((void *) ROUNDDOWN(p, PGSIZE))) < 0)
+			panic("virtio-blk: buffer %08x not mapped", p);
+		d = vq_alloc_desc();
+		vq_desc[d].d_addr = pa + PGOFF(p);
+		vq_desc[d].d_len = len;
+		vq_desc[d].d_flags = VRING_DESC_NEXT | (write ? 0 : VRING_DESC_WRITE);
+		vq_desc[prev].d_next = d;
+		prev = d;
+	}
+
+	d = vq_alloc_desc();
+	vq_desc[d].d_addr = vb_slots_pa + PGOFF(&slot->s_status);
+	vq_desc[d].d_len = 1;
+	vq_desc[d].d_flags = VRING_DESC_WRITE;
+	vq_desc[prev].d_next = d;
+
+	req->r_busy = 1;
+	req->r_done = 0;
+	req->r_write = write;
+	req->r_secno = secno;
+	req->r_nsecs = nsecs;
+
+	// Publish the chain, then the new index, then tell the device.
+	vq_avail->a_ring[vq_avail->a_idx % vq_size] = req->r_head;
+	vb_barrier();
+	vq_avail->a_idx++;
+	vb_barrier();
+	outw(vb_base + VIRTIO_QUEUE_NOTIFY, 0);
+	return req - vb_reqs;
+}
+
+// Report, and forget, an error in a write that has finished.
+static int
+vb_status(void)
+{
+	int r = vb_error;
+
+	vb_error = 0;
+	return r;
+}
+
+int
+virtio_blk_read(uint32_t secno, void *dst, size_t nsecs)
+{
+	struct VbReq *req;
+	int r;
+
+	if ((r = vb_submit(secno, dst, nsecs, 0)) < 0)
+		return r;
+	req = &vb_reqs[r];
+	while (!req->r_done)
+		vb_wait();
+	req->r_busy = 0;
+	if (vb_slots[r].s_status != VIRTIO_BLK_S_OK)
+		return -1;
+	return vb_status();
+}
+
+// Queue a write and return without waiting for it: the memory at 'src'
+// must stay mapped and unchanged until virtio_blk_sync or a matching
+// virtio_blk_sync_range.  Those, and later reads and writes, report an
+// error in the write.
+int
+virtio_blk_write(uint32_t secno, const void *src, size_t nsecs)
+{
+	int r;
+
+	if ((r = vb_submit(secno, src, nsecs, 1)) < 0)
+		return r;
+	return vb_status();
+}
+
+// Wait for every queued write to finish.  Returns 0, or -1 if any
+// failed.
+int
+virtio_blk_sync(void)
+{
+	struct VbReq *req;
+
+	for (req = vb_reqs; req < vb_reqs + VB_NREQ; req++)
+		while (req->r_busy && req->r_write)
+			vb_wait();
+	return vb_status();
+}
+
+// Like virtio_blk_sync, but only wait for the writes that touch sectors
+// [secno, secno+nsecs).
+int
+virtio_blk_sync_range(uint32_t secno, size_t nsecs)
+{
+	struct VbReq *req;
+
+	for (req = vb_reqs; req < vb_reqs + VB_NREQ; req++)
+		while (req->r_busy && req->r_write &&
+		       secno < req->r_secno + req->r_nsecs &&
+		       req->r_secno < secno + nsecs)
+			vb_wait();
+	return vb_status();
+}
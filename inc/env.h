@@ -61,6 +61,8 @@ struct Env {
 
   // Exception handling
   void *env_pgfault_upcall;             // Page fault upcall entry point
+  uintptr_t env_uxstacktop;             // Top of its exception stack
+  bool env_kern_cow;                    // Kernel resolves PTE_COW write faults
 
   // Lab 4 IPC
   bool env_ipc_recving;                 // Env is blocked receiving
@@ -68,11 +70,17 @@ struct Env {
   
   ///* Replaced for LAB 4 CHALLENGE
   void *env_ipc_dstva;                  // VA at which to map received page
+  size_t env_ipc_npages;                // Pages taken there; then received
   uint32_t env_ipc_value;               // Data value sent to us
   envid_t env_ipc_from;                 // envid of the sender
   int env_ipc_perm;                     // Perm of page mapping received
   //*/
 
+  // Wait channels (sys_chan_sleep / sys_chan_wakeup)
+  physaddr_t env_sleep_chan;            // Physical address slept on, 0 if none
+  void *env_sleep_dstva;                // VA at which to map a handed-off page
+  uint32_t env_sleep_deadline;          // time_msec() to give up at, 0 = never
+
   /*
    * LAB 4 CHALLENGE
    */
@@ -12,6 +12,10 @@ struct Fd;
 struct Stat;
 struct Dev;
 
+// Size of the data area reserved for each file descriptor
+// (see fd2data).  Devices may map up to this many bytes there.
+#define FDDATASIZE      (16*PGSIZE)
+
 // Per-device-class file descriptor operations
 struct Dev {
   int dev_id;
@@ -23,24 +23,57 @@
 #define NDIRECT         10
 // Number of direct block pointers in an indirect block
 #define NINDIRECT       (BLKSIZE / 4)
+// Number of extents in a File descriptor
+#define NEXTENT         7
 
-#define MAXFILESIZE     ((NDIRECT + NINDIRECT) * BLKSIZE)
+// Largest regular file kept in its File rather than in a data block.
+#define NINLINE         (256 - MAXNAMELEN - 12)
+
+// Largest block-aligned off_t.  Extents and the double-indirect
+// block can both map this much.
+#define MAXFILESIZE     0x7FFFF000
+
+// A run of e_len consecutive disk blocks starting at e_start.
+struct Extent {
+  uint32_t e_start;
+  uint32_t e_len;
+} __attribute__((packed));
 
 struct File {
   char f_name[MAXNAMELEN];              // filename
   off_t f_size;                         // file size in bytes
   uint32_t f_type;                      // file type
+  uint32_t f_flags;                     // FILE_* flags
+
+  union {
+    struct {
+      // Block pointers, used unless FILE_EXTENTS is set.
+      // A block is allocated iff its value is != 0.
+      uint32_t f_direct[NDIRECT];       // direct blocks
+      uint32_t f_indirect;              // indirect block
+      uint32_t f_dindirect;             // double-indirect block
 
-  // Block pointers.
-  // A block is allocated iff its value is != 0.
-  uint32_t f_direct[NDIRECT];           // direct blocks
-  uint32_t f_indirect;                  // indirect block
+      // Extents, used if FILE_EXTENTS is set.  They map the file's
+      // blocks in order: f_extent[0] covers the first e_len blocks,
+      // and so on.
+      uint32_t f_nextent;               // extents in use
+      struct Extent f_extent[NEXTENT];
 
-  // Pad out to 256 bytes; must do arithmetic in case we're compiling
-  // fsformat on a 64-bit machine.
-  uint8_t f_pad[256 - MAXNAMELEN - 8 - 4*NDIRECT - 4];
+      uint32_t f_index;                 // FILE_DIRINDEX: DirIndex block
+    } __attribute__((packed));
+
+    // The data itself, if FILE_INLINE is set.  This also pads the File
+    // out to 256 bytes; must do arithmetic in case we're compiling
+    // fsformat on a 64-bit machine.
+    uint8_t f_data[NINLINE];
+  };
 } __attribute__((packed));      // required only on some 64-bit machines
 
+// File flags
+#define FILE_EXTENTS    0x1     // Blocks are mapped by f_extent
+#define FILE_DIRINDEX   0x2     // Directory has a hash index at f_index
+#define FILE_INLINE     0x4     // Regular file's data is in f_data
+
 // An inode block contains exactly BLKFILES 'struct File's
 #define BLKFILES        (BLKSIZE / sizeof(struct File))
 
@@ -48,6 +81,48 @@ struct File {
 #define FTYPE_REG       0       // Regular file
 #define FTYPE_DIR       1       // Directory
 
+// A directory's hash index, so a lookup reads one table block and one
+// directory block rather than the whole directory.  The DirIndex block
+// lists the blocks of an open-addressing hash table, which map a name's
+// dir_hash to the entry holding it.  Entries are numbered from the
+// start of the directory, BLKFILES to a block.  Directories without
+// FILE_DIRINDEX are searched in full.
+
+#define DIRINDEX_MAGIC  0x44494458      // 'DIDX'
+
+struct DirSlot {
+  uint32_t ds_hash;                     // dir_hash of the entry's name
+  uint32_t ds_ent;                      // entry number + 1, 0 if empty
+};
+
+#define DIRSLOTS        (BLKSIZE / sizeof(struct DirSlot))
+#define DIRINDEX_MAXBLOCKS (BLKSIZE / 4 - 4)
+
+struct DirIndex {
+  uint32_t di_magic;                    // DIRINDEX_MAGIC
+  uint32_t di_nslots;                   // table size, a power of 2
+  uint32_t di_nentries;                 // slots in use, at most half
+  uint32_t di_free;                     // no free entry comes before this
+  uint32_t di_blocks[DIRINDEX_MAXBLOCKS]; // table blocks, DIRSLOTS each
+};
+
+// FNV-1a hash of a file name.
+static inline uint32_t
+dir_hash(const char *name)
+{
+  uint32_t h = 2166136261U;
+
+  while (*name)
+    h = (h ^ (uint8_t) *name++) * 16777619;
+  return h;
+}
+
+
+// The disk is divided into allocation groups of AG_BLOCKS blocks.  A
+// file's blocks go near each other and its first near the directory
+// block naming it; a new directory's, in the group with the most free
+// blocks (fs/fs.c).  Groups are not recorded on disk.
+#define AG_BLOCKS       512
 
 // File system super-block (both in-memory and on-disk)
 
@@ -57,8 +132,49 @@ struct Super {
   uint32_t s_magic;                     // Magic number: FS_MAGIC
   uint32_t s_nblocks;                   // Total number of blocks on disk
   struct File s_root;                   // Root directory node
+  uint32_t s_nfree;                     // Number of free blocks
+  uint32_t s_journal;                   // First journal block, 0 if none
+  uint32_t s_njournal;                  // Journal blocks, header included
+};
+
+// The metadata journal: a header block, then transactions written one
+// after another.  A transaction is a descriptor block naming the blocks
+// it logs, followed by copies of them.  The header holds the sequence
+// number of the first transaction; a transaction counts only if the
+// ones before it did, its jd_seq follows theirs and its checksum holds.
+
+#define JOURNAL_MAGIC   0x4A4E4C48      // 'JNLH'
+#define JDESC_MAGIC     0x4A444553      // 'JDES'
+
+struct JournalHeader {
+  uint32_t jh_magic;                    // JOURNAL_MAGIC
+  uint32_t jh_seq;                      // jd_seq of the first transaction
 };
 
+struct JournalDesc {
+  uint32_t jd_magic;                    // JDESC_MAGIC
+  uint32_t jd_sum;                      // checksum of the rest and copies
+  uint32_t jd_seq;                      // sequence number
+  uint32_t jd_n;                        // blocks logged
+  uint32_t jd_blocks[BLKSIZE / 4 - 4];  // their home block numbers
+};
+
+// Fold 'nwords' words at 'p' into the journal checksum 'sum'.  A
+// descriptor's jd_sum folds in everything after it, then each copy.
+static inline uint32_t
+journal_sum(uint32_t sum, const void *p, uint32_t nwords)
+{
+  const uint32_t *w = p;
+
+  while (nwords-- > 0)
+    sum = ((sum << 5) | (sum >> 27)) + *w++;
+  return sum;
+}
+
+// Bounds on the block cache capacity FSREQ_STATS may set, in blocks.
+#define BC_MINCAPACITY  32
+#define BC_MAXCAPACITY  16384
+
 // Definitions for requests from clients to file system
 enum {
   FSREQ_OPEN = 1,
@@ -70,9 +186,60 @@ enum {
   FSREQ_STAT,
   FSREQ_FLUSH,
   FSREQ_REMOVE,
-  FSREQ_SYNC
+  FSREQ_SYNC,
+  // Stats returns a Fsret_stats on the request page
+  FSREQ_STATS,
+  FSREQ_PREFETCH,
+  // Read map returns the file's page at req_offset, mapped read-only
+  FSREQ_READ_MAP,
+  // Readv returns the file's pages holding the range, mapped read-only
+  FSREQ_READV,
+  // Writev's data follows the request, in up to FSV_MAXPAGES pages
+  FSREQ_WRITEV,
+  // Compound runs a list of steps (Fsreq_compound) in one round trip
+  FSREQ_COMPOUND,
+  FSREQ_FALLOCATE
 };
 
+// Steps of an FSREQ_COMPOUND, run in order until one fails.  A step
+// other than an open works on op_fileid, or, if op_step is not 0, on
+// the file that step op_step - 1 opened.  Paths come from req_buf and
+// results go to it, at op_buf.
+enum {
+  // Open the path at op_buf with mode op_arg.  The reply carries the
+  // Fd page if every step succeeds.
+  FSOP_OPEN = 1,
+  // Likewise, but only for the steps after it: the file is closed once
+  // the request is done.
+  FSOP_OPEN_TEMP,
+  // Write a Fsret_stat at op_buf
+  FSOP_STAT,
+  // Read up to op_arg bytes at op_offset to op_buf; the seek position
+  // doesn't move
+  FSOP_READ
+};
+
+// Most steps in an FSREQ_COMPOUND; at most one may open a file
+#define FSC_MAXOPS      8
+
+// Most data pages one FSREQ_READV or FSREQ_WRITEV carries
+#define FSV_MAXPAGES    256
+
+// Workers the file server runs, each an ENV_TYPE_FS environment that
+// takes requests (fs/serv.c)
+#ifndef FS_NWORKERS
+#define FS_NWORKERS     4
+#endif
+#define FS_MAXWORKERS   8
+
+// Disk request scheduling policies (Fsreq_stats)
+#define BIO_SCHED_CLOOK 1               // sort (C-LOOK) and merge
+#define BIO_SCHED_FIFO  2               // in arrival order, unmerged
+
+// Path lookup cache settings (Fsreq_stats)
+#define DCACHE_ON       1
+#define DCACHE_OFF      2
+
 union Fsipc {
   struct Fsreq_open {
     char req_path[MAXPATHLEN];
@@ -105,9 +272,76 @@ union Fsipc {
   struct Fsreq_flush {
     int req_fileid;
   } flush;
+  struct Fsreq_fallocate {
+    int req_fileid;
+    off_t req_offset;
+    off_t req_len;
+  } fallocate;
   struct Fsreq_remove {
     char req_path[MAXPATHLEN];
   } remove;
+  struct Fsreq_stats {
+    uint32_t req_bc_capacity;           // new cache capacity, 0 to keep
+    uint32_t req_bio_sched;             // new BIO_SCHED_*, 0 to keep
+    uint32_t req_dcache;                // DCACHE_ON or _OFF, 0 to keep
+  } stats;
+  struct Fsret_stats {
+    uint32_t ret_bc_capacity;           // blocks the cache may hold
+    uint32_t ret_bc_resident;           // blocks it holds now
+    uint32_t ret_bc_hits;               // file block lookups it satisfied
+    uint32_t ret_bc_misses;             // lookups that read the disk
+    uint32_t ret_bc_evictions;
+    uint32_t ret_bc_readahead;          // blocks read ahead of lookups
+    uint32_t ret_bc_writes;             // disk write commands
+    uint32_t ret_bc_written;            // blocks they wrote
+    uint32_t ret_bio_sched;             // BIO_SCHED_*
+    uint32_t ret_bio_reqs;              // disk requests queued
+    uint32_t ret_bio_merged;            // of those, merged into another
+    uint32_t ret_bio_reads;             // disk read commands
+    uint32_t ret_bio_seek;              // blocks between commands, summed
+    uint32_t ret_dc_hits;               // path lookups the cache answered
+    uint32_t ret_dc_negative;           // of those, names that don't exist
+    uint32_t ret_dc_misses;             // lookups that searched a directory
+    uint32_t ret_fs_requests;           // requests served (round trips)
+    uint32_t ret_fs_nfree;              // free disk blocks
+    uint32_t ret_of_free;               // open file table entries free
+    uint32_t ret_of_mine;               // entries the asking client holds
+    uint32_t ret_of_sweeps;             // scans for entries clients let go
+    uint32_t ret_of_refused;            // opens over a client's limit
+  } statsRet;
+  struct Fsreq_read_map {
+    int req_fileid;
+    off_t req_offset;                   // page-aligned
+  } read_map;
+  struct Fsreq_readv {
+    int req_fileid;
+    off_t req_offset;
+    size_t req_n;
+  } readv;
+  struct Fsreq_writev {
+    int req_fileid;
+    size_t req_n;                       // bytes in the pages that follow
+  } writev;
+  struct Fsreq_prefetch {
+    int req_fileid;
+    uint32_t req_n;
+    off_t req_offsets[(PGSIZE - 2 * sizeof(uint32_t)) / sizeof(off_t)];
+  } prefetch;
+  struct Fsreq_compound {
+    uint32_t req_nops;
+    struct Fsop {
+      uint32_t op_type;                 // FSOP_*
+      uint32_t op_step;                 // 1 + the step that opened the
+                                        // file, or 0 for op_fileid
+      int op_fileid;
+      uint32_t op_arg;                  // FSOP_OPEN: mode; FSOP_READ: bytes
+      off_t op_offset;                  // FSOP_READ: where in the file
+      uint32_t op_buf;                  // offset of path or result in req_buf
+      int op_ret;                       // set by the server: fileid, 0 or
+                                        // bytes read, or < 0 on error
+    } req_ops[FSC_MAXOPS];
+    char req_buf[PGSIZE - sizeof(uint32_t) - FSC_MAXOPS * sizeof(struct Fsop)];
+  } compound;
 
   // Ensure Fsipc is one page
   char _pad[PGSIZE];
@@ -50,15 +50,41 @@ envid_t sys_getenvid(void);
 int sys_env_destroy(envid_t);
 void    sys_yield(void);
 static envid_t sys_exofork(void);
+envid_t sys_fork(void);
 int     sys_env_set_status(envid_t env, int status);
 int     sys_env_set_trapframe(envid_t env, struct Trapframe *tf);
 int     sys_env_set_pgfault_upcall(envid_t env, void *upcall);
+int     sys_env_set_cow(envid_t env, bool kernel);
 int     sys_page_alloc(envid_t env, void *pg, int perm);
 int     sys_page_map(envid_t src_env, void *src_pg,
                      envid_t dst_env, void *dst_pg, int perm);
 int     sys_page_unmap(envid_t env, void *pg);
-int     sys_ipc_try_send(envid_t to_env, uint32_t value, void *pg, int perm);
-int     sys_ipc_recv(void *rcv_pg);
+int     sys_page_map_range(envid_t src_env, void *pg, size_t len,
+                           envid_t dst_env, int xform);
+int     sys_page_protect_range(envid_t env, void *pg, size_t len, int xform);
+int     sys_batch(struct Syscall *calls, int n);
+int     sys_ipc_try_send(envid_t to_env, uint32_t value, void *pg, int perm,
+                         size_t npages);
+int     sys_ipc_recv(void *rcv_pg, size_t npages);
+unsigned int sys_time_msec(void);
+int     sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout);
+int     sys_chan_wakeup(volatile void *chan, void *srcva, int perm);
+int     sys_irq_listen(int irq, volatile void *chan);
+int     sys_page_paddr(void *va);
+int     sys_page_alloc_contig(void *va, size_t npages, int perm);
+envid_t sys_thread_create(void *eip, void *esp, void *uxstacktop);
+
+// Batched system calls: queue with sysbatch_add, run with sysbatch_flush.
+struct SysBatch {
+  int sb_n;
+  struct Syscall sb_calls[SYSBATCH_MAX];
+};
+
+extern bool sysbatch_serial;
+void    sysbatch_init(struct SysBatch *b);
+int     sysbatch_add(struct SysBatch *b, uint32_t num, uint32_t a1,
+                     uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5);
+int     sysbatch_flush(struct SysBatch *b);
 
 // This must be inlined.  Exercise for reader: why?
 static __inline envid_t __attribute__((always_inline))
@@ -77,11 +103,15 @@ sys_exofork(void)
 // ipc.c
 void ipc_send(envid_t to_env, uint32_t value, void *pg, int perm);
 int32_t ipc_recv(envid_t *from_env_store, void *pg, int *perm_store);
+void ipc_send_pages(envid_t to_env, uint32_t value, void *pg, size_t npages,
+                    int perm);
+int32_t ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+                       int *perm_store);
 envid_t ipc_find_env(enum EnvType type);
 
 // fork.c
-#define PTE_SHARE       0x400
 envid_t fork(void);
+envid_t kfork(void);
 envid_t sfork(void);    // Challenge!
 
 // fd.c
@@ -97,9 +127,28 @@ int     stat(const char *path, struct Stat *statbuf);
 
 // file.c
 int     open(const char *path, int mode);
+int     open_read(const char *path, int mode, void *buf, size_t n,
+                  ssize_t *nread);
+int     file_stat(const char *path, struct Stat *st);
 int     ftruncate(int fd, off_t size);
+int     fallocate(int fd, off_t offset, off_t len);
 int     remove(const char *path);
 int     sync(void);
+int     fs_stats(uint32_t bc_capacity, struct Fsret_stats *st);
+int     fs_dropcache(void);
+int     fs_set_sched(int sched);
+int     fs_set_dcache(int setting);
+int     prefetch(int fd, const off_t *offsets, int n);
+int     read_map(int fd, off_t offset, void *dstva);
+
+// mmap.c
+#define MAP_RDONLY      0       // read-only
+#define MAP_PRIVATE     1       // writable, writes stay private
+#define MAP_SHARED      2       // writable, msync writes to the file
+int     mmap(int fd, off_t offset, size_t len, int perm, void **addr);
+int     msync(void *addr);
+int     munmap(void *addr);
+bool    mmap_fault(struct UTrapframe *utf);
 
 // pageref.c
 int     pageref(void *addr);
@@ -116,8 +165,12 @@ int     iscons(int fd);
 int     opencons(void);
 
 // pipe.c
+#define PIPE_BULK       0x0001          /* multi-page ring, blocking */
 int pipe(int pipefds[2]);
+int     pipe2(int pipefds[2], int mode);
 int     pipeisclosed(int pipefd);
+ssize_t pipe_splice(int pipefd, void *pg, size_t npages);
+ssize_t pipe_splice_read(int pipefd, void *pg);
 
 // wait.c
 void    wait(envid_t env);
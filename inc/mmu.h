@@ -74,6 +74,11 @@
 // Flags in PTE_SYSCALL may be used in system calls.  (Others may not.)
 #define PTE_SYSCALL     (PTE_AVAIL | PTE_P | PTE_W | PTE_U)
 
+// PTE_AVAIL bits with a library-wide meaning.  The kernel only looks at
+// them in the range mapping system calls.
+#define PTE_SHARE       0x400   // Shared with children by fork and spawn
+#define PTE_COW         0x800   // Copy-on-write
+
 // Address in page table or page directory entry
 #define PTE_ADDR(pte)   ((physaddr_t)(pte) & ~0xFFF)
 
@@ -1,6 +1,8 @@
 #ifndef JOS_INC_SYSCALL_H
 #define JOS_INC_SYSCALL_H
 
+#include <inc/types.h>
+
 /* system call numbers */
 enum {
   SYS_cputs = 0,
@@ -17,7 +19,36 @@ enum {
   SYS_yield,
   SYS_ipc_try_send,
   SYS_ipc_recv,
+  SYS_time_msec,
+  SYS_chan_sleep,
+  SYS_chan_wakeup,
+  SYS_page_map_range,
+  SYS_page_protect_range,
+  SYS_batch,
+  SYS_env_set_cow,
+  SYS_fork,
+  SYS_irq_listen,
+  SYS_page_paddr,
+  SYS_page_alloc_contig,
+  SYS_thread_create,
   NSYSCALLS
 };
 
+/* permission transforms for SYS_page_map_range and SYS_page_protect_range */
+enum {
+  PMR_SAME = 0,   /* keep each page's permissions */
+  PMR_COW,        /* writable, unshared pages become PTE_COW */
+  PMR_SHARED,     /* only PTE_SHARE pages, permissions kept */
+  PMR_RDONLY,     /* clear PTE_W */
+};
+
+/* one system call in a SYS_batch submission */
+struct Syscall {
+  uint32_t sc_num;
+  uint32_t sc_args[5];
+  int32_t sc_ret;       /* filled in by the kernel */
+};
+
+#define SYSBATCH_MAX    64  /* max calls per SYS_batch */
+
 #endif  /* !JOS_INC_SYSCALL_H */
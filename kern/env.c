@@ -267,10 +267,17 @@ env_alloc(struct Env **newenv_store, envid_t parent_id)
 
   // Clear the page fault handler until user installs one.
   e->env_pgfault_upcall = 0;
+  e->env_uxstacktop = UXSTACKTOP;
 
   // Also clear the IPC receiving flag.
   e->env_ipc_recving = 0;
 
+  // And make sure it isn't asleep on a wait channel.
+  e->env_sleep_chan = 0;
+
+  // Copy-on-write faults go to the upcall unless asked otherwise.
+  e->env_kern_cow = 0;
+
   // commit the allocation
   env_free_list = e->env_link;
   *newenv_store = e;
@@ -463,6 +470,14 @@ env_free(struct Env *e)
   // Note the environment's demise.
   // cprintf("[%08x] free env %08x\n", curenv ? curenv->env_id : 0, e->env_id);
 
+  // Stop delivering interrupts to it.
+  irq_release(e);
+
+  // An address space shared with other environments (sys_thread_create)
+  // stays theirs; just drop our reference to it.
+  if (pa2page(PADDR(e->env_pgdir))->pp_ref > 1)
+    goto free_pgdir;
+
   // Flush all mapped pages in the user portion of the address space
   static_assert(UTOP % PTSIZE == 0);
   for (pdeno = 0; pdeno < PDX(UTOP); pdeno++) {
@@ -475,6 +490,14 @@ env_free(struct Env *e)
     pa = PTE_ADDR(e->env_pgdir[pdeno]);
     pt = (pte_t*)KADDR(pa);
 
+    // a page table still shared with other environments keeps its
+    // mappings; just drop our reference to it
+    if ((e->env_pgdir[pdeno] & PDE_SHARED) && pa2page(pa)->pp_ref > 1) {
+      e->env_pgdir[pdeno] = 0;
+      page_decref(pa2page(pa));
+      continue;
+    }
+
     // unmap all PTEs in this page table
     for (pteno = 0; pteno <= PTX(~0); pteno++)
       if (pt[pteno] & PTE_P)
@@ -486,6 +509,7 @@ env_free(struct Env *e)
   }
 
   // free the page directory
+free_pgdir:
   pa = PADDR(e->env_pgdir);
   e->env_pgdir = 0;
   page_decref(pa2page(pa));
@@ -521,6 +545,37 @@ env_destroy(struct Env *e)
 }
 
 
+//
+// Wake environment e from sys_chan_sleep.  The sleep system call will
+// appear to return 'ret'.
+//
+void
+env_wakeup(struct Env *e, int32_t ret)
+{
+  e->env_sleep_chan = 0;
+  e->env_tf.tf_regs.reg_eax = ret;
+  e->env_status = ENV_RUNNABLE;
+}
+
+//
+// Wake every environment sleeping on wait channel 'chan' (a physical
+// address).  Returns the number woken.
+//
+int
+env_wakeup_chan(physaddr_t chan)
+{
+  int i, woken;
+
+  woken = 0;
+  for (i = 0; i < NENV; i++)
+    if (envs[i].env_status == ENV_NOT_RUNNABLE &&
+        envs[i].env_sleep_chan == chan) {
+      env_wakeup(&envs[i], 0);
+      woken++;
+    }
+  return woken;
+}
+
 //
 // Restores the register values in the Trapframe with the 'iret' instruction.
 // This exits the kernel and starts executing some environment's code.
@@ -580,7 +635,11 @@ env_run(struct Env *e)
     (e->env_runs)++;
 
     lcr3(PADDR(e->env_pgdir));
-  } 
+  } else if (pa2page(PADDR(e->env_pgdir))->pp_ref > 1) {
+    // Another environment sharing the address space may have changed
+    // it on another CPU since we entered the kernel.
+    lcr3(PADDR(e->env_pgdir));
+  }
 
   unlock_kernel();
   env_pop_tf(&(e->env_tf));
@@ -16,6 +16,8 @@ int	env_alloc(struct Env **e, envid_t parent_id);
 void	env_free(struct Env *e);
 void	env_create(uint8_t *binary, enum EnvType type);
 void	env_destroy(struct Env *e);	// Does not return if e == curenv
+void	env_wakeup(struct Env *e, int32_t ret);
+int	env_wakeup_chan(physaddr_t chan);
 int env_ipc_push(struct Env *e, envid_t from, uint32_t value, void *dstva, int perm);
 struct EnvIpcNode *env_ipc_pop(struct Env *e);
 
@@ -14,6 +14,7 @@
 #include <kern/picirq.h>
 #include <kern/cpu.h>
 #include <kern/spinlock.h>
+#include <kern/time.h>
 
 static void boot_aps(void);
 
@@ -48,6 +49,9 @@ i386_init(void)
   // Lab 4 multitasking initialization functions
   pic_init();
 
+  // Clock for sys_time_msec and timed sleeps
+  time_init();
+
   // Acquire the big kernel lock before waking up APs
   // Your code here:
   lock_kernel();
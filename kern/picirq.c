@@ -85,3 +85,11 @@ irq_setmask_8259A(uint16_t mask)
   cprintf("\n");
 }
 
+// Acknowledge 'irq' at the 8259A.  The master is in automatic EOI
+// mode, but the slave isn't.
+void
+irq_eoi_8259A(int irq)
+{
+  if (irq >= 8)
+    outb(IO_PIC2, 0x20);
+}
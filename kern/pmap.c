@@ -413,6 +413,47 @@ page_alloc(int alloc_flags)
   return NULL;
 }
 
+//
+// Allocates 'n' physically contiguous pages, for device queues that a
+// DMA engine addresses as one block of physical memory.  This scans
+// every page, so it is meant for driver setup, not for hot paths.
+// alloc_flags is as for page_alloc.
+//
+// Returns the first page, or NULL if there's no run of 'n' free pages.
+//
+struct PageInfo *
+page_alloc_contig(size_t n, int alloc_flags)
+{
+  struct PageInfo *tail, *first, **pp;
+  size_t i, run;
+
+  if (n == 0 || !page_free_list)
+    return NULL;
+
+  // A page is free iff it is on the free list: its pp_link is set,
+  // or it is the last page on the list.
+  for (tail = page_free_list; tail->pp_link; tail = tail->pp_link)
+    ;
+  for (i = 0, run = 0; i < npages && run < n; i++)
+    run = (pages[i].pp_link || &pages[i] == tail) ? run + 1 : 0;
+  if (run < n)
+    return NULL;
+  first = &pages[i - n];
+
+  for (pp = &page_free_list; *pp; ) {
+    if (*pp >= first && *pp < first + n)
+      *pp = (*pp)->pp_link;
+    else
+      pp = &(*pp)->pp_link;
+  }
+  for (i = 0; i < n; i++) {
+    first[i].pp_link = NULL;
+    if (alloc_flags & ALLOC_ZERO)
+      memset(page2kva(&first[i]), 0, PGSIZE);
+  }
+  return first;
+}
+
 //
 // Return a page to the free list.
 // (This function should only be called when pp->pp_ref reaches 0.)
@@ -454,6 +495,11 @@ page_decref(struct PageInfo* pp)
 //	the page is cleared,
 //	and pgdir_walk returns a pointer into the new page table page.
 //
+// A page table shared with other page directories (PDE_SHARED, see
+// pgdir_unshare) is read-only.  With create != 0 the caller intends to
+// change the entry, so such a table is first copied for 'pgdir'; if
+// that copy can't be allocated, pgdir_walk returns NULL.
+//
 // Hint 1: you can turn a Page * into the physical address of the
 // page it refers to with page2pa() from kern/pmap.h.
 //
@@ -474,6 +520,8 @@ pgdir_walk(pde_t *pgdir, const void *va, int create)
   pagedir_entry = &pgdir[PDX(va)];
 
   if (*pagedir_entry & PTE_P) {
+    if (create && pgdir_unshare(pgdir, va) < 0)
+      return NULL;
     pagetable = (pte_t *) KADDR(PTE_ADDR(*pagedir_entry));
   } else {
     struct PageInfo *pagetable_page; 
@@ -579,7 +627,8 @@ page_lookup(pde_t *pgdir, void *va, pte_t **pte_store)
     if (pte_store) {
       *pte_store = pagetable_entry;
     }
-    return pa2page(*pagetable_entry);
+    if (*pagetable_entry & PTE_P)
+      return pa2page(PTE_ADDR(*pagetable_entry));
   }
 
   return NULL;
@@ -607,15 +656,123 @@ page_remove(pde_t *pgdir, void *va)
   struct PageInfo *page_info;
   pte_t *page_table_store;
   
-  if ( (page_info = page_lookup(pgdir, va, &page_table_store)) ) {
-    page_decref(page_info);
+  if ( !(page_info = page_lookup(pgdir, va, &page_table_store)) )
+    return;
+
+  // The entry can only be cleared in our own copy of the page table.
+  // If there's no memory for one, the mapping stays.
+  if ( (pgdir[PDX(va)] & PDE_SHARED) &&
+      !(page_table_store = pgdir_walk(pgdir, va, 1)) )
+    return;
+
+  page_decref(page_info);
+  *page_table_store = (pte_t) NULL;
+  tlb_invalidate(pgdir, va);
+}
+
+//
+// Give 'pgdir' a private copy of the page table covering 'va' if it is
+// shared with other page directories (see sys_fork).  A shared table is
+// mapped read-only with PDE_SHARED set in every directory using it, and
+// its pp_ref counts those directories; the pages it maps are referenced
+// once by the table however many directories share it.
+//
+// Once copied, each page is mapped by two tables, so writable pages
+// that aren't PTE_SHARE become PTE_COW in both.  If 'pgdir' holds the
+// last reference, the table is just made writable again, demoting only
+// writable pages that picked up other references meanwhile.
+//
+// RETURNS:
+//   0 on success, or if the table isn't shared
+//   -E_NO_MEM, if the copy couldn't be allocated
+//
+int
+pgdir_unshare(pde_t *pgdir, const void *va)
+{
+  pde_t *pde = &pgdir[PDX(va)];
+  struct PageInfo *shared, *copy;
+  pte_t *src, *dst;
+  int i;
+
+  if ( (*pde & (PTE_P | PDE_SHARED)) != (PTE_P | PDE_SHARED) )
+    return 0;
+
+  shared = pa2page(PTE_ADDR(*pde));
+  src = (pte_t *) KADDR(PTE_ADDR(*pde));
+
+  if (shared->pp_ref == 1) {
+    for (i = 0; i < NPTENTRIES; i++)
+      if ( (src[i] & (PTE_P | PTE_W | PTE_SHARE)) == (PTE_P | PTE_W) &&
+          pa2page(PTE_ADDR(src[i]))->pp_ref > 1 )
+        src[i] = (src[i] & ~PTE_W) | PTE_COW;
+    *pde = (*pde & ~PDE_SHARED) | PTE_W;
+  } else {
+    if ( !(copy = page_alloc(0)) )
+      return -E_NO_MEM;
+    dst = (pte_t *) page2kva(copy);
+
+    for (i = 0; i < NPTENTRIES; i++) {
+      if ( (src[i] & (PTE_P | PTE_W | PTE_SHARE)) == (PTE_P | PTE_W) )
+        src[i] = (src[i] & ~PTE_W) | PTE_COW;
+      if (src[i] & PTE_P)
+        pa2page(PTE_ADDR(src[i]))->pp_ref++;
+      dst[i] = src[i];
+    }
+
+    copy->pp_ref++;
+    shared->pp_ref--;
+    *pde = page2pa(copy) | PTE_P | PTE_W | PTE_U;
   }
 
-  if (*page_table_store & PTE_P) {
-    *page_table_store = (pte_t) NULL;
+  // Drop the read-only translations cached for the whole region.
+  if (rcr3() == PADDR(pgdir))
+    lcr3(PADDR(pgdir));
+  return 0;
+}
+
+//
+// Resolve a write fault on the copy-on-write (PTE_COW) page at 'va'.
+// If this mapping holds the only reference to the page, it is simply
+// made writable again; otherwise it gets a private copy.
+//
+// RETURNS:
+//   0 on success
+//   -E_INVAL, if va is not mapped PTE_COW in pgdir
+//   -E_NO_MEM, if the copy couldn't be allocated
+//
+int
+page_cow(pde_t *pgdir, void *va)
+{
+  struct PageInfo *pp, *copy;
+  pte_t *pte;
+  int perm;
+
+  va = ROUNDDOWN(va, PGSIZE);
+  if ( (uintptr_t) va >= UTOP || !(pte = pgdir_walk(pgdir, va, 0)) )
+    return -E_INVAL;
+  if ( (*pte & (PTE_P | PTE_U | PTE_COW)) != (PTE_P | PTE_U | PTE_COW) )
+    return -E_INVAL;
+  if ( !(pte = pgdir_walk(pgdir, va, 1)) )
+    return -E_NO_MEM;
+
+  perm = (*pte & PTE_SYSCALL & ~PTE_COW) | PTE_W;
+  pp = pa2page(PTE_ADDR(*pte));
+
+  if (pp->pp_ref == 1) {
+    *pte = PTE_ADDR(*pte) | perm;
     tlb_invalidate(pgdir, va);
+    return 0;
   }
 
+  if ( !(copy = page_alloc(0)) )
+    return -E_NO_MEM;
+  memmove(page2kva(copy), page2kva(pp), PGSIZE);
+
+  if (page_insert(pgdir, copy, va, perm) < 0) {
+    page_free(copy);
+    return -E_NO_MEM;
+  }
+  return 0;
 }
 
 //
@@ -711,11 +868,17 @@ user_mem_check(struct Env *env, const void *va, size_t len, int perm)
   end = (void *) va + len;
 
   for ( ; cur < end; cur += PGSIZE) {
+    // The kernel is about to write through a shared page table's
+    // read-only mapping, so take a private copy of it first.
+    if ( (perm & PTE_W) && (uintptr_t) cur < UTOP )
+      pgdir_unshare(env->env_pgdir, cur);
+
     pagetable_entry = pgdir_walk(env->env_pgdir, cur, 0);
 
-    if ( ((uintptr_t) (va) >= ULIM) ||
+    if ( ((uintptr_t) (cur) >= ULIM) ||
         !(pagetable_entry) ||
-        !(((uintptr_t) *pagetable_entry) & (perm | PTE_P)) ) {
+        (*pagetable_entry & (perm | PTE_P)) != (perm | PTE_P) ||
+        ((perm & PTE_W) && !(env->env_pgdir[PDX(cur)] & PTE_W)) ) {
       user_mem_check_addr = (uintptr_t) ((cur <=  va) ? va : cur);
       return -E_FAULT;
     }
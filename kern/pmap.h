@@ -55,11 +55,18 @@ void	mem_init(void);
 
 void	page_init(void);
 struct PageInfo *page_alloc(int alloc_flags);
+struct PageInfo *page_alloc_contig(size_t n, int alloc_flags);
 void	page_free(struct PageInfo *pp);
 int	page_insert(pde_t *pgdir, struct PageInfo *pp, void *va, int perm);
 void	page_remove(pde_t *pgdir, void *va);
 struct PageInfo *page_lookup(pde_t *pgdir, void *va, pte_t **pte_store);
 void	page_decref(struct PageInfo *pp);
+int	page_cow(pde_t *pgdir, void *va);
+int	pgdir_unshare(pde_t *pgdir, const void *va);
+
+// Set in a page directory entry whose page table is shared read-only
+// with other environments (see pgdir_unshare).
+#define PDE_SHARED	PTE_COW
 
 void	tlb_invalidate(pde_t *pgdir, void *va);
 
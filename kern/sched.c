@@ -4,6 +4,7 @@
 #include <kern/env.h>
 #include <kern/pmap.h>
 #include <kern/monitor.h>
+#include <kern/time.h>
 
 void sched_halt(void);
 
@@ -11,7 +12,7 @@ void sched_halt(void);
 void
 sched_yield(void)
 {
-  uint32_t count, envid, cur_envid;
+  uint32_t count, envid, cur_envid, now;
 
         // Implement simple round-robin scheduling.
         //
@@ -29,6 +30,16 @@ sched_yield(void)
         // below to halt the cpu.
 
   // LAB 4: Your code here.
+  // Wake environments whose timed sys_chan_sleep has run out.
+  now = time_msec();
+  for (count = 0; count < NENV; count++) {
+    if (envs[count].env_status == ENV_NOT_RUNNABLE &&
+        envs[count].env_sleep_chan &&
+        envs[count].env_sleep_deadline &&
+        now >= envs[count].env_sleep_deadline)
+      env_wakeup(&envs[count], 0);
+  }
+
   envid = curenv ? ENVX(curenv->env_id) : NENV - 1;
   cur_envid = (envid + 1) % NENV;
 
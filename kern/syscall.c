@@ -11,6 +11,7 @@
 #include <kern/syscall.h>
 #include <kern/console.h>
 #include <kern/sched.h>
+#include <kern/time.h>
 
 // Print a string to the system console.
 // The string is exactly 'len' characters long.
@@ -93,6 +94,9 @@ sys_exofork(void)
   memmove(&env->env_tf, &curenv->env_tf, sizeof(struct Trapframe));
   env->env_tf.tf_regs.reg_eax = 0;
 
+  // The child inherits how its copy-on-write faults are handled.
+  env->env_kern_cow = curenv->env_kern_cow;
+
   return env->env_id;
 }
 
@@ -183,6 +187,26 @@ sys_env_set_pgfault_upcall(envid_t envid, void *func)
   return 0;
 }
 
+// Choose whether the kernel resolves write faults on 'envid's PTE_COW
+// pages itself (see page_cow) instead of sending them to the page fault
+// upcall.  Children created with sys_exofork inherit the setting.
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_BAD_ENV if environment envid doesn't currently exist,
+//		or the caller doesn't have permission to change envid.
+static int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  struct Env *env;
+  int error;
+
+  if ( (error = envid2env(envid, &env, 1)) < 0)
+    return error;
+
+  env->env_kern_cow = kernel;
+  return 0;
+}
+
 // Allocate a page of memory and map it at 'va' with permission
 // 'perm' in the address space of 'envid'.
 // The page's contents are set to 0.
@@ -235,6 +259,25 @@ sys_page_alloc(envid_t envid, void *va, int perm)
   return 0;
 }
 
+// Whether 'pgdir' lets its owner write the page at 'va'.  A page table
+// shared by sys_fork is read-only as a whole, but only until the first
+// write copies it, so copy it now: its writable pages that aren't
+// PTE_SHARE become PTE_COW, the rest stay writable.
+//
+// Returns 1 if writable, 0 if not, -E_NO_MEM if the copy failed.
+static int
+page_writable(pde_t *pgdir, void *va)
+{
+  pte_t *pte;
+  int error;
+
+  if ( (error = pgdir_unshare(pgdir, va)) < 0 )
+    return error;
+  if ( !page_lookup(pgdir, va, &pte) )
+    return 0;
+  return (*pte & PTE_W) && (pgdir[PDX(va)] & PTE_W);
+}
+
 // Map the page of memory at 'srcva' in srcenvid's address space
 // at 'dstva' in dstenvid's address space with permission 'perm'.
 // Perm has the same restrictions as in sys_page_alloc, except
@@ -285,8 +328,9 @@ sys_page_map(envid_t srcenvid, void *srcva,
   }
 
   if ( (page = page_lookup(srcenv->env_pgdir, srcva, &pagetable_entry)) ) {
-    if ( !(*pagetable_entry & PTE_W) && (perm & PTE_W) ) {
-      return -E_INVAL;
+    if ( (perm & PTE_W) &&
+         (error = page_writable(srcenv->env_pgdir, srcva)) <= 0 ) {
+      return error ? error : -E_INVAL;
     }
     if ( (error = page_insert(dstenv->env_pgdir, page, dstva, perm)) < 0) {
       return error;
@@ -296,6 +340,266 @@ sys_page_map(envid_t srcenvid, void *srcva,
   return 0;
 }
 
+// Compute the permissions a page mapped by 'pte' gets under the range
+// transform 'xform' (see inc/syscall.h), or 0 if the transform skips it.
+static int
+range_perm(pte_t pte, int xform)
+{
+  int perm = pte & PTE_SYSCALL;
+
+  if ( (pte & (PTE_P | PTE_U)) != (PTE_P | PTE_U) )
+    return 0;
+
+  switch (xform) {
+    case PMR_SAME:
+      return perm;
+    case PMR_COW:
+      if ( (perm & (PTE_W | PTE_COW)) && !(perm & PTE_SHARE) )
+        return (perm & ~PTE_W) | PTE_COW;
+      return perm;
+    case PMR_SHARED:
+      return (perm & PTE_SHARE) ? perm : 0;
+    case PMR_RDONLY:
+      return perm & ~PTE_W;
+  }
+  return 0;
+}
+
+// Return the page table entry for 'va' in 'pgdir', or NULL if no page
+// table covers it.  In that case *va is advanced to the last page of the
+// missing page table so the caller's loop skips the whole 4MB region.
+static pte_t *
+range_walk(pde_t *pgdir, uintptr_t *va)
+{
+  if ( !(pgdir[PDX(*va)] & PTE_P) ) {
+    *va = ROUNDDOWN(*va, PTSIZE) + PTSIZE - PGSIZE;
+    return NULL;
+  }
+  return pgdir_walk(pgdir, (void *) *va, 0);
+}
+
+// Validate the arguments shared by the range system calls.
+static int
+range_check(void *va, size_t len, int xform)
+{
+  uintptr_t end = (uintptr_t) va + len;
+
+  if ( PGOFF(va) || PGOFF(len) || end > UTOP || end < (uintptr_t) va )
+    return -E_INVAL;
+  if ( xform < PMR_SAME || xform > PMR_RDONLY )
+    return -E_INVAL;
+  return 0;
+}
+
+// Map every present page in [va, end) of 'srcenv' into 'dstenv' at the
+// same address, with permissions given by the transform 'xform'.  Under
+// PMR_COW the source's own mapping is also switched to PTE_COW in the
+// same pass, so the source can't write the page in between (this is
+// what fork needs).  Page tables missing in the source are skipped
+// whole; shared ones are copied first unless the transform can't map a
+// page writable.
+//
+// Returns the number of pages mapped, or -E_NO_MEM.  Pages before the
+// failing one stay mapped.
+static int
+range_map(struct Env *srcenv, uintptr_t va, uintptr_t end,
+          struct Env *dstenv, int xform)
+{
+  uintptr_t cur;
+  pte_t *pte;
+  int error, perm, n;
+
+  n = 0;
+  for (cur = va; cur < end; cur += PGSIZE) {
+    if ( (xform == PMR_SAME || xform == PMR_COW) &&
+        (error = pgdir_unshare(srcenv->env_pgdir, (void *) cur)) < 0 )
+      return error;
+    if ( !(pte = range_walk(srcenv->env_pgdir, &cur)) )
+      continue;
+    if ( !(perm = range_perm(*pte, xform)) )
+      continue;
+
+    if ( (error = page_insert(dstenv->env_pgdir, pa2page(PTE_ADDR(*pte)),
+            (void *) cur, perm)) < 0 )
+      return error;
+
+    if ( xform == PMR_COW && (*pte & PTE_SYSCALL) != perm ) {
+      *pte = PTE_ADDR(*pte) | perm;
+      tlb_invalidate(srcenv->env_pgdir, (void *) cur);
+    }
+    n++;
+  }
+
+  return n;
+}
+
+// Map every present page in [va, va+len) of 'srcenvid' into 'dstenvid'
+// at the same address, with permissions given by the transform 'xform'
+// (see range_map).
+//
+// Returns the number of pages mapped, < 0 on error.  Errors are:
+//	-E_BAD_ENV if srcenvid and/or dstenvid doesn't currently exist,
+//		or the caller doesn't have permission to change one of them.
+//	-E_INVAL if va or len is not page-aligned, the range runs past
+//		UTOP, or xform is not a PMR_* transform.
+//	-E_NO_MEM if there's no memory to allocate a page table.
+//		Pages before the failing one stay mapped.
+static int
+sys_page_map_range(envid_t srcenvid, void *va, size_t len,
+                   envid_t dstenvid, int xform)
+{
+  struct Env *srcenv, *dstenv;
+  int error;
+
+  if ( (error = range_check(va, len, xform)) < 0 )
+    return error;
+
+  if ( ((error = envid2env(srcenvid, &srcenv, 1)) < 0) ||
+      ((error = envid2env(dstenvid, &dstenv, 1)) < 0)) {
+    return error;
+  }
+
+  return range_map(srcenv, (uintptr_t) va, (uintptr_t) va + len,
+                   dstenv, xform);
+}
+
+// Apply the transform 'xform' to every present page in [va, va+len) of
+// 'envid' in place.  Transforms never add PTE_W, so PMR_SAME and
+// PMR_SHARED leave the range unchanged.
+//
+// Returns the number of pages whose permissions changed, < 0 on error.
+// Errors are:
+//	-E_BAD_ENV if environment envid doesn't currently exist,
+//		or the caller doesn't have permission to change envid.
+//	-E_INVAL if va or len is not page-aligned, the range runs past
+//		UTOP, or xform is not a PMR_* transform.
+//	-E_NO_MEM if a shared page table couldn't be copied.
+static int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  struct Env *env;
+  uintptr_t cur, end;
+  pte_t *pte;
+  int error, perm, n;
+
+  if ( (error = range_check(va, len, xform)) < 0 )
+    return error;
+
+  if ( (error = envid2env(envid, &env, 1)) < 0 )
+    return error;
+
+  n = 0;
+  end = (uintptr_t) va + len;
+  for (cur = (uintptr_t) va; cur < end; cur += PGSIZE) {
+    if ( (error = pgdir_unshare(env->env_pgdir, (void *) cur)) < 0 )
+      return error;
+    if ( !(pte = range_walk(env->env_pgdir, &cur)) )
+      continue;
+    if ( !(perm = range_perm(*pte, xform)) || (*pte & PTE_SYSCALL) == perm )
+      continue;
+
+    *pte = PTE_ADDR(*pte) | perm;
+    tlb_invalidate(env->env_pgdir, (void *) cur);
+    n++;
+  }
+
+  return n;
+}
+
+// Fork the current environment in the kernel.  Every page table below
+// the one holding the stacks is shared read-only with the child
+// (PDE_SHARED) and copied lazily by pgdir_unshare on the first write
+// fault in its 4MB region, so fork costs O(page tables) instead of
+// O(pages).  The stacks' page table is copied now, copy-on-write as in
+// fork(), and the child gets a fresh exception stack and our page fault
+// upcall.  The child is left runnable, with sys_fork returning 0 in it.
+//
+// Returns envid of new environment, or < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if no free environment is available.
+//	-E_NO_MEM on memory exhaustion.
+static envid_t
+sys_fork(void)
+{
+  struct Env *child;
+  uintptr_t stacks;
+  uint32_t pdeno;
+  pde_t *pde;
+  int error;
+
+  if ( (error = sys_exofork()) < 0 )
+    return error;
+  if ( (error = envid2env(error, &child, 0)) < 0 )
+    return error;
+
+  stacks = ROUNDDOWN(UXSTACKTOP - 1, PTSIZE);
+  for (pdeno = 0; pdeno < PDX(stacks); pdeno++) {
+    pde = &curenv->env_pgdir[pdeno];
+    if ( !(*pde & PTE_P) )
+      continue;
+
+    *pde = (*pde & ~PTE_W) | PDE_SHARED;
+    child->env_pgdir[pdeno] = *pde;
+    pa2page(PTE_ADDR(*pde))->pp_ref++;
+  }
+  // Our cached writable translations through those tables are stale.
+  lcr3(PADDR(curenv->env_pgdir));
+
+  if ( (error = range_map(curenv, stacks, UXSTACKTOP - PGSIZE,
+          child, PMR_COW)) < 0 ||
+      (error = sys_page_alloc(child->env_id, (void *) (UXSTACKTOP - PGSIZE),
+          PTE_P | PTE_U | PTE_W)) < 0 ) {
+    env_destroy(child);
+    return error;
+  }
+
+  child->env_pgfault_upcall = curenv->env_pgfault_upcall;
+  child->env_status = ENV_RUNNABLE;
+  return child->env_id;
+}
+
+// Create a new environment that shares the current one's address space,
+// as a thread would: it starts at 'eip' with stack pointer 'esp', and
+// takes page faults on the exception stack just below 'uxstacktop',
+// which must be its own.  It gets the same type, registers otherwise
+// (I/O privilege included), page fault upcall and copy-on-write
+// handling, and like a sys_exofork child is left ENV_NOT_RUNNABLE.
+// Mappings either one makes are seen by both.
+//
+// Returns envid of new environment, or < 0 on error.  Errors are:
+//	-E_NO_FREE_ENV if no free environment is available.
+//	-E_NO_MEM on memory exhaustion.
+//	-E_INVAL if eip, esp or uxstacktop is above UTOP, or uxstacktop
+//		is not page-aligned.
+static envid_t
+sys_thread_create(uintptr_t eip, uintptr_t esp, uintptr_t uxstacktop)
+{
+  struct Env *env;
+  int error;
+
+  if ( eip >= UTOP || esp > UTOP || uxstacktop > UTOP ||
+      uxstacktop < PGSIZE || PGOFF(uxstacktop) )
+    return -E_INVAL;
+
+  if ( (error = env_alloc(&env, curenv->env_id)) < 0 )
+    return error;
+
+  // Trade the new page directory for ours.
+  page_decref(pa2page(PADDR(env->env_pgdir)));
+  env->env_pgdir = curenv->env_pgdir;
+  pa2page(PADDR(env->env_pgdir))->pp_ref++;
+
+  env->env_status = ENV_NOT_RUNNABLE;
+  env->env_type = curenv->env_type;
+  env->env_tf = curenv->env_tf;
+  env->env_tf.tf_eip = eip;
+  env->env_tf.tf_esp = esp;
+  env->env_tf.tf_regs.reg_eax = 0;
+  env->env_pgfault_upcall = curenv->env_pgfault_upcall;
+  env->env_uxstacktop = uxstacktop;
+  env->env_kern_cow = curenv->env_kern_cow;
+  return env->env_id;
+}
+
 // Unmap the page of memory at 'va' in the address space of 'envid'.
 // If no page is mapped, the function silently succeeds.
 //
@@ -327,7 +631,9 @@ sys_page_unmap(envid_t envid, void *va)
 
 // Try to send 'value' to the target env 'envid'.
 // If srcva < UTOP, then also send page currently mapped at 'srcva',
-// so that receiver gets a duplicate mapping of the same page.
+// so that receiver gets a duplicate mapping of the same page.  With
+// npages > 1, send the pages at srcva, srcva+PGSIZE, ..., as many as
+// the receiver takes, all with 'perm'.
 //
 // The send fails with a return value of -E_IPC_NOT_RECV if the
 // target is not blocked, waiting for an IPC.
@@ -339,7 +645,8 @@ sys_page_unmap(envid_t envid, void *va)
 //    env_ipc_recving is set to 0 to block future sends;
 //    env_ipc_from is set to the sending envid;
 //    env_ipc_value is set to the 'value' parameter;
-//    env_ipc_perm is set to 'perm' if a page was transferred, 0 otherwise.
+//    env_ipc_perm is set to 'perm' if a page was transferred, 0 otherwise;
+//    env_ipc_npages is set to the number of pages transferred.
 // The target environment is marked runnable again, returning 0
 // from the paused sys_ipc_recv system call.  (Hint: does the
 // sys_ipc_recv function ever actually return?)
@@ -358,18 +665,22 @@ sys_page_unmap(envid_t envid, void *va)
 //	-E_INVAL if srcva < UTOP and perm is inappropriate
 //		(see sys_page_alloc).
 //	-E_INVAL if srcva < UTOP but srcva is not mapped in the caller's
-//		address space.
+//		address space, or the pages run past UTOP.
 //	-E_INVAL if (perm & PTE_W), but srcva is read-only in the
 //		current environment's address space.
+//	Any of these holds for every page sent, and is checked before
+//	any is mapped.
 //	-E_NO_MEM if there's not enough memory to map srcva in envid's
 //		address space.
 static int
-sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, unsigned perm)
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, unsigned perm,
+                 size_t npages)
 {
   // LAB 4: Your code here.
   struct Env *env;
   struct PageInfo *page;
   pte_t *pte;
+  size_t i, n;
   int error;
 
   if ( (error = envid2env(envid, &env, 0)) < 0)
@@ -410,25 +721,35 @@ sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, unsigned perm)
     return -E_IPC_NOT_RECV;
 
   // if env wants page and we want to send page
-  if ( ((uintptr_t) (env->env_ipc_dstva) < UTOP) && ((uintptr_t) srcva < UTOP) ) {
-    if ( PGOFF(srcva) )
+  n = MIN(npages, env->env_ipc_npages);
+  if ( n > 0 && ((uintptr_t) srcva < UTOP) ) {
+    if ( PGOFF(srcva) || n > (UTOP - (uintptr_t) srcva) / PGSIZE )
       return -E_INVAL;
 
     if ( !(perm & (PTE_P | PTE_U)) || (perm & ~PTE_SYSCALL))
       return -E_INVAL;
 
-    if ( !(page = page_lookup(curenv->env_pgdir, srcva, &pte)) )
-      return -E_INVAL;
+    for (i = 0; i < n; i++) {
+      if ( !(page = page_lookup(curenv->env_pgdir, srcva + i * PGSIZE, &pte)) )
+        return -E_INVAL;
 
-    if ( !(*pte & PTE_W) && (perm & PTE_W) )
-      return -E_INVAL;
+      if ( (perm & PTE_W) &&
+           (error = page_writable(curenv->env_pgdir, srcva + i * PGSIZE)) <= 0 )
+        return error ? error : -E_INVAL;
+    }
 
-    if ( (error = page_insert(env->env_pgdir, page, env->env_ipc_dstva, perm)) < 0)
-      return error;
+    for (i = 0; i < n; i++) {
+      page = page_lookup(curenv->env_pgdir, srcva + i * PGSIZE, NULL);
+      if ( (error = page_insert(env->env_pgdir, page,
+                                env->env_ipc_dstva + i * PGSIZE, perm)) < 0)
+        return error;
+    }
 
     env->env_ipc_perm = perm;
+    env->env_ipc_npages = n;
   } else {
     env->env_ipc_perm = 0;
+    env->env_ipc_npages = 0;
   }
     
 
@@ -447,16 +768,20 @@ sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, unsigned perm)
 //
 // If 'dstva' is < UTOP, then you are willing to receive a page of data.
 // 'dstva' is the virtual address at which the sent page should be mapped.
+// With npages > 1, you take up to that many pages there, one after
+// another.
 //
 // This function only returns on error, but the system call will eventually
 // return 0 on success.
 // Return < 0 on error.  Errors are:
-//	-E_INVAL if dstva < UTOP but dstva is not page-aligned.
+//	-E_INVAL if dstva < UTOP but dstva is not page-aligned, or the
+//		pages run past UTOP.
 static int
-sys_ipc_recv(void *dstva)
+sys_ipc_recv(void *dstva, size_t npages)
 {
   // LAB 4: Your code here.
-  if ((uint32_t) dstva < UTOP && PGOFF(dstva))
+  if ((uint32_t) dstva < UTOP &&
+      (PGOFF(dstva) || npages > (UTOP - (uint32_t) dstva) / PGSIZE))
     return -E_INVAL;
 
   /*
@@ -495,10 +820,280 @@ sys_ipc_recv(void *dstva)
 
   if ((uint32_t) dstva < UTOP)
     curenv->env_ipc_dstva = dstva;
+  curenv->env_ipc_npages = (uint32_t) dstva < UTOP ? MAX(npages, 1) : 0;
+
+  return 0;
+}
+
+// Return the current time.
+static int
+sys_time_msec(void)
+{
+  return time_msec();
+}
+
+// Translate the user address 'chan' in the current environment into
+// the physical address that names it as a wait channel.  Environments
+// that map the same shared page at different addresses still agree on
+// the channel.
+//
+// Returns 0 on success, -E_INVAL if chan is above UTOP, not word
+// aligned or not mapped.
+static int
+chan_lookup(void *chan, physaddr_t *pa_store)
+{
+  struct PageInfo *page;
+  pte_t *pte;
+
+  if ((uintptr_t) chan >= UTOP || ((uintptr_t) chan & 3))
+    return -E_INVAL;
+
+  if ( !(page = page_lookup(curenv->env_pgdir, chan, &pte)) || !(*pte & PTE_P) )
+    return -E_INVAL;
+
+  *pa_store = page2pa(page) + PGOFF(chan);
+  return 0;
+}
+
+// Block until another environment calls sys_chan_wakeup on 'chan', but
+// only if the word at 'chan' still holds 'val'.  The comparison and the
+// sleep are atomic with respect to wakeups, so a waker that changes
+// *chan before waking can never be missed.
+//
+// If 'dstva' < UTOP, the sleeper is also willing to receive a page at
+// 'dstva' from the waker (see sys_chan_wakeup).
+// If 'timeout' is nonzero, give up after that many milliseconds.
+//
+// Returns 0 if *chan != val or on timeout or a plain wakeup, the
+// permission of the received page if one was mapped at dstva, and < 0
+// on error.  Errors are:
+//	-E_INVAL if chan is bad (see chan_lookup).
+//	-E_INVAL if dstva < UTOP but dstva is not page-aligned.
+static int
+sys_chan_sleep(void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  physaddr_t pa;
+  int error;
+
+  if ((uintptr_t) dstva < UTOP && PGOFF(dstva))
+    return -E_INVAL;
+
+  if ( (error = chan_lookup(chan, &pa)) < 0)
+    return error;
+
+  if (*(volatile uint32_t *) KADDR(pa) != val)
+    return 0;
+
+  curenv->env_sleep_chan = pa;
+  curenv->env_sleep_dstva = ((uintptr_t) dstva < UTOP) ? dstva : (void *) UTOP;
+  curenv->env_sleep_deadline = timeout ? time_msec() + timeout : 0;
+  curenv->env_status = ENV_NOT_RUNNABLE;
 
   return 0;
 }
 
+// Wake environments sleeping on 'chan'.
+//
+// If 'srcva' >= UTOP, every sleeper is woken and the number of
+// environments woken is returned.
+//
+// If 'srcva' < UTOP, the page mapped there is handed to the first
+// sleeper that asked for a page, mapped at its dstva with 'perm', and
+// only that sleeper is woken.  The caller keeps its own mapping.
+//
+// Returns the number of environments woken, < 0 on error.  Errors are:
+//	-E_INVAL if chan is bad (see chan_lookup).
+//	-E_INVAL if srcva < UTOP and srcva or perm are bad
+//		(see sys_ipc_try_send).
+//	-E_IPC_NOT_RECV if srcva < UTOP but no sleeper asked for a page.
+//	-E_NO_MEM if there's not enough memory to map the page.
+static int
+sys_chan_wakeup(void *chan, void *srcva, int perm)
+{
+  struct PageInfo *page = NULL;
+  struct Env *env;
+  physaddr_t pa;
+  pte_t *pte;
+  int error, i;
+
+  if ( (error = chan_lookup(chan, &pa)) < 0)
+    return error;
+
+  if ((uintptr_t) srcva < UTOP) {
+    if ( PGOFF(srcva) )
+      return -E_INVAL;
+
+    if ( !(perm & (PTE_P | PTE_U)) || (perm & ~PTE_SYSCALL))
+      return -E_INVAL;
+
+    if ( !(page = page_lookup(curenv->env_pgdir, srcva, &pte)) || !(*pte & PTE_P) )
+      return -E_INVAL;
+
+    if ( (perm & PTE_W) &&
+         (error = page_writable(curenv->env_pgdir, srcva)) <= 0 )
+      return error ? error : -E_INVAL;
+  }
+
+  if (!page)
+    return env_wakeup_chan(pa);
+
+  for (i = 0; i < NENV; i++) {
+    env = &envs[i];
+    if (env->env_status != ENV_NOT_RUNNABLE || env->env_sleep_chan != pa ||
+        (uintptr_t) env->env_sleep_dstva >= UTOP)
+      continue;
+
+    if ( (error = page_insert(env->env_pgdir, page, env->env_sleep_dstva, perm)) < 0)
+      return error;
+    env_wakeup(env, perm);
+    return 1;
+  }
+
+  return -E_IPC_NOT_RECV;
+}
+
+// Listen for device interrupt 'irq': each time it fires, the kernel
+// increments the word at 'chan' and wakes environments sleeping on it
+// with sys_chan_sleep.  A null chan stops listening.  Only environments
+// with I/O privileges (the file server) may do this.
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_BAD_ENV if the caller has no I/O privileges, or another
+//		environment is listening for irq.
+//	-E_INVAL if irq can't be listened for (see irq_listen).
+//	-E_INVAL if chan is bad (see chan_lookup).
+static int
+sys_irq_listen(int irq, void *chan)
+{
+  physaddr_t pa;
+  int error;
+
+  if ((curenv->env_tf.tf_eflags & FL_IOPL_MASK) != FL_IOPL_3)
+    return -E_BAD_ENV;
+
+  pa = 0;
+  if (chan && (error = chan_lookup(chan, &pa)) < 0)
+    return error;
+
+  return irq_listen(curenv, irq, pa);
+}
+
+// Return the physical address of the page mapped at 'va', for setting
+// up device DMA.  Only environments with I/O privileges may ask; they
+// can program DMA to any address anyway.
+//
+// Returns the physical address on success, < 0 on error.  Errors are:
+//	-E_BAD_ENV if the caller has no I/O privileges.
+//	-E_INVAL if va >= UTOP, or va is not mapped.
+static int
+sys_page_paddr(void *va)
+{
+  struct PageInfo *page;
+
+  if ((curenv->env_tf.tf_eflags & FL_IOPL_MASK) != FL_IOPL_3)
+    return -E_BAD_ENV;
+
+  if ((uintptr_t) va >= UTOP || !(page = page_lookup(curenv->env_pgdir, va, 0)))
+    return -E_INVAL;
+
+  return page2pa(page);
+}
+
+// Allocate 'n' zeroed pages that are contiguous in physical memory and
+// map them at [va, va+n*PGSIZE) in the caller with permission 'perm',
+// for device queues that must be physically contiguous.  Only
+// environments with I/O privileges may do this.
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_BAD_ENV if the caller has no I/O privileges.
+//	-E_INVAL if the range isn't page-aligned and below UTOP, or n is 0.
+//	-E_INVAL if perm is inappropriate (see sys_page_alloc).
+//	-E_NO_MEM if there's no run of n free pages, or to allocate any
+//		necessary page tables.
+static int
+sys_page_alloc_contig(void *va, size_t n, int perm)
+{
+  struct PageInfo *first;
+  size_t i, j;
+  int error;
+
+  if ((curenv->env_tf.tf_eflags & FL_IOPL_MASK) != FL_IOPL_3)
+    return -E_BAD_ENV;
+
+  if ((uintptr_t) va % PGSIZE != 0 || n == 0 || n > UTOP / PGSIZE ||
+      (uintptr_t) va > UTOP - n * PGSIZE ||
+      (perm & (PTE_U | PTE_P)) != (PTE_U | PTE_P) || (perm & ~PTE_SYSCALL))
+    return -E_INVAL;
+
+  if (!(first = page_alloc_contig(n, ALLOC_ZERO)))
+    return -E_NO_MEM;
+
+  for (i = 0; i < n; i++) {
+    if ((error = page_insert(curenv->env_pgdir, &first[i],
+                             (char *) va + i * PGSIZE, perm)) < 0) {
+      // Unmapping frees the pages already mapped; free the rest.
+      for (j = 0; j < i; j++)
+        page_remove(curenv->env_pgdir, (char *) va + j * PGSIZE);
+      for (j = i; j < n; j++)
+        page_free(&first[j]);
+      return error;
+    }
+  }
+  return 0;
+}
+
+// Run the 'n' system calls in 'calls' in order through syscall(),
+// storing each result in its sc_ret.  Stops after the first call that
+// returns < 0.  Calls that block or switch stacks (sys_yield,
+// sys_ipc_recv, sys_chan_sleep, sys_exofork, sys_fork and sys_batch) get
+// -E_INVAL.  An earlier call may unmap the array or make it read-only
+// (e.g. a PMR_COW range map), so entries are re-checked before each
+// access and the batch stops quietly if one is no longer writable.
+//
+// Returns the number of calls that succeeded, so calls[r].sc_ret holds
+// the error if r < n and the array is still writable.
+// Returns -E_INVAL if n is out of range.
+static int
+sys_batch(struct Syscall *calls, int n)
+{
+  struct Syscall *sc;
+  int i, ret;
+
+  if (n < 0 || n > SYSBATCH_MAX)
+    return -E_INVAL;
+
+  user_mem_assert(curenv, calls, n * sizeof(*calls), PTE_U | PTE_W);
+
+  for (i = 0; i < n; i++) {
+    sc = &calls[i];
+    if (user_mem_check(curenv, sc, sizeof(*sc), PTE_U | PTE_W) < 0)
+      break;
+
+    switch (sc->sc_num) {
+      case SYS_yield:
+      case SYS_ipc_recv:
+      case SYS_chan_sleep:
+      case SYS_exofork:
+      case SYS_fork:
+      case SYS_batch:
+        ret = -E_INVAL;
+        break;
+
+      default:
+        ret = syscall(sc->sc_num, sc->sc_args[0], sc->sc_args[1],
+            sc->sc_args[2], sc->sc_args[3], sc->sc_args[4]);
+    }
+
+    if (user_mem_check(curenv, sc, sizeof(*sc), PTE_U | PTE_W) < 0)
+      return ret < 0 ? i : i + 1;
+    sc->sc_ret = ret;
+    if (ret < 0)
+      break;
+  }
+
+  return i;
+}
+
 // Dispatches to the correct kernel function, passing the arguments.
 int32_t
 syscall(uint32_t syscallno, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
@@ -543,14 +1138,50 @@ syscall(uint32_t syscallno, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4,
       break;
 
     case SYS_ipc_try_send:
-      return sys_ipc_try_send((envid_t) a1, a2, (void *) a3, a4);
+      return sys_ipc_try_send((envid_t) a1, a2, (void *) a3, a4, a5);
 
     case SYS_ipc_recv:
-      return sys_ipc_recv((void *) a1);
+      return sys_ipc_recv((void *) a1, a2);
 
     case SYS_env_set_trapframe:
       return sys_env_set_trapframe((envid_t) a1, (struct Trapframe *) a2);
 
+    case SYS_time_msec:
+      return sys_time_msec();
+
+    case SYS_chan_sleep:
+      return sys_chan_sleep((void *) a1, a2, (void *) a3, a4);
+
+    case SYS_chan_wakeup:
+      return sys_chan_wakeup((void *) a1, (void *) a2, a3);
+
+    case SYS_page_map_range:
+      return sys_page_map_range((envid_t) a1, (void *) a2, a3, (envid_t) a4, a5);
+
+    case SYS_page_protect_range:
+      return sys_page_protect_range((envid_t) a1, (void *) a2, a3, a4);
+
+    case SYS_batch:
+      return sys_batch((struct Syscall *) a1, a2);
+
+    case SYS_env_set_cow:
+      return sys_env_set_cow((envid_t) a1, a2 != 0);
+
+    case SYS_fork:
+      return sys_fork();
+
+    case SYS_irq_listen:
+      return sys_irq_listen(a1, (void *) a2);
+
+    case SYS_page_paddr:
+      return sys_page_paddr((void *) a1);
+
+    case SYS_page_alloc_contig:
+      return sys_page_alloc_contig((void *) a1, a2, a3);
+
+    case SYS_thread_create:
+      return sys_thread_create(a1, a2, a3);
+
     default:
       return -E_INVAL;
   }
@@ -1,6 +1,7 @@
 #include <inc/mmu.h>
 #include <inc/x86.h>
 #include <inc/assert.h>
+#include <inc/error.h>
 
 #include <kern/pmap.h>
 #include <kern/trap.h>
@@ -13,6 +14,7 @@
 #include <kern/picirq.h>
 #include <kern/cpu.h>
 #include <kern/spinlock.h>
+#include <kern/time.h>
 
 // Lab 4
 #include <inc/string.h>
@@ -37,6 +39,17 @@ struct Pseudodesc idt_pd = {
 void (*handlers[256]) (void);
 */
 
+// Device interrupts handed to user environments (sys_irq_listen).  An
+// IRQ has at most one listener.  When the IRQ fires, the word at
+// physical address il_chan is incremented and environments sleeping on
+// it as a wait channel are woken.
+static struct IrqListener {
+  struct Env *il_env;
+  physaddr_t il_chan;           // 0 if nobody is listening
+} irq_listeners[MAX_IRQS];
+
+static void irq_deliver(int irq);
+
 void t_divide();
 void t_debug();
 void t_nmi();
@@ -293,6 +306,15 @@ trap_dispatch(struct Trapframe *tf)
   // Handle clock interrupts. Don't forget to acknowledge the
   // interrupt using lapic_eoi() before calling the scheduler!
   // LAB 4: Your code here.
+  // Add time tick increment to clock interrupts.
+  // Be careful! In multiprocessors, clock interrupts are
+  // triggered on every CPU.
+  if (tf->tf_trapno == IRQ_OFFSET + IRQ_TIMER && cpunum() == 0)
+    time_tick();
+  // Hand other device interrupts to the environment listening for them.
+  if (tf->tf_trapno > IRQ_OFFSET + IRQ_TIMER &&
+      tf->tf_trapno < IRQ_OFFSET + MAX_IRQS)
+    irq_deliver(tf->tf_trapno - IRQ_OFFSET);
   lapic_eoi();
   sched_yield();
 
@@ -309,6 +331,68 @@ trap_dispatch(struct Trapframe *tf)
   }
 }
 
+// Make 'e' the listener for 'irq', counting interrupts in the word at
+// physical address 'chan' (which holds a page reference while it's
+// registered), and unmask the IRQ.  If chan is 0, stop listening and
+// mask it again.
+//
+// Returns 0 on success, -E_INVAL if irq is out of range or owned by the
+// kernel (the timer, the console and the cascade), -E_BAD_ENV if
+// another environment is listening for it.
+int
+irq_listen(struct Env *e, int irq, physaddr_t chan)
+{
+  struct IrqListener *il;
+
+  if (irq <= IRQ_TIMER || irq >= MAX_IRQS || irq == IRQ_KBD ||
+      irq == IRQ_SLAVE || irq == IRQ_SERIAL || irq == IRQ_SPURIOUS)
+    return -E_INVAL;
+
+  il = &irq_listeners[irq];
+  if (il->il_chan && il->il_env != e)
+    return -E_BAD_ENV;
+
+  if (il->il_chan)
+    page_decref(pa2page(il->il_chan));
+  il->il_env = NULL;
+  il->il_chan = 0;
+
+  if (!chan) {
+    irq_setmask_8259A(irq_mask_8259A | (1 << irq));
+    return 0;
+  }
+
+  pa2page(chan)->pp_ref++;
+  il->il_env = e;
+  il->il_chan = chan;
+  irq_setmask_8259A(irq_mask_8259A & ~(1 << irq));
+  return 0;
+}
+
+// Stop 'e' listening for any IRQ; called when it is freed.
+void
+irq_release(struct Env *e)
+{
+  int irq;
+
+  for (irq = 0; irq < MAX_IRQS; irq++)
+    if (irq_listeners[irq].il_chan && irq_listeners[irq].il_env == e)
+      irq_listen(e, irq, 0);
+}
+
+// Acknowledge a device interrupt and notify its listener, if any.
+static void
+irq_deliver(int irq)
+{
+  struct IrqListener *il = &irq_listeners[irq];
+
+  irq_eoi_8259A(irq);
+  if (!il->il_chan)
+    return;
+  (*(volatile uint32_t *) KADDR(il->il_chan))++;
+  env_wakeup_chan(il->il_chan);
+}
+
 void
 trap(struct Trapframe *tf)
 {
@@ -419,15 +503,31 @@ page_fault_handler(struct Trapframe *tf)
   //   (the 'tf' variable points at 'curenv->env_tf').
 
   // LAB 4: Your code here.
+
+  // A write through a page table shared by sys_fork: take our own copy
+  // of the table and retry.  A copy-on-write fault may follow.
+  if ((tf->tf_err & FEC_WR) && fault_va < UTOP &&
+      (curenv->env_pgdir[PDX(fault_va)] & PDE_SHARED) &&
+      pgdir_unshare(curenv->env_pgdir, (void *) fault_va) == 0)
+    env_run(curenv);
+
+  // Environments that opted in (sys_env_set_cow) have copy-on-write
+  // faults resolved right here, without a trip through the upcall.
+  if (curenv->env_kern_cow && (tf->tf_err & FEC_WR) &&
+      page_cow(curenv->env_pgdir, (void *) fault_va) == 0)
+    env_run(curenv);
+
   if (curenv->env_pgfault_upcall) {
     void *stack;
     struct UTrapframe *user_trapframe;
 
-    if ( (UXSTACKTOP - PGSIZE <= (tf->tf_esp - sizeof(struct UTrapframe) - 4)) &&
-        (tf->tf_esp < UXSTACKTOP)) {
+    uintptr_t uxstacktop = curenv->env_uxstacktop;
+
+    if ( (uxstacktop - PGSIZE <= (tf->tf_esp - sizeof(struct UTrapframe) - 4)) &&
+        (tf->tf_esp < uxstacktop)) {
       stack = (void *) (tf->tf_esp - sizeof(struct UTrapframe) - 4);
     } else {
-      stack = (void *) (UXSTACKTOP - sizeof(struct UTrapframe));
+      stack = (void *) (uxstacktop - sizeof(struct UTrapframe));
     }
 
     user_mem_assert(curenv,
@@ -20,4 +20,8 @@ void print_trapframe(struct Trapframe *tf);
 void page_fault_handler(struct Trapframe *);
 void backtrace(struct Trapframe *);
 
+struct Env;
+int irq_listen(struct Env *e, int irq, physaddr_t chan);
+void irq_release(struct Env *e);
+
 #endif /* JOS_KERN_TRAP_H */
@@ -6,14 +6,14 @@
 #define MAXFD           32
 // Bottom of file descriptor area
 #define FDTABLE         0xD0000000
-// Bottom of file data area.  We reserve one data page for each FD,
+// Bottom of file data area.  We reserve FDDATASIZE bytes for each FD,
 // which devices can use if they choose.
 #define FILEDATA        (FDTABLE + MAXFD*PGSIZE)
 
 // Return the 'struct Fd*' for file descriptor index i
 #define INDEX2FD(i)     ((struct Fd*)(FDTABLE + (i)*PGSIZE))
 // Return the file data page for file descriptor index i
-#define INDEX2DATA(i)   ((char*)(FILEDATA + (i)*PGSIZE))
+#define INDEX2DATA(i)   ((char*)(FILEDATA + (i)*FDDATASIZE))
 
 
 // --------------------------------------------------------------
@@ -178,6 +178,7 @@ dup(int oldfdnum, int newfdnum)
 {
   int r;
   char *ova, *nva;
+  size_t off;
   pte_t pte;
   struct Fd *oldfd, *newfd;
 
@@ -189,9 +190,11 @@ dup(int oldfdnum, int newfdnum)
   ova = fd2data(oldfd);
   nva = fd2data(newfd);
 
-  if ((uvpd[PDX(ova)] & PTE_P) && (uvpt[PGNUM(ova)] & PTE_P))
-    if ((r = sys_page_map(0, ova, 0, nva, uvpt[PGNUM(ova)] & PTE_SYSCALL)) < 0)
-      goto err;
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+        goto err;
   if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
     goto err;
 
@@ -199,7 +202,8 @@ dup(int oldfdnum, int newfdnum)
 
 err:
   sys_page_unmap(0, newfd);
-  sys_page_unmap(0, nva);
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+    sys_page_unmap(0, nva + off);
   return r;
 }
 
@@ -310,15 +314,10 @@ fstat(int fdnum, struct Stat *stat)
   return (*dev->dev_stat)(fd, stat);
 }
 
+// Paths name files, so this is file_stat, in one round trip.
 int
 stat(const char *path, struct Stat *stat)
 {
-  int fd, r;
-
-  if ((fd = open(path, O_RDONLY)) < 0)
-    return fd;
-  r = fstat(fd, stat);
-  close(fd);
-  return r;
+  return file_stat(path, stat);
 }
 
@@ -6,6 +6,70 @@
 
 union Fsipc fsipcbuf __attribute__((aligned(PGSIZE)));
 
+// Vectored requests (FSREQ_READV and FSREQ_WRITEV) are built at FSVBUF,
+// below the mmap region (lib/mmap.c): the request page, then up to
+// FSV_MAXPAGES data pages at FSVDATA.  Readv replies land at FSVDATA.
+#define FSVBUF          0x9FC00000
+#define FSVDATA         ((char *) FSVBUF + PGSIZE)
+
+static union Fsipc *fsvreq = (union Fsipc *) FSVBUF;
+static struct SysBatch fsv_batch;
+
+// The file server's workers (fs/serv.c): every ENV_TYPE_FS environment.
+static envid_t fsenvs[FS_MAXWORKERS];
+static int nfsenvs;
+
+static void
+fsipc_find(void)
+{
+  int i;
+
+  nfsenvs = 0;
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+      fsenvs[nfsenvs++] = envs[i].env_id;
+}
+
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  int i, first, r;
+
+  for (;;) {
+    // Workers may still be starting.
+    if (nfsenvs < FS_NWORKERS)
+      fsipc_find();
+    first = ENVX(thisenv->env_id);
+    for (i = 0; i < nfsenvs; i++) {
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+    }
+    sys_yield();
+  }
+}
+
+// Send the 'nsend' request pages at 'req' to the file server, and wait
+// for a reply, taking up to *nrecv reply pages at 'dstva' and setting
+// *nrecv to the number taken.
+static int
+fsipc_pages(unsigned type, void *req, size_t nsend, void *dstva,
+            size_t *nrecv)
+{
+  if (debug)
+    cprintf("[%08x] fsipc %d %08x (%d pages)\n", thisenv->env_id, type,
+            *(uint32_t*)req, nsend);
+
+  fsipc_send(type, req, nsend);
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+}
+
 // Send an inter-environment request to the file server, and wait for
 // a reply.  The request body should be in fsipcbuf, and parts of the
 // response may be written back to fsipcbuf.
@@ -15,18 +79,32 @@ union Fsipc fsipcbuf __attribute__((aligned(PGSIZE)));
 static int
 fsipc(unsigned type, void *dstva)
 {
-  static envid_t fsenv;
-
-  if (fsenv == 0)
-    fsenv = ipc_find_env(ENV_TYPE_FS);
+  size_t npages = 1;
 
   static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
 
-  if (debug)
-    cprintf("[%08x] fsipc %d %08x\n", thisenv->env_id, type, *(uint32_t*)&fsipcbuf);
+// Make the first 'npages' pages at FSVBUF private and writable.  A readv
+// reply leaves the server's read-only pages there, and fork leaves
+// copy-on-write ones.
+static int
+fsv_alloc(size_t npages)
+{
+  uintptr_t va;
+  size_t i;
+  int r;
 
-  ipc_send(fsenv, type, &fsipcbuf, PTE_P | PTE_W | PTE_U);
-  return ipc_recv(NULL, dstva, NULL);
+  for (i = 0; i < npages; i++) {
+    va = FSVBUF + i * PGSIZE;
+    if ((uvpd[PDX(va)] & PTE_P) &&
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+      continue;
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+                          PTE_P | PTE_U | PTE_W, 0, 0)) < 0)
+      return r;
+  }
+  return sysbatch_flush(&fsv_batch);
 }
 
 static int devfile_flush(struct Fd *fd);
@@ -34,6 +112,9 @@ static ssize_t devfile_read(struct Fd *fd, void *buf, size_t n);
 static ssize_t devfile_write(struct Fd *fd, const void *buf, size_t n);
 static int devfile_stat(struct Fd *fd, struct Stat *stat);
 static int devfile_trunc(struct Fd *fd, off_t newsize);
+static int devfile_read_map(struct Fd *fd, off_t offset, void *dstva);
+static ssize_t devfile_readv(struct Fd *fd, void *buf, size_t n);
+static ssize_t devfile_writev(struct Fd *fd, const void *buf, size_t n);
 
 struct Dev devfile =
 {
@@ -89,6 +170,80 @@ open(const char *path, int mode)
   return fd2num(fd);
 }
 
+// Open 'path' in mode 'mode' and read up to 'n' bytes from its start
+// into 'buf', in one FSREQ_COMPOUND round trip rather than two.  Sets
+// *nread to the bytes read; the seek position stays at 0.
+//
+// Returns the file descriptor index on success, < 0 on error.
+int
+open_read(const char *path, int mode, void *buf, size_t n, ssize_t *nread)
+{
+  struct Fsreq_compound *req = &fsipcbuf.compound;
+  size_t pathlen;
+  struct Fd *fd;
+  int r;
+
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+    return -E_BAD_PATH;
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  if ((r = fd_alloc(&fd)) < 0)
+    return r;
+
+  strcpy(req->req_buf, path);
+  req->req_nops = 2;
+  req->req_ops[0].op_type = FSOP_OPEN;
+  req->req_ops[0].op_arg = mode;
+  req->req_ops[0].op_buf = 0;
+  req->req_ops[1].op_type = FSOP_READ;
+  req->req_ops[1].op_step = 1;
+  req->req_ops[1].op_arg = n;
+  req->req_ops[1].op_offset = 0;
+  req->req_ops[1].op_buf = pathlen + 1;
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+    fd_close(fd, 0);
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  }
+
+  *nread = req->req_ops[1].op_ret;
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  return fd2num(fd);
+}
+
+// Stat the file at 'path' without opening it: one FSREQ_COMPOUND round
+// trip where open, fstat and close take three.
+//
+// Returns 0 on success, < 0 on error.
+int
+file_stat(const char *path, struct Stat *st)
+{
+  struct Fsreq_compound *req = &fsipcbuf.compound;
+  struct Fsret_stat *ret;
+  size_t off;
+  int r;
+
+  if (strlen(path) >= MAXPATHLEN)
+    return -E_BAD_PATH;
+
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  strcpy(req->req_buf, path);
+  req->req_nops = 2;
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  req->req_ops[0].op_arg = O_RDONLY;
+  req->req_ops[0].op_buf = 0;
+  req->req_ops[1].op_type = FSOP_STAT;
+  req->req_ops[1].op_step = 1;
+  req->req_ops[1].op_buf = off;
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+    return r < 0 ? r : req->req_ops[r].op_ret;
+
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  strcpy(st->st_name, ret->ret_name);
+  st->st_size = ret->ret_size;
+  st->st_isdir = ret->ret_isdir;
+  st->st_dev = &devfile;
+  return 0;
+}
+
 // Flush the file descriptor.  After this the fileid is invalid.
 //
 // This function is called by fd_close.  fd_close will take care of
@@ -118,6 +273,10 @@ devfile_read(struct Fd *fd, void *buf, size_t n)
   // system server.
   int r;
 
+  // A page or more comes in one FSREQ_READV instead.
+  if (n >= PGSIZE)
+    return devfile_readv(fd, buf, n);
+
   fsipcbuf.read.req_fileid = fd->fd_file.id;
   fsipcbuf.read.req_n = n;
   if ((r = fsipc(FSREQ_READ, NULL)) < 0)
@@ -128,6 +287,94 @@ devfile_read(struct Fd *fd, void *buf, size_t n)
   return r;
 }
 
+// Can a page sent by the server be mapped over 'buf' copy-on-write,
+// rather than copied there?  Only if buf is a whole page of our own that
+// we may write.
+static bool
+can_remap(void *buf)
+{
+  pte_t pte;
+
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+    return 0;
+  pte = uvpt[PGNUM(buf)];
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+    return 0;
+
+  // Writing buf must then copy the page, whether or not this
+  // environment ever set up the fork page fault handler.
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+}
+
+// Read up to 'n' bytes, n >= PGSIZE, with one FSREQ_READV.  The server
+// sends its cache pages holding them, up to FSV_MAXPAGES, at FSVDATA.
+// Whole pages are mapped into buf copy-on-write when buf lines up with
+// the file; the rest is copied once.
+static ssize_t
+devfile_readv(struct Fd *fd, void *buf, size_t n)
+{
+  size_t npages, done, m;
+  char *src, *dst;
+  bool failed;
+  int r;
+
+  if ((r = fsv_alloc(1)) < 0)
+    return r;
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  fsvreq->readv.req_offset = fd->fd_offset;
+  fsvreq->readv.req_n = n;
+  npages = FSV_MAXPAGES;
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+    return r;
+  assert(r <= n);
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  dst = buf;
+  failed = 0;
+  for (done = 0; done < r; done += m) {
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+    if (m == PGSIZE && can_remap(dst + done))
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+                             (uint32_t) src + done, 0,
+                             (uint32_t) dst + done,
+                             PTE_P | PTE_U | PTE_COW) < 0;
+    else
+      memmove(dst + done, src + done, m);
+  }
+  // Should a mapping fail, copy everything instead.
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+    memmove(dst, src, r);
+  fd->fd_offset += r;
+  return r;
+}
+
+static int
+devfile_read_map(struct Fd *fd, off_t offset, void *dstva)
+{
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  fsipcbuf.read_map.req_offset = offset;
+  return fsipc(FSREQ_READ_MAP, dstva);
+}
+
+// Map the page of file 'fdnum' at 'offset', which must be page-aligned,
+// read-only at 'dstva', sharing the file server's cached copy instead
+// of copying it.  Returns how many of the page's bytes are in the file;
+// at the end of the file, returns 0 and maps nothing.  Doesn't move the
+// seek position.
+int
+read_map(int fdnum, off_t offset, void *dstva)
+{
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+    return -E_INVAL;
+  return devfile_read_map(fd, offset, dstva);
+}
+
 
 // Write at most 'n' bytes from 'buf' to 'fd' at the current seek position.
 //
@@ -144,7 +391,9 @@ devfile_write(struct Fd *fd, const void *buf, size_t n)
   // LAB 5: Your code here
   int r;
 
-  n = MIN(n, sizeof(fsipcbuf.write.req_buf));
+  // More than fits in the request page goes in one FSREQ_WRITEV.
+  if (n > sizeof(fsipcbuf.write.req_buf))
+    return devfile_writev(fd, buf, n);
 
   fsipcbuf.write.req_fileid = fd->fd_file.id;
   fsipcbuf.write.req_n = n;
@@ -153,6 +402,25 @@ devfile_write(struct Fd *fd, const void *buf, size_t n)
   return fsipc(FSREQ_WRITE, NULL);
 }
 
+// Write up to FSV_MAXPAGES pages of 'buf' with one FSREQ_WRITEV: copy
+// them to the pages after the request at FSVBUF and send them all.
+static ssize_t
+devfile_writev(struct Fd *fd, const void *buf, size_t n)
+{
+  size_t npages, nrecv;
+  int r;
+
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  if ((r = fsv_alloc(1 + npages)) < 0)
+    return r;
+  memmove(FSVDATA, buf, n);
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  fsvreq->writev.req_n = n;
+  nrecv = 0;
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+}
+
 static int
 devfile_stat(struct Fd *fd, struct Stat *st)
 {
@@ -187,3 +455,100 @@ sync(void)
   return fsipc(FSREQ_SYNC, NULL);
 }
 
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  fsipcbuf.stats.req_bio_sched = 0;
+  fsipcbuf.stats.req_dcache = 0;
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+    return r;
+  *st = fsipcbuf.statsRet;
+  return 0;
+}
+
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+    return r;
+  capacity = st.ret_bc_capacity;
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+    return r;
+  return fs_stats(capacity, &st);
+}
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  fsipcbuf.stats.req_bc_capacity = 0;
+  fsipcbuf.stats.req_bio_sched = sched;
+  fsipcbuf.stats.req_dcache = 0;
+  return fsipc(FSREQ_STATS, NULL);
+}
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  fsipcbuf.stats.req_bc_capacity = 0;
+  fsipcbuf.stats.req_bio_sched = 0;
+  fsipcbuf.stats.req_dcache = setting;
+  return fsipc(FSREQ_STATS, NULL);
+}
+
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  fsipcbuf.fallocate.req_offset = offset;
+  fsipcbuf.fallocate.req_len = len;
+  return fsipc(FSREQ_FALLOCATE, NULL);
+}
+
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+    fsipcbuf.prefetch.req_n = m;
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+      return r;
+  }
+  return 0;
+}
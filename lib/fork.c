@@ -3,10 +3,6 @@
 #include <inc/string.h>
 #include <inc/lib.h>
 
-// PTE_COW marks copy-on-write page table entries.
-// It is one of the bits explicitly allocated to user processes (PTE_AVAIL).
-#define PTE_COW         0x800
-
 //
 // Custom page fault handler - if faulting page is copy-on-write,
 // map in our own private writable copy.
@@ -24,6 +20,10 @@ pgfault(struct UTrapframe *utf)
   //   Use the read-only page table mappings at uvpt
   //   (see <inc/memlayout.h>).
 
+  // Faults in file mappings are mmap's to handle.
+  if (mmap_fault(utf))
+    return;
+
   // LAB 4: Your code here.
   if ( !(err & FEC_WR) ) {
     panic("user_pgfault: %e", err);
@@ -60,50 +60,6 @@ pgfault(struct UTrapframe *utf)
   }
 }
 
-//
-// Map our virtual page pn (address pn*PGSIZE) into the target envid
-// at the same virtual address.  If the page is writable or copy-on-write,
-// the new mapping must be created copy-on-write, and then our mapping must be
-// marked copy-on-write as well.  (Exercise: Why do we need to mark ours
-// copy-on-write again if it was already copy-on-write at the beginning of
-// this function?)
-//
-// Returns: 0 on success, < 0 on error.
-// It is also OK to panic on error.
-//
-static int
-duppage(envid_t envid, unsigned pn)
-{
-  int r;
-
-  // LAB 4: Your code here.
-  void *addr = (void *) (pn << PGSHIFT);
-  pte_t pte = uvpt[pn];
-
-  // if page isnt COW or W, map in as is
-  if ( !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE) ) {
-    if ( (r = sys_page_map(0, addr, envid, addr, (pte & PTE_SYSCALL))) < 0) {
-      panic("sys_page_map: %e", r);
-    }
-    return 0;
-  }
-
-  // otherwise copy into both as COW
-  if ( (r = sys_page_map(0, addr, envid, addr, (PTE_COW | PTE_U | PTE_P))) < 0) {
-    panic("sys_page_map: %e", r);
-  }
-
-  if ( (r = sys_page_map(0, addr, 0, addr, (PTE_COW | PTE_U | PTE_P))) < 0) {
-    panic("sys_page_map: %e", r);
-  } 
-
-  if (uvpt[pn] & PTE_W) {
-    panic("nothing should be PTE_W");
-  }
-
-  return 0;
-}
-
 //
 // User-level fork with copy-on-write.
 // Set up our page fault handler appropriately.
@@ -114,18 +70,16 @@ duppage(envid_t envid, unsigned pn)
 // Returns: child's envid to the parent, 0 to the child, < 0 on error.
 // It is also OK to panic on error.
 //
-// Hint:
-//   Use uvpd, uvpt, and duppage.
-//   Remember to fix "thisenv" in the child process.
-//   Neither user exception stack should ever be marked copy-on-write,
-//   so you must allocate a new page for the child's user exception stack.
+// Everything below the user exception stack is copied in a single
+// sys_page_map_range call; the kernel marks writable pages copy-on-write
+// in both environments at once.  Neither user exception stack should
+// ever be marked copy-on-write, so the child gets a fresh one.
 //
 envid_t
 fork(void)
 {
   // LAB 4: Your code here.
   envid_t envid, parent_id;
-  uint32_t pn, cur, end;
   int error;
 
   parent_id = sys_getenvid();
@@ -146,21 +100,9 @@ fork(void)
   }
 
   // we are the parent
-  for (pn = 0; pn < PGNUM(UTOP); pn += NPTENTRIES) {
-    if ( !(uvpd[pn >> (PDXSHIFT - PTXSHIFT)] & PTE_P) )
-      continue;
-
-    cur = pn;
-    end = cur + NPTENTRIES;
-    for ( ; cur < end; cur++) {
-      if (cur == PGNUM(UXSTACKTOP - 1))
-        continue;
-
-      if ( !(uvpt[cur] & (PTE_P | PTE_U)) )
-        continue;
-      
-      duppage(envid, cur);
-    }
+  if ( (error = sys_page_map_range(0, 0, UXSTACKTOP - PGSIZE,
+          envid, PMR_COW)) < 0) {
+    panic("sys_page_map_range: %e", error);
   }
 
   // allocate new page for child system
@@ -183,6 +125,24 @@ fork(void)
   return envid;
 }
 
+//
+// Fork with sys_fork: the kernel shares our page tables with the child
+// and copies each one on the first write to its 4MB region, so this
+// stays cheap however large the address space is.  Copy-on-write
+// faults that follow still go to pgfault.
+//
+envid_t
+kfork(void)
+{
+  envid_t envid;
+
+  set_pgfault_handler(pgfault);
+
+  if ((envid = sys_fork()) == 0)
+    thisenv = &envs[ENVX(sys_getenvid())];
+  return envid;
+}
+
 // Challenge!
 //
 static void
@@ -194,6 +154,9 @@ shared_pgfault(struct UTrapframe *utf)
   uint32_t err = utf->utf_err;
   int r;
 
+  if (mmap_fault(utf))
+    return;
+
   addr = ROUNDDOWN(addr, PGSIZE);
 
   // map page to temporary location
@@ -214,27 +177,10 @@ shared_pgfault(struct UTrapframe *utf)
   }
 }
 
-static int
-shared_duppage(envid_t envid, unsigned pn)
-{
-  int r;
-
-  void *addr = (void *) (pn << PGSHIFT);
-  pte_t pte = uvpt[pn];
-
-  // if page isnt COW or W, map in as is
-  if ( (r = sys_page_map(0, addr, envid, addr, (pte & PTE_SYSCALL))) < 0) {
-    panic("sys_page_map: %e", r);
-  }
-
-  return 0;
-}
-
 int
 sfork(void)
 {
   envid_t envid, parent_id;
-  uint32_t pn, cur, end;
   int error;
 
   parent_id = sys_getenvid();
@@ -253,26 +199,16 @@ sfork(void)
     return 0;
   }
 
-  // we are the parent
-  for (pn = 0; pn < PGNUM(UTOP); pn += NPTENTRIES) {
-    if ( !(uvpd[pn >> (PDXSHIFT - PTXSHIFT)] & PTE_P) )
-      continue;
-
-    cur = pn;
-    end = cur + NPTENTRIES;
-    for ( ; cur < end; cur++) {
-      if (cur == PGNUM(UXSTACKTOP - 1))
-        continue;
-
-      if ( !(uvpt[cur] & (PTE_P | PTE_U)) )
-        continue;
-
-      if (cur == PGNUM(USTACKTOP - 1)) {
-        duppage(envid, cur);
-      } else {
-        shared_duppage(envid, cur);
-      }
-    }
+  // we are the parent: share everything but the stack, which is
+  // copy-on-write
+  if ( (error = sys_page_map_range(0, 0, USTACKTOP - PGSIZE,
+          envid, PMR_SAME)) < 0) {
+    panic("sys_page_map_range: %e", error);
+  }
+
+  if ( (error = sys_page_map_range(0, (void *) (USTACKTOP - PGSIZE), PGSIZE,
+          envid, PMR_COW)) < 0) {
+    panic("sys_page_map_range: %e", error);
   }
 
   // allocate new page for child system
@@ -21,6 +21,17 @@
 //   a perfectly valid place to map a page.)
 int32_t
 ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
+{
+  size_t npages = 1;
+
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+}
+
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
 {
   // LAB 4: Your code here.
   int error;
@@ -28,14 +39,16 @@ ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
   if (!pg)
     pg = (void *) UTOP;
 
-  if ( (error = sys_ipc_recv(pg)) < 0) {
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
     if (from_env_store) *from_env_store = 0;
     if (perm_store) *perm_store = 0;
+    *npages = 0;
     return error;
   }
 
   if (from_env_store) *from_env_store = thisenv->env_ipc_from;
   if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  *npages = thisenv->env_ipc_npages;
 
   return thisenv->env_ipc_value;
 }
@@ -50,6 +63,15 @@ ipc_recv(envid_t *from_env_store, void *pg, int *perm_store)
 //   as meaning "no page".  (Zero is not the right value.)
 void
 ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
+{
+  ipc_send_pages(to_env, val, pg, 1, perm);
+}
+
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
 {
   // LAB 4: Your code here.
   int error;
@@ -57,7 +79,7 @@ ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
   pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
 
   /*
-  if ( (error = sys_ipc_try_send(to_env, val, pg, perm)) < 0)
+  if ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0)
     return error;
 
   sys_yield();
@@ -65,7 +87,7 @@ ipc_send(envid_t to_env, uint32_t val, void *pg, int perm)
   return 0;
   */
 
-  while ( (error = sys_ipc_try_send(to_env, val, pg, perm)) < 0) {
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
     if (error != -E_IPC_NOT_RECV)
       panic("ipc_send: %e", error);
     sys_yield();
@@ -0,0 +1,235 @@
+// File mappings.  mmap reserves address space and records where it
+// maps to; pages come in on first touch, through the page fault
+// handler, as the file server's own block cache pages (read_map).
+// Those are mapped read-only.  A write to a writable mapping gets a
+// private copy of the page: for MAP_PRIVATE that is all, and for
+// MAP_SHARED msync later writes the copy back to the file.
+
+#include <inc/lib.h>
+
+// Mappings go in [MMAPBASE, MMAPTOP), below the fd table (lib/fd.c).
+#define MMAPBASE        0xA0000000
+#define MMAPTOP         0xD0000000
+#define NMMAP           16
+
+struct Mmap {
+  uintptr_t mm_va;      // 0 if the slot is free
+  size_t mm_len;        // a multiple of PGSIZE
+  int mm_fd;
+  off_t mm_offset;      // page-aligned
+  int mm_perm;          // MAP_*
+};
+
+static struct Mmap mmaps[NMMAP];
+
+extern union Fsipc fsipcbuf;
+extern void (*_pgfault_handler)(struct UTrapframe *utf);
+
+static void
+mmap_pgfault(struct UTrapframe *utf)
+{
+  if (!mmap_fault(utf))
+    panic("page fault at %08x, eip %08x, err %04x", utf->utf_fault_va,
+          utf->utf_eip, utf->utf_err);
+}
+
+static struct Mmap *
+mmap_find(uintptr_t va)
+{
+  int i;
+
+  for (i = 0; i < NMMAP; i++)
+    if (mmaps[i].mm_va && va >= mmaps[i].mm_va &&
+        va < mmaps[i].mm_va + mmaps[i].mm_len)
+      return &mmaps[i];
+  return NULL;
+}
+
+static bool
+va_mapped(uintptr_t va)
+{
+  return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+}
+
+// Replace the page at 'va' with a copy of its first 'n' bytes, the rest
+// zeroed, mapped with 'perm'.
+static void
+mmap_copy(uintptr_t va, size_t n, int perm)
+{
+  int r;
+
+  if ((r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+    panic("mmap: %e", r);
+  memmove(PFTEMP, (void *) va, n);
+  if ((r = sys_page_map(0, PFTEMP, 0, (void *) va, perm)) < 0 ||
+      (r = sys_page_unmap(0, PFTEMP)) < 0)
+    panic("mmap: %e", r);
+}
+
+// Handle a page fault in a mapping, if it is one.  Returns 1 if it was.
+// The fork page fault handlers call this first, so that mappings keep
+// working after a fork.
+bool
+mmap_fault(struct UTrapframe *utf)
+{
+  struct Fsreq_read_map saved;
+  struct Mmap *m;
+  uintptr_t va;
+  int perm, r;
+
+  va = ROUNDDOWN(utf->utf_fault_va, PGSIZE);
+  if (va < MMAPBASE || va >= MMAPTOP || (m = mmap_find(va)) == NULL)
+    return 0;
+  if ((utf->utf_err & FEC_WR) && m->mm_perm == MAP_RDONLY)
+    return 0;
+  perm = PTE_P | PTE_U | (m->mm_perm == MAP_RDONLY ? 0 : PTE_W);
+
+  if (!va_mapped(va)) {
+    // The fault may have hit in the middle of a request built in
+    // fsipcbuf, say a write from this mapping: keep what read_map
+    // overwrites.
+    saved = fsipcbuf.read_map;
+    r = read_map(m->mm_fd, m->mm_offset + (va - m->mm_va), (void *) va);
+    fsipcbuf.read_map = saved;
+    if (r < 0)
+      panic("mmap: read_map: %e", r);
+
+    // Past the end of the file, the page is zeros.
+    if (r == 0) {
+      if ((r = sys_page_alloc(0, (void *) va, perm)) < 0)
+        panic("mmap: %e", r);
+      return 1;
+    }
+    // The server's page may hold stale bytes past the end.
+    if (r < PGSIZE) {
+      mmap_copy(va, r, perm);
+      return 1;
+    }
+  }
+
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+    mmap_copy(va, PGSIZE, perm);
+  return 1;
+}
+
+// Map 'len' bytes of open file 'fdnum' from 'offset', which must be
+// page-aligned, and set *addr to where.  perm is MAP_RDONLY, or
+// MAP_PRIVATE or MAP_SHARED for a writable mapping whose writes stay
+// private or reach the file on msync.  Nothing is read until a page is
+// touched.  The file must stay open until munmap.
+//
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_INVAL if offset isn't aligned, len is 0, or perm is unknown
+//	-E_NO_MEM if there's no free slot or address space for it
+int
+mmap(int fdnum, off_t offset, size_t len, int perm, void **addr)
+{
+  struct Fd *fd;
+  uintptr_t va;
+  int i, j, r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+    return r;
+  if (offset < 0 || PGOFF(offset) || len == 0 ||
+      (perm != MAP_RDONLY && perm != MAP_PRIVATE && perm != MAP_SHARED))
+    return -E_INVAL;
+  len = ROUNDUP(len, PGSIZE);
+
+  // First fit: try the start of the region and the end of each
+  // mapping.
+  for (i = -1; i < NMMAP; i++) {
+    if (i >= 0 && !mmaps[i].mm_va)
+      continue;
+    va = i < 0 ? MMAPBASE : mmaps[i].mm_va + mmaps[i].mm_len;
+    if (len > MMAPTOP - va)
+      continue;
+    for (j = 0; j < NMMAP; j++)
+      if (mmaps[j].mm_va && va < mmaps[j].mm_va + mmaps[j].mm_len &&
+          mmaps[j].mm_va < va + len)
+        break;
+    if (j == NMMAP)
+      break;
+  }
+  if (i == NMMAP)
+    return -E_NO_MEM;
+  for (j = 0; j < NMMAP && mmaps[j].mm_va; j++)
+    ;
+  if (j == NMMAP)
+    return -E_NO_MEM;
+
+  if (_pgfault_handler == 0)
+    set_pgfault_handler(mmap_pgfault);
+
+  mmaps[j].mm_va = va;
+  mmaps[j].mm_len = len;
+  mmaps[j].mm_fd = fdnum;
+  mmaps[j].mm_offset = offset;
+  mmaps[j].mm_perm = perm;
+  *addr = (void *) va;
+  return 0;
+}
+
+// Write the pages of the mapping at 'addr' that have changed since the
+// last msync back to its file, no further than the file's end.  Does
+// nothing for other kinds of mapping.
+//
+// Returns 0 on success, < 0 on error.
+int
+msync(void *addr)
+{
+  struct Mmap *m;
+  struct Fd *fd;
+  struct Stat st;
+  off_t saved, off;
+  uintptr_t va;
+  int n, r;
+
+  if ((m = mmap_find((uintptr_t) addr)) == NULL)
+    return -E_INVAL;
+  if (m->mm_perm != MAP_SHARED)
+    return 0;
+  if ((r = fd_lookup(m->mm_fd, &fd)) < 0 || (r = fstat(m->mm_fd, &st)) < 0)
+    return r;
+
+  saved = fd->fd_offset;
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE) {
+    if (!va_mapped(va) || !(uvpt[PGNUM(va)] & PTE_D))
+      continue;
+    off = m->mm_offset + (va - m->mm_va);
+    if (off >= st.st_size)
+      break;
+    n = MIN(PGSIZE, st.st_size - off);
+    if ((r = seek(m->mm_fd, off)) < 0 ||
+        (r = write(m->mm_fd, (void *) va, n)) < 0)
+      break;
+    if (r < n && (r = write(m->mm_fd, (char *) va + r, n - r)) < 0)
+      break;
+    // Remapping clears PTE_D.
+    if ((r = sys_page_map(0, (void *) va, 0, (void *) va,
+                          PTE_P | PTE_U | PTE_W)) < 0)
+      break;
+  }
+  fd->fd_offset = saved;
+  return r < 0 ? r : 0;
+}
+
+// Remove the mapping at 'addr', writing a MAP_SHARED one back first.
+//
+// Returns 0 on success, < 0 on error.
+int
+munmap(void *addr)
+{
+  struct Mmap *m;
+  uintptr_t va;
+  int r;
+
+  if ((m = mmap_find((uintptr_t) addr)) == NULL)
+    return -E_INVAL;
+  if ((r = msync(addr)) < 0)
+    return r;
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE)
+    if (va_mapped(va) && (r = sys_page_unmap(0, (void *) va)) < 0)
+      return r;
+  m->mm_va = 0;
+  return 0;
+}
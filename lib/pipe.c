@@ -1,4 +1,5 @@
 #include <inc/lib.h>
+#include <inc/x86.h>
 
 #define debug 0
 
@@ -19,19 +20,51 @@ struct Dev devpipe =
 
 #define PIPEBUFSIZ 32           // small to provoke races
 
+// Bulk pipes keep their data in a ring of PIPERINGPAGES pages mapped
+// right after the struct Pipe page in the fd data area.
+#define PIPERINGPAGES   8
+#define PIPERINGSIZ     (PIPERINGPAGES * PGSIZE)
+
+// How long a blocked bulk reader or writer sleeps before rechecking
+// whether the other end has gone away.  Closing an end wakes the other
+// side, so this only matters if an environment dies without closing.
+#define PIPESLEEPMS     100
+
 struct Pipe {
   off_t p_rpos;                 // read position
   off_t p_wpos;                 // write position
   uint8_t p_buf[PIPEBUFSIZ];    // data buffer
+  // PIPE_BULK only
+  uint32_t p_bulk;              // nonzero if data lives in the ring
+  uint32_t p_rsleep;            // a reader is (about to be) asleep on p_wpos
+  uint32_t p_wsleep;            // a writer is (about to be) asleep on p_rpos
 };
 
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+}
+
 int
 pipe(int pfd[2])
 {
-  int r;
+  return pipe2(pfd, 0);
+}
+
+// Create a pipe.  'mode' is 0 for a classic one-page pipe or PIPE_BULK
+// for a pipe with a multi-page ring, bulk copies, and blocking rather
+// than spinning readers and writers.
+int
+pipe2(int pfd[2], int mode)
+{
+  int r, i;
   struct Fd *fd0, *fd1;
   void *va;
 
+  static_assert(PGSIZE + PIPERINGSIZ <= FDDATASIZE);
+
   // allocate the file descriptor table entries
   if ((r = fd_alloc(&fd0)) < 0
       || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
@@ -48,6 +81,19 @@ pipe(int pfd[2])
   if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
     goto err3;
 
+  // the ring follows the struct Pipe page in both
+  if (mode & PIPE_BULK) {
+    for (i = 0; i < PIPERINGPAGES; i++) {
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+                              PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+                               0, pipe_ring(fd1) + i*PGSIZE,
+                               PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+        goto err4;
+    }
+    ((struct Pipe*) va)->p_bulk = 1;
+  }
+
   // set up fd structures
   fd0->fd_dev_id = devpipe.dev_id;
   fd0->fd_omode = O_RDONLY;
@@ -62,6 +108,12 @@ pipe(int pfd[2])
   pfd[1] = fd2num(fd1);
   return 0;
 
+err4:
+  for (i = 0; i < PIPERINGPAGES; i++) {
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  }
+  sys_page_unmap(0, fd2data(fd1));
 err3:
   sys_page_unmap(0, va);
 err2:
@@ -101,6 +153,161 @@ pipeisclosed(int fdnum)
   return _pipeisclosed(fd, p);
 }
 
+// Sleep until *pos no longer equals 'val', the other end wakes us,
+// or PIPESLEEPMS passes.  'flag' tells the other end that somebody
+// needs a wakeup; the locked xchg orders setting it before the
+// recheck of *pos the kernel does for us.  If 'dstva' is not null,
+// accept a page handed over by pipe_splice there.
+//
+// Returns the permission of the page received at dstva, 0 otherwise.
+static int
+pipe_sleep(volatile uint32_t *flag, volatile off_t *pos, off_t val, void *dstva)
+{
+  int r;
+
+  xchg(flag, 1);
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  return r < 0 ? 0 : r;
+}
+
+// Wake whoever is asleep on *pos, if anybody said they were.
+static void
+pipe_wakeup(volatile uint32_t *flag, volatile off_t *pos)
+{
+  if (xchg(flag, 0))
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+}
+
+// Read at most 'n' bytes from bulk pipe 'fd' into 'buf'.  If 'dstva'
+// is not null, a reader blocked on an empty pipe takes a page spliced
+// in by the writer at 'dstva' instead, in place of whatever was there.
+static ssize_t
+devpipe_read_bulk(struct Fd *fd, struct Pipe *p, uint8_t *buf, size_t n,
+                  void *dstva)
+{
+  uint8_t *ring = pipe_ring(fd);
+  size_t i, m, off;
+  off_t wpos;
+  int perm;
+
+  for (i = 0; i < n; ) {
+    wpos = p->p_wpos;
+    if (wpos == p->p_rpos) {
+      // pipe is empty
+      // if we got any data, return it
+      if (i > 0)
+        break;
+      // if all the writers are gone, note eof
+      if (_pipeisclosed(fd, p))
+        return 0;
+      // block, taking a spliced page if asked to
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+      if (perm & PTE_P)
+        return PGSIZE;
+      continue;
+    }
+
+    // copy out as much as is contiguous in the ring
+    off = p->p_rpos % PIPERINGSIZ;
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+    memcpy(buf + i, ring + off, m);
+    i += m;
+    // wait to advance rpos until the bytes are taken!
+    p->p_rpos += m;
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return i;
+}
+
+static ssize_t
+devpipe_write_bulk(struct Fd *fd, struct Pipe *p, const uint8_t *buf, size_t n)
+{
+  uint8_t *ring = pipe_ring(fd);
+  size_t i, m, off;
+  off_t rpos;
+
+  for (i = 0; i < n; ) {
+    rpos = p->p_rpos;
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+      // pipe is full
+      // if all the readers are gone, note eof
+      if (_pipeisclosed(fd, p))
+        return i;
+      pipe_sleep(&p->p_wsleep, &p->p_rpos, rpos, NULL);
+      continue;
+    }
+
+    // copy in as much as fits contiguously in the ring
+    off = p->p_wpos % PIPERINGSIZ;
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+    memcpy(ring + off, buf + i, m);
+    i += m;
+    // wait to advance wpos until the bytes are stored!
+    p->p_wpos += m;
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  }
+  return i;
+}
+
+// Write the 'npages' pages at page-aligned 'pg' to bulk pipe 'fdnum',
+// giving them away: on return they are no longer mapped in the caller.
+// A reader blocked in pipe_splice_read on an empty pipe gets each page
+// remapped at its page instead of copied.  Otherwise the data goes
+// through the ring as with write().
+//
+// Returns the number of bytes written, < 0 on error.
+ssize_t
+pipe_splice(int fdnum, void *pg, size_t npages)
+{
+  struct Fd *fd;
+  struct Pipe *p;
+  size_t i;
+  ssize_t r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+    return r;
+  p = (struct Pipe*)fd2data(fd);
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+    return -E_INVAL;
+
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+    r = -E_IPC_NOT_RECV;
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+      // nobody took the page; the reader is still owed a wakeup
+      xchg(&p->p_rsleep, 1);
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+      break;
+    sys_page_unmap(0, pg);
+  }
+  if (i == 0 && r < 0)
+    return r;
+  return i * PGSIZE;
+}
+
+// Read at most a page from bulk pipe 'fdnum' into the page at 'pg'.
+// Unlike read(), if the pipe is empty this may replace the page at 'pg'
+// with one a writer gives away with pipe_splice, rather than copy into
+// it, so 'pg' must be a private page the caller doesn't mind losing.
+//
+// Returns the number of bytes read, 0 at end of file, < 0 on error.
+ssize_t
+pipe_splice_read(int fdnum, void *pg)
+{
+  struct Fd *fd;
+  struct Pipe *p;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+    return r;
+  p = (struct Pipe*)fd2data(fd);
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+    return -E_INVAL;
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+}
+
 static ssize_t
 devpipe_read(struct Fd *fd, void *vbuf, size_t n)
 {
@@ -113,6 +320,9 @@ devpipe_read(struct Fd *fd, void *vbuf, size_t n)
     cprintf("[%08x] devpipe_read %08x %d rpos %d wpos %d\n",
             thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
 
+  if (p->p_bulk)
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+
   buf = vbuf;
   for (i = 0; i < n; i++) {
     while (p->p_rpos == p->p_wpos) {
@@ -148,6 +358,9 @@ devpipe_write(struct Fd *fd, const void *vbuf, size_t n)
     cprintf("[%08x] devpipe_write %08x %d rpos %d wpos %d\n",
             thisenv->env_id, uvpt[PGNUM(p)], n, p->p_rpos, p->p_wpos);
 
+  if (p->p_bulk)
+    return devpipe_write_bulk(fd, p, vbuf, n);
+
   buf = vbuf;
   for (i = 0; i < n; i++) {
     while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
@@ -186,7 +399,19 @@ devpipe_stat(struct Fd *fd, struct Stat *stat)
 static int
 devpipe_close(struct Fd *fd)
 {
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  int i;
+
+  if (p->p_bulk) {
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  }
   (void)sys_page_unmap(0, fd);
-  return sys_page_unmap(0, fd2data(fd));
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
 }
 
@@ -5,6 +5,14 @@
 #define UTEMP2                  (UTEMP + PGSIZE)
 #define UTEMP3                  (UTEMP2 + PGSIZE)
 
+// map_segment stages up to SEGCHUNK file pages at a time at UTEMP2,
+// clear of init_stack's page at UTEMP.
+#define SEGCHUNK                16
+
+// spawn queues its page mapping calls here and runs them a batch at
+// a time.
+static struct SysBatch batch;
+
 // Helper functions for spawn.
 static int init_stack(envid_t child, const char **argv, uintptr_t *init_esp);
 static int map_segment(envid_t child, uintptr_t va, size_t memsz,
@@ -24,6 +32,7 @@ spawn(const char *prog, const char **argv)
   envid_t child;
 
   int fd, i, r;
+  ssize_t n;
   struct Elf *elf;
   struct Proghdr *ph;
   int perm;
@@ -85,14 +94,13 @@ spawn(const char *prog, const char **argv)
   //
   //   - Start the child process running with sys_env_set_status().
 
-  if ((r = open(prog, O_RDONLY)) < 0)
+  // Open the program and read its ELF header in one round trip.
+  if ((r = open_read(prog, O_RDONLY, elf_buf, sizeof(elf_buf), &n)) < 0)
     return r;
   fd = r;
 
-  // Read elf header
   elf = (struct Elf*)elf_buf;
-  if (readn(fd, elf_buf, sizeof(elf_buf)) != sizeof(elf_buf)
-      || elf->e_magic != ELF_MAGIC) {
+  if (n != sizeof(elf_buf) || elf->e_magic != ELF_MAGIC) {
     close(fd);
     cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
     return -E_NOT_EXEC;
@@ -102,6 +110,7 @@ spawn(const char *prog, const char **argv)
   if ((r = sys_exofork()) < 0)
     return r;
   child = r;
+  sysbatch_init(&batch);
 
   // Set up trap frame, including initial stack.
   child_tf = envs[ENVX(child)].env_tf;
@@ -125,15 +134,17 @@ spawn(const char *prog, const char **argv)
   close(fd);
   fd = -1;
 
-  // Copy shared library state.
+  // Copy shared library state, then start the child.  The calls are
+  // queued behind the last segment's mappings and run in one batch.
   if ((r = copy_shared_pages(child)) < 0)
     panic("copy_shared_pages: %e", r);
 
-  if ((r = sys_env_set_trapframe(child, &child_tf)) < 0)
-    panic("sys_env_set_trapframe: %e", r);
-
-  if ((r = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
-    panic("sys_env_set_status: %e", r);
+  if ((r = sysbatch_add(&batch, SYS_env_set_trapframe, child,
+                        (uint32_t) &child_tf, 0, 0, 0)) < 0 ||
+      (r = sysbatch_add(&batch, SYS_env_set_status, child,
+                        ENV_RUNNABLE, 0, 0, 0)) < 0 ||
+      (r = sysbatch_flush(&batch)) < 0)
+    panic("spawn: starting child: %e", r);
 
   return child;
 
@@ -251,10 +262,13 @@ init_stack(envid_t child, const char **argv, uintptr_t *init_esp)
   *init_esp = UTEMP2USTACK(&argv_store[-2]);
 
   // After completing the stack, map it into the child's address space
-  // and unmap it from ours!
-  if ((r = sys_page_map(0, UTEMP, child, (void*)(USTACKTOP - PGSIZE), PTE_P | PTE_U | PTE_W)) < 0)
+  // and unmap it from ours!  Both calls ride along with the first batch
+  // of segment mappings.
+  if ((r = sysbatch_add(&batch, SYS_page_map, 0, (uint32_t) UTEMP, child,
+                        USTACKTOP - PGSIZE, PTE_P | PTE_U | PTE_W)) < 0)
     goto error;
-  if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  if ((r = sysbatch_add(&batch, SYS_page_unmap, 0, (uint32_t) UTEMP,
+                        0, 0, 0)) < 0)
     goto error;
 
   return 0;
@@ -264,12 +278,33 @@ error:
   return r;
 }
 
+// How many of the n file pages starting 'i' bytes into a segment can
+// be the file server's cached pages, mapped into the child as they are
+// (read_map): those of a read-only segment, but not a page that is
+// partly bss, which must be zeroed.
+static int
+shared_pages(int perm, size_t memsz, size_t filesz, off_t fileoffset,
+             int i, int n)
+{
+  if ((perm & PTE_W) || PGOFF(fileoffset))
+    return 0;
+  if (memsz > filesz)
+    n = MIN(n, (filesz - i) / PGSIZE);
+  return n;
+}
+
+// Blank pages are allocated straight into the child.  File pages are
+// staged SEGCHUNK at a time at UTEMP2: one batch allocates the staging
+// pages (after running whatever the previous chunk queued), a single
+// readn fills them, and their map and unmap calls are queued for the
+// next batch.  Read-only pages are mapped at UTEMP2 by read_map rather
+// than copied, so every instance of a program shares its text with the
+// file server's cache.
 static int
 map_segment(envid_t child, uintptr_t va, size_t memsz,
             int fd, size_t filesz, off_t fileoffset, int perm)
 {
-  int i, r;
-  void *blk;
+  int i, j, m, n, r;
 
   // cprintf("map_segment %x+%x\n", va, memsz);
 
@@ -280,23 +315,50 @@ map_segment(envid_t child, uintptr_t va, size_t memsz,
     fileoffset -= i;
   }
 
-
-  for (i = 0; i < memsz; i += PGSIZE) {
+  for (i = 0; i < memsz; i += n * PGSIZE) {
     if (i >= filesz) {
       // allocate a blank page
-      if ((r = sys_page_alloc(child, (void*)(va + i), perm)) < 0)
+      n = 1;
+      if ((r = sysbatch_add(&batch, SYS_page_alloc, child, va + i,
+                            perm, 0, 0)) < 0)
         return r;
+      continue;
+    }
+
+    // from file
+    n = MIN(SEGCHUNK, ROUNDUP(filesz - i, PGSIZE) / PGSIZE);
+    if ((m = shared_pages(perm, memsz, filesz, fileoffset, i, n)) > 0) {
+      n = m;
+      if ((r = sysbatch_flush(&batch)) < 0)
+        return r;
+      for (j = 0; j < n; j++) {
+        if ((r = read_map(fd, fileoffset + i + j * PGSIZE,
+                          UTEMP2 + j * PGSIZE)) < 0)
+          return r;
+        if (r < MIN(PGSIZE, filesz - i - j * PGSIZE))
+          return -E_INVAL;
+      }
     } else {
-      // from file
-      if ((r = sys_page_alloc(0, UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+      for (j = 0; j < n; j++)
+        if ((r = sysbatch_add(&batch, SYS_page_alloc, 0,
+                              (uint32_t) UTEMP2 + j * PGSIZE,
+                              PTE_P|PTE_U|PTE_W, 0, 0)) < 0)
+          return r;
+      if ((r = sysbatch_flush(&batch)) < 0)
         return r;
       if ((r = seek(fd, fileoffset + i)) < 0)
         return r;
-      if ((r = readn(fd, UTEMP, MIN(PGSIZE, filesz-i))) < 0)
+      if ((r = readn(fd, UTEMP2, MIN(n * PGSIZE, filesz - i))) < 0)
+        return r;
+    }
+    for (j = 0; j < n; j++) {
+      if ((r = sysbatch_add(&batch, SYS_page_map, 0,
+                            (uint32_t) UTEMP2 + j * PGSIZE, child,
+                            va + i + j * PGSIZE, perm)) < 0)
+        return r;
+      if ((r = sysbatch_add(&batch, SYS_page_unmap, 0,
+                            (uint32_t) UTEMP2 + j * PGSIZE, 0, 0, 0)) < 0)
         return r;
-      if ((r = sys_page_map(0, UTEMP, child, (void*)(va + i), perm)) < 0)
-        panic("spawn: sys_page_map data: %e", r);
-      sys_page_unmap(0, UTEMP);
     }
   }
   return 0;
@@ -307,39 +369,6 @@ static int
 copy_shared_pages(envid_t child)
 {
   // LAB 5: Your code here.
-  uint32_t pn, cur, end;
-  int r;
-  void *addr;
-
-  for (pn = 0; pn < PGNUM(UTOP); pn += NPTENTRIES) {
-      if (!(uvpd[pn >> (PDXSHIFT - PTXSHIFT)] & PTE_P) )
-          continue;
-
-      cur = pn;
-      end = cur + NPTENTRIES;
-      for ( ; cur < end; cur++) {
-          if (cur == PGNUM(UXSTACKTOP - 1))
-              continue;
-
-          // if not present or user, continue
-          if ( !(uvpt[cur] & (PTE_P | PTE_U)) )
-              continue;
-
-          // if not shared, dont copy, so continue
-          if ( !(uvpt[cur] & PTE_SHARE) )
-              continue;
-
-          cprintf("perm share present,user: %x %x %x\n", uvpt[cur],
-                  uvpt[cur] & PTE_SHARE, uvpt[cur] & (PTE_P | PTE_U));
-
-          addr = (void *) (pn << PGSHIFT);
-          if ( (r = sys_page_map(0, addr, child, addr, uvpt[cur] & PTE_SYSCALL)) < 0)
-              panic("copy_shared_pages - sys_page_map: %e", r);
-
-          cprintf("mapped page at %p\n", addr);
-      }
-  }
-
-  return 0;
+  return sysbatch_add(&batch, SYS_page_map_range, 0, 0, UTOP,
+                      child, PMR_SHARED);
 }
-
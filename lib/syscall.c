@@ -67,6 +67,12 @@ sys_yield(void)
   syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
 }
 
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+}
+
 int
 sys_page_alloc(envid_t envid, void *va, int perm)
 {
@@ -85,8 +91,51 @@ sys_page_unmap(envid_t envid, void *va)
   return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
 }
 
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+
+int
+sys_page_paddr(void *va)
+{
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+
 // sys_exofork is inlined in lib.h
 
+envid_t
+sys_fork(void)
+{
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+
 int
 sys_env_set_status(envid_t envid, int status)
 {
@@ -106,14 +155,105 @@ sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
 }
 
 int
-sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm)
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
 {
-  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm, 0);
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+
+
+unsigned int
+sys_time_msec(void)
+{
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
 }
 
 int
-sys_ipc_recv(void *dstva)
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
 {
-  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, 0, 0, 0, 0);
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
 }
 
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+
+// Set to make sys_batch issue each call with its own trap, so the
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  int i;
+
+  if (!sysbatch_serial)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+      break;
+  }
+  return i;
+}
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  b->sb_n = 0;
+}
+
+// Queue a system call on 'b', first flushing 'b' if it is full.
+// Returns 0, or the error of a failed flush.
+int
+sysbatch_add(struct SysBatch *b, uint32_t num, uint32_t a1, uint32_t a2,
+             uint32_t a3, uint32_t a4, uint32_t a5)
+{
+  struct Syscall *sc;
+  int r;
+
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+    return r;
+
+  sc = &b->sb_calls[b->sb_n++];
+  sc->sc_num = num;
+  sc->sc_args[0] = a1;
+  sc->sc_args[1] = a2;
+  sc->sc_args[2] = a3;
+  sc->sc_args[3] = a4;
+  sc->sc_args[4] = a5;
+  sc->sc_ret = 0;
+  return 0;
+}
+
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+    return 0;
+  b->sb_n = 0;
+
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
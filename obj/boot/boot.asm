@@ -0,0 +1,315 @@
+
+obj/boot/boot.out:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00007c00 <start>:
+.set CR0_PE_ON,      0x1         # protected mode enable flag
+
+.globl start
+start:
+  .code16                     # Assemble for 16-bit mode
+  cli                         # Disable interrupts
+    7c00:	fa                   	cli
+  cld                         # String operations increment
+    7c01:	fc                   	cld
+
+  # Set up the important data segment registers (DS, ES, SS).
+  xorw    %ax,%ax             # Segment number zero
+    7c02:	31 c0                	xor    %eax,%eax
+  movw    %ax,%ds             # -> Data Segment
+    7c04:	8e d8                	mov    %eax,%ds
+  movw    %ax,%es             # -> Extra Segment
+    7c06:	8e c0                	mov    %eax,%es
+  movw    %ax,%ss             # -> Stack Segment
+    7c08:	8e d0                	mov    %eax,%ss
+
+00007c0a <seta20.1>:
+  # Enable A20:
+  #   For backwards compatibility with the earliest PCs, physical
+  #   address line 20 is tied low, so that addresses higher than
+  #   1MB wrap around to zero by default.  This code undoes this.
+seta20.1:
+  inb     $0x64,%al               # Wait for not busy
+    7c0a:	e4 64                	in     $0x64,%al
+  testb   $0x2,%al
+    7c0c:	a8 02                	test   $0x2,%al
+  jnz     seta20.1
+    7c0e:	75 fa                	jne    7c0a <seta20.1>
+
+  movb    $0xd1,%al               # 0xd1 -> port 0x64
+    7c10:	b0 d1                	mov    $0xd1,%al
+  outb    %al,$0x64
+    7c12:	e6 64                	out    %al,$0x64
+
+00007c14 <seta20.2>:
+
+seta20.2:
+  inb     $0x64,%al               # Wait for not busy
+    7c14:	e4 64                	in     $0x64,%al
+  testb   $0x2,%al
+    7c16:	a8 02                	test   $0x2,%al
+  jnz     seta20.2
+    7c18:	75 fa                	jne    7c14 <seta20.2>
+
+  movb    $0xdf,%al               # 0xdf -> port 0x60
+    7c1a:	b0 df                	mov    $0xdf,%al
+  outb    %al,$0x60
+    7c1c:	e6 60                	out    %al,$0x60
+
+  # Switch from real to protected mode, using a bootstrap GDT
+  # and segment translation that makes virtual addresses 
+  # identical to their physical addresses, so that the 
+  # effective memory map does not change during the switch.
+  lgdt    gdtdesc
+    7c1e:	0f 01 16             	lgdtl  (%esi)
+    7c21:	64 7c 0f             	fs jl  7c33 <protcseg+0x1>
+  movl    %cr0, %eax
+    7c24:	20 c0                	and    %al,%al
+  orl     $CR0_PE_ON, %eax
+    7c26:	66 83 c8 01          	or     $0x1,%ax
+  movl    %eax, %cr0
+    7c2a:	0f 22 c0             	mov    %eax,%cr0
+  
+  # Jump to next instruction, but in 32-bit code segment.
+  # Switches processor into 32-bit mode.
+  ljmp    $PROT_MODE_CSEG, $protcseg
+    7c2d:	ea                   	.byte 0xea
+    7c2e:	32 7c 08 00          	xor    0x0(%eax,%ecx,1),%bh
+
+00007c32 <protcseg>:
+
+  .code32                     # Assemble for 32-bit mode
+protcseg:
+  # Set up the protected-mode data segment registers
+  movw    $PROT_MODE_DSEG, %ax    # Our data segment selector
+    7c32:	66 b8 10 00          	mov    $0x10,%ax
+  movw    %ax, %ds                # -> DS: Data Segment
+    7c36:	8e d8                	mov    %eax,%ds
+  movw    %ax, %es                # -> ES: Extra Segment
+    7c38:	8e c0                	mov    %eax,%es
+  movw    %ax, %fs                # -> FS
+    7c3a:	8e e0                	mov    %eax,%fs
+  movw    %ax, %gs                # -> GS
+    7c3c:	8e e8                	mov    %eax,%gs
+  movw    %ax, %ss                # -> SS: Stack Segment
+    7c3e:	8e d0                	mov    %eax,%ss
+  
+  # Set up the stack pointer and call into C.
+  movl    $start, %esp
+    7c40:	bc 00 7c 00 00       	mov    $0x7c00,%esp
+  call bootmain
+    7c45:	e8 da 00 00 00       	call   7d24 <bootmain>
+
+00007c4a <spin>:
+
+  # If bootmain returns (it shouldn't), loop.
+spin:
+  jmp spin
+    7c4a:	eb fe                	jmp    7c4a <spin>
+
+00007c4c <gdt>:
+	...
+    7c54:	ff                   	(bad)
+    7c55:	ff 00                	incl   (%eax)
+    7c57:	00 00                	add    %al,(%eax)
+    7c59:	9a cf 00 ff ff 00 00 	lcall  $0x0,$0xffff00cf
+    7c60:	00                   	.byte 0x0
+    7c61:	92                   	xchg   %eax,%edx
+    7c62:	cf                   	iret
+	...
+
+00007c64 <gdtdesc>:
+    7c64:	17                   	pop    %ss
+    7c65:	00 4c 7c 00          	add    %cl,0x0(%esp,%edi,2)
+	...
+
+00007c6a <waitdisk>:
+
+static __inline uint8_t
+inb(int port)
+{
+  uint8_t data;
+  __asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+    7c6a:	ba f7 01 00 00       	mov    $0x1f7,%edx
+    7c6f:	ec                   	in     (%dx),%al
+  // Bit 4: DF, device fault
+  // Bit 3: DRQ, device request
+  // Bit 0: ERR, error
+
+  // wait for disk reaady
+  while ((inb(0x1F7) & 0xC0) != 0x40)
+    7c70:	83 e0 c0             	and    $0xffffffc0,%eax
+    7c73:	3c 40                	cmp    $0x40,%al
+    7c75:	75 f8                	jne    7c6f <waitdisk+0x5>
+    /* do nothing */;
+}
+    7c77:	c3                   	ret
+
+00007c78 <readsect>:
+
+void
+readsect(void *dst, uint32_t offset)
+{
+    7c78:	55                   	push   %ebp
+    7c79:	89 e5                	mov    %esp,%ebp
+    7c7b:	57                   	push   %edi
+    7c7c:	53                   	push   %ebx
+    7c7d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  // wait for disk to be ready
+  waitdisk();
+    7c80:	e8 e5 ff ff ff       	call   7c6a <waitdisk>
+}
+
+static __inline void
+outb(int port, uint8_t data)
+{
+  __asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+    7c85:	b8 01 00 00 00       	mov    $0x1,%eax
+    7c8a:	ba f2 01 00 00       	mov    $0x1f2,%edx
+    7c8f:	ee                   	out    %al,(%dx)
+    7c90:	ba f3 01 00 00       	mov    $0x1f3,%edx
+    7c95:	89 d8                	mov    %ebx,%eax
+    7c97:	ee                   	out    %al,(%dx)
+
+  // ref. "7.35 READ SECTOR(S)" in [ATA8-ACS]
+  outb(0x1F2, 1);                     // sector count = 1
+  outb(0x1F3, offset);                // LBA low : LBA28 [ 0: 7]
+  outb(0x1F4, offset >> 8);           // LBA mid : LBA28 [ 8:15]
+    7c98:	89 d8                	mov    %ebx,%eax
+    7c9a:	c1 e8 08             	shr    $0x8,%eax
+    7c9d:	ba f4 01 00 00       	mov    $0x1f4,%edx
+    7ca2:	ee                   	out    %al,(%dx)
+  outb(0x1F5, offset >> 16);          // LBA high: LBA28 [16:23]
+    7ca3:	89 d8                	mov    %ebx,%eax
+    7ca5:	c1 e8 10             	shr    $0x10,%eax
+    7ca8:	ba f5 01 00 00       	mov    $0x1f5,%edx
+    7cad:	ee                   	out    %al,(%dx)
+  //  Bit 7: obsolete in LBA, 1 in CHS
+  //  Bit 6: mode, 1=LBA, 0=CHS
+  //  Bit 5: obsolete in LBA, 1 in CHS
+  //  Bit 4: dev, 0=master, 1=slave
+  //  Bit 3-0: [24:27] in LSB, #head in CHS
+  outb(0x1F6, (offset >> 24) | 0xE0); // Dev: LBA28 [24:27], LBA=1, master
+    7cae:	89 d8                	mov    %ebx,%eax
+    7cb0:	c1 e8 18             	shr    $0x18,%eax
+    7cb3:	83 c8 e0             	or     $0xffffffe0,%eax
+    7cb6:	ba f6 01 00 00       	mov    $0x1f6,%edx
+    7cbb:	ee                   	out    %al,(%dx)
+    7cbc:	b8 20 00 00 00       	mov    $0x20,%eax
+    7cc1:	ba f7 01 00 00       	mov    $0x1f7,%edx
+    7cc6:	ee                   	out    %al,(%dx)
+  outb(0x1F7, 0x20);                  // cmd 0x20 - read sectors
+
+  // wait for disk to be ready
+  waitdisk();
+    7cc7:	e8 9e ff ff ff       	call   7c6a <waitdisk>
+  __asm __volatile("cld\n\trepne\n\tinsl"                 :
+    7ccc:	8b 7d 08             	mov    0x8(%ebp),%edi
+    7ccf:	b9 80 00 00 00       	mov    $0x80,%ecx
+    7cd4:	ba f0 01 00 00       	mov    $0x1f0,%edx
+    7cd9:	fc                   	cld
+    7cda:	f2 6d                	repnz insl (%dx),%es:(%edi)
+
+  // read a sector from a data port
+  insl(0x1F0, dst, SECTSIZE/4);
+}
+    7cdc:	5b                   	pop    %ebx
+    7cdd:	5f                   	pop    %edi
+    7cde:	5d                   	pop    %ebp
+    7cdf:	c3                   	ret
+
+00007ce0 <readseg>:
+{
+    7ce0:	55                   	push   %ebp
+    7ce1:	89 e5                	mov    %esp,%ebp
+    7ce3:	57                   	push   %edi
+    7ce4:	56                   	push   %esi
+    7ce5:	53                   	push   %ebx
+    7ce6:	83 ec 0c             	sub    $0xc,%esp
+    7ce9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  end_pa = pa + count;
+    7cec:	89 df                	mov    %ebx,%edi
+    7cee:	03 7d 0c             	add    0xc(%ebp),%edi
+  pa &= ~(SECTSIZE - 1);
+    7cf1:	81 e3 00 fe ff ff    	and    $0xfffffe00,%ebx
+  offset = (offset / SECTSIZE) + 1;
+    7cf7:	8b 75 10             	mov    0x10(%ebp),%esi
+    7cfa:	c1 ee 09             	shr    $0x9,%esi
+    7cfd:	83 c6 01             	add    $0x1,%esi
+  while (pa < end_pa) {
+    7d00:	eb 16                	jmp    7d18 <readseg+0x38>
+    readsect((uint8_t *)pa, offset);
+    7d02:	83 ec 08             	sub    $0x8,%esp
+    7d05:	56                   	push   %esi
+    7d06:	53                   	push   %ebx
+    7d07:	e8 6c ff ff ff       	call   7c78 <readsect>
+    pa += SECTSIZE;
+    7d0c:	81 c3 00 02 00 00    	add    $0x200,%ebx
+    offset++;
+    7d12:	83 c6 01             	add    $0x1,%esi
+    7d15:	83 c4 10             	add    $0x10,%esp
+  while (pa < end_pa) {
+    7d18:	39 fb                	cmp    %edi,%ebx
+    7d1a:	72 e6                	jb     7d02 <readseg+0x22>
+}
+    7d1c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+    7d1f:	5b                   	pop    %ebx
+    7d20:	5e                   	pop    %esi
+    7d21:	5f                   	pop    %edi
+    7d22:	5d                   	pop    %ebp
+    7d23:	c3                   	ret
+
+00007d24 <bootmain>:
+{
+    7d24:	55                   	push   %ebp
+    7d25:	89 e5                	mov    %esp,%ebp
+    7d27:	56                   	push   %esi
+    7d28:	53                   	push   %ebx
+  readseg((uint32_t)ELFHDR, SECTSIZE*8, 0);
+    7d29:	83 ec 04             	sub    $0x4,%esp
+    7d2c:	6a 00                	push   $0x0
+    7d2e:	68 00 10 00 00       	push   $0x1000
+    7d33:	68 00 00 01 00       	push   $0x10000
+    7d38:	e8 a3 ff ff ff       	call   7ce0 <readseg>
+  if (ELFHDR->e_magic != ELF_MAGIC)
+    7d3d:	83 c4 10             	add    $0x10,%esp
+    7d40:	81 3d 00 00 01 00 7f 	cmpl   $0x464c457f,0x10000
+    7d47:	45 4c 46 
+    7d4a:	75 3a                	jne    7d86 <bootmain+0x62>
+  ph = (struct Proghdr *)((uint8_t *)ELFHDR + ELFHDR->e_phoff);
+    7d4c:	a1 1c 00 01 00       	mov    0x1001c,%eax
+    7d51:	8d 98 00 00 01 00    	lea    0x10000(%eax),%ebx
+  eph = ph + ELFHDR->e_phnum;
+    7d57:	0f b7 35 2c 00 01 00 	movzwl 0x1002c,%esi
+    7d5e:	c1 e6 05             	shl    $0x5,%esi
+    7d61:	01 de                	add    %ebx,%esi
+  for (; ph < eph; ph++)
+    7d63:	eb 17                	jmp    7d7c <bootmain+0x58>
+    readseg(ph->p_pa, ph->p_memsz, ph->p_offset);
+    7d65:	83 ec 04             	sub    $0x4,%esp
+    7d68:	ff 73 04             	push   0x4(%ebx)
+    7d6b:	ff 73 14             	push   0x14(%ebx)
+    7d6e:	ff 73 0c             	push   0xc(%ebx)
+    7d71:	e8 6a ff ff ff       	call   7ce0 <readseg>
+  for (; ph < eph; ph++)
+    7d76:	83 c3 20             	add    $0x20,%ebx
+    7d79:	83 c4 10             	add    $0x10,%esp
+    7d7c:	39 f3                	cmp    %esi,%ebx
+    7d7e:	72 e5                	jb     7d65 <bootmain+0x41>
+  ((void (*)(void))(ELFHDR->e_entry))();
+    7d80:	ff 15 18 00 01 00    	call   *0x10018
+}
+
+static __inline void
+outw(int port, uint16_t data)
+{
+  __asm __volatile("outw %0,%w1" : : "a" (data), "d" (port));
+    7d86:	ba 00 8a 00 00       	mov    $0x8a00,%edx
+    7d8b:	b8 00 8a ff ff       	mov    $0xffff8a00,%eax
+    7d90:	66 ef                	out    %ax,(%dx)
+    7d92:	b8 e0 8a ff ff       	mov    $0xffff8ae0,%eax
+    7d97:	66 ef                	out    %ax,(%dx)
+  while (1)
+    7d99:	eb fe                	jmp    7d99 <bootmain+0x75>
@@ -0,0 +1,18450 @@
+
+obj/fs/fs:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 32 6a 00 00       	call   806a63 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <ide_wait_ready>:
+static bool dma_busy;			// a transfer is in flight
+static uint32_t dma_secno, dma_nsecs;	// and the sectors it covers
+
+static int
+ide_wait_ready(bool check_error)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	89 c3                	mov    %eax,%ebx
+
+static __inline uint8_t
+inb(int port)
+{
+  uint8_t data;
+  __asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  800039:	ba f7 01 00 00       	mov    $0x1f7,%edx
+  80003e:	ec                   	in     (%dx),%al
+	int r;
+
+	while (((r = inb(0x1F7)) & (IDE_BSY|IDE_DRDY)) != IDE_DRDY)
+  80003f:	89 c1                	mov    %eax,%ecx
+  800041:	83 e1 c0             	and    $0xffffffc0,%ecx
+  800044:	80 f9 40             	cmp    $0x40,%cl
+  800047:	75 f5                	jne    80003e <ide_wait_ready+0xb>
+		/* do nothing */;
+
+	if (check_error && (r & (IDE_DF|IDE_ERR)) != 0)
+		return -1;
+	return 0;
+  800049:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (check_error && (r & (IDE_DF|IDE_ERR)) != 0)
+  80004e:	84 db                	test   %bl,%bl
+  800050:	74 0a                	je     80005c <ide_wait_ready+0x29>
+  800052:	a8 21                	test   $0x21,%al
+  800054:	0f 95 c2             	setne  %dl
+  800057:	0f b6 d2             	movzbl %dl,%edx
+  80005a:	f7 da                	neg    %edx
+}
+  80005c:	89 d0                	mov    %edx,%eax
+  80005e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800061:	c9                   	leave
+  800062:	c3                   	ret
+
+00800063 <ide_command>:
+}
+
+// Select the sectors and issue ATA command 'cmd'.
+static void
+ide_command(uint32_t secno, size_t nsecs, uint8_t cmd)
+{
+  800063:	55                   	push   %ebp
+  800064:	89 e5                	mov    %esp,%ebp
+  800066:	57                   	push   %edi
+  800067:	56                   	push   %esi
+  800068:	53                   	push   %ebx
+  800069:	83 ec 0c             	sub    $0xc,%esp
+  80006c:	89 c3                	mov    %eax,%ebx
+  80006e:	89 d7                	mov    %edx,%edi
+  800070:	89 ce                	mov    %ecx,%esi
+	ide_wait_ready(0);
+  800072:	b8 00 00 00 00       	mov    $0x0,%eax
+  800077:	e8 b7 ff ff ff       	call   800033 <ide_wait_ready>
+}
+
+static __inline void
+outb(int port, uint8_t data)
+{
+  __asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  80007c:	ba f2 01 00 00       	mov    $0x1f2,%edx
+  800081:	89 f8                	mov    %edi,%eax
+  800083:	ee                   	out    %al,(%dx)
+  800084:	ba f3 01 00 00       	mov    $0x1f3,%edx
+  800089:	89 d8                	mov    %ebx,%eax
+  80008b:	ee                   	out    %al,(%dx)
+
+	outb(0x1F2, nsecs);
+	outb(0x1F3, secno & 0xFF);
+	outb(0x1F4, (secno >> 8) & 0xFF);
+  80008c:	89 d8                	mov    %ebx,%eax
+  80008e:	c1 e8 08             	shr    $0x8,%eax
+  800091:	ba f4 01 00 00       	mov    $0x1f4,%edx
+  800096:	ee                   	out    %al,(%dx)
+	outb(0x1F5, (secno >> 16) & 0xFF);
+  800097:	89 d8                	mov    %ebx,%eax
+  800099:	c1 e8 10             	shr    $0x10,%eax
+  80009c:	ba f5 01 00 00       	mov    $0x1f5,%edx
+  8000a1:	ee                   	out    %al,(%dx)
+	outb(0x1F6, 0xE0 | ((diskno&1)<<4) | ((secno>>24)&0x0F));
+  8000a2:	0f b6 05 00 b0 80 00 	movzbl 0x80b000,%eax
+  8000a9:	c1 e0 04             	shl    $0x4,%eax
+  8000ac:	83 e0 10             	and    $0x10,%eax
+  8000af:	c1 eb 18             	shr    $0x18,%ebx
+  8000b2:	83 e3 0f             	and    $0xf,%ebx
+  8000b5:	09 d8                	or     %ebx,%eax
+  8000b7:	83 c8 e0             	or     $0xffffffe0,%eax
+  8000ba:	ba f6 01 00 00       	mov    $0x1f6,%edx
+  8000bf:	ee                   	out    %al,(%dx)
+  8000c0:	ba f7 01 00 00       	mov    $0x1f7,%edx
+  8000c5:	89 f0                	mov    %esi,%eax
+  8000c7:	ee                   	out    %al,(%dx)
+	outb(0x1F7, cmd);
+}
+  8000c8:	83 c4 0c             	add    $0xc,%esp
+  8000cb:	5b                   	pop    %ebx
+  8000cc:	5e                   	pop    %esi
+  8000cd:	5f                   	pop    %edi
+  8000ce:	5d                   	pop    %ebp
+  8000cf:	c3                   	ret
+
+008000d0 <ide_dma_wait>:
+{
+	uint32_t seen;
+	int st, r;
+
+	if (!dma_busy)
+		return 0;
+  8000d0:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!dma_busy)
+  8000d5:	80 3d 08 50 81 00 00 	cmpb   $0x0,0x815008
+  8000dc:	74 7d                	je     80015b <ide_dma_wait+0x8b>
+{
+  8000de:	55                   	push   %ebp
+  8000df:	89 e5                	mov    %esp,%ebp
+  8000e1:	57                   	push   %edi
+  8000e2:	56                   	push   %esi
+  8000e3:	53                   	push   %ebx
+  8000e4:	83 ec 0c             	sub    $0xc,%esp
+  8000e7:	eb 15                	jmp    8000fe <ide_dma_wait+0x2e>
+	for (;;) {
+		seen = ide_irqs;
+		st = inb(bmbase + BM_STATUS);
+		if ((st & BM_ST_IRQ) || !(st & BM_ST_ACTIVE))
+			break;
+		sys_chan_sleep(&ide_irqs, seen, (void *) UTOP, IDE_TIMEOUT_MS);
+  8000e9:	6a 64                	push   $0x64
+  8000eb:	68 00 00 c0 ee       	push   $0xeec00000
+  8000f0:	57                   	push   %edi
+  8000f1:	68 0c 50 81 00       	push   $0x81500c
+  8000f6:	e8 06 78 00 00       	call   807901 <sys_chan_sleep>
+		seen = ide_irqs;
+  8000fb:	83 c4 10             	add    $0x10,%esp
+  8000fe:	8b 3d 0c 50 81 00    	mov    0x81500c,%edi
+		st = inb(bmbase + BM_STATUS);
+  800104:	0f b7 35 14 50 81 00 	movzwl 0x815014,%esi
+  80010b:	8d 5e 02             	lea    0x2(%esi),%ebx
+  __asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  80010e:	89 da                	mov    %ebx,%edx
+  800110:	ec                   	in     (%dx),%al
+  800111:	89 c1                	mov    %eax,%ecx
+		if ((st & BM_ST_IRQ) || !(st & BM_ST_ACTIVE))
+  800113:	83 e0 05             	and    $0x5,%eax
+  800116:	3c 01                	cmp    $0x1,%al
+  800118:	74 cf                	je     8000e9 <ide_dma_wait+0x19>
+  __asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  80011a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80011f:	89 f2                	mov    %esi,%edx
+  800121:	ee                   	out    %al,(%dx)
+  __asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  800122:	ba f7 01 00 00       	mov    $0x1f7,%edx
+  800127:	ec                   	in     (%dx),%al
+  800128:	89 c6                	mov    %eax,%esi
+  __asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  80012a:	b8 06 00 00 00       	mov    $0x6,%eax
+  80012f:	89 da                	mov    %ebx,%edx
+  800131:	ee                   	out    %al,(%dx)
+	}
+
+	outb(bmbase + BM_CMD, 0);
+	r = inb(0x1F7);		// also acknowledges the drive's interrupt
+	outb(bmbase + BM_STATUS, BM_ST_IRQ | BM_ST_ERR);
+	dma_busy = 0;
+  800132:	c6 05 08 50 81 00 00 	movb   $0x0,0x815008
+
+	if ((st & BM_ST_ERR) || (r & (IDE_DF|IDE_ERR)))
+  800139:	f6 c1 02             	test   $0x2,%cl
+  80013c:	75 16                	jne    800154 <ide_dma_wait+0x84>
+  80013e:	f7 c6 21 00 00 00    	test   $0x21,%esi
+  800144:	0f 95 c0             	setne  %al
+  800147:	0f b6 c0             	movzbl %al,%eax
+  80014a:	f7 d8                	neg    %eax
+		return -1;
+	return 0;
+}
+  80014c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80014f:	5b                   	pop    %ebx
+  800150:	5e                   	pop    %esi
+  800151:	5f                   	pop    %edi
+  800152:	5d                   	pop    %ebp
+  800153:	c3                   	ret
+		return -1;
+  800154:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800159:	eb f1                	jmp    80014c <ide_dma_wait+0x7c>
+}
+  80015b:	c3                   	ret
+
+0080015c <ide_dma_start>:
+
+// Start a DMA transfer of 'nsecs' sectors between the disk and the
+// pages at 'va', after any transfer already in flight.
+static int
+ide_dma_start(uint32_t secno, const void *va, size_t nsecs, bool write)
+{
+  80015c:	55                   	push   %ebp
+  80015d:	89 e5                	mov    %esp,%ebp
+  80015f:	57                   	push   %edi
+  800160:	56                   	push   %esi
+  800161:	53                   	push   %ebx
+  800162:	83 ec 1c             	sub    $0x1c,%esp
+  800165:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800168:	89 d6                	mov    %edx,%esi
+  80016a:	89 cf                	mov    %ecx,%edi
+  80016c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80016f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800172:	89 45 d8             	mov    %eax,-0x28(%ebp)
+	struct Prd *prd = (struct Prd *) IDE_PRDVA;
+	uint32_t i, n;
+	int r, pa;
+
+	if ((r = ide_dma_wait()) < 0)
+  800175:	e8 56 ff ff ff       	call   8000d0 <ide_dma_wait>
+  80017a:	85 c0                	test   %eax,%eax
+  80017c:	0f 88 b3 00 00 00    	js     800235 <ide_dma_start+0xd9>
+		return r;
+
+	n = nsecs / BLKSECTS;
+  800182:	c1 ef 03             	shr    $0x3,%edi
+	for (i = 0; i < n; i++) {
+  800185:	bb 00 00 00 00       	mov    $0x0,%ebx
+		if ((pa = sys_page_paddr((char *) va + i * PGSIZE)) < 0)
+			return pa;
+		prd[i].prd_addr = pa;
+		prd[i].prd_len = PGSIZE | (i == n - 1 ? PRD_EOT : 0);
+  80018a:	8d 47 ff             	lea    -0x1(%edi),%eax
+  80018d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (i = 0; i < n; i++) {
+  800190:	39 fb                	cmp    %edi,%ebx
+  800192:	74 3d                	je     8001d1 <ide_dma_start+0x75>
+		if ((pa = sys_page_paddr((char *) va + i * PGSIZE)) < 0)
+  800194:	83 ec 0c             	sub    $0xc,%esp
+  800197:	56                   	push   %esi
+  800198:	e8 78 75 00 00       	call   807715 <sys_page_paddr>
+  80019d:	83 c4 10             	add    $0x10,%esp
+  8001a0:	85 c0                	test   %eax,%eax
+  8001a2:	0f 88 8d 00 00 00    	js     800235 <ide_dma_start+0xd9>
+		prd[i].prd_addr = pa;
+  8001a8:	89 04 dd 00 e0 ff 0f 	mov    %eax,0xfffe000(,%ebx,8)
+		prd[i].prd_len = PGSIZE | (i == n - 1 ? PRD_EOT : 0);
+  8001af:	39 5d e4             	cmp    %ebx,-0x1c(%ebp)
+  8001b2:	b8 00 10 00 80       	mov    $0x80001000,%eax
+  8001b7:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8001bc:	0f 45 c1             	cmovne %ecx,%eax
+  8001bf:	89 04 dd 04 e0 ff 0f 	mov    %eax,0xfffe004(,%ebx,8)
+	for (i = 0; i < n; i++) {
+  8001c6:	83 c3 01             	add    $0x1,%ebx
+  8001c9:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8001cf:	eb bf                	jmp    800190 <ide_dma_start+0x34>
+	}
+
+	outl(bmbase + BM_PRDT, prdt_pa);
+  8001d1:	0f b7 1d 14 50 81 00 	movzwl 0x815014,%ebx
+  8001d8:	8d 53 04             	lea    0x4(%ebx),%edx
+}
+
+static __inline void
+outl(int port, uint32_t data)
+{
+  __asm __volatile("outl %0,%w1" : : "a" (data), "d" (port));
+  8001db:	a1 10 50 81 00       	mov    0x815010,%eax
+  8001e0:	ef                   	out    %eax,(%dx)
+	outb(bmbase + BM_CMD, write ? 0 : BM_CMD_READ);
+  8001e1:	8b 7d d8             	mov    -0x28(%ebp),%edi
+  8001e4:	89 f8                	mov    %edi,%eax
+  8001e6:	83 f0 01             	xor    $0x1,%eax
+  8001e9:	0f b6 c0             	movzbl %al,%eax
+  8001ec:	c1 e0 03             	shl    $0x3,%eax
+  __asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  8001ef:	89 da                	mov    %ebx,%edx
+  8001f1:	ee                   	out    %al,(%dx)
+	outb(bmbase + BM_STATUS, BM_ST_IRQ | BM_ST_ERR);
+  8001f2:	8d 53 02             	lea    0x2(%ebx),%edx
+  8001f5:	b8 06 00 00 00       	mov    $0x6,%eax
+  8001fa:	ee                   	out    %al,(%dx)
+	ide_command(secno, nsecs, write ? 0xCA : 0xC8);	// WRITE/READ DMA
+  8001fb:	89 f8                	mov    %edi,%eax
+  8001fd:	84 c0                	test   %al,%al
+  8001ff:	75 3c                	jne    80023d <ide_dma_start+0xe1>
+  800201:	b9 c8 00 00 00       	mov    $0xc8,%ecx
+  800206:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  800209:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80020c:	e8 52 fe ff ff       	call   800063 <ide_command>
+	outb(bmbase + BM_CMD, (write ? 0 : BM_CMD_READ) | BM_CMD_START);
+  800211:	b8 09 00 00 00       	mov    $0x9,%eax
+  800216:	89 da                	mov    %ebx,%edx
+  800218:	ee                   	out    %al,(%dx)
+
+	dma_busy = 1;
+  800219:	c6 05 08 50 81 00 01 	movb   $0x1,0x815008
+	dma_secno = secno;
+  800220:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800223:	a3 04 50 81 00       	mov    %eax,0x815004
+	dma_nsecs = nsecs;
+  800228:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80022b:	a3 00 50 81 00       	mov    %eax,0x815000
+	return 0;
+  800230:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800235:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800238:	5b                   	pop    %ebx
+  800239:	5e                   	pop    %esi
+  80023a:	5f                   	pop    %edi
+  80023b:	5d                   	pop    %ebp
+  80023c:	c3                   	ret
+	ide_command(secno, nsecs, write ? 0xCA : 0xC8);	// WRITE/READ DMA
+  80023d:	b9 ca 00 00 00       	mov    $0xca,%ecx
+  800242:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  800245:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800248:	e8 16 fe ff ff       	call   800063 <ide_command>
+	outb(bmbase + BM_CMD, (write ? 0 : BM_CMD_READ) | BM_CMD_START);
+  80024d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800252:	eb c2                	jmp    800216 <ide_dma_start+0xba>
+
+00800254 <ide_probe_disk1>:
+{
+  800254:	55                   	push   %ebp
+  800255:	89 e5                	mov    %esp,%ebp
+  800257:	53                   	push   %ebx
+  800258:	83 ec 04             	sub    $0x4,%esp
+	ide_wait_ready(0);
+  80025b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800260:	e8 ce fd ff ff       	call   800033 <ide_wait_ready>
+  800265:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80026a:	ba f6 01 00 00       	mov    $0x1f6,%edx
+  80026f:	ee                   	out    %al,(%dx)
+	for (x = 0;
+  800270:	b9 00 00 00 00       	mov    $0x0,%ecx
+  __asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  800275:	ba f7 01 00 00       	mov    $0x1f7,%edx
+  80027a:	ec                   	in     (%dx),%al
+	     x < 1000 && ((r = inb(0x1F7)) & (IDE_BSY|IDE_DF|IDE_ERR)) != 0;
+  80027b:	a8 a1                	test   $0xa1,%al
+  80027d:	74 0b                	je     80028a <ide_probe_disk1+0x36>
+	     x++)
+  80027f:	83 c1 01             	add    $0x1,%ecx
+	     x < 1000 && ((r = inb(0x1F7)) & (IDE_BSY|IDE_DF|IDE_ERR)) != 0;
+  800282:	81 f9 e8 03 00 00    	cmp    $0x3e8,%ecx
+  800288:	75 f0                	jne    80027a <ide_probe_disk1+0x26>
+  __asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  80028a:	b8 e0 ff ff ff       	mov    $0xffffffe0,%eax
+  80028f:	ba f6 01 00 00       	mov    $0x1f6,%edx
+  800294:	ee                   	out    %al,(%dx)
+	cprintf("Device 1 presence: %d\n", (x < 1000));
+  800295:	81 f9 e7 03 00 00    	cmp    $0x3e7,%ecx
+  80029b:	0f 9e c3             	setle  %bl
+  80029e:	83 ec 08             	sub    $0x8,%esp
+  8002a1:	0f b6 c3             	movzbl %bl,%eax
+  8002a4:	50                   	push   %eax
+  8002a5:	68 e0 98 80 00       	push   $0x8098e0
+  8002aa:	e8 fc 68 00 00       	call   806bab <cprintf>
+}
+  8002af:	89 d8                	mov    %ebx,%eax
+  8002b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8002b4:	c9                   	leave
+  8002b5:	c3                   	ret
+
+008002b6 <ide_set_disk>:
+{
+  8002b6:	55                   	push   %ebp
+  8002b7:	89 e5                	mov    %esp,%ebp
+  8002b9:	83 ec 08             	sub    $0x8,%esp
+  8002bc:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (d != 0 && d != 1)
+  8002bf:	83 f8 01             	cmp    $0x1,%eax
+  8002c2:	77 07                	ja     8002cb <ide_set_disk+0x15>
+	diskno = d;
+  8002c4:	a3 00 b0 80 00       	mov    %eax,0x80b000
+}
+  8002c9:	c9                   	leave
+  8002ca:	c3                   	ret
+		panic("bad disk number");
+  8002cb:	83 ec 04             	sub    $0x4,%esp
+  8002ce:	68 f7 98 80 00       	push   $0x8098f7
+  8002d3:	6a 5a                	push   $0x5a
+  8002d5:	68 07 99 80 00       	push   $0x809907
+  8002da:	e8 f1 67 00 00       	call   806ad0 <_panic>
+
+008002df <ide_dma_init>:
+{
+  8002df:	55                   	push   %ebp
+  8002e0:	89 e5                	mov    %esp,%ebp
+  8002e2:	83 ec 3c             	sub    $0x3c,%esp
+	if (pci_find_class(PCI_CLASS_STORAGE, PCI_SUBCLASS_IDE, &f) < 0 ||
+  8002e5:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  8002e8:	50                   	push   %eax
+  8002e9:	6a 01                	push   $0x1
+  8002eb:	6a 01                	push   $0x1
+  8002ed:	e8 16 15 00 00       	call   801808 <pci_find_class>
+  8002f2:	83 c4 10             	add    $0x10,%esp
+  8002f5:	85 c0                	test   %eax,%eax
+  8002f7:	78 0c                	js     800305 <ide_dma_init+0x26>
+  8002f9:	f6 45 d9 80          	testb  $0x80,-0x27(%ebp)
+  8002fd:	74 06                	je     800305 <ide_dma_init+0x26>
+	    !(f.pf_class & 0x8000) || !(f.pf_bar[4] & 1)) {
+  8002ff:	f6 45 ec 01          	testb  $0x1,-0x14(%ebp)
+  800303:	75 12                	jne    800317 <ide_dma_init+0x38>
+		cprintf("IDE: no bus-master DMA, using PIO\n");
+  800305:	83 ec 0c             	sub    $0xc,%esp
+  800308:	68 44 99 80 00       	push   $0x809944
+  80030d:	e8 99 68 00 00       	call   806bab <cprintf>
+  800312:	83 c4 10             	add    $0x10,%esp
+}
+  800315:	c9                   	leave
+  800316:	c3                   	ret
+	if ((r = sys_page_alloc(0, (void *) IDE_PRDVA, PTE_P|PTE_U|PTE_W)) < 0)
+  800317:	83 ec 04             	sub    $0x4,%esp
+  80031a:	6a 07                	push   $0x7
+  80031c:	68 00 e0 ff 0f       	push   $0xfffe000
+  800321:	6a 00                	push   $0x0
+  800323:	e8 a0 72 00 00       	call   8075c8 <sys_page_alloc>
+  800328:	83 c4 10             	add    $0x10,%esp
+  80032b:	85 c0                	test   %eax,%eax
+  80032d:	78 6f                	js     80039e <ide_dma_init+0xbf>
+	if ((r = sys_page_paddr((void *) IDE_PRDVA)) < 0)
+  80032f:	83 ec 0c             	sub    $0xc,%esp
+  800332:	68 00 e0 ff 0f       	push   $0xfffe000
+  800337:	e8 d9 73 00 00       	call   807715 <sys_page_paddr>
+  80033c:	83 c4 10             	add    $0x10,%esp
+  80033f:	85 c0                	test   %eax,%eax
+  800341:	78 6d                	js     8003b0 <ide_dma_init+0xd1>
+	prdt_pa = r;
+  800343:	a3 10 50 81 00       	mov    %eax,0x815010
+	if ((r = sys_irq_listen(IRQ_IDE, &ide_irqs)) < 0)
+  800348:	83 ec 08             	sub    $0x8,%esp
+  80034b:	68 0c 50 81 00       	push   $0x81500c
+  800350:	6a 0e                	push   $0xe
+  800352:	e8 7c 73 00 00       	call   8076d3 <sys_irq_listen>
+  800357:	83 c4 10             	add    $0x10,%esp
+  80035a:	85 c0                	test   %eax,%eax
+  80035c:	78 64                	js     8003c2 <ide_dma_init+0xe3>
+	pci_enable(&f, PCI_COMMAND_IO | PCI_COMMAND_MASTER);
+  80035e:	83 ec 08             	sub    $0x8,%esp
+  800361:	6a 05                	push   $0x5
+  800363:	8d 45 c8             	lea    -0x38(%ebp),%eax
+  800366:	50                   	push   %eax
+  800367:	e8 73 14 00 00       	call   8017df <pci_enable>
+	bmbase = f.pf_bar[4] & ~3;
+  80036c:	0f b7 4d ec          	movzwl -0x14(%ebp),%ecx
+  800370:	83 e1 fc             	and    $0xfffffffc,%ecx
+  800373:	66 89 0d 14 50 81 00 	mov    %cx,0x815014
+  80037a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80037f:	ba f6 03 00 00       	mov    $0x3f6,%edx
+  800384:	ee                   	out    %al,(%dx)
+	cprintf("IDE: bus-master DMA at port %x\n", bmbase);
+  800385:	83 c4 08             	add    $0x8,%esp
+  800388:	0f b7 c9             	movzwl %cx,%ecx
+  80038b:	51                   	push   %ecx
+  80038c:	68 68 99 80 00       	push   $0x809968
+  800391:	e8 15 68 00 00       	call   806bab <cprintf>
+  800396:	83 c4 10             	add    $0x10,%esp
+  800399:	e9 77 ff ff ff       	jmp    800315 <ide_dma_init+0x36>
+		panic("ide_dma_init: %e", r);
+  80039e:	50                   	push   %eax
+  80039f:	68 10 99 80 00       	push   $0x809910
+  8003a4:	6a 6f                	push   $0x6f
+  8003a6:	68 07 99 80 00       	push   $0x809907
+  8003ab:	e8 20 67 00 00       	call   806ad0 <_panic>
+		panic("ide_dma_init: %e", r);
+  8003b0:	50                   	push   %eax
+  8003b1:	68 10 99 80 00       	push   $0x809910
+  8003b6:	6a 71                	push   $0x71
+  8003b8:	68 07 99 80 00       	push   $0x809907
+  8003bd:	e8 0e 67 00 00       	call   806ad0 <_panic>
+		panic("ide_dma_init: %e", r);
+  8003c2:	50                   	push   %eax
+  8003c3:	68 10 99 80 00       	push   $0x809910
+  8003c8:	6a 74                	push   $0x74
+  8003ca:	68 07 99 80 00       	push   $0x809907
+  8003cf:	e8 fc 66 00 00       	call   806ad0 <_panic>
+
+008003d4 <ide_sync>:
+
+// Wait for the transfer in flight to finish.  Returns 0, or -1 if it
+// failed.
+int
+ide_sync(void)
+{
+  8003d4:	55                   	push   %ebp
+  8003d5:	89 e5                	mov    %esp,%ebp
+  8003d7:	83 ec 08             	sub    $0x8,%esp
+	return ide_dma_wait();
+  8003da:	e8 f1 fc ff ff       	call   8000d0 <ide_dma_wait>
+}
+  8003df:	c9                   	leave
+  8003e0:	c3                   	ret
+
+008003e1 <ide_sync_range>:
+
+// Like ide_sync, but only wait if the transfer in flight touches
+// sectors [secno, secno+nsecs).
+int
+ide_sync_range(uint32_t secno, size_t nsecs)
+{
+  8003e1:	55                   	push   %ebp
+  8003e2:	89 e5                	mov    %esp,%ebp
+  8003e4:	53                   	push   %ebx
+  8003e5:	83 ec 04             	sub    $0x4,%esp
+  8003e8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	if (!dma_busy || secno + nsecs <= dma_secno ||
+	    dma_secno + dma_nsecs <= secno)
+		return 0;
+  8003eb:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!dma_busy || secno + nsecs <= dma_secno ||
+  8003f0:	80 3d 08 50 81 00 00 	cmpb   $0x0,0x815008
+  8003f7:	74 19                	je     800412 <ide_sync_range+0x31>
+  8003f9:	8b 15 04 50 81 00    	mov    0x815004,%edx
+  8003ff:	89 cb                	mov    %ecx,%ebx
+  800401:	03 5d 0c             	add    0xc(%ebp),%ebx
+  800404:	39 da                	cmp    %ebx,%edx
+  800406:	73 0a                	jae    800412 <ide_sync_range+0x31>
+	    dma_secno + dma_nsecs <= secno)
+  800408:	03 15 00 50 81 00    	add    0x815000,%edx
+	if (!dma_busy || secno + nsecs <= dma_secno ||
+  80040e:	39 d1                	cmp    %edx,%ecx
+  800410:	72 05                	jb     800417 <ide_sync_range+0x36>
+	return ide_dma_wait();
+}
+  800412:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800415:	c9                   	leave
+  800416:	c3                   	ret
+	return ide_dma_wait();
+  800417:	e8 b4 fc ff ff       	call   8000d0 <ide_dma_wait>
+  80041c:	eb f4                	jmp    800412 <ide_sync_range+0x31>
+
+0080041e <ide_read>:
+
+
+int
+ide_read(uint32_t secno, void *dst, size_t nsecs)
+{
+  80041e:	55                   	push   %ebp
+  80041f:	89 e5                	mov    %esp,%ebp
+  800421:	57                   	push   %edi
+  800422:	56                   	push   %esi
+  800423:	53                   	push   %ebx
+  800424:	83 ec 0c             	sub    $0xc,%esp
+  800427:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80042a:	8b 75 10             	mov    0x10(%ebp),%esi
+	int r;
+
+	assert(nsecs <= 256);
+  80042d:	81 fe 00 01 00 00    	cmp    $0x100,%esi
+  800433:	77 5c                	ja     800491 <ide_read+0x73>
+	return bmbase && PGOFF(va) == 0 && nsecs > 0 && nsecs % BLKSECTS == 0;
+  800435:	66 83 3d 14 50 81 00 	cmpw   $0x0,0x815014
+  80043c:	00 
+  80043d:	74 0c                	je     80044b <ide_read+0x2d>
+  80043f:	89 da                	mov    %ebx,%edx
+  800441:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  800447:	85 f6                	test   %esi,%esi
+  800449:	75 5f                	jne    8004aa <ide_read+0x8c>
+	if (ide_dma_ok(dst, nsecs)) {
+		if ((r = ide_dma_start(secno, dst, nsecs, 0)) < 0)
+			return r;
+		return ide_dma_wait();
+	}
+	if ((r = ide_dma_wait()) < 0)
+  80044b:	e8 80 fc ff ff       	call   8000d0 <ide_dma_wait>
+  800450:	85 c0                	test   %eax,%eax
+  800452:	78 77                	js     8004cb <ide_read+0xad>
+		return r;
+
+	ide_command(secno, nsecs, 0x20);	// CMD 0x20 means read sector
+  800454:	b9 20 00 00 00       	mov    $0x20,%ecx
+  800459:	89 f2                	mov    %esi,%edx
+  80045b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80045e:	e8 00 fc ff ff       	call   800063 <ide_command>
+
+	for (; nsecs > 0; nsecs--, dst += SECTSIZE) {
+  800463:	c1 e6 09             	shl    $0x9,%esi
+  800466:	01 de                	add    %ebx,%esi
+  800468:	39 f3                	cmp    %esi,%ebx
+  80046a:	74 6e                	je     8004da <ide_read+0xbc>
+		if ((r = ide_wait_ready(1)) < 0)
+  80046c:	b8 01 00 00 00       	mov    $0x1,%eax
+  800471:	e8 bd fb ff ff       	call   800033 <ide_wait_ready>
+  800476:	85 c0                	test   %eax,%eax
+  800478:	78 51                	js     8004cb <ide_read+0xad>
+  __asm __volatile("cld\n\trepne\n\tinsl"                 :
+  80047a:	89 df                	mov    %ebx,%edi
+  80047c:	b9 80 00 00 00       	mov    $0x80,%ecx
+  800481:	ba f0 01 00 00       	mov    $0x1f0,%edx
+  800486:	fc                   	cld
+  800487:	f2 6d                	repnz insl (%dx),%es:(%edi)
+	for (; nsecs > 0; nsecs--, dst += SECTSIZE) {
+  800489:	81 c3 00 02 00 00    	add    $0x200,%ebx
+  80048f:	eb d7                	jmp    800468 <ide_read+0x4a>
+	assert(nsecs <= 256);
+  800491:	68 21 99 80 00       	push   $0x809921
+  800496:	68 2e 99 80 00       	push   $0x80992e
+  80049b:	68 eb 00 00 00       	push   $0xeb
+  8004a0:	68 07 99 80 00       	push   $0x809907
+  8004a5:	e8 26 66 00 00       	call   806ad0 <_panic>
+	return bmbase && PGOFF(va) == 0 && nsecs > 0 && nsecs % BLKSECTS == 0;
+  8004aa:	89 f0                	mov    %esi,%eax
+  8004ac:	83 e0 07             	and    $0x7,%eax
+	if (ide_dma_ok(dst, nsecs)) {
+  8004af:	09 d0                	or     %edx,%eax
+  8004b1:	75 98                	jne    80044b <ide_read+0x2d>
+		if ((r = ide_dma_start(secno, dst, nsecs, 0)) < 0)
+  8004b3:	83 ec 0c             	sub    $0xc,%esp
+  8004b6:	6a 00                	push   $0x0
+  8004b8:	89 f1                	mov    %esi,%ecx
+  8004ba:	89 da                	mov    %ebx,%edx
+  8004bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8004bf:	e8 98 fc ff ff       	call   80015c <ide_dma_start>
+  8004c4:	83 c4 10             	add    $0x10,%esp
+  8004c7:	85 c0                	test   %eax,%eax
+  8004c9:	79 08                	jns    8004d3 <ide_read+0xb5>
+			return r;
+		insl(0x1F0, dst, SECTSIZE/4);
+	}
+
+	return 0;
+}
+  8004cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004ce:	5b                   	pop    %ebx
+  8004cf:	5e                   	pop    %esi
+  8004d0:	5f                   	pop    %edi
+  8004d1:	5d                   	pop    %ebp
+  8004d2:	c3                   	ret
+		return ide_dma_wait();
+  8004d3:	e8 f8 fb ff ff       	call   8000d0 <ide_dma_wait>
+  8004d8:	eb f1                	jmp    8004cb <ide_read+0xad>
+	return 0;
+  8004da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004df:	eb ea                	jmp    8004cb <ide_read+0xad>
+
+008004e1 <ide_write>:
+// at 'src' must stay mapped and unchanged until ide_sync, a matching
+// ide_sync_range, or the next ide_read or ide_write, which also report
+// an error in the transfer.
+int
+ide_write(uint32_t secno, const void *src, size_t nsecs)
+{
+  8004e1:	55                   	push   %ebp
+  8004e2:	89 e5                	mov    %esp,%ebp
+  8004e4:	57                   	push   %edi
+  8004e5:	56                   	push   %esi
+  8004e6:	53                   	push   %ebx
+  8004e7:	83 ec 0c             	sub    $0xc,%esp
+  8004ea:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8004ed:	8b 7d 10             	mov    0x10(%ebp),%edi
+	int r;
+
+	assert(nsecs <= 256);
+  8004f0:	81 ff 00 01 00 00    	cmp    $0x100,%edi
+  8004f6:	77 2d                	ja     800525 <ide_write+0x44>
+	return bmbase && PGOFF(va) == 0 && nsecs > 0 && nsecs % BLKSECTS == 0;
+  8004f8:	66 83 3d 14 50 81 00 	cmpw   $0x0,0x815014
+  8004ff:	00 
+  800500:	74 04                	je     800506 <ide_write+0x25>
+  800502:	85 ff                	test   %edi,%edi
+  800504:	75 38                	jne    80053e <ide_write+0x5d>
+
+	if (ide_dma_ok(src, nsecs))
+		return ide_dma_start(secno, src, nsecs, 1);
+	if ((r = ide_dma_wait()) < 0)
+  800506:	e8 c5 fb ff ff       	call   8000d0 <ide_dma_wait>
+  80050b:	85 c0                	test   %eax,%eax
+  80050d:	78 53                	js     800562 <ide_write+0x81>
+		return r;
+
+	ide_command(secno, nsecs, 0x30);	// CMD 0x30 means write sector
+  80050f:	b9 30 00 00 00       	mov    $0x30,%ecx
+  800514:	89 fa                	mov    %edi,%edx
+  800516:	8b 45 08             	mov    0x8(%ebp),%eax
+  800519:	e8 45 fb ff ff       	call   800063 <ide_command>
+
+	for (; nsecs > 0; nsecs--, src += SECTSIZE) {
+  80051e:	c1 e7 09             	shl    $0x9,%edi
+  800521:	01 df                	add    %ebx,%edi
+  800523:	eb 5a                	jmp    80057f <ide_write+0x9e>
+	assert(nsecs <= 256);
+  800525:	68 21 99 80 00       	push   $0x809921
+  80052a:	68 2e 99 80 00       	push   $0x80992e
+  80052f:	68 09 01 00 00       	push   $0x109
+  800534:	68 07 99 80 00       	push   $0x809907
+  800539:	e8 92 65 00 00       	call   806ad0 <_panic>
+	return bmbase && PGOFF(va) == 0 && nsecs > 0 && nsecs % BLKSECTS == 0;
+  80053e:	89 d8                	mov    %ebx,%eax
+  800540:	25 ff 0f 00 00       	and    $0xfff,%eax
+  800545:	89 fa                	mov    %edi,%edx
+  800547:	83 e2 07             	and    $0x7,%edx
+	if (ide_dma_ok(src, nsecs))
+  80054a:	09 d0                	or     %edx,%eax
+  80054c:	75 b8                	jne    800506 <ide_write+0x25>
+		return ide_dma_start(secno, src, nsecs, 1);
+  80054e:	83 ec 0c             	sub    $0xc,%esp
+  800551:	6a 01                	push   $0x1
+  800553:	89 f9                	mov    %edi,%ecx
+  800555:	89 da                	mov    %ebx,%edx
+  800557:	8b 45 08             	mov    0x8(%ebp),%eax
+  80055a:	e8 fd fb ff ff       	call   80015c <ide_dma_start>
+  80055f:	83 c4 10             	add    $0x10,%esp
+			return r;
+		outsl(0x1F0, src, SECTSIZE/4);
+	}
+
+	return 0;
+}
+  800562:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800565:	5b                   	pop    %ebx
+  800566:	5e                   	pop    %esi
+  800567:	5f                   	pop    %edi
+  800568:	5d                   	pop    %ebp
+  800569:	c3                   	ret
+  __asm __volatile("cld\n\trepne\n\toutsl"                :
+  80056a:	89 de                	mov    %ebx,%esi
+  80056c:	b9 80 00 00 00       	mov    $0x80,%ecx
+  800571:	ba f0 01 00 00       	mov    $0x1f0,%edx
+  800576:	fc                   	cld
+  800577:	f2 6f                	repnz outsl %ds:(%esi),(%dx)
+	for (; nsecs > 0; nsecs--, src += SECTSIZE) {
+  800579:	81 c3 00 02 00 00    	add    $0x200,%ebx
+  80057f:	39 fb                	cmp    %edi,%ebx
+  800581:	74 10                	je     800593 <ide_write+0xb2>
+		if ((r = ide_wait_ready(1)) < 0)
+  800583:	b8 01 00 00 00       	mov    $0x1,%eax
+  800588:	e8 a6 fa ff ff       	call   800033 <ide_wait_ready>
+  80058d:	85 c0                	test   %eax,%eax
+  80058f:	79 d9                	jns    80056a <ide_write+0x89>
+  800591:	eb cf                	jmp    800562 <ide_write+0x81>
+	return 0;
+  800593:	b8 00 00 00 00       	mov    $0x0,%eax
+  800598:	eb c8                	jmp    800562 <ide_write+0x81>
+
+0080059a <vq_alloc_desc>:
+}
+
+static uint16_t
+vq_alloc_desc(void)
+{
+	uint16_t d = vq_free;
+  80059a:	0f b7 15 34 50 81 00 	movzwl 0x815034,%edx
+
+	vq_free = vq_desc[d].d_next;
+  8005a1:	0f b7 c2             	movzwl %dx,%eax
+  8005a4:	c1 e0 04             	shl    $0x4,%eax
+  8005a7:	03 05 40 50 81 00    	add    0x815040,%eax
+  8005ad:	0f b7 40 0e          	movzwl 0xe(%eax),%eax
+  8005b1:	66 a3 34 50 81 00    	mov    %ax,0x815034
+	vq_nfree--;
+  8005b7:	66 83 2d 32 50 81 00 	subw   $0x1,0x815032
+  8005be:	01 
+	return d;
+}
+  8005bf:	89 d0                	mov    %edx,%eax
+  8005c1:	c3                   	ret
+
+008005c2 <vb_wait>:
+{
+  8005c2:	55                   	push   %ebp
+  8005c3:	89 e5                	mov    %esp,%ebp
+  8005c5:	57                   	push   %edi
+  8005c6:	56                   	push   %esi
+  8005c7:	53                   	push   %ebx
+  8005c8:	83 ec 2c             	sub    $0x2c,%esp
+  8005cb:	e9 33 01 00 00       	jmp    800703 <vb_wait+0x141>
+		for (req = vb_reqs; req < vb_reqs + VB_NREQ; req++)
+  8005d0:	83 c0 10             	add    $0x10,%eax
+  8005d3:	3d e0 50 81 00       	cmp    $0x8150e0,%eax
+  8005d8:	74 2f                	je     800609 <vb_wait+0x47>
+			if (req->r_busy && !req->r_done && req->r_head == head)
+  8005da:	0f b6 10             	movzbl (%eax),%edx
+  8005dd:	84 d2                	test   %dl,%dl
+  8005df:	74 ef                	je     8005d0 <vb_wait+0xe>
+  8005e1:	0f b6 58 01          	movzbl 0x1(%eax),%ebx
+  8005e5:	84 db                	test   %bl,%bl
+  8005e7:	75 e7                	jne    8005d0 <vb_wait+0xe>
+  8005e9:	66 3b 48 04          	cmp    0x4(%eax),%cx
+  8005ed:	75 e1                	jne    8005d0 <vb_wait+0xe>
+		for (d = head; vq_desc[d].d_flags & VRING_DESC_NEXT;
+  8005ef:	8b 3d 40 50 81 00    	mov    0x815040,%edi
+  8005f5:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+  8005f8:	0f b7 3d 32 50 81 00 	movzwl 0x815032,%edi
+  8005ff:	89 f1                	mov    %esi,%ecx
+  800601:	88 55 df             	mov    %dl,-0x21(%ebp)
+  800604:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800607:	eb 22                	jmp    80062b <vb_wait+0x69>
+			panic("virtio-blk: device finished unknown request %d",
+  800609:	0f b7 fe             	movzwl %si,%edi
+  80060c:	57                   	push   %edi
+  80060d:	68 88 99 80 00       	push   $0x809988
+  800612:	68 d6 00 00 00       	push   $0xd6
+  800617:	68 6e 9a 80 00       	push   $0x809a6e
+  80061c:	e8 af 64 00 00       	call   806ad0 <_panic>
+		     d = vq_desc[d].d_next)
+  800621:	0f b7 49 0e          	movzwl 0xe(%ecx),%ecx
+  800625:	89 c7                	mov    %eax,%edi
+  800627:	0f b6 5d df          	movzbl -0x21(%ebp),%ebx
+		for (d = head; vq_desc[d].d_flags & VRING_DESC_NEXT;
+  80062b:	0f b7 c9             	movzwl %cx,%ecx
+  80062e:	c1 e1 04             	shl    $0x4,%ecx
+  800631:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800634:	01 d1                	add    %edx,%ecx
+  800636:	0f b7 51 0c          	movzwl 0xc(%ecx),%edx
+  80063a:	8d 47 01             	lea    0x1(%edi),%eax
+  80063d:	f6 c2 01             	test   $0x1,%dl
+  800640:	75 df                	jne    800621 <vb_wait+0x5f>
+  800642:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800645:	84 db                	test   %bl,%bl
+  800647:	74 07                	je     800650 <vb_wait+0x8e>
+  800649:	66 89 3d 32 50 81 00 	mov    %di,0x815032
+		vq_desc[d].d_next = vq_free;
+  800650:	0f b7 15 34 50 81 00 	movzwl 0x815034,%edx
+  800657:	66 89 51 0e          	mov    %dx,0xe(%ecx)
+		vq_free = head;
+  80065b:	66 89 35 34 50 81 00 	mov    %si,0x815034
+		vq_nfree++;
+  800662:	66 83 05 32 50 81 00 	addw   $0x1,0x815032
+  800669:	01 
+		if (req->r_write) {
+  80066a:	80 78 02 00          	cmpb   $0x0,0x2(%eax)
+  80066e:	74 76                	je     8006e6 <vb_wait+0x124>
+			if (vb_slots[req - vb_reqs].s_status != VIRTIO_BLK_S_OK)
+  800670:	89 c2                	mov    %eax,%edx
+  800672:	81 ea 60 50 81 00    	sub    $0x815060,%edx
+  800678:	c1 fa 04             	sar    $0x4,%edx
+  80067b:	c1 e2 05             	shl    $0x5,%edx
+  80067e:	81 c2 00 d0 ff 0f    	add    $0xfffd000,%edx
+  800684:	0f b6 52 10          	movzbl 0x10(%edx),%edx
+  800688:	84 d2                	test   %dl,%dl
+  80068a:	74 0a                	je     800696 <vb_wait+0xd4>
+				vb_error = -1;
+  80068c:	c7 05 20 50 81 00 ff 	movl   $0xffffffff,0x815020
+  800693:	ff ff ff 
+			req->r_busy = 0;
+  800696:	c6 00 00             	movb   $0x0,(%eax)
+	for (n = 0; vq_last_used != vq_used->u_idx; n++) {
+  800699:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+  80069d:	a1 38 50 81 00       	mov    0x815038,%eax
+  8006a2:	0f b7 40 02          	movzwl 0x2(%eax),%eax
+  8006a6:	66 3b 05 30 50 81 00 	cmp    0x815030,%ax
+  8006ad:	74 3d                	je     8006ec <vb_wait+0x12a>
+		head = vq_used->u_ring[vq_last_used % vq_size].ue_id;
+  8006af:	0f b7 1d 30 50 81 00 	movzwl 0x815030,%ebx
+  8006b6:	89 d8                	mov    %ebx,%eax
+  8006b8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006bd:	66 f7 35 44 50 81 00 	divw   0x815044
+  8006c4:	0f b7 d2             	movzwl %dx,%edx
+  8006c7:	a1 38 50 81 00       	mov    0x815038,%eax
+  8006cc:	8b 74 d0 04          	mov    0x4(%eax,%edx,8),%esi
+  8006d0:	89 f1                	mov    %esi,%ecx
+		vq_last_used++;
+  8006d2:	83 c3 01             	add    $0x1,%ebx
+  8006d5:	66 89 1d 30 50 81 00 	mov    %bx,0x815030
+		for (req = vb_reqs; req < vb_reqs + VB_NREQ; req++)
+  8006dc:	b8 60 50 81 00       	mov    $0x815060,%eax
+  8006e1:	e9 f4 fe ff ff       	jmp    8005da <vb_wait+0x18>
+			req->r_done = 1;
+  8006e6:	c6 40 01 01          	movb   $0x1,0x1(%eax)
+  8006ea:	eb ad                	jmp    800699 <vb_wait+0xd7>
+		if (vb_reap() > 0)
+  8006ec:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+  8006ef:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8006f3:	7f 45                	jg     80073a <vb_wait+0x178>
+		if (vb_polling)
+  8006f5:	80 3d 24 50 81 00 00 	cmpb   $0x0,0x815024
+  8006fc:	74 25                	je     800723 <vb_wait+0x161>
+			sys_yield();
+  8006fe:	e8 63 6e 00 00       	call   807566 <sys_yield>
+		seen = vb_irqs;
+  800703:	8b 35 28 50 81 00    	mov    0x815028,%esi
+	inb(vb_base + VIRTIO_ISR);
+  800709:	0f b7 15 46 50 81 00 	movzwl 0x815046,%edx
+  800710:	83 c2 13             	add    $0x13,%edx
+  __asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+  800713:	ec                   	in     (%dx),%al
+	for (n = 0; vq_last_used != vq_used->u_idx; n++) {
+  800714:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+  80071b:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  80071e:	e9 7a ff ff ff       	jmp    80069d <vb_wait+0xdb>
+			sys_chan_sleep(&vb_irqs, seen, (void *) UTOP,
+  800723:	6a 64                	push   $0x64
+  800725:	68 00 00 c0 ee       	push   $0xeec00000
+  80072a:	56                   	push   %esi
+  80072b:	68 28 50 81 00       	push   $0x815028
+  800730:	e8 cc 71 00 00       	call   807901 <sys_chan_sleep>
+  800735:	83 c4 10             	add    $0x10,%esp
+  800738:	eb c9                	jmp    800703 <vb_wait+0x141>
+}
+  80073a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80073d:	5b                   	pop    %ebx
+  80073e:	5e                   	pop    %esi
+  80073f:	5f                   	pop    %edi
+  800740:	5d                   	pop    %ebp
+  800741:	c3                   	ret
+
+00800742 <vb_submit>:
+// Queue a request to move 'nsecs' sectors between the disk at 'secno'
+// and the memory at 'va', which must stay mapped until it is finished.
+// Returns the request, or < 0 on error.
+static int
+vb_submit(uint32_t secno, const void *va, size_t nsecs, bool write)
+{
+  800742:	55                   	push   %ebp
+  800743:	89 e5                	mov    %esp,%ebp
+  800745:	57                   	push   %edi
+  800746:	56                   	push   %esi
+  800747:	53                   	push   %ebx
+  800748:	83 ec 3c             	sub    $0x3c,%esp
+  80074b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80074e:	89 d3                	mov    %edx,%ebx
+  800750:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  800753:	8b 45 08             	mov    0x8(%ebp),%eax
+  800756:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+	uintptr_t p, end;
+	uint16_t d, prev;
+	uint32_t len;
+	int pa;
+
+	assert(nsecs <= 256);
+  800759:	81 f9 00 01 00 00    	cmp    $0x100,%ecx
+  80075f:	76 30                	jbe    800791 <vb_submit+0x4f>
+  800761:	68 21 99 80 00       	push   $0x809921
+  800766:	68 2e 99 80 00       	push   $0x80992e
+  80076b:	68 17 01 00 00       	push   $0x117
+  800770:	68 6e 9a 80 00       	push   $0x809a6e
+  800775:	e8 56 63 00 00       	call   806ad0 <_panic>
+	// Wait for a free request and enough descriptors.
+	for (;;) {
+		for (req = vb_reqs; req < vb_reqs + VB_NREQ; req++)
+			if (!req->r_busy)
+				break;
+		if (req < vb_reqs + VB_NREQ && vq_nfree >= VB_MAXSEGS + 2)
+  80077a:	81 ff e0 50 81 00    	cmp    $0x8150e0,%edi
+  800780:	73 0a                	jae    80078c <vb_submit+0x4a>
+  800782:	66 83 3d 32 50 81 00 	cmpw   $0x22,0x815032
+  800789:	22 
+  80078a:	77 1c                	ja     8007a8 <vb_submit+0x66>
+			break;
+		vb_wait();
+  80078c:	e8 31 fe ff ff       	call   8005c2 <vb_wait>
+		for (req = vb_reqs; req < vb_reqs + VB_NREQ; req++)
+  800791:	bf 60 50 81 00       	mov    $0x815060,%edi
+			if (!req->r_busy)
+  800796:	80 3f 00             	cmpb   $0x0,(%edi)
+  800799:	74 df                	je     80077a <vb_submit+0x38>
+		for (req = vb_reqs; req < vb_reqs + VB_NREQ; req++)
+  80079b:	83 c7 10             	add    $0x10,%edi
+  80079e:	81 ff e0 50 81 00    	cmp    $0x8150e0,%edi
+  8007a4:	75 f0                	jne    800796 <vb_submit+0x54>
+  8007a6:	eb e4                	jmp    80078c <vb_submit+0x4a>
+	}
+	slot = &vb_slots[req - vb_reqs];
+  8007a8:	89 f8                	mov    %edi,%eax
+  8007aa:	2d 60 50 81 00       	sub    $0x815060,%eax
+  8007af:	c1 f8 04             	sar    $0x4,%eax
+  8007b2:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8007b5:	c1 e0 05             	shl    $0x5,%eax
+  8007b8:	8d b0 00 d0 ff 0f    	lea    0xfffd000(%eax),%esi
+	slot->s_hdr.h_type = write ? VIRTIO_BLK_T_OUT : VIRTIO_BLK_T_IN;
+  8007be:	0f b6 55 d4          	movzbl -0x2c(%ebp),%edx
+  8007c2:	89 90 00 d0 ff 0f    	mov    %edx,0xfffd000(%eax)
+	slot->s_hdr.h_ioprio = 0;
+  8007c8:	c7 80 04 d0 ff 0f 00 	movl   $0x0,0xfffd004(%eax)
+  8007cf:	00 00 00 
+	slot->s_hdr.h_sector = secno;
+  8007d2:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8007d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8007da:	89 46 08             	mov    %eax,0x8(%esi)
+  8007dd:	89 56 0c             	mov    %edx,0xc(%esi)
+	slot->s_status = 0xFF;
+  8007e0:	c6 46 10 ff          	movb   $0xff,0x10(%esi)
+
+	req->r_head = prev = vq_alloc_desc();
+  8007e4:	e8 b1 fd ff ff       	call   80059a <vq_alloc_desc>
+  8007e9:	66 89 45 e6          	mov    %ax,-0x1a(%ebp)
+  8007ed:	66 89 47 04          	mov    %ax,0x4(%edi)
+	vq_desc[prev].d_addr = vb_slots_pa + PGOFF(&slot->s_hdr);
+  8007f1:	0f b7 c8             	movzwl %ax,%ecx
+  8007f4:	c1 e1 04             	shl    $0x4,%ecx
+  8007f7:	03 0d 40 50 81 00    	add    0x815040,%ecx
+  8007fd:	89 f0                	mov    %esi,%eax
+  8007ff:	25 ff 0f 00 00       	and    $0xfff,%eax
+  800804:	03 05 2c 50 81 00    	add    0x81502c,%eax
+  80080a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80080f:	89 01                	mov    %eax,(%ecx)
+  800811:	89 51 04             	mov    %edx,0x4(%ecx)
+	vq_desc[prev].d_len = sizeof(slot->s_hdr);
+  800814:	c7 41 08 10 00 00 00 	movl   $0x10,0x8(%ecx)
+	vq_desc[prev].d_flags = VRING_DESC_NEXT;
+  80081b:	66 c7 41 0c 01 00    	movw   $0x1,0xc(%ecx)
+
+	// One descriptor per page of data: the pages needn't be
+	// contiguous in physical memory.
+	end = (uintptr_t) va + nsecs * SECTSIZE;
+  800821:	89 da                	mov    %ebx,%edx
+  800823:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800826:	c1 e0 09             	shl    $0x9,%eax
+  800829:	01 c2                	add    %eax,%edx
+  80082b:	89 55 e0             	mov    %edx,-0x20(%ebp)
+	for (p = (uintptr_t) va; p < end; p += len) {
+  80082e:	80 7d d4 01          	cmpb   $0x1,-0x2c(%ebp)
+  800832:	19 c0                	sbb    %eax,%eax
+  800834:	83 e0 02             	and    $0x2,%eax
+  800837:	83 c0 01             	add    $0x1,%eax
+  80083a:	66 89 45 da          	mov    %ax,-0x26(%ebp)
+  80083e:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+  800841:	89 75 c0             	mov    %esi,-0x40(%ebp)
+  800844:	89 de                	mov    %ebx,%esi
+  800846:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800849:	39 c6                	cmp    %eax,%esi
+  80084b:	0f 83 97 00 00 00    	jae    8008e8 <vb_submit+0x1a6>
+		len = MIN(end - p, PGSIZE - PGOFF(p));
+  800851:	89 f7                	mov    %esi,%edi
+  800853:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  800859:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  80085c:	29 f3                	sub    %esi,%ebx
+  80085e:	b8 00 10 00 00       	mov    $0x1000,%eax
+  800863:	29 f8                	sub    %edi,%eax
+  800865:	39 c3                	cmp    %eax,%ebx
+  800867:	0f 47 d8             	cmova  %eax,%ebx
+		if ((pa = sys_page_paddr((void *) ROUNDDOWN(p, PGSIZE))) < 0)
+  80086a:	83 ec 0c             	sub    $0xc,%esp
+  80086d:	89 f0                	mov    %esi,%eax
+  80086f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800874:	50                   	push   %eax
+  800875:	e8 9b 6e 00 00       	call   807715 <sys_page_paddr>
+  80087a:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  80087d:	83 c4 10             	add    $0x10,%esp
+  800880:	85 c0                	test   %eax,%eax
+  800882:	78 4f                	js     8008d3 <vb_submit+0x191>
+			panic("virtio-blk: buffer %08x not mapped", p);
+		d = vq_alloc_desc();
+  800884:	e8 11 fd ff ff       	call   80059a <vq_alloc_desc>
+		vq_desc[d].d_addr = pa + PGOFF(p);
+  800889:	66 89 45 e4          	mov    %ax,-0x1c(%ebp)
+  80088d:	0f b7 c8             	movzwl %ax,%ecx
+  800890:	c1 e1 04             	shl    $0x4,%ecx
+  800893:	03 0d 40 50 81 00    	add    0x815040,%ecx
+  800899:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80089c:	01 f8                	add    %edi,%eax
+  80089e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008a3:	89 01                	mov    %eax,(%ecx)
+  8008a5:	89 51 04             	mov    %edx,0x4(%ecx)
+		vq_desc[d].d_len = len;
+  8008a8:	89 59 08             	mov    %ebx,0x8(%ecx)
+		vq_desc[d].d_flags = VRING_DESC_NEXT | (write ? 0 : VRING_DESC_WRITE);
+  8008ab:	0f b7 7d da          	movzwl -0x26(%ebp),%edi
+  8008af:	66 89 79 0c          	mov    %di,0xc(%ecx)
+		vq_desc[prev].d_next = d;
+  8008b3:	0f b7 45 e6          	movzwl -0x1a(%ebp),%eax
+  8008b7:	c1 e0 04             	shl    $0x4,%eax
+  8008ba:	03 05 40 50 81 00    	add    0x815040,%eax
+  8008c0:	0f b7 55 e4          	movzwl -0x1c(%ebp),%edx
+  8008c4:	66 89 50 0e          	mov    %dx,0xe(%eax)
+	for (p = (uintptr_t) va; p < end; p += len) {
+  8008c8:	01 de                	add    %ebx,%esi
+		prev = d;
+  8008ca:	66 89 55 e6          	mov    %dx,-0x1a(%ebp)
+  8008ce:	e9 73 ff ff ff       	jmp    800846 <vb_submit+0x104>
+			panic("virtio-blk: buffer %08x not mapped", p);
+  8008d3:	56                   	push   %esi
+  8008d4:	68 b8 99 80 00       	push   $0x8099b8
+  8008d9:	68 33 01 00 00       	push   $0x133
+  8008de:	68 6e 9a 80 00       	push   $0x809a6e
+  8008e3:	e8 e8 61 00 00       	call   806ad0 <_panic>
+	}
+
+	d = vq_alloc_desc();
+  8008e8:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  8008eb:	8b 75 c0             	mov    -0x40(%ebp),%esi
+  8008ee:	e8 a7 fc ff ff       	call   80059a <vq_alloc_desc>
+  8008f3:	89 c3                	mov    %eax,%ebx
+	vq_desc[d].d_addr = vb_slots_pa + PGOFF(&slot->s_status);
+  8008f5:	0f b7 c8             	movzwl %ax,%ecx
+  8008f8:	c1 e1 04             	shl    $0x4,%ecx
+  8008fb:	03 0d 40 50 81 00    	add    0x815040,%ecx
+  800901:	8d 46 10             	lea    0x10(%esi),%eax
+  800904:	25 ff 0f 00 00       	and    $0xfff,%eax
+  800909:	03 05 2c 50 81 00    	add    0x81502c,%eax
+  80090f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800914:	89 01                	mov    %eax,(%ecx)
+  800916:	89 51 04             	mov    %edx,0x4(%ecx)
+	vq_desc[d].d_len = 1;
+  800919:	c7 41 08 01 00 00 00 	movl   $0x1,0x8(%ecx)
+	vq_desc[d].d_flags = VRING_DESC_WRITE;
+  800920:	66 c7 41 0c 02 00    	movw   $0x2,0xc(%ecx)
+	vq_desc[prev].d_next = d;
+  800926:	0f b7 45 e6          	movzwl -0x1a(%ebp),%eax
+  80092a:	c1 e0 04             	shl    $0x4,%eax
+  80092d:	03 05 40 50 81 00    	add    0x815040,%eax
+  800933:	66 89 58 0e          	mov    %bx,0xe(%eax)
+
+	req->r_busy = 1;
+  800937:	c6 07 01             	movb   $0x1,(%edi)
+	req->r_done = 0;
+  80093a:	c6 47 01 00          	movb   $0x0,0x1(%edi)
+	req->r_write = write;
+  80093e:	0f b6 45 d4          	movzbl -0x2c(%ebp),%eax
+  800942:	88 47 02             	mov    %al,0x2(%edi)
+	req->r_secno = secno;
+  800945:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800948:	89 47 08             	mov    %eax,0x8(%edi)
+	req->r_nsecs = nsecs;
+  80094b:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80094e:	89 47 0c             	mov    %eax,0xc(%edi)
+
+	// Publish the chain, then the new index, then tell the device.
+	vq_avail->a_ring[vq_avail->a_idx % vq_size] = req->r_head;
+  800951:	8b 0d 3c 50 81 00    	mov    0x81503c,%ecx
+  800957:	0f b7 41 02          	movzwl 0x2(%ecx),%eax
+  80095b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800960:	66 f7 35 44 50 81 00 	divw   0x815044
+  800967:	0f b7 d2             	movzwl %dx,%edx
+  80096a:	0f b7 47 04          	movzwl 0x4(%edi),%eax
+  80096e:	66 89 44 51 04       	mov    %ax,0x4(%ecx,%edx,2)
+	vb_barrier();
+	vq_avail->a_idx++;
+  800973:	8b 15 3c 50 81 00    	mov    0x81503c,%edx
+  800979:	0f b7 42 02          	movzwl 0x2(%edx),%eax
+  80097d:	83 c0 01             	add    $0x1,%eax
+  800980:	66 89 42 02          	mov    %ax,0x2(%edx)
+	vb_barrier();
+	outw(vb_base + VIRTIO_QUEUE_NOTIFY, 0);
+  800984:	0f b7 15 46 50 81 00 	movzwl 0x815046,%edx
+  80098b:	83 c2 10             	add    $0x10,%edx
+  __asm __volatile("outw %0,%w1" : : "a" (data), "d" (port));
+  80098e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800993:	66 ef                	out    %ax,(%dx)
+	return req - vb_reqs;
+}
+  800995:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800998:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80099b:	5b                   	pop    %ebx
+  80099c:	5e                   	pop    %esi
+  80099d:	5f                   	pop    %edi
+  80099e:	5d                   	pop    %ebp
+  80099f:	c3                   	ret
+
+008009a0 <virtio_blk_init>:
+{
+  8009a0:	55                   	push   %ebp
+  8009a1:	89 e5                	mov    %esp,%ebp
+  8009a3:	57                   	push   %edi
+  8009a4:	56                   	push   %esi
+  8009a5:	53                   	push   %ebx
+  8009a6:	83 ec 40             	sub    $0x40,%esp
+	if (pci_find_device(VIRTIO_VENDOR, VIRTIO_BLK_DEVICE, &f) < 0 ||
+  8009a9:	8d 45 b8             	lea    -0x48(%ebp),%eax
+  8009ac:	50                   	push   %eax
+  8009ad:	68 01 10 00 00       	push   $0x1001
+  8009b2:	68 f4 1a 00 00       	push   $0x1af4
+  8009b7:	e8 6e 0e 00 00       	call   80182a <pci_find_device>
+  8009bc:	83 c4 10             	add    $0x10,%esp
+  8009bf:	85 c0                	test   %eax,%eax
+  8009c1:	0f 88 4a 02 00 00    	js     800c11 <virtio_blk_init+0x271>
+  8009c7:	f6 45 cc 01          	testb  $0x1,-0x34(%ebp)
+  8009cb:	0f 84 47 02 00 00    	je     800c18 <virtio_blk_init+0x278>
+	pci_enable(&f, PCI_COMMAND_IO | PCI_COMMAND_MASTER);
+  8009d1:	83 ec 08             	sub    $0x8,%esp
+  8009d4:	6a 05                	push   $0x5
+  8009d6:	8d 45 b8             	lea    -0x48(%ebp),%eax
+  8009d9:	50                   	push   %eax
+  8009da:	e8 00 0e 00 00       	call   8017df <pci_enable>
+	vb_base = f.pf_bar[0] & ~3;
+  8009df:	0f b7 4d cc          	movzwl -0x34(%ebp),%ecx
+  8009e3:	83 e1 fc             	and    $0xfffffffc,%ecx
+  8009e6:	66 89 0d 46 50 81 00 	mov    %cx,0x815046
+	outb(vb_base + VIRTIO_STATUS, 0);
+  8009ed:	0f b7 c9             	movzwl %cx,%ecx
+  8009f0:	8d 51 12             	lea    0x12(%ecx),%edx
+  __asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  8009f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009f8:	ee                   	out    %al,(%dx)
+  8009f9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8009fe:	ee                   	out    %al,(%dx)
+  8009ff:	b8 03 00 00 00       	mov    $0x3,%eax
+  800a04:	ee                   	out    %al,(%dx)
+	outl(vb_base + VIRTIO_GUEST_FEATURES, 0);
+  800a05:	8d 51 04             	lea    0x4(%ecx),%edx
+  __asm __volatile("outl %0,%w1" : : "a" (data), "d" (port));
+  800a08:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a0d:	ef                   	out    %eax,(%dx)
+	outw(vb_base + VIRTIO_QUEUE_SEL, 0);
+  800a0e:	8d 51 0e             	lea    0xe(%ecx),%edx
+  __asm __volatile("outw %0,%w1" : : "a" (data), "d" (port));
+  800a11:	66 ef                	out    %ax,(%dx)
+	vq_size = inw(vb_base + VIRTIO_QUEUE_SIZE);
+  800a13:	8d 51 0c             	lea    0xc(%ecx),%edx
+  __asm __volatile("inw %w1,%0" : "=a" (data) : "d" (port));
+  800a16:	66 ed                	in     (%dx),%ax
+  800a18:	66 a3 44 50 81 00    	mov    %ax,0x815044
+	avail_off = vq_size * sizeof(struct VringDesc);
+  800a1e:	0f b7 c8             	movzwl %ax,%ecx
+  800a21:	89 ce                	mov    %ecx,%esi
+  800a23:	c1 e6 04             	shl    $0x4,%esi
+	used_off = ROUNDUP(avail_off + 6 + 2 * vq_size, PGSIZE);
+  800a26:	8d 9c 4e 05 10 00 00 	lea    0x1005(%esi,%ecx,2),%ebx
+  800a2d:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	npages = (used_off + ROUNDUP(6 + 8 * vq_size, PGSIZE)) / PGSIZE;
+  800a33:	8d 14 cd 05 10 00 00 	lea    0x1005(,%ecx,8),%edx
+  800a3a:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  800a40:	01 da                	add    %ebx,%edx
+  800a42:	89 d7                	mov    %edx,%edi
+  800a44:	c1 ef 0c             	shr    $0xc,%edi
+	if (vq_size < VB_MAXSEGS + 2 || npages > VQ_MAXPAGES) {
+  800a47:	83 c4 10             	add    $0x10,%esp
+  800a4a:	81 fa ff 0f 01 00    	cmp    $0x10fff,%edx
+  800a50:	0f 87 bc 00 00 00    	ja     800b12 <virtio_blk_init+0x172>
+  800a56:	66 83 f8 22          	cmp    $0x22,%ax
+  800a5a:	0f 86 b2 00 00 00    	jbe    800b12 <virtio_blk_init+0x172>
+	if ((r = sys_page_alloc_contig((void *) VIRTIO_VQVA, npages,
+  800a60:	83 ec 04             	sub    $0x4,%esp
+  800a63:	6a 07                	push   $0x7
+  800a65:	57                   	push   %edi
+  800a66:	68 00 00 fe 0f       	push   $0xffe0000
+  800a6b:	e8 c5 6c 00 00       	call   807735 <sys_page_alloc_contig>
+  800a70:	83 c4 10             	add    $0x10,%esp
+  800a73:	85 c0                	test   %eax,%eax
+  800a75:	0f 88 cb 00 00 00    	js     800b46 <virtio_blk_init+0x1a6>
+	    (r = sys_page_alloc(0, (void *) VIRTIO_HDRVA,
+  800a7b:	83 ec 04             	sub    $0x4,%esp
+  800a7e:	6a 07                	push   $0x7
+  800a80:	68 00 d0 ff 0f       	push   $0xfffd000
+  800a85:	6a 00                	push   $0x0
+  800a87:	e8 3c 6b 00 00       	call   8075c8 <sys_page_alloc>
+				       PTE_P|PTE_U|PTE_W)) < 0 ||
+  800a8c:	83 c4 10             	add    $0x10,%esp
+  800a8f:	85 c0                	test   %eax,%eax
+  800a91:	0f 88 af 00 00 00    	js     800b46 <virtio_blk_init+0x1a6>
+	    (r = sys_page_paddr((void *) VIRTIO_HDRVA)) < 0)
+  800a97:	83 ec 0c             	sub    $0xc,%esp
+  800a9a:	68 00 d0 ff 0f       	push   $0xfffd000
+  800a9f:	e8 71 6c 00 00       	call   807715 <sys_page_paddr>
+				PTE_P|PTE_U|PTE_W)) < 0 ||
+  800aa4:	83 c4 10             	add    $0x10,%esp
+  800aa7:	85 c0                	test   %eax,%eax
+  800aa9:	0f 88 97 00 00 00    	js     800b46 <virtio_blk_init+0x1a6>
+	vb_slots_pa = r;
+  800aaf:	a3 2c 50 81 00       	mov    %eax,0x81502c
+	if ((r = sys_page_paddr((void *) VIRTIO_VQVA)) < 0)
+  800ab4:	83 ec 0c             	sub    $0xc,%esp
+  800ab7:	68 00 00 fe 0f       	push   $0xffe0000
+  800abc:	e8 54 6c 00 00       	call   807715 <sys_page_paddr>
+  800ac1:	83 c4 10             	add    $0x10,%esp
+  800ac4:	85 c0                	test   %eax,%eax
+  800ac6:	0f 88 8f 00 00 00    	js     800b5b <virtio_blk_init+0x1bb>
+	outl(vb_base + VIRTIO_QUEUE_PFN, r >> PGSHIFT);
+  800acc:	c1 f8 0c             	sar    $0xc,%eax
+  800acf:	0f b7 15 46 50 81 00 	movzwl 0x815046,%edx
+  800ad6:	83 c2 08             	add    $0x8,%edx
+  __asm __volatile("outl %0,%w1" : : "a" (data), "d" (port));
+  800ad9:	ef                   	out    %eax,(%dx)
+	vq_desc = (struct VringDesc *) VIRTIO_VQVA;
+  800ada:	c7 05 40 50 81 00 00 	movl   $0xffe0000,0x815040
+  800ae1:	00 fe 0f 
+	vq_avail = (struct VringAvail *) (VIRTIO_VQVA + avail_off);
+  800ae4:	81 c6 00 00 fe 0f    	add    $0xffe0000,%esi
+  800aea:	89 35 3c 50 81 00    	mov    %esi,0x81503c
+	vq_used = (struct VringUsed *) (VIRTIO_VQVA + used_off);
+  800af0:	81 c3 00 00 fe 0f    	add    $0xffe0000,%ebx
+  800af6:	89 1d 38 50 81 00    	mov    %ebx,0x815038
+	for (i = 0; i < vq_size; i++)
+  800afc:	0f b7 35 44 50 81 00 	movzwl 0x815044,%esi
+  800b03:	0f b7 de             	movzwl %si,%ebx
+  800b06:	ba 00 00 fe 0f       	mov    $0xffe0000,%edx
+  800b0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b10:	eb 67                	jmp    800b79 <virtio_blk_init+0x1d9>
+		cprintf("virtio-blk: can't use a queue of %d\n", vq_size);
+  800b12:	83 ec 08             	sub    $0x8,%esp
+  800b15:	51                   	push   %ecx
+  800b16:	68 dc 99 80 00       	push   $0x8099dc
+  800b1b:	e8 8b 60 00 00       	call   806bab <cprintf>
+	outb(vb_base + VIRTIO_STATUS, VIRTIO_ST_FAILED);
+  800b20:	0f b7 15 46 50 81 00 	movzwl 0x815046,%edx
+  800b27:	83 c2 12             	add    $0x12,%edx
+  __asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+  800b2a:	b8 80 ff ff ff       	mov    $0xffffff80,%eax
+  800b2f:	ee                   	out    %al,(%dx)
+	vb_base = 0;
+  800b30:	66 c7 05 46 50 81 00 	movw   $0x0,0x815046
+  800b37:	00 00 
+	return -E_NOT_FOUND;
+  800b39:	83 c4 10             	add    $0x10,%esp
+  800b3c:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  800b41:	e9 a6 00 00 00       	jmp    800bec <virtio_blk_init+0x24c>
+		panic("virtio_blk_init: %e", r);
+  800b46:	50                   	push   %eax
+  800b47:	68 7a 9a 80 00       	push   $0x809a7a
+  800b4c:	68 9e 00 00 00       	push   $0x9e
+  800b51:	68 6e 9a 80 00       	push   $0x809a6e
+  800b56:	e8 75 5f 00 00       	call   806ad0 <_panic>
+		panic("virtio_blk_init: %e", r);
+  800b5b:	50                   	push   %eax
+  800b5c:	68 7a 9a 80 00       	push   $0x809a7a
+  800b61:	68 a1 00 00 00       	push   $0xa1
+  800b66:	68 6e 9a 80 00       	push   $0x809a6e
+  800b6b:	e8 60 5f 00 00       	call   806ad0 <_panic>
+		vq_desc[i].d_next = i + 1;
+  800b70:	66 89 4a 0e          	mov    %cx,0xe(%edx)
+	for (i = 0; i < vq_size; i++)
+  800b74:	83 c2 10             	add    $0x10,%edx
+		vq_desc[i].d_next = i + 1;
+  800b77:	89 c8                	mov    %ecx,%eax
+	for (i = 0; i < vq_size; i++)
+  800b79:	8d 48 01             	lea    0x1(%eax),%ecx
+  800b7c:	39 d8                	cmp    %ebx,%eax
+  800b7e:	75 f0                	jne    800b70 <virtio_blk_init+0x1d0>
+	vq_free = 0;
+  800b80:	66 c7 05 34 50 81 00 	movw   $0x0,0x815034
+  800b87:	00 00 
+	vq_nfree = vq_size;
+  800b89:	66 89 35 32 50 81 00 	mov    %si,0x815032
+	vq_last_used = 0;
+  800b90:	66 c7 05 30 50 81 00 	movw   $0x0,0x815030
+  800b97:	00 00 
+	if ((r = sys_irq_listen(f.pf_irq, &vb_irqs)) < 0) {
+  800b99:	83 ec 08             	sub    $0x8,%esp
+  800b9c:	68 28 50 81 00       	push   $0x815028
+  800ba1:	ff 75 e4             	push   -0x1c(%ebp)
+  800ba4:	e8 2a 6b 00 00       	call   8076d3 <sys_irq_listen>
+  800ba9:	83 c4 10             	add    $0x10,%esp
+  800bac:	85 c0                	test   %eax,%eax
+  800bae:	78 44                	js     800bf4 <virtio_blk_init+0x254>
+	outb(vb_base + VIRTIO_STATUS,
+  800bb0:	0f b7 0d 46 50 81 00 	movzwl 0x815046,%ecx
+  800bb7:	8d 51 12             	lea    0x12(%ecx),%edx
+  800bba:	b8 07 00 00 00       	mov    $0x7,%eax
+  800bbf:	ee                   	out    %al,(%dx)
+	capacity = inl(vb_base + VIRTIO_BLK_CAPACITY) |
+  800bc0:	8d 51 14             	lea    0x14(%ecx),%edx
+  __asm __volatile("inl %w1,%0" : "=a" (data) : "d" (port));
+  800bc3:	ed                   	in     (%dx),%eax
+  800bc4:	89 c3                	mov    %eax,%ebx
+		((uint64_t) inl(vb_base + VIRTIO_BLK_CAPACITY + 4) << 32);
+  800bc6:	8d 51 18             	lea    0x18(%ecx),%edx
+  800bc9:	ed                   	in     (%dx),%eax
+	cprintf("virtio-blk: %u sectors, queue of %d, port %x, irq %d\n",
+  800bca:	83 ec 0c             	sub    $0xc,%esp
+  800bcd:	ff 75 e4             	push   -0x1c(%ebp)
+  800bd0:	51                   	push   %ecx
+  800bd1:	0f b7 05 44 50 81 00 	movzwl 0x815044,%eax
+  800bd8:	50                   	push   %eax
+  800bd9:	53                   	push   %ebx
+  800bda:	68 38 9a 80 00       	push   $0x809a38
+  800bdf:	e8 c7 5f 00 00       	call   806bab <cprintf>
+	return 0;
+  800be4:	83 c4 20             	add    $0x20,%esp
+  800be7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800bec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bef:	5b                   	pop    %ebx
+  800bf0:	5e                   	pop    %esi
+  800bf1:	5f                   	pop    %edi
+  800bf2:	5d                   	pop    %ebp
+  800bf3:	c3                   	ret
+		cprintf("virtio-blk: can't listen for irq %d (%e), polling\n",
+  800bf4:	83 ec 04             	sub    $0x4,%esp
+  800bf7:	50                   	push   %eax
+  800bf8:	ff 75 e4             	push   -0x1c(%ebp)
+  800bfb:	68 04 9a 80 00       	push   $0x809a04
+  800c00:	e8 a6 5f 00 00       	call   806bab <cprintf>
+		vb_polling = 1;
+  800c05:	c6 05 24 50 81 00 01 	movb   $0x1,0x815024
+  800c0c:	83 c4 10             	add    $0x10,%esp
+  800c0f:	eb 9f                	jmp    800bb0 <virtio_blk_init+0x210>
+		return -E_NOT_FOUND;
+  800c11:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  800c16:	eb d4                	jmp    800bec <virtio_blk_init+0x24c>
+  800c18:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  800c1d:	eb cd                	jmp    800bec <virtio_blk_init+0x24c>
+
+00800c1f <virtio_blk_read>:
+	return r;
+}
+
+int
+virtio_blk_read(uint32_t secno, void *dst, size_t nsecs)
+{
+  800c1f:	55                   	push   %ebp
+  800c20:	89 e5                	mov    %esp,%ebp
+  800c22:	56                   	push   %esi
+  800c23:	53                   	push   %ebx
+	struct VbReq *req;
+	int r;
+
+	if ((r = vb_submit(secno, dst, nsecs, 0)) < 0)
+  800c24:	83 ec 0c             	sub    $0xc,%esp
+  800c27:	6a 00                	push   $0x0
+  800c29:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800c2c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c2f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c32:	e8 0b fb ff ff       	call   800742 <vb_submit>
+  800c37:	89 c3                	mov    %eax,%ebx
+  800c39:	83 c4 10             	add    $0x10,%esp
+  800c3c:	85 c0                	test   %eax,%eax
+  800c3e:	78 42                	js     800c82 <virtio_blk_read+0x63>
+		return r;
+	req = &vb_reqs[r];
+	while (!req->r_done)
+  800c40:	89 c6                	mov    %eax,%esi
+  800c42:	c1 e6 04             	shl    $0x4,%esi
+  800c45:	81 c6 60 50 81 00    	add    $0x815060,%esi
+  800c4b:	eb 05                	jmp    800c52 <virtio_blk_read+0x33>
+		vb_wait();
+  800c4d:	e8 70 f9 ff ff       	call   8005c2 <vb_wait>
+	while (!req->r_done)
+  800c52:	80 7e 01 00          	cmpb   $0x0,0x1(%esi)
+  800c56:	74 f5                	je     800c4d <virtio_blk_read+0x2e>
+	req->r_busy = 0;
+  800c58:	89 d8                	mov    %ebx,%eax
+  800c5a:	c1 e0 04             	shl    $0x4,%eax
+  800c5d:	c6 80 60 50 81 00 00 	movb   $0x0,0x815060(%eax)
+	if (vb_slots[r].s_status != VIRTIO_BLK_S_OK)
+  800c64:	c1 e3 05             	shl    $0x5,%ebx
+  800c67:	0f b6 83 10 d0 ff 0f 	movzbl 0xfffd010(%ebx),%eax
+  800c6e:	84 c0                	test   %al,%al
+  800c70:	75 19                	jne    800c8b <virtio_blk_read+0x6c>
+	int r = vb_error;
+  800c72:	8b 1d 20 50 81 00    	mov    0x815020,%ebx
+	vb_error = 0;
+  800c78:	c7 05 20 50 81 00 00 	movl   $0x0,0x815020
+  800c7f:	00 00 00 
+		return -1;
+	return vb_status();
+}
+  800c82:	89 d8                	mov    %ebx,%eax
+  800c84:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c87:	5b                   	pop    %ebx
+  800c88:	5e                   	pop    %esi
+  800c89:	5d                   	pop    %ebp
+  800c8a:	c3                   	ret
+		return -1;
+  800c8b:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+  800c90:	eb f0                	jmp    800c82 <virtio_blk_read+0x63>
+
+00800c92 <virtio_blk_write>:
+// must stay mapped and unchanged until virtio_blk_sync or a matching
+// virtio_blk_sync_range.  Those, and later reads and writes, report an
+// error in the write.
+int
+virtio_blk_write(uint32_t secno, const void *src, size_t nsecs)
+{
+  800c92:	55                   	push   %ebp
+  800c93:	89 e5                	mov    %esp,%ebp
+  800c95:	83 ec 14             	sub    $0x14,%esp
+	int r;
+
+	if ((r = vb_submit(secno, src, nsecs, 1)) < 0)
+  800c98:	6a 01                	push   $0x1
+  800c9a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  800c9d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ca0:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ca3:	e8 9a fa ff ff       	call   800742 <vb_submit>
+  800ca8:	83 c4 10             	add    $0x10,%esp
+  800cab:	85 c0                	test   %eax,%eax
+  800cad:	78 0f                	js     800cbe <virtio_blk_write+0x2c>
+	int r = vb_error;
+  800caf:	a1 20 50 81 00       	mov    0x815020,%eax
+	vb_error = 0;
+  800cb4:	c7 05 20 50 81 00 00 	movl   $0x0,0x815020
+  800cbb:	00 00 00 
+		return r;
+	return vb_status();
+}
+  800cbe:	c9                   	leave
+  800cbf:	c3                   	ret
+
+00800cc0 <virtio_blk_sync>:
+
+// Wait for every queued write to finish.  Returns 0, or -1 if any
+// failed.
+int
+virtio_blk_sync(void)
+{
+  800cc0:	55                   	push   %ebp
+  800cc1:	89 e5                	mov    %esp,%ebp
+  800cc3:	53                   	push   %ebx
+  800cc4:	83 ec 04             	sub    $0x4,%esp
+	struct VbReq *req;
+
+	for (req = vb_reqs; req < vb_reqs + VB_NREQ; req++)
+  800cc7:	bb 60 50 81 00       	mov    $0x815060,%ebx
+  800ccc:	eb 05                	jmp    800cd3 <virtio_blk_sync+0x13>
+		while (req->r_busy && req->r_write)
+			vb_wait();
+  800cce:	e8 ef f8 ff ff       	call   8005c2 <vb_wait>
+		while (req->r_busy && req->r_write)
+  800cd3:	80 3b 00             	cmpb   $0x0,(%ebx)
+  800cd6:	74 06                	je     800cde <virtio_blk_sync+0x1e>
+  800cd8:	80 7b 02 00          	cmpb   $0x0,0x2(%ebx)
+  800cdc:	75 f0                	jne    800cce <virtio_blk_sync+0xe>
+	for (req = vb_reqs; req < vb_reqs + VB_NREQ; req++)
+  800cde:	83 c3 10             	add    $0x10,%ebx
+  800ce1:	81 fb e0 50 81 00    	cmp    $0x8150e0,%ebx
+  800ce7:	75 ea                	jne    800cd3 <virtio_blk_sync+0x13>
+	int r = vb_error;
+  800ce9:	a1 20 50 81 00       	mov    0x815020,%eax
+	vb_error = 0;
+  800cee:	c7 05 20 50 81 00 00 	movl   $0x0,0x815020
+  800cf5:	00 00 00 
+	return vb_status();
+}
+  800cf8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800cfb:	c9                   	leave
+  800cfc:	c3                   	ret
+
+00800cfd <virtio_blk_sync_range>:
+
+// Like virtio_blk_sync, but only wait for the writes that touch sectors
+// [secno, secno+nsecs).
+int
+virtio_blk_sync_range(uint32_t secno, size_t nsecs)
+{
+  800cfd:	55                   	push   %ebp
+  800cfe:	89 e5                	mov    %esp,%ebp
+  800d00:	57                   	push   %edi
+  800d01:	56                   	push   %esi
+  800d02:	53                   	push   %ebx
+  800d03:	83 ec 0c             	sub    $0xc,%esp
+  800d06:	8b 75 08             	mov    0x8(%ebp),%esi
+	struct VbReq *req;
+
+	for (req = vb_reqs; req < vb_reqs + VB_NREQ; req++)
+  800d09:	bb 60 50 81 00       	mov    $0x815060,%ebx
+		while (req->r_busy && req->r_write &&
+		       secno < req->r_secno + req->r_nsecs &&
+		       req->r_secno < secno + nsecs)
+  800d0e:	89 f7                	mov    %esi,%edi
+  800d10:	03 7d 0c             	add    0xc(%ebp),%edi
+  800d13:	eb 05                	jmp    800d1a <virtio_blk_sync_range+0x1d>
+			vb_wait();
+  800d15:	e8 a8 f8 ff ff       	call   8005c2 <vb_wait>
+		       secno < req->r_secno + req->r_nsecs &&
+  800d1a:	80 3b 00             	cmpb   $0x0,(%ebx)
+  800d1d:	74 16                	je     800d35 <virtio_blk_sync_range+0x38>
+		while (req->r_busy && req->r_write &&
+  800d1f:	80 7b 02 00          	cmpb   $0x0,0x2(%ebx)
+  800d23:	74 10                	je     800d35 <virtio_blk_sync_range+0x38>
+		       secno < req->r_secno + req->r_nsecs &&
+  800d25:	8b 43 08             	mov    0x8(%ebx),%eax
+  800d28:	89 c2                	mov    %eax,%edx
+  800d2a:	03 53 0c             	add    0xc(%ebx),%edx
+		while (req->r_busy && req->r_write &&
+  800d2d:	39 d6                	cmp    %edx,%esi
+  800d2f:	73 04                	jae    800d35 <virtio_blk_sync_range+0x38>
+		       secno < req->r_secno + req->r_nsecs &&
+  800d31:	39 f8                	cmp    %edi,%eax
+  800d33:	72 e0                	jb     800d15 <virtio_blk_sync_range+0x18>
+	for (req = vb_reqs; req < vb_reqs + VB_NREQ; req++)
+  800d35:	83 c3 10             	add    $0x10,%ebx
+  800d38:	81 fb e0 50 81 00    	cmp    $0x8150e0,%ebx
+  800d3e:	75 da                	jne    800d1a <virtio_blk_sync_range+0x1d>
+	int r = vb_error;
+  800d40:	a1 20 50 81 00       	mov    0x815020,%eax
+	vb_error = 0;
+  800d45:	c7 05 20 50 81 00 00 	movl   $0x0,0x815020
+  800d4c:	00 00 00 
+	return vb_status();
+}
+  800d4f:	83 c4 0c             	add    $0xc,%esp
+  800d52:	5b                   	pop    %ebx
+  800d53:	5e                   	pop    %esi
+  800d54:	5f                   	pop    %edi
+  800d55:	5d                   	pop    %ebp
+  800d56:	c3                   	ret
+
+00800d57 <disk_init>:
+static bool use_virtio;
+static struct Lock disk_lock;
+
+void
+disk_init(void)
+{
+  800d57:	55                   	push   %ebp
+  800d58:	89 e5                	mov    %esp,%ebp
+  800d5a:	83 ec 08             	sub    $0x8,%esp
+	if (virtio_blk_init() == 0) {
+  800d5d:	e8 3e fc ff ff       	call   8009a0 <virtio_blk_init>
+  800d62:	85 c0                	test   %eax,%eax
+  800d64:	75 09                	jne    800d6f <disk_init+0x18>
+		use_virtio = 1;
+  800d66:	c6 05 e4 50 81 00 01 	movb   $0x1,0x8150e4
+	if (ide_probe_disk1())
+		ide_set_disk(1);
+	else
+		ide_set_disk(0);
+	ide_dma_init();
+}
+  800d6d:	c9                   	leave
+  800d6e:	c3                   	ret
+	if (ide_probe_disk1())
+  800d6f:	e8 e0 f4 ff ff       	call   800254 <ide_probe_disk1>
+  800d74:	84 c0                	test   %al,%al
+  800d76:	74 14                	je     800d8c <disk_init+0x35>
+		ide_set_disk(1);
+  800d78:	83 ec 0c             	sub    $0xc,%esp
+  800d7b:	6a 01                	push   $0x1
+  800d7d:	e8 34 f5 ff ff       	call   8002b6 <ide_set_disk>
+  800d82:	83 c4 10             	add    $0x10,%esp
+	ide_dma_init();
+  800d85:	e8 55 f5 ff ff       	call   8002df <ide_dma_init>
+  800d8a:	eb e1                	jmp    800d6d <disk_init+0x16>
+		ide_set_disk(0);
+  800d8c:	83 ec 0c             	sub    $0xc,%esp
+  800d8f:	6a 00                	push   $0x0
+  800d91:	e8 20 f5 ff ff       	call   8002b6 <ide_set_disk>
+  800d96:	83 c4 10             	add    $0x10,%esp
+  800d99:	eb ea                	jmp    800d85 <disk_init+0x2e>
+
+00800d9b <disk_read>:
+
+// Read 'nsecs' sectors starting at 'secno' into 'dst'.
+// Returns 0 on success, < 0 on error.
+int
+disk_read(uint32_t secno, void *dst, size_t nsecs)
+{
+  800d9b:	55                   	push   %ebp
+  800d9c:	89 e5                	mov    %esp,%ebp
+  800d9e:	53                   	push   %ebx
+  800d9f:	83 ec 10             	sub    $0x10,%esp
+  800da2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	lock_acquire(&disk_lock);
+  800da5:	68 e0 50 81 00       	push   $0x8150e0
+  800daa:	e8 41 01 00 00       	call   800ef0 <lock_acquire>
+	if (use_virtio)
+  800daf:	83 c4 10             	add    $0x10,%esp
+  800db2:	80 3d e4 50 81 00 00 	cmpb   $0x0,0x8150e4
+  800db9:	74 28                	je     800de3 <disk_read+0x48>
+		r = virtio_blk_read(secno, dst, nsecs);
+  800dbb:	83 ec 04             	sub    $0x4,%esp
+  800dbe:	ff 75 10             	push   0x10(%ebp)
+  800dc1:	ff 75 0c             	push   0xc(%ebp)
+  800dc4:	53                   	push   %ebx
+  800dc5:	e8 55 fe ff ff       	call   800c1f <virtio_blk_read>
+  800dca:	89 c3                	mov    %eax,%ebx
+  800dcc:	83 c4 10             	add    $0x10,%esp
+	else
+		r = ide_read(secno, dst, nsecs);
+	lock_release(&disk_lock);
+  800dcf:	83 ec 0c             	sub    $0xc,%esp
+  800dd2:	68 e0 50 81 00       	push   $0x8150e0
+  800dd7:	e8 35 01 00 00       	call   800f11 <lock_release>
+	return r;
+}
+  800ddc:	89 d8                	mov    %ebx,%eax
+  800dde:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800de1:	c9                   	leave
+  800de2:	c3                   	ret
+		r = ide_read(secno, dst, nsecs);
+  800de3:	83 ec 04             	sub    $0x4,%esp
+  800de6:	ff 75 10             	push   0x10(%ebp)
+  800de9:	ff 75 0c             	push   0xc(%ebp)
+  800dec:	53                   	push   %ebx
+  800ded:	e8 2c f6 ff ff       	call   80041e <ide_read>
+  800df2:	89 c3                	mov    %eax,%ebx
+  800df4:	83 c4 10             	add    $0x10,%esp
+  800df7:	eb d6                	jmp    800dcf <disk_read+0x34>
+
+00800df9 <disk_write>:
+// still be in progress when this returns: 'src' must stay mapped and
+// unchanged until disk_sync or a disk_sync_range that covers it.
+// Returns 0 on success, < 0 on error (possibly an earlier write's).
+int
+disk_write(uint32_t secno, const void *src, size_t nsecs)
+{
+  800df9:	55                   	push   %ebp
+  800dfa:	89 e5                	mov    %esp,%ebp
+  800dfc:	53                   	push   %ebx
+  800dfd:	83 ec 10             	sub    $0x10,%esp
+  800e00:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	lock_acquire(&disk_lock);
+  800e03:	68 e0 50 81 00       	push   $0x8150e0
+  800e08:	e8 e3 00 00 00       	call   800ef0 <lock_acquire>
+	if (use_virtio)
+  800e0d:	83 c4 10             	add    $0x10,%esp
+  800e10:	80 3d e4 50 81 00 00 	cmpb   $0x0,0x8150e4
+  800e17:	74 28                	je     800e41 <disk_write+0x48>
+		r = virtio_blk_write(secno, src, nsecs);
+  800e19:	83 ec 04             	sub    $0x4,%esp
+  800e1c:	ff 75 10             	push   0x10(%ebp)
+  800e1f:	ff 75 0c             	push   0xc(%ebp)
+  800e22:	53                   	push   %ebx
+  800e23:	e8 6a fe ff ff       	call   800c92 <virtio_blk_write>
+  800e28:	89 c3                	mov    %eax,%ebx
+  800e2a:	83 c4 10             	add    $0x10,%esp
+	else
+		r = ide_write(secno, src, nsecs);
+	lock_release(&disk_lock);
+  800e2d:	83 ec 0c             	sub    $0xc,%esp
+  800e30:	68 e0 50 81 00       	push   $0x8150e0
+  800e35:	e8 d7 00 00 00       	call   800f11 <lock_release>
+	return r;
+}
+  800e3a:	89 d8                	mov    %ebx,%eax
+  800e3c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e3f:	c9                   	leave
+  800e40:	c3                   	ret
+		r = ide_write(secno, src, nsecs);
+  800e41:	83 ec 04             	sub    $0x4,%esp
+  800e44:	ff 75 10             	push   0x10(%ebp)
+  800e47:	ff 75 0c             	push   0xc(%ebp)
+  800e4a:	53                   	push   %ebx
+  800e4b:	e8 91 f6 ff ff       	call   8004e1 <ide_write>
+  800e50:	89 c3                	mov    %eax,%ebx
+  800e52:	83 c4 10             	add    $0x10,%esp
+  800e55:	eb d6                	jmp    800e2d <disk_write+0x34>
+
+00800e57 <disk_sync>:
+
+// Wait for every write in progress to finish.
+int
+disk_sync(void)
+{
+  800e57:	55                   	push   %ebp
+  800e58:	89 e5                	mov    %esp,%ebp
+  800e5a:	53                   	push   %ebx
+  800e5b:	83 ec 10             	sub    $0x10,%esp
+	int r;
+
+	lock_acquire(&disk_lock);
+  800e5e:	68 e0 50 81 00       	push   $0x8150e0
+  800e63:	e8 88 00 00 00       	call   800ef0 <lock_acquire>
+	if (use_virtio)
+  800e68:	83 c4 10             	add    $0x10,%esp
+  800e6b:	80 3d e4 50 81 00 00 	cmpb   $0x0,0x8150e4
+  800e72:	74 1b                	je     800e8f <disk_sync+0x38>
+		r = virtio_blk_sync();
+  800e74:	e8 47 fe ff ff       	call   800cc0 <virtio_blk_sync>
+  800e79:	89 c3                	mov    %eax,%ebx
+	else
+		r = ide_sync();
+	lock_release(&disk_lock);
+  800e7b:	83 ec 0c             	sub    $0xc,%esp
+  800e7e:	68 e0 50 81 00       	push   $0x8150e0
+  800e83:	e8 89 00 00 00       	call   800f11 <lock_release>
+	return r;
+}
+  800e88:	89 d8                	mov    %ebx,%eax
+  800e8a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e8d:	c9                   	leave
+  800e8e:	c3                   	ret
+		r = ide_sync();
+  800e8f:	e8 40 f5 ff ff       	call   8003d4 <ide_sync>
+  800e94:	89 c3                	mov    %eax,%ebx
+  800e96:	eb e3                	jmp    800e7b <disk_sync+0x24>
+
+00800e98 <disk_sync_range>:
+
+// Wait for the writes in progress to sectors [secno, secno+nsecs).
+int
+disk_sync_range(uint32_t secno, size_t nsecs)
+{
+  800e98:	55                   	push   %ebp
+  800e99:	89 e5                	mov    %esp,%ebp
+  800e9b:	53                   	push   %ebx
+  800e9c:	83 ec 10             	sub    $0x10,%esp
+  800e9f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	int r;
+
+	lock_acquire(&disk_lock);
+  800ea2:	68 e0 50 81 00       	push   $0x8150e0
+  800ea7:	e8 44 00 00 00       	call   800ef0 <lock_acquire>
+	if (use_virtio)
+  800eac:	83 c4 10             	add    $0x10,%esp
+  800eaf:	80 3d e4 50 81 00 00 	cmpb   $0x0,0x8150e4
+  800eb6:	74 25                	je     800edd <disk_sync_range+0x45>
+		r = virtio_blk_sync_range(secno, nsecs);
+  800eb8:	83 ec 08             	sub    $0x8,%esp
+  800ebb:	ff 75 0c             	push   0xc(%ebp)
+  800ebe:	53                   	push   %ebx
+  800ebf:	e8 39 fe ff ff       	call   800cfd <virtio_blk_sync_range>
+  800ec4:	89 c3                	mov    %eax,%ebx
+  800ec6:	83 c4 10             	add    $0x10,%esp
+	else
+		r = ide_sync_range(secno, nsecs);
+	lock_release(&disk_lock);
+  800ec9:	83 ec 0c             	sub    $0xc,%esp
+  800ecc:	68 e0 50 81 00       	push   $0x8150e0
+  800ed1:	e8 3b 00 00 00       	call   800f11 <lock_release>
+	return r;
+}
+  800ed6:	89 d8                	mov    %ebx,%eax
+  800ed8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800edb:	c9                   	leave
+  800edc:	c3                   	ret
+		r = ide_sync_range(secno, nsecs);
+  800edd:	83 ec 08             	sub    $0x8,%esp
+  800ee0:	ff 75 0c             	push   0xc(%ebp)
+  800ee3:	53                   	push   %ebx
+  800ee4:	e8 f8 f4 ff ff       	call   8003e1 <ide_sync_range>
+  800ee9:	89 c3                	mov    %eax,%ebx
+  800eeb:	83 c4 10             	add    $0x10,%esp
+  800eee:	eb d9                	jmp    800ec9 <disk_sync_range+0x31>
+
+00800ef0 <lock_acquire>:
+static bool fs_exclusive;	// a request in progress, or waiting for
+				// the others to finish, runs alone
+
+void
+lock_acquire(struct Lock *l)
+{
+  800ef0:	55                   	push   %ebp
+  800ef1:	89 e5                	mov    %esp,%ebp
+  800ef3:	56                   	push   %esi
+  800ef4:	53                   	push   %ebx
+  800ef5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  800ef8:	be 01 00 00 00       	mov    $0x1,%esi
+	while (xchg(&l->l_locked, 1) != 0)
+  800efd:	eb 05                	jmp    800f04 <lock_acquire+0x14>
+		sys_yield();
+  800eff:	e8 62 66 00 00       	call   807566 <sys_yield>
+  800f04:	89 f0                	mov    %esi,%eax
+  800f06:	f0 87 03             	lock xchg %eax,(%ebx)
+	while (xchg(&l->l_locked, 1) != 0)
+  800f09:	85 c0                	test   %eax,%eax
+  800f0b:	75 f2                	jne    800eff <lock_acquire+0xf>
+}
+  800f0d:	5b                   	pop    %ebx
+  800f0e:	5e                   	pop    %esi
+  800f0f:	5d                   	pop    %ebp
+  800f10:	c3                   	ret
+
+00800f11 <lock_release>:
+
+void
+lock_release(struct Lock *l)
+{
+  800f11:	55                   	push   %ebp
+  800f12:	89 e5                	mov    %esp,%ebp
+  800f14:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f17:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f1c:	f0 87 02             	lock xchg %eax,(%edx)
+	xchg(&l->l_locked, 0);
+}
+  800f1f:	5d                   	pop    %ebp
+  800f20:	c3                   	ret
+
+00800f21 <fs_lock>:
+// Take fs_lock.  Another worker may have unmapped or protected cache
+// pages while this one didn't hold it, so it must have entered the
+// kernel since it last let go, which drops stale TLB entries.
+void
+fs_lock(void)
+{
+  800f21:	55                   	push   %ebp
+  800f22:	89 e5                	mov    %esp,%ebp
+  800f24:	83 ec 14             	sub    $0x14,%esp
+	lock_acquire(&fs_biglock);
+  800f27:	68 f0 50 81 00       	push   $0x8150f0
+  800f2c:	e8 bf ff ff ff       	call   800ef0 <lock_acquire>
+}
+  800f31:	83 c4 10             	add    $0x10,%esp
+  800f34:	c9                   	leave
+  800f35:	c3                   	ret
+
+00800f36 <fs_unlock>:
+  800f36:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f3b:	f0 87 05 f0 50 81 00 	lock xchg %eax,0x8150f0
+
+void
+fs_unlock(void)
+{
+	lock_release(&fs_biglock);
+}
+  800f42:	c3                   	ret
+
+00800f43 <fs_yield>:
+
+// Let the other workers run for a while.
+void
+fs_yield(void)
+{
+  800f43:	55                   	push   %ebp
+  800f44:	89 e5                	mov    %esp,%ebp
+  800f46:	83 ec 08             	sub    $0x8,%esp
+	fs_unlock();
+  800f49:	e8 e8 ff ff ff       	call   800f36 <fs_unlock>
+	sys_yield();
+  800f4e:	e8 13 66 00 00       	call   807566 <sys_yield>
+	fs_lock();
+  800f53:	e8 c9 ff ff ff       	call   800f21 <fs_lock>
+}
+  800f58:	c9                   	leave
+  800f59:	c3                   	ret
+
+00800f5a <fs_begin>:
+// Start serving a request that changes the file system if 'exclusive',
+// or only reads it if not.  A changing request waits for those in
+// progress to finish and keeps new ones out until fs_end.
+void
+fs_begin(bool exclusive)
+{
+  800f5a:	55                   	push   %ebp
+  800f5b:	89 e5                	mov    %esp,%ebp
+  800f5d:	53                   	push   %ebx
+  800f5e:	83 ec 04             	sub    $0x4,%esp
+  800f61:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	while (fs_exclusive)
+  800f64:	eb 05                	jmp    800f6b <fs_begin+0x11>
+		fs_yield();
+  800f66:	e8 d8 ff ff ff       	call   800f43 <fs_yield>
+	while (fs_exclusive)
+  800f6b:	80 3d e8 50 81 00 00 	cmpb   $0x0,0x8150e8
+  800f72:	75 f2                	jne    800f66 <fs_begin+0xc>
+	if (!exclusive) {
+  800f74:	84 db                	test   %bl,%bl
+  800f76:	74 09                	je     800f81 <fs_begin+0x27>
+		fs_nshared++;
+		return;
+	}
+	fs_exclusive = 1;
+  800f78:	c6 05 e8 50 81 00 01 	movb   $0x1,0x8150e8
+	while (fs_nshared > 0)
+  800f7f:	eb 0e                	jmp    800f8f <fs_begin+0x35>
+		fs_nshared++;
+  800f81:	83 05 ec 50 81 00 01 	addl   $0x1,0x8150ec
+		return;
+  800f88:	eb 0e                	jmp    800f98 <fs_begin+0x3e>
+		fs_yield();
+  800f8a:	e8 b4 ff ff ff       	call   800f43 <fs_yield>
+	while (fs_nshared > 0)
+  800f8f:	83 3d ec 50 81 00 00 	cmpl   $0x0,0x8150ec
+  800f96:	75 f2                	jne    800f8a <fs_begin+0x30>
+}
+  800f98:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800f9b:	c9                   	leave
+  800f9c:	c3                   	ret
+
+00800f9d <fs_shared>:
+// allocate it; such a request gives up with -E_AGAIN and runs again
+// alone (serve).
+bool
+fs_shared(void)
+{
+	return fs_nshared > 0;
+  800f9d:	83 3d ec 50 81 00 00 	cmpl   $0x0,0x8150ec
+  800fa4:	0f 95 c0             	setne  %al
+}
+  800fa7:	c3                   	ret
+
+00800fa8 <fs_end>:
+
+void
+fs_end(bool exclusive)
+{
+  800fa8:	55                   	push   %ebp
+  800fa9:	89 e5                	mov    %esp,%ebp
+	if (exclusive)
+  800fab:	80 7d 08 00          	cmpb   $0x0,0x8(%ebp)
+  800faf:	74 09                	je     800fba <fs_end+0x12>
+		fs_exclusive = 0;
+  800fb1:	c6 05 e8 50 81 00 00 	movb   $0x0,0x8150e8
+	else
+		fs_nshared--;
+}
+  800fb8:	5d                   	pop    %ebp
+  800fb9:	c3                   	ret
+		fs_nshared--;
+  800fba:	83 2d ec 50 81 00 01 	subl   $0x1,0x8150ec
+}
+  800fc1:	eb f5                	jmp    800fb8 <fs_end+0x10>
+
+00800fc3 <bio_find>:
+}
+
+// The queued request covering 'blockno', or NULL.
+static struct Bio *
+bio_find(uint32_t blockno)
+{
+  800fc3:	89 c1                	mov    %eax,%ecx
+	struct Bio *b;
+
+	for (b = bio_queue; b < bio_queue + BIO_MAXREQ; b++)
+  800fc5:	b8 40 58 81 00       	mov    $0x815840,%eax
+  800fca:	eb 0a                	jmp    800fd6 <bio_find+0x13>
+  800fcc:	83 c0 10             	add    $0x10,%eax
+  800fcf:	3d 40 5c 81 00       	cmp    $0x815c40,%eax
+  800fd4:	74 15                	je     800feb <bio_find+0x28>
+		if (b->b_busy && blockno >= b->b_blockno &&
+  800fd6:	80 38 00             	cmpb   $0x0,(%eax)
+  800fd9:	74 f1                	je     800fcc <bio_find+0x9>
+  800fdb:	8b 50 04             	mov    0x4(%eax),%edx
+  800fde:	39 d1                	cmp    %edx,%ecx
+  800fe0:	72 ea                	jb     800fcc <bio_find+0x9>
+		    blockno < b->b_blockno + b->b_nblocks)
+  800fe2:	03 50 08             	add    0x8(%eax),%edx
+		if (b->b_busy && blockno >= b->b_blockno &&
+  800fe5:	39 d1                	cmp    %edx,%ecx
+  800fe7:	73 e3                	jae    800fcc <bio_find+0x9>
+  800fe9:	eb 05                	jmp    800ff0 <bio_find+0x2d>
+			return b;
+	return NULL;
+  800feb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ff0:	c3                   	ret
+
+00800ff1 <bio_next>:
+// Pick the request to run next: with C-LOOK, the lowest one at or past
+// the head, else the lowest one; with FIFO, the oldest.  Requests
+// already running don't count.  Returns NULL if there are none.
+static struct Bio *
+bio_next(void)
+{
+  800ff1:	55                   	push   %ebp
+  800ff2:	89 e5                	mov    %esp,%ebp
+  800ff4:	57                   	push   %edi
+  800ff5:	56                   	push   %esi
+  800ff6:	53                   	push   %ebx
+
+	best = lowest = NULL;
+	for (b = bio_queue; b < bio_queue + BIO_MAXREQ; b++) {
+		if (!b->b_busy || b->b_running)
+			continue;
+		if (bio_sched == BIO_SCHED_FIFO) {
+  800ff7:	8b 35 04 b0 80 00    	mov    0x80b004,%esi
+				best = b;
+			continue;
+		}
+		if (!lowest || b->b_blockno < lowest->b_blockno)
+			lowest = b;
+		if (b->b_blockno >= bio_head &&
+  800ffd:	8b 3d 1c 58 81 00    	mov    0x81581c,%edi
+	best = lowest = NULL;
+  801003:	ba 00 00 00 00       	mov    $0x0,%edx
+  801008:	b9 00 00 00 00       	mov    $0x0,%ecx
+	for (b = bio_queue; b < bio_queue + BIO_MAXREQ; b++) {
+  80100d:	b8 40 58 81 00       	mov    $0x815840,%eax
+  801012:	eb 17                	jmp    80102b <bio_next+0x3a>
+			if (!best || b->b_seq < best->b_seq)
+  801014:	85 c9                	test   %ecx,%ecx
+  801016:	74 47                	je     80105f <bio_next+0x6e>
+  801018:	8b 59 0c             	mov    0xc(%ecx),%ebx
+  80101b:	39 58 0c             	cmp    %ebx,0xc(%eax)
+  80101e:	0f 42 c8             	cmovb  %eax,%ecx
+	for (b = bio_queue; b < bio_queue + BIO_MAXREQ; b++) {
+  801021:	83 c0 10             	add    $0x10,%eax
+  801024:	3d 40 5c 81 00       	cmp    $0x815c40,%eax
+  801029:	74 3c                	je     801067 <bio_next+0x76>
+		if (!b->b_busy || b->b_running)
+  80102b:	80 38 00             	cmpb   $0x0,(%eax)
+  80102e:	74 f1                	je     801021 <bio_next+0x30>
+  801030:	80 78 02 00          	cmpb   $0x0,0x2(%eax)
+  801034:	75 eb                	jne    801021 <bio_next+0x30>
+		if (bio_sched == BIO_SCHED_FIFO) {
+  801036:	83 fe 02             	cmp    $0x2,%esi
+  801039:	74 d9                	je     801014 <bio_next+0x23>
+		if (!lowest || b->b_blockno < lowest->b_blockno)
+  80103b:	85 d2                	test   %edx,%edx
+  80103d:	74 1c                	je     80105b <bio_next+0x6a>
+  80103f:	8b 5a 04             	mov    0x4(%edx),%ebx
+  801042:	39 58 04             	cmp    %ebx,0x4(%eax)
+  801045:	0f 42 d0             	cmovb  %eax,%edx
+		if (b->b_blockno >= bio_head &&
+  801048:	8b 58 04             	mov    0x4(%eax),%ebx
+  80104b:	39 fb                	cmp    %edi,%ebx
+  80104d:	72 d2                	jb     801021 <bio_next+0x30>
+  80104f:	85 c9                	test   %ecx,%ecx
+  801051:	74 10                	je     801063 <bio_next+0x72>
+  801053:	3b 59 04             	cmp    0x4(%ecx),%ebx
+  801056:	0f 42 c8             	cmovb  %eax,%ecx
+  801059:	eb c6                	jmp    801021 <bio_next+0x30>
+  80105b:	89 c2                	mov    %eax,%edx
+  80105d:	eb e9                	jmp    801048 <bio_next+0x57>
+  80105f:	89 c1                	mov    %eax,%ecx
+  801061:	eb be                	jmp    801021 <bio_next+0x30>
+  801063:	89 c1                	mov    %eax,%ecx
+  801065:	eb ba                	jmp    801021 <bio_next+0x30>
+		    (!best || b->b_blockno < best->b_blockno))
+			best = b;
+	}
+	return best ? best : lowest;
+  801067:	85 c9                	test   %ecx,%ecx
+  801069:	0f 44 ca             	cmove  %edx,%ecx
+}
+  80106c:	89 c8                	mov    %ecx,%eax
+  80106e:	5b                   	pop    %ebx
+  80106f:	5e                   	pop    %esi
+  801070:	5f                   	pop    %edi
+  801071:	5d                   	pop    %ebp
+  801072:	c3                   	ret
+
+00801073 <bio_dispatch>:
+// may still be in progress in the driver when this returns; reads are
+// done and mapped read-only at their disk addresses.  A read lets other
+// workers run meanwhile.
+static void
+bio_dispatch(struct Bio *b)
+{
+  801073:	55                   	push   %ebp
+  801074:	89 e5                	mov    %esp,%ebp
+  801076:	57                   	push   %edi
+  801077:	56                   	push   %esi
+  801078:	53                   	push   %ebx
+  801079:	83 ec 1c             	sub    $0x1c,%esp
+  80107c:	89 c7                	mov    %eax,%edi
+	uint32_t i, blockno, n;
+	int r;
+
+	blockno = b->b_blockno;
+  80107e:	8b 58 04             	mov    0x4(%eax),%ebx
+	n = b->b_nblocks;
+  801081:	8b 70 08             	mov    0x8(%eax),%esi
+
+	bio_seek += blockno > bio_head ? blockno - bio_head : bio_head - blockno;
+  801084:	8b 15 1c 58 81 00    	mov    0x81581c,%edx
+  80108a:	89 d9                	mov    %ebx,%ecx
+  80108c:	29 d1                	sub    %edx,%ecx
+  80108e:	89 d0                	mov    %edx,%eax
+  801090:	29 d8                	sub    %ebx,%eax
+  801092:	39 da                	cmp    %ebx,%edx
+  801094:	0f 42 c1             	cmovb  %ecx,%eax
+  801097:	01 05 0c 58 81 00    	add    %eax,0x81580c
+	bio_head = blockno + n;
+  80109d:	8d 04 33             	lea    (%ebx,%esi,1),%eax
+  8010a0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8010a3:	a3 1c 58 81 00       	mov    %eax,0x81581c
+
+	if (b->b_write) {
+  8010a8:	80 7f 01 00          	cmpb   $0x0,0x1(%edi)
+  8010ac:	74 56                	je     801104 <bio_dispatch+0x91>
+		b->b_busy = 0;
+  8010ae:	c6 07 00             	movb   $0x0,(%edi)
+		bio_nqueued--;
+  8010b1:	83 2d 24 58 81 00 01 	subl   $0x1,0x815824
+		if ((r = disk_write(blockno * BLKSECTS, diskaddr(blockno),
+  8010b8:	83 ec 0c             	sub    $0xc,%esp
+  8010bb:	53                   	push   %ebx
+  8010bc:	e8 d3 07 00 00       	call   801894 <diskaddr>
+  8010c1:	83 c4 0c             	add    $0xc,%esp
+  8010c4:	8d 14 f5 00 00 00 00 	lea    0x0(,%esi,8),%edx
+  8010cb:	52                   	push   %edx
+  8010cc:	50                   	push   %eax
+  8010cd:	c1 e3 03             	shl    $0x3,%ebx
+  8010d0:	53                   	push   %ebx
+  8010d1:	e8 23 fd ff ff       	call   800df9 <disk_write>
+  8010d6:	83 c4 10             	add    $0x10,%esp
+  8010d9:	85 c0                	test   %eax,%eax
+  8010db:	78 15                	js     8010f2 <bio_dispatch+0x7f>
+				    n * BLKSECTS)) < 0)
+			panic("bio_dispatch: %e", r);
+		bio_writes++;
+  8010dd:	83 05 08 58 81 00 01 	addl   $0x1,0x815808
+		bio_written += n;
+  8010e4:	01 35 04 58 81 00    	add    %esi,0x815804
+		panic("bio_dispatch: %e", r);
+
+	for (i = 0; i < n; i++)
+		if (bitmap && block_is_free(blockno + i))
+			panic("reading free block %08x\n", blockno + i);
+}
+  8010ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010ed:	5b                   	pop    %ebx
+  8010ee:	5e                   	pop    %esi
+  8010ef:	5f                   	pop    %edi
+  8010f0:	5d                   	pop    %ebp
+  8010f1:	c3                   	ret
+			panic("bio_dispatch: %e", r);
+  8010f2:	50                   	push   %eax
+  8010f3:	68 8e 9a 80 00       	push   $0x809a8e
+  8010f8:	6a 74                	push   $0x74
+  8010fa:	68 9f 9a 80 00       	push   $0x809a9f
+  8010ff:	e8 cc 59 00 00       	call   806ad0 <_panic>
+	b->b_running = 1;
+  801104:	c6 47 02 01          	movb   $0x1,0x2(%edi)
+	fs_unlock();
+  801108:	e8 29 fe ff ff       	call   800f36 <fs_unlock>
+	r = disk_read(blockno * BLKSECTS, bio_stageva(blockno), n * BLKSECTS);
+  80110d:	83 ec 04             	sub    $0x4,%esp
+  801110:	c1 e6 03             	shl    $0x3,%esi
+  801113:	56                   	push   %esi
+	return (void *) (BIO_STAGEVA + (blockno % BIO_STAGEPAGES) * PGSIZE);
+  801114:	89 d8                	mov    %ebx,%eax
+  801116:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80111b:	05 00 e0 00 00       	add    $0xe000,%eax
+  801120:	c1 e0 0c             	shl    $0xc,%eax
+	r = disk_read(blockno * BLKSECTS, bio_stageva(blockno), n * BLKSECTS);
+  801123:	50                   	push   %eax
+  801124:	8d 04 dd 00 00 00 00 	lea    0x0(,%ebx,8),%eax
+  80112b:	50                   	push   %eax
+  80112c:	e8 6a fc ff ff       	call   800d9b <disk_read>
+  801131:	89 c6                	mov    %eax,%esi
+	sys_yield();
+  801133:	e8 2e 64 00 00       	call   807566 <sys_yield>
+	fs_lock();
+  801138:	e8 e4 fd ff ff       	call   800f21 <fs_lock>
+	b->b_running = 0;
+  80113d:	c6 47 02 00          	movb   $0x0,0x2(%edi)
+	b->b_busy = 0;
+  801141:	c6 07 00             	movb   $0x0,(%edi)
+	bio_nqueued--;
+  801144:	83 2d 24 58 81 00 01 	subl   $0x1,0x815824
+	if (r < 0)
+  80114b:	83 c4 10             	add    $0x10,%esp
+  80114e:	85 f6                	test   %esi,%esi
+  801150:	78 0b                	js     80115d <bio_dispatch+0xea>
+	bio_reads++;
+  801152:	83 05 10 58 81 00 01 	addl   $0x1,0x815810
+	for (i = 0; i < n; i++) {
+  801159:	89 de                	mov    %ebx,%esi
+  80115b:	eb 64                	jmp    8011c1 <bio_dispatch+0x14e>
+		panic("bio_dispatch: %e", r);
+  80115d:	56                   	push   %esi
+  80115e:	68 8e 9a 80 00       	push   $0x809a8e
+  801163:	68 85 00 00 00       	push   $0x85
+  801168:	68 9f 9a 80 00       	push   $0x809a9f
+  80116d:	e8 5e 59 00 00       	call   806ad0 <_panic>
+			     (uint32_t) diskaddr(blockno + i), PTE_P | PTE_U);
+  801172:	83 ec 0c             	sub    $0xc,%esp
+  801175:	56                   	push   %esi
+  801176:	e8 19 07 00 00       	call   801894 <diskaddr>
+	return (void *) (BIO_STAGEVA + (blockno % BIO_STAGEPAGES) * PGSIZE);
+  80117b:	89 f7                	mov    %esi,%edi
+  80117d:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  801183:	81 c7 00 e0 00 00    	add    $0xe000,%edi
+  801189:	c1 e7 0c             	shl    $0xc,%edi
+		sysbatch_add(&bio_batch, SYS_page_map, 0,
+  80118c:	83 c4 0c             	add    $0xc,%esp
+  80118f:	6a 05                	push   $0x5
+  801191:	50                   	push   %eax
+  801192:	6a 00                	push   $0x0
+  801194:	57                   	push   %edi
+  801195:	6a 00                	push   $0x0
+  801197:	6a 05                	push   $0x5
+  801199:	68 00 51 81 00       	push   $0x815100
+  80119e:	e8 78 68 00 00       	call   807a1b <sysbatch_add>
+		sysbatch_add(&bio_batch, SYS_page_unmap, 0,
+  8011a3:	83 c4 1c             	add    $0x1c,%esp
+  8011a6:	6a 00                	push   $0x0
+  8011a8:	6a 00                	push   $0x0
+  8011aa:	6a 00                	push   $0x0
+  8011ac:	57                   	push   %edi
+  8011ad:	6a 00                	push   $0x0
+  8011af:	6a 06                	push   $0x6
+  8011b1:	68 00 51 81 00       	push   $0x815100
+  8011b6:	e8 60 68 00 00       	call   807a1b <sysbatch_add>
+	for (i = 0; i < n; i++) {
+  8011bb:	83 c6 01             	add    $0x1,%esi
+  8011be:	83 c4 20             	add    $0x20,%esp
+  8011c1:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8011c4:	75 ac                	jne    801172 <bio_dispatch+0xff>
+	if ((r = sysbatch_flush(&bio_batch)) < 0)
+  8011c6:	83 ec 0c             	sub    $0xc,%esp
+  8011c9:	68 00 51 81 00       	push   $0x815100
+  8011ce:	e8 f8 67 00 00       	call   8079cb <sysbatch_flush>
+  8011d3:	83 c4 10             	add    $0x10,%esp
+  8011d6:	85 c0                	test   %eax,%eax
+  8011d8:	79 18                	jns    8011f2 <bio_dispatch+0x17f>
+		panic("bio_dispatch: %e", r);
+  8011da:	50                   	push   %eax
+  8011db:	68 8e 9a 80 00       	push   $0x809a8e
+  8011e0:	68 91 00 00 00       	push   $0x91
+  8011e5:	68 9f 9a 80 00       	push   $0x809a9f
+  8011ea:	e8 e1 58 00 00       	call   806ad0 <_panic>
+	for (i = 0; i < n; i++)
+  8011ef:	83 c3 01             	add    $0x1,%ebx
+  8011f2:	39 de                	cmp    %ebx,%esi
+  8011f4:	0f 84 f0 fe ff ff    	je     8010ea <bio_dispatch+0x77>
+		if (bitmap && block_is_free(blockno + i))
+  8011fa:	83 3d 84 3f 84 00 00 	cmpl   $0x0,0x843f84
+  801201:	74 ec                	je     8011ef <bio_dispatch+0x17c>
+  801203:	83 ec 0c             	sub    $0xc,%esp
+  801206:	53                   	push   %ebx
+  801207:	e8 23 1f 00 00       	call   80312f <block_is_free>
+  80120c:	83 c4 10             	add    $0x10,%esp
+  80120f:	84 c0                	test   %al,%al
+  801211:	74 dc                	je     8011ef <bio_dispatch+0x17c>
+			panic("reading free block %08x\n", blockno + i);
+  801213:	53                   	push   %ebx
+  801214:	68 a8 9a 80 00       	push   $0x809aa8
+  801219:	68 95 00 00 00       	push   $0x95
+  80121e:	68 9f 9a 80 00       	push   $0x809a9f
+  801223:	e8 a8 58 00 00       	call   806ad0 <_panic>
+
+00801228 <bio_pending>:
+}
+
+// Is a read or write of 'blockno' queued?
+bool
+bio_pending(uint32_t blockno)
+{
+  801228:	55                   	push   %ebp
+  801229:	89 e5                	mov    %esp,%ebp
+  80122b:	83 ec 08             	sub    $0x8,%esp
+	return bio_find(blockno) != NULL;
+  80122e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801231:	e8 8d fd ff ff       	call   800fc3 <bio_find>
+  801236:	85 c0                	test   %eax,%eax
+  801238:	0f 95 c0             	setne  %al
+}
+  80123b:	c9                   	leave
+  80123c:	c3                   	ret
+
+0080123d <bio_cancel>:
+// Take 'blockno' out of a queued write, because it is about to change
+// again and will be written later anyway.  Returns whether it was
+// taken out.
+bool
+bio_cancel(uint32_t blockno)
+{
+  80123d:	55                   	push   %ebp
+  80123e:	89 e5                	mov    %esp,%ebp
+  801240:	57                   	push   %edi
+  801241:	56                   	push   %esi
+  801242:	53                   	push   %ebx
+  801243:	83 ec 1c             	sub    $0x1c,%esp
+  801246:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	struct Bio *b, *nb;
+	uint32_t end;
+
+	if (!(b = bio_find(blockno)) || !b->b_write || b->b_running)
+  801249:	89 d8                	mov    %ebx,%eax
+  80124b:	e8 73 fd ff ff       	call   800fc3 <bio_find>
+  801250:	85 c0                	test   %eax,%eax
+  801252:	0f 84 aa 00 00 00    	je     801302 <bio_cancel+0xc5>
+  801258:	0f b6 50 01          	movzbl 0x1(%eax),%edx
+  80125c:	84 d2                	test   %dl,%dl
+  80125e:	0f 84 aa 00 00 00    	je     80130e <bio_cancel+0xd1>
+  801264:	0f b6 70 02          	movzbl 0x2(%eax),%esi
+  801268:	89 f1                	mov    %esi,%ecx
+  80126a:	84 c9                	test   %cl,%cl
+  80126c:	0f 85 97 00 00 00    	jne    801309 <bio_cancel+0xcc>
+		return 0;
+
+	end = b->b_blockno + b->b_nblocks;
+  801272:	8b 78 04             	mov    0x4(%eax),%edi
+  801275:	8b 48 08             	mov    0x8(%eax),%ecx
+	if (blockno == b->b_blockno) {
+  801278:	39 df                	cmp    %ebx,%edi
+  80127a:	74 20                	je     80129c <bio_cancel+0x5f>
+	end = b->b_blockno + b->b_nblocks;
+  80127c:	01 cf                	add    %ecx,%edi
+  80127e:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+		b->b_blockno++;
+		b->b_nblocks--;
+	} else if (blockno == end - 1) {
+  801281:	83 ef 01             	sub    $0x1,%edi
+  801284:	39 df                	cmp    %ebx,%edi
+  801286:	74 22                	je     8012aa <bio_cancel+0x6d>
+		b->b_nblocks--;
+	} else {
+		// In the middle: split the request in two, if there's room.
+		if (bio_nqueued == BIO_MAXREQ)
+  801288:	8b 3d 24 58 81 00    	mov    0x815824,%edi
+			return 0;
+		for (nb = bio_queue; nb->b_busy; nb++)
+  80128e:	b9 40 58 81 00       	mov    $0x815840,%ecx
+		if (bio_nqueued == BIO_MAXREQ)
+  801293:	83 ff 40             	cmp    $0x40,%edi
+  801296:	75 1d                	jne    8012b5 <bio_cancel+0x78>
+			return 0;
+  801298:	89 f2                	mov    %esi,%edx
+  80129a:	eb 72                	jmp    80130e <bio_cancel+0xd1>
+		b->b_blockno++;
+  80129c:	83 c3 01             	add    $0x1,%ebx
+  80129f:	89 58 04             	mov    %ebx,0x4(%eax)
+		b->b_nblocks--;
+  8012a2:	83 e9 01             	sub    $0x1,%ecx
+  8012a5:	89 48 08             	mov    %ecx,0x8(%eax)
+  8012a8:	eb 46                	jmp    8012f0 <bio_cancel+0xb3>
+		b->b_nblocks--;
+  8012aa:	83 e9 01             	sub    $0x1,%ecx
+  8012ad:	89 48 08             	mov    %ecx,0x8(%eax)
+  8012b0:	eb 3e                	jmp    8012f0 <bio_cancel+0xb3>
+		for (nb = bio_queue; nb->b_busy; nb++)
+  8012b2:	83 c1 10             	add    $0x10,%ecx
+  8012b5:	80 39 00             	cmpb   $0x0,(%ecx)
+  8012b8:	75 f8                	jne    8012b2 <bio_cancel+0x75>
+			;
+		*nb = *b;
+  8012ba:	8b 30                	mov    (%eax),%esi
+  8012bc:	89 31                	mov    %esi,(%ecx)
+  8012be:	8b 70 04             	mov    0x4(%eax),%esi
+  8012c1:	89 71 04             	mov    %esi,0x4(%ecx)
+  8012c4:	8b 70 08             	mov    0x8(%eax),%esi
+  8012c7:	89 71 08             	mov    %esi,0x8(%ecx)
+  8012ca:	8b 70 0c             	mov    0xc(%eax),%esi
+  8012cd:	89 71 0c             	mov    %esi,0xc(%ecx)
+		nb->b_blockno = blockno + 1;
+  8012d0:	8d 73 01             	lea    0x1(%ebx),%esi
+  8012d3:	89 71 04             	mov    %esi,0x4(%ecx)
+		nb->b_nblocks = end - (blockno + 1);
+  8012d6:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  8012d9:	29 de                	sub    %ebx,%esi
+  8012db:	83 ee 01             	sub    $0x1,%esi
+  8012de:	89 71 08             	mov    %esi,0x8(%ecx)
+		b->b_nblocks = blockno - b->b_blockno;
+  8012e1:	2b 58 04             	sub    0x4(%eax),%ebx
+  8012e4:	89 58 08             	mov    %ebx,0x8(%eax)
+		bio_nqueued++;
+  8012e7:	83 c7 01             	add    $0x1,%edi
+  8012ea:	89 3d 24 58 81 00    	mov    %edi,0x815824
+	}
+	if (b->b_nblocks == 0) {
+  8012f0:	83 78 08 00          	cmpl   $0x0,0x8(%eax)
+  8012f4:	75 18                	jne    80130e <bio_cancel+0xd1>
+		b->b_busy = 0;
+  8012f6:	c6 00 00             	movb   $0x0,(%eax)
+		bio_nqueued--;
+  8012f9:	83 2d 24 58 81 00 01 	subl   $0x1,0x815824
+  801300:	eb 0c                	jmp    80130e <bio_cancel+0xd1>
+		return 0;
+  801302:	ba 00 00 00 00       	mov    $0x0,%edx
+  801307:	eb 05                	jmp    80130e <bio_cancel+0xd1>
+  801309:	ba 00 00 00 00       	mov    $0x0,%edx
+	}
+	return 1;
+}
+  80130e:	89 d0                	mov    %edx,%eax
+  801310:	83 c4 1c             	add    $0x1c,%esp
+  801313:	5b                   	pop    %ebx
+  801314:	5e                   	pop    %esi
+  801315:	5f                   	pop    %edi
+  801316:	5d                   	pop    %ebp
+  801317:	c3                   	ret
+
+00801318 <bio_step>:
+
+// Run the next queued request, or if the others are all being read by
+// other workers, let those get on.
+void
+bio_step(void)
+{
+  801318:	55                   	push   %ebp
+  801319:	89 e5                	mov    %esp,%ebp
+  80131b:	83 ec 08             	sub    $0x8,%esp
+	struct Bio *b;
+
+	if ((b = bio_next()) != NULL)
+  80131e:	e8 ce fc ff ff       	call   800ff1 <bio_next>
+  801323:	85 c0                	test   %eax,%eax
+  801325:	74 07                	je     80132e <bio_step+0x16>
+		bio_dispatch(b);
+  801327:	e8 47 fd ff ff       	call   801073 <bio_dispatch>
+	else
+		fs_yield();
+}
+  80132c:	c9                   	leave
+  80132d:	c3                   	ret
+		fs_yield();
+  80132e:	e8 10 fc ff ff       	call   800f43 <fs_yield>
+}
+  801333:	eb f7                	jmp    80132c <bio_step+0x14>
+
+00801335 <bio_add>:
+{
+  801335:	55                   	push   %ebp
+  801336:	89 e5                	mov    %esp,%ebp
+  801338:	57                   	push   %edi
+  801339:	56                   	push   %esi
+  80133a:	53                   	push   %ebx
+  80133b:	83 ec 2c             	sub    $0x2c,%esp
+  80133e:	89 c3                	mov    %eax,%ebx
+  801340:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  801343:	89 cf                	mov    %ecx,%edi
+  801345:	88 4d e7             	mov    %cl,-0x19(%ebp)
+	bio_reqs++;
+  801348:	83 05 18 58 81 00 01 	addl   $0x1,0x815818
+	if (bio_sched == BIO_SCHED_CLOOK) {
+  80134f:	83 3d 04 b0 80 00 01 	cmpl   $0x1,0x80b004
+  801356:	0f 85 82 00 00 00    	jne    8013de <bio_add+0xa9>
+		for (b = bio_queue; b < bio_queue + BIO_MAXREQ; b++) {
+  80135c:	b8 40 58 81 00       	mov    $0x815840,%eax
+			    blockno + n == b->b_blockno) {
+  801361:	89 d6                	mov    %edx,%esi
+  801363:	01 de                	add    %ebx,%esi
+  801365:	89 75 dc             	mov    %esi,-0x24(%ebp)
+  801368:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  80136b:	eb 32                	jmp    80139f <bio_add+0x6a>
+			    !bio_fits(MIN(b->b_blockno, blockno), b->b_nblocks + n))
+  80136d:	8b 48 04             	mov    0x4(%eax),%ecx
+  801370:	39 d9                	cmp    %ebx,%ecx
+  801372:	89 df                	mov    %ebx,%edi
+  801374:	0f 46 f9             	cmovbe %ecx,%edi
+  801377:	89 7d d8             	mov    %edi,-0x28(%ebp)
+	return n <= BC_MAXRUN && blockno % BIO_STAGEPAGES + n <= BIO_STAGEPAGES;
+  80137a:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  801380:	01 f7                	add    %esi,%edi
+			if (!b->b_busy || b->b_running || b->b_write != write ||
+  801382:	81 ff 00 10 00 00    	cmp    $0x1000,%edi
+  801388:	77 0b                	ja     801395 <bio_add+0x60>
+			if (b->b_blockno + b->b_nblocks == blockno ||
+  80138a:	01 ca                	add    %ecx,%edx
+  80138c:	39 da                	cmp    %ebx,%edx
+  80138e:	74 32                	je     8013c2 <bio_add+0x8d>
+  801390:	39 4d dc             	cmp    %ecx,-0x24(%ebp)
+  801393:	74 2d                	je     8013c2 <bio_add+0x8d>
+		for (b = bio_queue; b < bio_queue + BIO_MAXREQ; b++) {
+  801395:	83 c0 10             	add    $0x10,%eax
+  801398:	3d 40 5c 81 00       	cmp    $0x815c40,%eax
+  80139d:	74 35                	je     8013d4 <bio_add+0x9f>
+			if (!b->b_busy || b->b_running || b->b_write != write ||
+  80139f:	80 38 00             	cmpb   $0x0,(%eax)
+  8013a2:	74 f1                	je     801395 <bio_add+0x60>
+  8013a4:	80 78 02 00          	cmpb   $0x0,0x2(%eax)
+  8013a8:	75 eb                	jne    801395 <bio_add+0x60>
+  8013aa:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8013ae:	38 48 01             	cmp    %cl,0x1(%eax)
+  8013b1:	75 e2                	jne    801395 <bio_add+0x60>
+			    !bio_fits(MIN(b->b_blockno, blockno), b->b_nblocks + n))
+  8013b3:	8b 50 08             	mov    0x8(%eax),%edx
+  8013b6:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  8013b9:	01 d6                	add    %edx,%esi
+	return n <= BC_MAXRUN && blockno % BIO_STAGEPAGES + n <= BIO_STAGEPAGES;
+  8013bb:	83 fe 20             	cmp    $0x20,%esi
+  8013be:	77 d5                	ja     801395 <bio_add+0x60>
+  8013c0:	eb ab                	jmp    80136d <bio_add+0x38>
+				b->b_blockno = MIN(b->b_blockno, blockno);
+  8013c2:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+  8013c5:	89 58 04             	mov    %ebx,0x4(%eax)
+				b->b_nblocks += n;
+  8013c8:	89 70 08             	mov    %esi,0x8(%eax)
+				bio_merged++;
+  8013cb:	83 05 14 58 81 00 01 	addl   $0x1,0x815814
+				return;
+  8013d2:	eb 50                	jmp    801424 <bio_add+0xef>
+  8013d4:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8013d7:	eb 05                	jmp    8013de <bio_add+0xa9>
+		bio_step();
+  8013d9:	e8 3a ff ff ff       	call   801318 <bio_step>
+	while (bio_nqueued == BIO_MAXREQ)
+  8013de:	8b 15 24 58 81 00    	mov    0x815824,%edx
+  8013e4:	83 fa 40             	cmp    $0x40,%edx
+  8013e7:	74 f0                	je     8013d9 <bio_add+0xa4>
+	for (b = bio_queue; b->b_busy; b++)
+  8013e9:	b8 40 58 81 00       	mov    $0x815840,%eax
+  8013ee:	eb 03                	jmp    8013f3 <bio_add+0xbe>
+  8013f0:	83 c0 10             	add    $0x10,%eax
+  8013f3:	80 38 00             	cmpb   $0x0,(%eax)
+  8013f6:	75 f8                	jne    8013f0 <bio_add+0xbb>
+	b->b_busy = 1;
+  8013f8:	c6 00 01             	movb   $0x1,(%eax)
+	b->b_write = write;
+  8013fb:	89 f9                	mov    %edi,%ecx
+  8013fd:	88 48 01             	mov    %cl,0x1(%eax)
+	b->b_blockno = blockno;
+  801400:	89 58 04             	mov    %ebx,0x4(%eax)
+	b->b_nblocks = n;
+  801403:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  801406:	89 70 08             	mov    %esi,0x8(%eax)
+	b->b_seq = bio_seq++;
+  801409:	8b 0d 20 58 81 00    	mov    0x815820,%ecx
+  80140f:	8d 59 01             	lea    0x1(%ecx),%ebx
+  801412:	89 1d 20 58 81 00    	mov    %ebx,0x815820
+  801418:	89 48 0c             	mov    %ecx,0xc(%eax)
+	bio_nqueued++;
+  80141b:	83 c2 01             	add    $0x1,%edx
+  80141e:	89 15 24 58 81 00    	mov    %edx,0x815824
+}
+  801424:	83 c4 2c             	add    $0x2c,%esp
+  801427:	5b                   	pop    %ebx
+  801428:	5e                   	pop    %esi
+  801429:	5f                   	pop    %edi
+  80142a:	5d                   	pop    %ebp
+  80142b:	c3                   	ret
+
+0080142c <bio_read>:
+{
+  80142c:	55                   	push   %ebp
+  80142d:	89 e5                	mov    %esp,%ebp
+  80142f:	57                   	push   %edi
+  801430:	56                   	push   %esi
+  801431:	53                   	push   %ebx
+  801432:	83 ec 1c             	sub    $0x1c,%esp
+	for (nread = 0; nread < nblocks; nread += n) {
+  801435:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80143c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80143f:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  801442:	72 0b                	jb     80144f <bio_read+0x23>
+}
+  801444:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801447:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80144a:	5b                   	pop    %ebx
+  80144b:	5e                   	pop    %esi
+  80144c:	5f                   	pop    %edi
+  80144d:	5d                   	pop    %ebp
+  80144e:	c3                   	ret
+		n = MIN(MIN(nblocks - nread, BC_MAXRUN),
+  80144f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801452:	89 c7                	mov    %eax,%edi
+  801454:	03 7d 08             	add    0x8(%ebp),%edi
+  801457:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80145a:	29 c6                	sub    %eax,%esi
+  80145c:	b8 20 00 00 00       	mov    $0x20,%eax
+  801461:	39 c6                	cmp    %eax,%esi
+  801463:	0f 47 f0             	cmova  %eax,%esi
+  801466:	89 fa                	mov    %edi,%edx
+  801468:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  80146e:	b8 00 10 00 00       	mov    $0x1000,%eax
+  801473:	29 d0                	sub    %edx,%eax
+  801475:	39 c6                	cmp    %eax,%esi
+  801477:	0f 47 f0             	cmova  %eax,%esi
+		for (i = 0; i < n; i++)
+  80147a:	bb 00 00 00 00       	mov    $0x0,%ebx
+			if (va_is_mapped(bio_stageva(blockno + nread + i)))
+  80147f:	83 ec 0c             	sub    $0xc,%esp
+  801482:	8d 04 1f             	lea    (%edi,%ebx,1),%eax
+	return (void *) (BIO_STAGEVA + (blockno % BIO_STAGEPAGES) * PGSIZE);
+  801485:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80148a:	05 00 e0 00 00       	add    $0xe000,%eax
+  80148f:	c1 e0 0c             	shl    $0xc,%eax
+			if (va_is_mapped(bio_stageva(blockno + nread + i)))
+  801492:	50                   	push   %eax
+  801493:	e8 34 04 00 00       	call   8018cc <va_is_mapped>
+  801498:	83 c4 10             	add    $0x10,%esp
+  80149b:	84 c0                	test   %al,%al
+  80149d:	75 1c                	jne    8014bb <bio_read+0x8f>
+		for (i = 0; i < n; i++)
+  80149f:	83 c3 01             	add    $0x1,%ebx
+  8014a2:	39 de                	cmp    %ebx,%esi
+  8014a4:	75 d9                	jne    80147f <bio_read+0x53>
+		if ((n = i) == 0 || bio_nqueued == BIO_MAXREQ)
+  8014a6:	83 3d 24 58 81 00 40 	cmpl   $0x40,0x815824
+  8014ad:	74 95                	je     801444 <bio_read+0x18>
+  8014af:	8d 04 37             	lea    (%edi,%esi,1),%eax
+  8014b2:	89 fb                	mov    %edi,%ebx
+  8014b4:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  8014b7:	89 c7                	mov    %eax,%edi
+  8014b9:	eb 35                	jmp    8014f0 <bio_read+0xc4>
+  8014bb:	85 db                	test   %ebx,%ebx
+  8014bd:	74 85                	je     801444 <bio_read+0x18>
+  8014bf:	89 de                	mov    %ebx,%esi
+  8014c1:	eb e3                	jmp    8014a6 <bio_read+0x7a>
+			sysbatch_add(&bio_batch, SYS_page_alloc, 0,
+  8014c3:	83 ec 04             	sub    $0x4,%esp
+  8014c6:	6a 00                	push   $0x0
+  8014c8:	6a 00                	push   $0x0
+  8014ca:	6a 07                	push   $0x7
+	return (void *) (BIO_STAGEVA + (blockno % BIO_STAGEPAGES) * PGSIZE);
+  8014cc:	89 d8                	mov    %ebx,%eax
+  8014ce:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8014d3:	05 00 e0 00 00       	add    $0xe000,%eax
+  8014d8:	c1 e0 0c             	shl    $0xc,%eax
+			sysbatch_add(&bio_batch, SYS_page_alloc, 0,
+  8014db:	50                   	push   %eax
+  8014dc:	6a 00                	push   $0x0
+  8014de:	6a 04                	push   $0x4
+  8014e0:	68 00 51 81 00       	push   $0x815100
+  8014e5:	e8 31 65 00 00       	call   807a1b <sysbatch_add>
+		for (i = 0; i < n; i++)
+  8014ea:	83 c3 01             	add    $0x1,%ebx
+  8014ed:	83 c4 20             	add    $0x20,%esp
+  8014f0:	39 fb                	cmp    %edi,%ebx
+  8014f2:	75 cf                	jne    8014c3 <bio_read+0x97>
+		if ((r = sysbatch_flush(&bio_batch)) < 0)
+  8014f4:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8014f7:	83 ec 0c             	sub    $0xc,%esp
+  8014fa:	68 00 51 81 00       	push   $0x815100
+  8014ff:	e8 c7 64 00 00       	call   8079cb <sysbatch_flush>
+  801504:	83 c4 10             	add    $0x10,%esp
+  801507:	85 c0                	test   %eax,%eax
+  801509:	78 16                	js     801521 <bio_read+0xf5>
+		bio_add(blockno + nread, n, 0);
+  80150b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801510:	89 f2                	mov    %esi,%edx
+  801512:	89 f8                	mov    %edi,%eax
+  801514:	e8 1c fe ff ff       	call   801335 <bio_add>
+	for (nread = 0; nread < nblocks; nread += n) {
+  801519:	01 75 e4             	add    %esi,-0x1c(%ebp)
+  80151c:	e9 1b ff ff ff       	jmp    80143c <bio_read+0x10>
+			panic("bio_read: %e", r);
+  801521:	50                   	push   %eax
+  801522:	68 c1 9a 80 00       	push   $0x809ac1
+  801527:	68 dc 00 00 00       	push   $0xdc
+  80152c:	68 9f 9a 80 00       	push   $0x809a9f
+  801531:	e8 9a 55 00 00       	call   806ad0 <_panic>
+
+00801536 <bio_write>:
+{
+  801536:	55                   	push   %ebp
+  801537:	89 e5                	mov    %esp,%ebp
+  801539:	57                   	push   %edi
+  80153a:	56                   	push   %esi
+  80153b:	53                   	push   %ebx
+  80153c:	83 ec 0c             	sub    $0xc,%esp
+  80153f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801542:	8b 75 0c             	mov    0xc(%ebp),%esi
+	for (; nblocks > 0; blockno += n, nblocks -= n) {
+  801545:	eb 2f                	jmp    801576 <bio_write+0x40>
+		n = MIN(MIN(nblocks, BC_MAXRUN),
+  801547:	89 f8                	mov    %edi,%eax
+  801549:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80154e:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  801553:	29 c3                	sub    %eax,%ebx
+  801555:	b8 20 00 00 00       	mov    $0x20,%eax
+  80155a:	39 c6                	cmp    %eax,%esi
+  80155c:	0f 46 c6             	cmovbe %esi,%eax
+  80155f:	39 c3                	cmp    %eax,%ebx
+  801561:	0f 47 d8             	cmova  %eax,%ebx
+		bio_add(blockno, n, 1);
+  801564:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801569:	89 da                	mov    %ebx,%edx
+  80156b:	89 f8                	mov    %edi,%eax
+  80156d:	e8 c3 fd ff ff       	call   801335 <bio_add>
+	for (; nblocks > 0; blockno += n, nblocks -= n) {
+  801572:	01 df                	add    %ebx,%edi
+  801574:	29 de                	sub    %ebx,%esi
+  801576:	85 f6                	test   %esi,%esi
+  801578:	75 cd                	jne    801547 <bio_write+0x11>
+}
+  80157a:	83 c4 0c             	add    $0xc,%esp
+  80157d:	5b                   	pop    %ebx
+  80157e:	5e                   	pop    %esi
+  80157f:	5f                   	pop    %edi
+  801580:	5d                   	pop    %ebp
+  801581:	c3                   	ret
+
+00801582 <bio_wait>:
+
+// Run queued requests until none covers 'blockno', then wait for the
+// driver to finish writing it.  Returns 0, or < 0 if a write failed.
+int
+bio_wait(uint32_t blockno)
+{
+  801582:	55                   	push   %ebp
+  801583:	89 e5                	mov    %esp,%ebp
+  801585:	53                   	push   %ebx
+  801586:	83 ec 04             	sub    $0x4,%esp
+  801589:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	while (bio_find(blockno))
+  80158c:	eb 05                	jmp    801593 <bio_wait+0x11>
+		bio_step();
+  80158e:	e8 85 fd ff ff       	call   801318 <bio_step>
+	while (bio_find(blockno))
+  801593:	89 d8                	mov    %ebx,%eax
+  801595:	e8 29 fa ff ff       	call   800fc3 <bio_find>
+  80159a:	85 c0                	test   %eax,%eax
+  80159c:	75 f0                	jne    80158e <bio_wait+0xc>
+	return disk_sync_range(blockno * BLKSECTS, BLKSECTS);
+  80159e:	83 ec 08             	sub    $0x8,%esp
+  8015a1:	6a 08                	push   $0x8
+  8015a3:	c1 e3 03             	shl    $0x3,%ebx
+  8015a6:	53                   	push   %ebx
+  8015a7:	e8 ec f8 ff ff       	call   800e98 <disk_sync_range>
+}
+  8015ac:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015af:	c9                   	leave
+  8015b0:	c3                   	ret
+
+008015b1 <bio_run>:
+
+// Run every queued request not already running, without waiting for
+// writes to finish.
+void
+bio_run(void)
+{
+  8015b1:	55                   	push   %ebp
+  8015b2:	89 e5                	mov    %esp,%ebp
+  8015b4:	83 ec 08             	sub    $0x8,%esp
+	struct Bio *b;
+
+	while ((b = bio_next()) != NULL)
+  8015b7:	eb 05                	jmp    8015be <bio_run+0xd>
+		bio_dispatch(b);
+  8015b9:	e8 b5 fa ff ff       	call   801073 <bio_dispatch>
+	while ((b = bio_next()) != NULL)
+  8015be:	e8 2e fa ff ff       	call   800ff1 <bio_next>
+  8015c3:	85 c0                	test   %eax,%eax
+  8015c5:	75 f2                	jne    8015b9 <bio_run+0x8>
+}
+  8015c7:	c9                   	leave
+  8015c8:	c3                   	ret
+
+008015c9 <bio_sync>:
+
+// Run every queued request and wait until all writes are on disk.
+int
+bio_sync(void)
+{
+  8015c9:	55                   	push   %ebp
+  8015ca:	89 e5                	mov    %esp,%ebp
+  8015cc:	83 ec 08             	sub    $0x8,%esp
+	while (bio_nqueued > 0)
+  8015cf:	eb 05                	jmp    8015d6 <bio_sync+0xd>
+		bio_step();
+  8015d1:	e8 42 fd ff ff       	call   801318 <bio_step>
+	while (bio_nqueued > 0)
+  8015d6:	83 3d 24 58 81 00 00 	cmpl   $0x0,0x815824
+  8015dd:	75 f2                	jne    8015d1 <bio_sync+0x8>
+	return disk_sync();
+  8015df:	e8 73 f8 ff ff       	call   800e57 <disk_sync>
+}
+  8015e4:	c9                   	leave
+  8015e5:	c3                   	ret
+
+008015e6 <bio_set_sched>:
+
+// Set the queue's scheduling policy to 'sched' (BIO_SCHED_*).
+// Returns 0 on success, -E_INVAL if sched is unknown.
+int
+bio_set_sched(int sched)
+{
+  8015e6:	55                   	push   %ebp
+  8015e7:	89 e5                	mov    %esp,%ebp
+  8015e9:	53                   	push   %ebx
+  8015ea:	83 ec 04             	sub    $0x4,%esp
+  8015ed:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (sched != BIO_SCHED_CLOOK && sched != BIO_SCHED_FIFO)
+  8015f0:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  8015f3:	83 f8 01             	cmp    $0x1,%eax
+  8015f6:	77 15                	ja     80160d <bio_set_sched+0x27>
+		return -E_INVAL;
+	bio_run();
+  8015f8:	e8 b4 ff ff ff       	call   8015b1 <bio_run>
+	bio_sched = sched;
+  8015fd:	89 1d 04 b0 80 00    	mov    %ebx,0x80b004
+	return 0;
+  801603:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801608:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80160b:	c9                   	leave
+  80160c:	c3                   	ret
+		return -E_INVAL;
+  80160d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801612:	eb f4                	jmp    801608 <bio_set_sched+0x22>
+
+00801614 <bio_stats>:
+
+void
+bio_stats(struct Fsret_stats *ret)
+{
+  801614:	55                   	push   %ebp
+  801615:	89 e5                	mov    %esp,%ebp
+  801617:	8b 45 08             	mov    0x8(%ebp),%eax
+	ret->ret_bc_writes = bio_writes;
+  80161a:	8b 15 08 58 81 00    	mov    0x815808,%edx
+  801620:	89 50 18             	mov    %edx,0x18(%eax)
+	ret->ret_bc_written = bio_written;
+  801623:	8b 15 04 58 81 00    	mov    0x815804,%edx
+  801629:	89 50 1c             	mov    %edx,0x1c(%eax)
+	ret->ret_bio_sched = bio_sched;
+  80162c:	8b 15 04 b0 80 00    	mov    0x80b004,%edx
+  801632:	89 50 20             	mov    %edx,0x20(%eax)
+	ret->ret_bio_reqs = bio_reqs;
+  801635:	8b 15 18 58 81 00    	mov    0x815818,%edx
+  80163b:	89 50 24             	mov    %edx,0x24(%eax)
+	ret->ret_bio_merged = bio_merged;
+  80163e:	8b 15 14 58 81 00    	mov    0x815814,%edx
+  801644:	89 50 28             	mov    %edx,0x28(%eax)
+	ret->ret_bio_reads = bio_reads;
+  801647:	8b 15 10 58 81 00    	mov    0x815810,%edx
+  80164d:	89 50 2c             	mov    %edx,0x2c(%eax)
+	ret->ret_bio_seek = bio_seek;
+  801650:	8b 15 0c 58 81 00    	mov    0x81580c,%edx
+  801656:	89 50 30             	mov    %edx,0x30(%eax)
+}
+  801659:	5d                   	pop    %ebp
+  80165a:	c3                   	ret
+
+0080165b <match_class>:
+	return -E_NOT_FOUND;
+}
+
+static bool
+match_class(struct PciFunc *f, uint32_t class)
+{
+  80165b:	55                   	push   %ebp
+  80165c:	89 e5                	mov    %esp,%ebp
+	return (f->pf_class >> 16) == class;
+  80165e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801661:	0f b7 40 12          	movzwl 0x12(%eax),%eax
+  801665:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  801668:	0f 94 c0             	sete   %al
+}
+  80166b:	5d                   	pop    %ebp
+  80166c:	c3                   	ret
+
+0080166d <match_id>:
+	return pci_scan(match_class, (class << 8) | subclass, f);
+}
+
+static bool
+match_id(struct PciFunc *f, uint32_t id)
+{
+  80166d:	55                   	push   %ebp
+  80166e:	89 e5                	mov    %esp,%ebp
+	return f->pf_id == id;
+  801670:	8b 45 08             	mov    0x8(%ebp),%eax
+  801673:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801676:	39 50 0c             	cmp    %edx,0xc(%eax)
+  801679:	0f 94 c0             	sete   %al
+}
+  80167c:	5d                   	pop    %ebp
+  80167d:	c3                   	ret
+
+0080167e <pci_conf_read>:
+{
+  80167e:	55                   	push   %ebp
+  80167f:	89 e5                	mov    %esp,%ebp
+  801681:	8b 55 08             	mov    0x8(%ebp),%edx
+	return 0x80000000 | (f->pf_bus << 16) | (f->pf_dev << 11) |
+  801684:	8b 02                	mov    (%edx),%eax
+  801686:	c1 e0 10             	shl    $0x10,%eax
+		(f->pf_func << 8) | (off & 0xFC);
+  801689:	8b 4a 08             	mov    0x8(%edx),%ecx
+  80168c:	c1 e1 08             	shl    $0x8,%ecx
+  80168f:	09 c8                	or     %ecx,%eax
+  801691:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801694:	81 e1 fc 00 00 00    	and    $0xfc,%ecx
+  80169a:	09 c8                	or     %ecx,%eax
+	return 0x80000000 | (f->pf_bus << 16) | (f->pf_dev << 11) |
+  80169c:	8b 52 04             	mov    0x4(%edx),%edx
+  80169f:	c1 e2 0b             	shl    $0xb,%edx
+		(f->pf_func << 8) | (off & 0xFC);
+  8016a2:	09 d0                	or     %edx,%eax
+  8016a4:	0d 00 00 00 80       	or     $0x80000000,%eax
+  __asm __volatile("outl %0,%w1" : : "a" (data), "d" (port));
+  8016a9:	ba f8 0c 00 00       	mov    $0xcf8,%edx
+  8016ae:	ef                   	out    %eax,(%dx)
+  __asm __volatile("inl %w1,%0" : "=a" (data) : "d" (port));
+  8016af:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+  8016b4:	ed                   	in     (%dx),%eax
+}
+  8016b5:	5d                   	pop    %ebp
+  8016b6:	c3                   	ret
+
+008016b7 <pci_scan>:
+{
+  8016b7:	55                   	push   %ebp
+  8016b8:	89 e5                	mov    %esp,%ebp
+  8016ba:	57                   	push   %edi
+  8016bb:	56                   	push   %esi
+  8016bc:	53                   	push   %ebx
+  8016bd:	83 ec 1c             	sub    $0x1c,%esp
+  8016c0:	89 c7                	mov    %eax,%edi
+  8016c2:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8016c5:	89 cb                	mov    %ecx,%ebx
+	for (f->pf_bus = 0; f->pf_bus < 256; f->pf_bus++)
+  8016c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016cc:	e9 bb 00 00 00       	jmp    80178c <pci_scan+0xd5>
+				f->pf_class = pci_conf_read(f, PCI_CLASS_REG);
+  8016d1:	83 ec 08             	sub    $0x8,%esp
+  8016d4:	6a 08                	push   $0x8
+  8016d6:	53                   	push   %ebx
+  8016d7:	e8 a2 ff ff ff       	call   80167e <pci_conf_read>
+  8016dc:	89 43 10             	mov    %eax,0x10(%ebx)
+				hdr = pci_conf_read(f, PCI_HEADER_REG) >> 16;
+  8016df:	83 c4 08             	add    $0x8,%esp
+  8016e2:	6a 0c                	push   $0xc
+  8016e4:	53                   	push   %ebx
+  8016e5:	e8 94 ff ff ff       	call   80167e <pci_conf_read>
+  8016ea:	c1 e8 10             	shr    $0x10,%eax
+  8016ed:	89 c6                	mov    %eax,%esi
+				if (match(f, arg)) {
+  8016ef:	83 c4 08             	add    $0x8,%esp
+  8016f2:	ff 75 e4             	push   -0x1c(%ebp)
+  8016f5:	53                   	push   %ebx
+  8016f6:	ff d7                	call   *%edi
+  8016f8:	83 c4 10             	add    $0x10,%esp
+  8016fb:	84 c0                	test   %al,%al
+  8016fd:	75 49                	jne    801748 <pci_scan+0x91>
+				if (f->pf_func == 0 && !(hdr & 0x80))
+  8016ff:	81 e6 80 00 00 00    	and    $0x80,%esi
+  801705:	0b 73 08             	or     0x8(%ebx),%esi
+  801708:	74 29                	je     801733 <pci_scan+0x7c>
+			for (f->pf_func = 0; f->pf_func < 8; f->pf_func++) {
+  80170a:	8b 43 08             	mov    0x8(%ebx),%eax
+  80170d:	8d 70 01             	lea    0x1(%eax),%esi
+  801710:	89 73 08             	mov    %esi,0x8(%ebx)
+  801713:	83 fe 07             	cmp    $0x7,%esi
+  801716:	77 1b                	ja     801733 <pci_scan+0x7c>
+				f->pf_id = pci_conf_read(f, PCI_ID_REG);
+  801718:	83 ec 08             	sub    $0x8,%esp
+  80171b:	6a 00                	push   $0x0
+  80171d:	53                   	push   %ebx
+  80171e:	e8 5b ff ff ff       	call   80167e <pci_conf_read>
+  801723:	89 43 0c             	mov    %eax,0xc(%ebx)
+				if ((f->pf_id & 0xFFFF) == 0xFFFF) {
+  801726:	83 c4 10             	add    $0x10,%esp
+  801729:	66 83 f8 ff          	cmp    $0xffff,%ax
+  80172d:	75 a2                	jne    8016d1 <pci_scan+0x1a>
+					if (f->pf_func == 0)
+  80172f:	85 f6                	test   %esi,%esi
+  801731:	75 d7                	jne    80170a <pci_scan+0x53>
+		for (f->pf_dev = 0; f->pf_dev < 32; f->pf_dev++)
+  801733:	8b 43 04             	mov    0x4(%ebx),%eax
+  801736:	83 c0 01             	add    $0x1,%eax
+  801739:	89 43 04             	mov    %eax,0x4(%ebx)
+  80173c:	83 f8 1f             	cmp    $0x1f,%eax
+  80173f:	77 46                	ja     801787 <pci_scan+0xd0>
+  801741:	be 00 00 00 00       	mov    $0x0,%esi
+  801746:	eb c8                	jmp    801710 <pci_scan+0x59>
+  801748:	be 10 00 00 00       	mov    $0x10,%esi
+						f->pf_bar[i] = pci_conf_read(f, PCI_BAR0_REG + 4 * i);
+  80174d:	83 ec 08             	sub    $0x8,%esp
+  801750:	56                   	push   %esi
+  801751:	53                   	push   %ebx
+  801752:	e8 27 ff ff ff       	call   80167e <pci_conf_read>
+  801757:	89 44 33 04          	mov    %eax,0x4(%ebx,%esi,1)
+					for (i = 0; i < 6; i++)
+  80175b:	83 c6 04             	add    $0x4,%esi
+  80175e:	83 c4 10             	add    $0x10,%esp
+  801761:	83 fe 28             	cmp    $0x28,%esi
+  801764:	75 e7                	jne    80174d <pci_scan+0x96>
+					f->pf_irq = pci_conf_read(f, PCI_INTR_REG) & 0xFF;
+  801766:	83 ec 08             	sub    $0x8,%esp
+  801769:	6a 3c                	push   $0x3c
+  80176b:	53                   	push   %ebx
+  80176c:	e8 0d ff ff ff       	call   80167e <pci_conf_read>
+  801771:	0f b6 c0             	movzbl %al,%eax
+  801774:	89 43 2c             	mov    %eax,0x2c(%ebx)
+					return 0;
+  801777:	83 c4 10             	add    $0x10,%esp
+  80177a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80177f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801782:	5b                   	pop    %ebx
+  801783:	5e                   	pop    %esi
+  801784:	5f                   	pop    %edi
+  801785:	5d                   	pop    %ebp
+  801786:	c3                   	ret
+	for (f->pf_bus = 0; f->pf_bus < 256; f->pf_bus++)
+  801787:	8b 03                	mov    (%ebx),%eax
+  801789:	83 c0 01             	add    $0x1,%eax
+  80178c:	89 03                	mov    %eax,(%ebx)
+  80178e:	3d ff 00 00 00       	cmp    $0xff,%eax
+  801793:	77 07                	ja     80179c <pci_scan+0xe5>
+  801795:	b8 00 00 00 00       	mov    $0x0,%eax
+  80179a:	eb 9d                	jmp    801739 <pci_scan+0x82>
+	return -E_NOT_FOUND;
+  80179c:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  8017a1:	eb dc                	jmp    80177f <pci_scan+0xc8>
+
+008017a3 <pci_conf_write>:
+{
+  8017a3:	55                   	push   %ebp
+  8017a4:	89 e5                	mov    %esp,%ebp
+  8017a6:	8b 55 08             	mov    0x8(%ebp),%edx
+	return 0x80000000 | (f->pf_bus << 16) | (f->pf_dev << 11) |
+  8017a9:	8b 02                	mov    (%edx),%eax
+  8017ab:	c1 e0 10             	shl    $0x10,%eax
+		(f->pf_func << 8) | (off & 0xFC);
+  8017ae:	8b 4a 08             	mov    0x8(%edx),%ecx
+  8017b1:	c1 e1 08             	shl    $0x8,%ecx
+  8017b4:	09 c8                	or     %ecx,%eax
+  8017b6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017b9:	81 e1 fc 00 00 00    	and    $0xfc,%ecx
+  8017bf:	09 c8                	or     %ecx,%eax
+	return 0x80000000 | (f->pf_bus << 16) | (f->pf_dev << 11) |
+  8017c1:	8b 52 04             	mov    0x4(%edx),%edx
+  8017c4:	c1 e2 0b             	shl    $0xb,%edx
+		(f->pf_func << 8) | (off & 0xFC);
+  8017c7:	09 d0                	or     %edx,%eax
+  8017c9:	0d 00 00 00 80       	or     $0x80000000,%eax
+  __asm __volatile("outl %0,%w1" : : "a" (data), "d" (port));
+  8017ce:	ba f8 0c 00 00       	mov    $0xcf8,%edx
+  8017d3:	ef                   	out    %eax,(%dx)
+  8017d4:	8b 45 10             	mov    0x10(%ebp),%eax
+  8017d7:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+  8017dc:	ef                   	out    %eax,(%dx)
+}
+  8017dd:	5d                   	pop    %ebp
+  8017de:	c3                   	ret
+
+008017df <pci_enable>:
+{
+  8017df:	55                   	push   %ebp
+  8017e0:	89 e5                	mov    %esp,%ebp
+  8017e2:	53                   	push   %ebx
+  8017e3:	83 ec 0c             	sub    $0xc,%esp
+  8017e6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+		       pci_conf_read(f, PCI_COMMAND_REG) | flags);
+  8017e9:	6a 04                	push   $0x4
+  8017eb:	53                   	push   %ebx
+  8017ec:	e8 8d fe ff ff       	call   80167e <pci_conf_read>
+	pci_conf_write(f, PCI_COMMAND_REG,
+  8017f1:	83 c4 0c             	add    $0xc,%esp
+  8017f4:	0b 45 0c             	or     0xc(%ebp),%eax
+  8017f7:	50                   	push   %eax
+  8017f8:	6a 04                	push   $0x4
+  8017fa:	53                   	push   %ebx
+  8017fb:	e8 a3 ff ff ff       	call   8017a3 <pci_conf_write>
+}
+  801800:	83 c4 10             	add    $0x10,%esp
+  801803:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801806:	c9                   	leave
+  801807:	c3                   	ret
+
+00801808 <pci_find_class>:
+{
+  801808:	55                   	push   %ebp
+  801809:	89 e5                	mov    %esp,%ebp
+  80180b:	83 ec 08             	sub    $0x8,%esp
+	return pci_scan(match_class, (class << 8) | subclass, f);
+  80180e:	0f b6 55 08          	movzbl 0x8(%ebp),%edx
+  801812:	c1 e2 08             	shl    $0x8,%edx
+  801815:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  801819:	09 c2                	or     %eax,%edx
+  80181b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  80181e:	b8 5b 16 80 00       	mov    $0x80165b,%eax
+  801823:	e8 8f fe ff ff       	call   8016b7 <pci_scan>
+}
+  801828:	c9                   	leave
+  801829:	c3                   	ret
+
+0080182a <pci_find_device>:
+
+// Find the first function with vendor ID 'vendor' and device ID 'device'.
+int
+pci_find_device(uint16_t vendor, uint16_t device, struct PciFunc *f)
+{
+  80182a:	55                   	push   %ebp
+  80182b:	89 e5                	mov    %esp,%ebp
+  80182d:	83 ec 08             	sub    $0x8,%esp
+	return pci_scan(match_id, ((uint32_t) device << 16) | vendor, f);
+  801830:	0f b7 55 0c          	movzwl 0xc(%ebp),%edx
+  801834:	c1 e2 10             	shl    $0x10,%edx
+  801837:	0f b7 45 08          	movzwl 0x8(%ebp),%eax
+  80183b:	09 c2                	or     %eax,%edx
+  80183d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  801840:	b8 6d 16 80 00       	mov    $0x80166d,%eax
+  801845:	e8 6d fe ff ff       	call   8016b7 <pci_scan>
+}
+  80184a:	c9                   	leave
+  80184b:	c3                   	ret
+
+0080184c <bc_track>:
+
+// Add 'blockno', which is being read in, to the resident blocks.
+// Call bc_reserve first.
+static void
+bc_track(uint32_t blockno)
+{
+  80184c:	89 c2                	mov    %eax,%edx
+	return super == 0 ||
+  80184e:	8b 0d 88 3f 84 00    	mov    0x843f88,%ecx
+		blockno < 2 + (super->s_nblocks + BLKBITSIZE - 1) / BLKBITSIZE ||
+  801854:	85 c9                	test   %ecx,%ecx
+  801856:	74 3b                	je     801893 <bc_track+0x47>
+  801858:	8b 41 04             	mov    0x4(%ecx),%eax
+  80185b:	05 ff 7f 00 00       	add    $0x7fff,%eax
+  801860:	c1 e8 0f             	shr    $0xf,%eax
+  801863:	83 c0 02             	add    $0x2,%eax
+	return super == 0 ||
+  801866:	39 c2                	cmp    %eax,%edx
+  801868:	72 29                	jb     801893 <bc_track+0x47>
+		(blockno >= super->s_journal &&
+  80186a:	8b 81 0c 01 00 00    	mov    0x10c(%ecx),%eax
+		blockno < 2 + (super->s_nblocks + BLKBITSIZE - 1) / BLKBITSIZE ||
+  801870:	39 c2                	cmp    %eax,%edx
+  801872:	72 0a                	jb     80187e <bc_track+0x32>
+		 blockno < super->s_journal + super->s_njournal);
+  801874:	03 81 10 01 00 00    	add    0x110(%ecx),%eax
+	if (!bc_pinned(blockno))
+  80187a:	39 c2                	cmp    %eax,%edx
+  80187c:	72 15                	jb     801893 <bc_track+0x47>
+		bc_blocks[bc_nresident++] = blockno;
+  80187e:	a1 74 5d 82 00       	mov    0x825d74,%eax
+  801883:	8d 48 01             	lea    0x1(%eax),%ecx
+  801886:	89 0d 74 5d 82 00    	mov    %ecx,0x825d74
+  80188c:	89 14 85 80 5d 82 00 	mov    %edx,0x825d80(,%eax,4)
+}
+  801893:	c3                   	ret
+
+00801894 <diskaddr>:
+{
+  801894:	55                   	push   %ebp
+  801895:	89 e5                	mov    %esp,%ebp
+  801897:	83 ec 08             	sub    $0x8,%esp
+  80189a:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (blockno == 0 || (super && blockno >= super->s_nblocks))
+  80189d:	85 c0                	test   %eax,%eax
+  80189f:	74 19                	je     8018ba <diskaddr+0x26>
+  8018a1:	8b 15 88 3f 84 00    	mov    0x843f88,%edx
+  8018a7:	85 d2                	test   %edx,%edx
+  8018a9:	74 05                	je     8018b0 <diskaddr+0x1c>
+  8018ab:	3b 42 04             	cmp    0x4(%edx),%eax
+  8018ae:	73 0a                	jae    8018ba <diskaddr+0x26>
+	return (char*) (DISKMAP + blockno * BLKSIZE);
+  8018b0:	05 00 00 01 00       	add    $0x10000,%eax
+  8018b5:	c1 e0 0c             	shl    $0xc,%eax
+}
+  8018b8:	c9                   	leave
+  8018b9:	c3                   	ret
+		panic("bad block number %08x in diskaddr", blockno);
+  8018ba:	50                   	push   %eax
+  8018bb:	68 d0 9a 80 00       	push   $0x809ad0
+  8018c0:	6a 1d                	push   $0x1d
+  8018c2:	68 8c 9b 80 00       	push   $0x809b8c
+  8018c7:	e8 04 52 00 00       	call   806ad0 <_panic>
+
+008018cc <va_is_mapped>:
+{
+  8018cc:	55                   	push   %ebp
+  8018cd:	89 e5                	mov    %esp,%ebp
+  8018cf:	8b 55 08             	mov    0x8(%ebp),%edx
+	return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+  8018d2:	89 d0                	mov    %edx,%eax
+  8018d4:	c1 e8 16             	shr    $0x16,%eax
+  8018d7:	8b 0c 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%ecx
+  8018de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018e3:	f6 c1 01             	test   $0x1,%cl
+  8018e6:	74 0d                	je     8018f5 <va_is_mapped+0x29>
+  8018e8:	c1 ea 0c             	shr    $0xc,%edx
+  8018eb:	8b 04 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%eax
+  8018f2:	83 e0 01             	and    $0x1,%eax
+  8018f5:	83 e0 01             	and    $0x1,%eax
+}
+  8018f8:	5d                   	pop    %ebp
+  8018f9:	c3                   	ret
+
+008018fa <va_is_writable>:
+{
+  8018fa:	55                   	push   %ebp
+  8018fb:	89 e5                	mov    %esp,%ebp
+  8018fd:	53                   	push   %ebx
+  8018fe:	83 ec 10             	sub    $0x10,%esp
+  801901:	89 c3                	mov    %eax,%ebx
+	return va_is_mapped(va) && (uvpt[PGNUM(va)] & PTE_W);
+  801903:	50                   	push   %eax
+  801904:	e8 c3 ff ff ff       	call   8018cc <va_is_mapped>
+  801909:	83 c4 10             	add    $0x10,%esp
+  80190c:	84 c0                	test   %al,%al
+  80190e:	74 17                	je     801927 <va_is_writable+0x2d>
+  801910:	c1 eb 0c             	shr    $0xc,%ebx
+  801913:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+  80191a:	d1 e8                	shr    %eax
+  80191c:	83 e0 01             	and    $0x1,%eax
+  80191f:	83 e0 01             	and    $0x1,%eax
+}
+  801922:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801925:	c9                   	leave
+  801926:	c3                   	ret
+	return va_is_mapped(va) && (uvpt[PGNUM(va)] & PTE_W);
+  801927:	b8 00 00 00 00       	mov    $0x0,%eax
+  80192c:	eb f1                	jmp    80191f <va_is_writable+0x25>
+
+0080192e <bc_dirty_collect>:
+{
+  80192e:	55                   	push   %ebp
+  80192f:	89 e5                	mov    %esp,%ebp
+  801931:	57                   	push   %edi
+  801932:	56                   	push   %esi
+  801933:	53                   	push   %ebx
+  801934:	83 ec 1c             	sub    $0x1c,%esp
+	bc_dirty_sort(bc_ndirty);
+  801937:	a1 40 5c 81 00       	mov    0x815c40,%eax
+  80193c:	89 45 dc             	mov    %eax,-0x24(%ebp)
+	for (gap = 1; gap < n / 3; gap = gap * 3 + 1)
+  80193f:	ba ab aa aa aa       	mov    $0xaaaaaaab,%edx
+  801944:	f7 e2                	mul    %edx
+  801946:	89 d0                	mov    %edx,%eax
+  801948:	d1 e8                	shr    %eax
+  80194a:	bf 01 00 00 00       	mov    $0x1,%edi
+  80194f:	39 c7                	cmp    %eax,%edi
+  801951:	73 56                	jae    8019a9 <bc_dirty_collect+0x7b>
+  801953:	8d 7c 7f 01          	lea    0x1(%edi,%edi,2),%edi
+  801957:	eb f6                	jmp    80194f <bc_dirty_collect+0x21>
+				bc_dirty[j] = bc_dirty[j - gap];
+  801959:	89 08                	mov    %ecx,(%eax)
+			for (j = i; j >= gap && bc_dirty[j - gap] > b; j -= gap)
+  80195b:	01 d8                	add    %ebx,%eax
+  80195d:	89 f2                	mov    %esi,%edx
+  80195f:	39 fa                	cmp    %edi,%edx
+  801961:	72 0c                	jb     80196f <bc_dirty_collect+0x41>
+  801963:	89 d6                	mov    %edx,%esi
+  801965:	29 fe                	sub    %edi,%esi
+  801967:	8b 0c 18             	mov    (%eax,%ebx,1),%ecx
+  80196a:	39 4d e4             	cmp    %ecx,-0x1c(%ebp)
+  80196d:	72 ea                	jb     801959 <bc_dirty_collect+0x2b>
+			bc_dirty[j] = b;
+  80196f:	8b 75 e0             	mov    -0x20(%ebp),%esi
+  801972:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801975:	89 04 95 60 5c 81 00 	mov    %eax,0x815c60(,%edx,4)
+		for (i = gap; i < n; i++) {
+  80197c:	83 c6 01             	add    $0x1,%esi
+  80197f:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  801982:	39 c6                	cmp    %eax,%esi
+  801984:	73 18                	jae    80199e <bc_dirty_collect+0x70>
+			b = bc_dirty[i];
+  801986:	8b 04 b5 60 5c 81 00 	mov    0x815c60(,%esi,4),%eax
+  80198d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+			for (j = i; j >= gap && bc_dirty[j - gap] > b; j -= gap)
+  801990:	8d 04 b5 60 5c 81 00 	lea    0x815c60(,%esi,4),%eax
+  801997:	89 f2                	mov    %esi,%edx
+  801999:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  80199c:	eb c1                	jmp    80195f <bc_dirty_collect+0x31>
+	for (; gap > 0; gap /= 3)
+  80199e:	b8 ab aa aa aa       	mov    $0xaaaaaaab,%eax
+  8019a3:	f7 e7                	mul    %edi
+  8019a5:	89 d7                	mov    %edx,%edi
+  8019a7:	d1 ef                	shr    %edi
+  8019a9:	85 ff                	test   %edi,%edi
+  8019ab:	74 51                	je     8019fe <bc_dirty_collect+0xd0>
+  8019ad:	8d 1c bd 00 00 00 00 	lea    0x0(,%edi,4),%ebx
+  8019b4:	f7 db                	neg    %ebx
+		for (i = gap; i < n; i++) {
+  8019b6:	89 fe                	mov    %edi,%esi
+  8019b8:	eb c5                	jmp    80197f <bc_dirty_collect+0x51>
+	for (i = n = 0; i < bc_ndirty; i++) {
+  8019ba:	83 c7 01             	add    $0x1,%edi
+  8019bd:	39 7d dc             	cmp    %edi,-0x24(%ebp)
+  8019c0:	74 40                	je     801a02 <bc_dirty_collect+0xd4>
+		if (n > 0 && bc_dirty[n - 1] == bc_dirty[i])
+  8019c2:	85 db                	test   %ebx,%ebx
+  8019c4:	74 10                	je     8019d6 <bc_dirty_collect+0xa8>
+  8019c6:	8b 04 bd 60 5c 81 00 	mov    0x815c60(,%edi,4),%eax
+  8019cd:	39 04 9d 5c 5c 81 00 	cmp    %eax,0x815c5c(,%ebx,4)
+  8019d4:	74 e4                	je     8019ba <bc_dirty_collect+0x8c>
+		if (va_is_writable(diskaddr(bc_dirty[i])))
+  8019d6:	8b 34 bd 60 5c 81 00 	mov    0x815c60(,%edi,4),%esi
+  8019dd:	83 ec 0c             	sub    $0xc,%esp
+  8019e0:	56                   	push   %esi
+  8019e1:	e8 ae fe ff ff       	call   801894 <diskaddr>
+  8019e6:	83 c4 10             	add    $0x10,%esp
+  8019e9:	e8 0c ff ff ff       	call   8018fa <va_is_writable>
+  8019ee:	84 c0                	test   %al,%al
+  8019f0:	74 c8                	je     8019ba <bc_dirty_collect+0x8c>
+			bc_dirty[n++] = bc_dirty[i];
+  8019f2:	89 34 9d 60 5c 81 00 	mov    %esi,0x815c60(,%ebx,4)
+  8019f9:	8d 5b 01             	lea    0x1(%ebx),%ebx
+  8019fc:	eb bc                	jmp    8019ba <bc_dirty_collect+0x8c>
+	for (i = n = 0; i < bc_ndirty; i++) {
+  8019fe:	89 fb                	mov    %edi,%ebx
+  801a00:	eb bb                	jmp    8019bd <bc_dirty_collect+0x8f>
+	return bc_ndirty = n;
+  801a02:	89 1d 40 5c 81 00    	mov    %ebx,0x815c40
+}
+  801a08:	89 d8                	mov    %ebx,%eax
+  801a0a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a0d:	5b                   	pop    %ebx
+  801a0e:	5e                   	pop    %esi
+  801a0f:	5f                   	pop    %edi
+  801a10:	5d                   	pop    %ebp
+  801a11:	c3                   	ret
+
+00801a12 <bc_dirty_add>:
+{
+  801a12:	55                   	push   %ebp
+  801a13:	89 e5                	mov    %esp,%ebp
+  801a15:	53                   	push   %ebx
+  801a16:	83 ec 04             	sub    $0x4,%esp
+  801a19:	89 c3                	mov    %eax,%ebx
+	if (bc_ndirty == BC_MAXDIRTY && bc_dirty_collect() == BC_MAXDIRTY)
+  801a1b:	81 3d 40 5c 81 00 40 	cmpl   $0x4040,0x815c40
+  801a22:	40 00 00 
+  801a25:	74 1a                	je     801a41 <bc_dirty_add+0x2f>
+	bc_dirty[bc_ndirty++] = blockno;
+  801a27:	a1 40 5c 81 00       	mov    0x815c40,%eax
+  801a2c:	8d 50 01             	lea    0x1(%eax),%edx
+  801a2f:	89 15 40 5c 81 00    	mov    %edx,0x815c40
+  801a35:	89 1c 85 60 5c 81 00 	mov    %ebx,0x815c60(,%eax,4)
+}
+  801a3c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a3f:	c9                   	leave
+  801a40:	c3                   	ret
+	if (bc_ndirty == BC_MAXDIRTY && bc_dirty_collect() == BC_MAXDIRTY)
+  801a41:	e8 e8 fe ff ff       	call   80192e <bc_dirty_collect>
+  801a46:	3d 40 40 00 00       	cmp    $0x4040,%eax
+  801a4b:	75 da                	jne    801a27 <bc_dirty_add+0x15>
+		panic("bc_dirty_add: dirty list full");
+  801a4d:	83 ec 04             	sub    $0x4,%esp
+  801a50:	68 94 9b 80 00       	push   $0x809b94
+  801a55:	6a 5d                	push   $0x5d
+  801a57:	68 8c 9b 80 00       	push   $0x809b8c
+  801a5c:	e8 6f 50 00 00       	call   806ad0 <_panic>
+
+00801a61 <bc_absent>:
+
+// How many blocks from 'blockno' on, up to 'n', are neither cached nor
+// queued?
+static uint32_t
+bc_absent(uint32_t blockno, uint32_t n)
+{
+  801a61:	55                   	push   %ebp
+  801a62:	89 e5                	mov    %esp,%ebp
+  801a64:	57                   	push   %edi
+  801a65:	56                   	push   %esi
+  801a66:	53                   	push   %ebx
+  801a67:	83 ec 1c             	sub    $0x1c,%esp
+  801a6a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801a6d:	89 d7                	mov    %edx,%edi
+	uint32_t i;
+
+	for (i = 0; i < n && !va_is_mapped(diskaddr(blockno + i)) &&
+  801a6f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a74:	eb 03                	jmp    801a79 <bc_absent+0x18>
+		    !bio_pending(blockno + i); i++)
+  801a76:	83 c3 01             	add    $0x1,%ebx
+	for (i = 0; i < n && !va_is_mapped(diskaddr(blockno + i)) &&
+  801a79:	39 fb                	cmp    %edi,%ebx
+  801a7b:	74 30                	je     801aad <bc_absent+0x4c>
+  801a7d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801a80:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+  801a83:	83 ec 0c             	sub    $0xc,%esp
+  801a86:	56                   	push   %esi
+  801a87:	e8 08 fe ff ff       	call   801894 <diskaddr>
+  801a8c:	89 04 24             	mov    %eax,(%esp)
+  801a8f:	e8 38 fe ff ff       	call   8018cc <va_is_mapped>
+  801a94:	83 c4 10             	add    $0x10,%esp
+  801a97:	84 c0                	test   %al,%al
+  801a99:	75 14                	jne    801aaf <bc_absent+0x4e>
+		    !bio_pending(blockno + i); i++)
+  801a9b:	83 ec 0c             	sub    $0xc,%esp
+  801a9e:	56                   	push   %esi
+  801a9f:	e8 84 f7 ff ff       	call   801228 <bio_pending>
+	for (i = 0; i < n && !va_is_mapped(diskaddr(blockno + i)) &&
+  801aa4:	83 c4 10             	add    $0x10,%esp
+  801aa7:	84 c0                	test   %al,%al
+  801aa9:	74 cb                	je     801a76 <bc_absent+0x15>
+  801aab:	eb 02                	jmp    801aaf <bc_absent+0x4e>
+  801aad:	89 fb                	mov    %edi,%ebx
+		;
+	return i;
+}
+  801aaf:	89 d8                	mov    %ebx,%eax
+  801ab1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ab4:	5b                   	pop    %ebx
+  801ab5:	5e                   	pop    %esi
+  801ab6:	5f                   	pop    %edi
+  801ab7:	5d                   	pop    %ebp
+  801ab8:	c3                   	ret
+
+00801ab9 <va_is_dirty>:
+{
+  801ab9:	55                   	push   %ebp
+  801aba:	89 e5                	mov    %esp,%ebp
+	return (uvpt[PGNUM(va)] & PTE_D) != 0;
+  801abc:	8b 45 08             	mov    0x8(%ebp),%eax
+  801abf:	c1 e8 0c             	shr    $0xc,%eax
+  801ac2:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801ac9:	c1 e8 06             	shr    $0x6,%eax
+  801acc:	83 e0 01             	and    $0x1,%eax
+}
+  801acf:	5d                   	pop    %ebp
+  801ad0:	c3                   	ret
+
+00801ad1 <bc_lookup>:
+{
+  801ad1:	55                   	push   %ebp
+  801ad2:	89 e5                	mov    %esp,%ebp
+  801ad4:	53                   	push   %ebx
+  801ad5:	83 ec 10             	sub    $0x10,%esp
+	void *va = diskaddr(blockno);
+  801ad8:	ff 75 08             	push   0x8(%ebp)
+  801adb:	e8 b4 fd ff ff       	call   801894 <diskaddr>
+  801ae0:	89 c3                	mov    %eax,%ebx
+	if (va_is_mapped(va))
+  801ae2:	89 04 24             	mov    %eax,(%esp)
+  801ae5:	e8 e2 fd ff ff       	call   8018cc <va_is_mapped>
+  801aea:	83 c4 10             	add    $0x10,%esp
+  801aed:	84 c0                	test   %al,%al
+  801aef:	74 0e                	je     801aff <bc_lookup+0x2e>
+		bc_hits++;
+  801af1:	83 05 6c 5d 82 00 01 	addl   $0x1,0x825d6c
+}
+  801af8:	89 d8                	mov    %ebx,%eax
+  801afa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801afd:	c9                   	leave
+  801afe:	c3                   	ret
+		bc_misses++;
+  801aff:	83 05 68 5d 82 00 01 	addl   $0x1,0x825d68
+	return va;
+  801b06:	eb f0                	jmp    801af8 <bc_lookup+0x27>
+
+00801b08 <bc_stats>:
+{
+  801b08:	55                   	push   %ebp
+  801b09:	89 e5                	mov    %esp,%ebp
+  801b0b:	8b 45 08             	mov    0x8(%ebp),%eax
+	ret->ret_bc_capacity = bc_capacity;
+  801b0e:	8b 15 08 b0 80 00    	mov    0x80b008,%edx
+  801b14:	89 10                	mov    %edx,(%eax)
+	ret->ret_bc_resident = bc_nresident;
+  801b16:	8b 15 74 5d 82 00    	mov    0x825d74,%edx
+  801b1c:	89 50 04             	mov    %edx,0x4(%eax)
+	ret->ret_bc_hits = bc_hits;
+  801b1f:	8b 15 6c 5d 82 00    	mov    0x825d6c,%edx
+  801b25:	89 50 08             	mov    %edx,0x8(%eax)
+	ret->ret_bc_misses = bc_misses;
+  801b28:	8b 15 68 5d 82 00    	mov    0x825d68,%edx
+  801b2e:	89 50 0c             	mov    %edx,0xc(%eax)
+	ret->ret_bc_evictions = bc_evictions;
+  801b31:	8b 15 64 5d 82 00    	mov    0x825d64,%edx
+  801b37:	89 50 10             	mov    %edx,0x10(%eax)
+	ret->ret_bc_readahead = bc_readahead;
+  801b3a:	8b 15 60 5d 82 00    	mov    0x825d60,%edx
+  801b40:	89 50 14             	mov    %edx,0x14(%eax)
+}
+  801b43:	5d                   	pop    %ebp
+  801b44:	c3                   	ret
+
+00801b45 <bc_flush>:
+// a run of consecutive dirty blocks per request, and map them read-only
+// again, which clears PTE_D.  Blocks in the journal's running
+// transaction are left dirty.
+void
+bc_flush(uint32_t blockno, uint32_t nblocks)
+{
+  801b45:	55                   	push   %ebp
+  801b46:	89 e5                	mov    %esp,%ebp
+  801b48:	57                   	push   %edi
+  801b49:	56                   	push   %esi
+  801b4a:	53                   	push   %ebx
+  801b4b:	83 ec 1c             	sub    $0x1c,%esp
+	uint32_t b, i, n, end;
+	void *va;
+	int r;
+
+	end = blockno + nblocks;
+  801b4e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801b51:	03 7d 0c             	add    0xc(%ebp),%edi
+	for (b = blockno; b < end; b += n) {
+  801b54:	e9 17 01 00 00       	jmp    801c70 <bc_flush+0x12b>
+		for (n = 0; b + n < end && n < BC_MAXRUN &&
+			    va_is_mapped(diskaddr(b + n)) &&
+			    va_is_dirty(diskaddr(b + n)) &&
+			    !journal_running(b + n); n++)
+  801b59:	83 c6 01             	add    $0x1,%esi
+		for (n = 0; b + n < end && n < BC_MAXRUN &&
+  801b5c:	83 fe 1f             	cmp    $0x1f,%esi
+  801b5f:	77 47                	ja     801ba8 <bc_flush+0x63>
+  801b61:	39 fb                	cmp    %edi,%ebx
+  801b63:	73 43                	jae    801ba8 <bc_flush+0x63>
+			    va_is_mapped(diskaddr(b + n)) &&
+  801b65:	83 ec 0c             	sub    $0xc,%esp
+  801b68:	53                   	push   %ebx
+  801b69:	e8 26 fd ff ff       	call   801894 <diskaddr>
+  801b6e:	89 04 24             	mov    %eax,(%esp)
+  801b71:	e8 56 fd ff ff       	call   8018cc <va_is_mapped>
+		for (n = 0; b + n < end && n < BC_MAXRUN &&
+  801b76:	83 c4 10             	add    $0x10,%esp
+  801b79:	84 c0                	test   %al,%al
+  801b7b:	74 2b                	je     801ba8 <bc_flush+0x63>
+			    va_is_dirty(diskaddr(b + n)) &&
+  801b7d:	83 ec 0c             	sub    $0xc,%esp
+  801b80:	53                   	push   %ebx
+  801b81:	e8 0e fd ff ff       	call   801894 <diskaddr>
+  801b86:	89 04 24             	mov    %eax,(%esp)
+  801b89:	e8 2b ff ff ff       	call   801ab9 <va_is_dirty>
+			    va_is_mapped(diskaddr(b + n)) &&
+  801b8e:	83 c4 10             	add    $0x10,%esp
+  801b91:	84 c0                	test   %al,%al
+  801b93:	74 13                	je     801ba8 <bc_flush+0x63>
+			    !journal_running(b + n); n++)
+  801b95:	83 ec 0c             	sub    $0xc,%esp
+  801b98:	53                   	push   %ebx
+  801b99:	e8 e2 0b 00 00       	call   802780 <journal_running>
+			    va_is_dirty(diskaddr(b + n)) &&
+  801b9e:	83 c3 01             	add    $0x1,%ebx
+  801ba1:	83 c4 10             	add    $0x10,%esp
+  801ba4:	84 c0                	test   %al,%al
+  801ba6:	74 b1                	je     801b59 <bc_flush+0x14>
+			;
+		if (n == 0) {
+  801ba8:	85 f6                	test   %esi,%esi
+  801baa:	75 4f                	jne    801bfb <bc_flush+0xb6>
+			// Writable but never written: just protect it.
+			va = diskaddr(b);
+  801bac:	83 ec 0c             	sub    $0xc,%esp
+  801baf:	ff 75 08             	push   0x8(%ebp)
+  801bb2:	e8 dd fc ff ff       	call   801894 <diskaddr>
+  801bb7:	83 c4 10             	add    $0x10,%esp
+  801bba:	89 c3                	mov    %eax,%ebx
+			if (va_is_writable(va) && !va_is_dirty(va) &&
+  801bbc:	e8 39 fd ff ff       	call   8018fa <va_is_writable>
+  801bc1:	84 c0                	test   %al,%al
+  801bc3:	0f 84 ce 00 00 00    	je     801c97 <bc_flush+0x152>
+  801bc9:	83 ec 0c             	sub    $0xc,%esp
+  801bcc:	53                   	push   %ebx
+  801bcd:	e8 e7 fe ff ff       	call   801ab9 <va_is_dirty>
+  801bd2:	83 c4 10             	add    $0x10,%esp
+  801bd5:	84 c0                	test   %al,%al
+  801bd7:	0f 85 c1 00 00 00    	jne    801c9e <bc_flush+0x159>
+			    (r = sys_page_map(0, va, 0, va, PTE_P | PTE_U)) < 0)
+  801bdd:	83 ec 0c             	sub    $0xc,%esp
+  801be0:	6a 05                	push   $0x5
+  801be2:	53                   	push   %ebx
+  801be3:	6a 00                	push   $0x0
+  801be5:	53                   	push   %ebx
+  801be6:	6a 00                	push   $0x0
+  801be8:	e8 1e 5a 00 00       	call   80760b <sys_page_map>
+			if (va_is_writable(va) && !va_is_dirty(va) &&
+  801bed:	83 c4 20             	add    $0x20,%esp
+  801bf0:	85 c0                	test   %eax,%eax
+  801bf2:	78 41                	js     801c35 <bc_flush+0xf0>
+				panic("bc_flush: %e", r);
+			n = 1;
+  801bf4:	be 01 00 00 00       	mov    $0x1,%esi
+  801bf9:	eb 72                	jmp    801c6d <bc_flush+0x128>
+  801bfb:	89 f0                	mov    %esi,%eax
+  801bfd:	03 45 08             	add    0x8(%ebp),%eax
+  801c00:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		if (n == 0) {
+  801c03:	8b 5d 08             	mov    0x8(%ebp),%ebx
+			continue;
+		}
+
+		// Protect the blocks first: queueing the write may wait, and
+		// another worker may evict them meanwhile.
+		for (i = 0; i < n; i++)
+  801c06:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801c09:	39 c3                	cmp    %eax,%ebx
+  801c0b:	74 3d                	je     801c4a <bc_flush+0x105>
+			sysbatch_add(&bc_batch, SYS_page_map, 0,
+				     (uint32_t) diskaddr(b + i), 0,
+				     (uint32_t) diskaddr(b + i), PTE_P | PTE_U);
+  801c0d:	83 ec 0c             	sub    $0xc,%esp
+  801c10:	53                   	push   %ebx
+  801c11:	e8 7e fc ff ff       	call   801894 <diskaddr>
+  801c16:	83 c4 0c             	add    $0xc,%esp
+			sysbatch_add(&bc_batch, SYS_page_map, 0,
+  801c19:	6a 05                	push   $0x5
+  801c1b:	50                   	push   %eax
+  801c1c:	6a 00                	push   $0x0
+  801c1e:	50                   	push   %eax
+  801c1f:	6a 00                	push   $0x0
+  801c21:	6a 05                	push   $0x5
+  801c23:	68 80 5d 83 00       	push   $0x835d80
+  801c28:	e8 ee 5d 00 00       	call   807a1b <sysbatch_add>
+		for (i = 0; i < n; i++)
+  801c2d:	83 c3 01             	add    $0x1,%ebx
+  801c30:	83 c4 20             	add    $0x20,%esp
+  801c33:	eb d1                	jmp    801c06 <bc_flush+0xc1>
+				panic("bc_flush: %e", r);
+  801c35:	50                   	push   %eax
+  801c36:	68 b2 9b 80 00       	push   $0x809bb2
+  801c3b:	68 d3 01 00 00       	push   $0x1d3
+  801c40:	68 8c 9b 80 00       	push   $0x809b8c
+  801c45:	e8 86 4e 00 00       	call   806ad0 <_panic>
+		if ((r = sysbatch_flush(&bc_batch)) < 0)
+  801c4a:	83 ec 0c             	sub    $0xc,%esp
+  801c4d:	68 80 5d 83 00       	push   $0x835d80
+  801c52:	e8 74 5d 00 00       	call   8079cb <sysbatch_flush>
+  801c57:	83 c4 10             	add    $0x10,%esp
+  801c5a:	85 c0                	test   %eax,%eax
+  801c5c:	78 24                	js     801c82 <bc_flush+0x13d>
+			panic("bc_flush: %e", r);
+		bio_write(b, n);
+  801c5e:	83 ec 08             	sub    $0x8,%esp
+  801c61:	56                   	push   %esi
+  801c62:	ff 75 08             	push   0x8(%ebp)
+  801c65:	e8 cc f8 ff ff       	call   801536 <bio_write>
+  801c6a:	83 c4 10             	add    $0x10,%esp
+	for (b = blockno; b < end; b += n) {
+  801c6d:	01 75 08             	add    %esi,0x8(%ebp)
+  801c70:	39 7d 08             	cmp    %edi,0x8(%ebp)
+  801c73:	73 30                	jae    801ca5 <bc_flush+0x160>
+  801c75:	8b 5d 08             	mov    0x8(%ebp),%ebx
+		for (n = 0; b + n < end && n < BC_MAXRUN &&
+  801c78:	be 00 00 00 00       	mov    $0x0,%esi
+  801c7d:	e9 da fe ff ff       	jmp    801b5c <bc_flush+0x17>
+			panic("bc_flush: %e", r);
+  801c82:	50                   	push   %eax
+  801c83:	68 b2 9b 80 00       	push   $0x809bb2
+  801c88:	68 df 01 00 00       	push   $0x1df
+  801c8d:	68 8c 9b 80 00       	push   $0x809b8c
+  801c92:	e8 39 4e 00 00       	call   806ad0 <_panic>
+			n = 1;
+  801c97:	be 01 00 00 00       	mov    $0x1,%esi
+  801c9c:	eb cf                	jmp    801c6d <bc_flush+0x128>
+  801c9e:	be 01 00 00 00       	mov    $0x1,%esi
+  801ca3:	eb c8                	jmp    801c6d <bc_flush+0x128>
+	}
+}
+  801ca5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ca8:	5b                   	pop    %ebx
+  801ca9:	5e                   	pop    %esi
+  801caa:	5f                   	pop    %edi
+  801cab:	5d                   	pop    %ebp
+  801cac:	c3                   	ret
+
+00801cad <bc_share>:
+{
+  801cad:	55                   	push   %ebp
+  801cae:	89 e5                	mov    %esp,%ebp
+  801cb0:	56                   	push   %esi
+  801cb1:	53                   	push   %ebx
+  801cb2:	8b 75 08             	mov    0x8(%ebp),%esi
+	void *va = diskaddr(blockno);
+  801cb5:	83 ec 0c             	sub    $0xc,%esp
+  801cb8:	56                   	push   %esi
+  801cb9:	e8 d6 fb ff ff       	call   801894 <diskaddr>
+  801cbe:	83 c4 10             	add    $0x10,%esp
+  801cc1:	89 c3                	mov    %eax,%ebx
+	if (va_is_writable(va))
+  801cc3:	e8 32 fc ff ff       	call   8018fa <va_is_writable>
+  801cc8:	84 c0                	test   %al,%al
+  801cca:	75 11                	jne    801cdd <bc_share+0x30>
+	return !va_is_writable(va);
+  801ccc:	89 d8                	mov    %ebx,%eax
+  801cce:	e8 27 fc ff ff       	call   8018fa <va_is_writable>
+  801cd3:	83 f0 01             	xor    $0x1,%eax
+}
+  801cd6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cd9:	5b                   	pop    %ebx
+  801cda:	5e                   	pop    %esi
+  801cdb:	5d                   	pop    %ebp
+  801cdc:	c3                   	ret
+		bc_flush(blockno, 1);
+  801cdd:	83 ec 08             	sub    $0x8,%esp
+  801ce0:	6a 01                	push   $0x1
+  801ce2:	56                   	push   %esi
+  801ce3:	e8 5d fe ff ff       	call   801b45 <bc_flush>
+  801ce8:	83 c4 10             	add    $0x10,%esp
+  801ceb:	eb df                	jmp    801ccc <bc_share+0x1f>
+
+00801ced <bc_writeback>:
+// consecutive blocks go out together.  Takes time in the number of
+// dirty blocks, not the size of the disk or the cache.  Blocks the
+// journal holds are left for its checkpoint.
+void
+bc_writeback(void)
+{
+  801ced:	55                   	push   %ebp
+  801cee:	89 e5                	mov    %esp,%ebp
+  801cf0:	57                   	push   %edi
+  801cf1:	56                   	push   %esi
+  801cf2:	53                   	push   %ebx
+  801cf3:	83 ec 1c             	sub    $0x1c,%esp
+	uint32_t i, n, run;
+
+	n = bc_dirty_collect();
+  801cf6:	e8 33 fc ff ff       	call   80192e <bc_dirty_collect>
+  801cfb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	for (i = 0; i < n; i += run) {
+  801cfe:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d03:	eb 4b                	jmp    801d50 <bc_writeback+0x63>
+			run = 1;
+			continue;
+		}
+		for (run = 1; i + run < n && run < BC_MAXRUN &&
+			    bc_dirty[i + run] == bc_dirty[i] + run &&
+			    !journal_holds(bc_dirty[i + run]); run++)
+  801d05:	83 c3 01             	add    $0x1,%ebx
+		for (run = 1; i + run < n && run < BC_MAXRUN &&
+  801d08:	83 fb 1f             	cmp    $0x1f,%ebx
+  801d0b:	77 2e                	ja     801d3b <bc_writeback+0x4e>
+  801d0d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801d10:	39 c6                	cmp    %eax,%esi
+  801d12:	73 27                	jae    801d3b <bc_writeback+0x4e>
+			    bc_dirty[i + run] == bc_dirty[i] + run &&
+  801d14:	8b 04 b5 60 5c 81 00 	mov    0x815c60(,%esi,4),%eax
+  801d1b:	89 da                	mov    %ebx,%edx
+  801d1d:	03 14 bd 60 5c 81 00 	add    0x815c60(,%edi,4),%edx
+		for (run = 1; i + run < n && run < BC_MAXRUN &&
+  801d24:	39 d0                	cmp    %edx,%eax
+  801d26:	75 13                	jne    801d3b <bc_writeback+0x4e>
+			    !journal_holds(bc_dirty[i + run]); run++)
+  801d28:	83 ec 0c             	sub    $0xc,%esp
+  801d2b:	50                   	push   %eax
+  801d2c:	e8 80 0a 00 00       	call   8027b1 <journal_holds>
+			    bc_dirty[i + run] == bc_dirty[i] + run &&
+  801d31:	83 c6 01             	add    $0x1,%esi
+  801d34:	83 c4 10             	add    $0x10,%esp
+  801d37:	84 c0                	test   %al,%al
+  801d39:	74 ca                	je     801d05 <bc_writeback+0x18>
+			;
+		bc_flush(bc_dirty[i], run);
+  801d3b:	83 ec 08             	sub    $0x8,%esp
+  801d3e:	53                   	push   %ebx
+  801d3f:	ff 34 bd 60 5c 81 00 	push   0x815c60(,%edi,4)
+  801d46:	e8 fa fd ff ff       	call   801b45 <bc_flush>
+  801d4b:	83 c4 10             	add    $0x10,%esp
+	for (i = 0; i < n; i += run) {
+  801d4e:	01 df                	add    %ebx,%edi
+  801d50:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801d53:	39 c7                	cmp    %eax,%edi
+  801d55:	73 20                	jae    801d77 <bc_writeback+0x8a>
+		if (journal_holds(bc_dirty[i])) {
+  801d57:	83 ec 0c             	sub    $0xc,%esp
+  801d5a:	ff 34 bd 60 5c 81 00 	push   0x815c60(,%edi,4)
+  801d61:	e8 4b 0a 00 00       	call   8027b1 <journal_holds>
+  801d66:	83 c4 10             	add    $0x10,%esp
+			run = 1;
+  801d69:	bb 01 00 00 00       	mov    $0x1,%ebx
+  801d6e:	8d 77 01             	lea    0x1(%edi),%esi
+		if (journal_holds(bc_dirty[i])) {
+  801d71:	84 c0                	test   %al,%al
+  801d73:	75 d9                	jne    801d4e <bc_writeback+0x61>
+  801d75:	eb 91                	jmp    801d08 <bc_writeback+0x1b>
+	}
+	bc_ndirty = 0;
+  801d77:	c7 05 40 5c 81 00 00 	movl   $0x0,0x815c40
+  801d7e:	00 00 00 
+}
+  801d81:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d84:	5b                   	pop    %ebx
+  801d85:	5e                   	pop    %esi
+  801d86:	5f                   	pop    %edi
+  801d87:	5d                   	pop    %ebp
+  801d88:	c3                   	ret
+
+00801d89 <flush_block>:
+// necessary, then clear the PTE_D bit using sys_page_map.
+// If the block is not in the block cache or is not dirty, does
+// nothing.
+void
+flush_block(void *addr)
+{
+  801d89:	55                   	push   %ebp
+  801d8a:	89 e5                	mov    %esp,%ebp
+  801d8c:	83 ec 08             	sub    $0x8,%esp
+  801d8f:	8b 55 08             	mov    0x8(%ebp),%edx
+	uint32_t blockno = ((uint32_t)addr - DISKMAP) / BLKSIZE;
+  801d92:	8d 82 00 00 00 f0    	lea    -0x10000000(%edx),%eax
+  801d98:	89 c1                	mov    %eax,%ecx
+  801d9a:	c1 e9 0c             	shr    $0xc,%ecx
+
+	if (addr < (void*)DISKMAP || addr >= (void*)(DISKMAP + DISKSIZE))
+  801d9d:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  801da2:	77 10                	ja     801db4 <flush_block+0x2b>
+		panic("flush_block of bad va %08x", addr);
+
+	bc_flush(blockno, 1);
+  801da4:	83 ec 08             	sub    $0x8,%esp
+  801da7:	6a 01                	push   $0x1
+  801da9:	51                   	push   %ecx
+  801daa:	e8 96 fd ff ff       	call   801b45 <bc_flush>
+}
+  801daf:	83 c4 10             	add    $0x10,%esp
+  801db2:	c9                   	leave
+  801db3:	c3                   	ret
+		panic("flush_block of bad va %08x", addr);
+  801db4:	52                   	push   %edx
+  801db5:	68 bf 9b 80 00       	push   $0x809bbf
+  801dba:	68 06 02 00 00       	push   $0x206
+  801dbf:	68 8c 9b 80 00       	push   $0x809b8c
+  801dc4:	e8 07 4d 00 00       	call   806ad0 <_panic>
+
+00801dc9 <bc_reserve>:
+{
+  801dc9:	55                   	push   %ebp
+  801dca:	89 e5                	mov    %esp,%ebp
+  801dcc:	57                   	push   %edi
+  801dcd:	56                   	push   %esi
+  801dce:	53                   	push   %ebx
+  801dcf:	83 ec 1c             	sub    $0x1c,%esp
+  801dd2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	while (bc_nresident > 0 && bc_nresident + n > bc_capacity)
+  801dd5:	e9 ad 01 00 00       	jmp    801f87 <bc_reserve+0x1be>
+			bc_hand++;
+  801dda:	83 05 70 5d 82 00 01 	addl   $0x1,0x825d70
+			continue;
+  801de1:	e9 bc 01 00 00       	jmp    801fa2 <bc_reserve+0x1d9>
+		if (!va_is_mapped(va) && bio_pending(blockno)) {
+  801de6:	83 ec 0c             	sub    $0xc,%esp
+  801de9:	53                   	push   %ebx
+  801dea:	e8 dd fa ff ff       	call   8018cc <va_is_mapped>
+  801def:	83 c4 10             	add    $0x10,%esp
+  801df2:	84 c0                	test   %al,%al
+  801df4:	75 14                	jne    801e0a <bc_reserve+0x41>
+  801df6:	83 ec 0c             	sub    $0xc,%esp
+  801df9:	56                   	push   %esi
+  801dfa:	e8 29 f4 ff ff       	call   801228 <bio_pending>
+  801dff:	83 c4 10             	add    $0x10,%esp
+  801e02:	84 c0                	test   %al,%al
+  801e04:	0f 85 82 00 00 00    	jne    801e8c <bc_reserve+0xc3>
+		if (va_is_mapped(va) && (uvpt[PGNUM(va)] & PTE_A)) {
+  801e0a:	83 ec 0c             	sub    $0xc,%esp
+  801e0d:	53                   	push   %ebx
+  801e0e:	e8 b9 fa ff ff       	call   8018cc <va_is_mapped>
+  801e13:	83 c4 10             	add    $0x10,%esp
+  801e16:	84 c0                	test   %al,%al
+  801e18:	74 14                	je     801e2e <bc_reserve+0x65>
+  801e1a:	89 df                	mov    %ebx,%edi
+  801e1c:	c1 ef 0c             	shr    $0xc,%edi
+  801e1f:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+  801e26:	a8 20                	test   $0x20,%al
+  801e28:	0f 85 8d 00 00 00    	jne    801ebb <bc_reserve+0xf2>
+		if (va_is_mapped(va)) {
+  801e2e:	83 ec 0c             	sub    $0xc,%esp
+  801e31:	53                   	push   %ebx
+  801e32:	e8 95 fa ff ff       	call   8018cc <va_is_mapped>
+  801e37:	83 c4 10             	add    $0x10,%esp
+  801e3a:	84 c0                	test   %al,%al
+  801e3c:	0f 84 25 01 00 00    	je     801f67 <bc_reserve+0x19e>
+			if (va_is_dirty(va) || bio_pending(blockno)) {
+  801e42:	83 ec 0c             	sub    $0xc,%esp
+  801e45:	53                   	push   %ebx
+  801e46:	e8 6e fc ff ff       	call   801ab9 <va_is_dirty>
+  801e4b:	83 c4 10             	add    $0x10,%esp
+  801e4e:	84 c0                	test   %al,%al
+  801e50:	75 14                	jne    801e66 <bc_reserve+0x9d>
+  801e52:	83 ec 0c             	sub    $0xc,%esp
+  801e55:	56                   	push   %esi
+  801e56:	e8 cd f3 ff ff       	call   801228 <bio_pending>
+  801e5b:	83 c4 10             	add    $0x10,%esp
+  801e5e:	84 c0                	test   %al,%al
+  801e60:	0f 84 d0 00 00 00    	je     801f36 <bc_reserve+0x16d>
+				flush_block(va);
+  801e66:	83 ec 0c             	sub    $0xc,%esp
+  801e69:	53                   	push   %ebx
+  801e6a:	e8 1a ff ff ff       	call   801d89 <flush_block>
+				if ((r = bio_wait(blockno)) < 0)
+  801e6f:	89 34 24             	mov    %esi,(%esp)
+  801e72:	e8 0b f7 ff ff       	call   801582 <bio_wait>
+  801e77:	83 c4 10             	add    $0x10,%esp
+  801e7a:	85 c0                	test   %eax,%eax
+  801e7c:	0f 88 9f 00 00 00    	js     801f21 <bc_reserve+0x158>
+		nrunning = 0;
+  801e82:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e87:	e9 16 01 00 00       	jmp    801fa2 <bc_reserve+0x1d9>
+			if ((r = bio_wait(blockno)) < 0)
+  801e8c:	83 ec 0c             	sub    $0xc,%esp
+  801e8f:	56                   	push   %esi
+  801e90:	e8 ed f6 ff ff       	call   801582 <bio_wait>
+  801e95:	83 c4 10             	add    $0x10,%esp
+  801e98:	85 c0                	test   %eax,%eax
+  801e9a:	78 0a                	js     801ea6 <bc_reserve+0xdd>
+		nrunning = 0;
+  801e9c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ea1:	e9 fc 00 00 00       	jmp    801fa2 <bc_reserve+0x1d9>
+				panic("bc_evict: %e", r);
+  801ea6:	50                   	push   %eax
+  801ea7:	68 da 9b 80 00       	push   $0x809bda
+  801eac:	68 91 00 00 00       	push   $0x91
+  801eb1:	68 8c 9b 80 00       	push   $0x809b8c
+  801eb6:	e8 15 4c 00 00       	call   806ad0 <_panic>
+			if (va_is_dirty(va))
+  801ebb:	83 ec 0c             	sub    $0xc,%esp
+  801ebe:	53                   	push   %ebx
+  801ebf:	e8 f5 fb ff ff       	call   801ab9 <va_is_dirty>
+  801ec4:	83 c4 10             	add    $0x10,%esp
+  801ec7:	84 c0                	test   %al,%al
+  801ec9:	75 33                	jne    801efe <bc_reserve+0x135>
+					uvpt[PGNUM(va)] & PTE_SYSCALL)) < 0)
+  801ecb:	8b 04 bd 00 00 40 ef 	mov    -0x10c00000(,%edi,4),%eax
+			else if ((r = sys_page_map(0, va, 0, va,
+  801ed2:	83 ec 0c             	sub    $0xc,%esp
+  801ed5:	25 07 0e 00 00       	and    $0xe07,%eax
+  801eda:	50                   	push   %eax
+  801edb:	53                   	push   %ebx
+  801edc:	6a 00                	push   $0x0
+  801ede:	53                   	push   %ebx
+  801edf:	6a 00                	push   $0x0
+  801ee1:	e8 25 57 00 00       	call   80760b <sys_page_map>
+  801ee6:	83 c4 20             	add    $0x20,%esp
+  801ee9:	85 c0                	test   %eax,%eax
+  801eeb:	78 1f                	js     801f0c <bc_reserve+0x143>
+			bc_hand++;
+  801eed:	83 05 70 5d 82 00 01 	addl   $0x1,0x825d70
+		nrunning = 0;
+  801ef4:	bf 00 00 00 00       	mov    $0x0,%edi
+			continue;
+  801ef9:	e9 a4 00 00 00       	jmp    801fa2 <bc_reserve+0x1d9>
+				flush_block(va);
+  801efe:	83 ec 0c             	sub    $0xc,%esp
+  801f01:	53                   	push   %ebx
+  801f02:	e8 82 fe ff ff       	call   801d89 <flush_block>
+  801f07:	83 c4 10             	add    $0x10,%esp
+  801f0a:	eb e1                	jmp    801eed <bc_reserve+0x124>
+				panic("bc_evict: %e", r);
+  801f0c:	50                   	push   %eax
+  801f0d:	68 da 9b 80 00       	push   $0x809bda
+  801f12:	68 9c 00 00 00       	push   $0x9c
+  801f17:	68 8c 9b 80 00       	push   $0x809b8c
+  801f1c:	e8 af 4b 00 00       	call   806ad0 <_panic>
+					panic("bc_evict: %e", r);
+  801f21:	50                   	push   %eax
+  801f22:	68 da 9b 80 00       	push   $0x809bda
+  801f27:	68 a5 00 00 00       	push   $0xa5
+  801f2c:	68 8c 9b 80 00       	push   $0x809b8c
+  801f31:	e8 9a 4b 00 00       	call   806ad0 <_panic>
+			if ((r = bio_wait(blockno)) < 0)
+  801f36:	83 ec 0c             	sub    $0xc,%esp
+  801f39:	56                   	push   %esi
+  801f3a:	e8 43 f6 ff ff       	call   801582 <bio_wait>
+  801f3f:	83 c4 10             	add    $0x10,%esp
+  801f42:	85 c0                	test   %eax,%eax
+  801f44:	0f 88 b4 00 00 00    	js     801ffe <bc_reserve+0x235>
+			if ((r = sys_page_unmap(0, va)) < 0)
+  801f4a:	83 ec 08             	sub    $0x8,%esp
+  801f4d:	53                   	push   %ebx
+  801f4e:	6a 00                	push   $0x0
+  801f50:	e8 f8 56 00 00       	call   80764d <sys_page_unmap>
+  801f55:	83 c4 10             	add    $0x10,%esp
+  801f58:	85 c0                	test   %eax,%eax
+  801f5a:	0f 88 b3 00 00 00    	js     802013 <bc_reserve+0x24a>
+			bc_evictions++;
+  801f60:	83 05 64 5d 82 00 01 	addl   $0x1,0x825d64
+		bc_blocks[bc_hand] = bc_blocks[--bc_nresident];
+  801f67:	a1 74 5d 82 00       	mov    0x825d74,%eax
+  801f6c:	83 e8 01             	sub    $0x1,%eax
+  801f6f:	a3 74 5d 82 00       	mov    %eax,0x825d74
+  801f74:	8b 14 85 80 5d 82 00 	mov    0x825d80(,%eax,4),%edx
+  801f7b:	a1 70 5d 82 00       	mov    0x825d70,%eax
+  801f80:	89 14 85 80 5d 82 00 	mov    %edx,0x825d80(,%eax,4)
+	while (bc_nresident > 0 && bc_nresident + n > bc_capacity)
+  801f87:	a1 74 5d 82 00       	mov    0x825d74,%eax
+  801f8c:	85 c0                	test   %eax,%eax
+  801f8e:	74 66                	je     801ff6 <bc_reserve+0x22d>
+  801f90:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801f93:	01 c8                	add    %ecx,%eax
+  801f95:	39 05 08 b0 80 00    	cmp    %eax,0x80b008
+  801f9b:	73 59                	jae    801ff6 <bc_reserve+0x22d>
+	nrunning = 0;
+  801f9d:	bf 00 00 00 00       	mov    $0x0,%edi
+	while (bc_nresident > 0) {
+  801fa2:	a1 74 5d 82 00       	mov    0x825d74,%eax
+  801fa7:	85 c0                	test   %eax,%eax
+  801fa9:	74 4b                	je     801ff6 <bc_reserve+0x22d>
+		if (bc_hand >= bc_nresident)
+  801fab:	39 05 70 5d 82 00    	cmp    %eax,0x825d70
+  801fb1:	72 0a                	jb     801fbd <bc_reserve+0x1f4>
+			bc_hand = 0;
+  801fb3:	c7 05 70 5d 82 00 00 	movl   $0x0,0x825d70
+  801fba:	00 00 00 
+		blockno = bc_blocks[bc_hand];
+  801fbd:	a1 70 5d 82 00       	mov    0x825d70,%eax
+  801fc2:	8b 34 85 80 5d 82 00 	mov    0x825d80(,%eax,4),%esi
+		va = diskaddr(blockno);
+  801fc9:	83 ec 0c             	sub    $0xc,%esp
+  801fcc:	56                   	push   %esi
+  801fcd:	e8 c2 f8 ff ff       	call   801894 <diskaddr>
+  801fd2:	89 c3                	mov    %eax,%ebx
+		if (journal_running(blockno)) {
+  801fd4:	89 34 24             	mov    %esi,(%esp)
+  801fd7:	e8 a4 07 00 00       	call   802780 <journal_running>
+  801fdc:	83 c4 10             	add    $0x10,%esp
+  801fdf:	84 c0                	test   %al,%al
+  801fe1:	0f 84 ff fd ff ff    	je     801de6 <bc_reserve+0x1d>
+			if (++nrunning >= bc_nresident)
+  801fe7:	83 c7 01             	add    $0x1,%edi
+  801fea:	3b 3d 74 5d 82 00    	cmp    0x825d74,%edi
+  801ff0:	0f 82 e4 fd ff ff    	jb     801dda <bc_reserve+0x11>
+}
+  801ff6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ff9:	5b                   	pop    %ebx
+  801ffa:	5e                   	pop    %esi
+  801ffb:	5f                   	pop    %edi
+  801ffc:	5d                   	pop    %ebp
+  801ffd:	c3                   	ret
+				panic("bc_evict: %e", r);
+  801ffe:	50                   	push   %eax
+  801fff:	68 da 9b 80 00       	push   $0x809bda
+  802004:	68 aa 00 00 00       	push   $0xaa
+  802009:	68 8c 9b 80 00       	push   $0x809b8c
+  80200e:	e8 bd 4a 00 00       	call   806ad0 <_panic>
+				panic("bc_evict: %e", r);
+  802013:	50                   	push   %eax
+  802014:	68 da 9b 80 00       	push   $0x809bda
+  802019:	68 ac 00 00 00       	push   $0xac
+  80201e:	68 8c 9b 80 00       	push   $0x809b8c
+  802023:	e8 a8 4a 00 00       	call   806ad0 <_panic>
+
+00802028 <bc_set_capacity>:
+{
+  802028:	55                   	push   %ebp
+  802029:	89 e5                	mov    %esp,%ebp
+  80202b:	83 ec 08             	sub    $0x8,%esp
+  80202e:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (capacity < BC_MINCAPACITY || capacity > BC_MAXCAPACITY)
+  802031:	8d 50 e0             	lea    -0x20(%eax),%edx
+  802034:	81 fa e0 3f 00 00    	cmp    $0x3fe0,%edx
+  80203a:	77 16                	ja     802052 <bc_set_capacity+0x2a>
+	bc_capacity = capacity;
+  80203c:	a3 08 b0 80 00       	mov    %eax,0x80b008
+	bc_reserve(0);
+  802041:	b8 00 00 00 00       	mov    $0x0,%eax
+  802046:	e8 7e fd ff ff       	call   801dc9 <bc_reserve>
+	return 0;
+  80204b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802050:	c9                   	leave
+  802051:	c3                   	ret
+		return -E_INVAL;
+  802052:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802057:	eb f7                	jmp    802050 <bc_set_capacity+0x28>
+
+00802059 <bc_fill>:
+{
+  802059:	55                   	push   %ebp
+  80205a:	89 e5                	mov    %esp,%ebp
+  80205c:	57                   	push   %edi
+  80205d:	56                   	push   %esi
+  80205e:	53                   	push   %ebx
+  80205f:	83 ec 1c             	sub    $0x1c,%esp
+  802062:	89 c7                	mov    %eax,%edi
+	end = blockno + nblocks;
+  802064:	8d 04 10             	lea    (%eax,%edx,1),%eax
+  802067:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	nread = 0;
+  80206a:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+	for (b = blockno; b < end; b += n) {
+  802071:	eb 1d                	jmp    802090 <bc_fill+0x37>
+			bio_step();
+  802073:	e8 a0 f2 ff ff       	call   801318 <bio_step>
+			continue;
+  802078:	eb 14                	jmp    80208e <bc_fill+0x35>
+			bc_track(b + i);
+  80207a:	89 f0                	mov    %esi,%eax
+  80207c:	e8 cb f7 ff ff       	call   80184c <bc_track>
+		for (i = 0; i < n; i++)
+  802081:	83 c6 01             	add    $0x1,%esi
+  802084:	39 de                	cmp    %ebx,%esi
+  802086:	75 f2                	jne    80207a <bc_fill+0x21>
+		nread += n;
+  802088:	8b 5d dc             	mov    -0x24(%ebp),%ebx
+  80208b:	01 5d e0             	add    %ebx,-0x20(%ebp)
+	for (b = blockno; b < end; b += n) {
+  80208e:	01 df                	add    %ebx,%edi
+  802090:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802093:	39 c7                	cmp    %eax,%edi
+  802095:	73 54                	jae    8020eb <bc_fill+0x92>
+		if ((n = bc_absent(b, MIN(end - b, BC_MAXRUN))) == 0) {
+  802097:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80209a:	29 fa                	sub    %edi,%edx
+  80209c:	b8 20 00 00 00       	mov    $0x20,%eax
+  8020a1:	39 c2                	cmp    %eax,%edx
+  8020a3:	0f 47 d0             	cmova  %eax,%edx
+  8020a6:	89 f8                	mov    %edi,%eax
+  8020a8:	e8 b4 f9 ff ff       	call   801a61 <bc_absent>
+  8020ad:	89 c6                	mov    %eax,%esi
+			n = 1;
+  8020af:	bb 01 00 00 00       	mov    $0x1,%ebx
+		if ((n = bc_absent(b, MIN(end - b, BC_MAXRUN))) == 0) {
+  8020b4:	85 c0                	test   %eax,%eax
+  8020b6:	74 d6                	je     80208e <bc_fill+0x35>
+		bc_reserve(n);
+  8020b8:	e8 0c fd ff ff       	call   801dc9 <bc_reserve>
+		if ((n = bc_absent(b, n)) == 0)
+  8020bd:	89 f2                	mov    %esi,%edx
+  8020bf:	89 f8                	mov    %edi,%eax
+  8020c1:	e8 9b f9 ff ff       	call   801a61 <bc_absent>
+  8020c6:	89 c3                	mov    %eax,%ebx
+  8020c8:	85 c0                	test   %eax,%eax
+  8020ca:	74 c2                	je     80208e <bc_fill+0x35>
+		if ((n = bio_read(b, n)) == 0) {
+  8020cc:	83 ec 08             	sub    $0x8,%esp
+  8020cf:	50                   	push   %eax
+  8020d0:	57                   	push   %edi
+  8020d1:	e8 56 f3 ff ff       	call   80142c <bio_read>
+  8020d6:	89 c3                	mov    %eax,%ebx
+  8020d8:	83 c4 10             	add    $0x10,%esp
+  8020db:	85 c0                	test   %eax,%eax
+  8020dd:	74 94                	je     802073 <bc_fill+0x1a>
+  8020df:	8d 04 07             	lea    (%edi,%eax,1),%eax
+  8020e2:	89 fe                	mov    %edi,%esi
+  8020e4:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+  8020e7:	89 c3                	mov    %eax,%ebx
+  8020e9:	eb 99                	jmp    802084 <bc_fill+0x2b>
+}
+  8020eb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8020ee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020f1:	5b                   	pop    %ebx
+  8020f2:	5e                   	pop    %esi
+  8020f3:	5f                   	pop    %edi
+  8020f4:	5d                   	pop    %ebp
+  8020f5:	c3                   	ret
+
+008020f6 <bc_read>:
+{
+  8020f6:	55                   	push   %ebp
+  8020f7:	89 e5                	mov    %esp,%ebp
+  8020f9:	57                   	push   %edi
+  8020fa:	56                   	push   %esi
+  8020fb:	53                   	push   %ebx
+  8020fc:	83 ec 0c             	sub    $0xc,%esp
+  8020ff:	8b 75 08             	mov    0x8(%ebp),%esi
+  802102:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	nread = bc_fill(blockno, nblocks);
+  802105:	89 fa                	mov    %edi,%edx
+  802107:	89 f0                	mov    %esi,%eax
+  802109:	e8 4b ff ff ff       	call   802059 <bc_fill>
+	bc_misses += nread;
+  80210e:	01 05 68 5d 82 00    	add    %eax,0x825d68
+	bc_hits += nblocks - nread;
+  802114:	89 fa                	mov    %edi,%edx
+  802116:	29 c2                	sub    %eax,%edx
+  802118:	01 15 6c 5d 82 00    	add    %edx,0x825d6c
+	for (b = blockno; b < blockno + nblocks; b++)
+  80211e:	89 f3                	mov    %esi,%ebx
+  802120:	01 fe                	add    %edi,%esi
+  802122:	eb 03                	jmp    802127 <bc_read+0x31>
+  802124:	83 c3 01             	add    $0x1,%ebx
+  802127:	39 f3                	cmp    %esi,%ebx
+  802129:	73 35                	jae    802160 <bc_read+0x6a>
+		if (bio_pending(b) && (r = bio_wait(b)) < 0)
+  80212b:	83 ec 0c             	sub    $0xc,%esp
+  80212e:	53                   	push   %ebx
+  80212f:	e8 f4 f0 ff ff       	call   801228 <bio_pending>
+  802134:	83 c4 10             	add    $0x10,%esp
+  802137:	84 c0                	test   %al,%al
+  802139:	74 e9                	je     802124 <bc_read+0x2e>
+  80213b:	83 ec 0c             	sub    $0xc,%esp
+  80213e:	53                   	push   %ebx
+  80213f:	e8 3e f4 ff ff       	call   801582 <bio_wait>
+  802144:	83 c4 10             	add    $0x10,%esp
+  802147:	85 c0                	test   %eax,%eax
+  802149:	79 d9                	jns    802124 <bc_read+0x2e>
+			panic("bc_read: %e", r);
+  80214b:	50                   	push   %eax
+  80214c:	68 e7 9b 80 00       	push   $0x809be7
+  802151:	68 90 01 00 00       	push   $0x190
+  802156:	68 8c 9b 80 00       	push   $0x809b8c
+  80215b:	e8 70 49 00 00       	call   806ad0 <_panic>
+}
+  802160:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802163:	5b                   	pop    %ebx
+  802164:	5e                   	pop    %esi
+  802165:	5f                   	pop    %edi
+  802166:	5d                   	pop    %ebp
+  802167:	c3                   	ret
+
+00802168 <bc_prefetch>:
+{
+  802168:	55                   	push   %ebp
+  802169:	89 e5                	mov    %esp,%ebp
+  80216b:	83 ec 08             	sub    $0x8,%esp
+	bc_readahead += bc_fill(blockno, nblocks);
+  80216e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802171:	8b 45 08             	mov    0x8(%ebp),%eax
+  802174:	e8 e0 fe ff ff       	call   802059 <bc_fill>
+  802179:	01 05 60 5d 82 00    	add    %eax,0x825d60
+}
+  80217f:	c9                   	leave
+  802180:	c3                   	ret
+
+00802181 <bc_zero>:
+{
+  802181:	55                   	push   %ebp
+  802182:	89 e5                	mov    %esp,%ebp
+  802184:	57                   	push   %edi
+  802185:	56                   	push   %esi
+  802186:	53                   	push   %ebx
+  802187:	83 ec 1c             	sub    $0x1c,%esp
+	end = blockno + nblocks;
+  80218a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80218d:	03 5d 0c             	add    0xc(%ebp),%ebx
+	for (b = blockno; b < end; b += n) {
+  802190:	89 5d e4             	mov    %ebx,-0x1c(%ebp)
+  802193:	e9 c8 00 00 00       	jmp    802260 <bc_zero+0xdf>
+			if (!va_is_mapped(va)) {
+  802198:	83 ec 0c             	sub    $0xc,%esp
+  80219b:	53                   	push   %ebx
+  80219c:	e8 2b f7 ff ff       	call   8018cc <va_is_mapped>
+  8021a1:	83 c4 10             	add    $0x10,%esp
+  8021a4:	84 c0                	test   %al,%al
+  8021a6:	75 22                	jne    8021ca <bc_zero+0x49>
+				if ((r = sys_page_alloc(0, va,
+  8021a8:	83 ec 04             	sub    $0x4,%esp
+  8021ab:	6a 07                	push   $0x7
+  8021ad:	53                   	push   %ebx
+  8021ae:	6a 00                	push   $0x0
+  8021b0:	e8 13 54 00 00       	call   8075c8 <sys_page_alloc>
+  8021b5:	83 c4 10             	add    $0x10,%esp
+  8021b8:	85 c0                	test   %eax,%eax
+  8021ba:	78 7b                	js     802237 <bc_zero+0xb6>
+				bc_track(b + i);
+  8021bc:	89 f0                	mov    %esi,%eax
+  8021be:	e8 89 f6 ff ff       	call   80184c <bc_track>
+				bc_dirty_add(b + i);
+  8021c3:	89 f0                	mov    %esi,%eax
+  8021c5:	e8 48 f8 ff ff       	call   801a12 <bc_dirty_add>
+			memset(va, 0, BLKSIZE);
+  8021ca:	83 ec 04             	sub    $0x4,%esp
+  8021cd:	68 00 10 00 00       	push   $0x1000
+  8021d2:	6a 00                	push   $0x0
+  8021d4:	53                   	push   %ebx
+  8021d5:	e8 10 51 00 00       	call   8072ea <memset>
+		for (i = 0; i < n; i++) {
+  8021da:	83 c6 01             	add    $0x1,%esi
+  8021dd:	83 c4 10             	add    $0x10,%esp
+  8021e0:	39 fe                	cmp    %edi,%esi
+  8021e2:	74 68                	je     80224c <bc_zero+0xcb>
+			va = diskaddr(b + i);
+  8021e4:	83 ec 0c             	sub    $0xc,%esp
+  8021e7:	56                   	push   %esi
+  8021e8:	e8 a7 f6 ff ff       	call   801894 <diskaddr>
+  8021ed:	89 c3                	mov    %eax,%ebx
+			if (!va_is_mapped(va) && bio_pending(b + i) &&
+  8021ef:	89 04 24             	mov    %eax,(%esp)
+  8021f2:	e8 d5 f6 ff ff       	call   8018cc <va_is_mapped>
+  8021f7:	83 c4 10             	add    $0x10,%esp
+  8021fa:	84 c0                	test   %al,%al
+  8021fc:	75 9a                	jne    802198 <bc_zero+0x17>
+  8021fe:	83 ec 0c             	sub    $0xc,%esp
+  802201:	56                   	push   %esi
+  802202:	e8 21 f0 ff ff       	call   801228 <bio_pending>
+  802207:	83 c4 10             	add    $0x10,%esp
+  80220a:	84 c0                	test   %al,%al
+  80220c:	74 8a                	je     802198 <bc_zero+0x17>
+			    (r = bio_wait(b + i)) < 0)
+  80220e:	83 ec 0c             	sub    $0xc,%esp
+  802211:	56                   	push   %esi
+  802212:	e8 6b f3 ff ff       	call   801582 <bio_wait>
+			if (!va_is_mapped(va) && bio_pending(b + i) &&
+  802217:	83 c4 10             	add    $0x10,%esp
+  80221a:	85 c0                	test   %eax,%eax
+  80221c:	0f 89 76 ff ff ff    	jns    802198 <bc_zero+0x17>
+				panic("bc_zero: %e", r);
+  802222:	50                   	push   %eax
+  802223:	68 f3 9b 80 00       	push   $0x809bf3
+  802228:	68 ad 01 00 00       	push   $0x1ad
+  80222d:	68 8c 9b 80 00       	push   $0x809b8c
+  802232:	e8 99 48 00 00       	call   806ad0 <_panic>
+					panic("bc_zero: %e", r);
+  802237:	50                   	push   %eax
+  802238:	68 f3 9b 80 00       	push   $0x809bf3
+  80223d:	68 b1 01 00 00       	push   $0x1b1
+  802242:	68 8c 9b 80 00       	push   $0x809b8c
+  802247:	e8 84 48 00 00       	call   806ad0 <_panic>
+		bc_flush(b, n);
+  80224c:	83 ec 08             	sub    $0x8,%esp
+  80224f:	ff 75 e0             	push   -0x20(%ebp)
+  802252:	ff 75 08             	push   0x8(%ebp)
+  802255:	e8 eb f8 ff ff       	call   801b45 <bc_flush>
+  80225a:	83 c4 10             	add    $0x10,%esp
+	for (b = blockno; b < end; b += n) {
+  80225d:	89 7d 08             	mov    %edi,0x8(%ebp)
+  802260:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802263:	39 45 08             	cmp    %eax,0x8(%ebp)
+  802266:	73 25                	jae    80228d <bc_zero+0x10c>
+		n = MIN(end - b, BC_MAXRUN);
+  802268:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80226b:	2b 55 08             	sub    0x8(%ebp),%edx
+  80226e:	b8 20 00 00 00       	mov    $0x20,%eax
+  802273:	39 c2                	cmp    %eax,%edx
+  802275:	0f 46 c2             	cmovbe %edx,%eax
+  802278:	89 c7                	mov    %eax,%edi
+  80227a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+		bc_reserve(n);
+  80227d:	e8 47 fb ff ff       	call   801dc9 <bc_reserve>
+		for (i = 0; i < n; i++) {
+  802282:	03 7d 08             	add    0x8(%ebp),%edi
+  802285:	8b 75 08             	mov    0x8(%ebp),%esi
+  802288:	e9 53 ff ff ff       	jmp    8021e0 <bc_zero+0x5f>
+}
+  80228d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802290:	5b                   	pop    %ebx
+  802291:	5e                   	pop    %esi
+  802292:	5f                   	pop    %edi
+  802293:	5d                   	pop    %ebp
+  802294:	c3                   	ret
+
+00802295 <bc_pgfault>:
+{
+  802295:	55                   	push   %ebp
+  802296:	89 e5                	mov    %esp,%ebp
+  802298:	57                   	push   %edi
+  802299:	56                   	push   %esi
+  80229a:	53                   	push   %ebx
+  80229b:	83 ec 0c             	sub    $0xc,%esp
+  80229e:	8b 7d 08             	mov    0x8(%ebp),%edi
+	void *addr = (void *) utf->utf_fault_va;
+  8022a1:	8b 17                	mov    (%edi),%edx
+	uint32_t blockno = ((uint32_t)addr - DISKMAP) / BLKSIZE;
+  8022a3:	8d 82 00 00 00 f0    	lea    -0x10000000(%edx),%eax
+  8022a9:	89 c3                	mov    %eax,%ebx
+  8022ab:	c1 eb 0c             	shr    $0xc,%ebx
+	if (addr < (void*)DISKMAP || addr >= (void*)(DISKMAP + DISKSIZE))
+  8022ae:	3d ff ff ff bf       	cmp    $0xbfffffff,%eax
+  8022b3:	0f 87 89 00 00 00    	ja     802342 <bc_pgfault+0xad>
+	if (super && blockno >= super->s_nblocks)
+  8022b9:	a1 88 3f 84 00       	mov    0x843f88,%eax
+  8022be:	85 c0                	test   %eax,%eax
+  8022c0:	74 09                	je     8022cb <bc_pgfault+0x36>
+  8022c2:	3b 58 04             	cmp    0x4(%eax),%ebx
+  8022c5:	0f 83 95 00 00 00    	jae    802360 <bc_pgfault+0xcb>
+	if ((utf->utf_err & (FEC_PR | FEC_WR)) == (FEC_PR | FEC_WR)) {
+  8022cb:	8b 47 04             	mov    0x4(%edi),%eax
+  8022ce:	83 e0 03             	and    $0x3,%eax
+  addr = ROUNDDOWN(addr, PGSIZE);
+  8022d1:	89 d6                	mov    %edx,%esi
+  8022d3:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if ((utf->utf_err & (FEC_PR | FEC_WR)) == (FEC_PR | FEC_WR)) {
+  8022d9:	83 f8 03             	cmp    $0x3,%eax
+  8022dc:	0f 85 3b 01 00 00    	jne    80241d <bc_pgfault+0x188>
+		bio_cancel(blockno);
+  8022e2:	83 ec 0c             	sub    $0xc,%esp
+  8022e5:	53                   	push   %ebx
+  8022e6:	e8 52 ef ff ff       	call   80123d <bio_cancel>
+		if ((r = bio_wait(blockno)) < 0)
+  8022eb:	89 1c 24             	mov    %ebx,(%esp)
+  8022ee:	e8 8f f2 ff ff       	call   801582 <bio_wait>
+  8022f3:	83 c4 10             	add    $0x10,%esp
+  8022f6:	85 c0                	test   %eax,%eax
+  8022f8:	78 7b                	js     802375 <bc_pgfault+0xe0>
+		bc_dirty_add(blockno);
+  8022fa:	89 d8                	mov    %ebx,%eax
+  8022fc:	e8 11 f7 ff ff       	call   801a12 <bc_dirty_add>
+		if (pageref(addr) > 1)
+  802301:	83 ec 0c             	sub    $0xc,%esp
+  802304:	56                   	push   %esi
+  802305:	e8 6e 69 00 00       	call   808c78 <pageref>
+  80230a:	83 c4 10             	add    $0x10,%esp
+  80230d:	83 f8 01             	cmp    $0x1,%eax
+  802310:	7f 78                	jg     80238a <bc_pgfault+0xf5>
+		else if ((r = sys_page_map(0, addr, 0, addr,
+  802312:	83 ec 0c             	sub    $0xc,%esp
+  802315:	6a 07                	push   $0x7
+  802317:	56                   	push   %esi
+  802318:	6a 00                	push   $0x0
+  80231a:	56                   	push   %esi
+  80231b:	6a 00                	push   $0x0
+  80231d:	e8 e9 52 00 00       	call   80760b <sys_page_map>
+  802322:	83 c4 20             	add    $0x20,%esp
+  802325:	85 c0                	test   %eax,%eax
+  802327:	0f 89 6a 01 00 00    	jns    802497 <bc_pgfault+0x202>
+			panic("in bc_pgfault, sys_page_map: %e", r);
+  80232d:	50                   	push   %eax
+  80232e:	68 48 9b 80 00       	push   $0x809b48
+  802333:	68 2c 01 00 00       	push   $0x12c
+  802338:	68 8c 9b 80 00       	push   $0x809b8c
+  80233d:	e8 8e 47 00 00       	call   806ad0 <_panic>
+		panic("page fault in FS: eip %08x, va %08x, err %04x",
+  802342:	83 ec 08             	sub    $0x8,%esp
+  802345:	ff 77 04             	push   0x4(%edi)
+  802348:	52                   	push   %edx
+  802349:	ff 77 28             	push   0x28(%edi)
+  80234c:	68 f4 9a 80 00       	push   $0x809af4
+  802351:	68 17 01 00 00       	push   $0x117
+  802356:	68 8c 9b 80 00       	push   $0x809b8c
+  80235b:	e8 70 47 00 00       	call   806ad0 <_panic>
+		panic("reading non-existent block %08x\n", blockno);
+  802360:	53                   	push   %ebx
+  802361:	68 24 9b 80 00       	push   $0x809b24
+  802366:	68 1c 01 00 00       	push   $0x11c
+  80236b:	68 8c 9b 80 00       	push   $0x809b8c
+  802370:	e8 5b 47 00 00       	call   806ad0 <_panic>
+			panic("in bc_pgfault, bio_wait: %e", r);
+  802375:	50                   	push   %eax
+  802376:	68 ff 9b 80 00       	push   $0x809bff
+  80237b:	68 26 01 00 00       	push   $0x126
+  802380:	68 8c 9b 80 00       	push   $0x809b8c
+  802385:	e8 46 47 00 00       	call   806ad0 <_panic>
+	if ((r = sys_page_alloc(0, UTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  80238a:	83 ec 04             	sub    $0x4,%esp
+  80238d:	6a 07                	push   $0x7
+  80238f:	68 00 00 40 00       	push   $0x400000
+  802394:	6a 00                	push   $0x0
+  802396:	e8 2d 52 00 00       	call   8075c8 <sys_page_alloc>
+  80239b:	83 c4 10             	add    $0x10,%esp
+  80239e:	85 c0                	test   %eax,%eax
+  8023a0:	78 5f                	js     802401 <bc_pgfault+0x16c>
+	memmove(UTEMP, va, BLKSIZE);
+  8023a2:	83 ec 04             	sub    $0x4,%esp
+  8023a5:	68 00 10 00 00       	push   $0x1000
+  8023aa:	56                   	push   %esi
+  8023ab:	68 00 00 40 00       	push   $0x400000
+  8023b0:	e8 6a 4f 00 00       	call   80731f <memmove>
+	if ((r = sys_page_map(0, UTEMP, 0, va, PTE_P | PTE_U | PTE_W)) < 0 ||
+  8023b5:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8023bc:	56                   	push   %esi
+  8023bd:	6a 00                	push   $0x0
+  8023bf:	68 00 00 40 00       	push   $0x400000
+  8023c4:	6a 00                	push   $0x0
+  8023c6:	e8 40 52 00 00       	call   80760b <sys_page_map>
+  8023cb:	83 c4 20             	add    $0x20,%esp
+  8023ce:	85 c0                	test   %eax,%eax
+  8023d0:	78 1a                	js     8023ec <bc_pgfault+0x157>
+	    (r = sys_page_unmap(0, UTEMP)) < 0)
+  8023d2:	83 ec 08             	sub    $0x8,%esp
+  8023d5:	68 00 00 40 00       	push   $0x400000
+  8023da:	6a 00                	push   $0x0
+  8023dc:	e8 6c 52 00 00       	call   80764d <sys_page_unmap>
+	if ((r = sys_page_map(0, UTEMP, 0, va, PTE_P | PTE_U | PTE_W)) < 0 ||
+  8023e1:	83 c4 10             	add    $0x10,%esp
+  8023e4:	85 c0                	test   %eax,%eax
+  8023e6:	0f 89 ab 00 00 00    	jns    802497 <bc_pgfault+0x202>
+		panic("bc_unshare: %e", r);
+  8023ec:	50                   	push   %eax
+  8023ed:	68 1b 9c 80 00       	push   $0x809c1b
+  8023f2:	68 09 01 00 00       	push   $0x109
+  8023f7:	68 8c 9b 80 00       	push   $0x809b8c
+  8023fc:	e8 cf 46 00 00       	call   806ad0 <_panic>
+		panic("bc_unshare: %e", r);
+  802401:	50                   	push   %eax
+  802402:	68 1b 9c 80 00       	push   $0x809c1b
+  802407:	68 05 01 00 00       	push   $0x105
+  80240c:	68 8c 9b 80 00       	push   $0x809b8c
+  802411:	e8 ba 46 00 00       	call   806ad0 <_panic>
+      bc_track(blockno);
+  802416:	89 d8                	mov    %ebx,%eax
+  802418:	e8 2f f4 ff ff       	call   80184c <bc_track>
+  while (!va_is_mapped(addr) && !bio_pending(blockno)) {
+  80241d:	83 ec 0c             	sub    $0xc,%esp
+  802420:	56                   	push   %esi
+  802421:	e8 a6 f4 ff ff       	call   8018cc <va_is_mapped>
+  802426:	83 c4 10             	add    $0x10,%esp
+  802429:	84 c0                	test   %al,%al
+  80242b:	75 54                	jne    802481 <bc_pgfault+0x1ec>
+  80242d:	83 ec 0c             	sub    $0xc,%esp
+  802430:	53                   	push   %ebx
+  802431:	e8 f2 ed ff ff       	call   801228 <bio_pending>
+  802436:	83 c4 10             	add    $0x10,%esp
+  802439:	84 c0                	test   %al,%al
+  80243b:	75 44                	jne    802481 <bc_pgfault+0x1ec>
+    bc_reserve(1);
+  80243d:	b8 01 00 00 00       	mov    $0x1,%eax
+  802442:	e8 82 f9 ff ff       	call   801dc9 <bc_reserve>
+    if (va_is_mapped(addr) || bio_pending(blockno))
+  802447:	83 ec 0c             	sub    $0xc,%esp
+  80244a:	56                   	push   %esi
+  80244b:	e8 7c f4 ff ff       	call   8018cc <va_is_mapped>
+  802450:	83 c4 10             	add    $0x10,%esp
+  802453:	84 c0                	test   %al,%al
+  802455:	75 2a                	jne    802481 <bc_pgfault+0x1ec>
+  802457:	83 ec 0c             	sub    $0xc,%esp
+  80245a:	53                   	push   %ebx
+  80245b:	e8 c8 ed ff ff       	call   801228 <bio_pending>
+  802460:	83 c4 10             	add    $0x10,%esp
+  802463:	84 c0                	test   %al,%al
+  802465:	75 1a                	jne    802481 <bc_pgfault+0x1ec>
+    if (bio_read(blockno, 1) == 1)
+  802467:	83 ec 08             	sub    $0x8,%esp
+  80246a:	6a 01                	push   $0x1
+  80246c:	53                   	push   %ebx
+  80246d:	e8 ba ef ff ff       	call   80142c <bio_read>
+  802472:	83 c4 10             	add    $0x10,%esp
+  802475:	83 f8 01             	cmp    $0x1,%eax
+  802478:	74 9c                	je     802416 <bc_pgfault+0x181>
+      bio_step();
+  80247a:	e8 99 ee ff ff       	call   801318 <bio_step>
+  80247f:	eb 9c                	jmp    80241d <bc_pgfault+0x188>
+  if ((r = bio_wait(blockno)) < 0)
+  802481:	83 ec 0c             	sub    $0xc,%esp
+  802484:	53                   	push   %ebx
+  802485:	e8 f8 f0 ff ff       	call   801582 <bio_wait>
+  80248a:	83 c4 10             	add    $0x10,%esp
+  80248d:	85 c0                	test   %eax,%eax
+  80248f:	78 0e                	js     80249f <bc_pgfault+0x20a>
+  if (utf->utf_err & FEC_WR) {
+  802491:	f6 47 04 02          	testb  $0x2,0x4(%edi)
+  802495:	75 1d                	jne    8024b4 <bc_pgfault+0x21f>
+}
+  802497:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80249a:	5b                   	pop    %ebx
+  80249b:	5e                   	pop    %esi
+  80249c:	5f                   	pop    %edi
+  80249d:	5d                   	pop    %ebp
+  80249e:	c3                   	ret
+    panic("bc_pgfault: %e\n", r);
+  80249f:	50                   	push   %eax
+  8024a0:	68 2a 9c 80 00       	push   $0x809c2a
+  8024a5:	68 47 01 00 00       	push   $0x147
+  8024aa:	68 8c 9b 80 00       	push   $0x809b8c
+  8024af:	e8 1c 46 00 00       	call   806ad0 <_panic>
+    bc_dirty_add(blockno);
+  8024b4:	89 d8                	mov    %ebx,%eax
+  8024b6:	e8 57 f5 ff ff       	call   801a12 <bc_dirty_add>
+    if ((r = sys_page_map(0, addr, 0, addr, PTE_P | PTE_U | PTE_W)) < 0)
+  8024bb:	83 ec 0c             	sub    $0xc,%esp
+  8024be:	6a 07                	push   $0x7
+  8024c0:	56                   	push   %esi
+  8024c1:	6a 00                	push   $0x0
+  8024c3:	56                   	push   %esi
+  8024c4:	6a 00                	push   $0x0
+  8024c6:	e8 40 51 00 00       	call   80760b <sys_page_map>
+  8024cb:	83 c4 20             	add    $0x20,%esp
+  8024ce:	85 c0                	test   %eax,%eax
+  8024d0:	79 c5                	jns    802497 <bc_pgfault+0x202>
+      panic("in bc_pgfault, sys_page_map: %e", r);
+  8024d2:	50                   	push   %eax
+  8024d3:	68 48 9b 80 00       	push   $0x809b48
+  8024d8:	68 4d 01 00 00       	push   $0x14d
+  8024dd:	68 8c 9b 80 00       	push   $0x809b8c
+  8024e2:	e8 e9 45 00 00       	call   806ad0 <_panic>
+
+008024e7 <bc_init>:
+	cprintf("block cache is good\n");
+}
+
+void
+bc_init(void)
+{
+  8024e7:	55                   	push   %ebp
+  8024e8:	89 e5                	mov    %esp,%ebp
+  8024ea:	81 ec 44 02 00 00    	sub    $0x244,%esp
+	struct Super super;
+	set_pgfault_handler(bc_pgfault);
+  8024f0:	68 95 22 80 00       	push   $0x802295
+  8024f5:	e8 7d 55 00 00       	call   807a77 <set_pgfault_handler>
+	memmove(&backup, diskaddr(1), sizeof backup);
+  8024fa:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  802501:	e8 8e f3 ff ff       	call   801894 <diskaddr>
+  802506:	83 c4 0c             	add    $0xc,%esp
+  802509:	68 14 01 00 00       	push   $0x114
+  80250e:	50                   	push   %eax
+  80250f:	8d 85 d0 fd ff ff    	lea    -0x230(%ebp),%eax
+  802515:	50                   	push   %eax
+  802516:	e8 04 4e 00 00       	call   80731f <memmove>
+	strcpy(diskaddr(1), "OOPS!\n");
+  80251b:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  802522:	e8 6d f3 ff ff       	call   801894 <diskaddr>
+  802527:	83 c4 08             	add    $0x8,%esp
+  80252a:	68 3a 9c 80 00       	push   $0x809c3a
+  80252f:	50                   	push   %eax
+  802530:	e8 64 4c 00 00       	call   807199 <strcpy>
+	flush_block(diskaddr(1));
+  802535:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  80253c:	e8 53 f3 ff ff       	call   801894 <diskaddr>
+  802541:	89 04 24             	mov    %eax,(%esp)
+  802544:	e8 40 f8 ff ff       	call   801d89 <flush_block>
+	assert(va_is_mapped(diskaddr(1)));
+  802549:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  802550:	e8 3f f3 ff ff       	call   801894 <diskaddr>
+  802555:	89 04 24             	mov    %eax,(%esp)
+  802558:	e8 6f f3 ff ff       	call   8018cc <va_is_mapped>
+  80255d:	83 c4 10             	add    $0x10,%esp
+  802560:	84 c0                	test   %al,%al
+  802562:	0f 84 de 00 00 00    	je     802646 <bc_init+0x15f>
+	assert(!va_is_dirty(diskaddr(1)));
+  802568:	83 ec 0c             	sub    $0xc,%esp
+  80256b:	6a 01                	push   $0x1
+  80256d:	e8 22 f3 ff ff       	call   801894 <diskaddr>
+  802572:	89 04 24             	mov    %eax,(%esp)
+  802575:	e8 3f f5 ff ff       	call   801ab9 <va_is_dirty>
+  80257a:	83 c4 10             	add    $0x10,%esp
+  80257d:	84 c0                	test   %al,%al
+  80257f:	0f 85 da 00 00 00    	jne    80265f <bc_init+0x178>
+	bio_sync();
+  802585:	e8 3f f0 ff ff       	call   8015c9 <bio_sync>
+	sys_page_unmap(0, diskaddr(1));
+  80258a:	83 ec 0c             	sub    $0xc,%esp
+  80258d:	6a 01                	push   $0x1
+  80258f:	e8 00 f3 ff ff       	call   801894 <diskaddr>
+  802594:	83 c4 08             	add    $0x8,%esp
+  802597:	50                   	push   %eax
+  802598:	6a 00                	push   $0x0
+  80259a:	e8 ae 50 00 00       	call   80764d <sys_page_unmap>
+	assert(!va_is_mapped(diskaddr(1)));
+  80259f:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  8025a6:	e8 e9 f2 ff ff       	call   801894 <diskaddr>
+  8025ab:	89 04 24             	mov    %eax,(%esp)
+  8025ae:	e8 19 f3 ff ff       	call   8018cc <va_is_mapped>
+  8025b3:	83 c4 10             	add    $0x10,%esp
+  8025b6:	84 c0                	test   %al,%al
+  8025b8:	0f 85 ba 00 00 00    	jne    802678 <bc_init+0x191>
+	assert(strcmp(diskaddr(1), "OOPS!\n") == 0);
+  8025be:	83 ec 0c             	sub    $0xc,%esp
+  8025c1:	6a 01                	push   $0x1
+  8025c3:	e8 cc f2 ff ff       	call   801894 <diskaddr>
+  8025c8:	83 c4 08             	add    $0x8,%esp
+  8025cb:	68 3a 9c 80 00       	push   $0x809c3a
+  8025d0:	50                   	push   %eax
+  8025d1:	e8 74 4c 00 00       	call   80724a <strcmp>
+  8025d6:	83 c4 10             	add    $0x10,%esp
+  8025d9:	85 c0                	test   %eax,%eax
+  8025db:	0f 85 b0 00 00 00    	jne    802691 <bc_init+0x1aa>
+	memmove(diskaddr(1), &backup, sizeof backup);
+  8025e1:	83 ec 0c             	sub    $0xc,%esp
+  8025e4:	6a 01                	push   $0x1
+  8025e6:	e8 a9 f2 ff ff       	call   801894 <diskaddr>
+  8025eb:	83 c4 0c             	add    $0xc,%esp
+  8025ee:	68 14 01 00 00       	push   $0x114
+  8025f3:	8d 95 d0 fd ff ff    	lea    -0x230(%ebp),%edx
+  8025f9:	52                   	push   %edx
+  8025fa:	50                   	push   %eax
+  8025fb:	e8 1f 4d 00 00       	call   80731f <memmove>
+	flush_block(diskaddr(1));
+  802600:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  802607:	e8 88 f2 ff ff       	call   801894 <diskaddr>
+  80260c:	89 04 24             	mov    %eax,(%esp)
+  80260f:	e8 75 f7 ff ff       	call   801d89 <flush_block>
+	cprintf("block cache is good\n");
+  802614:	c7 04 24 76 9c 80 00 	movl   $0x809c76,(%esp)
+  80261b:	e8 8b 45 00 00       	call   806bab <cprintf>
+	check_bc();
+
+	// cache the super block by reading it once
+	memmove(&super, diskaddr(1), sizeof super);
+  802620:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  802627:	e8 68 f2 ff ff       	call   801894 <diskaddr>
+  80262c:	83 c4 0c             	add    $0xc,%esp
+  80262f:	68 14 01 00 00       	push   $0x114
+  802634:	50                   	push   %eax
+  802635:	8d 85 e4 fe ff ff    	lea    -0x11c(%ebp),%eax
+  80263b:	50                   	push   %eax
+  80263c:	e8 de 4c 00 00       	call   80731f <memmove>
+}
+  802641:	83 c4 10             	add    $0x10,%esp
+  802644:	c9                   	leave
+  802645:	c3                   	ret
+	assert(va_is_mapped(diskaddr(1)));
+  802646:	68 5c 9c 80 00       	push   $0x809c5c
+  80264b:	68 2e 99 80 00       	push   $0x80992e
+  802650:	68 19 02 00 00       	push   $0x219
+  802655:	68 8c 9b 80 00       	push   $0x809b8c
+  80265a:	e8 71 44 00 00       	call   806ad0 <_panic>
+	assert(!va_is_dirty(diskaddr(1)));
+  80265f:	68 41 9c 80 00       	push   $0x809c41
+  802664:	68 2e 99 80 00       	push   $0x80992e
+  802669:	68 1a 02 00 00       	push   $0x21a
+  80266e:	68 8c 9b 80 00       	push   $0x809b8c
+  802673:	e8 58 44 00 00       	call   806ad0 <_panic>
+	assert(!va_is_mapped(diskaddr(1)));
+  802678:	68 5b 9c 80 00       	push   $0x809c5b
+  80267d:	68 2e 99 80 00       	push   $0x80992e
+  802682:	68 1f 02 00 00       	push   $0x21f
+  802687:	68 8c 9b 80 00       	push   $0x809b8c
+  80268c:	e8 3f 44 00 00       	call   806ad0 <_panic>
+	assert(strcmp(diskaddr(1), "OOPS!\n") == 0);
+  802691:	68 68 9b 80 00       	push   $0x809b68
+  802696:	68 2e 99 80 00       	push   $0x80992e
+  80269b:	68 22 02 00 00       	push   $0x222
+  8026a0:	68 8c 9b 80 00       	push   $0x809b8c
+  8026a5:	e8 26 44 00 00       	call   806ad0 <_panic>
+
+008026aa <jn_writable>:
+
+// Map journal blocks [b, b+n) writable, for the commit to fill in.
+// They are pinned in the cache, so they are always mapped.
+static void
+jn_writable(uint32_t b, uint32_t n)
+{
+  8026aa:	55                   	push   %ebp
+  8026ab:	89 e5                	mov    %esp,%ebp
+  8026ad:	57                   	push   %edi
+  8026ae:	56                   	push   %esi
+  8026af:	53                   	push   %ebx
+  8026b0:	83 ec 0c             	sub    $0xc,%esp
+  8026b3:	89 c3                	mov    %eax,%ebx
+	uint32_t i;
+	int r;
+
+	for (i = 0; i < n; i++)
+  8026b5:	8d 3c 02             	lea    (%edx,%eax,1),%edi
+  8026b8:	eb 30                	jmp    8026ea <jn_writable+0x40>
+		sysbatch_add(&jn_batch, SYS_page_map, 0,
+			     (uint32_t) diskaddr(b + i), 0,
+			     (uint32_t) diskaddr(b + i), PTE_P | PTE_U | PTE_W);
+  8026ba:	83 ec 0c             	sub    $0xc,%esp
+  8026bd:	53                   	push   %ebx
+  8026be:	e8 d1 f1 ff ff       	call   801894 <diskaddr>
+  8026c3:	89 c6                	mov    %eax,%esi
+			     (uint32_t) diskaddr(b + i), 0,
+  8026c5:	89 1c 24             	mov    %ebx,(%esp)
+  8026c8:	e8 c7 f1 ff ff       	call   801894 <diskaddr>
+		sysbatch_add(&jn_batch, SYS_page_map, 0,
+  8026cd:	83 c4 0c             	add    $0xc,%esp
+  8026d0:	6a 07                	push   $0x7
+  8026d2:	56                   	push   %esi
+  8026d3:	6a 00                	push   $0x0
+  8026d5:	50                   	push   %eax
+  8026d6:	6a 00                	push   $0x0
+  8026d8:	6a 05                	push   $0x5
+  8026da:	68 a0 64 83 00       	push   $0x8364a0
+  8026df:	e8 37 53 00 00       	call   807a1b <sysbatch_add>
+	for (i = 0; i < n; i++)
+  8026e4:	83 c3 01             	add    $0x1,%ebx
+  8026e7:	83 c4 20             	add    $0x20,%esp
+  8026ea:	39 fb                	cmp    %edi,%ebx
+  8026ec:	75 cc                	jne    8026ba <jn_writable+0x10>
+	if ((r = sysbatch_flush(&jn_batch)) < 0)
+  8026ee:	83 ec 0c             	sub    $0xc,%esp
+  8026f1:	68 a0 64 83 00       	push   $0x8364a0
+  8026f6:	e8 d0 52 00 00       	call   8079cb <sysbatch_flush>
+  8026fb:	83 c4 10             	add    $0x10,%esp
+  8026fe:	85 c0                	test   %eax,%eax
+  802700:	78 08                	js     80270a <jn_writable+0x60>
+		panic("journal: %e", r);
+}
+  802702:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802705:	5b                   	pop    %ebx
+  802706:	5e                   	pop    %esi
+  802707:	5f                   	pop    %edi
+  802708:	5d                   	pop    %ebp
+  802709:	c3                   	ret
+		panic("journal: %e", r);
+  80270a:	50                   	push   %eax
+  80270b:	68 8b 9c 80 00       	push   $0x809c8b
+  802710:	6a 5d                	push   $0x5d
+  802712:	68 97 9c 80 00       	push   $0x809c97
+  802717:	e8 b4 43 00 00       	call   806ad0 <_panic>
+
+0080271c <jn_write_header>:
+
+// Write the header, naming jn_seq as the first transaction, and wait.
+static void
+jn_write_header(void)
+{
+  80271c:	55                   	push   %ebp
+  80271d:	89 e5                	mov    %esp,%ebp
+  80271f:	53                   	push   %ebx
+  802720:	83 ec 10             	sub    $0x10,%esp
+	struct JournalHeader *jh = diskaddr(jn_start);
+  802723:	ff 35 f0 73 83 00    	push   0x8373f0
+  802729:	e8 66 f1 ff ff       	call   801894 <diskaddr>
+  80272e:	89 c3                	mov    %eax,%ebx
+	int r;
+
+	jn_writable(jn_start, 1);
+  802730:	ba 01 00 00 00       	mov    $0x1,%edx
+  802735:	a1 f0 73 83 00       	mov    0x8373f0,%eax
+  80273a:	e8 6b ff ff ff       	call   8026aa <jn_writable>
+	jh->jh_magic = JOURNAL_MAGIC;
+  80273f:	c7 03 48 4c 4e 4a    	movl   $0x4a4e4c48,(%ebx)
+	jh->jh_seq = jn_seq;
+  802745:	a1 e0 73 83 00       	mov    0x8373e0,%eax
+  80274a:	89 43 04             	mov    %eax,0x4(%ebx)
+	bc_flush(jn_start, 1);
+  80274d:	83 c4 08             	add    $0x8,%esp
+  802750:	6a 01                	push   $0x1
+  802752:	ff 35 f0 73 83 00    	push   0x8373f0
+  802758:	e8 e8 f3 ff ff       	call   801b45 <bc_flush>
+	if ((r = bio_sync()) < 0)
+  80275d:	e8 67 ee ff ff       	call   8015c9 <bio_sync>
+  802762:	83 c4 10             	add    $0x10,%esp
+  802765:	85 c0                	test   %eax,%eax
+  802767:	78 05                	js     80276e <jn_write_header+0x52>
+		panic("journal: %e", r);
+}
+  802769:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80276c:	c9                   	leave
+  80276d:	c3                   	ret
+		panic("journal: %e", r);
+  80276e:	50                   	push   %eax
+  80276f:	68 8b 9c 80 00       	push   $0x809c8b
+  802774:	6a 6c                	push   $0x6c
+  802776:	68 97 9c 80 00       	push   $0x809c97
+  80277b:	e8 50 43 00 00       	call   806ad0 <_panic>
+
+00802780 <journal_running>:
+{
+  802780:	55                   	push   %ebp
+  802781:	89 e5                	mov    %esp,%ebp
+  802783:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	return jn_find(jn_running, jn_nrunning, blockno);
+  802786:	8b 15 c0 6f 83 00    	mov    0x836fc0,%edx
+	for (i = 0; i < n; i++)
+  80278c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802791:	eb 03                	jmp    802796 <journal_running+0x16>
+  802793:	83 c0 01             	add    $0x1,%eax
+  802796:	39 c2                	cmp    %eax,%edx
+  802798:	74 10                	je     8027aa <journal_running+0x2a>
+		if (list[i] == blockno)
+  80279a:	3b 0c 85 e0 6f 83 00 	cmp    0x836fe0(,%eax,4),%ecx
+  8027a1:	75 f0                	jne    802793 <journal_running+0x13>
+			return 1;
+  8027a3:	b8 01 00 00 00       	mov    $0x1,%eax
+	return jn_find(jn_running, jn_nrunning, blockno);
+  8027a8:	eb 05                	jmp    8027af <journal_running+0x2f>
+	return 0;
+  8027aa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8027af:	5d                   	pop    %ebp
+  8027b0:	c3                   	ret
+
+008027b1 <journal_holds>:
+{
+  8027b1:	55                   	push   %ebp
+  8027b2:	89 e5                	mov    %esp,%ebp
+  8027b4:	53                   	push   %ebx
+  8027b5:	83 ec 10             	sub    $0x10,%esp
+  8027b8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	return journal_running(blockno) ||
+  8027bb:	53                   	push   %ebx
+  8027bc:	e8 bf ff ff ff       	call   802780 <journal_running>
+  8027c1:	83 c4 10             	add    $0x10,%esp
+  8027c4:	ba 01 00 00 00       	mov    $0x1,%edx
+  8027c9:	84 c0                	test   %al,%al
+  8027cb:	75 25                	jne    8027f2 <journal_holds+0x41>
+		jn_find(jn_logged, jn_nlogged, blockno);
+  8027cd:	8b 0d a8 6b 83 00    	mov    0x836ba8,%ecx
+	for (i = 0; i < n; i++)
+  8027d3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027d8:	eb 03                	jmp    8027dd <journal_holds+0x2c>
+  8027da:	83 c2 01             	add    $0x1,%edx
+  8027dd:	39 d1                	cmp    %edx,%ecx
+  8027df:	74 0e                	je     8027ef <journal_holds+0x3e>
+		if (list[i] == blockno)
+  8027e1:	3b 1c 95 c0 6b 83 00 	cmp    0x836bc0(,%edx,4),%ebx
+  8027e8:	75 f0                	jne    8027da <journal_holds+0x29>
+			return 1;
+  8027ea:	b8 01 00 00 00       	mov    $0x1,%eax
+	return journal_running(blockno) ||
+  8027ef:	0f b6 d0             	movzbl %al,%edx
+  8027f2:	89 d0                	mov    %edx,%eax
+  8027f4:	83 e0 01             	and    $0x1,%eax
+}
+  8027f7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027fa:	c9                   	leave
+  8027fb:	c3                   	ret
+
+008027fc <journal_checkpoint>:
+journal_checkpoint(void)
+{
+	uint32_t i;
+	int r;
+
+	if (jn_start == 0 || jn_nlogged == 0)
+  8027fc:	83 3d f0 73 83 00 00 	cmpl   $0x0,0x8373f0
+  802803:	0f 84 8f 00 00 00    	je     802898 <journal_checkpoint+0x9c>
+  802809:	83 3d a8 6b 83 00 00 	cmpl   $0x0,0x836ba8
+  802810:	0f 84 82 00 00 00    	je     802898 <journal_checkpoint+0x9c>
+{
+  802816:	55                   	push   %ebp
+  802817:	89 e5                	mov    %esp,%ebp
+  802819:	53                   	push   %ebx
+  80281a:	83 ec 04             	sub    $0x4,%esp
+		return;
+	assert(jn_nrunning == 0);
+  80281d:	8b 1d c0 6f 83 00    	mov    0x836fc0,%ebx
+  802823:	85 db                	test   %ebx,%ebx
+  802825:	74 2d                	je     802854 <journal_checkpoint+0x58>
+  802827:	68 a4 9c 80 00       	push   $0x809ca4
+  80282c:	68 2e 99 80 00       	push   $0x80992e
+  802831:	6a 79                	push   $0x79
+  802833:	68 97 9c 80 00       	push   $0x809c97
+  802838:	e8 93 42 00 00       	call   806ad0 <_panic>
+
+	// A logged block that isn't dirty (or cached) any more was
+	// written home by eviction.
+	for (i = 0; i < jn_nlogged; i++)
+		bc_flush(jn_logged[i], 1);
+  80283d:	83 ec 08             	sub    $0x8,%esp
+  802840:	6a 01                	push   $0x1
+  802842:	ff 34 9d c0 6b 83 00 	push   0x836bc0(,%ebx,4)
+  802849:	e8 f7 f2 ff ff       	call   801b45 <bc_flush>
+	for (i = 0; i < jn_nlogged; i++)
+  80284e:	83 c3 01             	add    $0x1,%ebx
+  802851:	83 c4 10             	add    $0x10,%esp
+  802854:	3b 1d a8 6b 83 00    	cmp    0x836ba8,%ebx
+  80285a:	72 e1                	jb     80283d <journal_checkpoint+0x41>
+	if ((r = bio_sync()) < 0)
+  80285c:	e8 68 ed ff ff       	call   8015c9 <bio_sync>
+  802861:	85 c0                	test   %eax,%eax
+  802863:	78 1e                	js     802883 <journal_checkpoint+0x87>
+		panic("journal_checkpoint: %e", r);
+	jn_nlogged = 0;
+  802865:	c7 05 a8 6b 83 00 00 	movl   $0x0,0x836ba8
+  80286c:	00 00 00 
+
+	jn_head = 1;
+  80286f:	c7 05 e4 73 83 00 01 	movl   $0x1,0x8373e4
+  802876:	00 00 00 
+	jn_write_header();
+  802879:	e8 9e fe ff ff       	call   80271c <jn_write_header>
+}
+  80287e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802881:	c9                   	leave
+  802882:	c3                   	ret
+		panic("journal_checkpoint: %e", r);
+  802883:	50                   	push   %eax
+  802884:	68 b5 9c 80 00       	push   $0x809cb5
+  802889:	68 80 00 00 00       	push   $0x80
+  80288e:	68 97 9c 80 00       	push   $0x809c97
+  802893:	e8 38 42 00 00       	call   806ad0 <_panic>
+  802898:	c3                   	ret
+
+00802899 <journal_commit>:
+
+// Commit, once another worker's commit, which waits for the disk with
+// fs_lock let go, is done.  That may leave nothing to commit.
+void
+journal_commit(void)
+{
+  802899:	55                   	push   %ebp
+  80289a:	89 e5                	mov    %esp,%ebp
+  80289c:	57                   	push   %edi
+  80289d:	56                   	push   %esi
+  80289e:	53                   	push   %ebx
+  80289f:	83 ec 1c             	sub    $0x1c,%esp
+	while (jn_committing)
+  8028a2:	eb 05                	jmp    8028a9 <journal_commit+0x10>
+		fs_yield();
+  8028a4:	e8 9a e6 ff ff       	call   800f43 <fs_yield>
+	while (jn_committing)
+  8028a9:	0f b6 05 a4 6b 83 00 	movzbl 0x836ba4,%eax
+  8028b0:	84 c0                	test   %al,%al
+  8028b2:	75 f0                	jne    8028a4 <journal_commit+0xb>
+	jn_committing = 1;
+  8028b4:	88 45 e3             	mov    %al,-0x1d(%ebp)
+  8028b7:	c6 05 a4 6b 83 00 01 	movb   $0x1,0x836ba4
+	if (jn_start == 0) {
+  8028be:	83 3d f0 73 83 00 00 	cmpl   $0x0,0x8373f0
+  8028c5:	74 18                	je     8028df <journal_commit+0x46>
+	if (jn_nrunning == 0)
+  8028c7:	83 3d c0 6f 83 00 00 	cmpl   $0x0,0x836fc0
+  8028ce:	75 16                	jne    8028e6 <journal_commit+0x4d>
+	jn_commit();
+	jn_committing = 0;
+  8028d0:	c6 05 a4 6b 83 00 00 	movb   $0x0,0x836ba4
+}
+  8028d7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028da:	5b                   	pop    %ebx
+  8028db:	5e                   	pop    %esi
+  8028dc:	5f                   	pop    %edi
+  8028dd:	5d                   	pop    %ebp
+  8028de:	c3                   	ret
+		bc_writeback();
+  8028df:	e8 09 f4 ff ff       	call   801ced <bc_writeback>
+		return;
+  8028e4:	eb ea                	jmp    8028d0 <journal_commit+0x37>
+	bc_writeback();
+  8028e6:	e8 02 f4 ff ff       	call   801ced <bc_writeback>
+	if ((r = bio_sync()) < 0)
+  8028eb:	e8 d9 ec ff ff       	call   8015c9 <bio_sync>
+  8028f0:	85 c0                	test   %eax,%eax
+  8028f2:	0f 88 be 00 00 00    	js     8029b6 <journal_commit+0x11d>
+	n = jn_nrunning;
+  8028f8:	8b 3d c0 6f 83 00    	mov    0x836fc0,%edi
+	assert(jn_head + 1 + n <= 1 + jn_nlog);
+  8028fe:	a1 e4 73 83 00       	mov    0x8373e4,%eax
+  802903:	8d 4c 07 01          	lea    0x1(%edi,%eax,1),%ecx
+  802907:	8b 35 ec 73 83 00    	mov    0x8373ec,%esi
+  80290d:	8d 56 01             	lea    0x1(%esi),%edx
+  802910:	39 ca                	cmp    %ecx,%edx
+  802912:	0f 82 b3 00 00 00    	jb     8029cb <journal_commit+0x132>
+	jn_writable(jn_start + jn_head, 1 + n);
+  802918:	8d 57 01             	lea    0x1(%edi),%edx
+  80291b:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80291e:	03 05 f0 73 83 00    	add    0x8373f0,%eax
+  802924:	e8 81 fd ff ff       	call   8026aa <jn_writable>
+	jd = diskaddr(jn_start + jn_head);
+  802929:	83 ec 0c             	sub    $0xc,%esp
+  80292c:	a1 e4 73 83 00       	mov    0x8373e4,%eax
+  802931:	03 05 f0 73 83 00    	add    0x8373f0,%eax
+  802937:	50                   	push   %eax
+  802938:	e8 57 ef ff ff       	call   801894 <diskaddr>
+  80293d:	89 c6                	mov    %eax,%esi
+  80293f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	memset(jd, 0, BLKSIZE);
+  802942:	83 c4 0c             	add    $0xc,%esp
+  802945:	68 00 10 00 00       	push   $0x1000
+  80294a:	6a 00                	push   $0x0
+  80294c:	50                   	push   %eax
+  80294d:	e8 98 49 00 00       	call   8072ea <memset>
+	jd->jd_magic = JDESC_MAGIC;
+  802952:	c7 06 53 45 44 4a    	movl   $0x4a444553,(%esi)
+	jd->jd_seq = jn_seq;
+  802958:	a1 e0 73 83 00       	mov    0x8373e0,%eax
+  80295d:	89 46 08             	mov    %eax,0x8(%esi)
+	jd->jd_n = n;
+  802960:	89 7e 0c             	mov    %edi,0xc(%esi)
+	for (i = 0; i < n; i++) {
+  802963:	83 c4 10             	add    $0x10,%esp
+  802966:	be 00 00 00 00       	mov    $0x0,%esi
+  80296b:	39 f7                	cmp    %esi,%edi
+  80296d:	74 75                	je     8029e4 <journal_commit+0x14b>
+		jd->jd_blocks[i] = jn_running[i];
+  80296f:	8b 04 b5 e0 6f 83 00 	mov    0x836fe0(,%esi,4),%eax
+  802976:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802979:	89 44 b1 10          	mov    %eax,0x10(%ecx,%esi,4)
+			diskaddr(jn_running[i]), BLKSIZE);
+  80297d:	83 ec 0c             	sub    $0xc,%esp
+  802980:	50                   	push   %eax
+  802981:	e8 0e ef ff ff       	call   801894 <diskaddr>
+  802986:	89 c3                	mov    %eax,%ebx
+		memmove(diskaddr(jn_start + jn_head + 1 + i),
+  802988:	a1 e4 73 83 00       	mov    0x8373e4,%eax
+  80298d:	03 05 f0 73 83 00    	add    0x8373f0,%eax
+  802993:	8d 44 06 01          	lea    0x1(%esi,%eax,1),%eax
+  802997:	89 04 24             	mov    %eax,(%esp)
+  80299a:	e8 f5 ee ff ff       	call   801894 <diskaddr>
+  80299f:	83 c4 0c             	add    $0xc,%esp
+  8029a2:	68 00 10 00 00       	push   $0x1000
+  8029a7:	53                   	push   %ebx
+  8029a8:	50                   	push   %eax
+  8029a9:	e8 71 49 00 00       	call   80731f <memmove>
+	for (i = 0; i < n; i++) {
+  8029ae:	83 c6 01             	add    $0x1,%esi
+  8029b1:	83 c4 10             	add    $0x10,%esp
+  8029b4:	eb b5                	jmp    80296b <journal_commit+0xd2>
+		panic("journal_commit: %e", r);
+  8029b6:	50                   	push   %eax
+  8029b7:	68 cc 9c 80 00       	push   $0x809ccc
+  8029bc:	68 9d 00 00 00       	push   $0x9d
+  8029c1:	68 97 9c 80 00       	push   $0x809c97
+  8029c6:	e8 05 41 00 00       	call   806ad0 <_panic>
+	assert(jn_head + 1 + n <= 1 + jn_nlog);
+  8029cb:	68 38 9d 80 00       	push   $0x809d38
+  8029d0:	68 2e 99 80 00       	push   $0x80992e
+  8029d5:	68 a0 00 00 00       	push   $0xa0
+  8029da:	68 97 9c 80 00       	push   $0x809c97
+  8029df:	e8 ec 40 00 00       	call   806ad0 <_panic>
+	sum = journal_sum(0, &jd->jd_seq, BLKSIZE / 4 - 2);
+  8029e4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8029e7:	8d 47 08             	lea    0x8(%edi),%eax
+static inline uint32_t
+journal_sum(uint32_t sum, const void *p, uint32_t nwords)
+{
+  const uint32_t *w = p;
+
+  while (nwords-- > 0)
+  8029ea:	8d 97 00 10 00 00    	lea    0x1000(%edi),%edx
+  8029f0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029f5:	39 d0                	cmp    %edx,%eax
+  8029f7:	74 0b                	je     802a04 <journal_commit+0x16b>
+    sum = ((sum << 5) | (sum >> 27)) + *w++;
+  8029f9:	c1 c3 05             	rol    $0x5,%ebx
+  8029fc:	83 c0 04             	add    $0x4,%eax
+  8029ff:	03 58 fc             	add    -0x4(%eax),%ebx
+  802a02:	eb f1                	jmp    8029f5 <journal_commit+0x15c>
+	for (i = 0; i < n; i++)
+  802a04:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a09:	eb 10                	jmp    802a1b <journal_commit+0x182>
+  802a0b:	c1 c3 05             	rol    $0x5,%ebx
+  802a0e:	83 c0 04             	add    $0x4,%eax
+  802a11:	03 58 fc             	add    -0x4(%eax),%ebx
+  while (nwords-- > 0)
+  802a14:	39 d0                	cmp    %edx,%eax
+  802a16:	75 f3                	jne    802a0b <journal_commit+0x172>
+  802a18:	83 c7 01             	add    $0x1,%edi
+  802a1b:	39 fe                	cmp    %edi,%esi
+  802a1d:	74 23                	je     802a42 <journal_commit+0x1a9>
+		sum = journal_sum(sum, diskaddr(jn_start + jn_head + 1 + i),
+  802a1f:	83 ec 0c             	sub    $0xc,%esp
+  802a22:	a1 e4 73 83 00       	mov    0x8373e4,%eax
+  802a27:	03 05 f0 73 83 00    	add    0x8373f0,%eax
+  802a2d:	8d 44 07 01          	lea    0x1(%edi,%eax,1),%eax
+  802a31:	50                   	push   %eax
+  802a32:	e8 5d ee ff ff       	call   801894 <diskaddr>
+  802a37:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  802a3d:	83 c4 10             	add    $0x10,%esp
+  802a40:	eb d2                	jmp    802a14 <journal_commit+0x17b>
+	jd->jd_sum = sum;
+  802a42:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802a45:	89 58 04             	mov    %ebx,0x4(%eax)
+	bc_flush(jn_start + jn_head, 1 + n);
+  802a48:	83 ec 08             	sub    $0x8,%esp
+  802a4b:	ff 75 dc             	push   -0x24(%ebp)
+  802a4e:	a1 e4 73 83 00       	mov    0x8373e4,%eax
+  802a53:	03 05 f0 73 83 00    	add    0x8373f0,%eax
+  802a59:	50                   	push   %eax
+  802a5a:	e8 e6 f0 ff ff       	call   801b45 <bc_flush>
+	if ((r = bio_sync()) < 0)
+  802a5f:	e8 65 eb ff ff       	call   8015c9 <bio_sync>
+  802a64:	83 c4 10             	add    $0x10,%esp
+  802a67:	85 c0                	test   %eax,%eax
+  802a69:	78 12                	js     802a7d <journal_commit+0x1e4>
+  802a6b:	8b 15 a8 6b 83 00    	mov    0x836ba8,%edx
+	for (i = 0; i < n; i++)
+  802a71:	bb 00 00 00 00       	mov    $0x0,%ebx
+			jn_logged[jn_nlogged++] = jn_running[i];
+  802a76:	bf 01 00 00 00       	mov    $0x1,%edi
+  802a7b:	eb 6f                	jmp    802aec <journal_commit+0x253>
+		panic("journal_commit: %e", r);
+  802a7d:	50                   	push   %eax
+  802a7e:	68 cc 9c 80 00       	push   $0x809ccc
+  802a83:	68 b4 00 00 00       	push   $0xb4
+  802a88:	68 97 9c 80 00       	push   $0x809c97
+  802a8d:	e8 3e 40 00 00       	call   806ad0 <_panic>
+  802a92:	80 7d e3 00          	cmpb   $0x0,-0x1d(%ebp)
+  802a96:	74 06                	je     802a9e <journal_commit+0x205>
+  802a98:	89 15 a8 6b 83 00    	mov    %edx,0x836ba8
+	jn_nrunning = 0;
+  802a9e:	c7 05 c0 6f 83 00 00 	movl   $0x0,0x836fc0
+  802aa5:	00 00 00 
+	jn_head += 1 + n;
+  802aa8:	03 35 e4 73 83 00    	add    0x8373e4,%esi
+  802aae:	8d 46 01             	lea    0x1(%esi),%eax
+  802ab1:	a3 e4 73 83 00       	mov    %eax,0x8373e4
+	jn_seq++;
+  802ab6:	83 05 e0 73 83 00 01 	addl   $0x1,0x8373e0
+	if (1 + jn_nlog - jn_head < jn_nlog / 2)
+  802abd:	a1 ec 73 83 00       	mov    0x8373ec,%eax
+  802ac2:	89 c2                	mov    %eax,%edx
+  802ac4:	29 f2                	sub    %esi,%edx
+  802ac6:	d1 e8                	shr    %eax
+  802ac8:	39 c2                	cmp    %eax,%edx
+  802aca:	0f 83 00 fe ff ff    	jae    8028d0 <journal_commit+0x37>
+		journal_checkpoint();
+  802ad0:	e8 27 fd ff ff       	call   8027fc <journal_checkpoint>
+  802ad5:	e9 f6 fd ff ff       	jmp    8028d0 <journal_commit+0x37>
+			jn_logged[jn_nlogged++] = jn_running[i];
+  802ada:	89 0c 95 c0 6b 83 00 	mov    %ecx,0x836bc0(,%edx,4)
+  802ae1:	8d 52 01             	lea    0x1(%edx),%edx
+  802ae4:	89 f8                	mov    %edi,%eax
+  802ae6:	88 45 e3             	mov    %al,-0x1d(%ebp)
+	for (i = 0; i < n; i++)
+  802ae9:	83 c3 01             	add    $0x1,%ebx
+  802aec:	39 de                	cmp    %ebx,%esi
+  802aee:	74 a2                	je     802a92 <journal_commit+0x1f9>
+		if (!jn_find(jn_logged, jn_nlogged, jn_running[i]))
+  802af0:	8b 0c 9d e0 6f 83 00 	mov    0x836fe0(,%ebx,4),%ecx
+	for (i = 0; i < n; i++)
+  802af7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802afc:	39 c2                	cmp    %eax,%edx
+  802afe:	74 da                	je     802ada <journal_commit+0x241>
+		if (list[i] == blockno)
+  802b00:	3b 0c 85 c0 6b 83 00 	cmp    0x836bc0(,%eax,4),%ecx
+  802b07:	74 e0                	je     802ae9 <journal_commit+0x250>
+	for (i = 0; i < n; i++)
+  802b09:	83 c0 01             	add    $0x1,%eax
+  802b0c:	eb ee                	jmp    802afc <journal_commit+0x263>
+
+00802b0e <journal_dirty>:
+// metadata blocks than that (converting a big file to block pointers)
+// fills the transaction; it is committed then as a last resort, which
+// splits the request across two transactions.
+void
+journal_dirty(void *va)
+{
+  802b0e:	55                   	push   %ebp
+  802b0f:	89 e5                	mov    %esp,%ebp
+  802b11:	56                   	push   %esi
+  802b12:	53                   	push   %ebx
+  802b13:	8b 75 08             	mov    0x8(%ebp),%esi
+	uint32_t blockno = ((uint32_t) va - DISKMAP) / BLKSIZE;
+
+	if (jn_start == 0 || journal_running(blockno))
+  802b16:	83 3d f0 73 83 00 00 	cmpl   $0x0,0x8373f0
+  802b1d:	74 3e                	je     802b5d <journal_dirty+0x4f>
+	uint32_t blockno = ((uint32_t) va - DISKMAP) / BLKSIZE;
+  802b1f:	8d 9e 00 00 00 f0    	lea    -0x10000000(%esi),%ebx
+  802b25:	c1 eb 0c             	shr    $0xc,%ebx
+	if (jn_start == 0 || journal_running(blockno))
+  802b28:	83 ec 0c             	sub    $0xc,%esp
+  802b2b:	53                   	push   %ebx
+  802b2c:	e8 4f fc ff ff       	call   802780 <journal_running>
+  802b31:	83 c4 10             	add    $0x10,%esp
+  802b34:	84 c0                	test   %al,%al
+  802b36:	75 25                	jne    802b5d <journal_dirty+0x4f>
+		return;
+
+	// Running blocks stay cached until they commit (bc_evict passes
+	// them over), so the commit can copy them without faulting.
+	(void) *(volatile char *) va;
+  802b38:	0f b6 06             	movzbl (%esi),%eax
+
+	if (jn_nrunning == jn_maxtx) {
+  802b3b:	a1 e8 73 83 00       	mov    0x8373e8,%eax
+  802b40:	39 05 c0 6f 83 00    	cmp    %eax,0x836fc0
+  802b46:	74 1c                	je     802b64 <journal_dirty+0x56>
+		cprintf("journal: request too big for one transaction\n");
+		journal_commit();
+	}
+	jn_running[jn_nrunning++] = blockno;
+  802b48:	a1 c0 6f 83 00       	mov    0x836fc0,%eax
+  802b4d:	8d 50 01             	lea    0x1(%eax),%edx
+  802b50:	89 15 c0 6f 83 00    	mov    %edx,0x836fc0
+  802b56:	89 1c 85 e0 6f 83 00 	mov    %ebx,0x836fe0(,%eax,4)
+}
+  802b5d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b60:	5b                   	pop    %ebx
+  802b61:	5e                   	pop    %esi
+  802b62:	5d                   	pop    %ebp
+  802b63:	c3                   	ret
+		cprintf("journal: request too big for one transaction\n");
+  802b64:	83 ec 0c             	sub    $0xc,%esp
+  802b67:	68 58 9d 80 00       	push   $0x809d58
+  802b6c:	e8 3a 40 00 00       	call   806bab <cprintf>
+		journal_commit();
+  802b71:	e8 23 fd ff ff       	call   802899 <journal_commit>
+  802b76:	83 c4 10             	add    $0x10,%esp
+  802b79:	eb cd                	jmp    802b48 <journal_dirty+0x3a>
+
+00802b7b <journal_full>:
+// current request, rather than waiting for the writeback timer?  Past
+// this, the next request might not fit.
+bool
+journal_full(void)
+{
+	return jn_start != 0 && jn_nrunning >= jn_maxtx / 4;
+  802b7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b80:	83 3d f0 73 83 00 00 	cmpl   $0x0,0x8373f0
+  802b87:	74 14                	je     802b9d <journal_full+0x22>
+  802b89:	a1 e8 73 83 00       	mov    0x8373e8,%eax
+  802b8e:	c1 e8 02             	shr    $0x2,%eax
+  802b91:	39 05 c0 6f 83 00    	cmp    %eax,0x836fc0
+  802b97:	0f 93 c0             	setae  %al
+  802b9a:	0f b6 c0             	movzbl %al,%eax
+  802b9d:	83 e0 01             	and    $0x1,%eax
+}
+  802ba0:	c3                   	ret
+
+00802ba1 <journal_init>:
+
+// Find the journal, replay it, and start a new one.  Call with super
+// set, before anything reads the bitmap or the files.
+void
+journal_init(void)
+{
+  802ba1:	55                   	push   %ebp
+  802ba2:	89 e5                	mov    %esp,%ebp
+  802ba4:	57                   	push   %edi
+  802ba5:	56                   	push   %esi
+  802ba6:	53                   	push   %ebx
+  802ba7:	83 ec 1c             	sub    $0x1c,%esp
+	uint32_t ntx;
+
+	if (super->s_journal == 0 || super->s_njournal < 2) {
+  802baa:	a1 88 3f 84 00       	mov    0x843f88,%eax
+  802baf:	8b 88 0c 01 00 00    	mov    0x10c(%eax),%ecx
+  802bb5:	85 c9                	test   %ecx,%ecx
+  802bb7:	74 70                	je     802c29 <journal_init+0x88>
+  802bb9:	8b 80 10 01 00 00    	mov    0x110(%eax),%eax
+  802bbf:	83 f8 01             	cmp    $0x1,%eax
+  802bc2:	76 65                	jbe    802c29 <journal_init+0x88>
+		cprintf("warning: no journal, metadata is written in place\n");
+		return;
+	}
+	jn_start = super->s_journal;
+  802bc4:	89 0d f0 73 83 00    	mov    %ecx,0x8373f0
+	jn_nlog = MIN(super->s_njournal, JN_MAXLOG) - 1;
+  802bca:	ba 00 01 00 00       	mov    $0x100,%edx
+  802bcf:	39 d0                	cmp    %edx,%eax
+  802bd1:	0f 46 d0             	cmovbe %eax,%edx
+  802bd4:	8d 42 ff             	lea    -0x1(%edx),%eax
+  802bd7:	a3 ec 73 83 00       	mov    %eax,0x8373ec
+	// A commit takes a descriptor too, and starts with at least half
+	// the journal free (jn_commit checkpoints otherwise).
+	jn_maxtx = MAX(jn_nlog / 2, 2) - 1;
+  802bdc:	d1 e8                	shr    %eax
+  802bde:	bb 02 00 00 00       	mov    $0x2,%ebx
+  802be3:	39 d8                	cmp    %ebx,%eax
+  802be5:	0f 42 c3             	cmovb  %ebx,%eax
+  802be8:	83 e8 01             	sub    $0x1,%eax
+  802beb:	a3 e8 73 83 00       	mov    %eax,0x8373e8
+
+	// The journal is pinned in the cache; read it in one go.
+	bc_read(jn_start, 1 + jn_nlog);
+  802bf0:	83 ec 08             	sub    $0x8,%esp
+  802bf3:	52                   	push   %edx
+  802bf4:	51                   	push   %ecx
+  802bf5:	e8 fc f4 ff ff       	call   8020f6 <bc_read>
+	jh = diskaddr(jn_start);
+  802bfa:	83 c4 04             	add    $0x4,%esp
+  802bfd:	ff 35 f0 73 83 00    	push   0x8373f0
+  802c03:	e8 8c ec ff ff       	call   801894 <diskaddr>
+	if (jh->jh_magic != JOURNAL_MAGIC)
+  802c08:	83 c4 10             	add    $0x10,%esp
+  802c0b:	81 38 48 4c 4e 4a    	cmpl   $0x4a4e4c48,(%eax)
+  802c11:	75 2e                	jne    802c41 <journal_init+0xa0>
+	jn_seq = jh->jh_seq;
+  802c13:	8b 50 04             	mov    0x4(%eax),%edx
+	ntx = 0;
+  802c16:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+	for (b = 1; b < 1 + jn_nlog; b += 1 + jd->jd_n) {
+  802c1d:	c7 45 e4 01 00 00 00 	movl   $0x1,-0x1c(%ebp)
+  802c24:	e9 1f 01 00 00       	jmp    802d48 <journal_init+0x1a7>
+		cprintf("warning: no journal, metadata is written in place\n");
+  802c29:	83 ec 0c             	sub    $0xc,%esp
+  802c2c:	68 88 9d 80 00       	push   $0x809d88
+  802c31:	e8 75 3f 00 00       	call   806bab <cprintf>
+		return;
+  802c36:	83 c4 10             	add    $0x10,%esp
+	if ((ntx = jn_replay()) > 0)
+		cprintf("journal: replayed %d transactions\n", ntx);
+	jn_head = 1;
+	jn_write_header();
+	cprintf("journal is good\n");
+}
+  802c39:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c3c:	5b                   	pop    %ebx
+  802c3d:	5e                   	pop    %esi
+  802c3e:	5f                   	pop    %edi
+  802c3f:	5d                   	pop    %ebp
+  802c40:	c3                   	ret
+		panic("bad journal magic number");
+  802c41:	83 ec 04             	sub    $0x4,%esp
+  802c44:	68 df 9c 80 00       	push   $0x809cdf
+  802c49:	68 fd 00 00 00       	push   $0xfd
+  802c4e:	68 97 9c 80 00       	push   $0x809c97
+  802c53:	e8 78 3e 00 00       	call   806ad0 <_panic>
+		for (i = 0; i < jd->jd_n; i++)
+  802c58:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c5d:	eb 10                	jmp    802c6f <journal_init+0xce>
+    sum = ((sum << 5) | (sum >> 27)) + *w++;
+  802c5f:	c1 c3 05             	rol    $0x5,%ebx
+  802c62:	83 c0 04             	add    $0x4,%eax
+  802c65:	03 58 fc             	add    -0x4(%eax),%ebx
+  while (nwords-- > 0)
+  802c68:	39 d0                	cmp    %edx,%eax
+  802c6a:	75 f3                	jne    802c5f <journal_init+0xbe>
+  802c6c:	83 c7 01             	add    $0x1,%edi
+  802c6f:	3b 7e 0c             	cmp    0xc(%esi),%edi
+  802c72:	73 22                	jae    802c96 <journal_init+0xf5>
+			sum = journal_sum(sum, diskaddr(jn_start + b + 1 + i),
+  802c74:	83 ec 0c             	sub    $0xc,%esp
+  802c77:	a1 f0 73 83 00       	mov    0x8373f0,%eax
+  802c7c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802c7f:	8d 44 01 01          	lea    0x1(%ecx,%eax,1),%eax
+  802c83:	01 f8                	add    %edi,%eax
+  802c85:	50                   	push   %eax
+  802c86:	e8 09 ec ff ff       	call   801894 <diskaddr>
+  802c8b:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  802c91:	83 c4 10             	add    $0x10,%esp
+  802c94:	eb d2                	jmp    802c68 <journal_init+0xc7>
+		if (sum != jd->jd_sum)
+  802c96:	39 5e 04             	cmp    %ebx,0x4(%esi)
+  802c99:	0f 85 1a 01 00 00    	jne    802db9 <journal_init+0x218>
+		for (i = 0; i < jd->jd_n; i++) {
+  802c9f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ca4:	eb 43                	jmp    802ce9 <journal_init+0x148>
+				diskaddr(jn_start + b + 1 + i), BLKSIZE);
+  802ca6:	83 ec 0c             	sub    $0xc,%esp
+  802ca9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802cac:	8d 44 10 01          	lea    0x1(%eax,%edx,1),%eax
+  802cb0:	01 d8                	add    %ebx,%eax
+  802cb2:	50                   	push   %eax
+  802cb3:	e8 dc eb ff ff       	call   801894 <diskaddr>
+  802cb8:	89 c7                	mov    %eax,%edi
+			memmove(diskaddr(jd->jd_blocks[i]),
+  802cba:	83 c4 04             	add    $0x4,%esp
+  802cbd:	ff 74 9e 10          	push   0x10(%esi,%ebx,4)
+  802cc1:	e8 ce eb ff ff       	call   801894 <diskaddr>
+  802cc6:	83 c4 0c             	add    $0xc,%esp
+  802cc9:	68 00 10 00 00       	push   $0x1000
+  802cce:	57                   	push   %edi
+  802ccf:	50                   	push   %eax
+  802cd0:	e8 4a 46 00 00       	call   80731f <memmove>
+			bc_flush(jd->jd_blocks[i], 1);
+  802cd5:	83 c4 08             	add    $0x8,%esp
+  802cd8:	6a 01                	push   $0x1
+  802cda:	ff 74 9e 10          	push   0x10(%esi,%ebx,4)
+  802cde:	e8 62 ee ff ff       	call   801b45 <bc_flush>
+		for (i = 0; i < jd->jd_n; i++) {
+  802ce3:	83 c3 01             	add    $0x1,%ebx
+  802ce6:	83 c4 10             	add    $0x10,%esp
+  802ce9:	8b 46 0c             	mov    0xc(%esi),%eax
+  802cec:	39 c3                	cmp    %eax,%ebx
+  802cee:	73 41                	jae    802d31 <journal_init+0x190>
+			if (jd->jd_blocks[i] < 1 ||
+  802cf0:	8b 44 9e 10          	mov    0x10(%esi,%ebx,4),%eax
+  802cf4:	85 c0                	test   %eax,%eax
+  802cf6:	74 24                	je     802d1c <journal_init+0x17b>
+			    jd->jd_blocks[i] >= super->s_nblocks ||
+  802cf8:	8b 15 88 3f 84 00    	mov    0x843f88,%edx
+			if (jd->jd_blocks[i] < 1 ||
+  802cfe:	3b 42 04             	cmp    0x4(%edx),%eax
+  802d01:	73 19                	jae    802d1c <journal_init+0x17b>
+			    (jd->jd_blocks[i] >= jn_start &&
+  802d03:	8b 15 f0 73 83 00    	mov    0x8373f0,%edx
+			    jd->jd_blocks[i] >= super->s_nblocks ||
+  802d09:	39 d0                	cmp    %edx,%eax
+  802d0b:	72 99                	jb     802ca6 <journal_init+0x105>
+			     jd->jd_blocks[i] < jn_start + 1 + jn_nlog))
+  802d0d:	89 d1                	mov    %edx,%ecx
+  802d0f:	03 0d ec 73 83 00    	add    0x8373ec,%ecx
+  802d15:	83 c1 01             	add    $0x1,%ecx
+			    (jd->jd_blocks[i] >= jn_start &&
+  802d18:	39 c8                	cmp    %ecx,%eax
+  802d1a:	73 8a                	jae    802ca6 <journal_init+0x105>
+				panic("journal logs bad block %08x",
+  802d1c:	50                   	push   %eax
+  802d1d:	68 f8 9c 80 00       	push   $0x809cf8
+  802d22:	68 12 01 00 00       	push   $0x112
+  802d27:	68 97 9c 80 00       	push   $0x809c97
+  802d2c:	e8 9f 3d 00 00       	call   806ad0 <_panic>
+		jn_seq++;
+  802d31:	8b 3d e0 73 83 00    	mov    0x8373e0,%edi
+  802d37:	8d 57 01             	lea    0x1(%edi),%edx
+		ntx++;
+  802d3a:	83 45 e0 01          	addl   $0x1,-0x20(%ebp)
+	for (b = 1; b < 1 + jn_nlog; b += 1 + jd->jd_n) {
+  802d3e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802d41:	8d 44 07 01          	lea    0x1(%edi,%eax,1),%eax
+  802d45:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	jn_seq = jh->jh_seq;
+  802d48:	89 15 e0 73 83 00    	mov    %edx,0x8373e0
+	for (b = 1; b < 1 + jn_nlog; b += 1 + jd->jd_n) {
+  802d4e:	a1 ec 73 83 00       	mov    0x8373ec,%eax
+  802d53:	83 c0 01             	add    $0x1,%eax
+  802d56:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802d59:	73 5e                	jae    802db9 <journal_init+0x218>
+		jd = diskaddr(jn_start + b);
+  802d5b:	83 ec 0c             	sub    $0xc,%esp
+  802d5e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  802d61:	89 f8                	mov    %edi,%eax
+  802d63:	03 05 f0 73 83 00    	add    0x8373f0,%eax
+  802d69:	50                   	push   %eax
+  802d6a:	e8 25 eb ff ff       	call   801894 <diskaddr>
+  802d6f:	89 c6                	mov    %eax,%esi
+		if (jd->jd_magic != JDESC_MAGIC || jd->jd_seq != jn_seq ||
+  802d71:	83 c4 10             	add    $0x10,%esp
+  802d74:	81 38 53 45 44 4a    	cmpl   $0x4a444553,(%eax)
+  802d7a:	75 3d                	jne    802db9 <journal_init+0x218>
+  802d7c:	a1 e0 73 83 00       	mov    0x8373e0,%eax
+  802d81:	39 46 08             	cmp    %eax,0x8(%esi)
+  802d84:	75 33                	jne    802db9 <journal_init+0x218>
+		    jd->jd_n == 0 || jd->jd_n > jn_nlog - b)
+  802d86:	8b 4e 0c             	mov    0xc(%esi),%ecx
+		if (jd->jd_magic != JDESC_MAGIC || jd->jd_seq != jn_seq ||
+  802d89:	85 c9                	test   %ecx,%ecx
+  802d8b:	74 2c                	je     802db9 <journal_init+0x218>
+		    jd->jd_n == 0 || jd->jd_n > jn_nlog - b)
+  802d8d:	a1 ec 73 83 00       	mov    0x8373ec,%eax
+  802d92:	29 f8                	sub    %edi,%eax
+  802d94:	39 c8                	cmp    %ecx,%eax
+  802d96:	72 21                	jb     802db9 <journal_init+0x218>
+		sum = journal_sum(0, &jd->jd_seq, BLKSIZE / 4 - 2);
+  802d98:	8d 46 08             	lea    0x8(%esi),%eax
+  802d9b:	8d 8e 00 10 00 00    	lea    0x1000(%esi),%ecx
+  802da1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802da6:	39 c8                	cmp    %ecx,%eax
+  802da8:	0f 84 aa fe ff ff    	je     802c58 <journal_init+0xb7>
+    sum = ((sum << 5) | (sum >> 27)) + *w++;
+  802dae:	c1 c3 05             	rol    $0x5,%ebx
+  802db1:	83 c0 04             	add    $0x4,%eax
+  802db4:	03 58 fc             	add    -0x4(%eax),%ebx
+  802db7:	eb ed                	jmp    802da6 <journal_init+0x205>
+	if ((r = bio_sync()) < 0)
+  802db9:	e8 0b e8 ff ff       	call   8015c9 <bio_sync>
+  802dbe:	85 c0                	test   %eax,%eax
+  802dc0:	78 2a                	js     802dec <journal_init+0x24b>
+	if ((ntx = jn_replay()) > 0)
+  802dc2:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  802dc6:	75 39                	jne    802e01 <journal_init+0x260>
+	jn_head = 1;
+  802dc8:	c7 05 e4 73 83 00 01 	movl   $0x1,0x8373e4
+  802dcf:	00 00 00 
+	jn_write_header();
+  802dd2:	e8 45 f9 ff ff       	call   80271c <jn_write_header>
+	cprintf("journal is good\n");
+  802dd7:	83 ec 0c             	sub    $0xc,%esp
+  802dda:	68 27 9d 80 00       	push   $0x809d27
+  802ddf:	e8 c7 3d 00 00       	call   806bab <cprintf>
+  802de4:	83 c4 10             	add    $0x10,%esp
+  802de7:	e9 4d fe ff ff       	jmp    802c39 <journal_init+0x98>
+		panic("journal replay: %e", r);
+  802dec:	50                   	push   %eax
+  802ded:	68 14 9d 80 00       	push   $0x809d14
+  802df2:	68 1c 01 00 00       	push   $0x11c
+  802df7:	68 97 9c 80 00       	push   $0x809c97
+  802dfc:	e8 cf 3c 00 00       	call   806ad0 <_panic>
+		cprintf("journal: replayed %d transactions\n", ntx);
+  802e01:	83 ec 08             	sub    $0x8,%esp
+  802e04:	ff 75 e0             	push   -0x20(%ebp)
+  802e07:	68 bc 9d 80 00       	push   $0x809dbc
+  802e0c:	e8 9a 3d 00 00       	call   806bab <cprintf>
+  802e11:	83 c4 10             	add    $0x10,%esp
+  802e14:	eb b2                	jmp    802dc8 <journal_init+0x227>
+
+00802e16 <pa_reserved>:
+static uint32_t alloc_cursor;
+
+// Is 'blockno' in the window of a file other than 'f'?
+static bool
+pa_reserved(uint32_t blockno, struct File *f)
+{
+  802e16:	55                   	push   %ebp
+  802e17:	89 e5                	mov    %esp,%ebp
+  802e19:	57                   	push   %edi
+  802e1a:	56                   	push   %esi
+  802e1b:	53                   	push   %ebx
+  802e1c:	83 ec 04             	sub    $0x4,%esp
+  802e1f:	89 c3                	mov    %eax,%ebx
+  802e21:	89 d6                	mov    %edx,%esi
+	int i;
+
+	for (i = 0; i < PA_MAX; i++)
+  802e23:	ba 20 10 84 00       	mov    $0x841020,%edx
+  802e28:	bf e0 10 84 00       	mov    $0x8410e0,%edi
+  802e2d:	eb 03                	jmp    802e32 <pa_reserved+0x1c>
+  802e2f:	83 c2 0c             	add    $0xc,%edx
+  802e32:	39 fa                	cmp    %edi,%edx
+  802e34:	74 1f                	je     802e55 <pa_reserved+0x3f>
+		if (prealloc[i].pa_file && prealloc[i].pa_file != f &&
+  802e36:	89 55 f0             	mov    %edx,-0x10(%ebp)
+  802e39:	8b 0a                	mov    (%edx),%ecx
+  802e3b:	39 f1                	cmp    %esi,%ecx
+  802e3d:	0f 95 c0             	setne  %al
+  802e40:	85 c9                	test   %ecx,%ecx
+  802e42:	0f 95 c1             	setne  %cl
+  802e45:	20 c8                	and    %cl,%al
+  802e47:	74 e6                	je     802e2f <pa_reserved+0x19>
+  802e49:	3b 5a 04             	cmp    0x4(%edx),%ebx
+  802e4c:	72 e1                	jb     802e2f <pa_reserved+0x19>
+		    blockno >= prealloc[i].pa_start &&
+  802e4e:	3b 5a 08             	cmp    0x8(%edx),%ebx
+  802e51:	73 dc                	jae    802e2f <pa_reserved+0x19>
+  802e53:	eb 05                	jmp    802e5a <pa_reserved+0x44>
+		    blockno < prealloc[i].pa_end)
+			return 1;
+	return 0;
+  802e55:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e5a:	83 c4 04             	add    $0x4,%esp
+  802e5d:	5b                   	pop    %ebx
+  802e5e:	5e                   	pop    %esi
+  802e5f:	5f                   	pop    %edi
+  802e60:	5d                   	pop    %ebp
+  802e61:	c3                   	ret
+
+00802e62 <pa_drop>:
+static struct Prealloc *
+pa_find(struct File *f)
+{
+	int i;
+
+	for (i = 0; i < PA_MAX; i++)
+  802e62:	ba 20 10 84 00       	mov    $0x841020,%edx
+  802e67:	b9 00 00 00 00       	mov    $0x0,%ecx
+		if (prealloc[i].pa_file == f)
+  802e6c:	83 c2 0c             	add    $0xc,%edx
+  802e6f:	3b 42 f4             	cmp    -0xc(%edx),%eax
+  802e72:	74 09                	je     802e7d <pa_drop+0x1b>
+	for (i = 0; i < PA_MAX; i++)
+  802e74:	83 c1 01             	add    $0x1,%ecx
+  802e77:	83 f9 10             	cmp    $0x10,%ecx
+  802e7a:	75 f0                	jne    802e6c <pa_drop+0xa>
+{
+	struct Prealloc *pa;
+
+	if ((pa = pa_find(f)) != NULL)
+		pa->pa_file = NULL;
+}
+  802e7c:	c3                   	ret
+		pa->pa_file = NULL;
+  802e7d:	8d 04 49             	lea    (%ecx,%ecx,2),%eax
+  802e80:	c7 04 85 20 10 84 00 	movl   $0x0,0x841020(,%eax,4)
+  802e87:	00 00 00 00 
+  802e8b:	c3                   	ret
+
+00802e8c <file_home>:
+static uint32_t
+file_home(struct File *f)
+{
+	uint32_t g, best, ngroups;
+
+	if (f->f_type != FTYPE_DIR || f == &super->s_root)
+  802e8c:	83 b8 84 00 00 00 01 	cmpl   $0x1,0x84(%eax)
+  802e93:	75 4b                	jne    802ee0 <file_home+0x54>
+  802e95:	8b 15 88 3f 84 00    	mov    0x843f88,%edx
+  802e9b:	8d 4a 08             	lea    0x8(%edx),%ecx
+  802e9e:	39 c8                	cmp    %ecx,%eax
+  802ea0:	74 3e                	je     802ee0 <file_home+0x54>
+		return ((uint32_t) f - DISKMAP) / BLKSIZE;
+
+	ngroups = (super->s_nblocks + AG_BLOCKS - 1) / AG_BLOCKS;
+  802ea2:	8b 4a 04             	mov    0x4(%edx),%ecx
+  802ea5:	81 c1 ff 01 00 00    	add    $0x1ff,%ecx
+  802eab:	c1 e9 09             	shr    $0x9,%ecx
+	for (g = best = 0; g < ngroups; g++)
+  802eae:	b8 00 00 00 00       	mov    $0x0,%eax
+  802eb3:	ba 00 00 00 00       	mov    $0x0,%edx
+  802eb8:	39 ca                	cmp    %ecx,%edx
+  802eba:	74 2d                	je     802ee9 <file_home+0x5d>
+{
+  802ebc:	55                   	push   %ebp
+  802ebd:	89 e5                	mov    %esp,%ebp
+  802ebf:	53                   	push   %ebx
+		if (ag_nfree[g] > ag_nfree[best])
+			best = g;
+  802ec0:	8b 1c 95 e0 10 84 00 	mov    0x8410e0(,%edx,4),%ebx
+  802ec7:	39 1c 85 e0 10 84 00 	cmp    %ebx,0x8410e0(,%eax,4)
+  802ece:	0f 42 c2             	cmovb  %edx,%eax
+	for (g = best = 0; g < ngroups; g++)
+  802ed1:	83 c2 01             	add    $0x1,%edx
+  802ed4:	39 ca                	cmp    %ecx,%edx
+  802ed6:	75 e8                	jne    802ec0 <file_home+0x34>
+	return best * AG_BLOCKS;
+  802ed8:	c1 e0 09             	shl    $0x9,%eax
+}
+  802edb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ede:	c9                   	leave
+  802edf:	c3                   	ret
+		return ((uint32_t) f - DISKMAP) / BLKSIZE;
+  802ee0:	2d 00 00 00 10       	sub    $0x10000000,%eax
+  802ee5:	c1 e8 0c             	shr    $0xc,%eax
+  802ee8:	c3                   	ret
+	return best * AG_BLOCKS;
+  802ee9:	c1 e0 09             	shl    $0x9,%eax
+}
+  802eec:	c3                   	ret
+
+00802eed <alloc_search>:
+{
+  802eed:	55                   	push   %ebp
+  802eee:	89 e5                	mov    %esp,%ebp
+  802ef0:	57                   	push   %edi
+  802ef1:	56                   	push   %esi
+  802ef2:	53                   	push   %ebx
+  802ef3:	83 ec 1c             	sub    $0x1c,%esp
+  802ef6:	89 55 e8             	mov    %edx,-0x18(%ebp)
+  802ef9:	88 4d ef             	mov    %cl,-0x11(%ebp)
+	nwords = (super->s_nblocks + 31) / 32;
+  802efc:	8b 15 88 3f 84 00    	mov    0x843f88,%edx
+  802f02:	8b 7a 04             	mov    0x4(%edx),%edi
+  802f05:	8d 57 1f             	lea    0x1f(%edi),%edx
+  802f08:	c1 ea 05             	shr    $0x5,%edx
+  802f0b:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+	w = goal / 32;
+  802f0e:	89 c2                	mov    %eax,%edx
+  802f10:	c1 ea 05             	shr    $0x5,%edx
+	bits = bitmap[w] & (~0U << (goal % 32));
+  802f13:	8b 35 84 3f 84 00    	mov    0x843f84,%esi
+  802f19:	89 75 d8             	mov    %esi,-0x28(%ebp)
+  802f1c:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+  802f21:	89 c1                	mov    %eax,%ecx
+  802f23:	d3 e3                	shl    %cl,%ebx
+  802f25:	23 1c 96             	and    (%esi,%edx,4),%ebx
+	for (n = 0; n <= nwords; n++) {
+  802f28:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f2d:	89 7d f0             	mov    %edi,-0x10(%ebp)
+			blockno = w * 32 + __builtin_ctz(bits);
+  802f30:	89 d7                	mov    %edx,%edi
+  802f32:	c1 e7 05             	shl    $0x5,%edi
+  802f35:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  802f38:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  802f3b:	eb 05                	jmp    802f42 <alloc_search+0x55>
+		for (; bits; bits &= bits - 1) {
+  802f3d:	8d 43 ff             	lea    -0x1(%ebx),%eax
+  802f40:	21 c3                	and    %eax,%ebx
+  802f42:	85 db                	test   %ebx,%ebx
+  802f44:	74 2d                	je     802f73 <alloc_search+0x86>
+			blockno = w * 32 + __builtin_ctz(bits);
+  802f46:	31 f6                	xor    %esi,%esi
+  802f48:	f3 0f bc f3          	tzcnt  %ebx,%esi
+  802f4c:	01 fe                	add    %edi,%esi
+			if (blockno < super->s_nblocks &&
+  802f4e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  802f51:	39 c6                	cmp    %eax,%esi
+  802f53:	73 e8                	jae    802f3d <alloc_search+0x50>
+  802f55:	80 7d ef 00          	cmpb   $0x0,-0x11(%ebp)
+  802f59:	75 0e                	jne    802f69 <alloc_search+0x7c>
+			    (any || !pa_reserved(blockno, f)))
+  802f5b:	8b 55 e8             	mov    -0x18(%ebp),%edx
+  802f5e:	89 f0                	mov    %esi,%eax
+  802f60:	e8 b1 fe ff ff       	call   802e16 <pa_reserved>
+  802f65:	84 c0                	test   %al,%al
+  802f67:	75 d4                	jne    802f3d <alloc_search+0x50>
+				return blockno;
+  802f69:	89 f0                	mov    %esi,%eax
+}
+  802f6b:	83 c4 1c             	add    $0x1c,%esp
+  802f6e:	5b                   	pop    %ebx
+  802f6f:	5e                   	pop    %esi
+  802f70:	5f                   	pop    %edi
+  802f71:	5d                   	pop    %ebp
+  802f72:	c3                   	ret
+		if (++w >= nwords)
+  802f73:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802f76:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802f79:	83 c2 01             	add    $0x1,%edx
+  802f7c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802f7f:	39 ca                	cmp    %ecx,%edx
+			w = w + AG_WORDS < nwords ? w + AG_WORDS : 0;
+  802f81:	0f 43 d3             	cmovae %ebx,%edx
+		while (w % AG_WORDS == 0 && ag_nfree[w / AG_WORDS] == 0 &&
+  802f84:	89 d6                	mov    %edx,%esi
+  802f86:	83 e6 0f             	and    $0xf,%esi
+  802f89:	75 20                	jne    802fab <alloc_search+0xbe>
+  802f8b:	89 d3                	mov    %edx,%ebx
+  802f8d:	c1 eb 04             	shr    $0x4,%ebx
+  802f90:	83 3c 9d e0 10 84 00 	cmpl   $0x0,0x8410e0(,%ebx,4)
+  802f97:	00 
+  802f98:	75 11                	jne    802fab <alloc_search+0xbe>
+  802f9a:	39 c8                	cmp    %ecx,%eax
+  802f9c:	73 0d                	jae    802fab <alloc_search+0xbe>
+			w = w + AG_WORDS < nwords ? w + AG_WORDS : 0;
+  802f9e:	83 c2 10             	add    $0x10,%edx
+  802fa1:	39 ca                	cmp    %ecx,%edx
+  802fa3:	0f 43 d6             	cmovae %esi,%edx
+			n += AG_WORDS;
+  802fa6:	83 c0 10             	add    $0x10,%eax
+  802fa9:	eb d9                	jmp    802f84 <alloc_search+0x97>
+		bits = bitmap[w];
+  802fab:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  802fae:	8b 1c 91             	mov    (%ecx,%edx,4),%ebx
+	for (n = 0; n <= nwords; n++) {
+  802fb1:	83 c0 01             	add    $0x1,%eax
+  802fb4:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802fb7:	0f 83 73 ff ff ff    	jae    802f30 <alloc_search+0x43>
+	return -E_NO_DISK;
+  802fbd:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  802fc2:	eb a7                	jmp    802f6b <alloc_search+0x7e>
+
+00802fc4 <dir_index>:
+static struct DirIndex *
+dir_index(struct File *dir)
+{
+	struct DirIndex *di;
+
+	if (!(dir->f_flags & FILE_DIRINDEX))
+  802fc4:	f6 80 88 00 00 00 02 	testb  $0x2,0x88(%eax)
+  802fcb:	74 51                	je     80301e <dir_index+0x5a>
+		return NULL;
+	if (dir->f_index < 2 || dir->f_index >= super->s_nblocks)
+  802fcd:	8b 90 f8 00 00 00    	mov    0xf8(%eax),%edx
+  802fd3:	83 fa 01             	cmp    $0x1,%edx
+  802fd6:	76 4c                	jbe    803024 <dir_index+0x60>
+		return NULL;
+  802fd8:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (dir->f_index < 2 || dir->f_index >= super->s_nblocks)
+  802fdd:	8b 0d 88 3f 84 00    	mov    0x843f88,%ecx
+  802fe3:	3b 51 04             	cmp    0x4(%ecx),%edx
+  802fe6:	73 5e                	jae    803046 <dir_index+0x82>
+{
+  802fe8:	55                   	push   %ebp
+  802fe9:	89 e5                	mov    %esp,%ebp
+  802feb:	83 ec 14             	sub    $0x14,%esp
+	di = diskaddr(dir->f_index);
+  802fee:	52                   	push   %edx
+  802fef:	e8 a0 e8 ff ff       	call   801894 <diskaddr>
+	if (di->di_magic != DIRINDEX_MAGIC || di->di_nslots < DIRSLOTS ||
+  802ff4:	83 c4 10             	add    $0x10,%esp
+  802ff7:	81 38 58 44 49 44    	cmpl   $0x44494458,(%eax)
+  802ffd:	75 2b                	jne    80302a <dir_index+0x66>
+  802fff:	8b 50 04             	mov    0x4(%eax),%edx
+  803002:	8d 8a 00 fe ff ff    	lea    -0x200(%edx),%ecx
+  803008:	81 f9 ff f7 07 00    	cmp    $0x7f7ff,%ecx
+  80300e:	77 21                	ja     803031 <dir_index+0x6d>
+	    (di->di_nslots & (di->di_nslots - 1)) != 0 ||
+  803010:	8d 4a ff             	lea    -0x1(%edx),%ecx
+  803013:	85 d1                	test   %edx,%ecx
+  803015:	75 21                	jne    803038 <dir_index+0x74>
+	    di->di_nslots / DIRSLOTS > DIRINDEX_MAXBLOCKS ||
+  803017:	39 50 08             	cmp    %edx,0x8(%eax)
+  80301a:	73 23                	jae    80303f <dir_index+0x7b>
+	    di->di_nentries >= di->di_nslots)
+		return NULL;
+	return di;
+}
+  80301c:	c9                   	leave
+  80301d:	c3                   	ret
+		return NULL;
+  80301e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803023:	c3                   	ret
+		return NULL;
+  803024:	b8 00 00 00 00       	mov    $0x0,%eax
+  803029:	c3                   	ret
+		return NULL;
+  80302a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80302f:	eb eb                	jmp    80301c <dir_index+0x58>
+  803031:	b8 00 00 00 00       	mov    $0x0,%eax
+  803036:	eb e4                	jmp    80301c <dir_index+0x58>
+  803038:	b8 00 00 00 00       	mov    $0x0,%eax
+  80303d:	eb dd                	jmp    80301c <dir_index+0x58>
+  80303f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803044:	eb d6                	jmp    80301c <dir_index+0x58>
+}
+  803046:	c3                   	ret
+
+00803047 <dir_slot>:
+
+// Slot 'i' of the table in 'blocks'.
+static struct DirSlot *
+dir_slot(const uint32_t *blocks, uint32_t i)
+{
+  803047:	55                   	push   %ebp
+  803048:	89 e5                	mov    %esp,%ebp
+  80304a:	53                   	push   %ebx
+  80304b:	83 ec 10             	sub    $0x10,%esp
+  80304e:	89 d3                	mov    %edx,%ebx
+	return (struct DirSlot *) diskaddr(blocks[i / DIRSLOTS]) + i % DIRSLOTS;
+  803050:	c1 ea 09             	shr    $0x9,%edx
+  803053:	ff 34 90             	push   (%eax,%edx,4)
+  803056:	e8 39 e8 ff ff       	call   801894 <diskaddr>
+  80305b:	81 e3 ff 01 00 00    	and    $0x1ff,%ebx
+  803061:	8d 04 d8             	lea    (%eax,%ebx,8),%eax
+}
+  803064:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803067:	c9                   	leave
+  803068:	c3                   	ret
+
+00803069 <dcache_enter>:
+}
+
+// Remember that 'name' in dir is f, or isn't there if f is NULL.
+static void
+dcache_enter(struct File *dir, const char *name, struct File *f)
+{
+  803069:	55                   	push   %ebp
+  80306a:	89 e5                	mov    %esp,%ebp
+  80306c:	57                   	push   %edi
+  80306d:	56                   	push   %esi
+  80306e:	53                   	push   %ebx
+  80306f:	83 ec 0c             	sub    $0xc,%esp
+  803072:	89 c3                	mov    %eax,%ebx
+  803074:	89 d6                	mov    %edx,%esi
+  uint32_t h = 2166136261U;
+  803076:	bf c5 9d 1c 81       	mov    $0x811c9dc5,%edi
+  while (*name)
+  80307b:	eb 0e                	jmp    80308b <dcache_enter+0x22>
+    h = (h ^ (uint8_t) *name++) * 16777619;
+  80307d:	83 c2 01             	add    $0x1,%edx
+  803080:	0f b6 c0             	movzbl %al,%eax
+  803083:	31 f8                	xor    %edi,%eax
+  803085:	69 f8 93 01 00 01    	imul   $0x1000193,%eax,%edi
+  while (*name)
+  80308b:	0f b6 02             	movzbl (%edx),%eax
+  80308e:	84 c0                	test   %al,%al
+  803090:	75 eb                	jne    80307d <dcache_enter+0x14>
+	uint32_t h = dir_hash(name);
+	struct Dentry *d = dcache_slot(dir, h);
+
+	if (dcache_off)
+  803092:	80 3d fc 83 83 00 00 	cmpb   $0x0,0x8383fc
+  803099:	74 08                	je     8030a3 <dcache_enter+0x3a>
+		return;
+	d->dc_dir = dir;
+	d->dc_file = f;
+	d->dc_hash = h;
+	strcpy(d->dc_name, name);
+}
+  80309b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80309e:	5b                   	pop    %ebx
+  80309f:	5e                   	pop    %esi
+  8030a0:	5f                   	pop    %edi
+  8030a1:	5d                   	pop    %ebp
+  8030a2:	c3                   	ret
+	return &dcache[(h ^ ((uint32_t) dir >> 8)) & (DCACHE_SIZE - 1)];
+  8030a3:	89 d8                	mov    %ebx,%eax
+  8030a5:	c1 e8 08             	shr    $0x8,%eax
+  8030a8:	31 f8                	xor    %edi,%eax
+  8030aa:	0f b6 c0             	movzbl %al,%eax
+	d->dc_dir = dir;
+  8030ad:	69 c0 8c 00 00 00    	imul   $0x8c,%eax,%eax
+  8030b3:	89 98 00 84 83 00    	mov    %ebx,0x838400(%eax)
+	d->dc_file = f;
+  8030b9:	89 88 04 84 83 00    	mov    %ecx,0x838404(%eax)
+	d->dc_hash = h;
+  8030bf:	89 b8 08 84 83 00    	mov    %edi,0x838408(%eax)
+	strcpy(d->dc_name, name);
+  8030c5:	83 ec 08             	sub    $0x8,%esp
+  8030c8:	56                   	push   %esi
+  8030c9:	05 0c 84 83 00       	add    $0x83840c,%eax
+  8030ce:	50                   	push   %eax
+  8030cf:	e8 c5 40 00 00       	call   807199 <strcpy>
+  8030d4:	83 c4 10             	add    $0x10,%esp
+  8030d7:	eb c2                	jmp    80309b <dcache_enter+0x32>
+
+008030d9 <check_super>:
+{
+  8030d9:	55                   	push   %ebp
+  8030da:	89 e5                	mov    %esp,%ebp
+  8030dc:	83 ec 08             	sub    $0x8,%esp
+	if (super->s_magic != FS_MAGIC)
+  8030df:	a1 88 3f 84 00       	mov    0x843f88,%eax
+  8030e4:	81 38 ae 30 05 4a    	cmpl   $0x4a0530ae,(%eax)
+  8030ea:	75 1b                	jne    803107 <check_super+0x2e>
+	if (super->s_nblocks > DISKSIZE/BLKSIZE)
+  8030ec:	81 78 04 00 00 0c 00 	cmpl   $0xc0000,0x4(%eax)
+  8030f3:	77 26                	ja     80311b <check_super+0x42>
+	cprintf("superblock is good\n");
+  8030f5:	83 ec 0c             	sub    $0xc,%esp
+  8030f8:	68 1d 9e 80 00       	push   $0x809e1d
+  8030fd:	e8 a9 3a 00 00       	call   806bab <cprintf>
+}
+  803102:	83 c4 10             	add    $0x10,%esp
+  803105:	c9                   	leave
+  803106:	c3                   	ret
+		panic("bad file system magic number");
+  803107:	83 ec 04             	sub    $0x4,%esp
+  80310a:	68 df 9d 80 00       	push   $0x809ddf
+  80310f:	6a 0f                	push   $0xf
+  803111:	68 fc 9d 80 00       	push   $0x809dfc
+  803116:	e8 b5 39 00 00       	call   806ad0 <_panic>
+		panic("file system is too large");
+  80311b:	83 ec 04             	sub    $0x4,%esp
+  80311e:	68 04 9e 80 00       	push   $0x809e04
+  803123:	6a 12                	push   $0x12
+  803125:	68 fc 9d 80 00       	push   $0x809dfc
+  80312a:	e8 a1 39 00 00       	call   806ad0 <_panic>
+
+0080312f <block_is_free>:
+{
+  80312f:	55                   	push   %ebp
+  803130:	89 e5                	mov    %esp,%ebp
+  803132:	53                   	push   %ebx
+  803133:	8b 4d 08             	mov    0x8(%ebp),%ecx
+	if (super == 0 || blockno >= super->s_nblocks)
+  803136:	a1 88 3f 84 00       	mov    0x843f88,%eax
+  80313b:	85 c0                	test   %eax,%eax
+  80313d:	74 29                	je     803168 <block_is_free+0x39>
+		return 0;
+  80313f:	ba 00 00 00 00       	mov    $0x0,%edx
+	if (super == 0 || blockno >= super->s_nblocks)
+  803144:	3b 48 04             	cmp    0x4(%eax),%ecx
+  803147:	73 18                	jae    803161 <block_is_free+0x32>
+	if (bitmap[blockno / 32] & (1 << (blockno % 32)))
+  803149:	89 cb                	mov    %ecx,%ebx
+  80314b:	c1 eb 05             	shr    $0x5,%ebx
+  80314e:	b8 01 00 00 00       	mov    $0x1,%eax
+  803153:	d3 e0                	shl    %cl,%eax
+  803155:	8b 15 84 3f 84 00    	mov    0x843f84,%edx
+  80315b:	23 04 9a             	and    (%edx,%ebx,4),%eax
+  80315e:	0f 95 c2             	setne  %dl
+}
+  803161:	89 d0                	mov    %edx,%eax
+  803163:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803166:	c9                   	leave
+  803167:	c3                   	ret
+		return 0;
+  803168:	ba 00 00 00 00       	mov    $0x0,%edx
+  80316d:	eb f2                	jmp    803161 <block_is_free+0x32>
+
+0080316f <pa_set>:
+{
+  80316f:	55                   	push   %ebp
+  803170:	89 e5                	mov    %esp,%ebp
+  803172:	57                   	push   %edi
+  803173:	56                   	push   %esi
+  803174:	53                   	push   %ebx
+  803175:	83 ec 1c             	sub    $0x1c,%esp
+  803178:	89 c6                	mov    %eax,%esi
+  80317a:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+	for (end = next; end < next + PA_WINDOW && block_is_free(end) &&
+  80317d:	89 d3                	mov    %edx,%ebx
+  80317f:	8d 7a 20             	lea    0x20(%edx),%edi
+  803182:	eb 03                	jmp    803187 <pa_set+0x18>
+		     !pa_reserved(end, f); end++)
+  803184:	83 c3 01             	add    $0x1,%ebx
+	for (end = next; end < next + PA_WINDOW && block_is_free(end) &&
+  803187:	39 fb                	cmp    %edi,%ebx
+  803189:	73 1d                	jae    8031a8 <pa_set+0x39>
+  80318b:	83 ec 0c             	sub    $0xc,%esp
+  80318e:	53                   	push   %ebx
+  80318f:	e8 9b ff ff ff       	call   80312f <block_is_free>
+  803194:	83 c4 10             	add    $0x10,%esp
+  803197:	84 c0                	test   %al,%al
+  803199:	74 0d                	je     8031a8 <pa_set+0x39>
+		     !pa_reserved(end, f); end++)
+  80319b:	89 f2                	mov    %esi,%edx
+  80319d:	89 d8                	mov    %ebx,%eax
+  80319f:	e8 72 fc ff ff       	call   802e16 <pa_reserved>
+	for (end = next; end < next + PA_WINDOW && block_is_free(end) &&
+  8031a4:	84 c0                	test   %al,%al
+  8031a6:	74 dc                	je     803184 <pa_set+0x15>
+  8031a8:	b8 20 10 84 00       	mov    $0x841020,%eax
+  8031ad:	ba 00 00 00 00       	mov    $0x0,%edx
+		if (prealloc[i].pa_file == f)
+  8031b2:	83 c0 0c             	add    $0xc,%eax
+  8031b5:	3b 70 f4             	cmp    -0xc(%eax),%esi
+  8031b8:	74 2d                	je     8031e7 <pa_set+0x78>
+	for (i = 0; i < PA_MAX; i++)
+  8031ba:	83 c2 01             	add    $0x1,%edx
+  8031bd:	83 fa 10             	cmp    $0x10,%edx
+  8031c0:	75 f0                	jne    8031b2 <pa_set+0x43>
+		if (end == next)
+  8031c2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8031c5:	39 c3                	cmp    %eax,%ebx
+  8031c7:	74 3d                	je     803206 <pa_set+0x97>
+		pa = &prealloc[pa_next];
+  8031c9:	8b 15 04 10 84 00    	mov    0x841004,%edx
+  8031cf:	8d 04 52             	lea    (%edx,%edx,2),%eax
+  8031d2:	8d 04 85 20 10 84 00 	lea    0x841020(,%eax,4),%eax
+		pa_next = (pa_next + 1) % PA_MAX;
+  8031d9:	83 c2 01             	add    $0x1,%edx
+  8031dc:	83 e2 0f             	and    $0xf,%edx
+  8031df:	89 15 04 10 84 00    	mov    %edx,0x841004
+  8031e5:	eb 0a                	jmp    8031f1 <pa_set+0x82>
+			return &prealloc[i];
+  8031e7:	8d 04 52             	lea    (%edx,%edx,2),%eax
+  8031ea:	8d 04 85 20 10 84 00 	lea    0x841020(,%eax,4),%eax
+	pa->pa_file = end > next ? f : NULL;
+  8031f1:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8031f4:	39 d9                	cmp    %ebx,%ecx
+  8031f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031fb:	0f 43 f2             	cmovae %edx,%esi
+  8031fe:	89 30                	mov    %esi,(%eax)
+	pa->pa_start = next;
+  803200:	89 48 04             	mov    %ecx,0x4(%eax)
+	pa->pa_end = end;
+  803203:	89 58 08             	mov    %ebx,0x8(%eax)
+}
+  803206:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803209:	5b                   	pop    %ebx
+  80320a:	5e                   	pop    %esi
+  80320b:	5f                   	pop    %edi
+  80320c:	5d                   	pop    %ebp
+  80320d:	c3                   	ret
+
+0080320e <count_free_blocks>:
+{
+  80320e:	55                   	push   %ebp
+  80320f:	89 e5                	mov    %esp,%ebp
+  803211:	57                   	push   %edi
+  803212:	56                   	push   %esi
+  803213:	53                   	push   %ebx
+  803214:	83 ec 10             	sub    $0x10,%esp
+	memset(ag_nfree, 0, sizeof(ag_nfree));
+  803217:	68 00 18 00 00       	push   $0x1800
+  80321c:	6a 00                	push   $0x0
+  80321e:	68 e0 10 84 00       	push   $0x8410e0
+  803223:	e8 c2 40 00 00       	call   8072ea <memset>
+	for (i = 0; i < super->s_nblocks; i++)
+  803228:	8b 3d 88 3f 84 00    	mov    0x843f88,%edi
+  80322e:	83 c4 10             	add    $0x10,%esp
+	n = 0;
+  803231:	be 00 00 00 00       	mov    $0x0,%esi
+	for (i = 0; i < super->s_nblocks; i++)
+  803236:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80323b:	eb 03                	jmp    803240 <count_free_blocks+0x32>
+  80323d:	83 c3 01             	add    $0x1,%ebx
+  803240:	3b 5f 04             	cmp    0x4(%edi),%ebx
+  803243:	73 22                	jae    803267 <count_free_blocks+0x59>
+		if (block_is_free(i)) {
+  803245:	83 ec 0c             	sub    $0xc,%esp
+  803248:	53                   	push   %ebx
+  803249:	e8 e1 fe ff ff       	call   80312f <block_is_free>
+  80324e:	83 c4 10             	add    $0x10,%esp
+  803251:	84 c0                	test   %al,%al
+  803253:	74 e8                	je     80323d <count_free_blocks+0x2f>
+			ag_nfree[i / AG_BLOCKS]++;
+  803255:	89 d8                	mov    %ebx,%eax
+  803257:	c1 e8 09             	shr    $0x9,%eax
+  80325a:	83 04 85 e0 10 84 00 	addl   $0x1,0x8410e0(,%eax,4)
+  803261:	01 
+			n++;
+  803262:	83 c6 01             	add    $0x1,%esi
+  803265:	eb d6                	jmp    80323d <count_free_blocks+0x2f>
+}
+  803267:	89 f0                	mov    %esi,%eax
+  803269:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80326c:	5b                   	pop    %ebx
+  80326d:	5e                   	pop    %esi
+  80326e:	5f                   	pop    %edi
+  80326f:	5d                   	pop    %ebp
+  803270:	c3                   	ret
+
+00803271 <free_block>:
+{
+  803271:	55                   	push   %ebp
+  803272:	89 e5                	mov    %esp,%ebp
+  803274:	56                   	push   %esi
+  803275:	53                   	push   %ebx
+  803276:	8b 75 08             	mov    0x8(%ebp),%esi
+	if (blockno == 0)
+  803279:	85 f6                	test   %esi,%esi
+  80327b:	74 67                	je     8032e4 <free_block+0x73>
+	journal_dirty(&bitmap[blockno/32]);
+  80327d:	89 f3                	mov    %esi,%ebx
+  80327f:	c1 eb 05             	shr    $0x5,%ebx
+  803282:	c1 e3 02             	shl    $0x2,%ebx
+  803285:	83 ec 0c             	sub    $0xc,%esp
+  803288:	89 d8                	mov    %ebx,%eax
+  80328a:	03 05 84 3f 84 00    	add    0x843f84,%eax
+  803290:	50                   	push   %eax
+  803291:	e8 78 f8 ff ff       	call   802b0e <journal_dirty>
+	journal_dirty(super);
+  803296:	83 c4 04             	add    $0x4,%esp
+  803299:	ff 35 88 3f 84 00    	push   0x843f88
+  80329f:	e8 6a f8 ff ff       	call   802b0e <journal_dirty>
+	if (!block_is_free(blockno)) {
+  8032a4:	89 34 24             	mov    %esi,(%esp)
+  8032a7:	e8 83 fe ff ff       	call   80312f <block_is_free>
+  8032ac:	83 c4 10             	add    $0x10,%esp
+  8032af:	84 c0                	test   %al,%al
+  8032b1:	75 19                	jne    8032cc <free_block+0x5b>
+		super->s_nfree++;
+  8032b3:	a1 88 3f 84 00       	mov    0x843f88,%eax
+  8032b8:	83 80 08 01 00 00 01 	addl   $0x1,0x108(%eax)
+		ag_nfree[blockno / AG_BLOCKS]++;
+  8032bf:	89 f0                	mov    %esi,%eax
+  8032c1:	c1 e8 09             	shr    $0x9,%eax
+  8032c4:	83 04 85 e0 10 84 00 	addl   $0x1,0x8410e0(,%eax,4)
+  8032cb:	01 
+	bitmap[blockno/32] |= 1<<(blockno%32);
+  8032cc:	03 1d 84 3f 84 00    	add    0x843f84,%ebx
+  8032d2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8032d7:	89 f1                	mov    %esi,%ecx
+  8032d9:	d3 e0                	shl    %cl,%eax
+  8032db:	09 03                	or     %eax,(%ebx)
+}
+  8032dd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8032e0:	5b                   	pop    %ebx
+  8032e1:	5e                   	pop    %esi
+  8032e2:	5d                   	pop    %ebp
+  8032e3:	c3                   	ret
+		panic("attempt to free zero block");
+  8032e4:	83 ec 04             	sub    $0x4,%esp
+  8032e7:	68 31 9e 80 00       	push   $0x809e31
+  8032ec:	6a 33                	push   $0x33
+  8032ee:	68 fc 9d 80 00       	push   $0x809dfc
+  8032f3:	e8 d8 37 00 00       	call   806ad0 <_panic>
+
+008032f8 <extent_truncate>:
+}
+
+// Free the blocks of extent-mapped file 'f' past its first 'nblocks'.
+static void
+extent_truncate(struct File *f, uint32_t nblocks)
+{
+  8032f8:	55                   	push   %ebp
+  8032f9:	89 e5                	mov    %esp,%ebp
+  8032fb:	57                   	push   %edi
+  8032fc:	56                   	push   %esi
+  8032fd:	53                   	push   %ebx
+  8032fe:	83 ec 38             	sub    $0x38,%esp
+  803301:	89 c7                	mov    %eax,%edi
+  803303:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  803306:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+	uint32_t i, b, keep, base, n;
+	struct Extent *e;
+
+	journal_dirty(f);
+  803309:	50                   	push   %eax
+  80330a:	e8 ff f7 ff ff       	call   802b0e <journal_dirty>
+	base = n = 0;
+	for (i = 0; i < f->f_nextent; i++) {
+  80330f:	8d 97 c4 00 00 00    	lea    0xc4(%edi),%edx
+  803315:	83 c4 10             	add    $0x10,%esp
+	base = n = 0;
+  803318:	c7 45 d0 00 00 00 00 	movl   $0x0,-0x30(%ebp)
+  80331f:	b9 00 00 00 00       	mov    $0x0,%ecx
+	for (i = 0; i < f->f_nextent; i++) {
+  803324:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80332b:	eb 32                	jmp    80335f <extent_truncate+0x67>
+		e = &f->f_extent[i];
+		keep = nblocks > base ? MIN(nblocks - base, e->e_len) : 0;
+		base += e->e_len;
+		for (b = keep; b < e->e_len; b++)
+			free_block(e->e_start + b);
+  80332d:	83 ec 0c             	sub    $0xc,%esp
+  803330:	89 d8                	mov    %ebx,%eax
+  803332:	03 46 fc             	add    -0x4(%esi),%eax
+  803335:	50                   	push   %eax
+  803336:	e8 36 ff ff ff       	call   803271 <free_block>
+		for (b = keep; b < e->e_len; b++)
+  80333b:	83 c3 01             	add    $0x1,%ebx
+  80333e:	83 c4 10             	add    $0x10,%esp
+  803341:	3b 1e                	cmp    (%esi),%ebx
+  803343:	72 e8                	jb     80332d <extent_truncate+0x35>
+		e->e_len = keep;
+  803345:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  803348:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  80334b:	89 3e                	mov    %edi,(%esi)
+		if (keep == 0)
+  80334d:	85 ff                	test   %edi,%edi
+  80334f:	75 41                	jne    803392 <extent_truncate+0x9a>
+			e->e_start = 0;
+  803351:	c7 46 fc 00 00 00 00 	movl   $0x0,-0x4(%esi)
+	for (i = 0; i < f->f_nextent; i++) {
+  803358:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+  80335c:	83 c2 08             	add    $0x8,%edx
+  80335f:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  803362:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  803365:	3b b8 bc 00 00 00    	cmp    0xbc(%eax),%edi
+  80336b:	73 30                	jae    80339d <extent_truncate+0xa5>
+		keep = nblocks > base ? MIN(nblocks - base, e->e_len) : 0;
+  80336d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803372:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  803375:	39 c1                	cmp    %eax,%ecx
+  803377:	73 0b                	jae    803384 <extent_truncate+0x8c>
+  803379:	89 c7                	mov    %eax,%edi
+  80337b:	29 cf                	sub    %ecx,%edi
+  80337d:	8b 02                	mov    (%edx),%eax
+  80337f:	39 c7                	cmp    %eax,%edi
+  803381:	0f 47 f8             	cmova  %eax,%edi
+		base += e->e_len;
+  803384:	89 d6                	mov    %edx,%esi
+  803386:	03 0a                	add    (%edx),%ecx
+		for (b = keep; b < e->e_len; b++)
+  803388:	89 fb                	mov    %edi,%ebx
+  80338a:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80338d:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  803390:	eb af                	jmp    803341 <extent_truncate+0x49>
+		else
+			n = i + 1;
+  803392:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803395:	83 c0 01             	add    $0x1,%eax
+  803398:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80339b:	eb bb                	jmp    803358 <extent_truncate+0x60>
+	}
+	f->f_nextent = n;
+  80339d:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8033a0:	89 88 bc 00 00 00    	mov    %ecx,0xbc(%eax)
+}
+  8033a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033a9:	5b                   	pop    %ebx
+  8033aa:	5e                   	pop    %esi
+  8033ab:	5f                   	pop    %edi
+  8033ac:	5d                   	pop    %ebp
+  8033ad:	c3                   	ret
+
+008033ae <dir_index_drop>:
+{
+  8033ae:	55                   	push   %ebp
+  8033af:	89 e5                	mov    %esp,%ebp
+  8033b1:	57                   	push   %edi
+  8033b2:	56                   	push   %esi
+  8033b3:	53                   	push   %ebx
+  8033b4:	83 ec 18             	sub    $0x18,%esp
+  8033b7:	89 c7                	mov    %eax,%edi
+	journal_dirty(dir);
+  8033b9:	50                   	push   %eax
+  8033ba:	e8 4f f7 ff ff       	call   802b0e <journal_dirty>
+	if ((di = dir_index(dir)) != NULL) {
+  8033bf:	89 f8                	mov    %edi,%eax
+  8033c1:	e8 fe fb ff ff       	call   802fc4 <dir_index>
+  8033c6:	89 c6                	mov    %eax,%esi
+  8033c8:	83 c4 10             	add    $0x10,%esp
+		for (i = 0; i < di->di_nslots / DIRSLOTS; i++)
+  8033cb:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if ((di = dir_index(dir)) != NULL) {
+  8033d0:	85 c0                	test   %eax,%eax
+  8033d2:	75 14                	jne    8033e8 <dir_index_drop+0x3a>
+  8033d4:	eb 2d                	jmp    803403 <dir_index_drop+0x55>
+			free_block(di->di_blocks[i]);
+  8033d6:	83 ec 0c             	sub    $0xc,%esp
+  8033d9:	ff 74 9e 10          	push   0x10(%esi,%ebx,4)
+  8033dd:	e8 8f fe ff ff       	call   803271 <free_block>
+		for (i = 0; i < di->di_nslots / DIRSLOTS; i++)
+  8033e2:	83 c3 01             	add    $0x1,%ebx
+  8033e5:	83 c4 10             	add    $0x10,%esp
+  8033e8:	8b 46 04             	mov    0x4(%esi),%eax
+  8033eb:	c1 e8 09             	shr    $0x9,%eax
+  8033ee:	39 c3                	cmp    %eax,%ebx
+  8033f0:	72 e4                	jb     8033d6 <dir_index_drop+0x28>
+		free_block(dir->f_index);
+  8033f2:	83 ec 0c             	sub    $0xc,%esp
+  8033f5:	ff b7 f8 00 00 00    	push   0xf8(%edi)
+  8033fb:	e8 71 fe ff ff       	call   803271 <free_block>
+  803400:	83 c4 10             	add    $0x10,%esp
+	dir->f_flags &= ~FILE_DIRINDEX;
+  803403:	83 a7 88 00 00 00 fd 	andl   $0xfffffffd,0x88(%edi)
+	dir->f_index = 0;
+  80340a:	c7 87 f8 00 00 00 00 	movl   $0x0,0xf8(%edi)
+  803411:	00 00 00 
+}
+  803414:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803417:	5b                   	pop    %ebx
+  803418:	5e                   	pop    %esi
+  803419:	5f                   	pop    %edi
+  80341a:	5d                   	pop    %ebp
+  80341b:	c3                   	ret
+
+0080341c <alloc_block_at>:
+{
+  80341c:	55                   	push   %ebp
+  80341d:	89 e5                	mov    %esp,%ebp
+  80341f:	56                   	push   %esi
+  803420:	53                   	push   %ebx
+  803421:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	if (fs_shared())
+  803424:	e8 74 db ff ff       	call   800f9d <fs_shared>
+  803429:	84 c0                	test   %al,%al
+  80342b:	0f 85 99 00 00 00    	jne    8034ca <alloc_block_at+0xae>
+	if (!block_is_free(blockno))
+  803431:	83 ec 0c             	sub    $0xc,%esp
+  803434:	53                   	push   %ebx
+  803435:	e8 f5 fc ff ff       	call   80312f <block_is_free>
+  80343a:	83 c4 10             	add    $0x10,%esp
+  80343d:	84 c0                	test   %al,%al
+  80343f:	0f 84 8c 00 00 00    	je     8034d1 <alloc_block_at+0xb5>
+	journal_dirty(&bitmap[blockno/32]);
+  803445:	89 de                	mov    %ebx,%esi
+  803447:	c1 ee 05             	shr    $0x5,%esi
+  80344a:	c1 e6 02             	shl    $0x2,%esi
+  80344d:	83 ec 0c             	sub    $0xc,%esp
+  803450:	89 f0                	mov    %esi,%eax
+  803452:	03 05 84 3f 84 00    	add    0x843f84,%eax
+  803458:	50                   	push   %eax
+  803459:	e8 b0 f6 ff ff       	call   802b0e <journal_dirty>
+	journal_dirty(super);
+  80345e:	83 c4 04             	add    $0x4,%esp
+  803461:	ff 35 88 3f 84 00    	push   0x843f88
+  803467:	e8 a2 f6 ff ff       	call   802b0e <journal_dirty>
+	bitmap[blockno/32] &= ~(1<<(blockno%32));
+  80346c:	03 35 84 3f 84 00    	add    0x843f84,%esi
+  803472:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  803477:	89 d9                	mov    %ebx,%ecx
+  803479:	d3 c0                	rol    %cl,%eax
+  80347b:	21 06                	and    %eax,(%esi)
+	super->s_nfree--;
+  80347d:	a1 88 3f 84 00       	mov    0x843f88,%eax
+  803482:	83 a8 08 01 00 00 01 	subl   $0x1,0x108(%eax)
+	ag_nfree[blockno / AG_BLOCKS]--;
+  803489:	89 d8                	mov    %ebx,%eax
+  80348b:	c1 e8 09             	shr    $0x9,%eax
+  80348e:	83 2c 85 e0 10 84 00 	subl   $0x1,0x8410e0(,%eax,4)
+  803495:	01 
+	if (journal_holds(blockno))
+  803496:	89 1c 24             	mov    %ebx,(%esp)
+  803499:	e8 13 f3 ff ff       	call   8027b1 <journal_holds>
+  80349e:	83 c4 10             	add    $0x10,%esp
+  8034a1:	84 c0                	test   %al,%al
+  8034a3:	75 0f                	jne    8034b4 <alloc_block_at+0x98>
+	alloc_cursor = blockno;
+  8034a5:	89 1d 00 10 84 00    	mov    %ebx,0x841000
+	return blockno;
+  8034ab:	89 d8                	mov    %ebx,%eax
+}
+  8034ad:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8034b0:	5b                   	pop    %ebx
+  8034b1:	5e                   	pop    %esi
+  8034b2:	5d                   	pop    %ebp
+  8034b3:	c3                   	ret
+		journal_dirty(diskaddr(blockno));
+  8034b4:	83 ec 0c             	sub    $0xc,%esp
+  8034b7:	53                   	push   %ebx
+  8034b8:	e8 d7 e3 ff ff       	call   801894 <diskaddr>
+  8034bd:	89 04 24             	mov    %eax,(%esp)
+  8034c0:	e8 49 f6 ff ff       	call   802b0e <journal_dirty>
+  8034c5:	83 c4 10             	add    $0x10,%esp
+  8034c8:	eb db                	jmp    8034a5 <alloc_block_at+0x89>
+		return -E_AGAIN;
+  8034ca:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8034cf:	eb dc                	jmp    8034ad <alloc_block_at+0x91>
+		return -E_NO_DISK;
+  8034d1:	b8 f7 ff ff ff       	mov    $0xfffffff7,%eax
+  8034d6:	eb d5                	jmp    8034ad <alloc_block_at+0x91>
+
+008034d8 <alloc_block_near>:
+{
+  8034d8:	55                   	push   %ebp
+  8034d9:	89 e5                	mov    %esp,%ebp
+  8034db:	57                   	push   %edi
+  8034dc:	56                   	push   %esi
+  8034dd:	53                   	push   %ebx
+  8034de:	83 ec 0c             	sub    $0xc,%esp
+  8034e1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8034e4:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if (fs_shared())
+  8034e7:	e8 b1 da ff ff       	call   800f9d <fs_shared>
+  8034ec:	84 c0                	test   %al,%al
+  8034ee:	75 6c                	jne    80355c <alloc_block_near+0x84>
+	if (super->s_nfree == 0)
+  8034f0:	a1 88 3f 84 00       	mov    0x843f88,%eax
+  8034f5:	83 b8 08 01 00 00 00 	cmpl   $0x0,0x108(%eax)
+  8034fc:	74 65                	je     803563 <alloc_block_near+0x8b>
+	if (goal >= super->s_nblocks)
+  8034fe:	3b 70 04             	cmp    0x4(%eax),%esi
+  803501:	72 05                	jb     803508 <alloc_block_near+0x30>
+		goal = 0;
+  803503:	be 00 00 00 00       	mov    $0x0,%esi
+	if ((r = alloc_search(goal, f, 0)) < 0 &&
+  803508:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80350d:	89 fa                	mov    %edi,%edx
+  80350f:	89 f0                	mov    %esi,%eax
+  803511:	e8 d7 f9 ff ff       	call   802eed <alloc_search>
+  803516:	89 c3                	mov    %eax,%ebx
+  803518:	85 c0                	test   %eax,%eax
+  80351a:	78 2a                	js     803546 <alloc_block_near+0x6e>
+	if ((r = alloc_block_at(r)) < 0)
+  80351c:	83 ec 0c             	sub    $0xc,%esp
+  80351f:	53                   	push   %ebx
+  803520:	e8 f7 fe ff ff       	call   80341c <alloc_block_at>
+  803525:	89 c3                	mov    %eax,%ebx
+	if (f)
+  803527:	83 c4 10             	add    $0x10,%esp
+  80352a:	85 ff                	test   %edi,%edi
+  80352c:	74 0e                	je     80353c <alloc_block_near+0x64>
+  80352e:	85 c0                	test   %eax,%eax
+  803530:	78 0a                	js     80353c <alloc_block_near+0x64>
+		pa_set(f, r + 1);
+  803532:	8d 50 01             	lea    0x1(%eax),%edx
+  803535:	89 f8                	mov    %edi,%eax
+  803537:	e8 33 fc ff ff       	call   80316f <pa_set>
+}
+  80353c:	89 d8                	mov    %ebx,%eax
+  80353e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803541:	5b                   	pop    %ebx
+  803542:	5e                   	pop    %esi
+  803543:	5f                   	pop    %edi
+  803544:	5d                   	pop    %ebp
+  803545:	c3                   	ret
+	    (r = alloc_search(goal, f, 1)) < 0)
+  803546:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80354b:	89 fa                	mov    %edi,%edx
+  80354d:	89 f0                	mov    %esi,%eax
+  80354f:	e8 99 f9 ff ff       	call   802eed <alloc_search>
+  803554:	89 c3                	mov    %eax,%ebx
+	if ((r = alloc_search(goal, f, 0)) < 0 &&
+  803556:	85 c0                	test   %eax,%eax
+  803558:	79 c2                	jns    80351c <alloc_block_near+0x44>
+  80355a:	eb e0                	jmp    80353c <alloc_block_near+0x64>
+		return -E_AGAIN;
+  80355c:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803561:	eb d9                	jmp    80353c <alloc_block_near+0x64>
+		return -E_NO_DISK;
+  803563:	bb f7 ff ff ff       	mov    $0xfffffff7,%ebx
+  803568:	eb d2                	jmp    80353c <alloc_block_near+0x64>
+
+0080356a <alloc_block>:
+{
+  80356a:	55                   	push   %ebp
+  80356b:	89 e5                	mov    %esp,%ebp
+  80356d:	83 ec 10             	sub    $0x10,%esp
+	return alloc_block_near(alloc_cursor, NULL);
+  803570:	6a 00                	push   $0x0
+  803572:	ff 35 00 10 84 00    	push   0x841000
+  803578:	e8 5b ff ff ff       	call   8034d8 <alloc_block_near>
+}
+  80357d:	c9                   	leave
+  80357e:	c3                   	ret
+
+0080357f <indirect_block>:
+{
+  80357f:	55                   	push   %ebp
+  803580:	89 e5                	mov    %esp,%ebp
+  803582:	56                   	push   %esi
+  803583:	53                   	push   %ebx
+		return 0;
+  803584:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (*pbno)
+  803589:	83 38 00             	cmpl   $0x0,(%eax)
+  80358c:	75 4c                	jne    8035da <indirect_block+0x5b>
+  80358e:	89 c6                	mov    %eax,%esi
+	if (!alloc)
+  803590:	84 d2                	test   %dl,%dl
+  803592:	74 4f                	je     8035e3 <indirect_block+0x64>
+	if ((r = alloc_block()) < 0)
+  803594:	e8 d1 ff ff ff       	call   80356a <alloc_block>
+  803599:	89 c3                	mov    %eax,%ebx
+  80359b:	85 c0                	test   %eax,%eax
+  80359d:	78 3b                	js     8035da <indirect_block+0x5b>
+	journal_dirty(diskaddr(r));
+  80359f:	83 ec 0c             	sub    $0xc,%esp
+  8035a2:	50                   	push   %eax
+  8035a3:	e8 ec e2 ff ff       	call   801894 <diskaddr>
+  8035a8:	89 04 24             	mov    %eax,(%esp)
+  8035ab:	e8 5e f5 ff ff       	call   802b0e <journal_dirty>
+	memset(diskaddr(r), 0, BLKSIZE);
+  8035b0:	89 1c 24             	mov    %ebx,(%esp)
+  8035b3:	e8 dc e2 ff ff       	call   801894 <diskaddr>
+  8035b8:	83 c4 0c             	add    $0xc,%esp
+  8035bb:	68 00 10 00 00       	push   $0x1000
+  8035c0:	6a 00                	push   $0x0
+  8035c2:	50                   	push   %eax
+  8035c3:	e8 22 3d 00 00       	call   8072ea <memset>
+	journal_dirty(pbno);
+  8035c8:	89 34 24             	mov    %esi,(%esp)
+  8035cb:	e8 3e f5 ff ff       	call   802b0e <journal_dirty>
+	*pbno = r;
+  8035d0:	89 1e                	mov    %ebx,(%esi)
+	return 0;
+  8035d2:	83 c4 10             	add    $0x10,%esp
+  8035d5:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  8035da:	89 d8                	mov    %ebx,%eax
+  8035dc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8035df:	5b                   	pop    %ebx
+  8035e0:	5e                   	pop    %esi
+  8035e1:	5d                   	pop    %ebp
+  8035e2:	c3                   	ret
+		return -E_NOT_FOUND;
+  8035e3:	bb f5 ff ff ff       	mov    $0xfffffff5,%ebx
+  8035e8:	eb f0                	jmp    8035da <indirect_block+0x5b>
+
+008035ea <file_block_walk>:
+{
+  8035ea:	55                   	push   %ebp
+  8035eb:	89 e5                	mov    %esp,%ebp
+  8035ed:	57                   	push   %edi
+  8035ee:	56                   	push   %esi
+  8035ef:	53                   	push   %ebx
+  8035f0:	83 ec 1c             	sub    $0x1c,%esp
+  8035f3:	89 c6                	mov    %eax,%esi
+  8035f5:	89 cf                	mov    %ecx,%edi
+  8035f7:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (filebno < NDIRECT) {
+  8035fa:	83 fa 09             	cmp    $0x9,%edx
+  8035fd:	0f 86 8b 00 00 00    	jbe    80368e <file_block_walk+0xa4>
+	filebno -= NDIRECT;
+  803603:	8d 5a f6             	lea    -0xa(%edx),%ebx
+	if (filebno < NINDIRECT) {
+  803606:	81 fb ff 03 00 00    	cmp    $0x3ff,%ebx
+  80360c:	0f 86 9b 00 00 00    	jbe    8036ad <file_block_walk+0xc3>
+	filebno -= NINDIRECT;
+  803612:	8d 9a f6 fb ff ff    	lea    -0x40a(%edx),%ebx
+	if (filebno >= NINDIRECT * NINDIRECT)
+  803618:	81 fb ff ff 0f 00    	cmp    $0xfffff,%ebx
+  80361e:	0f 87 c3 00 00 00    	ja     8036e7 <file_block_walk+0xfd>
+	if ((r = indirect_block(&f->f_dindirect, alloc)) < 0)
+  803624:	0f b6 c0             	movzbl %al,%eax
+  803627:	89 c1                	mov    %eax,%ecx
+  803629:	8d 86 b8 00 00 00    	lea    0xb8(%esi),%eax
+  80362f:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  803632:	89 ca                	mov    %ecx,%edx
+  803634:	e8 46 ff ff ff       	call   80357f <indirect_block>
+  803639:	85 c0                	test   %eax,%eax
+  80363b:	78 68                	js     8036a5 <file_block_walk+0xbb>
+	ind = (uint32_t *) diskaddr(f->f_dindirect);
+  80363d:	83 ec 0c             	sub    $0xc,%esp
+  803640:	ff b6 b8 00 00 00    	push   0xb8(%esi)
+  803646:	e8 49 e2 ff ff       	call   801894 <diskaddr>
+	if ((r = indirect_block(&ind[filebno / NINDIRECT], alloc)) < 0)
+  80364b:	89 de                	mov    %ebx,%esi
+  80364d:	c1 ee 0a             	shr    $0xa,%esi
+  803650:	8d 34 b0             	lea    (%eax,%esi,4),%esi
+  803653:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  803656:	89 f0                	mov    %esi,%eax
+  803658:	e8 22 ff ff ff       	call   80357f <indirect_block>
+  80365d:	83 c4 10             	add    $0x10,%esp
+  803660:	85 c0                	test   %eax,%eax
+  803662:	78 41                	js     8036a5 <file_block_walk+0xbb>
+	ind = (uint32_t *) diskaddr(ind[filebno / NINDIRECT]);
+  803664:	83 ec 0c             	sub    $0xc,%esp
+  803667:	ff 36                	push   (%esi)
+  803669:	e8 26 e2 ff ff       	call   801894 <diskaddr>
+  80366e:	89 c2                	mov    %eax,%edx
+	if (ppdiskbno)
+  803670:	83 c4 10             	add    $0x10,%esp
+	return 0;
+  803673:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (ppdiskbno)
+  803678:	85 ff                	test   %edi,%edi
+  80367a:	74 29                	je     8036a5 <file_block_walk+0xbb>
+		*ppdiskbno = &ind[filebno % NINDIRECT];
+  80367c:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  803682:	8d 04 9a             	lea    (%edx,%ebx,4),%eax
+  803685:	89 07                	mov    %eax,(%edi)
+	return 0;
+  803687:	b8 00 00 00 00       	mov    $0x0,%eax
+  80368c:	eb 17                	jmp    8036a5 <file_block_walk+0xbb>
+		return 0;
+  80368e:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (ppdiskbno)
+  803693:	85 c9                	test   %ecx,%ecx
+  803695:	74 0e                	je     8036a5 <file_block_walk+0xbb>
+			*ppdiskbno = &f->f_direct[filebno];
+  803697:	8d 84 96 8c 00 00 00 	lea    0x8c(%esi,%edx,4),%eax
+  80369e:	89 01                	mov    %eax,(%ecx)
+		return 0;
+  8036a0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8036a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8036a8:	5b                   	pop    %ebx
+  8036a9:	5e                   	pop    %esi
+  8036aa:	5f                   	pop    %edi
+  8036ab:	5d                   	pop    %ebp
+  8036ac:	c3                   	ret
+		if ((r = indirect_block(&f->f_indirect, alloc)) < 0)
+  8036ad:	0f b6 d0             	movzbl %al,%edx
+  8036b0:	8d 86 b4 00 00 00    	lea    0xb4(%esi),%eax
+  8036b6:	e8 c4 fe ff ff       	call   80357f <indirect_block>
+  8036bb:	85 c0                	test   %eax,%eax
+  8036bd:	78 e6                	js     8036a5 <file_block_walk+0xbb>
+		ind = (uint32_t *) diskaddr(f->f_indirect);
+  8036bf:	83 ec 0c             	sub    $0xc,%esp
+  8036c2:	ff b6 b4 00 00 00    	push   0xb4(%esi)
+  8036c8:	e8 c7 e1 ff ff       	call   801894 <diskaddr>
+  8036cd:	89 c2                	mov    %eax,%edx
+		if (ppdiskbno)
+  8036cf:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  8036d2:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (ppdiskbno)
+  8036d7:	85 ff                	test   %edi,%edi
+  8036d9:	74 ca                	je     8036a5 <file_block_walk+0xbb>
+			*ppdiskbno = &ind[filebno];
+  8036db:	8d 04 9a             	lea    (%edx,%ebx,4),%eax
+  8036de:	89 07                	mov    %eax,(%edi)
+		return 0;
+  8036e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036e5:	eb be                	jmp    8036a5 <file_block_walk+0xbb>
+		return -E_INVAL;
+  8036e7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8036ec:	eb b7                	jmp    8036a5 <file_block_walk+0xbb>
+
+008036ee <file_block_run>:
+{
+  8036ee:	55                   	push   %ebp
+  8036ef:	89 e5                	mov    %esp,%ebp
+  8036f1:	57                   	push   %edi
+  8036f2:	56                   	push   %esi
+  8036f3:	53                   	push   %ebx
+  8036f4:	83 ec 2c             	sub    $0x2c,%esp
+  8036f7:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+	if (f->f_flags & FILE_INLINE)
+  8036fa:	8b b0 88 00 00 00    	mov    0x88(%eax),%esi
+  803700:	89 f7                	mov    %esi,%edi
+  803702:	83 e7 04             	and    $0x4,%edi
+  803705:	75 69                	jne    803770 <file_block_run+0x82>
+  803707:	89 c3                	mov    %eax,%ebx
+	if (f->f_flags & FILE_EXTENTS)
+  803709:	83 e6 01             	and    $0x1,%esi
+  80370c:	75 2b                	jne    803739 <file_block_run+0x4b>
+	if (file_block_walk(f, filebno, &pdiskbno, 0) < 0 || *pdiskbno == 0)
+  80370e:	83 ec 0c             	sub    $0xc,%esp
+  803711:	6a 00                	push   $0x0
+  803713:	8d 4d e4             	lea    -0x1c(%ebp),%ecx
+  803716:	e8 cf fe ff ff       	call   8035ea <file_block_walk>
+  80371b:	83 c4 10             	add    $0x10,%esp
+		return 0;
+  80371e:	89 f7                	mov    %esi,%edi
+	if (file_block_walk(f, filebno, &pdiskbno, 0) < 0 || *pdiskbno == 0)
+  803720:	85 c0                	test   %eax,%eax
+  803722:	78 51                	js     803775 <file_block_run+0x87>
+  803724:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803727:	8b 38                	mov    (%eax),%edi
+  803729:	85 ff                	test   %edi,%edi
+  80372b:	74 48                	je     803775 <file_block_run+0x87>
+	*diskbno = *pdiskbno;
+  80372d:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  803730:	89 38                	mov    %edi,(%eax)
+	return 1;
+  803732:	bf 01 00 00 00       	mov    $0x1,%edi
+  803737:	eb 3c                	jmp    803775 <file_block_run+0x87>
+	for (i = 0; i < f->f_nextent; i++) {
+  803739:	8b b0 bc 00 00 00    	mov    0xbc(%eax),%esi
+  80373f:	89 f8                	mov    %edi,%eax
+  803741:	39 f0                	cmp    %esi,%eax
+  803743:	74 30                	je     803775 <file_block_run+0x87>
+		if (filebno < e->e_len) {
+  803745:	8b 8c c3 c4 00 00 00 	mov    0xc4(%ebx,%eax,8),%ecx
+  80374c:	39 ca                	cmp    %ecx,%edx
+  80374e:	72 07                	jb     803757 <file_block_run+0x69>
+		filebno -= e->e_len;
+  803750:	29 ca                	sub    %ecx,%edx
+	for (i = 0; i < f->f_nextent; i++) {
+  803752:	83 c0 01             	add    $0x1,%eax
+  803755:	eb ea                	jmp    803741 <file_block_run+0x53>
+			*diskbno = e->e_start + filebno;
+  803757:	89 d1                	mov    %edx,%ecx
+  803759:	03 8c c3 c0 00 00 00 	add    0xc0(%ebx,%eax,8),%ecx
+  803760:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+  803763:	89 0e                	mov    %ecx,(%esi)
+			return e->e_len - filebno;
+  803765:	8b bc c3 c4 00 00 00 	mov    0xc4(%ebx,%eax,8),%edi
+  80376c:	29 d7                	sub    %edx,%edi
+  80376e:	eb 05                	jmp    803775 <file_block_run+0x87>
+		return 0;
+  803770:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+  803775:	89 f8                	mov    %edi,%eax
+  803777:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80377a:	5b                   	pop    %ebx
+  80377b:	5e                   	pop    %esi
+  80377c:	5f                   	pop    %edi
+  80377d:	5d                   	pop    %ebp
+  80377e:	c3                   	ret
+
+0080377f <file_truncate_blocks>:
+// their pointers so you'll know whether they're valid.
+// A file truncated to nothing goes back to using extents.
+// Do not change f->f_size.
+static void
+file_truncate_blocks(struct File *f, off_t newsize)
+{
+  80377f:	55                   	push   %ebp
+  803780:	89 e5                	mov    %esp,%ebp
+  803782:	57                   	push   %edi
+  803783:	56                   	push   %esi
+  803784:	53                   	push   %ebx
+  803785:	83 ec 2c             	sub    $0x2c,%esp
+  803788:	89 c7                	mov    %eax,%edi
+  80378a:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  80378d:	89 d0                	mov    %edx,%eax
+	int r;
+	uint32_t bno, first, i, old_nblocks, new_nblocks, *dind;
+
+	old_nblocks = (f->f_size + BLKSIZE - 1) / BLKSIZE;
+  80378f:	8b 97 80 00 00 00    	mov    0x80(%edi),%edx
+  803795:	8d 8a fe 1f 00 00    	lea    0x1ffe(%edx),%ecx
+  80379b:	81 c2 ff 0f 00 00    	add    $0xfff,%edx
+  8037a1:	0f 48 d1             	cmovs  %ecx,%edx
+  8037a4:	c1 fa 0c             	sar    $0xc,%edx
+  8037a7:	89 d6                	mov    %edx,%esi
+	new_nblocks = (newsize + BLKSIZE - 1) / BLKSIZE;
+  8037a9:	8d 90 fe 1f 00 00    	lea    0x1ffe(%eax),%edx
+  8037af:	05 ff 0f 00 00       	add    $0xfff,%eax
+  8037b4:	0f 48 c2             	cmovs  %edx,%eax
+  8037b7:	c1 f8 0c             	sar    $0xc,%eax
+  8037ba:	89 c3                	mov    %eax,%ebx
+  8037bc:	89 45 d0             	mov    %eax,-0x30(%ebp)
+
+	pa_drop(f);
+  8037bf:	89 f8                	mov    %edi,%eax
+  8037c1:	e8 9c f6 ff ff       	call   802e62 <pa_drop>
+	if (f->f_flags & FILE_EXTENTS) {
+  8037c6:	f6 87 88 00 00 00 01 	testb  $0x1,0x88(%edi)
+  8037cd:	0f 84 4f 01 00 00    	je     803922 <file_truncate_blocks+0x1a3>
+		extent_truncate(f, new_nblocks);
+  8037d3:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  8037d6:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8037d9:	e8 1a fb ff ff       	call   8032f8 <extent_truncate>
+		return;
+  8037de:	eb 4a                	jmp    80382a <file_truncate_blocks+0xab>
+			journal_dirty(ptr);
+  8037e0:	83 ec 0c             	sub    $0xc,%esp
+  8037e3:	57                   	push   %edi
+  8037e4:	e8 25 f3 ff ff       	call   802b0e <journal_dirty>
+		free_block(*ptr);
+  8037e9:	83 c4 04             	add    $0x4,%esp
+  8037ec:	ff 37                	push   (%edi)
+  8037ee:	e8 7e fa ff ff       	call   803271 <free_block>
+			*ptr = 0;
+  8037f3:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  8037f9:	83 c4 10             	add    $0x10,%esp
+  8037fc:	e9 1e 01 00 00       	jmp    80391f <file_truncate_blocks+0x1a0>
+		r = file_free_block(f, bno, bno < NDIRECT || first < new_nblocks);
+		if (r < 0)
+			cprintf("warning: file_free_block: %e", r);
+	}
+
+	if (new_nblocks <= NDIRECT && f->f_indirect) {
+  803801:	83 7d d0 0a          	cmpl   $0xa,-0x30(%ebp)
+  803805:	77 0c                	ja     803813 <file_truncate_blocks+0x94>
+  803807:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80380a:	83 b8 b4 00 00 00 00 	cmpl   $0x0,0xb4(%eax)
+  803811:	75 1f                	jne    803832 <file_truncate_blocks+0xb3>
+		journal_dirty(f);
+		free_block(f->f_indirect);
+		f->f_indirect = 0;
+	}
+	if (f->f_dindirect) {
+  803813:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  803816:	8b 80 b8 00 00 00    	mov    0xb8(%eax),%eax
+  80381c:	85 c0                	test   %eax,%eax
+  80381e:	75 3a                	jne    80385a <file_truncate_blocks+0xdb>
+			free_block(f->f_dindirect);
+			f->f_dindirect = 0;
+		}
+	}
+
+	if (new_nblocks == 0) {
+  803820:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  803824:	0f 84 c9 00 00 00    	je     8038f3 <file_truncate_blocks+0x174>
+		journal_dirty(f);
+		f->f_flags |= FILE_EXTENTS;
+	}
+}
+  80382a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80382d:	5b                   	pop    %ebx
+  80382e:	5e                   	pop    %esi
+  80382f:	5f                   	pop    %edi
+  803830:	5d                   	pop    %ebp
+  803831:	c3                   	ret
+		journal_dirty(f);
+  803832:	83 ec 0c             	sub    $0xc,%esp
+  803835:	89 c7                	mov    %eax,%edi
+  803837:	50                   	push   %eax
+  803838:	e8 d1 f2 ff ff       	call   802b0e <journal_dirty>
+		free_block(f->f_indirect);
+  80383d:	83 c4 04             	add    $0x4,%esp
+  803840:	ff b7 b4 00 00 00    	push   0xb4(%edi)
+  803846:	e8 26 fa ff ff       	call   803271 <free_block>
+		f->f_indirect = 0;
+  80384b:	c7 87 b4 00 00 00 00 	movl   $0x0,0xb4(%edi)
+  803852:	00 00 00 
+  803855:	83 c4 10             	add    $0x10,%esp
+  803858:	eb b9                	jmp    803813 <file_truncate_blocks+0x94>
+		dind = (uint32_t *) diskaddr(f->f_dindirect);
+  80385a:	83 ec 0c             	sub    $0xc,%esp
+  80385d:	50                   	push   %eax
+  80385e:	e8 31 e0 ff ff       	call   801894 <diskaddr>
+		for (i = 0; i < NINDIRECT; i++) {
+  803863:	89 c3                	mov    %eax,%ebx
+  803865:	8d b8 00 10 00 00    	lea    0x1000(%eax),%edi
+  80386b:	83 c4 10             	add    $0x10,%esp
+  80386e:	be 0a 04 00 00       	mov    $0x40a,%esi
+  803873:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  803876:	eb 09                	jmp    803881 <file_truncate_blocks+0x102>
+  803878:	83 c3 04             	add    $0x4,%ebx
+  80387b:	81 c6 00 04 00 00    	add    $0x400,%esi
+  803881:	39 fb                	cmp    %edi,%ebx
+  803883:	74 35                	je     8038ba <file_truncate_blocks+0x13b>
+			if (dind[i] && bno >= new_nblocks) {
+  803885:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+  803888:	83 3b 00             	cmpl   $0x0,(%ebx)
+  80388b:	74 eb                	je     803878 <file_truncate_blocks+0xf9>
+  80388d:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  803890:	39 c6                	cmp    %eax,%esi
+  803892:	72 e4                	jb     803878 <file_truncate_blocks+0xf9>
+				journal_dirty(dind);
+  803894:	83 ec 0c             	sub    $0xc,%esp
+  803897:	ff 75 c8             	push   -0x38(%ebp)
+  80389a:	e8 6f f2 ff ff       	call   802b0e <journal_dirty>
+				free_block(dind[i]);
+  80389f:	83 c4 04             	add    $0x4,%esp
+  8038a2:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8038a5:	ff 30                	push   (%eax)
+  8038a7:	e8 c5 f9 ff ff       	call   803271 <free_block>
+				dind[i] = 0;
+  8038ac:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8038af:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  8038b5:	83 c4 10             	add    $0x10,%esp
+  8038b8:	eb be                	jmp    803878 <file_truncate_blocks+0xf9>
+		if (new_nblocks <= NDIRECT + NINDIRECT) {
+  8038ba:	81 7d d0 0a 04 00 00 	cmpl   $0x40a,-0x30(%ebp)
+  8038c1:	0f 87 63 ff ff ff    	ja     80382a <file_truncate_blocks+0xab>
+			journal_dirty(f);
+  8038c7:	83 ec 0c             	sub    $0xc,%esp
+  8038ca:	8b 7d cc             	mov    -0x34(%ebp),%edi
+  8038cd:	57                   	push   %edi
+  8038ce:	e8 3b f2 ff ff       	call   802b0e <journal_dirty>
+			free_block(f->f_dindirect);
+  8038d3:	83 c4 04             	add    $0x4,%esp
+  8038d6:	ff b7 b8 00 00 00    	push   0xb8(%edi)
+  8038dc:	e8 90 f9 ff ff       	call   803271 <free_block>
+			f->f_dindirect = 0;
+  8038e1:	c7 87 b8 00 00 00 00 	movl   $0x0,0xb8(%edi)
+  8038e8:	00 00 00 
+  8038eb:	83 c4 10             	add    $0x10,%esp
+  8038ee:	e9 2d ff ff ff       	jmp    803820 <file_truncate_blocks+0xa1>
+		journal_dirty(f);
+  8038f3:	83 ec 0c             	sub    $0xc,%esp
+  8038f6:	8b 7d cc             	mov    -0x34(%ebp),%edi
+  8038f9:	57                   	push   %edi
+  8038fa:	e8 0f f2 ff ff       	call   802b0e <journal_dirty>
+		f->f_flags |= FILE_EXTENTS;
+  8038ff:	83 8f 88 00 00 00 01 	orl    $0x1,0x88(%edi)
+  803906:	83 c4 10             	add    $0x10,%esp
+  803909:	e9 1c ff ff ff       	jmp    80382a <file_truncate_blocks+0xab>
+			cprintf("warning: file_free_block: %e", r);
+  80390e:	83 ec 08             	sub    $0x8,%esp
+  803911:	50                   	push   %eax
+  803912:	68 4c 9e 80 00       	push   $0x809e4c
+  803917:	e8 8f 32 00 00       	call   806bab <cprintf>
+  80391c:	83 c4 10             	add    $0x10,%esp
+	for (bno = new_nblocks; bno < old_nblocks; bno++) {
+  80391f:	83 c3 01             	add    $0x1,%ebx
+  803922:	39 f3                	cmp    %esi,%ebx
+  803924:	0f 83 d7 fe ff ff    	jae    803801 <file_truncate_blocks+0x82>
+		first = bno < NDIRECT + NINDIRECT ? NDIRECT :
+  80392a:	c7 45 d4 0a 00 00 00 	movl   $0xa,-0x2c(%ebp)
+  803931:	81 fb 09 04 00 00    	cmp    $0x409,%ebx
+  803937:	76 12                	jbe    80394b <file_truncate_blocks+0x1cc>
+			bno - (bno - NDIRECT - NINDIRECT) % NINDIRECT;
+  803939:	8d 83 f6 fb ff ff    	lea    -0x40a(%ebx),%eax
+  80393f:	25 ff 03 00 00       	and    $0x3ff,%eax
+		first = bno < NDIRECT + NINDIRECT ? NDIRECT :
+  803944:	89 da                	mov    %ebx,%edx
+  803946:	29 c2                	sub    %eax,%edx
+  803948:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+	if ((r = file_block_walk(f, filebno, &ptr, 0)) == -E_NOT_FOUND)
+  80394b:	83 ec 0c             	sub    $0xc,%esp
+  80394e:	6a 00                	push   $0x0
+  803950:	8d 4d e4             	lea    -0x1c(%ebp),%ecx
+  803953:	89 da                	mov    %ebx,%edx
+  803955:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  803958:	e8 8d fc ff ff       	call   8035ea <file_block_walk>
+  80395d:	83 c4 10             	add    $0x10,%esp
+  803960:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  803963:	74 ba                	je     80391f <file_truncate_blocks+0x1a0>
+	if (r < 0)
+  803965:	85 c0                	test   %eax,%eax
+  803967:	78 a5                	js     80390e <file_truncate_blocks+0x18f>
+	if (*ptr) {
+  803969:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80396c:	8b 07                	mov    (%edi),%eax
+  80396e:	85 c0                	test   %eax,%eax
+  803970:	74 ad                	je     80391f <file_truncate_blocks+0x1a0>
+		if (clear)
+  803972:	83 fb 09             	cmp    $0x9,%ebx
+  803975:	0f 86 65 fe ff ff    	jbe    8037e0 <file_truncate_blocks+0x61>
+  80397b:	8b 55 d0             	mov    -0x30(%ebp),%edx
+  80397e:	39 55 d4             	cmp    %edx,-0x2c(%ebp)
+  803981:	0f 82 59 fe ff ff    	jb     8037e0 <file_truncate_blocks+0x61>
+		free_block(*ptr);
+  803987:	83 ec 0c             	sub    $0xc,%esp
+  80398a:	50                   	push   %eax
+  80398b:	e8 e1 f8 ff ff       	call   803271 <free_block>
+  803990:	83 c4 10             	add    $0x10,%esp
+  803993:	eb 8a                	jmp    80391f <file_truncate_blocks+0x1a0>
+
+00803995 <extent_grow>:
+{
+  803995:	55                   	push   %ebp
+  803996:	89 e5                	mov    %esp,%ebp
+  803998:	57                   	push   %edi
+  803999:	56                   	push   %esi
+  80399a:	53                   	push   %ebx
+  80399b:	83 ec 1c             	sub    $0x1c,%esp
+  80399e:	89 c3                	mov    %eax,%ebx
+	if (f->f_nextent == 0)
+  8039a0:	8b 80 bc 00 00 00    	mov    0xbc(%eax),%eax
+  8039a6:	85 c0                	test   %eax,%eax
+  8039a8:	74 67                	je     803a11 <extent_grow+0x7c>
+	next = e->e_start + e->e_len;
+  8039aa:	8d 3c c3             	lea    (%ebx,%eax,8),%edi
+  8039ad:	8b b7 bc 00 00 00    	mov    0xbc(%edi),%esi
+  8039b3:	03 b7 b8 00 00 00    	add    0xb8(%edi),%esi
+	if (!block_is_free(next) || pa_reserved(next, f) ||
+  8039b9:	83 ec 0c             	sub    $0xc,%esp
+  8039bc:	56                   	push   %esi
+  8039bd:	e8 6d f7 ff ff       	call   80312f <block_is_free>
+  8039c2:	83 c4 10             	add    $0x10,%esp
+  8039c5:	88 45 e7             	mov    %al,-0x19(%ebp)
+  8039c8:	84 c0                	test   %al,%al
+  8039ca:	74 49                	je     803a15 <extent_grow+0x80>
+  8039cc:	89 da                	mov    %ebx,%edx
+  8039ce:	89 f0                	mov    %esi,%eax
+  8039d0:	e8 41 f4 ff ff       	call   802e16 <pa_reserved>
+  8039d5:	88 45 e6             	mov    %al,-0x1a(%ebp)
+  8039d8:	84 c0                	test   %al,%al
+  8039da:	74 06                	je     8039e2 <extent_grow+0x4d>
+		return 0;
+  8039dc:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+  8039e0:	eb 33                	jmp    803a15 <extent_grow+0x80>
+	    alloc_block_at(next) < 0)
+  8039e2:	83 ec 0c             	sub    $0xc,%esp
+  8039e5:	56                   	push   %esi
+  8039e6:	e8 31 fa ff ff       	call   80341c <alloc_block_at>
+	if (!block_is_free(next) || pa_reserved(next, f) ||
+  8039eb:	83 c4 10             	add    $0x10,%esp
+  8039ee:	85 c0                	test   %eax,%eax
+  8039f0:	78 2f                	js     803a21 <extent_grow+0x8c>
+	pa_set(f, next + 1);
+  8039f2:	8d 56 01             	lea    0x1(%esi),%edx
+  8039f5:	89 d8                	mov    %ebx,%eax
+  8039f7:	e8 73 f7 ff ff       	call   80316f <pa_set>
+	journal_dirty(f);
+  8039fc:	83 ec 0c             	sub    $0xc,%esp
+  8039ff:	53                   	push   %ebx
+  803a00:	e8 09 f1 ff ff       	call   802b0e <journal_dirty>
+	e->e_len++;
+  803a05:	83 87 bc 00 00 00 01 	addl   $0x1,0xbc(%edi)
+	return 1;
+  803a0c:	83 c4 10             	add    $0x10,%esp
+  803a0f:	eb 04                	jmp    803a15 <extent_grow+0x80>
+		return 0;
+  803a11:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+}
+  803a15:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+  803a19:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a1c:	5b                   	pop    %ebx
+  803a1d:	5e                   	pop    %esi
+  803a1e:	5f                   	pop    %edi
+  803a1f:	5d                   	pop    %ebp
+  803a20:	c3                   	ret
+		return 0;
+  803a21:	0f b6 45 e6          	movzbl -0x1a(%ebp),%eax
+  803a25:	88 45 e7             	mov    %al,-0x19(%ebp)
+  803a28:	eb eb                	jmp    803a15 <extent_grow+0x80>
+
+00803a2a <extent_append>:
+{
+  803a2a:	55                   	push   %ebp
+  803a2b:	89 e5                	mov    %esp,%ebp
+  803a2d:	57                   	push   %edi
+  803a2e:	56                   	push   %esi
+  803a2f:	53                   	push   %ebx
+  803a30:	83 ec 6c             	sub    $0x6c,%esp
+  803a33:	89 c7                	mov    %eax,%edi
+  803a35:	89 45 a0             	mov    %eax,-0x60(%ebp)
+	if (fs_shared())
+  803a38:	e8 60 d5 ff ff       	call   800f9d <fs_shared>
+  803a3d:	84 c0                	test   %al,%al
+  803a3f:	0f 85 d4 01 00 00    	jne    803c19 <extent_append+0x1ef>
+	if (extent_grow(f))
+  803a45:	89 f8                	mov    %edi,%eax
+  803a47:	e8 49 ff ff ff       	call   803995 <extent_grow>
+  803a4c:	84 c0                	test   %al,%al
+  803a4e:	0f 85 cc 01 00 00    	jne    803c20 <extent_append+0x1f6>
+	if (f->f_nextent == NEXTENT)
+  803a54:	8b 9f bc 00 00 00    	mov    0xbc(%edi),%ebx
+  803a5a:	83 fb 07             	cmp    $0x7,%ebx
+  803a5d:	74 6a                	je     803ac9 <extent_append+0x9f>
+	next = file_home(f);
+  803a5f:	8b 75 a0             	mov    -0x60(%ebp),%esi
+  803a62:	89 f0                	mov    %esi,%eax
+  803a64:	e8 23 f4 ff ff       	call   802e8c <file_home>
+	if (f->f_nextent > 0) {
+  803a69:	85 db                	test   %ebx,%ebx
+  803a6b:	74 0e                	je     803a7b <extent_append+0x51>
+		next = e->e_start + e->e_len;
+  803a6d:	8b 84 de b8 00 00 00 	mov    0xb8(%esi,%ebx,8),%eax
+  803a74:	03 84 de bc 00 00 00 	add    0xbc(%esi,%ebx,8),%eax
+	if ((r = alloc_block_near(next, f)) < 0)
+  803a7b:	83 ec 08             	sub    $0x8,%esp
+  803a7e:	8b 7d a0             	mov    -0x60(%ebp),%edi
+  803a81:	57                   	push   %edi
+  803a82:	50                   	push   %eax
+  803a83:	e8 50 fa ff ff       	call   8034d8 <alloc_block_near>
+  803a88:	89 c3                	mov    %eax,%ebx
+  803a8a:	83 c4 10             	add    $0x10,%esp
+  803a8d:	85 c0                	test   %eax,%eax
+  803a8f:	0f 88 90 01 00 00    	js     803c25 <extent_append+0x1fb>
+	journal_dirty(f);
+  803a95:	83 ec 0c             	sub    $0xc,%esp
+  803a98:	57                   	push   %edi
+  803a99:	e8 70 f0 ff ff       	call   802b0e <journal_dirty>
+	e = &f->f_extent[f->f_nextent++];
+  803a9e:	8b 87 bc 00 00 00    	mov    0xbc(%edi),%eax
+  803aa4:	8d 50 01             	lea    0x1(%eax),%edx
+  803aa7:	89 97 bc 00 00 00    	mov    %edx,0xbc(%edi)
+	e->e_start = r;
+  803aad:	83 c0 16             	add    $0x16,%eax
+  803ab0:	89 5c c7 10          	mov    %ebx,0x10(%edi,%eax,8)
+	e->e_len = 1;
+  803ab4:	c7 44 c7 14 01 00 00 	movl   $0x1,0x14(%edi,%eax,8)
+  803abb:	00 
+	return 0;
+  803abc:	83 c4 10             	add    $0x10,%esp
+  803abf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803ac4:	e9 5c 01 00 00       	jmp    803c25 <extent_append+0x1fb>
+	extent_truncate(f, ROUNDUP(f->f_size, BLKSIZE) / BLKSIZE);
+  803ac9:	8b 7d a0             	mov    -0x60(%ebp),%edi
+  803acc:	89 f8                	mov    %edi,%eax
+  803ace:	8b 97 80 00 00 00    	mov    0x80(%edi),%edx
+  803ad4:	89 55 a4             	mov    %edx,-0x5c(%ebp)
+  803ad7:	81 c2 ff 0f 00 00    	add    $0xfff,%edx
+  803add:	c1 fa 0c             	sar    $0xc,%edx
+  803ae0:	e8 13 f8 ff ff       	call   8032f8 <extent_truncate>
+	if (f->f_nextent < NEXTENT)
+  803ae5:	89 fa                	mov    %edi,%edx
+  803ae7:	89 f8                	mov    %edi,%eax
+  803ae9:	8b bf bc 00 00 00    	mov    0xbc(%edi),%edi
+  803aef:	89 7d 94             	mov    %edi,-0x6c(%ebp)
+  803af2:	83 ff 06             	cmp    $0x6,%edi
+  803af5:	0f 86 10 01 00 00    	jbe    803c0b <extent_append+0x1e1>
+  803afb:	8d 0c fa             	lea    (%edx,%edi,8),%ecx
+	bno = 0;
+  803afe:	ba 00 00 00 00       	mov    $0x0,%edx
+  803b03:	eb 09                	jmp    803b0e <extent_append+0xe4>
+		bno += f->f_extent[i].e_len;
+  803b05:	03 90 c4 00 00 00    	add    0xc4(%eax),%edx
+	for (i = 0; i < f->f_nextent; i++)
+  803b0b:	83 c0 08             	add    $0x8,%eax
+  803b0e:	39 c8                	cmp    %ecx,%eax
+  803b10:	75 f3                	jne    803b05 <extent_append+0xdb>
+	if (bno > NDIRECT)
+  803b12:	83 fa 0a             	cmp    $0xa,%edx
+  803b15:	76 28                	jbe    803b3f <extent_append+0x115>
+		nind++;
+  803b17:	b8 01 00 00 00       	mov    $0x1,%eax
+	if (bno > NDIRECT + NINDIRECT)
+  803b1c:	81 fa 0a 04 00 00    	cmp    $0x40a,%edx
+  803b22:	76 09                	jbe    803b2d <extent_append+0x103>
+		nind += 1 + ROUNDUP(bno - NDIRECT - NINDIRECT, NINDIRECT) / NINDIRECT;
+  803b24:	8d 42 f5             	lea    -0xb(%edx),%eax
+  803b27:	c1 e8 0a             	shr    $0xa,%eax
+  803b2a:	83 c0 02             	add    $0x2,%eax
+	if (super->s_nfree < nind)
+  803b2d:	8b 15 88 3f 84 00    	mov    0x843f88,%edx
+  803b33:	39 82 08 01 00 00    	cmp    %eax,0x108(%edx)
+  803b39:	0f 82 d3 00 00 00    	jb     803c12 <extent_append+0x1e8>
+	journal_dirty(f);
+  803b3f:	83 ec 0c             	sub    $0xc,%esp
+  803b42:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  803b45:	53                   	push   %ebx
+  803b46:	e8 c3 ef ff ff       	call   802b0e <journal_dirty>
+	memmove(ext, f->f_extent, sizeof(ext));
+  803b4b:	8d b3 c0 00 00 00    	lea    0xc0(%ebx),%esi
+  803b51:	83 c4 0c             	add    $0xc,%esp
+  803b54:	6a 38                	push   $0x38
+  803b56:	56                   	push   %esi
+  803b57:	8d 7d b0             	lea    -0x50(%ebp),%edi
+  803b5a:	57                   	push   %edi
+  803b5b:	e8 bf 37 00 00       	call   80731f <memmove>
+	memset(f->f_extent, 0, sizeof(f->f_extent));
+  803b60:	83 c4 0c             	add    $0xc,%esp
+  803b63:	6a 38                	push   $0x38
+  803b65:	6a 00                	push   $0x0
+  803b67:	56                   	push   %esi
+  803b68:	e8 7d 37 00 00       	call   8072ea <memset>
+	f->f_nextent = 0;
+  803b6d:	c7 83 bc 00 00 00 00 	movl   $0x0,0xbc(%ebx)
+  803b74:	00 00 00 
+	f->f_flags &= ~FILE_EXTENTS;
+  803b77:	83 a3 88 00 00 00 fe 	andl   $0xfffffffe,0x88(%ebx)
+	for (i = 0; i < n; i++)
+  803b7e:	83 c4 10             	add    $0x10,%esp
+	bno = 0;
+  803b81:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%ebp)
+	for (i = 0; i < n; i++)
+  803b88:	c7 45 98 00 00 00 00 	movl   $0x0,-0x68(%ebp)
+		for (j = 0; j < ext[i].e_len; j++, bno++) {
+  803b8f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803b94:	eb 1b                	jmp    803bb1 <extent_append+0x187>
+			journal_dirty(ptr);
+  803b96:	8b 75 ac             	mov    -0x54(%ebp),%esi
+  803b99:	83 ec 0c             	sub    $0xc,%esp
+  803b9c:	56                   	push   %esi
+  803b9d:	e8 6c ef ff ff       	call   802b0e <journal_dirty>
+			*ptr = ext[i].e_start + j;
+  803ba2:	8b 4d a4             	mov    -0x5c(%ebp),%ecx
+  803ba5:	89 d8                	mov    %ebx,%eax
+  803ba7:	03 01                	add    (%ecx),%eax
+  803ba9:	89 06                	mov    %eax,(%esi)
+		for (j = 0; j < ext[i].e_len; j++, bno++) {
+  803bab:	83 c3 01             	add    $0x1,%ebx
+  803bae:	83 c4 10             	add    $0x10,%esp
+  803bb1:	8b 45 9c             	mov    -0x64(%ebp),%eax
+  803bb4:	8d 14 03             	lea    (%ebx,%eax,1),%edx
+  803bb7:	89 7d a4             	mov    %edi,-0x5c(%ebp)
+  803bba:	3b 5f 04             	cmp    0x4(%edi),%ebx
+  803bbd:	73 2c                	jae    803beb <extent_append+0x1c1>
+			if ((r = file_block_walk(f, bno, &ptr, 1)) < 0)
+  803bbf:	83 ec 0c             	sub    $0xc,%esp
+  803bc2:	6a 01                	push   $0x1
+  803bc4:	8d 4d ac             	lea    -0x54(%ebp),%ecx
+  803bc7:	8b 45 a0             	mov    -0x60(%ebp),%eax
+  803bca:	e8 1b fa ff ff       	call   8035ea <file_block_walk>
+  803bcf:	83 c4 10             	add    $0x10,%esp
+  803bd2:	85 c0                	test   %eax,%eax
+  803bd4:	79 c0                	jns    803b96 <extent_append+0x16c>
+				panic("file_extents_to_tree: %e", r);
+  803bd6:	50                   	push   %eax
+  803bd7:	68 69 9e 80 00       	push   $0x809e69
+  803bdc:	68 16 02 00 00       	push   $0x216
+  803be1:	68 fc 9d 80 00       	push   $0x809dfc
+  803be6:	e8 e5 2e 00 00       	call   806ad0 <_panic>
+	for (i = 0; i < n; i++)
+  803beb:	83 45 98 01          	addl   $0x1,-0x68(%ebp)
+  803bef:	8b 45 98             	mov    -0x68(%ebp),%eax
+  803bf2:	83 c7 08             	add    $0x8,%edi
+  803bf5:	39 45 94             	cmp    %eax,-0x6c(%ebp)
+  803bf8:	74 0a                	je     803c04 <extent_append+0x1da>
+  803bfa:	89 55 9c             	mov    %edx,-0x64(%ebp)
+		for (j = 0; j < ext[i].e_len; j++, bno++) {
+  803bfd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803c02:	eb ad                	jmp    803bb1 <extent_append+0x187>
+	return 0;
+  803c04:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803c09:	eb 1a                	jmp    803c25 <extent_append+0x1fb>
+		return 0;
+  803c0b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803c10:	eb 13                	jmp    803c25 <extent_append+0x1fb>
+		return -E_NO_DISK;
+  803c12:	bb f7 ff ff ff       	mov    $0xfffffff7,%ebx
+		return file_extents_to_tree(f);
+  803c17:	eb 0c                	jmp    803c25 <extent_append+0x1fb>
+		return -E_AGAIN;
+  803c19:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803c1e:	eb 05                	jmp    803c25 <extent_append+0x1fb>
+		return 0;
+  803c20:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  803c25:	89 d8                	mov    %ebx,%eax
+  803c27:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803c2a:	5b                   	pop    %ebx
+  803c2b:	5e                   	pop    %esi
+  803c2c:	5f                   	pop    %edi
+  803c2d:	5d                   	pop    %ebp
+  803c2e:	c3                   	ret
+
+00803c2f <check_bitmap>:
+{
+  803c2f:	55                   	push   %ebp
+  803c30:	89 e5                	mov    %esp,%ebp
+  803c32:	57                   	push   %edi
+  803c33:	56                   	push   %esi
+  803c34:	53                   	push   %ebx
+  803c35:	83 ec 0c             	sub    $0xc,%esp
+	for (i = 0; i * BLKBITSIZE < super->s_nblocks; i++)
+  803c38:	8b 35 88 3f 84 00    	mov    0x843f88,%esi
+  803c3e:	8b 7e 04             	mov    0x4(%esi),%edi
+  803c41:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803c46:	89 d8                	mov    %ebx,%eax
+  803c48:	c1 e0 0f             	shl    $0xf,%eax
+  803c4b:	39 f8                	cmp    %edi,%eax
+  803c4d:	73 31                	jae    803c80 <check_bitmap+0x51>
+		assert(!block_is_free(2+i));
+  803c4f:	83 ec 0c             	sub    $0xc,%esp
+  803c52:	8d 43 02             	lea    0x2(%ebx),%eax
+  803c55:	50                   	push   %eax
+  803c56:	e8 d4 f4 ff ff       	call   80312f <block_is_free>
+  803c5b:	83 c4 10             	add    $0x10,%esp
+  803c5e:	84 c0                	test   %al,%al
+  803c60:	75 05                	jne    803c67 <check_bitmap+0x38>
+	for (i = 0; i * BLKBITSIZE < super->s_nblocks; i++)
+  803c62:	83 c3 01             	add    $0x1,%ebx
+  803c65:	eb df                	jmp    803c46 <check_bitmap+0x17>
+		assert(!block_is_free(2+i));
+  803c67:	68 82 9e 80 00       	push   $0x809e82
+  803c6c:	68 2e 99 80 00       	push   $0x80992e
+  803c71:	68 59 01 00 00       	push   $0x159
+  803c76:	68 fc 9d 80 00       	push   $0x809dfc
+  803c7b:	e8 50 2e 00 00       	call   806ad0 <_panic>
+	assert(!block_is_free(0));
+  803c80:	83 ec 0c             	sub    $0xc,%esp
+  803c83:	6a 00                	push   $0x0
+  803c85:	e8 a5 f4 ff ff       	call   80312f <block_is_free>
+  803c8a:	83 c4 10             	add    $0x10,%esp
+  803c8d:	84 c0                	test   %al,%al
+  803c8f:	75 3d                	jne    803cce <check_bitmap+0x9f>
+	assert(!block_is_free(1));
+  803c91:	83 ec 0c             	sub    $0xc,%esp
+  803c94:	6a 01                	push   $0x1
+  803c96:	e8 94 f4 ff ff       	call   80312f <block_is_free>
+  803c9b:	83 c4 10             	add    $0x10,%esp
+  803c9e:	84 c0                	test   %al,%al
+  803ca0:	75 45                	jne    803ce7 <check_bitmap+0xb8>
+	for (i = 0; i < super->s_njournal; i++)
+  803ca2:	8b be 10 01 00 00    	mov    0x110(%esi),%edi
+  803ca8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803cad:	39 df                	cmp    %ebx,%edi
+  803caf:	74 68                	je     803d19 <check_bitmap+0xea>
+		assert(!block_is_free(super->s_journal + i));
+  803cb1:	83 ec 0c             	sub    $0xc,%esp
+  803cb4:	89 d8                	mov    %ebx,%eax
+  803cb6:	03 86 0c 01 00 00    	add    0x10c(%esi),%eax
+  803cbc:	50                   	push   %eax
+  803cbd:	e8 6d f4 ff ff       	call   80312f <block_is_free>
+  803cc2:	83 c4 10             	add    $0x10,%esp
+  803cc5:	84 c0                	test   %al,%al
+  803cc7:	75 37                	jne    803d00 <check_bitmap+0xd1>
+	for (i = 0; i < super->s_njournal; i++)
+  803cc9:	83 c3 01             	add    $0x1,%ebx
+  803ccc:	eb df                	jmp    803cad <check_bitmap+0x7e>
+	assert(!block_is_free(0));
+  803cce:	68 96 9e 80 00       	push   $0x809e96
+  803cd3:	68 2e 99 80 00       	push   $0x80992e
+  803cd8:	68 5c 01 00 00       	push   $0x15c
+  803cdd:	68 fc 9d 80 00       	push   $0x809dfc
+  803ce2:	e8 e9 2d 00 00       	call   806ad0 <_panic>
+	assert(!block_is_free(1));
+  803ce7:	68 a8 9e 80 00       	push   $0x809ea8
+  803cec:	68 2e 99 80 00       	push   $0x80992e
+  803cf1:	68 5d 01 00 00       	push   $0x15d
+  803cf6:	68 fc 9d 80 00       	push   $0x809dfc
+  803cfb:	e8 d0 2d 00 00       	call   806ad0 <_panic>
+		assert(!block_is_free(super->s_journal + i));
+  803d00:	68 08 9f 80 00       	push   $0x809f08
+  803d05:	68 2e 99 80 00       	push   $0x80992e
+  803d0a:	68 61 01 00 00       	push   $0x161
+  803d0f:	68 fc 9d 80 00       	push   $0x809dfc
+  803d14:	e8 b7 2d 00 00       	call   806ad0 <_panic>
+	cprintf("bitmap is good\n");
+  803d19:	83 ec 0c             	sub    $0xc,%esp
+  803d1c:	68 ba 9e 80 00       	push   $0x809eba
+  803d21:	e8 85 2e 00 00       	call   806bab <cprintf>
+}
+  803d26:	83 c4 10             	add    $0x10,%esp
+  803d29:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803d2c:	5b                   	pop    %ebx
+  803d2d:	5e                   	pop    %esi
+  803d2e:	5f                   	pop    %edi
+  803d2f:	5d                   	pop    %ebp
+  803d30:	c3                   	ret
+
+00803d31 <fs_init>:
+{
+  803d31:	55                   	push   %ebp
+  803d32:	89 e5                	mov    %esp,%ebp
+  803d34:	53                   	push   %ebx
+  803d35:	83 ec 04             	sub    $0x4,%esp
+	disk_init();
+  803d38:	e8 1a d0 ff ff       	call   800d57 <disk_init>
+	bc_init();
+  803d3d:	e8 a5 e7 ff ff       	call   8024e7 <bc_init>
+	super = diskaddr(1);
+  803d42:	83 ec 0c             	sub    $0xc,%esp
+  803d45:	6a 01                	push   $0x1
+  803d47:	e8 48 db ff ff       	call   801894 <diskaddr>
+  803d4c:	a3 88 3f 84 00       	mov    %eax,0x843f88
+	check_super();
+  803d51:	e8 83 f3 ff ff       	call   8030d9 <check_super>
+	journal_init();
+  803d56:	e8 46 ee ff ff       	call   802ba1 <journal_init>
+	bitmap = diskaddr(2);
+  803d5b:	c7 04 24 02 00 00 00 	movl   $0x2,(%esp)
+  803d62:	e8 2d db ff ff       	call   801894 <diskaddr>
+  803d67:	a3 84 3f 84 00       	mov    %eax,0x843f84
+	check_bitmap();
+  803d6c:	e8 be fe ff ff       	call   803c2f <check_bitmap>
+	if (super->s_nfree != count_free_blocks()) {
+  803d71:	a1 88 3f 84 00       	mov    0x843f88,%eax
+  803d76:	8b 98 08 01 00 00    	mov    0x108(%eax),%ebx
+  803d7c:	e8 8d f4 ff ff       	call   80320e <count_free_blocks>
+  803d81:	83 c4 10             	add    $0x10,%esp
+  803d84:	39 c3                	cmp    %eax,%ebx
+  803d86:	75 05                	jne    803d8d <fs_init+0x5c>
+}
+  803d88:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803d8b:	c9                   	leave
+  803d8c:	c3                   	ret
+		journal_dirty(super);
+  803d8d:	83 ec 0c             	sub    $0xc,%esp
+  803d90:	ff 35 88 3f 84 00    	push   0x843f88
+  803d96:	e8 73 ed ff ff       	call   802b0e <journal_dirty>
+		super->s_nfree = count_free_blocks();
+  803d9b:	8b 1d 88 3f 84 00    	mov    0x843f88,%ebx
+  803da1:	e8 68 f4 ff ff       	call   80320e <count_free_blocks>
+  803da6:	89 83 08 01 00 00    	mov    %eax,0x108(%ebx)
+		journal_commit();
+  803dac:	e8 e8 ea ff ff       	call   802899 <journal_commit>
+  803db1:	83 c4 10             	add    $0x10,%esp
+}
+  803db4:	eb d2                	jmp    803d88 <fs_init+0x57>
+
+00803db6 <file_get_block>:
+{
+  803db6:	55                   	push   %ebp
+  803db7:	89 e5                	mov    %esp,%ebp
+  803db9:	57                   	push   %edi
+  803dba:	56                   	push   %esi
+  803dbb:	53                   	push   %ebx
+  803dbc:	83 ec 2c             	sub    $0x2c,%esp
+  803dbf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  803dc2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	if (filebno >= MAXFILESIZE / BLKSIZE)
+  803dc5:	81 ff fe ff 07 00    	cmp    $0x7fffe,%edi
+  803dcb:	0f 87 0d 01 00 00    	ja     803ede <file_get_block+0x128>
+	if ((f->f_flags & FILE_INLINE) && (r = file_inline_out(f)) < 0)
+  803dd1:	f6 83 88 00 00 00 04 	testb  $0x4,0x88(%ebx)
+  803dd8:	74 45                	je     803e1f <file_get_block+0x69>
+  803dda:	89 d8                	mov    %ebx,%eax
+  803ddc:	e8 0e 01 00 00       	call   803eef <file_inline_out>
+  803de1:	89 c6                	mov    %eax,%esi
+  803de3:	85 c0                	test   %eax,%eax
+  803de5:	79 38                	jns    803e1f <file_get_block+0x69>
+  803de7:	eb 1d                	jmp    803e06 <file_get_block+0x50>
+			*blk = bc_lookup(diskbno);
+  803de9:	83 ec 0c             	sub    $0xc,%esp
+			*diskbno = e->e_start + filebno;
+  803dec:	03 94 c3 c0 00 00 00 	add    0xc0(%ebx,%eax,8),%edx
+			*blk = bc_lookup(diskbno);
+  803df3:	52                   	push   %edx
+  803df4:	e8 d8 dc ff ff       	call   801ad1 <bc_lookup>
+  803df9:	8b 7d 10             	mov    0x10(%ebp),%edi
+  803dfc:	89 07                	mov    %eax,(%edi)
+			return 0;
+  803dfe:	83 c4 10             	add    $0x10,%esp
+  803e01:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  803e06:	89 f0                	mov    %esi,%eax
+  803e08:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803e0b:	5b                   	pop    %ebx
+  803e0c:	5e                   	pop    %esi
+  803e0d:	5f                   	pop    %edi
+  803e0e:	5d                   	pop    %ebp
+  803e0f:	c3                   	ret
+		if ((r = extent_append(f)) < 0)
+  803e10:	89 d8                	mov    %ebx,%eax
+  803e12:	e8 13 fc ff ff       	call   803a2a <extent_append>
+  803e17:	85 c0                	test   %eax,%eax
+  803e19:	0f 88 c9 00 00 00    	js     803ee8 <file_get_block+0x132>
+	while (f->f_flags & FILE_EXTENTS) {
+  803e1f:	f6 83 88 00 00 00 01 	testb  $0x1,0x88(%ebx)
+  803e26:	74 23                	je     803e4b <file_get_block+0x95>
+	for (i = 0; i < f->f_nextent; i++) {
+  803e28:	8b b3 bc 00 00 00    	mov    0xbc(%ebx),%esi
+  803e2e:	89 fa                	mov    %edi,%edx
+  803e30:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e35:	39 f0                	cmp    %esi,%eax
+  803e37:	74 d7                	je     803e10 <file_get_block+0x5a>
+		if (filebno < e->e_len) {
+  803e39:	8b 8c c3 c4 00 00 00 	mov    0xc4(%ebx,%eax,8),%ecx
+  803e40:	39 ca                	cmp    %ecx,%edx
+  803e42:	72 a5                	jb     803de9 <file_get_block+0x33>
+		filebno -= e->e_len;
+  803e44:	29 ca                	sub    %ecx,%edx
+	for (i = 0; i < f->f_nextent; i++) {
+  803e46:	83 c0 01             	add    $0x1,%eax
+  803e49:	eb ea                	jmp    803e35 <file_get_block+0x7f>
+	if ((r = file_block_walk(f, filebno, &pdiskbno, true)) < 0)
+  803e4b:	83 ec 0c             	sub    $0xc,%esp
+  803e4e:	6a 01                	push   $0x1
+  803e50:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  803e53:	89 fa                	mov    %edi,%edx
+  803e55:	89 d8                	mov    %ebx,%eax
+  803e57:	e8 8e f7 ff ff       	call   8035ea <file_block_walk>
+  803e5c:	89 c6                	mov    %eax,%esi
+  803e5e:	83 c4 10             	add    $0x10,%esp
+  803e61:	85 c0                	test   %eax,%eax
+  803e63:	78 a1                	js     803e06 <file_get_block+0x50>
+	if (!*pdiskbno) {
+  803e65:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803e68:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  803e6b:	83 38 00             	cmpl   $0x0,(%eax)
+  803e6e:	75 36                	jne    803ea6 <file_get_block+0xf0>
+		if (filebno > 0 && file_block_run(f, filebno - 1, &diskbno) > 0)
+  803e70:	85 ff                	test   %edi,%edi
+  803e72:	75 51                	jne    803ec5 <file_get_block+0x10f>
+			diskbno = file_home(f);
+  803e74:	89 d8                	mov    %ebx,%eax
+  803e76:	e8 11 f0 ff ff       	call   802e8c <file_home>
+  803e7b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		if ((r = alloc_block_near(diskbno, f)) < 0)
+  803e7e:	83 ec 08             	sub    $0x8,%esp
+  803e81:	53                   	push   %ebx
+  803e82:	50                   	push   %eax
+  803e83:	e8 50 f6 ff ff       	call   8034d8 <alloc_block_near>
+  803e88:	89 c6                	mov    %eax,%esi
+  803e8a:	83 c4 10             	add    $0x10,%esp
+  803e8d:	85 c0                	test   %eax,%eax
+  803e8f:	0f 88 71 ff ff ff    	js     803e06 <file_get_block+0x50>
+		journal_dirty(pdiskbno);
+  803e95:	83 ec 0c             	sub    $0xc,%esp
+  803e98:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  803e9b:	57                   	push   %edi
+  803e9c:	e8 6d ec ff ff       	call   802b0e <journal_dirty>
+		*pdiskbno = r;
+  803ea1:	89 37                	mov    %esi,(%edi)
+  803ea3:	83 c4 10             	add    $0x10,%esp
+	*blk = bc_lookup(*pdiskbno);
+  803ea6:	83 ec 0c             	sub    $0xc,%esp
+  803ea9:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  803eac:	ff 30                	push   (%eax)
+  803eae:	e8 1e dc ff ff       	call   801ad1 <bc_lookup>
+  803eb3:	8b 7d 10             	mov    0x10(%ebp),%edi
+  803eb6:	89 07                	mov    %eax,(%edi)
+	return 0;
+  803eb8:	83 c4 10             	add    $0x10,%esp
+  803ebb:	be 00 00 00 00       	mov    $0x0,%esi
+  803ec0:	e9 41 ff ff ff       	jmp    803e06 <file_get_block+0x50>
+		if (filebno > 0 && file_block_run(f, filebno - 1, &diskbno) > 0)
+  803ec5:	8d 57 ff             	lea    -0x1(%edi),%edx
+  803ec8:	8d 4d e4             	lea    -0x1c(%ebp),%ecx
+  803ecb:	89 d8                	mov    %ebx,%eax
+  803ecd:	e8 1c f8 ff ff       	call   8036ee <file_block_run>
+  803ed2:	85 c0                	test   %eax,%eax
+  803ed4:	74 9e                	je     803e74 <file_get_block+0xbe>
+			diskbno++;
+  803ed6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803ed9:	83 c0 01             	add    $0x1,%eax
+  803edc:	eb 9d                	jmp    803e7b <file_get_block+0xc5>
+		return -E_INVAL;
+  803ede:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+  803ee3:	e9 1e ff ff ff       	jmp    803e06 <file_get_block+0x50>
+  803ee8:	89 c6                	mov    %eax,%esi
+  803eea:	e9 17 ff ff ff       	jmp    803e06 <file_get_block+0x50>
+
+00803eef <file_inline_out>:
+{
+  803eef:	55                   	push   %ebp
+  803ef0:	89 e5                	mov    %esp,%ebp
+  803ef2:	57                   	push   %edi
+  803ef3:	56                   	push   %esi
+  803ef4:	53                   	push   %ebx
+  803ef5:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  803efb:	89 c3                	mov    %eax,%ebx
+	if (fs_shared())
+  803efd:	e8 9b d0 ff ff       	call   800f9d <fs_shared>
+  803f02:	84 c0                	test   %al,%al
+  803f04:	0f 85 d4 00 00 00    	jne    803fde <file_inline_out+0xef>
+	journal_dirty(f);
+  803f0a:	83 ec 0c             	sub    $0xc,%esp
+  803f0d:	53                   	push   %ebx
+  803f0e:	e8 fb eb ff ff       	call   802b0e <journal_dirty>
+	memmove(data, f->f_data, sizeof(data));
+  803f13:	8d b3 8c 00 00 00    	lea    0x8c(%ebx),%esi
+  803f19:	83 c4 0c             	add    $0xc,%esp
+  803f1c:	6a 74                	push   $0x74
+  803f1e:	56                   	push   %esi
+  803f1f:	8d 85 74 ff ff ff    	lea    -0x8c(%ebp),%eax
+  803f25:	50                   	push   %eax
+  803f26:	e8 f4 33 00 00       	call   80731f <memmove>
+	memset(f->f_data, 0, sizeof(f->f_data));
+  803f2b:	83 c4 0c             	add    $0xc,%esp
+  803f2e:	6a 74                	push   $0x74
+  803f30:	6a 00                	push   $0x0
+  803f32:	56                   	push   %esi
+  803f33:	e8 b2 33 00 00       	call   8072ea <memset>
+	f->f_flags = (f->f_flags & ~FILE_INLINE) | FILE_EXTENTS;
+  803f38:	8b 83 88 00 00 00    	mov    0x88(%ebx),%eax
+  803f3e:	83 e0 fa             	and    $0xfffffffa,%eax
+  803f41:	83 c8 01             	or     $0x1,%eax
+  803f44:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+	if (f->f_size == 0)
+  803f4a:	8b bb 80 00 00 00    	mov    0x80(%ebx),%edi
+  803f50:	83 c4 10             	add    $0x10,%esp
+  803f53:	85 ff                	test   %edi,%edi
+  803f55:	75 0a                	jne    803f61 <file_inline_out+0x72>
+}
+  803f57:	89 f8                	mov    %edi,%eax
+  803f59:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803f5c:	5b                   	pop    %ebx
+  803f5d:	5e                   	pop    %esi
+  803f5e:	5f                   	pop    %edi
+  803f5f:	5d                   	pop    %ebp
+  803f60:	c3                   	ret
+	if ((r = file_get_block(f, 0, &blk)) < 0) {
+  803f61:	83 ec 04             	sub    $0x4,%esp
+  803f64:	8d 85 70 ff ff ff    	lea    -0x90(%ebp),%eax
+  803f6a:	50                   	push   %eax
+  803f6b:	6a 00                	push   $0x0
+  803f6d:	53                   	push   %ebx
+  803f6e:	e8 43 fe ff ff       	call   803db6 <file_get_block>
+  803f73:	89 c7                	mov    %eax,%edi
+  803f75:	83 c4 10             	add    $0x10,%esp
+  803f78:	85 c0                	test   %eax,%eax
+  803f7a:	78 36                	js     803fb2 <file_inline_out+0xc3>
+	memset(blk, 0, BLKSIZE);
+  803f7c:	8b b5 70 ff ff ff    	mov    -0x90(%ebp),%esi
+  803f82:	83 ec 04             	sub    $0x4,%esp
+  803f85:	68 00 10 00 00       	push   $0x1000
+  803f8a:	6a 00                	push   $0x0
+  803f8c:	56                   	push   %esi
+  803f8d:	e8 58 33 00 00       	call   8072ea <memset>
+	memmove(blk, data, f->f_size);
+  803f92:	83 c4 0c             	add    $0xc,%esp
+  803f95:	ff b3 80 00 00 00    	push   0x80(%ebx)
+  803f9b:	8d 85 74 ff ff ff    	lea    -0x8c(%ebp),%eax
+  803fa1:	50                   	push   %eax
+  803fa2:	56                   	push   %esi
+  803fa3:	e8 77 33 00 00       	call   80731f <memmove>
+	return 0;
+  803fa8:	83 c4 10             	add    $0x10,%esp
+  803fab:	bf 00 00 00 00       	mov    $0x0,%edi
+  803fb0:	eb a5                	jmp    803f57 <file_inline_out+0x68>
+		memmove(f->f_data, data, sizeof(data));
+  803fb2:	83 ec 04             	sub    $0x4,%esp
+  803fb5:	6a 74                	push   $0x74
+  803fb7:	8d 85 74 ff ff ff    	lea    -0x8c(%ebp),%eax
+  803fbd:	50                   	push   %eax
+  803fbe:	56                   	push   %esi
+  803fbf:	e8 5b 33 00 00       	call   80731f <memmove>
+		f->f_flags = (f->f_flags & ~FILE_EXTENTS) | FILE_INLINE;
+  803fc4:	8b 83 88 00 00 00    	mov    0x88(%ebx),%eax
+  803fca:	83 e0 fa             	and    $0xfffffffa,%eax
+  803fcd:	83 c8 04             	or     $0x4,%eax
+  803fd0:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+		return r;
+  803fd6:	83 c4 10             	add    $0x10,%esp
+  803fd9:	e9 79 ff ff ff       	jmp    803f57 <file_inline_out+0x68>
+		return -E_AGAIN;
+  803fde:	bf f0 ff ff ff       	mov    $0xfffffff0,%edi
+  803fe3:	e9 6f ff ff ff       	jmp    803f57 <file_inline_out+0x68>
+
+00803fe8 <dir_entry>:
+{
+  803fe8:	55                   	push   %ebp
+  803fe9:	89 e5                	mov    %esp,%ebp
+  803feb:	57                   	push   %edi
+  803fec:	56                   	push   %esi
+  803fed:	53                   	push   %ebx
+  803fee:	83 ec 1c             	sub    $0x1c,%esp
+  803ff1:	89 c7                	mov    %eax,%edi
+  803ff3:	89 d3                	mov    %edx,%ebx
+	if (ent >= dir->f_size / BLKSIZE * BLKFILES)
+  803ff5:	8b 90 80 00 00 00    	mov    0x80(%eax),%edx
+  803ffb:	8d 82 ff 0f 00 00    	lea    0xfff(%edx),%eax
+  804001:	85 d2                	test   %edx,%edx
+  804003:	0f 49 c2             	cmovns %edx,%eax
+  804006:	c1 f8 0c             	sar    $0xc,%eax
+  804009:	c1 e0 04             	shl    $0x4,%eax
+  80400c:	39 c3                	cmp    %eax,%ebx
+  80400e:	73 34                	jae    804044 <dir_entry+0x5c>
+  804010:	89 ce                	mov    %ecx,%esi
+	if ((r = file_get_block(dir, ent / BLKFILES, &blk)) < 0)
+  804012:	83 ec 04             	sub    $0x4,%esp
+  804015:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  804018:	50                   	push   %eax
+  804019:	89 d8                	mov    %ebx,%eax
+  80401b:	c1 e8 04             	shr    $0x4,%eax
+  80401e:	50                   	push   %eax
+  80401f:	57                   	push   %edi
+  804020:	e8 91 fd ff ff       	call   803db6 <file_get_block>
+  804025:	83 c4 10             	add    $0x10,%esp
+  804028:	85 c0                	test   %eax,%eax
+  80402a:	78 10                	js     80403c <dir_entry+0x54>
+	*file = (struct File *) blk + ent % BLKFILES;
+  80402c:	83 e3 0f             	and    $0xf,%ebx
+  80402f:	c1 e3 08             	shl    $0x8,%ebx
+  804032:	03 5d e4             	add    -0x1c(%ebp),%ebx
+  804035:	89 1e                	mov    %ebx,(%esi)
+	return 0;
+  804037:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80403c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80403f:	5b                   	pop    %ebx
+  804040:	5e                   	pop    %esi
+  804041:	5f                   	pop    %edi
+  804042:	5d                   	pop    %ebp
+  804043:	c3                   	ret
+		return -E_INVAL;
+  804044:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804049:	eb f1                	jmp    80403c <dir_entry+0x54>
+
+0080404b <dir_lookup>:
+{
+  80404b:	55                   	push   %ebp
+  80404c:	89 e5                	mov    %esp,%ebp
+  80404e:	57                   	push   %edi
+  80404f:	56                   	push   %esi
+  804050:	53                   	push   %ebx
+  804051:	83 ec 3c             	sub    $0x3c,%esp
+  804054:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  804057:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  80405a:	89 4d c0             	mov    %ecx,-0x40(%ebp)
+	if ((di = dir_index(dir)) != NULL)
+  80405d:	e8 62 ef ff ff       	call   802fc4 <dir_index>
+  804062:	85 c0                	test   %eax,%eax
+  804064:	0f 85 bd 00 00 00    	jne    804127 <dir_lookup+0xdc>
+	assert((dir->f_size % BLKSIZE) == 0);
+  80406a:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80406d:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  804073:	a9 ff 0f 00 00       	test   $0xfff,%eax
+  804078:	0f 85 2c 01 00 00    	jne    8041aa <dir_lookup+0x15f>
+	nblock = dir->f_size / BLKSIZE;
+  80407e:	8d 90 ff 0f 00 00    	lea    0xfff(%eax),%edx
+  804084:	85 c0                	test   %eax,%eax
+  804086:	0f 48 c2             	cmovs  %edx,%eax
+  804089:	c1 f8 0c             	sar    $0xc,%eax
+  80408c:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+	for (i = 0; i < nblock; i++) {
+  80408f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804094:	89 7d d0             	mov    %edi,-0x30(%ebp)
+  804097:	8b 7d c8             	mov    -0x38(%ebp),%edi
+  80409a:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+  80409d:	39 4d d0             	cmp    %ecx,-0x30(%ebp)
+  8040a0:	0f 84 26 01 00 00    	je     8041cc <dir_lookup+0x181>
+		if ((r = file_get_block(dir, i, &blk)) < 0)
+  8040a6:	83 ec 04             	sub    $0x4,%esp
+  8040a9:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8040ac:	50                   	push   %eax
+  8040ad:	ff 75 d0             	push   -0x30(%ebp)
+  8040b0:	ff 75 cc             	push   -0x34(%ebp)
+  8040b3:	e8 fe fc ff ff       	call   803db6 <file_get_block>
+  8040b8:	83 c4 10             	add    $0x10,%esp
+  8040bb:	85 c0                	test   %eax,%eax
+  8040bd:	78 33                	js     8040f2 <dir_lookup+0xa7>
+		for (j = 0; j < BLKFILES; j++)
+  8040bf:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8040c2:	8d b3 00 10 00 00    	lea    0x1000(%ebx),%esi
+  8040c8:	39 f3                	cmp    %esi,%ebx
+  8040ca:	0f 84 f3 00 00 00    	je     8041c3 <dir_lookup+0x178>
+			if (strcmp(f[j].f_name, name) == 0) {
+  8040d0:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+  8040d3:	83 ec 08             	sub    $0x8,%esp
+  8040d6:	57                   	push   %edi
+  8040d7:	53                   	push   %ebx
+  8040d8:	e8 6d 31 00 00       	call   80724a <strcmp>
+  8040dd:	81 c3 00 01 00 00    	add    $0x100,%ebx
+  8040e3:	83 c4 10             	add    $0x10,%esp
+  8040e6:	85 c0                	test   %eax,%eax
+  8040e8:	75 de                	jne    8040c8 <dir_lookup+0x7d>
+				*file = &f[j];
+  8040ea:	8b 4d c0             	mov    -0x40(%ebp),%ecx
+  8040ed:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8040f0:	89 39                	mov    %edi,(%ecx)
+}
+  8040f2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8040f5:	5b                   	pop    %ebx
+  8040f6:	5e                   	pop    %esi
+  8040f7:	5f                   	pop    %edi
+  8040f8:	5d                   	pop    %ebp
+  8040f9:	c3                   	ret
+    h = (h ^ (uint8_t) *name++) * 16777619;
+  8040fa:	83 c3 01             	add    $0x1,%ebx
+  8040fd:	0f b6 c0             	movzbl %al,%eax
+  804100:	31 c2                	xor    %eax,%edx
+  804102:	69 d2 93 01 00 01    	imul   $0x1000193,%edx,%edx
+  while (*name)
+  804108:	0f b6 03             	movzbl (%ebx),%eax
+  80410b:	84 c0                	test   %al,%al
+  80410d:	75 eb                	jne    8040fa <dir_lookup+0xaf>
+	i = h & (di->di_nslots - 1);
+  80410f:	8b 46 04             	mov    0x4(%esi),%eax
+  804112:	8d 58 ff             	lea    -0x1(%eax),%ebx
+  804115:	21 d3                	and    %edx,%ebx
+	for (n = 0; n < di->di_nslots; n++, i = (i + 1) & (di->di_nslots - 1)) {
+  804117:	bf 00 00 00 00       	mov    $0x0,%edi
+		ds = dir_slot(di->di_blocks, i);
+  80411c:	8d 46 10             	lea    0x10(%esi),%eax
+  80411f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  804122:	89 55 d0             	mov    %edx,-0x30(%ebp)
+	for (n = 0; n < di->di_nslots; n++, i = (i + 1) & (di->di_nslots - 1)) {
+  804125:	eb 1a                	jmp    804141 <dir_lookup+0xf6>
+  804127:	89 c6                	mov    %eax,%esi
+  804129:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  uint32_t h = 2166136261U;
+  80412c:	ba c5 9d 1c 81       	mov    $0x811c9dc5,%edx
+  804131:	eb d5                	jmp    804108 <dir_lookup+0xbd>
+  804133:	83 c7 01             	add    $0x1,%edi
+  804136:	83 c3 01             	add    $0x1,%ebx
+  804139:	8b 46 04             	mov    0x4(%esi),%eax
+  80413c:	83 e8 01             	sub    $0x1,%eax
+  80413f:	21 c3                	and    %eax,%ebx
+  804141:	3b 7e 04             	cmp    0x4(%esi),%edi
+  804144:	73 50                	jae    804196 <dir_lookup+0x14b>
+		ds = dir_slot(di->di_blocks, i);
+  804146:	89 da                	mov    %ebx,%edx
+  804148:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80414b:	e8 f7 ee ff ff       	call   803047 <dir_slot>
+		if (ds->ds_ent == 0)
+  804150:	8b 50 04             	mov    0x4(%eax),%edx
+  804153:	85 d2                	test   %edx,%edx
+  804155:	74 49                	je     8041a0 <dir_lookup+0x155>
+		if (ds->ds_hash != h)
+  804157:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80415a:	3b 08                	cmp    (%eax),%ecx
+  80415c:	75 d5                	jne    804133 <dir_lookup+0xe8>
+		if ((r = dir_entry(dir, ds->ds_ent - 1, &f)) < 0)
+  80415e:	83 ea 01             	sub    $0x1,%edx
+  804161:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  804164:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  804167:	e8 7c fe ff ff       	call   803fe8 <dir_entry>
+  80416c:	85 c0                	test   %eax,%eax
+  80416e:	78 82                	js     8040f2 <dir_lookup+0xa7>
+		if (strcmp(f->f_name, name) == 0) {
+  804170:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  804173:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  804176:	83 ec 08             	sub    $0x8,%esp
+  804179:	ff 75 c8             	push   -0x38(%ebp)
+  80417c:	50                   	push   %eax
+  80417d:	e8 c8 30 00 00       	call   80724a <strcmp>
+  804182:	83 c4 10             	add    $0x10,%esp
+  804185:	85 c0                	test   %eax,%eax
+  804187:	75 aa                	jne    804133 <dir_lookup+0xe8>
+			*file = f;
+  804189:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+  80418c:	8b 4d c0             	mov    -0x40(%ebp),%ecx
+  80418f:	89 39                	mov    %edi,(%ecx)
+			return 0;
+  804191:	e9 5c ff ff ff       	jmp    8040f2 <dir_lookup+0xa7>
+	return -E_NOT_FOUND;
+  804196:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  80419b:	e9 52 ff ff ff       	jmp    8040f2 <dir_lookup+0xa7>
+			return -E_NOT_FOUND;
+  8041a0:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+		return dir_index_find(dir, di, name, file);
+  8041a5:	e9 48 ff ff ff       	jmp    8040f2 <dir_lookup+0xa7>
+	assert((dir->f_size % BLKSIZE) == 0);
+  8041aa:	68 ca 9e 80 00       	push   $0x809eca
+  8041af:	68 2e 99 80 00       	push   $0x80992e
+  8041b4:	68 ea 03 00 00       	push   $0x3ea
+  8041b9:	68 fc 9d 80 00       	push   $0x809dfc
+  8041be:	e8 0d 29 00 00       	call   806ad0 <_panic>
+	for (i = 0; i < nblock; i++) {
+  8041c3:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+  8041c7:	e9 ce fe ff ff       	jmp    80409a <dir_lookup+0x4f>
+	return -E_NOT_FOUND;
+  8041cc:	b8 f5 ff ff ff       	mov    $0xfffffff5,%eax
+  8041d1:	e9 1c ff ff ff       	jmp    8040f2 <dir_lookup+0xa7>
+
+008041d6 <walk_path>:
+{
+  8041d6:	55                   	push   %ebp
+  8041d7:	89 e5                	mov    %esp,%ebp
+  8041d9:	57                   	push   %edi
+  8041da:	56                   	push   %esi
+  8041db:	53                   	push   %ebx
+  8041dc:	81 ec ac 00 00 00    	sub    $0xac,%esp
+  8041e2:	89 95 54 ff ff ff    	mov    %edx,-0xac(%ebp)
+  8041e8:	89 8d 50 ff ff ff    	mov    %ecx,-0xb0(%ebp)
+	while (*p == '/')
+  8041ee:	eb 03                	jmp    8041f3 <walk_path+0x1d>
+		p++;
+  8041f0:	83 c0 01             	add    $0x1,%eax
+	while (*p == '/')
+  8041f3:	80 38 2f             	cmpb   $0x2f,(%eax)
+  8041f6:	74 f8                	je     8041f0 <walk_path+0x1a>
+	f = &super->s_root;
+  8041f8:	8b 3d 88 3f 84 00    	mov    0x843f88,%edi
+  8041fe:	8d 57 08             	lea    0x8(%edi),%edx
+  804201:	89 95 64 ff ff ff    	mov    %edx,-0x9c(%ebp)
+	name[0] = 0;
+  804207:	c6 85 68 ff ff ff 00 	movb   $0x0,-0x98(%ebp)
+	if (pdir)
+  80420e:	8b bd 54 ff ff ff    	mov    -0xac(%ebp),%edi
+  804214:	85 ff                	test   %edi,%edi
+  804216:	74 06                	je     80421e <walk_path+0x48>
+		*pdir = 0;
+  804218:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+	*pf = 0;
+  80421e:	8b bd 50 ff ff ff    	mov    -0xb0(%ebp),%edi
+  804224:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+	dir = 0;
+  80422a:	bf 00 00 00 00       	mov    $0x0,%edi
+	while (*path != '\0') {
+  80422f:	e9 e0 00 00 00       	jmp    804314 <walk_path+0x13e>
+			path++;
+  804234:	83 c3 01             	add    $0x1,%ebx
+		while (*path != '/' && *path != '\0')
+  804237:	0f b6 13             	movzbl (%ebx),%edx
+  80423a:	80 fa 2f             	cmp    $0x2f,%dl
+  80423d:	74 04                	je     804243 <walk_path+0x6d>
+  80423f:	84 d2                	test   %dl,%dl
+  804241:	75 f1                	jne    804234 <walk_path+0x5e>
+		if (path - p >= MAXNAMELEN)
+  804243:	89 de                	mov    %ebx,%esi
+  804245:	29 c6                	sub    %eax,%esi
+  804247:	83 fe 7f             	cmp    $0x7f,%esi
+  80424a:	0f 8f c8 01 00 00    	jg     804418 <walk_path+0x242>
+		memmove(name, p, path - p);
+  804250:	83 ec 04             	sub    $0x4,%esp
+  804253:	56                   	push   %esi
+  804254:	50                   	push   %eax
+  804255:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  80425b:	50                   	push   %eax
+  80425c:	e8 be 30 00 00       	call   80731f <memmove>
+		name[path - p] = '\0';
+  804261:	c6 84 35 68 ff ff ff 	movb   $0x0,-0x98(%ebp,%esi,1)
+  804268:	00 
+	while (*p == '/')
+  804269:	83 c4 10             	add    $0x10,%esp
+  80426c:	eb 03                	jmp    804271 <walk_path+0x9b>
+		p++;
+  80426e:	83 c3 01             	add    $0x1,%ebx
+	while (*p == '/')
+  804271:	80 3b 2f             	cmpb   $0x2f,(%ebx)
+  804274:	74 f8                	je     80426e <walk_path+0x98>
+		if (dir->f_type != FTYPE_DIR)
+  804276:	83 bf 84 00 00 00 01 	cmpl   $0x1,0x84(%edi)
+  80427d:	0f 85 9c 01 00 00    	jne    80441f <walk_path+0x249>
+  804283:	ba c5 9d 1c 81       	mov    $0x811c9dc5,%edx
+  804288:	8d 8d 68 ff ff ff    	lea    -0x98(%ebp),%ecx
+	if (dcache_off)
+  80428e:	80 3d fc 83 83 00 00 	cmpb   $0x0,0x8383fc
+  804295:	74 25                	je     8042bc <walk_path+0xe6>
+		return dir_lookup(dir, name, file);
+  804297:	8d 8d 64 ff ff ff    	lea    -0x9c(%ebp),%ecx
+  80429d:	8d 95 68 ff ff ff    	lea    -0x98(%ebp),%edx
+  8042a3:	89 f8                	mov    %edi,%eax
+  8042a5:	e8 a1 fd ff ff       	call   80404b <dir_lookup>
+  8042aa:	89 c6                	mov    %eax,%esi
+  8042ac:	eb 5c                	jmp    80430a <walk_path+0x134>
+    h = (h ^ (uint8_t) *name++) * 16777619;
+  8042ae:	83 c1 01             	add    $0x1,%ecx
+  8042b1:	0f b6 c0             	movzbl %al,%eax
+  8042b4:	31 c2                	xor    %eax,%edx
+  8042b6:	69 d2 93 01 00 01    	imul   $0x1000193,%edx,%edx
+  while (*name)
+  8042bc:	0f b6 01             	movzbl (%ecx),%eax
+  8042bf:	84 c0                	test   %al,%al
+  8042c1:	75 eb                	jne    8042ae <walk_path+0xd8>
+	return &dcache[(h ^ ((uint32_t) dir >> 8)) & (DCACHE_SIZE - 1)];
+  8042c3:	89 fe                	mov    %edi,%esi
+  8042c5:	c1 ee 08             	shr    $0x8,%esi
+  8042c8:	31 d6                	xor    %edx,%esi
+  8042ca:	89 f0                	mov    %esi,%eax
+  8042cc:	0f b6 f0             	movzbl %al,%esi
+	if (d->dc_dir == dir && d->dc_hash == h &&
+  8042cf:	69 c6 8c 00 00 00    	imul   $0x8c,%esi,%eax
+  8042d5:	3b b8 00 84 83 00    	cmp    0x838400(%eax),%edi
+  8042db:	74 4d                	je     80432a <walk_path+0x154>
+	dc_misses++;
+  8042dd:	83 05 f0 83 83 00 01 	addl   $0x1,0x8383f0
+	r = dir_lookup(dir, name, file);
+  8042e4:	8d 8d 64 ff ff ff    	lea    -0x9c(%ebp),%ecx
+  8042ea:	8d 95 68 ff ff ff    	lea    -0x98(%ebp),%edx
+  8042f0:	89 f8                	mov    %edi,%eax
+  8042f2:	e8 54 fd ff ff       	call   80404b <dir_lookup>
+  8042f7:	89 c6                	mov    %eax,%esi
+	if (r == 0)
+  8042f9:	85 c0                	test   %eax,%eax
+  8042fb:	0f 84 80 00 00 00    	je     804381 <walk_path+0x1ab>
+	else if (r == -E_NOT_FOUND)
+  804301:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  804304:	0f 84 8f 00 00 00    	je     804399 <walk_path+0x1c3>
+		if ((r = dcache_lookup(dir, name, &f)) < 0) {
+  80430a:	85 f6                	test   %esi,%esi
+  80430c:	0f 88 9e 00 00 00    	js     8043b0 <walk_path+0x1da>
+	dir = 0;
+  804312:	89 d8                	mov    %ebx,%eax
+	while (*path != '\0') {
+  804314:	80 38 00             	cmpb   $0x0,(%eax)
+  804317:	0f 84 d2 00 00 00    	je     8043ef <walk_path+0x219>
+		dir = f;
+  80431d:	8b bd 64 ff ff ff    	mov    -0x9c(%ebp),%edi
+		while (*path != '/' && *path != '\0')
+  804323:	89 c3                	mov    %eax,%ebx
+  804325:	e9 0d ff ff ff       	jmp    804237 <walk_path+0x61>
+	if (d->dc_dir == dir && d->dc_hash == h &&
+  80432a:	3b 90 08 84 83 00    	cmp    0x838408(%eax),%edx
+  804330:	75 ab                	jne    8042dd <walk_path+0x107>
+	    strcmp(d->dc_name, name) == 0) {
+  804332:	83 ec 08             	sub    $0x8,%esp
+  804335:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  80433b:	50                   	push   %eax
+  80433c:	69 c6 8c 00 00 00    	imul   $0x8c,%esi,%eax
+  804342:	05 0c 84 83 00       	add    $0x83840c,%eax
+  804347:	50                   	push   %eax
+  804348:	e8 fd 2e 00 00       	call   80724a <strcmp>
+	if (d->dc_dir == dir && d->dc_hash == h &&
+  80434d:	83 c4 10             	add    $0x10,%esp
+  804350:	85 c0                	test   %eax,%eax
+  804352:	75 89                	jne    8042dd <walk_path+0x107>
+		dc_hits++;
+  804354:	83 05 f8 83 83 00 01 	addl   $0x1,0x8383f8
+		if (d->dc_file == NULL) {
+  80435b:	69 f6 8c 00 00 00    	imul   $0x8c,%esi,%esi
+  804361:	8b 86 04 84 83 00    	mov    0x838404(%esi),%eax
+  804367:	85 c0                	test   %eax,%eax
+  804369:	74 08                	je     804373 <walk_path+0x19d>
+		*file = d->dc_file;
+  80436b:	89 85 64 ff ff ff    	mov    %eax,-0x9c(%ebp)
+		return 0;
+  804371:	eb 9f                	jmp    804312 <walk_path+0x13c>
+			dc_negative++;
+  804373:	83 05 f4 83 83 00 01 	addl   $0x1,0x8383f4
+			return -E_NOT_FOUND;
+  80437a:	be f5 ff ff ff       	mov    $0xfffffff5,%esi
+  80437f:	eb 89                	jmp    80430a <walk_path+0x134>
+		dcache_enter(dir, name, *file);
+  804381:	8b 8d 64 ff ff ff    	mov    -0x9c(%ebp),%ecx
+  804387:	8d 95 68 ff ff ff    	lea    -0x98(%ebp),%edx
+  80438d:	89 f8                	mov    %edi,%eax
+  80438f:	e8 d5 ec ff ff       	call   803069 <dcache_enter>
+  804394:	e9 79 ff ff ff       	jmp    804312 <walk_path+0x13c>
+		dcache_enter(dir, name, NULL);
+  804399:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80439e:	8d 95 68 ff ff ff    	lea    -0x98(%ebp),%edx
+  8043a4:	89 f8                	mov    %edi,%eax
+  8043a6:	e8 be ec ff ff       	call   803069 <dcache_enter>
+  8043ab:	e9 5a ff ff ff       	jmp    80430a <walk_path+0x134>
+			if (r == -E_NOT_FOUND && *path == '\0') {
+  8043b0:	83 fe f5             	cmp    $0xfffffff5,%esi
+  8043b3:	75 59                	jne    80440e <walk_path+0x238>
+  8043b5:	80 3b 00             	cmpb   $0x0,(%ebx)
+  8043b8:	75 54                	jne    80440e <walk_path+0x238>
+				if (pdir)
+  8043ba:	8b 85 54 ff ff ff    	mov    -0xac(%ebp),%eax
+  8043c0:	85 c0                	test   %eax,%eax
+  8043c2:	74 02                	je     8043c6 <walk_path+0x1f0>
+					*pdir = dir;
+  8043c4:	89 38                	mov    %edi,(%eax)
+				if (lastelem)
+  8043c6:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+  8043ca:	74 15                	je     8043e1 <walk_path+0x20b>
+					strcpy(lastelem, name);
+  8043cc:	83 ec 08             	sub    $0x8,%esp
+  8043cf:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8043d5:	50                   	push   %eax
+  8043d6:	ff 75 08             	push   0x8(%ebp)
+  8043d9:	e8 bb 2d 00 00       	call   807199 <strcpy>
+  8043de:	83 c4 10             	add    $0x10,%esp
+				*pf = 0;
+  8043e1:	8b 85 50 ff ff ff    	mov    -0xb0(%ebp),%eax
+  8043e7:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  8043ed:	eb 1f                	jmp    80440e <walk_path+0x238>
+	if (pdir)
+  8043ef:	8b 85 54 ff ff ff    	mov    -0xac(%ebp),%eax
+  8043f5:	85 c0                	test   %eax,%eax
+  8043f7:	74 02                	je     8043fb <walk_path+0x225>
+		*pdir = dir;
+  8043f9:	89 38                	mov    %edi,(%eax)
+	*pf = f;
+  8043fb:	8b 85 64 ff ff ff    	mov    -0x9c(%ebp),%eax
+  804401:	8b bd 50 ff ff ff    	mov    -0xb0(%ebp),%edi
+  804407:	89 07                	mov    %eax,(%edi)
+	return 0;
+  804409:	be 00 00 00 00       	mov    $0x0,%esi
+}
+  80440e:	89 f0                	mov    %esi,%eax
+  804410:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804413:	5b                   	pop    %ebx
+  804414:	5e                   	pop    %esi
+  804415:	5f                   	pop    %edi
+  804416:	5d                   	pop    %ebp
+  804417:	c3                   	ret
+			return -E_BAD_PATH;
+  804418:	be f4 ff ff ff       	mov    $0xfffffff4,%esi
+  80441d:	eb ef                	jmp    80440e <walk_path+0x238>
+			return -E_NOT_FOUND;
+  80441f:	be f5 ff ff ff       	mov    $0xfffffff5,%esi
+  804424:	eb e8                	jmp    80440e <walk_path+0x238>
+
+00804426 <file_allocate>:
+{
+  804426:	55                   	push   %ebp
+  804427:	89 e5                	mov    %esp,%ebp
+  804429:	57                   	push   %edi
+  80442a:	56                   	push   %esi
+  80442b:	53                   	push   %ebx
+  80442c:	83 ec 3c             	sub    $0x3c,%esp
+  80442f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  804432:	8b 75 0c             	mov    0xc(%ebp),%esi
+  804435:	8b 45 10             	mov    0x10(%ebp),%eax
+	if (offset < 0 || len <= 0 || len > MAXFILESIZE - offset)
+  804438:	85 f6                	test   %esi,%esi
+  80443a:	0f 88 eb 03 00 00    	js     80482b <file_allocate+0x405>
+  804440:	85 c0                	test   %eax,%eax
+  804442:	0f 8e e3 03 00 00    	jle    80482b <file_allocate+0x405>
+  804448:	ba 00 f0 ff 7f       	mov    $0x7ffff000,%edx
+  80444d:	29 f2                	sub    %esi,%edx
+  80444f:	39 c2                	cmp    %eax,%edx
+  804451:	0f 8c de 03 00 00    	jl     804835 <file_allocate+0x40f>
+	nblocks = ROUNDUP(offset + len, BLKSIZE) / BLKSIZE;
+  804457:	01 c6                	add    %eax,%esi
+	if (f->f_flags & FILE_INLINE) {
+  804459:	f6 83 88 00 00 00 04 	testb  $0x4,0x88(%ebx)
+  804460:	74 1d                	je     80447f <file_allocate+0x59>
+			return 0;
+  804462:	b8 00 00 00 00       	mov    $0x0,%eax
+		if (offset + len <= NINLINE)
+  804467:	83 fe 74             	cmp    $0x74,%esi
+  80446a:	7f 08                	jg     804474 <file_allocate+0x4e>
+}
+  80446c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80446f:	5b                   	pop    %ebx
+  804470:	5e                   	pop    %esi
+  804471:	5f                   	pop    %edi
+  804472:	5d                   	pop    %ebp
+  804473:	c3                   	ret
+		if ((r = file_inline_out(f)) < 0)
+  804474:	89 d8                	mov    %ebx,%eax
+  804476:	e8 74 fa ff ff       	call   803eef <file_inline_out>
+  80447b:	85 c0                	test   %eax,%eax
+  80447d:	78 ed                	js     80446c <file_allocate+0x46>
+		return 0;
+  80447f:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (!(f->f_flags & FILE_EXTENTS))
+  804484:	f6 83 88 00 00 00 01 	testb  $0x1,0x88(%ebx)
+  80448b:	74 df                	je     80446c <file_allocate+0x46>
+	for (i = 0; i < f->f_nextent; i++)
+  80448d:	8b 83 bc 00 00 00    	mov    0xbc(%ebx),%eax
+  804493:	89 c7                	mov    %eax,%edi
+  804495:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  804498:	89 d8                	mov    %ebx,%eax
+  80449a:	8d 14 fb             	lea    (%ebx,%edi,8),%edx
+	mapped = 0;
+  80449d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8044a2:	eb 09                	jmp    8044ad <file_allocate+0x87>
+		mapped += f->f_extent[i].e_len;
+  8044a4:	03 88 c4 00 00 00    	add    0xc4(%eax),%ecx
+	for (i = 0; i < f->f_nextent; i++)
+  8044aa:	83 c0 08             	add    $0x8,%eax
+  8044ad:	39 d0                	cmp    %edx,%eax
+  8044af:	75 f3                	jne    8044a4 <file_allocate+0x7e>
+	nblocks = ROUNDUP(offset + len, BLKSIZE) / BLKSIZE;
+  8044b1:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  8044b4:	81 c6 ff 0f 00 00    	add    $0xfff,%esi
+  8044ba:	89 f7                	mov    %esi,%edi
+  8044bc:	c1 ff 0c             	sar    $0xc,%edi
+  8044bf:	89 7d c8             	mov    %edi,-0x38(%ebp)
+		return 0;
+  8044c2:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (mapped >= nblocks)
+  8044c7:	39 f9                	cmp    %edi,%ecx
+  8044c9:	73 a1                	jae    80446c <file_allocate+0x46>
+	e = f->f_nextent > 0 ? &f->f_extent[f->f_nextent - 1] : NULL;
+  8044cb:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8044ce:	85 c0                	test   %eax,%eax
+  8044d0:	74 1f                	je     8044f1 <file_allocate+0xcb>
+  8044d2:	8d bc c3 b8 00 00 00 	lea    0xb8(%ebx,%eax,8),%edi
+  8044d9:	89 7d c0             	mov    %edi,-0x40(%ebp)
+	goal = e ? e->e_start + e->e_len : file_home(f);
+  8044dc:	89 c7                	mov    %eax,%edi
+  8044de:	8b 84 c3 b8 00 00 00 	mov    0xb8(%ebx,%eax,8),%eax
+  8044e5:	03 84 fb bc 00 00 00 	add    0xbc(%ebx,%edi,8),%eax
+  8044ec:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  8044ef:	eb 11                	jmp    804502 <file_allocate+0xdc>
+  8044f1:	89 d8                	mov    %ebx,%eax
+  8044f3:	e8 94 e9 ff ff       	call   802e8c <file_home>
+  8044f8:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  8044fb:	c7 45 c0 00 00 00 00 	movl   $0x0,-0x40(%ebp)
+	if ((r = alloc_search_run(goal, f, nblocks - mapped)) >= 0 &&
+  804502:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  804505:	8b 7d cc             	mov    -0x34(%ebp),%edi
+  804508:	29 f8                	sub    %edi,%eax
+  80450a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+	if (goal >= super->s_nblocks)
+  80450d:	8b 0d 88 3f 84 00    	mov    0x843f88,%ecx
+  804513:	8b 79 04             	mov    0x4(%ecx),%edi
+  804516:	8b 55 c4             	mov    -0x3c(%ebp),%edx
+  804519:	39 fa                	cmp    %edi,%edx
+  80451b:	be 00 00 00 00       	mov    $0x0,%esi
+  804520:	0f 42 f2             	cmovb  %edx,%esi
+		if (b % 32 == 0 && bitmap[b / 32] == 0 &&
+  804523:	8b 15 84 3f 84 00    	mov    0x843f84,%edx
+  804529:	89 55 d8             	mov    %edx,-0x28(%ebp)
+  80452c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  804533:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+  80453a:	ba 00 00 00 00       	mov    $0x0,%edx
+	for (i = 0, b = goal; i < super->s_nblocks + n; i++, b++) {
+  80453f:	01 f8                	add    %edi,%eax
+  804541:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  804544:	89 4d bc             	mov    %ecx,-0x44(%ebp)
+  804547:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  80454a:	89 d3                	mov    %edx,%ebx
+  80454c:	eb 7e                	jmp    8045cc <file_allocate+0x1a6>
+			len = 0;
+  80454e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+			b = 0;
+  804555:	be 00 00 00 00       	mov    $0x0,%esi
+		if (b % 32 == 0 && bitmap[b / 32] == 0 &&
+  80455a:	89 f0                	mov    %esi,%eax
+  80455c:	c1 e8 05             	shr    $0x5,%eax
+  80455f:	8b 4d d8             	mov    -0x28(%ebp),%ecx
+  804562:	8b 04 81             	mov    (%ecx,%eax,4),%eax
+  804565:	85 c0                	test   %eax,%eax
+  804567:	75 7e                	jne    8045e7 <file_allocate+0x1c1>
+		    b + 32 <= super->s_nblocks) {
+  804569:	8d 56 20             	lea    0x20(%esi),%edx
+		if (b % 32 == 0 && bitmap[b / 32] == 0 &&
+  80456c:	39 d7                	cmp    %edx,%edi
+  80456e:	72 77                	jb     8045e7 <file_allocate+0x1c1>
+			b += 31;
+  804570:	83 c6 1f             	add    $0x1f,%esi
+			i += 31;
+  804573:	83 c3 1f             	add    $0x1f,%ebx
+			len = 0;
+  804576:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804579:	eb 4b                	jmp    8045c6 <file_allocate+0x1a0>
+	if ((r = alloc_search_run(goal, f, nblocks - mapped)) >= 0 &&
+  80457b:	8b 4d bc             	mov    -0x44(%ebp),%ecx
+  80457e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  804581:	83 7d dc 00          	cmpl   $0x0,-0x24(%ebp)
+  804585:	78 2d                	js     8045b4 <file_allocate+0x18e>
+	    ((e && r == goal) || f->f_nextent < NEXTENT)) {
+  804587:	83 7d c0 00          	cmpl   $0x0,-0x40(%ebp)
+  80458b:	0f 95 c2             	setne  %dl
+  80458e:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  804591:	39 7d c4             	cmp    %edi,-0x3c(%ebp)
+  804594:	0f 94 c0             	sete   %al
+  804597:	84 c2                	test   %al,%dl
+  804599:	0f 85 9c 00 00 00    	jne    80463b <file_allocate+0x215>
+  80459f:	83 7d d0 06          	cmpl   $0x6,-0x30(%ebp)
+  8045a3:	0f 86 92 00 00 00    	jbe    80463b <file_allocate+0x215>
+  8045a9:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  8045ac:	8b 7d c8             	mov    -0x38(%ebp),%edi
+  8045af:	e9 4a 02 00 00       	jmp    8047fe <file_allocate+0x3d8>
+  8045b4:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  8045b7:	8b 7d c8             	mov    -0x38(%ebp),%edi
+  8045ba:	e9 3f 02 00 00       	jmp    8047fe <file_allocate+0x3d8>
+			len = 0;
+  8045bf:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+	for (i = 0, b = goal; i < super->s_nblocks + n; i++, b++) {
+  8045c6:	83 c3 01             	add    $0x1,%ebx
+  8045c9:	83 c6 01             	add    $0x1,%esi
+  8045cc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8045cf:	39 c3                	cmp    %eax,%ebx
+  8045d1:	73 5a                	jae    80462d <file_allocate+0x207>
+		if (b == super->s_nblocks) {
+  8045d3:	39 f7                	cmp    %esi,%edi
+  8045d5:	0f 84 73 ff ff ff    	je     80454e <file_allocate+0x128>
+		if (b % 32 == 0 && bitmap[b / 32] == 0 &&
+  8045db:	f7 c6 1f 00 00 00    	test   $0x1f,%esi
+  8045e1:	0f 84 73 ff ff ff    	je     80455a <file_allocate+0x134>
+		} else if (block_is_free(b) && !pa_reserved(b, f)) {
+  8045e7:	83 ec 0c             	sub    $0xc,%esp
+  8045ea:	56                   	push   %esi
+  8045eb:	e8 3f eb ff ff       	call   80312f <block_is_free>
+  8045f0:	83 c4 10             	add    $0x10,%esp
+  8045f3:	84 c0                	test   %al,%al
+  8045f5:	74 c8                	je     8045bf <file_allocate+0x199>
+  8045f7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8045fa:	89 f0                	mov    %esi,%eax
+  8045fc:	e8 15 e8 ff ff       	call   802e16 <pa_reserved>
+  804601:	84 c0                	test   %al,%al
+  804603:	75 1f                	jne    804624 <file_allocate+0x1fe>
+			if (len++ == 0)
+  804605:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  804608:	8d 41 01             	lea    0x1(%ecx),%eax
+  80460b:	85 c9                	test   %ecx,%ecx
+  80460d:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  804610:	0f 44 ce             	cmove  %esi,%ecx
+  804613:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+			if (len == n)
+  804616:	39 45 d4             	cmp    %eax,-0x2c(%ebp)
+  804619:	0f 84 5c ff ff ff    	je     80457b <file_allocate+0x155>
+			if (len++ == 0)
+  80461f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  804622:	eb a2                	jmp    8045c6 <file_allocate+0x1a0>
+			len = 0;
+  804624:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80462b:	eb 99                	jmp    8045c6 <file_allocate+0x1a0>
+  80462d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  804630:	8b 75 cc             	mov    -0x34(%ebp),%esi
+  804633:	8b 7d c8             	mov    -0x38(%ebp),%edi
+  804636:	e9 c3 01 00 00       	jmp    8047fe <file_allocate+0x3d8>
+	end = start + n;
+  80463b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80463e:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  804641:	01 f8                	add    %edi,%eax
+  804643:	89 45 e0             	mov    %eax,-0x20(%ebp)
+	journal_dirty(super);
+  804646:	83 ec 0c             	sub    $0xc,%esp
+  804649:	51                   	push   %ecx
+  80464a:	e8 bf e4 ff ff       	call   802b0e <journal_dirty>
+	for (b = start; b < end; b = (w + 1) * 32) {
+  80464f:	83 c4 10             	add    $0x10,%esp
+  804652:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  804655:	89 fb                	mov    %edi,%ebx
+  804657:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80465a:	39 c3                	cmp    %eax,%ebx
+  80465c:	0f 83 97 00 00 00    	jae    8046f9 <file_allocate+0x2d3>
+		w = b / 32;
+  804662:	89 d8                	mov    %ebx,%eax
+  804664:	c1 e8 05             	shr    $0x5,%eax
+  804667:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+		lo = b % 32;
+  80466a:	89 df                	mov    %ebx,%edi
+  80466c:	83 e7 1f             	and    $0x1f,%edi
+		hi = MIN(end - w * 32, 32);
+  80466f:	89 d8                	mov    %ebx,%eax
+  804671:	83 e0 e0             	and    $0xffffffe0,%eax
+  804674:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  804677:	29 c2                	sub    %eax,%edx
+  804679:	b8 20 00 00 00       	mov    $0x20,%eax
+  80467e:	39 c2                	cmp    %eax,%edx
+  804680:	0f 46 c2             	cmovbe %edx,%eax
+		mask = (hi == 32 ? ~0U : (1U << hi) - 1) & ~((1U << lo) - 1);
+  804683:	be 01 00 00 00       	mov    $0x1,%esi
+  804688:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80468b:	89 c1                	mov    %eax,%ecx
+  80468d:	d3 e6                	shl    %cl,%esi
+  80468f:	89 f0                	mov    %esi,%eax
+  804691:	83 e8 01             	sub    $0x1,%eax
+  804694:	83 fa 20             	cmp    $0x20,%edx
+  804697:	be ff ff ff ff       	mov    $0xffffffff,%esi
+  80469c:	0f 43 c6             	cmovae %esi,%eax
+  80469f:	be 01 00 00 00       	mov    $0x1,%esi
+  8046a4:	89 7d d8             	mov    %edi,-0x28(%ebp)
+  8046a7:	89 f9                	mov    %edi,%ecx
+  8046a9:	d3 e6                	shl    %cl,%esi
+  8046ab:	f7 de                	neg    %esi
+  8046ad:	21 c6                	and    %eax,%esi
+		journal_dirty(&bitmap[w]);
+  8046af:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8046b2:	8d 3c 8d 00 00 00 00 	lea    0x0(,%ecx,4),%edi
+  8046b9:	83 ec 0c             	sub    $0xc,%esp
+  8046bc:	89 fa                	mov    %edi,%edx
+  8046be:	03 15 84 3f 84 00    	add    0x843f84,%edx
+  8046c4:	52                   	push   %edx
+  8046c5:	e8 44 e4 ff ff       	call   802b0e <journal_dirty>
+		bitmap[w] &= ~mask;
+  8046ca:	03 3d 84 3f 84 00    	add    0x843f84,%edi
+  8046d0:	f7 d6                	not    %esi
+  8046d2:	21 37                	and    %esi,(%edi)
+		ag_nfree[w / AG_WORDS] -= hi - lo;
+  8046d4:	c1 eb 09             	shr    $0x9,%ebx
+  8046d7:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8046da:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8046dd:	29 f8                	sub    %edi,%eax
+  8046df:	01 04 9d e0 10 84 00 	add    %eax,0x8410e0(,%ebx,4)
+	for (b = start; b < end; b = (w + 1) * 32) {
+  8046e6:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8046e9:	8d 41 01             	lea    0x1(%ecx),%eax
+  8046ec:	c1 e0 05             	shl    $0x5,%eax
+  8046ef:	89 c3                	mov    %eax,%ebx
+  8046f1:	83 c4 10             	add    $0x10,%esp
+  8046f4:	e9 5e ff ff ff       	jmp    804657 <file_allocate+0x231>
+	super->s_nfree -= n;
+  8046f9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8046fc:	8b 15 88 3f 84 00    	mov    0x843f88,%edx
+  804702:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  804705:	03 82 08 01 00 00    	add    0x108(%edx),%eax
+  80470b:	8b 7d c8             	mov    -0x38(%ebp),%edi
+  80470e:	29 f8                	sub    %edi,%eax
+  804710:	89 82 08 01 00 00    	mov    %eax,0x108(%edx)
+	for (b = start; b < end; b++)
+  804716:	8b 75 dc             	mov    -0x24(%ebp),%esi
+  804719:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  80471c:	eb 03                	jmp    804721 <file_allocate+0x2fb>
+  80471e:	83 c6 01             	add    $0x1,%esi
+  804721:	39 fe                	cmp    %edi,%esi
+  804723:	73 26                	jae    80474b <file_allocate+0x325>
+		if (journal_holds(b))
+  804725:	83 ec 0c             	sub    $0xc,%esp
+  804728:	56                   	push   %esi
+  804729:	e8 83 e0 ff ff       	call   8027b1 <journal_holds>
+  80472e:	83 c4 10             	add    $0x10,%esp
+  804731:	84 c0                	test   %al,%al
+  804733:	74 e9                	je     80471e <file_allocate+0x2f8>
+			journal_dirty(diskaddr(b));
+  804735:	83 ec 0c             	sub    $0xc,%esp
+  804738:	56                   	push   %esi
+  804739:	e8 56 d1 ff ff       	call   801894 <diskaddr>
+  80473e:	89 04 24             	mov    %eax,(%esp)
+  804741:	e8 c8 e3 ff ff       	call   802b0e <journal_dirty>
+  804746:	83 c4 10             	add    $0x10,%esp
+  804749:	eb d3                	jmp    80471e <file_allocate+0x2f8>
+	alloc_cursor = end - 1;
+  80474b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80474e:	83 e8 01             	sub    $0x1,%eax
+  804751:	a3 00 10 84 00       	mov    %eax,0x841000
+		journal_dirty(f);
+  804756:	83 ec 0c             	sub    $0xc,%esp
+  804759:	53                   	push   %ebx
+  80475a:	e8 af e3 ff ff       	call   802b0e <journal_dirty>
+		if (!e || r != goal) {
+  80475f:	83 c4 10             	add    $0x10,%esp
+  804762:	83 7d c0 00          	cmpl   $0x0,-0x40(%ebp)
+  804766:	74 08                	je     804770 <file_allocate+0x34a>
+  804768:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  80476b:	39 7d c4             	cmp    %edi,-0x3c(%ebp)
+  80476e:	74 2b                	je     80479b <file_allocate+0x375>
+			e = &f->f_extent[f->f_nextent++];
+  804770:	8b 83 bc 00 00 00    	mov    0xbc(%ebx),%eax
+  804776:	8d 50 01             	lea    0x1(%eax),%edx
+  804779:	89 93 bc 00 00 00    	mov    %edx,0xbc(%ebx)
+  80477f:	8d bc c3 c0 00 00 00 	lea    0xc0(%ebx,%eax,8),%edi
+  804786:	89 7d c0             	mov    %edi,-0x40(%ebp)
+			e->e_start = r;
+  804789:	83 c0 16             	add    $0x16,%eax
+  80478c:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  80478f:	89 7c c3 10          	mov    %edi,0x10(%ebx,%eax,8)
+			e->e_len = 0;
+  804793:	c7 44 c3 14 00 00 00 	movl   $0x0,0x14(%ebx,%eax,8)
+  80479a:	00 
+		e->e_len += nblocks - mapped;
+  80479b:	8b 4d c0             	mov    -0x40(%ebp),%ecx
+  80479e:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+  8047a1:	01 79 04             	add    %edi,0x4(%ecx)
+		pa_set(f, r + nblocks - mapped);
+  8047a4:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8047a7:	89 d8                	mov    %ebx,%eax
+  8047a9:	e8 c1 e9 ff ff       	call   80316f <pa_set>
+		bc_zero(r, nblocks - mapped);
+  8047ae:	83 ec 08             	sub    $0x8,%esp
+  8047b1:	57                   	push   %edi
+  8047b2:	ff 75 dc             	push   -0x24(%ebp)
+  8047b5:	e8 c7 d9 ff ff       	call   802181 <bc_zero>
+		return 0;
+  8047ba:	83 c4 10             	add    $0x10,%esp
+  8047bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047c2:	e9 a5 fc ff ff       	jmp    80446c <file_allocate+0x46>
+			if (!extent_grow(f))
+  8047c7:	89 d8                	mov    %ebx,%eax
+  8047c9:	e8 c7 f1 ff ff       	call   803995 <extent_grow>
+  8047ce:	84 c0                	test   %al,%al
+  8047d0:	74 45                	je     804817 <file_allocate+0x3f1>
+		e = &f->f_extent[f->f_nextent - 1];
+  8047d2:	8b 93 bc 00 00 00    	mov    0xbc(%ebx),%edx
+		bc_zero(e->e_start + e->e_len - 1, 1);
+  8047d8:	83 ec 08             	sub    $0x8,%esp
+  8047db:	6a 01                	push   $0x1
+  8047dd:	8b 84 d3 b8 00 00 00 	mov    0xb8(%ebx,%edx,8),%eax
+  8047e4:	03 84 d3 bc 00 00 00 	add    0xbc(%ebx,%edx,8),%eax
+  8047eb:	83 e8 01             	sub    $0x1,%eax
+  8047ee:	50                   	push   %eax
+  8047ef:	e8 8d d9 ff ff       	call   802181 <bc_zero>
+	for (; mapped < nblocks; mapped++) {
+  8047f4:	83 c6 01             	add    $0x1,%esi
+  8047f7:	83 c4 10             	add    $0x10,%esp
+  8047fa:	39 f7                	cmp    %esi,%edi
+  8047fc:	74 23                	je     804821 <file_allocate+0x3fb>
+		if (f->f_nextent == NEXTENT) {
+  8047fe:	83 bb bc 00 00 00 07 	cmpl   $0x7,0xbc(%ebx)
+  804805:	74 c0                	je     8047c7 <file_allocate+0x3a1>
+		} else if ((r = extent_append(f)) < 0)
+  804807:	89 d8                	mov    %ebx,%eax
+  804809:	e8 1c f2 ff ff       	call   803a2a <extent_append>
+  80480e:	85 c0                	test   %eax,%eax
+  804810:	79 c0                	jns    8047d2 <file_allocate+0x3ac>
+  804812:	e9 55 fc ff ff       	jmp    80446c <file_allocate+0x46>
+	return 0;
+  804817:	b8 00 00 00 00       	mov    $0x0,%eax
+  80481c:	e9 4b fc ff ff       	jmp    80446c <file_allocate+0x46>
+  804821:	b8 00 00 00 00       	mov    $0x0,%eax
+  804826:	e9 41 fc ff ff       	jmp    80446c <file_allocate+0x46>
+		return -E_INVAL;
+  80482b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804830:	e9 37 fc ff ff       	jmp    80446c <file_allocate+0x46>
+  804835:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80483a:	e9 2d fc ff ff       	jmp    80446c <file_allocate+0x46>
+
+0080483f <dcache_set>:
+{
+  80483f:	55                   	push   %ebp
+  804840:	89 e5                	mov    %esp,%ebp
+  804842:	83 ec 08             	sub    $0x8,%esp
+  804845:	8b 45 08             	mov    0x8(%ebp),%eax
+	if (setting != DCACHE_ON && setting != DCACHE_OFF)
+  804848:	8d 50 ff             	lea    -0x1(%eax),%edx
+  80484b:	83 fa 01             	cmp    $0x1,%edx
+  80484e:	77 33                	ja     804883 <dcache_set+0x44>
+	return 0;
+  804850:	ba 00 00 00 00       	mov    $0x0,%edx
+	dcache_off = (setting == DCACHE_OFF);
+  804855:	83 f8 02             	cmp    $0x2,%eax
+  804858:	0f 94 05 fc 83 83 00 	sete   0x8383fc
+	if (dcache_off)
+  80485f:	74 04                	je     804865 <dcache_set+0x26>
+}
+  804861:	89 d0                	mov    %edx,%eax
+  804863:	c9                   	leave
+  804864:	c3                   	ret
+		memset(dcache, 0, sizeof(dcache));
+  804865:	83 ec 04             	sub    $0x4,%esp
+  804868:	68 00 8c 00 00       	push   $0x8c00
+  80486d:	6a 00                	push   $0x0
+  80486f:	68 00 84 83 00       	push   $0x838400
+  804874:	e8 71 2a 00 00       	call   8072ea <memset>
+  804879:	83 c4 10             	add    $0x10,%esp
+	return 0;
+  80487c:	ba 00 00 00 00       	mov    $0x0,%edx
+  804881:	eb de                	jmp    804861 <dcache_set+0x22>
+		return -E_INVAL;
+  804883:	ba fd ff ff ff       	mov    $0xfffffffd,%edx
+  804888:	eb d7                	jmp    804861 <dcache_set+0x22>
+
+0080488a <dcache_stats>:
+{
+  80488a:	55                   	push   %ebp
+  80488b:	89 e5                	mov    %esp,%ebp
+  80488d:	8b 45 08             	mov    0x8(%ebp),%eax
+	ret->ret_dc_hits = dc_hits;
+  804890:	8b 15 f8 83 83 00    	mov    0x8383f8,%edx
+  804896:	89 50 34             	mov    %edx,0x34(%eax)
+	ret->ret_dc_negative = dc_negative;
+  804899:	8b 15 f4 83 83 00    	mov    0x8383f4,%edx
+  80489f:	89 50 38             	mov    %edx,0x38(%eax)
+	ret->ret_dc_misses = dc_misses;
+  8048a2:	8b 15 f0 83 83 00    	mov    0x8383f0,%edx
+  8048a8:	89 50 3c             	mov    %edx,0x3c(%eax)
+}
+  8048ab:	5d                   	pop    %ebp
+  8048ac:	c3                   	ret
+
+008048ad <file_create>:
+{
+  8048ad:	55                   	push   %ebp
+  8048ae:	89 e5                	mov    %esp,%ebp
+  8048b0:	57                   	push   %edi
+  8048b1:	56                   	push   %esi
+  8048b2:	53                   	push   %ebx
+  8048b3:	81 ec d8 00 00 00    	sub    $0xd8,%esp
+	if ((r = walk_path(path, &dir, &f, name)) == 0)
+  8048b9:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8048bf:	50                   	push   %eax
+  8048c0:	8d 8d 60 ff ff ff    	lea    -0xa0(%ebp),%ecx
+  8048c6:	8d 95 64 ff ff ff    	lea    -0x9c(%ebp),%edx
+  8048cc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8048cf:	e8 02 f9 ff ff       	call   8041d6 <walk_path>
+  8048d4:	89 85 50 ff ff ff    	mov    %eax,-0xb0(%ebp)
+  8048da:	83 c4 10             	add    $0x10,%esp
+  8048dd:	85 c0                	test   %eax,%eax
+  8048df:	0f 84 f0 05 00 00    	je     804ed5 <file_create+0x628>
+	if (r != -E_NOT_FOUND || dir == 0)
+  8048e5:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8048e8:	0f 85 d9 05 00 00    	jne    804ec7 <file_create+0x61a>
+  8048ee:	8b 85 64 ff ff ff    	mov    -0x9c(%ebp),%eax
+  8048f4:	89 85 54 ff ff ff    	mov    %eax,-0xac(%ebp)
+  8048fa:	85 c0                	test   %eax,%eax
+  8048fc:	0f 84 c5 05 00 00    	je     804ec7 <file_create+0x61a>
+	assert((dir->f_size % BLKSIZE) == 0);
+  804902:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  804908:	89 c6                	mov    %eax,%esi
+  80490a:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  804910:	89 b5 50 ff ff ff    	mov    %esi,-0xb0(%ebp)
+  804916:	75 41                	jne    804959 <file_create+0xac>
+	nblock = dir->f_size / BLKSIZE;
+  804918:	8d 90 ff 0f 00 00    	lea    0xfff(%eax),%edx
+  80491e:	85 c0                	test   %eax,%eax
+  804920:	0f 48 c2             	cmovs  %edx,%eax
+  804923:	c1 f8 0c             	sar    $0xc,%eax
+  804926:	89 c6                	mov    %eax,%esi
+  804928:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%ebp)
+	start = (di = dir_index(dir)) != NULL ?
+  80492e:	8b 85 54 ff ff ff    	mov    -0xac(%ebp),%eax
+  804934:	e8 8b e6 ff ff       	call   802fc4 <dir_index>
+		MIN(di->di_free, nblock * BLKFILES) : 0;
+  804939:	bf 00 00 00 00       	mov    $0x0,%edi
+  80493e:	85 c0                	test   %eax,%eax
+  804940:	74 0d                	je     80494f <file_create+0xa2>
+  804942:	c1 e6 04             	shl    $0x4,%esi
+  804945:	89 f7                	mov    %esi,%edi
+  804947:	8b 40 0c             	mov    0xc(%eax),%eax
+  80494a:	39 c6                	cmp    %eax,%esi
+  80494c:	0f 47 f8             	cmova  %eax,%edi
+	for (i = start / BLKFILES; i < nblock; i++) {
+  80494f:	89 fe                	mov    %edi,%esi
+  804951:	c1 ee 04             	shr    $0x4,%esi
+  804954:	e9 f1 00 00 00       	jmp    804a4a <file_create+0x19d>
+	assert((dir->f_size % BLKSIZE) == 0);
+  804959:	68 ca 9e 80 00       	push   $0x809eca
+  80495e:	68 2e 99 80 00       	push   $0x80992e
+  804963:	68 06 04 00 00       	push   $0x406
+  804968:	68 fc 9d 80 00       	push   $0x809dfc
+  80496d:	e8 5e 21 00 00       	call   806ad0 <_panic>
+		for (j = 0; j < BLKFILES; j++)
+  804972:	05 00 01 00 00       	add    $0x100,%eax
+  804977:	83 c3 01             	add    $0x1,%ebx
+  80497a:	39 d0                	cmp    %edx,%eax
+  80497c:	0f 84 c5 00 00 00    	je     804a47 <file_create+0x19a>
+			if (f[j].f_name[0] == '\0' && i * BLKFILES + j >= start) {
+  804982:	80 38 00             	cmpb   $0x0,(%eax)
+  804985:	75 eb                	jne    804972 <file_create+0xc5>
+  804987:	39 fb                	cmp    %edi,%ebx
+  804989:	72 e7                	jb     804972 <file_create+0xc5>
+  80498b:	89 c7                	mov    %eax,%edi
+	*file = &f[0];
+  80498d:	89 bd 60 ff ff ff    	mov    %edi,-0xa0(%ebp)
+	journal_dirty(f);
+  804993:	89 bd 40 ff ff ff    	mov    %edi,-0xc0(%ebp)
+  804999:	83 ec 0c             	sub    $0xc,%esp
+  80499c:	57                   	push   %edi
+  80499d:	e8 6c e1 ff ff       	call   802b0e <journal_dirty>
+	memset(f, 0, sizeof(*f));
+  8049a2:	83 c4 0c             	add    $0xc,%esp
+  8049a5:	68 00 01 00 00       	push   $0x100
+  8049aa:	6a 00                	push   $0x0
+  8049ac:	57                   	push   %edi
+  8049ad:	e8 38 29 00 00       	call   8072ea <memset>
+	strcpy(f->f_name, name);
+  8049b2:	83 c4 08             	add    $0x8,%esp
+  8049b5:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8049bb:	50                   	push   %eax
+  8049bc:	57                   	push   %edi
+  8049bd:	e8 d7 27 00 00       	call   807199 <strcpy>
+	f->f_flags = FILE_EXTENTS;
+  8049c2:	89 f8                	mov    %edi,%eax
+  8049c4:	c7 87 88 00 00 00 01 	movl   $0x1,0x88(%edi)
+  8049cb:	00 00 00 
+	pa_drop(f);
+  8049ce:	e8 8f e4 ff ff       	call   802e62 <pa_drop>
+	di = dir_index(dir);
+  8049d3:	8b 85 54 ff ff ff    	mov    -0xac(%ebp),%eax
+  8049d9:	e8 e6 e5 ff ff       	call   802fc4 <dir_index>
+  8049de:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%ebp)
+	if (!di && (dir->f_flags & FILE_DIRINDEX))
+  8049e4:	83 c4 10             	add    $0x10,%esp
+  8049e7:	85 c0                	test   %eax,%eax
+  8049e9:	0f 84 05 01 00 00    	je     804af4 <file_create+0x247>
+	    (di && 2 * (di->di_nentries + 1) > di->di_nslots)) {
+  8049ef:	8b b5 4c ff ff ff    	mov    -0xb4(%ebp),%esi
+  8049f5:	8b 46 08             	mov    0x8(%esi),%eax
+  8049f8:	8d 44 00 02          	lea    0x2(%eax,%eax,1),%eax
+  8049fc:	39 46 04             	cmp    %eax,0x4(%esi)
+  8049ff:	0f 82 14 01 00 00    	jb     804b19 <file_create+0x26c>
+	if ((di = dir_index(dir)) == NULL || dir_entry(dir, ent, &f) < 0)
+  804a05:	8b b5 54 ff ff ff    	mov    -0xac(%ebp),%esi
+  804a0b:	89 f0                	mov    %esi,%eax
+  804a0d:	e8 b2 e5 ff ff       	call   802fc4 <dir_index>
+  804a12:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%ebp)
+  804a18:	85 c0                	test   %eax,%eax
+  804a1a:	0f 84 89 04 00 00    	je     804ea9 <file_create+0x5fc>
+  804a20:	8d 8d 5c ff ff ff    	lea    -0xa4(%ebp),%ecx
+  804a26:	89 da                	mov    %ebx,%edx
+  804a28:	89 f0                	mov    %esi,%eax
+  804a2a:	e8 b9 f5 ff ff       	call   803fe8 <dir_entry>
+  804a2f:	85 c0                	test   %eax,%eax
+  804a31:	0f 88 72 04 00 00    	js     804ea9 <file_create+0x5fc>
+	dir_slot_insert(di->di_blocks, di->di_nslots, dir_hash(f->f_name),
+  804a37:	8b 95 5c ff ff ff    	mov    -0xa4(%ebp),%edx
+  uint32_t h = 2166136261U;
+  804a3d:	bf c5 9d 1c 81       	mov    $0x811c9dc5,%edi
+  while (*name)
+  804a42:	e9 eb 03 00 00       	jmp    804e32 <file_create+0x585>
+	for (i = start / BLKFILES; i < nblock; i++) {
+  804a47:	83 c6 01             	add    $0x1,%esi
+  804a4a:	8b 85 4c ff ff ff    	mov    -0xb4(%ebp),%eax
+  804a50:	39 c6                	cmp    %eax,%esi
+  804a52:	73 33                	jae    804a87 <file_create+0x1da>
+		if ((r = file_get_block(dir, i, &blk)) < 0)
+  804a54:	83 ec 04             	sub    $0x4,%esp
+  804a57:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  804a5d:	50                   	push   %eax
+  804a5e:	56                   	push   %esi
+  804a5f:	ff b5 54 ff ff ff    	push   -0xac(%ebp)
+  804a65:	e8 4c f3 ff ff       	call   803db6 <file_get_block>
+  804a6a:	83 c4 10             	add    $0x10,%esp
+  804a6d:	85 c0                	test   %eax,%eax
+  804a6f:	78 78                	js     804ae9 <file_create+0x23c>
+		for (j = 0; j < BLKFILES; j++)
+  804a71:	89 f3                	mov    %esi,%ebx
+  804a73:	c1 e3 04             	shl    $0x4,%ebx
+  804a76:	8b 85 5c ff ff ff    	mov    -0xa4(%ebp),%eax
+  804a7c:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  804a82:	e9 f3 fe ff ff       	jmp    80497a <file_create+0xcd>
+	if ((r = file_get_block(dir, i, &blk)) < 0)
+  804a87:	83 ec 04             	sub    $0x4,%esp
+  804a8a:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  804a90:	50                   	push   %eax
+  804a91:	56                   	push   %esi
+  804a92:	8b bd 54 ff ff ff    	mov    -0xac(%ebp),%edi
+  804a98:	57                   	push   %edi
+  804a99:	e8 18 f3 ff ff       	call   803db6 <file_get_block>
+  804a9e:	83 c4 10             	add    $0x10,%esp
+  804aa1:	85 c0                	test   %eax,%eax
+  804aa3:	0f 88 38 04 00 00    	js     804ee1 <file_create+0x634>
+	journal_dirty(dir);
+  804aa9:	83 ec 0c             	sub    $0xc,%esp
+  804aac:	57                   	push   %edi
+  804aad:	e8 5c e0 ff ff       	call   802b0e <journal_dirty>
+	dir->f_size += BLKSIZE;
+  804ab2:	81 87 80 00 00 00 00 	addl   $0x1000,0x80(%edi)
+  804ab9:	10 00 00 
+	journal_dirty(blk);
+  804abc:	8b 85 5c ff ff ff    	mov    -0xa4(%ebp),%eax
+  804ac2:	89 c7                	mov    %eax,%edi
+  804ac4:	89 04 24             	mov    %eax,(%esp)
+  804ac7:	e8 42 e0 ff ff       	call   802b0e <journal_dirty>
+	memset(blk, 0, BLKSIZE);
+  804acc:	83 c4 0c             	add    $0xc,%esp
+  804acf:	68 00 10 00 00       	push   $0x1000
+  804ad4:	6a 00                	push   $0x0
+  804ad6:	57                   	push   %edi
+  804ad7:	e8 0e 28 00 00       	call   8072ea <memset>
+	*ent = i * BLKFILES;
+  804adc:	c1 e6 04             	shl    $0x4,%esi
+  804adf:	89 f3                	mov    %esi,%ebx
+	return 0;
+  804ae1:	83 c4 10             	add    $0x10,%esp
+  804ae4:	e9 a4 fe ff ff       	jmp    80498d <file_create+0xe0>
+		if ((r = file_get_block(dir, i, &blk)) < 0)
+  804ae9:	89 85 50 ff ff ff    	mov    %eax,-0xb0(%ebp)
+  804aef:	e9 d3 03 00 00       	jmp    804ec7 <file_create+0x61a>
+	if (!di && (dir->f_flags & FILE_DIRINDEX))
+  804af4:	8b 85 54 ff ff ff    	mov    -0xac(%ebp),%eax
+  804afa:	f6 80 88 00 00 00 02 	testb  $0x2,0x88(%eax)
+  804b01:	75 4c                	jne    804b4f <file_create+0x2a2>
+	if ((!di && dir->f_size / BLKSIZE >= DIRINDEX_MINBLOCKS) ||
+  804b03:	8b 85 54 ff ff ff    	mov    -0xac(%ebp),%eax
+  804b09:	81 b8 80 00 00 00 ff 	cmpl   $0x3fff,0x80(%eax)
+  804b10:	3f 00 00 
+  804b13:	0f 8e ec fe ff ff    	jle    804a05 <file_create+0x158>
+	nent = dir->f_size / BLKSIZE * BLKFILES;
+  804b19:	8b 85 54 ff ff ff    	mov    -0xac(%ebp),%eax
+  804b1f:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  804b25:	8d b8 ff 0f 00 00    	lea    0xfff(%eax),%edi
+  804b2b:	85 c0                	test   %eax,%eax
+  804b2d:	0f 49 f8             	cmovns %eax,%edi
+  804b30:	c1 ff 0c             	sar    $0xc,%edi
+  804b33:	c1 e7 04             	shl    $0x4,%edi
+	for (i = n = 0; i < nent; i++) {
+  804b36:	be 00 00 00 00       	mov    $0x0,%esi
+  804b3b:	c7 85 48 ff ff ff 00 	movl   $0x0,-0xb8(%ebp)
+  804b42:	00 00 00 
+  804b45:	89 9d 44 ff ff ff    	mov    %ebx,-0xbc(%ebp)
+  804b4b:	89 fb                	mov    %edi,%ebx
+  804b4d:	eb 0f                	jmp    804b5e <file_create+0x2b1>
+		dir_index_drop(dir);
+  804b4f:	e8 5a e8 ff ff       	call   8033ae <dir_index_drop>
+  804b54:	eb ad                	jmp    804b03 <file_create+0x256>
+			nfree = i;
+  804b56:	39 df                	cmp    %ebx,%edi
+  804b58:	0f 44 de             	cmove  %esi,%ebx
+	for (i = n = 0; i < nent; i++) {
+  804b5b:	83 c6 01             	add    $0x1,%esi
+  804b5e:	39 f7                	cmp    %esi,%edi
+  804b60:	74 2f                	je     804b91 <file_create+0x2e4>
+		if ((r = dir_entry(dir, i, &f)) < 0)
+  804b62:	8d 8d 5c ff ff ff    	lea    -0xa4(%ebp),%ecx
+  804b68:	89 f2                	mov    %esi,%edx
+  804b6a:	8b 85 54 ff ff ff    	mov    -0xac(%ebp),%eax
+  804b70:	e8 73 f4 ff ff       	call   803fe8 <dir_entry>
+  804b75:	85 c0                	test   %eax,%eax
+  804b77:	0f 88 6e 02 00 00    	js     804deb <file_create+0x53e>
+		if (f->f_name[0] != '\0')
+  804b7d:	8b 85 5c ff ff ff    	mov    -0xa4(%ebp),%eax
+  804b83:	80 38 00             	cmpb   $0x0,(%eax)
+  804b86:	74 ce                	je     804b56 <file_create+0x2a9>
+			n++;
+  804b88:	83 85 48 ff ff ff 01 	addl   $0x1,-0xb8(%ebp)
+  804b8f:	eb ca                	jmp    804b5b <file_create+0x2ae>
+	for (nslots = DIRSLOTS; nslots < 3 * (n + 1); nslots *= 2)
+  804b91:	89 9d 34 ff ff ff    	mov    %ebx,-0xcc(%ebp)
+  804b97:	8b 9d 44 ff ff ff    	mov    -0xbc(%ebp),%ebx
+  804b9d:	8b 85 48 ff ff ff    	mov    -0xb8(%ebp),%eax
+  804ba3:	8d 44 40 03          	lea    0x3(%eax,%eax,2),%eax
+  804ba7:	ba 00 02 00 00       	mov    $0x200,%edx
+  804bac:	eb 02                	jmp    804bb0 <file_create+0x303>
+  804bae:	01 d2                	add    %edx,%edx
+  804bb0:	39 c2                	cmp    %eax,%edx
+  804bb2:	72 fa                	jb     804bae <file_create+0x301>
+	ntab = nslots / DIRSLOTS;
+  804bb4:	89 95 3c ff ff ff    	mov    %edx,-0xc4(%ebp)
+  804bba:	89 d7                	mov    %edx,%edi
+  804bbc:	c1 ef 09             	shr    $0x9,%edi
+	di = dir_index(dir);
+  804bbf:	8b 85 54 ff ff ff    	mov    -0xac(%ebp),%eax
+  804bc5:	e8 fa e3 ff ff       	call   802fc4 <dir_index>
+  804bca:	89 85 38 ff ff ff    	mov    %eax,-0xc8(%ebp)
+	if (ntab > DIRINDEX_MAXBLOCKS || super->s_nfree < ntab + !di)
+  804bd0:	81 bd 3c ff ff ff ff 	cmpl   $0x7f9ff,-0xc4(%ebp)
+  804bd7:	f9 07 00 
+  804bda:	0f 87 11 02 00 00    	ja     804df1 <file_create+0x544>
+  804be0:	83 f8 01             	cmp    $0x1,%eax
+  804be3:	89 f8                	mov    %edi,%eax
+  804be5:	83 d0 00             	adc    $0x0,%eax
+  804be8:	8b 15 88 3f 84 00    	mov    0x843f88,%edx
+  804bee:	39 82 08 01 00 00    	cmp    %eax,0x108(%edx)
+  804bf4:	0f 82 f7 01 00 00    	jb     804df1 <file_create+0x544>
+	for (i = 0; i < ntab; i++) {
+  804bfa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804bff:	39 df                	cmp    %ebx,%edi
+  804c01:	74 46                	je     804c49 <file_create+0x39c>
+		if ((r = alloc_block()) < 0)
+  804c03:	e8 62 e9 ff ff       	call   80356a <alloc_block>
+  804c08:	85 c0                	test   %eax,%eax
+  804c0a:	78 28                	js     804c34 <file_create+0x387>
+		blocks[i] = r;
+  804c0c:	89 04 9d 00 74 83 00 	mov    %eax,0x837400(,%ebx,4)
+		memset(diskaddr(r), 0, BLKSIZE);
+  804c13:	83 ec 0c             	sub    $0xc,%esp
+  804c16:	50                   	push   %eax
+  804c17:	e8 78 cc ff ff       	call   801894 <diskaddr>
+  804c1c:	83 c4 0c             	add    $0xc,%esp
+  804c1f:	68 00 10 00 00       	push   $0x1000
+  804c24:	6a 00                	push   $0x0
+  804c26:	50                   	push   %eax
+  804c27:	e8 be 26 00 00       	call   8072ea <memset>
+	for (i = 0; i < ntab; i++) {
+  804c2c:	83 c3 01             	add    $0x1,%ebx
+  804c2f:	83 c4 10             	add    $0x10,%esp
+  804c32:	eb cb                	jmp    804bff <file_create+0x352>
+			panic("dir_index_build: %e", r);
+  804c34:	50                   	push   %eax
+  804c35:	68 e7 9e 80 00       	push   $0x809ee7
+  804c3a:	68 95 03 00 00       	push   $0x395
+  804c3f:	68 fc 9d 80 00       	push   $0x809dfc
+  804c44:	e8 87 1e 00 00       	call   806ad0 <_panic>
+	for (i = 0; i < nent; i++) {
+  804c49:	bf 00 00 00 00       	mov    $0x0,%edi
+  804c4e:	89 b5 4c ff ff ff    	mov    %esi,-0xb4(%ebp)
+  804c54:	89 9d 30 ff ff ff    	mov    %ebx,-0xd0(%ebp)
+  804c5a:	eb 56                	jmp    804cb2 <file_create+0x405>
+			panic("dir_index_build: %e", r);
+  804c5c:	50                   	push   %eax
+  804c5d:	68 e7 9e 80 00       	push   $0x809ee7
+  804c62:	68 9b 03 00 00       	push   $0x39b
+  804c67:	68 fc 9d 80 00       	push   $0x809dfc
+  804c6c:	e8 5f 1e 00 00       	call   806ad0 <_panic>
+	for (i = h & (nslots - 1); ; i = (i + 1) & (nslots - 1)) {
+  804c71:	8b 85 3c ff ff ff    	mov    -0xc4(%ebp),%eax
+  804c77:	8d 70 ff             	lea    -0x1(%eax),%esi
+  804c7a:	89 d3                	mov    %edx,%ebx
+  804c7c:	21 f3                	and    %esi,%ebx
+  804c7e:	89 bd 44 ff ff ff    	mov    %edi,-0xbc(%ebp)
+  804c84:	89 d7                	mov    %edx,%edi
+		ds = dir_slot(blocks, i);
+  804c86:	89 da                	mov    %ebx,%edx
+  804c88:	b8 00 74 83 00       	mov    $0x837400,%eax
+  804c8d:	e8 b5 e3 ff ff       	call   803047 <dir_slot>
+		if (ds->ds_ent == 0)
+  804c92:	83 78 04 00          	cmpl   $0x0,0x4(%eax)
+  804c96:	74 07                	je     804c9f <file_create+0x3f2>
+	for (i = h & (nslots - 1); ; i = (i + 1) & (nslots - 1)) {
+  804c98:	83 c3 01             	add    $0x1,%ebx
+  804c9b:	21 f3                	and    %esi,%ebx
+		ds = dir_slot(blocks, i);
+  804c9d:	eb e7                	jmp    804c86 <file_create+0x3d9>
+	ds->ds_hash = h;
+  804c9f:	89 fa                	mov    %edi,%edx
+  804ca1:	8b bd 44 ff ff ff    	mov    -0xbc(%ebp),%edi
+  804ca7:	89 10                	mov    %edx,(%eax)
+	ds->ds_ent = ent + 1;
+  804ca9:	8d 57 01             	lea    0x1(%edi),%edx
+  804cac:	89 50 04             	mov    %edx,0x4(%eax)
+	for (i = 0; i < nent; i++) {
+  804caf:	83 c7 01             	add    $0x1,%edi
+  804cb2:	39 bd 4c ff ff ff    	cmp    %edi,-0xb4(%ebp)
+  804cb8:	74 3e                	je     804cf8 <file_create+0x44b>
+		if ((r = dir_entry(dir, i, &f)) < 0)
+  804cba:	8d 8d 5c ff ff ff    	lea    -0xa4(%ebp),%ecx
+  804cc0:	89 fa                	mov    %edi,%edx
+  804cc2:	8b 85 54 ff ff ff    	mov    -0xac(%ebp),%eax
+  804cc8:	e8 1b f3 ff ff       	call   803fe8 <dir_entry>
+  804ccd:	85 c0                	test   %eax,%eax
+  804ccf:	78 8b                	js     804c5c <file_create+0x3af>
+		if (f->f_name[0] != '\0')
+  804cd1:	8b 8d 5c ff ff ff    	mov    -0xa4(%ebp),%ecx
+  uint32_t h = 2166136261U;
+  804cd7:	ba c5 9d 1c 81       	mov    $0x811c9dc5,%edx
+  804cdc:	80 39 00             	cmpb   $0x0,(%ecx)
+  804cdf:	74 ce                	je     804caf <file_create+0x402>
+  while (*name)
+  804ce1:	0f b6 01             	movzbl (%ecx),%eax
+  804ce4:	84 c0                	test   %al,%al
+  804ce6:	74 89                	je     804c71 <file_create+0x3c4>
+    h = (h ^ (uint8_t) *name++) * 16777619;
+  804ce8:	83 c1 01             	add    $0x1,%ecx
+  804ceb:	0f b6 c0             	movzbl %al,%eax
+  804cee:	31 c2                	xor    %eax,%edx
+  804cf0:	69 d2 93 01 00 01    	imul   $0x1000193,%edx,%edx
+  804cf6:	eb e9                	jmp    804ce1 <file_create+0x434>
+	if (di) {
+  804cf8:	8b 9d 30 ff ff ff    	mov    -0xd0(%ebp),%ebx
+  804cfe:	8b bd 38 ff ff ff    	mov    -0xc8(%ebp),%edi
+  804d04:	85 ff                	test   %edi,%edi
+  804d06:	0f 84 85 00 00 00    	je     804d91 <file_create+0x4e4>
+		journal_dirty(di);
+  804d0c:	83 ec 0c             	sub    $0xc,%esp
+  804d0f:	57                   	push   %edi
+  804d10:	e8 f9 dd ff ff       	call   802b0e <journal_dirty>
+		for (i = 0; i < di->di_nslots / DIRSLOTS; i++)
+  804d15:	83 c4 10             	add    $0x10,%esp
+  804d18:	be 00 00 00 00       	mov    $0x0,%esi
+  804d1d:	eb 12                	jmp    804d31 <file_create+0x484>
+			free_block(di->di_blocks[i]);
+  804d1f:	83 ec 0c             	sub    $0xc,%esp
+  804d22:	ff 74 b7 10          	push   0x10(%edi,%esi,4)
+  804d26:	e8 46 e5 ff ff       	call   803271 <free_block>
+		for (i = 0; i < di->di_nslots / DIRSLOTS; i++)
+  804d2b:	83 c6 01             	add    $0x1,%esi
+  804d2e:	83 c4 10             	add    $0x10,%esp
+  804d31:	8b 47 04             	mov    0x4(%edi),%eax
+  804d34:	c1 e8 09             	shr    $0x9,%eax
+  804d37:	39 c6                	cmp    %eax,%esi
+  804d39:	72 e4                	jb     804d1f <file_create+0x472>
+	memset(di, 0, BLKSIZE);
+  804d3b:	83 ec 04             	sub    $0x4,%esp
+  804d3e:	68 00 10 00 00       	push   $0x1000
+  804d43:	6a 00                	push   $0x0
+  804d45:	8b bd 38 ff ff ff    	mov    -0xc8(%ebp),%edi
+  804d4b:	57                   	push   %edi
+  804d4c:	e8 99 25 00 00       	call   8072ea <memset>
+	di->di_magic = DIRINDEX_MAGIC;
+  804d51:	89 f8                	mov    %edi,%eax
+  804d53:	c7 07 58 44 49 44    	movl   $0x44494458,(%edi)
+	di->di_nslots = nslots;
+  804d59:	8b bd 3c ff ff ff    	mov    -0xc4(%ebp),%edi
+  804d5f:	89 78 04             	mov    %edi,0x4(%eax)
+	di->di_nentries = n;
+  804d62:	8b bd 48 ff ff ff    	mov    -0xb8(%ebp),%edi
+  804d68:	89 78 08             	mov    %edi,0x8(%eax)
+	di->di_free = nfree;
+  804d6b:	8b bd 34 ff ff ff    	mov    -0xcc(%ebp),%edi
+  804d71:	89 78 0c             	mov    %edi,0xc(%eax)
+	memmove(di->di_blocks, blocks, ntab * sizeof(blocks[0]));
+  804d74:	83 c4 0c             	add    $0xc,%esp
+  804d77:	c1 e3 02             	shl    $0x2,%ebx
+  804d7a:	53                   	push   %ebx
+  804d7b:	68 00 74 83 00       	push   $0x837400
+  804d80:	83 c0 10             	add    $0x10,%eax
+  804d83:	50                   	push   %eax
+  804d84:	e8 96 25 00 00       	call   80731f <memmove>
+	return 0;
+  804d89:	83 c4 10             	add    $0x10,%esp
+  804d8c:	e9 18 01 00 00       	jmp    804ea9 <file_create+0x5fc>
+		if ((r = alloc_block()) < 0)
+  804d91:	e8 d4 e7 ff ff       	call   80356a <alloc_block>
+  804d96:	89 c6                	mov    %eax,%esi
+  804d98:	85 c0                	test   %eax,%eax
+  804d9a:	78 3a                	js     804dd6 <file_create+0x529>
+		di = diskaddr(r);
+  804d9c:	83 ec 0c             	sub    $0xc,%esp
+  804d9f:	50                   	push   %eax
+  804da0:	e8 ef ca ff ff       	call   801894 <diskaddr>
+  804da5:	89 85 38 ff ff ff    	mov    %eax,-0xc8(%ebp)
+		journal_dirty(di);
+  804dab:	89 04 24             	mov    %eax,(%esp)
+  804dae:	e8 5b dd ff ff       	call   802b0e <journal_dirty>
+		journal_dirty(dir);
+  804db3:	8b bd 54 ff ff ff    	mov    -0xac(%ebp),%edi
+  804db9:	89 3c 24             	mov    %edi,(%esp)
+  804dbc:	e8 4d dd ff ff       	call   802b0e <journal_dirty>
+		dir->f_index = r;
+  804dc1:	89 b7 f8 00 00 00    	mov    %esi,0xf8(%edi)
+		dir->f_flags |= FILE_DIRINDEX;
+  804dc7:	83 8f 88 00 00 00 02 	orl    $0x2,0x88(%edi)
+  804dce:	83 c4 10             	add    $0x10,%esp
+  804dd1:	e9 65 ff ff ff       	jmp    804d3b <file_create+0x48e>
+			panic("dir_index_build: %e", r);
+  804dd6:	50                   	push   %eax
+  804dd7:	68 e7 9e 80 00       	push   $0x809ee7
+  804ddc:	68 a7 03 00 00       	push   $0x3a7
+  804de1:	68 fc 9d 80 00       	push   $0x809dfc
+  804de6:	e8 e5 1c 00 00       	call   806ad0 <_panic>
+  804deb:	8b 9d 44 ff ff ff    	mov    -0xbc(%ebp),%ebx
+		if (di && di->di_nentries + 2 > di->di_nslots)
+  804df1:	8b 8d 4c ff ff ff    	mov    -0xb4(%ebp),%ecx
+  804df7:	85 c9                	test   %ecx,%ecx
+  804df9:	0f 84 06 fc ff ff    	je     804a05 <file_create+0x158>
+  804dff:	8b 41 08             	mov    0x8(%ecx),%eax
+  804e02:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%ebp)
+  804e08:	83 c0 02             	add    $0x2,%eax
+  804e0b:	39 41 04             	cmp    %eax,0x4(%ecx)
+  804e0e:	0f 83 f1 fb ff ff    	jae    804a05 <file_create+0x158>
+			dir_index_drop(dir);
+  804e14:	8b 85 54 ff ff ff    	mov    -0xac(%ebp),%eax
+  804e1a:	e8 8f e5 ff ff       	call   8033ae <dir_index_drop>
+  804e1f:	e9 e1 fb ff ff       	jmp    804a05 <file_create+0x158>
+  804e24:	83 c2 01             	add    $0x1,%edx
+  804e27:	0f b6 c0             	movzbl %al,%eax
+  804e2a:	31 c7                	xor    %eax,%edi
+  804e2c:	69 ff 93 01 00 01    	imul   $0x1000193,%edi,%edi
+  while (*name)
+  804e32:	0f b6 02             	movzbl (%edx),%eax
+  804e35:	84 c0                	test   %al,%al
+  804e37:	75 eb                	jne    804e24 <file_create+0x577>
+	dir_slot_insert(di->di_blocks, di->di_nslots, dir_hash(f->f_name),
+  804e39:	8b 85 4c ff ff ff    	mov    -0xb4(%ebp),%eax
+  804e3f:	8d 48 10             	lea    0x10(%eax),%ecx
+	for (i = h & (nslots - 1); ; i = (i + 1) & (nslots - 1)) {
+  804e42:	8b 40 04             	mov    0x4(%eax),%eax
+  804e45:	8d 50 ff             	lea    -0x1(%eax),%edx
+  804e48:	89 fe                	mov    %edi,%esi
+  804e4a:	21 d6                	and    %edx,%esi
+  804e4c:	89 bd 48 ff ff ff    	mov    %edi,-0xb8(%ebp)
+  804e52:	89 d7                	mov    %edx,%edi
+  804e54:	89 9d 44 ff ff ff    	mov    %ebx,-0xbc(%ebp)
+  804e5a:	89 cb                	mov    %ecx,%ebx
+  804e5c:	eb 05                	jmp    804e63 <file_create+0x5b6>
+  804e5e:	83 c6 01             	add    $0x1,%esi
+  804e61:	21 fe                	and    %edi,%esi
+		ds = dir_slot(blocks, i);
+  804e63:	89 f2                	mov    %esi,%edx
+  804e65:	89 d8                	mov    %ebx,%eax
+  804e67:	e8 db e1 ff ff       	call   803047 <dir_slot>
+		if (ds->ds_ent == 0)
+  804e6c:	83 78 04 00          	cmpl   $0x0,0x4(%eax)
+  804e70:	75 ec                	jne    804e5e <file_create+0x5b1>
+		journal_dirty(ds);
+  804e72:	8b bd 48 ff ff ff    	mov    -0xb8(%ebp),%edi
+  804e78:	89 c6                	mov    %eax,%esi
+  804e7a:	8b 9d 44 ff ff ff    	mov    -0xbc(%ebp),%ebx
+  804e80:	83 ec 0c             	sub    $0xc,%esp
+  804e83:	50                   	push   %eax
+  804e84:	e8 85 dc ff ff       	call   802b0e <journal_dirty>
+	ds->ds_hash = h;
+  804e89:	89 3e                	mov    %edi,(%esi)
+	ds->ds_ent = ent + 1;
+  804e8b:	83 c3 01             	add    $0x1,%ebx
+  804e8e:	89 5e 04             	mov    %ebx,0x4(%esi)
+	journal_dirty(di);
+  804e91:	8b bd 4c ff ff ff    	mov    -0xb4(%ebp),%edi
+  804e97:	89 3c 24             	mov    %edi,(%esp)
+  804e9a:	e8 6f dc ff ff       	call   802b0e <journal_dirty>
+	di->di_nentries++;
+  804e9f:	83 47 08 01          	addl   $0x1,0x8(%edi)
+	di->di_free = ent + 1;
+  804ea3:	89 5f 0c             	mov    %ebx,0xc(%edi)
+  804ea6:	83 c4 10             	add    $0x10,%esp
+	dcache_enter(dir, name, f);
+  804ea9:	8b bd 40 ff ff ff    	mov    -0xc0(%ebp),%edi
+  804eaf:	89 f9                	mov    %edi,%ecx
+  804eb1:	8d 95 68 ff ff ff    	lea    -0x98(%ebp),%edx
+  804eb7:	8b 85 54 ff ff ff    	mov    -0xac(%ebp),%eax
+  804ebd:	e8 a7 e1 ff ff       	call   803069 <dcache_enter>
+	*pf = f;
+  804ec2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  804ec5:	89 38                	mov    %edi,(%eax)
+}
+  804ec7:	8b 85 50 ff ff ff    	mov    -0xb0(%ebp),%eax
+  804ecd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804ed0:	5b                   	pop    %ebx
+  804ed1:	5e                   	pop    %esi
+  804ed2:	5f                   	pop    %edi
+  804ed3:	5d                   	pop    %ebp
+  804ed4:	c3                   	ret
+		return -E_FILE_EXISTS;
+  804ed5:	c7 85 50 ff ff ff f3 	movl   $0xfffffff3,-0xb0(%ebp)
+  804edc:	ff ff ff 
+  804edf:	eb e6                	jmp    804ec7 <file_create+0x61a>
+		return r;
+  804ee1:	89 85 50 ff ff ff    	mov    %eax,-0xb0(%ebp)
+  804ee7:	eb de                	jmp    804ec7 <file_create+0x61a>
+
+00804ee9 <file_open>:
+{
+  804ee9:	55                   	push   %ebp
+  804eea:	89 e5                	mov    %esp,%ebp
+  804eec:	83 ec 14             	sub    $0x14,%esp
+	return walk_path(path, 0, pf, 0);
+  804eef:	6a 00                	push   $0x0
+  804ef1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  804ef4:	ba 00 00 00 00       	mov    $0x0,%edx
+  804ef9:	8b 45 08             	mov    0x8(%ebp),%eax
+  804efc:	e8 d5 f2 ff ff       	call   8041d6 <walk_path>
+}
+  804f01:	c9                   	leave
+  804f02:	c3                   	ret
+
+00804f03 <file_read>:
+{
+  804f03:	55                   	push   %ebp
+  804f04:	89 e5                	mov    %esp,%ebp
+  804f06:	57                   	push   %edi
+  804f07:	56                   	push   %esi
+  804f08:	53                   	push   %ebx
+  804f09:	83 ec 2c             	sub    $0x2c,%esp
+  804f0c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  804f0f:	8b 75 14             	mov    0x14(%ebp),%esi
+	if (offset >= f->f_size)
+  804f12:	8b 45 08             	mov    0x8(%ebp),%eax
+  804f15:	8b 90 80 00 00 00    	mov    0x80(%eax),%edx
+		return 0;
+  804f1b:	b8 00 00 00 00       	mov    $0x0,%eax
+	if (offset >= f->f_size)
+  804f20:	39 f2                	cmp    %esi,%edx
+  804f22:	0f 8e 05 01 00 00    	jle    80502d <file_read+0x12a>
+	count = MIN(count, f->f_size - offset);
+  804f28:	29 f2                	sub    %esi,%edx
+  804f2a:	39 ca                	cmp    %ecx,%edx
+  804f2c:	0f 46 ca             	cmovbe %edx,%ecx
+  804f2f:	89 cb                	mov    %ecx,%ebx
+	if (f->f_flags & FILE_INLINE) {
+  804f31:	8b 45 08             	mov    0x8(%ebp),%eax
+  804f34:	f6 80 88 00 00 00 04 	testb  $0x4,0x88(%eax)
+  804f3b:	75 17                	jne    804f54 <file_read+0x51>
+	for (pos = offset; pos < offset + count; ) {
+  804f3d:	8d 0c 0e             	lea    (%esi,%ecx,1),%ecx
+			n = MIN(n, (offset + count - 1) / BLKSIZE - pos / BLKSIZE + 1);
+  804f40:	8d 41 ff             	lea    -0x1(%ecx),%eax
+  804f43:	c1 e8 0c             	shr    $0xc,%eax
+  804f46:	83 c0 01             	add    $0x1,%eax
+  804f49:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  804f4c:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+  804f4f:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+  804f52:	eb 7d                	jmp    804fd1 <file_read+0xce>
+		memmove(buf, f->f_data + offset, count);
+  804f54:	83 ec 04             	sub    $0x4,%esp
+  804f57:	51                   	push   %ecx
+  804f58:	8b 45 08             	mov    0x8(%ebp),%eax
+  804f5b:	8d 84 30 8c 00 00 00 	lea    0x8c(%eax,%esi,1),%eax
+  804f62:	50                   	push   %eax
+  804f63:	ff 75 0c             	push   0xc(%ebp)
+  804f66:	e8 b4 23 00 00       	call   80731f <memmove>
+		return count;
+  804f6b:	89 d8                	mov    %ebx,%eax
+  804f6d:	83 c4 10             	add    $0x10,%esp
+  804f70:	e9 b8 00 00 00       	jmp    80502d <file_read+0x12a>
+			if ((r = file_get_block(f, pos / BLKSIZE, &blk)) < 0)
+  804f75:	83 ec 04             	sub    $0x4,%esp
+  804f78:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  804f7b:	50                   	push   %eax
+  804f7c:	57                   	push   %edi
+  804f7d:	ff 75 08             	push   0x8(%ebp)
+  804f80:	e8 31 ee ff ff       	call   803db6 <file_get_block>
+  804f85:	83 c4 10             	add    $0x10,%esp
+  804f88:	85 c0                	test   %eax,%eax
+  804f8a:	0f 88 9d 00 00 00    	js     80502d <file_read+0x12a>
+			n = 1;
+  804f90:	bb 01 00 00 00       	mov    $0x1,%ebx
+		bn = MIN(n * BLKSIZE - pos % BLKSIZE, offset + count - pos);
+  804f95:	89 f2                	mov    %esi,%edx
+  804f97:	c1 fa 1f             	sar    $0x1f,%edx
+  804f9a:	c1 ea 14             	shr    $0x14,%edx
+  804f9d:	8d 04 16             	lea    (%esi,%edx,1),%eax
+  804fa0:	25 ff 0f 00 00       	and    $0xfff,%eax
+  804fa5:	29 d0                	sub    %edx,%eax
+  804fa7:	c1 e3 0c             	shl    $0xc,%ebx
+  804faa:	29 c3                	sub    %eax,%ebx
+  804fac:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+  804faf:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  804fb2:	29 ca                	sub    %ecx,%edx
+  804fb4:	39 d3                	cmp    %edx,%ebx
+  804fb6:	0f 47 da             	cmova  %edx,%ebx
+		memmove(buf, blk + pos % BLKSIZE, bn);
+  804fb9:	83 ec 04             	sub    $0x4,%esp
+  804fbc:	53                   	push   %ebx
+  804fbd:	03 45 e4             	add    -0x1c(%ebp),%eax
+  804fc0:	50                   	push   %eax
+  804fc1:	ff 75 0c             	push   0xc(%ebp)
+  804fc4:	e8 56 23 00 00       	call   80731f <memmove>
+		pos += bn;
+  804fc9:	01 de                	add    %ebx,%esi
+		buf += bn;
+  804fcb:	01 5d 0c             	add    %ebx,0xc(%ebp)
+  804fce:	83 c4 10             	add    $0x10,%esp
+	for (pos = offset; pos < offset + count; ) {
+  804fd1:	89 75 d0             	mov    %esi,-0x30(%ebp)
+  804fd4:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  804fd7:	39 c6                	cmp    %eax,%esi
+  804fd9:	73 4d                	jae    805028 <file_read+0x125>
+		if ((n = file_block_run(f, pos / BLKSIZE, &diskbno)) > 0) {
+  804fdb:	8d be ff 0f 00 00    	lea    0xfff(%esi),%edi
+  804fe1:	85 f6                	test   %esi,%esi
+  804fe3:	0f 49 fe             	cmovns %esi,%edi
+  804fe6:	c1 ff 0c             	sar    $0xc,%edi
+  804fe9:	8d 4d e0             	lea    -0x20(%ebp),%ecx
+  804fec:	89 fa                	mov    %edi,%edx
+  804fee:	8b 45 08             	mov    0x8(%ebp),%eax
+  804ff1:	e8 f8 e6 ff ff       	call   8036ee <file_block_run>
+  804ff6:	85 c0                	test   %eax,%eax
+  804ff8:	0f 84 77 ff ff ff    	je     804f75 <file_read+0x72>
+			n = MIN(n, (offset + count - 1) / BLKSIZE - pos / BLKSIZE + 1);
+  804ffe:	8b 5d cc             	mov    -0x34(%ebp),%ebx
+  805001:	29 fb                	sub    %edi,%ebx
+  805003:	39 c3                	cmp    %eax,%ebx
+  805005:	0f 47 d8             	cmova  %eax,%ebx
+			bc_read(diskbno, n);
+  805008:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  80500b:	83 ec 08             	sub    $0x8,%esp
+  80500e:	53                   	push   %ebx
+  80500f:	57                   	push   %edi
+  805010:	e8 e1 d0 ff ff       	call   8020f6 <bc_read>
+			blk = diskaddr(diskbno);
+  805015:	89 3c 24             	mov    %edi,(%esp)
+  805018:	e8 77 c8 ff ff       	call   801894 <diskaddr>
+  80501d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  805020:	83 c4 10             	add    $0x10,%esp
+  805023:	e9 6d ff ff ff       	jmp    804f95 <file_read+0x92>
+	return count;
+  805028:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  80502b:	89 d8                	mov    %ebx,%eax
+}
+  80502d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  805030:	5b                   	pop    %ebx
+  805031:	5e                   	pop    %esi
+  805032:	5f                   	pop    %edi
+  805033:	5d                   	pop    %ebp
+  805034:	c3                   	ret
+
+00805035 <file_read_map>:
+{
+  805035:	55                   	push   %ebp
+  805036:	89 e5                	mov    %esp,%ebp
+  805038:	57                   	push   %edi
+  805039:	56                   	push   %esi
+  80503a:	53                   	push   %ebx
+  80503b:	83 ec 1c             	sub    $0x1c,%esp
+  80503e:	8b 75 08             	mov    0x8(%ebp),%esi
+  805041:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	if (offset < 0 || offset % BLKSIZE != 0)
+  805044:	85 db                	test   %ebx,%ebx
+  805046:	0f 88 33 01 00 00    	js     80517f <file_read_map+0x14a>
+  80504c:	89 d8                	mov    %ebx,%eax
+  80504e:	25 ff 0f 00 00       	and    $0xfff,%eax
+  805053:	0f 85 30 01 00 00    	jne    805189 <file_read_map+0x154>
+	if (offset >= f->f_size)
+  805059:	39 9e 80 00 00 00    	cmp    %ebx,0x80(%esi)
+  80505f:	7e 1f                	jle    805080 <file_read_map+0x4b>
+	if (f->f_flags & FILE_INLINE) {
+  805061:	f6 86 88 00 00 00 04 	testb  $0x4,0x88(%esi)
+  805068:	74 41                	je     8050ab <file_read_map+0x76>
+		if ((r = sys_page_alloc(0, dstva, PTE_P | PTE_U | PTE_W)) < 0)
+  80506a:	83 ec 04             	sub    $0x4,%esp
+  80506d:	6a 07                	push   $0x7
+  80506f:	ff 75 10             	push   0x10(%ebp)
+  805072:	6a 00                	push   $0x0
+  805074:	e8 4f 25 00 00       	call   8075c8 <sys_page_alloc>
+  805079:	83 c4 10             	add    $0x10,%esp
+  80507c:	85 c0                	test   %eax,%eax
+  80507e:	79 08                	jns    805088 <file_read_map+0x53>
+}
+  805080:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  805083:	5b                   	pop    %ebx
+  805084:	5e                   	pop    %esi
+  805085:	5f                   	pop    %edi
+  805086:	5d                   	pop    %ebp
+  805087:	c3                   	ret
+		memmove(dstva, f->f_data, f->f_size);
+  805088:	83 ec 04             	sub    $0x4,%esp
+  80508b:	ff b6 80 00 00 00    	push   0x80(%esi)
+  805091:	8d 86 8c 00 00 00    	lea    0x8c(%esi),%eax
+  805097:	50                   	push   %eax
+  805098:	ff 75 10             	push   0x10(%ebp)
+  80509b:	e8 7f 22 00 00       	call   80731f <memmove>
+		return f->f_size;
+  8050a0:	8b 86 80 00 00 00    	mov    0x80(%esi),%eax
+  8050a6:	83 c4 10             	add    $0x10,%esp
+  8050a9:	eb d5                	jmp    805080 <file_read_map+0x4b>
+	if (file_block_run(f, offset / BLKSIZE, &diskbno) > 0) {
+  8050ab:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  8050b1:	85 db                	test   %ebx,%ebx
+  8050b3:	0f 49 fb             	cmovns %ebx,%edi
+  8050b6:	c1 ff 0c             	sar    $0xc,%edi
+  8050b9:	8d 4d e4             	lea    -0x1c(%ebp),%ecx
+  8050bc:	89 fa                	mov    %edi,%edx
+  8050be:	89 f0                	mov    %esi,%eax
+  8050c0:	e8 29 e6 ff ff       	call   8036ee <file_block_run>
+  8050c5:	85 c0                	test   %eax,%eax
+  8050c7:	74 6c                	je     805135 <file_read_map+0x100>
+		bc_read(diskbno, 1);
+  8050c9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8050cc:	83 ec 08             	sub    $0x8,%esp
+  8050cf:	6a 01                	push   $0x1
+  8050d1:	57                   	push   %edi
+  8050d2:	e8 1f d0 ff ff       	call   8020f6 <bc_read>
+		blk = diskaddr(diskbno);
+  8050d7:	89 3c 24             	mov    %edi,(%esp)
+  8050da:	e8 b5 c7 ff ff       	call   801894 <diskaddr>
+  8050df:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8050e2:	83 c4 10             	add    $0x10,%esp
+	if (bc_share(((uint32_t) blk - DISKMAP) / BLKSIZE)) {
+  8050e5:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8050e8:	83 ec 0c             	sub    $0xc,%esp
+  8050eb:	8d 87 00 00 00 f0    	lea    -0x10000000(%edi),%eax
+  8050f1:	c1 e8 0c             	shr    $0xc,%eax
+  8050f4:	50                   	push   %eax
+  8050f5:	e8 b3 cb ff ff       	call   801cad <bc_share>
+  8050fa:	83 c4 10             	add    $0x10,%esp
+  8050fd:	84 c0                	test   %al,%al
+  8050ff:	74 4e                	je     80514f <file_read_map+0x11a>
+		if ((r = sys_page_map(0, blk, 0, dstva, PTE_P | PTE_U)) < 0)
+  805101:	83 ec 0c             	sub    $0xc,%esp
+  805104:	6a 05                	push   $0x5
+  805106:	ff 75 10             	push   0x10(%ebp)
+  805109:	6a 00                	push   $0x0
+  80510b:	57                   	push   %edi
+  80510c:	6a 00                	push   $0x0
+  80510e:	e8 f8 24 00 00       	call   80760b <sys_page_map>
+  805113:	83 c4 20             	add    $0x20,%esp
+  805116:	85 c0                	test   %eax,%eax
+  805118:	0f 88 62 ff ff ff    	js     805080 <file_read_map+0x4b>
+	return MIN(BLKSIZE, f->f_size - offset);
+  80511e:	8b 86 80 00 00 00    	mov    0x80(%esi),%eax
+  805124:	29 d8                	sub    %ebx,%eax
+  805126:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80512b:	39 d0                	cmp    %edx,%eax
+  80512d:	0f 4f c2             	cmovg  %edx,%eax
+  805130:	e9 4b ff ff ff       	jmp    805080 <file_read_map+0x4b>
+	} else if ((r = file_get_block(f, offset / BLKSIZE, &blk)) < 0)
+  805135:	83 ec 04             	sub    $0x4,%esp
+  805138:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80513b:	50                   	push   %eax
+  80513c:	57                   	push   %edi
+  80513d:	56                   	push   %esi
+  80513e:	e8 73 ec ff ff       	call   803db6 <file_get_block>
+  805143:	83 c4 10             	add    $0x10,%esp
+  805146:	85 c0                	test   %eax,%eax
+  805148:	79 9b                	jns    8050e5 <file_read_map+0xb0>
+  80514a:	e9 31 ff ff ff       	jmp    805080 <file_read_map+0x4b>
+		if ((r = sys_page_alloc(0, dstva, PTE_P | PTE_U | PTE_W)) < 0)
+  80514f:	83 ec 04             	sub    $0x4,%esp
+  805152:	6a 07                	push   $0x7
+  805154:	ff 75 10             	push   0x10(%ebp)
+  805157:	6a 00                	push   $0x0
+  805159:	e8 6a 24 00 00       	call   8075c8 <sys_page_alloc>
+  80515e:	83 c4 10             	add    $0x10,%esp
+  805161:	85 c0                	test   %eax,%eax
+  805163:	0f 88 17 ff ff ff    	js     805080 <file_read_map+0x4b>
+		memmove(dstva, blk, BLKSIZE);
+  805169:	83 ec 04             	sub    $0x4,%esp
+  80516c:	68 00 10 00 00       	push   $0x1000
+  805171:	57                   	push   %edi
+  805172:	ff 75 10             	push   0x10(%ebp)
+  805175:	e8 a5 21 00 00       	call   80731f <memmove>
+  80517a:	83 c4 10             	add    $0x10,%esp
+  80517d:	eb 9f                	jmp    80511e <file_read_map+0xe9>
+		return -E_INVAL;
+  80517f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  805184:	e9 f7 fe ff ff       	jmp    805080 <file_read_map+0x4b>
+  805189:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80518e:	e9 ed fe ff ff       	jmp    805080 <file_read_map+0x4b>
+
+00805193 <file_readahead>:
+{
+  805193:	55                   	push   %ebp
+  805194:	89 e5                	mov    %esp,%ebp
+  805196:	57                   	push   %edi
+  805197:	56                   	push   %esi
+  805198:	53                   	push   %ebx
+  805199:	83 ec 1c             	sub    $0x1c,%esp
+  80519c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80519f:	8b 45 10             	mov    0x10(%ebp),%eax
+	if (offset == ra->ra_next)
+  8051a2:	39 06                	cmp    %eax,(%esi)
+  8051a4:	74 14                	je     8051ba <file_readahead+0x27>
+  8051a6:	c7 46 04 00 00 00 00 	movl   $0x0,0x4(%esi)
+	ra->ra_next = offset + count;
+  8051ad:	03 45 14             	add    0x14(%ebp),%eax
+  8051b0:	89 06                	mov    %eax,(%esi)
+}
+  8051b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8051b5:	5b                   	pop    %ebx
+  8051b6:	5e                   	pop    %esi
+  8051b7:	5f                   	pop    %edi
+  8051b8:	5d                   	pop    %ebp
+  8051b9:	c3                   	ret
+		ra->ra_window = MIN(MAX(ra->ra_window * 2, RA_MINWINDOW),
+  8051ba:	d1 66 04             	shll   0x4(%esi)
+  8051bd:	8b 56 04             	mov    0x4(%esi),%edx
+  8051c0:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8051c5:	39 ca                	cmp    %ecx,%edx
+  8051c7:	0f 42 d1             	cmovb  %ecx,%edx
+  8051ca:	b9 20 00 00 00       	mov    $0x20,%ecx
+  8051cf:	39 ca                	cmp    %ecx,%edx
+  8051d1:	0f 47 d1             	cmova  %ecx,%edx
+  8051d4:	89 56 04             	mov    %edx,0x4(%esi)
+	ra->ra_next = offset + count;
+  8051d7:	89 c2                	mov    %eax,%edx
+  8051d9:	03 55 14             	add    0x14(%ebp),%edx
+  8051dc:	89 16                	mov    %edx,(%esi)
+	if (ra->ra_window == 0 || offset >= f->f_size)
+  8051de:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8051e1:	39 87 80 00 00 00    	cmp    %eax,0x80(%edi)
+  8051e7:	7e c9                	jle    8051b2 <file_readahead+0x1f>
+	bno = offset / BLKSIZE;
+  8051e9:	8d 90 ff 0f 00 00    	lea    0xfff(%eax),%edx
+  8051ef:	85 c0                	test   %eax,%eax
+  8051f1:	0f 48 c2             	cmovs  %edx,%eax
+  8051f4:	c1 f8 0c             	sar    $0xc,%eax
+  8051f7:	89 c7                	mov    %eax,%edi
+  8051f9:	89 c3                	mov    %eax,%ebx
+	if (file_block_run(f, bno, &diskbno) > 0 &&
+  8051fb:	8d 4d e4             	lea    -0x1c(%ebp),%ecx
+  8051fe:	89 c2                	mov    %eax,%edx
+  805200:	8b 45 08             	mov    0x8(%ebp),%eax
+  805203:	e8 e6 e4 ff ff       	call   8036ee <file_block_run>
+  805208:	85 c0                	test   %eax,%eax
+  80520a:	75 25                	jne    805231 <file_readahead+0x9e>
+	end = MIN(bno + ra->ra_window, (f->f_size + BLKSIZE - 1) / BLKSIZE);
+  80520c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80520f:	8b 90 80 00 00 00    	mov    0x80(%eax),%edx
+  805215:	8d 82 fe 1f 00 00    	lea    0x1ffe(%edx),%eax
+  80521b:	81 c2 ff 0f 00 00    	add    $0xfff,%edx
+  805221:	0f 49 c2             	cmovns %edx,%eax
+  805224:	c1 f8 0c             	sar    $0xc,%eax
+  805227:	03 7e 04             	add    0x4(%esi),%edi
+  80522a:	39 f8                	cmp    %edi,%eax
+  80522c:	0f 46 f8             	cmovbe %eax,%edi
+	for (; bno < end; bno += n) {
+  80522f:	eb 21                	jmp    805252 <file_readahead+0xbf>
+	    va_is_mapped(diskaddr(diskbno)))
+  805231:	83 ec 0c             	sub    $0xc,%esp
+  805234:	ff 75 e4             	push   -0x1c(%ebp)
+  805237:	e8 58 c6 ff ff       	call   801894 <diskaddr>
+  80523c:	89 04 24             	mov    %eax,(%esp)
+  80523f:	e8 88 c6 ff ff       	call   8018cc <va_is_mapped>
+	if (file_block_run(f, bno, &diskbno) > 0 &&
+  805244:	83 c4 10             	add    $0x10,%esp
+  805247:	84 c0                	test   %al,%al
+  805249:	74 c1                	je     80520c <file_readahead+0x79>
+  80524b:	e9 62 ff ff ff       	jmp    8051b2 <file_readahead+0x1f>
+	for (; bno < end; bno += n) {
+  805250:	01 f3                	add    %esi,%ebx
+  805252:	39 fb                	cmp    %edi,%ebx
+  805254:	0f 83 58 ff ff ff    	jae    8051b2 <file_readahead+0x1f>
+		if ((n = file_block_run(f, bno, &diskbno)) == 0) {
+  80525a:	8d 4d e4             	lea    -0x1c(%ebp),%ecx
+  80525d:	89 da                	mov    %ebx,%edx
+  80525f:	8b 45 08             	mov    0x8(%ebp),%eax
+  805262:	e8 87 e4 ff ff       	call   8036ee <file_block_run>
+			n = 1;
+  805267:	be 01 00 00 00       	mov    $0x1,%esi
+		if ((n = file_block_run(f, bno, &diskbno)) == 0) {
+  80526c:	85 c0                	test   %eax,%eax
+  80526e:	74 e0                	je     805250 <file_readahead+0xbd>
+		n = MIN(n, end - bno);
+  805270:	89 fe                	mov    %edi,%esi
+  805272:	29 de                	sub    %ebx,%esi
+  805274:	39 c6                	cmp    %eax,%esi
+  805276:	0f 47 f0             	cmova  %eax,%esi
+		bc_prefetch(diskbno, n);
+  805279:	83 ec 08             	sub    $0x8,%esp
+  80527c:	56                   	push   %esi
+  80527d:	ff 75 e4             	push   -0x1c(%ebp)
+  805280:	e8 e3 ce ff ff       	call   802168 <bc_prefetch>
+  805285:	83 c4 10             	add    $0x10,%esp
+  805288:	eb c6                	jmp    805250 <file_readahead+0xbd>
+
+0080528a <file_prefetch>:
+{
+  80528a:	55                   	push   %ebp
+  80528b:	89 e5                	mov    %esp,%ebp
+  80528d:	83 ec 18             	sub    $0x18,%esp
+  805290:	8b 45 08             	mov    0x8(%ebp),%eax
+  805293:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+	if (offset < 0 || offset >= f->f_size)
+  805296:	85 c9                	test   %ecx,%ecx
+  805298:	78 08                	js     8052a2 <file_prefetch+0x18>
+  80529a:	39 88 80 00 00 00    	cmp    %ecx,0x80(%eax)
+  8052a0:	7f 02                	jg     8052a4 <file_prefetch+0x1a>
+}
+  8052a2:	c9                   	leave
+  8052a3:	c3                   	ret
+	if (file_block_run(f, offset / BLKSIZE, &diskbno) > 0)
+  8052a4:	8d 91 ff 0f 00 00    	lea    0xfff(%ecx),%edx
+  8052aa:	85 c9                	test   %ecx,%ecx
+  8052ac:	0f 49 d1             	cmovns %ecx,%edx
+  8052af:	c1 fa 0c             	sar    $0xc,%edx
+  8052b2:	8d 4d f4             	lea    -0xc(%ebp),%ecx
+  8052b5:	e8 34 e4 ff ff       	call   8036ee <file_block_run>
+  8052ba:	85 c0                	test   %eax,%eax
+  8052bc:	74 e4                	je     8052a2 <file_prefetch+0x18>
+		bc_prefetch(diskbno, 1);
+  8052be:	83 ec 08             	sub    $0x8,%esp
+  8052c1:	6a 01                	push   $0x1
+  8052c3:	ff 75 f4             	push   -0xc(%ebp)
+  8052c6:	e8 9d ce ff ff       	call   802168 <bc_prefetch>
+  8052cb:	83 c4 10             	add    $0x10,%esp
+  8052ce:	eb d2                	jmp    8052a2 <file_prefetch+0x18>
+
+008052d0 <file_set_size>:
+// Regular files of at most NINLINE bytes keep their data inline: those
+// that shrink to it, and those that grow to it from no blocks (a file
+// with blocks fallocate reserved keeps them).
+int
+file_set_size(struct File *f, off_t newsize)
+{
+  8052d0:	55                   	push   %ebp
+  8052d1:	89 e5                	mov    %esp,%ebp
+  8052d3:	57                   	push   %edi
+  8052d4:	56                   	push   %esi
+  8052d5:	53                   	push   %ebx
+  8052d6:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  8052dc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8052df:	8b 75 0c             	mov    0xc(%ebp),%esi
+	int r;
+
+	if (newsize < 0 || newsize > MAXFILESIZE)
+  8052e2:	81 fe 00 f0 ff 7f    	cmp    $0x7ffff000,%esi
+  8052e8:	0f 87 20 01 00 00    	ja     80540e <file_set_size+0x13e>
+		return -E_INVAL;
+	if (f->f_flags & FILE_INLINE) {
+  8052ee:	8b 83 88 00 00 00    	mov    0x88(%ebx),%eax
+  8052f4:	a8 04                	test   $0x4,%al
+  8052f6:	74 6b                	je     805363 <file_set_size+0x93>
+		if (newsize > NINLINE && (r = file_inline_out(f)) < 0)
+  8052f8:	83 fe 74             	cmp    $0x74,%esi
+  8052fb:	7f 27                	jg     805324 <file_set_size+0x54>
+		    f->f_nextent == 0)) {
+		if ((r = file_inline_in(f, newsize)) < 0)
+			return r;
+	}
+	if (f->f_flags & FILE_INLINE) {
+		journal_dirty(f);
+  8052fd:	83 ec 0c             	sub    $0xc,%esp
+  805300:	53                   	push   %ebx
+  805301:	e8 08 d8 ff ff       	call   802b0e <journal_dirty>
+		if (newsize < f->f_size)
+  805306:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  80530c:	83 c4 10             	add    $0x10,%esp
+  80530f:	39 f0                	cmp    %esi,%eax
+  805311:	0f 8f cc 00 00 00    	jg     8053e3 <file_set_size+0x113>
+			memset(f->f_data + newsize, 0, f->f_size - newsize);
+		f->f_size = newsize;
+  805317:	89 b3 80 00 00 00    	mov    %esi,0x80(%ebx)
+		return 0;
+  80531d:	b8 00 00 00 00       	mov    $0x0,%eax
+  805322:	eb 37                	jmp    80535b <file_set_size+0x8b>
+		if (newsize > NINLINE && (r = file_inline_out(f)) < 0)
+  805324:	89 d8                	mov    %ebx,%eax
+  805326:	e8 c4 eb ff ff       	call   803eef <file_inline_out>
+  80532b:	85 c0                	test   %eax,%eax
+  80532d:	78 2c                	js     80535b <file_set_size+0x8b>
+	if (f->f_flags & FILE_INLINE) {
+  80532f:	f6 83 88 00 00 00 04 	testb  $0x4,0x88(%ebx)
+  805336:	75 c5                	jne    8052fd <file_set_size+0x2d>
+	}
+	// Not growing: also free any blocks file_allocate left past the
+	// end.
+	if (f->f_size >= newsize)
+  805338:	39 b3 80 00 00 00    	cmp    %esi,0x80(%ebx)
+  80533e:	0f 8d bc 00 00 00    	jge    805400 <file_set_size+0x130>
+		file_truncate_blocks(f, newsize);
+	journal_dirty(f);
+  805344:	83 ec 0c             	sub    $0xc,%esp
+  805347:	53                   	push   %ebx
+  805348:	e8 c1 d7 ff ff       	call   802b0e <journal_dirty>
+	f->f_size = newsize;
+  80534d:	89 b3 80 00 00 00    	mov    %esi,0x80(%ebx)
+	return 0;
+  805353:	83 c4 10             	add    $0x10,%esp
+  805356:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80535b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80535e:	5b                   	pop    %ebx
+  80535f:	5e                   	pop    %esi
+  805360:	5f                   	pop    %edi
+  805361:	5d                   	pop    %ebp
+  805362:	c3                   	ret
+	} else if (f->f_type == FTYPE_REG && newsize <= NINLINE &&
+  805363:	83 bb 84 00 00 00 00 	cmpl   $0x0,0x84(%ebx)
+  80536a:	75 cc                	jne    805338 <file_set_size+0x68>
+  80536c:	83 fe 74             	cmp    $0x74,%esi
+  80536f:	7f c7                	jg     805338 <file_set_size+0x68>
+  805371:	39 b3 80 00 00 00    	cmp    %esi,0x80(%ebx)
+  805377:	7d 0d                	jge    805386 <file_set_size+0xb6>
+		   (f->f_size >= newsize || !(f->f_flags & FILE_EXTENTS) ||
+  805379:	a8 01                	test   $0x1,%al
+  80537b:	74 09                	je     805386 <file_set_size+0xb6>
+  80537d:	83 bb bc 00 00 00 00 	cmpl   $0x0,0xbc(%ebx)
+  805384:	75 be                	jne    805344 <file_set_size+0x74>
+	memset(data, 0, sizeof(data));
+  805386:	83 ec 04             	sub    $0x4,%esp
+  805389:	6a 74                	push   $0x74
+  80538b:	6a 00                	push   $0x0
+  80538d:	8d bd 74 ff ff ff    	lea    -0x8c(%ebp),%edi
+  805393:	57                   	push   %edi
+  805394:	e8 51 1f 00 00       	call   8072ea <memset>
+	if ((n = file_read(f, data, newsize, 0)) < 0)
+  805399:	6a 00                	push   $0x0
+  80539b:	56                   	push   %esi
+  80539c:	57                   	push   %edi
+  80539d:	53                   	push   %ebx
+  80539e:	e8 60 fb ff ff       	call   804f03 <file_read>
+  8053a3:	83 c4 20             	add    $0x20,%esp
+  8053a6:	85 c0                	test   %eax,%eax
+  8053a8:	78 b1                	js     80535b <file_set_size+0x8b>
+	file_truncate_blocks(f, 0);
+  8053aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8053af:	89 d8                	mov    %ebx,%eax
+  8053b1:	e8 c9 e3 ff ff       	call   80377f <file_truncate_blocks>
+	journal_dirty(f);
+  8053b6:	83 ec 0c             	sub    $0xc,%esp
+  8053b9:	53                   	push   %ebx
+  8053ba:	e8 4f d7 ff ff       	call   802b0e <journal_dirty>
+	memmove(f->f_data, data, sizeof(data));
+  8053bf:	83 c4 0c             	add    $0xc,%esp
+  8053c2:	6a 74                	push   $0x74
+  8053c4:	57                   	push   %edi
+  8053c5:	8d 83 8c 00 00 00    	lea    0x8c(%ebx),%eax
+  8053cb:	50                   	push   %eax
+  8053cc:	e8 4e 1f 00 00       	call   80731f <memmove>
+	f->f_flags = FILE_INLINE;
+  8053d1:	c7 83 88 00 00 00 04 	movl   $0x4,0x88(%ebx)
+  8053d8:	00 00 00 
+	if (f->f_flags & FILE_INLINE) {
+  8053db:	83 c4 10             	add    $0x10,%esp
+  8053de:	e9 1a ff ff ff       	jmp    8052fd <file_set_size+0x2d>
+			memset(f->f_data + newsize, 0, f->f_size - newsize);
+  8053e3:	83 ec 04             	sub    $0x4,%esp
+  8053e6:	29 f0                	sub    %esi,%eax
+  8053e8:	50                   	push   %eax
+  8053e9:	6a 00                	push   $0x0
+  8053eb:	8d 84 33 8c 00 00 00 	lea    0x8c(%ebx,%esi,1),%eax
+  8053f2:	50                   	push   %eax
+  8053f3:	e8 f2 1e 00 00       	call   8072ea <memset>
+  8053f8:	83 c4 10             	add    $0x10,%esp
+  8053fb:	e9 17 ff ff ff       	jmp    805317 <file_set_size+0x47>
+		file_truncate_blocks(f, newsize);
+  805400:	89 f2                	mov    %esi,%edx
+  805402:	89 d8                	mov    %ebx,%eax
+  805404:	e8 76 e3 ff ff       	call   80377f <file_truncate_blocks>
+  805409:	e9 36 ff ff ff       	jmp    805344 <file_set_size+0x74>
+		return -E_INVAL;
+  80540e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  805413:	e9 43 ff ff ff       	jmp    80535b <file_set_size+0x8b>
+
+00805418 <file_write>:
+{
+  805418:	55                   	push   %ebp
+  805419:	89 e5                	mov    %esp,%ebp
+  80541b:	57                   	push   %edi
+  80541c:	56                   	push   %esi
+  80541d:	53                   	push   %ebx
+  80541e:	83 ec 2c             	sub    $0x2c,%esp
+  805421:	8b 5d 14             	mov    0x14(%ebp),%ebx
+	if (offset + count > f->f_size)
+  805424:	89 de                	mov    %ebx,%esi
+  805426:	89 df                	mov    %ebx,%edi
+  805428:	03 7d 10             	add    0x10(%ebp),%edi
+  80542b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80542e:	39 b8 80 00 00 00    	cmp    %edi,0x80(%eax)
+  805434:	0f 82 88 00 00 00    	jb     8054c2 <file_write+0xaa>
+	if (f->f_flags & FILE_INLINE) {
+  80543a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80543d:	f6 80 88 00 00 00 04 	testb  $0x4,0x88(%eax)
+  805444:	0f 85 8f 00 00 00    	jne    8054d9 <file_write+0xc1>
+  80544a:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  80544d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+	for (pos = offset; pos < offset + count; ) {
+  805450:	89 de                	mov    %ebx,%esi
+  805452:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  805455:	39 c3                	cmp    %eax,%ebx
+  805457:	0f 83 a6 00 00 00    	jae    805503 <file_write+0xeb>
+		if ((r = file_get_block(f, pos / BLKSIZE, &blk)) < 0)
+  80545d:	83 ec 04             	sub    $0x4,%esp
+  805460:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  805463:	50                   	push   %eax
+  805464:	8d 83 ff 0f 00 00    	lea    0xfff(%ebx),%eax
+  80546a:	85 db                	test   %ebx,%ebx
+  80546c:	0f 49 c3             	cmovns %ebx,%eax
+  80546f:	c1 f8 0c             	sar    $0xc,%eax
+  805472:	50                   	push   %eax
+  805473:	ff 75 08             	push   0x8(%ebp)
+  805476:	e8 3b e9 ff ff       	call   803db6 <file_get_block>
+  80547b:	83 c4 10             	add    $0x10,%esp
+  80547e:	85 c0                	test   %eax,%eax
+  805480:	0f 88 80 00 00 00    	js     805506 <file_write+0xee>
+		bn = MIN(BLKSIZE - pos % BLKSIZE, offset + count - pos);
+  805486:	89 da                	mov    %ebx,%edx
+  805488:	c1 fa 1f             	sar    $0x1f,%edx
+  80548b:	c1 ea 14             	shr    $0x14,%edx
+  80548e:	8d 04 13             	lea    (%ebx,%edx,1),%eax
+  805491:	25 ff 0f 00 00       	and    $0xfff,%eax
+  805496:	29 d0                	sub    %edx,%eax
+  805498:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80549d:	29 c1                	sub    %eax,%ecx
+  80549f:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+  8054a2:	29 f2                	sub    %esi,%edx
+  8054a4:	39 d1                	cmp    %edx,%ecx
+  8054a6:	89 d6                	mov    %edx,%esi
+  8054a8:	0f 46 f1             	cmovbe %ecx,%esi
+		memmove(blk + pos % BLKSIZE, buf, bn);
+  8054ab:	83 ec 04             	sub    $0x4,%esp
+  8054ae:	56                   	push   %esi
+  8054af:	57                   	push   %edi
+  8054b0:	03 45 e4             	add    -0x1c(%ebp),%eax
+  8054b3:	50                   	push   %eax
+  8054b4:	e8 66 1e 00 00       	call   80731f <memmove>
+		pos += bn;
+  8054b9:	01 f3                	add    %esi,%ebx
+		buf += bn;
+  8054bb:	01 f7                	add    %esi,%edi
+  8054bd:	83 c4 10             	add    $0x10,%esp
+  8054c0:	eb 8e                	jmp    805450 <file_write+0x38>
+		if ((r = file_set_size(f, offset + count)) < 0)
+  8054c2:	83 ec 08             	sub    $0x8,%esp
+  8054c5:	57                   	push   %edi
+  8054c6:	50                   	push   %eax
+  8054c7:	e8 04 fe ff ff       	call   8052d0 <file_set_size>
+  8054cc:	83 c4 10             	add    $0x10,%esp
+  8054cf:	85 c0                	test   %eax,%eax
+  8054d1:	0f 89 63 ff ff ff    	jns    80543a <file_write+0x22>
+  8054d7:	eb 2d                	jmp    805506 <file_write+0xee>
+		journal_dirty(f);
+  8054d9:	83 ec 0c             	sub    $0xc,%esp
+  8054dc:	50                   	push   %eax
+  8054dd:	e8 2c d6 ff ff       	call   802b0e <journal_dirty>
+		memmove(f->f_data + offset, buf, count);
+  8054e2:	83 c4 0c             	add    $0xc,%esp
+  8054e5:	ff 75 10             	push   0x10(%ebp)
+  8054e8:	ff 75 0c             	push   0xc(%ebp)
+  8054eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8054ee:	8d 84 30 8c 00 00 00 	lea    0x8c(%eax,%esi,1),%eax
+  8054f5:	50                   	push   %eax
+  8054f6:	e8 24 1e 00 00       	call   80731f <memmove>
+		return count;
+  8054fb:	8b 45 10             	mov    0x10(%ebp),%eax
+  8054fe:	83 c4 10             	add    $0x10,%esp
+  805501:	eb 03                	jmp    805506 <file_write+0xee>
+	return count;
+  805503:	8b 45 10             	mov    0x10(%ebp),%eax
+}
+  805506:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  805509:	5b                   	pop    %ebx
+  80550a:	5e                   	pop    %esi
+  80550b:	5f                   	pop    %edi
+  80550c:	5d                   	pop    %ebp
+  80550d:	c3                   	ret
+
+0080550e <file_flush>:
+// at a time, and write out the ones that are dirty.  Then commit the
+// journal, which holds the file's metadata.  Clients flush on close,
+// so f's window for appends goes too.
+void
+file_flush(struct File *f)
+{
+  80550e:	55                   	push   %ebp
+  80550f:	89 e5                	mov    %esp,%ebp
+  805511:	57                   	push   %edi
+  805512:	56                   	push   %esi
+  805513:	53                   	push   %ebx
+  805514:	83 ec 1c             	sub    $0x1c,%esp
+	uint32_t i, n, diskbno, nblocks;
+
+	pa_drop(f);
+  805517:	8b 45 08             	mov    0x8(%ebp),%eax
+  80551a:	e8 43 d9 ff ff       	call   802e62 <pa_drop>
+	nblocks = (f->f_size + BLKSIZE - 1) / BLKSIZE;
+  80551f:	8b 45 08             	mov    0x8(%ebp),%eax
+  805522:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  805528:	8d b8 fe 1f 00 00    	lea    0x1ffe(%eax),%edi
+  80552e:	05 ff 0f 00 00       	add    $0xfff,%eax
+  805533:	0f 49 f8             	cmovns %eax,%edi
+  805536:	c1 ff 0c             	sar    $0xc,%edi
+	for (i = 0; i < nblocks; i += n) {
+  805539:	be 00 00 00 00       	mov    $0x0,%esi
+  80553e:	eb 07                	jmp    805547 <file_flush+0x39>
+		if ((n = file_block_run(f, i, &diskbno)) == 0) {
+			n = 1;
+  805540:	bb 01 00 00 00       	mov    $0x1,%ebx
+	for (i = 0; i < nblocks; i += n) {
+  805545:	01 de                	add    %ebx,%esi
+  805547:	39 fe                	cmp    %edi,%esi
+  805549:	73 2d                	jae    805578 <file_flush+0x6a>
+		if ((n = file_block_run(f, i, &diskbno)) == 0) {
+  80554b:	8d 4d e4             	lea    -0x1c(%ebp),%ecx
+  80554e:	89 f2                	mov    %esi,%edx
+  805550:	8b 45 08             	mov    0x8(%ebp),%eax
+  805553:	e8 96 e1 ff ff       	call   8036ee <file_block_run>
+  805558:	89 c3                	mov    %eax,%ebx
+  80555a:	85 c0                	test   %eax,%eax
+  80555c:	74 e2                	je     805540 <file_flush+0x32>
+			continue;
+		}
+		bc_flush(diskbno, MIN(n, nblocks - i));
+  80555e:	83 ec 08             	sub    $0x8,%esp
+  805561:	89 f8                	mov    %edi,%eax
+  805563:	29 f0                	sub    %esi,%eax
+  805565:	39 d8                	cmp    %ebx,%eax
+  805567:	0f 47 c3             	cmova  %ebx,%eax
+  80556a:	50                   	push   %eax
+  80556b:	ff 75 e4             	push   -0x1c(%ebp)
+  80556e:	e8 d2 c5 ff ff       	call   801b45 <bc_flush>
+  805573:	83 c4 10             	add    $0x10,%esp
+  805576:	eb cd                	jmp    805545 <file_flush+0x37>
+	}
+	journal_commit();
+  805578:	e8 1c d3 ff ff       	call   802899 <journal_commit>
+}
+  80557d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  805580:	5b                   	pop    %ebx
+  805581:	5e                   	pop    %esi
+  805582:	5f                   	pop    %edi
+  805583:	5d                   	pop    %ebp
+  805584:	c3                   	ret
+
+00805585 <fs_sync>:
+// Sync the entire file system.  A big hammer, but it only touches
+// the dirty blocks.  Returns once they are on disk, in their homes
+// rather than just in the journal.
+void
+fs_sync(void)
+{
+  805585:	55                   	push   %ebp
+  805586:	89 e5                	mov    %esp,%ebp
+  805588:	83 ec 08             	sub    $0x8,%esp
+	int r;
+
+	journal_commit();
+  80558b:	e8 09 d3 ff ff       	call   802899 <journal_commit>
+	journal_checkpoint();
+  805590:	e8 67 d2 ff ff       	call   8027fc <journal_checkpoint>
+	bc_writeback();
+  805595:	e8 53 c7 ff ff       	call   801ced <bc_writeback>
+	if ((r = bio_sync()) < 0)
+  80559a:	e8 2a c0 ff ff       	call   8015c9 <bio_sync>
+  80559f:	85 c0                	test   %eax,%eax
+  8055a1:	78 02                	js     8055a5 <fs_sync+0x20>
+		panic("fs_sync: %e", r);
+}
+  8055a3:	c9                   	leave
+  8055a4:	c3                   	ret
+		panic("fs_sync: %e", r);
+  8055a5:	50                   	push   %eax
+  8055a6:	68 fb 9e 80 00       	push   $0x809efb
+  8055ab:	68 67 06 00 00       	push   $0x667
+  8055b0:	68 fc 9d 80 00       	push   $0x809dfc
+  8055b5:	e8 16 15 00 00       	call   806ad0 <_panic>
+
+008055ba <openfile_release>:
+
+// Put open file 'o', which no client maps, on the free list.
+static void
+openfile_release(struct OpenFile *o)
+{
+	openfile_nclient[ENVX(o->o_envid)]--;
+  8055ba:	8b 50 18             	mov    0x18(%eax),%edx
+  8055bd:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  8055c3:	66 83 ac 12 20 30 84 	subw   $0x1,0x843020(%edx,%edx,1)
+  8055ca:	00 01 
+	o->o_free = 1;
+  8055cc:	c6 40 1c 01          	movb   $0x1,0x1c(%eax)
+	o->o_next = openfile_free;
+  8055d0:	8b 15 24 38 84 00    	mov    0x843824,%edx
+  8055d6:	89 50 20             	mov    %edx,0x20(%eax)
+	openfile_free = o;
+  8055d9:	a3 24 38 84 00       	mov    %eax,0x843824
+	openfile_nfree++;
+  8055de:	83 05 20 38 84 00 01 	addl   $0x1,0x843820
+}
+  8055e5:	c3                   	ret
+
+008055e6 <serve_unmap>:
+}
+
+// Unmap 'npages' pages from 'va' on.
+static void
+serve_unmap(void *va, size_t npages)
+{
+  8055e6:	55                   	push   %ebp
+  8055e7:	89 e5                	mov    %esp,%ebp
+  8055e9:	57                   	push   %edi
+  8055ea:	56                   	push   %esi
+  8055eb:	53                   	push   %ebx
+  8055ec:	83 ec 0c             	sub    $0xc,%esp
+  8055ef:	89 c7                	mov    %eax,%edi
+  8055f1:	89 d6                	mov    %edx,%esi
+	size_t i;
+	int r;
+
+	for (i = 0; i < npages; i++)
+  8055f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8055f8:	eb 25                	jmp    80561f <serve_unmap+0x39>
+		sysbatch_add(&serv_batch, SYS_page_unmap, 0,
+  8055fa:	83 ec 04             	sub    $0x4,%esp
+  8055fd:	6a 00                	push   $0x0
+  8055ff:	6a 00                	push   $0x0
+  805601:	6a 00                	push   $0x0
+  805603:	89 d8                	mov    %ebx,%eax
+  805605:	c1 e0 0c             	shl    $0xc,%eax
+  805608:	01 f8                	add    %edi,%eax
+  80560a:	50                   	push   %eax
+  80560b:	6a 00                	push   $0x0
+  80560d:	6a 06                	push   $0x6
+  80560f:	68 00 29 84 00       	push   $0x842900
+  805614:	e8 02 24 00 00       	call   807a1b <sysbatch_add>
+	for (i = 0; i < npages; i++)
+  805619:	83 c3 01             	add    $0x1,%ebx
+  80561c:	83 c4 20             	add    $0x20,%esp
+  80561f:	39 f3                	cmp    %esi,%ebx
+  805621:	75 d7                	jne    8055fa <serve_unmap+0x14>
+			     (uint32_t) va + i * PGSIZE, 0, 0, 0);
+	if ((r = sysbatch_flush(&serv_batch)) < 0)
+  805623:	83 ec 0c             	sub    $0xc,%esp
+  805626:	68 00 29 84 00       	push   $0x842900
+  80562b:	e8 9b 23 00 00       	call   8079cb <sysbatch_flush>
+  805630:	83 c4 10             	add    $0x10,%esp
+  805633:	85 c0                	test   %eax,%eax
+  805635:	78 08                	js     80563f <serve_unmap+0x59>
+		panic("serve: unmap: %e", r);
+}
+  805637:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80563a:	5b                   	pop    %ebx
+  80563b:	5e                   	pop    %esi
+  80563c:	5f                   	pop    %edi
+  80563d:	5d                   	pop    %ebp
+  80563e:	c3                   	ret
+		panic("serve: unmap: %e", r);
+  80563f:	50                   	push   %eax
+  805640:	68 2d 9f 80 00       	push   $0x809f2d
+  805645:	68 77 01 00 00       	push   $0x177
+  80564a:	68 3e 9f 80 00       	push   $0x809f3e
+  80564f:	e8 7c 14 00 00       	call   806ad0 <_panic>
+
+00805654 <serve_sync>:
+	return file_allocate(o->o_file, req->req_offset, req->req_len);
+}
+
+int
+serve_sync(envid_t envid, union Fsipc *req)
+{
+  805654:	55                   	push   %ebp
+  805655:	89 e5                	mov    %esp,%ebp
+  805657:	83 ec 08             	sub    $0x8,%esp
+	fs_sync();
+  80565a:	e8 26 ff ff ff       	call   805585 <fs_sync>
+	return 0;
+}
+  80565f:	b8 00 00 00 00       	mov    $0x0,%eax
+  805664:	c9                   	leave
+  805665:	c3                   	ret
+
+00805666 <serve_stats>:
+// the disk scheduler if req->req_bio_sched is, and turn the path
+// lookup cache on or off if req->req_dcache is.  Then report the
+// caches' and the disk queue's statistics.
+int
+serve_stats(envid_t envid, union Fsipc *ipc)
+{
+  805666:	55                   	push   %ebp
+  805667:	89 e5                	mov    %esp,%ebp
+  805669:	53                   	push   %ebx
+  80566a:	83 ec 04             	sub    $0x4,%esp
+  80566d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	if (debug)
+		cprintf("serve_stats %08x %d %d %d\n", envid,
+			req->req_bc_capacity, req->req_bio_sched,
+			req->req_dcache);
+
+	if (req->req_bc_capacity &&
+  805670:	8b 03                	mov    (%ebx),%eax
+  805672:	85 c0                	test   %eax,%eax
+  805674:	0f 85 89 00 00 00    	jne    805703 <serve_stats+0x9d>
+	    (r = bc_set_capacity(req->req_bc_capacity)) < 0)
+		return r;
+	if (req->req_bio_sched && (r = bio_set_sched(req->req_bio_sched)) < 0)
+  80567a:	8b 43 04             	mov    0x4(%ebx),%eax
+  80567d:	85 c0                	test   %eax,%eax
+  80567f:	0f 85 94 00 00 00    	jne    805719 <serve_stats+0xb3>
+		return r;
+	if (req->req_dcache && (r = dcache_set(req->req_dcache)) < 0)
+  805685:	8b 43 08             	mov    0x8(%ebx),%eax
+  805688:	85 c0                	test   %eax,%eax
+  80568a:	74 10                	je     80569c <serve_stats+0x36>
+  80568c:	83 ec 0c             	sub    $0xc,%esp
+  80568f:	50                   	push   %eax
+  805690:	e8 aa f1 ff ff       	call   80483f <dcache_set>
+  805695:	83 c4 10             	add    $0x10,%esp
+  805698:	85 c0                	test   %eax,%eax
+  80569a:	78 62                	js     8056fe <serve_stats+0x98>
+		return r;
+	bc_stats(&ipc->statsRet);
+  80569c:	83 ec 0c             	sub    $0xc,%esp
+  80569f:	53                   	push   %ebx
+  8056a0:	e8 63 c4 ff ff       	call   801b08 <bc_stats>
+	bio_stats(&ipc->statsRet);
+  8056a5:	89 1c 24             	mov    %ebx,(%esp)
+  8056a8:	e8 67 bf ff ff       	call   801614 <bio_stats>
+	dcache_stats(&ipc->statsRet);
+  8056ad:	89 1c 24             	mov    %ebx,(%esp)
+  8056b0:	e8 d5 f1 ff ff       	call   80488a <dcache_stats>
+	ipc->statsRet.ret_fs_requests = serv_nrequests;
+  8056b5:	a1 e0 28 84 00       	mov    0x8428e0,%eax
+  8056ba:	89 43 40             	mov    %eax,0x40(%ebx)
+	ipc->statsRet.ret_fs_nfree = super->s_nfree;
+  8056bd:	a1 88 3f 84 00       	mov    0x843f88,%eax
+  8056c2:	8b 80 08 01 00 00    	mov    0x108(%eax),%eax
+  8056c8:	89 43 44             	mov    %eax,0x44(%ebx)
+	ret->ret_of_free = openfile_nfree;
+  8056cb:	a1 20 38 84 00       	mov    0x843820,%eax
+  8056d0:	89 43 48             	mov    %eax,0x48(%ebx)
+	ret->ret_of_mine = openfile_nclient[ENVX(envid)];
+  8056d3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8056d6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8056db:	0f b7 84 00 20 30 84 	movzwl 0x843020(%eax,%eax,1),%eax
+  8056e2:	00 
+  8056e3:	89 43 4c             	mov    %eax,0x4c(%ebx)
+	ret->ret_of_sweeps = openfile_nsweeps;
+  8056e6:	a1 08 30 84 00       	mov    0x843008,%eax
+  8056eb:	89 43 50             	mov    %eax,0x50(%ebx)
+	ret->ret_of_refused = openfile_nrefused;
+  8056ee:	a1 04 30 84 00       	mov    0x843004,%eax
+  8056f3:	89 43 54             	mov    %eax,0x54(%ebx)
+}
+  8056f6:	83 c4 10             	add    $0x10,%esp
+	openfile_stats(envid, &ipc->statsRet);
+	return 0;
+  8056f9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8056fe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  805701:	c9                   	leave
+  805702:	c3                   	ret
+	    (r = bc_set_capacity(req->req_bc_capacity)) < 0)
+  805703:	83 ec 0c             	sub    $0xc,%esp
+  805706:	50                   	push   %eax
+  805707:	e8 1c c9 ff ff       	call   802028 <bc_set_capacity>
+	if (req->req_bc_capacity &&
+  80570c:	83 c4 10             	add    $0x10,%esp
+  80570f:	85 c0                	test   %eax,%eax
+  805711:	0f 89 63 ff ff ff    	jns    80567a <serve_stats+0x14>
+  805717:	eb e5                	jmp    8056fe <serve_stats+0x98>
+	if (req->req_bio_sched && (r = bio_set_sched(req->req_bio_sched)) < 0)
+  805719:	83 ec 0c             	sub    $0xc,%esp
+  80571c:	50                   	push   %eax
+  80571d:	e8 c4 be ff ff       	call   8015e6 <bio_set_sched>
+  805722:	83 c4 10             	add    $0x10,%esp
+  805725:	85 c0                	test   %eax,%eax
+  805727:	0f 89 58 ff ff ff    	jns    805685 <serve_stats+0x1f>
+  80572d:	eb cf                	jmp    8056fe <serve_stats+0x98>
+
+0080572f <serve_init>:
+{
+  80572f:	55                   	push   %ebp
+  805730:	89 e5                	mov    %esp,%ebp
+  805732:	56                   	push   %esi
+  805733:	53                   	push   %ebx
+	for (i = MAXOPEN - 1; i >= 0; i--) {
+  805734:	8b 1d 24 38 84 00    	mov    0x843824,%ebx
+  80573a:	b8 3c 40 81 00       	mov    $0x81403c,%eax
+  80573f:	ba ff 03 00 00       	mov    $0x3ff,%edx
+		opentab[i].o_fileid = i;
+  805744:	89 de                	mov    %ebx,%esi
+  805746:	89 c3                	mov    %eax,%ebx
+  805748:	89 10                	mov    %edx,(%eax)
+		opentab[i].o_fd = (struct Fd*) (va + i * PGSIZE);
+  80574a:	89 d1                	mov    %edx,%ecx
+  80574c:	c1 e1 0c             	shl    $0xc,%ecx
+  80574f:	81 e9 00 00 00 30    	sub    $0x30000000,%ecx
+  805755:	89 48 0c             	mov    %ecx,0xc(%eax)
+		opentab[i].o_free = 1;
+  805758:	c6 40 1c 01          	movb   $0x1,0x1c(%eax)
+		opentab[i].o_next = openfile_free;
+  80575c:	89 70 20             	mov    %esi,0x20(%eax)
+	for (i = MAXOPEN - 1; i >= 0; i--) {
+  80575f:	83 ea 01             	sub    $0x1,%edx
+  805762:	83 e8 24             	sub    $0x24,%eax
+  805765:	83 fa ff             	cmp    $0xffffffff,%edx
+  805768:	75 da                	jne    805744 <serve_init+0x15>
+  80576a:	89 1d 24 38 84 00    	mov    %ebx,0x843824
+	openfile_nfree = MAXOPEN;
+  805770:	c7 05 20 38 84 00 00 	movl   $0x400,0x843820
+  805777:	04 00 00 
+}
+  80577a:	5b                   	pop    %ebx
+  80577b:	5e                   	pop    %esi
+  80577c:	5d                   	pop    %ebp
+  80577d:	c3                   	ret
+
+0080577e <openfile_alloc>:
+{
+  80577e:	55                   	push   %ebp
+  80577f:	89 e5                	mov    %esp,%ebp
+  805781:	57                   	push   %edi
+  805782:	56                   	push   %esi
+  805783:	53                   	push   %ebx
+  805784:	83 ec 0c             	sub    $0xc,%esp
+	if (!openfile_free ||
+  805787:	83 3d 24 38 84 00 00 	cmpl   $0x0,0x843824
+  80578e:	74 18                	je     8057a8 <openfile_alloc+0x2a>
+	    openfile_nclient[ENVX(envid)] >= OPENFILE_PERCLIENT)
+  805790:	8b 75 08             	mov    0x8(%ebp),%esi
+  805793:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+	if (!openfile_free ||
+  805799:	66 83 bc 36 20 30 84 	cmpw   $0x3f,0x843020(%esi,%esi,1)
+  8057a0:	00 3f 
+  8057a2:	0f 86 fb 00 00 00    	jbe    8058a3 <openfile_alloc+0x125>
+	openfile_nsweeps++;
+  8057a8:	83 05 08 30 84 00 01 	addl   $0x1,0x843008
+	for (i = 0; i < MAXOPEN; i++)
+  8057af:	bb 60 b0 80 00       	mov    $0x80b060,%ebx
+  8057b4:	bf 60 40 81 00       	mov    $0x814060,%edi
+  8057b9:	eb 03                	jmp    8057be <openfile_alloc+0x40>
+  8057bb:	83 c3 24             	add    $0x24,%ebx
+  8057be:	39 fb                	cmp    %edi,%ebx
+  8057c0:	74 22                	je     8057e4 <openfile_alloc+0x66>
+		if (!opentab[i].o_free && pageref(opentab[i].o_fd) <= 1)
+  8057c2:	80 7b 1c 00          	cmpb   $0x0,0x1c(%ebx)
+  8057c6:	75 f3                	jne    8057bb <openfile_alloc+0x3d>
+  8057c8:	83 ec 0c             	sub    $0xc,%esp
+  8057cb:	ff 73 0c             	push   0xc(%ebx)
+  8057ce:	e8 a5 34 00 00       	call   808c78 <pageref>
+  8057d3:	83 c4 10             	add    $0x10,%esp
+  8057d6:	83 f8 01             	cmp    $0x1,%eax
+  8057d9:	7f e0                	jg     8057bb <openfile_alloc+0x3d>
+			openfile_release(&opentab[i]);
+  8057db:	89 d8                	mov    %ebx,%eax
+  8057dd:	e8 d8 fd ff ff       	call   8055ba <openfile_release>
+  8057e2:	eb d7                	jmp    8057bb <openfile_alloc+0x3d>
+	if (openfile_nclient[ENVX(envid)] >= OPENFILE_PERCLIENT) {
+  8057e4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8057e7:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+  8057ed:	66 83 bc 36 20 30 84 	cmpw   $0x3f,0x843020(%esi,%esi,1)
+  8057f4:	00 3f 
+  8057f6:	0f 87 92 00 00 00    	ja     80588e <openfile_alloc+0x110>
+	if (!(o = openfile_free))
+  8057fc:	8b 1d 24 38 84 00    	mov    0x843824,%ebx
+  805802:	85 db                	test   %ebx,%ebx
+  805804:	0f 84 92 00 00 00    	je     80589c <openfile_alloc+0x11e>
+	if (pageref(o->o_fd) == 0 &&
+  80580a:	83 ec 0c             	sub    $0xc,%esp
+  80580d:	ff 73 0c             	push   0xc(%ebx)
+  805810:	e8 63 34 00 00       	call   808c78 <pageref>
+  805815:	83 c4 10             	add    $0x10,%esp
+  805818:	85 c0                	test   %eax,%eax
+  80581a:	75 16                	jne    805832 <openfile_alloc+0xb4>
+	    (r = sys_page_alloc(0, o->o_fd, PTE_P|PTE_U|PTE_W)) < 0)
+  80581c:	83 ec 04             	sub    $0x4,%esp
+  80581f:	6a 07                	push   $0x7
+  805821:	ff 73 0c             	push   0xc(%ebx)
+  805824:	6a 00                	push   $0x0
+  805826:	e8 9d 1d 00 00       	call   8075c8 <sys_page_alloc>
+	if (pageref(o->o_fd) == 0 &&
+  80582b:	83 c4 10             	add    $0x10,%esp
+  80582e:	85 c0                	test   %eax,%eax
+  805830:	78 54                	js     805886 <openfile_alloc+0x108>
+	openfile_free = o->o_next;
+  805832:	8b 43 20             	mov    0x20(%ebx),%eax
+  805835:	a3 24 38 84 00       	mov    %eax,0x843824
+	openfile_nfree--;
+  80583a:	83 2d 20 38 84 00 01 	subl   $0x1,0x843820
+	openfile_nclient[ENVX(envid)]++;
+  805841:	66 83 84 36 20 30 84 	addw   $0x1,0x843020(%esi,%esi,1)
+  805848:	00 01 
+	o->o_free = 0;
+  80584a:	c6 43 1c 00          	movb   $0x0,0x1c(%ebx)
+	o->o_envid = envid;
+  80584e:	8b 45 08             	mov    0x8(%ebp),%eax
+  805851:	89 43 18             	mov    %eax,0x18(%ebx)
+	o->o_fileid += MAXOPEN;
+  805854:	81 03 00 04 00 00    	addl   $0x400,(%ebx)
+	memset(o->o_fd, 0, PGSIZE);
+  80585a:	83 ec 04             	sub    $0x4,%esp
+  80585d:	68 00 10 00 00       	push   $0x1000
+  805862:	6a 00                	push   $0x0
+  805864:	ff 73 0c             	push   0xc(%ebx)
+  805867:	e8 7e 1a 00 00       	call   8072ea <memset>
+	memset(&o->o_ra, 0, sizeof(o->o_ra));
+  80586c:	83 c4 0c             	add    $0xc,%esp
+  80586f:	6a 08                	push   $0x8
+  805871:	6a 00                	push   $0x0
+  805873:	8d 43 10             	lea    0x10(%ebx),%eax
+  805876:	50                   	push   %eax
+  805877:	e8 6e 1a 00 00       	call   8072ea <memset>
+	*po = o;
+  80587c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80587f:	89 18                	mov    %ebx,(%eax)
+	return o->o_fileid;
+  805881:	8b 03                	mov    (%ebx),%eax
+  805883:	83 c4 10             	add    $0x10,%esp
+}
+  805886:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  805889:	5b                   	pop    %ebx
+  80588a:	5e                   	pop    %esi
+  80588b:	5f                   	pop    %edi
+  80588c:	5d                   	pop    %ebp
+  80588d:	c3                   	ret
+		openfile_nrefused++;
+  80588e:	83 05 04 30 84 00 01 	addl   $0x1,0x843004
+		return -E_MAX_OPEN;
+  805895:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  80589a:	eb ea                	jmp    805886 <openfile_alloc+0x108>
+		return -E_MAX_OPEN;
+  80589c:	b8 f6 ff ff ff       	mov    $0xfffffff6,%eax
+  8058a1:	eb e3                	jmp    805886 <openfile_alloc+0x108>
+	if (!(o = openfile_free))
+  8058a3:	8b 1d 24 38 84 00    	mov    0x843824,%ebx
+  8058a9:	e9 5c ff ff ff       	jmp    80580a <openfile_alloc+0x8c>
+
+008058ae <openfile_open>:
+{
+  8058ae:	55                   	push   %ebp
+  8058af:	89 e5                	mov    %esp,%ebp
+  8058b1:	57                   	push   %edi
+  8058b2:	56                   	push   %esi
+  8058b3:	53                   	push   %ebx
+  8058b4:	83 ec 24             	sub    $0x24,%esp
+  8058b7:	89 d7                	mov    %edx,%edi
+  8058b9:	89 ce                	mov    %ecx,%esi
+	if ((r = openfile_alloc(envid, &o)) < 0) {
+  8058bb:	8d 55 e0             	lea    -0x20(%ebp),%edx
+  8058be:	52                   	push   %edx
+  8058bf:	50                   	push   %eax
+  8058c0:	e8 b9 fe ff ff       	call   80577e <openfile_alloc>
+  8058c5:	89 c3                	mov    %eax,%ebx
+  8058c7:	83 c4 10             	add    $0x10,%esp
+  8058ca:	85 c0                	test   %eax,%eax
+  8058cc:	78 33                	js     805901 <openfile_open+0x53>
+	if (omode & O_CREAT) {
+  8058ce:	f7 c6 00 01 00 00    	test   $0x100,%esi
+  8058d4:	74 35                	je     80590b <openfile_open+0x5d>
+		if ((r = file_create(path, &f)) < 0) {
+  8058d6:	83 ec 08             	sub    $0x8,%esp
+  8058d9:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8058dc:	50                   	push   %eax
+  8058dd:	57                   	push   %edi
+  8058de:	e8 ca ef ff ff       	call   8048ad <file_create>
+  8058e3:	89 c3                	mov    %eax,%ebx
+  8058e5:	83 c4 10             	add    $0x10,%esp
+  8058e8:	85 c0                	test   %eax,%eax
+  8058ea:	79 35                	jns    805921 <openfile_open+0x73>
+			if (!(omode & O_EXCL) && r == -E_FILE_EXISTS)
+  8058ec:	f7 c6 00 04 00 00    	test   $0x400,%esi
+  8058f2:	75 05                	jne    8058f9 <openfile_open+0x4b>
+  8058f4:	83 f8 f3             	cmp    $0xfffffff3,%eax
+  8058f7:	74 12                	je     80590b <openfile_open+0x5d>
+	openfile_release(o);
+  8058f9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8058fc:	e8 b9 fc ff ff       	call   8055ba <openfile_release>
+}
+  805901:	89 d8                	mov    %ebx,%eax
+  805903:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  805906:	5b                   	pop    %ebx
+  805907:	5e                   	pop    %esi
+  805908:	5f                   	pop    %edi
+  805909:	5d                   	pop    %ebp
+  80590a:	c3                   	ret
+		if ((r = file_open(path, &f)) < 0) {
+  80590b:	83 ec 08             	sub    $0x8,%esp
+  80590e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  805911:	50                   	push   %eax
+  805912:	57                   	push   %edi
+  805913:	e8 d1 f5 ff ff       	call   804ee9 <file_open>
+  805918:	89 c3                	mov    %eax,%ebx
+  80591a:	83 c4 10             	add    $0x10,%esp
+  80591d:	85 c0                	test   %eax,%eax
+  80591f:	78 d8                	js     8058f9 <openfile_open+0x4b>
+	if (omode & O_TRUNC) {
+  805921:	f7 c6 00 02 00 00    	test   $0x200,%esi
+  805927:	74 16                	je     80593f <openfile_open+0x91>
+		if ((r = file_set_size(f, 0)) < 0) {
+  805929:	83 ec 08             	sub    $0x8,%esp
+  80592c:	6a 00                	push   $0x0
+  80592e:	ff 75 e4             	push   -0x1c(%ebp)
+  805931:	e8 9a f9 ff ff       	call   8052d0 <file_set_size>
+  805936:	89 c3                	mov    %eax,%ebx
+  805938:	83 c4 10             	add    $0x10,%esp
+  80593b:	85 c0                	test   %eax,%eax
+  80593d:	78 ba                	js     8058f9 <openfile_open+0x4b>
+	if ((r = file_open(path, &f)) < 0) {
+  80593f:	83 ec 08             	sub    $0x8,%esp
+  805942:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  805945:	50                   	push   %eax
+  805946:	57                   	push   %edi
+  805947:	e8 9d f5 ff ff       	call   804ee9 <file_open>
+  80594c:	89 c3                	mov    %eax,%ebx
+  80594e:	83 c4 10             	add    $0x10,%esp
+  805951:	85 c0                	test   %eax,%eax
+  805953:	78 a4                	js     8058f9 <openfile_open+0x4b>
+	o->o_file = f;
+  805955:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  805958:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80595b:	89 50 04             	mov    %edx,0x4(%eax)
+	o->o_fd->fd_file.id = o->o_fileid;
+  80595e:	8b 50 0c             	mov    0xc(%eax),%edx
+  805961:	8b 08                	mov    (%eax),%ecx
+  805963:	89 4a 0c             	mov    %ecx,0xc(%edx)
+	o->o_fd->fd_omode = omode & O_ACCMODE;
+  805966:	8b 50 0c             	mov    0xc(%eax),%edx
+  805969:	89 f1                	mov    %esi,%ecx
+  80596b:	83 e1 03             	and    $0x3,%ecx
+  80596e:	89 4a 08             	mov    %ecx,0x8(%edx)
+	o->o_fd->fd_dev_id = devfile.dev_id;
+  805971:	8b 50 0c             	mov    0xc(%eax),%edx
+  805974:	8b 0d 64 40 81 00    	mov    0x814064,%ecx
+  80597a:	89 0a                	mov    %ecx,(%edx)
+	o->o_mode = omode;
+  80597c:	89 70 08             	mov    %esi,0x8(%eax)
+	*po = o;
+  80597f:	8b 55 08             	mov    0x8(%ebp),%edx
+  805982:	89 02                	mov    %eax,(%edx)
+	return 0;
+  805984:	bb 00 00 00 00       	mov    $0x0,%ebx
+  805989:	e9 73 ff ff ff       	jmp    805901 <openfile_open+0x53>
+
+0080598e <openfile_lookup>:
+{
+  80598e:	55                   	push   %ebp
+  80598f:	89 e5                	mov    %esp,%ebp
+  805991:	57                   	push   %edi
+  805992:	56                   	push   %esi
+  805993:	53                   	push   %ebx
+  805994:	83 ec 18             	sub    $0x18,%esp
+  805997:	8b 75 0c             	mov    0xc(%ebp),%esi
+	o = &opentab[fileid % MAXOPEN];
+  80599a:	89 f3                	mov    %esi,%ebx
+  80599c:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  8059a2:	8d 04 db             	lea    (%ebx,%ebx,8),%eax
+  8059a5:	8d 3c 85 60 b0 80 00 	lea    0x80b060(,%eax,4),%edi
+	if (pageref(o->o_fd) <= 1 || o->o_fileid != fileid)
+  8059ac:	ff 77 0c             	push   0xc(%edi)
+  8059af:	e8 c4 32 00 00       	call   808c78 <pageref>
+  8059b4:	83 c4 10             	add    $0x10,%esp
+  8059b7:	83 f8 01             	cmp    $0x1,%eax
+  8059ba:	7e 1e                	jle    8059da <openfile_lookup+0x4c>
+  8059bc:	8d 04 db             	lea    (%ebx,%ebx,8),%eax
+  8059bf:	39 34 85 60 b0 80 00 	cmp    %esi,0x80b060(,%eax,4)
+  8059c6:	75 19                	jne    8059e1 <openfile_lookup+0x53>
+	*po = o;
+  8059c8:	8b 45 10             	mov    0x10(%ebp),%eax
+  8059cb:	89 38                	mov    %edi,(%eax)
+	return 0;
+  8059cd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8059d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8059d5:	5b                   	pop    %ebx
+  8059d6:	5e                   	pop    %esi
+  8059d7:	5f                   	pop    %edi
+  8059d8:	5d                   	pop    %ebp
+  8059d9:	c3                   	ret
+		return -E_INVAL;
+  8059da:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8059df:	eb f1                	jmp    8059d2 <openfile_lookup+0x44>
+  8059e1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8059e6:	eb ea                	jmp    8059d2 <openfile_lookup+0x44>
+
+008059e8 <serve_set_size>:
+{
+  8059e8:	55                   	push   %ebp
+  8059e9:	89 e5                	mov    %esp,%ebp
+  8059eb:	53                   	push   %ebx
+  8059ec:	83 ec 18             	sub    $0x18,%esp
+  8059ef:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  8059f2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8059f5:	50                   	push   %eax
+  8059f6:	ff 33                	push   (%ebx)
+  8059f8:	ff 75 08             	push   0x8(%ebp)
+  8059fb:	e8 8e ff ff ff       	call   80598e <openfile_lookup>
+  805a00:	83 c4 10             	add    $0x10,%esp
+  805a03:	85 c0                	test   %eax,%eax
+  805a05:	78 14                	js     805a1b <serve_set_size+0x33>
+	return file_set_size(o->o_file, req->req_size);
+  805a07:	83 ec 08             	sub    $0x8,%esp
+  805a0a:	ff 73 04             	push   0x4(%ebx)
+  805a0d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  805a10:	ff 70 04             	push   0x4(%eax)
+  805a13:	e8 b8 f8 ff ff       	call   8052d0 <file_set_size>
+  805a18:	83 c4 10             	add    $0x10,%esp
+}
+  805a1b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  805a1e:	c9                   	leave
+  805a1f:	c3                   	ret
+
+00805a20 <serve_read>:
+{
+  805a20:	55                   	push   %ebp
+  805a21:	89 e5                	mov    %esp,%ebp
+  805a23:	56                   	push   %esi
+  805a24:	53                   	push   %ebx
+  805a25:	83 ec 14             	sub    $0x14,%esp
+  805a28:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    if ( (r = openfile_lookup(envid, req->req_fileid, &openfile)) < 0)
+  805a2b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  805a2e:	50                   	push   %eax
+  805a2f:	ff 33                	push   (%ebx)
+  805a31:	ff 75 08             	push   0x8(%ebp)
+  805a34:	e8 55 ff ff ff       	call   80598e <openfile_lookup>
+  805a39:	83 c4 10             	add    $0x10,%esp
+  805a3c:	85 c0                	test   %eax,%eax
+  805a3e:	78 4d                	js     805a8d <serve_read+0x6d>
+                   openfile->o_fd->fd_offset, MIN(req->req_n, PGSIZE));
+  805a40:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  805a43:	8b 43 04             	mov    0x4(%ebx),%eax
+  805a46:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805a4b:	39 d0                	cmp    %edx,%eax
+  805a4d:	0f 47 c2             	cmova  %edx,%eax
+    file_readahead(openfile->o_file, &openfile->o_ra,
+  805a50:	50                   	push   %eax
+  805a51:	8b 46 0c             	mov    0xc(%esi),%eax
+  805a54:	ff 70 04             	push   0x4(%eax)
+  805a57:	8d 46 10             	lea    0x10(%esi),%eax
+  805a5a:	50                   	push   %eax
+  805a5b:	ff 76 04             	push   0x4(%esi)
+  805a5e:	e8 30 f7 ff ff       	call   805193 <file_readahead>
+    if ( (count = file_read(openfile->o_file,
+  805a63:	8b 46 0c             	mov    0xc(%esi),%eax
+  805a66:	ff 70 04             	push   0x4(%eax)
+                    MIN(ipc->read.req_n, PGSIZE),
+  805a69:	8b 43 04             	mov    0x4(%ebx),%eax
+  805a6c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805a71:	39 d0                	cmp    %edx,%eax
+  805a73:	0f 47 c2             	cmova  %edx,%eax
+    if ( (count = file_read(openfile->o_file,
+  805a76:	50                   	push   %eax
+  805a77:	53                   	push   %ebx
+  805a78:	ff 76 04             	push   0x4(%esi)
+  805a7b:	e8 83 f4 ff ff       	call   804f03 <file_read>
+  805a80:	83 c4 20             	add    $0x20,%esp
+  805a83:	85 c0                	test   %eax,%eax
+  805a85:	78 06                	js     805a8d <serve_read+0x6d>
+    openfile->o_fd->fd_offset += count;
+  805a87:	8b 56 0c             	mov    0xc(%esi),%edx
+  805a8a:	01 42 04             	add    %eax,0x4(%edx)
+}
+  805a8d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  805a90:	5b                   	pop    %ebx
+  805a91:	5e                   	pop    %esi
+  805a92:	5d                   	pop    %ebp
+  805a93:	c3                   	ret
+
+00805a94 <serve_write>:
+{
+  805a94:	55                   	push   %ebp
+  805a95:	89 e5                	mov    %esp,%ebp
+  805a97:	56                   	push   %esi
+  805a98:	53                   	push   %ebx
+  805a99:	83 ec 14             	sub    $0x14,%esp
+  805a9c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+    if ( (r = openfile_lookup(envid, req->req_fileid, &openfile)) < 0)
+  805a9f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  805aa2:	50                   	push   %eax
+  805aa3:	ff 33                	push   (%ebx)
+  805aa5:	ff 75 08             	push   0x8(%ebp)
+  805aa8:	e8 e1 fe ff ff       	call   80598e <openfile_lookup>
+  805aad:	83 c4 10             	add    $0x10,%esp
+  805ab0:	85 c0                	test   %eax,%eax
+  805ab2:	78 25                	js     805ad9 <serve_write+0x45>
+                    openfile->o_fd->fd_offset)) < 0)
+  805ab4:	8b 75 f4             	mov    -0xc(%ebp),%esi
+    if ( (count = file_write(openfile->o_file,
+  805ab7:	8b 46 0c             	mov    0xc(%esi),%eax
+  805aba:	ff 70 04             	push   0x4(%eax)
+  805abd:	ff 73 04             	push   0x4(%ebx)
+                    req->req_buf,
+  805ac0:	83 c3 08             	add    $0x8,%ebx
+    if ( (count = file_write(openfile->o_file,
+  805ac3:	53                   	push   %ebx
+  805ac4:	ff 76 04             	push   0x4(%esi)
+  805ac7:	e8 4c f9 ff ff       	call   805418 <file_write>
+  805acc:	83 c4 10             	add    $0x10,%esp
+  805acf:	85 c0                	test   %eax,%eax
+  805ad1:	78 06                	js     805ad9 <serve_write+0x45>
+    openfile->o_fd->fd_offset += count;
+  805ad3:	8b 56 0c             	mov    0xc(%esi),%edx
+  805ad6:	01 42 04             	add    %eax,0x4(%edx)
+}
+  805ad9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  805adc:	5b                   	pop    %ebx
+  805add:	5e                   	pop    %esi
+  805ade:	5d                   	pop    %ebp
+  805adf:	c3                   	ret
+
+00805ae0 <serve_stat>:
+{
+  805ae0:	55                   	push   %ebp
+  805ae1:	89 e5                	mov    %esp,%ebp
+  805ae3:	56                   	push   %esi
+  805ae4:	53                   	push   %ebx
+  805ae5:	83 ec 14             	sub    $0x14,%esp
+  805ae8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  805aeb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  805aee:	50                   	push   %eax
+  805aef:	ff 33                	push   (%ebx)
+  805af1:	ff 75 08             	push   0x8(%ebp)
+  805af4:	e8 95 fe ff ff       	call   80598e <openfile_lookup>
+  805af9:	83 c4 10             	add    $0x10,%esp
+  805afc:	85 c0                	test   %eax,%eax
+  805afe:	78 3c                	js     805b3c <serve_stat+0x5c>
+	strcpy(ret->ret_name, o->o_file->f_name);
+  805b00:	8b 75 f4             	mov    -0xc(%ebp),%esi
+  805b03:	83 ec 08             	sub    $0x8,%esp
+  805b06:	ff 76 04             	push   0x4(%esi)
+  805b09:	53                   	push   %ebx
+  805b0a:	e8 8a 16 00 00       	call   807199 <strcpy>
+	ret->ret_size = o->o_file->f_size;
+  805b0f:	8b 46 04             	mov    0x4(%esi),%eax
+  805b12:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  805b18:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+	ret->ret_isdir = (o->o_file->f_type == FTYPE_DIR);
+  805b1e:	8b 46 04             	mov    0x4(%esi),%eax
+  805b21:	83 c4 10             	add    $0x10,%esp
+  805b24:	83 b8 84 00 00 00 01 	cmpl   $0x1,0x84(%eax)
+  805b2b:	0f 94 c0             	sete   %al
+  805b2e:	0f b6 c0             	movzbl %al,%eax
+  805b31:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+	return 0;
+  805b37:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805b3c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  805b3f:	5b                   	pop    %ebx
+  805b40:	5e                   	pop    %esi
+  805b41:	5d                   	pop    %ebp
+  805b42:	c3                   	ret
+
+00805b43 <serve_flush>:
+{
+  805b43:	55                   	push   %ebp
+  805b44:	89 e5                	mov    %esp,%ebp
+  805b46:	83 ec 1c             	sub    $0x1c,%esp
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  805b49:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  805b4c:	50                   	push   %eax
+  805b4d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  805b50:	ff 30                	push   (%eax)
+  805b52:	ff 75 08             	push   0x8(%ebp)
+  805b55:	e8 34 fe ff ff       	call   80598e <openfile_lookup>
+  805b5a:	83 c4 10             	add    $0x10,%esp
+  805b5d:	85 c0                	test   %eax,%eax
+  805b5f:	78 16                	js     805b77 <serve_flush+0x34>
+	file_flush(o->o_file);
+  805b61:	83 ec 0c             	sub    $0xc,%esp
+  805b64:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  805b67:	ff 70 04             	push   0x4(%eax)
+  805b6a:	e8 9f f9 ff ff       	call   80550e <file_flush>
+	return 0;
+  805b6f:	83 c4 10             	add    $0x10,%esp
+  805b72:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805b77:	c9                   	leave
+  805b78:	c3                   	ret
+
+00805b79 <serve_fallocate>:
+{
+  805b79:	55                   	push   %ebp
+  805b7a:	89 e5                	mov    %esp,%ebp
+  805b7c:	53                   	push   %ebx
+  805b7d:	83 ec 18             	sub    $0x18,%esp
+  805b80:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  805b83:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  805b86:	50                   	push   %eax
+  805b87:	ff 33                	push   (%ebx)
+  805b89:	ff 75 08             	push   0x8(%ebp)
+  805b8c:	e8 fd fd ff ff       	call   80598e <openfile_lookup>
+  805b91:	83 c4 10             	add    $0x10,%esp
+  805b94:	85 c0                	test   %eax,%eax
+  805b96:	78 17                	js     805baf <serve_fallocate+0x36>
+	return file_allocate(o->o_file, req->req_offset, req->req_len);
+  805b98:	83 ec 04             	sub    $0x4,%esp
+  805b9b:	ff 73 08             	push   0x8(%ebx)
+  805b9e:	ff 73 04             	push   0x4(%ebx)
+  805ba1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  805ba4:	ff 70 04             	push   0x4(%eax)
+  805ba7:	e8 7a e8 ff ff       	call   804426 <file_allocate>
+  805bac:	83 c4 10             	add    $0x10,%esp
+}
+  805baf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  805bb2:	c9                   	leave
+  805bb3:	c3                   	ret
+
+00805bb4 <serve_prefetch>:
+
+// Queue reads of the blocks of req->req_fileid holding
+// req->req_offsets[0..req->req_n-1].  They run after the reply.
+int
+serve_prefetch(envid_t envid, union Fsipc *ipc)
+{
+  805bb4:	55                   	push   %ebp
+  805bb5:	89 e5                	mov    %esp,%ebp
+  805bb7:	56                   	push   %esi
+  805bb8:	53                   	push   %ebx
+  805bb9:	83 ec 14             	sub    $0x14,%esp
+  805bbc:	8b 75 0c             	mov    0xc(%ebp),%esi
+
+	if (debug)
+		cprintf("serve_prefetch %08x %08x %d\n", envid, req->req_fileid,
+			req->req_n);
+
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  805bbf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  805bc2:	50                   	push   %eax
+  805bc3:	ff 36                	push   (%esi)
+  805bc5:	ff 75 08             	push   0x8(%ebp)
+  805bc8:	e8 c1 fd ff ff       	call   80598e <openfile_lookup>
+  805bcd:	83 c4 10             	add    $0x10,%esp
+  805bd0:	85 c0                	test   %eax,%eax
+  805bd2:	78 32                	js     805c06 <serve_prefetch+0x52>
+		return r;
+	if (req->req_n > sizeof(req->req_offsets) / sizeof(off_t))
+  805bd4:	81 7e 04 fe 03 00 00 	cmpl   $0x3fe,0x4(%esi)
+  805bdb:	77 30                	ja     805c0d <serve_prefetch+0x59>
+		return -E_INVAL;
+	for (i = 0; i < req->req_n; i++)
+  805bdd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  805be2:	eb 18                	jmp    805bfc <serve_prefetch+0x48>
+		file_prefetch(o->o_file, req->req_offsets[i]);
+  805be4:	83 ec 08             	sub    $0x8,%esp
+  805be7:	ff 74 9e 08          	push   0x8(%esi,%ebx,4)
+  805beb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  805bee:	ff 70 04             	push   0x4(%eax)
+  805bf1:	e8 94 f6 ff ff       	call   80528a <file_prefetch>
+	for (i = 0; i < req->req_n; i++)
+  805bf6:	83 c3 01             	add    $0x1,%ebx
+  805bf9:	83 c4 10             	add    $0x10,%esp
+  805bfc:	3b 5e 04             	cmp    0x4(%esi),%ebx
+  805bff:	72 e3                	jb     805be4 <serve_prefetch+0x30>
+	return 0;
+  805c01:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805c06:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  805c09:	5b                   	pop    %ebx
+  805c0a:	5e                   	pop    %esi
+  805c0b:	5d                   	pop    %ebp
+  805c0c:	c3                   	ret
+		return -E_INVAL;
+  805c0d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  805c12:	eb f2                	jmp    805c06 <serve_prefetch+0x52>
+
+00805c14 <serve_compound>:
+// FSOP_OPEN_TEMP, the entry is freed straight away.  Returns the number
+// of steps that succeeded.
+static int
+serve_compound(envid_t envid, struct Fsreq_compound *req,
+	       void **pg_store, int *perm_store)
+{
+  805c14:	55                   	push   %ebp
+  805c15:	89 e5                	mov    %esp,%ebp
+  805c17:	57                   	push   %edi
+  805c18:	56                   	push   %esi
+  805c19:	53                   	push   %ebx
+  805c1a:	81 ec 6c 04 00 00    	sub    $0x46c,%esp
+  805c20:	89 85 9c fb ff ff    	mov    %eax,-0x464(%ebp)
+  805c26:	89 d7                	mov    %edx,%edi
+  805c28:	89 95 b0 fb ff ff    	mov    %edx,-0x450(%ebp)
+  805c2e:	89 8d 94 fb ff ff    	mov    %ecx,-0x46c(%ebp)
+	int r;
+
+	if (debug)
+		cprintf("serve_compound %08x %d\n", envid, req->req_nops);
+
+	nops = MIN(req->req_nops, FSC_MAXOPS);
+  805c34:	8b 12                	mov    (%edx),%edx
+  805c36:	b8 08 00 00 00       	mov    $0x8,%eax
+  805c3b:	39 c2                	cmp    %eax,%edx
+  805c3d:	0f 46 c2             	cmovbe %edx,%eax
+  805c40:	89 85 ac fb ff ff    	mov    %eax,-0x454(%ebp)
+	keep = temp = NULL;
+	didopen = 0;
+	for (i = 0; i < nops; i++) {
+  805c46:	83 c7 04             	add    $0x4,%edi
+	didopen = 0;
+  805c49:	c6 85 a3 fb ff ff 00 	movb   $0x0,-0x45d(%ebp)
+	for (i = 0; i < nops; i++) {
+  805c50:	c7 85 b4 fb ff ff 00 	movl   $0x0,-0x44c(%ebp)
+  805c57:	00 00 00 
+	keep = temp = NULL;
+  805c5a:	c7 85 a4 fb ff ff 00 	movl   $0x0,-0x45c(%ebp)
+  805c61:	00 00 00 
+  805c64:	c7 85 a8 fb ff ff 00 	movl   $0x0,-0x458(%ebp)
+  805c6b:	00 00 00 
+	for (i = 0; i < nops; i++) {
+  805c6e:	e9 a6 00 00 00       	jmp    805d19 <serve_compound+0x105>
+		room = sizeof(req->req_buf) - op->op_buf;
+
+		if (op->op_type == FSOP_OPEN || op->op_type == FSOP_OPEN_TEMP) {
+			// Until the reply, nothing else maps the Fd page, so
+			// a second open could be handed the same entry.
+			if (didopen) {
+  805c73:	80 bd a3 fb ff ff 00 	cmpb   $0x0,-0x45d(%ebp)
+  805c7a:	0f 85 56 02 00 00    	jne    805ed6 <serve_compound+0x2c2>
+				r = -E_INVAL;
+				goto fail;
+			}
+			didopen = 1;
+			memmove(path, req->req_buf + op->op_buf,
+				MIN(room, MAXPATHLEN));
+  805c80:	b8 00 04 00 00       	mov    $0x400,%eax
+  805c85:	39 c6                	cmp    %eax,%esi
+  805c87:	0f 47 f0             	cmova  %eax,%esi
+			memmove(path, req->req_buf + op->op_buf,
+  805c8a:	83 ec 04             	sub    $0x4,%esp
+  805c8d:	56                   	push   %esi
+  805c8e:	8b 8d b0 fb ff ff    	mov    -0x450(%ebp),%ecx
+  805c94:	8d 84 11 e4 00 00 00 	lea    0xe4(%ecx,%edx,1),%eax
+  805c9b:	50                   	push   %eax
+  805c9c:	8d 95 c4 fb ff ff    	lea    -0x43c(%ebp),%edx
+  805ca2:	52                   	push   %edx
+  805ca3:	e8 77 16 00 00       	call   80731f <memmove>
+			path[MIN(room, MAXPATHLEN) - 1] = 0;
+  805ca8:	c6 84 35 c3 fb ff ff 	movb   $0x0,-0x43d(%ebp,%esi,1)
+  805caf:	00 
+			if ((r = openfile_open(envid, path, op->op_arg, &o)) < 0)
+  805cb0:	8b 4f 0c             	mov    0xc(%edi),%ecx
+  805cb3:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+  805cb6:	89 04 24             	mov    %eax,(%esp)
+  805cb9:	8d 95 c4 fb ff ff    	lea    -0x43c(%ebp),%edx
+  805cbf:	8b 85 9c fb ff ff    	mov    -0x464(%ebp),%eax
+  805cc5:	e8 e4 fb ff ff       	call   8058ae <openfile_open>
+  805cca:	83 c4 10             	add    $0x10,%esp
+  805ccd:	85 c0                	test   %eax,%eax
+  805ccf:	0f 88 29 02 00 00    	js     805efe <serve_compound+0x2ea>
+				goto fail;
+			opened[i] = o;
+  805cd5:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  805cd8:	8b 8d b4 fb ff ff    	mov    -0x44c(%ebp),%ecx
+  805cde:	89 44 8d c8          	mov    %eax,-0x38(%ebp,%ecx,4)
+			if (op->op_type == FSOP_OPEN)
+				keep = o;
+  805ce2:	83 3f 01             	cmpl   $0x1,(%edi)
+  805ce5:	8b b5 a8 fb ff ff    	mov    -0x458(%ebp),%esi
+  805ceb:	0f 44 f0             	cmove  %eax,%esi
+  805cee:	89 b5 a8 fb ff ff    	mov    %esi,-0x458(%ebp)
+  805cf4:	8b b5 a4 fb ff ff    	mov    -0x45c(%ebp),%esi
+  805cfa:	0f 45 f0             	cmovne %eax,%esi
+  805cfd:	89 b5 a4 fb ff ff    	mov    %esi,-0x45c(%ebp)
+			else
+				temp = o;
+			op->op_ret = o->o_fileid;
+  805d03:	8b 00                	mov    (%eax),%eax
+			didopen = 1;
+  805d05:	c6 85 a3 fb ff ff 01 	movb   $0x1,-0x45d(%ebp)
+			op->op_ret = o->o_fileid;
+  805d0c:	89 43 18             	mov    %eax,0x18(%ebx)
+	for (i = 0; i < nops; i++) {
+  805d0f:	83 85 b4 fb ff ff 01 	addl   $0x1,-0x44c(%ebp)
+  805d16:	83 c7 1c             	add    $0x1c,%edi
+  805d19:	8b 8d ac fb ff ff    	mov    -0x454(%ebp),%ecx
+  805d1f:	39 8d b4 fb ff ff    	cmp    %ecx,-0x44c(%ebp)
+  805d25:	0f 84 69 01 00 00    	je     805e94 <serve_compound+0x280>
+		opened[i] = NULL;
+  805d2b:	8b 85 b4 fb ff ff    	mov    -0x44c(%ebp),%eax
+  805d31:	c7 44 85 c8 00 00 00 	movl   $0x0,-0x38(%ebp,%eax,4)
+  805d38:	00 
+		if (op->op_buf >= sizeof(req->req_buf)) {
+  805d39:	89 fb                	mov    %edi,%ebx
+  805d3b:	8b 57 14             	mov    0x14(%edi),%edx
+  805d3e:	81 fa 1b 0f 00 00    	cmp    $0xf1b,%edx
+  805d44:	0f 87 82 01 00 00    	ja     805ecc <serve_compound+0x2b8>
+		room = sizeof(req->req_buf) - op->op_buf;
+  805d4a:	be 1c 0f 00 00       	mov    $0xf1c,%esi
+  805d4f:	29 d6                	sub    %edx,%esi
+		if (op->op_type == FSOP_OPEN || op->op_type == FSOP_OPEN_TEMP) {
+  805d51:	8b 0f                	mov    (%edi),%ecx
+  805d53:	8d 41 ff             	lea    -0x1(%ecx),%eax
+  805d56:	83 f8 01             	cmp    $0x1,%eax
+  805d59:	0f 86 14 ff ff ff    	jbe    805c73 <serve_compound+0x5f>
+			continue;
+		}
+
+		if (op->op_step == 0)
+  805d5f:	8b 47 04             	mov    0x4(%edi),%eax
+  805d62:	85 c0                	test   %eax,%eax
+  805d64:	74 6b                	je     805dd1 <serve_compound+0x1bd>
+			r = openfile_lookup(envid, op->op_fileid, &o);
+		else if (op->op_step <= i && opened[op->op_step - 1])
+  805d66:	39 85 b4 fb ff ff    	cmp    %eax,-0x44c(%ebp)
+  805d6c:	0f 82 6e 01 00 00    	jb     805ee0 <serve_compound+0x2cc>
+  805d72:	8b 44 85 c4          	mov    -0x3c(%ebp,%eax,4),%eax
+  805d76:	85 c0                	test   %eax,%eax
+  805d78:	0f 84 6c 01 00 00    	je     805eea <serve_compound+0x2d6>
+			o = opened[op->op_step - 1], r = 0;
+  805d7e:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+		else
+			r = -E_INVAL;
+		if (r < 0)
+			goto fail;
+
+		switch (op->op_type) {
+  805d81:	8b 03                	mov    (%ebx),%eax
+  805d83:	83 f8 03             	cmp    $0x3,%eax
+  805d86:	74 69                	je     805df1 <serve_compound+0x1dd>
+  805d88:	83 f8 04             	cmp    $0x4,%eax
+  805d8b:	0f 84 c9 00 00 00    	je     805e5a <serve_compound+0x246>
+  805d91:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+	if (temp)
+		openfile_release(temp);
+	return nops;
+
+fail:
+	if (keep)
+  805d96:	8b 85 a8 fb ff ff    	mov    -0x458(%ebp),%eax
+  805d9c:	85 c0                	test   %eax,%eax
+  805d9e:	74 05                	je     805da5 <serve_compound+0x191>
+		openfile_release(keep);
+  805da0:	e8 15 f8 ff ff       	call   8055ba <openfile_release>
+	if (temp)
+  805da5:	8b 85 a4 fb ff ff    	mov    -0x45c(%ebp),%eax
+  805dab:	85 c0                	test   %eax,%eax
+  805dad:	74 05                	je     805db4 <serve_compound+0x1a0>
+		openfile_release(temp);
+  805daf:	e8 06 f8 ff ff       	call   8055ba <openfile_release>
+	op->op_ret = r;
+  805db4:	8b 95 b4 fb ff ff    	mov    -0x44c(%ebp),%edx
+  805dba:	6b c2 1c             	imul   $0x1c,%edx,%eax
+  805dbd:	8b 8d b0 fb ff ff    	mov    -0x450(%ebp),%ecx
+  805dc3:	89 5c 01 1c          	mov    %ebx,0x1c(%ecx,%eax,1)
+	return i;
+  805dc7:	89 d0                	mov    %edx,%eax
+}
+  805dc9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  805dcc:	5b                   	pop    %ebx
+  805dcd:	5e                   	pop    %esi
+  805dce:	5f                   	pop    %edi
+  805dcf:	5d                   	pop    %ebp
+  805dd0:	c3                   	ret
+			r = openfile_lookup(envid, op->op_fileid, &o);
+  805dd1:	83 ec 04             	sub    $0x4,%esp
+  805dd4:	8d 45 c4             	lea    -0x3c(%ebp),%eax
+  805dd7:	50                   	push   %eax
+  805dd8:	ff 77 08             	push   0x8(%edi)
+  805ddb:	ff b5 9c fb ff ff    	push   -0x464(%ebp)
+  805de1:	e8 a8 fb ff ff       	call   80598e <openfile_lookup>
+		if (r < 0)
+  805de6:	83 c4 10             	add    $0x10,%esp
+  805de9:	85 c0                	test   %eax,%eax
+  805deb:	79 94                	jns    805d81 <serve_compound+0x16d>
+  805ded:	89 c3                	mov    %eax,%ebx
+  805def:	eb a5                	jmp    805d96 <serve_compound+0x182>
+			if (room < sizeof(*st)) {
+  805df1:	81 fe 87 00 00 00    	cmp    $0x87,%esi
+  805df7:	0f 86 f7 00 00 00    	jbe    805ef4 <serve_compound+0x2e0>
+			st = (struct Fsret_stat *) (req->req_buf + op->op_buf);
+  805dfd:	8b 43 14             	mov    0x14(%ebx),%eax
+  805e00:	8b b5 b0 fb ff ff    	mov    -0x450(%ebp),%esi
+  805e06:	8d 8c 06 e4 00 00 00 	lea    0xe4(%esi,%eax,1),%ecx
+			strcpy(st->ret_name, o->o_file->f_name);
+  805e0d:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  805e10:	83 ec 08             	sub    $0x8,%esp
+  805e13:	ff 76 04             	push   0x4(%esi)
+  805e16:	89 8d 98 fb ff ff    	mov    %ecx,-0x468(%ebp)
+  805e1c:	51                   	push   %ecx
+  805e1d:	e8 77 13 00 00       	call   807199 <strcpy>
+			st->ret_size = o->o_file->f_size;
+  805e22:	8b 46 04             	mov    0x4(%esi),%eax
+  805e25:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  805e2b:	8b 8d 98 fb ff ff    	mov    -0x468(%ebp),%ecx
+  805e31:	89 81 80 00 00 00    	mov    %eax,0x80(%ecx)
+			st->ret_isdir = (o->o_file->f_type == FTYPE_DIR);
+  805e37:	8b 46 04             	mov    0x4(%esi),%eax
+  805e3a:	83 c4 10             	add    $0x10,%esp
+  805e3d:	83 b8 84 00 00 00 01 	cmpl   $0x1,0x84(%eax)
+  805e44:	0f 94 c0             	sete   %al
+  805e47:	0f b6 c0             	movzbl %al,%eax
+  805e4a:	89 81 84 00 00 00    	mov    %eax,0x84(%ecx)
+			r = 0;
+  805e50:	b8 00 00 00 00       	mov    $0x0,%eax
+  805e55:	e9 b2 fe ff ff       	jmp    805d0c <serve_compound+0xf8>
+			r = file_read(o->o_file, req->req_buf + op->op_buf,
+  805e5a:	ff 73 10             	push   0x10(%ebx)
+				      MIN(op->op_arg, room), op->op_offset);
+  805e5d:	8b 43 0c             	mov    0xc(%ebx),%eax
+  805e60:	39 c6                	cmp    %eax,%esi
+  805e62:	0f 46 c6             	cmovbe %esi,%eax
+			r = file_read(o->o_file, req->req_buf + op->op_buf,
+  805e65:	50                   	push   %eax
+  805e66:	8b 43 14             	mov    0x14(%ebx),%eax
+  805e69:	8b b5 b0 fb ff ff    	mov    -0x450(%ebp),%esi
+  805e6f:	8d 84 06 e4 00 00 00 	lea    0xe4(%esi,%eax,1),%eax
+  805e76:	50                   	push   %eax
+  805e77:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  805e7a:	ff 70 04             	push   0x4(%eax)
+  805e7d:	e8 81 f0 ff ff       	call   804f03 <file_read>
+		if (r < 0)
+  805e82:	83 c4 10             	add    $0x10,%esp
+  805e85:	85 c0                	test   %eax,%eax
+  805e87:	0f 89 7f fe ff ff    	jns    805d0c <serve_compound+0xf8>
+  805e8d:	89 c3                	mov    %eax,%ebx
+  805e8f:	e9 02 ff ff ff       	jmp    805d96 <serve_compound+0x182>
+	if (keep) {
+  805e94:	8b 85 a8 fb ff ff    	mov    -0x458(%ebp),%eax
+  805e9a:	85 c0                	test   %eax,%eax
+  805e9c:	74 14                	je     805eb2 <serve_compound+0x29e>
+		*pg_store = keep->o_fd;
+  805e9e:	8b 40 0c             	mov    0xc(%eax),%eax
+  805ea1:	8b 9d 94 fb ff ff    	mov    -0x46c(%ebp),%ebx
+  805ea7:	89 03                	mov    %eax,(%ebx)
+		*perm_store = PTE_P|PTE_U|PTE_W|PTE_SHARE;
+  805ea9:	8b 45 08             	mov    0x8(%ebp),%eax
+  805eac:	c7 00 07 04 00 00    	movl   $0x407,(%eax)
+	if (temp)
+  805eb2:	8b 85 a4 fb ff ff    	mov    -0x45c(%ebp),%eax
+  805eb8:	85 c0                	test   %eax,%eax
+  805eba:	74 05                	je     805ec1 <serve_compound+0x2ad>
+		openfile_release(temp);
+  805ebc:	e8 f9 f6 ff ff       	call   8055ba <openfile_release>
+	return nops;
+  805ec1:	8b 85 ac fb ff ff    	mov    -0x454(%ebp),%eax
+  805ec7:	e9 fd fe ff ff       	jmp    805dc9 <serve_compound+0x1b5>
+			r = -E_INVAL;
+  805ecc:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  805ed1:	e9 c0 fe ff ff       	jmp    805d96 <serve_compound+0x182>
+				r = -E_INVAL;
+  805ed6:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  805edb:	e9 b6 fe ff ff       	jmp    805d96 <serve_compound+0x182>
+			r = -E_INVAL;
+  805ee0:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  805ee5:	e9 ac fe ff ff       	jmp    805d96 <serve_compound+0x182>
+  805eea:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  805eef:	e9 a2 fe ff ff       	jmp    805d96 <serve_compound+0x182>
+				r = -E_INVAL;
+  805ef4:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  805ef9:	e9 98 fe ff ff       	jmp    805d96 <serve_compound+0x182>
+  805efe:	89 c3                	mov    %eax,%ebx
+  805f00:	e9 91 fe ff ff       	jmp    805d96 <serve_compound+0x182>
+
+00805f05 <serve_open>:
+{
+  805f05:	55                   	push   %ebp
+  805f06:	89 e5                	mov    %esp,%ebp
+  805f08:	56                   	push   %esi
+  805f09:	53                   	push   %ebx
+  805f0a:	81 ec 14 04 00 00    	sub    $0x414,%esp
+  805f10:	8b 75 0c             	mov    0xc(%ebp),%esi
+	memmove(path, req->req_path, MAXPATHLEN);
+  805f13:	68 00 04 00 00       	push   $0x400
+  805f18:	56                   	push   %esi
+  805f19:	8d 9d f8 fb ff ff    	lea    -0x408(%ebp),%ebx
+  805f1f:	53                   	push   %ebx
+  805f20:	e8 fa 13 00 00       	call   80731f <memmove>
+	path[MAXPATHLEN-1] = 0;
+  805f25:	c6 45 f7 00          	movb   $0x0,-0x9(%ebp)
+	if ((r = openfile_open(envid, path, req->req_omode, &o)) < 0)
+  805f29:	8b 8e 00 04 00 00    	mov    0x400(%esi),%ecx
+  805f2f:	8d 85 f4 fb ff ff    	lea    -0x40c(%ebp),%eax
+  805f35:	89 04 24             	mov    %eax,(%esp)
+  805f38:	89 da                	mov    %ebx,%edx
+  805f3a:	8b 45 08             	mov    0x8(%ebp),%eax
+  805f3d:	e8 6c f9 ff ff       	call   8058ae <openfile_open>
+  805f42:	83 c4 10             	add    $0x10,%esp
+  805f45:	85 c0                	test   %eax,%eax
+  805f47:	78 1c                	js     805f65 <serve_open+0x60>
+	*pg_store = o->o_fd;
+  805f49:	8b 85 f4 fb ff ff    	mov    -0x40c(%ebp),%eax
+  805f4f:	8b 50 0c             	mov    0xc(%eax),%edx
+  805f52:	8b 45 10             	mov    0x10(%ebp),%eax
+  805f55:	89 10                	mov    %edx,(%eax)
+	*perm_store = PTE_P|PTE_U|PTE_W|PTE_SHARE;
+  805f57:	8b 45 14             	mov    0x14(%ebp),%eax
+  805f5a:	c7 00 07 04 00 00    	movl   $0x407,(%eax)
+	return 0;
+  805f60:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805f65:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  805f68:	5b                   	pop    %ebx
+  805f69:	5e                   	pop    %esi
+  805f6a:	5d                   	pop    %ebp
+  805f6b:	c3                   	ret
+
+00805f6c <serve_read_map>:
+{
+  805f6c:	55                   	push   %ebp
+  805f6d:	89 e5                	mov    %esp,%ebp
+  805f6f:	57                   	push   %edi
+  805f70:	56                   	push   %esi
+  805f71:	53                   	push   %ebx
+  805f72:	83 ec 20             	sub    $0x20,%esp
+  805f75:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  805f78:	8b 75 10             	mov    0x10(%ebp),%esi
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  805f7b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  805f7e:	50                   	push   %eax
+  805f7f:	ff 33                	push   (%ebx)
+  805f81:	ff 75 08             	push   0x8(%ebp)
+  805f84:	e8 05 fa ff ff       	call   80598e <openfile_lookup>
+  805f89:	83 c4 10             	add    $0x10,%esp
+  805f8c:	85 c0                	test   %eax,%eax
+  805f8e:	78 3b                	js     805fcb <serve_read_map+0x5f>
+	file_readahead(o->o_file, &o->o_ra, req->req_offset, PGSIZE);
+  805f90:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  805f93:	68 00 10 00 00       	push   $0x1000
+  805f98:	ff 73 04             	push   0x4(%ebx)
+  805f9b:	8d 47 10             	lea    0x10(%edi),%eax
+  805f9e:	50                   	push   %eax
+  805f9f:	ff 77 04             	push   0x4(%edi)
+  805fa2:	e8 ec f1 ff ff       	call   805193 <file_readahead>
+	if ((n = file_read_map(o->o_file, req->req_offset, dstva)) <= 0)
+  805fa7:	83 c4 0c             	add    $0xc,%esp
+  805faa:	56                   	push   %esi
+  805fab:	ff 73 04             	push   0x4(%ebx)
+  805fae:	ff 77 04             	push   0x4(%edi)
+  805fb1:	e8 7f f0 ff ff       	call   805035 <file_read_map>
+  805fb6:	83 c4 10             	add    $0x10,%esp
+  805fb9:	85 c0                	test   %eax,%eax
+  805fbb:	7e 0e                	jle    805fcb <serve_read_map+0x5f>
+	*pg_store = dstva;
+  805fbd:	8b 55 14             	mov    0x14(%ebp),%edx
+  805fc0:	89 32                	mov    %esi,(%edx)
+	*perm_store = PTE_P | PTE_U;
+  805fc2:	8b 55 18             	mov    0x18(%ebp),%edx
+  805fc5:	c7 02 05 00 00 00    	movl   $0x5,(%edx)
+}
+  805fcb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  805fce:	5b                   	pop    %ebx
+  805fcf:	5e                   	pop    %esi
+  805fd0:	5f                   	pop    %edi
+  805fd1:	5d                   	pop    %ebp
+  805fd2:	c3                   	ret
+
+00805fd3 <serve_readv>:
+{
+  805fd3:	55                   	push   %ebp
+  805fd4:	89 e5                	mov    %esp,%ebp
+  805fd6:	57                   	push   %edi
+  805fd7:	56                   	push   %esi
+  805fd8:	53                   	push   %ebx
+  805fd9:	83 ec 30             	sub    $0x30,%esp
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  805fdc:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  805fdf:	50                   	push   %eax
+  805fe0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  805fe3:	ff 30                	push   (%eax)
+  805fe5:	ff 75 08             	push   0x8(%ebp)
+  805fe8:	e8 a1 f9 ff ff       	call   80598e <openfile_lookup>
+  805fed:	89 c3                	mov    %eax,%ebx
+  805fef:	83 c4 10             	add    $0x10,%esp
+  805ff2:	85 c0                	test   %eax,%eax
+  805ff4:	78 3c                	js     806032 <serve_readv+0x5f>
+	if (req->req_offset < 0)
+  805ff6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  805ff9:	8b 50 04             	mov    0x4(%eax),%edx
+  805ffc:	85 d2                	test   %edx,%edx
+  805ffe:	0f 88 ed 00 00 00    	js     8060f1 <serve_readv+0x11e>
+	end = MIN(o->o_file->f_size, req->req_offset +
+  806004:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  806007:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  80600a:	8b 4e 04             	mov    0x4(%esi),%ecx
+  80600d:	8b 40 08             	mov    0x8(%eax),%eax
+  806010:	bb 00 00 10 00       	mov    $0x100000,%ebx
+  806015:	39 d8                	cmp    %ebx,%eax
+  806017:	0f 47 c3             	cmova  %ebx,%eax
+  80601a:	01 d0                	add    %edx,%eax
+  80601c:	8b 99 80 00 00 00    	mov    0x80(%ecx),%ebx
+  806022:	39 d8                	cmp    %ebx,%eax
+  806024:	0f 46 d8             	cmovbe %eax,%ebx
+  806027:	89 df                	mov    %ebx,%edi
+		return 0;
+  806029:	bb 00 00 00 00       	mov    $0x0,%ebx
+	if (end <= req->req_offset)
+  80602e:	39 fa                	cmp    %edi,%edx
+  806030:	7c 0a                	jl     80603c <serve_readv+0x69>
+}
+  806032:	89 d8                	mov    %ebx,%eax
+  806034:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  806037:	5b                   	pop    %ebx
+  806038:	5e                   	pop    %esi
+  806039:	5f                   	pop    %edi
+  80603a:	5d                   	pop    %ebp
+  80603b:	c3                   	ret
+	start = ROUNDDOWN(req->req_offset, PGSIZE);
+  80603c:	89 d3                	mov    %edx,%ebx
+  80603e:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+	n = MIN(ROUNDUP(end - start, PGSIZE) / PGSIZE, FSV_MAXPAGES);
+  806044:	89 7d c8             	mov    %edi,-0x38(%ebp)
+  806047:	89 f8                	mov    %edi,%eax
+  806049:	29 d8                	sub    %ebx,%eax
+  80604b:	05 ff 0f 00 00       	add    $0xfff,%eax
+  806050:	c1 f8 0c             	sar    $0xc,%eax
+  806053:	89 c7                	mov    %eax,%edi
+  806055:	b8 00 01 00 00       	mov    $0x100,%eax
+  80605a:	89 7d cc             	mov    %edi,-0x34(%ebp)
+  80605d:	39 c7                	cmp    %eax,%edi
+  80605f:	89 c7                	mov    %eax,%edi
+  806061:	0f 4e 7d cc          	cmovle -0x34(%ebp),%edi
+  806065:	89 7d cc             	mov    %edi,-0x34(%ebp)
+		       end - req->req_offset);
+  806068:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80606b:	29 d0                	sub    %edx,%eax
+	file_readahead(o->o_file, &o->o_ra, req->req_offset,
+  80606d:	50                   	push   %eax
+  80606e:	52                   	push   %edx
+  80606f:	8d 46 10             	lea    0x10(%esi),%eax
+  806072:	50                   	push   %eax
+  806073:	51                   	push   %ecx
+  806074:	e8 1a f1 ff ff       	call   805193 <file_readahead>
+	for (i = 0; i < n; i++)
+  806079:	83 c4 10             	add    $0x10,%esp
+  80607c:	89 de                	mov    %ebx,%esi
+  80607e:	bf 00 00 00 00       	mov    $0x0,%edi
+		if ((r = file_read_map(o->o_file, start + i * PGSIZE,
+  806083:	8b 45 10             	mov    0x10(%ebp),%eax
+  806086:	29 d8                	sub    %ebx,%eax
+  806088:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80608b:	8b 5d cc             	mov    -0x34(%ebp),%ebx
+	for (i = 0; i < n; i++)
+  80608e:	39 df                	cmp    %ebx,%edi
+  806090:	74 38                	je     8060ca <serve_readv+0xf7>
+		if ((r = file_read_map(o->o_file, start + i * PGSIZE,
+  806092:	83 ec 04             	sub    $0x4,%esp
+  806095:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  806098:	01 f0                	add    %esi,%eax
+  80609a:	50                   	push   %eax
+  80609b:	56                   	push   %esi
+  80609c:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80609f:	ff 70 04             	push   0x4(%eax)
+  8060a2:	e8 8e ef ff ff       	call   805035 <file_read_map>
+  8060a7:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8060ad:	83 c4 10             	add    $0x10,%esp
+  8060b0:	85 c0                	test   %eax,%eax
+  8060b2:	78 05                	js     8060b9 <serve_readv+0xe6>
+	for (i = 0; i < n; i++)
+  8060b4:	83 c7 01             	add    $0x1,%edi
+  8060b7:	eb d5                	jmp    80608e <serve_readv+0xbb>
+			serve_unmap(dstva, i);
+  8060b9:	89 c3                	mov    %eax,%ebx
+  8060bb:	89 fa                	mov    %edi,%edx
+  8060bd:	8b 45 10             	mov    0x10(%ebp),%eax
+  8060c0:	e8 21 f5 ff ff       	call   8055e6 <serve_unmap>
+			return r;
+  8060c5:	e9 68 ff ff ff       	jmp    806032 <serve_readv+0x5f>
+	*pg_store = dstva;
+  8060ca:	8b 45 14             	mov    0x14(%ebp),%eax
+  8060cd:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  8060d0:	89 08                	mov    %ecx,(%eax)
+	*npages_store = n;
+  8060d2:	8b 45 18             	mov    0x18(%ebp),%eax
+  8060d5:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8060d8:	89 08                	mov    %ecx,(%eax)
+	*perm_store = PTE_P | PTE_U;
+  8060da:	8b 45 1c             	mov    0x1c(%ebp),%eax
+  8060dd:	c7 00 05 00 00 00    	movl   $0x5,(%eax)
+	return end - req->req_offset;
+  8060e3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8060e6:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  8060e9:	2b 58 04             	sub    0x4(%eax),%ebx
+  8060ec:	e9 41 ff ff ff       	jmp    806032 <serve_readv+0x5f>
+		return -E_INVAL;
+  8060f1:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8060f6:	e9 37 ff ff ff       	jmp    806032 <serve_readv+0x5f>
+
+008060fb <serve_writev>:
+{
+  8060fb:	55                   	push   %ebp
+  8060fc:	89 e5                	mov    %esp,%ebp
+  8060fe:	56                   	push   %esi
+  8060ff:	53                   	push   %ebx
+  806100:	83 ec 14             	sub    $0x14,%esp
+  806103:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+	if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  806106:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  806109:	50                   	push   %eax
+  80610a:	ff 33                	push   (%ebx)
+  80610c:	ff 75 08             	push   0x8(%ebp)
+  80610f:	e8 7a f8 ff ff       	call   80598e <openfile_lookup>
+  806114:	83 c4 10             	add    $0x10,%esp
+  806117:	85 c0                	test   %eax,%eax
+  806119:	78 33                	js     80614e <serve_writev+0x53>
+	if (req->req_n > npages * PGSIZE)
+  80611b:	8b 53 04             	mov    0x4(%ebx),%edx
+  80611e:	8b 45 10             	mov    0x10(%ebp),%eax
+  806121:	c1 e0 0c             	shl    $0xc,%eax
+  806124:	39 d0                	cmp    %edx,%eax
+  806126:	72 2d                	jb     806155 <serve_writev+0x5a>
+			    o->o_fd->fd_offset)) < 0)
+  806128:	8b 75 f4             	mov    -0xc(%ebp),%esi
+	if ((r = file_write(o->o_file, (char *) req + PGSIZE, req->req_n,
+  80612b:	8b 46 0c             	mov    0xc(%esi),%eax
+  80612e:	ff 70 04             	push   0x4(%eax)
+  806131:	52                   	push   %edx
+  806132:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  806138:	53                   	push   %ebx
+  806139:	ff 76 04             	push   0x4(%esi)
+  80613c:	e8 d7 f2 ff ff       	call   805418 <file_write>
+  806141:	83 c4 10             	add    $0x10,%esp
+  806144:	85 c0                	test   %eax,%eax
+  806146:	78 06                	js     80614e <serve_writev+0x53>
+	o->o_fd->fd_offset += r;
+  806148:	8b 56 0c             	mov    0xc(%esi),%edx
+  80614b:	01 42 04             	add    %eax,0x4(%edx)
+}
+  80614e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  806151:	5b                   	pop    %ebx
+  806152:	5e                   	pop    %esi
+  806153:	5d                   	pop    %ebp
+  806154:	c3                   	ret
+		return -E_INVAL;
+  806155:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80615a:	eb f2                	jmp    80614e <serve_writev+0x53>
+
+0080615c <serve_dispatch>:
+// FSREQ_READ_MAP put the cache pages they send.
+static int
+serve_dispatch(envid_t whom, uint32_t req, union Fsipc *fsreq, size_t nreq,
+	       void *readvva, void **pg_store, size_t *npages_store,
+	       int *perm_store)
+{
+  80615c:	55                   	push   %ebp
+  80615d:	89 e5                	mov    %esp,%ebp
+  80615f:	56                   	push   %esi
+  806160:	53                   	push   %ebx
+  806161:	89 c3                	mov    %eax,%ebx
+  806163:	89 d0                	mov    %edx,%eax
+  806165:	89 ce                	mov    %ecx,%esi
+  806167:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  80616a:	8b 55 14             	mov    0x14(%ebp),%edx
+	*pg_store = NULL;
+  80616d:	c7 01 00 00 00 00    	movl   $0x0,(%ecx)
+	*npages_store = 1;
+  806173:	c7 02 01 00 00 00    	movl   $0x1,(%edx)
+	if (req == FSREQ_OPEN)
+  806179:	83 f8 01             	cmp    $0x1,%eax
+  80617c:	74 39                	je     8061b7 <serve_dispatch+0x5b>
+		return serve_open(whom, (struct Fsreq_open*)fsreq, pg_store,
+				  perm_store);
+	if (req == FSREQ_READ_MAP)
+  80617e:	83 f8 0b             	cmp    $0xb,%eax
+  806181:	74 44                	je     8061c7 <serve_dispatch+0x6b>
+		return serve_read_map(whom, &fsreq->read_map, readvva,
+				      pg_store, perm_store);
+	if (req == FSREQ_READV)
+  806183:	83 f8 0c             	cmp    $0xc,%eax
+  806186:	74 55                	je     8061dd <serve_dispatch+0x81>
+		return serve_readv(whom, &fsreq->readv, readvva, pg_store,
+				   npages_store, perm_store);
+	if (req == FSREQ_WRITEV)
+  806188:	83 f8 0d             	cmp    $0xd,%eax
+  80618b:	74 67                	je     8061f4 <serve_dispatch+0x98>
+		return serve_writev(whom, &fsreq->writev, nreq - 1);
+	if (req == FSREQ_COMPOUND)
+  80618d:	83 f8 0e             	cmp    $0xe,%eax
+  806190:	74 78                	je     80620a <serve_dispatch+0xae>
+		return serve_compound(whom, &fsreq->compound, pg_store,
+				      perm_store);
+	if (req < NHANDLERS && handlers[req])
+  806192:	83 f8 0f             	cmp    $0xf,%eax
+  806195:	0f 87 83 00 00 00    	ja     80621e <serve_dispatch+0xc2>
+  80619b:	8b 14 85 20 b0 80 00 	mov    0x80b020(,%eax,4),%edx
+  8061a2:	85 d2                	test   %edx,%edx
+  8061a4:	74 78                	je     80621e <serve_dispatch+0xc2>
+		return handlers[req](whom, fsreq);
+  8061a6:	83 ec 08             	sub    $0x8,%esp
+  8061a9:	56                   	push   %esi
+  8061aa:	53                   	push   %ebx
+  8061ab:	ff d2                	call   *%edx
+  8061ad:	83 c4 10             	add    $0x10,%esp
+	cprintf("Invalid request code %d from %08x\n", req, whom);
+	return -E_INVAL;
+}
+  8061b0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8061b3:	5b                   	pop    %ebx
+  8061b4:	5e                   	pop    %esi
+  8061b5:	5d                   	pop    %ebp
+  8061b6:	c3                   	ret
+		return serve_open(whom, (struct Fsreq_open*)fsreq, pg_store,
+  8061b7:	ff 75 18             	push   0x18(%ebp)
+  8061ba:	51                   	push   %ecx
+  8061bb:	56                   	push   %esi
+  8061bc:	53                   	push   %ebx
+  8061bd:	e8 43 fd ff ff       	call   805f05 <serve_open>
+  8061c2:	83 c4 10             	add    $0x10,%esp
+  8061c5:	eb e9                	jmp    8061b0 <serve_dispatch+0x54>
+		return serve_read_map(whom, &fsreq->read_map, readvva,
+  8061c7:	83 ec 0c             	sub    $0xc,%esp
+  8061ca:	ff 75 18             	push   0x18(%ebp)
+  8061cd:	51                   	push   %ecx
+  8061ce:	ff 75 0c             	push   0xc(%ebp)
+  8061d1:	56                   	push   %esi
+  8061d2:	53                   	push   %ebx
+  8061d3:	e8 94 fd ff ff       	call   805f6c <serve_read_map>
+  8061d8:	83 c4 20             	add    $0x20,%esp
+  8061db:	eb d3                	jmp    8061b0 <serve_dispatch+0x54>
+		return serve_readv(whom, &fsreq->readv, readvva, pg_store,
+  8061dd:	83 ec 08             	sub    $0x8,%esp
+  8061e0:	ff 75 18             	push   0x18(%ebp)
+  8061e3:	52                   	push   %edx
+  8061e4:	51                   	push   %ecx
+  8061e5:	ff 75 0c             	push   0xc(%ebp)
+  8061e8:	56                   	push   %esi
+  8061e9:	53                   	push   %ebx
+  8061ea:	e8 e4 fd ff ff       	call   805fd3 <serve_readv>
+  8061ef:	83 c4 20             	add    $0x20,%esp
+  8061f2:	eb bc                	jmp    8061b0 <serve_dispatch+0x54>
+		return serve_writev(whom, &fsreq->writev, nreq - 1);
+  8061f4:	83 ec 04             	sub    $0x4,%esp
+  8061f7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8061fa:	83 e8 01             	sub    $0x1,%eax
+  8061fd:	50                   	push   %eax
+  8061fe:	56                   	push   %esi
+  8061ff:	53                   	push   %ebx
+  806200:	e8 f6 fe ff ff       	call   8060fb <serve_writev>
+  806205:	83 c4 10             	add    $0x10,%esp
+  806208:	eb a6                	jmp    8061b0 <serve_dispatch+0x54>
+		return serve_compound(whom, &fsreq->compound, pg_store,
+  80620a:	83 ec 0c             	sub    $0xc,%esp
+  80620d:	ff 75 18             	push   0x18(%ebp)
+  806210:	89 f2                	mov    %esi,%edx
+  806212:	89 d8                	mov    %ebx,%eax
+  806214:	e8 fb f9 ff ff       	call   805c14 <serve_compound>
+  806219:	83 c4 10             	add    $0x10,%esp
+  80621c:	eb 92                	jmp    8061b0 <serve_dispatch+0x54>
+	cprintf("Invalid request code %d from %08x\n", req, whom);
+  80621e:	83 ec 04             	sub    $0x4,%esp
+  806221:	53                   	push   %ebx
+  806222:	50                   	push   %eax
+  806223:	68 8c 9f 80 00       	push   $0x809f8c
+  806228:	e8 7e 09 00 00       	call   806bab <cprintf>
+	return -E_INVAL;
+  80622d:	83 c4 10             	add    $0x10,%esp
+  806230:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  806235:	e9 76 ff ff ff       	jmp    8061b0 <serve_dispatch+0x54>
+
+0080623a <serve>:
+// go while waiting for the client or the disk, and alone if it changes
+// the file system.  The disk requests it queued run, and the journal and
+// dirty blocks go out every so often, after the client has its reply.
+static void
+serve(int w)
+{
+  80623a:	55                   	push   %ebp
+  80623b:	89 e5                	mov    %esp,%ebp
+  80623d:	57                   	push   %edi
+  80623e:	56                   	push   %esi
+  80623f:	53                   	push   %ebx
+  806240:	83 ec 3c             	sub    $0x3c,%esp
+  806243:	8b 5d 08             	mov    0x8(%ebp),%ebx
+	const volatile struct Env *me = &envs[ENVX(sys_getenvid())];
+  806246:	e8 fc 12 00 00       	call   807547 <sys_getenvid>
+  80624b:	25 ff 03 00 00       	and    $0x3ff,%eax
+	union Fsipc *fsreq = (union Fsipc *) FSREQVA(w);
+  806250:	8d 53 01             	lea    0x1(%ebx),%edx
+  806253:	69 d2 00 f0 ef ff    	imul   $0xffeff000,%edx,%edx
+  806259:	8d ba 00 00 fe 0f    	lea    0xffe0000(%edx),%edi
+	void *readvva = (void *) READVVA(w);
+  80625f:	c1 e3 14             	shl    $0x14,%ebx
+  806262:	8d 8b 00 00 80 d0    	lea    -0x2f800000(%ebx),%ecx
+  806268:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+	*npages = me->env_ipc_npages;
+  80626b:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80626e:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  806271:	eb 11                	jmp    806284 <serve+0x4a>
+			cprintf("fs req %d from %08x [page %08x: %s]\n",
+				req, whom, uvpt[PGNUM(fsreq)], fsreq);
+
+		// All requests must contain an argument page
+		if (!(perm & PTE_P)) {
+			cprintf("Invalid request from %08x: no argument page\n",
+  806273:	83 ec 08             	sub    $0x8,%esp
+  806276:	56                   	push   %esi
+  806277:	68 b0 9f 80 00       	push   $0x809fb0
+  80627c:	e8 2a 09 00 00       	call   806bab <cprintf>
+				whom);
+			continue; // just leave it hanging...
+  806281:	83 c4 10             	add    $0x10,%esp
+	if (sys_ipc_recv(fsreq, *npages) < 0) {
+  806284:	83 ec 08             	sub    $0x8,%esp
+  806287:	68 01 01 00 00       	push   $0x101
+  80628c:	57                   	push   %edi
+  80628d:	e8 0e 16 00 00       	call   8078a0 <sys_ipc_recv>
+  806292:	83 c4 10             	add    $0x10,%esp
+		*npages = *whom = *perm = 0;
+  806295:	be 00 00 00 00       	mov    $0x0,%esi
+	if (sys_ipc_recv(fsreq, *npages) < 0) {
+  80629a:	85 c0                	test   %eax,%eax
+  80629c:	78 d5                	js     806273 <serve+0x39>
+	*npages = me->env_ipc_npages;
+  80629e:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8062a1:	c1 e0 04             	shl    $0x4,%eax
+  8062a4:	8b 88 74 00 c0 ee    	mov    -0x113fff8c(%eax),%ecx
+  8062aa:	89 4d d4             	mov    %ecx,-0x2c(%ebp)
+	*whom = me->env_ipc_from;
+  8062ad:	8b b0 7c 00 c0 ee    	mov    -0x113fff84(%eax),%esi
+	*perm = me->env_ipc_perm;
+  8062b3:	8b 90 80 00 c0 ee    	mov    -0x113fff80(%eax),%edx
+  8062b9:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+	return me->env_ipc_value;
+  8062bc:	8b 98 78 00 c0 ee    	mov    -0x113fff88(%eax),%ebx
+		if (!(perm & PTE_P)) {
+  8062c2:	f6 c2 01             	test   $0x1,%dl
+  8062c5:	74 ac                	je     806273 <serve+0x39>
+		}
+
+		fs_lock();
+  8062c7:	e8 55 ac ff ff       	call   800f21 <fs_lock>
+		serv_nrequests++;
+  8062cc:	83 05 e0 28 84 00 01 	addl   $0x1,0x8428e0
+		excl = !serve_shared(req);
+  8062d3:	83 fb 0c             	cmp    $0xc,%ebx
+  8062d6:	77 0e                	ja     8062e6 <serve+0xac>
+  8062d8:	b8 28 1c 00 00       	mov    $0x1c28,%eax
+  8062dd:	0f a3 d8             	bt     %ebx,%eax
+  8062e0:	0f 82 d0 00 00 00    	jb     8063b6 <serve+0x17c>
+	fs_begin(excl);
+  8062e6:	83 ec 0c             	sub    $0xc,%esp
+  8062e9:	6a 01                	push   $0x1
+  8062eb:	e8 6a ac ff ff       	call   800f5a <fs_begin>
+	if (excl && journal_full())
+  8062f0:	e8 86 c8 ff ff       	call   802b7b <journal_full>
+  8062f5:	83 c4 10             	add    $0x10,%esp
+  8062f8:	84 c0                	test   %al,%al
+  8062fa:	75 2f                	jne    80632b <serve+0xf1>
+
+		// A shared request that would allocate a block, to read a
+		// hole, gives up and runs again alone.  serve_read overwrites
+		// its request with the data, so keep that.
+		saved = fsreq->read;
+		r = serve_dispatch(whom, req, fsreq, nreq, readvva,
+  8062fc:	83 ec 0c             	sub    $0xc,%esp
+  8062ff:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  806302:	50                   	push   %eax
+  806303:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  806306:	50                   	push   %eax
+  806307:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80630a:	50                   	push   %eax
+  80630b:	ff 75 d0             	push   -0x30(%ebp)
+  80630e:	ff 75 d4             	push   -0x2c(%ebp)
+  806311:	89 f9                	mov    %edi,%ecx
+  806313:	89 da                	mov    %ebx,%edx
+  806315:	89 f0                	mov    %esi,%eax
+  806317:	e8 40 fe ff ff       	call   80615c <serve_dispatch>
+  80631c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  80631f:	83 c4 20             	add    $0x20,%esp
+		excl = !serve_shared(req);
+  806322:	c6 45 c4 01          	movb   $0x1,-0x3c(%ebp)
+  806326:	e9 d2 00 00 00       	jmp    8063fd <serve+0x1c3>
+		journal_commit();
+  80632b:	e8 69 c5 ff ff       	call   802899 <journal_commit>
+  806330:	eb ca                	jmp    8062fc <serve+0xc2>
+				   &pg, &npg, &perm);
+		if (r == -E_AGAIN && !excl) {
+			fs_end(0);
+  806332:	83 ec 0c             	sub    $0xc,%esp
+  806335:	6a 00                	push   $0x0
+  806337:	e8 6c ac ff ff       	call   800fa8 <fs_end>
+	fs_begin(excl);
+  80633c:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  806343:	e8 12 ac ff ff       	call   800f5a <fs_begin>
+	if (excl && journal_full())
+  806348:	e8 2e c8 ff ff       	call   802b7b <journal_full>
+  80634d:	83 c4 10             	add    $0x10,%esp
+  806350:	84 c0                	test   %al,%al
+  806352:	75 37                	jne    80638b <serve+0x151>
+			excl = 1;
+			serve_begin(1);
+			fsreq->read = saved;
+  806354:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+  806357:	89 07                	mov    %eax,(%edi)
+  806359:	8b 45 c0             	mov    -0x40(%ebp),%eax
+  80635c:	89 47 04             	mov    %eax,0x4(%edi)
+			r = serve_dispatch(whom, req, fsreq, nreq, readvva,
+  80635f:	83 ec 0c             	sub    $0xc,%esp
+  806362:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  806365:	50                   	push   %eax
+  806366:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  806369:	50                   	push   %eax
+  80636a:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80636d:	50                   	push   %eax
+  80636e:	ff 75 d0             	push   -0x30(%ebp)
+  806371:	ff 75 d4             	push   -0x2c(%ebp)
+  806374:	89 f9                	mov    %edi,%ecx
+  806376:	89 da                	mov    %ebx,%edx
+  806378:	89 f0                	mov    %esi,%eax
+  80637a:	e8 dd fd ff ff       	call   80615c <serve_dispatch>
+  80637f:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  806382:	83 c4 20             	add    $0x20,%esp
+			excl = 1;
+  806385:	c6 45 c4 01          	movb   $0x1,-0x3c(%ebp)
+  806389:	eb 72                	jmp    8063fd <serve+0x1c3>
+		journal_commit();
+  80638b:	e8 09 c5 ff ff       	call   802899 <journal_commit>
+  806390:	eb c2                	jmp    806354 <serve+0x11a>
+		ipc_send_pages(whom, r, pg, npg, perm);
+		fs_lock();
+
+		serve_unmap(fsreq, nreq);
+		if (pg == readvva)
+			serve_unmap(pg, npg);
+  806392:	8b 55 c0             	mov    -0x40(%ebp),%edx
+  806395:	e8 4c f2 ff ff       	call   8055e6 <serve_unmap>
+  80639a:	e9 9a 00 00 00       	jmp    806439 <serve+0x1ff>
+			fs_begin(1);
+			if (now - serv_lastwb >= BC_WRITEBACK_MS) {
+				journal_commit();
+				bc_writeback();
+				serv_lastwb = now;
+			} else if (journal_full())
+  80639f:	e8 d7 c7 ff ff       	call   802b7b <journal_full>
+  8063a4:	84 c0                	test   %al,%al
+  8063a6:	0f 84 ef 00 00 00    	je     80649b <serve+0x261>
+				journal_commit();
+  8063ac:	e8 e8 c4 ff ff       	call   802899 <journal_commit>
+  8063b1:	e9 e5 00 00 00       	jmp    80649b <serve+0x261>
+	fs_begin(excl);
+  8063b6:	83 ec 0c             	sub    $0xc,%esp
+  8063b9:	6a 00                	push   $0x0
+  8063bb:	e8 9a ab ff ff       	call   800f5a <fs_begin>
+		saved = fsreq->read;
+  8063c0:	8b 07                	mov    (%edi),%eax
+  8063c2:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+  8063c5:	8b 47 04             	mov    0x4(%edi),%eax
+  8063c8:	89 45 c0             	mov    %eax,-0x40(%ebp)
+		r = serve_dispatch(whom, req, fsreq, nreq, readvva,
+  8063cb:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8063ce:	89 04 24             	mov    %eax,(%esp)
+  8063d1:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  8063d4:	50                   	push   %eax
+  8063d5:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8063d8:	50                   	push   %eax
+  8063d9:	ff 75 d0             	push   -0x30(%ebp)
+  8063dc:	ff 75 d4             	push   -0x2c(%ebp)
+  8063df:	89 f9                	mov    %edi,%ecx
+  8063e1:	89 da                	mov    %ebx,%edx
+  8063e3:	89 f0                	mov    %esi,%eax
+  8063e5:	e8 72 fd ff ff       	call   80615c <serve_dispatch>
+  8063ea:	89 45 cc             	mov    %eax,-0x34(%ebp)
+		if (r == -E_AGAIN && !excl) {
+  8063ed:	83 c4 20             	add    $0x20,%esp
+  8063f0:	83 f8 f0             	cmp    $0xfffffff0,%eax
+  8063f3:	0f 84 39 ff ff ff    	je     806332 <serve+0xf8>
+  8063f9:	c6 45 c4 00          	movb   $0x0,-0x3c(%ebp)
+		fs_unlock();
+  8063fd:	e8 34 ab ff ff       	call   800f36 <fs_unlock>
+		ipc_send_pages(whom, r, pg, npg, perm);
+  806402:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  806405:	89 45 c0             	mov    %eax,-0x40(%ebp)
+  806408:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+  80640b:	83 ec 0c             	sub    $0xc,%esp
+  80640e:	ff 75 e4             	push   -0x1c(%ebp)
+  806411:	50                   	push   %eax
+  806412:	53                   	push   %ebx
+  806413:	ff 75 cc             	push   -0x34(%ebp)
+  806416:	56                   	push   %esi
+  806417:	e8 6c 17 00 00       	call   807b88 <ipc_send_pages>
+		fs_lock();
+  80641c:	83 c4 20             	add    $0x20,%esp
+  80641f:	e8 fd aa ff ff       	call   800f21 <fs_lock>
+		serve_unmap(fsreq, nreq);
+  806424:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+  806427:	89 f8                	mov    %edi,%eax
+  806429:	e8 b8 f1 ff ff       	call   8055e6 <serve_unmap>
+		if (pg == readvva)
+  80642e:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  806431:	39 c3                	cmp    %eax,%ebx
+  806433:	0f 84 59 ff ff ff    	je     806392 <serve+0x158>
+		bio_run();
+  806439:	e8 73 b1 ff ff       	call   8015b1 <bio_run>
+		fs_end(excl);
+  80643e:	83 ec 0c             	sub    $0xc,%esp
+  806441:	0f b6 45 c4          	movzbl -0x3c(%ebp),%eax
+  806445:	50                   	push   %eax
+  806446:	e8 5d ab ff ff       	call   800fa8 <fs_end>
+		now = sys_time_msec();
+  80644b:	e8 92 14 00 00       	call   8078e2 <sys_time_msec>
+  806450:	89 c3                	mov    %eax,%ebx
+		if (now - serv_lastwb >= BC_WRITEBACK_MS || journal_full()) {
+  806452:	2b 05 e4 28 84 00    	sub    0x8428e4,%eax
+  806458:	83 c4 10             	add    $0x10,%esp
+  80645b:	3d e7 03 00 00       	cmp    $0x3e7,%eax
+  806460:	77 09                	ja     80646b <serve+0x231>
+  806462:	e8 14 c7 ff ff       	call   802b7b <journal_full>
+  806467:	84 c0                	test   %al,%al
+  806469:	74 42                	je     8064ad <serve+0x273>
+			fs_begin(1);
+  80646b:	83 ec 0c             	sub    $0xc,%esp
+  80646e:	6a 01                	push   $0x1
+  806470:	e8 e5 aa ff ff       	call   800f5a <fs_begin>
+			if (now - serv_lastwb >= BC_WRITEBACK_MS) {
+  806475:	89 d8                	mov    %ebx,%eax
+  806477:	2b 05 e4 28 84 00    	sub    0x8428e4,%eax
+  80647d:	83 c4 10             	add    $0x10,%esp
+  806480:	3d e7 03 00 00       	cmp    $0x3e7,%eax
+  806485:	0f 86 14 ff ff ff    	jbe    80639f <serve+0x165>
+				journal_commit();
+  80648b:	e8 09 c4 ff ff       	call   802899 <journal_commit>
+				bc_writeback();
+  806490:	e8 58 b8 ff ff       	call   801ced <bc_writeback>
+				serv_lastwb = now;
+  806495:	89 1d e4 28 84 00    	mov    %ebx,0x8428e4
+			bio_run();
+  80649b:	e8 11 b1 ff ff       	call   8015b1 <bio_run>
+			fs_end(1);
+  8064a0:	83 ec 0c             	sub    $0xc,%esp
+  8064a3:	6a 01                	push   $0x1
+  8064a5:	e8 fe aa ff ff       	call   800fa8 <fs_end>
+  8064aa:	83 c4 10             	add    $0x10,%esp
+		}
+		fs_unlock();
+  8064ad:	e8 84 aa ff ff       	call   800f36 <fs_unlock>
+  8064b2:	e9 cd fd ff ff       	jmp    806284 <serve+0x4a>
+
+008064b7 <umain>:
+	}
+}
+
+void
+umain(int argc, char **argv)
+{
+  8064b7:	55                   	push   %ebp
+  8064b8:	89 e5                	mov    %esp,%ebp
+  8064ba:	56                   	push   %esi
+  8064bb:	53                   	push   %ebx
+	static_assert(sizeof(struct File) == 256);
+	binaryname = "fs";
+  8064bc:	c7 05 60 40 81 00 48 	movl   $0x809f48,0x814060
+  8064c3:	9f 80 00 
+	cprintf("FS is running\n");
+  8064c6:	83 ec 0c             	sub    $0xc,%esp
+  8064c9:	68 4b 9f 80 00       	push   $0x809f4b
+  8064ce:	e8 d8 06 00 00       	call   806bab <cprintf>
+  __asm __volatile("outw %0,%w1" : : "a" (data), "d" (port));
+  8064d3:	b8 00 8a ff ff       	mov    $0xffff8a00,%eax
+  8064d8:	ba 00 8a 00 00       	mov    $0x8a00,%edx
+  8064dd:	66 ef                	out    %ax,(%dx)
+
+	// Check that we are able to do I/O
+	outw(0x8A00, 0x8A00);
+	cprintf("FS can do I/O\n");
+  8064df:	c7 04 24 5a 9f 80 00 	movl   $0x809f5a,(%esp)
+  8064e6:	e8 c0 06 00 00       	call   806bab <cprintf>
+
+	fs_lock();
+  8064eb:	e8 31 aa ff ff       	call   800f21 <fs_lock>
+	serve_init();
+  8064f0:	e8 3a f2 ff ff       	call   80572f <serve_init>
+	fs_init();
+  8064f5:	e8 37 d8 ff ff       	call   803d31 <fs_init>
+        fs_test();
+  8064fa:	e8 f3 00 00 00       	call   8065f2 <fs_test>
+	serv_lastwb = sys_time_msec();
+  8064ff:	e8 de 13 00 00       	call   8078e2 <sys_time_msec>
+  806504:	a3 e4 28 84 00       	mov    %eax,0x8428e4
+	fs_unlock();
+  806509:	e8 28 aa ff ff       	call   800f36 <fs_unlock>
+  80650e:	83 c4 10             	add    $0x10,%esp
+  806511:	bb 00 60 00 d1       	mov    $0xd1006000,%ebx
+	for (w = 1; w < FS_NWORKERS; w++) {
+  806516:	be 01 00 00 00       	mov    $0x1,%esi
+		if ((r = sys_page_alloc(0, (void *) (WORKERSTACK(w) - PGSIZE),
+  80651b:	83 ec 04             	sub    $0x4,%esp
+  80651e:	6a 07                	push   $0x7
+  806520:	8d 83 00 f0 ff ff    	lea    -0x1000(%ebx),%eax
+  806526:	50                   	push   %eax
+  806527:	6a 00                	push   $0x0
+  806529:	e8 9a 10 00 00       	call   8075c8 <sys_page_alloc>
+  80652e:	83 c4 10             	add    $0x10,%esp
+  806531:	85 c0                	test   %eax,%eax
+  806533:	78 7e                	js     8065b3 <umain+0xfc>
+		    (r = sys_page_alloc(0, (void *) (WORKERXSTACK(w) - PGSIZE),
+  806535:	83 ec 04             	sub    $0x4,%esp
+  806538:	6a 07                	push   $0x7
+  80653a:	8d 83 00 10 00 00    	lea    0x1000(%ebx),%eax
+  806540:	50                   	push   %eax
+  806541:	6a 00                	push   $0x0
+  806543:	e8 80 10 00 00       	call   8075c8 <sys_page_alloc>
+					PTE_P | PTE_U | PTE_W)) < 0 ||
+  806548:	83 c4 10             	add    $0x10,%esp
+  80654b:	85 c0                	test   %eax,%eax
+  80654d:	78 64                	js     8065b3 <umain+0xfc>
+		*--sp = w;
+  80654f:	89 73 fc             	mov    %esi,-0x4(%ebx)
+		*--sp = 0;
+  806552:	c7 43 f8 00 00 00 00 	movl   $0x0,-0x8(%ebx)
+		if ((envid = sys_thread_create((void *) serve, sp,
+  806559:	83 ec 04             	sub    $0x4,%esp
+  80655c:	8d 83 00 20 00 00    	lea    0x2000(%ebx),%eax
+  806562:	50                   	push   %eax
+		*--sp = 0;
+  806563:	8d 43 f8             	lea    -0x8(%ebx),%eax
+		if ((envid = sys_thread_create((void *) serve, sp,
+  806566:	50                   	push   %eax
+  806567:	68 3a 62 80 00       	push   $0x80623a
+  80656c:	e8 07 12 00 00       	call   807778 <sys_thread_create>
+  806571:	83 c4 10             	add    $0x10,%esp
+  806574:	85 c0                	test   %eax,%eax
+  806576:	78 50                	js     8065c8 <umain+0x111>
+		if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  806578:	83 ec 08             	sub    $0x8,%esp
+  80657b:	6a 02                	push   $0x2
+  80657d:	50                   	push   %eax
+  80657e:	e8 36 12 00 00       	call   8077b9 <sys_env_set_status>
+  806583:	81 c3 00 40 00 00    	add    $0x4000,%ebx
+  806589:	83 c4 10             	add    $0x10,%esp
+  80658c:	85 c0                	test   %eax,%eax
+  80658e:	78 4d                	js     8065dd <umain+0x126>
+	for (w = 1; w < FS_NWORKERS; w++) {
+  806590:	83 c6 01             	add    $0x1,%esi
+  806593:	83 fe 04             	cmp    $0x4,%esi
+  806596:	75 83                	jne    80651b <umain+0x64>
+
+	serve_start();
+	cprintf("FS has %d workers\n", FS_NWORKERS);
+  806598:	83 ec 08             	sub    $0x8,%esp
+  80659b:	6a 04                	push   $0x4
+  80659d:	68 79 9f 80 00       	push   $0x809f79
+  8065a2:	e8 04 06 00 00       	call   806bab <cprintf>
+	serve(0);
+  8065a7:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8065ae:	e8 87 fc ff ff       	call   80623a <serve>
+			panic("serve_start: %e", r);
+  8065b3:	50                   	push   %eax
+  8065b4:	68 69 9f 80 00       	push   $0x809f69
+  8065b9:	68 7c 03 00 00       	push   $0x37c
+  8065be:	68 3e 9f 80 00       	push   $0x809f3e
+  8065c3:	e8 08 05 00 00       	call   806ad0 <_panic>
+			panic("serve_start: %e", envid);
+  8065c8:	50                   	push   %eax
+  8065c9:	68 69 9f 80 00       	push   $0x809f69
+  8065ce:	68 84 03 00 00       	push   $0x384
+  8065d3:	68 3e 9f 80 00       	push   $0x809f3e
+  8065d8:	e8 f3 04 00 00       	call   806ad0 <_panic>
+			panic("serve_start: %e", r);
+  8065dd:	50                   	push   %eax
+  8065de:	68 69 9f 80 00       	push   $0x809f69
+  8065e3:	68 86 03 00 00       	push   $0x386
+  8065e8:	68 3e 9f 80 00       	push   $0x809f3e
+  8065ed:	e8 de 04 00 00       	call   806ad0 <_panic>
+
+008065f2 <fs_test>:
+
+static char *msg = "This is the NEW message of the day!\n\n";
+
+void
+fs_test(void)
+{
+  8065f2:	55                   	push   %ebp
+  8065f3:	89 e5                	mov    %esp,%ebp
+  8065f5:	53                   	push   %ebx
+  8065f6:	83 ec 18             	sub    $0x18,%esp
+  int r;
+  char *blk;
+  uint32_t *bits, nfree, fblock;
+
+  // back up bitmap
+  if ((r = sys_page_alloc(0, (void*)PGSIZE, PTE_P|PTE_U|PTE_W)) < 0)
+  8065f9:	6a 07                	push   $0x7
+  8065fb:	68 00 10 00 00       	push   $0x1000
+  806600:	6a 00                	push   $0x0
+  806602:	e8 c1 0f 00 00       	call   8075c8 <sys_page_alloc>
+  806607:	83 c4 10             	add    $0x10,%esp
+  80660a:	85 c0                	test   %eax,%eax
+  80660c:	0f 88 9e 02 00 00    	js     8068b0 <fs_test+0x2be>
+    panic("sys_page_alloc: %e", r);
+  bits = (uint32_t*)PGSIZE;
+  memmove(bits, bitmap, PGSIZE);
+  806612:	83 ec 04             	sub    $0x4,%esp
+  806615:	68 00 10 00 00       	push   $0x1000
+  80661a:	ff 35 84 3f 84 00    	push   0x843f84
+  806620:	68 00 10 00 00       	push   $0x1000
+  806625:	e8 f5 0c 00 00       	call   80731f <memmove>
+  nfree = super->s_nfree;
+  80662a:	a1 88 3f 84 00       	mov    0x843f88,%eax
+  80662f:	8b 98 08 01 00 00    	mov    0x108(%eax),%ebx
+  // allocate block
+  if ((r = alloc_block()) < 0)
+  806635:	e8 30 cf ff ff       	call   80356a <alloc_block>
+  80663a:	89 c1                	mov    %eax,%ecx
+  80663c:	83 c4 10             	add    $0x10,%esp
+  80663f:	85 c0                	test   %eax,%eax
+  806641:	0f 88 7b 02 00 00    	js     8068c2 <fs_test+0x2d0>
+    panic("alloc_block: %e", r);
+  // check that block was free
+  assert(bits[r/32] & (1 << (r%32)));
+  806647:	8d 40 1f             	lea    0x1f(%eax),%eax
+  80664a:	0f 49 c1             	cmovns %ecx,%eax
+  80664d:	c1 f8 05             	sar    $0x5,%eax
+  806650:	ba 01 00 00 00       	mov    $0x1,%edx
+  806655:	d3 e2                	shl    %cl,%edx
+  806657:	89 d1                	mov    %edx,%ecx
+  806659:	23 0c 85 00 10 00 00 	and    0x1000(,%eax,4),%ecx
+  806660:	0f 84 6e 02 00 00    	je     8068d4 <fs_test+0x2e2>
+  // and is not free any more
+  assert(!(bitmap[r/32] & (1 << (r%32))));
+  806666:	8b 0d 84 3f 84 00    	mov    0x843f84,%ecx
+  80666c:	23 14 81             	and    (%ecx,%eax,4),%edx
+  80666f:	0f 85 75 02 00 00    	jne    8068ea <fs_test+0x2f8>
+  // and was counted
+  assert(super->s_nfree == nfree - 1);
+  806675:	83 eb 01             	sub    $0x1,%ebx
+  806678:	a1 88 3f 84 00       	mov    0x843f88,%eax
+  80667d:	39 98 08 01 00 00    	cmp    %ebx,0x108(%eax)
+  806683:	0f 85 77 02 00 00    	jne    806900 <fs_test+0x30e>
+  cprintf("alloc_block is good\n");
+  806689:	83 ec 0c             	sub    $0xc,%esp
+  80668c:	68 41 a0 80 00       	push   $0x80a041
+  806691:	e8 15 05 00 00       	call   806bab <cprintf>
+
+  if ((r = file_open("/not-found", &f)) < 0 && r != -E_NOT_FOUND)
+  806696:	83 c4 08             	add    $0x8,%esp
+  806699:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80669c:	50                   	push   %eax
+  80669d:	68 56 a0 80 00       	push   $0x80a056
+  8066a2:	e8 42 e8 ff ff       	call   804ee9 <file_open>
+  8066a7:	83 c4 10             	add    $0x10,%esp
+  8066aa:	85 c0                	test   %eax,%eax
+  8066ac:	0f 88 64 02 00 00    	js     806916 <fs_test+0x324>
+    panic("file_open /not-found: %e", r);
+  else if (r == 0)
+  8066b2:	0f 84 79 02 00 00    	je     806931 <fs_test+0x33f>
+    panic("file_open /not-found succeeded!");
+  if ((r = file_open("/newmotd", &f)) < 0)
+  8066b8:	83 ec 08             	sub    $0x8,%esp
+  8066bb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8066be:	50                   	push   %eax
+  8066bf:	68 7a a0 80 00       	push   $0x80a07a
+  8066c4:	e8 20 e8 ff ff       	call   804ee9 <file_open>
+  8066c9:	83 c4 10             	add    $0x10,%esp
+  8066cc:	85 c0                	test   %eax,%eax
+  8066ce:	0f 88 71 02 00 00    	js     806945 <fs_test+0x353>
+    panic("file_open /newmotd: %e", r);
+  cprintf("file_open is good\n");
+  8066d4:	83 ec 0c             	sub    $0xc,%esp
+  8066d7:	68 9a a0 80 00       	push   $0x80a09a
+  8066dc:	e8 ca 04 00 00       	call   806bab <cprintf>
+
+  if ((r = file_get_block(f, 0, &blk)) < 0)
+  8066e1:	83 c4 0c             	add    $0xc,%esp
+  8066e4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8066e7:	50                   	push   %eax
+  8066e8:	6a 00                	push   $0x0
+  8066ea:	ff 75 f4             	push   -0xc(%ebp)
+  8066ed:	e8 c4 d6 ff ff       	call   803db6 <file_get_block>
+  8066f2:	83 c4 10             	add    $0x10,%esp
+  8066f5:	85 c0                	test   %eax,%eax
+  8066f7:	0f 88 5a 02 00 00    	js     806957 <fs_test+0x365>
+    panic("file_get_block: %e", r);
+  if (strcmp(blk, msg) != 0)
+  8066fd:	83 ec 08             	sub    $0x8,%esp
+  806700:	68 c8 a1 80 00       	push   $0x80a1c8
+  806705:	ff 75 f0             	push   -0x10(%ebp)
+  806708:	e8 3d 0b 00 00       	call   80724a <strcmp>
+  80670d:	83 c4 10             	add    $0x10,%esp
+  806710:	85 c0                	test   %eax,%eax
+  806712:	0f 85 51 02 00 00    	jne    806969 <fs_test+0x377>
+    panic("file_get_block returned wrong data");
+  cprintf("file_get_block is good\n");
+  806718:	83 ec 0c             	sub    $0xc,%esp
+  80671b:	68 c0 a0 80 00       	push   $0x80a0c0
+  806720:	e8 86 04 00 00       	call   806bab <cprintf>
+
+  *(volatile char*)blk = *(volatile char*)blk;
+  806725:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  806728:	0f b6 10             	movzbl (%eax),%edx
+  80672b:	88 10                	mov    %dl,(%eax)
+  assert((uvpt[PGNUM(blk)] & PTE_D));
+  80672d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  806730:	c1 e8 0c             	shr    $0xc,%eax
+  806733:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80673a:	83 c4 10             	add    $0x10,%esp
+  80673d:	a8 40                	test   $0x40,%al
+  80673f:	0f 84 38 02 00 00    	je     80697d <fs_test+0x38b>
+  file_flush(f);
+  806745:	83 ec 0c             	sub    $0xc,%esp
+  806748:	ff 75 f4             	push   -0xc(%ebp)
+  80674b:	e8 be ed ff ff       	call   80550e <file_flush>
+  assert(!(uvpt[PGNUM(blk)] & PTE_D));
+  806750:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  806753:	c1 e8 0c             	shr    $0xc,%eax
+  806756:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80675d:	83 c4 10             	add    $0x10,%esp
+  806760:	a8 40                	test   $0x40,%al
+  806762:	0f 85 2b 02 00 00    	jne    806993 <fs_test+0x3a1>
+  cprintf("file_flush is good\n");
+  806768:	83 ec 0c             	sub    $0xc,%esp
+  80676b:	68 f4 a0 80 00       	push   $0x80a0f4
+  806770:	e8 36 04 00 00       	call   806bab <cprintf>
+
+  // Metadata changes go into the journal, not straight to disk.
+  fblock = ((uint32_t) f - DISKMAP) / BLKSIZE;
+  806775:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  806778:	8d 98 00 00 00 f0    	lea    -0x10000000(%eax),%ebx
+  80677e:	c1 eb 0c             	shr    $0xc,%ebx
+  if ((r = file_set_size(f, 0)) < 0)
+  806781:	83 c4 08             	add    $0x8,%esp
+  806784:	6a 00                	push   $0x0
+  806786:	50                   	push   %eax
+  806787:	e8 44 eb ff ff       	call   8052d0 <file_set_size>
+  80678c:	83 c4 10             	add    $0x10,%esp
+  80678f:	85 c0                	test   %eax,%eax
+  806791:	0f 88 12 02 00 00    	js     8069a9 <fs_test+0x3b7>
+    panic("file_set_size: %e", r);
+  assert(f->f_nextent == 0 && f->f_direct[0] == 0);
+  806797:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80679a:	83 b8 bc 00 00 00 00 	cmpl   $0x0,0xbc(%eax)
+  8067a1:	0f 85 14 02 00 00    	jne    8069bb <fs_test+0x3c9>
+  8067a7:	83 b8 8c 00 00 00 00 	cmpl   $0x0,0x8c(%eax)
+  8067ae:	0f 85 07 02 00 00    	jne    8069bb <fs_test+0x3c9>
+  assert(journal_running(fblock));
+  8067b4:	83 ec 0c             	sub    $0xc,%esp
+  8067b7:	53                   	push   %ebx
+  8067b8:	e8 c3 bf ff ff       	call   802780 <journal_running>
+  8067bd:	83 c4 10             	add    $0x10,%esp
+  8067c0:	84 c0                	test   %al,%al
+  8067c2:	0f 84 09 02 00 00    	je     8069d1 <fs_test+0x3df>
+  cprintf("file_truncate is good\n");
+  8067c8:	83 ec 0c             	sub    $0xc,%esp
+  8067cb:	68 32 a1 80 00       	push   $0x80a132
+  8067d0:	e8 d6 03 00 00       	call   806bab <cprintf>
+
+  if ((r = file_set_size(f, strlen(msg))) < 0)
+  8067d5:	c7 04 24 c8 a1 80 00 	movl   $0x80a1c8,(%esp)
+  8067dc:	e8 7d 09 00 00       	call   80715e <strlen>
+  8067e1:	83 c4 08             	add    $0x8,%esp
+  8067e4:	50                   	push   %eax
+  8067e5:	ff 75 f4             	push   -0xc(%ebp)
+  8067e8:	e8 e3 ea ff ff       	call   8052d0 <file_set_size>
+  8067ed:	83 c4 10             	add    $0x10,%esp
+  8067f0:	85 c0                	test   %eax,%eax
+  8067f2:	0f 88 ef 01 00 00    	js     8069e7 <fs_test+0x3f5>
+    panic("file_set_size 2: %e", r);
+  assert(journal_running(fblock));
+  8067f8:	83 ec 0c             	sub    $0xc,%esp
+  8067fb:	53                   	push   %ebx
+  8067fc:	e8 7f bf ff ff       	call   802780 <journal_running>
+  806801:	83 c4 10             	add    $0x10,%esp
+  806804:	84 c0                	test   %al,%al
+  806806:	0f 84 ed 01 00 00    	je     8069f9 <fs_test+0x407>
+  if ((r = file_get_block(f, 0, &blk)) < 0)
+  80680c:	83 ec 04             	sub    $0x4,%esp
+  80680f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  806812:	50                   	push   %eax
+  806813:	6a 00                	push   $0x0
+  806815:	ff 75 f4             	push   -0xc(%ebp)
+  806818:	e8 99 d5 ff ff       	call   803db6 <file_get_block>
+  80681d:	83 c4 10             	add    $0x10,%esp
+  806820:	85 c0                	test   %eax,%eax
+  806822:	0f 88 e7 01 00 00    	js     806a0f <fs_test+0x41d>
+    panic("file_get_block 2: %e", r);
+  strcpy(blk, msg);
+  806828:	83 ec 08             	sub    $0x8,%esp
+  80682b:	68 c8 a1 80 00       	push   $0x80a1c8
+  806830:	ff 75 f0             	push   -0x10(%ebp)
+  806833:	e8 61 09 00 00       	call   807199 <strcpy>
+  assert((uvpt[PGNUM(blk)] & PTE_D));
+  806838:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80683b:	c1 e8 0c             	shr    $0xc,%eax
+  80683e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  806845:	83 c4 10             	add    $0x10,%esp
+  806848:	a8 40                	test   $0x40,%al
+  80684a:	0f 84 d1 01 00 00    	je     806a21 <fs_test+0x42f>
+  file_flush(f);
+  806850:	83 ec 0c             	sub    $0xc,%esp
+  806853:	ff 75 f4             	push   -0xc(%ebp)
+  806856:	e8 b3 ec ff ff       	call   80550e <file_flush>
+  assert(!(uvpt[PGNUM(blk)] & PTE_D));
+  80685b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  80685e:	c1 e8 0c             	shr    $0xc,%eax
+  806861:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  806868:	83 c4 10             	add    $0x10,%esp
+  80686b:	a8 40                	test   $0x40,%al
+  80686d:	0f 85 c4 01 00 00    	jne    806a37 <fs_test+0x445>
+  assert(!journal_running(fblock) && journal_holds(fblock));
+  806873:	83 ec 0c             	sub    $0xc,%esp
+  806876:	53                   	push   %ebx
+  806877:	e8 04 bf ff ff       	call   802780 <journal_running>
+  80687c:	83 c4 10             	add    $0x10,%esp
+  80687f:	84 c0                	test   %al,%al
+  806881:	0f 85 c6 01 00 00    	jne    806a4d <fs_test+0x45b>
+  806887:	83 ec 0c             	sub    $0xc,%esp
+  80688a:	53                   	push   %ebx
+  80688b:	e8 21 bf ff ff       	call   8027b1 <journal_holds>
+  806890:	83 c4 10             	add    $0x10,%esp
+  806893:	84 c0                	test   %al,%al
+  806895:	0f 84 b2 01 00 00    	je     806a4d <fs_test+0x45b>
+  cprintf("file rewrite is good\n");
+  80689b:	83 ec 0c             	sub    $0xc,%esp
+  80689e:	68 72 a1 80 00       	push   $0x80a172
+  8068a3:	e8 03 03 00 00       	call   806bab <cprintf>
+}
+  8068a8:	83 c4 10             	add    $0x10,%esp
+  8068ab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8068ae:	c9                   	leave
+  8068af:	c3                   	ret
+    panic("sys_page_alloc: %e", r);
+  8068b0:	50                   	push   %eax
+  8068b1:	68 dd 9f 80 00       	push   $0x809fdd
+  8068b6:	6a 12                	push   $0x12
+  8068b8:	68 f0 9f 80 00       	push   $0x809ff0
+  8068bd:	e8 0e 02 00 00       	call   806ad0 <_panic>
+    panic("alloc_block: %e", r);
+  8068c2:	50                   	push   %eax
+  8068c3:	68 fa 9f 80 00       	push   $0x809ffa
+  8068c8:	6a 18                	push   $0x18
+  8068ca:	68 f0 9f 80 00       	push   $0x809ff0
+  8068cf:	e8 fc 01 00 00       	call   806ad0 <_panic>
+  assert(bits[r/32] & (1 << (r%32)));
+  8068d4:	68 0a a0 80 00       	push   $0x80a00a
+  8068d9:	68 2e 99 80 00       	push   $0x80992e
+  8068de:	6a 1a                	push   $0x1a
+  8068e0:	68 f0 9f 80 00       	push   $0x809ff0
+  8068e5:	e8 e6 01 00 00       	call   806ad0 <_panic>
+  assert(!(bitmap[r/32] & (1 << (r%32))));
+  8068ea:	68 88 a1 80 00       	push   $0x80a188
+  8068ef:	68 2e 99 80 00       	push   $0x80992e
+  8068f4:	6a 1c                	push   $0x1c
+  8068f6:	68 f0 9f 80 00       	push   $0x809ff0
+  8068fb:	e8 d0 01 00 00       	call   806ad0 <_panic>
+  assert(super->s_nfree == nfree - 1);
+  806900:	68 25 a0 80 00       	push   $0x80a025
+  806905:	68 2e 99 80 00       	push   $0x80992e
+  80690a:	6a 1e                	push   $0x1e
+  80690c:	68 f0 9f 80 00       	push   $0x809ff0
+  806911:	e8 ba 01 00 00       	call   806ad0 <_panic>
+  if ((r = file_open("/not-found", &f)) < 0 && r != -E_NOT_FOUND)
+  806916:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  806919:	0f 84 99 fd ff ff    	je     8066b8 <fs_test+0xc6>
+    panic("file_open /not-found: %e", r);
+  80691f:	50                   	push   %eax
+  806920:	68 61 a0 80 00       	push   $0x80a061
+  806925:	6a 22                	push   $0x22
+  806927:	68 f0 9f 80 00       	push   $0x809ff0
+  80692c:	e8 9f 01 00 00       	call   806ad0 <_panic>
+    panic("file_open /not-found succeeded!");
+  806931:	83 ec 04             	sub    $0x4,%esp
+  806934:	68 a8 a1 80 00       	push   $0x80a1a8
+  806939:	6a 24                	push   $0x24
+  80693b:	68 f0 9f 80 00       	push   $0x809ff0
+  806940:	e8 8b 01 00 00       	call   806ad0 <_panic>
+    panic("file_open /newmotd: %e", r);
+  806945:	50                   	push   %eax
+  806946:	68 83 a0 80 00       	push   $0x80a083
+  80694b:	6a 26                	push   $0x26
+  80694d:	68 f0 9f 80 00       	push   $0x809ff0
+  806952:	e8 79 01 00 00       	call   806ad0 <_panic>
+    panic("file_get_block: %e", r);
+  806957:	50                   	push   %eax
+  806958:	68 ad a0 80 00       	push   $0x80a0ad
+  80695d:	6a 2a                	push   $0x2a
+  80695f:	68 f0 9f 80 00       	push   $0x809ff0
+  806964:	e8 67 01 00 00       	call   806ad0 <_panic>
+    panic("file_get_block returned wrong data");
+  806969:	83 ec 04             	sub    $0x4,%esp
+  80696c:	68 f0 a1 80 00       	push   $0x80a1f0
+  806971:	6a 2c                	push   $0x2c
+  806973:	68 f0 9f 80 00       	push   $0x809ff0
+  806978:	e8 53 01 00 00       	call   806ad0 <_panic>
+  assert((uvpt[PGNUM(blk)] & PTE_D));
+  80697d:	68 d9 a0 80 00       	push   $0x80a0d9
+  806982:	68 2e 99 80 00       	push   $0x80992e
+  806987:	6a 30                	push   $0x30
+  806989:	68 f0 9f 80 00       	push   $0x809ff0
+  80698e:	e8 3d 01 00 00       	call   806ad0 <_panic>
+  assert(!(uvpt[PGNUM(blk)] & PTE_D));
+  806993:	68 d8 a0 80 00       	push   $0x80a0d8
+  806998:	68 2e 99 80 00       	push   $0x80992e
+  80699d:	6a 32                	push   $0x32
+  80699f:	68 f0 9f 80 00       	push   $0x809ff0
+  8069a4:	e8 27 01 00 00       	call   806ad0 <_panic>
+    panic("file_set_size: %e", r);
+  8069a9:	50                   	push   %eax
+  8069aa:	68 08 a1 80 00       	push   $0x80a108
+  8069af:	6a 38                	push   $0x38
+  8069b1:	68 f0 9f 80 00       	push   $0x809ff0
+  8069b6:	e8 15 01 00 00       	call   806ad0 <_panic>
+  assert(f->f_nextent == 0 && f->f_direct[0] == 0);
+  8069bb:	68 14 a2 80 00       	push   $0x80a214
+  8069c0:	68 2e 99 80 00       	push   $0x80992e
+  8069c5:	6a 39                	push   $0x39
+  8069c7:	68 f0 9f 80 00       	push   $0x809ff0
+  8069cc:	e8 ff 00 00 00       	call   806ad0 <_panic>
+  assert(journal_running(fblock));
+  8069d1:	68 1a a1 80 00       	push   $0x80a11a
+  8069d6:	68 2e 99 80 00       	push   $0x80992e
+  8069db:	6a 3a                	push   $0x3a
+  8069dd:	68 f0 9f 80 00       	push   $0x809ff0
+  8069e2:	e8 e9 00 00 00       	call   806ad0 <_panic>
+    panic("file_set_size 2: %e", r);
+  8069e7:	50                   	push   %eax
+  8069e8:	68 49 a1 80 00       	push   $0x80a149
+  8069ed:	6a 3e                	push   $0x3e
+  8069ef:	68 f0 9f 80 00       	push   $0x809ff0
+  8069f4:	e8 d7 00 00 00       	call   806ad0 <_panic>
+  assert(journal_running(fblock));
+  8069f9:	68 1a a1 80 00       	push   $0x80a11a
+  8069fe:	68 2e 99 80 00       	push   $0x80992e
+  806a03:	6a 3f                	push   $0x3f
+  806a05:	68 f0 9f 80 00       	push   $0x809ff0
+  806a0a:	e8 c1 00 00 00       	call   806ad0 <_panic>
+    panic("file_get_block 2: %e", r);
+  806a0f:	50                   	push   %eax
+  806a10:	68 5d a1 80 00       	push   $0x80a15d
+  806a15:	6a 41                	push   $0x41
+  806a17:	68 f0 9f 80 00       	push   $0x809ff0
+  806a1c:	e8 af 00 00 00       	call   806ad0 <_panic>
+  assert((uvpt[PGNUM(blk)] & PTE_D));
+  806a21:	68 d9 a0 80 00       	push   $0x80a0d9
+  806a26:	68 2e 99 80 00       	push   $0x80992e
+  806a2b:	6a 43                	push   $0x43
+  806a2d:	68 f0 9f 80 00       	push   $0x809ff0
+  806a32:	e8 99 00 00 00       	call   806ad0 <_panic>
+  assert(!(uvpt[PGNUM(blk)] & PTE_D));
+  806a37:	68 d8 a0 80 00       	push   $0x80a0d8
+  806a3c:	68 2e 99 80 00       	push   $0x80992e
+  806a41:	6a 45                	push   $0x45
+  806a43:	68 f0 9f 80 00       	push   $0x809ff0
+  806a48:	e8 83 00 00 00       	call   806ad0 <_panic>
+  assert(!journal_running(fblock) && journal_holds(fblock));
+  806a4d:	68 40 a2 80 00       	push   $0x80a240
+  806a52:	68 2e 99 80 00       	push   $0x80992e
+  806a57:	6a 46                	push   $0x46
+  806a59:	68 f0 9f 80 00       	push   $0x809ff0
+  806a5e:	e8 6d 00 00 00       	call   806ad0 <_panic>
+
+00806a63 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  806a63:	55                   	push   %ebp
+  806a64:	89 e5                	mov    %esp,%ebp
+  806a66:	56                   	push   %esi
+  806a67:	53                   	push   %ebx
+  806a68:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  806a6b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  806a6e:	c7 05 8c 3f 84 00 00 	movl   $0x0,0x843f8c
+  806a75:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  806a78:	e8 ca 0a 00 00       	call   807547 <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  806a7d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  806a82:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  806a85:	c1 e0 04             	shl    $0x4,%eax
+  806a88:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  806a8d:	a3 8c 3f 84 00       	mov    %eax,0x843f8c
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  806a92:	85 db                	test   %ebx,%ebx
+  806a94:	7e 07                	jle    806a9d <libmain+0x3a>
+    binaryname = argv[0];
+  806a96:	8b 06                	mov    (%esi),%eax
+  806a98:	a3 60 40 81 00       	mov    %eax,0x814060
+
+  // call user main routine
+  umain(argc, argv);
+  806a9d:	83 ec 08             	sub    $0x8,%esp
+  806aa0:	56                   	push   %esi
+  806aa1:	53                   	push   %ebx
+  806aa2:	e8 10 fa ff ff       	call   8064b7 <umain>
+
+  // exit gracefully
+  exit();
+  806aa7:	e8 0a 00 00 00       	call   806ab6 <exit>
+}
+  806aac:	83 c4 10             	add    $0x10,%esp
+  806aaf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  806ab2:	5b                   	pop    %ebx
+  806ab3:	5e                   	pop    %esi
+  806ab4:	5d                   	pop    %ebp
+  806ab5:	c3                   	ret
+
+00806ab6 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  806ab6:	55                   	push   %ebp
+  806ab7:	89 e5                	mov    %esp,%ebp
+  806ab9:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  806abc:	e8 50 13 00 00       	call   807e11 <close_all>
+  sys_env_destroy(0);
+  806ac1:	83 ec 0c             	sub    $0xc,%esp
+  806ac4:	6a 00                	push   $0x0
+  806ac6:	e8 3b 0a 00 00       	call   807506 <sys_env_destroy>
+}
+  806acb:	83 c4 10             	add    $0x10,%esp
+  806ace:	c9                   	leave
+  806acf:	c3                   	ret
+
+00806ad0 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  806ad0:	55                   	push   %ebp
+  806ad1:	89 e5                	mov    %esp,%ebp
+  806ad3:	56                   	push   %esi
+  806ad4:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  806ad5:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  806ad8:	8b 35 60 40 81 00    	mov    0x814060,%esi
+  806ade:	e8 64 0a 00 00       	call   807547 <sys_getenvid>
+  806ae3:	83 ec 0c             	sub    $0xc,%esp
+  806ae6:	ff 75 0c             	push   0xc(%ebp)
+  806ae9:	ff 75 08             	push   0x8(%ebp)
+  806aec:	56                   	push   %esi
+  806aed:	50                   	push   %eax
+  806aee:	68 7c a2 80 00       	push   $0x80a27c
+  806af3:	e8 b3 00 00 00       	call   806bab <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  806af8:	83 c4 18             	add    $0x18,%esp
+  806afb:	53                   	push   %ebx
+  806afc:	ff 75 10             	push   0x10(%ebp)
+  806aff:	e8 56 00 00 00       	call   806b5a <vcprintf>
+  cprintf("\n");
+  806b04:	c7 04 24 3f 9c 80 00 	movl   $0x809c3f,(%esp)
+  806b0b:	e8 9b 00 00 00       	call   806bab <cprintf>
+  806b10:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  806b13:	cc                   	int3
+  while (1)
+  806b14:	eb fd                	jmp    806b13 <_panic+0x43>
+
+00806b16 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  806b16:	55                   	push   %ebp
+  806b17:	89 e5                	mov    %esp,%ebp
+  806b19:	53                   	push   %ebx
+  806b1a:	83 ec 04             	sub    $0x4,%esp
+  806b1d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  806b20:	8b 13                	mov    (%ebx),%edx
+  806b22:	8d 42 01             	lea    0x1(%edx),%eax
+  806b25:	89 03                	mov    %eax,(%ebx)
+  806b27:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  806b2a:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  806b2e:	3d ff 00 00 00       	cmp    $0xff,%eax
+  806b33:	74 09                	je     806b3e <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  806b35:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  806b39:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  806b3c:	c9                   	leave
+  806b3d:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  806b3e:	83 ec 08             	sub    $0x8,%esp
+  806b41:	68 ff 00 00 00       	push   $0xff
+  806b46:	8d 43 08             	lea    0x8(%ebx),%eax
+  806b49:	50                   	push   %eax
+  806b4a:	e8 7a 09 00 00       	call   8074c9 <sys_cputs>
+    b->idx = 0;
+  806b4f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  806b55:	83 c4 10             	add    $0x10,%esp
+  806b58:	eb db                	jmp    806b35 <putch+0x1f>
+
+00806b5a <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  806b5a:	55                   	push   %ebp
+  806b5b:	89 e5                	mov    %esp,%ebp
+  806b5d:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  806b63:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  806b6a:	00 00 00 
+  b.cnt = 0;
+  806b6d:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  806b74:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  806b77:	ff 75 0c             	push   0xc(%ebp)
+  806b7a:	ff 75 08             	push   0x8(%ebp)
+  806b7d:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  806b83:	50                   	push   %eax
+  806b84:	68 16 6b 80 00       	push   $0x806b16
+  806b89:	e8 14 01 00 00       	call   806ca2 <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  806b8e:	83 c4 08             	add    $0x8,%esp
+  806b91:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  806b97:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  806b9d:	50                   	push   %eax
+  806b9e:	e8 26 09 00 00       	call   8074c9 <sys_cputs>
+
+  return b.cnt;
+}
+  806ba3:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  806ba9:	c9                   	leave
+  806baa:	c3                   	ret
+
+00806bab <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  806bab:	55                   	push   %ebp
+  806bac:	89 e5                	mov    %esp,%ebp
+  806bae:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  806bb1:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  806bb4:	50                   	push   %eax
+  806bb5:	ff 75 08             	push   0x8(%ebp)
+  806bb8:	e8 9d ff ff ff       	call   806b5a <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  806bbd:	c9                   	leave
+  806bbe:	c3                   	ret
+
+00806bbf <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  806bbf:	55                   	push   %ebp
+  806bc0:	89 e5                	mov    %esp,%ebp
+  806bc2:	57                   	push   %edi
+  806bc3:	56                   	push   %esi
+  806bc4:	53                   	push   %ebx
+  806bc5:	83 ec 1c             	sub    $0x1c,%esp
+  806bc8:	89 c7                	mov    %eax,%edi
+  806bca:	89 d6                	mov    %edx,%esi
+  806bcc:	8b 45 08             	mov    0x8(%ebp),%eax
+  806bcf:	8b 55 0c             	mov    0xc(%ebp),%edx
+  806bd2:	89 d1                	mov    %edx,%ecx
+  806bd4:	89 c2                	mov    %eax,%edx
+  806bd6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  806bd9:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  806bdc:	8b 45 10             	mov    0x10(%ebp),%eax
+  806bdf:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  806be2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  806be5:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  806bec:	39 c2                	cmp    %eax,%edx
+  806bee:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  806bf1:	72 3e                	jb     806c31 <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  806bf3:	83 ec 0c             	sub    $0xc,%esp
+  806bf6:	ff 75 18             	push   0x18(%ebp)
+  806bf9:	83 eb 01             	sub    $0x1,%ebx
+  806bfc:	53                   	push   %ebx
+  806bfd:	50                   	push   %eax
+  806bfe:	83 ec 08             	sub    $0x8,%esp
+  806c01:	ff 75 e4             	push   -0x1c(%ebp)
+  806c04:	ff 75 e0             	push   -0x20(%ebp)
+  806c07:	ff 75 dc             	push   -0x24(%ebp)
+  806c0a:	ff 75 d8             	push   -0x28(%ebp)
+  806c0d:	e8 48 2b 00 00       	call   80975a <__udivdi3>
+  806c12:	83 c4 18             	add    $0x18,%esp
+  806c15:	52                   	push   %edx
+  806c16:	50                   	push   %eax
+  806c17:	89 f2                	mov    %esi,%edx
+  806c19:	89 f8                	mov    %edi,%eax
+  806c1b:	e8 9f ff ff ff       	call   806bbf <printnum>
+  806c20:	83 c4 20             	add    $0x20,%esp
+  806c23:	eb 13                	jmp    806c38 <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  806c25:	83 ec 08             	sub    $0x8,%esp
+  806c28:	56                   	push   %esi
+  806c29:	ff 75 18             	push   0x18(%ebp)
+  806c2c:	ff d7                	call   *%edi
+  806c2e:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  806c31:	83 eb 01             	sub    $0x1,%ebx
+  806c34:	85 db                	test   %ebx,%ebx
+  806c36:	7f ed                	jg     806c25 <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  806c38:	83 ec 08             	sub    $0x8,%esp
+  806c3b:	56                   	push   %esi
+  806c3c:	83 ec 04             	sub    $0x4,%esp
+  806c3f:	ff 75 e4             	push   -0x1c(%ebp)
+  806c42:	ff 75 e0             	push   -0x20(%ebp)
+  806c45:	ff 75 dc             	push   -0x24(%ebp)
+  806c48:	ff 75 d8             	push   -0x28(%ebp)
+  806c4b:	e8 2b 2b 00 00       	call   80977b <__umoddi3>
+  806c50:	83 c4 14             	add    $0x14,%esp
+  806c53:	0f be 80 9f a2 80 00 	movsbl 0x80a29f(%eax),%eax
+  806c5a:	50                   	push   %eax
+  806c5b:	ff d7                	call   *%edi
+}
+  806c5d:	83 c4 10             	add    $0x10,%esp
+  806c60:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  806c63:	5b                   	pop    %ebx
+  806c64:	5e                   	pop    %esi
+  806c65:	5f                   	pop    %edi
+  806c66:	5d                   	pop    %ebp
+  806c67:	c3                   	ret
+
+00806c68 <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  806c68:	55                   	push   %ebp
+  806c69:	89 e5                	mov    %esp,%ebp
+  806c6b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  806c6e:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  806c72:	8b 10                	mov    (%eax),%edx
+  806c74:	3b 50 04             	cmp    0x4(%eax),%edx
+  806c77:	73 0a                	jae    806c83 <sprintputch+0x1b>
+    *b->buf++ = ch;
+  806c79:	8d 4a 01             	lea    0x1(%edx),%ecx
+  806c7c:	89 08                	mov    %ecx,(%eax)
+  806c7e:	8b 45 08             	mov    0x8(%ebp),%eax
+  806c81:	88 02                	mov    %al,(%edx)
+}
+  806c83:	5d                   	pop    %ebp
+  806c84:	c3                   	ret
+
+00806c85 <printfmt>:
+{
+  806c85:	55                   	push   %ebp
+  806c86:	89 e5                	mov    %esp,%ebp
+  806c88:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  806c8b:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  806c8e:	50                   	push   %eax
+  806c8f:	ff 75 10             	push   0x10(%ebp)
+  806c92:	ff 75 0c             	push   0xc(%ebp)
+  806c95:	ff 75 08             	push   0x8(%ebp)
+  806c98:	e8 05 00 00 00       	call   806ca2 <vprintfmt>
+}
+  806c9d:	83 c4 10             	add    $0x10,%esp
+  806ca0:	c9                   	leave
+  806ca1:	c3                   	ret
+
+00806ca2 <vprintfmt>:
+{
+  806ca2:	55                   	push   %ebp
+  806ca3:	89 e5                	mov    %esp,%ebp
+  806ca5:	57                   	push   %edi
+  806ca6:	56                   	push   %esi
+  806ca7:	53                   	push   %ebx
+  806ca8:	83 ec 2c             	sub    $0x2c,%esp
+  806cab:	8b 75 08             	mov    0x8(%ebp),%esi
+  806cae:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  806cb1:	8b 7d 10             	mov    0x10(%ebp),%edi
+  806cb4:	eb 0a                	jmp    806cc0 <vprintfmt+0x1e>
+      putch(ch, putdat);
+  806cb6:	83 ec 08             	sub    $0x8,%esp
+  806cb9:	53                   	push   %ebx
+  806cba:	50                   	push   %eax
+  806cbb:	ff d6                	call   *%esi
+  806cbd:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  806cc0:	83 c7 01             	add    $0x1,%edi
+  806cc3:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  806cc7:	83 f8 25             	cmp    $0x25,%eax
+  806cca:	74 0c                	je     806cd8 <vprintfmt+0x36>
+      if (ch == '\0')
+  806ccc:	85 c0                	test   %eax,%eax
+  806cce:	75 e6                	jne    806cb6 <vprintfmt+0x14>
+}
+  806cd0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  806cd3:	5b                   	pop    %ebx
+  806cd4:	5e                   	pop    %esi
+  806cd5:	5f                   	pop    %edi
+  806cd6:	5d                   	pop    %ebp
+  806cd7:	c3                   	ret
+    padc = ' ';
+  806cd8:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  806cdc:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  806ce3:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  806cea:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  806cf1:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  806cf6:	8d 47 01             	lea    0x1(%edi),%eax
+  806cf9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  806cfc:	0f b6 17             	movzbl (%edi),%edx
+  806cff:	8d 42 dd             	lea    -0x23(%edx),%eax
+  806d02:	3c 55                	cmp    $0x55,%al
+  806d04:	0f 87 cf 03 00 00    	ja     8070d9 <vprintfmt+0x437>
+  806d0a:	0f b6 c0             	movzbl %al,%eax
+  806d0d:	ff 24 85 e0 a3 80 00 	jmp    *0x80a3e0(,%eax,4)
+  806d14:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  806d17:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  806d1b:	eb d9                	jmp    806cf6 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  806d1d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  806d20:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  806d24:	eb d0                	jmp    806cf6 <vprintfmt+0x54>
+  806d26:	0f b6 d2             	movzbl %dl,%edx
+  806d29:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  806d2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  806d31:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  806d34:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  806d37:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  806d3b:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  806d3e:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  806d41:	83 f9 09             	cmp    $0x9,%ecx
+  806d44:	77 55                	ja     806d9b <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  806d46:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  806d49:	eb e9                	jmp    806d34 <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  806d4b:	8b 45 14             	mov    0x14(%ebp),%eax
+  806d4e:	8b 00                	mov    (%eax),%eax
+  806d50:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  806d53:	8b 45 14             	mov    0x14(%ebp),%eax
+  806d56:	8d 40 04             	lea    0x4(%eax),%eax
+  806d59:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  806d5c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  806d5f:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  806d63:	79 91                	jns    806cf6 <vprintfmt+0x54>
+        width = precision, precision = -1;
+  806d65:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  806d68:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  806d6b:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  806d72:	eb 82                	jmp    806cf6 <vprintfmt+0x54>
+      if (width < 0)
+  806d74:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  806d77:	85 d2                	test   %edx,%edx
+  806d79:	b8 00 00 00 00       	mov    $0x0,%eax
+  806d7e:	0f 49 c2             	cmovns %edx,%eax
+  806d81:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  806d84:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  806d87:	e9 6a ff ff ff       	jmp    806cf6 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  806d8c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  806d8f:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  806d96:	e9 5b ff ff ff       	jmp    806cf6 <vprintfmt+0x54>
+  806d9b:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  806d9e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  806da1:	eb bc                	jmp    806d5f <vprintfmt+0xbd>
+      lflag++;
+  806da3:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  806da6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  806da9:	e9 48 ff ff ff       	jmp    806cf6 <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  806dae:	8b 45 14             	mov    0x14(%ebp),%eax
+  806db1:	8d 78 04             	lea    0x4(%eax),%edi
+  806db4:	83 ec 08             	sub    $0x8,%esp
+  806db7:	53                   	push   %ebx
+  806db8:	ff 30                	push   (%eax)
+  806dba:	ff d6                	call   *%esi
+      break;
+  806dbc:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  806dbf:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  806dc2:	e9 b1 02 00 00       	jmp    807078 <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  806dc7:	8b 45 14             	mov    0x14(%ebp),%eax
+  806dca:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  806dcd:	8b 10                	mov    (%eax),%edx
+  806dcf:	89 d0                	mov    %edx,%eax
+  806dd1:	f7 d8                	neg    %eax
+  806dd3:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  806dd6:	83 f8 10             	cmp    $0x10,%eax
+  806dd9:	7f 23                	jg     806dfe <vprintfmt+0x15c>
+  806ddb:	8b 14 85 40 a5 80 00 	mov    0x80a540(,%eax,4),%edx
+  806de2:	85 d2                	test   %edx,%edx
+  806de4:	74 18                	je     806dfe <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  806de6:	52                   	push   %edx
+  806de7:	68 40 99 80 00       	push   $0x809940
+  806dec:	53                   	push   %ebx
+  806ded:	56                   	push   %esi
+  806dee:	e8 92 fe ff ff       	call   806c85 <printfmt>
+  806df3:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  806df6:	89 7d 14             	mov    %edi,0x14(%ebp)
+  806df9:	e9 7a 02 00 00       	jmp    807078 <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  806dfe:	50                   	push   %eax
+  806dff:	68 b7 a2 80 00       	push   $0x80a2b7
+  806e04:	53                   	push   %ebx
+  806e05:	56                   	push   %esi
+  806e06:	e8 7a fe ff ff       	call   806c85 <printfmt>
+  806e0b:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  806e0e:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  806e11:	e9 62 02 00 00       	jmp    807078 <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  806e16:	8b 45 14             	mov    0x14(%ebp),%eax
+  806e19:	83 c0 04             	add    $0x4,%eax
+  806e1c:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  806e1f:	8b 45 14             	mov    0x14(%ebp),%eax
+  806e22:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  806e24:	85 c9                	test   %ecx,%ecx
+  806e26:	b8 b0 a2 80 00       	mov    $0x80a2b0,%eax
+  806e2b:	0f 45 c1             	cmovne %ecx,%eax
+  806e2e:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  806e31:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  806e35:	7e 06                	jle    806e3d <vprintfmt+0x19b>
+  806e37:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  806e3b:	75 0b                	jne    806e48 <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  806e3d:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  806e40:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  806e43:	89 75 08             	mov    %esi,0x8(%ebp)
+  806e46:	eb 5c                	jmp    806ea4 <vprintfmt+0x202>
+  806e48:	83 ec 08             	sub    $0x8,%esp
+  806e4b:	ff 75 d0             	push   -0x30(%ebp)
+  806e4e:	ff 75 cc             	push   -0x34(%ebp)
+  806e51:	e8 20 03 00 00       	call   807176 <strnlen>
+  806e56:	89 c2                	mov    %eax,%edx
+  806e58:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  806e5b:	29 d0                	sub    %edx,%eax
+  806e5d:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  806e60:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  806e64:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  806e67:	89 75 08             	mov    %esi,0x8(%ebp)
+  806e6a:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  806e6c:	eb 0e                	jmp    806e7c <vprintfmt+0x1da>
+          putch(padc, putdat);
+  806e6e:	83 ec 08             	sub    $0x8,%esp
+  806e71:	53                   	push   %ebx
+  806e72:	57                   	push   %edi
+  806e73:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  806e76:	83 ee 01             	sub    $0x1,%esi
+  806e79:	83 c4 10             	add    $0x10,%esp
+  806e7c:	85 f6                	test   %esi,%esi
+  806e7e:	7f ee                	jg     806e6e <vprintfmt+0x1cc>
+  806e80:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  806e83:	8b 75 08             	mov    0x8(%ebp),%esi
+  806e86:	85 c0                	test   %eax,%eax
+  806e88:	ba 00 00 00 00       	mov    $0x0,%edx
+  806e8d:	0f 49 d0             	cmovns %eax,%edx
+  806e90:	29 d0                	sub    %edx,%eax
+  806e92:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  806e95:	eb a6                	jmp    806e3d <vprintfmt+0x19b>
+          putch(ch, putdat);
+  806e97:	83 ec 08             	sub    $0x8,%esp
+  806e9a:	53                   	push   %ebx
+  806e9b:	52                   	push   %edx
+  806e9c:	ff 55 08             	call   *0x8(%ebp)
+  806e9f:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  806ea2:	89 f1                	mov    %esi,%ecx
+  806ea4:	8d 71 01             	lea    0x1(%ecx),%esi
+  806ea7:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  806eab:	0f be d0             	movsbl %al,%edx
+  806eae:	85 d2                	test   %edx,%edx
+  806eb0:	74 28                	je     806eda <vprintfmt+0x238>
+  806eb2:	85 ff                	test   %edi,%edi
+  806eb4:	78 05                	js     806ebb <vprintfmt+0x219>
+  806eb6:	83 ef 01             	sub    $0x1,%edi
+  806eb9:	78 30                	js     806eeb <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  806ebb:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  806ebf:	74 d6                	je     806e97 <vprintfmt+0x1f5>
+  806ec1:	0f be c0             	movsbl %al,%eax
+  806ec4:	83 e8 20             	sub    $0x20,%eax
+  806ec7:	83 f8 5e             	cmp    $0x5e,%eax
+  806eca:	76 cb                	jbe    806e97 <vprintfmt+0x1f5>
+          putch('?', putdat);
+  806ecc:	83 ec 08             	sub    $0x8,%esp
+  806ecf:	53                   	push   %ebx
+  806ed0:	6a 3f                	push   $0x3f
+  806ed2:	ff 55 08             	call   *0x8(%ebp)
+  806ed5:	83 c4 10             	add    $0x10,%esp
+  806ed8:	eb c8                	jmp    806ea2 <vprintfmt+0x200>
+  806eda:	8b 75 08             	mov    0x8(%ebp),%esi
+  806edd:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  806ee0:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  806ee3:	01 d0                	add    %edx,%eax
+  806ee5:	29 c8                	sub    %ecx,%eax
+  806ee7:	89 c7                	mov    %eax,%edi
+  806ee9:	eb 13                	jmp    806efe <vprintfmt+0x25c>
+  806eeb:	8b 75 08             	mov    0x8(%ebp),%esi
+  806eee:	eb ed                	jmp    806edd <vprintfmt+0x23b>
+        putch(' ', putdat);
+  806ef0:	83 ec 08             	sub    $0x8,%esp
+  806ef3:	53                   	push   %ebx
+  806ef4:	6a 20                	push   $0x20
+  806ef6:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  806ef8:	83 ef 01             	sub    $0x1,%edi
+  806efb:	83 c4 10             	add    $0x10,%esp
+  806efe:	85 ff                	test   %edi,%edi
+  806f00:	7f ee                	jg     806ef0 <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  806f02:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  806f05:	89 45 14             	mov    %eax,0x14(%ebp)
+  806f08:	e9 6b 01 00 00       	jmp    807078 <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  806f0d:	83 f9 01             	cmp    $0x1,%ecx
+  806f10:	7f 1f                	jg     806f31 <vprintfmt+0x28f>
+  else if (lflag)
+  806f12:	85 c9                	test   %ecx,%ecx
+  806f14:	74 67                	je     806f7d <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  806f16:	8b 45 14             	mov    0x14(%ebp),%eax
+  806f19:	8b 00                	mov    (%eax),%eax
+  806f1b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  806f1e:	89 c1                	mov    %eax,%ecx
+  806f20:	c1 f9 1f             	sar    $0x1f,%ecx
+  806f23:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  806f26:	8b 45 14             	mov    0x14(%ebp),%eax
+  806f29:	8d 40 04             	lea    0x4(%eax),%eax
+  806f2c:	89 45 14             	mov    %eax,0x14(%ebp)
+  806f2f:	eb 17                	jmp    806f48 <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  806f31:	8b 45 14             	mov    0x14(%ebp),%eax
+  806f34:	8b 50 04             	mov    0x4(%eax),%edx
+  806f37:	8b 00                	mov    (%eax),%eax
+  806f39:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  806f3c:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  806f3f:	8b 45 14             	mov    0x14(%ebp),%eax
+  806f42:	8d 40 08             	lea    0x8(%eax),%eax
+  806f45:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  806f48:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  806f4b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  806f4e:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  806f53:	85 c9                	test   %ecx,%ecx
+  806f55:	0f 89 03 01 00 00    	jns    80705e <vprintfmt+0x3bc>
+        putch('-', putdat);
+  806f5b:	83 ec 08             	sub    $0x8,%esp
+  806f5e:	53                   	push   %ebx
+  806f5f:	6a 2d                	push   $0x2d
+  806f61:	ff d6                	call   *%esi
+        num = -(long long)num;
+  806f63:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  806f66:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  806f69:	f7 da                	neg    %edx
+  806f6b:	83 d1 00             	adc    $0x0,%ecx
+  806f6e:	f7 d9                	neg    %ecx
+  806f70:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  806f73:	bf 0a 00 00 00       	mov    $0xa,%edi
+  806f78:	e9 e1 00 00 00       	jmp    80705e <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  806f7d:	8b 45 14             	mov    0x14(%ebp),%eax
+  806f80:	8b 00                	mov    (%eax),%eax
+  806f82:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  806f85:	89 c1                	mov    %eax,%ecx
+  806f87:	c1 f9 1f             	sar    $0x1f,%ecx
+  806f8a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  806f8d:	8b 45 14             	mov    0x14(%ebp),%eax
+  806f90:	8d 40 04             	lea    0x4(%eax),%eax
+  806f93:	89 45 14             	mov    %eax,0x14(%ebp)
+  806f96:	eb b0                	jmp    806f48 <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  806f98:	83 f9 01             	cmp    $0x1,%ecx
+  806f9b:	7f 1e                	jg     806fbb <vprintfmt+0x319>
+  else if (lflag)
+  806f9d:	85 c9                	test   %ecx,%ecx
+  806f9f:	74 32                	je     806fd3 <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  806fa1:	8b 45 14             	mov    0x14(%ebp),%eax
+  806fa4:	8b 10                	mov    (%eax),%edx
+  806fa6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  806fab:	8d 40 04             	lea    0x4(%eax),%eax
+  806fae:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  806fb1:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  806fb6:	e9 a3 00 00 00       	jmp    80705e <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  806fbb:	8b 45 14             	mov    0x14(%ebp),%eax
+  806fbe:	8b 10                	mov    (%eax),%edx
+  806fc0:	8b 48 04             	mov    0x4(%eax),%ecx
+  806fc3:	8d 40 08             	lea    0x8(%eax),%eax
+  806fc6:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  806fc9:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  806fce:	e9 8b 00 00 00       	jmp    80705e <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  806fd3:	8b 45 14             	mov    0x14(%ebp),%eax
+  806fd6:	8b 10                	mov    (%eax),%edx
+  806fd8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  806fdd:	8d 40 04             	lea    0x4(%eax),%eax
+  806fe0:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  806fe3:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  806fe8:	eb 74                	jmp    80705e <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  806fea:	83 f9 01             	cmp    $0x1,%ecx
+  806fed:	7f 1b                	jg     80700a <vprintfmt+0x368>
+  else if (lflag)
+  806fef:	85 c9                	test   %ecx,%ecx
+  806ff1:	74 2c                	je     80701f <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  806ff3:	8b 45 14             	mov    0x14(%ebp),%eax
+  806ff6:	8b 10                	mov    (%eax),%edx
+  806ff8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  806ffd:	8d 40 04             	lea    0x4(%eax),%eax
+  807000:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  807003:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  807008:	eb 54                	jmp    80705e <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  80700a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80700d:	8b 10                	mov    (%eax),%edx
+  80700f:	8b 48 04             	mov    0x4(%eax),%ecx
+  807012:	8d 40 08             	lea    0x8(%eax),%eax
+  807015:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  807018:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  80701d:	eb 3f                	jmp    80705e <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  80701f:	8b 45 14             	mov    0x14(%ebp),%eax
+  807022:	8b 10                	mov    (%eax),%edx
+  807024:	b9 00 00 00 00       	mov    $0x0,%ecx
+  807029:	8d 40 04             	lea    0x4(%eax),%eax
+  80702c:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  80702f:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  807034:	eb 28                	jmp    80705e <vprintfmt+0x3bc>
+      putch('0', putdat);
+  807036:	83 ec 08             	sub    $0x8,%esp
+  807039:	53                   	push   %ebx
+  80703a:	6a 30                	push   $0x30
+  80703c:	ff d6                	call   *%esi
+      putch('x', putdat);
+  80703e:	83 c4 08             	add    $0x8,%esp
+  807041:	53                   	push   %ebx
+  807042:	6a 78                	push   $0x78
+  807044:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  807046:	8b 45 14             	mov    0x14(%ebp),%eax
+  807049:	8b 10                	mov    (%eax),%edx
+  80704b:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  807050:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  807053:	8d 40 04             	lea    0x4(%eax),%eax
+  807056:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  807059:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  80705e:	83 ec 0c             	sub    $0xc,%esp
+  807061:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  807065:	50                   	push   %eax
+  807066:	ff 75 e0             	push   -0x20(%ebp)
+  807069:	57                   	push   %edi
+  80706a:	51                   	push   %ecx
+  80706b:	52                   	push   %edx
+  80706c:	89 da                	mov    %ebx,%edx
+  80706e:	89 f0                	mov    %esi,%eax
+  807070:	e8 4a fb ff ff       	call   806bbf <printnum>
+      break;
+  807075:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  807078:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  80707b:	e9 40 fc ff ff       	jmp    806cc0 <vprintfmt+0x1e>
+  if (lflag >= 2)
+  807080:	83 f9 01             	cmp    $0x1,%ecx
+  807083:	7f 1b                	jg     8070a0 <vprintfmt+0x3fe>
+  else if (lflag)
+  807085:	85 c9                	test   %ecx,%ecx
+  807087:	74 2c                	je     8070b5 <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  807089:	8b 45 14             	mov    0x14(%ebp),%eax
+  80708c:	8b 10                	mov    (%eax),%edx
+  80708e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  807093:	8d 40 04             	lea    0x4(%eax),%eax
+  807096:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  807099:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  80709e:	eb be                	jmp    80705e <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  8070a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8070a3:	8b 10                	mov    (%eax),%edx
+  8070a5:	8b 48 04             	mov    0x4(%eax),%ecx
+  8070a8:	8d 40 08             	lea    0x8(%eax),%eax
+  8070ab:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8070ae:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  8070b3:	eb a9                	jmp    80705e <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8070b5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8070b8:	8b 10                	mov    (%eax),%edx
+  8070ba:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8070bf:	8d 40 04             	lea    0x4(%eax),%eax
+  8070c2:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8070c5:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  8070ca:	eb 92                	jmp    80705e <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  8070cc:	83 ec 08             	sub    $0x8,%esp
+  8070cf:	53                   	push   %ebx
+  8070d0:	6a 25                	push   $0x25
+  8070d2:	ff d6                	call   *%esi
+      break;
+  8070d4:	83 c4 10             	add    $0x10,%esp
+  8070d7:	eb 9f                	jmp    807078 <vprintfmt+0x3d6>
+      putch('%', putdat);
+  8070d9:	83 ec 08             	sub    $0x8,%esp
+  8070dc:	53                   	push   %ebx
+  8070dd:	6a 25                	push   $0x25
+  8070df:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  8070e1:	83 c4 10             	add    $0x10,%esp
+  8070e4:	89 f8                	mov    %edi,%eax
+  8070e6:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8070ea:	74 05                	je     8070f1 <vprintfmt+0x44f>
+  8070ec:	83 e8 01             	sub    $0x1,%eax
+  8070ef:	eb f5                	jmp    8070e6 <vprintfmt+0x444>
+  8070f1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8070f4:	eb 82                	jmp    807078 <vprintfmt+0x3d6>
+
+008070f6 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8070f6:	55                   	push   %ebp
+  8070f7:	89 e5                	mov    %esp,%ebp
+  8070f9:	83 ec 18             	sub    $0x18,%esp
+  8070fc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8070ff:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  807102:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  807105:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  807109:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80710c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  807113:	85 c0                	test   %eax,%eax
+  807115:	74 26                	je     80713d <vsnprintf+0x47>
+  807117:	85 d2                	test   %edx,%edx
+  807119:	7e 22                	jle    80713d <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80711b:	ff 75 14             	push   0x14(%ebp)
+  80711e:	ff 75 10             	push   0x10(%ebp)
+  807121:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  807124:	50                   	push   %eax
+  807125:	68 68 6c 80 00       	push   $0x806c68
+  80712a:	e8 73 fb ff ff       	call   806ca2 <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  80712f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  807132:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  807135:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  807138:	83 c4 10             	add    $0x10,%esp
+}
+  80713b:	c9                   	leave
+  80713c:	c3                   	ret
+    return -E_INVAL;
+  80713d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  807142:	eb f7                	jmp    80713b <vsnprintf+0x45>
+
+00807144 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  807144:	55                   	push   %ebp
+  807145:	89 e5                	mov    %esp,%ebp
+  807147:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  80714a:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  80714d:	50                   	push   %eax
+  80714e:	ff 75 10             	push   0x10(%ebp)
+  807151:	ff 75 0c             	push   0xc(%ebp)
+  807154:	ff 75 08             	push   0x8(%ebp)
+  807157:	e8 9a ff ff ff       	call   8070f6 <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  80715c:	c9                   	leave
+  80715d:	c3                   	ret
+
+0080715e <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80715e:	55                   	push   %ebp
+  80715f:	89 e5                	mov    %esp,%ebp
+  807161:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  807164:	b8 00 00 00 00       	mov    $0x0,%eax
+  807169:	eb 03                	jmp    80716e <strlen+0x10>
+    n++;
+  80716b:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  80716e:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  807172:	75 f7                	jne    80716b <strlen+0xd>
+  return n;
+}
+  807174:	5d                   	pop    %ebp
+  807175:	c3                   	ret
+
+00807176 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  807176:	55                   	push   %ebp
+  807177:	89 e5                	mov    %esp,%ebp
+  807179:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80717c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80717f:	b8 00 00 00 00       	mov    $0x0,%eax
+  807184:	eb 03                	jmp    807189 <strnlen+0x13>
+    n++;
+  807186:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  807189:	39 d0                	cmp    %edx,%eax
+  80718b:	74 08                	je     807195 <strnlen+0x1f>
+  80718d:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  807191:	75 f3                	jne    807186 <strnlen+0x10>
+  807193:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  807195:	89 d0                	mov    %edx,%eax
+  807197:	5d                   	pop    %ebp
+  807198:	c3                   	ret
+
+00807199 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  807199:	55                   	push   %ebp
+  80719a:	89 e5                	mov    %esp,%ebp
+  80719c:	53                   	push   %ebx
+  80719d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8071a0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  8071a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8071a8:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8071ac:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8071af:	83 c0 01             	add    $0x1,%eax
+  8071b2:	84 d2                	test   %dl,%dl
+  8071b4:	75 f2                	jne    8071a8 <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  8071b6:	89 c8                	mov    %ecx,%eax
+  8071b8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8071bb:	c9                   	leave
+  8071bc:	c3                   	ret
+
+008071bd <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8071bd:	55                   	push   %ebp
+  8071be:	89 e5                	mov    %esp,%ebp
+  8071c0:	53                   	push   %ebx
+  8071c1:	83 ec 10             	sub    $0x10,%esp
+  8071c4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  8071c7:	53                   	push   %ebx
+  8071c8:	e8 91 ff ff ff       	call   80715e <strlen>
+  8071cd:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  8071d0:	ff 75 0c             	push   0xc(%ebp)
+  8071d3:	01 d8                	add    %ebx,%eax
+  8071d5:	50                   	push   %eax
+  8071d6:	e8 be ff ff ff       	call   807199 <strcpy>
+  return dst;
+}
+  8071db:	89 d8                	mov    %ebx,%eax
+  8071dd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8071e0:	c9                   	leave
+  8071e1:	c3                   	ret
+
+008071e2 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  8071e2:	55                   	push   %ebp
+  8071e3:	89 e5                	mov    %esp,%ebp
+  8071e5:	56                   	push   %esi
+  8071e6:	53                   	push   %ebx
+  8071e7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8071ea:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  8071ed:	89 f3                	mov    %esi,%ebx
+  8071ef:	03 5d 10             	add    0x10(%ebp),%ebx
+  8071f2:	89 f0                	mov    %esi,%eax
+  8071f4:	eb 0f                	jmp    807205 <strncpy+0x23>
+    *dst++ = *src;
+  8071f6:	83 c0 01             	add    $0x1,%eax
+  8071f9:	0f b6 0a             	movzbl (%edx),%ecx
+  8071fc:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  8071ff:	80 f9 01             	cmp    $0x1,%cl
+  807202:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  807205:	39 d8                	cmp    %ebx,%eax
+  807207:	75 ed                	jne    8071f6 <strncpy+0x14>
+  }
+  return ret;
+}
+  807209:	89 f0                	mov    %esi,%eax
+  80720b:	5b                   	pop    %ebx
+  80720c:	5e                   	pop    %esi
+  80720d:	5d                   	pop    %ebp
+  80720e:	c3                   	ret
+
+0080720f <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80720f:	55                   	push   %ebp
+  807210:	89 e5                	mov    %esp,%ebp
+  807212:	56                   	push   %esi
+  807213:	53                   	push   %ebx
+  807214:	8b 75 08             	mov    0x8(%ebp),%esi
+  807217:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80721a:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  80721d:	89 f0                	mov    %esi,%eax
+  80721f:	85 d2                	test   %edx,%edx
+  807221:	74 21                	je     807244 <strlcpy+0x35>
+  807223:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  807227:	89 f2                	mov    %esi,%edx
+  807229:	eb 09                	jmp    807234 <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  80722b:	83 c1 01             	add    $0x1,%ecx
+  80722e:	83 c2 01             	add    $0x1,%edx
+  807231:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  807234:	39 c2                	cmp    %eax,%edx
+  807236:	74 09                	je     807241 <strlcpy+0x32>
+  807238:	0f b6 19             	movzbl (%ecx),%ebx
+  80723b:	84 db                	test   %bl,%bl
+  80723d:	75 ec                	jne    80722b <strlcpy+0x1c>
+  80723f:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  807241:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  807244:	29 f0                	sub    %esi,%eax
+}
+  807246:	5b                   	pop    %ebx
+  807247:	5e                   	pop    %esi
+  807248:	5d                   	pop    %ebp
+  807249:	c3                   	ret
+
+0080724a <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80724a:	55                   	push   %ebp
+  80724b:	89 e5                	mov    %esp,%ebp
+  80724d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  807250:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  807253:	eb 06                	jmp    80725b <strcmp+0x11>
+    p++, q++;
+  807255:	83 c1 01             	add    $0x1,%ecx
+  807258:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  80725b:	0f b6 01             	movzbl (%ecx),%eax
+  80725e:	84 c0                	test   %al,%al
+  807260:	74 04                	je     807266 <strcmp+0x1c>
+  807262:	3a 02                	cmp    (%edx),%al
+  807264:	74 ef                	je     807255 <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  807266:	0f b6 c0             	movzbl %al,%eax
+  807269:	0f b6 12             	movzbl (%edx),%edx
+  80726c:	29 d0                	sub    %edx,%eax
+}
+  80726e:	5d                   	pop    %ebp
+  80726f:	c3                   	ret
+
+00807270 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  807270:	55                   	push   %ebp
+  807271:	89 e5                	mov    %esp,%ebp
+  807273:	53                   	push   %ebx
+  807274:	8b 45 08             	mov    0x8(%ebp),%eax
+  807277:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80727a:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  80727d:	eb 09                	jmp    807288 <strncmp+0x18>
+    n--, p++, q++;
+  80727f:	83 ea 01             	sub    $0x1,%edx
+  807282:	83 c0 01             	add    $0x1,%eax
+  807285:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  807288:	85 d2                	test   %edx,%edx
+  80728a:	74 18                	je     8072a4 <strncmp+0x34>
+  80728c:	0f b6 18             	movzbl (%eax),%ebx
+  80728f:	84 db                	test   %bl,%bl
+  807291:	74 04                	je     807297 <strncmp+0x27>
+  807293:	3a 19                	cmp    (%ecx),%bl
+  807295:	74 e8                	je     80727f <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  807297:	0f b6 00             	movzbl (%eax),%eax
+  80729a:	0f b6 11             	movzbl (%ecx),%edx
+  80729d:	29 d0                	sub    %edx,%eax
+}
+  80729f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8072a2:	c9                   	leave
+  8072a3:	c3                   	ret
+    return 0;
+  8072a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8072a9:	eb f4                	jmp    80729f <strncmp+0x2f>
+
+008072ab <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8072ab:	55                   	push   %ebp
+  8072ac:	89 e5                	mov    %esp,%ebp
+  8072ae:	8b 45 08             	mov    0x8(%ebp),%eax
+  8072b1:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  8072b5:	eb 03                	jmp    8072ba <strchr+0xf>
+  8072b7:	83 c0 01             	add    $0x1,%eax
+  8072ba:	0f b6 10             	movzbl (%eax),%edx
+  8072bd:	84 d2                	test   %dl,%dl
+  8072bf:	74 06                	je     8072c7 <strchr+0x1c>
+    if (*s == c)
+  8072c1:	38 ca                	cmp    %cl,%dl
+  8072c3:	75 f2                	jne    8072b7 <strchr+0xc>
+  8072c5:	eb 05                	jmp    8072cc <strchr+0x21>
+      return (char*)s;
+  return 0;
+  8072c7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8072cc:	5d                   	pop    %ebp
+  8072cd:	c3                   	ret
+
+008072ce <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8072ce:	55                   	push   %ebp
+  8072cf:	89 e5                	mov    %esp,%ebp
+  8072d1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8072d4:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  8072d8:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  8072db:	38 ca                	cmp    %cl,%dl
+  8072dd:	74 09                	je     8072e8 <strfind+0x1a>
+  8072df:	84 d2                	test   %dl,%dl
+  8072e1:	74 05                	je     8072e8 <strfind+0x1a>
+  for (; *s; s++)
+  8072e3:	83 c0 01             	add    $0x1,%eax
+  8072e6:	eb f0                	jmp    8072d8 <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  8072e8:	5d                   	pop    %ebp
+  8072e9:	c3                   	ret
+
+008072ea <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8072ea:	55                   	push   %ebp
+  8072eb:	89 e5                	mov    %esp,%ebp
+  8072ed:	57                   	push   %edi
+  8072ee:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8072f1:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  8072f4:	85 c9                	test   %ecx,%ecx
+  8072f6:	74 20                	je     807318 <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  8072f8:	89 f8                	mov    %edi,%eax
+  8072fa:	09 c8                	or     %ecx,%eax
+  8072fc:	a8 03                	test   $0x3,%al
+  8072fe:	75 12                	jne    807312 <memset+0x28>
+    c &= 0xFF;
+  807300:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  807304:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  80730a:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  80730d:	fc                   	cld
+  80730e:	f3 ab                	rep stos %eax,%es:(%edi)
+  807310:	eb 06                	jmp    807318 <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  807312:	8b 45 0c             	mov    0xc(%ebp),%eax
+  807315:	fc                   	cld
+  807316:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  807318:	89 f8                	mov    %edi,%eax
+  80731a:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  80731d:	c9                   	leave
+  80731e:	c3                   	ret
+
+0080731f <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  80731f:	55                   	push   %ebp
+  807320:	89 e5                	mov    %esp,%ebp
+  807322:	57                   	push   %edi
+  807323:	56                   	push   %esi
+  807324:	8b 45 08             	mov    0x8(%ebp),%eax
+  807327:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80732a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  80732d:	39 c6                	cmp    %eax,%esi
+  80732f:	73 32                	jae    807363 <memmove+0x44>
+  807331:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  807334:	39 d0                	cmp    %edx,%eax
+  807336:	73 2b                	jae    807363 <memmove+0x44>
+    s += n;
+    d += n;
+  807338:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80733b:	89 d6                	mov    %edx,%esi
+  80733d:	09 fe                	or     %edi,%esi
+  80733f:	09 ce                	or     %ecx,%esi
+  807341:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  807347:	75 0e                	jne    807357 <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  807349:	83 ef 04             	sub    $0x4,%edi
+  80734c:	8d 72 fc             	lea    -0x4(%edx),%esi
+  80734f:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  807352:	fd                   	std
+  807353:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  807355:	eb 09                	jmp    807360 <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  807357:	83 ef 01             	sub    $0x1,%edi
+  80735a:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  80735d:	fd                   	std
+  80735e:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  807360:	fc                   	cld
+  807361:	eb 1a                	jmp    80737d <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  807363:	89 f2                	mov    %esi,%edx
+  807365:	09 c2                	or     %eax,%edx
+  807367:	09 ca                	or     %ecx,%edx
+  807369:	f6 c2 03             	test   $0x3,%dl
+  80736c:	75 0a                	jne    807378 <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  80736e:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  807371:	89 c7                	mov    %eax,%edi
+  807373:	fc                   	cld
+  807374:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  807376:	eb 05                	jmp    80737d <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  807378:	89 c7                	mov    %eax,%edi
+  80737a:	fc                   	cld
+  80737b:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  80737d:	5e                   	pop    %esi
+  80737e:	5f                   	pop    %edi
+  80737f:	5d                   	pop    %ebp
+  807380:	c3                   	ret
+
+00807381 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  807381:	55                   	push   %ebp
+  807382:	89 e5                	mov    %esp,%ebp
+  807384:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  807387:	ff 75 10             	push   0x10(%ebp)
+  80738a:	ff 75 0c             	push   0xc(%ebp)
+  80738d:	ff 75 08             	push   0x8(%ebp)
+  807390:	e8 8a ff ff ff       	call   80731f <memmove>
+}
+  807395:	c9                   	leave
+  807396:	c3                   	ret
+
+00807397 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  807397:	55                   	push   %ebp
+  807398:	89 e5                	mov    %esp,%ebp
+  80739a:	56                   	push   %esi
+  80739b:	53                   	push   %ebx
+  80739c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80739f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  8073a2:	89 c6                	mov    %eax,%esi
+  8073a4:	03 75 10             	add    0x10(%ebp),%esi
+  8073a7:	eb 06                	jmp    8073af <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  8073a9:	83 c0 01             	add    $0x1,%eax
+  8073ac:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  8073af:	39 f0                	cmp    %esi,%eax
+  8073b1:	74 14                	je     8073c7 <memcmp+0x30>
+    if (*s1 != *s2)
+  8073b3:	0f b6 08             	movzbl (%eax),%ecx
+  8073b6:	0f b6 1a             	movzbl (%edx),%ebx
+  8073b9:	38 d9                	cmp    %bl,%cl
+  8073bb:	74 ec                	je     8073a9 <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  8073bd:	0f b6 c1             	movzbl %cl,%eax
+  8073c0:	0f b6 db             	movzbl %bl,%ebx
+  8073c3:	29 d8                	sub    %ebx,%eax
+  8073c5:	eb 05                	jmp    8073cc <memcmp+0x35>
+  }
+
+  return 0;
+  8073c7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8073cc:	5b                   	pop    %ebx
+  8073cd:	5e                   	pop    %esi
+  8073ce:	5d                   	pop    %ebp
+  8073cf:	c3                   	ret
+
+008073d0 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8073d0:	55                   	push   %ebp
+  8073d1:	89 e5                	mov    %esp,%ebp
+  8073d3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8073d6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  8073d9:	89 c2                	mov    %eax,%edx
+  8073db:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  8073de:	eb 03                	jmp    8073e3 <memfind+0x13>
+  8073e0:	83 c0 01             	add    $0x1,%eax
+  8073e3:	39 d0                	cmp    %edx,%eax
+  8073e5:	73 04                	jae    8073eb <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  8073e7:	38 08                	cmp    %cl,(%eax)
+  8073e9:	75 f5                	jne    8073e0 <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  8073eb:	5d                   	pop    %ebp
+  8073ec:	c3                   	ret
+
+008073ed <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8073ed:	55                   	push   %ebp
+  8073ee:	89 e5                	mov    %esp,%ebp
+  8073f0:	57                   	push   %edi
+  8073f1:	56                   	push   %esi
+  8073f2:	53                   	push   %ebx
+  8073f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8073f6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  8073f9:	eb 03                	jmp    8073fe <strtol+0x11>
+    s++;
+  8073fb:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  8073fe:	0f b6 02             	movzbl (%edx),%eax
+  807401:	3c 20                	cmp    $0x20,%al
+  807403:	74 f6                	je     8073fb <strtol+0xe>
+  807405:	3c 09                	cmp    $0x9,%al
+  807407:	74 f2                	je     8073fb <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  807409:	3c 2b                	cmp    $0x2b,%al
+  80740b:	74 2a                	je     807437 <strtol+0x4a>
+  int neg = 0;
+  80740d:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  807412:	3c 2d                	cmp    $0x2d,%al
+  807414:	74 2b                	je     807441 <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  807416:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  80741c:	75 0f                	jne    80742d <strtol+0x40>
+  80741e:	80 3a 30             	cmpb   $0x30,(%edx)
+  807421:	74 28                	je     80744b <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  807423:	85 db                	test   %ebx,%ebx
+  807425:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80742a:	0f 44 d8             	cmove  %eax,%ebx
+  80742d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  807432:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  807435:	eb 46                	jmp    80747d <strtol+0x90>
+    s++;
+  807437:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  80743a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80743f:	eb d5                	jmp    807416 <strtol+0x29>
+    s++, neg = 1;
+  807441:	83 c2 01             	add    $0x1,%edx
+  807444:	bf 01 00 00 00       	mov    $0x1,%edi
+  807449:	eb cb                	jmp    807416 <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80744b:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  80744f:	74 0e                	je     80745f <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  807451:	85 db                	test   %ebx,%ebx
+  807453:	75 d8                	jne    80742d <strtol+0x40>
+    s++, base = 8;
+  807455:	83 c2 01             	add    $0x1,%edx
+  807458:	bb 08 00 00 00       	mov    $0x8,%ebx
+  80745d:	eb ce                	jmp    80742d <strtol+0x40>
+    s += 2, base = 16;
+  80745f:	83 c2 02             	add    $0x2,%edx
+  807462:	bb 10 00 00 00       	mov    $0x10,%ebx
+  807467:	eb c4                	jmp    80742d <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  807469:	0f be c0             	movsbl %al,%eax
+  80746c:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  80746f:	3b 45 10             	cmp    0x10(%ebp),%eax
+  807472:	7d 3a                	jge    8074ae <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  807474:	83 c2 01             	add    $0x1,%edx
+  807477:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  80747b:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  80747d:	0f b6 02             	movzbl (%edx),%eax
+  807480:	8d 70 d0             	lea    -0x30(%eax),%esi
+  807483:	89 f3                	mov    %esi,%ebx
+  807485:	80 fb 09             	cmp    $0x9,%bl
+  807488:	76 df                	jbe    807469 <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  80748a:	8d 70 9f             	lea    -0x61(%eax),%esi
+  80748d:	89 f3                	mov    %esi,%ebx
+  80748f:	80 fb 19             	cmp    $0x19,%bl
+  807492:	77 08                	ja     80749c <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  807494:	0f be c0             	movsbl %al,%eax
+  807497:	83 e8 57             	sub    $0x57,%eax
+  80749a:	eb d3                	jmp    80746f <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  80749c:	8d 70 bf             	lea    -0x41(%eax),%esi
+  80749f:	89 f3                	mov    %esi,%ebx
+  8074a1:	80 fb 19             	cmp    $0x19,%bl
+  8074a4:	77 08                	ja     8074ae <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  8074a6:	0f be c0             	movsbl %al,%eax
+  8074a9:	83 e8 37             	sub    $0x37,%eax
+  8074ac:	eb c1                	jmp    80746f <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  8074ae:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8074b2:	74 05                	je     8074b9 <strtol+0xcc>
+    *endptr = (char*)s;
+  8074b4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8074b7:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  8074b9:	89 c8                	mov    %ecx,%eax
+  8074bb:	f7 d8                	neg    %eax
+  8074bd:	85 ff                	test   %edi,%edi
+  8074bf:	0f 45 c8             	cmovne %eax,%ecx
+}
+  8074c2:	89 c8                	mov    %ecx,%eax
+  8074c4:	5b                   	pop    %ebx
+  8074c5:	5e                   	pop    %esi
+  8074c6:	5f                   	pop    %edi
+  8074c7:	5d                   	pop    %ebp
+  8074c8:	c3                   	ret
+
+008074c9 <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8074c9:	55                   	push   %ebp
+  8074ca:	89 e5                	mov    %esp,%ebp
+  8074cc:	57                   	push   %edi
+  8074cd:	56                   	push   %esi
+  8074ce:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8074cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8074d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8074d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8074da:	89 c3                	mov    %eax,%ebx
+  8074dc:	89 c7                	mov    %eax,%edi
+  8074de:	89 c6                	mov    %eax,%esi
+  8074e0:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  8074e2:	5b                   	pop    %ebx
+  8074e3:	5e                   	pop    %esi
+  8074e4:	5f                   	pop    %edi
+  8074e5:	5d                   	pop    %ebp
+  8074e6:	c3                   	ret
+
+008074e7 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  8074e7:	55                   	push   %ebp
+  8074e8:	89 e5                	mov    %esp,%ebp
+  8074ea:	57                   	push   %edi
+  8074eb:	56                   	push   %esi
+  8074ec:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8074ed:	ba 00 00 00 00       	mov    $0x0,%edx
+  8074f2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8074f7:	89 d1                	mov    %edx,%ecx
+  8074f9:	89 d3                	mov    %edx,%ebx
+  8074fb:	89 d7                	mov    %edx,%edi
+  8074fd:	89 d6                	mov    %edx,%esi
+  8074ff:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  807501:	5b                   	pop    %ebx
+  807502:	5e                   	pop    %esi
+  807503:	5f                   	pop    %edi
+  807504:	5d                   	pop    %ebp
+  807505:	c3                   	ret
+
+00807506 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  807506:	55                   	push   %ebp
+  807507:	89 e5                	mov    %esp,%ebp
+  807509:	57                   	push   %edi
+  80750a:	56                   	push   %esi
+  80750b:	53                   	push   %ebx
+  80750c:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80750f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  807514:	8b 55 08             	mov    0x8(%ebp),%edx
+  807517:	b8 03 00 00 00       	mov    $0x3,%eax
+  80751c:	89 cb                	mov    %ecx,%ebx
+  80751e:	89 cf                	mov    %ecx,%edi
+  807520:	89 ce                	mov    %ecx,%esi
+  807522:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  807524:	85 c0                	test   %eax,%eax
+  807526:	7f 08                	jg     807530 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  807528:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80752b:	5b                   	pop    %ebx
+  80752c:	5e                   	pop    %esi
+  80752d:	5f                   	pop    %edi
+  80752e:	5d                   	pop    %ebp
+  80752f:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  807530:	83 ec 0c             	sub    $0xc,%esp
+  807533:	50                   	push   %eax
+  807534:	6a 03                	push   $0x3
+  807536:	68 a3 a5 80 00       	push   $0x80a5a3
+  80753b:	6a 23                	push   $0x23
+  80753d:	68 c0 a5 80 00       	push   $0x80a5c0
+  807542:	e8 89 f5 ff ff       	call   806ad0 <_panic>
+
+00807547 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  807547:	55                   	push   %ebp
+  807548:	89 e5                	mov    %esp,%ebp
+  80754a:	57                   	push   %edi
+  80754b:	56                   	push   %esi
+  80754c:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80754d:	ba 00 00 00 00       	mov    $0x0,%edx
+  807552:	b8 02 00 00 00       	mov    $0x2,%eax
+  807557:	89 d1                	mov    %edx,%ecx
+  807559:	89 d3                	mov    %edx,%ebx
+  80755b:	89 d7                	mov    %edx,%edi
+  80755d:	89 d6                	mov    %edx,%esi
+  80755f:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  807561:	5b                   	pop    %ebx
+  807562:	5e                   	pop    %esi
+  807563:	5f                   	pop    %edi
+  807564:	5d                   	pop    %ebp
+  807565:	c3                   	ret
+
+00807566 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  807566:	55                   	push   %ebp
+  807567:	89 e5                	mov    %esp,%ebp
+  807569:	57                   	push   %edi
+  80756a:	56                   	push   %esi
+  80756b:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80756c:	ba 00 00 00 00       	mov    $0x0,%edx
+  807571:	b8 0b 00 00 00       	mov    $0xb,%eax
+  807576:	89 d1                	mov    %edx,%ecx
+  807578:	89 d3                	mov    %edx,%ebx
+  80757a:	89 d7                	mov    %edx,%edi
+  80757c:	89 d6                	mov    %edx,%esi
+  80757e:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  807580:	5b                   	pop    %ebx
+  807581:	5e                   	pop    %esi
+  807582:	5f                   	pop    %edi
+  807583:	5d                   	pop    %ebp
+  807584:	c3                   	ret
+
+00807585 <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  807585:	55                   	push   %ebp
+  807586:	89 e5                	mov    %esp,%ebp
+  807588:	57                   	push   %edi
+  807589:	56                   	push   %esi
+  80758a:	53                   	push   %ebx
+  80758b:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  80758e:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  807592:	bb 00 00 00 00       	mov    $0x0,%ebx
+  807597:	8b 55 08             	mov    0x8(%ebp),%edx
+  80759a:	b8 14 00 00 00       	mov    $0x14,%eax
+  80759f:	89 df                	mov    %ebx,%edi
+  8075a1:	89 de                	mov    %ebx,%esi
+  8075a3:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8075a5:	85 c0                	test   %eax,%eax
+  8075a7:	7f 08                	jg     8075b1 <sys_env_set_cow+0x2c>
+}
+  8075a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8075ac:	5b                   	pop    %ebx
+  8075ad:	5e                   	pop    %esi
+  8075ae:	5f                   	pop    %edi
+  8075af:	5d                   	pop    %ebp
+  8075b0:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8075b1:	83 ec 0c             	sub    $0xc,%esp
+  8075b4:	50                   	push   %eax
+  8075b5:	6a 14                	push   $0x14
+  8075b7:	68 a3 a5 80 00       	push   $0x80a5a3
+  8075bc:	6a 23                	push   $0x23
+  8075be:	68 c0 a5 80 00       	push   $0x80a5c0
+  8075c3:	e8 08 f5 ff ff       	call   806ad0 <_panic>
+
+008075c8 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8075c8:	55                   	push   %ebp
+  8075c9:	89 e5                	mov    %esp,%ebp
+  8075cb:	57                   	push   %edi
+  8075cc:	56                   	push   %esi
+  8075cd:	53                   	push   %ebx
+  8075ce:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8075d1:	be 00 00 00 00       	mov    $0x0,%esi
+  8075d6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8075d9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8075dc:	b8 04 00 00 00       	mov    $0x4,%eax
+  8075e1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8075e4:	89 f7                	mov    %esi,%edi
+  8075e6:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8075e8:	85 c0                	test   %eax,%eax
+  8075ea:	7f 08                	jg     8075f4 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  8075ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8075ef:	5b                   	pop    %ebx
+  8075f0:	5e                   	pop    %esi
+  8075f1:	5f                   	pop    %edi
+  8075f2:	5d                   	pop    %ebp
+  8075f3:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8075f4:	83 ec 0c             	sub    $0xc,%esp
+  8075f7:	50                   	push   %eax
+  8075f8:	6a 04                	push   $0x4
+  8075fa:	68 a3 a5 80 00       	push   $0x80a5a3
+  8075ff:	6a 23                	push   $0x23
+  807601:	68 c0 a5 80 00       	push   $0x80a5c0
+  807606:	e8 c5 f4 ff ff       	call   806ad0 <_panic>
+
+0080760b <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  80760b:	55                   	push   %ebp
+  80760c:	89 e5                	mov    %esp,%ebp
+  80760e:	57                   	push   %edi
+  80760f:	56                   	push   %esi
+  807610:	53                   	push   %ebx
+  807611:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  807614:	8b 55 08             	mov    0x8(%ebp),%edx
+  807617:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80761a:	b8 05 00 00 00       	mov    $0x5,%eax
+  80761f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  807622:	8b 7d 14             	mov    0x14(%ebp),%edi
+  807625:	8b 75 18             	mov    0x18(%ebp),%esi
+  807628:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80762a:	85 c0                	test   %eax,%eax
+  80762c:	7f 08                	jg     807636 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  80762e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  807631:	5b                   	pop    %ebx
+  807632:	5e                   	pop    %esi
+  807633:	5f                   	pop    %edi
+  807634:	5d                   	pop    %ebp
+  807635:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  807636:	83 ec 0c             	sub    $0xc,%esp
+  807639:	50                   	push   %eax
+  80763a:	6a 05                	push   $0x5
+  80763c:	68 a3 a5 80 00       	push   $0x80a5a3
+  807641:	6a 23                	push   $0x23
+  807643:	68 c0 a5 80 00       	push   $0x80a5c0
+  807648:	e8 83 f4 ff ff       	call   806ad0 <_panic>
+
+0080764d <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  80764d:	55                   	push   %ebp
+  80764e:	89 e5                	mov    %esp,%ebp
+  807650:	57                   	push   %edi
+  807651:	56                   	push   %esi
+  807652:	53                   	push   %ebx
+  807653:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  807656:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80765b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80765e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  807661:	b8 06 00 00 00       	mov    $0x6,%eax
+  807666:	89 df                	mov    %ebx,%edi
+  807668:	89 de                	mov    %ebx,%esi
+  80766a:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80766c:	85 c0                	test   %eax,%eax
+  80766e:	7f 08                	jg     807678 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  807670:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  807673:	5b                   	pop    %ebx
+  807674:	5e                   	pop    %esi
+  807675:	5f                   	pop    %edi
+  807676:	5d                   	pop    %ebp
+  807677:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  807678:	83 ec 0c             	sub    $0xc,%esp
+  80767b:	50                   	push   %eax
+  80767c:	6a 06                	push   $0x6
+  80767e:	68 a3 a5 80 00       	push   $0x80a5a3
+  807683:	6a 23                	push   $0x23
+  807685:	68 c0 a5 80 00       	push   $0x80a5c0
+  80768a:	e8 41 f4 ff ff       	call   806ad0 <_panic>
+
+0080768f <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  80768f:	55                   	push   %ebp
+  807690:	89 e5                	mov    %esp,%ebp
+  807692:	57                   	push   %edi
+  807693:	56                   	push   %esi
+  807694:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  807695:	8b 55 08             	mov    0x8(%ebp),%edx
+  807698:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80769b:	b8 11 00 00 00       	mov    $0x11,%eax
+  8076a0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8076a3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8076a6:	8b 75 18             	mov    0x18(%ebp),%esi
+  8076a9:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  8076ab:	5b                   	pop    %ebx
+  8076ac:	5e                   	pop    %esi
+  8076ad:	5f                   	pop    %edi
+  8076ae:	5d                   	pop    %ebp
+  8076af:	c3                   	ret
+
+008076b0 <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  8076b0:	55                   	push   %ebp
+  8076b1:	89 e5                	mov    %esp,%ebp
+  8076b3:	57                   	push   %edi
+  8076b4:	56                   	push   %esi
+  8076b5:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8076b6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8076b9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8076bc:	b8 12 00 00 00       	mov    $0x12,%eax
+  8076c1:	be 00 00 00 00       	mov    $0x0,%esi
+  8076c6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8076c9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8076cc:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  8076ce:	5b                   	pop    %ebx
+  8076cf:	5e                   	pop    %esi
+  8076d0:	5f                   	pop    %edi
+  8076d1:	5d                   	pop    %ebp
+  8076d2:	c3                   	ret
+
+008076d3 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  8076d3:	55                   	push   %ebp
+  8076d4:	89 e5                	mov    %esp,%ebp
+  8076d6:	57                   	push   %edi
+  8076d7:	56                   	push   %esi
+  8076d8:	53                   	push   %ebx
+  8076d9:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8076dc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8076e1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8076e4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8076e7:	b8 16 00 00 00       	mov    $0x16,%eax
+  8076ec:	89 df                	mov    %ebx,%edi
+  8076ee:	89 de                	mov    %ebx,%esi
+  8076f0:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8076f2:	85 c0                	test   %eax,%eax
+  8076f4:	7f 08                	jg     8076fe <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  8076f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8076f9:	5b                   	pop    %ebx
+  8076fa:	5e                   	pop    %esi
+  8076fb:	5f                   	pop    %edi
+  8076fc:	5d                   	pop    %ebp
+  8076fd:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8076fe:	83 ec 0c             	sub    $0xc,%esp
+  807701:	50                   	push   %eax
+  807702:	6a 16                	push   $0x16
+  807704:	68 a3 a5 80 00       	push   $0x80a5a3
+  807709:	6a 23                	push   $0x23
+  80770b:	68 c0 a5 80 00       	push   $0x80a5c0
+  807710:	e8 bb f3 ff ff       	call   806ad0 <_panic>
+
+00807715 <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  807715:	55                   	push   %ebp
+  807716:	89 e5                	mov    %esp,%ebp
+  807718:	57                   	push   %edi
+  807719:	56                   	push   %esi
+  80771a:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80771b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  807720:	8b 55 08             	mov    0x8(%ebp),%edx
+  807723:	b8 17 00 00 00       	mov    $0x17,%eax
+  807728:	89 cb                	mov    %ecx,%ebx
+  80772a:	89 cf                	mov    %ecx,%edi
+  80772c:	89 ce                	mov    %ecx,%esi
+  80772e:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  807730:	5b                   	pop    %ebx
+  807731:	5e                   	pop    %esi
+  807732:	5f                   	pop    %edi
+  807733:	5d                   	pop    %ebp
+  807734:	c3                   	ret
+
+00807735 <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  807735:	55                   	push   %ebp
+  807736:	89 e5                	mov    %esp,%ebp
+  807738:	57                   	push   %edi
+  807739:	56                   	push   %esi
+  80773a:	53                   	push   %ebx
+  80773b:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80773e:	be 00 00 00 00       	mov    $0x0,%esi
+  807743:	8b 55 08             	mov    0x8(%ebp),%edx
+  807746:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  807749:	b8 18 00 00 00       	mov    $0x18,%eax
+  80774e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  807751:	89 f7                	mov    %esi,%edi
+  807753:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  807755:	85 c0                	test   %eax,%eax
+  807757:	7f 08                	jg     807761 <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  807759:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80775c:	5b                   	pop    %ebx
+  80775d:	5e                   	pop    %esi
+  80775e:	5f                   	pop    %edi
+  80775f:	5d                   	pop    %ebp
+  807760:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  807761:	83 ec 0c             	sub    $0xc,%esp
+  807764:	50                   	push   %eax
+  807765:	6a 18                	push   $0x18
+  807767:	68 a3 a5 80 00       	push   $0x80a5a3
+  80776c:	6a 23                	push   $0x23
+  80776e:	68 c0 a5 80 00       	push   $0x80a5c0
+  807773:	e8 58 f3 ff ff       	call   806ad0 <_panic>
+
+00807778 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  807778:	55                   	push   %ebp
+  807779:	89 e5                	mov    %esp,%ebp
+  80777b:	57                   	push   %edi
+  80777c:	56                   	push   %esi
+  80777d:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80777e:	be 00 00 00 00       	mov    $0x0,%esi
+  807783:	8b 55 08             	mov    0x8(%ebp),%edx
+  807786:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  807789:	b8 19 00 00 00       	mov    $0x19,%eax
+  80778e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  807791:	89 f7                	mov    %esi,%edi
+  807793:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  807795:	5b                   	pop    %ebx
+  807796:	5e                   	pop    %esi
+  807797:	5f                   	pop    %edi
+  807798:	5d                   	pop    %ebp
+  807799:	c3                   	ret
+
+0080779a <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  80779a:	55                   	push   %ebp
+  80779b:	89 e5                	mov    %esp,%ebp
+  80779d:	57                   	push   %edi
+  80779e:	56                   	push   %esi
+  80779f:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8077a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8077a5:	b8 15 00 00 00       	mov    $0x15,%eax
+  8077aa:	89 d1                	mov    %edx,%ecx
+  8077ac:	89 d3                	mov    %edx,%ebx
+  8077ae:	89 d7                	mov    %edx,%edi
+  8077b0:	89 d6                	mov    %edx,%esi
+  8077b2:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8077b4:	5b                   	pop    %ebx
+  8077b5:	5e                   	pop    %esi
+  8077b6:	5f                   	pop    %edi
+  8077b7:	5d                   	pop    %ebp
+  8077b8:	c3                   	ret
+
+008077b9 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8077b9:	55                   	push   %ebp
+  8077ba:	89 e5                	mov    %esp,%ebp
+  8077bc:	57                   	push   %edi
+  8077bd:	56                   	push   %esi
+  8077be:	53                   	push   %ebx
+  8077bf:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8077c2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8077c7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8077ca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8077cd:	b8 08 00 00 00       	mov    $0x8,%eax
+  8077d2:	89 df                	mov    %ebx,%edi
+  8077d4:	89 de                	mov    %ebx,%esi
+  8077d6:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8077d8:	85 c0                	test   %eax,%eax
+  8077da:	7f 08                	jg     8077e4 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8077dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8077df:	5b                   	pop    %ebx
+  8077e0:	5e                   	pop    %esi
+  8077e1:	5f                   	pop    %edi
+  8077e2:	5d                   	pop    %ebp
+  8077e3:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8077e4:	83 ec 0c             	sub    $0xc,%esp
+  8077e7:	50                   	push   %eax
+  8077e8:	6a 08                	push   $0x8
+  8077ea:	68 a3 a5 80 00       	push   $0x80a5a3
+  8077ef:	6a 23                	push   $0x23
+  8077f1:	68 c0 a5 80 00       	push   $0x80a5c0
+  8077f6:	e8 d5 f2 ff ff       	call   806ad0 <_panic>
+
+008077fb <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8077fb:	55                   	push   %ebp
+  8077fc:	89 e5                	mov    %esp,%ebp
+  8077fe:	57                   	push   %edi
+  8077ff:	56                   	push   %esi
+  807800:	53                   	push   %ebx
+  807801:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  807804:	bb 00 00 00 00       	mov    $0x0,%ebx
+  807809:	8b 55 08             	mov    0x8(%ebp),%edx
+  80780c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80780f:	b8 09 00 00 00       	mov    $0x9,%eax
+  807814:	89 df                	mov    %ebx,%edi
+  807816:	89 de                	mov    %ebx,%esi
+  807818:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80781a:	85 c0                	test   %eax,%eax
+  80781c:	7f 08                	jg     807826 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  80781e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  807821:	5b                   	pop    %ebx
+  807822:	5e                   	pop    %esi
+  807823:	5f                   	pop    %edi
+  807824:	5d                   	pop    %ebp
+  807825:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  807826:	83 ec 0c             	sub    $0xc,%esp
+  807829:	50                   	push   %eax
+  80782a:	6a 09                	push   $0x9
+  80782c:	68 a3 a5 80 00       	push   $0x80a5a3
+  807831:	6a 23                	push   $0x23
+  807833:	68 c0 a5 80 00       	push   $0x80a5c0
+  807838:	e8 93 f2 ff ff       	call   806ad0 <_panic>
+
+0080783d <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80783d:	55                   	push   %ebp
+  80783e:	89 e5                	mov    %esp,%ebp
+  807840:	57                   	push   %edi
+  807841:	56                   	push   %esi
+  807842:	53                   	push   %ebx
+  807843:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  807846:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80784b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80784e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  807851:	b8 0a 00 00 00       	mov    $0xa,%eax
+  807856:	89 df                	mov    %ebx,%edi
+  807858:	89 de                	mov    %ebx,%esi
+  80785a:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80785c:	85 c0                	test   %eax,%eax
+  80785e:	7f 08                	jg     807868 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  807860:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  807863:	5b                   	pop    %ebx
+  807864:	5e                   	pop    %esi
+  807865:	5f                   	pop    %edi
+  807866:	5d                   	pop    %ebp
+  807867:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  807868:	83 ec 0c             	sub    $0xc,%esp
+  80786b:	50                   	push   %eax
+  80786c:	6a 0a                	push   $0xa
+  80786e:	68 a3 a5 80 00       	push   $0x80a5a3
+  807873:	6a 23                	push   $0x23
+  807875:	68 c0 a5 80 00       	push   $0x80a5c0
+  80787a:	e8 51 f2 ff ff       	call   806ad0 <_panic>
+
+0080787f <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  80787f:	55                   	push   %ebp
+  807880:	89 e5                	mov    %esp,%ebp
+  807882:	57                   	push   %edi
+  807883:	56                   	push   %esi
+  807884:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  807885:	8b 55 08             	mov    0x8(%ebp),%edx
+  807888:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80788b:	b8 0c 00 00 00       	mov    $0xc,%eax
+  807890:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  807893:	8b 7d 14             	mov    0x14(%ebp),%edi
+  807896:	8b 75 18             	mov    0x18(%ebp),%esi
+  807899:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  80789b:	5b                   	pop    %ebx
+  80789c:	5e                   	pop    %esi
+  80789d:	5f                   	pop    %edi
+  80789e:	5d                   	pop    %ebp
+  80789f:	c3                   	ret
+
+008078a0 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  8078a0:	55                   	push   %ebp
+  8078a1:	89 e5                	mov    %esp,%ebp
+  8078a3:	57                   	push   %edi
+  8078a4:	56                   	push   %esi
+  8078a5:	53                   	push   %ebx
+  8078a6:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8078a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8078ae:	8b 55 08             	mov    0x8(%ebp),%edx
+  8078b1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8078b4:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8078b9:	89 df                	mov    %ebx,%edi
+  8078bb:	89 de                	mov    %ebx,%esi
+  8078bd:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8078bf:	85 c0                	test   %eax,%eax
+  8078c1:	7f 08                	jg     8078cb <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  8078c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8078c6:	5b                   	pop    %ebx
+  8078c7:	5e                   	pop    %esi
+  8078c8:	5f                   	pop    %edi
+  8078c9:	5d                   	pop    %ebp
+  8078ca:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8078cb:	83 ec 0c             	sub    $0xc,%esp
+  8078ce:	50                   	push   %eax
+  8078cf:	6a 0d                	push   $0xd
+  8078d1:	68 a3 a5 80 00       	push   $0x80a5a3
+  8078d6:	6a 23                	push   $0x23
+  8078d8:	68 c0 a5 80 00       	push   $0x80a5c0
+  8078dd:	e8 ee f1 ff ff       	call   806ad0 <_panic>
+
+008078e2 <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  8078e2:	55                   	push   %ebp
+  8078e3:	89 e5                	mov    %esp,%ebp
+  8078e5:	57                   	push   %edi
+  8078e6:	56                   	push   %esi
+  8078e7:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8078e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8078ed:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8078f2:	89 d1                	mov    %edx,%ecx
+  8078f4:	89 d3                	mov    %edx,%ebx
+  8078f6:	89 d7                	mov    %edx,%edi
+  8078f8:	89 d6                	mov    %edx,%esi
+  8078fa:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8078fc:	5b                   	pop    %ebx
+  8078fd:	5e                   	pop    %esi
+  8078fe:	5f                   	pop    %edi
+  8078ff:	5d                   	pop    %ebp
+  807900:	c3                   	ret
+
+00807901 <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  807901:	55                   	push   %ebp
+  807902:	89 e5                	mov    %esp,%ebp
+  807904:	57                   	push   %edi
+  807905:	56                   	push   %esi
+  807906:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  807907:	8b 55 08             	mov    0x8(%ebp),%edx
+  80790a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80790d:	b8 0f 00 00 00       	mov    $0xf,%eax
+  807912:	be 00 00 00 00       	mov    $0x0,%esi
+  807917:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80791a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80791d:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  80791f:	5b                   	pop    %ebx
+  807920:	5e                   	pop    %esi
+  807921:	5f                   	pop    %edi
+  807922:	5d                   	pop    %ebp
+  807923:	c3                   	ret
+
+00807924 <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  807924:	55                   	push   %ebp
+  807925:	89 e5                	mov    %esp,%ebp
+  807927:	57                   	push   %edi
+  807928:	56                   	push   %esi
+  807929:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80792a:	be 00 00 00 00       	mov    $0x0,%esi
+  80792f:	8b 55 08             	mov    0x8(%ebp),%edx
+  807932:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  807935:	b8 10 00 00 00       	mov    $0x10,%eax
+  80793a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80793d:	89 f7                	mov    %esi,%edi
+  80793f:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  807941:	5b                   	pop    %ebx
+  807942:	5e                   	pop    %esi
+  807943:	5f                   	pop    %edi
+  807944:	5d                   	pop    %ebp
+  807945:	c3                   	ret
+
+00807946 <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  807946:	55                   	push   %ebp
+  807947:	89 e5                	mov    %esp,%ebp
+  807949:	57                   	push   %edi
+  80794a:	56                   	push   %esi
+  80794b:	53                   	push   %ebx
+  80794c:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  80794f:	80 3d 90 3f 84 00 00 	cmpb   $0x0,0x843f90
+  807956:	74 41                	je     807999 <sys_batch+0x53>
+  807958:	8b 45 08             	mov    0x8(%ebp),%eax
+  80795b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  80795e:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  807965:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  807968:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  80796b:	7d 45                	jge    8079b2 <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  80796d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  807970:	8b 06                	mov    (%esi),%eax
+  807972:	8b 56 04             	mov    0x4(%esi),%edx
+  807975:	8b 4e 08             	mov    0x8(%esi),%ecx
+  807978:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  80797b:	8b 7e 10             	mov    0x10(%esi),%edi
+  80797e:	8b 76 14             	mov    0x14(%esi),%esi
+  807981:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  807983:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  807986:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  807989:	83 c6 1c             	add    $0x1c,%esi
+  80798c:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  80798f:	85 c0                	test   %eax,%eax
+  807991:	78 1f                	js     8079b2 <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  807993:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  807997:	eb cc                	jmp    807965 <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  807999:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80799e:	b8 13 00 00 00       	mov    $0x13,%eax
+  8079a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8079a6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8079a9:	89 df                	mov    %ebx,%edi
+  8079ab:	89 de                	mov    %ebx,%esi
+  8079ad:	cd 30                	int    $0x30
+  8079af:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  8079b2:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8079b5:	83 c4 08             	add    $0x8,%esp
+  8079b8:	5b                   	pop    %ebx
+  8079b9:	5e                   	pop    %esi
+  8079ba:	5f                   	pop    %edi
+  8079bb:	5d                   	pop    %ebp
+  8079bc:	c3                   	ret
+
+008079bd <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  8079bd:	55                   	push   %ebp
+  8079be:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  8079c0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8079c3:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8079c9:	5d                   	pop    %ebp
+  8079ca:	c3                   	ret
+
+008079cb <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  8079cb:	55                   	push   %ebp
+  8079cc:	89 e5                	mov    %esp,%ebp
+  8079ce:	56                   	push   %esi
+  8079cf:	53                   	push   %ebx
+  8079d0:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  8079d3:	8b 1e                	mov    (%esi),%ebx
+  8079d5:	85 db                	test   %ebx,%ebx
+  8079d7:	75 09                	jne    8079e2 <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  8079d9:	89 d8                	mov    %ebx,%eax
+  8079db:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8079de:	5b                   	pop    %ebx
+  8079df:	5e                   	pop    %esi
+  8079e0:	5d                   	pop    %ebp
+  8079e1:	c3                   	ret
+  b->sb_n = 0;
+  8079e2:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  8079e8:	53                   	push   %ebx
+  8079e9:	8d 46 04             	lea    0x4(%esi),%eax
+  8079ec:	50                   	push   %eax
+  8079ed:	e8 54 ff ff ff       	call   807946 <sys_batch>
+  8079f2:	83 c4 08             	add    $0x8,%esp
+  8079f5:	85 c0                	test   %eax,%eax
+  8079f7:	78 1e                	js     807a17 <sysbatch_flush+0x4c>
+  if (r < n)
+  8079f9:	39 c3                	cmp    %eax,%ebx
+  8079fb:	7f 07                	jg     807a04 <sysbatch_flush+0x39>
+  return 0;
+  8079fd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  807a02:	eb d5                	jmp    8079d9 <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  807a04:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  807a07:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  807a0b:	85 db                	test   %ebx,%ebx
+  807a0d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  807a12:	0f 49 d8             	cmovns %eax,%ebx
+  807a15:	eb c2                	jmp    8079d9 <sysbatch_flush+0xe>
+    return r;
+  807a17:	89 c3                	mov    %eax,%ebx
+  807a19:	eb be                	jmp    8079d9 <sysbatch_flush+0xe>
+
+00807a1b <sysbatch_add>:
+{
+  807a1b:	55                   	push   %ebp
+  807a1c:	89 e5                	mov    %esp,%ebp
+  807a1e:	53                   	push   %ebx
+  807a1f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  807a22:	83 3b 40             	cmpl   $0x40,(%ebx)
+  807a25:	74 41                	je     807a68 <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  807a27:	8b 03                	mov    (%ebx),%eax
+  807a29:	8d 50 01             	lea    0x1(%eax),%edx
+  807a2c:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  807a2e:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  807a31:	01 d8                	add    %ebx,%eax
+  807a33:	8b 55 0c             	mov    0xc(%ebp),%edx
+  807a36:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  807a39:	8b 55 10             	mov    0x10(%ebp),%edx
+  807a3c:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  807a3f:	8b 55 14             	mov    0x14(%ebp),%edx
+  807a42:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  807a45:	8b 55 18             	mov    0x18(%ebp),%edx
+  807a48:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  807a4b:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  807a4e:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  807a51:	8b 55 20             	mov    0x20(%ebp),%edx
+  807a54:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  807a57:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  807a5e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  807a63:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  807a66:	c9                   	leave
+  807a67:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  807a68:	53                   	push   %ebx
+  807a69:	e8 5d ff ff ff       	call   8079cb <sysbatch_flush>
+  807a6e:	83 c4 04             	add    $0x4,%esp
+  807a71:	85 c0                	test   %eax,%eax
+  807a73:	79 b2                	jns    807a27 <sysbatch_add+0xc>
+  807a75:	eb ec                	jmp    807a63 <sysbatch_add+0x48>
+
+00807a77 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  807a77:	55                   	push   %ebp
+  807a78:	89 e5                	mov    %esp,%ebp
+  807a7a:	53                   	push   %ebx
+  807a7b:	83 ec 04             	sub    $0x4,%esp
+  int r;
+
+  if (_pgfault_handler == 0) {
+  807a7e:	83 3d 94 3f 84 00 00 	cmpl   $0x0,0x843f94
+  807a85:	74 0d                	je     807a94 <set_pgfault_handler+0x1d>
+
+    sys_env_set_pgfault_upcall(id, _pgfault_upcall);
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  807a87:	8b 45 08             	mov    0x8(%ebp),%eax
+  807a8a:	a3 94 3f 84 00       	mov    %eax,0x843f94
+}
+  807a8f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  807a92:	c9                   	leave
+  807a93:	c3                   	ret
+    envid_t id = sys_getenvid();
+  807a94:	e8 ae fa ff ff       	call   807547 <sys_getenvid>
+  807a99:	89 c3                	mov    %eax,%ebx
+    sys_page_alloc(id, (void *) (UXSTACKTOP - PGSIZE), (PTE_P | PTE_U | PTE_W));
+  807a9b:	83 ec 04             	sub    $0x4,%esp
+  807a9e:	6a 07                	push   $0x7
+  807aa0:	68 00 f0 bf ee       	push   $0xeebff000
+  807aa5:	50                   	push   %eax
+  807aa6:	e8 1d fb ff ff       	call   8075c8 <sys_page_alloc>
+    sys_env_set_pgfault_upcall(id, _pgfault_upcall);
+  807aab:	83 c4 08             	add    $0x8,%esp
+  807aae:	68 be 7a 80 00       	push   $0x807abe
+  807ab3:	53                   	push   %ebx
+  807ab4:	e8 84 fd ff ff       	call   80783d <sys_env_set_pgfault_upcall>
+  807ab9:	83 c4 10             	add    $0x10,%esp
+  807abc:	eb c9                	jmp    807a87 <set_pgfault_handler+0x10>
+
+00807abe <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  807abe:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  807abf:	a1 94 3f 84 00       	mov    0x843f94,%eax
+	call *%eax
+  807ac4:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  807ac6:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+  movl 48(%esp), %eax       // move trap time esp to eax
+  807ac9:	8b 44 24 30          	mov    0x30(%esp),%eax
+  subl $4, %eax             // make room for eip on trap time esp
+  807acd:	83 e8 04             	sub    $0x4,%eax
+  movl %eax, 48(%esp)       // move value to esp
+  807ad0:	89 44 24 30          	mov    %eax,0x30(%esp)
+  movl 40(%esp), %ebx       // move trap time eip to ebx
+  807ad4:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+  movl %ebx, 0(%eax)
+  807ad8:	89 18                	mov    %ebx,(%eax)
+
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+  addl $0x08,%esp
+  807ada:	83 c4 08             	add    $0x8,%esp
+  popal
+  807add:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+  addl $4, %esp          // skip tf->eip
+  807ade:	83 c4 04             	add    $0x4,%esp
+  popf                 // pop stack value into flags register
+  807ae1:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+  popl %esp
+  807ae2:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+  ret
+  807ae3:	c3                   	ret
+
+00807ae4 <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  807ae4:	55                   	push   %ebp
+  807ae5:	89 e5                	mov    %esp,%ebp
+  807ae7:	57                   	push   %edi
+  807ae8:	56                   	push   %esi
+  807ae9:	53                   	push   %ebx
+  807aea:	83 ec 14             	sub    $0x14,%esp
+  807aed:	8b 7d 08             	mov    0x8(%ebp),%edi
+  807af0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  807af3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  807af6:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  807af9:	85 c0                	test   %eax,%eax
+  807afb:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  807b00:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  807b03:	ff 33                	push   (%ebx)
+  807b05:	50                   	push   %eax
+  807b06:	e8 95 fd ff ff       	call   8078a0 <sys_ipc_recv>
+  807b0b:	83 c4 10             	add    $0x10,%esp
+  807b0e:	85 c0                	test   %eax,%eax
+  807b10:	78 39                	js     807b4b <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  807b12:	85 ff                	test   %edi,%edi
+  807b14:	74 0a                	je     807b20 <ipc_recv_pages+0x3c>
+  807b16:	a1 8c 3f 84 00       	mov    0x843f8c,%eax
+  807b1b:	8b 40 7c             	mov    0x7c(%eax),%eax
+  807b1e:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  807b20:	85 f6                	test   %esi,%esi
+  807b22:	74 0d                	je     807b31 <ipc_recv_pages+0x4d>
+  807b24:	a1 8c 3f 84 00       	mov    0x843f8c,%eax
+  807b29:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  807b2f:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  807b31:	a1 8c 3f 84 00       	mov    0x843f8c,%eax
+  807b36:	8b 40 74             	mov    0x74(%eax),%eax
+  807b39:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  807b3b:	a1 8c 3f 84 00       	mov    0x843f8c,%eax
+  807b40:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  807b43:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  807b46:	5b                   	pop    %ebx
+  807b47:	5e                   	pop    %esi
+  807b48:	5f                   	pop    %edi
+  807b49:	5d                   	pop    %ebp
+  807b4a:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  807b4b:	85 ff                	test   %edi,%edi
+  807b4d:	74 06                	je     807b55 <ipc_recv_pages+0x71>
+  807b4f:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  807b55:	85 f6                	test   %esi,%esi
+  807b57:	74 06                	je     807b5f <ipc_recv_pages+0x7b>
+  807b59:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  807b5f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  807b65:	eb dc                	jmp    807b43 <ipc_recv_pages+0x5f>
+
+00807b67 <ipc_recv>:
+{
+  807b67:	55                   	push   %ebp
+  807b68:	89 e5                	mov    %esp,%ebp
+  807b6a:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  807b6d:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  807b74:	ff 75 10             	push   0x10(%ebp)
+  807b77:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  807b7a:	50                   	push   %eax
+  807b7b:	ff 75 0c             	push   0xc(%ebp)
+  807b7e:	ff 75 08             	push   0x8(%ebp)
+  807b81:	e8 5e ff ff ff       	call   807ae4 <ipc_recv_pages>
+}
+  807b86:	c9                   	leave
+  807b87:	c3                   	ret
+
+00807b88 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  807b88:	55                   	push   %ebp
+  807b89:	89 e5                	mov    %esp,%ebp
+  807b8b:	57                   	push   %edi
+  807b8c:	56                   	push   %esi
+  807b8d:	53                   	push   %ebx
+  807b8e:	83 ec 0c             	sub    $0xc,%esp
+  807b91:	8b 7d 08             	mov    0x8(%ebp),%edi
+  807b94:	8b 75 0c             	mov    0xc(%ebp),%esi
+  807b97:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  807b9a:	89 c3                	mov    %eax,%ebx
+  807b9c:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  807ba2:	85 c0                	test   %eax,%eax
+  807ba4:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  807ba9:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  807bac:	83 ec 0c             	sub    $0xc,%esp
+  807baf:	ff 75 14             	push   0x14(%ebp)
+  807bb2:	ff 75 18             	push   0x18(%ebp)
+  807bb5:	53                   	push   %ebx
+  807bb6:	56                   	push   %esi
+  807bb7:	57                   	push   %edi
+  807bb8:	e8 c2 fc ff ff       	call   80787f <sys_ipc_try_send>
+  807bbd:	83 c4 20             	add    $0x20,%esp
+  807bc0:	85 c0                	test   %eax,%eax
+  807bc2:	79 1e                	jns    807be2 <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  807bc4:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  807bc7:	75 07                	jne    807bd0 <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  807bc9:	e8 98 f9 ff ff       	call   807566 <sys_yield>
+  807bce:	eb dc                	jmp    807bac <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  807bd0:	50                   	push   %eax
+  807bd1:	68 ce a5 80 00       	push   $0x80a5ce
+  807bd6:	6a 5c                	push   $0x5c
+  807bd8:	68 db a5 80 00       	push   $0x80a5db
+  807bdd:	e8 ee ee ff ff       	call   806ad0 <_panic>
+  }
+}
+  807be2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  807be5:	5b                   	pop    %ebx
+  807be6:	5e                   	pop    %esi
+  807be7:	5f                   	pop    %edi
+  807be8:	5d                   	pop    %ebp
+  807be9:	c3                   	ret
+
+00807bea <ipc_send>:
+{
+  807bea:	55                   	push   %ebp
+  807beb:	89 e5                	mov    %esp,%ebp
+  807bed:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  807bf0:	ff 75 14             	push   0x14(%ebp)
+  807bf3:	6a 01                	push   $0x1
+  807bf5:	ff 75 10             	push   0x10(%ebp)
+  807bf8:	ff 75 0c             	push   0xc(%ebp)
+  807bfb:	ff 75 08             	push   0x8(%ebp)
+  807bfe:	e8 85 ff ff ff       	call   807b88 <ipc_send_pages>
+}
+  807c03:	83 c4 20             	add    $0x20,%esp
+  807c06:	c9                   	leave
+  807c07:	c3                   	ret
+
+00807c08 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  807c08:	55                   	push   %ebp
+  807c09:	89 e5                	mov    %esp,%ebp
+  807c0b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  807c0e:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  807c13:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  807c16:	c1 e0 04             	shl    $0x4,%eax
+  807c19:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  807c1e:	8b 40 50             	mov    0x50(%eax),%eax
+  807c21:	39 c8                	cmp    %ecx,%eax
+  807c23:	74 12                	je     807c37 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  807c25:	83 c2 01             	add    $0x1,%edx
+  807c28:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  807c2e:	75 e3                	jne    807c13 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  807c30:	b8 00 00 00 00       	mov    $0x0,%eax
+  807c35:	eb 0e                	jmp    807c45 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  807c37:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  807c3a:	c1 e0 04             	shl    $0x4,%eax
+  807c3d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  807c42:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  807c45:	5d                   	pop    %ebp
+  807c46:	c3                   	ret
+
+00807c47 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  807c47:	55                   	push   %ebp
+  807c48:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  807c4a:	8b 45 08             	mov    0x8(%ebp),%eax
+  807c4d:	05 00 00 00 30       	add    $0x30000000,%eax
+  807c52:	c1 e8 0c             	shr    $0xc,%eax
+}
+  807c55:	5d                   	pop    %ebp
+  807c56:	c3                   	ret
+
+00807c57 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  807c57:	55                   	push   %ebp
+  807c58:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  807c5a:	8b 45 08             	mov    0x8(%ebp),%eax
+  807c5d:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  807c60:	66 b8 00 00          	mov    $0x0,%ax
+  807c64:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  807c69:	5d                   	pop    %ebp
+  807c6a:	c3                   	ret
+
+00807c6b <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  807c6b:	55                   	push   %ebp
+  807c6c:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  807c6e:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  807c73:	eb 02                	jmp    807c77 <fd_alloc+0xc>
+  807c75:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  807c77:	89 c2                	mov    %eax,%edx
+  807c79:	c1 ea 16             	shr    $0x16,%edx
+  807c7c:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  807c83:	f6 c2 01             	test   $0x1,%dl
+  807c86:	74 2b                	je     807cb3 <fd_alloc+0x48>
+  807c88:	89 c2                	mov    %eax,%edx
+  807c8a:	c1 ea 0c             	shr    $0xc,%edx
+  807c8d:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  807c94:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  807c9a:	f6 c1 01             	test   $0x1,%cl
+  807c9d:	74 14                	je     807cb3 <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  807c9f:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  807ca5:	75 ce                	jne    807c75 <fd_alloc+0xa>
+  807ca7:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  807cac:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  807cb1:	eb 05                	jmp    807cb8 <fd_alloc+0x4d>
+      return 0;
+  807cb3:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  807cb8:	8b 55 08             	mov    0x8(%ebp),%edx
+  807cbb:	89 02                	mov    %eax,(%edx)
+}
+  807cbd:	89 c8                	mov    %ecx,%eax
+  807cbf:	5d                   	pop    %ebp
+  807cc0:	c3                   	ret
+
+00807cc1 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  807cc1:	55                   	push   %ebp
+  807cc2:	89 e5                	mov    %esp,%ebp
+  807cc4:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  807cc7:	83 f8 1f             	cmp    $0x1f,%eax
+  807cca:	77 30                	ja     807cfc <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  807ccc:	c1 e0 0c             	shl    $0xc,%eax
+  807ccf:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  807cd4:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  807cda:	f6 c2 01             	test   $0x1,%dl
+  807cdd:	74 24                	je     807d03 <fd_lookup+0x42>
+  807cdf:	89 c2                	mov    %eax,%edx
+  807ce1:	c1 ea 0c             	shr    $0xc,%edx
+  807ce4:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  807ceb:	f6 c2 01             	test   $0x1,%dl
+  807cee:	74 1a                	je     807d0a <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  807cf0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  807cf3:	89 02                	mov    %eax,(%edx)
+  return 0;
+  807cf5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  807cfa:	5d                   	pop    %ebp
+  807cfb:	c3                   	ret
+    return -E_INVAL;
+  807cfc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  807d01:	eb f7                	jmp    807cfa <fd_lookup+0x39>
+    return -E_INVAL;
+  807d03:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  807d08:	eb f0                	jmp    807cfa <fd_lookup+0x39>
+  807d0a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  807d0f:	eb e9                	jmp    807cfa <fd_lookup+0x39>
+
+00807d11 <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  807d11:	55                   	push   %ebp
+  807d12:	89 e5                	mov    %esp,%ebp
+  807d14:	53                   	push   %ebx
+  807d15:	83 ec 04             	sub    $0x4,%esp
+  807d18:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  807d1b:	b8 64 a6 80 00       	mov    $0x80a664,%eax
+  807d20:	8b 18                	mov    (%eax),%ebx
+  807d22:	85 db                	test   %ebx,%ebx
+  807d24:	74 0e                	je     807d34 <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  807d26:	83 c0 04             	add    $0x4,%eax
+  807d29:	39 13                	cmp    %edx,(%ebx)
+  807d2b:	75 f3                	jne    807d20 <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  807d2d:	b8 00 00 00 00       	mov    $0x0,%eax
+  807d32:	eb 1f                	jmp    807d53 <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  807d34:	a1 8c 3f 84 00       	mov    0x843f8c,%eax
+  807d39:	8b 40 48             	mov    0x48(%eax),%eax
+  807d3c:	83 ec 04             	sub    $0x4,%esp
+  807d3f:	52                   	push   %edx
+  807d40:	50                   	push   %eax
+  807d41:	68 e8 a5 80 00       	push   $0x80a5e8
+  807d46:	e8 60 ee ff ff       	call   806bab <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  807d4b:	83 c4 10             	add    $0x10,%esp
+  807d4e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  807d53:	8b 55 0c             	mov    0xc(%ebp),%edx
+  807d56:	89 1a                	mov    %ebx,(%edx)
+}
+  807d58:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  807d5b:	c9                   	leave
+  807d5c:	c3                   	ret
+
+00807d5d <fd_close>:
+{
+  807d5d:	55                   	push   %ebp
+  807d5e:	89 e5                	mov    %esp,%ebp
+  807d60:	57                   	push   %edi
+  807d61:	56                   	push   %esi
+  807d62:	53                   	push   %ebx
+  807d63:	83 ec 24             	sub    $0x24,%esp
+  807d66:	8b 75 08             	mov    0x8(%ebp),%esi
+  807d69:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  807d6c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  807d6f:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  807d70:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  807d76:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  807d79:	50                   	push   %eax
+  807d7a:	e8 42 ff ff ff       	call   807cc1 <fd_lookup>
+  807d7f:	89 c3                	mov    %eax,%ebx
+  807d81:	83 c4 10             	add    $0x10,%esp
+  807d84:	85 c0                	test   %eax,%eax
+  807d86:	78 05                	js     807d8d <fd_close+0x30>
+      || fd != fd2)
+  807d88:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  807d8b:	74 16                	je     807da3 <fd_close+0x46>
+    return must_exist ? r : 0;
+  807d8d:	89 f8                	mov    %edi,%eax
+  807d8f:	84 c0                	test   %al,%al
+  807d91:	b8 00 00 00 00       	mov    $0x0,%eax
+  807d96:	0f 44 d8             	cmove  %eax,%ebx
+}
+  807d99:	89 d8                	mov    %ebx,%eax
+  807d9b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  807d9e:	5b                   	pop    %ebx
+  807d9f:	5e                   	pop    %esi
+  807da0:	5f                   	pop    %edi
+  807da1:	5d                   	pop    %ebp
+  807da2:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  807da3:	83 ec 08             	sub    $0x8,%esp
+  807da6:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  807da9:	50                   	push   %eax
+  807daa:	ff 36                	push   (%esi)
+  807dac:	e8 60 ff ff ff       	call   807d11 <dev_lookup>
+  807db1:	89 c3                	mov    %eax,%ebx
+  807db3:	83 c4 10             	add    $0x10,%esp
+  807db6:	85 c0                	test   %eax,%eax
+  807db8:	78 1a                	js     807dd4 <fd_close+0x77>
+    if (dev->dev_close)
+  807dba:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  807dbd:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  807dc0:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  807dc5:	85 c0                	test   %eax,%eax
+  807dc7:	74 0b                	je     807dd4 <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  807dc9:	83 ec 0c             	sub    $0xc,%esp
+  807dcc:	56                   	push   %esi
+  807dcd:	ff d0                	call   *%eax
+  807dcf:	89 c3                	mov    %eax,%ebx
+  807dd1:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  807dd4:	83 ec 08             	sub    $0x8,%esp
+  807dd7:	56                   	push   %esi
+  807dd8:	6a 00                	push   $0x0
+  807dda:	e8 6e f8 ff ff       	call   80764d <sys_page_unmap>
+  return r;
+  807ddf:	83 c4 10             	add    $0x10,%esp
+  807de2:	eb b5                	jmp    807d99 <fd_close+0x3c>
+
+00807de4 <close>:
+
+int
+close(int fdnum)
+{
+  807de4:	55                   	push   %ebp
+  807de5:	89 e5                	mov    %esp,%ebp
+  807de7:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  807dea:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  807ded:	50                   	push   %eax
+  807dee:	ff 75 08             	push   0x8(%ebp)
+  807df1:	e8 cb fe ff ff       	call   807cc1 <fd_lookup>
+  807df6:	83 c4 10             	add    $0x10,%esp
+  807df9:	85 c0                	test   %eax,%eax
+  807dfb:	79 02                	jns    807dff <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  807dfd:	c9                   	leave
+  807dfe:	c3                   	ret
+    return fd_close(fd, 1);
+  807dff:	83 ec 08             	sub    $0x8,%esp
+  807e02:	6a 01                	push   $0x1
+  807e04:	ff 75 f4             	push   -0xc(%ebp)
+  807e07:	e8 51 ff ff ff       	call   807d5d <fd_close>
+  807e0c:	83 c4 10             	add    $0x10,%esp
+  807e0f:	eb ec                	jmp    807dfd <close+0x19>
+
+00807e11 <close_all>:
+
+void
+close_all(void)
+{
+  807e11:	55                   	push   %ebp
+  807e12:	89 e5                	mov    %esp,%ebp
+  807e14:	53                   	push   %ebx
+  807e15:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  807e18:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  807e1d:	83 ec 0c             	sub    $0xc,%esp
+  807e20:	53                   	push   %ebx
+  807e21:	e8 be ff ff ff       	call   807de4 <close>
+  for (i = 0; i < MAXFD; i++)
+  807e26:	83 c3 01             	add    $0x1,%ebx
+  807e29:	83 c4 10             	add    $0x10,%esp
+  807e2c:	83 fb 20             	cmp    $0x20,%ebx
+  807e2f:	75 ec                	jne    807e1d <close_all+0xc>
+}
+  807e31:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  807e34:	c9                   	leave
+  807e35:	c3                   	ret
+
+00807e36 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  807e36:	55                   	push   %ebp
+  807e37:	89 e5                	mov    %esp,%ebp
+  807e39:	57                   	push   %edi
+  807e3a:	56                   	push   %esi
+  807e3b:	53                   	push   %ebx
+  807e3c:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  807e3f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  807e42:	50                   	push   %eax
+  807e43:	ff 75 08             	push   0x8(%ebp)
+  807e46:	e8 76 fe ff ff       	call   807cc1 <fd_lookup>
+  807e4b:	89 c6                	mov    %eax,%esi
+  807e4d:	83 c4 10             	add    $0x10,%esp
+  807e50:	85 c0                	test   %eax,%eax
+  807e52:	0f 88 0a 01 00 00    	js     807f62 <dup+0x12c>
+    return r;
+  close(newfdnum);
+  807e58:	83 ec 0c             	sub    $0xc,%esp
+  807e5b:	ff 75 0c             	push   0xc(%ebp)
+  807e5e:	e8 81 ff ff ff       	call   807de4 <close>
+
+  newfd = INDEX2FD(newfdnum);
+  807e63:	8b 45 0c             	mov    0xc(%ebp),%eax
+  807e66:	c1 e0 0c             	shl    $0xc,%eax
+  807e69:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  807e6f:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  807e72:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  807e75:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  807e78:	89 04 24             	mov    %eax,(%esp)
+  807e7b:	e8 d7 fd ff ff       	call   807c57 <fd2data>
+  807e80:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  807e82:	89 3c 24             	mov    %edi,(%esp)
+  807e85:	e8 cd fd ff ff       	call   807c57 <fd2data>
+  807e8a:	83 c4 10             	add    $0x10,%esp
+  807e8d:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  807e90:	89 f3                	mov    %esi,%ebx
+  807e92:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  807e98:	89 c6                	mov    %eax,%esi
+  807e9a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  807e9d:	89 cf                	mov    %ecx,%edi
+  807e9f:	eb 0c                	jmp    807ead <dup+0x77>
+  807ea1:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  807ea7:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  807ead:	39 fb                	cmp    %edi,%ebx
+  807eaf:	74 7b                	je     807f2c <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  807eb1:	89 d8                	mov    %ebx,%eax
+  807eb3:	c1 e8 16             	shr    $0x16,%eax
+  807eb6:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  807ebd:	a8 01                	test   $0x1,%al
+  807ebf:	74 e0                	je     807ea1 <dup+0x6b>
+  807ec1:	89 d8                	mov    %ebx,%eax
+  807ec3:	c1 e8 0c             	shr    $0xc,%eax
+  807ec6:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  807ecd:	f6 c2 01             	test   $0x1,%dl
+  807ed0:	74 cf                	je     807ea1 <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  807ed2:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  807ed9:	83 ec 0c             	sub    $0xc,%esp
+  807edc:	25 07 0e 00 00       	and    $0xe07,%eax
+  807ee1:	50                   	push   %eax
+  807ee2:	56                   	push   %esi
+  807ee3:	6a 00                	push   $0x0
+  807ee5:	53                   	push   %ebx
+  807ee6:	6a 00                	push   $0x0
+  807ee8:	e8 1e f7 ff ff       	call   80760b <sys_page_map>
+  807eed:	83 c4 20             	add    $0x20,%esp
+  807ef0:	85 c0                	test   %eax,%eax
+  807ef2:	79 ad                	jns    807ea1 <dup+0x6b>
+  807ef4:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  807ef7:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  807ef9:	83 ec 08             	sub    $0x8,%esp
+  807efc:	ff 75 d4             	push   -0x2c(%ebp)
+  807eff:	6a 00                	push   $0x0
+  807f01:	e8 47 f7 ff ff       	call   80764d <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  807f06:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  807f09:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  807f0f:	83 c4 10             	add    $0x10,%esp
+  807f12:	39 df                	cmp    %ebx,%edi
+  807f14:	74 4c                	je     807f62 <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  807f16:	83 ec 08             	sub    $0x8,%esp
+  807f19:	57                   	push   %edi
+  807f1a:	6a 00                	push   $0x0
+  807f1c:	e8 2c f7 ff ff       	call   80764d <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  807f21:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  807f27:	83 c4 10             	add    $0x10,%esp
+  807f2a:	eb e6                	jmp    807f12 <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  807f2c:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  807f2f:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  807f32:	89 c8                	mov    %ecx,%eax
+  807f34:	c1 e8 0c             	shr    $0xc,%eax
+  807f37:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  807f3e:	83 ec 0c             	sub    $0xc,%esp
+  807f41:	25 07 0e 00 00       	and    $0xe07,%eax
+  807f46:	50                   	push   %eax
+  807f47:	ff 75 d4             	push   -0x2c(%ebp)
+  807f4a:	6a 00                	push   $0x0
+  807f4c:	51                   	push   %ecx
+  807f4d:	6a 00                	push   $0x0
+  807f4f:	e8 b7 f6 ff ff       	call   80760b <sys_page_map>
+  807f54:	89 c6                	mov    %eax,%esi
+  807f56:	83 c4 20             	add    $0x20,%esp
+  807f59:	85 c0                	test   %eax,%eax
+  807f5b:	78 9c                	js     807ef9 <dup+0xc3>
+  return newfdnum;
+  807f5d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  807f60:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  807f62:	89 f0                	mov    %esi,%eax
+  807f64:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  807f67:	5b                   	pop    %ebx
+  807f68:	5e                   	pop    %esi
+  807f69:	5f                   	pop    %edi
+  807f6a:	5d                   	pop    %ebp
+  807f6b:	c3                   	ret
+
+00807f6c <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  807f6c:	55                   	push   %ebp
+  807f6d:	89 e5                	mov    %esp,%ebp
+  807f6f:	56                   	push   %esi
+  807f70:	53                   	push   %ebx
+  807f71:	83 ec 18             	sub    $0x18,%esp
+  807f74:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  807f77:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  807f7a:	50                   	push   %eax
+  807f7b:	56                   	push   %esi
+  807f7c:	e8 40 fd ff ff       	call   807cc1 <fd_lookup>
+  807f81:	83 c4 10             	add    $0x10,%esp
+  807f84:	85 c0                	test   %eax,%eax
+  807f86:	78 3c                	js     807fc4 <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  807f88:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  807f8b:	83 ec 08             	sub    $0x8,%esp
+  807f8e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  807f91:	50                   	push   %eax
+  807f92:	ff 33                	push   (%ebx)
+  807f94:	e8 78 fd ff ff       	call   807d11 <dev_lookup>
+  807f99:	83 c4 10             	add    $0x10,%esp
+  807f9c:	85 c0                	test   %eax,%eax
+  807f9e:	78 24                	js     807fc4 <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  807fa0:	8b 43 08             	mov    0x8(%ebx),%eax
+  807fa3:	83 e0 03             	and    $0x3,%eax
+  807fa6:	83 f8 01             	cmp    $0x1,%eax
+  807fa9:	74 20                	je     807fcb <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  807fab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  807fae:	8b 40 08             	mov    0x8(%eax),%eax
+  807fb1:	85 c0                	test   %eax,%eax
+  807fb3:	74 37                	je     807fec <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  807fb5:	83 ec 04             	sub    $0x4,%esp
+  807fb8:	ff 75 10             	push   0x10(%ebp)
+  807fbb:	ff 75 0c             	push   0xc(%ebp)
+  807fbe:	53                   	push   %ebx
+  807fbf:	ff d0                	call   *%eax
+  807fc1:	83 c4 10             	add    $0x10,%esp
+}
+  807fc4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  807fc7:	5b                   	pop    %ebx
+  807fc8:	5e                   	pop    %esi
+  807fc9:	5d                   	pop    %ebp
+  807fca:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  807fcb:	a1 8c 3f 84 00       	mov    0x843f8c,%eax
+  807fd0:	8b 40 48             	mov    0x48(%eax),%eax
+  807fd3:	83 ec 04             	sub    $0x4,%esp
+  807fd6:	56                   	push   %esi
+  807fd7:	50                   	push   %eax
+  807fd8:	68 29 a6 80 00       	push   $0x80a629
+  807fdd:	e8 c9 eb ff ff       	call   806bab <cprintf>
+    return -E_INVAL;
+  807fe2:	83 c4 10             	add    $0x10,%esp
+  807fe5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  807fea:	eb d8                	jmp    807fc4 <read+0x58>
+    return -E_NOT_SUPP;
+  807fec:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  807ff1:	eb d1                	jmp    807fc4 <read+0x58>
+
+00807ff3 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  807ff3:	55                   	push   %ebp
+  807ff4:	89 e5                	mov    %esp,%ebp
+  807ff6:	57                   	push   %edi
+  807ff7:	56                   	push   %esi
+  807ff8:	53                   	push   %ebx
+  807ff9:	83 ec 0c             	sub    $0xc,%esp
+  807ffc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  807fff:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  808002:	bb 00 00 00 00       	mov    $0x0,%ebx
+  808007:	eb 02                	jmp    80800b <readn+0x18>
+  808009:	01 c3                	add    %eax,%ebx
+  80800b:	39 f3                	cmp    %esi,%ebx
+  80800d:	73 21                	jae    808030 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  80800f:	83 ec 04             	sub    $0x4,%esp
+  808012:	89 f0                	mov    %esi,%eax
+  808014:	29 d8                	sub    %ebx,%eax
+  808016:	50                   	push   %eax
+  808017:	89 d8                	mov    %ebx,%eax
+  808019:	03 45 0c             	add    0xc(%ebp),%eax
+  80801c:	50                   	push   %eax
+  80801d:	57                   	push   %edi
+  80801e:	e8 49 ff ff ff       	call   807f6c <read>
+    if (m < 0)
+  808023:	83 c4 10             	add    $0x10,%esp
+  808026:	85 c0                	test   %eax,%eax
+  808028:	78 04                	js     80802e <readn+0x3b>
+      return m;
+    if (m == 0)
+  80802a:	75 dd                	jne    808009 <readn+0x16>
+  80802c:	eb 02                	jmp    808030 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  80802e:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  808030:	89 d8                	mov    %ebx,%eax
+  808032:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  808035:	5b                   	pop    %ebx
+  808036:	5e                   	pop    %esi
+  808037:	5f                   	pop    %edi
+  808038:	5d                   	pop    %ebp
+  808039:	c3                   	ret
+
+0080803a <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80803a:	55                   	push   %ebp
+  80803b:	89 e5                	mov    %esp,%ebp
+  80803d:	56                   	push   %esi
+  80803e:	53                   	push   %ebx
+  80803f:	83 ec 18             	sub    $0x18,%esp
+  808042:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  808045:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  808048:	50                   	push   %eax
+  808049:	53                   	push   %ebx
+  80804a:	e8 72 fc ff ff       	call   807cc1 <fd_lookup>
+  80804f:	83 c4 10             	add    $0x10,%esp
+  808052:	85 c0                	test   %eax,%eax
+  808054:	78 37                	js     80808d <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  808056:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  808059:	83 ec 08             	sub    $0x8,%esp
+  80805c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80805f:	50                   	push   %eax
+  808060:	ff 36                	push   (%esi)
+  808062:	e8 aa fc ff ff       	call   807d11 <dev_lookup>
+  808067:	83 c4 10             	add    $0x10,%esp
+  80806a:	85 c0                	test   %eax,%eax
+  80806c:	78 1f                	js     80808d <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80806e:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  808072:	74 20                	je     808094 <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  808074:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  808077:	8b 40 0c             	mov    0xc(%eax),%eax
+  80807a:	85 c0                	test   %eax,%eax
+  80807c:	74 37                	je     8080b5 <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  80807e:	83 ec 04             	sub    $0x4,%esp
+  808081:	ff 75 10             	push   0x10(%ebp)
+  808084:	ff 75 0c             	push   0xc(%ebp)
+  808087:	56                   	push   %esi
+  808088:	ff d0                	call   *%eax
+  80808a:	83 c4 10             	add    $0x10,%esp
+}
+  80808d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  808090:	5b                   	pop    %ebx
+  808091:	5e                   	pop    %esi
+  808092:	5d                   	pop    %ebp
+  808093:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  808094:	a1 8c 3f 84 00       	mov    0x843f8c,%eax
+  808099:	8b 40 48             	mov    0x48(%eax),%eax
+  80809c:	83 ec 04             	sub    $0x4,%esp
+  80809f:	53                   	push   %ebx
+  8080a0:	50                   	push   %eax
+  8080a1:	68 45 a6 80 00       	push   $0x80a645
+  8080a6:	e8 00 eb ff ff       	call   806bab <cprintf>
+    return -E_INVAL;
+  8080ab:	83 c4 10             	add    $0x10,%esp
+  8080ae:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8080b3:	eb d8                	jmp    80808d <write+0x53>
+    return -E_NOT_SUPP;
+  8080b5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8080ba:	eb d1                	jmp    80808d <write+0x53>
+
+008080bc <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8080bc:	55                   	push   %ebp
+  8080bd:	89 e5                	mov    %esp,%ebp
+  8080bf:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8080c2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8080c5:	50                   	push   %eax
+  8080c6:	ff 75 08             	push   0x8(%ebp)
+  8080c9:	e8 f3 fb ff ff       	call   807cc1 <fd_lookup>
+  8080ce:	83 c4 10             	add    $0x10,%esp
+  8080d1:	85 c0                	test   %eax,%eax
+  8080d3:	78 0e                	js     8080e3 <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  8080d5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8080d8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8080db:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  8080de:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8080e3:	c9                   	leave
+  8080e4:	c3                   	ret
+
+008080e5 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8080e5:	55                   	push   %ebp
+  8080e6:	89 e5                	mov    %esp,%ebp
+  8080e8:	56                   	push   %esi
+  8080e9:	53                   	push   %ebx
+  8080ea:	83 ec 18             	sub    $0x18,%esp
+  8080ed:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  8080f0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8080f3:	50                   	push   %eax
+  8080f4:	53                   	push   %ebx
+  8080f5:	e8 c7 fb ff ff       	call   807cc1 <fd_lookup>
+  8080fa:	83 c4 10             	add    $0x10,%esp
+  8080fd:	85 c0                	test   %eax,%eax
+  8080ff:	78 34                	js     808135 <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  808101:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  808104:	83 ec 08             	sub    $0x8,%esp
+  808107:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80810a:	50                   	push   %eax
+  80810b:	ff 36                	push   (%esi)
+  80810d:	e8 ff fb ff ff       	call   807d11 <dev_lookup>
+  808112:	83 c4 10             	add    $0x10,%esp
+  808115:	85 c0                	test   %eax,%eax
+  808117:	78 1c                	js     808135 <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  808119:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80811d:	74 1d                	je     80813c <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  80811f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  808122:	8b 40 18             	mov    0x18(%eax),%eax
+  808125:	85 c0                	test   %eax,%eax
+  808127:	74 34                	je     80815d <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  808129:	83 ec 08             	sub    $0x8,%esp
+  80812c:	ff 75 0c             	push   0xc(%ebp)
+  80812f:	56                   	push   %esi
+  808130:	ff d0                	call   *%eax
+  808132:	83 c4 10             	add    $0x10,%esp
+}
+  808135:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  808138:	5b                   	pop    %ebx
+  808139:	5e                   	pop    %esi
+  80813a:	5d                   	pop    %ebp
+  80813b:	c3                   	ret
+            thisenv->env_id, fdnum);
+  80813c:	a1 8c 3f 84 00       	mov    0x843f8c,%eax
+  808141:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  808144:	83 ec 04             	sub    $0x4,%esp
+  808147:	53                   	push   %ebx
+  808148:	50                   	push   %eax
+  808149:	68 08 a6 80 00       	push   $0x80a608
+  80814e:	e8 58 ea ff ff       	call   806bab <cprintf>
+    return -E_INVAL;
+  808153:	83 c4 10             	add    $0x10,%esp
+  808156:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80815b:	eb d8                	jmp    808135 <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  80815d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  808162:	eb d1                	jmp    808135 <ftruncate+0x50>
+
+00808164 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  808164:	55                   	push   %ebp
+  808165:	89 e5                	mov    %esp,%ebp
+  808167:	56                   	push   %esi
+  808168:	53                   	push   %ebx
+  808169:	83 ec 18             	sub    $0x18,%esp
+  80816c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  80816f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  808172:	50                   	push   %eax
+  808173:	ff 75 08             	push   0x8(%ebp)
+  808176:	e8 46 fb ff ff       	call   807cc1 <fd_lookup>
+  80817b:	83 c4 10             	add    $0x10,%esp
+  80817e:	85 c0                	test   %eax,%eax
+  808180:	78 49                	js     8081cb <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  808182:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  808185:	83 ec 08             	sub    $0x8,%esp
+  808188:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80818b:	50                   	push   %eax
+  80818c:	ff 36                	push   (%esi)
+  80818e:	e8 7e fb ff ff       	call   807d11 <dev_lookup>
+  808193:	83 c4 10             	add    $0x10,%esp
+  808196:	85 c0                	test   %eax,%eax
+  808198:	78 31                	js     8081cb <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  80819a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80819d:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8081a1:	74 2f                	je     8081d2 <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  8081a3:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  8081a6:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8081ad:	00 00 00 
+  stat->st_isdir = 0;
+  8081b0:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8081b7:	00 00 00 
+  stat->st_dev = dev;
+  8081ba:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  8081c0:	83 ec 08             	sub    $0x8,%esp
+  8081c3:	53                   	push   %ebx
+  8081c4:	56                   	push   %esi
+  8081c5:	ff 50 14             	call   *0x14(%eax)
+  8081c8:	83 c4 10             	add    $0x10,%esp
+}
+  8081cb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8081ce:	5b                   	pop    %ebx
+  8081cf:	5e                   	pop    %esi
+  8081d0:	5d                   	pop    %ebp
+  8081d1:	c3                   	ret
+    return -E_NOT_SUPP;
+  8081d2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8081d7:	eb f2                	jmp    8081cb <fstat+0x67>
+
+008081d9 <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  8081d9:	55                   	push   %ebp
+  8081da:	89 e5                	mov    %esp,%ebp
+  8081dc:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  8081df:	ff 75 0c             	push   0xc(%ebp)
+  8081e2:	ff 75 08             	push   0x8(%ebp)
+  8081e5:	e8 58 07 00 00       	call   808942 <file_stat>
+}
+  8081ea:	c9                   	leave
+  8081eb:	c3                   	ret
+
+008081ec <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  8081ec:	55                   	push   %ebp
+  8081ed:	89 e5                	mov    %esp,%ebp
+  8081ef:	57                   	push   %edi
+  8081f0:	56                   	push   %esi
+  8081f1:	53                   	push   %ebx
+  8081f2:	83 ec 1c             	sub    $0x1c,%esp
+  8081f5:	89 c7                	mov    %eax,%edi
+  8081f7:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8081fa:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8081fd:	e9 a2 00 00 00       	jmp    8082a4 <fsipc_send+0xb8>
+  nfsenvs = 0;
+  808202:	c7 05 40 38 84 00 00 	movl   $0x0,0x843840
+  808209:	00 00 00 
+  80820c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  808211:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  808216:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  80821b:	be 01 00 00 00       	mov    $0x1,%esi
+  808220:	eb 0f                	jmp    808231 <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  808222:	83 c0 01             	add    $0x1,%eax
+  808225:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80822a:	74 49                	je     808275 <fsipc_send+0x89>
+  80822c:	83 f9 07             	cmp    $0x7,%ecx
+  80822f:	7f 50                	jg     808281 <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  808231:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  808234:	c1 e2 04             	shl    $0x4,%edx
+  808237:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80823d:	8b 52 50             	mov    0x50(%edx),%edx
+  808240:	83 fa 01             	cmp    $0x1,%edx
+  808243:	75 dd                	jne    808222 <fsipc_send+0x36>
+  808245:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  808248:	c1 e2 04             	shl    $0x4,%edx
+  80824b:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  808251:	8b 52 54             	mov    0x54(%edx),%edx
+  808254:	85 d2                	test   %edx,%edx
+  808256:	74 ca                	je     808222 <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  808258:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  80825b:	c1 e2 04             	shl    $0x4,%edx
+  80825e:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  808264:	8b 52 48             	mov    0x48(%edx),%edx
+  808267:	89 14 8d 60 38 84 00 	mov    %edx,0x843860(,%ecx,4)
+  80826e:	8d 49 01             	lea    0x1(%ecx),%ecx
+  808271:	89 f3                	mov    %esi,%ebx
+  808273:	eb ad                	jmp    808222 <fsipc_send+0x36>
+  808275:	84 db                	test   %bl,%bl
+  808277:	74 38                	je     8082b1 <fsipc_send+0xc5>
+  808279:	89 0d 40 38 84 00    	mov    %ecx,0x843840
+  80827f:	eb 30                	jmp    8082b1 <fsipc_send+0xc5>
+  808281:	84 db                	test   %bl,%bl
+  808283:	74 2c                	je     8082b1 <fsipc_send+0xc5>
+  808285:	89 0d 40 38 84 00    	mov    %ecx,0x843840
+  80828b:	eb 24                	jmp    8082b1 <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  80828d:	50                   	push   %eax
+  80828e:	68 74 a6 80 00       	push   $0x80a674
+  808293:	6a 34                	push   $0x34
+  808295:	68 7e a6 80 00       	push   $0x80a67e
+  80829a:	e8 31 e8 ff ff       	call   806ad0 <_panic>
+    }
+    sys_yield();
+  80829f:	e8 c2 f2 ff ff       	call   807566 <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  8082a4:	83 3d 40 38 84 00 03 	cmpl   $0x3,0x843840
+  8082ab:	0f 8e 51 ff ff ff    	jle    808202 <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  8082b1:	a1 8c 3f 84 00       	mov    0x843f8c,%eax
+  8082b6:	8b 70 48             	mov    0x48(%eax),%esi
+  8082b9:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  8082bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8082c4:	8b 0d 40 38 84 00    	mov    0x843840,%ecx
+  8082ca:	39 d9                	cmp    %ebx,%ecx
+  8082cc:	7e d1                	jle    80829f <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  8082ce:	83 ec 0c             	sub    $0xc,%esp
+  8082d1:	ff 75 e0             	push   -0x20(%ebp)
+  8082d4:	6a 07                	push   $0x7
+  8082d6:	ff 75 e4             	push   -0x1c(%ebp)
+  8082d9:	57                   	push   %edi
+  8082da:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  8082dd:	99                   	cltd
+  8082de:	f7 f9                	idiv   %ecx
+  8082e0:	ff 34 95 60 38 84 00 	push   0x843860(,%edx,4)
+  8082e7:	e8 93 f5 ff ff       	call   80787f <sys_ipc_try_send>
+      if (r == 0)
+  8082ec:	83 c4 20             	add    $0x20,%esp
+  8082ef:	85 c0                	test   %eax,%eax
+  8082f1:	74 0a                	je     8082fd <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  8082f3:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8082f6:	75 95                	jne    80828d <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  8082f8:	83 c3 01             	add    $0x1,%ebx
+  8082fb:	eb c7                	jmp    8082c4 <fsipc_send+0xd8>
+  }
+}
+  8082fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  808300:	5b                   	pop    %ebx
+  808301:	5e                   	pop    %esi
+  808302:	5f                   	pop    %edi
+  808303:	5d                   	pop    %ebp
+  808304:	c3                   	ret
+
+00808305 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  808305:	55                   	push   %ebp
+  808306:	89 e5                	mov    %esp,%ebp
+  808308:	53                   	push   %ebx
+  808309:	83 ec 14             	sub    $0x14,%esp
+  80830c:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  80830e:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  808315:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80831a:	ba 00 40 84 00       	mov    $0x844000,%edx
+  80831f:	e8 c8 fe ff ff       	call   8081ec <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  808324:	6a 00                	push   $0x0
+  808326:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  808329:	50                   	push   %eax
+  80832a:	53                   	push   %ebx
+  80832b:	6a 00                	push   $0x0
+  80832d:	e8 b2 f7 ff ff       	call   807ae4 <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  808332:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  808335:	c9                   	leave
+  808336:	c3                   	ret
+
+00808337 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  808337:	55                   	push   %ebp
+  808338:	89 e5                	mov    %esp,%ebp
+  80833a:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80833d:	8b 45 08             	mov    0x8(%ebp),%eax
+  808340:	8b 40 0c             	mov    0xc(%eax),%eax
+  808343:	a3 00 40 84 00       	mov    %eax,0x844000
+  fsipcbuf.set_size.req_size = newsize;
+  808348:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80834b:	a3 04 40 84 00       	mov    %eax,0x844004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  808350:	ba 00 00 00 00       	mov    $0x0,%edx
+  808355:	b8 02 00 00 00       	mov    $0x2,%eax
+  80835a:	e8 a6 ff ff ff       	call   808305 <fsipc>
+}
+  80835f:	c9                   	leave
+  808360:	c3                   	ret
+
+00808361 <devfile_flush>:
+{
+  808361:	55                   	push   %ebp
+  808362:	89 e5                	mov    %esp,%ebp
+  808364:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  808367:	8b 45 08             	mov    0x8(%ebp),%eax
+  80836a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80836d:	a3 00 40 84 00       	mov    %eax,0x844000
+  return fsipc(FSREQ_FLUSH, NULL);
+  808372:	ba 00 00 00 00       	mov    $0x0,%edx
+  808377:	b8 06 00 00 00       	mov    $0x6,%eax
+  80837c:	e8 84 ff ff ff       	call   808305 <fsipc>
+}
+  808381:	c9                   	leave
+  808382:	c3                   	ret
+
+00808383 <devfile_stat>:
+{
+  808383:	55                   	push   %ebp
+  808384:	89 e5                	mov    %esp,%ebp
+  808386:	53                   	push   %ebx
+  808387:	83 ec 04             	sub    $0x4,%esp
+  80838a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80838d:	8b 45 08             	mov    0x8(%ebp),%eax
+  808390:	8b 40 0c             	mov    0xc(%eax),%eax
+  808393:	a3 00 40 84 00       	mov    %eax,0x844000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  808398:	ba 00 00 00 00       	mov    $0x0,%edx
+  80839d:	b8 05 00 00 00       	mov    $0x5,%eax
+  8083a2:	e8 5e ff ff ff       	call   808305 <fsipc>
+  8083a7:	85 c0                	test   %eax,%eax
+  8083a9:	78 2c                	js     8083d7 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8083ab:	83 ec 08             	sub    $0x8,%esp
+  8083ae:	68 00 40 84 00       	push   $0x844000
+  8083b3:	53                   	push   %ebx
+  8083b4:	e8 e0 ed ff ff       	call   807199 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  8083b9:	a1 80 40 84 00       	mov    0x844080,%eax
+  8083be:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8083c4:	a1 84 40 84 00       	mov    0x844084,%eax
+  8083c9:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  8083cf:	83 c4 10             	add    $0x10,%esp
+  8083d2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8083d7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8083da:	c9                   	leave
+  8083db:	c3                   	ret
+
+008083dc <fsv_alloc>:
+{
+  8083dc:	55                   	push   %ebp
+  8083dd:	89 e5                	mov    %esp,%ebp
+  8083df:	56                   	push   %esi
+  8083e0:	53                   	push   %ebx
+  8083e1:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  8083e3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8083e8:	eb 22                	jmp    80840c <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  8083ea:	83 ec 04             	sub    $0x4,%esp
+  8083ed:	6a 00                	push   $0x0
+  8083ef:	6a 00                	push   $0x0
+  8083f1:	6a 07                	push   $0x7
+  8083f3:	50                   	push   %eax
+  8083f4:	6a 00                	push   $0x0
+  8083f6:	6a 04                	push   $0x4
+  8083f8:	68 80 38 84 00       	push   $0x843880
+  8083fd:	e8 19 f6 ff ff       	call   807a1b <sysbatch_add>
+  808402:	83 c4 20             	add    $0x20,%esp
+  808405:	85 c0                	test   %eax,%eax
+  808407:	78 48                	js     808451 <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  808409:	83 c3 01             	add    $0x1,%ebx
+  80840c:	39 f3                	cmp    %esi,%ebx
+  80840e:	74 31                	je     808441 <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  808410:	89 d8                	mov    %ebx,%eax
+  808412:	c1 e0 0c             	shl    $0xc,%eax
+  808415:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  80841a:	89 c2                	mov    %eax,%edx
+  80841c:	c1 ea 16             	shr    $0x16,%edx
+  80841f:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  808426:	f6 c2 01             	test   $0x1,%dl
+  808429:	74 bf                	je     8083ea <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  80842b:	89 c2                	mov    %eax,%edx
+  80842d:	c1 ea 0c             	shr    $0xc,%edx
+  808430:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  808437:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  80843a:	83 fa 03             	cmp    $0x3,%edx
+  80843d:	75 ab                	jne    8083ea <fsv_alloc+0xe>
+  80843f:	eb c8                	jmp    808409 <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  808441:	83 ec 0c             	sub    $0xc,%esp
+  808444:	68 80 38 84 00       	push   $0x843880
+  808449:	e8 7d f5 ff ff       	call   8079cb <sysbatch_flush>
+  80844e:	83 c4 10             	add    $0x10,%esp
+}
+  808451:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  808454:	5b                   	pop    %ebx
+  808455:	5e                   	pop    %esi
+  808456:	5d                   	pop    %ebp
+  808457:	c3                   	ret
+
+00808458 <devfile_read>:
+{
+  808458:	55                   	push   %ebp
+  808459:	89 e5                	mov    %esp,%ebp
+  80845b:	57                   	push   %edi
+  80845c:	56                   	push   %esi
+  80845d:	53                   	push   %ebx
+  80845e:	83 ec 3c             	sub    $0x3c,%esp
+  808461:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  808464:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  80846a:	77 57                	ja     8084c3 <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80846c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80846f:	8b 40 0c             	mov    0xc(%eax),%eax
+  808472:	a3 00 40 84 00       	mov    %eax,0x844000
+  fsipcbuf.read.req_n = n;
+  808477:	89 1d 04 40 84 00    	mov    %ebx,0x844004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  80847d:	ba 00 00 00 00       	mov    $0x0,%edx
+  808482:	b8 03 00 00 00       	mov    $0x3,%eax
+  808487:	e8 79 fe ff ff       	call   808305 <fsipc>
+  80848c:	89 c6                	mov    %eax,%esi
+  80848e:	85 c0                	test   %eax,%eax
+  808490:	78 27                	js     8084b9 <devfile_read+0x61>
+  assert(r <= n);
+  808492:	39 c3                	cmp    %eax,%ebx
+  808494:	0f 82 0e 02 00 00    	jb     8086a8 <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  80849a:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80849f:	0f 8f 1c 02 00 00    	jg     8086c1 <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8084a5:	83 ec 04             	sub    $0x4,%esp
+  8084a8:	50                   	push   %eax
+  8084a9:	68 00 40 84 00       	push   $0x844000
+  8084ae:	ff 75 0c             	push   0xc(%ebp)
+  8084b1:	e8 69 ee ff ff       	call   80731f <memmove>
+  return r;
+  8084b6:	83 c4 10             	add    $0x10,%esp
+}
+  8084b9:	89 f0                	mov    %esi,%eax
+  8084bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8084be:	5b                   	pop    %ebx
+  8084bf:	5e                   	pop    %esi
+  8084c0:	5f                   	pop    %edi
+  8084c1:	5d                   	pop    %ebp
+  8084c2:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  8084c3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8084c8:	e8 0f ff ff ff       	call   8083dc <fsv_alloc>
+  8084cd:	89 c6                	mov    %eax,%esi
+  8084cf:	85 c0                	test   %eax,%eax
+  8084d1:	78 e6                	js     8084b9 <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  8084d3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8084d6:	8b 40 0c             	mov    0xc(%eax),%eax
+  8084d9:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  8084de:	8b 45 08             	mov    0x8(%ebp),%eax
+  8084e1:	8b 40 04             	mov    0x4(%eax),%eax
+  8084e4:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  8084e9:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  8084ef:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  8084f6:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8084fb:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  808500:	b8 0c 00 00 00       	mov    $0xc,%eax
+  808505:	e8 e2 fc ff ff       	call   8081ec <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  80850a:	6a 00                	push   $0x0
+  80850c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80850f:	50                   	push   %eax
+  808510:	68 00 10 c0 9f       	push   $0x9fc01000
+  808515:	6a 00                	push   $0x0
+  808517:	e8 c8 f5 ff ff       	call   807ae4 <ipc_recv_pages>
+  80851c:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  80851e:	83 c4 10             	add    $0x10,%esp
+  808521:	85 c0                	test   %eax,%eax
+  808523:	7e 94                	jle    8084b9 <devfile_read+0x61>
+  assert(r <= n);
+  808525:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  808528:	39 c3                	cmp    %eax,%ebx
+  80852a:	72 2e                	jb     80855a <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  80852c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80852f:	8b 40 04             	mov    0x4(%eax),%eax
+  808532:	25 ff 0f 00 00       	and    $0xfff,%eax
+  808537:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  80853a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80853d:	c1 e2 0c             	shl    $0xc,%edx
+  808540:	39 ca                	cmp    %ecx,%edx
+  808542:	72 2f                	jb     808573 <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  808544:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  808549:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  80854c:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  808550:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  808555:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  808558:	eb 52                	jmp    8085ac <devfile_read+0x154>
+  assert(r <= n);
+  80855a:	68 89 a6 80 00       	push   $0x80a689
+  80855f:	68 2e 99 80 00       	push   $0x80992e
+  808564:	68 49 01 00 00       	push   $0x149
+  808569:	68 7e a6 80 00       	push   $0x80a67e
+  80856e:	e8 5d e5 ff ff       	call   806ad0 <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  808573:	68 9c a6 80 00       	push   $0x80a69c
+  808578:	68 2e 99 80 00       	push   $0x80992e
+  80857d:	68 4a 01 00 00       	push   $0x14a
+  808582:	68 7e a6 80 00       	push   $0x80a67e
+  808587:	e8 44 e5 ff ff       	call   806ad0 <_panic>
+      memmove(dst + done, src + done, m);
+  80858c:	83 ec 04             	sub    $0x4,%esp
+  80858f:	53                   	push   %ebx
+  808590:	56                   	push   %esi
+  808591:	89 f8                	mov    %edi,%eax
+  808593:	03 45 0c             	add    0xc(%ebp),%eax
+  808596:	50                   	push   %eax
+  808597:	e8 83 ed ff ff       	call   80731f <memmove>
+  80859c:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  80859f:	01 df                	add    %ebx,%edi
+  8085a1:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8085a4:	39 c7                	cmp    %eax,%edi
+  8085a6:	0f 83 c0 00 00 00    	jae    80866c <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  8085ac:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8085af:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  8085b2:	89 f0                	mov    %esi,%eax
+  8085b4:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8085b9:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  8085be:	29 c3                	sub    %eax,%ebx
+  8085c0:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8085c3:	29 f8                	sub    %edi,%eax
+  8085c5:	39 c3                	cmp    %eax,%ebx
+  8085c7:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  8085ca:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  8085d0:	75 ba                	jne    80858c <devfile_read+0x134>
+  8085d2:	89 f9                	mov    %edi,%ecx
+  8085d4:	03 4d 0c             	add    0xc(%ebp),%ecx
+  8085d7:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  8085da:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  8085e0:	75 aa                	jne    80858c <devfile_read+0x134>
+  8085e2:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  8085e8:	77 a2                	ja     80858c <devfile_read+0x134>
+  8085ea:	89 c8                	mov    %ecx,%eax
+  8085ec:	c1 e8 16             	shr    $0x16,%eax
+  8085ef:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8085f6:	a8 01                	test   $0x1,%al
+  8085f8:	74 92                	je     80858c <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  8085fa:	89 c8                	mov    %ecx,%eax
+  8085fc:	c1 e8 0c             	shr    $0xc,%eax
+  8085ff:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  808606:	a8 01                	test   $0x1,%al
+  808608:	74 82                	je     80858c <devfile_read+0x134>
+  80860a:	a9 02 08 00 00       	test   $0x802,%eax
+  80860f:	0f 84 77 ff ff ff    	je     80858c <devfile_read+0x134>
+  808615:	f6 c4 04             	test   $0x4,%ah
+  808618:	0f 85 6e ff ff ff    	jne    80858c <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  80861e:	a1 8c 3f 84 00       	mov    0x843f8c,%eax
+  808623:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  808627:	84 c0                	test   %al,%al
+  808629:	75 17                	jne    808642 <devfile_read+0x1ea>
+  80862b:	83 ec 08             	sub    $0x8,%esp
+  80862e:	6a 01                	push   $0x1
+  808630:	6a 00                	push   $0x0
+  808632:	e8 4e ef ff ff       	call   807585 <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  808637:	83 c4 10             	add    $0x10,%esp
+  80863a:	85 c0                	test   %eax,%eax
+  80863c:	0f 85 4a ff ff ff    	jne    80858c <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  808642:	83 ec 04             	sub    $0x4,%esp
+  808645:	68 05 08 00 00       	push   $0x805
+  80864a:	ff 75 cc             	push   -0x34(%ebp)
+  80864d:	6a 00                	push   $0x0
+  80864f:	56                   	push   %esi
+  808650:	6a 00                	push   $0x0
+  808652:	6a 05                	push   $0x5
+  808654:	68 80 38 84 00       	push   $0x843880
+  808659:	e8 bd f3 ff ff       	call   807a1b <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  80865e:	c1 e8 1f             	shr    $0x1f,%eax
+  808661:	08 45 cb             	or     %al,-0x35(%ebp)
+  808664:	83 c4 20             	add    $0x20,%esp
+  808667:	e9 33 ff ff ff       	jmp    80859f <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  80866c:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  80866f:	83 ec 0c             	sub    $0xc,%esp
+  808672:	68 80 38 84 00       	push   $0x843880
+  808677:	e8 4f f3 ff ff       	call   8079cb <sysbatch_flush>
+  80867c:	83 c4 10             	add    $0x10,%esp
+  80867f:	85 c0                	test   %eax,%eax
+  808681:	78 06                	js     808689 <devfile_read+0x231>
+  808683:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  808687:	74 14                	je     80869d <devfile_read+0x245>
+    memmove(dst, src, r);
+  808689:	83 ec 04             	sub    $0x4,%esp
+  80868c:	ff 75 d4             	push   -0x2c(%ebp)
+  80868f:	ff 75 d0             	push   -0x30(%ebp)
+  808692:	ff 75 0c             	push   0xc(%ebp)
+  808695:	e8 85 ec ff ff       	call   80731f <memmove>
+  80869a:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  80869d:	8b 45 08             	mov    0x8(%ebp),%eax
+  8086a0:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  8086a3:	e9 11 fe ff ff       	jmp    8084b9 <devfile_read+0x61>
+  assert(r <= n);
+  8086a8:	68 89 a6 80 00       	push   $0x80a689
+  8086ad:	68 2e 99 80 00       	push   $0x80992e
+  8086b2:	68 1c 01 00 00       	push   $0x11c
+  8086b7:	68 7e a6 80 00       	push   $0x80a67e
+  8086bc:	e8 0f e4 ff ff       	call   806ad0 <_panic>
+  assert(r <= PGSIZE);
+  8086c1:	68 90 a6 80 00       	push   $0x80a690
+  8086c6:	68 2e 99 80 00       	push   $0x80992e
+  8086cb:	68 1d 01 00 00       	push   $0x11d
+  8086d0:	68 7e a6 80 00       	push   $0x80a67e
+  8086d5:	e8 f6 e3 ff ff       	call   806ad0 <_panic>
+
+008086da <devfile_write>:
+{
+  8086da:	55                   	push   %ebp
+  8086db:	89 e5                	mov    %esp,%ebp
+  8086dd:	57                   	push   %edi
+  8086de:	56                   	push   %esi
+  8086df:	53                   	push   %ebx
+  8086e0:	83 ec 1c             	sub    $0x1c,%esp
+  8086e3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8086e6:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  8086e9:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  8086ee:	77 39                	ja     808729 <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8086f0:	8b 56 0c             	mov    0xc(%esi),%edx
+  8086f3:	89 15 00 40 84 00    	mov    %edx,0x844000
+  fsipcbuf.write.req_n = n;
+  8086f9:	a3 04 40 84 00       	mov    %eax,0x844004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  8086fe:	83 ec 04             	sub    $0x4,%esp
+  808701:	50                   	push   %eax
+  808702:	ff 75 0c             	push   0xc(%ebp)
+  808705:	68 08 40 84 00       	push   $0x844008
+  80870a:	e8 10 ec ff ff       	call   80731f <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  80870f:	ba 00 00 00 00       	mov    $0x0,%edx
+  808714:	b8 04 00 00 00       	mov    $0x4,%eax
+  808719:	e8 e7 fb ff ff       	call   808305 <fsipc>
+  80871e:	83 c4 10             	add    $0x10,%esp
+}
+  808721:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  808724:	5b                   	pop    %ebx
+  808725:	5e                   	pop    %esi
+  808726:	5f                   	pop    %edi
+  808727:	5d                   	pop    %ebp
+  808728:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  808729:	ba 00 00 10 00       	mov    $0x100000,%edx
+  80872e:	39 d0                	cmp    %edx,%eax
+  808730:	89 d3                	mov    %edx,%ebx
+  808732:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  808735:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  80873b:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  80873e:	83 c7 01             	add    $0x1,%edi
+  808741:	89 f8                	mov    %edi,%eax
+  808743:	e8 94 fc ff ff       	call   8083dc <fsv_alloc>
+  808748:	85 c0                	test   %eax,%eax
+  80874a:	78 d5                	js     808721 <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  80874c:	83 ec 04             	sub    $0x4,%esp
+  80874f:	53                   	push   %ebx
+  808750:	ff 75 0c             	push   0xc(%ebp)
+  808753:	68 00 10 c0 9f       	push   $0x9fc01000
+  808758:	e8 c2 eb ff ff       	call   80731f <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  80875d:	8b 46 0c             	mov    0xc(%esi),%eax
+  808760:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  808765:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  80876b:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  808772:	89 f9                	mov    %edi,%ecx
+  808774:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  808779:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80877e:	e8 69 fa ff ff       	call   8081ec <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  808783:	6a 00                	push   $0x0
+  808785:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  808788:	50                   	push   %eax
+  808789:	6a 00                	push   $0x0
+  80878b:	6a 00                	push   $0x0
+  80878d:	e8 52 f3 ff ff       	call   807ae4 <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  808792:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  808795:	eb 8a                	jmp    808721 <devfile_write+0x47>
+
+00808797 <open>:
+{
+  808797:	55                   	push   %ebp
+  808798:	89 e5                	mov    %esp,%ebp
+  80879a:	56                   	push   %esi
+  80879b:	53                   	push   %ebx
+  80879c:	83 ec 1c             	sub    $0x1c,%esp
+  80879f:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  8087a2:	56                   	push   %esi
+  8087a3:	e8 b6 e9 ff ff       	call   80715e <strlen>
+  8087a8:	83 c4 10             	add    $0x10,%esp
+  8087ab:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8087b0:	7f 6c                	jg     80881e <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  8087b2:	83 ec 0c             	sub    $0xc,%esp
+  8087b5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8087b8:	50                   	push   %eax
+  8087b9:	e8 ad f4 ff ff       	call   807c6b <fd_alloc>
+  8087be:	89 c3                	mov    %eax,%ebx
+  8087c0:	83 c4 10             	add    $0x10,%esp
+  8087c3:	85 c0                	test   %eax,%eax
+  8087c5:	78 3c                	js     808803 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  8087c7:	83 ec 08             	sub    $0x8,%esp
+  8087ca:	56                   	push   %esi
+  8087cb:	68 00 40 84 00       	push   $0x844000
+  8087d0:	e8 c4 e9 ff ff       	call   807199 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  8087d5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8087d8:	a3 00 44 84 00       	mov    %eax,0x844400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8087dd:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8087e0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8087e5:	e8 1b fb ff ff       	call   808305 <fsipc>
+  8087ea:	89 c3                	mov    %eax,%ebx
+  8087ec:	83 c4 10             	add    $0x10,%esp
+  8087ef:	85 c0                	test   %eax,%eax
+  8087f1:	78 19                	js     80880c <open+0x75>
+  return fd2num(fd);
+  8087f3:	83 ec 0c             	sub    $0xc,%esp
+  8087f6:	ff 75 f4             	push   -0xc(%ebp)
+  8087f9:	e8 49 f4 ff ff       	call   807c47 <fd2num>
+  8087fe:	89 c3                	mov    %eax,%ebx
+  808800:	83 c4 10             	add    $0x10,%esp
+}
+  808803:	89 d8                	mov    %ebx,%eax
+  808805:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  808808:	5b                   	pop    %ebx
+  808809:	5e                   	pop    %esi
+  80880a:	5d                   	pop    %ebp
+  80880b:	c3                   	ret
+    fd_close(fd, 0);
+  80880c:	83 ec 08             	sub    $0x8,%esp
+  80880f:	6a 00                	push   $0x0
+  808811:	ff 75 f4             	push   -0xc(%ebp)
+  808814:	e8 44 f5 ff ff       	call   807d5d <fd_close>
+    return r;
+  808819:	83 c4 10             	add    $0x10,%esp
+  80881c:	eb e5                	jmp    808803 <open+0x6c>
+    return -E_BAD_PATH;
+  80881e:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  808823:	eb de                	jmp    808803 <open+0x6c>
+
+00808825 <open_read>:
+{
+  808825:	55                   	push   %ebp
+  808826:	89 e5                	mov    %esp,%ebp
+  808828:	57                   	push   %edi
+  808829:	56                   	push   %esi
+  80882a:	53                   	push   %ebx
+  80882b:	83 ec 28             	sub    $0x28,%esp
+  80882e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  808831:	57                   	push   %edi
+  808832:	e8 27 e9 ff ff       	call   80715e <strlen>
+  808837:	83 c4 10             	add    $0x10,%esp
+  80883a:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80883f:	0f 87 f6 00 00 00    	ja     80893b <open_read+0x116>
+  808845:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  808847:	83 ec 0c             	sub    $0xc,%esp
+  80884a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80884d:	50                   	push   %eax
+  80884e:	e8 18 f4 ff ff       	call   807c6b <fd_alloc>
+  808853:	89 c3                	mov    %eax,%ebx
+  808855:	83 c4 10             	add    $0x10,%esp
+  808858:	85 c0                	test   %eax,%eax
+  80885a:	0f 88 b2 00 00 00    	js     808912 <open_read+0xed>
+  strcpy(req->req_buf, path);
+  808860:	83 ec 08             	sub    $0x8,%esp
+  808863:	57                   	push   %edi
+  808864:	68 e4 40 84 00       	push   $0x8440e4
+  808869:	e8 2b e9 ff ff       	call   807199 <strcpy>
+  req->req_nops = 2;
+  80886e:	c7 05 00 40 84 00 02 	movl   $0x2,0x844000
+  808875:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  808878:	c7 05 04 40 84 00 01 	movl   $0x1,0x844004
+  80887f:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  808882:	8b 45 0c             	mov    0xc(%ebp),%eax
+  808885:	a3 10 40 84 00       	mov    %eax,0x844010
+  req->req_ops[0].op_buf = 0;
+  80888a:	c7 05 18 40 84 00 00 	movl   $0x0,0x844018
+  808891:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  808894:	c7 05 20 40 84 00 04 	movl   $0x4,0x844020
+  80889b:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  80889e:	c7 05 24 40 84 00 01 	movl   $0x1,0x844024
+  8088a5:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  8088a8:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  8088ad:	29 f0                	sub    %esi,%eax
+  8088af:	3b 45 14             	cmp    0x14(%ebp),%eax
+  8088b2:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  8088b6:	a3 2c 40 84 00       	mov    %eax,0x84402c
+  req->req_ops[1].op_offset = 0;
+  8088bb:	c7 05 30 40 84 00 00 	movl   $0x0,0x844030
+  8088c2:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  8088c5:	83 c6 01             	add    $0x1,%esi
+  8088c8:	89 35 34 40 84 00    	mov    %esi,0x844034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  8088ce:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8088d1:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8088d6:	e8 2a fa ff ff       	call   808305 <fsipc>
+  8088db:	89 c3                	mov    %eax,%ebx
+  8088dd:	83 c4 10             	add    $0x10,%esp
+  8088e0:	83 f8 01             	cmp    $0x1,%eax
+  8088e3:	7e 37                	jle    80891c <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  8088e5:	a1 38 40 84 00       	mov    0x844038,%eax
+  8088ea:	8b 55 18             	mov    0x18(%ebp),%edx
+  8088ed:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  8088ef:	83 ec 04             	sub    $0x4,%esp
+  8088f2:	50                   	push   %eax
+  8088f3:	81 c6 e4 40 84 00    	add    $0x8440e4,%esi
+  8088f9:	56                   	push   %esi
+  8088fa:	ff 75 10             	push   0x10(%ebp)
+  8088fd:	e8 1d ea ff ff       	call   80731f <memmove>
+  return fd2num(fd);
+  808902:	83 c4 04             	add    $0x4,%esp
+  808905:	ff 75 e4             	push   -0x1c(%ebp)
+  808908:	e8 3a f3 ff ff       	call   807c47 <fd2num>
+  80890d:	89 c3                	mov    %eax,%ebx
+  80890f:	83 c4 10             	add    $0x10,%esp
+}
+  808912:	89 d8                	mov    %ebx,%eax
+  808914:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  808917:	5b                   	pop    %ebx
+  808918:	5e                   	pop    %esi
+  808919:	5f                   	pop    %edi
+  80891a:	5d                   	pop    %ebp
+  80891b:	c3                   	ret
+    fd_close(fd, 0);
+  80891c:	83 ec 08             	sub    $0x8,%esp
+  80891f:	6a 00                	push   $0x0
+  808921:	ff 75 e4             	push   -0x1c(%ebp)
+  808924:	e8 34 f4 ff ff       	call   807d5d <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  808929:	83 c4 10             	add    $0x10,%esp
+  80892c:	85 db                	test   %ebx,%ebx
+  80892e:	78 e2                	js     808912 <open_read+0xed>
+  808930:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  808933:	8b 9b 1c 40 84 00    	mov    0x84401c(%ebx),%ebx
+  808939:	eb d7                	jmp    808912 <open_read+0xed>
+    return -E_BAD_PATH;
+  80893b:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  808940:	eb d0                	jmp    808912 <open_read+0xed>
+
+00808942 <file_stat>:
+{
+  808942:	55                   	push   %ebp
+  808943:	89 e5                	mov    %esp,%ebp
+  808945:	57                   	push   %edi
+  808946:	56                   	push   %esi
+  808947:	53                   	push   %ebx
+  808948:	83 ec 18             	sub    $0x18,%esp
+  80894b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80894e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  808951:	57                   	push   %edi
+  808952:	e8 07 e8 ff ff       	call   80715e <strlen>
+  808957:	83 c4 10             	add    $0x10,%esp
+  80895a:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80895f:	0f 8f c7 00 00 00    	jg     808a2c <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  808965:	83 ec 0c             	sub    $0xc,%esp
+  808968:	57                   	push   %edi
+  808969:	e8 f0 e7 ff ff       	call   80715e <strlen>
+  80896e:	8d 58 04             	lea    0x4(%eax),%ebx
+  808971:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  808974:	83 c4 08             	add    $0x8,%esp
+  808977:	57                   	push   %edi
+  808978:	68 e4 40 84 00       	push   $0x8440e4
+  80897d:	e8 17 e8 ff ff       	call   807199 <strcpy>
+  req->req_nops = 2;
+  808982:	c7 05 00 40 84 00 02 	movl   $0x2,0x844000
+  808989:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  80898c:	c7 05 04 40 84 00 02 	movl   $0x2,0x844004
+  808993:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  808996:	c7 05 10 40 84 00 00 	movl   $0x0,0x844010
+  80899d:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  8089a0:	c7 05 18 40 84 00 00 	movl   $0x0,0x844018
+  8089a7:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  8089aa:	c7 05 20 40 84 00 03 	movl   $0x3,0x844020
+  8089b1:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  8089b4:	c7 05 24 40 84 00 01 	movl   $0x1,0x844024
+  8089bb:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  8089be:	89 1d 34 40 84 00    	mov    %ebx,0x844034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  8089c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8089c9:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8089ce:	e8 32 f9 ff ff       	call   808305 <fsipc>
+  8089d3:	83 c4 10             	add    $0x10,%esp
+  8089d6:	83 f8 01             	cmp    $0x1,%eax
+  8089d9:	7e 42                	jle    808a1d <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  8089db:	81 c3 e4 40 84 00    	add    $0x8440e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  8089e1:	83 ec 08             	sub    $0x8,%esp
+  8089e4:	53                   	push   %ebx
+  8089e5:	56                   	push   %esi
+  8089e6:	e8 ae e7 ff ff       	call   807199 <strcpy>
+  st->st_size = ret->ret_size;
+  8089eb:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  8089f1:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  8089f7:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  8089fd:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  808a03:	c7 86 88 00 00 00 64 	movl   $0x814064,0x88(%esi)
+  808a0a:	40 81 00 
+  return 0;
+  808a0d:	83 c4 10             	add    $0x10,%esp
+  808a10:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  808a15:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  808a18:	5b                   	pop    %ebx
+  808a19:	5e                   	pop    %esi
+  808a1a:	5f                   	pop    %edi
+  808a1b:	5d                   	pop    %ebp
+  808a1c:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  808a1d:	85 c0                	test   %eax,%eax
+  808a1f:	78 f4                	js     808a15 <file_stat+0xd3>
+  808a21:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  808a24:	8b 80 1c 40 84 00    	mov    0x84401c(%eax),%eax
+  808a2a:	eb e9                	jmp    808a15 <file_stat+0xd3>
+    return -E_BAD_PATH;
+  808a2c:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  808a31:	eb e2                	jmp    808a15 <file_stat+0xd3>
+
+00808a33 <read_map>:
+{
+  808a33:	55                   	push   %ebp
+  808a34:	89 e5                	mov    %esp,%ebp
+  808a36:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  808a39:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  808a3c:	50                   	push   %eax
+  808a3d:	ff 75 08             	push   0x8(%ebp)
+  808a40:	e8 7c f2 ff ff       	call   807cc1 <fd_lookup>
+  808a45:	83 c4 10             	add    $0x10,%esp
+  808a48:	85 c0                	test   %eax,%eax
+  808a4a:	78 2a                	js     808a76 <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  808a4c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  808a4f:	8b 0d 64 40 81 00    	mov    0x814064,%ecx
+  808a55:	39 08                	cmp    %ecx,(%eax)
+  808a57:	75 1f                	jne    808a78 <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  808a59:	8b 40 0c             	mov    0xc(%eax),%eax
+  808a5c:	a3 00 40 84 00       	mov    %eax,0x844000
+  fsipcbuf.read_map.req_offset = offset;
+  808a61:	8b 45 0c             	mov    0xc(%ebp),%eax
+  808a64:	a3 04 40 84 00       	mov    %eax,0x844004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  808a69:	8b 55 10             	mov    0x10(%ebp),%edx
+  808a6c:	b8 0b 00 00 00       	mov    $0xb,%eax
+  808a71:	e8 8f f8 ff ff       	call   808305 <fsipc>
+}
+  808a76:	c9                   	leave
+  808a77:	c3                   	ret
+    return -E_INVAL;
+  808a78:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  808a7d:	eb f7                	jmp    808a76 <read_map+0x43>
+
+00808a7f <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  808a7f:	55                   	push   %ebp
+  808a80:	89 e5                	mov    %esp,%ebp
+  808a82:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  808a85:	ba 00 00 00 00       	mov    $0x0,%edx
+  808a8a:	b8 08 00 00 00       	mov    $0x8,%eax
+  808a8f:	e8 71 f8 ff ff       	call   808305 <fsipc>
+}
+  808a94:	c9                   	leave
+  808a95:	c3                   	ret
+
+00808a96 <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  808a96:	55                   	push   %ebp
+  808a97:	89 e5                	mov    %esp,%ebp
+  808a99:	57                   	push   %edi
+  808a9a:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  808a9b:	8b 45 08             	mov    0x8(%ebp),%eax
+  808a9e:	a3 00 40 84 00       	mov    %eax,0x844000
+  fsipcbuf.stats.req_bio_sched = 0;
+  808aa3:	c7 05 04 40 84 00 00 	movl   $0x0,0x844004
+  808aaa:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  808aad:	c7 05 08 40 84 00 00 	movl   $0x0,0x844008
+  808ab4:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  808ab7:	ba 00 00 00 00       	mov    $0x0,%edx
+  808abc:	b8 09 00 00 00       	mov    $0x9,%eax
+  808ac1:	e8 3f f8 ff ff       	call   808305 <fsipc>
+  808ac6:	85 c0                	test   %eax,%eax
+  808ac8:	78 14                	js     808ade <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  808aca:	be 00 40 84 00       	mov    $0x844000,%esi
+  808acf:	b9 16 00 00 00       	mov    $0x16,%ecx
+  808ad4:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  808ad7:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  808ad9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  808ade:	5e                   	pop    %esi
+  808adf:	5f                   	pop    %edi
+  808ae0:	5d                   	pop    %ebp
+  808ae1:	c3                   	ret
+
+00808ae2 <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  808ae2:	55                   	push   %ebp
+  808ae3:	89 e5                	mov    %esp,%ebp
+  808ae5:	53                   	push   %ebx
+  808ae6:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  808ae9:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  808aec:	50                   	push   %eax
+  808aed:	6a 00                	push   $0x0
+  808aef:	e8 a2 ff ff ff       	call   808a96 <fs_stats>
+  808af4:	83 c4 10             	add    $0x10,%esp
+  808af7:	85 c0                	test   %eax,%eax
+  808af9:	78 28                	js     808b23 <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  808afb:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  808afe:	83 ec 08             	sub    $0x8,%esp
+  808b01:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  808b04:	50                   	push   %eax
+  808b05:	6a 20                	push   $0x20
+  808b07:	e8 8a ff ff ff       	call   808a96 <fs_stats>
+  808b0c:	83 c4 10             	add    $0x10,%esp
+  808b0f:	85 c0                	test   %eax,%eax
+  808b11:	78 10                	js     808b23 <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  808b13:	83 ec 08             	sub    $0x8,%esp
+  808b16:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  808b19:	50                   	push   %eax
+  808b1a:	53                   	push   %ebx
+  808b1b:	e8 76 ff ff ff       	call   808a96 <fs_stats>
+  808b20:	83 c4 10             	add    $0x10,%esp
+}
+  808b23:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  808b26:	c9                   	leave
+  808b27:	c3                   	ret
+
+00808b28 <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  808b28:	55                   	push   %ebp
+  808b29:	89 e5                	mov    %esp,%ebp
+  808b2b:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  808b2e:	c7 05 00 40 84 00 00 	movl   $0x0,0x844000
+  808b35:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  808b38:	8b 45 08             	mov    0x8(%ebp),%eax
+  808b3b:	a3 04 40 84 00       	mov    %eax,0x844004
+  fsipcbuf.stats.req_dcache = 0;
+  808b40:	c7 05 08 40 84 00 00 	movl   $0x0,0x844008
+  808b47:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  808b4a:	ba 00 00 00 00       	mov    $0x0,%edx
+  808b4f:	b8 09 00 00 00       	mov    $0x9,%eax
+  808b54:	e8 ac f7 ff ff       	call   808305 <fsipc>
+}
+  808b59:	c9                   	leave
+  808b5a:	c3                   	ret
+
+00808b5b <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  808b5b:	55                   	push   %ebp
+  808b5c:	89 e5                	mov    %esp,%ebp
+  808b5e:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  808b61:	c7 05 00 40 84 00 00 	movl   $0x0,0x844000
+  808b68:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  808b6b:	c7 05 04 40 84 00 00 	movl   $0x0,0x844004
+  808b72:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  808b75:	8b 45 08             	mov    0x8(%ebp),%eax
+  808b78:	a3 08 40 84 00       	mov    %eax,0x844008
+  return fsipc(FSREQ_STATS, NULL);
+  808b7d:	ba 00 00 00 00       	mov    $0x0,%edx
+  808b82:	b8 09 00 00 00       	mov    $0x9,%eax
+  808b87:	e8 79 f7 ff ff       	call   808305 <fsipc>
+}
+  808b8c:	c9                   	leave
+  808b8d:	c3                   	ret
+
+00808b8e <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  808b8e:	55                   	push   %ebp
+  808b8f:	89 e5                	mov    %esp,%ebp
+  808b91:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  808b94:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  808b97:	50                   	push   %eax
+  808b98:	ff 75 08             	push   0x8(%ebp)
+  808b9b:	e8 21 f1 ff ff       	call   807cc1 <fd_lookup>
+  808ba0:	83 c4 10             	add    $0x10,%esp
+  808ba3:	85 c0                	test   %eax,%eax
+  808ba5:	78 34                	js     808bdb <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  808ba7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  808baa:	8b 0d 64 40 81 00    	mov    0x814064,%ecx
+  808bb0:	39 08                	cmp    %ecx,(%eax)
+  808bb2:	75 29                	jne    808bdd <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  808bb4:	8b 40 0c             	mov    0xc(%eax),%eax
+  808bb7:	a3 00 40 84 00       	mov    %eax,0x844000
+  fsipcbuf.fallocate.req_offset = offset;
+  808bbc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  808bbf:	a3 04 40 84 00       	mov    %eax,0x844004
+  fsipcbuf.fallocate.req_len = len;
+  808bc4:	8b 45 10             	mov    0x10(%ebp),%eax
+  808bc7:	a3 08 40 84 00       	mov    %eax,0x844008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  808bcc:	ba 00 00 00 00       	mov    $0x0,%edx
+  808bd1:	b8 0f 00 00 00       	mov    $0xf,%eax
+  808bd6:	e8 2a f7 ff ff       	call   808305 <fsipc>
+}
+  808bdb:	c9                   	leave
+  808bdc:	c3                   	ret
+    return -E_INVAL;
+  808bdd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  808be2:	eb f7                	jmp    808bdb <fallocate+0x4d>
+
+00808be4 <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  808be4:	55                   	push   %ebp
+  808be5:	89 e5                	mov    %esp,%ebp
+  808be7:	57                   	push   %edi
+  808be8:	56                   	push   %esi
+  808be9:	53                   	push   %ebx
+  808bea:	83 ec 24             	sub    $0x24,%esp
+  808bed:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  808bf0:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  808bf3:	50                   	push   %eax
+  808bf4:	ff 75 08             	push   0x8(%ebp)
+  808bf7:	e8 c5 f0 ff ff       	call   807cc1 <fd_lookup>
+  808bfc:	83 c4 10             	add    $0x10,%esp
+  808bff:	85 c0                	test   %eax,%eax
+  808c01:	78 66                	js     808c69 <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  808c03:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  808c06:	8b 0d 64 40 81 00    	mov    0x814064,%ecx
+  808c0c:	39 08                	cmp    %ecx,(%eax)
+  808c0e:	75 61                	jne    808c71 <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  808c10:	85 f6                	test   %esi,%esi
+  808c12:	7e 50                	jle    808c64 <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  808c14:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  808c19:	39 de                	cmp    %ebx,%esi
+  808c1b:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  808c1e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  808c21:	8b 40 0c             	mov    0xc(%eax),%eax
+  808c24:	a3 00 40 84 00       	mov    %eax,0x844000
+    fsipcbuf.prefetch.req_n = m;
+  808c29:	89 1d 04 40 84 00    	mov    %ebx,0x844004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  808c2f:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  808c36:	83 ec 04             	sub    $0x4,%esp
+  808c39:	57                   	push   %edi
+  808c3a:	ff 75 0c             	push   0xc(%ebp)
+  808c3d:	68 08 40 84 00       	push   $0x844008
+  808c42:	e8 d8 e6 ff ff       	call   80731f <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  808c47:	ba 00 00 00 00       	mov    $0x0,%edx
+  808c4c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  808c51:	e8 af f6 ff ff       	call   808305 <fsipc>
+  808c56:	83 c4 10             	add    $0x10,%esp
+  808c59:	85 c0                	test   %eax,%eax
+  808c5b:	78 0c                	js     808c69 <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  808c5d:	01 7d 0c             	add    %edi,0xc(%ebp)
+  808c60:	29 de                	sub    %ebx,%esi
+  808c62:	eb ac                	jmp    808c10 <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  808c64:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  808c69:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  808c6c:	5b                   	pop    %ebx
+  808c6d:	5e                   	pop    %esi
+  808c6e:	5f                   	pop    %edi
+  808c6f:	5d                   	pop    %ebp
+  808c70:	c3                   	ret
+    return -E_INVAL;
+  808c71:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  808c76:	eb f1                	jmp    808c69 <prefetch+0x85>
+
+00808c78 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  808c78:	55                   	push   %ebp
+  808c79:	89 e5                	mov    %esp,%ebp
+  808c7b:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  808c7e:	89 c2                	mov    %eax,%edx
+  808c80:	c1 ea 16             	shr    $0x16,%edx
+  808c83:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  808c8a:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  808c8f:	f6 c1 01             	test   $0x1,%cl
+  808c92:	74 1c                	je     808cb0 <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  808c94:	c1 e8 0c             	shr    $0xc,%eax
+  808c97:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  808c9e:	a8 01                	test   $0x1,%al
+  808ca0:	74 0e                	je     808cb0 <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  808ca2:	c1 e8 0c             	shr    $0xc,%eax
+  808ca5:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  808cac:	ef 
+  808cad:	0f b7 d2             	movzwl %dx,%edx
+}
+  808cb0:	89 d0                	mov    %edx,%eax
+  808cb2:	5d                   	pop    %ebp
+  808cb3:	c3                   	ret
+
+00808cb4 <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  808cb4:	55                   	push   %ebp
+  808cb5:	89 e5                	mov    %esp,%ebp
+  808cb7:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  808cba:	50                   	push   %eax
+  808cbb:	e8 97 ef ff ff       	call   807c57 <fd2data>
+  808cc0:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  808cc5:	c9                   	leave
+  808cc6:	c3                   	ret
+
+00808cc7 <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  808cc7:	55                   	push   %ebp
+  808cc8:	89 e5                	mov    %esp,%ebp
+  808cca:	56                   	push   %esi
+  808ccb:	53                   	push   %ebx
+  808ccc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  808ccf:	83 ec 0c             	sub    $0xc,%esp
+  808cd2:	ff 75 08             	push   0x8(%ebp)
+  808cd5:	e8 7d ef ff ff       	call   807c57 <fd2data>
+  808cda:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  808cdc:	83 c4 08             	add    $0x8,%esp
+  808cdf:	68 c8 a6 80 00       	push   $0x80a6c8
+  808ce4:	53                   	push   %ebx
+  808ce5:	e8 af e4 ff ff       	call   807199 <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  808cea:	8b 46 04             	mov    0x4(%esi),%eax
+  808ced:	2b 06                	sub    (%esi),%eax
+  808cef:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  808cf5:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  808cfc:	00 00 00 
+  stat->st_dev = &devpipe;
+  808cff:	c7 83 88 00 00 00 80 	movl   $0x814080,0x88(%ebx)
+  808d06:	40 81 00 
+  return 0;
+}
+  808d09:	b8 00 00 00 00       	mov    $0x0,%eax
+  808d0e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  808d11:	5b                   	pop    %ebx
+  808d12:	5e                   	pop    %esi
+  808d13:	5d                   	pop    %ebp
+  808d14:	c3                   	ret
+
+00808d15 <pipe_wakeup>:
+{
+  808d15:	89 c1                	mov    %eax,%ecx
+  asm volatile ("lock; xchgl %0, %1" :
+  808d17:	b8 00 00 00 00       	mov    $0x0,%eax
+  808d1c:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  808d1f:	85 c0                	test   %eax,%eax
+  808d21:	75 01                	jne    808d24 <pipe_wakeup+0xf>
+  808d23:	c3                   	ret
+{
+  808d24:	55                   	push   %ebp
+  808d25:	89 e5                	mov    %esp,%ebp
+  808d27:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  808d2a:	6a 00                	push   $0x0
+  808d2c:	68 00 00 c0 ee       	push   $0xeec00000
+  808d31:	52                   	push   %edx
+  808d32:	e8 ed eb ff ff       	call   807924 <sys_chan_wakeup>
+  808d37:	83 c4 10             	add    $0x10,%esp
+}
+  808d3a:	c9                   	leave
+  808d3b:	c3                   	ret
+
+00808d3c <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  808d3c:	55                   	push   %ebp
+  808d3d:	89 e5                	mov    %esp,%ebp
+  808d3f:	57                   	push   %edi
+  808d40:	56                   	push   %esi
+  808d41:	53                   	push   %ebx
+  808d42:	83 ec 18             	sub    $0x18,%esp
+  808d45:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  808d48:	57                   	push   %edi
+  808d49:	e8 09 ef ff ff       	call   807c57 <fd2data>
+  808d4e:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  808d50:	83 c4 10             	add    $0x10,%esp
+  808d53:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  808d57:	74 2a                	je     808d83 <devpipe_close+0x47>
+  808d59:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  808d5e:	89 f8                	mov    %edi,%eax
+  808d60:	e8 4f ff ff ff       	call   808cb4 <pipe_ring>
+  808d65:	83 ec 08             	sub    $0x8,%esp
+  808d68:	01 d8                	add    %ebx,%eax
+  808d6a:	50                   	push   %eax
+  808d6b:	6a 00                	push   $0x0
+  808d6d:	e8 db e8 ff ff       	call   80764d <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  808d72:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  808d78:	83 c4 10             	add    $0x10,%esp
+  808d7b:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  808d81:	75 db                	jne    808d5e <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  808d83:	83 ec 08             	sub    $0x8,%esp
+  808d86:	57                   	push   %edi
+  808d87:	6a 00                	push   $0x0
+  808d89:	e8 bf e8 ff ff       	call   80764d <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  808d8e:	83 c4 10             	add    $0x10,%esp
+  808d91:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  808d95:	75 13                	jne    808daa <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  808d97:	83 ec 08             	sub    $0x8,%esp
+  808d9a:	56                   	push   %esi
+  808d9b:	6a 00                	push   $0x0
+  808d9d:	e8 ab e8 ff ff       	call   80764d <sys_page_unmap>
+}
+  808da2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  808da5:	5b                   	pop    %ebx
+  808da6:	5e                   	pop    %esi
+  808da7:	5f                   	pop    %edi
+  808da8:	5d                   	pop    %ebp
+  808da9:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  808daa:	8d 56 04             	lea    0x4(%esi),%edx
+  808dad:	8d 46 2c             	lea    0x2c(%esi),%eax
+  808db0:	e8 60 ff ff ff       	call   808d15 <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  808db5:	8d 46 30             	lea    0x30(%esi),%eax
+  808db8:	89 f2                	mov    %esi,%edx
+  808dba:	e8 56 ff ff ff       	call   808d15 <pipe_wakeup>
+  808dbf:	eb d6                	jmp    808d97 <devpipe_close+0x5b>
+
+00808dc1 <_pipeisclosed>:
+{
+  808dc1:	55                   	push   %ebp
+  808dc2:	89 e5                	mov    %esp,%ebp
+  808dc4:	57                   	push   %edi
+  808dc5:	56                   	push   %esi
+  808dc6:	53                   	push   %ebx
+  808dc7:	83 ec 1c             	sub    $0x1c,%esp
+  808dca:	89 c7                	mov    %eax,%edi
+  808dcc:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  808dce:	a1 8c 3f 84 00       	mov    0x843f8c,%eax
+  808dd3:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  808dd6:	83 ec 0c             	sub    $0xc,%esp
+  808dd9:	57                   	push   %edi
+  808dda:	e8 99 fe ff ff       	call   808c78 <pageref>
+  808ddf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  808de2:	89 34 24             	mov    %esi,(%esp)
+  808de5:	e8 8e fe ff ff       	call   808c78 <pageref>
+    nn = thisenv->env_runs;
+  808dea:	8b 15 8c 3f 84 00    	mov    0x843f8c,%edx
+  808df0:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  808df3:	83 c4 10             	add    $0x10,%esp
+  808df6:	39 cb                	cmp    %ecx,%ebx
+  808df8:	74 1b                	je     808e15 <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  808dfa:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  808dfd:	75 cf                	jne    808dce <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  808dff:	8b 42 58             	mov    0x58(%edx),%eax
+  808e02:	6a 01                	push   $0x1
+  808e04:	50                   	push   %eax
+  808e05:	53                   	push   %ebx
+  808e06:	68 cf a6 80 00       	push   $0x80a6cf
+  808e0b:	e8 9b dd ff ff       	call   806bab <cprintf>
+  808e10:	83 c4 10             	add    $0x10,%esp
+  808e13:	eb b9                	jmp    808dce <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  808e15:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  808e18:	0f 94 c0             	sete   %al
+  808e1b:	0f b6 c0             	movzbl %al,%eax
+}
+  808e1e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  808e21:	5b                   	pop    %ebx
+  808e22:	5e                   	pop    %esi
+  808e23:	5f                   	pop    %edi
+  808e24:	5d                   	pop    %ebp
+  808e25:	c3                   	ret
+
+00808e26 <devpipe_write_bulk>:
+{
+  808e26:	55                   	push   %ebp
+  808e27:	89 e5                	mov    %esp,%ebp
+  808e29:	57                   	push   %edi
+  808e2a:	56                   	push   %esi
+  808e2b:	53                   	push   %ebx
+  808e2c:	83 ec 1c             	sub    $0x1c,%esp
+  808e2f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  808e32:	89 d6                	mov    %edx,%esi
+  808e34:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  808e37:	e8 78 fe ff ff       	call   808cb4 <pipe_ring>
+  808e3c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  808e3f:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  808e44:	8d 46 04             	lea    0x4(%esi),%eax
+  808e47:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  808e4a:	eb 75                	jmp    808ec1 <devpipe_write_bulk+0x9b>
+  808e4c:	b8 01 00 00 00       	mov    $0x1,%eax
+  808e51:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  808e55:	6a 64                	push   $0x64
+  808e57:	68 00 00 c0 ee       	push   $0xeec00000
+  808e5c:	53                   	push   %ebx
+  808e5d:	56                   	push   %esi
+  808e5e:	e8 9e ea ff ff       	call   807901 <sys_chan_sleep>
+      continue;
+  808e63:	83 c4 10             	add    $0x10,%esp
+  808e66:	eb 59                	jmp    808ec1 <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  808e68:	89 d1                	mov    %edx,%ecx
+  808e6a:	c1 f9 1f             	sar    $0x1f,%ecx
+  808e6d:	c1 e9 11             	shr    $0x11,%ecx
+  808e70:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  808e73:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  808e78:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  808e7a:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  808e80:	29 d3                	sub    %edx,%ebx
+  808e82:	ba 00 80 00 00       	mov    $0x8000,%edx
+  808e87:	29 c2                	sub    %eax,%edx
+  808e89:	39 d3                	cmp    %edx,%ebx
+  808e8b:	0f 47 da             	cmova  %edx,%ebx
+  808e8e:	8b 55 08             	mov    0x8(%ebp),%edx
+  808e91:	29 fa                	sub    %edi,%edx
+  808e93:	39 d3                	cmp    %edx,%ebx
+  808e95:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  808e98:	83 ec 04             	sub    $0x4,%esp
+  808e9b:	53                   	push   %ebx
+  808e9c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  808e9f:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  808ea2:	52                   	push   %edx
+  808ea3:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  808ea6:	01 c8                	add    %ecx,%eax
+  808ea8:	50                   	push   %eax
+  808ea9:	e8 d3 e4 ff ff       	call   807381 <memcpy>
+    i += m;
+  808eae:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  808eb0:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  808eb3:	8d 46 2c             	lea    0x2c(%esi),%eax
+  808eb6:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  808eb9:	e8 57 fe ff ff       	call   808d15 <pipe_wakeup>
+  808ebe:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  808ec1:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  808ec4:	73 2b                	jae    808ef1 <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  808ec6:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  808ec8:	8b 56 04             	mov    0x4(%esi),%edx
+  808ecb:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  808ed1:	39 d0                	cmp    %edx,%eax
+  808ed3:	7d 93                	jge    808e68 <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  808ed5:	89 f2                	mov    %esi,%edx
+  808ed7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  808eda:	e8 e2 fe ff ff       	call   808dc1 <_pipeisclosed>
+  808edf:	85 c0                	test   %eax,%eax
+  808ee1:	0f 84 65 ff ff ff    	je     808e4c <devpipe_write_bulk+0x26>
+        return i;
+  808ee7:	89 f8                	mov    %edi,%eax
+}
+  808ee9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  808eec:	5b                   	pop    %ebx
+  808eed:	5e                   	pop    %esi
+  808eee:	5f                   	pop    %edi
+  808eef:	5d                   	pop    %ebp
+  808ef0:	c3                   	ret
+  return i;
+  808ef1:	89 f8                	mov    %edi,%eax
+  808ef3:	eb f4                	jmp    808ee9 <devpipe_write_bulk+0xc3>
+
+00808ef5 <devpipe_write>:
+{
+  808ef5:	55                   	push   %ebp
+  808ef6:	89 e5                	mov    %esp,%ebp
+  808ef8:	57                   	push   %edi
+  808ef9:	56                   	push   %esi
+  808efa:	53                   	push   %ebx
+  808efb:	83 ec 28             	sub    $0x28,%esp
+  808efe:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  808f01:	56                   	push   %esi
+  808f02:	e8 50 ed ff ff       	call   807c57 <fd2data>
+  808f07:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  808f09:	8b 78 28             	mov    0x28(%eax),%edi
+  808f0c:	83 c4 10             	add    $0x10,%esp
+  808f0f:	85 ff                	test   %edi,%edi
+  808f11:	75 25                	jne    808f38 <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  808f13:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  808f16:	74 66                	je     808f7e <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  808f18:	8b 43 04             	mov    0x4(%ebx),%eax
+  808f1b:	8b 0b                	mov    (%ebx),%ecx
+  808f1d:	8d 51 20             	lea    0x20(%ecx),%edx
+  808f20:	39 d0                	cmp    %edx,%eax
+  808f22:	72 2b                	jb     808f4f <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  808f24:	89 da                	mov    %ebx,%edx
+  808f26:	89 f0                	mov    %esi,%eax
+  808f28:	e8 94 fe ff ff       	call   808dc1 <_pipeisclosed>
+  808f2d:	85 c0                	test   %eax,%eax
+  808f2f:	75 51                	jne    808f82 <devpipe_write+0x8d>
+      sys_yield();
+  808f31:	e8 30 e6 ff ff       	call   807566 <sys_yield>
+  808f36:	eb e0                	jmp    808f18 <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  808f38:	83 ec 0c             	sub    $0xc,%esp
+  808f3b:	ff 75 10             	push   0x10(%ebp)
+  808f3e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  808f41:	89 c2                	mov    %eax,%edx
+  808f43:	89 f0                	mov    %esi,%eax
+  808f45:	e8 dc fe ff ff       	call   808e26 <devpipe_write_bulk>
+  808f4a:	83 c4 10             	add    $0x10,%esp
+  808f4d:	eb 38                	jmp    808f87 <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  808f4f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  808f52:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  808f56:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  808f59:	89 c2                	mov    %eax,%edx
+  808f5b:	c1 fa 1f             	sar    $0x1f,%edx
+  808f5e:	89 d1                	mov    %edx,%ecx
+  808f60:	c1 e9 1b             	shr    $0x1b,%ecx
+  808f63:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  808f66:	83 e2 1f             	and    $0x1f,%edx
+  808f69:	29 ca                	sub    %ecx,%edx
+  808f6b:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  808f6f:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  808f73:	83 c0 01             	add    $0x1,%eax
+  808f76:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  808f79:	83 c7 01             	add    $0x1,%edi
+  808f7c:	eb 95                	jmp    808f13 <devpipe_write+0x1e>
+  return i;
+  808f7e:	89 f8                	mov    %edi,%eax
+  808f80:	eb 05                	jmp    808f87 <devpipe_write+0x92>
+        return 0;
+  808f82:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  808f87:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  808f8a:	5b                   	pop    %ebx
+  808f8b:	5e                   	pop    %esi
+  808f8c:	5f                   	pop    %edi
+  808f8d:	5d                   	pop    %ebp
+  808f8e:	c3                   	ret
+
+00808f8f <devpipe_read_bulk>:
+{
+  808f8f:	55                   	push   %ebp
+  808f90:	89 e5                	mov    %esp,%ebp
+  808f92:	57                   	push   %edi
+  808f93:	56                   	push   %esi
+  808f94:	53                   	push   %ebx
+  808f95:	83 ec 2c             	sub    $0x2c,%esp
+  808f98:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  808f9b:	89 d6                	mov    %edx,%esi
+  808f9d:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  808fa0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  808fa3:	e8 0c fd ff ff       	call   808cb4 <pipe_ring>
+  808fa8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  808fab:	85 db                	test   %ebx,%ebx
+  808fad:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  808fb2:	0f 45 c3             	cmovne %ebx,%eax
+  808fb5:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  808fb8:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  808fbd:	8d 46 30             	lea    0x30(%esi),%eax
+  808fc0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  808fc3:	eb 50                	jmp    809015 <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  808fc5:	89 d1                	mov    %edx,%ecx
+  808fc7:	c1 f9 1f             	sar    $0x1f,%ecx
+  808fca:	c1 e9 11             	shr    $0x11,%ecx
+  808fcd:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  808fd0:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  808fd5:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  808fd7:	29 d3                	sub    %edx,%ebx
+  808fd9:	ba 00 80 00 00       	mov    $0x8000,%edx
+  808fde:	29 c2                	sub    %eax,%edx
+  808fe0:	39 d3                	cmp    %edx,%ebx
+  808fe2:	0f 47 da             	cmova  %edx,%ebx
+  808fe5:	8b 55 08             	mov    0x8(%ebp),%edx
+  808fe8:	29 fa                	sub    %edi,%edx
+  808fea:	39 d3                	cmp    %edx,%ebx
+  808fec:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  808fef:	83 ec 04             	sub    $0x4,%esp
+  808ff2:	53                   	push   %ebx
+  808ff3:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  808ff6:	01 c8                	add    %ecx,%eax
+  808ff8:	50                   	push   %eax
+  808ff9:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  808ffc:	01 f8                	add    %edi,%eax
+  808ffe:	50                   	push   %eax
+  808fff:	e8 7d e3 ff ff       	call   807381 <memcpy>
+    i += m;
+  809004:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  809006:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  809008:	89 f2                	mov    %esi,%edx
+  80900a:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80900d:	e8 03 fd ff ff       	call   808d15 <pipe_wakeup>
+  809012:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  809015:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  809018:	73 51                	jae    80906b <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  80901a:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  80901d:	8b 16                	mov    (%esi),%edx
+  80901f:	39 da                	cmp    %ebx,%edx
+  809021:	75 a2                	jne    808fc5 <devpipe_read_bulk+0x36>
+      if (i > 0)
+  809023:	85 ff                	test   %edi,%edi
+  809025:	75 44                	jne    80906b <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  809027:	89 f2                	mov    %esi,%edx
+  809029:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80902c:	e8 90 fd ff ff       	call   808dc1 <_pipeisclosed>
+  809031:	85 c0                	test   %eax,%eax
+  809033:	75 3a                	jne    80906f <devpipe_read_bulk+0xe0>
+  809035:	b8 01 00 00 00       	mov    $0x1,%eax
+  80903a:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  80903e:	6a 64                	push   $0x64
+  809040:	ff 75 d4             	push   -0x2c(%ebp)
+  809043:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  809044:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  809047:	50                   	push   %eax
+  809048:	e8 b4 e8 ff ff       	call   807901 <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  80904d:	85 c0                	test   %eax,%eax
+  80904f:	ba 00 00 00 00       	mov    $0x0,%edx
+  809054:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  809057:	83 c4 10             	add    $0x10,%esp
+  80905a:	a8 01                	test   $0x1,%al
+  80905c:	74 b7                	je     809015 <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  80905e:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  809063:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  809066:	5b                   	pop    %ebx
+  809067:	5e                   	pop    %esi
+  809068:	5f                   	pop    %edi
+  809069:	5d                   	pop    %ebp
+  80906a:	c3                   	ret
+  return i;
+  80906b:	89 f8                	mov    %edi,%eax
+  80906d:	eb f4                	jmp    809063 <devpipe_read_bulk+0xd4>
+        return 0;
+  80906f:	b8 00 00 00 00       	mov    $0x0,%eax
+  809074:	eb ed                	jmp    809063 <devpipe_read_bulk+0xd4>
+
+00809076 <devpipe_read>:
+{
+  809076:	55                   	push   %ebp
+  809077:	89 e5                	mov    %esp,%ebp
+  809079:	57                   	push   %edi
+  80907a:	56                   	push   %esi
+  80907b:	53                   	push   %ebx
+  80907c:	83 ec 18             	sub    $0x18,%esp
+  80907f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  809082:	57                   	push   %edi
+  809083:	e8 cf eb ff ff       	call   807c57 <fd2data>
+  809088:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  80908a:	8b 70 28             	mov    0x28(%eax),%esi
+  80908d:	83 c4 10             	add    $0x10,%esp
+  809090:	85 f6                	test   %esi,%esi
+  809092:	75 24                	jne    8090b8 <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  809094:	3b 75 10             	cmp    0x10(%ebp),%esi
+  809097:	74 60                	je     8090f9 <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  809099:	8b 03                	mov    (%ebx),%eax
+  80909b:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80909e:	75 3b                	jne    8090db <devpipe_read+0x65>
+      if (i > 0)
+  8090a0:	85 f6                	test   %esi,%esi
+  8090a2:	75 2d                	jne    8090d1 <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  8090a4:	89 da                	mov    %ebx,%edx
+  8090a6:	89 f8                	mov    %edi,%eax
+  8090a8:	e8 14 fd ff ff       	call   808dc1 <_pipeisclosed>
+  8090ad:	85 c0                	test   %eax,%eax
+  8090af:	75 4c                	jne    8090fd <devpipe_read+0x87>
+      sys_yield();
+  8090b1:	e8 b0 e4 ff ff       	call   807566 <sys_yield>
+  8090b6:	eb e1                	jmp    809099 <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  8090b8:	83 ec 08             	sub    $0x8,%esp
+  8090bb:	6a 00                	push   $0x0
+  8090bd:	ff 75 10             	push   0x10(%ebp)
+  8090c0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8090c3:	89 c2                	mov    %eax,%edx
+  8090c5:	89 f8                	mov    %edi,%eax
+  8090c7:	e8 c3 fe ff ff       	call   808f8f <devpipe_read_bulk>
+  8090cc:	83 c4 10             	add    $0x10,%esp
+  8090cf:	eb 02                	jmp    8090d3 <devpipe_read+0x5d>
+        return i;
+  8090d1:	89 f0                	mov    %esi,%eax
+}
+  8090d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8090d6:	5b                   	pop    %ebx
+  8090d7:	5e                   	pop    %esi
+  8090d8:	5f                   	pop    %edi
+  8090d9:	5d                   	pop    %ebp
+  8090da:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8090db:	99                   	cltd
+  8090dc:	c1 ea 1b             	shr    $0x1b,%edx
+  8090df:	01 d0                	add    %edx,%eax
+  8090e1:	83 e0 1f             	and    $0x1f,%eax
+  8090e4:	29 d0                	sub    %edx,%eax
+  8090e6:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8090eb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8090ee:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  8090f1:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  8090f4:	83 c6 01             	add    $0x1,%esi
+  8090f7:	eb 9b                	jmp    809094 <devpipe_read+0x1e>
+  return i;
+  8090f9:	89 f0                	mov    %esi,%eax
+  8090fb:	eb d6                	jmp    8090d3 <devpipe_read+0x5d>
+        return 0;
+  8090fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  809102:	eb cf                	jmp    8090d3 <devpipe_read+0x5d>
+
+00809104 <pipe2>:
+{
+  809104:	55                   	push   %ebp
+  809105:	89 e5                	mov    %esp,%ebp
+  809107:	57                   	push   %edi
+  809108:	56                   	push   %esi
+  809109:	53                   	push   %ebx
+  80910a:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  80910d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  809110:	50                   	push   %eax
+  809111:	e8 55 eb ff ff       	call   807c6b <fd_alloc>
+  809116:	89 c3                	mov    %eax,%ebx
+  809118:	83 c4 10             	add    $0x10,%esp
+  80911b:	85 c0                	test   %eax,%eax
+  80911d:	0f 88 fb 01 00 00    	js     80931e <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  809123:	83 ec 04             	sub    $0x4,%esp
+  809126:	68 07 04 00 00       	push   $0x407
+  80912b:	ff 75 e4             	push   -0x1c(%ebp)
+  80912e:	6a 00                	push   $0x0
+  809130:	e8 93 e4 ff ff       	call   8075c8 <sys_page_alloc>
+  809135:	89 c3                	mov    %eax,%ebx
+  809137:	83 c4 10             	add    $0x10,%esp
+  80913a:	85 c0                	test   %eax,%eax
+  80913c:	0f 88 dc 01 00 00    	js     80931e <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  809142:	83 ec 0c             	sub    $0xc,%esp
+  809145:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  809148:	50                   	push   %eax
+  809149:	e8 1d eb ff ff       	call   807c6b <fd_alloc>
+  80914e:	89 c3                	mov    %eax,%ebx
+  809150:	83 c4 10             	add    $0x10,%esp
+  809153:	85 c0                	test   %eax,%eax
+  809155:	0f 88 b3 01 00 00    	js     80930e <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80915b:	83 ec 04             	sub    $0x4,%esp
+  80915e:	68 07 04 00 00       	push   $0x407
+  809163:	ff 75 e0             	push   -0x20(%ebp)
+  809166:	6a 00                	push   $0x0
+  809168:	e8 5b e4 ff ff       	call   8075c8 <sys_page_alloc>
+  80916d:	89 c3                	mov    %eax,%ebx
+  80916f:	83 c4 10             	add    $0x10,%esp
+  809172:	85 c0                	test   %eax,%eax
+  809174:	0f 88 94 01 00 00    	js     80930e <pipe2+0x20a>
+  va = fd2data(fd0);
+  80917a:	83 ec 0c             	sub    $0xc,%esp
+  80917d:	ff 75 e4             	push   -0x1c(%ebp)
+  809180:	e8 d2 ea ff ff       	call   807c57 <fd2data>
+  809185:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  809187:	83 c4 0c             	add    $0xc,%esp
+  80918a:	68 07 04 00 00       	push   $0x407
+  80918f:	50                   	push   %eax
+  809190:	6a 00                	push   $0x0
+  809192:	e8 31 e4 ff ff       	call   8075c8 <sys_page_alloc>
+  809197:	89 c3                	mov    %eax,%ebx
+  809199:	83 c4 10             	add    $0x10,%esp
+  80919c:	85 c0                	test   %eax,%eax
+  80919e:	0f 88 5a 01 00 00    	js     8092fe <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8091a4:	83 ec 0c             	sub    $0xc,%esp
+  8091a7:	ff 75 e0             	push   -0x20(%ebp)
+  8091aa:	e8 a8 ea ff ff       	call   807c57 <fd2data>
+  8091af:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8091b6:	50                   	push   %eax
+  8091b7:	6a 00                	push   $0x0
+  8091b9:	57                   	push   %edi
+  8091ba:	6a 00                	push   $0x0
+  8091bc:	e8 4a e4 ff ff       	call   80760b <sys_page_map>
+  8091c1:	89 c3                	mov    %eax,%ebx
+  8091c3:	83 c4 20             	add    $0x20,%esp
+  8091c6:	85 c0                	test   %eax,%eax
+  8091c8:	0f 88 22 01 00 00    	js     8092f0 <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  8091ce:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  8091d2:	74 72                	je     809246 <pipe2+0x142>
+  8091d4:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  8091d9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8091dc:	e8 d3 fa ff ff       	call   808cb4 <pipe_ring>
+  8091e1:	83 ec 04             	sub    $0x4,%esp
+  8091e4:	68 07 04 00 00       	push   $0x407
+  8091e9:	01 f0                	add    %esi,%eax
+  8091eb:	50                   	push   %eax
+  8091ec:	6a 00                	push   $0x0
+  8091ee:	e8 d5 e3 ff ff       	call   8075c8 <sys_page_alloc>
+  8091f3:	89 c3                	mov    %eax,%ebx
+  8091f5:	83 c4 10             	add    $0x10,%esp
+  8091f8:	85 c0                	test   %eax,%eax
+  8091fa:	0f 88 97 00 00 00    	js     809297 <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  809200:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  809203:	e8 ac fa ff ff       	call   808cb4 <pipe_ring>
+  809208:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  80920b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80920e:	e8 a1 fa ff ff       	call   808cb4 <pipe_ring>
+  809213:	83 ec 0c             	sub    $0xc,%esp
+  809216:	68 07 04 00 00       	push   $0x407
+  80921b:	53                   	push   %ebx
+  80921c:	6a 00                	push   $0x0
+  80921e:	01 f0                	add    %esi,%eax
+  809220:	50                   	push   %eax
+  809221:	6a 00                	push   $0x0
+  809223:	e8 e3 e3 ff ff       	call   80760b <sys_page_map>
+  809228:	89 c3                	mov    %eax,%ebx
+  80922a:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  809230:	83 c4 20             	add    $0x20,%esp
+  809233:	85 c0                	test   %eax,%eax
+  809235:	78 60                	js     809297 <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  809237:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  80923d:	75 9a                	jne    8091d9 <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  80923f:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  809246:	a1 80 40 81 00       	mov    0x814080,%eax
+  80924b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80924e:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  809250:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  809253:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  80925a:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80925d:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  80925f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  809262:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  809269:	83 ec 0c             	sub    $0xc,%esp
+  80926c:	ff 75 e4             	push   -0x1c(%ebp)
+  80926f:	e8 d3 e9 ff ff       	call   807c47 <fd2num>
+  809274:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  809277:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  809279:	83 c4 04             	add    $0x4,%esp
+  80927c:	ff 75 e0             	push   -0x20(%ebp)
+  80927f:	e8 c3 e9 ff ff       	call   807c47 <fd2num>
+  809284:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  809287:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  80928a:	83 c4 10             	add    $0x10,%esp
+  80928d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  809292:	e9 87 00 00 00       	jmp    80931e <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  809297:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  80929c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80929f:	e8 10 fa ff ff       	call   808cb4 <pipe_ring>
+  8092a4:	83 ec 08             	sub    $0x8,%esp
+  8092a7:	01 f0                	add    %esi,%eax
+  8092a9:	50                   	push   %eax
+  8092aa:	6a 00                	push   $0x0
+  8092ac:	e8 9c e3 ff ff       	call   80764d <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  8092b1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8092b4:	e8 fb f9 ff ff       	call   808cb4 <pipe_ring>
+  8092b9:	83 c4 08             	add    $0x8,%esp
+  8092bc:	01 f0                	add    %esi,%eax
+  8092be:	50                   	push   %eax
+  8092bf:	6a 00                	push   $0x0
+  8092c1:	e8 87 e3 ff ff       	call   80764d <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  8092c6:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8092cc:	83 c4 10             	add    $0x10,%esp
+  8092cf:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  8092d5:	75 c5                	jne    80929c <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  8092d7:	83 ec 0c             	sub    $0xc,%esp
+  8092da:	ff 75 e0             	push   -0x20(%ebp)
+  8092dd:	e8 75 e9 ff ff       	call   807c57 <fd2data>
+  8092e2:	83 c4 08             	add    $0x8,%esp
+  8092e5:	50                   	push   %eax
+  8092e6:	6a 00                	push   $0x0
+  8092e8:	e8 60 e3 ff ff       	call   80764d <sys_page_unmap>
+  8092ed:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  8092f0:	83 ec 08             	sub    $0x8,%esp
+  8092f3:	57                   	push   %edi
+  8092f4:	6a 00                	push   $0x0
+  8092f6:	e8 52 e3 ff ff       	call   80764d <sys_page_unmap>
+  8092fb:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  8092fe:	83 ec 08             	sub    $0x8,%esp
+  809301:	ff 75 e0             	push   -0x20(%ebp)
+  809304:	6a 00                	push   $0x0
+  809306:	e8 42 e3 ff ff       	call   80764d <sys_page_unmap>
+  80930b:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  80930e:	83 ec 08             	sub    $0x8,%esp
+  809311:	ff 75 e4             	push   -0x1c(%ebp)
+  809314:	6a 00                	push   $0x0
+  809316:	e8 32 e3 ff ff       	call   80764d <sys_page_unmap>
+  80931b:	83 c4 10             	add    $0x10,%esp
+}
+  80931e:	89 d8                	mov    %ebx,%eax
+  809320:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  809323:	5b                   	pop    %ebx
+  809324:	5e                   	pop    %esi
+  809325:	5f                   	pop    %edi
+  809326:	5d                   	pop    %ebp
+  809327:	c3                   	ret
+
+00809328 <pipe>:
+{
+  809328:	55                   	push   %ebp
+  809329:	89 e5                	mov    %esp,%ebp
+  80932b:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  80932e:	6a 00                	push   $0x0
+  809330:	ff 75 08             	push   0x8(%ebp)
+  809333:	e8 cc fd ff ff       	call   809104 <pipe2>
+}
+  809338:	c9                   	leave
+  809339:	c3                   	ret
+
+0080933a <pipeisclosed>:
+{
+  80933a:	55                   	push   %ebp
+  80933b:	89 e5                	mov    %esp,%ebp
+  80933d:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  809340:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  809343:	50                   	push   %eax
+  809344:	ff 75 08             	push   0x8(%ebp)
+  809347:	e8 75 e9 ff ff       	call   807cc1 <fd_lookup>
+  80934c:	83 c4 10             	add    $0x10,%esp
+  80934f:	85 c0                	test   %eax,%eax
+  809351:	78 18                	js     80936b <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  809353:	83 ec 0c             	sub    $0xc,%esp
+  809356:	ff 75 f4             	push   -0xc(%ebp)
+  809359:	e8 f9 e8 ff ff       	call   807c57 <fd2data>
+  80935e:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  809360:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  809363:	e8 59 fa ff ff       	call   808dc1 <_pipeisclosed>
+  809368:	83 c4 10             	add    $0x10,%esp
+}
+  80936b:	c9                   	leave
+  80936c:	c3                   	ret
+
+0080936d <pipe_splice>:
+{
+  80936d:	55                   	push   %ebp
+  80936e:	89 e5                	mov    %esp,%ebp
+  809370:	57                   	push   %edi
+  809371:	56                   	push   %esi
+  809372:	53                   	push   %ebx
+  809373:	83 ec 34             	sub    $0x34,%esp
+  809376:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  809379:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80937c:	50                   	push   %eax
+  80937d:	ff 75 08             	push   0x8(%ebp)
+  809380:	e8 3c e9 ff ff       	call   807cc1 <fd_lookup>
+  809385:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  809388:	83 c4 10             	add    $0x10,%esp
+  80938b:	85 c0                	test   %eax,%eax
+  80938d:	0f 88 d7 00 00 00    	js     80946a <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  809393:	83 ec 0c             	sub    $0xc,%esp
+  809396:	ff 75 e4             	push   -0x1c(%ebp)
+  809399:	e8 b9 e8 ff ff       	call   807c57 <fd2data>
+  80939e:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  8093a0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8093a3:	83 c4 10             	add    $0x10,%esp
+  8093a6:	8b 15 80 40 81 00    	mov    0x814080,%edx
+  8093ac:	39 10                	cmp    %edx,(%eax)
+  8093ae:	0f 85 c1 00 00 00    	jne    809475 <pipe_splice+0x108>
+  8093b4:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  8093b8:	0f 84 c0 00 00 00    	je     80947e <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  8093be:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  8093c2:	0f 84 bf 00 00 00    	je     809487 <pipe_splice+0x11a>
+  8093c8:	89 f7                	mov    %esi,%edi
+  8093ca:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  8093d0:	0f 85 ba 00 00 00    	jne    809490 <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  8093d6:	8d 43 04             	lea    0x4(%ebx),%eax
+  8093d9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8093dc:	eb 38                	jmp    809416 <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  8093de:	83 ec 0c             	sub    $0xc,%esp
+  8093e1:	68 00 10 00 00       	push   $0x1000
+  8093e6:	89 f1                	mov    %esi,%ecx
+  8093e8:	89 da                	mov    %ebx,%edx
+  8093ea:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8093ed:	e8 34 fa ff ff       	call   808e26 <devpipe_write_bulk>
+  8093f2:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8093f5:	83 c4 10             	add    $0x10,%esp
+  8093f8:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8093fd:	75 53                	jne    809452 <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  8093ff:	83 ec 08             	sub    $0x8,%esp
+  809402:	56                   	push   %esi
+  809403:	6a 00                	push   $0x0
+  809405:	e8 43 e2 ff ff       	call   80764d <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  80940a:	83 c7 01             	add    $0x1,%edi
+  80940d:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  809413:	83 c4 10             	add    $0x10,%esp
+  809416:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  809419:	74 3a                	je     809455 <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  80941b:	8b 03                	mov    (%ebx),%eax
+  80941d:	39 43 04             	cmp    %eax,0x4(%ebx)
+  809420:	75 bc                	jne    8093de <pipe_splice+0x71>
+  809422:	b8 00 00 00 00       	mov    $0x0,%eax
+  809427:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  80942b:	85 c0                	test   %eax,%eax
+  80942d:	74 af                	je     8093de <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  80942f:	83 ec 04             	sub    $0x4,%esp
+  809432:	6a 07                	push   $0x7
+  809434:	56                   	push   %esi
+  809435:	ff 75 d0             	push   -0x30(%ebp)
+  809438:	e8 e7 e4 ff ff       	call   807924 <sys_chan_wakeup>
+  80943d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  809440:	83 c4 10             	add    $0x10,%esp
+  809443:	85 c0                	test   %eax,%eax
+  809445:	79 b8                	jns    8093ff <pipe_splice+0x92>
+  809447:	b8 01 00 00 00       	mov    $0x1,%eax
+  80944c:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  809450:	eb 8c                	jmp    8093de <pipe_splice+0x71>
+  809452:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  809455:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  809459:	75 06                	jne    809461 <pipe_splice+0xf4>
+  80945b:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  80945f:	78 09                	js     80946a <pipe_splice+0xfd>
+  return i * PGSIZE;
+  809461:	8b 45 10             	mov    0x10(%ebp),%eax
+  809464:	c1 e0 0c             	shl    $0xc,%eax
+  809467:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  80946a:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80946d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  809470:	5b                   	pop    %ebx
+  809471:	5e                   	pop    %esi
+  809472:	5f                   	pop    %edi
+  809473:	5d                   	pop    %ebp
+  809474:	c3                   	ret
+    return -E_INVAL;
+  809475:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  80947c:	eb ec                	jmp    80946a <pipe_splice+0xfd>
+  80947e:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  809485:	eb e3                	jmp    80946a <pipe_splice+0xfd>
+  809487:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  80948e:	eb da                	jmp    80946a <pipe_splice+0xfd>
+  809490:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  809497:	eb d1                	jmp    80946a <pipe_splice+0xfd>
+
+00809499 <pipe_splice_read>:
+{
+  809499:	55                   	push   %ebp
+  80949a:	89 e5                	mov    %esp,%ebp
+  80949c:	53                   	push   %ebx
+  80949d:	83 ec 1c             	sub    $0x1c,%esp
+  8094a0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8094a3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8094a6:	50                   	push   %eax
+  8094a7:	ff 75 08             	push   0x8(%ebp)
+  8094aa:	e8 12 e8 ff ff       	call   807cc1 <fd_lookup>
+  8094af:	83 c4 10             	add    $0x10,%esp
+  8094b2:	85 c0                	test   %eax,%eax
+  8094b4:	78 49                	js     8094ff <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  8094b6:	83 ec 0c             	sub    $0xc,%esp
+  8094b9:	ff 75 f4             	push   -0xc(%ebp)
+  8094bc:	e8 96 e7 ff ff       	call   807c57 <fd2data>
+  8094c1:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  8094c3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8094c6:	83 c4 10             	add    $0x10,%esp
+  8094c9:	8b 0d 80 40 81 00    	mov    0x814080,%ecx
+  8094cf:	39 08                	cmp    %ecx,(%eax)
+  8094d1:	75 31                	jne    809504 <pipe_splice_read+0x6b>
+  8094d3:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  8094d7:	74 32                	je     80950b <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  8094d9:	8b 48 08             	mov    0x8(%eax),%ecx
+  8094dc:	83 e1 03             	and    $0x3,%ecx
+  8094df:	83 f9 01             	cmp    $0x1,%ecx
+  8094e2:	74 2e                	je     809512 <pipe_splice_read+0x79>
+  8094e4:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  8094ea:	75 2d                	jne    809519 <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  8094ec:	83 ec 08             	sub    $0x8,%esp
+  8094ef:	53                   	push   %ebx
+  8094f0:	68 00 10 00 00       	push   $0x1000
+  8094f5:	89 d9                	mov    %ebx,%ecx
+  8094f7:	e8 93 fa ff ff       	call   808f8f <devpipe_read_bulk>
+  8094fc:	83 c4 10             	add    $0x10,%esp
+}
+  8094ff:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  809502:	c9                   	leave
+  809503:	c3                   	ret
+    return -E_INVAL;
+  809504:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  809509:	eb f4                	jmp    8094ff <pipe_splice_read+0x66>
+  80950b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  809510:	eb ed                	jmp    8094ff <pipe_splice_read+0x66>
+  809512:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  809517:	eb e6                	jmp    8094ff <pipe_splice_read+0x66>
+  809519:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80951e:	eb df                	jmp    8094ff <pipe_splice_read+0x66>
+
+00809520 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  809520:	b8 00 00 00 00       	mov    $0x0,%eax
+  809525:	c3                   	ret
+
+00809526 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  809526:	55                   	push   %ebp
+  809527:	89 e5                	mov    %esp,%ebp
+  809529:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  80952c:	68 e7 a6 80 00       	push   $0x80a6e7
+  809531:	ff 75 0c             	push   0xc(%ebp)
+  809534:	e8 60 dc ff ff       	call   807199 <strcpy>
+  return 0;
+}
+  809539:	b8 00 00 00 00       	mov    $0x0,%eax
+  80953e:	c9                   	leave
+  80953f:	c3                   	ret
+
+00809540 <devcons_write>:
+{
+  809540:	55                   	push   %ebp
+  809541:	89 e5                	mov    %esp,%ebp
+  809543:	57                   	push   %edi
+  809544:	56                   	push   %esi
+  809545:	53                   	push   %ebx
+  809546:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  80954c:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  809551:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  809557:	eb 2e                	jmp    809587 <devcons_write+0x47>
+    m = n - tot;
+  809559:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80955c:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  80955e:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  809563:	39 c3                	cmp    %eax,%ebx
+  809565:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  809568:	83 ec 04             	sub    $0x4,%esp
+  80956b:	53                   	push   %ebx
+  80956c:	89 f0                	mov    %esi,%eax
+  80956e:	03 45 0c             	add    0xc(%ebp),%eax
+  809571:	50                   	push   %eax
+  809572:	57                   	push   %edi
+  809573:	e8 a7 dd ff ff       	call   80731f <memmove>
+    sys_cputs(buf, m);
+  809578:	83 c4 08             	add    $0x8,%esp
+  80957b:	53                   	push   %ebx
+  80957c:	57                   	push   %edi
+  80957d:	e8 47 df ff ff       	call   8074c9 <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  809582:	01 de                	add    %ebx,%esi
+  809584:	83 c4 10             	add    $0x10,%esp
+  809587:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80958a:	72 cd                	jb     809559 <devcons_write+0x19>
+}
+  80958c:	89 f0                	mov    %esi,%eax
+  80958e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  809591:	5b                   	pop    %ebx
+  809592:	5e                   	pop    %esi
+  809593:	5f                   	pop    %edi
+  809594:	5d                   	pop    %ebp
+  809595:	c3                   	ret
+
+00809596 <devcons_read>:
+{
+  809596:	55                   	push   %ebp
+  809597:	89 e5                	mov    %esp,%ebp
+  809599:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  80959c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8095a1:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8095a5:	75 07                	jne    8095ae <devcons_read+0x18>
+  8095a7:	eb 1f                	jmp    8095c8 <devcons_read+0x32>
+    sys_yield();
+  8095a9:	e8 b8 df ff ff       	call   807566 <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  8095ae:	e8 34 df ff ff       	call   8074e7 <sys_cgetc>
+  8095b3:	85 c0                	test   %eax,%eax
+  8095b5:	74 f2                	je     8095a9 <devcons_read+0x13>
+  if (c < 0)
+  8095b7:	78 0f                	js     8095c8 <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  8095b9:	83 f8 04             	cmp    $0x4,%eax
+  8095bc:	74 0c                	je     8095ca <devcons_read+0x34>
+  *(char*)vbuf = c;
+  8095be:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8095c1:	88 02                	mov    %al,(%edx)
+  return 1;
+  8095c3:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8095c8:	c9                   	leave
+  8095c9:	c3                   	ret
+    return 0;
+  8095ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8095cf:	eb f7                	jmp    8095c8 <devcons_read+0x32>
+
+008095d1 <cputchar>:
+{
+  8095d1:	55                   	push   %ebp
+  8095d2:	89 e5                	mov    %esp,%ebp
+  8095d4:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  8095d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8095da:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  8095dd:	6a 01                	push   $0x1
+  8095df:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8095e2:	50                   	push   %eax
+  8095e3:	e8 e1 de ff ff       	call   8074c9 <sys_cputs>
+}
+  8095e8:	83 c4 10             	add    $0x10,%esp
+  8095eb:	c9                   	leave
+  8095ec:	c3                   	ret
+
+008095ed <getchar>:
+{
+  8095ed:	55                   	push   %ebp
+  8095ee:	89 e5                	mov    %esp,%ebp
+  8095f0:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  8095f3:	6a 01                	push   $0x1
+  8095f5:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8095f8:	50                   	push   %eax
+  8095f9:	6a 00                	push   $0x0
+  8095fb:	e8 6c e9 ff ff       	call   807f6c <read>
+  if (r < 0)
+  809600:	83 c4 10             	add    $0x10,%esp
+  809603:	85 c0                	test   %eax,%eax
+  809605:	78 06                	js     80960d <getchar+0x20>
+  if (r < 1)
+  809607:	74 06                	je     80960f <getchar+0x22>
+  return c;
+  809609:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80960d:	c9                   	leave
+  80960e:	c3                   	ret
+    return -E_EOF;
+  80960f:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  809614:	eb f7                	jmp    80960d <getchar+0x20>
+
+00809616 <iscons>:
+{
+  809616:	55                   	push   %ebp
+  809617:	89 e5                	mov    %esp,%ebp
+  809619:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80961c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80961f:	50                   	push   %eax
+  809620:	ff 75 08             	push   0x8(%ebp)
+  809623:	e8 99 e6 ff ff       	call   807cc1 <fd_lookup>
+  809628:	83 c4 10             	add    $0x10,%esp
+  80962b:	85 c0                	test   %eax,%eax
+  80962d:	78 11                	js     809640 <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  80962f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  809632:	8b 15 9c 40 81 00    	mov    0x81409c,%edx
+  809638:	39 10                	cmp    %edx,(%eax)
+  80963a:	0f 94 c0             	sete   %al
+  80963d:	0f b6 c0             	movzbl %al,%eax
+}
+  809640:	c9                   	leave
+  809641:	c3                   	ret
+
+00809642 <opencons>:
+{
+  809642:	55                   	push   %ebp
+  809643:	89 e5                	mov    %esp,%ebp
+  809645:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  809648:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80964b:	50                   	push   %eax
+  80964c:	e8 1a e6 ff ff       	call   807c6b <fd_alloc>
+  809651:	83 c4 10             	add    $0x10,%esp
+  809654:	85 c0                	test   %eax,%eax
+  809656:	78 3a                	js     809692 <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  809658:	83 ec 04             	sub    $0x4,%esp
+  80965b:	68 07 04 00 00       	push   $0x407
+  809660:	ff 75 f4             	push   -0xc(%ebp)
+  809663:	6a 00                	push   $0x0
+  809665:	e8 5e df ff ff       	call   8075c8 <sys_page_alloc>
+  80966a:	83 c4 10             	add    $0x10,%esp
+  80966d:	85 c0                	test   %eax,%eax
+  80966f:	78 21                	js     809692 <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  809671:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  809674:	8b 15 9c 40 81 00    	mov    0x81409c,%edx
+  80967a:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  80967c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80967f:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  809686:	83 ec 0c             	sub    $0xc,%esp
+  809689:	50                   	push   %eax
+  80968a:	e8 b8 e5 ff ff       	call   807c47 <fd2num>
+  80968f:	83 c4 10             	add    $0x10,%esp
+}
+  809692:	c9                   	leave
+  809693:	c3                   	ret
+
+00809694 <udivmod>:
+  809694:	55                   	push   %ebp
+  809695:	57                   	push   %edi
+  809696:	56                   	push   %esi
+  809697:	53                   	push   %ebx
+  809698:	83 ec 14             	sub    $0x14,%esp
+  80969b:	8b 74 24 28          	mov    0x28(%esp),%esi
+  80969f:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  8096a3:	89 fb                	mov    %edi,%ebx
+  8096a5:	09 f3                	or     %esi,%ebx
+  8096a7:	0f 84 88 00 00 00    	je     809735 <udivmod+0xa1>
+  8096ad:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8096b2:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8096b9:	00 
+  8096ba:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8096c1:	00 
+  8096c2:	89 cd                	mov    %ecx,%ebp
+  8096c4:	89 34 24             	mov    %esi,(%esp)
+  8096c7:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  8096cb:	eb 08                	jmp    8096d5 <udivmod+0x41>
+  8096cd:	83 ed 01             	sub    $0x1,%ebp
+  8096d0:	83 fd ff             	cmp    $0xffffffff,%ebp
+  8096d3:	74 6c                	je     809741 <udivmod+0xad>
+  8096d5:	89 c3                	mov    %eax,%ebx
+  8096d7:	89 d6                	mov    %edx,%esi
+  8096d9:	89 e9                	mov    %ebp,%ecx
+  8096db:	0f ad f3             	shrd   %cl,%esi,%ebx
+  8096de:	d3 ee                	shr    %cl,%esi
+  8096e0:	f6 c1 20             	test   $0x20,%cl
+  8096e3:	74 04                	je     8096e9 <udivmod+0x55>
+  8096e5:	89 f3                	mov    %esi,%ebx
+  8096e7:	31 f6                	xor    %esi,%esi
+  8096e9:	8b 3c 24             	mov    (%esp),%edi
+  8096ec:	39 fb                	cmp    %edi,%ebx
+  8096ee:	89 f7                	mov    %esi,%edi
+  8096f0:	8b 1c 24             	mov    (%esp),%ebx
+  8096f3:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8096f7:	19 f7                	sbb    %esi,%edi
+  8096f9:	72 d2                	jb     8096cd <udivmod+0x39>
+  8096fb:	89 f7                	mov    %esi,%edi
+  8096fd:	89 de                	mov    %ebx,%esi
+  8096ff:	89 e9                	mov    %ebp,%ecx
+  809701:	0f a5 f7             	shld   %cl,%esi,%edi
+  809704:	d3 e6                	shl    %cl,%esi
+  809706:	f6 c1 20             	test   $0x20,%cl
+  809709:	74 04                	je     80970f <udivmod+0x7b>
+  80970b:	89 f7                	mov    %esi,%edi
+  80970d:	31 f6                	xor    %esi,%esi
+  80970f:	29 f0                	sub    %esi,%eax
+  809711:	19 fa                	sbb    %edi,%edx
+  809713:	be 01 00 00 00       	mov    $0x1,%esi
+  809718:	bf 00 00 00 00       	mov    $0x0,%edi
+  80971d:	0f a5 f7             	shld   %cl,%esi,%edi
+  809720:	d3 e6                	shl    %cl,%esi
+  809722:	f6 c1 20             	test   $0x20,%cl
+  809725:	74 04                	je     80972b <udivmod+0x97>
+  809727:	89 f7                	mov    %esi,%edi
+  809729:	31 f6                	xor    %esi,%esi
+  80972b:	09 74 24 08          	or     %esi,0x8(%esp)
+  80972f:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  809733:	eb 98                	jmp    8096cd <udivmod+0x39>
+  809735:	89 f0                	mov    %esi,%eax
+  809737:	89 fa                	mov    %edi,%edx
+  809739:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80973d:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  809741:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  809745:	89 01                	mov    %eax,(%ecx)
+  809747:	89 51 04             	mov    %edx,0x4(%ecx)
+  80974a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80974e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  809752:	83 c4 14             	add    $0x14,%esp
+  809755:	5b                   	pop    %ebx
+  809756:	5e                   	pop    %esi
+  809757:	5f                   	pop    %edi
+  809758:	5d                   	pop    %ebp
+  809759:	c3                   	ret
+
+0080975a <__udivdi3>:
+  80975a:	83 ec 18             	sub    $0x18,%esp
+  80975d:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  809761:	50                   	push   %eax
+  809762:	ff 74 24 2c          	push   0x2c(%esp)
+  809766:	ff 74 24 2c          	push   0x2c(%esp)
+  80976a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80976e:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  809772:	e8 1d ff ff ff       	call   809694 <udivmod>
+  809777:	83 c4 24             	add    $0x24,%esp
+  80977a:	c3                   	ret
+
+0080977b <__umoddi3>:
+  80977b:	83 ec 18             	sub    $0x18,%esp
+  80977e:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  809782:	50                   	push   %eax
+  809783:	ff 74 24 2c          	push   0x2c(%esp)
+  809787:	ff 74 24 2c          	push   0x2c(%esp)
+  80978b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80978f:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  809793:	e8 fc fe ff ff       	call   809694 <udivmod>
+  809798:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80979c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8097a0:	83 c4 24             	add    $0x24,%esp
+  8097a3:	c3                   	ret
+
+008097a4 <__divdi3>:
+  8097a4:	56                   	push   %esi
+  8097a5:	53                   	push   %ebx
+  8097a6:	83 ec 14             	sub    $0x14,%esp
+  8097a9:	8b 44 24 20          	mov    0x20(%esp),%eax
+  8097ad:	8b 54 24 24          	mov    0x24(%esp),%edx
+  8097b1:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  8097b5:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  8097b9:	85 d2                	test   %edx,%edx
+  8097bb:	78 18                	js     8097d5 <__divdi3+0x31>
+  8097bd:	85 db                	test   %ebx,%ebx
+  8097bf:	78 3e                	js     8097ff <__divdi3+0x5b>
+  8097c1:	83 ec 04             	sub    $0x4,%esp
+  8097c4:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8097c8:	56                   	push   %esi
+  8097c9:	53                   	push   %ebx
+  8097ca:	51                   	push   %ecx
+  8097cb:	e8 c4 fe ff ff       	call   809694 <udivmod>
+  8097d0:	83 c4 10             	add    $0x10,%esp
+  8097d3:	eb 24                	jmp    8097f9 <__divdi3+0x55>
+  8097d5:	f7 d8                	neg    %eax
+  8097d7:	83 d2 00             	adc    $0x0,%edx
+  8097da:	f7 da                	neg    %edx
+  8097dc:	85 db                	test   %ebx,%ebx
+  8097de:	78 3a                	js     80981a <__divdi3+0x76>
+  8097e0:	83 ec 04             	sub    $0x4,%esp
+  8097e3:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8097e7:	56                   	push   %esi
+  8097e8:	53                   	push   %ebx
+  8097e9:	51                   	push   %ecx
+  8097ea:	e8 a5 fe ff ff       	call   809694 <udivmod>
+  8097ef:	83 c4 10             	add    $0x10,%esp
+  8097f2:	f7 d8                	neg    %eax
+  8097f4:	83 d2 00             	adc    $0x0,%edx
+  8097f7:	f7 da                	neg    %edx
+  8097f9:	83 c4 14             	add    $0x14,%esp
+  8097fc:	5b                   	pop    %ebx
+  8097fd:	5e                   	pop    %esi
+  8097fe:	c3                   	ret
+  8097ff:	83 ec 04             	sub    $0x4,%esp
+  809802:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  809806:	56                   	push   %esi
+  809807:	f7 d9                	neg    %ecx
+  809809:	83 d3 00             	adc    $0x0,%ebx
+  80980c:	f7 db                	neg    %ebx
+  80980e:	53                   	push   %ebx
+  80980f:	51                   	push   %ecx
+  809810:	e8 7f fe ff ff       	call   809694 <udivmod>
+  809815:	83 c4 10             	add    $0x10,%esp
+  809818:	eb d8                	jmp    8097f2 <__divdi3+0x4e>
+  80981a:	83 ec 04             	sub    $0x4,%esp
+  80981d:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  809821:	56                   	push   %esi
+  809822:	f7 d9                	neg    %ecx
+  809824:	83 d3 00             	adc    $0x0,%ebx
+  809827:	f7 db                	neg    %ebx
+  809829:	53                   	push   %ebx
+  80982a:	51                   	push   %ecx
+  80982b:	e8 64 fe ff ff       	call   809694 <udivmod>
+  809830:	83 c4 10             	add    $0x10,%esp
+  809833:	eb c4                	jmp    8097f9 <__divdi3+0x55>
+
+00809835 <__moddi3>:
+  809835:	55                   	push   %ebp
+  809836:	57                   	push   %edi
+  809837:	56                   	push   %esi
+  809838:	53                   	push   %ebx
+  809839:	83 ec 24             	sub    $0x24,%esp
+  80983c:	8b 44 24 38          	mov    0x38(%esp),%eax
+  809840:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  809844:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  809848:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  80984c:	85 d2                	test   %edx,%edx
+  80984e:	78 3b                	js     80988b <__moddi3+0x56>
+  809850:	83 ec 04             	sub    $0x4,%esp
+  809853:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  809857:	56                   	push   %esi
+  809858:	89 ce                	mov    %ecx,%esi
+  80985a:	f7 de                	neg    %esi
+  80985c:	89 74 24 08          	mov    %esi,0x8(%esp)
+  809860:	89 de                	mov    %ebx,%esi
+  809862:	83 d6 00             	adc    $0x0,%esi
+  809865:	f7 de                	neg    %esi
+  809867:	89 74 24 14          	mov    %esi,0x14(%esp)
+  80986b:	8b 74 24 08          	mov    0x8(%esp),%esi
+  80986f:	0f 48 f1             	cmovs  %ecx,%esi
+  809872:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  809877:	53                   	push   %ebx
+  809878:	56                   	push   %esi
+  809879:	e8 16 fe ff ff       	call   809694 <udivmod>
+  80987e:	8b 44 24 28          	mov    0x28(%esp),%eax
+  809882:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  809886:	83 c4 10             	add    $0x10,%esp
+  809889:	eb 47                	jmp    8098d2 <__moddi3+0x9d>
+  80988b:	f7 d8                	neg    %eax
+  80988d:	83 d2 00             	adc    $0x0,%edx
+  809890:	f7 da                	neg    %edx
+  809892:	83 ec 04             	sub    $0x4,%esp
+  809895:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  809899:	56                   	push   %esi
+  80989a:	89 cf                	mov    %ecx,%edi
+  80989c:	f7 df                	neg    %edi
+  80989e:	89 de                	mov    %ebx,%esi
+  8098a0:	83 d6 00             	adc    $0x0,%esi
+  8098a3:	f7 de                	neg    %esi
+  8098a5:	0f 49 cf             	cmovns %edi,%ecx
+  8098a8:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  8098ac:	0f 49 de             	cmovns %esi,%ebx
+  8098af:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  8098b3:	ff 74 24 0c          	push   0xc(%esp)
+  8098b7:	ff 74 24 0c          	push   0xc(%esp)
+  8098bb:	e8 d4 fd ff ff       	call   809694 <udivmod>
+  8098c0:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8098c4:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8098c8:	f7 d8                	neg    %eax
+  8098ca:	83 d2 00             	adc    $0x0,%edx
+  8098cd:	f7 da                	neg    %edx
+  8098cf:	83 c4 10             	add    $0x10,%esp
+  8098d2:	83 c4 24             	add    $0x24,%esp
+  8098d5:	5b                   	pop    %ebx
+  8098d6:	5e                   	pop    %esi
+  8098d7:	5f                   	pop    %edi
+  8098d8:	5d                   	pop    %ebp
+  8098d9:	c3                   	ret
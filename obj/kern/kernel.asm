@@ -0,0 +1,13711 @@
+
+obj/kern/kernel:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+f0100000 <_start+0xeffffff4>:
+f0100000:	02 b0 ad 1b 00 00    	add    0x1bad(%eax),%dh
+f0100006:	00 00                	add    %al,(%eax)
+f0100008:	fe 4f 52             	decb   0x52(%edi)
+f010000b:	e4                   	.byte 0xe4
+
+f010000c <entry>:
+.globl		_start
+_start = RELOC(entry)
+
+.globl entry
+entry:
+	movw	$0x1234,0x472			# warm boot
+f010000c:	66 c7 05 72 04 00 00 	movw   $0x1234,0x472
+f0100013:	34 12 
+	# sufficient until we set up our real page table in mem_init
+	# in lab 2.
+
+	# Load the physical address of entry_pgdir into cr3.  entry_pgdir
+	# is defined in entrypgdir.c.
+	movl	$(RELOC(entry_pgdir)), %eax
+f0100015:	b8 00 30 11 00       	mov    $0x113000,%eax
+	movl	%eax, %cr3
+f010001a:	0f 22 d8             	mov    %eax,%cr3
+	# Turn on paging.
+	movl	%cr0, %eax
+f010001d:	0f 20 c0             	mov    %cr0,%eax
+	orl	$(CR0_PE|CR0_PG|CR0_WP), %eax
+f0100020:	0d 01 00 01 80       	or     $0x80010001,%eax
+	movl	%eax, %cr0
+f0100025:	0f 22 c0             	mov    %eax,%cr0
+
+	# Now paging is enabled, but we're still running at a low EIP
+	# (why is this okay?).  Jump up above KERNBASE before entering
+	# C code.
+	mov	$relocated, %eax
+f0100028:	b8 2f 00 10 f0       	mov    $0xf010002f,%eax
+	jmp	*%eax
+f010002d:	ff e0                	jmp    *%eax
+
+f010002f <relocated>:
+relocated:
+
+	# Clear the frame pointer register (EBP)
+	# so that once we get into debugging C code,
+	# stack backtraces will be terminated properly.
+	movl	$0x0,%ebp			# nuke frame pointer
+f010002f:	bd 00 00 00 00       	mov    $0x0,%ebp
+
+	# Set the stack pointer
+	movl	$(bootstacktop),%esp
+f0100034:	bc 00 30 11 f0       	mov    $0xf0113000,%esp
+
+	# now to C code
+	call	i386_init
+f0100039:	e8 61 00 00 00       	call   f010009f <i386_init>
+
+f010003e <spin>:
+
+	# Should never get here, but in case we do, just spin.
+spin:	jmp	spin
+f010003e:	eb fe                	jmp    f010003e <spin>
+
+f0100040 <_panic>:
+ * Panic is called on unresolvable fatal errors.
+ * It prints "panic: mesg", and then enters the kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+f0100040:	55                   	push   %ebp
+f0100041:	89 e5                	mov    %esp,%ebp
+f0100043:	53                   	push   %ebx
+f0100044:	83 ec 04             	sub    $0x4,%esp
+  va_list ap;
+
+  if (panicstr)
+f0100047:	83 3d 00 bf 79 f0 00 	cmpl   $0x0,0xf079bf00
+f010004e:	74 0f                	je     f010005f <_panic+0x1f>
+  va_end(ap);
+
+dead:
+  /* break into the kernel monitor */
+  while (1)
+    monitor(NULL);
+f0100050:	83 ec 0c             	sub    $0xc,%esp
+f0100053:	6a 00                	push   $0x0
+f0100055:	e8 7e 0c 00 00       	call   f0100cd8 <monitor>
+f010005a:	83 c4 10             	add    $0x10,%esp
+f010005d:	eb f1                	jmp    f0100050 <_panic+0x10>
+  panicstr = fmt;
+f010005f:	8b 45 10             	mov    0x10(%ebp),%eax
+f0100062:	a3 00 bf 79 f0       	mov    %eax,0xf079bf00
+  __asm __volatile("cli; cld");
+f0100067:	fa                   	cli
+f0100068:	fc                   	cld
+  va_start(ap, fmt);
+f0100069:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  cprintf("kernel panic on CPU %d at %s:%d: ", cpunum(), file, line);
+f010006c:	e8 ee 7b 00 00       	call   f0107c5f <cpunum>
+f0100071:	ff 75 0c             	push   0xc(%ebp)
+f0100074:	ff 75 08             	push   0x8(%ebp)
+f0100077:	50                   	push   %eax
+f0100078:	68 a0 82 10 f0       	push   $0xf01082a0
+f010007d:	e8 aa 43 00 00       	call   f010442c <cprintf>
+  vcprintf(fmt, ap);
+f0100082:	83 c4 08             	add    $0x8,%esp
+f0100085:	53                   	push   %ebx
+f0100086:	ff 75 10             	push   0x10(%ebp)
+f0100089:	e8 78 43 00 00       	call   f0104406 <vcprintf>
+  cprintf("\n");
+f010008e:	c7 04 24 1a 99 10 f0 	movl   $0xf010991a,(%esp)
+f0100095:	e8 92 43 00 00       	call   f010442c <cprintf>
+f010009a:	83 c4 10             	add    $0x10,%esp
+f010009d:	eb b1                	jmp    f0100050 <_panic+0x10>
+
+f010009f <i386_init>:
+{
+f010009f:	55                   	push   %ebp
+f01000a0:	89 e5                	mov    %esp,%ebp
+f01000a2:	53                   	push   %ebx
+f01000a3:	83 ec 08             	sub    $0x8,%esp
+  memset(edata, 0, end - edata);
+f01000a6:	b8 08 d0 7d f0       	mov    $0xf07dd008,%eax
+f01000ab:	2d 50 a1 79 f0       	sub    $0xf079a150,%eax
+f01000b0:	50                   	push   %eax
+f01000b1:	6a 00                	push   $0x0
+f01000b3:	68 50 a1 79 f0       	push   $0xf079a150
+f01000b8:	e8 bf 75 00 00       	call   f010767c <memset>
+  cons_init();
+f01000bd:	e8 8a 05 00 00       	call   f010064c <cons_init>
+  cprintf("6828 decimal is %o octal!\n", 6828);
+f01000c2:	83 c4 08             	add    $0x8,%esp
+f01000c5:	68 ac 1a 00 00       	push   $0x1aac
+f01000ca:	68 0c 83 10 f0       	push   $0xf010830c
+f01000cf:	e8 58 43 00 00       	call   f010442c <cprintf>
+  mem_init();
+f01000d4:	e8 bf 1a 00 00       	call   f0101b98 <mem_init>
+  env_init();
+f01000d9:	e8 cd 39 00 00       	call   f0103aab <env_init>
+  trap_init();
+f01000de:	e8 2d 44 00 00       	call   f0104510 <trap_init>
+  mp_init();
+f01000e3:	e8 91 78 00 00       	call   f0107979 <mp_init>
+  lapic_init();
+f01000e8:	e8 88 7b 00 00       	call   f0107c75 <lapic_init>
+  pic_init();
+f01000ed:	e8 45 42 00 00       	call   f0104337 <pic_init>
+  time_init();
+f01000f2:	e8 28 6d 00 00       	call   f0106e1f <time_init>
+extern struct spinlock kernel_lock;
+
+static inline void
+lock_kernel(void)
+{
+	spin_lock(&kernel_lock);
+f01000f7:	c7 04 24 c0 53 11 f0 	movl   $0xf01153c0,(%esp)
+f01000fe:	e8 cc 7d 00 00       	call   f0107ecf <spin_lock>
+#define KADDR(pa) _kaddr(__FILE__, __LINE__, pa)
+
+static inline void*
+_kaddr(const char *file, int line, physaddr_t pa)
+{
+	if (PGNUM(pa) >= npages)
+f0100103:	83 c4 10             	add    $0x10,%esp
+f0100106:	83 3d 08 bf 79 f0 07 	cmpl   $0x7,0xf079bf08
+f010010d:	76 27                	jbe    f0100136 <i386_init+0x97>
+  memmove(code, mpentry_start, mpentry_end - mpentry_start);
+f010010f:	83 ec 04             	sub    $0x4,%esp
+f0100112:	b8 d6 78 10 f0       	mov    $0xf01078d6,%eax
+f0100117:	2d 5c 78 10 f0       	sub    $0xf010785c,%eax
+f010011c:	50                   	push   %eax
+f010011d:	68 5c 78 10 f0       	push   $0xf010785c
+f0100122:	68 00 70 00 f0       	push   $0xf0007000
+f0100127:	e8 85 75 00 00       	call   f01076b1 <memmove>
+  for (c = cpus; c < cpus + ncpu; c++) {
+f010012c:	83 c4 10             	add    $0x10,%esp
+f010012f:	bb 20 c0 79 f0       	mov    $0xf079c020,%ebx
+f0100134:	eb 19                	jmp    f010014f <i386_init+0xb0>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0100136:	68 00 70 00 00       	push   $0x7000
+f010013b:	68 c4 82 10 f0       	push   $0xf01082c4
+f0100140:	6a 62                	push   $0x62
+f0100142:	68 27 83 10 f0       	push   $0xf0108327
+f0100147:	e8 f4 fe ff ff       	call   f0100040 <_panic>
+f010014c:	83 c3 74             	add    $0x74,%ebx
+f010014f:	6b 05 c4 c3 79 f0 74 	imul   $0x74,0xf079c3c4,%eax
+f0100156:	05 20 c0 79 f0       	add    $0xf079c020,%eax
+f010015b:	39 c3                	cmp    %eax,%ebx
+f010015d:	73 4d                	jae    f01001ac <i386_init+0x10d>
+    if (c == cpus + cpunum())              // We've started already.
+f010015f:	e8 fb 7a 00 00       	call   f0107c5f <cpunum>
+f0100164:	6b c0 74             	imul   $0x74,%eax,%eax
+f0100167:	05 20 c0 79 f0       	add    $0xf079c020,%eax
+f010016c:	39 c3                	cmp    %eax,%ebx
+f010016e:	74 dc                	je     f010014c <i386_init+0xad>
+    mpentry_kstack = percpu_kstacks[c - cpus] + KSTKSIZE;
+f0100170:	89 d8                	mov    %ebx,%eax
+f0100172:	2d 20 c0 79 f0       	sub    $0xf079c020,%eax
+f0100177:	c1 f8 02             	sar    $0x2,%eax
+f010017a:	69 c0 35 c2 72 4f    	imul   $0x4f72c235,%eax,%eax
+f0100180:	c1 e0 0f             	shl    $0xf,%eax
+f0100183:	8d 80 00 50 7a f0    	lea    -0xf85b000(%eax),%eax
+f0100189:	a3 04 bf 79 f0       	mov    %eax,0xf079bf04
+    lapic_startap(c->cpu_id, PADDR(code));
+f010018e:	83 ec 08             	sub    $0x8,%esp
+f0100191:	68 00 70 00 00       	push   $0x7000
+f0100196:	0f b6 03             	movzbl (%ebx),%eax
+f0100199:	50                   	push   %eax
+f010019a:	e8 28 7c 00 00       	call   f0107dc7 <lapic_startap>
+    while (c->cpu_status != CPU_STARTED)
+f010019f:	83 c4 10             	add    $0x10,%esp
+f01001a2:	8b 43 04             	mov    0x4(%ebx),%eax
+f01001a5:	83 f8 01             	cmp    $0x1,%eax
+f01001a8:	75 f8                	jne    f01001a2 <i386_init+0x103>
+f01001aa:	eb a0                	jmp    f010014c <i386_init+0xad>
+  ENV_CREATE(fs_fs, ENV_TYPE_FS);
+f01001ac:	83 ec 08             	sub    $0x8,%esp
+f01001af:	6a 01                	push   $0x1
+f01001b1:	68 f4 47 45 f0       	push   $0xf04547f4
+f01001b6:	e8 c9 3a 00 00       	call   f0103c84 <env_create>
+  ENV_CREATE(user_icode, ENV_TYPE_USER);
+f01001bb:	83 c4 08             	add    $0x8,%esp
+f01001be:	6a 00                	push   $0x0
+f01001c0:	68 a8 ac 43 f0       	push   $0xf043aca8
+f01001c5:	e8 ba 3a 00 00       	call   f0103c84 <env_create>
+  kbd_intr();
+f01001ca:	e8 29 04 00 00       	call   f01005f8 <kbd_intr>
+  sched_yield();
+f01001cf:	e8 08 53 00 00       	call   f01054dc <sched_yield>
+
+f01001d4 <mp_main>:
+{
+f01001d4:	55                   	push   %ebp
+f01001d5:	89 e5                	mov    %esp,%ebp
+f01001d7:	83 ec 08             	sub    $0x8,%esp
+  lcr3(PADDR(kern_pgdir));
+f01001da:	a1 0c bf 79 f0       	mov    0xf079bf0c,%eax
+	if ((uint32_t)kva < KERNBASE)
+f01001df:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f01001e4:	76 52                	jbe    f0100238 <mp_main+0x64>
+	return (physaddr_t)kva - KERNBASE;
+f01001e6:	05 00 00 00 10       	add    $0x10000000,%eax
+}
+
+static __inline void
+lcr3(uint32_t val)
+{
+  __asm __volatile("movl %0,%%cr3" : : "r" (val));
+f01001eb:	0f 22 d8             	mov    %eax,%cr3
+  cprintf("SMP: CPU %d starting\n", cpunum());
+f01001ee:	e8 6c 7a 00 00       	call   f0107c5f <cpunum>
+f01001f3:	83 ec 08             	sub    $0x8,%esp
+f01001f6:	50                   	push   %eax
+f01001f7:	68 33 83 10 f0       	push   $0xf0108333
+f01001fc:	e8 2b 42 00 00       	call   f010442c <cprintf>
+  lapic_init();
+f0100201:	e8 6f 7a 00 00       	call   f0107c75 <lapic_init>
+  env_init_percpu();
+f0100206:	e8 74 38 00 00       	call   f0103a7f <env_init_percpu>
+  trap_init_percpu();
+f010020b:	e8 30 42 00 00       	call   f0104440 <trap_init_percpu>
+  xchg(&thiscpu->cpu_status, CPU_STARTED);       // tell boot_aps() we're up
+f0100210:	e8 4a 7a 00 00       	call   f0107c5f <cpunum>
+f0100215:	6b d0 74             	imul   $0x74,%eax,%edx
+f0100218:	83 c2 04             	add    $0x4,%edx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+f010021b:	b8 01 00 00 00       	mov    $0x1,%eax
+f0100220:	f0 87 82 20 c0 79 f0 	lock xchg %eax,-0xf863fe0(%edx)
+f0100227:	c7 04 24 c0 53 11 f0 	movl   $0xf01153c0,(%esp)
+f010022e:	e8 9c 7c 00 00       	call   f0107ecf <spin_lock>
+  sched_yield();
+f0100233:	e8 a4 52 00 00       	call   f01054dc <sched_yield>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0100238:	50                   	push   %eax
+f0100239:	68 e8 82 10 f0       	push   $0xf01082e8
+f010023e:	6a 79                	push   $0x79
+f0100240:	68 27 83 10 f0       	push   $0xf0108327
+f0100245:	e8 f6 fd ff ff       	call   f0100040 <_panic>
+
+f010024a <_warn>:
+}
+
+/* like panic, but don't */
+void
+_warn(const char *file, int line, const char *fmt, ...)
+{
+f010024a:	55                   	push   %ebp
+f010024b:	89 e5                	mov    %esp,%ebp
+f010024d:	53                   	push   %ebx
+f010024e:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+
+  va_start(ap, fmt);
+f0100251:	8d 5d 14             	lea    0x14(%ebp),%ebx
+  cprintf("kernel warning at %s:%d: ", file, line);
+f0100254:	ff 75 0c             	push   0xc(%ebp)
+f0100257:	ff 75 08             	push   0x8(%ebp)
+f010025a:	68 49 83 10 f0       	push   $0xf0108349
+f010025f:	e8 c8 41 00 00       	call   f010442c <cprintf>
+  vcprintf(fmt, ap);
+f0100264:	83 c4 08             	add    $0x8,%esp
+f0100267:	53                   	push   %ebx
+f0100268:	ff 75 10             	push   0x10(%ebp)
+f010026b:	e8 96 41 00 00       	call   f0104406 <vcprintf>
+  cprintf("\n");
+f0100270:	c7 04 24 1a 99 10 f0 	movl   $0xf010991a,(%esp)
+f0100277:	e8 b0 41 00 00       	call   f010442c <cprintf>
+  va_end(ap);
+}
+f010027c:	83 c4 10             	add    $0x10,%esp
+f010027f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0100282:	c9                   	leave
+f0100283:	c3                   	ret
+
+f0100284 <serial_proc_data>:
+  __asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f0100284:	ba fd 03 00 00       	mov    $0x3fd,%edx
+f0100289:	ec                   	in     (%dx),%al
+static bool serial_exists;
+
+static int
+serial_proc_data(void)
+{
+  if (!(inb(COM1+COM_LSR) & COM_LSR_DATA))
+f010028a:	a8 01                	test   $0x1,%al
+f010028c:	74 0a                	je     f0100298 <serial_proc_data+0x14>
+f010028e:	ba f8 03 00 00       	mov    $0x3f8,%edx
+f0100293:	ec                   	in     (%dx),%al
+    return -1;
+  return inb(COM1+COM_RX);
+f0100294:	0f b6 c0             	movzbl %al,%eax
+f0100297:	c3                   	ret
+    return -1;
+f0100298:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+f010029d:	c3                   	ret
+
+f010029e <cons_intr>:
+
+// called by device interrupt routines to feed input characters
+// into the circular console input buffer.
+static void
+cons_intr(int (*proc)(void))
+{
+f010029e:	55                   	push   %ebp
+f010029f:	89 e5                	mov    %esp,%ebp
+f01002a1:	53                   	push   %ebx
+f01002a2:	83 ec 04             	sub    $0x4,%esp
+f01002a5:	89 c3                	mov    %eax,%ebx
+  int c;
+
+  while ((c = (*proc)()) != -1) {
+f01002a7:	eb 23                	jmp    f01002cc <cons_intr+0x2e>
+    if (c == 0)
+      continue;
+    cons.buf[cons.wpos++] = c;
+f01002a9:	8b 0d 24 b2 79 f0    	mov    0xf079b224,%ecx
+f01002af:	8d 51 01             	lea    0x1(%ecx),%edx
+f01002b2:	88 81 20 b0 79 f0    	mov    %al,-0xf864fe0(%ecx)
+    if (cons.wpos == CONSBUFSIZE)
+f01002b8:	81 fa 00 02 00 00    	cmp    $0x200,%edx
+      cons.wpos = 0;
+f01002be:	b8 00 00 00 00       	mov    $0x0,%eax
+f01002c3:	0f 44 d0             	cmove  %eax,%edx
+f01002c6:	89 15 24 b2 79 f0    	mov    %edx,0xf079b224
+  while ((c = (*proc)()) != -1) {
+f01002cc:	ff d3                	call   *%ebx
+f01002ce:	83 f8 ff             	cmp    $0xffffffff,%eax
+f01002d1:	74 06                	je     f01002d9 <cons_intr+0x3b>
+    if (c == 0)
+f01002d3:	85 c0                	test   %eax,%eax
+f01002d5:	75 d2                	jne    f01002a9 <cons_intr+0xb>
+f01002d7:	eb f3                	jmp    f01002cc <cons_intr+0x2e>
+  }
+}
+f01002d9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01002dc:	c9                   	leave
+f01002dd:	c3                   	ret
+
+f01002de <kbd_proc_data>:
+{
+f01002de:	55                   	push   %ebp
+f01002df:	89 e5                	mov    %esp,%ebp
+f01002e1:	53                   	push   %ebx
+f01002e2:	83 ec 04             	sub    $0x4,%esp
+f01002e5:	ba 64 00 00 00       	mov    $0x64,%edx
+f01002ea:	ec                   	in     (%dx),%al
+  if ((inb(KBSTATP) & KBS_DIB) == 0)
+f01002eb:	a8 01                	test   $0x1,%al
+f01002ed:	0f 84 e6 00 00 00    	je     f01003d9 <kbd_proc_data+0xfb>
+f01002f3:	ba 60 00 00 00       	mov    $0x60,%edx
+f01002f8:	ec                   	in     (%dx),%al
+f01002f9:	89 c2                	mov    %eax,%edx
+  if (data == 0xE0) {
+f01002fb:	3c e0                	cmp    $0xe0,%al
+f01002fd:	74 61                	je     f0100360 <kbd_proc_data+0x82>
+  } else if (data & 0x80) {
+f01002ff:	84 c0                	test   %al,%al
+f0100301:	78 70                	js     f0100373 <kbd_proc_data+0x95>
+  } else if (shift & E0ESC) {
+f0100303:	8b 0d 00 b0 79 f0    	mov    0xf079b000,%ecx
+f0100309:	f6 c1 40             	test   $0x40,%cl
+f010030c:	74 0e                	je     f010031c <kbd_proc_data+0x3e>
+    data |= 0x80;
+f010030e:	83 c8 80             	or     $0xffffff80,%eax
+f0100311:	89 c2                	mov    %eax,%edx
+    shift &= ~E0ESC;
+f0100313:	83 e1 bf             	and    $0xffffffbf,%ecx
+f0100316:	89 0d 00 b0 79 f0    	mov    %ecx,0xf079b000
+  shift |= shiftcode[data];
+f010031c:	0f b6 d2             	movzbl %dl,%edx
+f010031f:	0f b6 82 c0 84 10 f0 	movzbl -0xfef7b40(%edx),%eax
+f0100326:	0b 05 00 b0 79 f0    	or     0xf079b000,%eax
+  shift ^= togglecode[data];
+f010032c:	0f b6 8a c0 83 10 f0 	movzbl -0xfef7c40(%edx),%ecx
+f0100333:	31 c8                	xor    %ecx,%eax
+f0100335:	a3 00 b0 79 f0       	mov    %eax,0xf079b000
+  c = charcode[shift & (CTL | SHIFT)][data];
+f010033a:	89 c1                	mov    %eax,%ecx
+f010033c:	83 e1 03             	and    $0x3,%ecx
+f010033f:	8b 0c 8d a0 83 10 f0 	mov    -0xfef7c60(,%ecx,4),%ecx
+f0100346:	0f b6 14 11          	movzbl (%ecx,%edx,1),%edx
+f010034a:	0f b6 da             	movzbl %dl,%ebx
+  if (shift & CAPSLOCK) {
+f010034d:	a8 08                	test   $0x8,%al
+f010034f:	74 5d                	je     f01003ae <kbd_proc_data+0xd0>
+    if ('a' <= c && c <= 'z')
+f0100351:	89 da                	mov    %ebx,%edx
+f0100353:	8d 4b 9f             	lea    -0x61(%ebx),%ecx
+f0100356:	83 f9 19             	cmp    $0x19,%ecx
+f0100359:	77 47                	ja     f01003a2 <kbd_proc_data+0xc4>
+      c += 'A' - 'a';
+f010035b:	83 eb 20             	sub    $0x20,%ebx
+  if (!(~shift & (CTL | ALT)) && c == KEY_DEL) {
+f010035e:	eb 0c                	jmp    f010036c <kbd_proc_data+0x8e>
+    shift |= E0ESC;
+f0100360:	83 0d 00 b0 79 f0 40 	orl    $0x40,0xf079b000
+    return 0;
+f0100367:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+f010036c:	89 d8                	mov    %ebx,%eax
+f010036e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0100371:	c9                   	leave
+f0100372:	c3                   	ret
+    data = (shift & E0ESC ? data : data & 0x7F);
+f0100373:	8b 0d 00 b0 79 f0    	mov    0xf079b000,%ecx
+f0100379:	83 e0 7f             	and    $0x7f,%eax
+f010037c:	f6 c1 40             	test   $0x40,%cl
+f010037f:	0f 44 d0             	cmove  %eax,%edx
+    shift &= ~(shiftcode[data] | E0ESC);
+f0100382:	0f b6 d2             	movzbl %dl,%edx
+f0100385:	0f b6 82 c0 84 10 f0 	movzbl -0xfef7b40(%edx),%eax
+f010038c:	83 c8 40             	or     $0x40,%eax
+f010038f:	0f b6 c0             	movzbl %al,%eax
+f0100392:	f7 d0                	not    %eax
+f0100394:	21 c8                	and    %ecx,%eax
+f0100396:	a3 00 b0 79 f0       	mov    %eax,0xf079b000
+    return 0;
+f010039b:	bb 00 00 00 00       	mov    $0x0,%ebx
+f01003a0:	eb ca                	jmp    f010036c <kbd_proc_data+0x8e>
+    else if ('A' <= c && c <= 'Z')
+f01003a2:	83 ea 41             	sub    $0x41,%edx
+      c += 'a' - 'A';
+f01003a5:	8d 4b 20             	lea    0x20(%ebx),%ecx
+f01003a8:	83 fa 1a             	cmp    $0x1a,%edx
+f01003ab:	0f 42 d9             	cmovb  %ecx,%ebx
+  if (!(~shift & (CTL | ALT)) && c == KEY_DEL) {
+f01003ae:	f7 d0                	not    %eax
+f01003b0:	a8 06                	test   $0x6,%al
+f01003b2:	75 b8                	jne    f010036c <kbd_proc_data+0x8e>
+f01003b4:	81 fb e9 00 00 00    	cmp    $0xe9,%ebx
+f01003ba:	75 b0                	jne    f010036c <kbd_proc_data+0x8e>
+    cprintf("Rebooting!\n");
+f01003bc:	83 ec 0c             	sub    $0xc,%esp
+f01003bf:	68 63 83 10 f0       	push   $0xf0108363
+f01003c4:	e8 63 40 00 00       	call   f010442c <cprintf>
+  __asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f01003c9:	b8 03 00 00 00       	mov    $0x3,%eax
+f01003ce:	ba 92 00 00 00       	mov    $0x92,%edx
+f01003d3:	ee                   	out    %al,(%dx)
+}
+f01003d4:	83 c4 10             	add    $0x10,%esp
+f01003d7:	eb 93                	jmp    f010036c <kbd_proc_data+0x8e>
+    return -1;
+f01003d9:	bb ff ff ff ff       	mov    $0xffffffff,%ebx
+f01003de:	eb 8c                	jmp    f010036c <kbd_proc_data+0x8e>
+
+f01003e0 <cons_putc>:
+}
+
+// output a character to the console
+static void
+cons_putc(int c)
+{
+f01003e0:	55                   	push   %ebp
+f01003e1:	89 e5                	mov    %esp,%ebp
+f01003e3:	57                   	push   %edi
+f01003e4:	56                   	push   %esi
+f01003e5:	53                   	push   %ebx
+f01003e6:	83 ec 1c             	sub    $0x1c,%esp
+f01003e9:	89 c7                	mov    %eax,%edi
+  for (i = 0;
+f01003eb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  __asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f01003f0:	be fd 03 00 00       	mov    $0x3fd,%esi
+f01003f5:	b9 84 00 00 00       	mov    $0x84,%ecx
+f01003fa:	89 f2                	mov    %esi,%edx
+f01003fc:	ec                   	in     (%dx),%al
+       !(inb(COM1 + COM_LSR) & COM_LSR_TXRDY) && i < 12800;
+f01003fd:	a8 20                	test   $0x20,%al
+f01003ff:	75 13                	jne    f0100414 <cons_putc+0x34>
+f0100401:	81 fb ff 31 00 00    	cmp    $0x31ff,%ebx
+f0100407:	7f 0b                	jg     f0100414 <cons_putc+0x34>
+f0100409:	89 ca                	mov    %ecx,%edx
+f010040b:	ec                   	in     (%dx),%al
+f010040c:	ec                   	in     (%dx),%al
+f010040d:	ec                   	in     (%dx),%al
+f010040e:	ec                   	in     (%dx),%al
+       i++)
+f010040f:	83 c3 01             	add    $0x1,%ebx
+f0100412:	eb e6                	jmp    f01003fa <cons_putc+0x1a>
+  outb(COM1 + COM_TX, c);
+f0100414:	89 f8                	mov    %edi,%eax
+f0100416:	88 45 e7             	mov    %al,-0x19(%ebp)
+  __asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0100419:	ba f8 03 00 00       	mov    $0x3f8,%edx
+f010041e:	ee                   	out    %al,(%dx)
+  for (i = 0; !(inb(0x378+1) & 0x80) && i < 12800; i++)
+f010041f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  __asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f0100424:	be 79 03 00 00       	mov    $0x379,%esi
+f0100429:	b9 84 00 00 00       	mov    $0x84,%ecx
+f010042e:	89 f2                	mov    %esi,%edx
+f0100430:	ec                   	in     (%dx),%al
+f0100431:	81 fb ff 31 00 00    	cmp    $0x31ff,%ebx
+f0100437:	7f 0f                	jg     f0100448 <cons_putc+0x68>
+f0100439:	84 c0                	test   %al,%al
+f010043b:	78 0b                	js     f0100448 <cons_putc+0x68>
+f010043d:	89 ca                	mov    %ecx,%edx
+f010043f:	ec                   	in     (%dx),%al
+f0100440:	ec                   	in     (%dx),%al
+f0100441:	ec                   	in     (%dx),%al
+f0100442:	ec                   	in     (%dx),%al
+f0100443:	83 c3 01             	add    $0x1,%ebx
+f0100446:	eb e6                	jmp    f010042e <cons_putc+0x4e>
+  __asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0100448:	ba 78 03 00 00       	mov    $0x378,%edx
+f010044d:	0f b6 45 e7          	movzbl -0x19(%ebp),%eax
+f0100451:	ee                   	out    %al,(%dx)
+f0100452:	ba 7a 03 00 00       	mov    $0x37a,%edx
+f0100457:	b8 0d 00 00 00       	mov    $0xd,%eax
+f010045c:	ee                   	out    %al,(%dx)
+f010045d:	b8 08 00 00 00       	mov    $0x8,%eax
+f0100462:	ee                   	out    %al,(%dx)
+    c |= 0x0700;
+f0100463:	89 f8                	mov    %edi,%eax
+f0100465:	80 cc 07             	or     $0x7,%ah
+f0100468:	81 ff 00 01 00 00    	cmp    $0x100,%edi
+f010046e:	0f 42 f8             	cmovb  %eax,%edi
+  switch (c & 0xff) {
+f0100471:	89 f8                	mov    %edi,%eax
+f0100473:	0f b6 c0             	movzbl %al,%eax
+f0100476:	89 fb                	mov    %edi,%ebx
+f0100478:	80 fb 0a             	cmp    $0xa,%bl
+f010047b:	0f 84 e1 00 00 00    	je     f0100562 <cons_putc+0x182>
+f0100481:	83 f8 0a             	cmp    $0xa,%eax
+f0100484:	7f 46                	jg     f01004cc <cons_putc+0xec>
+f0100486:	83 f8 08             	cmp    $0x8,%eax
+f0100489:	0f 84 a7 00 00 00    	je     f0100536 <cons_putc+0x156>
+f010048f:	83 f8 09             	cmp    $0x9,%eax
+f0100492:	0f 85 d7 00 00 00    	jne    f010056f <cons_putc+0x18f>
+    cons_putc(' ');
+f0100498:	b8 20 00 00 00       	mov    $0x20,%eax
+f010049d:	e8 3e ff ff ff       	call   f01003e0 <cons_putc>
+    cons_putc(' ');
+f01004a2:	b8 20 00 00 00       	mov    $0x20,%eax
+f01004a7:	e8 34 ff ff ff       	call   f01003e0 <cons_putc>
+    cons_putc(' ');
+f01004ac:	b8 20 00 00 00       	mov    $0x20,%eax
+f01004b1:	e8 2a ff ff ff       	call   f01003e0 <cons_putc>
+    cons_putc(' ');
+f01004b6:	b8 20 00 00 00       	mov    $0x20,%eax
+f01004bb:	e8 20 ff ff ff       	call   f01003e0 <cons_putc>
+    cons_putc(' ');
+f01004c0:	b8 20 00 00 00       	mov    $0x20,%eax
+f01004c5:	e8 16 ff ff ff       	call   f01003e0 <cons_putc>
+    break;
+f01004ca:	eb 25                	jmp    f01004f1 <cons_putc+0x111>
+  switch (c & 0xff) {
+f01004cc:	83 f8 0d             	cmp    $0xd,%eax
+f01004cf:	0f 85 9a 00 00 00    	jne    f010056f <cons_putc+0x18f>
+    crt_pos -= (crt_pos % CRT_COLS);
+f01004d5:	0f b7 05 28 b2 79 f0 	movzwl 0xf079b228,%eax
+f01004dc:	69 c0 cd cc 00 00    	imul   $0xcccd,%eax,%eax
+f01004e2:	c1 e8 16             	shr    $0x16,%eax
+f01004e5:	8d 04 80             	lea    (%eax,%eax,4),%eax
+f01004e8:	c1 e0 04             	shl    $0x4,%eax
+f01004eb:	66 a3 28 b2 79 f0    	mov    %ax,0xf079b228
+  if (crt_pos >= CRT_SIZE) {
+f01004f1:	66 81 3d 28 b2 79 f0 	cmpw   $0x7cf,0xf079b228
+f01004f8:	cf 07 
+f01004fa:	0f 87 92 00 00 00    	ja     f0100592 <cons_putc+0x1b2>
+  outb(addr_6845, 14);
+f0100500:	8b 0d 30 b2 79 f0    	mov    0xf079b230,%ecx
+f0100506:	b8 0e 00 00 00       	mov    $0xe,%eax
+f010050b:	89 ca                	mov    %ecx,%edx
+f010050d:	ee                   	out    %al,(%dx)
+  outb(addr_6845 + 1, crt_pos >> 8);
+f010050e:	0f b7 1d 28 b2 79 f0 	movzwl 0xf079b228,%ebx
+f0100515:	8d 71 01             	lea    0x1(%ecx),%esi
+f0100518:	89 d8                	mov    %ebx,%eax
+f010051a:	66 c1 e8 08          	shr    $0x8,%ax
+f010051e:	89 f2                	mov    %esi,%edx
+f0100520:	ee                   	out    %al,(%dx)
+f0100521:	b8 0f 00 00 00       	mov    $0xf,%eax
+f0100526:	89 ca                	mov    %ecx,%edx
+f0100528:	ee                   	out    %al,(%dx)
+f0100529:	89 d8                	mov    %ebx,%eax
+f010052b:	89 f2                	mov    %esi,%edx
+f010052d:	ee                   	out    %al,(%dx)
+  serial_putc(c);
+  lpt_putc(c);
+  cga_putc(c);
+}
+f010052e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0100531:	5b                   	pop    %ebx
+f0100532:	5e                   	pop    %esi
+f0100533:	5f                   	pop    %edi
+f0100534:	5d                   	pop    %ebp
+f0100535:	c3                   	ret
+    if (crt_pos > 0) {
+f0100536:	0f b7 05 28 b2 79 f0 	movzwl 0xf079b228,%eax
+f010053d:	66 85 c0             	test   %ax,%ax
+f0100540:	74 be                	je     f0100500 <cons_putc+0x120>
+      crt_pos--;
+f0100542:	83 e8 01             	sub    $0x1,%eax
+f0100545:	66 a3 28 b2 79 f0    	mov    %ax,0xf079b228
+      crt_buf[crt_pos] = (c & ~0xff) | ' ';
+f010054b:	0f b7 c0             	movzwl %ax,%eax
+f010054e:	66 81 e7 00 ff       	and    $0xff00,%di
+f0100553:	83 cf 20             	or     $0x20,%edi
+f0100556:	8b 15 2c b2 79 f0    	mov    0xf079b22c,%edx
+f010055c:	66 89 3c 42          	mov    %di,(%edx,%eax,2)
+f0100560:	eb 8f                	jmp    f01004f1 <cons_putc+0x111>
+    crt_pos += CRT_COLS;
+f0100562:	66 83 05 28 b2 79 f0 	addw   $0x50,0xf079b228
+f0100569:	50 
+f010056a:	e9 66 ff ff ff       	jmp    f01004d5 <cons_putc+0xf5>
+    crt_buf[crt_pos++] = c;                     /* write the character */
+f010056f:	0f b7 05 28 b2 79 f0 	movzwl 0xf079b228,%eax
+f0100576:	8d 50 01             	lea    0x1(%eax),%edx
+f0100579:	66 89 15 28 b2 79 f0 	mov    %dx,0xf079b228
+f0100580:	0f b7 c0             	movzwl %ax,%eax
+f0100583:	8b 15 2c b2 79 f0    	mov    0xf079b22c,%edx
+f0100589:	66 89 3c 42          	mov    %di,(%edx,%eax,2)
+    break;
+f010058d:	e9 5f ff ff ff       	jmp    f01004f1 <cons_putc+0x111>
+    memmove(crt_buf, crt_buf + CRT_COLS, (CRT_SIZE - CRT_COLS) * sizeof(uint16_t));
+f0100592:	a1 2c b2 79 f0       	mov    0xf079b22c,%eax
+f0100597:	83 ec 04             	sub    $0x4,%esp
+f010059a:	68 00 0f 00 00       	push   $0xf00
+f010059f:	8d 90 a0 00 00 00    	lea    0xa0(%eax),%edx
+f01005a5:	52                   	push   %edx
+f01005a6:	50                   	push   %eax
+f01005a7:	e8 05 71 00 00       	call   f01076b1 <memmove>
+      crt_buf[i] = 0x0700 | ' ';
+f01005ac:	8b 15 2c b2 79 f0    	mov    0xf079b22c,%edx
+f01005b2:	8d 82 00 0f 00 00    	lea    0xf00(%edx),%eax
+f01005b8:	81 c2 a0 0f 00 00    	add    $0xfa0,%edx
+    for (i = CRT_SIZE - CRT_COLS; i < CRT_SIZE; i++)
+f01005be:	83 c4 10             	add    $0x10,%esp
+f01005c1:	eb 08                	jmp    f01005cb <cons_putc+0x1eb>
+      crt_buf[i] = 0x0700 | ' ';
+f01005c3:	66 c7 00 20 07       	movw   $0x720,(%eax)
+    for (i = CRT_SIZE - CRT_COLS; i < CRT_SIZE; i++)
+f01005c8:	83 c0 02             	add    $0x2,%eax
+f01005cb:	39 d0                	cmp    %edx,%eax
+f01005cd:	75 f4                	jne    f01005c3 <cons_putc+0x1e3>
+    crt_pos -= CRT_COLS;
+f01005cf:	66 83 2d 28 b2 79 f0 	subw   $0x50,0xf079b228
+f01005d6:	50 
+f01005d7:	e9 24 ff ff ff       	jmp    f0100500 <cons_putc+0x120>
+
+f01005dc <serial_intr>:
+  if (serial_exists)
+f01005dc:	80 3d 34 b2 79 f0 00 	cmpb   $0x0,0xf079b234
+f01005e3:	75 01                	jne    f01005e6 <serial_intr+0xa>
+f01005e5:	c3                   	ret
+{
+f01005e6:	55                   	push   %ebp
+f01005e7:	89 e5                	mov    %esp,%ebp
+f01005e9:	83 ec 08             	sub    $0x8,%esp
+    cons_intr(serial_proc_data);
+f01005ec:	b8 84 02 10 f0       	mov    $0xf0100284,%eax
+f01005f1:	e8 a8 fc ff ff       	call   f010029e <cons_intr>
+}
+f01005f6:	c9                   	leave
+f01005f7:	c3                   	ret
+
+f01005f8 <kbd_intr>:
+{
+f01005f8:	55                   	push   %ebp
+f01005f9:	89 e5                	mov    %esp,%ebp
+f01005fb:	83 ec 08             	sub    $0x8,%esp
+  cons_intr(kbd_proc_data);
+f01005fe:	b8 de 02 10 f0       	mov    $0xf01002de,%eax
+f0100603:	e8 96 fc ff ff       	call   f010029e <cons_intr>
+}
+f0100608:	c9                   	leave
+f0100609:	c3                   	ret
+
+f010060a <cons_getc>:
+{
+f010060a:	55                   	push   %ebp
+f010060b:	89 e5                	mov    %esp,%ebp
+f010060d:	83 ec 08             	sub    $0x8,%esp
+  serial_intr();
+f0100610:	e8 c7 ff ff ff       	call   f01005dc <serial_intr>
+  kbd_intr();
+f0100615:	e8 de ff ff ff       	call   f01005f8 <kbd_intr>
+  if (cons.rpos != cons.wpos) {
+f010061a:	a1 20 b2 79 f0       	mov    0xf079b220,%eax
+  return 0;
+f010061f:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (cons.rpos != cons.wpos) {
+f0100624:	3b 05 24 b2 79 f0    	cmp    0xf079b224,%eax
+f010062a:	74 1c                	je     f0100648 <cons_getc+0x3e>
+    c = cons.buf[cons.rpos++];
+f010062c:	8d 48 01             	lea    0x1(%eax),%ecx
+f010062f:	0f b6 90 20 b0 79 f0 	movzbl -0xf864fe0(%eax),%edx
+      cons.rpos = 0;
+f0100636:	3d ff 01 00 00       	cmp    $0x1ff,%eax
+f010063b:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100640:	0f 45 c1             	cmovne %ecx,%eax
+f0100643:	a3 20 b2 79 f0       	mov    %eax,0xf079b220
+}
+f0100648:	89 d0                	mov    %edx,%eax
+f010064a:	c9                   	leave
+f010064b:	c3                   	ret
+
+f010064c <cons_init>:
+
+// initialize the console devices
+void
+cons_init(void)
+{
+f010064c:	55                   	push   %ebp
+f010064d:	89 e5                	mov    %esp,%ebp
+f010064f:	57                   	push   %edi
+f0100650:	56                   	push   %esi
+f0100651:	53                   	push   %ebx
+f0100652:	83 ec 0c             	sub    $0xc,%esp
+  was = *cp;
+f0100655:	0f b7 15 00 80 0b f0 	movzwl 0xf00b8000,%edx
+  *cp = (uint16_t)0xA55A;
+f010065c:	66 c7 05 00 80 0b f0 	movw   $0xa55a,0xf00b8000
+f0100663:	5a a5 
+  if (*cp != 0xA55A) {
+f0100665:	0f b7 05 00 80 0b f0 	movzwl 0xf00b8000,%eax
+f010066c:	bb b4 03 00 00       	mov    $0x3b4,%ebx
+    cp = (uint16_t*)(KERNBASE + MONO_BUF);
+f0100671:	be 00 00 0b f0       	mov    $0xf00b0000,%esi
+  if (*cp != 0xA55A) {
+f0100676:	66 3d 5a a5          	cmp    $0xa55a,%ax
+f010067a:	0f 84 cd 00 00 00    	je     f010074d <cons_init+0x101>
+    addr_6845 = MONO_BASE;
+f0100680:	89 1d 30 b2 79 f0    	mov    %ebx,0xf079b230
+f0100686:	b8 0e 00 00 00       	mov    $0xe,%eax
+f010068b:	89 da                	mov    %ebx,%edx
+f010068d:	ee                   	out    %al,(%dx)
+  pos = inb(addr_6845 + 1) << 8;
+f010068e:	8d 7b 01             	lea    0x1(%ebx),%edi
+  __asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f0100691:	89 fa                	mov    %edi,%edx
+f0100693:	ec                   	in     (%dx),%al
+f0100694:	0f b6 c8             	movzbl %al,%ecx
+f0100697:	c1 e1 08             	shl    $0x8,%ecx
+  __asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f010069a:	b8 0f 00 00 00       	mov    $0xf,%eax
+f010069f:	89 da                	mov    %ebx,%edx
+f01006a1:	ee                   	out    %al,(%dx)
+  __asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f01006a2:	89 fa                	mov    %edi,%edx
+f01006a4:	ec                   	in     (%dx),%al
+  crt_buf = (uint16_t*)cp;
+f01006a5:	89 35 2c b2 79 f0    	mov    %esi,0xf079b22c
+  pos |= inb(addr_6845 + 1);
+f01006ab:	0f b6 c0             	movzbl %al,%eax
+f01006ae:	09 c8                	or     %ecx,%eax
+  crt_pos = pos;
+f01006b0:	66 a3 28 b2 79 f0    	mov    %ax,0xf079b228
+  kbd_intr();
+f01006b6:	e8 3d ff ff ff       	call   f01005f8 <kbd_intr>
+  irq_setmask_8259A(irq_mask_8259A & ~(1<<1));
+f01006bb:	83 ec 0c             	sub    $0xc,%esp
+f01006be:	0f b7 05 a8 53 11 f0 	movzwl 0xf01153a8,%eax
+f01006c5:	25 fd ff 00 00       	and    $0xfffd,%eax
+f01006ca:	50                   	push   %eax
+f01006cb:	e8 e4 3b 00 00       	call   f01042b4 <irq_setmask_8259A>
+  __asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f01006d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+f01006d5:	bb fa 03 00 00       	mov    $0x3fa,%ebx
+f01006da:	89 c8                	mov    %ecx,%eax
+f01006dc:	89 da                	mov    %ebx,%edx
+f01006de:	ee                   	out    %al,(%dx)
+f01006df:	bf fb 03 00 00       	mov    $0x3fb,%edi
+f01006e4:	b8 80 ff ff ff       	mov    $0xffffff80,%eax
+f01006e9:	89 fa                	mov    %edi,%edx
+f01006eb:	ee                   	out    %al,(%dx)
+f01006ec:	b8 0c 00 00 00       	mov    $0xc,%eax
+f01006f1:	ba f8 03 00 00       	mov    $0x3f8,%edx
+f01006f6:	ee                   	out    %al,(%dx)
+f01006f7:	be f9 03 00 00       	mov    $0x3f9,%esi
+f01006fc:	89 c8                	mov    %ecx,%eax
+f01006fe:	89 f2                	mov    %esi,%edx
+f0100700:	ee                   	out    %al,(%dx)
+f0100701:	b8 03 00 00 00       	mov    $0x3,%eax
+f0100706:	89 fa                	mov    %edi,%edx
+f0100708:	ee                   	out    %al,(%dx)
+f0100709:	ba fc 03 00 00       	mov    $0x3fc,%edx
+f010070e:	89 c8                	mov    %ecx,%eax
+f0100710:	ee                   	out    %al,(%dx)
+f0100711:	b8 01 00 00 00       	mov    $0x1,%eax
+f0100716:	89 f2                	mov    %esi,%edx
+f0100718:	ee                   	out    %al,(%dx)
+  __asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f0100719:	ba fd 03 00 00       	mov    $0x3fd,%edx
+f010071e:	ec                   	in     (%dx),%al
+f010071f:	89 c1                	mov    %eax,%ecx
+  serial_exists = (inb(COM1+COM_LSR) != 0xFF);
+f0100721:	83 c4 10             	add    $0x10,%esp
+f0100724:	3c ff                	cmp    $0xff,%al
+f0100726:	0f 95 05 34 b2 79 f0 	setne  0xf079b234
+f010072d:	89 da                	mov    %ebx,%edx
+f010072f:	ec                   	in     (%dx),%al
+f0100730:	ba f8 03 00 00       	mov    $0x3f8,%edx
+f0100735:	ec                   	in     (%dx),%al
+  if (serial_exists)
+f0100736:	80 f9 ff             	cmp    $0xff,%cl
+f0100739:	75 28                	jne    f0100763 <cons_init+0x117>
+  cga_init();
+  kbd_init();
+  serial_init();
+
+  if (!serial_exists)
+    cprintf("Serial port does not exist!\n");
+f010073b:	83 ec 0c             	sub    $0xc,%esp
+f010073e:	68 6f 83 10 f0       	push   $0xf010836f
+f0100743:	e8 e4 3c 00 00       	call   f010442c <cprintf>
+f0100748:	83 c4 10             	add    $0x10,%esp
+}
+f010074b:	eb 37                	jmp    f0100784 <cons_init+0x138>
+    *cp = was;
+f010074d:	66 89 15 00 80 0b f0 	mov    %dx,0xf00b8000
+f0100754:	bb d4 03 00 00       	mov    $0x3d4,%ebx
+  cp = (uint16_t*)(KERNBASE + CGA_BUF);
+f0100759:	be 00 80 0b f0       	mov    $0xf00b8000,%esi
+f010075e:	e9 1d ff ff ff       	jmp    f0100680 <cons_init+0x34>
+    irq_setmask_8259A(irq_mask_8259A & ~(1<<4));
+f0100763:	83 ec 0c             	sub    $0xc,%esp
+f0100766:	0f b7 05 a8 53 11 f0 	movzwl 0xf01153a8,%eax
+f010076d:	25 ef ff 00 00       	and    $0xffef,%eax
+f0100772:	50                   	push   %eax
+f0100773:	e8 3c 3b 00 00       	call   f01042b4 <irq_setmask_8259A>
+  if (!serial_exists)
+f0100778:	83 c4 10             	add    $0x10,%esp
+f010077b:	80 3d 34 b2 79 f0 00 	cmpb   $0x0,0xf079b234
+f0100782:	74 b7                	je     f010073b <cons_init+0xef>
+}
+f0100784:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0100787:	5b                   	pop    %ebx
+f0100788:	5e                   	pop    %esi
+f0100789:	5f                   	pop    %edi
+f010078a:	5d                   	pop    %ebp
+f010078b:	c3                   	ret
+
+f010078c <cputchar>:
+
+// `High'-level console I/O.  Used by readline and cprintf.
+
+void
+cputchar(int c)
+{
+f010078c:	55                   	push   %ebp
+f010078d:	89 e5                	mov    %esp,%ebp
+f010078f:	83 ec 08             	sub    $0x8,%esp
+    c |= 0x7300;
+f0100792:	8b 45 08             	mov    0x8(%ebp),%eax
+f0100795:	80 cc 73             	or     $0x73,%ah
+
+  cons_putc(c);
+f0100798:	e8 43 fc ff ff       	call   f01003e0 <cons_putc>
+}
+f010079d:	c9                   	leave
+f010079e:	c3                   	ret
+
+f010079f <getchar>:
+
+int
+getchar(void)
+{
+f010079f:	55                   	push   %ebp
+f01007a0:	89 e5                	mov    %esp,%ebp
+f01007a2:	83 ec 08             	sub    $0x8,%esp
+  int c;
+
+  while ((c = cons_getc()) == 0)
+f01007a5:	e8 60 fe ff ff       	call   f010060a <cons_getc>
+f01007aa:	85 c0                	test   %eax,%eax
+f01007ac:	74 f7                	je     f01007a5 <getchar+0x6>
+    /* do nothing */;
+  return c;
+}
+f01007ae:	c9                   	leave
+f01007af:	c3                   	ret
+
+f01007b0 <iscons>:
+int
+iscons(int fdnum)
+{
+  // used by readline
+  return 1;
+}
+f01007b0:	b8 01 00 00 00       	mov    $0x1,%eax
+f01007b5:	c3                   	ret
+
+f01007b6 <mon_help>:
+
+/***** Implementations of basic kernel monitor commands *****/
+
+int
+mon_help(int argc, char **argv, struct Trapframe *tf)
+{
+f01007b6:	55                   	push   %ebp
+f01007b7:	89 e5                	mov    %esp,%ebp
+f01007b9:	56                   	push   %esi
+f01007ba:	53                   	push   %ebx
+  int i;
+
+  for (i = 0; i < NCOMMANDS; i++)
+f01007bb:	bb 80 8c 10 f0       	mov    $0xf0108c80,%ebx
+f01007c0:	be e0 8c 10 f0       	mov    $0xf0108ce0,%esi
+f01007c5:	eb 18                	jmp    f01007df <mon_help+0x29>
+    cprintf("%s - %s\n", commands[i].name, commands[i].desc);
+f01007c7:	83 ec 04             	sub    $0x4,%esp
+f01007ca:	ff 73 04             	push   0x4(%ebx)
+f01007cd:	ff 33                	push   (%ebx)
+f01007cf:	68 c0 85 10 f0       	push   $0xf01085c0
+f01007d4:	e8 53 3c 00 00       	call   f010442c <cprintf>
+  for (i = 0; i < NCOMMANDS; i++)
+f01007d9:	83 c3 0c             	add    $0xc,%ebx
+f01007dc:	83 c4 10             	add    $0x10,%esp
+f01007df:	39 f3                	cmp    %esi,%ebx
+f01007e1:	75 e4                	jne    f01007c7 <mon_help+0x11>
+  return 0;
+}
+f01007e3:	b8 00 00 00 00       	mov    $0x0,%eax
+f01007e8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f01007eb:	5b                   	pop    %ebx
+f01007ec:	5e                   	pop    %esi
+f01007ed:	5d                   	pop    %ebp
+f01007ee:	c3                   	ret
+
+f01007ef <mon_infokern>:
+
+int
+mon_infokern(int argc, char **argv, struct Trapframe *tf)
+{
+f01007ef:	55                   	push   %ebp
+f01007f0:	89 e5                	mov    %esp,%ebp
+f01007f2:	83 ec 14             	sub    $0x14,%esp
+  extern char _start[], entry[], etext[], edata[], end[];
+
+  cprintf("Special kernel symbols:\n");
+f01007f5:	68 c9 85 10 f0       	push   $0xf01085c9
+f01007fa:	e8 2d 3c 00 00       	call   f010442c <cprintf>
+  cprintf("  _start                  %08x (phys)\n", _start);
+f01007ff:	83 c4 08             	add    $0x8,%esp
+f0100802:	68 0c 00 10 00       	push   $0x10000c
+f0100807:	68 6c 87 10 f0       	push   $0xf010876c
+f010080c:	e8 1b 3c 00 00       	call   f010442c <cprintf>
+  cprintf("  entry  %08x (virt)  %08x (phys)\n", entry, entry - KERNBASE);
+f0100811:	83 c4 0c             	add    $0xc,%esp
+f0100814:	68 0c 00 10 00       	push   $0x10000c
+f0100819:	68 0c 00 10 f0       	push   $0xf010000c
+f010081e:	68 94 87 10 f0       	push   $0xf0108794
+f0100823:	e8 04 3c 00 00       	call   f010442c <cprintf>
+  cprintf("  etext  %08x (virt)  %08x (phys)\n", etext, etext - KERNBASE);
+f0100828:	83 c4 0c             	add    $0xc,%esp
+f010082b:	68 9e 82 10 00       	push   $0x10829e
+f0100830:	68 9e 82 10 f0       	push   $0xf010829e
+f0100835:	68 b8 87 10 f0       	push   $0xf01087b8
+f010083a:	e8 ed 3b 00 00       	call   f010442c <cprintf>
+  cprintf("  edata  %08x (virt)  %08x (phys)\n", edata, edata - KERNBASE);
+f010083f:	83 c4 0c             	add    $0xc,%esp
+f0100842:	68 50 a1 79 00       	push   $0x79a150
+f0100847:	68 50 a1 79 f0       	push   $0xf079a150
+f010084c:	68 dc 87 10 f0       	push   $0xf01087dc
+f0100851:	e8 d6 3b 00 00       	call   f010442c <cprintf>
+  cprintf("  end    %08x (virt)  %08x (phys)\n", end, end - KERNBASE);
+f0100856:	83 c4 0c             	add    $0xc,%esp
+f0100859:	68 08 d0 7d 00       	push   $0x7dd008
+f010085e:	68 08 d0 7d f0       	push   $0xf07dd008
+f0100863:	68 00 88 10 f0       	push   $0xf0108800
+f0100868:	e8 bf 3b 00 00       	call   f010442c <cprintf>
+  cprintf("Kernel executable memory footprint: %dKB\n",
+f010086d:	83 c4 08             	add    $0x8,%esp
+          ROUNDUP(end - entry, 1024) / 1024);
+f0100870:	b8 08 d0 7d f0       	mov    $0xf07dd008,%eax
+f0100875:	2d 0d fc 0f f0       	sub    $0xf00ffc0d,%eax
+  cprintf("Kernel executable memory footprint: %dKB\n",
+f010087a:	c1 f8 0a             	sar    $0xa,%eax
+f010087d:	50                   	push   %eax
+f010087e:	68 24 88 10 f0       	push   $0xf0108824
+f0100883:	e8 a4 3b 00 00       	call   f010442c <cprintf>
+  return 0;
+}
+f0100888:	b8 00 00 00 00       	mov    $0x0,%eax
+f010088d:	c9                   	leave
+f010088e:	c3                   	ret
+
+f010088f <mon_backtrace>:
+
+
+int
+mon_backtrace(int argc, char **argv, struct Trapframe *tf)
+{
+f010088f:	55                   	push   %ebp
+f0100890:	89 e5                	mov    %esp,%ebp
+f0100892:	57                   	push   %edi
+f0100893:	56                   	push   %esi
+f0100894:	53                   	push   %ebx
+f0100895:	83 ec 38             	sub    $0x38,%esp
+    // Your code here.
+    cprintf("Stack Trace:\n");
+f0100898:	68 e2 85 10 f0       	push   $0xf01085e2
+f010089d:	e8 8a 3b 00 00       	call   f010442c <cprintf>
+  __asm __volatile("movl %%ebp,%0" : "=r" (ebp));
+f01008a2:	89 eb                	mov    %ebp,%ebx
+
+    uint32_t *parameters, *frame_pointer = (uint32_t *) read_ebp();
+    uintptr_t eip;
+    struct Eipdebuginfo eip_info;
+
+    while (frame_pointer) {
+f01008a4:	83 c4 10             	add    $0x10,%esp
+        parameters = frame_pointer + 2;
+        eip = (uintptr_t) *(frame_pointer + 1);
+
+        debuginfo_eip(eip, &eip_info);
+f01008a7:	8d 7d d0             	lea    -0x30(%ebp),%edi
+    while (frame_pointer) {
+f01008aa:	eb 4a                	jmp    f01008f6 <mon_backtrace+0x67>
+        eip = (uintptr_t) *(frame_pointer + 1);
+f01008ac:	8b 73 04             	mov    0x4(%ebx),%esi
+        debuginfo_eip(eip, &eip_info);
+f01008af:	83 ec 08             	sub    $0x8,%esp
+f01008b2:	57                   	push   %edi
+f01008b3:	56                   	push   %esi
+f01008b4:	e8 92 62 00 00       	call   f0106b4b <debuginfo_eip>
+
+        cprintf("  ebp %x eip %x args %08x %08x %08x %08x %08x\n",
+f01008b9:	ff 73 18             	push   0x18(%ebx)
+f01008bc:	ff 73 14             	push   0x14(%ebx)
+f01008bf:	ff 73 10             	push   0x10(%ebx)
+f01008c2:	ff 73 0c             	push   0xc(%ebx)
+f01008c5:	ff 73 08             	push   0x8(%ebx)
+f01008c8:	56                   	push   %esi
+f01008c9:	53                   	push   %ebx
+f01008ca:	68 50 88 10 f0       	push   $0xf0108850
+f01008cf:	e8 58 3b 00 00       	call   f010442c <cprintf>
+                *(parameters + 1),
+                *(parameters + 2),
+                *(parameters + 3),
+                *(parameters + 4));
+
+        cprintf("\t%s:%d: %.*s+%d\n",
+f01008d4:	83 c4 28             	add    $0x28,%esp
+f01008d7:	2b 75 e0             	sub    -0x20(%ebp),%esi
+f01008da:	56                   	push   %esi
+f01008db:	ff 75 d8             	push   -0x28(%ebp)
+f01008de:	ff 75 dc             	push   -0x24(%ebp)
+f01008e1:	ff 75 d4             	push   -0x2c(%ebp)
+f01008e4:	ff 75 d0             	push   -0x30(%ebp)
+f01008e7:	68 f0 85 10 f0       	push   $0xf01085f0
+f01008ec:	e8 3b 3b 00 00       	call   f010442c <cprintf>
+                eip_info.eip_line,
+                eip_info.eip_fn_namelen,
+                eip_info.eip_fn_name,
+                -eip_info.eip_fn_addr + eip);
+
+        frame_pointer = (uint32_t *) *frame_pointer;
+f01008f1:	8b 1b                	mov    (%ebx),%ebx
+f01008f3:	83 c4 20             	add    $0x20,%esp
+    while (frame_pointer) {
+f01008f6:	85 db                	test   %ebx,%ebx
+f01008f8:	75 b2                	jne    f01008ac <mon_backtrace+0x1d>
+    }
+
+  return 0;
+}
+f01008fa:	b8 00 00 00 00       	mov    $0x0,%eax
+f01008ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0100902:	5b                   	pop    %ebx
+f0100903:	5e                   	pop    %esi
+f0100904:	5f                   	pop    %edi
+f0100905:	5d                   	pop    %ebp
+f0100906:	c3                   	ret
+
+f0100907 <mon_showmapping>:
+
+int
+mon_showmapping(int argc, char **argv, struct Trapframe *tf)
+{
+f0100907:	55                   	push   %ebp
+f0100908:	89 e5                	mov    %esp,%ebp
+f010090a:	56                   	push   %esi
+f010090b:	53                   	push   %ebx
+f010090c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (argc < 3) {
+f010090f:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+f0100913:	7e 50                	jle    f0100965 <mon_showmapping+0x5e>
+    return 0;
+  }
+
+  char *start, *end, *cur;
+
+  start = (char *) ROUNDDOWN(strtol(argv[1], NULL, 16), PGSIZE);
+f0100915:	83 ec 04             	sub    $0x4,%esp
+f0100918:	6a 10                	push   $0x10
+f010091a:	6a 00                	push   $0x0
+f010091c:	ff 76 04             	push   0x4(%esi)
+f010091f:	e8 5b 6e 00 00       	call   f010777f <strtol>
+f0100924:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f0100929:	89 c3                	mov    %eax,%ebx
+  end = (char *) ROUNDDOWN(strtol(argv[2], NULL, 16), PGSIZE);
+f010092b:	83 c4 0c             	add    $0xc,%esp
+f010092e:	6a 10                	push   $0x10
+f0100930:	6a 00                	push   $0x0
+f0100932:	ff 76 08             	push   0x8(%esi)
+f0100935:	e8 45 6e 00 00       	call   f010777f <strtol>
+f010093a:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f010093f:	89 c6                	mov    %eax,%esi
+
+  if ((uintptr_t) start < KERNBASE || (uintptr_t) end < KERNBASE) {
+f0100941:	83 c4 10             	add    $0x10,%esp
+f0100944:	81 fb ff ff ff ef    	cmp    $0xefffffff,%ebx
+f010094a:	76 35                	jbe    f0100981 <mon_showmapping+0x7a>
+f010094c:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0100951:	76 2e                	jbe    f0100981 <mon_showmapping+0x7a>
+    cprintf("Valid virtual addresses are required\n");
+    return 0;
+  }
+
+  cprintf("va \t\t pa \t\t perm\n");
+f0100953:	83 ec 0c             	sub    $0xc,%esp
+f0100956:	68 01 86 10 f0       	push   $0xf0108601
+f010095b:	e8 cc 3a 00 00       	call   f010442c <cprintf>
+
+  for (cur = start; cur <= end; cur += PGSIZE) {
+f0100960:	83 c4 10             	add    $0x10,%esp
+f0100963:	eb 34                	jmp    f0100999 <mon_showmapping+0x92>
+    cprintf("Usage: showmapping [start address] [end address]\n");
+f0100965:	83 ec 0c             	sub    $0xc,%esp
+f0100968:	68 80 88 10 f0       	push   $0xf0108880
+f010096d:	e8 ba 3a 00 00       	call   f010442c <cprintf>
+    return 0;
+f0100972:	83 c4 10             	add    $0x10,%esp
+      cprintf("%08p \t %08p \t %08p\n", cur, page_entry, PGOFF(page_entry));
+    }
+  }
+
+  return 0;
+}
+f0100975:	b8 00 00 00 00       	mov    $0x0,%eax
+f010097a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f010097d:	5b                   	pop    %ebx
+f010097e:	5e                   	pop    %esi
+f010097f:	5d                   	pop    %ebp
+f0100980:	c3                   	ret
+    cprintf("Valid virtual addresses are required\n");
+f0100981:	83 ec 0c             	sub    $0xc,%esp
+f0100984:	68 b4 88 10 f0       	push   $0xf01088b4
+f0100989:	e8 9e 3a 00 00       	call   f010442c <cprintf>
+    return 0;
+f010098e:	83 c4 10             	add    $0x10,%esp
+f0100991:	eb e2                	jmp    f0100975 <mon_showmapping+0x6e>
+  for (cur = start; cur <= end; cur += PGSIZE) {
+f0100993:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f0100999:	39 de                	cmp    %ebx,%esi
+f010099b:	72 d8                	jb     f0100975 <mon_showmapping+0x6e>
+    pte_t *page_entry = pgdir_walk(kern_pgdir, cur, 0);
+f010099d:	83 ec 04             	sub    $0x4,%esp
+f01009a0:	6a 00                	push   $0x0
+f01009a2:	53                   	push   %ebx
+f01009a3:	ff 35 0c bf 79 f0    	push   0xf079bf0c
+f01009a9:	e8 0c 0d 00 00       	call   f01016ba <pgdir_walk>
+    if (*page_entry & PTE_P) {
+f01009ae:	83 c4 10             	add    $0x10,%esp
+f01009b1:	f6 00 01             	testb  $0x1,(%eax)
+f01009b4:	74 dd                	je     f0100993 <mon_showmapping+0x8c>
+      cprintf("%08p \t %08p \t %08p\n", cur, page_entry, PGOFF(page_entry));
+f01009b6:	89 c2                	mov    %eax,%edx
+f01009b8:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+f01009be:	52                   	push   %edx
+f01009bf:	50                   	push   %eax
+f01009c0:	53                   	push   %ebx
+f01009c1:	68 13 86 10 f0       	push   $0xf0108613
+f01009c6:	e8 61 3a 00 00       	call   f010442c <cprintf>
+f01009cb:	83 c4 10             	add    $0x10,%esp
+f01009ce:	eb c3                	jmp    f0100993 <mon_showmapping+0x8c>
+
+f01009d0 <mon_perm>:
+
+int
+mon_perm(int argc, char **argv, struct Trapframe *tf)
+{
+f01009d0:	55                   	push   %ebp
+f01009d1:	89 e5                	mov    %esp,%ebp
+f01009d3:	57                   	push   %edi
+f01009d4:	56                   	push   %esi
+f01009d5:	53                   	push   %ebx
+f01009d6:	83 ec 1c             	sub    $0x1c,%esp
+f01009d9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (argc < 3) {
+f01009dc:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+f01009e0:	7e 4c                	jle    f0100a2e <mon_perm+0x5e>
+
+  char *command, *addr;
+  pte_t *pagetable_entry;
+  int perm, i, j;
+
+  command = argv[2];
+f01009e2:	8b 5e 08             	mov    0x8(%esi),%ebx
+  addr = (char *) strtol(argv[1], NULL, 16);
+f01009e5:	83 ec 04             	sub    $0x4,%esp
+f01009e8:	6a 10                	push   $0x10
+f01009ea:	6a 00                	push   $0x0
+f01009ec:	ff 76 04             	push   0x4(%esi)
+f01009ef:	e8 8b 6d 00 00       	call   f010777f <strtol>
+  perm = PTE_P;
+
+  if ((uintptr_t) addr < KERNBASE) {
+f01009f4:	83 c4 10             	add    $0x10,%esp
+f01009f7:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f01009fc:	76 4d                	jbe    f0100a4b <mon_perm+0x7b>
+    cprintf("Valid virtual addresses are required\n");
+    return 0;
+  }
+
+  switch (*command) {
+f01009fe:	0f b6 13             	movzbl (%ebx),%edx
+f0100a01:	80 fa 72             	cmp    $0x72,%dl
+f0100a04:	0f 84 f4 00 00 00    	je     f0100afe <mon_perm+0x12e>
+f0100a0a:	80 fa 73             	cmp    $0x73,%dl
+f0100a0d:	75 2f                	jne    f0100a3e <mon_perm+0x6e>
+    case 's':
+      if (argc < 4) {
+f0100a0f:	83 7d 08 03          	cmpl   $0x3,0x8(%ebp)
+f0100a13:	7e 48                	jle    f0100a5d <mon_perm+0x8d>
+f0100a15:	83 c6 0c             	add    $0xc,%esi
+        cprintf("Need to specify what permissions to use\n");
+        return 0;
+      }
+
+      for (i = 3; i < argc; i++)
+f0100a18:	ba 03 00 00 00       	mov    $0x3,%edx
+  perm = PTE_P;
+f0100a1d:	c7 45 e4 01 00 00 00 	movl   $0x1,-0x1c(%ebp)
+f0100a24:	bf 8c 8c 10 f0       	mov    $0xf0108c8c,%edi
+f0100a29:	89 45 dc             	mov    %eax,-0x24(%ebp)
+f0100a2c:	eb 71                	jmp    f0100a9f <mon_perm+0xcf>
+    cprintf("Usage: perm [virtual address] [ s [perm] | r ]\n");
+f0100a2e:	83 ec 0c             	sub    $0xc,%esp
+f0100a31:	68 dc 88 10 f0       	push   $0xf01088dc
+f0100a36:	e8 f1 39 00 00       	call   f010442c <cprintf>
+    return 0;
+f0100a3b:	83 c4 10             	add    $0x10,%esp
+      }
+      break;
+  }
+
+  return 0;
+}
+f0100a3e:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100a43:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0100a46:	5b                   	pop    %ebx
+f0100a47:	5e                   	pop    %esi
+f0100a48:	5f                   	pop    %edi
+f0100a49:	5d                   	pop    %ebp
+f0100a4a:	c3                   	ret
+    cprintf("Valid virtual addresses are required\n");
+f0100a4b:	83 ec 0c             	sub    $0xc,%esp
+f0100a4e:	68 b4 88 10 f0       	push   $0xf01088b4
+f0100a53:	e8 d4 39 00 00       	call   f010442c <cprintf>
+    return 0;
+f0100a58:	83 c4 10             	add    $0x10,%esp
+f0100a5b:	eb e1                	jmp    f0100a3e <mon_perm+0x6e>
+        cprintf("Need to specify what permissions to use\n");
+f0100a5d:	83 ec 0c             	sub    $0xc,%esp
+f0100a60:	68 0c 89 10 f0       	push   $0xf010890c
+f0100a65:	e8 c2 39 00 00       	call   f010442c <cprintf>
+        return 0;
+f0100a6a:	83 c4 10             	add    $0x10,%esp
+f0100a6d:	eb cf                	jmp    f0100a3e <mon_perm+0x6e>
+        for (j = 0; j < PGFLAG; j++)
+f0100a6f:	83 c3 0c             	add    $0xc,%ebx
+f0100a72:	39 fb                	cmp    %edi,%ebx
+f0100a74:	74 1b                	je     f0100a91 <mon_perm+0xc1>
+          if (!strcmp(permissions[j].name, argv[i]))
+f0100a76:	83 ec 08             	sub    $0x8,%esp
+f0100a79:	ff 36                	push   (%esi)
+f0100a7b:	ff 33                	push   (%ebx)
+f0100a7d:	e8 5a 6b 00 00       	call   f01075dc <strcmp>
+f0100a82:	83 c4 10             	add    $0x10,%esp
+f0100a85:	85 c0                	test   %eax,%eax
+f0100a87:	75 e6                	jne    f0100a6f <mon_perm+0x9f>
+            perm |= permissions[j].value;
+f0100a89:	8b 4b 08             	mov    0x8(%ebx),%ecx
+f0100a8c:	09 4d e4             	or     %ecx,-0x1c(%ebp)
+f0100a8f:	eb de                	jmp    f0100a6f <mon_perm+0x9f>
+      for (i = 3; i < argc; i++)
+f0100a91:	8b 55 e0             	mov    -0x20(%ebp),%edx
+f0100a94:	83 c2 01             	add    $0x1,%edx
+f0100a97:	83 c6 04             	add    $0x4,%esi
+f0100a9a:	39 55 08             	cmp    %edx,0x8(%ebp)
+f0100a9d:	74 0a                	je     f0100aa9 <mon_perm+0xd9>
+f0100a9f:	bb 20 8c 10 f0       	mov    $0xf0108c20,%ebx
+f0100aa4:	89 55 e0             	mov    %edx,-0x20(%ebp)
+f0100aa7:	eb c9                	jmp    f0100a72 <mon_perm+0xa2>
+      if ( (pagetable_entry = pgdir_walk(kern_pgdir, addr, 0)) ) {
+f0100aa9:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f0100aac:	83 ec 04             	sub    $0x4,%esp
+f0100aaf:	6a 00                	push   $0x0
+f0100ab1:	50                   	push   %eax
+f0100ab2:	ff 35 0c bf 79 f0    	push   0xf079bf0c
+f0100ab8:	e8 fd 0b 00 00       	call   f01016ba <pgdir_walk>
+f0100abd:	83 c4 10             	add    $0x10,%esp
+f0100ac0:	85 c0                	test   %eax,%eax
+f0100ac2:	74 25                	je     f0100ae9 <mon_perm+0x119>
+        *pagetable_entry = PTE_ADDR(*pagetable_entry) | perm;
+f0100ac4:	8b 10                	mov    (%eax),%edx
+f0100ac6:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+f0100acc:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+f0100acf:	09 ca                	or     %ecx,%edx
+f0100ad1:	89 10                	mov    %edx,(%eax)
+        cprintf("Permissions successfully changed to %p\n", perm);
+f0100ad3:	83 ec 08             	sub    $0x8,%esp
+f0100ad6:	51                   	push   %ecx
+f0100ad7:	68 38 89 10 f0       	push   $0xf0108938
+f0100adc:	e8 4b 39 00 00       	call   f010442c <cprintf>
+f0100ae1:	83 c4 10             	add    $0x10,%esp
+f0100ae4:	e9 55 ff ff ff       	jmp    f0100a3e <mon_perm+0x6e>
+        cprintf("Page not mapped, could not change permissions\n");
+f0100ae9:	83 ec 0c             	sub    $0xc,%esp
+f0100aec:	68 60 89 10 f0       	push   $0xf0108960
+f0100af1:	e8 36 39 00 00       	call   f010442c <cprintf>
+f0100af6:	83 c4 10             	add    $0x10,%esp
+f0100af9:	e9 40 ff ff ff       	jmp    f0100a3e <mon_perm+0x6e>
+      if ( (pagetable_entry = pgdir_walk(kern_pgdir, addr, 0)) ) {
+f0100afe:	83 ec 04             	sub    $0x4,%esp
+f0100b01:	6a 00                	push   $0x0
+f0100b03:	50                   	push   %eax
+f0100b04:	ff 35 0c bf 79 f0    	push   0xf079bf0c
+f0100b0a:	e8 ab 0b 00 00       	call   f01016ba <pgdir_walk>
+f0100b0f:	83 c4 10             	add    $0x10,%esp
+f0100b12:	85 c0                	test   %eax,%eax
+f0100b14:	74 22                	je     f0100b38 <mon_perm+0x168>
+        *pagetable_entry = PTE_ADDR(*pagetable_entry) | perm;
+f0100b16:	8b 10                	mov    (%eax),%edx
+f0100b18:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+f0100b1e:	83 ca 01             	or     $0x1,%edx
+f0100b21:	89 10                	mov    %edx,(%eax)
+        cprintf("Permissions successfully removed\n");
+f0100b23:	83 ec 0c             	sub    $0xc,%esp
+f0100b26:	68 90 89 10 f0       	push   $0xf0108990
+f0100b2b:	e8 fc 38 00 00       	call   f010442c <cprintf>
+f0100b30:	83 c4 10             	add    $0x10,%esp
+f0100b33:	e9 06 ff ff ff       	jmp    f0100a3e <mon_perm+0x6e>
+        cprintf("Page not mapped, could not change permissions\n");
+f0100b38:	83 ec 0c             	sub    $0xc,%esp
+f0100b3b:	68 60 89 10 f0       	push   $0xf0108960
+f0100b40:	e8 e7 38 00 00       	call   f010442c <cprintf>
+f0100b45:	83 c4 10             	add    $0x10,%esp
+f0100b48:	e9 f1 fe ff ff       	jmp    f0100a3e <mon_perm+0x6e>
+
+f0100b4d <mon_step>:
+  return 0;
+}
+
+int
+mon_step(int argc, char **argv, struct Trapframe *tf)
+{
+f0100b4d:	55                   	push   %ebp
+f0100b4e:	89 e5                	mov    %esp,%ebp
+f0100b50:	83 ec 08             	sub    $0x8,%esp
+f0100b53:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (tf) {
+f0100b56:	85 c0                	test   %eax,%eax
+f0100b58:	75 14                	jne    f0100b6e <mon_step+0x21>
+    tf->tf_eflags = tf->tf_eflags | (1 << 8);
+    env_pop_tf(tf);
+  } else {
+    cprintf("Invalid step: did not come from a user environment\n");
+f0100b5a:	83 ec 0c             	sub    $0xc,%esp
+f0100b5d:	68 b4 89 10 f0       	push   $0xf01089b4
+f0100b62:	e8 c5 38 00 00       	call   f010442c <cprintf>
+  }
+
+  return 0;
+}
+f0100b67:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100b6c:	c9                   	leave
+f0100b6d:	c3                   	ret
+    tf->tf_eflags = tf->tf_eflags | (1 << 8);
+f0100b6e:	81 48 38 00 01 00 00 	orl    $0x100,0x38(%eax)
+    env_pop_tf(tf);
+f0100b75:	83 ec 0c             	sub    $0xc,%esp
+f0100b78:	50                   	push   %eax
+f0100b79:	e8 aa 35 00 00       	call   f0104128 <env_pop_tf>
+
+f0100b7e <mon_continue>:
+
+int
+mon_continue(int argc, char **argv, struct Trapframe *tf)
+{
+f0100b7e:	55                   	push   %ebp
+f0100b7f:	89 e5                	mov    %esp,%ebp
+f0100b81:	83 ec 08             	sub    $0x8,%esp
+f0100b84:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (tf) {
+f0100b87:	85 c0                	test   %eax,%eax
+f0100b89:	75 14                	jne    f0100b9f <mon_continue+0x21>
+    tf->tf_eflags = tf->tf_eflags & ~(1 << 8);
+    env_pop_tf(tf);
+  } else {
+    cprintf("Error: no currently running environment\n");
+f0100b8b:	83 ec 0c             	sub    $0xc,%esp
+f0100b8e:	68 e8 89 10 f0       	push   $0xf01089e8
+f0100b93:	e8 94 38 00 00       	call   f010442c <cprintf>
+  }
+  return 0;
+}
+f0100b98:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100b9d:	c9                   	leave
+f0100b9e:	c3                   	ret
+    tf->tf_eflags = tf->tf_eflags & ~(1 << 8);
+f0100b9f:	81 60 38 ff fe ff ff 	andl   $0xfffffeff,0x38(%eax)
+    env_pop_tf(tf);
+f0100ba6:	83 ec 0c             	sub    $0xc,%esp
+f0100ba9:	50                   	push   %eax
+f0100baa:	e8 79 35 00 00       	call   f0104128 <env_pop_tf>
+
+f0100baf <mon_dump>:
+{
+f0100baf:	55                   	push   %ebp
+f0100bb0:	89 e5                	mov    %esp,%ebp
+f0100bb2:	57                   	push   %edi
+f0100bb3:	56                   	push   %esi
+f0100bb4:	53                   	push   %ebx
+f0100bb5:	83 ec 0c             	sub    $0xc,%esp
+f0100bb8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (argc < 3) {
+f0100bbb:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+f0100bbf:	7e 54                	jle    f0100c15 <mon_dump+0x66>
+  start = (char *) strtol(argv[1], NULL, 16);
+f0100bc1:	83 ec 04             	sub    $0x4,%esp
+f0100bc4:	6a 10                	push   $0x10
+f0100bc6:	6a 00                	push   $0x0
+f0100bc8:	ff 76 04             	push   0x4(%esi)
+f0100bcb:	e8 af 6b 00 00       	call   f010777f <strtol>
+f0100bd0:	89 c3                	mov    %eax,%ebx
+  end = (char *) strtol(argv[2], NULL, 16);
+f0100bd2:	83 c4 0c             	add    $0xc,%esp
+f0100bd5:	6a 10                	push   $0x10
+f0100bd7:	6a 00                	push   $0x0
+f0100bd9:	ff 76 08             	push   0x8(%esi)
+f0100bdc:	e8 9e 6b 00 00       	call   f010777f <strtol>
+f0100be1:	89 c6                	mov    %eax,%esi
+  if ((uintptr_t) start < KERNBASE && (uintptr_t) end < KERNBASE) {
+f0100be3:	83 c4 10             	add    $0x10,%esp
+f0100be6:	81 fb ff ff ff ef    	cmp    $0xefffffff,%ebx
+f0100bec:	77 07                	ja     f0100bf5 <mon_dump+0x46>
+f0100bee:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0100bf3:	76 3d                	jbe    f0100c32 <mon_dump+0x83>
+  phys = 0;
+f0100bf5:	bf 00 00 00 00       	mov    $0x0,%edi
+  cprintf("%s Address\t\tValue\n", (phys) ? "Physical" : "Virtual");
+f0100bfa:	b8 30 86 10 f0       	mov    $0xf0108630,%eax
+f0100bff:	83 ec 08             	sub    $0x8,%esp
+f0100c02:	50                   	push   %eax
+f0100c03:	68 47 86 10 f0       	push   $0xf0108647
+f0100c08:	e8 1f 38 00 00       	call   f010442c <cprintf>
+  for ( ; start < end; start++) {
+f0100c0d:	83 c4 10             	add    $0x10,%esp
+f0100c10:	e9 a2 00 00 00       	jmp    f0100cb7 <mon_dump+0x108>
+    cprintf("Usage: dump [start address] [end address]\n");
+f0100c15:	83 ec 0c             	sub    $0xc,%esp
+f0100c18:	68 14 8a 10 f0       	push   $0xf0108a14
+f0100c1d:	e8 0a 38 00 00       	call   f010442c <cprintf>
+    return 0;
+f0100c22:	83 c4 10             	add    $0x10,%esp
+}
+f0100c25:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100c2a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0100c2d:	5b                   	pop    %ebx
+f0100c2e:	5e                   	pop    %esi
+f0100c2f:	5f                   	pop    %edi
+f0100c30:	5d                   	pop    %ebp
+f0100c31:	c3                   	ret
+	if (PGNUM(pa) >= npages)
+f0100c32:	a1 08 bf 79 f0       	mov    0xf079bf08,%eax
+f0100c37:	89 da                	mov    %ebx,%edx
+f0100c39:	c1 ea 0c             	shr    $0xc,%edx
+f0100c3c:	39 c2                	cmp    %eax,%edx
+f0100c3e:	73 21                	jae    f0100c61 <mon_dump+0xb2>
+	return (void *)(pa + KERNBASE);
+f0100c40:	81 eb 00 00 00 10    	sub    $0x10000000,%ebx
+	if (PGNUM(pa) >= npages)
+f0100c46:	89 f2                	mov    %esi,%edx
+f0100c48:	c1 ea 0c             	shr    $0xc,%edx
+f0100c4b:	39 c2                	cmp    %eax,%edx
+f0100c4d:	73 27                	jae    f0100c76 <mon_dump+0xc7>
+	return (void *)(pa + KERNBASE);
+f0100c4f:	81 ee 00 00 00 10    	sub    $0x10000000,%esi
+    phys = 1;
+f0100c55:	bf 01 00 00 00       	mov    $0x1,%edi
+  cprintf("%s Address\t\tValue\n", (phys) ? "Physical" : "Virtual");
+f0100c5a:	b8 27 86 10 f0       	mov    $0xf0108627,%eax
+f0100c5f:	eb 9e                	jmp    f0100bff <mon_dump+0x50>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0100c61:	53                   	push   %ebx
+f0100c62:	68 c4 82 10 f0       	push   $0xf01082c4
+f0100c67:	68 f6 00 00 00       	push   $0xf6
+f0100c6c:	68 38 86 10 f0       	push   $0xf0108638
+f0100c71:	e8 ca f3 ff ff       	call   f0100040 <_panic>
+f0100c76:	56                   	push   %esi
+f0100c77:	68 c4 82 10 f0       	push   $0xf01082c4
+f0100c7c:	68 f7 00 00 00       	push   $0xf7
+f0100c81:	68 38 86 10 f0       	push   $0xf0108638
+f0100c86:	e8 b5 f3 ff ff       	call   f0100040 <_panic>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0100c8b:	53                   	push   %ebx
+f0100c8c:	68 e8 82 10 f0       	push   $0xf01082e8
+f0100c91:	68 fd 00 00 00       	push   $0xfd
+f0100c96:	68 38 86 10 f0       	push   $0xf0108638
+f0100c9b:	e8 a0 f3 ff ff       	call   f0100040 <_panic>
+f0100ca0:	89 da                	mov    %ebx,%edx
+    cprintf("%p: \t\t\t%p\n", (phys) ? PADDR(start) : (uintptr_t) start, *start);
+f0100ca2:	83 ec 04             	sub    $0x4,%esp
+f0100ca5:	50                   	push   %eax
+f0100ca6:	52                   	push   %edx
+f0100ca7:	68 5a 86 10 f0       	push   $0xf010865a
+f0100cac:	e8 7b 37 00 00       	call   f010442c <cprintf>
+  for ( ; start < end; start++) {
+f0100cb1:	83 c3 01             	add    $0x1,%ebx
+f0100cb4:	83 c4 10             	add    $0x10,%esp
+f0100cb7:	39 f3                	cmp    %esi,%ebx
+f0100cb9:	0f 83 66 ff ff ff    	jae    f0100c25 <mon_dump+0x76>
+    cprintf("%p: \t\t\t%p\n", (phys) ? PADDR(start) : (uintptr_t) start, *start);
+f0100cbf:	0f be 03             	movsbl (%ebx),%eax
+f0100cc2:	89 f9                	mov    %edi,%ecx
+f0100cc4:	84 c9                	test   %cl,%cl
+f0100cc6:	74 d8                	je     f0100ca0 <mon_dump+0xf1>
+	if ((uint32_t)kva < KERNBASE)
+f0100cc8:	81 fb ff ff ff ef    	cmp    $0xefffffff,%ebx
+f0100cce:	76 bb                	jbe    f0100c8b <mon_dump+0xdc>
+	return (physaddr_t)kva - KERNBASE;
+f0100cd0:	8d 93 00 00 00 10    	lea    0x10000000(%ebx),%edx
+f0100cd6:	eb ca                	jmp    f0100ca2 <mon_dump+0xf3>
+
+f0100cd8 <monitor>:
+  return 0;
+}
+
+void
+monitor(struct Trapframe *tf)
+{
+f0100cd8:	55                   	push   %ebp
+f0100cd9:	89 e5                	mov    %esp,%ebp
+f0100cdb:	57                   	push   %edi
+f0100cdc:	56                   	push   %esi
+f0100cdd:	53                   	push   %ebx
+f0100cde:	83 ec 58             	sub    $0x58,%esp
+  char *buf;
+
+  cprintf("Welcome to the JOS kernel monitor!\n");
+f0100ce1:	68 40 8a 10 f0       	push   $0xf0108a40
+f0100ce6:	e8 41 37 00 00       	call   f010442c <cprintf>
+  cprintf("Type 'help' for a list of commands.\n");
+f0100ceb:	c7 04 24 64 8a 10 f0 	movl   $0xf0108a64,(%esp)
+f0100cf2:	e8 35 37 00 00       	call   f010442c <cprintf>
+
+  if (tf != NULL)
+f0100cf7:	83 c4 10             	add    $0x10,%esp
+f0100cfa:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+f0100cfe:	74 57                	je     f0100d57 <monitor+0x7f>
+    print_trapframe(tf);
+f0100d00:	83 ec 0c             	sub    $0xc,%esp
+f0100d03:	ff 75 08             	push   0x8(%ebp)
+f0100d06:	e8 81 3e 00 00       	call   f0104b8c <print_trapframe>
+f0100d0b:	83 c4 10             	add    $0x10,%esp
+f0100d0e:	eb 47                	jmp    f0100d57 <monitor+0x7f>
+    while (*buf && strchr(WHITESPACE, *buf))
+f0100d10:	83 ec 08             	sub    $0x8,%esp
+f0100d13:	0f be c0             	movsbl %al,%eax
+f0100d16:	50                   	push   %eax
+f0100d17:	68 69 86 10 f0       	push   $0xf0108669
+f0100d1c:	e8 1c 69 00 00       	call   f010763d <strchr>
+f0100d21:	83 c4 10             	add    $0x10,%esp
+f0100d24:	85 c0                	test   %eax,%eax
+f0100d26:	74 0a                	je     f0100d32 <monitor+0x5a>
+      *buf++ = 0;
+f0100d28:	c6 03 00             	movb   $0x0,(%ebx)
+f0100d2b:	89 f7                	mov    %esi,%edi
+f0100d2d:	8d 5b 01             	lea    0x1(%ebx),%ebx
+f0100d30:	eb 6b                	jmp    f0100d9d <monitor+0xc5>
+    if (*buf == 0)
+f0100d32:	80 3b 00             	cmpb   $0x0,(%ebx)
+f0100d35:	74 73                	je     f0100daa <monitor+0xd2>
+    if (argc == MAXARGS-1) {
+f0100d37:	83 fe 0f             	cmp    $0xf,%esi
+f0100d3a:	74 09                	je     f0100d45 <monitor+0x6d>
+    argv[argc++] = buf;
+f0100d3c:	8d 7e 01             	lea    0x1(%esi),%edi
+f0100d3f:	89 5c b5 a8          	mov    %ebx,-0x58(%ebp,%esi,4)
+    while (*buf && !strchr(WHITESPACE, *buf))
+f0100d43:	eb 39                	jmp    f0100d7e <monitor+0xa6>
+      cprintf("Too many arguments (max %d)\n", MAXARGS);
+f0100d45:	83 ec 08             	sub    $0x8,%esp
+f0100d48:	6a 10                	push   $0x10
+f0100d4a:	68 6e 86 10 f0       	push   $0xf010866e
+f0100d4f:	e8 d8 36 00 00       	call   f010442c <cprintf>
+      return 0;
+f0100d54:	83 c4 10             	add    $0x10,%esp
+
+  while (1) {
+    buf = readline("K> ");
+f0100d57:	83 ec 0c             	sub    $0xc,%esp
+f0100d5a:	68 65 86 10 f0       	push   $0xf0108665
+f0100d5f:	e8 9e 66 00 00       	call   f0107402 <readline>
+f0100d64:	89 c3                	mov    %eax,%ebx
+    if (buf != NULL)
+f0100d66:	83 c4 10             	add    $0x10,%esp
+f0100d69:	85 c0                	test   %eax,%eax
+f0100d6b:	74 ea                	je     f0100d57 <monitor+0x7f>
+  argv[argc] = 0;
+f0100d6d:	c7 45 a8 00 00 00 00 	movl   $0x0,-0x58(%ebp)
+  argc = 0;
+f0100d74:	be 00 00 00 00       	mov    $0x0,%esi
+f0100d79:	eb 24                	jmp    f0100d9f <monitor+0xc7>
+      buf++;
+f0100d7b:	83 c3 01             	add    $0x1,%ebx
+    while (*buf && !strchr(WHITESPACE, *buf))
+f0100d7e:	0f b6 03             	movzbl (%ebx),%eax
+f0100d81:	84 c0                	test   %al,%al
+f0100d83:	74 18                	je     f0100d9d <monitor+0xc5>
+f0100d85:	83 ec 08             	sub    $0x8,%esp
+f0100d88:	0f be c0             	movsbl %al,%eax
+f0100d8b:	50                   	push   %eax
+f0100d8c:	68 69 86 10 f0       	push   $0xf0108669
+f0100d91:	e8 a7 68 00 00       	call   f010763d <strchr>
+f0100d96:	83 c4 10             	add    $0x10,%esp
+f0100d99:	85 c0                	test   %eax,%eax
+f0100d9b:	74 de                	je     f0100d7b <monitor+0xa3>
+      *buf++ = 0;
+f0100d9d:	89 fe                	mov    %edi,%esi
+    while (*buf && strchr(WHITESPACE, *buf))
+f0100d9f:	0f b6 03             	movzbl (%ebx),%eax
+f0100da2:	84 c0                	test   %al,%al
+f0100da4:	0f 85 66 ff ff ff    	jne    f0100d10 <monitor+0x38>
+  argv[argc] = 0;
+f0100daa:	c7 44 b5 a8 00 00 00 	movl   $0x0,-0x58(%ebp,%esi,4)
+f0100db1:	00 
+  if (argc == 0)
+f0100db2:	85 f6                	test   %esi,%esi
+f0100db4:	74 a1                	je     f0100d57 <monitor+0x7f>
+  for (i = 0; i < NCOMMANDS; i++)
+f0100db6:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (strcmp(argv[0], commands[i].name) == 0)
+f0100dbb:	83 ec 08             	sub    $0x8,%esp
+f0100dbe:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+f0100dc1:	ff 34 85 80 8c 10 f0 	push   -0xfef7380(,%eax,4)
+f0100dc8:	ff 75 a8             	push   -0x58(%ebp)
+f0100dcb:	e8 0c 68 00 00       	call   f01075dc <strcmp>
+f0100dd0:	83 c4 10             	add    $0x10,%esp
+f0100dd3:	85 c0                	test   %eax,%eax
+f0100dd5:	74 20                	je     f0100df7 <monitor+0x11f>
+  for (i = 0; i < NCOMMANDS; i++)
+f0100dd7:	83 c3 01             	add    $0x1,%ebx
+f0100dda:	83 fb 08             	cmp    $0x8,%ebx
+f0100ddd:	75 dc                	jne    f0100dbb <monitor+0xe3>
+  cprintf("Unknown command '%s'\n", argv[0]);
+f0100ddf:	83 ec 08             	sub    $0x8,%esp
+f0100de2:	ff 75 a8             	push   -0x58(%ebp)
+f0100de5:	68 8b 86 10 f0       	push   $0xf010868b
+f0100dea:	e8 3d 36 00 00       	call   f010442c <cprintf>
+  return 0;
+f0100def:	83 c4 10             	add    $0x10,%esp
+f0100df2:	e9 60 ff ff ff       	jmp    f0100d57 <monitor+0x7f>
+      return commands[i].func(argc, argv, tf);
+f0100df7:	83 ec 04             	sub    $0x4,%esp
+f0100dfa:	8d 04 5b             	lea    (%ebx,%ebx,2),%eax
+f0100dfd:	ff 75 08             	push   0x8(%ebp)
+f0100e00:	8d 55 a8             	lea    -0x58(%ebp),%edx
+f0100e03:	52                   	push   %edx
+f0100e04:	56                   	push   %esi
+f0100e05:	ff 14 85 88 8c 10 f0 	call   *-0xfef7378(,%eax,4)
+      if (runcmd(buf, tf) < 0)
+f0100e0c:	83 c4 10             	add    $0x10,%esp
+f0100e0f:	85 c0                	test   %eax,%eax
+f0100e11:	0f 89 40 ff ff ff    	jns    f0100d57 <monitor+0x7f>
+        break;
+  }
+}
+f0100e17:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0100e1a:	5b                   	pop    %ebx
+f0100e1b:	5e                   	pop    %esi
+f0100e1c:	5f                   	pop    %edi
+f0100e1d:	5d                   	pop    %ebp
+f0100e1e:	c3                   	ret
+
+f0100e1f <boot_alloc>:
+  // Initialize nextfree if this is the first time.
+  // 'end' is a magic symbol automatically generated by the linker,
+  // which points to the end of the kernel's bss segment:
+  // the first virtual address that the linker did *not* assign
+  // to any kernel code or global variables.
+  if (!nextfree) {
+f0100e1f:	83 3d 38 b2 79 f0 00 	cmpl   $0x0,0xf079b238
+f0100e26:	74 27                	je     f0100e4f <boot_alloc+0x30>
+  // Allocate a chunk large enough to hold 'n' bytes, then update
+  // nextfree.  Make sure nextfree is kept aligned
+  // to a multiple of PGSIZE.
+  //
+  // LAB 2: Your code here.
+  if (n > 0) {
+f0100e28:	85 c0                	test   %eax,%eax
+f0100e2a:	74 4d                	je     f0100e79 <boot_alloc+0x5a>
+    result = nextfree;
+f0100e2c:	8b 15 38 b2 79 f0    	mov    0xf079b238,%edx
+    rounded_n = ROUNDUP(n, PGSIZE);
+f0100e32:	05 ff 0f 00 00       	add    $0xfff,%eax
+f0100e37:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+
+    if (!((uint32_t) result + rounded_n < KERNBASE)) {
+f0100e3c:	8d 0c 02             	lea    (%edx,%eax,1),%ecx
+f0100e3f:	81 f9 ff ff ff ef    	cmp    $0xefffffff,%ecx
+f0100e45:	76 1b                	jbe    f0100e62 <boot_alloc+0x43>
+      nextfree += rounded_n;
+f0100e47:	89 0d 38 b2 79 f0    	mov    %ecx,0xf079b238
+      return result;
+f0100e4d:	eb 30                	jmp    f0100e7f <boot_alloc+0x60>
+    nextfree = ROUNDUP((char*)end, PGSIZE);
+f0100e4f:	ba 07 e0 7d f0       	mov    $0xf07de007,%edx
+f0100e54:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+f0100e5a:	89 15 38 b2 79 f0    	mov    %edx,0xf079b238
+f0100e60:	eb c6                	jmp    f0100e28 <boot_alloc+0x9>
+{
+f0100e62:	55                   	push   %ebp
+f0100e63:	89 e5                	mov    %esp,%ebp
+f0100e65:	83 ec 0c             	sub    $0xc,%esp
+    } else {
+      panic("Boot alloc ran out of memory!\n");
+f0100e68:	68 e0 8c 10 f0       	push   $0xf0108ce0
+f0100e6d:	6a 71                	push   $0x71
+f0100e6f:	68 1d 96 10 f0       	push   $0xf010961d
+f0100e74:	e8 c7 f1 ff ff       	call   f0100040 <_panic>
+    }
+  }
+
+  return nextfree;
+f0100e79:	8b 15 38 b2 79 f0    	mov    0xf079b238,%edx
+}
+f0100e7f:	89 d0                	mov    %edx,%eax
+f0100e81:	c3                   	ret
+
+f0100e82 <check_va2pa>:
+static physaddr_t
+check_va2pa(pde_t *pgdir, uintptr_t va)
+{
+  pte_t *p;
+
+  pgdir = &pgdir[PDX(va)];
+f0100e82:	89 d1                	mov    %edx,%ecx
+f0100e84:	c1 e9 16             	shr    $0x16,%ecx
+  if (!(*pgdir & PTE_P))
+f0100e87:	8b 04 88             	mov    (%eax,%ecx,4),%eax
+f0100e8a:	a8 01                	test   $0x1,%al
+f0100e8c:	74 51                	je     f0100edf <check_va2pa+0x5d>
+    return ~0;
+  p = (pte_t*)KADDR(PTE_ADDR(*pgdir));
+f0100e8e:	89 c1                	mov    %eax,%ecx
+f0100e90:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	if (PGNUM(pa) >= npages)
+f0100e96:	c1 e8 0c             	shr    $0xc,%eax
+f0100e99:	3b 05 08 bf 79 f0    	cmp    0xf079bf08,%eax
+f0100e9f:	73 23                	jae    f0100ec4 <check_va2pa+0x42>
+  if (!(p[PTX(va)] & PTE_P))
+f0100ea1:	c1 ea 0c             	shr    $0xc,%edx
+f0100ea4:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+f0100eaa:	8b 94 91 00 00 00 f0 	mov    -0x10000000(%ecx,%edx,4),%edx
+    return ~0;
+  return PTE_ADDR(p[PTX(va)]);
+f0100eb1:	89 d0                	mov    %edx,%eax
+f0100eb3:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f0100eb8:	f6 c2 01             	test   $0x1,%dl
+f0100ebb:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+f0100ec0:	0f 44 c2             	cmove  %edx,%eax
+f0100ec3:	c3                   	ret
+{
+f0100ec4:	55                   	push   %ebp
+f0100ec5:	89 e5                	mov    %esp,%ebp
+f0100ec7:	83 ec 08             	sub    $0x8,%esp
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0100eca:	51                   	push   %ecx
+f0100ecb:	68 c4 82 10 f0       	push   $0xf01082c4
+f0100ed0:	68 67 04 00 00       	push   $0x467
+f0100ed5:	68 1d 96 10 f0       	push   $0xf010961d
+f0100eda:	e8 61 f1 ff ff       	call   f0100040 <_panic>
+    return ~0;
+f0100edf:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+}
+f0100ee4:	c3                   	ret
+
+f0100ee5 <check_page_free_list>:
+{
+f0100ee5:	55                   	push   %ebp
+f0100ee6:	89 e5                	mov    %esp,%ebp
+f0100ee8:	57                   	push   %edi
+f0100ee9:	56                   	push   %esi
+f0100eea:	53                   	push   %ebx
+f0100eeb:	83 ec 2c             	sub    $0x2c,%esp
+  unsigned pdx_limit = only_low_memory ? 1 : NPDENTRIES;
+f0100eee:	84 c0                	test   %al,%al
+f0100ef0:	0f 85 75 02 00 00    	jne    f010116b <check_page_free_list+0x286>
+  if (!page_free_list)
+f0100ef6:	83 3d 40 b2 79 f0 00 	cmpl   $0x0,0xf079b240
+f0100efd:	74 0a                	je     f0100f09 <check_page_free_list+0x24>
+  unsigned pdx_limit = only_low_memory ? 1 : NPDENTRIES;
+f0100eff:	be 00 04 00 00       	mov    $0x400,%esi
+f0100f04:	e9 bd 02 00 00       	jmp    f01011c6 <check_page_free_list+0x2e1>
+    panic("'page_free_list' is a null pointer!");
+f0100f09:	83 ec 04             	sub    $0x4,%esp
+f0100f0c:	68 00 8d 10 f0       	push   $0xf0108d00
+f0100f11:	68 9c 03 00 00       	push   $0x39c
+f0100f16:	68 1d 96 10 f0       	push   $0xf010961d
+f0100f1b:	e8 20 f1 ff ff       	call   f0100040 <_panic>
+f0100f20:	50                   	push   %eax
+f0100f21:	68 c4 82 10 f0       	push   $0xf01082c4
+f0100f26:	6a 5f                	push   $0x5f
+f0100f28:	68 29 96 10 f0       	push   $0xf0109629
+f0100f2d:	e8 0e f1 ff ff       	call   f0100040 <_panic>
+  for (pp = page_free_list; pp; pp = pp->pp_link)
+f0100f32:	8b 1b                	mov    (%ebx),%ebx
+f0100f34:	85 db                	test   %ebx,%ebx
+f0100f36:	74 41                	je     f0100f79 <check_page_free_list+0x94>
+void	user_mem_assert(struct Env *env, const void *va, size_t len, int perm);
+
+static inline physaddr_t
+page2pa(struct PageInfo *pp)
+{
+	return (pp - pages) << PGSHIFT;
+f0100f38:	89 d8                	mov    %ebx,%eax
+f0100f3a:	2b 05 10 bf 79 f0    	sub    0xf079bf10,%eax
+f0100f40:	c1 f8 03             	sar    $0x3,%eax
+f0100f43:	c1 e0 0c             	shl    $0xc,%eax
+    if (PDX(page2pa(pp)) < pdx_limit)
+f0100f46:	89 c2                	mov    %eax,%edx
+f0100f48:	c1 ea 16             	shr    $0x16,%edx
+f0100f4b:	39 f2                	cmp    %esi,%edx
+f0100f4d:	73 e3                	jae    f0100f32 <check_page_free_list+0x4d>
+	if (PGNUM(pa) >= npages)
+f0100f4f:	89 c2                	mov    %eax,%edx
+f0100f51:	c1 ea 0c             	shr    $0xc,%edx
+f0100f54:	3b 15 08 bf 79 f0    	cmp    0xf079bf08,%edx
+f0100f5a:	73 c4                	jae    f0100f20 <check_page_free_list+0x3b>
+      memset(page2kva(pp), 0x97, 128);
+f0100f5c:	83 ec 04             	sub    $0x4,%esp
+f0100f5f:	68 80 00 00 00       	push   $0x80
+f0100f64:	68 97 00 00 00       	push   $0x97
+	return (void *)(pa + KERNBASE);
+f0100f69:	2d 00 00 00 10       	sub    $0x10000000,%eax
+f0100f6e:	50                   	push   %eax
+f0100f6f:	e8 08 67 00 00       	call   f010767c <memset>
+f0100f74:	83 c4 10             	add    $0x10,%esp
+f0100f77:	eb b9                	jmp    f0100f32 <check_page_free_list+0x4d>
+  first_free_page = (char*)boot_alloc(0);
+f0100f79:	b8 00 00 00 00       	mov    $0x0,%eax
+f0100f7e:	e8 9c fe ff ff       	call   f0100e1f <boot_alloc>
+f0100f83:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  for (pp = page_free_list; pp; pp = pp->pp_link) {
+f0100f86:	8b 15 40 b2 79 f0    	mov    0xf079b240,%edx
+    assert(pp >= pages);
+f0100f8c:	8b 0d 10 bf 79 f0    	mov    0xf079bf10,%ecx
+    assert(pp < pages + npages);
+f0100f92:	a1 08 bf 79 f0       	mov    0xf079bf08,%eax
+f0100f97:	89 45 cc             	mov    %eax,-0x34(%ebp)
+f0100f9a:	8d 34 c1             	lea    (%ecx,%eax,8),%esi
+  int nfree_basemem = 0, nfree_extmem = 0;
+f0100f9d:	bf 00 00 00 00       	mov    $0x0,%edi
+f0100fa2:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+f0100fa5:	89 7d d0             	mov    %edi,-0x30(%ebp)
+  for (pp = page_free_list; pp; pp = pp->pp_link) {
+f0100fa8:	e9 fe 00 00 00       	jmp    f01010ab <check_page_free_list+0x1c6>
+    assert(pp >= pages);
+f0100fad:	68 37 96 10 f0       	push   $0xf0109637
+f0100fb2:	68 43 96 10 f0       	push   $0xf0109643
+f0100fb7:	68 b6 03 00 00       	push   $0x3b6
+f0100fbc:	68 1d 96 10 f0       	push   $0xf010961d
+f0100fc1:	e8 7a f0 ff ff       	call   f0100040 <_panic>
+    assert(pp < pages + npages);
+f0100fc6:	68 58 96 10 f0       	push   $0xf0109658
+f0100fcb:	68 43 96 10 f0       	push   $0xf0109643
+f0100fd0:	68 b7 03 00 00       	push   $0x3b7
+f0100fd5:	68 1d 96 10 f0       	push   $0xf010961d
+f0100fda:	e8 61 f0 ff ff       	call   f0100040 <_panic>
+    assert(((char*)pp - (char*)pages) % sizeof(*pp) == 0);
+f0100fdf:	68 24 8d 10 f0       	push   $0xf0108d24
+f0100fe4:	68 43 96 10 f0       	push   $0xf0109643
+f0100fe9:	68 b8 03 00 00       	push   $0x3b8
+f0100fee:	68 1d 96 10 f0       	push   $0xf010961d
+f0100ff3:	e8 48 f0 ff ff       	call   f0100040 <_panic>
+    assert(page2pa(pp) != 0);
+f0100ff8:	68 6c 96 10 f0       	push   $0xf010966c
+f0100ffd:	68 43 96 10 f0       	push   $0xf0109643
+f0101002:	68 bb 03 00 00       	push   $0x3bb
+f0101007:	68 1d 96 10 f0       	push   $0xf010961d
+f010100c:	e8 2f f0 ff ff       	call   f0100040 <_panic>
+    assert(page2pa(pp) != IOPHYSMEM);
+f0101011:	68 7d 96 10 f0       	push   $0xf010967d
+f0101016:	68 43 96 10 f0       	push   $0xf0109643
+f010101b:	68 bc 03 00 00       	push   $0x3bc
+f0101020:	68 1d 96 10 f0       	push   $0xf010961d
+f0101025:	e8 16 f0 ff ff       	call   f0100040 <_panic>
+    assert(page2pa(pp) != EXTPHYSMEM - PGSIZE);
+f010102a:	68 54 8d 10 f0       	push   $0xf0108d54
+f010102f:	68 43 96 10 f0       	push   $0xf0109643
+f0101034:	68 bd 03 00 00       	push   $0x3bd
+f0101039:	68 1d 96 10 f0       	push   $0xf010961d
+f010103e:	e8 fd ef ff ff       	call   f0100040 <_panic>
+    assert(page2pa(pp) != EXTPHYSMEM);
+f0101043:	68 96 96 10 f0       	push   $0xf0109696
+f0101048:	68 43 96 10 f0       	push   $0xf0109643
+f010104d:	68 be 03 00 00       	push   $0x3be
+f0101052:	68 1d 96 10 f0       	push   $0xf010961d
+f0101057:	e8 e4 ef ff ff       	call   f0100040 <_panic>
+	if (PGNUM(pa) >= npages)
+f010105c:	89 c3                	mov    %eax,%ebx
+f010105e:	c1 eb 0c             	shr    $0xc,%ebx
+f0101061:	8b 7d cc             	mov    -0x34(%ebp),%edi
+f0101064:	39 fb                	cmp    %edi,%ebx
+f0101066:	73 12                	jae    f010107a <check_page_free_list+0x195>
+	return (void *)(pa + KERNBASE);
+f0101068:	2d 00 00 00 10       	sub    $0x10000000,%eax
+    assert(page2pa(pp) < EXTPHYSMEM || (char*)page2kva(pp) >= first_free_page);
+f010106d:	8b 7d c8             	mov    -0x38(%ebp),%edi
+f0101070:	39 f8                	cmp    %edi,%eax
+f0101072:	72 18                	jb     f010108c <check_page_free_list+0x1a7>
+      ++nfree_extmem;
+f0101074:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+f0101078:	eb 2f                	jmp    f01010a9 <check_page_free_list+0x1c4>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f010107a:	50                   	push   %eax
+f010107b:	68 c4 82 10 f0       	push   $0xf01082c4
+f0101080:	6a 5f                	push   $0x5f
+f0101082:	68 29 96 10 f0       	push   $0xf0109629
+f0101087:	e8 b4 ef ff ff       	call   f0100040 <_panic>
+    assert(page2pa(pp) < EXTPHYSMEM || (char*)page2kva(pp) >= first_free_page);
+f010108c:	68 78 8d 10 f0       	push   $0xf0108d78
+f0101091:	68 43 96 10 f0       	push   $0xf0109643
+f0101096:	68 bf 03 00 00       	push   $0x3bf
+f010109b:	68 1d 96 10 f0       	push   $0xf010961d
+f01010a0:	e8 9b ef ff ff       	call   f0100040 <_panic>
+      ++nfree_basemem;
+f01010a5:	83 45 d4 01          	addl   $0x1,-0x2c(%ebp)
+  for (pp = page_free_list; pp; pp = pp->pp_link) {
+f01010a9:	8b 12                	mov    (%edx),%edx
+f01010ab:	85 d2                	test   %edx,%edx
+f01010ad:	74 74                	je     f0101123 <check_page_free_list+0x23e>
+    assert(pp >= pages);
+f01010af:	39 ca                	cmp    %ecx,%edx
+f01010b1:	0f 82 f6 fe ff ff    	jb     f0100fad <check_page_free_list+0xc8>
+    assert(pp < pages + npages);
+f01010b7:	39 f2                	cmp    %esi,%edx
+f01010b9:	0f 83 07 ff ff ff    	jae    f0100fc6 <check_page_free_list+0xe1>
+    assert(((char*)pp - (char*)pages) % sizeof(*pp) == 0);
+f01010bf:	89 d0                	mov    %edx,%eax
+f01010c1:	29 c8                	sub    %ecx,%eax
+f01010c3:	a8 07                	test   $0x7,%al
+f01010c5:	0f 85 14 ff ff ff    	jne    f0100fdf <check_page_free_list+0xfa>
+	return (pp - pages) << PGSHIFT;
+f01010cb:	c1 f8 03             	sar    $0x3,%eax
+    assert(page2pa(pp) != 0);
+f01010ce:	c1 e0 0c             	shl    $0xc,%eax
+f01010d1:	0f 84 21 ff ff ff    	je     f0100ff8 <check_page_free_list+0x113>
+    assert(page2pa(pp) != IOPHYSMEM);
+f01010d7:	3d 00 00 0a 00       	cmp    $0xa0000,%eax
+f01010dc:	0f 84 2f ff ff ff    	je     f0101011 <check_page_free_list+0x12c>
+    assert(page2pa(pp) != EXTPHYSMEM - PGSIZE);
+f01010e2:	3d 00 f0 0f 00       	cmp    $0xff000,%eax
+f01010e7:	0f 84 3d ff ff ff    	je     f010102a <check_page_free_list+0x145>
+    assert(page2pa(pp) != EXTPHYSMEM);
+f01010ed:	3d 00 00 10 00       	cmp    $0x100000,%eax
+f01010f2:	0f 84 4b ff ff ff    	je     f0101043 <check_page_free_list+0x15e>
+    assert(page2pa(pp) < EXTPHYSMEM || (char*)page2kva(pp) >= first_free_page);
+f01010f8:	3d ff ff 0f 00       	cmp    $0xfffff,%eax
+f01010fd:	0f 87 59 ff ff ff    	ja     f010105c <check_page_free_list+0x177>
+    assert(page2pa(pp) != MPENTRY_PADDR);
+f0101103:	3d 00 70 00 00       	cmp    $0x7000,%eax
+f0101108:	75 9b                	jne    f01010a5 <check_page_free_list+0x1c0>
+f010110a:	68 b0 96 10 f0       	push   $0xf01096b0
+f010110f:	68 43 96 10 f0       	push   $0xf0109643
+f0101114:	68 c1 03 00 00       	push   $0x3c1
+f0101119:	68 1d 96 10 f0       	push   $0xf010961d
+f010111e:	e8 1d ef ff ff       	call   f0100040 <_panic>
+  assert(nfree_basemem > 0);
+f0101123:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+f0101126:	8b 7d d0             	mov    -0x30(%ebp),%edi
+f0101129:	85 db                	test   %ebx,%ebx
+f010112b:	7e 0c                	jle    f0101139 <check_page_free_list+0x254>
+  assert(nfree_extmem > 0);
+f010112d:	85 ff                	test   %edi,%edi
+f010112f:	7e 21                	jle    f0101152 <check_page_free_list+0x26d>
+}
+f0101131:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0101134:	5b                   	pop    %ebx
+f0101135:	5e                   	pop    %esi
+f0101136:	5f                   	pop    %edi
+f0101137:	5d                   	pop    %ebp
+f0101138:	c3                   	ret
+  assert(nfree_basemem > 0);
+f0101139:	68 cd 96 10 f0       	push   $0xf01096cd
+f010113e:	68 43 96 10 f0       	push   $0xf0109643
+f0101143:	68 c9 03 00 00       	push   $0x3c9
+f0101148:	68 1d 96 10 f0       	push   $0xf010961d
+f010114d:	e8 ee ee ff ff       	call   f0100040 <_panic>
+  assert(nfree_extmem > 0);
+f0101152:	68 df 96 10 f0       	push   $0xf01096df
+f0101157:	68 43 96 10 f0       	push   $0xf0109643
+f010115c:	68 ca 03 00 00       	push   $0x3ca
+f0101161:	68 1d 96 10 f0       	push   $0xf010961d
+f0101166:	e8 d5 ee ff ff       	call   f0100040 <_panic>
+  if (!page_free_list)
+f010116b:	a1 40 b2 79 f0       	mov    0xf079b240,%eax
+f0101170:	85 c0                	test   %eax,%eax
+f0101172:	0f 84 91 fd ff ff    	je     f0100f09 <check_page_free_list+0x24>
+    struct PageInfo **tp[2] = { &pp1, &pp2 };
+f0101178:	8d 55 d8             	lea    -0x28(%ebp),%edx
+f010117b:	89 55 e0             	mov    %edx,-0x20(%ebp)
+f010117e:	8d 55 dc             	lea    -0x24(%ebp),%edx
+f0101181:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+f0101184:	89 c2                	mov    %eax,%edx
+f0101186:	2b 15 10 bf 79 f0    	sub    0xf079bf10,%edx
+      int pagetype = PDX(page2pa(pp)) >= pdx_limit;
+f010118c:	f7 c2 00 e0 7f 00    	test   $0x7fe000,%edx
+f0101192:	0f 95 c2             	setne  %dl
+f0101195:	0f b6 d2             	movzbl %dl,%edx
+      *tp[pagetype] = pp;
+f0101198:	8b 4c 95 e0          	mov    -0x20(%ebp,%edx,4),%ecx
+f010119c:	89 01                	mov    %eax,(%ecx)
+      tp[pagetype] = &pp->pp_link;
+f010119e:	89 44 95 e0          	mov    %eax,-0x20(%ebp,%edx,4)
+    for (pp = page_free_list; pp; pp = pp->pp_link) {
+f01011a2:	8b 00                	mov    (%eax),%eax
+f01011a4:	85 c0                	test   %eax,%eax
+f01011a6:	75 dc                	jne    f0101184 <check_page_free_list+0x29f>
+    *tp[1] = 0;
+f01011a8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01011ab:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+    *tp[0] = pp2;
+f01011b1:	8b 55 dc             	mov    -0x24(%ebp),%edx
+f01011b4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f01011b7:	89 10                	mov    %edx,(%eax)
+    page_free_list = pp1;
+f01011b9:	8b 45 d8             	mov    -0x28(%ebp),%eax
+f01011bc:	a3 40 b2 79 f0       	mov    %eax,0xf079b240
+  unsigned pdx_limit = only_low_memory ? 1 : NPDENTRIES;
+f01011c1:	be 01 00 00 00       	mov    $0x1,%esi
+  for (pp = page_free_list; pp; pp = pp->pp_link)
+f01011c6:	8b 1d 40 b2 79 f0    	mov    0xf079b240,%ebx
+f01011cc:	e9 63 fd ff ff       	jmp    f0100f34 <check_page_free_list+0x4f>
+
+f01011d1 <page_init>:
+{
+f01011d1:	55                   	push   %ebp
+f01011d2:	89 e5                	mov    %esp,%ebp
+f01011d4:	57                   	push   %edi
+f01011d5:	56                   	push   %esi
+f01011d6:	53                   	push   %ebx
+f01011d7:	83 ec 1c             	sub    $0x1c,%esp
+  for (i = 1; i < npages_basemem; i++) {
+f01011da:	8b 1d 44 b2 79 f0    	mov    0xf079b244,%ebx
+f01011e0:	b8 08 00 00 00       	mov    $0x8,%eax
+f01011e5:	b9 01 00 00 00       	mov    $0x1,%ecx
+f01011ea:	eb 06                	jmp    f01011f2 <page_init+0x21>
+f01011ec:	83 c1 01             	add    $0x1,%ecx
+f01011ef:	83 c0 08             	add    $0x8,%eax
+f01011f2:	39 d9                	cmp    %ebx,%ecx
+f01011f4:	73 36                	jae    f010122c <page_init+0x5b>
+f01011f6:	89 c2                	mov    %eax,%edx
+f01011f8:	c1 fa 03             	sar    $0x3,%edx
+f01011fb:	c1 e2 0c             	shl    $0xc,%edx
+    if (page_pa != MPENTRY_PADDR) {
+f01011fe:	81 fa 00 70 00 00    	cmp    $0x7000,%edx
+f0101204:	74 e6                	je     f01011ec <page_init+0x1b>
+    page_pa = page2pa(&pages[i]);
+f0101206:	89 c2                	mov    %eax,%edx
+f0101208:	03 15 10 bf 79 f0    	add    0xf079bf10,%edx
+      pages[i].pp_ref = 0;
+f010120e:	66 c7 42 04 00 00    	movw   $0x0,0x4(%edx)
+      pages[i].pp_link = page_free_list;
+f0101214:	8b 35 40 b2 79 f0    	mov    0xf079b240,%esi
+f010121a:	89 32                	mov    %esi,(%edx)
+      page_free_list = &pages[i];
+f010121c:	89 c2                	mov    %eax,%edx
+f010121e:	03 15 10 bf 79 f0    	add    0xf079bf10,%edx
+f0101224:	89 15 40 b2 79 f0    	mov    %edx,0xf079b240
+f010122a:	eb c0                	jmp    f01011ec <page_init+0x1b>
+  nextfree = boot_alloc(0);
+f010122c:	b8 00 00 00 00       	mov    $0x0,%eax
+f0101231:	e8 e9 fb ff ff       	call   f0100e1f <boot_alloc>
+f0101236:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = EXTPHYSMEM / PGSIZE; i < npages; i++) {
+f0101239:	ba 00 08 00 00       	mov    $0x800,%edx
+f010123e:	be 00 01 00 00       	mov    $0x100,%esi
+f0101243:	eb 18                	jmp    f010125d <page_init+0x8c>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0101245:	51                   	push   %ecx
+f0101246:	68 c4 82 10 f0       	push   $0xf01082c4
+f010124b:	6a 5f                	push   $0x5f
+f010124d:	68 29 96 10 f0       	push   $0xf0109629
+f0101252:	e8 e9 ed ff ff       	call   f0100040 <_panic>
+f0101257:	83 c6 01             	add    $0x1,%esi
+f010125a:	83 c2 08             	add    $0x8,%edx
+f010125d:	8b 1d 08 bf 79 f0    	mov    0xf079bf08,%ebx
+f0101263:	39 de                	cmp    %ebx,%esi
+f0101265:	73 42                	jae    f01012a9 <page_init+0xd8>
+    page_kva = page2kva(&pages[i]);
+f0101267:	8b 3d 10 bf 79 f0    	mov    0xf079bf10,%edi
+	return (pp - pages) << PGSHIFT;
+f010126d:	89 d0                	mov    %edx,%eax
+f010126f:	c1 f8 03             	sar    $0x3,%eax
+f0101272:	89 c1                	mov    %eax,%ecx
+f0101274:	c1 e1 0c             	shl    $0xc,%ecx
+	if (PGNUM(pa) >= npages)
+f0101277:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f010127c:	39 d8                	cmp    %ebx,%eax
+f010127e:	73 c5                	jae    f0101245 <page_init+0x74>
+	return (void *)(pa + KERNBASE);
+f0101280:	81 e9 00 00 00 10    	sub    $0x10000000,%ecx
+    if ( (page_kva > nextfree) ) {
+f0101286:	39 4d e4             	cmp    %ecx,-0x1c(%ebp)
+f0101289:	73 cc                	jae    f0101257 <page_init+0x86>
+    page_kva = page2kva(&pages[i]);
+f010128b:	01 d7                	add    %edx,%edi
+      pages[i].pp_ref = 0;
+f010128d:	66 c7 47 04 00 00    	movw   $0x0,0x4(%edi)
+      pages[i].pp_link = page_free_list;
+f0101293:	a1 40 b2 79 f0       	mov    0xf079b240,%eax
+f0101298:	89 07                	mov    %eax,(%edi)
+      page_free_list = &pages[i];
+f010129a:	89 d0                	mov    %edx,%eax
+f010129c:	03 05 10 bf 79 f0    	add    0xf079bf10,%eax
+f01012a2:	a3 40 b2 79 f0       	mov    %eax,0xf079b240
+f01012a7:	eb ae                	jmp    f0101257 <page_init+0x86>
+}
+f01012a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01012ac:	5b                   	pop    %ebx
+f01012ad:	5e                   	pop    %esi
+f01012ae:	5f                   	pop    %edi
+f01012af:	5d                   	pop    %ebp
+f01012b0:	c3                   	ret
+
+f01012b1 <page_alloc>:
+{
+f01012b1:	55                   	push   %ebp
+f01012b2:	89 e5                	mov    %esp,%ebp
+f01012b4:	53                   	push   %ebx
+f01012b5:	83 ec 04             	sub    $0x4,%esp
+  struct PageInfo *result = page_free_list;
+f01012b8:	8b 1d 40 b2 79 f0    	mov    0xf079b240,%ebx
+  if (result) {
+f01012be:	85 db                	test   %ebx,%ebx
+f01012c0:	74 13                	je     f01012d5 <page_alloc+0x24>
+    page_free_list = page_free_list->pp_link;
+f01012c2:	8b 03                	mov    (%ebx),%eax
+f01012c4:	a3 40 b2 79 f0       	mov    %eax,0xf079b240
+    result->pp_link = NULL;
+f01012c9:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    if (alloc_flags & ALLOC_ZERO) {
+f01012cf:	f6 45 08 01          	testb  $0x1,0x8(%ebp)
+f01012d3:	75 07                	jne    f01012dc <page_alloc+0x2b>
+}
+f01012d5:	89 d8                	mov    %ebx,%eax
+f01012d7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01012da:	c9                   	leave
+f01012db:	c3                   	ret
+	return (pp - pages) << PGSHIFT;
+f01012dc:	89 d8                	mov    %ebx,%eax
+f01012de:	2b 05 10 bf 79 f0    	sub    0xf079bf10,%eax
+f01012e4:	c1 f8 03             	sar    $0x3,%eax
+f01012e7:	89 c2                	mov    %eax,%edx
+f01012e9:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f01012ec:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f01012f1:	3b 05 08 bf 79 f0    	cmp    0xf079bf08,%eax
+f01012f7:	73 1b                	jae    f0101314 <page_alloc+0x63>
+      memset(page2kva(result), 0, PGSIZE);
+f01012f9:	83 ec 04             	sub    $0x4,%esp
+f01012fc:	68 00 10 00 00       	push   $0x1000
+f0101301:	6a 00                	push   $0x0
+	return (void *)(pa + KERNBASE);
+f0101303:	81 ea 00 00 00 10    	sub    $0x10000000,%edx
+f0101309:	52                   	push   %edx
+f010130a:	e8 6d 63 00 00       	call   f010767c <memset>
+f010130f:	83 c4 10             	add    $0x10,%esp
+f0101312:	eb c1                	jmp    f01012d5 <page_alloc+0x24>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0101314:	52                   	push   %edx
+f0101315:	68 c4 82 10 f0       	push   $0xf01082c4
+f010131a:	6a 5f                	push   $0x5f
+f010131c:	68 29 96 10 f0       	push   $0xf0109629
+f0101321:	e8 1a ed ff ff       	call   f0100040 <_panic>
+
+f0101326 <page_alloc_contig>:
+{
+f0101326:	55                   	push   %ebp
+f0101327:	89 e5                	mov    %esp,%ebp
+f0101329:	57                   	push   %edi
+f010132a:	56                   	push   %esi
+f010132b:	53                   	push   %ebx
+f010132c:	83 ec 1c             	sub    $0x1c,%esp
+f010132f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if (n == 0 || !page_free_list)
+f0101332:	85 ff                	test   %edi,%edi
+f0101334:	0f 84 0f 01 00 00    	je     f0101449 <page_alloc_contig+0x123>
+f010133a:	a1 40 b2 79 f0       	mov    0xf079b240,%eax
+f010133f:	85 c0                	test   %eax,%eax
+f0101341:	0f 84 fa 00 00 00    	je     f0101441 <page_alloc_contig+0x11b>
+  for (tail = page_free_list; tail->pp_link; tail = tail->pp_link)
+f0101347:	89 c2                	mov    %eax,%edx
+f0101349:	8b 00                	mov    (%eax),%eax
+f010134b:	85 c0                	test   %eax,%eax
+f010134d:	75 f8                	jne    f0101347 <page_alloc_contig+0x21>
+  for (i = 0, run = 0; i < npages && run < n; i++)
+f010134f:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+f0101352:	8b 35 08 bf 79 f0    	mov    0xf079bf08,%esi
+    run = (pages[i].pp_link || &pages[i] == tail) ? run + 1 : 0;
+f0101358:	8b 1d 10 bf 79 f0    	mov    0xf079bf10,%ebx
+f010135e:	89 5d dc             	mov    %ebx,-0x24(%ebp)
+f0101361:	89 da                	mov    %ebx,%edx
+  for (i = 0, run = 0; i < npages && run < n; i++)
+f0101363:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0101368:	b9 00 00 00 00       	mov    $0x0,%ecx
+f010136d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f0101370:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0101373:	eb 09                	jmp    f010137e <page_alloc_contig+0x58>
+    run = (pages[i].pp_link || &pages[i] == tail) ? run + 1 : 0;
+f0101375:	83 c3 01             	add    $0x1,%ebx
+  for (i = 0, run = 0; i < npages && run < n; i++)
+f0101378:	83 c1 01             	add    $0x1,%ecx
+f010137b:	83 c2 08             	add    $0x8,%edx
+f010137e:	39 f1                	cmp    %esi,%ecx
+f0101380:	73 14                	jae    f0101396 <page_alloc_contig+0x70>
+f0101382:	39 fb                	cmp    %edi,%ebx
+f0101384:	73 10                	jae    f0101396 <page_alloc_contig+0x70>
+    run = (pages[i].pp_link || &pages[i] == tail) ? run + 1 : 0;
+f0101386:	83 3a 00             	cmpl   $0x0,(%edx)
+f0101389:	75 ea                	jne    f0101375 <page_alloc_contig+0x4f>
+f010138b:	39 d0                	cmp    %edx,%eax
+f010138d:	74 e6                	je     f0101375 <page_alloc_contig+0x4f>
+f010138f:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0101394:	eb e2                	jmp    f0101378 <page_alloc_contig+0x52>
+  if (run < n)
+f0101396:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0101399:	39 fb                	cmp    %edi,%ebx
+f010139b:	0f 82 a0 00 00 00    	jb     f0101441 <page_alloc_contig+0x11b>
+  first = &pages[i - n];
+f01013a1:	29 f9                	sub    %edi,%ecx
+f01013a3:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f01013a6:	8d 04 c8             	lea    (%eax,%ecx,8),%eax
+    if (*pp >= first && *pp < first + n)
+f01013a9:	8d 1c f8             	lea    (%eax,%edi,8),%ebx
+  for (pp = &page_free_list; *pp; ) {
+f01013ac:	b9 40 b2 79 f0       	mov    $0xf079b240,%ecx
+f01013b1:	eb 02                	jmp    f01013b5 <page_alloc_contig+0x8f>
+      pp = &(*pp)->pp_link;
+f01013b3:	89 d1                	mov    %edx,%ecx
+  for (pp = &page_free_list; *pp; ) {
+f01013b5:	8b 11                	mov    (%ecx),%edx
+f01013b7:	85 d2                	test   %edx,%edx
+f01013b9:	74 0e                	je     f01013c9 <page_alloc_contig+0xa3>
+    if (*pp >= first && *pp < first + n)
+f01013bb:	39 c2                	cmp    %eax,%edx
+f01013bd:	72 f4                	jb     f01013b3 <page_alloc_contig+0x8d>
+f01013bf:	39 da                	cmp    %ebx,%edx
+f01013c1:	73 f0                	jae    f01013b3 <page_alloc_contig+0x8d>
+      *pp = (*pp)->pp_link;
+f01013c3:	8b 12                	mov    (%edx),%edx
+f01013c5:	89 11                	mov    %edx,(%ecx)
+f01013c7:	eb ec                	jmp    f01013b5 <page_alloc_contig+0x8f>
+f01013c9:	89 c3                	mov    %eax,%ebx
+  for (i = 0; i < n; i++) {
+f01013cb:	be 00 00 00 00       	mov    $0x0,%esi
+    if (alloc_flags & ALLOC_ZERO)
+f01013d0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+f01013d3:	83 e1 01             	and    $0x1,%ecx
+f01013d6:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+f01013d9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f01013dc:	eb 1c                	jmp    f01013fa <page_alloc_contig+0xd4>
+f01013de:	51                   	push   %ecx
+f01013df:	68 c4 82 10 f0       	push   $0xf01082c4
+f01013e4:	6a 5f                	push   $0x5f
+f01013e6:	68 29 96 10 f0       	push   $0xf0109629
+f01013eb:	e8 50 ec ff ff       	call   f0100040 <_panic>
+  for (i = 0; i < n; i++) {
+f01013f0:	83 c6 01             	add    $0x1,%esi
+f01013f3:	83 c3 08             	add    $0x8,%ebx
+f01013f6:	39 f7                	cmp    %esi,%edi
+f01013f8:	74 44                	je     f010143e <page_alloc_contig+0x118>
+    first[i].pp_link = NULL;
+f01013fa:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    if (alloc_flags & ALLOC_ZERO)
+f0101400:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+f0101404:	74 ea                	je     f01013f0 <page_alloc_contig+0xca>
+	return (pp - pages) << PGSHIFT;
+f0101406:	89 d8                	mov    %ebx,%eax
+f0101408:	2b 05 10 bf 79 f0    	sub    0xf079bf10,%eax
+f010140e:	c1 f8 03             	sar    $0x3,%eax
+f0101411:	89 c1                	mov    %eax,%ecx
+f0101413:	c1 e1 0c             	shl    $0xc,%ecx
+	if (PGNUM(pa) >= npages)
+f0101416:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f010141b:	3b 05 08 bf 79 f0    	cmp    0xf079bf08,%eax
+f0101421:	73 bb                	jae    f01013de <page_alloc_contig+0xb8>
+      memset(page2kva(&first[i]), 0, PGSIZE);
+f0101423:	83 ec 04             	sub    $0x4,%esp
+f0101426:	68 00 10 00 00       	push   $0x1000
+f010142b:	6a 00                	push   $0x0
+	return (void *)(pa + KERNBASE);
+f010142d:	81 e9 00 00 00 10    	sub    $0x10000000,%ecx
+f0101433:	51                   	push   %ecx
+f0101434:	e8 43 62 00 00       	call   f010767c <memset>
+f0101439:	83 c4 10             	add    $0x10,%esp
+f010143c:	eb b2                	jmp    f01013f0 <page_alloc_contig+0xca>
+f010143e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+}
+f0101441:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0101444:	5b                   	pop    %ebx
+f0101445:	5e                   	pop    %esi
+f0101446:	5f                   	pop    %edi
+f0101447:	5d                   	pop    %ebp
+f0101448:	c3                   	ret
+    return NULL;
+f0101449:	b8 00 00 00 00       	mov    $0x0,%eax
+f010144e:	eb f1                	jmp    f0101441 <page_alloc_contig+0x11b>
+
+f0101450 <page_free>:
+{
+f0101450:	55                   	push   %ebp
+f0101451:	89 e5                	mov    %esp,%ebp
+f0101453:	83 ec 08             	sub    $0x8,%esp
+f0101456:	8b 45 08             	mov    0x8(%ebp),%eax
+  if (pp->pp_ref) {
+f0101459:	66 83 78 04 00       	cmpw   $0x0,0x4(%eax)
+f010145e:	75 0f                	jne    f010146f <page_free+0x1f>
+    pp->pp_link = page_free_list;
+f0101460:	8b 15 40 b2 79 f0    	mov    0xf079b240,%edx
+f0101466:	89 10                	mov    %edx,(%eax)
+    page_free_list = pp;
+f0101468:	a3 40 b2 79 f0       	mov    %eax,0xf079b240
+}
+f010146d:	c9                   	leave
+f010146e:	c3                   	ret
+      panic("Warning, pp_ref is not zero\n");
+f010146f:	83 ec 04             	sub    $0x4,%esp
+f0101472:	68 f0 96 10 f0       	push   $0xf01096f0
+f0101477:	68 d4 01 00 00       	push   $0x1d4
+f010147c:	68 1d 96 10 f0       	push   $0xf010961d
+f0101481:	e8 ba eb ff ff       	call   f0100040 <_panic>
+
+f0101486 <page_decref>:
+{
+f0101486:	55                   	push   %ebp
+f0101487:	89 e5                	mov    %esp,%ebp
+f0101489:	83 ec 08             	sub    $0x8,%esp
+f010148c:	8b 55 08             	mov    0x8(%ebp),%edx
+  if (--pp->pp_ref == 0)
+f010148f:	0f b7 42 04          	movzwl 0x4(%edx),%eax
+f0101493:	83 e8 01             	sub    $0x1,%eax
+f0101496:	66 89 42 04          	mov    %ax,0x4(%edx)
+f010149a:	66 85 c0             	test   %ax,%ax
+f010149d:	74 02                	je     f01014a1 <page_decref+0x1b>
+}
+f010149f:	c9                   	leave
+f01014a0:	c3                   	ret
+    page_free(pp);
+f01014a1:	83 ec 0c             	sub    $0xc,%esp
+f01014a4:	52                   	push   %edx
+f01014a5:	e8 a6 ff ff ff       	call   f0101450 <page_free>
+f01014aa:	83 c4 10             	add    $0x10,%esp
+}
+f01014ad:	eb f0                	jmp    f010149f <page_decref+0x19>
+
+f01014af <pgdir_unshare>:
+{
+f01014af:	55                   	push   %ebp
+f01014b0:	89 e5                	mov    %esp,%ebp
+f01014b2:	57                   	push   %edi
+f01014b3:	56                   	push   %esi
+f01014b4:	53                   	push   %ebx
+f01014b5:	83 ec 1c             	sub    $0x1c,%esp
+  pde_t *pde = &pgdir[PDX(va)];
+f01014b8:	8b 45 0c             	mov    0xc(%ebp),%eax
+f01014bb:	c1 e8 16             	shr    $0x16,%eax
+f01014be:	8b 55 08             	mov    0x8(%ebp),%edx
+f01014c1:	8d 3c 82             	lea    (%edx,%eax,4),%edi
+  if ( (*pde & (PTE_P | PDE_SHARED)) != (PTE_P | PDE_SHARED) )
+f01014c4:	8b 07                	mov    (%edi),%eax
+f01014c6:	89 c1                	mov    %eax,%ecx
+f01014c8:	81 e1 01 08 00 00    	and    $0x801,%ecx
+    return 0;
+f01014ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  if ( (*pde & (PTE_P | PDE_SHARED)) != (PTE_P | PDE_SHARED) )
+f01014d3:	81 f9 01 08 00 00    	cmp    $0x801,%ecx
+f01014d9:	74 0a                	je     f01014e5 <pgdir_unshare+0x36>
+}
+f01014db:	89 d0                	mov    %edx,%eax
+f01014dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01014e0:	5b                   	pop    %ebx
+f01014e1:	5e                   	pop    %esi
+f01014e2:	5f                   	pop    %edi
+f01014e3:	5d                   	pop    %ebp
+f01014e4:	c3                   	ret
+  shared = pa2page(PTE_ADDR(*pde));
+f01014e5:	89 c6                	mov    %eax,%esi
+f01014e7:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+}
+
+static inline struct PageInfo*
+pa2page(physaddr_t pa)
+{
+	if (PGNUM(pa) >= npages)
+f01014ed:	c1 e8 0c             	shr    $0xc,%eax
+f01014f0:	3b 05 08 bf 79 f0    	cmp    0xf079bf08,%eax
+f01014f6:	73 28                	jae    f0101520 <pgdir_unshare+0x71>
+		panic("pa2page called with invalid pa");
+	return &pages[PGNUM(pa)];
+f01014f8:	8b 15 10 bf 79 f0    	mov    0xf079bf10,%edx
+f01014fe:	8d 04 c2             	lea    (%edx,%eax,8),%eax
+f0101501:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+	return (void *)(pa + KERNBASE);
+f0101504:	8d 9e 00 00 00 f0    	lea    -0x10000000(%esi),%ebx
+  if (shared->pp_ref == 1) {
+f010150a:	66 83 78 04 01       	cmpw   $0x1,0x4(%eax)
+f010150f:	0f 85 ac 00 00 00    	jne    f01015c1 <pgdir_unshare+0x112>
+f0101515:	81 ee 00 f0 ff 0f    	sub    $0xffff000,%esi
+f010151b:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+f010151e:	eb 2b                	jmp    f010154b <pgdir_unshare+0x9c>
+		panic("pa2page called with invalid pa");
+f0101520:	83 ec 04             	sub    $0x4,%esp
+f0101523:	68 bc 8d 10 f0       	push   $0xf0108dbc
+f0101528:	6a 58                	push   $0x58
+f010152a:	68 29 96 10 f0       	push   $0xf0109629
+f010152f:	e8 0c eb ff ff       	call   f0100040 <_panic>
+f0101534:	83 ec 04             	sub    $0x4,%esp
+f0101537:	68 bc 8d 10 f0       	push   $0xf0108dbc
+f010153c:	6a 58                	push   $0x58
+f010153e:	68 29 96 10 f0       	push   $0xf0109629
+f0101543:	e8 f8 ea ff ff       	call   f0100040 <_panic>
+    for (i = 0; i < NPTENTRIES; i++)
+f0101548:	83 c3 04             	add    $0x4,%ebx
+f010154b:	39 f3                	cmp    %esi,%ebx
+f010154d:	74 36                	je     f0101585 <pgdir_unshare+0xd6>
+      if ( (src[i] & (PTE_P | PTE_W | PTE_SHARE)) == (PTE_P | PTE_W) &&
+f010154f:	8b 03                	mov    (%ebx),%eax
+f0101551:	89 c1                	mov    %eax,%ecx
+f0101553:	81 e1 03 04 00 00    	and    $0x403,%ecx
+f0101559:	83 f9 03             	cmp    $0x3,%ecx
+f010155c:	75 ea                	jne    f0101548 <pgdir_unshare+0x99>
+	if (PGNUM(pa) >= npages)
+f010155e:	89 c1                	mov    %eax,%ecx
+f0101560:	c1 e9 0c             	shr    $0xc,%ecx
+f0101563:	3b 0d 08 bf 79 f0    	cmp    0xf079bf08,%ecx
+f0101569:	73 c9                	jae    f0101534 <pgdir_unshare+0x85>
+f010156b:	8b 3d 10 bf 79 f0    	mov    0xf079bf10,%edi
+f0101571:	66 83 7c cf 04 01    	cmpw   $0x1,0x4(%edi,%ecx,8)
+f0101577:	76 cf                	jbe    f0101548 <pgdir_unshare+0x99>
+        src[i] = (src[i] & ~PTE_W) | PTE_COW;
+f0101579:	25 fd f7 ff ff       	and    $0xfffff7fd,%eax
+f010157e:	80 cc 08             	or     $0x8,%ah
+f0101581:	89 03                	mov    %eax,(%ebx)
+f0101583:	eb c3                	jmp    f0101548 <pgdir_unshare+0x99>
+    *pde = (*pde & ~PDE_SHARED) | PTE_W;
+f0101585:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f0101588:	8b 07                	mov    (%edi),%eax
+f010158a:	25 fd f7 ff ff       	and    $0xfffff7fd,%eax
+f010158f:	83 c8 02             	or     $0x2,%eax
+f0101592:	89 07                	mov    %eax,(%edi)
+  __asm __volatile("movl %%cr3,%0" : "=r" (val));
+f0101594:	0f 20 d9             	mov    %cr3,%ecx
+	if ((uint32_t)kva < KERNBASE)
+f0101597:	81 7d 08 ff ff ff ef 	cmpl   $0xefffffff,0x8(%ebp)
+f010159e:	0f 86 f5 00 00 00    	jbe    f0101699 <pgdir_unshare+0x1ea>
+	return (physaddr_t)kva - KERNBASE;
+f01015a4:	8b 45 08             	mov    0x8(%ebp),%eax
+f01015a7:	05 00 00 00 10       	add    $0x10000000,%eax
+  return 0;
+f01015ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (rcr3() == PADDR(pgdir))
+f01015b1:	39 c8                	cmp    %ecx,%eax
+f01015b3:	0f 85 22 ff ff ff    	jne    f01014db <pgdir_unshare+0x2c>
+  __asm __volatile("movl %0,%%cr3" : : "r" (val));
+f01015b9:	0f 22 d8             	mov    %eax,%cr3
+}
+f01015bc:	e9 1a ff ff ff       	jmp    f01014db <pgdir_unshare+0x2c>
+    if ( !(copy = page_alloc(0)) )
+f01015c1:	83 ec 0c             	sub    $0xc,%esp
+f01015c4:	6a 00                	push   $0x0
+f01015c6:	e8 e6 fc ff ff       	call   f01012b1 <page_alloc>
+f01015cb:	83 c4 10             	add    $0x10,%esp
+f01015ce:	85 c0                	test   %eax,%eax
+f01015d0:	0f 84 da 00 00 00    	je     f01016b0 <pgdir_unshare+0x201>
+	return (pp - pages) << PGSHIFT;
+f01015d6:	89 c1                	mov    %eax,%ecx
+f01015d8:	2b 0d 10 bf 79 f0    	sub    0xf079bf10,%ecx
+f01015de:	c1 f9 03             	sar    $0x3,%ecx
+f01015e1:	89 ca                	mov    %ecx,%edx
+f01015e3:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f01015e6:	81 e1 ff ff 0f 00    	and    $0xfffff,%ecx
+f01015ec:	3b 0d 08 bf 79 f0    	cmp    0xf079bf08,%ecx
+f01015f2:	73 10                	jae    f0101604 <pgdir_unshare+0x155>
+    for (i = 0; i < NPTENTRIES; i++) {
+f01015f4:	8d 8e 00 10 00 f0    	lea    -0xffff000(%esi),%ecx
+      dst[i] = src[i];
+f01015fa:	29 f2                	sub    %esi,%edx
+f01015fc:	89 7d e0             	mov    %edi,-0x20(%ebp)
+f01015ff:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    for (i = 0; i < NPTENTRIES; i++) {
+f0101602:	eb 20                	jmp    f0101624 <pgdir_unshare+0x175>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0101604:	52                   	push   %edx
+f0101605:	68 c4 82 10 f0       	push   $0xf01082c4
+f010160a:	6a 5f                	push   $0x5f
+f010160c:	68 29 96 10 f0       	push   $0xf0109629
+f0101611:	e8 2a ea ff ff       	call   f0100040 <_panic>
+      if (src[i] & PTE_P)
+f0101616:	8b 06                	mov    (%esi),%eax
+f0101618:	a8 01                	test   $0x1,%al
+f010161a:	75 29                	jne    f0101645 <pgdir_unshare+0x196>
+      dst[i] = src[i];
+f010161c:	8b 06                	mov    (%esi),%eax
+f010161e:	89 04 1a             	mov    %eax,(%edx,%ebx,1)
+    for (i = 0; i < NPTENTRIES; i++) {
+f0101621:	83 c3 04             	add    $0x4,%ebx
+f0101624:	39 cb                	cmp    %ecx,%ebx
+f0101626:	74 4a                	je     f0101672 <pgdir_unshare+0x1c3>
+      if ( (src[i] & (PTE_P | PTE_W | PTE_SHARE)) == (PTE_P | PTE_W) )
+f0101628:	89 de                	mov    %ebx,%esi
+f010162a:	8b 03                	mov    (%ebx),%eax
+f010162c:	89 c7                	mov    %eax,%edi
+f010162e:	81 e7 03 04 00 00    	and    $0x403,%edi
+f0101634:	83 ff 03             	cmp    $0x3,%edi
+f0101637:	75 dd                	jne    f0101616 <pgdir_unshare+0x167>
+        src[i] = (src[i] & ~PTE_W) | PTE_COW;
+f0101639:	25 fd f7 ff ff       	and    $0xfffff7fd,%eax
+f010163e:	80 cc 08             	or     $0x8,%ah
+f0101641:	89 03                	mov    %eax,(%ebx)
+f0101643:	eb d1                	jmp    f0101616 <pgdir_unshare+0x167>
+	if (PGNUM(pa) >= npages)
+f0101645:	c1 e8 0c             	shr    $0xc,%eax
+f0101648:	3b 05 08 bf 79 f0    	cmp    0xf079bf08,%eax
+f010164e:	73 0e                	jae    f010165e <pgdir_unshare+0x1af>
+	return &pages[PGNUM(pa)];
+f0101650:	8b 3d 10 bf 79 f0    	mov    0xf079bf10,%edi
+        pa2page(PTE_ADDR(src[i]))->pp_ref++;
+f0101656:	66 83 44 c7 04 01    	addw   $0x1,0x4(%edi,%eax,8)
+f010165c:	eb be                	jmp    f010161c <pgdir_unshare+0x16d>
+		panic("pa2page called with invalid pa");
+f010165e:	83 ec 04             	sub    $0x4,%esp
+f0101661:	68 bc 8d 10 f0       	push   $0xf0108dbc
+f0101666:	6a 58                	push   $0x58
+f0101668:	68 29 96 10 f0       	push   $0xf0109629
+f010166d:	e8 ce e9 ff ff       	call   f0100040 <_panic>
+    copy->pp_ref++;
+f0101672:	8b 7d e0             	mov    -0x20(%ebp),%edi
+f0101675:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f0101678:	66 83 40 04 01       	addw   $0x1,0x4(%eax)
+    shared->pp_ref--;
+f010167d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+f0101680:	66 83 6a 04 01       	subw   $0x1,0x4(%edx)
+	return (pp - pages) << PGSHIFT;
+f0101685:	2b 05 10 bf 79 f0    	sub    0xf079bf10,%eax
+f010168b:	c1 f8 03             	sar    $0x3,%eax
+f010168e:	c1 e0 0c             	shl    $0xc,%eax
+    *pde = page2pa(copy) | PTE_P | PTE_W | PTE_U;
+f0101691:	83 c8 07             	or     $0x7,%eax
+f0101694:	e9 f9 fe ff ff       	jmp    f0101592 <pgdir_unshare+0xe3>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0101699:	ff 75 08             	push   0x8(%ebp)
+f010169c:	68 e8 82 10 f0       	push   $0xf01082e8
+f01016a1:	68 d8 02 00 00       	push   $0x2d8
+f01016a6:	68 1d 96 10 f0       	push   $0xf010961d
+f01016ab:	e8 90 e9 ff ff       	call   f0100040 <_panic>
+      return -E_NO_MEM;
+f01016b0:	ba fc ff ff ff       	mov    $0xfffffffc,%edx
+f01016b5:	e9 21 fe ff ff       	jmp    f01014db <pgdir_unshare+0x2c>
+
+f01016ba <pgdir_walk>:
+{
+f01016ba:	55                   	push   %ebp
+f01016bb:	89 e5                	mov    %esp,%ebp
+f01016bd:	57                   	push   %edi
+f01016be:	56                   	push   %esi
+f01016bf:	53                   	push   %ebx
+f01016c0:	83 ec 0c             	sub    $0xc,%esp
+f01016c3:	8b 45 08             	mov    0x8(%ebp),%eax
+f01016c6:	8b 55 10             	mov    0x10(%ebp),%edx
+  pagedir_entry = &pgdir[PDX(va)];
+f01016c9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+f01016cc:	c1 e9 16             	shr    $0x16,%ecx
+f01016cf:	8d 3c 88             	lea    (%eax,%ecx,4),%edi
+  if (*pagedir_entry & PTE_P) {
+f01016d2:	f6 07 01             	testb  $0x1,(%edi)
+f01016d5:	74 63                	je     f010173a <pgdir_walk+0x80>
+    if (create && pgdir_unshare(pgdir, va) < 0)
+f01016d7:	85 d2                	test   %edx,%edx
+f01016d9:	74 17                	je     f01016f2 <pgdir_walk+0x38>
+f01016db:	83 ec 08             	sub    $0x8,%esp
+f01016de:	ff 75 0c             	push   0xc(%ebp)
+f01016e1:	50                   	push   %eax
+f01016e2:	e8 c8 fd ff ff       	call   f01014af <pgdir_unshare>
+f01016e7:	83 c4 10             	add    $0x10,%esp
+f01016ea:	85 c0                	test   %eax,%eax
+f01016ec:	0f 88 c0 00 00 00    	js     f01017b2 <pgdir_walk+0xf8>
+    pagetable = (pte_t *) KADDR(PTE_ADDR(*pagedir_entry));
+f01016f2:	8b 07                	mov    (%edi),%eax
+f01016f4:	89 c6                	mov    %eax,%esi
+f01016f6:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if (PGNUM(pa) >= npages)
+f01016fc:	c1 e8 0c             	shr    $0xc,%eax
+f01016ff:	3b 05 08 bf 79 f0    	cmp    0xf079bf08,%eax
+f0101705:	73 1e                	jae    f0101725 <pgdir_walk+0x6b>
+	return (void *)(pa + KERNBASE);
+f0101707:	81 ee 00 00 00 10    	sub    $0x10000000,%esi
+  return &pagetable[PTX(va)];
+f010170d:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0101710:	c1 e8 0a             	shr    $0xa,%eax
+f0101713:	25 fc 0f 00 00       	and    $0xffc,%eax
+f0101718:	8d 1c 06             	lea    (%esi,%eax,1),%ebx
+}
+f010171b:	89 d8                	mov    %ebx,%eax
+f010171d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0101720:	5b                   	pop    %ebx
+f0101721:	5e                   	pop    %esi
+f0101722:	5f                   	pop    %edi
+f0101723:	5d                   	pop    %ebp
+f0101724:	c3                   	ret
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0101725:	56                   	push   %esi
+f0101726:	68 c4 82 10 f0       	push   $0xf01082c4
+f010172b:	68 0d 02 00 00       	push   $0x20d
+f0101730:	68 1d 96 10 f0       	push   $0xf010961d
+f0101735:	e8 06 e9 ff ff       	call   f0100040 <_panic>
+    if (!create || !(pagetable_page = page_alloc(ALLOC_ZERO))) {
+f010173a:	85 d2                	test   %edx,%edx
+f010173c:	74 7e                	je     f01017bc <pgdir_walk+0x102>
+f010173e:	83 ec 0c             	sub    $0xc,%esp
+f0101741:	6a 01                	push   $0x1
+f0101743:	e8 69 fb ff ff       	call   f01012b1 <page_alloc>
+f0101748:	89 c3                	mov    %eax,%ebx
+f010174a:	83 c4 10             	add    $0x10,%esp
+f010174d:	85 c0                	test   %eax,%eax
+f010174f:	74 ca                	je     f010171b <pgdir_walk+0x61>
+    (pagetable_page->pp_ref)++;
+f0101751:	66 83 40 04 01       	addw   $0x1,0x4(%eax)
+	return (pp - pages) << PGSHIFT;
+f0101756:	2b 05 10 bf 79 f0    	sub    0xf079bf10,%eax
+f010175c:	c1 f8 03             	sar    $0x3,%eax
+f010175f:	89 c6                	mov    %eax,%esi
+f0101761:	c1 e6 0c             	shl    $0xc,%esi
+	if (PGNUM(pa) >= npages)
+f0101764:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0101769:	3b 05 08 bf 79 f0    	cmp    0xf079bf08,%eax
+f010176f:	73 2f                	jae    f01017a0 <pgdir_walk+0xe6>
+	return (void *)(pa + KERNBASE);
+f0101771:	81 ee 00 00 00 10    	sub    $0x10000000,%esi
+    memset(page2kva(pagetable_page), 0, PGSIZE);
+f0101777:	83 ec 04             	sub    $0x4,%esp
+f010177a:	68 00 10 00 00       	push   $0x1000
+f010177f:	6a 00                	push   $0x0
+f0101781:	56                   	push   %esi
+f0101782:	e8 f5 5e 00 00       	call   f010767c <memset>
+	return (pp - pages) << PGSHIFT;
+f0101787:	2b 1d 10 bf 79 f0    	sub    0xf079bf10,%ebx
+f010178d:	c1 fb 03             	sar    $0x3,%ebx
+f0101790:	c1 e3 0c             	shl    $0xc,%ebx
+    *pagedir_entry = page2pa(pagetable_page) | PTE_P | PTE_W | PTE_U;
+f0101793:	83 cb 07             	or     $0x7,%ebx
+f0101796:	89 1f                	mov    %ebx,(%edi)
+f0101798:	83 c4 10             	add    $0x10,%esp
+f010179b:	e9 6d ff ff ff       	jmp    f010170d <pgdir_walk+0x53>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f01017a0:	56                   	push   %esi
+f01017a1:	68 c4 82 10 f0       	push   $0xf01082c4
+f01017a6:	6a 5f                	push   $0x5f
+f01017a8:	68 29 96 10 f0       	push   $0xf0109629
+f01017ad:	e8 8e e8 ff ff       	call   f0100040 <_panic>
+      return NULL;
+f01017b2:	bb 00 00 00 00       	mov    $0x0,%ebx
+f01017b7:	e9 5f ff ff ff       	jmp    f010171b <pgdir_walk+0x61>
+      return NULL;
+f01017bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+f01017c1:	e9 55 ff ff ff       	jmp    f010171b <pgdir_walk+0x61>
+
+f01017c6 <boot_map_region>:
+{
+f01017c6:	55                   	push   %ebp
+f01017c7:	89 e5                	mov    %esp,%ebp
+f01017c9:	57                   	push   %edi
+f01017ca:	56                   	push   %esi
+f01017cb:	53                   	push   %ebx
+f01017cc:	83 ec 1c             	sub    $0x1c,%esp
+f01017cf:	89 c7                	mov    %eax,%edi
+f01017d1:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+f01017d4:	89 ce                	mov    %ecx,%esi
+  for (i = 0; i < size; i += PGSIZE) {
+f01017d6:	bb 00 00 00 00       	mov    $0x0,%ebx
+f01017db:	eb 13                	jmp    f01017f0 <boot_map_region+0x2a>
+      *current_pagetable = (pa + i) | perm | PTE_P;
+f01017dd:	89 da                	mov    %ebx,%edx
+f01017df:	03 55 08             	add    0x8(%ebp),%edx
+f01017e2:	0b 55 0c             	or     0xc(%ebp),%edx
+f01017e5:	83 ca 01             	or     $0x1,%edx
+f01017e8:	89 10                	mov    %edx,(%eax)
+  for (i = 0; i < size; i += PGSIZE) {
+f01017ea:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f01017f0:	39 f3                	cmp    %esi,%ebx
+f01017f2:	73 1a                	jae    f010180e <boot_map_region+0x48>
+    if ( (current_pagetable = pgdir_walk(pgdir, (void *) (va + i), 1)) ) {
+f01017f4:	83 ec 04             	sub    $0x4,%esp
+f01017f7:	6a 01                	push   $0x1
+f01017f9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01017fc:	01 d8                	add    %ebx,%eax
+f01017fe:	50                   	push   %eax
+f01017ff:	57                   	push   %edi
+f0101800:	e8 b5 fe ff ff       	call   f01016ba <pgdir_walk>
+f0101805:	83 c4 10             	add    $0x10,%esp
+f0101808:	85 c0                	test   %eax,%eax
+f010180a:	75 d1                	jne    f01017dd <boot_map_region+0x17>
+f010180c:	eb dc                	jmp    f01017ea <boot_map_region+0x24>
+}
+f010180e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0101811:	5b                   	pop    %ebx
+f0101812:	5e                   	pop    %esi
+f0101813:	5f                   	pop    %edi
+f0101814:	5d                   	pop    %ebp
+f0101815:	c3                   	ret
+
+f0101816 <page_lookup>:
+{
+f0101816:	55                   	push   %ebp
+f0101817:	89 e5                	mov    %esp,%ebp
+f0101819:	53                   	push   %ebx
+f010181a:	83 ec 08             	sub    $0x8,%esp
+f010181d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if ( (pagetable_entry = pgdir_walk(pgdir, va, 0)) ) {
+f0101820:	6a 00                	push   $0x0
+f0101822:	ff 75 0c             	push   0xc(%ebp)
+f0101825:	ff 75 08             	push   0x8(%ebp)
+f0101828:	e8 8d fe ff ff       	call   f01016ba <pgdir_walk>
+f010182d:	83 c4 10             	add    $0x10,%esp
+f0101830:	85 c0                	test   %eax,%eax
+f0101832:	74 12                	je     f0101846 <page_lookup+0x30>
+    if (pte_store) {
+f0101834:	85 db                	test   %ebx,%ebx
+f0101836:	74 02                	je     f010183a <page_lookup+0x24>
+      *pte_store = pagetable_entry;
+f0101838:	89 03                	mov    %eax,(%ebx)
+    if (*pagetable_entry & PTE_P)
+f010183a:	8b 10                	mov    (%eax),%edx
+  return NULL;
+f010183c:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (*pagetable_entry & PTE_P)
+f0101841:	f6 c2 01             	test   $0x1,%dl
+f0101844:	75 05                	jne    f010184b <page_lookup+0x35>
+}
+f0101846:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0101849:	c9                   	leave
+f010184a:	c3                   	ret
+	if (PGNUM(pa) >= npages)
+f010184b:	c1 ea 0c             	shr    $0xc,%edx
+f010184e:	3b 15 08 bf 79 f0    	cmp    0xf079bf08,%edx
+f0101854:	73 0a                	jae    f0101860 <page_lookup+0x4a>
+	return &pages[PGNUM(pa)];
+f0101856:	a1 10 bf 79 f0       	mov    0xf079bf10,%eax
+f010185b:	8d 04 d0             	lea    (%eax,%edx,8),%eax
+      return pa2page(PTE_ADDR(*pagetable_entry));
+f010185e:	eb e6                	jmp    f0101846 <page_lookup+0x30>
+		panic("pa2page called with invalid pa");
+f0101860:	83 ec 04             	sub    $0x4,%esp
+f0101863:	68 bc 8d 10 f0       	push   $0xf0108dbc
+f0101868:	6a 58                	push   $0x58
+f010186a:	68 29 96 10 f0       	push   $0xf0109629
+f010186f:	e8 cc e7 ff ff       	call   f0100040 <_panic>
+
+f0101874 <tlb_invalidate>:
+{
+f0101874:	55                   	push   %ebp
+f0101875:	89 e5                	mov    %esp,%ebp
+f0101877:	83 ec 08             	sub    $0x8,%esp
+  if (!curenv || curenv->env_pgdir == pgdir)
+f010187a:	e8 e0 63 00 00       	call   f0107c5f <cpunum>
+f010187f:	6b c0 74             	imul   $0x74,%eax,%eax
+f0101882:	83 b8 28 c0 79 f0 00 	cmpl   $0x0,-0xf863fd8(%eax)
+f0101889:	74 16                	je     f01018a1 <tlb_invalidate+0x2d>
+f010188b:	e8 cf 63 00 00       	call   f0107c5f <cpunum>
+f0101890:	6b c0 74             	imul   $0x74,%eax,%eax
+f0101893:	8b 80 28 c0 79 f0    	mov    -0xf863fd8(%eax),%eax
+f0101899:	8b 55 08             	mov    0x8(%ebp),%edx
+f010189c:	39 50 60             	cmp    %edx,0x60(%eax)
+f010189f:	75 06                	jne    f01018a7 <tlb_invalidate+0x33>
+  __asm __volatile("invlpg (%0)" : : "r" (addr) : "memory");
+f01018a1:	8b 45 0c             	mov    0xc(%ebp),%eax
+f01018a4:	0f 01 38             	invlpg (%eax)
+}
+f01018a7:	c9                   	leave
+f01018a8:	c3                   	ret
+
+f01018a9 <page_remove>:
+{
+f01018a9:	55                   	push   %ebp
+f01018aa:	89 e5                	mov    %esp,%ebp
+f01018ac:	57                   	push   %edi
+f01018ad:	56                   	push   %esi
+f01018ae:	53                   	push   %ebx
+f01018af:	83 ec 20             	sub    $0x20,%esp
+f01018b2:	8b 75 08             	mov    0x8(%ebp),%esi
+f01018b5:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ( !(page_info = page_lookup(pgdir, va, &page_table_store)) )
+f01018b8:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f01018bb:	50                   	push   %eax
+f01018bc:	57                   	push   %edi
+f01018bd:	56                   	push   %esi
+f01018be:	e8 53 ff ff ff       	call   f0101816 <page_lookup>
+f01018c3:	83 c4 10             	add    $0x10,%esp
+f01018c6:	85 c0                	test   %eax,%eax
+f01018c8:	74 43                	je     f010190d <page_remove+0x64>
+f01018ca:	89 c3                	mov    %eax,%ebx
+  if ( (pgdir[PDX(va)] & PDE_SHARED) &&
+f01018cc:	89 f8                	mov    %edi,%eax
+f01018ce:	c1 e8 16             	shr    $0x16,%eax
+f01018d1:	f6 44 86 01 08       	testb  $0x8,0x1(%esi,%eax,4)
+f01018d6:	74 16                	je     f01018ee <page_remove+0x45>
+      !(page_table_store = pgdir_walk(pgdir, va, 1)) )
+f01018d8:	83 ec 04             	sub    $0x4,%esp
+f01018db:	6a 01                	push   $0x1
+f01018dd:	57                   	push   %edi
+f01018de:	56                   	push   %esi
+f01018df:	e8 d6 fd ff ff       	call   f01016ba <pgdir_walk>
+f01018e4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if ( (pgdir[PDX(va)] & PDE_SHARED) &&
+f01018e7:	83 c4 10             	add    $0x10,%esp
+f01018ea:	85 c0                	test   %eax,%eax
+f01018ec:	74 1f                	je     f010190d <page_remove+0x64>
+  page_decref(page_info);
+f01018ee:	83 ec 0c             	sub    $0xc,%esp
+f01018f1:	53                   	push   %ebx
+f01018f2:	e8 8f fb ff ff       	call   f0101486 <page_decref>
+  *page_table_store = (pte_t) NULL;
+f01018f7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01018fa:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  tlb_invalidate(pgdir, va);
+f0101900:	83 c4 08             	add    $0x8,%esp
+f0101903:	57                   	push   %edi
+f0101904:	56                   	push   %esi
+f0101905:	e8 6a ff ff ff       	call   f0101874 <tlb_invalidate>
+f010190a:	83 c4 10             	add    $0x10,%esp
+}
+f010190d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0101910:	5b                   	pop    %ebx
+f0101911:	5e                   	pop    %esi
+f0101912:	5f                   	pop    %edi
+f0101913:	5d                   	pop    %ebp
+f0101914:	c3                   	ret
+
+f0101915 <page_insert>:
+{
+f0101915:	55                   	push   %ebp
+f0101916:	89 e5                	mov    %esp,%ebp
+f0101918:	57                   	push   %edi
+f0101919:	56                   	push   %esi
+f010191a:	53                   	push   %ebx
+f010191b:	83 ec 10             	sub    $0x10,%esp
+f010191e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f0101921:	8b 7d 10             	mov    0x10(%ebp),%edi
+  if ( !(pagetable_entry = pgdir_walk(pgdir, va, 1)) )
+f0101924:	6a 01                	push   $0x1
+f0101926:	57                   	push   %edi
+f0101927:	ff 75 08             	push   0x8(%ebp)
+f010192a:	e8 8b fd ff ff       	call   f01016ba <pgdir_walk>
+f010192f:	83 c4 10             	add    $0x10,%esp
+f0101932:	85 c0                	test   %eax,%eax
+f0101934:	74 37                	je     f010196d <page_insert+0x58>
+f0101936:	89 c6                	mov    %eax,%esi
+  pp->pp_ref++;
+f0101938:	66 83 43 04 01       	addw   $0x1,0x4(%ebx)
+  page_remove(pgdir, va);
+f010193d:	83 ec 08             	sub    $0x8,%esp
+f0101940:	57                   	push   %edi
+f0101941:	ff 75 08             	push   0x8(%ebp)
+f0101944:	e8 60 ff ff ff       	call   f01018a9 <page_remove>
+	return (pp - pages) << PGSHIFT;
+f0101949:	2b 1d 10 bf 79 f0    	sub    0xf079bf10,%ebx
+f010194f:	c1 fb 03             	sar    $0x3,%ebx
+f0101952:	c1 e3 0c             	shl    $0xc,%ebx
+  *pagetable_entry = PTE_ADDR(page2pa(pp)) | perm | PTE_P;
+f0101955:	0b 5d 14             	or     0x14(%ebp),%ebx
+f0101958:	83 cb 01             	or     $0x1,%ebx
+f010195b:	89 1e                	mov    %ebx,(%esi)
+  return 0;
+f010195d:	83 c4 10             	add    $0x10,%esp
+f0101960:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0101965:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0101968:	5b                   	pop    %ebx
+f0101969:	5e                   	pop    %esi
+f010196a:	5f                   	pop    %edi
+f010196b:	5d                   	pop    %ebp
+f010196c:	c3                   	ret
+    return -E_NO_MEM;
+f010196d:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f0101972:	eb f1                	jmp    f0101965 <page_insert+0x50>
+
+f0101974 <page_cow>:
+{
+f0101974:	55                   	push   %ebp
+f0101975:	89 e5                	mov    %esp,%ebp
+f0101977:	57                   	push   %edi
+f0101978:	56                   	push   %esi
+f0101979:	53                   	push   %ebx
+f010197a:	83 ec 1c             	sub    $0x1c,%esp
+  va = ROUNDDOWN(va, PGSIZE);
+f010197d:	8b 75 0c             	mov    0xc(%ebp),%esi
+f0101980:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+  if ( (uintptr_t) va >= UTOP || !(pte = pgdir_walk(pgdir, va, 0)) )
+f0101986:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+f010198c:	0f 87 77 01 00 00    	ja     f0101b09 <page_cow+0x195>
+f0101992:	83 ec 04             	sub    $0x4,%esp
+f0101995:	6a 00                	push   $0x0
+f0101997:	56                   	push   %esi
+f0101998:	ff 75 08             	push   0x8(%ebp)
+f010199b:	e8 1a fd ff ff       	call   f01016ba <pgdir_walk>
+f01019a0:	83 c4 10             	add    $0x10,%esp
+f01019a3:	85 c0                	test   %eax,%eax
+f01019a5:	0f 84 65 01 00 00    	je     f0101b10 <page_cow+0x19c>
+  if ( (*pte & (PTE_P | PTE_U | PTE_COW)) != (PTE_P | PTE_U | PTE_COW) )
+f01019ab:	8b 00                	mov    (%eax),%eax
+f01019ad:	25 05 08 00 00       	and    $0x805,%eax
+f01019b2:	3d 05 08 00 00       	cmp    $0x805,%eax
+f01019b7:	0f 85 5a 01 00 00    	jne    f0101b17 <page_cow+0x1a3>
+  if ( !(pte = pgdir_walk(pgdir, va, 1)) )
+f01019bd:	83 ec 04             	sub    $0x4,%esp
+f01019c0:	6a 01                	push   $0x1
+f01019c2:	56                   	push   %esi
+f01019c3:	ff 75 08             	push   0x8(%ebp)
+f01019c6:	e8 ef fc ff ff       	call   f01016ba <pgdir_walk>
+f01019cb:	89 c2                	mov    %eax,%edx
+f01019cd:	83 c4 10             	add    $0x10,%esp
+f01019d0:	85 c0                	test   %eax,%eax
+f01019d2:	0f 84 49 01 00 00    	je     f0101b21 <page_cow+0x1ad>
+  perm = (*pte & PTE_SYSCALL & ~PTE_COW) | PTE_W;
+f01019d8:	8b 00                	mov    (%eax),%eax
+f01019da:	89 c1                	mov    %eax,%ecx
+f01019dc:	81 e1 05 06 00 00    	and    $0x605,%ecx
+f01019e2:	83 c9 02             	or     $0x2,%ecx
+f01019e5:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  pp = pa2page(PTE_ADDR(*pte));
+f01019e8:	89 c1                	mov    %eax,%ecx
+f01019ea:	81 e1 00 f0 ff ff    	and    $0xfffff000,%ecx
+	if (PGNUM(pa) >= npages)
+f01019f0:	c1 e8 0c             	shr    $0xc,%eax
+f01019f3:	3b 05 08 bf 79 f0    	cmp    0xf079bf08,%eax
+f01019f9:	0f 83 a2 00 00 00    	jae    f0101aa1 <page_cow+0x12d>
+	return &pages[PGNUM(pa)];
+f01019ff:	8b 1d 10 bf 79 f0    	mov    0xf079bf10,%ebx
+f0101a05:	8d 1c c3             	lea    (%ebx,%eax,8),%ebx
+  if (pp->pp_ref == 1) {
+f0101a08:	66 83 7b 04 01       	cmpw   $0x1,0x4(%ebx)
+f0101a0d:	0f 84 a2 00 00 00    	je     f0101ab5 <page_cow+0x141>
+  if ( !(copy = page_alloc(0)) )
+f0101a13:	83 ec 0c             	sub    $0xc,%esp
+f0101a16:	6a 00                	push   $0x0
+f0101a18:	e8 94 f8 ff ff       	call   f01012b1 <page_alloc>
+f0101a1d:	89 c7                	mov    %eax,%edi
+f0101a1f:	83 c4 10             	add    $0x10,%esp
+f0101a22:	85 c0                	test   %eax,%eax
+f0101a24:	0f 84 01 01 00 00    	je     f0101b2b <page_cow+0x1b7>
+	return (pp - pages) << PGSHIFT;
+f0101a2a:	8b 15 10 bf 79 f0    	mov    0xf079bf10,%edx
+f0101a30:	29 d3                	sub    %edx,%ebx
+f0101a32:	c1 fb 03             	sar    $0x3,%ebx
+f0101a35:	89 d8                	mov    %ebx,%eax
+f0101a37:	c1 e0 0c             	shl    $0xc,%eax
+	if (PGNUM(pa) >= npages)
+f0101a3a:	8b 0d 08 bf 79 f0    	mov    0xf079bf08,%ecx
+f0101a40:	81 e3 ff ff 0f 00    	and    $0xfffff,%ebx
+f0101a46:	39 cb                	cmp    %ecx,%ebx
+f0101a48:	0f 83 84 00 00 00    	jae    f0101ad2 <page_cow+0x15e>
+	return (void *)(pa + KERNBASE);
+f0101a4e:	2d 00 00 00 10       	sub    $0x10000000,%eax
+	return (pp - pages) << PGSHIFT;
+f0101a53:	89 fb                	mov    %edi,%ebx
+f0101a55:	29 d3                	sub    %edx,%ebx
+f0101a57:	89 da                	mov    %ebx,%edx
+f0101a59:	c1 fa 03             	sar    $0x3,%edx
+f0101a5c:	89 d3                	mov    %edx,%ebx
+f0101a5e:	c1 e3 0c             	shl    $0xc,%ebx
+	if (PGNUM(pa) >= npages)
+f0101a61:	81 e2 ff ff 0f 00    	and    $0xfffff,%edx
+f0101a67:	39 ca                	cmp    %ecx,%edx
+f0101a69:	73 79                	jae    f0101ae4 <page_cow+0x170>
+  memmove(page2kva(copy), page2kva(pp), PGSIZE);
+f0101a6b:	83 ec 04             	sub    $0x4,%esp
+f0101a6e:	68 00 10 00 00       	push   $0x1000
+f0101a73:	50                   	push   %eax
+	return (void *)(pa + KERNBASE);
+f0101a74:	81 eb 00 00 00 10    	sub    $0x10000000,%ebx
+f0101a7a:	53                   	push   %ebx
+f0101a7b:	e8 31 5c 00 00       	call   f01076b1 <memmove>
+  if (page_insert(pgdir, copy, va, perm) < 0) {
+f0101a80:	ff 75 e4             	push   -0x1c(%ebp)
+f0101a83:	56                   	push   %esi
+f0101a84:	57                   	push   %edi
+f0101a85:	ff 75 08             	push   0x8(%ebp)
+f0101a88:	e8 88 fe ff ff       	call   f0101915 <page_insert>
+f0101a8d:	83 c4 20             	add    $0x20,%esp
+f0101a90:	85 c0                	test   %eax,%eax
+f0101a92:	78 62                	js     f0101af6 <page_cow+0x182>
+  return 0;
+f0101a94:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0101a99:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0101a9c:	5b                   	pop    %ebx
+f0101a9d:	5e                   	pop    %esi
+f0101a9e:	5f                   	pop    %edi
+f0101a9f:	5d                   	pop    %ebp
+f0101aa0:	c3                   	ret
+		panic("pa2page called with invalid pa");
+f0101aa1:	83 ec 04             	sub    $0x4,%esp
+f0101aa4:	68 bc 8d 10 f0       	push   $0xf0108dbc
+f0101aa9:	6a 58                	push   $0x58
+f0101aab:	68 29 96 10 f0       	push   $0xf0109629
+f0101ab0:	e8 8b e5 ff ff       	call   f0100040 <_panic>
+    *pte = PTE_ADDR(*pte) | perm;
+f0101ab5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0101ab8:	09 c8                	or     %ecx,%eax
+f0101aba:	89 02                	mov    %eax,(%edx)
+    tlb_invalidate(pgdir, va);
+f0101abc:	83 ec 08             	sub    $0x8,%esp
+f0101abf:	56                   	push   %esi
+f0101ac0:	ff 75 08             	push   0x8(%ebp)
+f0101ac3:	e8 ac fd ff ff       	call   f0101874 <tlb_invalidate>
+    return 0;
+f0101ac8:	83 c4 10             	add    $0x10,%esp
+f0101acb:	b8 00 00 00 00       	mov    $0x0,%eax
+f0101ad0:	eb c7                	jmp    f0101a99 <page_cow+0x125>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0101ad2:	50                   	push   %eax
+f0101ad3:	68 c4 82 10 f0       	push   $0xf01082c4
+f0101ad8:	6a 5f                	push   $0x5f
+f0101ada:	68 29 96 10 f0       	push   $0xf0109629
+f0101adf:	e8 5c e5 ff ff       	call   f0100040 <_panic>
+f0101ae4:	53                   	push   %ebx
+f0101ae5:	68 c4 82 10 f0       	push   $0xf01082c4
+f0101aea:	6a 5f                	push   $0x5f
+f0101aec:	68 29 96 10 f0       	push   $0xf0109629
+f0101af1:	e8 4a e5 ff ff       	call   f0100040 <_panic>
+    page_free(copy);
+f0101af6:	83 ec 0c             	sub    $0xc,%esp
+f0101af9:	57                   	push   %edi
+f0101afa:	e8 51 f9 ff ff       	call   f0101450 <page_free>
+    return -E_NO_MEM;
+f0101aff:	83 c4 10             	add    $0x10,%esp
+f0101b02:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f0101b07:	eb 90                	jmp    f0101a99 <page_cow+0x125>
+    return -E_INVAL;
+f0101b09:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0101b0e:	eb 89                	jmp    f0101a99 <page_cow+0x125>
+f0101b10:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0101b15:	eb 82                	jmp    f0101a99 <page_cow+0x125>
+    return -E_INVAL;
+f0101b17:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0101b1c:	e9 78 ff ff ff       	jmp    f0101a99 <page_cow+0x125>
+    return -E_NO_MEM;
+f0101b21:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f0101b26:	e9 6e ff ff ff       	jmp    f0101a99 <page_cow+0x125>
+    return -E_NO_MEM;
+f0101b2b:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f0101b30:	e9 64 ff ff ff       	jmp    f0101a99 <page_cow+0x125>
+
+f0101b35 <mmio_map_region>:
+{
+f0101b35:	55                   	push   %ebp
+f0101b36:	89 e5                	mov    %esp,%ebp
+f0101b38:	53                   	push   %ebx
+f0101b39:	83 ec 04             	sub    $0x4,%esp
+f0101b3c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if (base + size >=  MMIOLIM) {
+f0101b3f:	8b 15 00 53 11 f0    	mov    0xf0115300,%edx
+f0101b45:	8d 04 1a             	lea    (%edx,%ebx,1),%eax
+f0101b48:	3d ff ff bf ef       	cmp    $0xefbfffff,%eax
+f0101b4d:	77 32                	ja     f0101b81 <mmio_map_region+0x4c>
+  boot_map_region(kern_pgdir,
+f0101b4f:	83 ec 08             	sub    $0x8,%esp
+f0101b52:	6a 1b                	push   $0x1b
+f0101b54:	ff 75 08             	push   0x8(%ebp)
+f0101b57:	89 d9                	mov    %ebx,%ecx
+f0101b59:	a1 0c bf 79 f0       	mov    0xf079bf0c,%eax
+f0101b5e:	e8 63 fc ff ff       	call   f01017c6 <boot_map_region>
+  result = (void *) base;
+f0101b63:	8b 15 00 53 11 f0    	mov    0xf0115300,%edx
+  base = ROUNDUP(base + size, PGSIZE);
+f0101b69:	8d 84 1a ff 0f 00 00 	lea    0xfff(%edx,%ebx,1),%eax
+f0101b70:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f0101b75:	a3 00 53 11 f0       	mov    %eax,0xf0115300
+}
+f0101b7a:	89 d0                	mov    %edx,%eax
+f0101b7c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0101b7f:	c9                   	leave
+f0101b80:	c3                   	ret
+    panic("mmio_map_region: attempting to map memory past MMIOLIM");
+f0101b81:	83 ec 04             	sub    $0x4,%esp
+f0101b84:	68 dc 8d 10 f0       	push   $0xf0108ddc
+f0101b89:	68 38 03 00 00       	push   $0x338
+f0101b8e:	68 1d 96 10 f0       	push   $0xf010961d
+f0101b93:	e8 a8 e4 ff ff       	call   f0100040 <_panic>
+
+f0101b98 <mem_init>:
+{
+f0101b98:	55                   	push   %ebp
+f0101b99:	89 e5                	mov    %esp,%ebp
+f0101b9b:	57                   	push   %edi
+f0101b9c:	56                   	push   %esi
+f0101b9d:	53                   	push   %ebx
+f0101b9e:	83 ec 48             	sub    $0x48,%esp
+  return mc146818_read(r) | (mc146818_read(r + 1) << 8);
+f0101ba1:	6a 15                	push   $0x15
+f0101ba3:	e8 de 26 00 00       	call   f0104286 <mc146818_read>
+f0101ba8:	89 c3                	mov    %eax,%ebx
+f0101baa:	c7 04 24 16 00 00 00 	movl   $0x16,(%esp)
+f0101bb1:	e8 d0 26 00 00       	call   f0104286 <mc146818_read>
+f0101bb6:	c1 e0 08             	shl    $0x8,%eax
+f0101bb9:	09 d8                	or     %ebx,%eax
+  npages_basemem = (nvram_read(NVRAM_BASELO) * 1024) / PGSIZE;
+f0101bbb:	8d 50 03             	lea    0x3(%eax),%edx
+f0101bbe:	85 c0                	test   %eax,%eax
+f0101bc0:	0f 48 c2             	cmovs  %edx,%eax
+f0101bc3:	c1 f8 02             	sar    $0x2,%eax
+f0101bc6:	a3 44 b2 79 f0       	mov    %eax,0xf079b244
+  return mc146818_read(r) | (mc146818_read(r + 1) << 8);
+f0101bcb:	c7 04 24 17 00 00 00 	movl   $0x17,(%esp)
+f0101bd2:	e8 af 26 00 00       	call   f0104286 <mc146818_read>
+f0101bd7:	89 c3                	mov    %eax,%ebx
+f0101bd9:	c7 04 24 18 00 00 00 	movl   $0x18,(%esp)
+f0101be0:	e8 a1 26 00 00       	call   f0104286 <mc146818_read>
+f0101be5:	c1 e0 08             	shl    $0x8,%eax
+f0101be8:	89 c2                	mov    %eax,%edx
+f0101bea:	09 da                	or     %ebx,%edx
+  npages_extmem = (nvram_read(NVRAM_EXTLO) * 1024) / PGSIZE;
+f0101bec:	8d 42 03             	lea    0x3(%edx),%eax
+f0101bef:	83 c4 10             	add    $0x10,%esp
+f0101bf2:	85 d2                	test   %edx,%edx
+f0101bf4:	0f 49 c2             	cmovns %edx,%eax
+f0101bf7:	c1 f8 02             	sar    $0x2,%eax
+    npages = (EXTPHYSMEM / PGSIZE) + npages_extmem;
+f0101bfa:	8d 90 00 01 00 00    	lea    0x100(%eax),%edx
+f0101c00:	0f 44 15 44 b2 79 f0 	cmove  0xf079b244,%edx
+f0101c07:	89 15 08 bf 79 f0    	mov    %edx,0xf079bf08
+          npages_extmem * PGSIZE / 1024);
+f0101c0d:	c1 e0 0c             	shl    $0xc,%eax
+  cprintf("Physical memory: %uK available, base = %uK, extended = %uK\n",
+f0101c10:	c1 e8 0a             	shr    $0xa,%eax
+f0101c13:	50                   	push   %eax
+          npages_basemem * PGSIZE / 1024,
+f0101c14:	a1 44 b2 79 f0       	mov    0xf079b244,%eax
+f0101c19:	c1 e0 0c             	shl    $0xc,%eax
+  cprintf("Physical memory: %uK available, base = %uK, extended = %uK\n",
+f0101c1c:	c1 e8 0a             	shr    $0xa,%eax
+f0101c1f:	50                   	push   %eax
+          npages * PGSIZE / 1024,
+f0101c20:	c1 e2 0c             	shl    $0xc,%edx
+  cprintf("Physical memory: %uK available, base = %uK, extended = %uK\n",
+f0101c23:	c1 ea 0a             	shr    $0xa,%edx
+f0101c26:	52                   	push   %edx
+f0101c27:	68 14 8e 10 f0       	push   $0xf0108e14
+f0101c2c:	e8 fb 27 00 00       	call   f010442c <cprintf>
+  kern_pgdir = (pde_t*)boot_alloc(PGSIZE);
+f0101c31:	b8 00 10 00 00       	mov    $0x1000,%eax
+f0101c36:	e8 e4 f1 ff ff       	call   f0100e1f <boot_alloc>
+f0101c3b:	a3 0c bf 79 f0       	mov    %eax,0xf079bf0c
+  memset(kern_pgdir, 0, PGSIZE);
+f0101c40:	83 c4 0c             	add    $0xc,%esp
+f0101c43:	68 00 10 00 00       	push   $0x1000
+f0101c48:	6a 00                	push   $0x0
+f0101c4a:	50                   	push   %eax
+f0101c4b:	e8 2c 5a 00 00       	call   f010767c <memset>
+  kern_pgdir[PDX(UVPT)] = PADDR(kern_pgdir) | PTE_U | PTE_P;
+f0101c50:	a1 0c bf 79 f0       	mov    0xf079bf0c,%eax
+	if ((uint32_t)kva < KERNBASE)
+f0101c55:	83 c4 10             	add    $0x10,%esp
+f0101c58:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0101c5d:	0f 86 80 00 00 00    	jbe    f0101ce3 <mem_init+0x14b>
+	return (physaddr_t)kva - KERNBASE;
+f0101c63:	8d 90 00 00 00 10    	lea    0x10000000(%eax),%edx
+f0101c69:	83 ca 05             	or     $0x5,%edx
+f0101c6c:	89 90 f4 0e 00 00    	mov    %edx,0xef4(%eax)
+  pages = (struct PageInfo *) boot_alloc(sizeof(struct PageInfo) * npages);
+f0101c72:	a1 08 bf 79 f0       	mov    0xf079bf08,%eax
+f0101c77:	c1 e0 03             	shl    $0x3,%eax
+f0101c7a:	e8 a0 f1 ff ff       	call   f0100e1f <boot_alloc>
+f0101c7f:	a3 10 bf 79 f0       	mov    %eax,0xf079bf10
+  memset(pages, 0, sizeof(struct PageInfo) * npages);
+f0101c84:	83 ec 04             	sub    $0x4,%esp
+f0101c87:	8b 3d 08 bf 79 f0    	mov    0xf079bf08,%edi
+f0101c8d:	8d 14 fd 00 00 00 00 	lea    0x0(,%edi,8),%edx
+f0101c94:	52                   	push   %edx
+f0101c95:	6a 00                	push   $0x0
+f0101c97:	50                   	push   %eax
+f0101c98:	e8 df 59 00 00       	call   f010767c <memset>
+  envs = (struct Env *) boot_alloc(sizeof(struct Env) * NENV);
+f0101c9d:	b8 00 40 02 00       	mov    $0x24000,%eax
+f0101ca2:	e8 78 f1 ff ff       	call   f0100e1f <boot_alloc>
+f0101ca7:	a3 48 b2 79 f0       	mov    %eax,0xf079b248
+  memset(envs, 0, sizeof(struct Env) * NENV);
+f0101cac:	83 c4 0c             	add    $0xc,%esp
+f0101caf:	68 00 40 02 00       	push   $0x24000
+f0101cb4:	6a 00                	push   $0x0
+f0101cb6:	50                   	push   %eax
+f0101cb7:	e8 c0 59 00 00       	call   f010767c <memset>
+  page_init();
+f0101cbc:	e8 10 f5 ff ff       	call   f01011d1 <page_init>
+  check_page_free_list(1);
+f0101cc1:	b8 01 00 00 00       	mov    $0x1,%eax
+f0101cc6:	e8 1a f2 ff ff       	call   f0100ee5 <check_page_free_list>
+  if (!pages)
+f0101ccb:	83 c4 10             	add    $0x10,%esp
+f0101cce:	83 3d 10 bf 79 f0 00 	cmpl   $0x0,0xf079bf10
+f0101cd5:	74 21                	je     f0101cf8 <mem_init+0x160>
+  for (pp = page_free_list, nfree = 0; pp; pp = pp->pp_link)
+f0101cd7:	a1 40 b2 79 f0       	mov    0xf079b240,%eax
+f0101cdc:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0101ce1:	eb 31                	jmp    f0101d14 <mem_init+0x17c>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0101ce3:	50                   	push   %eax
+f0101ce4:	68 e8 82 10 f0       	push   $0xf01082e8
+f0101ce9:	68 99 00 00 00       	push   $0x99
+f0101cee:	68 1d 96 10 f0       	push   $0xf010961d
+f0101cf3:	e8 48 e3 ff ff       	call   f0100040 <_panic>
+    panic("'pages' is a null pointer!");
+f0101cf8:	83 ec 04             	sub    $0x4,%esp
+f0101cfb:	68 0d 97 10 f0       	push   $0xf010970d
+f0101d00:	68 db 03 00 00       	push   $0x3db
+f0101d05:	68 1d 96 10 f0       	push   $0xf010961d
+f0101d0a:	e8 31 e3 ff ff       	call   f0100040 <_panic>
+    ++nfree;
+f0101d0f:	83 c3 01             	add    $0x1,%ebx
+  for (pp = page_free_list, nfree = 0; pp; pp = pp->pp_link)
+f0101d12:	8b 00                	mov    (%eax),%eax
+f0101d14:	85 c0                	test   %eax,%eax
+f0101d16:	75 f7                	jne    f0101d0f <mem_init+0x177>
+  assert((pp0 = page_alloc(0)));
+f0101d18:	83 ec 0c             	sub    $0xc,%esp
+f0101d1b:	6a 00                	push   $0x0
+f0101d1d:	e8 8f f5 ff ff       	call   f01012b1 <page_alloc>
+f0101d22:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f0101d25:	83 c4 10             	add    $0x10,%esp
+f0101d28:	85 c0                	test   %eax,%eax
+f0101d2a:	0f 84 fc 01 00 00    	je     f0101f2c <mem_init+0x394>
+  assert((pp1 = page_alloc(0)));
+f0101d30:	83 ec 0c             	sub    $0xc,%esp
+f0101d33:	6a 00                	push   $0x0
+f0101d35:	e8 77 f5 ff ff       	call   f01012b1 <page_alloc>
+f0101d3a:	89 c7                	mov    %eax,%edi
+f0101d3c:	83 c4 10             	add    $0x10,%esp
+f0101d3f:	85 c0                	test   %eax,%eax
+f0101d41:	0f 84 fe 01 00 00    	je     f0101f45 <mem_init+0x3ad>
+  assert((pp2 = page_alloc(0)));
+f0101d47:	83 ec 0c             	sub    $0xc,%esp
+f0101d4a:	6a 00                	push   $0x0
+f0101d4c:	e8 60 f5 ff ff       	call   f01012b1 <page_alloc>
+f0101d51:	89 c6                	mov    %eax,%esi
+f0101d53:	83 c4 10             	add    $0x10,%esp
+f0101d56:	85 c0                	test   %eax,%eax
+f0101d58:	0f 84 00 02 00 00    	je     f0101f5e <mem_init+0x3c6>
+  assert(pp1 && pp1 != pp0);
+f0101d5e:	39 7d d4             	cmp    %edi,-0x2c(%ebp)
+f0101d61:	0f 84 10 02 00 00    	je     f0101f77 <mem_init+0x3df>
+  assert(pp2 && pp2 != pp1 && pp2 != pp0);
+f0101d67:	39 45 d4             	cmp    %eax,-0x2c(%ebp)
+f0101d6a:	0f 84 20 02 00 00    	je     f0101f90 <mem_init+0x3f8>
+f0101d70:	39 c7                	cmp    %eax,%edi
+f0101d72:	0f 84 18 02 00 00    	je     f0101f90 <mem_init+0x3f8>
+	return (pp - pages) << PGSHIFT;
+f0101d78:	8b 0d 10 bf 79 f0    	mov    0xf079bf10,%ecx
+  assert(page2pa(pp0) < npages*PGSIZE);
+f0101d7e:	a1 08 bf 79 f0       	mov    0xf079bf08,%eax
+f0101d83:	c1 e0 0c             	shl    $0xc,%eax
+f0101d86:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+f0101d89:	29 ca                	sub    %ecx,%edx
+f0101d8b:	c1 fa 03             	sar    $0x3,%edx
+f0101d8e:	c1 e2 0c             	shl    $0xc,%edx
+f0101d91:	39 c2                	cmp    %eax,%edx
+f0101d93:	0f 83 10 02 00 00    	jae    f0101fa9 <mem_init+0x411>
+f0101d99:	89 fa                	mov    %edi,%edx
+f0101d9b:	29 ca                	sub    %ecx,%edx
+f0101d9d:	c1 fa 03             	sar    $0x3,%edx
+f0101da0:	c1 e2 0c             	shl    $0xc,%edx
+  assert(page2pa(pp1) < npages*PGSIZE);
+f0101da3:	39 c2                	cmp    %eax,%edx
+f0101da5:	0f 83 17 02 00 00    	jae    f0101fc2 <mem_init+0x42a>
+f0101dab:	89 f2                	mov    %esi,%edx
+f0101dad:	29 ca                	sub    %ecx,%edx
+f0101daf:	c1 fa 03             	sar    $0x3,%edx
+f0101db2:	c1 e2 0c             	shl    $0xc,%edx
+  assert(page2pa(pp2) < npages*PGSIZE);
+f0101db5:	39 c2                	cmp    %eax,%edx
+f0101db7:	0f 83 1e 02 00 00    	jae    f0101fdb <mem_init+0x443>
+  fl = page_free_list;
+f0101dbd:	a1 40 b2 79 f0       	mov    0xf079b240,%eax
+f0101dc2:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  page_free_list = 0;
+f0101dc5:	c7 05 40 b2 79 f0 00 	movl   $0x0,0xf079b240
+f0101dcc:	00 00 00 
+  assert(!page_alloc(0));
+f0101dcf:	83 ec 0c             	sub    $0xc,%esp
+f0101dd2:	6a 00                	push   $0x0
+f0101dd4:	e8 d8 f4 ff ff       	call   f01012b1 <page_alloc>
+f0101dd9:	83 c4 10             	add    $0x10,%esp
+f0101ddc:	85 c0                	test   %eax,%eax
+f0101dde:	0f 85 10 02 00 00    	jne    f0101ff4 <mem_init+0x45c>
+  page_free(pp0);
+f0101de4:	83 ec 0c             	sub    $0xc,%esp
+f0101de7:	ff 75 d4             	push   -0x2c(%ebp)
+f0101dea:	e8 61 f6 ff ff       	call   f0101450 <page_free>
+  page_free(pp1);
+f0101def:	89 3c 24             	mov    %edi,(%esp)
+f0101df2:	e8 59 f6 ff ff       	call   f0101450 <page_free>
+  page_free(pp2);
+f0101df7:	89 34 24             	mov    %esi,(%esp)
+f0101dfa:	e8 51 f6 ff ff       	call   f0101450 <page_free>
+  assert((pp0 = page_alloc(0)));
+f0101dff:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+f0101e06:	e8 a6 f4 ff ff       	call   f01012b1 <page_alloc>
+f0101e0b:	89 c6                	mov    %eax,%esi
+f0101e0d:	83 c4 10             	add    $0x10,%esp
+f0101e10:	85 c0                	test   %eax,%eax
+f0101e12:	0f 84 f5 01 00 00    	je     f010200d <mem_init+0x475>
+  assert((pp1 = page_alloc(0)));
+f0101e18:	83 ec 0c             	sub    $0xc,%esp
+f0101e1b:	6a 00                	push   $0x0
+f0101e1d:	e8 8f f4 ff ff       	call   f01012b1 <page_alloc>
+f0101e22:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f0101e25:	83 c4 10             	add    $0x10,%esp
+f0101e28:	85 c0                	test   %eax,%eax
+f0101e2a:	0f 84 f6 01 00 00    	je     f0102026 <mem_init+0x48e>
+  assert((pp2 = page_alloc(0)));
+f0101e30:	83 ec 0c             	sub    $0xc,%esp
+f0101e33:	6a 00                	push   $0x0
+f0101e35:	e8 77 f4 ff ff       	call   f01012b1 <page_alloc>
+f0101e3a:	89 c7                	mov    %eax,%edi
+f0101e3c:	83 c4 10             	add    $0x10,%esp
+f0101e3f:	85 c0                	test   %eax,%eax
+f0101e41:	0f 84 f8 01 00 00    	je     f010203f <mem_init+0x4a7>
+  assert(pp1 && pp1 != pp0);
+f0101e47:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0101e4a:	39 c6                	cmp    %eax,%esi
+f0101e4c:	0f 84 06 02 00 00    	je     f0102058 <mem_init+0x4c0>
+  assert(pp2 && pp2 != pp1 && pp2 != pp0);
+f0101e52:	39 7d d4             	cmp    %edi,-0x2c(%ebp)
+f0101e55:	0f 84 16 02 00 00    	je     f0102071 <mem_init+0x4d9>
+f0101e5b:	39 fe                	cmp    %edi,%esi
+f0101e5d:	0f 84 0e 02 00 00    	je     f0102071 <mem_init+0x4d9>
+  assert(!page_alloc(0));
+f0101e63:	83 ec 0c             	sub    $0xc,%esp
+f0101e66:	6a 00                	push   $0x0
+f0101e68:	e8 44 f4 ff ff       	call   f01012b1 <page_alloc>
+f0101e6d:	83 c4 10             	add    $0x10,%esp
+f0101e70:	85 c0                	test   %eax,%eax
+f0101e72:	0f 85 12 02 00 00    	jne    f010208a <mem_init+0x4f2>
+f0101e78:	89 f0                	mov    %esi,%eax
+f0101e7a:	2b 05 10 bf 79 f0    	sub    0xf079bf10,%eax
+f0101e80:	c1 f8 03             	sar    $0x3,%eax
+f0101e83:	89 c2                	mov    %eax,%edx
+f0101e85:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f0101e88:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0101e8d:	3b 05 08 bf 79 f0    	cmp    0xf079bf08,%eax
+f0101e93:	0f 83 0a 02 00 00    	jae    f01020a3 <mem_init+0x50b>
+  memset(page2kva(pp0), 1, PGSIZE);
+f0101e99:	83 ec 04             	sub    $0x4,%esp
+f0101e9c:	68 00 10 00 00       	push   $0x1000
+f0101ea1:	6a 01                	push   $0x1
+	return (void *)(pa + KERNBASE);
+f0101ea3:	81 ea 00 00 00 10    	sub    $0x10000000,%edx
+f0101ea9:	52                   	push   %edx
+f0101eaa:	e8 cd 57 00 00       	call   f010767c <memset>
+  page_free(pp0);
+f0101eaf:	89 34 24             	mov    %esi,(%esp)
+f0101eb2:	e8 99 f5 ff ff       	call   f0101450 <page_free>
+  assert((pp = page_alloc(ALLOC_ZERO)));
+f0101eb7:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+f0101ebe:	e8 ee f3 ff ff       	call   f01012b1 <page_alloc>
+f0101ec3:	83 c4 10             	add    $0x10,%esp
+f0101ec6:	85 c0                	test   %eax,%eax
+f0101ec8:	0f 84 e7 01 00 00    	je     f01020b5 <mem_init+0x51d>
+  assert(pp && pp0 == pp);
+f0101ece:	39 c6                	cmp    %eax,%esi
+f0101ed0:	0f 85 f8 01 00 00    	jne    f01020ce <mem_init+0x536>
+	return (pp - pages) << PGSHIFT;
+f0101ed6:	2b 05 10 bf 79 f0    	sub    0xf079bf10,%eax
+f0101edc:	c1 f8 03             	sar    $0x3,%eax
+f0101edf:	89 c1                	mov    %eax,%ecx
+f0101ee1:	c1 e1 0c             	shl    $0xc,%ecx
+	if (PGNUM(pa) >= npages)
+f0101ee4:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0101ee9:	3b 05 08 bf 79 f0    	cmp    0xf079bf08,%eax
+f0101eef:	0f 83 f2 01 00 00    	jae    f01020e7 <mem_init+0x54f>
+	return (void *)(pa + KERNBASE);
+f0101ef5:	8d 81 00 00 00 f0    	lea    -0x10000000(%ecx),%eax
+  for (i = 0; i < PGSIZE; i++)
+f0101efb:	81 e9 00 f0 ff 0f    	sub    $0xffff000,%ecx
+f0101f01:	39 c8                	cmp    %ecx,%eax
+f0101f03:	0f 84 f0 01 00 00    	je     f01020f9 <mem_init+0x561>
+    assert(c[i] == 0);
+f0101f09:	0f b6 10             	movzbl (%eax),%edx
+f0101f0c:	83 c0 01             	add    $0x1,%eax
+f0101f0f:	84 d2                	test   %dl,%dl
+f0101f11:	74 ee                	je     f0101f01 <mem_init+0x369>
+f0101f13:	68 10 98 10 f0       	push   $0xf0109810
+f0101f18:	68 43 96 10 f0       	push   $0xf0109643
+f0101f1d:	68 09 04 00 00       	push   $0x409
+f0101f22:	68 1d 96 10 f0       	push   $0xf010961d
+f0101f27:	e8 14 e1 ff ff       	call   f0100040 <_panic>
+  assert((pp0 = page_alloc(0)));
+f0101f2c:	68 28 97 10 f0       	push   $0xf0109728
+f0101f31:	68 43 96 10 f0       	push   $0xf0109643
+f0101f36:	68 e3 03 00 00       	push   $0x3e3
+f0101f3b:	68 1d 96 10 f0       	push   $0xf010961d
+f0101f40:	e8 fb e0 ff ff       	call   f0100040 <_panic>
+  assert((pp1 = page_alloc(0)));
+f0101f45:	68 3e 97 10 f0       	push   $0xf010973e
+f0101f4a:	68 43 96 10 f0       	push   $0xf0109643
+f0101f4f:	68 e4 03 00 00       	push   $0x3e4
+f0101f54:	68 1d 96 10 f0       	push   $0xf010961d
+f0101f59:	e8 e2 e0 ff ff       	call   f0100040 <_panic>
+  assert((pp2 = page_alloc(0)));
+f0101f5e:	68 54 97 10 f0       	push   $0xf0109754
+f0101f63:	68 43 96 10 f0       	push   $0xf0109643
+f0101f68:	68 e5 03 00 00       	push   $0x3e5
+f0101f6d:	68 1d 96 10 f0       	push   $0xf010961d
+f0101f72:	e8 c9 e0 ff ff       	call   f0100040 <_panic>
+  assert(pp1 && pp1 != pp0);
+f0101f77:	68 6a 97 10 f0       	push   $0xf010976a
+f0101f7c:	68 43 96 10 f0       	push   $0xf0109643
+f0101f81:	68 e8 03 00 00       	push   $0x3e8
+f0101f86:	68 1d 96 10 f0       	push   $0xf010961d
+f0101f8b:	e8 b0 e0 ff ff       	call   f0100040 <_panic>
+  assert(pp2 && pp2 != pp1 && pp2 != pp0);
+f0101f90:	68 50 8e 10 f0       	push   $0xf0108e50
+f0101f95:	68 43 96 10 f0       	push   $0xf0109643
+f0101f9a:	68 e9 03 00 00       	push   $0x3e9
+f0101f9f:	68 1d 96 10 f0       	push   $0xf010961d
+f0101fa4:	e8 97 e0 ff ff       	call   f0100040 <_panic>
+  assert(page2pa(pp0) < npages*PGSIZE);
+f0101fa9:	68 7c 97 10 f0       	push   $0xf010977c
+f0101fae:	68 43 96 10 f0       	push   $0xf0109643
+f0101fb3:	68 ea 03 00 00       	push   $0x3ea
+f0101fb8:	68 1d 96 10 f0       	push   $0xf010961d
+f0101fbd:	e8 7e e0 ff ff       	call   f0100040 <_panic>
+  assert(page2pa(pp1) < npages*PGSIZE);
+f0101fc2:	68 99 97 10 f0       	push   $0xf0109799
+f0101fc7:	68 43 96 10 f0       	push   $0xf0109643
+f0101fcc:	68 eb 03 00 00       	push   $0x3eb
+f0101fd1:	68 1d 96 10 f0       	push   $0xf010961d
+f0101fd6:	e8 65 e0 ff ff       	call   f0100040 <_panic>
+  assert(page2pa(pp2) < npages*PGSIZE);
+f0101fdb:	68 b6 97 10 f0       	push   $0xf01097b6
+f0101fe0:	68 43 96 10 f0       	push   $0xf0109643
+f0101fe5:	68 ec 03 00 00       	push   $0x3ec
+f0101fea:	68 1d 96 10 f0       	push   $0xf010961d
+f0101fef:	e8 4c e0 ff ff       	call   f0100040 <_panic>
+  assert(!page_alloc(0));
+f0101ff4:	68 d3 97 10 f0       	push   $0xf01097d3
+f0101ff9:	68 43 96 10 f0       	push   $0xf0109643
+f0101ffe:	68 f3 03 00 00       	push   $0x3f3
+f0102003:	68 1d 96 10 f0       	push   $0xf010961d
+f0102008:	e8 33 e0 ff ff       	call   f0100040 <_panic>
+  assert((pp0 = page_alloc(0)));
+f010200d:	68 28 97 10 f0       	push   $0xf0109728
+f0102012:	68 43 96 10 f0       	push   $0xf0109643
+f0102017:	68 fa 03 00 00       	push   $0x3fa
+f010201c:	68 1d 96 10 f0       	push   $0xf010961d
+f0102021:	e8 1a e0 ff ff       	call   f0100040 <_panic>
+  assert((pp1 = page_alloc(0)));
+f0102026:	68 3e 97 10 f0       	push   $0xf010973e
+f010202b:	68 43 96 10 f0       	push   $0xf0109643
+f0102030:	68 fb 03 00 00       	push   $0x3fb
+f0102035:	68 1d 96 10 f0       	push   $0xf010961d
+f010203a:	e8 01 e0 ff ff       	call   f0100040 <_panic>
+  assert((pp2 = page_alloc(0)));
+f010203f:	68 54 97 10 f0       	push   $0xf0109754
+f0102044:	68 43 96 10 f0       	push   $0xf0109643
+f0102049:	68 fc 03 00 00       	push   $0x3fc
+f010204e:	68 1d 96 10 f0       	push   $0xf010961d
+f0102053:	e8 e8 df ff ff       	call   f0100040 <_panic>
+  assert(pp1 && pp1 != pp0);
+f0102058:	68 6a 97 10 f0       	push   $0xf010976a
+f010205d:	68 43 96 10 f0       	push   $0xf0109643
+f0102062:	68 fe 03 00 00       	push   $0x3fe
+f0102067:	68 1d 96 10 f0       	push   $0xf010961d
+f010206c:	e8 cf df ff ff       	call   f0100040 <_panic>
+  assert(pp2 && pp2 != pp1 && pp2 != pp0);
+f0102071:	68 50 8e 10 f0       	push   $0xf0108e50
+f0102076:	68 43 96 10 f0       	push   $0xf0109643
+f010207b:	68 ff 03 00 00       	push   $0x3ff
+f0102080:	68 1d 96 10 f0       	push   $0xf010961d
+f0102085:	e8 b6 df ff ff       	call   f0100040 <_panic>
+  assert(!page_alloc(0));
+f010208a:	68 d3 97 10 f0       	push   $0xf01097d3
+f010208f:	68 43 96 10 f0       	push   $0xf0109643
+f0102094:	68 00 04 00 00       	push   $0x400
+f0102099:	68 1d 96 10 f0       	push   $0xf010961d
+f010209e:	e8 9d df ff ff       	call   f0100040 <_panic>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f01020a3:	52                   	push   %edx
+f01020a4:	68 c4 82 10 f0       	push   $0xf01082c4
+f01020a9:	6a 5f                	push   $0x5f
+f01020ab:	68 29 96 10 f0       	push   $0xf0109629
+f01020b0:	e8 8b df ff ff       	call   f0100040 <_panic>
+  assert((pp = page_alloc(ALLOC_ZERO)));
+f01020b5:	68 e2 97 10 f0       	push   $0xf01097e2
+f01020ba:	68 43 96 10 f0       	push   $0xf0109643
+f01020bf:	68 05 04 00 00       	push   $0x405
+f01020c4:	68 1d 96 10 f0       	push   $0xf010961d
+f01020c9:	e8 72 df ff ff       	call   f0100040 <_panic>
+  assert(pp && pp0 == pp);
+f01020ce:	68 00 98 10 f0       	push   $0xf0109800
+f01020d3:	68 43 96 10 f0       	push   $0xf0109643
+f01020d8:	68 06 04 00 00       	push   $0x406
+f01020dd:	68 1d 96 10 f0       	push   $0xf010961d
+f01020e2:	e8 59 df ff ff       	call   f0100040 <_panic>
+f01020e7:	51                   	push   %ecx
+f01020e8:	68 c4 82 10 f0       	push   $0xf01082c4
+f01020ed:	6a 5f                	push   $0x5f
+f01020ef:	68 29 96 10 f0       	push   $0xf0109629
+f01020f4:	e8 47 df ff ff       	call   f0100040 <_panic>
+  page_free_list = fl;
+f01020f9:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f01020fc:	a3 40 b2 79 f0       	mov    %eax,0xf079b240
+  page_free(pp0);
+f0102101:	83 ec 0c             	sub    $0xc,%esp
+f0102104:	56                   	push   %esi
+f0102105:	e8 46 f3 ff ff       	call   f0101450 <page_free>
+  page_free(pp1);
+f010210a:	83 c4 04             	add    $0x4,%esp
+f010210d:	ff 75 d4             	push   -0x2c(%ebp)
+f0102110:	e8 3b f3 ff ff       	call   f0101450 <page_free>
+  page_free(pp2);
+f0102115:	89 3c 24             	mov    %edi,(%esp)
+f0102118:	e8 33 f3 ff ff       	call   f0101450 <page_free>
+  for (pp = page_free_list; pp; pp = pp->pp_link)
+f010211d:	a1 40 b2 79 f0       	mov    0xf079b240,%eax
+f0102122:	83 c4 10             	add    $0x10,%esp
+f0102125:	85 c0                	test   %eax,%eax
+f0102127:	74 07                	je     f0102130 <mem_init+0x598>
+    --nfree;
+f0102129:	83 eb 01             	sub    $0x1,%ebx
+  for (pp = page_free_list; pp; pp = pp->pp_link)
+f010212c:	8b 00                	mov    (%eax),%eax
+f010212e:	eb f5                	jmp    f0102125 <mem_init+0x58d>
+  assert(nfree == 0);
+f0102130:	85 db                	test   %ebx,%ebx
+f0102132:	0f 85 7e 06 00 00    	jne    f01027b6 <mem_init+0xc1e>
+  cprintf("check_page_alloc() succeeded!\n");
+f0102138:	83 ec 0c             	sub    $0xc,%esp
+f010213b:	68 70 8e 10 f0       	push   $0xf0108e70
+f0102140:	e8 e7 22 00 00       	call   f010442c <cprintf>
+  int i;
+  extern pde_t entry_pgdir[];
+
+  // should be able to allocate three pages
+  pp0 = pp1 = pp2 = 0;
+  assert((pp0 = page_alloc(0)));
+f0102145:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+f010214c:	e8 60 f1 ff ff       	call   f01012b1 <page_alloc>
+f0102151:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f0102154:	83 c4 10             	add    $0x10,%esp
+f0102157:	85 c0                	test   %eax,%eax
+f0102159:	0f 84 70 06 00 00    	je     f01027cf <mem_init+0xc37>
+  assert((pp1 = page_alloc(0)));
+f010215f:	83 ec 0c             	sub    $0xc,%esp
+f0102162:	6a 00                	push   $0x0
+f0102164:	e8 48 f1 ff ff       	call   f01012b1 <page_alloc>
+f0102169:	89 c7                	mov    %eax,%edi
+f010216b:	83 c4 10             	add    $0x10,%esp
+f010216e:	85 c0                	test   %eax,%eax
+f0102170:	0f 84 72 06 00 00    	je     f01027e8 <mem_init+0xc50>
+  assert((pp2 = page_alloc(0)));
+f0102176:	83 ec 0c             	sub    $0xc,%esp
+f0102179:	6a 00                	push   $0x0
+f010217b:	e8 31 f1 ff ff       	call   f01012b1 <page_alloc>
+f0102180:	89 c3                	mov    %eax,%ebx
+f0102182:	83 c4 10             	add    $0x10,%esp
+f0102185:	85 c0                	test   %eax,%eax
+f0102187:	0f 84 74 06 00 00    	je     f0102801 <mem_init+0xc69>
+
+  assert(pp0);
+  assert(pp1 && pp1 != pp0);
+f010218d:	39 7d d4             	cmp    %edi,-0x2c(%ebp)
+f0102190:	0f 84 84 06 00 00    	je     f010281a <mem_init+0xc82>
+  assert(pp2 && pp2 != pp1 && pp2 != pp0);
+f0102196:	39 45 d4             	cmp    %eax,-0x2c(%ebp)
+f0102199:	0f 84 94 06 00 00    	je     f0102833 <mem_init+0xc9b>
+f010219f:	39 c7                	cmp    %eax,%edi
+f01021a1:	0f 84 8c 06 00 00    	je     f0102833 <mem_init+0xc9b>
+
+  // temporarily steal the rest of the free pages
+  fl = page_free_list;
+f01021a7:	a1 40 b2 79 f0       	mov    0xf079b240,%eax
+f01021ac:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  page_free_list = 0;
+f01021af:	c7 05 40 b2 79 f0 00 	movl   $0x0,0xf079b240
+f01021b6:	00 00 00 
+
+  // should be no free memory
+  assert(!page_alloc(0));
+f01021b9:	83 ec 0c             	sub    $0xc,%esp
+f01021bc:	6a 00                	push   $0x0
+f01021be:	e8 ee f0 ff ff       	call   f01012b1 <page_alloc>
+f01021c3:	83 c4 10             	add    $0x10,%esp
+f01021c6:	85 c0                	test   %eax,%eax
+f01021c8:	0f 85 7e 06 00 00    	jne    f010284c <mem_init+0xcb4>
+
+  // there is no page allocated at address 0
+  assert(page_lookup(kern_pgdir, (void*)0x0, &ptep) == NULL);
+f01021ce:	83 ec 04             	sub    $0x4,%esp
+f01021d1:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f01021d4:	50                   	push   %eax
+f01021d5:	6a 00                	push   $0x0
+f01021d7:	ff 35 0c bf 79 f0    	push   0xf079bf0c
+f01021dd:	e8 34 f6 ff ff       	call   f0101816 <page_lookup>
+f01021e2:	83 c4 10             	add    $0x10,%esp
+f01021e5:	85 c0                	test   %eax,%eax
+f01021e7:	0f 85 78 06 00 00    	jne    f0102865 <mem_init+0xccd>
+
+  // there is no free memory, so we can't allocate a page table
+  assert(page_insert(kern_pgdir, pp1, 0x0, PTE_W) < 0);
+f01021ed:	6a 02                	push   $0x2
+f01021ef:	6a 00                	push   $0x0
+f01021f1:	57                   	push   %edi
+f01021f2:	ff 35 0c bf 79 f0    	push   0xf079bf0c
+f01021f8:	e8 18 f7 ff ff       	call   f0101915 <page_insert>
+f01021fd:	83 c4 10             	add    $0x10,%esp
+f0102200:	85 c0                	test   %eax,%eax
+f0102202:	0f 89 76 06 00 00    	jns    f010287e <mem_init+0xce6>
+
+  // free pp0 and try again: pp0 should be used for page table
+  page_free(pp0);
+f0102208:	83 ec 0c             	sub    $0xc,%esp
+f010220b:	ff 75 d4             	push   -0x2c(%ebp)
+f010220e:	e8 3d f2 ff ff       	call   f0101450 <page_free>
+  assert(page_insert(kern_pgdir, pp1, 0x0, PTE_W) == 0);
+f0102213:	6a 02                	push   $0x2
+f0102215:	6a 00                	push   $0x0
+f0102217:	57                   	push   %edi
+f0102218:	ff 35 0c bf 79 f0    	push   0xf079bf0c
+f010221e:	e8 f2 f6 ff ff       	call   f0101915 <page_insert>
+f0102223:	83 c4 20             	add    $0x20,%esp
+f0102226:	85 c0                	test   %eax,%eax
+f0102228:	0f 85 69 06 00 00    	jne    f0102897 <mem_init+0xcff>
+  assert(PTE_ADDR(kern_pgdir[0]) == page2pa(pp0));
+f010222e:	8b 35 0c bf 79 f0    	mov    0xf079bf0c,%esi
+	return (pp - pages) << PGSHIFT;
+f0102234:	8b 0d 10 bf 79 f0    	mov    0xf079bf10,%ecx
+f010223a:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+f010223d:	8b 16                	mov    (%esi),%edx
+f010223f:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+f0102245:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0102248:	29 c8                	sub    %ecx,%eax
+f010224a:	c1 f8 03             	sar    $0x3,%eax
+f010224d:	c1 e0 0c             	shl    $0xc,%eax
+f0102250:	39 c2                	cmp    %eax,%edx
+f0102252:	0f 85 58 06 00 00    	jne    f01028b0 <mem_init+0xd18>
+  assert(check_va2pa(kern_pgdir, 0x0) == page2pa(pp1));
+f0102258:	ba 00 00 00 00       	mov    $0x0,%edx
+f010225d:	89 f0                	mov    %esi,%eax
+f010225f:	e8 1e ec ff ff       	call   f0100e82 <check_va2pa>
+f0102264:	89 c2                	mov    %eax,%edx
+f0102266:	89 f8                	mov    %edi,%eax
+f0102268:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+f010226b:	29 c8                	sub    %ecx,%eax
+f010226d:	c1 f8 03             	sar    $0x3,%eax
+f0102270:	c1 e0 0c             	shl    $0xc,%eax
+f0102273:	39 c2                	cmp    %eax,%edx
+f0102275:	0f 85 4e 06 00 00    	jne    f01028c9 <mem_init+0xd31>
+  assert(pp1->pp_ref == 1);
+f010227b:	66 83 7f 04 01       	cmpw   $0x1,0x4(%edi)
+f0102280:	0f 85 5c 06 00 00    	jne    f01028e2 <mem_init+0xd4a>
+  assert(pp0->pp_ref == 1);
+f0102286:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0102289:	66 83 78 04 01       	cmpw   $0x1,0x4(%eax)
+f010228e:	0f 85 67 06 00 00    	jne    f01028fb <mem_init+0xd63>
+
+  // should be able to map pp2 at PGSIZE because pp0 is already allocated for page table
+  assert(page_insert(kern_pgdir, pp2, (void*)PGSIZE, PTE_W) == 0);
+f0102294:	6a 02                	push   $0x2
+f0102296:	68 00 10 00 00       	push   $0x1000
+f010229b:	53                   	push   %ebx
+f010229c:	56                   	push   %esi
+f010229d:	e8 73 f6 ff ff       	call   f0101915 <page_insert>
+f01022a2:	83 c4 10             	add    $0x10,%esp
+f01022a5:	85 c0                	test   %eax,%eax
+f01022a7:	0f 85 67 06 00 00    	jne    f0102914 <mem_init+0xd7c>
+  assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp2));
+f01022ad:	ba 00 10 00 00       	mov    $0x1000,%edx
+f01022b2:	a1 0c bf 79 f0       	mov    0xf079bf0c,%eax
+f01022b7:	e8 c6 eb ff ff       	call   f0100e82 <check_va2pa>
+f01022bc:	89 c2                	mov    %eax,%edx
+f01022be:	89 d8                	mov    %ebx,%eax
+f01022c0:	2b 05 10 bf 79 f0    	sub    0xf079bf10,%eax
+f01022c6:	c1 f8 03             	sar    $0x3,%eax
+f01022c9:	c1 e0 0c             	shl    $0xc,%eax
+f01022cc:	39 c2                	cmp    %eax,%edx
+f01022ce:	0f 85 59 06 00 00    	jne    f010292d <mem_init+0xd95>
+  assert(pp2->pp_ref == 1);
+f01022d4:	66 83 7b 04 01       	cmpw   $0x1,0x4(%ebx)
+f01022d9:	0f 85 67 06 00 00    	jne    f0102946 <mem_init+0xdae>
+
+  // should be no free memory
+  assert(!page_alloc(0));
+f01022df:	83 ec 0c             	sub    $0xc,%esp
+f01022e2:	6a 00                	push   $0x0
+f01022e4:	e8 c8 ef ff ff       	call   f01012b1 <page_alloc>
+f01022e9:	83 c4 10             	add    $0x10,%esp
+f01022ec:	85 c0                	test   %eax,%eax
+f01022ee:	0f 85 6b 06 00 00    	jne    f010295f <mem_init+0xdc7>
+
+  // should be able to map pp2 at PGSIZE because it's already there
+  assert(page_insert(kern_pgdir, pp2, (void*)PGSIZE, PTE_W) == 0);
+f01022f4:	6a 02                	push   $0x2
+f01022f6:	68 00 10 00 00       	push   $0x1000
+f01022fb:	53                   	push   %ebx
+f01022fc:	ff 35 0c bf 79 f0    	push   0xf079bf0c
+f0102302:	e8 0e f6 ff ff       	call   f0101915 <page_insert>
+f0102307:	83 c4 10             	add    $0x10,%esp
+f010230a:	85 c0                	test   %eax,%eax
+f010230c:	0f 85 66 06 00 00    	jne    f0102978 <mem_init+0xde0>
+  assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp2));
+f0102312:	ba 00 10 00 00       	mov    $0x1000,%edx
+f0102317:	a1 0c bf 79 f0       	mov    0xf079bf0c,%eax
+f010231c:	e8 61 eb ff ff       	call   f0100e82 <check_va2pa>
+f0102321:	89 c2                	mov    %eax,%edx
+f0102323:	89 d8                	mov    %ebx,%eax
+f0102325:	2b 05 10 bf 79 f0    	sub    0xf079bf10,%eax
+f010232b:	c1 f8 03             	sar    $0x3,%eax
+f010232e:	c1 e0 0c             	shl    $0xc,%eax
+f0102331:	39 c2                	cmp    %eax,%edx
+f0102333:	0f 85 58 06 00 00    	jne    f0102991 <mem_init+0xdf9>
+  assert(pp2->pp_ref == 1);
+f0102339:	66 83 7b 04 01       	cmpw   $0x1,0x4(%ebx)
+f010233e:	0f 85 66 06 00 00    	jne    f01029aa <mem_init+0xe12>
+
+  // pp2 should NOT be on the free list
+  // could happen in ref counts are handled sloppily in page_insert
+  assert(!page_alloc(0));
+f0102344:	83 ec 0c             	sub    $0xc,%esp
+f0102347:	6a 00                	push   $0x0
+f0102349:	e8 63 ef ff ff       	call   f01012b1 <page_alloc>
+f010234e:	83 c4 10             	add    $0x10,%esp
+f0102351:	85 c0                	test   %eax,%eax
+f0102353:	0f 85 6a 06 00 00    	jne    f01029c3 <mem_init+0xe2b>
+
+  // check that pgdir_walk returns a pointer to the pte
+  ptep = (pte_t*)KADDR(PTE_ADDR(kern_pgdir[PDX(PGSIZE)]));
+f0102359:	8b 15 0c bf 79 f0    	mov    0xf079bf0c,%edx
+f010235f:	8b 02                	mov    (%edx),%eax
+f0102361:	89 c6                	mov    %eax,%esi
+f0102363:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if (PGNUM(pa) >= npages)
+f0102369:	c1 e8 0c             	shr    $0xc,%eax
+f010236c:	3b 05 08 bf 79 f0    	cmp    0xf079bf08,%eax
+f0102372:	0f 83 64 06 00 00    	jae    f01029dc <mem_init+0xe44>
+  assert(pgdir_walk(kern_pgdir, (void*)PGSIZE, 0) == ptep+PTX(PGSIZE));
+f0102378:	83 ec 04             	sub    $0x4,%esp
+f010237b:	6a 00                	push   $0x0
+f010237d:	68 00 10 00 00       	push   $0x1000
+f0102382:	52                   	push   %edx
+f0102383:	e8 32 f3 ff ff       	call   f01016ba <pgdir_walk>
+f0102388:	81 ee fc ff ff 0f    	sub    $0xffffffc,%esi
+f010238e:	83 c4 10             	add    $0x10,%esp
+f0102391:	39 f0                	cmp    %esi,%eax
+f0102393:	0f 85 58 06 00 00    	jne    f01029f1 <mem_init+0xe59>
+
+  // should be able to change permissions too.
+  assert(page_insert(kern_pgdir, pp2, (void*)PGSIZE, PTE_W|PTE_U) == 0);
+f0102399:	6a 06                	push   $0x6
+f010239b:	68 00 10 00 00       	push   $0x1000
+f01023a0:	53                   	push   %ebx
+f01023a1:	ff 35 0c bf 79 f0    	push   0xf079bf0c
+f01023a7:	e8 69 f5 ff ff       	call   f0101915 <page_insert>
+f01023ac:	83 c4 10             	add    $0x10,%esp
+f01023af:	85 c0                	test   %eax,%eax
+f01023b1:	0f 85 53 06 00 00    	jne    f0102a0a <mem_init+0xe72>
+  assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp2));
+f01023b7:	8b 35 0c bf 79 f0    	mov    0xf079bf0c,%esi
+f01023bd:	ba 00 10 00 00       	mov    $0x1000,%edx
+f01023c2:	89 f0                	mov    %esi,%eax
+f01023c4:	e8 b9 ea ff ff       	call   f0100e82 <check_va2pa>
+f01023c9:	89 c2                	mov    %eax,%edx
+	return (pp - pages) << PGSHIFT;
+f01023cb:	89 d8                	mov    %ebx,%eax
+f01023cd:	2b 05 10 bf 79 f0    	sub    0xf079bf10,%eax
+f01023d3:	c1 f8 03             	sar    $0x3,%eax
+f01023d6:	c1 e0 0c             	shl    $0xc,%eax
+f01023d9:	39 c2                	cmp    %eax,%edx
+f01023db:	0f 85 42 06 00 00    	jne    f0102a23 <mem_init+0xe8b>
+  assert(pp2->pp_ref == 1);
+f01023e1:	66 83 7b 04 01       	cmpw   $0x1,0x4(%ebx)
+f01023e6:	0f 85 50 06 00 00    	jne    f0102a3c <mem_init+0xea4>
+  assert(*pgdir_walk(kern_pgdir, (void*)PGSIZE, 0) & PTE_U);
+f01023ec:	83 ec 04             	sub    $0x4,%esp
+f01023ef:	6a 00                	push   $0x0
+f01023f1:	68 00 10 00 00       	push   $0x1000
+f01023f6:	56                   	push   %esi
+f01023f7:	e8 be f2 ff ff       	call   f01016ba <pgdir_walk>
+f01023fc:	83 c4 10             	add    $0x10,%esp
+f01023ff:	f6 00 04             	testb  $0x4,(%eax)
+f0102402:	0f 84 4d 06 00 00    	je     f0102a55 <mem_init+0xebd>
+  assert(kern_pgdir[0] & PTE_U);
+f0102408:	a1 0c bf 79 f0       	mov    0xf079bf0c,%eax
+f010240d:	f6 00 04             	testb  $0x4,(%eax)
+f0102410:	0f 84 58 06 00 00    	je     f0102a6e <mem_init+0xed6>
+
+  // should be able to remap with fewer permissions
+  assert(page_insert(kern_pgdir, pp2, (void*)PGSIZE, PTE_W) == 0);
+f0102416:	6a 02                	push   $0x2
+f0102418:	68 00 10 00 00       	push   $0x1000
+f010241d:	53                   	push   %ebx
+f010241e:	50                   	push   %eax
+f010241f:	e8 f1 f4 ff ff       	call   f0101915 <page_insert>
+f0102424:	83 c4 10             	add    $0x10,%esp
+f0102427:	85 c0                	test   %eax,%eax
+f0102429:	0f 85 58 06 00 00    	jne    f0102a87 <mem_init+0xeef>
+  assert(*pgdir_walk(kern_pgdir, (void*)PGSIZE, 0) & PTE_W);
+f010242f:	83 ec 04             	sub    $0x4,%esp
+f0102432:	6a 00                	push   $0x0
+f0102434:	68 00 10 00 00       	push   $0x1000
+f0102439:	ff 35 0c bf 79 f0    	push   0xf079bf0c
+f010243f:	e8 76 f2 ff ff       	call   f01016ba <pgdir_walk>
+f0102444:	83 c4 10             	add    $0x10,%esp
+f0102447:	f6 00 02             	testb  $0x2,(%eax)
+f010244a:	0f 84 50 06 00 00    	je     f0102aa0 <mem_init+0xf08>
+  assert(!(*pgdir_walk(kern_pgdir, (void*)PGSIZE, 0) & PTE_U));
+f0102450:	83 ec 04             	sub    $0x4,%esp
+f0102453:	6a 00                	push   $0x0
+f0102455:	68 00 10 00 00       	push   $0x1000
+f010245a:	ff 35 0c bf 79 f0    	push   0xf079bf0c
+f0102460:	e8 55 f2 ff ff       	call   f01016ba <pgdir_walk>
+f0102465:	83 c4 10             	add    $0x10,%esp
+f0102468:	f6 00 04             	testb  $0x4,(%eax)
+f010246b:	0f 85 48 06 00 00    	jne    f0102ab9 <mem_init+0xf21>
+
+  // should not be able to map at PTSIZE because need free page for page table
+  assert(page_insert(kern_pgdir, pp0, (void*)PTSIZE, PTE_W) < 0);
+f0102471:	6a 02                	push   $0x2
+f0102473:	68 00 00 40 00       	push   $0x400000
+f0102478:	ff 75 d4             	push   -0x2c(%ebp)
+f010247b:	ff 35 0c bf 79 f0    	push   0xf079bf0c
+f0102481:	e8 8f f4 ff ff       	call   f0101915 <page_insert>
+f0102486:	83 c4 10             	add    $0x10,%esp
+f0102489:	85 c0                	test   %eax,%eax
+f010248b:	0f 89 41 06 00 00    	jns    f0102ad2 <mem_init+0xf3a>
+
+  // insert pp1 at PGSIZE (replacing pp2)
+  assert(page_insert(kern_pgdir, pp1, (void*)PGSIZE, PTE_W) == 0);
+f0102491:	6a 02                	push   $0x2
+f0102493:	68 00 10 00 00       	push   $0x1000
+f0102498:	57                   	push   %edi
+f0102499:	ff 35 0c bf 79 f0    	push   0xf079bf0c
+f010249f:	e8 71 f4 ff ff       	call   f0101915 <page_insert>
+f01024a4:	83 c4 10             	add    $0x10,%esp
+f01024a7:	85 c0                	test   %eax,%eax
+f01024a9:	0f 85 3c 06 00 00    	jne    f0102aeb <mem_init+0xf53>
+  assert(!(*pgdir_walk(kern_pgdir, (void*)PGSIZE, 0) & PTE_U));
+f01024af:	83 ec 04             	sub    $0x4,%esp
+f01024b2:	6a 00                	push   $0x0
+f01024b4:	68 00 10 00 00       	push   $0x1000
+f01024b9:	ff 35 0c bf 79 f0    	push   0xf079bf0c
+f01024bf:	e8 f6 f1 ff ff       	call   f01016ba <pgdir_walk>
+f01024c4:	83 c4 10             	add    $0x10,%esp
+f01024c7:	f6 00 04             	testb  $0x4,(%eax)
+f01024ca:	0f 85 34 06 00 00    	jne    f0102b04 <mem_init+0xf6c>
+
+  // should have pp1 at both 0 and PGSIZE, pp2 nowhere, ...
+  assert(check_va2pa(kern_pgdir, 0) == page2pa(pp1));
+f01024d0:	a1 0c bf 79 f0       	mov    0xf079bf0c,%eax
+f01024d5:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f01024d8:	ba 00 00 00 00       	mov    $0x0,%edx
+f01024dd:	e8 a0 e9 ff ff       	call   f0100e82 <check_va2pa>
+f01024e2:	89 fe                	mov    %edi,%esi
+f01024e4:	2b 35 10 bf 79 f0    	sub    0xf079bf10,%esi
+f01024ea:	c1 fe 03             	sar    $0x3,%esi
+f01024ed:	c1 e6 0c             	shl    $0xc,%esi
+f01024f0:	39 f0                	cmp    %esi,%eax
+f01024f2:	0f 85 25 06 00 00    	jne    f0102b1d <mem_init+0xf85>
+  assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp1));
+f01024f8:	ba 00 10 00 00       	mov    $0x1000,%edx
+f01024fd:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f0102500:	e8 7d e9 ff ff       	call   f0100e82 <check_va2pa>
+f0102505:	39 c6                	cmp    %eax,%esi
+f0102507:	0f 85 29 06 00 00    	jne    f0102b36 <mem_init+0xf9e>
+  // ... and ref counts should reflect this
+  assert(pp1->pp_ref == 2);
+f010250d:	66 83 7f 04 02       	cmpw   $0x2,0x4(%edi)
+f0102512:	0f 85 37 06 00 00    	jne    f0102b4f <mem_init+0xfb7>
+  assert(pp2->pp_ref == 0);
+f0102518:	66 83 7b 04 00       	cmpw   $0x0,0x4(%ebx)
+f010251d:	0f 85 45 06 00 00    	jne    f0102b68 <mem_init+0xfd0>
+
+  // pp2 should be returned by page_alloc
+  assert((pp = page_alloc(0)) && pp == pp2);
+f0102523:	83 ec 0c             	sub    $0xc,%esp
+f0102526:	6a 00                	push   $0x0
+f0102528:	e8 84 ed ff ff       	call   f01012b1 <page_alloc>
+f010252d:	83 c4 10             	add    $0x10,%esp
+f0102530:	85 c0                	test   %eax,%eax
+f0102532:	0f 84 49 06 00 00    	je     f0102b81 <mem_init+0xfe9>
+f0102538:	39 c3                	cmp    %eax,%ebx
+f010253a:	0f 85 41 06 00 00    	jne    f0102b81 <mem_init+0xfe9>
+
+  // unmapping pp1 at 0 should keep pp1 at PGSIZE
+  page_remove(kern_pgdir, 0x0);
+f0102540:	83 ec 08             	sub    $0x8,%esp
+f0102543:	6a 00                	push   $0x0
+f0102545:	ff 35 0c bf 79 f0    	push   0xf079bf0c
+f010254b:	e8 59 f3 ff ff       	call   f01018a9 <page_remove>
+  assert(check_va2pa(kern_pgdir, 0x0) == ~0);
+f0102550:	8b 35 0c bf 79 f0    	mov    0xf079bf0c,%esi
+f0102556:	ba 00 00 00 00       	mov    $0x0,%edx
+f010255b:	89 f0                	mov    %esi,%eax
+f010255d:	e8 20 e9 ff ff       	call   f0100e82 <check_va2pa>
+f0102562:	83 c4 10             	add    $0x10,%esp
+f0102565:	83 f8 ff             	cmp    $0xffffffff,%eax
+f0102568:	0f 85 2c 06 00 00    	jne    f0102b9a <mem_init+0x1002>
+  assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp1));
+f010256e:	ba 00 10 00 00       	mov    $0x1000,%edx
+f0102573:	89 f0                	mov    %esi,%eax
+f0102575:	e8 08 e9 ff ff       	call   f0100e82 <check_va2pa>
+f010257a:	89 c2                	mov    %eax,%edx
+f010257c:	89 f8                	mov    %edi,%eax
+f010257e:	2b 05 10 bf 79 f0    	sub    0xf079bf10,%eax
+f0102584:	c1 f8 03             	sar    $0x3,%eax
+f0102587:	c1 e0 0c             	shl    $0xc,%eax
+f010258a:	39 c2                	cmp    %eax,%edx
+f010258c:	0f 85 21 06 00 00    	jne    f0102bb3 <mem_init+0x101b>
+  assert(pp1->pp_ref == 1);
+f0102592:	66 83 7f 04 01       	cmpw   $0x1,0x4(%edi)
+f0102597:	0f 85 2f 06 00 00    	jne    f0102bcc <mem_init+0x1034>
+  assert(pp2->pp_ref == 0);
+f010259d:	66 83 7b 04 00       	cmpw   $0x0,0x4(%ebx)
+f01025a2:	0f 85 3d 06 00 00    	jne    f0102be5 <mem_init+0x104d>
+
+  // test re-inserting pp1 at PGSIZE
+  assert(page_insert(kern_pgdir, pp1, (void*)PGSIZE, 0) == 0);
+f01025a8:	6a 00                	push   $0x0
+f01025aa:	68 00 10 00 00       	push   $0x1000
+f01025af:	57                   	push   %edi
+f01025b0:	56                   	push   %esi
+f01025b1:	e8 5f f3 ff ff       	call   f0101915 <page_insert>
+f01025b6:	83 c4 10             	add    $0x10,%esp
+f01025b9:	85 c0                	test   %eax,%eax
+f01025bb:	0f 85 3d 06 00 00    	jne    f0102bfe <mem_init+0x1066>
+  assert(pp1->pp_ref);
+f01025c1:	66 83 7f 04 00       	cmpw   $0x0,0x4(%edi)
+f01025c6:	0f 84 4b 06 00 00    	je     f0102c17 <mem_init+0x107f>
+  assert(pp1->pp_link == NULL);
+f01025cc:	83 3f 00             	cmpl   $0x0,(%edi)
+f01025cf:	0f 85 5b 06 00 00    	jne    f0102c30 <mem_init+0x1098>
+
+  // unmapping pp1 at PGSIZE should free it
+  page_remove(kern_pgdir, (void*)PGSIZE);
+f01025d5:	83 ec 08             	sub    $0x8,%esp
+f01025d8:	68 00 10 00 00       	push   $0x1000
+f01025dd:	ff 35 0c bf 79 f0    	push   0xf079bf0c
+f01025e3:	e8 c1 f2 ff ff       	call   f01018a9 <page_remove>
+  assert(check_va2pa(kern_pgdir, 0x0) == ~0);
+f01025e8:	8b 35 0c bf 79 f0    	mov    0xf079bf0c,%esi
+f01025ee:	ba 00 00 00 00       	mov    $0x0,%edx
+f01025f3:	89 f0                	mov    %esi,%eax
+f01025f5:	e8 88 e8 ff ff       	call   f0100e82 <check_va2pa>
+f01025fa:	83 c4 10             	add    $0x10,%esp
+f01025fd:	83 f8 ff             	cmp    $0xffffffff,%eax
+f0102600:	0f 85 43 06 00 00    	jne    f0102c49 <mem_init+0x10b1>
+  assert(check_va2pa(kern_pgdir, PGSIZE) == ~0);
+f0102606:	ba 00 10 00 00       	mov    $0x1000,%edx
+f010260b:	89 f0                	mov    %esi,%eax
+f010260d:	e8 70 e8 ff ff       	call   f0100e82 <check_va2pa>
+f0102612:	83 f8 ff             	cmp    $0xffffffff,%eax
+f0102615:	0f 85 47 06 00 00    	jne    f0102c62 <mem_init+0x10ca>
+  assert(pp1->pp_ref == 0);
+f010261b:	66 83 7f 04 00       	cmpw   $0x0,0x4(%edi)
+f0102620:	0f 85 55 06 00 00    	jne    f0102c7b <mem_init+0x10e3>
+  assert(pp2->pp_ref == 0);
+f0102626:	66 83 7b 04 00       	cmpw   $0x0,0x4(%ebx)
+f010262b:	0f 85 63 06 00 00    	jne    f0102c94 <mem_init+0x10fc>
+
+  // so it should be returned by page_alloc
+  assert((pp = page_alloc(0)) && pp == pp1);
+f0102631:	83 ec 0c             	sub    $0xc,%esp
+f0102634:	6a 00                	push   $0x0
+f0102636:	e8 76 ec ff ff       	call   f01012b1 <page_alloc>
+f010263b:	83 c4 10             	add    $0x10,%esp
+f010263e:	39 c7                	cmp    %eax,%edi
+f0102640:	0f 85 67 06 00 00    	jne    f0102cad <mem_init+0x1115>
+f0102646:	85 c0                	test   %eax,%eax
+f0102648:	0f 84 5f 06 00 00    	je     f0102cad <mem_init+0x1115>
+
+  // should be no free memory
+  assert(!page_alloc(0));
+f010264e:	83 ec 0c             	sub    $0xc,%esp
+f0102651:	6a 00                	push   $0x0
+f0102653:	e8 59 ec ff ff       	call   f01012b1 <page_alloc>
+f0102658:	83 c4 10             	add    $0x10,%esp
+f010265b:	85 c0                	test   %eax,%eax
+f010265d:	0f 85 63 06 00 00    	jne    f0102cc6 <mem_init+0x112e>
+
+  // forcibly take pp0 back
+  assert(PTE_ADDR(kern_pgdir[0]) == page2pa(pp0));
+f0102663:	8b 0d 0c bf 79 f0    	mov    0xf079bf0c,%ecx
+f0102669:	8b 11                	mov    (%ecx),%edx
+f010266b:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+f0102671:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0102674:	2b 05 10 bf 79 f0    	sub    0xf079bf10,%eax
+f010267a:	c1 f8 03             	sar    $0x3,%eax
+f010267d:	c1 e0 0c             	shl    $0xc,%eax
+f0102680:	39 c2                	cmp    %eax,%edx
+f0102682:	0f 85 57 06 00 00    	jne    f0102cdf <mem_init+0x1147>
+  kern_pgdir[0] = 0;
+f0102688:	c7 01 00 00 00 00    	movl   $0x0,(%ecx)
+  assert(pp0->pp_ref == 1);
+f010268e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0102691:	66 83 78 04 01       	cmpw   $0x1,0x4(%eax)
+f0102696:	0f 85 5c 06 00 00    	jne    f0102cf8 <mem_init+0x1160>
+  pp0->pp_ref = 0;
+f010269c:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f010269f:	66 c7 40 04 00 00    	movw   $0x0,0x4(%eax)
+
+  // check pointer arithmetic in pgdir_walk
+  page_free(pp0);
+f01026a5:	83 ec 0c             	sub    $0xc,%esp
+f01026a8:	50                   	push   %eax
+f01026a9:	e8 a2 ed ff ff       	call   f0101450 <page_free>
+  va = (void*)(PGSIZE * NPDENTRIES + PGSIZE);
+  ptep = pgdir_walk(kern_pgdir, va, 1);
+f01026ae:	83 c4 0c             	add    $0xc,%esp
+f01026b1:	6a 01                	push   $0x1
+f01026b3:	68 00 10 40 00       	push   $0x401000
+f01026b8:	ff 35 0c bf 79 f0    	push   0xf079bf0c
+f01026be:	e8 f7 ef ff ff       	call   f01016ba <pgdir_walk>
+f01026c3:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  ptep1 = (pte_t*)KADDR(PTE_ADDR(kern_pgdir[PDX(va)]));
+f01026c6:	8b 0d 0c bf 79 f0    	mov    0xf079bf0c,%ecx
+f01026cc:	8b 41 04             	mov    0x4(%ecx),%eax
+f01026cf:	89 c6                	mov    %eax,%esi
+f01026d1:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if (PGNUM(pa) >= npages)
+f01026d7:	8b 15 08 bf 79 f0    	mov    0xf079bf08,%edx
+f01026dd:	c1 e8 0c             	shr    $0xc,%eax
+f01026e0:	83 c4 10             	add    $0x10,%esp
+f01026e3:	39 d0                	cmp    %edx,%eax
+f01026e5:	0f 83 26 06 00 00    	jae    f0102d11 <mem_init+0x1179>
+  assert(ptep == ptep1 + PTX(va));
+f01026eb:	81 ee fc ff ff 0f    	sub    $0xffffffc,%esi
+f01026f1:	39 75 d0             	cmp    %esi,-0x30(%ebp)
+f01026f4:	0f 85 2c 06 00 00    	jne    f0102d26 <mem_init+0x118e>
+  kern_pgdir[PDX(va)] = 0;
+f01026fa:	c7 41 04 00 00 00 00 	movl   $0x0,0x4(%ecx)
+  pp0->pp_ref = 0;
+f0102701:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0102704:	66 c7 40 04 00 00    	movw   $0x0,0x4(%eax)
+	return (pp - pages) << PGSHIFT;
+f010270a:	2b 05 10 bf 79 f0    	sub    0xf079bf10,%eax
+f0102710:	c1 f8 03             	sar    $0x3,%eax
+f0102713:	89 c1                	mov    %eax,%ecx
+f0102715:	c1 e1 0c             	shl    $0xc,%ecx
+	if (PGNUM(pa) >= npages)
+f0102718:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f010271d:	39 d0                	cmp    %edx,%eax
+f010271f:	0f 83 1a 06 00 00    	jae    f0102d3f <mem_init+0x11a7>
+
+  // check that new page tables get cleared
+  memset(page2kva(pp0), 0xFF, PGSIZE);
+f0102725:	83 ec 04             	sub    $0x4,%esp
+f0102728:	68 00 10 00 00       	push   $0x1000
+f010272d:	68 ff 00 00 00       	push   $0xff
+	return (void *)(pa + KERNBASE);
+f0102732:	81 e9 00 00 00 10    	sub    $0x10000000,%ecx
+f0102738:	51                   	push   %ecx
+f0102739:	e8 3e 4f 00 00       	call   f010767c <memset>
+  page_free(pp0);
+f010273e:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+f0102741:	89 34 24             	mov    %esi,(%esp)
+f0102744:	e8 07 ed ff ff       	call   f0101450 <page_free>
+  pgdir_walk(kern_pgdir, 0x0, 1);
+f0102749:	83 c4 0c             	add    $0xc,%esp
+f010274c:	6a 01                	push   $0x1
+f010274e:	6a 00                	push   $0x0
+f0102750:	ff 35 0c bf 79 f0    	push   0xf079bf0c
+f0102756:	e8 5f ef ff ff       	call   f01016ba <pgdir_walk>
+	return (pp - pages) << PGSHIFT;
+f010275b:	89 f0                	mov    %esi,%eax
+f010275d:	2b 05 10 bf 79 f0    	sub    0xf079bf10,%eax
+f0102763:	c1 f8 03             	sar    $0x3,%eax
+f0102766:	89 c1                	mov    %eax,%ecx
+f0102768:	c1 e1 0c             	shl    $0xc,%ecx
+	if (PGNUM(pa) >= npages)
+f010276b:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0102770:	83 c4 10             	add    $0x10,%esp
+f0102773:	3b 05 08 bf 79 f0    	cmp    0xf079bf08,%eax
+f0102779:	0f 83 d2 05 00 00    	jae    f0102d51 <mem_init+0x11b9>
+	return (void *)(pa + KERNBASE);
+f010277f:	8d 81 00 00 00 f0    	lea    -0x10000000(%ecx),%eax
+  ptep = (pte_t*)page2kva(pp0);
+  for (i = 0; i < NPTENTRIES; i++)
+f0102785:	81 e9 00 f0 ff 0f    	sub    $0xffff000,%ecx
+f010278b:	39 c8                	cmp    %ecx,%eax
+f010278d:	0f 84 d0 05 00 00    	je     f0102d63 <mem_init+0x11cb>
+    assert((ptep[i] & PTE_P) == 0);
+f0102793:	8b 10                	mov    (%eax),%edx
+f0102795:	83 c0 04             	add    $0x4,%eax
+f0102798:	f6 c2 01             	test   $0x1,%dl
+f010279b:	74 ee                	je     f010278b <mem_init+0xbf3>
+f010279d:	68 da 98 10 f0       	push   $0xf01098da
+f01027a2:	68 43 96 10 f0       	push   $0xf0109643
+f01027a7:	68 fa 04 00 00       	push   $0x4fa
+f01027ac:	68 1d 96 10 f0       	push   $0xf010961d
+f01027b1:	e8 8a d8 ff ff       	call   f0100040 <_panic>
+  assert(nfree == 0);
+f01027b6:	68 1a 98 10 f0       	push   $0xf010981a
+f01027bb:	68 43 96 10 f0       	push   $0xf0109643
+f01027c0:	68 16 04 00 00       	push   $0x416
+f01027c5:	68 1d 96 10 f0       	push   $0xf010961d
+f01027ca:	e8 71 d8 ff ff       	call   f0100040 <_panic>
+  assert((pp0 = page_alloc(0)));
+f01027cf:	68 28 97 10 f0       	push   $0xf0109728
+f01027d4:	68 43 96 10 f0       	push   $0xf0109643
+f01027d9:	68 7d 04 00 00       	push   $0x47d
+f01027de:	68 1d 96 10 f0       	push   $0xf010961d
+f01027e3:	e8 58 d8 ff ff       	call   f0100040 <_panic>
+  assert((pp1 = page_alloc(0)));
+f01027e8:	68 3e 97 10 f0       	push   $0xf010973e
+f01027ed:	68 43 96 10 f0       	push   $0xf0109643
+f01027f2:	68 7e 04 00 00       	push   $0x47e
+f01027f7:	68 1d 96 10 f0       	push   $0xf010961d
+f01027fc:	e8 3f d8 ff ff       	call   f0100040 <_panic>
+  assert((pp2 = page_alloc(0)));
+f0102801:	68 54 97 10 f0       	push   $0xf0109754
+f0102806:	68 43 96 10 f0       	push   $0xf0109643
+f010280b:	68 7f 04 00 00       	push   $0x47f
+f0102810:	68 1d 96 10 f0       	push   $0xf010961d
+f0102815:	e8 26 d8 ff ff       	call   f0100040 <_panic>
+  assert(pp1 && pp1 != pp0);
+f010281a:	68 6a 97 10 f0       	push   $0xf010976a
+f010281f:	68 43 96 10 f0       	push   $0xf0109643
+f0102824:	68 82 04 00 00       	push   $0x482
+f0102829:	68 1d 96 10 f0       	push   $0xf010961d
+f010282e:	e8 0d d8 ff ff       	call   f0100040 <_panic>
+  assert(pp2 && pp2 != pp1 && pp2 != pp0);
+f0102833:	68 50 8e 10 f0       	push   $0xf0108e50
+f0102838:	68 43 96 10 f0       	push   $0xf0109643
+f010283d:	68 83 04 00 00       	push   $0x483
+f0102842:	68 1d 96 10 f0       	push   $0xf010961d
+f0102847:	e8 f4 d7 ff ff       	call   f0100040 <_panic>
+  assert(!page_alloc(0));
+f010284c:	68 d3 97 10 f0       	push   $0xf01097d3
+f0102851:	68 43 96 10 f0       	push   $0xf0109643
+f0102856:	68 8a 04 00 00       	push   $0x48a
+f010285b:	68 1d 96 10 f0       	push   $0xf010961d
+f0102860:	e8 db d7 ff ff       	call   f0100040 <_panic>
+  assert(page_lookup(kern_pgdir, (void*)0x0, &ptep) == NULL);
+f0102865:	68 90 8e 10 f0       	push   $0xf0108e90
+f010286a:	68 43 96 10 f0       	push   $0xf0109643
+f010286f:	68 8d 04 00 00       	push   $0x48d
+f0102874:	68 1d 96 10 f0       	push   $0xf010961d
+f0102879:	e8 c2 d7 ff ff       	call   f0100040 <_panic>
+  assert(page_insert(kern_pgdir, pp1, 0x0, PTE_W) < 0);
+f010287e:	68 c4 8e 10 f0       	push   $0xf0108ec4
+f0102883:	68 43 96 10 f0       	push   $0xf0109643
+f0102888:	68 90 04 00 00       	push   $0x490
+f010288d:	68 1d 96 10 f0       	push   $0xf010961d
+f0102892:	e8 a9 d7 ff ff       	call   f0100040 <_panic>
+  assert(page_insert(kern_pgdir, pp1, 0x0, PTE_W) == 0);
+f0102897:	68 f4 8e 10 f0       	push   $0xf0108ef4
+f010289c:	68 43 96 10 f0       	push   $0xf0109643
+f01028a1:	68 94 04 00 00       	push   $0x494
+f01028a6:	68 1d 96 10 f0       	push   $0xf010961d
+f01028ab:	e8 90 d7 ff ff       	call   f0100040 <_panic>
+  assert(PTE_ADDR(kern_pgdir[0]) == page2pa(pp0));
+f01028b0:	68 24 8f 10 f0       	push   $0xf0108f24
+f01028b5:	68 43 96 10 f0       	push   $0xf0109643
+f01028ba:	68 95 04 00 00       	push   $0x495
+f01028bf:	68 1d 96 10 f0       	push   $0xf010961d
+f01028c4:	e8 77 d7 ff ff       	call   f0100040 <_panic>
+  assert(check_va2pa(kern_pgdir, 0x0) == page2pa(pp1));
+f01028c9:	68 4c 8f 10 f0       	push   $0xf0108f4c
+f01028ce:	68 43 96 10 f0       	push   $0xf0109643
+f01028d3:	68 96 04 00 00       	push   $0x496
+f01028d8:	68 1d 96 10 f0       	push   $0xf010961d
+f01028dd:	e8 5e d7 ff ff       	call   f0100040 <_panic>
+  assert(pp1->pp_ref == 1);
+f01028e2:	68 25 98 10 f0       	push   $0xf0109825
+f01028e7:	68 43 96 10 f0       	push   $0xf0109643
+f01028ec:	68 97 04 00 00       	push   $0x497
+f01028f1:	68 1d 96 10 f0       	push   $0xf010961d
+f01028f6:	e8 45 d7 ff ff       	call   f0100040 <_panic>
+  assert(pp0->pp_ref == 1);
+f01028fb:	68 36 98 10 f0       	push   $0xf0109836
+f0102900:	68 43 96 10 f0       	push   $0xf0109643
+f0102905:	68 98 04 00 00       	push   $0x498
+f010290a:	68 1d 96 10 f0       	push   $0xf010961d
+f010290f:	e8 2c d7 ff ff       	call   f0100040 <_panic>
+  assert(page_insert(kern_pgdir, pp2, (void*)PGSIZE, PTE_W) == 0);
+f0102914:	68 7c 8f 10 f0       	push   $0xf0108f7c
+f0102919:	68 43 96 10 f0       	push   $0xf0109643
+f010291e:	68 9b 04 00 00       	push   $0x49b
+f0102923:	68 1d 96 10 f0       	push   $0xf010961d
+f0102928:	e8 13 d7 ff ff       	call   f0100040 <_panic>
+  assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp2));
+f010292d:	68 b4 8f 10 f0       	push   $0xf0108fb4
+f0102932:	68 43 96 10 f0       	push   $0xf0109643
+f0102937:	68 9c 04 00 00       	push   $0x49c
+f010293c:	68 1d 96 10 f0       	push   $0xf010961d
+f0102941:	e8 fa d6 ff ff       	call   f0100040 <_panic>
+  assert(pp2->pp_ref == 1);
+f0102946:	68 47 98 10 f0       	push   $0xf0109847
+f010294b:	68 43 96 10 f0       	push   $0xf0109643
+f0102950:	68 9d 04 00 00       	push   $0x49d
+f0102955:	68 1d 96 10 f0       	push   $0xf010961d
+f010295a:	e8 e1 d6 ff ff       	call   f0100040 <_panic>
+  assert(!page_alloc(0));
+f010295f:	68 d3 97 10 f0       	push   $0xf01097d3
+f0102964:	68 43 96 10 f0       	push   $0xf0109643
+f0102969:	68 a0 04 00 00       	push   $0x4a0
+f010296e:	68 1d 96 10 f0       	push   $0xf010961d
+f0102973:	e8 c8 d6 ff ff       	call   f0100040 <_panic>
+  assert(page_insert(kern_pgdir, pp2, (void*)PGSIZE, PTE_W) == 0);
+f0102978:	68 7c 8f 10 f0       	push   $0xf0108f7c
+f010297d:	68 43 96 10 f0       	push   $0xf0109643
+f0102982:	68 a3 04 00 00       	push   $0x4a3
+f0102987:	68 1d 96 10 f0       	push   $0xf010961d
+f010298c:	e8 af d6 ff ff       	call   f0100040 <_panic>
+  assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp2));
+f0102991:	68 b4 8f 10 f0       	push   $0xf0108fb4
+f0102996:	68 43 96 10 f0       	push   $0xf0109643
+f010299b:	68 a4 04 00 00       	push   $0x4a4
+f01029a0:	68 1d 96 10 f0       	push   $0xf010961d
+f01029a5:	e8 96 d6 ff ff       	call   f0100040 <_panic>
+  assert(pp2->pp_ref == 1);
+f01029aa:	68 47 98 10 f0       	push   $0xf0109847
+f01029af:	68 43 96 10 f0       	push   $0xf0109643
+f01029b4:	68 a5 04 00 00       	push   $0x4a5
+f01029b9:	68 1d 96 10 f0       	push   $0xf010961d
+f01029be:	e8 7d d6 ff ff       	call   f0100040 <_panic>
+  assert(!page_alloc(0));
+f01029c3:	68 d3 97 10 f0       	push   $0xf01097d3
+f01029c8:	68 43 96 10 f0       	push   $0xf0109643
+f01029cd:	68 a9 04 00 00       	push   $0x4a9
+f01029d2:	68 1d 96 10 f0       	push   $0xf010961d
+f01029d7:	e8 64 d6 ff ff       	call   f0100040 <_panic>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f01029dc:	56                   	push   %esi
+f01029dd:	68 c4 82 10 f0       	push   $0xf01082c4
+f01029e2:	68 ac 04 00 00       	push   $0x4ac
+f01029e7:	68 1d 96 10 f0       	push   $0xf010961d
+f01029ec:	e8 4f d6 ff ff       	call   f0100040 <_panic>
+  assert(pgdir_walk(kern_pgdir, (void*)PGSIZE, 0) == ptep+PTX(PGSIZE));
+f01029f1:	68 e4 8f 10 f0       	push   $0xf0108fe4
+f01029f6:	68 43 96 10 f0       	push   $0xf0109643
+f01029fb:	68 ad 04 00 00       	push   $0x4ad
+f0102a00:	68 1d 96 10 f0       	push   $0xf010961d
+f0102a05:	e8 36 d6 ff ff       	call   f0100040 <_panic>
+  assert(page_insert(kern_pgdir, pp2, (void*)PGSIZE, PTE_W|PTE_U) == 0);
+f0102a0a:	68 24 90 10 f0       	push   $0xf0109024
+f0102a0f:	68 43 96 10 f0       	push   $0xf0109643
+f0102a14:	68 b0 04 00 00       	push   $0x4b0
+f0102a19:	68 1d 96 10 f0       	push   $0xf010961d
+f0102a1e:	e8 1d d6 ff ff       	call   f0100040 <_panic>
+  assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp2));
+f0102a23:	68 b4 8f 10 f0       	push   $0xf0108fb4
+f0102a28:	68 43 96 10 f0       	push   $0xf0109643
+f0102a2d:	68 b1 04 00 00       	push   $0x4b1
+f0102a32:	68 1d 96 10 f0       	push   $0xf010961d
+f0102a37:	e8 04 d6 ff ff       	call   f0100040 <_panic>
+  assert(pp2->pp_ref == 1);
+f0102a3c:	68 47 98 10 f0       	push   $0xf0109847
+f0102a41:	68 43 96 10 f0       	push   $0xf0109643
+f0102a46:	68 b2 04 00 00       	push   $0x4b2
+f0102a4b:	68 1d 96 10 f0       	push   $0xf010961d
+f0102a50:	e8 eb d5 ff ff       	call   f0100040 <_panic>
+  assert(*pgdir_walk(kern_pgdir, (void*)PGSIZE, 0) & PTE_U);
+f0102a55:	68 64 90 10 f0       	push   $0xf0109064
+f0102a5a:	68 43 96 10 f0       	push   $0xf0109643
+f0102a5f:	68 b3 04 00 00       	push   $0x4b3
+f0102a64:	68 1d 96 10 f0       	push   $0xf010961d
+f0102a69:	e8 d2 d5 ff ff       	call   f0100040 <_panic>
+  assert(kern_pgdir[0] & PTE_U);
+f0102a6e:	68 58 98 10 f0       	push   $0xf0109858
+f0102a73:	68 43 96 10 f0       	push   $0xf0109643
+f0102a78:	68 b4 04 00 00       	push   $0x4b4
+f0102a7d:	68 1d 96 10 f0       	push   $0xf010961d
+f0102a82:	e8 b9 d5 ff ff       	call   f0100040 <_panic>
+  assert(page_insert(kern_pgdir, pp2, (void*)PGSIZE, PTE_W) == 0);
+f0102a87:	68 7c 8f 10 f0       	push   $0xf0108f7c
+f0102a8c:	68 43 96 10 f0       	push   $0xf0109643
+f0102a91:	68 b7 04 00 00       	push   $0x4b7
+f0102a96:	68 1d 96 10 f0       	push   $0xf010961d
+f0102a9b:	e8 a0 d5 ff ff       	call   f0100040 <_panic>
+  assert(*pgdir_walk(kern_pgdir, (void*)PGSIZE, 0) & PTE_W);
+f0102aa0:	68 98 90 10 f0       	push   $0xf0109098
+f0102aa5:	68 43 96 10 f0       	push   $0xf0109643
+f0102aaa:	68 b8 04 00 00       	push   $0x4b8
+f0102aaf:	68 1d 96 10 f0       	push   $0xf010961d
+f0102ab4:	e8 87 d5 ff ff       	call   f0100040 <_panic>
+  assert(!(*pgdir_walk(kern_pgdir, (void*)PGSIZE, 0) & PTE_U));
+f0102ab9:	68 cc 90 10 f0       	push   $0xf01090cc
+f0102abe:	68 43 96 10 f0       	push   $0xf0109643
+f0102ac3:	68 b9 04 00 00       	push   $0x4b9
+f0102ac8:	68 1d 96 10 f0       	push   $0xf010961d
+f0102acd:	e8 6e d5 ff ff       	call   f0100040 <_panic>
+  assert(page_insert(kern_pgdir, pp0, (void*)PTSIZE, PTE_W) < 0);
+f0102ad2:	68 04 91 10 f0       	push   $0xf0109104
+f0102ad7:	68 43 96 10 f0       	push   $0xf0109643
+f0102adc:	68 bc 04 00 00       	push   $0x4bc
+f0102ae1:	68 1d 96 10 f0       	push   $0xf010961d
+f0102ae6:	e8 55 d5 ff ff       	call   f0100040 <_panic>
+  assert(page_insert(kern_pgdir, pp1, (void*)PGSIZE, PTE_W) == 0);
+f0102aeb:	68 3c 91 10 f0       	push   $0xf010913c
+f0102af0:	68 43 96 10 f0       	push   $0xf0109643
+f0102af5:	68 bf 04 00 00       	push   $0x4bf
+f0102afa:	68 1d 96 10 f0       	push   $0xf010961d
+f0102aff:	e8 3c d5 ff ff       	call   f0100040 <_panic>
+  assert(!(*pgdir_walk(kern_pgdir, (void*)PGSIZE, 0) & PTE_U));
+f0102b04:	68 cc 90 10 f0       	push   $0xf01090cc
+f0102b09:	68 43 96 10 f0       	push   $0xf0109643
+f0102b0e:	68 c0 04 00 00       	push   $0x4c0
+f0102b13:	68 1d 96 10 f0       	push   $0xf010961d
+f0102b18:	e8 23 d5 ff ff       	call   f0100040 <_panic>
+  assert(check_va2pa(kern_pgdir, 0) == page2pa(pp1));
+f0102b1d:	68 74 91 10 f0       	push   $0xf0109174
+f0102b22:	68 43 96 10 f0       	push   $0xf0109643
+f0102b27:	68 c3 04 00 00       	push   $0x4c3
+f0102b2c:	68 1d 96 10 f0       	push   $0xf010961d
+f0102b31:	e8 0a d5 ff ff       	call   f0100040 <_panic>
+  assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp1));
+f0102b36:	68 a0 91 10 f0       	push   $0xf01091a0
+f0102b3b:	68 43 96 10 f0       	push   $0xf0109643
+f0102b40:	68 c4 04 00 00       	push   $0x4c4
+f0102b45:	68 1d 96 10 f0       	push   $0xf010961d
+f0102b4a:	e8 f1 d4 ff ff       	call   f0100040 <_panic>
+  assert(pp1->pp_ref == 2);
+f0102b4f:	68 6e 98 10 f0       	push   $0xf010986e
+f0102b54:	68 43 96 10 f0       	push   $0xf0109643
+f0102b59:	68 c6 04 00 00       	push   $0x4c6
+f0102b5e:	68 1d 96 10 f0       	push   $0xf010961d
+f0102b63:	e8 d8 d4 ff ff       	call   f0100040 <_panic>
+  assert(pp2->pp_ref == 0);
+f0102b68:	68 7f 98 10 f0       	push   $0xf010987f
+f0102b6d:	68 43 96 10 f0       	push   $0xf0109643
+f0102b72:	68 c7 04 00 00       	push   $0x4c7
+f0102b77:	68 1d 96 10 f0       	push   $0xf010961d
+f0102b7c:	e8 bf d4 ff ff       	call   f0100040 <_panic>
+  assert((pp = page_alloc(0)) && pp == pp2);
+f0102b81:	68 d0 91 10 f0       	push   $0xf01091d0
+f0102b86:	68 43 96 10 f0       	push   $0xf0109643
+f0102b8b:	68 ca 04 00 00       	push   $0x4ca
+f0102b90:	68 1d 96 10 f0       	push   $0xf010961d
+f0102b95:	e8 a6 d4 ff ff       	call   f0100040 <_panic>
+  assert(check_va2pa(kern_pgdir, 0x0) == ~0);
+f0102b9a:	68 f4 91 10 f0       	push   $0xf01091f4
+f0102b9f:	68 43 96 10 f0       	push   $0xf0109643
+f0102ba4:	68 ce 04 00 00       	push   $0x4ce
+f0102ba9:	68 1d 96 10 f0       	push   $0xf010961d
+f0102bae:	e8 8d d4 ff ff       	call   f0100040 <_panic>
+  assert(check_va2pa(kern_pgdir, PGSIZE) == page2pa(pp1));
+f0102bb3:	68 a0 91 10 f0       	push   $0xf01091a0
+f0102bb8:	68 43 96 10 f0       	push   $0xf0109643
+f0102bbd:	68 cf 04 00 00       	push   $0x4cf
+f0102bc2:	68 1d 96 10 f0       	push   $0xf010961d
+f0102bc7:	e8 74 d4 ff ff       	call   f0100040 <_panic>
+  assert(pp1->pp_ref == 1);
+f0102bcc:	68 25 98 10 f0       	push   $0xf0109825
+f0102bd1:	68 43 96 10 f0       	push   $0xf0109643
+f0102bd6:	68 d0 04 00 00       	push   $0x4d0
+f0102bdb:	68 1d 96 10 f0       	push   $0xf010961d
+f0102be0:	e8 5b d4 ff ff       	call   f0100040 <_panic>
+  assert(pp2->pp_ref == 0);
+f0102be5:	68 7f 98 10 f0       	push   $0xf010987f
+f0102bea:	68 43 96 10 f0       	push   $0xf0109643
+f0102bef:	68 d1 04 00 00       	push   $0x4d1
+f0102bf4:	68 1d 96 10 f0       	push   $0xf010961d
+f0102bf9:	e8 42 d4 ff ff       	call   f0100040 <_panic>
+  assert(page_insert(kern_pgdir, pp1, (void*)PGSIZE, 0) == 0);
+f0102bfe:	68 18 92 10 f0       	push   $0xf0109218
+f0102c03:	68 43 96 10 f0       	push   $0xf0109643
+f0102c08:	68 d4 04 00 00       	push   $0x4d4
+f0102c0d:	68 1d 96 10 f0       	push   $0xf010961d
+f0102c12:	e8 29 d4 ff ff       	call   f0100040 <_panic>
+  assert(pp1->pp_ref);
+f0102c17:	68 90 98 10 f0       	push   $0xf0109890
+f0102c1c:	68 43 96 10 f0       	push   $0xf0109643
+f0102c21:	68 d5 04 00 00       	push   $0x4d5
+f0102c26:	68 1d 96 10 f0       	push   $0xf010961d
+f0102c2b:	e8 10 d4 ff ff       	call   f0100040 <_panic>
+  assert(pp1->pp_link == NULL);
+f0102c30:	68 9c 98 10 f0       	push   $0xf010989c
+f0102c35:	68 43 96 10 f0       	push   $0xf0109643
+f0102c3a:	68 d6 04 00 00       	push   $0x4d6
+f0102c3f:	68 1d 96 10 f0       	push   $0xf010961d
+f0102c44:	e8 f7 d3 ff ff       	call   f0100040 <_panic>
+  assert(check_va2pa(kern_pgdir, 0x0) == ~0);
+f0102c49:	68 f4 91 10 f0       	push   $0xf01091f4
+f0102c4e:	68 43 96 10 f0       	push   $0xf0109643
+f0102c53:	68 da 04 00 00       	push   $0x4da
+f0102c58:	68 1d 96 10 f0       	push   $0xf010961d
+f0102c5d:	e8 de d3 ff ff       	call   f0100040 <_panic>
+  assert(check_va2pa(kern_pgdir, PGSIZE) == ~0);
+f0102c62:	68 4c 92 10 f0       	push   $0xf010924c
+f0102c67:	68 43 96 10 f0       	push   $0xf0109643
+f0102c6c:	68 db 04 00 00       	push   $0x4db
+f0102c71:	68 1d 96 10 f0       	push   $0xf010961d
+f0102c76:	e8 c5 d3 ff ff       	call   f0100040 <_panic>
+  assert(pp1->pp_ref == 0);
+f0102c7b:	68 b1 98 10 f0       	push   $0xf01098b1
+f0102c80:	68 43 96 10 f0       	push   $0xf0109643
+f0102c85:	68 dc 04 00 00       	push   $0x4dc
+f0102c8a:	68 1d 96 10 f0       	push   $0xf010961d
+f0102c8f:	e8 ac d3 ff ff       	call   f0100040 <_panic>
+  assert(pp2->pp_ref == 0);
+f0102c94:	68 7f 98 10 f0       	push   $0xf010987f
+f0102c99:	68 43 96 10 f0       	push   $0xf0109643
+f0102c9e:	68 dd 04 00 00       	push   $0x4dd
+f0102ca3:	68 1d 96 10 f0       	push   $0xf010961d
+f0102ca8:	e8 93 d3 ff ff       	call   f0100040 <_panic>
+  assert((pp = page_alloc(0)) && pp == pp1);
+f0102cad:	68 74 92 10 f0       	push   $0xf0109274
+f0102cb2:	68 43 96 10 f0       	push   $0xf0109643
+f0102cb7:	68 e0 04 00 00       	push   $0x4e0
+f0102cbc:	68 1d 96 10 f0       	push   $0xf010961d
+f0102cc1:	e8 7a d3 ff ff       	call   f0100040 <_panic>
+  assert(!page_alloc(0));
+f0102cc6:	68 d3 97 10 f0       	push   $0xf01097d3
+f0102ccb:	68 43 96 10 f0       	push   $0xf0109643
+f0102cd0:	68 e3 04 00 00       	push   $0x4e3
+f0102cd5:	68 1d 96 10 f0       	push   $0xf010961d
+f0102cda:	e8 61 d3 ff ff       	call   f0100040 <_panic>
+  assert(PTE_ADDR(kern_pgdir[0]) == page2pa(pp0));
+f0102cdf:	68 24 8f 10 f0       	push   $0xf0108f24
+f0102ce4:	68 43 96 10 f0       	push   $0xf0109643
+f0102ce9:	68 e6 04 00 00       	push   $0x4e6
+f0102cee:	68 1d 96 10 f0       	push   $0xf010961d
+f0102cf3:	e8 48 d3 ff ff       	call   f0100040 <_panic>
+  assert(pp0->pp_ref == 1);
+f0102cf8:	68 36 98 10 f0       	push   $0xf0109836
+f0102cfd:	68 43 96 10 f0       	push   $0xf0109643
+f0102d02:	68 e8 04 00 00       	push   $0x4e8
+f0102d07:	68 1d 96 10 f0       	push   $0xf010961d
+f0102d0c:	e8 2f d3 ff ff       	call   f0100040 <_panic>
+f0102d11:	56                   	push   %esi
+f0102d12:	68 c4 82 10 f0       	push   $0xf01082c4
+f0102d17:	68 ef 04 00 00       	push   $0x4ef
+f0102d1c:	68 1d 96 10 f0       	push   $0xf010961d
+f0102d21:	e8 1a d3 ff ff       	call   f0100040 <_panic>
+  assert(ptep == ptep1 + PTX(va));
+f0102d26:	68 c2 98 10 f0       	push   $0xf01098c2
+f0102d2b:	68 43 96 10 f0       	push   $0xf0109643
+f0102d30:	68 f0 04 00 00       	push   $0x4f0
+f0102d35:	68 1d 96 10 f0       	push   $0xf010961d
+f0102d3a:	e8 01 d3 ff ff       	call   f0100040 <_panic>
+f0102d3f:	51                   	push   %ecx
+f0102d40:	68 c4 82 10 f0       	push   $0xf01082c4
+f0102d45:	6a 5f                	push   $0x5f
+f0102d47:	68 29 96 10 f0       	push   $0xf0109629
+f0102d4c:	e8 ef d2 ff ff       	call   f0100040 <_panic>
+f0102d51:	51                   	push   %ecx
+f0102d52:	68 c4 82 10 f0       	push   $0xf01082c4
+f0102d57:	6a 5f                	push   $0x5f
+f0102d59:	68 29 96 10 f0       	push   $0xf0109629
+f0102d5e:	e8 dd d2 ff ff       	call   f0100040 <_panic>
+  kern_pgdir[0] = 0;
+f0102d63:	a1 0c bf 79 f0       	mov    0xf079bf0c,%eax
+f0102d68:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  pp0->pp_ref = 0;
+f0102d6e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0102d71:	66 c7 40 04 00 00    	movw   $0x0,0x4(%eax)
+
+  // give free list back
+  page_free_list = fl;
+f0102d77:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+f0102d7a:	89 0d 40 b2 79 f0    	mov    %ecx,0xf079b240
+
+  // free the pages we took
+  page_free(pp0);
+f0102d80:	83 ec 0c             	sub    $0xc,%esp
+f0102d83:	50                   	push   %eax
+f0102d84:	e8 c7 e6 ff ff       	call   f0101450 <page_free>
+  page_free(pp1);
+f0102d89:	89 3c 24             	mov    %edi,(%esp)
+f0102d8c:	e8 bf e6 ff ff       	call   f0101450 <page_free>
+  page_free(pp2);
+f0102d91:	89 1c 24             	mov    %ebx,(%esp)
+f0102d94:	e8 b7 e6 ff ff       	call   f0101450 <page_free>
+
+  // test mmio_map_region
+  mm1 = (uintptr_t)mmio_map_region(0, 4097);
+f0102d99:	83 c4 08             	add    $0x8,%esp
+f0102d9c:	68 01 10 00 00       	push   $0x1001
+f0102da1:	6a 00                	push   $0x0
+f0102da3:	e8 8d ed ff ff       	call   f0101b35 <mmio_map_region>
+f0102da8:	89 c6                	mov    %eax,%esi
+  mm2 = (uintptr_t)mmio_map_region(0, 4096);
+f0102daa:	83 c4 08             	add    $0x8,%esp
+f0102dad:	68 00 10 00 00       	push   $0x1000
+f0102db2:	6a 00                	push   $0x0
+f0102db4:	e8 7c ed ff ff       	call   f0101b35 <mmio_map_region>
+f0102db9:	89 c7                	mov    %eax,%edi
+  // check that they're in the right region
+  assert(mm1 >= MMIOBASE && mm1 + 8096 < MMIOLIM);
+f0102dbb:	8d 86 a0 1f 00 00    	lea    0x1fa0(%esi),%eax
+f0102dc1:	83 c4 10             	add    $0x10,%esp
+f0102dc4:	81 fe ff ff 7f ef    	cmp    $0xef7fffff,%esi
+f0102dca:	0f 86 a7 02 00 00    	jbe    f0103077 <mem_init+0x14df>
+f0102dd0:	3d ff ff bf ef       	cmp    $0xefbfffff,%eax
+f0102dd5:	0f 87 9c 02 00 00    	ja     f0103077 <mem_init+0x14df>
+  assert(mm2 >= MMIOBASE && mm2 + 8096 < MMIOLIM);
+f0102ddb:	8d 97 a0 1f 00 00    	lea    0x1fa0(%edi),%edx
+f0102de1:	81 fa ff ff bf ef    	cmp    $0xefbfffff,%edx
+f0102de7:	0f 87 a3 02 00 00    	ja     f0103090 <mem_init+0x14f8>
+f0102ded:	81 ff ff ff 7f ef    	cmp    $0xef7fffff,%edi
+f0102df3:	0f 86 97 02 00 00    	jbe    f0103090 <mem_init+0x14f8>
+  // check that they're page-aligned
+  assert(mm1 % PGSIZE == 0 && mm2 % PGSIZE == 0);
+f0102df9:	89 f2                	mov    %esi,%edx
+f0102dfb:	09 fa                	or     %edi,%edx
+f0102dfd:	f7 c2 ff 0f 00 00    	test   $0xfff,%edx
+f0102e03:	0f 85 a0 02 00 00    	jne    f01030a9 <mem_init+0x1511>
+  // check that they don't overlap
+  assert(mm1 + 8096 <= mm2);
+f0102e09:	39 c7                	cmp    %eax,%edi
+f0102e0b:	0f 82 b1 02 00 00    	jb     f01030c2 <mem_init+0x152a>
+  // check page mappings
+  assert(check_va2pa(kern_pgdir, mm1) == 0);
+f0102e11:	8b 1d 0c bf 79 f0    	mov    0xf079bf0c,%ebx
+f0102e17:	89 f2                	mov    %esi,%edx
+f0102e19:	89 d8                	mov    %ebx,%eax
+f0102e1b:	e8 62 e0 ff ff       	call   f0100e82 <check_va2pa>
+f0102e20:	85 c0                	test   %eax,%eax
+f0102e22:	0f 85 b3 02 00 00    	jne    f01030db <mem_init+0x1543>
+  assert(check_va2pa(kern_pgdir, mm1+PGSIZE) == PGSIZE);
+f0102e28:	8d 86 00 10 00 00    	lea    0x1000(%esi),%eax
+f0102e2e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f0102e31:	89 c2                	mov    %eax,%edx
+f0102e33:	89 d8                	mov    %ebx,%eax
+f0102e35:	e8 48 e0 ff ff       	call   f0100e82 <check_va2pa>
+f0102e3a:	3d 00 10 00 00       	cmp    $0x1000,%eax
+f0102e3f:	0f 85 af 02 00 00    	jne    f01030f4 <mem_init+0x155c>
+  assert(check_va2pa(kern_pgdir, mm2) == 0);
+f0102e45:	89 fa                	mov    %edi,%edx
+f0102e47:	89 d8                	mov    %ebx,%eax
+f0102e49:	e8 34 e0 ff ff       	call   f0100e82 <check_va2pa>
+f0102e4e:	85 c0                	test   %eax,%eax
+f0102e50:	0f 85 b7 02 00 00    	jne    f010310d <mem_init+0x1575>
+  assert(check_va2pa(kern_pgdir, mm2+PGSIZE) == ~0);
+f0102e56:	8d 97 00 10 00 00    	lea    0x1000(%edi),%edx
+f0102e5c:	89 d8                	mov    %ebx,%eax
+f0102e5e:	e8 1f e0 ff ff       	call   f0100e82 <check_va2pa>
+f0102e63:	83 f8 ff             	cmp    $0xffffffff,%eax
+f0102e66:	0f 85 ba 02 00 00    	jne    f0103126 <mem_init+0x158e>
+  // check permissions
+  assert(*pgdir_walk(kern_pgdir, (void*)mm1, 0) & (PTE_W|PTE_PWT|PTE_PCD));
+f0102e6c:	83 ec 04             	sub    $0x4,%esp
+f0102e6f:	6a 00                	push   $0x0
+f0102e71:	56                   	push   %esi
+f0102e72:	53                   	push   %ebx
+f0102e73:	e8 42 e8 ff ff       	call   f01016ba <pgdir_walk>
+f0102e78:	83 c4 10             	add    $0x10,%esp
+f0102e7b:	f6 00 1a             	testb  $0x1a,(%eax)
+f0102e7e:	0f 84 bb 02 00 00    	je     f010313f <mem_init+0x15a7>
+  assert(!(*pgdir_walk(kern_pgdir, (void*)mm1, 0) & PTE_U));
+f0102e84:	83 ec 04             	sub    $0x4,%esp
+f0102e87:	6a 00                	push   $0x0
+f0102e89:	56                   	push   %esi
+f0102e8a:	ff 35 0c bf 79 f0    	push   0xf079bf0c
+f0102e90:	e8 25 e8 ff ff       	call   f01016ba <pgdir_walk>
+f0102e95:	8b 00                	mov    (%eax),%eax
+f0102e97:	83 c4 10             	add    $0x10,%esp
+f0102e9a:	83 e0 04             	and    $0x4,%eax
+f0102e9d:	89 c3                	mov    %eax,%ebx
+f0102e9f:	0f 85 b3 02 00 00    	jne    f0103158 <mem_init+0x15c0>
+  // clear the mappings
+  *pgdir_walk(kern_pgdir, (void*)mm1, 0) = 0;
+f0102ea5:	83 ec 04             	sub    $0x4,%esp
+f0102ea8:	6a 00                	push   $0x0
+f0102eaa:	56                   	push   %esi
+f0102eab:	ff 35 0c bf 79 f0    	push   0xf079bf0c
+f0102eb1:	e8 04 e8 ff ff       	call   f01016ba <pgdir_walk>
+f0102eb6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  *pgdir_walk(kern_pgdir, (void*)mm1 + PGSIZE, 0) = 0;
+f0102ebc:	83 c4 0c             	add    $0xc,%esp
+f0102ebf:	6a 00                	push   $0x0
+f0102ec1:	ff 75 d4             	push   -0x2c(%ebp)
+f0102ec4:	ff 35 0c bf 79 f0    	push   0xf079bf0c
+f0102eca:	e8 eb e7 ff ff       	call   f01016ba <pgdir_walk>
+f0102ecf:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  *pgdir_walk(kern_pgdir, (void*)mm2, 0) = 0;
+f0102ed5:	83 c4 0c             	add    $0xc,%esp
+f0102ed8:	6a 00                	push   $0x0
+f0102eda:	57                   	push   %edi
+f0102edb:	ff 35 0c bf 79 f0    	push   0xf079bf0c
+f0102ee1:	e8 d4 e7 ff ff       	call   f01016ba <pgdir_walk>
+f0102ee6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+
+  cprintf("check_page() succeeded!\n");
+f0102eec:	c7 04 24 03 99 10 f0 	movl   $0xf0109903,(%esp)
+f0102ef3:	e8 34 15 00 00       	call   f010442c <cprintf>
+  boot_map_region(kern_pgdir,
+f0102ef8:	8b 15 10 bf 79 f0    	mov    0xf079bf10,%edx
+	if ((uint32_t)kva < KERNBASE)
+f0102efe:	83 c4 10             	add    $0x10,%esp
+f0102f01:	81 fa ff ff ff ef    	cmp    $0xefffffff,%edx
+f0102f07:	0f 86 64 02 00 00    	jbe    f0103171 <mem_init+0x15d9>
+f0102f0d:	a1 08 bf 79 f0       	mov    0xf079bf08,%eax
+f0102f12:	8d 0c c5 00 00 00 00 	lea    0x0(,%eax,8),%ecx
+f0102f19:	83 ec 08             	sub    $0x8,%esp
+f0102f1c:	6a 03                	push   $0x3
+	return (physaddr_t)kva - KERNBASE;
+f0102f1e:	8d 82 00 00 00 10    	lea    0x10000000(%edx),%eax
+f0102f24:	50                   	push   %eax
+f0102f25:	a1 0c bf 79 f0       	mov    0xf079bf0c,%eax
+f0102f2a:	e8 97 e8 ff ff       	call   f01017c6 <boot_map_region>
+  boot_map_region(kern_pgdir,
+f0102f2f:	a1 10 bf 79 f0       	mov    0xf079bf10,%eax
+	if ((uint32_t)kva < KERNBASE)
+f0102f34:	83 c4 10             	add    $0x10,%esp
+f0102f37:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0102f3c:	0f 86 44 02 00 00    	jbe    f0103186 <mem_init+0x15ee>
+f0102f42:	8b 3d 08 bf 79 f0    	mov    0xf079bf08,%edi
+f0102f48:	8d 0c fd 00 00 00 00 	lea    0x0(,%edi,8),%ecx
+f0102f4f:	83 ec 08             	sub    $0x8,%esp
+f0102f52:	6a 05                	push   $0x5
+	return (physaddr_t)kva - KERNBASE;
+f0102f54:	05 00 00 00 10       	add    $0x10000000,%eax
+f0102f59:	50                   	push   %eax
+f0102f5a:	ba 00 00 00 ef       	mov    $0xef000000,%edx
+f0102f5f:	a1 0c bf 79 f0       	mov    0xf079bf0c,%eax
+f0102f64:	e8 5d e8 ff ff       	call   f01017c6 <boot_map_region>
+  boot_map_region(kern_pgdir,
+f0102f69:	8b 15 48 b2 79 f0    	mov    0xf079b248,%edx
+	if ((uint32_t)kva < KERNBASE)
+f0102f6f:	83 c4 10             	add    $0x10,%esp
+f0102f72:	81 fa ff ff ff ef    	cmp    $0xefffffff,%edx
+f0102f78:	0f 86 1d 02 00 00    	jbe    f010319b <mem_init+0x1603>
+f0102f7e:	83 ec 08             	sub    $0x8,%esp
+f0102f81:	6a 03                	push   $0x3
+	return (physaddr_t)kva - KERNBASE;
+f0102f83:	8d 82 00 00 00 10    	lea    0x10000000(%edx),%eax
+f0102f89:	50                   	push   %eax
+f0102f8a:	b9 00 40 02 00       	mov    $0x24000,%ecx
+f0102f8f:	a1 0c bf 79 f0       	mov    0xf079bf0c,%eax
+f0102f94:	e8 2d e8 ff ff       	call   f01017c6 <boot_map_region>
+  boot_map_region(kern_pgdir,
+f0102f99:	a1 48 b2 79 f0       	mov    0xf079b248,%eax
+	if ((uint32_t)kva < KERNBASE)
+f0102f9e:	83 c4 10             	add    $0x10,%esp
+f0102fa1:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0102fa6:	0f 86 04 02 00 00    	jbe    f01031b0 <mem_init+0x1618>
+f0102fac:	83 ec 08             	sub    $0x8,%esp
+f0102faf:	6a 05                	push   $0x5
+	return (physaddr_t)kva - KERNBASE;
+f0102fb1:	05 00 00 00 10       	add    $0x10000000,%eax
+f0102fb6:	50                   	push   %eax
+f0102fb7:	b9 00 40 02 00       	mov    $0x24000,%ecx
+f0102fbc:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+f0102fc1:	a1 0c bf 79 f0       	mov    0xf079bf0c,%eax
+f0102fc6:	e8 fb e7 ff ff       	call   f01017c6 <boot_map_region>
+	if ((uint32_t)kva < KERNBASE)
+f0102fcb:	83 c4 10             	add    $0x10,%esp
+f0102fce:	b8 00 b0 10 f0       	mov    $0xf010b000,%eax
+f0102fd3:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0102fd8:	0f 86 e7 01 00 00    	jbe    f01031c5 <mem_init+0x162d>
+  boot_map_region(kern_pgdir,
+f0102fde:	83 ec 08             	sub    $0x8,%esp
+f0102fe1:	6a 03                	push   $0x3
+f0102fe3:	68 00 b0 10 00       	push   $0x10b000
+f0102fe8:	b9 00 80 00 00       	mov    $0x8000,%ecx
+f0102fed:	ba 00 80 ff ef       	mov    $0xefff8000,%edx
+f0102ff2:	a1 0c bf 79 f0       	mov    0xf079bf0c,%eax
+f0102ff7:	e8 ca e7 ff ff       	call   f01017c6 <boot_map_region>
+  boot_map_region(kern_pgdir,
+f0102ffc:	83 c4 08             	add    $0x8,%esp
+f0102fff:	6a 03                	push   $0x3
+f0103001:	6a 00                	push   $0x0
+f0103003:	b9 ff ff ff 0f       	mov    $0xfffffff,%ecx
+f0103008:	ba 00 00 00 f0       	mov    $0xf0000000,%edx
+f010300d:	a1 0c bf 79 f0       	mov    0xf079bf0c,%eax
+f0103012:	e8 af e7 ff ff       	call   f01017c6 <boot_map_region>
+  for (i = 0; i < NCPU; i++) {
+f0103017:	c7 45 d4 00 d0 79 f0 	movl   $0xf079d000,-0x2c(%ebp)
+f010301e:	bf 00 d0 7d f0       	mov    $0xf07dd000,%edi
+f0103023:	83 c4 10             	add    $0x10,%esp
+f0103026:	b8 00 d0 79 f0       	mov    $0xf079d000,%eax
+f010302b:	be 00 80 ff ef       	mov    $0xefff8000,%esi
+f0103030:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+f0103033:	89 c3                	mov    %eax,%ebx
+f0103035:	39 fb                	cmp    %edi,%ebx
+f0103037:	0f 84 b2 01 00 00    	je     f01031ef <mem_init+0x1657>
+f010303d:	81 fb ff ff ff ef    	cmp    $0xefffffff,%ebx
+f0103043:	0f 86 91 01 00 00    	jbe    f01031da <mem_init+0x1642>
+    boot_map_region(kern_pgdir,
+f0103049:	83 ec 08             	sub    $0x8,%esp
+f010304c:	6a 03                	push   $0x3
+	return (physaddr_t)kva - KERNBASE;
+f010304e:	8d 83 00 00 00 10    	lea    0x10000000(%ebx),%eax
+f0103054:	50                   	push   %eax
+f0103055:	b9 00 80 00 00       	mov    $0x8000,%ecx
+f010305a:	89 f2                	mov    %esi,%edx
+f010305c:	a1 0c bf 79 f0       	mov    0xf079bf0c,%eax
+f0103061:	e8 60 e7 ff ff       	call   f01017c6 <boot_map_region>
+  for (i = 0; i < NCPU; i++) {
+f0103066:	81 ee 00 00 01 00    	sub    $0x10000,%esi
+f010306c:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+f0103072:	83 c4 10             	add    $0x10,%esp
+f0103075:	eb be                	jmp    f0103035 <mem_init+0x149d>
+  assert(mm1 >= MMIOBASE && mm1 + 8096 < MMIOLIM);
+f0103077:	68 98 92 10 f0       	push   $0xf0109298
+f010307c:	68 43 96 10 f0       	push   $0xf0109643
+f0103081:	68 0a 05 00 00       	push   $0x50a
+f0103086:	68 1d 96 10 f0       	push   $0xf010961d
+f010308b:	e8 b0 cf ff ff       	call   f0100040 <_panic>
+  assert(mm2 >= MMIOBASE && mm2 + 8096 < MMIOLIM);
+f0103090:	68 c0 92 10 f0       	push   $0xf01092c0
+f0103095:	68 43 96 10 f0       	push   $0xf0109643
+f010309a:	68 0b 05 00 00       	push   $0x50b
+f010309f:	68 1d 96 10 f0       	push   $0xf010961d
+f01030a4:	e8 97 cf ff ff       	call   f0100040 <_panic>
+  assert(mm1 % PGSIZE == 0 && mm2 % PGSIZE == 0);
+f01030a9:	68 e8 92 10 f0       	push   $0xf01092e8
+f01030ae:	68 43 96 10 f0       	push   $0xf0109643
+f01030b3:	68 0d 05 00 00       	push   $0x50d
+f01030b8:	68 1d 96 10 f0       	push   $0xf010961d
+f01030bd:	e8 7e cf ff ff       	call   f0100040 <_panic>
+  assert(mm1 + 8096 <= mm2);
+f01030c2:	68 f1 98 10 f0       	push   $0xf01098f1
+f01030c7:	68 43 96 10 f0       	push   $0xf0109643
+f01030cc:	68 0f 05 00 00       	push   $0x50f
+f01030d1:	68 1d 96 10 f0       	push   $0xf010961d
+f01030d6:	e8 65 cf ff ff       	call   f0100040 <_panic>
+  assert(check_va2pa(kern_pgdir, mm1) == 0);
+f01030db:	68 10 93 10 f0       	push   $0xf0109310
+f01030e0:	68 43 96 10 f0       	push   $0xf0109643
+f01030e5:	68 11 05 00 00       	push   $0x511
+f01030ea:	68 1d 96 10 f0       	push   $0xf010961d
+f01030ef:	e8 4c cf ff ff       	call   f0100040 <_panic>
+  assert(check_va2pa(kern_pgdir, mm1+PGSIZE) == PGSIZE);
+f01030f4:	68 34 93 10 f0       	push   $0xf0109334
+f01030f9:	68 43 96 10 f0       	push   $0xf0109643
+f01030fe:	68 12 05 00 00       	push   $0x512
+f0103103:	68 1d 96 10 f0       	push   $0xf010961d
+f0103108:	e8 33 cf ff ff       	call   f0100040 <_panic>
+  assert(check_va2pa(kern_pgdir, mm2) == 0);
+f010310d:	68 64 93 10 f0       	push   $0xf0109364
+f0103112:	68 43 96 10 f0       	push   $0xf0109643
+f0103117:	68 13 05 00 00       	push   $0x513
+f010311c:	68 1d 96 10 f0       	push   $0xf010961d
+f0103121:	e8 1a cf ff ff       	call   f0100040 <_panic>
+  assert(check_va2pa(kern_pgdir, mm2+PGSIZE) == ~0);
+f0103126:	68 88 93 10 f0       	push   $0xf0109388
+f010312b:	68 43 96 10 f0       	push   $0xf0109643
+f0103130:	68 14 05 00 00       	push   $0x514
+f0103135:	68 1d 96 10 f0       	push   $0xf010961d
+f010313a:	e8 01 cf ff ff       	call   f0100040 <_panic>
+  assert(*pgdir_walk(kern_pgdir, (void*)mm1, 0) & (PTE_W|PTE_PWT|PTE_PCD));
+f010313f:	68 b4 93 10 f0       	push   $0xf01093b4
+f0103144:	68 43 96 10 f0       	push   $0xf0109643
+f0103149:	68 16 05 00 00       	push   $0x516
+f010314e:	68 1d 96 10 f0       	push   $0xf010961d
+f0103153:	e8 e8 ce ff ff       	call   f0100040 <_panic>
+  assert(!(*pgdir_walk(kern_pgdir, (void*)mm1, 0) & PTE_U));
+f0103158:	68 f8 93 10 f0       	push   $0xf01093f8
+f010315d:	68 43 96 10 f0       	push   $0xf0109643
+f0103162:	68 17 05 00 00       	push   $0x517
+f0103167:	68 1d 96 10 f0       	push   $0xf010961d
+f010316c:	e8 cf ce ff ff       	call   f0100040 <_panic>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0103171:	52                   	push   %edx
+f0103172:	68 e8 82 10 f0       	push   $0xf01082e8
+f0103177:	68 c4 00 00 00       	push   $0xc4
+f010317c:	68 1d 96 10 f0       	push   $0xf010961d
+f0103181:	e8 ba ce ff ff       	call   f0100040 <_panic>
+f0103186:	50                   	push   %eax
+f0103187:	68 e8 82 10 f0       	push   $0xf01082e8
+f010318c:	68 c9 00 00 00       	push   $0xc9
+f0103191:	68 1d 96 10 f0       	push   $0xf010961d
+f0103196:	e8 a5 ce ff ff       	call   f0100040 <_panic>
+f010319b:	52                   	push   %edx
+f010319c:	68 e8 82 10 f0       	push   $0xf01082e8
+f01031a1:	68 d5 00 00 00       	push   $0xd5
+f01031a6:	68 1d 96 10 f0       	push   $0xf010961d
+f01031ab:	e8 90 ce ff ff       	call   f0100040 <_panic>
+f01031b0:	50                   	push   %eax
+f01031b1:	68 e8 82 10 f0       	push   $0xf01082e8
+f01031b6:	68 da 00 00 00       	push   $0xda
+f01031bb:	68 1d 96 10 f0       	push   $0xf010961d
+f01031c0:	e8 7b ce ff ff       	call   f0100040 <_panic>
+f01031c5:	50                   	push   %eax
+f01031c6:	68 e8 82 10 f0       	push   $0xf01082e8
+f01031cb:	68 ea 00 00 00       	push   $0xea
+f01031d0:	68 1d 96 10 f0       	push   $0xf010961d
+f01031d5:	e8 66 ce ff ff       	call   f0100040 <_panic>
+f01031da:	53                   	push   %ebx
+f01031db:	68 e8 82 10 f0       	push   $0xf01082e8
+f01031e0:	68 37 01 00 00       	push   $0x137
+f01031e5:	68 1d 96 10 f0       	push   $0xf010961d
+f01031ea:	e8 51 ce ff ff       	call   f0100040 <_panic>
+  pgdir = kern_pgdir;
+f01031ef:	89 5d c0             	mov    %ebx,-0x40(%ebp)
+f01031f2:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+f01031f5:	8b 3d 0c bf 79 f0    	mov    0xf079bf0c,%edi
+  n = ROUNDUP(npages*sizeof(struct PageInfo), PGSIZE);
+f01031fb:	a1 08 bf 79 f0       	mov    0xf079bf08,%eax
+f0103200:	89 45 c4             	mov    %eax,-0x3c(%ebp)
+f0103203:	8d 14 c5 ff 0f 00 00 	lea    0xfff(,%eax,8),%edx
+f010320a:	89 d0                	mov    %edx,%eax
+f010320c:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+    assert(check_va2pa(pgdir, UPAGES + i) == PADDR(pages) + i);
+f0103211:	8b 0d 10 bf 79 f0    	mov    0xf079bf10,%ecx
+f0103217:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+	return (physaddr_t)kva - KERNBASE;
+f010321a:	81 c1 00 00 00 10    	add    $0x10000000,%ecx
+  for (i = 0; i < n; i += PGSIZE)
+f0103220:	89 de                	mov    %ebx,%esi
+f0103222:	89 7d d0             	mov    %edi,-0x30(%ebp)
+f0103225:	89 cf                	mov    %ecx,%edi
+f0103227:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+f010322a:	89 c3                	mov    %eax,%ebx
+f010322c:	39 de                	cmp    %ebx,%esi
+f010322e:	73 56                	jae    f0103286 <mem_init+0x16ee>
+    assert(check_va2pa(pgdir, UPAGES + i) == PADDR(pages) + i);
+f0103230:	8d 96 00 00 00 ef    	lea    -0x11000000(%esi),%edx
+f0103236:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f0103239:	e8 44 dc ff ff       	call   f0100e82 <check_va2pa>
+	if ((uint32_t)kva < KERNBASE)
+f010323e:	81 7d cc ff ff ff ef 	cmpl   $0xefffffff,-0x34(%ebp)
+f0103245:	76 0f                	jbe    f0103256 <mem_init+0x16be>
+f0103247:	8d 14 3e             	lea    (%esi,%edi,1),%edx
+f010324a:	39 d0                	cmp    %edx,%eax
+f010324c:	75 1f                	jne    f010326d <mem_init+0x16d5>
+  for (i = 0; i < n; i += PGSIZE)
+f010324e:	81 c6 00 10 00 00    	add    $0x1000,%esi
+f0103254:	eb d6                	jmp    f010322c <mem_init+0x1694>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0103256:	ff 75 cc             	push   -0x34(%ebp)
+f0103259:	68 e8 82 10 f0       	push   $0xf01082e8
+f010325e:	68 2e 04 00 00       	push   $0x42e
+f0103263:	68 1d 96 10 f0       	push   $0xf010961d
+f0103268:	e8 d3 cd ff ff       	call   f0100040 <_panic>
+    assert(check_va2pa(pgdir, UPAGES + i) == PADDR(pages) + i);
+f010326d:	68 2c 94 10 f0       	push   $0xf010942c
+f0103272:	68 43 96 10 f0       	push   $0xf0109643
+f0103277:	68 2e 04 00 00       	push   $0x42e
+f010327c:	68 1d 96 10 f0       	push   $0xf010961d
+f0103281:	e8 ba cd ff ff       	call   f0100040 <_panic>
+    assert(check_va2pa(pgdir, UENVS + i) == PADDR(envs) + i);
+f0103286:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+f0103289:	a1 48 b2 79 f0       	mov    0xf079b248,%eax
+f010328e:	89 45 c8             	mov    %eax,-0x38(%ebp)
+	if ((uint32_t)kva < KERNBASE)
+f0103291:	be 00 00 c0 ee       	mov    $0xeec00000,%esi
+f0103296:	8d 88 00 f0 3f 21    	lea    0x213ff000(%eax),%ecx
+f010329c:	89 c7                	mov    %eax,%edi
+f010329e:	89 5d cc             	mov    %ebx,-0x34(%ebp)
+f01032a1:	89 cb                	mov    %ecx,%ebx
+f01032a3:	89 f2                	mov    %esi,%edx
+f01032a5:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f01032a8:	e8 d5 db ff ff       	call   f0100e82 <check_va2pa>
+f01032ad:	81 ff ff ff ff ef    	cmp    $0xefffffff,%edi
+f01032b3:	76 2a                	jbe    f01032df <mem_init+0x1747>
+f01032b5:	81 c6 00 10 00 00    	add    $0x1000,%esi
+f01032bb:	8d 14 33             	lea    (%ebx,%esi,1),%edx
+f01032be:	39 d0                	cmp    %edx,%eax
+f01032c0:	75 34                	jne    f01032f6 <mem_init+0x175e>
+  for (i = 0; i < n; i += PGSIZE)
+f01032c2:	81 fe 00 40 c2 ee    	cmp    $0xeec24000,%esi
+f01032c8:	75 d9                	jne    f01032a3 <mem_init+0x170b>
+  for (i = 0; i < npages * PGSIZE; i += PGSIZE)
+f01032ca:	8b 7d d0             	mov    -0x30(%ebp),%edi
+f01032cd:	8b 5d cc             	mov    -0x34(%ebp),%ebx
+f01032d0:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+f01032d3:	c1 e0 0c             	shl    $0xc,%eax
+f01032d6:	89 de                	mov    %ebx,%esi
+f01032d8:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+f01032db:	89 c3                	mov    %eax,%ebx
+f01032dd:	eb 36                	jmp    f0103315 <mem_init+0x177d>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f01032df:	ff 75 c8             	push   -0x38(%ebp)
+f01032e2:	68 e8 82 10 f0       	push   $0xf01082e8
+f01032e7:	68 33 04 00 00       	push   $0x433
+f01032ec:	68 1d 96 10 f0       	push   $0xf010961d
+f01032f1:	e8 4a cd ff ff       	call   f0100040 <_panic>
+    assert(check_va2pa(pgdir, UENVS + i) == PADDR(envs) + i);
+f01032f6:	68 60 94 10 f0       	push   $0xf0109460
+f01032fb:	68 43 96 10 f0       	push   $0xf0109643
+f0103300:	68 33 04 00 00       	push   $0x433
+f0103305:	68 1d 96 10 f0       	push   $0xf010961d
+f010330a:	e8 31 cd ff ff       	call   f0100040 <_panic>
+  for (i = 0; i < npages * PGSIZE; i += PGSIZE)
+f010330f:	81 c6 00 10 00 00    	add    $0x1000,%esi
+f0103315:	39 de                	cmp    %ebx,%esi
+f0103317:	73 2a                	jae    f0103343 <mem_init+0x17ab>
+    assert(check_va2pa(pgdir, KERNBASE + i) == i);
+f0103319:	8d 96 00 00 00 f0    	lea    -0x10000000(%esi),%edx
+f010331f:	89 f8                	mov    %edi,%eax
+f0103321:	e8 5c db ff ff       	call   f0100e82 <check_va2pa>
+f0103326:	39 c6                	cmp    %eax,%esi
+f0103328:	74 e5                	je     f010330f <mem_init+0x1777>
+f010332a:	68 94 94 10 f0       	push   $0xf0109494
+f010332f:	68 43 96 10 f0       	push   $0xf0109643
+f0103334:	68 37 04 00 00       	push   $0x437
+f0103339:	68 1d 96 10 f0       	push   $0xf010961d
+f010333e:	e8 fd cc ff ff       	call   f0100040 <_panic>
+f0103343:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+f0103346:	c7 45 d0 00 50 7a 00 	movl   $0x7a5000,-0x30(%ebp)
+f010334d:	ba 00 00 ff ef       	mov    $0xefff0000,%edx
+f0103352:	81 ea 00 d0 79 f0    	sub    $0xf079d000,%edx
+f0103358:	89 55 c8             	mov    %edx,-0x38(%ebp)
+  for (i = 0; i < npages * PGSIZE; i += PGSIZE)
+f010335b:	c7 45 cc 00 80 ff ef 	movl   $0xefff8000,-0x34(%ebp)
+f0103362:	89 5d bc             	mov    %ebx,-0x44(%ebp)
+f0103365:	e9 a5 00 00 00       	jmp    f010340f <mem_init+0x1877>
+f010336a:	ff 75 d4             	push   -0x2c(%ebp)
+f010336d:	68 e8 82 10 f0       	push   $0xf01082e8
+f0103372:	68 3f 04 00 00       	push   $0x43f
+f0103377:	68 1d 96 10 f0       	push   $0xf010961d
+f010337c:	e8 bf cc ff ff       	call   f0100040 <_panic>
+    for (i = 0; i < KSTKSIZE; i += PGSIZE)
+f0103381:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f0103387:	39 5d d0             	cmp    %ebx,-0x30(%ebp)
+f010338a:	74 30                	je     f01033bc <mem_init+0x1824>
+      assert(check_va2pa(pgdir, base + KSTKGAP + i)
+f010338c:	8d 14 1e             	lea    (%esi,%ebx,1),%edx
+f010338f:	89 f8                	mov    %edi,%eax
+f0103391:	e8 ec da ff ff       	call   f0100e82 <check_va2pa>
+	if ((uint32_t)kva < KERNBASE)
+f0103396:	81 7d d4 ff ff ff ef 	cmpl   $0xefffffff,-0x2c(%ebp)
+f010339d:	76 cb                	jbe    f010336a <mem_init+0x17d2>
+f010339f:	39 c3                	cmp    %eax,%ebx
+f01033a1:	74 de                	je     f0103381 <mem_init+0x17e9>
+f01033a3:	68 bc 94 10 f0       	push   $0xf01094bc
+f01033a8:	68 43 96 10 f0       	push   $0xf0109643
+f01033ad:	68 3e 04 00 00       	push   $0x43e
+f01033b2:	68 1d 96 10 f0       	push   $0xf010961d
+f01033b7:	e8 84 cc ff ff       	call   f0100040 <_panic>
+f01033bc:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+f01033bf:	8b 5d cc             	mov    -0x34(%ebp),%ebx
+    for (i = 0; i < KSTKGAP; i += PGSIZE)
+f01033c2:	39 f3                	cmp    %esi,%ebx
+f01033c4:	74 2d                	je     f01033f3 <mem_init+0x185b>
+      assert(check_va2pa(pgdir, base + i) == ~0);
+f01033c6:	89 f2                	mov    %esi,%edx
+f01033c8:	89 f8                	mov    %edi,%eax
+f01033ca:	e8 b3 da ff ff       	call   f0100e82 <check_va2pa>
+f01033cf:	81 c6 00 10 00 00    	add    $0x1000,%esi
+f01033d5:	83 f8 ff             	cmp    $0xffffffff,%eax
+f01033d8:	74 e8                	je     f01033c2 <mem_init+0x182a>
+f01033da:	68 04 95 10 f0       	push   $0xf0109504
+f01033df:	68 43 96 10 f0       	push   $0xf0109643
+f01033e4:	68 41 04 00 00       	push   $0x441
+f01033e9:	68 1d 96 10 f0       	push   $0xf010961d
+f01033ee:	e8 4d cc ff ff       	call   f0100040 <_panic>
+  for (n = 0; n < NCPU; n++) {
+f01033f3:	81 6d cc 00 00 01 00 	subl   $0x10000,-0x34(%ebp)
+f01033fa:	81 45 d4 00 80 00 00 	addl   $0x8000,-0x2c(%ebp)
+f0103401:	81 45 d0 00 80 00 00 	addl   $0x8000,-0x30(%ebp)
+f0103408:	81 6d c8 00 80 01 00 	subl   $0x18000,-0x38(%ebp)
+f010340f:	8b 4d c0             	mov    -0x40(%ebp),%ecx
+f0103412:	39 4d d4             	cmp    %ecx,-0x2c(%ebp)
+f0103415:	74 24                	je     f010343b <mem_init+0x18a3>
+    uint32_t base = KSTACKTOP - (KSTKSIZE + KSTKGAP) * (n + 1);
+f0103417:	8b 45 cc             	mov    -0x34(%ebp),%eax
+f010341a:	8d b0 00 80 ff ff    	lea    -0x8000(%eax),%esi
+	return (physaddr_t)kva - KERNBASE;
+f0103420:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0103423:	8d 98 00 00 00 10    	lea    0x10000000(%eax),%ebx
+      assert(check_va2pa(pgdir, base + KSTKGAP + i)
+f0103429:	8b 45 c8             	mov    -0x38(%ebp),%eax
+f010342c:	2d 00 80 ff 0f       	sub    $0xfff8000,%eax
+f0103431:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+f0103434:	89 c6                	mov    %eax,%esi
+    for (i = 0; i < KSTKSIZE; i += PGSIZE)
+f0103436:	e9 4c ff ff ff       	jmp    f0103387 <mem_init+0x17ef>
+f010343b:	8b 5d bc             	mov    -0x44(%ebp),%ebx
+f010343e:	eb 35                	jmp    f0103475 <mem_init+0x18dd>
+      assert(pgdir[i] & PTE_P);
+f0103440:	f6 04 9f 01          	testb  $0x1,(%edi,%ebx,4)
+f0103444:	75 24                	jne    f010346a <mem_init+0x18d2>
+f0103446:	68 1c 99 10 f0       	push   $0xf010991c
+f010344b:	68 43 96 10 f0       	push   $0xf0109643
+f0103450:	68 4c 04 00 00       	push   $0x44c
+f0103455:	68 1d 96 10 f0       	push   $0xf010961d
+f010345a:	e8 e1 cb ff ff       	call   f0100040 <_panic>
+        assert(pgdir[i] & PTE_P);
+f010345f:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+f0103462:	a8 01                	test   $0x1,%al
+f0103464:	74 41                	je     f01034a7 <mem_init+0x190f>
+        assert(pgdir[i] & PTE_W);
+f0103466:	a8 02                	test   $0x2,%al
+f0103468:	74 56                	je     f01034c0 <mem_init+0x1928>
+  for (i = 0; i < NPDENTRIES; i++) {
+f010346a:	83 c3 01             	add    $0x1,%ebx
+f010346d:	81 fb 00 04 00 00    	cmp    $0x400,%ebx
+f0103473:	74 64                	je     f01034d9 <mem_init+0x1941>
+    switch (i) {
+f0103475:	8d 83 45 fc ff ff    	lea    -0x3bb(%ebx),%eax
+f010347b:	83 f8 04             	cmp    $0x4,%eax
+f010347e:	76 c0                	jbe    f0103440 <mem_init+0x18a8>
+      if (i >= PDX(KERNBASE)) {
+f0103480:	81 fb bf 03 00 00    	cmp    $0x3bf,%ebx
+f0103486:	77 d7                	ja     f010345f <mem_init+0x18c7>
+        assert(pgdir[i] == 0);
+f0103488:	83 3c 9f 00          	cmpl   $0x0,(%edi,%ebx,4)
+f010348c:	74 dc                	je     f010346a <mem_init+0x18d2>
+f010348e:	68 3e 99 10 f0       	push   $0xf010993e
+f0103493:	68 43 96 10 f0       	push   $0xf0109643
+f0103498:	68 53 04 00 00       	push   $0x453
+f010349d:	68 1d 96 10 f0       	push   $0xf010961d
+f01034a2:	e8 99 cb ff ff       	call   f0100040 <_panic>
+        assert(pgdir[i] & PTE_P);
+f01034a7:	68 1c 99 10 f0       	push   $0xf010991c
+f01034ac:	68 43 96 10 f0       	push   $0xf0109643
+f01034b1:	68 50 04 00 00       	push   $0x450
+f01034b6:	68 1d 96 10 f0       	push   $0xf010961d
+f01034bb:	e8 80 cb ff ff       	call   f0100040 <_panic>
+        assert(pgdir[i] & PTE_W);
+f01034c0:	68 2d 99 10 f0       	push   $0xf010992d
+f01034c5:	68 43 96 10 f0       	push   $0xf0109643
+f01034ca:	68 51 04 00 00       	push   $0x451
+f01034cf:	68 1d 96 10 f0       	push   $0xf010961d
+f01034d4:	e8 67 cb ff ff       	call   f0100040 <_panic>
+  cprintf("check_kern_pgdir() succeeded!\n");
+f01034d9:	83 ec 0c             	sub    $0xc,%esp
+f01034dc:	68 28 95 10 f0       	push   $0xf0109528
+f01034e1:	e8 46 0f 00 00       	call   f010442c <cprintf>
+  lcr3(PADDR(kern_pgdir));
+f01034e6:	a1 0c bf 79 f0       	mov    0xf079bf0c,%eax
+	if ((uint32_t)kva < KERNBASE)
+f01034eb:	83 c4 10             	add    $0x10,%esp
+f01034ee:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f01034f3:	0f 86 06 02 00 00    	jbe    f01036ff <mem_init+0x1b67>
+	return (physaddr_t)kva - KERNBASE;
+f01034f9:	05 00 00 00 10       	add    $0x10000000,%eax
+  __asm __volatile("movl %0,%%cr3" : : "r" (val));
+f01034fe:	0f 22 d8             	mov    %eax,%cr3
+  check_page_free_list(0);
+f0103501:	b8 00 00 00 00       	mov    $0x0,%eax
+f0103506:	e8 da d9 ff ff       	call   f0100ee5 <check_page_free_list>
+  __asm __volatile("movl %%cr0,%0" : "=r" (val));
+f010350b:	0f 20 c0             	mov    %cr0,%eax
+  cr0 &= ~(CR0_TS|CR0_EM);
+f010350e:	83 e0 f3             	and    $0xfffffff3,%eax
+f0103511:	0d 23 00 05 80       	or     $0x80050023,%eax
+  __asm __volatile("movl %0,%%cr0" : : "r" (val));
+f0103516:	0f 22 c0             	mov    %eax,%cr0
+  uintptr_t va;
+  int i;
+
+  // check that we can read and write installed pages
+  pp1 = pp2 = 0;
+  assert((pp0 = page_alloc(0)));
+f0103519:	83 ec 0c             	sub    $0xc,%esp
+f010351c:	6a 00                	push   $0x0
+f010351e:	e8 8e dd ff ff       	call   f01012b1 <page_alloc>
+f0103523:	89 c3                	mov    %eax,%ebx
+f0103525:	83 c4 10             	add    $0x10,%esp
+f0103528:	85 c0                	test   %eax,%eax
+f010352a:	0f 84 e4 01 00 00    	je     f0103714 <mem_init+0x1b7c>
+  assert((pp1 = page_alloc(0)));
+f0103530:	83 ec 0c             	sub    $0xc,%esp
+f0103533:	6a 00                	push   $0x0
+f0103535:	e8 77 dd ff ff       	call   f01012b1 <page_alloc>
+f010353a:	89 c7                	mov    %eax,%edi
+f010353c:	83 c4 10             	add    $0x10,%esp
+f010353f:	85 c0                	test   %eax,%eax
+f0103541:	0f 84 e6 01 00 00    	je     f010372d <mem_init+0x1b95>
+  assert((pp2 = page_alloc(0)));
+f0103547:	83 ec 0c             	sub    $0xc,%esp
+f010354a:	6a 00                	push   $0x0
+f010354c:	e8 60 dd ff ff       	call   f01012b1 <page_alloc>
+f0103551:	89 c6                	mov    %eax,%esi
+f0103553:	83 c4 10             	add    $0x10,%esp
+f0103556:	85 c0                	test   %eax,%eax
+f0103558:	0f 84 e8 01 00 00    	je     f0103746 <mem_init+0x1bae>
+  page_free(pp0);
+f010355e:	83 ec 0c             	sub    $0xc,%esp
+f0103561:	53                   	push   %ebx
+f0103562:	e8 e9 de ff ff       	call   f0101450 <page_free>
+	return (pp - pages) << PGSHIFT;
+f0103567:	89 f8                	mov    %edi,%eax
+f0103569:	2b 05 10 bf 79 f0    	sub    0xf079bf10,%eax
+f010356f:	c1 f8 03             	sar    $0x3,%eax
+f0103572:	89 c2                	mov    %eax,%edx
+f0103574:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f0103577:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f010357c:	83 c4 10             	add    $0x10,%esp
+f010357f:	3b 05 08 bf 79 f0    	cmp    0xf079bf08,%eax
+f0103585:	0f 83 d4 01 00 00    	jae    f010375f <mem_init+0x1bc7>
+  memset(page2kva(pp1), 1, PGSIZE);
+f010358b:	83 ec 04             	sub    $0x4,%esp
+f010358e:	68 00 10 00 00       	push   $0x1000
+f0103593:	6a 01                	push   $0x1
+	return (void *)(pa + KERNBASE);
+f0103595:	81 ea 00 00 00 10    	sub    $0x10000000,%edx
+f010359b:	52                   	push   %edx
+f010359c:	e8 db 40 00 00       	call   f010767c <memset>
+	return (pp - pages) << PGSHIFT;
+f01035a1:	89 f0                	mov    %esi,%eax
+f01035a3:	2b 05 10 bf 79 f0    	sub    0xf079bf10,%eax
+f01035a9:	c1 f8 03             	sar    $0x3,%eax
+f01035ac:	89 c2                	mov    %eax,%edx
+f01035ae:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f01035b1:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f01035b6:	83 c4 10             	add    $0x10,%esp
+f01035b9:	3b 05 08 bf 79 f0    	cmp    0xf079bf08,%eax
+f01035bf:	0f 83 ac 01 00 00    	jae    f0103771 <mem_init+0x1bd9>
+  memset(page2kva(pp2), 2, PGSIZE);
+f01035c5:	83 ec 04             	sub    $0x4,%esp
+f01035c8:	68 00 10 00 00       	push   $0x1000
+f01035cd:	6a 02                	push   $0x2
+	return (void *)(pa + KERNBASE);
+f01035cf:	81 ea 00 00 00 10    	sub    $0x10000000,%edx
+f01035d5:	52                   	push   %edx
+f01035d6:	e8 a1 40 00 00       	call   f010767c <memset>
+  page_insert(kern_pgdir, pp1, (void*)PGSIZE, PTE_W);
+f01035db:	6a 02                	push   $0x2
+f01035dd:	68 00 10 00 00       	push   $0x1000
+f01035e2:	57                   	push   %edi
+f01035e3:	ff 35 0c bf 79 f0    	push   0xf079bf0c
+f01035e9:	e8 27 e3 ff ff       	call   f0101915 <page_insert>
+  assert(pp1->pp_ref == 1);
+f01035ee:	83 c4 20             	add    $0x20,%esp
+f01035f1:	66 83 7f 04 01       	cmpw   $0x1,0x4(%edi)
+f01035f6:	0f 85 87 01 00 00    	jne    f0103783 <mem_init+0x1beb>
+  assert(*(uint32_t*)PGSIZE == 0x01010101U);
+f01035fc:	81 3d 00 10 00 00 01 	cmpl   $0x1010101,0x1000
+f0103603:	01 01 01 
+f0103606:	0f 85 90 01 00 00    	jne    f010379c <mem_init+0x1c04>
+  page_insert(kern_pgdir, pp2, (void*)PGSIZE, PTE_W);
+f010360c:	6a 02                	push   $0x2
+f010360e:	68 00 10 00 00       	push   $0x1000
+f0103613:	56                   	push   %esi
+f0103614:	ff 35 0c bf 79 f0    	push   0xf079bf0c
+f010361a:	e8 f6 e2 ff ff       	call   f0101915 <page_insert>
+  assert(*(uint32_t*)PGSIZE == 0x02020202U);
+f010361f:	83 c4 10             	add    $0x10,%esp
+f0103622:	81 3d 00 10 00 00 02 	cmpl   $0x2020202,0x1000
+f0103629:	02 02 02 
+f010362c:	0f 85 83 01 00 00    	jne    f01037b5 <mem_init+0x1c1d>
+  assert(pp2->pp_ref == 1);
+f0103632:	66 83 7e 04 01       	cmpw   $0x1,0x4(%esi)
+f0103637:	0f 85 91 01 00 00    	jne    f01037ce <mem_init+0x1c36>
+  assert(pp1->pp_ref == 0);
+f010363d:	66 83 7f 04 00       	cmpw   $0x0,0x4(%edi)
+f0103642:	0f 85 9f 01 00 00    	jne    f01037e7 <mem_init+0x1c4f>
+  *(uint32_t*)PGSIZE = 0x03030303U;
+f0103648:	c7 05 00 10 00 00 03 	movl   $0x3030303,0x1000
+f010364f:	03 03 03 
+	return (pp - pages) << PGSHIFT;
+f0103652:	89 f0                	mov    %esi,%eax
+f0103654:	2b 05 10 bf 79 f0    	sub    0xf079bf10,%eax
+f010365a:	c1 f8 03             	sar    $0x3,%eax
+f010365d:	89 c2                	mov    %eax,%edx
+f010365f:	c1 e2 0c             	shl    $0xc,%edx
+	if (PGNUM(pa) >= npages)
+f0103662:	25 ff ff 0f 00       	and    $0xfffff,%eax
+f0103667:	3b 05 08 bf 79 f0    	cmp    0xf079bf08,%eax
+f010366d:	0f 83 8d 01 00 00    	jae    f0103800 <mem_init+0x1c68>
+  assert(*(uint32_t*)page2kva(pp2) == 0x03030303U);
+f0103673:	81 ba 00 00 00 f0 03 	cmpl   $0x3030303,-0x10000000(%edx)
+f010367a:	03 03 03 
+f010367d:	0f 85 8f 01 00 00    	jne    f0103812 <mem_init+0x1c7a>
+  page_remove(kern_pgdir, (void*)PGSIZE);
+f0103683:	83 ec 08             	sub    $0x8,%esp
+f0103686:	68 00 10 00 00       	push   $0x1000
+f010368b:	ff 35 0c bf 79 f0    	push   0xf079bf0c
+f0103691:	e8 13 e2 ff ff       	call   f01018a9 <page_remove>
+  assert(pp2->pp_ref == 0);
+f0103696:	83 c4 10             	add    $0x10,%esp
+f0103699:	66 83 7e 04 00       	cmpw   $0x0,0x4(%esi)
+f010369e:	0f 85 87 01 00 00    	jne    f010382b <mem_init+0x1c93>
+
+  // forcibly take pp0 back
+  assert(PTE_ADDR(kern_pgdir[0]) == page2pa(pp0));
+f01036a4:	8b 0d 0c bf 79 f0    	mov    0xf079bf0c,%ecx
+f01036aa:	8b 11                	mov    (%ecx),%edx
+f01036ac:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+	return (pp - pages) << PGSHIFT;
+f01036b2:	89 d8                	mov    %ebx,%eax
+f01036b4:	2b 05 10 bf 79 f0    	sub    0xf079bf10,%eax
+f01036ba:	c1 f8 03             	sar    $0x3,%eax
+f01036bd:	c1 e0 0c             	shl    $0xc,%eax
+f01036c0:	39 c2                	cmp    %eax,%edx
+f01036c2:	0f 85 7c 01 00 00    	jne    f0103844 <mem_init+0x1cac>
+  kern_pgdir[0] = 0;
+f01036c8:	c7 01 00 00 00 00    	movl   $0x0,(%ecx)
+  assert(pp0->pp_ref == 1);
+f01036ce:	66 83 7b 04 01       	cmpw   $0x1,0x4(%ebx)
+f01036d3:	0f 85 84 01 00 00    	jne    f010385d <mem_init+0x1cc5>
+  pp0->pp_ref = 0;
+f01036d9:	66 c7 43 04 00 00    	movw   $0x0,0x4(%ebx)
+
+  // free the pages we took
+  page_free(pp0);
+f01036df:	83 ec 0c             	sub    $0xc,%esp
+f01036e2:	53                   	push   %ebx
+f01036e3:	e8 68 dd ff ff       	call   f0101450 <page_free>
+
+  cprintf("check_page_installed_pgdir() succeeded!\n");
+f01036e8:	c7 04 24 bc 95 10 f0 	movl   $0xf01095bc,(%esp)
+f01036ef:	e8 38 0d 00 00       	call   f010442c <cprintf>
+}
+f01036f4:	83 c4 10             	add    $0x10,%esp
+f01036f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01036fa:	5b                   	pop    %ebx
+f01036fb:	5e                   	pop    %esi
+f01036fc:	5f                   	pop    %edi
+f01036fd:	5d                   	pop    %ebp
+f01036fe:	c3                   	ret
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f01036ff:	50                   	push   %eax
+f0103700:	68 e8 82 10 f0       	push   $0xf01082e8
+f0103705:	68 08 01 00 00       	push   $0x108
+f010370a:	68 1d 96 10 f0       	push   $0xf010961d
+f010370f:	e8 2c c9 ff ff       	call   f0100040 <_panic>
+  assert((pp0 = page_alloc(0)));
+f0103714:	68 28 97 10 f0       	push   $0xf0109728
+f0103719:	68 43 96 10 f0       	push   $0xf0109643
+f010371e:	68 2c 05 00 00       	push   $0x52c
+f0103723:	68 1d 96 10 f0       	push   $0xf010961d
+f0103728:	e8 13 c9 ff ff       	call   f0100040 <_panic>
+  assert((pp1 = page_alloc(0)));
+f010372d:	68 3e 97 10 f0       	push   $0xf010973e
+f0103732:	68 43 96 10 f0       	push   $0xf0109643
+f0103737:	68 2d 05 00 00       	push   $0x52d
+f010373c:	68 1d 96 10 f0       	push   $0xf010961d
+f0103741:	e8 fa c8 ff ff       	call   f0100040 <_panic>
+  assert((pp2 = page_alloc(0)));
+f0103746:	68 54 97 10 f0       	push   $0xf0109754
+f010374b:	68 43 96 10 f0       	push   $0xf0109643
+f0103750:	68 2e 05 00 00       	push   $0x52e
+f0103755:	68 1d 96 10 f0       	push   $0xf010961d
+f010375a:	e8 e1 c8 ff ff       	call   f0100040 <_panic>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f010375f:	52                   	push   %edx
+f0103760:	68 c4 82 10 f0       	push   $0xf01082c4
+f0103765:	6a 5f                	push   $0x5f
+f0103767:	68 29 96 10 f0       	push   $0xf0109629
+f010376c:	e8 cf c8 ff ff       	call   f0100040 <_panic>
+f0103771:	52                   	push   %edx
+f0103772:	68 c4 82 10 f0       	push   $0xf01082c4
+f0103777:	6a 5f                	push   $0x5f
+f0103779:	68 29 96 10 f0       	push   $0xf0109629
+f010377e:	e8 bd c8 ff ff       	call   f0100040 <_panic>
+  assert(pp1->pp_ref == 1);
+f0103783:	68 25 98 10 f0       	push   $0xf0109825
+f0103788:	68 43 96 10 f0       	push   $0xf0109643
+f010378d:	68 33 05 00 00       	push   $0x533
+f0103792:	68 1d 96 10 f0       	push   $0xf010961d
+f0103797:	e8 a4 c8 ff ff       	call   f0100040 <_panic>
+  assert(*(uint32_t*)PGSIZE == 0x01010101U);
+f010379c:	68 48 95 10 f0       	push   $0xf0109548
+f01037a1:	68 43 96 10 f0       	push   $0xf0109643
+f01037a6:	68 34 05 00 00       	push   $0x534
+f01037ab:	68 1d 96 10 f0       	push   $0xf010961d
+f01037b0:	e8 8b c8 ff ff       	call   f0100040 <_panic>
+  assert(*(uint32_t*)PGSIZE == 0x02020202U);
+f01037b5:	68 6c 95 10 f0       	push   $0xf010956c
+f01037ba:	68 43 96 10 f0       	push   $0xf0109643
+f01037bf:	68 36 05 00 00       	push   $0x536
+f01037c4:	68 1d 96 10 f0       	push   $0xf010961d
+f01037c9:	e8 72 c8 ff ff       	call   f0100040 <_panic>
+  assert(pp2->pp_ref == 1);
+f01037ce:	68 47 98 10 f0       	push   $0xf0109847
+f01037d3:	68 43 96 10 f0       	push   $0xf0109643
+f01037d8:	68 37 05 00 00       	push   $0x537
+f01037dd:	68 1d 96 10 f0       	push   $0xf010961d
+f01037e2:	e8 59 c8 ff ff       	call   f0100040 <_panic>
+  assert(pp1->pp_ref == 0);
+f01037e7:	68 b1 98 10 f0       	push   $0xf01098b1
+f01037ec:	68 43 96 10 f0       	push   $0xf0109643
+f01037f1:	68 38 05 00 00       	push   $0x538
+f01037f6:	68 1d 96 10 f0       	push   $0xf010961d
+f01037fb:	e8 40 c8 ff ff       	call   f0100040 <_panic>
+f0103800:	52                   	push   %edx
+f0103801:	68 c4 82 10 f0       	push   $0xf01082c4
+f0103806:	6a 5f                	push   $0x5f
+f0103808:	68 29 96 10 f0       	push   $0xf0109629
+f010380d:	e8 2e c8 ff ff       	call   f0100040 <_panic>
+  assert(*(uint32_t*)page2kva(pp2) == 0x03030303U);
+f0103812:	68 90 95 10 f0       	push   $0xf0109590
+f0103817:	68 43 96 10 f0       	push   $0xf0109643
+f010381c:	68 3a 05 00 00       	push   $0x53a
+f0103821:	68 1d 96 10 f0       	push   $0xf010961d
+f0103826:	e8 15 c8 ff ff       	call   f0100040 <_panic>
+  assert(pp2->pp_ref == 0);
+f010382b:	68 7f 98 10 f0       	push   $0xf010987f
+f0103830:	68 43 96 10 f0       	push   $0xf0109643
+f0103835:	68 3c 05 00 00       	push   $0x53c
+f010383a:	68 1d 96 10 f0       	push   $0xf010961d
+f010383f:	e8 fc c7 ff ff       	call   f0100040 <_panic>
+  assert(PTE_ADDR(kern_pgdir[0]) == page2pa(pp0));
+f0103844:	68 24 8f 10 f0       	push   $0xf0108f24
+f0103849:	68 43 96 10 f0       	push   $0xf0109643
+f010384e:	68 3f 05 00 00       	push   $0x53f
+f0103853:	68 1d 96 10 f0       	push   $0xf010961d
+f0103858:	e8 e3 c7 ff ff       	call   f0100040 <_panic>
+  assert(pp0->pp_ref == 1);
+f010385d:	68 36 98 10 f0       	push   $0xf0109836
+f0103862:	68 43 96 10 f0       	push   $0xf0109643
+f0103867:	68 41 05 00 00       	push   $0x541
+f010386c:	68 1d 96 10 f0       	push   $0xf010961d
+f0103871:	e8 ca c7 ff ff       	call   f0100040 <_panic>
+
+f0103876 <user_mem_check>:
+{
+f0103876:	55                   	push   %ebp
+f0103877:	89 e5                	mov    %esp,%ebp
+f0103879:	57                   	push   %edi
+f010387a:	56                   	push   %esi
+f010387b:	53                   	push   %ebx
+f010387c:	83 ec 1c             	sub    $0x1c,%esp
+f010387f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+f0103882:	8b 75 14             	mov    0x14(%ebp),%esi
+  cur = (void *) ROUNDDOWN(va, PGSIZE);
+f0103885:	89 cb                	mov    %ecx,%ebx
+f0103887:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  end = (void *) va + len;
+f010388d:	89 c8                	mov    %ecx,%eax
+f010388f:	03 45 10             	add    0x10(%ebp),%eax
+f0103892:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    if ( (perm & PTE_W) && (uintptr_t) cur < UTOP )
+f0103895:	89 f7                	mov    %esi,%edi
+f0103897:	83 e7 02             	and    $0x2,%edi
+        (*pagetable_entry & (perm | PTE_P)) != (perm | PTE_P) ||
+f010389a:	83 ce 01             	or     $0x1,%esi
+f010389d:	89 75 e4             	mov    %esi,-0x1c(%ebp)
+f01038a0:	8b 75 08             	mov    0x8(%ebp),%esi
+  for ( ; cur < end; cur += PGSIZE) {
+f01038a3:	eb 41                	jmp    f01038e6 <user_mem_check+0x70>
+    pagetable_entry = pgdir_walk(env->env_pgdir, cur, 0);
+f01038a5:	83 ec 04             	sub    $0x4,%esp
+f01038a8:	6a 00                	push   $0x0
+f01038aa:	53                   	push   %ebx
+f01038ab:	ff 76 60             	push   0x60(%esi)
+f01038ae:	e8 07 de ff ff       	call   f01016ba <pgdir_walk>
+    if ( ((uintptr_t) (cur) >= ULIM) ||
+f01038b3:	89 d9                	mov    %ebx,%ecx
+f01038b5:	83 c4 10             	add    $0x10,%esp
+f01038b8:	81 fb ff ff 7f ef    	cmp    $0xef7fffff,%ebx
+f01038be:	77 4a                	ja     f010390a <user_mem_check+0x94>
+f01038c0:	85 c0                	test   %eax,%eax
+f01038c2:	74 46                	je     f010390a <user_mem_check+0x94>
+        (*pagetable_entry & (perm | PTE_P)) != (perm | PTE_P) ||
+f01038c4:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+f01038c7:	23 10                	and    (%eax),%edx
+        !(pagetable_entry) ||
+f01038c9:	39 55 e4             	cmp    %edx,-0x1c(%ebp)
+f01038cc:	75 3c                	jne    f010390a <user_mem_check+0x94>
+        (*pagetable_entry & (perm | PTE_P)) != (perm | PTE_P) ||
+f01038ce:	85 ff                	test   %edi,%edi
+f01038d0:	74 0e                	je     f01038e0 <user_mem_check+0x6a>
+        ((perm & PTE_W) && !(env->env_pgdir[PDX(cur)] & PTE_W)) ) {
+f01038d2:	89 da                	mov    %ebx,%edx
+f01038d4:	c1 ea 16             	shr    $0x16,%edx
+f01038d7:	8b 46 60             	mov    0x60(%esi),%eax
+f01038da:	f6 04 90 02          	testb  $0x2,(%eax,%edx,4)
+f01038de:	74 2a                	je     f010390a <user_mem_check+0x94>
+  for ( ; cur < end; cur += PGSIZE) {
+f01038e0:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f01038e6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f01038e9:	39 c3                	cmp    %eax,%ebx
+f01038eb:	73 39                	jae    f0103926 <user_mem_check+0xb0>
+    if ( (perm & PTE_W) && (uintptr_t) cur < UTOP )
+f01038ed:	85 ff                	test   %edi,%edi
+f01038ef:	74 b4                	je     f01038a5 <user_mem_check+0x2f>
+f01038f1:	81 fb ff ff bf ee    	cmp    $0xeebfffff,%ebx
+f01038f7:	77 ac                	ja     f01038a5 <user_mem_check+0x2f>
+      pgdir_unshare(env->env_pgdir, cur);
+f01038f9:	83 ec 08             	sub    $0x8,%esp
+f01038fc:	53                   	push   %ebx
+f01038fd:	ff 76 60             	push   0x60(%esi)
+f0103900:	e8 aa db ff ff       	call   f01014af <pgdir_unshare>
+f0103905:	83 c4 10             	add    $0x10,%esp
+f0103908:	eb 9b                	jmp    f01038a5 <user_mem_check+0x2f>
+      user_mem_check_addr = (uintptr_t) ((cur <=  va) ? va : cur);
+f010390a:	89 c8                	mov    %ecx,%eax
+f010390c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+f010390f:	39 d9                	cmp    %ebx,%ecx
+f0103911:	0f 43 c1             	cmovae %ecx,%eax
+f0103914:	a3 3c b2 79 f0       	mov    %eax,0xf079b23c
+      return -E_FAULT;
+f0103919:	b8 fa ff ff ff       	mov    $0xfffffffa,%eax
+}
+f010391e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0103921:	5b                   	pop    %ebx
+f0103922:	5e                   	pop    %esi
+f0103923:	5f                   	pop    %edi
+f0103924:	5d                   	pop    %ebp
+f0103925:	c3                   	ret
+  return 0;
+f0103926:	b8 00 00 00 00       	mov    $0x0,%eax
+f010392b:	eb f1                	jmp    f010391e <user_mem_check+0xa8>
+
+f010392d <user_mem_assert>:
+{
+f010392d:	55                   	push   %ebp
+f010392e:	89 e5                	mov    %esp,%ebp
+f0103930:	53                   	push   %ebx
+f0103931:	83 ec 04             	sub    $0x4,%esp
+f0103934:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (user_mem_check(env, va, len, perm | PTE_U) < 0) {
+f0103937:	8b 45 14             	mov    0x14(%ebp),%eax
+f010393a:	83 c8 04             	or     $0x4,%eax
+f010393d:	50                   	push   %eax
+f010393e:	ff 75 10             	push   0x10(%ebp)
+f0103941:	ff 75 0c             	push   0xc(%ebp)
+f0103944:	53                   	push   %ebx
+f0103945:	e8 2c ff ff ff       	call   f0103876 <user_mem_check>
+f010394a:	83 c4 10             	add    $0x10,%esp
+f010394d:	85 c0                	test   %eax,%eax
+f010394f:	78 05                	js     f0103956 <user_mem_assert+0x29>
+}
+f0103951:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0103954:	c9                   	leave
+f0103955:	c3                   	ret
+    cprintf("[%08x] user_mem_check assertion failure for "
+f0103956:	83 ec 04             	sub    $0x4,%esp
+f0103959:	ff 35 3c b2 79 f0    	push   0xf079b23c
+f010395f:	ff 73 48             	push   0x48(%ebx)
+f0103962:	68 e8 95 10 f0       	push   $0xf01095e8
+f0103967:	e8 c0 0a 00 00       	call   f010442c <cprintf>
+    env_destroy(env);                   // may not return
+f010396c:	89 1c 24             	mov    %ebx,(%esp)
+f010396f:	e8 e3 06 00 00       	call   f0104057 <env_destroy>
+f0103974:	83 c4 10             	add    $0x10,%esp
+}
+f0103977:	eb d8                	jmp    f0103951 <user_mem_assert+0x24>
+
+f0103979 <region_alloc>:
+// Pages should be writable by user and kernel.
+// Panic if any allocation attempt fails.
+//
+static void
+region_alloc(struct Env *e, void *va, size_t len)
+{
+f0103979:	55                   	push   %ebp
+f010397a:	89 e5                	mov    %esp,%ebp
+f010397c:	57                   	push   %edi
+f010397d:	56                   	push   %esi
+f010397e:	53                   	push   %ebx
+f010397f:	83 ec 0c             	sub    $0xc,%esp
+f0103982:	89 c7                	mov    %eax,%edi
+  //   You should round va down, and round (va + len) up.
+  //   (Watch out for corner-cases!)
+  struct PageInfo* page;
+  uint32_t start, end;
+
+  start = ROUNDDOWN((uint32_t) va, PGSIZE);
+f0103984:	89 d3                	mov    %edx,%ebx
+f0103986:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  end = ROUNDUP((uint32_t) va + len, PGSIZE);
+f010398c:	8d b4 0a ff 0f 00 00 	lea    0xfff(%edx,%ecx,1),%esi
+f0103993:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+
+  for ( ; start < end; start += PGSIZE) {
+f0103999:	39 f3                	cmp    %esi,%ebx
+f010399b:	73 3f                	jae    f01039dc <region_alloc+0x63>
+    page = page_alloc(0);
+f010399d:	83 ec 0c             	sub    $0xc,%esp
+f01039a0:	6a 00                	push   $0x0
+f01039a2:	e8 0a d9 ff ff       	call   f01012b1 <page_alloc>
+
+    if (page) {
+f01039a7:	83 c4 10             	add    $0x10,%esp
+f01039aa:	85 c0                	test   %eax,%eax
+f01039ac:	74 17                	je     f01039c5 <region_alloc+0x4c>
+      page_insert(e->env_pgdir, page, (void *) start, PTE_P | PTE_U | PTE_W);
+f01039ae:	6a 07                	push   $0x7
+f01039b0:	53                   	push   %ebx
+f01039b1:	50                   	push   %eax
+f01039b2:	ff 77 60             	push   0x60(%edi)
+f01039b5:	e8 5b df ff ff       	call   f0101915 <page_insert>
+  for ( ; start < end; start += PGSIZE) {
+f01039ba:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f01039c0:	83 c4 10             	add    $0x10,%esp
+f01039c3:	eb d4                	jmp    f0103999 <region_alloc+0x20>
+    } else {
+      panic("region_alloc: failed page allocation attempt");
+f01039c5:	83 ec 04             	sub    $0x4,%esp
+f01039c8:	68 4c 99 10 f0       	push   $0xf010994c
+f01039cd:	68 3e 01 00 00       	push   $0x13e
+f01039d2:	68 fa 99 10 f0       	push   $0xf01099fa
+f01039d7:	e8 64 c6 ff ff       	call   f0100040 <_panic>
+    }
+  }
+
+}
+f01039dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01039df:	5b                   	pop    %ebx
+f01039e0:	5e                   	pop    %esi
+f01039e1:	5f                   	pop    %edi
+f01039e2:	5d                   	pop    %ebp
+f01039e3:	c3                   	ret
+
+f01039e4 <envid2env>:
+{
+f01039e4:	55                   	push   %ebp
+f01039e5:	89 e5                	mov    %esp,%ebp
+f01039e7:	56                   	push   %esi
+f01039e8:	53                   	push   %ebx
+f01039e9:	8b 75 08             	mov    0x8(%ebp),%esi
+f01039ec:	8b 55 10             	mov    0x10(%ebp),%edx
+  if (envid == 0) {
+f01039ef:	85 f6                	test   %esi,%esi
+f01039f1:	74 30                	je     f0103a23 <envid2env+0x3f>
+  e = &envs[ENVX(envid)];
+f01039f3:	89 f0                	mov    %esi,%eax
+f01039f5:	25 ff 03 00 00       	and    $0x3ff,%eax
+f01039fa:	8d 1c c0             	lea    (%eax,%eax,8),%ebx
+f01039fd:	c1 e3 04             	shl    $0x4,%ebx
+f0103a00:	03 1d 48 b2 79 f0    	add    0xf079b248,%ebx
+  if (e->env_status == ENV_FREE || e->env_id != envid) {
+f0103a06:	83 7b 54 00          	cmpl   $0x0,0x54(%ebx)
+f0103a0a:	74 5b                	je     f0103a67 <envid2env+0x83>
+f0103a0c:	39 73 48             	cmp    %esi,0x48(%ebx)
+f0103a0f:	75 62                	jne    f0103a73 <envid2env+0x8f>
+  if (checkperm && e != curenv && e->env_parent_id != curenv->env_id) {
+f0103a11:	84 d2                	test   %dl,%dl
+f0103a13:	75 20                	jne    f0103a35 <envid2env+0x51>
+  return 0;
+f0103a15:	b8 00 00 00 00       	mov    $0x0,%eax
+    *env_store = curenv;
+f0103a1a:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0103a1d:	89 1a                	mov    %ebx,(%edx)
+}
+f0103a1f:	5b                   	pop    %ebx
+f0103a20:	5e                   	pop    %esi
+f0103a21:	5d                   	pop    %ebp
+f0103a22:	c3                   	ret
+    *env_store = curenv;
+f0103a23:	e8 37 42 00 00       	call   f0107c5f <cpunum>
+f0103a28:	6b c0 74             	imul   $0x74,%eax,%eax
+f0103a2b:	8b 98 28 c0 79 f0    	mov    -0xf863fd8(%eax),%ebx
+    return 0;
+f0103a31:	89 f0                	mov    %esi,%eax
+f0103a33:	eb e5                	jmp    f0103a1a <envid2env+0x36>
+  if (checkperm && e != curenv && e->env_parent_id != curenv->env_id) {
+f0103a35:	e8 25 42 00 00       	call   f0107c5f <cpunum>
+f0103a3a:	6b c0 74             	imul   $0x74,%eax,%eax
+f0103a3d:	39 98 28 c0 79 f0    	cmp    %ebx,-0xf863fd8(%eax)
+f0103a43:	74 d0                	je     f0103a15 <envid2env+0x31>
+f0103a45:	8b 73 4c             	mov    0x4c(%ebx),%esi
+f0103a48:	e8 12 42 00 00       	call   f0107c5f <cpunum>
+f0103a4d:	6b c0 74             	imul   $0x74,%eax,%eax
+f0103a50:	8b 80 28 c0 79 f0    	mov    -0xf863fd8(%eax),%eax
+f0103a56:	3b 70 48             	cmp    0x48(%eax),%esi
+f0103a59:	74 ba                	je     f0103a15 <envid2env+0x31>
+f0103a5b:	bb 00 00 00 00       	mov    $0x0,%ebx
+    return -E_BAD_ENV;
+f0103a60:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+f0103a65:	eb b3                	jmp    f0103a1a <envid2env+0x36>
+f0103a67:	bb 00 00 00 00       	mov    $0x0,%ebx
+    return -E_BAD_ENV;
+f0103a6c:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+f0103a71:	eb a7                	jmp    f0103a1a <envid2env+0x36>
+f0103a73:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0103a78:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+f0103a7d:	eb 9b                	jmp    f0103a1a <envid2env+0x36>
+
+f0103a7f <env_init_percpu>:
+  __asm __volatile("lgdt (%0)" : : "r" (p));
+f0103a7f:	b8 20 53 11 f0       	mov    $0xf0115320,%eax
+f0103a84:	0f 01 10             	lgdtl  (%eax)
+  asm volatile ("movw %%ax,%%gs" :: "a" (GD_UD|3));
+f0103a87:	b8 23 00 00 00       	mov    $0x23,%eax
+f0103a8c:	8e e8                	mov    %eax,%gs
+  asm volatile ("movw %%ax,%%fs" :: "a" (GD_UD|3));
+f0103a8e:	8e e0                	mov    %eax,%fs
+  asm volatile ("movw %%ax,%%es" :: "a" (GD_KD));
+f0103a90:	b8 10 00 00 00       	mov    $0x10,%eax
+f0103a95:	8e c0                	mov    %eax,%es
+  asm volatile ("movw %%ax,%%ds" :: "a" (GD_KD));
+f0103a97:	8e d8                	mov    %eax,%ds
+  asm volatile ("movw %%ax,%%ss" :: "a" (GD_KD));
+f0103a99:	8e d0                	mov    %eax,%ss
+  asm volatile ("ljmp %0,$1f\n 1:\n" :: "i" (GD_KT));
+f0103a9b:	ea a2 3a 10 f0 08 00 	ljmp   $0x8,$0xf0103aa2
+  __asm __volatile("lldt %0" : : "r" (sel));
+f0103aa2:	b8 00 00 00 00       	mov    $0x0,%eax
+f0103aa7:	0f 00 d0             	lldt   %ax
+}
+f0103aaa:	c3                   	ret
+
+f0103aab <env_init>:
+{
+f0103aab:	55                   	push   %ebp
+f0103aac:	89 e5                	mov    %esp,%ebp
+f0103aae:	56                   	push   %esi
+f0103aaf:	53                   	push   %ebx
+    envs[i].env_status = ENV_FREE;
+f0103ab0:	8b 1d 48 b2 79 f0    	mov    0xf079b248,%ebx
+f0103ab6:	8b 15 4c b2 79 f0    	mov    0xf079b24c,%edx
+f0103abc:	8d 83 70 3f 02 00    	lea    0x23f70(%ebx),%eax
+f0103ac2:	81 eb 90 00 00 00    	sub    $0x90,%ebx
+  for ( i = NENV - 1; i >= 0; i--) {
+f0103ac8:	b9 00 00 00 00       	mov    $0x0,%ecx
+    envs[i].env_link = env_free_list;
+f0103acd:	be 01 00 00 00       	mov    $0x1,%esi
+  for ( i = NENV - 1; i >= 0; i--) {
+f0103ad2:	eb 1c                	jmp    f0103af0 <env_init+0x45>
+    envs[i].env_status = ENV_FREE;
+f0103ad4:	89 c1                	mov    %eax,%ecx
+f0103ad6:	c7 40 54 00 00 00 00 	movl   $0x0,0x54(%eax)
+    envs[i].env_id = 0;
+f0103add:	c7 40 48 00 00 00 00 	movl   $0x0,0x48(%eax)
+    envs[i].env_link = env_free_list;
+f0103ae4:	89 50 44             	mov    %edx,0x44(%eax)
+  for ( i = NENV - 1; i >= 0; i--) {
+f0103ae7:	2d 90 00 00 00       	sub    $0x90,%eax
+    env_free_list = &envs[i];
+f0103aec:	89 ca                	mov    %ecx,%edx
+    envs[i].env_link = env_free_list;
+f0103aee:	89 f1                	mov    %esi,%ecx
+  for ( i = NENV - 1; i >= 0; i--) {
+f0103af0:	39 d8                	cmp    %ebx,%eax
+f0103af2:	75 e0                	jne    f0103ad4 <env_init+0x29>
+f0103af4:	84 c9                	test   %cl,%cl
+f0103af6:	74 06                	je     f0103afe <env_init+0x53>
+f0103af8:	89 15 4c b2 79 f0    	mov    %edx,0xf079b24c
+  env_init_percpu();
+f0103afe:	e8 7c ff ff ff       	call   f0103a7f <env_init_percpu>
+}
+f0103b03:	5b                   	pop    %ebx
+f0103b04:	5e                   	pop    %esi
+f0103b05:	5d                   	pop    %ebp
+f0103b06:	c3                   	ret
+
+f0103b07 <env_alloc>:
+{
+f0103b07:	55                   	push   %ebp
+f0103b08:	89 e5                	mov    %esp,%ebp
+f0103b0a:	53                   	push   %ebx
+f0103b0b:	83 ec 04             	sub    $0x4,%esp
+  struct Env *e = env_free_list;
+f0103b0e:	8b 1d 4c b2 79 f0    	mov    0xf079b24c,%ebx
+  if (!e)
+f0103b14:	85 db                	test   %ebx,%ebx
+f0103b16:	0f 84 5a 01 00 00    	je     f0103c76 <env_alloc+0x16f>
+  p = page_alloc(ALLOC_ZERO);
+f0103b1c:	83 ec 0c             	sub    $0xc,%esp
+f0103b1f:	6a 01                	push   $0x1
+f0103b21:	e8 8b d7 ff ff       	call   f01012b1 <page_alloc>
+  if (!p)
+f0103b26:	83 c4 10             	add    $0x10,%esp
+f0103b29:	85 c0                	test   %eax,%eax
+f0103b2b:	0f 84 4c 01 00 00    	je     f0103c7d <env_alloc+0x176>
+	return (pp - pages) << PGSHIFT;
+f0103b31:	89 c2                	mov    %eax,%edx
+f0103b33:	2b 15 10 bf 79 f0    	sub    0xf079bf10,%edx
+f0103b39:	c1 fa 03             	sar    $0x3,%edx
+f0103b3c:	89 d1                	mov    %edx,%ecx
+f0103b3e:	c1 e1 0c             	shl    $0xc,%ecx
+	if (PGNUM(pa) >= npages)
+f0103b41:	81 e2 ff ff 0f 00    	and    $0xfffff,%edx
+f0103b47:	3b 15 08 bf 79 f0    	cmp    0xf079bf08,%edx
+f0103b4d:	0f 83 fc 00 00 00    	jae    f0103c4f <env_alloc+0x148>
+	return (void *)(pa + KERNBASE);
+f0103b53:	81 e9 00 00 00 10    	sub    $0x10000000,%ecx
+f0103b59:	89 4b 60             	mov    %ecx,0x60(%ebx)
+  (p->pp_ref)++;
+f0103b5c:	66 83 40 04 01       	addw   $0x1,0x4(%eax)
+f0103b61:	b8 ec 0e 00 00       	mov    $0xeec,%eax
+    e->env_pgdir[i] = kern_pgdir[i];
+f0103b66:	8b 15 0c bf 79 f0    	mov    0xf079bf0c,%edx
+f0103b6c:	8b 0c 02             	mov    (%edx,%eax,1),%ecx
+f0103b6f:	8b 53 60             	mov    0x60(%ebx),%edx
+f0103b72:	89 0c 02             	mov    %ecx,(%edx,%eax,1)
+  for (i = PDX(UTOP); i < NPDENTRIES; i++) {
+f0103b75:	83 c0 04             	add    $0x4,%eax
+f0103b78:	3d 00 10 00 00       	cmp    $0x1000,%eax
+f0103b7d:	75 e7                	jne    f0103b66 <env_alloc+0x5f>
+  e->env_pgdir[PDX(UVPT)] = PADDR(e->env_pgdir) | PTE_P | PTE_U;
+f0103b7f:	8b 43 60             	mov    0x60(%ebx),%eax
+	if ((uint32_t)kva < KERNBASE)
+f0103b82:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0103b87:	0f 86 d4 00 00 00    	jbe    f0103c61 <env_alloc+0x15a>
+	return (physaddr_t)kva - KERNBASE;
+f0103b8d:	8d 90 00 00 00 10    	lea    0x10000000(%eax),%edx
+f0103b93:	83 ca 05             	or     $0x5,%edx
+f0103b96:	89 90 f4 0e 00 00    	mov    %edx,0xef4(%eax)
+  int32_t gen = (e->env_id + (1 << ENVGENSHIFT)) & ~(NENV - 1);
+f0103b9c:	8b 43 48             	mov    0x48(%ebx),%eax
+f0103b9f:	05 00 10 00 00       	add    $0x1000,%eax
+    gen = 1 << ENVGENSHIFT;
+f0103ba4:	25 00 fc ff ff       	and    $0xfffffc00,%eax
+f0103ba9:	ba 00 10 00 00       	mov    $0x1000,%edx
+f0103bae:	0f 4e c2             	cmovle %edx,%eax
+  e->env_id = gen | (e - envs);
+f0103bb1:	89 da                	mov    %ebx,%edx
+f0103bb3:	2b 15 48 b2 79 f0    	sub    0xf079b248,%edx
+f0103bb9:	c1 fa 04             	sar    $0x4,%edx
+f0103bbc:	69 d2 39 8e e3 38    	imul   $0x38e38e39,%edx,%edx
+f0103bc2:	09 d0                	or     %edx,%eax
+f0103bc4:	89 43 48             	mov    %eax,0x48(%ebx)
+  e->env_parent_id = parent_id;
+f0103bc7:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0103bca:	89 43 4c             	mov    %eax,0x4c(%ebx)
+  e->env_type = ENV_TYPE_USER;
+f0103bcd:	c7 43 50 00 00 00 00 	movl   $0x0,0x50(%ebx)
+  e->env_status = ENV_RUNNABLE;
+f0103bd4:	c7 43 54 02 00 00 00 	movl   $0x2,0x54(%ebx)
+  e->env_runs = 0;
+f0103bdb:	c7 43 58 00 00 00 00 	movl   $0x0,0x58(%ebx)
+  memset(&e->env_tf, 0, sizeof(e->env_tf));
+f0103be2:	83 ec 04             	sub    $0x4,%esp
+f0103be5:	6a 44                	push   $0x44
+f0103be7:	6a 00                	push   $0x0
+f0103be9:	53                   	push   %ebx
+f0103bea:	e8 8d 3a 00 00       	call   f010767c <memset>
+  e->env_tf.tf_ds = GD_UD | 3;
+f0103bef:	66 c7 43 24 23 00    	movw   $0x23,0x24(%ebx)
+  e->env_tf.tf_es = GD_UD | 3;
+f0103bf5:	66 c7 43 20 23 00    	movw   $0x23,0x20(%ebx)
+  e->env_tf.tf_ss = GD_UD | 3;
+f0103bfb:	66 c7 43 40 23 00    	movw   $0x23,0x40(%ebx)
+  e->env_tf.tf_esp = USTACKTOP;
+f0103c01:	c7 43 3c 00 e0 bf ee 	movl   $0xeebfe000,0x3c(%ebx)
+  e->env_tf.tf_cs = GD_UT | 3;
+f0103c08:	66 c7 43 34 1b 00    	movw   $0x1b,0x34(%ebx)
+  e->env_tf.tf_eflags |= FL_IF;
+f0103c0e:	81 4b 38 00 02 00 00 	orl    $0x200,0x38(%ebx)
+  e->env_pgfault_upcall = 0;
+f0103c15:	c7 43 64 00 00 00 00 	movl   $0x0,0x64(%ebx)
+  e->env_uxstacktop = UXSTACKTOP;
+f0103c1c:	c7 43 68 00 00 c0 ee 	movl   $0xeec00000,0x68(%ebx)
+  e->env_ipc_recving = 0;
+f0103c23:	c6 43 6d 00          	movb   $0x0,0x6d(%ebx)
+  e->env_sleep_chan = 0;
+f0103c27:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+f0103c2e:	00 00 00 
+  e->env_kern_cow = 0;
+f0103c31:	c6 43 6c 00          	movb   $0x0,0x6c(%ebx)
+  env_free_list = e->env_link;
+f0103c35:	8b 43 44             	mov    0x44(%ebx),%eax
+f0103c38:	a3 4c b2 79 f0       	mov    %eax,0xf079b24c
+  *newenv_store = e;
+f0103c3d:	8b 45 08             	mov    0x8(%ebp),%eax
+f0103c40:	89 18                	mov    %ebx,(%eax)
+  return 0;
+f0103c42:	83 c4 10             	add    $0x10,%esp
+f0103c45:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0103c4a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0103c4d:	c9                   	leave
+f0103c4e:	c3                   	ret
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0103c4f:	51                   	push   %ecx
+f0103c50:	68 c4 82 10 f0       	push   $0xf01082c4
+f0103c55:	6a 5f                	push   $0x5f
+f0103c57:	68 29 96 10 f0       	push   $0xf0109629
+f0103c5c:	e8 df c3 ff ff       	call   f0100040 <_panic>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0103c61:	50                   	push   %eax
+f0103c62:	68 e8 82 10 f0       	push   $0xf01082e8
+f0103c67:	68 cc 00 00 00       	push   $0xcc
+f0103c6c:	68 fa 99 10 f0       	push   $0xf01099fa
+f0103c71:	e8 ca c3 ff ff       	call   f0100040 <_panic>
+    return -E_NO_FREE_ENV;
+f0103c76:	b8 fb ff ff ff       	mov    $0xfffffffb,%eax
+f0103c7b:	eb cd                	jmp    f0103c4a <env_alloc+0x143>
+    return -E_NO_MEM;
+f0103c7d:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+f0103c82:	eb c6                	jmp    f0103c4a <env_alloc+0x143>
+
+f0103c84 <env_create>:
+// before running the first user-mode environment.
+// The new env's parent ID is set to 0.
+//
+void
+env_create(uint8_t *binary, enum EnvType type)
+{
+f0103c84:	55                   	push   %ebp
+f0103c85:	89 e5                	mov    %esp,%ebp
+f0103c87:	57                   	push   %edi
+f0103c88:	56                   	push   %esi
+f0103c89:	53                   	push   %ebx
+f0103c8a:	83 ec 24             	sub    $0x24,%esp
+  // LAB 3: Your code here.
+  struct Env *env;
+
+  env_alloc(&env, 0);
+f0103c8d:	6a 00                	push   $0x0
+f0103c8f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0103c92:	50                   	push   %eax
+f0103c93:	e8 6f fe ff ff       	call   f0103b07 <env_alloc>
+
+  if (env) {
+f0103c98:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f0103c9b:	83 c4 10             	add    $0x10,%esp
+f0103c9e:	85 ff                	test   %edi,%edi
+f0103ca0:	0f 84 18 01 00 00    	je     f0103dbe <env_create+0x13a>
+  if (elf->e_magic != ELF_MAGIC) {
+f0103ca6:	8b 45 08             	mov    0x8(%ebp),%eax
+f0103ca9:	81 38 7f 45 4c 46    	cmpl   $0x464c457f,(%eax)
+f0103caf:	75 25                	jne    f0103cd6 <env_create+0x52>
+  ph = (struct Proghdr *)((uint8_t *) elf + elf->e_phoff);
+f0103cb1:	8b 45 08             	mov    0x8(%ebp),%eax
+f0103cb4:	89 c3                	mov    %eax,%ebx
+f0103cb6:	03 58 1c             	add    0x1c(%eax),%ebx
+  ph_end = ph + elf->e_phnum;
+f0103cb9:	0f b7 70 2c          	movzwl 0x2c(%eax),%esi
+f0103cbd:	c1 e6 05             	shl    $0x5,%esi
+f0103cc0:	01 de                	add    %ebx,%esi
+  lcr3(PADDR(e->env_pgdir));
+f0103cc2:	8b 47 60             	mov    0x60(%edi),%eax
+	if ((uint32_t)kva < KERNBASE)
+f0103cc5:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0103cca:	76 21                	jbe    f0103ced <env_create+0x69>
+	return (physaddr_t)kva - KERNBASE;
+f0103ccc:	05 00 00 00 10       	add    $0x10000000,%eax
+  __asm __volatile("movl %0,%%cr3" : : "r" (val));
+f0103cd1:	0f 22 d8             	mov    %eax,%cr3
+}
+f0103cd4:	eb 7f                	jmp    f0103d55 <env_create+0xd1>
+    panic("load_icode failed: elf header didn't have the magic");
+f0103cd6:	83 ec 04             	sub    $0x4,%esp
+f0103cd9:	68 7c 99 10 f0       	push   $0xf010997c
+f0103cde:	68 83 01 00 00       	push   $0x183
+f0103ce3:	68 fa 99 10 f0       	push   $0xf01099fa
+f0103ce8:	e8 53 c3 ff ff       	call   f0100040 <_panic>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0103ced:	50                   	push   %eax
+f0103cee:	68 e8 82 10 f0       	push   $0xf01082e8
+f0103cf3:	68 8b 01 00 00       	push   $0x18b
+f0103cf8:	68 fa 99 10 f0       	push   $0xf01099fa
+f0103cfd:	e8 3e c3 ff ff       	call   f0100040 <_panic>
+      panic("load_icode failed: p_filesz > p_memsz");
+f0103d02:	83 ec 04             	sub    $0x4,%esp
+f0103d05:	68 b0 99 10 f0       	push   $0xf01099b0
+f0103d0a:	68 91 01 00 00       	push   $0x191
+f0103d0f:	68 fa 99 10 f0       	push   $0xf01099fa
+f0103d14:	e8 27 c3 ff ff       	call   f0100040 <_panic>
+      region_alloc(e, (void *) ph->p_va, ph->p_memsz);
+f0103d19:	8b 53 08             	mov    0x8(%ebx),%edx
+f0103d1c:	89 f8                	mov    %edi,%eax
+f0103d1e:	e8 56 fc ff ff       	call   f0103979 <region_alloc>
+      memmove((void *) ph->p_va, binary + ph->p_offset, ph->p_filesz);
+f0103d23:	83 ec 04             	sub    $0x4,%esp
+f0103d26:	ff 73 10             	push   0x10(%ebx)
+f0103d29:	8b 45 08             	mov    0x8(%ebp),%eax
+f0103d2c:	03 43 04             	add    0x4(%ebx),%eax
+f0103d2f:	50                   	push   %eax
+f0103d30:	ff 73 08             	push   0x8(%ebx)
+f0103d33:	e8 79 39 00 00       	call   f01076b1 <memmove>
+      memset((void *) ph->p_va + ph->p_filesz, 0, (ph->p_memsz - ph->p_filesz));
+f0103d38:	8b 43 10             	mov    0x10(%ebx),%eax
+f0103d3b:	83 c4 0c             	add    $0xc,%esp
+f0103d3e:	8b 53 14             	mov    0x14(%ebx),%edx
+f0103d41:	29 c2                	sub    %eax,%edx
+f0103d43:	52                   	push   %edx
+f0103d44:	6a 00                	push   $0x0
+f0103d46:	03 43 08             	add    0x8(%ebx),%eax
+f0103d49:	50                   	push   %eax
+f0103d4a:	e8 2d 39 00 00       	call   f010767c <memset>
+f0103d4f:	83 c4 10             	add    $0x10,%esp
+  for ( ; ph < ph_end; ph++) {
+f0103d52:	83 c3 20             	add    $0x20,%ebx
+f0103d55:	39 f3                	cmp    %esi,%ebx
+f0103d57:	73 0f                	jae    f0103d68 <env_create+0xe4>
+    if (ph->p_filesz > ph->p_memsz) {
+f0103d59:	8b 4b 14             	mov    0x14(%ebx),%ecx
+f0103d5c:	3b 4b 10             	cmp    0x10(%ebx),%ecx
+f0103d5f:	72 a1                	jb     f0103d02 <env_create+0x7e>
+    if (ph->p_type == ELF_PROG_LOAD) {
+f0103d61:	83 3b 01             	cmpl   $0x1,(%ebx)
+f0103d64:	75 ec                	jne    f0103d52 <env_create+0xce>
+f0103d66:	eb b1                	jmp    f0103d19 <env_create+0x95>
+  e->env_tf.tf_eip = elf->e_entry;
+f0103d68:	8b 45 08             	mov    0x8(%ebp),%eax
+f0103d6b:	8b 40 18             	mov    0x18(%eax),%eax
+f0103d6e:	89 47 30             	mov    %eax,0x30(%edi)
+  region_alloc(e, (void *) (USTACKTOP - PGSIZE), PGSIZE);
+f0103d71:	b9 00 10 00 00       	mov    $0x1000,%ecx
+f0103d76:	ba 00 d0 bf ee       	mov    $0xeebfd000,%edx
+f0103d7b:	89 f8                	mov    %edi,%eax
+f0103d7d:	e8 f7 fb ff ff       	call   f0103979 <region_alloc>
+  lcr3(PADDR(kern_pgdir));
+f0103d82:	a1 0c bf 79 f0       	mov    0xf079bf0c,%eax
+	if ((uint32_t)kva < KERNBASE)
+f0103d87:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0103d8c:	76 1b                	jbe    f0103da9 <env_create+0x125>
+	return (physaddr_t)kva - KERNBASE;
+f0103d8e:	05 00 00 00 10       	add    $0x10000000,%eax
+  __asm __volatile("movl %0,%%cr3" : : "r" (val));
+f0103d93:	0f 22 d8             	mov    %eax,%cr3
+    load_icode(env, binary);
+    env->env_type = type;
+f0103d96:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0103d99:	89 47 50             	mov    %eax,0x50(%edi)
+    panic("env_create: env_allocation failed");
+  }
+
+  // If this is the file server (type == ENV_TYPE_FS) give it I/O privileges.
+  // LAB 5: Your code here.
+  if (type == ENV_TYPE_FS) {
+f0103d9c:	83 f8 01             	cmp    $0x1,%eax
+f0103d9f:	74 34                	je     f0103dd5 <env_create+0x151>
+    env->env_tf.tf_eflags |= FL_IOPL_MASK;
+  }
+}
+f0103da1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0103da4:	5b                   	pop    %ebx
+f0103da5:	5e                   	pop    %esi
+f0103da6:	5f                   	pop    %edi
+f0103da7:	5d                   	pop    %ebp
+f0103da8:	c3                   	ret
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0103da9:	50                   	push   %eax
+f0103daa:	68 e8 82 10 f0       	push   $0xf01082e8
+f0103daf:	68 a6 01 00 00       	push   $0x1a6
+f0103db4:	68 fa 99 10 f0       	push   $0xf01099fa
+f0103db9:	e8 82 c2 ff ff       	call   f0100040 <_panic>
+    panic("env_create: env_allocation failed");
+f0103dbe:	83 ec 04             	sub    $0x4,%esp
+f0103dc1:	68 d8 99 10 f0       	push   $0xf01099d8
+f0103dc6:	68 bc 01 00 00       	push   $0x1bc
+f0103dcb:	68 fa 99 10 f0       	push   $0xf01099fa
+f0103dd0:	e8 6b c2 ff ff       	call   f0100040 <_panic>
+    env->env_tf.tf_eflags |= FL_IOPL_MASK;
+f0103dd5:	81 4f 38 00 30 00 00 	orl    $0x3000,0x38(%edi)
+}
+f0103ddc:	eb c3                	jmp    f0103da1 <env_create+0x11d>
+
+f0103dde <env_free>:
+//
+// Frees env e and all memory it uses.
+//
+void
+env_free(struct Env *e)
+{
+f0103dde:	55                   	push   %ebp
+f0103ddf:	89 e5                	mov    %esp,%ebp
+f0103de1:	57                   	push   %edi
+f0103de2:	56                   	push   %esi
+f0103de3:	53                   	push   %ebx
+f0103de4:	83 ec 1c             	sub    $0x1c,%esp
+  physaddr_t pa;
+
+  // If freeing the current environment, switch to kern_pgdir
+  // before freeing the page directory, just in case the page
+  // gets reused.
+  if (e == curenv)
+f0103de7:	e8 73 3e 00 00       	call   f0107c5f <cpunum>
+f0103dec:	6b c0 74             	imul   $0x74,%eax,%eax
+f0103def:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f0103df2:	39 88 28 c0 79 f0    	cmp    %ecx,-0xf863fd8(%eax)
+f0103df8:	74 4b                	je     f0103e45 <env_free+0x67>
+
+  // Note the environment's demise.
+  // cprintf("[%08x] free env %08x\n", curenv ? curenv->env_id : 0, e->env_id);
+
+  // Stop delivering interrupts to it.
+  irq_release(e);
+f0103dfa:	83 ec 0c             	sub    $0xc,%esp
+f0103dfd:	ff 75 08             	push   0x8(%ebp)
+f0103e00:	e8 50 10 00 00       	call   f0104e55 <irq_release>
+
+  // An address space shared with other environments (sys_thread_create)
+  // stays theirs; just drop our reference to it.
+  if (pa2page(PADDR(e->env_pgdir))->pp_ref > 1)
+f0103e05:	8b 45 08             	mov    0x8(%ebp),%eax
+f0103e08:	8b 40 60             	mov    0x60(%eax),%eax
+	if ((uint32_t)kva < KERNBASE)
+f0103e0b:	89 c2                	mov    %eax,%edx
+f0103e0d:	83 c4 10             	add    $0x10,%esp
+f0103e10:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0103e15:	76 59                	jbe    f0103e70 <env_free+0x92>
+	return (physaddr_t)kva - KERNBASE;
+f0103e17:	05 00 00 00 10       	add    $0x10000000,%eax
+	if (PGNUM(pa) >= npages)
+f0103e1c:	c1 e8 0c             	shr    $0xc,%eax
+f0103e1f:	3b 05 08 bf 79 f0    	cmp    0xf079bf08,%eax
+f0103e25:	73 5e                	jae    f0103e85 <env_free+0xa7>
+f0103e27:	8b 0d 10 bf 79 f0    	mov    0xf079bf10,%ecx
+f0103e2d:	66 83 7c c1 04 01    	cmpw   $0x1,0x4(%ecx,%eax,8)
+f0103e33:	0f 87 a2 01 00 00    	ja     f0103fdb <env_free+0x1fd>
+f0103e39:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+f0103e40:	e9 0d 01 00 00       	jmp    f0103f52 <env_free+0x174>
+    lcr3(PADDR(kern_pgdir));
+f0103e45:	a1 0c bf 79 f0       	mov    0xf079bf0c,%eax
+	if ((uint32_t)kva < KERNBASE)
+f0103e4a:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0103e4f:	76 0a                	jbe    f0103e5b <env_free+0x7d>
+	return (physaddr_t)kva - KERNBASE;
+f0103e51:	05 00 00 00 10       	add    $0x10000000,%eax
+f0103e56:	0f 22 d8             	mov    %eax,%cr3
+}
+f0103e59:	eb 9f                	jmp    f0103dfa <env_free+0x1c>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0103e5b:	50                   	push   %eax
+f0103e5c:	68 e8 82 10 f0       	push   $0xf01082e8
+f0103e61:	68 d4 01 00 00       	push   $0x1d4
+f0103e66:	68 fa 99 10 f0       	push   $0xf01099fa
+f0103e6b:	e8 d0 c1 ff ff       	call   f0100040 <_panic>
+f0103e70:	50                   	push   %eax
+f0103e71:	68 e8 82 10 f0       	push   $0xf01082e8
+f0103e76:	68 de 01 00 00       	push   $0x1de
+f0103e7b:	68 fa 99 10 f0       	push   $0xf01099fa
+f0103e80:	e8 bb c1 ff ff       	call   f0100040 <_panic>
+		panic("pa2page called with invalid pa");
+f0103e85:	83 ec 04             	sub    $0x4,%esp
+f0103e88:	68 bc 8d 10 f0       	push   $0xf0108dbc
+f0103e8d:	6a 58                	push   $0x58
+f0103e8f:	68 29 96 10 f0       	push   $0xf0109629
+f0103e94:	e8 a7 c1 ff ff       	call   f0100040 <_panic>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0103e99:	56                   	push   %esi
+f0103e9a:	68 c4 82 10 f0       	push   $0xf01082c4
+f0103e9f:	68 eb 01 00 00       	push   $0x1eb
+f0103ea4:	68 fa 99 10 f0       	push   $0xf01099fa
+f0103ea9:	e8 92 c1 ff ff       	call   f0100040 <_panic>
+    pt = (pte_t*)KADDR(pa);
+
+    // a page table still shared with other environments keeps its
+    // mappings; just drop our reference to it
+    if ((e->env_pgdir[pdeno] & PDE_SHARED) && pa2page(pa)->pp_ref > 1) {
+      e->env_pgdir[pdeno] = 0;
+f0103eae:	c7 02 00 00 00 00    	movl   $0x0,(%edx)
+	if (PGNUM(pa) >= npages)
+f0103eb4:	3b 05 08 bf 79 f0    	cmp    0xf079bf08,%eax
+f0103eba:	73 14                	jae    f0103ed0 <env_free+0xf2>
+      page_decref(pa2page(pa));
+f0103ebc:	83 ec 0c             	sub    $0xc,%esp
+	return &pages[PGNUM(pa)];
+f0103ebf:	03 0d 10 bf 79 f0    	add    0xf079bf10,%ecx
+f0103ec5:	51                   	push   %ecx
+f0103ec6:	e8 bb d5 ff ff       	call   f0101486 <page_decref>
+      continue;
+f0103ecb:	83 c4 10             	add    $0x10,%esp
+f0103ece:	eb 74                	jmp    f0103f44 <env_free+0x166>
+		panic("pa2page called with invalid pa");
+f0103ed0:	83 ec 04             	sub    $0x4,%esp
+f0103ed3:	68 bc 8d 10 f0       	push   $0xf0108dbc
+f0103ed8:	6a 58                	push   $0x58
+f0103eda:	68 29 96 10 f0       	push   $0xf0109629
+f0103edf:	e8 5c c1 ff ff       	call   f0100040 <_panic>
+    }
+
+    // unmap all PTEs in this page table
+    for (pteno = 0; pteno <= PTX(~0); pteno++)
+f0103ee4:	83 c6 04             	add    $0x4,%esi
+f0103ee7:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f0103eed:	81 fb 00 00 40 00    	cmp    $0x400000,%ebx
+f0103ef3:	74 1b                	je     f0103f10 <env_free+0x132>
+      if (pt[pteno] & PTE_P)
+f0103ef5:	f6 06 01             	testb  $0x1,(%esi)
+f0103ef8:	74 ea                	je     f0103ee4 <env_free+0x106>
+        page_remove(e->env_pgdir, PGADDR(pdeno, pteno, 0));
+f0103efa:	83 ec 08             	sub    $0x8,%esp
+f0103efd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0103f00:	09 d8                	or     %ebx,%eax
+f0103f02:	50                   	push   %eax
+f0103f03:	ff 77 60             	push   0x60(%edi)
+f0103f06:	e8 9e d9 ff ff       	call   f01018a9 <page_remove>
+f0103f0b:	83 c4 10             	add    $0x10,%esp
+f0103f0e:	eb d4                	jmp    f0103ee4 <env_free+0x106>
+
+    // free the page table itself
+    e->env_pgdir[pdeno] = 0;
+f0103f10:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f0103f13:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f0103f16:	8b 51 60             	mov    0x60(%ecx),%edx
+f0103f19:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+f0103f1c:	c7 04 0a 00 00 00 00 	movl   $0x0,(%edx,%ecx,1)
+	if (PGNUM(pa) >= npages)
+f0103f23:	3b 05 08 bf 79 f0    	cmp    0xf079bf08,%eax
+f0103f29:	0f 83 89 00 00 00    	jae    f0103fb8 <env_free+0x1da>
+    page_decref(pa2page(pa));
+f0103f2f:	83 ec 0c             	sub    $0xc,%esp
+	return &pages[PGNUM(pa)];
+f0103f32:	8b 15 10 bf 79 f0    	mov    0xf079bf10,%edx
+f0103f38:	8d 04 c2             	lea    (%edx,%eax,8),%eax
+f0103f3b:	50                   	push   %eax
+f0103f3c:	e8 45 d5 ff ff       	call   f0101486 <page_decref>
+f0103f41:	83 c4 10             	add    $0x10,%esp
+  for (pdeno = 0; pdeno < PDX(UTOP); pdeno++) {
+f0103f44:	83 45 e0 04          	addl   $0x4,-0x20(%ebp)
+f0103f48:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0103f4b:	3d ec 0e 00 00       	cmp    $0xeec,%eax
+f0103f50:	74 7a                	je     f0103fcc <env_free+0x1ee>
+    if (!(e->env_pgdir[pdeno] & PTE_P))
+f0103f52:	8b 45 08             	mov    0x8(%ebp),%eax
+f0103f55:	8b 55 e0             	mov    -0x20(%ebp),%edx
+f0103f58:	03 50 60             	add    0x60(%eax),%edx
+f0103f5b:	8b 0a                	mov    (%edx),%ecx
+f0103f5d:	f6 c1 01             	test   $0x1,%cl
+f0103f60:	74 e2                	je     f0103f44 <env_free+0x166>
+    pa = PTE_ADDR(e->env_pgdir[pdeno]);
+f0103f62:	89 ce                	mov    %ecx,%esi
+f0103f64:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+	if (PGNUM(pa) >= npages)
+f0103f6a:	89 c8                	mov    %ecx,%eax
+f0103f6c:	c1 e8 0c             	shr    $0xc,%eax
+f0103f6f:	3b 05 08 bf 79 f0    	cmp    0xf079bf08,%eax
+f0103f75:	0f 83 1e ff ff ff    	jae    f0103e99 <env_free+0xbb>
+    if ((e->env_pgdir[pdeno] & PDE_SHARED) && pa2page(pa)->pp_ref > 1) {
+f0103f7b:	f6 c5 08             	test   $0x8,%ch
+f0103f7e:	74 19                	je     f0103f99 <env_free+0x1bb>
+	return &pages[PGNUM(pa)];
+f0103f80:	8d 0c c5 00 00 00 00 	lea    0x0(,%eax,8),%ecx
+f0103f87:	8b 1d 10 bf 79 f0    	mov    0xf079bf10,%ebx
+f0103f8d:	66 83 7c c3 04 01    	cmpw   $0x1,0x4(%ebx,%eax,8)
+f0103f93:	0f 87 15 ff ff ff    	ja     f0103eae <env_free+0xd0>
+	return (void *)(pa + KERNBASE);
+f0103f99:	81 ee 00 00 00 10    	sub    $0x10000000,%esi
+f0103f9f:	8b 7d e0             	mov    -0x20(%ebp),%edi
+f0103fa2:	c1 e7 14             	shl    $0x14,%edi
+f0103fa5:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0103faa:	89 7d e4             	mov    %edi,-0x1c(%ebp)
+f0103fad:	89 45 dc             	mov    %eax,-0x24(%ebp)
+f0103fb0:	8b 7d 08             	mov    0x8(%ebp),%edi
+f0103fb3:	e9 3d ff ff ff       	jmp    f0103ef5 <env_free+0x117>
+		panic("pa2page called with invalid pa");
+f0103fb8:	83 ec 04             	sub    $0x4,%esp
+f0103fbb:	68 bc 8d 10 f0       	push   $0xf0108dbc
+f0103fc0:	6a 58                	push   $0x58
+f0103fc2:	68 29 96 10 f0       	push   $0xf0109629
+f0103fc7:	e8 74 c0 ff ff       	call   f0100040 <_panic>
+  }
+
+  // free the page directory
+free_pgdir:
+  pa = PADDR(e->env_pgdir);
+f0103fcc:	8b 45 08             	mov    0x8(%ebp),%eax
+f0103fcf:	8b 40 60             	mov    0x60(%eax),%eax
+	if ((uint32_t)kva < KERNBASE)
+f0103fd2:	89 c2                	mov    %eax,%edx
+f0103fd4:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0103fd9:	76 53                	jbe    f010402e <env_free+0x250>
+  e->env_pgdir = 0;
+f0103fdb:	8b 45 08             	mov    0x8(%ebp),%eax
+f0103fde:	c7 40 60 00 00 00 00 	movl   $0x0,0x60(%eax)
+	return (physaddr_t)kva - KERNBASE;
+f0103fe5:	8d 82 00 00 00 10    	lea    0x10000000(%edx),%eax
+	if (PGNUM(pa) >= npages)
+f0103feb:	c1 e8 0c             	shr    $0xc,%eax
+f0103fee:	3b 05 08 bf 79 f0    	cmp    0xf079bf08,%eax
+f0103ff4:	73 4d                	jae    f0104043 <env_free+0x265>
+  page_decref(pa2page(pa));
+f0103ff6:	83 ec 0c             	sub    $0xc,%esp
+	return &pages[PGNUM(pa)];
+f0103ff9:	8b 15 10 bf 79 f0    	mov    0xf079bf10,%edx
+f0103fff:	8d 04 c2             	lea    (%edx,%eax,8),%eax
+f0104002:	50                   	push   %eax
+f0104003:	e8 7e d4 ff ff       	call   f0101486 <page_decref>
+
+  // return the environment to the free list
+  e->env_status = ENV_FREE;
+f0104008:	8b 45 08             	mov    0x8(%ebp),%eax
+f010400b:	c7 40 54 00 00 00 00 	movl   $0x0,0x54(%eax)
+  e->env_link = env_free_list;
+f0104012:	a1 4c b2 79 f0       	mov    0xf079b24c,%eax
+f0104017:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f010401a:	89 41 44             	mov    %eax,0x44(%ecx)
+  env_free_list = e;
+f010401d:	89 0d 4c b2 79 f0    	mov    %ecx,0xf079b24c
+}
+f0104023:	83 c4 10             	add    $0x10,%esp
+f0104026:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0104029:	5b                   	pop    %ebx
+f010402a:	5e                   	pop    %esi
+f010402b:	5f                   	pop    %edi
+f010402c:	5d                   	pop    %ebp
+f010402d:	c3                   	ret
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f010402e:	50                   	push   %eax
+f010402f:	68 e8 82 10 f0       	push   $0xf01082e8
+f0104034:	68 01 02 00 00       	push   $0x201
+f0104039:	68 fa 99 10 f0       	push   $0xf01099fa
+f010403e:	e8 fd bf ff ff       	call   f0100040 <_panic>
+		panic("pa2page called with invalid pa");
+f0104043:	83 ec 04             	sub    $0x4,%esp
+f0104046:	68 bc 8d 10 f0       	push   $0xf0108dbc
+f010404b:	6a 58                	push   $0x58
+f010404d:	68 29 96 10 f0       	push   $0xf0109629
+f0104052:	e8 e9 bf ff ff       	call   f0100040 <_panic>
+
+f0104057 <env_destroy>:
+// If e was the current env, then runs a new environment (and does not return
+// to the caller).
+//
+void
+env_destroy(struct Env *e)
+{
+f0104057:	55                   	push   %ebp
+f0104058:	89 e5                	mov    %esp,%ebp
+f010405a:	53                   	push   %ebx
+f010405b:	83 ec 04             	sub    $0x4,%esp
+f010405e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  // If e is currently running on other CPUs, we change its state to
+  // ENV_DYING. A zombie environment will be freed the next time
+  // it traps to the kernel.
+  if (e->env_status == ENV_RUNNING && curenv != e) {
+f0104061:	83 7b 54 03          	cmpl   $0x3,0x54(%ebx)
+f0104065:	74 21                	je     f0104088 <env_destroy+0x31>
+    e->env_status = ENV_DYING;
+    return;
+  }
+
+  env_free(e);
+f0104067:	83 ec 0c             	sub    $0xc,%esp
+f010406a:	53                   	push   %ebx
+f010406b:	e8 6e fd ff ff       	call   f0103dde <env_free>
+
+  if (curenv == e) {
+f0104070:	e8 ea 3b 00 00       	call   f0107c5f <cpunum>
+f0104075:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104078:	83 c4 10             	add    $0x10,%esp
+f010407b:	39 98 28 c0 79 f0    	cmp    %ebx,-0xf863fd8(%eax)
+f0104081:	74 1e                	je     f01040a1 <env_destroy+0x4a>
+    curenv = NULL;
+    sched_yield();
+  }
+}
+f0104083:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0104086:	c9                   	leave
+f0104087:	c3                   	ret
+  if (e->env_status == ENV_RUNNING && curenv != e) {
+f0104088:	e8 d2 3b 00 00       	call   f0107c5f <cpunum>
+f010408d:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104090:	39 98 28 c0 79 f0    	cmp    %ebx,-0xf863fd8(%eax)
+f0104096:	74 cf                	je     f0104067 <env_destroy+0x10>
+    e->env_status = ENV_DYING;
+f0104098:	c7 43 54 01 00 00 00 	movl   $0x1,0x54(%ebx)
+    return;
+f010409f:	eb e2                	jmp    f0104083 <env_destroy+0x2c>
+    curenv = NULL;
+f01040a1:	e8 b9 3b 00 00       	call   f0107c5f <cpunum>
+f01040a6:	6b c0 74             	imul   $0x74,%eax,%eax
+f01040a9:	c7 80 28 c0 79 f0 00 	movl   $0x0,-0xf863fd8(%eax)
+f01040b0:	00 00 00 
+    sched_yield();
+f01040b3:	e8 24 14 00 00       	call   f01054dc <sched_yield>
+
+f01040b8 <env_wakeup>:
+// Wake environment e from sys_chan_sleep.  The sleep system call will
+// appear to return 'ret'.
+//
+void
+env_wakeup(struct Env *e, int32_t ret)
+{
+f01040b8:	55                   	push   %ebp
+f01040b9:	89 e5                	mov    %esp,%ebp
+f01040bb:	8b 45 08             	mov    0x8(%ebp),%eax
+  e->env_sleep_chan = 0;
+f01040be:	c7 80 84 00 00 00 00 	movl   $0x0,0x84(%eax)
+f01040c5:	00 00 00 
+  e->env_tf.tf_regs.reg_eax = ret;
+f01040c8:	8b 55 0c             	mov    0xc(%ebp),%edx
+f01040cb:	89 50 1c             	mov    %edx,0x1c(%eax)
+  e->env_status = ENV_RUNNABLE;
+f01040ce:	c7 40 54 02 00 00 00 	movl   $0x2,0x54(%eax)
+}
+f01040d5:	5d                   	pop    %ebp
+f01040d6:	c3                   	ret
+
+f01040d7 <env_wakeup_chan>:
+// Wake every environment sleeping on wait channel 'chan' (a physical
+// address).  Returns the number woken.
+//
+int
+env_wakeup_chan(physaddr_t chan)
+{
+f01040d7:	55                   	push   %ebp
+f01040d8:	89 e5                	mov    %esp,%ebp
+f01040da:	56                   	push   %esi
+f01040db:	53                   	push   %ebx
+f01040dc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int i, woken;
+
+  woken = 0;
+  for (i = 0; i < NENV; i++)
+    if (envs[i].env_status == ENV_NOT_RUNNABLE &&
+f01040df:	8b 0d 48 b2 79 f0    	mov    0xf079b248,%ecx
+f01040e5:	8d 41 1c             	lea    0x1c(%ecx),%eax
+f01040e8:	81 c1 1c 40 02 00    	add    $0x2401c,%ecx
+  woken = 0;
+f01040ee:	be 00 00 00 00       	mov    $0x0,%esi
+  for (i = 0; i < NENV; i++)
+f01040f3:	eb 05                	jmp    f01040fa <env_wakeup_chan+0x23>
+f01040f5:	05 90 00 00 00       	add    $0x90,%eax
+f01040fa:	39 c8                	cmp    %ecx,%eax
+f01040fc:	74 24                	je     f0104122 <env_wakeup_chan+0x4b>
+    if (envs[i].env_status == ENV_NOT_RUNNABLE &&
+f01040fe:	83 78 38 04          	cmpl   $0x4,0x38(%eax)
+f0104102:	75 f1                	jne    f01040f5 <env_wakeup_chan+0x1e>
+f0104104:	39 58 68             	cmp    %ebx,0x68(%eax)
+f0104107:	75 ec                	jne    f01040f5 <env_wakeup_chan+0x1e>
+  e->env_sleep_chan = 0;
+f0104109:	c7 40 68 00 00 00 00 	movl   $0x0,0x68(%eax)
+  e->env_tf.tf_regs.reg_eax = ret;
+f0104110:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+  e->env_status = ENV_RUNNABLE;
+f0104116:	c7 40 38 02 00 00 00 	movl   $0x2,0x38(%eax)
+        envs[i].env_sleep_chan == chan) {
+      env_wakeup(&envs[i], 0);
+      woken++;
+f010411d:	83 c6 01             	add    $0x1,%esi
+f0104120:	eb d3                	jmp    f01040f5 <env_wakeup_chan+0x1e>
+    }
+  return woken;
+}
+f0104122:	89 f0                	mov    %esi,%eax
+f0104124:	5b                   	pop    %ebx
+f0104125:	5e                   	pop    %esi
+f0104126:	5d                   	pop    %ebp
+f0104127:	c3                   	ret
+
+f0104128 <env_pop_tf>:
+//
+// This function does not return.
+//
+void
+env_pop_tf(struct Trapframe *tf)
+{
+f0104128:	55                   	push   %ebp
+f0104129:	89 e5                	mov    %esp,%ebp
+f010412b:	53                   	push   %ebx
+f010412c:	83 ec 04             	sub    $0x4,%esp
+  // Record the CPU we are running on for user-space debugging
+  curenv->env_cpunum = cpunum();
+f010412f:	e8 2b 3b 00 00       	call   f0107c5f <cpunum>
+f0104134:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104137:	8b 98 28 c0 79 f0    	mov    -0xf863fd8(%eax),%ebx
+f010413d:	e8 1d 3b 00 00       	call   f0107c5f <cpunum>
+f0104142:	89 43 5c             	mov    %eax,0x5c(%ebx)
+
+  __asm __volatile("movl %0,%%esp\n"
+f0104145:	8b 65 08             	mov    0x8(%ebp),%esp
+f0104148:	61                   	popa
+f0104149:	07                   	pop    %es
+f010414a:	1f                   	pop    %ds
+f010414b:	83 c4 08             	add    $0x8,%esp
+f010414e:	cf                   	iret
+                   "\tpopl %%es\n"
+                   "\tpopl %%ds\n"
+                   "\taddl $0x8,%%esp\n" /* skip tf_trapno and tf_errcode */
+                   "\tiret"
+                   : : "g" (tf) : "memory");
+  panic("iret failed");        /* mostly to placate the compiler */
+f010414f:	83 ec 04             	sub    $0x4,%esp
+f0104152:	68 05 9a 10 f0       	push   $0xf0109a05
+f0104157:	68 56 02 00 00       	push   $0x256
+f010415c:	68 fa 99 10 f0       	push   $0xf01099fa
+f0104161:	e8 da be ff ff       	call   f0100040 <_panic>
+
+f0104166 <env_run>:
+//
+// This function does not return.
+//
+void
+env_run(struct Env *e)
+{
+f0104166:	55                   	push   %ebp
+f0104167:	89 e5                	mov    %esp,%ebp
+f0104169:	53                   	push   %ebx
+f010416a:	83 ec 04             	sub    $0x4,%esp
+f010416d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  //	e->env_tf.  Go back through the code you wrote above
+  //	and make sure you have set the relevant parts of
+  //	e->env_tf to sensible values.
+
+  // LAB 3: Your code here.
+  if (!curenv || curenv->env_id != e->env_id) {
+f0104170:	e8 ea 3a 00 00       	call   f0107c5f <cpunum>
+f0104175:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104178:	83 b8 28 c0 79 f0 00 	cmpl   $0x0,-0xf863fd8(%eax)
+f010417f:	74 1a                	je     f010419b <env_run+0x35>
+f0104181:	e8 d9 3a 00 00       	call   f0107c5f <cpunum>
+f0104186:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104189:	8b 80 28 c0 79 f0    	mov    -0xf863fd8(%eax),%eax
+f010418f:	8b 4b 48             	mov    0x48(%ebx),%ecx
+f0104192:	39 48 48             	cmp    %ecx,0x48(%eax)
+f0104195:	0f 84 93 00 00 00    	je     f010422e <env_run+0xc8>
+    if (curenv && curenv->env_status == ENV_RUNNING) {
+f010419b:	e8 bf 3a 00 00       	call   f0107c5f <cpunum>
+f01041a0:	6b c0 74             	imul   $0x74,%eax,%eax
+f01041a3:	83 b8 28 c0 79 f0 00 	cmpl   $0x0,-0xf863fd8(%eax)
+f01041aa:	74 14                	je     f01041c0 <env_run+0x5a>
+f01041ac:	e8 ae 3a 00 00       	call   f0107c5f <cpunum>
+f01041b1:	6b c0 74             	imul   $0x74,%eax,%eax
+f01041b4:	8b 80 28 c0 79 f0    	mov    -0xf863fd8(%eax),%eax
+f01041ba:	83 78 54 03          	cmpl   $0x3,0x54(%eax)
+f01041be:	74 42                	je     f0104202 <env_run+0x9c>
+      curenv->env_status = ENV_RUNNABLE;
+    }
+
+    curenv = e;
+f01041c0:	e8 9a 3a 00 00       	call   f0107c5f <cpunum>
+f01041c5:	6b c0 74             	imul   $0x74,%eax,%eax
+f01041c8:	89 98 28 c0 79 f0    	mov    %ebx,-0xf863fd8(%eax)
+    e->env_status = ENV_RUNNING;
+f01041ce:	c7 43 54 03 00 00 00 	movl   $0x3,0x54(%ebx)
+    (e->env_runs)++;
+f01041d5:	83 43 58 01          	addl   $0x1,0x58(%ebx)
+
+    lcr3(PADDR(e->env_pgdir));
+f01041d9:	8b 43 60             	mov    0x60(%ebx),%eax
+	if ((uint32_t)kva < KERNBASE)
+f01041dc:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f01041e1:	76 36                	jbe    f0104219 <env_run+0xb3>
+	return (physaddr_t)kva - KERNBASE;
+f01041e3:	05 00 00 00 10       	add    $0x10000000,%eax
+  __asm __volatile("movl %0,%%cr3" : : "r" (val));
+f01041e8:	0f 22 d8             	mov    %eax,%cr3
+}
+
+static inline void
+unlock_kernel(void)
+{
+	spin_unlock(&kernel_lock);
+f01041eb:	83 ec 0c             	sub    $0xc,%esp
+f01041ee:	68 c0 53 11 f0       	push   $0xf01153c0
+f01041f3:	e8 71 3d 00 00       	call   f0107f69 <spin_unlock>
+
+	// Normally we wouldn't need to do this, but QEMU only runs
+	// one CPU at a time and has a long time-slice.  Without the
+	// pause, this CPU is likely to reacquire the lock before
+	// another CPU has even been given a chance to acquire it.
+	asm volatile("pause");
+f01041f8:	f3 90                	pause
+    // it on another CPU since we entered the kernel.
+    lcr3(PADDR(e->env_pgdir));
+  }
+
+  unlock_kernel();
+  env_pop_tf(&(e->env_tf));
+f01041fa:	89 1c 24             	mov    %ebx,(%esp)
+f01041fd:	e8 26 ff ff ff       	call   f0104128 <env_pop_tf>
+      curenv->env_status = ENV_RUNNABLE;
+f0104202:	e8 58 3a 00 00       	call   f0107c5f <cpunum>
+f0104207:	6b c0 74             	imul   $0x74,%eax,%eax
+f010420a:	8b 80 28 c0 79 f0    	mov    -0xf863fd8(%eax),%eax
+f0104210:	c7 40 54 02 00 00 00 	movl   $0x2,0x54(%eax)
+f0104217:	eb a7                	jmp    f01041c0 <env_run+0x5a>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0104219:	50                   	push   %eax
+f010421a:	68 e8 82 10 f0       	push   $0xf01082e8
+f010421f:	68 7d 02 00 00       	push   $0x27d
+f0104224:	68 fa 99 10 f0       	push   $0xf01099fa
+f0104229:	e8 12 be ff ff       	call   f0100040 <_panic>
+  } else if (pa2page(PADDR(e->env_pgdir))->pp_ref > 1) {
+f010422e:	8b 43 60             	mov    0x60(%ebx),%eax
+	if ((uint32_t)kva < KERNBASE)
+f0104231:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0104236:	76 25                	jbe    f010425d <env_run+0xf7>
+	return (physaddr_t)kva - KERNBASE;
+f0104238:	05 00 00 00 10       	add    $0x10000000,%eax
+	if (PGNUM(pa) >= npages)
+f010423d:	89 c2                	mov    %eax,%edx
+f010423f:	c1 ea 0c             	shr    $0xc,%edx
+f0104242:	3b 15 08 bf 79 f0    	cmp    0xf079bf08,%edx
+f0104248:	73 28                	jae    f0104272 <env_run+0x10c>
+f010424a:	8b 0d 10 bf 79 f0    	mov    0xf079bf10,%ecx
+f0104250:	66 83 7c d1 04 01    	cmpw   $0x1,0x4(%ecx,%edx,8)
+f0104256:	76 93                	jbe    f01041eb <env_run+0x85>
+f0104258:	0f 22 d8             	mov    %eax,%cr3
+}
+f010425b:	eb 8e                	jmp    f01041eb <env_run+0x85>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f010425d:	50                   	push   %eax
+f010425e:	68 e8 82 10 f0       	push   $0xf01082e8
+f0104263:	68 7e 02 00 00       	push   $0x27e
+f0104268:	68 fa 99 10 f0       	push   $0xf01099fa
+f010426d:	e8 ce bd ff ff       	call   f0100040 <_panic>
+		panic("pa2page called with invalid pa");
+f0104272:	83 ec 04             	sub    $0x4,%esp
+f0104275:	68 bc 8d 10 f0       	push   $0xf0108dbc
+f010427a:	6a 58                	push   $0x58
+f010427c:	68 29 96 10 f0       	push   $0xf0109629
+f0104281:	e8 ba bd ff ff       	call   f0100040 <_panic>
+
+f0104286 <mc146818_read>:
+
+#include <kern/kclock.h>
+
+unsigned
+mc146818_read(unsigned reg)
+{
+f0104286:	55                   	push   %ebp
+f0104287:	89 e5                	mov    %esp,%ebp
+  __asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0104289:	8b 45 08             	mov    0x8(%ebp),%eax
+f010428c:	ba 70 00 00 00       	mov    $0x70,%edx
+f0104291:	ee                   	out    %al,(%dx)
+  __asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f0104292:	ba 71 00 00 00       	mov    $0x71,%edx
+f0104297:	ec                   	in     (%dx),%al
+  outb(IO_RTC, reg);
+  return inb(IO_RTC+1);
+f0104298:	0f b6 c0             	movzbl %al,%eax
+}
+f010429b:	5d                   	pop    %ebp
+f010429c:	c3                   	ret
+
+f010429d <mc146818_write>:
+
+void
+mc146818_write(unsigned reg, unsigned datum)
+{
+f010429d:	55                   	push   %ebp
+f010429e:	89 e5                	mov    %esp,%ebp
+  __asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f01042a0:	8b 45 08             	mov    0x8(%ebp),%eax
+f01042a3:	ba 70 00 00 00       	mov    $0x70,%edx
+f01042a8:	ee                   	out    %al,(%dx)
+f01042a9:	8b 45 0c             	mov    0xc(%ebp),%eax
+f01042ac:	ba 71 00 00 00       	mov    $0x71,%edx
+f01042b1:	ee                   	out    %al,(%dx)
+  outb(IO_RTC, reg);
+  outb(IO_RTC+1, datum);
+}
+f01042b2:	5d                   	pop    %ebp
+f01042b3:	c3                   	ret
+
+f01042b4 <irq_setmask_8259A>:
+    irq_setmask_8259A(irq_mask_8259A);
+}
+
+void
+irq_setmask_8259A(uint16_t mask)
+{
+f01042b4:	55                   	push   %ebp
+f01042b5:	89 e5                	mov    %esp,%ebp
+f01042b7:	56                   	push   %esi
+f01042b8:	53                   	push   %ebx
+f01042b9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  irq_mask_8259A = mask;
+f01042bc:	66 89 0d a8 53 11 f0 	mov    %cx,0xf01153a8
+  if (!didinit)
+f01042c3:	80 3d 50 b2 79 f0 00 	cmpb   $0x0,0xf079b250
+f01042ca:	75 07                	jne    f01042d3 <irq_setmask_8259A+0x1f>
+  cprintf("enabled interrupts:");
+  for (i = 0; i < 16; i++)
+    if (~mask & (1<<i))
+      cprintf(" %d", i);
+  cprintf("\n");
+}
+f01042cc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f01042cf:	5b                   	pop    %ebx
+f01042d0:	5e                   	pop    %esi
+f01042d1:	5d                   	pop    %ebp
+f01042d2:	c3                   	ret
+f01042d3:	89 ce                	mov    %ecx,%esi
+f01042d5:	ba 21 00 00 00       	mov    $0x21,%edx
+f01042da:	89 c8                	mov    %ecx,%eax
+f01042dc:	ee                   	out    %al,(%dx)
+  outb(IO_PIC2+1, (char)(mask >> 8));
+f01042dd:	89 c8                	mov    %ecx,%eax
+f01042df:	66 c1 e8 08          	shr    $0x8,%ax
+f01042e3:	ba a1 00 00 00       	mov    $0xa1,%edx
+f01042e8:	ee                   	out    %al,(%dx)
+  cprintf("enabled interrupts:");
+f01042e9:	83 ec 0c             	sub    $0xc,%esp
+f01042ec:	68 11 9a 10 f0       	push   $0xf0109a11
+f01042f1:	e8 36 01 00 00       	call   f010442c <cprintf>
+f01042f6:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < 16; i++)
+f01042f9:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (~mask & (1<<i))
+f01042fe:	0f b7 f6             	movzwl %si,%esi
+f0104301:	f7 d6                	not    %esi
+f0104303:	eb 08                	jmp    f010430d <irq_setmask_8259A+0x59>
+  for (i = 0; i < 16; i++)
+f0104305:	83 c3 01             	add    $0x1,%ebx
+f0104308:	83 fb 10             	cmp    $0x10,%ebx
+f010430b:	74 18                	je     f0104325 <irq_setmask_8259A+0x71>
+    if (~mask & (1<<i))
+f010430d:	0f a3 de             	bt     %ebx,%esi
+f0104310:	73 f3                	jae    f0104305 <irq_setmask_8259A+0x51>
+      cprintf(" %d", i);
+f0104312:	83 ec 08             	sub    $0x8,%esp
+f0104315:	53                   	push   %ebx
+f0104316:	68 1e 9f 10 f0       	push   $0xf0109f1e
+f010431b:	e8 0c 01 00 00       	call   f010442c <cprintf>
+f0104320:	83 c4 10             	add    $0x10,%esp
+f0104323:	eb e0                	jmp    f0104305 <irq_setmask_8259A+0x51>
+  cprintf("\n");
+f0104325:	83 ec 0c             	sub    $0xc,%esp
+f0104328:	68 1a 99 10 f0       	push   $0xf010991a
+f010432d:	e8 fa 00 00 00       	call   f010442c <cprintf>
+f0104332:	83 c4 10             	add    $0x10,%esp
+f0104335:	eb 95                	jmp    f01042cc <irq_setmask_8259A+0x18>
+
+f0104337 <pic_init>:
+{
+f0104337:	55                   	push   %ebp
+f0104338:	89 e5                	mov    %esp,%ebp
+f010433a:	57                   	push   %edi
+f010433b:	56                   	push   %esi
+f010433c:	53                   	push   %ebx
+f010433d:	83 ec 0c             	sub    $0xc,%esp
+  didinit = 1;
+f0104340:	c6 05 50 b2 79 f0 01 	movb   $0x1,0xf079b250
+f0104347:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f010434c:	bb 21 00 00 00       	mov    $0x21,%ebx
+f0104351:	89 da                	mov    %ebx,%edx
+f0104353:	ee                   	out    %al,(%dx)
+f0104354:	b9 a1 00 00 00       	mov    $0xa1,%ecx
+f0104359:	89 ca                	mov    %ecx,%edx
+f010435b:	ee                   	out    %al,(%dx)
+f010435c:	bf 11 00 00 00       	mov    $0x11,%edi
+f0104361:	be 20 00 00 00       	mov    $0x20,%esi
+f0104366:	89 f8                	mov    %edi,%eax
+f0104368:	89 f2                	mov    %esi,%edx
+f010436a:	ee                   	out    %al,(%dx)
+f010436b:	b8 20 00 00 00       	mov    $0x20,%eax
+f0104370:	89 da                	mov    %ebx,%edx
+f0104372:	ee                   	out    %al,(%dx)
+f0104373:	b8 04 00 00 00       	mov    $0x4,%eax
+f0104378:	ee                   	out    %al,(%dx)
+f0104379:	b8 03 00 00 00       	mov    $0x3,%eax
+f010437e:	ee                   	out    %al,(%dx)
+f010437f:	bb a0 00 00 00       	mov    $0xa0,%ebx
+f0104384:	89 f8                	mov    %edi,%eax
+f0104386:	89 da                	mov    %ebx,%edx
+f0104388:	ee                   	out    %al,(%dx)
+f0104389:	b8 28 00 00 00       	mov    $0x28,%eax
+f010438e:	89 ca                	mov    %ecx,%edx
+f0104390:	ee                   	out    %al,(%dx)
+f0104391:	b8 02 00 00 00       	mov    $0x2,%eax
+f0104396:	ee                   	out    %al,(%dx)
+f0104397:	b8 01 00 00 00       	mov    $0x1,%eax
+f010439c:	ee                   	out    %al,(%dx)
+f010439d:	bf 68 00 00 00       	mov    $0x68,%edi
+f01043a2:	89 f8                	mov    %edi,%eax
+f01043a4:	89 f2                	mov    %esi,%edx
+f01043a6:	ee                   	out    %al,(%dx)
+f01043a7:	b9 0a 00 00 00       	mov    $0xa,%ecx
+f01043ac:	89 c8                	mov    %ecx,%eax
+f01043ae:	ee                   	out    %al,(%dx)
+f01043af:	89 f8                	mov    %edi,%eax
+f01043b1:	89 da                	mov    %ebx,%edx
+f01043b3:	ee                   	out    %al,(%dx)
+f01043b4:	89 c8                	mov    %ecx,%eax
+f01043b6:	ee                   	out    %al,(%dx)
+  if (irq_mask_8259A != 0xFFFF)
+f01043b7:	0f b7 05 a8 53 11 f0 	movzwl 0xf01153a8,%eax
+f01043be:	66 83 f8 ff          	cmp    $0xffff,%ax
+f01043c2:	75 08                	jne    f01043cc <pic_init+0x95>
+}
+f01043c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01043c7:	5b                   	pop    %ebx
+f01043c8:	5e                   	pop    %esi
+f01043c9:	5f                   	pop    %edi
+f01043ca:	5d                   	pop    %ebp
+f01043cb:	c3                   	ret
+    irq_setmask_8259A(irq_mask_8259A);
+f01043cc:	83 ec 0c             	sub    $0xc,%esp
+f01043cf:	0f b7 c0             	movzwl %ax,%eax
+f01043d2:	50                   	push   %eax
+f01043d3:	e8 dc fe ff ff       	call   f01042b4 <irq_setmask_8259A>
+f01043d8:	83 c4 10             	add    $0x10,%esp
+}
+f01043db:	eb e7                	jmp    f01043c4 <pic_init+0x8d>
+
+f01043dd <irq_eoi_8259A>:
+
+// Acknowledge 'irq' at the 8259A.  The master is in automatic EOI
+// mode, but the slave isn't.
+void
+irq_eoi_8259A(int irq)
+{
+f01043dd:	55                   	push   %ebp
+f01043de:	89 e5                	mov    %esp,%ebp
+  if (irq >= 8)
+f01043e0:	83 7d 08 07          	cmpl   $0x7,0x8(%ebp)
+f01043e4:	7e 0b                	jle    f01043f1 <irq_eoi_8259A+0x14>
+f01043e6:	b8 20 00 00 00       	mov    $0x20,%eax
+f01043eb:	ba a0 00 00 00       	mov    $0xa0,%edx
+f01043f0:	ee                   	out    %al,(%dx)
+    outb(IO_PIC2, 0x20);
+}
+f01043f1:	5d                   	pop    %ebp
+f01043f2:	c3                   	ret
+
+f01043f3 <putch>:
+#include <inc/stdarg.h>
+
+
+static void
+putch(int ch, int *cnt)
+{
+f01043f3:	55                   	push   %ebp
+f01043f4:	89 e5                	mov    %esp,%ebp
+f01043f6:	83 ec 14             	sub    $0x14,%esp
+  cputchar(ch);
+f01043f9:	ff 75 08             	push   0x8(%ebp)
+f01043fc:	e8 8b c3 ff ff       	call   f010078c <cputchar>
+  *cnt++;
+}
+f0104401:	83 c4 10             	add    $0x10,%esp
+f0104404:	c9                   	leave
+f0104405:	c3                   	ret
+
+f0104406 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+f0104406:	55                   	push   %ebp
+f0104407:	89 e5                	mov    %esp,%ebp
+f0104409:	83 ec 18             	sub    $0x18,%esp
+  int cnt = 0;
+f010440c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  vprintfmt((void*)putch, &cnt, fmt, ap);
+f0104413:	ff 75 0c             	push   0xc(%ebp)
+f0104416:	ff 75 08             	push   0x8(%ebp)
+f0104419:	8d 45 f4             	lea    -0xc(%ebp),%eax
+f010441c:	50                   	push   %eax
+f010441d:	68 f3 43 10 f0       	push   $0xf01043f3
+f0104422:	e8 1f 2b 00 00       	call   f0106f46 <vprintfmt>
+  return cnt;
+}
+f0104427:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f010442a:	c9                   	leave
+f010442b:	c3                   	ret
+
+f010442c <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+f010442c:	55                   	push   %ebp
+f010442d:	89 e5                	mov    %esp,%ebp
+f010442f:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+f0104432:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+f0104435:	50                   	push   %eax
+f0104436:	ff 75 08             	push   0x8(%ebp)
+f0104439:	e8 c8 ff ff ff       	call   f0104406 <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+f010443e:	c9                   	leave
+f010443f:	c3                   	ret
+
+f0104440 <trap_init_percpu>:
+}
+
+// Initialize and load the per-CPU TSS and IDT
+void
+trap_init_percpu(void)
+{
+f0104440:	55                   	push   %ebp
+f0104441:	89 e5                	mov    %esp,%ebp
+f0104443:	57                   	push   %edi
+f0104444:	56                   	push   %esi
+f0104445:	53                   	push   %ebx
+f0104446:	83 ec 0c             	sub    $0xc,%esp
+  // LAB 4: Your code here:
+  uint32_t i;
+
+  // Setup a TSS so that we get the right stack
+  // when we trap to the kernel.
+  thiscpu->cpu_ts.ts_esp0 = KSTACKTOP - cpunum() * (KSTKSIZE + KSTKGAP);
+f0104449:	e8 11 38 00 00       	call   f0107c5f <cpunum>
+f010444e:	89 c3                	mov    %eax,%ebx
+f0104450:	e8 0a 38 00 00       	call   f0107c5f <cpunum>
+f0104455:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104458:	c1 e3 10             	shl    $0x10,%ebx
+f010445b:	ba 00 00 00 f0       	mov    $0xf0000000,%edx
+f0104460:	29 da                	sub    %ebx,%edx
+f0104462:	89 90 30 c0 79 f0    	mov    %edx,-0xf863fd0(%eax)
+  thiscpu->cpu_ts.ts_ss0 = GD_KD;
+f0104468:	e8 f2 37 00 00       	call   f0107c5f <cpunum>
+f010446d:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104470:	66 c7 80 34 c0 79 f0 	movw   $0x10,-0xf863fcc(%eax)
+f0104477:	10 00 
+
+  // Initialize the TSS slot of the gdt.
+  gdt[(GD_TSS0 >> 3) + cpunum()] = SEG16(STS_T32A, (uint32_t)(&(thiscpu->cpu_ts)),
+f0104479:	e8 e1 37 00 00       	call   f0107c5f <cpunum>
+f010447e:	8d 70 05             	lea    0x5(%eax),%esi
+f0104481:	e8 d9 37 00 00       	call   f0107c5f <cpunum>
+f0104486:	89 c7                	mov    %eax,%edi
+f0104488:	e8 d2 37 00 00       	call   f0107c5f <cpunum>
+f010448d:	89 c3                	mov    %eax,%ebx
+f010448f:	e8 cb 37 00 00       	call   f0107c5f <cpunum>
+f0104494:	66 c7 04 f5 40 53 11 	movw   $0x67,-0xfeeacc0(,%esi,8)
+f010449b:	f0 67 00 
+f010449e:	6b ff 74             	imul   $0x74,%edi,%edi
+f01044a1:	81 c7 2c c0 79 f0    	add    $0xf079c02c,%edi
+f01044a7:	66 89 3c f5 42 53 11 	mov    %di,-0xfeeacbe(,%esi,8)
+f01044ae:	f0 
+f01044af:	6b db 74             	imul   $0x74,%ebx,%ebx
+f01044b2:	81 c3 2c c0 79 f0    	add    $0xf079c02c,%ebx
+f01044b8:	c1 eb 10             	shr    $0x10,%ebx
+f01044bb:	88 1c f5 44 53 11 f0 	mov    %bl,-0xfeeacbc(,%esi,8)
+f01044c2:	c6 04 f5 45 53 11 f0 	movb   $0x99,-0xfeeacbb(,%esi,8)
+f01044c9:	99 
+f01044ca:	c6 04 f5 46 53 11 f0 	movb   $0x40,-0xfeeacba(,%esi,8)
+f01044d1:	40 
+f01044d2:	6b c0 74             	imul   $0x74,%eax,%eax
+f01044d5:	05 2c c0 79 f0       	add    $0xf079c02c,%eax
+f01044da:	c1 e8 18             	shr    $0x18,%eax
+f01044dd:	88 04 f5 47 53 11 f0 	mov    %al,-0xfeeacb9(,%esi,8)
+                            sizeof(struct Taskstate) - 1, 0);
+  gdt[(GD_TSS0 >> 3) + cpunum()].sd_s = 0;
+f01044e4:	e8 76 37 00 00       	call   f0107c5f <cpunum>
+f01044e9:	80 24 c5 6d 53 11 f0 	andb   $0xef,-0xfeeac93(,%eax,8)
+f01044f0:	ef 
+
+  // Load the TSS selector (like other segment selectors, the
+  // bottom three bits are special; we leave them 0)
+  ltr(GD_TSS0 + cpunum() * sizeof(struct Segdesc));
+f01044f1:	e8 69 37 00 00       	call   f0107c5f <cpunum>
+f01044f6:	8d 04 c5 28 00 00 00 	lea    0x28(,%eax,8),%eax
+  __asm __volatile("ltr %0" : : "r" (sel));
+f01044fd:	0f 00 d8             	ltr    %ax
+  __asm __volatile("lidt (%0)" : : "r" (p));
+f0104500:	b8 ac 53 11 f0       	mov    $0xf01153ac,%eax
+f0104505:	0f 01 18             	lidtl  (%eax)
+
+  // Load the IDT
+  lidt(&idt_pd);
+}
+f0104508:	83 c4 0c             	add    $0xc,%esp
+f010450b:	5b                   	pop    %ebx
+f010450c:	5e                   	pop    %esi
+f010450d:	5f                   	pop    %edi
+f010450e:	5d                   	pop    %ebp
+f010450f:	c3                   	ret
+
+f0104510 <trap_init>:
+{
+f0104510:	55                   	push   %ebp
+f0104511:	89 e5                	mov    %esp,%ebp
+f0104513:	83 ec 08             	sub    $0x8,%esp
+  SETGATE(idt[T_DIVIDE], 0, GD_KT, t_divide, 0);
+f0104516:	b8 08 53 10 f0       	mov    $0xf0105308,%eax
+f010451b:	66 a3 60 b2 79 f0    	mov    %ax,0xf079b260
+f0104521:	66 c7 05 62 b2 79 f0 	movw   $0x8,0xf079b262
+f0104528:	08 00 
+f010452a:	c6 05 64 b2 79 f0 00 	movb   $0x0,0xf079b264
+f0104531:	c6 05 65 b2 79 f0 8e 	movb   $0x8e,0xf079b265
+f0104538:	c1 e8 10             	shr    $0x10,%eax
+f010453b:	66 a3 66 b2 79 f0    	mov    %ax,0xf079b266
+  SETGATE(idt[T_DEBUG], 0, GD_KT, t_debug, 0);
+f0104541:	b8 12 53 10 f0       	mov    $0xf0105312,%eax
+f0104546:	66 a3 68 b2 79 f0    	mov    %ax,0xf079b268
+f010454c:	66 c7 05 6a b2 79 f0 	movw   $0x8,0xf079b26a
+f0104553:	08 00 
+f0104555:	c6 05 6c b2 79 f0 00 	movb   $0x0,0xf079b26c
+f010455c:	c6 05 6d b2 79 f0 8e 	movb   $0x8e,0xf079b26d
+f0104563:	c1 e8 10             	shr    $0x10,%eax
+f0104566:	66 a3 6e b2 79 f0    	mov    %ax,0xf079b26e
+  SETGATE(idt[T_NMI], 0, GD_KT, t_nmi, 0);
+f010456c:	b8 1c 53 10 f0       	mov    $0xf010531c,%eax
+f0104571:	66 a3 70 b2 79 f0    	mov    %ax,0xf079b270
+f0104577:	66 c7 05 72 b2 79 f0 	movw   $0x8,0xf079b272
+f010457e:	08 00 
+f0104580:	c6 05 74 b2 79 f0 00 	movb   $0x0,0xf079b274
+f0104587:	c6 05 75 b2 79 f0 8e 	movb   $0x8e,0xf079b275
+f010458e:	c1 e8 10             	shr    $0x10,%eax
+f0104591:	66 a3 76 b2 79 f0    	mov    %ax,0xf079b276
+  SETGATE(idt[T_BRKPT], 0, GD_KT, t_brkpt, 3);
+f0104597:	b8 26 53 10 f0       	mov    $0xf0105326,%eax
+f010459c:	66 a3 78 b2 79 f0    	mov    %ax,0xf079b278
+f01045a2:	66 c7 05 7a b2 79 f0 	movw   $0x8,0xf079b27a
+f01045a9:	08 00 
+f01045ab:	c6 05 7c b2 79 f0 00 	movb   $0x0,0xf079b27c
+f01045b2:	c6 05 7d b2 79 f0 ee 	movb   $0xee,0xf079b27d
+f01045b9:	c1 e8 10             	shr    $0x10,%eax
+f01045bc:	66 a3 7e b2 79 f0    	mov    %ax,0xf079b27e
+  SETGATE(idt[T_OFLOW], 0, GD_KT, t_oflow, 0);
+f01045c2:	b8 30 53 10 f0       	mov    $0xf0105330,%eax
+f01045c7:	66 a3 80 b2 79 f0    	mov    %ax,0xf079b280
+f01045cd:	66 c7 05 82 b2 79 f0 	movw   $0x8,0xf079b282
+f01045d4:	08 00 
+f01045d6:	c6 05 84 b2 79 f0 00 	movb   $0x0,0xf079b284
+f01045dd:	c6 05 85 b2 79 f0 8e 	movb   $0x8e,0xf079b285
+f01045e4:	c1 e8 10             	shr    $0x10,%eax
+f01045e7:	66 a3 86 b2 79 f0    	mov    %ax,0xf079b286
+  SETGATE(idt[T_BOUND], 0, GD_KT, t_bound, 0);
+f01045ed:	b8 3a 53 10 f0       	mov    $0xf010533a,%eax
+f01045f2:	66 a3 88 b2 79 f0    	mov    %ax,0xf079b288
+f01045f8:	66 c7 05 8a b2 79 f0 	movw   $0x8,0xf079b28a
+f01045ff:	08 00 
+f0104601:	c6 05 8c b2 79 f0 00 	movb   $0x0,0xf079b28c
+f0104608:	c6 05 8d b2 79 f0 8e 	movb   $0x8e,0xf079b28d
+f010460f:	c1 e8 10             	shr    $0x10,%eax
+f0104612:	66 a3 8e b2 79 f0    	mov    %ax,0xf079b28e
+  SETGATE(idt[T_ILLOP], 0, GD_KT, t_illop, 0);
+f0104618:	b8 44 53 10 f0       	mov    $0xf0105344,%eax
+f010461d:	66 a3 90 b2 79 f0    	mov    %ax,0xf079b290
+f0104623:	66 c7 05 92 b2 79 f0 	movw   $0x8,0xf079b292
+f010462a:	08 00 
+f010462c:	c6 05 94 b2 79 f0 00 	movb   $0x0,0xf079b294
+f0104633:	c6 05 95 b2 79 f0 8e 	movb   $0x8e,0xf079b295
+f010463a:	c1 e8 10             	shr    $0x10,%eax
+f010463d:	66 a3 96 b2 79 f0    	mov    %ax,0xf079b296
+  SETGATE(idt[T_DEVICE], 0, GD_KT, t_device, 0);
+f0104643:	b8 4e 53 10 f0       	mov    $0xf010534e,%eax
+f0104648:	66 a3 98 b2 79 f0    	mov    %ax,0xf079b298
+f010464e:	66 c7 05 9a b2 79 f0 	movw   $0x8,0xf079b29a
+f0104655:	08 00 
+f0104657:	c6 05 9c b2 79 f0 00 	movb   $0x0,0xf079b29c
+f010465e:	c6 05 9d b2 79 f0 8e 	movb   $0x8e,0xf079b29d
+f0104665:	c1 e8 10             	shr    $0x10,%eax
+f0104668:	66 a3 9e b2 79 f0    	mov    %ax,0xf079b29e
+  SETGATE(idt[T_DBLFLT], 0, GD_KT, t_dblflt, 0);
+f010466e:	b8 58 53 10 f0       	mov    $0xf0105358,%eax
+f0104673:	66 a3 a0 b2 79 f0    	mov    %ax,0xf079b2a0
+f0104679:	66 c7 05 a2 b2 79 f0 	movw   $0x8,0xf079b2a2
+f0104680:	08 00 
+f0104682:	c6 05 a4 b2 79 f0 00 	movb   $0x0,0xf079b2a4
+f0104689:	c6 05 a5 b2 79 f0 8e 	movb   $0x8e,0xf079b2a5
+f0104690:	c1 e8 10             	shr    $0x10,%eax
+f0104693:	66 a3 a6 b2 79 f0    	mov    %ax,0xf079b2a6
+  SETGATE(idt[T_TSS], 0, GD_KT, t_tss, 0);
+f0104699:	b8 60 53 10 f0       	mov    $0xf0105360,%eax
+f010469e:	66 a3 b0 b2 79 f0    	mov    %ax,0xf079b2b0
+f01046a4:	66 c7 05 b2 b2 79 f0 	movw   $0x8,0xf079b2b2
+f01046ab:	08 00 
+f01046ad:	c6 05 b4 b2 79 f0 00 	movb   $0x0,0xf079b2b4
+f01046b4:	c6 05 b5 b2 79 f0 8e 	movb   $0x8e,0xf079b2b5
+f01046bb:	c1 e8 10             	shr    $0x10,%eax
+f01046be:	66 a3 b6 b2 79 f0    	mov    %ax,0xf079b2b6
+  SETGATE(idt[T_SEGNP], 0, GD_KT, t_segnp, 0);
+f01046c4:	b8 68 53 10 f0       	mov    $0xf0105368,%eax
+f01046c9:	66 a3 b8 b2 79 f0    	mov    %ax,0xf079b2b8
+f01046cf:	66 c7 05 ba b2 79 f0 	movw   $0x8,0xf079b2ba
+f01046d6:	08 00 
+f01046d8:	c6 05 bc b2 79 f0 00 	movb   $0x0,0xf079b2bc
+f01046df:	c6 05 bd b2 79 f0 8e 	movb   $0x8e,0xf079b2bd
+f01046e6:	c1 e8 10             	shr    $0x10,%eax
+f01046e9:	66 a3 be b2 79 f0    	mov    %ax,0xf079b2be
+  SETGATE(idt[T_STACK], 0, GD_KT, t_stack, 0);
+f01046ef:	b8 70 53 10 f0       	mov    $0xf0105370,%eax
+f01046f4:	66 a3 c0 b2 79 f0    	mov    %ax,0xf079b2c0
+f01046fa:	66 c7 05 c2 b2 79 f0 	movw   $0x8,0xf079b2c2
+f0104701:	08 00 
+f0104703:	c6 05 c4 b2 79 f0 00 	movb   $0x0,0xf079b2c4
+f010470a:	c6 05 c5 b2 79 f0 8e 	movb   $0x8e,0xf079b2c5
+f0104711:	c1 e8 10             	shr    $0x10,%eax
+f0104714:	66 a3 c6 b2 79 f0    	mov    %ax,0xf079b2c6
+  SETGATE(idt[T_GPFLT], 0, GD_KT, t_gpflt, 0);
+f010471a:	b8 78 53 10 f0       	mov    $0xf0105378,%eax
+f010471f:	66 a3 c8 b2 79 f0    	mov    %ax,0xf079b2c8
+f0104725:	66 c7 05 ca b2 79 f0 	movw   $0x8,0xf079b2ca
+f010472c:	08 00 
+f010472e:	c6 05 cc b2 79 f0 00 	movb   $0x0,0xf079b2cc
+f0104735:	c6 05 cd b2 79 f0 8e 	movb   $0x8e,0xf079b2cd
+f010473c:	c1 e8 10             	shr    $0x10,%eax
+f010473f:	66 a3 ce b2 79 f0    	mov    %ax,0xf079b2ce
+  SETGATE(idt[T_PGFLT], 0, GD_KT, t_pgflt, 0);
+f0104745:	b8 80 53 10 f0       	mov    $0xf0105380,%eax
+f010474a:	66 a3 d0 b2 79 f0    	mov    %ax,0xf079b2d0
+f0104750:	66 c7 05 d2 b2 79 f0 	movw   $0x8,0xf079b2d2
+f0104757:	08 00 
+f0104759:	c6 05 d4 b2 79 f0 00 	movb   $0x0,0xf079b2d4
+f0104760:	c6 05 d5 b2 79 f0 8e 	movb   $0x8e,0xf079b2d5
+f0104767:	c1 e8 10             	shr    $0x10,%eax
+f010476a:	66 a3 d6 b2 79 f0    	mov    %ax,0xf079b2d6
+  SETGATE(idt[T_FPERR], 0, GD_KT, t_fperr, 0);
+f0104770:	b8 84 53 10 f0       	mov    $0xf0105384,%eax
+f0104775:	66 a3 e0 b2 79 f0    	mov    %ax,0xf079b2e0
+f010477b:	66 c7 05 e2 b2 79 f0 	movw   $0x8,0xf079b2e2
+f0104782:	08 00 
+f0104784:	c6 05 e4 b2 79 f0 00 	movb   $0x0,0xf079b2e4
+f010478b:	c6 05 e5 b2 79 f0 8e 	movb   $0x8e,0xf079b2e5
+f0104792:	c1 e8 10             	shr    $0x10,%eax
+f0104795:	66 a3 e6 b2 79 f0    	mov    %ax,0xf079b2e6
+  SETGATE(idt[T_ALIGN], 0, GD_KT, t_align, 0);
+f010479b:	b8 8a 53 10 f0       	mov    $0xf010538a,%eax
+f01047a0:	66 a3 e8 b2 79 f0    	mov    %ax,0xf079b2e8
+f01047a6:	66 c7 05 ea b2 79 f0 	movw   $0x8,0xf079b2ea
+f01047ad:	08 00 
+f01047af:	c6 05 ec b2 79 f0 00 	movb   $0x0,0xf079b2ec
+f01047b6:	c6 05 ed b2 79 f0 8e 	movb   $0x8e,0xf079b2ed
+f01047bd:	c1 e8 10             	shr    $0x10,%eax
+f01047c0:	66 a3 ee b2 79 f0    	mov    %ax,0xf079b2ee
+  SETGATE(idt[T_MCHK], 0, GD_KT, t_mchk, 0);
+f01047c6:	b8 8e 53 10 f0       	mov    $0xf010538e,%eax
+f01047cb:	66 a3 f0 b2 79 f0    	mov    %ax,0xf079b2f0
+f01047d1:	66 c7 05 f2 b2 79 f0 	movw   $0x8,0xf079b2f2
+f01047d8:	08 00 
+f01047da:	c6 05 f4 b2 79 f0 00 	movb   $0x0,0xf079b2f4
+f01047e1:	c6 05 f5 b2 79 f0 8e 	movb   $0x8e,0xf079b2f5
+f01047e8:	c1 e8 10             	shr    $0x10,%eax
+f01047eb:	66 a3 f6 b2 79 f0    	mov    %ax,0xf079b2f6
+  SETGATE(idt[T_SIMDERR], 0, GD_KT, t_simderr, 0);
+f01047f1:	b8 94 53 10 f0       	mov    $0xf0105394,%eax
+f01047f6:	66 a3 f8 b2 79 f0    	mov    %ax,0xf079b2f8
+f01047fc:	66 c7 05 fa b2 79 f0 	movw   $0x8,0xf079b2fa
+f0104803:	08 00 
+f0104805:	c6 05 fc b2 79 f0 00 	movb   $0x0,0xf079b2fc
+f010480c:	c6 05 fd b2 79 f0 8e 	movb   $0x8e,0xf079b2fd
+f0104813:	c1 e8 10             	shr    $0x10,%eax
+f0104816:	66 a3 fe b2 79 f0    	mov    %ax,0xf079b2fe
+  SETGATE(idt[T_SYSCALL], 0, GD_KT, t_syscall, 3);
+f010481c:	b8 9a 53 10 f0       	mov    $0xf010539a,%eax
+f0104821:	66 a3 e0 b3 79 f0    	mov    %ax,0xf079b3e0
+f0104827:	66 c7 05 e2 b3 79 f0 	movw   $0x8,0xf079b3e2
+f010482e:	08 00 
+f0104830:	c6 05 e4 b3 79 f0 00 	movb   $0x0,0xf079b3e4
+f0104837:	c6 05 e5 b3 79 f0 ee 	movb   $0xee,0xf079b3e5
+f010483e:	c1 e8 10             	shr    $0x10,%eax
+f0104841:	66 a3 e6 b3 79 f0    	mov    %ax,0xf079b3e6
+  SETGATE(idt[IRQ_OFFSET + IRQ_TIMER], 0, GD_KT, irq_timer, 0);
+f0104847:	b8 a0 53 10 f0       	mov    $0xf01053a0,%eax
+f010484c:	66 a3 60 b3 79 f0    	mov    %ax,0xf079b360
+f0104852:	66 c7 05 62 b3 79 f0 	movw   $0x8,0xf079b362
+f0104859:	08 00 
+f010485b:	c6 05 64 b3 79 f0 00 	movb   $0x0,0xf079b364
+f0104862:	c6 05 65 b3 79 f0 8e 	movb   $0x8e,0xf079b365
+f0104869:	c1 e8 10             	shr    $0x10,%eax
+f010486c:	66 a3 66 b3 79 f0    	mov    %ax,0xf079b366
+  SETGATE(idt[IRQ_OFFSET + IRQ_KBD], 0, GD_KT, irq_kbd, 0);
+f0104872:	b8 a6 53 10 f0       	mov    $0xf01053a6,%eax
+f0104877:	66 a3 68 b3 79 f0    	mov    %ax,0xf079b368
+f010487d:	66 c7 05 6a b3 79 f0 	movw   $0x8,0xf079b36a
+f0104884:	08 00 
+f0104886:	c6 05 6c b3 79 f0 00 	movb   $0x0,0xf079b36c
+f010488d:	c6 05 6d b3 79 f0 8e 	movb   $0x8e,0xf079b36d
+f0104894:	c1 e8 10             	shr    $0x10,%eax
+f0104897:	66 a3 6e b3 79 f0    	mov    %ax,0xf079b36e
+  SETGATE(idt[IRQ_OFFSET + 2], 0, GD_KT, irq_2, 0);
+f010489d:	b8 ac 53 10 f0       	mov    $0xf01053ac,%eax
+f01048a2:	66 a3 70 b3 79 f0    	mov    %ax,0xf079b370
+f01048a8:	66 c7 05 72 b3 79 f0 	movw   $0x8,0xf079b372
+f01048af:	08 00 
+f01048b1:	c6 05 74 b3 79 f0 00 	movb   $0x0,0xf079b374
+f01048b8:	c6 05 75 b3 79 f0 8e 	movb   $0x8e,0xf079b375
+f01048bf:	c1 e8 10             	shr    $0x10,%eax
+f01048c2:	66 a3 76 b3 79 f0    	mov    %ax,0xf079b376
+  SETGATE(idt[IRQ_OFFSET + 3], 0, GD_KT, irq_3, 0);
+f01048c8:	b8 b2 53 10 f0       	mov    $0xf01053b2,%eax
+f01048cd:	66 a3 78 b3 79 f0    	mov    %ax,0xf079b378
+f01048d3:	66 c7 05 7a b3 79 f0 	movw   $0x8,0xf079b37a
+f01048da:	08 00 
+f01048dc:	c6 05 7c b3 79 f0 00 	movb   $0x0,0xf079b37c
+f01048e3:	c6 05 7d b3 79 f0 8e 	movb   $0x8e,0xf079b37d
+f01048ea:	c1 e8 10             	shr    $0x10,%eax
+f01048ed:	66 a3 7e b3 79 f0    	mov    %ax,0xf079b37e
+  SETGATE(idt[IRQ_OFFSET + IRQ_SERIAL], 0, GD_KT, irq_serial, 0);
+f01048f3:	b8 b8 53 10 f0       	mov    $0xf01053b8,%eax
+f01048f8:	66 a3 80 b3 79 f0    	mov    %ax,0xf079b380
+f01048fe:	66 c7 05 82 b3 79 f0 	movw   $0x8,0xf079b382
+f0104905:	08 00 
+f0104907:	c6 05 84 b3 79 f0 00 	movb   $0x0,0xf079b384
+f010490e:	c6 05 85 b3 79 f0 8e 	movb   $0x8e,0xf079b385
+f0104915:	c1 e8 10             	shr    $0x10,%eax
+f0104918:	66 a3 86 b3 79 f0    	mov    %ax,0xf079b386
+  SETGATE(idt[IRQ_OFFSET + 5], 0, GD_KT, irq_5, 0);
+f010491e:	b8 be 53 10 f0       	mov    $0xf01053be,%eax
+f0104923:	66 a3 88 b3 79 f0    	mov    %ax,0xf079b388
+f0104929:	66 c7 05 8a b3 79 f0 	movw   $0x8,0xf079b38a
+f0104930:	08 00 
+f0104932:	c6 05 8c b3 79 f0 00 	movb   $0x0,0xf079b38c
+f0104939:	c6 05 8d b3 79 f0 8e 	movb   $0x8e,0xf079b38d
+f0104940:	c1 e8 10             	shr    $0x10,%eax
+f0104943:	66 a3 8e b3 79 f0    	mov    %ax,0xf079b38e
+  SETGATE(idt[IRQ_OFFSET + 6], 0, GD_KT, irq_6, 0);
+f0104949:	b8 c4 53 10 f0       	mov    $0xf01053c4,%eax
+f010494e:	66 a3 90 b3 79 f0    	mov    %ax,0xf079b390
+f0104954:	66 c7 05 92 b3 79 f0 	movw   $0x8,0xf079b392
+f010495b:	08 00 
+f010495d:	c6 05 94 b3 79 f0 00 	movb   $0x0,0xf079b394
+f0104964:	c6 05 95 b3 79 f0 8e 	movb   $0x8e,0xf079b395
+f010496b:	c1 e8 10             	shr    $0x10,%eax
+f010496e:	66 a3 96 b3 79 f0    	mov    %ax,0xf079b396
+  SETGATE(idt[IRQ_OFFSET + IRQ_SPURIOUS], 0, GD_KT, irq_spurious, 0);
+f0104974:	b8 ca 53 10 f0       	mov    $0xf01053ca,%eax
+f0104979:	66 a3 98 b3 79 f0    	mov    %ax,0xf079b398
+f010497f:	66 c7 05 9a b3 79 f0 	movw   $0x8,0xf079b39a
+f0104986:	08 00 
+f0104988:	c6 05 9c b3 79 f0 00 	movb   $0x0,0xf079b39c
+f010498f:	c6 05 9d b3 79 f0 8e 	movb   $0x8e,0xf079b39d
+f0104996:	c1 e8 10             	shr    $0x10,%eax
+f0104999:	66 a3 9e b3 79 f0    	mov    %ax,0xf079b39e
+  SETGATE(idt[IRQ_OFFSET + 8], 0, GD_KT, irq_8, 0);
+f010499f:	b8 d0 53 10 f0       	mov    $0xf01053d0,%eax
+f01049a4:	66 a3 a0 b3 79 f0    	mov    %ax,0xf079b3a0
+f01049aa:	66 c7 05 a2 b3 79 f0 	movw   $0x8,0xf079b3a2
+f01049b1:	08 00 
+f01049b3:	c6 05 a4 b3 79 f0 00 	movb   $0x0,0xf079b3a4
+f01049ba:	c6 05 a5 b3 79 f0 8e 	movb   $0x8e,0xf079b3a5
+f01049c1:	c1 e8 10             	shr    $0x10,%eax
+f01049c4:	66 a3 a6 b3 79 f0    	mov    %ax,0xf079b3a6
+  SETGATE(idt[IRQ_OFFSET + 9], 0, GD_KT, irq_9, 0);
+f01049ca:	b8 d6 53 10 f0       	mov    $0xf01053d6,%eax
+f01049cf:	66 a3 a8 b3 79 f0    	mov    %ax,0xf079b3a8
+f01049d5:	66 c7 05 aa b3 79 f0 	movw   $0x8,0xf079b3aa
+f01049dc:	08 00 
+f01049de:	c6 05 ac b3 79 f0 00 	movb   $0x0,0xf079b3ac
+f01049e5:	c6 05 ad b3 79 f0 8e 	movb   $0x8e,0xf079b3ad
+f01049ec:	c1 e8 10             	shr    $0x10,%eax
+f01049ef:	66 a3 ae b3 79 f0    	mov    %ax,0xf079b3ae
+  SETGATE(idt[IRQ_OFFSET + 10], 0, GD_KT, irq_10, 0);
+f01049f5:	b8 dc 53 10 f0       	mov    $0xf01053dc,%eax
+f01049fa:	66 a3 b0 b3 79 f0    	mov    %ax,0xf079b3b0
+f0104a00:	66 c7 05 b2 b3 79 f0 	movw   $0x8,0xf079b3b2
+f0104a07:	08 00 
+f0104a09:	c6 05 b4 b3 79 f0 00 	movb   $0x0,0xf079b3b4
+f0104a10:	c6 05 b5 b3 79 f0 8e 	movb   $0x8e,0xf079b3b5
+f0104a17:	c1 e8 10             	shr    $0x10,%eax
+f0104a1a:	66 a3 b6 b3 79 f0    	mov    %ax,0xf079b3b6
+  SETGATE(idt[IRQ_OFFSET + 11], 0, GD_KT, irq_11, 0);
+f0104a20:	b8 e2 53 10 f0       	mov    $0xf01053e2,%eax
+f0104a25:	66 a3 b8 b3 79 f0    	mov    %ax,0xf079b3b8
+f0104a2b:	66 c7 05 ba b3 79 f0 	movw   $0x8,0xf079b3ba
+f0104a32:	08 00 
+f0104a34:	c6 05 bc b3 79 f0 00 	movb   $0x0,0xf079b3bc
+f0104a3b:	c6 05 bd b3 79 f0 8e 	movb   $0x8e,0xf079b3bd
+f0104a42:	c1 e8 10             	shr    $0x10,%eax
+f0104a45:	66 a3 be b3 79 f0    	mov    %ax,0xf079b3be
+  SETGATE(idt[IRQ_OFFSET + 12], 0, GD_KT, irq_12, 0);
+f0104a4b:	b8 e8 53 10 f0       	mov    $0xf01053e8,%eax
+f0104a50:	66 a3 c0 b3 79 f0    	mov    %ax,0xf079b3c0
+f0104a56:	66 c7 05 c2 b3 79 f0 	movw   $0x8,0xf079b3c2
+f0104a5d:	08 00 
+f0104a5f:	c6 05 c4 b3 79 f0 00 	movb   $0x0,0xf079b3c4
+f0104a66:	c6 05 c5 b3 79 f0 8e 	movb   $0x8e,0xf079b3c5
+f0104a6d:	c1 e8 10             	shr    $0x10,%eax
+f0104a70:	66 a3 c6 b3 79 f0    	mov    %ax,0xf079b3c6
+  SETGATE(idt[IRQ_OFFSET + 13], 0, GD_KT, irq_13, 0);
+f0104a76:	b8 ee 53 10 f0       	mov    $0xf01053ee,%eax
+f0104a7b:	66 a3 c8 b3 79 f0    	mov    %ax,0xf079b3c8
+f0104a81:	66 c7 05 ca b3 79 f0 	movw   $0x8,0xf079b3ca
+f0104a88:	08 00 
+f0104a8a:	c6 05 cc b3 79 f0 00 	movb   $0x0,0xf079b3cc
+f0104a91:	c6 05 cd b3 79 f0 8e 	movb   $0x8e,0xf079b3cd
+f0104a98:	c1 e8 10             	shr    $0x10,%eax
+f0104a9b:	66 a3 ce b3 79 f0    	mov    %ax,0xf079b3ce
+  SETGATE(idt[IRQ_OFFSET + IRQ_IDE], 0, GD_KT, irq_ide, 0);
+f0104aa1:	b8 f4 53 10 f0       	mov    $0xf01053f4,%eax
+f0104aa6:	66 a3 d0 b3 79 f0    	mov    %ax,0xf079b3d0
+f0104aac:	66 c7 05 d2 b3 79 f0 	movw   $0x8,0xf079b3d2
+f0104ab3:	08 00 
+f0104ab5:	c6 05 d4 b3 79 f0 00 	movb   $0x0,0xf079b3d4
+f0104abc:	c6 05 d5 b3 79 f0 8e 	movb   $0x8e,0xf079b3d5
+f0104ac3:	c1 e8 10             	shr    $0x10,%eax
+f0104ac6:	66 a3 d6 b3 79 f0    	mov    %ax,0xf079b3d6
+  SETGATE(idt[IRQ_OFFSET + 15], 0, GD_KT, irq_15, 0);
+f0104acc:	b8 fa 53 10 f0       	mov    $0xf01053fa,%eax
+f0104ad1:	66 a3 d8 b3 79 f0    	mov    %ax,0xf079b3d8
+f0104ad7:	66 c7 05 da b3 79 f0 	movw   $0x8,0xf079b3da
+f0104ade:	08 00 
+f0104ae0:	c6 05 dc b3 79 f0 00 	movb   $0x0,0xf079b3dc
+f0104ae7:	c6 05 dd b3 79 f0 8e 	movb   $0x8e,0xf079b3dd
+f0104aee:	c1 e8 10             	shr    $0x10,%eax
+f0104af1:	66 a3 de b3 79 f0    	mov    %ax,0xf079b3de
+  trap_init_percpu();
+f0104af7:	e8 44 f9 ff ff       	call   f0104440 <trap_init_percpu>
+}
+f0104afc:	c9                   	leave
+f0104afd:	c3                   	ret
+
+f0104afe <print_regs>:
+  }
+}
+
+void
+print_regs(struct PushRegs *regs)
+{
+f0104afe:	55                   	push   %ebp
+f0104aff:	89 e5                	mov    %esp,%ebp
+f0104b01:	53                   	push   %ebx
+f0104b02:	83 ec 0c             	sub    $0xc,%esp
+f0104b05:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  cprintf("  edi  0x%08x\n", regs->reg_edi);
+f0104b08:	ff 33                	push   (%ebx)
+f0104b0a:	68 25 9a 10 f0       	push   $0xf0109a25
+f0104b0f:	e8 18 f9 ff ff       	call   f010442c <cprintf>
+  cprintf("  esi  0x%08x\n", regs->reg_esi);
+f0104b14:	83 c4 08             	add    $0x8,%esp
+f0104b17:	ff 73 04             	push   0x4(%ebx)
+f0104b1a:	68 34 9a 10 f0       	push   $0xf0109a34
+f0104b1f:	e8 08 f9 ff ff       	call   f010442c <cprintf>
+  cprintf("  ebp  0x%08x\n", regs->reg_ebp);
+f0104b24:	83 c4 08             	add    $0x8,%esp
+f0104b27:	ff 73 08             	push   0x8(%ebx)
+f0104b2a:	68 43 9a 10 f0       	push   $0xf0109a43
+f0104b2f:	e8 f8 f8 ff ff       	call   f010442c <cprintf>
+  cprintf("  oesp 0x%08x\n", regs->reg_oesp);
+f0104b34:	83 c4 08             	add    $0x8,%esp
+f0104b37:	ff 73 0c             	push   0xc(%ebx)
+f0104b3a:	68 52 9a 10 f0       	push   $0xf0109a52
+f0104b3f:	e8 e8 f8 ff ff       	call   f010442c <cprintf>
+  cprintf("  ebx  0x%08x\n", regs->reg_ebx);
+f0104b44:	83 c4 08             	add    $0x8,%esp
+f0104b47:	ff 73 10             	push   0x10(%ebx)
+f0104b4a:	68 61 9a 10 f0       	push   $0xf0109a61
+f0104b4f:	e8 d8 f8 ff ff       	call   f010442c <cprintf>
+  cprintf("  edx  0x%08x\n", regs->reg_edx);
+f0104b54:	83 c4 08             	add    $0x8,%esp
+f0104b57:	ff 73 14             	push   0x14(%ebx)
+f0104b5a:	68 70 9a 10 f0       	push   $0xf0109a70
+f0104b5f:	e8 c8 f8 ff ff       	call   f010442c <cprintf>
+  cprintf("  ecx  0x%08x\n", regs->reg_ecx);
+f0104b64:	83 c4 08             	add    $0x8,%esp
+f0104b67:	ff 73 18             	push   0x18(%ebx)
+f0104b6a:	68 7f 9a 10 f0       	push   $0xf0109a7f
+f0104b6f:	e8 b8 f8 ff ff       	call   f010442c <cprintf>
+  cprintf("  eax  0x%08x\n", regs->reg_eax);
+f0104b74:	83 c4 08             	add    $0x8,%esp
+f0104b77:	ff 73 1c             	push   0x1c(%ebx)
+f0104b7a:	68 8e 9a 10 f0       	push   $0xf0109a8e
+f0104b7f:	e8 a8 f8 ff ff       	call   f010442c <cprintf>
+}
+f0104b84:	83 c4 10             	add    $0x10,%esp
+f0104b87:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0104b8a:	c9                   	leave
+f0104b8b:	c3                   	ret
+
+f0104b8c <print_trapframe>:
+{
+f0104b8c:	55                   	push   %ebp
+f0104b8d:	89 e5                	mov    %esp,%ebp
+f0104b8f:	56                   	push   %esi
+f0104b90:	53                   	push   %ebx
+f0104b91:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  cprintf("TRAP frame at %p from CPU %d\n", tf, cpunum());
+f0104b94:	e8 c6 30 00 00       	call   f0107c5f <cpunum>
+f0104b99:	83 ec 04             	sub    $0x4,%esp
+f0104b9c:	50                   	push   %eax
+f0104b9d:	53                   	push   %ebx
+f0104b9e:	68 f9 9a 10 f0       	push   $0xf0109af9
+f0104ba3:	e8 84 f8 ff ff       	call   f010442c <cprintf>
+  print_regs(&tf->tf_regs);
+f0104ba8:	89 1c 24             	mov    %ebx,(%esp)
+f0104bab:	e8 4e ff ff ff       	call   f0104afe <print_regs>
+  cprintf("  es   0x----%04x\n", tf->tf_es);
+f0104bb0:	83 c4 08             	add    $0x8,%esp
+f0104bb3:	0f b7 43 20          	movzwl 0x20(%ebx),%eax
+f0104bb7:	50                   	push   %eax
+f0104bb8:	68 17 9b 10 f0       	push   $0xf0109b17
+f0104bbd:	e8 6a f8 ff ff       	call   f010442c <cprintf>
+  cprintf("  ds   0x----%04x\n", tf->tf_ds);
+f0104bc2:	83 c4 08             	add    $0x8,%esp
+f0104bc5:	0f b7 43 24          	movzwl 0x24(%ebx),%eax
+f0104bc9:	50                   	push   %eax
+f0104bca:	68 2a 9b 10 f0       	push   $0xf0109b2a
+f0104bcf:	e8 58 f8 ff ff       	call   f010442c <cprintf>
+  cprintf("  trap 0x%08x %s\n", tf->tf_trapno, trapname(tf->tf_trapno));
+f0104bd4:	8b 43 28             	mov    0x28(%ebx),%eax
+  if (trapno < sizeof(excnames)/sizeof(excnames[0]))
+f0104bd7:	83 c4 10             	add    $0x10,%esp
+f0104bda:	83 f8 13             	cmp    $0x13,%eax
+f0104bdd:	0f 86 da 00 00 00    	jbe    f0104cbd <print_trapframe+0x131>
+    return "System call";
+f0104be3:	ba 9d 9a 10 f0       	mov    $0xf0109a9d,%edx
+  if (trapno == T_SYSCALL)
+f0104be8:	83 f8 30             	cmp    $0x30,%eax
+f0104beb:	74 13                	je     f0104c00 <print_trapframe+0x74>
+  if (trapno >= IRQ_OFFSET && trapno < IRQ_OFFSET + 16)
+f0104bed:	8d 50 e0             	lea    -0x20(%eax),%edx
+  return "(unknown trap)";
+f0104bf0:	83 fa 10             	cmp    $0x10,%edx
+f0104bf3:	ba b8 9a 10 f0       	mov    $0xf0109ab8,%edx
+f0104bf8:	b9 a9 9a 10 f0       	mov    $0xf0109aa9,%ecx
+f0104bfd:	0f 43 d1             	cmovae %ecx,%edx
+  cprintf("  trap 0x%08x %s\n", tf->tf_trapno, trapname(tf->tf_trapno));
+f0104c00:	83 ec 04             	sub    $0x4,%esp
+f0104c03:	52                   	push   %edx
+f0104c04:	50                   	push   %eax
+f0104c05:	68 3d 9b 10 f0       	push   $0xf0109b3d
+f0104c0a:	e8 1d f8 ff ff       	call   f010442c <cprintf>
+  if (tf == last_tf && tf->tf_trapno == T_PGFLT)
+f0104c0f:	83 c4 10             	add    $0x10,%esp
+f0104c12:	39 1d e0 ba 79 f0    	cmp    %ebx,0xf079bae0
+f0104c18:	0f 84 ab 00 00 00    	je     f0104cc9 <print_trapframe+0x13d>
+  cprintf("  err  0x%08x", tf->tf_err);
+f0104c1e:	83 ec 08             	sub    $0x8,%esp
+f0104c21:	ff 73 2c             	push   0x2c(%ebx)
+f0104c24:	68 5e 9b 10 f0       	push   $0xf0109b5e
+f0104c29:	e8 fe f7 ff ff       	call   f010442c <cprintf>
+  if (tf->tf_trapno == T_PGFLT)
+f0104c2e:	83 c4 10             	add    $0x10,%esp
+f0104c31:	83 7b 28 0e          	cmpl   $0xe,0x28(%ebx)
+f0104c35:	0f 85 b1 00 00 00    	jne    f0104cec <print_trapframe+0x160>
+            tf->tf_err & 1 ? "protection" : "not-present");
+f0104c3b:	8b 43 2c             	mov    0x2c(%ebx),%eax
+    cprintf(" [%s, %s, %s]\n",
+f0104c3e:	a8 01                	test   $0x1,%al
+f0104c40:	b9 d6 9a 10 f0       	mov    $0xf0109ad6,%ecx
+f0104c45:	ba cb 9a 10 f0       	mov    $0xf0109acb,%edx
+f0104c4a:	0f 45 ca             	cmovne %edx,%ecx
+f0104c4d:	a8 02                	test   $0x2,%al
+f0104c4f:	ba e8 9a 10 f0       	mov    $0xf0109ae8,%edx
+f0104c54:	be e2 9a 10 f0       	mov    $0xf0109ae2,%esi
+f0104c59:	0f 45 d6             	cmovne %esi,%edx
+f0104c5c:	a8 04                	test   $0x4,%al
+f0104c5e:	b8 f2 9a 10 f0       	mov    $0xf0109af2,%eax
+f0104c63:	be ed 9a 10 f0       	mov    $0xf0109aed,%esi
+f0104c68:	0f 45 c6             	cmovne %esi,%eax
+f0104c6b:	51                   	push   %ecx
+f0104c6c:	52                   	push   %edx
+f0104c6d:	50                   	push   %eax
+f0104c6e:	68 6c 9b 10 f0       	push   $0xf0109b6c
+f0104c73:	e8 b4 f7 ff ff       	call   f010442c <cprintf>
+f0104c78:	83 c4 10             	add    $0x10,%esp
+  cprintf("  eip  0x%08x\n", tf->tf_eip);
+f0104c7b:	83 ec 08             	sub    $0x8,%esp
+f0104c7e:	ff 73 30             	push   0x30(%ebx)
+f0104c81:	68 7b 9b 10 f0       	push   $0xf0109b7b
+f0104c86:	e8 a1 f7 ff ff       	call   f010442c <cprintf>
+  cprintf("  cs   0x----%04x\n", tf->tf_cs);
+f0104c8b:	83 c4 08             	add    $0x8,%esp
+f0104c8e:	0f b7 43 34          	movzwl 0x34(%ebx),%eax
+f0104c92:	50                   	push   %eax
+f0104c93:	68 8a 9b 10 f0       	push   $0xf0109b8a
+f0104c98:	e8 8f f7 ff ff       	call   f010442c <cprintf>
+  cprintf("  flag 0x%08x\n", tf->tf_eflags);
+f0104c9d:	83 c4 08             	add    $0x8,%esp
+f0104ca0:	ff 73 38             	push   0x38(%ebx)
+f0104ca3:	68 9d 9b 10 f0       	push   $0xf0109b9d
+f0104ca8:	e8 7f f7 ff ff       	call   f010442c <cprintf>
+  if ((tf->tf_cs & 3) != 0) {
+f0104cad:	83 c4 10             	add    $0x10,%esp
+f0104cb0:	f6 43 34 03          	testb  $0x3,0x34(%ebx)
+f0104cb4:	75 4b                	jne    f0104d01 <print_trapframe+0x175>
+}
+f0104cb6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0104cb9:	5b                   	pop    %ebx
+f0104cba:	5e                   	pop    %esi
+f0104cbb:	5d                   	pop    %ebp
+f0104cbc:	c3                   	ret
+    return excnames[trapno];
+f0104cbd:	8b 14 85 c0 9d 10 f0 	mov    -0xfef6240(,%eax,4),%edx
+f0104cc4:	e9 37 ff ff ff       	jmp    f0104c00 <print_trapframe+0x74>
+  if (tf == last_tf && tf->tf_trapno == T_PGFLT)
+f0104cc9:	83 7b 28 0e          	cmpl   $0xe,0x28(%ebx)
+f0104ccd:	0f 85 4b ff ff ff    	jne    f0104c1e <print_trapframe+0x92>
+  __asm __volatile("movl %%cr2,%0" : "=r" (val));
+f0104cd3:	0f 20 d0             	mov    %cr2,%eax
+    cprintf("  cr2  0x%08x\n", rcr2());
+f0104cd6:	83 ec 08             	sub    $0x8,%esp
+f0104cd9:	50                   	push   %eax
+f0104cda:	68 4f 9b 10 f0       	push   $0xf0109b4f
+f0104cdf:	e8 48 f7 ff ff       	call   f010442c <cprintf>
+f0104ce4:	83 c4 10             	add    $0x10,%esp
+f0104ce7:	e9 32 ff ff ff       	jmp    f0104c1e <print_trapframe+0x92>
+    cprintf("\n");
+f0104cec:	83 ec 0c             	sub    $0xc,%esp
+f0104cef:	68 1a 99 10 f0       	push   $0xf010991a
+f0104cf4:	e8 33 f7 ff ff       	call   f010442c <cprintf>
+f0104cf9:	83 c4 10             	add    $0x10,%esp
+f0104cfc:	e9 7a ff ff ff       	jmp    f0104c7b <print_trapframe+0xef>
+    cprintf("  esp  0x%08x\n", tf->tf_esp);
+f0104d01:	83 ec 08             	sub    $0x8,%esp
+f0104d04:	ff 73 3c             	push   0x3c(%ebx)
+f0104d07:	68 ac 9b 10 f0       	push   $0xf0109bac
+f0104d0c:	e8 1b f7 ff ff       	call   f010442c <cprintf>
+    cprintf("  ss   0x----%04x\n", tf->tf_ss);
+f0104d11:	83 c4 08             	add    $0x8,%esp
+f0104d14:	0f b7 43 40          	movzwl 0x40(%ebx),%eax
+f0104d18:	50                   	push   %eax
+f0104d19:	68 bb 9b 10 f0       	push   $0xf0109bbb
+f0104d1e:	e8 09 f7 ff ff       	call   f010442c <cprintf>
+f0104d23:	83 c4 10             	add    $0x10,%esp
+}
+f0104d26:	eb 8e                	jmp    f0104cb6 <print_trapframe+0x12a>
+
+f0104d28 <irq_listen>:
+// Returns 0 on success, -E_INVAL if irq is out of range or owned by the
+// kernel (the timer, the console and the cascade), -E_BAD_ENV if
+// another environment is listening for it.
+int
+irq_listen(struct Env *e, int irq, physaddr_t chan)
+{
+f0104d28:	55                   	push   %ebp
+f0104d29:	89 e5                	mov    %esp,%ebp
+f0104d2b:	57                   	push   %edi
+f0104d2c:	56                   	push   %esi
+f0104d2d:	53                   	push   %ebx
+f0104d2e:	83 ec 0c             	sub    $0xc,%esp
+f0104d31:	8b 7d 08             	mov    0x8(%ebp),%edi
+f0104d34:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f0104d37:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct IrqListener *il;
+
+  if (irq <= IRQ_TIMER || irq >= MAX_IRQS || irq == IRQ_KBD ||
+      irq == IRQ_SLAVE || irq == IRQ_SERIAL || irq == IRQ_SPURIOUS)
+f0104d3a:	83 fb 04             	cmp    $0x4,%ebx
+f0104d3d:	0f 94 c0             	sete   %al
+f0104d40:	83 fb 07             	cmp    $0x7,%ebx
+f0104d43:	0f 94 c2             	sete   %dl
+f0104d46:	08 d0                	or     %dl,%al
+f0104d48:	0f 85 f9 00 00 00    	jne    f0104e47 <irq_listen+0x11f>
+  if (irq <= IRQ_TIMER || irq >= MAX_IRQS || irq == IRQ_KBD ||
+f0104d4e:	8d 43 fd             	lea    -0x3(%ebx),%eax
+      irq == IRQ_SLAVE || irq == IRQ_SERIAL || irq == IRQ_SPURIOUS)
+f0104d51:	83 f8 0c             	cmp    $0xc,%eax
+f0104d54:	0f 87 ed 00 00 00    	ja     f0104e47 <irq_listen+0x11f>
+    return -E_INVAL;
+
+  il = &irq_listeners[irq];
+  if (il->il_chan && il->il_env != e)
+f0104d5a:	8b 04 dd 64 ba 79 f0 	mov    -0xf86459c(,%ebx,8),%eax
+f0104d61:	85 c0                	test   %eax,%eax
+f0104d63:	74 2d                	je     f0104d92 <irq_listen+0x6a>
+f0104d65:	39 3c dd 60 ba 79 f0 	cmp    %edi,-0xf8645a0(,%ebx,8)
+f0104d6c:	0f 85 dc 00 00 00    	jne    f0104e4e <irq_listen+0x126>
+	if (PGNUM(pa) >= npages)
+f0104d72:	c1 e8 0c             	shr    $0xc,%eax
+f0104d75:	3b 05 08 bf 79 f0    	cmp    0xf079bf08,%eax
+f0104d7b:	73 7c                	jae    f0104df9 <irq_listen+0xd1>
+    return -E_BAD_ENV;
+
+  if (il->il_chan)
+    page_decref(pa2page(il->il_chan));
+f0104d7d:	83 ec 0c             	sub    $0xc,%esp
+	return &pages[PGNUM(pa)];
+f0104d80:	8b 15 10 bf 79 f0    	mov    0xf079bf10,%edx
+f0104d86:	8d 04 c2             	lea    (%edx,%eax,8),%eax
+f0104d89:	50                   	push   %eax
+f0104d8a:	e8 f7 c6 ff ff       	call   f0101486 <page_decref>
+f0104d8f:	83 c4 10             	add    $0x10,%esp
+  il->il_env = NULL;
+f0104d92:	c7 04 dd 60 ba 79 f0 	movl   $0x0,-0xf8645a0(,%ebx,8)
+f0104d99:	00 00 00 00 
+  il->il_chan = 0;
+f0104d9d:	c7 04 dd 64 ba 79 f0 	movl   $0x0,-0xf86459c(,%ebx,8)
+f0104da4:	00 00 00 00 
+
+  if (!chan) {
+f0104da8:	85 f6                	test   %esi,%esi
+f0104daa:	74 61                	je     f0104e0d <irq_listen+0xe5>
+	if (PGNUM(pa) >= npages)
+f0104dac:	89 f0                	mov    %esi,%eax
+f0104dae:	c1 e8 0c             	shr    $0xc,%eax
+f0104db1:	3b 05 08 bf 79 f0    	cmp    0xf079bf08,%eax
+f0104db7:	73 7a                	jae    f0104e33 <irq_listen+0x10b>
+	return &pages[PGNUM(pa)];
+f0104db9:	8b 15 10 bf 79 f0    	mov    0xf079bf10,%edx
+    irq_setmask_8259A(irq_mask_8259A | (1 << irq));
+    return 0;
+  }
+
+  pa2page(chan)->pp_ref++;
+f0104dbf:	66 83 44 c2 04 01    	addw   $0x1,0x4(%edx,%eax,8)
+  il->il_env = e;
+f0104dc5:	89 3c dd 60 ba 79 f0 	mov    %edi,-0xf8645a0(,%ebx,8)
+  il->il_chan = chan;
+f0104dcc:	89 34 dd 64 ba 79 f0 	mov    %esi,-0xf86459c(,%ebx,8)
+  irq_setmask_8259A(irq_mask_8259A & ~(1 << irq));
+f0104dd3:	83 ec 0c             	sub    $0xc,%esp
+f0104dd6:	0f b7 05 a8 53 11 f0 	movzwl 0xf01153a8,%eax
+f0104ddd:	0f b3 d8             	btr    %ebx,%eax
+f0104de0:	0f b7 c0             	movzwl %ax,%eax
+f0104de3:	50                   	push   %eax
+f0104de4:	e8 cb f4 ff ff       	call   f01042b4 <irq_setmask_8259A>
+  return 0;
+f0104de9:	83 c4 10             	add    $0x10,%esp
+f0104dec:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0104df1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0104df4:	5b                   	pop    %ebx
+f0104df5:	5e                   	pop    %esi
+f0104df6:	5f                   	pop    %edi
+f0104df7:	5d                   	pop    %ebp
+f0104df8:	c3                   	ret
+		panic("pa2page called with invalid pa");
+f0104df9:	83 ec 04             	sub    $0x4,%esp
+f0104dfc:	68 bc 8d 10 f0       	push   $0xf0108dbc
+f0104e01:	6a 58                	push   $0x58
+f0104e03:	68 29 96 10 f0       	push   $0xf0109629
+f0104e08:	e8 33 b2 ff ff       	call   f0100040 <_panic>
+    irq_setmask_8259A(irq_mask_8259A | (1 << irq));
+f0104e0d:	83 ec 0c             	sub    $0xc,%esp
+f0104e10:	b8 01 00 00 00       	mov    $0x1,%eax
+f0104e15:	89 d9                	mov    %ebx,%ecx
+f0104e17:	d3 e0                	shl    %cl,%eax
+f0104e19:	66 0b 05 a8 53 11 f0 	or     0xf01153a8,%ax
+f0104e20:	0f b7 c0             	movzwl %ax,%eax
+f0104e23:	50                   	push   %eax
+f0104e24:	e8 8b f4 ff ff       	call   f01042b4 <irq_setmask_8259A>
+    return 0;
+f0104e29:	83 c4 10             	add    $0x10,%esp
+f0104e2c:	b8 00 00 00 00       	mov    $0x0,%eax
+f0104e31:	eb be                	jmp    f0104df1 <irq_listen+0xc9>
+f0104e33:	83 ec 04             	sub    $0x4,%esp
+f0104e36:	68 bc 8d 10 f0       	push   $0xf0108dbc
+f0104e3b:	6a 58                	push   $0x58
+f0104e3d:	68 29 96 10 f0       	push   $0xf0109629
+f0104e42:	e8 f9 b1 ff ff       	call   f0100040 <_panic>
+    return -E_INVAL;
+f0104e47:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0104e4c:	eb a3                	jmp    f0104df1 <irq_listen+0xc9>
+    return -E_BAD_ENV;
+f0104e4e:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+f0104e53:	eb 9c                	jmp    f0104df1 <irq_listen+0xc9>
+
+f0104e55 <irq_release>:
+
+// Stop 'e' listening for any IRQ; called when it is freed.
+void
+irq_release(struct Env *e)
+{
+f0104e55:	55                   	push   %ebp
+f0104e56:	89 e5                	mov    %esp,%ebp
+f0104e58:	56                   	push   %esi
+f0104e59:	53                   	push   %ebx
+f0104e5a:	8b 75 08             	mov    0x8(%ebp),%esi
+  int irq;
+
+  for (irq = 0; irq < MAX_IRQS; irq++)
+f0104e5d:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0104e62:	eb 08                	jmp    f0104e6c <irq_release+0x17>
+f0104e64:	83 c3 01             	add    $0x1,%ebx
+f0104e67:	83 fb 10             	cmp    $0x10,%ebx
+f0104e6a:	74 24                	je     f0104e90 <irq_release+0x3b>
+    if (irq_listeners[irq].il_chan && irq_listeners[irq].il_env == e)
+f0104e6c:	83 3c dd 64 ba 79 f0 	cmpl   $0x0,-0xf86459c(,%ebx,8)
+f0104e73:	00 
+f0104e74:	74 ee                	je     f0104e64 <irq_release+0xf>
+f0104e76:	39 34 dd 60 ba 79 f0 	cmp    %esi,-0xf8645a0(,%ebx,8)
+f0104e7d:	75 e5                	jne    f0104e64 <irq_release+0xf>
+      irq_listen(e, irq, 0);
+f0104e7f:	83 ec 04             	sub    $0x4,%esp
+f0104e82:	6a 00                	push   $0x0
+f0104e84:	53                   	push   %ebx
+f0104e85:	56                   	push   %esi
+f0104e86:	e8 9d fe ff ff       	call   f0104d28 <irq_listen>
+f0104e8b:	83 c4 10             	add    $0x10,%esp
+f0104e8e:	eb d4                	jmp    f0104e64 <irq_release+0xf>
+}
+f0104e90:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0104e93:	5b                   	pop    %ebx
+f0104e94:	5e                   	pop    %esi
+f0104e95:	5d                   	pop    %ebp
+f0104e96:	c3                   	ret
+
+f0104e97 <page_fault_handler>:
+}
+
+
+void
+page_fault_handler(struct Trapframe *tf)
+{
+f0104e97:	55                   	push   %ebp
+f0104e98:	89 e5                	mov    %esp,%ebp
+f0104e9a:	57                   	push   %edi
+f0104e9b:	56                   	push   %esi
+f0104e9c:	53                   	push   %ebx
+f0104e9d:	83 ec 0c             	sub    $0xc,%esp
+f0104ea0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+f0104ea3:	0f 20 d6             	mov    %cr2,%esi
+  fault_va = rcr2();
+
+  // Handle kernel-mode page faults.
+
+  // LAB 3: Your code here.
+  if ((tf->tf_cs & 3) < 2) {
+f0104ea6:	f6 43 34 02          	testb  $0x2,0x34(%ebx)
+f0104eaa:	0f 84 91 00 00 00    	je     f0104f41 <page_fault_handler+0xaa>
+
+  // LAB 4: Your code here.
+
+  // A write through a page table shared by sys_fork: take our own copy
+  // of the table and retry.  A copy-on-write fault may follow.
+  if ((tf->tf_err & FEC_WR) && fault_va < UTOP &&
+f0104eb0:	f6 43 2c 02          	testb  $0x2,0x2c(%ebx)
+f0104eb4:	74 0c                	je     f0104ec2 <page_fault_handler+0x2b>
+f0104eb6:	81 fe ff ff bf ee    	cmp    $0xeebfffff,%esi
+f0104ebc:	0f 86 9f 00 00 00    	jbe    f0104f61 <page_fault_handler+0xca>
+      pgdir_unshare(curenv->env_pgdir, (void *) fault_va) == 0)
+    env_run(curenv);
+
+  // Environments that opted in (sys_env_set_cow) have copy-on-write
+  // faults resolved right here, without a trip through the upcall.
+  if (curenv->env_kern_cow && (tf->tf_err & FEC_WR) &&
+f0104ec2:	e8 98 2d 00 00       	call   f0107c5f <cpunum>
+f0104ec7:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104eca:	8b 80 28 c0 79 f0    	mov    -0xf863fd8(%eax),%eax
+f0104ed0:	80 78 6c 00          	cmpb   $0x0,0x6c(%eax)
+f0104ed4:	74 0a                	je     f0104ee0 <page_fault_handler+0x49>
+f0104ed6:	f6 43 2c 02          	testb  $0x2,0x2c(%ebx)
+f0104eda:	0f 85 dd 00 00 00    	jne    f0104fbd <page_fault_handler+0x126>
+      page_cow(curenv->env_pgdir, (void *) fault_va) == 0)
+    env_run(curenv);
+
+  if (curenv->env_pgfault_upcall) {
+f0104ee0:	e8 7a 2d 00 00       	call   f0107c5f <cpunum>
+f0104ee5:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104ee8:	8b 80 28 c0 79 f0    	mov    -0xf863fd8(%eax),%eax
+f0104eee:	83 78 64 00          	cmpl   $0x0,0x64(%eax)
+f0104ef2:	0f 85 00 01 00 00    	jne    f0104ff8 <page_fault_handler+0x161>
+
+    env_run(curenv);
+  }
+
+  // Destroy the environment that caused the fault.
+  cprintf("[%08x] user fault va %08x ip %08x\n",
+f0104ef8:	8b 7b 30             	mov    0x30(%ebx),%edi
+          curenv->env_id, fault_va, tf->tf_eip);
+f0104efb:	e8 5f 2d 00 00       	call   f0107c5f <cpunum>
+  cprintf("[%08x] user fault va %08x ip %08x\n",
+f0104f00:	57                   	push   %edi
+f0104f01:	56                   	push   %esi
+          curenv->env_id, fault_va, tf->tf_eip);
+f0104f02:	6b c0 74             	imul   $0x74,%eax,%eax
+  cprintf("[%08x] user fault va %08x ip %08x\n",
+f0104f05:	8b 80 28 c0 79 f0    	mov    -0xf863fd8(%eax),%eax
+f0104f0b:	ff 70 48             	push   0x48(%eax)
+f0104f0e:	68 88 9d 10 f0       	push   $0xf0109d88
+f0104f13:	e8 14 f5 ff ff       	call   f010442c <cprintf>
+  print_trapframe(tf);
+f0104f18:	89 1c 24             	mov    %ebx,(%esp)
+f0104f1b:	e8 6c fc ff ff       	call   f0104b8c <print_trapframe>
+  env_destroy(curenv);
+f0104f20:	e8 3a 2d 00 00       	call   f0107c5f <cpunum>
+f0104f25:	83 c4 04             	add    $0x4,%esp
+f0104f28:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104f2b:	ff b0 28 c0 79 f0    	push   -0xf863fd8(%eax)
+f0104f31:	e8 21 f1 ff ff       	call   f0104057 <env_destroy>
+}
+f0104f36:	83 c4 10             	add    $0x10,%esp
+f0104f39:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0104f3c:	5b                   	pop    %ebx
+f0104f3d:	5e                   	pop    %esi
+f0104f3e:	5f                   	pop    %edi
+f0104f3f:	5d                   	pop    %ebp
+f0104f40:	c3                   	ret
+    print_trapframe(tf);
+f0104f41:	83 ec 0c             	sub    $0xc,%esp
+f0104f44:	53                   	push   %ebx
+f0104f45:	e8 42 fc ff ff       	call   f0104b8c <print_trapframe>
+    panic("page_fault_handler: kernel had a page fault");
+f0104f4a:	83 c4 0c             	add    $0xc,%esp
+f0104f4d:	68 5c 9d 10 f0       	push   $0xf0109d5c
+f0104f52:	68 d7 01 00 00       	push   $0x1d7
+f0104f57:	68 ce 9b 10 f0       	push   $0xf0109bce
+f0104f5c:	e8 df b0 ff ff       	call   f0100040 <_panic>
+      (curenv->env_pgdir[PDX(fault_va)] & PDE_SHARED) &&
+f0104f61:	e8 f9 2c 00 00       	call   f0107c5f <cpunum>
+f0104f66:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104f69:	8b 80 28 c0 79 f0    	mov    -0xf863fd8(%eax),%eax
+f0104f6f:	89 f2                	mov    %esi,%edx
+f0104f71:	c1 ea 16             	shr    $0x16,%edx
+f0104f74:	8b 40 60             	mov    0x60(%eax),%eax
+  if ((tf->tf_err & FEC_WR) && fault_va < UTOP &&
+f0104f77:	f6 44 90 01 08       	testb  $0x8,0x1(%eax,%edx,4)
+f0104f7c:	0f 84 40 ff ff ff    	je     f0104ec2 <page_fault_handler+0x2b>
+      pgdir_unshare(curenv->env_pgdir, (void *) fault_va) == 0)
+f0104f82:	e8 d8 2c 00 00       	call   f0107c5f <cpunum>
+f0104f87:	83 ec 08             	sub    $0x8,%esp
+f0104f8a:	56                   	push   %esi
+f0104f8b:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104f8e:	8b 80 28 c0 79 f0    	mov    -0xf863fd8(%eax),%eax
+f0104f94:	ff 70 60             	push   0x60(%eax)
+f0104f97:	e8 13 c5 ff ff       	call   f01014af <pgdir_unshare>
+      (curenv->env_pgdir[PDX(fault_va)] & PDE_SHARED) &&
+f0104f9c:	83 c4 10             	add    $0x10,%esp
+f0104f9f:	85 c0                	test   %eax,%eax
+f0104fa1:	0f 85 1b ff ff ff    	jne    f0104ec2 <page_fault_handler+0x2b>
+    env_run(curenv);
+f0104fa7:	e8 b3 2c 00 00       	call   f0107c5f <cpunum>
+f0104fac:	83 ec 0c             	sub    $0xc,%esp
+f0104faf:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104fb2:	ff b0 28 c0 79 f0    	push   -0xf863fd8(%eax)
+f0104fb8:	e8 a9 f1 ff ff       	call   f0104166 <env_run>
+      page_cow(curenv->env_pgdir, (void *) fault_va) == 0)
+f0104fbd:	e8 9d 2c 00 00       	call   f0107c5f <cpunum>
+f0104fc2:	83 ec 08             	sub    $0x8,%esp
+f0104fc5:	56                   	push   %esi
+f0104fc6:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104fc9:	8b 80 28 c0 79 f0    	mov    -0xf863fd8(%eax),%eax
+f0104fcf:	ff 70 60             	push   0x60(%eax)
+f0104fd2:	e8 9d c9 ff ff       	call   f0101974 <page_cow>
+  if (curenv->env_kern_cow && (tf->tf_err & FEC_WR) &&
+f0104fd7:	83 c4 10             	add    $0x10,%esp
+f0104fda:	85 c0                	test   %eax,%eax
+f0104fdc:	0f 85 fe fe ff ff    	jne    f0104ee0 <page_fault_handler+0x49>
+    env_run(curenv);
+f0104fe2:	e8 78 2c 00 00       	call   f0107c5f <cpunum>
+f0104fe7:	83 ec 0c             	sub    $0xc,%esp
+f0104fea:	6b c0 74             	imul   $0x74,%eax,%eax
+f0104fed:	ff b0 28 c0 79 f0    	push   -0xf863fd8(%eax)
+f0104ff3:	e8 6e f1 ff ff       	call   f0104166 <env_run>
+    uintptr_t uxstacktop = curenv->env_uxstacktop;
+f0104ff8:	e8 62 2c 00 00       	call   f0107c5f <cpunum>
+f0104ffd:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105000:	8b 80 28 c0 79 f0    	mov    -0xf863fd8(%eax),%eax
+f0105006:	8b 40 68             	mov    0x68(%eax),%eax
+    if ( (uxstacktop - PGSIZE <= (tf->tf_esp - sizeof(struct UTrapframe) - 4)) &&
+f0105009:	8b 4b 3c             	mov    0x3c(%ebx),%ecx
+f010500c:	8d 51 c8             	lea    -0x38(%ecx),%edx
+f010500f:	8d b8 00 f0 ff ff    	lea    -0x1000(%eax),%edi
+f0105015:	39 fa                	cmp    %edi,%edx
+f0105017:	72 06                	jb     f010501f <page_fault_handler+0x188>
+      stack = (void *) (tf->tf_esp - sizeof(struct UTrapframe) - 4);
+f0105019:	89 d7                	mov    %edx,%edi
+    if ( (uxstacktop - PGSIZE <= (tf->tf_esp - sizeof(struct UTrapframe) - 4)) &&
+f010501b:	39 c1                	cmp    %eax,%ecx
+f010501d:	72 05                	jb     f0105024 <page_fault_handler+0x18d>
+      stack = (void *) (uxstacktop - sizeof(struct UTrapframe));
+f010501f:	83 e8 34             	sub    $0x34,%eax
+f0105022:	89 c7                	mov    %eax,%edi
+    user_mem_assert(curenv,
+f0105024:	e8 36 2c 00 00       	call   f0107c5f <cpunum>
+f0105029:	6a 07                	push   $0x7
+f010502b:	6a 34                	push   $0x34
+f010502d:	57                   	push   %edi
+f010502e:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105031:	ff b0 28 c0 79 f0    	push   -0xf863fd8(%eax)
+f0105037:	e8 f1 e8 ff ff       	call   f010392d <user_mem_assert>
+    user_trapframe->utf_fault_va = fault_va;
+f010503c:	89 fa                	mov    %edi,%edx
+f010503e:	89 37                	mov    %esi,(%edi)
+    user_trapframe->utf_err = tf->tf_err;
+f0105040:	8b 43 2c             	mov    0x2c(%ebx),%eax
+f0105043:	89 47 04             	mov    %eax,0x4(%edi)
+    user_trapframe->utf_regs = tf->tf_regs;
+f0105046:	8d 7f 08             	lea    0x8(%edi),%edi
+f0105049:	b9 08 00 00 00       	mov    $0x8,%ecx
+f010504e:	89 de                	mov    %ebx,%esi
+f0105050:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+    user_trapframe->utf_eip = tf->tf_eip;
+f0105052:	8b 43 30             	mov    0x30(%ebx),%eax
+f0105055:	89 42 28             	mov    %eax,0x28(%edx)
+    user_trapframe->utf_eflags = tf->tf_eflags;
+f0105058:	8b 43 38             	mov    0x38(%ebx),%eax
+f010505b:	89 d7                	mov    %edx,%edi
+f010505d:	89 42 2c             	mov    %eax,0x2c(%edx)
+    user_trapframe->utf_esp = tf->tf_esp;
+f0105060:	8b 43 3c             	mov    0x3c(%ebx),%eax
+f0105063:	89 42 30             	mov    %eax,0x30(%edx)
+    tf->tf_eip = (uintptr_t) (curenv->env_pgfault_upcall);
+f0105066:	e8 f4 2b 00 00       	call   f0107c5f <cpunum>
+f010506b:	6b c0 74             	imul   $0x74,%eax,%eax
+f010506e:	8b 80 28 c0 79 f0    	mov    -0xf863fd8(%eax),%eax
+f0105074:	8b 40 64             	mov    0x64(%eax),%eax
+f0105077:	89 43 30             	mov    %eax,0x30(%ebx)
+    tf->tf_esp = (uintptr_t) stack;
+f010507a:	89 7b 3c             	mov    %edi,0x3c(%ebx)
+    env_run(curenv);
+f010507d:	e8 dd 2b 00 00       	call   f0107c5f <cpunum>
+f0105082:	83 c4 04             	add    $0x4,%esp
+f0105085:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105088:	ff b0 28 c0 79 f0    	push   -0xf863fd8(%eax)
+f010508e:	e8 d3 f0 ff ff       	call   f0104166 <env_run>
+
+f0105093 <trap>:
+{
+f0105093:	55                   	push   %ebp
+f0105094:	89 e5                	mov    %esp,%ebp
+f0105096:	57                   	push   %edi
+f0105097:	56                   	push   %esi
+f0105098:	8b 75 08             	mov    0x8(%ebp),%esi
+  asm volatile ("cld" ::: "cc");
+f010509b:	fc                   	cld
+  if (panicstr)
+f010509c:	83 3d 00 bf 79 f0 00 	cmpl   $0x0,0xf079bf00
+f01050a3:	74 01                	je     f01050a6 <trap+0x13>
+    asm volatile ("hlt");
+f01050a5:	f4                   	hlt
+  if (xchg(&thiscpu->cpu_status, CPU_STARTED) == CPU_HALTED)
+f01050a6:	e8 b4 2b 00 00       	call   f0107c5f <cpunum>
+f01050ab:	6b d0 74             	imul   $0x74,%eax,%edx
+f01050ae:	83 c2 04             	add    $0x4,%edx
+  asm volatile ("lock; xchgl %0, %1" :
+f01050b1:	b8 01 00 00 00       	mov    $0x1,%eax
+f01050b6:	f0 87 82 20 c0 79 f0 	lock xchg %eax,-0xf863fe0(%edx)
+f01050bd:	83 f8 02             	cmp    $0x2,%eax
+f01050c0:	74 4f                	je     f0105111 <trap+0x7e>
+  __asm __volatile("pushfl; popl %0" : "=r" (eflags));
+f01050c2:	9c                   	pushf
+f01050c3:	58                   	pop    %eax
+  assert(!(read_eflags() & FL_IF));
+f01050c4:	f6 c4 02             	test   $0x2,%ah
+f01050c7:	75 5a                	jne    f0105123 <trap+0x90>
+  if ((tf->tf_cs & 3) == 3) {
+f01050c9:	0f b7 46 34          	movzwl 0x34(%esi),%eax
+f01050cd:	83 e0 03             	and    $0x3,%eax
+f01050d0:	66 83 f8 03          	cmp    $0x3,%ax
+f01050d4:	74 66                	je     f010513c <trap+0xa9>
+  last_tf = tf;
+f01050d6:	89 35 e0 ba 79 f0    	mov    %esi,0xf079bae0
+  switch(tf->tf_trapno) {
+f01050dc:	8b 46 28             	mov    0x28(%esi),%eax
+f01050df:	83 f8 0e             	cmp    $0xe,%eax
+f01050e2:	0f 84 1f 01 00 00    	je     f0105207 <trap+0x174>
+f01050e8:	0f 87 f3 00 00 00    	ja     f01051e1 <trap+0x14e>
+f01050ee:	83 f8 01             	cmp    $0x1,%eax
+f01050f1:	0f 84 4a 01 00 00    	je     f0105241 <trap+0x1ae>
+f01050f7:	83 f8 03             	cmp    $0x3,%eax
+f01050fa:	0f 85 73 01 00 00    	jne    f0105273 <trap+0x1e0>
+      monitor(tf);
+f0105100:	83 ec 0c             	sub    $0xc,%esp
+f0105103:	56                   	push   %esi
+f0105104:	e8 cf bb ff ff       	call   f0100cd8 <monitor>
+      return;
+f0105109:	83 c4 10             	add    $0x10,%esp
+f010510c:	e9 02 01 00 00       	jmp    f0105213 <trap+0x180>
+	spin_lock(&kernel_lock);
+f0105111:	83 ec 0c             	sub    $0xc,%esp
+f0105114:	68 c0 53 11 f0       	push   $0xf01153c0
+f0105119:	e8 b1 2d 00 00       	call   f0107ecf <spin_lock>
+}
+f010511e:	83 c4 10             	add    $0x10,%esp
+f0105121:	eb 9f                	jmp    f01050c2 <trap+0x2f>
+  assert(!(read_eflags() & FL_IF));
+f0105123:	68 da 9b 10 f0       	push   $0xf0109bda
+f0105128:	68 43 96 10 f0       	push   $0xf0109643
+f010512d:	68 9f 01 00 00       	push   $0x19f
+f0105132:	68 ce 9b 10 f0       	push   $0xf0109bce
+f0105137:	e8 04 af ff ff       	call   f0100040 <_panic>
+    assert(curenv);
+f010513c:	e8 1e 2b 00 00       	call   f0107c5f <cpunum>
+f0105141:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105144:	83 b8 28 c0 79 f0 00 	cmpl   $0x0,-0xf863fd8(%eax)
+f010514b:	74 4e                	je     f010519b <trap+0x108>
+	spin_lock(&kernel_lock);
+f010514d:	83 ec 0c             	sub    $0xc,%esp
+f0105150:	68 c0 53 11 f0       	push   $0xf01153c0
+f0105155:	e8 75 2d 00 00       	call   f0107ecf <spin_lock>
+    if (curenv->env_status == ENV_DYING) {
+f010515a:	e8 00 2b 00 00       	call   f0107c5f <cpunum>
+f010515f:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105162:	8b 80 28 c0 79 f0    	mov    -0xf863fd8(%eax),%eax
+f0105168:	83 c4 10             	add    $0x10,%esp
+f010516b:	83 78 54 01          	cmpl   $0x1,0x54(%eax)
+f010516f:	74 43                	je     f01051b4 <trap+0x121>
+    curenv->env_tf = *tf;
+f0105171:	e8 e9 2a 00 00       	call   f0107c5f <cpunum>
+f0105176:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105179:	8b 80 28 c0 79 f0    	mov    -0xf863fd8(%eax),%eax
+f010517f:	b9 11 00 00 00       	mov    $0x11,%ecx
+f0105184:	89 c7                	mov    %eax,%edi
+f0105186:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+    tf = &curenv->env_tf;
+f0105188:	e8 d2 2a 00 00       	call   f0107c5f <cpunum>
+f010518d:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105190:	8b b0 28 c0 79 f0    	mov    -0xf863fd8(%eax),%esi
+f0105196:	e9 3b ff ff ff       	jmp    f01050d6 <trap+0x43>
+    assert(curenv);
+f010519b:	68 f3 9b 10 f0       	push   $0xf0109bf3
+f01051a0:	68 43 96 10 f0       	push   $0xf0109643
+f01051a5:	68 a6 01 00 00       	push   $0x1a6
+f01051aa:	68 ce 9b 10 f0       	push   $0xf0109bce
+f01051af:	e8 8c ae ff ff       	call   f0100040 <_panic>
+      env_free(curenv);
+f01051b4:	e8 a6 2a 00 00       	call   f0107c5f <cpunum>
+f01051b9:	83 ec 0c             	sub    $0xc,%esp
+f01051bc:	6b c0 74             	imul   $0x74,%eax,%eax
+f01051bf:	ff b0 28 c0 79 f0    	push   -0xf863fd8(%eax)
+f01051c5:	e8 14 ec ff ff       	call   f0103dde <env_free>
+      curenv = NULL;
+f01051ca:	e8 90 2a 00 00       	call   f0107c5f <cpunum>
+f01051cf:	6b c0 74             	imul   $0x74,%eax,%eax
+f01051d2:	c7 80 28 c0 79 f0 00 	movl   $0x0,-0xf863fd8(%eax)
+f01051d9:	00 00 00 
+      sched_yield();
+f01051dc:	e8 fb 02 00 00       	call   f01054dc <sched_yield>
+  switch(tf->tf_trapno) {
+f01051e1:	83 f8 30             	cmp    $0x30,%eax
+f01051e4:	75 69                	jne    f010524f <trap+0x1bc>
+      tf->tf_regs.reg_eax = syscall(tf->tf_regs.reg_eax,
+f01051e6:	83 ec 08             	sub    $0x8,%esp
+f01051e9:	ff 76 04             	push   0x4(%esi)
+f01051ec:	ff 36                	push   (%esi)
+f01051ee:	ff 76 10             	push   0x10(%esi)
+f01051f1:	ff 76 18             	push   0x18(%esi)
+f01051f4:	ff 76 14             	push   0x14(%esi)
+f01051f7:	ff 76 1c             	push   0x1c(%esi)
+f01051fa:	e8 c6 07 00 00       	call   f01059c5 <syscall>
+f01051ff:	89 46 1c             	mov    %eax,0x1c(%esi)
+      return;
+f0105202:	83 c4 20             	add    $0x20,%esp
+f0105205:	eb 0c                	jmp    f0105213 <trap+0x180>
+      page_fault_handler(tf);
+f0105207:	83 ec 0c             	sub    $0xc,%esp
+f010520a:	56                   	push   %esi
+f010520b:	e8 87 fc ff ff       	call   f0104e97 <page_fault_handler>
+      return;
+f0105210:	83 c4 10             	add    $0x10,%esp
+  if (curenv && curenv->env_status == ENV_RUNNING)
+f0105213:	e8 47 2a 00 00       	call   f0107c5f <cpunum>
+f0105218:	6b c0 74             	imul   $0x74,%eax,%eax
+f010521b:	83 b8 28 c0 79 f0 00 	cmpl   $0x0,-0xf863fd8(%eax)
+f0105222:	74 18                	je     f010523c <trap+0x1a9>
+f0105224:	e8 36 2a 00 00       	call   f0107c5f <cpunum>
+f0105229:	6b c0 74             	imul   $0x74,%eax,%eax
+f010522c:	8b 80 28 c0 79 f0    	mov    -0xf863fd8(%eax),%eax
+f0105232:	83 78 54 03          	cmpl   $0x3,0x54(%eax)
+f0105236:	0f 84 b5 00 00 00    	je     f01052f1 <trap+0x25e>
+    sched_yield();
+f010523c:	e8 9b 02 00 00       	call   f01054dc <sched_yield>
+      monitor(tf);
+f0105241:	83 ec 0c             	sub    $0xc,%esp
+f0105244:	56                   	push   %esi
+f0105245:	e8 8e ba ff ff       	call   f0100cd8 <monitor>
+      return;
+f010524a:	83 c4 10             	add    $0x10,%esp
+f010524d:	eb c4                	jmp    f0105213 <trap+0x180>
+  if (tf->tf_trapno == IRQ_OFFSET + IRQ_SPURIOUS) {
+f010524f:	83 f8 27             	cmp    $0x27,%eax
+f0105252:	75 1a                	jne    f010526e <trap+0x1db>
+    cprintf("Spurious interrupt on irq 7\n");
+f0105254:	83 ec 0c             	sub    $0xc,%esp
+f0105257:	68 fa 9b 10 f0       	push   $0xf0109bfa
+f010525c:	e8 cb f1 ff ff       	call   f010442c <cprintf>
+    print_trapframe(tf);
+f0105261:	89 34 24             	mov    %esi,(%esp)
+f0105264:	e8 23 f9 ff ff       	call   f0104b8c <print_trapframe>
+    return;
+f0105269:	83 c4 10             	add    $0x10,%esp
+f010526c:	eb a5                	jmp    f0105213 <trap+0x180>
+  if (tf->tf_trapno == IRQ_OFFSET + IRQ_TIMER && cpunum() == 0)
+f010526e:	83 f8 20             	cmp    $0x20,%eax
+f0105271:	74 15                	je     f0105288 <trap+0x1f5>
+  if (tf->tf_trapno > IRQ_OFFSET + IRQ_TIMER &&
+f0105273:	8b 76 28             	mov    0x28(%esi),%esi
+f0105276:	8d 46 df             	lea    -0x21(%esi),%eax
+f0105279:	83 f8 0e             	cmp    $0xe,%eax
+f010527c:	76 1a                	jbe    f0105298 <trap+0x205>
+  lapic_eoi();
+f010527e:	e8 23 2b 00 00       	call   f0107da6 <lapic_eoi>
+  sched_yield();
+f0105283:	e8 54 02 00 00       	call   f01054dc <sched_yield>
+  if (tf->tf_trapno == IRQ_OFFSET + IRQ_TIMER && cpunum() == 0)
+f0105288:	e8 d2 29 00 00       	call   f0107c5f <cpunum>
+f010528d:	85 c0                	test   %eax,%eax
+f010528f:	75 e2                	jne    f0105273 <trap+0x1e0>
+    time_tick();
+f0105291:	e8 94 1b 00 00       	call   f0106e2a <time_tick>
+f0105296:	eb db                	jmp    f0105273 <trap+0x1e0>
+    irq_deliver(tf->tf_trapno - IRQ_OFFSET);
+f0105298:	83 ee 20             	sub    $0x20,%esi
+  irq_eoi_8259A(irq);
+f010529b:	83 ec 0c             	sub    $0xc,%esp
+f010529e:	56                   	push   %esi
+f010529f:	e8 39 f1 ff ff       	call   f01043dd <irq_eoi_8259A>
+  if (!il->il_chan)
+f01052a4:	8b 04 f5 64 ba 79 f0 	mov    -0xf86459c(,%esi,8),%eax
+f01052ab:	83 c4 10             	add    $0x10,%esp
+f01052ae:	85 c0                	test   %eax,%eax
+f01052b0:	74 cc                	je     f010527e <trap+0x1eb>
+	if (PGNUM(pa) >= npages)
+f01052b2:	89 c2                	mov    %eax,%edx
+f01052b4:	c1 ea 0c             	shr    $0xc,%edx
+f01052b7:	3b 15 08 bf 79 f0    	cmp    0xf079bf08,%edx
+f01052bd:	73 1d                	jae    f01052dc <trap+0x249>
+  (*(volatile uint32_t *) KADDR(il->il_chan))++;
+f01052bf:	8b 90 00 00 00 f0    	mov    -0x10000000(%eax),%edx
+f01052c5:	83 c2 01             	add    $0x1,%edx
+f01052c8:	89 90 00 00 00 f0    	mov    %edx,-0x10000000(%eax)
+  env_wakeup_chan(il->il_chan);
+f01052ce:	83 ec 0c             	sub    $0xc,%esp
+f01052d1:	50                   	push   %eax
+f01052d2:	e8 00 ee ff ff       	call   f01040d7 <env_wakeup_chan>
+f01052d7:	83 c4 10             	add    $0x10,%esp
+f01052da:	eb a2                	jmp    f010527e <trap+0x1eb>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f01052dc:	50                   	push   %eax
+f01052dd:	68 c4 82 10 f0       	push   $0xf01082c4
+f01052e2:	68 88 01 00 00       	push   $0x188
+f01052e7:	68 ce 9b 10 f0       	push   $0xf0109bce
+f01052ec:	e8 4f ad ff ff       	call   f0100040 <_panic>
+    env_run(curenv);
+f01052f1:	e8 69 29 00 00       	call   f0107c5f <cpunum>
+f01052f6:	83 ec 0c             	sub    $0xc,%esp
+f01052f9:	6b c0 74             	imul   $0x74,%eax,%eax
+f01052fc:	ff b0 28 c0 79 f0    	push   -0xf863fd8(%eax)
+f0105302:	e8 5f ee ff ff       	call   f0104166 <env_run>
+f0105307:	90                   	nop
+
+f0105308 <t_divide>:
+.text
+
+/*
+ * Lab 3: Your code here for generating entry points for the different traps.
+ */
+  TRAPHANDLER_NOEC(t_divide, T_DIVIDE)
+f0105308:	6a 00                	push   $0x0
+f010530a:	6a 00                	push   $0x0
+f010530c:	e9 ef 00 00 00       	jmp    f0105400 <_alltraps>
+f0105311:	90                   	nop
+
+f0105312 <t_debug>:
+  TRAPHANDLER_NOEC(t_debug, T_DEBUG)
+f0105312:	6a 00                	push   $0x0
+f0105314:	6a 01                	push   $0x1
+f0105316:	e9 e5 00 00 00       	jmp    f0105400 <_alltraps>
+f010531b:	90                   	nop
+
+f010531c <t_nmi>:
+  TRAPHANDLER_NOEC(t_nmi, T_NMI)
+f010531c:	6a 00                	push   $0x0
+f010531e:	6a 02                	push   $0x2
+f0105320:	e9 db 00 00 00       	jmp    f0105400 <_alltraps>
+f0105325:	90                   	nop
+
+f0105326 <t_brkpt>:
+  TRAPHANDLER_NOEC(t_brkpt, T_BRKPT)
+f0105326:	6a 00                	push   $0x0
+f0105328:	6a 03                	push   $0x3
+f010532a:	e9 d1 00 00 00       	jmp    f0105400 <_alltraps>
+f010532f:	90                   	nop
+
+f0105330 <t_oflow>:
+  TRAPHANDLER_NOEC(t_oflow, T_OFLOW)
+f0105330:	6a 00                	push   $0x0
+f0105332:	6a 04                	push   $0x4
+f0105334:	e9 c7 00 00 00       	jmp    f0105400 <_alltraps>
+f0105339:	90                   	nop
+
+f010533a <t_bound>:
+  TRAPHANDLER_NOEC(t_bound, T_BOUND)
+f010533a:	6a 00                	push   $0x0
+f010533c:	6a 05                	push   $0x5
+f010533e:	e9 bd 00 00 00       	jmp    f0105400 <_alltraps>
+f0105343:	90                   	nop
+
+f0105344 <t_illop>:
+  TRAPHANDLER_NOEC(t_illop, T_ILLOP)
+f0105344:	6a 00                	push   $0x0
+f0105346:	6a 06                	push   $0x6
+f0105348:	e9 b3 00 00 00       	jmp    f0105400 <_alltraps>
+f010534d:	90                   	nop
+
+f010534e <t_device>:
+  TRAPHANDLER_NOEC(t_device, T_DEVICE)
+f010534e:	6a 00                	push   $0x0
+f0105350:	6a 07                	push   $0x7
+f0105352:	e9 a9 00 00 00       	jmp    f0105400 <_alltraps>
+f0105357:	90                   	nop
+
+f0105358 <t_dblflt>:
+  TRAPHANDLER(t_dblflt, T_DBLFLT)
+f0105358:	6a 08                	push   $0x8
+f010535a:	e9 a1 00 00 00       	jmp    f0105400 <_alltraps>
+f010535f:	90                   	nop
+
+f0105360 <t_tss>:
+  TRAPHANDLER(t_tss, T_TSS)
+f0105360:	6a 0a                	push   $0xa
+f0105362:	e9 99 00 00 00       	jmp    f0105400 <_alltraps>
+f0105367:	90                   	nop
+
+f0105368 <t_segnp>:
+  TRAPHANDLER(t_segnp, T_SEGNP)
+f0105368:	6a 0b                	push   $0xb
+f010536a:	e9 91 00 00 00       	jmp    f0105400 <_alltraps>
+f010536f:	90                   	nop
+
+f0105370 <t_stack>:
+  TRAPHANDLER(t_stack, T_STACK)
+f0105370:	6a 0c                	push   $0xc
+f0105372:	e9 89 00 00 00       	jmp    f0105400 <_alltraps>
+f0105377:	90                   	nop
+
+f0105378 <t_gpflt>:
+  TRAPHANDLER(t_gpflt, T_GPFLT)
+f0105378:	6a 0d                	push   $0xd
+f010537a:	e9 81 00 00 00       	jmp    f0105400 <_alltraps>
+f010537f:	90                   	nop
+
+f0105380 <t_pgflt>:
+  TRAPHANDLER(t_pgflt, T_PGFLT)
+f0105380:	6a 0e                	push   $0xe
+f0105382:	eb 7c                	jmp    f0105400 <_alltraps>
+
+f0105384 <t_fperr>:
+  TRAPHANDLER_NOEC(t_fperr, T_FPERR)
+f0105384:	6a 00                	push   $0x0
+f0105386:	6a 10                	push   $0x10
+f0105388:	eb 76                	jmp    f0105400 <_alltraps>
+
+f010538a <t_align>:
+  TRAPHANDLER(t_align, T_ALIGN)
+f010538a:	6a 11                	push   $0x11
+f010538c:	eb 72                	jmp    f0105400 <_alltraps>
+
+f010538e <t_mchk>:
+  TRAPHANDLER_NOEC(t_mchk, T_MCHK)
+f010538e:	6a 00                	push   $0x0
+f0105390:	6a 12                	push   $0x12
+f0105392:	eb 6c                	jmp    f0105400 <_alltraps>
+
+f0105394 <t_simderr>:
+  TRAPHANDLER_NOEC(t_simderr, T_SIMDERR)
+f0105394:	6a 00                	push   $0x0
+f0105396:	6a 13                	push   $0x13
+f0105398:	eb 66                	jmp    f0105400 <_alltraps>
+
+f010539a <t_syscall>:
+  TRAPHANDLER_NOEC(t_syscall, T_SYSCALL)
+f010539a:	6a 00                	push   $0x0
+f010539c:	6a 30                	push   $0x30
+f010539e:	eb 60                	jmp    f0105400 <_alltraps>
+
+f01053a0 <irq_timer>:
+
+  TRAPHANDLER_NOEC(irq_timer, IRQ_OFFSET + IRQ_TIMER)
+f01053a0:	6a 00                	push   $0x0
+f01053a2:	6a 20                	push   $0x20
+f01053a4:	eb 5a                	jmp    f0105400 <_alltraps>
+
+f01053a6 <irq_kbd>:
+  TRAPHANDLER_NOEC(irq_kbd, IRQ_OFFSET + IRQ_KBD)
+f01053a6:	6a 00                	push   $0x0
+f01053a8:	6a 21                	push   $0x21
+f01053aa:	eb 54                	jmp    f0105400 <_alltraps>
+
+f01053ac <irq_2>:
+  TRAPHANDLER_NOEC(irq_2, IRQ_OFFSET + 2)
+f01053ac:	6a 00                	push   $0x0
+f01053ae:	6a 22                	push   $0x22
+f01053b0:	eb 4e                	jmp    f0105400 <_alltraps>
+
+f01053b2 <irq_3>:
+  TRAPHANDLER_NOEC(irq_3, IRQ_OFFSET + 3)
+f01053b2:	6a 00                	push   $0x0
+f01053b4:	6a 23                	push   $0x23
+f01053b6:	eb 48                	jmp    f0105400 <_alltraps>
+
+f01053b8 <irq_serial>:
+  TRAPHANDLER_NOEC(irq_serial, IRQ_OFFSET + IRQ_SERIAL)
+f01053b8:	6a 00                	push   $0x0
+f01053ba:	6a 24                	push   $0x24
+f01053bc:	eb 42                	jmp    f0105400 <_alltraps>
+
+f01053be <irq_5>:
+  TRAPHANDLER_NOEC(irq_5, IRQ_OFFSET + 5)
+f01053be:	6a 00                	push   $0x0
+f01053c0:	6a 25                	push   $0x25
+f01053c2:	eb 3c                	jmp    f0105400 <_alltraps>
+
+f01053c4 <irq_6>:
+  TRAPHANDLER_NOEC(irq_6, IRQ_OFFSET + 6)
+f01053c4:	6a 00                	push   $0x0
+f01053c6:	6a 26                	push   $0x26
+f01053c8:	eb 36                	jmp    f0105400 <_alltraps>
+
+f01053ca <irq_spurious>:
+  TRAPHANDLER_NOEC(irq_spurious, IRQ_OFFSET + IRQ_SPURIOUS)
+f01053ca:	6a 00                	push   $0x0
+f01053cc:	6a 27                	push   $0x27
+f01053ce:	eb 30                	jmp    f0105400 <_alltraps>
+
+f01053d0 <irq_8>:
+  TRAPHANDLER_NOEC(irq_8, IRQ_OFFSET + 8)
+f01053d0:	6a 00                	push   $0x0
+f01053d2:	6a 28                	push   $0x28
+f01053d4:	eb 2a                	jmp    f0105400 <_alltraps>
+
+f01053d6 <irq_9>:
+  TRAPHANDLER_NOEC(irq_9, IRQ_OFFSET + 9)
+f01053d6:	6a 00                	push   $0x0
+f01053d8:	6a 29                	push   $0x29
+f01053da:	eb 24                	jmp    f0105400 <_alltraps>
+
+f01053dc <irq_10>:
+  TRAPHANDLER_NOEC(irq_10, IRQ_OFFSET + 10)
+f01053dc:	6a 00                	push   $0x0
+f01053de:	6a 2a                	push   $0x2a
+f01053e0:	eb 1e                	jmp    f0105400 <_alltraps>
+
+f01053e2 <irq_11>:
+  TRAPHANDLER_NOEC(irq_11, IRQ_OFFSET + 11)
+f01053e2:	6a 00                	push   $0x0
+f01053e4:	6a 2b                	push   $0x2b
+f01053e6:	eb 18                	jmp    f0105400 <_alltraps>
+
+f01053e8 <irq_12>:
+  TRAPHANDLER_NOEC(irq_12, IRQ_OFFSET + 12)
+f01053e8:	6a 00                	push   $0x0
+f01053ea:	6a 2c                	push   $0x2c
+f01053ec:	eb 12                	jmp    f0105400 <_alltraps>
+
+f01053ee <irq_13>:
+  TRAPHANDLER_NOEC(irq_13, IRQ_OFFSET + 13)
+f01053ee:	6a 00                	push   $0x0
+f01053f0:	6a 2d                	push   $0x2d
+f01053f2:	eb 0c                	jmp    f0105400 <_alltraps>
+
+f01053f4 <irq_ide>:
+  TRAPHANDLER_NOEC(irq_ide, IRQ_OFFSET + IRQ_IDE)
+f01053f4:	6a 00                	push   $0x0
+f01053f6:	6a 2e                	push   $0x2e
+f01053f8:	eb 06                	jmp    f0105400 <_alltraps>
+
+f01053fa <irq_15>:
+  TRAPHANDLER_NOEC(irq_15, IRQ_OFFSET + 15)
+f01053fa:	6a 00                	push   $0x0
+f01053fc:	6a 2f                	push   $0x2f
+f01053fe:	eb 00                	jmp    f0105400 <_alltraps>
+
+f0105400 <_alltraps>:
+/*
+ * Lab 3: Your code here for _alltraps
+ */
+ .globl _alltraps
+ _alltraps:
+  pushl %ds
+f0105400:	1e                   	push   %ds
+  pushl %es
+f0105401:	06                   	push   %es
+  pushal
+f0105402:	60                   	pusha
+
+  movl $GD_KD, %eax
+f0105403:	b8 10 00 00 00       	mov    $0x10,%eax
+  movw %ax, %ds
+f0105408:	8e d8                	mov    %eax,%ds
+  movw %ax, %es
+f010540a:	8e c0                	mov    %eax,%es
+ 
+  pushl %esp
+f010540c:	54                   	push   %esp
+  call trap
+f010540d:	e8 81 fc ff ff       	call   f0105093 <trap>
+
+f0105412 <sched_halt>:
+// Halt this CPU when there is nothing to do. Wait until the
+// timer interrupt wakes it up. This function never returns.
+//
+void
+sched_halt(void)
+{
+f0105412:	55                   	push   %ebp
+f0105413:	89 e5                	mov    %esp,%ebp
+f0105415:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  // For debugging and testing purposes, if there are no runnable
+  // environments in the system, then drop into the kernel monitor.
+  for (i = 0; i < NENV; i++) {
+f0105418:	a1 48 b2 79 f0       	mov    0xf079b248,%eax
+f010541d:	8d 50 54             	lea    0x54(%eax),%edx
+f0105420:	b9 00 00 00 00       	mov    $0x0,%ecx
+    if ((envs[i].env_status == ENV_RUNNABLE ||
+         envs[i].env_status == ENV_RUNNING ||
+f0105425:	8b 02                	mov    (%edx),%eax
+f0105427:	83 e8 01             	sub    $0x1,%eax
+    if ((envs[i].env_status == ENV_RUNNABLE ||
+f010542a:	81 c2 90 00 00 00    	add    $0x90,%edx
+f0105430:	83 f8 02             	cmp    $0x2,%eax
+f0105433:	76 3c                	jbe    f0105471 <sched_halt+0x5f>
+  for (i = 0; i < NENV; i++) {
+f0105435:	83 c1 01             	add    $0x1,%ecx
+f0105438:	81 f9 00 04 00 00    	cmp    $0x400,%ecx
+f010543e:	75 e5                	jne    f0105425 <sched_halt+0x13>
+         envs[i].env_status == ENV_DYING))
+      break;
+  }
+  if (i == NENV) {
+    cprintf("No runnable environments in the system!\n");
+f0105440:	83 ec 0c             	sub    $0xc,%esp
+f0105443:	68 10 9e 10 f0       	push   $0xf0109e10
+f0105448:	e8 df ef ff ff       	call   f010442c <cprintf>
+f010544d:	83 c4 10             	add    $0x10,%esp
+    while (1)
+      monitor(NULL);
+f0105450:	83 ec 0c             	sub    $0xc,%esp
+f0105453:	6a 00                	push   $0x0
+f0105455:	e8 7e b8 ff ff       	call   f0100cd8 <monitor>
+f010545a:	83 c4 10             	add    $0x10,%esp
+f010545d:	eb f1                	jmp    f0105450 <sched_halt+0x3e>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f010545f:	50                   	push   %eax
+f0105460:	68 e8 82 10 f0       	push   $0xf01082e8
+f0105465:	6a 56                	push   $0x56
+f0105467:	68 39 9e 10 f0       	push   $0xf0109e39
+f010546c:	e8 cf ab ff ff       	call   f0100040 <_panic>
+  }
+
+  // Mark that no environment is running on this CPU
+  curenv = NULL;
+f0105471:	e8 e9 27 00 00       	call   f0107c5f <cpunum>
+f0105476:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105479:	c7 80 28 c0 79 f0 00 	movl   $0x0,-0xf863fd8(%eax)
+f0105480:	00 00 00 
+  lcr3(PADDR(kern_pgdir));
+f0105483:	a1 0c bf 79 f0       	mov    0xf079bf0c,%eax
+	if ((uint32_t)kva < KERNBASE)
+f0105488:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f010548d:	76 d0                	jbe    f010545f <sched_halt+0x4d>
+	return (physaddr_t)kva - KERNBASE;
+f010548f:	05 00 00 00 10       	add    $0x10000000,%eax
+  __asm __volatile("movl %0,%%cr3" : : "r" (val));
+f0105494:	0f 22 d8             	mov    %eax,%cr3
+
+  // Mark that this CPU is in the HALT state, so that when
+  // timer interupts come in, we know we should re-acquire the
+  // big kernel lock
+  xchg(&thiscpu->cpu_status, CPU_HALTED);
+f0105497:	e8 c3 27 00 00       	call   f0107c5f <cpunum>
+f010549c:	6b d0 74             	imul   $0x74,%eax,%edx
+f010549f:	83 c2 04             	add    $0x4,%edx
+  asm volatile ("lock; xchgl %0, %1" :
+f01054a2:	b8 02 00 00 00       	mov    $0x2,%eax
+f01054a7:	f0 87 82 20 c0 79 f0 	lock xchg %eax,-0xf863fe0(%edx)
+	spin_unlock(&kernel_lock);
+f01054ae:	83 ec 0c             	sub    $0xc,%esp
+f01054b1:	68 c0 53 11 f0       	push   $0xf01153c0
+f01054b6:	e8 ae 2a 00 00       	call   f0107f69 <spin_unlock>
+	asm volatile("pause");
+f01054bb:	f3 90                	pause
+    "pushl $0\n"
+    "sti\n"
+    "1:\n"
+    "hlt\n"
+    "jmp 1b\n"
+    : : "a" (thiscpu->cpu_ts.ts_esp0));
+f01054bd:	e8 9d 27 00 00       	call   f0107c5f <cpunum>
+f01054c2:	6b c0 74             	imul   $0x74,%eax,%eax
+  asm volatile (
+f01054c5:	8b 80 30 c0 79 f0    	mov    -0xf863fd0(%eax),%eax
+f01054cb:	bd 00 00 00 00       	mov    $0x0,%ebp
+f01054d0:	89 c4                	mov    %eax,%esp
+f01054d2:	6a 00                	push   $0x0
+f01054d4:	6a 00                	push   $0x0
+f01054d6:	fb                   	sti
+f01054d7:	f4                   	hlt
+f01054d8:	eb fd                	jmp    f01054d7 <sched_halt+0xc5>
+}
+f01054da:	c9                   	leave
+f01054db:	c3                   	ret
+
+f01054dc <sched_yield>:
+{
+f01054dc:	55                   	push   %ebp
+f01054dd:	89 e5                	mov    %esp,%ebp
+f01054df:	56                   	push   %esi
+f01054e0:	53                   	push   %ebx
+  now = time_msec();
+f01054e1:	e8 72 19 00 00       	call   f0106e58 <time_msec>
+f01054e6:	89 c6                	mov    %eax,%esi
+f01054e8:	bb 00 00 00 00       	mov    $0x0,%ebx
+f01054ed:	eb 0e                	jmp    f01054fd <sched_yield+0x21>
+  for (count = 0; count < NENV; count++) {
+f01054ef:	81 c3 90 00 00 00    	add    $0x90,%ebx
+f01054f5:	81 fb 00 40 02 00    	cmp    $0x24000,%ebx
+f01054fb:	74 35                	je     f0105532 <sched_yield+0x56>
+    if (envs[count].env_status == ENV_NOT_RUNNABLE &&
+f01054fd:	89 d8                	mov    %ebx,%eax
+f01054ff:	03 05 48 b2 79 f0    	add    0xf079b248,%eax
+f0105505:	83 78 54 04          	cmpl   $0x4,0x54(%eax)
+f0105509:	75 e4                	jne    f01054ef <sched_yield+0x13>
+f010550b:	83 b8 84 00 00 00 00 	cmpl   $0x0,0x84(%eax)
+f0105512:	74 db                	je     f01054ef <sched_yield+0x13>
+        envs[count].env_sleep_deadline &&
+f0105514:	8b 90 8c 00 00 00    	mov    0x8c(%eax),%edx
+f010551a:	39 d6                	cmp    %edx,%esi
+f010551c:	72 d1                	jb     f01054ef <sched_yield+0x13>
+f010551e:	85 d2                	test   %edx,%edx
+f0105520:	74 cd                	je     f01054ef <sched_yield+0x13>
+      env_wakeup(&envs[count], 0);
+f0105522:	83 ec 08             	sub    $0x8,%esp
+f0105525:	6a 00                	push   $0x0
+f0105527:	50                   	push   %eax
+f0105528:	e8 8b eb ff ff       	call   f01040b8 <env_wakeup>
+f010552d:	83 c4 10             	add    $0x10,%esp
+f0105530:	eb bd                	jmp    f01054ef <sched_yield+0x13>
+  envid = curenv ? ENVX(curenv->env_id) : NENV - 1;
+f0105532:	e8 28 27 00 00       	call   f0107c5f <cpunum>
+f0105537:	6b d0 74             	imul   $0x74,%eax,%edx
+f010553a:	b8 ff 03 00 00       	mov    $0x3ff,%eax
+f010553f:	83 ba 28 c0 79 f0 00 	cmpl   $0x0,-0xf863fd8(%edx)
+f0105546:	74 16                	je     f010555e <sched_yield+0x82>
+f0105548:	e8 12 27 00 00       	call   f0107c5f <cpunum>
+f010554d:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105550:	8b 80 28 c0 79 f0    	mov    -0xf863fd8(%eax),%eax
+f0105556:	8b 40 48             	mov    0x48(%eax),%eax
+f0105559:	25 ff 03 00 00       	and    $0x3ff,%eax
+  cur_envid = (envid + 1) % NENV;
+f010555e:	83 c0 01             	add    $0x1,%eax
+f0105561:	25 ff 03 00 00       	and    $0x3ff,%eax
+    if (envs[cur_envid].env_status == ENV_RUNNABLE) {
+f0105566:	8b 1d 48 b2 79 f0    	mov    0xf079b248,%ebx
+  for (count = 0; count < NENV; count++) {
+f010556c:	b9 01 04 00 00       	mov    $0x401,%ecx
+f0105571:	83 e9 01             	sub    $0x1,%ecx
+f0105574:	74 21                	je     f0105597 <sched_yield+0xbb>
+    if (envs[cur_envid].env_status == ENV_RUNNABLE) {
+f0105576:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+f0105579:	c1 e2 04             	shl    $0x4,%edx
+f010557c:	01 da                	add    %ebx,%edx
+f010557e:	83 7a 54 02          	cmpl   $0x2,0x54(%edx)
+f0105582:	74 0a                	je     f010558e <sched_yield+0xb2>
+    cur_envid = (cur_envid + 1) % NENV;
+f0105584:	83 c0 01             	add    $0x1,%eax
+f0105587:	25 ff 03 00 00       	and    $0x3ff,%eax
+  for (count = 0; count < NENV; count++) {
+f010558c:	eb e3                	jmp    f0105571 <sched_yield+0x95>
+      env_run(&envs[cur_envid]);
+f010558e:	83 ec 0c             	sub    $0xc,%esp
+f0105591:	52                   	push   %edx
+f0105592:	e8 cf eb ff ff       	call   f0104166 <env_run>
+  if (curenv && curenv->env_status == ENV_RUNNING) {
+f0105597:	e8 c3 26 00 00       	call   f0107c5f <cpunum>
+f010559c:	6b c0 74             	imul   $0x74,%eax,%eax
+f010559f:	83 b8 28 c0 79 f0 00 	cmpl   $0x0,-0xf863fd8(%eax)
+f01055a6:	74 14                	je     f01055bc <sched_yield+0xe0>
+f01055a8:	e8 b2 26 00 00       	call   f0107c5f <cpunum>
+f01055ad:	6b c0 74             	imul   $0x74,%eax,%eax
+f01055b0:	8b 80 28 c0 79 f0    	mov    -0xf863fd8(%eax),%eax
+f01055b6:	83 78 54 03          	cmpl   $0x3,0x54(%eax)
+f01055ba:	74 0c                	je     f01055c8 <sched_yield+0xec>
+  sched_halt();
+f01055bc:	e8 51 fe ff ff       	call   f0105412 <sched_halt>
+}
+f01055c1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f01055c4:	5b                   	pop    %ebx
+f01055c5:	5e                   	pop    %esi
+f01055c6:	5d                   	pop    %ebp
+f01055c7:	c3                   	ret
+    env_run(curenv);
+f01055c8:	e8 92 26 00 00       	call   f0107c5f <cpunum>
+f01055cd:	83 ec 0c             	sub    $0xc,%esp
+f01055d0:	6b c0 74             	imul   $0x74,%eax,%eax
+f01055d3:	ff b0 28 c0 79 f0    	push   -0xf863fd8(%eax)
+f01055d9:	e8 88 eb ff ff       	call   f0104166 <env_run>
+
+f01055de <range_perm>:
+
+// Compute the permissions a page mapped by 'pte' gets under the range
+// transform 'xform' (see inc/syscall.h), or 0 if the transform skips it.
+static int
+range_perm(pte_t pte, int xform)
+{
+f01055de:	55                   	push   %ebp
+f01055df:	89 e5                	mov    %esp,%ebp
+f01055e1:	53                   	push   %ebx
+  int perm = pte & PTE_SYSCALL;
+f01055e2:	89 c1                	mov    %eax,%ecx
+f01055e4:	81 e1 07 0e 00 00    	and    $0xe07,%ecx
+
+  if ( (pte & (PTE_P | PTE_U)) != (PTE_P | PTE_U) )
+f01055ea:	89 c3                	mov    %eax,%ebx
+f01055ec:	83 e3 05             	and    $0x5,%ebx
+f01055ef:	83 fb 05             	cmp    $0x5,%ebx
+f01055f2:	75 52                	jne    f0105646 <range_perm+0x68>
+    return 0;
+
+  switch (xform) {
+f01055f4:	83 fa 02             	cmp    $0x2,%edx
+f01055f7:	74 40                	je     f0105639 <range_perm+0x5b>
+f01055f9:	7f 2a                	jg     f0105625 <range_perm+0x47>
+f01055fb:	85 d2                	test   %edx,%edx
+f01055fd:	74 4c                	je     f010564b <range_perm+0x6d>
+f01055ff:	83 fa 01             	cmp    $0x1,%edx
+f0105602:	75 1a                	jne    f010561e <range_perm+0x40>
+    case PMR_SAME:
+      return perm;
+    case PMR_COW:
+      if ( (perm & (PTE_W | PTE_COW)) && !(perm & PTE_SHARE) )
+f0105604:	a9 02 08 00 00       	test   $0x802,%eax
+f0105609:	74 40                	je     f010564b <range_perm+0x6d>
+        return (perm & ~PTE_W) | PTE_COW;
+f010560b:	89 c2                	mov    %eax,%edx
+f010560d:	81 e2 05 06 00 00    	and    $0x605,%edx
+f0105613:	80 ce 08             	or     $0x8,%dh
+f0105616:	f6 c4 04             	test   $0x4,%ah
+f0105619:	0f 44 ca             	cmove  %edx,%ecx
+f010561c:	eb 2d                	jmp    f010564b <range_perm+0x6d>
+    case PMR_SHARED:
+      return (perm & PTE_SHARE) ? perm : 0;
+    case PMR_RDONLY:
+      return perm & ~PTE_W;
+  }
+  return 0;
+f010561e:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0105623:	eb 26                	jmp    f010564b <range_perm+0x6d>
+f0105625:	25 05 0e 00 00       	and    $0xe05,%eax
+f010562a:	89 c1                	mov    %eax,%ecx
+f010562c:	83 fa 03             	cmp    $0x3,%edx
+f010562f:	b8 00 00 00 00       	mov    $0x0,%eax
+f0105634:	0f 45 c8             	cmovne %eax,%ecx
+f0105637:	eb 12                	jmp    f010564b <range_perm+0x6d>
+      return (perm & PTE_SHARE) ? perm : 0;
+f0105639:	f6 c4 04             	test   $0x4,%ah
+f010563c:	b8 00 00 00 00       	mov    $0x0,%eax
+f0105641:	0f 44 c8             	cmove  %eax,%ecx
+f0105644:	eb 05                	jmp    f010564b <range_perm+0x6d>
+    return 0;
+f0105646:	b9 00 00 00 00       	mov    $0x0,%ecx
+}
+f010564b:	89 c8                	mov    %ecx,%eax
+f010564d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0105650:	c9                   	leave
+f0105651:	c3                   	ret
+
+f0105652 <range_check>:
+}
+
+// Validate the arguments shared by the range system calls.
+static int
+range_check(void *va, size_t len, int xform)
+{
+f0105652:	55                   	push   %ebp
+f0105653:	89 e5                	mov    %esp,%ebp
+f0105655:	53                   	push   %ebx
+  uintptr_t end = (uintptr_t) va + len;
+f0105656:	8d 1c 10             	lea    (%eax,%edx,1),%ebx
+
+  if ( PGOFF(va) || PGOFF(len) || end > UTOP || end < (uintptr_t) va )
+f0105659:	09 c2                	or     %eax,%edx
+f010565b:	f7 c2 ff 0f 00 00    	test   $0xfff,%edx
+f0105661:	75 1b                	jne    f010567e <range_check+0x2c>
+f0105663:	81 fb 00 00 c0 ee    	cmp    $0xeec00000,%ebx
+f0105669:	77 1a                	ja     f0105685 <range_check+0x33>
+f010566b:	39 d8                	cmp    %ebx,%eax
+f010566d:	77 16                	ja     f0105685 <range_check+0x33>
+    return -E_INVAL;
+  if ( xform < PMR_SAME || xform > PMR_RDONLY )
+    return -E_INVAL;
+  return 0;
+f010566f:	83 f9 04             	cmp    $0x4,%ecx
+f0105672:	19 c0                	sbb    %eax,%eax
+f0105674:	f7 d0                	not    %eax
+f0105676:	83 e0 fd             	and    $0xfffffffd,%eax
+}
+f0105679:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010567c:	c9                   	leave
+f010567d:	c3                   	ret
+    return -E_INVAL;
+f010567e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0105683:	eb f4                	jmp    f0105679 <range_check+0x27>
+f0105685:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f010568a:	eb ed                	jmp    f0105679 <range_check+0x27>
+
+f010568c <sys_page_alloc>:
+{
+f010568c:	55                   	push   %ebp
+f010568d:	89 e5                	mov    %esp,%ebp
+f010568f:	57                   	push   %edi
+f0105690:	56                   	push   %esi
+f0105691:	53                   	push   %ebx
+f0105692:	83 ec 2c             	sub    $0x2c,%esp
+  if (((uintptr_t) (va) >= UTOP) ||
+f0105695:	81 fa ff ff bf ee    	cmp    $0xeebfffff,%edx
+f010569b:	77 7f                	ja     f010571c <sys_page_alloc+0x90>
+f010569d:	89 d3                	mov    %edx,%ebx
+f010569f:	89 ce                	mov    %ecx,%esi
+      ((uintptr_t) (va) % PGSIZE != 0) ||                             // va not page aligned
+f01056a1:	89 d1                	mov    %edx,%ecx
+f01056a3:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+f01056a9:	f7 c6 05 00 00 00    	test   $0x5,%esi
+f01056af:	74 72                	je     f0105723 <sys_page_alloc+0x97>
+      (perm & ~PTE_SYSCALL)) {  // perm has stuff other than PTE_P | PTE_U | PTE_AVAIL | PTE_W
+f01056b1:	89 f2                	mov    %esi,%edx
+f01056b3:	81 e2 f8 f1 ff ff    	and    $0xfffff1f8,%edx
+      !(perm & (PTE_P | PTE_U)) ||                      // perm doesn't have PTE_U | PTE_P
+f01056b9:	09 ca                	or     %ecx,%edx
+f01056bb:	75 6d                	jne    f010572a <sys_page_alloc+0x9e>
+  if ( (error = envid2env(envid, &env, 1)) )
+f01056bd:	83 ec 04             	sub    $0x4,%esp
+f01056c0:	6a 01                	push   $0x1
+f01056c2:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+f01056c5:	52                   	push   %edx
+f01056c6:	50                   	push   %eax
+f01056c7:	e8 18 e3 ff ff       	call   f01039e4 <envid2env>
+f01056cc:	89 c7                	mov    %eax,%edi
+f01056ce:	83 c4 10             	add    $0x10,%esp
+f01056d1:	85 c0                	test   %eax,%eax
+f01056d3:	74 0a                	je     f01056df <sys_page_alloc+0x53>
+}
+f01056d5:	89 f8                	mov    %edi,%eax
+f01056d7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01056da:	5b                   	pop    %ebx
+f01056db:	5e                   	pop    %esi
+f01056dc:	5f                   	pop    %edi
+f01056dd:	5d                   	pop    %ebp
+f01056de:	c3                   	ret
+  if ( !(page = page_alloc(ALLOC_ZERO)) )
+f01056df:	83 ec 0c             	sub    $0xc,%esp
+f01056e2:	6a 01                	push   $0x1
+f01056e4:	e8 c8 bb ff ff       	call   f01012b1 <page_alloc>
+f01056e9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f01056ec:	83 c4 10             	add    $0x10,%esp
+f01056ef:	85 c0                	test   %eax,%eax
+f01056f1:	74 3e                	je     f0105731 <sys_page_alloc+0xa5>
+  if ( (error = page_insert(env->env_pgdir, page, va, perm)) < 0) {
+f01056f3:	56                   	push   %esi
+f01056f4:	53                   	push   %ebx
+f01056f5:	50                   	push   %eax
+f01056f6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01056f9:	ff 70 60             	push   0x60(%eax)
+f01056fc:	e8 14 c2 ff ff       	call   f0101915 <page_insert>
+f0105701:	89 c3                	mov    %eax,%ebx
+f0105703:	83 c4 10             	add    $0x10,%esp
+f0105706:	85 c0                	test   %eax,%eax
+f0105708:	79 cb                	jns    f01056d5 <sys_page_alloc+0x49>
+    page_free(page);
+f010570a:	83 ec 0c             	sub    $0xc,%esp
+f010570d:	ff 75 d4             	push   -0x2c(%ebp)
+f0105710:	e8 3b bd ff ff       	call   f0101450 <page_free>
+    return error;
+f0105715:	83 c4 10             	add    $0x10,%esp
+f0105718:	89 df                	mov    %ebx,%edi
+f010571a:	eb b9                	jmp    f01056d5 <sys_page_alloc+0x49>
+    return -E_INVAL;
+f010571c:	bf fd ff ff ff       	mov    $0xfffffffd,%edi
+f0105721:	eb b2                	jmp    f01056d5 <sys_page_alloc+0x49>
+f0105723:	bf fd ff ff ff       	mov    $0xfffffffd,%edi
+f0105728:	eb ab                	jmp    f01056d5 <sys_page_alloc+0x49>
+f010572a:	bf fd ff ff ff       	mov    $0xfffffffd,%edi
+f010572f:	eb a4                	jmp    f01056d5 <sys_page_alloc+0x49>
+    return -E_NO_MEM;
+f0105731:	bf fc ff ff ff       	mov    $0xfffffffc,%edi
+f0105736:	eb 9d                	jmp    f01056d5 <sys_page_alloc+0x49>
+
+f0105738 <chan_lookup>:
+chan_lookup(void *chan, physaddr_t *pa_store)
+{
+  struct PageInfo *page;
+  pte_t *pte;
+
+  if ((uintptr_t) chan >= UTOP || ((uintptr_t) chan & 3))
+f0105738:	3d ff ff bf ee       	cmp    $0xeebfffff,%eax
+f010573d:	77 5f                	ja     f010579e <chan_lookup+0x66>
+{
+f010573f:	55                   	push   %ebp
+f0105740:	89 e5                	mov    %esp,%ebp
+f0105742:	56                   	push   %esi
+f0105743:	53                   	push   %ebx
+f0105744:	83 ec 10             	sub    $0x10,%esp
+f0105747:	89 c3                	mov    %eax,%ebx
+f0105749:	89 d6                	mov    %edx,%esi
+  if ((uintptr_t) chan >= UTOP || ((uintptr_t) chan & 3))
+f010574b:	a8 03                	test   $0x3,%al
+f010574d:	75 55                	jne    f01057a4 <chan_lookup+0x6c>
+    return -E_INVAL;
+
+  if ( !(page = page_lookup(curenv->env_pgdir, chan, &pte)) || !(*pte & PTE_P) )
+f010574f:	e8 0b 25 00 00       	call   f0107c5f <cpunum>
+f0105754:	83 ec 04             	sub    $0x4,%esp
+f0105757:	8d 55 f4             	lea    -0xc(%ebp),%edx
+f010575a:	52                   	push   %edx
+f010575b:	53                   	push   %ebx
+f010575c:	6b c0 74             	imul   $0x74,%eax,%eax
+f010575f:	8b 80 28 c0 79 f0    	mov    -0xf863fd8(%eax),%eax
+f0105765:	ff 70 60             	push   0x60(%eax)
+f0105768:	e8 a9 c0 ff ff       	call   f0101816 <page_lookup>
+f010576d:	83 c4 10             	add    $0x10,%esp
+f0105770:	85 c0                	test   %eax,%eax
+f0105772:	74 37                	je     f01057ab <chan_lookup+0x73>
+f0105774:	8b 55 f4             	mov    -0xc(%ebp),%edx
+f0105777:	f6 02 01             	testb  $0x1,(%edx)
+f010577a:	74 36                	je     f01057b2 <chan_lookup+0x7a>
+	return (pp - pages) << PGSHIFT;
+f010577c:	2b 05 10 bf 79 f0    	sub    0xf079bf10,%eax
+f0105782:	c1 f8 03             	sar    $0x3,%eax
+f0105785:	c1 e0 0c             	shl    $0xc,%eax
+    return -E_INVAL;
+
+  *pa_store = page2pa(page) + PGOFF(chan);
+f0105788:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+f010578e:	01 d8                	add    %ebx,%eax
+f0105790:	89 06                	mov    %eax,(%esi)
+  return 0;
+f0105792:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0105797:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f010579a:	5b                   	pop    %ebx
+f010579b:	5e                   	pop    %esi
+f010579c:	5d                   	pop    %ebp
+f010579d:	c3                   	ret
+    return -E_INVAL;
+f010579e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+f01057a3:	c3                   	ret
+    return -E_INVAL;
+f01057a4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f01057a9:	eb ec                	jmp    f0105797 <chan_lookup+0x5f>
+    return -E_INVAL;
+f01057ab:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f01057b0:	eb e5                	jmp    f0105797 <chan_lookup+0x5f>
+f01057b2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f01057b7:	eb de                	jmp    f0105797 <chan_lookup+0x5f>
+
+f01057b9 <page_writable>:
+{
+f01057b9:	55                   	push   %ebp
+f01057ba:	89 e5                	mov    %esp,%ebp
+f01057bc:	56                   	push   %esi
+f01057bd:	53                   	push   %ebx
+f01057be:	83 ec 18             	sub    $0x18,%esp
+f01057c1:	89 c6                	mov    %eax,%esi
+f01057c3:	89 d3                	mov    %edx,%ebx
+  if ( (error = pgdir_unshare(pgdir, va)) < 0 )
+f01057c5:	52                   	push   %edx
+f01057c6:	50                   	push   %eax
+f01057c7:	e8 e3 bc ff ff       	call   f01014af <pgdir_unshare>
+f01057cc:	83 c4 10             	add    $0x10,%esp
+f01057cf:	85 c0                	test   %eax,%eax
+f01057d1:	78 2d                	js     f0105800 <page_writable+0x47>
+  if ( !page_lookup(pgdir, va, &pte) )
+f01057d3:	83 ec 04             	sub    $0x4,%esp
+f01057d6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+f01057d9:	50                   	push   %eax
+f01057da:	53                   	push   %ebx
+f01057db:	56                   	push   %esi
+f01057dc:	e8 35 c0 ff ff       	call   f0101816 <page_lookup>
+f01057e1:	83 c4 10             	add    $0x10,%esp
+f01057e4:	85 c0                	test   %eax,%eax
+f01057e6:	74 1f                	je     f0105807 <page_writable+0x4e>
+  return (*pte & PTE_W) && (pgdir[PDX(va)] & PTE_W);
+f01057e8:	b8 00 00 00 00       	mov    $0x0,%eax
+f01057ed:	8b 55 f4             	mov    -0xc(%ebp),%edx
+f01057f0:	f6 02 02             	testb  $0x2,(%edx)
+f01057f3:	74 0b                	je     f0105800 <page_writable+0x47>
+f01057f5:	c1 eb 16             	shr    $0x16,%ebx
+f01057f8:	8b 04 9e             	mov    (%esi,%ebx,4),%eax
+f01057fb:	d1 e8                	shr    %eax
+f01057fd:	83 e0 01             	and    $0x1,%eax
+}
+f0105800:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0105803:	5b                   	pop    %ebx
+f0105804:	5e                   	pop    %esi
+f0105805:	5d                   	pop    %ebp
+f0105806:	c3                   	ret
+    return 0;
+f0105807:	b8 00 00 00 00       	mov    $0x0,%eax
+f010580c:	eb f2                	jmp    f0105800 <page_writable+0x47>
+
+f010580e <sys_exofork>:
+{
+f010580e:	55                   	push   %ebp
+f010580f:	89 e5                	mov    %esp,%ebp
+f0105811:	83 ec 18             	sub    $0x18,%esp
+  if ( (error = env_alloc(&env, curenv->env_id)) < 0 ) {
+f0105814:	e8 46 24 00 00       	call   f0107c5f <cpunum>
+f0105819:	83 ec 08             	sub    $0x8,%esp
+f010581c:	6b c0 74             	imul   $0x74,%eax,%eax
+f010581f:	8b 80 28 c0 79 f0    	mov    -0xf863fd8(%eax),%eax
+f0105825:	ff 70 48             	push   0x48(%eax)
+f0105828:	8d 45 f4             	lea    -0xc(%ebp),%eax
+f010582b:	50                   	push   %eax
+f010582c:	e8 d6 e2 ff ff       	call   f0103b07 <env_alloc>
+f0105831:	83 c4 10             	add    $0x10,%esp
+f0105834:	85 c0                	test   %eax,%eax
+f0105836:	78 4d                	js     f0105885 <sys_exofork+0x77>
+  env->env_status = ENV_NOT_RUNNABLE;
+f0105838:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f010583b:	c7 40 54 04 00 00 00 	movl   $0x4,0x54(%eax)
+  memmove(&env->env_tf, &curenv->env_tf, sizeof(struct Trapframe));
+f0105842:	e8 18 24 00 00       	call   f0107c5f <cpunum>
+f0105847:	83 ec 04             	sub    $0x4,%esp
+f010584a:	6a 44                	push   $0x44
+f010584c:	6b c0 74             	imul   $0x74,%eax,%eax
+f010584f:	ff b0 28 c0 79 f0    	push   -0xf863fd8(%eax)
+f0105855:	ff 75 f4             	push   -0xc(%ebp)
+f0105858:	e8 54 1e 00 00       	call   f01076b1 <memmove>
+  env->env_tf.tf_regs.reg_eax = 0;
+f010585d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f0105860:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  env->env_kern_cow = curenv->env_kern_cow;
+f0105867:	e8 f3 23 00 00       	call   f0107c5f <cpunum>
+f010586c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+f010586f:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105872:	8b 80 28 c0 79 f0    	mov    -0xf863fd8(%eax),%eax
+f0105878:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+f010587c:	88 42 6c             	mov    %al,0x6c(%edx)
+  return env->env_id;
+f010587f:	8b 42 48             	mov    0x48(%edx),%eax
+f0105882:	83 c4 10             	add    $0x10,%esp
+}
+f0105885:	c9                   	leave
+f0105886:	c3                   	ret
+
+f0105887 <range_walk>:
+{
+f0105887:	55                   	push   %ebp
+f0105888:	89 e5                	mov    %esp,%ebp
+f010588a:	53                   	push   %ebx
+f010588b:	83 ec 04             	sub    $0x4,%esp
+  if ( !(pgdir[PDX(*va)] & PTE_P) ) {
+f010588e:	8b 0a                	mov    (%edx),%ecx
+f0105890:	89 cb                	mov    %ecx,%ebx
+f0105892:	c1 eb 16             	shr    $0x16,%ebx
+f0105895:	f6 04 98 01          	testb  $0x1,(%eax,%ebx,4)
+f0105899:	74 14                	je     f01058af <range_walk+0x28>
+  return pgdir_walk(pgdir, (void *) *va, 0);
+f010589b:	83 ec 04             	sub    $0x4,%esp
+f010589e:	6a 00                	push   $0x0
+f01058a0:	51                   	push   %ecx
+f01058a1:	50                   	push   %eax
+f01058a2:	e8 13 be ff ff       	call   f01016ba <pgdir_walk>
+f01058a7:	83 c4 10             	add    $0x10,%esp
+}
+f01058aa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f01058ad:	c9                   	leave
+f01058ae:	c3                   	ret
+    *va = ROUNDDOWN(*va, PTSIZE) + PTSIZE - PGSIZE;
+f01058af:	81 e1 00 00 c0 ff    	and    $0xffc00000,%ecx
+f01058b5:	81 c1 00 f0 3f 00    	add    $0x3ff000,%ecx
+f01058bb:	89 0a                	mov    %ecx,(%edx)
+    return NULL;
+f01058bd:	b8 00 00 00 00       	mov    $0x0,%eax
+f01058c2:	eb e6                	jmp    f01058aa <range_walk+0x23>
+
+f01058c4 <range_map>:
+{
+f01058c4:	55                   	push   %ebp
+f01058c5:	89 e5                	mov    %esp,%ebp
+f01058c7:	57                   	push   %edi
+f01058c8:	56                   	push   %esi
+f01058c9:	53                   	push   %ebx
+f01058ca:	83 ec 2c             	sub    $0x2c,%esp
+f01058cd:	89 c6                	mov    %eax,%esi
+f01058cf:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  n = 0;
+f01058d2:	c7 45 c8 00 00 00 00 	movl   $0x0,-0x38(%ebp)
+  for (cur = va; cur < end; cur += PGSIZE) {
+f01058d9:	eb 42                	jmp    f010591d <range_map+0x59>
+        (error = pgdir_unshare(srcenv->env_pgdir, (void *) cur)) < 0 )
+f01058db:	83 ec 08             	sub    $0x8,%esp
+f01058de:	52                   	push   %edx
+f01058df:	ff 76 60             	push   0x60(%esi)
+f01058e2:	e8 c8 bb ff ff       	call   f01014af <pgdir_unshare>
+    if ( (xform == PMR_SAME || xform == PMR_COW) &&
+f01058e7:	83 c4 10             	add    $0x10,%esp
+f01058ea:	85 c0                	test   %eax,%eax
+f01058ec:	79 3f                	jns    f010592d <range_map+0x69>
+      return error;
+f01058ee:	89 45 c8             	mov    %eax,-0x38(%ebp)
+}
+f01058f1:	8b 45 c8             	mov    -0x38(%ebp),%eax
+f01058f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f01058f7:	5b                   	pop    %ebx
+f01058f8:	5e                   	pop    %esi
+f01058f9:	5f                   	pop    %edi
+f01058fa:	5d                   	pop    %ebp
+f01058fb:	c3                   	ret
+		panic("pa2page called with invalid pa");
+f01058fc:	83 ec 04             	sub    $0x4,%esp
+f01058ff:	68 bc 8d 10 f0       	push   $0xf0108dbc
+f0105904:	6a 58                	push   $0x58
+f0105906:	68 29 96 10 f0       	push   $0xf0109629
+f010590b:	e8 30 a7 ff ff       	call   f0100040 <_panic>
+    n++;
+f0105910:	83 45 c8 01          	addl   $0x1,-0x38(%ebp)
+  for (cur = va; cur < end; cur += PGSIZE) {
+f0105914:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0105917:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+f010591d:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+f0105920:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f0105923:	39 c2                	cmp    %eax,%edx
+f0105925:	73 ca                	jae    f01058f1 <range_map+0x2d>
+    if ( (xform == PMR_SAME || xform == PMR_COW) &&
+f0105927:	83 7d 0c 01          	cmpl   $0x1,0xc(%ebp)
+f010592b:	76 ae                	jbe    f01058db <range_map+0x17>
+    if ( !(pte = range_walk(srcenv->env_pgdir, &cur)) )
+f010592d:	8b 46 60             	mov    0x60(%esi),%eax
+f0105930:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+f0105933:	e8 4f ff ff ff       	call   f0105887 <range_walk>
+f0105938:	89 c3                	mov    %eax,%ebx
+f010593a:	85 c0                	test   %eax,%eax
+f010593c:	74 d6                	je     f0105914 <range_map+0x50>
+    if ( !(perm = range_perm(*pte, xform)) )
+f010593e:	8b 38                	mov    (%eax),%edi
+f0105940:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0105943:	89 f8                	mov    %edi,%eax
+f0105945:	e8 94 fc ff ff       	call   f01055de <range_perm>
+f010594a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f010594d:	85 c0                	test   %eax,%eax
+f010594f:	74 c3                	je     f0105914 <range_map+0x50>
+    if ( (error = page_insert(dstenv->env_pgdir, pa2page(PTE_ADDR(*pte)),
+f0105951:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0105954:	89 45 cc             	mov    %eax,-0x34(%ebp)
+	if (PGNUM(pa) >= npages)
+f0105957:	c1 ef 0c             	shr    $0xc,%edi
+f010595a:	3b 3d 08 bf 79 f0    	cmp    0xf079bf08,%edi
+f0105960:	73 9a                	jae    f01058fc <range_map+0x38>
+f0105962:	ff 75 d4             	push   -0x2c(%ebp)
+f0105965:	ff 75 cc             	push   -0x34(%ebp)
+	return &pages[PGNUM(pa)];
+f0105968:	a1 10 bf 79 f0       	mov    0xf079bf10,%eax
+f010596d:	8d 04 f8             	lea    (%eax,%edi,8),%eax
+f0105970:	50                   	push   %eax
+f0105971:	8b 45 08             	mov    0x8(%ebp),%eax
+f0105974:	ff 70 60             	push   0x60(%eax)
+f0105977:	e8 99 bf ff ff       	call   f0101915 <page_insert>
+f010597c:	83 c4 10             	add    $0x10,%esp
+f010597f:	85 c0                	test   %eax,%eax
+f0105981:	78 3a                	js     f01059bd <range_map+0xf9>
+    if ( xform == PMR_COW && (*pte & PTE_SYSCALL) != perm ) {
+f0105983:	83 7d 0c 01          	cmpl   $0x1,0xc(%ebp)
+f0105987:	75 87                	jne    f0105910 <range_map+0x4c>
+f0105989:	8b 03                	mov    (%ebx),%eax
+f010598b:	89 c2                	mov    %eax,%edx
+f010598d:	81 e2 07 0e 00 00    	and    $0xe07,%edx
+f0105993:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+f0105996:	39 ca                	cmp    %ecx,%edx
+f0105998:	0f 84 72 ff ff ff    	je     f0105910 <range_map+0x4c>
+      *pte = PTE_ADDR(*pte) | perm;
+f010599e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+f01059a3:	09 c8                	or     %ecx,%eax
+f01059a5:	89 03                	mov    %eax,(%ebx)
+      tlb_invalidate(srcenv->env_pgdir, (void *) cur);
+f01059a7:	83 ec 08             	sub    $0x8,%esp
+f01059aa:	ff 75 cc             	push   -0x34(%ebp)
+f01059ad:	ff 76 60             	push   0x60(%esi)
+f01059b0:	e8 bf be ff ff       	call   f0101874 <tlb_invalidate>
+f01059b5:	83 c4 10             	add    $0x10,%esp
+f01059b8:	e9 53 ff ff ff       	jmp    f0105910 <range_map+0x4c>
+      return error;
+f01059bd:	89 45 c8             	mov    %eax,-0x38(%ebp)
+f01059c0:	e9 2c ff ff ff       	jmp    f01058f1 <range_map+0x2d>
+
+f01059c5 <syscall>:
+}
+
+// Dispatches to the correct kernel function, passing the arguments.
+int32_t
+syscall(uint32_t syscallno, uint32_t a1, uint32_t a2, uint32_t a3, uint32_t a4, uint32_t a5)
+{
+f01059c5:	55                   	push   %ebp
+f01059c6:	89 e5                	mov    %esp,%ebp
+f01059c8:	57                   	push   %edi
+f01059c9:	56                   	push   %esi
+f01059ca:	53                   	push   %ebx
+f01059cb:	83 ec 2c             	sub    $0x2c,%esp
+f01059ce:	8b 45 08             	mov    0x8(%ebp),%eax
+  // Call the function corresponding to the 'syscallno' parameter.
+  // Return any appropriate return value.
+  // LAB 3: Your code here.
+  switch (syscallno) {
+f01059d1:	83 f8 19             	cmp    $0x19,%eax
+f01059d4:	0f 87 8f 0f 00 00    	ja     f0106969 <syscall+0xfa4>
+f01059da:	ff 24 85 68 9e 10 f0 	jmp    *-0xfef6198(,%eax,4)
+  user_mem_assert(curenv, s, len, PTE_P | PTE_U);
+f01059e1:	e8 79 22 00 00       	call   f0107c5f <cpunum>
+f01059e6:	6a 05                	push   $0x5
+f01059e8:	ff 75 10             	push   0x10(%ebp)
+f01059eb:	ff 75 0c             	push   0xc(%ebp)
+f01059ee:	6b c0 74             	imul   $0x74,%eax,%eax
+f01059f1:	ff b0 28 c0 79 f0    	push   -0xf863fd8(%eax)
+f01059f7:	e8 31 df ff ff       	call   f010392d <user_mem_assert>
+  cprintf("%.*s", len, s);
+f01059fc:	83 c4 0c             	add    $0xc,%esp
+f01059ff:	ff 75 0c             	push   0xc(%ebp)
+f0105a02:	ff 75 10             	push   0x10(%ebp)
+f0105a05:	68 46 9e 10 f0       	push   $0xf0109e46
+f0105a0a:	e8 1d ea ff ff       	call   f010442c <cprintf>
+}
+f0105a0f:	83 c4 10             	add    $0x10,%esp
+      return sys_thread_create(a1, a2, a3);
+
+    default:
+      return -E_INVAL;
+  }
+  return 0;
+f0105a12:	bf 00 00 00 00       	mov    $0x0,%edi
+}
+f0105a17:	89 f8                	mov    %edi,%eax
+f0105a19:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0105a1c:	5b                   	pop    %ebx
+f0105a1d:	5e                   	pop    %esi
+f0105a1e:	5f                   	pop    %edi
+f0105a1f:	5d                   	pop    %ebp
+f0105a20:	c3                   	ret
+  return cons_getc();
+f0105a21:	e8 e4 ab ff ff       	call   f010060a <cons_getc>
+f0105a26:	89 c7                	mov    %eax,%edi
+      return sys_cgetc();
+f0105a28:	eb ed                	jmp    f0105a17 <syscall+0x52>
+  return curenv->env_id;
+f0105a2a:	e8 30 22 00 00       	call   f0107c5f <cpunum>
+f0105a2f:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105a32:	8b 80 28 c0 79 f0    	mov    -0xf863fd8(%eax),%eax
+f0105a38:	8b 78 48             	mov    0x48(%eax),%edi
+      return (int32_t) sys_getenvid();
+f0105a3b:	eb da                	jmp    f0105a17 <syscall+0x52>
+  if ((r = envid2env(envid, &e, 1)) < 0)
+f0105a3d:	83 ec 04             	sub    $0x4,%esp
+f0105a40:	6a 01                	push   $0x1
+f0105a42:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0105a45:	50                   	push   %eax
+f0105a46:	ff 75 0c             	push   0xc(%ebp)
+f0105a49:	e8 96 df ff ff       	call   f01039e4 <envid2env>
+f0105a4e:	89 c7                	mov    %eax,%edi
+f0105a50:	83 c4 10             	add    $0x10,%esp
+f0105a53:	85 c0                	test   %eax,%eax
+f0105a55:	78 c0                	js     f0105a17 <syscall+0x52>
+  env_destroy(e);
+f0105a57:	83 ec 0c             	sub    $0xc,%esp
+f0105a5a:	ff 75 e4             	push   -0x1c(%ebp)
+f0105a5d:	e8 f5 e5 ff ff       	call   f0104057 <env_destroy>
+  return 0;
+f0105a62:	83 c4 10             	add    $0x10,%esp
+f0105a65:	bf 00 00 00 00       	mov    $0x0,%edi
+      return sys_env_destroy((envid_t) a1);
+f0105a6a:	eb ab                	jmp    f0105a17 <syscall+0x52>
+      return sys_page_alloc((envid_t) a1, (void *) a2, a3);
+f0105a6c:	8b 4d 14             	mov    0x14(%ebp),%ecx
+f0105a6f:	8b 55 10             	mov    0x10(%ebp),%edx
+f0105a72:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0105a75:	e8 12 fc ff ff       	call   f010568c <sys_page_alloc>
+f0105a7a:	89 c7                	mov    %eax,%edi
+f0105a7c:	eb 99                	jmp    f0105a17 <syscall+0x52>
+      return sys_page_map((envid_t) a1, (void *) a2, (envid_t) a3, (void *) a4, a5);
+f0105a7e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  if ( ((uintptr_t) (srcva) >= UTOP) ||
+f0105a81:	81 7d 10 ff ff bf ee 	cmpl   $0xeebfffff,0x10(%ebp)
+f0105a88:	0f 87 e9 00 00 00    	ja     f0105b77 <syscall+0x1b2>
+      ( PGOFF(srcva) )  ||
+f0105a8e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+f0105a91:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+f0105a97:	81 7d 18 ff ff bf ee 	cmpl   $0xeebfffff,0x18(%ebp)
+f0105a9e:	0f 87 dd 00 00 00    	ja     f0105b81 <syscall+0x1bc>
+      ( PGOFF(dstva) )) {
+f0105aa4:	8b 5d 18             	mov    0x18(%ebp),%ebx
+f0105aa7:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  if ( !(perm & (PTE_P | PTE_U)) || (perm & ~PTE_SYSCALL)) {
+f0105aad:	f6 45 1c 05          	testb  $0x5,0x1c(%ebp)
+f0105ab1:	0f 84 d4 00 00 00    	je     f0105b8b <syscall+0x1c6>
+f0105ab7:	8b 45 1c             	mov    0x1c(%ebp),%eax
+f0105aba:	25 f8 f1 ff ff       	and    $0xfffff1f8,%eax
+f0105abf:	09 d8                	or     %ebx,%eax
+f0105ac1:	09 c8                	or     %ecx,%eax
+f0105ac3:	0f 85 cc 00 00 00    	jne    f0105b95 <syscall+0x1d0>
+  if ( ((error = envid2env(srcenvid, &srcenv, 1)) < 0) ||
+f0105ac9:	83 ec 04             	sub    $0x4,%esp
+f0105acc:	6a 01                	push   $0x1
+f0105ace:	8d 45 dc             	lea    -0x24(%ebp),%eax
+f0105ad1:	50                   	push   %eax
+f0105ad2:	52                   	push   %edx
+f0105ad3:	e8 0c df ff ff       	call   f01039e4 <envid2env>
+f0105ad8:	89 c7                	mov    %eax,%edi
+f0105ada:	83 c4 10             	add    $0x10,%esp
+f0105add:	85 c0                	test   %eax,%eax
+f0105adf:	0f 88 32 ff ff ff    	js     f0105a17 <syscall+0x52>
+      ((error = envid2env(dstenvid, &dstenv, 1)) < 0)) {
+f0105ae5:	83 ec 04             	sub    $0x4,%esp
+f0105ae8:	6a 01                	push   $0x1
+f0105aea:	8d 45 e0             	lea    -0x20(%ebp),%eax
+f0105aed:	50                   	push   %eax
+f0105aee:	ff 75 14             	push   0x14(%ebp)
+f0105af1:	e8 ee de ff ff       	call   f01039e4 <envid2env>
+f0105af6:	89 c7                	mov    %eax,%edi
+  if ( ((error = envid2env(srcenvid, &srcenv, 1)) < 0) ||
+f0105af8:	83 c4 10             	add    $0x10,%esp
+f0105afb:	85 c0                	test   %eax,%eax
+f0105afd:	0f 88 14 ff ff ff    	js     f0105a17 <syscall+0x52>
+      return sys_page_map((envid_t) a1, (void *) a2, (envid_t) a3, (void *) a4, a5);
+f0105b03:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if ( (page = page_lookup(srcenv->env_pgdir, srcva, &pagetable_entry)) ) {
+f0105b06:	83 ec 04             	sub    $0x4,%esp
+f0105b09:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0105b0c:	50                   	push   %eax
+f0105b0d:	53                   	push   %ebx
+f0105b0e:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f0105b11:	ff 70 60             	push   0x60(%eax)
+f0105b14:	e8 fd bc ff ff       	call   f0101816 <page_lookup>
+f0105b19:	89 c6                	mov    %eax,%esi
+f0105b1b:	83 c4 10             	add    $0x10,%esp
+  return 0;
+f0105b1e:	bf 00 00 00 00       	mov    $0x0,%edi
+  if ( (page = page_lookup(srcenv->env_pgdir, srcva, &pagetable_entry)) ) {
+f0105b23:	85 c0                	test   %eax,%eax
+f0105b25:	0f 84 ec fe ff ff    	je     f0105a17 <syscall+0x52>
+    if ( (perm & PTE_W) &&
+f0105b2b:	f6 45 1c 02          	testb  $0x2,0x1c(%ebp)
+f0105b2f:	74 13                	je     f0105b44 <syscall+0x17f>
+         (error = page_writable(srcenv->env_pgdir, srcva)) <= 0 ) {
+f0105b31:	8b 45 dc             	mov    -0x24(%ebp),%eax
+f0105b34:	8b 40 60             	mov    0x60(%eax),%eax
+f0105b37:	89 da                	mov    %ebx,%edx
+f0105b39:	e8 7b fc ff ff       	call   f01057b9 <page_writable>
+f0105b3e:	89 c7                	mov    %eax,%edi
+    if ( (perm & PTE_W) &&
+f0105b40:	85 c0                	test   %eax,%eax
+f0105b42:	7e 26                	jle    f0105b6a <syscall+0x1a5>
+    if ( (error = page_insert(dstenv->env_pgdir, page, dstva, perm)) < 0) {
+f0105b44:	ff 75 1c             	push   0x1c(%ebp)
+f0105b47:	ff 75 18             	push   0x18(%ebp)
+f0105b4a:	56                   	push   %esi
+f0105b4b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0105b4e:	ff 70 60             	push   0x60(%eax)
+f0105b51:	e8 bf bd ff ff       	call   f0101915 <page_insert>
+f0105b56:	85 c0                	test   %eax,%eax
+f0105b58:	ba 00 00 00 00       	mov    $0x0,%edx
+f0105b5d:	89 d7                	mov    %edx,%edi
+f0105b5f:	0f 4e f8             	cmovle %eax,%edi
+f0105b62:	83 c4 10             	add    $0x10,%esp
+f0105b65:	e9 ad fe ff ff       	jmp    f0105a17 <syscall+0x52>
+      return error ? error : -E_INVAL;
+f0105b6a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0105b6f:	0f 44 f8             	cmove  %eax,%edi
+f0105b72:	e9 a0 fe ff ff       	jmp    f0105a17 <syscall+0x52>
+    return -E_INVAL;
+f0105b77:	bf fd ff ff ff       	mov    $0xfffffffd,%edi
+f0105b7c:	e9 96 fe ff ff       	jmp    f0105a17 <syscall+0x52>
+f0105b81:	bf fd ff ff ff       	mov    $0xfffffffd,%edi
+f0105b86:	e9 8c fe ff ff       	jmp    f0105a17 <syscall+0x52>
+    return -E_INVAL;
+f0105b8b:	bf fd ff ff ff       	mov    $0xfffffffd,%edi
+f0105b90:	e9 82 fe ff ff       	jmp    f0105a17 <syscall+0x52>
+f0105b95:	bf fd ff ff ff       	mov    $0xfffffffd,%edi
+f0105b9a:	e9 78 fe ff ff       	jmp    f0105a17 <syscall+0x52>
+  if ((uintptr_t) (va) >= UTOP) {
+f0105b9f:	81 7d 10 ff ff bf ee 	cmpl   $0xeebfffff,0x10(%ebp)
+f0105ba6:	77 3c                	ja     f0105be4 <syscall+0x21f>
+  if ( (error = envid2env(envid, &env, 1)) < 0) {
+f0105ba8:	83 ec 04             	sub    $0x4,%esp
+f0105bab:	6a 01                	push   $0x1
+f0105bad:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0105bb0:	50                   	push   %eax
+f0105bb1:	ff 75 0c             	push   0xc(%ebp)
+f0105bb4:	e8 2b de ff ff       	call   f01039e4 <envid2env>
+f0105bb9:	89 c7                	mov    %eax,%edi
+f0105bbb:	83 c4 10             	add    $0x10,%esp
+f0105bbe:	85 c0                	test   %eax,%eax
+f0105bc0:	0f 88 51 fe ff ff    	js     f0105a17 <syscall+0x52>
+  page_remove(env->env_pgdir, va);
+f0105bc6:	83 ec 08             	sub    $0x8,%esp
+f0105bc9:	ff 75 10             	push   0x10(%ebp)
+f0105bcc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0105bcf:	ff 70 60             	push   0x60(%eax)
+f0105bd2:	e8 d2 bc ff ff       	call   f01018a9 <page_remove>
+  return 0;
+f0105bd7:	83 c4 10             	add    $0x10,%esp
+f0105bda:	bf 00 00 00 00       	mov    $0x0,%edi
+f0105bdf:	e9 33 fe ff ff       	jmp    f0105a17 <syscall+0x52>
+    return -E_INVAL;
+f0105be4:	bf fd ff ff ff       	mov    $0xfffffffd,%edi
+      return sys_page_unmap((envid_t) a1, (void *) a2);
+f0105be9:	e9 29 fe ff ff       	jmp    f0105a17 <syscall+0x52>
+      return sys_exofork();
+f0105bee:	e8 1b fc ff ff       	call   f010580e <sys_exofork>
+f0105bf3:	89 c7                	mov    %eax,%edi
+f0105bf5:	e9 1d fe ff ff       	jmp    f0105a17 <syscall+0x52>
+  if ((status != ENV_RUNNABLE) && (status != ENV_NOT_RUNNABLE)) {
+f0105bfa:	8b 45 10             	mov    0x10(%ebp),%eax
+f0105bfd:	83 e8 02             	sub    $0x2,%eax
+f0105c00:	a9 fd ff ff ff       	test   $0xfffffffd,%eax
+f0105c05:	75 31                	jne    f0105c38 <syscall+0x273>
+  if ( (error = envid2env(envid, &env, 1)) < 0 ) {
+f0105c07:	83 ec 04             	sub    $0x4,%esp
+f0105c0a:	6a 01                	push   $0x1
+f0105c0c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0105c0f:	50                   	push   %eax
+f0105c10:	ff 75 0c             	push   0xc(%ebp)
+f0105c13:	e8 cc dd ff ff       	call   f01039e4 <envid2env>
+f0105c18:	89 c7                	mov    %eax,%edi
+f0105c1a:	83 c4 10             	add    $0x10,%esp
+f0105c1d:	85 c0                	test   %eax,%eax
+f0105c1f:	0f 88 f2 fd ff ff    	js     f0105a17 <syscall+0x52>
+  env->env_status = status;
+f0105c25:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0105c28:	8b 75 10             	mov    0x10(%ebp),%esi
+f0105c2b:	89 70 54             	mov    %esi,0x54(%eax)
+  return 0;
+f0105c2e:	bf 00 00 00 00       	mov    $0x0,%edi
+      return sys_env_set_status((envid_t) a1, a2);      
+f0105c33:	e9 df fd ff ff       	jmp    f0105a17 <syscall+0x52>
+    cprintf("bad status\n");
+f0105c38:	83 ec 0c             	sub    $0xc,%esp
+f0105c3b:	68 4b 9e 10 f0       	push   $0xf0109e4b
+f0105c40:	e8 e7 e7 ff ff       	call   f010442c <cprintf>
+    return -E_INVAL;
+f0105c45:	83 c4 10             	add    $0x10,%esp
+f0105c48:	bf fd ff ff ff       	mov    $0xfffffffd,%edi
+f0105c4d:	e9 c5 fd ff ff       	jmp    f0105a17 <syscall+0x52>
+  if ( (error = envid2env(envid, &env, 1)) < 0) {
+f0105c52:	83 ec 04             	sub    $0x4,%esp
+f0105c55:	6a 01                	push   $0x1
+f0105c57:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0105c5a:	50                   	push   %eax
+f0105c5b:	ff 75 0c             	push   0xc(%ebp)
+f0105c5e:	e8 81 dd ff ff       	call   f01039e4 <envid2env>
+f0105c63:	89 c7                	mov    %eax,%edi
+f0105c65:	83 c4 10             	add    $0x10,%esp
+f0105c68:	85 c0                	test   %eax,%eax
+f0105c6a:	0f 88 a7 fd ff ff    	js     f0105a17 <syscall+0x52>
+  user_mem_assert(env, func, sizeof(func), (PTE_P | PTE_U));
+f0105c70:	6a 05                	push   $0x5
+f0105c72:	6a 04                	push   $0x4
+f0105c74:	ff 75 10             	push   0x10(%ebp)
+f0105c77:	ff 75 e4             	push   -0x1c(%ebp)
+f0105c7a:	e8 ae dc ff ff       	call   f010392d <user_mem_assert>
+  env->env_pgfault_upcall = func;
+f0105c7f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0105c82:	8b 75 10             	mov    0x10(%ebp),%esi
+f0105c85:	89 70 64             	mov    %esi,0x64(%eax)
+  return 0;
+f0105c88:	83 c4 10             	add    $0x10,%esp
+f0105c8b:	bf 00 00 00 00       	mov    $0x0,%edi
+      return sys_env_set_pgfault_upcall((envid_t) a1, (void *) a2);
+f0105c90:	e9 82 fd ff ff       	jmp    f0105a17 <syscall+0x52>
+  sched_yield();
+f0105c95:	e8 42 f8 ff ff       	call   f01054dc <sched_yield>
+  if ( (error = envid2env(envid, &env, 0)) < 0)
+f0105c9a:	83 ec 04             	sub    $0x4,%esp
+f0105c9d:	6a 00                	push   $0x0
+f0105c9f:	8d 45 e0             	lea    -0x20(%ebp),%eax
+f0105ca2:	50                   	push   %eax
+f0105ca3:	ff 75 0c             	push   0xc(%ebp)
+f0105ca6:	e8 39 dd ff ff       	call   f01039e4 <envid2env>
+f0105cab:	83 c4 10             	add    $0x10,%esp
+f0105cae:	85 c0                	test   %eax,%eax
+f0105cb0:	0f 88 97 01 00 00    	js     f0105e4d <syscall+0x488>
+  if ( !(env->env_ipc_recving) )
+f0105cb6:	8b 55 e0             	mov    -0x20(%ebp),%edx
+f0105cb9:	80 7a 6d 00          	cmpb   $0x0,0x6d(%edx)
+f0105cbd:	0f 84 94 01 00 00    	je     f0105e57 <syscall+0x492>
+  n = MIN(npages, env->env_ipc_npages);
+f0105cc3:	8b 42 74             	mov    0x74(%edx),%eax
+f0105cc6:	39 45 1c             	cmp    %eax,0x1c(%ebp)
+f0105cc9:	0f 46 45 1c          	cmovbe 0x1c(%ebp),%eax
+f0105ccd:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if ( n > 0 && ((uintptr_t) srcva < UTOP) ) {
+f0105cd0:	85 c0                	test   %eax,%eax
+f0105cd2:	0f 84 2d 01 00 00    	je     f0105e05 <syscall+0x440>
+f0105cd8:	81 7d 14 ff ff bf ee 	cmpl   $0xeebfffff,0x14(%ebp)
+f0105cdf:	0f 87 20 01 00 00    	ja     f0105e05 <syscall+0x440>
+    if ( PGOFF(srcva) || n > (UTOP - (uintptr_t) srcva) / PGSIZE )
+f0105ce5:	8b 4d 14             	mov    0x14(%ebp),%ecx
+f0105ce8:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+f0105cee:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+f0105cf3:	2b 55 14             	sub    0x14(%ebp),%edx
+f0105cf6:	c1 ea 0c             	shr    $0xc,%edx
+f0105cf9:	39 c2                	cmp    %eax,%edx
+f0105cfb:	0f 82 60 01 00 00    	jb     f0105e61 <syscall+0x49c>
+    if ( !(perm & (PTE_P | PTE_U)) || (perm & ~PTE_SYSCALL))
+f0105d01:	f6 45 18 05          	testb  $0x5,0x18(%ebp)
+f0105d05:	0f 84 60 01 00 00    	je     f0105e6b <syscall+0x4a6>
+f0105d0b:	8b 55 18             	mov    0x18(%ebp),%edx
+f0105d0e:	81 e2 f8 f1 ff ff    	and    $0xfffff1f8,%edx
+f0105d14:	09 ca                	or     %ecx,%edx
+f0105d16:	89 d7                	mov    %edx,%edi
+f0105d18:	89 55 cc             	mov    %edx,-0x34(%ebp)
+f0105d1b:	0f 85 54 01 00 00    	jne    f0105e75 <syscall+0x4b0>
+f0105d21:	8b 5d 14             	mov    0x14(%ebp),%ebx
+      if ( (perm & PTE_W) &&
+f0105d24:	8b 75 18             	mov    0x18(%ebp),%esi
+f0105d27:	83 e6 02             	and    $0x2,%esi
+f0105d2a:	eb 10                	jmp    f0105d3c <syscall+0x377>
+    for (i = 0; i < n; i++) {
+f0105d2c:	8d 47 01             	lea    0x1(%edi),%eax
+f0105d2f:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+f0105d35:	39 45 d0             	cmp    %eax,-0x30(%ebp)
+f0105d38:	74 60                	je     f0105d9a <syscall+0x3d5>
+f0105d3a:	89 c7                	mov    %eax,%edi
+      if ( !(page = page_lookup(curenv->env_pgdir, srcva + i * PGSIZE, &pte)) )
+f0105d3c:	89 5d d4             	mov    %ebx,-0x2c(%ebp)
+f0105d3f:	e8 1b 1f 00 00       	call   f0107c5f <cpunum>
+f0105d44:	83 ec 04             	sub    $0x4,%esp
+f0105d47:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+f0105d4a:	52                   	push   %edx
+f0105d4b:	53                   	push   %ebx
+f0105d4c:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105d4f:	8b 80 28 c0 79 f0    	mov    -0xf863fd8(%eax),%eax
+f0105d55:	ff 70 60             	push   0x60(%eax)
+f0105d58:	e8 b9 ba ff ff       	call   f0101816 <page_lookup>
+f0105d5d:	83 c4 10             	add    $0x10,%esp
+f0105d60:	85 c0                	test   %eax,%eax
+f0105d62:	0f 84 17 01 00 00    	je     f0105e7f <syscall+0x4ba>
+      if ( (perm & PTE_W) &&
+f0105d68:	85 f6                	test   %esi,%esi
+f0105d6a:	74 c0                	je     f0105d2c <syscall+0x367>
+           (error = page_writable(curenv->env_pgdir, srcva + i * PGSIZE)) <= 0 )
+f0105d6c:	e8 ee 1e 00 00       	call   f0107c5f <cpunum>
+f0105d71:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105d74:	8b 80 28 c0 79 f0    	mov    -0xf863fd8(%eax),%eax
+f0105d7a:	8b 40 60             	mov    0x60(%eax),%eax
+f0105d7d:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+f0105d80:	e8 34 fa ff ff       	call   f01057b9 <page_writable>
+      if ( (perm & PTE_W) &&
+f0105d85:	85 c0                	test   %eax,%eax
+f0105d87:	7f a3                	jg     f0105d2c <syscall+0x367>
+        return error ? error : -E_INVAL;
+f0105d89:	89 c7                	mov    %eax,%edi
+f0105d8b:	85 c0                	test   %eax,%eax
+f0105d8d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0105d92:	0f 44 f8             	cmove  %eax,%edi
+f0105d95:	e9 7d fc ff ff       	jmp    f0105a17 <syscall+0x52>
+f0105d9a:	89 c6                	mov    %eax,%esi
+f0105d9c:	8b 5d cc             	mov    -0x34(%ebp),%ebx
+f0105d9f:	eb 02                	jmp    f0105da3 <syscall+0x3de>
+    for (i = 0; i < n; i++) {
+f0105da1:	89 c3                	mov    %eax,%ebx
+      page = page_lookup(curenv->env_pgdir, srcva + i * PGSIZE, NULL);
+f0105da3:	e8 b7 1e 00 00       	call   f0107c5f <cpunum>
+f0105da8:	83 ec 04             	sub    $0x4,%esp
+f0105dab:	6a 00                	push   $0x0
+f0105dad:	ff 75 14             	push   0x14(%ebp)
+f0105db0:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105db3:	8b 80 28 c0 79 f0    	mov    -0xf863fd8(%eax),%eax
+f0105db9:	ff 70 60             	push   0x60(%eax)
+f0105dbc:	e8 55 ba ff ff       	call   f0101816 <page_lookup>
+f0105dc1:	89 c1                	mov    %eax,%ecx
+                                env->env_ipc_dstva + i * PGSIZE, perm)) < 0)
+f0105dc3:	8b 55 e0             	mov    -0x20(%ebp),%edx
+      if ( (error = page_insert(env->env_pgdir, page,
+f0105dc6:	ff 75 18             	push   0x18(%ebp)
+f0105dc9:	89 d8                	mov    %ebx,%eax
+f0105dcb:	c1 e0 0c             	shl    $0xc,%eax
+f0105dce:	03 42 70             	add    0x70(%edx),%eax
+f0105dd1:	50                   	push   %eax
+f0105dd2:	51                   	push   %ecx
+f0105dd3:	ff 72 60             	push   0x60(%edx)
+f0105dd6:	e8 3a bb ff ff       	call   f0101915 <page_insert>
+f0105ddb:	81 45 14 00 10 00 00 	addl   $0x1000,0x14(%ebp)
+f0105de2:	83 c4 20             	add    $0x20,%esp
+f0105de5:	85 c0                	test   %eax,%eax
+f0105de7:	0f 88 45 0c 00 00    	js     f0106a32 <syscall+0x106d>
+    for (i = 0; i < n; i++) {
+f0105ded:	8d 43 01             	lea    0x1(%ebx),%eax
+f0105df0:	39 df                	cmp    %ebx,%edi
+f0105df2:	75 ad                	jne    f0105da1 <syscall+0x3dc>
+    env->env_ipc_perm = perm;
+f0105df4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0105df7:	8b 7d 18             	mov    0x18(%ebp),%edi
+f0105dfa:	89 b8 80 00 00 00    	mov    %edi,0x80(%eax)
+    env->env_ipc_npages = n;
+f0105e00:	89 70 74             	mov    %esi,0x74(%eax)
+f0105e03:	eb 11                	jmp    f0105e16 <syscall+0x451>
+    env->env_ipc_perm = 0;
+f0105e05:	c7 82 80 00 00 00 00 	movl   $0x0,0x80(%edx)
+f0105e0c:	00 00 00 
+    env->env_ipc_npages = 0;
+f0105e0f:	c7 42 74 00 00 00 00 	movl   $0x0,0x74(%edx)
+    env->env_ipc_recving = 0;
+f0105e16:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0105e19:	c6 40 6d 00          	movb   $0x0,0x6d(%eax)
+    env->env_ipc_from = curenv->env_id;
+f0105e1d:	e8 3d 1e 00 00       	call   f0107c5f <cpunum>
+f0105e22:	89 c2                	mov    %eax,%edx
+f0105e24:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0105e27:	6b d2 74             	imul   $0x74,%edx,%edx
+f0105e2a:	8b 92 28 c0 79 f0    	mov    -0xf863fd8(%edx),%edx
+f0105e30:	8b 52 48             	mov    0x48(%edx),%edx
+f0105e33:	89 50 7c             	mov    %edx,0x7c(%eax)
+    env->env_ipc_value = value;
+f0105e36:	8b 75 10             	mov    0x10(%ebp),%esi
+f0105e39:	89 70 78             	mov    %esi,0x78(%eax)
+    env->env_status = ENV_RUNNABLE;
+f0105e3c:	c7 40 54 02 00 00 00 	movl   $0x2,0x54(%eax)
+  return 0;
+f0105e43:	bf 00 00 00 00       	mov    $0x0,%edi
+f0105e48:	e9 ca fb ff ff       	jmp    f0105a17 <syscall+0x52>
+    return -E_BAD_ENV;
+f0105e4d:	bf fe ff ff ff       	mov    $0xfffffffe,%edi
+f0105e52:	e9 c0 fb ff ff       	jmp    f0105a17 <syscall+0x52>
+    return -E_IPC_NOT_RECV;
+f0105e57:	bf f9 ff ff ff       	mov    $0xfffffff9,%edi
+f0105e5c:	e9 b6 fb ff ff       	jmp    f0105a17 <syscall+0x52>
+      return -E_INVAL;
+f0105e61:	bf fd ff ff ff       	mov    $0xfffffffd,%edi
+f0105e66:	e9 ac fb ff ff       	jmp    f0105a17 <syscall+0x52>
+      return -E_INVAL;
+f0105e6b:	bf fd ff ff ff       	mov    $0xfffffffd,%edi
+f0105e70:	e9 a2 fb ff ff       	jmp    f0105a17 <syscall+0x52>
+f0105e75:	bf fd ff ff ff       	mov    $0xfffffffd,%edi
+f0105e7a:	e9 98 fb ff ff       	jmp    f0105a17 <syscall+0x52>
+        return -E_INVAL;
+f0105e7f:	bf fd ff ff ff       	mov    $0xfffffffd,%edi
+f0105e84:	e9 8e fb ff ff       	jmp    f0105a17 <syscall+0x52>
+  if ((uint32_t) dstva < UTOP &&
+f0105e89:	81 7d 0c ff ff bf ee 	cmpl   $0xeebfffff,0xc(%ebp)
+f0105e90:	0f 87 55 0b 00 00    	ja     f01069eb <syscall+0x1026>
+f0105e96:	f7 45 0c ff 0f 00 00 	testl  $0xfff,0xc(%ebp)
+f0105e9d:	0f 85 d0 0a 00 00    	jne    f0106973 <syscall+0xfae>
+      (PGOFF(dstva) || npages > (UTOP - (uint32_t) dstva) / PGSIZE))
+f0105ea3:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+f0105ea8:	2b 45 0c             	sub    0xc(%ebp),%eax
+f0105eab:	c1 e8 0c             	shr    $0xc,%eax
+f0105eae:	3b 45 10             	cmp    0x10(%ebp),%eax
+f0105eb1:	0f 82 c6 0a 00 00    	jb     f010697d <syscall+0xfb8>
+  curenv->env_ipc_recving = 1;
+f0105eb7:	e8 a3 1d 00 00       	call   f0107c5f <cpunum>
+f0105ebc:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105ebf:	8b 80 28 c0 79 f0    	mov    -0xf863fd8(%eax),%eax
+f0105ec5:	c6 40 6d 01          	movb   $0x1,0x6d(%eax)
+  curenv->env_status = ENV_NOT_RUNNABLE;
+f0105ec9:	e8 91 1d 00 00       	call   f0107c5f <cpunum>
+f0105ece:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105ed1:	8b 80 28 c0 79 f0    	mov    -0xf863fd8(%eax),%eax
+f0105ed7:	c7 40 54 04 00 00 00 	movl   $0x4,0x54(%eax)
+    curenv->env_ipc_dstva = dstva;
+f0105ede:	e8 7c 1d 00 00       	call   f0107c5f <cpunum>
+f0105ee3:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105ee6:	8b 80 28 c0 79 f0    	mov    -0xf863fd8(%eax),%eax
+f0105eec:	8b 75 0c             	mov    0xc(%ebp),%esi
+f0105eef:	89 70 70             	mov    %esi,0x70(%eax)
+  curenv->env_ipc_npages = (uint32_t) dstva < UTOP ? MAX(npages, 1) : 0;
+f0105ef2:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+f0105ef6:	bb 01 00 00 00       	mov    $0x1,%ebx
+f0105efb:	0f 45 5d 10          	cmovne 0x10(%ebp),%ebx
+f0105eff:	e9 13 0b 00 00       	jmp    f0106a17 <syscall+0x1052>
+  if ( (error = envid2env(envid, &env, 1)) < 0)
+f0105f04:	83 ec 04             	sub    $0x4,%esp
+f0105f07:	6a 01                	push   $0x1
+f0105f09:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0105f0c:	50                   	push   %eax
+f0105f0d:	ff 75 0c             	push   0xc(%ebp)
+f0105f10:	e8 cf da ff ff       	call   f01039e4 <envid2env>
+f0105f15:	89 c7                	mov    %eax,%edi
+f0105f17:	83 c4 10             	add    $0x10,%esp
+f0105f1a:	85 c0                	test   %eax,%eax
+f0105f1c:	0f 88 f5 fa ff ff    	js     f0105a17 <syscall+0x52>
+  tf->tf_eflags |= FL_IF;
+f0105f22:	8b 45 10             	mov    0x10(%ebp),%eax
+f0105f25:	81 48 38 00 02 00 00 	orl    $0x200,0x38(%eax)
+  tf->tf_ds = GD_UD | 3;
+f0105f2c:	66 c7 40 24 23 00    	movw   $0x23,0x24(%eax)
+  tf->tf_es = GD_UD | 3;
+f0105f32:	66 c7 40 20 23 00    	movw   $0x23,0x20(%eax)
+  tf->tf_ss = GD_UD | 3;
+f0105f38:	66 c7 40 40 23 00    	movw   $0x23,0x40(%eax)
+  tf->tf_esp = USTACKTOP;
+f0105f3e:	c7 40 3c 00 e0 bf ee 	movl   $0xeebfe000,0x3c(%eax)
+  tf->tf_cs = GD_UT | 3;
+f0105f45:	66 c7 40 34 1b 00    	movw   $0x1b,0x34(%eax)
+  env->env_tf = *tf;
+f0105f4b:	b9 11 00 00 00       	mov    $0x11,%ecx
+f0105f50:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f0105f53:	89 c6                	mov    %eax,%esi
+f0105f55:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+f0105f57:	bf 00 00 00 00       	mov    $0x0,%edi
+      return sys_env_set_trapframe((envid_t) a1, (struct Trapframe *) a2);
+f0105f5c:	e9 b6 fa ff ff       	jmp    f0105a17 <syscall+0x52>
+  return time_msec();
+f0105f61:	e8 f2 0e 00 00       	call   f0106e58 <time_msec>
+f0105f66:	89 c7                	mov    %eax,%edi
+      return sys_time_msec();
+f0105f68:	e9 aa fa ff ff       	jmp    f0105a17 <syscall+0x52>
+      return sys_chan_sleep((void *) a1, a2, (void *) a3, a4);
+f0105f6d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  if ((uintptr_t) dstva < UTOP && PGOFF(dstva))
+f0105f70:	81 7d 14 ff ff bf ee 	cmpl   $0xeebfffff,0x14(%ebp)
+f0105f77:	77 0d                	ja     f0105f86 <syscall+0x5c1>
+f0105f79:	f7 45 14 ff 0f 00 00 	testl  $0xfff,0x14(%ebp)
+f0105f80:	0f 85 c9 00 00 00    	jne    f010604f <syscall+0x68a>
+  if ( (error = chan_lookup(chan, &pa)) < 0)
+f0105f86:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+f0105f89:	e8 aa f7 ff ff       	call   f0105738 <chan_lookup>
+f0105f8e:	89 c7                	mov    %eax,%edi
+f0105f90:	85 c0                	test   %eax,%eax
+f0105f92:	0f 88 7f fa ff ff    	js     f0105a17 <syscall+0x52>
+  if (*(volatile uint32_t *) KADDR(pa) != val)
+f0105f98:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+	if (PGNUM(pa) >= npages)
+f0105f9b:	89 d8                	mov    %ebx,%eax
+f0105f9d:	c1 e8 0c             	shr    $0xc,%eax
+f0105fa0:	3b 05 08 bf 79 f0    	cmp    0xf079bf08,%eax
+f0105fa6:	0f 83 84 00 00 00    	jae    f0106030 <syscall+0x66b>
+f0105fac:	8b 83 00 00 00 f0    	mov    -0x10000000(%ebx),%eax
+    return 0;
+f0105fb2:	bf 00 00 00 00       	mov    $0x0,%edi
+  if (*(volatile uint32_t *) KADDR(pa) != val)
+f0105fb7:	39 45 10             	cmp    %eax,0x10(%ebp)
+f0105fba:	0f 85 57 fa ff ff    	jne    f0105a17 <syscall+0x52>
+  curenv->env_sleep_chan = pa;
+f0105fc0:	e8 9a 1c 00 00       	call   f0107c5f <cpunum>
+f0105fc5:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105fc8:	8b 80 28 c0 79 f0    	mov    -0xf863fd8(%eax),%eax
+f0105fce:	89 98 84 00 00 00    	mov    %ebx,0x84(%eax)
+  curenv->env_sleep_dstva = ((uintptr_t) dstva < UTOP) ? dstva : (void *) UTOP;
+f0105fd4:	e8 86 1c 00 00       	call   f0107c5f <cpunum>
+f0105fd9:	6b c0 74             	imul   $0x74,%eax,%eax
+f0105fdc:	8b 90 28 c0 79 f0    	mov    -0xf863fd8(%eax),%edx
+f0105fe2:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+f0105fe7:	39 45 14             	cmp    %eax,0x14(%ebp)
+f0105fea:	0f 46 45 14          	cmovbe 0x14(%ebp),%eax
+f0105fee:	89 82 88 00 00 00    	mov    %eax,0x88(%edx)
+  curenv->env_sleep_deadline = timeout ? time_msec() + timeout : 0;
+f0105ff4:	83 7d 18 00          	cmpl   $0x0,0x18(%ebp)
+f0105ff8:	75 4b                	jne    f0106045 <syscall+0x680>
+f0105ffa:	e8 60 1c 00 00       	call   f0107c5f <cpunum>
+f0105fff:	6b c0 74             	imul   $0x74,%eax,%eax
+f0106002:	8b 80 28 c0 79 f0    	mov    -0xf863fd8(%eax),%eax
+f0106008:	8b 75 18             	mov    0x18(%ebp),%esi
+f010600b:	89 b0 8c 00 00 00    	mov    %esi,0x8c(%eax)
+  curenv->env_status = ENV_NOT_RUNNABLE;
+f0106011:	e8 49 1c 00 00       	call   f0107c5f <cpunum>
+f0106016:	6b c0 74             	imul   $0x74,%eax,%eax
+f0106019:	8b 80 28 c0 79 f0    	mov    -0xf863fd8(%eax),%eax
+f010601f:	c7 40 54 04 00 00 00 	movl   $0x4,0x54(%eax)
+  return 0;
+f0106026:	bf 00 00 00 00       	mov    $0x0,%edi
+f010602b:	e9 e7 f9 ff ff       	jmp    f0105a17 <syscall+0x52>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0106030:	53                   	push   %ebx
+f0106031:	68 c4 82 10 f0       	push   $0xf01082c4
+f0106036:	68 74 03 00 00       	push   $0x374
+f010603b:	68 57 9e 10 f0       	push   $0xf0109e57
+f0106040:	e8 fb 9f ff ff       	call   f0100040 <_panic>
+  curenv->env_sleep_deadline = timeout ? time_msec() + timeout : 0;
+f0106045:	e8 0e 0e 00 00       	call   f0106e58 <time_msec>
+f010604a:	01 45 18             	add    %eax,0x18(%ebp)
+f010604d:	eb ab                	jmp    f0105ffa <syscall+0x635>
+    return -E_INVAL;
+f010604f:	bf fd ff ff ff       	mov    $0xfffffffd,%edi
+f0106054:	e9 be f9 ff ff       	jmp    f0105a17 <syscall+0x52>
+  if ( (error = chan_lookup(chan, &pa)) < 0)
+f0106059:	8d 55 e0             	lea    -0x20(%ebp),%edx
+f010605c:	8b 45 0c             	mov    0xc(%ebp),%eax
+f010605f:	e8 d4 f6 ff ff       	call   f0105738 <chan_lookup>
+f0106064:	89 c7                	mov    %eax,%edi
+f0106066:	85 c0                	test   %eax,%eax
+f0106068:	0f 88 a9 f9 ff ff    	js     f0105a17 <syscall+0x52>
+  if ((uintptr_t) srcva < UTOP) {
+f010606e:	81 7d 10 ff ff bf ee 	cmpl   $0xeebfffff,0x10(%ebp)
+f0106075:	0f 87 a0 00 00 00    	ja     f010611b <syscall+0x756>
+    if ( PGOFF(srcva) )
+f010607b:	8b 55 10             	mov    0x10(%ebp),%edx
+f010607e:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+    if ( !(perm & (PTE_P | PTE_U)) || (perm & ~PTE_SYSCALL))
+f0106084:	f6 45 14 05          	testb  $0x5,0x14(%ebp)
+f0106088:	0f 84 06 01 00 00    	je     f0106194 <syscall+0x7cf>
+f010608e:	8b 45 14             	mov    0x14(%ebp),%eax
+f0106091:	25 f8 f1 ff ff       	and    $0xfffff1f8,%eax
+f0106096:	09 d0                	or     %edx,%eax
+f0106098:	0f 85 00 01 00 00    	jne    f010619e <syscall+0x7d9>
+      return sys_chan_wakeup((void *) a1, (void *) a2, a3);
+f010609e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+    if ( !(page = page_lookup(curenv->env_pgdir, srcva, &pte)) || !(*pte & PTE_P) )
+f01060a1:	e8 b9 1b 00 00       	call   f0107c5f <cpunum>
+f01060a6:	83 ec 04             	sub    $0x4,%esp
+f01060a9:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+f01060ac:	52                   	push   %edx
+f01060ad:	ff 75 10             	push   0x10(%ebp)
+f01060b0:	6b c0 74             	imul   $0x74,%eax,%eax
+f01060b3:	8b 80 28 c0 79 f0    	mov    -0xf863fd8(%eax),%eax
+f01060b9:	ff 70 60             	push   0x60(%eax)
+f01060bc:	e8 55 b7 ff ff       	call   f0101816 <page_lookup>
+f01060c1:	89 c6                	mov    %eax,%esi
+f01060c3:	83 c4 10             	add    $0x10,%esp
+f01060c6:	85 c0                	test   %eax,%eax
+f01060c8:	0f 84 da 00 00 00    	je     f01061a8 <syscall+0x7e3>
+f01060ce:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01060d1:	f6 00 01             	testb  $0x1,(%eax)
+f01060d4:	0f 84 d8 00 00 00    	je     f01061b2 <syscall+0x7ed>
+    if ( (perm & PTE_W) &&
+f01060da:	f6 45 14 02          	testb  $0x2,0x14(%ebp)
+f01060de:	75 10                	jne    f01060f0 <syscall+0x72b>
+    if (env->env_status != ENV_NOT_RUNNABLE || env->env_sleep_chan != pa ||
+f01060e0:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+f01060e3:	a1 48 b2 79 f0       	mov    0xf079b248,%eax
+f01060e8:	8d 90 00 40 02 00    	lea    0x24000(%eax),%edx
+f01060ee:	eb 45                	jmp    f0106135 <syscall+0x770>
+         (error = page_writable(curenv->env_pgdir, srcva)) <= 0 )
+f01060f0:	e8 6a 1b 00 00       	call   f0107c5f <cpunum>
+f01060f5:	6b c0 74             	imul   $0x74,%eax,%eax
+f01060f8:	8b 80 28 c0 79 f0    	mov    -0xf863fd8(%eax),%eax
+f01060fe:	8b 40 60             	mov    0x60(%eax),%eax
+f0106101:	89 da                	mov    %ebx,%edx
+f0106103:	e8 b1 f6 ff ff       	call   f01057b9 <page_writable>
+f0106108:	89 c7                	mov    %eax,%edi
+    if ( (perm & PTE_W) &&
+f010610a:	85 c0                	test   %eax,%eax
+f010610c:	7f d2                	jg     f01060e0 <syscall+0x71b>
+      return error ? error : -E_INVAL;
+f010610e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f0106113:	0f 44 f8             	cmove  %eax,%edi
+f0106116:	e9 fc f8 ff ff       	jmp    f0105a17 <syscall+0x52>
+    return env_wakeup_chan(pa);
+f010611b:	83 ec 0c             	sub    $0xc,%esp
+f010611e:	ff 75 e0             	push   -0x20(%ebp)
+f0106121:	e8 b1 df ff ff       	call   f01040d7 <env_wakeup_chan>
+f0106126:	89 c7                	mov    %eax,%edi
+f0106128:	83 c4 10             	add    $0x10,%esp
+f010612b:	e9 e7 f8 ff ff       	jmp    f0105a17 <syscall+0x52>
+  for (i = 0; i < NENV; i++) {
+f0106130:	05 90 00 00 00       	add    $0x90,%eax
+f0106135:	39 c2                	cmp    %eax,%edx
+f0106137:	74 51                	je     f010618a <syscall+0x7c5>
+    env = &envs[i];
+f0106139:	89 c3                	mov    %eax,%ebx
+    if (env->env_status != ENV_NOT_RUNNABLE || env->env_sleep_chan != pa ||
+f010613b:	83 78 54 04          	cmpl   $0x4,0x54(%eax)
+f010613f:	75 ef                	jne    f0106130 <syscall+0x76b>
+f0106141:	39 88 84 00 00 00    	cmp    %ecx,0x84(%eax)
+f0106147:	75 e7                	jne    f0106130 <syscall+0x76b>
+        (uintptr_t) env->env_sleep_dstva >= UTOP)
+f0106149:	8b b8 88 00 00 00    	mov    0x88(%eax),%edi
+    if (env->env_status != ENV_NOT_RUNNABLE || env->env_sleep_chan != pa ||
+f010614f:	81 ff ff ff bf ee    	cmp    $0xeebfffff,%edi
+f0106155:	77 d9                	ja     f0106130 <syscall+0x76b>
+    if ( (error = page_insert(env->env_pgdir, page, env->env_sleep_dstva, perm)) < 0)
+f0106157:	ff 75 14             	push   0x14(%ebp)
+f010615a:	57                   	push   %edi
+f010615b:	56                   	push   %esi
+f010615c:	ff 70 60             	push   0x60(%eax)
+f010615f:	e8 b1 b7 ff ff       	call   f0101915 <page_insert>
+f0106164:	89 c7                	mov    %eax,%edi
+f0106166:	83 c4 10             	add    $0x10,%esp
+f0106169:	85 c0                	test   %eax,%eax
+f010616b:	0f 88 a6 f8 ff ff    	js     f0105a17 <syscall+0x52>
+    env_wakeup(env, perm);
+f0106171:	83 ec 08             	sub    $0x8,%esp
+f0106174:	ff 75 14             	push   0x14(%ebp)
+f0106177:	53                   	push   %ebx
+f0106178:	e8 3b df ff ff       	call   f01040b8 <env_wakeup>
+    return 1;
+f010617d:	83 c4 10             	add    $0x10,%esp
+f0106180:	bf 01 00 00 00       	mov    $0x1,%edi
+f0106185:	e9 8d f8 ff ff       	jmp    f0105a17 <syscall+0x52>
+  return -E_IPC_NOT_RECV;
+f010618a:	bf f9 ff ff ff       	mov    $0xfffffff9,%edi
+f010618f:	e9 83 f8 ff ff       	jmp    f0105a17 <syscall+0x52>
+      return -E_INVAL;
+f0106194:	bf fd ff ff ff       	mov    $0xfffffffd,%edi
+f0106199:	e9 79 f8 ff ff       	jmp    f0105a17 <syscall+0x52>
+f010619e:	bf fd ff ff ff       	mov    $0xfffffffd,%edi
+f01061a3:	e9 6f f8 ff ff       	jmp    f0105a17 <syscall+0x52>
+      return -E_INVAL;
+f01061a8:	bf fd ff ff ff       	mov    $0xfffffffd,%edi
+f01061ad:	e9 65 f8 ff ff       	jmp    f0105a17 <syscall+0x52>
+f01061b2:	bf fd ff ff ff       	mov    $0xfffffffd,%edi
+f01061b7:	e9 5b f8 ff ff       	jmp    f0105a17 <syscall+0x52>
+  if ( (error = range_check(va, len, xform)) < 0 )
+f01061bc:	8b 4d 1c             	mov    0x1c(%ebp),%ecx
+f01061bf:	8b 55 14             	mov    0x14(%ebp),%edx
+f01061c2:	8b 45 10             	mov    0x10(%ebp),%eax
+f01061c5:	e8 88 f4 ff ff       	call   f0105652 <range_check>
+f01061ca:	89 c7                	mov    %eax,%edi
+f01061cc:	85 c0                	test   %eax,%eax
+f01061ce:	0f 88 43 f8 ff ff    	js     f0105a17 <syscall+0x52>
+  if ( ((error = envid2env(srcenvid, &srcenv, 1)) < 0) ||
+f01061d4:	83 ec 04             	sub    $0x4,%esp
+f01061d7:	6a 01                	push   $0x1
+f01061d9:	8d 45 e0             	lea    -0x20(%ebp),%eax
+f01061dc:	50                   	push   %eax
+f01061dd:	ff 75 0c             	push   0xc(%ebp)
+f01061e0:	e8 ff d7 ff ff       	call   f01039e4 <envid2env>
+f01061e5:	89 c7                	mov    %eax,%edi
+f01061e7:	83 c4 10             	add    $0x10,%esp
+f01061ea:	85 c0                	test   %eax,%eax
+f01061ec:	0f 88 25 f8 ff ff    	js     f0105a17 <syscall+0x52>
+      ((error = envid2env(dstenvid, &dstenv, 1)) < 0)) {
+f01061f2:	83 ec 04             	sub    $0x4,%esp
+f01061f5:	6a 01                	push   $0x1
+f01061f7:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f01061fa:	50                   	push   %eax
+f01061fb:	ff 75 18             	push   0x18(%ebp)
+f01061fe:	e8 e1 d7 ff ff       	call   f01039e4 <envid2env>
+f0106203:	89 c7                	mov    %eax,%edi
+  if ( ((error = envid2env(srcenvid, &srcenv, 1)) < 0) ||
+f0106205:	83 c4 10             	add    $0x10,%esp
+f0106208:	85 c0                	test   %eax,%eax
+f010620a:	0f 88 07 f8 ff ff    	js     f0105a17 <syscall+0x52>
+  return range_map(srcenv, (uintptr_t) va, (uintptr_t) va + len,
+f0106210:	8b 4d 10             	mov    0x10(%ebp),%ecx
+f0106213:	03 4d 14             	add    0x14(%ebp),%ecx
+f0106216:	83 ec 08             	sub    $0x8,%esp
+f0106219:	ff 75 1c             	push   0x1c(%ebp)
+f010621c:	ff 75 e4             	push   -0x1c(%ebp)
+f010621f:	8b 55 10             	mov    0x10(%ebp),%edx
+f0106222:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0106225:	e8 9a f6 ff ff       	call   f01058c4 <range_map>
+f010622a:	89 c7                	mov    %eax,%edi
+f010622c:	83 c4 10             	add    $0x10,%esp
+      return sys_page_map_range((envid_t) a1, (void *) a2, a3, (envid_t) a4, a5);
+f010622f:	e9 e3 f7 ff ff       	jmp    f0105a17 <syscall+0x52>
+      return sys_page_protect_range((envid_t) a1, (void *) a2, a3, a4);
+f0106234:	8b 45 18             	mov    0x18(%ebp),%eax
+f0106237:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  if ( (error = range_check(va, len, xform)) < 0 )
+f010623a:	89 c1                	mov    %eax,%ecx
+f010623c:	8b 55 14             	mov    0x14(%ebp),%edx
+f010623f:	8b 45 10             	mov    0x10(%ebp),%eax
+f0106242:	e8 0b f4 ff ff       	call   f0105652 <range_check>
+f0106247:	89 c7                	mov    %eax,%edi
+f0106249:	85 c0                	test   %eax,%eax
+f010624b:	0f 88 c6 f7 ff ff    	js     f0105a17 <syscall+0x52>
+  if ( (error = envid2env(envid, &env, 1)) < 0 )
+f0106251:	83 ec 04             	sub    $0x4,%esp
+f0106254:	6a 01                	push   $0x1
+f0106256:	8d 45 e0             	lea    -0x20(%ebp),%eax
+f0106259:	50                   	push   %eax
+f010625a:	ff 75 0c             	push   0xc(%ebp)
+f010625d:	e8 82 d7 ff ff       	call   f01039e4 <envid2env>
+f0106262:	89 c7                	mov    %eax,%edi
+f0106264:	83 c4 10             	add    $0x10,%esp
+f0106267:	85 c0                	test   %eax,%eax
+f0106269:	0f 88 a8 f7 ff ff    	js     f0105a17 <syscall+0x52>
+  end = (uintptr_t) va + len;
+f010626f:	8b 45 10             	mov    0x10(%ebp),%eax
+f0106272:	03 45 14             	add    0x14(%ebp),%eax
+  n = 0;
+f0106275:	bf 00 00 00 00       	mov    $0x0,%edi
+f010627a:	89 7d d0             	mov    %edi,-0x30(%ebp)
+f010627d:	89 c7                	mov    %eax,%edi
+f010627f:	8b 45 10             	mov    0x10(%ebp),%eax
+  for (cur = (uintptr_t) va; cur < end; cur += PGSIZE) {
+f0106282:	eb 08                	jmp    f010628c <syscall+0x8c7>
+f0106284:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0106287:	05 00 10 00 00       	add    $0x1000,%eax
+f010628c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f010628f:	39 f8                	cmp    %edi,%eax
+f0106291:	73 6a                	jae    f01062fd <syscall+0x938>
+    if ( (error = pgdir_unshare(env->env_pgdir, (void *) cur)) < 0 )
+f0106293:	83 ec 08             	sub    $0x8,%esp
+f0106296:	50                   	push   %eax
+f0106297:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f010629a:	ff 70 60             	push   0x60(%eax)
+f010629d:	e8 0d b2 ff ff       	call   f01014af <pgdir_unshare>
+f01062a2:	83 c4 10             	add    $0x10,%esp
+f01062a5:	85 c0                	test   %eax,%eax
+f01062a7:	78 5c                	js     f0106305 <syscall+0x940>
+    if ( !(pte = range_walk(env->env_pgdir, &cur)) )
+f01062a9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f01062ac:	8b 40 60             	mov    0x60(%eax),%eax
+f01062af:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+f01062b2:	e8 d0 f5 ff ff       	call   f0105887 <range_walk>
+f01062b7:	89 c3                	mov    %eax,%ebx
+f01062b9:	85 c0                	test   %eax,%eax
+f01062bb:	74 c7                	je     f0106284 <syscall+0x8bf>
+    if ( !(perm = range_perm(*pte, xform)) || (*pte & PTE_SYSCALL) == perm )
+f01062bd:	8b 30                	mov    (%eax),%esi
+f01062bf:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+f01062c2:	89 f0                	mov    %esi,%eax
+f01062c4:	e8 15 f3 ff ff       	call   f01055de <range_perm>
+f01062c9:	85 c0                	test   %eax,%eax
+f01062cb:	74 b7                	je     f0106284 <syscall+0x8bf>
+f01062cd:	89 f2                	mov    %esi,%edx
+f01062cf:	81 e2 07 0e 00 00    	and    $0xe07,%edx
+f01062d5:	39 c2                	cmp    %eax,%edx
+f01062d7:	74 ab                	je     f0106284 <syscall+0x8bf>
+    *pte = PTE_ADDR(*pte) | perm;
+f01062d9:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+f01062df:	09 c6                	or     %eax,%esi
+f01062e1:	89 33                	mov    %esi,(%ebx)
+    tlb_invalidate(env->env_pgdir, (void *) cur);
+f01062e3:	83 ec 08             	sub    $0x8,%esp
+f01062e6:	ff 75 e4             	push   -0x1c(%ebp)
+f01062e9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f01062ec:	ff 70 60             	push   0x60(%eax)
+f01062ef:	e8 80 b5 ff ff       	call   f0101874 <tlb_invalidate>
+    n++;
+f01062f4:	83 45 d0 01          	addl   $0x1,-0x30(%ebp)
+f01062f8:	83 c4 10             	add    $0x10,%esp
+f01062fb:	eb 87                	jmp    f0106284 <syscall+0x8bf>
+f01062fd:	8b 7d d0             	mov    -0x30(%ebp),%edi
+f0106300:	e9 12 f7 ff ff       	jmp    f0105a17 <syscall+0x52>
+      return error;
+f0106305:	89 c7                	mov    %eax,%edi
+      return sys_page_protect_range((envid_t) a1, (void *) a2, a3, a4);
+f0106307:	e9 0b f7 ff ff       	jmp    f0105a17 <syscall+0x52>
+      return sys_batch((struct Syscall *) a1, a2);
+f010630c:	8b 45 10             	mov    0x10(%ebp),%eax
+f010630f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  if (n < 0 || n > SYSBATCH_MAX)
+f0106312:	83 f8 40             	cmp    $0x40,%eax
+f0106315:	0f 87 6c 06 00 00    	ja     f0106987 <syscall+0xfc2>
+  user_mem_assert(curenv, calls, n * sizeof(*calls), PTE_U | PTE_W);
+f010631b:	e8 3f 19 00 00       	call   f0107c5f <cpunum>
+f0106320:	6a 06                	push   $0x6
+f0106322:	6b 55 10 1c          	imul   $0x1c,0x10(%ebp),%edx
+f0106326:	52                   	push   %edx
+f0106327:	ff 75 0c             	push   0xc(%ebp)
+f010632a:	6b c0 74             	imul   $0x74,%eax,%eax
+f010632d:	ff b0 28 c0 79 f0    	push   -0xf863fd8(%eax)
+f0106333:	e8 f5 d5 ff ff       	call   f010392d <user_mem_assert>
+  for (i = 0; i < n; i++) {
+f0106338:	83 c4 10             	add    $0x10,%esp
+f010633b:	bf 00 00 00 00       	mov    $0x0,%edi
+f0106340:	89 fe                	mov    %edi,%esi
+f0106342:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f0106345:	eb 33                	jmp    f010637a <syscall+0x9b5>
+    if (user_mem_check(curenv, sc, sizeof(*sc), PTE_U | PTE_W) < 0)
+f0106347:	e8 13 19 00 00       	call   f0107c5f <cpunum>
+f010634c:	6a 06                	push   $0x6
+f010634e:	6a 1c                	push   $0x1c
+f0106350:	57                   	push   %edi
+f0106351:	6b c0 74             	imul   $0x74,%eax,%eax
+f0106354:	ff b0 28 c0 79 f0    	push   -0xf863fd8(%eax)
+f010635a:	e8 17 d5 ff ff       	call   f0103876 <user_mem_check>
+f010635f:	83 c4 10             	add    $0x10,%esp
+f0106362:	85 c0                	test   %eax,%eax
+f0106364:	78 79                	js     f01063df <syscall+0xa1a>
+    sc->sc_ret = ret;
+f0106366:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0106369:	89 47 18             	mov    %eax,0x18(%edi)
+    if (ret < 0)
+f010636c:	83 c3 1c             	add    $0x1c,%ebx
+f010636f:	85 c0                	test   %eax,%eax
+f0106371:	0f 88 c9 06 00 00    	js     f0106a40 <syscall+0x107b>
+  for (i = 0; i < n; i++) {
+f0106377:	83 c6 01             	add    $0x1,%esi
+f010637a:	39 75 d0             	cmp    %esi,-0x30(%ebp)
+f010637d:	74 73                	je     f01063f2 <syscall+0xa2d>
+    sc = &calls[i];
+f010637f:	89 df                	mov    %ebx,%edi
+    if (user_mem_check(curenv, sc, sizeof(*sc), PTE_U | PTE_W) < 0)
+f0106381:	e8 d9 18 00 00       	call   f0107c5f <cpunum>
+f0106386:	6a 06                	push   $0x6
+f0106388:	6a 1c                	push   $0x1c
+f010638a:	53                   	push   %ebx
+f010638b:	6b c0 74             	imul   $0x74,%eax,%eax
+f010638e:	ff b0 28 c0 79 f0    	push   -0xf863fd8(%eax)
+f0106394:	e8 dd d4 ff ff       	call   f0103876 <user_mem_check>
+f0106399:	83 c4 10             	add    $0x10,%esp
+f010639c:	85 c0                	test   %eax,%eax
+f010639e:	0f 88 95 06 00 00    	js     f0106a39 <syscall+0x1074>
+    switch (sc->sc_num) {
+f01063a4:	8b 03                	mov    (%ebx),%eax
+f01063a6:	83 f8 15             	cmp    $0x15,%eax
+f01063a9:	77 11                	ja     f01063bc <syscall+0x9f7>
+f01063ab:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+f01063b2:	ba 80 a8 28 00       	mov    $0x28a880,%edx
+f01063b7:	0f a3 c2             	bt     %eax,%edx
+f01063ba:	72 8b                	jb     f0106347 <syscall+0x982>
+        ret = syscall(sc->sc_num, sc->sc_args[0], sc->sc_args[1],
+f01063bc:	83 ec 08             	sub    $0x8,%esp
+f01063bf:	ff 77 14             	push   0x14(%edi)
+f01063c2:	ff 77 10             	push   0x10(%edi)
+f01063c5:	ff 77 0c             	push   0xc(%edi)
+f01063c8:	ff 77 08             	push   0x8(%edi)
+f01063cb:	ff 77 04             	push   0x4(%edi)
+f01063ce:	50                   	push   %eax
+f01063cf:	e8 f1 f5 ff ff       	call   f01059c5 <syscall>
+f01063d4:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+f01063d7:	83 c4 20             	add    $0x20,%esp
+f01063da:	e9 68 ff ff ff       	jmp    f0106347 <syscall+0x982>
+      return ret < 0 ? i : i + 1;
+f01063df:	89 f7                	mov    %esi,%edi
+f01063e1:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+f01063e4:	81 fe 00 00 00 80    	cmp    $0x80000000,%esi
+f01063ea:	83 d7 00             	adc    $0x0,%edi
+f01063ed:	e9 25 f6 ff ff       	jmp    f0105a17 <syscall+0x52>
+f01063f2:	89 f7                	mov    %esi,%edi
+f01063f4:	e9 1e f6 ff ff       	jmp    f0105a17 <syscall+0x52>
+  if ( (error = envid2env(envid, &env, 1)) < 0)
+f01063f9:	83 ec 04             	sub    $0x4,%esp
+f01063fc:	6a 01                	push   $0x1
+f01063fe:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0106401:	50                   	push   %eax
+f0106402:	ff 75 0c             	push   0xc(%ebp)
+f0106405:	e8 da d5 ff ff       	call   f01039e4 <envid2env>
+f010640a:	89 c7                	mov    %eax,%edi
+f010640c:	83 c4 10             	add    $0x10,%esp
+f010640f:	85 c0                	test   %eax,%eax
+f0106411:	0f 88 00 f6 ff ff    	js     f0105a17 <syscall+0x52>
+      return sys_env_set_cow((envid_t) a1, a2 != 0);
+f0106417:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  env->env_kern_cow = kernel;
+f010641b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010641e:	0f 95 40 6c          	setne  0x6c(%eax)
+  return 0;
+f0106422:	bf 00 00 00 00       	mov    $0x0,%edi
+      return sys_env_set_cow((envid_t) a1, a2 != 0);
+f0106427:	e9 eb f5 ff ff       	jmp    f0105a17 <syscall+0x52>
+  if ( (error = sys_exofork()) < 0 )
+f010642c:	e8 dd f3 ff ff       	call   f010580e <sys_exofork>
+f0106431:	89 c7                	mov    %eax,%edi
+f0106433:	85 c0                	test   %eax,%eax
+f0106435:	0f 88 dc f5 ff ff    	js     f0105a17 <syscall+0x52>
+  if ( (error = envid2env(error, &child, 0)) < 0 )
+f010643b:	83 ec 04             	sub    $0x4,%esp
+f010643e:	6a 00                	push   $0x0
+f0106440:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f0106443:	50                   	push   %eax
+f0106444:	57                   	push   %edi
+f0106445:	e8 9a d5 ff ff       	call   f01039e4 <envid2env>
+f010644a:	89 c7                	mov    %eax,%edi
+f010644c:	83 c4 10             	add    $0x10,%esp
+f010644f:	85 c0                	test   %eax,%eax
+f0106451:	0f 88 c0 f5 ff ff    	js     f0105a17 <syscall+0x52>
+f0106457:	bb 00 00 00 00       	mov    $0x0,%ebx
+f010645c:	eb 1f                	jmp    f010647d <syscall+0xab8>
+		panic("pa2page called with invalid pa");
+f010645e:	83 ec 04             	sub    $0x4,%esp
+f0106461:	68 bc 8d 10 f0       	push   $0xf0108dbc
+f0106466:	6a 58                	push   $0x58
+f0106468:	68 29 96 10 f0       	push   $0xf0109629
+f010646d:	e8 ce 9b ff ff       	call   f0100040 <_panic>
+  for (pdeno = 0; pdeno < PDX(stacks); pdeno++) {
+f0106472:	83 c3 04             	add    $0x4,%ebx
+f0106475:	81 fb e8 0e 00 00    	cmp    $0xee8,%ebx
+f010647b:	74 48                	je     f01064c5 <syscall+0xb00>
+    pde = &curenv->env_pgdir[pdeno];
+f010647d:	e8 dd 17 00 00       	call   f0107c5f <cpunum>
+f0106482:	6b c0 74             	imul   $0x74,%eax,%eax
+f0106485:	8b 80 28 c0 79 f0    	mov    -0xf863fd8(%eax),%eax
+f010648b:	89 d9                	mov    %ebx,%ecx
+f010648d:	03 48 60             	add    0x60(%eax),%ecx
+    if ( !(*pde & PTE_P) )
+f0106490:	8b 01                	mov    (%ecx),%eax
+f0106492:	a8 01                	test   $0x1,%al
+f0106494:	74 dc                	je     f0106472 <syscall+0xaad>
+    *pde = (*pde & ~PTE_W) | PDE_SHARED;
+f0106496:	89 c2                	mov    %eax,%edx
+f0106498:	81 e2 fd f7 ff ff    	and    $0xfffff7fd,%edx
+f010649e:	80 ce 08             	or     $0x8,%dh
+f01064a1:	89 11                	mov    %edx,(%ecx)
+    child->env_pgdir[pdeno] = *pde;
+f01064a3:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+f01064a6:	8b 49 60             	mov    0x60(%ecx),%ecx
+f01064a9:	89 14 19             	mov    %edx,(%ecx,%ebx,1)
+	if (PGNUM(pa) >= npages)
+f01064ac:	c1 e8 0c             	shr    $0xc,%eax
+f01064af:	3b 05 08 bf 79 f0    	cmp    0xf079bf08,%eax
+f01064b5:	73 a7                	jae    f010645e <syscall+0xa99>
+	return &pages[PGNUM(pa)];
+f01064b7:	8b 15 10 bf 79 f0    	mov    0xf079bf10,%edx
+    pa2page(PTE_ADDR(*pde))->pp_ref++;
+f01064bd:	66 83 44 c2 04 01    	addw   $0x1,0x4(%edx,%eax,8)
+f01064c3:	eb ad                	jmp    f0106472 <syscall+0xaad>
+  lcr3(PADDR(curenv->env_pgdir));
+f01064c5:	e8 95 17 00 00       	call   f0107c5f <cpunum>
+f01064ca:	6b c0 74             	imul   $0x74,%eax,%eax
+f01064cd:	8b 80 28 c0 79 f0    	mov    -0xf863fd8(%eax),%eax
+f01064d3:	8b 40 60             	mov    0x60(%eax),%eax
+	if ((uint32_t)kva < KERNBASE)
+f01064d6:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f01064db:	76 7a                	jbe    f0106557 <syscall+0xb92>
+	return (physaddr_t)kva - KERNBASE;
+f01064dd:	05 00 00 00 10       	add    $0x10000000,%eax
+  __asm __volatile("movl %0,%%cr3" : : "r" (val));
+f01064e2:	0f 22 d8             	mov    %eax,%cr3
+  if ( (error = range_map(curenv, stacks, UXSTACKTOP - PGSIZE,
+f01064e5:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+f01064e8:	e8 72 17 00 00       	call   f0107c5f <cpunum>
+f01064ed:	6b c0 74             	imul   $0x74,%eax,%eax
+f01064f0:	8b 80 28 c0 79 f0    	mov    -0xf863fd8(%eax),%eax
+f01064f6:	83 ec 08             	sub    $0x8,%esp
+f01064f9:	6a 01                	push   $0x1
+f01064fb:	53                   	push   %ebx
+f01064fc:	b9 00 f0 bf ee       	mov    $0xeebff000,%ecx
+f0106501:	ba 00 00 80 ee       	mov    $0xee800000,%edx
+f0106506:	e8 b9 f3 ff ff       	call   f01058c4 <range_map>
+f010650b:	89 c7                	mov    %eax,%edi
+f010650d:	83 c4 10             	add    $0x10,%esp
+f0106510:	85 c0                	test   %eax,%eax
+f0106512:	78 58                	js     f010656c <syscall+0xba7>
+      (error = sys_page_alloc(child->env_id, (void *) (UXSTACKTOP - PGSIZE),
+f0106514:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0106517:	8b 40 48             	mov    0x48(%eax),%eax
+f010651a:	b9 07 00 00 00       	mov    $0x7,%ecx
+f010651f:	ba 00 f0 bf ee       	mov    $0xeebff000,%edx
+f0106524:	e8 63 f1 ff ff       	call   f010568c <sys_page_alloc>
+f0106529:	89 c7                	mov    %eax,%edi
+          child, PMR_COW)) < 0 ||
+f010652b:	85 c0                	test   %eax,%eax
+f010652d:	78 3d                	js     f010656c <syscall+0xba7>
+  child->env_pgfault_upcall = curenv->env_pgfault_upcall;
+f010652f:	e8 2b 17 00 00       	call   f0107c5f <cpunum>
+f0106534:	89 c2                	mov    %eax,%edx
+f0106536:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0106539:	6b d2 74             	imul   $0x74,%edx,%edx
+f010653c:	8b 92 28 c0 79 f0    	mov    -0xf863fd8(%edx),%edx
+f0106542:	8b 52 64             	mov    0x64(%edx),%edx
+f0106545:	89 50 64             	mov    %edx,0x64(%eax)
+  child->env_status = ENV_RUNNABLE;
+f0106548:	c7 40 54 02 00 00 00 	movl   $0x2,0x54(%eax)
+  return child->env_id;
+f010654f:	8b 78 48             	mov    0x48(%eax),%edi
+      return sys_fork();
+f0106552:	e9 c0 f4 ff ff       	jmp    f0105a17 <syscall+0x52>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0106557:	50                   	push   %eax
+f0106558:	68 e8 82 10 f0       	push   $0xf01082e8
+f010655d:	68 21 02 00 00       	push   $0x221
+f0106562:	68 57 9e 10 f0       	push   $0xf0109e57
+f0106567:	e8 d4 9a ff ff       	call   f0100040 <_panic>
+    env_destroy(child);
+f010656c:	83 ec 0c             	sub    $0xc,%esp
+f010656f:	ff 75 e4             	push   -0x1c(%ebp)
+f0106572:	e8 e0 da ff ff       	call   f0104057 <env_destroy>
+    return error;
+f0106577:	83 c4 10             	add    $0x10,%esp
+f010657a:	e9 98 f4 ff ff       	jmp    f0105a17 <syscall+0x52>
+      return sys_irq_listen(a1, (void *) a2);
+f010657f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((curenv->env_tf.tf_eflags & FL_IOPL_MASK) != FL_IOPL_3)
+f0106582:	e8 d8 16 00 00       	call   f0107c5f <cpunum>
+f0106587:	6b c0 74             	imul   $0x74,%eax,%eax
+f010658a:	8b 80 28 c0 79 f0    	mov    -0xf863fd8(%eax),%eax
+f0106590:	8b 40 38             	mov    0x38(%eax),%eax
+f0106593:	25 00 30 00 00       	and    $0x3000,%eax
+f0106598:	3d 00 30 00 00       	cmp    $0x3000,%eax
+f010659d:	75 47                	jne    f01065e6 <syscall+0xc21>
+  pa = 0;
+f010659f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  if (chan && (error = chan_lookup(chan, &pa)) < 0)
+f01065a6:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+f01065aa:	74 15                	je     f01065c1 <syscall+0xbfc>
+f01065ac:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+f01065af:	8b 45 10             	mov    0x10(%ebp),%eax
+f01065b2:	e8 81 f1 ff ff       	call   f0105738 <chan_lookup>
+f01065b7:	89 c7                	mov    %eax,%edi
+f01065b9:	85 c0                	test   %eax,%eax
+f01065bb:	0f 88 56 f4 ff ff    	js     f0105a17 <syscall+0x52>
+  return irq_listen(curenv, irq, pa);
+f01065c1:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+f01065c4:	e8 96 16 00 00       	call   f0107c5f <cpunum>
+f01065c9:	83 ec 04             	sub    $0x4,%esp
+f01065cc:	56                   	push   %esi
+f01065cd:	53                   	push   %ebx
+f01065ce:	6b c0 74             	imul   $0x74,%eax,%eax
+f01065d1:	ff b0 28 c0 79 f0    	push   -0xf863fd8(%eax)
+f01065d7:	e8 4c e7 ff ff       	call   f0104d28 <irq_listen>
+f01065dc:	89 c7                	mov    %eax,%edi
+f01065de:	83 c4 10             	add    $0x10,%esp
+f01065e1:	e9 31 f4 ff ff       	jmp    f0105a17 <syscall+0x52>
+    return -E_BAD_ENV;
+f01065e6:	bf fe ff ff ff       	mov    $0xfffffffe,%edi
+      return sys_irq_listen(a1, (void *) a2);
+f01065eb:	e9 27 f4 ff ff       	jmp    f0105a17 <syscall+0x52>
+      return sys_page_paddr((void *) a1);
+f01065f0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((curenv->env_tf.tf_eflags & FL_IOPL_MASK) != FL_IOPL_3)
+f01065f3:	e8 67 16 00 00       	call   f0107c5f <cpunum>
+f01065f8:	6b c0 74             	imul   $0x74,%eax,%eax
+f01065fb:	8b 80 28 c0 79 f0    	mov    -0xf863fd8(%eax),%eax
+f0106601:	8b 40 38             	mov    0x38(%eax),%eax
+f0106604:	25 00 30 00 00       	and    $0x3000,%eax
+f0106609:	3d 00 30 00 00       	cmp    $0x3000,%eax
+f010660e:	0f 85 7d 03 00 00    	jne    f0106991 <syscall+0xfcc>
+  if ((uintptr_t) va >= UTOP || !(page = page_lookup(curenv->env_pgdir, va, 0)))
+f0106614:	81 7d 0c ff ff bf ee 	cmpl   $0xeebfffff,0xc(%ebp)
+f010661b:	0f 87 7a 03 00 00    	ja     f010699b <syscall+0xfd6>
+f0106621:	e8 39 16 00 00       	call   f0107c5f <cpunum>
+f0106626:	83 ec 04             	sub    $0x4,%esp
+f0106629:	6a 00                	push   $0x0
+f010662b:	53                   	push   %ebx
+f010662c:	6b c0 74             	imul   $0x74,%eax,%eax
+f010662f:	8b 80 28 c0 79 f0    	mov    -0xf863fd8(%eax),%eax
+f0106635:	ff 70 60             	push   0x60(%eax)
+f0106638:	e8 d9 b1 ff ff       	call   f0101816 <page_lookup>
+f010663d:	83 c4 10             	add    $0x10,%esp
+f0106640:	85 c0                	test   %eax,%eax
+f0106642:	0f 84 5d 03 00 00    	je     f01069a5 <syscall+0xfe0>
+	return (pp - pages) << PGSHIFT;
+f0106648:	2b 05 10 bf 79 f0    	sub    0xf079bf10,%eax
+f010664e:	c1 f8 03             	sar    $0x3,%eax
+f0106651:	c1 e0 0c             	shl    $0xc,%eax
+f0106654:	89 c7                	mov    %eax,%edi
+  return page2pa(page);
+f0106656:	e9 bc f3 ff ff       	jmp    f0105a17 <syscall+0x52>
+      return sys_page_alloc_contig((void *) a1, a2, a3);
+f010665b:	8b 45 14             	mov    0x14(%ebp),%eax
+f010665e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  if ((curenv->env_tf.tf_eflags & FL_IOPL_MASK) != FL_IOPL_3)
+f0106661:	e8 f9 15 00 00       	call   f0107c5f <cpunum>
+f0106666:	6b c0 74             	imul   $0x74,%eax,%eax
+f0106669:	8b 80 28 c0 79 f0    	mov    -0xf863fd8(%eax),%eax
+f010666f:	8b 40 38             	mov    0x38(%eax),%eax
+f0106672:	25 00 30 00 00       	and    $0x3000,%eax
+f0106677:	3d 00 30 00 00       	cmp    $0x3000,%eax
+f010667c:	0f 85 2d 03 00 00    	jne    f01069af <syscall+0xfea>
+  if ((uintptr_t) va % PGSIZE != 0 || n == 0 || n > UTOP / PGSIZE ||
+f0106682:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f0106685:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+f010668b:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+f010668e:	0f 85 25 03 00 00    	jne    f01069b9 <syscall+0xff4>
+f0106694:	8b 45 10             	mov    0x10(%ebp),%eax
+f0106697:	83 e8 01             	sub    $0x1,%eax
+f010669a:	3d ff eb 0e 00       	cmp    $0xeebff,%eax
+f010669f:	0f 87 1e 03 00 00    	ja     f01069c3 <syscall+0xffe>
+      (uintptr_t) va > UTOP - n * PGSIZE ||
+f01066a5:	b8 00 ec 0e 00       	mov    $0xeec00,%eax
+f01066aa:	2b 45 10             	sub    0x10(%ebp),%eax
+f01066ad:	c1 e0 0c             	shl    $0xc,%eax
+  if ((uintptr_t) va % PGSIZE != 0 || n == 0 || n > UTOP / PGSIZE ||
+f01066b0:	3b 45 0c             	cmp    0xc(%ebp),%eax
+f01066b3:	0f 82 14 03 00 00    	jb     f01069cd <syscall+0x1008>
+      (perm & (PTE_U | PTE_P)) != (PTE_U | PTE_P) || (perm & ~PTE_SYSCALL))
+f01066b9:	8b 45 14             	mov    0x14(%ebp),%eax
+f01066bc:	25 fd f1 ff ff       	and    $0xfffff1fd,%eax
+f01066c1:	83 f8 05             	cmp    $0x5,%eax
+f01066c4:	0f 85 0d 03 00 00    	jne    f01069d7 <syscall+0x1012>
+  if (!(first = page_alloc_contig(n, ALLOC_ZERO)))
+f01066ca:	83 ec 08             	sub    $0x8,%esp
+f01066cd:	6a 01                	push   $0x1
+f01066cf:	ff 75 10             	push   0x10(%ebp)
+f01066d2:	e8 4f ac ff ff       	call   f0101326 <page_alloc_contig>
+f01066d7:	83 c4 10             	add    $0x10,%esp
+f01066da:	85 c0                	test   %eax,%eax
+f01066dc:	0f 84 ff 02 00 00    	je     f01069e1 <syscall+0x101c>
+f01066e2:	89 c7                	mov    %eax,%edi
+f01066e4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  for (i = 0; i < n; i++) {
+f01066e7:	89 45 cc             	mov    %eax,-0x34(%ebp)
+    if ((error = page_insert(curenv->env_pgdir, &first[i],
+f01066ea:	e8 70 15 00 00       	call   f0107c5f <cpunum>
+f01066ef:	ff 75 d4             	push   -0x2c(%ebp)
+f01066f2:	56                   	push   %esi
+f01066f3:	57                   	push   %edi
+f01066f4:	6b c0 74             	imul   $0x74,%eax,%eax
+f01066f7:	8b 80 28 c0 79 f0    	mov    -0xf863fd8(%eax),%eax
+f01066fd:	ff 70 60             	push   0x60(%eax)
+f0106700:	e8 10 b2 ff ff       	call   f0101915 <page_insert>
+f0106705:	83 c7 08             	add    $0x8,%edi
+f0106708:	81 c6 00 10 00 00    	add    $0x1000,%esi
+f010670e:	83 c4 10             	add    $0x10,%esp
+f0106711:	85 c0                	test   %eax,%eax
+f0106713:	78 12                	js     f0106727 <syscall+0xd62>
+  for (i = 0; i < n; i++) {
+f0106715:	83 c3 01             	add    $0x1,%ebx
+f0106718:	39 5d 10             	cmp    %ebx,0x10(%ebp)
+f010671b:	75 cd                	jne    f01066ea <syscall+0xd25>
+  return 0;
+f010671d:	bf 00 00 00 00       	mov    $0x0,%edi
+f0106722:	e9 f0 f2 ff ff       	jmp    f0105a17 <syscall+0x52>
+f0106727:	8b 55 cc             	mov    -0x34(%ebp),%edx
+f010672a:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+f010672d:	8b 75 d0             	mov    -0x30(%ebp),%esi
+f0106730:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f0106733:	8b 7d 0c             	mov    0xc(%ebp),%edi
+f0106736:	eb 26                	jmp    f010675e <syscall+0xd99>
+        page_remove(curenv->env_pgdir, (char *) va + j * PGSIZE);
+f0106738:	e8 22 15 00 00       	call   f0107c5f <cpunum>
+f010673d:	83 ec 08             	sub    $0x8,%esp
+f0106740:	57                   	push   %edi
+f0106741:	6b c0 74             	imul   $0x74,%eax,%eax
+f0106744:	8b 80 28 c0 79 f0    	mov    -0xf863fd8(%eax),%eax
+f010674a:	ff 70 60             	push   0x60(%eax)
+f010674d:	e8 57 b1 ff ff       	call   f01018a9 <page_remove>
+      for (j = 0; j < i; j++)
+f0106752:	83 c6 01             	add    $0x1,%esi
+f0106755:	81 c7 00 10 00 00    	add    $0x1000,%edi
+f010675b:	83 c4 10             	add    $0x10,%esp
+f010675e:	39 f3                	cmp    %esi,%ebx
+f0106760:	75 d6                	jne    f0106738 <syscall+0xd73>
+f0106762:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+f0106765:	8b 7d d0             	mov    -0x30(%ebp),%edi
+f0106768:	8d 34 da             	lea    (%edx,%ebx,8),%esi
+f010676b:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+f010676e:	8b 7d 10             	mov    0x10(%ebp),%edi
+f0106771:	eb 12                	jmp    f0106785 <syscall+0xdc0>
+        page_free(&first[j]);
+f0106773:	83 ec 0c             	sub    $0xc,%esp
+f0106776:	56                   	push   %esi
+f0106777:	e8 d4 ac ff ff       	call   f0101450 <page_free>
+      for (j = i; j < n; j++)
+f010677c:	83 c3 01             	add    $0x1,%ebx
+f010677f:	83 c6 08             	add    $0x8,%esi
+f0106782:	83 c4 10             	add    $0x10,%esp
+f0106785:	39 fb                	cmp    %edi,%ebx
+f0106787:	72 ea                	jb     f0106773 <syscall+0xdae>
+f0106789:	8b 7d d4             	mov    -0x2c(%ebp),%edi
+f010678c:	e9 86 f2 ff ff       	jmp    f0105a17 <syscall+0x52>
+  if ( eip >= UTOP || esp > UTOP || uxstacktop > UTOP ||
+f0106791:	81 7d 0c ff ff bf ee 	cmpl   $0xeebfffff,0xc(%ebp)
+f0106798:	0f 87 ad 01 00 00    	ja     f010694b <syscall+0xf86>
+f010679e:	81 7d 10 00 00 c0 ee 	cmpl   $0xeec00000,0x10(%ebp)
+f01067a5:	0f 87 a0 01 00 00    	ja     f010694b <syscall+0xf86>
+f01067ab:	8b 45 14             	mov    0x14(%ebp),%eax
+f01067ae:	2d 00 10 00 00       	sub    $0x1000,%eax
+f01067b3:	3d 00 f0 bf ee       	cmp    $0xeebff000,%eax
+f01067b8:	0f 87 97 01 00 00    	ja     f0106955 <syscall+0xf90>
+      uxstacktop < PGSIZE || PGOFF(uxstacktop) )
+f01067be:	f7 45 14 ff 0f 00 00 	testl  $0xfff,0x14(%ebp)
+f01067c5:	0f 85 94 01 00 00    	jne    f010695f <syscall+0xf9a>
+  if ( (error = env_alloc(&env, curenv->env_id)) < 0 )
+f01067cb:	e8 8f 14 00 00       	call   f0107c5f <cpunum>
+f01067d0:	83 ec 08             	sub    $0x8,%esp
+f01067d3:	6b c0 74             	imul   $0x74,%eax,%eax
+f01067d6:	8b 80 28 c0 79 f0    	mov    -0xf863fd8(%eax),%eax
+f01067dc:	ff 70 48             	push   0x48(%eax)
+f01067df:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+f01067e2:	50                   	push   %eax
+f01067e3:	e8 1f d3 ff ff       	call   f0103b07 <env_alloc>
+f01067e8:	89 c7                	mov    %eax,%edi
+f01067ea:	83 c4 10             	add    $0x10,%esp
+f01067ed:	85 c0                	test   %eax,%eax
+f01067ef:	0f 88 22 f2 ff ff    	js     f0105a17 <syscall+0x52>
+  page_decref(pa2page(PADDR(env->env_pgdir)));
+f01067f5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01067f8:	8b 40 60             	mov    0x60(%eax),%eax
+	if ((uint32_t)kva < KERNBASE)
+f01067fb:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f0106800:	0f 86 f3 00 00 00    	jbe    f01068f9 <syscall+0xf34>
+	return (physaddr_t)kva - KERNBASE;
+f0106806:	05 00 00 00 10       	add    $0x10000000,%eax
+	if (PGNUM(pa) >= npages)
+f010680b:	c1 e8 0c             	shr    $0xc,%eax
+f010680e:	3b 05 08 bf 79 f0    	cmp    0xf079bf08,%eax
+f0106814:	0f 83 f4 00 00 00    	jae    f010690e <syscall+0xf49>
+f010681a:	83 ec 0c             	sub    $0xc,%esp
+	return &pages[PGNUM(pa)];
+f010681d:	8b 15 10 bf 79 f0    	mov    0xf079bf10,%edx
+f0106823:	8d 04 c2             	lea    (%edx,%eax,8),%eax
+f0106826:	50                   	push   %eax
+f0106827:	e8 5a ac ff ff       	call   f0101486 <page_decref>
+  env->env_pgdir = curenv->env_pgdir;
+f010682c:	e8 2e 14 00 00       	call   f0107c5f <cpunum>
+f0106831:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+f0106834:	6b c0 74             	imul   $0x74,%eax,%eax
+f0106837:	8b 80 28 c0 79 f0    	mov    -0xf863fd8(%eax),%eax
+f010683d:	8b 40 60             	mov    0x60(%eax),%eax
+f0106840:	89 42 60             	mov    %eax,0x60(%edx)
+	if ((uint32_t)kva < KERNBASE)
+f0106843:	83 c4 10             	add    $0x10,%esp
+f0106846:	3d ff ff ff ef       	cmp    $0xefffffff,%eax
+f010684b:	0f 86 d1 00 00 00    	jbe    f0106922 <syscall+0xf5d>
+	return (physaddr_t)kva - KERNBASE;
+f0106851:	05 00 00 00 10       	add    $0x10000000,%eax
+	if (PGNUM(pa) >= npages)
+f0106856:	c1 e8 0c             	shr    $0xc,%eax
+f0106859:	3b 05 08 bf 79 f0    	cmp    0xf079bf08,%eax
+f010685f:	0f 83 d2 00 00 00    	jae    f0106937 <syscall+0xf72>
+	return &pages[PGNUM(pa)];
+f0106865:	8b 0d 10 bf 79 f0    	mov    0xf079bf10,%ecx
+  pa2page(PADDR(env->env_pgdir))->pp_ref++;
+f010686b:	66 83 44 c1 04 01    	addw   $0x1,0x4(%ecx,%eax,8)
+  env->env_status = ENV_NOT_RUNNABLE;
+f0106871:	c7 42 54 04 00 00 00 	movl   $0x4,0x54(%edx)
+  env->env_type = curenv->env_type;
+f0106878:	e8 e2 13 00 00       	call   f0107c5f <cpunum>
+f010687d:	6b c0 74             	imul   $0x74,%eax,%eax
+f0106880:	8b 80 28 c0 79 f0    	mov    -0xf863fd8(%eax),%eax
+f0106886:	8b 50 50             	mov    0x50(%eax),%edx
+f0106889:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f010688c:	89 50 50             	mov    %edx,0x50(%eax)
+  env->env_tf = curenv->env_tf;
+f010688f:	e8 cb 13 00 00       	call   f0107c5f <cpunum>
+f0106894:	6b c0 74             	imul   $0x74,%eax,%eax
+f0106897:	8b b0 28 c0 79 f0    	mov    -0xf863fd8(%eax),%esi
+f010689d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01068a0:	b9 11 00 00 00       	mov    $0x11,%ecx
+f01068a5:	89 c7                	mov    %eax,%edi
+f01068a7:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  env->env_tf.tf_eip = eip;
+f01068a9:	8b 75 0c             	mov    0xc(%ebp),%esi
+f01068ac:	89 70 30             	mov    %esi,0x30(%eax)
+  env->env_tf.tf_esp = esp;
+f01068af:	8b 75 10             	mov    0x10(%ebp),%esi
+f01068b2:	89 70 3c             	mov    %esi,0x3c(%eax)
+  env->env_tf.tf_regs.reg_eax = 0;
+f01068b5:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  env->env_pgfault_upcall = curenv->env_pgfault_upcall;
+f01068bc:	e8 9e 13 00 00       	call   f0107c5f <cpunum>
+f01068c1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+f01068c4:	6b c0 74             	imul   $0x74,%eax,%eax
+f01068c7:	8b 80 28 c0 79 f0    	mov    -0xf863fd8(%eax),%eax
+f01068cd:	8b 40 64             	mov    0x64(%eax),%eax
+f01068d0:	89 42 64             	mov    %eax,0x64(%edx)
+  env->env_uxstacktop = uxstacktop;
+f01068d3:	8b 45 14             	mov    0x14(%ebp),%eax
+f01068d6:	89 42 68             	mov    %eax,0x68(%edx)
+  env->env_kern_cow = curenv->env_kern_cow;
+f01068d9:	e8 81 13 00 00       	call   f0107c5f <cpunum>
+f01068de:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+f01068e1:	6b c0 74             	imul   $0x74,%eax,%eax
+f01068e4:	8b 80 28 c0 79 f0    	mov    -0xf863fd8(%eax),%eax
+f01068ea:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+f01068ee:	88 42 6c             	mov    %al,0x6c(%edx)
+  return env->env_id;
+f01068f1:	8b 7a 48             	mov    0x48(%edx),%edi
+f01068f4:	e9 1e f1 ff ff       	jmp    f0105a17 <syscall+0x52>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f01068f9:	50                   	push   %eax
+f01068fa:	68 e8 82 10 f0       	push   $0xf01082e8
+f01068ff:	68 4b 02 00 00       	push   $0x24b
+f0106904:	68 57 9e 10 f0       	push   $0xf0109e57
+f0106909:	e8 32 97 ff ff       	call   f0100040 <_panic>
+		panic("pa2page called with invalid pa");
+f010690e:	83 ec 04             	sub    $0x4,%esp
+f0106911:	68 bc 8d 10 f0       	push   $0xf0108dbc
+f0106916:	6a 58                	push   $0x58
+f0106918:	68 29 96 10 f0       	push   $0xf0109629
+f010691d:	e8 1e 97 ff ff       	call   f0100040 <_panic>
+		_panic(file, line, "PADDR called with invalid kva %08lx", kva);
+f0106922:	50                   	push   %eax
+f0106923:	68 e8 82 10 f0       	push   $0xf01082e8
+f0106928:	68 4d 02 00 00       	push   $0x24d
+f010692d:	68 57 9e 10 f0       	push   $0xf0109e57
+f0106932:	e8 09 97 ff ff       	call   f0100040 <_panic>
+		panic("pa2page called with invalid pa");
+f0106937:	83 ec 04             	sub    $0x4,%esp
+f010693a:	68 bc 8d 10 f0       	push   $0xf0108dbc
+f010693f:	6a 58                	push   $0x58
+f0106941:	68 29 96 10 f0       	push   $0xf0109629
+f0106946:	e8 f5 96 ff ff       	call   f0100040 <_panic>
+    return -E_INVAL;
+f010694b:	bf fd ff ff ff       	mov    $0xfffffffd,%edi
+f0106950:	e9 c2 f0 ff ff       	jmp    f0105a17 <syscall+0x52>
+f0106955:	bf fd ff ff ff       	mov    $0xfffffffd,%edi
+f010695a:	e9 b8 f0 ff ff       	jmp    f0105a17 <syscall+0x52>
+f010695f:	bf fd ff ff ff       	mov    $0xfffffffd,%edi
+      return sys_thread_create(a1, a2, a3);
+f0106964:	e9 ae f0 ff ff       	jmp    f0105a17 <syscall+0x52>
+  switch (syscallno) {
+f0106969:	bf fd ff ff ff       	mov    $0xfffffffd,%edi
+f010696e:	e9 a4 f0 ff ff       	jmp    f0105a17 <syscall+0x52>
+    return -E_INVAL;
+f0106973:	bf fd ff ff ff       	mov    $0xfffffffd,%edi
+f0106978:	e9 9a f0 ff ff       	jmp    f0105a17 <syscall+0x52>
+f010697d:	bf fd ff ff ff       	mov    $0xfffffffd,%edi
+f0106982:	e9 90 f0 ff ff       	jmp    f0105a17 <syscall+0x52>
+    return -E_INVAL;
+f0106987:	bf fd ff ff ff       	mov    $0xfffffffd,%edi
+f010698c:	e9 86 f0 ff ff       	jmp    f0105a17 <syscall+0x52>
+    return -E_BAD_ENV;
+f0106991:	bf fe ff ff ff       	mov    $0xfffffffe,%edi
+f0106996:	e9 7c f0 ff ff       	jmp    f0105a17 <syscall+0x52>
+    return -E_INVAL;
+f010699b:	bf fd ff ff ff       	mov    $0xfffffffd,%edi
+f01069a0:	e9 72 f0 ff ff       	jmp    f0105a17 <syscall+0x52>
+f01069a5:	bf fd ff ff ff       	mov    $0xfffffffd,%edi
+f01069aa:	e9 68 f0 ff ff       	jmp    f0105a17 <syscall+0x52>
+    return -E_BAD_ENV;
+f01069af:	bf fe ff ff ff       	mov    $0xfffffffe,%edi
+f01069b4:	e9 5e f0 ff ff       	jmp    f0105a17 <syscall+0x52>
+    return -E_INVAL;
+f01069b9:	bf fd ff ff ff       	mov    $0xfffffffd,%edi
+f01069be:	e9 54 f0 ff ff       	jmp    f0105a17 <syscall+0x52>
+f01069c3:	bf fd ff ff ff       	mov    $0xfffffffd,%edi
+f01069c8:	e9 4a f0 ff ff       	jmp    f0105a17 <syscall+0x52>
+f01069cd:	bf fd ff ff ff       	mov    $0xfffffffd,%edi
+f01069d2:	e9 40 f0 ff ff       	jmp    f0105a17 <syscall+0x52>
+f01069d7:	bf fd ff ff ff       	mov    $0xfffffffd,%edi
+f01069dc:	e9 36 f0 ff ff       	jmp    f0105a17 <syscall+0x52>
+    return -E_NO_MEM;
+f01069e1:	bf fc ff ff ff       	mov    $0xfffffffc,%edi
+f01069e6:	e9 2c f0 ff ff       	jmp    f0105a17 <syscall+0x52>
+  curenv->env_ipc_recving = 1;
+f01069eb:	e8 6f 12 00 00       	call   f0107c5f <cpunum>
+f01069f0:	6b c0 74             	imul   $0x74,%eax,%eax
+f01069f3:	8b 80 28 c0 79 f0    	mov    -0xf863fd8(%eax),%eax
+f01069f9:	c6 40 6d 01          	movb   $0x1,0x6d(%eax)
+  curenv->env_status = ENV_NOT_RUNNABLE;
+f01069fd:	e8 5d 12 00 00       	call   f0107c5f <cpunum>
+f0106a02:	6b c0 74             	imul   $0x74,%eax,%eax
+f0106a05:	8b 80 28 c0 79 f0    	mov    -0xf863fd8(%eax),%eax
+f0106a0b:	c7 40 54 04 00 00 00 	movl   $0x4,0x54(%eax)
+  curenv->env_ipc_npages = (uint32_t) dstva < UTOP ? MAX(npages, 1) : 0;
+f0106a12:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0106a17:	e8 43 12 00 00       	call   f0107c5f <cpunum>
+f0106a1c:	6b c0 74             	imul   $0x74,%eax,%eax
+f0106a1f:	8b 80 28 c0 79 f0    	mov    -0xf863fd8(%eax),%eax
+f0106a25:	89 58 74             	mov    %ebx,0x74(%eax)
+  return 0;
+f0106a28:	bf 00 00 00 00       	mov    $0x0,%edi
+f0106a2d:	e9 e5 ef ff ff       	jmp    f0105a17 <syscall+0x52>
+f0106a32:	89 c7                	mov    %eax,%edi
+f0106a34:	e9 de ef ff ff       	jmp    f0105a17 <syscall+0x52>
+f0106a39:	89 f7                	mov    %esi,%edi
+f0106a3b:	e9 d7 ef ff ff       	jmp    f0105a17 <syscall+0x52>
+f0106a40:	89 f7                	mov    %esi,%edi
+f0106a42:	e9 d0 ef ff ff       	jmp    f0105a17 <syscall+0x52>
+
+f0106a47 <stab_binsearch>:
+//	will exit setting left = 118, right = 554.
+//
+static void
+stab_binsearch(const struct Stab *stabs, int *region_left, int *region_right,
+               int type, uintptr_t addr)
+{
+f0106a47:	55                   	push   %ebp
+f0106a48:	89 e5                	mov    %esp,%ebp
+f0106a4a:	57                   	push   %edi
+f0106a4b:	56                   	push   %esi
+f0106a4c:	53                   	push   %ebx
+f0106a4d:	83 ec 14             	sub    $0x14,%esp
+f0106a50:	89 45 f0             	mov    %eax,-0x10(%ebp)
+f0106a53:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+f0106a56:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  int l = *region_left, r = *region_right, any_matches = 0;
+f0106a59:	8b 1a                	mov    (%edx),%ebx
+f0106a5b:	8b 09                	mov    (%ecx),%ecx
+f0106a5d:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+
+  while (l <= r) {
+f0106a64:	eb 4f                	jmp    f0106ab5 <stab_binsearch+0x6e>
+    int true_m = (l + r) / 2, m = true_m;
+
+    // search for earliest stab with right type
+    while (m >= l && stabs[m].n_type != type)
+      m--;
+f0106a66:	83 e8 01             	sub    $0x1,%eax
+    while (m >= l && stabs[m].n_type != type)
+f0106a69:	39 c3                	cmp    %eax,%ebx
+f0106a6b:	0f 8f cc 00 00 00    	jg     f0106b3d <stab_binsearch+0xf6>
+f0106a71:	0f b6 0a             	movzbl (%edx),%ecx
+f0106a74:	83 ea 0c             	sub    $0xc,%edx
+f0106a77:	39 f1                	cmp    %esi,%ecx
+f0106a79:	75 eb                	jne    f0106a66 <stab_binsearch+0x1f>
+f0106a7b:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+f0106a7e:	89 75 08             	mov    %esi,0x8(%ebp)
+      continue;
+    }
+
+    // actual binary search
+    any_matches = 1;
+    if (stabs[m].n_value < addr) {
+f0106a81:	8d 14 40             	lea    (%eax,%eax,2),%edx
+f0106a84:	8b 75 f0             	mov    -0x10(%ebp),%esi
+f0106a87:	8b 54 96 08          	mov    0x8(%esi,%edx,4),%edx
+f0106a8b:	3b 55 0c             	cmp    0xc(%ebp),%edx
+f0106a8e:	72 16                	jb     f0106aa6 <stab_binsearch+0x5f>
+      *region_left = m;
+      l = true_m + 1;
+    } else if (stabs[m].n_value > addr) {
+f0106a90:	39 55 0c             	cmp    %edx,0xc(%ebp)
+f0106a93:	73 48                	jae    f0106add <stab_binsearch+0x96>
+      *region_right = m - 1;
+f0106a95:	8d 48 ff             	lea    -0x1(%eax),%ecx
+f0106a98:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0106a9b:	89 08                	mov    %ecx,(%eax)
+    any_matches = 1;
+f0106a9d:	c7 45 e8 01 00 00 00 	movl   $0x1,-0x18(%ebp)
+f0106aa4:	eb 0f                	jmp    f0106ab5 <stab_binsearch+0x6e>
+      *region_left = m;
+f0106aa6:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+f0106aa9:	89 06                	mov    %eax,(%esi)
+      l = true_m + 1;
+f0106aab:	8d 5f 01             	lea    0x1(%edi),%ebx
+    any_matches = 1;
+f0106aae:	c7 45 e8 01 00 00 00 	movl   $0x1,-0x18(%ebp)
+  while (l <= r) {
+f0106ab5:	39 cb                	cmp    %ecx,%ebx
+f0106ab7:	7f 38                	jg     f0106af1 <stab_binsearch+0xaa>
+    int true_m = (l + r) / 2, m = true_m;
+f0106ab9:	8d 04 0b             	lea    (%ebx,%ecx,1),%eax
+f0106abc:	89 c2                	mov    %eax,%edx
+f0106abe:	c1 ea 1f             	shr    $0x1f,%edx
+f0106ac1:	01 d0                	add    %edx,%eax
+f0106ac3:	89 c7                	mov    %eax,%edi
+f0106ac5:	d1 ff                	sar    %edi
+    while (m >= l && stabs[m].n_type != type)
+f0106ac7:	83 e0 fe             	and    $0xfffffffe,%eax
+f0106aca:	01 f8                	add    %edi,%eax
+f0106acc:	8b 55 f0             	mov    -0x10(%ebp),%edx
+f0106acf:	8d 54 82 04          	lea    0x4(%edx,%eax,4),%edx
+    int true_m = (l + r) / 2, m = true_m;
+f0106ad3:	89 f8                	mov    %edi,%eax
+f0106ad5:	89 4d ec             	mov    %ecx,-0x14(%ebp)
+f0106ad8:	8b 75 08             	mov    0x8(%ebp),%esi
+    while (m >= l && stabs[m].n_type != type)
+f0106adb:	eb 8c                	jmp    f0106a69 <stab_binsearch+0x22>
+      r = m - 1;
+    } else {
+      // exact match for 'addr', but continue loop to find
+      // *region_right
+      *region_left = m;
+f0106add:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f0106ae0:	89 07                	mov    %eax,(%edi)
+      l = m;
+      addr++;
+f0106ae2:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+f0106ae6:	89 c3                	mov    %eax,%ebx
+    any_matches = 1;
+f0106ae8:	c7 45 e8 01 00 00 00 	movl   $0x1,-0x18(%ebp)
+f0106aef:	eb c4                	jmp    f0106ab5 <stab_binsearch+0x6e>
+    }
+  }
+
+  if (!any_matches)
+f0106af1:	8b 75 08             	mov    0x8(%ebp),%esi
+f0106af4:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+f0106af8:	75 15                	jne    f0106b0f <stab_binsearch+0xc8>
+    *region_right = *region_left - 1;
+f0106afa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0106afd:	8b 00                	mov    (%eax),%eax
+f0106aff:	83 e8 01             	sub    $0x1,%eax
+f0106b02:	8b 7d e0             	mov    -0x20(%ebp),%edi
+f0106b05:	89 07                	mov    %eax,(%edi)
+         l > *region_left && stabs[l].n_type != type;
+         l--)
+      /* do nothing */;
+    *region_left = l;
+  }
+}
+f0106b07:	83 c4 14             	add    $0x14,%esp
+f0106b0a:	5b                   	pop    %ebx
+f0106b0b:	5e                   	pop    %esi
+f0106b0c:	5f                   	pop    %edi
+f0106b0d:	5d                   	pop    %ebp
+f0106b0e:	c3                   	ret
+    for (l = *region_right;
+f0106b0f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0106b12:	8b 00                	mov    (%eax),%eax
+         l > *region_left && stabs[l].n_type != type;
+f0106b14:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f0106b17:	8b 0f                	mov    (%edi),%ecx
+f0106b19:	8d 14 40             	lea    (%eax,%eax,2),%edx
+f0106b1c:	8b 7d f0             	mov    -0x10(%ebp),%edi
+f0106b1f:	8d 54 97 04          	lea    0x4(%edi,%edx,4),%edx
+f0106b23:	39 c1                	cmp    %eax,%ecx
+f0106b25:	7d 0f                	jge    f0106b36 <stab_binsearch+0xef>
+f0106b27:	0f b6 1a             	movzbl (%edx),%ebx
+f0106b2a:	83 ea 0c             	sub    $0xc,%edx
+f0106b2d:	39 f3                	cmp    %esi,%ebx
+f0106b2f:	74 05                	je     f0106b36 <stab_binsearch+0xef>
+         l--)
+f0106b31:	83 e8 01             	sub    $0x1,%eax
+f0106b34:	eb ed                	jmp    f0106b23 <stab_binsearch+0xdc>
+    *region_left = l;
+f0106b36:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f0106b39:	89 07                	mov    %eax,(%edi)
+}
+f0106b3b:	eb ca                	jmp    f0106b07 <stab_binsearch+0xc0>
+      l = true_m + 1;
+f0106b3d:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+f0106b40:	89 75 08             	mov    %esi,0x8(%ebp)
+f0106b43:	8d 5f 01             	lea    0x1(%edi),%ebx
+      continue;
+f0106b46:	e9 6a ff ff ff       	jmp    f0106ab5 <stab_binsearch+0x6e>
+
+f0106b4b <debuginfo_eip>:
+//	negative if not.  But even if it returns negative it has stored some
+//	information into '*info'.
+//
+int
+debuginfo_eip(uintptr_t addr, struct Eipdebuginfo *info)
+{
+f0106b4b:	55                   	push   %ebp
+f0106b4c:	89 e5                	mov    %esp,%ebp
+f0106b4e:	57                   	push   %edi
+f0106b4f:	56                   	push   %esi
+f0106b50:	53                   	push   %ebx
+f0106b51:	83 ec 3c             	sub    $0x3c,%esp
+  const struct Stab *stabs, *stab_end;
+  const char *stabstr, *stabstr_end;
+  int lfile, rfile, lfun, rfun, lline, rline;
+
+  // Initialize *info
+  info->eip_file = "<unknown>";
+f0106b54:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0106b57:	c7 00 d0 9e 10 f0    	movl   $0xf0109ed0,(%eax)
+  info->eip_line = 0;
+f0106b5d:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%eax)
+  info->eip_fn_name = "<unknown>";
+f0106b64:	c7 40 08 d0 9e 10 f0 	movl   $0xf0109ed0,0x8(%eax)
+  info->eip_fn_namelen = 9;
+f0106b6b:	c7 40 0c 09 00 00 00 	movl   $0x9,0xc(%eax)
+  info->eip_fn_addr = addr;
+f0106b72:	8b 7d 08             	mov    0x8(%ebp),%edi
+f0106b75:	89 78 10             	mov    %edi,0x10(%eax)
+  info->eip_fn_narg = 0;
+f0106b78:	c7 40 14 00 00 00 00 	movl   $0x0,0x14(%eax)
+
+  // Find the relevant set of stabs
+  if (addr >= ULIM) {
+f0106b7f:	81 ff ff ff 7f ef    	cmp    $0xef7fffff,%edi
+f0106b85:	0f 86 35 01 00 00    	jbe    f0106cc0 <debuginfo_eip+0x175>
+    stabs = __STAB_BEGIN__;
+    stab_end = __STAB_END__;
+    stabstr = __STABSTR_BEGIN__;
+    stabstr_end = __STABSTR_END__;
+f0106b8b:	c7 45 c0 92 a4 10 f0 	movl   $0xf010a492,-0x40(%ebp)
+    stabstr = __STABSTR_BEGIN__;
+f0106b92:	c7 45 bc 92 a4 10 f0 	movl   $0xf010a492,-0x44(%ebp)
+    stab_end = __STAB_END__;
+f0106b99:	be 91 a4 10 f0       	mov    $0xf010a491,%esi
+    stabs = __STAB_BEGIN__;
+f0106b9e:	c7 45 c4 91 a4 10 f0 	movl   $0xf010a491,-0x3c(%ebp)
+      return -1;
+    }
+  }
+
+  // String table validity checks
+  if (stabstr_end <= stabstr || stabstr_end[-1] != 0)
+f0106ba5:	8b 4d c0             	mov    -0x40(%ebp),%ecx
+f0106ba8:	39 4d bc             	cmp    %ecx,-0x44(%ebp)
+f0106bab:	0f 83 4c 02 00 00    	jae    f0106dfd <debuginfo_eip+0x2b2>
+f0106bb1:	80 79 ff 00          	cmpb   $0x0,-0x1(%ecx)
+f0106bb5:	0f 85 49 02 00 00    	jne    f0106e04 <debuginfo_eip+0x2b9>
+  // 'eip'.  First, we find the basic source file containing 'eip'.
+  // Then, we look in that source file for the function.  Then we look
+  // for the line number.
+
+  // Search the entire set of stabs for the source file (type N_SO).
+  lfile = 0;
+f0106bbb:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  rfile = (stab_end - stabs) - 1;
+f0106bc2:	8b 7d c4             	mov    -0x3c(%ebp),%edi
+f0106bc5:	29 fe                	sub    %edi,%esi
+f0106bc7:	c1 fe 02             	sar    $0x2,%esi
+f0106bca:	69 c6 ab aa aa aa    	imul   $0xaaaaaaab,%esi,%eax
+f0106bd0:	83 e8 01             	sub    $0x1,%eax
+f0106bd3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  stab_binsearch(stabs, &lfile, &rfile, N_SO, addr);
+f0106bd6:	83 ec 08             	sub    $0x8,%esp
+f0106bd9:	ff 75 08             	push   0x8(%ebp)
+f0106bdc:	6a 64                	push   $0x64
+f0106bde:	8d 45 e0             	lea    -0x20(%ebp),%eax
+f0106be1:	89 c1                	mov    %eax,%ecx
+f0106be3:	8d 55 e4             	lea    -0x1c(%ebp),%edx
+f0106be6:	89 f8                	mov    %edi,%eax
+f0106be8:	e8 5a fe ff ff       	call   f0106a47 <stab_binsearch>
+  if (lfile == 0)
+f0106bed:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+f0106bf0:	83 c4 10             	add    $0x10,%esp
+f0106bf3:	85 f6                	test   %esi,%esi
+f0106bf5:	0f 84 10 02 00 00    	je     f0106e0b <debuginfo_eip+0x2c0>
+    return -1;
+
+  // Search within that file's stabs for the function definition
+  // (N_FUN).
+  lfun = lfile;
+f0106bfb:	89 75 dc             	mov    %esi,-0x24(%ebp)
+  rfun = rfile;
+f0106bfe:	8b 5d e0             	mov    -0x20(%ebp),%ebx
+f0106c01:	89 5d d8             	mov    %ebx,-0x28(%ebp)
+  stab_binsearch(stabs, &lfun, &rfun, N_FUN, addr);
+f0106c04:	83 ec 08             	sub    $0x8,%esp
+f0106c07:	ff 75 08             	push   0x8(%ebp)
+f0106c0a:	6a 24                	push   $0x24
+f0106c0c:	8d 45 d8             	lea    -0x28(%ebp),%eax
+f0106c0f:	89 c1                	mov    %eax,%ecx
+f0106c11:	8d 55 dc             	lea    -0x24(%ebp),%edx
+f0106c14:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+f0106c17:	89 f8                	mov    %edi,%eax
+f0106c19:	e8 29 fe ff ff       	call   f0106a47 <stab_binsearch>
+
+  if (lfun <= rfun) {
+f0106c1e:	8b 55 dc             	mov    -0x24(%ebp),%edx
+f0106c21:	89 55 b8             	mov    %edx,-0x48(%ebp)
+f0106c24:	8b 7d d8             	mov    -0x28(%ebp),%edi
+f0106c27:	83 c4 10             	add    $0x10,%esp
+f0106c2a:	39 fa                	cmp    %edi,%edx
+f0106c2c:	0f 8f 38 01 00 00    	jg     f0106d6a <debuginfo_eip+0x21f>
+    // stabs[lfun] points to the function name
+    // in the string table, but check bounds just in case.
+    if (stabs[lfun].n_strx < stabstr_end - stabstr)
+f0106c32:	8d 04 52             	lea    (%edx,%edx,2),%eax
+f0106c35:	8b 5d c4             	mov    -0x3c(%ebp),%ebx
+f0106c38:	8d 14 83             	lea    (%ebx,%eax,4),%edx
+f0106c3b:	8b 02                	mov    (%edx),%eax
+f0106c3d:	8b 4d c0             	mov    -0x40(%ebp),%ecx
+f0106c40:	8b 5d bc             	mov    -0x44(%ebp),%ebx
+f0106c43:	29 d9                	sub    %ebx,%ecx
+f0106c45:	39 c8                	cmp    %ecx,%eax
+f0106c47:	73 08                	jae    f0106c51 <debuginfo_eip+0x106>
+      info->eip_fn_name = stabstr + stabs[lfun].n_strx;
+f0106c49:	01 d8                	add    %ebx,%eax
+f0106c4b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f0106c4e:	89 43 08             	mov    %eax,0x8(%ebx)
+    info->eip_fn_addr = stabs[lfun].n_value;
+f0106c51:	8b 42 08             	mov    0x8(%edx),%eax
+    addr -= info->eip_fn_addr;
+f0106c54:	29 45 08             	sub    %eax,0x8(%ebp)
+    // Search within the function definition for the line number.
+    lline = lfun;
+    rline = rfun;
+f0106c57:	8b 55 b8             	mov    -0x48(%ebp),%edx
+f0106c5a:	89 fb                	mov    %edi,%ebx
+    info->eip_fn_addr = stabs[lfun].n_value;
+f0106c5c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+f0106c5f:	89 41 10             	mov    %eax,0x10(%ecx)
+    lline = lfun;
+f0106c62:	89 55 d4             	mov    %edx,-0x2c(%ebp)
+    rline = rfun;
+f0106c65:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+    info->eip_fn_addr = addr;
+    lline = lfile;
+    rline = rfile;
+  }
+  // Ignore stuff after the colon.
+  info->eip_fn_namelen = strfind(info->eip_fn_name, ':') - info->eip_fn_name;
+f0106c68:	83 ec 08             	sub    $0x8,%esp
+f0106c6b:	6a 3a                	push   $0x3a
+f0106c6d:	ff 71 08             	push   0x8(%ecx)
+f0106c70:	e8 eb 09 00 00       	call   f0107660 <strfind>
+f0106c75:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f0106c78:	2b 43 08             	sub    0x8(%ebx),%eax
+f0106c7b:	89 43 0c             	mov    %eax,0xc(%ebx)
+  // Hint:
+  //	There's a particular stabs type used for line numbers.
+  //	Look at the STABS documentation and <inc/stab.h> to find
+  //	which one.
+  // LAB 1: Your code here.
+    stab_binsearch(stabs, &lline, &rline, N_SLINE, addr);
+f0106c7e:	83 c4 08             	add    $0x8,%esp
+f0106c81:	ff 75 08             	push   0x8(%ebp)
+f0106c84:	6a 44                	push   $0x44
+f0106c86:	8d 4d d0             	lea    -0x30(%ebp),%ecx
+f0106c89:	8d 55 d4             	lea    -0x2c(%ebp),%edx
+f0106c8c:	8b 5d c4             	mov    -0x3c(%ebp),%ebx
+f0106c8f:	89 d8                	mov    %ebx,%eax
+f0106c91:	e8 b1 fd ff ff       	call   f0106a47 <stab_binsearch>
+    if (lline <= rline) {
+f0106c96:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+f0106c99:	83 c4 10             	add    $0x10,%esp
+f0106c9c:	3b 45 d0             	cmp    -0x30(%ebp),%eax
+f0106c9f:	7f 0e                	jg     f0106caf <debuginfo_eip+0x164>
+        info->eip_line = (stabs[lline].n_desc);
+f0106ca1:	8d 14 40             	lea    (%eax,%eax,2),%edx
+f0106ca4:	0f b7 54 93 06       	movzwl 0x6(%ebx,%edx,4),%edx
+f0106ca9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f0106cac:	89 53 04             	mov    %edx,0x4(%ebx)
+f0106caf:	89 c2                	mov    %eax,%edx
+f0106cb1:	8d 04 40             	lea    (%eax,%eax,2),%eax
+f0106cb4:	8b 5d c4             	mov    -0x3c(%ebp),%ebx
+f0106cb7:	8d 44 83 04          	lea    0x4(%ebx,%eax,4),%eax
+f0106cbb:	e9 ba 00 00 00       	jmp    f0106d7a <debuginfo_eip+0x22f>
+    if ( (user_mem_check(curenv, usd, sizeof(struct UserStabData), PTE_U | PTE_P) < 0) ) {
+f0106cc0:	e8 9a 0f 00 00       	call   f0107c5f <cpunum>
+f0106cc5:	6a 05                	push   $0x5
+f0106cc7:	6a 10                	push   $0x10
+f0106cc9:	68 00 00 20 00       	push   $0x200000
+f0106cce:	6b c0 74             	imul   $0x74,%eax,%eax
+f0106cd1:	ff b0 28 c0 79 f0    	push   -0xf863fd8(%eax)
+f0106cd7:	e8 9a cb ff ff       	call   f0103876 <user_mem_check>
+f0106cdc:	83 c4 10             	add    $0x10,%esp
+f0106cdf:	85 c0                	test   %eax,%eax
+f0106ce1:	0f 88 08 01 00 00    	js     f0106def <debuginfo_eip+0x2a4>
+    stabs = usd->stabs;
+f0106ce7:	8b 3d 00 00 20 00    	mov    0x200000,%edi
+f0106ced:	89 7d c4             	mov    %edi,-0x3c(%ebp)
+    stab_end = usd->stab_end;
+f0106cf0:	8b 35 04 00 20 00    	mov    0x200004,%esi
+    stabstr = usd->stabstr;
+f0106cf6:	8b 1d 08 00 20 00    	mov    0x200008,%ebx
+f0106cfc:	89 5d bc             	mov    %ebx,-0x44(%ebp)
+    stabstr_end = usd->stabstr_end;
+f0106cff:	8b 15 0c 00 20 00    	mov    0x20000c,%edx
+f0106d05:	89 55 c0             	mov    %edx,-0x40(%ebp)
+    if ( (user_mem_check(curenv, stabs, (size_t) (stab_end - stabs), PTE_U | PTE_P) < 0) ) {
+f0106d08:	e8 52 0f 00 00       	call   f0107c5f <cpunum>
+f0106d0d:	89 c2                	mov    %eax,%edx
+f0106d0f:	6a 05                	push   $0x5
+f0106d11:	89 f0                	mov    %esi,%eax
+f0106d13:	29 f8                	sub    %edi,%eax
+f0106d15:	c1 f8 02             	sar    $0x2,%eax
+f0106d18:	69 c0 ab aa aa aa    	imul   $0xaaaaaaab,%eax,%eax
+f0106d1e:	50                   	push   %eax
+f0106d1f:	57                   	push   %edi
+f0106d20:	6b d2 74             	imul   $0x74,%edx,%edx
+f0106d23:	ff b2 28 c0 79 f0    	push   -0xf863fd8(%edx)
+f0106d29:	e8 48 cb ff ff       	call   f0103876 <user_mem_check>
+f0106d2e:	83 c4 10             	add    $0x10,%esp
+f0106d31:	85 c0                	test   %eax,%eax
+f0106d33:	0f 88 bd 00 00 00    	js     f0106df6 <debuginfo_eip+0x2ab>
+    if ( (user_mem_check(curenv, stabstr, (size_t) (stabstr_end - stabstr), PTE_U | PTE_P) < 0) ) {
+f0106d39:	e8 21 0f 00 00       	call   f0107c5f <cpunum>
+f0106d3e:	6a 05                	push   $0x5
+f0106d40:	8b 55 c0             	mov    -0x40(%ebp),%edx
+f0106d43:	29 da                	sub    %ebx,%edx
+f0106d45:	52                   	push   %edx
+f0106d46:	53                   	push   %ebx
+f0106d47:	6b c0 74             	imul   $0x74,%eax,%eax
+f0106d4a:	ff b0 28 c0 79 f0    	push   -0xf863fd8(%eax)
+f0106d50:	e8 21 cb ff ff       	call   f0103876 <user_mem_check>
+f0106d55:	83 c4 10             	add    $0x10,%esp
+f0106d58:	85 c0                	test   %eax,%eax
+f0106d5a:	0f 89 45 fe ff ff    	jns    f0106ba5 <debuginfo_eip+0x5a>
+      return -1;
+f0106d60:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0106d65:	e9 ad 00 00 00       	jmp    f0106e17 <debuginfo_eip+0x2cc>
+f0106d6a:	8b 45 08             	mov    0x8(%ebp),%eax
+f0106d6d:	89 f2                	mov    %esi,%edx
+f0106d6f:	e9 e8 fe ff ff       	jmp    f0106c5c <debuginfo_eip+0x111>
+  // can interpolate code from a different file!
+  // Such included source files use the N_SOL stab type.
+  while (lline >= lfile
+         && stabs[lline].n_type != N_SOL
+         && (stabs[lline].n_type != N_SO || !stabs[lline].n_value))
+    lline--;
+f0106d74:	83 ea 01             	sub    $0x1,%edx
+f0106d77:	83 e8 0c             	sub    $0xc,%eax
+         && (stabs[lline].n_type != N_SO || !stabs[lline].n_value))
+f0106d7a:	39 d6                	cmp    %edx,%esi
+f0106d7c:	7f 34                	jg     f0106db2 <debuginfo_eip+0x267>
+         && stabs[lline].n_type != N_SOL
+f0106d7e:	0f b6 08             	movzbl (%eax),%ecx
+f0106d81:	80 f9 84             	cmp    $0x84,%cl
+f0106d84:	74 0b                	je     f0106d91 <debuginfo_eip+0x246>
+         && (stabs[lline].n_type != N_SO || !stabs[lline].n_value))
+f0106d86:	80 f9 64             	cmp    $0x64,%cl
+f0106d89:	75 e9                	jne    f0106d74 <debuginfo_eip+0x229>
+f0106d8b:	83 78 04 00          	cmpl   $0x0,0x4(%eax)
+f0106d8f:	74 e3                	je     f0106d74 <debuginfo_eip+0x229>
+  if (lline >= lfile && stabs[lline].n_strx < stabstr_end - stabstr)
+f0106d91:	8d 04 52             	lea    (%edx,%edx,2),%eax
+f0106d94:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+f0106d97:	8b 14 86             	mov    (%esi,%eax,4),%edx
+f0106d9a:	8b 45 c0             	mov    -0x40(%ebp),%eax
+f0106d9d:	8b 75 bc             	mov    -0x44(%ebp),%esi
+f0106da0:	29 f0                	sub    %esi,%eax
+f0106da2:	39 c2                	cmp    %eax,%edx
+f0106da4:	73 0c                	jae    f0106db2 <debuginfo_eip+0x267>
+    info->eip_file = stabstr + stabs[lline].n_strx;
+f0106da6:	8b 45 bc             	mov    -0x44(%ebp),%eax
+f0106da9:	01 d0                	add    %edx,%eax
+f0106dab:	89 c2                	mov    %eax,%edx
+f0106dad:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0106db0:	89 10                	mov    %edx,(%eax)
+    for (lline = lfun + 1;
+         lline < rfun && stabs[lline].n_type == N_PSYM;
+         lline++)
+      info->eip_fn_narg++;
+
+  return 0;
+f0106db2:	b8 00 00 00 00       	mov    $0x0,%eax
+  if (lfun < rfun)
+f0106db7:	8b 75 b8             	mov    -0x48(%ebp),%esi
+f0106dba:	39 fe                	cmp    %edi,%esi
+f0106dbc:	7d 59                	jge    f0106e17 <debuginfo_eip+0x2cc>
+    for (lline = lfun + 1;
+f0106dbe:	89 f0                	mov    %esi,%eax
+f0106dc0:	83 c0 01             	add    $0x1,%eax
+f0106dc3:	8d 14 40             	lea    (%eax,%eax,2),%edx
+f0106dc6:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+f0106dc9:	8d 54 96 04          	lea    0x4(%esi,%edx,4),%edx
+f0106dcd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f0106dd0:	eb 04                	jmp    f0106dd6 <debuginfo_eip+0x28b>
+      info->eip_fn_narg++;
+f0106dd2:	83 43 14 01          	addl   $0x1,0x14(%ebx)
+         lline < rfun && stabs[lline].n_type == N_PSYM;
+f0106dd6:	39 c7                	cmp    %eax,%edi
+f0106dd8:	7e 38                	jle    f0106e12 <debuginfo_eip+0x2c7>
+f0106dda:	0f b6 0a             	movzbl (%edx),%ecx
+f0106ddd:	83 c0 01             	add    $0x1,%eax
+f0106de0:	83 c2 0c             	add    $0xc,%edx
+f0106de3:	80 f9 a0             	cmp    $0xa0,%cl
+f0106de6:	74 ea                	je     f0106dd2 <debuginfo_eip+0x287>
+  return 0;
+f0106de8:	b8 00 00 00 00       	mov    $0x0,%eax
+f0106ded:	eb 28                	jmp    f0106e17 <debuginfo_eip+0x2cc>
+      return -1;
+f0106def:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0106df4:	eb 21                	jmp    f0106e17 <debuginfo_eip+0x2cc>
+      return -1;
+f0106df6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0106dfb:	eb 1a                	jmp    f0106e17 <debuginfo_eip+0x2cc>
+    return -1;
+f0106dfd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0106e02:	eb 13                	jmp    f0106e17 <debuginfo_eip+0x2cc>
+f0106e04:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0106e09:	eb 0c                	jmp    f0106e17 <debuginfo_eip+0x2cc>
+    return -1;
+f0106e0b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+f0106e10:	eb 05                	jmp    f0106e17 <debuginfo_eip+0x2cc>
+  return 0;
+f0106e12:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f0106e17:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0106e1a:	5b                   	pop    %ebx
+f0106e1b:	5e                   	pop    %esi
+f0106e1c:	5f                   	pop    %edi
+f0106e1d:	5d                   	pop    %ebp
+f0106e1e:	c3                   	ret
+
+f0106e1f <time_init>:
+static unsigned int ticks;
+
+void
+time_init(void)
+{
+  ticks = 0;
+f0106e1f:	c7 05 e4 ba 79 f0 00 	movl   $0x0,0xf079bae4
+f0106e26:	00 00 00 
+}
+f0106e29:	c3                   	ret
+
+f0106e2a <time_tick>:
+// This should be called once per timer interrupt.  A timer interrupt
+// fires every 10 ms.
+void
+time_tick(void)
+{
+  ticks++;
+f0106e2a:	a1 e4 ba 79 f0       	mov    0xf079bae4,%eax
+f0106e2f:	83 c0 01             	add    $0x1,%eax
+f0106e32:	a3 e4 ba 79 f0       	mov    %eax,0xf079bae4
+  if (ticks * 10 < ticks)
+f0106e37:	8d 14 80             	lea    (%eax,%eax,4),%edx
+f0106e3a:	01 d2                	add    %edx,%edx
+f0106e3c:	39 c2                	cmp    %eax,%edx
+f0106e3e:	72 01                	jb     f0106e41 <time_tick+0x17>
+f0106e40:	c3                   	ret
+{
+f0106e41:	55                   	push   %ebp
+f0106e42:	89 e5                	mov    %esp,%ebp
+f0106e44:	83 ec 0c             	sub    $0xc,%esp
+    panic("time_tick: time overflowed");
+f0106e47:	68 da 9e 10 f0       	push   $0xf0109eda
+f0106e4c:	6a 13                	push   $0x13
+f0106e4e:	68 f5 9e 10 f0       	push   $0xf0109ef5
+f0106e53:	e8 e8 91 ff ff       	call   f0100040 <_panic>
+
+f0106e58 <time_msec>:
+}
+
+unsigned int
+time_msec(void)
+{
+  return ticks * 10;
+f0106e58:	a1 e4 ba 79 f0       	mov    0xf079bae4,%eax
+f0106e5d:	8d 04 80             	lea    (%eax,%eax,4),%eax
+f0106e60:	01 c0                	add    %eax,%eax
+}
+f0106e62:	c3                   	ret
+
+f0106e63 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+f0106e63:	55                   	push   %ebp
+f0106e64:	89 e5                	mov    %esp,%ebp
+f0106e66:	57                   	push   %edi
+f0106e67:	56                   	push   %esi
+f0106e68:	53                   	push   %ebx
+f0106e69:	83 ec 1c             	sub    $0x1c,%esp
+f0106e6c:	89 c7                	mov    %eax,%edi
+f0106e6e:	89 d6                	mov    %edx,%esi
+f0106e70:	8b 45 08             	mov    0x8(%ebp),%eax
+f0106e73:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0106e76:	89 d1                	mov    %edx,%ecx
+f0106e78:	89 c2                	mov    %eax,%edx
+f0106e7a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+f0106e7d:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+f0106e80:	8b 45 10             	mov    0x10(%ebp),%eax
+f0106e83:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+f0106e86:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f0106e89:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+f0106e90:	39 c2                	cmp    %eax,%edx
+f0106e92:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+f0106e95:	72 3e                	jb     f0106ed5 <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+f0106e97:	83 ec 0c             	sub    $0xc,%esp
+f0106e9a:	ff 75 18             	push   0x18(%ebp)
+f0106e9d:	83 eb 01             	sub    $0x1,%ebx
+f0106ea0:	53                   	push   %ebx
+f0106ea1:	50                   	push   %eax
+f0106ea2:	83 ec 08             	sub    $0x8,%esp
+f0106ea5:	ff 75 e4             	push   -0x1c(%ebp)
+f0106ea8:	ff 75 e0             	push   -0x20(%ebp)
+f0106eab:	ff 75 dc             	push   -0x24(%ebp)
+f0106eae:	ff 75 d8             	push   -0x28(%ebp)
+f0106eb1:	e8 68 12 00 00       	call   f010811e <__udivdi3>
+f0106eb6:	83 c4 18             	add    $0x18,%esp
+f0106eb9:	52                   	push   %edx
+f0106eba:	50                   	push   %eax
+f0106ebb:	89 f2                	mov    %esi,%edx
+f0106ebd:	89 f8                	mov    %edi,%eax
+f0106ebf:	e8 9f ff ff ff       	call   f0106e63 <printnum>
+f0106ec4:	83 c4 20             	add    $0x20,%esp
+f0106ec7:	eb 13                	jmp    f0106edc <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+f0106ec9:	83 ec 08             	sub    $0x8,%esp
+f0106ecc:	56                   	push   %esi
+f0106ecd:	ff 75 18             	push   0x18(%ebp)
+f0106ed0:	ff d7                	call   *%edi
+f0106ed2:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+f0106ed5:	83 eb 01             	sub    $0x1,%ebx
+f0106ed8:	85 db                	test   %ebx,%ebx
+f0106eda:	7f ed                	jg     f0106ec9 <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+f0106edc:	83 ec 08             	sub    $0x8,%esp
+f0106edf:	56                   	push   %esi
+f0106ee0:	83 ec 04             	sub    $0x4,%esp
+f0106ee3:	ff 75 e4             	push   -0x1c(%ebp)
+f0106ee6:	ff 75 e0             	push   -0x20(%ebp)
+f0106ee9:	ff 75 dc             	push   -0x24(%ebp)
+f0106eec:	ff 75 d8             	push   -0x28(%ebp)
+f0106eef:	e8 4b 12 00 00       	call   f010813f <__umoddi3>
+f0106ef4:	83 c4 14             	add    $0x14,%esp
+f0106ef7:	0f be 80 01 9f 10 f0 	movsbl -0xfef60ff(%eax),%eax
+f0106efe:	50                   	push   %eax
+f0106eff:	ff d7                	call   *%edi
+}
+f0106f01:	83 c4 10             	add    $0x10,%esp
+f0106f04:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0106f07:	5b                   	pop    %ebx
+f0106f08:	5e                   	pop    %esi
+f0106f09:	5f                   	pop    %edi
+f0106f0a:	5d                   	pop    %ebp
+f0106f0b:	c3                   	ret
+
+f0106f0c <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+f0106f0c:	55                   	push   %ebp
+f0106f0d:	89 e5                	mov    %esp,%ebp
+f0106f0f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+f0106f12:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+f0106f16:	8b 10                	mov    (%eax),%edx
+f0106f18:	3b 50 04             	cmp    0x4(%eax),%edx
+f0106f1b:	73 0a                	jae    f0106f27 <sprintputch+0x1b>
+    *b->buf++ = ch;
+f0106f1d:	8d 4a 01             	lea    0x1(%edx),%ecx
+f0106f20:	89 08                	mov    %ecx,(%eax)
+f0106f22:	8b 45 08             	mov    0x8(%ebp),%eax
+f0106f25:	88 02                	mov    %al,(%edx)
+}
+f0106f27:	5d                   	pop    %ebp
+f0106f28:	c3                   	ret
+
+f0106f29 <printfmt>:
+{
+f0106f29:	55                   	push   %ebp
+f0106f2a:	89 e5                	mov    %esp,%ebp
+f0106f2c:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+f0106f2f:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+f0106f32:	50                   	push   %eax
+f0106f33:	ff 75 10             	push   0x10(%ebp)
+f0106f36:	ff 75 0c             	push   0xc(%ebp)
+f0106f39:	ff 75 08             	push   0x8(%ebp)
+f0106f3c:	e8 05 00 00 00       	call   f0106f46 <vprintfmt>
+}
+f0106f41:	83 c4 10             	add    $0x10,%esp
+f0106f44:	c9                   	leave
+f0106f45:	c3                   	ret
+
+f0106f46 <vprintfmt>:
+{
+f0106f46:	55                   	push   %ebp
+f0106f47:	89 e5                	mov    %esp,%ebp
+f0106f49:	57                   	push   %edi
+f0106f4a:	56                   	push   %esi
+f0106f4b:	53                   	push   %ebx
+f0106f4c:	83 ec 2c             	sub    $0x2c,%esp
+f0106f4f:	8b 75 08             	mov    0x8(%ebp),%esi
+f0106f52:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+f0106f55:	8b 7d 10             	mov    0x10(%ebp),%edi
+f0106f58:	eb 0a                	jmp    f0106f64 <vprintfmt+0x1e>
+      putch(ch, putdat);
+f0106f5a:	83 ec 08             	sub    $0x8,%esp
+f0106f5d:	53                   	push   %ebx
+f0106f5e:	50                   	push   %eax
+f0106f5f:	ff d6                	call   *%esi
+f0106f61:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+f0106f64:	83 c7 01             	add    $0x1,%edi
+f0106f67:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+f0106f6b:	83 f8 25             	cmp    $0x25,%eax
+f0106f6e:	74 0c                	je     f0106f7c <vprintfmt+0x36>
+      if (ch == '\0')
+f0106f70:	85 c0                	test   %eax,%eax
+f0106f72:	75 e6                	jne    f0106f5a <vprintfmt+0x14>
+}
+f0106f74:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0106f77:	5b                   	pop    %ebx
+f0106f78:	5e                   	pop    %esi
+f0106f79:	5f                   	pop    %edi
+f0106f7a:	5d                   	pop    %ebp
+f0106f7b:	c3                   	ret
+    padc = ' ';
+f0106f7c:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+f0106f80:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+f0106f87:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+f0106f8e:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+f0106f95:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+f0106f9a:	8d 47 01             	lea    0x1(%edi),%eax
+f0106f9d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f0106fa0:	0f b6 17             	movzbl (%edi),%edx
+f0106fa3:	8d 42 dd             	lea    -0x23(%edx),%eax
+f0106fa6:	3c 55                	cmp    $0x55,%al
+f0106fa8:	0f 87 cf 03 00 00    	ja     f010737d <vprintfmt+0x437>
+f0106fae:	0f b6 c0             	movzbl %al,%eax
+f0106fb1:	ff 24 85 40 a0 10 f0 	jmp    *-0xfef5fc0(,%eax,4)
+f0106fb8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+f0106fbb:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+f0106fbf:	eb d9                	jmp    f0106f9a <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+f0106fc1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+f0106fc4:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+f0106fc8:	eb d0                	jmp    f0106f9a <vprintfmt+0x54>
+f0106fca:	0f b6 d2             	movzbl %dl,%edx
+f0106fcd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+f0106fd0:	b8 00 00 00 00       	mov    $0x0,%eax
+f0106fd5:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+f0106fd8:	8d 04 80             	lea    (%eax,%eax,4),%eax
+f0106fdb:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+f0106fdf:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+f0106fe2:	8d 4a d0             	lea    -0x30(%edx),%ecx
+f0106fe5:	83 f9 09             	cmp    $0x9,%ecx
+f0106fe8:	77 55                	ja     f010703f <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+f0106fea:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+f0106fed:	eb e9                	jmp    f0106fd8 <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+f0106fef:	8b 45 14             	mov    0x14(%ebp),%eax
+f0106ff2:	8b 00                	mov    (%eax),%eax
+f0106ff4:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f0106ff7:	8b 45 14             	mov    0x14(%ebp),%eax
+f0106ffa:	8d 40 04             	lea    0x4(%eax),%eax
+f0106ffd:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+f0107000:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+f0107003:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+f0107007:	79 91                	jns    f0106f9a <vprintfmt+0x54>
+        width = precision, precision = -1;
+f0107009:	8b 45 d0             	mov    -0x30(%ebp),%eax
+f010700c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f010700f:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+f0107016:	eb 82                	jmp    f0106f9a <vprintfmt+0x54>
+      if (width < 0)
+f0107018:	8b 55 e0             	mov    -0x20(%ebp),%edx
+f010701b:	85 d2                	test   %edx,%edx
+f010701d:	b8 00 00 00 00       	mov    $0x0,%eax
+f0107022:	0f 49 c2             	cmovns %edx,%eax
+f0107025:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+f0107028:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+f010702b:	e9 6a ff ff ff       	jmp    f0106f9a <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+f0107030:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+f0107033:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+f010703a:	e9 5b ff ff ff       	jmp    f0106f9a <vprintfmt+0x54>
+f010703f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+f0107042:	89 45 d0             	mov    %eax,-0x30(%ebp)
+f0107045:	eb bc                	jmp    f0107003 <vprintfmt+0xbd>
+      lflag++;
+f0107047:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+f010704a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+f010704d:	e9 48 ff ff ff       	jmp    f0106f9a <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+f0107052:	8b 45 14             	mov    0x14(%ebp),%eax
+f0107055:	8d 78 04             	lea    0x4(%eax),%edi
+f0107058:	83 ec 08             	sub    $0x8,%esp
+f010705b:	53                   	push   %ebx
+f010705c:	ff 30                	push   (%eax)
+f010705e:	ff d6                	call   *%esi
+      break;
+f0107060:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+f0107063:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+f0107066:	e9 b1 02 00 00       	jmp    f010731c <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+f010706b:	8b 45 14             	mov    0x14(%ebp),%eax
+f010706e:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+f0107071:	8b 10                	mov    (%eax),%edx
+f0107073:	89 d0                	mov    %edx,%eax
+f0107075:	f7 d8                	neg    %eax
+f0107077:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+f010707a:	83 f8 10             	cmp    $0x10,%eax
+f010707d:	7f 23                	jg     f01070a2 <vprintfmt+0x15c>
+f010707f:	8b 14 85 a0 a1 10 f0 	mov    -0xfef5e60(,%eax,4),%edx
+f0107086:	85 d2                	test   %edx,%edx
+f0107088:	74 18                	je     f01070a2 <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+f010708a:	52                   	push   %edx
+f010708b:	68 55 96 10 f0       	push   $0xf0109655
+f0107090:	53                   	push   %ebx
+f0107091:	56                   	push   %esi
+f0107092:	e8 92 fe ff ff       	call   f0106f29 <printfmt>
+f0107097:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+f010709a:	89 7d 14             	mov    %edi,0x14(%ebp)
+f010709d:	e9 7a 02 00 00       	jmp    f010731c <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+f01070a2:	50                   	push   %eax
+f01070a3:	68 19 9f 10 f0       	push   $0xf0109f19
+f01070a8:	53                   	push   %ebx
+f01070a9:	56                   	push   %esi
+f01070aa:	e8 7a fe ff ff       	call   f0106f29 <printfmt>
+f01070af:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+f01070b2:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+f01070b5:	e9 62 02 00 00       	jmp    f010731c <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+f01070ba:	8b 45 14             	mov    0x14(%ebp),%eax
+f01070bd:	83 c0 04             	add    $0x4,%eax
+f01070c0:	89 45 c8             	mov    %eax,-0x38(%ebp)
+f01070c3:	8b 45 14             	mov    0x14(%ebp),%eax
+f01070c6:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+f01070c8:	85 c9                	test   %ecx,%ecx
+f01070ca:	b8 12 9f 10 f0       	mov    $0xf0109f12,%eax
+f01070cf:	0f 45 c1             	cmovne %ecx,%eax
+f01070d2:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+f01070d5:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+f01070d9:	7e 06                	jle    f01070e1 <vprintfmt+0x19b>
+f01070db:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+f01070df:	75 0b                	jne    f01070ec <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+f01070e1:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+f01070e4:	8b 7d d0             	mov    -0x30(%ebp),%edi
+f01070e7:	89 75 08             	mov    %esi,0x8(%ebp)
+f01070ea:	eb 5c                	jmp    f0107148 <vprintfmt+0x202>
+f01070ec:	83 ec 08             	sub    $0x8,%esp
+f01070ef:	ff 75 d0             	push   -0x30(%ebp)
+f01070f2:	ff 75 cc             	push   -0x34(%ebp)
+f01070f5:	e8 0e 04 00 00       	call   f0107508 <strnlen>
+f01070fa:	89 c2                	mov    %eax,%edx
+f01070fc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f01070ff:	29 d0                	sub    %edx,%eax
+f0107101:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+f0107104:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+f0107108:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f010710b:	89 75 08             	mov    %esi,0x8(%ebp)
+f010710e:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+f0107110:	eb 0e                	jmp    f0107120 <vprintfmt+0x1da>
+          putch(padc, putdat);
+f0107112:	83 ec 08             	sub    $0x8,%esp
+f0107115:	53                   	push   %ebx
+f0107116:	57                   	push   %edi
+f0107117:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+f010711a:	83 ee 01             	sub    $0x1,%esi
+f010711d:	83 c4 10             	add    $0x10,%esp
+f0107120:	85 f6                	test   %esi,%esi
+f0107122:	7f ee                	jg     f0107112 <vprintfmt+0x1cc>
+f0107124:	8b 45 e0             	mov    -0x20(%ebp),%eax
+f0107127:	8b 75 08             	mov    0x8(%ebp),%esi
+f010712a:	85 c0                	test   %eax,%eax
+f010712c:	ba 00 00 00 00       	mov    $0x0,%edx
+f0107131:	0f 49 d0             	cmovns %eax,%edx
+f0107134:	29 d0                	sub    %edx,%eax
+f0107136:	89 45 e0             	mov    %eax,-0x20(%ebp)
+f0107139:	eb a6                	jmp    f01070e1 <vprintfmt+0x19b>
+          putch(ch, putdat);
+f010713b:	83 ec 08             	sub    $0x8,%esp
+f010713e:	53                   	push   %ebx
+f010713f:	52                   	push   %edx
+f0107140:	ff 55 08             	call   *0x8(%ebp)
+f0107143:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+f0107146:	89 f1                	mov    %esi,%ecx
+f0107148:	8d 71 01             	lea    0x1(%ecx),%esi
+f010714b:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+f010714f:	0f be d0             	movsbl %al,%edx
+f0107152:	85 d2                	test   %edx,%edx
+f0107154:	74 28                	je     f010717e <vprintfmt+0x238>
+f0107156:	85 ff                	test   %edi,%edi
+f0107158:	78 05                	js     f010715f <vprintfmt+0x219>
+f010715a:	83 ef 01             	sub    $0x1,%edi
+f010715d:	78 30                	js     f010718f <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+f010715f:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+f0107163:	74 d6                	je     f010713b <vprintfmt+0x1f5>
+f0107165:	0f be c0             	movsbl %al,%eax
+f0107168:	83 e8 20             	sub    $0x20,%eax
+f010716b:	83 f8 5e             	cmp    $0x5e,%eax
+f010716e:	76 cb                	jbe    f010713b <vprintfmt+0x1f5>
+          putch('?', putdat);
+f0107170:	83 ec 08             	sub    $0x8,%esp
+f0107173:	53                   	push   %ebx
+f0107174:	6a 3f                	push   $0x3f
+f0107176:	ff 55 08             	call   *0x8(%ebp)
+f0107179:	83 c4 10             	add    $0x10,%esp
+f010717c:	eb c8                	jmp    f0107146 <vprintfmt+0x200>
+f010717e:	8b 75 08             	mov    0x8(%ebp),%esi
+f0107181:	8b 45 cc             	mov    -0x34(%ebp),%eax
+f0107184:	8b 55 e0             	mov    -0x20(%ebp),%edx
+f0107187:	01 d0                	add    %edx,%eax
+f0107189:	29 c8                	sub    %ecx,%eax
+f010718b:	89 c7                	mov    %eax,%edi
+f010718d:	eb 13                	jmp    f01071a2 <vprintfmt+0x25c>
+f010718f:	8b 75 08             	mov    0x8(%ebp),%esi
+f0107192:	eb ed                	jmp    f0107181 <vprintfmt+0x23b>
+        putch(' ', putdat);
+f0107194:	83 ec 08             	sub    $0x8,%esp
+f0107197:	53                   	push   %ebx
+f0107198:	6a 20                	push   $0x20
+f010719a:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+f010719c:	83 ef 01             	sub    $0x1,%edi
+f010719f:	83 c4 10             	add    $0x10,%esp
+f01071a2:	85 ff                	test   %edi,%edi
+f01071a4:	7f ee                	jg     f0107194 <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+f01071a6:	8b 45 c8             	mov    -0x38(%ebp),%eax
+f01071a9:	89 45 14             	mov    %eax,0x14(%ebp)
+f01071ac:	e9 6b 01 00 00       	jmp    f010731c <vprintfmt+0x3d6>
+  if (lflag >= 2)
+f01071b1:	83 f9 01             	cmp    $0x1,%ecx
+f01071b4:	7f 1f                	jg     f01071d5 <vprintfmt+0x28f>
+  else if (lflag)
+f01071b6:	85 c9                	test   %ecx,%ecx
+f01071b8:	74 67                	je     f0107221 <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+f01071ba:	8b 45 14             	mov    0x14(%ebp),%eax
+f01071bd:	8b 00                	mov    (%eax),%eax
+f01071bf:	89 45 d8             	mov    %eax,-0x28(%ebp)
+f01071c2:	89 c1                	mov    %eax,%ecx
+f01071c4:	c1 f9 1f             	sar    $0x1f,%ecx
+f01071c7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+f01071ca:	8b 45 14             	mov    0x14(%ebp),%eax
+f01071cd:	8d 40 04             	lea    0x4(%eax),%eax
+f01071d0:	89 45 14             	mov    %eax,0x14(%ebp)
+f01071d3:	eb 17                	jmp    f01071ec <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+f01071d5:	8b 45 14             	mov    0x14(%ebp),%eax
+f01071d8:	8b 50 04             	mov    0x4(%eax),%edx
+f01071db:	8b 00                	mov    (%eax),%eax
+f01071dd:	89 45 d8             	mov    %eax,-0x28(%ebp)
+f01071e0:	89 55 dc             	mov    %edx,-0x24(%ebp)
+f01071e3:	8b 45 14             	mov    0x14(%ebp),%eax
+f01071e6:	8d 40 08             	lea    0x8(%eax),%eax
+f01071e9:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+f01071ec:	8b 55 d8             	mov    -0x28(%ebp),%edx
+f01071ef:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+f01071f2:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+f01071f7:	85 c9                	test   %ecx,%ecx
+f01071f9:	0f 89 03 01 00 00    	jns    f0107302 <vprintfmt+0x3bc>
+        putch('-', putdat);
+f01071ff:	83 ec 08             	sub    $0x8,%esp
+f0107202:	53                   	push   %ebx
+f0107203:	6a 2d                	push   $0x2d
+f0107205:	ff d6                	call   *%esi
+        num = -(long long)num;
+f0107207:	8b 55 d8             	mov    -0x28(%ebp),%edx
+f010720a:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+f010720d:	f7 da                	neg    %edx
+f010720f:	83 d1 00             	adc    $0x0,%ecx
+f0107212:	f7 d9                	neg    %ecx
+f0107214:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+f0107217:	bf 0a 00 00 00       	mov    $0xa,%edi
+f010721c:	e9 e1 00 00 00       	jmp    f0107302 <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+f0107221:	8b 45 14             	mov    0x14(%ebp),%eax
+f0107224:	8b 00                	mov    (%eax),%eax
+f0107226:	89 45 d8             	mov    %eax,-0x28(%ebp)
+f0107229:	89 c1                	mov    %eax,%ecx
+f010722b:	c1 f9 1f             	sar    $0x1f,%ecx
+f010722e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+f0107231:	8b 45 14             	mov    0x14(%ebp),%eax
+f0107234:	8d 40 04             	lea    0x4(%eax),%eax
+f0107237:	89 45 14             	mov    %eax,0x14(%ebp)
+f010723a:	eb b0                	jmp    f01071ec <vprintfmt+0x2a6>
+  if (lflag >= 2)
+f010723c:	83 f9 01             	cmp    $0x1,%ecx
+f010723f:	7f 1e                	jg     f010725f <vprintfmt+0x319>
+  else if (lflag)
+f0107241:	85 c9                	test   %ecx,%ecx
+f0107243:	74 32                	je     f0107277 <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+f0107245:	8b 45 14             	mov    0x14(%ebp),%eax
+f0107248:	8b 10                	mov    (%eax),%edx
+f010724a:	b9 00 00 00 00       	mov    $0x0,%ecx
+f010724f:	8d 40 04             	lea    0x4(%eax),%eax
+f0107252:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+f0107255:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+f010725a:	e9 a3 00 00 00       	jmp    f0107302 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+f010725f:	8b 45 14             	mov    0x14(%ebp),%eax
+f0107262:	8b 10                	mov    (%eax),%edx
+f0107264:	8b 48 04             	mov    0x4(%eax),%ecx
+f0107267:	8d 40 08             	lea    0x8(%eax),%eax
+f010726a:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+f010726d:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+f0107272:	e9 8b 00 00 00       	jmp    f0107302 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+f0107277:	8b 45 14             	mov    0x14(%ebp),%eax
+f010727a:	8b 10                	mov    (%eax),%edx
+f010727c:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0107281:	8d 40 04             	lea    0x4(%eax),%eax
+f0107284:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+f0107287:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+f010728c:	eb 74                	jmp    f0107302 <vprintfmt+0x3bc>
+  if (lflag >= 2)
+f010728e:	83 f9 01             	cmp    $0x1,%ecx
+f0107291:	7f 1b                	jg     f01072ae <vprintfmt+0x368>
+  else if (lflag)
+f0107293:	85 c9                	test   %ecx,%ecx
+f0107295:	74 2c                	je     f01072c3 <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+f0107297:	8b 45 14             	mov    0x14(%ebp),%eax
+f010729a:	8b 10                	mov    (%eax),%edx
+f010729c:	b9 00 00 00 00       	mov    $0x0,%ecx
+f01072a1:	8d 40 04             	lea    0x4(%eax),%eax
+f01072a4:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+f01072a7:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+f01072ac:	eb 54                	jmp    f0107302 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+f01072ae:	8b 45 14             	mov    0x14(%ebp),%eax
+f01072b1:	8b 10                	mov    (%eax),%edx
+f01072b3:	8b 48 04             	mov    0x4(%eax),%ecx
+f01072b6:	8d 40 08             	lea    0x8(%eax),%eax
+f01072b9:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+f01072bc:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+f01072c1:	eb 3f                	jmp    f0107302 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+f01072c3:	8b 45 14             	mov    0x14(%ebp),%eax
+f01072c6:	8b 10                	mov    (%eax),%edx
+f01072c8:	b9 00 00 00 00       	mov    $0x0,%ecx
+f01072cd:	8d 40 04             	lea    0x4(%eax),%eax
+f01072d0:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+f01072d3:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+f01072d8:	eb 28                	jmp    f0107302 <vprintfmt+0x3bc>
+      putch('0', putdat);
+f01072da:	83 ec 08             	sub    $0x8,%esp
+f01072dd:	53                   	push   %ebx
+f01072de:	6a 30                	push   $0x30
+f01072e0:	ff d6                	call   *%esi
+      putch('x', putdat);
+f01072e2:	83 c4 08             	add    $0x8,%esp
+f01072e5:	53                   	push   %ebx
+f01072e6:	6a 78                	push   $0x78
+f01072e8:	ff d6                	call   *%esi
+      num = (unsigned long long)
+f01072ea:	8b 45 14             	mov    0x14(%ebp),%eax
+f01072ed:	8b 10                	mov    (%eax),%edx
+f01072ef:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+f01072f4:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+f01072f7:	8d 40 04             	lea    0x4(%eax),%eax
+f01072fa:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+f01072fd:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+f0107302:	83 ec 0c             	sub    $0xc,%esp
+f0107305:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+f0107309:	50                   	push   %eax
+f010730a:	ff 75 e0             	push   -0x20(%ebp)
+f010730d:	57                   	push   %edi
+f010730e:	51                   	push   %ecx
+f010730f:	52                   	push   %edx
+f0107310:	89 da                	mov    %ebx,%edx
+f0107312:	89 f0                	mov    %esi,%eax
+f0107314:	e8 4a fb ff ff       	call   f0106e63 <printnum>
+      break;
+f0107319:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+f010731c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+f010731f:	e9 40 fc ff ff       	jmp    f0106f64 <vprintfmt+0x1e>
+  if (lflag >= 2)
+f0107324:	83 f9 01             	cmp    $0x1,%ecx
+f0107327:	7f 1b                	jg     f0107344 <vprintfmt+0x3fe>
+  else if (lflag)
+f0107329:	85 c9                	test   %ecx,%ecx
+f010732b:	74 2c                	je     f0107359 <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+f010732d:	8b 45 14             	mov    0x14(%ebp),%eax
+f0107330:	8b 10                	mov    (%eax),%edx
+f0107332:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0107337:	8d 40 04             	lea    0x4(%eax),%eax
+f010733a:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+f010733d:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+f0107342:	eb be                	jmp    f0107302 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+f0107344:	8b 45 14             	mov    0x14(%ebp),%eax
+f0107347:	8b 10                	mov    (%eax),%edx
+f0107349:	8b 48 04             	mov    0x4(%eax),%ecx
+f010734c:	8d 40 08             	lea    0x8(%eax),%eax
+f010734f:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+f0107352:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+f0107357:	eb a9                	jmp    f0107302 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+f0107359:	8b 45 14             	mov    0x14(%ebp),%eax
+f010735c:	8b 10                	mov    (%eax),%edx
+f010735e:	b9 00 00 00 00       	mov    $0x0,%ecx
+f0107363:	8d 40 04             	lea    0x4(%eax),%eax
+f0107366:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+f0107369:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+f010736e:	eb 92                	jmp    f0107302 <vprintfmt+0x3bc>
+      putch(ch, putdat);
+f0107370:	83 ec 08             	sub    $0x8,%esp
+f0107373:	53                   	push   %ebx
+f0107374:	6a 25                	push   $0x25
+f0107376:	ff d6                	call   *%esi
+      break;
+f0107378:	83 c4 10             	add    $0x10,%esp
+f010737b:	eb 9f                	jmp    f010731c <vprintfmt+0x3d6>
+      putch('%', putdat);
+f010737d:	83 ec 08             	sub    $0x8,%esp
+f0107380:	53                   	push   %ebx
+f0107381:	6a 25                	push   $0x25
+f0107383:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+f0107385:	83 c4 10             	add    $0x10,%esp
+f0107388:	89 f8                	mov    %edi,%eax
+f010738a:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+f010738e:	74 05                	je     f0107395 <vprintfmt+0x44f>
+f0107390:	83 e8 01             	sub    $0x1,%eax
+f0107393:	eb f5                	jmp    f010738a <vprintfmt+0x444>
+f0107395:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f0107398:	eb 82                	jmp    f010731c <vprintfmt+0x3d6>
+
+f010739a <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+f010739a:	55                   	push   %ebp
+f010739b:	89 e5                	mov    %esp,%ebp
+f010739d:	83 ec 18             	sub    $0x18,%esp
+f01073a0:	8b 45 08             	mov    0x8(%ebp),%eax
+f01073a3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+f01073a6:	89 45 ec             	mov    %eax,-0x14(%ebp)
+f01073a9:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+f01073ad:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+f01073b0:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+f01073b7:	85 c0                	test   %eax,%eax
+f01073b9:	74 26                	je     f01073e1 <vsnprintf+0x47>
+f01073bb:	85 d2                	test   %edx,%edx
+f01073bd:	7e 22                	jle    f01073e1 <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+f01073bf:	ff 75 14             	push   0x14(%ebp)
+f01073c2:	ff 75 10             	push   0x10(%ebp)
+f01073c5:	8d 45 ec             	lea    -0x14(%ebp),%eax
+f01073c8:	50                   	push   %eax
+f01073c9:	68 0c 6f 10 f0       	push   $0xf0106f0c
+f01073ce:	e8 73 fb ff ff       	call   f0106f46 <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+f01073d3:	8b 45 ec             	mov    -0x14(%ebp),%eax
+f01073d6:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+f01073d9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+f01073dc:	83 c4 10             	add    $0x10,%esp
+}
+f01073df:	c9                   	leave
+f01073e0:	c3                   	ret
+    return -E_INVAL;
+f01073e1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+f01073e6:	eb f7                	jmp    f01073df <vsnprintf+0x45>
+
+f01073e8 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+f01073e8:	55                   	push   %ebp
+f01073e9:	89 e5                	mov    %esp,%ebp
+f01073eb:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+f01073ee:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+f01073f1:	50                   	push   %eax
+f01073f2:	ff 75 10             	push   0x10(%ebp)
+f01073f5:	ff 75 0c             	push   0xc(%ebp)
+f01073f8:	ff 75 08             	push   0x8(%ebp)
+f01073fb:	e8 9a ff ff ff       	call   f010739a <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+f0107400:	c9                   	leave
+f0107401:	c3                   	ret
+
+f0107402 <readline>:
+#define BUFLEN 1024
+static char buf[BUFLEN];
+
+char *
+readline(const char *prompt)
+{
+f0107402:	55                   	push   %ebp
+f0107403:	89 e5                	mov    %esp,%ebp
+f0107405:	57                   	push   %edi
+f0107406:	56                   	push   %esi
+f0107407:	53                   	push   %ebx
+f0107408:	83 ec 0c             	sub    $0xc,%esp
+f010740b:	8b 45 08             	mov    0x8(%ebp),%eax
+  int i, c, echoing;
+
+#if JOS_KERNEL
+  if (prompt != NULL)
+f010740e:	85 c0                	test   %eax,%eax
+f0107410:	74 11                	je     f0107423 <readline+0x21>
+    cprintf("%s", prompt);
+f0107412:	83 ec 08             	sub    $0x8,%esp
+f0107415:	50                   	push   %eax
+f0107416:	68 55 96 10 f0       	push   $0xf0109655
+f010741b:	e8 0c d0 ff ff       	call   f010442c <cprintf>
+f0107420:	83 c4 10             	add    $0x10,%esp
+  if (prompt != NULL)
+    fprintf(1, "%s", prompt);
+#endif
+
+  i = 0;
+  echoing = iscons(0);
+f0107423:	83 ec 0c             	sub    $0xc,%esp
+f0107426:	6a 00                	push   $0x0
+f0107428:	e8 83 93 ff ff       	call   f01007b0 <iscons>
+f010742d:	89 c7                	mov    %eax,%edi
+f010742f:	83 c4 10             	add    $0x10,%esp
+  i = 0;
+f0107432:	be 00 00 00 00       	mov    $0x0,%esi
+f0107437:	eb 4b                	jmp    f0107484 <readline+0x82>
+  while (1) {
+    c = getchar();
+    if (c < 0) {
+      if (c != -E_EOF)
+        cprintf("read error: %e\n", c);
+      return NULL;
+f0107439:	b8 00 00 00 00       	mov    $0x0,%eax
+      if (c != -E_EOF)
+f010743e:	83 fb f8             	cmp    $0xfffffff8,%ebx
+f0107441:	75 08                	jne    f010744b <readline+0x49>
+        cputchar('\n');
+      buf[i] = 0;
+      return buf;
+    }
+  }
+}
+f0107443:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0107446:	5b                   	pop    %ebx
+f0107447:	5e                   	pop    %esi
+f0107448:	5f                   	pop    %edi
+f0107449:	5d                   	pop    %ebp
+f010744a:	c3                   	ret
+        cprintf("read error: %e\n", c);
+f010744b:	83 ec 08             	sub    $0x8,%esp
+f010744e:	53                   	push   %ebx
+f010744f:	68 03 a2 10 f0       	push   $0xf010a203
+f0107454:	e8 d3 cf ff ff       	call   f010442c <cprintf>
+f0107459:	83 c4 10             	add    $0x10,%esp
+      return NULL;
+f010745c:	b8 00 00 00 00       	mov    $0x0,%eax
+f0107461:	eb e0                	jmp    f0107443 <readline+0x41>
+      if (echoing)
+f0107463:	85 ff                	test   %edi,%edi
+f0107465:	75 05                	jne    f010746c <readline+0x6a>
+      i--;
+f0107467:	83 ee 01             	sub    $0x1,%esi
+f010746a:	eb 18                	jmp    f0107484 <readline+0x82>
+        cputchar('\b');
+f010746c:	83 ec 0c             	sub    $0xc,%esp
+f010746f:	6a 08                	push   $0x8
+f0107471:	e8 16 93 ff ff       	call   f010078c <cputchar>
+f0107476:	83 c4 10             	add    $0x10,%esp
+f0107479:	eb ec                	jmp    f0107467 <readline+0x65>
+      buf[i++] = c;
+f010747b:	88 9e 00 bb 79 f0    	mov    %bl,-0xf864500(%esi)
+f0107481:	8d 76 01             	lea    0x1(%esi),%esi
+    c = getchar();
+f0107484:	e8 16 93 ff ff       	call   f010079f <getchar>
+f0107489:	89 c3                	mov    %eax,%ebx
+    if (c < 0) {
+f010748b:	85 c0                	test   %eax,%eax
+f010748d:	78 aa                	js     f0107439 <readline+0x37>
+    } else if ((c == '\b' || c == '\x7f') && i > 0) {
+f010748f:	83 f8 08             	cmp    $0x8,%eax
+f0107492:	0f 94 c0             	sete   %al
+f0107495:	83 fb 7f             	cmp    $0x7f,%ebx
+f0107498:	0f 94 c2             	sete   %dl
+f010749b:	08 d0                	or     %dl,%al
+f010749d:	74 04                	je     f01074a3 <readline+0xa1>
+f010749f:	85 f6                	test   %esi,%esi
+f01074a1:	7f c0                	jg     f0107463 <readline+0x61>
+    } else if (c >= ' ' && i < BUFLEN-1) {
+f01074a3:	83 fb 1f             	cmp    $0x1f,%ebx
+f01074a6:	7e 1a                	jle    f01074c2 <readline+0xc0>
+f01074a8:	81 fe fe 03 00 00    	cmp    $0x3fe,%esi
+f01074ae:	7f 12                	jg     f01074c2 <readline+0xc0>
+      if (echoing)
+f01074b0:	85 ff                	test   %edi,%edi
+f01074b2:	74 c7                	je     f010747b <readline+0x79>
+        cputchar(c);
+f01074b4:	83 ec 0c             	sub    $0xc,%esp
+f01074b7:	53                   	push   %ebx
+f01074b8:	e8 cf 92 ff ff       	call   f010078c <cputchar>
+f01074bd:	83 c4 10             	add    $0x10,%esp
+f01074c0:	eb b9                	jmp    f010747b <readline+0x79>
+    } else if (c == '\n' || c == '\r') {
+f01074c2:	83 fb 0a             	cmp    $0xa,%ebx
+f01074c5:	74 05                	je     f01074cc <readline+0xca>
+f01074c7:	83 fb 0d             	cmp    $0xd,%ebx
+f01074ca:	75 b8                	jne    f0107484 <readline+0x82>
+      if (echoing)
+f01074cc:	85 ff                	test   %edi,%edi
+f01074ce:	75 11                	jne    f01074e1 <readline+0xdf>
+      buf[i] = 0;
+f01074d0:	c6 86 00 bb 79 f0 00 	movb   $0x0,-0xf864500(%esi)
+      return buf;
+f01074d7:	b8 00 bb 79 f0       	mov    $0xf079bb00,%eax
+f01074dc:	e9 62 ff ff ff       	jmp    f0107443 <readline+0x41>
+        cputchar('\n');
+f01074e1:	83 ec 0c             	sub    $0xc,%esp
+f01074e4:	6a 0a                	push   $0xa
+f01074e6:	e8 a1 92 ff ff       	call   f010078c <cputchar>
+f01074eb:	83 c4 10             	add    $0x10,%esp
+f01074ee:	eb e0                	jmp    f01074d0 <readline+0xce>
+
+f01074f0 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+f01074f0:	55                   	push   %ebp
+f01074f1:	89 e5                	mov    %esp,%ebp
+f01074f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+f01074f6:	b8 00 00 00 00       	mov    $0x0,%eax
+f01074fb:	eb 03                	jmp    f0107500 <strlen+0x10>
+    n++;
+f01074fd:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+f0107500:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+f0107504:	75 f7                	jne    f01074fd <strlen+0xd>
+  return n;
+}
+f0107506:	5d                   	pop    %ebp
+f0107507:	c3                   	ret
+
+f0107508 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+f0107508:	55                   	push   %ebp
+f0107509:	89 e5                	mov    %esp,%ebp
+f010750b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+f010750e:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0107511:	b8 00 00 00 00       	mov    $0x0,%eax
+f0107516:	eb 03                	jmp    f010751b <strnlen+0x13>
+    n++;
+f0107518:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+f010751b:	39 d0                	cmp    %edx,%eax
+f010751d:	74 08                	je     f0107527 <strnlen+0x1f>
+f010751f:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+f0107523:	75 f3                	jne    f0107518 <strnlen+0x10>
+f0107525:	89 c2                	mov    %eax,%edx
+  return n;
+}
+f0107527:	89 d0                	mov    %edx,%eax
+f0107529:	5d                   	pop    %ebp
+f010752a:	c3                   	ret
+
+f010752b <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+f010752b:	55                   	push   %ebp
+f010752c:	89 e5                	mov    %esp,%ebp
+f010752e:	53                   	push   %ebx
+f010752f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f0107532:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+f0107535:	b8 00 00 00 00       	mov    $0x0,%eax
+f010753a:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+f010753e:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+f0107541:	83 c0 01             	add    $0x1,%eax
+f0107544:	84 d2                	test   %dl,%dl
+f0107546:	75 f2                	jne    f010753a <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+f0107548:	89 c8                	mov    %ecx,%eax
+f010754a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f010754d:	c9                   	leave
+f010754e:	c3                   	ret
+
+f010754f <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+f010754f:	55                   	push   %ebp
+f0107550:	89 e5                	mov    %esp,%ebp
+f0107552:	53                   	push   %ebx
+f0107553:	83 ec 10             	sub    $0x10,%esp
+f0107556:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+f0107559:	53                   	push   %ebx
+f010755a:	e8 91 ff ff ff       	call   f01074f0 <strlen>
+f010755f:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+f0107562:	ff 75 0c             	push   0xc(%ebp)
+f0107565:	01 d8                	add    %ebx,%eax
+f0107567:	50                   	push   %eax
+f0107568:	e8 be ff ff ff       	call   f010752b <strcpy>
+  return dst;
+}
+f010756d:	89 d8                	mov    %ebx,%eax
+f010756f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0107572:	c9                   	leave
+f0107573:	c3                   	ret
+
+f0107574 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+f0107574:	55                   	push   %ebp
+f0107575:	89 e5                	mov    %esp,%ebp
+f0107577:	56                   	push   %esi
+f0107578:	53                   	push   %ebx
+f0107579:	8b 75 08             	mov    0x8(%ebp),%esi
+f010757c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+f010757f:	89 f3                	mov    %esi,%ebx
+f0107581:	03 5d 10             	add    0x10(%ebp),%ebx
+f0107584:	89 f0                	mov    %esi,%eax
+f0107586:	eb 0f                	jmp    f0107597 <strncpy+0x23>
+    *dst++ = *src;
+f0107588:	83 c0 01             	add    $0x1,%eax
+f010758b:	0f b6 0a             	movzbl (%edx),%ecx
+f010758e:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+f0107591:	80 f9 01             	cmp    $0x1,%cl
+f0107594:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+f0107597:	39 d8                	cmp    %ebx,%eax
+f0107599:	75 ed                	jne    f0107588 <strncpy+0x14>
+  }
+  return ret;
+}
+f010759b:	89 f0                	mov    %esi,%eax
+f010759d:	5b                   	pop    %ebx
+f010759e:	5e                   	pop    %esi
+f010759f:	5d                   	pop    %ebp
+f01075a0:	c3                   	ret
+
+f01075a1 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+f01075a1:	55                   	push   %ebp
+f01075a2:	89 e5                	mov    %esp,%ebp
+f01075a4:	56                   	push   %esi
+f01075a5:	53                   	push   %ebx
+f01075a6:	8b 75 08             	mov    0x8(%ebp),%esi
+f01075a9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+f01075ac:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+f01075af:	89 f0                	mov    %esi,%eax
+f01075b1:	85 d2                	test   %edx,%edx
+f01075b3:	74 21                	je     f01075d6 <strlcpy+0x35>
+f01075b5:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+f01075b9:	89 f2                	mov    %esi,%edx
+f01075bb:	eb 09                	jmp    f01075c6 <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+f01075bd:	83 c1 01             	add    $0x1,%ecx
+f01075c0:	83 c2 01             	add    $0x1,%edx
+f01075c3:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+f01075c6:	39 c2                	cmp    %eax,%edx
+f01075c8:	74 09                	je     f01075d3 <strlcpy+0x32>
+f01075ca:	0f b6 19             	movzbl (%ecx),%ebx
+f01075cd:	84 db                	test   %bl,%bl
+f01075cf:	75 ec                	jne    f01075bd <strlcpy+0x1c>
+f01075d1:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+f01075d3:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+f01075d6:	29 f0                	sub    %esi,%eax
+}
+f01075d8:	5b                   	pop    %ebx
+f01075d9:	5e                   	pop    %esi
+f01075da:	5d                   	pop    %ebp
+f01075db:	c3                   	ret
+
+f01075dc <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+f01075dc:	55                   	push   %ebp
+f01075dd:	89 e5                	mov    %esp,%ebp
+f01075df:	8b 4d 08             	mov    0x8(%ebp),%ecx
+f01075e2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+f01075e5:	eb 06                	jmp    f01075ed <strcmp+0x11>
+    p++, q++;
+f01075e7:	83 c1 01             	add    $0x1,%ecx
+f01075ea:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+f01075ed:	0f b6 01             	movzbl (%ecx),%eax
+f01075f0:	84 c0                	test   %al,%al
+f01075f2:	74 04                	je     f01075f8 <strcmp+0x1c>
+f01075f4:	3a 02                	cmp    (%edx),%al
+f01075f6:	74 ef                	je     f01075e7 <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+f01075f8:	0f b6 c0             	movzbl %al,%eax
+f01075fb:	0f b6 12             	movzbl (%edx),%edx
+f01075fe:	29 d0                	sub    %edx,%eax
+}
+f0107600:	5d                   	pop    %ebp
+f0107601:	c3                   	ret
+
+f0107602 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+f0107602:	55                   	push   %ebp
+f0107603:	89 e5                	mov    %esp,%ebp
+f0107605:	53                   	push   %ebx
+f0107606:	8b 45 08             	mov    0x8(%ebp),%eax
+f0107609:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+f010760c:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+f010760f:	eb 09                	jmp    f010761a <strncmp+0x18>
+    n--, p++, q++;
+f0107611:	83 ea 01             	sub    $0x1,%edx
+f0107614:	83 c0 01             	add    $0x1,%eax
+f0107617:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+f010761a:	85 d2                	test   %edx,%edx
+f010761c:	74 18                	je     f0107636 <strncmp+0x34>
+f010761e:	0f b6 18             	movzbl (%eax),%ebx
+f0107621:	84 db                	test   %bl,%bl
+f0107623:	74 04                	je     f0107629 <strncmp+0x27>
+f0107625:	3a 19                	cmp    (%ecx),%bl
+f0107627:	74 e8                	je     f0107611 <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+f0107629:	0f b6 00             	movzbl (%eax),%eax
+f010762c:	0f b6 11             	movzbl (%ecx),%edx
+f010762f:	29 d0                	sub    %edx,%eax
+}
+f0107631:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+f0107634:	c9                   	leave
+f0107635:	c3                   	ret
+    return 0;
+f0107636:	b8 00 00 00 00       	mov    $0x0,%eax
+f010763b:	eb f4                	jmp    f0107631 <strncmp+0x2f>
+
+f010763d <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+f010763d:	55                   	push   %ebp
+f010763e:	89 e5                	mov    %esp,%ebp
+f0107640:	8b 45 08             	mov    0x8(%ebp),%eax
+f0107643:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+f0107647:	eb 03                	jmp    f010764c <strchr+0xf>
+f0107649:	83 c0 01             	add    $0x1,%eax
+f010764c:	0f b6 10             	movzbl (%eax),%edx
+f010764f:	84 d2                	test   %dl,%dl
+f0107651:	74 06                	je     f0107659 <strchr+0x1c>
+    if (*s == c)
+f0107653:	38 ca                	cmp    %cl,%dl
+f0107655:	75 f2                	jne    f0107649 <strchr+0xc>
+f0107657:	eb 05                	jmp    f010765e <strchr+0x21>
+      return (char*)s;
+  return 0;
+f0107659:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f010765e:	5d                   	pop    %ebp
+f010765f:	c3                   	ret
+
+f0107660 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+f0107660:	55                   	push   %ebp
+f0107661:	89 e5                	mov    %esp,%ebp
+f0107663:	8b 45 08             	mov    0x8(%ebp),%eax
+f0107666:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+f010766a:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+f010766d:	38 ca                	cmp    %cl,%dl
+f010766f:	74 09                	je     f010767a <strfind+0x1a>
+f0107671:	84 d2                	test   %dl,%dl
+f0107673:	74 05                	je     f010767a <strfind+0x1a>
+  for (; *s; s++)
+f0107675:	83 c0 01             	add    $0x1,%eax
+f0107678:	eb f0                	jmp    f010766a <strfind+0xa>
+      break;
+  return (char*)s;
+}
+f010767a:	5d                   	pop    %ebp
+f010767b:	c3                   	ret
+
+f010767c <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+f010767c:	55                   	push   %ebp
+f010767d:	89 e5                	mov    %esp,%ebp
+f010767f:	57                   	push   %edi
+f0107680:	8b 7d 08             	mov    0x8(%ebp),%edi
+f0107683:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+f0107686:	85 c9                	test   %ecx,%ecx
+f0107688:	74 20                	je     f01076aa <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+f010768a:	89 f8                	mov    %edi,%eax
+f010768c:	09 c8                	or     %ecx,%eax
+f010768e:	a8 03                	test   $0x3,%al
+f0107690:	75 12                	jne    f01076a4 <memset+0x28>
+    c &= 0xFF;
+f0107692:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+f0107696:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+f010769c:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+f010769f:	fc                   	cld
+f01076a0:	f3 ab                	rep stos %eax,%es:(%edi)
+f01076a2:	eb 06                	jmp    f01076aa <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+f01076a4:	8b 45 0c             	mov    0xc(%ebp),%eax
+f01076a7:	fc                   	cld
+f01076a8:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+f01076aa:	89 f8                	mov    %edi,%eax
+f01076ac:	8b 7d fc             	mov    -0x4(%ebp),%edi
+f01076af:	c9                   	leave
+f01076b0:	c3                   	ret
+
+f01076b1 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+f01076b1:	55                   	push   %ebp
+f01076b2:	89 e5                	mov    %esp,%ebp
+f01076b4:	57                   	push   %edi
+f01076b5:	56                   	push   %esi
+f01076b6:	8b 45 08             	mov    0x8(%ebp),%eax
+f01076b9:	8b 75 0c             	mov    0xc(%ebp),%esi
+f01076bc:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+f01076bf:	39 c6                	cmp    %eax,%esi
+f01076c1:	73 32                	jae    f01076f5 <memmove+0x44>
+f01076c3:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+f01076c6:	39 d0                	cmp    %edx,%eax
+f01076c8:	73 2b                	jae    f01076f5 <memmove+0x44>
+    s += n;
+    d += n;
+f01076ca:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+f01076cd:	89 d6                	mov    %edx,%esi
+f01076cf:	09 fe                	or     %edi,%esi
+f01076d1:	09 ce                	or     %ecx,%esi
+f01076d3:	f7 c6 03 00 00 00    	test   $0x3,%esi
+f01076d9:	75 0e                	jne    f01076e9 <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+f01076db:	83 ef 04             	sub    $0x4,%edi
+f01076de:	8d 72 fc             	lea    -0x4(%edx),%esi
+f01076e1:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+f01076e4:	fd                   	std
+f01076e5:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+f01076e7:	eb 09                	jmp    f01076f2 <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+f01076e9:	83 ef 01             	sub    $0x1,%edi
+f01076ec:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+f01076ef:	fd                   	std
+f01076f0:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+f01076f2:	fc                   	cld
+f01076f3:	eb 1a                	jmp    f010770f <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+f01076f5:	89 f2                	mov    %esi,%edx
+f01076f7:	09 c2                	or     %eax,%edx
+f01076f9:	09 ca                	or     %ecx,%edx
+f01076fb:	f6 c2 03             	test   $0x3,%dl
+f01076fe:	75 0a                	jne    f010770a <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+f0107700:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+f0107703:	89 c7                	mov    %eax,%edi
+f0107705:	fc                   	cld
+f0107706:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+f0107708:	eb 05                	jmp    f010770f <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+f010770a:	89 c7                	mov    %eax,%edi
+f010770c:	fc                   	cld
+f010770d:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+f010770f:	5e                   	pop    %esi
+f0107710:	5f                   	pop    %edi
+f0107711:	5d                   	pop    %ebp
+f0107712:	c3                   	ret
+
+f0107713 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+f0107713:	55                   	push   %ebp
+f0107714:	89 e5                	mov    %esp,%ebp
+f0107716:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+f0107719:	ff 75 10             	push   0x10(%ebp)
+f010771c:	ff 75 0c             	push   0xc(%ebp)
+f010771f:	ff 75 08             	push   0x8(%ebp)
+f0107722:	e8 8a ff ff ff       	call   f01076b1 <memmove>
+}
+f0107727:	c9                   	leave
+f0107728:	c3                   	ret
+
+f0107729 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+f0107729:	55                   	push   %ebp
+f010772a:	89 e5                	mov    %esp,%ebp
+f010772c:	56                   	push   %esi
+f010772d:	53                   	push   %ebx
+f010772e:	8b 45 08             	mov    0x8(%ebp),%eax
+f0107731:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+f0107734:	89 c6                	mov    %eax,%esi
+f0107736:	03 75 10             	add    0x10(%ebp),%esi
+f0107739:	eb 06                	jmp    f0107741 <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+f010773b:	83 c0 01             	add    $0x1,%eax
+f010773e:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+f0107741:	39 f0                	cmp    %esi,%eax
+f0107743:	74 14                	je     f0107759 <memcmp+0x30>
+    if (*s1 != *s2)
+f0107745:	0f b6 08             	movzbl (%eax),%ecx
+f0107748:	0f b6 1a             	movzbl (%edx),%ebx
+f010774b:	38 d9                	cmp    %bl,%cl
+f010774d:	74 ec                	je     f010773b <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+f010774f:	0f b6 c1             	movzbl %cl,%eax
+f0107752:	0f b6 db             	movzbl %bl,%ebx
+f0107755:	29 d8                	sub    %ebx,%eax
+f0107757:	eb 05                	jmp    f010775e <memcmp+0x35>
+  }
+
+  return 0;
+f0107759:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+f010775e:	5b                   	pop    %ebx
+f010775f:	5e                   	pop    %esi
+f0107760:	5d                   	pop    %ebp
+f0107761:	c3                   	ret
+
+f0107762 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+f0107762:	55                   	push   %ebp
+f0107763:	89 e5                	mov    %esp,%ebp
+f0107765:	8b 45 08             	mov    0x8(%ebp),%eax
+f0107768:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+f010776b:	89 c2                	mov    %eax,%edx
+f010776d:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+f0107770:	eb 03                	jmp    f0107775 <memfind+0x13>
+f0107772:	83 c0 01             	add    $0x1,%eax
+f0107775:	39 d0                	cmp    %edx,%eax
+f0107777:	73 04                	jae    f010777d <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+f0107779:	38 08                	cmp    %cl,(%eax)
+f010777b:	75 f5                	jne    f0107772 <memfind+0x10>
+      break;
+  return (void*)s;
+}
+f010777d:	5d                   	pop    %ebp
+f010777e:	c3                   	ret
+
+f010777f <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+f010777f:	55                   	push   %ebp
+f0107780:	89 e5                	mov    %esp,%ebp
+f0107782:	57                   	push   %edi
+f0107783:	56                   	push   %esi
+f0107784:	53                   	push   %ebx
+f0107785:	8b 55 08             	mov    0x8(%ebp),%edx
+f0107788:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+f010778b:	eb 03                	jmp    f0107790 <strtol+0x11>
+    s++;
+f010778d:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+f0107790:	0f b6 02             	movzbl (%edx),%eax
+f0107793:	3c 20                	cmp    $0x20,%al
+f0107795:	74 f6                	je     f010778d <strtol+0xe>
+f0107797:	3c 09                	cmp    $0x9,%al
+f0107799:	74 f2                	je     f010778d <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+f010779b:	3c 2b                	cmp    $0x2b,%al
+f010779d:	74 2a                	je     f01077c9 <strtol+0x4a>
+  int neg = 0;
+f010779f:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+f01077a4:	3c 2d                	cmp    $0x2d,%al
+f01077a6:	74 2b                	je     f01077d3 <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+f01077a8:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+f01077ae:	75 0f                	jne    f01077bf <strtol+0x40>
+f01077b0:	80 3a 30             	cmpb   $0x30,(%edx)
+f01077b3:	74 28                	je     f01077dd <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+f01077b5:	85 db                	test   %ebx,%ebx
+f01077b7:	b8 0a 00 00 00       	mov    $0xa,%eax
+f01077bc:	0f 44 d8             	cmove  %eax,%ebx
+f01077bf:	b9 00 00 00 00       	mov    $0x0,%ecx
+f01077c4:	89 5d 10             	mov    %ebx,0x10(%ebp)
+f01077c7:	eb 46                	jmp    f010780f <strtol+0x90>
+    s++;
+f01077c9:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+f01077cc:	bf 00 00 00 00       	mov    $0x0,%edi
+f01077d1:	eb d5                	jmp    f01077a8 <strtol+0x29>
+    s++, neg = 1;
+f01077d3:	83 c2 01             	add    $0x1,%edx
+f01077d6:	bf 01 00 00 00       	mov    $0x1,%edi
+f01077db:	eb cb                	jmp    f01077a8 <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+f01077dd:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+f01077e1:	74 0e                	je     f01077f1 <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+f01077e3:	85 db                	test   %ebx,%ebx
+f01077e5:	75 d8                	jne    f01077bf <strtol+0x40>
+    s++, base = 8;
+f01077e7:	83 c2 01             	add    $0x1,%edx
+f01077ea:	bb 08 00 00 00       	mov    $0x8,%ebx
+f01077ef:	eb ce                	jmp    f01077bf <strtol+0x40>
+    s += 2, base = 16;
+f01077f1:	83 c2 02             	add    $0x2,%edx
+f01077f4:	bb 10 00 00 00       	mov    $0x10,%ebx
+f01077f9:	eb c4                	jmp    f01077bf <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+f01077fb:	0f be c0             	movsbl %al,%eax
+f01077fe:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+f0107801:	3b 45 10             	cmp    0x10(%ebp),%eax
+f0107804:	7d 3a                	jge    f0107840 <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+f0107806:	83 c2 01             	add    $0x1,%edx
+f0107809:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+f010780d:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+f010780f:	0f b6 02             	movzbl (%edx),%eax
+f0107812:	8d 70 d0             	lea    -0x30(%eax),%esi
+f0107815:	89 f3                	mov    %esi,%ebx
+f0107817:	80 fb 09             	cmp    $0x9,%bl
+f010781a:	76 df                	jbe    f01077fb <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+f010781c:	8d 70 9f             	lea    -0x61(%eax),%esi
+f010781f:	89 f3                	mov    %esi,%ebx
+f0107821:	80 fb 19             	cmp    $0x19,%bl
+f0107824:	77 08                	ja     f010782e <strtol+0xaf>
+      dig = *s - 'a' + 10;
+f0107826:	0f be c0             	movsbl %al,%eax
+f0107829:	83 e8 57             	sub    $0x57,%eax
+f010782c:	eb d3                	jmp    f0107801 <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+f010782e:	8d 70 bf             	lea    -0x41(%eax),%esi
+f0107831:	89 f3                	mov    %esi,%ebx
+f0107833:	80 fb 19             	cmp    $0x19,%bl
+f0107836:	77 08                	ja     f0107840 <strtol+0xc1>
+      dig = *s - 'A' + 10;
+f0107838:	0f be c0             	movsbl %al,%eax
+f010783b:	83 e8 37             	sub    $0x37,%eax
+f010783e:	eb c1                	jmp    f0107801 <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+f0107840:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+f0107844:	74 05                	je     f010784b <strtol+0xcc>
+    *endptr = (char*)s;
+f0107846:	8b 45 0c             	mov    0xc(%ebp),%eax
+f0107849:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+f010784b:	89 c8                	mov    %ecx,%eax
+f010784d:	f7 d8                	neg    %eax
+f010784f:	85 ff                	test   %edi,%edi
+f0107851:	0f 45 c8             	cmovne %eax,%ecx
+}
+f0107854:	89 c8                	mov    %ecx,%eax
+f0107856:	5b                   	pop    %ebx
+f0107857:	5e                   	pop    %esi
+f0107858:	5f                   	pop    %edi
+f0107859:	5d                   	pop    %ebp
+f010785a:	c3                   	ret
+f010785b:	90                   	nop
+
+f010785c <mpentry_start>:
+.set PROT_MODE_DSEG, 0x10	# kernel data segment selector
+
+.code16           
+.globl mpentry_start
+mpentry_start:
+	cli            
+f010785c:	fa                   	cli
+
+	xorw    %ax, %ax
+f010785d:	31 c0                	xor    %eax,%eax
+	movw    %ax, %ds
+f010785f:	8e d8                	mov    %eax,%ds
+	movw    %ax, %es
+f0107861:	8e c0                	mov    %eax,%es
+	movw    %ax, %ss
+f0107863:	8e d0                	mov    %eax,%ss
+
+	lgdt    MPBOOTPHYS(gdtdesc)
+f0107865:	0f 01 16             	lgdtl  (%esi)
+f0107868:	74 70                	je     f01078da <mpsearch1+0x3>
+	movl    %cr0, %eax
+f010786a:	0f 20 c0             	mov    %cr0,%eax
+	orl     $CR0_PE, %eax
+f010786d:	66 83 c8 01          	or     $0x1,%ax
+	movl    %eax, %cr0
+f0107871:	0f 22 c0             	mov    %eax,%cr0
+
+	ljmpl   $(PROT_MODE_CSEG), $(MPBOOTPHYS(start32))
+f0107874:	66 ea 20 70 00 00    	ljmpw  $0x0,$0x7020
+f010787a:	08 00                	or     %al,(%eax)
+
+f010787c <start32>:
+
+.code32
+start32:
+	movw    $(PROT_MODE_DSEG), %ax
+f010787c:	66 b8 10 00          	mov    $0x10,%ax
+	movw    %ax, %ds
+f0107880:	8e d8                	mov    %eax,%ds
+	movw    %ax, %es
+f0107882:	8e c0                	mov    %eax,%es
+	movw    %ax, %ss
+f0107884:	8e d0                	mov    %eax,%ss
+	movw    $0, %ax
+f0107886:	66 b8 00 00          	mov    $0x0,%ax
+	movw    %ax, %fs
+f010788a:	8e e0                	mov    %eax,%fs
+	movw    %ax, %gs
+f010788c:	8e e8                	mov    %eax,%gs
+
+	# Set up initial page table. We cannot use kern_pgdir yet because
+	# we are still running at a low EIP.
+	movl    $(RELOC(entry_pgdir)), %eax
+f010788e:	b8 00 30 11 00       	mov    $0x113000,%eax
+	movl    %eax, %cr3
+f0107893:	0f 22 d8             	mov    %eax,%cr3
+	# Turn on paging.
+	movl    %cr0, %eax
+f0107896:	0f 20 c0             	mov    %cr0,%eax
+	orl     $(CR0_PE|CR0_PG|CR0_WP), %eax
+f0107899:	0d 01 00 01 80       	or     $0x80010001,%eax
+	movl    %eax, %cr0
+f010789e:	0f 22 c0             	mov    %eax,%cr0
+
+	# Switch to the per-cpu stack allocated in boot_aps()
+	movl    mpentry_kstack, %esp
+f01078a1:	8b 25 04 bf 79 f0    	mov    0xf079bf04,%esp
+	movl    $0x0, %ebp       # nuke frame pointer
+f01078a7:	bd 00 00 00 00       	mov    $0x0,%ebp
+
+	# Call mp_main().  (Exercise for the reader: why the indirect call?)
+	movl    $mp_main, %eax
+f01078ac:	b8 d4 01 10 f0       	mov    $0xf01001d4,%eax
+	call    *%eax
+f01078b1:	ff d0                	call   *%eax
+
+f01078b3 <spin>:
+
+	# If mp_main returns (it shouldn't), loop.
+spin:
+	jmp     spin
+f01078b3:	eb fe                	jmp    f01078b3 <spin>
+f01078b5:	8d 76 00             	lea    0x0(%esi),%esi
+
+f01078b8 <gdt>:
+	...
+f01078c0:	ff                   	(bad)
+f01078c1:	ff 00                	incl   (%eax)
+f01078c3:	00 00                	add    %al,(%eax)
+f01078c5:	9a cf 00 ff ff 00 00 	lcall  $0x0,$0xffff00cf
+f01078cc:	00                   	.byte 0x0
+f01078cd:	92                   	xchg   %eax,%edx
+f01078ce:	cf                   	iret
+	...
+
+f01078d0 <gdtdesc>:
+f01078d0:	17                   	pop    %ss
+f01078d1:	00 5c 70 00          	add    %bl,0x0(%eax,%esi,2)
+	...
+
+f01078d6 <mpentry_end>:
+	.word   0x17				# sizeof(gdt) - 1
+	.long   MPBOOTPHYS(gdt)			# address gdt
+
+.globl mpentry_end
+mpentry_end:
+	nop
+f01078d6:	90                   	nop
+
+f01078d7 <mpsearch1>:
+}
+
+// Look for an MP structure in the len bytes at physical address addr.
+static struct mp *
+mpsearch1(physaddr_t a, int len)
+{
+f01078d7:	55                   	push   %ebp
+f01078d8:	89 e5                	mov    %esp,%ebp
+f01078da:	57                   	push   %edi
+f01078db:	56                   	push   %esi
+f01078dc:	53                   	push   %ebx
+f01078dd:	83 ec 0c             	sub    $0xc,%esp
+f01078e0:	89 c3                	mov    %eax,%ebx
+f01078e2:	89 d7                	mov    %edx,%edi
+	if (PGNUM(pa) >= npages)
+f01078e4:	a1 08 bf 79 f0       	mov    0xf079bf08,%eax
+f01078e9:	89 da                	mov    %ebx,%edx
+f01078eb:	c1 ea 0c             	shr    $0xc,%edx
+f01078ee:	39 c2                	cmp    %eax,%edx
+f01078f0:	73 1f                	jae    f0107911 <mpsearch1+0x3a>
+	return (void *)(pa + KERNBASE);
+f01078f2:	8d b3 00 00 00 f0    	lea    -0x10000000(%ebx),%esi
+  struct mp *mp = KADDR(a), *end = KADDR(a + len);
+f01078f8:	01 df                	add    %ebx,%edi
+	if (PGNUM(pa) >= npages)
+f01078fa:	89 fa                	mov    %edi,%edx
+f01078fc:	c1 ea 0c             	shr    $0xc,%edx
+f01078ff:	39 c2                	cmp    %eax,%edx
+f0107901:	73 20                	jae    f0107923 <mpsearch1+0x4c>
+	return (void *)(pa + KERNBASE);
+f0107903:	81 ef 00 00 00 10    	sub    $0x10000000,%edi
+
+  for (; mp < end; mp++)
+f0107909:	81 eb f0 ff ff 0f    	sub    $0xffffff0,%ebx
+f010790f:	eb 3a                	jmp    f010794b <mpsearch1+0x74>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0107911:	53                   	push   %ebx
+f0107912:	68 c4 82 10 f0       	push   $0xf01082c4
+f0107917:	6a 57                	push   $0x57
+f0107919:	68 a1 a3 10 f0       	push   $0xf010a3a1
+f010791e:	e8 1d 87 ff ff       	call   f0100040 <_panic>
+f0107923:	57                   	push   %edi
+f0107924:	68 c4 82 10 f0       	push   $0xf01082c4
+f0107929:	6a 57                	push   $0x57
+f010792b:	68 a1 a3 10 f0       	push   $0xf010a3a1
+f0107930:	e8 0b 87 ff ff       	call   f0100040 <_panic>
+    sum += ((uint8_t*)addr)[i];
+f0107935:	0f b6 0a             	movzbl (%edx),%ecx
+f0107938:	01 c8                	add    %ecx,%eax
+  for (i = 0; i < len; i++)
+f010793a:	83 c2 01             	add    $0x1,%edx
+f010793d:	39 da                	cmp    %ebx,%edx
+f010793f:	75 f4                	jne    f0107935 <mpsearch1+0x5e>
+    if (memcmp(mp->signature, "_MP_", 4) == 0 &&
+f0107941:	84 c0                	test   %al,%al
+f0107943:	74 2a                	je     f010796f <mpsearch1+0x98>
+  for (; mp < end; mp++)
+f0107945:	83 c6 10             	add    $0x10,%esi
+f0107948:	83 c3 10             	add    $0x10,%ebx
+f010794b:	39 fe                	cmp    %edi,%esi
+f010794d:	73 1b                	jae    f010796a <mpsearch1+0x93>
+    if (memcmp(mp->signature, "_MP_", 4) == 0 &&
+f010794f:	83 ec 04             	sub    $0x4,%esp
+f0107952:	6a 04                	push   $0x4
+f0107954:	68 b1 a3 10 f0       	push   $0xf010a3b1
+f0107959:	56                   	push   %esi
+f010795a:	e8 ca fd ff ff       	call   f0107729 <memcmp>
+f010795f:	83 c4 10             	add    $0x10,%esp
+f0107962:	89 f2                	mov    %esi,%edx
+f0107964:	85 c0                	test   %eax,%eax
+f0107966:	74 d5                	je     f010793d <mpsearch1+0x66>
+f0107968:	eb db                	jmp    f0107945 <mpsearch1+0x6e>
+        sum(mp, sizeof(*mp)) == 0)
+      return mp;
+  return NULL;
+f010796a:	be 00 00 00 00       	mov    $0x0,%esi
+}
+f010796f:	89 f0                	mov    %esi,%eax
+f0107971:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0107974:	5b                   	pop    %ebx
+f0107975:	5e                   	pop    %esi
+f0107976:	5f                   	pop    %edi
+f0107977:	5d                   	pop    %ebp
+f0107978:	c3                   	ret
+
+f0107979 <mp_init>:
+  return conf;
+}
+
+void
+mp_init(void)
+{
+f0107979:	55                   	push   %ebp
+f010797a:	89 e5                	mov    %esp,%ebp
+f010797c:	57                   	push   %edi
+f010797d:	56                   	push   %esi
+f010797e:	53                   	push   %ebx
+f010797f:	83 ec 1c             	sub    $0x1c,%esp
+  struct mpconf *conf;
+  struct mpproc *proc;
+  uint8_t *p;
+  unsigned int i;
+
+  bootcpu = &cpus[0];
+f0107982:	c7 05 c0 c3 79 f0 20 	movl   $0xf079c020,0xf079c3c0
+f0107989:	c0 79 f0 
+	if (PGNUM(pa) >= npages)
+f010798c:	83 3d 08 bf 79 f0 00 	cmpl   $0x0,0xf079bf08
+f0107993:	0f 84 86 00 00 00    	je     f0107a1f <mp_init+0xa6>
+  if ((p = *(uint16_t*)(bda + 0x0E))) {
+f0107999:	0f b7 05 0e 04 00 f0 	movzwl 0xf000040e,%eax
+f01079a0:	85 c0                	test   %eax,%eax
+f01079a2:	0f 84 8d 00 00 00    	je     f0107a35 <mp_init+0xbc>
+    p <<= 4;                    // Translate from segment to PA
+f01079a8:	c1 e0 04             	shl    $0x4,%eax
+    if ((mp = mpsearch1(p, 1024)))
+f01079ab:	ba 00 04 00 00       	mov    $0x400,%edx
+f01079b0:	e8 22 ff ff ff       	call   f01078d7 <mpsearch1>
+f01079b5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f01079b8:	85 c0                	test   %eax,%eax
+f01079ba:	75 1a                	jne    f01079d6 <mp_init+0x5d>
+  return mpsearch1(0xF0000, 0x10000);
+f01079bc:	ba 00 00 01 00       	mov    $0x10000,%edx
+f01079c1:	b8 00 00 0f 00       	mov    $0xf0000,%eax
+f01079c6:	e8 0c ff ff ff       	call   f01078d7 <mpsearch1>
+f01079cb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if ((mp = mpsearch()) == 0)
+f01079ce:	85 c0                	test   %eax,%eax
+f01079d0:	0f 84 20 02 00 00    	je     f0107bf6 <mp_init+0x27d>
+  if (mp->physaddr == 0 || mp->type != 0) {
+f01079d6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f01079d9:	8b 58 04             	mov    0x4(%eax),%ebx
+f01079dc:	85 db                	test   %ebx,%ebx
+f01079de:	74 7a                	je     f0107a5a <mp_init+0xe1>
+f01079e0:	80 78 0b 00          	cmpb   $0x0,0xb(%eax)
+f01079e4:	75 74                	jne    f0107a5a <mp_init+0xe1>
+f01079e6:	89 d8                	mov    %ebx,%eax
+f01079e8:	c1 e8 0c             	shr    $0xc,%eax
+f01079eb:	3b 05 08 bf 79 f0    	cmp    0xf079bf08,%eax
+f01079f1:	73 7c                	jae    f0107a6f <mp_init+0xf6>
+	return (void *)(pa + KERNBASE);
+f01079f3:	81 eb 00 00 00 10    	sub    $0x10000000,%ebx
+f01079f9:	89 de                	mov    %ebx,%esi
+  if (memcmp(conf, "PCMP", 4) != 0) {
+f01079fb:	83 ec 04             	sub    $0x4,%esp
+f01079fe:	6a 04                	push   $0x4
+f0107a00:	68 b6 a3 10 f0       	push   $0xf010a3b6
+f0107a05:	53                   	push   %ebx
+f0107a06:	e8 1e fd ff ff       	call   f0107729 <memcmp>
+f0107a0b:	83 c4 10             	add    $0x10,%esp
+f0107a0e:	85 c0                	test   %eax,%eax
+f0107a10:	75 72                	jne    f0107a84 <mp_init+0x10b>
+  for (i = 0; i < len; i++)
+f0107a12:	0f b7 7b 04          	movzwl 0x4(%ebx),%edi
+f0107a16:	01 df                	add    %ebx,%edi
+  sum = 0;
+f0107a18:	89 c2                	mov    %eax,%edx
+  for (i = 0; i < len; i++)
+f0107a1a:	e9 82 00 00 00       	jmp    f0107aa1 <mp_init+0x128>
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0107a1f:	68 00 04 00 00       	push   $0x400
+f0107a24:	68 c4 82 10 f0       	push   $0xf01082c4
+f0107a29:	6a 6f                	push   $0x6f
+f0107a2b:	68 a1 a3 10 f0       	push   $0xf010a3a1
+f0107a30:	e8 0b 86 ff ff       	call   f0100040 <_panic>
+    p = *(uint16_t*)(bda + 0x13) * 1024;
+f0107a35:	0f b7 05 13 04 00 f0 	movzwl 0xf0000413,%eax
+f0107a3c:	c1 e0 0a             	shl    $0xa,%eax
+    if ((mp = mpsearch1(p - 1024, 1024)))
+f0107a3f:	2d 00 04 00 00       	sub    $0x400,%eax
+f0107a44:	ba 00 04 00 00       	mov    $0x400,%edx
+f0107a49:	e8 89 fe ff ff       	call   f01078d7 <mpsearch1>
+f0107a4e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+f0107a51:	85 c0                	test   %eax,%eax
+f0107a53:	75 81                	jne    f01079d6 <mp_init+0x5d>
+f0107a55:	e9 62 ff ff ff       	jmp    f01079bc <mp_init+0x43>
+    cprintf("SMP: Default configurations not implemented\n");
+f0107a5a:	83 ec 0c             	sub    $0xc,%esp
+f0107a5d:	68 14 a2 10 f0       	push   $0xf010a214
+f0107a62:	e8 c5 c9 ff ff       	call   f010442c <cprintf>
+    return NULL;
+f0107a67:	83 c4 10             	add    $0x10,%esp
+f0107a6a:	e9 87 01 00 00       	jmp    f0107bf6 <mp_init+0x27d>
+f0107a6f:	53                   	push   %ebx
+f0107a70:	68 c4 82 10 f0       	push   $0xf01082c4
+f0107a75:	68 90 00 00 00       	push   $0x90
+f0107a7a:	68 a1 a3 10 f0       	push   $0xf010a3a1
+f0107a7f:	e8 bc 85 ff ff       	call   f0100040 <_panic>
+    cprintf("SMP: Incorrect MP configuration table signature\n");
+f0107a84:	83 ec 0c             	sub    $0xc,%esp
+f0107a87:	68 44 a2 10 f0       	push   $0xf010a244
+f0107a8c:	e8 9b c9 ff ff       	call   f010442c <cprintf>
+    return NULL;
+f0107a91:	83 c4 10             	add    $0x10,%esp
+f0107a94:	e9 5d 01 00 00       	jmp    f0107bf6 <mp_init+0x27d>
+    sum += ((uint8_t*)addr)[i];
+f0107a99:	0f b6 0b             	movzbl (%ebx),%ecx
+f0107a9c:	01 ca                	add    %ecx,%edx
+  for (i = 0; i < len; i++)
+f0107a9e:	83 c3 01             	add    $0x1,%ebx
+f0107aa1:	39 fb                	cmp    %edi,%ebx
+f0107aa3:	75 f4                	jne    f0107a99 <mp_init+0x120>
+  if (sum(conf, conf->length) != 0) {
+f0107aa5:	84 d2                	test   %dl,%dl
+f0107aa7:	75 16                	jne    f0107abf <mp_init+0x146>
+  if (conf->version != 1 && conf->version != 4) {
+f0107aa9:	0f b6 56 06          	movzbl 0x6(%esi),%edx
+f0107aad:	80 fa 01             	cmp    $0x1,%dl
+f0107ab0:	74 05                	je     f0107ab7 <mp_init+0x13e>
+f0107ab2:	80 fa 04             	cmp    $0x4,%dl
+f0107ab5:	75 1d                	jne    f0107ad4 <mp_init+0x15b>
+  for (i = 0; i < len; i++)
+f0107ab7:	0f b7 4e 28          	movzwl 0x28(%esi),%ecx
+f0107abb:	01 d9                	add    %ebx,%ecx
+f0107abd:	eb 36                	jmp    f0107af5 <mp_init+0x17c>
+    cprintf("SMP: Bad MP configuration checksum\n");
+f0107abf:	83 ec 0c             	sub    $0xc,%esp
+f0107ac2:	68 78 a2 10 f0       	push   $0xf010a278
+f0107ac7:	e8 60 c9 ff ff       	call   f010442c <cprintf>
+    return NULL;
+f0107acc:	83 c4 10             	add    $0x10,%esp
+f0107acf:	e9 22 01 00 00       	jmp    f0107bf6 <mp_init+0x27d>
+    cprintf("SMP: Unsupported MP version %d\n", conf->version);
+f0107ad4:	83 ec 08             	sub    $0x8,%esp
+f0107ad7:	0f b6 d2             	movzbl %dl,%edx
+f0107ada:	52                   	push   %edx
+f0107adb:	68 9c a2 10 f0       	push   $0xf010a29c
+f0107ae0:	e8 47 c9 ff ff       	call   f010442c <cprintf>
+    return NULL;
+f0107ae5:	83 c4 10             	add    $0x10,%esp
+f0107ae8:	e9 09 01 00 00       	jmp    f0107bf6 <mp_init+0x27d>
+    sum += ((uint8_t*)addr)[i];
+f0107aed:	0f b6 13             	movzbl (%ebx),%edx
+f0107af0:	01 d0                	add    %edx,%eax
+  for (i = 0; i < len; i++)
+f0107af2:	83 c3 01             	add    $0x1,%ebx
+f0107af5:	39 d9                	cmp    %ebx,%ecx
+f0107af7:	75 f4                	jne    f0107aed <mp_init+0x174>
+  if ((sum((uint8_t*)conf + conf->length, conf->xlength) + conf->xchecksum) & 0xff) {
+f0107af9:	02 46 2a             	add    0x2a(%esi),%al
+f0107afc:	75 1c                	jne    f0107b1a <mp_init+0x1a1>
+  if ((conf = mpconfig(&mp)) == 0)
+    return;
+  ismp = 1;
+f0107afe:	c7 05 00 c0 79 f0 01 	movl   $0x1,0xf079c000
+f0107b05:	00 00 00 
+  lapicaddr = conf->lapicaddr;
+f0107b08:	8b 46 24             	mov    0x24(%esi),%eax
+f0107b0b:	a3 00 d0 7d f0       	mov    %eax,0xf07dd000
+
+  for (p = conf->entries, i = 0; i < conf->entry; i++) {
+f0107b10:	8d 7e 2c             	lea    0x2c(%esi),%edi
+f0107b13:	bb 00 00 00 00       	mov    $0x0,%ebx
+f0107b18:	eb 4d                	jmp    f0107b67 <mp_init+0x1ee>
+    cprintf("SMP: Bad MP configuration extended checksum\n");
+f0107b1a:	83 ec 0c             	sub    $0xc,%esp
+f0107b1d:	68 bc a2 10 f0       	push   $0xf010a2bc
+f0107b22:	e8 05 c9 ff ff       	call   f010442c <cprintf>
+    return NULL;
+f0107b27:	83 c4 10             	add    $0x10,%esp
+f0107b2a:	e9 c7 00 00 00       	jmp    f0107bf6 <mp_init+0x27d>
+    switch (*p) {
+    case MPPROC:
+      proc = (struct mpproc *)p;
+      if (proc->flags & MPPROC_BOOT)
+f0107b2f:	f6 47 03 02          	testb  $0x2,0x3(%edi)
+f0107b33:	74 11                	je     f0107b46 <mp_init+0x1cd>
+        bootcpu = &cpus[ncpu];
+f0107b35:	6b 05 c4 c3 79 f0 74 	imul   $0x74,0xf079c3c4,%eax
+f0107b3c:	05 20 c0 79 f0       	add    $0xf079c020,%eax
+f0107b41:	a3 c0 c3 79 f0       	mov    %eax,0xf079c3c0
+      if (ncpu < NCPU) {
+f0107b46:	a1 c4 c3 79 f0       	mov    0xf079c3c4,%eax
+f0107b4b:	83 f8 07             	cmp    $0x7,%eax
+f0107b4e:	7f 33                	jg     f0107b83 <mp_init+0x20a>
+        cpus[ncpu].cpu_id = ncpu;
+f0107b50:	6b d0 74             	imul   $0x74,%eax,%edx
+f0107b53:	88 82 20 c0 79 f0    	mov    %al,-0xf863fe0(%edx)
+        ncpu++;
+f0107b59:	83 c0 01             	add    $0x1,%eax
+f0107b5c:	a3 c4 c3 79 f0       	mov    %eax,0xf079c3c4
+      } else
+        cprintf("SMP: too many CPUs, CPU %d disabled\n",
+                proc->apicid);
+      p += sizeof(struct mpproc);
+f0107b61:	83 c7 14             	add    $0x14,%edi
+  for (p = conf->entries, i = 0; i < conf->entry; i++) {
+f0107b64:	83 c3 01             	add    $0x1,%ebx
+f0107b67:	0f b7 46 22          	movzwl 0x22(%esi),%eax
+f0107b6b:	39 c3                	cmp    %eax,%ebx
+f0107b6d:	73 4f                	jae    f0107bbe <mp_init+0x245>
+    switch (*p) {
+f0107b6f:	0f b6 07             	movzbl (%edi),%eax
+f0107b72:	84 c0                	test   %al,%al
+f0107b74:	74 b9                	je     f0107b2f <mp_init+0x1b6>
+f0107b76:	8d 50 ff             	lea    -0x1(%eax),%edx
+f0107b79:	80 fa 03             	cmp    $0x3,%dl
+f0107b7c:	77 1c                	ja     f0107b9a <mp_init+0x221>
+      continue;
+    case MPBUS:
+    case MPIOAPIC:
+    case MPIOINTR:
+    case MPLINTR:
+      p += 8;
+f0107b7e:	83 c7 08             	add    $0x8,%edi
+      continue;
+f0107b81:	eb e1                	jmp    f0107b64 <mp_init+0x1eb>
+        cprintf("SMP: too many CPUs, CPU %d disabled\n",
+f0107b83:	83 ec 08             	sub    $0x8,%esp
+f0107b86:	0f b6 47 01          	movzbl 0x1(%edi),%eax
+f0107b8a:	50                   	push   %eax
+f0107b8b:	68 ec a2 10 f0       	push   $0xf010a2ec
+f0107b90:	e8 97 c8 ff ff       	call   f010442c <cprintf>
+f0107b95:	83 c4 10             	add    $0x10,%esp
+f0107b98:	eb c7                	jmp    f0107b61 <mp_init+0x1e8>
+    default:
+      cprintf("mpinit: unknown config type %x\n", *p);
+f0107b9a:	83 ec 08             	sub    $0x8,%esp
+    switch (*p) {
+f0107b9d:	0f b6 c0             	movzbl %al,%eax
+      cprintf("mpinit: unknown config type %x\n", *p);
+f0107ba0:	50                   	push   %eax
+f0107ba1:	68 14 a3 10 f0       	push   $0xf010a314
+f0107ba6:	e8 81 c8 ff ff       	call   f010442c <cprintf>
+      ismp = 0;
+f0107bab:	c7 05 00 c0 79 f0 00 	movl   $0x0,0xf079c000
+f0107bb2:	00 00 00 
+      i = conf->entry;
+f0107bb5:	0f b7 5e 22          	movzwl 0x22(%esi),%ebx
+f0107bb9:	83 c4 10             	add    $0x10,%esp
+f0107bbc:	eb a6                	jmp    f0107b64 <mp_init+0x1eb>
+    }
+  }
+
+  bootcpu->cpu_status = CPU_STARTED;
+f0107bbe:	a1 c0 c3 79 f0       	mov    0xf079c3c0,%eax
+f0107bc3:	c7 40 04 01 00 00 00 	movl   $0x1,0x4(%eax)
+  if (!ismp) {
+f0107bca:	83 3d 00 c0 79 f0 00 	cmpl   $0x0,0xf079c000
+f0107bd1:	74 2b                	je     f0107bfe <mp_init+0x285>
+    ncpu = 1;
+    lapicaddr = 0;
+    cprintf("SMP: configuration not found, SMP disabled\n");
+    return;
+  }
+  cprintf("SMP: CPU %d found %d CPU(s)\n", bootcpu->cpu_id,  ncpu);
+f0107bd3:	83 ec 04             	sub    $0x4,%esp
+f0107bd6:	ff 35 c4 c3 79 f0    	push   0xf079c3c4
+f0107bdc:	0f b6 00             	movzbl (%eax),%eax
+f0107bdf:	50                   	push   %eax
+f0107be0:	68 bb a3 10 f0       	push   $0xf010a3bb
+f0107be5:	e8 42 c8 ff ff       	call   f010442c <cprintf>
+
+  if (mp->imcrp) {
+f0107bea:	83 c4 10             	add    $0x10,%esp
+f0107bed:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+f0107bf0:	80 78 0c 00          	cmpb   $0x0,0xc(%eax)
+f0107bf4:	75 2e                	jne    f0107c24 <mp_init+0x2ab>
+    // switch to getting interrupts from the LAPIC.
+    cprintf("SMP: Setting IMCR to switch from PIC mode to symmetric I/O mode\n");
+    outb(0x22, 0x70);               // Select IMCR
+    outb(0x23, inb(0x23) | 1);      // Mask external interrupts.
+  }
+}
+f0107bf6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0107bf9:	5b                   	pop    %ebx
+f0107bfa:	5e                   	pop    %esi
+f0107bfb:	5f                   	pop    %edi
+f0107bfc:	5d                   	pop    %ebp
+f0107bfd:	c3                   	ret
+    ncpu = 1;
+f0107bfe:	c7 05 c4 c3 79 f0 01 	movl   $0x1,0xf079c3c4
+f0107c05:	00 00 00 
+    lapicaddr = 0;
+f0107c08:	c7 05 00 d0 7d f0 00 	movl   $0x0,0xf07dd000
+f0107c0f:	00 00 00 
+    cprintf("SMP: configuration not found, SMP disabled\n");
+f0107c12:	83 ec 0c             	sub    $0xc,%esp
+f0107c15:	68 34 a3 10 f0       	push   $0xf010a334
+f0107c1a:	e8 0d c8 ff ff       	call   f010442c <cprintf>
+    return;
+f0107c1f:	83 c4 10             	add    $0x10,%esp
+f0107c22:	eb d2                	jmp    f0107bf6 <mp_init+0x27d>
+    cprintf("SMP: Setting IMCR to switch from PIC mode to symmetric I/O mode\n");
+f0107c24:	83 ec 0c             	sub    $0xc,%esp
+f0107c27:	68 60 a3 10 f0       	push   $0xf010a360
+f0107c2c:	e8 fb c7 ff ff       	call   f010442c <cprintf>
+  __asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0107c31:	b8 70 00 00 00       	mov    $0x70,%eax
+f0107c36:	ba 22 00 00 00       	mov    $0x22,%edx
+f0107c3b:	ee                   	out    %al,(%dx)
+  __asm __volatile("inb %w1,%0" : "=a" (data) : "d" (port));
+f0107c3c:	ba 23 00 00 00       	mov    $0x23,%edx
+f0107c41:	ec                   	in     (%dx),%al
+    outb(0x23, inb(0x23) | 1);      // Mask external interrupts.
+f0107c42:	83 c8 01             	or     $0x1,%eax
+  __asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0107c45:	ee                   	out    %al,(%dx)
+}
+f0107c46:	83 c4 10             	add    $0x10,%esp
+f0107c49:	eb ab                	jmp    f0107bf6 <mp_init+0x27d>
+
+f0107c4b <lapicw>:
+volatile uint32_t *lapic;
+
+static void
+lapicw(int index, int value)
+{
+  lapic[index] = value;
+f0107c4b:	8b 0d 04 d0 7d f0    	mov    0xf07dd004,%ecx
+f0107c51:	8d 04 81             	lea    (%ecx,%eax,4),%eax
+f0107c54:	89 10                	mov    %edx,(%eax)
+  lapic[ID];        // wait for write to finish, by reading
+f0107c56:	a1 04 d0 7d f0       	mov    0xf07dd004,%eax
+f0107c5b:	8b 40 20             	mov    0x20(%eax),%eax
+}
+f0107c5e:	c3                   	ret
+
+f0107c5f <cpunum>:
+}
+
+int
+cpunum(void)
+{
+  if (lapic)
+f0107c5f:	8b 15 04 d0 7d f0    	mov    0xf07dd004,%edx
+    return lapic[ID] >> 24;
+  return 0;
+f0107c65:	b8 00 00 00 00       	mov    $0x0,%eax
+  if (lapic)
+f0107c6a:	85 d2                	test   %edx,%edx
+f0107c6c:	74 06                	je     f0107c74 <cpunum+0x15>
+    return lapic[ID] >> 24;
+f0107c6e:	8b 42 20             	mov    0x20(%edx),%eax
+f0107c71:	c1 e8 18             	shr    $0x18,%eax
+}
+f0107c74:	c3                   	ret
+
+f0107c75 <lapic_init>:
+  if (!lapicaddr)
+f0107c75:	a1 00 d0 7d f0       	mov    0xf07dd000,%eax
+f0107c7a:	85 c0                	test   %eax,%eax
+f0107c7c:	75 01                	jne    f0107c7f <lapic_init+0xa>
+f0107c7e:	c3                   	ret
+{
+f0107c7f:	55                   	push   %ebp
+f0107c80:	89 e5                	mov    %esp,%ebp
+f0107c82:	83 ec 10             	sub    $0x10,%esp
+  lapic = mmio_map_region(lapicaddr, 4096);
+f0107c85:	68 00 10 00 00       	push   $0x1000
+f0107c8a:	50                   	push   %eax
+f0107c8b:	e8 a5 9e ff ff       	call   f0101b35 <mmio_map_region>
+f0107c90:	a3 04 d0 7d f0       	mov    %eax,0xf07dd004
+  lapicw(SVR, ENABLE | (IRQ_OFFSET + IRQ_SPURIOUS));
+f0107c95:	ba 27 01 00 00       	mov    $0x127,%edx
+f0107c9a:	b8 3c 00 00 00       	mov    $0x3c,%eax
+f0107c9f:	e8 a7 ff ff ff       	call   f0107c4b <lapicw>
+  lapicw(TDCR, X1);
+f0107ca4:	ba 0b 00 00 00       	mov    $0xb,%edx
+f0107ca9:	b8 f8 00 00 00       	mov    $0xf8,%eax
+f0107cae:	e8 98 ff ff ff       	call   f0107c4b <lapicw>
+  lapicw(TIMER, PERIODIC | (IRQ_OFFSET + IRQ_TIMER));
+f0107cb3:	ba 20 00 02 00       	mov    $0x20020,%edx
+f0107cb8:	b8 c8 00 00 00       	mov    $0xc8,%eax
+f0107cbd:	e8 89 ff ff ff       	call   f0107c4b <lapicw>
+  lapicw(TICR, 10000000);
+f0107cc2:	ba 80 96 98 00       	mov    $0x989680,%edx
+f0107cc7:	b8 e0 00 00 00       	mov    $0xe0,%eax
+f0107ccc:	e8 7a ff ff ff       	call   f0107c4b <lapicw>
+  if (thiscpu != bootcpu)
+f0107cd1:	e8 89 ff ff ff       	call   f0107c5f <cpunum>
+f0107cd6:	6b c0 74             	imul   $0x74,%eax,%eax
+f0107cd9:	05 20 c0 79 f0       	add    $0xf079c020,%eax
+f0107cde:	83 c4 10             	add    $0x10,%esp
+f0107ce1:	39 05 c0 c3 79 f0    	cmp    %eax,0xf079c3c0
+f0107ce7:	74 0f                	je     f0107cf8 <lapic_init+0x83>
+    lapicw(LINT0, MASKED);
+f0107ce9:	ba 00 00 01 00       	mov    $0x10000,%edx
+f0107cee:	b8 d4 00 00 00       	mov    $0xd4,%eax
+f0107cf3:	e8 53 ff ff ff       	call   f0107c4b <lapicw>
+  lapicw(LINT1, MASKED);
+f0107cf8:	ba 00 00 01 00       	mov    $0x10000,%edx
+f0107cfd:	b8 d8 00 00 00       	mov    $0xd8,%eax
+f0107d02:	e8 44 ff ff ff       	call   f0107c4b <lapicw>
+  if (((lapic[VER]>>16) & 0xFF) >= 4)
+f0107d07:	a1 04 d0 7d f0       	mov    0xf07dd004,%eax
+f0107d0c:	8b 40 30             	mov    0x30(%eax),%eax
+f0107d0f:	c1 e8 10             	shr    $0x10,%eax
+f0107d12:	a8 fc                	test   $0xfc,%al
+f0107d14:	75 7c                	jne    f0107d92 <lapic_init+0x11d>
+  lapicw(ERROR, IRQ_OFFSET + IRQ_ERROR);
+f0107d16:	ba 33 00 00 00       	mov    $0x33,%edx
+f0107d1b:	b8 dc 00 00 00       	mov    $0xdc,%eax
+f0107d20:	e8 26 ff ff ff       	call   f0107c4b <lapicw>
+  lapicw(ESR, 0);
+f0107d25:	ba 00 00 00 00       	mov    $0x0,%edx
+f0107d2a:	b8 a0 00 00 00       	mov    $0xa0,%eax
+f0107d2f:	e8 17 ff ff ff       	call   f0107c4b <lapicw>
+  lapicw(ESR, 0);
+f0107d34:	ba 00 00 00 00       	mov    $0x0,%edx
+f0107d39:	b8 a0 00 00 00       	mov    $0xa0,%eax
+f0107d3e:	e8 08 ff ff ff       	call   f0107c4b <lapicw>
+  lapicw(EOI, 0);
+f0107d43:	ba 00 00 00 00       	mov    $0x0,%edx
+f0107d48:	b8 2c 00 00 00       	mov    $0x2c,%eax
+f0107d4d:	e8 f9 fe ff ff       	call   f0107c4b <lapicw>
+  lapicw(ICRHI, 0);
+f0107d52:	ba 00 00 00 00       	mov    $0x0,%edx
+f0107d57:	b8 c4 00 00 00       	mov    $0xc4,%eax
+f0107d5c:	e8 ea fe ff ff       	call   f0107c4b <lapicw>
+  lapicw(ICRLO, BCAST | INIT | LEVEL);
+f0107d61:	ba 00 85 08 00       	mov    $0x88500,%edx
+f0107d66:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f0107d6b:	e8 db fe ff ff       	call   f0107c4b <lapicw>
+  while (lapic[ICRLO] & DELIVS)
+f0107d70:	8b 15 04 d0 7d f0    	mov    0xf07dd004,%edx
+f0107d76:	8b 82 00 03 00 00    	mov    0x300(%edx),%eax
+f0107d7c:	f6 c4 10             	test   $0x10,%ah
+f0107d7f:	75 f5                	jne    f0107d76 <lapic_init+0x101>
+  lapicw(TPR, 0);
+f0107d81:	ba 00 00 00 00       	mov    $0x0,%edx
+f0107d86:	b8 20 00 00 00       	mov    $0x20,%eax
+f0107d8b:	e8 bb fe ff ff       	call   f0107c4b <lapicw>
+}
+f0107d90:	c9                   	leave
+f0107d91:	c3                   	ret
+    lapicw(PCINT, MASKED);
+f0107d92:	ba 00 00 01 00       	mov    $0x10000,%edx
+f0107d97:	b8 d0 00 00 00       	mov    $0xd0,%eax
+f0107d9c:	e8 aa fe ff ff       	call   f0107c4b <lapicw>
+f0107da1:	e9 70 ff ff ff       	jmp    f0107d16 <lapic_init+0xa1>
+
+f0107da6 <lapic_eoi>:
+
+// Acknowledge interrupt.
+void
+lapic_eoi(void)
+{
+  if (lapic)
+f0107da6:	83 3d 04 d0 7d f0 00 	cmpl   $0x0,0xf07dd004
+f0107dad:	74 17                	je     f0107dc6 <lapic_eoi+0x20>
+{
+f0107daf:	55                   	push   %ebp
+f0107db0:	89 e5                	mov    %esp,%ebp
+f0107db2:	83 ec 08             	sub    $0x8,%esp
+    lapicw(EOI, 0);
+f0107db5:	ba 00 00 00 00       	mov    $0x0,%edx
+f0107dba:	b8 2c 00 00 00       	mov    $0x2c,%eax
+f0107dbf:	e8 87 fe ff ff       	call   f0107c4b <lapicw>
+}
+f0107dc4:	c9                   	leave
+f0107dc5:	c3                   	ret
+f0107dc6:	c3                   	ret
+
+f0107dc7 <lapic_startap>:
+
+// Start additional processor running entry code at addr.
+// See Appendix B of MultiProcessor Specification.
+void
+lapic_startap(uint8_t apicid, uint32_t addr)
+{
+f0107dc7:	55                   	push   %ebp
+f0107dc8:	89 e5                	mov    %esp,%ebp
+f0107dca:	56                   	push   %esi
+f0107dcb:	53                   	push   %ebx
+f0107dcc:	8b 75 08             	mov    0x8(%ebp),%esi
+f0107dcf:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  __asm __volatile("outb %0,%w1" : : "a" (data), "d" (port));
+f0107dd2:	b8 0f 00 00 00       	mov    $0xf,%eax
+f0107dd7:	ba 70 00 00 00       	mov    $0x70,%edx
+f0107ddc:	ee                   	out    %al,(%dx)
+f0107ddd:	b8 0a 00 00 00       	mov    $0xa,%eax
+f0107de2:	ba 71 00 00 00       	mov    $0x71,%edx
+f0107de7:	ee                   	out    %al,(%dx)
+	if (PGNUM(pa) >= npages)
+f0107de8:	83 3d 08 bf 79 f0 00 	cmpl   $0x0,0xf079bf08
+f0107def:	74 7e                	je     f0107e6f <lapic_startap+0xa8>
+  // and the warm reset vector (DWORD based at 40:67) to point at
+  // the AP startup code prior to the [universal startup algorithm]."
+  outb(IO_RTC, 0xF);                          // offset 0xF is shutdown code
+  outb(IO_RTC+1, 0x0A);
+  wrv = (uint16_t*)KADDR((0x40 << 4 | 0x67)); // Warm reset vector
+  wrv[0] = 0;
+f0107df1:	66 c7 05 67 04 00 f0 	movw   $0x0,0xf0000467
+f0107df8:	00 00 
+  wrv[1] = addr >> 4;
+f0107dfa:	89 d8                	mov    %ebx,%eax
+f0107dfc:	c1 e8 04             	shr    $0x4,%eax
+f0107dff:	66 a3 69 04 00 f0    	mov    %ax,0xf0000469
+
+  // "Universal startup algorithm."
+  // Send INIT (level-triggered) interrupt to reset other CPU.
+  lapicw(ICRHI, apicid << 24);
+f0107e05:	c1 e6 18             	shl    $0x18,%esi
+f0107e08:	89 f2                	mov    %esi,%edx
+f0107e0a:	b8 c4 00 00 00       	mov    $0xc4,%eax
+f0107e0f:	e8 37 fe ff ff       	call   f0107c4b <lapicw>
+  lapicw(ICRLO, INIT | LEVEL | ASSERT);
+f0107e14:	ba 00 c5 00 00       	mov    $0xc500,%edx
+f0107e19:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f0107e1e:	e8 28 fe ff ff       	call   f0107c4b <lapicw>
+  microdelay(200);
+  lapicw(ICRLO, INIT | LEVEL);
+f0107e23:	ba 00 85 00 00       	mov    $0x8500,%edx
+f0107e28:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f0107e2d:	e8 19 fe ff ff       	call   f0107c4b <lapicw>
+  // when it is in the halted state due to an INIT.  So the second
+  // should be ignored, but it is part of the official Intel algorithm.
+  // Bochs complains about the second one.  Too bad for Bochs.
+  for (i = 0; i < 2; i++) {
+    lapicw(ICRHI, apicid << 24);
+    lapicw(ICRLO, STARTUP | (addr >> 12));
+f0107e32:	c1 eb 0c             	shr    $0xc,%ebx
+f0107e35:	80 cf 06             	or     $0x6,%bh
+    lapicw(ICRHI, apicid << 24);
+f0107e38:	89 f2                	mov    %esi,%edx
+f0107e3a:	b8 c4 00 00 00       	mov    $0xc4,%eax
+f0107e3f:	e8 07 fe ff ff       	call   f0107c4b <lapicw>
+    lapicw(ICRLO, STARTUP | (addr >> 12));
+f0107e44:	89 da                	mov    %ebx,%edx
+f0107e46:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f0107e4b:	e8 fb fd ff ff       	call   f0107c4b <lapicw>
+    lapicw(ICRHI, apicid << 24);
+f0107e50:	89 f2                	mov    %esi,%edx
+f0107e52:	b8 c4 00 00 00       	mov    $0xc4,%eax
+f0107e57:	e8 ef fd ff ff       	call   f0107c4b <lapicw>
+    lapicw(ICRLO, STARTUP | (addr >> 12));
+f0107e5c:	89 da                	mov    %ebx,%edx
+f0107e5e:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f0107e63:	e8 e3 fd ff ff       	call   f0107c4b <lapicw>
+    microdelay(200);
+  }
+}
+f0107e68:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0107e6b:	5b                   	pop    %ebx
+f0107e6c:	5e                   	pop    %esi
+f0107e6d:	5d                   	pop    %ebp
+f0107e6e:	c3                   	ret
+		_panic(file, line, "KADDR called with invalid pa %08lx", pa);
+f0107e6f:	68 67 04 00 00       	push   $0x467
+f0107e74:	68 c4 82 10 f0       	push   $0xf01082c4
+f0107e79:	68 98 00 00 00       	push   $0x98
+f0107e7e:	68 d8 a3 10 f0       	push   $0xf010a3d8
+f0107e83:	e8 b8 81 ff ff       	call   f0100040 <_panic>
+
+f0107e88 <lapic_ipi>:
+
+void
+lapic_ipi(int vector)
+{
+f0107e88:	55                   	push   %ebp
+f0107e89:	89 e5                	mov    %esp,%ebp
+f0107e8b:	83 ec 08             	sub    $0x8,%esp
+  lapicw(ICRLO, OTHERS | FIXED | vector);
+f0107e8e:	8b 55 08             	mov    0x8(%ebp),%edx
+f0107e91:	81 ca 00 00 0c 00    	or     $0xc0000,%edx
+f0107e97:	b8 c0 00 00 00       	mov    $0xc0,%eax
+f0107e9c:	e8 aa fd ff ff       	call   f0107c4b <lapicw>
+  while (lapic[ICRLO] & DELIVS)
+f0107ea1:	8b 15 04 d0 7d f0    	mov    0xf07dd004,%edx
+f0107ea7:	8b 82 00 03 00 00    	mov    0x300(%edx),%eax
+f0107ead:	f6 c4 10             	test   $0x10,%ah
+f0107eb0:	75 f5                	jne    f0107ea7 <lapic_ipi+0x1f>
+    ;
+}
+f0107eb2:	c9                   	leave
+f0107eb3:	c3                   	ret
+
+f0107eb4 <__spin_initlock>:
+}
+#endif
+
+void
+__spin_initlock(struct spinlock *lk, char *name)
+{
+f0107eb4:	55                   	push   %ebp
+f0107eb5:	89 e5                	mov    %esp,%ebp
+f0107eb7:	8b 45 08             	mov    0x8(%ebp),%eax
+  lk->locked = 0;
+f0107eba:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+#ifdef DEBUG_SPINLOCK
+  lk->name = name;
+f0107ec0:	8b 55 0c             	mov    0xc(%ebp),%edx
+f0107ec3:	89 50 04             	mov    %edx,0x4(%eax)
+  lk->cpu = 0;
+f0107ec6:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%eax)
+#endif
+}
+f0107ecd:	5d                   	pop    %ebp
+f0107ece:	c3                   	ret
+
+f0107ecf <spin_lock>:
+// Loops (spins) until the lock is acquired.
+// Holding a lock for a long time may cause
+// other CPUs to waste time spinning to acquire it.
+void
+spin_lock(struct spinlock *lk)
+{
+f0107ecf:	55                   	push   %ebp
+f0107ed0:	89 e5                	mov    %esp,%ebp
+f0107ed2:	56                   	push   %esi
+f0107ed3:	53                   	push   %ebx
+f0107ed4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  return lock->locked && lock->cpu == thiscpu;
+f0107ed7:	83 3b 00             	cmpl   $0x0,(%ebx)
+f0107eda:	75 07                	jne    f0107ee3 <spin_lock+0x14>
+  asm volatile ("lock; xchgl %0, %1" :
+f0107edc:	ba 01 00 00 00       	mov    $0x1,%edx
+f0107ee1:	eb 34                	jmp    f0107f17 <spin_lock+0x48>
+f0107ee3:	8b 73 08             	mov    0x8(%ebx),%esi
+f0107ee6:	e8 74 fd ff ff       	call   f0107c5f <cpunum>
+f0107eeb:	6b c0 74             	imul   $0x74,%eax,%eax
+f0107eee:	05 20 c0 79 f0       	add    $0xf079c020,%eax
+#ifdef DEBUG_SPINLOCK
+  if (holding(lk))
+f0107ef3:	39 c6                	cmp    %eax,%esi
+f0107ef5:	75 e5                	jne    f0107edc <spin_lock+0xd>
+    panic("CPU %d cannot acquire %s: already holding", cpunum(), lk->name);
+f0107ef7:	8b 5b 04             	mov    0x4(%ebx),%ebx
+f0107efa:	e8 60 fd ff ff       	call   f0107c5f <cpunum>
+f0107eff:	83 ec 0c             	sub    $0xc,%esp
+f0107f02:	53                   	push   %ebx
+f0107f03:	50                   	push   %eax
+f0107f04:	68 e8 a3 10 f0       	push   $0xf010a3e8
+f0107f09:	6a 41                	push   $0x41
+f0107f0b:	68 4a a4 10 f0       	push   $0xf010a44a
+f0107f10:	e8 2b 81 ff ff       	call   f0100040 <_panic>
+
+  // The xchg is atomic.
+  // It also serializes, so that reads after acquire are not
+  // reordered before it.
+  while (xchg(&lk->locked, 1) != 0)
+    asm volatile ("pause");
+f0107f15:	f3 90                	pause
+f0107f17:	89 d0                	mov    %edx,%eax
+f0107f19:	f0 87 03             	lock xchg %eax,(%ebx)
+  while (xchg(&lk->locked, 1) != 0)
+f0107f1c:	85 c0                	test   %eax,%eax
+f0107f1e:	75 f5                	jne    f0107f15 <spin_lock+0x46>
+
+  // Record info about lock acquisition for debugging.
+#ifdef DEBUG_SPINLOCK
+  lk->cpu = thiscpu;
+f0107f20:	e8 3a fd ff ff       	call   f0107c5f <cpunum>
+f0107f25:	6b c0 74             	imul   $0x74,%eax,%eax
+f0107f28:	05 20 c0 79 f0       	add    $0xf079c020,%eax
+f0107f2d:	89 43 08             	mov    %eax,0x8(%ebx)
+  __asm __volatile("movl %%ebp,%0" : "=r" (ebp));
+f0107f30:	89 ea                	mov    %ebp,%edx
+  for (i = 0; i < 10; i++) {
+f0107f32:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (ebp == 0 || ebp < (uint32_t*)ULIM)
+f0107f37:	83 f8 09             	cmp    $0x9,%eax
+f0107f3a:	7f 21                	jg     f0107f5d <spin_lock+0x8e>
+f0107f3c:	81 fa ff ff 7f ef    	cmp    $0xef7fffff,%edx
+f0107f42:	76 19                	jbe    f0107f5d <spin_lock+0x8e>
+    pcs[i] = ebp[1];                      // saved %eip
+f0107f44:	8b 4a 04             	mov    0x4(%edx),%ecx
+f0107f47:	89 4c 83 0c          	mov    %ecx,0xc(%ebx,%eax,4)
+    ebp = (uint32_t*)ebp[0];              // saved %ebp
+f0107f4b:	8b 12                	mov    (%edx),%edx
+  for (i = 0; i < 10; i++) {
+f0107f4d:	83 c0 01             	add    $0x1,%eax
+f0107f50:	eb e5                	jmp    f0107f37 <spin_lock+0x68>
+    pcs[i] = 0;
+f0107f52:	c7 44 83 0c 00 00 00 	movl   $0x0,0xc(%ebx,%eax,4)
+f0107f59:	00 
+  for (; i < 10; i++)
+f0107f5a:	83 c0 01             	add    $0x1,%eax
+f0107f5d:	83 f8 09             	cmp    $0x9,%eax
+f0107f60:	7e f0                	jle    f0107f52 <spin_lock+0x83>
+  get_caller_pcs(lk->pcs);
+#endif
+}
+f0107f62:	8d 65 f8             	lea    -0x8(%ebp),%esp
+f0107f65:	5b                   	pop    %ebx
+f0107f66:	5e                   	pop    %esi
+f0107f67:	5d                   	pop    %ebp
+f0107f68:	c3                   	ret
+
+f0107f69 <spin_unlock>:
+
+// Release the lock.
+void
+spin_unlock(struct spinlock *lk)
+{
+f0107f69:	55                   	push   %ebp
+f0107f6a:	89 e5                	mov    %esp,%ebp
+f0107f6c:	57                   	push   %edi
+f0107f6d:	56                   	push   %esi
+f0107f6e:	53                   	push   %ebx
+f0107f6f:	83 ec 5c             	sub    $0x5c,%esp
+f0107f72:	8b 75 08             	mov    0x8(%ebp),%esi
+  return lock->locked && lock->cpu == thiscpu;
+f0107f75:	83 3e 00             	cmpl   $0x0,(%esi)
+f0107f78:	75 38                	jne    f0107fb2 <spin_unlock+0x49>
+#ifdef DEBUG_SPINLOCK
+  if (!holding(lk)) {
+    int i;
+    uint32_t pcs[10];
+    // Nab the acquiring EIP chain before it gets released
+    memmove(pcs, lk->pcs, sizeof pcs);
+f0107f7a:	83 ec 04             	sub    $0x4,%esp
+f0107f7d:	6a 28                	push   $0x28
+f0107f7f:	8d 46 0c             	lea    0xc(%esi),%eax
+f0107f82:	50                   	push   %eax
+f0107f83:	8d 5d c0             	lea    -0x40(%ebp),%ebx
+f0107f86:	53                   	push   %ebx
+f0107f87:	e8 25 f7 ff ff       	call   f01076b1 <memmove>
+    cprintf("CPU %d cannot release %s: held by CPU %d\nAcquired at:",
+            cpunum(), lk->name, lk->cpu->cpu_id);
+f0107f8c:	8b 46 08             	mov    0x8(%esi),%eax
+    cprintf("CPU %d cannot release %s: held by CPU %d\nAcquired at:",
+f0107f8f:	0f b6 38             	movzbl (%eax),%edi
+f0107f92:	8b 76 04             	mov    0x4(%esi),%esi
+f0107f95:	e8 c5 fc ff ff       	call   f0107c5f <cpunum>
+f0107f9a:	57                   	push   %edi
+f0107f9b:	56                   	push   %esi
+f0107f9c:	50                   	push   %eax
+f0107f9d:	68 14 a4 10 f0       	push   $0xf010a414
+f0107fa2:	e8 85 c4 ff ff       	call   f010442c <cprintf>
+    for (i = 0; i < 10 && pcs[i]; i++) {
+f0107fa7:	8d 7d e8             	lea    -0x18(%ebp),%edi
+f0107faa:	83 c4 20             	add    $0x20,%esp
+      struct Eipdebuginfo info;
+      if (debuginfo_eip(pcs[i], &info) >= 0)
+f0107fad:	8d 75 a8             	lea    -0x58(%ebp),%esi
+    for (i = 0; i < 10 && pcs[i]; i++) {
+f0107fb0:	eb 4a                	jmp    f0107ffc <spin_unlock+0x93>
+  return lock->locked && lock->cpu == thiscpu;
+f0107fb2:	8b 5e 08             	mov    0x8(%esi),%ebx
+f0107fb5:	e8 a5 fc ff ff       	call   f0107c5f <cpunum>
+f0107fba:	6b c0 74             	imul   $0x74,%eax,%eax
+f0107fbd:	05 20 c0 79 f0       	add    $0xf079c020,%eax
+  if (!holding(lk)) {
+f0107fc2:	39 c3                	cmp    %eax,%ebx
+f0107fc4:	75 b4                	jne    f0107f7a <spin_unlock+0x11>
+        cprintf("  %08x\n", pcs[i]);
+    }
+    panic("spin_unlock");
+  }
+
+  lk->pcs[0] = 0;
+f0107fc6:	c7 46 0c 00 00 00 00 	movl   $0x0,0xc(%esi)
+  lk->cpu = 0;
+f0107fcd:	c7 46 08 00 00 00 00 	movl   $0x0,0x8(%esi)
+  asm volatile ("lock; xchgl %0, %1" :
+f0107fd4:	b8 00 00 00 00       	mov    $0x0,%eax
+f0107fd9:	f0 87 06             	lock xchg %eax,(%esi)
+  // Paper says that Intel 64 and IA-32 will not move a load
+  // after a store. So lock->locked = 0 would work here.
+  // The xchg being asm volatile ensures gcc emits it after
+  // the above assignments (and after the critical section).
+  xchg(&lk->locked, 0);
+}
+f0107fdc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+f0107fdf:	5b                   	pop    %ebx
+f0107fe0:	5e                   	pop    %esi
+f0107fe1:	5f                   	pop    %edi
+f0107fe2:	5d                   	pop    %ebp
+f0107fe3:	c3                   	ret
+        cprintf("  %08x\n", pcs[i]);
+f0107fe4:	83 ec 08             	sub    $0x8,%esp
+f0107fe7:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+f0107fea:	ff 30                	push   (%eax)
+f0107fec:	68 71 a4 10 f0       	push   $0xf010a471
+f0107ff1:	e8 36 c4 ff ff       	call   f010442c <cprintf>
+f0107ff6:	83 c4 10             	add    $0x10,%esp
+    for (i = 0; i < 10 && pcs[i]; i++) {
+f0107ff9:	83 c3 04             	add    $0x4,%ebx
+f0107ffc:	39 fb                	cmp    %edi,%ebx
+f0107ffe:	74 44                	je     f0108044 <spin_unlock+0xdb>
+f0108000:	89 5d a4             	mov    %ebx,-0x5c(%ebp)
+f0108003:	8b 03                	mov    (%ebx),%eax
+f0108005:	85 c0                	test   %eax,%eax
+f0108007:	74 3b                	je     f0108044 <spin_unlock+0xdb>
+      if (debuginfo_eip(pcs[i], &info) >= 0)
+f0108009:	83 ec 08             	sub    $0x8,%esp
+f010800c:	56                   	push   %esi
+f010800d:	50                   	push   %eax
+f010800e:	e8 38 eb ff ff       	call   f0106b4b <debuginfo_eip>
+f0108013:	83 c4 10             	add    $0x10,%esp
+f0108016:	85 c0                	test   %eax,%eax
+f0108018:	78 ca                	js     f0107fe4 <spin_unlock+0x7b>
+                pcs[i] - info.eip_fn_addr);
+f010801a:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+f010801d:	8b 00                	mov    (%eax),%eax
+        cprintf("  %08x %s:%d: %.*s+%x\n", pcs[i],
+f010801f:	83 ec 04             	sub    $0x4,%esp
+f0108022:	89 c2                	mov    %eax,%edx
+f0108024:	2b 55 b8             	sub    -0x48(%ebp),%edx
+f0108027:	52                   	push   %edx
+f0108028:	ff 75 b0             	push   -0x50(%ebp)
+f010802b:	ff 75 b4             	push   -0x4c(%ebp)
+f010802e:	ff 75 ac             	push   -0x54(%ebp)
+f0108031:	ff 75 a8             	push   -0x58(%ebp)
+f0108034:	50                   	push   %eax
+f0108035:	68 5a a4 10 f0       	push   $0xf010a45a
+f010803a:	e8 ed c3 ff ff       	call   f010442c <cprintf>
+f010803f:	83 c4 20             	add    $0x20,%esp
+f0108042:	eb b5                	jmp    f0107ff9 <spin_unlock+0x90>
+    panic("spin_unlock");
+f0108044:	83 ec 04             	sub    $0x4,%esp
+f0108047:	68 79 a4 10 f0       	push   $0xf010a479
+f010804c:	6a 67                	push   $0x67
+f010804e:	68 4a a4 10 f0       	push   $0xf010a44a
+f0108053:	e8 e8 7f ff ff       	call   f0100040 <_panic>
+
+f0108058 <udivmod>:
+f0108058:	55                   	push   %ebp
+f0108059:	57                   	push   %edi
+f010805a:	56                   	push   %esi
+f010805b:	53                   	push   %ebx
+f010805c:	83 ec 14             	sub    $0x14,%esp
+f010805f:	8b 74 24 28          	mov    0x28(%esp),%esi
+f0108063:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+f0108067:	89 fb                	mov    %edi,%ebx
+f0108069:	09 f3                	or     %esi,%ebx
+f010806b:	0f 84 88 00 00 00    	je     f01080f9 <udivmod+0xa1>
+f0108071:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+f0108076:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+f010807d:	00 
+f010807e:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+f0108085:	00 
+f0108086:	89 cd                	mov    %ecx,%ebp
+f0108088:	89 34 24             	mov    %esi,(%esp)
+f010808b:	89 7c 24 04          	mov    %edi,0x4(%esp)
+f010808f:	eb 08                	jmp    f0108099 <udivmod+0x41>
+f0108091:	83 ed 01             	sub    $0x1,%ebp
+f0108094:	83 fd ff             	cmp    $0xffffffff,%ebp
+f0108097:	74 6c                	je     f0108105 <udivmod+0xad>
+f0108099:	89 c3                	mov    %eax,%ebx
+f010809b:	89 d6                	mov    %edx,%esi
+f010809d:	89 e9                	mov    %ebp,%ecx
+f010809f:	0f ad f3             	shrd   %cl,%esi,%ebx
+f01080a2:	d3 ee                	shr    %cl,%esi
+f01080a4:	f6 c1 20             	test   $0x20,%cl
+f01080a7:	74 04                	je     f01080ad <udivmod+0x55>
+f01080a9:	89 f3                	mov    %esi,%ebx
+f01080ab:	31 f6                	xor    %esi,%esi
+f01080ad:	8b 3c 24             	mov    (%esp),%edi
+f01080b0:	39 fb                	cmp    %edi,%ebx
+f01080b2:	89 f7                	mov    %esi,%edi
+f01080b4:	8b 1c 24             	mov    (%esp),%ebx
+f01080b7:	8b 74 24 04          	mov    0x4(%esp),%esi
+f01080bb:	19 f7                	sbb    %esi,%edi
+f01080bd:	72 d2                	jb     f0108091 <udivmod+0x39>
+f01080bf:	89 f7                	mov    %esi,%edi
+f01080c1:	89 de                	mov    %ebx,%esi
+f01080c3:	89 e9                	mov    %ebp,%ecx
+f01080c5:	0f a5 f7             	shld   %cl,%esi,%edi
+f01080c8:	d3 e6                	shl    %cl,%esi
+f01080ca:	f6 c1 20             	test   $0x20,%cl
+f01080cd:	74 04                	je     f01080d3 <udivmod+0x7b>
+f01080cf:	89 f7                	mov    %esi,%edi
+f01080d1:	31 f6                	xor    %esi,%esi
+f01080d3:	29 f0                	sub    %esi,%eax
+f01080d5:	19 fa                	sbb    %edi,%edx
+f01080d7:	be 01 00 00 00       	mov    $0x1,%esi
+f01080dc:	bf 00 00 00 00       	mov    $0x0,%edi
+f01080e1:	0f a5 f7             	shld   %cl,%esi,%edi
+f01080e4:	d3 e6                	shl    %cl,%esi
+f01080e6:	f6 c1 20             	test   $0x20,%cl
+f01080e9:	74 04                	je     f01080ef <udivmod+0x97>
+f01080eb:	89 f7                	mov    %esi,%edi
+f01080ed:	31 f6                	xor    %esi,%esi
+f01080ef:	09 74 24 08          	or     %esi,0x8(%esp)
+f01080f3:	09 7c 24 0c          	or     %edi,0xc(%esp)
+f01080f7:	eb 98                	jmp    f0108091 <udivmod+0x39>
+f01080f9:	89 f0                	mov    %esi,%eax
+f01080fb:	89 fa                	mov    %edi,%edx
+f01080fd:	89 74 24 08          	mov    %esi,0x8(%esp)
+f0108101:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+f0108105:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+f0108109:	89 01                	mov    %eax,(%ecx)
+f010810b:	89 51 04             	mov    %edx,0x4(%ecx)
+f010810e:	8b 44 24 08          	mov    0x8(%esp),%eax
+f0108112:	8b 54 24 0c          	mov    0xc(%esp),%edx
+f0108116:	83 c4 14             	add    $0x14,%esp
+f0108119:	5b                   	pop    %ebx
+f010811a:	5e                   	pop    %esi
+f010811b:	5f                   	pop    %edi
+f010811c:	5d                   	pop    %ebp
+f010811d:	c3                   	ret
+
+f010811e <__udivdi3>:
+f010811e:	83 ec 18             	sub    $0x18,%esp
+f0108121:	8d 44 24 0c          	lea    0xc(%esp),%eax
+f0108125:	50                   	push   %eax
+f0108126:	ff 74 24 2c          	push   0x2c(%esp)
+f010812a:	ff 74 24 2c          	push   0x2c(%esp)
+f010812e:	8b 44 24 28          	mov    0x28(%esp),%eax
+f0108132:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+f0108136:	e8 1d ff ff ff       	call   f0108058 <udivmod>
+f010813b:	83 c4 24             	add    $0x24,%esp
+f010813e:	c3                   	ret
+
+f010813f <__umoddi3>:
+f010813f:	83 ec 18             	sub    $0x18,%esp
+f0108142:	8d 44 24 0c          	lea    0xc(%esp),%eax
+f0108146:	50                   	push   %eax
+f0108147:	ff 74 24 2c          	push   0x2c(%esp)
+f010814b:	ff 74 24 2c          	push   0x2c(%esp)
+f010814f:	8b 44 24 28          	mov    0x28(%esp),%eax
+f0108153:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+f0108157:	e8 fc fe ff ff       	call   f0108058 <udivmod>
+f010815c:	8b 44 24 18          	mov    0x18(%esp),%eax
+f0108160:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+f0108164:	83 c4 24             	add    $0x24,%esp
+f0108167:	c3                   	ret
+
+f0108168 <__divdi3>:
+f0108168:	56                   	push   %esi
+f0108169:	53                   	push   %ebx
+f010816a:	83 ec 14             	sub    $0x14,%esp
+f010816d:	8b 44 24 20          	mov    0x20(%esp),%eax
+f0108171:	8b 54 24 24          	mov    0x24(%esp),%edx
+f0108175:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+f0108179:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+f010817d:	85 d2                	test   %edx,%edx
+f010817f:	78 18                	js     f0108199 <__divdi3+0x31>
+f0108181:	85 db                	test   %ebx,%ebx
+f0108183:	78 3e                	js     f01081c3 <__divdi3+0x5b>
+f0108185:	83 ec 04             	sub    $0x4,%esp
+f0108188:	8d 74 24 0c          	lea    0xc(%esp),%esi
+f010818c:	56                   	push   %esi
+f010818d:	53                   	push   %ebx
+f010818e:	51                   	push   %ecx
+f010818f:	e8 c4 fe ff ff       	call   f0108058 <udivmod>
+f0108194:	83 c4 10             	add    $0x10,%esp
+f0108197:	eb 24                	jmp    f01081bd <__divdi3+0x55>
+f0108199:	f7 d8                	neg    %eax
+f010819b:	83 d2 00             	adc    $0x0,%edx
+f010819e:	f7 da                	neg    %edx
+f01081a0:	85 db                	test   %ebx,%ebx
+f01081a2:	78 3a                	js     f01081de <__divdi3+0x76>
+f01081a4:	83 ec 04             	sub    $0x4,%esp
+f01081a7:	8d 74 24 0c          	lea    0xc(%esp),%esi
+f01081ab:	56                   	push   %esi
+f01081ac:	53                   	push   %ebx
+f01081ad:	51                   	push   %ecx
+f01081ae:	e8 a5 fe ff ff       	call   f0108058 <udivmod>
+f01081b3:	83 c4 10             	add    $0x10,%esp
+f01081b6:	f7 d8                	neg    %eax
+f01081b8:	83 d2 00             	adc    $0x0,%edx
+f01081bb:	f7 da                	neg    %edx
+f01081bd:	83 c4 14             	add    $0x14,%esp
+f01081c0:	5b                   	pop    %ebx
+f01081c1:	5e                   	pop    %esi
+f01081c2:	c3                   	ret
+f01081c3:	83 ec 04             	sub    $0x4,%esp
+f01081c6:	8d 74 24 0c          	lea    0xc(%esp),%esi
+f01081ca:	56                   	push   %esi
+f01081cb:	f7 d9                	neg    %ecx
+f01081cd:	83 d3 00             	adc    $0x0,%ebx
+f01081d0:	f7 db                	neg    %ebx
+f01081d2:	53                   	push   %ebx
+f01081d3:	51                   	push   %ecx
+f01081d4:	e8 7f fe ff ff       	call   f0108058 <udivmod>
+f01081d9:	83 c4 10             	add    $0x10,%esp
+f01081dc:	eb d8                	jmp    f01081b6 <__divdi3+0x4e>
+f01081de:	83 ec 04             	sub    $0x4,%esp
+f01081e1:	8d 74 24 0c          	lea    0xc(%esp),%esi
+f01081e5:	56                   	push   %esi
+f01081e6:	f7 d9                	neg    %ecx
+f01081e8:	83 d3 00             	adc    $0x0,%ebx
+f01081eb:	f7 db                	neg    %ebx
+f01081ed:	53                   	push   %ebx
+f01081ee:	51                   	push   %ecx
+f01081ef:	e8 64 fe ff ff       	call   f0108058 <udivmod>
+f01081f4:	83 c4 10             	add    $0x10,%esp
+f01081f7:	eb c4                	jmp    f01081bd <__divdi3+0x55>
+
+f01081f9 <__moddi3>:
+f01081f9:	55                   	push   %ebp
+f01081fa:	57                   	push   %edi
+f01081fb:	56                   	push   %esi
+f01081fc:	53                   	push   %ebx
+f01081fd:	83 ec 24             	sub    $0x24,%esp
+f0108200:	8b 44 24 38          	mov    0x38(%esp),%eax
+f0108204:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+f0108208:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+f010820c:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+f0108210:	85 d2                	test   %edx,%edx
+f0108212:	78 3b                	js     f010824f <__moddi3+0x56>
+f0108214:	83 ec 04             	sub    $0x4,%esp
+f0108217:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+f010821b:	56                   	push   %esi
+f010821c:	89 ce                	mov    %ecx,%esi
+f010821e:	f7 de                	neg    %esi
+f0108220:	89 74 24 08          	mov    %esi,0x8(%esp)
+f0108224:	89 de                	mov    %ebx,%esi
+f0108226:	83 d6 00             	adc    $0x0,%esi
+f0108229:	f7 de                	neg    %esi
+f010822b:	89 74 24 14          	mov    %esi,0x14(%esp)
+f010822f:	8b 74 24 08          	mov    0x8(%esp),%esi
+f0108233:	0f 48 f1             	cmovs  %ecx,%esi
+f0108236:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+f010823b:	53                   	push   %ebx
+f010823c:	56                   	push   %esi
+f010823d:	e8 16 fe ff ff       	call   f0108058 <udivmod>
+f0108242:	8b 44 24 28          	mov    0x28(%esp),%eax
+f0108246:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+f010824a:	83 c4 10             	add    $0x10,%esp
+f010824d:	eb 47                	jmp    f0108296 <__moddi3+0x9d>
+f010824f:	f7 d8                	neg    %eax
+f0108251:	83 d2 00             	adc    $0x0,%edx
+f0108254:	f7 da                	neg    %edx
+f0108256:	83 ec 04             	sub    $0x4,%esp
+f0108259:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+f010825d:	56                   	push   %esi
+f010825e:	89 cf                	mov    %ecx,%edi
+f0108260:	f7 df                	neg    %edi
+f0108262:	89 de                	mov    %ebx,%esi
+f0108264:	83 d6 00             	adc    $0x0,%esi
+f0108267:	f7 de                	neg    %esi
+f0108269:	0f 49 cf             	cmovns %edi,%ecx
+f010826c:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+f0108270:	0f 49 de             	cmovns %esi,%ebx
+f0108273:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+f0108277:	ff 74 24 0c          	push   0xc(%esp)
+f010827b:	ff 74 24 0c          	push   0xc(%esp)
+f010827f:	e8 d4 fd ff ff       	call   f0108058 <udivmod>
+f0108284:	8b 44 24 28          	mov    0x28(%esp),%eax
+f0108288:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+f010828c:	f7 d8                	neg    %eax
+f010828e:	83 d2 00             	adc    $0x0,%edx
+f0108291:	f7 da                	neg    %edx
+f0108293:	83 c4 10             	add    $0x10,%esp
+f0108296:	83 c4 24             	add    $0x24,%esp
+f0108299:	5b                   	pop    %ebx
+f010829a:	5e                   	pop    %esi
+f010829b:	5f                   	pop    %edi
+f010829c:	5d                   	pop    %ebp
+f010829d:	c3                   	ret
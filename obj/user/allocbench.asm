@@ -0,0 +1,6622 @@
+
+obj/user/allocbench.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 8a 02 00 00       	call   8002bb <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <mkfile>:
+}
+
+// Create or reset 'path', optionally appending FILEBLOCKS blocks to it.
+static void
+mkfile(const char *path, bool append)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 24             	sub    $0x24,%esp
+  80003c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80003f:	89 d7                	mov    %edx,%edi
+  int fd, i, r;
+
+  if ((fd = open(path, O_RDWR | O_CREAT | O_TRUNC)) < 0)
+  800041:	68 02 03 00 00       	push   $0x302
+  800046:	50                   	push   %eax
+  800047:	e8 d3 1d 00 00       	call   801e1f <open>
+  80004c:	89 c6                	mov    %eax,%esi
+  80004e:	83 c4 10             	add    $0x10,%esp
+  800051:	85 c0                	test   %eax,%eax
+  800053:	78 32                	js     800087 <mkfile+0x54>
+    panic("open %s: %e", path, fd);
+  for (i = 0; append && i < FILEBLOCKS; i++)
+  800055:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80005a:	83 fb 01             	cmp    $0x1,%ebx
+  80005d:	7f 58                	jg     8000b7 <mkfile+0x84>
+  80005f:	89 f8                	mov    %edi,%eax
+  800061:	84 c0                	test   %al,%al
+  800063:	74 52                	je     8000b7 <mkfile+0x84>
+    if ((r = write(fd, buf, BLKSIZE)) != BLKSIZE)
+  800065:	83 ec 04             	sub    $0x4,%esp
+  800068:	68 00 10 00 00       	push   $0x1000
+  80006d:	68 00 50 80 00       	push   $0x805000
+  800072:	56                   	push   %esi
+  800073:	e8 4a 16 00 00       	call   8016c2 <write>
+  800078:	83 c4 10             	add    $0x10,%esp
+  80007b:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800080:	75 1d                	jne    80009f <mkfile+0x6c>
+  for (i = 0; append && i < FILEBLOCKS; i++)
+  800082:	83 c3 01             	add    $0x1,%ebx
+  800085:	eb d3                	jmp    80005a <mkfile+0x27>
+    panic("open %s: %e", path, fd);
+  800087:	83 ec 0c             	sub    $0xc,%esp
+  80008a:	50                   	push   %eax
+  80008b:	ff 75 e4             	push   -0x1c(%ebp)
+  80008e:	68 e0 30 80 00       	push   $0x8030e0
+  800093:	6a 2a                	push   $0x2a
+  800095:	68 ec 30 80 00       	push   $0x8030ec
+  80009a:	e8 89 02 00 00       	call   800328 <_panic>
+      panic("write %s: %e", path, r);
+  80009f:	83 ec 0c             	sub    $0xc,%esp
+  8000a2:	50                   	push   %eax
+  8000a3:	ff 75 e4             	push   -0x1c(%ebp)
+  8000a6:	68 fe 30 80 00       	push   $0x8030fe
+  8000ab:	6a 2d                	push   $0x2d
+  8000ad:	68 ec 30 80 00       	push   $0x8030ec
+  8000b2:	e8 71 02 00 00       	call   800328 <_panic>
+  close(fd);
+  8000b7:	83 ec 0c             	sub    $0xc,%esp
+  8000ba:	56                   	push   %esi
+  8000bb:	e8 ac 13 00 00       	call   80146c <close>
+}
+  8000c0:	83 c4 10             	add    $0x10,%esp
+  8000c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000c6:	5b                   	pop    %ebx
+  8000c7:	5e                   	pop    %esi
+  8000c8:	5f                   	pop    %edi
+  8000c9:	5d                   	pop    %ebp
+  8000ca:	c3                   	ret
+
+008000cb <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8000cb:	55                   	push   %ebp
+  8000cc:	89 e5                	mov    %esp,%ebp
+  8000ce:	57                   	push   %edi
+  8000cf:	56                   	push   %esi
+  8000d0:	53                   	push   %ebx
+  8000d1:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  char path[MAXNAMELEN];
+  unsigned start, ms;
+  off_t filled;
+  int i, n;
+
+  binaryname = "allocbench";
+  8000d7:	c7 05 00 40 80 00 0b 	movl   $0x80310b,0x804000
+  8000de:	31 80 00 
+  n = 16;
+  8000e1:	be 10 00 00 00       	mov    $0x10,%esi
+  if (argc > 1)
+  8000e6:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+  8000ea:	7f 22                	jg     80010e <umain+0x43>
+  if ((fd = open(FILLNAME, O_RDWR | O_CREAT | O_TRUNC)) < 0)
+  8000ec:	83 ec 08             	sub    $0x8,%esp
+  8000ef:	68 02 03 00 00       	push   $0x302
+  8000f4:	68 16 31 80 00       	push   $0x803116
+  8000f9:	e8 21 1d 00 00       	call   801e1f <open>
+  8000fe:	89 c3                	mov    %eax,%ebx
+  800100:	83 c4 10             	add    $0x10,%esp
+  800103:	85 c0                	test   %eax,%eax
+  800105:	78 20                	js     800127 <umain+0x5c>
+  for (size = 0; (r = write(fd, buf, BLKSIZE)) == BLKSIZE; size += BLKSIZE)
+  800107:	bf 00 00 00 00       	mov    $0x0,%edi
+  80010c:	eb 39                	jmp    800147 <umain+0x7c>
+    n = strtol(argv[1], 0, 0);
+  80010e:	83 ec 04             	sub    $0x4,%esp
+  800111:	6a 00                	push   $0x0
+  800113:	6a 00                	push   $0x0
+  800115:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800118:	ff 70 04             	push   0x4(%eax)
+  80011b:	e8 25 0b 00 00       	call   800c45 <strtol>
+  800120:	89 c6                	mov    %eax,%esi
+  800122:	83 c4 10             	add    $0x10,%esp
+  800125:	eb c5                	jmp    8000ec <umain+0x21>
+    panic("open %s: %e", FILLNAME, fd);
+  800127:	83 ec 0c             	sub    $0xc,%esp
+  80012a:	50                   	push   %eax
+  80012b:	68 16 31 80 00       	push   $0x803116
+  800130:	68 e0 30 80 00       	push   $0x8030e0
+  800135:	6a 17                	push   $0x17
+  800137:	68 ec 30 80 00       	push   $0x8030ec
+  80013c:	e8 e7 01 00 00       	call   800328 <_panic>
+  for (size = 0; (r = write(fd, buf, BLKSIZE)) == BLKSIZE; size += BLKSIZE)
+  800141:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  800147:	83 ec 04             	sub    $0x4,%esp
+  80014a:	68 00 10 00 00       	push   $0x1000
+  80014f:	68 00 50 80 00       	push   $0x805000
+  800154:	53                   	push   %ebx
+  800155:	e8 68 15 00 00       	call   8016c2 <write>
+  80015a:	83 c4 10             	add    $0x10,%esp
+  80015d:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800162:	74 dd                	je     800141 <umain+0x76>
+  if (r < 0 && r != -E_NO_DISK && r != -E_FILE_EXISTS && r != -E_INVAL)
+  800164:	89 c2                	mov    %eax,%edx
+  800166:	83 e2 fb             	and    $0xfffffffb,%edx
+  800169:	83 fa f3             	cmp    $0xfffffff3,%edx
+  80016c:	74 09                	je     800177 <umain+0xac>
+  80016e:	85 c0                	test   %eax,%eax
+  800170:	79 05                	jns    800177 <umain+0xac>
+  800172:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  800175:	75 55                	jne    8001cc <umain+0x101>
+  size = ROUNDDOWN(size / 100 * pct, BLKSIZE);
+  800177:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+  80017c:	89 f8                	mov    %edi,%eax
+  80017e:	f7 ea                	imul   %edx
+  800180:	c1 fa 05             	sar    $0x5,%edx
+  800183:	c1 ff 1f             	sar    $0x1f,%edi
+  800186:	29 fa                	sub    %edi,%edx
+  800188:	6b d2 5a             	imul   $0x5a,%edx,%edx
+  80018b:	81 e2 00 f0 ff ff    	and    $0xfffff000,%edx
+  800191:	89 95 64 ff ff ff    	mov    %edx,-0x9c(%ebp)
+  if ((r = ftruncate(fd, size)) < 0)
+  800197:	83 ec 08             	sub    $0x8,%esp
+  80019a:	52                   	push   %edx
+  80019b:	53                   	push   %ebx
+  80019c:	e8 cc 15 00 00       	call   80176d <ftruncate>
+  8001a1:	83 c4 10             	add    $0x10,%esp
+  8001a4:	85 c0                	test   %eax,%eax
+  8001a6:	78 3e                	js     8001e6 <umain+0x11b>
+  close(fd);
+  8001a8:	83 ec 0c             	sub    $0xc,%esp
+  8001ab:	53                   	push   %ebx
+  8001ac:	e8 bb 12 00 00       	call   80146c <close>
+
+  filled = fill(90);
+
+  start = sys_time_msec();
+  8001b1:	e8 84 0f 00 00       	call   80113a <sys_time_msec>
+  8001b6:	89 85 60 ff ff ff    	mov    %eax,-0xa0(%ebp)
+  for (i = 0; i < n; i++) {
+  8001bc:	83 c4 10             	add    $0x10,%esp
+  8001bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+    snprintf(path, sizeof(path), "/allocbench.%d", i);
+  8001c4:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (i = 0; i < n; i++) {
+  8001ca:	eb 57                	jmp    800223 <umain+0x158>
+    panic("write %s: %e", FILLNAME, r);
+  8001cc:	83 ec 0c             	sub    $0xc,%esp
+  8001cf:	50                   	push   %eax
+  8001d0:	68 16 31 80 00       	push   $0x803116
+  8001d5:	68 fe 30 80 00       	push   $0x8030fe
+  8001da:	6a 1b                	push   $0x1b
+  8001dc:	68 ec 30 80 00       	push   $0x8030ec
+  8001e1:	e8 42 01 00 00       	call   800328 <_panic>
+    panic("ftruncate %s: %e", FILLNAME, r);
+  8001e6:	83 ec 0c             	sub    $0xc,%esp
+  8001e9:	50                   	push   %eax
+  8001ea:	68 16 31 80 00       	push   $0x803116
+  8001ef:	68 27 31 80 00       	push   $0x803127
+  8001f4:	6a 1e                	push   $0x1e
+  8001f6:	68 ec 30 80 00       	push   $0x8030ec
+  8001fb:	e8 28 01 00 00       	call   800328 <_panic>
+    snprintf(path, sizeof(path), "/allocbench.%d", i);
+  800200:	53                   	push   %ebx
+  800201:	68 38 31 80 00       	push   $0x803138
+  800206:	68 80 00 00 00       	push   $0x80
+  80020b:	57                   	push   %edi
+  80020c:	e8 8b 07 00 00       	call   80099c <snprintf>
+    mkfile(path, 1);
+  800211:	ba 01 00 00 00       	mov    $0x1,%edx
+  800216:	89 f8                	mov    %edi,%eax
+  800218:	e8 16 fe ff ff       	call   800033 <mkfile>
+  for (i = 0; i < n; i++) {
+  80021d:	83 c3 01             	add    $0x1,%ebx
+  800220:	83 c4 10             	add    $0x10,%esp
+  800223:	39 f3                	cmp    %esi,%ebx
+  800225:	7c d9                	jl     800200 <umain+0x135>
+  }
+  ms = sys_time_msec() - start;
+  800227:	e8 0e 0f 00 00       	call   80113a <sys_time_msec>
+  80022c:	8b 8d 60 ff ff ff    	mov    -0xa0(%ebp),%ecx
+  800232:	29 c8                	sub    %ecx,%eax
+  800234:	89 c1                	mov    %eax,%ecx
+
+  cprintf("allocbench: %d KB filler, %d files x %d blocks in %d ms "
+  800236:	83 ec 08             	sub    $0x8,%esp
+          "= %d us/block\n", filled / 1024, n, FILEBLOCKS, ms,
+          ms * 1000 / (n * FILEBLOCKS));
+  800239:	69 c0 e8 03 00 00    	imul   $0x3e8,%eax,%eax
+  80023f:	8d 1c 36             	lea    (%esi,%esi,1),%ebx
+  cprintf("allocbench: %d KB filler, %d files x %d blocks in %d ms "
+  800242:	ba 00 00 00 00       	mov    $0x0,%edx
+  800247:	f7 f3                	div    %ebx
+  800249:	50                   	push   %eax
+  80024a:	51                   	push   %ecx
+  80024b:	6a 02                	push   $0x2
+  80024d:	56                   	push   %esi
+  80024e:	8b 8d 64 ff ff ff    	mov    -0x9c(%ebp),%ecx
+  800254:	8d 81 ff 03 00 00    	lea    0x3ff(%ecx),%eax
+  80025a:	85 c9                	test   %ecx,%ecx
+  80025c:	0f 49 c1             	cmovns %ecx,%eax
+  80025f:	c1 f8 0a             	sar    $0xa,%eax
+  800262:	50                   	push   %eax
+  800263:	68 48 31 80 00       	push   $0x803148
+  800268:	e8 96 01 00 00       	call   800403 <cprintf>
+
+  // There is no remove, so give the space back by truncating.
+  for (i = 0; i < n; i++) {
+  80026d:	83 c4 20             	add    $0x20,%esp
+  800270:	bb 00 00 00 00       	mov    $0x0,%ebx
+    snprintf(path, sizeof(path), "/allocbench.%d", i);
+  800275:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (i = 0; i < n; i++) {
+  80027b:	eb 23                	jmp    8002a0 <umain+0x1d5>
+    snprintf(path, sizeof(path), "/allocbench.%d", i);
+  80027d:	53                   	push   %ebx
+  80027e:	68 38 31 80 00       	push   $0x803138
+  800283:	68 80 00 00 00       	push   $0x80
+  800288:	57                   	push   %edi
+  800289:	e8 0e 07 00 00       	call   80099c <snprintf>
+    mkfile(path, 0);
+  80028e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800293:	89 f8                	mov    %edi,%eax
+  800295:	e8 99 fd ff ff       	call   800033 <mkfile>
+  for (i = 0; i < n; i++) {
+  80029a:	83 c3 01             	add    $0x1,%ebx
+  80029d:	83 c4 10             	add    $0x10,%esp
+  8002a0:	39 f3                	cmp    %esi,%ebx
+  8002a2:	7c d9                	jl     80027d <umain+0x1b2>
+  }
+  mkfile(FILLNAME, 0);
+  8002a4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002a9:	b8 16 31 80 00       	mov    $0x803116,%eax
+  8002ae:	e8 80 fd ff ff       	call   800033 <mkfile>
+}
+  8002b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002b6:	5b                   	pop    %ebx
+  8002b7:	5e                   	pop    %esi
+  8002b8:	5f                   	pop    %edi
+  8002b9:	5d                   	pop    %ebp
+  8002ba:	c3                   	ret
+
+008002bb <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8002bb:	55                   	push   %ebp
+  8002bc:	89 e5                	mov    %esp,%ebp
+  8002be:	56                   	push   %esi
+  8002bf:	53                   	push   %ebx
+  8002c0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8002c3:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  8002c6:	c7 05 44 67 80 00 00 	movl   $0x0,0x806744
+  8002cd:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  8002d0:	e8 ca 0a 00 00       	call   800d9f <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  8002d5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8002da:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8002dd:	c1 e0 04             	shl    $0x4,%eax
+  8002e0:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8002e5:	a3 44 67 80 00       	mov    %eax,0x806744
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8002ea:	85 db                	test   %ebx,%ebx
+  8002ec:	7e 07                	jle    8002f5 <libmain+0x3a>
+    binaryname = argv[0];
+  8002ee:	8b 06                	mov    (%esi),%eax
+  8002f0:	a3 00 40 80 00       	mov    %eax,0x804000
+
+  // call user main routine
+  umain(argc, argv);
+  8002f5:	83 ec 08             	sub    $0x8,%esp
+  8002f8:	56                   	push   %esi
+  8002f9:	53                   	push   %ebx
+  8002fa:	e8 cc fd ff ff       	call   8000cb <umain>
+
+  // exit gracefully
+  exit();
+  8002ff:	e8 0a 00 00 00       	call   80030e <exit>
+}
+  800304:	83 c4 10             	add    $0x10,%esp
+  800307:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80030a:	5b                   	pop    %ebx
+  80030b:	5e                   	pop    %esi
+  80030c:	5d                   	pop    %ebp
+  80030d:	c3                   	ret
+
+0080030e <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80030e:	55                   	push   %ebp
+  80030f:	89 e5                	mov    %esp,%ebp
+  800311:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  800314:	e8 80 11 00 00       	call   801499 <close_all>
+  sys_env_destroy(0);
+  800319:	83 ec 0c             	sub    $0xc,%esp
+  80031c:	6a 00                	push   $0x0
+  80031e:	e8 3b 0a 00 00       	call   800d5e <sys_env_destroy>
+}
+  800323:	83 c4 10             	add    $0x10,%esp
+  800326:	c9                   	leave
+  800327:	c3                   	ret
+
+00800328 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800328:	55                   	push   %ebp
+  800329:	89 e5                	mov    %esp,%ebp
+  80032b:	56                   	push   %esi
+  80032c:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  80032d:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  800330:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  800336:	e8 64 0a 00 00       	call   800d9f <sys_getenvid>
+  80033b:	83 ec 0c             	sub    $0xc,%esp
+  80033e:	ff 75 0c             	push   0xc(%ebp)
+  800341:	ff 75 08             	push   0x8(%ebp)
+  800344:	56                   	push   %esi
+  800345:	50                   	push   %eax
+  800346:	68 9c 31 80 00       	push   $0x80319c
+  80034b:	e8 b3 00 00 00       	call   800403 <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  800350:	83 c4 18             	add    $0x18,%esp
+  800353:	53                   	push   %ebx
+  800354:	ff 75 10             	push   0x10(%ebp)
+  800357:	e8 56 00 00 00       	call   8003b2 <vcprintf>
+  cprintf("\n");
+  80035c:	c7 04 24 00 36 80 00 	movl   $0x803600,(%esp)
+  800363:	e8 9b 00 00 00       	call   800403 <cprintf>
+  800368:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  80036b:	cc                   	int3
+  while (1)
+  80036c:	eb fd                	jmp    80036b <_panic+0x43>
+
+0080036e <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80036e:	55                   	push   %ebp
+  80036f:	89 e5                	mov    %esp,%ebp
+  800371:	53                   	push   %ebx
+  800372:	83 ec 04             	sub    $0x4,%esp
+  800375:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  800378:	8b 13                	mov    (%ebx),%edx
+  80037a:	8d 42 01             	lea    0x1(%edx),%eax
+  80037d:	89 03                	mov    %eax,(%ebx)
+  80037f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800382:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  800386:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80038b:	74 09                	je     800396 <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  80038d:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800391:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800394:	c9                   	leave
+  800395:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  800396:	83 ec 08             	sub    $0x8,%esp
+  800399:	68 ff 00 00 00       	push   $0xff
+  80039e:	8d 43 08             	lea    0x8(%ebx),%eax
+  8003a1:	50                   	push   %eax
+  8003a2:	e8 7a 09 00 00       	call   800d21 <sys_cputs>
+    b->idx = 0;
+  8003a7:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8003ad:	83 c4 10             	add    $0x10,%esp
+  8003b0:	eb db                	jmp    80038d <putch+0x1f>
+
+008003b2 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8003b2:	55                   	push   %ebp
+  8003b3:	89 e5                	mov    %esp,%ebp
+  8003b5:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  8003bb:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8003c2:	00 00 00 
+  b.cnt = 0;
+  8003c5:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8003cc:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  8003cf:	ff 75 0c             	push   0xc(%ebp)
+  8003d2:	ff 75 08             	push   0x8(%ebp)
+  8003d5:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8003db:	50                   	push   %eax
+  8003dc:	68 6e 03 80 00       	push   $0x80036e
+  8003e1:	e8 14 01 00 00       	call   8004fa <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  8003e6:	83 c4 08             	add    $0x8,%esp
+  8003e9:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8003ef:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8003f5:	50                   	push   %eax
+  8003f6:	e8 26 09 00 00       	call   800d21 <sys_cputs>
+
+  return b.cnt;
+}
+  8003fb:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800401:	c9                   	leave
+  800402:	c3                   	ret
+
+00800403 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800403:	55                   	push   %ebp
+  800404:	89 e5                	mov    %esp,%ebp
+  800406:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  800409:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  80040c:	50                   	push   %eax
+  80040d:	ff 75 08             	push   0x8(%ebp)
+  800410:	e8 9d ff ff ff       	call   8003b2 <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  800415:	c9                   	leave
+  800416:	c3                   	ret
+
+00800417 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  800417:	55                   	push   %ebp
+  800418:	89 e5                	mov    %esp,%ebp
+  80041a:	57                   	push   %edi
+  80041b:	56                   	push   %esi
+  80041c:	53                   	push   %ebx
+  80041d:	83 ec 1c             	sub    $0x1c,%esp
+  800420:	89 c7                	mov    %eax,%edi
+  800422:	89 d6                	mov    %edx,%esi
+  800424:	8b 45 08             	mov    0x8(%ebp),%eax
+  800427:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80042a:	89 d1                	mov    %edx,%ecx
+  80042c:	89 c2                	mov    %eax,%edx
+  80042e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800431:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800434:	8b 45 10             	mov    0x10(%ebp),%eax
+  800437:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  80043a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80043d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800444:	39 c2                	cmp    %eax,%edx
+  800446:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800449:	72 3e                	jb     800489 <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  80044b:	83 ec 0c             	sub    $0xc,%esp
+  80044e:	ff 75 18             	push   0x18(%ebp)
+  800451:	83 eb 01             	sub    $0x1,%ebx
+  800454:	53                   	push   %ebx
+  800455:	50                   	push   %eax
+  800456:	83 ec 08             	sub    $0x8,%esp
+  800459:	ff 75 e4             	push   -0x1c(%ebp)
+  80045c:	ff 75 e0             	push   -0x20(%ebp)
+  80045f:	ff 75 dc             	push   -0x24(%ebp)
+  800462:	ff 75 d8             	push   -0x28(%ebp)
+  800465:	e8 db 2a 00 00       	call   802f45 <__udivdi3>
+  80046a:	83 c4 18             	add    $0x18,%esp
+  80046d:	52                   	push   %edx
+  80046e:	50                   	push   %eax
+  80046f:	89 f2                	mov    %esi,%edx
+  800471:	89 f8                	mov    %edi,%eax
+  800473:	e8 9f ff ff ff       	call   800417 <printnum>
+  800478:	83 c4 20             	add    $0x20,%esp
+  80047b:	eb 13                	jmp    800490 <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  80047d:	83 ec 08             	sub    $0x8,%esp
+  800480:	56                   	push   %esi
+  800481:	ff 75 18             	push   0x18(%ebp)
+  800484:	ff d7                	call   *%edi
+  800486:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  800489:	83 eb 01             	sub    $0x1,%ebx
+  80048c:	85 db                	test   %ebx,%ebx
+  80048e:	7f ed                	jg     80047d <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  800490:	83 ec 08             	sub    $0x8,%esp
+  800493:	56                   	push   %esi
+  800494:	83 ec 04             	sub    $0x4,%esp
+  800497:	ff 75 e4             	push   -0x1c(%ebp)
+  80049a:	ff 75 e0             	push   -0x20(%ebp)
+  80049d:	ff 75 dc             	push   -0x24(%ebp)
+  8004a0:	ff 75 d8             	push   -0x28(%ebp)
+  8004a3:	e8 be 2a 00 00       	call   802f66 <__umoddi3>
+  8004a8:	83 c4 14             	add    $0x14,%esp
+  8004ab:	0f be 80 bf 31 80 00 	movsbl 0x8031bf(%eax),%eax
+  8004b2:	50                   	push   %eax
+  8004b3:	ff d7                	call   *%edi
+}
+  8004b5:	83 c4 10             	add    $0x10,%esp
+  8004b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004bb:	5b                   	pop    %ebx
+  8004bc:	5e                   	pop    %esi
+  8004bd:	5f                   	pop    %edi
+  8004be:	5d                   	pop    %ebp
+  8004bf:	c3                   	ret
+
+008004c0 <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8004c0:	55                   	push   %ebp
+  8004c1:	89 e5                	mov    %esp,%ebp
+  8004c3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  8004c6:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  8004ca:	8b 10                	mov    (%eax),%edx
+  8004cc:	3b 50 04             	cmp    0x4(%eax),%edx
+  8004cf:	73 0a                	jae    8004db <sprintputch+0x1b>
+    *b->buf++ = ch;
+  8004d1:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8004d4:	89 08                	mov    %ecx,(%eax)
+  8004d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8004d9:	88 02                	mov    %al,(%edx)
+}
+  8004db:	5d                   	pop    %ebp
+  8004dc:	c3                   	ret
+
+008004dd <printfmt>:
+{
+  8004dd:	55                   	push   %ebp
+  8004de:	89 e5                	mov    %esp,%ebp
+  8004e0:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  8004e3:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  8004e6:	50                   	push   %eax
+  8004e7:	ff 75 10             	push   0x10(%ebp)
+  8004ea:	ff 75 0c             	push   0xc(%ebp)
+  8004ed:	ff 75 08             	push   0x8(%ebp)
+  8004f0:	e8 05 00 00 00       	call   8004fa <vprintfmt>
+}
+  8004f5:	83 c4 10             	add    $0x10,%esp
+  8004f8:	c9                   	leave
+  8004f9:	c3                   	ret
+
+008004fa <vprintfmt>:
+{
+  8004fa:	55                   	push   %ebp
+  8004fb:	89 e5                	mov    %esp,%ebp
+  8004fd:	57                   	push   %edi
+  8004fe:	56                   	push   %esi
+  8004ff:	53                   	push   %ebx
+  800500:	83 ec 2c             	sub    $0x2c,%esp
+  800503:	8b 75 08             	mov    0x8(%ebp),%esi
+  800506:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800509:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80050c:	eb 0a                	jmp    800518 <vprintfmt+0x1e>
+      putch(ch, putdat);
+  80050e:	83 ec 08             	sub    $0x8,%esp
+  800511:	53                   	push   %ebx
+  800512:	50                   	push   %eax
+  800513:	ff d6                	call   *%esi
+  800515:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  800518:	83 c7 01             	add    $0x1,%edi
+  80051b:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80051f:	83 f8 25             	cmp    $0x25,%eax
+  800522:	74 0c                	je     800530 <vprintfmt+0x36>
+      if (ch == '\0')
+  800524:	85 c0                	test   %eax,%eax
+  800526:	75 e6                	jne    80050e <vprintfmt+0x14>
+}
+  800528:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80052b:	5b                   	pop    %ebx
+  80052c:	5e                   	pop    %esi
+  80052d:	5f                   	pop    %edi
+  80052e:	5d                   	pop    %ebp
+  80052f:	c3                   	ret
+    padc = ' ';
+  800530:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  800534:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  80053b:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  800542:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  800549:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  80054e:	8d 47 01             	lea    0x1(%edi),%eax
+  800551:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800554:	0f b6 17             	movzbl (%edi),%edx
+  800557:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80055a:	3c 55                	cmp    $0x55,%al
+  80055c:	0f 87 cf 03 00 00    	ja     800931 <vprintfmt+0x437>
+  800562:	0f b6 c0             	movzbl %al,%eax
+  800565:	ff 24 85 00 33 80 00 	jmp    *0x803300(,%eax,4)
+  80056c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  80056f:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800573:	eb d9                	jmp    80054e <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  800575:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800578:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80057c:	eb d0                	jmp    80054e <vprintfmt+0x54>
+  80057e:	0f b6 d2             	movzbl %dl,%edx
+  800581:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  800584:	b8 00 00 00 00       	mov    $0x0,%eax
+  800589:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  80058c:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80058f:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  800593:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  800596:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800599:	83 f9 09             	cmp    $0x9,%ecx
+  80059c:	77 55                	ja     8005f3 <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  80059e:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  8005a1:	eb e9                	jmp    80058c <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  8005a3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a6:	8b 00                	mov    (%eax),%eax
+  8005a8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8005ab:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ae:	8d 40 04             	lea    0x4(%eax),%eax
+  8005b1:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  8005b4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  8005b7:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8005bb:	79 91                	jns    80054e <vprintfmt+0x54>
+        width = precision, precision = -1;
+  8005bd:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8005c0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005c3:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8005ca:	eb 82                	jmp    80054e <vprintfmt+0x54>
+      if (width < 0)
+  8005cc:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8005cf:	85 d2                	test   %edx,%edx
+  8005d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005d6:	0f 49 c2             	cmovns %edx,%eax
+  8005d9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  8005dc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  8005df:	e9 6a ff ff ff       	jmp    80054e <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  8005e4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  8005e7:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  8005ee:	e9 5b ff ff ff       	jmp    80054e <vprintfmt+0x54>
+  8005f3:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8005f6:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8005f9:	eb bc                	jmp    8005b7 <vprintfmt+0xbd>
+      lflag++;
+  8005fb:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  8005fe:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  800601:	e9 48 ff ff ff       	jmp    80054e <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  800606:	8b 45 14             	mov    0x14(%ebp),%eax
+  800609:	8d 78 04             	lea    0x4(%eax),%edi
+  80060c:	83 ec 08             	sub    $0x8,%esp
+  80060f:	53                   	push   %ebx
+  800610:	ff 30                	push   (%eax)
+  800612:	ff d6                	call   *%esi
+      break;
+  800614:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  800617:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  80061a:	e9 b1 02 00 00       	jmp    8008d0 <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  80061f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800622:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  800625:	8b 10                	mov    (%eax),%edx
+  800627:	89 d0                	mov    %edx,%eax
+  800629:	f7 d8                	neg    %eax
+  80062b:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80062e:	83 f8 10             	cmp    $0x10,%eax
+  800631:	7f 23                	jg     800656 <vprintfmt+0x15c>
+  800633:	8b 14 85 60 34 80 00 	mov    0x803460(,%eax,4),%edx
+  80063a:	85 d2                	test   %edx,%edx
+  80063c:	74 18                	je     800656 <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  80063e:	52                   	push   %edx
+  80063f:	68 aa 35 80 00       	push   $0x8035aa
+  800644:	53                   	push   %ebx
+  800645:	56                   	push   %esi
+  800646:	e8 92 fe ff ff       	call   8004dd <printfmt>
+  80064b:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  80064e:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800651:	e9 7a 02 00 00       	jmp    8008d0 <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  800656:	50                   	push   %eax
+  800657:	68 d7 31 80 00       	push   $0x8031d7
+  80065c:	53                   	push   %ebx
+  80065d:	56                   	push   %esi
+  80065e:	e8 7a fe ff ff       	call   8004dd <printfmt>
+  800663:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  800666:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  800669:	e9 62 02 00 00       	jmp    8008d0 <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  80066e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800671:	83 c0 04             	add    $0x4,%eax
+  800674:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800677:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067a:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  80067c:	85 c9                	test   %ecx,%ecx
+  80067e:	b8 d0 31 80 00       	mov    $0x8031d0,%eax
+  800683:	0f 45 c1             	cmovne %ecx,%eax
+  800686:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  800689:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80068d:	7e 06                	jle    800695 <vprintfmt+0x19b>
+  80068f:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800693:	75 0b                	jne    8006a0 <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800695:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800698:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80069b:	89 75 08             	mov    %esi,0x8(%ebp)
+  80069e:	eb 5c                	jmp    8006fc <vprintfmt+0x202>
+  8006a0:	83 ec 08             	sub    $0x8,%esp
+  8006a3:	ff 75 d0             	push   -0x30(%ebp)
+  8006a6:	ff 75 cc             	push   -0x34(%ebp)
+  8006a9:	e8 20 03 00 00       	call   8009ce <strnlen>
+  8006ae:	89 c2                	mov    %eax,%edx
+  8006b0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006b3:	29 d0                	sub    %edx,%eax
+  8006b5:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  8006b8:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8006bc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006bf:	89 75 08             	mov    %esi,0x8(%ebp)
+  8006c2:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8006c4:	eb 0e                	jmp    8006d4 <vprintfmt+0x1da>
+          putch(padc, putdat);
+  8006c6:	83 ec 08             	sub    $0x8,%esp
+  8006c9:	53                   	push   %ebx
+  8006ca:	57                   	push   %edi
+  8006cb:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8006ce:	83 ee 01             	sub    $0x1,%esi
+  8006d1:	83 c4 10             	add    $0x10,%esp
+  8006d4:	85 f6                	test   %esi,%esi
+  8006d6:	7f ee                	jg     8006c6 <vprintfmt+0x1cc>
+  8006d8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006db:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006de:	85 c0                	test   %eax,%eax
+  8006e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006e5:	0f 49 d0             	cmovns %eax,%edx
+  8006e8:	29 d0                	sub    %edx,%eax
+  8006ea:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006ed:	eb a6                	jmp    800695 <vprintfmt+0x19b>
+          putch(ch, putdat);
+  8006ef:	83 ec 08             	sub    $0x8,%esp
+  8006f2:	53                   	push   %ebx
+  8006f3:	52                   	push   %edx
+  8006f4:	ff 55 08             	call   *0x8(%ebp)
+  8006f7:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8006fa:	89 f1                	mov    %esi,%ecx
+  8006fc:	8d 71 01             	lea    0x1(%ecx),%esi
+  8006ff:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800703:	0f be d0             	movsbl %al,%edx
+  800706:	85 d2                	test   %edx,%edx
+  800708:	74 28                	je     800732 <vprintfmt+0x238>
+  80070a:	85 ff                	test   %edi,%edi
+  80070c:	78 05                	js     800713 <vprintfmt+0x219>
+  80070e:	83 ef 01             	sub    $0x1,%edi
+  800711:	78 30                	js     800743 <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  800713:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800717:	74 d6                	je     8006ef <vprintfmt+0x1f5>
+  800719:	0f be c0             	movsbl %al,%eax
+  80071c:	83 e8 20             	sub    $0x20,%eax
+  80071f:	83 f8 5e             	cmp    $0x5e,%eax
+  800722:	76 cb                	jbe    8006ef <vprintfmt+0x1f5>
+          putch('?', putdat);
+  800724:	83 ec 08             	sub    $0x8,%esp
+  800727:	53                   	push   %ebx
+  800728:	6a 3f                	push   $0x3f
+  80072a:	ff 55 08             	call   *0x8(%ebp)
+  80072d:	83 c4 10             	add    $0x10,%esp
+  800730:	eb c8                	jmp    8006fa <vprintfmt+0x200>
+  800732:	8b 75 08             	mov    0x8(%ebp),%esi
+  800735:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800738:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80073b:	01 d0                	add    %edx,%eax
+  80073d:	29 c8                	sub    %ecx,%eax
+  80073f:	89 c7                	mov    %eax,%edi
+  800741:	eb 13                	jmp    800756 <vprintfmt+0x25c>
+  800743:	8b 75 08             	mov    0x8(%ebp),%esi
+  800746:	eb ed                	jmp    800735 <vprintfmt+0x23b>
+        putch(' ', putdat);
+  800748:	83 ec 08             	sub    $0x8,%esp
+  80074b:	53                   	push   %ebx
+  80074c:	6a 20                	push   $0x20
+  80074e:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  800750:	83 ef 01             	sub    $0x1,%edi
+  800753:	83 c4 10             	add    $0x10,%esp
+  800756:	85 ff                	test   %edi,%edi
+  800758:	7f ee                	jg     800748 <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  80075a:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80075d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800760:	e9 6b 01 00 00       	jmp    8008d0 <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  800765:	83 f9 01             	cmp    $0x1,%ecx
+  800768:	7f 1f                	jg     800789 <vprintfmt+0x28f>
+  else if (lflag)
+  80076a:	85 c9                	test   %ecx,%ecx
+  80076c:	74 67                	je     8007d5 <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  80076e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800771:	8b 00                	mov    (%eax),%eax
+  800773:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800776:	89 c1                	mov    %eax,%ecx
+  800778:	c1 f9 1f             	sar    $0x1f,%ecx
+  80077b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80077e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800781:	8d 40 04             	lea    0x4(%eax),%eax
+  800784:	89 45 14             	mov    %eax,0x14(%ebp)
+  800787:	eb 17                	jmp    8007a0 <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  800789:	8b 45 14             	mov    0x14(%ebp),%eax
+  80078c:	8b 50 04             	mov    0x4(%eax),%edx
+  80078f:	8b 00                	mov    (%eax),%eax
+  800791:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800794:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800797:	8b 45 14             	mov    0x14(%ebp),%eax
+  80079a:	8d 40 08             	lea    0x8(%eax),%eax
+  80079d:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  8007a0:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8007a3:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  8007a6:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  8007ab:	85 c9                	test   %ecx,%ecx
+  8007ad:	0f 89 03 01 00 00    	jns    8008b6 <vprintfmt+0x3bc>
+        putch('-', putdat);
+  8007b3:	83 ec 08             	sub    $0x8,%esp
+  8007b6:	53                   	push   %ebx
+  8007b7:	6a 2d                	push   $0x2d
+  8007b9:	ff d6                	call   *%esi
+        num = -(long long)num;
+  8007bb:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8007be:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8007c1:	f7 da                	neg    %edx
+  8007c3:	83 d1 00             	adc    $0x0,%ecx
+  8007c6:	f7 d9                	neg    %ecx
+  8007c8:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  8007cb:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8007d0:	e9 e1 00 00 00       	jmp    8008b6 <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  8007d5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d8:	8b 00                	mov    (%eax),%eax
+  8007da:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007dd:	89 c1                	mov    %eax,%ecx
+  8007df:	c1 f9 1f             	sar    $0x1f,%ecx
+  8007e2:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8007e5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e8:	8d 40 04             	lea    0x4(%eax),%eax
+  8007eb:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007ee:	eb b0                	jmp    8007a0 <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  8007f0:	83 f9 01             	cmp    $0x1,%ecx
+  8007f3:	7f 1e                	jg     800813 <vprintfmt+0x319>
+  else if (lflag)
+  8007f5:	85 c9                	test   %ecx,%ecx
+  8007f7:	74 32                	je     80082b <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  8007f9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007fc:	8b 10                	mov    (%eax),%edx
+  8007fe:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800803:	8d 40 04             	lea    0x4(%eax),%eax
+  800806:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800809:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  80080e:	e9 a3 00 00 00       	jmp    8008b6 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800813:	8b 45 14             	mov    0x14(%ebp),%eax
+  800816:	8b 10                	mov    (%eax),%edx
+  800818:	8b 48 04             	mov    0x4(%eax),%ecx
+  80081b:	8d 40 08             	lea    0x8(%eax),%eax
+  80081e:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800821:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  800826:	e9 8b 00 00 00       	jmp    8008b6 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  80082b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80082e:	8b 10                	mov    (%eax),%edx
+  800830:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800835:	8d 40 04             	lea    0x4(%eax),%eax
+  800838:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  80083b:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  800840:	eb 74                	jmp    8008b6 <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  800842:	83 f9 01             	cmp    $0x1,%ecx
+  800845:	7f 1b                	jg     800862 <vprintfmt+0x368>
+  else if (lflag)
+  800847:	85 c9                	test   %ecx,%ecx
+  800849:	74 2c                	je     800877 <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  80084b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80084e:	8b 10                	mov    (%eax),%edx
+  800850:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800855:	8d 40 04             	lea    0x4(%eax),%eax
+  800858:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  80085b:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  800860:	eb 54                	jmp    8008b6 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800862:	8b 45 14             	mov    0x14(%ebp),%eax
+  800865:	8b 10                	mov    (%eax),%edx
+  800867:	8b 48 04             	mov    0x4(%eax),%ecx
+  80086a:	8d 40 08             	lea    0x8(%eax),%eax
+  80086d:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800870:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  800875:	eb 3f                	jmp    8008b6 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800877:	8b 45 14             	mov    0x14(%ebp),%eax
+  80087a:	8b 10                	mov    (%eax),%edx
+  80087c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800881:	8d 40 04             	lea    0x4(%eax),%eax
+  800884:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800887:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  80088c:	eb 28                	jmp    8008b6 <vprintfmt+0x3bc>
+      putch('0', putdat);
+  80088e:	83 ec 08             	sub    $0x8,%esp
+  800891:	53                   	push   %ebx
+  800892:	6a 30                	push   $0x30
+  800894:	ff d6                	call   *%esi
+      putch('x', putdat);
+  800896:	83 c4 08             	add    $0x8,%esp
+  800899:	53                   	push   %ebx
+  80089a:	6a 78                	push   $0x78
+  80089c:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  80089e:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008a1:	8b 10                	mov    (%eax),%edx
+  8008a3:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  8008a8:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  8008ab:	8d 40 04             	lea    0x4(%eax),%eax
+  8008ae:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8008b1:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  8008b6:	83 ec 0c             	sub    $0xc,%esp
+  8008b9:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8008bd:	50                   	push   %eax
+  8008be:	ff 75 e0             	push   -0x20(%ebp)
+  8008c1:	57                   	push   %edi
+  8008c2:	51                   	push   %ecx
+  8008c3:	52                   	push   %edx
+  8008c4:	89 da                	mov    %ebx,%edx
+  8008c6:	89 f0                	mov    %esi,%eax
+  8008c8:	e8 4a fb ff ff       	call   800417 <printnum>
+      break;
+  8008cd:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  8008d0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  8008d3:	e9 40 fc ff ff       	jmp    800518 <vprintfmt+0x1e>
+  if (lflag >= 2)
+  8008d8:	83 f9 01             	cmp    $0x1,%ecx
+  8008db:	7f 1b                	jg     8008f8 <vprintfmt+0x3fe>
+  else if (lflag)
+  8008dd:	85 c9                	test   %ecx,%ecx
+  8008df:	74 2c                	je     80090d <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  8008e1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008e4:	8b 10                	mov    (%eax),%edx
+  8008e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008eb:	8d 40 04             	lea    0x4(%eax),%eax
+  8008ee:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8008f1:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  8008f6:	eb be                	jmp    8008b6 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  8008f8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008fb:	8b 10                	mov    (%eax),%edx
+  8008fd:	8b 48 04             	mov    0x4(%eax),%ecx
+  800900:	8d 40 08             	lea    0x8(%eax),%eax
+  800903:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800906:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  80090b:	eb a9                	jmp    8008b6 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  80090d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800910:	8b 10                	mov    (%eax),%edx
+  800912:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800917:	8d 40 04             	lea    0x4(%eax),%eax
+  80091a:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  80091d:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  800922:	eb 92                	jmp    8008b6 <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  800924:	83 ec 08             	sub    $0x8,%esp
+  800927:	53                   	push   %ebx
+  800928:	6a 25                	push   $0x25
+  80092a:	ff d6                	call   *%esi
+      break;
+  80092c:	83 c4 10             	add    $0x10,%esp
+  80092f:	eb 9f                	jmp    8008d0 <vprintfmt+0x3d6>
+      putch('%', putdat);
+  800931:	83 ec 08             	sub    $0x8,%esp
+  800934:	53                   	push   %ebx
+  800935:	6a 25                	push   $0x25
+  800937:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  800939:	83 c4 10             	add    $0x10,%esp
+  80093c:	89 f8                	mov    %edi,%eax
+  80093e:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800942:	74 05                	je     800949 <vprintfmt+0x44f>
+  800944:	83 e8 01             	sub    $0x1,%eax
+  800947:	eb f5                	jmp    80093e <vprintfmt+0x444>
+  800949:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80094c:	eb 82                	jmp    8008d0 <vprintfmt+0x3d6>
+
+0080094e <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80094e:	55                   	push   %ebp
+  80094f:	89 e5                	mov    %esp,%ebp
+  800951:	83 ec 18             	sub    $0x18,%esp
+  800954:	8b 45 08             	mov    0x8(%ebp),%eax
+  800957:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  80095a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80095d:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800961:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800964:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  80096b:	85 c0                	test   %eax,%eax
+  80096d:	74 26                	je     800995 <vsnprintf+0x47>
+  80096f:	85 d2                	test   %edx,%edx
+  800971:	7e 22                	jle    800995 <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800973:	ff 75 14             	push   0x14(%ebp)
+  800976:	ff 75 10             	push   0x10(%ebp)
+  800979:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80097c:	50                   	push   %eax
+  80097d:	68 c0 04 80 00       	push   $0x8004c0
+  800982:	e8 73 fb ff ff       	call   8004fa <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800987:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80098a:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  80098d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800990:	83 c4 10             	add    $0x10,%esp
+}
+  800993:	c9                   	leave
+  800994:	c3                   	ret
+    return -E_INVAL;
+  800995:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80099a:	eb f7                	jmp    800993 <vsnprintf+0x45>
+
+0080099c <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80099c:	55                   	push   %ebp
+  80099d:	89 e5                	mov    %esp,%ebp
+  80099f:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  8009a2:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  8009a5:	50                   	push   %eax
+  8009a6:	ff 75 10             	push   0x10(%ebp)
+  8009a9:	ff 75 0c             	push   0xc(%ebp)
+  8009ac:	ff 75 08             	push   0x8(%ebp)
+  8009af:	e8 9a ff ff ff       	call   80094e <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  8009b4:	c9                   	leave
+  8009b5:	c3                   	ret
+
+008009b6 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8009b6:	55                   	push   %ebp
+  8009b7:	89 e5                	mov    %esp,%ebp
+  8009b9:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  8009bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009c1:	eb 03                	jmp    8009c6 <strlen+0x10>
+    n++;
+  8009c3:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  8009c6:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8009ca:	75 f7                	jne    8009c3 <strlen+0xd>
+  return n;
+}
+  8009cc:	5d                   	pop    %ebp
+  8009cd:	c3                   	ret
+
+008009ce <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8009ce:	55                   	push   %ebp
+  8009cf:	89 e5                	mov    %esp,%ebp
+  8009d1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8009d4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009dc:	eb 03                	jmp    8009e1 <strnlen+0x13>
+    n++;
+  8009de:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8009e1:	39 d0                	cmp    %edx,%eax
+  8009e3:	74 08                	je     8009ed <strnlen+0x1f>
+  8009e5:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8009e9:	75 f3                	jne    8009de <strnlen+0x10>
+  8009eb:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  8009ed:	89 d0                	mov    %edx,%eax
+  8009ef:	5d                   	pop    %ebp
+  8009f0:	c3                   	ret
+
+008009f1 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8009f1:	55                   	push   %ebp
+  8009f2:	89 e5                	mov    %esp,%ebp
+  8009f4:	53                   	push   %ebx
+  8009f5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009f8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  8009fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a00:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800a04:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800a07:	83 c0 01             	add    $0x1,%eax
+  800a0a:	84 d2                	test   %dl,%dl
+  800a0c:	75 f2                	jne    800a00 <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  800a0e:	89 c8                	mov    %ecx,%eax
+  800a10:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a13:	c9                   	leave
+  800a14:	c3                   	ret
+
+00800a15 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800a15:	55                   	push   %ebp
+  800a16:	89 e5                	mov    %esp,%ebp
+  800a18:	53                   	push   %ebx
+  800a19:	83 ec 10             	sub    $0x10,%esp
+  800a1c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  800a1f:	53                   	push   %ebx
+  800a20:	e8 91 ff ff ff       	call   8009b6 <strlen>
+  800a25:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  800a28:	ff 75 0c             	push   0xc(%ebp)
+  800a2b:	01 d8                	add    %ebx,%eax
+  800a2d:	50                   	push   %eax
+  800a2e:	e8 be ff ff ff       	call   8009f1 <strcpy>
+  return dst;
+}
+  800a33:	89 d8                	mov    %ebx,%eax
+  800a35:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a38:	c9                   	leave
+  800a39:	c3                   	ret
+
+00800a3a <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  800a3a:	55                   	push   %ebp
+  800a3b:	89 e5                	mov    %esp,%ebp
+  800a3d:	56                   	push   %esi
+  800a3e:	53                   	push   %ebx
+  800a3f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a42:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  800a45:	89 f3                	mov    %esi,%ebx
+  800a47:	03 5d 10             	add    0x10(%ebp),%ebx
+  800a4a:	89 f0                	mov    %esi,%eax
+  800a4c:	eb 0f                	jmp    800a5d <strncpy+0x23>
+    *dst++ = *src;
+  800a4e:	83 c0 01             	add    $0x1,%eax
+  800a51:	0f b6 0a             	movzbl (%edx),%ecx
+  800a54:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  800a57:	80 f9 01             	cmp    $0x1,%cl
+  800a5a:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  800a5d:	39 d8                	cmp    %ebx,%eax
+  800a5f:	75 ed                	jne    800a4e <strncpy+0x14>
+  }
+  return ret;
+}
+  800a61:	89 f0                	mov    %esi,%eax
+  800a63:	5b                   	pop    %ebx
+  800a64:	5e                   	pop    %esi
+  800a65:	5d                   	pop    %ebp
+  800a66:	c3                   	ret
+
+00800a67 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800a67:	55                   	push   %ebp
+  800a68:	89 e5                	mov    %esp,%ebp
+  800a6a:	56                   	push   %esi
+  800a6b:	53                   	push   %ebx
+  800a6c:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a6f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a72:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  800a75:	89 f0                	mov    %esi,%eax
+  800a77:	85 d2                	test   %edx,%edx
+  800a79:	74 21                	je     800a9c <strlcpy+0x35>
+  800a7b:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800a7f:	89 f2                	mov    %esi,%edx
+  800a81:	eb 09                	jmp    800a8c <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  800a83:	83 c1 01             	add    $0x1,%ecx
+  800a86:	83 c2 01             	add    $0x1,%edx
+  800a89:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  800a8c:	39 c2                	cmp    %eax,%edx
+  800a8e:	74 09                	je     800a99 <strlcpy+0x32>
+  800a90:	0f b6 19             	movzbl (%ecx),%ebx
+  800a93:	84 db                	test   %bl,%bl
+  800a95:	75 ec                	jne    800a83 <strlcpy+0x1c>
+  800a97:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  800a99:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  800a9c:	29 f0                	sub    %esi,%eax
+}
+  800a9e:	5b                   	pop    %ebx
+  800a9f:	5e                   	pop    %esi
+  800aa0:	5d                   	pop    %ebp
+  800aa1:	c3                   	ret
+
+00800aa2 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800aa2:	55                   	push   %ebp
+  800aa3:	89 e5                	mov    %esp,%ebp
+  800aa5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800aa8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  800aab:	eb 06                	jmp    800ab3 <strcmp+0x11>
+    p++, q++;
+  800aad:	83 c1 01             	add    $0x1,%ecx
+  800ab0:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  800ab3:	0f b6 01             	movzbl (%ecx),%eax
+  800ab6:	84 c0                	test   %al,%al
+  800ab8:	74 04                	je     800abe <strcmp+0x1c>
+  800aba:	3a 02                	cmp    (%edx),%al
+  800abc:	74 ef                	je     800aad <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  800abe:	0f b6 c0             	movzbl %al,%eax
+  800ac1:	0f b6 12             	movzbl (%edx),%edx
+  800ac4:	29 d0                	sub    %edx,%eax
+}
+  800ac6:	5d                   	pop    %ebp
+  800ac7:	c3                   	ret
+
+00800ac8 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800ac8:	55                   	push   %ebp
+  800ac9:	89 e5                	mov    %esp,%ebp
+  800acb:	53                   	push   %ebx
+  800acc:	8b 45 08             	mov    0x8(%ebp),%eax
+  800acf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ad2:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  800ad5:	eb 09                	jmp    800ae0 <strncmp+0x18>
+    n--, p++, q++;
+  800ad7:	83 ea 01             	sub    $0x1,%edx
+  800ada:	83 c0 01             	add    $0x1,%eax
+  800add:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  800ae0:	85 d2                	test   %edx,%edx
+  800ae2:	74 18                	je     800afc <strncmp+0x34>
+  800ae4:	0f b6 18             	movzbl (%eax),%ebx
+  800ae7:	84 db                	test   %bl,%bl
+  800ae9:	74 04                	je     800aef <strncmp+0x27>
+  800aeb:	3a 19                	cmp    (%ecx),%bl
+  800aed:	74 e8                	je     800ad7 <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800aef:	0f b6 00             	movzbl (%eax),%eax
+  800af2:	0f b6 11             	movzbl (%ecx),%edx
+  800af5:	29 d0                	sub    %edx,%eax
+}
+  800af7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800afa:	c9                   	leave
+  800afb:	c3                   	ret
+    return 0;
+  800afc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b01:	eb f4                	jmp    800af7 <strncmp+0x2f>
+
+00800b03 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800b03:	55                   	push   %ebp
+  800b04:	89 e5                	mov    %esp,%ebp
+  800b06:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b09:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800b0d:	eb 03                	jmp    800b12 <strchr+0xf>
+  800b0f:	83 c0 01             	add    $0x1,%eax
+  800b12:	0f b6 10             	movzbl (%eax),%edx
+  800b15:	84 d2                	test   %dl,%dl
+  800b17:	74 06                	je     800b1f <strchr+0x1c>
+    if (*s == c)
+  800b19:	38 ca                	cmp    %cl,%dl
+  800b1b:	75 f2                	jne    800b0f <strchr+0xc>
+  800b1d:	eb 05                	jmp    800b24 <strchr+0x21>
+      return (char*)s;
+  return 0;
+  800b1f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b24:	5d                   	pop    %ebp
+  800b25:	c3                   	ret
+
+00800b26 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800b26:	55                   	push   %ebp
+  800b27:	89 e5                	mov    %esp,%ebp
+  800b29:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b2c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800b30:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  800b33:	38 ca                	cmp    %cl,%dl
+  800b35:	74 09                	je     800b40 <strfind+0x1a>
+  800b37:	84 d2                	test   %dl,%dl
+  800b39:	74 05                	je     800b40 <strfind+0x1a>
+  for (; *s; s++)
+  800b3b:	83 c0 01             	add    $0x1,%eax
+  800b3e:	eb f0                	jmp    800b30 <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  800b40:	5d                   	pop    %ebp
+  800b41:	c3                   	ret
+
+00800b42 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800b42:	55                   	push   %ebp
+  800b43:	89 e5                	mov    %esp,%ebp
+  800b45:	57                   	push   %edi
+  800b46:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b49:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  800b4c:	85 c9                	test   %ecx,%ecx
+  800b4e:	74 20                	je     800b70 <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  800b50:	89 f8                	mov    %edi,%eax
+  800b52:	09 c8                	or     %ecx,%eax
+  800b54:	a8 03                	test   $0x3,%al
+  800b56:	75 12                	jne    800b6a <memset+0x28>
+    c &= 0xFF;
+  800b58:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800b5c:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  800b62:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  800b65:	fc                   	cld
+  800b66:	f3 ab                	rep stos %eax,%es:(%edi)
+  800b68:	eb 06                	jmp    800b70 <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  800b6a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b6d:	fc                   	cld
+  800b6e:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  800b70:	89 f8                	mov    %edi,%eax
+  800b72:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800b75:	c9                   	leave
+  800b76:	c3                   	ret
+
+00800b77 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800b77:	55                   	push   %ebp
+  800b78:	89 e5                	mov    %esp,%ebp
+  800b7a:	57                   	push   %edi
+  800b7b:	56                   	push   %esi
+  800b7c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b7f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b82:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  800b85:	39 c6                	cmp    %eax,%esi
+  800b87:	73 32                	jae    800bbb <memmove+0x44>
+  800b89:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800b8c:	39 d0                	cmp    %edx,%eax
+  800b8e:	73 2b                	jae    800bbb <memmove+0x44>
+    s += n;
+    d += n;
+  800b90:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b93:	89 d6                	mov    %edx,%esi
+  800b95:	09 fe                	or     %edi,%esi
+  800b97:	09 ce                	or     %ecx,%esi
+  800b99:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800b9f:	75 0e                	jne    800baf <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800ba1:	83 ef 04             	sub    $0x4,%edi
+  800ba4:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800ba7:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  800baa:	fd                   	std
+  800bab:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800bad:	eb 09                	jmp    800bb8 <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800baf:	83 ef 01             	sub    $0x1,%edi
+  800bb2:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  800bb5:	fd                   	std
+  800bb6:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  800bb8:	fc                   	cld
+  800bb9:	eb 1a                	jmp    800bd5 <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800bbb:	89 f2                	mov    %esi,%edx
+  800bbd:	09 c2                	or     %eax,%edx
+  800bbf:	09 ca                	or     %ecx,%edx
+  800bc1:	f6 c2 03             	test   $0x3,%dl
+  800bc4:	75 0a                	jne    800bd0 <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800bc6:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  800bc9:	89 c7                	mov    %eax,%edi
+  800bcb:	fc                   	cld
+  800bcc:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800bce:	eb 05                	jmp    800bd5 <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  800bd0:	89 c7                	mov    %eax,%edi
+  800bd2:	fc                   	cld
+  800bd3:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  800bd5:	5e                   	pop    %esi
+  800bd6:	5f                   	pop    %edi
+  800bd7:	5d                   	pop    %ebp
+  800bd8:	c3                   	ret
+
+00800bd9 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800bd9:	55                   	push   %ebp
+  800bda:	89 e5                	mov    %esp,%ebp
+  800bdc:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  800bdf:	ff 75 10             	push   0x10(%ebp)
+  800be2:	ff 75 0c             	push   0xc(%ebp)
+  800be5:	ff 75 08             	push   0x8(%ebp)
+  800be8:	e8 8a ff ff ff       	call   800b77 <memmove>
+}
+  800bed:	c9                   	leave
+  800bee:	c3                   	ret
+
+00800bef <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800bef:	55                   	push   %ebp
+  800bf0:	89 e5                	mov    %esp,%ebp
+  800bf2:	56                   	push   %esi
+  800bf3:	53                   	push   %ebx
+  800bf4:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bf7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  800bfa:	89 c6                	mov    %eax,%esi
+  800bfc:	03 75 10             	add    0x10(%ebp),%esi
+  800bff:	eb 06                	jmp    800c07 <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  800c01:	83 c0 01             	add    $0x1,%eax
+  800c04:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  800c07:	39 f0                	cmp    %esi,%eax
+  800c09:	74 14                	je     800c1f <memcmp+0x30>
+    if (*s1 != *s2)
+  800c0b:	0f b6 08             	movzbl (%eax),%ecx
+  800c0e:	0f b6 1a             	movzbl (%edx),%ebx
+  800c11:	38 d9                	cmp    %bl,%cl
+  800c13:	74 ec                	je     800c01 <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  800c15:	0f b6 c1             	movzbl %cl,%eax
+  800c18:	0f b6 db             	movzbl %bl,%ebx
+  800c1b:	29 d8                	sub    %ebx,%eax
+  800c1d:	eb 05                	jmp    800c24 <memcmp+0x35>
+  }
+
+  return 0;
+  800c1f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c24:	5b                   	pop    %ebx
+  800c25:	5e                   	pop    %esi
+  800c26:	5d                   	pop    %ebp
+  800c27:	c3                   	ret
+
+00800c28 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800c28:	55                   	push   %ebp
+  800c29:	89 e5                	mov    %esp,%ebp
+  800c2b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c2e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  800c31:	89 c2                	mov    %eax,%edx
+  800c33:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  800c36:	eb 03                	jmp    800c3b <memfind+0x13>
+  800c38:	83 c0 01             	add    $0x1,%eax
+  800c3b:	39 d0                	cmp    %edx,%eax
+  800c3d:	73 04                	jae    800c43 <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  800c3f:	38 08                	cmp    %cl,(%eax)
+  800c41:	75 f5                	jne    800c38 <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  800c43:	5d                   	pop    %ebp
+  800c44:	c3                   	ret
+
+00800c45 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800c45:	55                   	push   %ebp
+  800c46:	89 e5                	mov    %esp,%ebp
+  800c48:	57                   	push   %edi
+  800c49:	56                   	push   %esi
+  800c4a:	53                   	push   %ebx
+  800c4b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c4e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  800c51:	eb 03                	jmp    800c56 <strtol+0x11>
+    s++;
+  800c53:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  800c56:	0f b6 02             	movzbl (%edx),%eax
+  800c59:	3c 20                	cmp    $0x20,%al
+  800c5b:	74 f6                	je     800c53 <strtol+0xe>
+  800c5d:	3c 09                	cmp    $0x9,%al
+  800c5f:	74 f2                	je     800c53 <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  800c61:	3c 2b                	cmp    $0x2b,%al
+  800c63:	74 2a                	je     800c8f <strtol+0x4a>
+  int neg = 0;
+  800c65:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  800c6a:	3c 2d                	cmp    $0x2d,%al
+  800c6c:	74 2b                	je     800c99 <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c6e:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800c74:	75 0f                	jne    800c85 <strtol+0x40>
+  800c76:	80 3a 30             	cmpb   $0x30,(%edx)
+  800c79:	74 28                	je     800ca3 <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  800c7b:	85 db                	test   %ebx,%ebx
+  800c7d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c82:	0f 44 d8             	cmove  %eax,%ebx
+  800c85:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c8a:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800c8d:	eb 46                	jmp    800cd5 <strtol+0x90>
+    s++;
+  800c8f:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  800c92:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c97:	eb d5                	jmp    800c6e <strtol+0x29>
+    s++, neg = 1;
+  800c99:	83 c2 01             	add    $0x1,%edx
+  800c9c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800ca1:	eb cb                	jmp    800c6e <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ca3:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800ca7:	74 0e                	je     800cb7 <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  800ca9:	85 db                	test   %ebx,%ebx
+  800cab:	75 d8                	jne    800c85 <strtol+0x40>
+    s++, base = 8;
+  800cad:	83 c2 01             	add    $0x1,%edx
+  800cb0:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800cb5:	eb ce                	jmp    800c85 <strtol+0x40>
+    s += 2, base = 16;
+  800cb7:	83 c2 02             	add    $0x2,%edx
+  800cba:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800cbf:	eb c4                	jmp    800c85 <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  800cc1:	0f be c0             	movsbl %al,%eax
+  800cc4:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  800cc7:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800cca:	7d 3a                	jge    800d06 <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  800ccc:	83 c2 01             	add    $0x1,%edx
+  800ccf:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800cd3:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  800cd5:	0f b6 02             	movzbl (%edx),%eax
+  800cd8:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800cdb:	89 f3                	mov    %esi,%ebx
+  800cdd:	80 fb 09             	cmp    $0x9,%bl
+  800ce0:	76 df                	jbe    800cc1 <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  800ce2:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800ce5:	89 f3                	mov    %esi,%ebx
+  800ce7:	80 fb 19             	cmp    $0x19,%bl
+  800cea:	77 08                	ja     800cf4 <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  800cec:	0f be c0             	movsbl %al,%eax
+  800cef:	83 e8 57             	sub    $0x57,%eax
+  800cf2:	eb d3                	jmp    800cc7 <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  800cf4:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800cf7:	89 f3                	mov    %esi,%ebx
+  800cf9:	80 fb 19             	cmp    $0x19,%bl
+  800cfc:	77 08                	ja     800d06 <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  800cfe:	0f be c0             	movsbl %al,%eax
+  800d01:	83 e8 37             	sub    $0x37,%eax
+  800d04:	eb c1                	jmp    800cc7 <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  800d06:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800d0a:	74 05                	je     800d11 <strtol+0xcc>
+    *endptr = (char*)s;
+  800d0c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d0f:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  800d11:	89 c8                	mov    %ecx,%eax
+  800d13:	f7 d8                	neg    %eax
+  800d15:	85 ff                	test   %edi,%edi
+  800d17:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800d1a:	89 c8                	mov    %ecx,%eax
+  800d1c:	5b                   	pop    %ebx
+  800d1d:	5e                   	pop    %esi
+  800d1e:	5f                   	pop    %edi
+  800d1f:	5d                   	pop    %ebp
+  800d20:	c3                   	ret
+
+00800d21 <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800d21:	55                   	push   %ebp
+  800d22:	89 e5                	mov    %esp,%ebp
+  800d24:	57                   	push   %edi
+  800d25:	56                   	push   %esi
+  800d26:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d27:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d2c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d2f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d32:	89 c3                	mov    %eax,%ebx
+  800d34:	89 c7                	mov    %eax,%edi
+  800d36:	89 c6                	mov    %eax,%esi
+  800d38:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800d3a:	5b                   	pop    %ebx
+  800d3b:	5e                   	pop    %esi
+  800d3c:	5f                   	pop    %edi
+  800d3d:	5d                   	pop    %ebp
+  800d3e:	c3                   	ret
+
+00800d3f <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800d3f:	55                   	push   %ebp
+  800d40:	89 e5                	mov    %esp,%ebp
+  800d42:	57                   	push   %edi
+  800d43:	56                   	push   %esi
+  800d44:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d45:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d4a:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d4f:	89 d1                	mov    %edx,%ecx
+  800d51:	89 d3                	mov    %edx,%ebx
+  800d53:	89 d7                	mov    %edx,%edi
+  800d55:	89 d6                	mov    %edx,%esi
+  800d57:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800d59:	5b                   	pop    %ebx
+  800d5a:	5e                   	pop    %esi
+  800d5b:	5f                   	pop    %edi
+  800d5c:	5d                   	pop    %ebp
+  800d5d:	c3                   	ret
+
+00800d5e <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800d5e:	55                   	push   %ebp
+  800d5f:	89 e5                	mov    %esp,%ebp
+  800d61:	57                   	push   %edi
+  800d62:	56                   	push   %esi
+  800d63:	53                   	push   %ebx
+  800d64:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800d67:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d6c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d6f:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d74:	89 cb                	mov    %ecx,%ebx
+  800d76:	89 cf                	mov    %ecx,%edi
+  800d78:	89 ce                	mov    %ecx,%esi
+  800d7a:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d7c:	85 c0                	test   %eax,%eax
+  800d7e:	7f 08                	jg     800d88 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800d80:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d83:	5b                   	pop    %ebx
+  800d84:	5e                   	pop    %esi
+  800d85:	5f                   	pop    %edi
+  800d86:	5d                   	pop    %ebp
+  800d87:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d88:	83 ec 0c             	sub    $0xc,%esp
+  800d8b:	50                   	push   %eax
+  800d8c:	6a 03                	push   $0x3
+  800d8e:	68 c3 34 80 00       	push   $0x8034c3
+  800d93:	6a 23                	push   $0x23
+  800d95:	68 e0 34 80 00       	push   $0x8034e0
+  800d9a:	e8 89 f5 ff ff       	call   800328 <_panic>
+
+00800d9f <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800d9f:	55                   	push   %ebp
+  800da0:	89 e5                	mov    %esp,%ebp
+  800da2:	57                   	push   %edi
+  800da3:	56                   	push   %esi
+  800da4:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800da5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800daa:	b8 02 00 00 00       	mov    $0x2,%eax
+  800daf:	89 d1                	mov    %edx,%ecx
+  800db1:	89 d3                	mov    %edx,%ebx
+  800db3:	89 d7                	mov    %edx,%edi
+  800db5:	89 d6                	mov    %edx,%esi
+  800db7:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800db9:	5b                   	pop    %ebx
+  800dba:	5e                   	pop    %esi
+  800dbb:	5f                   	pop    %edi
+  800dbc:	5d                   	pop    %ebp
+  800dbd:	c3                   	ret
+
+00800dbe <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800dbe:	55                   	push   %ebp
+  800dbf:	89 e5                	mov    %esp,%ebp
+  800dc1:	57                   	push   %edi
+  800dc2:	56                   	push   %esi
+  800dc3:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800dc4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dc9:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800dce:	89 d1                	mov    %edx,%ecx
+  800dd0:	89 d3                	mov    %edx,%ebx
+  800dd2:	89 d7                	mov    %edx,%edi
+  800dd4:	89 d6                	mov    %edx,%esi
+  800dd6:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800dd8:	5b                   	pop    %ebx
+  800dd9:	5e                   	pop    %esi
+  800dda:	5f                   	pop    %edi
+  800ddb:	5d                   	pop    %ebp
+  800ddc:	c3                   	ret
+
+00800ddd <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  800ddd:	55                   	push   %ebp
+  800dde:	89 e5                	mov    %esp,%ebp
+  800de0:	57                   	push   %edi
+  800de1:	56                   	push   %esi
+  800de2:	53                   	push   %ebx
+  800de3:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  800de6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  800dea:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800def:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df2:	b8 14 00 00 00       	mov    $0x14,%eax
+  800df7:	89 df                	mov    %ebx,%edi
+  800df9:	89 de                	mov    %ebx,%esi
+  800dfb:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800dfd:	85 c0                	test   %eax,%eax
+  800dff:	7f 08                	jg     800e09 <sys_env_set_cow+0x2c>
+}
+  800e01:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e04:	5b                   	pop    %ebx
+  800e05:	5e                   	pop    %esi
+  800e06:	5f                   	pop    %edi
+  800e07:	5d                   	pop    %ebp
+  800e08:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e09:	83 ec 0c             	sub    $0xc,%esp
+  800e0c:	50                   	push   %eax
+  800e0d:	6a 14                	push   $0x14
+  800e0f:	68 c3 34 80 00       	push   $0x8034c3
+  800e14:	6a 23                	push   $0x23
+  800e16:	68 e0 34 80 00       	push   $0x8034e0
+  800e1b:	e8 08 f5 ff ff       	call   800328 <_panic>
+
+00800e20 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800e20:	55                   	push   %ebp
+  800e21:	89 e5                	mov    %esp,%ebp
+  800e23:	57                   	push   %edi
+  800e24:	56                   	push   %esi
+  800e25:	53                   	push   %ebx
+  800e26:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e29:	be 00 00 00 00       	mov    $0x0,%esi
+  800e2e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e31:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e34:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e39:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e3c:	89 f7                	mov    %esi,%edi
+  800e3e:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e40:	85 c0                	test   %eax,%eax
+  800e42:	7f 08                	jg     800e4c <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  800e44:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e47:	5b                   	pop    %ebx
+  800e48:	5e                   	pop    %esi
+  800e49:	5f                   	pop    %edi
+  800e4a:	5d                   	pop    %ebp
+  800e4b:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e4c:	83 ec 0c             	sub    $0xc,%esp
+  800e4f:	50                   	push   %eax
+  800e50:	6a 04                	push   $0x4
+  800e52:	68 c3 34 80 00       	push   $0x8034c3
+  800e57:	6a 23                	push   $0x23
+  800e59:	68 e0 34 80 00       	push   $0x8034e0
+  800e5e:	e8 c5 f4 ff ff       	call   800328 <_panic>
+
+00800e63 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800e63:	55                   	push   %ebp
+  800e64:	89 e5                	mov    %esp,%ebp
+  800e66:	57                   	push   %edi
+  800e67:	56                   	push   %esi
+  800e68:	53                   	push   %ebx
+  800e69:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e6c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e6f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e72:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e77:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e7a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e7d:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e80:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e82:	85 c0                	test   %eax,%eax
+  800e84:	7f 08                	jg     800e8e <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  800e86:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e89:	5b                   	pop    %ebx
+  800e8a:	5e                   	pop    %esi
+  800e8b:	5f                   	pop    %edi
+  800e8c:	5d                   	pop    %ebp
+  800e8d:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e8e:	83 ec 0c             	sub    $0xc,%esp
+  800e91:	50                   	push   %eax
+  800e92:	6a 05                	push   $0x5
+  800e94:	68 c3 34 80 00       	push   $0x8034c3
+  800e99:	6a 23                	push   $0x23
+  800e9b:	68 e0 34 80 00       	push   $0x8034e0
+  800ea0:	e8 83 f4 ff ff       	call   800328 <_panic>
+
+00800ea5 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800ea5:	55                   	push   %ebp
+  800ea6:	89 e5                	mov    %esp,%ebp
+  800ea8:	57                   	push   %edi
+  800ea9:	56                   	push   %esi
+  800eaa:	53                   	push   %ebx
+  800eab:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800eae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eb3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eb9:	b8 06 00 00 00       	mov    $0x6,%eax
+  800ebe:	89 df                	mov    %ebx,%edi
+  800ec0:	89 de                	mov    %ebx,%esi
+  800ec2:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ec4:	85 c0                	test   %eax,%eax
+  800ec6:	7f 08                	jg     800ed0 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  800ec8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ecb:	5b                   	pop    %ebx
+  800ecc:	5e                   	pop    %esi
+  800ecd:	5f                   	pop    %edi
+  800ece:	5d                   	pop    %ebp
+  800ecf:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ed0:	83 ec 0c             	sub    $0xc,%esp
+  800ed3:	50                   	push   %eax
+  800ed4:	6a 06                	push   $0x6
+  800ed6:	68 c3 34 80 00       	push   $0x8034c3
+  800edb:	6a 23                	push   $0x23
+  800edd:	68 e0 34 80 00       	push   $0x8034e0
+  800ee2:	e8 41 f4 ff ff       	call   800328 <_panic>
+
+00800ee7 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  800ee7:	55                   	push   %ebp
+  800ee8:	89 e5                	mov    %esp,%ebp
+  800eea:	57                   	push   %edi
+  800eeb:	56                   	push   %esi
+  800eec:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800eed:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ef3:	b8 11 00 00 00       	mov    $0x11,%eax
+  800ef8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800efb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800efe:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f01:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  800f03:	5b                   	pop    %ebx
+  800f04:	5e                   	pop    %esi
+  800f05:	5f                   	pop    %edi
+  800f06:	5d                   	pop    %ebp
+  800f07:	c3                   	ret
+
+00800f08 <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  800f08:	55                   	push   %ebp
+  800f09:	89 e5                	mov    %esp,%ebp
+  800f0b:	57                   	push   %edi
+  800f0c:	56                   	push   %esi
+  800f0d:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f0e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f11:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f14:	b8 12 00 00 00       	mov    $0x12,%eax
+  800f19:	be 00 00 00 00       	mov    $0x0,%esi
+  800f1e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f21:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f24:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  800f26:	5b                   	pop    %ebx
+  800f27:	5e                   	pop    %esi
+  800f28:	5f                   	pop    %edi
+  800f29:	5d                   	pop    %ebp
+  800f2a:	c3                   	ret
+
+00800f2b <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  800f2b:	55                   	push   %ebp
+  800f2c:	89 e5                	mov    %esp,%ebp
+  800f2e:	57                   	push   %edi
+  800f2f:	56                   	push   %esi
+  800f30:	53                   	push   %ebx
+  800f31:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f34:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f39:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f3c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f3f:	b8 16 00 00 00       	mov    $0x16,%eax
+  800f44:	89 df                	mov    %ebx,%edi
+  800f46:	89 de                	mov    %ebx,%esi
+  800f48:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f4a:	85 c0                	test   %eax,%eax
+  800f4c:	7f 08                	jg     800f56 <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  800f4e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f51:	5b                   	pop    %ebx
+  800f52:	5e                   	pop    %esi
+  800f53:	5f                   	pop    %edi
+  800f54:	5d                   	pop    %ebp
+  800f55:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f56:	83 ec 0c             	sub    $0xc,%esp
+  800f59:	50                   	push   %eax
+  800f5a:	6a 16                	push   $0x16
+  800f5c:	68 c3 34 80 00       	push   $0x8034c3
+  800f61:	6a 23                	push   $0x23
+  800f63:	68 e0 34 80 00       	push   $0x8034e0
+  800f68:	e8 bb f3 ff ff       	call   800328 <_panic>
+
+00800f6d <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  800f6d:	55                   	push   %ebp
+  800f6e:	89 e5                	mov    %esp,%ebp
+  800f70:	57                   	push   %edi
+  800f71:	56                   	push   %esi
+  800f72:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f73:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f78:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f7b:	b8 17 00 00 00       	mov    $0x17,%eax
+  800f80:	89 cb                	mov    %ecx,%ebx
+  800f82:	89 cf                	mov    %ecx,%edi
+  800f84:	89 ce                	mov    %ecx,%esi
+  800f86:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  800f88:	5b                   	pop    %ebx
+  800f89:	5e                   	pop    %esi
+  800f8a:	5f                   	pop    %edi
+  800f8b:	5d                   	pop    %ebp
+  800f8c:	c3                   	ret
+
+00800f8d <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  800f8d:	55                   	push   %ebp
+  800f8e:	89 e5                	mov    %esp,%ebp
+  800f90:	57                   	push   %edi
+  800f91:	56                   	push   %esi
+  800f92:	53                   	push   %ebx
+  800f93:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f96:	be 00 00 00 00       	mov    $0x0,%esi
+  800f9b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f9e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fa1:	b8 18 00 00 00       	mov    $0x18,%eax
+  800fa6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fa9:	89 f7                	mov    %esi,%edi
+  800fab:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800fad:	85 c0                	test   %eax,%eax
+  800faf:	7f 08                	jg     800fb9 <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  800fb1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fb4:	5b                   	pop    %ebx
+  800fb5:	5e                   	pop    %esi
+  800fb6:	5f                   	pop    %edi
+  800fb7:	5d                   	pop    %ebp
+  800fb8:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800fb9:	83 ec 0c             	sub    $0xc,%esp
+  800fbc:	50                   	push   %eax
+  800fbd:	6a 18                	push   $0x18
+  800fbf:	68 c3 34 80 00       	push   $0x8034c3
+  800fc4:	6a 23                	push   $0x23
+  800fc6:	68 e0 34 80 00       	push   $0x8034e0
+  800fcb:	e8 58 f3 ff ff       	call   800328 <_panic>
+
+00800fd0 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  800fd0:	55                   	push   %ebp
+  800fd1:	89 e5                	mov    %esp,%ebp
+  800fd3:	57                   	push   %edi
+  800fd4:	56                   	push   %esi
+  800fd5:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800fd6:	be 00 00 00 00       	mov    $0x0,%esi
+  800fdb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fde:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fe1:	b8 19 00 00 00       	mov    $0x19,%eax
+  800fe6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fe9:	89 f7                	mov    %esi,%edi
+  800feb:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  800fed:	5b                   	pop    %ebx
+  800fee:	5e                   	pop    %esi
+  800fef:	5f                   	pop    %edi
+  800ff0:	5d                   	pop    %ebp
+  800ff1:	c3                   	ret
+
+00800ff2 <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  800ff2:	55                   	push   %ebp
+  800ff3:	89 e5                	mov    %esp,%ebp
+  800ff5:	57                   	push   %edi
+  800ff6:	56                   	push   %esi
+  800ff7:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800ff8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ffd:	b8 15 00 00 00       	mov    $0x15,%eax
+  801002:	89 d1                	mov    %edx,%ecx
+  801004:	89 d3                	mov    %edx,%ebx
+  801006:	89 d7                	mov    %edx,%edi
+  801008:	89 d6                	mov    %edx,%esi
+  80100a:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  80100c:	5b                   	pop    %ebx
+  80100d:	5e                   	pop    %esi
+  80100e:	5f                   	pop    %edi
+  80100f:	5d                   	pop    %ebp
+  801010:	c3                   	ret
+
+00801011 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801011:	55                   	push   %ebp
+  801012:	89 e5                	mov    %esp,%ebp
+  801014:	57                   	push   %edi
+  801015:	56                   	push   %esi
+  801016:	53                   	push   %ebx
+  801017:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80101a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80101f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801022:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801025:	b8 08 00 00 00       	mov    $0x8,%eax
+  80102a:	89 df                	mov    %ebx,%edi
+  80102c:	89 de                	mov    %ebx,%esi
+  80102e:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801030:	85 c0                	test   %eax,%eax
+  801032:	7f 08                	jg     80103c <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801034:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801037:	5b                   	pop    %ebx
+  801038:	5e                   	pop    %esi
+  801039:	5f                   	pop    %edi
+  80103a:	5d                   	pop    %ebp
+  80103b:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80103c:	83 ec 0c             	sub    $0xc,%esp
+  80103f:	50                   	push   %eax
+  801040:	6a 08                	push   $0x8
+  801042:	68 c3 34 80 00       	push   $0x8034c3
+  801047:	6a 23                	push   $0x23
+  801049:	68 e0 34 80 00       	push   $0x8034e0
+  80104e:	e8 d5 f2 ff ff       	call   800328 <_panic>
+
+00801053 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801053:	55                   	push   %ebp
+  801054:	89 e5                	mov    %esp,%ebp
+  801056:	57                   	push   %edi
+  801057:	56                   	push   %esi
+  801058:	53                   	push   %ebx
+  801059:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80105c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801061:	8b 55 08             	mov    0x8(%ebp),%edx
+  801064:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801067:	b8 09 00 00 00       	mov    $0x9,%eax
+  80106c:	89 df                	mov    %ebx,%edi
+  80106e:	89 de                	mov    %ebx,%esi
+  801070:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801072:	85 c0                	test   %eax,%eax
+  801074:	7f 08                	jg     80107e <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  801076:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801079:	5b                   	pop    %ebx
+  80107a:	5e                   	pop    %esi
+  80107b:	5f                   	pop    %edi
+  80107c:	5d                   	pop    %ebp
+  80107d:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80107e:	83 ec 0c             	sub    $0xc,%esp
+  801081:	50                   	push   %eax
+  801082:	6a 09                	push   $0x9
+  801084:	68 c3 34 80 00       	push   $0x8034c3
+  801089:	6a 23                	push   $0x23
+  80108b:	68 e0 34 80 00       	push   $0x8034e0
+  801090:	e8 93 f2 ff ff       	call   800328 <_panic>
+
+00801095 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801095:	55                   	push   %ebp
+  801096:	89 e5                	mov    %esp,%ebp
+  801098:	57                   	push   %edi
+  801099:	56                   	push   %esi
+  80109a:	53                   	push   %ebx
+  80109b:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80109e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a9:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010ae:	89 df                	mov    %ebx,%edi
+  8010b0:	89 de                	mov    %ebx,%esi
+  8010b2:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8010b4:	85 c0                	test   %eax,%eax
+  8010b6:	7f 08                	jg     8010c0 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  8010b8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010bb:	5b                   	pop    %ebx
+  8010bc:	5e                   	pop    %esi
+  8010bd:	5f                   	pop    %edi
+  8010be:	5d                   	pop    %ebp
+  8010bf:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8010c0:	83 ec 0c             	sub    $0xc,%esp
+  8010c3:	50                   	push   %eax
+  8010c4:	6a 0a                	push   $0xa
+  8010c6:	68 c3 34 80 00       	push   $0x8034c3
+  8010cb:	6a 23                	push   $0x23
+  8010cd:	68 e0 34 80 00       	push   $0x8034e0
+  8010d2:	e8 51 f2 ff ff       	call   800328 <_panic>
+
+008010d7 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  8010d7:	55                   	push   %ebp
+  8010d8:	89 e5                	mov    %esp,%ebp
+  8010da:	57                   	push   %edi
+  8010db:	56                   	push   %esi
+  8010dc:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8010dd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010e3:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010e8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010eb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010ee:	8b 75 18             	mov    0x18(%ebp),%esi
+  8010f1:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  8010f3:	5b                   	pop    %ebx
+  8010f4:	5e                   	pop    %esi
+  8010f5:	5f                   	pop    %edi
+  8010f6:	5d                   	pop    %ebp
+  8010f7:	c3                   	ret
+
+008010f8 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  8010f8:	55                   	push   %ebp
+  8010f9:	89 e5                	mov    %esp,%ebp
+  8010fb:	57                   	push   %edi
+  8010fc:	56                   	push   %esi
+  8010fd:	53                   	push   %ebx
+  8010fe:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801101:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801106:	8b 55 08             	mov    0x8(%ebp),%edx
+  801109:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80110c:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801111:	89 df                	mov    %ebx,%edi
+  801113:	89 de                	mov    %ebx,%esi
+  801115:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801117:	85 c0                	test   %eax,%eax
+  801119:	7f 08                	jg     801123 <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  80111b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80111e:	5b                   	pop    %ebx
+  80111f:	5e                   	pop    %esi
+  801120:	5f                   	pop    %edi
+  801121:	5d                   	pop    %ebp
+  801122:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801123:	83 ec 0c             	sub    $0xc,%esp
+  801126:	50                   	push   %eax
+  801127:	6a 0d                	push   $0xd
+  801129:	68 c3 34 80 00       	push   $0x8034c3
+  80112e:	6a 23                	push   $0x23
+  801130:	68 e0 34 80 00       	push   $0x8034e0
+  801135:	e8 ee f1 ff ff       	call   800328 <_panic>
+
+0080113a <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  80113a:	55                   	push   %ebp
+  80113b:	89 e5                	mov    %esp,%ebp
+  80113d:	57                   	push   %edi
+  80113e:	56                   	push   %esi
+  80113f:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801140:	ba 00 00 00 00       	mov    $0x0,%edx
+  801145:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80114a:	89 d1                	mov    %edx,%ecx
+  80114c:	89 d3                	mov    %edx,%ebx
+  80114e:	89 d7                	mov    %edx,%edi
+  801150:	89 d6                	mov    %edx,%esi
+  801152:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801154:	5b                   	pop    %ebx
+  801155:	5e                   	pop    %esi
+  801156:	5f                   	pop    %edi
+  801157:	5d                   	pop    %ebp
+  801158:	c3                   	ret
+
+00801159 <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  801159:	55                   	push   %ebp
+  80115a:	89 e5                	mov    %esp,%ebp
+  80115c:	57                   	push   %edi
+  80115d:	56                   	push   %esi
+  80115e:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80115f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801162:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801165:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80116a:	be 00 00 00 00       	mov    $0x0,%esi
+  80116f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801172:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801175:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  801177:	5b                   	pop    %ebx
+  801178:	5e                   	pop    %esi
+  801179:	5f                   	pop    %edi
+  80117a:	5d                   	pop    %ebp
+  80117b:	c3                   	ret
+
+0080117c <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  80117c:	55                   	push   %ebp
+  80117d:	89 e5                	mov    %esp,%ebp
+  80117f:	57                   	push   %edi
+  801180:	56                   	push   %esi
+  801181:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801182:	be 00 00 00 00       	mov    $0x0,%esi
+  801187:	8b 55 08             	mov    0x8(%ebp),%edx
+  80118a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80118d:	b8 10 00 00 00       	mov    $0x10,%eax
+  801192:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801195:	89 f7                	mov    %esi,%edi
+  801197:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  801199:	5b                   	pop    %ebx
+  80119a:	5e                   	pop    %esi
+  80119b:	5f                   	pop    %edi
+  80119c:	5d                   	pop    %ebp
+  80119d:	c3                   	ret
+
+0080119e <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  80119e:	55                   	push   %ebp
+  80119f:	89 e5                	mov    %esp,%ebp
+  8011a1:	57                   	push   %edi
+  8011a2:	56                   	push   %esi
+  8011a3:	53                   	push   %ebx
+  8011a4:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  8011a7:	80 3d 48 67 80 00 00 	cmpb   $0x0,0x806748
+  8011ae:	74 41                	je     8011f1 <sys_batch+0x53>
+  8011b0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011b3:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  8011b6:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  8011bd:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8011c0:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  8011c3:	7d 45                	jge    80120a <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  8011c5:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8011c8:	8b 06                	mov    (%esi),%eax
+  8011ca:	8b 56 04             	mov    0x4(%esi),%edx
+  8011cd:	8b 4e 08             	mov    0x8(%esi),%ecx
+  8011d0:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  8011d3:	8b 7e 10             	mov    0x10(%esi),%edi
+  8011d6:	8b 76 14             	mov    0x14(%esi),%esi
+  8011d9:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  8011db:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8011de:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  8011e1:	83 c6 1c             	add    $0x1c,%esi
+  8011e4:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  8011e7:	85 c0                	test   %eax,%eax
+  8011e9:	78 1f                	js     80120a <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  8011eb:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  8011ef:	eb cc                	jmp    8011bd <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  8011f1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011f6:	b8 13 00 00 00       	mov    $0x13,%eax
+  8011fb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011fe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801201:	89 df                	mov    %ebx,%edi
+  801203:	89 de                	mov    %ebx,%esi
+  801205:	cd 30                	int    $0x30
+  801207:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  80120a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80120d:	83 c4 08             	add    $0x8,%esp
+  801210:	5b                   	pop    %ebx
+  801211:	5e                   	pop    %esi
+  801212:	5f                   	pop    %edi
+  801213:	5d                   	pop    %ebp
+  801214:	c3                   	ret
+
+00801215 <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  801215:	55                   	push   %ebp
+  801216:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  801218:	8b 45 08             	mov    0x8(%ebp),%eax
+  80121b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  801221:	5d                   	pop    %ebp
+  801222:	c3                   	ret
+
+00801223 <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  801223:	55                   	push   %ebp
+  801224:	89 e5                	mov    %esp,%ebp
+  801226:	56                   	push   %esi
+  801227:	53                   	push   %ebx
+  801228:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  80122b:	8b 1e                	mov    (%esi),%ebx
+  80122d:	85 db                	test   %ebx,%ebx
+  80122f:	75 09                	jne    80123a <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  801231:	89 d8                	mov    %ebx,%eax
+  801233:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801236:	5b                   	pop    %ebx
+  801237:	5e                   	pop    %esi
+  801238:	5d                   	pop    %ebp
+  801239:	c3                   	ret
+  b->sb_n = 0;
+  80123a:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  801240:	53                   	push   %ebx
+  801241:	8d 46 04             	lea    0x4(%esi),%eax
+  801244:	50                   	push   %eax
+  801245:	e8 54 ff ff ff       	call   80119e <sys_batch>
+  80124a:	83 c4 08             	add    $0x8,%esp
+  80124d:	85 c0                	test   %eax,%eax
+  80124f:	78 1e                	js     80126f <sysbatch_flush+0x4c>
+  if (r < n)
+  801251:	39 c3                	cmp    %eax,%ebx
+  801253:	7f 07                	jg     80125c <sysbatch_flush+0x39>
+  return 0;
+  801255:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80125a:	eb d5                	jmp    801231 <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  80125c:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80125f:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  801263:	85 db                	test   %ebx,%ebx
+  801265:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80126a:	0f 49 d8             	cmovns %eax,%ebx
+  80126d:	eb c2                	jmp    801231 <sysbatch_flush+0xe>
+    return r;
+  80126f:	89 c3                	mov    %eax,%ebx
+  801271:	eb be                	jmp    801231 <sysbatch_flush+0xe>
+
+00801273 <sysbatch_add>:
+{
+  801273:	55                   	push   %ebp
+  801274:	89 e5                	mov    %esp,%ebp
+  801276:	53                   	push   %ebx
+  801277:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  80127a:	83 3b 40             	cmpl   $0x40,(%ebx)
+  80127d:	74 41                	je     8012c0 <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  80127f:	8b 03                	mov    (%ebx),%eax
+  801281:	8d 50 01             	lea    0x1(%eax),%edx
+  801284:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  801286:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801289:	01 d8                	add    %ebx,%eax
+  80128b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80128e:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  801291:	8b 55 10             	mov    0x10(%ebp),%edx
+  801294:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  801297:	8b 55 14             	mov    0x14(%ebp),%edx
+  80129a:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  80129d:	8b 55 18             	mov    0x18(%ebp),%edx
+  8012a0:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  8012a3:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  8012a6:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  8012a9:	8b 55 20             	mov    0x20(%ebp),%edx
+  8012ac:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  8012af:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  8012b6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8012bb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012be:	c9                   	leave
+  8012bf:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  8012c0:	53                   	push   %ebx
+  8012c1:	e8 5d ff ff ff       	call   801223 <sysbatch_flush>
+  8012c6:	83 c4 04             	add    $0x4,%esp
+  8012c9:	85 c0                	test   %eax,%eax
+  8012cb:	79 b2                	jns    80127f <sysbatch_add+0xc>
+  8012cd:	eb ec                	jmp    8012bb <sysbatch_add+0x48>
+
+008012cf <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8012cf:	55                   	push   %ebp
+  8012d0:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8012d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8012d5:	05 00 00 00 30       	add    $0x30000000,%eax
+  8012da:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8012dd:	5d                   	pop    %ebp
+  8012de:	c3                   	ret
+
+008012df <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8012df:	55                   	push   %ebp
+  8012e0:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8012e2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8012e5:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  8012e8:	66 b8 00 00          	mov    $0x0,%ax
+  8012ec:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8012f1:	5d                   	pop    %ebp
+  8012f2:	c3                   	ret
+
+008012f3 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8012f3:	55                   	push   %ebp
+  8012f4:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  8012f6:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8012fb:	eb 02                	jmp    8012ff <fd_alloc+0xc>
+  8012fd:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8012ff:	89 c2                	mov    %eax,%edx
+  801301:	c1 ea 16             	shr    $0x16,%edx
+  801304:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80130b:	f6 c2 01             	test   $0x1,%dl
+  80130e:	74 2b                	je     80133b <fd_alloc+0x48>
+  801310:	89 c2                	mov    %eax,%edx
+  801312:	c1 ea 0c             	shr    $0xc,%edx
+  801315:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80131c:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801322:	f6 c1 01             	test   $0x1,%cl
+  801325:	74 14                	je     80133b <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  801327:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  80132d:	75 ce                	jne    8012fd <fd_alloc+0xa>
+  80132f:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  801334:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801339:	eb 05                	jmp    801340 <fd_alloc+0x4d>
+      return 0;
+  80133b:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  801340:	8b 55 08             	mov    0x8(%ebp),%edx
+  801343:	89 02                	mov    %eax,(%edx)
+}
+  801345:	89 c8                	mov    %ecx,%eax
+  801347:	5d                   	pop    %ebp
+  801348:	c3                   	ret
+
+00801349 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801349:	55                   	push   %ebp
+  80134a:	89 e5                	mov    %esp,%ebp
+  80134c:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  80134f:	83 f8 1f             	cmp    $0x1f,%eax
+  801352:	77 30                	ja     801384 <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  801354:	c1 e0 0c             	shl    $0xc,%eax
+  801357:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80135c:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801362:	f6 c2 01             	test   $0x1,%dl
+  801365:	74 24                	je     80138b <fd_lookup+0x42>
+  801367:	89 c2                	mov    %eax,%edx
+  801369:	c1 ea 0c             	shr    $0xc,%edx
+  80136c:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801373:	f6 c2 01             	test   $0x1,%dl
+  801376:	74 1a                	je     801392 <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  801378:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80137b:	89 02                	mov    %eax,(%edx)
+  return 0;
+  80137d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801382:	5d                   	pop    %ebp
+  801383:	c3                   	ret
+    return -E_INVAL;
+  801384:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801389:	eb f7                	jmp    801382 <fd_lookup+0x39>
+    return -E_INVAL;
+  80138b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801390:	eb f0                	jmp    801382 <fd_lookup+0x39>
+  801392:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801397:	eb e9                	jmp    801382 <fd_lookup+0x39>
+
+00801399 <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801399:	55                   	push   %ebp
+  80139a:	89 e5                	mov    %esp,%ebp
+  80139c:	53                   	push   %ebx
+  80139d:	83 ec 04             	sub    $0x4,%esp
+  8013a0:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  8013a3:	b8 6c 35 80 00       	mov    $0x80356c,%eax
+  8013a8:	8b 18                	mov    (%eax),%ebx
+  8013aa:	85 db                	test   %ebx,%ebx
+  8013ac:	74 0e                	je     8013bc <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  8013ae:	83 c0 04             	add    $0x4,%eax
+  8013b1:	39 13                	cmp    %edx,(%ebx)
+  8013b3:	75 f3                	jne    8013a8 <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  8013b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013ba:	eb 1f                	jmp    8013db <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8013bc:	a1 44 67 80 00       	mov    0x806744,%eax
+  8013c1:	8b 40 48             	mov    0x48(%eax),%eax
+  8013c4:	83 ec 04             	sub    $0x4,%esp
+  8013c7:	52                   	push   %edx
+  8013c8:	50                   	push   %eax
+  8013c9:	68 f0 34 80 00       	push   $0x8034f0
+  8013ce:	e8 30 f0 ff ff       	call   800403 <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  8013d3:	83 c4 10             	add    $0x10,%esp
+  8013d6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  8013db:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8013de:	89 1a                	mov    %ebx,(%edx)
+}
+  8013e0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013e3:	c9                   	leave
+  8013e4:	c3                   	ret
+
+008013e5 <fd_close>:
+{
+  8013e5:	55                   	push   %ebp
+  8013e6:	89 e5                	mov    %esp,%ebp
+  8013e8:	57                   	push   %edi
+  8013e9:	56                   	push   %esi
+  8013ea:	53                   	push   %ebx
+  8013eb:	83 ec 24             	sub    $0x24,%esp
+  8013ee:	8b 75 08             	mov    0x8(%ebp),%esi
+  8013f1:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8013f4:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8013f7:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8013f8:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8013fe:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801401:	50                   	push   %eax
+  801402:	e8 42 ff ff ff       	call   801349 <fd_lookup>
+  801407:	89 c3                	mov    %eax,%ebx
+  801409:	83 c4 10             	add    $0x10,%esp
+  80140c:	85 c0                	test   %eax,%eax
+  80140e:	78 05                	js     801415 <fd_close+0x30>
+      || fd != fd2)
+  801410:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801413:	74 16                	je     80142b <fd_close+0x46>
+    return must_exist ? r : 0;
+  801415:	89 f8                	mov    %edi,%eax
+  801417:	84 c0                	test   %al,%al
+  801419:	b8 00 00 00 00       	mov    $0x0,%eax
+  80141e:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801421:	89 d8                	mov    %ebx,%eax
+  801423:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801426:	5b                   	pop    %ebx
+  801427:	5e                   	pop    %esi
+  801428:	5f                   	pop    %edi
+  801429:	5d                   	pop    %ebp
+  80142a:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80142b:	83 ec 08             	sub    $0x8,%esp
+  80142e:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801431:	50                   	push   %eax
+  801432:	ff 36                	push   (%esi)
+  801434:	e8 60 ff ff ff       	call   801399 <dev_lookup>
+  801439:	89 c3                	mov    %eax,%ebx
+  80143b:	83 c4 10             	add    $0x10,%esp
+  80143e:	85 c0                	test   %eax,%eax
+  801440:	78 1a                	js     80145c <fd_close+0x77>
+    if (dev->dev_close)
+  801442:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801445:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  801448:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  80144d:	85 c0                	test   %eax,%eax
+  80144f:	74 0b                	je     80145c <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  801451:	83 ec 0c             	sub    $0xc,%esp
+  801454:	56                   	push   %esi
+  801455:	ff d0                	call   *%eax
+  801457:	89 c3                	mov    %eax,%ebx
+  801459:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  80145c:	83 ec 08             	sub    $0x8,%esp
+  80145f:	56                   	push   %esi
+  801460:	6a 00                	push   $0x0
+  801462:	e8 3e fa ff ff       	call   800ea5 <sys_page_unmap>
+  return r;
+  801467:	83 c4 10             	add    $0x10,%esp
+  80146a:	eb b5                	jmp    801421 <fd_close+0x3c>
+
+0080146c <close>:
+
+int
+close(int fdnum)
+{
+  80146c:	55                   	push   %ebp
+  80146d:	89 e5                	mov    %esp,%ebp
+  80146f:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801472:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801475:	50                   	push   %eax
+  801476:	ff 75 08             	push   0x8(%ebp)
+  801479:	e8 cb fe ff ff       	call   801349 <fd_lookup>
+  80147e:	83 c4 10             	add    $0x10,%esp
+  801481:	85 c0                	test   %eax,%eax
+  801483:	79 02                	jns    801487 <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  801485:	c9                   	leave
+  801486:	c3                   	ret
+    return fd_close(fd, 1);
+  801487:	83 ec 08             	sub    $0x8,%esp
+  80148a:	6a 01                	push   $0x1
+  80148c:	ff 75 f4             	push   -0xc(%ebp)
+  80148f:	e8 51 ff ff ff       	call   8013e5 <fd_close>
+  801494:	83 c4 10             	add    $0x10,%esp
+  801497:	eb ec                	jmp    801485 <close+0x19>
+
+00801499 <close_all>:
+
+void
+close_all(void)
+{
+  801499:	55                   	push   %ebp
+  80149a:	89 e5                	mov    %esp,%ebp
+  80149c:	53                   	push   %ebx
+  80149d:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  8014a0:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  8014a5:	83 ec 0c             	sub    $0xc,%esp
+  8014a8:	53                   	push   %ebx
+  8014a9:	e8 be ff ff ff       	call   80146c <close>
+  for (i = 0; i < MAXFD; i++)
+  8014ae:	83 c3 01             	add    $0x1,%ebx
+  8014b1:	83 c4 10             	add    $0x10,%esp
+  8014b4:	83 fb 20             	cmp    $0x20,%ebx
+  8014b7:	75 ec                	jne    8014a5 <close_all+0xc>
+}
+  8014b9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014bc:	c9                   	leave
+  8014bd:	c3                   	ret
+
+008014be <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8014be:	55                   	push   %ebp
+  8014bf:	89 e5                	mov    %esp,%ebp
+  8014c1:	57                   	push   %edi
+  8014c2:	56                   	push   %esi
+  8014c3:	53                   	push   %ebx
+  8014c4:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8014c7:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8014ca:	50                   	push   %eax
+  8014cb:	ff 75 08             	push   0x8(%ebp)
+  8014ce:	e8 76 fe ff ff       	call   801349 <fd_lookup>
+  8014d3:	89 c6                	mov    %eax,%esi
+  8014d5:	83 c4 10             	add    $0x10,%esp
+  8014d8:	85 c0                	test   %eax,%eax
+  8014da:	0f 88 0a 01 00 00    	js     8015ea <dup+0x12c>
+    return r;
+  close(newfdnum);
+  8014e0:	83 ec 0c             	sub    $0xc,%esp
+  8014e3:	ff 75 0c             	push   0xc(%ebp)
+  8014e6:	e8 81 ff ff ff       	call   80146c <close>
+
+  newfd = INDEX2FD(newfdnum);
+  8014eb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8014ee:	c1 e0 0c             	shl    $0xc,%eax
+  8014f1:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  8014f7:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  8014fa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8014fd:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  801500:	89 04 24             	mov    %eax,(%esp)
+  801503:	e8 d7 fd ff ff       	call   8012df <fd2data>
+  801508:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  80150a:	89 3c 24             	mov    %edi,(%esp)
+  80150d:	e8 cd fd ff ff       	call   8012df <fd2data>
+  801512:	83 c4 10             	add    $0x10,%esp
+  801515:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801518:	89 f3                	mov    %esi,%ebx
+  80151a:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  801520:	89 c6                	mov    %eax,%esi
+  801522:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801525:	89 cf                	mov    %ecx,%edi
+  801527:	eb 0c                	jmp    801535 <dup+0x77>
+  801529:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80152f:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801535:	39 fb                	cmp    %edi,%ebx
+  801537:	74 7b                	je     8015b4 <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  801539:	89 d8                	mov    %ebx,%eax
+  80153b:	c1 e8 16             	shr    $0x16,%eax
+  80153e:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801545:	a8 01                	test   $0x1,%al
+  801547:	74 e0                	je     801529 <dup+0x6b>
+  801549:	89 d8                	mov    %ebx,%eax
+  80154b:	c1 e8 0c             	shr    $0xc,%eax
+  80154e:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801555:	f6 c2 01             	test   $0x1,%dl
+  801558:	74 cf                	je     801529 <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  80155a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  801561:	83 ec 0c             	sub    $0xc,%esp
+  801564:	25 07 0e 00 00       	and    $0xe07,%eax
+  801569:	50                   	push   %eax
+  80156a:	56                   	push   %esi
+  80156b:	6a 00                	push   $0x0
+  80156d:	53                   	push   %ebx
+  80156e:	6a 00                	push   $0x0
+  801570:	e8 ee f8 ff ff       	call   800e63 <sys_page_map>
+  801575:	83 c4 20             	add    $0x20,%esp
+  801578:	85 c0                	test   %eax,%eax
+  80157a:	79 ad                	jns    801529 <dup+0x6b>
+  80157c:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80157f:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  801581:	83 ec 08             	sub    $0x8,%esp
+  801584:	ff 75 d4             	push   -0x2c(%ebp)
+  801587:	6a 00                	push   $0x0
+  801589:	e8 17 f9 ff ff       	call   800ea5 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80158e:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  801591:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  801597:	83 c4 10             	add    $0x10,%esp
+  80159a:	39 df                	cmp    %ebx,%edi
+  80159c:	74 4c                	je     8015ea <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  80159e:	83 ec 08             	sub    $0x8,%esp
+  8015a1:	57                   	push   %edi
+  8015a2:	6a 00                	push   $0x0
+  8015a4:	e8 fc f8 ff ff       	call   800ea5 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8015a9:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  8015af:	83 c4 10             	add    $0x10,%esp
+  8015b2:	eb e6                	jmp    80159a <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8015b4:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8015b7:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8015ba:	89 c8                	mov    %ecx,%eax
+  8015bc:	c1 e8 0c             	shr    $0xc,%eax
+  8015bf:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8015c6:	83 ec 0c             	sub    $0xc,%esp
+  8015c9:	25 07 0e 00 00       	and    $0xe07,%eax
+  8015ce:	50                   	push   %eax
+  8015cf:	ff 75 d4             	push   -0x2c(%ebp)
+  8015d2:	6a 00                	push   $0x0
+  8015d4:	51                   	push   %ecx
+  8015d5:	6a 00                	push   $0x0
+  8015d7:	e8 87 f8 ff ff       	call   800e63 <sys_page_map>
+  8015dc:	89 c6                	mov    %eax,%esi
+  8015de:	83 c4 20             	add    $0x20,%esp
+  8015e1:	85 c0                	test   %eax,%eax
+  8015e3:	78 9c                	js     801581 <dup+0xc3>
+  return newfdnum;
+  8015e5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8015e8:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  8015ea:	89 f0                	mov    %esi,%eax
+  8015ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015ef:	5b                   	pop    %ebx
+  8015f0:	5e                   	pop    %esi
+  8015f1:	5f                   	pop    %edi
+  8015f2:	5d                   	pop    %ebp
+  8015f3:	c3                   	ret
+
+008015f4 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8015f4:	55                   	push   %ebp
+  8015f5:	89 e5                	mov    %esp,%ebp
+  8015f7:	56                   	push   %esi
+  8015f8:	53                   	push   %ebx
+  8015f9:	83 ec 18             	sub    $0x18,%esp
+  8015fc:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  8015ff:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801602:	50                   	push   %eax
+  801603:	56                   	push   %esi
+  801604:	e8 40 fd ff ff       	call   801349 <fd_lookup>
+  801609:	83 c4 10             	add    $0x10,%esp
+  80160c:	85 c0                	test   %eax,%eax
+  80160e:	78 3c                	js     80164c <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801610:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801613:	83 ec 08             	sub    $0x8,%esp
+  801616:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801619:	50                   	push   %eax
+  80161a:	ff 33                	push   (%ebx)
+  80161c:	e8 78 fd ff ff       	call   801399 <dev_lookup>
+  801621:	83 c4 10             	add    $0x10,%esp
+  801624:	85 c0                	test   %eax,%eax
+  801626:	78 24                	js     80164c <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801628:	8b 43 08             	mov    0x8(%ebx),%eax
+  80162b:	83 e0 03             	and    $0x3,%eax
+  80162e:	83 f8 01             	cmp    $0x1,%eax
+  801631:	74 20                	je     801653 <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  801633:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801636:	8b 40 08             	mov    0x8(%eax),%eax
+  801639:	85 c0                	test   %eax,%eax
+  80163b:	74 37                	je     801674 <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  80163d:	83 ec 04             	sub    $0x4,%esp
+  801640:	ff 75 10             	push   0x10(%ebp)
+  801643:	ff 75 0c             	push   0xc(%ebp)
+  801646:	53                   	push   %ebx
+  801647:	ff d0                	call   *%eax
+  801649:	83 c4 10             	add    $0x10,%esp
+}
+  80164c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80164f:	5b                   	pop    %ebx
+  801650:	5e                   	pop    %esi
+  801651:	5d                   	pop    %ebp
+  801652:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801653:	a1 44 67 80 00       	mov    0x806744,%eax
+  801658:	8b 40 48             	mov    0x48(%eax),%eax
+  80165b:	83 ec 04             	sub    $0x4,%esp
+  80165e:	56                   	push   %esi
+  80165f:	50                   	push   %eax
+  801660:	68 31 35 80 00       	push   $0x803531
+  801665:	e8 99 ed ff ff       	call   800403 <cprintf>
+    return -E_INVAL;
+  80166a:	83 c4 10             	add    $0x10,%esp
+  80166d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801672:	eb d8                	jmp    80164c <read+0x58>
+    return -E_NOT_SUPP;
+  801674:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801679:	eb d1                	jmp    80164c <read+0x58>
+
+0080167b <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80167b:	55                   	push   %ebp
+  80167c:	89 e5                	mov    %esp,%ebp
+  80167e:	57                   	push   %edi
+  80167f:	56                   	push   %esi
+  801680:	53                   	push   %ebx
+  801681:	83 ec 0c             	sub    $0xc,%esp
+  801684:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801687:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  80168a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80168f:	eb 02                	jmp    801693 <readn+0x18>
+  801691:	01 c3                	add    %eax,%ebx
+  801693:	39 f3                	cmp    %esi,%ebx
+  801695:	73 21                	jae    8016b8 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  801697:	83 ec 04             	sub    $0x4,%esp
+  80169a:	89 f0                	mov    %esi,%eax
+  80169c:	29 d8                	sub    %ebx,%eax
+  80169e:	50                   	push   %eax
+  80169f:	89 d8                	mov    %ebx,%eax
+  8016a1:	03 45 0c             	add    0xc(%ebp),%eax
+  8016a4:	50                   	push   %eax
+  8016a5:	57                   	push   %edi
+  8016a6:	e8 49 ff ff ff       	call   8015f4 <read>
+    if (m < 0)
+  8016ab:	83 c4 10             	add    $0x10,%esp
+  8016ae:	85 c0                	test   %eax,%eax
+  8016b0:	78 04                	js     8016b6 <readn+0x3b>
+      return m;
+    if (m == 0)
+  8016b2:	75 dd                	jne    801691 <readn+0x16>
+  8016b4:	eb 02                	jmp    8016b8 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  8016b6:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  8016b8:	89 d8                	mov    %ebx,%eax
+  8016ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016bd:	5b                   	pop    %ebx
+  8016be:	5e                   	pop    %esi
+  8016bf:	5f                   	pop    %edi
+  8016c0:	5d                   	pop    %ebp
+  8016c1:	c3                   	ret
+
+008016c2 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8016c2:	55                   	push   %ebp
+  8016c3:	89 e5                	mov    %esp,%ebp
+  8016c5:	56                   	push   %esi
+  8016c6:	53                   	push   %ebx
+  8016c7:	83 ec 18             	sub    $0x18,%esp
+  8016ca:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016cd:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016d0:	50                   	push   %eax
+  8016d1:	53                   	push   %ebx
+  8016d2:	e8 72 fc ff ff       	call   801349 <fd_lookup>
+  8016d7:	83 c4 10             	add    $0x10,%esp
+  8016da:	85 c0                	test   %eax,%eax
+  8016dc:	78 37                	js     801715 <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8016de:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8016e1:	83 ec 08             	sub    $0x8,%esp
+  8016e4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016e7:	50                   	push   %eax
+  8016e8:	ff 36                	push   (%esi)
+  8016ea:	e8 aa fc ff ff       	call   801399 <dev_lookup>
+  8016ef:	83 c4 10             	add    $0x10,%esp
+  8016f2:	85 c0                	test   %eax,%eax
+  8016f4:	78 1f                	js     801715 <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8016f6:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8016fa:	74 20                	je     80171c <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  8016fc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016ff:	8b 40 0c             	mov    0xc(%eax),%eax
+  801702:	85 c0                	test   %eax,%eax
+  801704:	74 37                	je     80173d <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  801706:	83 ec 04             	sub    $0x4,%esp
+  801709:	ff 75 10             	push   0x10(%ebp)
+  80170c:	ff 75 0c             	push   0xc(%ebp)
+  80170f:	56                   	push   %esi
+  801710:	ff d0                	call   *%eax
+  801712:	83 c4 10             	add    $0x10,%esp
+}
+  801715:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801718:	5b                   	pop    %ebx
+  801719:	5e                   	pop    %esi
+  80171a:	5d                   	pop    %ebp
+  80171b:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80171c:	a1 44 67 80 00       	mov    0x806744,%eax
+  801721:	8b 40 48             	mov    0x48(%eax),%eax
+  801724:	83 ec 04             	sub    $0x4,%esp
+  801727:	53                   	push   %ebx
+  801728:	50                   	push   %eax
+  801729:	68 4d 35 80 00       	push   $0x80354d
+  80172e:	e8 d0 ec ff ff       	call   800403 <cprintf>
+    return -E_INVAL;
+  801733:	83 c4 10             	add    $0x10,%esp
+  801736:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80173b:	eb d8                	jmp    801715 <write+0x53>
+    return -E_NOT_SUPP;
+  80173d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801742:	eb d1                	jmp    801715 <write+0x53>
+
+00801744 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801744:	55                   	push   %ebp
+  801745:	89 e5                	mov    %esp,%ebp
+  801747:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80174a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80174d:	50                   	push   %eax
+  80174e:	ff 75 08             	push   0x8(%ebp)
+  801751:	e8 f3 fb ff ff       	call   801349 <fd_lookup>
+  801756:	83 c4 10             	add    $0x10,%esp
+  801759:	85 c0                	test   %eax,%eax
+  80175b:	78 0e                	js     80176b <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  80175d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801760:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801763:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  801766:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80176b:	c9                   	leave
+  80176c:	c3                   	ret
+
+0080176d <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80176d:	55                   	push   %ebp
+  80176e:	89 e5                	mov    %esp,%ebp
+  801770:	56                   	push   %esi
+  801771:	53                   	push   %ebx
+  801772:	83 ec 18             	sub    $0x18,%esp
+  801775:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801778:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80177b:	50                   	push   %eax
+  80177c:	53                   	push   %ebx
+  80177d:	e8 c7 fb ff ff       	call   801349 <fd_lookup>
+  801782:	83 c4 10             	add    $0x10,%esp
+  801785:	85 c0                	test   %eax,%eax
+  801787:	78 34                	js     8017bd <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801789:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80178c:	83 ec 08             	sub    $0x8,%esp
+  80178f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801792:	50                   	push   %eax
+  801793:	ff 36                	push   (%esi)
+  801795:	e8 ff fb ff ff       	call   801399 <dev_lookup>
+  80179a:	83 c4 10             	add    $0x10,%esp
+  80179d:	85 c0                	test   %eax,%eax
+  80179f:	78 1c                	js     8017bd <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8017a1:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8017a5:	74 1d                	je     8017c4 <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  8017a7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017aa:	8b 40 18             	mov    0x18(%eax),%eax
+  8017ad:	85 c0                	test   %eax,%eax
+  8017af:	74 34                	je     8017e5 <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  8017b1:	83 ec 08             	sub    $0x8,%esp
+  8017b4:	ff 75 0c             	push   0xc(%ebp)
+  8017b7:	56                   	push   %esi
+  8017b8:	ff d0                	call   *%eax
+  8017ba:	83 c4 10             	add    $0x10,%esp
+}
+  8017bd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017c0:	5b                   	pop    %ebx
+  8017c1:	5e                   	pop    %esi
+  8017c2:	5d                   	pop    %ebp
+  8017c3:	c3                   	ret
+            thisenv->env_id, fdnum);
+  8017c4:	a1 44 67 80 00       	mov    0x806744,%eax
+  8017c9:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8017cc:	83 ec 04             	sub    $0x4,%esp
+  8017cf:	53                   	push   %ebx
+  8017d0:	50                   	push   %eax
+  8017d1:	68 10 35 80 00       	push   $0x803510
+  8017d6:	e8 28 ec ff ff       	call   800403 <cprintf>
+    return -E_INVAL;
+  8017db:	83 c4 10             	add    $0x10,%esp
+  8017de:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017e3:	eb d8                	jmp    8017bd <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  8017e5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017ea:	eb d1                	jmp    8017bd <ftruncate+0x50>
+
+008017ec <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8017ec:	55                   	push   %ebp
+  8017ed:	89 e5                	mov    %esp,%ebp
+  8017ef:	56                   	push   %esi
+  8017f0:	53                   	push   %ebx
+  8017f1:	83 ec 18             	sub    $0x18,%esp
+  8017f4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017f7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017fa:	50                   	push   %eax
+  8017fb:	ff 75 08             	push   0x8(%ebp)
+  8017fe:	e8 46 fb ff ff       	call   801349 <fd_lookup>
+  801803:	83 c4 10             	add    $0x10,%esp
+  801806:	85 c0                	test   %eax,%eax
+  801808:	78 49                	js     801853 <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80180a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80180d:	83 ec 08             	sub    $0x8,%esp
+  801810:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801813:	50                   	push   %eax
+  801814:	ff 36                	push   (%esi)
+  801816:	e8 7e fb ff ff       	call   801399 <dev_lookup>
+  80181b:	83 c4 10             	add    $0x10,%esp
+  80181e:	85 c0                	test   %eax,%eax
+  801820:	78 31                	js     801853 <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  801822:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801825:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801829:	74 2f                	je     80185a <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  80182b:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  80182e:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801835:	00 00 00 
+  stat->st_isdir = 0;
+  801838:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80183f:	00 00 00 
+  stat->st_dev = dev;
+  801842:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  801848:	83 ec 08             	sub    $0x8,%esp
+  80184b:	53                   	push   %ebx
+  80184c:	56                   	push   %esi
+  80184d:	ff 50 14             	call   *0x14(%eax)
+  801850:	83 c4 10             	add    $0x10,%esp
+}
+  801853:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801856:	5b                   	pop    %ebx
+  801857:	5e                   	pop    %esi
+  801858:	5d                   	pop    %ebp
+  801859:	c3                   	ret
+    return -E_NOT_SUPP;
+  80185a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80185f:	eb f2                	jmp    801853 <fstat+0x67>
+
+00801861 <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  801861:	55                   	push   %ebp
+  801862:	89 e5                	mov    %esp,%ebp
+  801864:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  801867:	ff 75 0c             	push   0xc(%ebp)
+  80186a:	ff 75 08             	push   0x8(%ebp)
+  80186d:	e8 58 07 00 00       	call   801fca <file_stat>
+}
+  801872:	c9                   	leave
+  801873:	c3                   	ret
+
+00801874 <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  801874:	55                   	push   %ebp
+  801875:	89 e5                	mov    %esp,%ebp
+  801877:	57                   	push   %edi
+  801878:	56                   	push   %esi
+  801879:	53                   	push   %ebx
+  80187a:	83 ec 1c             	sub    $0x1c,%esp
+  80187d:	89 c7                	mov    %eax,%edi
+  80187f:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801882:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801885:	e9 a2 00 00 00       	jmp    80192c <fsipc_send+0xb8>
+  nfsenvs = 0;
+  80188a:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  801891:	00 00 00 
+  801894:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801899:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  80189e:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  8018a3:	be 01 00 00 00       	mov    $0x1,%esi
+  8018a8:	eb 0f                	jmp    8018b9 <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  8018aa:	83 c0 01             	add    $0x1,%eax
+  8018ad:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8018b2:	74 49                	je     8018fd <fsipc_send+0x89>
+  8018b4:	83 f9 07             	cmp    $0x7,%ecx
+  8018b7:	7f 50                	jg     801909 <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  8018b9:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  8018bc:	c1 e2 04             	shl    $0x4,%edx
+  8018bf:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8018c5:	8b 52 50             	mov    0x50(%edx),%edx
+  8018c8:	83 fa 01             	cmp    $0x1,%edx
+  8018cb:	75 dd                	jne    8018aa <fsipc_send+0x36>
+  8018cd:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  8018d0:	c1 e2 04             	shl    $0x4,%edx
+  8018d3:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8018d9:	8b 52 54             	mov    0x54(%edx),%edx
+  8018dc:	85 d2                	test   %edx,%edx
+  8018de:	74 ca                	je     8018aa <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  8018e0:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  8018e3:	c1 e2 04             	shl    $0x4,%edx
+  8018e6:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8018ec:	8b 52 48             	mov    0x48(%edx),%edx
+  8018ef:	89 14 8d 20 60 80 00 	mov    %edx,0x806020(,%ecx,4)
+  8018f6:	8d 49 01             	lea    0x1(%ecx),%ecx
+  8018f9:	89 f3                	mov    %esi,%ebx
+  8018fb:	eb ad                	jmp    8018aa <fsipc_send+0x36>
+  8018fd:	84 db                	test   %bl,%bl
+  8018ff:	74 38                	je     801939 <fsipc_send+0xc5>
+  801901:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+  801907:	eb 30                	jmp    801939 <fsipc_send+0xc5>
+  801909:	84 db                	test   %bl,%bl
+  80190b:	74 2c                	je     801939 <fsipc_send+0xc5>
+  80190d:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+  801913:	eb 24                	jmp    801939 <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  801915:	50                   	push   %eax
+  801916:	68 7c 35 80 00       	push   $0x80357c
+  80191b:	6a 34                	push   $0x34
+  80191d:	68 86 35 80 00       	push   $0x803586
+  801922:	e8 01 ea ff ff       	call   800328 <_panic>
+    }
+    sys_yield();
+  801927:	e8 92 f4 ff ff       	call   800dbe <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  80192c:	83 3d 00 60 80 00 03 	cmpl   $0x3,0x806000
+  801933:	0f 8e 51 ff ff ff    	jle    80188a <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  801939:	a1 44 67 80 00       	mov    0x806744,%eax
+  80193e:	8b 70 48             	mov    0x48(%eax),%esi
+  801941:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  801947:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80194c:	8b 0d 00 60 80 00    	mov    0x806000,%ecx
+  801952:	39 d9                	cmp    %ebx,%ecx
+  801954:	7e d1                	jle    801927 <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  801956:	83 ec 0c             	sub    $0xc,%esp
+  801959:	ff 75 e0             	push   -0x20(%ebp)
+  80195c:	6a 07                	push   $0x7
+  80195e:	ff 75 e4             	push   -0x1c(%ebp)
+  801961:	57                   	push   %edi
+  801962:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  801965:	99                   	cltd
+  801966:	f7 f9                	idiv   %ecx
+  801968:	ff 34 95 20 60 80 00 	push   0x806020(,%edx,4)
+  80196f:	e8 63 f7 ff ff       	call   8010d7 <sys_ipc_try_send>
+      if (r == 0)
+  801974:	83 c4 20             	add    $0x20,%esp
+  801977:	85 c0                	test   %eax,%eax
+  801979:	74 0a                	je     801985 <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  80197b:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80197e:	75 95                	jne    801915 <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  801980:	83 c3 01             	add    $0x1,%ebx
+  801983:	eb c7                	jmp    80194c <fsipc_send+0xd8>
+  }
+}
+  801985:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801988:	5b                   	pop    %ebx
+  801989:	5e                   	pop    %esi
+  80198a:	5f                   	pop    %edi
+  80198b:	5d                   	pop    %ebp
+  80198c:	c3                   	ret
+
+0080198d <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  80198d:	55                   	push   %ebp
+  80198e:	89 e5                	mov    %esp,%ebp
+  801990:	53                   	push   %ebx
+  801991:	83 ec 14             	sub    $0x14,%esp
+  801994:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  801996:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  80199d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8019a2:	ba 00 70 80 00       	mov    $0x807000,%edx
+  8019a7:	e8 c8 fe ff ff       	call   801874 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  8019ac:	6a 00                	push   $0x0
+  8019ae:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019b1:	50                   	push   %eax
+  8019b2:	53                   	push   %ebx
+  8019b3:	6a 00                	push   $0x0
+  8019b5:	e8 26 13 00 00       	call   802ce0 <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  8019ba:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019bd:	c9                   	leave
+  8019be:	c3                   	ret
+
+008019bf <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8019bf:	55                   	push   %ebp
+  8019c0:	89 e5                	mov    %esp,%ebp
+  8019c2:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8019c5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019c8:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019cb:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.set_size.req_size = newsize;
+  8019d0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8019d3:	a3 04 70 80 00       	mov    %eax,0x807004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  8019d8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019dd:	b8 02 00 00 00       	mov    $0x2,%eax
+  8019e2:	e8 a6 ff ff ff       	call   80198d <fsipc>
+}
+  8019e7:	c9                   	leave
+  8019e8:	c3                   	ret
+
+008019e9 <devfile_flush>:
+{
+  8019e9:	55                   	push   %ebp
+  8019ea:	89 e5                	mov    %esp,%ebp
+  8019ec:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8019ef:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019f2:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019f5:	a3 00 70 80 00       	mov    %eax,0x807000
+  return fsipc(FSREQ_FLUSH, NULL);
+  8019fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019ff:	b8 06 00 00 00       	mov    $0x6,%eax
+  801a04:	e8 84 ff ff ff       	call   80198d <fsipc>
+}
+  801a09:	c9                   	leave
+  801a0a:	c3                   	ret
+
+00801a0b <devfile_stat>:
+{
+  801a0b:	55                   	push   %ebp
+  801a0c:	89 e5                	mov    %esp,%ebp
+  801a0e:	53                   	push   %ebx
+  801a0f:	83 ec 04             	sub    $0x4,%esp
+  801a12:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801a15:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a18:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a1b:	a3 00 70 80 00       	mov    %eax,0x807000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801a20:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a25:	b8 05 00 00 00       	mov    $0x5,%eax
+  801a2a:	e8 5e ff ff ff       	call   80198d <fsipc>
+  801a2f:	85 c0                	test   %eax,%eax
+  801a31:	78 2c                	js     801a5f <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801a33:	83 ec 08             	sub    $0x8,%esp
+  801a36:	68 00 70 80 00       	push   $0x807000
+  801a3b:	53                   	push   %ebx
+  801a3c:	e8 b0 ef ff ff       	call   8009f1 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  801a41:	a1 80 70 80 00       	mov    0x807080,%eax
+  801a46:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801a4c:	a1 84 70 80 00       	mov    0x807084,%eax
+  801a51:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801a57:	83 c4 10             	add    $0x10,%esp
+  801a5a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a5f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a62:	c9                   	leave
+  801a63:	c3                   	ret
+
+00801a64 <fsv_alloc>:
+{
+  801a64:	55                   	push   %ebp
+  801a65:	89 e5                	mov    %esp,%ebp
+  801a67:	56                   	push   %esi
+  801a68:	53                   	push   %ebx
+  801a69:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  801a6b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a70:	eb 22                	jmp    801a94 <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  801a72:	83 ec 04             	sub    $0x4,%esp
+  801a75:	6a 00                	push   $0x0
+  801a77:	6a 00                	push   $0x0
+  801a79:	6a 07                	push   $0x7
+  801a7b:	50                   	push   %eax
+  801a7c:	6a 00                	push   $0x0
+  801a7e:	6a 04                	push   $0x4
+  801a80:	68 40 60 80 00       	push   $0x806040
+  801a85:	e8 e9 f7 ff ff       	call   801273 <sysbatch_add>
+  801a8a:	83 c4 20             	add    $0x20,%esp
+  801a8d:	85 c0                	test   %eax,%eax
+  801a8f:	78 48                	js     801ad9 <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  801a91:	83 c3 01             	add    $0x1,%ebx
+  801a94:	39 f3                	cmp    %esi,%ebx
+  801a96:	74 31                	je     801ac9 <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  801a98:	89 d8                	mov    %ebx,%eax
+  801a9a:	c1 e0 0c             	shl    $0xc,%eax
+  801a9d:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801aa2:	89 c2                	mov    %eax,%edx
+  801aa4:	c1 ea 16             	shr    $0x16,%edx
+  801aa7:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801aae:	f6 c2 01             	test   $0x1,%dl
+  801ab1:	74 bf                	je     801a72 <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  801ab3:	89 c2                	mov    %eax,%edx
+  801ab5:	c1 ea 0c             	shr    $0xc,%edx
+  801ab8:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801abf:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801ac2:	83 fa 03             	cmp    $0x3,%edx
+  801ac5:	75 ab                	jne    801a72 <fsv_alloc+0xe>
+  801ac7:	eb c8                	jmp    801a91 <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  801ac9:	83 ec 0c             	sub    $0xc,%esp
+  801acc:	68 40 60 80 00       	push   $0x806040
+  801ad1:	e8 4d f7 ff ff       	call   801223 <sysbatch_flush>
+  801ad6:	83 c4 10             	add    $0x10,%esp
+}
+  801ad9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801adc:	5b                   	pop    %ebx
+  801add:	5e                   	pop    %esi
+  801ade:	5d                   	pop    %ebp
+  801adf:	c3                   	ret
+
+00801ae0 <devfile_read>:
+{
+  801ae0:	55                   	push   %ebp
+  801ae1:	89 e5                	mov    %esp,%ebp
+  801ae3:	57                   	push   %edi
+  801ae4:	56                   	push   %esi
+  801ae5:	53                   	push   %ebx
+  801ae6:	83 ec 3c             	sub    $0x3c,%esp
+  801ae9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  801aec:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  801af2:	77 57                	ja     801b4b <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801af4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801af7:	8b 40 0c             	mov    0xc(%eax),%eax
+  801afa:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.read.req_n = n;
+  801aff:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801b05:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b0a:	b8 03 00 00 00       	mov    $0x3,%eax
+  801b0f:	e8 79 fe ff ff       	call   80198d <fsipc>
+  801b14:	89 c6                	mov    %eax,%esi
+  801b16:	85 c0                	test   %eax,%eax
+  801b18:	78 27                	js     801b41 <devfile_read+0x61>
+  assert(r <= n);
+  801b1a:	39 c3                	cmp    %eax,%ebx
+  801b1c:	0f 82 0e 02 00 00    	jb     801d30 <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  801b22:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801b27:	0f 8f 1c 02 00 00    	jg     801d49 <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801b2d:	83 ec 04             	sub    $0x4,%esp
+  801b30:	50                   	push   %eax
+  801b31:	68 00 70 80 00       	push   $0x807000
+  801b36:	ff 75 0c             	push   0xc(%ebp)
+  801b39:	e8 39 f0 ff ff       	call   800b77 <memmove>
+  return r;
+  801b3e:	83 c4 10             	add    $0x10,%esp
+}
+  801b41:	89 f0                	mov    %esi,%eax
+  801b43:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b46:	5b                   	pop    %ebx
+  801b47:	5e                   	pop    %esi
+  801b48:	5f                   	pop    %edi
+  801b49:	5d                   	pop    %ebp
+  801b4a:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  801b4b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b50:	e8 0f ff ff ff       	call   801a64 <fsv_alloc>
+  801b55:	89 c6                	mov    %eax,%esi
+  801b57:	85 c0                	test   %eax,%eax
+  801b59:	78 e6                	js     801b41 <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  801b5b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b5e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b61:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  801b66:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b69:	8b 40 04             	mov    0x4(%eax),%eax
+  801b6c:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  801b71:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  801b77:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801b7e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801b83:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801b88:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801b8d:	e8 e2 fc ff ff       	call   801874 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801b92:	6a 00                	push   $0x0
+  801b94:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801b97:	50                   	push   %eax
+  801b98:	68 00 10 c0 9f       	push   $0x9fc01000
+  801b9d:	6a 00                	push   $0x0
+  801b9f:	e8 3c 11 00 00       	call   802ce0 <ipc_recv_pages>
+  801ba4:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  801ba6:	83 c4 10             	add    $0x10,%esp
+  801ba9:	85 c0                	test   %eax,%eax
+  801bab:	7e 94                	jle    801b41 <devfile_read+0x61>
+  assert(r <= n);
+  801bad:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801bb0:	39 c3                	cmp    %eax,%ebx
+  801bb2:	72 2e                	jb     801be2 <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801bb4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bb7:	8b 40 04             	mov    0x4(%eax),%eax
+  801bba:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801bbf:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  801bc2:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801bc5:	c1 e2 0c             	shl    $0xc,%edx
+  801bc8:	39 ca                	cmp    %ecx,%edx
+  801bca:	72 2f                	jb     801bfb <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  801bcc:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  801bd1:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  801bd4:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  801bd8:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801bdd:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  801be0:	eb 52                	jmp    801c34 <devfile_read+0x154>
+  assert(r <= n);
+  801be2:	68 91 35 80 00       	push   $0x803591
+  801be7:	68 98 35 80 00       	push   $0x803598
+  801bec:	68 49 01 00 00       	push   $0x149
+  801bf1:	68 86 35 80 00       	push   $0x803586
+  801bf6:	e8 2d e7 ff ff       	call   800328 <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801bfb:	68 bc 35 80 00       	push   $0x8035bc
+  801c00:	68 98 35 80 00       	push   $0x803598
+  801c05:	68 4a 01 00 00       	push   $0x14a
+  801c0a:	68 86 35 80 00       	push   $0x803586
+  801c0f:	e8 14 e7 ff ff       	call   800328 <_panic>
+      memmove(dst + done, src + done, m);
+  801c14:	83 ec 04             	sub    $0x4,%esp
+  801c17:	53                   	push   %ebx
+  801c18:	56                   	push   %esi
+  801c19:	89 f8                	mov    %edi,%eax
+  801c1b:	03 45 0c             	add    0xc(%ebp),%eax
+  801c1e:	50                   	push   %eax
+  801c1f:	e8 53 ef ff ff       	call   800b77 <memmove>
+  801c24:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  801c27:	01 df                	add    %ebx,%edi
+  801c29:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801c2c:	39 c7                	cmp    %eax,%edi
+  801c2e:	0f 83 c0 00 00 00    	jae    801cf4 <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801c34:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801c37:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  801c3a:	89 f0                	mov    %esi,%eax
+  801c3c:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801c41:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  801c46:	29 c3                	sub    %eax,%ebx
+  801c48:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801c4b:	29 f8                	sub    %edi,%eax
+  801c4d:	39 c3                	cmp    %eax,%ebx
+  801c4f:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  801c52:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801c58:	75 ba                	jne    801c14 <devfile_read+0x134>
+  801c5a:	89 f9                	mov    %edi,%ecx
+  801c5c:	03 4d 0c             	add    0xc(%ebp),%ecx
+  801c5f:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  801c62:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  801c68:	75 aa                	jne    801c14 <devfile_read+0x134>
+  801c6a:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  801c70:	77 a2                	ja     801c14 <devfile_read+0x134>
+  801c72:	89 c8                	mov    %ecx,%eax
+  801c74:	c1 e8 16             	shr    $0x16,%eax
+  801c77:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801c7e:	a8 01                	test   $0x1,%al
+  801c80:	74 92                	je     801c14 <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  801c82:	89 c8                	mov    %ecx,%eax
+  801c84:	c1 e8 0c             	shr    $0xc,%eax
+  801c87:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  801c8e:	a8 01                	test   $0x1,%al
+  801c90:	74 82                	je     801c14 <devfile_read+0x134>
+  801c92:	a9 02 08 00 00       	test   $0x802,%eax
+  801c97:	0f 84 77 ff ff ff    	je     801c14 <devfile_read+0x134>
+  801c9d:	f6 c4 04             	test   $0x4,%ah
+  801ca0:	0f 85 6e ff ff ff    	jne    801c14 <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  801ca6:	a1 44 67 80 00       	mov    0x806744,%eax
+  801cab:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  801caf:	84 c0                	test   %al,%al
+  801cb1:	75 17                	jne    801cca <devfile_read+0x1ea>
+  801cb3:	83 ec 08             	sub    $0x8,%esp
+  801cb6:	6a 01                	push   $0x1
+  801cb8:	6a 00                	push   $0x0
+  801cba:	e8 1e f1 ff ff       	call   800ddd <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  801cbf:	83 c4 10             	add    $0x10,%esp
+  801cc2:	85 c0                	test   %eax,%eax
+  801cc4:	0f 85 4a ff ff ff    	jne    801c14 <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  801cca:	83 ec 04             	sub    $0x4,%esp
+  801ccd:	68 05 08 00 00       	push   $0x805
+  801cd2:	ff 75 cc             	push   -0x34(%ebp)
+  801cd5:	6a 00                	push   $0x0
+  801cd7:	56                   	push   %esi
+  801cd8:	6a 00                	push   $0x0
+  801cda:	6a 05                	push   $0x5
+  801cdc:	68 40 60 80 00       	push   $0x806040
+  801ce1:	e8 8d f5 ff ff       	call   801273 <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  801ce6:	c1 e8 1f             	shr    $0x1f,%eax
+  801ce9:	08 45 cb             	or     %al,-0x35(%ebp)
+  801cec:	83 c4 20             	add    $0x20,%esp
+  801cef:	e9 33 ff ff ff       	jmp    801c27 <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  801cf4:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  801cf7:	83 ec 0c             	sub    $0xc,%esp
+  801cfa:	68 40 60 80 00       	push   $0x806040
+  801cff:	e8 1f f5 ff ff       	call   801223 <sysbatch_flush>
+  801d04:	83 c4 10             	add    $0x10,%esp
+  801d07:	85 c0                	test   %eax,%eax
+  801d09:	78 06                	js     801d11 <devfile_read+0x231>
+  801d0b:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  801d0f:	74 14                	je     801d25 <devfile_read+0x245>
+    memmove(dst, src, r);
+  801d11:	83 ec 04             	sub    $0x4,%esp
+  801d14:	ff 75 d4             	push   -0x2c(%ebp)
+  801d17:	ff 75 d0             	push   -0x30(%ebp)
+  801d1a:	ff 75 0c             	push   0xc(%ebp)
+  801d1d:	e8 55 ee ff ff       	call   800b77 <memmove>
+  801d22:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  801d25:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d28:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  801d2b:	e9 11 fe ff ff       	jmp    801b41 <devfile_read+0x61>
+  assert(r <= n);
+  801d30:	68 91 35 80 00       	push   $0x803591
+  801d35:	68 98 35 80 00       	push   $0x803598
+  801d3a:	68 1c 01 00 00       	push   $0x11c
+  801d3f:	68 86 35 80 00       	push   $0x803586
+  801d44:	e8 df e5 ff ff       	call   800328 <_panic>
+  assert(r <= PGSIZE);
+  801d49:	68 ad 35 80 00       	push   $0x8035ad
+  801d4e:	68 98 35 80 00       	push   $0x803598
+  801d53:	68 1d 01 00 00       	push   $0x11d
+  801d58:	68 86 35 80 00       	push   $0x803586
+  801d5d:	e8 c6 e5 ff ff       	call   800328 <_panic>
+
+00801d62 <devfile_write>:
+{
+  801d62:	55                   	push   %ebp
+  801d63:	89 e5                	mov    %esp,%ebp
+  801d65:	57                   	push   %edi
+  801d66:	56                   	push   %esi
+  801d67:	53                   	push   %ebx
+  801d68:	83 ec 1c             	sub    $0x1c,%esp
+  801d6b:	8b 75 08             	mov    0x8(%ebp),%esi
+  801d6e:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  801d71:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  801d76:	77 39                	ja     801db1 <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801d78:	8b 56 0c             	mov    0xc(%esi),%edx
+  801d7b:	89 15 00 70 80 00    	mov    %edx,0x807000
+  fsipcbuf.write.req_n = n;
+  801d81:	a3 04 70 80 00       	mov    %eax,0x807004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  801d86:	83 ec 04             	sub    $0x4,%esp
+  801d89:	50                   	push   %eax
+  801d8a:	ff 75 0c             	push   0xc(%ebp)
+  801d8d:	68 08 70 80 00       	push   $0x807008
+  801d92:	e8 e0 ed ff ff       	call   800b77 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801d97:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d9c:	b8 04 00 00 00       	mov    $0x4,%eax
+  801da1:	e8 e7 fb ff ff       	call   80198d <fsipc>
+  801da6:	83 c4 10             	add    $0x10,%esp
+}
+  801da9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801dac:	5b                   	pop    %ebx
+  801dad:	5e                   	pop    %esi
+  801dae:	5f                   	pop    %edi
+  801daf:	5d                   	pop    %ebp
+  801db0:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  801db1:	ba 00 00 10 00       	mov    $0x100000,%edx
+  801db6:	39 d0                	cmp    %edx,%eax
+  801db8:	89 d3                	mov    %edx,%ebx
+  801dba:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  801dbd:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  801dc3:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  801dc6:	83 c7 01             	add    $0x1,%edi
+  801dc9:	89 f8                	mov    %edi,%eax
+  801dcb:	e8 94 fc ff ff       	call   801a64 <fsv_alloc>
+  801dd0:	85 c0                	test   %eax,%eax
+  801dd2:	78 d5                	js     801da9 <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  801dd4:	83 ec 04             	sub    $0x4,%esp
+  801dd7:	53                   	push   %ebx
+  801dd8:	ff 75 0c             	push   0xc(%ebp)
+  801ddb:	68 00 10 c0 9f       	push   $0x9fc01000
+  801de0:	e8 92 ed ff ff       	call   800b77 <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  801de5:	8b 46 0c             	mov    0xc(%esi),%eax
+  801de8:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  801ded:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  801df3:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801dfa:	89 f9                	mov    %edi,%ecx
+  801dfc:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801e01:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801e06:	e8 69 fa ff ff       	call   801874 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801e0b:	6a 00                	push   $0x0
+  801e0d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801e10:	50                   	push   %eax
+  801e11:	6a 00                	push   $0x0
+  801e13:	6a 00                	push   $0x0
+  801e15:	e8 c6 0e 00 00       	call   802ce0 <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  801e1a:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  801e1d:	eb 8a                	jmp    801da9 <devfile_write+0x47>
+
+00801e1f <open>:
+{
+  801e1f:	55                   	push   %ebp
+  801e20:	89 e5                	mov    %esp,%ebp
+  801e22:	56                   	push   %esi
+  801e23:	53                   	push   %ebx
+  801e24:	83 ec 1c             	sub    $0x1c,%esp
+  801e27:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801e2a:	56                   	push   %esi
+  801e2b:	e8 86 eb ff ff       	call   8009b6 <strlen>
+  801e30:	83 c4 10             	add    $0x10,%esp
+  801e33:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801e38:	7f 6c                	jg     801ea6 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  801e3a:	83 ec 0c             	sub    $0xc,%esp
+  801e3d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e40:	50                   	push   %eax
+  801e41:	e8 ad f4 ff ff       	call   8012f3 <fd_alloc>
+  801e46:	89 c3                	mov    %eax,%ebx
+  801e48:	83 c4 10             	add    $0x10,%esp
+  801e4b:	85 c0                	test   %eax,%eax
+  801e4d:	78 3c                	js     801e8b <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801e4f:	83 ec 08             	sub    $0x8,%esp
+  801e52:	56                   	push   %esi
+  801e53:	68 00 70 80 00       	push   $0x807000
+  801e58:	e8 94 eb ff ff       	call   8009f1 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801e5d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e60:	a3 00 74 80 00       	mov    %eax,0x807400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801e65:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801e68:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e6d:	e8 1b fb ff ff       	call   80198d <fsipc>
+  801e72:	89 c3                	mov    %eax,%ebx
+  801e74:	83 c4 10             	add    $0x10,%esp
+  801e77:	85 c0                	test   %eax,%eax
+  801e79:	78 19                	js     801e94 <open+0x75>
+  return fd2num(fd);
+  801e7b:	83 ec 0c             	sub    $0xc,%esp
+  801e7e:	ff 75 f4             	push   -0xc(%ebp)
+  801e81:	e8 49 f4 ff ff       	call   8012cf <fd2num>
+  801e86:	89 c3                	mov    %eax,%ebx
+  801e88:	83 c4 10             	add    $0x10,%esp
+}
+  801e8b:	89 d8                	mov    %ebx,%eax
+  801e8d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e90:	5b                   	pop    %ebx
+  801e91:	5e                   	pop    %esi
+  801e92:	5d                   	pop    %ebp
+  801e93:	c3                   	ret
+    fd_close(fd, 0);
+  801e94:	83 ec 08             	sub    $0x8,%esp
+  801e97:	6a 00                	push   $0x0
+  801e99:	ff 75 f4             	push   -0xc(%ebp)
+  801e9c:	e8 44 f5 ff ff       	call   8013e5 <fd_close>
+    return r;
+  801ea1:	83 c4 10             	add    $0x10,%esp
+  801ea4:	eb e5                	jmp    801e8b <open+0x6c>
+    return -E_BAD_PATH;
+  801ea6:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801eab:	eb de                	jmp    801e8b <open+0x6c>
+
+00801ead <open_read>:
+{
+  801ead:	55                   	push   %ebp
+  801eae:	89 e5                	mov    %esp,%ebp
+  801eb0:	57                   	push   %edi
+  801eb1:	56                   	push   %esi
+  801eb2:	53                   	push   %ebx
+  801eb3:	83 ec 28             	sub    $0x28,%esp
+  801eb6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  801eb9:	57                   	push   %edi
+  801eba:	e8 f7 ea ff ff       	call   8009b6 <strlen>
+  801ebf:	83 c4 10             	add    $0x10,%esp
+  801ec2:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801ec7:	0f 87 f6 00 00 00    	ja     801fc3 <open_read+0x116>
+  801ecd:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  801ecf:	83 ec 0c             	sub    $0xc,%esp
+  801ed2:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801ed5:	50                   	push   %eax
+  801ed6:	e8 18 f4 ff ff       	call   8012f3 <fd_alloc>
+  801edb:	89 c3                	mov    %eax,%ebx
+  801edd:	83 c4 10             	add    $0x10,%esp
+  801ee0:	85 c0                	test   %eax,%eax
+  801ee2:	0f 88 b2 00 00 00    	js     801f9a <open_read+0xed>
+  strcpy(req->req_buf, path);
+  801ee8:	83 ec 08             	sub    $0x8,%esp
+  801eeb:	57                   	push   %edi
+  801eec:	68 e4 70 80 00       	push   $0x8070e4
+  801ef1:	e8 fb ea ff ff       	call   8009f1 <strcpy>
+  req->req_nops = 2;
+  801ef6:	c7 05 00 70 80 00 02 	movl   $0x2,0x807000
+  801efd:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  801f00:	c7 05 04 70 80 00 01 	movl   $0x1,0x807004
+  801f07:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  801f0a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f0d:	a3 10 70 80 00       	mov    %eax,0x807010
+  req->req_ops[0].op_buf = 0;
+  801f12:	c7 05 18 70 80 00 00 	movl   $0x0,0x807018
+  801f19:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  801f1c:	c7 05 20 70 80 00 04 	movl   $0x4,0x807020
+  801f23:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  801f26:	c7 05 24 70 80 00 01 	movl   $0x1,0x807024
+  801f2d:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  801f30:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  801f35:	29 f0                	sub    %esi,%eax
+  801f37:	3b 45 14             	cmp    0x14(%ebp),%eax
+  801f3a:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  801f3e:	a3 2c 70 80 00       	mov    %eax,0x80702c
+  req->req_ops[1].op_offset = 0;
+  801f43:	c7 05 30 70 80 00 00 	movl   $0x0,0x807030
+  801f4a:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  801f4d:	83 c6 01             	add    $0x1,%esi
+  801f50:	89 35 34 70 80 00    	mov    %esi,0x807034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  801f56:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801f59:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801f5e:	e8 2a fa ff ff       	call   80198d <fsipc>
+  801f63:	89 c3                	mov    %eax,%ebx
+  801f65:	83 c4 10             	add    $0x10,%esp
+  801f68:	83 f8 01             	cmp    $0x1,%eax
+  801f6b:	7e 37                	jle    801fa4 <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  801f6d:	a1 38 70 80 00       	mov    0x807038,%eax
+  801f72:	8b 55 18             	mov    0x18(%ebp),%edx
+  801f75:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  801f77:	83 ec 04             	sub    $0x4,%esp
+  801f7a:	50                   	push   %eax
+  801f7b:	81 c6 e4 70 80 00    	add    $0x8070e4,%esi
+  801f81:	56                   	push   %esi
+  801f82:	ff 75 10             	push   0x10(%ebp)
+  801f85:	e8 ed eb ff ff       	call   800b77 <memmove>
+  return fd2num(fd);
+  801f8a:	83 c4 04             	add    $0x4,%esp
+  801f8d:	ff 75 e4             	push   -0x1c(%ebp)
+  801f90:	e8 3a f3 ff ff       	call   8012cf <fd2num>
+  801f95:	89 c3                	mov    %eax,%ebx
+  801f97:	83 c4 10             	add    $0x10,%esp
+}
+  801f9a:	89 d8                	mov    %ebx,%eax
+  801f9c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f9f:	5b                   	pop    %ebx
+  801fa0:	5e                   	pop    %esi
+  801fa1:	5f                   	pop    %edi
+  801fa2:	5d                   	pop    %ebp
+  801fa3:	c3                   	ret
+    fd_close(fd, 0);
+  801fa4:	83 ec 08             	sub    $0x8,%esp
+  801fa7:	6a 00                	push   $0x0
+  801fa9:	ff 75 e4             	push   -0x1c(%ebp)
+  801fac:	e8 34 f4 ff ff       	call   8013e5 <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  801fb1:	83 c4 10             	add    $0x10,%esp
+  801fb4:	85 db                	test   %ebx,%ebx
+  801fb6:	78 e2                	js     801f9a <open_read+0xed>
+  801fb8:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  801fbb:	8b 9b 1c 70 80 00    	mov    0x80701c(%ebx),%ebx
+  801fc1:	eb d7                	jmp    801f9a <open_read+0xed>
+    return -E_BAD_PATH;
+  801fc3:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801fc8:	eb d0                	jmp    801f9a <open_read+0xed>
+
+00801fca <file_stat>:
+{
+  801fca:	55                   	push   %ebp
+  801fcb:	89 e5                	mov    %esp,%ebp
+  801fcd:	57                   	push   %edi
+  801fce:	56                   	push   %esi
+  801fcf:	53                   	push   %ebx
+  801fd0:	83 ec 18             	sub    $0x18,%esp
+  801fd3:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801fd6:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801fd9:	57                   	push   %edi
+  801fda:	e8 d7 e9 ff ff       	call   8009b6 <strlen>
+  801fdf:	83 c4 10             	add    $0x10,%esp
+  801fe2:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801fe7:	0f 8f c7 00 00 00    	jg     8020b4 <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  801fed:	83 ec 0c             	sub    $0xc,%esp
+  801ff0:	57                   	push   %edi
+  801ff1:	e8 c0 e9 ff ff       	call   8009b6 <strlen>
+  801ff6:	8d 58 04             	lea    0x4(%eax),%ebx
+  801ff9:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  801ffc:	83 c4 08             	add    $0x8,%esp
+  801fff:	57                   	push   %edi
+  802000:	68 e4 70 80 00       	push   $0x8070e4
+  802005:	e8 e7 e9 ff ff       	call   8009f1 <strcpy>
+  req->req_nops = 2;
+  80200a:	c7 05 00 70 80 00 02 	movl   $0x2,0x807000
+  802011:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  802014:	c7 05 04 70 80 00 02 	movl   $0x2,0x807004
+  80201b:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  80201e:	c7 05 10 70 80 00 00 	movl   $0x0,0x807010
+  802025:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  802028:	c7 05 18 70 80 00 00 	movl   $0x0,0x807018
+  80202f:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  802032:	c7 05 20 70 80 00 03 	movl   $0x3,0x807020
+  802039:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  80203c:	c7 05 24 70 80 00 01 	movl   $0x1,0x807024
+  802043:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  802046:	89 1d 34 70 80 00    	mov    %ebx,0x807034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  80204c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802051:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802056:	e8 32 f9 ff ff       	call   80198d <fsipc>
+  80205b:	83 c4 10             	add    $0x10,%esp
+  80205e:	83 f8 01             	cmp    $0x1,%eax
+  802061:	7e 42                	jle    8020a5 <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  802063:	81 c3 e4 70 80 00    	add    $0x8070e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  802069:	83 ec 08             	sub    $0x8,%esp
+  80206c:	53                   	push   %ebx
+  80206d:	56                   	push   %esi
+  80206e:	e8 7e e9 ff ff       	call   8009f1 <strcpy>
+  st->st_size = ret->ret_size;
+  802073:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  802079:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  80207f:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  802085:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  80208b:	c7 86 88 00 00 00 04 	movl   $0x804004,0x88(%esi)
+  802092:	40 80 00 
+  return 0;
+  802095:	83 c4 10             	add    $0x10,%esp
+  802098:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80209d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020a0:	5b                   	pop    %ebx
+  8020a1:	5e                   	pop    %esi
+  8020a2:	5f                   	pop    %edi
+  8020a3:	5d                   	pop    %ebp
+  8020a4:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  8020a5:	85 c0                	test   %eax,%eax
+  8020a7:	78 f4                	js     80209d <file_stat+0xd3>
+  8020a9:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8020ac:	8b 80 1c 70 80 00    	mov    0x80701c(%eax),%eax
+  8020b2:	eb e9                	jmp    80209d <file_stat+0xd3>
+    return -E_BAD_PATH;
+  8020b4:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8020b9:	eb e2                	jmp    80209d <file_stat+0xd3>
+
+008020bb <read_map>:
+{
+  8020bb:	55                   	push   %ebp
+  8020bc:	89 e5                	mov    %esp,%ebp
+  8020be:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8020c1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020c4:	50                   	push   %eax
+  8020c5:	ff 75 08             	push   0x8(%ebp)
+  8020c8:	e8 7c f2 ff ff       	call   801349 <fd_lookup>
+  8020cd:	83 c4 10             	add    $0x10,%esp
+  8020d0:	85 c0                	test   %eax,%eax
+  8020d2:	78 2a                	js     8020fe <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  8020d4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020d7:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  8020dd:	39 08                	cmp    %ecx,(%eax)
+  8020df:	75 1f                	jne    802100 <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  8020e1:	8b 40 0c             	mov    0xc(%eax),%eax
+  8020e4:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.read_map.req_offset = offset;
+  8020e9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020ec:	a3 04 70 80 00       	mov    %eax,0x807004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  8020f1:	8b 55 10             	mov    0x10(%ebp),%edx
+  8020f4:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8020f9:	e8 8f f8 ff ff       	call   80198d <fsipc>
+}
+  8020fe:	c9                   	leave
+  8020ff:	c3                   	ret
+    return -E_INVAL;
+  802100:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802105:	eb f7                	jmp    8020fe <read_map+0x43>
+
+00802107 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802107:	55                   	push   %ebp
+  802108:	89 e5                	mov    %esp,%ebp
+  80210a:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  80210d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802112:	b8 08 00 00 00       	mov    $0x8,%eax
+  802117:	e8 71 f8 ff ff       	call   80198d <fsipc>
+}
+  80211c:	c9                   	leave
+  80211d:	c3                   	ret
+
+0080211e <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  80211e:	55                   	push   %ebp
+  80211f:	89 e5                	mov    %esp,%ebp
+  802121:	57                   	push   %edi
+  802122:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  802123:	8b 45 08             	mov    0x8(%ebp),%eax
+  802126:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.stats.req_bio_sched = 0;
+  80212b:	c7 05 04 70 80 00 00 	movl   $0x0,0x807004
+  802132:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  802135:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  80213c:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  80213f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802144:	b8 09 00 00 00       	mov    $0x9,%eax
+  802149:	e8 3f f8 ff ff       	call   80198d <fsipc>
+  80214e:	85 c0                	test   %eax,%eax
+  802150:	78 14                	js     802166 <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  802152:	be 00 70 80 00       	mov    $0x807000,%esi
+  802157:	b9 16 00 00 00       	mov    $0x16,%ecx
+  80215c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80215f:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  802161:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802166:	5e                   	pop    %esi
+  802167:	5f                   	pop    %edi
+  802168:	5d                   	pop    %ebp
+  802169:	c3                   	ret
+
+0080216a <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  80216a:	55                   	push   %ebp
+  80216b:	89 e5                	mov    %esp,%ebp
+  80216d:	53                   	push   %ebx
+  80216e:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  802171:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802174:	50                   	push   %eax
+  802175:	6a 00                	push   $0x0
+  802177:	e8 a2 ff ff ff       	call   80211e <fs_stats>
+  80217c:	83 c4 10             	add    $0x10,%esp
+  80217f:	85 c0                	test   %eax,%eax
+  802181:	78 28                	js     8021ab <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  802183:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  802186:	83 ec 08             	sub    $0x8,%esp
+  802189:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  80218c:	50                   	push   %eax
+  80218d:	6a 20                	push   $0x20
+  80218f:	e8 8a ff ff ff       	call   80211e <fs_stats>
+  802194:	83 c4 10             	add    $0x10,%esp
+  802197:	85 c0                	test   %eax,%eax
+  802199:	78 10                	js     8021ab <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  80219b:	83 ec 08             	sub    $0x8,%esp
+  80219e:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8021a1:	50                   	push   %eax
+  8021a2:	53                   	push   %ebx
+  8021a3:	e8 76 ff ff ff       	call   80211e <fs_stats>
+  8021a8:	83 c4 10             	add    $0x10,%esp
+}
+  8021ab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021ae:	c9                   	leave
+  8021af:	c3                   	ret
+
+008021b0 <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  8021b0:	55                   	push   %ebp
+  8021b1:	89 e5                	mov    %esp,%ebp
+  8021b3:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  8021b6:	c7 05 00 70 80 00 00 	movl   $0x0,0x807000
+  8021bd:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  8021c0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021c3:	a3 04 70 80 00       	mov    %eax,0x807004
+  fsipcbuf.stats.req_dcache = 0;
+  8021c8:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  8021cf:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  8021d2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021d7:	b8 09 00 00 00       	mov    $0x9,%eax
+  8021dc:	e8 ac f7 ff ff       	call   80198d <fsipc>
+}
+  8021e1:	c9                   	leave
+  8021e2:	c3                   	ret
+
+008021e3 <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  8021e3:	55                   	push   %ebp
+  8021e4:	89 e5                	mov    %esp,%ebp
+  8021e6:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  8021e9:	c7 05 00 70 80 00 00 	movl   $0x0,0x807000
+  8021f0:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  8021f3:	c7 05 04 70 80 00 00 	movl   $0x0,0x807004
+  8021fa:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  8021fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  802200:	a3 08 70 80 00       	mov    %eax,0x807008
+  return fsipc(FSREQ_STATS, NULL);
+  802205:	ba 00 00 00 00       	mov    $0x0,%edx
+  80220a:	b8 09 00 00 00       	mov    $0x9,%eax
+  80220f:	e8 79 f7 ff ff       	call   80198d <fsipc>
+}
+  802214:	c9                   	leave
+  802215:	c3                   	ret
+
+00802216 <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  802216:	55                   	push   %ebp
+  802217:	89 e5                	mov    %esp,%ebp
+  802219:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80221c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80221f:	50                   	push   %eax
+  802220:	ff 75 08             	push   0x8(%ebp)
+  802223:	e8 21 f1 ff ff       	call   801349 <fd_lookup>
+  802228:	83 c4 10             	add    $0x10,%esp
+  80222b:	85 c0                	test   %eax,%eax
+  80222d:	78 34                	js     802263 <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  80222f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802232:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  802238:	39 08                	cmp    %ecx,(%eax)
+  80223a:	75 29                	jne    802265 <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  80223c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80223f:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.fallocate.req_offset = offset;
+  802244:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802247:	a3 04 70 80 00       	mov    %eax,0x807004
+  fsipcbuf.fallocate.req_len = len;
+  80224c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80224f:	a3 08 70 80 00       	mov    %eax,0x807008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  802254:	ba 00 00 00 00       	mov    $0x0,%edx
+  802259:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80225e:	e8 2a f7 ff ff       	call   80198d <fsipc>
+}
+  802263:	c9                   	leave
+  802264:	c3                   	ret
+    return -E_INVAL;
+  802265:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80226a:	eb f7                	jmp    802263 <fallocate+0x4d>
+
+0080226c <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  80226c:	55                   	push   %ebp
+  80226d:	89 e5                	mov    %esp,%ebp
+  80226f:	57                   	push   %edi
+  802270:	56                   	push   %esi
+  802271:	53                   	push   %ebx
+  802272:	83 ec 24             	sub    $0x24,%esp
+  802275:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802278:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80227b:	50                   	push   %eax
+  80227c:	ff 75 08             	push   0x8(%ebp)
+  80227f:	e8 c5 f0 ff ff       	call   801349 <fd_lookup>
+  802284:	83 c4 10             	add    $0x10,%esp
+  802287:	85 c0                	test   %eax,%eax
+  802289:	78 66                	js     8022f1 <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  80228b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80228e:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  802294:	39 08                	cmp    %ecx,(%eax)
+  802296:	75 61                	jne    8022f9 <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  802298:	85 f6                	test   %esi,%esi
+  80229a:	7e 50                	jle    8022ec <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  80229c:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  8022a1:	39 de                	cmp    %ebx,%esi
+  8022a3:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  8022a6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8022a9:	8b 40 0c             	mov    0xc(%eax),%eax
+  8022ac:	a3 00 70 80 00       	mov    %eax,0x807000
+    fsipcbuf.prefetch.req_n = m;
+  8022b1:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  8022b7:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  8022be:	83 ec 04             	sub    $0x4,%esp
+  8022c1:	57                   	push   %edi
+  8022c2:	ff 75 0c             	push   0xc(%ebp)
+  8022c5:	68 08 70 80 00       	push   $0x807008
+  8022ca:	e8 a8 e8 ff ff       	call   800b77 <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  8022cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022d4:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8022d9:	e8 af f6 ff ff       	call   80198d <fsipc>
+  8022de:	83 c4 10             	add    $0x10,%esp
+  8022e1:	85 c0                	test   %eax,%eax
+  8022e3:	78 0c                	js     8022f1 <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  8022e5:	01 7d 0c             	add    %edi,0xc(%ebp)
+  8022e8:	29 de                	sub    %ebx,%esi
+  8022ea:	eb ac                	jmp    802298 <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  8022ec:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022f1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022f4:	5b                   	pop    %ebx
+  8022f5:	5e                   	pop    %esi
+  8022f6:	5f                   	pop    %edi
+  8022f7:	5d                   	pop    %ebp
+  8022f8:	c3                   	ret
+    return -E_INVAL;
+  8022f9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8022fe:	eb f1                	jmp    8022f1 <prefetch+0x85>
+
+00802300 <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  802300:	55                   	push   %ebp
+  802301:	89 e5                	mov    %esp,%ebp
+  802303:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  802306:	50                   	push   %eax
+  802307:	e8 d3 ef ff ff       	call   8012df <fd2data>
+  80230c:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  802311:	c9                   	leave
+  802312:	c3                   	ret
+
+00802313 <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802313:	55                   	push   %ebp
+  802314:	89 e5                	mov    %esp,%ebp
+  802316:	56                   	push   %esi
+  802317:	53                   	push   %ebx
+  802318:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  80231b:	83 ec 0c             	sub    $0xc,%esp
+  80231e:	ff 75 08             	push   0x8(%ebp)
+  802321:	e8 b9 ef ff ff       	call   8012df <fd2data>
+  802326:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  802328:	83 c4 08             	add    $0x8,%esp
+  80232b:	68 e8 35 80 00       	push   $0x8035e8
+  802330:	53                   	push   %ebx
+  802331:	e8 bb e6 ff ff       	call   8009f1 <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  802336:	8b 46 04             	mov    0x4(%esi),%eax
+  802339:	2b 06                	sub    (%esi),%eax
+  80233b:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  802341:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802348:	00 00 00 
+  stat->st_dev = &devpipe;
+  80234b:	c7 83 88 00 00 00 20 	movl   $0x804020,0x88(%ebx)
+  802352:	40 80 00 
+  return 0;
+}
+  802355:	b8 00 00 00 00       	mov    $0x0,%eax
+  80235a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80235d:	5b                   	pop    %ebx
+  80235e:	5e                   	pop    %esi
+  80235f:	5d                   	pop    %ebp
+  802360:	c3                   	ret
+
+00802361 <pipe_wakeup>:
+{
+  802361:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  802363:	b8 00 00 00 00       	mov    $0x0,%eax
+  802368:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  80236b:	85 c0                	test   %eax,%eax
+  80236d:	75 01                	jne    802370 <pipe_wakeup+0xf>
+  80236f:	c3                   	ret
+{
+  802370:	55                   	push   %ebp
+  802371:	89 e5                	mov    %esp,%ebp
+  802373:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  802376:	6a 00                	push   $0x0
+  802378:	68 00 00 c0 ee       	push   $0xeec00000
+  80237d:	52                   	push   %edx
+  80237e:	e8 f9 ed ff ff       	call   80117c <sys_chan_wakeup>
+  802383:	83 c4 10             	add    $0x10,%esp
+}
+  802386:	c9                   	leave
+  802387:	c3                   	ret
+
+00802388 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802388:	55                   	push   %ebp
+  802389:	89 e5                	mov    %esp,%ebp
+  80238b:	57                   	push   %edi
+  80238c:	56                   	push   %esi
+  80238d:	53                   	push   %ebx
+  80238e:	83 ec 18             	sub    $0x18,%esp
+  802391:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  802394:	57                   	push   %edi
+  802395:	e8 45 ef ff ff       	call   8012df <fd2data>
+  80239a:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  80239c:	83 c4 10             	add    $0x10,%esp
+  80239f:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  8023a3:	74 2a                	je     8023cf <devpipe_close+0x47>
+  8023a5:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  8023aa:	89 f8                	mov    %edi,%eax
+  8023ac:	e8 4f ff ff ff       	call   802300 <pipe_ring>
+  8023b1:	83 ec 08             	sub    $0x8,%esp
+  8023b4:	01 d8                	add    %ebx,%eax
+  8023b6:	50                   	push   %eax
+  8023b7:	6a 00                	push   $0x0
+  8023b9:	e8 e7 ea ff ff       	call   800ea5 <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  8023be:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8023c4:	83 c4 10             	add    $0x10,%esp
+  8023c7:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  8023cd:	75 db                	jne    8023aa <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  8023cf:	83 ec 08             	sub    $0x8,%esp
+  8023d2:	57                   	push   %edi
+  8023d3:	6a 00                	push   $0x0
+  8023d5:	e8 cb ea ff ff       	call   800ea5 <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  8023da:	83 c4 10             	add    $0x10,%esp
+  8023dd:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  8023e1:	75 13                	jne    8023f6 <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  8023e3:	83 ec 08             	sub    $0x8,%esp
+  8023e6:	56                   	push   %esi
+  8023e7:	6a 00                	push   $0x0
+  8023e9:	e8 b7 ea ff ff       	call   800ea5 <sys_page_unmap>
+}
+  8023ee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023f1:	5b                   	pop    %ebx
+  8023f2:	5e                   	pop    %esi
+  8023f3:	5f                   	pop    %edi
+  8023f4:	5d                   	pop    %ebp
+  8023f5:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  8023f6:	8d 56 04             	lea    0x4(%esi),%edx
+  8023f9:	8d 46 2c             	lea    0x2c(%esi),%eax
+  8023fc:	e8 60 ff ff ff       	call   802361 <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802401:	8d 46 30             	lea    0x30(%esi),%eax
+  802404:	89 f2                	mov    %esi,%edx
+  802406:	e8 56 ff ff ff       	call   802361 <pipe_wakeup>
+  80240b:	eb d6                	jmp    8023e3 <devpipe_close+0x5b>
+
+0080240d <_pipeisclosed>:
+{
+  80240d:	55                   	push   %ebp
+  80240e:	89 e5                	mov    %esp,%ebp
+  802410:	57                   	push   %edi
+  802411:	56                   	push   %esi
+  802412:	53                   	push   %ebx
+  802413:	83 ec 1c             	sub    $0x1c,%esp
+  802416:	89 c7                	mov    %eax,%edi
+  802418:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  80241a:	a1 44 67 80 00       	mov    0x806744,%eax
+  80241f:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  802422:	83 ec 0c             	sub    $0xc,%esp
+  802425:	57                   	push   %edi
+  802426:	e8 18 0a 00 00       	call   802e43 <pageref>
+  80242b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80242e:	89 34 24             	mov    %esi,(%esp)
+  802431:	e8 0d 0a 00 00       	call   802e43 <pageref>
+    nn = thisenv->env_runs;
+  802436:	8b 15 44 67 80 00    	mov    0x806744,%edx
+  80243c:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  80243f:	83 c4 10             	add    $0x10,%esp
+  802442:	39 cb                	cmp    %ecx,%ebx
+  802444:	74 1b                	je     802461 <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  802446:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802449:	75 cf                	jne    80241a <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80244b:	8b 42 58             	mov    0x58(%edx),%eax
+  80244e:	6a 01                	push   $0x1
+  802450:	50                   	push   %eax
+  802451:	53                   	push   %ebx
+  802452:	68 ef 35 80 00       	push   $0x8035ef
+  802457:	e8 a7 df ff ff       	call   800403 <cprintf>
+  80245c:	83 c4 10             	add    $0x10,%esp
+  80245f:	eb b9                	jmp    80241a <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  802461:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802464:	0f 94 c0             	sete   %al
+  802467:	0f b6 c0             	movzbl %al,%eax
+}
+  80246a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80246d:	5b                   	pop    %ebx
+  80246e:	5e                   	pop    %esi
+  80246f:	5f                   	pop    %edi
+  802470:	5d                   	pop    %ebp
+  802471:	c3                   	ret
+
+00802472 <devpipe_write_bulk>:
+{
+  802472:	55                   	push   %ebp
+  802473:	89 e5                	mov    %esp,%ebp
+  802475:	57                   	push   %edi
+  802476:	56                   	push   %esi
+  802477:	53                   	push   %ebx
+  802478:	83 ec 1c             	sub    $0x1c,%esp
+  80247b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80247e:	89 d6                	mov    %edx,%esi
+  802480:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  802483:	e8 78 fe ff ff       	call   802300 <pipe_ring>
+  802488:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  80248b:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802490:	8d 46 04             	lea    0x4(%esi),%eax
+  802493:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  802496:	eb 75                	jmp    80250d <devpipe_write_bulk+0x9b>
+  802498:	b8 01 00 00 00       	mov    $0x1,%eax
+  80249d:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  8024a1:	6a 64                	push   $0x64
+  8024a3:	68 00 00 c0 ee       	push   $0xeec00000
+  8024a8:	53                   	push   %ebx
+  8024a9:	56                   	push   %esi
+  8024aa:	e8 aa ec ff ff       	call   801159 <sys_chan_sleep>
+      continue;
+  8024af:	83 c4 10             	add    $0x10,%esp
+  8024b2:	eb 59                	jmp    80250d <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  8024b4:	89 d1                	mov    %edx,%ecx
+  8024b6:	c1 f9 1f             	sar    $0x1f,%ecx
+  8024b9:	c1 e9 11             	shr    $0x11,%ecx
+  8024bc:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  8024bf:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8024c4:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  8024c6:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  8024cc:	29 d3                	sub    %edx,%ebx
+  8024ce:	ba 00 80 00 00       	mov    $0x8000,%edx
+  8024d3:	29 c2                	sub    %eax,%edx
+  8024d5:	39 d3                	cmp    %edx,%ebx
+  8024d7:	0f 47 da             	cmova  %edx,%ebx
+  8024da:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024dd:	29 fa                	sub    %edi,%edx
+  8024df:	39 d3                	cmp    %edx,%ebx
+  8024e1:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  8024e4:	83 ec 04             	sub    $0x4,%esp
+  8024e7:	53                   	push   %ebx
+  8024e8:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8024eb:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  8024ee:	52                   	push   %edx
+  8024ef:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8024f2:	01 c8                	add    %ecx,%eax
+  8024f4:	50                   	push   %eax
+  8024f5:	e8 df e6 ff ff       	call   800bd9 <memcpy>
+    i += m;
+  8024fa:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  8024fc:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  8024ff:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802502:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802505:	e8 57 fe ff ff       	call   802361 <pipe_wakeup>
+  80250a:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  80250d:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802510:	73 2b                	jae    80253d <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  802512:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  802514:	8b 56 04             	mov    0x4(%esi),%edx
+  802517:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  80251d:	39 d0                	cmp    %edx,%eax
+  80251f:	7d 93                	jge    8024b4 <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  802521:	89 f2                	mov    %esi,%edx
+  802523:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802526:	e8 e2 fe ff ff       	call   80240d <_pipeisclosed>
+  80252b:	85 c0                	test   %eax,%eax
+  80252d:	0f 84 65 ff ff ff    	je     802498 <devpipe_write_bulk+0x26>
+        return i;
+  802533:	89 f8                	mov    %edi,%eax
+}
+  802535:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802538:	5b                   	pop    %ebx
+  802539:	5e                   	pop    %esi
+  80253a:	5f                   	pop    %edi
+  80253b:	5d                   	pop    %ebp
+  80253c:	c3                   	ret
+  return i;
+  80253d:	89 f8                	mov    %edi,%eax
+  80253f:	eb f4                	jmp    802535 <devpipe_write_bulk+0xc3>
+
+00802541 <devpipe_write>:
+{
+  802541:	55                   	push   %ebp
+  802542:	89 e5                	mov    %esp,%ebp
+  802544:	57                   	push   %edi
+  802545:	56                   	push   %esi
+  802546:	53                   	push   %ebx
+  802547:	83 ec 28             	sub    $0x28,%esp
+  80254a:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  80254d:	56                   	push   %esi
+  80254e:	e8 8c ed ff ff       	call   8012df <fd2data>
+  802553:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  802555:	8b 78 28             	mov    0x28(%eax),%edi
+  802558:	83 c4 10             	add    $0x10,%esp
+  80255b:	85 ff                	test   %edi,%edi
+  80255d:	75 25                	jne    802584 <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  80255f:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802562:	74 66                	je     8025ca <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802564:	8b 43 04             	mov    0x4(%ebx),%eax
+  802567:	8b 0b                	mov    (%ebx),%ecx
+  802569:	8d 51 20             	lea    0x20(%ecx),%edx
+  80256c:	39 d0                	cmp    %edx,%eax
+  80256e:	72 2b                	jb     80259b <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  802570:	89 da                	mov    %ebx,%edx
+  802572:	89 f0                	mov    %esi,%eax
+  802574:	e8 94 fe ff ff       	call   80240d <_pipeisclosed>
+  802579:	85 c0                	test   %eax,%eax
+  80257b:	75 51                	jne    8025ce <devpipe_write+0x8d>
+      sys_yield();
+  80257d:	e8 3c e8 ff ff       	call   800dbe <sys_yield>
+  802582:	eb e0                	jmp    802564 <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  802584:	83 ec 0c             	sub    $0xc,%esp
+  802587:	ff 75 10             	push   0x10(%ebp)
+  80258a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80258d:	89 c2                	mov    %eax,%edx
+  80258f:	89 f0                	mov    %esi,%eax
+  802591:	e8 dc fe ff ff       	call   802472 <devpipe_write_bulk>
+  802596:	83 c4 10             	add    $0x10,%esp
+  802599:	eb 38                	jmp    8025d3 <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80259b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80259e:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8025a2:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8025a5:	89 c2                	mov    %eax,%edx
+  8025a7:	c1 fa 1f             	sar    $0x1f,%edx
+  8025aa:	89 d1                	mov    %edx,%ecx
+  8025ac:	c1 e9 1b             	shr    $0x1b,%ecx
+  8025af:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8025b2:	83 e2 1f             	and    $0x1f,%edx
+  8025b5:	29 ca                	sub    %ecx,%edx
+  8025b7:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8025bb:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  8025bf:	83 c0 01             	add    $0x1,%eax
+  8025c2:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  8025c5:	83 c7 01             	add    $0x1,%edi
+  8025c8:	eb 95                	jmp    80255f <devpipe_write+0x1e>
+  return i;
+  8025ca:	89 f8                	mov    %edi,%eax
+  8025cc:	eb 05                	jmp    8025d3 <devpipe_write+0x92>
+        return 0;
+  8025ce:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025d6:	5b                   	pop    %ebx
+  8025d7:	5e                   	pop    %esi
+  8025d8:	5f                   	pop    %edi
+  8025d9:	5d                   	pop    %ebp
+  8025da:	c3                   	ret
+
+008025db <devpipe_read_bulk>:
+{
+  8025db:	55                   	push   %ebp
+  8025dc:	89 e5                	mov    %esp,%ebp
+  8025de:	57                   	push   %edi
+  8025df:	56                   	push   %esi
+  8025e0:	53                   	push   %ebx
+  8025e1:	83 ec 2c             	sub    $0x2c,%esp
+  8025e4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8025e7:	89 d6                	mov    %edx,%esi
+  8025e9:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8025ec:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  8025ef:	e8 0c fd ff ff       	call   802300 <pipe_ring>
+  8025f4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  8025f7:	85 db                	test   %ebx,%ebx
+  8025f9:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8025fe:	0f 45 c3             	cmovne %ebx,%eax
+  802601:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802604:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802609:	8d 46 30             	lea    0x30(%esi),%eax
+  80260c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  80260f:	eb 50                	jmp    802661 <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  802611:	89 d1                	mov    %edx,%ecx
+  802613:	c1 f9 1f             	sar    $0x1f,%ecx
+  802616:	c1 e9 11             	shr    $0x11,%ecx
+  802619:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  80261c:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802621:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  802623:	29 d3                	sub    %edx,%ebx
+  802625:	ba 00 80 00 00       	mov    $0x8000,%edx
+  80262a:	29 c2                	sub    %eax,%edx
+  80262c:	39 d3                	cmp    %edx,%ebx
+  80262e:	0f 47 da             	cmova  %edx,%ebx
+  802631:	8b 55 08             	mov    0x8(%ebp),%edx
+  802634:	29 fa                	sub    %edi,%edx
+  802636:	39 d3                	cmp    %edx,%ebx
+  802638:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  80263b:	83 ec 04             	sub    $0x4,%esp
+  80263e:	53                   	push   %ebx
+  80263f:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802642:	01 c8                	add    %ecx,%eax
+  802644:	50                   	push   %eax
+  802645:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802648:	01 f8                	add    %edi,%eax
+  80264a:	50                   	push   %eax
+  80264b:	e8 89 e5 ff ff       	call   800bd9 <memcpy>
+    i += m;
+  802650:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  802652:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802654:	89 f2                	mov    %esi,%edx
+  802656:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802659:	e8 03 fd ff ff       	call   802361 <pipe_wakeup>
+  80265e:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802661:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802664:	73 51                	jae    8026b7 <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  802666:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  802669:	8b 16                	mov    (%esi),%edx
+  80266b:	39 da                	cmp    %ebx,%edx
+  80266d:	75 a2                	jne    802611 <devpipe_read_bulk+0x36>
+      if (i > 0)
+  80266f:	85 ff                	test   %edi,%edi
+  802671:	75 44                	jne    8026b7 <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  802673:	89 f2                	mov    %esi,%edx
+  802675:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802678:	e8 90 fd ff ff       	call   80240d <_pipeisclosed>
+  80267d:	85 c0                	test   %eax,%eax
+  80267f:	75 3a                	jne    8026bb <devpipe_read_bulk+0xe0>
+  802681:	b8 01 00 00 00       	mov    $0x1,%eax
+  802686:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  80268a:	6a 64                	push   $0x64
+  80268c:	ff 75 d4             	push   -0x2c(%ebp)
+  80268f:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  802690:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802693:	50                   	push   %eax
+  802694:	e8 c0 ea ff ff       	call   801159 <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  802699:	85 c0                	test   %eax,%eax
+  80269b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026a0:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  8026a3:	83 c4 10             	add    $0x10,%esp
+  8026a6:	a8 01                	test   $0x1,%al
+  8026a8:	74 b7                	je     802661 <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  8026aa:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  8026af:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026b2:	5b                   	pop    %ebx
+  8026b3:	5e                   	pop    %esi
+  8026b4:	5f                   	pop    %edi
+  8026b5:	5d                   	pop    %ebp
+  8026b6:	c3                   	ret
+  return i;
+  8026b7:	89 f8                	mov    %edi,%eax
+  8026b9:	eb f4                	jmp    8026af <devpipe_read_bulk+0xd4>
+        return 0;
+  8026bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026c0:	eb ed                	jmp    8026af <devpipe_read_bulk+0xd4>
+
+008026c2 <devpipe_read>:
+{
+  8026c2:	55                   	push   %ebp
+  8026c3:	89 e5                	mov    %esp,%ebp
+  8026c5:	57                   	push   %edi
+  8026c6:	56                   	push   %esi
+  8026c7:	53                   	push   %ebx
+  8026c8:	83 ec 18             	sub    $0x18,%esp
+  8026cb:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  8026ce:	57                   	push   %edi
+  8026cf:	e8 0b ec ff ff       	call   8012df <fd2data>
+  8026d4:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  8026d6:	8b 70 28             	mov    0x28(%eax),%esi
+  8026d9:	83 c4 10             	add    $0x10,%esp
+  8026dc:	85 f6                	test   %esi,%esi
+  8026de:	75 24                	jne    802704 <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  8026e0:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8026e3:	74 60                	je     802745 <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  8026e5:	8b 03                	mov    (%ebx),%eax
+  8026e7:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8026ea:	75 3b                	jne    802727 <devpipe_read+0x65>
+      if (i > 0)
+  8026ec:	85 f6                	test   %esi,%esi
+  8026ee:	75 2d                	jne    80271d <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  8026f0:	89 da                	mov    %ebx,%edx
+  8026f2:	89 f8                	mov    %edi,%eax
+  8026f4:	e8 14 fd ff ff       	call   80240d <_pipeisclosed>
+  8026f9:	85 c0                	test   %eax,%eax
+  8026fb:	75 4c                	jne    802749 <devpipe_read+0x87>
+      sys_yield();
+  8026fd:	e8 bc e6 ff ff       	call   800dbe <sys_yield>
+  802702:	eb e1                	jmp    8026e5 <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  802704:	83 ec 08             	sub    $0x8,%esp
+  802707:	6a 00                	push   $0x0
+  802709:	ff 75 10             	push   0x10(%ebp)
+  80270c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80270f:	89 c2                	mov    %eax,%edx
+  802711:	89 f8                	mov    %edi,%eax
+  802713:	e8 c3 fe ff ff       	call   8025db <devpipe_read_bulk>
+  802718:	83 c4 10             	add    $0x10,%esp
+  80271b:	eb 02                	jmp    80271f <devpipe_read+0x5d>
+        return i;
+  80271d:	89 f0                	mov    %esi,%eax
+}
+  80271f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802722:	5b                   	pop    %ebx
+  802723:	5e                   	pop    %esi
+  802724:	5f                   	pop    %edi
+  802725:	5d                   	pop    %ebp
+  802726:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802727:	99                   	cltd
+  802728:	c1 ea 1b             	shr    $0x1b,%edx
+  80272b:	01 d0                	add    %edx,%eax
+  80272d:	83 e0 1f             	and    $0x1f,%eax
+  802730:	29 d0                	sub    %edx,%eax
+  802732:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802737:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80273a:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  80273d:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  802740:	83 c6 01             	add    $0x1,%esi
+  802743:	eb 9b                	jmp    8026e0 <devpipe_read+0x1e>
+  return i;
+  802745:	89 f0                	mov    %esi,%eax
+  802747:	eb d6                	jmp    80271f <devpipe_read+0x5d>
+        return 0;
+  802749:	b8 00 00 00 00       	mov    $0x0,%eax
+  80274e:	eb cf                	jmp    80271f <devpipe_read+0x5d>
+
+00802750 <pipe2>:
+{
+  802750:	55                   	push   %ebp
+  802751:	89 e5                	mov    %esp,%ebp
+  802753:	57                   	push   %edi
+  802754:	56                   	push   %esi
+  802755:	53                   	push   %ebx
+  802756:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  802759:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80275c:	50                   	push   %eax
+  80275d:	e8 91 eb ff ff       	call   8012f3 <fd_alloc>
+  802762:	89 c3                	mov    %eax,%ebx
+  802764:	83 c4 10             	add    $0x10,%esp
+  802767:	85 c0                	test   %eax,%eax
+  802769:	0f 88 fb 01 00 00    	js     80296a <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80276f:	83 ec 04             	sub    $0x4,%esp
+  802772:	68 07 04 00 00       	push   $0x407
+  802777:	ff 75 e4             	push   -0x1c(%ebp)
+  80277a:	6a 00                	push   $0x0
+  80277c:	e8 9f e6 ff ff       	call   800e20 <sys_page_alloc>
+  802781:	89 c3                	mov    %eax,%ebx
+  802783:	83 c4 10             	add    $0x10,%esp
+  802786:	85 c0                	test   %eax,%eax
+  802788:	0f 88 dc 01 00 00    	js     80296a <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  80278e:	83 ec 0c             	sub    $0xc,%esp
+  802791:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  802794:	50                   	push   %eax
+  802795:	e8 59 eb ff ff       	call   8012f3 <fd_alloc>
+  80279a:	89 c3                	mov    %eax,%ebx
+  80279c:	83 c4 10             	add    $0x10,%esp
+  80279f:	85 c0                	test   %eax,%eax
+  8027a1:	0f 88 b3 01 00 00    	js     80295a <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8027a7:	83 ec 04             	sub    $0x4,%esp
+  8027aa:	68 07 04 00 00       	push   $0x407
+  8027af:	ff 75 e0             	push   -0x20(%ebp)
+  8027b2:	6a 00                	push   $0x0
+  8027b4:	e8 67 e6 ff ff       	call   800e20 <sys_page_alloc>
+  8027b9:	89 c3                	mov    %eax,%ebx
+  8027bb:	83 c4 10             	add    $0x10,%esp
+  8027be:	85 c0                	test   %eax,%eax
+  8027c0:	0f 88 94 01 00 00    	js     80295a <pipe2+0x20a>
+  va = fd2data(fd0);
+  8027c6:	83 ec 0c             	sub    $0xc,%esp
+  8027c9:	ff 75 e4             	push   -0x1c(%ebp)
+  8027cc:	e8 0e eb ff ff       	call   8012df <fd2data>
+  8027d1:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8027d3:	83 c4 0c             	add    $0xc,%esp
+  8027d6:	68 07 04 00 00       	push   $0x407
+  8027db:	50                   	push   %eax
+  8027dc:	6a 00                	push   $0x0
+  8027de:	e8 3d e6 ff ff       	call   800e20 <sys_page_alloc>
+  8027e3:	89 c3                	mov    %eax,%ebx
+  8027e5:	83 c4 10             	add    $0x10,%esp
+  8027e8:	85 c0                	test   %eax,%eax
+  8027ea:	0f 88 5a 01 00 00    	js     80294a <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8027f0:	83 ec 0c             	sub    $0xc,%esp
+  8027f3:	ff 75 e0             	push   -0x20(%ebp)
+  8027f6:	e8 e4 ea ff ff       	call   8012df <fd2data>
+  8027fb:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802802:	50                   	push   %eax
+  802803:	6a 00                	push   $0x0
+  802805:	57                   	push   %edi
+  802806:	6a 00                	push   $0x0
+  802808:	e8 56 e6 ff ff       	call   800e63 <sys_page_map>
+  80280d:	89 c3                	mov    %eax,%ebx
+  80280f:	83 c4 20             	add    $0x20,%esp
+  802812:	85 c0                	test   %eax,%eax
+  802814:	0f 88 22 01 00 00    	js     80293c <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  80281a:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  80281e:	74 72                	je     802892 <pipe2+0x142>
+  802820:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  802825:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802828:	e8 d3 fa ff ff       	call   802300 <pipe_ring>
+  80282d:	83 ec 04             	sub    $0x4,%esp
+  802830:	68 07 04 00 00       	push   $0x407
+  802835:	01 f0                	add    %esi,%eax
+  802837:	50                   	push   %eax
+  802838:	6a 00                	push   $0x0
+  80283a:	e8 e1 e5 ff ff       	call   800e20 <sys_page_alloc>
+  80283f:	89 c3                	mov    %eax,%ebx
+  802841:	83 c4 10             	add    $0x10,%esp
+  802844:	85 c0                	test   %eax,%eax
+  802846:	0f 88 97 00 00 00    	js     8028e3 <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  80284c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80284f:	e8 ac fa ff ff       	call   802300 <pipe_ring>
+  802854:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  802857:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80285a:	e8 a1 fa ff ff       	call   802300 <pipe_ring>
+  80285f:	83 ec 0c             	sub    $0xc,%esp
+  802862:	68 07 04 00 00       	push   $0x407
+  802867:	53                   	push   %ebx
+  802868:	6a 00                	push   $0x0
+  80286a:	01 f0                	add    %esi,%eax
+  80286c:	50                   	push   %eax
+  80286d:	6a 00                	push   $0x0
+  80286f:	e8 ef e5 ff ff       	call   800e63 <sys_page_map>
+  802874:	89 c3                	mov    %eax,%ebx
+  802876:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80287c:	83 c4 20             	add    $0x20,%esp
+  80287f:	85 c0                	test   %eax,%eax
+  802881:	78 60                	js     8028e3 <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  802883:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802889:	75 9a                	jne    802825 <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  80288b:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  802892:	a1 20 40 80 00       	mov    0x804020,%eax
+  802897:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80289a:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  80289c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80289f:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  8028a6:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8028a9:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  8028ab:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8028ae:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  8028b5:	83 ec 0c             	sub    $0xc,%esp
+  8028b8:	ff 75 e4             	push   -0x1c(%ebp)
+  8028bb:	e8 0f ea ff ff       	call   8012cf <fd2num>
+  8028c0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8028c3:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  8028c5:	83 c4 04             	add    $0x4,%esp
+  8028c8:	ff 75 e0             	push   -0x20(%ebp)
+  8028cb:	e8 ff e9 ff ff       	call   8012cf <fd2num>
+  8028d0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8028d3:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  8028d6:	83 c4 10             	add    $0x10,%esp
+  8028d9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028de:	e9 87 00 00 00       	jmp    80296a <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  8028e3:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  8028e8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8028eb:	e8 10 fa ff ff       	call   802300 <pipe_ring>
+  8028f0:	83 ec 08             	sub    $0x8,%esp
+  8028f3:	01 f0                	add    %esi,%eax
+  8028f5:	50                   	push   %eax
+  8028f6:	6a 00                	push   $0x0
+  8028f8:	e8 a8 e5 ff ff       	call   800ea5 <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  8028fd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802900:	e8 fb f9 ff ff       	call   802300 <pipe_ring>
+  802905:	83 c4 08             	add    $0x8,%esp
+  802908:	01 f0                	add    %esi,%eax
+  80290a:	50                   	push   %eax
+  80290b:	6a 00                	push   $0x0
+  80290d:	e8 93 e5 ff ff       	call   800ea5 <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802912:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802918:	83 c4 10             	add    $0x10,%esp
+  80291b:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802921:	75 c5                	jne    8028e8 <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  802923:	83 ec 0c             	sub    $0xc,%esp
+  802926:	ff 75 e0             	push   -0x20(%ebp)
+  802929:	e8 b1 e9 ff ff       	call   8012df <fd2data>
+  80292e:	83 c4 08             	add    $0x8,%esp
+  802931:	50                   	push   %eax
+  802932:	6a 00                	push   $0x0
+  802934:	e8 6c e5 ff ff       	call   800ea5 <sys_page_unmap>
+  802939:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  80293c:	83 ec 08             	sub    $0x8,%esp
+  80293f:	57                   	push   %edi
+  802940:	6a 00                	push   $0x0
+  802942:	e8 5e e5 ff ff       	call   800ea5 <sys_page_unmap>
+  802947:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  80294a:	83 ec 08             	sub    $0x8,%esp
+  80294d:	ff 75 e0             	push   -0x20(%ebp)
+  802950:	6a 00                	push   $0x0
+  802952:	e8 4e e5 ff ff       	call   800ea5 <sys_page_unmap>
+  802957:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  80295a:	83 ec 08             	sub    $0x8,%esp
+  80295d:	ff 75 e4             	push   -0x1c(%ebp)
+  802960:	6a 00                	push   $0x0
+  802962:	e8 3e e5 ff ff       	call   800ea5 <sys_page_unmap>
+  802967:	83 c4 10             	add    $0x10,%esp
+}
+  80296a:	89 d8                	mov    %ebx,%eax
+  80296c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80296f:	5b                   	pop    %ebx
+  802970:	5e                   	pop    %esi
+  802971:	5f                   	pop    %edi
+  802972:	5d                   	pop    %ebp
+  802973:	c3                   	ret
+
+00802974 <pipe>:
+{
+  802974:	55                   	push   %ebp
+  802975:	89 e5                	mov    %esp,%ebp
+  802977:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  80297a:	6a 00                	push   $0x0
+  80297c:	ff 75 08             	push   0x8(%ebp)
+  80297f:	e8 cc fd ff ff       	call   802750 <pipe2>
+}
+  802984:	c9                   	leave
+  802985:	c3                   	ret
+
+00802986 <pipeisclosed>:
+{
+  802986:	55                   	push   %ebp
+  802987:	89 e5                	mov    %esp,%ebp
+  802989:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80298c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80298f:	50                   	push   %eax
+  802990:	ff 75 08             	push   0x8(%ebp)
+  802993:	e8 b1 e9 ff ff       	call   801349 <fd_lookup>
+  802998:	83 c4 10             	add    $0x10,%esp
+  80299b:	85 c0                	test   %eax,%eax
+  80299d:	78 18                	js     8029b7 <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  80299f:	83 ec 0c             	sub    $0xc,%esp
+  8029a2:	ff 75 f4             	push   -0xc(%ebp)
+  8029a5:	e8 35 e9 ff ff       	call   8012df <fd2data>
+  8029aa:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  8029ac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029af:	e8 59 fa ff ff       	call   80240d <_pipeisclosed>
+  8029b4:	83 c4 10             	add    $0x10,%esp
+}
+  8029b7:	c9                   	leave
+  8029b8:	c3                   	ret
+
+008029b9 <pipe_splice>:
+{
+  8029b9:	55                   	push   %ebp
+  8029ba:	89 e5                	mov    %esp,%ebp
+  8029bc:	57                   	push   %edi
+  8029bd:	56                   	push   %esi
+  8029be:	53                   	push   %ebx
+  8029bf:	83 ec 34             	sub    $0x34,%esp
+  8029c2:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8029c5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8029c8:	50                   	push   %eax
+  8029c9:	ff 75 08             	push   0x8(%ebp)
+  8029cc:	e8 78 e9 ff ff       	call   801349 <fd_lookup>
+  8029d1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8029d4:	83 c4 10             	add    $0x10,%esp
+  8029d7:	85 c0                	test   %eax,%eax
+  8029d9:	0f 88 d7 00 00 00    	js     802ab6 <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  8029df:	83 ec 0c             	sub    $0xc,%esp
+  8029e2:	ff 75 e4             	push   -0x1c(%ebp)
+  8029e5:	e8 f5 e8 ff ff       	call   8012df <fd2data>
+  8029ea:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  8029ec:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8029ef:	83 c4 10             	add    $0x10,%esp
+  8029f2:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  8029f8:	39 10                	cmp    %edx,(%eax)
+  8029fa:	0f 85 c1 00 00 00    	jne    802ac1 <pipe_splice+0x108>
+  802a00:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  802a04:	0f 84 c0 00 00 00    	je     802aca <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  802a0a:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802a0e:	0f 84 bf 00 00 00    	je     802ad3 <pipe_splice+0x11a>
+  802a14:	89 f7                	mov    %esi,%edi
+  802a16:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  802a1c:	0f 85 ba 00 00 00    	jne    802adc <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802a22:	8d 43 04             	lea    0x4(%ebx),%eax
+  802a25:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802a28:	eb 38                	jmp    802a62 <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802a2a:	83 ec 0c             	sub    $0xc,%esp
+  802a2d:	68 00 10 00 00       	push   $0x1000
+  802a32:	89 f1                	mov    %esi,%ecx
+  802a34:	89 da                	mov    %ebx,%edx
+  802a36:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802a39:	e8 34 fa ff ff       	call   802472 <devpipe_write_bulk>
+  802a3e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802a41:	83 c4 10             	add    $0x10,%esp
+  802a44:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802a49:	75 53                	jne    802a9e <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  802a4b:	83 ec 08             	sub    $0x8,%esp
+  802a4e:	56                   	push   %esi
+  802a4f:	6a 00                	push   $0x0
+  802a51:	e8 4f e4 ff ff       	call   800ea5 <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  802a56:	83 c7 01             	add    $0x1,%edi
+  802a59:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802a5f:	83 c4 10             	add    $0x10,%esp
+  802a62:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802a65:	74 3a                	je     802aa1 <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  802a67:	8b 03                	mov    (%ebx),%eax
+  802a69:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802a6c:	75 bc                	jne    802a2a <pipe_splice+0x71>
+  802a6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a73:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  802a77:	85 c0                	test   %eax,%eax
+  802a79:	74 af                	je     802a2a <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802a7b:	83 ec 04             	sub    $0x4,%esp
+  802a7e:	6a 07                	push   $0x7
+  802a80:	56                   	push   %esi
+  802a81:	ff 75 d0             	push   -0x30(%ebp)
+  802a84:	e8 f3 e6 ff ff       	call   80117c <sys_chan_wakeup>
+  802a89:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802a8c:	83 c4 10             	add    $0x10,%esp
+  802a8f:	85 c0                	test   %eax,%eax
+  802a91:	79 b8                	jns    802a4b <pipe_splice+0x92>
+  802a93:	b8 01 00 00 00       	mov    $0x1,%eax
+  802a98:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802a9c:	eb 8c                	jmp    802a2a <pipe_splice+0x71>
+  802a9e:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  802aa1:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802aa5:	75 06                	jne    802aad <pipe_splice+0xf4>
+  802aa7:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802aab:	78 09                	js     802ab6 <pipe_splice+0xfd>
+  return i * PGSIZE;
+  802aad:	8b 45 10             	mov    0x10(%ebp),%eax
+  802ab0:	c1 e0 0c             	shl    $0xc,%eax
+  802ab3:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  802ab6:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802ab9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802abc:	5b                   	pop    %ebx
+  802abd:	5e                   	pop    %esi
+  802abe:	5f                   	pop    %edi
+  802abf:	5d                   	pop    %ebp
+  802ac0:	c3                   	ret
+    return -E_INVAL;
+  802ac1:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802ac8:	eb ec                	jmp    802ab6 <pipe_splice+0xfd>
+  802aca:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802ad1:	eb e3                	jmp    802ab6 <pipe_splice+0xfd>
+  802ad3:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802ada:	eb da                	jmp    802ab6 <pipe_splice+0xfd>
+  802adc:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802ae3:	eb d1                	jmp    802ab6 <pipe_splice+0xfd>
+
+00802ae5 <pipe_splice_read>:
+{
+  802ae5:	55                   	push   %ebp
+  802ae6:	89 e5                	mov    %esp,%ebp
+  802ae8:	53                   	push   %ebx
+  802ae9:	83 ec 1c             	sub    $0x1c,%esp
+  802aec:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802aef:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802af2:	50                   	push   %eax
+  802af3:	ff 75 08             	push   0x8(%ebp)
+  802af6:	e8 4e e8 ff ff       	call   801349 <fd_lookup>
+  802afb:	83 c4 10             	add    $0x10,%esp
+  802afe:	85 c0                	test   %eax,%eax
+  802b00:	78 49                	js     802b4b <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  802b02:	83 ec 0c             	sub    $0xc,%esp
+  802b05:	ff 75 f4             	push   -0xc(%ebp)
+  802b08:	e8 d2 e7 ff ff       	call   8012df <fd2data>
+  802b0d:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802b0f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b12:	83 c4 10             	add    $0x10,%esp
+  802b15:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  802b1b:	39 08                	cmp    %ecx,(%eax)
+  802b1d:	75 31                	jne    802b50 <pipe_splice_read+0x6b>
+  802b1f:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  802b23:	74 32                	je     802b57 <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  802b25:	8b 48 08             	mov    0x8(%eax),%ecx
+  802b28:	83 e1 03             	and    $0x3,%ecx
+  802b2b:	83 f9 01             	cmp    $0x1,%ecx
+  802b2e:	74 2e                	je     802b5e <pipe_splice_read+0x79>
+  802b30:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  802b36:	75 2d                	jne    802b65 <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  802b38:	83 ec 08             	sub    $0x8,%esp
+  802b3b:	53                   	push   %ebx
+  802b3c:	68 00 10 00 00       	push   $0x1000
+  802b41:	89 d9                	mov    %ebx,%ecx
+  802b43:	e8 93 fa ff ff       	call   8025db <devpipe_read_bulk>
+  802b48:	83 c4 10             	add    $0x10,%esp
+}
+  802b4b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b4e:	c9                   	leave
+  802b4f:	c3                   	ret
+    return -E_INVAL;
+  802b50:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b55:	eb f4                	jmp    802b4b <pipe_splice_read+0x66>
+  802b57:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b5c:	eb ed                	jmp    802b4b <pipe_splice_read+0x66>
+  802b5e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b63:	eb e6                	jmp    802b4b <pipe_splice_read+0x66>
+  802b65:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b6a:	eb df                	jmp    802b4b <pipe_splice_read+0x66>
+
+00802b6c <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  802b6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b71:	c3                   	ret
+
+00802b72 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802b72:	55                   	push   %ebp
+  802b73:	89 e5                	mov    %esp,%ebp
+  802b75:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  802b78:	68 07 36 80 00       	push   $0x803607
+  802b7d:	ff 75 0c             	push   0xc(%ebp)
+  802b80:	e8 6c de ff ff       	call   8009f1 <strcpy>
+  return 0;
+}
+  802b85:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b8a:	c9                   	leave
+  802b8b:	c3                   	ret
+
+00802b8c <devcons_write>:
+{
+  802b8c:	55                   	push   %ebp
+  802b8d:	89 e5                	mov    %esp,%ebp
+  802b8f:	57                   	push   %edi
+  802b90:	56                   	push   %esi
+  802b91:	53                   	push   %ebx
+  802b92:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  802b98:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  802b9d:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  802ba3:	eb 2e                	jmp    802bd3 <devcons_write+0x47>
+    m = n - tot;
+  802ba5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802ba8:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  802baa:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802baf:	39 c3                	cmp    %eax,%ebx
+  802bb1:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  802bb4:	83 ec 04             	sub    $0x4,%esp
+  802bb7:	53                   	push   %ebx
+  802bb8:	89 f0                	mov    %esi,%eax
+  802bba:	03 45 0c             	add    0xc(%ebp),%eax
+  802bbd:	50                   	push   %eax
+  802bbe:	57                   	push   %edi
+  802bbf:	e8 b3 df ff ff       	call   800b77 <memmove>
+    sys_cputs(buf, m);
+  802bc4:	83 c4 08             	add    $0x8,%esp
+  802bc7:	53                   	push   %ebx
+  802bc8:	57                   	push   %edi
+  802bc9:	e8 53 e1 ff ff       	call   800d21 <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  802bce:	01 de                	add    %ebx,%esi
+  802bd0:	83 c4 10             	add    $0x10,%esp
+  802bd3:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802bd6:	72 cd                	jb     802ba5 <devcons_write+0x19>
+}
+  802bd8:	89 f0                	mov    %esi,%eax
+  802bda:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802bdd:	5b                   	pop    %ebx
+  802bde:	5e                   	pop    %esi
+  802bdf:	5f                   	pop    %edi
+  802be0:	5d                   	pop    %ebp
+  802be1:	c3                   	ret
+
+00802be2 <devcons_read>:
+{
+  802be2:	55                   	push   %ebp
+  802be3:	89 e5                	mov    %esp,%ebp
+  802be5:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  802be8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bed:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802bf1:	75 07                	jne    802bfa <devcons_read+0x18>
+  802bf3:	eb 1f                	jmp    802c14 <devcons_read+0x32>
+    sys_yield();
+  802bf5:	e8 c4 e1 ff ff       	call   800dbe <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  802bfa:	e8 40 e1 ff ff       	call   800d3f <sys_cgetc>
+  802bff:	85 c0                	test   %eax,%eax
+  802c01:	74 f2                	je     802bf5 <devcons_read+0x13>
+  if (c < 0)
+  802c03:	78 0f                	js     802c14 <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  802c05:	83 f8 04             	cmp    $0x4,%eax
+  802c08:	74 0c                	je     802c16 <devcons_read+0x34>
+  *(char*)vbuf = c;
+  802c0a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802c0d:	88 02                	mov    %al,(%edx)
+  return 1;
+  802c0f:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802c14:	c9                   	leave
+  802c15:	c3                   	ret
+    return 0;
+  802c16:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c1b:	eb f7                	jmp    802c14 <devcons_read+0x32>
+
+00802c1d <cputchar>:
+{
+  802c1d:	55                   	push   %ebp
+  802c1e:	89 e5                	mov    %esp,%ebp
+  802c20:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  802c23:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c26:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  802c29:	6a 01                	push   $0x1
+  802c2b:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802c2e:	50                   	push   %eax
+  802c2f:	e8 ed e0 ff ff       	call   800d21 <sys_cputs>
+}
+  802c34:	83 c4 10             	add    $0x10,%esp
+  802c37:	c9                   	leave
+  802c38:	c3                   	ret
+
+00802c39 <getchar>:
+{
+  802c39:	55                   	push   %ebp
+  802c3a:	89 e5                	mov    %esp,%ebp
+  802c3c:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  802c3f:	6a 01                	push   $0x1
+  802c41:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802c44:	50                   	push   %eax
+  802c45:	6a 00                	push   $0x0
+  802c47:	e8 a8 e9 ff ff       	call   8015f4 <read>
+  if (r < 0)
+  802c4c:	83 c4 10             	add    $0x10,%esp
+  802c4f:	85 c0                	test   %eax,%eax
+  802c51:	78 06                	js     802c59 <getchar+0x20>
+  if (r < 1)
+  802c53:	74 06                	je     802c5b <getchar+0x22>
+  return c;
+  802c55:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802c59:	c9                   	leave
+  802c5a:	c3                   	ret
+    return -E_EOF;
+  802c5b:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802c60:	eb f7                	jmp    802c59 <getchar+0x20>
+
+00802c62 <iscons>:
+{
+  802c62:	55                   	push   %ebp
+  802c63:	89 e5                	mov    %esp,%ebp
+  802c65:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802c68:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802c6b:	50                   	push   %eax
+  802c6c:	ff 75 08             	push   0x8(%ebp)
+  802c6f:	e8 d5 e6 ff ff       	call   801349 <fd_lookup>
+  802c74:	83 c4 10             	add    $0x10,%esp
+  802c77:	85 c0                	test   %eax,%eax
+  802c79:	78 11                	js     802c8c <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  802c7b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c7e:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802c84:	39 10                	cmp    %edx,(%eax)
+  802c86:	0f 94 c0             	sete   %al
+  802c89:	0f b6 c0             	movzbl %al,%eax
+}
+  802c8c:	c9                   	leave
+  802c8d:	c3                   	ret
+
+00802c8e <opencons>:
+{
+  802c8e:	55                   	push   %ebp
+  802c8f:	89 e5                	mov    %esp,%ebp
+  802c91:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  802c94:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802c97:	50                   	push   %eax
+  802c98:	e8 56 e6 ff ff       	call   8012f3 <fd_alloc>
+  802c9d:	83 c4 10             	add    $0x10,%esp
+  802ca0:	85 c0                	test   %eax,%eax
+  802ca2:	78 3a                	js     802cde <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802ca4:	83 ec 04             	sub    $0x4,%esp
+  802ca7:	68 07 04 00 00       	push   $0x407
+  802cac:	ff 75 f4             	push   -0xc(%ebp)
+  802caf:	6a 00                	push   $0x0
+  802cb1:	e8 6a e1 ff ff       	call   800e20 <sys_page_alloc>
+  802cb6:	83 c4 10             	add    $0x10,%esp
+  802cb9:	85 c0                	test   %eax,%eax
+  802cbb:	78 21                	js     802cde <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  802cbd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802cc0:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802cc6:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  802cc8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ccb:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  802cd2:	83 ec 0c             	sub    $0xc,%esp
+  802cd5:	50                   	push   %eax
+  802cd6:	e8 f4 e5 ff ff       	call   8012cf <fd2num>
+  802cdb:	83 c4 10             	add    $0x10,%esp
+}
+  802cde:	c9                   	leave
+  802cdf:	c3                   	ret
+
+00802ce0 <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  802ce0:	55                   	push   %ebp
+  802ce1:	89 e5                	mov    %esp,%ebp
+  802ce3:	57                   	push   %edi
+  802ce4:	56                   	push   %esi
+  802ce5:	53                   	push   %ebx
+  802ce6:	83 ec 14             	sub    $0x14,%esp
+  802ce9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802cec:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802cef:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802cf2:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  802cf5:	85 c0                	test   %eax,%eax
+  802cf7:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802cfc:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  802cff:	ff 33                	push   (%ebx)
+  802d01:	50                   	push   %eax
+  802d02:	e8 f1 e3 ff ff       	call   8010f8 <sys_ipc_recv>
+  802d07:	83 c4 10             	add    $0x10,%esp
+  802d0a:	85 c0                	test   %eax,%eax
+  802d0c:	78 39                	js     802d47 <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  802d0e:	85 ff                	test   %edi,%edi
+  802d10:	74 0a                	je     802d1c <ipc_recv_pages+0x3c>
+  802d12:	a1 44 67 80 00       	mov    0x806744,%eax
+  802d17:	8b 40 7c             	mov    0x7c(%eax),%eax
+  802d1a:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  802d1c:	85 f6                	test   %esi,%esi
+  802d1e:	74 0d                	je     802d2d <ipc_recv_pages+0x4d>
+  802d20:	a1 44 67 80 00       	mov    0x806744,%eax
+  802d25:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  802d2b:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  802d2d:	a1 44 67 80 00       	mov    0x806744,%eax
+  802d32:	8b 40 74             	mov    0x74(%eax),%eax
+  802d35:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  802d37:	a1 44 67 80 00       	mov    0x806744,%eax
+  802d3c:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  802d3f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d42:	5b                   	pop    %ebx
+  802d43:	5e                   	pop    %esi
+  802d44:	5f                   	pop    %edi
+  802d45:	5d                   	pop    %ebp
+  802d46:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  802d47:	85 ff                	test   %edi,%edi
+  802d49:	74 06                	je     802d51 <ipc_recv_pages+0x71>
+  802d4b:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  802d51:	85 f6                	test   %esi,%esi
+  802d53:	74 06                	je     802d5b <ipc_recv_pages+0x7b>
+  802d55:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  802d5b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  802d61:	eb dc                	jmp    802d3f <ipc_recv_pages+0x5f>
+
+00802d63 <ipc_recv>:
+{
+  802d63:	55                   	push   %ebp
+  802d64:	89 e5                	mov    %esp,%ebp
+  802d66:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  802d69:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  802d70:	ff 75 10             	push   0x10(%ebp)
+  802d73:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802d76:	50                   	push   %eax
+  802d77:	ff 75 0c             	push   0xc(%ebp)
+  802d7a:	ff 75 08             	push   0x8(%ebp)
+  802d7d:	e8 5e ff ff ff       	call   802ce0 <ipc_recv_pages>
+}
+  802d82:	c9                   	leave
+  802d83:	c3                   	ret
+
+00802d84 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  802d84:	55                   	push   %ebp
+  802d85:	89 e5                	mov    %esp,%ebp
+  802d87:	57                   	push   %edi
+  802d88:	56                   	push   %esi
+  802d89:	53                   	push   %ebx
+  802d8a:	83 ec 0c             	sub    $0xc,%esp
+  802d8d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802d90:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802d93:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  802d96:	89 c3                	mov    %eax,%ebx
+  802d98:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  802d9e:	85 c0                	test   %eax,%eax
+  802da0:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802da5:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  802da8:	83 ec 0c             	sub    $0xc,%esp
+  802dab:	ff 75 14             	push   0x14(%ebp)
+  802dae:	ff 75 18             	push   0x18(%ebp)
+  802db1:	53                   	push   %ebx
+  802db2:	56                   	push   %esi
+  802db3:	57                   	push   %edi
+  802db4:	e8 1e e3 ff ff       	call   8010d7 <sys_ipc_try_send>
+  802db9:	83 c4 20             	add    $0x20,%esp
+  802dbc:	85 c0                	test   %eax,%eax
+  802dbe:	79 1e                	jns    802dde <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  802dc0:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802dc3:	75 07                	jne    802dcc <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  802dc5:	e8 f4 df ff ff       	call   800dbe <sys_yield>
+  802dca:	eb dc                	jmp    802da8 <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  802dcc:	50                   	push   %eax
+  802dcd:	68 13 36 80 00       	push   $0x803613
+  802dd2:	6a 5c                	push   $0x5c
+  802dd4:	68 20 36 80 00       	push   $0x803620
+  802dd9:	e8 4a d5 ff ff       	call   800328 <_panic>
+  }
+}
+  802dde:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802de1:	5b                   	pop    %ebx
+  802de2:	5e                   	pop    %esi
+  802de3:	5f                   	pop    %edi
+  802de4:	5d                   	pop    %ebp
+  802de5:	c3                   	ret
+
+00802de6 <ipc_send>:
+{
+  802de6:	55                   	push   %ebp
+  802de7:	89 e5                	mov    %esp,%ebp
+  802de9:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  802dec:	ff 75 14             	push   0x14(%ebp)
+  802def:	6a 01                	push   $0x1
+  802df1:	ff 75 10             	push   0x10(%ebp)
+  802df4:	ff 75 0c             	push   0xc(%ebp)
+  802df7:	ff 75 08             	push   0x8(%ebp)
+  802dfa:	e8 85 ff ff ff       	call   802d84 <ipc_send_pages>
+}
+  802dff:	83 c4 20             	add    $0x20,%esp
+  802e02:	c9                   	leave
+  802e03:	c3                   	ret
+
+00802e04 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802e04:	55                   	push   %ebp
+  802e05:	89 e5                	mov    %esp,%ebp
+  802e07:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  802e0a:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  802e0f:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802e12:	c1 e0 04             	shl    $0x4,%eax
+  802e15:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802e1a:	8b 40 50             	mov    0x50(%eax),%eax
+  802e1d:	39 c8                	cmp    %ecx,%eax
+  802e1f:	74 12                	je     802e33 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  802e21:	83 c2 01             	add    $0x1,%edx
+  802e24:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802e2a:	75 e3                	jne    802e0f <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  802e2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e31:	eb 0e                	jmp    802e41 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  802e33:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802e36:	c1 e0 04             	shl    $0x4,%eax
+  802e39:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802e3e:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802e41:	5d                   	pop    %ebp
+  802e42:	c3                   	ret
+
+00802e43 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802e43:	55                   	push   %ebp
+  802e44:	89 e5                	mov    %esp,%ebp
+  802e46:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802e49:	89 c2                	mov    %eax,%edx
+  802e4b:	c1 ea 16             	shr    $0x16,%edx
+  802e4e:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  802e55:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802e5a:	f6 c1 01             	test   $0x1,%cl
+  802e5d:	74 1c                	je     802e7b <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  802e5f:	c1 e8 0c             	shr    $0xc,%eax
+  802e62:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  802e69:	a8 01                	test   $0x1,%al
+  802e6b:	74 0e                	je     802e7b <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  802e6d:	c1 e8 0c             	shr    $0xc,%eax
+  802e70:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802e77:	ef 
+  802e78:	0f b7 d2             	movzwl %dx,%edx
+}
+  802e7b:	89 d0                	mov    %edx,%eax
+  802e7d:	5d                   	pop    %ebp
+  802e7e:	c3                   	ret
+
+00802e7f <udivmod>:
+  802e7f:	55                   	push   %ebp
+  802e80:	57                   	push   %edi
+  802e81:	56                   	push   %esi
+  802e82:	53                   	push   %ebx
+  802e83:	83 ec 14             	sub    $0x14,%esp
+  802e86:	8b 74 24 28          	mov    0x28(%esp),%esi
+  802e8a:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  802e8e:	89 fb                	mov    %edi,%ebx
+  802e90:	09 f3                	or     %esi,%ebx
+  802e92:	0f 84 88 00 00 00    	je     802f20 <udivmod+0xa1>
+  802e98:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802e9d:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802ea4:	00 
+  802ea5:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802eac:	00 
+  802ead:	89 cd                	mov    %ecx,%ebp
+  802eaf:	89 34 24             	mov    %esi,(%esp)
+  802eb2:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802eb6:	eb 08                	jmp    802ec0 <udivmod+0x41>
+  802eb8:	83 ed 01             	sub    $0x1,%ebp
+  802ebb:	83 fd ff             	cmp    $0xffffffff,%ebp
+  802ebe:	74 6c                	je     802f2c <udivmod+0xad>
+  802ec0:	89 c3                	mov    %eax,%ebx
+  802ec2:	89 d6                	mov    %edx,%esi
+  802ec4:	89 e9                	mov    %ebp,%ecx
+  802ec6:	0f ad f3             	shrd   %cl,%esi,%ebx
+  802ec9:	d3 ee                	shr    %cl,%esi
+  802ecb:	f6 c1 20             	test   $0x20,%cl
+  802ece:	74 04                	je     802ed4 <udivmod+0x55>
+  802ed0:	89 f3                	mov    %esi,%ebx
+  802ed2:	31 f6                	xor    %esi,%esi
+  802ed4:	8b 3c 24             	mov    (%esp),%edi
+  802ed7:	39 fb                	cmp    %edi,%ebx
+  802ed9:	89 f7                	mov    %esi,%edi
+  802edb:	8b 1c 24             	mov    (%esp),%ebx
+  802ede:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802ee2:	19 f7                	sbb    %esi,%edi
+  802ee4:	72 d2                	jb     802eb8 <udivmod+0x39>
+  802ee6:	89 f7                	mov    %esi,%edi
+  802ee8:	89 de                	mov    %ebx,%esi
+  802eea:	89 e9                	mov    %ebp,%ecx
+  802eec:	0f a5 f7             	shld   %cl,%esi,%edi
+  802eef:	d3 e6                	shl    %cl,%esi
+  802ef1:	f6 c1 20             	test   $0x20,%cl
+  802ef4:	74 04                	je     802efa <udivmod+0x7b>
+  802ef6:	89 f7                	mov    %esi,%edi
+  802ef8:	31 f6                	xor    %esi,%esi
+  802efa:	29 f0                	sub    %esi,%eax
+  802efc:	19 fa                	sbb    %edi,%edx
+  802efe:	be 01 00 00 00       	mov    $0x1,%esi
+  802f03:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f08:	0f a5 f7             	shld   %cl,%esi,%edi
+  802f0b:	d3 e6                	shl    %cl,%esi
+  802f0d:	f6 c1 20             	test   $0x20,%cl
+  802f10:	74 04                	je     802f16 <udivmod+0x97>
+  802f12:	89 f7                	mov    %esi,%edi
+  802f14:	31 f6                	xor    %esi,%esi
+  802f16:	09 74 24 08          	or     %esi,0x8(%esp)
+  802f1a:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802f1e:	eb 98                	jmp    802eb8 <udivmod+0x39>
+  802f20:	89 f0                	mov    %esi,%eax
+  802f22:	89 fa                	mov    %edi,%edx
+  802f24:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802f28:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802f2c:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802f30:	89 01                	mov    %eax,(%ecx)
+  802f32:	89 51 04             	mov    %edx,0x4(%ecx)
+  802f35:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802f39:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802f3d:	83 c4 14             	add    $0x14,%esp
+  802f40:	5b                   	pop    %ebx
+  802f41:	5e                   	pop    %esi
+  802f42:	5f                   	pop    %edi
+  802f43:	5d                   	pop    %ebp
+  802f44:	c3                   	ret
+
+00802f45 <__udivdi3>:
+  802f45:	83 ec 18             	sub    $0x18,%esp
+  802f48:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802f4c:	50                   	push   %eax
+  802f4d:	ff 74 24 2c          	push   0x2c(%esp)
+  802f51:	ff 74 24 2c          	push   0x2c(%esp)
+  802f55:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802f59:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802f5d:	e8 1d ff ff ff       	call   802e7f <udivmod>
+  802f62:	83 c4 24             	add    $0x24,%esp
+  802f65:	c3                   	ret
+
+00802f66 <__umoddi3>:
+  802f66:	83 ec 18             	sub    $0x18,%esp
+  802f69:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802f6d:	50                   	push   %eax
+  802f6e:	ff 74 24 2c          	push   0x2c(%esp)
+  802f72:	ff 74 24 2c          	push   0x2c(%esp)
+  802f76:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802f7a:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802f7e:	e8 fc fe ff ff       	call   802e7f <udivmod>
+  802f83:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802f87:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802f8b:	83 c4 24             	add    $0x24,%esp
+  802f8e:	c3                   	ret
+
+00802f8f <__divdi3>:
+  802f8f:	56                   	push   %esi
+  802f90:	53                   	push   %ebx
+  802f91:	83 ec 14             	sub    $0x14,%esp
+  802f94:	8b 44 24 20          	mov    0x20(%esp),%eax
+  802f98:	8b 54 24 24          	mov    0x24(%esp),%edx
+  802f9c:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  802fa0:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  802fa4:	85 d2                	test   %edx,%edx
+  802fa6:	78 18                	js     802fc0 <__divdi3+0x31>
+  802fa8:	85 db                	test   %ebx,%ebx
+  802faa:	78 3e                	js     802fea <__divdi3+0x5b>
+  802fac:	83 ec 04             	sub    $0x4,%esp
+  802faf:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802fb3:	56                   	push   %esi
+  802fb4:	53                   	push   %ebx
+  802fb5:	51                   	push   %ecx
+  802fb6:	e8 c4 fe ff ff       	call   802e7f <udivmod>
+  802fbb:	83 c4 10             	add    $0x10,%esp
+  802fbe:	eb 24                	jmp    802fe4 <__divdi3+0x55>
+  802fc0:	f7 d8                	neg    %eax
+  802fc2:	83 d2 00             	adc    $0x0,%edx
+  802fc5:	f7 da                	neg    %edx
+  802fc7:	85 db                	test   %ebx,%ebx
+  802fc9:	78 3a                	js     803005 <__divdi3+0x76>
+  802fcb:	83 ec 04             	sub    $0x4,%esp
+  802fce:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802fd2:	56                   	push   %esi
+  802fd3:	53                   	push   %ebx
+  802fd4:	51                   	push   %ecx
+  802fd5:	e8 a5 fe ff ff       	call   802e7f <udivmod>
+  802fda:	83 c4 10             	add    $0x10,%esp
+  802fdd:	f7 d8                	neg    %eax
+  802fdf:	83 d2 00             	adc    $0x0,%edx
+  802fe2:	f7 da                	neg    %edx
+  802fe4:	83 c4 14             	add    $0x14,%esp
+  802fe7:	5b                   	pop    %ebx
+  802fe8:	5e                   	pop    %esi
+  802fe9:	c3                   	ret
+  802fea:	83 ec 04             	sub    $0x4,%esp
+  802fed:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802ff1:	56                   	push   %esi
+  802ff2:	f7 d9                	neg    %ecx
+  802ff4:	83 d3 00             	adc    $0x0,%ebx
+  802ff7:	f7 db                	neg    %ebx
+  802ff9:	53                   	push   %ebx
+  802ffa:	51                   	push   %ecx
+  802ffb:	e8 7f fe ff ff       	call   802e7f <udivmod>
+  803000:	83 c4 10             	add    $0x10,%esp
+  803003:	eb d8                	jmp    802fdd <__divdi3+0x4e>
+  803005:	83 ec 04             	sub    $0x4,%esp
+  803008:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80300c:	56                   	push   %esi
+  80300d:	f7 d9                	neg    %ecx
+  80300f:	83 d3 00             	adc    $0x0,%ebx
+  803012:	f7 db                	neg    %ebx
+  803014:	53                   	push   %ebx
+  803015:	51                   	push   %ecx
+  803016:	e8 64 fe ff ff       	call   802e7f <udivmod>
+  80301b:	83 c4 10             	add    $0x10,%esp
+  80301e:	eb c4                	jmp    802fe4 <__divdi3+0x55>
+
+00803020 <__moddi3>:
+  803020:	55                   	push   %ebp
+  803021:	57                   	push   %edi
+  803022:	56                   	push   %esi
+  803023:	53                   	push   %ebx
+  803024:	83 ec 24             	sub    $0x24,%esp
+  803027:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80302b:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80302f:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  803033:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  803037:	85 d2                	test   %edx,%edx
+  803039:	78 3b                	js     803076 <__moddi3+0x56>
+  80303b:	83 ec 04             	sub    $0x4,%esp
+  80303e:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803042:	56                   	push   %esi
+  803043:	89 ce                	mov    %ecx,%esi
+  803045:	f7 de                	neg    %esi
+  803047:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80304b:	89 de                	mov    %ebx,%esi
+  80304d:	83 d6 00             	adc    $0x0,%esi
+  803050:	f7 de                	neg    %esi
+  803052:	89 74 24 14          	mov    %esi,0x14(%esp)
+  803056:	8b 74 24 08          	mov    0x8(%esp),%esi
+  80305a:	0f 48 f1             	cmovs  %ecx,%esi
+  80305d:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  803062:	53                   	push   %ebx
+  803063:	56                   	push   %esi
+  803064:	e8 16 fe ff ff       	call   802e7f <udivmod>
+  803069:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80306d:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803071:	83 c4 10             	add    $0x10,%esp
+  803074:	eb 47                	jmp    8030bd <__moddi3+0x9d>
+  803076:	f7 d8                	neg    %eax
+  803078:	83 d2 00             	adc    $0x0,%edx
+  80307b:	f7 da                	neg    %edx
+  80307d:	83 ec 04             	sub    $0x4,%esp
+  803080:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803084:	56                   	push   %esi
+  803085:	89 cf                	mov    %ecx,%edi
+  803087:	f7 df                	neg    %edi
+  803089:	89 de                	mov    %ebx,%esi
+  80308b:	83 d6 00             	adc    $0x0,%esi
+  80308e:	f7 de                	neg    %esi
+  803090:	0f 49 cf             	cmovns %edi,%ecx
+  803093:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  803097:	0f 49 de             	cmovns %esi,%ebx
+  80309a:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  80309e:	ff 74 24 0c          	push   0xc(%esp)
+  8030a2:	ff 74 24 0c          	push   0xc(%esp)
+  8030a6:	e8 d4 fd ff ff       	call   802e7f <udivmod>
+  8030ab:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8030af:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8030b3:	f7 d8                	neg    %eax
+  8030b5:	83 d2 00             	adc    $0x0,%edx
+  8030b8:	f7 da                	neg    %edx
+  8030ba:	83 c4 10             	add    $0x10,%esp
+  8030bd:	83 c4 24             	add    $0x24,%esp
+  8030c0:	5b                   	pop    %ebx
+  8030c1:	5e                   	pop    %esi
+  8030c2:	5f                   	pop    %edi
+  8030c3:	5d                   	pop    %ebp
+  8030c4:	c3                   	ret
@@ -0,0 +1,6356 @@
+
+obj/user/badsegment.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 09 00 00 00       	call   80003a <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  // Try to load the kernel's TSS selector into the DS register.
+  asm volatile ("movw $0x28,%ax; movw %ax,%ds");
+  800033:	66 b8 28 00          	mov    $0x28,%ax
+  800037:	8e d8                	mov    %eax,%ds
+}
+  800039:	c3                   	ret
+
+0080003a <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80003a:	55                   	push   %ebp
+  80003b:	89 e5                	mov    %esp,%ebp
+  80003d:	56                   	push   %esi
+  80003e:	53                   	push   %ebx
+  80003f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800042:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  800045:	c7 05 44 57 80 00 00 	movl   $0x0,0x805744
+  80004c:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  80004f:	e8 d1 00 00 00       	call   800125 <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  800054:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800059:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80005c:	c1 e0 04             	shl    $0x4,%eax
+  80005f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800064:	a3 44 57 80 00       	mov    %eax,0x805744
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800069:	85 db                	test   %ebx,%ebx
+  80006b:	7e 07                	jle    800074 <libmain+0x3a>
+    binaryname = argv[0];
+  80006d:	8b 06                	mov    (%esi),%eax
+  80006f:	a3 00 40 80 00       	mov    %eax,0x804000
+
+  // call user main routine
+  umain(argc, argv);
+  800074:	83 ec 08             	sub    $0x8,%esp
+  800077:	56                   	push   %esi
+  800078:	53                   	push   %ebx
+  800079:	e8 b5 ff ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  80007e:	e8 0a 00 00 00       	call   80008d <exit>
+}
+  800083:	83 c4 10             	add    $0x10,%esp
+  800086:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800089:	5b                   	pop    %ebx
+  80008a:	5e                   	pop    %esi
+  80008b:	5d                   	pop    %ebp
+  80008c:	c3                   	ret
+
+0080008d <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80008d:	55                   	push   %ebp
+  80008e:	89 e5                	mov    %esp,%ebp
+  800090:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  800093:	e8 87 07 00 00       	call   80081f <close_all>
+  sys_env_destroy(0);
+  800098:	83 ec 0c             	sub    $0xc,%esp
+  80009b:	6a 00                	push   $0x0
+  80009d:	e8 42 00 00 00       	call   8000e4 <sys_env_destroy>
+}
+  8000a2:	83 c4 10             	add    $0x10,%esp
+  8000a5:	c9                   	leave
+  8000a6:	c3                   	ret
+
+008000a7 <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8000a7:	55                   	push   %ebp
+  8000a8:	89 e5                	mov    %esp,%ebp
+  8000aa:	57                   	push   %edi
+  8000ab:	56                   	push   %esi
+  8000ac:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8000ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000b2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000b5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000b8:	89 c3                	mov    %eax,%ebx
+  8000ba:	89 c7                	mov    %eax,%edi
+  8000bc:	89 c6                	mov    %eax,%esi
+  8000be:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  8000c0:	5b                   	pop    %ebx
+  8000c1:	5e                   	pop    %esi
+  8000c2:	5f                   	pop    %edi
+  8000c3:	5d                   	pop    %ebp
+  8000c4:	c3                   	ret
+
+008000c5 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  8000c5:	55                   	push   %ebp
+  8000c6:	89 e5                	mov    %esp,%ebp
+  8000c8:	57                   	push   %edi
+  8000c9:	56                   	push   %esi
+  8000ca:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8000cb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000d0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000d5:	89 d1                	mov    %edx,%ecx
+  8000d7:	89 d3                	mov    %edx,%ebx
+  8000d9:	89 d7                	mov    %edx,%edi
+  8000db:	89 d6                	mov    %edx,%esi
+  8000dd:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  8000df:	5b                   	pop    %ebx
+  8000e0:	5e                   	pop    %esi
+  8000e1:	5f                   	pop    %edi
+  8000e2:	5d                   	pop    %ebp
+  8000e3:	c3                   	ret
+
+008000e4 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8000e4:	55                   	push   %ebp
+  8000e5:	89 e5                	mov    %esp,%ebp
+  8000e7:	57                   	push   %edi
+  8000e8:	56                   	push   %esi
+  8000e9:	53                   	push   %ebx
+  8000ea:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8000ed:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000f2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000f5:	b8 03 00 00 00       	mov    $0x3,%eax
+  8000fa:	89 cb                	mov    %ecx,%ebx
+  8000fc:	89 cf                	mov    %ecx,%edi
+  8000fe:	89 ce                	mov    %ecx,%esi
+  800100:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800102:	85 c0                	test   %eax,%eax
+  800104:	7f 08                	jg     80010e <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800106:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800109:	5b                   	pop    %ebx
+  80010a:	5e                   	pop    %esi
+  80010b:	5f                   	pop    %edi
+  80010c:	5d                   	pop    %ebp
+  80010d:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80010e:	83 ec 0c             	sub    $0xc,%esp
+  800111:	50                   	push   %eax
+  800112:	6a 03                	push   $0x3
+  800114:	68 6a 2e 80 00       	push   $0x802e6a
+  800119:	6a 23                	push   $0x23
+  80011b:	68 87 2e 80 00       	push   $0x802e87
+  800120:	e8 41 1f 00 00       	call   802066 <_panic>
+
+00800125 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800125:	55                   	push   %ebp
+  800126:	89 e5                	mov    %esp,%ebp
+  800128:	57                   	push   %edi
+  800129:	56                   	push   %esi
+  80012a:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80012b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800130:	b8 02 00 00 00       	mov    $0x2,%eax
+  800135:	89 d1                	mov    %edx,%ecx
+  800137:	89 d3                	mov    %edx,%ebx
+  800139:	89 d7                	mov    %edx,%edi
+  80013b:	89 d6                	mov    %edx,%esi
+  80013d:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  80013f:	5b                   	pop    %ebx
+  800140:	5e                   	pop    %esi
+  800141:	5f                   	pop    %edi
+  800142:	5d                   	pop    %ebp
+  800143:	c3                   	ret
+
+00800144 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800144:	55                   	push   %ebp
+  800145:	89 e5                	mov    %esp,%ebp
+  800147:	57                   	push   %edi
+  800148:	56                   	push   %esi
+  800149:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80014a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80014f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800154:	89 d1                	mov    %edx,%ecx
+  800156:	89 d3                	mov    %edx,%ebx
+  800158:	89 d7                	mov    %edx,%edi
+  80015a:	89 d6                	mov    %edx,%esi
+  80015c:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  80015e:	5b                   	pop    %ebx
+  80015f:	5e                   	pop    %esi
+  800160:	5f                   	pop    %edi
+  800161:	5d                   	pop    %ebp
+  800162:	c3                   	ret
+
+00800163 <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  800163:	55                   	push   %ebp
+  800164:	89 e5                	mov    %esp,%ebp
+  800166:	57                   	push   %edi
+  800167:	56                   	push   %esi
+  800168:	53                   	push   %ebx
+  800169:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  80016c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  800170:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800175:	8b 55 08             	mov    0x8(%ebp),%edx
+  800178:	b8 14 00 00 00       	mov    $0x14,%eax
+  80017d:	89 df                	mov    %ebx,%edi
+  80017f:	89 de                	mov    %ebx,%esi
+  800181:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800183:	85 c0                	test   %eax,%eax
+  800185:	7f 08                	jg     80018f <sys_env_set_cow+0x2c>
+}
+  800187:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80018a:	5b                   	pop    %ebx
+  80018b:	5e                   	pop    %esi
+  80018c:	5f                   	pop    %edi
+  80018d:	5d                   	pop    %ebp
+  80018e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80018f:	83 ec 0c             	sub    $0xc,%esp
+  800192:	50                   	push   %eax
+  800193:	6a 14                	push   $0x14
+  800195:	68 6a 2e 80 00       	push   $0x802e6a
+  80019a:	6a 23                	push   $0x23
+  80019c:	68 87 2e 80 00       	push   $0x802e87
+  8001a1:	e8 c0 1e 00 00       	call   802066 <_panic>
+
+008001a6 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8001a6:	55                   	push   %ebp
+  8001a7:	89 e5                	mov    %esp,%ebp
+  8001a9:	57                   	push   %edi
+  8001aa:	56                   	push   %esi
+  8001ab:	53                   	push   %ebx
+  8001ac:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8001af:	be 00 00 00 00       	mov    $0x0,%esi
+  8001b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001ba:	b8 04 00 00 00       	mov    $0x4,%eax
+  8001bf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001c2:	89 f7                	mov    %esi,%edi
+  8001c4:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8001c6:	85 c0                	test   %eax,%eax
+  8001c8:	7f 08                	jg     8001d2 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  8001ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001cd:	5b                   	pop    %ebx
+  8001ce:	5e                   	pop    %esi
+  8001cf:	5f                   	pop    %edi
+  8001d0:	5d                   	pop    %ebp
+  8001d1:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8001d2:	83 ec 0c             	sub    $0xc,%esp
+  8001d5:	50                   	push   %eax
+  8001d6:	6a 04                	push   $0x4
+  8001d8:	68 6a 2e 80 00       	push   $0x802e6a
+  8001dd:	6a 23                	push   $0x23
+  8001df:	68 87 2e 80 00       	push   $0x802e87
+  8001e4:	e8 7d 1e 00 00       	call   802066 <_panic>
+
+008001e9 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8001e9:	55                   	push   %ebp
+  8001ea:	89 e5                	mov    %esp,%ebp
+  8001ec:	57                   	push   %edi
+  8001ed:	56                   	push   %esi
+  8001ee:	53                   	push   %ebx
+  8001ef:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8001f2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001f5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001f8:	b8 05 00 00 00       	mov    $0x5,%eax
+  8001fd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800200:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800203:	8b 75 18             	mov    0x18(%ebp),%esi
+  800206:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800208:	85 c0                	test   %eax,%eax
+  80020a:	7f 08                	jg     800214 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  80020c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80020f:	5b                   	pop    %ebx
+  800210:	5e                   	pop    %esi
+  800211:	5f                   	pop    %edi
+  800212:	5d                   	pop    %ebp
+  800213:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800214:	83 ec 0c             	sub    $0xc,%esp
+  800217:	50                   	push   %eax
+  800218:	6a 05                	push   $0x5
+  80021a:	68 6a 2e 80 00       	push   $0x802e6a
+  80021f:	6a 23                	push   $0x23
+  800221:	68 87 2e 80 00       	push   $0x802e87
+  800226:	e8 3b 1e 00 00       	call   802066 <_panic>
+
+0080022b <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  80022b:	55                   	push   %ebp
+  80022c:	89 e5                	mov    %esp,%ebp
+  80022e:	57                   	push   %edi
+  80022f:	56                   	push   %esi
+  800230:	53                   	push   %ebx
+  800231:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800234:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800239:	8b 55 08             	mov    0x8(%ebp),%edx
+  80023c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80023f:	b8 06 00 00 00       	mov    $0x6,%eax
+  800244:	89 df                	mov    %ebx,%edi
+  800246:	89 de                	mov    %ebx,%esi
+  800248:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80024a:	85 c0                	test   %eax,%eax
+  80024c:	7f 08                	jg     800256 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  80024e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800251:	5b                   	pop    %ebx
+  800252:	5e                   	pop    %esi
+  800253:	5f                   	pop    %edi
+  800254:	5d                   	pop    %ebp
+  800255:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800256:	83 ec 0c             	sub    $0xc,%esp
+  800259:	50                   	push   %eax
+  80025a:	6a 06                	push   $0x6
+  80025c:	68 6a 2e 80 00       	push   $0x802e6a
+  800261:	6a 23                	push   $0x23
+  800263:	68 87 2e 80 00       	push   $0x802e87
+  800268:	e8 f9 1d 00 00       	call   802066 <_panic>
+
+0080026d <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  80026d:	55                   	push   %ebp
+  80026e:	89 e5                	mov    %esp,%ebp
+  800270:	57                   	push   %edi
+  800271:	56                   	push   %esi
+  800272:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800273:	8b 55 08             	mov    0x8(%ebp),%edx
+  800276:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800279:	b8 11 00 00 00       	mov    $0x11,%eax
+  80027e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800281:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800284:	8b 75 18             	mov    0x18(%ebp),%esi
+  800287:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  800289:	5b                   	pop    %ebx
+  80028a:	5e                   	pop    %esi
+  80028b:	5f                   	pop    %edi
+  80028c:	5d                   	pop    %ebp
+  80028d:	c3                   	ret
+
+0080028e <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  80028e:	55                   	push   %ebp
+  80028f:	89 e5                	mov    %esp,%ebp
+  800291:	57                   	push   %edi
+  800292:	56                   	push   %esi
+  800293:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800294:	8b 55 08             	mov    0x8(%ebp),%edx
+  800297:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80029a:	b8 12 00 00 00       	mov    $0x12,%eax
+  80029f:	be 00 00 00 00       	mov    $0x0,%esi
+  8002a4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8002a7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8002aa:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  8002ac:	5b                   	pop    %ebx
+  8002ad:	5e                   	pop    %esi
+  8002ae:	5f                   	pop    %edi
+  8002af:	5d                   	pop    %ebp
+  8002b0:	c3                   	ret
+
+008002b1 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  8002b1:	55                   	push   %ebp
+  8002b2:	89 e5                	mov    %esp,%ebp
+  8002b4:	57                   	push   %edi
+  8002b5:	56                   	push   %esi
+  8002b6:	53                   	push   %ebx
+  8002b7:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8002ba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002c2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002c5:	b8 16 00 00 00       	mov    $0x16,%eax
+  8002ca:	89 df                	mov    %ebx,%edi
+  8002cc:	89 de                	mov    %ebx,%esi
+  8002ce:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8002d0:	85 c0                	test   %eax,%eax
+  8002d2:	7f 08                	jg     8002dc <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  8002d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002d7:	5b                   	pop    %ebx
+  8002d8:	5e                   	pop    %esi
+  8002d9:	5f                   	pop    %edi
+  8002da:	5d                   	pop    %ebp
+  8002db:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8002dc:	83 ec 0c             	sub    $0xc,%esp
+  8002df:	50                   	push   %eax
+  8002e0:	6a 16                	push   $0x16
+  8002e2:	68 6a 2e 80 00       	push   $0x802e6a
+  8002e7:	6a 23                	push   $0x23
+  8002e9:	68 87 2e 80 00       	push   $0x802e87
+  8002ee:	e8 73 1d 00 00       	call   802066 <_panic>
+
+008002f3 <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  8002f3:	55                   	push   %ebp
+  8002f4:	89 e5                	mov    %esp,%ebp
+  8002f6:	57                   	push   %edi
+  8002f7:	56                   	push   %esi
+  8002f8:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8002f9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8002fe:	8b 55 08             	mov    0x8(%ebp),%edx
+  800301:	b8 17 00 00 00       	mov    $0x17,%eax
+  800306:	89 cb                	mov    %ecx,%ebx
+  800308:	89 cf                	mov    %ecx,%edi
+  80030a:	89 ce                	mov    %ecx,%esi
+  80030c:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  80030e:	5b                   	pop    %ebx
+  80030f:	5e                   	pop    %esi
+  800310:	5f                   	pop    %edi
+  800311:	5d                   	pop    %ebp
+  800312:	c3                   	ret
+
+00800313 <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  800313:	55                   	push   %ebp
+  800314:	89 e5                	mov    %esp,%ebp
+  800316:	57                   	push   %edi
+  800317:	56                   	push   %esi
+  800318:	53                   	push   %ebx
+  800319:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80031c:	be 00 00 00 00       	mov    $0x0,%esi
+  800321:	8b 55 08             	mov    0x8(%ebp),%edx
+  800324:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800327:	b8 18 00 00 00       	mov    $0x18,%eax
+  80032c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80032f:	89 f7                	mov    %esi,%edi
+  800331:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800333:	85 c0                	test   %eax,%eax
+  800335:	7f 08                	jg     80033f <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  800337:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80033a:	5b                   	pop    %ebx
+  80033b:	5e                   	pop    %esi
+  80033c:	5f                   	pop    %edi
+  80033d:	5d                   	pop    %ebp
+  80033e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80033f:	83 ec 0c             	sub    $0xc,%esp
+  800342:	50                   	push   %eax
+  800343:	6a 18                	push   $0x18
+  800345:	68 6a 2e 80 00       	push   $0x802e6a
+  80034a:	6a 23                	push   $0x23
+  80034c:	68 87 2e 80 00       	push   $0x802e87
+  800351:	e8 10 1d 00 00       	call   802066 <_panic>
+
+00800356 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  800356:	55                   	push   %ebp
+  800357:	89 e5                	mov    %esp,%ebp
+  800359:	57                   	push   %edi
+  80035a:	56                   	push   %esi
+  80035b:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80035c:	be 00 00 00 00       	mov    $0x0,%esi
+  800361:	8b 55 08             	mov    0x8(%ebp),%edx
+  800364:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800367:	b8 19 00 00 00       	mov    $0x19,%eax
+  80036c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80036f:	89 f7                	mov    %esi,%edi
+  800371:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  800373:	5b                   	pop    %ebx
+  800374:	5e                   	pop    %esi
+  800375:	5f                   	pop    %edi
+  800376:	5d                   	pop    %ebp
+  800377:	c3                   	ret
+
+00800378 <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  800378:	55                   	push   %ebp
+  800379:	89 e5                	mov    %esp,%ebp
+  80037b:	57                   	push   %edi
+  80037c:	56                   	push   %esi
+  80037d:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80037e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800383:	b8 15 00 00 00       	mov    $0x15,%eax
+  800388:	89 d1                	mov    %edx,%ecx
+  80038a:	89 d3                	mov    %edx,%ebx
+  80038c:	89 d7                	mov    %edx,%edi
+  80038e:	89 d6                	mov    %edx,%esi
+  800390:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800392:	5b                   	pop    %ebx
+  800393:	5e                   	pop    %esi
+  800394:	5f                   	pop    %edi
+  800395:	5d                   	pop    %ebp
+  800396:	c3                   	ret
+
+00800397 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800397:	55                   	push   %ebp
+  800398:	89 e5                	mov    %esp,%ebp
+  80039a:	57                   	push   %edi
+  80039b:	56                   	push   %esi
+  80039c:	53                   	push   %ebx
+  80039d:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8003a0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003a8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003ab:	b8 08 00 00 00       	mov    $0x8,%eax
+  8003b0:	89 df                	mov    %ebx,%edi
+  8003b2:	89 de                	mov    %ebx,%esi
+  8003b4:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8003b6:	85 c0                	test   %eax,%eax
+  8003b8:	7f 08                	jg     8003c2 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8003ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003bd:	5b                   	pop    %ebx
+  8003be:	5e                   	pop    %esi
+  8003bf:	5f                   	pop    %edi
+  8003c0:	5d                   	pop    %ebp
+  8003c1:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8003c2:	83 ec 0c             	sub    $0xc,%esp
+  8003c5:	50                   	push   %eax
+  8003c6:	6a 08                	push   $0x8
+  8003c8:	68 6a 2e 80 00       	push   $0x802e6a
+  8003cd:	6a 23                	push   $0x23
+  8003cf:	68 87 2e 80 00       	push   $0x802e87
+  8003d4:	e8 8d 1c 00 00       	call   802066 <_panic>
+
+008003d9 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8003d9:	55                   	push   %ebp
+  8003da:	89 e5                	mov    %esp,%ebp
+  8003dc:	57                   	push   %edi
+  8003dd:	56                   	push   %esi
+  8003de:	53                   	push   %ebx
+  8003df:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8003e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003e7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003ea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003ed:	b8 09 00 00 00       	mov    $0x9,%eax
+  8003f2:	89 df                	mov    %ebx,%edi
+  8003f4:	89 de                	mov    %ebx,%esi
+  8003f6:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8003f8:	85 c0                	test   %eax,%eax
+  8003fa:	7f 08                	jg     800404 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  8003fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003ff:	5b                   	pop    %ebx
+  800400:	5e                   	pop    %esi
+  800401:	5f                   	pop    %edi
+  800402:	5d                   	pop    %ebp
+  800403:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800404:	83 ec 0c             	sub    $0xc,%esp
+  800407:	50                   	push   %eax
+  800408:	6a 09                	push   $0x9
+  80040a:	68 6a 2e 80 00       	push   $0x802e6a
+  80040f:	6a 23                	push   $0x23
+  800411:	68 87 2e 80 00       	push   $0x802e87
+  800416:	e8 4b 1c 00 00       	call   802066 <_panic>
+
+0080041b <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80041b:	55                   	push   %ebp
+  80041c:	89 e5                	mov    %esp,%ebp
+  80041e:	57                   	push   %edi
+  80041f:	56                   	push   %esi
+  800420:	53                   	push   %ebx
+  800421:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800424:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800429:	8b 55 08             	mov    0x8(%ebp),%edx
+  80042c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80042f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800434:	89 df                	mov    %ebx,%edi
+  800436:	89 de                	mov    %ebx,%esi
+  800438:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80043a:	85 c0                	test   %eax,%eax
+  80043c:	7f 08                	jg     800446 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  80043e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800441:	5b                   	pop    %ebx
+  800442:	5e                   	pop    %esi
+  800443:	5f                   	pop    %edi
+  800444:	5d                   	pop    %ebp
+  800445:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800446:	83 ec 0c             	sub    $0xc,%esp
+  800449:	50                   	push   %eax
+  80044a:	6a 0a                	push   $0xa
+  80044c:	68 6a 2e 80 00       	push   $0x802e6a
+  800451:	6a 23                	push   $0x23
+  800453:	68 87 2e 80 00       	push   $0x802e87
+  800458:	e8 09 1c 00 00       	call   802066 <_panic>
+
+0080045d <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  80045d:	55                   	push   %ebp
+  80045e:	89 e5                	mov    %esp,%ebp
+  800460:	57                   	push   %edi
+  800461:	56                   	push   %esi
+  800462:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800463:	8b 55 08             	mov    0x8(%ebp),%edx
+  800466:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800469:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80046e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800471:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800474:	8b 75 18             	mov    0x18(%ebp),%esi
+  800477:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  800479:	5b                   	pop    %ebx
+  80047a:	5e                   	pop    %esi
+  80047b:	5f                   	pop    %edi
+  80047c:	5d                   	pop    %ebp
+  80047d:	c3                   	ret
+
+0080047e <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  80047e:	55                   	push   %ebp
+  80047f:	89 e5                	mov    %esp,%ebp
+  800481:	57                   	push   %edi
+  800482:	56                   	push   %esi
+  800483:	53                   	push   %ebx
+  800484:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800487:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80048c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80048f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800492:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800497:	89 df                	mov    %ebx,%edi
+  800499:	89 de                	mov    %ebx,%esi
+  80049b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80049d:	85 c0                	test   %eax,%eax
+  80049f:	7f 08                	jg     8004a9 <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  8004a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004a4:	5b                   	pop    %ebx
+  8004a5:	5e                   	pop    %esi
+  8004a6:	5f                   	pop    %edi
+  8004a7:	5d                   	pop    %ebp
+  8004a8:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8004a9:	83 ec 0c             	sub    $0xc,%esp
+  8004ac:	50                   	push   %eax
+  8004ad:	6a 0d                	push   $0xd
+  8004af:	68 6a 2e 80 00       	push   $0x802e6a
+  8004b4:	6a 23                	push   $0x23
+  8004b6:	68 87 2e 80 00       	push   $0x802e87
+  8004bb:	e8 a6 1b 00 00       	call   802066 <_panic>
+
+008004c0 <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  8004c0:	55                   	push   %ebp
+  8004c1:	89 e5                	mov    %esp,%ebp
+  8004c3:	57                   	push   %edi
+  8004c4:	56                   	push   %esi
+  8004c5:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8004c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004cb:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8004d0:	89 d1                	mov    %edx,%ecx
+  8004d2:	89 d3                	mov    %edx,%ebx
+  8004d4:	89 d7                	mov    %edx,%edi
+  8004d6:	89 d6                	mov    %edx,%esi
+  8004d8:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8004da:	5b                   	pop    %ebx
+  8004db:	5e                   	pop    %esi
+  8004dc:	5f                   	pop    %edi
+  8004dd:	5d                   	pop    %ebp
+  8004de:	c3                   	ret
+
+008004df <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  8004df:	55                   	push   %ebp
+  8004e0:	89 e5                	mov    %esp,%ebp
+  8004e2:	57                   	push   %edi
+  8004e3:	56                   	push   %esi
+  8004e4:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8004e5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004e8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004eb:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8004f0:	be 00 00 00 00       	mov    $0x0,%esi
+  8004f5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8004f8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8004fb:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  8004fd:	5b                   	pop    %ebx
+  8004fe:	5e                   	pop    %esi
+  8004ff:	5f                   	pop    %edi
+  800500:	5d                   	pop    %ebp
+  800501:	c3                   	ret
+
+00800502 <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  800502:	55                   	push   %ebp
+  800503:	89 e5                	mov    %esp,%ebp
+  800505:	57                   	push   %edi
+  800506:	56                   	push   %esi
+  800507:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800508:	be 00 00 00 00       	mov    $0x0,%esi
+  80050d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800510:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800513:	b8 10 00 00 00       	mov    $0x10,%eax
+  800518:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80051b:	89 f7                	mov    %esi,%edi
+  80051d:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  80051f:	5b                   	pop    %ebx
+  800520:	5e                   	pop    %esi
+  800521:	5f                   	pop    %edi
+  800522:	5d                   	pop    %ebp
+  800523:	c3                   	ret
+
+00800524 <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  800524:	55                   	push   %ebp
+  800525:	89 e5                	mov    %esp,%ebp
+  800527:	57                   	push   %edi
+  800528:	56                   	push   %esi
+  800529:	53                   	push   %ebx
+  80052a:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  80052d:	80 3d 48 57 80 00 00 	cmpb   $0x0,0x805748
+  800534:	74 41                	je     800577 <sys_batch+0x53>
+  800536:	8b 45 08             	mov    0x8(%ebp),%eax
+  800539:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  80053c:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  800543:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800546:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  800549:	7d 45                	jge    800590 <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  80054b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80054e:	8b 06                	mov    (%esi),%eax
+  800550:	8b 56 04             	mov    0x4(%esi),%edx
+  800553:	8b 4e 08             	mov    0x8(%esi),%ecx
+  800556:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  800559:	8b 7e 10             	mov    0x10(%esi),%edi
+  80055c:	8b 76 14             	mov    0x14(%esi),%esi
+  80055f:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  800561:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800564:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  800567:	83 c6 1c             	add    $0x1c,%esi
+  80056a:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  80056d:	85 c0                	test   %eax,%eax
+  80056f:	78 1f                	js     800590 <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  800571:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  800575:	eb cc                	jmp    800543 <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  800577:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80057c:	b8 13 00 00 00       	mov    $0x13,%eax
+  800581:	8b 55 08             	mov    0x8(%ebp),%edx
+  800584:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800587:	89 df                	mov    %ebx,%edi
+  800589:	89 de                	mov    %ebx,%esi
+  80058b:	cd 30                	int    $0x30
+  80058d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  800590:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800593:	83 c4 08             	add    $0x8,%esp
+  800596:	5b                   	pop    %ebx
+  800597:	5e                   	pop    %esi
+  800598:	5f                   	pop    %edi
+  800599:	5d                   	pop    %ebp
+  80059a:	c3                   	ret
+
+0080059b <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  80059b:	55                   	push   %ebp
+  80059c:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  80059e:	8b 45 08             	mov    0x8(%ebp),%eax
+  8005a1:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8005a7:	5d                   	pop    %ebp
+  8005a8:	c3                   	ret
+
+008005a9 <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  8005a9:	55                   	push   %ebp
+  8005aa:	89 e5                	mov    %esp,%ebp
+  8005ac:	56                   	push   %esi
+  8005ad:	53                   	push   %ebx
+  8005ae:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  8005b1:	8b 1e                	mov    (%esi),%ebx
+  8005b3:	85 db                	test   %ebx,%ebx
+  8005b5:	75 09                	jne    8005c0 <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  8005b7:	89 d8                	mov    %ebx,%eax
+  8005b9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8005bc:	5b                   	pop    %ebx
+  8005bd:	5e                   	pop    %esi
+  8005be:	5d                   	pop    %ebp
+  8005bf:	c3                   	ret
+  b->sb_n = 0;
+  8005c0:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  8005c6:	53                   	push   %ebx
+  8005c7:	8d 46 04             	lea    0x4(%esi),%eax
+  8005ca:	50                   	push   %eax
+  8005cb:	e8 54 ff ff ff       	call   800524 <sys_batch>
+  8005d0:	83 c4 08             	add    $0x8,%esp
+  8005d3:	85 c0                	test   %eax,%eax
+  8005d5:	78 1e                	js     8005f5 <sysbatch_flush+0x4c>
+  if (r < n)
+  8005d7:	39 c3                	cmp    %eax,%ebx
+  8005d9:	7f 07                	jg     8005e2 <sysbatch_flush+0x39>
+  return 0;
+  8005db:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005e0:	eb d5                	jmp    8005b7 <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  8005e2:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8005e5:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  8005e9:	85 db                	test   %ebx,%ebx
+  8005eb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8005f0:	0f 49 d8             	cmovns %eax,%ebx
+  8005f3:	eb c2                	jmp    8005b7 <sysbatch_flush+0xe>
+    return r;
+  8005f5:	89 c3                	mov    %eax,%ebx
+  8005f7:	eb be                	jmp    8005b7 <sysbatch_flush+0xe>
+
+008005f9 <sysbatch_add>:
+{
+  8005f9:	55                   	push   %ebp
+  8005fa:	89 e5                	mov    %esp,%ebp
+  8005fc:	53                   	push   %ebx
+  8005fd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  800600:	83 3b 40             	cmpl   $0x40,(%ebx)
+  800603:	74 41                	je     800646 <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  800605:	8b 03                	mov    (%ebx),%eax
+  800607:	8d 50 01             	lea    0x1(%eax),%edx
+  80060a:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  80060c:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80060f:	01 d8                	add    %ebx,%eax
+  800611:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800614:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  800617:	8b 55 10             	mov    0x10(%ebp),%edx
+  80061a:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  80061d:	8b 55 14             	mov    0x14(%ebp),%edx
+  800620:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  800623:	8b 55 18             	mov    0x18(%ebp),%edx
+  800626:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  800629:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  80062c:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  80062f:	8b 55 20             	mov    0x20(%ebp),%edx
+  800632:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  800635:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  80063c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800641:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800644:	c9                   	leave
+  800645:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  800646:	53                   	push   %ebx
+  800647:	e8 5d ff ff ff       	call   8005a9 <sysbatch_flush>
+  80064c:	83 c4 04             	add    $0x4,%esp
+  80064f:	85 c0                	test   %eax,%eax
+  800651:	79 b2                	jns    800605 <sysbatch_add+0xc>
+  800653:	eb ec                	jmp    800641 <sysbatch_add+0x48>
+
+00800655 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800655:	55                   	push   %ebp
+  800656:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  800658:	8b 45 08             	mov    0x8(%ebp),%eax
+  80065b:	05 00 00 00 30       	add    $0x30000000,%eax
+  800660:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800663:	5d                   	pop    %ebp
+  800664:	c3                   	ret
+
+00800665 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800665:	55                   	push   %ebp
+  800666:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  800668:	8b 45 08             	mov    0x8(%ebp),%eax
+  80066b:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  80066e:	66 b8 00 00          	mov    $0x0,%ax
+  800672:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  800677:	5d                   	pop    %ebp
+  800678:	c3                   	ret
+
+00800679 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800679:	55                   	push   %ebp
+  80067a:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  80067c:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  800681:	eb 02                	jmp    800685 <fd_alloc+0xc>
+  800683:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800685:	89 c2                	mov    %eax,%edx
+  800687:	c1 ea 16             	shr    $0x16,%edx
+  80068a:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800691:	f6 c2 01             	test   $0x1,%dl
+  800694:	74 2b                	je     8006c1 <fd_alloc+0x48>
+  800696:	89 c2                	mov    %eax,%edx
+  800698:	c1 ea 0c             	shr    $0xc,%edx
+  80069b:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8006a2:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8006a8:	f6 c1 01             	test   $0x1,%cl
+  8006ab:	74 14                	je     8006c1 <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  8006ad:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8006b3:	75 ce                	jne    800683 <fd_alloc+0xa>
+  8006b5:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  8006ba:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8006bf:	eb 05                	jmp    8006c6 <fd_alloc+0x4d>
+      return 0;
+  8006c1:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  8006c6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006c9:	89 02                	mov    %eax,(%edx)
+}
+  8006cb:	89 c8                	mov    %ecx,%eax
+  8006cd:	5d                   	pop    %ebp
+  8006ce:	c3                   	ret
+
+008006cf <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8006cf:	55                   	push   %ebp
+  8006d0:	89 e5                	mov    %esp,%ebp
+  8006d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  8006d5:	83 f8 1f             	cmp    $0x1f,%eax
+  8006d8:	77 30                	ja     80070a <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  8006da:	c1 e0 0c             	shl    $0xc,%eax
+  8006dd:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8006e2:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8006e8:	f6 c2 01             	test   $0x1,%dl
+  8006eb:	74 24                	je     800711 <fd_lookup+0x42>
+  8006ed:	89 c2                	mov    %eax,%edx
+  8006ef:	c1 ea 0c             	shr    $0xc,%edx
+  8006f2:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8006f9:	f6 c2 01             	test   $0x1,%dl
+  8006fc:	74 1a                	je     800718 <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  8006fe:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800701:	89 02                	mov    %eax,(%edx)
+  return 0;
+  800703:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800708:	5d                   	pop    %ebp
+  800709:	c3                   	ret
+    return -E_INVAL;
+  80070a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80070f:	eb f7                	jmp    800708 <fd_lookup+0x39>
+    return -E_INVAL;
+  800711:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800716:	eb f0                	jmp    800708 <fd_lookup+0x39>
+  800718:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80071d:	eb e9                	jmp    800708 <fd_lookup+0x39>
+
+0080071f <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80071f:	55                   	push   %ebp
+  800720:	89 e5                	mov    %esp,%ebp
+  800722:	53                   	push   %ebx
+  800723:	83 ec 04             	sub    $0x4,%esp
+  800726:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  800729:	b8 14 2f 80 00       	mov    $0x802f14,%eax
+  80072e:	8b 18                	mov    (%eax),%ebx
+  800730:	85 db                	test   %ebx,%ebx
+  800732:	74 0e                	je     800742 <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  800734:	83 c0 04             	add    $0x4,%eax
+  800737:	39 13                	cmp    %edx,(%ebx)
+  800739:	75 f3                	jne    80072e <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  80073b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800740:	eb 1f                	jmp    800761 <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800742:	a1 44 57 80 00       	mov    0x805744,%eax
+  800747:	8b 40 48             	mov    0x48(%eax),%eax
+  80074a:	83 ec 04             	sub    $0x4,%esp
+  80074d:	52                   	push   %edx
+  80074e:	50                   	push   %eax
+  80074f:	68 98 2e 80 00       	push   $0x802e98
+  800754:	e8 e8 19 00 00       	call   802141 <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  800759:	83 c4 10             	add    $0x10,%esp
+  80075c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  800761:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800764:	89 1a                	mov    %ebx,(%edx)
+}
+  800766:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800769:	c9                   	leave
+  80076a:	c3                   	ret
+
+0080076b <fd_close>:
+{
+  80076b:	55                   	push   %ebp
+  80076c:	89 e5                	mov    %esp,%ebp
+  80076e:	57                   	push   %edi
+  80076f:	56                   	push   %esi
+  800770:	53                   	push   %ebx
+  800771:	83 ec 24             	sub    $0x24,%esp
+  800774:	8b 75 08             	mov    0x8(%ebp),%esi
+  800777:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80077a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80077d:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80077e:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800784:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800787:	50                   	push   %eax
+  800788:	e8 42 ff ff ff       	call   8006cf <fd_lookup>
+  80078d:	89 c3                	mov    %eax,%ebx
+  80078f:	83 c4 10             	add    $0x10,%esp
+  800792:	85 c0                	test   %eax,%eax
+  800794:	78 05                	js     80079b <fd_close+0x30>
+      || fd != fd2)
+  800796:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  800799:	74 16                	je     8007b1 <fd_close+0x46>
+    return must_exist ? r : 0;
+  80079b:	89 f8                	mov    %edi,%eax
+  80079d:	84 c0                	test   %al,%al
+  80079f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007a4:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8007a7:	89 d8                	mov    %ebx,%eax
+  8007a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007ac:	5b                   	pop    %ebx
+  8007ad:	5e                   	pop    %esi
+  8007ae:	5f                   	pop    %edi
+  8007af:	5d                   	pop    %ebp
+  8007b0:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8007b1:	83 ec 08             	sub    $0x8,%esp
+  8007b4:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8007b7:	50                   	push   %eax
+  8007b8:	ff 36                	push   (%esi)
+  8007ba:	e8 60 ff ff ff       	call   80071f <dev_lookup>
+  8007bf:	89 c3                	mov    %eax,%ebx
+  8007c1:	83 c4 10             	add    $0x10,%esp
+  8007c4:	85 c0                	test   %eax,%eax
+  8007c6:	78 1a                	js     8007e2 <fd_close+0x77>
+    if (dev->dev_close)
+  8007c8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8007cb:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  8007ce:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  8007d3:	85 c0                	test   %eax,%eax
+  8007d5:	74 0b                	je     8007e2 <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  8007d7:	83 ec 0c             	sub    $0xc,%esp
+  8007da:	56                   	push   %esi
+  8007db:	ff d0                	call   *%eax
+  8007dd:	89 c3                	mov    %eax,%ebx
+  8007df:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  8007e2:	83 ec 08             	sub    $0x8,%esp
+  8007e5:	56                   	push   %esi
+  8007e6:	6a 00                	push   $0x0
+  8007e8:	e8 3e fa ff ff       	call   80022b <sys_page_unmap>
+  return r;
+  8007ed:	83 c4 10             	add    $0x10,%esp
+  8007f0:	eb b5                	jmp    8007a7 <fd_close+0x3c>
+
+008007f2 <close>:
+
+int
+close(int fdnum)
+{
+  8007f2:	55                   	push   %ebp
+  8007f3:	89 e5                	mov    %esp,%ebp
+  8007f5:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8007f8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8007fb:	50                   	push   %eax
+  8007fc:	ff 75 08             	push   0x8(%ebp)
+  8007ff:	e8 cb fe ff ff       	call   8006cf <fd_lookup>
+  800804:	83 c4 10             	add    $0x10,%esp
+  800807:	85 c0                	test   %eax,%eax
+  800809:	79 02                	jns    80080d <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  80080b:	c9                   	leave
+  80080c:	c3                   	ret
+    return fd_close(fd, 1);
+  80080d:	83 ec 08             	sub    $0x8,%esp
+  800810:	6a 01                	push   $0x1
+  800812:	ff 75 f4             	push   -0xc(%ebp)
+  800815:	e8 51 ff ff ff       	call   80076b <fd_close>
+  80081a:	83 c4 10             	add    $0x10,%esp
+  80081d:	eb ec                	jmp    80080b <close+0x19>
+
+0080081f <close_all>:
+
+void
+close_all(void)
+{
+  80081f:	55                   	push   %ebp
+  800820:	89 e5                	mov    %esp,%ebp
+  800822:	53                   	push   %ebx
+  800823:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  800826:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  80082b:	83 ec 0c             	sub    $0xc,%esp
+  80082e:	53                   	push   %ebx
+  80082f:	e8 be ff ff ff       	call   8007f2 <close>
+  for (i = 0; i < MAXFD; i++)
+  800834:	83 c3 01             	add    $0x1,%ebx
+  800837:	83 c4 10             	add    $0x10,%esp
+  80083a:	83 fb 20             	cmp    $0x20,%ebx
+  80083d:	75 ec                	jne    80082b <close_all+0xc>
+}
+  80083f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800842:	c9                   	leave
+  800843:	c3                   	ret
+
+00800844 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  800844:	55                   	push   %ebp
+  800845:	89 e5                	mov    %esp,%ebp
+  800847:	57                   	push   %edi
+  800848:	56                   	push   %esi
+  800849:	53                   	push   %ebx
+  80084a:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80084d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800850:	50                   	push   %eax
+  800851:	ff 75 08             	push   0x8(%ebp)
+  800854:	e8 76 fe ff ff       	call   8006cf <fd_lookup>
+  800859:	89 c6                	mov    %eax,%esi
+  80085b:	83 c4 10             	add    $0x10,%esp
+  80085e:	85 c0                	test   %eax,%eax
+  800860:	0f 88 0a 01 00 00    	js     800970 <dup+0x12c>
+    return r;
+  close(newfdnum);
+  800866:	83 ec 0c             	sub    $0xc,%esp
+  800869:	ff 75 0c             	push   0xc(%ebp)
+  80086c:	e8 81 ff ff ff       	call   8007f2 <close>
+
+  newfd = INDEX2FD(newfdnum);
+  800871:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800874:	c1 e0 0c             	shl    $0xc,%eax
+  800877:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  80087d:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  800880:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800883:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800886:	89 04 24             	mov    %eax,(%esp)
+  800889:	e8 d7 fd ff ff       	call   800665 <fd2data>
+  80088e:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  800890:	89 3c 24             	mov    %edi,(%esp)
+  800893:	e8 cd fd ff ff       	call   800665 <fd2data>
+  800898:	83 c4 10             	add    $0x10,%esp
+  80089b:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80089e:	89 f3                	mov    %esi,%ebx
+  8008a0:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  8008a6:	89 c6                	mov    %eax,%esi
+  8008a8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8008ab:	89 cf                	mov    %ecx,%edi
+  8008ad:	eb 0c                	jmp    8008bb <dup+0x77>
+  8008af:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8008b5:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8008bb:	39 fb                	cmp    %edi,%ebx
+  8008bd:	74 7b                	je     80093a <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  8008bf:	89 d8                	mov    %ebx,%eax
+  8008c1:	c1 e8 16             	shr    $0x16,%eax
+  8008c4:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8008cb:	a8 01                	test   $0x1,%al
+  8008cd:	74 e0                	je     8008af <dup+0x6b>
+  8008cf:	89 d8                	mov    %ebx,%eax
+  8008d1:	c1 e8 0c             	shr    $0xc,%eax
+  8008d4:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8008db:	f6 c2 01             	test   $0x1,%dl
+  8008de:	74 cf                	je     8008af <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  8008e0:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  8008e7:	83 ec 0c             	sub    $0xc,%esp
+  8008ea:	25 07 0e 00 00       	and    $0xe07,%eax
+  8008ef:	50                   	push   %eax
+  8008f0:	56                   	push   %esi
+  8008f1:	6a 00                	push   $0x0
+  8008f3:	53                   	push   %ebx
+  8008f4:	6a 00                	push   $0x0
+  8008f6:	e8 ee f8 ff ff       	call   8001e9 <sys_page_map>
+  8008fb:	83 c4 20             	add    $0x20,%esp
+  8008fe:	85 c0                	test   %eax,%eax
+  800900:	79 ad                	jns    8008af <dup+0x6b>
+  800902:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800905:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  800907:	83 ec 08             	sub    $0x8,%esp
+  80090a:	ff 75 d4             	push   -0x2c(%ebp)
+  80090d:	6a 00                	push   $0x0
+  80090f:	e8 17 f9 ff ff       	call   80022b <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  800914:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  800917:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  80091d:	83 c4 10             	add    $0x10,%esp
+  800920:	39 df                	cmp    %ebx,%edi
+  800922:	74 4c                	je     800970 <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  800924:	83 ec 08             	sub    $0x8,%esp
+  800927:	57                   	push   %edi
+  800928:	6a 00                	push   $0x0
+  80092a:	e8 fc f8 ff ff       	call   80022b <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80092f:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  800935:	83 c4 10             	add    $0x10,%esp
+  800938:	eb e6                	jmp    800920 <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80093a:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80093d:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800940:	89 c8                	mov    %ecx,%eax
+  800942:	c1 e8 0c             	shr    $0xc,%eax
+  800945:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80094c:	83 ec 0c             	sub    $0xc,%esp
+  80094f:	25 07 0e 00 00       	and    $0xe07,%eax
+  800954:	50                   	push   %eax
+  800955:	ff 75 d4             	push   -0x2c(%ebp)
+  800958:	6a 00                	push   $0x0
+  80095a:	51                   	push   %ecx
+  80095b:	6a 00                	push   $0x0
+  80095d:	e8 87 f8 ff ff       	call   8001e9 <sys_page_map>
+  800962:	89 c6                	mov    %eax,%esi
+  800964:	83 c4 20             	add    $0x20,%esp
+  800967:	85 c0                	test   %eax,%eax
+  800969:	78 9c                	js     800907 <dup+0xc3>
+  return newfdnum;
+  80096b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80096e:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  800970:	89 f0                	mov    %esi,%eax
+  800972:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800975:	5b                   	pop    %ebx
+  800976:	5e                   	pop    %esi
+  800977:	5f                   	pop    %edi
+  800978:	5d                   	pop    %ebp
+  800979:	c3                   	ret
+
+0080097a <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80097a:	55                   	push   %ebp
+  80097b:	89 e5                	mov    %esp,%ebp
+  80097d:	56                   	push   %esi
+  80097e:	53                   	push   %ebx
+  80097f:	83 ec 18             	sub    $0x18,%esp
+  800982:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  800985:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800988:	50                   	push   %eax
+  800989:	56                   	push   %esi
+  80098a:	e8 40 fd ff ff       	call   8006cf <fd_lookup>
+  80098f:	83 c4 10             	add    $0x10,%esp
+  800992:	85 c0                	test   %eax,%eax
+  800994:	78 3c                	js     8009d2 <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800996:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  800999:	83 ec 08             	sub    $0x8,%esp
+  80099c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80099f:	50                   	push   %eax
+  8009a0:	ff 33                	push   (%ebx)
+  8009a2:	e8 78 fd ff ff       	call   80071f <dev_lookup>
+  8009a7:	83 c4 10             	add    $0x10,%esp
+  8009aa:	85 c0                	test   %eax,%eax
+  8009ac:	78 24                	js     8009d2 <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8009ae:	8b 43 08             	mov    0x8(%ebx),%eax
+  8009b1:	83 e0 03             	and    $0x3,%eax
+  8009b4:	83 f8 01             	cmp    $0x1,%eax
+  8009b7:	74 20                	je     8009d9 <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  8009b9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009bc:	8b 40 08             	mov    0x8(%eax),%eax
+  8009bf:	85 c0                	test   %eax,%eax
+  8009c1:	74 37                	je     8009fa <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  8009c3:	83 ec 04             	sub    $0x4,%esp
+  8009c6:	ff 75 10             	push   0x10(%ebp)
+  8009c9:	ff 75 0c             	push   0xc(%ebp)
+  8009cc:	53                   	push   %ebx
+  8009cd:	ff d0                	call   *%eax
+  8009cf:	83 c4 10             	add    $0x10,%esp
+}
+  8009d2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8009d5:	5b                   	pop    %ebx
+  8009d6:	5e                   	pop    %esi
+  8009d7:	5d                   	pop    %ebp
+  8009d8:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8009d9:	a1 44 57 80 00       	mov    0x805744,%eax
+  8009de:	8b 40 48             	mov    0x48(%eax),%eax
+  8009e1:	83 ec 04             	sub    $0x4,%esp
+  8009e4:	56                   	push   %esi
+  8009e5:	50                   	push   %eax
+  8009e6:	68 d9 2e 80 00       	push   $0x802ed9
+  8009eb:	e8 51 17 00 00       	call   802141 <cprintf>
+    return -E_INVAL;
+  8009f0:	83 c4 10             	add    $0x10,%esp
+  8009f3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8009f8:	eb d8                	jmp    8009d2 <read+0x58>
+    return -E_NOT_SUPP;
+  8009fa:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8009ff:	eb d1                	jmp    8009d2 <read+0x58>
+
+00800a01 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  800a01:	55                   	push   %ebp
+  800a02:	89 e5                	mov    %esp,%ebp
+  800a04:	57                   	push   %edi
+  800a05:	56                   	push   %esi
+  800a06:	53                   	push   %ebx
+  800a07:	83 ec 0c             	sub    $0xc,%esp
+  800a0a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a0d:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  800a10:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800a15:	eb 02                	jmp    800a19 <readn+0x18>
+  800a17:	01 c3                	add    %eax,%ebx
+  800a19:	39 f3                	cmp    %esi,%ebx
+  800a1b:	73 21                	jae    800a3e <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  800a1d:	83 ec 04             	sub    $0x4,%esp
+  800a20:	89 f0                	mov    %esi,%eax
+  800a22:	29 d8                	sub    %ebx,%eax
+  800a24:	50                   	push   %eax
+  800a25:	89 d8                	mov    %ebx,%eax
+  800a27:	03 45 0c             	add    0xc(%ebp),%eax
+  800a2a:	50                   	push   %eax
+  800a2b:	57                   	push   %edi
+  800a2c:	e8 49 ff ff ff       	call   80097a <read>
+    if (m < 0)
+  800a31:	83 c4 10             	add    $0x10,%esp
+  800a34:	85 c0                	test   %eax,%eax
+  800a36:	78 04                	js     800a3c <readn+0x3b>
+      return m;
+    if (m == 0)
+  800a38:	75 dd                	jne    800a17 <readn+0x16>
+  800a3a:	eb 02                	jmp    800a3e <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  800a3c:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  800a3e:	89 d8                	mov    %ebx,%eax
+  800a40:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a43:	5b                   	pop    %ebx
+  800a44:	5e                   	pop    %esi
+  800a45:	5f                   	pop    %edi
+  800a46:	5d                   	pop    %ebp
+  800a47:	c3                   	ret
+
+00800a48 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  800a48:	55                   	push   %ebp
+  800a49:	89 e5                	mov    %esp,%ebp
+  800a4b:	56                   	push   %esi
+  800a4c:	53                   	push   %ebx
+  800a4d:	83 ec 18             	sub    $0x18,%esp
+  800a50:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  800a53:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800a56:	50                   	push   %eax
+  800a57:	53                   	push   %ebx
+  800a58:	e8 72 fc ff ff       	call   8006cf <fd_lookup>
+  800a5d:	83 c4 10             	add    $0x10,%esp
+  800a60:	85 c0                	test   %eax,%eax
+  800a62:	78 37                	js     800a9b <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800a64:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800a67:	83 ec 08             	sub    $0x8,%esp
+  800a6a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a6d:	50                   	push   %eax
+  800a6e:	ff 36                	push   (%esi)
+  800a70:	e8 aa fc ff ff       	call   80071f <dev_lookup>
+  800a75:	83 c4 10             	add    $0x10,%esp
+  800a78:	85 c0                	test   %eax,%eax
+  800a7a:	78 1f                	js     800a9b <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800a7c:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800a80:	74 20                	je     800aa2 <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  800a82:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a85:	8b 40 0c             	mov    0xc(%eax),%eax
+  800a88:	85 c0                	test   %eax,%eax
+  800a8a:	74 37                	je     800ac3 <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  800a8c:	83 ec 04             	sub    $0x4,%esp
+  800a8f:	ff 75 10             	push   0x10(%ebp)
+  800a92:	ff 75 0c             	push   0xc(%ebp)
+  800a95:	56                   	push   %esi
+  800a96:	ff d0                	call   *%eax
+  800a98:	83 c4 10             	add    $0x10,%esp
+}
+  800a9b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800a9e:	5b                   	pop    %ebx
+  800a9f:	5e                   	pop    %esi
+  800aa0:	5d                   	pop    %ebp
+  800aa1:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800aa2:	a1 44 57 80 00       	mov    0x805744,%eax
+  800aa7:	8b 40 48             	mov    0x48(%eax),%eax
+  800aaa:	83 ec 04             	sub    $0x4,%esp
+  800aad:	53                   	push   %ebx
+  800aae:	50                   	push   %eax
+  800aaf:	68 f5 2e 80 00       	push   $0x802ef5
+  800ab4:	e8 88 16 00 00       	call   802141 <cprintf>
+    return -E_INVAL;
+  800ab9:	83 c4 10             	add    $0x10,%esp
+  800abc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ac1:	eb d8                	jmp    800a9b <write+0x53>
+    return -E_NOT_SUPP;
+  800ac3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800ac8:	eb d1                	jmp    800a9b <write+0x53>
+
+00800aca <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  800aca:	55                   	push   %ebp
+  800acb:	89 e5                	mov    %esp,%ebp
+  800acd:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800ad0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800ad3:	50                   	push   %eax
+  800ad4:	ff 75 08             	push   0x8(%ebp)
+  800ad7:	e8 f3 fb ff ff       	call   8006cf <fd_lookup>
+  800adc:	83 c4 10             	add    $0x10,%esp
+  800adf:	85 c0                	test   %eax,%eax
+  800ae1:	78 0e                	js     800af1 <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  800ae3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ae6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ae9:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  800aec:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800af1:	c9                   	leave
+  800af2:	c3                   	ret
+
+00800af3 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800af3:	55                   	push   %ebp
+  800af4:	89 e5                	mov    %esp,%ebp
+  800af6:	56                   	push   %esi
+  800af7:	53                   	push   %ebx
+  800af8:	83 ec 18             	sub    $0x18,%esp
+  800afb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  800afe:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800b01:	50                   	push   %eax
+  800b02:	53                   	push   %ebx
+  800b03:	e8 c7 fb ff ff       	call   8006cf <fd_lookup>
+  800b08:	83 c4 10             	add    $0x10,%esp
+  800b0b:	85 c0                	test   %eax,%eax
+  800b0d:	78 34                	js     800b43 <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800b0f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800b12:	83 ec 08             	sub    $0x8,%esp
+  800b15:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b18:	50                   	push   %eax
+  800b19:	ff 36                	push   (%esi)
+  800b1b:	e8 ff fb ff ff       	call   80071f <dev_lookup>
+  800b20:	83 c4 10             	add    $0x10,%esp
+  800b23:	85 c0                	test   %eax,%eax
+  800b25:	78 1c                	js     800b43 <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800b27:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800b2b:	74 1d                	je     800b4a <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  800b2d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b30:	8b 40 18             	mov    0x18(%eax),%eax
+  800b33:	85 c0                	test   %eax,%eax
+  800b35:	74 34                	je     800b6b <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  800b37:	83 ec 08             	sub    $0x8,%esp
+  800b3a:	ff 75 0c             	push   0xc(%ebp)
+  800b3d:	56                   	push   %esi
+  800b3e:	ff d0                	call   *%eax
+  800b40:	83 c4 10             	add    $0x10,%esp
+}
+  800b43:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b46:	5b                   	pop    %ebx
+  800b47:	5e                   	pop    %esi
+  800b48:	5d                   	pop    %ebp
+  800b49:	c3                   	ret
+            thisenv->env_id, fdnum);
+  800b4a:	a1 44 57 80 00       	mov    0x805744,%eax
+  800b4f:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800b52:	83 ec 04             	sub    $0x4,%esp
+  800b55:	53                   	push   %ebx
+  800b56:	50                   	push   %eax
+  800b57:	68 b8 2e 80 00       	push   $0x802eb8
+  800b5c:	e8 e0 15 00 00       	call   802141 <cprintf>
+    return -E_INVAL;
+  800b61:	83 c4 10             	add    $0x10,%esp
+  800b64:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b69:	eb d8                	jmp    800b43 <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  800b6b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800b70:	eb d1                	jmp    800b43 <ftruncate+0x50>
+
+00800b72 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800b72:	55                   	push   %ebp
+  800b73:	89 e5                	mov    %esp,%ebp
+  800b75:	56                   	push   %esi
+  800b76:	53                   	push   %ebx
+  800b77:	83 ec 18             	sub    $0x18,%esp
+  800b7a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  800b7d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800b80:	50                   	push   %eax
+  800b81:	ff 75 08             	push   0x8(%ebp)
+  800b84:	e8 46 fb ff ff       	call   8006cf <fd_lookup>
+  800b89:	83 c4 10             	add    $0x10,%esp
+  800b8c:	85 c0                	test   %eax,%eax
+  800b8e:	78 49                	js     800bd9 <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800b90:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800b93:	83 ec 08             	sub    $0x8,%esp
+  800b96:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b99:	50                   	push   %eax
+  800b9a:	ff 36                	push   (%esi)
+  800b9c:	e8 7e fb ff ff       	call   80071f <dev_lookup>
+  800ba1:	83 c4 10             	add    $0x10,%esp
+  800ba4:	85 c0                	test   %eax,%eax
+  800ba6:	78 31                	js     800bd9 <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  800ba8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800bab:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800baf:	74 2f                	je     800be0 <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  800bb1:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  800bb4:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800bbb:	00 00 00 
+  stat->st_isdir = 0;
+  800bbe:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800bc5:	00 00 00 
+  stat->st_dev = dev;
+  800bc8:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  800bce:	83 ec 08             	sub    $0x8,%esp
+  800bd1:	53                   	push   %ebx
+  800bd2:	56                   	push   %esi
+  800bd3:	ff 50 14             	call   *0x14(%eax)
+  800bd6:	83 c4 10             	add    $0x10,%esp
+}
+  800bd9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800bdc:	5b                   	pop    %ebx
+  800bdd:	5e                   	pop    %esi
+  800bde:	5d                   	pop    %ebp
+  800bdf:	c3                   	ret
+    return -E_NOT_SUPP;
+  800be0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800be5:	eb f2                	jmp    800bd9 <fstat+0x67>
+
+00800be7 <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  800be7:	55                   	push   %ebp
+  800be8:	89 e5                	mov    %esp,%ebp
+  800bea:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  800bed:	ff 75 0c             	push   0xc(%ebp)
+  800bf0:	ff 75 08             	push   0x8(%ebp)
+  800bf3:	e8 58 07 00 00       	call   801350 <file_stat>
+}
+  800bf8:	c9                   	leave
+  800bf9:	c3                   	ret
+
+00800bfa <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  800bfa:	55                   	push   %ebp
+  800bfb:	89 e5                	mov    %esp,%ebp
+  800bfd:	57                   	push   %edi
+  800bfe:	56                   	push   %esi
+  800bff:	53                   	push   %ebx
+  800c00:	83 ec 1c             	sub    $0x1c,%esp
+  800c03:	89 c7                	mov    %eax,%edi
+  800c05:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  800c08:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  800c0b:	e9 a2 00 00 00       	jmp    800cb2 <fsipc_send+0xb8>
+  nfsenvs = 0;
+  800c10:	c7 05 00 50 80 00 00 	movl   $0x0,0x805000
+  800c17:	00 00 00 
+  800c1a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c1f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  800c24:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  800c29:	be 01 00 00 00       	mov    $0x1,%esi
+  800c2e:	eb 0f                	jmp    800c3f <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  800c30:	83 c0 01             	add    $0x1,%eax
+  800c33:	3d 00 04 00 00       	cmp    $0x400,%eax
+  800c38:	74 49                	je     800c83 <fsipc_send+0x89>
+  800c3a:	83 f9 07             	cmp    $0x7,%ecx
+  800c3d:	7f 50                	jg     800c8f <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  800c3f:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  800c42:	c1 e2 04             	shl    $0x4,%edx
+  800c45:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800c4b:	8b 52 50             	mov    0x50(%edx),%edx
+  800c4e:	83 fa 01             	cmp    $0x1,%edx
+  800c51:	75 dd                	jne    800c30 <fsipc_send+0x36>
+  800c53:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  800c56:	c1 e2 04             	shl    $0x4,%edx
+  800c59:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800c5f:	8b 52 54             	mov    0x54(%edx),%edx
+  800c62:	85 d2                	test   %edx,%edx
+  800c64:	74 ca                	je     800c30 <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  800c66:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  800c69:	c1 e2 04             	shl    $0x4,%edx
+  800c6c:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800c72:	8b 52 48             	mov    0x48(%edx),%edx
+  800c75:	89 14 8d 20 50 80 00 	mov    %edx,0x805020(,%ecx,4)
+  800c7c:	8d 49 01             	lea    0x1(%ecx),%ecx
+  800c7f:	89 f3                	mov    %esi,%ebx
+  800c81:	eb ad                	jmp    800c30 <fsipc_send+0x36>
+  800c83:	84 db                	test   %bl,%bl
+  800c85:	74 38                	je     800cbf <fsipc_send+0xc5>
+  800c87:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  800c8d:	eb 30                	jmp    800cbf <fsipc_send+0xc5>
+  800c8f:	84 db                	test   %bl,%bl
+  800c91:	74 2c                	je     800cbf <fsipc_send+0xc5>
+  800c93:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  800c99:	eb 24                	jmp    800cbf <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  800c9b:	50                   	push   %eax
+  800c9c:	68 24 2f 80 00       	push   $0x802f24
+  800ca1:	6a 34                	push   $0x34
+  800ca3:	68 2e 2f 80 00       	push   $0x802f2e
+  800ca8:	e8 b9 13 00 00       	call   802066 <_panic>
+    }
+    sys_yield();
+  800cad:	e8 92 f4 ff ff       	call   800144 <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  800cb2:	83 3d 00 50 80 00 03 	cmpl   $0x3,0x805000
+  800cb9:	0f 8e 51 ff ff ff    	jle    800c10 <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  800cbf:	a1 44 57 80 00       	mov    0x805744,%eax
+  800cc4:	8b 70 48             	mov    0x48(%eax),%esi
+  800cc7:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  800ccd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cd2:	8b 0d 00 50 80 00    	mov    0x805000,%ecx
+  800cd8:	39 d9                	cmp    %ebx,%ecx
+  800cda:	7e d1                	jle    800cad <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  800cdc:	83 ec 0c             	sub    $0xc,%esp
+  800cdf:	ff 75 e0             	push   -0x20(%ebp)
+  800ce2:	6a 07                	push   $0x7
+  800ce4:	ff 75 e4             	push   -0x1c(%ebp)
+  800ce7:	57                   	push   %edi
+  800ce8:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  800ceb:	99                   	cltd
+  800cec:	f7 f9                	idiv   %ecx
+  800cee:	ff 34 95 20 50 80 00 	push   0x805020(,%edx,4)
+  800cf5:	e8 63 f7 ff ff       	call   80045d <sys_ipc_try_send>
+      if (r == 0)
+  800cfa:	83 c4 20             	add    $0x20,%esp
+  800cfd:	85 c0                	test   %eax,%eax
+  800cff:	74 0a                	je     800d0b <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  800d01:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  800d04:	75 95                	jne    800c9b <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  800d06:	83 c3 01             	add    $0x1,%ebx
+  800d09:	eb c7                	jmp    800cd2 <fsipc_send+0xd8>
+  }
+}
+  800d0b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d0e:	5b                   	pop    %ebx
+  800d0f:	5e                   	pop    %esi
+  800d10:	5f                   	pop    %edi
+  800d11:	5d                   	pop    %ebp
+  800d12:	c3                   	ret
+
+00800d13 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  800d13:	55                   	push   %ebp
+  800d14:	89 e5                	mov    %esp,%ebp
+  800d16:	53                   	push   %ebx
+  800d17:	83 ec 14             	sub    $0x14,%esp
+  800d1a:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  800d1c:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  800d23:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800d28:	ba 00 60 80 00       	mov    $0x806000,%edx
+  800d2d:	e8 c8 fe ff ff       	call   800bfa <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  800d32:	6a 00                	push   $0x0
+  800d34:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800d37:	50                   	push   %eax
+  800d38:	53                   	push   %ebx
+  800d39:	6a 00                	push   $0x0
+  800d3b:	e8 1f 1d 00 00       	call   802a5f <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  800d40:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d43:	c9                   	leave
+  800d44:	c3                   	ret
+
+00800d45 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  800d45:	55                   	push   %ebp
+  800d46:	89 e5                	mov    %esp,%ebp
+  800d48:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800d4b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d4e:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d51:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.set_size.req_size = newsize;
+  800d56:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d59:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  800d5e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d63:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d68:	e8 a6 ff ff ff       	call   800d13 <fsipc>
+}
+  800d6d:	c9                   	leave
+  800d6e:	c3                   	ret
+
+00800d6f <devfile_flush>:
+{
+  800d6f:	55                   	push   %ebp
+  800d70:	89 e5                	mov    %esp,%ebp
+  800d72:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800d75:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d78:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d7b:	a3 00 60 80 00       	mov    %eax,0x806000
+  return fsipc(FSREQ_FLUSH, NULL);
+  800d80:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d85:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d8a:	e8 84 ff ff ff       	call   800d13 <fsipc>
+}
+  800d8f:	c9                   	leave
+  800d90:	c3                   	ret
+
+00800d91 <devfile_stat>:
+{
+  800d91:	55                   	push   %ebp
+  800d92:	89 e5                	mov    %esp,%ebp
+  800d94:	53                   	push   %ebx
+  800d95:	83 ec 04             	sub    $0x4,%esp
+  800d98:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800d9b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d9e:	8b 40 0c             	mov    0xc(%eax),%eax
+  800da1:	a3 00 60 80 00       	mov    %eax,0x806000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  800da6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dab:	b8 05 00 00 00       	mov    $0x5,%eax
+  800db0:	e8 5e ff ff ff       	call   800d13 <fsipc>
+  800db5:	85 c0                	test   %eax,%eax
+  800db7:	78 2c                	js     800de5 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800db9:	83 ec 08             	sub    $0x8,%esp
+  800dbc:	68 00 60 80 00       	push   $0x806000
+  800dc1:	53                   	push   %ebx
+  800dc2:	e8 68 19 00 00       	call   80272f <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  800dc7:	a1 80 60 80 00       	mov    0x806080,%eax
+  800dcc:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800dd2:	a1 84 60 80 00       	mov    0x806084,%eax
+  800dd7:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  800ddd:	83 c4 10             	add    $0x10,%esp
+  800de0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800de5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800de8:	c9                   	leave
+  800de9:	c3                   	ret
+
+00800dea <fsv_alloc>:
+{
+  800dea:	55                   	push   %ebp
+  800deb:	89 e5                	mov    %esp,%ebp
+  800ded:	56                   	push   %esi
+  800dee:	53                   	push   %ebx
+  800def:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  800df1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800df6:	eb 22                	jmp    800e1a <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  800df8:	83 ec 04             	sub    $0x4,%esp
+  800dfb:	6a 00                	push   $0x0
+  800dfd:	6a 00                	push   $0x0
+  800dff:	6a 07                	push   $0x7
+  800e01:	50                   	push   %eax
+  800e02:	6a 00                	push   $0x0
+  800e04:	6a 04                	push   $0x4
+  800e06:	68 40 50 80 00       	push   $0x805040
+  800e0b:	e8 e9 f7 ff ff       	call   8005f9 <sysbatch_add>
+  800e10:	83 c4 20             	add    $0x20,%esp
+  800e13:	85 c0                	test   %eax,%eax
+  800e15:	78 48                	js     800e5f <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  800e17:	83 c3 01             	add    $0x1,%ebx
+  800e1a:	39 f3                	cmp    %esi,%ebx
+  800e1c:	74 31                	je     800e4f <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  800e1e:	89 d8                	mov    %ebx,%eax
+  800e20:	c1 e0 0c             	shl    $0xc,%eax
+  800e23:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  800e28:	89 c2                	mov    %eax,%edx
+  800e2a:	c1 ea 16             	shr    $0x16,%edx
+  800e2d:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800e34:	f6 c2 01             	test   $0x1,%dl
+  800e37:	74 bf                	je     800df8 <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  800e39:	89 c2                	mov    %eax,%edx
+  800e3b:	c1 ea 0c             	shr    $0xc,%edx
+  800e3e:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800e45:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  800e48:	83 fa 03             	cmp    $0x3,%edx
+  800e4b:	75 ab                	jne    800df8 <fsv_alloc+0xe>
+  800e4d:	eb c8                	jmp    800e17 <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  800e4f:	83 ec 0c             	sub    $0xc,%esp
+  800e52:	68 40 50 80 00       	push   $0x805040
+  800e57:	e8 4d f7 ff ff       	call   8005a9 <sysbatch_flush>
+  800e5c:	83 c4 10             	add    $0x10,%esp
+}
+  800e5f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e62:	5b                   	pop    %ebx
+  800e63:	5e                   	pop    %esi
+  800e64:	5d                   	pop    %ebp
+  800e65:	c3                   	ret
+
+00800e66 <devfile_read>:
+{
+  800e66:	55                   	push   %ebp
+  800e67:	89 e5                	mov    %esp,%ebp
+  800e69:	57                   	push   %edi
+  800e6a:	56                   	push   %esi
+  800e6b:	53                   	push   %ebx
+  800e6c:	83 ec 3c             	sub    $0x3c,%esp
+  800e6f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  800e72:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  800e78:	77 57                	ja     800ed1 <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800e7a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e7d:	8b 40 0c             	mov    0xc(%eax),%eax
+  800e80:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read.req_n = n;
+  800e85:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  800e8b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e90:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e95:	e8 79 fe ff ff       	call   800d13 <fsipc>
+  800e9a:	89 c6                	mov    %eax,%esi
+  800e9c:	85 c0                	test   %eax,%eax
+  800e9e:	78 27                	js     800ec7 <devfile_read+0x61>
+  assert(r <= n);
+  800ea0:	39 c3                	cmp    %eax,%ebx
+  800ea2:	0f 82 0e 02 00 00    	jb     8010b6 <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  800ea8:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800ead:	0f 8f 1c 02 00 00    	jg     8010cf <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  800eb3:	83 ec 04             	sub    $0x4,%esp
+  800eb6:	50                   	push   %eax
+  800eb7:	68 00 60 80 00       	push   $0x806000
+  800ebc:	ff 75 0c             	push   0xc(%ebp)
+  800ebf:	e8 f1 19 00 00       	call   8028b5 <memmove>
+  return r;
+  800ec4:	83 c4 10             	add    $0x10,%esp
+}
+  800ec7:	89 f0                	mov    %esi,%eax
+  800ec9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ecc:	5b                   	pop    %ebx
+  800ecd:	5e                   	pop    %esi
+  800ece:	5f                   	pop    %edi
+  800ecf:	5d                   	pop    %ebp
+  800ed0:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  800ed1:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ed6:	e8 0f ff ff ff       	call   800dea <fsv_alloc>
+  800edb:	89 c6                	mov    %eax,%esi
+  800edd:	85 c0                	test   %eax,%eax
+  800edf:	78 e6                	js     800ec7 <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  800ee1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ee4:	8b 40 0c             	mov    0xc(%eax),%eax
+  800ee7:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  800eec:	8b 45 08             	mov    0x8(%ebp),%eax
+  800eef:	8b 40 04             	mov    0x4(%eax),%eax
+  800ef2:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  800ef7:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  800efd:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  800f04:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800f09:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  800f0e:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f13:	e8 e2 fc ff ff       	call   800bfa <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  800f18:	6a 00                	push   $0x0
+  800f1a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800f1d:	50                   	push   %eax
+  800f1e:	68 00 10 c0 9f       	push   $0x9fc01000
+  800f23:	6a 00                	push   $0x0
+  800f25:	e8 35 1b 00 00       	call   802a5f <ipc_recv_pages>
+  800f2a:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  800f2c:	83 c4 10             	add    $0x10,%esp
+  800f2f:	85 c0                	test   %eax,%eax
+  800f31:	7e 94                	jle    800ec7 <devfile_read+0x61>
+  assert(r <= n);
+  800f33:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800f36:	39 c3                	cmp    %eax,%ebx
+  800f38:	72 2e                	jb     800f68 <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  800f3a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f3d:	8b 40 04             	mov    0x4(%eax),%eax
+  800f40:	25 ff 0f 00 00       	and    $0xfff,%eax
+  800f45:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  800f48:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800f4b:	c1 e2 0c             	shl    $0xc,%edx
+  800f4e:	39 ca                	cmp    %ecx,%edx
+  800f50:	72 2f                	jb     800f81 <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  800f52:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  800f57:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  800f5a:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  800f5e:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  800f63:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  800f66:	eb 52                	jmp    800fba <devfile_read+0x154>
+  assert(r <= n);
+  800f68:	68 39 2f 80 00       	push   $0x802f39
+  800f6d:	68 40 2f 80 00       	push   $0x802f40
+  800f72:	68 49 01 00 00       	push   $0x149
+  800f77:	68 2e 2f 80 00       	push   $0x802f2e
+  800f7c:	e8 e5 10 00 00       	call   802066 <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  800f81:	68 64 2f 80 00       	push   $0x802f64
+  800f86:	68 40 2f 80 00       	push   $0x802f40
+  800f8b:	68 4a 01 00 00       	push   $0x14a
+  800f90:	68 2e 2f 80 00       	push   $0x802f2e
+  800f95:	e8 cc 10 00 00       	call   802066 <_panic>
+      memmove(dst + done, src + done, m);
+  800f9a:	83 ec 04             	sub    $0x4,%esp
+  800f9d:	53                   	push   %ebx
+  800f9e:	56                   	push   %esi
+  800f9f:	89 f8                	mov    %edi,%eax
+  800fa1:	03 45 0c             	add    0xc(%ebp),%eax
+  800fa4:	50                   	push   %eax
+  800fa5:	e8 0b 19 00 00       	call   8028b5 <memmove>
+  800faa:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  800fad:	01 df                	add    %ebx,%edi
+  800faf:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800fb2:	39 c7                	cmp    %eax,%edi
+  800fb4:	0f 83 c0 00 00 00    	jae    80107a <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  800fba:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800fbd:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  800fc0:	89 f0                	mov    %esi,%eax
+  800fc2:	25 ff 0f 00 00       	and    $0xfff,%eax
+  800fc7:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  800fcc:	29 c3                	sub    %eax,%ebx
+  800fce:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800fd1:	29 f8                	sub    %edi,%eax
+  800fd3:	39 c3                	cmp    %eax,%ebx
+  800fd5:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  800fd8:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  800fde:	75 ba                	jne    800f9a <devfile_read+0x134>
+  800fe0:	89 f9                	mov    %edi,%ecx
+  800fe2:	03 4d 0c             	add    0xc(%ebp),%ecx
+  800fe5:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  800fe8:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  800fee:	75 aa                	jne    800f9a <devfile_read+0x134>
+  800ff0:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  800ff6:	77 a2                	ja     800f9a <devfile_read+0x134>
+  800ff8:	89 c8                	mov    %ecx,%eax
+  800ffa:	c1 e8 16             	shr    $0x16,%eax
+  800ffd:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801004:	a8 01                	test   $0x1,%al
+  801006:	74 92                	je     800f9a <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  801008:	89 c8                	mov    %ecx,%eax
+  80100a:	c1 e8 0c             	shr    $0xc,%eax
+  80100d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  801014:	a8 01                	test   $0x1,%al
+  801016:	74 82                	je     800f9a <devfile_read+0x134>
+  801018:	a9 02 08 00 00       	test   $0x802,%eax
+  80101d:	0f 84 77 ff ff ff    	je     800f9a <devfile_read+0x134>
+  801023:	f6 c4 04             	test   $0x4,%ah
+  801026:	0f 85 6e ff ff ff    	jne    800f9a <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  80102c:	a1 44 57 80 00       	mov    0x805744,%eax
+  801031:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  801035:	84 c0                	test   %al,%al
+  801037:	75 17                	jne    801050 <devfile_read+0x1ea>
+  801039:	83 ec 08             	sub    $0x8,%esp
+  80103c:	6a 01                	push   $0x1
+  80103e:	6a 00                	push   $0x0
+  801040:	e8 1e f1 ff ff       	call   800163 <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  801045:	83 c4 10             	add    $0x10,%esp
+  801048:	85 c0                	test   %eax,%eax
+  80104a:	0f 85 4a ff ff ff    	jne    800f9a <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  801050:	83 ec 04             	sub    $0x4,%esp
+  801053:	68 05 08 00 00       	push   $0x805
+  801058:	ff 75 cc             	push   -0x34(%ebp)
+  80105b:	6a 00                	push   $0x0
+  80105d:	56                   	push   %esi
+  80105e:	6a 00                	push   $0x0
+  801060:	6a 05                	push   $0x5
+  801062:	68 40 50 80 00       	push   $0x805040
+  801067:	e8 8d f5 ff ff       	call   8005f9 <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  80106c:	c1 e8 1f             	shr    $0x1f,%eax
+  80106f:	08 45 cb             	or     %al,-0x35(%ebp)
+  801072:	83 c4 20             	add    $0x20,%esp
+  801075:	e9 33 ff ff ff       	jmp    800fad <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  80107a:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  80107d:	83 ec 0c             	sub    $0xc,%esp
+  801080:	68 40 50 80 00       	push   $0x805040
+  801085:	e8 1f f5 ff ff       	call   8005a9 <sysbatch_flush>
+  80108a:	83 c4 10             	add    $0x10,%esp
+  80108d:	85 c0                	test   %eax,%eax
+  80108f:	78 06                	js     801097 <devfile_read+0x231>
+  801091:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  801095:	74 14                	je     8010ab <devfile_read+0x245>
+    memmove(dst, src, r);
+  801097:	83 ec 04             	sub    $0x4,%esp
+  80109a:	ff 75 d4             	push   -0x2c(%ebp)
+  80109d:	ff 75 d0             	push   -0x30(%ebp)
+  8010a0:	ff 75 0c             	push   0xc(%ebp)
+  8010a3:	e8 0d 18 00 00       	call   8028b5 <memmove>
+  8010a8:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  8010ab:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010ae:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  8010b1:	e9 11 fe ff ff       	jmp    800ec7 <devfile_read+0x61>
+  assert(r <= n);
+  8010b6:	68 39 2f 80 00       	push   $0x802f39
+  8010bb:	68 40 2f 80 00       	push   $0x802f40
+  8010c0:	68 1c 01 00 00       	push   $0x11c
+  8010c5:	68 2e 2f 80 00       	push   $0x802f2e
+  8010ca:	e8 97 0f 00 00       	call   802066 <_panic>
+  assert(r <= PGSIZE);
+  8010cf:	68 55 2f 80 00       	push   $0x802f55
+  8010d4:	68 40 2f 80 00       	push   $0x802f40
+  8010d9:	68 1d 01 00 00       	push   $0x11d
+  8010de:	68 2e 2f 80 00       	push   $0x802f2e
+  8010e3:	e8 7e 0f 00 00       	call   802066 <_panic>
+
+008010e8 <devfile_write>:
+{
+  8010e8:	55                   	push   %ebp
+  8010e9:	89 e5                	mov    %esp,%ebp
+  8010eb:	57                   	push   %edi
+  8010ec:	56                   	push   %esi
+  8010ed:	53                   	push   %ebx
+  8010ee:	83 ec 1c             	sub    $0x1c,%esp
+  8010f1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8010f4:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  8010f7:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  8010fc:	77 39                	ja     801137 <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8010fe:	8b 56 0c             	mov    0xc(%esi),%edx
+  801101:	89 15 00 60 80 00    	mov    %edx,0x806000
+  fsipcbuf.write.req_n = n;
+  801107:	a3 04 60 80 00       	mov    %eax,0x806004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  80110c:	83 ec 04             	sub    $0x4,%esp
+  80110f:	50                   	push   %eax
+  801110:	ff 75 0c             	push   0xc(%ebp)
+  801113:	68 08 60 80 00       	push   $0x806008
+  801118:	e8 98 17 00 00       	call   8028b5 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  80111d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801122:	b8 04 00 00 00       	mov    $0x4,%eax
+  801127:	e8 e7 fb ff ff       	call   800d13 <fsipc>
+  80112c:	83 c4 10             	add    $0x10,%esp
+}
+  80112f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801132:	5b                   	pop    %ebx
+  801133:	5e                   	pop    %esi
+  801134:	5f                   	pop    %edi
+  801135:	5d                   	pop    %ebp
+  801136:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  801137:	ba 00 00 10 00       	mov    $0x100000,%edx
+  80113c:	39 d0                	cmp    %edx,%eax
+  80113e:	89 d3                	mov    %edx,%ebx
+  801140:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  801143:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  801149:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  80114c:	83 c7 01             	add    $0x1,%edi
+  80114f:	89 f8                	mov    %edi,%eax
+  801151:	e8 94 fc ff ff       	call   800dea <fsv_alloc>
+  801156:	85 c0                	test   %eax,%eax
+  801158:	78 d5                	js     80112f <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  80115a:	83 ec 04             	sub    $0x4,%esp
+  80115d:	53                   	push   %ebx
+  80115e:	ff 75 0c             	push   0xc(%ebp)
+  801161:	68 00 10 c0 9f       	push   $0x9fc01000
+  801166:	e8 4a 17 00 00       	call   8028b5 <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  80116b:	8b 46 0c             	mov    0xc(%esi),%eax
+  80116e:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  801173:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  801179:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801180:	89 f9                	mov    %edi,%ecx
+  801182:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801187:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80118c:	e8 69 fa ff ff       	call   800bfa <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801191:	6a 00                	push   $0x0
+  801193:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801196:	50                   	push   %eax
+  801197:	6a 00                	push   $0x0
+  801199:	6a 00                	push   $0x0
+  80119b:	e8 bf 18 00 00       	call   802a5f <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  8011a0:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  8011a3:	eb 8a                	jmp    80112f <devfile_write+0x47>
+
+008011a5 <open>:
+{
+  8011a5:	55                   	push   %ebp
+  8011a6:	89 e5                	mov    %esp,%ebp
+  8011a8:	56                   	push   %esi
+  8011a9:	53                   	push   %ebx
+  8011aa:	83 ec 1c             	sub    $0x1c,%esp
+  8011ad:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  8011b0:	56                   	push   %esi
+  8011b1:	e8 3e 15 00 00       	call   8026f4 <strlen>
+  8011b6:	83 c4 10             	add    $0x10,%esp
+  8011b9:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8011be:	7f 6c                	jg     80122c <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  8011c0:	83 ec 0c             	sub    $0xc,%esp
+  8011c3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8011c6:	50                   	push   %eax
+  8011c7:	e8 ad f4 ff ff       	call   800679 <fd_alloc>
+  8011cc:	89 c3                	mov    %eax,%ebx
+  8011ce:	83 c4 10             	add    $0x10,%esp
+  8011d1:	85 c0                	test   %eax,%eax
+  8011d3:	78 3c                	js     801211 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  8011d5:	83 ec 08             	sub    $0x8,%esp
+  8011d8:	56                   	push   %esi
+  8011d9:	68 00 60 80 00       	push   $0x806000
+  8011de:	e8 4c 15 00 00       	call   80272f <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  8011e3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8011e6:	a3 00 64 80 00       	mov    %eax,0x806400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8011eb:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8011ee:	b8 01 00 00 00       	mov    $0x1,%eax
+  8011f3:	e8 1b fb ff ff       	call   800d13 <fsipc>
+  8011f8:	89 c3                	mov    %eax,%ebx
+  8011fa:	83 c4 10             	add    $0x10,%esp
+  8011fd:	85 c0                	test   %eax,%eax
+  8011ff:	78 19                	js     80121a <open+0x75>
+  return fd2num(fd);
+  801201:	83 ec 0c             	sub    $0xc,%esp
+  801204:	ff 75 f4             	push   -0xc(%ebp)
+  801207:	e8 49 f4 ff ff       	call   800655 <fd2num>
+  80120c:	89 c3                	mov    %eax,%ebx
+  80120e:	83 c4 10             	add    $0x10,%esp
+}
+  801211:	89 d8                	mov    %ebx,%eax
+  801213:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801216:	5b                   	pop    %ebx
+  801217:	5e                   	pop    %esi
+  801218:	5d                   	pop    %ebp
+  801219:	c3                   	ret
+    fd_close(fd, 0);
+  80121a:	83 ec 08             	sub    $0x8,%esp
+  80121d:	6a 00                	push   $0x0
+  80121f:	ff 75 f4             	push   -0xc(%ebp)
+  801222:	e8 44 f5 ff ff       	call   80076b <fd_close>
+    return r;
+  801227:	83 c4 10             	add    $0x10,%esp
+  80122a:	eb e5                	jmp    801211 <open+0x6c>
+    return -E_BAD_PATH;
+  80122c:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801231:	eb de                	jmp    801211 <open+0x6c>
+
+00801233 <open_read>:
+{
+  801233:	55                   	push   %ebp
+  801234:	89 e5                	mov    %esp,%ebp
+  801236:	57                   	push   %edi
+  801237:	56                   	push   %esi
+  801238:	53                   	push   %ebx
+  801239:	83 ec 28             	sub    $0x28,%esp
+  80123c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  80123f:	57                   	push   %edi
+  801240:	e8 af 14 00 00       	call   8026f4 <strlen>
+  801245:	83 c4 10             	add    $0x10,%esp
+  801248:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80124d:	0f 87 f6 00 00 00    	ja     801349 <open_read+0x116>
+  801253:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  801255:	83 ec 0c             	sub    $0xc,%esp
+  801258:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80125b:	50                   	push   %eax
+  80125c:	e8 18 f4 ff ff       	call   800679 <fd_alloc>
+  801261:	89 c3                	mov    %eax,%ebx
+  801263:	83 c4 10             	add    $0x10,%esp
+  801266:	85 c0                	test   %eax,%eax
+  801268:	0f 88 b2 00 00 00    	js     801320 <open_read+0xed>
+  strcpy(req->req_buf, path);
+  80126e:	83 ec 08             	sub    $0x8,%esp
+  801271:	57                   	push   %edi
+  801272:	68 e4 60 80 00       	push   $0x8060e4
+  801277:	e8 b3 14 00 00       	call   80272f <strcpy>
+  req->req_nops = 2;
+  80127c:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  801283:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  801286:	c7 05 04 60 80 00 01 	movl   $0x1,0x806004
+  80128d:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  801290:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801293:	a3 10 60 80 00       	mov    %eax,0x806010
+  req->req_ops[0].op_buf = 0;
+  801298:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  80129f:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  8012a2:	c7 05 20 60 80 00 04 	movl   $0x4,0x806020
+  8012a9:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  8012ac:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  8012b3:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  8012b6:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  8012bb:	29 f0                	sub    %esi,%eax
+  8012bd:	3b 45 14             	cmp    0x14(%ebp),%eax
+  8012c0:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  8012c4:	a3 2c 60 80 00       	mov    %eax,0x80602c
+  req->req_ops[1].op_offset = 0;
+  8012c9:	c7 05 30 60 80 00 00 	movl   $0x0,0x806030
+  8012d0:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  8012d3:	83 c6 01             	add    $0x1,%esi
+  8012d6:	89 35 34 60 80 00    	mov    %esi,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  8012dc:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8012df:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8012e4:	e8 2a fa ff ff       	call   800d13 <fsipc>
+  8012e9:	89 c3                	mov    %eax,%ebx
+  8012eb:	83 c4 10             	add    $0x10,%esp
+  8012ee:	83 f8 01             	cmp    $0x1,%eax
+  8012f1:	7e 37                	jle    80132a <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  8012f3:	a1 38 60 80 00       	mov    0x806038,%eax
+  8012f8:	8b 55 18             	mov    0x18(%ebp),%edx
+  8012fb:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  8012fd:	83 ec 04             	sub    $0x4,%esp
+  801300:	50                   	push   %eax
+  801301:	81 c6 e4 60 80 00    	add    $0x8060e4,%esi
+  801307:	56                   	push   %esi
+  801308:	ff 75 10             	push   0x10(%ebp)
+  80130b:	e8 a5 15 00 00       	call   8028b5 <memmove>
+  return fd2num(fd);
+  801310:	83 c4 04             	add    $0x4,%esp
+  801313:	ff 75 e4             	push   -0x1c(%ebp)
+  801316:	e8 3a f3 ff ff       	call   800655 <fd2num>
+  80131b:	89 c3                	mov    %eax,%ebx
+  80131d:	83 c4 10             	add    $0x10,%esp
+}
+  801320:	89 d8                	mov    %ebx,%eax
+  801322:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801325:	5b                   	pop    %ebx
+  801326:	5e                   	pop    %esi
+  801327:	5f                   	pop    %edi
+  801328:	5d                   	pop    %ebp
+  801329:	c3                   	ret
+    fd_close(fd, 0);
+  80132a:	83 ec 08             	sub    $0x8,%esp
+  80132d:	6a 00                	push   $0x0
+  80132f:	ff 75 e4             	push   -0x1c(%ebp)
+  801332:	e8 34 f4 ff ff       	call   80076b <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  801337:	83 c4 10             	add    $0x10,%esp
+  80133a:	85 db                	test   %ebx,%ebx
+  80133c:	78 e2                	js     801320 <open_read+0xed>
+  80133e:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  801341:	8b 9b 1c 60 80 00    	mov    0x80601c(%ebx),%ebx
+  801347:	eb d7                	jmp    801320 <open_read+0xed>
+    return -E_BAD_PATH;
+  801349:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80134e:	eb d0                	jmp    801320 <open_read+0xed>
+
+00801350 <file_stat>:
+{
+  801350:	55                   	push   %ebp
+  801351:	89 e5                	mov    %esp,%ebp
+  801353:	57                   	push   %edi
+  801354:	56                   	push   %esi
+  801355:	53                   	push   %ebx
+  801356:	83 ec 18             	sub    $0x18,%esp
+  801359:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80135c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  80135f:	57                   	push   %edi
+  801360:	e8 8f 13 00 00       	call   8026f4 <strlen>
+  801365:	83 c4 10             	add    $0x10,%esp
+  801368:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80136d:	0f 8f c7 00 00 00    	jg     80143a <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  801373:	83 ec 0c             	sub    $0xc,%esp
+  801376:	57                   	push   %edi
+  801377:	e8 78 13 00 00       	call   8026f4 <strlen>
+  80137c:	8d 58 04             	lea    0x4(%eax),%ebx
+  80137f:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  801382:	83 c4 08             	add    $0x8,%esp
+  801385:	57                   	push   %edi
+  801386:	68 e4 60 80 00       	push   $0x8060e4
+  80138b:	e8 9f 13 00 00       	call   80272f <strcpy>
+  req->req_nops = 2;
+  801390:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  801397:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  80139a:	c7 05 04 60 80 00 02 	movl   $0x2,0x806004
+  8013a1:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  8013a4:	c7 05 10 60 80 00 00 	movl   $0x0,0x806010
+  8013ab:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  8013ae:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  8013b5:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  8013b8:	c7 05 20 60 80 00 03 	movl   $0x3,0x806020
+  8013bf:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  8013c2:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  8013c9:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  8013cc:	89 1d 34 60 80 00    	mov    %ebx,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  8013d2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013d7:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8013dc:	e8 32 f9 ff ff       	call   800d13 <fsipc>
+  8013e1:	83 c4 10             	add    $0x10,%esp
+  8013e4:	83 f8 01             	cmp    $0x1,%eax
+  8013e7:	7e 42                	jle    80142b <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  8013e9:	81 c3 e4 60 80 00    	add    $0x8060e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  8013ef:	83 ec 08             	sub    $0x8,%esp
+  8013f2:	53                   	push   %ebx
+  8013f3:	56                   	push   %esi
+  8013f4:	e8 36 13 00 00       	call   80272f <strcpy>
+  st->st_size = ret->ret_size;
+  8013f9:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  8013ff:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  801405:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  80140b:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  801411:	c7 86 88 00 00 00 04 	movl   $0x804004,0x88(%esi)
+  801418:	40 80 00 
+  return 0;
+  80141b:	83 c4 10             	add    $0x10,%esp
+  80141e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801423:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801426:	5b                   	pop    %ebx
+  801427:	5e                   	pop    %esi
+  801428:	5f                   	pop    %edi
+  801429:	5d                   	pop    %ebp
+  80142a:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  80142b:	85 c0                	test   %eax,%eax
+  80142d:	78 f4                	js     801423 <file_stat+0xd3>
+  80142f:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801432:	8b 80 1c 60 80 00    	mov    0x80601c(%eax),%eax
+  801438:	eb e9                	jmp    801423 <file_stat+0xd3>
+    return -E_BAD_PATH;
+  80143a:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  80143f:	eb e2                	jmp    801423 <file_stat+0xd3>
+
+00801441 <read_map>:
+{
+  801441:	55                   	push   %ebp
+  801442:	89 e5                	mov    %esp,%ebp
+  801444:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801447:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80144a:	50                   	push   %eax
+  80144b:	ff 75 08             	push   0x8(%ebp)
+  80144e:	e8 7c f2 ff ff       	call   8006cf <fd_lookup>
+  801453:	83 c4 10             	add    $0x10,%esp
+  801456:	85 c0                	test   %eax,%eax
+  801458:	78 2a                	js     801484 <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  80145a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80145d:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  801463:	39 08                	cmp    %ecx,(%eax)
+  801465:	75 1f                	jne    801486 <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  801467:	8b 40 0c             	mov    0xc(%eax),%eax
+  80146a:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read_map.req_offset = offset;
+  80146f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801472:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  801477:	8b 55 10             	mov    0x10(%ebp),%edx
+  80147a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80147f:	e8 8f f8 ff ff       	call   800d13 <fsipc>
+}
+  801484:	c9                   	leave
+  801485:	c3                   	ret
+    return -E_INVAL;
+  801486:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80148b:	eb f7                	jmp    801484 <read_map+0x43>
+
+0080148d <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80148d:	55                   	push   %ebp
+  80148e:	89 e5                	mov    %esp,%ebp
+  801490:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  801493:	ba 00 00 00 00       	mov    $0x0,%edx
+  801498:	b8 08 00 00 00       	mov    $0x8,%eax
+  80149d:	e8 71 f8 ff ff       	call   800d13 <fsipc>
+}
+  8014a2:	c9                   	leave
+  8014a3:	c3                   	ret
+
+008014a4 <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  8014a4:	55                   	push   %ebp
+  8014a5:	89 e5                	mov    %esp,%ebp
+  8014a7:	57                   	push   %edi
+  8014a8:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  8014a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014ac:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.stats.req_bio_sched = 0;
+  8014b1:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  8014b8:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  8014bb:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  8014c2:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  8014c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014ca:	b8 09 00 00 00       	mov    $0x9,%eax
+  8014cf:	e8 3f f8 ff ff       	call   800d13 <fsipc>
+  8014d4:	85 c0                	test   %eax,%eax
+  8014d6:	78 14                	js     8014ec <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  8014d8:	be 00 60 80 00       	mov    $0x806000,%esi
+  8014dd:	b9 16 00 00 00       	mov    $0x16,%ecx
+  8014e2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8014e5:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  8014e7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8014ec:	5e                   	pop    %esi
+  8014ed:	5f                   	pop    %edi
+  8014ee:	5d                   	pop    %ebp
+  8014ef:	c3                   	ret
+
+008014f0 <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  8014f0:	55                   	push   %ebp
+  8014f1:	89 e5                	mov    %esp,%ebp
+  8014f3:	53                   	push   %ebx
+  8014f4:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  8014f7:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8014fa:	50                   	push   %eax
+  8014fb:	6a 00                	push   $0x0
+  8014fd:	e8 a2 ff ff ff       	call   8014a4 <fs_stats>
+  801502:	83 c4 10             	add    $0x10,%esp
+  801505:	85 c0                	test   %eax,%eax
+  801507:	78 28                	js     801531 <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  801509:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  80150c:	83 ec 08             	sub    $0x8,%esp
+  80150f:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801512:	50                   	push   %eax
+  801513:	6a 20                	push   $0x20
+  801515:	e8 8a ff ff ff       	call   8014a4 <fs_stats>
+  80151a:	83 c4 10             	add    $0x10,%esp
+  80151d:	85 c0                	test   %eax,%eax
+  80151f:	78 10                	js     801531 <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  801521:	83 ec 08             	sub    $0x8,%esp
+  801524:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801527:	50                   	push   %eax
+  801528:	53                   	push   %ebx
+  801529:	e8 76 ff ff ff       	call   8014a4 <fs_stats>
+  80152e:	83 c4 10             	add    $0x10,%esp
+}
+  801531:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801534:	c9                   	leave
+  801535:	c3                   	ret
+
+00801536 <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  801536:	55                   	push   %ebp
+  801537:	89 e5                	mov    %esp,%ebp
+  801539:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  80153c:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  801543:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  801546:	8b 45 08             	mov    0x8(%ebp),%eax
+  801549:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.stats.req_dcache = 0;
+  80154e:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  801555:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  801558:	ba 00 00 00 00       	mov    $0x0,%edx
+  80155d:	b8 09 00 00 00       	mov    $0x9,%eax
+  801562:	e8 ac f7 ff ff       	call   800d13 <fsipc>
+}
+  801567:	c9                   	leave
+  801568:	c3                   	ret
+
+00801569 <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  801569:	55                   	push   %ebp
+  80156a:	89 e5                	mov    %esp,%ebp
+  80156c:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  80156f:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  801576:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  801579:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  801580:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  801583:	8b 45 08             	mov    0x8(%ebp),%eax
+  801586:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_STATS, NULL);
+  80158b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801590:	b8 09 00 00 00       	mov    $0x9,%eax
+  801595:	e8 79 f7 ff ff       	call   800d13 <fsipc>
+}
+  80159a:	c9                   	leave
+  80159b:	c3                   	ret
+
+0080159c <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  80159c:	55                   	push   %ebp
+  80159d:	89 e5                	mov    %esp,%ebp
+  80159f:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8015a2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015a5:	50                   	push   %eax
+  8015a6:	ff 75 08             	push   0x8(%ebp)
+  8015a9:	e8 21 f1 ff ff       	call   8006cf <fd_lookup>
+  8015ae:	83 c4 10             	add    $0x10,%esp
+  8015b1:	85 c0                	test   %eax,%eax
+  8015b3:	78 34                	js     8015e9 <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  8015b5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015b8:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  8015be:	39 08                	cmp    %ecx,(%eax)
+  8015c0:	75 29                	jne    8015eb <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  8015c2:	8b 40 0c             	mov    0xc(%eax),%eax
+  8015c5:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.fallocate.req_offset = offset;
+  8015ca:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8015cd:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.fallocate.req_len = len;
+  8015d2:	8b 45 10             	mov    0x10(%ebp),%eax
+  8015d5:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  8015da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015df:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8015e4:	e8 2a f7 ff ff       	call   800d13 <fsipc>
+}
+  8015e9:	c9                   	leave
+  8015ea:	c3                   	ret
+    return -E_INVAL;
+  8015eb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015f0:	eb f7                	jmp    8015e9 <fallocate+0x4d>
+
+008015f2 <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  8015f2:	55                   	push   %ebp
+  8015f3:	89 e5                	mov    %esp,%ebp
+  8015f5:	57                   	push   %edi
+  8015f6:	56                   	push   %esi
+  8015f7:	53                   	push   %ebx
+  8015f8:	83 ec 24             	sub    $0x24,%esp
+  8015fb:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8015fe:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801601:	50                   	push   %eax
+  801602:	ff 75 08             	push   0x8(%ebp)
+  801605:	e8 c5 f0 ff ff       	call   8006cf <fd_lookup>
+  80160a:	83 c4 10             	add    $0x10,%esp
+  80160d:	85 c0                	test   %eax,%eax
+  80160f:	78 66                	js     801677 <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  801611:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801614:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  80161a:	39 08                	cmp    %ecx,(%eax)
+  80161c:	75 61                	jne    80167f <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  80161e:	85 f6                	test   %esi,%esi
+  801620:	7e 50                	jle    801672 <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  801622:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  801627:	39 de                	cmp    %ebx,%esi
+  801629:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  80162c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80162f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801632:	a3 00 60 80 00       	mov    %eax,0x806000
+    fsipcbuf.prefetch.req_n = m;
+  801637:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  80163d:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  801644:	83 ec 04             	sub    $0x4,%esp
+  801647:	57                   	push   %edi
+  801648:	ff 75 0c             	push   0xc(%ebp)
+  80164b:	68 08 60 80 00       	push   $0x806008
+  801650:	e8 60 12 00 00       	call   8028b5 <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  801655:	ba 00 00 00 00       	mov    $0x0,%edx
+  80165a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80165f:	e8 af f6 ff ff       	call   800d13 <fsipc>
+  801664:	83 c4 10             	add    $0x10,%esp
+  801667:	85 c0                	test   %eax,%eax
+  801669:	78 0c                	js     801677 <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  80166b:	01 7d 0c             	add    %edi,0xc(%ebp)
+  80166e:	29 de                	sub    %ebx,%esi
+  801670:	eb ac                	jmp    80161e <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  801672:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801677:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80167a:	5b                   	pop    %ebx
+  80167b:	5e                   	pop    %esi
+  80167c:	5f                   	pop    %edi
+  80167d:	5d                   	pop    %ebp
+  80167e:	c3                   	ret
+    return -E_INVAL;
+  80167f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801684:	eb f1                	jmp    801677 <prefetch+0x85>
+
+00801686 <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  801686:	55                   	push   %ebp
+  801687:	89 e5                	mov    %esp,%ebp
+  801689:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  80168c:	50                   	push   %eax
+  80168d:	e8 d3 ef ff ff       	call   800665 <fd2data>
+  801692:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  801697:	c9                   	leave
+  801698:	c3                   	ret
+
+00801699 <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801699:	55                   	push   %ebp
+  80169a:	89 e5                	mov    %esp,%ebp
+  80169c:	56                   	push   %esi
+  80169d:	53                   	push   %ebx
+  80169e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  8016a1:	83 ec 0c             	sub    $0xc,%esp
+  8016a4:	ff 75 08             	push   0x8(%ebp)
+  8016a7:	e8 b9 ef ff ff       	call   800665 <fd2data>
+  8016ac:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  8016ae:	83 c4 08             	add    $0x8,%esp
+  8016b1:	68 90 2f 80 00       	push   $0x802f90
+  8016b6:	53                   	push   %ebx
+  8016b7:	e8 73 10 00 00       	call   80272f <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  8016bc:	8b 46 04             	mov    0x4(%esi),%eax
+  8016bf:	2b 06                	sub    (%esi),%eax
+  8016c1:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  8016c7:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8016ce:	00 00 00 
+  stat->st_dev = &devpipe;
+  8016d1:	c7 83 88 00 00 00 20 	movl   $0x804020,0x88(%ebx)
+  8016d8:	40 80 00 
+  return 0;
+}
+  8016db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016e0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016e3:	5b                   	pop    %ebx
+  8016e4:	5e                   	pop    %esi
+  8016e5:	5d                   	pop    %ebp
+  8016e6:	c3                   	ret
+
+008016e7 <pipe_wakeup>:
+{
+  8016e7:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  8016e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016ee:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  8016f1:	85 c0                	test   %eax,%eax
+  8016f3:	75 01                	jne    8016f6 <pipe_wakeup+0xf>
+  8016f5:	c3                   	ret
+{
+  8016f6:	55                   	push   %ebp
+  8016f7:	89 e5                	mov    %esp,%ebp
+  8016f9:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  8016fc:	6a 00                	push   $0x0
+  8016fe:	68 00 00 c0 ee       	push   $0xeec00000
+  801703:	52                   	push   %edx
+  801704:	e8 f9 ed ff ff       	call   800502 <sys_chan_wakeup>
+  801709:	83 c4 10             	add    $0x10,%esp
+}
+  80170c:	c9                   	leave
+  80170d:	c3                   	ret
+
+0080170e <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80170e:	55                   	push   %ebp
+  80170f:	89 e5                	mov    %esp,%ebp
+  801711:	57                   	push   %edi
+  801712:	56                   	push   %esi
+  801713:	53                   	push   %ebx
+  801714:	83 ec 18             	sub    $0x18,%esp
+  801717:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  80171a:	57                   	push   %edi
+  80171b:	e8 45 ef ff ff       	call   800665 <fd2data>
+  801720:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  801722:	83 c4 10             	add    $0x10,%esp
+  801725:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  801729:	74 2a                	je     801755 <devpipe_close+0x47>
+  80172b:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  801730:	89 f8                	mov    %edi,%eax
+  801732:	e8 4f ff ff ff       	call   801686 <pipe_ring>
+  801737:	83 ec 08             	sub    $0x8,%esp
+  80173a:	01 d8                	add    %ebx,%eax
+  80173c:	50                   	push   %eax
+  80173d:	6a 00                	push   $0x0
+  80173f:	e8 e7 ea ff ff       	call   80022b <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  801744:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80174a:	83 c4 10             	add    $0x10,%esp
+  80174d:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  801753:	75 db                	jne    801730 <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  801755:	83 ec 08             	sub    $0x8,%esp
+  801758:	57                   	push   %edi
+  801759:	6a 00                	push   $0x0
+  80175b:	e8 cb ea ff ff       	call   80022b <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  801760:	83 c4 10             	add    $0x10,%esp
+  801763:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  801767:	75 13                	jne    80177c <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  801769:	83 ec 08             	sub    $0x8,%esp
+  80176c:	56                   	push   %esi
+  80176d:	6a 00                	push   $0x0
+  80176f:	e8 b7 ea ff ff       	call   80022b <sys_page_unmap>
+}
+  801774:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801777:	5b                   	pop    %ebx
+  801778:	5e                   	pop    %esi
+  801779:	5f                   	pop    %edi
+  80177a:	5d                   	pop    %ebp
+  80177b:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  80177c:	8d 56 04             	lea    0x4(%esi),%edx
+  80177f:	8d 46 2c             	lea    0x2c(%esi),%eax
+  801782:	e8 60 ff ff ff       	call   8016e7 <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  801787:	8d 46 30             	lea    0x30(%esi),%eax
+  80178a:	89 f2                	mov    %esi,%edx
+  80178c:	e8 56 ff ff ff       	call   8016e7 <pipe_wakeup>
+  801791:	eb d6                	jmp    801769 <devpipe_close+0x5b>
+
+00801793 <_pipeisclosed>:
+{
+  801793:	55                   	push   %ebp
+  801794:	89 e5                	mov    %esp,%ebp
+  801796:	57                   	push   %edi
+  801797:	56                   	push   %esi
+  801798:	53                   	push   %ebx
+  801799:	83 ec 1c             	sub    $0x1c,%esp
+  80179c:	89 c7                	mov    %eax,%edi
+  80179e:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  8017a0:	a1 44 57 80 00       	mov    0x805744,%eax
+  8017a5:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  8017a8:	83 ec 0c             	sub    $0xc,%esp
+  8017ab:	57                   	push   %edi
+  8017ac:	e8 11 14 00 00       	call   802bc2 <pageref>
+  8017b1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8017b4:	89 34 24             	mov    %esi,(%esp)
+  8017b7:	e8 06 14 00 00       	call   802bc2 <pageref>
+    nn = thisenv->env_runs;
+  8017bc:	8b 15 44 57 80 00    	mov    0x805744,%edx
+  8017c2:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  8017c5:	83 c4 10             	add    $0x10,%esp
+  8017c8:	39 cb                	cmp    %ecx,%ebx
+  8017ca:	74 1b                	je     8017e7 <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  8017cc:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8017cf:	75 cf                	jne    8017a0 <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8017d1:	8b 42 58             	mov    0x58(%edx),%eax
+  8017d4:	6a 01                	push   $0x1
+  8017d6:	50                   	push   %eax
+  8017d7:	53                   	push   %ebx
+  8017d8:	68 97 2f 80 00       	push   $0x802f97
+  8017dd:	e8 5f 09 00 00       	call   802141 <cprintf>
+  8017e2:	83 c4 10             	add    $0x10,%esp
+  8017e5:	eb b9                	jmp    8017a0 <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  8017e7:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8017ea:	0f 94 c0             	sete   %al
+  8017ed:	0f b6 c0             	movzbl %al,%eax
+}
+  8017f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017f3:	5b                   	pop    %ebx
+  8017f4:	5e                   	pop    %esi
+  8017f5:	5f                   	pop    %edi
+  8017f6:	5d                   	pop    %ebp
+  8017f7:	c3                   	ret
+
+008017f8 <devpipe_write_bulk>:
+{
+  8017f8:	55                   	push   %ebp
+  8017f9:	89 e5                	mov    %esp,%ebp
+  8017fb:	57                   	push   %edi
+  8017fc:	56                   	push   %esi
+  8017fd:	53                   	push   %ebx
+  8017fe:	83 ec 1c             	sub    $0x1c,%esp
+  801801:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801804:	89 d6                	mov    %edx,%esi
+  801806:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  801809:	e8 78 fe ff ff       	call   801686 <pipe_ring>
+  80180e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  801811:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  801816:	8d 46 04             	lea    0x4(%esi),%eax
+  801819:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  80181c:	eb 75                	jmp    801893 <devpipe_write_bulk+0x9b>
+  80181e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801823:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  801827:	6a 64                	push   $0x64
+  801829:	68 00 00 c0 ee       	push   $0xeec00000
+  80182e:	53                   	push   %ebx
+  80182f:	56                   	push   %esi
+  801830:	e8 aa ec ff ff       	call   8004df <sys_chan_sleep>
+      continue;
+  801835:	83 c4 10             	add    $0x10,%esp
+  801838:	eb 59                	jmp    801893 <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  80183a:	89 d1                	mov    %edx,%ecx
+  80183c:	c1 f9 1f             	sar    $0x1f,%ecx
+  80183f:	c1 e9 11             	shr    $0x11,%ecx
+  801842:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  801845:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  80184a:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  80184c:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  801852:	29 d3                	sub    %edx,%ebx
+  801854:	ba 00 80 00 00       	mov    $0x8000,%edx
+  801859:	29 c2                	sub    %eax,%edx
+  80185b:	39 d3                	cmp    %edx,%ebx
+  80185d:	0f 47 da             	cmova  %edx,%ebx
+  801860:	8b 55 08             	mov    0x8(%ebp),%edx
+  801863:	29 fa                	sub    %edi,%edx
+  801865:	39 d3                	cmp    %edx,%ebx
+  801867:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  80186a:	83 ec 04             	sub    $0x4,%esp
+  80186d:	53                   	push   %ebx
+  80186e:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801871:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  801874:	52                   	push   %edx
+  801875:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801878:	01 c8                	add    %ecx,%eax
+  80187a:	50                   	push   %eax
+  80187b:	e8 97 10 00 00       	call   802917 <memcpy>
+    i += m;
+  801880:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  801882:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  801885:	8d 46 2c             	lea    0x2c(%esi),%eax
+  801888:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80188b:	e8 57 fe ff ff       	call   8016e7 <pipe_wakeup>
+  801890:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  801893:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  801896:	73 2b                	jae    8018c3 <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  801898:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  80189a:	8b 56 04             	mov    0x4(%esi),%edx
+  80189d:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  8018a3:	39 d0                	cmp    %edx,%eax
+  8018a5:	7d 93                	jge    80183a <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  8018a7:	89 f2                	mov    %esi,%edx
+  8018a9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8018ac:	e8 e2 fe ff ff       	call   801793 <_pipeisclosed>
+  8018b1:	85 c0                	test   %eax,%eax
+  8018b3:	0f 84 65 ff ff ff    	je     80181e <devpipe_write_bulk+0x26>
+        return i;
+  8018b9:	89 f8                	mov    %edi,%eax
+}
+  8018bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018be:	5b                   	pop    %ebx
+  8018bf:	5e                   	pop    %esi
+  8018c0:	5f                   	pop    %edi
+  8018c1:	5d                   	pop    %ebp
+  8018c2:	c3                   	ret
+  return i;
+  8018c3:	89 f8                	mov    %edi,%eax
+  8018c5:	eb f4                	jmp    8018bb <devpipe_write_bulk+0xc3>
+
+008018c7 <devpipe_write>:
+{
+  8018c7:	55                   	push   %ebp
+  8018c8:	89 e5                	mov    %esp,%ebp
+  8018ca:	57                   	push   %edi
+  8018cb:	56                   	push   %esi
+  8018cc:	53                   	push   %ebx
+  8018cd:	83 ec 28             	sub    $0x28,%esp
+  8018d0:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  8018d3:	56                   	push   %esi
+  8018d4:	e8 8c ed ff ff       	call   800665 <fd2data>
+  8018d9:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  8018db:	8b 78 28             	mov    0x28(%eax),%edi
+  8018de:	83 c4 10             	add    $0x10,%esp
+  8018e1:	85 ff                	test   %edi,%edi
+  8018e3:	75 25                	jne    80190a <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  8018e5:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8018e8:	74 66                	je     801950 <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8018ea:	8b 43 04             	mov    0x4(%ebx),%eax
+  8018ed:	8b 0b                	mov    (%ebx),%ecx
+  8018ef:	8d 51 20             	lea    0x20(%ecx),%edx
+  8018f2:	39 d0                	cmp    %edx,%eax
+  8018f4:	72 2b                	jb     801921 <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  8018f6:	89 da                	mov    %ebx,%edx
+  8018f8:	89 f0                	mov    %esi,%eax
+  8018fa:	e8 94 fe ff ff       	call   801793 <_pipeisclosed>
+  8018ff:	85 c0                	test   %eax,%eax
+  801901:	75 51                	jne    801954 <devpipe_write+0x8d>
+      sys_yield();
+  801903:	e8 3c e8 ff ff       	call   800144 <sys_yield>
+  801908:	eb e0                	jmp    8018ea <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  80190a:	83 ec 0c             	sub    $0xc,%esp
+  80190d:	ff 75 10             	push   0x10(%ebp)
+  801910:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801913:	89 c2                	mov    %eax,%edx
+  801915:	89 f0                	mov    %esi,%eax
+  801917:	e8 dc fe ff ff       	call   8017f8 <devpipe_write_bulk>
+  80191c:	83 c4 10             	add    $0x10,%esp
+  80191f:	eb 38                	jmp    801959 <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801921:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801924:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801928:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  80192b:	89 c2                	mov    %eax,%edx
+  80192d:	c1 fa 1f             	sar    $0x1f,%edx
+  801930:	89 d1                	mov    %edx,%ecx
+  801932:	c1 e9 1b             	shr    $0x1b,%ecx
+  801935:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801938:	83 e2 1f             	and    $0x1f,%edx
+  80193b:	29 ca                	sub    %ecx,%edx
+  80193d:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  801941:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  801945:	83 c0 01             	add    $0x1,%eax
+  801948:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  80194b:	83 c7 01             	add    $0x1,%edi
+  80194e:	eb 95                	jmp    8018e5 <devpipe_write+0x1e>
+  return i;
+  801950:	89 f8                	mov    %edi,%eax
+  801952:	eb 05                	jmp    801959 <devpipe_write+0x92>
+        return 0;
+  801954:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801959:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80195c:	5b                   	pop    %ebx
+  80195d:	5e                   	pop    %esi
+  80195e:	5f                   	pop    %edi
+  80195f:	5d                   	pop    %ebp
+  801960:	c3                   	ret
+
+00801961 <devpipe_read_bulk>:
+{
+  801961:	55                   	push   %ebp
+  801962:	89 e5                	mov    %esp,%ebp
+  801964:	57                   	push   %edi
+  801965:	56                   	push   %esi
+  801966:	53                   	push   %ebx
+  801967:	83 ec 2c             	sub    $0x2c,%esp
+  80196a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80196d:	89 d6                	mov    %edx,%esi
+  80196f:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801972:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  801975:	e8 0c fd ff ff       	call   801686 <pipe_ring>
+  80197a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  80197d:	85 db                	test   %ebx,%ebx
+  80197f:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801984:	0f 45 c3             	cmovne %ebx,%eax
+  801987:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80198a:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  80198f:	8d 46 30             	lea    0x30(%esi),%eax
+  801992:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  801995:	eb 50                	jmp    8019e7 <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  801997:	89 d1                	mov    %edx,%ecx
+  801999:	c1 f9 1f             	sar    $0x1f,%ecx
+  80199c:	c1 e9 11             	shr    $0x11,%ecx
+  80199f:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  8019a2:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8019a7:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  8019a9:	29 d3                	sub    %edx,%ebx
+  8019ab:	ba 00 80 00 00       	mov    $0x8000,%edx
+  8019b0:	29 c2                	sub    %eax,%edx
+  8019b2:	39 d3                	cmp    %edx,%ebx
+  8019b4:	0f 47 da             	cmova  %edx,%ebx
+  8019b7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019ba:	29 fa                	sub    %edi,%edx
+  8019bc:	39 d3                	cmp    %edx,%ebx
+  8019be:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  8019c1:	83 ec 04             	sub    $0x4,%esp
+  8019c4:	53                   	push   %ebx
+  8019c5:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8019c8:	01 c8                	add    %ecx,%eax
+  8019ca:	50                   	push   %eax
+  8019cb:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8019ce:	01 f8                	add    %edi,%eax
+  8019d0:	50                   	push   %eax
+  8019d1:	e8 41 0f 00 00       	call   802917 <memcpy>
+    i += m;
+  8019d6:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  8019d8:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8019da:	89 f2                	mov    %esi,%edx
+  8019dc:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8019df:	e8 03 fd ff ff       	call   8016e7 <pipe_wakeup>
+  8019e4:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  8019e7:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  8019ea:	73 51                	jae    801a3d <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  8019ec:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  8019ef:	8b 16                	mov    (%esi),%edx
+  8019f1:	39 da                	cmp    %ebx,%edx
+  8019f3:	75 a2                	jne    801997 <devpipe_read_bulk+0x36>
+      if (i > 0)
+  8019f5:	85 ff                	test   %edi,%edi
+  8019f7:	75 44                	jne    801a3d <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  8019f9:	89 f2                	mov    %esi,%edx
+  8019fb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8019fe:	e8 90 fd ff ff       	call   801793 <_pipeisclosed>
+  801a03:	85 c0                	test   %eax,%eax
+  801a05:	75 3a                	jne    801a41 <devpipe_read_bulk+0xe0>
+  801a07:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a0c:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  801a10:	6a 64                	push   $0x64
+  801a12:	ff 75 d4             	push   -0x2c(%ebp)
+  801a15:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  801a16:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  801a19:	50                   	push   %eax
+  801a1a:	e8 c0 ea ff ff       	call   8004df <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  801a1f:	85 c0                	test   %eax,%eax
+  801a21:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a26:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  801a29:	83 c4 10             	add    $0x10,%esp
+  801a2c:	a8 01                	test   $0x1,%al
+  801a2e:	74 b7                	je     8019e7 <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  801a30:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  801a35:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a38:	5b                   	pop    %ebx
+  801a39:	5e                   	pop    %esi
+  801a3a:	5f                   	pop    %edi
+  801a3b:	5d                   	pop    %ebp
+  801a3c:	c3                   	ret
+  return i;
+  801a3d:	89 f8                	mov    %edi,%eax
+  801a3f:	eb f4                	jmp    801a35 <devpipe_read_bulk+0xd4>
+        return 0;
+  801a41:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a46:	eb ed                	jmp    801a35 <devpipe_read_bulk+0xd4>
+
+00801a48 <devpipe_read>:
+{
+  801a48:	55                   	push   %ebp
+  801a49:	89 e5                	mov    %esp,%ebp
+  801a4b:	57                   	push   %edi
+  801a4c:	56                   	push   %esi
+  801a4d:	53                   	push   %ebx
+  801a4e:	83 ec 18             	sub    $0x18,%esp
+  801a51:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  801a54:	57                   	push   %edi
+  801a55:	e8 0b ec ff ff       	call   800665 <fd2data>
+  801a5a:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  801a5c:	8b 70 28             	mov    0x28(%eax),%esi
+  801a5f:	83 c4 10             	add    $0x10,%esp
+  801a62:	85 f6                	test   %esi,%esi
+  801a64:	75 24                	jne    801a8a <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  801a66:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801a69:	74 60                	je     801acb <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  801a6b:	8b 03                	mov    (%ebx),%eax
+  801a6d:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801a70:	75 3b                	jne    801aad <devpipe_read+0x65>
+      if (i > 0)
+  801a72:	85 f6                	test   %esi,%esi
+  801a74:	75 2d                	jne    801aa3 <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  801a76:	89 da                	mov    %ebx,%edx
+  801a78:	89 f8                	mov    %edi,%eax
+  801a7a:	e8 14 fd ff ff       	call   801793 <_pipeisclosed>
+  801a7f:	85 c0                	test   %eax,%eax
+  801a81:	75 4c                	jne    801acf <devpipe_read+0x87>
+      sys_yield();
+  801a83:	e8 bc e6 ff ff       	call   800144 <sys_yield>
+  801a88:	eb e1                	jmp    801a6b <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  801a8a:	83 ec 08             	sub    $0x8,%esp
+  801a8d:	6a 00                	push   $0x0
+  801a8f:	ff 75 10             	push   0x10(%ebp)
+  801a92:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a95:	89 c2                	mov    %eax,%edx
+  801a97:	89 f8                	mov    %edi,%eax
+  801a99:	e8 c3 fe ff ff       	call   801961 <devpipe_read_bulk>
+  801a9e:	83 c4 10             	add    $0x10,%esp
+  801aa1:	eb 02                	jmp    801aa5 <devpipe_read+0x5d>
+        return i;
+  801aa3:	89 f0                	mov    %esi,%eax
+}
+  801aa5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801aa8:	5b                   	pop    %ebx
+  801aa9:	5e                   	pop    %esi
+  801aaa:	5f                   	pop    %edi
+  801aab:	5d                   	pop    %ebp
+  801aac:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801aad:	99                   	cltd
+  801aae:	c1 ea 1b             	shr    $0x1b,%edx
+  801ab1:	01 d0                	add    %edx,%eax
+  801ab3:	83 e0 1f             	and    $0x1f,%eax
+  801ab6:	29 d0                	sub    %edx,%eax
+  801ab8:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801abd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ac0:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  801ac3:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  801ac6:	83 c6 01             	add    $0x1,%esi
+  801ac9:	eb 9b                	jmp    801a66 <devpipe_read+0x1e>
+  return i;
+  801acb:	89 f0                	mov    %esi,%eax
+  801acd:	eb d6                	jmp    801aa5 <devpipe_read+0x5d>
+        return 0;
+  801acf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ad4:	eb cf                	jmp    801aa5 <devpipe_read+0x5d>
+
+00801ad6 <pipe2>:
+{
+  801ad6:	55                   	push   %ebp
+  801ad7:	89 e5                	mov    %esp,%ebp
+  801ad9:	57                   	push   %edi
+  801ada:	56                   	push   %esi
+  801adb:	53                   	push   %ebx
+  801adc:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  801adf:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801ae2:	50                   	push   %eax
+  801ae3:	e8 91 eb ff ff       	call   800679 <fd_alloc>
+  801ae8:	89 c3                	mov    %eax,%ebx
+  801aea:	83 c4 10             	add    $0x10,%esp
+  801aed:	85 c0                	test   %eax,%eax
+  801aef:	0f 88 fb 01 00 00    	js     801cf0 <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801af5:	83 ec 04             	sub    $0x4,%esp
+  801af8:	68 07 04 00 00       	push   $0x407
+  801afd:	ff 75 e4             	push   -0x1c(%ebp)
+  801b00:	6a 00                	push   $0x0
+  801b02:	e8 9f e6 ff ff       	call   8001a6 <sys_page_alloc>
+  801b07:	89 c3                	mov    %eax,%ebx
+  801b09:	83 c4 10             	add    $0x10,%esp
+  801b0c:	85 c0                	test   %eax,%eax
+  801b0e:	0f 88 dc 01 00 00    	js     801cf0 <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  801b14:	83 ec 0c             	sub    $0xc,%esp
+  801b17:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801b1a:	50                   	push   %eax
+  801b1b:	e8 59 eb ff ff       	call   800679 <fd_alloc>
+  801b20:	89 c3                	mov    %eax,%ebx
+  801b22:	83 c4 10             	add    $0x10,%esp
+  801b25:	85 c0                	test   %eax,%eax
+  801b27:	0f 88 b3 01 00 00    	js     801ce0 <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801b2d:	83 ec 04             	sub    $0x4,%esp
+  801b30:	68 07 04 00 00       	push   $0x407
+  801b35:	ff 75 e0             	push   -0x20(%ebp)
+  801b38:	6a 00                	push   $0x0
+  801b3a:	e8 67 e6 ff ff       	call   8001a6 <sys_page_alloc>
+  801b3f:	89 c3                	mov    %eax,%ebx
+  801b41:	83 c4 10             	add    $0x10,%esp
+  801b44:	85 c0                	test   %eax,%eax
+  801b46:	0f 88 94 01 00 00    	js     801ce0 <pipe2+0x20a>
+  va = fd2data(fd0);
+  801b4c:	83 ec 0c             	sub    $0xc,%esp
+  801b4f:	ff 75 e4             	push   -0x1c(%ebp)
+  801b52:	e8 0e eb ff ff       	call   800665 <fd2data>
+  801b57:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801b59:	83 c4 0c             	add    $0xc,%esp
+  801b5c:	68 07 04 00 00       	push   $0x407
+  801b61:	50                   	push   %eax
+  801b62:	6a 00                	push   $0x0
+  801b64:	e8 3d e6 ff ff       	call   8001a6 <sys_page_alloc>
+  801b69:	89 c3                	mov    %eax,%ebx
+  801b6b:	83 c4 10             	add    $0x10,%esp
+  801b6e:	85 c0                	test   %eax,%eax
+  801b70:	0f 88 5a 01 00 00    	js     801cd0 <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801b76:	83 ec 0c             	sub    $0xc,%esp
+  801b79:	ff 75 e0             	push   -0x20(%ebp)
+  801b7c:	e8 e4 ea ff ff       	call   800665 <fd2data>
+  801b81:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  801b88:	50                   	push   %eax
+  801b89:	6a 00                	push   $0x0
+  801b8b:	57                   	push   %edi
+  801b8c:	6a 00                	push   $0x0
+  801b8e:	e8 56 e6 ff ff       	call   8001e9 <sys_page_map>
+  801b93:	89 c3                	mov    %eax,%ebx
+  801b95:	83 c4 20             	add    $0x20,%esp
+  801b98:	85 c0                	test   %eax,%eax
+  801b9a:	0f 88 22 01 00 00    	js     801cc2 <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  801ba0:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  801ba4:	74 72                	je     801c18 <pipe2+0x142>
+  801ba6:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  801bab:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801bae:	e8 d3 fa ff ff       	call   801686 <pipe_ring>
+  801bb3:	83 ec 04             	sub    $0x4,%esp
+  801bb6:	68 07 04 00 00       	push   $0x407
+  801bbb:	01 f0                	add    %esi,%eax
+  801bbd:	50                   	push   %eax
+  801bbe:	6a 00                	push   $0x0
+  801bc0:	e8 e1 e5 ff ff       	call   8001a6 <sys_page_alloc>
+  801bc5:	89 c3                	mov    %eax,%ebx
+  801bc7:	83 c4 10             	add    $0x10,%esp
+  801bca:	85 c0                	test   %eax,%eax
+  801bcc:	0f 88 97 00 00 00    	js     801c69 <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  801bd2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801bd5:	e8 ac fa ff ff       	call   801686 <pipe_ring>
+  801bda:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  801bdd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801be0:	e8 a1 fa ff ff       	call   801686 <pipe_ring>
+  801be5:	83 ec 0c             	sub    $0xc,%esp
+  801be8:	68 07 04 00 00       	push   $0x407
+  801bed:	53                   	push   %ebx
+  801bee:	6a 00                	push   $0x0
+  801bf0:	01 f0                	add    %esi,%eax
+  801bf2:	50                   	push   %eax
+  801bf3:	6a 00                	push   $0x0
+  801bf5:	e8 ef e5 ff ff       	call   8001e9 <sys_page_map>
+  801bfa:	89 c3                	mov    %eax,%ebx
+  801bfc:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801c02:	83 c4 20             	add    $0x20,%esp
+  801c05:	85 c0                	test   %eax,%eax
+  801c07:	78 60                	js     801c69 <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  801c09:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  801c0f:	75 9a                	jne    801bab <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  801c11:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  801c18:	a1 20 40 80 00       	mov    0x804020,%eax
+  801c1d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801c20:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  801c22:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801c25:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  801c2c:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801c2f:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  801c31:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801c34:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  801c3b:	83 ec 0c             	sub    $0xc,%esp
+  801c3e:	ff 75 e4             	push   -0x1c(%ebp)
+  801c41:	e8 0f ea ff ff       	call   800655 <fd2num>
+  801c46:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801c49:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  801c4b:	83 c4 04             	add    $0x4,%esp
+  801c4e:	ff 75 e0             	push   -0x20(%ebp)
+  801c51:	e8 ff e9 ff ff       	call   800655 <fd2num>
+  801c56:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801c59:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  801c5c:	83 c4 10             	add    $0x10,%esp
+  801c5f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c64:	e9 87 00 00 00       	jmp    801cf0 <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  801c69:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  801c6e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801c71:	e8 10 fa ff ff       	call   801686 <pipe_ring>
+  801c76:	83 ec 08             	sub    $0x8,%esp
+  801c79:	01 f0                	add    %esi,%eax
+  801c7b:	50                   	push   %eax
+  801c7c:	6a 00                	push   $0x0
+  801c7e:	e8 a8 e5 ff ff       	call   80022b <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  801c83:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801c86:	e8 fb f9 ff ff       	call   801686 <pipe_ring>
+  801c8b:	83 c4 08             	add    $0x8,%esp
+  801c8e:	01 f0                	add    %esi,%eax
+  801c90:	50                   	push   %eax
+  801c91:	6a 00                	push   $0x0
+  801c93:	e8 93 e5 ff ff       	call   80022b <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  801c98:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801c9e:	83 c4 10             	add    $0x10,%esp
+  801ca1:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  801ca7:	75 c5                	jne    801c6e <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  801ca9:	83 ec 0c             	sub    $0xc,%esp
+  801cac:	ff 75 e0             	push   -0x20(%ebp)
+  801caf:	e8 b1 e9 ff ff       	call   800665 <fd2data>
+  801cb4:	83 c4 08             	add    $0x8,%esp
+  801cb7:	50                   	push   %eax
+  801cb8:	6a 00                	push   $0x0
+  801cba:	e8 6c e5 ff ff       	call   80022b <sys_page_unmap>
+  801cbf:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  801cc2:	83 ec 08             	sub    $0x8,%esp
+  801cc5:	57                   	push   %edi
+  801cc6:	6a 00                	push   $0x0
+  801cc8:	e8 5e e5 ff ff       	call   80022b <sys_page_unmap>
+  801ccd:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  801cd0:	83 ec 08             	sub    $0x8,%esp
+  801cd3:	ff 75 e0             	push   -0x20(%ebp)
+  801cd6:	6a 00                	push   $0x0
+  801cd8:	e8 4e e5 ff ff       	call   80022b <sys_page_unmap>
+  801cdd:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  801ce0:	83 ec 08             	sub    $0x8,%esp
+  801ce3:	ff 75 e4             	push   -0x1c(%ebp)
+  801ce6:	6a 00                	push   $0x0
+  801ce8:	e8 3e e5 ff ff       	call   80022b <sys_page_unmap>
+  801ced:	83 c4 10             	add    $0x10,%esp
+}
+  801cf0:	89 d8                	mov    %ebx,%eax
+  801cf2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cf5:	5b                   	pop    %ebx
+  801cf6:	5e                   	pop    %esi
+  801cf7:	5f                   	pop    %edi
+  801cf8:	5d                   	pop    %ebp
+  801cf9:	c3                   	ret
+
+00801cfa <pipe>:
+{
+  801cfa:	55                   	push   %ebp
+  801cfb:	89 e5                	mov    %esp,%ebp
+  801cfd:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  801d00:	6a 00                	push   $0x0
+  801d02:	ff 75 08             	push   0x8(%ebp)
+  801d05:	e8 cc fd ff ff       	call   801ad6 <pipe2>
+}
+  801d0a:	c9                   	leave
+  801d0b:	c3                   	ret
+
+00801d0c <pipeisclosed>:
+{
+  801d0c:	55                   	push   %ebp
+  801d0d:	89 e5                	mov    %esp,%ebp
+  801d0f:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801d12:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d15:	50                   	push   %eax
+  801d16:	ff 75 08             	push   0x8(%ebp)
+  801d19:	e8 b1 e9 ff ff       	call   8006cf <fd_lookup>
+  801d1e:	83 c4 10             	add    $0x10,%esp
+  801d21:	85 c0                	test   %eax,%eax
+  801d23:	78 18                	js     801d3d <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  801d25:	83 ec 0c             	sub    $0xc,%esp
+  801d28:	ff 75 f4             	push   -0xc(%ebp)
+  801d2b:	e8 35 e9 ff ff       	call   800665 <fd2data>
+  801d30:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  801d32:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d35:	e8 59 fa ff ff       	call   801793 <_pipeisclosed>
+  801d3a:	83 c4 10             	add    $0x10,%esp
+}
+  801d3d:	c9                   	leave
+  801d3e:	c3                   	ret
+
+00801d3f <pipe_splice>:
+{
+  801d3f:	55                   	push   %ebp
+  801d40:	89 e5                	mov    %esp,%ebp
+  801d42:	57                   	push   %edi
+  801d43:	56                   	push   %esi
+  801d44:	53                   	push   %ebx
+  801d45:	83 ec 34             	sub    $0x34,%esp
+  801d48:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801d4b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801d4e:	50                   	push   %eax
+  801d4f:	ff 75 08             	push   0x8(%ebp)
+  801d52:	e8 78 e9 ff ff       	call   8006cf <fd_lookup>
+  801d57:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801d5a:	83 c4 10             	add    $0x10,%esp
+  801d5d:	85 c0                	test   %eax,%eax
+  801d5f:	0f 88 d7 00 00 00    	js     801e3c <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  801d65:	83 ec 0c             	sub    $0xc,%esp
+  801d68:	ff 75 e4             	push   -0x1c(%ebp)
+  801d6b:	e8 f5 e8 ff ff       	call   800665 <fd2data>
+  801d70:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  801d72:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801d75:	83 c4 10             	add    $0x10,%esp
+  801d78:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801d7e:	39 10                	cmp    %edx,(%eax)
+  801d80:	0f 85 c1 00 00 00    	jne    801e47 <pipe_splice+0x108>
+  801d86:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  801d8a:	0f 84 c0 00 00 00    	je     801e50 <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  801d90:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  801d94:	0f 84 bf 00 00 00    	je     801e59 <pipe_splice+0x11a>
+  801d9a:	89 f7                	mov    %esi,%edi
+  801d9c:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  801da2:	0f 85 ba 00 00 00    	jne    801e62 <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  801da8:	8d 43 04             	lea    0x4(%ebx),%eax
+  801dab:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801dae:	eb 38                	jmp    801de8 <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  801db0:	83 ec 0c             	sub    $0xc,%esp
+  801db3:	68 00 10 00 00       	push   $0x1000
+  801db8:	89 f1                	mov    %esi,%ecx
+  801dba:	89 da                	mov    %ebx,%edx
+  801dbc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801dbf:	e8 34 fa ff ff       	call   8017f8 <devpipe_write_bulk>
+  801dc4:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801dc7:	83 c4 10             	add    $0x10,%esp
+  801dca:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801dcf:	75 53                	jne    801e24 <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  801dd1:	83 ec 08             	sub    $0x8,%esp
+  801dd4:	56                   	push   %esi
+  801dd5:	6a 00                	push   $0x0
+  801dd7:	e8 4f e4 ff ff       	call   80022b <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  801ddc:	83 c7 01             	add    $0x1,%edi
+  801ddf:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801de5:	83 c4 10             	add    $0x10,%esp
+  801de8:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801deb:	74 3a                	je     801e27 <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  801ded:	8b 03                	mov    (%ebx),%eax
+  801def:	39 43 04             	cmp    %eax,0x4(%ebx)
+  801df2:	75 bc                	jne    801db0 <pipe_splice+0x71>
+  801df4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801df9:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  801dfd:	85 c0                	test   %eax,%eax
+  801dff:	74 af                	je     801db0 <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  801e01:	83 ec 04             	sub    $0x4,%esp
+  801e04:	6a 07                	push   $0x7
+  801e06:	56                   	push   %esi
+  801e07:	ff 75 d0             	push   -0x30(%ebp)
+  801e0a:	e8 f3 e6 ff ff       	call   800502 <sys_chan_wakeup>
+  801e0f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801e12:	83 c4 10             	add    $0x10,%esp
+  801e15:	85 c0                	test   %eax,%eax
+  801e17:	79 b8                	jns    801dd1 <pipe_splice+0x92>
+  801e19:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e1e:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  801e22:	eb 8c                	jmp    801db0 <pipe_splice+0x71>
+  801e24:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  801e27:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801e2b:	75 06                	jne    801e33 <pipe_splice+0xf4>
+  801e2d:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  801e31:	78 09                	js     801e3c <pipe_splice+0xfd>
+  return i * PGSIZE;
+  801e33:	8b 45 10             	mov    0x10(%ebp),%eax
+  801e36:	c1 e0 0c             	shl    $0xc,%eax
+  801e39:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  801e3c:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801e3f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e42:	5b                   	pop    %ebx
+  801e43:	5e                   	pop    %esi
+  801e44:	5f                   	pop    %edi
+  801e45:	5d                   	pop    %ebp
+  801e46:	c3                   	ret
+    return -E_INVAL;
+  801e47:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  801e4e:	eb ec                	jmp    801e3c <pipe_splice+0xfd>
+  801e50:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  801e57:	eb e3                	jmp    801e3c <pipe_splice+0xfd>
+  801e59:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  801e60:	eb da                	jmp    801e3c <pipe_splice+0xfd>
+  801e62:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  801e69:	eb d1                	jmp    801e3c <pipe_splice+0xfd>
+
+00801e6b <pipe_splice_read>:
+{
+  801e6b:	55                   	push   %ebp
+  801e6c:	89 e5                	mov    %esp,%ebp
+  801e6e:	53                   	push   %ebx
+  801e6f:	83 ec 1c             	sub    $0x1c,%esp
+  801e72:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801e75:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e78:	50                   	push   %eax
+  801e79:	ff 75 08             	push   0x8(%ebp)
+  801e7c:	e8 4e e8 ff ff       	call   8006cf <fd_lookup>
+  801e81:	83 c4 10             	add    $0x10,%esp
+  801e84:	85 c0                	test   %eax,%eax
+  801e86:	78 49                	js     801ed1 <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  801e88:	83 ec 0c             	sub    $0xc,%esp
+  801e8b:	ff 75 f4             	push   -0xc(%ebp)
+  801e8e:	e8 d2 e7 ff ff       	call   800665 <fd2data>
+  801e93:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  801e95:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e98:	83 c4 10             	add    $0x10,%esp
+  801e9b:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  801ea1:	39 08                	cmp    %ecx,(%eax)
+  801ea3:	75 31                	jne    801ed6 <pipe_splice_read+0x6b>
+  801ea5:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  801ea9:	74 32                	je     801edd <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  801eab:	8b 48 08             	mov    0x8(%eax),%ecx
+  801eae:	83 e1 03             	and    $0x3,%ecx
+  801eb1:	83 f9 01             	cmp    $0x1,%ecx
+  801eb4:	74 2e                	je     801ee4 <pipe_splice_read+0x79>
+  801eb6:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  801ebc:	75 2d                	jne    801eeb <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  801ebe:	83 ec 08             	sub    $0x8,%esp
+  801ec1:	53                   	push   %ebx
+  801ec2:	68 00 10 00 00       	push   $0x1000
+  801ec7:	89 d9                	mov    %ebx,%ecx
+  801ec9:	e8 93 fa ff ff       	call   801961 <devpipe_read_bulk>
+  801ece:	83 c4 10             	add    $0x10,%esp
+}
+  801ed1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ed4:	c9                   	leave
+  801ed5:	c3                   	ret
+    return -E_INVAL;
+  801ed6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801edb:	eb f4                	jmp    801ed1 <pipe_splice_read+0x66>
+  801edd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ee2:	eb ed                	jmp    801ed1 <pipe_splice_read+0x66>
+  801ee4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ee9:	eb e6                	jmp    801ed1 <pipe_splice_read+0x66>
+  801eeb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ef0:	eb df                	jmp    801ed1 <pipe_splice_read+0x66>
+
+00801ef2 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  801ef2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ef7:	c3                   	ret
+
+00801ef8 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  801ef8:	55                   	push   %ebp
+  801ef9:	89 e5                	mov    %esp,%ebp
+  801efb:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  801efe:	68 af 2f 80 00       	push   $0x802faf
+  801f03:	ff 75 0c             	push   0xc(%ebp)
+  801f06:	e8 24 08 00 00       	call   80272f <strcpy>
+  return 0;
+}
+  801f0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f10:	c9                   	leave
+  801f11:	c3                   	ret
+
+00801f12 <devcons_write>:
+{
+  801f12:	55                   	push   %ebp
+  801f13:	89 e5                	mov    %esp,%ebp
+  801f15:	57                   	push   %edi
+  801f16:	56                   	push   %esi
+  801f17:	53                   	push   %ebx
+  801f18:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  801f1e:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  801f23:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  801f29:	eb 2e                	jmp    801f59 <devcons_write+0x47>
+    m = n - tot;
+  801f2b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f2e:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  801f30:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801f35:	39 c3                	cmp    %eax,%ebx
+  801f37:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  801f3a:	83 ec 04             	sub    $0x4,%esp
+  801f3d:	53                   	push   %ebx
+  801f3e:	89 f0                	mov    %esi,%eax
+  801f40:	03 45 0c             	add    0xc(%ebp),%eax
+  801f43:	50                   	push   %eax
+  801f44:	57                   	push   %edi
+  801f45:	e8 6b 09 00 00       	call   8028b5 <memmove>
+    sys_cputs(buf, m);
+  801f4a:	83 c4 08             	add    $0x8,%esp
+  801f4d:	53                   	push   %ebx
+  801f4e:	57                   	push   %edi
+  801f4f:	e8 53 e1 ff ff       	call   8000a7 <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  801f54:	01 de                	add    %ebx,%esi
+  801f56:	83 c4 10             	add    $0x10,%esp
+  801f59:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801f5c:	72 cd                	jb     801f2b <devcons_write+0x19>
+}
+  801f5e:	89 f0                	mov    %esi,%eax
+  801f60:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f63:	5b                   	pop    %ebx
+  801f64:	5e                   	pop    %esi
+  801f65:	5f                   	pop    %edi
+  801f66:	5d                   	pop    %ebp
+  801f67:	c3                   	ret
+
+00801f68 <devcons_read>:
+{
+  801f68:	55                   	push   %ebp
+  801f69:	89 e5                	mov    %esp,%ebp
+  801f6b:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  801f6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f73:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801f77:	75 07                	jne    801f80 <devcons_read+0x18>
+  801f79:	eb 1f                	jmp    801f9a <devcons_read+0x32>
+    sys_yield();
+  801f7b:	e8 c4 e1 ff ff       	call   800144 <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  801f80:	e8 40 e1 ff ff       	call   8000c5 <sys_cgetc>
+  801f85:	85 c0                	test   %eax,%eax
+  801f87:	74 f2                	je     801f7b <devcons_read+0x13>
+  if (c < 0)
+  801f89:	78 0f                	js     801f9a <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  801f8b:	83 f8 04             	cmp    $0x4,%eax
+  801f8e:	74 0c                	je     801f9c <devcons_read+0x34>
+  *(char*)vbuf = c;
+  801f90:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801f93:	88 02                	mov    %al,(%edx)
+  return 1;
+  801f95:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  801f9a:	c9                   	leave
+  801f9b:	c3                   	ret
+    return 0;
+  801f9c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fa1:	eb f7                	jmp    801f9a <devcons_read+0x32>
+
+00801fa3 <cputchar>:
+{
+  801fa3:	55                   	push   %ebp
+  801fa4:	89 e5                	mov    %esp,%ebp
+  801fa6:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  801fa9:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fac:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  801faf:	6a 01                	push   $0x1
+  801fb1:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801fb4:	50                   	push   %eax
+  801fb5:	e8 ed e0 ff ff       	call   8000a7 <sys_cputs>
+}
+  801fba:	83 c4 10             	add    $0x10,%esp
+  801fbd:	c9                   	leave
+  801fbe:	c3                   	ret
+
+00801fbf <getchar>:
+{
+  801fbf:	55                   	push   %ebp
+  801fc0:	89 e5                	mov    %esp,%ebp
+  801fc2:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  801fc5:	6a 01                	push   $0x1
+  801fc7:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801fca:	50                   	push   %eax
+  801fcb:	6a 00                	push   $0x0
+  801fcd:	e8 a8 e9 ff ff       	call   80097a <read>
+  if (r < 0)
+  801fd2:	83 c4 10             	add    $0x10,%esp
+  801fd5:	85 c0                	test   %eax,%eax
+  801fd7:	78 06                	js     801fdf <getchar+0x20>
+  if (r < 1)
+  801fd9:	74 06                	je     801fe1 <getchar+0x22>
+  return c;
+  801fdb:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  801fdf:	c9                   	leave
+  801fe0:	c3                   	ret
+    return -E_EOF;
+  801fe1:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  801fe6:	eb f7                	jmp    801fdf <getchar+0x20>
+
+00801fe8 <iscons>:
+{
+  801fe8:	55                   	push   %ebp
+  801fe9:	89 e5                	mov    %esp,%ebp
+  801feb:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801fee:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ff1:	50                   	push   %eax
+  801ff2:	ff 75 08             	push   0x8(%ebp)
+  801ff5:	e8 d5 e6 ff ff       	call   8006cf <fd_lookup>
+  801ffa:	83 c4 10             	add    $0x10,%esp
+  801ffd:	85 c0                	test   %eax,%eax
+  801fff:	78 11                	js     802012 <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  802001:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802004:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  80200a:	39 10                	cmp    %edx,(%eax)
+  80200c:	0f 94 c0             	sete   %al
+  80200f:	0f b6 c0             	movzbl %al,%eax
+}
+  802012:	c9                   	leave
+  802013:	c3                   	ret
+
+00802014 <opencons>:
+{
+  802014:	55                   	push   %ebp
+  802015:	89 e5                	mov    %esp,%ebp
+  802017:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  80201a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80201d:	50                   	push   %eax
+  80201e:	e8 56 e6 ff ff       	call   800679 <fd_alloc>
+  802023:	83 c4 10             	add    $0x10,%esp
+  802026:	85 c0                	test   %eax,%eax
+  802028:	78 3a                	js     802064 <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80202a:	83 ec 04             	sub    $0x4,%esp
+  80202d:	68 07 04 00 00       	push   $0x407
+  802032:	ff 75 f4             	push   -0xc(%ebp)
+  802035:	6a 00                	push   $0x0
+  802037:	e8 6a e1 ff ff       	call   8001a6 <sys_page_alloc>
+  80203c:	83 c4 10             	add    $0x10,%esp
+  80203f:	85 c0                	test   %eax,%eax
+  802041:	78 21                	js     802064 <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  802043:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802046:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  80204c:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  80204e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802051:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  802058:	83 ec 0c             	sub    $0xc,%esp
+  80205b:	50                   	push   %eax
+  80205c:	e8 f4 e5 ff ff       	call   800655 <fd2num>
+  802061:	83 c4 10             	add    $0x10,%esp
+}
+  802064:	c9                   	leave
+  802065:	c3                   	ret
+
+00802066 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  802066:	55                   	push   %ebp
+  802067:	89 e5                	mov    %esp,%ebp
+  802069:	56                   	push   %esi
+  80206a:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  80206b:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  80206e:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  802074:	e8 ac e0 ff ff       	call   800125 <sys_getenvid>
+  802079:	83 ec 0c             	sub    $0xc,%esp
+  80207c:	ff 75 0c             	push   0xc(%ebp)
+  80207f:	ff 75 08             	push   0x8(%ebp)
+  802082:	56                   	push   %esi
+  802083:	50                   	push   %eax
+  802084:	68 bc 2f 80 00       	push   $0x802fbc
+  802089:	e8 b3 00 00 00       	call   802141 <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  80208e:	83 c4 18             	add    $0x18,%esp
+  802091:	53                   	push   %ebx
+  802092:	ff 75 10             	push   0x10(%ebp)
+  802095:	e8 56 00 00 00       	call   8020f0 <vcprintf>
+  cprintf("\n");
+  80209a:	c7 04 24 a8 2f 80 00 	movl   $0x802fa8,(%esp)
+  8020a1:	e8 9b 00 00 00       	call   802141 <cprintf>
+  8020a6:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  8020a9:	cc                   	int3
+  while (1)
+  8020aa:	eb fd                	jmp    8020a9 <_panic+0x43>
+
+008020ac <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8020ac:	55                   	push   %ebp
+  8020ad:	89 e5                	mov    %esp,%ebp
+  8020af:	53                   	push   %ebx
+  8020b0:	83 ec 04             	sub    $0x4,%esp
+  8020b3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  8020b6:	8b 13                	mov    (%ebx),%edx
+  8020b8:	8d 42 01             	lea    0x1(%edx),%eax
+  8020bb:	89 03                	mov    %eax,(%ebx)
+  8020bd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8020c0:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  8020c4:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8020c9:	74 09                	je     8020d4 <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  8020cb:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8020cf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020d2:	c9                   	leave
+  8020d3:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  8020d4:	83 ec 08             	sub    $0x8,%esp
+  8020d7:	68 ff 00 00 00       	push   $0xff
+  8020dc:	8d 43 08             	lea    0x8(%ebx),%eax
+  8020df:	50                   	push   %eax
+  8020e0:	e8 c2 df ff ff       	call   8000a7 <sys_cputs>
+    b->idx = 0;
+  8020e5:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8020eb:	83 c4 10             	add    $0x10,%esp
+  8020ee:	eb db                	jmp    8020cb <putch+0x1f>
+
+008020f0 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8020f0:	55                   	push   %ebp
+  8020f1:	89 e5                	mov    %esp,%ebp
+  8020f3:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  8020f9:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  802100:	00 00 00 
+  b.cnt = 0;
+  802103:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80210a:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  80210d:	ff 75 0c             	push   0xc(%ebp)
+  802110:	ff 75 08             	push   0x8(%ebp)
+  802113:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  802119:	50                   	push   %eax
+  80211a:	68 ac 20 80 00       	push   $0x8020ac
+  80211f:	e8 14 01 00 00       	call   802238 <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  802124:	83 c4 08             	add    $0x8,%esp
+  802127:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80212d:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  802133:	50                   	push   %eax
+  802134:	e8 6e df ff ff       	call   8000a7 <sys_cputs>
+
+  return b.cnt;
+}
+  802139:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80213f:	c9                   	leave
+  802140:	c3                   	ret
+
+00802141 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  802141:	55                   	push   %ebp
+  802142:	89 e5                	mov    %esp,%ebp
+  802144:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  802147:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  80214a:	50                   	push   %eax
+  80214b:	ff 75 08             	push   0x8(%ebp)
+  80214e:	e8 9d ff ff ff       	call   8020f0 <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  802153:	c9                   	leave
+  802154:	c3                   	ret
+
+00802155 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  802155:	55                   	push   %ebp
+  802156:	89 e5                	mov    %esp,%ebp
+  802158:	57                   	push   %edi
+  802159:	56                   	push   %esi
+  80215a:	53                   	push   %ebx
+  80215b:	83 ec 1c             	sub    $0x1c,%esp
+  80215e:	89 c7                	mov    %eax,%edi
+  802160:	89 d6                	mov    %edx,%esi
+  802162:	8b 45 08             	mov    0x8(%ebp),%eax
+  802165:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802168:	89 d1                	mov    %edx,%ecx
+  80216a:	89 c2                	mov    %eax,%edx
+  80216c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80216f:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802172:	8b 45 10             	mov    0x10(%ebp),%eax
+  802175:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  802178:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80217b:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802182:	39 c2                	cmp    %eax,%edx
+  802184:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  802187:	72 3e                	jb     8021c7 <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  802189:	83 ec 0c             	sub    $0xc,%esp
+  80218c:	ff 75 18             	push   0x18(%ebp)
+  80218f:	83 eb 01             	sub    $0x1,%ebx
+  802192:	53                   	push   %ebx
+  802193:	50                   	push   %eax
+  802194:	83 ec 08             	sub    $0x8,%esp
+  802197:	ff 75 e4             	push   -0x1c(%ebp)
+  80219a:	ff 75 e0             	push   -0x20(%ebp)
+  80219d:	ff 75 dc             	push   -0x24(%ebp)
+  8021a0:	ff 75 d8             	push   -0x28(%ebp)
+  8021a3:	e8 1c 0b 00 00       	call   802cc4 <__udivdi3>
+  8021a8:	83 c4 18             	add    $0x18,%esp
+  8021ab:	52                   	push   %edx
+  8021ac:	50                   	push   %eax
+  8021ad:	89 f2                	mov    %esi,%edx
+  8021af:	89 f8                	mov    %edi,%eax
+  8021b1:	e8 9f ff ff ff       	call   802155 <printnum>
+  8021b6:	83 c4 20             	add    $0x20,%esp
+  8021b9:	eb 13                	jmp    8021ce <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  8021bb:	83 ec 08             	sub    $0x8,%esp
+  8021be:	56                   	push   %esi
+  8021bf:	ff 75 18             	push   0x18(%ebp)
+  8021c2:	ff d7                	call   *%edi
+  8021c4:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  8021c7:	83 eb 01             	sub    $0x1,%ebx
+  8021ca:	85 db                	test   %ebx,%ebx
+  8021cc:	7f ed                	jg     8021bb <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  8021ce:	83 ec 08             	sub    $0x8,%esp
+  8021d1:	56                   	push   %esi
+  8021d2:	83 ec 04             	sub    $0x4,%esp
+  8021d5:	ff 75 e4             	push   -0x1c(%ebp)
+  8021d8:	ff 75 e0             	push   -0x20(%ebp)
+  8021db:	ff 75 dc             	push   -0x24(%ebp)
+  8021de:	ff 75 d8             	push   -0x28(%ebp)
+  8021e1:	e8 ff 0a 00 00       	call   802ce5 <__umoddi3>
+  8021e6:	83 c4 14             	add    $0x14,%esp
+  8021e9:	0f be 80 df 2f 80 00 	movsbl 0x802fdf(%eax),%eax
+  8021f0:	50                   	push   %eax
+  8021f1:	ff d7                	call   *%edi
+}
+  8021f3:	83 c4 10             	add    $0x10,%esp
+  8021f6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021f9:	5b                   	pop    %ebx
+  8021fa:	5e                   	pop    %esi
+  8021fb:	5f                   	pop    %edi
+  8021fc:	5d                   	pop    %ebp
+  8021fd:	c3                   	ret
+
+008021fe <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8021fe:	55                   	push   %ebp
+  8021ff:	89 e5                	mov    %esp,%ebp
+  802201:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  802204:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  802208:	8b 10                	mov    (%eax),%edx
+  80220a:	3b 50 04             	cmp    0x4(%eax),%edx
+  80220d:	73 0a                	jae    802219 <sprintputch+0x1b>
+    *b->buf++ = ch;
+  80220f:	8d 4a 01             	lea    0x1(%edx),%ecx
+  802212:	89 08                	mov    %ecx,(%eax)
+  802214:	8b 45 08             	mov    0x8(%ebp),%eax
+  802217:	88 02                	mov    %al,(%edx)
+}
+  802219:	5d                   	pop    %ebp
+  80221a:	c3                   	ret
+
+0080221b <printfmt>:
+{
+  80221b:	55                   	push   %ebp
+  80221c:	89 e5                	mov    %esp,%ebp
+  80221e:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  802221:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  802224:	50                   	push   %eax
+  802225:	ff 75 10             	push   0x10(%ebp)
+  802228:	ff 75 0c             	push   0xc(%ebp)
+  80222b:	ff 75 08             	push   0x8(%ebp)
+  80222e:	e8 05 00 00 00       	call   802238 <vprintfmt>
+}
+  802233:	83 c4 10             	add    $0x10,%esp
+  802236:	c9                   	leave
+  802237:	c3                   	ret
+
+00802238 <vprintfmt>:
+{
+  802238:	55                   	push   %ebp
+  802239:	89 e5                	mov    %esp,%ebp
+  80223b:	57                   	push   %edi
+  80223c:	56                   	push   %esi
+  80223d:	53                   	push   %ebx
+  80223e:	83 ec 2c             	sub    $0x2c,%esp
+  802241:	8b 75 08             	mov    0x8(%ebp),%esi
+  802244:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802247:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80224a:	eb 0a                	jmp    802256 <vprintfmt+0x1e>
+      putch(ch, putdat);
+  80224c:	83 ec 08             	sub    $0x8,%esp
+  80224f:	53                   	push   %ebx
+  802250:	50                   	push   %eax
+  802251:	ff d6                	call   *%esi
+  802253:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  802256:	83 c7 01             	add    $0x1,%edi
+  802259:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80225d:	83 f8 25             	cmp    $0x25,%eax
+  802260:	74 0c                	je     80226e <vprintfmt+0x36>
+      if (ch == '\0')
+  802262:	85 c0                	test   %eax,%eax
+  802264:	75 e6                	jne    80224c <vprintfmt+0x14>
+}
+  802266:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802269:	5b                   	pop    %ebx
+  80226a:	5e                   	pop    %esi
+  80226b:	5f                   	pop    %edi
+  80226c:	5d                   	pop    %ebp
+  80226d:	c3                   	ret
+    padc = ' ';
+  80226e:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  802272:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  802279:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  802280:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  802287:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  80228c:	8d 47 01             	lea    0x1(%edi),%eax
+  80228f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802292:	0f b6 17             	movzbl (%edi),%edx
+  802295:	8d 42 dd             	lea    -0x23(%edx),%eax
+  802298:	3c 55                	cmp    $0x55,%al
+  80229a:	0f 87 cf 03 00 00    	ja     80266f <vprintfmt+0x437>
+  8022a0:	0f b6 c0             	movzbl %al,%eax
+  8022a3:	ff 24 85 20 31 80 00 	jmp    *0x803120(,%eax,4)
+  8022aa:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  8022ad:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8022b1:	eb d9                	jmp    80228c <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  8022b3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8022b6:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8022ba:	eb d0                	jmp    80228c <vprintfmt+0x54>
+  8022bc:	0f b6 d2             	movzbl %dl,%edx
+  8022bf:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  8022c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022c7:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  8022ca:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8022cd:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  8022d1:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  8022d4:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8022d7:	83 f9 09             	cmp    $0x9,%ecx
+  8022da:	77 55                	ja     802331 <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  8022dc:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  8022df:	eb e9                	jmp    8022ca <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  8022e1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8022e4:	8b 00                	mov    (%eax),%eax
+  8022e6:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8022e9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8022ec:	8d 40 04             	lea    0x4(%eax),%eax
+  8022ef:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  8022f2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  8022f5:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8022f9:	79 91                	jns    80228c <vprintfmt+0x54>
+        width = precision, precision = -1;
+  8022fb:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8022fe:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802301:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  802308:	eb 82                	jmp    80228c <vprintfmt+0x54>
+      if (width < 0)
+  80230a:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80230d:	85 d2                	test   %edx,%edx
+  80230f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802314:	0f 49 c2             	cmovns %edx,%eax
+  802317:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  80231a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  80231d:	e9 6a ff ff ff       	jmp    80228c <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  802322:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  802325:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  80232c:	e9 5b ff ff ff       	jmp    80228c <vprintfmt+0x54>
+  802331:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802334:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802337:	eb bc                	jmp    8022f5 <vprintfmt+0xbd>
+      lflag++;
+  802339:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  80233c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  80233f:	e9 48 ff ff ff       	jmp    80228c <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  802344:	8b 45 14             	mov    0x14(%ebp),%eax
+  802347:	8d 78 04             	lea    0x4(%eax),%edi
+  80234a:	83 ec 08             	sub    $0x8,%esp
+  80234d:	53                   	push   %ebx
+  80234e:	ff 30                	push   (%eax)
+  802350:	ff d6                	call   *%esi
+      break;
+  802352:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  802355:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  802358:	e9 b1 02 00 00       	jmp    80260e <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  80235d:	8b 45 14             	mov    0x14(%ebp),%eax
+  802360:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  802363:	8b 10                	mov    (%eax),%edx
+  802365:	89 d0                	mov    %edx,%eax
+  802367:	f7 d8                	neg    %eax
+  802369:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80236c:	83 f8 10             	cmp    $0x10,%eax
+  80236f:	7f 23                	jg     802394 <vprintfmt+0x15c>
+  802371:	8b 14 85 80 32 80 00 	mov    0x803280(,%eax,4),%edx
+  802378:	85 d2                	test   %edx,%edx
+  80237a:	74 18                	je     802394 <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  80237c:	52                   	push   %edx
+  80237d:	68 52 2f 80 00       	push   $0x802f52
+  802382:	53                   	push   %ebx
+  802383:	56                   	push   %esi
+  802384:	e8 92 fe ff ff       	call   80221b <printfmt>
+  802389:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  80238c:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80238f:	e9 7a 02 00 00       	jmp    80260e <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  802394:	50                   	push   %eax
+  802395:	68 f7 2f 80 00       	push   $0x802ff7
+  80239a:	53                   	push   %ebx
+  80239b:	56                   	push   %esi
+  80239c:	e8 7a fe ff ff       	call   80221b <printfmt>
+  8023a1:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  8023a4:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  8023a7:	e9 62 02 00 00       	jmp    80260e <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  8023ac:	8b 45 14             	mov    0x14(%ebp),%eax
+  8023af:	83 c0 04             	add    $0x4,%eax
+  8023b2:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8023b5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8023b8:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  8023ba:	85 c9                	test   %ecx,%ecx
+  8023bc:	b8 f0 2f 80 00       	mov    $0x802ff0,%eax
+  8023c1:	0f 45 c1             	cmovne %ecx,%eax
+  8023c4:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  8023c7:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8023cb:	7e 06                	jle    8023d3 <vprintfmt+0x19b>
+  8023cd:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8023d1:	75 0b                	jne    8023de <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8023d3:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8023d6:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8023d9:	89 75 08             	mov    %esi,0x8(%ebp)
+  8023dc:	eb 5c                	jmp    80243a <vprintfmt+0x202>
+  8023de:	83 ec 08             	sub    $0x8,%esp
+  8023e1:	ff 75 d0             	push   -0x30(%ebp)
+  8023e4:	ff 75 cc             	push   -0x34(%ebp)
+  8023e7:	e8 20 03 00 00       	call   80270c <strnlen>
+  8023ec:	89 c2                	mov    %eax,%edx
+  8023ee:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8023f1:	29 d0                	sub    %edx,%eax
+  8023f3:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  8023f6:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8023fa:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8023fd:	89 75 08             	mov    %esi,0x8(%ebp)
+  802400:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  802402:	eb 0e                	jmp    802412 <vprintfmt+0x1da>
+          putch(padc, putdat);
+  802404:	83 ec 08             	sub    $0x8,%esp
+  802407:	53                   	push   %ebx
+  802408:	57                   	push   %edi
+  802409:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  80240c:	83 ee 01             	sub    $0x1,%esi
+  80240f:	83 c4 10             	add    $0x10,%esp
+  802412:	85 f6                	test   %esi,%esi
+  802414:	7f ee                	jg     802404 <vprintfmt+0x1cc>
+  802416:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802419:	8b 75 08             	mov    0x8(%ebp),%esi
+  80241c:	85 c0                	test   %eax,%eax
+  80241e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802423:	0f 49 d0             	cmovns %eax,%edx
+  802426:	29 d0                	sub    %edx,%eax
+  802428:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80242b:	eb a6                	jmp    8023d3 <vprintfmt+0x19b>
+          putch(ch, putdat);
+  80242d:	83 ec 08             	sub    $0x8,%esp
+  802430:	53                   	push   %ebx
+  802431:	52                   	push   %edx
+  802432:	ff 55 08             	call   *0x8(%ebp)
+  802435:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  802438:	89 f1                	mov    %esi,%ecx
+  80243a:	8d 71 01             	lea    0x1(%ecx),%esi
+  80243d:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  802441:	0f be d0             	movsbl %al,%edx
+  802444:	85 d2                	test   %edx,%edx
+  802446:	74 28                	je     802470 <vprintfmt+0x238>
+  802448:	85 ff                	test   %edi,%edi
+  80244a:	78 05                	js     802451 <vprintfmt+0x219>
+  80244c:	83 ef 01             	sub    $0x1,%edi
+  80244f:	78 30                	js     802481 <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  802451:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  802455:	74 d6                	je     80242d <vprintfmt+0x1f5>
+  802457:	0f be c0             	movsbl %al,%eax
+  80245a:	83 e8 20             	sub    $0x20,%eax
+  80245d:	83 f8 5e             	cmp    $0x5e,%eax
+  802460:	76 cb                	jbe    80242d <vprintfmt+0x1f5>
+          putch('?', putdat);
+  802462:	83 ec 08             	sub    $0x8,%esp
+  802465:	53                   	push   %ebx
+  802466:	6a 3f                	push   $0x3f
+  802468:	ff 55 08             	call   *0x8(%ebp)
+  80246b:	83 c4 10             	add    $0x10,%esp
+  80246e:	eb c8                	jmp    802438 <vprintfmt+0x200>
+  802470:	8b 75 08             	mov    0x8(%ebp),%esi
+  802473:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802476:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802479:	01 d0                	add    %edx,%eax
+  80247b:	29 c8                	sub    %ecx,%eax
+  80247d:	89 c7                	mov    %eax,%edi
+  80247f:	eb 13                	jmp    802494 <vprintfmt+0x25c>
+  802481:	8b 75 08             	mov    0x8(%ebp),%esi
+  802484:	eb ed                	jmp    802473 <vprintfmt+0x23b>
+        putch(' ', putdat);
+  802486:	83 ec 08             	sub    $0x8,%esp
+  802489:	53                   	push   %ebx
+  80248a:	6a 20                	push   $0x20
+  80248c:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  80248e:	83 ef 01             	sub    $0x1,%edi
+  802491:	83 c4 10             	add    $0x10,%esp
+  802494:	85 ff                	test   %edi,%edi
+  802496:	7f ee                	jg     802486 <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  802498:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80249b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80249e:	e9 6b 01 00 00       	jmp    80260e <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  8024a3:	83 f9 01             	cmp    $0x1,%ecx
+  8024a6:	7f 1f                	jg     8024c7 <vprintfmt+0x28f>
+  else if (lflag)
+  8024a8:	85 c9                	test   %ecx,%ecx
+  8024aa:	74 67                	je     802513 <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  8024ac:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024af:	8b 00                	mov    (%eax),%eax
+  8024b1:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8024b4:	89 c1                	mov    %eax,%ecx
+  8024b6:	c1 f9 1f             	sar    $0x1f,%ecx
+  8024b9:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8024bc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024bf:	8d 40 04             	lea    0x4(%eax),%eax
+  8024c2:	89 45 14             	mov    %eax,0x14(%ebp)
+  8024c5:	eb 17                	jmp    8024de <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  8024c7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024ca:	8b 50 04             	mov    0x4(%eax),%edx
+  8024cd:	8b 00                	mov    (%eax),%eax
+  8024cf:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8024d2:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8024d5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024d8:	8d 40 08             	lea    0x8(%eax),%eax
+  8024db:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  8024de:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8024e1:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  8024e4:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  8024e9:	85 c9                	test   %ecx,%ecx
+  8024eb:	0f 89 03 01 00 00    	jns    8025f4 <vprintfmt+0x3bc>
+        putch('-', putdat);
+  8024f1:	83 ec 08             	sub    $0x8,%esp
+  8024f4:	53                   	push   %ebx
+  8024f5:	6a 2d                	push   $0x2d
+  8024f7:	ff d6                	call   *%esi
+        num = -(long long)num;
+  8024f9:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8024fc:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8024ff:	f7 da                	neg    %edx
+  802501:	83 d1 00             	adc    $0x0,%ecx
+  802504:	f7 d9                	neg    %ecx
+  802506:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  802509:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80250e:	e9 e1 00 00 00       	jmp    8025f4 <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  802513:	8b 45 14             	mov    0x14(%ebp),%eax
+  802516:	8b 00                	mov    (%eax),%eax
+  802518:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80251b:	89 c1                	mov    %eax,%ecx
+  80251d:	c1 f9 1f             	sar    $0x1f,%ecx
+  802520:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802523:	8b 45 14             	mov    0x14(%ebp),%eax
+  802526:	8d 40 04             	lea    0x4(%eax),%eax
+  802529:	89 45 14             	mov    %eax,0x14(%ebp)
+  80252c:	eb b0                	jmp    8024de <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  80252e:	83 f9 01             	cmp    $0x1,%ecx
+  802531:	7f 1e                	jg     802551 <vprintfmt+0x319>
+  else if (lflag)
+  802533:	85 c9                	test   %ecx,%ecx
+  802535:	74 32                	je     802569 <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  802537:	8b 45 14             	mov    0x14(%ebp),%eax
+  80253a:	8b 10                	mov    (%eax),%edx
+  80253c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802541:	8d 40 04             	lea    0x4(%eax),%eax
+  802544:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  802547:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  80254c:	e9 a3 00 00 00       	jmp    8025f4 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  802551:	8b 45 14             	mov    0x14(%ebp),%eax
+  802554:	8b 10                	mov    (%eax),%edx
+  802556:	8b 48 04             	mov    0x4(%eax),%ecx
+  802559:	8d 40 08             	lea    0x8(%eax),%eax
+  80255c:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  80255f:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  802564:	e9 8b 00 00 00       	jmp    8025f4 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  802569:	8b 45 14             	mov    0x14(%ebp),%eax
+  80256c:	8b 10                	mov    (%eax),%edx
+  80256e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802573:	8d 40 04             	lea    0x4(%eax),%eax
+  802576:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  802579:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  80257e:	eb 74                	jmp    8025f4 <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  802580:	83 f9 01             	cmp    $0x1,%ecx
+  802583:	7f 1b                	jg     8025a0 <vprintfmt+0x368>
+  else if (lflag)
+  802585:	85 c9                	test   %ecx,%ecx
+  802587:	74 2c                	je     8025b5 <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  802589:	8b 45 14             	mov    0x14(%ebp),%eax
+  80258c:	8b 10                	mov    (%eax),%edx
+  80258e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802593:	8d 40 04             	lea    0x4(%eax),%eax
+  802596:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  802599:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  80259e:	eb 54                	jmp    8025f4 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  8025a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8025a3:	8b 10                	mov    (%eax),%edx
+  8025a5:	8b 48 04             	mov    0x4(%eax),%ecx
+  8025a8:	8d 40 08             	lea    0x8(%eax),%eax
+  8025ab:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8025ae:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  8025b3:	eb 3f                	jmp    8025f4 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8025b5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8025b8:	8b 10                	mov    (%eax),%edx
+  8025ba:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025bf:	8d 40 04             	lea    0x4(%eax),%eax
+  8025c2:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8025c5:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  8025ca:	eb 28                	jmp    8025f4 <vprintfmt+0x3bc>
+      putch('0', putdat);
+  8025cc:	83 ec 08             	sub    $0x8,%esp
+  8025cf:	53                   	push   %ebx
+  8025d0:	6a 30                	push   $0x30
+  8025d2:	ff d6                	call   *%esi
+      putch('x', putdat);
+  8025d4:	83 c4 08             	add    $0x8,%esp
+  8025d7:	53                   	push   %ebx
+  8025d8:	6a 78                	push   $0x78
+  8025da:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  8025dc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8025df:	8b 10                	mov    (%eax),%edx
+  8025e1:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  8025e6:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  8025e9:	8d 40 04             	lea    0x4(%eax),%eax
+  8025ec:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8025ef:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  8025f4:	83 ec 0c             	sub    $0xc,%esp
+  8025f7:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8025fb:	50                   	push   %eax
+  8025fc:	ff 75 e0             	push   -0x20(%ebp)
+  8025ff:	57                   	push   %edi
+  802600:	51                   	push   %ecx
+  802601:	52                   	push   %edx
+  802602:	89 da                	mov    %ebx,%edx
+  802604:	89 f0                	mov    %esi,%eax
+  802606:	e8 4a fb ff ff       	call   802155 <printnum>
+      break;
+  80260b:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  80260e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  802611:	e9 40 fc ff ff       	jmp    802256 <vprintfmt+0x1e>
+  if (lflag >= 2)
+  802616:	83 f9 01             	cmp    $0x1,%ecx
+  802619:	7f 1b                	jg     802636 <vprintfmt+0x3fe>
+  else if (lflag)
+  80261b:	85 c9                	test   %ecx,%ecx
+  80261d:	74 2c                	je     80264b <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  80261f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802622:	8b 10                	mov    (%eax),%edx
+  802624:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802629:	8d 40 04             	lea    0x4(%eax),%eax
+  80262c:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  80262f:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  802634:	eb be                	jmp    8025f4 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  802636:	8b 45 14             	mov    0x14(%ebp),%eax
+  802639:	8b 10                	mov    (%eax),%edx
+  80263b:	8b 48 04             	mov    0x4(%eax),%ecx
+  80263e:	8d 40 08             	lea    0x8(%eax),%eax
+  802641:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  802644:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  802649:	eb a9                	jmp    8025f4 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  80264b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80264e:	8b 10                	mov    (%eax),%edx
+  802650:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802655:	8d 40 04             	lea    0x4(%eax),%eax
+  802658:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  80265b:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  802660:	eb 92                	jmp    8025f4 <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  802662:	83 ec 08             	sub    $0x8,%esp
+  802665:	53                   	push   %ebx
+  802666:	6a 25                	push   $0x25
+  802668:	ff d6                	call   *%esi
+      break;
+  80266a:	83 c4 10             	add    $0x10,%esp
+  80266d:	eb 9f                	jmp    80260e <vprintfmt+0x3d6>
+      putch('%', putdat);
+  80266f:	83 ec 08             	sub    $0x8,%esp
+  802672:	53                   	push   %ebx
+  802673:	6a 25                	push   $0x25
+  802675:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  802677:	83 c4 10             	add    $0x10,%esp
+  80267a:	89 f8                	mov    %edi,%eax
+  80267c:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  802680:	74 05                	je     802687 <vprintfmt+0x44f>
+  802682:	83 e8 01             	sub    $0x1,%eax
+  802685:	eb f5                	jmp    80267c <vprintfmt+0x444>
+  802687:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80268a:	eb 82                	jmp    80260e <vprintfmt+0x3d6>
+
+0080268c <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80268c:	55                   	push   %ebp
+  80268d:	89 e5                	mov    %esp,%ebp
+  80268f:	83 ec 18             	sub    $0x18,%esp
+  802692:	8b 45 08             	mov    0x8(%ebp),%eax
+  802695:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  802698:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80269b:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80269f:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8026a2:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  8026a9:	85 c0                	test   %eax,%eax
+  8026ab:	74 26                	je     8026d3 <vsnprintf+0x47>
+  8026ad:	85 d2                	test   %edx,%edx
+  8026af:	7e 22                	jle    8026d3 <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8026b1:	ff 75 14             	push   0x14(%ebp)
+  8026b4:	ff 75 10             	push   0x10(%ebp)
+  8026b7:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8026ba:	50                   	push   %eax
+  8026bb:	68 fe 21 80 00       	push   $0x8021fe
+  8026c0:	e8 73 fb ff ff       	call   802238 <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  8026c5:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8026c8:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  8026cb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026ce:	83 c4 10             	add    $0x10,%esp
+}
+  8026d1:	c9                   	leave
+  8026d2:	c3                   	ret
+    return -E_INVAL;
+  8026d3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026d8:	eb f7                	jmp    8026d1 <vsnprintf+0x45>
+
+008026da <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8026da:	55                   	push   %ebp
+  8026db:	89 e5                	mov    %esp,%ebp
+  8026dd:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  8026e0:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  8026e3:	50                   	push   %eax
+  8026e4:	ff 75 10             	push   0x10(%ebp)
+  8026e7:	ff 75 0c             	push   0xc(%ebp)
+  8026ea:	ff 75 08             	push   0x8(%ebp)
+  8026ed:	e8 9a ff ff ff       	call   80268c <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  8026f2:	c9                   	leave
+  8026f3:	c3                   	ret
+
+008026f4 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8026f4:	55                   	push   %ebp
+  8026f5:	89 e5                	mov    %esp,%ebp
+  8026f7:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  8026fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026ff:	eb 03                	jmp    802704 <strlen+0x10>
+    n++;
+  802701:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  802704:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  802708:	75 f7                	jne    802701 <strlen+0xd>
+  return n;
+}
+  80270a:	5d                   	pop    %ebp
+  80270b:	c3                   	ret
+
+0080270c <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80270c:	55                   	push   %ebp
+  80270d:	89 e5                	mov    %esp,%ebp
+  80270f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  802712:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802715:	b8 00 00 00 00       	mov    $0x0,%eax
+  80271a:	eb 03                	jmp    80271f <strnlen+0x13>
+    n++;
+  80271c:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80271f:	39 d0                	cmp    %edx,%eax
+  802721:	74 08                	je     80272b <strnlen+0x1f>
+  802723:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  802727:	75 f3                	jne    80271c <strnlen+0x10>
+  802729:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  80272b:	89 d0                	mov    %edx,%eax
+  80272d:	5d                   	pop    %ebp
+  80272e:	c3                   	ret
+
+0080272f <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80272f:	55                   	push   %ebp
+  802730:	89 e5                	mov    %esp,%ebp
+  802732:	53                   	push   %ebx
+  802733:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802736:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  802739:	b8 00 00 00 00       	mov    $0x0,%eax
+  80273e:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  802742:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  802745:	83 c0 01             	add    $0x1,%eax
+  802748:	84 d2                	test   %dl,%dl
+  80274a:	75 f2                	jne    80273e <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  80274c:	89 c8                	mov    %ecx,%eax
+  80274e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802751:	c9                   	leave
+  802752:	c3                   	ret
+
+00802753 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  802753:	55                   	push   %ebp
+  802754:	89 e5                	mov    %esp,%ebp
+  802756:	53                   	push   %ebx
+  802757:	83 ec 10             	sub    $0x10,%esp
+  80275a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  80275d:	53                   	push   %ebx
+  80275e:	e8 91 ff ff ff       	call   8026f4 <strlen>
+  802763:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  802766:	ff 75 0c             	push   0xc(%ebp)
+  802769:	01 d8                	add    %ebx,%eax
+  80276b:	50                   	push   %eax
+  80276c:	e8 be ff ff ff       	call   80272f <strcpy>
+  return dst;
+}
+  802771:	89 d8                	mov    %ebx,%eax
+  802773:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802776:	c9                   	leave
+  802777:	c3                   	ret
+
+00802778 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  802778:	55                   	push   %ebp
+  802779:	89 e5                	mov    %esp,%ebp
+  80277b:	56                   	push   %esi
+  80277c:	53                   	push   %ebx
+  80277d:	8b 75 08             	mov    0x8(%ebp),%esi
+  802780:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  802783:	89 f3                	mov    %esi,%ebx
+  802785:	03 5d 10             	add    0x10(%ebp),%ebx
+  802788:	89 f0                	mov    %esi,%eax
+  80278a:	eb 0f                	jmp    80279b <strncpy+0x23>
+    *dst++ = *src;
+  80278c:	83 c0 01             	add    $0x1,%eax
+  80278f:	0f b6 0a             	movzbl (%edx),%ecx
+  802792:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  802795:	80 f9 01             	cmp    $0x1,%cl
+  802798:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  80279b:	39 d8                	cmp    %ebx,%eax
+  80279d:	75 ed                	jne    80278c <strncpy+0x14>
+  }
+  return ret;
+}
+  80279f:	89 f0                	mov    %esi,%eax
+  8027a1:	5b                   	pop    %ebx
+  8027a2:	5e                   	pop    %esi
+  8027a3:	5d                   	pop    %ebp
+  8027a4:	c3                   	ret
+
+008027a5 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8027a5:	55                   	push   %ebp
+  8027a6:	89 e5                	mov    %esp,%ebp
+  8027a8:	56                   	push   %esi
+  8027a9:	53                   	push   %ebx
+  8027aa:	8b 75 08             	mov    0x8(%ebp),%esi
+  8027ad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8027b0:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  8027b3:	89 f0                	mov    %esi,%eax
+  8027b5:	85 d2                	test   %edx,%edx
+  8027b7:	74 21                	je     8027da <strlcpy+0x35>
+  8027b9:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8027bd:	89 f2                	mov    %esi,%edx
+  8027bf:	eb 09                	jmp    8027ca <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  8027c1:	83 c1 01             	add    $0x1,%ecx
+  8027c4:	83 c2 01             	add    $0x1,%edx
+  8027c7:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  8027ca:	39 c2                	cmp    %eax,%edx
+  8027cc:	74 09                	je     8027d7 <strlcpy+0x32>
+  8027ce:	0f b6 19             	movzbl (%ecx),%ebx
+  8027d1:	84 db                	test   %bl,%bl
+  8027d3:	75 ec                	jne    8027c1 <strlcpy+0x1c>
+  8027d5:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  8027d7:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  8027da:	29 f0                	sub    %esi,%eax
+}
+  8027dc:	5b                   	pop    %ebx
+  8027dd:	5e                   	pop    %esi
+  8027de:	5d                   	pop    %ebp
+  8027df:	c3                   	ret
+
+008027e0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8027e0:	55                   	push   %ebp
+  8027e1:	89 e5                	mov    %esp,%ebp
+  8027e3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8027e6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  8027e9:	eb 06                	jmp    8027f1 <strcmp+0x11>
+    p++, q++;
+  8027eb:	83 c1 01             	add    $0x1,%ecx
+  8027ee:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  8027f1:	0f b6 01             	movzbl (%ecx),%eax
+  8027f4:	84 c0                	test   %al,%al
+  8027f6:	74 04                	je     8027fc <strcmp+0x1c>
+  8027f8:	3a 02                	cmp    (%edx),%al
+  8027fa:	74 ef                	je     8027eb <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  8027fc:	0f b6 c0             	movzbl %al,%eax
+  8027ff:	0f b6 12             	movzbl (%edx),%edx
+  802802:	29 d0                	sub    %edx,%eax
+}
+  802804:	5d                   	pop    %ebp
+  802805:	c3                   	ret
+
+00802806 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  802806:	55                   	push   %ebp
+  802807:	89 e5                	mov    %esp,%ebp
+  802809:	53                   	push   %ebx
+  80280a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80280d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802810:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  802813:	eb 09                	jmp    80281e <strncmp+0x18>
+    n--, p++, q++;
+  802815:	83 ea 01             	sub    $0x1,%edx
+  802818:	83 c0 01             	add    $0x1,%eax
+  80281b:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  80281e:	85 d2                	test   %edx,%edx
+  802820:	74 18                	je     80283a <strncmp+0x34>
+  802822:	0f b6 18             	movzbl (%eax),%ebx
+  802825:	84 db                	test   %bl,%bl
+  802827:	74 04                	je     80282d <strncmp+0x27>
+  802829:	3a 19                	cmp    (%ecx),%bl
+  80282b:	74 e8                	je     802815 <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80282d:	0f b6 00             	movzbl (%eax),%eax
+  802830:	0f b6 11             	movzbl (%ecx),%edx
+  802833:	29 d0                	sub    %edx,%eax
+}
+  802835:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802838:	c9                   	leave
+  802839:	c3                   	ret
+    return 0;
+  80283a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80283f:	eb f4                	jmp    802835 <strncmp+0x2f>
+
+00802841 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  802841:	55                   	push   %ebp
+  802842:	89 e5                	mov    %esp,%ebp
+  802844:	8b 45 08             	mov    0x8(%ebp),%eax
+  802847:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  80284b:	eb 03                	jmp    802850 <strchr+0xf>
+  80284d:	83 c0 01             	add    $0x1,%eax
+  802850:	0f b6 10             	movzbl (%eax),%edx
+  802853:	84 d2                	test   %dl,%dl
+  802855:	74 06                	je     80285d <strchr+0x1c>
+    if (*s == c)
+  802857:	38 ca                	cmp    %cl,%dl
+  802859:	75 f2                	jne    80284d <strchr+0xc>
+  80285b:	eb 05                	jmp    802862 <strchr+0x21>
+      return (char*)s;
+  return 0;
+  80285d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802862:	5d                   	pop    %ebp
+  802863:	c3                   	ret
+
+00802864 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  802864:	55                   	push   %ebp
+  802865:	89 e5                	mov    %esp,%ebp
+  802867:	8b 45 08             	mov    0x8(%ebp),%eax
+  80286a:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  80286e:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  802871:	38 ca                	cmp    %cl,%dl
+  802873:	74 09                	je     80287e <strfind+0x1a>
+  802875:	84 d2                	test   %dl,%dl
+  802877:	74 05                	je     80287e <strfind+0x1a>
+  for (; *s; s++)
+  802879:	83 c0 01             	add    $0x1,%eax
+  80287c:	eb f0                	jmp    80286e <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  80287e:	5d                   	pop    %ebp
+  80287f:	c3                   	ret
+
+00802880 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  802880:	55                   	push   %ebp
+  802881:	89 e5                	mov    %esp,%ebp
+  802883:	57                   	push   %edi
+  802884:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802887:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  80288a:	85 c9                	test   %ecx,%ecx
+  80288c:	74 20                	je     8028ae <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  80288e:	89 f8                	mov    %edi,%eax
+  802890:	09 c8                	or     %ecx,%eax
+  802892:	a8 03                	test   $0x3,%al
+  802894:	75 12                	jne    8028a8 <memset+0x28>
+    c &= 0xFF;
+  802896:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80289a:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  8028a0:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  8028a3:	fc                   	cld
+  8028a4:	f3 ab                	rep stos %eax,%es:(%edi)
+  8028a6:	eb 06                	jmp    8028ae <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  8028a8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8028ab:	fc                   	cld
+  8028ac:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  8028ae:	89 f8                	mov    %edi,%eax
+  8028b0:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8028b3:	c9                   	leave
+  8028b4:	c3                   	ret
+
+008028b5 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8028b5:	55                   	push   %ebp
+  8028b6:	89 e5                	mov    %esp,%ebp
+  8028b8:	57                   	push   %edi
+  8028b9:	56                   	push   %esi
+  8028ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028bd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8028c0:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  8028c3:	39 c6                	cmp    %eax,%esi
+  8028c5:	73 32                	jae    8028f9 <memmove+0x44>
+  8028c7:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8028ca:	39 d0                	cmp    %edx,%eax
+  8028cc:	73 2b                	jae    8028f9 <memmove+0x44>
+    s += n;
+    d += n;
+  8028ce:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8028d1:	89 d6                	mov    %edx,%esi
+  8028d3:	09 fe                	or     %edi,%esi
+  8028d5:	09 ce                	or     %ecx,%esi
+  8028d7:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8028dd:	75 0e                	jne    8028ed <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8028df:	83 ef 04             	sub    $0x4,%edi
+  8028e2:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8028e5:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  8028e8:	fd                   	std
+  8028e9:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8028eb:	eb 09                	jmp    8028f6 <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8028ed:	83 ef 01             	sub    $0x1,%edi
+  8028f0:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  8028f3:	fd                   	std
+  8028f4:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  8028f6:	fc                   	cld
+  8028f7:	eb 1a                	jmp    802913 <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8028f9:	89 f2                	mov    %esi,%edx
+  8028fb:	09 c2                	or     %eax,%edx
+  8028fd:	09 ca                	or     %ecx,%edx
+  8028ff:	f6 c2 03             	test   $0x3,%dl
+  802902:	75 0a                	jne    80290e <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  802904:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  802907:	89 c7                	mov    %eax,%edi
+  802909:	fc                   	cld
+  80290a:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80290c:	eb 05                	jmp    802913 <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  80290e:	89 c7                	mov    %eax,%edi
+  802910:	fc                   	cld
+  802911:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  802913:	5e                   	pop    %esi
+  802914:	5f                   	pop    %edi
+  802915:	5d                   	pop    %ebp
+  802916:	c3                   	ret
+
+00802917 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  802917:	55                   	push   %ebp
+  802918:	89 e5                	mov    %esp,%ebp
+  80291a:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  80291d:	ff 75 10             	push   0x10(%ebp)
+  802920:	ff 75 0c             	push   0xc(%ebp)
+  802923:	ff 75 08             	push   0x8(%ebp)
+  802926:	e8 8a ff ff ff       	call   8028b5 <memmove>
+}
+  80292b:	c9                   	leave
+  80292c:	c3                   	ret
+
+0080292d <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  80292d:	55                   	push   %ebp
+  80292e:	89 e5                	mov    %esp,%ebp
+  802930:	56                   	push   %esi
+  802931:	53                   	push   %ebx
+  802932:	8b 45 08             	mov    0x8(%ebp),%eax
+  802935:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  802938:	89 c6                	mov    %eax,%esi
+  80293a:	03 75 10             	add    0x10(%ebp),%esi
+  80293d:	eb 06                	jmp    802945 <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  80293f:	83 c0 01             	add    $0x1,%eax
+  802942:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  802945:	39 f0                	cmp    %esi,%eax
+  802947:	74 14                	je     80295d <memcmp+0x30>
+    if (*s1 != *s2)
+  802949:	0f b6 08             	movzbl (%eax),%ecx
+  80294c:	0f b6 1a             	movzbl (%edx),%ebx
+  80294f:	38 d9                	cmp    %bl,%cl
+  802951:	74 ec                	je     80293f <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  802953:	0f b6 c1             	movzbl %cl,%eax
+  802956:	0f b6 db             	movzbl %bl,%ebx
+  802959:	29 d8                	sub    %ebx,%eax
+  80295b:	eb 05                	jmp    802962 <memcmp+0x35>
+  }
+
+  return 0;
+  80295d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802962:	5b                   	pop    %ebx
+  802963:	5e                   	pop    %esi
+  802964:	5d                   	pop    %ebp
+  802965:	c3                   	ret
+
+00802966 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  802966:	55                   	push   %ebp
+  802967:	89 e5                	mov    %esp,%ebp
+  802969:	8b 45 08             	mov    0x8(%ebp),%eax
+  80296c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  80296f:	89 c2                	mov    %eax,%edx
+  802971:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  802974:	eb 03                	jmp    802979 <memfind+0x13>
+  802976:	83 c0 01             	add    $0x1,%eax
+  802979:	39 d0                	cmp    %edx,%eax
+  80297b:	73 04                	jae    802981 <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  80297d:	38 08                	cmp    %cl,(%eax)
+  80297f:	75 f5                	jne    802976 <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  802981:	5d                   	pop    %ebp
+  802982:	c3                   	ret
+
+00802983 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  802983:	55                   	push   %ebp
+  802984:	89 e5                	mov    %esp,%ebp
+  802986:	57                   	push   %edi
+  802987:	56                   	push   %esi
+  802988:	53                   	push   %ebx
+  802989:	8b 55 08             	mov    0x8(%ebp),%edx
+  80298c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  80298f:	eb 03                	jmp    802994 <strtol+0x11>
+    s++;
+  802991:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  802994:	0f b6 02             	movzbl (%edx),%eax
+  802997:	3c 20                	cmp    $0x20,%al
+  802999:	74 f6                	je     802991 <strtol+0xe>
+  80299b:	3c 09                	cmp    $0x9,%al
+  80299d:	74 f2                	je     802991 <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  80299f:	3c 2b                	cmp    $0x2b,%al
+  8029a1:	74 2a                	je     8029cd <strtol+0x4a>
+  int neg = 0;
+  8029a3:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  8029a8:	3c 2d                	cmp    $0x2d,%al
+  8029aa:	74 2b                	je     8029d7 <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8029ac:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8029b2:	75 0f                	jne    8029c3 <strtol+0x40>
+  8029b4:	80 3a 30             	cmpb   $0x30,(%edx)
+  8029b7:	74 28                	je     8029e1 <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  8029b9:	85 db                	test   %ebx,%ebx
+  8029bb:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8029c0:	0f 44 d8             	cmove  %eax,%ebx
+  8029c3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8029c8:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8029cb:	eb 46                	jmp    802a13 <strtol+0x90>
+    s++;
+  8029cd:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  8029d0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029d5:	eb d5                	jmp    8029ac <strtol+0x29>
+    s++, neg = 1;
+  8029d7:	83 c2 01             	add    $0x1,%edx
+  8029da:	bf 01 00 00 00       	mov    $0x1,%edi
+  8029df:	eb cb                	jmp    8029ac <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8029e1:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8029e5:	74 0e                	je     8029f5 <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  8029e7:	85 db                	test   %ebx,%ebx
+  8029e9:	75 d8                	jne    8029c3 <strtol+0x40>
+    s++, base = 8;
+  8029eb:	83 c2 01             	add    $0x1,%edx
+  8029ee:	bb 08 00 00 00       	mov    $0x8,%ebx
+  8029f3:	eb ce                	jmp    8029c3 <strtol+0x40>
+    s += 2, base = 16;
+  8029f5:	83 c2 02             	add    $0x2,%edx
+  8029f8:	bb 10 00 00 00       	mov    $0x10,%ebx
+  8029fd:	eb c4                	jmp    8029c3 <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  8029ff:	0f be c0             	movsbl %al,%eax
+  802a02:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  802a05:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802a08:	7d 3a                	jge    802a44 <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  802a0a:	83 c2 01             	add    $0x1,%edx
+  802a0d:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  802a11:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  802a13:	0f b6 02             	movzbl (%edx),%eax
+  802a16:	8d 70 d0             	lea    -0x30(%eax),%esi
+  802a19:	89 f3                	mov    %esi,%ebx
+  802a1b:	80 fb 09             	cmp    $0x9,%bl
+  802a1e:	76 df                	jbe    8029ff <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  802a20:	8d 70 9f             	lea    -0x61(%eax),%esi
+  802a23:	89 f3                	mov    %esi,%ebx
+  802a25:	80 fb 19             	cmp    $0x19,%bl
+  802a28:	77 08                	ja     802a32 <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  802a2a:	0f be c0             	movsbl %al,%eax
+  802a2d:	83 e8 57             	sub    $0x57,%eax
+  802a30:	eb d3                	jmp    802a05 <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  802a32:	8d 70 bf             	lea    -0x41(%eax),%esi
+  802a35:	89 f3                	mov    %esi,%ebx
+  802a37:	80 fb 19             	cmp    $0x19,%bl
+  802a3a:	77 08                	ja     802a44 <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  802a3c:	0f be c0             	movsbl %al,%eax
+  802a3f:	83 e8 37             	sub    $0x37,%eax
+  802a42:	eb c1                	jmp    802a05 <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  802a44:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802a48:	74 05                	je     802a4f <strtol+0xcc>
+    *endptr = (char*)s;
+  802a4a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a4d:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  802a4f:	89 c8                	mov    %ecx,%eax
+  802a51:	f7 d8                	neg    %eax
+  802a53:	85 ff                	test   %edi,%edi
+  802a55:	0f 45 c8             	cmovne %eax,%ecx
+}
+  802a58:	89 c8                	mov    %ecx,%eax
+  802a5a:	5b                   	pop    %ebx
+  802a5b:	5e                   	pop    %esi
+  802a5c:	5f                   	pop    %edi
+  802a5d:	5d                   	pop    %ebp
+  802a5e:	c3                   	ret
+
+00802a5f <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  802a5f:	55                   	push   %ebp
+  802a60:	89 e5                	mov    %esp,%ebp
+  802a62:	57                   	push   %edi
+  802a63:	56                   	push   %esi
+  802a64:	53                   	push   %ebx
+  802a65:	83 ec 14             	sub    $0x14,%esp
+  802a68:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802a6b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a6e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802a71:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  802a74:	85 c0                	test   %eax,%eax
+  802a76:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802a7b:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  802a7e:	ff 33                	push   (%ebx)
+  802a80:	50                   	push   %eax
+  802a81:	e8 f8 d9 ff ff       	call   80047e <sys_ipc_recv>
+  802a86:	83 c4 10             	add    $0x10,%esp
+  802a89:	85 c0                	test   %eax,%eax
+  802a8b:	78 39                	js     802ac6 <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  802a8d:	85 ff                	test   %edi,%edi
+  802a8f:	74 0a                	je     802a9b <ipc_recv_pages+0x3c>
+  802a91:	a1 44 57 80 00       	mov    0x805744,%eax
+  802a96:	8b 40 7c             	mov    0x7c(%eax),%eax
+  802a99:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  802a9b:	85 f6                	test   %esi,%esi
+  802a9d:	74 0d                	je     802aac <ipc_recv_pages+0x4d>
+  802a9f:	a1 44 57 80 00       	mov    0x805744,%eax
+  802aa4:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  802aaa:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  802aac:	a1 44 57 80 00       	mov    0x805744,%eax
+  802ab1:	8b 40 74             	mov    0x74(%eax),%eax
+  802ab4:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  802ab6:	a1 44 57 80 00       	mov    0x805744,%eax
+  802abb:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  802abe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ac1:	5b                   	pop    %ebx
+  802ac2:	5e                   	pop    %esi
+  802ac3:	5f                   	pop    %edi
+  802ac4:	5d                   	pop    %ebp
+  802ac5:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  802ac6:	85 ff                	test   %edi,%edi
+  802ac8:	74 06                	je     802ad0 <ipc_recv_pages+0x71>
+  802aca:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  802ad0:	85 f6                	test   %esi,%esi
+  802ad2:	74 06                	je     802ada <ipc_recv_pages+0x7b>
+  802ad4:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  802ada:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  802ae0:	eb dc                	jmp    802abe <ipc_recv_pages+0x5f>
+
+00802ae2 <ipc_recv>:
+{
+  802ae2:	55                   	push   %ebp
+  802ae3:	89 e5                	mov    %esp,%ebp
+  802ae5:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  802ae8:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  802aef:	ff 75 10             	push   0x10(%ebp)
+  802af2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802af5:	50                   	push   %eax
+  802af6:	ff 75 0c             	push   0xc(%ebp)
+  802af9:	ff 75 08             	push   0x8(%ebp)
+  802afc:	e8 5e ff ff ff       	call   802a5f <ipc_recv_pages>
+}
+  802b01:	c9                   	leave
+  802b02:	c3                   	ret
+
+00802b03 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  802b03:	55                   	push   %ebp
+  802b04:	89 e5                	mov    %esp,%ebp
+  802b06:	57                   	push   %edi
+  802b07:	56                   	push   %esi
+  802b08:	53                   	push   %ebx
+  802b09:	83 ec 0c             	sub    $0xc,%esp
+  802b0c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802b0f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802b12:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  802b15:	89 c3                	mov    %eax,%ebx
+  802b17:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  802b1d:	85 c0                	test   %eax,%eax
+  802b1f:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802b24:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  802b27:	83 ec 0c             	sub    $0xc,%esp
+  802b2a:	ff 75 14             	push   0x14(%ebp)
+  802b2d:	ff 75 18             	push   0x18(%ebp)
+  802b30:	53                   	push   %ebx
+  802b31:	56                   	push   %esi
+  802b32:	57                   	push   %edi
+  802b33:	e8 25 d9 ff ff       	call   80045d <sys_ipc_try_send>
+  802b38:	83 c4 20             	add    $0x20,%esp
+  802b3b:	85 c0                	test   %eax,%eax
+  802b3d:	79 1e                	jns    802b5d <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  802b3f:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802b42:	75 07                	jne    802b4b <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  802b44:	e8 fb d5 ff ff       	call   800144 <sys_yield>
+  802b49:	eb dc                	jmp    802b27 <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  802b4b:	50                   	push   %eax
+  802b4c:	68 e3 32 80 00       	push   $0x8032e3
+  802b51:	6a 5c                	push   $0x5c
+  802b53:	68 f0 32 80 00       	push   $0x8032f0
+  802b58:	e8 09 f5 ff ff       	call   802066 <_panic>
+  }
+}
+  802b5d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b60:	5b                   	pop    %ebx
+  802b61:	5e                   	pop    %esi
+  802b62:	5f                   	pop    %edi
+  802b63:	5d                   	pop    %ebp
+  802b64:	c3                   	ret
+
+00802b65 <ipc_send>:
+{
+  802b65:	55                   	push   %ebp
+  802b66:	89 e5                	mov    %esp,%ebp
+  802b68:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  802b6b:	ff 75 14             	push   0x14(%ebp)
+  802b6e:	6a 01                	push   $0x1
+  802b70:	ff 75 10             	push   0x10(%ebp)
+  802b73:	ff 75 0c             	push   0xc(%ebp)
+  802b76:	ff 75 08             	push   0x8(%ebp)
+  802b79:	e8 85 ff ff ff       	call   802b03 <ipc_send_pages>
+}
+  802b7e:	83 c4 20             	add    $0x20,%esp
+  802b81:	c9                   	leave
+  802b82:	c3                   	ret
+
+00802b83 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802b83:	55                   	push   %ebp
+  802b84:	89 e5                	mov    %esp,%ebp
+  802b86:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  802b89:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  802b8e:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802b91:	c1 e0 04             	shl    $0x4,%eax
+  802b94:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802b99:	8b 40 50             	mov    0x50(%eax),%eax
+  802b9c:	39 c8                	cmp    %ecx,%eax
+  802b9e:	74 12                	je     802bb2 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  802ba0:	83 c2 01             	add    $0x1,%edx
+  802ba3:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802ba9:	75 e3                	jne    802b8e <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  802bab:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bb0:	eb 0e                	jmp    802bc0 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  802bb2:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802bb5:	c1 e0 04             	shl    $0x4,%eax
+  802bb8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802bbd:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802bc0:	5d                   	pop    %ebp
+  802bc1:	c3                   	ret
+
+00802bc2 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802bc2:	55                   	push   %ebp
+  802bc3:	89 e5                	mov    %esp,%ebp
+  802bc5:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802bc8:	89 c2                	mov    %eax,%edx
+  802bca:	c1 ea 16             	shr    $0x16,%edx
+  802bcd:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  802bd4:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802bd9:	f6 c1 01             	test   $0x1,%cl
+  802bdc:	74 1c                	je     802bfa <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  802bde:	c1 e8 0c             	shr    $0xc,%eax
+  802be1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  802be8:	a8 01                	test   $0x1,%al
+  802bea:	74 0e                	je     802bfa <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  802bec:	c1 e8 0c             	shr    $0xc,%eax
+  802bef:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802bf6:	ef 
+  802bf7:	0f b7 d2             	movzwl %dx,%edx
+}
+  802bfa:	89 d0                	mov    %edx,%eax
+  802bfc:	5d                   	pop    %ebp
+  802bfd:	c3                   	ret
+
+00802bfe <udivmod>:
+  802bfe:	55                   	push   %ebp
+  802bff:	57                   	push   %edi
+  802c00:	56                   	push   %esi
+  802c01:	53                   	push   %ebx
+  802c02:	83 ec 14             	sub    $0x14,%esp
+  802c05:	8b 74 24 28          	mov    0x28(%esp),%esi
+  802c09:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  802c0d:	89 fb                	mov    %edi,%ebx
+  802c0f:	09 f3                	or     %esi,%ebx
+  802c11:	0f 84 88 00 00 00    	je     802c9f <udivmod+0xa1>
+  802c17:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802c1c:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802c23:	00 
+  802c24:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802c2b:	00 
+  802c2c:	89 cd                	mov    %ecx,%ebp
+  802c2e:	89 34 24             	mov    %esi,(%esp)
+  802c31:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802c35:	eb 08                	jmp    802c3f <udivmod+0x41>
+  802c37:	83 ed 01             	sub    $0x1,%ebp
+  802c3a:	83 fd ff             	cmp    $0xffffffff,%ebp
+  802c3d:	74 6c                	je     802cab <udivmod+0xad>
+  802c3f:	89 c3                	mov    %eax,%ebx
+  802c41:	89 d6                	mov    %edx,%esi
+  802c43:	89 e9                	mov    %ebp,%ecx
+  802c45:	0f ad f3             	shrd   %cl,%esi,%ebx
+  802c48:	d3 ee                	shr    %cl,%esi
+  802c4a:	f6 c1 20             	test   $0x20,%cl
+  802c4d:	74 04                	je     802c53 <udivmod+0x55>
+  802c4f:	89 f3                	mov    %esi,%ebx
+  802c51:	31 f6                	xor    %esi,%esi
+  802c53:	8b 3c 24             	mov    (%esp),%edi
+  802c56:	39 fb                	cmp    %edi,%ebx
+  802c58:	89 f7                	mov    %esi,%edi
+  802c5a:	8b 1c 24             	mov    (%esp),%ebx
+  802c5d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802c61:	19 f7                	sbb    %esi,%edi
+  802c63:	72 d2                	jb     802c37 <udivmod+0x39>
+  802c65:	89 f7                	mov    %esi,%edi
+  802c67:	89 de                	mov    %ebx,%esi
+  802c69:	89 e9                	mov    %ebp,%ecx
+  802c6b:	0f a5 f7             	shld   %cl,%esi,%edi
+  802c6e:	d3 e6                	shl    %cl,%esi
+  802c70:	f6 c1 20             	test   $0x20,%cl
+  802c73:	74 04                	je     802c79 <udivmod+0x7b>
+  802c75:	89 f7                	mov    %esi,%edi
+  802c77:	31 f6                	xor    %esi,%esi
+  802c79:	29 f0                	sub    %esi,%eax
+  802c7b:	19 fa                	sbb    %edi,%edx
+  802c7d:	be 01 00 00 00       	mov    $0x1,%esi
+  802c82:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c87:	0f a5 f7             	shld   %cl,%esi,%edi
+  802c8a:	d3 e6                	shl    %cl,%esi
+  802c8c:	f6 c1 20             	test   $0x20,%cl
+  802c8f:	74 04                	je     802c95 <udivmod+0x97>
+  802c91:	89 f7                	mov    %esi,%edi
+  802c93:	31 f6                	xor    %esi,%esi
+  802c95:	09 74 24 08          	or     %esi,0x8(%esp)
+  802c99:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802c9d:	eb 98                	jmp    802c37 <udivmod+0x39>
+  802c9f:	89 f0                	mov    %esi,%eax
+  802ca1:	89 fa                	mov    %edi,%edx
+  802ca3:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802ca7:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802cab:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802caf:	89 01                	mov    %eax,(%ecx)
+  802cb1:	89 51 04             	mov    %edx,0x4(%ecx)
+  802cb4:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802cb8:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802cbc:	83 c4 14             	add    $0x14,%esp
+  802cbf:	5b                   	pop    %ebx
+  802cc0:	5e                   	pop    %esi
+  802cc1:	5f                   	pop    %edi
+  802cc2:	5d                   	pop    %ebp
+  802cc3:	c3                   	ret
+
+00802cc4 <__udivdi3>:
+  802cc4:	83 ec 18             	sub    $0x18,%esp
+  802cc7:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802ccb:	50                   	push   %eax
+  802ccc:	ff 74 24 2c          	push   0x2c(%esp)
+  802cd0:	ff 74 24 2c          	push   0x2c(%esp)
+  802cd4:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802cd8:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802cdc:	e8 1d ff ff ff       	call   802bfe <udivmod>
+  802ce1:	83 c4 24             	add    $0x24,%esp
+  802ce4:	c3                   	ret
+
+00802ce5 <__umoddi3>:
+  802ce5:	83 ec 18             	sub    $0x18,%esp
+  802ce8:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802cec:	50                   	push   %eax
+  802ced:	ff 74 24 2c          	push   0x2c(%esp)
+  802cf1:	ff 74 24 2c          	push   0x2c(%esp)
+  802cf5:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802cf9:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802cfd:	e8 fc fe ff ff       	call   802bfe <udivmod>
+  802d02:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802d06:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802d0a:	83 c4 24             	add    $0x24,%esp
+  802d0d:	c3                   	ret
+
+00802d0e <__divdi3>:
+  802d0e:	56                   	push   %esi
+  802d0f:	53                   	push   %ebx
+  802d10:	83 ec 14             	sub    $0x14,%esp
+  802d13:	8b 44 24 20          	mov    0x20(%esp),%eax
+  802d17:	8b 54 24 24          	mov    0x24(%esp),%edx
+  802d1b:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  802d1f:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  802d23:	85 d2                	test   %edx,%edx
+  802d25:	78 18                	js     802d3f <__divdi3+0x31>
+  802d27:	85 db                	test   %ebx,%ebx
+  802d29:	78 3e                	js     802d69 <__divdi3+0x5b>
+  802d2b:	83 ec 04             	sub    $0x4,%esp
+  802d2e:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802d32:	56                   	push   %esi
+  802d33:	53                   	push   %ebx
+  802d34:	51                   	push   %ecx
+  802d35:	e8 c4 fe ff ff       	call   802bfe <udivmod>
+  802d3a:	83 c4 10             	add    $0x10,%esp
+  802d3d:	eb 24                	jmp    802d63 <__divdi3+0x55>
+  802d3f:	f7 d8                	neg    %eax
+  802d41:	83 d2 00             	adc    $0x0,%edx
+  802d44:	f7 da                	neg    %edx
+  802d46:	85 db                	test   %ebx,%ebx
+  802d48:	78 3a                	js     802d84 <__divdi3+0x76>
+  802d4a:	83 ec 04             	sub    $0x4,%esp
+  802d4d:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802d51:	56                   	push   %esi
+  802d52:	53                   	push   %ebx
+  802d53:	51                   	push   %ecx
+  802d54:	e8 a5 fe ff ff       	call   802bfe <udivmod>
+  802d59:	83 c4 10             	add    $0x10,%esp
+  802d5c:	f7 d8                	neg    %eax
+  802d5e:	83 d2 00             	adc    $0x0,%edx
+  802d61:	f7 da                	neg    %edx
+  802d63:	83 c4 14             	add    $0x14,%esp
+  802d66:	5b                   	pop    %ebx
+  802d67:	5e                   	pop    %esi
+  802d68:	c3                   	ret
+  802d69:	83 ec 04             	sub    $0x4,%esp
+  802d6c:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802d70:	56                   	push   %esi
+  802d71:	f7 d9                	neg    %ecx
+  802d73:	83 d3 00             	adc    $0x0,%ebx
+  802d76:	f7 db                	neg    %ebx
+  802d78:	53                   	push   %ebx
+  802d79:	51                   	push   %ecx
+  802d7a:	e8 7f fe ff ff       	call   802bfe <udivmod>
+  802d7f:	83 c4 10             	add    $0x10,%esp
+  802d82:	eb d8                	jmp    802d5c <__divdi3+0x4e>
+  802d84:	83 ec 04             	sub    $0x4,%esp
+  802d87:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802d8b:	56                   	push   %esi
+  802d8c:	f7 d9                	neg    %ecx
+  802d8e:	83 d3 00             	adc    $0x0,%ebx
+  802d91:	f7 db                	neg    %ebx
+  802d93:	53                   	push   %ebx
+  802d94:	51                   	push   %ecx
+  802d95:	e8 64 fe ff ff       	call   802bfe <udivmod>
+  802d9a:	83 c4 10             	add    $0x10,%esp
+  802d9d:	eb c4                	jmp    802d63 <__divdi3+0x55>
+
+00802d9f <__moddi3>:
+  802d9f:	55                   	push   %ebp
+  802da0:	57                   	push   %edi
+  802da1:	56                   	push   %esi
+  802da2:	53                   	push   %ebx
+  802da3:	83 ec 24             	sub    $0x24,%esp
+  802da6:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802daa:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802dae:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  802db2:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  802db6:	85 d2                	test   %edx,%edx
+  802db8:	78 3b                	js     802df5 <__moddi3+0x56>
+  802dba:	83 ec 04             	sub    $0x4,%esp
+  802dbd:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  802dc1:	56                   	push   %esi
+  802dc2:	89 ce                	mov    %ecx,%esi
+  802dc4:	f7 de                	neg    %esi
+  802dc6:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802dca:	89 de                	mov    %ebx,%esi
+  802dcc:	83 d6 00             	adc    $0x0,%esi
+  802dcf:	f7 de                	neg    %esi
+  802dd1:	89 74 24 14          	mov    %esi,0x14(%esp)
+  802dd5:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802dd9:	0f 48 f1             	cmovs  %ecx,%esi
+  802ddc:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  802de1:	53                   	push   %ebx
+  802de2:	56                   	push   %esi
+  802de3:	e8 16 fe ff ff       	call   802bfe <udivmod>
+  802de8:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802dec:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802df0:	83 c4 10             	add    $0x10,%esp
+  802df3:	eb 47                	jmp    802e3c <__moddi3+0x9d>
+  802df5:	f7 d8                	neg    %eax
+  802df7:	83 d2 00             	adc    $0x0,%edx
+  802dfa:	f7 da                	neg    %edx
+  802dfc:	83 ec 04             	sub    $0x4,%esp
+  802dff:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  802e03:	56                   	push   %esi
+  802e04:	89 cf                	mov    %ecx,%edi
+  802e06:	f7 df                	neg    %edi
+  802e08:	89 de                	mov    %ebx,%esi
+  802e0a:	83 d6 00             	adc    $0x0,%esi
+  802e0d:	f7 de                	neg    %esi
+  802e0f:	0f 49 cf             	cmovns %edi,%ecx
+  802e12:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802e16:	0f 49 de             	cmovns %esi,%ebx
+  802e19:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  802e1d:	ff 74 24 0c          	push   0xc(%esp)
+  802e21:	ff 74 24 0c          	push   0xc(%esp)
+  802e25:	e8 d4 fd ff ff       	call   802bfe <udivmod>
+  802e2a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802e2e:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802e32:	f7 d8                	neg    %eax
+  802e34:	83 d2 00             	adc    $0x0,%edx
+  802e37:	f7 da                	neg    %edx
+  802e39:	83 c4 10             	add    $0x10,%esp
+  802e3c:	83 c4 24             	add    $0x24,%esp
+  802e3f:	5b                   	pop    %ebx
+  802e40:	5e                   	pop    %esi
+  802e41:	5f                   	pop    %edi
+  802e42:	5d                   	pop    %ebp
+  802e43:	c3                   	ret
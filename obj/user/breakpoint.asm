@@ -0,0 +1,6355 @@
+
+obj/user/breakpoint.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 04 00 00 00       	call   800035 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  asm volatile ("int $3");
+  800033:	cc                   	int3
+}
+  800034:	c3                   	ret
+
+00800035 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800035:	55                   	push   %ebp
+  800036:	89 e5                	mov    %esp,%ebp
+  800038:	56                   	push   %esi
+  800039:	53                   	push   %ebx
+  80003a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80003d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  800040:	c7 05 44 57 80 00 00 	movl   $0x0,0x805744
+  800047:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  80004a:	e8 d1 00 00 00       	call   800120 <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  80004f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800054:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800057:	c1 e0 04             	shl    $0x4,%eax
+  80005a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80005f:	a3 44 57 80 00       	mov    %eax,0x805744
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800064:	85 db                	test   %ebx,%ebx
+  800066:	7e 07                	jle    80006f <libmain+0x3a>
+    binaryname = argv[0];
+  800068:	8b 06                	mov    (%esi),%eax
+  80006a:	a3 00 40 80 00       	mov    %eax,0x804000
+
+  // call user main routine
+  umain(argc, argv);
+  80006f:	83 ec 08             	sub    $0x8,%esp
+  800072:	56                   	push   %esi
+  800073:	53                   	push   %ebx
+  800074:	e8 ba ff ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  800079:	e8 0a 00 00 00       	call   800088 <exit>
+}
+  80007e:	83 c4 10             	add    $0x10,%esp
+  800081:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800084:	5b                   	pop    %ebx
+  800085:	5e                   	pop    %esi
+  800086:	5d                   	pop    %ebp
+  800087:	c3                   	ret
+
+00800088 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800088:	55                   	push   %ebp
+  800089:	89 e5                	mov    %esp,%ebp
+  80008b:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  80008e:	e8 87 07 00 00       	call   80081a <close_all>
+  sys_env_destroy(0);
+  800093:	83 ec 0c             	sub    $0xc,%esp
+  800096:	6a 00                	push   $0x0
+  800098:	e8 42 00 00 00       	call   8000df <sys_env_destroy>
+}
+  80009d:	83 c4 10             	add    $0x10,%esp
+  8000a0:	c9                   	leave
+  8000a1:	c3                   	ret
+
+008000a2 <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8000a2:	55                   	push   %ebp
+  8000a3:	89 e5                	mov    %esp,%ebp
+  8000a5:	57                   	push   %edi
+  8000a6:	56                   	push   %esi
+  8000a7:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8000a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000b0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000b3:	89 c3                	mov    %eax,%ebx
+  8000b5:	89 c7                	mov    %eax,%edi
+  8000b7:	89 c6                	mov    %eax,%esi
+  8000b9:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  8000bb:	5b                   	pop    %ebx
+  8000bc:	5e                   	pop    %esi
+  8000bd:	5f                   	pop    %edi
+  8000be:	5d                   	pop    %ebp
+  8000bf:	c3                   	ret
+
+008000c0 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  8000c0:	55                   	push   %ebp
+  8000c1:	89 e5                	mov    %esp,%ebp
+  8000c3:	57                   	push   %edi
+  8000c4:	56                   	push   %esi
+  8000c5:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8000c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000cb:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000d0:	89 d1                	mov    %edx,%ecx
+  8000d2:	89 d3                	mov    %edx,%ebx
+  8000d4:	89 d7                	mov    %edx,%edi
+  8000d6:	89 d6                	mov    %edx,%esi
+  8000d8:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  8000da:	5b                   	pop    %ebx
+  8000db:	5e                   	pop    %esi
+  8000dc:	5f                   	pop    %edi
+  8000dd:	5d                   	pop    %ebp
+  8000de:	c3                   	ret
+
+008000df <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8000df:	55                   	push   %ebp
+  8000e0:	89 e5                	mov    %esp,%ebp
+  8000e2:	57                   	push   %edi
+  8000e3:	56                   	push   %esi
+  8000e4:	53                   	push   %ebx
+  8000e5:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8000e8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000ed:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000f0:	b8 03 00 00 00       	mov    $0x3,%eax
+  8000f5:	89 cb                	mov    %ecx,%ebx
+  8000f7:	89 cf                	mov    %ecx,%edi
+  8000f9:	89 ce                	mov    %ecx,%esi
+  8000fb:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8000fd:	85 c0                	test   %eax,%eax
+  8000ff:	7f 08                	jg     800109 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800101:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800104:	5b                   	pop    %ebx
+  800105:	5e                   	pop    %esi
+  800106:	5f                   	pop    %edi
+  800107:	5d                   	pop    %ebp
+  800108:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800109:	83 ec 0c             	sub    $0xc,%esp
+  80010c:	50                   	push   %eax
+  80010d:	6a 03                	push   $0x3
+  80010f:	68 4a 2e 80 00       	push   $0x802e4a
+  800114:	6a 23                	push   $0x23
+  800116:	68 67 2e 80 00       	push   $0x802e67
+  80011b:	e8 41 1f 00 00       	call   802061 <_panic>
+
+00800120 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800120:	55                   	push   %ebp
+  800121:	89 e5                	mov    %esp,%ebp
+  800123:	57                   	push   %edi
+  800124:	56                   	push   %esi
+  800125:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800126:	ba 00 00 00 00       	mov    $0x0,%edx
+  80012b:	b8 02 00 00 00       	mov    $0x2,%eax
+  800130:	89 d1                	mov    %edx,%ecx
+  800132:	89 d3                	mov    %edx,%ebx
+  800134:	89 d7                	mov    %edx,%edi
+  800136:	89 d6                	mov    %edx,%esi
+  800138:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  80013a:	5b                   	pop    %ebx
+  80013b:	5e                   	pop    %esi
+  80013c:	5f                   	pop    %edi
+  80013d:	5d                   	pop    %ebp
+  80013e:	c3                   	ret
+
+0080013f <sys_yield>:
+
+void
+sys_yield(void)
+{
+  80013f:	55                   	push   %ebp
+  800140:	89 e5                	mov    %esp,%ebp
+  800142:	57                   	push   %edi
+  800143:	56                   	push   %esi
+  800144:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800145:	ba 00 00 00 00       	mov    $0x0,%edx
+  80014a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80014f:	89 d1                	mov    %edx,%ecx
+  800151:	89 d3                	mov    %edx,%ebx
+  800153:	89 d7                	mov    %edx,%edi
+  800155:	89 d6                	mov    %edx,%esi
+  800157:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800159:	5b                   	pop    %ebx
+  80015a:	5e                   	pop    %esi
+  80015b:	5f                   	pop    %edi
+  80015c:	5d                   	pop    %ebp
+  80015d:	c3                   	ret
+
+0080015e <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  80015e:	55                   	push   %ebp
+  80015f:	89 e5                	mov    %esp,%ebp
+  800161:	57                   	push   %edi
+  800162:	56                   	push   %esi
+  800163:	53                   	push   %ebx
+  800164:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  800167:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  80016b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800170:	8b 55 08             	mov    0x8(%ebp),%edx
+  800173:	b8 14 00 00 00       	mov    $0x14,%eax
+  800178:	89 df                	mov    %ebx,%edi
+  80017a:	89 de                	mov    %ebx,%esi
+  80017c:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80017e:	85 c0                	test   %eax,%eax
+  800180:	7f 08                	jg     80018a <sys_env_set_cow+0x2c>
+}
+  800182:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800185:	5b                   	pop    %ebx
+  800186:	5e                   	pop    %esi
+  800187:	5f                   	pop    %edi
+  800188:	5d                   	pop    %ebp
+  800189:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80018a:	83 ec 0c             	sub    $0xc,%esp
+  80018d:	50                   	push   %eax
+  80018e:	6a 14                	push   $0x14
+  800190:	68 4a 2e 80 00       	push   $0x802e4a
+  800195:	6a 23                	push   $0x23
+  800197:	68 67 2e 80 00       	push   $0x802e67
+  80019c:	e8 c0 1e 00 00       	call   802061 <_panic>
+
+008001a1 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8001a1:	55                   	push   %ebp
+  8001a2:	89 e5                	mov    %esp,%ebp
+  8001a4:	57                   	push   %edi
+  8001a5:	56                   	push   %esi
+  8001a6:	53                   	push   %ebx
+  8001a7:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8001aa:	be 00 00 00 00       	mov    $0x0,%esi
+  8001af:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001b2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001b5:	b8 04 00 00 00       	mov    $0x4,%eax
+  8001ba:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001bd:	89 f7                	mov    %esi,%edi
+  8001bf:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8001c1:	85 c0                	test   %eax,%eax
+  8001c3:	7f 08                	jg     8001cd <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  8001c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001c8:	5b                   	pop    %ebx
+  8001c9:	5e                   	pop    %esi
+  8001ca:	5f                   	pop    %edi
+  8001cb:	5d                   	pop    %ebp
+  8001cc:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8001cd:	83 ec 0c             	sub    $0xc,%esp
+  8001d0:	50                   	push   %eax
+  8001d1:	6a 04                	push   $0x4
+  8001d3:	68 4a 2e 80 00       	push   $0x802e4a
+  8001d8:	6a 23                	push   $0x23
+  8001da:	68 67 2e 80 00       	push   $0x802e67
+  8001df:	e8 7d 1e 00 00       	call   802061 <_panic>
+
+008001e4 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8001e4:	55                   	push   %ebp
+  8001e5:	89 e5                	mov    %esp,%ebp
+  8001e7:	57                   	push   %edi
+  8001e8:	56                   	push   %esi
+  8001e9:	53                   	push   %ebx
+  8001ea:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8001ed:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001f0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001f3:	b8 05 00 00 00       	mov    $0x5,%eax
+  8001f8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001fb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8001fe:	8b 75 18             	mov    0x18(%ebp),%esi
+  800201:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800203:	85 c0                	test   %eax,%eax
+  800205:	7f 08                	jg     80020f <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  800207:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80020a:	5b                   	pop    %ebx
+  80020b:	5e                   	pop    %esi
+  80020c:	5f                   	pop    %edi
+  80020d:	5d                   	pop    %ebp
+  80020e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80020f:	83 ec 0c             	sub    $0xc,%esp
+  800212:	50                   	push   %eax
+  800213:	6a 05                	push   $0x5
+  800215:	68 4a 2e 80 00       	push   $0x802e4a
+  80021a:	6a 23                	push   $0x23
+  80021c:	68 67 2e 80 00       	push   $0x802e67
+  800221:	e8 3b 1e 00 00       	call   802061 <_panic>
+
+00800226 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800226:	55                   	push   %ebp
+  800227:	89 e5                	mov    %esp,%ebp
+  800229:	57                   	push   %edi
+  80022a:	56                   	push   %esi
+  80022b:	53                   	push   %ebx
+  80022c:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80022f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800234:	8b 55 08             	mov    0x8(%ebp),%edx
+  800237:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80023a:	b8 06 00 00 00       	mov    $0x6,%eax
+  80023f:	89 df                	mov    %ebx,%edi
+  800241:	89 de                	mov    %ebx,%esi
+  800243:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800245:	85 c0                	test   %eax,%eax
+  800247:	7f 08                	jg     800251 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  800249:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80024c:	5b                   	pop    %ebx
+  80024d:	5e                   	pop    %esi
+  80024e:	5f                   	pop    %edi
+  80024f:	5d                   	pop    %ebp
+  800250:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800251:	83 ec 0c             	sub    $0xc,%esp
+  800254:	50                   	push   %eax
+  800255:	6a 06                	push   $0x6
+  800257:	68 4a 2e 80 00       	push   $0x802e4a
+  80025c:	6a 23                	push   $0x23
+  80025e:	68 67 2e 80 00       	push   $0x802e67
+  800263:	e8 f9 1d 00 00       	call   802061 <_panic>
+
+00800268 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  800268:	55                   	push   %ebp
+  800269:	89 e5                	mov    %esp,%ebp
+  80026b:	57                   	push   %edi
+  80026c:	56                   	push   %esi
+  80026d:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80026e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800271:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800274:	b8 11 00 00 00       	mov    $0x11,%eax
+  800279:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80027c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80027f:	8b 75 18             	mov    0x18(%ebp),%esi
+  800282:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  800284:	5b                   	pop    %ebx
+  800285:	5e                   	pop    %esi
+  800286:	5f                   	pop    %edi
+  800287:	5d                   	pop    %ebp
+  800288:	c3                   	ret
+
+00800289 <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  800289:	55                   	push   %ebp
+  80028a:	89 e5                	mov    %esp,%ebp
+  80028c:	57                   	push   %edi
+  80028d:	56                   	push   %esi
+  80028e:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80028f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800292:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800295:	b8 12 00 00 00       	mov    $0x12,%eax
+  80029a:	be 00 00 00 00       	mov    $0x0,%esi
+  80029f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8002a2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8002a5:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  8002a7:	5b                   	pop    %ebx
+  8002a8:	5e                   	pop    %esi
+  8002a9:	5f                   	pop    %edi
+  8002aa:	5d                   	pop    %ebp
+  8002ab:	c3                   	ret
+
+008002ac <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  8002ac:	55                   	push   %ebp
+  8002ad:	89 e5                	mov    %esp,%ebp
+  8002af:	57                   	push   %edi
+  8002b0:	56                   	push   %esi
+  8002b1:	53                   	push   %ebx
+  8002b2:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8002b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002c0:	b8 16 00 00 00       	mov    $0x16,%eax
+  8002c5:	89 df                	mov    %ebx,%edi
+  8002c7:	89 de                	mov    %ebx,%esi
+  8002c9:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8002cb:	85 c0                	test   %eax,%eax
+  8002cd:	7f 08                	jg     8002d7 <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  8002cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002d2:	5b                   	pop    %ebx
+  8002d3:	5e                   	pop    %esi
+  8002d4:	5f                   	pop    %edi
+  8002d5:	5d                   	pop    %ebp
+  8002d6:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8002d7:	83 ec 0c             	sub    $0xc,%esp
+  8002da:	50                   	push   %eax
+  8002db:	6a 16                	push   $0x16
+  8002dd:	68 4a 2e 80 00       	push   $0x802e4a
+  8002e2:	6a 23                	push   $0x23
+  8002e4:	68 67 2e 80 00       	push   $0x802e67
+  8002e9:	e8 73 1d 00 00       	call   802061 <_panic>
+
+008002ee <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  8002ee:	55                   	push   %ebp
+  8002ef:	89 e5                	mov    %esp,%ebp
+  8002f1:	57                   	push   %edi
+  8002f2:	56                   	push   %esi
+  8002f3:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8002f4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8002f9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002fc:	b8 17 00 00 00       	mov    $0x17,%eax
+  800301:	89 cb                	mov    %ecx,%ebx
+  800303:	89 cf                	mov    %ecx,%edi
+  800305:	89 ce                	mov    %ecx,%esi
+  800307:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  800309:	5b                   	pop    %ebx
+  80030a:	5e                   	pop    %esi
+  80030b:	5f                   	pop    %edi
+  80030c:	5d                   	pop    %ebp
+  80030d:	c3                   	ret
+
+0080030e <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  80030e:	55                   	push   %ebp
+  80030f:	89 e5                	mov    %esp,%ebp
+  800311:	57                   	push   %edi
+  800312:	56                   	push   %esi
+  800313:	53                   	push   %ebx
+  800314:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800317:	be 00 00 00 00       	mov    $0x0,%esi
+  80031c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80031f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800322:	b8 18 00 00 00       	mov    $0x18,%eax
+  800327:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80032a:	89 f7                	mov    %esi,%edi
+  80032c:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80032e:	85 c0                	test   %eax,%eax
+  800330:	7f 08                	jg     80033a <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  800332:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800335:	5b                   	pop    %ebx
+  800336:	5e                   	pop    %esi
+  800337:	5f                   	pop    %edi
+  800338:	5d                   	pop    %ebp
+  800339:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80033a:	83 ec 0c             	sub    $0xc,%esp
+  80033d:	50                   	push   %eax
+  80033e:	6a 18                	push   $0x18
+  800340:	68 4a 2e 80 00       	push   $0x802e4a
+  800345:	6a 23                	push   $0x23
+  800347:	68 67 2e 80 00       	push   $0x802e67
+  80034c:	e8 10 1d 00 00       	call   802061 <_panic>
+
+00800351 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  800351:	55                   	push   %ebp
+  800352:	89 e5                	mov    %esp,%ebp
+  800354:	57                   	push   %edi
+  800355:	56                   	push   %esi
+  800356:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800357:	be 00 00 00 00       	mov    $0x0,%esi
+  80035c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80035f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800362:	b8 19 00 00 00       	mov    $0x19,%eax
+  800367:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80036a:	89 f7                	mov    %esi,%edi
+  80036c:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  80036e:	5b                   	pop    %ebx
+  80036f:	5e                   	pop    %esi
+  800370:	5f                   	pop    %edi
+  800371:	5d                   	pop    %ebp
+  800372:	c3                   	ret
+
+00800373 <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  800373:	55                   	push   %ebp
+  800374:	89 e5                	mov    %esp,%ebp
+  800376:	57                   	push   %edi
+  800377:	56                   	push   %esi
+  800378:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800379:	ba 00 00 00 00       	mov    $0x0,%edx
+  80037e:	b8 15 00 00 00       	mov    $0x15,%eax
+  800383:	89 d1                	mov    %edx,%ecx
+  800385:	89 d3                	mov    %edx,%ebx
+  800387:	89 d7                	mov    %edx,%edi
+  800389:	89 d6                	mov    %edx,%esi
+  80038b:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  80038d:	5b                   	pop    %ebx
+  80038e:	5e                   	pop    %esi
+  80038f:	5f                   	pop    %edi
+  800390:	5d                   	pop    %ebp
+  800391:	c3                   	ret
+
+00800392 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800392:	55                   	push   %ebp
+  800393:	89 e5                	mov    %esp,%ebp
+  800395:	57                   	push   %edi
+  800396:	56                   	push   %esi
+  800397:	53                   	push   %ebx
+  800398:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80039b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003a0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003a3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003a6:	b8 08 00 00 00       	mov    $0x8,%eax
+  8003ab:	89 df                	mov    %ebx,%edi
+  8003ad:	89 de                	mov    %ebx,%esi
+  8003af:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8003b1:	85 c0                	test   %eax,%eax
+  8003b3:	7f 08                	jg     8003bd <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8003b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003b8:	5b                   	pop    %ebx
+  8003b9:	5e                   	pop    %esi
+  8003ba:	5f                   	pop    %edi
+  8003bb:	5d                   	pop    %ebp
+  8003bc:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8003bd:	83 ec 0c             	sub    $0xc,%esp
+  8003c0:	50                   	push   %eax
+  8003c1:	6a 08                	push   $0x8
+  8003c3:	68 4a 2e 80 00       	push   $0x802e4a
+  8003c8:	6a 23                	push   $0x23
+  8003ca:	68 67 2e 80 00       	push   $0x802e67
+  8003cf:	e8 8d 1c 00 00       	call   802061 <_panic>
+
+008003d4 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8003d4:	55                   	push   %ebp
+  8003d5:	89 e5                	mov    %esp,%ebp
+  8003d7:	57                   	push   %edi
+  8003d8:	56                   	push   %esi
+  8003d9:	53                   	push   %ebx
+  8003da:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8003dd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003e2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003e5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003e8:	b8 09 00 00 00       	mov    $0x9,%eax
+  8003ed:	89 df                	mov    %ebx,%edi
+  8003ef:	89 de                	mov    %ebx,%esi
+  8003f1:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8003f3:	85 c0                	test   %eax,%eax
+  8003f5:	7f 08                	jg     8003ff <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  8003f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003fa:	5b                   	pop    %ebx
+  8003fb:	5e                   	pop    %esi
+  8003fc:	5f                   	pop    %edi
+  8003fd:	5d                   	pop    %ebp
+  8003fe:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8003ff:	83 ec 0c             	sub    $0xc,%esp
+  800402:	50                   	push   %eax
+  800403:	6a 09                	push   $0x9
+  800405:	68 4a 2e 80 00       	push   $0x802e4a
+  80040a:	6a 23                	push   $0x23
+  80040c:	68 67 2e 80 00       	push   $0x802e67
+  800411:	e8 4b 1c 00 00       	call   802061 <_panic>
+
+00800416 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800416:	55                   	push   %ebp
+  800417:	89 e5                	mov    %esp,%ebp
+  800419:	57                   	push   %edi
+  80041a:	56                   	push   %esi
+  80041b:	53                   	push   %ebx
+  80041c:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80041f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800424:	8b 55 08             	mov    0x8(%ebp),%edx
+  800427:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80042a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80042f:	89 df                	mov    %ebx,%edi
+  800431:	89 de                	mov    %ebx,%esi
+  800433:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800435:	85 c0                	test   %eax,%eax
+  800437:	7f 08                	jg     800441 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  800439:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80043c:	5b                   	pop    %ebx
+  80043d:	5e                   	pop    %esi
+  80043e:	5f                   	pop    %edi
+  80043f:	5d                   	pop    %ebp
+  800440:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800441:	83 ec 0c             	sub    $0xc,%esp
+  800444:	50                   	push   %eax
+  800445:	6a 0a                	push   $0xa
+  800447:	68 4a 2e 80 00       	push   $0x802e4a
+  80044c:	6a 23                	push   $0x23
+  80044e:	68 67 2e 80 00       	push   $0x802e67
+  800453:	e8 09 1c 00 00       	call   802061 <_panic>
+
+00800458 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  800458:	55                   	push   %ebp
+  800459:	89 e5                	mov    %esp,%ebp
+  80045b:	57                   	push   %edi
+  80045c:	56                   	push   %esi
+  80045d:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80045e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800461:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800464:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800469:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80046c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80046f:	8b 75 18             	mov    0x18(%ebp),%esi
+  800472:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  800474:	5b                   	pop    %ebx
+  800475:	5e                   	pop    %esi
+  800476:	5f                   	pop    %edi
+  800477:	5d                   	pop    %ebp
+  800478:	c3                   	ret
+
+00800479 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  800479:	55                   	push   %ebp
+  80047a:	89 e5                	mov    %esp,%ebp
+  80047c:	57                   	push   %edi
+  80047d:	56                   	push   %esi
+  80047e:	53                   	push   %ebx
+  80047f:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800482:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800487:	8b 55 08             	mov    0x8(%ebp),%edx
+  80048a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80048d:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800492:	89 df                	mov    %ebx,%edi
+  800494:	89 de                	mov    %ebx,%esi
+  800496:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800498:	85 c0                	test   %eax,%eax
+  80049a:	7f 08                	jg     8004a4 <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  80049c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80049f:	5b                   	pop    %ebx
+  8004a0:	5e                   	pop    %esi
+  8004a1:	5f                   	pop    %edi
+  8004a2:	5d                   	pop    %ebp
+  8004a3:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8004a4:	83 ec 0c             	sub    $0xc,%esp
+  8004a7:	50                   	push   %eax
+  8004a8:	6a 0d                	push   $0xd
+  8004aa:	68 4a 2e 80 00       	push   $0x802e4a
+  8004af:	6a 23                	push   $0x23
+  8004b1:	68 67 2e 80 00       	push   $0x802e67
+  8004b6:	e8 a6 1b 00 00       	call   802061 <_panic>
+
+008004bb <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  8004bb:	55                   	push   %ebp
+  8004bc:	89 e5                	mov    %esp,%ebp
+  8004be:	57                   	push   %edi
+  8004bf:	56                   	push   %esi
+  8004c0:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8004c1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004c6:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8004cb:	89 d1                	mov    %edx,%ecx
+  8004cd:	89 d3                	mov    %edx,%ebx
+  8004cf:	89 d7                	mov    %edx,%edi
+  8004d1:	89 d6                	mov    %edx,%esi
+  8004d3:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8004d5:	5b                   	pop    %ebx
+  8004d6:	5e                   	pop    %esi
+  8004d7:	5f                   	pop    %edi
+  8004d8:	5d                   	pop    %ebp
+  8004d9:	c3                   	ret
+
+008004da <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  8004da:	55                   	push   %ebp
+  8004db:	89 e5                	mov    %esp,%ebp
+  8004dd:	57                   	push   %edi
+  8004de:	56                   	push   %esi
+  8004df:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8004e0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004e3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004e6:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8004eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8004f0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8004f3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8004f6:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  8004f8:	5b                   	pop    %ebx
+  8004f9:	5e                   	pop    %esi
+  8004fa:	5f                   	pop    %edi
+  8004fb:	5d                   	pop    %ebp
+  8004fc:	c3                   	ret
+
+008004fd <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  8004fd:	55                   	push   %ebp
+  8004fe:	89 e5                	mov    %esp,%ebp
+  800500:	57                   	push   %edi
+  800501:	56                   	push   %esi
+  800502:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800503:	be 00 00 00 00       	mov    $0x0,%esi
+  800508:	8b 55 08             	mov    0x8(%ebp),%edx
+  80050b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80050e:	b8 10 00 00 00       	mov    $0x10,%eax
+  800513:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800516:	89 f7                	mov    %esi,%edi
+  800518:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  80051a:	5b                   	pop    %ebx
+  80051b:	5e                   	pop    %esi
+  80051c:	5f                   	pop    %edi
+  80051d:	5d                   	pop    %ebp
+  80051e:	c3                   	ret
+
+0080051f <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  80051f:	55                   	push   %ebp
+  800520:	89 e5                	mov    %esp,%ebp
+  800522:	57                   	push   %edi
+  800523:	56                   	push   %esi
+  800524:	53                   	push   %ebx
+  800525:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  800528:	80 3d 48 57 80 00 00 	cmpb   $0x0,0x805748
+  80052f:	74 41                	je     800572 <sys_batch+0x53>
+  800531:	8b 45 08             	mov    0x8(%ebp),%eax
+  800534:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  800537:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  80053e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800541:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  800544:	7d 45                	jge    80058b <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  800546:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800549:	8b 06                	mov    (%esi),%eax
+  80054b:	8b 56 04             	mov    0x4(%esi),%edx
+  80054e:	8b 4e 08             	mov    0x8(%esi),%ecx
+  800551:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  800554:	8b 7e 10             	mov    0x10(%esi),%edi
+  800557:	8b 76 14             	mov    0x14(%esi),%esi
+  80055a:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  80055c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80055f:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  800562:	83 c6 1c             	add    $0x1c,%esi
+  800565:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  800568:	85 c0                	test   %eax,%eax
+  80056a:	78 1f                	js     80058b <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  80056c:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  800570:	eb cc                	jmp    80053e <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  800572:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800577:	b8 13 00 00 00       	mov    $0x13,%eax
+  80057c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80057f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800582:	89 df                	mov    %ebx,%edi
+  800584:	89 de                	mov    %ebx,%esi
+  800586:	cd 30                	int    $0x30
+  800588:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  80058b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80058e:	83 c4 08             	add    $0x8,%esp
+  800591:	5b                   	pop    %ebx
+  800592:	5e                   	pop    %esi
+  800593:	5f                   	pop    %edi
+  800594:	5d                   	pop    %ebp
+  800595:	c3                   	ret
+
+00800596 <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  800596:	55                   	push   %ebp
+  800597:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  800599:	8b 45 08             	mov    0x8(%ebp),%eax
+  80059c:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8005a2:	5d                   	pop    %ebp
+  8005a3:	c3                   	ret
+
+008005a4 <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  8005a4:	55                   	push   %ebp
+  8005a5:	89 e5                	mov    %esp,%ebp
+  8005a7:	56                   	push   %esi
+  8005a8:	53                   	push   %ebx
+  8005a9:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  8005ac:	8b 1e                	mov    (%esi),%ebx
+  8005ae:	85 db                	test   %ebx,%ebx
+  8005b0:	75 09                	jne    8005bb <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  8005b2:	89 d8                	mov    %ebx,%eax
+  8005b4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8005b7:	5b                   	pop    %ebx
+  8005b8:	5e                   	pop    %esi
+  8005b9:	5d                   	pop    %ebp
+  8005ba:	c3                   	ret
+  b->sb_n = 0;
+  8005bb:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  8005c1:	53                   	push   %ebx
+  8005c2:	8d 46 04             	lea    0x4(%esi),%eax
+  8005c5:	50                   	push   %eax
+  8005c6:	e8 54 ff ff ff       	call   80051f <sys_batch>
+  8005cb:	83 c4 08             	add    $0x8,%esp
+  8005ce:	85 c0                	test   %eax,%eax
+  8005d0:	78 1e                	js     8005f0 <sysbatch_flush+0x4c>
+  if (r < n)
+  8005d2:	39 c3                	cmp    %eax,%ebx
+  8005d4:	7f 07                	jg     8005dd <sysbatch_flush+0x39>
+  return 0;
+  8005d6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005db:	eb d5                	jmp    8005b2 <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  8005dd:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8005e0:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  8005e4:	85 db                	test   %ebx,%ebx
+  8005e6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8005eb:	0f 49 d8             	cmovns %eax,%ebx
+  8005ee:	eb c2                	jmp    8005b2 <sysbatch_flush+0xe>
+    return r;
+  8005f0:	89 c3                	mov    %eax,%ebx
+  8005f2:	eb be                	jmp    8005b2 <sysbatch_flush+0xe>
+
+008005f4 <sysbatch_add>:
+{
+  8005f4:	55                   	push   %ebp
+  8005f5:	89 e5                	mov    %esp,%ebp
+  8005f7:	53                   	push   %ebx
+  8005f8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  8005fb:	83 3b 40             	cmpl   $0x40,(%ebx)
+  8005fe:	74 41                	je     800641 <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  800600:	8b 03                	mov    (%ebx),%eax
+  800602:	8d 50 01             	lea    0x1(%eax),%edx
+  800605:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  800607:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80060a:	01 d8                	add    %ebx,%eax
+  80060c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80060f:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  800612:	8b 55 10             	mov    0x10(%ebp),%edx
+  800615:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  800618:	8b 55 14             	mov    0x14(%ebp),%edx
+  80061b:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  80061e:	8b 55 18             	mov    0x18(%ebp),%edx
+  800621:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  800624:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  800627:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  80062a:	8b 55 20             	mov    0x20(%ebp),%edx
+  80062d:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  800630:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  800637:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80063c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80063f:	c9                   	leave
+  800640:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  800641:	53                   	push   %ebx
+  800642:	e8 5d ff ff ff       	call   8005a4 <sysbatch_flush>
+  800647:	83 c4 04             	add    $0x4,%esp
+  80064a:	85 c0                	test   %eax,%eax
+  80064c:	79 b2                	jns    800600 <sysbatch_add+0xc>
+  80064e:	eb ec                	jmp    80063c <sysbatch_add+0x48>
+
+00800650 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800650:	55                   	push   %ebp
+  800651:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  800653:	8b 45 08             	mov    0x8(%ebp),%eax
+  800656:	05 00 00 00 30       	add    $0x30000000,%eax
+  80065b:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80065e:	5d                   	pop    %ebp
+  80065f:	c3                   	ret
+
+00800660 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800660:	55                   	push   %ebp
+  800661:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  800663:	8b 45 08             	mov    0x8(%ebp),%eax
+  800666:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  800669:	66 b8 00 00          	mov    $0x0,%ax
+  80066d:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  800672:	5d                   	pop    %ebp
+  800673:	c3                   	ret
+
+00800674 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800674:	55                   	push   %ebp
+  800675:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  800677:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80067c:	eb 02                	jmp    800680 <fd_alloc+0xc>
+  80067e:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800680:	89 c2                	mov    %eax,%edx
+  800682:	c1 ea 16             	shr    $0x16,%edx
+  800685:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80068c:	f6 c2 01             	test   $0x1,%dl
+  80068f:	74 2b                	je     8006bc <fd_alloc+0x48>
+  800691:	89 c2                	mov    %eax,%edx
+  800693:	c1 ea 0c             	shr    $0xc,%edx
+  800696:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80069d:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8006a3:	f6 c1 01             	test   $0x1,%cl
+  8006a6:	74 14                	je     8006bc <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  8006a8:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8006ae:	75 ce                	jne    80067e <fd_alloc+0xa>
+  8006b0:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  8006b5:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8006ba:	eb 05                	jmp    8006c1 <fd_alloc+0x4d>
+      return 0;
+  8006bc:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  8006c1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006c4:	89 02                	mov    %eax,(%edx)
+}
+  8006c6:	89 c8                	mov    %ecx,%eax
+  8006c8:	5d                   	pop    %ebp
+  8006c9:	c3                   	ret
+
+008006ca <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8006ca:	55                   	push   %ebp
+  8006cb:	89 e5                	mov    %esp,%ebp
+  8006cd:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  8006d0:	83 f8 1f             	cmp    $0x1f,%eax
+  8006d3:	77 30                	ja     800705 <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  8006d5:	c1 e0 0c             	shl    $0xc,%eax
+  8006d8:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8006dd:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8006e3:	f6 c2 01             	test   $0x1,%dl
+  8006e6:	74 24                	je     80070c <fd_lookup+0x42>
+  8006e8:	89 c2                	mov    %eax,%edx
+  8006ea:	c1 ea 0c             	shr    $0xc,%edx
+  8006ed:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8006f4:	f6 c2 01             	test   $0x1,%dl
+  8006f7:	74 1a                	je     800713 <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  8006f9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8006fc:	89 02                	mov    %eax,(%edx)
+  return 0;
+  8006fe:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800703:	5d                   	pop    %ebp
+  800704:	c3                   	ret
+    return -E_INVAL;
+  800705:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80070a:	eb f7                	jmp    800703 <fd_lookup+0x39>
+    return -E_INVAL;
+  80070c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800711:	eb f0                	jmp    800703 <fd_lookup+0x39>
+  800713:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800718:	eb e9                	jmp    800703 <fd_lookup+0x39>
+
+0080071a <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80071a:	55                   	push   %ebp
+  80071b:	89 e5                	mov    %esp,%ebp
+  80071d:	53                   	push   %ebx
+  80071e:	83 ec 04             	sub    $0x4,%esp
+  800721:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  800724:	b8 f4 2e 80 00       	mov    $0x802ef4,%eax
+  800729:	8b 18                	mov    (%eax),%ebx
+  80072b:	85 db                	test   %ebx,%ebx
+  80072d:	74 0e                	je     80073d <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  80072f:	83 c0 04             	add    $0x4,%eax
+  800732:	39 13                	cmp    %edx,(%ebx)
+  800734:	75 f3                	jne    800729 <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  800736:	b8 00 00 00 00       	mov    $0x0,%eax
+  80073b:	eb 1f                	jmp    80075c <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80073d:	a1 44 57 80 00       	mov    0x805744,%eax
+  800742:	8b 40 48             	mov    0x48(%eax),%eax
+  800745:	83 ec 04             	sub    $0x4,%esp
+  800748:	52                   	push   %edx
+  800749:	50                   	push   %eax
+  80074a:	68 78 2e 80 00       	push   $0x802e78
+  80074f:	e8 e8 19 00 00       	call   80213c <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  800754:	83 c4 10             	add    $0x10,%esp
+  800757:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  80075c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80075f:	89 1a                	mov    %ebx,(%edx)
+}
+  800761:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800764:	c9                   	leave
+  800765:	c3                   	ret
+
+00800766 <fd_close>:
+{
+  800766:	55                   	push   %ebp
+  800767:	89 e5                	mov    %esp,%ebp
+  800769:	57                   	push   %edi
+  80076a:	56                   	push   %esi
+  80076b:	53                   	push   %ebx
+  80076c:	83 ec 24             	sub    $0x24,%esp
+  80076f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800772:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800775:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800778:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  800779:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80077f:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800782:	50                   	push   %eax
+  800783:	e8 42 ff ff ff       	call   8006ca <fd_lookup>
+  800788:	89 c3                	mov    %eax,%ebx
+  80078a:	83 c4 10             	add    $0x10,%esp
+  80078d:	85 c0                	test   %eax,%eax
+  80078f:	78 05                	js     800796 <fd_close+0x30>
+      || fd != fd2)
+  800791:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  800794:	74 16                	je     8007ac <fd_close+0x46>
+    return must_exist ? r : 0;
+  800796:	89 f8                	mov    %edi,%eax
+  800798:	84 c0                	test   %al,%al
+  80079a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80079f:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8007a2:	89 d8                	mov    %ebx,%eax
+  8007a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007a7:	5b                   	pop    %ebx
+  8007a8:	5e                   	pop    %esi
+  8007a9:	5f                   	pop    %edi
+  8007aa:	5d                   	pop    %ebp
+  8007ab:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8007ac:	83 ec 08             	sub    $0x8,%esp
+  8007af:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8007b2:	50                   	push   %eax
+  8007b3:	ff 36                	push   (%esi)
+  8007b5:	e8 60 ff ff ff       	call   80071a <dev_lookup>
+  8007ba:	89 c3                	mov    %eax,%ebx
+  8007bc:	83 c4 10             	add    $0x10,%esp
+  8007bf:	85 c0                	test   %eax,%eax
+  8007c1:	78 1a                	js     8007dd <fd_close+0x77>
+    if (dev->dev_close)
+  8007c3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8007c6:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  8007c9:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  8007ce:	85 c0                	test   %eax,%eax
+  8007d0:	74 0b                	je     8007dd <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  8007d2:	83 ec 0c             	sub    $0xc,%esp
+  8007d5:	56                   	push   %esi
+  8007d6:	ff d0                	call   *%eax
+  8007d8:	89 c3                	mov    %eax,%ebx
+  8007da:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  8007dd:	83 ec 08             	sub    $0x8,%esp
+  8007e0:	56                   	push   %esi
+  8007e1:	6a 00                	push   $0x0
+  8007e3:	e8 3e fa ff ff       	call   800226 <sys_page_unmap>
+  return r;
+  8007e8:	83 c4 10             	add    $0x10,%esp
+  8007eb:	eb b5                	jmp    8007a2 <fd_close+0x3c>
+
+008007ed <close>:
+
+int
+close(int fdnum)
+{
+  8007ed:	55                   	push   %ebp
+  8007ee:	89 e5                	mov    %esp,%ebp
+  8007f0:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8007f3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8007f6:	50                   	push   %eax
+  8007f7:	ff 75 08             	push   0x8(%ebp)
+  8007fa:	e8 cb fe ff ff       	call   8006ca <fd_lookup>
+  8007ff:	83 c4 10             	add    $0x10,%esp
+  800802:	85 c0                	test   %eax,%eax
+  800804:	79 02                	jns    800808 <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  800806:	c9                   	leave
+  800807:	c3                   	ret
+    return fd_close(fd, 1);
+  800808:	83 ec 08             	sub    $0x8,%esp
+  80080b:	6a 01                	push   $0x1
+  80080d:	ff 75 f4             	push   -0xc(%ebp)
+  800810:	e8 51 ff ff ff       	call   800766 <fd_close>
+  800815:	83 c4 10             	add    $0x10,%esp
+  800818:	eb ec                	jmp    800806 <close+0x19>
+
+0080081a <close_all>:
+
+void
+close_all(void)
+{
+  80081a:	55                   	push   %ebp
+  80081b:	89 e5                	mov    %esp,%ebp
+  80081d:	53                   	push   %ebx
+  80081e:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  800821:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  800826:	83 ec 0c             	sub    $0xc,%esp
+  800829:	53                   	push   %ebx
+  80082a:	e8 be ff ff ff       	call   8007ed <close>
+  for (i = 0; i < MAXFD; i++)
+  80082f:	83 c3 01             	add    $0x1,%ebx
+  800832:	83 c4 10             	add    $0x10,%esp
+  800835:	83 fb 20             	cmp    $0x20,%ebx
+  800838:	75 ec                	jne    800826 <close_all+0xc>
+}
+  80083a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80083d:	c9                   	leave
+  80083e:	c3                   	ret
+
+0080083f <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80083f:	55                   	push   %ebp
+  800840:	89 e5                	mov    %esp,%ebp
+  800842:	57                   	push   %edi
+  800843:	56                   	push   %esi
+  800844:	53                   	push   %ebx
+  800845:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  800848:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80084b:	50                   	push   %eax
+  80084c:	ff 75 08             	push   0x8(%ebp)
+  80084f:	e8 76 fe ff ff       	call   8006ca <fd_lookup>
+  800854:	89 c6                	mov    %eax,%esi
+  800856:	83 c4 10             	add    $0x10,%esp
+  800859:	85 c0                	test   %eax,%eax
+  80085b:	0f 88 0a 01 00 00    	js     80096b <dup+0x12c>
+    return r;
+  close(newfdnum);
+  800861:	83 ec 0c             	sub    $0xc,%esp
+  800864:	ff 75 0c             	push   0xc(%ebp)
+  800867:	e8 81 ff ff ff       	call   8007ed <close>
+
+  newfd = INDEX2FD(newfdnum);
+  80086c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80086f:	c1 e0 0c             	shl    $0xc,%eax
+  800872:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  800878:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  80087b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80087e:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800881:	89 04 24             	mov    %eax,(%esp)
+  800884:	e8 d7 fd ff ff       	call   800660 <fd2data>
+  800889:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  80088b:	89 3c 24             	mov    %edi,(%esp)
+  80088e:	e8 cd fd ff ff       	call   800660 <fd2data>
+  800893:	83 c4 10             	add    $0x10,%esp
+  800896:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  800899:	89 f3                	mov    %esi,%ebx
+  80089b:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  8008a1:	89 c6                	mov    %eax,%esi
+  8008a3:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8008a6:	89 cf                	mov    %ecx,%edi
+  8008a8:	eb 0c                	jmp    8008b6 <dup+0x77>
+  8008aa:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8008b0:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8008b6:	39 fb                	cmp    %edi,%ebx
+  8008b8:	74 7b                	je     800935 <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  8008ba:	89 d8                	mov    %ebx,%eax
+  8008bc:	c1 e8 16             	shr    $0x16,%eax
+  8008bf:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8008c6:	a8 01                	test   $0x1,%al
+  8008c8:	74 e0                	je     8008aa <dup+0x6b>
+  8008ca:	89 d8                	mov    %ebx,%eax
+  8008cc:	c1 e8 0c             	shr    $0xc,%eax
+  8008cf:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8008d6:	f6 c2 01             	test   $0x1,%dl
+  8008d9:	74 cf                	je     8008aa <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  8008db:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  8008e2:	83 ec 0c             	sub    $0xc,%esp
+  8008e5:	25 07 0e 00 00       	and    $0xe07,%eax
+  8008ea:	50                   	push   %eax
+  8008eb:	56                   	push   %esi
+  8008ec:	6a 00                	push   $0x0
+  8008ee:	53                   	push   %ebx
+  8008ef:	6a 00                	push   $0x0
+  8008f1:	e8 ee f8 ff ff       	call   8001e4 <sys_page_map>
+  8008f6:	83 c4 20             	add    $0x20,%esp
+  8008f9:	85 c0                	test   %eax,%eax
+  8008fb:	79 ad                	jns    8008aa <dup+0x6b>
+  8008fd:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800900:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  800902:	83 ec 08             	sub    $0x8,%esp
+  800905:	ff 75 d4             	push   -0x2c(%ebp)
+  800908:	6a 00                	push   $0x0
+  80090a:	e8 17 f9 ff ff       	call   800226 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80090f:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  800912:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  800918:	83 c4 10             	add    $0x10,%esp
+  80091b:	39 df                	cmp    %ebx,%edi
+  80091d:	74 4c                	je     80096b <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  80091f:	83 ec 08             	sub    $0x8,%esp
+  800922:	57                   	push   %edi
+  800923:	6a 00                	push   $0x0
+  800925:	e8 fc f8 ff ff       	call   800226 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80092a:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  800930:	83 c4 10             	add    $0x10,%esp
+  800933:	eb e6                	jmp    80091b <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  800935:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800938:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80093b:	89 c8                	mov    %ecx,%eax
+  80093d:	c1 e8 0c             	shr    $0xc,%eax
+  800940:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800947:	83 ec 0c             	sub    $0xc,%esp
+  80094a:	25 07 0e 00 00       	and    $0xe07,%eax
+  80094f:	50                   	push   %eax
+  800950:	ff 75 d4             	push   -0x2c(%ebp)
+  800953:	6a 00                	push   $0x0
+  800955:	51                   	push   %ecx
+  800956:	6a 00                	push   $0x0
+  800958:	e8 87 f8 ff ff       	call   8001e4 <sys_page_map>
+  80095d:	89 c6                	mov    %eax,%esi
+  80095f:	83 c4 20             	add    $0x20,%esp
+  800962:	85 c0                	test   %eax,%eax
+  800964:	78 9c                	js     800902 <dup+0xc3>
+  return newfdnum;
+  800966:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800969:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  80096b:	89 f0                	mov    %esi,%eax
+  80096d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800970:	5b                   	pop    %ebx
+  800971:	5e                   	pop    %esi
+  800972:	5f                   	pop    %edi
+  800973:	5d                   	pop    %ebp
+  800974:	c3                   	ret
+
+00800975 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  800975:	55                   	push   %ebp
+  800976:	89 e5                	mov    %esp,%ebp
+  800978:	56                   	push   %esi
+  800979:	53                   	push   %ebx
+  80097a:	83 ec 18             	sub    $0x18,%esp
+  80097d:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  800980:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800983:	50                   	push   %eax
+  800984:	56                   	push   %esi
+  800985:	e8 40 fd ff ff       	call   8006ca <fd_lookup>
+  80098a:	83 c4 10             	add    $0x10,%esp
+  80098d:	85 c0                	test   %eax,%eax
+  80098f:	78 3c                	js     8009cd <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800991:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  800994:	83 ec 08             	sub    $0x8,%esp
+  800997:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80099a:	50                   	push   %eax
+  80099b:	ff 33                	push   (%ebx)
+  80099d:	e8 78 fd ff ff       	call   80071a <dev_lookup>
+  8009a2:	83 c4 10             	add    $0x10,%esp
+  8009a5:	85 c0                	test   %eax,%eax
+  8009a7:	78 24                	js     8009cd <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8009a9:	8b 43 08             	mov    0x8(%ebx),%eax
+  8009ac:	83 e0 03             	and    $0x3,%eax
+  8009af:	83 f8 01             	cmp    $0x1,%eax
+  8009b2:	74 20                	je     8009d4 <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  8009b4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009b7:	8b 40 08             	mov    0x8(%eax),%eax
+  8009ba:	85 c0                	test   %eax,%eax
+  8009bc:	74 37                	je     8009f5 <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  8009be:	83 ec 04             	sub    $0x4,%esp
+  8009c1:	ff 75 10             	push   0x10(%ebp)
+  8009c4:	ff 75 0c             	push   0xc(%ebp)
+  8009c7:	53                   	push   %ebx
+  8009c8:	ff d0                	call   *%eax
+  8009ca:	83 c4 10             	add    $0x10,%esp
+}
+  8009cd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8009d0:	5b                   	pop    %ebx
+  8009d1:	5e                   	pop    %esi
+  8009d2:	5d                   	pop    %ebp
+  8009d3:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8009d4:	a1 44 57 80 00       	mov    0x805744,%eax
+  8009d9:	8b 40 48             	mov    0x48(%eax),%eax
+  8009dc:	83 ec 04             	sub    $0x4,%esp
+  8009df:	56                   	push   %esi
+  8009e0:	50                   	push   %eax
+  8009e1:	68 b9 2e 80 00       	push   $0x802eb9
+  8009e6:	e8 51 17 00 00       	call   80213c <cprintf>
+    return -E_INVAL;
+  8009eb:	83 c4 10             	add    $0x10,%esp
+  8009ee:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8009f3:	eb d8                	jmp    8009cd <read+0x58>
+    return -E_NOT_SUPP;
+  8009f5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8009fa:	eb d1                	jmp    8009cd <read+0x58>
+
+008009fc <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8009fc:	55                   	push   %ebp
+  8009fd:	89 e5                	mov    %esp,%ebp
+  8009ff:	57                   	push   %edi
+  800a00:	56                   	push   %esi
+  800a01:	53                   	push   %ebx
+  800a02:	83 ec 0c             	sub    $0xc,%esp
+  800a05:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a08:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  800a0b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800a10:	eb 02                	jmp    800a14 <readn+0x18>
+  800a12:	01 c3                	add    %eax,%ebx
+  800a14:	39 f3                	cmp    %esi,%ebx
+  800a16:	73 21                	jae    800a39 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  800a18:	83 ec 04             	sub    $0x4,%esp
+  800a1b:	89 f0                	mov    %esi,%eax
+  800a1d:	29 d8                	sub    %ebx,%eax
+  800a1f:	50                   	push   %eax
+  800a20:	89 d8                	mov    %ebx,%eax
+  800a22:	03 45 0c             	add    0xc(%ebp),%eax
+  800a25:	50                   	push   %eax
+  800a26:	57                   	push   %edi
+  800a27:	e8 49 ff ff ff       	call   800975 <read>
+    if (m < 0)
+  800a2c:	83 c4 10             	add    $0x10,%esp
+  800a2f:	85 c0                	test   %eax,%eax
+  800a31:	78 04                	js     800a37 <readn+0x3b>
+      return m;
+    if (m == 0)
+  800a33:	75 dd                	jne    800a12 <readn+0x16>
+  800a35:	eb 02                	jmp    800a39 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  800a37:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  800a39:	89 d8                	mov    %ebx,%eax
+  800a3b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a3e:	5b                   	pop    %ebx
+  800a3f:	5e                   	pop    %esi
+  800a40:	5f                   	pop    %edi
+  800a41:	5d                   	pop    %ebp
+  800a42:	c3                   	ret
+
+00800a43 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  800a43:	55                   	push   %ebp
+  800a44:	89 e5                	mov    %esp,%ebp
+  800a46:	56                   	push   %esi
+  800a47:	53                   	push   %ebx
+  800a48:	83 ec 18             	sub    $0x18,%esp
+  800a4b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  800a4e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800a51:	50                   	push   %eax
+  800a52:	53                   	push   %ebx
+  800a53:	e8 72 fc ff ff       	call   8006ca <fd_lookup>
+  800a58:	83 c4 10             	add    $0x10,%esp
+  800a5b:	85 c0                	test   %eax,%eax
+  800a5d:	78 37                	js     800a96 <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800a5f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800a62:	83 ec 08             	sub    $0x8,%esp
+  800a65:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a68:	50                   	push   %eax
+  800a69:	ff 36                	push   (%esi)
+  800a6b:	e8 aa fc ff ff       	call   80071a <dev_lookup>
+  800a70:	83 c4 10             	add    $0x10,%esp
+  800a73:	85 c0                	test   %eax,%eax
+  800a75:	78 1f                	js     800a96 <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800a77:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800a7b:	74 20                	je     800a9d <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  800a7d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a80:	8b 40 0c             	mov    0xc(%eax),%eax
+  800a83:	85 c0                	test   %eax,%eax
+  800a85:	74 37                	je     800abe <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  800a87:	83 ec 04             	sub    $0x4,%esp
+  800a8a:	ff 75 10             	push   0x10(%ebp)
+  800a8d:	ff 75 0c             	push   0xc(%ebp)
+  800a90:	56                   	push   %esi
+  800a91:	ff d0                	call   *%eax
+  800a93:	83 c4 10             	add    $0x10,%esp
+}
+  800a96:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800a99:	5b                   	pop    %ebx
+  800a9a:	5e                   	pop    %esi
+  800a9b:	5d                   	pop    %ebp
+  800a9c:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800a9d:	a1 44 57 80 00       	mov    0x805744,%eax
+  800aa2:	8b 40 48             	mov    0x48(%eax),%eax
+  800aa5:	83 ec 04             	sub    $0x4,%esp
+  800aa8:	53                   	push   %ebx
+  800aa9:	50                   	push   %eax
+  800aaa:	68 d5 2e 80 00       	push   $0x802ed5
+  800aaf:	e8 88 16 00 00       	call   80213c <cprintf>
+    return -E_INVAL;
+  800ab4:	83 c4 10             	add    $0x10,%esp
+  800ab7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800abc:	eb d8                	jmp    800a96 <write+0x53>
+    return -E_NOT_SUPP;
+  800abe:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800ac3:	eb d1                	jmp    800a96 <write+0x53>
+
+00800ac5 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  800ac5:	55                   	push   %ebp
+  800ac6:	89 e5                	mov    %esp,%ebp
+  800ac8:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800acb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800ace:	50                   	push   %eax
+  800acf:	ff 75 08             	push   0x8(%ebp)
+  800ad2:	e8 f3 fb ff ff       	call   8006ca <fd_lookup>
+  800ad7:	83 c4 10             	add    $0x10,%esp
+  800ada:	85 c0                	test   %eax,%eax
+  800adc:	78 0e                	js     800aec <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  800ade:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ae1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ae4:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  800ae7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800aec:	c9                   	leave
+  800aed:	c3                   	ret
+
+00800aee <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800aee:	55                   	push   %ebp
+  800aef:	89 e5                	mov    %esp,%ebp
+  800af1:	56                   	push   %esi
+  800af2:	53                   	push   %ebx
+  800af3:	83 ec 18             	sub    $0x18,%esp
+  800af6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  800af9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800afc:	50                   	push   %eax
+  800afd:	53                   	push   %ebx
+  800afe:	e8 c7 fb ff ff       	call   8006ca <fd_lookup>
+  800b03:	83 c4 10             	add    $0x10,%esp
+  800b06:	85 c0                	test   %eax,%eax
+  800b08:	78 34                	js     800b3e <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800b0a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800b0d:	83 ec 08             	sub    $0x8,%esp
+  800b10:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b13:	50                   	push   %eax
+  800b14:	ff 36                	push   (%esi)
+  800b16:	e8 ff fb ff ff       	call   80071a <dev_lookup>
+  800b1b:	83 c4 10             	add    $0x10,%esp
+  800b1e:	85 c0                	test   %eax,%eax
+  800b20:	78 1c                	js     800b3e <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800b22:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800b26:	74 1d                	je     800b45 <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  800b28:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b2b:	8b 40 18             	mov    0x18(%eax),%eax
+  800b2e:	85 c0                	test   %eax,%eax
+  800b30:	74 34                	je     800b66 <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  800b32:	83 ec 08             	sub    $0x8,%esp
+  800b35:	ff 75 0c             	push   0xc(%ebp)
+  800b38:	56                   	push   %esi
+  800b39:	ff d0                	call   *%eax
+  800b3b:	83 c4 10             	add    $0x10,%esp
+}
+  800b3e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b41:	5b                   	pop    %ebx
+  800b42:	5e                   	pop    %esi
+  800b43:	5d                   	pop    %ebp
+  800b44:	c3                   	ret
+            thisenv->env_id, fdnum);
+  800b45:	a1 44 57 80 00       	mov    0x805744,%eax
+  800b4a:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800b4d:	83 ec 04             	sub    $0x4,%esp
+  800b50:	53                   	push   %ebx
+  800b51:	50                   	push   %eax
+  800b52:	68 98 2e 80 00       	push   $0x802e98
+  800b57:	e8 e0 15 00 00       	call   80213c <cprintf>
+    return -E_INVAL;
+  800b5c:	83 c4 10             	add    $0x10,%esp
+  800b5f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b64:	eb d8                	jmp    800b3e <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  800b66:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800b6b:	eb d1                	jmp    800b3e <ftruncate+0x50>
+
+00800b6d <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800b6d:	55                   	push   %ebp
+  800b6e:	89 e5                	mov    %esp,%ebp
+  800b70:	56                   	push   %esi
+  800b71:	53                   	push   %ebx
+  800b72:	83 ec 18             	sub    $0x18,%esp
+  800b75:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  800b78:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800b7b:	50                   	push   %eax
+  800b7c:	ff 75 08             	push   0x8(%ebp)
+  800b7f:	e8 46 fb ff ff       	call   8006ca <fd_lookup>
+  800b84:	83 c4 10             	add    $0x10,%esp
+  800b87:	85 c0                	test   %eax,%eax
+  800b89:	78 49                	js     800bd4 <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800b8b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800b8e:	83 ec 08             	sub    $0x8,%esp
+  800b91:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b94:	50                   	push   %eax
+  800b95:	ff 36                	push   (%esi)
+  800b97:	e8 7e fb ff ff       	call   80071a <dev_lookup>
+  800b9c:	83 c4 10             	add    $0x10,%esp
+  800b9f:	85 c0                	test   %eax,%eax
+  800ba1:	78 31                	js     800bd4 <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  800ba3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ba6:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800baa:	74 2f                	je     800bdb <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  800bac:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  800baf:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800bb6:	00 00 00 
+  stat->st_isdir = 0;
+  800bb9:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800bc0:	00 00 00 
+  stat->st_dev = dev;
+  800bc3:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  800bc9:	83 ec 08             	sub    $0x8,%esp
+  800bcc:	53                   	push   %ebx
+  800bcd:	56                   	push   %esi
+  800bce:	ff 50 14             	call   *0x14(%eax)
+  800bd1:	83 c4 10             	add    $0x10,%esp
+}
+  800bd4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800bd7:	5b                   	pop    %ebx
+  800bd8:	5e                   	pop    %esi
+  800bd9:	5d                   	pop    %ebp
+  800bda:	c3                   	ret
+    return -E_NOT_SUPP;
+  800bdb:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800be0:	eb f2                	jmp    800bd4 <fstat+0x67>
+
+00800be2 <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  800be2:	55                   	push   %ebp
+  800be3:	89 e5                	mov    %esp,%ebp
+  800be5:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  800be8:	ff 75 0c             	push   0xc(%ebp)
+  800beb:	ff 75 08             	push   0x8(%ebp)
+  800bee:	e8 58 07 00 00       	call   80134b <file_stat>
+}
+  800bf3:	c9                   	leave
+  800bf4:	c3                   	ret
+
+00800bf5 <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  800bf5:	55                   	push   %ebp
+  800bf6:	89 e5                	mov    %esp,%ebp
+  800bf8:	57                   	push   %edi
+  800bf9:	56                   	push   %esi
+  800bfa:	53                   	push   %ebx
+  800bfb:	83 ec 1c             	sub    $0x1c,%esp
+  800bfe:	89 c7                	mov    %eax,%edi
+  800c00:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  800c03:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  800c06:	e9 a2 00 00 00       	jmp    800cad <fsipc_send+0xb8>
+  nfsenvs = 0;
+  800c0b:	c7 05 00 50 80 00 00 	movl   $0x0,0x805000
+  800c12:	00 00 00 
+  800c15:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c1a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  800c1f:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  800c24:	be 01 00 00 00       	mov    $0x1,%esi
+  800c29:	eb 0f                	jmp    800c3a <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  800c2b:	83 c0 01             	add    $0x1,%eax
+  800c2e:	3d 00 04 00 00       	cmp    $0x400,%eax
+  800c33:	74 49                	je     800c7e <fsipc_send+0x89>
+  800c35:	83 f9 07             	cmp    $0x7,%ecx
+  800c38:	7f 50                	jg     800c8a <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  800c3a:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  800c3d:	c1 e2 04             	shl    $0x4,%edx
+  800c40:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800c46:	8b 52 50             	mov    0x50(%edx),%edx
+  800c49:	83 fa 01             	cmp    $0x1,%edx
+  800c4c:	75 dd                	jne    800c2b <fsipc_send+0x36>
+  800c4e:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  800c51:	c1 e2 04             	shl    $0x4,%edx
+  800c54:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800c5a:	8b 52 54             	mov    0x54(%edx),%edx
+  800c5d:	85 d2                	test   %edx,%edx
+  800c5f:	74 ca                	je     800c2b <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  800c61:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  800c64:	c1 e2 04             	shl    $0x4,%edx
+  800c67:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800c6d:	8b 52 48             	mov    0x48(%edx),%edx
+  800c70:	89 14 8d 20 50 80 00 	mov    %edx,0x805020(,%ecx,4)
+  800c77:	8d 49 01             	lea    0x1(%ecx),%ecx
+  800c7a:	89 f3                	mov    %esi,%ebx
+  800c7c:	eb ad                	jmp    800c2b <fsipc_send+0x36>
+  800c7e:	84 db                	test   %bl,%bl
+  800c80:	74 38                	je     800cba <fsipc_send+0xc5>
+  800c82:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  800c88:	eb 30                	jmp    800cba <fsipc_send+0xc5>
+  800c8a:	84 db                	test   %bl,%bl
+  800c8c:	74 2c                	je     800cba <fsipc_send+0xc5>
+  800c8e:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  800c94:	eb 24                	jmp    800cba <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  800c96:	50                   	push   %eax
+  800c97:	68 04 2f 80 00       	push   $0x802f04
+  800c9c:	6a 34                	push   $0x34
+  800c9e:	68 0e 2f 80 00       	push   $0x802f0e
+  800ca3:	e8 b9 13 00 00       	call   802061 <_panic>
+    }
+    sys_yield();
+  800ca8:	e8 92 f4 ff ff       	call   80013f <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  800cad:	83 3d 00 50 80 00 03 	cmpl   $0x3,0x805000
+  800cb4:	0f 8e 51 ff ff ff    	jle    800c0b <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  800cba:	a1 44 57 80 00       	mov    0x805744,%eax
+  800cbf:	8b 70 48             	mov    0x48(%eax),%esi
+  800cc2:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  800cc8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ccd:	8b 0d 00 50 80 00    	mov    0x805000,%ecx
+  800cd3:	39 d9                	cmp    %ebx,%ecx
+  800cd5:	7e d1                	jle    800ca8 <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  800cd7:	83 ec 0c             	sub    $0xc,%esp
+  800cda:	ff 75 e0             	push   -0x20(%ebp)
+  800cdd:	6a 07                	push   $0x7
+  800cdf:	ff 75 e4             	push   -0x1c(%ebp)
+  800ce2:	57                   	push   %edi
+  800ce3:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  800ce6:	99                   	cltd
+  800ce7:	f7 f9                	idiv   %ecx
+  800ce9:	ff 34 95 20 50 80 00 	push   0x805020(,%edx,4)
+  800cf0:	e8 63 f7 ff ff       	call   800458 <sys_ipc_try_send>
+      if (r == 0)
+  800cf5:	83 c4 20             	add    $0x20,%esp
+  800cf8:	85 c0                	test   %eax,%eax
+  800cfa:	74 0a                	je     800d06 <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  800cfc:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  800cff:	75 95                	jne    800c96 <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  800d01:	83 c3 01             	add    $0x1,%ebx
+  800d04:	eb c7                	jmp    800ccd <fsipc_send+0xd8>
+  }
+}
+  800d06:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d09:	5b                   	pop    %ebx
+  800d0a:	5e                   	pop    %esi
+  800d0b:	5f                   	pop    %edi
+  800d0c:	5d                   	pop    %ebp
+  800d0d:	c3                   	ret
+
+00800d0e <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  800d0e:	55                   	push   %ebp
+  800d0f:	89 e5                	mov    %esp,%ebp
+  800d11:	53                   	push   %ebx
+  800d12:	83 ec 14             	sub    $0x14,%esp
+  800d15:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  800d17:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  800d1e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800d23:	ba 00 60 80 00       	mov    $0x806000,%edx
+  800d28:	e8 c8 fe ff ff       	call   800bf5 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  800d2d:	6a 00                	push   $0x0
+  800d2f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800d32:	50                   	push   %eax
+  800d33:	53                   	push   %ebx
+  800d34:	6a 00                	push   $0x0
+  800d36:	e8 1f 1d 00 00       	call   802a5a <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  800d3b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d3e:	c9                   	leave
+  800d3f:	c3                   	ret
+
+00800d40 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  800d40:	55                   	push   %ebp
+  800d41:	89 e5                	mov    %esp,%ebp
+  800d43:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800d46:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d49:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d4c:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.set_size.req_size = newsize;
+  800d51:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d54:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  800d59:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d5e:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d63:	e8 a6 ff ff ff       	call   800d0e <fsipc>
+}
+  800d68:	c9                   	leave
+  800d69:	c3                   	ret
+
+00800d6a <devfile_flush>:
+{
+  800d6a:	55                   	push   %ebp
+  800d6b:	89 e5                	mov    %esp,%ebp
+  800d6d:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800d70:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d73:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d76:	a3 00 60 80 00       	mov    %eax,0x806000
+  return fsipc(FSREQ_FLUSH, NULL);
+  800d7b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d80:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d85:	e8 84 ff ff ff       	call   800d0e <fsipc>
+}
+  800d8a:	c9                   	leave
+  800d8b:	c3                   	ret
+
+00800d8c <devfile_stat>:
+{
+  800d8c:	55                   	push   %ebp
+  800d8d:	89 e5                	mov    %esp,%ebp
+  800d8f:	53                   	push   %ebx
+  800d90:	83 ec 04             	sub    $0x4,%esp
+  800d93:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800d96:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d99:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d9c:	a3 00 60 80 00       	mov    %eax,0x806000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  800da1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800da6:	b8 05 00 00 00       	mov    $0x5,%eax
+  800dab:	e8 5e ff ff ff       	call   800d0e <fsipc>
+  800db0:	85 c0                	test   %eax,%eax
+  800db2:	78 2c                	js     800de0 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800db4:	83 ec 08             	sub    $0x8,%esp
+  800db7:	68 00 60 80 00       	push   $0x806000
+  800dbc:	53                   	push   %ebx
+  800dbd:	e8 68 19 00 00       	call   80272a <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  800dc2:	a1 80 60 80 00       	mov    0x806080,%eax
+  800dc7:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800dcd:	a1 84 60 80 00       	mov    0x806084,%eax
+  800dd2:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  800dd8:	83 c4 10             	add    $0x10,%esp
+  800ddb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800de0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800de3:	c9                   	leave
+  800de4:	c3                   	ret
+
+00800de5 <fsv_alloc>:
+{
+  800de5:	55                   	push   %ebp
+  800de6:	89 e5                	mov    %esp,%ebp
+  800de8:	56                   	push   %esi
+  800de9:	53                   	push   %ebx
+  800dea:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  800dec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800df1:	eb 22                	jmp    800e15 <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  800df3:	83 ec 04             	sub    $0x4,%esp
+  800df6:	6a 00                	push   $0x0
+  800df8:	6a 00                	push   $0x0
+  800dfa:	6a 07                	push   $0x7
+  800dfc:	50                   	push   %eax
+  800dfd:	6a 00                	push   $0x0
+  800dff:	6a 04                	push   $0x4
+  800e01:	68 40 50 80 00       	push   $0x805040
+  800e06:	e8 e9 f7 ff ff       	call   8005f4 <sysbatch_add>
+  800e0b:	83 c4 20             	add    $0x20,%esp
+  800e0e:	85 c0                	test   %eax,%eax
+  800e10:	78 48                	js     800e5a <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  800e12:	83 c3 01             	add    $0x1,%ebx
+  800e15:	39 f3                	cmp    %esi,%ebx
+  800e17:	74 31                	je     800e4a <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  800e19:	89 d8                	mov    %ebx,%eax
+  800e1b:	c1 e0 0c             	shl    $0xc,%eax
+  800e1e:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  800e23:	89 c2                	mov    %eax,%edx
+  800e25:	c1 ea 16             	shr    $0x16,%edx
+  800e28:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800e2f:	f6 c2 01             	test   $0x1,%dl
+  800e32:	74 bf                	je     800df3 <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  800e34:	89 c2                	mov    %eax,%edx
+  800e36:	c1 ea 0c             	shr    $0xc,%edx
+  800e39:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800e40:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  800e43:	83 fa 03             	cmp    $0x3,%edx
+  800e46:	75 ab                	jne    800df3 <fsv_alloc+0xe>
+  800e48:	eb c8                	jmp    800e12 <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  800e4a:	83 ec 0c             	sub    $0xc,%esp
+  800e4d:	68 40 50 80 00       	push   $0x805040
+  800e52:	e8 4d f7 ff ff       	call   8005a4 <sysbatch_flush>
+  800e57:	83 c4 10             	add    $0x10,%esp
+}
+  800e5a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e5d:	5b                   	pop    %ebx
+  800e5e:	5e                   	pop    %esi
+  800e5f:	5d                   	pop    %ebp
+  800e60:	c3                   	ret
+
+00800e61 <devfile_read>:
+{
+  800e61:	55                   	push   %ebp
+  800e62:	89 e5                	mov    %esp,%ebp
+  800e64:	57                   	push   %edi
+  800e65:	56                   	push   %esi
+  800e66:	53                   	push   %ebx
+  800e67:	83 ec 3c             	sub    $0x3c,%esp
+  800e6a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  800e6d:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  800e73:	77 57                	ja     800ecc <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800e75:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e78:	8b 40 0c             	mov    0xc(%eax),%eax
+  800e7b:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read.req_n = n;
+  800e80:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  800e86:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e8b:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e90:	e8 79 fe ff ff       	call   800d0e <fsipc>
+  800e95:	89 c6                	mov    %eax,%esi
+  800e97:	85 c0                	test   %eax,%eax
+  800e99:	78 27                	js     800ec2 <devfile_read+0x61>
+  assert(r <= n);
+  800e9b:	39 c3                	cmp    %eax,%ebx
+  800e9d:	0f 82 0e 02 00 00    	jb     8010b1 <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  800ea3:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800ea8:	0f 8f 1c 02 00 00    	jg     8010ca <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  800eae:	83 ec 04             	sub    $0x4,%esp
+  800eb1:	50                   	push   %eax
+  800eb2:	68 00 60 80 00       	push   $0x806000
+  800eb7:	ff 75 0c             	push   0xc(%ebp)
+  800eba:	e8 f1 19 00 00       	call   8028b0 <memmove>
+  return r;
+  800ebf:	83 c4 10             	add    $0x10,%esp
+}
+  800ec2:	89 f0                	mov    %esi,%eax
+  800ec4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ec7:	5b                   	pop    %ebx
+  800ec8:	5e                   	pop    %esi
+  800ec9:	5f                   	pop    %edi
+  800eca:	5d                   	pop    %ebp
+  800ecb:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  800ecc:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ed1:	e8 0f ff ff ff       	call   800de5 <fsv_alloc>
+  800ed6:	89 c6                	mov    %eax,%esi
+  800ed8:	85 c0                	test   %eax,%eax
+  800eda:	78 e6                	js     800ec2 <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  800edc:	8b 45 08             	mov    0x8(%ebp),%eax
+  800edf:	8b 40 0c             	mov    0xc(%eax),%eax
+  800ee2:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  800ee7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800eea:	8b 40 04             	mov    0x4(%eax),%eax
+  800eed:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  800ef2:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  800ef8:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  800eff:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800f04:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  800f09:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f0e:	e8 e2 fc ff ff       	call   800bf5 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  800f13:	6a 00                	push   $0x0
+  800f15:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800f18:	50                   	push   %eax
+  800f19:	68 00 10 c0 9f       	push   $0x9fc01000
+  800f1e:	6a 00                	push   $0x0
+  800f20:	e8 35 1b 00 00       	call   802a5a <ipc_recv_pages>
+  800f25:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  800f27:	83 c4 10             	add    $0x10,%esp
+  800f2a:	85 c0                	test   %eax,%eax
+  800f2c:	7e 94                	jle    800ec2 <devfile_read+0x61>
+  assert(r <= n);
+  800f2e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800f31:	39 c3                	cmp    %eax,%ebx
+  800f33:	72 2e                	jb     800f63 <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  800f35:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f38:	8b 40 04             	mov    0x4(%eax),%eax
+  800f3b:	25 ff 0f 00 00       	and    $0xfff,%eax
+  800f40:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  800f43:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800f46:	c1 e2 0c             	shl    $0xc,%edx
+  800f49:	39 ca                	cmp    %ecx,%edx
+  800f4b:	72 2f                	jb     800f7c <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  800f4d:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  800f52:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  800f55:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  800f59:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  800f5e:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  800f61:	eb 52                	jmp    800fb5 <devfile_read+0x154>
+  assert(r <= n);
+  800f63:	68 19 2f 80 00       	push   $0x802f19
+  800f68:	68 20 2f 80 00       	push   $0x802f20
+  800f6d:	68 49 01 00 00       	push   $0x149
+  800f72:	68 0e 2f 80 00       	push   $0x802f0e
+  800f77:	e8 e5 10 00 00       	call   802061 <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  800f7c:	68 44 2f 80 00       	push   $0x802f44
+  800f81:	68 20 2f 80 00       	push   $0x802f20
+  800f86:	68 4a 01 00 00       	push   $0x14a
+  800f8b:	68 0e 2f 80 00       	push   $0x802f0e
+  800f90:	e8 cc 10 00 00       	call   802061 <_panic>
+      memmove(dst + done, src + done, m);
+  800f95:	83 ec 04             	sub    $0x4,%esp
+  800f98:	53                   	push   %ebx
+  800f99:	56                   	push   %esi
+  800f9a:	89 f8                	mov    %edi,%eax
+  800f9c:	03 45 0c             	add    0xc(%ebp),%eax
+  800f9f:	50                   	push   %eax
+  800fa0:	e8 0b 19 00 00       	call   8028b0 <memmove>
+  800fa5:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  800fa8:	01 df                	add    %ebx,%edi
+  800faa:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800fad:	39 c7                	cmp    %eax,%edi
+  800faf:	0f 83 c0 00 00 00    	jae    801075 <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  800fb5:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800fb8:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  800fbb:	89 f0                	mov    %esi,%eax
+  800fbd:	25 ff 0f 00 00       	and    $0xfff,%eax
+  800fc2:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  800fc7:	29 c3                	sub    %eax,%ebx
+  800fc9:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800fcc:	29 f8                	sub    %edi,%eax
+  800fce:	39 c3                	cmp    %eax,%ebx
+  800fd0:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  800fd3:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  800fd9:	75 ba                	jne    800f95 <devfile_read+0x134>
+  800fdb:	89 f9                	mov    %edi,%ecx
+  800fdd:	03 4d 0c             	add    0xc(%ebp),%ecx
+  800fe0:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  800fe3:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  800fe9:	75 aa                	jne    800f95 <devfile_read+0x134>
+  800feb:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  800ff1:	77 a2                	ja     800f95 <devfile_read+0x134>
+  800ff3:	89 c8                	mov    %ecx,%eax
+  800ff5:	c1 e8 16             	shr    $0x16,%eax
+  800ff8:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  800fff:	a8 01                	test   $0x1,%al
+  801001:	74 92                	je     800f95 <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  801003:	89 c8                	mov    %ecx,%eax
+  801005:	c1 e8 0c             	shr    $0xc,%eax
+  801008:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  80100f:	a8 01                	test   $0x1,%al
+  801011:	74 82                	je     800f95 <devfile_read+0x134>
+  801013:	a9 02 08 00 00       	test   $0x802,%eax
+  801018:	0f 84 77 ff ff ff    	je     800f95 <devfile_read+0x134>
+  80101e:	f6 c4 04             	test   $0x4,%ah
+  801021:	0f 85 6e ff ff ff    	jne    800f95 <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  801027:	a1 44 57 80 00       	mov    0x805744,%eax
+  80102c:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  801030:	84 c0                	test   %al,%al
+  801032:	75 17                	jne    80104b <devfile_read+0x1ea>
+  801034:	83 ec 08             	sub    $0x8,%esp
+  801037:	6a 01                	push   $0x1
+  801039:	6a 00                	push   $0x0
+  80103b:	e8 1e f1 ff ff       	call   80015e <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  801040:	83 c4 10             	add    $0x10,%esp
+  801043:	85 c0                	test   %eax,%eax
+  801045:	0f 85 4a ff ff ff    	jne    800f95 <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  80104b:	83 ec 04             	sub    $0x4,%esp
+  80104e:	68 05 08 00 00       	push   $0x805
+  801053:	ff 75 cc             	push   -0x34(%ebp)
+  801056:	6a 00                	push   $0x0
+  801058:	56                   	push   %esi
+  801059:	6a 00                	push   $0x0
+  80105b:	6a 05                	push   $0x5
+  80105d:	68 40 50 80 00       	push   $0x805040
+  801062:	e8 8d f5 ff ff       	call   8005f4 <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  801067:	c1 e8 1f             	shr    $0x1f,%eax
+  80106a:	08 45 cb             	or     %al,-0x35(%ebp)
+  80106d:	83 c4 20             	add    $0x20,%esp
+  801070:	e9 33 ff ff ff       	jmp    800fa8 <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  801075:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  801078:	83 ec 0c             	sub    $0xc,%esp
+  80107b:	68 40 50 80 00       	push   $0x805040
+  801080:	e8 1f f5 ff ff       	call   8005a4 <sysbatch_flush>
+  801085:	83 c4 10             	add    $0x10,%esp
+  801088:	85 c0                	test   %eax,%eax
+  80108a:	78 06                	js     801092 <devfile_read+0x231>
+  80108c:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  801090:	74 14                	je     8010a6 <devfile_read+0x245>
+    memmove(dst, src, r);
+  801092:	83 ec 04             	sub    $0x4,%esp
+  801095:	ff 75 d4             	push   -0x2c(%ebp)
+  801098:	ff 75 d0             	push   -0x30(%ebp)
+  80109b:	ff 75 0c             	push   0xc(%ebp)
+  80109e:	e8 0d 18 00 00       	call   8028b0 <memmove>
+  8010a3:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  8010a6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010a9:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  8010ac:	e9 11 fe ff ff       	jmp    800ec2 <devfile_read+0x61>
+  assert(r <= n);
+  8010b1:	68 19 2f 80 00       	push   $0x802f19
+  8010b6:	68 20 2f 80 00       	push   $0x802f20
+  8010bb:	68 1c 01 00 00       	push   $0x11c
+  8010c0:	68 0e 2f 80 00       	push   $0x802f0e
+  8010c5:	e8 97 0f 00 00       	call   802061 <_panic>
+  assert(r <= PGSIZE);
+  8010ca:	68 35 2f 80 00       	push   $0x802f35
+  8010cf:	68 20 2f 80 00       	push   $0x802f20
+  8010d4:	68 1d 01 00 00       	push   $0x11d
+  8010d9:	68 0e 2f 80 00       	push   $0x802f0e
+  8010de:	e8 7e 0f 00 00       	call   802061 <_panic>
+
+008010e3 <devfile_write>:
+{
+  8010e3:	55                   	push   %ebp
+  8010e4:	89 e5                	mov    %esp,%ebp
+  8010e6:	57                   	push   %edi
+  8010e7:	56                   	push   %esi
+  8010e8:	53                   	push   %ebx
+  8010e9:	83 ec 1c             	sub    $0x1c,%esp
+  8010ec:	8b 75 08             	mov    0x8(%ebp),%esi
+  8010ef:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  8010f2:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  8010f7:	77 39                	ja     801132 <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8010f9:	8b 56 0c             	mov    0xc(%esi),%edx
+  8010fc:	89 15 00 60 80 00    	mov    %edx,0x806000
+  fsipcbuf.write.req_n = n;
+  801102:	a3 04 60 80 00       	mov    %eax,0x806004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  801107:	83 ec 04             	sub    $0x4,%esp
+  80110a:	50                   	push   %eax
+  80110b:	ff 75 0c             	push   0xc(%ebp)
+  80110e:	68 08 60 80 00       	push   $0x806008
+  801113:	e8 98 17 00 00       	call   8028b0 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801118:	ba 00 00 00 00       	mov    $0x0,%edx
+  80111d:	b8 04 00 00 00       	mov    $0x4,%eax
+  801122:	e8 e7 fb ff ff       	call   800d0e <fsipc>
+  801127:	83 c4 10             	add    $0x10,%esp
+}
+  80112a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80112d:	5b                   	pop    %ebx
+  80112e:	5e                   	pop    %esi
+  80112f:	5f                   	pop    %edi
+  801130:	5d                   	pop    %ebp
+  801131:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  801132:	ba 00 00 10 00       	mov    $0x100000,%edx
+  801137:	39 d0                	cmp    %edx,%eax
+  801139:	89 d3                	mov    %edx,%ebx
+  80113b:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  80113e:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  801144:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  801147:	83 c7 01             	add    $0x1,%edi
+  80114a:	89 f8                	mov    %edi,%eax
+  80114c:	e8 94 fc ff ff       	call   800de5 <fsv_alloc>
+  801151:	85 c0                	test   %eax,%eax
+  801153:	78 d5                	js     80112a <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  801155:	83 ec 04             	sub    $0x4,%esp
+  801158:	53                   	push   %ebx
+  801159:	ff 75 0c             	push   0xc(%ebp)
+  80115c:	68 00 10 c0 9f       	push   $0x9fc01000
+  801161:	e8 4a 17 00 00       	call   8028b0 <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  801166:	8b 46 0c             	mov    0xc(%esi),%eax
+  801169:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  80116e:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  801174:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  80117b:	89 f9                	mov    %edi,%ecx
+  80117d:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801182:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801187:	e8 69 fa ff ff       	call   800bf5 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  80118c:	6a 00                	push   $0x0
+  80118e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801191:	50                   	push   %eax
+  801192:	6a 00                	push   $0x0
+  801194:	6a 00                	push   $0x0
+  801196:	e8 bf 18 00 00       	call   802a5a <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  80119b:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  80119e:	eb 8a                	jmp    80112a <devfile_write+0x47>
+
+008011a0 <open>:
+{
+  8011a0:	55                   	push   %ebp
+  8011a1:	89 e5                	mov    %esp,%ebp
+  8011a3:	56                   	push   %esi
+  8011a4:	53                   	push   %ebx
+  8011a5:	83 ec 1c             	sub    $0x1c,%esp
+  8011a8:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  8011ab:	56                   	push   %esi
+  8011ac:	e8 3e 15 00 00       	call   8026ef <strlen>
+  8011b1:	83 c4 10             	add    $0x10,%esp
+  8011b4:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8011b9:	7f 6c                	jg     801227 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  8011bb:	83 ec 0c             	sub    $0xc,%esp
+  8011be:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8011c1:	50                   	push   %eax
+  8011c2:	e8 ad f4 ff ff       	call   800674 <fd_alloc>
+  8011c7:	89 c3                	mov    %eax,%ebx
+  8011c9:	83 c4 10             	add    $0x10,%esp
+  8011cc:	85 c0                	test   %eax,%eax
+  8011ce:	78 3c                	js     80120c <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  8011d0:	83 ec 08             	sub    $0x8,%esp
+  8011d3:	56                   	push   %esi
+  8011d4:	68 00 60 80 00       	push   $0x806000
+  8011d9:	e8 4c 15 00 00       	call   80272a <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  8011de:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8011e1:	a3 00 64 80 00       	mov    %eax,0x806400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8011e6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8011e9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8011ee:	e8 1b fb ff ff       	call   800d0e <fsipc>
+  8011f3:	89 c3                	mov    %eax,%ebx
+  8011f5:	83 c4 10             	add    $0x10,%esp
+  8011f8:	85 c0                	test   %eax,%eax
+  8011fa:	78 19                	js     801215 <open+0x75>
+  return fd2num(fd);
+  8011fc:	83 ec 0c             	sub    $0xc,%esp
+  8011ff:	ff 75 f4             	push   -0xc(%ebp)
+  801202:	e8 49 f4 ff ff       	call   800650 <fd2num>
+  801207:	89 c3                	mov    %eax,%ebx
+  801209:	83 c4 10             	add    $0x10,%esp
+}
+  80120c:	89 d8                	mov    %ebx,%eax
+  80120e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801211:	5b                   	pop    %ebx
+  801212:	5e                   	pop    %esi
+  801213:	5d                   	pop    %ebp
+  801214:	c3                   	ret
+    fd_close(fd, 0);
+  801215:	83 ec 08             	sub    $0x8,%esp
+  801218:	6a 00                	push   $0x0
+  80121a:	ff 75 f4             	push   -0xc(%ebp)
+  80121d:	e8 44 f5 ff ff       	call   800766 <fd_close>
+    return r;
+  801222:	83 c4 10             	add    $0x10,%esp
+  801225:	eb e5                	jmp    80120c <open+0x6c>
+    return -E_BAD_PATH;
+  801227:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80122c:	eb de                	jmp    80120c <open+0x6c>
+
+0080122e <open_read>:
+{
+  80122e:	55                   	push   %ebp
+  80122f:	89 e5                	mov    %esp,%ebp
+  801231:	57                   	push   %edi
+  801232:	56                   	push   %esi
+  801233:	53                   	push   %ebx
+  801234:	83 ec 28             	sub    $0x28,%esp
+  801237:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  80123a:	57                   	push   %edi
+  80123b:	e8 af 14 00 00       	call   8026ef <strlen>
+  801240:	83 c4 10             	add    $0x10,%esp
+  801243:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801248:	0f 87 f6 00 00 00    	ja     801344 <open_read+0x116>
+  80124e:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  801250:	83 ec 0c             	sub    $0xc,%esp
+  801253:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801256:	50                   	push   %eax
+  801257:	e8 18 f4 ff ff       	call   800674 <fd_alloc>
+  80125c:	89 c3                	mov    %eax,%ebx
+  80125e:	83 c4 10             	add    $0x10,%esp
+  801261:	85 c0                	test   %eax,%eax
+  801263:	0f 88 b2 00 00 00    	js     80131b <open_read+0xed>
+  strcpy(req->req_buf, path);
+  801269:	83 ec 08             	sub    $0x8,%esp
+  80126c:	57                   	push   %edi
+  80126d:	68 e4 60 80 00       	push   $0x8060e4
+  801272:	e8 b3 14 00 00       	call   80272a <strcpy>
+  req->req_nops = 2;
+  801277:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  80127e:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  801281:	c7 05 04 60 80 00 01 	movl   $0x1,0x806004
+  801288:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  80128b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80128e:	a3 10 60 80 00       	mov    %eax,0x806010
+  req->req_ops[0].op_buf = 0;
+  801293:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  80129a:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  80129d:	c7 05 20 60 80 00 04 	movl   $0x4,0x806020
+  8012a4:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  8012a7:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  8012ae:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  8012b1:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  8012b6:	29 f0                	sub    %esi,%eax
+  8012b8:	3b 45 14             	cmp    0x14(%ebp),%eax
+  8012bb:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  8012bf:	a3 2c 60 80 00       	mov    %eax,0x80602c
+  req->req_ops[1].op_offset = 0;
+  8012c4:	c7 05 30 60 80 00 00 	movl   $0x0,0x806030
+  8012cb:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  8012ce:	83 c6 01             	add    $0x1,%esi
+  8012d1:	89 35 34 60 80 00    	mov    %esi,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  8012d7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8012da:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8012df:	e8 2a fa ff ff       	call   800d0e <fsipc>
+  8012e4:	89 c3                	mov    %eax,%ebx
+  8012e6:	83 c4 10             	add    $0x10,%esp
+  8012e9:	83 f8 01             	cmp    $0x1,%eax
+  8012ec:	7e 37                	jle    801325 <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  8012ee:	a1 38 60 80 00       	mov    0x806038,%eax
+  8012f3:	8b 55 18             	mov    0x18(%ebp),%edx
+  8012f6:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  8012f8:	83 ec 04             	sub    $0x4,%esp
+  8012fb:	50                   	push   %eax
+  8012fc:	81 c6 e4 60 80 00    	add    $0x8060e4,%esi
+  801302:	56                   	push   %esi
+  801303:	ff 75 10             	push   0x10(%ebp)
+  801306:	e8 a5 15 00 00       	call   8028b0 <memmove>
+  return fd2num(fd);
+  80130b:	83 c4 04             	add    $0x4,%esp
+  80130e:	ff 75 e4             	push   -0x1c(%ebp)
+  801311:	e8 3a f3 ff ff       	call   800650 <fd2num>
+  801316:	89 c3                	mov    %eax,%ebx
+  801318:	83 c4 10             	add    $0x10,%esp
+}
+  80131b:	89 d8                	mov    %ebx,%eax
+  80131d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801320:	5b                   	pop    %ebx
+  801321:	5e                   	pop    %esi
+  801322:	5f                   	pop    %edi
+  801323:	5d                   	pop    %ebp
+  801324:	c3                   	ret
+    fd_close(fd, 0);
+  801325:	83 ec 08             	sub    $0x8,%esp
+  801328:	6a 00                	push   $0x0
+  80132a:	ff 75 e4             	push   -0x1c(%ebp)
+  80132d:	e8 34 f4 ff ff       	call   800766 <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  801332:	83 c4 10             	add    $0x10,%esp
+  801335:	85 db                	test   %ebx,%ebx
+  801337:	78 e2                	js     80131b <open_read+0xed>
+  801339:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  80133c:	8b 9b 1c 60 80 00    	mov    0x80601c(%ebx),%ebx
+  801342:	eb d7                	jmp    80131b <open_read+0xed>
+    return -E_BAD_PATH;
+  801344:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801349:	eb d0                	jmp    80131b <open_read+0xed>
+
+0080134b <file_stat>:
+{
+  80134b:	55                   	push   %ebp
+  80134c:	89 e5                	mov    %esp,%ebp
+  80134e:	57                   	push   %edi
+  80134f:	56                   	push   %esi
+  801350:	53                   	push   %ebx
+  801351:	83 ec 18             	sub    $0x18,%esp
+  801354:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801357:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  80135a:	57                   	push   %edi
+  80135b:	e8 8f 13 00 00       	call   8026ef <strlen>
+  801360:	83 c4 10             	add    $0x10,%esp
+  801363:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801368:	0f 8f c7 00 00 00    	jg     801435 <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  80136e:	83 ec 0c             	sub    $0xc,%esp
+  801371:	57                   	push   %edi
+  801372:	e8 78 13 00 00       	call   8026ef <strlen>
+  801377:	8d 58 04             	lea    0x4(%eax),%ebx
+  80137a:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  80137d:	83 c4 08             	add    $0x8,%esp
+  801380:	57                   	push   %edi
+  801381:	68 e4 60 80 00       	push   $0x8060e4
+  801386:	e8 9f 13 00 00       	call   80272a <strcpy>
+  req->req_nops = 2;
+  80138b:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  801392:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  801395:	c7 05 04 60 80 00 02 	movl   $0x2,0x806004
+  80139c:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  80139f:	c7 05 10 60 80 00 00 	movl   $0x0,0x806010
+  8013a6:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  8013a9:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  8013b0:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  8013b3:	c7 05 20 60 80 00 03 	movl   $0x3,0x806020
+  8013ba:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  8013bd:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  8013c4:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  8013c7:	89 1d 34 60 80 00    	mov    %ebx,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  8013cd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013d2:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8013d7:	e8 32 f9 ff ff       	call   800d0e <fsipc>
+  8013dc:	83 c4 10             	add    $0x10,%esp
+  8013df:	83 f8 01             	cmp    $0x1,%eax
+  8013e2:	7e 42                	jle    801426 <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  8013e4:	81 c3 e4 60 80 00    	add    $0x8060e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  8013ea:	83 ec 08             	sub    $0x8,%esp
+  8013ed:	53                   	push   %ebx
+  8013ee:	56                   	push   %esi
+  8013ef:	e8 36 13 00 00       	call   80272a <strcpy>
+  st->st_size = ret->ret_size;
+  8013f4:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  8013fa:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  801400:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  801406:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  80140c:	c7 86 88 00 00 00 04 	movl   $0x804004,0x88(%esi)
+  801413:	40 80 00 
+  return 0;
+  801416:	83 c4 10             	add    $0x10,%esp
+  801419:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80141e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801421:	5b                   	pop    %ebx
+  801422:	5e                   	pop    %esi
+  801423:	5f                   	pop    %edi
+  801424:	5d                   	pop    %ebp
+  801425:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  801426:	85 c0                	test   %eax,%eax
+  801428:	78 f4                	js     80141e <file_stat+0xd3>
+  80142a:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80142d:	8b 80 1c 60 80 00    	mov    0x80601c(%eax),%eax
+  801433:	eb e9                	jmp    80141e <file_stat+0xd3>
+    return -E_BAD_PATH;
+  801435:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  80143a:	eb e2                	jmp    80141e <file_stat+0xd3>
+
+0080143c <read_map>:
+{
+  80143c:	55                   	push   %ebp
+  80143d:	89 e5                	mov    %esp,%ebp
+  80143f:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801442:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801445:	50                   	push   %eax
+  801446:	ff 75 08             	push   0x8(%ebp)
+  801449:	e8 7c f2 ff ff       	call   8006ca <fd_lookup>
+  80144e:	83 c4 10             	add    $0x10,%esp
+  801451:	85 c0                	test   %eax,%eax
+  801453:	78 2a                	js     80147f <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  801455:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801458:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  80145e:	39 08                	cmp    %ecx,(%eax)
+  801460:	75 1f                	jne    801481 <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  801462:	8b 40 0c             	mov    0xc(%eax),%eax
+  801465:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read_map.req_offset = offset;
+  80146a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80146d:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  801472:	8b 55 10             	mov    0x10(%ebp),%edx
+  801475:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80147a:	e8 8f f8 ff ff       	call   800d0e <fsipc>
+}
+  80147f:	c9                   	leave
+  801480:	c3                   	ret
+    return -E_INVAL;
+  801481:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801486:	eb f7                	jmp    80147f <read_map+0x43>
+
+00801488 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801488:	55                   	push   %ebp
+  801489:	89 e5                	mov    %esp,%ebp
+  80148b:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  80148e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801493:	b8 08 00 00 00       	mov    $0x8,%eax
+  801498:	e8 71 f8 ff ff       	call   800d0e <fsipc>
+}
+  80149d:	c9                   	leave
+  80149e:	c3                   	ret
+
+0080149f <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  80149f:	55                   	push   %ebp
+  8014a0:	89 e5                	mov    %esp,%ebp
+  8014a2:	57                   	push   %edi
+  8014a3:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  8014a4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014a7:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.stats.req_bio_sched = 0;
+  8014ac:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  8014b3:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  8014b6:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  8014bd:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  8014c0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014c5:	b8 09 00 00 00       	mov    $0x9,%eax
+  8014ca:	e8 3f f8 ff ff       	call   800d0e <fsipc>
+  8014cf:	85 c0                	test   %eax,%eax
+  8014d1:	78 14                	js     8014e7 <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  8014d3:	be 00 60 80 00       	mov    $0x806000,%esi
+  8014d8:	b9 16 00 00 00       	mov    $0x16,%ecx
+  8014dd:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8014e0:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  8014e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8014e7:	5e                   	pop    %esi
+  8014e8:	5f                   	pop    %edi
+  8014e9:	5d                   	pop    %ebp
+  8014ea:	c3                   	ret
+
+008014eb <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  8014eb:	55                   	push   %ebp
+  8014ec:	89 e5                	mov    %esp,%ebp
+  8014ee:	53                   	push   %ebx
+  8014ef:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  8014f2:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8014f5:	50                   	push   %eax
+  8014f6:	6a 00                	push   $0x0
+  8014f8:	e8 a2 ff ff ff       	call   80149f <fs_stats>
+  8014fd:	83 c4 10             	add    $0x10,%esp
+  801500:	85 c0                	test   %eax,%eax
+  801502:	78 28                	js     80152c <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  801504:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  801507:	83 ec 08             	sub    $0x8,%esp
+  80150a:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  80150d:	50                   	push   %eax
+  80150e:	6a 20                	push   $0x20
+  801510:	e8 8a ff ff ff       	call   80149f <fs_stats>
+  801515:	83 c4 10             	add    $0x10,%esp
+  801518:	85 c0                	test   %eax,%eax
+  80151a:	78 10                	js     80152c <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  80151c:	83 ec 08             	sub    $0x8,%esp
+  80151f:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801522:	50                   	push   %eax
+  801523:	53                   	push   %ebx
+  801524:	e8 76 ff ff ff       	call   80149f <fs_stats>
+  801529:	83 c4 10             	add    $0x10,%esp
+}
+  80152c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80152f:	c9                   	leave
+  801530:	c3                   	ret
+
+00801531 <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  801531:	55                   	push   %ebp
+  801532:	89 e5                	mov    %esp,%ebp
+  801534:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  801537:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  80153e:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  801541:	8b 45 08             	mov    0x8(%ebp),%eax
+  801544:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.stats.req_dcache = 0;
+  801549:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  801550:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  801553:	ba 00 00 00 00       	mov    $0x0,%edx
+  801558:	b8 09 00 00 00       	mov    $0x9,%eax
+  80155d:	e8 ac f7 ff ff       	call   800d0e <fsipc>
+}
+  801562:	c9                   	leave
+  801563:	c3                   	ret
+
+00801564 <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  801564:	55                   	push   %ebp
+  801565:	89 e5                	mov    %esp,%ebp
+  801567:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  80156a:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  801571:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  801574:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  80157b:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  80157e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801581:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_STATS, NULL);
+  801586:	ba 00 00 00 00       	mov    $0x0,%edx
+  80158b:	b8 09 00 00 00       	mov    $0x9,%eax
+  801590:	e8 79 f7 ff ff       	call   800d0e <fsipc>
+}
+  801595:	c9                   	leave
+  801596:	c3                   	ret
+
+00801597 <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  801597:	55                   	push   %ebp
+  801598:	89 e5                	mov    %esp,%ebp
+  80159a:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80159d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015a0:	50                   	push   %eax
+  8015a1:	ff 75 08             	push   0x8(%ebp)
+  8015a4:	e8 21 f1 ff ff       	call   8006ca <fd_lookup>
+  8015a9:	83 c4 10             	add    $0x10,%esp
+  8015ac:	85 c0                	test   %eax,%eax
+  8015ae:	78 34                	js     8015e4 <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  8015b0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015b3:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  8015b9:	39 08                	cmp    %ecx,(%eax)
+  8015bb:	75 29                	jne    8015e6 <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  8015bd:	8b 40 0c             	mov    0xc(%eax),%eax
+  8015c0:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.fallocate.req_offset = offset;
+  8015c5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8015c8:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.fallocate.req_len = len;
+  8015cd:	8b 45 10             	mov    0x10(%ebp),%eax
+  8015d0:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  8015d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015da:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8015df:	e8 2a f7 ff ff       	call   800d0e <fsipc>
+}
+  8015e4:	c9                   	leave
+  8015e5:	c3                   	ret
+    return -E_INVAL;
+  8015e6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015eb:	eb f7                	jmp    8015e4 <fallocate+0x4d>
+
+008015ed <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  8015ed:	55                   	push   %ebp
+  8015ee:	89 e5                	mov    %esp,%ebp
+  8015f0:	57                   	push   %edi
+  8015f1:	56                   	push   %esi
+  8015f2:	53                   	push   %ebx
+  8015f3:	83 ec 24             	sub    $0x24,%esp
+  8015f6:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8015f9:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8015fc:	50                   	push   %eax
+  8015fd:	ff 75 08             	push   0x8(%ebp)
+  801600:	e8 c5 f0 ff ff       	call   8006ca <fd_lookup>
+  801605:	83 c4 10             	add    $0x10,%esp
+  801608:	85 c0                	test   %eax,%eax
+  80160a:	78 66                	js     801672 <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  80160c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80160f:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  801615:	39 08                	cmp    %ecx,(%eax)
+  801617:	75 61                	jne    80167a <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  801619:	85 f6                	test   %esi,%esi
+  80161b:	7e 50                	jle    80166d <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  80161d:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  801622:	39 de                	cmp    %ebx,%esi
+  801624:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  801627:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80162a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80162d:	a3 00 60 80 00       	mov    %eax,0x806000
+    fsipcbuf.prefetch.req_n = m;
+  801632:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  801638:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  80163f:	83 ec 04             	sub    $0x4,%esp
+  801642:	57                   	push   %edi
+  801643:	ff 75 0c             	push   0xc(%ebp)
+  801646:	68 08 60 80 00       	push   $0x806008
+  80164b:	e8 60 12 00 00       	call   8028b0 <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  801650:	ba 00 00 00 00       	mov    $0x0,%edx
+  801655:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80165a:	e8 af f6 ff ff       	call   800d0e <fsipc>
+  80165f:	83 c4 10             	add    $0x10,%esp
+  801662:	85 c0                	test   %eax,%eax
+  801664:	78 0c                	js     801672 <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  801666:	01 7d 0c             	add    %edi,0xc(%ebp)
+  801669:	29 de                	sub    %ebx,%esi
+  80166b:	eb ac                	jmp    801619 <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  80166d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801672:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801675:	5b                   	pop    %ebx
+  801676:	5e                   	pop    %esi
+  801677:	5f                   	pop    %edi
+  801678:	5d                   	pop    %ebp
+  801679:	c3                   	ret
+    return -E_INVAL;
+  80167a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80167f:	eb f1                	jmp    801672 <prefetch+0x85>
+
+00801681 <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  801681:	55                   	push   %ebp
+  801682:	89 e5                	mov    %esp,%ebp
+  801684:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  801687:	50                   	push   %eax
+  801688:	e8 d3 ef ff ff       	call   800660 <fd2data>
+  80168d:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  801692:	c9                   	leave
+  801693:	c3                   	ret
+
+00801694 <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801694:	55                   	push   %ebp
+  801695:	89 e5                	mov    %esp,%ebp
+  801697:	56                   	push   %esi
+  801698:	53                   	push   %ebx
+  801699:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  80169c:	83 ec 0c             	sub    $0xc,%esp
+  80169f:	ff 75 08             	push   0x8(%ebp)
+  8016a2:	e8 b9 ef ff ff       	call   800660 <fd2data>
+  8016a7:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  8016a9:	83 c4 08             	add    $0x8,%esp
+  8016ac:	68 70 2f 80 00       	push   $0x802f70
+  8016b1:	53                   	push   %ebx
+  8016b2:	e8 73 10 00 00       	call   80272a <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  8016b7:	8b 46 04             	mov    0x4(%esi),%eax
+  8016ba:	2b 06                	sub    (%esi),%eax
+  8016bc:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  8016c2:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8016c9:	00 00 00 
+  stat->st_dev = &devpipe;
+  8016cc:	c7 83 88 00 00 00 20 	movl   $0x804020,0x88(%ebx)
+  8016d3:	40 80 00 
+  return 0;
+}
+  8016d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016db:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016de:	5b                   	pop    %ebx
+  8016df:	5e                   	pop    %esi
+  8016e0:	5d                   	pop    %ebp
+  8016e1:	c3                   	ret
+
+008016e2 <pipe_wakeup>:
+{
+  8016e2:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  8016e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016e9:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  8016ec:	85 c0                	test   %eax,%eax
+  8016ee:	75 01                	jne    8016f1 <pipe_wakeup+0xf>
+  8016f0:	c3                   	ret
+{
+  8016f1:	55                   	push   %ebp
+  8016f2:	89 e5                	mov    %esp,%ebp
+  8016f4:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  8016f7:	6a 00                	push   $0x0
+  8016f9:	68 00 00 c0 ee       	push   $0xeec00000
+  8016fe:	52                   	push   %edx
+  8016ff:	e8 f9 ed ff ff       	call   8004fd <sys_chan_wakeup>
+  801704:	83 c4 10             	add    $0x10,%esp
+}
+  801707:	c9                   	leave
+  801708:	c3                   	ret
+
+00801709 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801709:	55                   	push   %ebp
+  80170a:	89 e5                	mov    %esp,%ebp
+  80170c:	57                   	push   %edi
+  80170d:	56                   	push   %esi
+  80170e:	53                   	push   %ebx
+  80170f:	83 ec 18             	sub    $0x18,%esp
+  801712:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  801715:	57                   	push   %edi
+  801716:	e8 45 ef ff ff       	call   800660 <fd2data>
+  80171b:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  80171d:	83 c4 10             	add    $0x10,%esp
+  801720:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  801724:	74 2a                	je     801750 <devpipe_close+0x47>
+  801726:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  80172b:	89 f8                	mov    %edi,%eax
+  80172d:	e8 4f ff ff ff       	call   801681 <pipe_ring>
+  801732:	83 ec 08             	sub    $0x8,%esp
+  801735:	01 d8                	add    %ebx,%eax
+  801737:	50                   	push   %eax
+  801738:	6a 00                	push   $0x0
+  80173a:	e8 e7 ea ff ff       	call   800226 <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  80173f:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801745:	83 c4 10             	add    $0x10,%esp
+  801748:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  80174e:	75 db                	jne    80172b <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  801750:	83 ec 08             	sub    $0x8,%esp
+  801753:	57                   	push   %edi
+  801754:	6a 00                	push   $0x0
+  801756:	e8 cb ea ff ff       	call   800226 <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  80175b:	83 c4 10             	add    $0x10,%esp
+  80175e:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  801762:	75 13                	jne    801777 <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  801764:	83 ec 08             	sub    $0x8,%esp
+  801767:	56                   	push   %esi
+  801768:	6a 00                	push   $0x0
+  80176a:	e8 b7 ea ff ff       	call   800226 <sys_page_unmap>
+}
+  80176f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801772:	5b                   	pop    %ebx
+  801773:	5e                   	pop    %esi
+  801774:	5f                   	pop    %edi
+  801775:	5d                   	pop    %ebp
+  801776:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  801777:	8d 56 04             	lea    0x4(%esi),%edx
+  80177a:	8d 46 2c             	lea    0x2c(%esi),%eax
+  80177d:	e8 60 ff ff ff       	call   8016e2 <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  801782:	8d 46 30             	lea    0x30(%esi),%eax
+  801785:	89 f2                	mov    %esi,%edx
+  801787:	e8 56 ff ff ff       	call   8016e2 <pipe_wakeup>
+  80178c:	eb d6                	jmp    801764 <devpipe_close+0x5b>
+
+0080178e <_pipeisclosed>:
+{
+  80178e:	55                   	push   %ebp
+  80178f:	89 e5                	mov    %esp,%ebp
+  801791:	57                   	push   %edi
+  801792:	56                   	push   %esi
+  801793:	53                   	push   %ebx
+  801794:	83 ec 1c             	sub    $0x1c,%esp
+  801797:	89 c7                	mov    %eax,%edi
+  801799:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  80179b:	a1 44 57 80 00       	mov    0x805744,%eax
+  8017a0:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  8017a3:	83 ec 0c             	sub    $0xc,%esp
+  8017a6:	57                   	push   %edi
+  8017a7:	e8 11 14 00 00       	call   802bbd <pageref>
+  8017ac:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8017af:	89 34 24             	mov    %esi,(%esp)
+  8017b2:	e8 06 14 00 00       	call   802bbd <pageref>
+    nn = thisenv->env_runs;
+  8017b7:	8b 15 44 57 80 00    	mov    0x805744,%edx
+  8017bd:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  8017c0:	83 c4 10             	add    $0x10,%esp
+  8017c3:	39 cb                	cmp    %ecx,%ebx
+  8017c5:	74 1b                	je     8017e2 <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  8017c7:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8017ca:	75 cf                	jne    80179b <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8017cc:	8b 42 58             	mov    0x58(%edx),%eax
+  8017cf:	6a 01                	push   $0x1
+  8017d1:	50                   	push   %eax
+  8017d2:	53                   	push   %ebx
+  8017d3:	68 77 2f 80 00       	push   $0x802f77
+  8017d8:	e8 5f 09 00 00       	call   80213c <cprintf>
+  8017dd:	83 c4 10             	add    $0x10,%esp
+  8017e0:	eb b9                	jmp    80179b <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  8017e2:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8017e5:	0f 94 c0             	sete   %al
+  8017e8:	0f b6 c0             	movzbl %al,%eax
+}
+  8017eb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017ee:	5b                   	pop    %ebx
+  8017ef:	5e                   	pop    %esi
+  8017f0:	5f                   	pop    %edi
+  8017f1:	5d                   	pop    %ebp
+  8017f2:	c3                   	ret
+
+008017f3 <devpipe_write_bulk>:
+{
+  8017f3:	55                   	push   %ebp
+  8017f4:	89 e5                	mov    %esp,%ebp
+  8017f6:	57                   	push   %edi
+  8017f7:	56                   	push   %esi
+  8017f8:	53                   	push   %ebx
+  8017f9:	83 ec 1c             	sub    $0x1c,%esp
+  8017fc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8017ff:	89 d6                	mov    %edx,%esi
+  801801:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  801804:	e8 78 fe ff ff       	call   801681 <pipe_ring>
+  801809:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  80180c:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  801811:	8d 46 04             	lea    0x4(%esi),%eax
+  801814:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  801817:	eb 75                	jmp    80188e <devpipe_write_bulk+0x9b>
+  801819:	b8 01 00 00 00       	mov    $0x1,%eax
+  80181e:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  801822:	6a 64                	push   $0x64
+  801824:	68 00 00 c0 ee       	push   $0xeec00000
+  801829:	53                   	push   %ebx
+  80182a:	56                   	push   %esi
+  80182b:	e8 aa ec ff ff       	call   8004da <sys_chan_sleep>
+      continue;
+  801830:	83 c4 10             	add    $0x10,%esp
+  801833:	eb 59                	jmp    80188e <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  801835:	89 d1                	mov    %edx,%ecx
+  801837:	c1 f9 1f             	sar    $0x1f,%ecx
+  80183a:	c1 e9 11             	shr    $0x11,%ecx
+  80183d:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  801840:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  801845:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  801847:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  80184d:	29 d3                	sub    %edx,%ebx
+  80184f:	ba 00 80 00 00       	mov    $0x8000,%edx
+  801854:	29 c2                	sub    %eax,%edx
+  801856:	39 d3                	cmp    %edx,%ebx
+  801858:	0f 47 da             	cmova  %edx,%ebx
+  80185b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80185e:	29 fa                	sub    %edi,%edx
+  801860:	39 d3                	cmp    %edx,%ebx
+  801862:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  801865:	83 ec 04             	sub    $0x4,%esp
+  801868:	53                   	push   %ebx
+  801869:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80186c:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  80186f:	52                   	push   %edx
+  801870:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801873:	01 c8                	add    %ecx,%eax
+  801875:	50                   	push   %eax
+  801876:	e8 97 10 00 00       	call   802912 <memcpy>
+    i += m;
+  80187b:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  80187d:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  801880:	8d 46 2c             	lea    0x2c(%esi),%eax
+  801883:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801886:	e8 57 fe ff ff       	call   8016e2 <pipe_wakeup>
+  80188b:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  80188e:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  801891:	73 2b                	jae    8018be <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  801893:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  801895:	8b 56 04             	mov    0x4(%esi),%edx
+  801898:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  80189e:	39 d0                	cmp    %edx,%eax
+  8018a0:	7d 93                	jge    801835 <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  8018a2:	89 f2                	mov    %esi,%edx
+  8018a4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8018a7:	e8 e2 fe ff ff       	call   80178e <_pipeisclosed>
+  8018ac:	85 c0                	test   %eax,%eax
+  8018ae:	0f 84 65 ff ff ff    	je     801819 <devpipe_write_bulk+0x26>
+        return i;
+  8018b4:	89 f8                	mov    %edi,%eax
+}
+  8018b6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018b9:	5b                   	pop    %ebx
+  8018ba:	5e                   	pop    %esi
+  8018bb:	5f                   	pop    %edi
+  8018bc:	5d                   	pop    %ebp
+  8018bd:	c3                   	ret
+  return i;
+  8018be:	89 f8                	mov    %edi,%eax
+  8018c0:	eb f4                	jmp    8018b6 <devpipe_write_bulk+0xc3>
+
+008018c2 <devpipe_write>:
+{
+  8018c2:	55                   	push   %ebp
+  8018c3:	89 e5                	mov    %esp,%ebp
+  8018c5:	57                   	push   %edi
+  8018c6:	56                   	push   %esi
+  8018c7:	53                   	push   %ebx
+  8018c8:	83 ec 28             	sub    $0x28,%esp
+  8018cb:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  8018ce:	56                   	push   %esi
+  8018cf:	e8 8c ed ff ff       	call   800660 <fd2data>
+  8018d4:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  8018d6:	8b 78 28             	mov    0x28(%eax),%edi
+  8018d9:	83 c4 10             	add    $0x10,%esp
+  8018dc:	85 ff                	test   %edi,%edi
+  8018de:	75 25                	jne    801905 <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  8018e0:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8018e3:	74 66                	je     80194b <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8018e5:	8b 43 04             	mov    0x4(%ebx),%eax
+  8018e8:	8b 0b                	mov    (%ebx),%ecx
+  8018ea:	8d 51 20             	lea    0x20(%ecx),%edx
+  8018ed:	39 d0                	cmp    %edx,%eax
+  8018ef:	72 2b                	jb     80191c <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  8018f1:	89 da                	mov    %ebx,%edx
+  8018f3:	89 f0                	mov    %esi,%eax
+  8018f5:	e8 94 fe ff ff       	call   80178e <_pipeisclosed>
+  8018fa:	85 c0                	test   %eax,%eax
+  8018fc:	75 51                	jne    80194f <devpipe_write+0x8d>
+      sys_yield();
+  8018fe:	e8 3c e8 ff ff       	call   80013f <sys_yield>
+  801903:	eb e0                	jmp    8018e5 <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  801905:	83 ec 0c             	sub    $0xc,%esp
+  801908:	ff 75 10             	push   0x10(%ebp)
+  80190b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80190e:	89 c2                	mov    %eax,%edx
+  801910:	89 f0                	mov    %esi,%eax
+  801912:	e8 dc fe ff ff       	call   8017f3 <devpipe_write_bulk>
+  801917:	83 c4 10             	add    $0x10,%esp
+  80191a:	eb 38                	jmp    801954 <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80191c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80191f:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801923:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  801926:	89 c2                	mov    %eax,%edx
+  801928:	c1 fa 1f             	sar    $0x1f,%edx
+  80192b:	89 d1                	mov    %edx,%ecx
+  80192d:	c1 e9 1b             	shr    $0x1b,%ecx
+  801930:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801933:	83 e2 1f             	and    $0x1f,%edx
+  801936:	29 ca                	sub    %ecx,%edx
+  801938:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  80193c:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  801940:	83 c0 01             	add    $0x1,%eax
+  801943:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  801946:	83 c7 01             	add    $0x1,%edi
+  801949:	eb 95                	jmp    8018e0 <devpipe_write+0x1e>
+  return i;
+  80194b:	89 f8                	mov    %edi,%eax
+  80194d:	eb 05                	jmp    801954 <devpipe_write+0x92>
+        return 0;
+  80194f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801954:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801957:	5b                   	pop    %ebx
+  801958:	5e                   	pop    %esi
+  801959:	5f                   	pop    %edi
+  80195a:	5d                   	pop    %ebp
+  80195b:	c3                   	ret
+
+0080195c <devpipe_read_bulk>:
+{
+  80195c:	55                   	push   %ebp
+  80195d:	89 e5                	mov    %esp,%ebp
+  80195f:	57                   	push   %edi
+  801960:	56                   	push   %esi
+  801961:	53                   	push   %ebx
+  801962:	83 ec 2c             	sub    $0x2c,%esp
+  801965:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801968:	89 d6                	mov    %edx,%esi
+  80196a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80196d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  801970:	e8 0c fd ff ff       	call   801681 <pipe_ring>
+  801975:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  801978:	85 db                	test   %ebx,%ebx
+  80197a:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80197f:	0f 45 c3             	cmovne %ebx,%eax
+  801982:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801985:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  80198a:	8d 46 30             	lea    0x30(%esi),%eax
+  80198d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  801990:	eb 50                	jmp    8019e2 <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  801992:	89 d1                	mov    %edx,%ecx
+  801994:	c1 f9 1f             	sar    $0x1f,%ecx
+  801997:	c1 e9 11             	shr    $0x11,%ecx
+  80199a:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  80199d:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8019a2:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  8019a4:	29 d3                	sub    %edx,%ebx
+  8019a6:	ba 00 80 00 00       	mov    $0x8000,%edx
+  8019ab:	29 c2                	sub    %eax,%edx
+  8019ad:	39 d3                	cmp    %edx,%ebx
+  8019af:	0f 47 da             	cmova  %edx,%ebx
+  8019b2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019b5:	29 fa                	sub    %edi,%edx
+  8019b7:	39 d3                	cmp    %edx,%ebx
+  8019b9:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  8019bc:	83 ec 04             	sub    $0x4,%esp
+  8019bf:	53                   	push   %ebx
+  8019c0:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8019c3:	01 c8                	add    %ecx,%eax
+  8019c5:	50                   	push   %eax
+  8019c6:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8019c9:	01 f8                	add    %edi,%eax
+  8019cb:	50                   	push   %eax
+  8019cc:	e8 41 0f 00 00       	call   802912 <memcpy>
+    i += m;
+  8019d1:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  8019d3:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8019d5:	89 f2                	mov    %esi,%edx
+  8019d7:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8019da:	e8 03 fd ff ff       	call   8016e2 <pipe_wakeup>
+  8019df:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  8019e2:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  8019e5:	73 51                	jae    801a38 <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  8019e7:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  8019ea:	8b 16                	mov    (%esi),%edx
+  8019ec:	39 da                	cmp    %ebx,%edx
+  8019ee:	75 a2                	jne    801992 <devpipe_read_bulk+0x36>
+      if (i > 0)
+  8019f0:	85 ff                	test   %edi,%edi
+  8019f2:	75 44                	jne    801a38 <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  8019f4:	89 f2                	mov    %esi,%edx
+  8019f6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8019f9:	e8 90 fd ff ff       	call   80178e <_pipeisclosed>
+  8019fe:	85 c0                	test   %eax,%eax
+  801a00:	75 3a                	jne    801a3c <devpipe_read_bulk+0xe0>
+  801a02:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a07:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  801a0b:	6a 64                	push   $0x64
+  801a0d:	ff 75 d4             	push   -0x2c(%ebp)
+  801a10:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  801a11:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  801a14:	50                   	push   %eax
+  801a15:	e8 c0 ea ff ff       	call   8004da <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  801a1a:	85 c0                	test   %eax,%eax
+  801a1c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a21:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  801a24:	83 c4 10             	add    $0x10,%esp
+  801a27:	a8 01                	test   $0x1,%al
+  801a29:	74 b7                	je     8019e2 <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  801a2b:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  801a30:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a33:	5b                   	pop    %ebx
+  801a34:	5e                   	pop    %esi
+  801a35:	5f                   	pop    %edi
+  801a36:	5d                   	pop    %ebp
+  801a37:	c3                   	ret
+  return i;
+  801a38:	89 f8                	mov    %edi,%eax
+  801a3a:	eb f4                	jmp    801a30 <devpipe_read_bulk+0xd4>
+        return 0;
+  801a3c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a41:	eb ed                	jmp    801a30 <devpipe_read_bulk+0xd4>
+
+00801a43 <devpipe_read>:
+{
+  801a43:	55                   	push   %ebp
+  801a44:	89 e5                	mov    %esp,%ebp
+  801a46:	57                   	push   %edi
+  801a47:	56                   	push   %esi
+  801a48:	53                   	push   %ebx
+  801a49:	83 ec 18             	sub    $0x18,%esp
+  801a4c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  801a4f:	57                   	push   %edi
+  801a50:	e8 0b ec ff ff       	call   800660 <fd2data>
+  801a55:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  801a57:	8b 70 28             	mov    0x28(%eax),%esi
+  801a5a:	83 c4 10             	add    $0x10,%esp
+  801a5d:	85 f6                	test   %esi,%esi
+  801a5f:	75 24                	jne    801a85 <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  801a61:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801a64:	74 60                	je     801ac6 <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  801a66:	8b 03                	mov    (%ebx),%eax
+  801a68:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801a6b:	75 3b                	jne    801aa8 <devpipe_read+0x65>
+      if (i > 0)
+  801a6d:	85 f6                	test   %esi,%esi
+  801a6f:	75 2d                	jne    801a9e <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  801a71:	89 da                	mov    %ebx,%edx
+  801a73:	89 f8                	mov    %edi,%eax
+  801a75:	e8 14 fd ff ff       	call   80178e <_pipeisclosed>
+  801a7a:	85 c0                	test   %eax,%eax
+  801a7c:	75 4c                	jne    801aca <devpipe_read+0x87>
+      sys_yield();
+  801a7e:	e8 bc e6 ff ff       	call   80013f <sys_yield>
+  801a83:	eb e1                	jmp    801a66 <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  801a85:	83 ec 08             	sub    $0x8,%esp
+  801a88:	6a 00                	push   $0x0
+  801a8a:	ff 75 10             	push   0x10(%ebp)
+  801a8d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a90:	89 c2                	mov    %eax,%edx
+  801a92:	89 f8                	mov    %edi,%eax
+  801a94:	e8 c3 fe ff ff       	call   80195c <devpipe_read_bulk>
+  801a99:	83 c4 10             	add    $0x10,%esp
+  801a9c:	eb 02                	jmp    801aa0 <devpipe_read+0x5d>
+        return i;
+  801a9e:	89 f0                	mov    %esi,%eax
+}
+  801aa0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801aa3:	5b                   	pop    %ebx
+  801aa4:	5e                   	pop    %esi
+  801aa5:	5f                   	pop    %edi
+  801aa6:	5d                   	pop    %ebp
+  801aa7:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801aa8:	99                   	cltd
+  801aa9:	c1 ea 1b             	shr    $0x1b,%edx
+  801aac:	01 d0                	add    %edx,%eax
+  801aae:	83 e0 1f             	and    $0x1f,%eax
+  801ab1:	29 d0                	sub    %edx,%eax
+  801ab3:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801ab8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801abb:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  801abe:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  801ac1:	83 c6 01             	add    $0x1,%esi
+  801ac4:	eb 9b                	jmp    801a61 <devpipe_read+0x1e>
+  return i;
+  801ac6:	89 f0                	mov    %esi,%eax
+  801ac8:	eb d6                	jmp    801aa0 <devpipe_read+0x5d>
+        return 0;
+  801aca:	b8 00 00 00 00       	mov    $0x0,%eax
+  801acf:	eb cf                	jmp    801aa0 <devpipe_read+0x5d>
+
+00801ad1 <pipe2>:
+{
+  801ad1:	55                   	push   %ebp
+  801ad2:	89 e5                	mov    %esp,%ebp
+  801ad4:	57                   	push   %edi
+  801ad5:	56                   	push   %esi
+  801ad6:	53                   	push   %ebx
+  801ad7:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  801ada:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801add:	50                   	push   %eax
+  801ade:	e8 91 eb ff ff       	call   800674 <fd_alloc>
+  801ae3:	89 c3                	mov    %eax,%ebx
+  801ae5:	83 c4 10             	add    $0x10,%esp
+  801ae8:	85 c0                	test   %eax,%eax
+  801aea:	0f 88 fb 01 00 00    	js     801ceb <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801af0:	83 ec 04             	sub    $0x4,%esp
+  801af3:	68 07 04 00 00       	push   $0x407
+  801af8:	ff 75 e4             	push   -0x1c(%ebp)
+  801afb:	6a 00                	push   $0x0
+  801afd:	e8 9f e6 ff ff       	call   8001a1 <sys_page_alloc>
+  801b02:	89 c3                	mov    %eax,%ebx
+  801b04:	83 c4 10             	add    $0x10,%esp
+  801b07:	85 c0                	test   %eax,%eax
+  801b09:	0f 88 dc 01 00 00    	js     801ceb <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  801b0f:	83 ec 0c             	sub    $0xc,%esp
+  801b12:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801b15:	50                   	push   %eax
+  801b16:	e8 59 eb ff ff       	call   800674 <fd_alloc>
+  801b1b:	89 c3                	mov    %eax,%ebx
+  801b1d:	83 c4 10             	add    $0x10,%esp
+  801b20:	85 c0                	test   %eax,%eax
+  801b22:	0f 88 b3 01 00 00    	js     801cdb <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801b28:	83 ec 04             	sub    $0x4,%esp
+  801b2b:	68 07 04 00 00       	push   $0x407
+  801b30:	ff 75 e0             	push   -0x20(%ebp)
+  801b33:	6a 00                	push   $0x0
+  801b35:	e8 67 e6 ff ff       	call   8001a1 <sys_page_alloc>
+  801b3a:	89 c3                	mov    %eax,%ebx
+  801b3c:	83 c4 10             	add    $0x10,%esp
+  801b3f:	85 c0                	test   %eax,%eax
+  801b41:	0f 88 94 01 00 00    	js     801cdb <pipe2+0x20a>
+  va = fd2data(fd0);
+  801b47:	83 ec 0c             	sub    $0xc,%esp
+  801b4a:	ff 75 e4             	push   -0x1c(%ebp)
+  801b4d:	e8 0e eb ff ff       	call   800660 <fd2data>
+  801b52:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801b54:	83 c4 0c             	add    $0xc,%esp
+  801b57:	68 07 04 00 00       	push   $0x407
+  801b5c:	50                   	push   %eax
+  801b5d:	6a 00                	push   $0x0
+  801b5f:	e8 3d e6 ff ff       	call   8001a1 <sys_page_alloc>
+  801b64:	89 c3                	mov    %eax,%ebx
+  801b66:	83 c4 10             	add    $0x10,%esp
+  801b69:	85 c0                	test   %eax,%eax
+  801b6b:	0f 88 5a 01 00 00    	js     801ccb <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801b71:	83 ec 0c             	sub    $0xc,%esp
+  801b74:	ff 75 e0             	push   -0x20(%ebp)
+  801b77:	e8 e4 ea ff ff       	call   800660 <fd2data>
+  801b7c:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  801b83:	50                   	push   %eax
+  801b84:	6a 00                	push   $0x0
+  801b86:	57                   	push   %edi
+  801b87:	6a 00                	push   $0x0
+  801b89:	e8 56 e6 ff ff       	call   8001e4 <sys_page_map>
+  801b8e:	89 c3                	mov    %eax,%ebx
+  801b90:	83 c4 20             	add    $0x20,%esp
+  801b93:	85 c0                	test   %eax,%eax
+  801b95:	0f 88 22 01 00 00    	js     801cbd <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  801b9b:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  801b9f:	74 72                	je     801c13 <pipe2+0x142>
+  801ba1:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  801ba6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801ba9:	e8 d3 fa ff ff       	call   801681 <pipe_ring>
+  801bae:	83 ec 04             	sub    $0x4,%esp
+  801bb1:	68 07 04 00 00       	push   $0x407
+  801bb6:	01 f0                	add    %esi,%eax
+  801bb8:	50                   	push   %eax
+  801bb9:	6a 00                	push   $0x0
+  801bbb:	e8 e1 e5 ff ff       	call   8001a1 <sys_page_alloc>
+  801bc0:	89 c3                	mov    %eax,%ebx
+  801bc2:	83 c4 10             	add    $0x10,%esp
+  801bc5:	85 c0                	test   %eax,%eax
+  801bc7:	0f 88 97 00 00 00    	js     801c64 <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  801bcd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801bd0:	e8 ac fa ff ff       	call   801681 <pipe_ring>
+  801bd5:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  801bd8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801bdb:	e8 a1 fa ff ff       	call   801681 <pipe_ring>
+  801be0:	83 ec 0c             	sub    $0xc,%esp
+  801be3:	68 07 04 00 00       	push   $0x407
+  801be8:	53                   	push   %ebx
+  801be9:	6a 00                	push   $0x0
+  801beb:	01 f0                	add    %esi,%eax
+  801bed:	50                   	push   %eax
+  801bee:	6a 00                	push   $0x0
+  801bf0:	e8 ef e5 ff ff       	call   8001e4 <sys_page_map>
+  801bf5:	89 c3                	mov    %eax,%ebx
+  801bf7:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801bfd:	83 c4 20             	add    $0x20,%esp
+  801c00:	85 c0                	test   %eax,%eax
+  801c02:	78 60                	js     801c64 <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  801c04:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  801c0a:	75 9a                	jne    801ba6 <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  801c0c:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  801c13:	a1 20 40 80 00       	mov    0x804020,%eax
+  801c18:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801c1b:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  801c1d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801c20:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  801c27:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801c2a:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  801c2c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801c2f:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  801c36:	83 ec 0c             	sub    $0xc,%esp
+  801c39:	ff 75 e4             	push   -0x1c(%ebp)
+  801c3c:	e8 0f ea ff ff       	call   800650 <fd2num>
+  801c41:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801c44:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  801c46:	83 c4 04             	add    $0x4,%esp
+  801c49:	ff 75 e0             	push   -0x20(%ebp)
+  801c4c:	e8 ff e9 ff ff       	call   800650 <fd2num>
+  801c51:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801c54:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  801c57:	83 c4 10             	add    $0x10,%esp
+  801c5a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c5f:	e9 87 00 00 00       	jmp    801ceb <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  801c64:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  801c69:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801c6c:	e8 10 fa ff ff       	call   801681 <pipe_ring>
+  801c71:	83 ec 08             	sub    $0x8,%esp
+  801c74:	01 f0                	add    %esi,%eax
+  801c76:	50                   	push   %eax
+  801c77:	6a 00                	push   $0x0
+  801c79:	e8 a8 e5 ff ff       	call   800226 <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  801c7e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801c81:	e8 fb f9 ff ff       	call   801681 <pipe_ring>
+  801c86:	83 c4 08             	add    $0x8,%esp
+  801c89:	01 f0                	add    %esi,%eax
+  801c8b:	50                   	push   %eax
+  801c8c:	6a 00                	push   $0x0
+  801c8e:	e8 93 e5 ff ff       	call   800226 <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  801c93:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801c99:	83 c4 10             	add    $0x10,%esp
+  801c9c:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  801ca2:	75 c5                	jne    801c69 <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  801ca4:	83 ec 0c             	sub    $0xc,%esp
+  801ca7:	ff 75 e0             	push   -0x20(%ebp)
+  801caa:	e8 b1 e9 ff ff       	call   800660 <fd2data>
+  801caf:	83 c4 08             	add    $0x8,%esp
+  801cb2:	50                   	push   %eax
+  801cb3:	6a 00                	push   $0x0
+  801cb5:	e8 6c e5 ff ff       	call   800226 <sys_page_unmap>
+  801cba:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  801cbd:	83 ec 08             	sub    $0x8,%esp
+  801cc0:	57                   	push   %edi
+  801cc1:	6a 00                	push   $0x0
+  801cc3:	e8 5e e5 ff ff       	call   800226 <sys_page_unmap>
+  801cc8:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  801ccb:	83 ec 08             	sub    $0x8,%esp
+  801cce:	ff 75 e0             	push   -0x20(%ebp)
+  801cd1:	6a 00                	push   $0x0
+  801cd3:	e8 4e e5 ff ff       	call   800226 <sys_page_unmap>
+  801cd8:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  801cdb:	83 ec 08             	sub    $0x8,%esp
+  801cde:	ff 75 e4             	push   -0x1c(%ebp)
+  801ce1:	6a 00                	push   $0x0
+  801ce3:	e8 3e e5 ff ff       	call   800226 <sys_page_unmap>
+  801ce8:	83 c4 10             	add    $0x10,%esp
+}
+  801ceb:	89 d8                	mov    %ebx,%eax
+  801ced:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cf0:	5b                   	pop    %ebx
+  801cf1:	5e                   	pop    %esi
+  801cf2:	5f                   	pop    %edi
+  801cf3:	5d                   	pop    %ebp
+  801cf4:	c3                   	ret
+
+00801cf5 <pipe>:
+{
+  801cf5:	55                   	push   %ebp
+  801cf6:	89 e5                	mov    %esp,%ebp
+  801cf8:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  801cfb:	6a 00                	push   $0x0
+  801cfd:	ff 75 08             	push   0x8(%ebp)
+  801d00:	e8 cc fd ff ff       	call   801ad1 <pipe2>
+}
+  801d05:	c9                   	leave
+  801d06:	c3                   	ret
+
+00801d07 <pipeisclosed>:
+{
+  801d07:	55                   	push   %ebp
+  801d08:	89 e5                	mov    %esp,%ebp
+  801d0a:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801d0d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d10:	50                   	push   %eax
+  801d11:	ff 75 08             	push   0x8(%ebp)
+  801d14:	e8 b1 e9 ff ff       	call   8006ca <fd_lookup>
+  801d19:	83 c4 10             	add    $0x10,%esp
+  801d1c:	85 c0                	test   %eax,%eax
+  801d1e:	78 18                	js     801d38 <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  801d20:	83 ec 0c             	sub    $0xc,%esp
+  801d23:	ff 75 f4             	push   -0xc(%ebp)
+  801d26:	e8 35 e9 ff ff       	call   800660 <fd2data>
+  801d2b:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  801d2d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d30:	e8 59 fa ff ff       	call   80178e <_pipeisclosed>
+  801d35:	83 c4 10             	add    $0x10,%esp
+}
+  801d38:	c9                   	leave
+  801d39:	c3                   	ret
+
+00801d3a <pipe_splice>:
+{
+  801d3a:	55                   	push   %ebp
+  801d3b:	89 e5                	mov    %esp,%ebp
+  801d3d:	57                   	push   %edi
+  801d3e:	56                   	push   %esi
+  801d3f:	53                   	push   %ebx
+  801d40:	83 ec 34             	sub    $0x34,%esp
+  801d43:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801d46:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801d49:	50                   	push   %eax
+  801d4a:	ff 75 08             	push   0x8(%ebp)
+  801d4d:	e8 78 e9 ff ff       	call   8006ca <fd_lookup>
+  801d52:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801d55:	83 c4 10             	add    $0x10,%esp
+  801d58:	85 c0                	test   %eax,%eax
+  801d5a:	0f 88 d7 00 00 00    	js     801e37 <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  801d60:	83 ec 0c             	sub    $0xc,%esp
+  801d63:	ff 75 e4             	push   -0x1c(%ebp)
+  801d66:	e8 f5 e8 ff ff       	call   800660 <fd2data>
+  801d6b:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  801d6d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801d70:	83 c4 10             	add    $0x10,%esp
+  801d73:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801d79:	39 10                	cmp    %edx,(%eax)
+  801d7b:	0f 85 c1 00 00 00    	jne    801e42 <pipe_splice+0x108>
+  801d81:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  801d85:	0f 84 c0 00 00 00    	je     801e4b <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  801d8b:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  801d8f:	0f 84 bf 00 00 00    	je     801e54 <pipe_splice+0x11a>
+  801d95:	89 f7                	mov    %esi,%edi
+  801d97:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  801d9d:	0f 85 ba 00 00 00    	jne    801e5d <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  801da3:	8d 43 04             	lea    0x4(%ebx),%eax
+  801da6:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801da9:	eb 38                	jmp    801de3 <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  801dab:	83 ec 0c             	sub    $0xc,%esp
+  801dae:	68 00 10 00 00       	push   $0x1000
+  801db3:	89 f1                	mov    %esi,%ecx
+  801db5:	89 da                	mov    %ebx,%edx
+  801db7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801dba:	e8 34 fa ff ff       	call   8017f3 <devpipe_write_bulk>
+  801dbf:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801dc2:	83 c4 10             	add    $0x10,%esp
+  801dc5:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801dca:	75 53                	jne    801e1f <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  801dcc:	83 ec 08             	sub    $0x8,%esp
+  801dcf:	56                   	push   %esi
+  801dd0:	6a 00                	push   $0x0
+  801dd2:	e8 4f e4 ff ff       	call   800226 <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  801dd7:	83 c7 01             	add    $0x1,%edi
+  801dda:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801de0:	83 c4 10             	add    $0x10,%esp
+  801de3:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801de6:	74 3a                	je     801e22 <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  801de8:	8b 03                	mov    (%ebx),%eax
+  801dea:	39 43 04             	cmp    %eax,0x4(%ebx)
+  801ded:	75 bc                	jne    801dab <pipe_splice+0x71>
+  801def:	b8 00 00 00 00       	mov    $0x0,%eax
+  801df4:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  801df8:	85 c0                	test   %eax,%eax
+  801dfa:	74 af                	je     801dab <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  801dfc:	83 ec 04             	sub    $0x4,%esp
+  801dff:	6a 07                	push   $0x7
+  801e01:	56                   	push   %esi
+  801e02:	ff 75 d0             	push   -0x30(%ebp)
+  801e05:	e8 f3 e6 ff ff       	call   8004fd <sys_chan_wakeup>
+  801e0a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801e0d:	83 c4 10             	add    $0x10,%esp
+  801e10:	85 c0                	test   %eax,%eax
+  801e12:	79 b8                	jns    801dcc <pipe_splice+0x92>
+  801e14:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e19:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  801e1d:	eb 8c                	jmp    801dab <pipe_splice+0x71>
+  801e1f:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  801e22:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801e26:	75 06                	jne    801e2e <pipe_splice+0xf4>
+  801e28:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  801e2c:	78 09                	js     801e37 <pipe_splice+0xfd>
+  return i * PGSIZE;
+  801e2e:	8b 45 10             	mov    0x10(%ebp),%eax
+  801e31:	c1 e0 0c             	shl    $0xc,%eax
+  801e34:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  801e37:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801e3a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e3d:	5b                   	pop    %ebx
+  801e3e:	5e                   	pop    %esi
+  801e3f:	5f                   	pop    %edi
+  801e40:	5d                   	pop    %ebp
+  801e41:	c3                   	ret
+    return -E_INVAL;
+  801e42:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  801e49:	eb ec                	jmp    801e37 <pipe_splice+0xfd>
+  801e4b:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  801e52:	eb e3                	jmp    801e37 <pipe_splice+0xfd>
+  801e54:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  801e5b:	eb da                	jmp    801e37 <pipe_splice+0xfd>
+  801e5d:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  801e64:	eb d1                	jmp    801e37 <pipe_splice+0xfd>
+
+00801e66 <pipe_splice_read>:
+{
+  801e66:	55                   	push   %ebp
+  801e67:	89 e5                	mov    %esp,%ebp
+  801e69:	53                   	push   %ebx
+  801e6a:	83 ec 1c             	sub    $0x1c,%esp
+  801e6d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801e70:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e73:	50                   	push   %eax
+  801e74:	ff 75 08             	push   0x8(%ebp)
+  801e77:	e8 4e e8 ff ff       	call   8006ca <fd_lookup>
+  801e7c:	83 c4 10             	add    $0x10,%esp
+  801e7f:	85 c0                	test   %eax,%eax
+  801e81:	78 49                	js     801ecc <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  801e83:	83 ec 0c             	sub    $0xc,%esp
+  801e86:	ff 75 f4             	push   -0xc(%ebp)
+  801e89:	e8 d2 e7 ff ff       	call   800660 <fd2data>
+  801e8e:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  801e90:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e93:	83 c4 10             	add    $0x10,%esp
+  801e96:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  801e9c:	39 08                	cmp    %ecx,(%eax)
+  801e9e:	75 31                	jne    801ed1 <pipe_splice_read+0x6b>
+  801ea0:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  801ea4:	74 32                	je     801ed8 <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  801ea6:	8b 48 08             	mov    0x8(%eax),%ecx
+  801ea9:	83 e1 03             	and    $0x3,%ecx
+  801eac:	83 f9 01             	cmp    $0x1,%ecx
+  801eaf:	74 2e                	je     801edf <pipe_splice_read+0x79>
+  801eb1:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  801eb7:	75 2d                	jne    801ee6 <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  801eb9:	83 ec 08             	sub    $0x8,%esp
+  801ebc:	53                   	push   %ebx
+  801ebd:	68 00 10 00 00       	push   $0x1000
+  801ec2:	89 d9                	mov    %ebx,%ecx
+  801ec4:	e8 93 fa ff ff       	call   80195c <devpipe_read_bulk>
+  801ec9:	83 c4 10             	add    $0x10,%esp
+}
+  801ecc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ecf:	c9                   	leave
+  801ed0:	c3                   	ret
+    return -E_INVAL;
+  801ed1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ed6:	eb f4                	jmp    801ecc <pipe_splice_read+0x66>
+  801ed8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801edd:	eb ed                	jmp    801ecc <pipe_splice_read+0x66>
+  801edf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ee4:	eb e6                	jmp    801ecc <pipe_splice_read+0x66>
+  801ee6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801eeb:	eb df                	jmp    801ecc <pipe_splice_read+0x66>
+
+00801eed <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  801eed:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ef2:	c3                   	ret
+
+00801ef3 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  801ef3:	55                   	push   %ebp
+  801ef4:	89 e5                	mov    %esp,%ebp
+  801ef6:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  801ef9:	68 8f 2f 80 00       	push   $0x802f8f
+  801efe:	ff 75 0c             	push   0xc(%ebp)
+  801f01:	e8 24 08 00 00       	call   80272a <strcpy>
+  return 0;
+}
+  801f06:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f0b:	c9                   	leave
+  801f0c:	c3                   	ret
+
+00801f0d <devcons_write>:
+{
+  801f0d:	55                   	push   %ebp
+  801f0e:	89 e5                	mov    %esp,%ebp
+  801f10:	57                   	push   %edi
+  801f11:	56                   	push   %esi
+  801f12:	53                   	push   %ebx
+  801f13:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  801f19:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  801f1e:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  801f24:	eb 2e                	jmp    801f54 <devcons_write+0x47>
+    m = n - tot;
+  801f26:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f29:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  801f2b:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801f30:	39 c3                	cmp    %eax,%ebx
+  801f32:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  801f35:	83 ec 04             	sub    $0x4,%esp
+  801f38:	53                   	push   %ebx
+  801f39:	89 f0                	mov    %esi,%eax
+  801f3b:	03 45 0c             	add    0xc(%ebp),%eax
+  801f3e:	50                   	push   %eax
+  801f3f:	57                   	push   %edi
+  801f40:	e8 6b 09 00 00       	call   8028b0 <memmove>
+    sys_cputs(buf, m);
+  801f45:	83 c4 08             	add    $0x8,%esp
+  801f48:	53                   	push   %ebx
+  801f49:	57                   	push   %edi
+  801f4a:	e8 53 e1 ff ff       	call   8000a2 <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  801f4f:	01 de                	add    %ebx,%esi
+  801f51:	83 c4 10             	add    $0x10,%esp
+  801f54:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801f57:	72 cd                	jb     801f26 <devcons_write+0x19>
+}
+  801f59:	89 f0                	mov    %esi,%eax
+  801f5b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f5e:	5b                   	pop    %ebx
+  801f5f:	5e                   	pop    %esi
+  801f60:	5f                   	pop    %edi
+  801f61:	5d                   	pop    %ebp
+  801f62:	c3                   	ret
+
+00801f63 <devcons_read>:
+{
+  801f63:	55                   	push   %ebp
+  801f64:	89 e5                	mov    %esp,%ebp
+  801f66:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  801f69:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f6e:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801f72:	75 07                	jne    801f7b <devcons_read+0x18>
+  801f74:	eb 1f                	jmp    801f95 <devcons_read+0x32>
+    sys_yield();
+  801f76:	e8 c4 e1 ff ff       	call   80013f <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  801f7b:	e8 40 e1 ff ff       	call   8000c0 <sys_cgetc>
+  801f80:	85 c0                	test   %eax,%eax
+  801f82:	74 f2                	je     801f76 <devcons_read+0x13>
+  if (c < 0)
+  801f84:	78 0f                	js     801f95 <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  801f86:	83 f8 04             	cmp    $0x4,%eax
+  801f89:	74 0c                	je     801f97 <devcons_read+0x34>
+  *(char*)vbuf = c;
+  801f8b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801f8e:	88 02                	mov    %al,(%edx)
+  return 1;
+  801f90:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  801f95:	c9                   	leave
+  801f96:	c3                   	ret
+    return 0;
+  801f97:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f9c:	eb f7                	jmp    801f95 <devcons_read+0x32>
+
+00801f9e <cputchar>:
+{
+  801f9e:	55                   	push   %ebp
+  801f9f:	89 e5                	mov    %esp,%ebp
+  801fa1:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  801fa4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fa7:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  801faa:	6a 01                	push   $0x1
+  801fac:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801faf:	50                   	push   %eax
+  801fb0:	e8 ed e0 ff ff       	call   8000a2 <sys_cputs>
+}
+  801fb5:	83 c4 10             	add    $0x10,%esp
+  801fb8:	c9                   	leave
+  801fb9:	c3                   	ret
+
+00801fba <getchar>:
+{
+  801fba:	55                   	push   %ebp
+  801fbb:	89 e5                	mov    %esp,%ebp
+  801fbd:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  801fc0:	6a 01                	push   $0x1
+  801fc2:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801fc5:	50                   	push   %eax
+  801fc6:	6a 00                	push   $0x0
+  801fc8:	e8 a8 e9 ff ff       	call   800975 <read>
+  if (r < 0)
+  801fcd:	83 c4 10             	add    $0x10,%esp
+  801fd0:	85 c0                	test   %eax,%eax
+  801fd2:	78 06                	js     801fda <getchar+0x20>
+  if (r < 1)
+  801fd4:	74 06                	je     801fdc <getchar+0x22>
+  return c;
+  801fd6:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  801fda:	c9                   	leave
+  801fdb:	c3                   	ret
+    return -E_EOF;
+  801fdc:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  801fe1:	eb f7                	jmp    801fda <getchar+0x20>
+
+00801fe3 <iscons>:
+{
+  801fe3:	55                   	push   %ebp
+  801fe4:	89 e5                	mov    %esp,%ebp
+  801fe6:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801fe9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fec:	50                   	push   %eax
+  801fed:	ff 75 08             	push   0x8(%ebp)
+  801ff0:	e8 d5 e6 ff ff       	call   8006ca <fd_lookup>
+  801ff5:	83 c4 10             	add    $0x10,%esp
+  801ff8:	85 c0                	test   %eax,%eax
+  801ffa:	78 11                	js     80200d <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  801ffc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801fff:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802005:	39 10                	cmp    %edx,(%eax)
+  802007:	0f 94 c0             	sete   %al
+  80200a:	0f b6 c0             	movzbl %al,%eax
+}
+  80200d:	c9                   	leave
+  80200e:	c3                   	ret
+
+0080200f <opencons>:
+{
+  80200f:	55                   	push   %ebp
+  802010:	89 e5                	mov    %esp,%ebp
+  802012:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  802015:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802018:	50                   	push   %eax
+  802019:	e8 56 e6 ff ff       	call   800674 <fd_alloc>
+  80201e:	83 c4 10             	add    $0x10,%esp
+  802021:	85 c0                	test   %eax,%eax
+  802023:	78 3a                	js     80205f <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802025:	83 ec 04             	sub    $0x4,%esp
+  802028:	68 07 04 00 00       	push   $0x407
+  80202d:	ff 75 f4             	push   -0xc(%ebp)
+  802030:	6a 00                	push   $0x0
+  802032:	e8 6a e1 ff ff       	call   8001a1 <sys_page_alloc>
+  802037:	83 c4 10             	add    $0x10,%esp
+  80203a:	85 c0                	test   %eax,%eax
+  80203c:	78 21                	js     80205f <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  80203e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802041:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802047:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  802049:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80204c:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  802053:	83 ec 0c             	sub    $0xc,%esp
+  802056:	50                   	push   %eax
+  802057:	e8 f4 e5 ff ff       	call   800650 <fd2num>
+  80205c:	83 c4 10             	add    $0x10,%esp
+}
+  80205f:	c9                   	leave
+  802060:	c3                   	ret
+
+00802061 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  802061:	55                   	push   %ebp
+  802062:	89 e5                	mov    %esp,%ebp
+  802064:	56                   	push   %esi
+  802065:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  802066:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  802069:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  80206f:	e8 ac e0 ff ff       	call   800120 <sys_getenvid>
+  802074:	83 ec 0c             	sub    $0xc,%esp
+  802077:	ff 75 0c             	push   0xc(%ebp)
+  80207a:	ff 75 08             	push   0x8(%ebp)
+  80207d:	56                   	push   %esi
+  80207e:	50                   	push   %eax
+  80207f:	68 9c 2f 80 00       	push   $0x802f9c
+  802084:	e8 b3 00 00 00       	call   80213c <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  802089:	83 c4 18             	add    $0x18,%esp
+  80208c:	53                   	push   %ebx
+  80208d:	ff 75 10             	push   0x10(%ebp)
+  802090:	e8 56 00 00 00       	call   8020eb <vcprintf>
+  cprintf("\n");
+  802095:	c7 04 24 88 2f 80 00 	movl   $0x802f88,(%esp)
+  80209c:	e8 9b 00 00 00       	call   80213c <cprintf>
+  8020a1:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  8020a4:	cc                   	int3
+  while (1)
+  8020a5:	eb fd                	jmp    8020a4 <_panic+0x43>
+
+008020a7 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8020a7:	55                   	push   %ebp
+  8020a8:	89 e5                	mov    %esp,%ebp
+  8020aa:	53                   	push   %ebx
+  8020ab:	83 ec 04             	sub    $0x4,%esp
+  8020ae:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  8020b1:	8b 13                	mov    (%ebx),%edx
+  8020b3:	8d 42 01             	lea    0x1(%edx),%eax
+  8020b6:	89 03                	mov    %eax,(%ebx)
+  8020b8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8020bb:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  8020bf:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8020c4:	74 09                	je     8020cf <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  8020c6:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8020ca:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020cd:	c9                   	leave
+  8020ce:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  8020cf:	83 ec 08             	sub    $0x8,%esp
+  8020d2:	68 ff 00 00 00       	push   $0xff
+  8020d7:	8d 43 08             	lea    0x8(%ebx),%eax
+  8020da:	50                   	push   %eax
+  8020db:	e8 c2 df ff ff       	call   8000a2 <sys_cputs>
+    b->idx = 0;
+  8020e0:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8020e6:	83 c4 10             	add    $0x10,%esp
+  8020e9:	eb db                	jmp    8020c6 <putch+0x1f>
+
+008020eb <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8020eb:	55                   	push   %ebp
+  8020ec:	89 e5                	mov    %esp,%ebp
+  8020ee:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  8020f4:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8020fb:	00 00 00 
+  b.cnt = 0;
+  8020fe:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  802105:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  802108:	ff 75 0c             	push   0xc(%ebp)
+  80210b:	ff 75 08             	push   0x8(%ebp)
+  80210e:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  802114:	50                   	push   %eax
+  802115:	68 a7 20 80 00       	push   $0x8020a7
+  80211a:	e8 14 01 00 00       	call   802233 <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  80211f:	83 c4 08             	add    $0x8,%esp
+  802122:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  802128:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80212e:	50                   	push   %eax
+  80212f:	e8 6e df ff ff       	call   8000a2 <sys_cputs>
+
+  return b.cnt;
+}
+  802134:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80213a:	c9                   	leave
+  80213b:	c3                   	ret
+
+0080213c <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80213c:	55                   	push   %ebp
+  80213d:	89 e5                	mov    %esp,%ebp
+  80213f:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  802142:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  802145:	50                   	push   %eax
+  802146:	ff 75 08             	push   0x8(%ebp)
+  802149:	e8 9d ff ff ff       	call   8020eb <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  80214e:	c9                   	leave
+  80214f:	c3                   	ret
+
+00802150 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  802150:	55                   	push   %ebp
+  802151:	89 e5                	mov    %esp,%ebp
+  802153:	57                   	push   %edi
+  802154:	56                   	push   %esi
+  802155:	53                   	push   %ebx
+  802156:	83 ec 1c             	sub    $0x1c,%esp
+  802159:	89 c7                	mov    %eax,%edi
+  80215b:	89 d6                	mov    %edx,%esi
+  80215d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802160:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802163:	89 d1                	mov    %edx,%ecx
+  802165:	89 c2                	mov    %eax,%edx
+  802167:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80216a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80216d:	8b 45 10             	mov    0x10(%ebp),%eax
+  802170:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  802173:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802176:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80217d:	39 c2                	cmp    %eax,%edx
+  80217f:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  802182:	72 3e                	jb     8021c2 <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  802184:	83 ec 0c             	sub    $0xc,%esp
+  802187:	ff 75 18             	push   0x18(%ebp)
+  80218a:	83 eb 01             	sub    $0x1,%ebx
+  80218d:	53                   	push   %ebx
+  80218e:	50                   	push   %eax
+  80218f:	83 ec 08             	sub    $0x8,%esp
+  802192:	ff 75 e4             	push   -0x1c(%ebp)
+  802195:	ff 75 e0             	push   -0x20(%ebp)
+  802198:	ff 75 dc             	push   -0x24(%ebp)
+  80219b:	ff 75 d8             	push   -0x28(%ebp)
+  80219e:	e8 1c 0b 00 00       	call   802cbf <__udivdi3>
+  8021a3:	83 c4 18             	add    $0x18,%esp
+  8021a6:	52                   	push   %edx
+  8021a7:	50                   	push   %eax
+  8021a8:	89 f2                	mov    %esi,%edx
+  8021aa:	89 f8                	mov    %edi,%eax
+  8021ac:	e8 9f ff ff ff       	call   802150 <printnum>
+  8021b1:	83 c4 20             	add    $0x20,%esp
+  8021b4:	eb 13                	jmp    8021c9 <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  8021b6:	83 ec 08             	sub    $0x8,%esp
+  8021b9:	56                   	push   %esi
+  8021ba:	ff 75 18             	push   0x18(%ebp)
+  8021bd:	ff d7                	call   *%edi
+  8021bf:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  8021c2:	83 eb 01             	sub    $0x1,%ebx
+  8021c5:	85 db                	test   %ebx,%ebx
+  8021c7:	7f ed                	jg     8021b6 <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  8021c9:	83 ec 08             	sub    $0x8,%esp
+  8021cc:	56                   	push   %esi
+  8021cd:	83 ec 04             	sub    $0x4,%esp
+  8021d0:	ff 75 e4             	push   -0x1c(%ebp)
+  8021d3:	ff 75 e0             	push   -0x20(%ebp)
+  8021d6:	ff 75 dc             	push   -0x24(%ebp)
+  8021d9:	ff 75 d8             	push   -0x28(%ebp)
+  8021dc:	e8 ff 0a 00 00       	call   802ce0 <__umoddi3>
+  8021e1:	83 c4 14             	add    $0x14,%esp
+  8021e4:	0f be 80 bf 2f 80 00 	movsbl 0x802fbf(%eax),%eax
+  8021eb:	50                   	push   %eax
+  8021ec:	ff d7                	call   *%edi
+}
+  8021ee:	83 c4 10             	add    $0x10,%esp
+  8021f1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021f4:	5b                   	pop    %ebx
+  8021f5:	5e                   	pop    %esi
+  8021f6:	5f                   	pop    %edi
+  8021f7:	5d                   	pop    %ebp
+  8021f8:	c3                   	ret
+
+008021f9 <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8021f9:	55                   	push   %ebp
+  8021fa:	89 e5                	mov    %esp,%ebp
+  8021fc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  8021ff:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  802203:	8b 10                	mov    (%eax),%edx
+  802205:	3b 50 04             	cmp    0x4(%eax),%edx
+  802208:	73 0a                	jae    802214 <sprintputch+0x1b>
+    *b->buf++ = ch;
+  80220a:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80220d:	89 08                	mov    %ecx,(%eax)
+  80220f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802212:	88 02                	mov    %al,(%edx)
+}
+  802214:	5d                   	pop    %ebp
+  802215:	c3                   	ret
+
+00802216 <printfmt>:
+{
+  802216:	55                   	push   %ebp
+  802217:	89 e5                	mov    %esp,%ebp
+  802219:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  80221c:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  80221f:	50                   	push   %eax
+  802220:	ff 75 10             	push   0x10(%ebp)
+  802223:	ff 75 0c             	push   0xc(%ebp)
+  802226:	ff 75 08             	push   0x8(%ebp)
+  802229:	e8 05 00 00 00       	call   802233 <vprintfmt>
+}
+  80222e:	83 c4 10             	add    $0x10,%esp
+  802231:	c9                   	leave
+  802232:	c3                   	ret
+
+00802233 <vprintfmt>:
+{
+  802233:	55                   	push   %ebp
+  802234:	89 e5                	mov    %esp,%ebp
+  802236:	57                   	push   %edi
+  802237:	56                   	push   %esi
+  802238:	53                   	push   %ebx
+  802239:	83 ec 2c             	sub    $0x2c,%esp
+  80223c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80223f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802242:	8b 7d 10             	mov    0x10(%ebp),%edi
+  802245:	eb 0a                	jmp    802251 <vprintfmt+0x1e>
+      putch(ch, putdat);
+  802247:	83 ec 08             	sub    $0x8,%esp
+  80224a:	53                   	push   %ebx
+  80224b:	50                   	push   %eax
+  80224c:	ff d6                	call   *%esi
+  80224e:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  802251:	83 c7 01             	add    $0x1,%edi
+  802254:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  802258:	83 f8 25             	cmp    $0x25,%eax
+  80225b:	74 0c                	je     802269 <vprintfmt+0x36>
+      if (ch == '\0')
+  80225d:	85 c0                	test   %eax,%eax
+  80225f:	75 e6                	jne    802247 <vprintfmt+0x14>
+}
+  802261:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802264:	5b                   	pop    %ebx
+  802265:	5e                   	pop    %esi
+  802266:	5f                   	pop    %edi
+  802267:	5d                   	pop    %ebp
+  802268:	c3                   	ret
+    padc = ' ';
+  802269:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  80226d:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  802274:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  80227b:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  802282:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  802287:	8d 47 01             	lea    0x1(%edi),%eax
+  80228a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80228d:	0f b6 17             	movzbl (%edi),%edx
+  802290:	8d 42 dd             	lea    -0x23(%edx),%eax
+  802293:	3c 55                	cmp    $0x55,%al
+  802295:	0f 87 cf 03 00 00    	ja     80266a <vprintfmt+0x437>
+  80229b:	0f b6 c0             	movzbl %al,%eax
+  80229e:	ff 24 85 00 31 80 00 	jmp    *0x803100(,%eax,4)
+  8022a5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  8022a8:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8022ac:	eb d9                	jmp    802287 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  8022ae:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8022b1:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8022b5:	eb d0                	jmp    802287 <vprintfmt+0x54>
+  8022b7:	0f b6 d2             	movzbl %dl,%edx
+  8022ba:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  8022bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022c2:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  8022c5:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8022c8:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  8022cc:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  8022cf:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8022d2:	83 f9 09             	cmp    $0x9,%ecx
+  8022d5:	77 55                	ja     80232c <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  8022d7:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  8022da:	eb e9                	jmp    8022c5 <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  8022dc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8022df:	8b 00                	mov    (%eax),%eax
+  8022e1:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8022e4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8022e7:	8d 40 04             	lea    0x4(%eax),%eax
+  8022ea:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  8022ed:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  8022f0:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8022f4:	79 91                	jns    802287 <vprintfmt+0x54>
+        width = precision, precision = -1;
+  8022f6:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8022f9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8022fc:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  802303:	eb 82                	jmp    802287 <vprintfmt+0x54>
+      if (width < 0)
+  802305:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802308:	85 d2                	test   %edx,%edx
+  80230a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80230f:	0f 49 c2             	cmovns %edx,%eax
+  802312:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  802315:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  802318:	e9 6a ff ff ff       	jmp    802287 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  80231d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  802320:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  802327:	e9 5b ff ff ff       	jmp    802287 <vprintfmt+0x54>
+  80232c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80232f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802332:	eb bc                	jmp    8022f0 <vprintfmt+0xbd>
+      lflag++;
+  802334:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  802337:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  80233a:	e9 48 ff ff ff       	jmp    802287 <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  80233f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802342:	8d 78 04             	lea    0x4(%eax),%edi
+  802345:	83 ec 08             	sub    $0x8,%esp
+  802348:	53                   	push   %ebx
+  802349:	ff 30                	push   (%eax)
+  80234b:	ff d6                	call   *%esi
+      break;
+  80234d:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  802350:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  802353:	e9 b1 02 00 00       	jmp    802609 <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  802358:	8b 45 14             	mov    0x14(%ebp),%eax
+  80235b:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  80235e:	8b 10                	mov    (%eax),%edx
+  802360:	89 d0                	mov    %edx,%eax
+  802362:	f7 d8                	neg    %eax
+  802364:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  802367:	83 f8 10             	cmp    $0x10,%eax
+  80236a:	7f 23                	jg     80238f <vprintfmt+0x15c>
+  80236c:	8b 14 85 60 32 80 00 	mov    0x803260(,%eax,4),%edx
+  802373:	85 d2                	test   %edx,%edx
+  802375:	74 18                	je     80238f <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  802377:	52                   	push   %edx
+  802378:	68 32 2f 80 00       	push   $0x802f32
+  80237d:	53                   	push   %ebx
+  80237e:	56                   	push   %esi
+  80237f:	e8 92 fe ff ff       	call   802216 <printfmt>
+  802384:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  802387:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80238a:	e9 7a 02 00 00       	jmp    802609 <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  80238f:	50                   	push   %eax
+  802390:	68 d7 2f 80 00       	push   $0x802fd7
+  802395:	53                   	push   %ebx
+  802396:	56                   	push   %esi
+  802397:	e8 7a fe ff ff       	call   802216 <printfmt>
+  80239c:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  80239f:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  8023a2:	e9 62 02 00 00       	jmp    802609 <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  8023a7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8023aa:	83 c0 04             	add    $0x4,%eax
+  8023ad:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8023b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8023b3:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  8023b5:	85 c9                	test   %ecx,%ecx
+  8023b7:	b8 d0 2f 80 00       	mov    $0x802fd0,%eax
+  8023bc:	0f 45 c1             	cmovne %ecx,%eax
+  8023bf:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  8023c2:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8023c6:	7e 06                	jle    8023ce <vprintfmt+0x19b>
+  8023c8:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8023cc:	75 0b                	jne    8023d9 <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8023ce:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8023d1:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8023d4:	89 75 08             	mov    %esi,0x8(%ebp)
+  8023d7:	eb 5c                	jmp    802435 <vprintfmt+0x202>
+  8023d9:	83 ec 08             	sub    $0x8,%esp
+  8023dc:	ff 75 d0             	push   -0x30(%ebp)
+  8023df:	ff 75 cc             	push   -0x34(%ebp)
+  8023e2:	e8 20 03 00 00       	call   802707 <strnlen>
+  8023e7:	89 c2                	mov    %eax,%edx
+  8023e9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8023ec:	29 d0                	sub    %edx,%eax
+  8023ee:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  8023f1:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8023f5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8023f8:	89 75 08             	mov    %esi,0x8(%ebp)
+  8023fb:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8023fd:	eb 0e                	jmp    80240d <vprintfmt+0x1da>
+          putch(padc, putdat);
+  8023ff:	83 ec 08             	sub    $0x8,%esp
+  802402:	53                   	push   %ebx
+  802403:	57                   	push   %edi
+  802404:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  802407:	83 ee 01             	sub    $0x1,%esi
+  80240a:	83 c4 10             	add    $0x10,%esp
+  80240d:	85 f6                	test   %esi,%esi
+  80240f:	7f ee                	jg     8023ff <vprintfmt+0x1cc>
+  802411:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802414:	8b 75 08             	mov    0x8(%ebp),%esi
+  802417:	85 c0                	test   %eax,%eax
+  802419:	ba 00 00 00 00       	mov    $0x0,%edx
+  80241e:	0f 49 d0             	cmovns %eax,%edx
+  802421:	29 d0                	sub    %edx,%eax
+  802423:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802426:	eb a6                	jmp    8023ce <vprintfmt+0x19b>
+          putch(ch, putdat);
+  802428:	83 ec 08             	sub    $0x8,%esp
+  80242b:	53                   	push   %ebx
+  80242c:	52                   	push   %edx
+  80242d:	ff 55 08             	call   *0x8(%ebp)
+  802430:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  802433:	89 f1                	mov    %esi,%ecx
+  802435:	8d 71 01             	lea    0x1(%ecx),%esi
+  802438:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80243c:	0f be d0             	movsbl %al,%edx
+  80243f:	85 d2                	test   %edx,%edx
+  802441:	74 28                	je     80246b <vprintfmt+0x238>
+  802443:	85 ff                	test   %edi,%edi
+  802445:	78 05                	js     80244c <vprintfmt+0x219>
+  802447:	83 ef 01             	sub    $0x1,%edi
+  80244a:	78 30                	js     80247c <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  80244c:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  802450:	74 d6                	je     802428 <vprintfmt+0x1f5>
+  802452:	0f be c0             	movsbl %al,%eax
+  802455:	83 e8 20             	sub    $0x20,%eax
+  802458:	83 f8 5e             	cmp    $0x5e,%eax
+  80245b:	76 cb                	jbe    802428 <vprintfmt+0x1f5>
+          putch('?', putdat);
+  80245d:	83 ec 08             	sub    $0x8,%esp
+  802460:	53                   	push   %ebx
+  802461:	6a 3f                	push   $0x3f
+  802463:	ff 55 08             	call   *0x8(%ebp)
+  802466:	83 c4 10             	add    $0x10,%esp
+  802469:	eb c8                	jmp    802433 <vprintfmt+0x200>
+  80246b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80246e:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802471:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802474:	01 d0                	add    %edx,%eax
+  802476:	29 c8                	sub    %ecx,%eax
+  802478:	89 c7                	mov    %eax,%edi
+  80247a:	eb 13                	jmp    80248f <vprintfmt+0x25c>
+  80247c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80247f:	eb ed                	jmp    80246e <vprintfmt+0x23b>
+        putch(' ', putdat);
+  802481:	83 ec 08             	sub    $0x8,%esp
+  802484:	53                   	push   %ebx
+  802485:	6a 20                	push   $0x20
+  802487:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  802489:	83 ef 01             	sub    $0x1,%edi
+  80248c:	83 c4 10             	add    $0x10,%esp
+  80248f:	85 ff                	test   %edi,%edi
+  802491:	7f ee                	jg     802481 <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  802493:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  802496:	89 45 14             	mov    %eax,0x14(%ebp)
+  802499:	e9 6b 01 00 00       	jmp    802609 <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  80249e:	83 f9 01             	cmp    $0x1,%ecx
+  8024a1:	7f 1f                	jg     8024c2 <vprintfmt+0x28f>
+  else if (lflag)
+  8024a3:	85 c9                	test   %ecx,%ecx
+  8024a5:	74 67                	je     80250e <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  8024a7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024aa:	8b 00                	mov    (%eax),%eax
+  8024ac:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8024af:	89 c1                	mov    %eax,%ecx
+  8024b1:	c1 f9 1f             	sar    $0x1f,%ecx
+  8024b4:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8024b7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024ba:	8d 40 04             	lea    0x4(%eax),%eax
+  8024bd:	89 45 14             	mov    %eax,0x14(%ebp)
+  8024c0:	eb 17                	jmp    8024d9 <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  8024c2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024c5:	8b 50 04             	mov    0x4(%eax),%edx
+  8024c8:	8b 00                	mov    (%eax),%eax
+  8024ca:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8024cd:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8024d0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024d3:	8d 40 08             	lea    0x8(%eax),%eax
+  8024d6:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  8024d9:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8024dc:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  8024df:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  8024e4:	85 c9                	test   %ecx,%ecx
+  8024e6:	0f 89 03 01 00 00    	jns    8025ef <vprintfmt+0x3bc>
+        putch('-', putdat);
+  8024ec:	83 ec 08             	sub    $0x8,%esp
+  8024ef:	53                   	push   %ebx
+  8024f0:	6a 2d                	push   $0x2d
+  8024f2:	ff d6                	call   *%esi
+        num = -(long long)num;
+  8024f4:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8024f7:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8024fa:	f7 da                	neg    %edx
+  8024fc:	83 d1 00             	adc    $0x0,%ecx
+  8024ff:	f7 d9                	neg    %ecx
+  802501:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  802504:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802509:	e9 e1 00 00 00       	jmp    8025ef <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  80250e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802511:	8b 00                	mov    (%eax),%eax
+  802513:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802516:	89 c1                	mov    %eax,%ecx
+  802518:	c1 f9 1f             	sar    $0x1f,%ecx
+  80251b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80251e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802521:	8d 40 04             	lea    0x4(%eax),%eax
+  802524:	89 45 14             	mov    %eax,0x14(%ebp)
+  802527:	eb b0                	jmp    8024d9 <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  802529:	83 f9 01             	cmp    $0x1,%ecx
+  80252c:	7f 1e                	jg     80254c <vprintfmt+0x319>
+  else if (lflag)
+  80252e:	85 c9                	test   %ecx,%ecx
+  802530:	74 32                	je     802564 <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  802532:	8b 45 14             	mov    0x14(%ebp),%eax
+  802535:	8b 10                	mov    (%eax),%edx
+  802537:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80253c:	8d 40 04             	lea    0x4(%eax),%eax
+  80253f:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  802542:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  802547:	e9 a3 00 00 00       	jmp    8025ef <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  80254c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80254f:	8b 10                	mov    (%eax),%edx
+  802551:	8b 48 04             	mov    0x4(%eax),%ecx
+  802554:	8d 40 08             	lea    0x8(%eax),%eax
+  802557:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  80255a:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  80255f:	e9 8b 00 00 00       	jmp    8025ef <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  802564:	8b 45 14             	mov    0x14(%ebp),%eax
+  802567:	8b 10                	mov    (%eax),%edx
+  802569:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80256e:	8d 40 04             	lea    0x4(%eax),%eax
+  802571:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  802574:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  802579:	eb 74                	jmp    8025ef <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  80257b:	83 f9 01             	cmp    $0x1,%ecx
+  80257e:	7f 1b                	jg     80259b <vprintfmt+0x368>
+  else if (lflag)
+  802580:	85 c9                	test   %ecx,%ecx
+  802582:	74 2c                	je     8025b0 <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  802584:	8b 45 14             	mov    0x14(%ebp),%eax
+  802587:	8b 10                	mov    (%eax),%edx
+  802589:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80258e:	8d 40 04             	lea    0x4(%eax),%eax
+  802591:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  802594:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  802599:	eb 54                	jmp    8025ef <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  80259b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80259e:	8b 10                	mov    (%eax),%edx
+  8025a0:	8b 48 04             	mov    0x4(%eax),%ecx
+  8025a3:	8d 40 08             	lea    0x8(%eax),%eax
+  8025a6:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8025a9:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  8025ae:	eb 3f                	jmp    8025ef <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8025b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8025b3:	8b 10                	mov    (%eax),%edx
+  8025b5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025ba:	8d 40 04             	lea    0x4(%eax),%eax
+  8025bd:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8025c0:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  8025c5:	eb 28                	jmp    8025ef <vprintfmt+0x3bc>
+      putch('0', putdat);
+  8025c7:	83 ec 08             	sub    $0x8,%esp
+  8025ca:	53                   	push   %ebx
+  8025cb:	6a 30                	push   $0x30
+  8025cd:	ff d6                	call   *%esi
+      putch('x', putdat);
+  8025cf:	83 c4 08             	add    $0x8,%esp
+  8025d2:	53                   	push   %ebx
+  8025d3:	6a 78                	push   $0x78
+  8025d5:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  8025d7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8025da:	8b 10                	mov    (%eax),%edx
+  8025dc:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  8025e1:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  8025e4:	8d 40 04             	lea    0x4(%eax),%eax
+  8025e7:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8025ea:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  8025ef:	83 ec 0c             	sub    $0xc,%esp
+  8025f2:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8025f6:	50                   	push   %eax
+  8025f7:	ff 75 e0             	push   -0x20(%ebp)
+  8025fa:	57                   	push   %edi
+  8025fb:	51                   	push   %ecx
+  8025fc:	52                   	push   %edx
+  8025fd:	89 da                	mov    %ebx,%edx
+  8025ff:	89 f0                	mov    %esi,%eax
+  802601:	e8 4a fb ff ff       	call   802150 <printnum>
+      break;
+  802606:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  802609:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  80260c:	e9 40 fc ff ff       	jmp    802251 <vprintfmt+0x1e>
+  if (lflag >= 2)
+  802611:	83 f9 01             	cmp    $0x1,%ecx
+  802614:	7f 1b                	jg     802631 <vprintfmt+0x3fe>
+  else if (lflag)
+  802616:	85 c9                	test   %ecx,%ecx
+  802618:	74 2c                	je     802646 <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  80261a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80261d:	8b 10                	mov    (%eax),%edx
+  80261f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802624:	8d 40 04             	lea    0x4(%eax),%eax
+  802627:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  80262a:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  80262f:	eb be                	jmp    8025ef <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  802631:	8b 45 14             	mov    0x14(%ebp),%eax
+  802634:	8b 10                	mov    (%eax),%edx
+  802636:	8b 48 04             	mov    0x4(%eax),%ecx
+  802639:	8d 40 08             	lea    0x8(%eax),%eax
+  80263c:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  80263f:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  802644:	eb a9                	jmp    8025ef <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  802646:	8b 45 14             	mov    0x14(%ebp),%eax
+  802649:	8b 10                	mov    (%eax),%edx
+  80264b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802650:	8d 40 04             	lea    0x4(%eax),%eax
+  802653:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  802656:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  80265b:	eb 92                	jmp    8025ef <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  80265d:	83 ec 08             	sub    $0x8,%esp
+  802660:	53                   	push   %ebx
+  802661:	6a 25                	push   $0x25
+  802663:	ff d6                	call   *%esi
+      break;
+  802665:	83 c4 10             	add    $0x10,%esp
+  802668:	eb 9f                	jmp    802609 <vprintfmt+0x3d6>
+      putch('%', putdat);
+  80266a:	83 ec 08             	sub    $0x8,%esp
+  80266d:	53                   	push   %ebx
+  80266e:	6a 25                	push   $0x25
+  802670:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  802672:	83 c4 10             	add    $0x10,%esp
+  802675:	89 f8                	mov    %edi,%eax
+  802677:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80267b:	74 05                	je     802682 <vprintfmt+0x44f>
+  80267d:	83 e8 01             	sub    $0x1,%eax
+  802680:	eb f5                	jmp    802677 <vprintfmt+0x444>
+  802682:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802685:	eb 82                	jmp    802609 <vprintfmt+0x3d6>
+
+00802687 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  802687:	55                   	push   %ebp
+  802688:	89 e5                	mov    %esp,%ebp
+  80268a:	83 ec 18             	sub    $0x18,%esp
+  80268d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802690:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  802693:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  802696:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80269a:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80269d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  8026a4:	85 c0                	test   %eax,%eax
+  8026a6:	74 26                	je     8026ce <vsnprintf+0x47>
+  8026a8:	85 d2                	test   %edx,%edx
+  8026aa:	7e 22                	jle    8026ce <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8026ac:	ff 75 14             	push   0x14(%ebp)
+  8026af:	ff 75 10             	push   0x10(%ebp)
+  8026b2:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8026b5:	50                   	push   %eax
+  8026b6:	68 f9 21 80 00       	push   $0x8021f9
+  8026bb:	e8 73 fb ff ff       	call   802233 <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  8026c0:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8026c3:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  8026c6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026c9:	83 c4 10             	add    $0x10,%esp
+}
+  8026cc:	c9                   	leave
+  8026cd:	c3                   	ret
+    return -E_INVAL;
+  8026ce:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026d3:	eb f7                	jmp    8026cc <vsnprintf+0x45>
+
+008026d5 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8026d5:	55                   	push   %ebp
+  8026d6:	89 e5                	mov    %esp,%ebp
+  8026d8:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  8026db:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  8026de:	50                   	push   %eax
+  8026df:	ff 75 10             	push   0x10(%ebp)
+  8026e2:	ff 75 0c             	push   0xc(%ebp)
+  8026e5:	ff 75 08             	push   0x8(%ebp)
+  8026e8:	e8 9a ff ff ff       	call   802687 <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  8026ed:	c9                   	leave
+  8026ee:	c3                   	ret
+
+008026ef <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8026ef:	55                   	push   %ebp
+  8026f0:	89 e5                	mov    %esp,%ebp
+  8026f2:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  8026f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026fa:	eb 03                	jmp    8026ff <strlen+0x10>
+    n++;
+  8026fc:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  8026ff:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  802703:	75 f7                	jne    8026fc <strlen+0xd>
+  return n;
+}
+  802705:	5d                   	pop    %ebp
+  802706:	c3                   	ret
+
+00802707 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  802707:	55                   	push   %ebp
+  802708:	89 e5                	mov    %esp,%ebp
+  80270a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80270d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802710:	b8 00 00 00 00       	mov    $0x0,%eax
+  802715:	eb 03                	jmp    80271a <strnlen+0x13>
+    n++;
+  802717:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80271a:	39 d0                	cmp    %edx,%eax
+  80271c:	74 08                	je     802726 <strnlen+0x1f>
+  80271e:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  802722:	75 f3                	jne    802717 <strnlen+0x10>
+  802724:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  802726:	89 d0                	mov    %edx,%eax
+  802728:	5d                   	pop    %ebp
+  802729:	c3                   	ret
+
+0080272a <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80272a:	55                   	push   %ebp
+  80272b:	89 e5                	mov    %esp,%ebp
+  80272d:	53                   	push   %ebx
+  80272e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802731:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  802734:	b8 00 00 00 00       	mov    $0x0,%eax
+  802739:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80273d:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  802740:	83 c0 01             	add    $0x1,%eax
+  802743:	84 d2                	test   %dl,%dl
+  802745:	75 f2                	jne    802739 <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  802747:	89 c8                	mov    %ecx,%eax
+  802749:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80274c:	c9                   	leave
+  80274d:	c3                   	ret
+
+0080274e <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80274e:	55                   	push   %ebp
+  80274f:	89 e5                	mov    %esp,%ebp
+  802751:	53                   	push   %ebx
+  802752:	83 ec 10             	sub    $0x10,%esp
+  802755:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  802758:	53                   	push   %ebx
+  802759:	e8 91 ff ff ff       	call   8026ef <strlen>
+  80275e:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  802761:	ff 75 0c             	push   0xc(%ebp)
+  802764:	01 d8                	add    %ebx,%eax
+  802766:	50                   	push   %eax
+  802767:	e8 be ff ff ff       	call   80272a <strcpy>
+  return dst;
+}
+  80276c:	89 d8                	mov    %ebx,%eax
+  80276e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802771:	c9                   	leave
+  802772:	c3                   	ret
+
+00802773 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  802773:	55                   	push   %ebp
+  802774:	89 e5                	mov    %esp,%ebp
+  802776:	56                   	push   %esi
+  802777:	53                   	push   %ebx
+  802778:	8b 75 08             	mov    0x8(%ebp),%esi
+  80277b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  80277e:	89 f3                	mov    %esi,%ebx
+  802780:	03 5d 10             	add    0x10(%ebp),%ebx
+  802783:	89 f0                	mov    %esi,%eax
+  802785:	eb 0f                	jmp    802796 <strncpy+0x23>
+    *dst++ = *src;
+  802787:	83 c0 01             	add    $0x1,%eax
+  80278a:	0f b6 0a             	movzbl (%edx),%ecx
+  80278d:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  802790:	80 f9 01             	cmp    $0x1,%cl
+  802793:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  802796:	39 d8                	cmp    %ebx,%eax
+  802798:	75 ed                	jne    802787 <strncpy+0x14>
+  }
+  return ret;
+}
+  80279a:	89 f0                	mov    %esi,%eax
+  80279c:	5b                   	pop    %ebx
+  80279d:	5e                   	pop    %esi
+  80279e:	5d                   	pop    %ebp
+  80279f:	c3                   	ret
+
+008027a0 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8027a0:	55                   	push   %ebp
+  8027a1:	89 e5                	mov    %esp,%ebp
+  8027a3:	56                   	push   %esi
+  8027a4:	53                   	push   %ebx
+  8027a5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8027a8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8027ab:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  8027ae:	89 f0                	mov    %esi,%eax
+  8027b0:	85 d2                	test   %edx,%edx
+  8027b2:	74 21                	je     8027d5 <strlcpy+0x35>
+  8027b4:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8027b8:	89 f2                	mov    %esi,%edx
+  8027ba:	eb 09                	jmp    8027c5 <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  8027bc:	83 c1 01             	add    $0x1,%ecx
+  8027bf:	83 c2 01             	add    $0x1,%edx
+  8027c2:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  8027c5:	39 c2                	cmp    %eax,%edx
+  8027c7:	74 09                	je     8027d2 <strlcpy+0x32>
+  8027c9:	0f b6 19             	movzbl (%ecx),%ebx
+  8027cc:	84 db                	test   %bl,%bl
+  8027ce:	75 ec                	jne    8027bc <strlcpy+0x1c>
+  8027d0:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  8027d2:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  8027d5:	29 f0                	sub    %esi,%eax
+}
+  8027d7:	5b                   	pop    %ebx
+  8027d8:	5e                   	pop    %esi
+  8027d9:	5d                   	pop    %ebp
+  8027da:	c3                   	ret
+
+008027db <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8027db:	55                   	push   %ebp
+  8027dc:	89 e5                	mov    %esp,%ebp
+  8027de:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8027e1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  8027e4:	eb 06                	jmp    8027ec <strcmp+0x11>
+    p++, q++;
+  8027e6:	83 c1 01             	add    $0x1,%ecx
+  8027e9:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  8027ec:	0f b6 01             	movzbl (%ecx),%eax
+  8027ef:	84 c0                	test   %al,%al
+  8027f1:	74 04                	je     8027f7 <strcmp+0x1c>
+  8027f3:	3a 02                	cmp    (%edx),%al
+  8027f5:	74 ef                	je     8027e6 <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  8027f7:	0f b6 c0             	movzbl %al,%eax
+  8027fa:	0f b6 12             	movzbl (%edx),%edx
+  8027fd:	29 d0                	sub    %edx,%eax
+}
+  8027ff:	5d                   	pop    %ebp
+  802800:	c3                   	ret
+
+00802801 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  802801:	55                   	push   %ebp
+  802802:	89 e5                	mov    %esp,%ebp
+  802804:	53                   	push   %ebx
+  802805:	8b 45 08             	mov    0x8(%ebp),%eax
+  802808:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80280b:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  80280e:	eb 09                	jmp    802819 <strncmp+0x18>
+    n--, p++, q++;
+  802810:	83 ea 01             	sub    $0x1,%edx
+  802813:	83 c0 01             	add    $0x1,%eax
+  802816:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  802819:	85 d2                	test   %edx,%edx
+  80281b:	74 18                	je     802835 <strncmp+0x34>
+  80281d:	0f b6 18             	movzbl (%eax),%ebx
+  802820:	84 db                	test   %bl,%bl
+  802822:	74 04                	je     802828 <strncmp+0x27>
+  802824:	3a 19                	cmp    (%ecx),%bl
+  802826:	74 e8                	je     802810 <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802828:	0f b6 00             	movzbl (%eax),%eax
+  80282b:	0f b6 11             	movzbl (%ecx),%edx
+  80282e:	29 d0                	sub    %edx,%eax
+}
+  802830:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802833:	c9                   	leave
+  802834:	c3                   	ret
+    return 0;
+  802835:	b8 00 00 00 00       	mov    $0x0,%eax
+  80283a:	eb f4                	jmp    802830 <strncmp+0x2f>
+
+0080283c <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80283c:	55                   	push   %ebp
+  80283d:	89 e5                	mov    %esp,%ebp
+  80283f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802842:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  802846:	eb 03                	jmp    80284b <strchr+0xf>
+  802848:	83 c0 01             	add    $0x1,%eax
+  80284b:	0f b6 10             	movzbl (%eax),%edx
+  80284e:	84 d2                	test   %dl,%dl
+  802850:	74 06                	je     802858 <strchr+0x1c>
+    if (*s == c)
+  802852:	38 ca                	cmp    %cl,%dl
+  802854:	75 f2                	jne    802848 <strchr+0xc>
+  802856:	eb 05                	jmp    80285d <strchr+0x21>
+      return (char*)s;
+  return 0;
+  802858:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80285d:	5d                   	pop    %ebp
+  80285e:	c3                   	ret
+
+0080285f <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80285f:	55                   	push   %ebp
+  802860:	89 e5                	mov    %esp,%ebp
+  802862:	8b 45 08             	mov    0x8(%ebp),%eax
+  802865:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  802869:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  80286c:	38 ca                	cmp    %cl,%dl
+  80286e:	74 09                	je     802879 <strfind+0x1a>
+  802870:	84 d2                	test   %dl,%dl
+  802872:	74 05                	je     802879 <strfind+0x1a>
+  for (; *s; s++)
+  802874:	83 c0 01             	add    $0x1,%eax
+  802877:	eb f0                	jmp    802869 <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  802879:	5d                   	pop    %ebp
+  80287a:	c3                   	ret
+
+0080287b <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  80287b:	55                   	push   %ebp
+  80287c:	89 e5                	mov    %esp,%ebp
+  80287e:	57                   	push   %edi
+  80287f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802882:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  802885:	85 c9                	test   %ecx,%ecx
+  802887:	74 20                	je     8028a9 <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  802889:	89 f8                	mov    %edi,%eax
+  80288b:	09 c8                	or     %ecx,%eax
+  80288d:	a8 03                	test   $0x3,%al
+  80288f:	75 12                	jne    8028a3 <memset+0x28>
+    c &= 0xFF;
+  802891:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  802895:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  80289b:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  80289e:	fc                   	cld
+  80289f:	f3 ab                	rep stos %eax,%es:(%edi)
+  8028a1:	eb 06                	jmp    8028a9 <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  8028a3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8028a6:	fc                   	cld
+  8028a7:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  8028a9:	89 f8                	mov    %edi,%eax
+  8028ab:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8028ae:	c9                   	leave
+  8028af:	c3                   	ret
+
+008028b0 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8028b0:	55                   	push   %ebp
+  8028b1:	89 e5                	mov    %esp,%ebp
+  8028b3:	57                   	push   %edi
+  8028b4:	56                   	push   %esi
+  8028b5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028b8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8028bb:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  8028be:	39 c6                	cmp    %eax,%esi
+  8028c0:	73 32                	jae    8028f4 <memmove+0x44>
+  8028c2:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8028c5:	39 d0                	cmp    %edx,%eax
+  8028c7:	73 2b                	jae    8028f4 <memmove+0x44>
+    s += n;
+    d += n;
+  8028c9:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8028cc:	89 d6                	mov    %edx,%esi
+  8028ce:	09 fe                	or     %edi,%esi
+  8028d0:	09 ce                	or     %ecx,%esi
+  8028d2:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8028d8:	75 0e                	jne    8028e8 <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8028da:	83 ef 04             	sub    $0x4,%edi
+  8028dd:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8028e0:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  8028e3:	fd                   	std
+  8028e4:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8028e6:	eb 09                	jmp    8028f1 <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8028e8:	83 ef 01             	sub    $0x1,%edi
+  8028eb:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  8028ee:	fd                   	std
+  8028ef:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  8028f1:	fc                   	cld
+  8028f2:	eb 1a                	jmp    80290e <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8028f4:	89 f2                	mov    %esi,%edx
+  8028f6:	09 c2                	or     %eax,%edx
+  8028f8:	09 ca                	or     %ecx,%edx
+  8028fa:	f6 c2 03             	test   $0x3,%dl
+  8028fd:	75 0a                	jne    802909 <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8028ff:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  802902:	89 c7                	mov    %eax,%edi
+  802904:	fc                   	cld
+  802905:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  802907:	eb 05                	jmp    80290e <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  802909:	89 c7                	mov    %eax,%edi
+  80290b:	fc                   	cld
+  80290c:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  80290e:	5e                   	pop    %esi
+  80290f:	5f                   	pop    %edi
+  802910:	5d                   	pop    %ebp
+  802911:	c3                   	ret
+
+00802912 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  802912:	55                   	push   %ebp
+  802913:	89 e5                	mov    %esp,%ebp
+  802915:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  802918:	ff 75 10             	push   0x10(%ebp)
+  80291b:	ff 75 0c             	push   0xc(%ebp)
+  80291e:	ff 75 08             	push   0x8(%ebp)
+  802921:	e8 8a ff ff ff       	call   8028b0 <memmove>
+}
+  802926:	c9                   	leave
+  802927:	c3                   	ret
+
+00802928 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  802928:	55                   	push   %ebp
+  802929:	89 e5                	mov    %esp,%ebp
+  80292b:	56                   	push   %esi
+  80292c:	53                   	push   %ebx
+  80292d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802930:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  802933:	89 c6                	mov    %eax,%esi
+  802935:	03 75 10             	add    0x10(%ebp),%esi
+  802938:	eb 06                	jmp    802940 <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  80293a:	83 c0 01             	add    $0x1,%eax
+  80293d:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  802940:	39 f0                	cmp    %esi,%eax
+  802942:	74 14                	je     802958 <memcmp+0x30>
+    if (*s1 != *s2)
+  802944:	0f b6 08             	movzbl (%eax),%ecx
+  802947:	0f b6 1a             	movzbl (%edx),%ebx
+  80294a:	38 d9                	cmp    %bl,%cl
+  80294c:	74 ec                	je     80293a <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  80294e:	0f b6 c1             	movzbl %cl,%eax
+  802951:	0f b6 db             	movzbl %bl,%ebx
+  802954:	29 d8                	sub    %ebx,%eax
+  802956:	eb 05                	jmp    80295d <memcmp+0x35>
+  }
+
+  return 0;
+  802958:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80295d:	5b                   	pop    %ebx
+  80295e:	5e                   	pop    %esi
+  80295f:	5d                   	pop    %ebp
+  802960:	c3                   	ret
+
+00802961 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  802961:	55                   	push   %ebp
+  802962:	89 e5                	mov    %esp,%ebp
+  802964:	8b 45 08             	mov    0x8(%ebp),%eax
+  802967:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  80296a:	89 c2                	mov    %eax,%edx
+  80296c:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  80296f:	eb 03                	jmp    802974 <memfind+0x13>
+  802971:	83 c0 01             	add    $0x1,%eax
+  802974:	39 d0                	cmp    %edx,%eax
+  802976:	73 04                	jae    80297c <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  802978:	38 08                	cmp    %cl,(%eax)
+  80297a:	75 f5                	jne    802971 <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  80297c:	5d                   	pop    %ebp
+  80297d:	c3                   	ret
+
+0080297e <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  80297e:	55                   	push   %ebp
+  80297f:	89 e5                	mov    %esp,%ebp
+  802981:	57                   	push   %edi
+  802982:	56                   	push   %esi
+  802983:	53                   	push   %ebx
+  802984:	8b 55 08             	mov    0x8(%ebp),%edx
+  802987:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  80298a:	eb 03                	jmp    80298f <strtol+0x11>
+    s++;
+  80298c:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  80298f:	0f b6 02             	movzbl (%edx),%eax
+  802992:	3c 20                	cmp    $0x20,%al
+  802994:	74 f6                	je     80298c <strtol+0xe>
+  802996:	3c 09                	cmp    $0x9,%al
+  802998:	74 f2                	je     80298c <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  80299a:	3c 2b                	cmp    $0x2b,%al
+  80299c:	74 2a                	je     8029c8 <strtol+0x4a>
+  int neg = 0;
+  80299e:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  8029a3:	3c 2d                	cmp    $0x2d,%al
+  8029a5:	74 2b                	je     8029d2 <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8029a7:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8029ad:	75 0f                	jne    8029be <strtol+0x40>
+  8029af:	80 3a 30             	cmpb   $0x30,(%edx)
+  8029b2:	74 28                	je     8029dc <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  8029b4:	85 db                	test   %ebx,%ebx
+  8029b6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8029bb:	0f 44 d8             	cmove  %eax,%ebx
+  8029be:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8029c3:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8029c6:	eb 46                	jmp    802a0e <strtol+0x90>
+    s++;
+  8029c8:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  8029cb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029d0:	eb d5                	jmp    8029a7 <strtol+0x29>
+    s++, neg = 1;
+  8029d2:	83 c2 01             	add    $0x1,%edx
+  8029d5:	bf 01 00 00 00       	mov    $0x1,%edi
+  8029da:	eb cb                	jmp    8029a7 <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8029dc:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8029e0:	74 0e                	je     8029f0 <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  8029e2:	85 db                	test   %ebx,%ebx
+  8029e4:	75 d8                	jne    8029be <strtol+0x40>
+    s++, base = 8;
+  8029e6:	83 c2 01             	add    $0x1,%edx
+  8029e9:	bb 08 00 00 00       	mov    $0x8,%ebx
+  8029ee:	eb ce                	jmp    8029be <strtol+0x40>
+    s += 2, base = 16;
+  8029f0:	83 c2 02             	add    $0x2,%edx
+  8029f3:	bb 10 00 00 00       	mov    $0x10,%ebx
+  8029f8:	eb c4                	jmp    8029be <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  8029fa:	0f be c0             	movsbl %al,%eax
+  8029fd:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  802a00:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802a03:	7d 3a                	jge    802a3f <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  802a05:	83 c2 01             	add    $0x1,%edx
+  802a08:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  802a0c:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  802a0e:	0f b6 02             	movzbl (%edx),%eax
+  802a11:	8d 70 d0             	lea    -0x30(%eax),%esi
+  802a14:	89 f3                	mov    %esi,%ebx
+  802a16:	80 fb 09             	cmp    $0x9,%bl
+  802a19:	76 df                	jbe    8029fa <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  802a1b:	8d 70 9f             	lea    -0x61(%eax),%esi
+  802a1e:	89 f3                	mov    %esi,%ebx
+  802a20:	80 fb 19             	cmp    $0x19,%bl
+  802a23:	77 08                	ja     802a2d <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  802a25:	0f be c0             	movsbl %al,%eax
+  802a28:	83 e8 57             	sub    $0x57,%eax
+  802a2b:	eb d3                	jmp    802a00 <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  802a2d:	8d 70 bf             	lea    -0x41(%eax),%esi
+  802a30:	89 f3                	mov    %esi,%ebx
+  802a32:	80 fb 19             	cmp    $0x19,%bl
+  802a35:	77 08                	ja     802a3f <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  802a37:	0f be c0             	movsbl %al,%eax
+  802a3a:	83 e8 37             	sub    $0x37,%eax
+  802a3d:	eb c1                	jmp    802a00 <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  802a3f:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802a43:	74 05                	je     802a4a <strtol+0xcc>
+    *endptr = (char*)s;
+  802a45:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a48:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  802a4a:	89 c8                	mov    %ecx,%eax
+  802a4c:	f7 d8                	neg    %eax
+  802a4e:	85 ff                	test   %edi,%edi
+  802a50:	0f 45 c8             	cmovne %eax,%ecx
+}
+  802a53:	89 c8                	mov    %ecx,%eax
+  802a55:	5b                   	pop    %ebx
+  802a56:	5e                   	pop    %esi
+  802a57:	5f                   	pop    %edi
+  802a58:	5d                   	pop    %ebp
+  802a59:	c3                   	ret
+
+00802a5a <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  802a5a:	55                   	push   %ebp
+  802a5b:	89 e5                	mov    %esp,%ebp
+  802a5d:	57                   	push   %edi
+  802a5e:	56                   	push   %esi
+  802a5f:	53                   	push   %ebx
+  802a60:	83 ec 14             	sub    $0x14,%esp
+  802a63:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802a66:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a69:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802a6c:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  802a6f:	85 c0                	test   %eax,%eax
+  802a71:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802a76:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  802a79:	ff 33                	push   (%ebx)
+  802a7b:	50                   	push   %eax
+  802a7c:	e8 f8 d9 ff ff       	call   800479 <sys_ipc_recv>
+  802a81:	83 c4 10             	add    $0x10,%esp
+  802a84:	85 c0                	test   %eax,%eax
+  802a86:	78 39                	js     802ac1 <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  802a88:	85 ff                	test   %edi,%edi
+  802a8a:	74 0a                	je     802a96 <ipc_recv_pages+0x3c>
+  802a8c:	a1 44 57 80 00       	mov    0x805744,%eax
+  802a91:	8b 40 7c             	mov    0x7c(%eax),%eax
+  802a94:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  802a96:	85 f6                	test   %esi,%esi
+  802a98:	74 0d                	je     802aa7 <ipc_recv_pages+0x4d>
+  802a9a:	a1 44 57 80 00       	mov    0x805744,%eax
+  802a9f:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  802aa5:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  802aa7:	a1 44 57 80 00       	mov    0x805744,%eax
+  802aac:	8b 40 74             	mov    0x74(%eax),%eax
+  802aaf:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  802ab1:	a1 44 57 80 00       	mov    0x805744,%eax
+  802ab6:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  802ab9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802abc:	5b                   	pop    %ebx
+  802abd:	5e                   	pop    %esi
+  802abe:	5f                   	pop    %edi
+  802abf:	5d                   	pop    %ebp
+  802ac0:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  802ac1:	85 ff                	test   %edi,%edi
+  802ac3:	74 06                	je     802acb <ipc_recv_pages+0x71>
+  802ac5:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  802acb:	85 f6                	test   %esi,%esi
+  802acd:	74 06                	je     802ad5 <ipc_recv_pages+0x7b>
+  802acf:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  802ad5:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  802adb:	eb dc                	jmp    802ab9 <ipc_recv_pages+0x5f>
+
+00802add <ipc_recv>:
+{
+  802add:	55                   	push   %ebp
+  802ade:	89 e5                	mov    %esp,%ebp
+  802ae0:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  802ae3:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  802aea:	ff 75 10             	push   0x10(%ebp)
+  802aed:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802af0:	50                   	push   %eax
+  802af1:	ff 75 0c             	push   0xc(%ebp)
+  802af4:	ff 75 08             	push   0x8(%ebp)
+  802af7:	e8 5e ff ff ff       	call   802a5a <ipc_recv_pages>
+}
+  802afc:	c9                   	leave
+  802afd:	c3                   	ret
+
+00802afe <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  802afe:	55                   	push   %ebp
+  802aff:	89 e5                	mov    %esp,%ebp
+  802b01:	57                   	push   %edi
+  802b02:	56                   	push   %esi
+  802b03:	53                   	push   %ebx
+  802b04:	83 ec 0c             	sub    $0xc,%esp
+  802b07:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802b0a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802b0d:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  802b10:	89 c3                	mov    %eax,%ebx
+  802b12:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  802b18:	85 c0                	test   %eax,%eax
+  802b1a:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802b1f:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  802b22:	83 ec 0c             	sub    $0xc,%esp
+  802b25:	ff 75 14             	push   0x14(%ebp)
+  802b28:	ff 75 18             	push   0x18(%ebp)
+  802b2b:	53                   	push   %ebx
+  802b2c:	56                   	push   %esi
+  802b2d:	57                   	push   %edi
+  802b2e:	e8 25 d9 ff ff       	call   800458 <sys_ipc_try_send>
+  802b33:	83 c4 20             	add    $0x20,%esp
+  802b36:	85 c0                	test   %eax,%eax
+  802b38:	79 1e                	jns    802b58 <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  802b3a:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802b3d:	75 07                	jne    802b46 <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  802b3f:	e8 fb d5 ff ff       	call   80013f <sys_yield>
+  802b44:	eb dc                	jmp    802b22 <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  802b46:	50                   	push   %eax
+  802b47:	68 c3 32 80 00       	push   $0x8032c3
+  802b4c:	6a 5c                	push   $0x5c
+  802b4e:	68 d0 32 80 00       	push   $0x8032d0
+  802b53:	e8 09 f5 ff ff       	call   802061 <_panic>
+  }
+}
+  802b58:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b5b:	5b                   	pop    %ebx
+  802b5c:	5e                   	pop    %esi
+  802b5d:	5f                   	pop    %edi
+  802b5e:	5d                   	pop    %ebp
+  802b5f:	c3                   	ret
+
+00802b60 <ipc_send>:
+{
+  802b60:	55                   	push   %ebp
+  802b61:	89 e5                	mov    %esp,%ebp
+  802b63:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  802b66:	ff 75 14             	push   0x14(%ebp)
+  802b69:	6a 01                	push   $0x1
+  802b6b:	ff 75 10             	push   0x10(%ebp)
+  802b6e:	ff 75 0c             	push   0xc(%ebp)
+  802b71:	ff 75 08             	push   0x8(%ebp)
+  802b74:	e8 85 ff ff ff       	call   802afe <ipc_send_pages>
+}
+  802b79:	83 c4 20             	add    $0x20,%esp
+  802b7c:	c9                   	leave
+  802b7d:	c3                   	ret
+
+00802b7e <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802b7e:	55                   	push   %ebp
+  802b7f:	89 e5                	mov    %esp,%ebp
+  802b81:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  802b84:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  802b89:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802b8c:	c1 e0 04             	shl    $0x4,%eax
+  802b8f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802b94:	8b 40 50             	mov    0x50(%eax),%eax
+  802b97:	39 c8                	cmp    %ecx,%eax
+  802b99:	74 12                	je     802bad <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  802b9b:	83 c2 01             	add    $0x1,%edx
+  802b9e:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802ba4:	75 e3                	jne    802b89 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  802ba6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bab:	eb 0e                	jmp    802bbb <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  802bad:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802bb0:	c1 e0 04             	shl    $0x4,%eax
+  802bb3:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802bb8:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802bbb:	5d                   	pop    %ebp
+  802bbc:	c3                   	ret
+
+00802bbd <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802bbd:	55                   	push   %ebp
+  802bbe:	89 e5                	mov    %esp,%ebp
+  802bc0:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802bc3:	89 c2                	mov    %eax,%edx
+  802bc5:	c1 ea 16             	shr    $0x16,%edx
+  802bc8:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  802bcf:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802bd4:	f6 c1 01             	test   $0x1,%cl
+  802bd7:	74 1c                	je     802bf5 <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  802bd9:	c1 e8 0c             	shr    $0xc,%eax
+  802bdc:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  802be3:	a8 01                	test   $0x1,%al
+  802be5:	74 0e                	je     802bf5 <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  802be7:	c1 e8 0c             	shr    $0xc,%eax
+  802bea:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802bf1:	ef 
+  802bf2:	0f b7 d2             	movzwl %dx,%edx
+}
+  802bf5:	89 d0                	mov    %edx,%eax
+  802bf7:	5d                   	pop    %ebp
+  802bf8:	c3                   	ret
+
+00802bf9 <udivmod>:
+  802bf9:	55                   	push   %ebp
+  802bfa:	57                   	push   %edi
+  802bfb:	56                   	push   %esi
+  802bfc:	53                   	push   %ebx
+  802bfd:	83 ec 14             	sub    $0x14,%esp
+  802c00:	8b 74 24 28          	mov    0x28(%esp),%esi
+  802c04:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  802c08:	89 fb                	mov    %edi,%ebx
+  802c0a:	09 f3                	or     %esi,%ebx
+  802c0c:	0f 84 88 00 00 00    	je     802c9a <udivmod+0xa1>
+  802c12:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802c17:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802c1e:	00 
+  802c1f:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802c26:	00 
+  802c27:	89 cd                	mov    %ecx,%ebp
+  802c29:	89 34 24             	mov    %esi,(%esp)
+  802c2c:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802c30:	eb 08                	jmp    802c3a <udivmod+0x41>
+  802c32:	83 ed 01             	sub    $0x1,%ebp
+  802c35:	83 fd ff             	cmp    $0xffffffff,%ebp
+  802c38:	74 6c                	je     802ca6 <udivmod+0xad>
+  802c3a:	89 c3                	mov    %eax,%ebx
+  802c3c:	89 d6                	mov    %edx,%esi
+  802c3e:	89 e9                	mov    %ebp,%ecx
+  802c40:	0f ad f3             	shrd   %cl,%esi,%ebx
+  802c43:	d3 ee                	shr    %cl,%esi
+  802c45:	f6 c1 20             	test   $0x20,%cl
+  802c48:	74 04                	je     802c4e <udivmod+0x55>
+  802c4a:	89 f3                	mov    %esi,%ebx
+  802c4c:	31 f6                	xor    %esi,%esi
+  802c4e:	8b 3c 24             	mov    (%esp),%edi
+  802c51:	39 fb                	cmp    %edi,%ebx
+  802c53:	89 f7                	mov    %esi,%edi
+  802c55:	8b 1c 24             	mov    (%esp),%ebx
+  802c58:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802c5c:	19 f7                	sbb    %esi,%edi
+  802c5e:	72 d2                	jb     802c32 <udivmod+0x39>
+  802c60:	89 f7                	mov    %esi,%edi
+  802c62:	89 de                	mov    %ebx,%esi
+  802c64:	89 e9                	mov    %ebp,%ecx
+  802c66:	0f a5 f7             	shld   %cl,%esi,%edi
+  802c69:	d3 e6                	shl    %cl,%esi
+  802c6b:	f6 c1 20             	test   $0x20,%cl
+  802c6e:	74 04                	je     802c74 <udivmod+0x7b>
+  802c70:	89 f7                	mov    %esi,%edi
+  802c72:	31 f6                	xor    %esi,%esi
+  802c74:	29 f0                	sub    %esi,%eax
+  802c76:	19 fa                	sbb    %edi,%edx
+  802c78:	be 01 00 00 00       	mov    $0x1,%esi
+  802c7d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c82:	0f a5 f7             	shld   %cl,%esi,%edi
+  802c85:	d3 e6                	shl    %cl,%esi
+  802c87:	f6 c1 20             	test   $0x20,%cl
+  802c8a:	74 04                	je     802c90 <udivmod+0x97>
+  802c8c:	89 f7                	mov    %esi,%edi
+  802c8e:	31 f6                	xor    %esi,%esi
+  802c90:	09 74 24 08          	or     %esi,0x8(%esp)
+  802c94:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802c98:	eb 98                	jmp    802c32 <udivmod+0x39>
+  802c9a:	89 f0                	mov    %esi,%eax
+  802c9c:	89 fa                	mov    %edi,%edx
+  802c9e:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802ca2:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802ca6:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802caa:	89 01                	mov    %eax,(%ecx)
+  802cac:	89 51 04             	mov    %edx,0x4(%ecx)
+  802caf:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802cb3:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802cb7:	83 c4 14             	add    $0x14,%esp
+  802cba:	5b                   	pop    %ebx
+  802cbb:	5e                   	pop    %esi
+  802cbc:	5f                   	pop    %edi
+  802cbd:	5d                   	pop    %ebp
+  802cbe:	c3                   	ret
+
+00802cbf <__udivdi3>:
+  802cbf:	83 ec 18             	sub    $0x18,%esp
+  802cc2:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802cc6:	50                   	push   %eax
+  802cc7:	ff 74 24 2c          	push   0x2c(%esp)
+  802ccb:	ff 74 24 2c          	push   0x2c(%esp)
+  802ccf:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802cd3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802cd7:	e8 1d ff ff ff       	call   802bf9 <udivmod>
+  802cdc:	83 c4 24             	add    $0x24,%esp
+  802cdf:	c3                   	ret
+
+00802ce0 <__umoddi3>:
+  802ce0:	83 ec 18             	sub    $0x18,%esp
+  802ce3:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802ce7:	50                   	push   %eax
+  802ce8:	ff 74 24 2c          	push   0x2c(%esp)
+  802cec:	ff 74 24 2c          	push   0x2c(%esp)
+  802cf0:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802cf4:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802cf8:	e8 fc fe ff ff       	call   802bf9 <udivmod>
+  802cfd:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802d01:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802d05:	83 c4 24             	add    $0x24,%esp
+  802d08:	c3                   	ret
+
+00802d09 <__divdi3>:
+  802d09:	56                   	push   %esi
+  802d0a:	53                   	push   %ebx
+  802d0b:	83 ec 14             	sub    $0x14,%esp
+  802d0e:	8b 44 24 20          	mov    0x20(%esp),%eax
+  802d12:	8b 54 24 24          	mov    0x24(%esp),%edx
+  802d16:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  802d1a:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  802d1e:	85 d2                	test   %edx,%edx
+  802d20:	78 18                	js     802d3a <__divdi3+0x31>
+  802d22:	85 db                	test   %ebx,%ebx
+  802d24:	78 3e                	js     802d64 <__divdi3+0x5b>
+  802d26:	83 ec 04             	sub    $0x4,%esp
+  802d29:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802d2d:	56                   	push   %esi
+  802d2e:	53                   	push   %ebx
+  802d2f:	51                   	push   %ecx
+  802d30:	e8 c4 fe ff ff       	call   802bf9 <udivmod>
+  802d35:	83 c4 10             	add    $0x10,%esp
+  802d38:	eb 24                	jmp    802d5e <__divdi3+0x55>
+  802d3a:	f7 d8                	neg    %eax
+  802d3c:	83 d2 00             	adc    $0x0,%edx
+  802d3f:	f7 da                	neg    %edx
+  802d41:	85 db                	test   %ebx,%ebx
+  802d43:	78 3a                	js     802d7f <__divdi3+0x76>
+  802d45:	83 ec 04             	sub    $0x4,%esp
+  802d48:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802d4c:	56                   	push   %esi
+  802d4d:	53                   	push   %ebx
+  802d4e:	51                   	push   %ecx
+  802d4f:	e8 a5 fe ff ff       	call   802bf9 <udivmod>
+  802d54:	83 c4 10             	add    $0x10,%esp
+  802d57:	f7 d8                	neg    %eax
+  802d59:	83 d2 00             	adc    $0x0,%edx
+  802d5c:	f7 da                	neg    %edx
+  802d5e:	83 c4 14             	add    $0x14,%esp
+  802d61:	5b                   	pop    %ebx
+  802d62:	5e                   	pop    %esi
+  802d63:	c3                   	ret
+  802d64:	83 ec 04             	sub    $0x4,%esp
+  802d67:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802d6b:	56                   	push   %esi
+  802d6c:	f7 d9                	neg    %ecx
+  802d6e:	83 d3 00             	adc    $0x0,%ebx
+  802d71:	f7 db                	neg    %ebx
+  802d73:	53                   	push   %ebx
+  802d74:	51                   	push   %ecx
+  802d75:	e8 7f fe ff ff       	call   802bf9 <udivmod>
+  802d7a:	83 c4 10             	add    $0x10,%esp
+  802d7d:	eb d8                	jmp    802d57 <__divdi3+0x4e>
+  802d7f:	83 ec 04             	sub    $0x4,%esp
+  802d82:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802d86:	56                   	push   %esi
+  802d87:	f7 d9                	neg    %ecx
+  802d89:	83 d3 00             	adc    $0x0,%ebx
+  802d8c:	f7 db                	neg    %ebx
+  802d8e:	53                   	push   %ebx
+  802d8f:	51                   	push   %ecx
+  802d90:	e8 64 fe ff ff       	call   802bf9 <udivmod>
+  802d95:	83 c4 10             	add    $0x10,%esp
+  802d98:	eb c4                	jmp    802d5e <__divdi3+0x55>
+
+00802d9a <__moddi3>:
+  802d9a:	55                   	push   %ebp
+  802d9b:	57                   	push   %edi
+  802d9c:	56                   	push   %esi
+  802d9d:	53                   	push   %ebx
+  802d9e:	83 ec 24             	sub    $0x24,%esp
+  802da1:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802da5:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802da9:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  802dad:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  802db1:	85 d2                	test   %edx,%edx
+  802db3:	78 3b                	js     802df0 <__moddi3+0x56>
+  802db5:	83 ec 04             	sub    $0x4,%esp
+  802db8:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  802dbc:	56                   	push   %esi
+  802dbd:	89 ce                	mov    %ecx,%esi
+  802dbf:	f7 de                	neg    %esi
+  802dc1:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802dc5:	89 de                	mov    %ebx,%esi
+  802dc7:	83 d6 00             	adc    $0x0,%esi
+  802dca:	f7 de                	neg    %esi
+  802dcc:	89 74 24 14          	mov    %esi,0x14(%esp)
+  802dd0:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802dd4:	0f 48 f1             	cmovs  %ecx,%esi
+  802dd7:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  802ddc:	53                   	push   %ebx
+  802ddd:	56                   	push   %esi
+  802dde:	e8 16 fe ff ff       	call   802bf9 <udivmod>
+  802de3:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802de7:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802deb:	83 c4 10             	add    $0x10,%esp
+  802dee:	eb 47                	jmp    802e37 <__moddi3+0x9d>
+  802df0:	f7 d8                	neg    %eax
+  802df2:	83 d2 00             	adc    $0x0,%edx
+  802df5:	f7 da                	neg    %edx
+  802df7:	83 ec 04             	sub    $0x4,%esp
+  802dfa:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  802dfe:	56                   	push   %esi
+  802dff:	89 cf                	mov    %ecx,%edi
+  802e01:	f7 df                	neg    %edi
+  802e03:	89 de                	mov    %ebx,%esi
+  802e05:	83 d6 00             	adc    $0x0,%esi
+  802e08:	f7 de                	neg    %esi
+  802e0a:	0f 49 cf             	cmovns %edi,%ecx
+  802e0d:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802e11:	0f 49 de             	cmovns %esi,%ebx
+  802e14:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  802e18:	ff 74 24 0c          	push   0xc(%esp)
+  802e1c:	ff 74 24 0c          	push   0xc(%esp)
+  802e20:	e8 d4 fd ff ff       	call   802bf9 <udivmod>
+  802e25:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802e29:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802e2d:	f7 d8                	neg    %eax
+  802e2f:	83 d2 00             	adc    $0x0,%edx
+  802e32:	f7 da                	neg    %edx
+  802e34:	83 c4 10             	add    $0x10,%esp
+  802e37:	83 c4 24             	add    $0x24,%esp
+  802e3a:	5b                   	pop    %ebx
+  802e3b:	5e                   	pop    %esi
+  802e3c:	5f                   	pop    %edi
+  802e3d:	5d                   	pop    %ebp
+  802e3e:	c3                   	ret
@@ -0,0 +1,6363 @@
+
+obj/user/buggyhello.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 16 00 00 00       	call   800047 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+  sys_cputs((char*)1, 1);
+  800039:	6a 01                	push   $0x1
+  80003b:	6a 01                	push   $0x1
+  80003d:	e8 72 00 00 00       	call   8000b4 <sys_cputs>
+}
+  800042:	83 c4 10             	add    $0x10,%esp
+  800045:	c9                   	leave
+  800046:	c3                   	ret
+
+00800047 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800047:	55                   	push   %ebp
+  800048:	89 e5                	mov    %esp,%ebp
+  80004a:	56                   	push   %esi
+  80004b:	53                   	push   %ebx
+  80004c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80004f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  800052:	c7 05 44 57 80 00 00 	movl   $0x0,0x805744
+  800059:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  80005c:	e8 d1 00 00 00       	call   800132 <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  800061:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800066:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800069:	c1 e0 04             	shl    $0x4,%eax
+  80006c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800071:	a3 44 57 80 00       	mov    %eax,0x805744
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800076:	85 db                	test   %ebx,%ebx
+  800078:	7e 07                	jle    800081 <libmain+0x3a>
+    binaryname = argv[0];
+  80007a:	8b 06                	mov    (%esi),%eax
+  80007c:	a3 00 40 80 00       	mov    %eax,0x804000
+
+  // call user main routine
+  umain(argc, argv);
+  800081:	83 ec 08             	sub    $0x8,%esp
+  800084:	56                   	push   %esi
+  800085:	53                   	push   %ebx
+  800086:	e8 a8 ff ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  80008b:	e8 0a 00 00 00       	call   80009a <exit>
+}
+  800090:	83 c4 10             	add    $0x10,%esp
+  800093:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800096:	5b                   	pop    %ebx
+  800097:	5e                   	pop    %esi
+  800098:	5d                   	pop    %ebp
+  800099:	c3                   	ret
+
+0080009a <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80009a:	55                   	push   %ebp
+  80009b:	89 e5                	mov    %esp,%ebp
+  80009d:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  8000a0:	e8 87 07 00 00       	call   80082c <close_all>
+  sys_env_destroy(0);
+  8000a5:	83 ec 0c             	sub    $0xc,%esp
+  8000a8:	6a 00                	push   $0x0
+  8000aa:	e8 42 00 00 00       	call   8000f1 <sys_env_destroy>
+}
+  8000af:	83 c4 10             	add    $0x10,%esp
+  8000b2:	c9                   	leave
+  8000b3:	c3                   	ret
+
+008000b4 <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8000b4:	55                   	push   %ebp
+  8000b5:	89 e5                	mov    %esp,%ebp
+  8000b7:	57                   	push   %edi
+  8000b8:	56                   	push   %esi
+  8000b9:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8000ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000c2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000c5:	89 c3                	mov    %eax,%ebx
+  8000c7:	89 c7                	mov    %eax,%edi
+  8000c9:	89 c6                	mov    %eax,%esi
+  8000cb:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  8000cd:	5b                   	pop    %ebx
+  8000ce:	5e                   	pop    %esi
+  8000cf:	5f                   	pop    %edi
+  8000d0:	5d                   	pop    %ebp
+  8000d1:	c3                   	ret
+
+008000d2 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  8000d2:	55                   	push   %ebp
+  8000d3:	89 e5                	mov    %esp,%ebp
+  8000d5:	57                   	push   %edi
+  8000d6:	56                   	push   %esi
+  8000d7:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8000d8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000dd:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000e2:	89 d1                	mov    %edx,%ecx
+  8000e4:	89 d3                	mov    %edx,%ebx
+  8000e6:	89 d7                	mov    %edx,%edi
+  8000e8:	89 d6                	mov    %edx,%esi
+  8000ea:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  8000ec:	5b                   	pop    %ebx
+  8000ed:	5e                   	pop    %esi
+  8000ee:	5f                   	pop    %edi
+  8000ef:	5d                   	pop    %ebp
+  8000f0:	c3                   	ret
+
+008000f1 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8000f1:	55                   	push   %ebp
+  8000f2:	89 e5                	mov    %esp,%ebp
+  8000f4:	57                   	push   %edi
+  8000f5:	56                   	push   %esi
+  8000f6:	53                   	push   %ebx
+  8000f7:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8000fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000ff:	8b 55 08             	mov    0x8(%ebp),%edx
+  800102:	b8 03 00 00 00       	mov    $0x3,%eax
+  800107:	89 cb                	mov    %ecx,%ebx
+  800109:	89 cf                	mov    %ecx,%edi
+  80010b:	89 ce                	mov    %ecx,%esi
+  80010d:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80010f:	85 c0                	test   %eax,%eax
+  800111:	7f 08                	jg     80011b <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800113:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800116:	5b                   	pop    %ebx
+  800117:	5e                   	pop    %esi
+  800118:	5f                   	pop    %edi
+  800119:	5d                   	pop    %ebp
+  80011a:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80011b:	83 ec 0c             	sub    $0xc,%esp
+  80011e:	50                   	push   %eax
+  80011f:	6a 03                	push   $0x3
+  800121:	68 6a 2e 80 00       	push   $0x802e6a
+  800126:	6a 23                	push   $0x23
+  800128:	68 87 2e 80 00       	push   $0x802e87
+  80012d:	e8 41 1f 00 00       	call   802073 <_panic>
+
+00800132 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800132:	55                   	push   %ebp
+  800133:	89 e5                	mov    %esp,%ebp
+  800135:	57                   	push   %edi
+  800136:	56                   	push   %esi
+  800137:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800138:	ba 00 00 00 00       	mov    $0x0,%edx
+  80013d:	b8 02 00 00 00       	mov    $0x2,%eax
+  800142:	89 d1                	mov    %edx,%ecx
+  800144:	89 d3                	mov    %edx,%ebx
+  800146:	89 d7                	mov    %edx,%edi
+  800148:	89 d6                	mov    %edx,%esi
+  80014a:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  80014c:	5b                   	pop    %ebx
+  80014d:	5e                   	pop    %esi
+  80014e:	5f                   	pop    %edi
+  80014f:	5d                   	pop    %ebp
+  800150:	c3                   	ret
+
+00800151 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800151:	55                   	push   %ebp
+  800152:	89 e5                	mov    %esp,%ebp
+  800154:	57                   	push   %edi
+  800155:	56                   	push   %esi
+  800156:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800157:	ba 00 00 00 00       	mov    $0x0,%edx
+  80015c:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800161:	89 d1                	mov    %edx,%ecx
+  800163:	89 d3                	mov    %edx,%ebx
+  800165:	89 d7                	mov    %edx,%edi
+  800167:	89 d6                	mov    %edx,%esi
+  800169:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  80016b:	5b                   	pop    %ebx
+  80016c:	5e                   	pop    %esi
+  80016d:	5f                   	pop    %edi
+  80016e:	5d                   	pop    %ebp
+  80016f:	c3                   	ret
+
+00800170 <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  800170:	55                   	push   %ebp
+  800171:	89 e5                	mov    %esp,%ebp
+  800173:	57                   	push   %edi
+  800174:	56                   	push   %esi
+  800175:	53                   	push   %ebx
+  800176:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  800179:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  80017d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800182:	8b 55 08             	mov    0x8(%ebp),%edx
+  800185:	b8 14 00 00 00       	mov    $0x14,%eax
+  80018a:	89 df                	mov    %ebx,%edi
+  80018c:	89 de                	mov    %ebx,%esi
+  80018e:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800190:	85 c0                	test   %eax,%eax
+  800192:	7f 08                	jg     80019c <sys_env_set_cow+0x2c>
+}
+  800194:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800197:	5b                   	pop    %ebx
+  800198:	5e                   	pop    %esi
+  800199:	5f                   	pop    %edi
+  80019a:	5d                   	pop    %ebp
+  80019b:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80019c:	83 ec 0c             	sub    $0xc,%esp
+  80019f:	50                   	push   %eax
+  8001a0:	6a 14                	push   $0x14
+  8001a2:	68 6a 2e 80 00       	push   $0x802e6a
+  8001a7:	6a 23                	push   $0x23
+  8001a9:	68 87 2e 80 00       	push   $0x802e87
+  8001ae:	e8 c0 1e 00 00       	call   802073 <_panic>
+
+008001b3 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8001b3:	55                   	push   %ebp
+  8001b4:	89 e5                	mov    %esp,%ebp
+  8001b6:	57                   	push   %edi
+  8001b7:	56                   	push   %esi
+  8001b8:	53                   	push   %ebx
+  8001b9:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8001bc:	be 00 00 00 00       	mov    $0x0,%esi
+  8001c1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001c4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001c7:	b8 04 00 00 00       	mov    $0x4,%eax
+  8001cc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001cf:	89 f7                	mov    %esi,%edi
+  8001d1:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8001d3:	85 c0                	test   %eax,%eax
+  8001d5:	7f 08                	jg     8001df <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  8001d7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001da:	5b                   	pop    %ebx
+  8001db:	5e                   	pop    %esi
+  8001dc:	5f                   	pop    %edi
+  8001dd:	5d                   	pop    %ebp
+  8001de:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8001df:	83 ec 0c             	sub    $0xc,%esp
+  8001e2:	50                   	push   %eax
+  8001e3:	6a 04                	push   $0x4
+  8001e5:	68 6a 2e 80 00       	push   $0x802e6a
+  8001ea:	6a 23                	push   $0x23
+  8001ec:	68 87 2e 80 00       	push   $0x802e87
+  8001f1:	e8 7d 1e 00 00       	call   802073 <_panic>
+
+008001f6 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8001f6:	55                   	push   %ebp
+  8001f7:	89 e5                	mov    %esp,%ebp
+  8001f9:	57                   	push   %edi
+  8001fa:	56                   	push   %esi
+  8001fb:	53                   	push   %ebx
+  8001fc:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8001ff:	8b 55 08             	mov    0x8(%ebp),%edx
+  800202:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800205:	b8 05 00 00 00       	mov    $0x5,%eax
+  80020a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80020d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800210:	8b 75 18             	mov    0x18(%ebp),%esi
+  800213:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800215:	85 c0                	test   %eax,%eax
+  800217:	7f 08                	jg     800221 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  800219:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80021c:	5b                   	pop    %ebx
+  80021d:	5e                   	pop    %esi
+  80021e:	5f                   	pop    %edi
+  80021f:	5d                   	pop    %ebp
+  800220:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800221:	83 ec 0c             	sub    $0xc,%esp
+  800224:	50                   	push   %eax
+  800225:	6a 05                	push   $0x5
+  800227:	68 6a 2e 80 00       	push   $0x802e6a
+  80022c:	6a 23                	push   $0x23
+  80022e:	68 87 2e 80 00       	push   $0x802e87
+  800233:	e8 3b 1e 00 00       	call   802073 <_panic>
+
+00800238 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800238:	55                   	push   %ebp
+  800239:	89 e5                	mov    %esp,%ebp
+  80023b:	57                   	push   %edi
+  80023c:	56                   	push   %esi
+  80023d:	53                   	push   %ebx
+  80023e:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800241:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800246:	8b 55 08             	mov    0x8(%ebp),%edx
+  800249:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80024c:	b8 06 00 00 00       	mov    $0x6,%eax
+  800251:	89 df                	mov    %ebx,%edi
+  800253:	89 de                	mov    %ebx,%esi
+  800255:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800257:	85 c0                	test   %eax,%eax
+  800259:	7f 08                	jg     800263 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  80025b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80025e:	5b                   	pop    %ebx
+  80025f:	5e                   	pop    %esi
+  800260:	5f                   	pop    %edi
+  800261:	5d                   	pop    %ebp
+  800262:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800263:	83 ec 0c             	sub    $0xc,%esp
+  800266:	50                   	push   %eax
+  800267:	6a 06                	push   $0x6
+  800269:	68 6a 2e 80 00       	push   $0x802e6a
+  80026e:	6a 23                	push   $0x23
+  800270:	68 87 2e 80 00       	push   $0x802e87
+  800275:	e8 f9 1d 00 00       	call   802073 <_panic>
+
+0080027a <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  80027a:	55                   	push   %ebp
+  80027b:	89 e5                	mov    %esp,%ebp
+  80027d:	57                   	push   %edi
+  80027e:	56                   	push   %esi
+  80027f:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800280:	8b 55 08             	mov    0x8(%ebp),%edx
+  800283:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800286:	b8 11 00 00 00       	mov    $0x11,%eax
+  80028b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80028e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800291:	8b 75 18             	mov    0x18(%ebp),%esi
+  800294:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  800296:	5b                   	pop    %ebx
+  800297:	5e                   	pop    %esi
+  800298:	5f                   	pop    %edi
+  800299:	5d                   	pop    %ebp
+  80029a:	c3                   	ret
+
+0080029b <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  80029b:	55                   	push   %ebp
+  80029c:	89 e5                	mov    %esp,%ebp
+  80029e:	57                   	push   %edi
+  80029f:	56                   	push   %esi
+  8002a0:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8002a1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002a4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002a7:	b8 12 00 00 00       	mov    $0x12,%eax
+  8002ac:	be 00 00 00 00       	mov    $0x0,%esi
+  8002b1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8002b4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8002b7:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  8002b9:	5b                   	pop    %ebx
+  8002ba:	5e                   	pop    %esi
+  8002bb:	5f                   	pop    %edi
+  8002bc:	5d                   	pop    %ebp
+  8002bd:	c3                   	ret
+
+008002be <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  8002be:	55                   	push   %ebp
+  8002bf:	89 e5                	mov    %esp,%ebp
+  8002c1:	57                   	push   %edi
+  8002c2:	56                   	push   %esi
+  8002c3:	53                   	push   %ebx
+  8002c4:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8002c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002cc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002cf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002d2:	b8 16 00 00 00       	mov    $0x16,%eax
+  8002d7:	89 df                	mov    %ebx,%edi
+  8002d9:	89 de                	mov    %ebx,%esi
+  8002db:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8002dd:	85 c0                	test   %eax,%eax
+  8002df:	7f 08                	jg     8002e9 <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  8002e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002e4:	5b                   	pop    %ebx
+  8002e5:	5e                   	pop    %esi
+  8002e6:	5f                   	pop    %edi
+  8002e7:	5d                   	pop    %ebp
+  8002e8:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8002e9:	83 ec 0c             	sub    $0xc,%esp
+  8002ec:	50                   	push   %eax
+  8002ed:	6a 16                	push   $0x16
+  8002ef:	68 6a 2e 80 00       	push   $0x802e6a
+  8002f4:	6a 23                	push   $0x23
+  8002f6:	68 87 2e 80 00       	push   $0x802e87
+  8002fb:	e8 73 1d 00 00       	call   802073 <_panic>
+
+00800300 <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  800300:	55                   	push   %ebp
+  800301:	89 e5                	mov    %esp,%ebp
+  800303:	57                   	push   %edi
+  800304:	56                   	push   %esi
+  800305:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800306:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80030b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80030e:	b8 17 00 00 00       	mov    $0x17,%eax
+  800313:	89 cb                	mov    %ecx,%ebx
+  800315:	89 cf                	mov    %ecx,%edi
+  800317:	89 ce                	mov    %ecx,%esi
+  800319:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  80031b:	5b                   	pop    %ebx
+  80031c:	5e                   	pop    %esi
+  80031d:	5f                   	pop    %edi
+  80031e:	5d                   	pop    %ebp
+  80031f:	c3                   	ret
+
+00800320 <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  800320:	55                   	push   %ebp
+  800321:	89 e5                	mov    %esp,%ebp
+  800323:	57                   	push   %edi
+  800324:	56                   	push   %esi
+  800325:	53                   	push   %ebx
+  800326:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800329:	be 00 00 00 00       	mov    $0x0,%esi
+  80032e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800331:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800334:	b8 18 00 00 00       	mov    $0x18,%eax
+  800339:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80033c:	89 f7                	mov    %esi,%edi
+  80033e:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800340:	85 c0                	test   %eax,%eax
+  800342:	7f 08                	jg     80034c <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  800344:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800347:	5b                   	pop    %ebx
+  800348:	5e                   	pop    %esi
+  800349:	5f                   	pop    %edi
+  80034a:	5d                   	pop    %ebp
+  80034b:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80034c:	83 ec 0c             	sub    $0xc,%esp
+  80034f:	50                   	push   %eax
+  800350:	6a 18                	push   $0x18
+  800352:	68 6a 2e 80 00       	push   $0x802e6a
+  800357:	6a 23                	push   $0x23
+  800359:	68 87 2e 80 00       	push   $0x802e87
+  80035e:	e8 10 1d 00 00       	call   802073 <_panic>
+
+00800363 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  800363:	55                   	push   %ebp
+  800364:	89 e5                	mov    %esp,%ebp
+  800366:	57                   	push   %edi
+  800367:	56                   	push   %esi
+  800368:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800369:	be 00 00 00 00       	mov    $0x0,%esi
+  80036e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800371:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800374:	b8 19 00 00 00       	mov    $0x19,%eax
+  800379:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80037c:	89 f7                	mov    %esi,%edi
+  80037e:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  800380:	5b                   	pop    %ebx
+  800381:	5e                   	pop    %esi
+  800382:	5f                   	pop    %edi
+  800383:	5d                   	pop    %ebp
+  800384:	c3                   	ret
+
+00800385 <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  800385:	55                   	push   %ebp
+  800386:	89 e5                	mov    %esp,%ebp
+  800388:	57                   	push   %edi
+  800389:	56                   	push   %esi
+  80038a:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80038b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800390:	b8 15 00 00 00       	mov    $0x15,%eax
+  800395:	89 d1                	mov    %edx,%ecx
+  800397:	89 d3                	mov    %edx,%ebx
+  800399:	89 d7                	mov    %edx,%edi
+  80039b:	89 d6                	mov    %edx,%esi
+  80039d:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  80039f:	5b                   	pop    %ebx
+  8003a0:	5e                   	pop    %esi
+  8003a1:	5f                   	pop    %edi
+  8003a2:	5d                   	pop    %ebp
+  8003a3:	c3                   	ret
+
+008003a4 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8003a4:	55                   	push   %ebp
+  8003a5:	89 e5                	mov    %esp,%ebp
+  8003a7:	57                   	push   %edi
+  8003a8:	56                   	push   %esi
+  8003a9:	53                   	push   %ebx
+  8003aa:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8003ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003b2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003b5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003b8:	b8 08 00 00 00       	mov    $0x8,%eax
+  8003bd:	89 df                	mov    %ebx,%edi
+  8003bf:	89 de                	mov    %ebx,%esi
+  8003c1:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8003c3:	85 c0                	test   %eax,%eax
+  8003c5:	7f 08                	jg     8003cf <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8003c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003ca:	5b                   	pop    %ebx
+  8003cb:	5e                   	pop    %esi
+  8003cc:	5f                   	pop    %edi
+  8003cd:	5d                   	pop    %ebp
+  8003ce:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8003cf:	83 ec 0c             	sub    $0xc,%esp
+  8003d2:	50                   	push   %eax
+  8003d3:	6a 08                	push   $0x8
+  8003d5:	68 6a 2e 80 00       	push   $0x802e6a
+  8003da:	6a 23                	push   $0x23
+  8003dc:	68 87 2e 80 00       	push   $0x802e87
+  8003e1:	e8 8d 1c 00 00       	call   802073 <_panic>
+
+008003e6 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8003e6:	55                   	push   %ebp
+  8003e7:	89 e5                	mov    %esp,%ebp
+  8003e9:	57                   	push   %edi
+  8003ea:	56                   	push   %esi
+  8003eb:	53                   	push   %ebx
+  8003ec:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8003ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003fa:	b8 09 00 00 00       	mov    $0x9,%eax
+  8003ff:	89 df                	mov    %ebx,%edi
+  800401:	89 de                	mov    %ebx,%esi
+  800403:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800405:	85 c0                	test   %eax,%eax
+  800407:	7f 08                	jg     800411 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  800409:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80040c:	5b                   	pop    %ebx
+  80040d:	5e                   	pop    %esi
+  80040e:	5f                   	pop    %edi
+  80040f:	5d                   	pop    %ebp
+  800410:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800411:	83 ec 0c             	sub    $0xc,%esp
+  800414:	50                   	push   %eax
+  800415:	6a 09                	push   $0x9
+  800417:	68 6a 2e 80 00       	push   $0x802e6a
+  80041c:	6a 23                	push   $0x23
+  80041e:	68 87 2e 80 00       	push   $0x802e87
+  800423:	e8 4b 1c 00 00       	call   802073 <_panic>
+
+00800428 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800428:	55                   	push   %ebp
+  800429:	89 e5                	mov    %esp,%ebp
+  80042b:	57                   	push   %edi
+  80042c:	56                   	push   %esi
+  80042d:	53                   	push   %ebx
+  80042e:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800431:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800436:	8b 55 08             	mov    0x8(%ebp),%edx
+  800439:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80043c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800441:	89 df                	mov    %ebx,%edi
+  800443:	89 de                	mov    %ebx,%esi
+  800445:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800447:	85 c0                	test   %eax,%eax
+  800449:	7f 08                	jg     800453 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  80044b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80044e:	5b                   	pop    %ebx
+  80044f:	5e                   	pop    %esi
+  800450:	5f                   	pop    %edi
+  800451:	5d                   	pop    %ebp
+  800452:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800453:	83 ec 0c             	sub    $0xc,%esp
+  800456:	50                   	push   %eax
+  800457:	6a 0a                	push   $0xa
+  800459:	68 6a 2e 80 00       	push   $0x802e6a
+  80045e:	6a 23                	push   $0x23
+  800460:	68 87 2e 80 00       	push   $0x802e87
+  800465:	e8 09 1c 00 00       	call   802073 <_panic>
+
+0080046a <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  80046a:	55                   	push   %ebp
+  80046b:	89 e5                	mov    %esp,%ebp
+  80046d:	57                   	push   %edi
+  80046e:	56                   	push   %esi
+  80046f:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800470:	8b 55 08             	mov    0x8(%ebp),%edx
+  800473:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800476:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80047b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80047e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800481:	8b 75 18             	mov    0x18(%ebp),%esi
+  800484:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  800486:	5b                   	pop    %ebx
+  800487:	5e                   	pop    %esi
+  800488:	5f                   	pop    %edi
+  800489:	5d                   	pop    %ebp
+  80048a:	c3                   	ret
+
+0080048b <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  80048b:	55                   	push   %ebp
+  80048c:	89 e5                	mov    %esp,%ebp
+  80048e:	57                   	push   %edi
+  80048f:	56                   	push   %esi
+  800490:	53                   	push   %ebx
+  800491:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800494:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800499:	8b 55 08             	mov    0x8(%ebp),%edx
+  80049c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80049f:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8004a4:	89 df                	mov    %ebx,%edi
+  8004a6:	89 de                	mov    %ebx,%esi
+  8004a8:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8004aa:	85 c0                	test   %eax,%eax
+  8004ac:	7f 08                	jg     8004b6 <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  8004ae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004b1:	5b                   	pop    %ebx
+  8004b2:	5e                   	pop    %esi
+  8004b3:	5f                   	pop    %edi
+  8004b4:	5d                   	pop    %ebp
+  8004b5:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8004b6:	83 ec 0c             	sub    $0xc,%esp
+  8004b9:	50                   	push   %eax
+  8004ba:	6a 0d                	push   $0xd
+  8004bc:	68 6a 2e 80 00       	push   $0x802e6a
+  8004c1:	6a 23                	push   $0x23
+  8004c3:	68 87 2e 80 00       	push   $0x802e87
+  8004c8:	e8 a6 1b 00 00       	call   802073 <_panic>
+
+008004cd <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  8004cd:	55                   	push   %ebp
+  8004ce:	89 e5                	mov    %esp,%ebp
+  8004d0:	57                   	push   %edi
+  8004d1:	56                   	push   %esi
+  8004d2:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8004d3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004d8:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8004dd:	89 d1                	mov    %edx,%ecx
+  8004df:	89 d3                	mov    %edx,%ebx
+  8004e1:	89 d7                	mov    %edx,%edi
+  8004e3:	89 d6                	mov    %edx,%esi
+  8004e5:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8004e7:	5b                   	pop    %ebx
+  8004e8:	5e                   	pop    %esi
+  8004e9:	5f                   	pop    %edi
+  8004ea:	5d                   	pop    %ebp
+  8004eb:	c3                   	ret
+
+008004ec <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  8004ec:	55                   	push   %ebp
+  8004ed:	89 e5                	mov    %esp,%ebp
+  8004ef:	57                   	push   %edi
+  8004f0:	56                   	push   %esi
+  8004f1:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8004f2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004f5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004f8:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8004fd:	be 00 00 00 00       	mov    $0x0,%esi
+  800502:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800505:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800508:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  80050a:	5b                   	pop    %ebx
+  80050b:	5e                   	pop    %esi
+  80050c:	5f                   	pop    %edi
+  80050d:	5d                   	pop    %ebp
+  80050e:	c3                   	ret
+
+0080050f <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  80050f:	55                   	push   %ebp
+  800510:	89 e5                	mov    %esp,%ebp
+  800512:	57                   	push   %edi
+  800513:	56                   	push   %esi
+  800514:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800515:	be 00 00 00 00       	mov    $0x0,%esi
+  80051a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80051d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800520:	b8 10 00 00 00       	mov    $0x10,%eax
+  800525:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800528:	89 f7                	mov    %esi,%edi
+  80052a:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  80052c:	5b                   	pop    %ebx
+  80052d:	5e                   	pop    %esi
+  80052e:	5f                   	pop    %edi
+  80052f:	5d                   	pop    %ebp
+  800530:	c3                   	ret
+
+00800531 <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  800531:	55                   	push   %ebp
+  800532:	89 e5                	mov    %esp,%ebp
+  800534:	57                   	push   %edi
+  800535:	56                   	push   %esi
+  800536:	53                   	push   %ebx
+  800537:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  80053a:	80 3d 48 57 80 00 00 	cmpb   $0x0,0x805748
+  800541:	74 41                	je     800584 <sys_batch+0x53>
+  800543:	8b 45 08             	mov    0x8(%ebp),%eax
+  800546:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  800549:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  800550:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800553:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  800556:	7d 45                	jge    80059d <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  800558:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80055b:	8b 06                	mov    (%esi),%eax
+  80055d:	8b 56 04             	mov    0x4(%esi),%edx
+  800560:	8b 4e 08             	mov    0x8(%esi),%ecx
+  800563:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  800566:	8b 7e 10             	mov    0x10(%esi),%edi
+  800569:	8b 76 14             	mov    0x14(%esi),%esi
+  80056c:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  80056e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800571:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  800574:	83 c6 1c             	add    $0x1c,%esi
+  800577:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  80057a:	85 c0                	test   %eax,%eax
+  80057c:	78 1f                	js     80059d <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  80057e:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  800582:	eb cc                	jmp    800550 <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  800584:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800589:	b8 13 00 00 00       	mov    $0x13,%eax
+  80058e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800591:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800594:	89 df                	mov    %ebx,%edi
+  800596:	89 de                	mov    %ebx,%esi
+  800598:	cd 30                	int    $0x30
+  80059a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  80059d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8005a0:	83 c4 08             	add    $0x8,%esp
+  8005a3:	5b                   	pop    %ebx
+  8005a4:	5e                   	pop    %esi
+  8005a5:	5f                   	pop    %edi
+  8005a6:	5d                   	pop    %ebp
+  8005a7:	c3                   	ret
+
+008005a8 <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  8005a8:	55                   	push   %ebp
+  8005a9:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  8005ab:	8b 45 08             	mov    0x8(%ebp),%eax
+  8005ae:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8005b4:	5d                   	pop    %ebp
+  8005b5:	c3                   	ret
+
+008005b6 <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  8005b6:	55                   	push   %ebp
+  8005b7:	89 e5                	mov    %esp,%ebp
+  8005b9:	56                   	push   %esi
+  8005ba:	53                   	push   %ebx
+  8005bb:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  8005be:	8b 1e                	mov    (%esi),%ebx
+  8005c0:	85 db                	test   %ebx,%ebx
+  8005c2:	75 09                	jne    8005cd <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  8005c4:	89 d8                	mov    %ebx,%eax
+  8005c6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8005c9:	5b                   	pop    %ebx
+  8005ca:	5e                   	pop    %esi
+  8005cb:	5d                   	pop    %ebp
+  8005cc:	c3                   	ret
+  b->sb_n = 0;
+  8005cd:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  8005d3:	53                   	push   %ebx
+  8005d4:	8d 46 04             	lea    0x4(%esi),%eax
+  8005d7:	50                   	push   %eax
+  8005d8:	e8 54 ff ff ff       	call   800531 <sys_batch>
+  8005dd:	83 c4 08             	add    $0x8,%esp
+  8005e0:	85 c0                	test   %eax,%eax
+  8005e2:	78 1e                	js     800602 <sysbatch_flush+0x4c>
+  if (r < n)
+  8005e4:	39 c3                	cmp    %eax,%ebx
+  8005e6:	7f 07                	jg     8005ef <sysbatch_flush+0x39>
+  return 0;
+  8005e8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005ed:	eb d5                	jmp    8005c4 <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  8005ef:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8005f2:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  8005f6:	85 db                	test   %ebx,%ebx
+  8005f8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8005fd:	0f 49 d8             	cmovns %eax,%ebx
+  800600:	eb c2                	jmp    8005c4 <sysbatch_flush+0xe>
+    return r;
+  800602:	89 c3                	mov    %eax,%ebx
+  800604:	eb be                	jmp    8005c4 <sysbatch_flush+0xe>
+
+00800606 <sysbatch_add>:
+{
+  800606:	55                   	push   %ebp
+  800607:	89 e5                	mov    %esp,%ebp
+  800609:	53                   	push   %ebx
+  80060a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  80060d:	83 3b 40             	cmpl   $0x40,(%ebx)
+  800610:	74 41                	je     800653 <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  800612:	8b 03                	mov    (%ebx),%eax
+  800614:	8d 50 01             	lea    0x1(%eax),%edx
+  800617:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  800619:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80061c:	01 d8                	add    %ebx,%eax
+  80061e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800621:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  800624:	8b 55 10             	mov    0x10(%ebp),%edx
+  800627:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  80062a:	8b 55 14             	mov    0x14(%ebp),%edx
+  80062d:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  800630:	8b 55 18             	mov    0x18(%ebp),%edx
+  800633:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  800636:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  800639:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  80063c:	8b 55 20             	mov    0x20(%ebp),%edx
+  80063f:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  800642:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  800649:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80064e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800651:	c9                   	leave
+  800652:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  800653:	53                   	push   %ebx
+  800654:	e8 5d ff ff ff       	call   8005b6 <sysbatch_flush>
+  800659:	83 c4 04             	add    $0x4,%esp
+  80065c:	85 c0                	test   %eax,%eax
+  80065e:	79 b2                	jns    800612 <sysbatch_add+0xc>
+  800660:	eb ec                	jmp    80064e <sysbatch_add+0x48>
+
+00800662 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800662:	55                   	push   %ebp
+  800663:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  800665:	8b 45 08             	mov    0x8(%ebp),%eax
+  800668:	05 00 00 00 30       	add    $0x30000000,%eax
+  80066d:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800670:	5d                   	pop    %ebp
+  800671:	c3                   	ret
+
+00800672 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800672:	55                   	push   %ebp
+  800673:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  800675:	8b 45 08             	mov    0x8(%ebp),%eax
+  800678:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  80067b:	66 b8 00 00          	mov    $0x0,%ax
+  80067f:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  800684:	5d                   	pop    %ebp
+  800685:	c3                   	ret
+
+00800686 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800686:	55                   	push   %ebp
+  800687:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  800689:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80068e:	eb 02                	jmp    800692 <fd_alloc+0xc>
+  800690:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800692:	89 c2                	mov    %eax,%edx
+  800694:	c1 ea 16             	shr    $0x16,%edx
+  800697:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80069e:	f6 c2 01             	test   $0x1,%dl
+  8006a1:	74 2b                	je     8006ce <fd_alloc+0x48>
+  8006a3:	89 c2                	mov    %eax,%edx
+  8006a5:	c1 ea 0c             	shr    $0xc,%edx
+  8006a8:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8006af:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8006b5:	f6 c1 01             	test   $0x1,%cl
+  8006b8:	74 14                	je     8006ce <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  8006ba:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8006c0:	75 ce                	jne    800690 <fd_alloc+0xa>
+  8006c2:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  8006c7:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8006cc:	eb 05                	jmp    8006d3 <fd_alloc+0x4d>
+      return 0;
+  8006ce:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  8006d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006d6:	89 02                	mov    %eax,(%edx)
+}
+  8006d8:	89 c8                	mov    %ecx,%eax
+  8006da:	5d                   	pop    %ebp
+  8006db:	c3                   	ret
+
+008006dc <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8006dc:	55                   	push   %ebp
+  8006dd:	89 e5                	mov    %esp,%ebp
+  8006df:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  8006e2:	83 f8 1f             	cmp    $0x1f,%eax
+  8006e5:	77 30                	ja     800717 <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  8006e7:	c1 e0 0c             	shl    $0xc,%eax
+  8006ea:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8006ef:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8006f5:	f6 c2 01             	test   $0x1,%dl
+  8006f8:	74 24                	je     80071e <fd_lookup+0x42>
+  8006fa:	89 c2                	mov    %eax,%edx
+  8006fc:	c1 ea 0c             	shr    $0xc,%edx
+  8006ff:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800706:	f6 c2 01             	test   $0x1,%dl
+  800709:	74 1a                	je     800725 <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  80070b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80070e:	89 02                	mov    %eax,(%edx)
+  return 0;
+  800710:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800715:	5d                   	pop    %ebp
+  800716:	c3                   	ret
+    return -E_INVAL;
+  800717:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80071c:	eb f7                	jmp    800715 <fd_lookup+0x39>
+    return -E_INVAL;
+  80071e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800723:	eb f0                	jmp    800715 <fd_lookup+0x39>
+  800725:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80072a:	eb e9                	jmp    800715 <fd_lookup+0x39>
+
+0080072c <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80072c:	55                   	push   %ebp
+  80072d:	89 e5                	mov    %esp,%ebp
+  80072f:	53                   	push   %ebx
+  800730:	83 ec 04             	sub    $0x4,%esp
+  800733:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  800736:	b8 14 2f 80 00       	mov    $0x802f14,%eax
+  80073b:	8b 18                	mov    (%eax),%ebx
+  80073d:	85 db                	test   %ebx,%ebx
+  80073f:	74 0e                	je     80074f <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  800741:	83 c0 04             	add    $0x4,%eax
+  800744:	39 13                	cmp    %edx,(%ebx)
+  800746:	75 f3                	jne    80073b <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  800748:	b8 00 00 00 00       	mov    $0x0,%eax
+  80074d:	eb 1f                	jmp    80076e <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80074f:	a1 44 57 80 00       	mov    0x805744,%eax
+  800754:	8b 40 48             	mov    0x48(%eax),%eax
+  800757:	83 ec 04             	sub    $0x4,%esp
+  80075a:	52                   	push   %edx
+  80075b:	50                   	push   %eax
+  80075c:	68 98 2e 80 00       	push   $0x802e98
+  800761:	e8 e8 19 00 00       	call   80214e <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  800766:	83 c4 10             	add    $0x10,%esp
+  800769:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  80076e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800771:	89 1a                	mov    %ebx,(%edx)
+}
+  800773:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800776:	c9                   	leave
+  800777:	c3                   	ret
+
+00800778 <fd_close>:
+{
+  800778:	55                   	push   %ebp
+  800779:	89 e5                	mov    %esp,%ebp
+  80077b:	57                   	push   %edi
+  80077c:	56                   	push   %esi
+  80077d:	53                   	push   %ebx
+  80077e:	83 ec 24             	sub    $0x24,%esp
+  800781:	8b 75 08             	mov    0x8(%ebp),%esi
+  800784:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800787:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80078a:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80078b:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800791:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800794:	50                   	push   %eax
+  800795:	e8 42 ff ff ff       	call   8006dc <fd_lookup>
+  80079a:	89 c3                	mov    %eax,%ebx
+  80079c:	83 c4 10             	add    $0x10,%esp
+  80079f:	85 c0                	test   %eax,%eax
+  8007a1:	78 05                	js     8007a8 <fd_close+0x30>
+      || fd != fd2)
+  8007a3:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8007a6:	74 16                	je     8007be <fd_close+0x46>
+    return must_exist ? r : 0;
+  8007a8:	89 f8                	mov    %edi,%eax
+  8007aa:	84 c0                	test   %al,%al
+  8007ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007b1:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8007b4:	89 d8                	mov    %ebx,%eax
+  8007b6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007b9:	5b                   	pop    %ebx
+  8007ba:	5e                   	pop    %esi
+  8007bb:	5f                   	pop    %edi
+  8007bc:	5d                   	pop    %ebp
+  8007bd:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8007be:	83 ec 08             	sub    $0x8,%esp
+  8007c1:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8007c4:	50                   	push   %eax
+  8007c5:	ff 36                	push   (%esi)
+  8007c7:	e8 60 ff ff ff       	call   80072c <dev_lookup>
+  8007cc:	89 c3                	mov    %eax,%ebx
+  8007ce:	83 c4 10             	add    $0x10,%esp
+  8007d1:	85 c0                	test   %eax,%eax
+  8007d3:	78 1a                	js     8007ef <fd_close+0x77>
+    if (dev->dev_close)
+  8007d5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8007d8:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  8007db:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  8007e0:	85 c0                	test   %eax,%eax
+  8007e2:	74 0b                	je     8007ef <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  8007e4:	83 ec 0c             	sub    $0xc,%esp
+  8007e7:	56                   	push   %esi
+  8007e8:	ff d0                	call   *%eax
+  8007ea:	89 c3                	mov    %eax,%ebx
+  8007ec:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  8007ef:	83 ec 08             	sub    $0x8,%esp
+  8007f2:	56                   	push   %esi
+  8007f3:	6a 00                	push   $0x0
+  8007f5:	e8 3e fa ff ff       	call   800238 <sys_page_unmap>
+  return r;
+  8007fa:	83 c4 10             	add    $0x10,%esp
+  8007fd:	eb b5                	jmp    8007b4 <fd_close+0x3c>
+
+008007ff <close>:
+
+int
+close(int fdnum)
+{
+  8007ff:	55                   	push   %ebp
+  800800:	89 e5                	mov    %esp,%ebp
+  800802:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800805:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800808:	50                   	push   %eax
+  800809:	ff 75 08             	push   0x8(%ebp)
+  80080c:	e8 cb fe ff ff       	call   8006dc <fd_lookup>
+  800811:	83 c4 10             	add    $0x10,%esp
+  800814:	85 c0                	test   %eax,%eax
+  800816:	79 02                	jns    80081a <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  800818:	c9                   	leave
+  800819:	c3                   	ret
+    return fd_close(fd, 1);
+  80081a:	83 ec 08             	sub    $0x8,%esp
+  80081d:	6a 01                	push   $0x1
+  80081f:	ff 75 f4             	push   -0xc(%ebp)
+  800822:	e8 51 ff ff ff       	call   800778 <fd_close>
+  800827:	83 c4 10             	add    $0x10,%esp
+  80082a:	eb ec                	jmp    800818 <close+0x19>
+
+0080082c <close_all>:
+
+void
+close_all(void)
+{
+  80082c:	55                   	push   %ebp
+  80082d:	89 e5                	mov    %esp,%ebp
+  80082f:	53                   	push   %ebx
+  800830:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  800833:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  800838:	83 ec 0c             	sub    $0xc,%esp
+  80083b:	53                   	push   %ebx
+  80083c:	e8 be ff ff ff       	call   8007ff <close>
+  for (i = 0; i < MAXFD; i++)
+  800841:	83 c3 01             	add    $0x1,%ebx
+  800844:	83 c4 10             	add    $0x10,%esp
+  800847:	83 fb 20             	cmp    $0x20,%ebx
+  80084a:	75 ec                	jne    800838 <close_all+0xc>
+}
+  80084c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80084f:	c9                   	leave
+  800850:	c3                   	ret
+
+00800851 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  800851:	55                   	push   %ebp
+  800852:	89 e5                	mov    %esp,%ebp
+  800854:	57                   	push   %edi
+  800855:	56                   	push   %esi
+  800856:	53                   	push   %ebx
+  800857:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80085a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80085d:	50                   	push   %eax
+  80085e:	ff 75 08             	push   0x8(%ebp)
+  800861:	e8 76 fe ff ff       	call   8006dc <fd_lookup>
+  800866:	89 c6                	mov    %eax,%esi
+  800868:	83 c4 10             	add    $0x10,%esp
+  80086b:	85 c0                	test   %eax,%eax
+  80086d:	0f 88 0a 01 00 00    	js     80097d <dup+0x12c>
+    return r;
+  close(newfdnum);
+  800873:	83 ec 0c             	sub    $0xc,%esp
+  800876:	ff 75 0c             	push   0xc(%ebp)
+  800879:	e8 81 ff ff ff       	call   8007ff <close>
+
+  newfd = INDEX2FD(newfdnum);
+  80087e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800881:	c1 e0 0c             	shl    $0xc,%eax
+  800884:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  80088a:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  80088d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800890:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800893:	89 04 24             	mov    %eax,(%esp)
+  800896:	e8 d7 fd ff ff       	call   800672 <fd2data>
+  80089b:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  80089d:	89 3c 24             	mov    %edi,(%esp)
+  8008a0:	e8 cd fd ff ff       	call   800672 <fd2data>
+  8008a5:	83 c4 10             	add    $0x10,%esp
+  8008a8:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8008ab:	89 f3                	mov    %esi,%ebx
+  8008ad:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  8008b3:	89 c6                	mov    %eax,%esi
+  8008b5:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8008b8:	89 cf                	mov    %ecx,%edi
+  8008ba:	eb 0c                	jmp    8008c8 <dup+0x77>
+  8008bc:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8008c2:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8008c8:	39 fb                	cmp    %edi,%ebx
+  8008ca:	74 7b                	je     800947 <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  8008cc:	89 d8                	mov    %ebx,%eax
+  8008ce:	c1 e8 16             	shr    $0x16,%eax
+  8008d1:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8008d8:	a8 01                	test   $0x1,%al
+  8008da:	74 e0                	je     8008bc <dup+0x6b>
+  8008dc:	89 d8                	mov    %ebx,%eax
+  8008de:	c1 e8 0c             	shr    $0xc,%eax
+  8008e1:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8008e8:	f6 c2 01             	test   $0x1,%dl
+  8008eb:	74 cf                	je     8008bc <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  8008ed:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  8008f4:	83 ec 0c             	sub    $0xc,%esp
+  8008f7:	25 07 0e 00 00       	and    $0xe07,%eax
+  8008fc:	50                   	push   %eax
+  8008fd:	56                   	push   %esi
+  8008fe:	6a 00                	push   $0x0
+  800900:	53                   	push   %ebx
+  800901:	6a 00                	push   $0x0
+  800903:	e8 ee f8 ff ff       	call   8001f6 <sys_page_map>
+  800908:	83 c4 20             	add    $0x20,%esp
+  80090b:	85 c0                	test   %eax,%eax
+  80090d:	79 ad                	jns    8008bc <dup+0x6b>
+  80090f:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800912:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  800914:	83 ec 08             	sub    $0x8,%esp
+  800917:	ff 75 d4             	push   -0x2c(%ebp)
+  80091a:	6a 00                	push   $0x0
+  80091c:	e8 17 f9 ff ff       	call   800238 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  800921:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  800924:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  80092a:	83 c4 10             	add    $0x10,%esp
+  80092d:	39 df                	cmp    %ebx,%edi
+  80092f:	74 4c                	je     80097d <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  800931:	83 ec 08             	sub    $0x8,%esp
+  800934:	57                   	push   %edi
+  800935:	6a 00                	push   $0x0
+  800937:	e8 fc f8 ff ff       	call   800238 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80093c:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  800942:	83 c4 10             	add    $0x10,%esp
+  800945:	eb e6                	jmp    80092d <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  800947:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80094a:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80094d:	89 c8                	mov    %ecx,%eax
+  80094f:	c1 e8 0c             	shr    $0xc,%eax
+  800952:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800959:	83 ec 0c             	sub    $0xc,%esp
+  80095c:	25 07 0e 00 00       	and    $0xe07,%eax
+  800961:	50                   	push   %eax
+  800962:	ff 75 d4             	push   -0x2c(%ebp)
+  800965:	6a 00                	push   $0x0
+  800967:	51                   	push   %ecx
+  800968:	6a 00                	push   $0x0
+  80096a:	e8 87 f8 ff ff       	call   8001f6 <sys_page_map>
+  80096f:	89 c6                	mov    %eax,%esi
+  800971:	83 c4 20             	add    $0x20,%esp
+  800974:	85 c0                	test   %eax,%eax
+  800976:	78 9c                	js     800914 <dup+0xc3>
+  return newfdnum;
+  800978:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80097b:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  80097d:	89 f0                	mov    %esi,%eax
+  80097f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800982:	5b                   	pop    %ebx
+  800983:	5e                   	pop    %esi
+  800984:	5f                   	pop    %edi
+  800985:	5d                   	pop    %ebp
+  800986:	c3                   	ret
+
+00800987 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  800987:	55                   	push   %ebp
+  800988:	89 e5                	mov    %esp,%ebp
+  80098a:	56                   	push   %esi
+  80098b:	53                   	push   %ebx
+  80098c:	83 ec 18             	sub    $0x18,%esp
+  80098f:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  800992:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800995:	50                   	push   %eax
+  800996:	56                   	push   %esi
+  800997:	e8 40 fd ff ff       	call   8006dc <fd_lookup>
+  80099c:	83 c4 10             	add    $0x10,%esp
+  80099f:	85 c0                	test   %eax,%eax
+  8009a1:	78 3c                	js     8009df <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8009a3:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8009a6:	83 ec 08             	sub    $0x8,%esp
+  8009a9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8009ac:	50                   	push   %eax
+  8009ad:	ff 33                	push   (%ebx)
+  8009af:	e8 78 fd ff ff       	call   80072c <dev_lookup>
+  8009b4:	83 c4 10             	add    $0x10,%esp
+  8009b7:	85 c0                	test   %eax,%eax
+  8009b9:	78 24                	js     8009df <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8009bb:	8b 43 08             	mov    0x8(%ebx),%eax
+  8009be:	83 e0 03             	and    $0x3,%eax
+  8009c1:	83 f8 01             	cmp    $0x1,%eax
+  8009c4:	74 20                	je     8009e6 <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  8009c6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009c9:	8b 40 08             	mov    0x8(%eax),%eax
+  8009cc:	85 c0                	test   %eax,%eax
+  8009ce:	74 37                	je     800a07 <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  8009d0:	83 ec 04             	sub    $0x4,%esp
+  8009d3:	ff 75 10             	push   0x10(%ebp)
+  8009d6:	ff 75 0c             	push   0xc(%ebp)
+  8009d9:	53                   	push   %ebx
+  8009da:	ff d0                	call   *%eax
+  8009dc:	83 c4 10             	add    $0x10,%esp
+}
+  8009df:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8009e2:	5b                   	pop    %ebx
+  8009e3:	5e                   	pop    %esi
+  8009e4:	5d                   	pop    %ebp
+  8009e5:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8009e6:	a1 44 57 80 00       	mov    0x805744,%eax
+  8009eb:	8b 40 48             	mov    0x48(%eax),%eax
+  8009ee:	83 ec 04             	sub    $0x4,%esp
+  8009f1:	56                   	push   %esi
+  8009f2:	50                   	push   %eax
+  8009f3:	68 d9 2e 80 00       	push   $0x802ed9
+  8009f8:	e8 51 17 00 00       	call   80214e <cprintf>
+    return -E_INVAL;
+  8009fd:	83 c4 10             	add    $0x10,%esp
+  800a00:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a05:	eb d8                	jmp    8009df <read+0x58>
+    return -E_NOT_SUPP;
+  800a07:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800a0c:	eb d1                	jmp    8009df <read+0x58>
+
+00800a0e <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  800a0e:	55                   	push   %ebp
+  800a0f:	89 e5                	mov    %esp,%ebp
+  800a11:	57                   	push   %edi
+  800a12:	56                   	push   %esi
+  800a13:	53                   	push   %ebx
+  800a14:	83 ec 0c             	sub    $0xc,%esp
+  800a17:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a1a:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  800a1d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800a22:	eb 02                	jmp    800a26 <readn+0x18>
+  800a24:	01 c3                	add    %eax,%ebx
+  800a26:	39 f3                	cmp    %esi,%ebx
+  800a28:	73 21                	jae    800a4b <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  800a2a:	83 ec 04             	sub    $0x4,%esp
+  800a2d:	89 f0                	mov    %esi,%eax
+  800a2f:	29 d8                	sub    %ebx,%eax
+  800a31:	50                   	push   %eax
+  800a32:	89 d8                	mov    %ebx,%eax
+  800a34:	03 45 0c             	add    0xc(%ebp),%eax
+  800a37:	50                   	push   %eax
+  800a38:	57                   	push   %edi
+  800a39:	e8 49 ff ff ff       	call   800987 <read>
+    if (m < 0)
+  800a3e:	83 c4 10             	add    $0x10,%esp
+  800a41:	85 c0                	test   %eax,%eax
+  800a43:	78 04                	js     800a49 <readn+0x3b>
+      return m;
+    if (m == 0)
+  800a45:	75 dd                	jne    800a24 <readn+0x16>
+  800a47:	eb 02                	jmp    800a4b <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  800a49:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  800a4b:	89 d8                	mov    %ebx,%eax
+  800a4d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a50:	5b                   	pop    %ebx
+  800a51:	5e                   	pop    %esi
+  800a52:	5f                   	pop    %edi
+  800a53:	5d                   	pop    %ebp
+  800a54:	c3                   	ret
+
+00800a55 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  800a55:	55                   	push   %ebp
+  800a56:	89 e5                	mov    %esp,%ebp
+  800a58:	56                   	push   %esi
+  800a59:	53                   	push   %ebx
+  800a5a:	83 ec 18             	sub    $0x18,%esp
+  800a5d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  800a60:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800a63:	50                   	push   %eax
+  800a64:	53                   	push   %ebx
+  800a65:	e8 72 fc ff ff       	call   8006dc <fd_lookup>
+  800a6a:	83 c4 10             	add    $0x10,%esp
+  800a6d:	85 c0                	test   %eax,%eax
+  800a6f:	78 37                	js     800aa8 <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800a71:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800a74:	83 ec 08             	sub    $0x8,%esp
+  800a77:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a7a:	50                   	push   %eax
+  800a7b:	ff 36                	push   (%esi)
+  800a7d:	e8 aa fc ff ff       	call   80072c <dev_lookup>
+  800a82:	83 c4 10             	add    $0x10,%esp
+  800a85:	85 c0                	test   %eax,%eax
+  800a87:	78 1f                	js     800aa8 <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800a89:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800a8d:	74 20                	je     800aaf <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  800a8f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a92:	8b 40 0c             	mov    0xc(%eax),%eax
+  800a95:	85 c0                	test   %eax,%eax
+  800a97:	74 37                	je     800ad0 <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  800a99:	83 ec 04             	sub    $0x4,%esp
+  800a9c:	ff 75 10             	push   0x10(%ebp)
+  800a9f:	ff 75 0c             	push   0xc(%ebp)
+  800aa2:	56                   	push   %esi
+  800aa3:	ff d0                	call   *%eax
+  800aa5:	83 c4 10             	add    $0x10,%esp
+}
+  800aa8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800aab:	5b                   	pop    %ebx
+  800aac:	5e                   	pop    %esi
+  800aad:	5d                   	pop    %ebp
+  800aae:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800aaf:	a1 44 57 80 00       	mov    0x805744,%eax
+  800ab4:	8b 40 48             	mov    0x48(%eax),%eax
+  800ab7:	83 ec 04             	sub    $0x4,%esp
+  800aba:	53                   	push   %ebx
+  800abb:	50                   	push   %eax
+  800abc:	68 f5 2e 80 00       	push   $0x802ef5
+  800ac1:	e8 88 16 00 00       	call   80214e <cprintf>
+    return -E_INVAL;
+  800ac6:	83 c4 10             	add    $0x10,%esp
+  800ac9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ace:	eb d8                	jmp    800aa8 <write+0x53>
+    return -E_NOT_SUPP;
+  800ad0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800ad5:	eb d1                	jmp    800aa8 <write+0x53>
+
+00800ad7 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  800ad7:	55                   	push   %ebp
+  800ad8:	89 e5                	mov    %esp,%ebp
+  800ada:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800add:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800ae0:	50                   	push   %eax
+  800ae1:	ff 75 08             	push   0x8(%ebp)
+  800ae4:	e8 f3 fb ff ff       	call   8006dc <fd_lookup>
+  800ae9:	83 c4 10             	add    $0x10,%esp
+  800aec:	85 c0                	test   %eax,%eax
+  800aee:	78 0e                	js     800afe <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  800af0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800af3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800af6:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  800af9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800afe:	c9                   	leave
+  800aff:	c3                   	ret
+
+00800b00 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800b00:	55                   	push   %ebp
+  800b01:	89 e5                	mov    %esp,%ebp
+  800b03:	56                   	push   %esi
+  800b04:	53                   	push   %ebx
+  800b05:	83 ec 18             	sub    $0x18,%esp
+  800b08:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  800b0b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800b0e:	50                   	push   %eax
+  800b0f:	53                   	push   %ebx
+  800b10:	e8 c7 fb ff ff       	call   8006dc <fd_lookup>
+  800b15:	83 c4 10             	add    $0x10,%esp
+  800b18:	85 c0                	test   %eax,%eax
+  800b1a:	78 34                	js     800b50 <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800b1c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800b1f:	83 ec 08             	sub    $0x8,%esp
+  800b22:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b25:	50                   	push   %eax
+  800b26:	ff 36                	push   (%esi)
+  800b28:	e8 ff fb ff ff       	call   80072c <dev_lookup>
+  800b2d:	83 c4 10             	add    $0x10,%esp
+  800b30:	85 c0                	test   %eax,%eax
+  800b32:	78 1c                	js     800b50 <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800b34:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800b38:	74 1d                	je     800b57 <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  800b3a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b3d:	8b 40 18             	mov    0x18(%eax),%eax
+  800b40:	85 c0                	test   %eax,%eax
+  800b42:	74 34                	je     800b78 <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  800b44:	83 ec 08             	sub    $0x8,%esp
+  800b47:	ff 75 0c             	push   0xc(%ebp)
+  800b4a:	56                   	push   %esi
+  800b4b:	ff d0                	call   *%eax
+  800b4d:	83 c4 10             	add    $0x10,%esp
+}
+  800b50:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b53:	5b                   	pop    %ebx
+  800b54:	5e                   	pop    %esi
+  800b55:	5d                   	pop    %ebp
+  800b56:	c3                   	ret
+            thisenv->env_id, fdnum);
+  800b57:	a1 44 57 80 00       	mov    0x805744,%eax
+  800b5c:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800b5f:	83 ec 04             	sub    $0x4,%esp
+  800b62:	53                   	push   %ebx
+  800b63:	50                   	push   %eax
+  800b64:	68 b8 2e 80 00       	push   $0x802eb8
+  800b69:	e8 e0 15 00 00       	call   80214e <cprintf>
+    return -E_INVAL;
+  800b6e:	83 c4 10             	add    $0x10,%esp
+  800b71:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b76:	eb d8                	jmp    800b50 <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  800b78:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800b7d:	eb d1                	jmp    800b50 <ftruncate+0x50>
+
+00800b7f <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800b7f:	55                   	push   %ebp
+  800b80:	89 e5                	mov    %esp,%ebp
+  800b82:	56                   	push   %esi
+  800b83:	53                   	push   %ebx
+  800b84:	83 ec 18             	sub    $0x18,%esp
+  800b87:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  800b8a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800b8d:	50                   	push   %eax
+  800b8e:	ff 75 08             	push   0x8(%ebp)
+  800b91:	e8 46 fb ff ff       	call   8006dc <fd_lookup>
+  800b96:	83 c4 10             	add    $0x10,%esp
+  800b99:	85 c0                	test   %eax,%eax
+  800b9b:	78 49                	js     800be6 <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800b9d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800ba0:	83 ec 08             	sub    $0x8,%esp
+  800ba3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800ba6:	50                   	push   %eax
+  800ba7:	ff 36                	push   (%esi)
+  800ba9:	e8 7e fb ff ff       	call   80072c <dev_lookup>
+  800bae:	83 c4 10             	add    $0x10,%esp
+  800bb1:	85 c0                	test   %eax,%eax
+  800bb3:	78 31                	js     800be6 <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  800bb5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800bb8:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800bbc:	74 2f                	je     800bed <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  800bbe:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  800bc1:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800bc8:	00 00 00 
+  stat->st_isdir = 0;
+  800bcb:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800bd2:	00 00 00 
+  stat->st_dev = dev;
+  800bd5:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  800bdb:	83 ec 08             	sub    $0x8,%esp
+  800bde:	53                   	push   %ebx
+  800bdf:	56                   	push   %esi
+  800be0:	ff 50 14             	call   *0x14(%eax)
+  800be3:	83 c4 10             	add    $0x10,%esp
+}
+  800be6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800be9:	5b                   	pop    %ebx
+  800bea:	5e                   	pop    %esi
+  800beb:	5d                   	pop    %ebp
+  800bec:	c3                   	ret
+    return -E_NOT_SUPP;
+  800bed:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800bf2:	eb f2                	jmp    800be6 <fstat+0x67>
+
+00800bf4 <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  800bf4:	55                   	push   %ebp
+  800bf5:	89 e5                	mov    %esp,%ebp
+  800bf7:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  800bfa:	ff 75 0c             	push   0xc(%ebp)
+  800bfd:	ff 75 08             	push   0x8(%ebp)
+  800c00:	e8 58 07 00 00       	call   80135d <file_stat>
+}
+  800c05:	c9                   	leave
+  800c06:	c3                   	ret
+
+00800c07 <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  800c07:	55                   	push   %ebp
+  800c08:	89 e5                	mov    %esp,%ebp
+  800c0a:	57                   	push   %edi
+  800c0b:	56                   	push   %esi
+  800c0c:	53                   	push   %ebx
+  800c0d:	83 ec 1c             	sub    $0x1c,%esp
+  800c10:	89 c7                	mov    %eax,%edi
+  800c12:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  800c15:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  800c18:	e9 a2 00 00 00       	jmp    800cbf <fsipc_send+0xb8>
+  nfsenvs = 0;
+  800c1d:	c7 05 00 50 80 00 00 	movl   $0x0,0x805000
+  800c24:	00 00 00 
+  800c27:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c2c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  800c31:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  800c36:	be 01 00 00 00       	mov    $0x1,%esi
+  800c3b:	eb 0f                	jmp    800c4c <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  800c3d:	83 c0 01             	add    $0x1,%eax
+  800c40:	3d 00 04 00 00       	cmp    $0x400,%eax
+  800c45:	74 49                	je     800c90 <fsipc_send+0x89>
+  800c47:	83 f9 07             	cmp    $0x7,%ecx
+  800c4a:	7f 50                	jg     800c9c <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  800c4c:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  800c4f:	c1 e2 04             	shl    $0x4,%edx
+  800c52:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800c58:	8b 52 50             	mov    0x50(%edx),%edx
+  800c5b:	83 fa 01             	cmp    $0x1,%edx
+  800c5e:	75 dd                	jne    800c3d <fsipc_send+0x36>
+  800c60:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  800c63:	c1 e2 04             	shl    $0x4,%edx
+  800c66:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800c6c:	8b 52 54             	mov    0x54(%edx),%edx
+  800c6f:	85 d2                	test   %edx,%edx
+  800c71:	74 ca                	je     800c3d <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  800c73:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  800c76:	c1 e2 04             	shl    $0x4,%edx
+  800c79:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800c7f:	8b 52 48             	mov    0x48(%edx),%edx
+  800c82:	89 14 8d 20 50 80 00 	mov    %edx,0x805020(,%ecx,4)
+  800c89:	8d 49 01             	lea    0x1(%ecx),%ecx
+  800c8c:	89 f3                	mov    %esi,%ebx
+  800c8e:	eb ad                	jmp    800c3d <fsipc_send+0x36>
+  800c90:	84 db                	test   %bl,%bl
+  800c92:	74 38                	je     800ccc <fsipc_send+0xc5>
+  800c94:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  800c9a:	eb 30                	jmp    800ccc <fsipc_send+0xc5>
+  800c9c:	84 db                	test   %bl,%bl
+  800c9e:	74 2c                	je     800ccc <fsipc_send+0xc5>
+  800ca0:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  800ca6:	eb 24                	jmp    800ccc <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  800ca8:	50                   	push   %eax
+  800ca9:	68 24 2f 80 00       	push   $0x802f24
+  800cae:	6a 34                	push   $0x34
+  800cb0:	68 2e 2f 80 00       	push   $0x802f2e
+  800cb5:	e8 b9 13 00 00       	call   802073 <_panic>
+    }
+    sys_yield();
+  800cba:	e8 92 f4 ff ff       	call   800151 <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  800cbf:	83 3d 00 50 80 00 03 	cmpl   $0x3,0x805000
+  800cc6:	0f 8e 51 ff ff ff    	jle    800c1d <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  800ccc:	a1 44 57 80 00       	mov    0x805744,%eax
+  800cd1:	8b 70 48             	mov    0x48(%eax),%esi
+  800cd4:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  800cda:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cdf:	8b 0d 00 50 80 00    	mov    0x805000,%ecx
+  800ce5:	39 d9                	cmp    %ebx,%ecx
+  800ce7:	7e d1                	jle    800cba <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  800ce9:	83 ec 0c             	sub    $0xc,%esp
+  800cec:	ff 75 e0             	push   -0x20(%ebp)
+  800cef:	6a 07                	push   $0x7
+  800cf1:	ff 75 e4             	push   -0x1c(%ebp)
+  800cf4:	57                   	push   %edi
+  800cf5:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  800cf8:	99                   	cltd
+  800cf9:	f7 f9                	idiv   %ecx
+  800cfb:	ff 34 95 20 50 80 00 	push   0x805020(,%edx,4)
+  800d02:	e8 63 f7 ff ff       	call   80046a <sys_ipc_try_send>
+      if (r == 0)
+  800d07:	83 c4 20             	add    $0x20,%esp
+  800d0a:	85 c0                	test   %eax,%eax
+  800d0c:	74 0a                	je     800d18 <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  800d0e:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  800d11:	75 95                	jne    800ca8 <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  800d13:	83 c3 01             	add    $0x1,%ebx
+  800d16:	eb c7                	jmp    800cdf <fsipc_send+0xd8>
+  }
+}
+  800d18:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d1b:	5b                   	pop    %ebx
+  800d1c:	5e                   	pop    %esi
+  800d1d:	5f                   	pop    %edi
+  800d1e:	5d                   	pop    %ebp
+  800d1f:	c3                   	ret
+
+00800d20 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  800d20:	55                   	push   %ebp
+  800d21:	89 e5                	mov    %esp,%ebp
+  800d23:	53                   	push   %ebx
+  800d24:	83 ec 14             	sub    $0x14,%esp
+  800d27:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  800d29:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  800d30:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800d35:	ba 00 60 80 00       	mov    $0x806000,%edx
+  800d3a:	e8 c8 fe ff ff       	call   800c07 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  800d3f:	6a 00                	push   $0x0
+  800d41:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800d44:	50                   	push   %eax
+  800d45:	53                   	push   %ebx
+  800d46:	6a 00                	push   $0x0
+  800d48:	e8 1f 1d 00 00       	call   802a6c <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  800d4d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d50:	c9                   	leave
+  800d51:	c3                   	ret
+
+00800d52 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  800d52:	55                   	push   %ebp
+  800d53:	89 e5                	mov    %esp,%ebp
+  800d55:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800d58:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d5b:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d5e:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.set_size.req_size = newsize;
+  800d63:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d66:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  800d6b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d70:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d75:	e8 a6 ff ff ff       	call   800d20 <fsipc>
+}
+  800d7a:	c9                   	leave
+  800d7b:	c3                   	ret
+
+00800d7c <devfile_flush>:
+{
+  800d7c:	55                   	push   %ebp
+  800d7d:	89 e5                	mov    %esp,%ebp
+  800d7f:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800d82:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d85:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d88:	a3 00 60 80 00       	mov    %eax,0x806000
+  return fsipc(FSREQ_FLUSH, NULL);
+  800d8d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d92:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d97:	e8 84 ff ff ff       	call   800d20 <fsipc>
+}
+  800d9c:	c9                   	leave
+  800d9d:	c3                   	ret
+
+00800d9e <devfile_stat>:
+{
+  800d9e:	55                   	push   %ebp
+  800d9f:	89 e5                	mov    %esp,%ebp
+  800da1:	53                   	push   %ebx
+  800da2:	83 ec 04             	sub    $0x4,%esp
+  800da5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800da8:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dab:	8b 40 0c             	mov    0xc(%eax),%eax
+  800dae:	a3 00 60 80 00       	mov    %eax,0x806000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  800db3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800db8:	b8 05 00 00 00       	mov    $0x5,%eax
+  800dbd:	e8 5e ff ff ff       	call   800d20 <fsipc>
+  800dc2:	85 c0                	test   %eax,%eax
+  800dc4:	78 2c                	js     800df2 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800dc6:	83 ec 08             	sub    $0x8,%esp
+  800dc9:	68 00 60 80 00       	push   $0x806000
+  800dce:	53                   	push   %ebx
+  800dcf:	e8 68 19 00 00       	call   80273c <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  800dd4:	a1 80 60 80 00       	mov    0x806080,%eax
+  800dd9:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800ddf:	a1 84 60 80 00       	mov    0x806084,%eax
+  800de4:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  800dea:	83 c4 10             	add    $0x10,%esp
+  800ded:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800df2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800df5:	c9                   	leave
+  800df6:	c3                   	ret
+
+00800df7 <fsv_alloc>:
+{
+  800df7:	55                   	push   %ebp
+  800df8:	89 e5                	mov    %esp,%ebp
+  800dfa:	56                   	push   %esi
+  800dfb:	53                   	push   %ebx
+  800dfc:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  800dfe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e03:	eb 22                	jmp    800e27 <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  800e05:	83 ec 04             	sub    $0x4,%esp
+  800e08:	6a 00                	push   $0x0
+  800e0a:	6a 00                	push   $0x0
+  800e0c:	6a 07                	push   $0x7
+  800e0e:	50                   	push   %eax
+  800e0f:	6a 00                	push   $0x0
+  800e11:	6a 04                	push   $0x4
+  800e13:	68 40 50 80 00       	push   $0x805040
+  800e18:	e8 e9 f7 ff ff       	call   800606 <sysbatch_add>
+  800e1d:	83 c4 20             	add    $0x20,%esp
+  800e20:	85 c0                	test   %eax,%eax
+  800e22:	78 48                	js     800e6c <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  800e24:	83 c3 01             	add    $0x1,%ebx
+  800e27:	39 f3                	cmp    %esi,%ebx
+  800e29:	74 31                	je     800e5c <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  800e2b:	89 d8                	mov    %ebx,%eax
+  800e2d:	c1 e0 0c             	shl    $0xc,%eax
+  800e30:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  800e35:	89 c2                	mov    %eax,%edx
+  800e37:	c1 ea 16             	shr    $0x16,%edx
+  800e3a:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800e41:	f6 c2 01             	test   $0x1,%dl
+  800e44:	74 bf                	je     800e05 <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  800e46:	89 c2                	mov    %eax,%edx
+  800e48:	c1 ea 0c             	shr    $0xc,%edx
+  800e4b:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800e52:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  800e55:	83 fa 03             	cmp    $0x3,%edx
+  800e58:	75 ab                	jne    800e05 <fsv_alloc+0xe>
+  800e5a:	eb c8                	jmp    800e24 <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  800e5c:	83 ec 0c             	sub    $0xc,%esp
+  800e5f:	68 40 50 80 00       	push   $0x805040
+  800e64:	e8 4d f7 ff ff       	call   8005b6 <sysbatch_flush>
+  800e69:	83 c4 10             	add    $0x10,%esp
+}
+  800e6c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e6f:	5b                   	pop    %ebx
+  800e70:	5e                   	pop    %esi
+  800e71:	5d                   	pop    %ebp
+  800e72:	c3                   	ret
+
+00800e73 <devfile_read>:
+{
+  800e73:	55                   	push   %ebp
+  800e74:	89 e5                	mov    %esp,%ebp
+  800e76:	57                   	push   %edi
+  800e77:	56                   	push   %esi
+  800e78:	53                   	push   %ebx
+  800e79:	83 ec 3c             	sub    $0x3c,%esp
+  800e7c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  800e7f:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  800e85:	77 57                	ja     800ede <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800e87:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e8a:	8b 40 0c             	mov    0xc(%eax),%eax
+  800e8d:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read.req_n = n;
+  800e92:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  800e98:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e9d:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ea2:	e8 79 fe ff ff       	call   800d20 <fsipc>
+  800ea7:	89 c6                	mov    %eax,%esi
+  800ea9:	85 c0                	test   %eax,%eax
+  800eab:	78 27                	js     800ed4 <devfile_read+0x61>
+  assert(r <= n);
+  800ead:	39 c3                	cmp    %eax,%ebx
+  800eaf:	0f 82 0e 02 00 00    	jb     8010c3 <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  800eb5:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800eba:	0f 8f 1c 02 00 00    	jg     8010dc <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  800ec0:	83 ec 04             	sub    $0x4,%esp
+  800ec3:	50                   	push   %eax
+  800ec4:	68 00 60 80 00       	push   $0x806000
+  800ec9:	ff 75 0c             	push   0xc(%ebp)
+  800ecc:	e8 f1 19 00 00       	call   8028c2 <memmove>
+  return r;
+  800ed1:	83 c4 10             	add    $0x10,%esp
+}
+  800ed4:	89 f0                	mov    %esi,%eax
+  800ed6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ed9:	5b                   	pop    %ebx
+  800eda:	5e                   	pop    %esi
+  800edb:	5f                   	pop    %edi
+  800edc:	5d                   	pop    %ebp
+  800edd:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  800ede:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ee3:	e8 0f ff ff ff       	call   800df7 <fsv_alloc>
+  800ee8:	89 c6                	mov    %eax,%esi
+  800eea:	85 c0                	test   %eax,%eax
+  800eec:	78 e6                	js     800ed4 <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  800eee:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ef1:	8b 40 0c             	mov    0xc(%eax),%eax
+  800ef4:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  800ef9:	8b 45 08             	mov    0x8(%ebp),%eax
+  800efc:	8b 40 04             	mov    0x4(%eax),%eax
+  800eff:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  800f04:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  800f0a:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  800f11:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800f16:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  800f1b:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f20:	e8 e2 fc ff ff       	call   800c07 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  800f25:	6a 00                	push   $0x0
+  800f27:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800f2a:	50                   	push   %eax
+  800f2b:	68 00 10 c0 9f       	push   $0x9fc01000
+  800f30:	6a 00                	push   $0x0
+  800f32:	e8 35 1b 00 00       	call   802a6c <ipc_recv_pages>
+  800f37:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  800f39:	83 c4 10             	add    $0x10,%esp
+  800f3c:	85 c0                	test   %eax,%eax
+  800f3e:	7e 94                	jle    800ed4 <devfile_read+0x61>
+  assert(r <= n);
+  800f40:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800f43:	39 c3                	cmp    %eax,%ebx
+  800f45:	72 2e                	jb     800f75 <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  800f47:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f4a:	8b 40 04             	mov    0x4(%eax),%eax
+  800f4d:	25 ff 0f 00 00       	and    $0xfff,%eax
+  800f52:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  800f55:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800f58:	c1 e2 0c             	shl    $0xc,%edx
+  800f5b:	39 ca                	cmp    %ecx,%edx
+  800f5d:	72 2f                	jb     800f8e <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  800f5f:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  800f64:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  800f67:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  800f6b:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  800f70:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  800f73:	eb 52                	jmp    800fc7 <devfile_read+0x154>
+  assert(r <= n);
+  800f75:	68 39 2f 80 00       	push   $0x802f39
+  800f7a:	68 40 2f 80 00       	push   $0x802f40
+  800f7f:	68 49 01 00 00       	push   $0x149
+  800f84:	68 2e 2f 80 00       	push   $0x802f2e
+  800f89:	e8 e5 10 00 00       	call   802073 <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  800f8e:	68 64 2f 80 00       	push   $0x802f64
+  800f93:	68 40 2f 80 00       	push   $0x802f40
+  800f98:	68 4a 01 00 00       	push   $0x14a
+  800f9d:	68 2e 2f 80 00       	push   $0x802f2e
+  800fa2:	e8 cc 10 00 00       	call   802073 <_panic>
+      memmove(dst + done, src + done, m);
+  800fa7:	83 ec 04             	sub    $0x4,%esp
+  800faa:	53                   	push   %ebx
+  800fab:	56                   	push   %esi
+  800fac:	89 f8                	mov    %edi,%eax
+  800fae:	03 45 0c             	add    0xc(%ebp),%eax
+  800fb1:	50                   	push   %eax
+  800fb2:	e8 0b 19 00 00       	call   8028c2 <memmove>
+  800fb7:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  800fba:	01 df                	add    %ebx,%edi
+  800fbc:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800fbf:	39 c7                	cmp    %eax,%edi
+  800fc1:	0f 83 c0 00 00 00    	jae    801087 <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  800fc7:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800fca:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  800fcd:	89 f0                	mov    %esi,%eax
+  800fcf:	25 ff 0f 00 00       	and    $0xfff,%eax
+  800fd4:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  800fd9:	29 c3                	sub    %eax,%ebx
+  800fdb:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800fde:	29 f8                	sub    %edi,%eax
+  800fe0:	39 c3                	cmp    %eax,%ebx
+  800fe2:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  800fe5:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  800feb:	75 ba                	jne    800fa7 <devfile_read+0x134>
+  800fed:	89 f9                	mov    %edi,%ecx
+  800fef:	03 4d 0c             	add    0xc(%ebp),%ecx
+  800ff2:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  800ff5:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  800ffb:	75 aa                	jne    800fa7 <devfile_read+0x134>
+  800ffd:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  801003:	77 a2                	ja     800fa7 <devfile_read+0x134>
+  801005:	89 c8                	mov    %ecx,%eax
+  801007:	c1 e8 16             	shr    $0x16,%eax
+  80100a:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801011:	a8 01                	test   $0x1,%al
+  801013:	74 92                	je     800fa7 <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  801015:	89 c8                	mov    %ecx,%eax
+  801017:	c1 e8 0c             	shr    $0xc,%eax
+  80101a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  801021:	a8 01                	test   $0x1,%al
+  801023:	74 82                	je     800fa7 <devfile_read+0x134>
+  801025:	a9 02 08 00 00       	test   $0x802,%eax
+  80102a:	0f 84 77 ff ff ff    	je     800fa7 <devfile_read+0x134>
+  801030:	f6 c4 04             	test   $0x4,%ah
+  801033:	0f 85 6e ff ff ff    	jne    800fa7 <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  801039:	a1 44 57 80 00       	mov    0x805744,%eax
+  80103e:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  801042:	84 c0                	test   %al,%al
+  801044:	75 17                	jne    80105d <devfile_read+0x1ea>
+  801046:	83 ec 08             	sub    $0x8,%esp
+  801049:	6a 01                	push   $0x1
+  80104b:	6a 00                	push   $0x0
+  80104d:	e8 1e f1 ff ff       	call   800170 <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  801052:	83 c4 10             	add    $0x10,%esp
+  801055:	85 c0                	test   %eax,%eax
+  801057:	0f 85 4a ff ff ff    	jne    800fa7 <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  80105d:	83 ec 04             	sub    $0x4,%esp
+  801060:	68 05 08 00 00       	push   $0x805
+  801065:	ff 75 cc             	push   -0x34(%ebp)
+  801068:	6a 00                	push   $0x0
+  80106a:	56                   	push   %esi
+  80106b:	6a 00                	push   $0x0
+  80106d:	6a 05                	push   $0x5
+  80106f:	68 40 50 80 00       	push   $0x805040
+  801074:	e8 8d f5 ff ff       	call   800606 <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  801079:	c1 e8 1f             	shr    $0x1f,%eax
+  80107c:	08 45 cb             	or     %al,-0x35(%ebp)
+  80107f:	83 c4 20             	add    $0x20,%esp
+  801082:	e9 33 ff ff ff       	jmp    800fba <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  801087:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  80108a:	83 ec 0c             	sub    $0xc,%esp
+  80108d:	68 40 50 80 00       	push   $0x805040
+  801092:	e8 1f f5 ff ff       	call   8005b6 <sysbatch_flush>
+  801097:	83 c4 10             	add    $0x10,%esp
+  80109a:	85 c0                	test   %eax,%eax
+  80109c:	78 06                	js     8010a4 <devfile_read+0x231>
+  80109e:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  8010a2:	74 14                	je     8010b8 <devfile_read+0x245>
+    memmove(dst, src, r);
+  8010a4:	83 ec 04             	sub    $0x4,%esp
+  8010a7:	ff 75 d4             	push   -0x2c(%ebp)
+  8010aa:	ff 75 d0             	push   -0x30(%ebp)
+  8010ad:	ff 75 0c             	push   0xc(%ebp)
+  8010b0:	e8 0d 18 00 00       	call   8028c2 <memmove>
+  8010b5:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  8010b8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010bb:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  8010be:	e9 11 fe ff ff       	jmp    800ed4 <devfile_read+0x61>
+  assert(r <= n);
+  8010c3:	68 39 2f 80 00       	push   $0x802f39
+  8010c8:	68 40 2f 80 00       	push   $0x802f40
+  8010cd:	68 1c 01 00 00       	push   $0x11c
+  8010d2:	68 2e 2f 80 00       	push   $0x802f2e
+  8010d7:	e8 97 0f 00 00       	call   802073 <_panic>
+  assert(r <= PGSIZE);
+  8010dc:	68 55 2f 80 00       	push   $0x802f55
+  8010e1:	68 40 2f 80 00       	push   $0x802f40
+  8010e6:	68 1d 01 00 00       	push   $0x11d
+  8010eb:	68 2e 2f 80 00       	push   $0x802f2e
+  8010f0:	e8 7e 0f 00 00       	call   802073 <_panic>
+
+008010f5 <devfile_write>:
+{
+  8010f5:	55                   	push   %ebp
+  8010f6:	89 e5                	mov    %esp,%ebp
+  8010f8:	57                   	push   %edi
+  8010f9:	56                   	push   %esi
+  8010fa:	53                   	push   %ebx
+  8010fb:	83 ec 1c             	sub    $0x1c,%esp
+  8010fe:	8b 75 08             	mov    0x8(%ebp),%esi
+  801101:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  801104:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  801109:	77 39                	ja     801144 <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80110b:	8b 56 0c             	mov    0xc(%esi),%edx
+  80110e:	89 15 00 60 80 00    	mov    %edx,0x806000
+  fsipcbuf.write.req_n = n;
+  801114:	a3 04 60 80 00       	mov    %eax,0x806004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  801119:	83 ec 04             	sub    $0x4,%esp
+  80111c:	50                   	push   %eax
+  80111d:	ff 75 0c             	push   0xc(%ebp)
+  801120:	68 08 60 80 00       	push   $0x806008
+  801125:	e8 98 17 00 00       	call   8028c2 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  80112a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80112f:	b8 04 00 00 00       	mov    $0x4,%eax
+  801134:	e8 e7 fb ff ff       	call   800d20 <fsipc>
+  801139:	83 c4 10             	add    $0x10,%esp
+}
+  80113c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80113f:	5b                   	pop    %ebx
+  801140:	5e                   	pop    %esi
+  801141:	5f                   	pop    %edi
+  801142:	5d                   	pop    %ebp
+  801143:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  801144:	ba 00 00 10 00       	mov    $0x100000,%edx
+  801149:	39 d0                	cmp    %edx,%eax
+  80114b:	89 d3                	mov    %edx,%ebx
+  80114d:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  801150:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  801156:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  801159:	83 c7 01             	add    $0x1,%edi
+  80115c:	89 f8                	mov    %edi,%eax
+  80115e:	e8 94 fc ff ff       	call   800df7 <fsv_alloc>
+  801163:	85 c0                	test   %eax,%eax
+  801165:	78 d5                	js     80113c <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  801167:	83 ec 04             	sub    $0x4,%esp
+  80116a:	53                   	push   %ebx
+  80116b:	ff 75 0c             	push   0xc(%ebp)
+  80116e:	68 00 10 c0 9f       	push   $0x9fc01000
+  801173:	e8 4a 17 00 00       	call   8028c2 <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  801178:	8b 46 0c             	mov    0xc(%esi),%eax
+  80117b:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  801180:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  801186:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  80118d:	89 f9                	mov    %edi,%ecx
+  80118f:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801194:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801199:	e8 69 fa ff ff       	call   800c07 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  80119e:	6a 00                	push   $0x0
+  8011a0:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8011a3:	50                   	push   %eax
+  8011a4:	6a 00                	push   $0x0
+  8011a6:	6a 00                	push   $0x0
+  8011a8:	e8 bf 18 00 00       	call   802a6c <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  8011ad:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  8011b0:	eb 8a                	jmp    80113c <devfile_write+0x47>
+
+008011b2 <open>:
+{
+  8011b2:	55                   	push   %ebp
+  8011b3:	89 e5                	mov    %esp,%ebp
+  8011b5:	56                   	push   %esi
+  8011b6:	53                   	push   %ebx
+  8011b7:	83 ec 1c             	sub    $0x1c,%esp
+  8011ba:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  8011bd:	56                   	push   %esi
+  8011be:	e8 3e 15 00 00       	call   802701 <strlen>
+  8011c3:	83 c4 10             	add    $0x10,%esp
+  8011c6:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8011cb:	7f 6c                	jg     801239 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  8011cd:	83 ec 0c             	sub    $0xc,%esp
+  8011d0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8011d3:	50                   	push   %eax
+  8011d4:	e8 ad f4 ff ff       	call   800686 <fd_alloc>
+  8011d9:	89 c3                	mov    %eax,%ebx
+  8011db:	83 c4 10             	add    $0x10,%esp
+  8011de:	85 c0                	test   %eax,%eax
+  8011e0:	78 3c                	js     80121e <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  8011e2:	83 ec 08             	sub    $0x8,%esp
+  8011e5:	56                   	push   %esi
+  8011e6:	68 00 60 80 00       	push   $0x806000
+  8011eb:	e8 4c 15 00 00       	call   80273c <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  8011f0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8011f3:	a3 00 64 80 00       	mov    %eax,0x806400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8011f8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8011fb:	b8 01 00 00 00       	mov    $0x1,%eax
+  801200:	e8 1b fb ff ff       	call   800d20 <fsipc>
+  801205:	89 c3                	mov    %eax,%ebx
+  801207:	83 c4 10             	add    $0x10,%esp
+  80120a:	85 c0                	test   %eax,%eax
+  80120c:	78 19                	js     801227 <open+0x75>
+  return fd2num(fd);
+  80120e:	83 ec 0c             	sub    $0xc,%esp
+  801211:	ff 75 f4             	push   -0xc(%ebp)
+  801214:	e8 49 f4 ff ff       	call   800662 <fd2num>
+  801219:	89 c3                	mov    %eax,%ebx
+  80121b:	83 c4 10             	add    $0x10,%esp
+}
+  80121e:	89 d8                	mov    %ebx,%eax
+  801220:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801223:	5b                   	pop    %ebx
+  801224:	5e                   	pop    %esi
+  801225:	5d                   	pop    %ebp
+  801226:	c3                   	ret
+    fd_close(fd, 0);
+  801227:	83 ec 08             	sub    $0x8,%esp
+  80122a:	6a 00                	push   $0x0
+  80122c:	ff 75 f4             	push   -0xc(%ebp)
+  80122f:	e8 44 f5 ff ff       	call   800778 <fd_close>
+    return r;
+  801234:	83 c4 10             	add    $0x10,%esp
+  801237:	eb e5                	jmp    80121e <open+0x6c>
+    return -E_BAD_PATH;
+  801239:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80123e:	eb de                	jmp    80121e <open+0x6c>
+
+00801240 <open_read>:
+{
+  801240:	55                   	push   %ebp
+  801241:	89 e5                	mov    %esp,%ebp
+  801243:	57                   	push   %edi
+  801244:	56                   	push   %esi
+  801245:	53                   	push   %ebx
+  801246:	83 ec 28             	sub    $0x28,%esp
+  801249:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  80124c:	57                   	push   %edi
+  80124d:	e8 af 14 00 00       	call   802701 <strlen>
+  801252:	83 c4 10             	add    $0x10,%esp
+  801255:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80125a:	0f 87 f6 00 00 00    	ja     801356 <open_read+0x116>
+  801260:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  801262:	83 ec 0c             	sub    $0xc,%esp
+  801265:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801268:	50                   	push   %eax
+  801269:	e8 18 f4 ff ff       	call   800686 <fd_alloc>
+  80126e:	89 c3                	mov    %eax,%ebx
+  801270:	83 c4 10             	add    $0x10,%esp
+  801273:	85 c0                	test   %eax,%eax
+  801275:	0f 88 b2 00 00 00    	js     80132d <open_read+0xed>
+  strcpy(req->req_buf, path);
+  80127b:	83 ec 08             	sub    $0x8,%esp
+  80127e:	57                   	push   %edi
+  80127f:	68 e4 60 80 00       	push   $0x8060e4
+  801284:	e8 b3 14 00 00       	call   80273c <strcpy>
+  req->req_nops = 2;
+  801289:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  801290:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  801293:	c7 05 04 60 80 00 01 	movl   $0x1,0x806004
+  80129a:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  80129d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8012a0:	a3 10 60 80 00       	mov    %eax,0x806010
+  req->req_ops[0].op_buf = 0;
+  8012a5:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  8012ac:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  8012af:	c7 05 20 60 80 00 04 	movl   $0x4,0x806020
+  8012b6:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  8012b9:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  8012c0:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  8012c3:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  8012c8:	29 f0                	sub    %esi,%eax
+  8012ca:	3b 45 14             	cmp    0x14(%ebp),%eax
+  8012cd:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  8012d1:	a3 2c 60 80 00       	mov    %eax,0x80602c
+  req->req_ops[1].op_offset = 0;
+  8012d6:	c7 05 30 60 80 00 00 	movl   $0x0,0x806030
+  8012dd:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  8012e0:	83 c6 01             	add    $0x1,%esi
+  8012e3:	89 35 34 60 80 00    	mov    %esi,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  8012e9:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8012ec:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8012f1:	e8 2a fa ff ff       	call   800d20 <fsipc>
+  8012f6:	89 c3                	mov    %eax,%ebx
+  8012f8:	83 c4 10             	add    $0x10,%esp
+  8012fb:	83 f8 01             	cmp    $0x1,%eax
+  8012fe:	7e 37                	jle    801337 <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  801300:	a1 38 60 80 00       	mov    0x806038,%eax
+  801305:	8b 55 18             	mov    0x18(%ebp),%edx
+  801308:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  80130a:	83 ec 04             	sub    $0x4,%esp
+  80130d:	50                   	push   %eax
+  80130e:	81 c6 e4 60 80 00    	add    $0x8060e4,%esi
+  801314:	56                   	push   %esi
+  801315:	ff 75 10             	push   0x10(%ebp)
+  801318:	e8 a5 15 00 00       	call   8028c2 <memmove>
+  return fd2num(fd);
+  80131d:	83 c4 04             	add    $0x4,%esp
+  801320:	ff 75 e4             	push   -0x1c(%ebp)
+  801323:	e8 3a f3 ff ff       	call   800662 <fd2num>
+  801328:	89 c3                	mov    %eax,%ebx
+  80132a:	83 c4 10             	add    $0x10,%esp
+}
+  80132d:	89 d8                	mov    %ebx,%eax
+  80132f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801332:	5b                   	pop    %ebx
+  801333:	5e                   	pop    %esi
+  801334:	5f                   	pop    %edi
+  801335:	5d                   	pop    %ebp
+  801336:	c3                   	ret
+    fd_close(fd, 0);
+  801337:	83 ec 08             	sub    $0x8,%esp
+  80133a:	6a 00                	push   $0x0
+  80133c:	ff 75 e4             	push   -0x1c(%ebp)
+  80133f:	e8 34 f4 ff ff       	call   800778 <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  801344:	83 c4 10             	add    $0x10,%esp
+  801347:	85 db                	test   %ebx,%ebx
+  801349:	78 e2                	js     80132d <open_read+0xed>
+  80134b:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  80134e:	8b 9b 1c 60 80 00    	mov    0x80601c(%ebx),%ebx
+  801354:	eb d7                	jmp    80132d <open_read+0xed>
+    return -E_BAD_PATH;
+  801356:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80135b:	eb d0                	jmp    80132d <open_read+0xed>
+
+0080135d <file_stat>:
+{
+  80135d:	55                   	push   %ebp
+  80135e:	89 e5                	mov    %esp,%ebp
+  801360:	57                   	push   %edi
+  801361:	56                   	push   %esi
+  801362:	53                   	push   %ebx
+  801363:	83 ec 18             	sub    $0x18,%esp
+  801366:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801369:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  80136c:	57                   	push   %edi
+  80136d:	e8 8f 13 00 00       	call   802701 <strlen>
+  801372:	83 c4 10             	add    $0x10,%esp
+  801375:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80137a:	0f 8f c7 00 00 00    	jg     801447 <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  801380:	83 ec 0c             	sub    $0xc,%esp
+  801383:	57                   	push   %edi
+  801384:	e8 78 13 00 00       	call   802701 <strlen>
+  801389:	8d 58 04             	lea    0x4(%eax),%ebx
+  80138c:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  80138f:	83 c4 08             	add    $0x8,%esp
+  801392:	57                   	push   %edi
+  801393:	68 e4 60 80 00       	push   $0x8060e4
+  801398:	e8 9f 13 00 00       	call   80273c <strcpy>
+  req->req_nops = 2;
+  80139d:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  8013a4:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  8013a7:	c7 05 04 60 80 00 02 	movl   $0x2,0x806004
+  8013ae:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  8013b1:	c7 05 10 60 80 00 00 	movl   $0x0,0x806010
+  8013b8:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  8013bb:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  8013c2:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  8013c5:	c7 05 20 60 80 00 03 	movl   $0x3,0x806020
+  8013cc:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  8013cf:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  8013d6:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  8013d9:	89 1d 34 60 80 00    	mov    %ebx,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  8013df:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013e4:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8013e9:	e8 32 f9 ff ff       	call   800d20 <fsipc>
+  8013ee:	83 c4 10             	add    $0x10,%esp
+  8013f1:	83 f8 01             	cmp    $0x1,%eax
+  8013f4:	7e 42                	jle    801438 <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  8013f6:	81 c3 e4 60 80 00    	add    $0x8060e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  8013fc:	83 ec 08             	sub    $0x8,%esp
+  8013ff:	53                   	push   %ebx
+  801400:	56                   	push   %esi
+  801401:	e8 36 13 00 00       	call   80273c <strcpy>
+  st->st_size = ret->ret_size;
+  801406:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  80140c:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  801412:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  801418:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  80141e:	c7 86 88 00 00 00 04 	movl   $0x804004,0x88(%esi)
+  801425:	40 80 00 
+  return 0;
+  801428:	83 c4 10             	add    $0x10,%esp
+  80142b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801430:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801433:	5b                   	pop    %ebx
+  801434:	5e                   	pop    %esi
+  801435:	5f                   	pop    %edi
+  801436:	5d                   	pop    %ebp
+  801437:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  801438:	85 c0                	test   %eax,%eax
+  80143a:	78 f4                	js     801430 <file_stat+0xd3>
+  80143c:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80143f:	8b 80 1c 60 80 00    	mov    0x80601c(%eax),%eax
+  801445:	eb e9                	jmp    801430 <file_stat+0xd3>
+    return -E_BAD_PATH;
+  801447:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  80144c:	eb e2                	jmp    801430 <file_stat+0xd3>
+
+0080144e <read_map>:
+{
+  80144e:	55                   	push   %ebp
+  80144f:	89 e5                	mov    %esp,%ebp
+  801451:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801454:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801457:	50                   	push   %eax
+  801458:	ff 75 08             	push   0x8(%ebp)
+  80145b:	e8 7c f2 ff ff       	call   8006dc <fd_lookup>
+  801460:	83 c4 10             	add    $0x10,%esp
+  801463:	85 c0                	test   %eax,%eax
+  801465:	78 2a                	js     801491 <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  801467:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80146a:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  801470:	39 08                	cmp    %ecx,(%eax)
+  801472:	75 1f                	jne    801493 <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  801474:	8b 40 0c             	mov    0xc(%eax),%eax
+  801477:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read_map.req_offset = offset;
+  80147c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80147f:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  801484:	8b 55 10             	mov    0x10(%ebp),%edx
+  801487:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80148c:	e8 8f f8 ff ff       	call   800d20 <fsipc>
+}
+  801491:	c9                   	leave
+  801492:	c3                   	ret
+    return -E_INVAL;
+  801493:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801498:	eb f7                	jmp    801491 <read_map+0x43>
+
+0080149a <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80149a:	55                   	push   %ebp
+  80149b:	89 e5                	mov    %esp,%ebp
+  80149d:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  8014a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014a5:	b8 08 00 00 00       	mov    $0x8,%eax
+  8014aa:	e8 71 f8 ff ff       	call   800d20 <fsipc>
+}
+  8014af:	c9                   	leave
+  8014b0:	c3                   	ret
+
+008014b1 <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  8014b1:	55                   	push   %ebp
+  8014b2:	89 e5                	mov    %esp,%ebp
+  8014b4:	57                   	push   %edi
+  8014b5:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  8014b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014b9:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.stats.req_bio_sched = 0;
+  8014be:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  8014c5:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  8014c8:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  8014cf:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  8014d2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014d7:	b8 09 00 00 00       	mov    $0x9,%eax
+  8014dc:	e8 3f f8 ff ff       	call   800d20 <fsipc>
+  8014e1:	85 c0                	test   %eax,%eax
+  8014e3:	78 14                	js     8014f9 <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  8014e5:	be 00 60 80 00       	mov    $0x806000,%esi
+  8014ea:	b9 16 00 00 00       	mov    $0x16,%ecx
+  8014ef:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8014f2:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  8014f4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8014f9:	5e                   	pop    %esi
+  8014fa:	5f                   	pop    %edi
+  8014fb:	5d                   	pop    %ebp
+  8014fc:	c3                   	ret
+
+008014fd <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  8014fd:	55                   	push   %ebp
+  8014fe:	89 e5                	mov    %esp,%ebp
+  801500:	53                   	push   %ebx
+  801501:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  801504:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801507:	50                   	push   %eax
+  801508:	6a 00                	push   $0x0
+  80150a:	e8 a2 ff ff ff       	call   8014b1 <fs_stats>
+  80150f:	83 c4 10             	add    $0x10,%esp
+  801512:	85 c0                	test   %eax,%eax
+  801514:	78 28                	js     80153e <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  801516:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  801519:	83 ec 08             	sub    $0x8,%esp
+  80151c:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  80151f:	50                   	push   %eax
+  801520:	6a 20                	push   $0x20
+  801522:	e8 8a ff ff ff       	call   8014b1 <fs_stats>
+  801527:	83 c4 10             	add    $0x10,%esp
+  80152a:	85 c0                	test   %eax,%eax
+  80152c:	78 10                	js     80153e <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  80152e:	83 ec 08             	sub    $0x8,%esp
+  801531:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801534:	50                   	push   %eax
+  801535:	53                   	push   %ebx
+  801536:	e8 76 ff ff ff       	call   8014b1 <fs_stats>
+  80153b:	83 c4 10             	add    $0x10,%esp
+}
+  80153e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801541:	c9                   	leave
+  801542:	c3                   	ret
+
+00801543 <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  801543:	55                   	push   %ebp
+  801544:	89 e5                	mov    %esp,%ebp
+  801546:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  801549:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  801550:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  801553:	8b 45 08             	mov    0x8(%ebp),%eax
+  801556:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.stats.req_dcache = 0;
+  80155b:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  801562:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  801565:	ba 00 00 00 00       	mov    $0x0,%edx
+  80156a:	b8 09 00 00 00       	mov    $0x9,%eax
+  80156f:	e8 ac f7 ff ff       	call   800d20 <fsipc>
+}
+  801574:	c9                   	leave
+  801575:	c3                   	ret
+
+00801576 <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  801576:	55                   	push   %ebp
+  801577:	89 e5                	mov    %esp,%ebp
+  801579:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  80157c:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  801583:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  801586:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  80158d:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  801590:	8b 45 08             	mov    0x8(%ebp),%eax
+  801593:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_STATS, NULL);
+  801598:	ba 00 00 00 00       	mov    $0x0,%edx
+  80159d:	b8 09 00 00 00       	mov    $0x9,%eax
+  8015a2:	e8 79 f7 ff ff       	call   800d20 <fsipc>
+}
+  8015a7:	c9                   	leave
+  8015a8:	c3                   	ret
+
+008015a9 <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  8015a9:	55                   	push   %ebp
+  8015aa:	89 e5                	mov    %esp,%ebp
+  8015ac:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8015af:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015b2:	50                   	push   %eax
+  8015b3:	ff 75 08             	push   0x8(%ebp)
+  8015b6:	e8 21 f1 ff ff       	call   8006dc <fd_lookup>
+  8015bb:	83 c4 10             	add    $0x10,%esp
+  8015be:	85 c0                	test   %eax,%eax
+  8015c0:	78 34                	js     8015f6 <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  8015c2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015c5:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  8015cb:	39 08                	cmp    %ecx,(%eax)
+  8015cd:	75 29                	jne    8015f8 <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  8015cf:	8b 40 0c             	mov    0xc(%eax),%eax
+  8015d2:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.fallocate.req_offset = offset;
+  8015d7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8015da:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.fallocate.req_len = len;
+  8015df:	8b 45 10             	mov    0x10(%ebp),%eax
+  8015e2:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  8015e7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015ec:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8015f1:	e8 2a f7 ff ff       	call   800d20 <fsipc>
+}
+  8015f6:	c9                   	leave
+  8015f7:	c3                   	ret
+    return -E_INVAL;
+  8015f8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015fd:	eb f7                	jmp    8015f6 <fallocate+0x4d>
+
+008015ff <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  8015ff:	55                   	push   %ebp
+  801600:	89 e5                	mov    %esp,%ebp
+  801602:	57                   	push   %edi
+  801603:	56                   	push   %esi
+  801604:	53                   	push   %ebx
+  801605:	83 ec 24             	sub    $0x24,%esp
+  801608:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80160b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80160e:	50                   	push   %eax
+  80160f:	ff 75 08             	push   0x8(%ebp)
+  801612:	e8 c5 f0 ff ff       	call   8006dc <fd_lookup>
+  801617:	83 c4 10             	add    $0x10,%esp
+  80161a:	85 c0                	test   %eax,%eax
+  80161c:	78 66                	js     801684 <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  80161e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801621:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  801627:	39 08                	cmp    %ecx,(%eax)
+  801629:	75 61                	jne    80168c <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  80162b:	85 f6                	test   %esi,%esi
+  80162d:	7e 50                	jle    80167f <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  80162f:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  801634:	39 de                	cmp    %ebx,%esi
+  801636:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  801639:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80163c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80163f:	a3 00 60 80 00       	mov    %eax,0x806000
+    fsipcbuf.prefetch.req_n = m;
+  801644:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  80164a:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  801651:	83 ec 04             	sub    $0x4,%esp
+  801654:	57                   	push   %edi
+  801655:	ff 75 0c             	push   0xc(%ebp)
+  801658:	68 08 60 80 00       	push   $0x806008
+  80165d:	e8 60 12 00 00       	call   8028c2 <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  801662:	ba 00 00 00 00       	mov    $0x0,%edx
+  801667:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80166c:	e8 af f6 ff ff       	call   800d20 <fsipc>
+  801671:	83 c4 10             	add    $0x10,%esp
+  801674:	85 c0                	test   %eax,%eax
+  801676:	78 0c                	js     801684 <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  801678:	01 7d 0c             	add    %edi,0xc(%ebp)
+  80167b:	29 de                	sub    %ebx,%esi
+  80167d:	eb ac                	jmp    80162b <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  80167f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801684:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801687:	5b                   	pop    %ebx
+  801688:	5e                   	pop    %esi
+  801689:	5f                   	pop    %edi
+  80168a:	5d                   	pop    %ebp
+  80168b:	c3                   	ret
+    return -E_INVAL;
+  80168c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801691:	eb f1                	jmp    801684 <prefetch+0x85>
+
+00801693 <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  801693:	55                   	push   %ebp
+  801694:	89 e5                	mov    %esp,%ebp
+  801696:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  801699:	50                   	push   %eax
+  80169a:	e8 d3 ef ff ff       	call   800672 <fd2data>
+  80169f:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  8016a4:	c9                   	leave
+  8016a5:	c3                   	ret
+
+008016a6 <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8016a6:	55                   	push   %ebp
+  8016a7:	89 e5                	mov    %esp,%ebp
+  8016a9:	56                   	push   %esi
+  8016aa:	53                   	push   %ebx
+  8016ab:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  8016ae:	83 ec 0c             	sub    $0xc,%esp
+  8016b1:	ff 75 08             	push   0x8(%ebp)
+  8016b4:	e8 b9 ef ff ff       	call   800672 <fd2data>
+  8016b9:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  8016bb:	83 c4 08             	add    $0x8,%esp
+  8016be:	68 90 2f 80 00       	push   $0x802f90
+  8016c3:	53                   	push   %ebx
+  8016c4:	e8 73 10 00 00       	call   80273c <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  8016c9:	8b 46 04             	mov    0x4(%esi),%eax
+  8016cc:	2b 06                	sub    (%esi),%eax
+  8016ce:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  8016d4:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8016db:	00 00 00 
+  stat->st_dev = &devpipe;
+  8016de:	c7 83 88 00 00 00 20 	movl   $0x804020,0x88(%ebx)
+  8016e5:	40 80 00 
+  return 0;
+}
+  8016e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016ed:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016f0:	5b                   	pop    %ebx
+  8016f1:	5e                   	pop    %esi
+  8016f2:	5d                   	pop    %ebp
+  8016f3:	c3                   	ret
+
+008016f4 <pipe_wakeup>:
+{
+  8016f4:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  8016f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016fb:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  8016fe:	85 c0                	test   %eax,%eax
+  801700:	75 01                	jne    801703 <pipe_wakeup+0xf>
+  801702:	c3                   	ret
+{
+  801703:	55                   	push   %ebp
+  801704:	89 e5                	mov    %esp,%ebp
+  801706:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  801709:	6a 00                	push   $0x0
+  80170b:	68 00 00 c0 ee       	push   $0xeec00000
+  801710:	52                   	push   %edx
+  801711:	e8 f9 ed ff ff       	call   80050f <sys_chan_wakeup>
+  801716:	83 c4 10             	add    $0x10,%esp
+}
+  801719:	c9                   	leave
+  80171a:	c3                   	ret
+
+0080171b <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80171b:	55                   	push   %ebp
+  80171c:	89 e5                	mov    %esp,%ebp
+  80171e:	57                   	push   %edi
+  80171f:	56                   	push   %esi
+  801720:	53                   	push   %ebx
+  801721:	83 ec 18             	sub    $0x18,%esp
+  801724:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  801727:	57                   	push   %edi
+  801728:	e8 45 ef ff ff       	call   800672 <fd2data>
+  80172d:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  80172f:	83 c4 10             	add    $0x10,%esp
+  801732:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  801736:	74 2a                	je     801762 <devpipe_close+0x47>
+  801738:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  80173d:	89 f8                	mov    %edi,%eax
+  80173f:	e8 4f ff ff ff       	call   801693 <pipe_ring>
+  801744:	83 ec 08             	sub    $0x8,%esp
+  801747:	01 d8                	add    %ebx,%eax
+  801749:	50                   	push   %eax
+  80174a:	6a 00                	push   $0x0
+  80174c:	e8 e7 ea ff ff       	call   800238 <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  801751:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801757:	83 c4 10             	add    $0x10,%esp
+  80175a:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  801760:	75 db                	jne    80173d <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  801762:	83 ec 08             	sub    $0x8,%esp
+  801765:	57                   	push   %edi
+  801766:	6a 00                	push   $0x0
+  801768:	e8 cb ea ff ff       	call   800238 <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  80176d:	83 c4 10             	add    $0x10,%esp
+  801770:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  801774:	75 13                	jne    801789 <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  801776:	83 ec 08             	sub    $0x8,%esp
+  801779:	56                   	push   %esi
+  80177a:	6a 00                	push   $0x0
+  80177c:	e8 b7 ea ff ff       	call   800238 <sys_page_unmap>
+}
+  801781:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801784:	5b                   	pop    %ebx
+  801785:	5e                   	pop    %esi
+  801786:	5f                   	pop    %edi
+  801787:	5d                   	pop    %ebp
+  801788:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  801789:	8d 56 04             	lea    0x4(%esi),%edx
+  80178c:	8d 46 2c             	lea    0x2c(%esi),%eax
+  80178f:	e8 60 ff ff ff       	call   8016f4 <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  801794:	8d 46 30             	lea    0x30(%esi),%eax
+  801797:	89 f2                	mov    %esi,%edx
+  801799:	e8 56 ff ff ff       	call   8016f4 <pipe_wakeup>
+  80179e:	eb d6                	jmp    801776 <devpipe_close+0x5b>
+
+008017a0 <_pipeisclosed>:
+{
+  8017a0:	55                   	push   %ebp
+  8017a1:	89 e5                	mov    %esp,%ebp
+  8017a3:	57                   	push   %edi
+  8017a4:	56                   	push   %esi
+  8017a5:	53                   	push   %ebx
+  8017a6:	83 ec 1c             	sub    $0x1c,%esp
+  8017a9:	89 c7                	mov    %eax,%edi
+  8017ab:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  8017ad:	a1 44 57 80 00       	mov    0x805744,%eax
+  8017b2:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  8017b5:	83 ec 0c             	sub    $0xc,%esp
+  8017b8:	57                   	push   %edi
+  8017b9:	e8 11 14 00 00       	call   802bcf <pageref>
+  8017be:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8017c1:	89 34 24             	mov    %esi,(%esp)
+  8017c4:	e8 06 14 00 00       	call   802bcf <pageref>
+    nn = thisenv->env_runs;
+  8017c9:	8b 15 44 57 80 00    	mov    0x805744,%edx
+  8017cf:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  8017d2:	83 c4 10             	add    $0x10,%esp
+  8017d5:	39 cb                	cmp    %ecx,%ebx
+  8017d7:	74 1b                	je     8017f4 <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  8017d9:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8017dc:	75 cf                	jne    8017ad <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8017de:	8b 42 58             	mov    0x58(%edx),%eax
+  8017e1:	6a 01                	push   $0x1
+  8017e3:	50                   	push   %eax
+  8017e4:	53                   	push   %ebx
+  8017e5:	68 97 2f 80 00       	push   $0x802f97
+  8017ea:	e8 5f 09 00 00       	call   80214e <cprintf>
+  8017ef:	83 c4 10             	add    $0x10,%esp
+  8017f2:	eb b9                	jmp    8017ad <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  8017f4:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8017f7:	0f 94 c0             	sete   %al
+  8017fa:	0f b6 c0             	movzbl %al,%eax
+}
+  8017fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801800:	5b                   	pop    %ebx
+  801801:	5e                   	pop    %esi
+  801802:	5f                   	pop    %edi
+  801803:	5d                   	pop    %ebp
+  801804:	c3                   	ret
+
+00801805 <devpipe_write_bulk>:
+{
+  801805:	55                   	push   %ebp
+  801806:	89 e5                	mov    %esp,%ebp
+  801808:	57                   	push   %edi
+  801809:	56                   	push   %esi
+  80180a:	53                   	push   %ebx
+  80180b:	83 ec 1c             	sub    $0x1c,%esp
+  80180e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801811:	89 d6                	mov    %edx,%esi
+  801813:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  801816:	e8 78 fe ff ff       	call   801693 <pipe_ring>
+  80181b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  80181e:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  801823:	8d 46 04             	lea    0x4(%esi),%eax
+  801826:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  801829:	eb 75                	jmp    8018a0 <devpipe_write_bulk+0x9b>
+  80182b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801830:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  801834:	6a 64                	push   $0x64
+  801836:	68 00 00 c0 ee       	push   $0xeec00000
+  80183b:	53                   	push   %ebx
+  80183c:	56                   	push   %esi
+  80183d:	e8 aa ec ff ff       	call   8004ec <sys_chan_sleep>
+      continue;
+  801842:	83 c4 10             	add    $0x10,%esp
+  801845:	eb 59                	jmp    8018a0 <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  801847:	89 d1                	mov    %edx,%ecx
+  801849:	c1 f9 1f             	sar    $0x1f,%ecx
+  80184c:	c1 e9 11             	shr    $0x11,%ecx
+  80184f:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  801852:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  801857:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  801859:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  80185f:	29 d3                	sub    %edx,%ebx
+  801861:	ba 00 80 00 00       	mov    $0x8000,%edx
+  801866:	29 c2                	sub    %eax,%edx
+  801868:	39 d3                	cmp    %edx,%ebx
+  80186a:	0f 47 da             	cmova  %edx,%ebx
+  80186d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801870:	29 fa                	sub    %edi,%edx
+  801872:	39 d3                	cmp    %edx,%ebx
+  801874:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  801877:	83 ec 04             	sub    $0x4,%esp
+  80187a:	53                   	push   %ebx
+  80187b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80187e:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  801881:	52                   	push   %edx
+  801882:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801885:	01 c8                	add    %ecx,%eax
+  801887:	50                   	push   %eax
+  801888:	e8 97 10 00 00       	call   802924 <memcpy>
+    i += m;
+  80188d:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  80188f:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  801892:	8d 46 2c             	lea    0x2c(%esi),%eax
+  801895:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801898:	e8 57 fe ff ff       	call   8016f4 <pipe_wakeup>
+  80189d:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  8018a0:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  8018a3:	73 2b                	jae    8018d0 <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  8018a5:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  8018a7:	8b 56 04             	mov    0x4(%esi),%edx
+  8018aa:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  8018b0:	39 d0                	cmp    %edx,%eax
+  8018b2:	7d 93                	jge    801847 <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  8018b4:	89 f2                	mov    %esi,%edx
+  8018b6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8018b9:	e8 e2 fe ff ff       	call   8017a0 <_pipeisclosed>
+  8018be:	85 c0                	test   %eax,%eax
+  8018c0:	0f 84 65 ff ff ff    	je     80182b <devpipe_write_bulk+0x26>
+        return i;
+  8018c6:	89 f8                	mov    %edi,%eax
+}
+  8018c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018cb:	5b                   	pop    %ebx
+  8018cc:	5e                   	pop    %esi
+  8018cd:	5f                   	pop    %edi
+  8018ce:	5d                   	pop    %ebp
+  8018cf:	c3                   	ret
+  return i;
+  8018d0:	89 f8                	mov    %edi,%eax
+  8018d2:	eb f4                	jmp    8018c8 <devpipe_write_bulk+0xc3>
+
+008018d4 <devpipe_write>:
+{
+  8018d4:	55                   	push   %ebp
+  8018d5:	89 e5                	mov    %esp,%ebp
+  8018d7:	57                   	push   %edi
+  8018d8:	56                   	push   %esi
+  8018d9:	53                   	push   %ebx
+  8018da:	83 ec 28             	sub    $0x28,%esp
+  8018dd:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  8018e0:	56                   	push   %esi
+  8018e1:	e8 8c ed ff ff       	call   800672 <fd2data>
+  8018e6:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  8018e8:	8b 78 28             	mov    0x28(%eax),%edi
+  8018eb:	83 c4 10             	add    $0x10,%esp
+  8018ee:	85 ff                	test   %edi,%edi
+  8018f0:	75 25                	jne    801917 <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  8018f2:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8018f5:	74 66                	je     80195d <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8018f7:	8b 43 04             	mov    0x4(%ebx),%eax
+  8018fa:	8b 0b                	mov    (%ebx),%ecx
+  8018fc:	8d 51 20             	lea    0x20(%ecx),%edx
+  8018ff:	39 d0                	cmp    %edx,%eax
+  801901:	72 2b                	jb     80192e <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  801903:	89 da                	mov    %ebx,%edx
+  801905:	89 f0                	mov    %esi,%eax
+  801907:	e8 94 fe ff ff       	call   8017a0 <_pipeisclosed>
+  80190c:	85 c0                	test   %eax,%eax
+  80190e:	75 51                	jne    801961 <devpipe_write+0x8d>
+      sys_yield();
+  801910:	e8 3c e8 ff ff       	call   800151 <sys_yield>
+  801915:	eb e0                	jmp    8018f7 <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  801917:	83 ec 0c             	sub    $0xc,%esp
+  80191a:	ff 75 10             	push   0x10(%ebp)
+  80191d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801920:	89 c2                	mov    %eax,%edx
+  801922:	89 f0                	mov    %esi,%eax
+  801924:	e8 dc fe ff ff       	call   801805 <devpipe_write_bulk>
+  801929:	83 c4 10             	add    $0x10,%esp
+  80192c:	eb 38                	jmp    801966 <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80192e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801931:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801935:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  801938:	89 c2                	mov    %eax,%edx
+  80193a:	c1 fa 1f             	sar    $0x1f,%edx
+  80193d:	89 d1                	mov    %edx,%ecx
+  80193f:	c1 e9 1b             	shr    $0x1b,%ecx
+  801942:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801945:	83 e2 1f             	and    $0x1f,%edx
+  801948:	29 ca                	sub    %ecx,%edx
+  80194a:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  80194e:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  801952:	83 c0 01             	add    $0x1,%eax
+  801955:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  801958:	83 c7 01             	add    $0x1,%edi
+  80195b:	eb 95                	jmp    8018f2 <devpipe_write+0x1e>
+  return i;
+  80195d:	89 f8                	mov    %edi,%eax
+  80195f:	eb 05                	jmp    801966 <devpipe_write+0x92>
+        return 0;
+  801961:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801966:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801969:	5b                   	pop    %ebx
+  80196a:	5e                   	pop    %esi
+  80196b:	5f                   	pop    %edi
+  80196c:	5d                   	pop    %ebp
+  80196d:	c3                   	ret
+
+0080196e <devpipe_read_bulk>:
+{
+  80196e:	55                   	push   %ebp
+  80196f:	89 e5                	mov    %esp,%ebp
+  801971:	57                   	push   %edi
+  801972:	56                   	push   %esi
+  801973:	53                   	push   %ebx
+  801974:	83 ec 2c             	sub    $0x2c,%esp
+  801977:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80197a:	89 d6                	mov    %edx,%esi
+  80197c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80197f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  801982:	e8 0c fd ff ff       	call   801693 <pipe_ring>
+  801987:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  80198a:	85 db                	test   %ebx,%ebx
+  80198c:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801991:	0f 45 c3             	cmovne %ebx,%eax
+  801994:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801997:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  80199c:	8d 46 30             	lea    0x30(%esi),%eax
+  80199f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  8019a2:	eb 50                	jmp    8019f4 <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  8019a4:	89 d1                	mov    %edx,%ecx
+  8019a6:	c1 f9 1f             	sar    $0x1f,%ecx
+  8019a9:	c1 e9 11             	shr    $0x11,%ecx
+  8019ac:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  8019af:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8019b4:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  8019b6:	29 d3                	sub    %edx,%ebx
+  8019b8:	ba 00 80 00 00       	mov    $0x8000,%edx
+  8019bd:	29 c2                	sub    %eax,%edx
+  8019bf:	39 d3                	cmp    %edx,%ebx
+  8019c1:	0f 47 da             	cmova  %edx,%ebx
+  8019c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019c7:	29 fa                	sub    %edi,%edx
+  8019c9:	39 d3                	cmp    %edx,%ebx
+  8019cb:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  8019ce:	83 ec 04             	sub    $0x4,%esp
+  8019d1:	53                   	push   %ebx
+  8019d2:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8019d5:	01 c8                	add    %ecx,%eax
+  8019d7:	50                   	push   %eax
+  8019d8:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8019db:	01 f8                	add    %edi,%eax
+  8019dd:	50                   	push   %eax
+  8019de:	e8 41 0f 00 00       	call   802924 <memcpy>
+    i += m;
+  8019e3:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  8019e5:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8019e7:	89 f2                	mov    %esi,%edx
+  8019e9:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8019ec:	e8 03 fd ff ff       	call   8016f4 <pipe_wakeup>
+  8019f1:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  8019f4:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  8019f7:	73 51                	jae    801a4a <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  8019f9:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  8019fc:	8b 16                	mov    (%esi),%edx
+  8019fe:	39 da                	cmp    %ebx,%edx
+  801a00:	75 a2                	jne    8019a4 <devpipe_read_bulk+0x36>
+      if (i > 0)
+  801a02:	85 ff                	test   %edi,%edi
+  801a04:	75 44                	jne    801a4a <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  801a06:	89 f2                	mov    %esi,%edx
+  801a08:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801a0b:	e8 90 fd ff ff       	call   8017a0 <_pipeisclosed>
+  801a10:	85 c0                	test   %eax,%eax
+  801a12:	75 3a                	jne    801a4e <devpipe_read_bulk+0xe0>
+  801a14:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a19:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  801a1d:	6a 64                	push   $0x64
+  801a1f:	ff 75 d4             	push   -0x2c(%ebp)
+  801a22:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  801a23:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  801a26:	50                   	push   %eax
+  801a27:	e8 c0 ea ff ff       	call   8004ec <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  801a2c:	85 c0                	test   %eax,%eax
+  801a2e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a33:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  801a36:	83 c4 10             	add    $0x10,%esp
+  801a39:	a8 01                	test   $0x1,%al
+  801a3b:	74 b7                	je     8019f4 <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  801a3d:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  801a42:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a45:	5b                   	pop    %ebx
+  801a46:	5e                   	pop    %esi
+  801a47:	5f                   	pop    %edi
+  801a48:	5d                   	pop    %ebp
+  801a49:	c3                   	ret
+  return i;
+  801a4a:	89 f8                	mov    %edi,%eax
+  801a4c:	eb f4                	jmp    801a42 <devpipe_read_bulk+0xd4>
+        return 0;
+  801a4e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a53:	eb ed                	jmp    801a42 <devpipe_read_bulk+0xd4>
+
+00801a55 <devpipe_read>:
+{
+  801a55:	55                   	push   %ebp
+  801a56:	89 e5                	mov    %esp,%ebp
+  801a58:	57                   	push   %edi
+  801a59:	56                   	push   %esi
+  801a5a:	53                   	push   %ebx
+  801a5b:	83 ec 18             	sub    $0x18,%esp
+  801a5e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  801a61:	57                   	push   %edi
+  801a62:	e8 0b ec ff ff       	call   800672 <fd2data>
+  801a67:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  801a69:	8b 70 28             	mov    0x28(%eax),%esi
+  801a6c:	83 c4 10             	add    $0x10,%esp
+  801a6f:	85 f6                	test   %esi,%esi
+  801a71:	75 24                	jne    801a97 <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  801a73:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801a76:	74 60                	je     801ad8 <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  801a78:	8b 03                	mov    (%ebx),%eax
+  801a7a:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801a7d:	75 3b                	jne    801aba <devpipe_read+0x65>
+      if (i > 0)
+  801a7f:	85 f6                	test   %esi,%esi
+  801a81:	75 2d                	jne    801ab0 <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  801a83:	89 da                	mov    %ebx,%edx
+  801a85:	89 f8                	mov    %edi,%eax
+  801a87:	e8 14 fd ff ff       	call   8017a0 <_pipeisclosed>
+  801a8c:	85 c0                	test   %eax,%eax
+  801a8e:	75 4c                	jne    801adc <devpipe_read+0x87>
+      sys_yield();
+  801a90:	e8 bc e6 ff ff       	call   800151 <sys_yield>
+  801a95:	eb e1                	jmp    801a78 <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  801a97:	83 ec 08             	sub    $0x8,%esp
+  801a9a:	6a 00                	push   $0x0
+  801a9c:	ff 75 10             	push   0x10(%ebp)
+  801a9f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801aa2:	89 c2                	mov    %eax,%edx
+  801aa4:	89 f8                	mov    %edi,%eax
+  801aa6:	e8 c3 fe ff ff       	call   80196e <devpipe_read_bulk>
+  801aab:	83 c4 10             	add    $0x10,%esp
+  801aae:	eb 02                	jmp    801ab2 <devpipe_read+0x5d>
+        return i;
+  801ab0:	89 f0                	mov    %esi,%eax
+}
+  801ab2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ab5:	5b                   	pop    %ebx
+  801ab6:	5e                   	pop    %esi
+  801ab7:	5f                   	pop    %edi
+  801ab8:	5d                   	pop    %ebp
+  801ab9:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801aba:	99                   	cltd
+  801abb:	c1 ea 1b             	shr    $0x1b,%edx
+  801abe:	01 d0                	add    %edx,%eax
+  801ac0:	83 e0 1f             	and    $0x1f,%eax
+  801ac3:	29 d0                	sub    %edx,%eax
+  801ac5:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801aca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801acd:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  801ad0:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  801ad3:	83 c6 01             	add    $0x1,%esi
+  801ad6:	eb 9b                	jmp    801a73 <devpipe_read+0x1e>
+  return i;
+  801ad8:	89 f0                	mov    %esi,%eax
+  801ada:	eb d6                	jmp    801ab2 <devpipe_read+0x5d>
+        return 0;
+  801adc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ae1:	eb cf                	jmp    801ab2 <devpipe_read+0x5d>
+
+00801ae3 <pipe2>:
+{
+  801ae3:	55                   	push   %ebp
+  801ae4:	89 e5                	mov    %esp,%ebp
+  801ae6:	57                   	push   %edi
+  801ae7:	56                   	push   %esi
+  801ae8:	53                   	push   %ebx
+  801ae9:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  801aec:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801aef:	50                   	push   %eax
+  801af0:	e8 91 eb ff ff       	call   800686 <fd_alloc>
+  801af5:	89 c3                	mov    %eax,%ebx
+  801af7:	83 c4 10             	add    $0x10,%esp
+  801afa:	85 c0                	test   %eax,%eax
+  801afc:	0f 88 fb 01 00 00    	js     801cfd <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801b02:	83 ec 04             	sub    $0x4,%esp
+  801b05:	68 07 04 00 00       	push   $0x407
+  801b0a:	ff 75 e4             	push   -0x1c(%ebp)
+  801b0d:	6a 00                	push   $0x0
+  801b0f:	e8 9f e6 ff ff       	call   8001b3 <sys_page_alloc>
+  801b14:	89 c3                	mov    %eax,%ebx
+  801b16:	83 c4 10             	add    $0x10,%esp
+  801b19:	85 c0                	test   %eax,%eax
+  801b1b:	0f 88 dc 01 00 00    	js     801cfd <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  801b21:	83 ec 0c             	sub    $0xc,%esp
+  801b24:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801b27:	50                   	push   %eax
+  801b28:	e8 59 eb ff ff       	call   800686 <fd_alloc>
+  801b2d:	89 c3                	mov    %eax,%ebx
+  801b2f:	83 c4 10             	add    $0x10,%esp
+  801b32:	85 c0                	test   %eax,%eax
+  801b34:	0f 88 b3 01 00 00    	js     801ced <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801b3a:	83 ec 04             	sub    $0x4,%esp
+  801b3d:	68 07 04 00 00       	push   $0x407
+  801b42:	ff 75 e0             	push   -0x20(%ebp)
+  801b45:	6a 00                	push   $0x0
+  801b47:	e8 67 e6 ff ff       	call   8001b3 <sys_page_alloc>
+  801b4c:	89 c3                	mov    %eax,%ebx
+  801b4e:	83 c4 10             	add    $0x10,%esp
+  801b51:	85 c0                	test   %eax,%eax
+  801b53:	0f 88 94 01 00 00    	js     801ced <pipe2+0x20a>
+  va = fd2data(fd0);
+  801b59:	83 ec 0c             	sub    $0xc,%esp
+  801b5c:	ff 75 e4             	push   -0x1c(%ebp)
+  801b5f:	e8 0e eb ff ff       	call   800672 <fd2data>
+  801b64:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801b66:	83 c4 0c             	add    $0xc,%esp
+  801b69:	68 07 04 00 00       	push   $0x407
+  801b6e:	50                   	push   %eax
+  801b6f:	6a 00                	push   $0x0
+  801b71:	e8 3d e6 ff ff       	call   8001b3 <sys_page_alloc>
+  801b76:	89 c3                	mov    %eax,%ebx
+  801b78:	83 c4 10             	add    $0x10,%esp
+  801b7b:	85 c0                	test   %eax,%eax
+  801b7d:	0f 88 5a 01 00 00    	js     801cdd <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801b83:	83 ec 0c             	sub    $0xc,%esp
+  801b86:	ff 75 e0             	push   -0x20(%ebp)
+  801b89:	e8 e4 ea ff ff       	call   800672 <fd2data>
+  801b8e:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  801b95:	50                   	push   %eax
+  801b96:	6a 00                	push   $0x0
+  801b98:	57                   	push   %edi
+  801b99:	6a 00                	push   $0x0
+  801b9b:	e8 56 e6 ff ff       	call   8001f6 <sys_page_map>
+  801ba0:	89 c3                	mov    %eax,%ebx
+  801ba2:	83 c4 20             	add    $0x20,%esp
+  801ba5:	85 c0                	test   %eax,%eax
+  801ba7:	0f 88 22 01 00 00    	js     801ccf <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  801bad:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  801bb1:	74 72                	je     801c25 <pipe2+0x142>
+  801bb3:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  801bb8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801bbb:	e8 d3 fa ff ff       	call   801693 <pipe_ring>
+  801bc0:	83 ec 04             	sub    $0x4,%esp
+  801bc3:	68 07 04 00 00       	push   $0x407
+  801bc8:	01 f0                	add    %esi,%eax
+  801bca:	50                   	push   %eax
+  801bcb:	6a 00                	push   $0x0
+  801bcd:	e8 e1 e5 ff ff       	call   8001b3 <sys_page_alloc>
+  801bd2:	89 c3                	mov    %eax,%ebx
+  801bd4:	83 c4 10             	add    $0x10,%esp
+  801bd7:	85 c0                	test   %eax,%eax
+  801bd9:	0f 88 97 00 00 00    	js     801c76 <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  801bdf:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801be2:	e8 ac fa ff ff       	call   801693 <pipe_ring>
+  801be7:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  801bea:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801bed:	e8 a1 fa ff ff       	call   801693 <pipe_ring>
+  801bf2:	83 ec 0c             	sub    $0xc,%esp
+  801bf5:	68 07 04 00 00       	push   $0x407
+  801bfa:	53                   	push   %ebx
+  801bfb:	6a 00                	push   $0x0
+  801bfd:	01 f0                	add    %esi,%eax
+  801bff:	50                   	push   %eax
+  801c00:	6a 00                	push   $0x0
+  801c02:	e8 ef e5 ff ff       	call   8001f6 <sys_page_map>
+  801c07:	89 c3                	mov    %eax,%ebx
+  801c09:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801c0f:	83 c4 20             	add    $0x20,%esp
+  801c12:	85 c0                	test   %eax,%eax
+  801c14:	78 60                	js     801c76 <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  801c16:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  801c1c:	75 9a                	jne    801bb8 <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  801c1e:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  801c25:	a1 20 40 80 00       	mov    0x804020,%eax
+  801c2a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801c2d:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  801c2f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801c32:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  801c39:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801c3c:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  801c3e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801c41:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  801c48:	83 ec 0c             	sub    $0xc,%esp
+  801c4b:	ff 75 e4             	push   -0x1c(%ebp)
+  801c4e:	e8 0f ea ff ff       	call   800662 <fd2num>
+  801c53:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801c56:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  801c58:	83 c4 04             	add    $0x4,%esp
+  801c5b:	ff 75 e0             	push   -0x20(%ebp)
+  801c5e:	e8 ff e9 ff ff       	call   800662 <fd2num>
+  801c63:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801c66:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  801c69:	83 c4 10             	add    $0x10,%esp
+  801c6c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c71:	e9 87 00 00 00       	jmp    801cfd <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  801c76:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  801c7b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801c7e:	e8 10 fa ff ff       	call   801693 <pipe_ring>
+  801c83:	83 ec 08             	sub    $0x8,%esp
+  801c86:	01 f0                	add    %esi,%eax
+  801c88:	50                   	push   %eax
+  801c89:	6a 00                	push   $0x0
+  801c8b:	e8 a8 e5 ff ff       	call   800238 <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  801c90:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801c93:	e8 fb f9 ff ff       	call   801693 <pipe_ring>
+  801c98:	83 c4 08             	add    $0x8,%esp
+  801c9b:	01 f0                	add    %esi,%eax
+  801c9d:	50                   	push   %eax
+  801c9e:	6a 00                	push   $0x0
+  801ca0:	e8 93 e5 ff ff       	call   800238 <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  801ca5:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801cab:	83 c4 10             	add    $0x10,%esp
+  801cae:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  801cb4:	75 c5                	jne    801c7b <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  801cb6:	83 ec 0c             	sub    $0xc,%esp
+  801cb9:	ff 75 e0             	push   -0x20(%ebp)
+  801cbc:	e8 b1 e9 ff ff       	call   800672 <fd2data>
+  801cc1:	83 c4 08             	add    $0x8,%esp
+  801cc4:	50                   	push   %eax
+  801cc5:	6a 00                	push   $0x0
+  801cc7:	e8 6c e5 ff ff       	call   800238 <sys_page_unmap>
+  801ccc:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  801ccf:	83 ec 08             	sub    $0x8,%esp
+  801cd2:	57                   	push   %edi
+  801cd3:	6a 00                	push   $0x0
+  801cd5:	e8 5e e5 ff ff       	call   800238 <sys_page_unmap>
+  801cda:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  801cdd:	83 ec 08             	sub    $0x8,%esp
+  801ce0:	ff 75 e0             	push   -0x20(%ebp)
+  801ce3:	6a 00                	push   $0x0
+  801ce5:	e8 4e e5 ff ff       	call   800238 <sys_page_unmap>
+  801cea:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  801ced:	83 ec 08             	sub    $0x8,%esp
+  801cf0:	ff 75 e4             	push   -0x1c(%ebp)
+  801cf3:	6a 00                	push   $0x0
+  801cf5:	e8 3e e5 ff ff       	call   800238 <sys_page_unmap>
+  801cfa:	83 c4 10             	add    $0x10,%esp
+}
+  801cfd:	89 d8                	mov    %ebx,%eax
+  801cff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d02:	5b                   	pop    %ebx
+  801d03:	5e                   	pop    %esi
+  801d04:	5f                   	pop    %edi
+  801d05:	5d                   	pop    %ebp
+  801d06:	c3                   	ret
+
+00801d07 <pipe>:
+{
+  801d07:	55                   	push   %ebp
+  801d08:	89 e5                	mov    %esp,%ebp
+  801d0a:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  801d0d:	6a 00                	push   $0x0
+  801d0f:	ff 75 08             	push   0x8(%ebp)
+  801d12:	e8 cc fd ff ff       	call   801ae3 <pipe2>
+}
+  801d17:	c9                   	leave
+  801d18:	c3                   	ret
+
+00801d19 <pipeisclosed>:
+{
+  801d19:	55                   	push   %ebp
+  801d1a:	89 e5                	mov    %esp,%ebp
+  801d1c:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801d1f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d22:	50                   	push   %eax
+  801d23:	ff 75 08             	push   0x8(%ebp)
+  801d26:	e8 b1 e9 ff ff       	call   8006dc <fd_lookup>
+  801d2b:	83 c4 10             	add    $0x10,%esp
+  801d2e:	85 c0                	test   %eax,%eax
+  801d30:	78 18                	js     801d4a <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  801d32:	83 ec 0c             	sub    $0xc,%esp
+  801d35:	ff 75 f4             	push   -0xc(%ebp)
+  801d38:	e8 35 e9 ff ff       	call   800672 <fd2data>
+  801d3d:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  801d3f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d42:	e8 59 fa ff ff       	call   8017a0 <_pipeisclosed>
+  801d47:	83 c4 10             	add    $0x10,%esp
+}
+  801d4a:	c9                   	leave
+  801d4b:	c3                   	ret
+
+00801d4c <pipe_splice>:
+{
+  801d4c:	55                   	push   %ebp
+  801d4d:	89 e5                	mov    %esp,%ebp
+  801d4f:	57                   	push   %edi
+  801d50:	56                   	push   %esi
+  801d51:	53                   	push   %ebx
+  801d52:	83 ec 34             	sub    $0x34,%esp
+  801d55:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801d58:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801d5b:	50                   	push   %eax
+  801d5c:	ff 75 08             	push   0x8(%ebp)
+  801d5f:	e8 78 e9 ff ff       	call   8006dc <fd_lookup>
+  801d64:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801d67:	83 c4 10             	add    $0x10,%esp
+  801d6a:	85 c0                	test   %eax,%eax
+  801d6c:	0f 88 d7 00 00 00    	js     801e49 <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  801d72:	83 ec 0c             	sub    $0xc,%esp
+  801d75:	ff 75 e4             	push   -0x1c(%ebp)
+  801d78:	e8 f5 e8 ff ff       	call   800672 <fd2data>
+  801d7d:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  801d7f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801d82:	83 c4 10             	add    $0x10,%esp
+  801d85:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801d8b:	39 10                	cmp    %edx,(%eax)
+  801d8d:	0f 85 c1 00 00 00    	jne    801e54 <pipe_splice+0x108>
+  801d93:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  801d97:	0f 84 c0 00 00 00    	je     801e5d <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  801d9d:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  801da1:	0f 84 bf 00 00 00    	je     801e66 <pipe_splice+0x11a>
+  801da7:	89 f7                	mov    %esi,%edi
+  801da9:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  801daf:	0f 85 ba 00 00 00    	jne    801e6f <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  801db5:	8d 43 04             	lea    0x4(%ebx),%eax
+  801db8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801dbb:	eb 38                	jmp    801df5 <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  801dbd:	83 ec 0c             	sub    $0xc,%esp
+  801dc0:	68 00 10 00 00       	push   $0x1000
+  801dc5:	89 f1                	mov    %esi,%ecx
+  801dc7:	89 da                	mov    %ebx,%edx
+  801dc9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801dcc:	e8 34 fa ff ff       	call   801805 <devpipe_write_bulk>
+  801dd1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801dd4:	83 c4 10             	add    $0x10,%esp
+  801dd7:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801ddc:	75 53                	jne    801e31 <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  801dde:	83 ec 08             	sub    $0x8,%esp
+  801de1:	56                   	push   %esi
+  801de2:	6a 00                	push   $0x0
+  801de4:	e8 4f e4 ff ff       	call   800238 <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  801de9:	83 c7 01             	add    $0x1,%edi
+  801dec:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801df2:	83 c4 10             	add    $0x10,%esp
+  801df5:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801df8:	74 3a                	je     801e34 <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  801dfa:	8b 03                	mov    (%ebx),%eax
+  801dfc:	39 43 04             	cmp    %eax,0x4(%ebx)
+  801dff:	75 bc                	jne    801dbd <pipe_splice+0x71>
+  801e01:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e06:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  801e0a:	85 c0                	test   %eax,%eax
+  801e0c:	74 af                	je     801dbd <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  801e0e:	83 ec 04             	sub    $0x4,%esp
+  801e11:	6a 07                	push   $0x7
+  801e13:	56                   	push   %esi
+  801e14:	ff 75 d0             	push   -0x30(%ebp)
+  801e17:	e8 f3 e6 ff ff       	call   80050f <sys_chan_wakeup>
+  801e1c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801e1f:	83 c4 10             	add    $0x10,%esp
+  801e22:	85 c0                	test   %eax,%eax
+  801e24:	79 b8                	jns    801dde <pipe_splice+0x92>
+  801e26:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e2b:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  801e2f:	eb 8c                	jmp    801dbd <pipe_splice+0x71>
+  801e31:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  801e34:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801e38:	75 06                	jne    801e40 <pipe_splice+0xf4>
+  801e3a:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  801e3e:	78 09                	js     801e49 <pipe_splice+0xfd>
+  return i * PGSIZE;
+  801e40:	8b 45 10             	mov    0x10(%ebp),%eax
+  801e43:	c1 e0 0c             	shl    $0xc,%eax
+  801e46:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  801e49:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801e4c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e4f:	5b                   	pop    %ebx
+  801e50:	5e                   	pop    %esi
+  801e51:	5f                   	pop    %edi
+  801e52:	5d                   	pop    %ebp
+  801e53:	c3                   	ret
+    return -E_INVAL;
+  801e54:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  801e5b:	eb ec                	jmp    801e49 <pipe_splice+0xfd>
+  801e5d:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  801e64:	eb e3                	jmp    801e49 <pipe_splice+0xfd>
+  801e66:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  801e6d:	eb da                	jmp    801e49 <pipe_splice+0xfd>
+  801e6f:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  801e76:	eb d1                	jmp    801e49 <pipe_splice+0xfd>
+
+00801e78 <pipe_splice_read>:
+{
+  801e78:	55                   	push   %ebp
+  801e79:	89 e5                	mov    %esp,%ebp
+  801e7b:	53                   	push   %ebx
+  801e7c:	83 ec 1c             	sub    $0x1c,%esp
+  801e7f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801e82:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e85:	50                   	push   %eax
+  801e86:	ff 75 08             	push   0x8(%ebp)
+  801e89:	e8 4e e8 ff ff       	call   8006dc <fd_lookup>
+  801e8e:	83 c4 10             	add    $0x10,%esp
+  801e91:	85 c0                	test   %eax,%eax
+  801e93:	78 49                	js     801ede <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  801e95:	83 ec 0c             	sub    $0xc,%esp
+  801e98:	ff 75 f4             	push   -0xc(%ebp)
+  801e9b:	e8 d2 e7 ff ff       	call   800672 <fd2data>
+  801ea0:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  801ea2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ea5:	83 c4 10             	add    $0x10,%esp
+  801ea8:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  801eae:	39 08                	cmp    %ecx,(%eax)
+  801eb0:	75 31                	jne    801ee3 <pipe_splice_read+0x6b>
+  801eb2:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  801eb6:	74 32                	je     801eea <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  801eb8:	8b 48 08             	mov    0x8(%eax),%ecx
+  801ebb:	83 e1 03             	and    $0x3,%ecx
+  801ebe:	83 f9 01             	cmp    $0x1,%ecx
+  801ec1:	74 2e                	je     801ef1 <pipe_splice_read+0x79>
+  801ec3:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  801ec9:	75 2d                	jne    801ef8 <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  801ecb:	83 ec 08             	sub    $0x8,%esp
+  801ece:	53                   	push   %ebx
+  801ecf:	68 00 10 00 00       	push   $0x1000
+  801ed4:	89 d9                	mov    %ebx,%ecx
+  801ed6:	e8 93 fa ff ff       	call   80196e <devpipe_read_bulk>
+  801edb:	83 c4 10             	add    $0x10,%esp
+}
+  801ede:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ee1:	c9                   	leave
+  801ee2:	c3                   	ret
+    return -E_INVAL;
+  801ee3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ee8:	eb f4                	jmp    801ede <pipe_splice_read+0x66>
+  801eea:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801eef:	eb ed                	jmp    801ede <pipe_splice_read+0x66>
+  801ef1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ef6:	eb e6                	jmp    801ede <pipe_splice_read+0x66>
+  801ef8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801efd:	eb df                	jmp    801ede <pipe_splice_read+0x66>
+
+00801eff <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  801eff:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f04:	c3                   	ret
+
+00801f05 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  801f05:	55                   	push   %ebp
+  801f06:	89 e5                	mov    %esp,%ebp
+  801f08:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  801f0b:	68 af 2f 80 00       	push   $0x802faf
+  801f10:	ff 75 0c             	push   0xc(%ebp)
+  801f13:	e8 24 08 00 00       	call   80273c <strcpy>
+  return 0;
+}
+  801f18:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f1d:	c9                   	leave
+  801f1e:	c3                   	ret
+
+00801f1f <devcons_write>:
+{
+  801f1f:	55                   	push   %ebp
+  801f20:	89 e5                	mov    %esp,%ebp
+  801f22:	57                   	push   %edi
+  801f23:	56                   	push   %esi
+  801f24:	53                   	push   %ebx
+  801f25:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  801f2b:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  801f30:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  801f36:	eb 2e                	jmp    801f66 <devcons_write+0x47>
+    m = n - tot;
+  801f38:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f3b:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  801f3d:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801f42:	39 c3                	cmp    %eax,%ebx
+  801f44:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  801f47:	83 ec 04             	sub    $0x4,%esp
+  801f4a:	53                   	push   %ebx
+  801f4b:	89 f0                	mov    %esi,%eax
+  801f4d:	03 45 0c             	add    0xc(%ebp),%eax
+  801f50:	50                   	push   %eax
+  801f51:	57                   	push   %edi
+  801f52:	e8 6b 09 00 00       	call   8028c2 <memmove>
+    sys_cputs(buf, m);
+  801f57:	83 c4 08             	add    $0x8,%esp
+  801f5a:	53                   	push   %ebx
+  801f5b:	57                   	push   %edi
+  801f5c:	e8 53 e1 ff ff       	call   8000b4 <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  801f61:	01 de                	add    %ebx,%esi
+  801f63:	83 c4 10             	add    $0x10,%esp
+  801f66:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801f69:	72 cd                	jb     801f38 <devcons_write+0x19>
+}
+  801f6b:	89 f0                	mov    %esi,%eax
+  801f6d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f70:	5b                   	pop    %ebx
+  801f71:	5e                   	pop    %esi
+  801f72:	5f                   	pop    %edi
+  801f73:	5d                   	pop    %ebp
+  801f74:	c3                   	ret
+
+00801f75 <devcons_read>:
+{
+  801f75:	55                   	push   %ebp
+  801f76:	89 e5                	mov    %esp,%ebp
+  801f78:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  801f7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f80:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801f84:	75 07                	jne    801f8d <devcons_read+0x18>
+  801f86:	eb 1f                	jmp    801fa7 <devcons_read+0x32>
+    sys_yield();
+  801f88:	e8 c4 e1 ff ff       	call   800151 <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  801f8d:	e8 40 e1 ff ff       	call   8000d2 <sys_cgetc>
+  801f92:	85 c0                	test   %eax,%eax
+  801f94:	74 f2                	je     801f88 <devcons_read+0x13>
+  if (c < 0)
+  801f96:	78 0f                	js     801fa7 <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  801f98:	83 f8 04             	cmp    $0x4,%eax
+  801f9b:	74 0c                	je     801fa9 <devcons_read+0x34>
+  *(char*)vbuf = c;
+  801f9d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801fa0:	88 02                	mov    %al,(%edx)
+  return 1;
+  801fa2:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  801fa7:	c9                   	leave
+  801fa8:	c3                   	ret
+    return 0;
+  801fa9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fae:	eb f7                	jmp    801fa7 <devcons_read+0x32>
+
+00801fb0 <cputchar>:
+{
+  801fb0:	55                   	push   %ebp
+  801fb1:	89 e5                	mov    %esp,%ebp
+  801fb3:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  801fb6:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fb9:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  801fbc:	6a 01                	push   $0x1
+  801fbe:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801fc1:	50                   	push   %eax
+  801fc2:	e8 ed e0 ff ff       	call   8000b4 <sys_cputs>
+}
+  801fc7:	83 c4 10             	add    $0x10,%esp
+  801fca:	c9                   	leave
+  801fcb:	c3                   	ret
+
+00801fcc <getchar>:
+{
+  801fcc:	55                   	push   %ebp
+  801fcd:	89 e5                	mov    %esp,%ebp
+  801fcf:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  801fd2:	6a 01                	push   $0x1
+  801fd4:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801fd7:	50                   	push   %eax
+  801fd8:	6a 00                	push   $0x0
+  801fda:	e8 a8 e9 ff ff       	call   800987 <read>
+  if (r < 0)
+  801fdf:	83 c4 10             	add    $0x10,%esp
+  801fe2:	85 c0                	test   %eax,%eax
+  801fe4:	78 06                	js     801fec <getchar+0x20>
+  if (r < 1)
+  801fe6:	74 06                	je     801fee <getchar+0x22>
+  return c;
+  801fe8:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  801fec:	c9                   	leave
+  801fed:	c3                   	ret
+    return -E_EOF;
+  801fee:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  801ff3:	eb f7                	jmp    801fec <getchar+0x20>
+
+00801ff5 <iscons>:
+{
+  801ff5:	55                   	push   %ebp
+  801ff6:	89 e5                	mov    %esp,%ebp
+  801ff8:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801ffb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ffe:	50                   	push   %eax
+  801fff:	ff 75 08             	push   0x8(%ebp)
+  802002:	e8 d5 e6 ff ff       	call   8006dc <fd_lookup>
+  802007:	83 c4 10             	add    $0x10,%esp
+  80200a:	85 c0                	test   %eax,%eax
+  80200c:	78 11                	js     80201f <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  80200e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802011:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802017:	39 10                	cmp    %edx,(%eax)
+  802019:	0f 94 c0             	sete   %al
+  80201c:	0f b6 c0             	movzbl %al,%eax
+}
+  80201f:	c9                   	leave
+  802020:	c3                   	ret
+
+00802021 <opencons>:
+{
+  802021:	55                   	push   %ebp
+  802022:	89 e5                	mov    %esp,%ebp
+  802024:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  802027:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80202a:	50                   	push   %eax
+  80202b:	e8 56 e6 ff ff       	call   800686 <fd_alloc>
+  802030:	83 c4 10             	add    $0x10,%esp
+  802033:	85 c0                	test   %eax,%eax
+  802035:	78 3a                	js     802071 <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802037:	83 ec 04             	sub    $0x4,%esp
+  80203a:	68 07 04 00 00       	push   $0x407
+  80203f:	ff 75 f4             	push   -0xc(%ebp)
+  802042:	6a 00                	push   $0x0
+  802044:	e8 6a e1 ff ff       	call   8001b3 <sys_page_alloc>
+  802049:	83 c4 10             	add    $0x10,%esp
+  80204c:	85 c0                	test   %eax,%eax
+  80204e:	78 21                	js     802071 <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  802050:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802053:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802059:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  80205b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80205e:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  802065:	83 ec 0c             	sub    $0xc,%esp
+  802068:	50                   	push   %eax
+  802069:	e8 f4 e5 ff ff       	call   800662 <fd2num>
+  80206e:	83 c4 10             	add    $0x10,%esp
+}
+  802071:	c9                   	leave
+  802072:	c3                   	ret
+
+00802073 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  802073:	55                   	push   %ebp
+  802074:	89 e5                	mov    %esp,%ebp
+  802076:	56                   	push   %esi
+  802077:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  802078:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  80207b:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  802081:	e8 ac e0 ff ff       	call   800132 <sys_getenvid>
+  802086:	83 ec 0c             	sub    $0xc,%esp
+  802089:	ff 75 0c             	push   0xc(%ebp)
+  80208c:	ff 75 08             	push   0x8(%ebp)
+  80208f:	56                   	push   %esi
+  802090:	50                   	push   %eax
+  802091:	68 bc 2f 80 00       	push   $0x802fbc
+  802096:	e8 b3 00 00 00       	call   80214e <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  80209b:	83 c4 18             	add    $0x18,%esp
+  80209e:	53                   	push   %ebx
+  80209f:	ff 75 10             	push   0x10(%ebp)
+  8020a2:	e8 56 00 00 00       	call   8020fd <vcprintf>
+  cprintf("\n");
+  8020a7:	c7 04 24 a8 2f 80 00 	movl   $0x802fa8,(%esp)
+  8020ae:	e8 9b 00 00 00       	call   80214e <cprintf>
+  8020b3:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  8020b6:	cc                   	int3
+  while (1)
+  8020b7:	eb fd                	jmp    8020b6 <_panic+0x43>
+
+008020b9 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8020b9:	55                   	push   %ebp
+  8020ba:	89 e5                	mov    %esp,%ebp
+  8020bc:	53                   	push   %ebx
+  8020bd:	83 ec 04             	sub    $0x4,%esp
+  8020c0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  8020c3:	8b 13                	mov    (%ebx),%edx
+  8020c5:	8d 42 01             	lea    0x1(%edx),%eax
+  8020c8:	89 03                	mov    %eax,(%ebx)
+  8020ca:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8020cd:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  8020d1:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8020d6:	74 09                	je     8020e1 <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  8020d8:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8020dc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020df:	c9                   	leave
+  8020e0:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  8020e1:	83 ec 08             	sub    $0x8,%esp
+  8020e4:	68 ff 00 00 00       	push   $0xff
+  8020e9:	8d 43 08             	lea    0x8(%ebx),%eax
+  8020ec:	50                   	push   %eax
+  8020ed:	e8 c2 df ff ff       	call   8000b4 <sys_cputs>
+    b->idx = 0;
+  8020f2:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8020f8:	83 c4 10             	add    $0x10,%esp
+  8020fb:	eb db                	jmp    8020d8 <putch+0x1f>
+
+008020fd <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8020fd:	55                   	push   %ebp
+  8020fe:	89 e5                	mov    %esp,%ebp
+  802100:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  802106:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80210d:	00 00 00 
+  b.cnt = 0;
+  802110:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  802117:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  80211a:	ff 75 0c             	push   0xc(%ebp)
+  80211d:	ff 75 08             	push   0x8(%ebp)
+  802120:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  802126:	50                   	push   %eax
+  802127:	68 b9 20 80 00       	push   $0x8020b9
+  80212c:	e8 14 01 00 00       	call   802245 <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  802131:	83 c4 08             	add    $0x8,%esp
+  802134:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80213a:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  802140:	50                   	push   %eax
+  802141:	e8 6e df ff ff       	call   8000b4 <sys_cputs>
+
+  return b.cnt;
+}
+  802146:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80214c:	c9                   	leave
+  80214d:	c3                   	ret
+
+0080214e <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80214e:	55                   	push   %ebp
+  80214f:	89 e5                	mov    %esp,%ebp
+  802151:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  802154:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  802157:	50                   	push   %eax
+  802158:	ff 75 08             	push   0x8(%ebp)
+  80215b:	e8 9d ff ff ff       	call   8020fd <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  802160:	c9                   	leave
+  802161:	c3                   	ret
+
+00802162 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  802162:	55                   	push   %ebp
+  802163:	89 e5                	mov    %esp,%ebp
+  802165:	57                   	push   %edi
+  802166:	56                   	push   %esi
+  802167:	53                   	push   %ebx
+  802168:	83 ec 1c             	sub    $0x1c,%esp
+  80216b:	89 c7                	mov    %eax,%edi
+  80216d:	89 d6                	mov    %edx,%esi
+  80216f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802172:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802175:	89 d1                	mov    %edx,%ecx
+  802177:	89 c2                	mov    %eax,%edx
+  802179:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80217c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80217f:	8b 45 10             	mov    0x10(%ebp),%eax
+  802182:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  802185:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802188:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80218f:	39 c2                	cmp    %eax,%edx
+  802191:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  802194:	72 3e                	jb     8021d4 <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  802196:	83 ec 0c             	sub    $0xc,%esp
+  802199:	ff 75 18             	push   0x18(%ebp)
+  80219c:	83 eb 01             	sub    $0x1,%ebx
+  80219f:	53                   	push   %ebx
+  8021a0:	50                   	push   %eax
+  8021a1:	83 ec 08             	sub    $0x8,%esp
+  8021a4:	ff 75 e4             	push   -0x1c(%ebp)
+  8021a7:	ff 75 e0             	push   -0x20(%ebp)
+  8021aa:	ff 75 dc             	push   -0x24(%ebp)
+  8021ad:	ff 75 d8             	push   -0x28(%ebp)
+  8021b0:	e8 1c 0b 00 00       	call   802cd1 <__udivdi3>
+  8021b5:	83 c4 18             	add    $0x18,%esp
+  8021b8:	52                   	push   %edx
+  8021b9:	50                   	push   %eax
+  8021ba:	89 f2                	mov    %esi,%edx
+  8021bc:	89 f8                	mov    %edi,%eax
+  8021be:	e8 9f ff ff ff       	call   802162 <printnum>
+  8021c3:	83 c4 20             	add    $0x20,%esp
+  8021c6:	eb 13                	jmp    8021db <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  8021c8:	83 ec 08             	sub    $0x8,%esp
+  8021cb:	56                   	push   %esi
+  8021cc:	ff 75 18             	push   0x18(%ebp)
+  8021cf:	ff d7                	call   *%edi
+  8021d1:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  8021d4:	83 eb 01             	sub    $0x1,%ebx
+  8021d7:	85 db                	test   %ebx,%ebx
+  8021d9:	7f ed                	jg     8021c8 <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  8021db:	83 ec 08             	sub    $0x8,%esp
+  8021de:	56                   	push   %esi
+  8021df:	83 ec 04             	sub    $0x4,%esp
+  8021e2:	ff 75 e4             	push   -0x1c(%ebp)
+  8021e5:	ff 75 e0             	push   -0x20(%ebp)
+  8021e8:	ff 75 dc             	push   -0x24(%ebp)
+  8021eb:	ff 75 d8             	push   -0x28(%ebp)
+  8021ee:	e8 ff 0a 00 00       	call   802cf2 <__umoddi3>
+  8021f3:	83 c4 14             	add    $0x14,%esp
+  8021f6:	0f be 80 df 2f 80 00 	movsbl 0x802fdf(%eax),%eax
+  8021fd:	50                   	push   %eax
+  8021fe:	ff d7                	call   *%edi
+}
+  802200:	83 c4 10             	add    $0x10,%esp
+  802203:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802206:	5b                   	pop    %ebx
+  802207:	5e                   	pop    %esi
+  802208:	5f                   	pop    %edi
+  802209:	5d                   	pop    %ebp
+  80220a:	c3                   	ret
+
+0080220b <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80220b:	55                   	push   %ebp
+  80220c:	89 e5                	mov    %esp,%ebp
+  80220e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  802211:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  802215:	8b 10                	mov    (%eax),%edx
+  802217:	3b 50 04             	cmp    0x4(%eax),%edx
+  80221a:	73 0a                	jae    802226 <sprintputch+0x1b>
+    *b->buf++ = ch;
+  80221c:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80221f:	89 08                	mov    %ecx,(%eax)
+  802221:	8b 45 08             	mov    0x8(%ebp),%eax
+  802224:	88 02                	mov    %al,(%edx)
+}
+  802226:	5d                   	pop    %ebp
+  802227:	c3                   	ret
+
+00802228 <printfmt>:
+{
+  802228:	55                   	push   %ebp
+  802229:	89 e5                	mov    %esp,%ebp
+  80222b:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  80222e:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  802231:	50                   	push   %eax
+  802232:	ff 75 10             	push   0x10(%ebp)
+  802235:	ff 75 0c             	push   0xc(%ebp)
+  802238:	ff 75 08             	push   0x8(%ebp)
+  80223b:	e8 05 00 00 00       	call   802245 <vprintfmt>
+}
+  802240:	83 c4 10             	add    $0x10,%esp
+  802243:	c9                   	leave
+  802244:	c3                   	ret
+
+00802245 <vprintfmt>:
+{
+  802245:	55                   	push   %ebp
+  802246:	89 e5                	mov    %esp,%ebp
+  802248:	57                   	push   %edi
+  802249:	56                   	push   %esi
+  80224a:	53                   	push   %ebx
+  80224b:	83 ec 2c             	sub    $0x2c,%esp
+  80224e:	8b 75 08             	mov    0x8(%ebp),%esi
+  802251:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802254:	8b 7d 10             	mov    0x10(%ebp),%edi
+  802257:	eb 0a                	jmp    802263 <vprintfmt+0x1e>
+      putch(ch, putdat);
+  802259:	83 ec 08             	sub    $0x8,%esp
+  80225c:	53                   	push   %ebx
+  80225d:	50                   	push   %eax
+  80225e:	ff d6                	call   *%esi
+  802260:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  802263:	83 c7 01             	add    $0x1,%edi
+  802266:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80226a:	83 f8 25             	cmp    $0x25,%eax
+  80226d:	74 0c                	je     80227b <vprintfmt+0x36>
+      if (ch == '\0')
+  80226f:	85 c0                	test   %eax,%eax
+  802271:	75 e6                	jne    802259 <vprintfmt+0x14>
+}
+  802273:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802276:	5b                   	pop    %ebx
+  802277:	5e                   	pop    %esi
+  802278:	5f                   	pop    %edi
+  802279:	5d                   	pop    %ebp
+  80227a:	c3                   	ret
+    padc = ' ';
+  80227b:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  80227f:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  802286:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  80228d:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  802294:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  802299:	8d 47 01             	lea    0x1(%edi),%eax
+  80229c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80229f:	0f b6 17             	movzbl (%edi),%edx
+  8022a2:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8022a5:	3c 55                	cmp    $0x55,%al
+  8022a7:	0f 87 cf 03 00 00    	ja     80267c <vprintfmt+0x437>
+  8022ad:	0f b6 c0             	movzbl %al,%eax
+  8022b0:	ff 24 85 20 31 80 00 	jmp    *0x803120(,%eax,4)
+  8022b7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  8022ba:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8022be:	eb d9                	jmp    802299 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  8022c0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8022c3:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8022c7:	eb d0                	jmp    802299 <vprintfmt+0x54>
+  8022c9:	0f b6 d2             	movzbl %dl,%edx
+  8022cc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  8022cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022d4:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  8022d7:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8022da:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  8022de:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  8022e1:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8022e4:	83 f9 09             	cmp    $0x9,%ecx
+  8022e7:	77 55                	ja     80233e <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  8022e9:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  8022ec:	eb e9                	jmp    8022d7 <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  8022ee:	8b 45 14             	mov    0x14(%ebp),%eax
+  8022f1:	8b 00                	mov    (%eax),%eax
+  8022f3:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8022f6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8022f9:	8d 40 04             	lea    0x4(%eax),%eax
+  8022fc:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  8022ff:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  802302:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  802306:	79 91                	jns    802299 <vprintfmt+0x54>
+        width = precision, precision = -1;
+  802308:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80230b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80230e:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  802315:	eb 82                	jmp    802299 <vprintfmt+0x54>
+      if (width < 0)
+  802317:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80231a:	85 d2                	test   %edx,%edx
+  80231c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802321:	0f 49 c2             	cmovns %edx,%eax
+  802324:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  802327:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  80232a:	e9 6a ff ff ff       	jmp    802299 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  80232f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  802332:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  802339:	e9 5b ff ff ff       	jmp    802299 <vprintfmt+0x54>
+  80233e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802341:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802344:	eb bc                	jmp    802302 <vprintfmt+0xbd>
+      lflag++;
+  802346:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  802349:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  80234c:	e9 48 ff ff ff       	jmp    802299 <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  802351:	8b 45 14             	mov    0x14(%ebp),%eax
+  802354:	8d 78 04             	lea    0x4(%eax),%edi
+  802357:	83 ec 08             	sub    $0x8,%esp
+  80235a:	53                   	push   %ebx
+  80235b:	ff 30                	push   (%eax)
+  80235d:	ff d6                	call   *%esi
+      break;
+  80235f:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  802362:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  802365:	e9 b1 02 00 00       	jmp    80261b <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  80236a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80236d:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  802370:	8b 10                	mov    (%eax),%edx
+  802372:	89 d0                	mov    %edx,%eax
+  802374:	f7 d8                	neg    %eax
+  802376:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  802379:	83 f8 10             	cmp    $0x10,%eax
+  80237c:	7f 23                	jg     8023a1 <vprintfmt+0x15c>
+  80237e:	8b 14 85 80 32 80 00 	mov    0x803280(,%eax,4),%edx
+  802385:	85 d2                	test   %edx,%edx
+  802387:	74 18                	je     8023a1 <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  802389:	52                   	push   %edx
+  80238a:	68 52 2f 80 00       	push   $0x802f52
+  80238f:	53                   	push   %ebx
+  802390:	56                   	push   %esi
+  802391:	e8 92 fe ff ff       	call   802228 <printfmt>
+  802396:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  802399:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80239c:	e9 7a 02 00 00       	jmp    80261b <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  8023a1:	50                   	push   %eax
+  8023a2:	68 f7 2f 80 00       	push   $0x802ff7
+  8023a7:	53                   	push   %ebx
+  8023a8:	56                   	push   %esi
+  8023a9:	e8 7a fe ff ff       	call   802228 <printfmt>
+  8023ae:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  8023b1:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  8023b4:	e9 62 02 00 00       	jmp    80261b <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  8023b9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8023bc:	83 c0 04             	add    $0x4,%eax
+  8023bf:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8023c2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8023c5:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  8023c7:	85 c9                	test   %ecx,%ecx
+  8023c9:	b8 f0 2f 80 00       	mov    $0x802ff0,%eax
+  8023ce:	0f 45 c1             	cmovne %ecx,%eax
+  8023d1:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  8023d4:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8023d8:	7e 06                	jle    8023e0 <vprintfmt+0x19b>
+  8023da:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8023de:	75 0b                	jne    8023eb <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8023e0:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8023e3:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8023e6:	89 75 08             	mov    %esi,0x8(%ebp)
+  8023e9:	eb 5c                	jmp    802447 <vprintfmt+0x202>
+  8023eb:	83 ec 08             	sub    $0x8,%esp
+  8023ee:	ff 75 d0             	push   -0x30(%ebp)
+  8023f1:	ff 75 cc             	push   -0x34(%ebp)
+  8023f4:	e8 20 03 00 00       	call   802719 <strnlen>
+  8023f9:	89 c2                	mov    %eax,%edx
+  8023fb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8023fe:	29 d0                	sub    %edx,%eax
+  802400:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  802403:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  802407:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80240a:	89 75 08             	mov    %esi,0x8(%ebp)
+  80240d:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  80240f:	eb 0e                	jmp    80241f <vprintfmt+0x1da>
+          putch(padc, putdat);
+  802411:	83 ec 08             	sub    $0x8,%esp
+  802414:	53                   	push   %ebx
+  802415:	57                   	push   %edi
+  802416:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  802419:	83 ee 01             	sub    $0x1,%esi
+  80241c:	83 c4 10             	add    $0x10,%esp
+  80241f:	85 f6                	test   %esi,%esi
+  802421:	7f ee                	jg     802411 <vprintfmt+0x1cc>
+  802423:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802426:	8b 75 08             	mov    0x8(%ebp),%esi
+  802429:	85 c0                	test   %eax,%eax
+  80242b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802430:	0f 49 d0             	cmovns %eax,%edx
+  802433:	29 d0                	sub    %edx,%eax
+  802435:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802438:	eb a6                	jmp    8023e0 <vprintfmt+0x19b>
+          putch(ch, putdat);
+  80243a:	83 ec 08             	sub    $0x8,%esp
+  80243d:	53                   	push   %ebx
+  80243e:	52                   	push   %edx
+  80243f:	ff 55 08             	call   *0x8(%ebp)
+  802442:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  802445:	89 f1                	mov    %esi,%ecx
+  802447:	8d 71 01             	lea    0x1(%ecx),%esi
+  80244a:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80244e:	0f be d0             	movsbl %al,%edx
+  802451:	85 d2                	test   %edx,%edx
+  802453:	74 28                	je     80247d <vprintfmt+0x238>
+  802455:	85 ff                	test   %edi,%edi
+  802457:	78 05                	js     80245e <vprintfmt+0x219>
+  802459:	83 ef 01             	sub    $0x1,%edi
+  80245c:	78 30                	js     80248e <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  80245e:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  802462:	74 d6                	je     80243a <vprintfmt+0x1f5>
+  802464:	0f be c0             	movsbl %al,%eax
+  802467:	83 e8 20             	sub    $0x20,%eax
+  80246a:	83 f8 5e             	cmp    $0x5e,%eax
+  80246d:	76 cb                	jbe    80243a <vprintfmt+0x1f5>
+          putch('?', putdat);
+  80246f:	83 ec 08             	sub    $0x8,%esp
+  802472:	53                   	push   %ebx
+  802473:	6a 3f                	push   $0x3f
+  802475:	ff 55 08             	call   *0x8(%ebp)
+  802478:	83 c4 10             	add    $0x10,%esp
+  80247b:	eb c8                	jmp    802445 <vprintfmt+0x200>
+  80247d:	8b 75 08             	mov    0x8(%ebp),%esi
+  802480:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802483:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802486:	01 d0                	add    %edx,%eax
+  802488:	29 c8                	sub    %ecx,%eax
+  80248a:	89 c7                	mov    %eax,%edi
+  80248c:	eb 13                	jmp    8024a1 <vprintfmt+0x25c>
+  80248e:	8b 75 08             	mov    0x8(%ebp),%esi
+  802491:	eb ed                	jmp    802480 <vprintfmt+0x23b>
+        putch(' ', putdat);
+  802493:	83 ec 08             	sub    $0x8,%esp
+  802496:	53                   	push   %ebx
+  802497:	6a 20                	push   $0x20
+  802499:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  80249b:	83 ef 01             	sub    $0x1,%edi
+  80249e:	83 c4 10             	add    $0x10,%esp
+  8024a1:	85 ff                	test   %edi,%edi
+  8024a3:	7f ee                	jg     802493 <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  8024a5:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8024a8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8024ab:	e9 6b 01 00 00       	jmp    80261b <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  8024b0:	83 f9 01             	cmp    $0x1,%ecx
+  8024b3:	7f 1f                	jg     8024d4 <vprintfmt+0x28f>
+  else if (lflag)
+  8024b5:	85 c9                	test   %ecx,%ecx
+  8024b7:	74 67                	je     802520 <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  8024b9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024bc:	8b 00                	mov    (%eax),%eax
+  8024be:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8024c1:	89 c1                	mov    %eax,%ecx
+  8024c3:	c1 f9 1f             	sar    $0x1f,%ecx
+  8024c6:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8024c9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024cc:	8d 40 04             	lea    0x4(%eax),%eax
+  8024cf:	89 45 14             	mov    %eax,0x14(%ebp)
+  8024d2:	eb 17                	jmp    8024eb <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  8024d4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024d7:	8b 50 04             	mov    0x4(%eax),%edx
+  8024da:	8b 00                	mov    (%eax),%eax
+  8024dc:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8024df:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8024e2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024e5:	8d 40 08             	lea    0x8(%eax),%eax
+  8024e8:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  8024eb:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8024ee:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  8024f1:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  8024f6:	85 c9                	test   %ecx,%ecx
+  8024f8:	0f 89 03 01 00 00    	jns    802601 <vprintfmt+0x3bc>
+        putch('-', putdat);
+  8024fe:	83 ec 08             	sub    $0x8,%esp
+  802501:	53                   	push   %ebx
+  802502:	6a 2d                	push   $0x2d
+  802504:	ff d6                	call   *%esi
+        num = -(long long)num;
+  802506:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802509:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80250c:	f7 da                	neg    %edx
+  80250e:	83 d1 00             	adc    $0x0,%ecx
+  802511:	f7 d9                	neg    %ecx
+  802513:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  802516:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80251b:	e9 e1 00 00 00       	jmp    802601 <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  802520:	8b 45 14             	mov    0x14(%ebp),%eax
+  802523:	8b 00                	mov    (%eax),%eax
+  802525:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802528:	89 c1                	mov    %eax,%ecx
+  80252a:	c1 f9 1f             	sar    $0x1f,%ecx
+  80252d:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802530:	8b 45 14             	mov    0x14(%ebp),%eax
+  802533:	8d 40 04             	lea    0x4(%eax),%eax
+  802536:	89 45 14             	mov    %eax,0x14(%ebp)
+  802539:	eb b0                	jmp    8024eb <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  80253b:	83 f9 01             	cmp    $0x1,%ecx
+  80253e:	7f 1e                	jg     80255e <vprintfmt+0x319>
+  else if (lflag)
+  802540:	85 c9                	test   %ecx,%ecx
+  802542:	74 32                	je     802576 <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  802544:	8b 45 14             	mov    0x14(%ebp),%eax
+  802547:	8b 10                	mov    (%eax),%edx
+  802549:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80254e:	8d 40 04             	lea    0x4(%eax),%eax
+  802551:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  802554:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  802559:	e9 a3 00 00 00       	jmp    802601 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  80255e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802561:	8b 10                	mov    (%eax),%edx
+  802563:	8b 48 04             	mov    0x4(%eax),%ecx
+  802566:	8d 40 08             	lea    0x8(%eax),%eax
+  802569:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  80256c:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  802571:	e9 8b 00 00 00       	jmp    802601 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  802576:	8b 45 14             	mov    0x14(%ebp),%eax
+  802579:	8b 10                	mov    (%eax),%edx
+  80257b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802580:	8d 40 04             	lea    0x4(%eax),%eax
+  802583:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  802586:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  80258b:	eb 74                	jmp    802601 <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  80258d:	83 f9 01             	cmp    $0x1,%ecx
+  802590:	7f 1b                	jg     8025ad <vprintfmt+0x368>
+  else if (lflag)
+  802592:	85 c9                	test   %ecx,%ecx
+  802594:	74 2c                	je     8025c2 <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  802596:	8b 45 14             	mov    0x14(%ebp),%eax
+  802599:	8b 10                	mov    (%eax),%edx
+  80259b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025a0:	8d 40 04             	lea    0x4(%eax),%eax
+  8025a3:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8025a6:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  8025ab:	eb 54                	jmp    802601 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  8025ad:	8b 45 14             	mov    0x14(%ebp),%eax
+  8025b0:	8b 10                	mov    (%eax),%edx
+  8025b2:	8b 48 04             	mov    0x4(%eax),%ecx
+  8025b5:	8d 40 08             	lea    0x8(%eax),%eax
+  8025b8:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8025bb:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  8025c0:	eb 3f                	jmp    802601 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8025c2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8025c5:	8b 10                	mov    (%eax),%edx
+  8025c7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025cc:	8d 40 04             	lea    0x4(%eax),%eax
+  8025cf:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8025d2:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  8025d7:	eb 28                	jmp    802601 <vprintfmt+0x3bc>
+      putch('0', putdat);
+  8025d9:	83 ec 08             	sub    $0x8,%esp
+  8025dc:	53                   	push   %ebx
+  8025dd:	6a 30                	push   $0x30
+  8025df:	ff d6                	call   *%esi
+      putch('x', putdat);
+  8025e1:	83 c4 08             	add    $0x8,%esp
+  8025e4:	53                   	push   %ebx
+  8025e5:	6a 78                	push   $0x78
+  8025e7:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  8025e9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8025ec:	8b 10                	mov    (%eax),%edx
+  8025ee:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  8025f3:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  8025f6:	8d 40 04             	lea    0x4(%eax),%eax
+  8025f9:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8025fc:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  802601:	83 ec 0c             	sub    $0xc,%esp
+  802604:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  802608:	50                   	push   %eax
+  802609:	ff 75 e0             	push   -0x20(%ebp)
+  80260c:	57                   	push   %edi
+  80260d:	51                   	push   %ecx
+  80260e:	52                   	push   %edx
+  80260f:	89 da                	mov    %ebx,%edx
+  802611:	89 f0                	mov    %esi,%eax
+  802613:	e8 4a fb ff ff       	call   802162 <printnum>
+      break;
+  802618:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  80261b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  80261e:	e9 40 fc ff ff       	jmp    802263 <vprintfmt+0x1e>
+  if (lflag >= 2)
+  802623:	83 f9 01             	cmp    $0x1,%ecx
+  802626:	7f 1b                	jg     802643 <vprintfmt+0x3fe>
+  else if (lflag)
+  802628:	85 c9                	test   %ecx,%ecx
+  80262a:	74 2c                	je     802658 <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  80262c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80262f:	8b 10                	mov    (%eax),%edx
+  802631:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802636:	8d 40 04             	lea    0x4(%eax),%eax
+  802639:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  80263c:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  802641:	eb be                	jmp    802601 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  802643:	8b 45 14             	mov    0x14(%ebp),%eax
+  802646:	8b 10                	mov    (%eax),%edx
+  802648:	8b 48 04             	mov    0x4(%eax),%ecx
+  80264b:	8d 40 08             	lea    0x8(%eax),%eax
+  80264e:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  802651:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  802656:	eb a9                	jmp    802601 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  802658:	8b 45 14             	mov    0x14(%ebp),%eax
+  80265b:	8b 10                	mov    (%eax),%edx
+  80265d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802662:	8d 40 04             	lea    0x4(%eax),%eax
+  802665:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  802668:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  80266d:	eb 92                	jmp    802601 <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  80266f:	83 ec 08             	sub    $0x8,%esp
+  802672:	53                   	push   %ebx
+  802673:	6a 25                	push   $0x25
+  802675:	ff d6                	call   *%esi
+      break;
+  802677:	83 c4 10             	add    $0x10,%esp
+  80267a:	eb 9f                	jmp    80261b <vprintfmt+0x3d6>
+      putch('%', putdat);
+  80267c:	83 ec 08             	sub    $0x8,%esp
+  80267f:	53                   	push   %ebx
+  802680:	6a 25                	push   $0x25
+  802682:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  802684:	83 c4 10             	add    $0x10,%esp
+  802687:	89 f8                	mov    %edi,%eax
+  802689:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80268d:	74 05                	je     802694 <vprintfmt+0x44f>
+  80268f:	83 e8 01             	sub    $0x1,%eax
+  802692:	eb f5                	jmp    802689 <vprintfmt+0x444>
+  802694:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802697:	eb 82                	jmp    80261b <vprintfmt+0x3d6>
+
+00802699 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  802699:	55                   	push   %ebp
+  80269a:	89 e5                	mov    %esp,%ebp
+  80269c:	83 ec 18             	sub    $0x18,%esp
+  80269f:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026a2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  8026a5:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8026a8:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8026ac:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8026af:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  8026b6:	85 c0                	test   %eax,%eax
+  8026b8:	74 26                	je     8026e0 <vsnprintf+0x47>
+  8026ba:	85 d2                	test   %edx,%edx
+  8026bc:	7e 22                	jle    8026e0 <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8026be:	ff 75 14             	push   0x14(%ebp)
+  8026c1:	ff 75 10             	push   0x10(%ebp)
+  8026c4:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8026c7:	50                   	push   %eax
+  8026c8:	68 0b 22 80 00       	push   $0x80220b
+  8026cd:	e8 73 fb ff ff       	call   802245 <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  8026d2:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8026d5:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  8026d8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026db:	83 c4 10             	add    $0x10,%esp
+}
+  8026de:	c9                   	leave
+  8026df:	c3                   	ret
+    return -E_INVAL;
+  8026e0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026e5:	eb f7                	jmp    8026de <vsnprintf+0x45>
+
+008026e7 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8026e7:	55                   	push   %ebp
+  8026e8:	89 e5                	mov    %esp,%ebp
+  8026ea:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  8026ed:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  8026f0:	50                   	push   %eax
+  8026f1:	ff 75 10             	push   0x10(%ebp)
+  8026f4:	ff 75 0c             	push   0xc(%ebp)
+  8026f7:	ff 75 08             	push   0x8(%ebp)
+  8026fa:	e8 9a ff ff ff       	call   802699 <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  8026ff:	c9                   	leave
+  802700:	c3                   	ret
+
+00802701 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  802701:	55                   	push   %ebp
+  802702:	89 e5                	mov    %esp,%ebp
+  802704:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  802707:	b8 00 00 00 00       	mov    $0x0,%eax
+  80270c:	eb 03                	jmp    802711 <strlen+0x10>
+    n++;
+  80270e:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  802711:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  802715:	75 f7                	jne    80270e <strlen+0xd>
+  return n;
+}
+  802717:	5d                   	pop    %ebp
+  802718:	c3                   	ret
+
+00802719 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  802719:	55                   	push   %ebp
+  80271a:	89 e5                	mov    %esp,%ebp
+  80271c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80271f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802722:	b8 00 00 00 00       	mov    $0x0,%eax
+  802727:	eb 03                	jmp    80272c <strnlen+0x13>
+    n++;
+  802729:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80272c:	39 d0                	cmp    %edx,%eax
+  80272e:	74 08                	je     802738 <strnlen+0x1f>
+  802730:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  802734:	75 f3                	jne    802729 <strnlen+0x10>
+  802736:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  802738:	89 d0                	mov    %edx,%eax
+  80273a:	5d                   	pop    %ebp
+  80273b:	c3                   	ret
+
+0080273c <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80273c:	55                   	push   %ebp
+  80273d:	89 e5                	mov    %esp,%ebp
+  80273f:	53                   	push   %ebx
+  802740:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802743:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  802746:	b8 00 00 00 00       	mov    $0x0,%eax
+  80274b:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80274f:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  802752:	83 c0 01             	add    $0x1,%eax
+  802755:	84 d2                	test   %dl,%dl
+  802757:	75 f2                	jne    80274b <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  802759:	89 c8                	mov    %ecx,%eax
+  80275b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80275e:	c9                   	leave
+  80275f:	c3                   	ret
+
+00802760 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  802760:	55                   	push   %ebp
+  802761:	89 e5                	mov    %esp,%ebp
+  802763:	53                   	push   %ebx
+  802764:	83 ec 10             	sub    $0x10,%esp
+  802767:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  80276a:	53                   	push   %ebx
+  80276b:	e8 91 ff ff ff       	call   802701 <strlen>
+  802770:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  802773:	ff 75 0c             	push   0xc(%ebp)
+  802776:	01 d8                	add    %ebx,%eax
+  802778:	50                   	push   %eax
+  802779:	e8 be ff ff ff       	call   80273c <strcpy>
+  return dst;
+}
+  80277e:	89 d8                	mov    %ebx,%eax
+  802780:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802783:	c9                   	leave
+  802784:	c3                   	ret
+
+00802785 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  802785:	55                   	push   %ebp
+  802786:	89 e5                	mov    %esp,%ebp
+  802788:	56                   	push   %esi
+  802789:	53                   	push   %ebx
+  80278a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80278d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  802790:	89 f3                	mov    %esi,%ebx
+  802792:	03 5d 10             	add    0x10(%ebp),%ebx
+  802795:	89 f0                	mov    %esi,%eax
+  802797:	eb 0f                	jmp    8027a8 <strncpy+0x23>
+    *dst++ = *src;
+  802799:	83 c0 01             	add    $0x1,%eax
+  80279c:	0f b6 0a             	movzbl (%edx),%ecx
+  80279f:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  8027a2:	80 f9 01             	cmp    $0x1,%cl
+  8027a5:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  8027a8:	39 d8                	cmp    %ebx,%eax
+  8027aa:	75 ed                	jne    802799 <strncpy+0x14>
+  }
+  return ret;
+}
+  8027ac:	89 f0                	mov    %esi,%eax
+  8027ae:	5b                   	pop    %ebx
+  8027af:	5e                   	pop    %esi
+  8027b0:	5d                   	pop    %ebp
+  8027b1:	c3                   	ret
+
+008027b2 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8027b2:	55                   	push   %ebp
+  8027b3:	89 e5                	mov    %esp,%ebp
+  8027b5:	56                   	push   %esi
+  8027b6:	53                   	push   %ebx
+  8027b7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8027ba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8027bd:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  8027c0:	89 f0                	mov    %esi,%eax
+  8027c2:	85 d2                	test   %edx,%edx
+  8027c4:	74 21                	je     8027e7 <strlcpy+0x35>
+  8027c6:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8027ca:	89 f2                	mov    %esi,%edx
+  8027cc:	eb 09                	jmp    8027d7 <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  8027ce:	83 c1 01             	add    $0x1,%ecx
+  8027d1:	83 c2 01             	add    $0x1,%edx
+  8027d4:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  8027d7:	39 c2                	cmp    %eax,%edx
+  8027d9:	74 09                	je     8027e4 <strlcpy+0x32>
+  8027db:	0f b6 19             	movzbl (%ecx),%ebx
+  8027de:	84 db                	test   %bl,%bl
+  8027e0:	75 ec                	jne    8027ce <strlcpy+0x1c>
+  8027e2:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  8027e4:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  8027e7:	29 f0                	sub    %esi,%eax
+}
+  8027e9:	5b                   	pop    %ebx
+  8027ea:	5e                   	pop    %esi
+  8027eb:	5d                   	pop    %ebp
+  8027ec:	c3                   	ret
+
+008027ed <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8027ed:	55                   	push   %ebp
+  8027ee:	89 e5                	mov    %esp,%ebp
+  8027f0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8027f3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  8027f6:	eb 06                	jmp    8027fe <strcmp+0x11>
+    p++, q++;
+  8027f8:	83 c1 01             	add    $0x1,%ecx
+  8027fb:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  8027fe:	0f b6 01             	movzbl (%ecx),%eax
+  802801:	84 c0                	test   %al,%al
+  802803:	74 04                	je     802809 <strcmp+0x1c>
+  802805:	3a 02                	cmp    (%edx),%al
+  802807:	74 ef                	je     8027f8 <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  802809:	0f b6 c0             	movzbl %al,%eax
+  80280c:	0f b6 12             	movzbl (%edx),%edx
+  80280f:	29 d0                	sub    %edx,%eax
+}
+  802811:	5d                   	pop    %ebp
+  802812:	c3                   	ret
+
+00802813 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  802813:	55                   	push   %ebp
+  802814:	89 e5                	mov    %esp,%ebp
+  802816:	53                   	push   %ebx
+  802817:	8b 45 08             	mov    0x8(%ebp),%eax
+  80281a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80281d:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  802820:	eb 09                	jmp    80282b <strncmp+0x18>
+    n--, p++, q++;
+  802822:	83 ea 01             	sub    $0x1,%edx
+  802825:	83 c0 01             	add    $0x1,%eax
+  802828:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  80282b:	85 d2                	test   %edx,%edx
+  80282d:	74 18                	je     802847 <strncmp+0x34>
+  80282f:	0f b6 18             	movzbl (%eax),%ebx
+  802832:	84 db                	test   %bl,%bl
+  802834:	74 04                	je     80283a <strncmp+0x27>
+  802836:	3a 19                	cmp    (%ecx),%bl
+  802838:	74 e8                	je     802822 <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80283a:	0f b6 00             	movzbl (%eax),%eax
+  80283d:	0f b6 11             	movzbl (%ecx),%edx
+  802840:	29 d0                	sub    %edx,%eax
+}
+  802842:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802845:	c9                   	leave
+  802846:	c3                   	ret
+    return 0;
+  802847:	b8 00 00 00 00       	mov    $0x0,%eax
+  80284c:	eb f4                	jmp    802842 <strncmp+0x2f>
+
+0080284e <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80284e:	55                   	push   %ebp
+  80284f:	89 e5                	mov    %esp,%ebp
+  802851:	8b 45 08             	mov    0x8(%ebp),%eax
+  802854:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  802858:	eb 03                	jmp    80285d <strchr+0xf>
+  80285a:	83 c0 01             	add    $0x1,%eax
+  80285d:	0f b6 10             	movzbl (%eax),%edx
+  802860:	84 d2                	test   %dl,%dl
+  802862:	74 06                	je     80286a <strchr+0x1c>
+    if (*s == c)
+  802864:	38 ca                	cmp    %cl,%dl
+  802866:	75 f2                	jne    80285a <strchr+0xc>
+  802868:	eb 05                	jmp    80286f <strchr+0x21>
+      return (char*)s;
+  return 0;
+  80286a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80286f:	5d                   	pop    %ebp
+  802870:	c3                   	ret
+
+00802871 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  802871:	55                   	push   %ebp
+  802872:	89 e5                	mov    %esp,%ebp
+  802874:	8b 45 08             	mov    0x8(%ebp),%eax
+  802877:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  80287b:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  80287e:	38 ca                	cmp    %cl,%dl
+  802880:	74 09                	je     80288b <strfind+0x1a>
+  802882:	84 d2                	test   %dl,%dl
+  802884:	74 05                	je     80288b <strfind+0x1a>
+  for (; *s; s++)
+  802886:	83 c0 01             	add    $0x1,%eax
+  802889:	eb f0                	jmp    80287b <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  80288b:	5d                   	pop    %ebp
+  80288c:	c3                   	ret
+
+0080288d <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  80288d:	55                   	push   %ebp
+  80288e:	89 e5                	mov    %esp,%ebp
+  802890:	57                   	push   %edi
+  802891:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802894:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  802897:	85 c9                	test   %ecx,%ecx
+  802899:	74 20                	je     8028bb <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  80289b:	89 f8                	mov    %edi,%eax
+  80289d:	09 c8                	or     %ecx,%eax
+  80289f:	a8 03                	test   $0x3,%al
+  8028a1:	75 12                	jne    8028b5 <memset+0x28>
+    c &= 0xFF;
+  8028a3:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8028a7:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  8028ad:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  8028b0:	fc                   	cld
+  8028b1:	f3 ab                	rep stos %eax,%es:(%edi)
+  8028b3:	eb 06                	jmp    8028bb <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  8028b5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8028b8:	fc                   	cld
+  8028b9:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  8028bb:	89 f8                	mov    %edi,%eax
+  8028bd:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8028c0:	c9                   	leave
+  8028c1:	c3                   	ret
+
+008028c2 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8028c2:	55                   	push   %ebp
+  8028c3:	89 e5                	mov    %esp,%ebp
+  8028c5:	57                   	push   %edi
+  8028c6:	56                   	push   %esi
+  8028c7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028ca:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8028cd:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  8028d0:	39 c6                	cmp    %eax,%esi
+  8028d2:	73 32                	jae    802906 <memmove+0x44>
+  8028d4:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8028d7:	39 d0                	cmp    %edx,%eax
+  8028d9:	73 2b                	jae    802906 <memmove+0x44>
+    s += n;
+    d += n;
+  8028db:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8028de:	89 d6                	mov    %edx,%esi
+  8028e0:	09 fe                	or     %edi,%esi
+  8028e2:	09 ce                	or     %ecx,%esi
+  8028e4:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8028ea:	75 0e                	jne    8028fa <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8028ec:	83 ef 04             	sub    $0x4,%edi
+  8028ef:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8028f2:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  8028f5:	fd                   	std
+  8028f6:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8028f8:	eb 09                	jmp    802903 <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8028fa:	83 ef 01             	sub    $0x1,%edi
+  8028fd:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  802900:	fd                   	std
+  802901:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  802903:	fc                   	cld
+  802904:	eb 1a                	jmp    802920 <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  802906:	89 f2                	mov    %esi,%edx
+  802908:	09 c2                	or     %eax,%edx
+  80290a:	09 ca                	or     %ecx,%edx
+  80290c:	f6 c2 03             	test   $0x3,%dl
+  80290f:	75 0a                	jne    80291b <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  802911:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  802914:	89 c7                	mov    %eax,%edi
+  802916:	fc                   	cld
+  802917:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  802919:	eb 05                	jmp    802920 <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  80291b:	89 c7                	mov    %eax,%edi
+  80291d:	fc                   	cld
+  80291e:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  802920:	5e                   	pop    %esi
+  802921:	5f                   	pop    %edi
+  802922:	5d                   	pop    %ebp
+  802923:	c3                   	ret
+
+00802924 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  802924:	55                   	push   %ebp
+  802925:	89 e5                	mov    %esp,%ebp
+  802927:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  80292a:	ff 75 10             	push   0x10(%ebp)
+  80292d:	ff 75 0c             	push   0xc(%ebp)
+  802930:	ff 75 08             	push   0x8(%ebp)
+  802933:	e8 8a ff ff ff       	call   8028c2 <memmove>
+}
+  802938:	c9                   	leave
+  802939:	c3                   	ret
+
+0080293a <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  80293a:	55                   	push   %ebp
+  80293b:	89 e5                	mov    %esp,%ebp
+  80293d:	56                   	push   %esi
+  80293e:	53                   	push   %ebx
+  80293f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802942:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  802945:	89 c6                	mov    %eax,%esi
+  802947:	03 75 10             	add    0x10(%ebp),%esi
+  80294a:	eb 06                	jmp    802952 <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  80294c:	83 c0 01             	add    $0x1,%eax
+  80294f:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  802952:	39 f0                	cmp    %esi,%eax
+  802954:	74 14                	je     80296a <memcmp+0x30>
+    if (*s1 != *s2)
+  802956:	0f b6 08             	movzbl (%eax),%ecx
+  802959:	0f b6 1a             	movzbl (%edx),%ebx
+  80295c:	38 d9                	cmp    %bl,%cl
+  80295e:	74 ec                	je     80294c <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  802960:	0f b6 c1             	movzbl %cl,%eax
+  802963:	0f b6 db             	movzbl %bl,%ebx
+  802966:	29 d8                	sub    %ebx,%eax
+  802968:	eb 05                	jmp    80296f <memcmp+0x35>
+  }
+
+  return 0;
+  80296a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80296f:	5b                   	pop    %ebx
+  802970:	5e                   	pop    %esi
+  802971:	5d                   	pop    %ebp
+  802972:	c3                   	ret
+
+00802973 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  802973:	55                   	push   %ebp
+  802974:	89 e5                	mov    %esp,%ebp
+  802976:	8b 45 08             	mov    0x8(%ebp),%eax
+  802979:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  80297c:	89 c2                	mov    %eax,%edx
+  80297e:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  802981:	eb 03                	jmp    802986 <memfind+0x13>
+  802983:	83 c0 01             	add    $0x1,%eax
+  802986:	39 d0                	cmp    %edx,%eax
+  802988:	73 04                	jae    80298e <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  80298a:	38 08                	cmp    %cl,(%eax)
+  80298c:	75 f5                	jne    802983 <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  80298e:	5d                   	pop    %ebp
+  80298f:	c3                   	ret
+
+00802990 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  802990:	55                   	push   %ebp
+  802991:	89 e5                	mov    %esp,%ebp
+  802993:	57                   	push   %edi
+  802994:	56                   	push   %esi
+  802995:	53                   	push   %ebx
+  802996:	8b 55 08             	mov    0x8(%ebp),%edx
+  802999:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  80299c:	eb 03                	jmp    8029a1 <strtol+0x11>
+    s++;
+  80299e:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  8029a1:	0f b6 02             	movzbl (%edx),%eax
+  8029a4:	3c 20                	cmp    $0x20,%al
+  8029a6:	74 f6                	je     80299e <strtol+0xe>
+  8029a8:	3c 09                	cmp    $0x9,%al
+  8029aa:	74 f2                	je     80299e <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  8029ac:	3c 2b                	cmp    $0x2b,%al
+  8029ae:	74 2a                	je     8029da <strtol+0x4a>
+  int neg = 0;
+  8029b0:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  8029b5:	3c 2d                	cmp    $0x2d,%al
+  8029b7:	74 2b                	je     8029e4 <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8029b9:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8029bf:	75 0f                	jne    8029d0 <strtol+0x40>
+  8029c1:	80 3a 30             	cmpb   $0x30,(%edx)
+  8029c4:	74 28                	je     8029ee <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  8029c6:	85 db                	test   %ebx,%ebx
+  8029c8:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8029cd:	0f 44 d8             	cmove  %eax,%ebx
+  8029d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8029d5:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8029d8:	eb 46                	jmp    802a20 <strtol+0x90>
+    s++;
+  8029da:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  8029dd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029e2:	eb d5                	jmp    8029b9 <strtol+0x29>
+    s++, neg = 1;
+  8029e4:	83 c2 01             	add    $0x1,%edx
+  8029e7:	bf 01 00 00 00       	mov    $0x1,%edi
+  8029ec:	eb cb                	jmp    8029b9 <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8029ee:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8029f2:	74 0e                	je     802a02 <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  8029f4:	85 db                	test   %ebx,%ebx
+  8029f6:	75 d8                	jne    8029d0 <strtol+0x40>
+    s++, base = 8;
+  8029f8:	83 c2 01             	add    $0x1,%edx
+  8029fb:	bb 08 00 00 00       	mov    $0x8,%ebx
+  802a00:	eb ce                	jmp    8029d0 <strtol+0x40>
+    s += 2, base = 16;
+  802a02:	83 c2 02             	add    $0x2,%edx
+  802a05:	bb 10 00 00 00       	mov    $0x10,%ebx
+  802a0a:	eb c4                	jmp    8029d0 <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  802a0c:	0f be c0             	movsbl %al,%eax
+  802a0f:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  802a12:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802a15:	7d 3a                	jge    802a51 <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  802a17:	83 c2 01             	add    $0x1,%edx
+  802a1a:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  802a1e:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  802a20:	0f b6 02             	movzbl (%edx),%eax
+  802a23:	8d 70 d0             	lea    -0x30(%eax),%esi
+  802a26:	89 f3                	mov    %esi,%ebx
+  802a28:	80 fb 09             	cmp    $0x9,%bl
+  802a2b:	76 df                	jbe    802a0c <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  802a2d:	8d 70 9f             	lea    -0x61(%eax),%esi
+  802a30:	89 f3                	mov    %esi,%ebx
+  802a32:	80 fb 19             	cmp    $0x19,%bl
+  802a35:	77 08                	ja     802a3f <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  802a37:	0f be c0             	movsbl %al,%eax
+  802a3a:	83 e8 57             	sub    $0x57,%eax
+  802a3d:	eb d3                	jmp    802a12 <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  802a3f:	8d 70 bf             	lea    -0x41(%eax),%esi
+  802a42:	89 f3                	mov    %esi,%ebx
+  802a44:	80 fb 19             	cmp    $0x19,%bl
+  802a47:	77 08                	ja     802a51 <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  802a49:	0f be c0             	movsbl %al,%eax
+  802a4c:	83 e8 37             	sub    $0x37,%eax
+  802a4f:	eb c1                	jmp    802a12 <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  802a51:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802a55:	74 05                	je     802a5c <strtol+0xcc>
+    *endptr = (char*)s;
+  802a57:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a5a:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  802a5c:	89 c8                	mov    %ecx,%eax
+  802a5e:	f7 d8                	neg    %eax
+  802a60:	85 ff                	test   %edi,%edi
+  802a62:	0f 45 c8             	cmovne %eax,%ecx
+}
+  802a65:	89 c8                	mov    %ecx,%eax
+  802a67:	5b                   	pop    %ebx
+  802a68:	5e                   	pop    %esi
+  802a69:	5f                   	pop    %edi
+  802a6a:	5d                   	pop    %ebp
+  802a6b:	c3                   	ret
+
+00802a6c <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  802a6c:	55                   	push   %ebp
+  802a6d:	89 e5                	mov    %esp,%ebp
+  802a6f:	57                   	push   %edi
+  802a70:	56                   	push   %esi
+  802a71:	53                   	push   %ebx
+  802a72:	83 ec 14             	sub    $0x14,%esp
+  802a75:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802a78:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a7b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802a7e:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  802a81:	85 c0                	test   %eax,%eax
+  802a83:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802a88:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  802a8b:	ff 33                	push   (%ebx)
+  802a8d:	50                   	push   %eax
+  802a8e:	e8 f8 d9 ff ff       	call   80048b <sys_ipc_recv>
+  802a93:	83 c4 10             	add    $0x10,%esp
+  802a96:	85 c0                	test   %eax,%eax
+  802a98:	78 39                	js     802ad3 <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  802a9a:	85 ff                	test   %edi,%edi
+  802a9c:	74 0a                	je     802aa8 <ipc_recv_pages+0x3c>
+  802a9e:	a1 44 57 80 00       	mov    0x805744,%eax
+  802aa3:	8b 40 7c             	mov    0x7c(%eax),%eax
+  802aa6:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  802aa8:	85 f6                	test   %esi,%esi
+  802aaa:	74 0d                	je     802ab9 <ipc_recv_pages+0x4d>
+  802aac:	a1 44 57 80 00       	mov    0x805744,%eax
+  802ab1:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  802ab7:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  802ab9:	a1 44 57 80 00       	mov    0x805744,%eax
+  802abe:	8b 40 74             	mov    0x74(%eax),%eax
+  802ac1:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  802ac3:	a1 44 57 80 00       	mov    0x805744,%eax
+  802ac8:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  802acb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ace:	5b                   	pop    %ebx
+  802acf:	5e                   	pop    %esi
+  802ad0:	5f                   	pop    %edi
+  802ad1:	5d                   	pop    %ebp
+  802ad2:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  802ad3:	85 ff                	test   %edi,%edi
+  802ad5:	74 06                	je     802add <ipc_recv_pages+0x71>
+  802ad7:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  802add:	85 f6                	test   %esi,%esi
+  802adf:	74 06                	je     802ae7 <ipc_recv_pages+0x7b>
+  802ae1:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  802ae7:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  802aed:	eb dc                	jmp    802acb <ipc_recv_pages+0x5f>
+
+00802aef <ipc_recv>:
+{
+  802aef:	55                   	push   %ebp
+  802af0:	89 e5                	mov    %esp,%ebp
+  802af2:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  802af5:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  802afc:	ff 75 10             	push   0x10(%ebp)
+  802aff:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b02:	50                   	push   %eax
+  802b03:	ff 75 0c             	push   0xc(%ebp)
+  802b06:	ff 75 08             	push   0x8(%ebp)
+  802b09:	e8 5e ff ff ff       	call   802a6c <ipc_recv_pages>
+}
+  802b0e:	c9                   	leave
+  802b0f:	c3                   	ret
+
+00802b10 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  802b10:	55                   	push   %ebp
+  802b11:	89 e5                	mov    %esp,%ebp
+  802b13:	57                   	push   %edi
+  802b14:	56                   	push   %esi
+  802b15:	53                   	push   %ebx
+  802b16:	83 ec 0c             	sub    $0xc,%esp
+  802b19:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802b1c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802b1f:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  802b22:	89 c3                	mov    %eax,%ebx
+  802b24:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  802b2a:	85 c0                	test   %eax,%eax
+  802b2c:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802b31:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  802b34:	83 ec 0c             	sub    $0xc,%esp
+  802b37:	ff 75 14             	push   0x14(%ebp)
+  802b3a:	ff 75 18             	push   0x18(%ebp)
+  802b3d:	53                   	push   %ebx
+  802b3e:	56                   	push   %esi
+  802b3f:	57                   	push   %edi
+  802b40:	e8 25 d9 ff ff       	call   80046a <sys_ipc_try_send>
+  802b45:	83 c4 20             	add    $0x20,%esp
+  802b48:	85 c0                	test   %eax,%eax
+  802b4a:	79 1e                	jns    802b6a <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  802b4c:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802b4f:	75 07                	jne    802b58 <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  802b51:	e8 fb d5 ff ff       	call   800151 <sys_yield>
+  802b56:	eb dc                	jmp    802b34 <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  802b58:	50                   	push   %eax
+  802b59:	68 e3 32 80 00       	push   $0x8032e3
+  802b5e:	6a 5c                	push   $0x5c
+  802b60:	68 f0 32 80 00       	push   $0x8032f0
+  802b65:	e8 09 f5 ff ff       	call   802073 <_panic>
+  }
+}
+  802b6a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b6d:	5b                   	pop    %ebx
+  802b6e:	5e                   	pop    %esi
+  802b6f:	5f                   	pop    %edi
+  802b70:	5d                   	pop    %ebp
+  802b71:	c3                   	ret
+
+00802b72 <ipc_send>:
+{
+  802b72:	55                   	push   %ebp
+  802b73:	89 e5                	mov    %esp,%ebp
+  802b75:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  802b78:	ff 75 14             	push   0x14(%ebp)
+  802b7b:	6a 01                	push   $0x1
+  802b7d:	ff 75 10             	push   0x10(%ebp)
+  802b80:	ff 75 0c             	push   0xc(%ebp)
+  802b83:	ff 75 08             	push   0x8(%ebp)
+  802b86:	e8 85 ff ff ff       	call   802b10 <ipc_send_pages>
+}
+  802b8b:	83 c4 20             	add    $0x20,%esp
+  802b8e:	c9                   	leave
+  802b8f:	c3                   	ret
+
+00802b90 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802b90:	55                   	push   %ebp
+  802b91:	89 e5                	mov    %esp,%ebp
+  802b93:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  802b96:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  802b9b:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802b9e:	c1 e0 04             	shl    $0x4,%eax
+  802ba1:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802ba6:	8b 40 50             	mov    0x50(%eax),%eax
+  802ba9:	39 c8                	cmp    %ecx,%eax
+  802bab:	74 12                	je     802bbf <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  802bad:	83 c2 01             	add    $0x1,%edx
+  802bb0:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802bb6:	75 e3                	jne    802b9b <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  802bb8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bbd:	eb 0e                	jmp    802bcd <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  802bbf:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802bc2:	c1 e0 04             	shl    $0x4,%eax
+  802bc5:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802bca:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802bcd:	5d                   	pop    %ebp
+  802bce:	c3                   	ret
+
+00802bcf <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802bcf:	55                   	push   %ebp
+  802bd0:	89 e5                	mov    %esp,%ebp
+  802bd2:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802bd5:	89 c2                	mov    %eax,%edx
+  802bd7:	c1 ea 16             	shr    $0x16,%edx
+  802bda:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  802be1:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802be6:	f6 c1 01             	test   $0x1,%cl
+  802be9:	74 1c                	je     802c07 <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  802beb:	c1 e8 0c             	shr    $0xc,%eax
+  802bee:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  802bf5:	a8 01                	test   $0x1,%al
+  802bf7:	74 0e                	je     802c07 <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  802bf9:	c1 e8 0c             	shr    $0xc,%eax
+  802bfc:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802c03:	ef 
+  802c04:	0f b7 d2             	movzwl %dx,%edx
+}
+  802c07:	89 d0                	mov    %edx,%eax
+  802c09:	5d                   	pop    %ebp
+  802c0a:	c3                   	ret
+
+00802c0b <udivmod>:
+  802c0b:	55                   	push   %ebp
+  802c0c:	57                   	push   %edi
+  802c0d:	56                   	push   %esi
+  802c0e:	53                   	push   %ebx
+  802c0f:	83 ec 14             	sub    $0x14,%esp
+  802c12:	8b 74 24 28          	mov    0x28(%esp),%esi
+  802c16:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  802c1a:	89 fb                	mov    %edi,%ebx
+  802c1c:	09 f3                	or     %esi,%ebx
+  802c1e:	0f 84 88 00 00 00    	je     802cac <udivmod+0xa1>
+  802c24:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802c29:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802c30:	00 
+  802c31:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802c38:	00 
+  802c39:	89 cd                	mov    %ecx,%ebp
+  802c3b:	89 34 24             	mov    %esi,(%esp)
+  802c3e:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802c42:	eb 08                	jmp    802c4c <udivmod+0x41>
+  802c44:	83 ed 01             	sub    $0x1,%ebp
+  802c47:	83 fd ff             	cmp    $0xffffffff,%ebp
+  802c4a:	74 6c                	je     802cb8 <udivmod+0xad>
+  802c4c:	89 c3                	mov    %eax,%ebx
+  802c4e:	89 d6                	mov    %edx,%esi
+  802c50:	89 e9                	mov    %ebp,%ecx
+  802c52:	0f ad f3             	shrd   %cl,%esi,%ebx
+  802c55:	d3 ee                	shr    %cl,%esi
+  802c57:	f6 c1 20             	test   $0x20,%cl
+  802c5a:	74 04                	je     802c60 <udivmod+0x55>
+  802c5c:	89 f3                	mov    %esi,%ebx
+  802c5e:	31 f6                	xor    %esi,%esi
+  802c60:	8b 3c 24             	mov    (%esp),%edi
+  802c63:	39 fb                	cmp    %edi,%ebx
+  802c65:	89 f7                	mov    %esi,%edi
+  802c67:	8b 1c 24             	mov    (%esp),%ebx
+  802c6a:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802c6e:	19 f7                	sbb    %esi,%edi
+  802c70:	72 d2                	jb     802c44 <udivmod+0x39>
+  802c72:	89 f7                	mov    %esi,%edi
+  802c74:	89 de                	mov    %ebx,%esi
+  802c76:	89 e9                	mov    %ebp,%ecx
+  802c78:	0f a5 f7             	shld   %cl,%esi,%edi
+  802c7b:	d3 e6                	shl    %cl,%esi
+  802c7d:	f6 c1 20             	test   $0x20,%cl
+  802c80:	74 04                	je     802c86 <udivmod+0x7b>
+  802c82:	89 f7                	mov    %esi,%edi
+  802c84:	31 f6                	xor    %esi,%esi
+  802c86:	29 f0                	sub    %esi,%eax
+  802c88:	19 fa                	sbb    %edi,%edx
+  802c8a:	be 01 00 00 00       	mov    $0x1,%esi
+  802c8f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c94:	0f a5 f7             	shld   %cl,%esi,%edi
+  802c97:	d3 e6                	shl    %cl,%esi
+  802c99:	f6 c1 20             	test   $0x20,%cl
+  802c9c:	74 04                	je     802ca2 <udivmod+0x97>
+  802c9e:	89 f7                	mov    %esi,%edi
+  802ca0:	31 f6                	xor    %esi,%esi
+  802ca2:	09 74 24 08          	or     %esi,0x8(%esp)
+  802ca6:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802caa:	eb 98                	jmp    802c44 <udivmod+0x39>
+  802cac:	89 f0                	mov    %esi,%eax
+  802cae:	89 fa                	mov    %edi,%edx
+  802cb0:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802cb4:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802cb8:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802cbc:	89 01                	mov    %eax,(%ecx)
+  802cbe:	89 51 04             	mov    %edx,0x4(%ecx)
+  802cc1:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802cc5:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802cc9:	83 c4 14             	add    $0x14,%esp
+  802ccc:	5b                   	pop    %ebx
+  802ccd:	5e                   	pop    %esi
+  802cce:	5f                   	pop    %edi
+  802ccf:	5d                   	pop    %ebp
+  802cd0:	c3                   	ret
+
+00802cd1 <__udivdi3>:
+  802cd1:	83 ec 18             	sub    $0x18,%esp
+  802cd4:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802cd8:	50                   	push   %eax
+  802cd9:	ff 74 24 2c          	push   0x2c(%esp)
+  802cdd:	ff 74 24 2c          	push   0x2c(%esp)
+  802ce1:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802ce5:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802ce9:	e8 1d ff ff ff       	call   802c0b <udivmod>
+  802cee:	83 c4 24             	add    $0x24,%esp
+  802cf1:	c3                   	ret
+
+00802cf2 <__umoddi3>:
+  802cf2:	83 ec 18             	sub    $0x18,%esp
+  802cf5:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802cf9:	50                   	push   %eax
+  802cfa:	ff 74 24 2c          	push   0x2c(%esp)
+  802cfe:	ff 74 24 2c          	push   0x2c(%esp)
+  802d02:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802d06:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802d0a:	e8 fc fe ff ff       	call   802c0b <udivmod>
+  802d0f:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802d13:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802d17:	83 c4 24             	add    $0x24,%esp
+  802d1a:	c3                   	ret
+
+00802d1b <__divdi3>:
+  802d1b:	56                   	push   %esi
+  802d1c:	53                   	push   %ebx
+  802d1d:	83 ec 14             	sub    $0x14,%esp
+  802d20:	8b 44 24 20          	mov    0x20(%esp),%eax
+  802d24:	8b 54 24 24          	mov    0x24(%esp),%edx
+  802d28:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  802d2c:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  802d30:	85 d2                	test   %edx,%edx
+  802d32:	78 18                	js     802d4c <__divdi3+0x31>
+  802d34:	85 db                	test   %ebx,%ebx
+  802d36:	78 3e                	js     802d76 <__divdi3+0x5b>
+  802d38:	83 ec 04             	sub    $0x4,%esp
+  802d3b:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802d3f:	56                   	push   %esi
+  802d40:	53                   	push   %ebx
+  802d41:	51                   	push   %ecx
+  802d42:	e8 c4 fe ff ff       	call   802c0b <udivmod>
+  802d47:	83 c4 10             	add    $0x10,%esp
+  802d4a:	eb 24                	jmp    802d70 <__divdi3+0x55>
+  802d4c:	f7 d8                	neg    %eax
+  802d4e:	83 d2 00             	adc    $0x0,%edx
+  802d51:	f7 da                	neg    %edx
+  802d53:	85 db                	test   %ebx,%ebx
+  802d55:	78 3a                	js     802d91 <__divdi3+0x76>
+  802d57:	83 ec 04             	sub    $0x4,%esp
+  802d5a:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802d5e:	56                   	push   %esi
+  802d5f:	53                   	push   %ebx
+  802d60:	51                   	push   %ecx
+  802d61:	e8 a5 fe ff ff       	call   802c0b <udivmod>
+  802d66:	83 c4 10             	add    $0x10,%esp
+  802d69:	f7 d8                	neg    %eax
+  802d6b:	83 d2 00             	adc    $0x0,%edx
+  802d6e:	f7 da                	neg    %edx
+  802d70:	83 c4 14             	add    $0x14,%esp
+  802d73:	5b                   	pop    %ebx
+  802d74:	5e                   	pop    %esi
+  802d75:	c3                   	ret
+  802d76:	83 ec 04             	sub    $0x4,%esp
+  802d79:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802d7d:	56                   	push   %esi
+  802d7e:	f7 d9                	neg    %ecx
+  802d80:	83 d3 00             	adc    $0x0,%ebx
+  802d83:	f7 db                	neg    %ebx
+  802d85:	53                   	push   %ebx
+  802d86:	51                   	push   %ecx
+  802d87:	e8 7f fe ff ff       	call   802c0b <udivmod>
+  802d8c:	83 c4 10             	add    $0x10,%esp
+  802d8f:	eb d8                	jmp    802d69 <__divdi3+0x4e>
+  802d91:	83 ec 04             	sub    $0x4,%esp
+  802d94:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802d98:	56                   	push   %esi
+  802d99:	f7 d9                	neg    %ecx
+  802d9b:	83 d3 00             	adc    $0x0,%ebx
+  802d9e:	f7 db                	neg    %ebx
+  802da0:	53                   	push   %ebx
+  802da1:	51                   	push   %ecx
+  802da2:	e8 64 fe ff ff       	call   802c0b <udivmod>
+  802da7:	83 c4 10             	add    $0x10,%esp
+  802daa:	eb c4                	jmp    802d70 <__divdi3+0x55>
+
+00802dac <__moddi3>:
+  802dac:	55                   	push   %ebp
+  802dad:	57                   	push   %edi
+  802dae:	56                   	push   %esi
+  802daf:	53                   	push   %ebx
+  802db0:	83 ec 24             	sub    $0x24,%esp
+  802db3:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802db7:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802dbb:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  802dbf:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  802dc3:	85 d2                	test   %edx,%edx
+  802dc5:	78 3b                	js     802e02 <__moddi3+0x56>
+  802dc7:	83 ec 04             	sub    $0x4,%esp
+  802dca:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  802dce:	56                   	push   %esi
+  802dcf:	89 ce                	mov    %ecx,%esi
+  802dd1:	f7 de                	neg    %esi
+  802dd3:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802dd7:	89 de                	mov    %ebx,%esi
+  802dd9:	83 d6 00             	adc    $0x0,%esi
+  802ddc:	f7 de                	neg    %esi
+  802dde:	89 74 24 14          	mov    %esi,0x14(%esp)
+  802de2:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802de6:	0f 48 f1             	cmovs  %ecx,%esi
+  802de9:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  802dee:	53                   	push   %ebx
+  802def:	56                   	push   %esi
+  802df0:	e8 16 fe ff ff       	call   802c0b <udivmod>
+  802df5:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802df9:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802dfd:	83 c4 10             	add    $0x10,%esp
+  802e00:	eb 47                	jmp    802e49 <__moddi3+0x9d>
+  802e02:	f7 d8                	neg    %eax
+  802e04:	83 d2 00             	adc    $0x0,%edx
+  802e07:	f7 da                	neg    %edx
+  802e09:	83 ec 04             	sub    $0x4,%esp
+  802e0c:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  802e10:	56                   	push   %esi
+  802e11:	89 cf                	mov    %ecx,%edi
+  802e13:	f7 df                	neg    %edi
+  802e15:	89 de                	mov    %ebx,%esi
+  802e17:	83 d6 00             	adc    $0x0,%esi
+  802e1a:	f7 de                	neg    %esi
+  802e1c:	0f 49 cf             	cmovns %edi,%ecx
+  802e1f:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802e23:	0f 49 de             	cmovns %esi,%ebx
+  802e26:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  802e2a:	ff 74 24 0c          	push   0xc(%esp)
+  802e2e:	ff 74 24 0c          	push   0xc(%esp)
+  802e32:	e8 d4 fd ff ff       	call   802c0b <udivmod>
+  802e37:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802e3b:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802e3f:	f7 d8                	neg    %eax
+  802e41:	83 d2 00             	adc    $0x0,%edx
+  802e44:	f7 da                	neg    %edx
+  802e46:	83 c4 10             	add    $0x10,%esp
+  802e49:	83 c4 24             	add    $0x24,%esp
+  802e4c:	5b                   	pop    %ebx
+  802e4d:	5e                   	pop    %esi
+  802e4e:	5f                   	pop    %edi
+  802e4f:	5d                   	pop    %ebp
+  802e50:	c3                   	ret
@@ -0,0 +1,6363 @@
+
+obj/user/buggyhello2.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 1d 00 00 00       	call   80004e <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+const char *hello = "hello, world\n";
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+  sys_cputs(hello, 1024*1024);
+  800039:	68 00 00 10 00       	push   $0x100000
+  80003e:	ff 35 00 40 80 00    	push   0x804000
+  800044:	e8 72 00 00 00       	call   8000bb <sys_cputs>
+}
+  800049:	83 c4 10             	add    $0x10,%esp
+  80004c:	c9                   	leave
+  80004d:	c3                   	ret
+
+0080004e <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80004e:	55                   	push   %ebp
+  80004f:	89 e5                	mov    %esp,%ebp
+  800051:	56                   	push   %esi
+  800052:	53                   	push   %ebx
+  800053:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800056:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  800059:	c7 05 44 57 80 00 00 	movl   $0x0,0x805744
+  800060:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  800063:	e8 d1 00 00 00       	call   800139 <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  800068:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80006d:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800070:	c1 e0 04             	shl    $0x4,%eax
+  800073:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800078:	a3 44 57 80 00       	mov    %eax,0x805744
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  80007d:	85 db                	test   %ebx,%ebx
+  80007f:	7e 07                	jle    800088 <libmain+0x3a>
+    binaryname = argv[0];
+  800081:	8b 06                	mov    (%esi),%eax
+  800083:	a3 04 40 80 00       	mov    %eax,0x804004
+
+  // call user main routine
+  umain(argc, argv);
+  800088:	83 ec 08             	sub    $0x8,%esp
+  80008b:	56                   	push   %esi
+  80008c:	53                   	push   %ebx
+  80008d:	e8 a1 ff ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  800092:	e8 0a 00 00 00       	call   8000a1 <exit>
+}
+  800097:	83 c4 10             	add    $0x10,%esp
+  80009a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80009d:	5b                   	pop    %ebx
+  80009e:	5e                   	pop    %esi
+  80009f:	5d                   	pop    %ebp
+  8000a0:	c3                   	ret
+
+008000a1 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000a1:	55                   	push   %ebp
+  8000a2:	89 e5                	mov    %esp,%ebp
+  8000a4:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  8000a7:	e8 87 07 00 00       	call   800833 <close_all>
+  sys_env_destroy(0);
+  8000ac:	83 ec 0c             	sub    $0xc,%esp
+  8000af:	6a 00                	push   $0x0
+  8000b1:	e8 42 00 00 00       	call   8000f8 <sys_env_destroy>
+}
+  8000b6:	83 c4 10             	add    $0x10,%esp
+  8000b9:	c9                   	leave
+  8000ba:	c3                   	ret
+
+008000bb <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8000bb:	55                   	push   %ebp
+  8000bc:	89 e5                	mov    %esp,%ebp
+  8000be:	57                   	push   %edi
+  8000bf:	56                   	push   %esi
+  8000c0:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8000c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000c6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000c9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000cc:	89 c3                	mov    %eax,%ebx
+  8000ce:	89 c7                	mov    %eax,%edi
+  8000d0:	89 c6                	mov    %eax,%esi
+  8000d2:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  8000d4:	5b                   	pop    %ebx
+  8000d5:	5e                   	pop    %esi
+  8000d6:	5f                   	pop    %edi
+  8000d7:	5d                   	pop    %ebp
+  8000d8:	c3                   	ret
+
+008000d9 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  8000d9:	55                   	push   %ebp
+  8000da:	89 e5                	mov    %esp,%ebp
+  8000dc:	57                   	push   %edi
+  8000dd:	56                   	push   %esi
+  8000de:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8000df:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000e4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000e9:	89 d1                	mov    %edx,%ecx
+  8000eb:	89 d3                	mov    %edx,%ebx
+  8000ed:	89 d7                	mov    %edx,%edi
+  8000ef:	89 d6                	mov    %edx,%esi
+  8000f1:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  8000f3:	5b                   	pop    %ebx
+  8000f4:	5e                   	pop    %esi
+  8000f5:	5f                   	pop    %edi
+  8000f6:	5d                   	pop    %ebp
+  8000f7:	c3                   	ret
+
+008000f8 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8000f8:	55                   	push   %ebp
+  8000f9:	89 e5                	mov    %esp,%ebp
+  8000fb:	57                   	push   %edi
+  8000fc:	56                   	push   %esi
+  8000fd:	53                   	push   %ebx
+  8000fe:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800101:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800106:	8b 55 08             	mov    0x8(%ebp),%edx
+  800109:	b8 03 00 00 00       	mov    $0x3,%eax
+  80010e:	89 cb                	mov    %ecx,%ebx
+  800110:	89 cf                	mov    %ecx,%edi
+  800112:	89 ce                	mov    %ecx,%esi
+  800114:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800116:	85 c0                	test   %eax,%eax
+  800118:	7f 08                	jg     800122 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  80011a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80011d:	5b                   	pop    %ebx
+  80011e:	5e                   	pop    %esi
+  80011f:	5f                   	pop    %edi
+  800120:	5d                   	pop    %ebp
+  800121:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800122:	83 ec 0c             	sub    $0xc,%esp
+  800125:	50                   	push   %eax
+  800126:	6a 03                	push   $0x3
+  800128:	68 78 2e 80 00       	push   $0x802e78
+  80012d:	6a 23                	push   $0x23
+  80012f:	68 95 2e 80 00       	push   $0x802e95
+  800134:	e8 41 1f 00 00       	call   80207a <_panic>
+
+00800139 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800139:	55                   	push   %ebp
+  80013a:	89 e5                	mov    %esp,%ebp
+  80013c:	57                   	push   %edi
+  80013d:	56                   	push   %esi
+  80013e:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80013f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800144:	b8 02 00 00 00       	mov    $0x2,%eax
+  800149:	89 d1                	mov    %edx,%ecx
+  80014b:	89 d3                	mov    %edx,%ebx
+  80014d:	89 d7                	mov    %edx,%edi
+  80014f:	89 d6                	mov    %edx,%esi
+  800151:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800153:	5b                   	pop    %ebx
+  800154:	5e                   	pop    %esi
+  800155:	5f                   	pop    %edi
+  800156:	5d                   	pop    %ebp
+  800157:	c3                   	ret
+
+00800158 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800158:	55                   	push   %ebp
+  800159:	89 e5                	mov    %esp,%ebp
+  80015b:	57                   	push   %edi
+  80015c:	56                   	push   %esi
+  80015d:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80015e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800163:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800168:	89 d1                	mov    %edx,%ecx
+  80016a:	89 d3                	mov    %edx,%ebx
+  80016c:	89 d7                	mov    %edx,%edi
+  80016e:	89 d6                	mov    %edx,%esi
+  800170:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800172:	5b                   	pop    %ebx
+  800173:	5e                   	pop    %esi
+  800174:	5f                   	pop    %edi
+  800175:	5d                   	pop    %ebp
+  800176:	c3                   	ret
+
+00800177 <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  800177:	55                   	push   %ebp
+  800178:	89 e5                	mov    %esp,%ebp
+  80017a:	57                   	push   %edi
+  80017b:	56                   	push   %esi
+  80017c:	53                   	push   %ebx
+  80017d:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  800180:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  800184:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800189:	8b 55 08             	mov    0x8(%ebp),%edx
+  80018c:	b8 14 00 00 00       	mov    $0x14,%eax
+  800191:	89 df                	mov    %ebx,%edi
+  800193:	89 de                	mov    %ebx,%esi
+  800195:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800197:	85 c0                	test   %eax,%eax
+  800199:	7f 08                	jg     8001a3 <sys_env_set_cow+0x2c>
+}
+  80019b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80019e:	5b                   	pop    %ebx
+  80019f:	5e                   	pop    %esi
+  8001a0:	5f                   	pop    %edi
+  8001a1:	5d                   	pop    %ebp
+  8001a2:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8001a3:	83 ec 0c             	sub    $0xc,%esp
+  8001a6:	50                   	push   %eax
+  8001a7:	6a 14                	push   $0x14
+  8001a9:	68 78 2e 80 00       	push   $0x802e78
+  8001ae:	6a 23                	push   $0x23
+  8001b0:	68 95 2e 80 00       	push   $0x802e95
+  8001b5:	e8 c0 1e 00 00       	call   80207a <_panic>
+
+008001ba <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8001ba:	55                   	push   %ebp
+  8001bb:	89 e5                	mov    %esp,%ebp
+  8001bd:	57                   	push   %edi
+  8001be:	56                   	push   %esi
+  8001bf:	53                   	push   %ebx
+  8001c0:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8001c3:	be 00 00 00 00       	mov    $0x0,%esi
+  8001c8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001cb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001ce:	b8 04 00 00 00       	mov    $0x4,%eax
+  8001d3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001d6:	89 f7                	mov    %esi,%edi
+  8001d8:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8001da:	85 c0                	test   %eax,%eax
+  8001dc:	7f 08                	jg     8001e6 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  8001de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001e1:	5b                   	pop    %ebx
+  8001e2:	5e                   	pop    %esi
+  8001e3:	5f                   	pop    %edi
+  8001e4:	5d                   	pop    %ebp
+  8001e5:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8001e6:	83 ec 0c             	sub    $0xc,%esp
+  8001e9:	50                   	push   %eax
+  8001ea:	6a 04                	push   $0x4
+  8001ec:	68 78 2e 80 00       	push   $0x802e78
+  8001f1:	6a 23                	push   $0x23
+  8001f3:	68 95 2e 80 00       	push   $0x802e95
+  8001f8:	e8 7d 1e 00 00       	call   80207a <_panic>
+
+008001fd <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8001fd:	55                   	push   %ebp
+  8001fe:	89 e5                	mov    %esp,%ebp
+  800200:	57                   	push   %edi
+  800201:	56                   	push   %esi
+  800202:	53                   	push   %ebx
+  800203:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800206:	8b 55 08             	mov    0x8(%ebp),%edx
+  800209:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80020c:	b8 05 00 00 00       	mov    $0x5,%eax
+  800211:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800214:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800217:	8b 75 18             	mov    0x18(%ebp),%esi
+  80021a:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80021c:	85 c0                	test   %eax,%eax
+  80021e:	7f 08                	jg     800228 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  800220:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800223:	5b                   	pop    %ebx
+  800224:	5e                   	pop    %esi
+  800225:	5f                   	pop    %edi
+  800226:	5d                   	pop    %ebp
+  800227:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800228:	83 ec 0c             	sub    $0xc,%esp
+  80022b:	50                   	push   %eax
+  80022c:	6a 05                	push   $0x5
+  80022e:	68 78 2e 80 00       	push   $0x802e78
+  800233:	6a 23                	push   $0x23
+  800235:	68 95 2e 80 00       	push   $0x802e95
+  80023a:	e8 3b 1e 00 00       	call   80207a <_panic>
+
+0080023f <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  80023f:	55                   	push   %ebp
+  800240:	89 e5                	mov    %esp,%ebp
+  800242:	57                   	push   %edi
+  800243:	56                   	push   %esi
+  800244:	53                   	push   %ebx
+  800245:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800248:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80024d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800250:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800253:	b8 06 00 00 00       	mov    $0x6,%eax
+  800258:	89 df                	mov    %ebx,%edi
+  80025a:	89 de                	mov    %ebx,%esi
+  80025c:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80025e:	85 c0                	test   %eax,%eax
+  800260:	7f 08                	jg     80026a <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  800262:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800265:	5b                   	pop    %ebx
+  800266:	5e                   	pop    %esi
+  800267:	5f                   	pop    %edi
+  800268:	5d                   	pop    %ebp
+  800269:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80026a:	83 ec 0c             	sub    $0xc,%esp
+  80026d:	50                   	push   %eax
+  80026e:	6a 06                	push   $0x6
+  800270:	68 78 2e 80 00       	push   $0x802e78
+  800275:	6a 23                	push   $0x23
+  800277:	68 95 2e 80 00       	push   $0x802e95
+  80027c:	e8 f9 1d 00 00       	call   80207a <_panic>
+
+00800281 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  800281:	55                   	push   %ebp
+  800282:	89 e5                	mov    %esp,%ebp
+  800284:	57                   	push   %edi
+  800285:	56                   	push   %esi
+  800286:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800287:	8b 55 08             	mov    0x8(%ebp),%edx
+  80028a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80028d:	b8 11 00 00 00       	mov    $0x11,%eax
+  800292:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800295:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800298:	8b 75 18             	mov    0x18(%ebp),%esi
+  80029b:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  80029d:	5b                   	pop    %ebx
+  80029e:	5e                   	pop    %esi
+  80029f:	5f                   	pop    %edi
+  8002a0:	5d                   	pop    %ebp
+  8002a1:	c3                   	ret
+
+008002a2 <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  8002a2:	55                   	push   %ebp
+  8002a3:	89 e5                	mov    %esp,%ebp
+  8002a5:	57                   	push   %edi
+  8002a6:	56                   	push   %esi
+  8002a7:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8002a8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002ab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002ae:	b8 12 00 00 00       	mov    $0x12,%eax
+  8002b3:	be 00 00 00 00       	mov    $0x0,%esi
+  8002b8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8002bb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8002be:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  8002c0:	5b                   	pop    %ebx
+  8002c1:	5e                   	pop    %esi
+  8002c2:	5f                   	pop    %edi
+  8002c3:	5d                   	pop    %ebp
+  8002c4:	c3                   	ret
+
+008002c5 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  8002c5:	55                   	push   %ebp
+  8002c6:	89 e5                	mov    %esp,%ebp
+  8002c8:	57                   	push   %edi
+  8002c9:	56                   	push   %esi
+  8002ca:	53                   	push   %ebx
+  8002cb:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8002ce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002d6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002d9:	b8 16 00 00 00       	mov    $0x16,%eax
+  8002de:	89 df                	mov    %ebx,%edi
+  8002e0:	89 de                	mov    %ebx,%esi
+  8002e2:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8002e4:	85 c0                	test   %eax,%eax
+  8002e6:	7f 08                	jg     8002f0 <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  8002e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002eb:	5b                   	pop    %ebx
+  8002ec:	5e                   	pop    %esi
+  8002ed:	5f                   	pop    %edi
+  8002ee:	5d                   	pop    %ebp
+  8002ef:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8002f0:	83 ec 0c             	sub    $0xc,%esp
+  8002f3:	50                   	push   %eax
+  8002f4:	6a 16                	push   $0x16
+  8002f6:	68 78 2e 80 00       	push   $0x802e78
+  8002fb:	6a 23                	push   $0x23
+  8002fd:	68 95 2e 80 00       	push   $0x802e95
+  800302:	e8 73 1d 00 00       	call   80207a <_panic>
+
+00800307 <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  800307:	55                   	push   %ebp
+  800308:	89 e5                	mov    %esp,%ebp
+  80030a:	57                   	push   %edi
+  80030b:	56                   	push   %esi
+  80030c:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80030d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800312:	8b 55 08             	mov    0x8(%ebp),%edx
+  800315:	b8 17 00 00 00       	mov    $0x17,%eax
+  80031a:	89 cb                	mov    %ecx,%ebx
+  80031c:	89 cf                	mov    %ecx,%edi
+  80031e:	89 ce                	mov    %ecx,%esi
+  800320:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  800322:	5b                   	pop    %ebx
+  800323:	5e                   	pop    %esi
+  800324:	5f                   	pop    %edi
+  800325:	5d                   	pop    %ebp
+  800326:	c3                   	ret
+
+00800327 <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  800327:	55                   	push   %ebp
+  800328:	89 e5                	mov    %esp,%ebp
+  80032a:	57                   	push   %edi
+  80032b:	56                   	push   %esi
+  80032c:	53                   	push   %ebx
+  80032d:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800330:	be 00 00 00 00       	mov    $0x0,%esi
+  800335:	8b 55 08             	mov    0x8(%ebp),%edx
+  800338:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80033b:	b8 18 00 00 00       	mov    $0x18,%eax
+  800340:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800343:	89 f7                	mov    %esi,%edi
+  800345:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800347:	85 c0                	test   %eax,%eax
+  800349:	7f 08                	jg     800353 <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  80034b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80034e:	5b                   	pop    %ebx
+  80034f:	5e                   	pop    %esi
+  800350:	5f                   	pop    %edi
+  800351:	5d                   	pop    %ebp
+  800352:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800353:	83 ec 0c             	sub    $0xc,%esp
+  800356:	50                   	push   %eax
+  800357:	6a 18                	push   $0x18
+  800359:	68 78 2e 80 00       	push   $0x802e78
+  80035e:	6a 23                	push   $0x23
+  800360:	68 95 2e 80 00       	push   $0x802e95
+  800365:	e8 10 1d 00 00       	call   80207a <_panic>
+
+0080036a <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  80036a:	55                   	push   %ebp
+  80036b:	89 e5                	mov    %esp,%ebp
+  80036d:	57                   	push   %edi
+  80036e:	56                   	push   %esi
+  80036f:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800370:	be 00 00 00 00       	mov    $0x0,%esi
+  800375:	8b 55 08             	mov    0x8(%ebp),%edx
+  800378:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80037b:	b8 19 00 00 00       	mov    $0x19,%eax
+  800380:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800383:	89 f7                	mov    %esi,%edi
+  800385:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  800387:	5b                   	pop    %ebx
+  800388:	5e                   	pop    %esi
+  800389:	5f                   	pop    %edi
+  80038a:	5d                   	pop    %ebp
+  80038b:	c3                   	ret
+
+0080038c <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  80038c:	55                   	push   %ebp
+  80038d:	89 e5                	mov    %esp,%ebp
+  80038f:	57                   	push   %edi
+  800390:	56                   	push   %esi
+  800391:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800392:	ba 00 00 00 00       	mov    $0x0,%edx
+  800397:	b8 15 00 00 00       	mov    $0x15,%eax
+  80039c:	89 d1                	mov    %edx,%ecx
+  80039e:	89 d3                	mov    %edx,%ebx
+  8003a0:	89 d7                	mov    %edx,%edi
+  8003a2:	89 d6                	mov    %edx,%esi
+  8003a4:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8003a6:	5b                   	pop    %ebx
+  8003a7:	5e                   	pop    %esi
+  8003a8:	5f                   	pop    %edi
+  8003a9:	5d                   	pop    %ebp
+  8003aa:	c3                   	ret
+
+008003ab <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8003ab:	55                   	push   %ebp
+  8003ac:	89 e5                	mov    %esp,%ebp
+  8003ae:	57                   	push   %edi
+  8003af:	56                   	push   %esi
+  8003b0:	53                   	push   %ebx
+  8003b1:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8003b4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003b9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003bc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003bf:	b8 08 00 00 00       	mov    $0x8,%eax
+  8003c4:	89 df                	mov    %ebx,%edi
+  8003c6:	89 de                	mov    %ebx,%esi
+  8003c8:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8003ca:	85 c0                	test   %eax,%eax
+  8003cc:	7f 08                	jg     8003d6 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8003ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003d1:	5b                   	pop    %ebx
+  8003d2:	5e                   	pop    %esi
+  8003d3:	5f                   	pop    %edi
+  8003d4:	5d                   	pop    %ebp
+  8003d5:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8003d6:	83 ec 0c             	sub    $0xc,%esp
+  8003d9:	50                   	push   %eax
+  8003da:	6a 08                	push   $0x8
+  8003dc:	68 78 2e 80 00       	push   $0x802e78
+  8003e1:	6a 23                	push   $0x23
+  8003e3:	68 95 2e 80 00       	push   $0x802e95
+  8003e8:	e8 8d 1c 00 00       	call   80207a <_panic>
+
+008003ed <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8003ed:	55                   	push   %ebp
+  8003ee:	89 e5                	mov    %esp,%ebp
+  8003f0:	57                   	push   %edi
+  8003f1:	56                   	push   %esi
+  8003f2:	53                   	push   %ebx
+  8003f3:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8003f6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003fb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003fe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800401:	b8 09 00 00 00       	mov    $0x9,%eax
+  800406:	89 df                	mov    %ebx,%edi
+  800408:	89 de                	mov    %ebx,%esi
+  80040a:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80040c:	85 c0                	test   %eax,%eax
+  80040e:	7f 08                	jg     800418 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  800410:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800413:	5b                   	pop    %ebx
+  800414:	5e                   	pop    %esi
+  800415:	5f                   	pop    %edi
+  800416:	5d                   	pop    %ebp
+  800417:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800418:	83 ec 0c             	sub    $0xc,%esp
+  80041b:	50                   	push   %eax
+  80041c:	6a 09                	push   $0x9
+  80041e:	68 78 2e 80 00       	push   $0x802e78
+  800423:	6a 23                	push   $0x23
+  800425:	68 95 2e 80 00       	push   $0x802e95
+  80042a:	e8 4b 1c 00 00       	call   80207a <_panic>
+
+0080042f <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80042f:	55                   	push   %ebp
+  800430:	89 e5                	mov    %esp,%ebp
+  800432:	57                   	push   %edi
+  800433:	56                   	push   %esi
+  800434:	53                   	push   %ebx
+  800435:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800438:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80043d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800440:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800443:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800448:	89 df                	mov    %ebx,%edi
+  80044a:	89 de                	mov    %ebx,%esi
+  80044c:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80044e:	85 c0                	test   %eax,%eax
+  800450:	7f 08                	jg     80045a <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  800452:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800455:	5b                   	pop    %ebx
+  800456:	5e                   	pop    %esi
+  800457:	5f                   	pop    %edi
+  800458:	5d                   	pop    %ebp
+  800459:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80045a:	83 ec 0c             	sub    $0xc,%esp
+  80045d:	50                   	push   %eax
+  80045e:	6a 0a                	push   $0xa
+  800460:	68 78 2e 80 00       	push   $0x802e78
+  800465:	6a 23                	push   $0x23
+  800467:	68 95 2e 80 00       	push   $0x802e95
+  80046c:	e8 09 1c 00 00       	call   80207a <_panic>
+
+00800471 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  800471:	55                   	push   %ebp
+  800472:	89 e5                	mov    %esp,%ebp
+  800474:	57                   	push   %edi
+  800475:	56                   	push   %esi
+  800476:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800477:	8b 55 08             	mov    0x8(%ebp),%edx
+  80047a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80047d:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800482:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800485:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800488:	8b 75 18             	mov    0x18(%ebp),%esi
+  80048b:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  80048d:	5b                   	pop    %ebx
+  80048e:	5e                   	pop    %esi
+  80048f:	5f                   	pop    %edi
+  800490:	5d                   	pop    %ebp
+  800491:	c3                   	ret
+
+00800492 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  800492:	55                   	push   %ebp
+  800493:	89 e5                	mov    %esp,%ebp
+  800495:	57                   	push   %edi
+  800496:	56                   	push   %esi
+  800497:	53                   	push   %ebx
+  800498:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80049b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004a0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004a3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004a6:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8004ab:	89 df                	mov    %ebx,%edi
+  8004ad:	89 de                	mov    %ebx,%esi
+  8004af:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8004b1:	85 c0                	test   %eax,%eax
+  8004b3:	7f 08                	jg     8004bd <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  8004b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004b8:	5b                   	pop    %ebx
+  8004b9:	5e                   	pop    %esi
+  8004ba:	5f                   	pop    %edi
+  8004bb:	5d                   	pop    %ebp
+  8004bc:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8004bd:	83 ec 0c             	sub    $0xc,%esp
+  8004c0:	50                   	push   %eax
+  8004c1:	6a 0d                	push   $0xd
+  8004c3:	68 78 2e 80 00       	push   $0x802e78
+  8004c8:	6a 23                	push   $0x23
+  8004ca:	68 95 2e 80 00       	push   $0x802e95
+  8004cf:	e8 a6 1b 00 00       	call   80207a <_panic>
+
+008004d4 <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  8004d4:	55                   	push   %ebp
+  8004d5:	89 e5                	mov    %esp,%ebp
+  8004d7:	57                   	push   %edi
+  8004d8:	56                   	push   %esi
+  8004d9:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8004da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004df:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8004e4:	89 d1                	mov    %edx,%ecx
+  8004e6:	89 d3                	mov    %edx,%ebx
+  8004e8:	89 d7                	mov    %edx,%edi
+  8004ea:	89 d6                	mov    %edx,%esi
+  8004ec:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8004ee:	5b                   	pop    %ebx
+  8004ef:	5e                   	pop    %esi
+  8004f0:	5f                   	pop    %edi
+  8004f1:	5d                   	pop    %ebp
+  8004f2:	c3                   	ret
+
+008004f3 <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  8004f3:	55                   	push   %ebp
+  8004f4:	89 e5                	mov    %esp,%ebp
+  8004f6:	57                   	push   %edi
+  8004f7:	56                   	push   %esi
+  8004f8:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8004f9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004fc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004ff:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800504:	be 00 00 00 00       	mov    $0x0,%esi
+  800509:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80050c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80050f:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  800511:	5b                   	pop    %ebx
+  800512:	5e                   	pop    %esi
+  800513:	5f                   	pop    %edi
+  800514:	5d                   	pop    %ebp
+  800515:	c3                   	ret
+
+00800516 <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  800516:	55                   	push   %ebp
+  800517:	89 e5                	mov    %esp,%ebp
+  800519:	57                   	push   %edi
+  80051a:	56                   	push   %esi
+  80051b:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80051c:	be 00 00 00 00       	mov    $0x0,%esi
+  800521:	8b 55 08             	mov    0x8(%ebp),%edx
+  800524:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800527:	b8 10 00 00 00       	mov    $0x10,%eax
+  80052c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80052f:	89 f7                	mov    %esi,%edi
+  800531:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  800533:	5b                   	pop    %ebx
+  800534:	5e                   	pop    %esi
+  800535:	5f                   	pop    %edi
+  800536:	5d                   	pop    %ebp
+  800537:	c3                   	ret
+
+00800538 <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  800538:	55                   	push   %ebp
+  800539:	89 e5                	mov    %esp,%ebp
+  80053b:	57                   	push   %edi
+  80053c:	56                   	push   %esi
+  80053d:	53                   	push   %ebx
+  80053e:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  800541:	80 3d 48 57 80 00 00 	cmpb   $0x0,0x805748
+  800548:	74 41                	je     80058b <sys_batch+0x53>
+  80054a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80054d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  800550:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  800557:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80055a:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  80055d:	7d 45                	jge    8005a4 <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  80055f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800562:	8b 06                	mov    (%esi),%eax
+  800564:	8b 56 04             	mov    0x4(%esi),%edx
+  800567:	8b 4e 08             	mov    0x8(%esi),%ecx
+  80056a:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  80056d:	8b 7e 10             	mov    0x10(%esi),%edi
+  800570:	8b 76 14             	mov    0x14(%esi),%esi
+  800573:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  800575:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800578:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  80057b:	83 c6 1c             	add    $0x1c,%esi
+  80057e:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  800581:	85 c0                	test   %eax,%eax
+  800583:	78 1f                	js     8005a4 <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  800585:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  800589:	eb cc                	jmp    800557 <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  80058b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800590:	b8 13 00 00 00       	mov    $0x13,%eax
+  800595:	8b 55 08             	mov    0x8(%ebp),%edx
+  800598:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80059b:	89 df                	mov    %ebx,%edi
+  80059d:	89 de                	mov    %ebx,%esi
+  80059f:	cd 30                	int    $0x30
+  8005a1:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  8005a4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8005a7:	83 c4 08             	add    $0x8,%esp
+  8005aa:	5b                   	pop    %ebx
+  8005ab:	5e                   	pop    %esi
+  8005ac:	5f                   	pop    %edi
+  8005ad:	5d                   	pop    %ebp
+  8005ae:	c3                   	ret
+
+008005af <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  8005af:	55                   	push   %ebp
+  8005b0:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  8005b2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8005b5:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8005bb:	5d                   	pop    %ebp
+  8005bc:	c3                   	ret
+
+008005bd <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  8005bd:	55                   	push   %ebp
+  8005be:	89 e5                	mov    %esp,%ebp
+  8005c0:	56                   	push   %esi
+  8005c1:	53                   	push   %ebx
+  8005c2:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  8005c5:	8b 1e                	mov    (%esi),%ebx
+  8005c7:	85 db                	test   %ebx,%ebx
+  8005c9:	75 09                	jne    8005d4 <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  8005cb:	89 d8                	mov    %ebx,%eax
+  8005cd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8005d0:	5b                   	pop    %ebx
+  8005d1:	5e                   	pop    %esi
+  8005d2:	5d                   	pop    %ebp
+  8005d3:	c3                   	ret
+  b->sb_n = 0;
+  8005d4:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  8005da:	53                   	push   %ebx
+  8005db:	8d 46 04             	lea    0x4(%esi),%eax
+  8005de:	50                   	push   %eax
+  8005df:	e8 54 ff ff ff       	call   800538 <sys_batch>
+  8005e4:	83 c4 08             	add    $0x8,%esp
+  8005e7:	85 c0                	test   %eax,%eax
+  8005e9:	78 1e                	js     800609 <sysbatch_flush+0x4c>
+  if (r < n)
+  8005eb:	39 c3                	cmp    %eax,%ebx
+  8005ed:	7f 07                	jg     8005f6 <sysbatch_flush+0x39>
+  return 0;
+  8005ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005f4:	eb d5                	jmp    8005cb <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  8005f6:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8005f9:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  8005fd:	85 db                	test   %ebx,%ebx
+  8005ff:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800604:	0f 49 d8             	cmovns %eax,%ebx
+  800607:	eb c2                	jmp    8005cb <sysbatch_flush+0xe>
+    return r;
+  800609:	89 c3                	mov    %eax,%ebx
+  80060b:	eb be                	jmp    8005cb <sysbatch_flush+0xe>
+
+0080060d <sysbatch_add>:
+{
+  80060d:	55                   	push   %ebp
+  80060e:	89 e5                	mov    %esp,%ebp
+  800610:	53                   	push   %ebx
+  800611:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  800614:	83 3b 40             	cmpl   $0x40,(%ebx)
+  800617:	74 41                	je     80065a <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  800619:	8b 03                	mov    (%ebx),%eax
+  80061b:	8d 50 01             	lea    0x1(%eax),%edx
+  80061e:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  800620:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  800623:	01 d8                	add    %ebx,%eax
+  800625:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800628:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  80062b:	8b 55 10             	mov    0x10(%ebp),%edx
+  80062e:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  800631:	8b 55 14             	mov    0x14(%ebp),%edx
+  800634:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  800637:	8b 55 18             	mov    0x18(%ebp),%edx
+  80063a:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  80063d:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  800640:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  800643:	8b 55 20             	mov    0x20(%ebp),%edx
+  800646:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  800649:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  800650:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800655:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800658:	c9                   	leave
+  800659:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  80065a:	53                   	push   %ebx
+  80065b:	e8 5d ff ff ff       	call   8005bd <sysbatch_flush>
+  800660:	83 c4 04             	add    $0x4,%esp
+  800663:	85 c0                	test   %eax,%eax
+  800665:	79 b2                	jns    800619 <sysbatch_add+0xc>
+  800667:	eb ec                	jmp    800655 <sysbatch_add+0x48>
+
+00800669 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800669:	55                   	push   %ebp
+  80066a:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80066c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80066f:	05 00 00 00 30       	add    $0x30000000,%eax
+  800674:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800677:	5d                   	pop    %ebp
+  800678:	c3                   	ret
+
+00800679 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800679:	55                   	push   %ebp
+  80067a:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80067c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80067f:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  800682:	66 b8 00 00          	mov    $0x0,%ax
+  800686:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80068b:	5d                   	pop    %ebp
+  80068c:	c3                   	ret
+
+0080068d <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80068d:	55                   	push   %ebp
+  80068e:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  800690:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  800695:	eb 02                	jmp    800699 <fd_alloc+0xc>
+  800697:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800699:	89 c2                	mov    %eax,%edx
+  80069b:	c1 ea 16             	shr    $0x16,%edx
+  80069e:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8006a5:	f6 c2 01             	test   $0x1,%dl
+  8006a8:	74 2b                	je     8006d5 <fd_alloc+0x48>
+  8006aa:	89 c2                	mov    %eax,%edx
+  8006ac:	c1 ea 0c             	shr    $0xc,%edx
+  8006af:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8006b6:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8006bc:	f6 c1 01             	test   $0x1,%cl
+  8006bf:	74 14                	je     8006d5 <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  8006c1:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8006c7:	75 ce                	jne    800697 <fd_alloc+0xa>
+  8006c9:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  8006ce:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8006d3:	eb 05                	jmp    8006da <fd_alloc+0x4d>
+      return 0;
+  8006d5:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  8006da:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006dd:	89 02                	mov    %eax,(%edx)
+}
+  8006df:	89 c8                	mov    %ecx,%eax
+  8006e1:	5d                   	pop    %ebp
+  8006e2:	c3                   	ret
+
+008006e3 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8006e3:	55                   	push   %ebp
+  8006e4:	89 e5                	mov    %esp,%ebp
+  8006e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  8006e9:	83 f8 1f             	cmp    $0x1f,%eax
+  8006ec:	77 30                	ja     80071e <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  8006ee:	c1 e0 0c             	shl    $0xc,%eax
+  8006f1:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8006f6:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8006fc:	f6 c2 01             	test   $0x1,%dl
+  8006ff:	74 24                	je     800725 <fd_lookup+0x42>
+  800701:	89 c2                	mov    %eax,%edx
+  800703:	c1 ea 0c             	shr    $0xc,%edx
+  800706:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80070d:	f6 c2 01             	test   $0x1,%dl
+  800710:	74 1a                	je     80072c <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  800712:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800715:	89 02                	mov    %eax,(%edx)
+  return 0;
+  800717:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80071c:	5d                   	pop    %ebp
+  80071d:	c3                   	ret
+    return -E_INVAL;
+  80071e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800723:	eb f7                	jmp    80071c <fd_lookup+0x39>
+    return -E_INVAL;
+  800725:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80072a:	eb f0                	jmp    80071c <fd_lookup+0x39>
+  80072c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800731:	eb e9                	jmp    80071c <fd_lookup+0x39>
+
+00800733 <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  800733:	55                   	push   %ebp
+  800734:	89 e5                	mov    %esp,%ebp
+  800736:	53                   	push   %ebx
+  800737:	83 ec 04             	sub    $0x4,%esp
+  80073a:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  80073d:	b8 20 2f 80 00       	mov    $0x802f20,%eax
+  800742:	8b 18                	mov    (%eax),%ebx
+  800744:	85 db                	test   %ebx,%ebx
+  800746:	74 0e                	je     800756 <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  800748:	83 c0 04             	add    $0x4,%eax
+  80074b:	39 13                	cmp    %edx,(%ebx)
+  80074d:	75 f3                	jne    800742 <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  80074f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800754:	eb 1f                	jmp    800775 <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800756:	a1 44 57 80 00       	mov    0x805744,%eax
+  80075b:	8b 40 48             	mov    0x48(%eax),%eax
+  80075e:	83 ec 04             	sub    $0x4,%esp
+  800761:	52                   	push   %edx
+  800762:	50                   	push   %eax
+  800763:	68 a4 2e 80 00       	push   $0x802ea4
+  800768:	e8 e8 19 00 00       	call   802155 <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  80076d:	83 c4 10             	add    $0x10,%esp
+  800770:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  800775:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800778:	89 1a                	mov    %ebx,(%edx)
+}
+  80077a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80077d:	c9                   	leave
+  80077e:	c3                   	ret
+
+0080077f <fd_close>:
+{
+  80077f:	55                   	push   %ebp
+  800780:	89 e5                	mov    %esp,%ebp
+  800782:	57                   	push   %edi
+  800783:	56                   	push   %esi
+  800784:	53                   	push   %ebx
+  800785:	83 ec 24             	sub    $0x24,%esp
+  800788:	8b 75 08             	mov    0x8(%ebp),%esi
+  80078b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80078e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800791:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  800792:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800798:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80079b:	50                   	push   %eax
+  80079c:	e8 42 ff ff ff       	call   8006e3 <fd_lookup>
+  8007a1:	89 c3                	mov    %eax,%ebx
+  8007a3:	83 c4 10             	add    $0x10,%esp
+  8007a6:	85 c0                	test   %eax,%eax
+  8007a8:	78 05                	js     8007af <fd_close+0x30>
+      || fd != fd2)
+  8007aa:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8007ad:	74 16                	je     8007c5 <fd_close+0x46>
+    return must_exist ? r : 0;
+  8007af:	89 f8                	mov    %edi,%eax
+  8007b1:	84 c0                	test   %al,%al
+  8007b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007b8:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8007bb:	89 d8                	mov    %ebx,%eax
+  8007bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007c0:	5b                   	pop    %ebx
+  8007c1:	5e                   	pop    %esi
+  8007c2:	5f                   	pop    %edi
+  8007c3:	5d                   	pop    %ebp
+  8007c4:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8007c5:	83 ec 08             	sub    $0x8,%esp
+  8007c8:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8007cb:	50                   	push   %eax
+  8007cc:	ff 36                	push   (%esi)
+  8007ce:	e8 60 ff ff ff       	call   800733 <dev_lookup>
+  8007d3:	89 c3                	mov    %eax,%ebx
+  8007d5:	83 c4 10             	add    $0x10,%esp
+  8007d8:	85 c0                	test   %eax,%eax
+  8007da:	78 1a                	js     8007f6 <fd_close+0x77>
+    if (dev->dev_close)
+  8007dc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8007df:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  8007e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  8007e7:	85 c0                	test   %eax,%eax
+  8007e9:	74 0b                	je     8007f6 <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  8007eb:	83 ec 0c             	sub    $0xc,%esp
+  8007ee:	56                   	push   %esi
+  8007ef:	ff d0                	call   *%eax
+  8007f1:	89 c3                	mov    %eax,%ebx
+  8007f3:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  8007f6:	83 ec 08             	sub    $0x8,%esp
+  8007f9:	56                   	push   %esi
+  8007fa:	6a 00                	push   $0x0
+  8007fc:	e8 3e fa ff ff       	call   80023f <sys_page_unmap>
+  return r;
+  800801:	83 c4 10             	add    $0x10,%esp
+  800804:	eb b5                	jmp    8007bb <fd_close+0x3c>
+
+00800806 <close>:
+
+int
+close(int fdnum)
+{
+  800806:	55                   	push   %ebp
+  800807:	89 e5                	mov    %esp,%ebp
+  800809:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80080c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80080f:	50                   	push   %eax
+  800810:	ff 75 08             	push   0x8(%ebp)
+  800813:	e8 cb fe ff ff       	call   8006e3 <fd_lookup>
+  800818:	83 c4 10             	add    $0x10,%esp
+  80081b:	85 c0                	test   %eax,%eax
+  80081d:	79 02                	jns    800821 <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  80081f:	c9                   	leave
+  800820:	c3                   	ret
+    return fd_close(fd, 1);
+  800821:	83 ec 08             	sub    $0x8,%esp
+  800824:	6a 01                	push   $0x1
+  800826:	ff 75 f4             	push   -0xc(%ebp)
+  800829:	e8 51 ff ff ff       	call   80077f <fd_close>
+  80082e:	83 c4 10             	add    $0x10,%esp
+  800831:	eb ec                	jmp    80081f <close+0x19>
+
+00800833 <close_all>:
+
+void
+close_all(void)
+{
+  800833:	55                   	push   %ebp
+  800834:	89 e5                	mov    %esp,%ebp
+  800836:	53                   	push   %ebx
+  800837:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  80083a:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  80083f:	83 ec 0c             	sub    $0xc,%esp
+  800842:	53                   	push   %ebx
+  800843:	e8 be ff ff ff       	call   800806 <close>
+  for (i = 0; i < MAXFD; i++)
+  800848:	83 c3 01             	add    $0x1,%ebx
+  80084b:	83 c4 10             	add    $0x10,%esp
+  80084e:	83 fb 20             	cmp    $0x20,%ebx
+  800851:	75 ec                	jne    80083f <close_all+0xc>
+}
+  800853:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800856:	c9                   	leave
+  800857:	c3                   	ret
+
+00800858 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  800858:	55                   	push   %ebp
+  800859:	89 e5                	mov    %esp,%ebp
+  80085b:	57                   	push   %edi
+  80085c:	56                   	push   %esi
+  80085d:	53                   	push   %ebx
+  80085e:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  800861:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800864:	50                   	push   %eax
+  800865:	ff 75 08             	push   0x8(%ebp)
+  800868:	e8 76 fe ff ff       	call   8006e3 <fd_lookup>
+  80086d:	89 c6                	mov    %eax,%esi
+  80086f:	83 c4 10             	add    $0x10,%esp
+  800872:	85 c0                	test   %eax,%eax
+  800874:	0f 88 0a 01 00 00    	js     800984 <dup+0x12c>
+    return r;
+  close(newfdnum);
+  80087a:	83 ec 0c             	sub    $0xc,%esp
+  80087d:	ff 75 0c             	push   0xc(%ebp)
+  800880:	e8 81 ff ff ff       	call   800806 <close>
+
+  newfd = INDEX2FD(newfdnum);
+  800885:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800888:	c1 e0 0c             	shl    $0xc,%eax
+  80088b:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  800891:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  800894:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800897:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  80089a:	89 04 24             	mov    %eax,(%esp)
+  80089d:	e8 d7 fd ff ff       	call   800679 <fd2data>
+  8008a2:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  8008a4:	89 3c 24             	mov    %edi,(%esp)
+  8008a7:	e8 cd fd ff ff       	call   800679 <fd2data>
+  8008ac:	83 c4 10             	add    $0x10,%esp
+  8008af:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8008b2:	89 f3                	mov    %esi,%ebx
+  8008b4:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  8008ba:	89 c6                	mov    %eax,%esi
+  8008bc:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8008bf:	89 cf                	mov    %ecx,%edi
+  8008c1:	eb 0c                	jmp    8008cf <dup+0x77>
+  8008c3:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8008c9:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8008cf:	39 fb                	cmp    %edi,%ebx
+  8008d1:	74 7b                	je     80094e <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  8008d3:	89 d8                	mov    %ebx,%eax
+  8008d5:	c1 e8 16             	shr    $0x16,%eax
+  8008d8:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8008df:	a8 01                	test   $0x1,%al
+  8008e1:	74 e0                	je     8008c3 <dup+0x6b>
+  8008e3:	89 d8                	mov    %ebx,%eax
+  8008e5:	c1 e8 0c             	shr    $0xc,%eax
+  8008e8:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8008ef:	f6 c2 01             	test   $0x1,%dl
+  8008f2:	74 cf                	je     8008c3 <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  8008f4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  8008fb:	83 ec 0c             	sub    $0xc,%esp
+  8008fe:	25 07 0e 00 00       	and    $0xe07,%eax
+  800903:	50                   	push   %eax
+  800904:	56                   	push   %esi
+  800905:	6a 00                	push   $0x0
+  800907:	53                   	push   %ebx
+  800908:	6a 00                	push   $0x0
+  80090a:	e8 ee f8 ff ff       	call   8001fd <sys_page_map>
+  80090f:	83 c4 20             	add    $0x20,%esp
+  800912:	85 c0                	test   %eax,%eax
+  800914:	79 ad                	jns    8008c3 <dup+0x6b>
+  800916:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800919:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  80091b:	83 ec 08             	sub    $0x8,%esp
+  80091e:	ff 75 d4             	push   -0x2c(%ebp)
+  800921:	6a 00                	push   $0x0
+  800923:	e8 17 f9 ff ff       	call   80023f <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  800928:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  80092b:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  800931:	83 c4 10             	add    $0x10,%esp
+  800934:	39 df                	cmp    %ebx,%edi
+  800936:	74 4c                	je     800984 <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  800938:	83 ec 08             	sub    $0x8,%esp
+  80093b:	57                   	push   %edi
+  80093c:	6a 00                	push   $0x0
+  80093e:	e8 fc f8 ff ff       	call   80023f <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  800943:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  800949:	83 c4 10             	add    $0x10,%esp
+  80094c:	eb e6                	jmp    800934 <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80094e:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800951:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800954:	89 c8                	mov    %ecx,%eax
+  800956:	c1 e8 0c             	shr    $0xc,%eax
+  800959:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800960:	83 ec 0c             	sub    $0xc,%esp
+  800963:	25 07 0e 00 00       	and    $0xe07,%eax
+  800968:	50                   	push   %eax
+  800969:	ff 75 d4             	push   -0x2c(%ebp)
+  80096c:	6a 00                	push   $0x0
+  80096e:	51                   	push   %ecx
+  80096f:	6a 00                	push   $0x0
+  800971:	e8 87 f8 ff ff       	call   8001fd <sys_page_map>
+  800976:	89 c6                	mov    %eax,%esi
+  800978:	83 c4 20             	add    $0x20,%esp
+  80097b:	85 c0                	test   %eax,%eax
+  80097d:	78 9c                	js     80091b <dup+0xc3>
+  return newfdnum;
+  80097f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800982:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  800984:	89 f0                	mov    %esi,%eax
+  800986:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800989:	5b                   	pop    %ebx
+  80098a:	5e                   	pop    %esi
+  80098b:	5f                   	pop    %edi
+  80098c:	5d                   	pop    %ebp
+  80098d:	c3                   	ret
+
+0080098e <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80098e:	55                   	push   %ebp
+  80098f:	89 e5                	mov    %esp,%ebp
+  800991:	56                   	push   %esi
+  800992:	53                   	push   %ebx
+  800993:	83 ec 18             	sub    $0x18,%esp
+  800996:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  800999:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80099c:	50                   	push   %eax
+  80099d:	56                   	push   %esi
+  80099e:	e8 40 fd ff ff       	call   8006e3 <fd_lookup>
+  8009a3:	83 c4 10             	add    $0x10,%esp
+  8009a6:	85 c0                	test   %eax,%eax
+  8009a8:	78 3c                	js     8009e6 <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8009aa:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8009ad:	83 ec 08             	sub    $0x8,%esp
+  8009b0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8009b3:	50                   	push   %eax
+  8009b4:	ff 33                	push   (%ebx)
+  8009b6:	e8 78 fd ff ff       	call   800733 <dev_lookup>
+  8009bb:	83 c4 10             	add    $0x10,%esp
+  8009be:	85 c0                	test   %eax,%eax
+  8009c0:	78 24                	js     8009e6 <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8009c2:	8b 43 08             	mov    0x8(%ebx),%eax
+  8009c5:	83 e0 03             	and    $0x3,%eax
+  8009c8:	83 f8 01             	cmp    $0x1,%eax
+  8009cb:	74 20                	je     8009ed <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  8009cd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009d0:	8b 40 08             	mov    0x8(%eax),%eax
+  8009d3:	85 c0                	test   %eax,%eax
+  8009d5:	74 37                	je     800a0e <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  8009d7:	83 ec 04             	sub    $0x4,%esp
+  8009da:	ff 75 10             	push   0x10(%ebp)
+  8009dd:	ff 75 0c             	push   0xc(%ebp)
+  8009e0:	53                   	push   %ebx
+  8009e1:	ff d0                	call   *%eax
+  8009e3:	83 c4 10             	add    $0x10,%esp
+}
+  8009e6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8009e9:	5b                   	pop    %ebx
+  8009ea:	5e                   	pop    %esi
+  8009eb:	5d                   	pop    %ebp
+  8009ec:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8009ed:	a1 44 57 80 00       	mov    0x805744,%eax
+  8009f2:	8b 40 48             	mov    0x48(%eax),%eax
+  8009f5:	83 ec 04             	sub    $0x4,%esp
+  8009f8:	56                   	push   %esi
+  8009f9:	50                   	push   %eax
+  8009fa:	68 e5 2e 80 00       	push   $0x802ee5
+  8009ff:	e8 51 17 00 00       	call   802155 <cprintf>
+    return -E_INVAL;
+  800a04:	83 c4 10             	add    $0x10,%esp
+  800a07:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a0c:	eb d8                	jmp    8009e6 <read+0x58>
+    return -E_NOT_SUPP;
+  800a0e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800a13:	eb d1                	jmp    8009e6 <read+0x58>
+
+00800a15 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  800a15:	55                   	push   %ebp
+  800a16:	89 e5                	mov    %esp,%ebp
+  800a18:	57                   	push   %edi
+  800a19:	56                   	push   %esi
+  800a1a:	53                   	push   %ebx
+  800a1b:	83 ec 0c             	sub    $0xc,%esp
+  800a1e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a21:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  800a24:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800a29:	eb 02                	jmp    800a2d <readn+0x18>
+  800a2b:	01 c3                	add    %eax,%ebx
+  800a2d:	39 f3                	cmp    %esi,%ebx
+  800a2f:	73 21                	jae    800a52 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  800a31:	83 ec 04             	sub    $0x4,%esp
+  800a34:	89 f0                	mov    %esi,%eax
+  800a36:	29 d8                	sub    %ebx,%eax
+  800a38:	50                   	push   %eax
+  800a39:	89 d8                	mov    %ebx,%eax
+  800a3b:	03 45 0c             	add    0xc(%ebp),%eax
+  800a3e:	50                   	push   %eax
+  800a3f:	57                   	push   %edi
+  800a40:	e8 49 ff ff ff       	call   80098e <read>
+    if (m < 0)
+  800a45:	83 c4 10             	add    $0x10,%esp
+  800a48:	85 c0                	test   %eax,%eax
+  800a4a:	78 04                	js     800a50 <readn+0x3b>
+      return m;
+    if (m == 0)
+  800a4c:	75 dd                	jne    800a2b <readn+0x16>
+  800a4e:	eb 02                	jmp    800a52 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  800a50:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  800a52:	89 d8                	mov    %ebx,%eax
+  800a54:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a57:	5b                   	pop    %ebx
+  800a58:	5e                   	pop    %esi
+  800a59:	5f                   	pop    %edi
+  800a5a:	5d                   	pop    %ebp
+  800a5b:	c3                   	ret
+
+00800a5c <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  800a5c:	55                   	push   %ebp
+  800a5d:	89 e5                	mov    %esp,%ebp
+  800a5f:	56                   	push   %esi
+  800a60:	53                   	push   %ebx
+  800a61:	83 ec 18             	sub    $0x18,%esp
+  800a64:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  800a67:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800a6a:	50                   	push   %eax
+  800a6b:	53                   	push   %ebx
+  800a6c:	e8 72 fc ff ff       	call   8006e3 <fd_lookup>
+  800a71:	83 c4 10             	add    $0x10,%esp
+  800a74:	85 c0                	test   %eax,%eax
+  800a76:	78 37                	js     800aaf <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800a78:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800a7b:	83 ec 08             	sub    $0x8,%esp
+  800a7e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a81:	50                   	push   %eax
+  800a82:	ff 36                	push   (%esi)
+  800a84:	e8 aa fc ff ff       	call   800733 <dev_lookup>
+  800a89:	83 c4 10             	add    $0x10,%esp
+  800a8c:	85 c0                	test   %eax,%eax
+  800a8e:	78 1f                	js     800aaf <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800a90:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800a94:	74 20                	je     800ab6 <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  800a96:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a99:	8b 40 0c             	mov    0xc(%eax),%eax
+  800a9c:	85 c0                	test   %eax,%eax
+  800a9e:	74 37                	je     800ad7 <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  800aa0:	83 ec 04             	sub    $0x4,%esp
+  800aa3:	ff 75 10             	push   0x10(%ebp)
+  800aa6:	ff 75 0c             	push   0xc(%ebp)
+  800aa9:	56                   	push   %esi
+  800aaa:	ff d0                	call   *%eax
+  800aac:	83 c4 10             	add    $0x10,%esp
+}
+  800aaf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ab2:	5b                   	pop    %ebx
+  800ab3:	5e                   	pop    %esi
+  800ab4:	5d                   	pop    %ebp
+  800ab5:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800ab6:	a1 44 57 80 00       	mov    0x805744,%eax
+  800abb:	8b 40 48             	mov    0x48(%eax),%eax
+  800abe:	83 ec 04             	sub    $0x4,%esp
+  800ac1:	53                   	push   %ebx
+  800ac2:	50                   	push   %eax
+  800ac3:	68 01 2f 80 00       	push   $0x802f01
+  800ac8:	e8 88 16 00 00       	call   802155 <cprintf>
+    return -E_INVAL;
+  800acd:	83 c4 10             	add    $0x10,%esp
+  800ad0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ad5:	eb d8                	jmp    800aaf <write+0x53>
+    return -E_NOT_SUPP;
+  800ad7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800adc:	eb d1                	jmp    800aaf <write+0x53>
+
+00800ade <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  800ade:	55                   	push   %ebp
+  800adf:	89 e5                	mov    %esp,%ebp
+  800ae1:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800ae4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800ae7:	50                   	push   %eax
+  800ae8:	ff 75 08             	push   0x8(%ebp)
+  800aeb:	e8 f3 fb ff ff       	call   8006e3 <fd_lookup>
+  800af0:	83 c4 10             	add    $0x10,%esp
+  800af3:	85 c0                	test   %eax,%eax
+  800af5:	78 0e                	js     800b05 <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  800af7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800afa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800afd:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  800b00:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b05:	c9                   	leave
+  800b06:	c3                   	ret
+
+00800b07 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800b07:	55                   	push   %ebp
+  800b08:	89 e5                	mov    %esp,%ebp
+  800b0a:	56                   	push   %esi
+  800b0b:	53                   	push   %ebx
+  800b0c:	83 ec 18             	sub    $0x18,%esp
+  800b0f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  800b12:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800b15:	50                   	push   %eax
+  800b16:	53                   	push   %ebx
+  800b17:	e8 c7 fb ff ff       	call   8006e3 <fd_lookup>
+  800b1c:	83 c4 10             	add    $0x10,%esp
+  800b1f:	85 c0                	test   %eax,%eax
+  800b21:	78 34                	js     800b57 <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800b23:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800b26:	83 ec 08             	sub    $0x8,%esp
+  800b29:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b2c:	50                   	push   %eax
+  800b2d:	ff 36                	push   (%esi)
+  800b2f:	e8 ff fb ff ff       	call   800733 <dev_lookup>
+  800b34:	83 c4 10             	add    $0x10,%esp
+  800b37:	85 c0                	test   %eax,%eax
+  800b39:	78 1c                	js     800b57 <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800b3b:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800b3f:	74 1d                	je     800b5e <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  800b41:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b44:	8b 40 18             	mov    0x18(%eax),%eax
+  800b47:	85 c0                	test   %eax,%eax
+  800b49:	74 34                	je     800b7f <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  800b4b:	83 ec 08             	sub    $0x8,%esp
+  800b4e:	ff 75 0c             	push   0xc(%ebp)
+  800b51:	56                   	push   %esi
+  800b52:	ff d0                	call   *%eax
+  800b54:	83 c4 10             	add    $0x10,%esp
+}
+  800b57:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b5a:	5b                   	pop    %ebx
+  800b5b:	5e                   	pop    %esi
+  800b5c:	5d                   	pop    %ebp
+  800b5d:	c3                   	ret
+            thisenv->env_id, fdnum);
+  800b5e:	a1 44 57 80 00       	mov    0x805744,%eax
+  800b63:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800b66:	83 ec 04             	sub    $0x4,%esp
+  800b69:	53                   	push   %ebx
+  800b6a:	50                   	push   %eax
+  800b6b:	68 c4 2e 80 00       	push   $0x802ec4
+  800b70:	e8 e0 15 00 00       	call   802155 <cprintf>
+    return -E_INVAL;
+  800b75:	83 c4 10             	add    $0x10,%esp
+  800b78:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b7d:	eb d8                	jmp    800b57 <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  800b7f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800b84:	eb d1                	jmp    800b57 <ftruncate+0x50>
+
+00800b86 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800b86:	55                   	push   %ebp
+  800b87:	89 e5                	mov    %esp,%ebp
+  800b89:	56                   	push   %esi
+  800b8a:	53                   	push   %ebx
+  800b8b:	83 ec 18             	sub    $0x18,%esp
+  800b8e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  800b91:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800b94:	50                   	push   %eax
+  800b95:	ff 75 08             	push   0x8(%ebp)
+  800b98:	e8 46 fb ff ff       	call   8006e3 <fd_lookup>
+  800b9d:	83 c4 10             	add    $0x10,%esp
+  800ba0:	85 c0                	test   %eax,%eax
+  800ba2:	78 49                	js     800bed <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800ba4:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800ba7:	83 ec 08             	sub    $0x8,%esp
+  800baa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800bad:	50                   	push   %eax
+  800bae:	ff 36                	push   (%esi)
+  800bb0:	e8 7e fb ff ff       	call   800733 <dev_lookup>
+  800bb5:	83 c4 10             	add    $0x10,%esp
+  800bb8:	85 c0                	test   %eax,%eax
+  800bba:	78 31                	js     800bed <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  800bbc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800bbf:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800bc3:	74 2f                	je     800bf4 <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  800bc5:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  800bc8:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800bcf:	00 00 00 
+  stat->st_isdir = 0;
+  800bd2:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800bd9:	00 00 00 
+  stat->st_dev = dev;
+  800bdc:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  800be2:	83 ec 08             	sub    $0x8,%esp
+  800be5:	53                   	push   %ebx
+  800be6:	56                   	push   %esi
+  800be7:	ff 50 14             	call   *0x14(%eax)
+  800bea:	83 c4 10             	add    $0x10,%esp
+}
+  800bed:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800bf0:	5b                   	pop    %ebx
+  800bf1:	5e                   	pop    %esi
+  800bf2:	5d                   	pop    %ebp
+  800bf3:	c3                   	ret
+    return -E_NOT_SUPP;
+  800bf4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800bf9:	eb f2                	jmp    800bed <fstat+0x67>
+
+00800bfb <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  800bfb:	55                   	push   %ebp
+  800bfc:	89 e5                	mov    %esp,%ebp
+  800bfe:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  800c01:	ff 75 0c             	push   0xc(%ebp)
+  800c04:	ff 75 08             	push   0x8(%ebp)
+  800c07:	e8 58 07 00 00       	call   801364 <file_stat>
+}
+  800c0c:	c9                   	leave
+  800c0d:	c3                   	ret
+
+00800c0e <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  800c0e:	55                   	push   %ebp
+  800c0f:	89 e5                	mov    %esp,%ebp
+  800c11:	57                   	push   %edi
+  800c12:	56                   	push   %esi
+  800c13:	53                   	push   %ebx
+  800c14:	83 ec 1c             	sub    $0x1c,%esp
+  800c17:	89 c7                	mov    %eax,%edi
+  800c19:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  800c1c:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  800c1f:	e9 a2 00 00 00       	jmp    800cc6 <fsipc_send+0xb8>
+  nfsenvs = 0;
+  800c24:	c7 05 00 50 80 00 00 	movl   $0x0,0x805000
+  800c2b:	00 00 00 
+  800c2e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c33:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  800c38:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  800c3d:	be 01 00 00 00       	mov    $0x1,%esi
+  800c42:	eb 0f                	jmp    800c53 <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  800c44:	83 c0 01             	add    $0x1,%eax
+  800c47:	3d 00 04 00 00       	cmp    $0x400,%eax
+  800c4c:	74 49                	je     800c97 <fsipc_send+0x89>
+  800c4e:	83 f9 07             	cmp    $0x7,%ecx
+  800c51:	7f 50                	jg     800ca3 <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  800c53:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  800c56:	c1 e2 04             	shl    $0x4,%edx
+  800c59:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800c5f:	8b 52 50             	mov    0x50(%edx),%edx
+  800c62:	83 fa 01             	cmp    $0x1,%edx
+  800c65:	75 dd                	jne    800c44 <fsipc_send+0x36>
+  800c67:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  800c6a:	c1 e2 04             	shl    $0x4,%edx
+  800c6d:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800c73:	8b 52 54             	mov    0x54(%edx),%edx
+  800c76:	85 d2                	test   %edx,%edx
+  800c78:	74 ca                	je     800c44 <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  800c7a:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  800c7d:	c1 e2 04             	shl    $0x4,%edx
+  800c80:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800c86:	8b 52 48             	mov    0x48(%edx),%edx
+  800c89:	89 14 8d 20 50 80 00 	mov    %edx,0x805020(,%ecx,4)
+  800c90:	8d 49 01             	lea    0x1(%ecx),%ecx
+  800c93:	89 f3                	mov    %esi,%ebx
+  800c95:	eb ad                	jmp    800c44 <fsipc_send+0x36>
+  800c97:	84 db                	test   %bl,%bl
+  800c99:	74 38                	je     800cd3 <fsipc_send+0xc5>
+  800c9b:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  800ca1:	eb 30                	jmp    800cd3 <fsipc_send+0xc5>
+  800ca3:	84 db                	test   %bl,%bl
+  800ca5:	74 2c                	je     800cd3 <fsipc_send+0xc5>
+  800ca7:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  800cad:	eb 24                	jmp    800cd3 <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  800caf:	50                   	push   %eax
+  800cb0:	68 30 2f 80 00       	push   $0x802f30
+  800cb5:	6a 34                	push   $0x34
+  800cb7:	68 3a 2f 80 00       	push   $0x802f3a
+  800cbc:	e8 b9 13 00 00       	call   80207a <_panic>
+    }
+    sys_yield();
+  800cc1:	e8 92 f4 ff ff       	call   800158 <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  800cc6:	83 3d 00 50 80 00 03 	cmpl   $0x3,0x805000
+  800ccd:	0f 8e 51 ff ff ff    	jle    800c24 <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  800cd3:	a1 44 57 80 00       	mov    0x805744,%eax
+  800cd8:	8b 70 48             	mov    0x48(%eax),%esi
+  800cdb:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  800ce1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ce6:	8b 0d 00 50 80 00    	mov    0x805000,%ecx
+  800cec:	39 d9                	cmp    %ebx,%ecx
+  800cee:	7e d1                	jle    800cc1 <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  800cf0:	83 ec 0c             	sub    $0xc,%esp
+  800cf3:	ff 75 e0             	push   -0x20(%ebp)
+  800cf6:	6a 07                	push   $0x7
+  800cf8:	ff 75 e4             	push   -0x1c(%ebp)
+  800cfb:	57                   	push   %edi
+  800cfc:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  800cff:	99                   	cltd
+  800d00:	f7 f9                	idiv   %ecx
+  800d02:	ff 34 95 20 50 80 00 	push   0x805020(,%edx,4)
+  800d09:	e8 63 f7 ff ff       	call   800471 <sys_ipc_try_send>
+      if (r == 0)
+  800d0e:	83 c4 20             	add    $0x20,%esp
+  800d11:	85 c0                	test   %eax,%eax
+  800d13:	74 0a                	je     800d1f <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  800d15:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  800d18:	75 95                	jne    800caf <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  800d1a:	83 c3 01             	add    $0x1,%ebx
+  800d1d:	eb c7                	jmp    800ce6 <fsipc_send+0xd8>
+  }
+}
+  800d1f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d22:	5b                   	pop    %ebx
+  800d23:	5e                   	pop    %esi
+  800d24:	5f                   	pop    %edi
+  800d25:	5d                   	pop    %ebp
+  800d26:	c3                   	ret
+
+00800d27 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  800d27:	55                   	push   %ebp
+  800d28:	89 e5                	mov    %esp,%ebp
+  800d2a:	53                   	push   %ebx
+  800d2b:	83 ec 14             	sub    $0x14,%esp
+  800d2e:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  800d30:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  800d37:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800d3c:	ba 00 60 80 00       	mov    $0x806000,%edx
+  800d41:	e8 c8 fe ff ff       	call   800c0e <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  800d46:	6a 00                	push   $0x0
+  800d48:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800d4b:	50                   	push   %eax
+  800d4c:	53                   	push   %ebx
+  800d4d:	6a 00                	push   $0x0
+  800d4f:	e8 1f 1d 00 00       	call   802a73 <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  800d54:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d57:	c9                   	leave
+  800d58:	c3                   	ret
+
+00800d59 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  800d59:	55                   	push   %ebp
+  800d5a:	89 e5                	mov    %esp,%ebp
+  800d5c:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800d5f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d62:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d65:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.set_size.req_size = newsize;
+  800d6a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d6d:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  800d72:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d77:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d7c:	e8 a6 ff ff ff       	call   800d27 <fsipc>
+}
+  800d81:	c9                   	leave
+  800d82:	c3                   	ret
+
+00800d83 <devfile_flush>:
+{
+  800d83:	55                   	push   %ebp
+  800d84:	89 e5                	mov    %esp,%ebp
+  800d86:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800d89:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d8c:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d8f:	a3 00 60 80 00       	mov    %eax,0x806000
+  return fsipc(FSREQ_FLUSH, NULL);
+  800d94:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d99:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d9e:	e8 84 ff ff ff       	call   800d27 <fsipc>
+}
+  800da3:	c9                   	leave
+  800da4:	c3                   	ret
+
+00800da5 <devfile_stat>:
+{
+  800da5:	55                   	push   %ebp
+  800da6:	89 e5                	mov    %esp,%ebp
+  800da8:	53                   	push   %ebx
+  800da9:	83 ec 04             	sub    $0x4,%esp
+  800dac:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800daf:	8b 45 08             	mov    0x8(%ebp),%eax
+  800db2:	8b 40 0c             	mov    0xc(%eax),%eax
+  800db5:	a3 00 60 80 00       	mov    %eax,0x806000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  800dba:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dbf:	b8 05 00 00 00       	mov    $0x5,%eax
+  800dc4:	e8 5e ff ff ff       	call   800d27 <fsipc>
+  800dc9:	85 c0                	test   %eax,%eax
+  800dcb:	78 2c                	js     800df9 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800dcd:	83 ec 08             	sub    $0x8,%esp
+  800dd0:	68 00 60 80 00       	push   $0x806000
+  800dd5:	53                   	push   %ebx
+  800dd6:	e8 68 19 00 00       	call   802743 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  800ddb:	a1 80 60 80 00       	mov    0x806080,%eax
+  800de0:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800de6:	a1 84 60 80 00       	mov    0x806084,%eax
+  800deb:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  800df1:	83 c4 10             	add    $0x10,%esp
+  800df4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800df9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800dfc:	c9                   	leave
+  800dfd:	c3                   	ret
+
+00800dfe <fsv_alloc>:
+{
+  800dfe:	55                   	push   %ebp
+  800dff:	89 e5                	mov    %esp,%ebp
+  800e01:	56                   	push   %esi
+  800e02:	53                   	push   %ebx
+  800e03:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  800e05:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e0a:	eb 22                	jmp    800e2e <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  800e0c:	83 ec 04             	sub    $0x4,%esp
+  800e0f:	6a 00                	push   $0x0
+  800e11:	6a 00                	push   $0x0
+  800e13:	6a 07                	push   $0x7
+  800e15:	50                   	push   %eax
+  800e16:	6a 00                	push   $0x0
+  800e18:	6a 04                	push   $0x4
+  800e1a:	68 40 50 80 00       	push   $0x805040
+  800e1f:	e8 e9 f7 ff ff       	call   80060d <sysbatch_add>
+  800e24:	83 c4 20             	add    $0x20,%esp
+  800e27:	85 c0                	test   %eax,%eax
+  800e29:	78 48                	js     800e73 <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  800e2b:	83 c3 01             	add    $0x1,%ebx
+  800e2e:	39 f3                	cmp    %esi,%ebx
+  800e30:	74 31                	je     800e63 <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  800e32:	89 d8                	mov    %ebx,%eax
+  800e34:	c1 e0 0c             	shl    $0xc,%eax
+  800e37:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  800e3c:	89 c2                	mov    %eax,%edx
+  800e3e:	c1 ea 16             	shr    $0x16,%edx
+  800e41:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800e48:	f6 c2 01             	test   $0x1,%dl
+  800e4b:	74 bf                	je     800e0c <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  800e4d:	89 c2                	mov    %eax,%edx
+  800e4f:	c1 ea 0c             	shr    $0xc,%edx
+  800e52:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800e59:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  800e5c:	83 fa 03             	cmp    $0x3,%edx
+  800e5f:	75 ab                	jne    800e0c <fsv_alloc+0xe>
+  800e61:	eb c8                	jmp    800e2b <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  800e63:	83 ec 0c             	sub    $0xc,%esp
+  800e66:	68 40 50 80 00       	push   $0x805040
+  800e6b:	e8 4d f7 ff ff       	call   8005bd <sysbatch_flush>
+  800e70:	83 c4 10             	add    $0x10,%esp
+}
+  800e73:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e76:	5b                   	pop    %ebx
+  800e77:	5e                   	pop    %esi
+  800e78:	5d                   	pop    %ebp
+  800e79:	c3                   	ret
+
+00800e7a <devfile_read>:
+{
+  800e7a:	55                   	push   %ebp
+  800e7b:	89 e5                	mov    %esp,%ebp
+  800e7d:	57                   	push   %edi
+  800e7e:	56                   	push   %esi
+  800e7f:	53                   	push   %ebx
+  800e80:	83 ec 3c             	sub    $0x3c,%esp
+  800e83:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  800e86:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  800e8c:	77 57                	ja     800ee5 <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800e8e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e91:	8b 40 0c             	mov    0xc(%eax),%eax
+  800e94:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read.req_n = n;
+  800e99:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  800e9f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ea4:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ea9:	e8 79 fe ff ff       	call   800d27 <fsipc>
+  800eae:	89 c6                	mov    %eax,%esi
+  800eb0:	85 c0                	test   %eax,%eax
+  800eb2:	78 27                	js     800edb <devfile_read+0x61>
+  assert(r <= n);
+  800eb4:	39 c3                	cmp    %eax,%ebx
+  800eb6:	0f 82 0e 02 00 00    	jb     8010ca <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  800ebc:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800ec1:	0f 8f 1c 02 00 00    	jg     8010e3 <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  800ec7:	83 ec 04             	sub    $0x4,%esp
+  800eca:	50                   	push   %eax
+  800ecb:	68 00 60 80 00       	push   $0x806000
+  800ed0:	ff 75 0c             	push   0xc(%ebp)
+  800ed3:	e8 f1 19 00 00       	call   8028c9 <memmove>
+  return r;
+  800ed8:	83 c4 10             	add    $0x10,%esp
+}
+  800edb:	89 f0                	mov    %esi,%eax
+  800edd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ee0:	5b                   	pop    %ebx
+  800ee1:	5e                   	pop    %esi
+  800ee2:	5f                   	pop    %edi
+  800ee3:	5d                   	pop    %ebp
+  800ee4:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  800ee5:	b8 01 00 00 00       	mov    $0x1,%eax
+  800eea:	e8 0f ff ff ff       	call   800dfe <fsv_alloc>
+  800eef:	89 c6                	mov    %eax,%esi
+  800ef1:	85 c0                	test   %eax,%eax
+  800ef3:	78 e6                	js     800edb <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  800ef5:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ef8:	8b 40 0c             	mov    0xc(%eax),%eax
+  800efb:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  800f00:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f03:	8b 40 04             	mov    0x4(%eax),%eax
+  800f06:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  800f0b:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  800f11:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  800f18:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800f1d:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  800f22:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f27:	e8 e2 fc ff ff       	call   800c0e <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  800f2c:	6a 00                	push   $0x0
+  800f2e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800f31:	50                   	push   %eax
+  800f32:	68 00 10 c0 9f       	push   $0x9fc01000
+  800f37:	6a 00                	push   $0x0
+  800f39:	e8 35 1b 00 00       	call   802a73 <ipc_recv_pages>
+  800f3e:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  800f40:	83 c4 10             	add    $0x10,%esp
+  800f43:	85 c0                	test   %eax,%eax
+  800f45:	7e 94                	jle    800edb <devfile_read+0x61>
+  assert(r <= n);
+  800f47:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800f4a:	39 c3                	cmp    %eax,%ebx
+  800f4c:	72 2e                	jb     800f7c <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  800f4e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f51:	8b 40 04             	mov    0x4(%eax),%eax
+  800f54:	25 ff 0f 00 00       	and    $0xfff,%eax
+  800f59:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  800f5c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800f5f:	c1 e2 0c             	shl    $0xc,%edx
+  800f62:	39 ca                	cmp    %ecx,%edx
+  800f64:	72 2f                	jb     800f95 <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  800f66:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  800f6b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  800f6e:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  800f72:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  800f77:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  800f7a:	eb 52                	jmp    800fce <devfile_read+0x154>
+  assert(r <= n);
+  800f7c:	68 45 2f 80 00       	push   $0x802f45
+  800f81:	68 4c 2f 80 00       	push   $0x802f4c
+  800f86:	68 49 01 00 00       	push   $0x149
+  800f8b:	68 3a 2f 80 00       	push   $0x802f3a
+  800f90:	e8 e5 10 00 00       	call   80207a <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  800f95:	68 70 2f 80 00       	push   $0x802f70
+  800f9a:	68 4c 2f 80 00       	push   $0x802f4c
+  800f9f:	68 4a 01 00 00       	push   $0x14a
+  800fa4:	68 3a 2f 80 00       	push   $0x802f3a
+  800fa9:	e8 cc 10 00 00       	call   80207a <_panic>
+      memmove(dst + done, src + done, m);
+  800fae:	83 ec 04             	sub    $0x4,%esp
+  800fb1:	53                   	push   %ebx
+  800fb2:	56                   	push   %esi
+  800fb3:	89 f8                	mov    %edi,%eax
+  800fb5:	03 45 0c             	add    0xc(%ebp),%eax
+  800fb8:	50                   	push   %eax
+  800fb9:	e8 0b 19 00 00       	call   8028c9 <memmove>
+  800fbe:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  800fc1:	01 df                	add    %ebx,%edi
+  800fc3:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800fc6:	39 c7                	cmp    %eax,%edi
+  800fc8:	0f 83 c0 00 00 00    	jae    80108e <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  800fce:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800fd1:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  800fd4:	89 f0                	mov    %esi,%eax
+  800fd6:	25 ff 0f 00 00       	and    $0xfff,%eax
+  800fdb:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  800fe0:	29 c3                	sub    %eax,%ebx
+  800fe2:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800fe5:	29 f8                	sub    %edi,%eax
+  800fe7:	39 c3                	cmp    %eax,%ebx
+  800fe9:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  800fec:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  800ff2:	75 ba                	jne    800fae <devfile_read+0x134>
+  800ff4:	89 f9                	mov    %edi,%ecx
+  800ff6:	03 4d 0c             	add    0xc(%ebp),%ecx
+  800ff9:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  800ffc:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  801002:	75 aa                	jne    800fae <devfile_read+0x134>
+  801004:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  80100a:	77 a2                	ja     800fae <devfile_read+0x134>
+  80100c:	89 c8                	mov    %ecx,%eax
+  80100e:	c1 e8 16             	shr    $0x16,%eax
+  801011:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801018:	a8 01                	test   $0x1,%al
+  80101a:	74 92                	je     800fae <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  80101c:	89 c8                	mov    %ecx,%eax
+  80101e:	c1 e8 0c             	shr    $0xc,%eax
+  801021:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  801028:	a8 01                	test   $0x1,%al
+  80102a:	74 82                	je     800fae <devfile_read+0x134>
+  80102c:	a9 02 08 00 00       	test   $0x802,%eax
+  801031:	0f 84 77 ff ff ff    	je     800fae <devfile_read+0x134>
+  801037:	f6 c4 04             	test   $0x4,%ah
+  80103a:	0f 85 6e ff ff ff    	jne    800fae <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  801040:	a1 44 57 80 00       	mov    0x805744,%eax
+  801045:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  801049:	84 c0                	test   %al,%al
+  80104b:	75 17                	jne    801064 <devfile_read+0x1ea>
+  80104d:	83 ec 08             	sub    $0x8,%esp
+  801050:	6a 01                	push   $0x1
+  801052:	6a 00                	push   $0x0
+  801054:	e8 1e f1 ff ff       	call   800177 <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  801059:	83 c4 10             	add    $0x10,%esp
+  80105c:	85 c0                	test   %eax,%eax
+  80105e:	0f 85 4a ff ff ff    	jne    800fae <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  801064:	83 ec 04             	sub    $0x4,%esp
+  801067:	68 05 08 00 00       	push   $0x805
+  80106c:	ff 75 cc             	push   -0x34(%ebp)
+  80106f:	6a 00                	push   $0x0
+  801071:	56                   	push   %esi
+  801072:	6a 00                	push   $0x0
+  801074:	6a 05                	push   $0x5
+  801076:	68 40 50 80 00       	push   $0x805040
+  80107b:	e8 8d f5 ff ff       	call   80060d <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  801080:	c1 e8 1f             	shr    $0x1f,%eax
+  801083:	08 45 cb             	or     %al,-0x35(%ebp)
+  801086:	83 c4 20             	add    $0x20,%esp
+  801089:	e9 33 ff ff ff       	jmp    800fc1 <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  80108e:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  801091:	83 ec 0c             	sub    $0xc,%esp
+  801094:	68 40 50 80 00       	push   $0x805040
+  801099:	e8 1f f5 ff ff       	call   8005bd <sysbatch_flush>
+  80109e:	83 c4 10             	add    $0x10,%esp
+  8010a1:	85 c0                	test   %eax,%eax
+  8010a3:	78 06                	js     8010ab <devfile_read+0x231>
+  8010a5:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  8010a9:	74 14                	je     8010bf <devfile_read+0x245>
+    memmove(dst, src, r);
+  8010ab:	83 ec 04             	sub    $0x4,%esp
+  8010ae:	ff 75 d4             	push   -0x2c(%ebp)
+  8010b1:	ff 75 d0             	push   -0x30(%ebp)
+  8010b4:	ff 75 0c             	push   0xc(%ebp)
+  8010b7:	e8 0d 18 00 00       	call   8028c9 <memmove>
+  8010bc:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  8010bf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010c2:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  8010c5:	e9 11 fe ff ff       	jmp    800edb <devfile_read+0x61>
+  assert(r <= n);
+  8010ca:	68 45 2f 80 00       	push   $0x802f45
+  8010cf:	68 4c 2f 80 00       	push   $0x802f4c
+  8010d4:	68 1c 01 00 00       	push   $0x11c
+  8010d9:	68 3a 2f 80 00       	push   $0x802f3a
+  8010de:	e8 97 0f 00 00       	call   80207a <_panic>
+  assert(r <= PGSIZE);
+  8010e3:	68 61 2f 80 00       	push   $0x802f61
+  8010e8:	68 4c 2f 80 00       	push   $0x802f4c
+  8010ed:	68 1d 01 00 00       	push   $0x11d
+  8010f2:	68 3a 2f 80 00       	push   $0x802f3a
+  8010f7:	e8 7e 0f 00 00       	call   80207a <_panic>
+
+008010fc <devfile_write>:
+{
+  8010fc:	55                   	push   %ebp
+  8010fd:	89 e5                	mov    %esp,%ebp
+  8010ff:	57                   	push   %edi
+  801100:	56                   	push   %esi
+  801101:	53                   	push   %ebx
+  801102:	83 ec 1c             	sub    $0x1c,%esp
+  801105:	8b 75 08             	mov    0x8(%ebp),%esi
+  801108:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  80110b:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  801110:	77 39                	ja     80114b <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801112:	8b 56 0c             	mov    0xc(%esi),%edx
+  801115:	89 15 00 60 80 00    	mov    %edx,0x806000
+  fsipcbuf.write.req_n = n;
+  80111b:	a3 04 60 80 00       	mov    %eax,0x806004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  801120:	83 ec 04             	sub    $0x4,%esp
+  801123:	50                   	push   %eax
+  801124:	ff 75 0c             	push   0xc(%ebp)
+  801127:	68 08 60 80 00       	push   $0x806008
+  80112c:	e8 98 17 00 00       	call   8028c9 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801131:	ba 00 00 00 00       	mov    $0x0,%edx
+  801136:	b8 04 00 00 00       	mov    $0x4,%eax
+  80113b:	e8 e7 fb ff ff       	call   800d27 <fsipc>
+  801140:	83 c4 10             	add    $0x10,%esp
+}
+  801143:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801146:	5b                   	pop    %ebx
+  801147:	5e                   	pop    %esi
+  801148:	5f                   	pop    %edi
+  801149:	5d                   	pop    %ebp
+  80114a:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  80114b:	ba 00 00 10 00       	mov    $0x100000,%edx
+  801150:	39 d0                	cmp    %edx,%eax
+  801152:	89 d3                	mov    %edx,%ebx
+  801154:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  801157:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  80115d:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  801160:	83 c7 01             	add    $0x1,%edi
+  801163:	89 f8                	mov    %edi,%eax
+  801165:	e8 94 fc ff ff       	call   800dfe <fsv_alloc>
+  80116a:	85 c0                	test   %eax,%eax
+  80116c:	78 d5                	js     801143 <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  80116e:	83 ec 04             	sub    $0x4,%esp
+  801171:	53                   	push   %ebx
+  801172:	ff 75 0c             	push   0xc(%ebp)
+  801175:	68 00 10 c0 9f       	push   $0x9fc01000
+  80117a:	e8 4a 17 00 00       	call   8028c9 <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  80117f:	8b 46 0c             	mov    0xc(%esi),%eax
+  801182:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  801187:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  80118d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801194:	89 f9                	mov    %edi,%ecx
+  801196:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  80119b:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011a0:	e8 69 fa ff ff       	call   800c0e <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  8011a5:	6a 00                	push   $0x0
+  8011a7:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8011aa:	50                   	push   %eax
+  8011ab:	6a 00                	push   $0x0
+  8011ad:	6a 00                	push   $0x0
+  8011af:	e8 bf 18 00 00       	call   802a73 <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  8011b4:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  8011b7:	eb 8a                	jmp    801143 <devfile_write+0x47>
+
+008011b9 <open>:
+{
+  8011b9:	55                   	push   %ebp
+  8011ba:	89 e5                	mov    %esp,%ebp
+  8011bc:	56                   	push   %esi
+  8011bd:	53                   	push   %ebx
+  8011be:	83 ec 1c             	sub    $0x1c,%esp
+  8011c1:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  8011c4:	56                   	push   %esi
+  8011c5:	e8 3e 15 00 00       	call   802708 <strlen>
+  8011ca:	83 c4 10             	add    $0x10,%esp
+  8011cd:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8011d2:	7f 6c                	jg     801240 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  8011d4:	83 ec 0c             	sub    $0xc,%esp
+  8011d7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8011da:	50                   	push   %eax
+  8011db:	e8 ad f4 ff ff       	call   80068d <fd_alloc>
+  8011e0:	89 c3                	mov    %eax,%ebx
+  8011e2:	83 c4 10             	add    $0x10,%esp
+  8011e5:	85 c0                	test   %eax,%eax
+  8011e7:	78 3c                	js     801225 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  8011e9:	83 ec 08             	sub    $0x8,%esp
+  8011ec:	56                   	push   %esi
+  8011ed:	68 00 60 80 00       	push   $0x806000
+  8011f2:	e8 4c 15 00 00       	call   802743 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  8011f7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8011fa:	a3 00 64 80 00       	mov    %eax,0x806400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8011ff:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801202:	b8 01 00 00 00       	mov    $0x1,%eax
+  801207:	e8 1b fb ff ff       	call   800d27 <fsipc>
+  80120c:	89 c3                	mov    %eax,%ebx
+  80120e:	83 c4 10             	add    $0x10,%esp
+  801211:	85 c0                	test   %eax,%eax
+  801213:	78 19                	js     80122e <open+0x75>
+  return fd2num(fd);
+  801215:	83 ec 0c             	sub    $0xc,%esp
+  801218:	ff 75 f4             	push   -0xc(%ebp)
+  80121b:	e8 49 f4 ff ff       	call   800669 <fd2num>
+  801220:	89 c3                	mov    %eax,%ebx
+  801222:	83 c4 10             	add    $0x10,%esp
+}
+  801225:	89 d8                	mov    %ebx,%eax
+  801227:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80122a:	5b                   	pop    %ebx
+  80122b:	5e                   	pop    %esi
+  80122c:	5d                   	pop    %ebp
+  80122d:	c3                   	ret
+    fd_close(fd, 0);
+  80122e:	83 ec 08             	sub    $0x8,%esp
+  801231:	6a 00                	push   $0x0
+  801233:	ff 75 f4             	push   -0xc(%ebp)
+  801236:	e8 44 f5 ff ff       	call   80077f <fd_close>
+    return r;
+  80123b:	83 c4 10             	add    $0x10,%esp
+  80123e:	eb e5                	jmp    801225 <open+0x6c>
+    return -E_BAD_PATH;
+  801240:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801245:	eb de                	jmp    801225 <open+0x6c>
+
+00801247 <open_read>:
+{
+  801247:	55                   	push   %ebp
+  801248:	89 e5                	mov    %esp,%ebp
+  80124a:	57                   	push   %edi
+  80124b:	56                   	push   %esi
+  80124c:	53                   	push   %ebx
+  80124d:	83 ec 28             	sub    $0x28,%esp
+  801250:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  801253:	57                   	push   %edi
+  801254:	e8 af 14 00 00       	call   802708 <strlen>
+  801259:	83 c4 10             	add    $0x10,%esp
+  80125c:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801261:	0f 87 f6 00 00 00    	ja     80135d <open_read+0x116>
+  801267:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  801269:	83 ec 0c             	sub    $0xc,%esp
+  80126c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80126f:	50                   	push   %eax
+  801270:	e8 18 f4 ff ff       	call   80068d <fd_alloc>
+  801275:	89 c3                	mov    %eax,%ebx
+  801277:	83 c4 10             	add    $0x10,%esp
+  80127a:	85 c0                	test   %eax,%eax
+  80127c:	0f 88 b2 00 00 00    	js     801334 <open_read+0xed>
+  strcpy(req->req_buf, path);
+  801282:	83 ec 08             	sub    $0x8,%esp
+  801285:	57                   	push   %edi
+  801286:	68 e4 60 80 00       	push   $0x8060e4
+  80128b:	e8 b3 14 00 00       	call   802743 <strcpy>
+  req->req_nops = 2;
+  801290:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  801297:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  80129a:	c7 05 04 60 80 00 01 	movl   $0x1,0x806004
+  8012a1:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  8012a4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8012a7:	a3 10 60 80 00       	mov    %eax,0x806010
+  req->req_ops[0].op_buf = 0;
+  8012ac:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  8012b3:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  8012b6:	c7 05 20 60 80 00 04 	movl   $0x4,0x806020
+  8012bd:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  8012c0:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  8012c7:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  8012ca:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  8012cf:	29 f0                	sub    %esi,%eax
+  8012d1:	3b 45 14             	cmp    0x14(%ebp),%eax
+  8012d4:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  8012d8:	a3 2c 60 80 00       	mov    %eax,0x80602c
+  req->req_ops[1].op_offset = 0;
+  8012dd:	c7 05 30 60 80 00 00 	movl   $0x0,0x806030
+  8012e4:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  8012e7:	83 c6 01             	add    $0x1,%esi
+  8012ea:	89 35 34 60 80 00    	mov    %esi,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  8012f0:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8012f3:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8012f8:	e8 2a fa ff ff       	call   800d27 <fsipc>
+  8012fd:	89 c3                	mov    %eax,%ebx
+  8012ff:	83 c4 10             	add    $0x10,%esp
+  801302:	83 f8 01             	cmp    $0x1,%eax
+  801305:	7e 37                	jle    80133e <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  801307:	a1 38 60 80 00       	mov    0x806038,%eax
+  80130c:	8b 55 18             	mov    0x18(%ebp),%edx
+  80130f:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  801311:	83 ec 04             	sub    $0x4,%esp
+  801314:	50                   	push   %eax
+  801315:	81 c6 e4 60 80 00    	add    $0x8060e4,%esi
+  80131b:	56                   	push   %esi
+  80131c:	ff 75 10             	push   0x10(%ebp)
+  80131f:	e8 a5 15 00 00       	call   8028c9 <memmove>
+  return fd2num(fd);
+  801324:	83 c4 04             	add    $0x4,%esp
+  801327:	ff 75 e4             	push   -0x1c(%ebp)
+  80132a:	e8 3a f3 ff ff       	call   800669 <fd2num>
+  80132f:	89 c3                	mov    %eax,%ebx
+  801331:	83 c4 10             	add    $0x10,%esp
+}
+  801334:	89 d8                	mov    %ebx,%eax
+  801336:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801339:	5b                   	pop    %ebx
+  80133a:	5e                   	pop    %esi
+  80133b:	5f                   	pop    %edi
+  80133c:	5d                   	pop    %ebp
+  80133d:	c3                   	ret
+    fd_close(fd, 0);
+  80133e:	83 ec 08             	sub    $0x8,%esp
+  801341:	6a 00                	push   $0x0
+  801343:	ff 75 e4             	push   -0x1c(%ebp)
+  801346:	e8 34 f4 ff ff       	call   80077f <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  80134b:	83 c4 10             	add    $0x10,%esp
+  80134e:	85 db                	test   %ebx,%ebx
+  801350:	78 e2                	js     801334 <open_read+0xed>
+  801352:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  801355:	8b 9b 1c 60 80 00    	mov    0x80601c(%ebx),%ebx
+  80135b:	eb d7                	jmp    801334 <open_read+0xed>
+    return -E_BAD_PATH;
+  80135d:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801362:	eb d0                	jmp    801334 <open_read+0xed>
+
+00801364 <file_stat>:
+{
+  801364:	55                   	push   %ebp
+  801365:	89 e5                	mov    %esp,%ebp
+  801367:	57                   	push   %edi
+  801368:	56                   	push   %esi
+  801369:	53                   	push   %ebx
+  80136a:	83 ec 18             	sub    $0x18,%esp
+  80136d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801370:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801373:	57                   	push   %edi
+  801374:	e8 8f 13 00 00       	call   802708 <strlen>
+  801379:	83 c4 10             	add    $0x10,%esp
+  80137c:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801381:	0f 8f c7 00 00 00    	jg     80144e <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  801387:	83 ec 0c             	sub    $0xc,%esp
+  80138a:	57                   	push   %edi
+  80138b:	e8 78 13 00 00       	call   802708 <strlen>
+  801390:	8d 58 04             	lea    0x4(%eax),%ebx
+  801393:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  801396:	83 c4 08             	add    $0x8,%esp
+  801399:	57                   	push   %edi
+  80139a:	68 e4 60 80 00       	push   $0x8060e4
+  80139f:	e8 9f 13 00 00       	call   802743 <strcpy>
+  req->req_nops = 2;
+  8013a4:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  8013ab:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  8013ae:	c7 05 04 60 80 00 02 	movl   $0x2,0x806004
+  8013b5:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  8013b8:	c7 05 10 60 80 00 00 	movl   $0x0,0x806010
+  8013bf:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  8013c2:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  8013c9:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  8013cc:	c7 05 20 60 80 00 03 	movl   $0x3,0x806020
+  8013d3:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  8013d6:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  8013dd:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  8013e0:	89 1d 34 60 80 00    	mov    %ebx,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  8013e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013eb:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8013f0:	e8 32 f9 ff ff       	call   800d27 <fsipc>
+  8013f5:	83 c4 10             	add    $0x10,%esp
+  8013f8:	83 f8 01             	cmp    $0x1,%eax
+  8013fb:	7e 42                	jle    80143f <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  8013fd:	81 c3 e4 60 80 00    	add    $0x8060e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  801403:	83 ec 08             	sub    $0x8,%esp
+  801406:	53                   	push   %ebx
+  801407:	56                   	push   %esi
+  801408:	e8 36 13 00 00       	call   802743 <strcpy>
+  st->st_size = ret->ret_size;
+  80140d:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  801413:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  801419:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  80141f:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  801425:	c7 86 88 00 00 00 08 	movl   $0x804008,0x88(%esi)
+  80142c:	40 80 00 
+  return 0;
+  80142f:	83 c4 10             	add    $0x10,%esp
+  801432:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801437:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80143a:	5b                   	pop    %ebx
+  80143b:	5e                   	pop    %esi
+  80143c:	5f                   	pop    %edi
+  80143d:	5d                   	pop    %ebp
+  80143e:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  80143f:	85 c0                	test   %eax,%eax
+  801441:	78 f4                	js     801437 <file_stat+0xd3>
+  801443:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801446:	8b 80 1c 60 80 00    	mov    0x80601c(%eax),%eax
+  80144c:	eb e9                	jmp    801437 <file_stat+0xd3>
+    return -E_BAD_PATH;
+  80144e:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801453:	eb e2                	jmp    801437 <file_stat+0xd3>
+
+00801455 <read_map>:
+{
+  801455:	55                   	push   %ebp
+  801456:	89 e5                	mov    %esp,%ebp
+  801458:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80145b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80145e:	50                   	push   %eax
+  80145f:	ff 75 08             	push   0x8(%ebp)
+  801462:	e8 7c f2 ff ff       	call   8006e3 <fd_lookup>
+  801467:	83 c4 10             	add    $0x10,%esp
+  80146a:	85 c0                	test   %eax,%eax
+  80146c:	78 2a                	js     801498 <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  80146e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801471:	8b 0d 08 40 80 00    	mov    0x804008,%ecx
+  801477:	39 08                	cmp    %ecx,(%eax)
+  801479:	75 1f                	jne    80149a <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  80147b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80147e:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read_map.req_offset = offset;
+  801483:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801486:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  80148b:	8b 55 10             	mov    0x10(%ebp),%edx
+  80148e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801493:	e8 8f f8 ff ff       	call   800d27 <fsipc>
+}
+  801498:	c9                   	leave
+  801499:	c3                   	ret
+    return -E_INVAL;
+  80149a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80149f:	eb f7                	jmp    801498 <read_map+0x43>
+
+008014a1 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8014a1:	55                   	push   %ebp
+  8014a2:	89 e5                	mov    %esp,%ebp
+  8014a4:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  8014a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014ac:	b8 08 00 00 00       	mov    $0x8,%eax
+  8014b1:	e8 71 f8 ff ff       	call   800d27 <fsipc>
+}
+  8014b6:	c9                   	leave
+  8014b7:	c3                   	ret
+
+008014b8 <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  8014b8:	55                   	push   %ebp
+  8014b9:	89 e5                	mov    %esp,%ebp
+  8014bb:	57                   	push   %edi
+  8014bc:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  8014bd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014c0:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.stats.req_bio_sched = 0;
+  8014c5:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  8014cc:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  8014cf:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  8014d6:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  8014d9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014de:	b8 09 00 00 00       	mov    $0x9,%eax
+  8014e3:	e8 3f f8 ff ff       	call   800d27 <fsipc>
+  8014e8:	85 c0                	test   %eax,%eax
+  8014ea:	78 14                	js     801500 <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  8014ec:	be 00 60 80 00       	mov    $0x806000,%esi
+  8014f1:	b9 16 00 00 00       	mov    $0x16,%ecx
+  8014f6:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8014f9:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  8014fb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801500:	5e                   	pop    %esi
+  801501:	5f                   	pop    %edi
+  801502:	5d                   	pop    %ebp
+  801503:	c3                   	ret
+
+00801504 <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  801504:	55                   	push   %ebp
+  801505:	89 e5                	mov    %esp,%ebp
+  801507:	53                   	push   %ebx
+  801508:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  80150b:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  80150e:	50                   	push   %eax
+  80150f:	6a 00                	push   $0x0
+  801511:	e8 a2 ff ff ff       	call   8014b8 <fs_stats>
+  801516:	83 c4 10             	add    $0x10,%esp
+  801519:	85 c0                	test   %eax,%eax
+  80151b:	78 28                	js     801545 <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  80151d:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  801520:	83 ec 08             	sub    $0x8,%esp
+  801523:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801526:	50                   	push   %eax
+  801527:	6a 20                	push   $0x20
+  801529:	e8 8a ff ff ff       	call   8014b8 <fs_stats>
+  80152e:	83 c4 10             	add    $0x10,%esp
+  801531:	85 c0                	test   %eax,%eax
+  801533:	78 10                	js     801545 <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  801535:	83 ec 08             	sub    $0x8,%esp
+  801538:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  80153b:	50                   	push   %eax
+  80153c:	53                   	push   %ebx
+  80153d:	e8 76 ff ff ff       	call   8014b8 <fs_stats>
+  801542:	83 c4 10             	add    $0x10,%esp
+}
+  801545:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801548:	c9                   	leave
+  801549:	c3                   	ret
+
+0080154a <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  80154a:	55                   	push   %ebp
+  80154b:	89 e5                	mov    %esp,%ebp
+  80154d:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  801550:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  801557:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  80155a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80155d:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.stats.req_dcache = 0;
+  801562:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  801569:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  80156c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801571:	b8 09 00 00 00       	mov    $0x9,%eax
+  801576:	e8 ac f7 ff ff       	call   800d27 <fsipc>
+}
+  80157b:	c9                   	leave
+  80157c:	c3                   	ret
+
+0080157d <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  80157d:	55                   	push   %ebp
+  80157e:	89 e5                	mov    %esp,%ebp
+  801580:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  801583:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  80158a:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  80158d:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  801594:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  801597:	8b 45 08             	mov    0x8(%ebp),%eax
+  80159a:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_STATS, NULL);
+  80159f:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015a4:	b8 09 00 00 00       	mov    $0x9,%eax
+  8015a9:	e8 79 f7 ff ff       	call   800d27 <fsipc>
+}
+  8015ae:	c9                   	leave
+  8015af:	c3                   	ret
+
+008015b0 <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  8015b0:	55                   	push   %ebp
+  8015b1:	89 e5                	mov    %esp,%ebp
+  8015b3:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8015b6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015b9:	50                   	push   %eax
+  8015ba:	ff 75 08             	push   0x8(%ebp)
+  8015bd:	e8 21 f1 ff ff       	call   8006e3 <fd_lookup>
+  8015c2:	83 c4 10             	add    $0x10,%esp
+  8015c5:	85 c0                	test   %eax,%eax
+  8015c7:	78 34                	js     8015fd <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  8015c9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015cc:	8b 0d 08 40 80 00    	mov    0x804008,%ecx
+  8015d2:	39 08                	cmp    %ecx,(%eax)
+  8015d4:	75 29                	jne    8015ff <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  8015d6:	8b 40 0c             	mov    0xc(%eax),%eax
+  8015d9:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.fallocate.req_offset = offset;
+  8015de:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8015e1:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.fallocate.req_len = len;
+  8015e6:	8b 45 10             	mov    0x10(%ebp),%eax
+  8015e9:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  8015ee:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015f3:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8015f8:	e8 2a f7 ff ff       	call   800d27 <fsipc>
+}
+  8015fd:	c9                   	leave
+  8015fe:	c3                   	ret
+    return -E_INVAL;
+  8015ff:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801604:	eb f7                	jmp    8015fd <fallocate+0x4d>
+
+00801606 <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  801606:	55                   	push   %ebp
+  801607:	89 e5                	mov    %esp,%ebp
+  801609:	57                   	push   %edi
+  80160a:	56                   	push   %esi
+  80160b:	53                   	push   %ebx
+  80160c:	83 ec 24             	sub    $0x24,%esp
+  80160f:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801612:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801615:	50                   	push   %eax
+  801616:	ff 75 08             	push   0x8(%ebp)
+  801619:	e8 c5 f0 ff ff       	call   8006e3 <fd_lookup>
+  80161e:	83 c4 10             	add    $0x10,%esp
+  801621:	85 c0                	test   %eax,%eax
+  801623:	78 66                	js     80168b <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  801625:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801628:	8b 0d 08 40 80 00    	mov    0x804008,%ecx
+  80162e:	39 08                	cmp    %ecx,(%eax)
+  801630:	75 61                	jne    801693 <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  801632:	85 f6                	test   %esi,%esi
+  801634:	7e 50                	jle    801686 <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  801636:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  80163b:	39 de                	cmp    %ebx,%esi
+  80163d:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  801640:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801643:	8b 40 0c             	mov    0xc(%eax),%eax
+  801646:	a3 00 60 80 00       	mov    %eax,0x806000
+    fsipcbuf.prefetch.req_n = m;
+  80164b:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  801651:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  801658:	83 ec 04             	sub    $0x4,%esp
+  80165b:	57                   	push   %edi
+  80165c:	ff 75 0c             	push   0xc(%ebp)
+  80165f:	68 08 60 80 00       	push   $0x806008
+  801664:	e8 60 12 00 00       	call   8028c9 <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  801669:	ba 00 00 00 00       	mov    $0x0,%edx
+  80166e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801673:	e8 af f6 ff ff       	call   800d27 <fsipc>
+  801678:	83 c4 10             	add    $0x10,%esp
+  80167b:	85 c0                	test   %eax,%eax
+  80167d:	78 0c                	js     80168b <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  80167f:	01 7d 0c             	add    %edi,0xc(%ebp)
+  801682:	29 de                	sub    %ebx,%esi
+  801684:	eb ac                	jmp    801632 <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  801686:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80168b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80168e:	5b                   	pop    %ebx
+  80168f:	5e                   	pop    %esi
+  801690:	5f                   	pop    %edi
+  801691:	5d                   	pop    %ebp
+  801692:	c3                   	ret
+    return -E_INVAL;
+  801693:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801698:	eb f1                	jmp    80168b <prefetch+0x85>
+
+0080169a <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  80169a:	55                   	push   %ebp
+  80169b:	89 e5                	mov    %esp,%ebp
+  80169d:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  8016a0:	50                   	push   %eax
+  8016a1:	e8 d3 ef ff ff       	call   800679 <fd2data>
+  8016a6:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  8016ab:	c9                   	leave
+  8016ac:	c3                   	ret
+
+008016ad <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8016ad:	55                   	push   %ebp
+  8016ae:	89 e5                	mov    %esp,%ebp
+  8016b0:	56                   	push   %esi
+  8016b1:	53                   	push   %ebx
+  8016b2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  8016b5:	83 ec 0c             	sub    $0xc,%esp
+  8016b8:	ff 75 08             	push   0x8(%ebp)
+  8016bb:	e8 b9 ef ff ff       	call   800679 <fd2data>
+  8016c0:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  8016c2:	83 c4 08             	add    $0x8,%esp
+  8016c5:	68 9c 2f 80 00       	push   $0x802f9c
+  8016ca:	53                   	push   %ebx
+  8016cb:	e8 73 10 00 00       	call   802743 <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  8016d0:	8b 46 04             	mov    0x4(%esi),%eax
+  8016d3:	2b 06                	sub    (%esi),%eax
+  8016d5:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  8016db:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8016e2:	00 00 00 
+  stat->st_dev = &devpipe;
+  8016e5:	c7 83 88 00 00 00 24 	movl   $0x804024,0x88(%ebx)
+  8016ec:	40 80 00 
+  return 0;
+}
+  8016ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016f4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016f7:	5b                   	pop    %ebx
+  8016f8:	5e                   	pop    %esi
+  8016f9:	5d                   	pop    %ebp
+  8016fa:	c3                   	ret
+
+008016fb <pipe_wakeup>:
+{
+  8016fb:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  8016fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801702:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  801705:	85 c0                	test   %eax,%eax
+  801707:	75 01                	jne    80170a <pipe_wakeup+0xf>
+  801709:	c3                   	ret
+{
+  80170a:	55                   	push   %ebp
+  80170b:	89 e5                	mov    %esp,%ebp
+  80170d:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  801710:	6a 00                	push   $0x0
+  801712:	68 00 00 c0 ee       	push   $0xeec00000
+  801717:	52                   	push   %edx
+  801718:	e8 f9 ed ff ff       	call   800516 <sys_chan_wakeup>
+  80171d:	83 c4 10             	add    $0x10,%esp
+}
+  801720:	c9                   	leave
+  801721:	c3                   	ret
+
+00801722 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801722:	55                   	push   %ebp
+  801723:	89 e5                	mov    %esp,%ebp
+  801725:	57                   	push   %edi
+  801726:	56                   	push   %esi
+  801727:	53                   	push   %ebx
+  801728:	83 ec 18             	sub    $0x18,%esp
+  80172b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  80172e:	57                   	push   %edi
+  80172f:	e8 45 ef ff ff       	call   800679 <fd2data>
+  801734:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  801736:	83 c4 10             	add    $0x10,%esp
+  801739:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  80173d:	74 2a                	je     801769 <devpipe_close+0x47>
+  80173f:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  801744:	89 f8                	mov    %edi,%eax
+  801746:	e8 4f ff ff ff       	call   80169a <pipe_ring>
+  80174b:	83 ec 08             	sub    $0x8,%esp
+  80174e:	01 d8                	add    %ebx,%eax
+  801750:	50                   	push   %eax
+  801751:	6a 00                	push   $0x0
+  801753:	e8 e7 ea ff ff       	call   80023f <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  801758:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80175e:	83 c4 10             	add    $0x10,%esp
+  801761:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  801767:	75 db                	jne    801744 <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  801769:	83 ec 08             	sub    $0x8,%esp
+  80176c:	57                   	push   %edi
+  80176d:	6a 00                	push   $0x0
+  80176f:	e8 cb ea ff ff       	call   80023f <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  801774:	83 c4 10             	add    $0x10,%esp
+  801777:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  80177b:	75 13                	jne    801790 <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  80177d:	83 ec 08             	sub    $0x8,%esp
+  801780:	56                   	push   %esi
+  801781:	6a 00                	push   $0x0
+  801783:	e8 b7 ea ff ff       	call   80023f <sys_page_unmap>
+}
+  801788:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80178b:	5b                   	pop    %ebx
+  80178c:	5e                   	pop    %esi
+  80178d:	5f                   	pop    %edi
+  80178e:	5d                   	pop    %ebp
+  80178f:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  801790:	8d 56 04             	lea    0x4(%esi),%edx
+  801793:	8d 46 2c             	lea    0x2c(%esi),%eax
+  801796:	e8 60 ff ff ff       	call   8016fb <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  80179b:	8d 46 30             	lea    0x30(%esi),%eax
+  80179e:	89 f2                	mov    %esi,%edx
+  8017a0:	e8 56 ff ff ff       	call   8016fb <pipe_wakeup>
+  8017a5:	eb d6                	jmp    80177d <devpipe_close+0x5b>
+
+008017a7 <_pipeisclosed>:
+{
+  8017a7:	55                   	push   %ebp
+  8017a8:	89 e5                	mov    %esp,%ebp
+  8017aa:	57                   	push   %edi
+  8017ab:	56                   	push   %esi
+  8017ac:	53                   	push   %ebx
+  8017ad:	83 ec 1c             	sub    $0x1c,%esp
+  8017b0:	89 c7                	mov    %eax,%edi
+  8017b2:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  8017b4:	a1 44 57 80 00       	mov    0x805744,%eax
+  8017b9:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  8017bc:	83 ec 0c             	sub    $0xc,%esp
+  8017bf:	57                   	push   %edi
+  8017c0:	e8 11 14 00 00       	call   802bd6 <pageref>
+  8017c5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8017c8:	89 34 24             	mov    %esi,(%esp)
+  8017cb:	e8 06 14 00 00       	call   802bd6 <pageref>
+    nn = thisenv->env_runs;
+  8017d0:	8b 15 44 57 80 00    	mov    0x805744,%edx
+  8017d6:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  8017d9:	83 c4 10             	add    $0x10,%esp
+  8017dc:	39 cb                	cmp    %ecx,%ebx
+  8017de:	74 1b                	je     8017fb <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  8017e0:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8017e3:	75 cf                	jne    8017b4 <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8017e5:	8b 42 58             	mov    0x58(%edx),%eax
+  8017e8:	6a 01                	push   $0x1
+  8017ea:	50                   	push   %eax
+  8017eb:	53                   	push   %ebx
+  8017ec:	68 a3 2f 80 00       	push   $0x802fa3
+  8017f1:	e8 5f 09 00 00       	call   802155 <cprintf>
+  8017f6:	83 c4 10             	add    $0x10,%esp
+  8017f9:	eb b9                	jmp    8017b4 <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  8017fb:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8017fe:	0f 94 c0             	sete   %al
+  801801:	0f b6 c0             	movzbl %al,%eax
+}
+  801804:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801807:	5b                   	pop    %ebx
+  801808:	5e                   	pop    %esi
+  801809:	5f                   	pop    %edi
+  80180a:	5d                   	pop    %ebp
+  80180b:	c3                   	ret
+
+0080180c <devpipe_write_bulk>:
+{
+  80180c:	55                   	push   %ebp
+  80180d:	89 e5                	mov    %esp,%ebp
+  80180f:	57                   	push   %edi
+  801810:	56                   	push   %esi
+  801811:	53                   	push   %ebx
+  801812:	83 ec 1c             	sub    $0x1c,%esp
+  801815:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801818:	89 d6                	mov    %edx,%esi
+  80181a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  80181d:	e8 78 fe ff ff       	call   80169a <pipe_ring>
+  801822:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  801825:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  80182a:	8d 46 04             	lea    0x4(%esi),%eax
+  80182d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  801830:	eb 75                	jmp    8018a7 <devpipe_write_bulk+0x9b>
+  801832:	b8 01 00 00 00       	mov    $0x1,%eax
+  801837:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  80183b:	6a 64                	push   $0x64
+  80183d:	68 00 00 c0 ee       	push   $0xeec00000
+  801842:	53                   	push   %ebx
+  801843:	56                   	push   %esi
+  801844:	e8 aa ec ff ff       	call   8004f3 <sys_chan_sleep>
+      continue;
+  801849:	83 c4 10             	add    $0x10,%esp
+  80184c:	eb 59                	jmp    8018a7 <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  80184e:	89 d1                	mov    %edx,%ecx
+  801850:	c1 f9 1f             	sar    $0x1f,%ecx
+  801853:	c1 e9 11             	shr    $0x11,%ecx
+  801856:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  801859:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  80185e:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  801860:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  801866:	29 d3                	sub    %edx,%ebx
+  801868:	ba 00 80 00 00       	mov    $0x8000,%edx
+  80186d:	29 c2                	sub    %eax,%edx
+  80186f:	39 d3                	cmp    %edx,%ebx
+  801871:	0f 47 da             	cmova  %edx,%ebx
+  801874:	8b 55 08             	mov    0x8(%ebp),%edx
+  801877:	29 fa                	sub    %edi,%edx
+  801879:	39 d3                	cmp    %edx,%ebx
+  80187b:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  80187e:	83 ec 04             	sub    $0x4,%esp
+  801881:	53                   	push   %ebx
+  801882:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801885:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  801888:	52                   	push   %edx
+  801889:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80188c:	01 c8                	add    %ecx,%eax
+  80188e:	50                   	push   %eax
+  80188f:	e8 97 10 00 00       	call   80292b <memcpy>
+    i += m;
+  801894:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  801896:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  801899:	8d 46 2c             	lea    0x2c(%esi),%eax
+  80189c:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80189f:	e8 57 fe ff ff       	call   8016fb <pipe_wakeup>
+  8018a4:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  8018a7:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  8018aa:	73 2b                	jae    8018d7 <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  8018ac:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  8018ae:	8b 56 04             	mov    0x4(%esi),%edx
+  8018b1:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  8018b7:	39 d0                	cmp    %edx,%eax
+  8018b9:	7d 93                	jge    80184e <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  8018bb:	89 f2                	mov    %esi,%edx
+  8018bd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8018c0:	e8 e2 fe ff ff       	call   8017a7 <_pipeisclosed>
+  8018c5:	85 c0                	test   %eax,%eax
+  8018c7:	0f 84 65 ff ff ff    	je     801832 <devpipe_write_bulk+0x26>
+        return i;
+  8018cd:	89 f8                	mov    %edi,%eax
+}
+  8018cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018d2:	5b                   	pop    %ebx
+  8018d3:	5e                   	pop    %esi
+  8018d4:	5f                   	pop    %edi
+  8018d5:	5d                   	pop    %ebp
+  8018d6:	c3                   	ret
+  return i;
+  8018d7:	89 f8                	mov    %edi,%eax
+  8018d9:	eb f4                	jmp    8018cf <devpipe_write_bulk+0xc3>
+
+008018db <devpipe_write>:
+{
+  8018db:	55                   	push   %ebp
+  8018dc:	89 e5                	mov    %esp,%ebp
+  8018de:	57                   	push   %edi
+  8018df:	56                   	push   %esi
+  8018e0:	53                   	push   %ebx
+  8018e1:	83 ec 28             	sub    $0x28,%esp
+  8018e4:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  8018e7:	56                   	push   %esi
+  8018e8:	e8 8c ed ff ff       	call   800679 <fd2data>
+  8018ed:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  8018ef:	8b 78 28             	mov    0x28(%eax),%edi
+  8018f2:	83 c4 10             	add    $0x10,%esp
+  8018f5:	85 ff                	test   %edi,%edi
+  8018f7:	75 25                	jne    80191e <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  8018f9:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8018fc:	74 66                	je     801964 <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8018fe:	8b 43 04             	mov    0x4(%ebx),%eax
+  801901:	8b 0b                	mov    (%ebx),%ecx
+  801903:	8d 51 20             	lea    0x20(%ecx),%edx
+  801906:	39 d0                	cmp    %edx,%eax
+  801908:	72 2b                	jb     801935 <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  80190a:	89 da                	mov    %ebx,%edx
+  80190c:	89 f0                	mov    %esi,%eax
+  80190e:	e8 94 fe ff ff       	call   8017a7 <_pipeisclosed>
+  801913:	85 c0                	test   %eax,%eax
+  801915:	75 51                	jne    801968 <devpipe_write+0x8d>
+      sys_yield();
+  801917:	e8 3c e8 ff ff       	call   800158 <sys_yield>
+  80191c:	eb e0                	jmp    8018fe <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  80191e:	83 ec 0c             	sub    $0xc,%esp
+  801921:	ff 75 10             	push   0x10(%ebp)
+  801924:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801927:	89 c2                	mov    %eax,%edx
+  801929:	89 f0                	mov    %esi,%eax
+  80192b:	e8 dc fe ff ff       	call   80180c <devpipe_write_bulk>
+  801930:	83 c4 10             	add    $0x10,%esp
+  801933:	eb 38                	jmp    80196d <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801935:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801938:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  80193c:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  80193f:	89 c2                	mov    %eax,%edx
+  801941:	c1 fa 1f             	sar    $0x1f,%edx
+  801944:	89 d1                	mov    %edx,%ecx
+  801946:	c1 e9 1b             	shr    $0x1b,%ecx
+  801949:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80194c:	83 e2 1f             	and    $0x1f,%edx
+  80194f:	29 ca                	sub    %ecx,%edx
+  801951:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  801955:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  801959:	83 c0 01             	add    $0x1,%eax
+  80195c:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  80195f:	83 c7 01             	add    $0x1,%edi
+  801962:	eb 95                	jmp    8018f9 <devpipe_write+0x1e>
+  return i;
+  801964:	89 f8                	mov    %edi,%eax
+  801966:	eb 05                	jmp    80196d <devpipe_write+0x92>
+        return 0;
+  801968:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80196d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801970:	5b                   	pop    %ebx
+  801971:	5e                   	pop    %esi
+  801972:	5f                   	pop    %edi
+  801973:	5d                   	pop    %ebp
+  801974:	c3                   	ret
+
+00801975 <devpipe_read_bulk>:
+{
+  801975:	55                   	push   %ebp
+  801976:	89 e5                	mov    %esp,%ebp
+  801978:	57                   	push   %edi
+  801979:	56                   	push   %esi
+  80197a:	53                   	push   %ebx
+  80197b:	83 ec 2c             	sub    $0x2c,%esp
+  80197e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801981:	89 d6                	mov    %edx,%esi
+  801983:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801986:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  801989:	e8 0c fd ff ff       	call   80169a <pipe_ring>
+  80198e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  801991:	85 db                	test   %ebx,%ebx
+  801993:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801998:	0f 45 c3             	cmovne %ebx,%eax
+  80199b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80199e:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8019a3:	8d 46 30             	lea    0x30(%esi),%eax
+  8019a6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  8019a9:	eb 50                	jmp    8019fb <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  8019ab:	89 d1                	mov    %edx,%ecx
+  8019ad:	c1 f9 1f             	sar    $0x1f,%ecx
+  8019b0:	c1 e9 11             	shr    $0x11,%ecx
+  8019b3:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  8019b6:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8019bb:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  8019bd:	29 d3                	sub    %edx,%ebx
+  8019bf:	ba 00 80 00 00       	mov    $0x8000,%edx
+  8019c4:	29 c2                	sub    %eax,%edx
+  8019c6:	39 d3                	cmp    %edx,%ebx
+  8019c8:	0f 47 da             	cmova  %edx,%ebx
+  8019cb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019ce:	29 fa                	sub    %edi,%edx
+  8019d0:	39 d3                	cmp    %edx,%ebx
+  8019d2:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  8019d5:	83 ec 04             	sub    $0x4,%esp
+  8019d8:	53                   	push   %ebx
+  8019d9:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8019dc:	01 c8                	add    %ecx,%eax
+  8019de:	50                   	push   %eax
+  8019df:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8019e2:	01 f8                	add    %edi,%eax
+  8019e4:	50                   	push   %eax
+  8019e5:	e8 41 0f 00 00       	call   80292b <memcpy>
+    i += m;
+  8019ea:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  8019ec:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8019ee:	89 f2                	mov    %esi,%edx
+  8019f0:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8019f3:	e8 03 fd ff ff       	call   8016fb <pipe_wakeup>
+  8019f8:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  8019fb:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  8019fe:	73 51                	jae    801a51 <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  801a00:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  801a03:	8b 16                	mov    (%esi),%edx
+  801a05:	39 da                	cmp    %ebx,%edx
+  801a07:	75 a2                	jne    8019ab <devpipe_read_bulk+0x36>
+      if (i > 0)
+  801a09:	85 ff                	test   %edi,%edi
+  801a0b:	75 44                	jne    801a51 <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  801a0d:	89 f2                	mov    %esi,%edx
+  801a0f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801a12:	e8 90 fd ff ff       	call   8017a7 <_pipeisclosed>
+  801a17:	85 c0                	test   %eax,%eax
+  801a19:	75 3a                	jne    801a55 <devpipe_read_bulk+0xe0>
+  801a1b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a20:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  801a24:	6a 64                	push   $0x64
+  801a26:	ff 75 d4             	push   -0x2c(%ebp)
+  801a29:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  801a2a:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  801a2d:	50                   	push   %eax
+  801a2e:	e8 c0 ea ff ff       	call   8004f3 <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  801a33:	85 c0                	test   %eax,%eax
+  801a35:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a3a:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  801a3d:	83 c4 10             	add    $0x10,%esp
+  801a40:	a8 01                	test   $0x1,%al
+  801a42:	74 b7                	je     8019fb <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  801a44:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  801a49:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a4c:	5b                   	pop    %ebx
+  801a4d:	5e                   	pop    %esi
+  801a4e:	5f                   	pop    %edi
+  801a4f:	5d                   	pop    %ebp
+  801a50:	c3                   	ret
+  return i;
+  801a51:	89 f8                	mov    %edi,%eax
+  801a53:	eb f4                	jmp    801a49 <devpipe_read_bulk+0xd4>
+        return 0;
+  801a55:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a5a:	eb ed                	jmp    801a49 <devpipe_read_bulk+0xd4>
+
+00801a5c <devpipe_read>:
+{
+  801a5c:	55                   	push   %ebp
+  801a5d:	89 e5                	mov    %esp,%ebp
+  801a5f:	57                   	push   %edi
+  801a60:	56                   	push   %esi
+  801a61:	53                   	push   %ebx
+  801a62:	83 ec 18             	sub    $0x18,%esp
+  801a65:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  801a68:	57                   	push   %edi
+  801a69:	e8 0b ec ff ff       	call   800679 <fd2data>
+  801a6e:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  801a70:	8b 70 28             	mov    0x28(%eax),%esi
+  801a73:	83 c4 10             	add    $0x10,%esp
+  801a76:	85 f6                	test   %esi,%esi
+  801a78:	75 24                	jne    801a9e <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  801a7a:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801a7d:	74 60                	je     801adf <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  801a7f:	8b 03                	mov    (%ebx),%eax
+  801a81:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801a84:	75 3b                	jne    801ac1 <devpipe_read+0x65>
+      if (i > 0)
+  801a86:	85 f6                	test   %esi,%esi
+  801a88:	75 2d                	jne    801ab7 <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  801a8a:	89 da                	mov    %ebx,%edx
+  801a8c:	89 f8                	mov    %edi,%eax
+  801a8e:	e8 14 fd ff ff       	call   8017a7 <_pipeisclosed>
+  801a93:	85 c0                	test   %eax,%eax
+  801a95:	75 4c                	jne    801ae3 <devpipe_read+0x87>
+      sys_yield();
+  801a97:	e8 bc e6 ff ff       	call   800158 <sys_yield>
+  801a9c:	eb e1                	jmp    801a7f <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  801a9e:	83 ec 08             	sub    $0x8,%esp
+  801aa1:	6a 00                	push   $0x0
+  801aa3:	ff 75 10             	push   0x10(%ebp)
+  801aa6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801aa9:	89 c2                	mov    %eax,%edx
+  801aab:	89 f8                	mov    %edi,%eax
+  801aad:	e8 c3 fe ff ff       	call   801975 <devpipe_read_bulk>
+  801ab2:	83 c4 10             	add    $0x10,%esp
+  801ab5:	eb 02                	jmp    801ab9 <devpipe_read+0x5d>
+        return i;
+  801ab7:	89 f0                	mov    %esi,%eax
+}
+  801ab9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801abc:	5b                   	pop    %ebx
+  801abd:	5e                   	pop    %esi
+  801abe:	5f                   	pop    %edi
+  801abf:	5d                   	pop    %ebp
+  801ac0:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801ac1:	99                   	cltd
+  801ac2:	c1 ea 1b             	shr    $0x1b,%edx
+  801ac5:	01 d0                	add    %edx,%eax
+  801ac7:	83 e0 1f             	and    $0x1f,%eax
+  801aca:	29 d0                	sub    %edx,%eax
+  801acc:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801ad1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ad4:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  801ad7:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  801ada:	83 c6 01             	add    $0x1,%esi
+  801add:	eb 9b                	jmp    801a7a <devpipe_read+0x1e>
+  return i;
+  801adf:	89 f0                	mov    %esi,%eax
+  801ae1:	eb d6                	jmp    801ab9 <devpipe_read+0x5d>
+        return 0;
+  801ae3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ae8:	eb cf                	jmp    801ab9 <devpipe_read+0x5d>
+
+00801aea <pipe2>:
+{
+  801aea:	55                   	push   %ebp
+  801aeb:	89 e5                	mov    %esp,%ebp
+  801aed:	57                   	push   %edi
+  801aee:	56                   	push   %esi
+  801aef:	53                   	push   %ebx
+  801af0:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  801af3:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801af6:	50                   	push   %eax
+  801af7:	e8 91 eb ff ff       	call   80068d <fd_alloc>
+  801afc:	89 c3                	mov    %eax,%ebx
+  801afe:	83 c4 10             	add    $0x10,%esp
+  801b01:	85 c0                	test   %eax,%eax
+  801b03:	0f 88 fb 01 00 00    	js     801d04 <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801b09:	83 ec 04             	sub    $0x4,%esp
+  801b0c:	68 07 04 00 00       	push   $0x407
+  801b11:	ff 75 e4             	push   -0x1c(%ebp)
+  801b14:	6a 00                	push   $0x0
+  801b16:	e8 9f e6 ff ff       	call   8001ba <sys_page_alloc>
+  801b1b:	89 c3                	mov    %eax,%ebx
+  801b1d:	83 c4 10             	add    $0x10,%esp
+  801b20:	85 c0                	test   %eax,%eax
+  801b22:	0f 88 dc 01 00 00    	js     801d04 <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  801b28:	83 ec 0c             	sub    $0xc,%esp
+  801b2b:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801b2e:	50                   	push   %eax
+  801b2f:	e8 59 eb ff ff       	call   80068d <fd_alloc>
+  801b34:	89 c3                	mov    %eax,%ebx
+  801b36:	83 c4 10             	add    $0x10,%esp
+  801b39:	85 c0                	test   %eax,%eax
+  801b3b:	0f 88 b3 01 00 00    	js     801cf4 <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801b41:	83 ec 04             	sub    $0x4,%esp
+  801b44:	68 07 04 00 00       	push   $0x407
+  801b49:	ff 75 e0             	push   -0x20(%ebp)
+  801b4c:	6a 00                	push   $0x0
+  801b4e:	e8 67 e6 ff ff       	call   8001ba <sys_page_alloc>
+  801b53:	89 c3                	mov    %eax,%ebx
+  801b55:	83 c4 10             	add    $0x10,%esp
+  801b58:	85 c0                	test   %eax,%eax
+  801b5a:	0f 88 94 01 00 00    	js     801cf4 <pipe2+0x20a>
+  va = fd2data(fd0);
+  801b60:	83 ec 0c             	sub    $0xc,%esp
+  801b63:	ff 75 e4             	push   -0x1c(%ebp)
+  801b66:	e8 0e eb ff ff       	call   800679 <fd2data>
+  801b6b:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801b6d:	83 c4 0c             	add    $0xc,%esp
+  801b70:	68 07 04 00 00       	push   $0x407
+  801b75:	50                   	push   %eax
+  801b76:	6a 00                	push   $0x0
+  801b78:	e8 3d e6 ff ff       	call   8001ba <sys_page_alloc>
+  801b7d:	89 c3                	mov    %eax,%ebx
+  801b7f:	83 c4 10             	add    $0x10,%esp
+  801b82:	85 c0                	test   %eax,%eax
+  801b84:	0f 88 5a 01 00 00    	js     801ce4 <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801b8a:	83 ec 0c             	sub    $0xc,%esp
+  801b8d:	ff 75 e0             	push   -0x20(%ebp)
+  801b90:	e8 e4 ea ff ff       	call   800679 <fd2data>
+  801b95:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  801b9c:	50                   	push   %eax
+  801b9d:	6a 00                	push   $0x0
+  801b9f:	57                   	push   %edi
+  801ba0:	6a 00                	push   $0x0
+  801ba2:	e8 56 e6 ff ff       	call   8001fd <sys_page_map>
+  801ba7:	89 c3                	mov    %eax,%ebx
+  801ba9:	83 c4 20             	add    $0x20,%esp
+  801bac:	85 c0                	test   %eax,%eax
+  801bae:	0f 88 22 01 00 00    	js     801cd6 <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  801bb4:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  801bb8:	74 72                	je     801c2c <pipe2+0x142>
+  801bba:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  801bbf:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801bc2:	e8 d3 fa ff ff       	call   80169a <pipe_ring>
+  801bc7:	83 ec 04             	sub    $0x4,%esp
+  801bca:	68 07 04 00 00       	push   $0x407
+  801bcf:	01 f0                	add    %esi,%eax
+  801bd1:	50                   	push   %eax
+  801bd2:	6a 00                	push   $0x0
+  801bd4:	e8 e1 e5 ff ff       	call   8001ba <sys_page_alloc>
+  801bd9:	89 c3                	mov    %eax,%ebx
+  801bdb:	83 c4 10             	add    $0x10,%esp
+  801bde:	85 c0                	test   %eax,%eax
+  801be0:	0f 88 97 00 00 00    	js     801c7d <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  801be6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801be9:	e8 ac fa ff ff       	call   80169a <pipe_ring>
+  801bee:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  801bf1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801bf4:	e8 a1 fa ff ff       	call   80169a <pipe_ring>
+  801bf9:	83 ec 0c             	sub    $0xc,%esp
+  801bfc:	68 07 04 00 00       	push   $0x407
+  801c01:	53                   	push   %ebx
+  801c02:	6a 00                	push   $0x0
+  801c04:	01 f0                	add    %esi,%eax
+  801c06:	50                   	push   %eax
+  801c07:	6a 00                	push   $0x0
+  801c09:	e8 ef e5 ff ff       	call   8001fd <sys_page_map>
+  801c0e:	89 c3                	mov    %eax,%ebx
+  801c10:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801c16:	83 c4 20             	add    $0x20,%esp
+  801c19:	85 c0                	test   %eax,%eax
+  801c1b:	78 60                	js     801c7d <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  801c1d:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  801c23:	75 9a                	jne    801bbf <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  801c25:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  801c2c:	a1 24 40 80 00       	mov    0x804024,%eax
+  801c31:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801c34:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  801c36:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801c39:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  801c40:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801c43:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  801c45:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801c48:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  801c4f:	83 ec 0c             	sub    $0xc,%esp
+  801c52:	ff 75 e4             	push   -0x1c(%ebp)
+  801c55:	e8 0f ea ff ff       	call   800669 <fd2num>
+  801c5a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801c5d:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  801c5f:	83 c4 04             	add    $0x4,%esp
+  801c62:	ff 75 e0             	push   -0x20(%ebp)
+  801c65:	e8 ff e9 ff ff       	call   800669 <fd2num>
+  801c6a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801c6d:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  801c70:	83 c4 10             	add    $0x10,%esp
+  801c73:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c78:	e9 87 00 00 00       	jmp    801d04 <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  801c7d:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  801c82:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801c85:	e8 10 fa ff ff       	call   80169a <pipe_ring>
+  801c8a:	83 ec 08             	sub    $0x8,%esp
+  801c8d:	01 f0                	add    %esi,%eax
+  801c8f:	50                   	push   %eax
+  801c90:	6a 00                	push   $0x0
+  801c92:	e8 a8 e5 ff ff       	call   80023f <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  801c97:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801c9a:	e8 fb f9 ff ff       	call   80169a <pipe_ring>
+  801c9f:	83 c4 08             	add    $0x8,%esp
+  801ca2:	01 f0                	add    %esi,%eax
+  801ca4:	50                   	push   %eax
+  801ca5:	6a 00                	push   $0x0
+  801ca7:	e8 93 e5 ff ff       	call   80023f <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  801cac:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801cb2:	83 c4 10             	add    $0x10,%esp
+  801cb5:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  801cbb:	75 c5                	jne    801c82 <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  801cbd:	83 ec 0c             	sub    $0xc,%esp
+  801cc0:	ff 75 e0             	push   -0x20(%ebp)
+  801cc3:	e8 b1 e9 ff ff       	call   800679 <fd2data>
+  801cc8:	83 c4 08             	add    $0x8,%esp
+  801ccb:	50                   	push   %eax
+  801ccc:	6a 00                	push   $0x0
+  801cce:	e8 6c e5 ff ff       	call   80023f <sys_page_unmap>
+  801cd3:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  801cd6:	83 ec 08             	sub    $0x8,%esp
+  801cd9:	57                   	push   %edi
+  801cda:	6a 00                	push   $0x0
+  801cdc:	e8 5e e5 ff ff       	call   80023f <sys_page_unmap>
+  801ce1:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  801ce4:	83 ec 08             	sub    $0x8,%esp
+  801ce7:	ff 75 e0             	push   -0x20(%ebp)
+  801cea:	6a 00                	push   $0x0
+  801cec:	e8 4e e5 ff ff       	call   80023f <sys_page_unmap>
+  801cf1:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  801cf4:	83 ec 08             	sub    $0x8,%esp
+  801cf7:	ff 75 e4             	push   -0x1c(%ebp)
+  801cfa:	6a 00                	push   $0x0
+  801cfc:	e8 3e e5 ff ff       	call   80023f <sys_page_unmap>
+  801d01:	83 c4 10             	add    $0x10,%esp
+}
+  801d04:	89 d8                	mov    %ebx,%eax
+  801d06:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d09:	5b                   	pop    %ebx
+  801d0a:	5e                   	pop    %esi
+  801d0b:	5f                   	pop    %edi
+  801d0c:	5d                   	pop    %ebp
+  801d0d:	c3                   	ret
+
+00801d0e <pipe>:
+{
+  801d0e:	55                   	push   %ebp
+  801d0f:	89 e5                	mov    %esp,%ebp
+  801d11:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  801d14:	6a 00                	push   $0x0
+  801d16:	ff 75 08             	push   0x8(%ebp)
+  801d19:	e8 cc fd ff ff       	call   801aea <pipe2>
+}
+  801d1e:	c9                   	leave
+  801d1f:	c3                   	ret
+
+00801d20 <pipeisclosed>:
+{
+  801d20:	55                   	push   %ebp
+  801d21:	89 e5                	mov    %esp,%ebp
+  801d23:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801d26:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d29:	50                   	push   %eax
+  801d2a:	ff 75 08             	push   0x8(%ebp)
+  801d2d:	e8 b1 e9 ff ff       	call   8006e3 <fd_lookup>
+  801d32:	83 c4 10             	add    $0x10,%esp
+  801d35:	85 c0                	test   %eax,%eax
+  801d37:	78 18                	js     801d51 <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  801d39:	83 ec 0c             	sub    $0xc,%esp
+  801d3c:	ff 75 f4             	push   -0xc(%ebp)
+  801d3f:	e8 35 e9 ff ff       	call   800679 <fd2data>
+  801d44:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  801d46:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d49:	e8 59 fa ff ff       	call   8017a7 <_pipeisclosed>
+  801d4e:	83 c4 10             	add    $0x10,%esp
+}
+  801d51:	c9                   	leave
+  801d52:	c3                   	ret
+
+00801d53 <pipe_splice>:
+{
+  801d53:	55                   	push   %ebp
+  801d54:	89 e5                	mov    %esp,%ebp
+  801d56:	57                   	push   %edi
+  801d57:	56                   	push   %esi
+  801d58:	53                   	push   %ebx
+  801d59:	83 ec 34             	sub    $0x34,%esp
+  801d5c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801d5f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801d62:	50                   	push   %eax
+  801d63:	ff 75 08             	push   0x8(%ebp)
+  801d66:	e8 78 e9 ff ff       	call   8006e3 <fd_lookup>
+  801d6b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801d6e:	83 c4 10             	add    $0x10,%esp
+  801d71:	85 c0                	test   %eax,%eax
+  801d73:	0f 88 d7 00 00 00    	js     801e50 <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  801d79:	83 ec 0c             	sub    $0xc,%esp
+  801d7c:	ff 75 e4             	push   -0x1c(%ebp)
+  801d7f:	e8 f5 e8 ff ff       	call   800679 <fd2data>
+  801d84:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  801d86:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801d89:	83 c4 10             	add    $0x10,%esp
+  801d8c:	8b 15 24 40 80 00    	mov    0x804024,%edx
+  801d92:	39 10                	cmp    %edx,(%eax)
+  801d94:	0f 85 c1 00 00 00    	jne    801e5b <pipe_splice+0x108>
+  801d9a:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  801d9e:	0f 84 c0 00 00 00    	je     801e64 <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  801da4:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  801da8:	0f 84 bf 00 00 00    	je     801e6d <pipe_splice+0x11a>
+  801dae:	89 f7                	mov    %esi,%edi
+  801db0:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  801db6:	0f 85 ba 00 00 00    	jne    801e76 <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  801dbc:	8d 43 04             	lea    0x4(%ebx),%eax
+  801dbf:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801dc2:	eb 38                	jmp    801dfc <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  801dc4:	83 ec 0c             	sub    $0xc,%esp
+  801dc7:	68 00 10 00 00       	push   $0x1000
+  801dcc:	89 f1                	mov    %esi,%ecx
+  801dce:	89 da                	mov    %ebx,%edx
+  801dd0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801dd3:	e8 34 fa ff ff       	call   80180c <devpipe_write_bulk>
+  801dd8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801ddb:	83 c4 10             	add    $0x10,%esp
+  801dde:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801de3:	75 53                	jne    801e38 <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  801de5:	83 ec 08             	sub    $0x8,%esp
+  801de8:	56                   	push   %esi
+  801de9:	6a 00                	push   $0x0
+  801deb:	e8 4f e4 ff ff       	call   80023f <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  801df0:	83 c7 01             	add    $0x1,%edi
+  801df3:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801df9:	83 c4 10             	add    $0x10,%esp
+  801dfc:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801dff:	74 3a                	je     801e3b <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  801e01:	8b 03                	mov    (%ebx),%eax
+  801e03:	39 43 04             	cmp    %eax,0x4(%ebx)
+  801e06:	75 bc                	jne    801dc4 <pipe_splice+0x71>
+  801e08:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e0d:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  801e11:	85 c0                	test   %eax,%eax
+  801e13:	74 af                	je     801dc4 <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  801e15:	83 ec 04             	sub    $0x4,%esp
+  801e18:	6a 07                	push   $0x7
+  801e1a:	56                   	push   %esi
+  801e1b:	ff 75 d0             	push   -0x30(%ebp)
+  801e1e:	e8 f3 e6 ff ff       	call   800516 <sys_chan_wakeup>
+  801e23:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801e26:	83 c4 10             	add    $0x10,%esp
+  801e29:	85 c0                	test   %eax,%eax
+  801e2b:	79 b8                	jns    801de5 <pipe_splice+0x92>
+  801e2d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e32:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  801e36:	eb 8c                	jmp    801dc4 <pipe_splice+0x71>
+  801e38:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  801e3b:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801e3f:	75 06                	jne    801e47 <pipe_splice+0xf4>
+  801e41:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  801e45:	78 09                	js     801e50 <pipe_splice+0xfd>
+  return i * PGSIZE;
+  801e47:	8b 45 10             	mov    0x10(%ebp),%eax
+  801e4a:	c1 e0 0c             	shl    $0xc,%eax
+  801e4d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  801e50:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801e53:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e56:	5b                   	pop    %ebx
+  801e57:	5e                   	pop    %esi
+  801e58:	5f                   	pop    %edi
+  801e59:	5d                   	pop    %ebp
+  801e5a:	c3                   	ret
+    return -E_INVAL;
+  801e5b:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  801e62:	eb ec                	jmp    801e50 <pipe_splice+0xfd>
+  801e64:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  801e6b:	eb e3                	jmp    801e50 <pipe_splice+0xfd>
+  801e6d:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  801e74:	eb da                	jmp    801e50 <pipe_splice+0xfd>
+  801e76:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  801e7d:	eb d1                	jmp    801e50 <pipe_splice+0xfd>
+
+00801e7f <pipe_splice_read>:
+{
+  801e7f:	55                   	push   %ebp
+  801e80:	89 e5                	mov    %esp,%ebp
+  801e82:	53                   	push   %ebx
+  801e83:	83 ec 1c             	sub    $0x1c,%esp
+  801e86:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801e89:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e8c:	50                   	push   %eax
+  801e8d:	ff 75 08             	push   0x8(%ebp)
+  801e90:	e8 4e e8 ff ff       	call   8006e3 <fd_lookup>
+  801e95:	83 c4 10             	add    $0x10,%esp
+  801e98:	85 c0                	test   %eax,%eax
+  801e9a:	78 49                	js     801ee5 <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  801e9c:	83 ec 0c             	sub    $0xc,%esp
+  801e9f:	ff 75 f4             	push   -0xc(%ebp)
+  801ea2:	e8 d2 e7 ff ff       	call   800679 <fd2data>
+  801ea7:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  801ea9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801eac:	83 c4 10             	add    $0x10,%esp
+  801eaf:	8b 0d 24 40 80 00    	mov    0x804024,%ecx
+  801eb5:	39 08                	cmp    %ecx,(%eax)
+  801eb7:	75 31                	jne    801eea <pipe_splice_read+0x6b>
+  801eb9:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  801ebd:	74 32                	je     801ef1 <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  801ebf:	8b 48 08             	mov    0x8(%eax),%ecx
+  801ec2:	83 e1 03             	and    $0x3,%ecx
+  801ec5:	83 f9 01             	cmp    $0x1,%ecx
+  801ec8:	74 2e                	je     801ef8 <pipe_splice_read+0x79>
+  801eca:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  801ed0:	75 2d                	jne    801eff <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  801ed2:	83 ec 08             	sub    $0x8,%esp
+  801ed5:	53                   	push   %ebx
+  801ed6:	68 00 10 00 00       	push   $0x1000
+  801edb:	89 d9                	mov    %ebx,%ecx
+  801edd:	e8 93 fa ff ff       	call   801975 <devpipe_read_bulk>
+  801ee2:	83 c4 10             	add    $0x10,%esp
+}
+  801ee5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ee8:	c9                   	leave
+  801ee9:	c3                   	ret
+    return -E_INVAL;
+  801eea:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801eef:	eb f4                	jmp    801ee5 <pipe_splice_read+0x66>
+  801ef1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ef6:	eb ed                	jmp    801ee5 <pipe_splice_read+0x66>
+  801ef8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801efd:	eb e6                	jmp    801ee5 <pipe_splice_read+0x66>
+  801eff:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f04:	eb df                	jmp    801ee5 <pipe_splice_read+0x66>
+
+00801f06 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  801f06:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f0b:	c3                   	ret
+
+00801f0c <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  801f0c:	55                   	push   %ebp
+  801f0d:	89 e5                	mov    %esp,%ebp
+  801f0f:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  801f12:	68 bb 2f 80 00       	push   $0x802fbb
+  801f17:	ff 75 0c             	push   0xc(%ebp)
+  801f1a:	e8 24 08 00 00       	call   802743 <strcpy>
+  return 0;
+}
+  801f1f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f24:	c9                   	leave
+  801f25:	c3                   	ret
+
+00801f26 <devcons_write>:
+{
+  801f26:	55                   	push   %ebp
+  801f27:	89 e5                	mov    %esp,%ebp
+  801f29:	57                   	push   %edi
+  801f2a:	56                   	push   %esi
+  801f2b:	53                   	push   %ebx
+  801f2c:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  801f32:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  801f37:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  801f3d:	eb 2e                	jmp    801f6d <devcons_write+0x47>
+    m = n - tot;
+  801f3f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f42:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  801f44:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801f49:	39 c3                	cmp    %eax,%ebx
+  801f4b:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  801f4e:	83 ec 04             	sub    $0x4,%esp
+  801f51:	53                   	push   %ebx
+  801f52:	89 f0                	mov    %esi,%eax
+  801f54:	03 45 0c             	add    0xc(%ebp),%eax
+  801f57:	50                   	push   %eax
+  801f58:	57                   	push   %edi
+  801f59:	e8 6b 09 00 00       	call   8028c9 <memmove>
+    sys_cputs(buf, m);
+  801f5e:	83 c4 08             	add    $0x8,%esp
+  801f61:	53                   	push   %ebx
+  801f62:	57                   	push   %edi
+  801f63:	e8 53 e1 ff ff       	call   8000bb <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  801f68:	01 de                	add    %ebx,%esi
+  801f6a:	83 c4 10             	add    $0x10,%esp
+  801f6d:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801f70:	72 cd                	jb     801f3f <devcons_write+0x19>
+}
+  801f72:	89 f0                	mov    %esi,%eax
+  801f74:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f77:	5b                   	pop    %ebx
+  801f78:	5e                   	pop    %esi
+  801f79:	5f                   	pop    %edi
+  801f7a:	5d                   	pop    %ebp
+  801f7b:	c3                   	ret
+
+00801f7c <devcons_read>:
+{
+  801f7c:	55                   	push   %ebp
+  801f7d:	89 e5                	mov    %esp,%ebp
+  801f7f:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  801f82:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f87:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801f8b:	75 07                	jne    801f94 <devcons_read+0x18>
+  801f8d:	eb 1f                	jmp    801fae <devcons_read+0x32>
+    sys_yield();
+  801f8f:	e8 c4 e1 ff ff       	call   800158 <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  801f94:	e8 40 e1 ff ff       	call   8000d9 <sys_cgetc>
+  801f99:	85 c0                	test   %eax,%eax
+  801f9b:	74 f2                	je     801f8f <devcons_read+0x13>
+  if (c < 0)
+  801f9d:	78 0f                	js     801fae <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  801f9f:	83 f8 04             	cmp    $0x4,%eax
+  801fa2:	74 0c                	je     801fb0 <devcons_read+0x34>
+  *(char*)vbuf = c;
+  801fa4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801fa7:	88 02                	mov    %al,(%edx)
+  return 1;
+  801fa9:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  801fae:	c9                   	leave
+  801faf:	c3                   	ret
+    return 0;
+  801fb0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fb5:	eb f7                	jmp    801fae <devcons_read+0x32>
+
+00801fb7 <cputchar>:
+{
+  801fb7:	55                   	push   %ebp
+  801fb8:	89 e5                	mov    %esp,%ebp
+  801fba:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  801fbd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fc0:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  801fc3:	6a 01                	push   $0x1
+  801fc5:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801fc8:	50                   	push   %eax
+  801fc9:	e8 ed e0 ff ff       	call   8000bb <sys_cputs>
+}
+  801fce:	83 c4 10             	add    $0x10,%esp
+  801fd1:	c9                   	leave
+  801fd2:	c3                   	ret
+
+00801fd3 <getchar>:
+{
+  801fd3:	55                   	push   %ebp
+  801fd4:	89 e5                	mov    %esp,%ebp
+  801fd6:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  801fd9:	6a 01                	push   $0x1
+  801fdb:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801fde:	50                   	push   %eax
+  801fdf:	6a 00                	push   $0x0
+  801fe1:	e8 a8 e9 ff ff       	call   80098e <read>
+  if (r < 0)
+  801fe6:	83 c4 10             	add    $0x10,%esp
+  801fe9:	85 c0                	test   %eax,%eax
+  801feb:	78 06                	js     801ff3 <getchar+0x20>
+  if (r < 1)
+  801fed:	74 06                	je     801ff5 <getchar+0x22>
+  return c;
+  801fef:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  801ff3:	c9                   	leave
+  801ff4:	c3                   	ret
+    return -E_EOF;
+  801ff5:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  801ffa:	eb f7                	jmp    801ff3 <getchar+0x20>
+
+00801ffc <iscons>:
+{
+  801ffc:	55                   	push   %ebp
+  801ffd:	89 e5                	mov    %esp,%ebp
+  801fff:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802002:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802005:	50                   	push   %eax
+  802006:	ff 75 08             	push   0x8(%ebp)
+  802009:	e8 d5 e6 ff ff       	call   8006e3 <fd_lookup>
+  80200e:	83 c4 10             	add    $0x10,%esp
+  802011:	85 c0                	test   %eax,%eax
+  802013:	78 11                	js     802026 <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  802015:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802018:	8b 15 40 40 80 00    	mov    0x804040,%edx
+  80201e:	39 10                	cmp    %edx,(%eax)
+  802020:	0f 94 c0             	sete   %al
+  802023:	0f b6 c0             	movzbl %al,%eax
+}
+  802026:	c9                   	leave
+  802027:	c3                   	ret
+
+00802028 <opencons>:
+{
+  802028:	55                   	push   %ebp
+  802029:	89 e5                	mov    %esp,%ebp
+  80202b:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  80202e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802031:	50                   	push   %eax
+  802032:	e8 56 e6 ff ff       	call   80068d <fd_alloc>
+  802037:	83 c4 10             	add    $0x10,%esp
+  80203a:	85 c0                	test   %eax,%eax
+  80203c:	78 3a                	js     802078 <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80203e:	83 ec 04             	sub    $0x4,%esp
+  802041:	68 07 04 00 00       	push   $0x407
+  802046:	ff 75 f4             	push   -0xc(%ebp)
+  802049:	6a 00                	push   $0x0
+  80204b:	e8 6a e1 ff ff       	call   8001ba <sys_page_alloc>
+  802050:	83 c4 10             	add    $0x10,%esp
+  802053:	85 c0                	test   %eax,%eax
+  802055:	78 21                	js     802078 <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  802057:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80205a:	8b 15 40 40 80 00    	mov    0x804040,%edx
+  802060:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  802062:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802065:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  80206c:	83 ec 0c             	sub    $0xc,%esp
+  80206f:	50                   	push   %eax
+  802070:	e8 f4 e5 ff ff       	call   800669 <fd2num>
+  802075:	83 c4 10             	add    $0x10,%esp
+}
+  802078:	c9                   	leave
+  802079:	c3                   	ret
+
+0080207a <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80207a:	55                   	push   %ebp
+  80207b:	89 e5                	mov    %esp,%ebp
+  80207d:	56                   	push   %esi
+  80207e:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  80207f:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  802082:	8b 35 04 40 80 00    	mov    0x804004,%esi
+  802088:	e8 ac e0 ff ff       	call   800139 <sys_getenvid>
+  80208d:	83 ec 0c             	sub    $0xc,%esp
+  802090:	ff 75 0c             	push   0xc(%ebp)
+  802093:	ff 75 08             	push   0x8(%ebp)
+  802096:	56                   	push   %esi
+  802097:	50                   	push   %eax
+  802098:	68 c8 2f 80 00       	push   $0x802fc8
+  80209d:	e8 b3 00 00 00       	call   802155 <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  8020a2:	83 c4 18             	add    $0x18,%esp
+  8020a5:	53                   	push   %ebx
+  8020a6:	ff 75 10             	push   0x10(%ebp)
+  8020a9:	e8 56 00 00 00       	call   802104 <vcprintf>
+  cprintf("\n");
+  8020ae:	c7 04 24 b4 2f 80 00 	movl   $0x802fb4,(%esp)
+  8020b5:	e8 9b 00 00 00       	call   802155 <cprintf>
+  8020ba:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  8020bd:	cc                   	int3
+  while (1)
+  8020be:	eb fd                	jmp    8020bd <_panic+0x43>
+
+008020c0 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8020c0:	55                   	push   %ebp
+  8020c1:	89 e5                	mov    %esp,%ebp
+  8020c3:	53                   	push   %ebx
+  8020c4:	83 ec 04             	sub    $0x4,%esp
+  8020c7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  8020ca:	8b 13                	mov    (%ebx),%edx
+  8020cc:	8d 42 01             	lea    0x1(%edx),%eax
+  8020cf:	89 03                	mov    %eax,(%ebx)
+  8020d1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8020d4:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  8020d8:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8020dd:	74 09                	je     8020e8 <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  8020df:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8020e3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020e6:	c9                   	leave
+  8020e7:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  8020e8:	83 ec 08             	sub    $0x8,%esp
+  8020eb:	68 ff 00 00 00       	push   $0xff
+  8020f0:	8d 43 08             	lea    0x8(%ebx),%eax
+  8020f3:	50                   	push   %eax
+  8020f4:	e8 c2 df ff ff       	call   8000bb <sys_cputs>
+    b->idx = 0;
+  8020f9:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8020ff:	83 c4 10             	add    $0x10,%esp
+  802102:	eb db                	jmp    8020df <putch+0x1f>
+
+00802104 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  802104:	55                   	push   %ebp
+  802105:	89 e5                	mov    %esp,%ebp
+  802107:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  80210d:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  802114:	00 00 00 
+  b.cnt = 0;
+  802117:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80211e:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  802121:	ff 75 0c             	push   0xc(%ebp)
+  802124:	ff 75 08             	push   0x8(%ebp)
+  802127:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80212d:	50                   	push   %eax
+  80212e:	68 c0 20 80 00       	push   $0x8020c0
+  802133:	e8 14 01 00 00       	call   80224c <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  802138:	83 c4 08             	add    $0x8,%esp
+  80213b:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  802141:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  802147:	50                   	push   %eax
+  802148:	e8 6e df ff ff       	call   8000bb <sys_cputs>
+
+  return b.cnt;
+}
+  80214d:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  802153:	c9                   	leave
+  802154:	c3                   	ret
+
+00802155 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  802155:	55                   	push   %ebp
+  802156:	89 e5                	mov    %esp,%ebp
+  802158:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  80215b:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  80215e:	50                   	push   %eax
+  80215f:	ff 75 08             	push   0x8(%ebp)
+  802162:	e8 9d ff ff ff       	call   802104 <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  802167:	c9                   	leave
+  802168:	c3                   	ret
+
+00802169 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  802169:	55                   	push   %ebp
+  80216a:	89 e5                	mov    %esp,%ebp
+  80216c:	57                   	push   %edi
+  80216d:	56                   	push   %esi
+  80216e:	53                   	push   %ebx
+  80216f:	83 ec 1c             	sub    $0x1c,%esp
+  802172:	89 c7                	mov    %eax,%edi
+  802174:	89 d6                	mov    %edx,%esi
+  802176:	8b 45 08             	mov    0x8(%ebp),%eax
+  802179:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80217c:	89 d1                	mov    %edx,%ecx
+  80217e:	89 c2                	mov    %eax,%edx
+  802180:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802183:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802186:	8b 45 10             	mov    0x10(%ebp),%eax
+  802189:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  80218c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80218f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802196:	39 c2                	cmp    %eax,%edx
+  802198:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80219b:	72 3e                	jb     8021db <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  80219d:	83 ec 0c             	sub    $0xc,%esp
+  8021a0:	ff 75 18             	push   0x18(%ebp)
+  8021a3:	83 eb 01             	sub    $0x1,%ebx
+  8021a6:	53                   	push   %ebx
+  8021a7:	50                   	push   %eax
+  8021a8:	83 ec 08             	sub    $0x8,%esp
+  8021ab:	ff 75 e4             	push   -0x1c(%ebp)
+  8021ae:	ff 75 e0             	push   -0x20(%ebp)
+  8021b1:	ff 75 dc             	push   -0x24(%ebp)
+  8021b4:	ff 75 d8             	push   -0x28(%ebp)
+  8021b7:	e8 1c 0b 00 00       	call   802cd8 <__udivdi3>
+  8021bc:	83 c4 18             	add    $0x18,%esp
+  8021bf:	52                   	push   %edx
+  8021c0:	50                   	push   %eax
+  8021c1:	89 f2                	mov    %esi,%edx
+  8021c3:	89 f8                	mov    %edi,%eax
+  8021c5:	e8 9f ff ff ff       	call   802169 <printnum>
+  8021ca:	83 c4 20             	add    $0x20,%esp
+  8021cd:	eb 13                	jmp    8021e2 <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  8021cf:	83 ec 08             	sub    $0x8,%esp
+  8021d2:	56                   	push   %esi
+  8021d3:	ff 75 18             	push   0x18(%ebp)
+  8021d6:	ff d7                	call   *%edi
+  8021d8:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  8021db:	83 eb 01             	sub    $0x1,%ebx
+  8021de:	85 db                	test   %ebx,%ebx
+  8021e0:	7f ed                	jg     8021cf <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  8021e2:	83 ec 08             	sub    $0x8,%esp
+  8021e5:	56                   	push   %esi
+  8021e6:	83 ec 04             	sub    $0x4,%esp
+  8021e9:	ff 75 e4             	push   -0x1c(%ebp)
+  8021ec:	ff 75 e0             	push   -0x20(%ebp)
+  8021ef:	ff 75 dc             	push   -0x24(%ebp)
+  8021f2:	ff 75 d8             	push   -0x28(%ebp)
+  8021f5:	e8 ff 0a 00 00       	call   802cf9 <__umoddi3>
+  8021fa:	83 c4 14             	add    $0x14,%esp
+  8021fd:	0f be 80 eb 2f 80 00 	movsbl 0x802feb(%eax),%eax
+  802204:	50                   	push   %eax
+  802205:	ff d7                	call   *%edi
+}
+  802207:	83 c4 10             	add    $0x10,%esp
+  80220a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80220d:	5b                   	pop    %ebx
+  80220e:	5e                   	pop    %esi
+  80220f:	5f                   	pop    %edi
+  802210:	5d                   	pop    %ebp
+  802211:	c3                   	ret
+
+00802212 <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  802212:	55                   	push   %ebp
+  802213:	89 e5                	mov    %esp,%ebp
+  802215:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  802218:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  80221c:	8b 10                	mov    (%eax),%edx
+  80221e:	3b 50 04             	cmp    0x4(%eax),%edx
+  802221:	73 0a                	jae    80222d <sprintputch+0x1b>
+    *b->buf++ = ch;
+  802223:	8d 4a 01             	lea    0x1(%edx),%ecx
+  802226:	89 08                	mov    %ecx,(%eax)
+  802228:	8b 45 08             	mov    0x8(%ebp),%eax
+  80222b:	88 02                	mov    %al,(%edx)
+}
+  80222d:	5d                   	pop    %ebp
+  80222e:	c3                   	ret
+
+0080222f <printfmt>:
+{
+  80222f:	55                   	push   %ebp
+  802230:	89 e5                	mov    %esp,%ebp
+  802232:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  802235:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  802238:	50                   	push   %eax
+  802239:	ff 75 10             	push   0x10(%ebp)
+  80223c:	ff 75 0c             	push   0xc(%ebp)
+  80223f:	ff 75 08             	push   0x8(%ebp)
+  802242:	e8 05 00 00 00       	call   80224c <vprintfmt>
+}
+  802247:	83 c4 10             	add    $0x10,%esp
+  80224a:	c9                   	leave
+  80224b:	c3                   	ret
+
+0080224c <vprintfmt>:
+{
+  80224c:	55                   	push   %ebp
+  80224d:	89 e5                	mov    %esp,%ebp
+  80224f:	57                   	push   %edi
+  802250:	56                   	push   %esi
+  802251:	53                   	push   %ebx
+  802252:	83 ec 2c             	sub    $0x2c,%esp
+  802255:	8b 75 08             	mov    0x8(%ebp),%esi
+  802258:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80225b:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80225e:	eb 0a                	jmp    80226a <vprintfmt+0x1e>
+      putch(ch, putdat);
+  802260:	83 ec 08             	sub    $0x8,%esp
+  802263:	53                   	push   %ebx
+  802264:	50                   	push   %eax
+  802265:	ff d6                	call   *%esi
+  802267:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  80226a:	83 c7 01             	add    $0x1,%edi
+  80226d:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  802271:	83 f8 25             	cmp    $0x25,%eax
+  802274:	74 0c                	je     802282 <vprintfmt+0x36>
+      if (ch == '\0')
+  802276:	85 c0                	test   %eax,%eax
+  802278:	75 e6                	jne    802260 <vprintfmt+0x14>
+}
+  80227a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80227d:	5b                   	pop    %ebx
+  80227e:	5e                   	pop    %esi
+  80227f:	5f                   	pop    %edi
+  802280:	5d                   	pop    %ebp
+  802281:	c3                   	ret
+    padc = ' ';
+  802282:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  802286:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  80228d:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  802294:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  80229b:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  8022a0:	8d 47 01             	lea    0x1(%edi),%eax
+  8022a3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8022a6:	0f b6 17             	movzbl (%edi),%edx
+  8022a9:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8022ac:	3c 55                	cmp    $0x55,%al
+  8022ae:	0f 87 cf 03 00 00    	ja     802683 <vprintfmt+0x437>
+  8022b4:	0f b6 c0             	movzbl %al,%eax
+  8022b7:	ff 24 85 40 31 80 00 	jmp    *0x803140(,%eax,4)
+  8022be:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  8022c1:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8022c5:	eb d9                	jmp    8022a0 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  8022c7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8022ca:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8022ce:	eb d0                	jmp    8022a0 <vprintfmt+0x54>
+  8022d0:	0f b6 d2             	movzbl %dl,%edx
+  8022d3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  8022d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022db:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  8022de:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8022e1:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  8022e5:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  8022e8:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8022eb:	83 f9 09             	cmp    $0x9,%ecx
+  8022ee:	77 55                	ja     802345 <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  8022f0:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  8022f3:	eb e9                	jmp    8022de <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  8022f5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8022f8:	8b 00                	mov    (%eax),%eax
+  8022fa:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8022fd:	8b 45 14             	mov    0x14(%ebp),%eax
+  802300:	8d 40 04             	lea    0x4(%eax),%eax
+  802303:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  802306:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  802309:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80230d:	79 91                	jns    8022a0 <vprintfmt+0x54>
+        width = precision, precision = -1;
+  80230f:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802312:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802315:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80231c:	eb 82                	jmp    8022a0 <vprintfmt+0x54>
+      if (width < 0)
+  80231e:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802321:	85 d2                	test   %edx,%edx
+  802323:	b8 00 00 00 00       	mov    $0x0,%eax
+  802328:	0f 49 c2             	cmovns %edx,%eax
+  80232b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  80232e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  802331:	e9 6a ff ff ff       	jmp    8022a0 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  802336:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  802339:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  802340:	e9 5b ff ff ff       	jmp    8022a0 <vprintfmt+0x54>
+  802345:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802348:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80234b:	eb bc                	jmp    802309 <vprintfmt+0xbd>
+      lflag++;
+  80234d:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  802350:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  802353:	e9 48 ff ff ff       	jmp    8022a0 <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  802358:	8b 45 14             	mov    0x14(%ebp),%eax
+  80235b:	8d 78 04             	lea    0x4(%eax),%edi
+  80235e:	83 ec 08             	sub    $0x8,%esp
+  802361:	53                   	push   %ebx
+  802362:	ff 30                	push   (%eax)
+  802364:	ff d6                	call   *%esi
+      break;
+  802366:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  802369:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  80236c:	e9 b1 02 00 00       	jmp    802622 <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  802371:	8b 45 14             	mov    0x14(%ebp),%eax
+  802374:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  802377:	8b 10                	mov    (%eax),%edx
+  802379:	89 d0                	mov    %edx,%eax
+  80237b:	f7 d8                	neg    %eax
+  80237d:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  802380:	83 f8 10             	cmp    $0x10,%eax
+  802383:	7f 23                	jg     8023a8 <vprintfmt+0x15c>
+  802385:	8b 14 85 a0 32 80 00 	mov    0x8032a0(,%eax,4),%edx
+  80238c:	85 d2                	test   %edx,%edx
+  80238e:	74 18                	je     8023a8 <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  802390:	52                   	push   %edx
+  802391:	68 5e 2f 80 00       	push   $0x802f5e
+  802396:	53                   	push   %ebx
+  802397:	56                   	push   %esi
+  802398:	e8 92 fe ff ff       	call   80222f <printfmt>
+  80239d:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  8023a0:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8023a3:	e9 7a 02 00 00       	jmp    802622 <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  8023a8:	50                   	push   %eax
+  8023a9:	68 03 30 80 00       	push   $0x803003
+  8023ae:	53                   	push   %ebx
+  8023af:	56                   	push   %esi
+  8023b0:	e8 7a fe ff ff       	call   80222f <printfmt>
+  8023b5:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  8023b8:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  8023bb:	e9 62 02 00 00       	jmp    802622 <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  8023c0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8023c3:	83 c0 04             	add    $0x4,%eax
+  8023c6:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8023c9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8023cc:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  8023ce:	85 c9                	test   %ecx,%ecx
+  8023d0:	b8 fc 2f 80 00       	mov    $0x802ffc,%eax
+  8023d5:	0f 45 c1             	cmovne %ecx,%eax
+  8023d8:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  8023db:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8023df:	7e 06                	jle    8023e7 <vprintfmt+0x19b>
+  8023e1:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8023e5:	75 0b                	jne    8023f2 <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8023e7:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8023ea:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8023ed:	89 75 08             	mov    %esi,0x8(%ebp)
+  8023f0:	eb 5c                	jmp    80244e <vprintfmt+0x202>
+  8023f2:	83 ec 08             	sub    $0x8,%esp
+  8023f5:	ff 75 d0             	push   -0x30(%ebp)
+  8023f8:	ff 75 cc             	push   -0x34(%ebp)
+  8023fb:	e8 20 03 00 00       	call   802720 <strnlen>
+  802400:	89 c2                	mov    %eax,%edx
+  802402:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802405:	29 d0                	sub    %edx,%eax
+  802407:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  80240a:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80240e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802411:	89 75 08             	mov    %esi,0x8(%ebp)
+  802414:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  802416:	eb 0e                	jmp    802426 <vprintfmt+0x1da>
+          putch(padc, putdat);
+  802418:	83 ec 08             	sub    $0x8,%esp
+  80241b:	53                   	push   %ebx
+  80241c:	57                   	push   %edi
+  80241d:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  802420:	83 ee 01             	sub    $0x1,%esi
+  802423:	83 c4 10             	add    $0x10,%esp
+  802426:	85 f6                	test   %esi,%esi
+  802428:	7f ee                	jg     802418 <vprintfmt+0x1cc>
+  80242a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80242d:	8b 75 08             	mov    0x8(%ebp),%esi
+  802430:	85 c0                	test   %eax,%eax
+  802432:	ba 00 00 00 00       	mov    $0x0,%edx
+  802437:	0f 49 d0             	cmovns %eax,%edx
+  80243a:	29 d0                	sub    %edx,%eax
+  80243c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80243f:	eb a6                	jmp    8023e7 <vprintfmt+0x19b>
+          putch(ch, putdat);
+  802441:	83 ec 08             	sub    $0x8,%esp
+  802444:	53                   	push   %ebx
+  802445:	52                   	push   %edx
+  802446:	ff 55 08             	call   *0x8(%ebp)
+  802449:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80244c:	89 f1                	mov    %esi,%ecx
+  80244e:	8d 71 01             	lea    0x1(%ecx),%esi
+  802451:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  802455:	0f be d0             	movsbl %al,%edx
+  802458:	85 d2                	test   %edx,%edx
+  80245a:	74 28                	je     802484 <vprintfmt+0x238>
+  80245c:	85 ff                	test   %edi,%edi
+  80245e:	78 05                	js     802465 <vprintfmt+0x219>
+  802460:	83 ef 01             	sub    $0x1,%edi
+  802463:	78 30                	js     802495 <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  802465:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  802469:	74 d6                	je     802441 <vprintfmt+0x1f5>
+  80246b:	0f be c0             	movsbl %al,%eax
+  80246e:	83 e8 20             	sub    $0x20,%eax
+  802471:	83 f8 5e             	cmp    $0x5e,%eax
+  802474:	76 cb                	jbe    802441 <vprintfmt+0x1f5>
+          putch('?', putdat);
+  802476:	83 ec 08             	sub    $0x8,%esp
+  802479:	53                   	push   %ebx
+  80247a:	6a 3f                	push   $0x3f
+  80247c:	ff 55 08             	call   *0x8(%ebp)
+  80247f:	83 c4 10             	add    $0x10,%esp
+  802482:	eb c8                	jmp    80244c <vprintfmt+0x200>
+  802484:	8b 75 08             	mov    0x8(%ebp),%esi
+  802487:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80248a:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80248d:	01 d0                	add    %edx,%eax
+  80248f:	29 c8                	sub    %ecx,%eax
+  802491:	89 c7                	mov    %eax,%edi
+  802493:	eb 13                	jmp    8024a8 <vprintfmt+0x25c>
+  802495:	8b 75 08             	mov    0x8(%ebp),%esi
+  802498:	eb ed                	jmp    802487 <vprintfmt+0x23b>
+        putch(' ', putdat);
+  80249a:	83 ec 08             	sub    $0x8,%esp
+  80249d:	53                   	push   %ebx
+  80249e:	6a 20                	push   $0x20
+  8024a0:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  8024a2:	83 ef 01             	sub    $0x1,%edi
+  8024a5:	83 c4 10             	add    $0x10,%esp
+  8024a8:	85 ff                	test   %edi,%edi
+  8024aa:	7f ee                	jg     80249a <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  8024ac:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8024af:	89 45 14             	mov    %eax,0x14(%ebp)
+  8024b2:	e9 6b 01 00 00       	jmp    802622 <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  8024b7:	83 f9 01             	cmp    $0x1,%ecx
+  8024ba:	7f 1f                	jg     8024db <vprintfmt+0x28f>
+  else if (lflag)
+  8024bc:	85 c9                	test   %ecx,%ecx
+  8024be:	74 67                	je     802527 <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  8024c0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024c3:	8b 00                	mov    (%eax),%eax
+  8024c5:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8024c8:	89 c1                	mov    %eax,%ecx
+  8024ca:	c1 f9 1f             	sar    $0x1f,%ecx
+  8024cd:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8024d0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024d3:	8d 40 04             	lea    0x4(%eax),%eax
+  8024d6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8024d9:	eb 17                	jmp    8024f2 <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  8024db:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024de:	8b 50 04             	mov    0x4(%eax),%edx
+  8024e1:	8b 00                	mov    (%eax),%eax
+  8024e3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8024e6:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8024e9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024ec:	8d 40 08             	lea    0x8(%eax),%eax
+  8024ef:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  8024f2:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8024f5:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  8024f8:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  8024fd:	85 c9                	test   %ecx,%ecx
+  8024ff:	0f 89 03 01 00 00    	jns    802608 <vprintfmt+0x3bc>
+        putch('-', putdat);
+  802505:	83 ec 08             	sub    $0x8,%esp
+  802508:	53                   	push   %ebx
+  802509:	6a 2d                	push   $0x2d
+  80250b:	ff d6                	call   *%esi
+        num = -(long long)num;
+  80250d:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802510:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802513:	f7 da                	neg    %edx
+  802515:	83 d1 00             	adc    $0x0,%ecx
+  802518:	f7 d9                	neg    %ecx
+  80251a:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  80251d:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802522:	e9 e1 00 00 00       	jmp    802608 <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  802527:	8b 45 14             	mov    0x14(%ebp),%eax
+  80252a:	8b 00                	mov    (%eax),%eax
+  80252c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80252f:	89 c1                	mov    %eax,%ecx
+  802531:	c1 f9 1f             	sar    $0x1f,%ecx
+  802534:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802537:	8b 45 14             	mov    0x14(%ebp),%eax
+  80253a:	8d 40 04             	lea    0x4(%eax),%eax
+  80253d:	89 45 14             	mov    %eax,0x14(%ebp)
+  802540:	eb b0                	jmp    8024f2 <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  802542:	83 f9 01             	cmp    $0x1,%ecx
+  802545:	7f 1e                	jg     802565 <vprintfmt+0x319>
+  else if (lflag)
+  802547:	85 c9                	test   %ecx,%ecx
+  802549:	74 32                	je     80257d <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  80254b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80254e:	8b 10                	mov    (%eax),%edx
+  802550:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802555:	8d 40 04             	lea    0x4(%eax),%eax
+  802558:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  80255b:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  802560:	e9 a3 00 00 00       	jmp    802608 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  802565:	8b 45 14             	mov    0x14(%ebp),%eax
+  802568:	8b 10                	mov    (%eax),%edx
+  80256a:	8b 48 04             	mov    0x4(%eax),%ecx
+  80256d:	8d 40 08             	lea    0x8(%eax),%eax
+  802570:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  802573:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  802578:	e9 8b 00 00 00       	jmp    802608 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  80257d:	8b 45 14             	mov    0x14(%ebp),%eax
+  802580:	8b 10                	mov    (%eax),%edx
+  802582:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802587:	8d 40 04             	lea    0x4(%eax),%eax
+  80258a:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  80258d:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  802592:	eb 74                	jmp    802608 <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  802594:	83 f9 01             	cmp    $0x1,%ecx
+  802597:	7f 1b                	jg     8025b4 <vprintfmt+0x368>
+  else if (lflag)
+  802599:	85 c9                	test   %ecx,%ecx
+  80259b:	74 2c                	je     8025c9 <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  80259d:	8b 45 14             	mov    0x14(%ebp),%eax
+  8025a0:	8b 10                	mov    (%eax),%edx
+  8025a2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025a7:	8d 40 04             	lea    0x4(%eax),%eax
+  8025aa:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8025ad:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  8025b2:	eb 54                	jmp    802608 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  8025b4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8025b7:	8b 10                	mov    (%eax),%edx
+  8025b9:	8b 48 04             	mov    0x4(%eax),%ecx
+  8025bc:	8d 40 08             	lea    0x8(%eax),%eax
+  8025bf:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8025c2:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  8025c7:	eb 3f                	jmp    802608 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8025c9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8025cc:	8b 10                	mov    (%eax),%edx
+  8025ce:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025d3:	8d 40 04             	lea    0x4(%eax),%eax
+  8025d6:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8025d9:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  8025de:	eb 28                	jmp    802608 <vprintfmt+0x3bc>
+      putch('0', putdat);
+  8025e0:	83 ec 08             	sub    $0x8,%esp
+  8025e3:	53                   	push   %ebx
+  8025e4:	6a 30                	push   $0x30
+  8025e6:	ff d6                	call   *%esi
+      putch('x', putdat);
+  8025e8:	83 c4 08             	add    $0x8,%esp
+  8025eb:	53                   	push   %ebx
+  8025ec:	6a 78                	push   $0x78
+  8025ee:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  8025f0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8025f3:	8b 10                	mov    (%eax),%edx
+  8025f5:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  8025fa:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  8025fd:	8d 40 04             	lea    0x4(%eax),%eax
+  802600:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  802603:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  802608:	83 ec 0c             	sub    $0xc,%esp
+  80260b:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80260f:	50                   	push   %eax
+  802610:	ff 75 e0             	push   -0x20(%ebp)
+  802613:	57                   	push   %edi
+  802614:	51                   	push   %ecx
+  802615:	52                   	push   %edx
+  802616:	89 da                	mov    %ebx,%edx
+  802618:	89 f0                	mov    %esi,%eax
+  80261a:	e8 4a fb ff ff       	call   802169 <printnum>
+      break;
+  80261f:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  802622:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  802625:	e9 40 fc ff ff       	jmp    80226a <vprintfmt+0x1e>
+  if (lflag >= 2)
+  80262a:	83 f9 01             	cmp    $0x1,%ecx
+  80262d:	7f 1b                	jg     80264a <vprintfmt+0x3fe>
+  else if (lflag)
+  80262f:	85 c9                	test   %ecx,%ecx
+  802631:	74 2c                	je     80265f <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  802633:	8b 45 14             	mov    0x14(%ebp),%eax
+  802636:	8b 10                	mov    (%eax),%edx
+  802638:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80263d:	8d 40 04             	lea    0x4(%eax),%eax
+  802640:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  802643:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  802648:	eb be                	jmp    802608 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  80264a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80264d:	8b 10                	mov    (%eax),%edx
+  80264f:	8b 48 04             	mov    0x4(%eax),%ecx
+  802652:	8d 40 08             	lea    0x8(%eax),%eax
+  802655:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  802658:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  80265d:	eb a9                	jmp    802608 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  80265f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802662:	8b 10                	mov    (%eax),%edx
+  802664:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802669:	8d 40 04             	lea    0x4(%eax),%eax
+  80266c:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  80266f:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  802674:	eb 92                	jmp    802608 <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  802676:	83 ec 08             	sub    $0x8,%esp
+  802679:	53                   	push   %ebx
+  80267a:	6a 25                	push   $0x25
+  80267c:	ff d6                	call   *%esi
+      break;
+  80267e:	83 c4 10             	add    $0x10,%esp
+  802681:	eb 9f                	jmp    802622 <vprintfmt+0x3d6>
+      putch('%', putdat);
+  802683:	83 ec 08             	sub    $0x8,%esp
+  802686:	53                   	push   %ebx
+  802687:	6a 25                	push   $0x25
+  802689:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  80268b:	83 c4 10             	add    $0x10,%esp
+  80268e:	89 f8                	mov    %edi,%eax
+  802690:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  802694:	74 05                	je     80269b <vprintfmt+0x44f>
+  802696:	83 e8 01             	sub    $0x1,%eax
+  802699:	eb f5                	jmp    802690 <vprintfmt+0x444>
+  80269b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80269e:	eb 82                	jmp    802622 <vprintfmt+0x3d6>
+
+008026a0 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8026a0:	55                   	push   %ebp
+  8026a1:	89 e5                	mov    %esp,%ebp
+  8026a3:	83 ec 18             	sub    $0x18,%esp
+  8026a6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026a9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  8026ac:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8026af:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8026b3:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8026b6:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  8026bd:	85 c0                	test   %eax,%eax
+  8026bf:	74 26                	je     8026e7 <vsnprintf+0x47>
+  8026c1:	85 d2                	test   %edx,%edx
+  8026c3:	7e 22                	jle    8026e7 <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8026c5:	ff 75 14             	push   0x14(%ebp)
+  8026c8:	ff 75 10             	push   0x10(%ebp)
+  8026cb:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8026ce:	50                   	push   %eax
+  8026cf:	68 12 22 80 00       	push   $0x802212
+  8026d4:	e8 73 fb ff ff       	call   80224c <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  8026d9:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8026dc:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  8026df:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026e2:	83 c4 10             	add    $0x10,%esp
+}
+  8026e5:	c9                   	leave
+  8026e6:	c3                   	ret
+    return -E_INVAL;
+  8026e7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026ec:	eb f7                	jmp    8026e5 <vsnprintf+0x45>
+
+008026ee <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8026ee:	55                   	push   %ebp
+  8026ef:	89 e5                	mov    %esp,%ebp
+  8026f1:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  8026f4:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  8026f7:	50                   	push   %eax
+  8026f8:	ff 75 10             	push   0x10(%ebp)
+  8026fb:	ff 75 0c             	push   0xc(%ebp)
+  8026fe:	ff 75 08             	push   0x8(%ebp)
+  802701:	e8 9a ff ff ff       	call   8026a0 <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  802706:	c9                   	leave
+  802707:	c3                   	ret
+
+00802708 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  802708:	55                   	push   %ebp
+  802709:	89 e5                	mov    %esp,%ebp
+  80270b:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  80270e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802713:	eb 03                	jmp    802718 <strlen+0x10>
+    n++;
+  802715:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  802718:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80271c:	75 f7                	jne    802715 <strlen+0xd>
+  return n;
+}
+  80271e:	5d                   	pop    %ebp
+  80271f:	c3                   	ret
+
+00802720 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  802720:	55                   	push   %ebp
+  802721:	89 e5                	mov    %esp,%ebp
+  802723:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  802726:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802729:	b8 00 00 00 00       	mov    $0x0,%eax
+  80272e:	eb 03                	jmp    802733 <strnlen+0x13>
+    n++;
+  802730:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  802733:	39 d0                	cmp    %edx,%eax
+  802735:	74 08                	je     80273f <strnlen+0x1f>
+  802737:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80273b:	75 f3                	jne    802730 <strnlen+0x10>
+  80273d:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  80273f:	89 d0                	mov    %edx,%eax
+  802741:	5d                   	pop    %ebp
+  802742:	c3                   	ret
+
+00802743 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  802743:	55                   	push   %ebp
+  802744:	89 e5                	mov    %esp,%ebp
+  802746:	53                   	push   %ebx
+  802747:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80274a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  80274d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802752:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  802756:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  802759:	83 c0 01             	add    $0x1,%eax
+  80275c:	84 d2                	test   %dl,%dl
+  80275e:	75 f2                	jne    802752 <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  802760:	89 c8                	mov    %ecx,%eax
+  802762:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802765:	c9                   	leave
+  802766:	c3                   	ret
+
+00802767 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  802767:	55                   	push   %ebp
+  802768:	89 e5                	mov    %esp,%ebp
+  80276a:	53                   	push   %ebx
+  80276b:	83 ec 10             	sub    $0x10,%esp
+  80276e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  802771:	53                   	push   %ebx
+  802772:	e8 91 ff ff ff       	call   802708 <strlen>
+  802777:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  80277a:	ff 75 0c             	push   0xc(%ebp)
+  80277d:	01 d8                	add    %ebx,%eax
+  80277f:	50                   	push   %eax
+  802780:	e8 be ff ff ff       	call   802743 <strcpy>
+  return dst;
+}
+  802785:	89 d8                	mov    %ebx,%eax
+  802787:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80278a:	c9                   	leave
+  80278b:	c3                   	ret
+
+0080278c <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  80278c:	55                   	push   %ebp
+  80278d:	89 e5                	mov    %esp,%ebp
+  80278f:	56                   	push   %esi
+  802790:	53                   	push   %ebx
+  802791:	8b 75 08             	mov    0x8(%ebp),%esi
+  802794:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  802797:	89 f3                	mov    %esi,%ebx
+  802799:	03 5d 10             	add    0x10(%ebp),%ebx
+  80279c:	89 f0                	mov    %esi,%eax
+  80279e:	eb 0f                	jmp    8027af <strncpy+0x23>
+    *dst++ = *src;
+  8027a0:	83 c0 01             	add    $0x1,%eax
+  8027a3:	0f b6 0a             	movzbl (%edx),%ecx
+  8027a6:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  8027a9:	80 f9 01             	cmp    $0x1,%cl
+  8027ac:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  8027af:	39 d8                	cmp    %ebx,%eax
+  8027b1:	75 ed                	jne    8027a0 <strncpy+0x14>
+  }
+  return ret;
+}
+  8027b3:	89 f0                	mov    %esi,%eax
+  8027b5:	5b                   	pop    %ebx
+  8027b6:	5e                   	pop    %esi
+  8027b7:	5d                   	pop    %ebp
+  8027b8:	c3                   	ret
+
+008027b9 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8027b9:	55                   	push   %ebp
+  8027ba:	89 e5                	mov    %esp,%ebp
+  8027bc:	56                   	push   %esi
+  8027bd:	53                   	push   %ebx
+  8027be:	8b 75 08             	mov    0x8(%ebp),%esi
+  8027c1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8027c4:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  8027c7:	89 f0                	mov    %esi,%eax
+  8027c9:	85 d2                	test   %edx,%edx
+  8027cb:	74 21                	je     8027ee <strlcpy+0x35>
+  8027cd:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8027d1:	89 f2                	mov    %esi,%edx
+  8027d3:	eb 09                	jmp    8027de <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  8027d5:	83 c1 01             	add    $0x1,%ecx
+  8027d8:	83 c2 01             	add    $0x1,%edx
+  8027db:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  8027de:	39 c2                	cmp    %eax,%edx
+  8027e0:	74 09                	je     8027eb <strlcpy+0x32>
+  8027e2:	0f b6 19             	movzbl (%ecx),%ebx
+  8027e5:	84 db                	test   %bl,%bl
+  8027e7:	75 ec                	jne    8027d5 <strlcpy+0x1c>
+  8027e9:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  8027eb:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  8027ee:	29 f0                	sub    %esi,%eax
+}
+  8027f0:	5b                   	pop    %ebx
+  8027f1:	5e                   	pop    %esi
+  8027f2:	5d                   	pop    %ebp
+  8027f3:	c3                   	ret
+
+008027f4 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8027f4:	55                   	push   %ebp
+  8027f5:	89 e5                	mov    %esp,%ebp
+  8027f7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8027fa:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  8027fd:	eb 06                	jmp    802805 <strcmp+0x11>
+    p++, q++;
+  8027ff:	83 c1 01             	add    $0x1,%ecx
+  802802:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  802805:	0f b6 01             	movzbl (%ecx),%eax
+  802808:	84 c0                	test   %al,%al
+  80280a:	74 04                	je     802810 <strcmp+0x1c>
+  80280c:	3a 02                	cmp    (%edx),%al
+  80280e:	74 ef                	je     8027ff <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  802810:	0f b6 c0             	movzbl %al,%eax
+  802813:	0f b6 12             	movzbl (%edx),%edx
+  802816:	29 d0                	sub    %edx,%eax
+}
+  802818:	5d                   	pop    %ebp
+  802819:	c3                   	ret
+
+0080281a <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80281a:	55                   	push   %ebp
+  80281b:	89 e5                	mov    %esp,%ebp
+  80281d:	53                   	push   %ebx
+  80281e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802821:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802824:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  802827:	eb 09                	jmp    802832 <strncmp+0x18>
+    n--, p++, q++;
+  802829:	83 ea 01             	sub    $0x1,%edx
+  80282c:	83 c0 01             	add    $0x1,%eax
+  80282f:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  802832:	85 d2                	test   %edx,%edx
+  802834:	74 18                	je     80284e <strncmp+0x34>
+  802836:	0f b6 18             	movzbl (%eax),%ebx
+  802839:	84 db                	test   %bl,%bl
+  80283b:	74 04                	je     802841 <strncmp+0x27>
+  80283d:	3a 19                	cmp    (%ecx),%bl
+  80283f:	74 e8                	je     802829 <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802841:	0f b6 00             	movzbl (%eax),%eax
+  802844:	0f b6 11             	movzbl (%ecx),%edx
+  802847:	29 d0                	sub    %edx,%eax
+}
+  802849:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80284c:	c9                   	leave
+  80284d:	c3                   	ret
+    return 0;
+  80284e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802853:	eb f4                	jmp    802849 <strncmp+0x2f>
+
+00802855 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  802855:	55                   	push   %ebp
+  802856:	89 e5                	mov    %esp,%ebp
+  802858:	8b 45 08             	mov    0x8(%ebp),%eax
+  80285b:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  80285f:	eb 03                	jmp    802864 <strchr+0xf>
+  802861:	83 c0 01             	add    $0x1,%eax
+  802864:	0f b6 10             	movzbl (%eax),%edx
+  802867:	84 d2                	test   %dl,%dl
+  802869:	74 06                	je     802871 <strchr+0x1c>
+    if (*s == c)
+  80286b:	38 ca                	cmp    %cl,%dl
+  80286d:	75 f2                	jne    802861 <strchr+0xc>
+  80286f:	eb 05                	jmp    802876 <strchr+0x21>
+      return (char*)s;
+  return 0;
+  802871:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802876:	5d                   	pop    %ebp
+  802877:	c3                   	ret
+
+00802878 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  802878:	55                   	push   %ebp
+  802879:	89 e5                	mov    %esp,%ebp
+  80287b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80287e:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  802882:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  802885:	38 ca                	cmp    %cl,%dl
+  802887:	74 09                	je     802892 <strfind+0x1a>
+  802889:	84 d2                	test   %dl,%dl
+  80288b:	74 05                	je     802892 <strfind+0x1a>
+  for (; *s; s++)
+  80288d:	83 c0 01             	add    $0x1,%eax
+  802890:	eb f0                	jmp    802882 <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  802892:	5d                   	pop    %ebp
+  802893:	c3                   	ret
+
+00802894 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  802894:	55                   	push   %ebp
+  802895:	89 e5                	mov    %esp,%ebp
+  802897:	57                   	push   %edi
+  802898:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80289b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  80289e:	85 c9                	test   %ecx,%ecx
+  8028a0:	74 20                	je     8028c2 <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  8028a2:	89 f8                	mov    %edi,%eax
+  8028a4:	09 c8                	or     %ecx,%eax
+  8028a6:	a8 03                	test   $0x3,%al
+  8028a8:	75 12                	jne    8028bc <memset+0x28>
+    c &= 0xFF;
+  8028aa:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8028ae:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  8028b4:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  8028b7:	fc                   	cld
+  8028b8:	f3 ab                	rep stos %eax,%es:(%edi)
+  8028ba:	eb 06                	jmp    8028c2 <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  8028bc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8028bf:	fc                   	cld
+  8028c0:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  8028c2:	89 f8                	mov    %edi,%eax
+  8028c4:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8028c7:	c9                   	leave
+  8028c8:	c3                   	ret
+
+008028c9 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8028c9:	55                   	push   %ebp
+  8028ca:	89 e5                	mov    %esp,%ebp
+  8028cc:	57                   	push   %edi
+  8028cd:	56                   	push   %esi
+  8028ce:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028d1:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8028d4:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  8028d7:	39 c6                	cmp    %eax,%esi
+  8028d9:	73 32                	jae    80290d <memmove+0x44>
+  8028db:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8028de:	39 d0                	cmp    %edx,%eax
+  8028e0:	73 2b                	jae    80290d <memmove+0x44>
+    s += n;
+    d += n;
+  8028e2:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8028e5:	89 d6                	mov    %edx,%esi
+  8028e7:	09 fe                	or     %edi,%esi
+  8028e9:	09 ce                	or     %ecx,%esi
+  8028eb:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8028f1:	75 0e                	jne    802901 <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8028f3:	83 ef 04             	sub    $0x4,%edi
+  8028f6:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8028f9:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  8028fc:	fd                   	std
+  8028fd:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8028ff:	eb 09                	jmp    80290a <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  802901:	83 ef 01             	sub    $0x1,%edi
+  802904:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  802907:	fd                   	std
+  802908:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  80290a:	fc                   	cld
+  80290b:	eb 1a                	jmp    802927 <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80290d:	89 f2                	mov    %esi,%edx
+  80290f:	09 c2                	or     %eax,%edx
+  802911:	09 ca                	or     %ecx,%edx
+  802913:	f6 c2 03             	test   $0x3,%dl
+  802916:	75 0a                	jne    802922 <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  802918:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  80291b:	89 c7                	mov    %eax,%edi
+  80291d:	fc                   	cld
+  80291e:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  802920:	eb 05                	jmp    802927 <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  802922:	89 c7                	mov    %eax,%edi
+  802924:	fc                   	cld
+  802925:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  802927:	5e                   	pop    %esi
+  802928:	5f                   	pop    %edi
+  802929:	5d                   	pop    %ebp
+  80292a:	c3                   	ret
+
+0080292b <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  80292b:	55                   	push   %ebp
+  80292c:	89 e5                	mov    %esp,%ebp
+  80292e:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  802931:	ff 75 10             	push   0x10(%ebp)
+  802934:	ff 75 0c             	push   0xc(%ebp)
+  802937:	ff 75 08             	push   0x8(%ebp)
+  80293a:	e8 8a ff ff ff       	call   8028c9 <memmove>
+}
+  80293f:	c9                   	leave
+  802940:	c3                   	ret
+
+00802941 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  802941:	55                   	push   %ebp
+  802942:	89 e5                	mov    %esp,%ebp
+  802944:	56                   	push   %esi
+  802945:	53                   	push   %ebx
+  802946:	8b 45 08             	mov    0x8(%ebp),%eax
+  802949:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  80294c:	89 c6                	mov    %eax,%esi
+  80294e:	03 75 10             	add    0x10(%ebp),%esi
+  802951:	eb 06                	jmp    802959 <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  802953:	83 c0 01             	add    $0x1,%eax
+  802956:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  802959:	39 f0                	cmp    %esi,%eax
+  80295b:	74 14                	je     802971 <memcmp+0x30>
+    if (*s1 != *s2)
+  80295d:	0f b6 08             	movzbl (%eax),%ecx
+  802960:	0f b6 1a             	movzbl (%edx),%ebx
+  802963:	38 d9                	cmp    %bl,%cl
+  802965:	74 ec                	je     802953 <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  802967:	0f b6 c1             	movzbl %cl,%eax
+  80296a:	0f b6 db             	movzbl %bl,%ebx
+  80296d:	29 d8                	sub    %ebx,%eax
+  80296f:	eb 05                	jmp    802976 <memcmp+0x35>
+  }
+
+  return 0;
+  802971:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802976:	5b                   	pop    %ebx
+  802977:	5e                   	pop    %esi
+  802978:	5d                   	pop    %ebp
+  802979:	c3                   	ret
+
+0080297a <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  80297a:	55                   	push   %ebp
+  80297b:	89 e5                	mov    %esp,%ebp
+  80297d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802980:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  802983:	89 c2                	mov    %eax,%edx
+  802985:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  802988:	eb 03                	jmp    80298d <memfind+0x13>
+  80298a:	83 c0 01             	add    $0x1,%eax
+  80298d:	39 d0                	cmp    %edx,%eax
+  80298f:	73 04                	jae    802995 <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  802991:	38 08                	cmp    %cl,(%eax)
+  802993:	75 f5                	jne    80298a <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  802995:	5d                   	pop    %ebp
+  802996:	c3                   	ret
+
+00802997 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  802997:	55                   	push   %ebp
+  802998:	89 e5                	mov    %esp,%ebp
+  80299a:	57                   	push   %edi
+  80299b:	56                   	push   %esi
+  80299c:	53                   	push   %ebx
+  80299d:	8b 55 08             	mov    0x8(%ebp),%edx
+  8029a0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  8029a3:	eb 03                	jmp    8029a8 <strtol+0x11>
+    s++;
+  8029a5:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  8029a8:	0f b6 02             	movzbl (%edx),%eax
+  8029ab:	3c 20                	cmp    $0x20,%al
+  8029ad:	74 f6                	je     8029a5 <strtol+0xe>
+  8029af:	3c 09                	cmp    $0x9,%al
+  8029b1:	74 f2                	je     8029a5 <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  8029b3:	3c 2b                	cmp    $0x2b,%al
+  8029b5:	74 2a                	je     8029e1 <strtol+0x4a>
+  int neg = 0;
+  8029b7:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  8029bc:	3c 2d                	cmp    $0x2d,%al
+  8029be:	74 2b                	je     8029eb <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8029c0:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8029c6:	75 0f                	jne    8029d7 <strtol+0x40>
+  8029c8:	80 3a 30             	cmpb   $0x30,(%edx)
+  8029cb:	74 28                	je     8029f5 <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  8029cd:	85 db                	test   %ebx,%ebx
+  8029cf:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8029d4:	0f 44 d8             	cmove  %eax,%ebx
+  8029d7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8029dc:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8029df:	eb 46                	jmp    802a27 <strtol+0x90>
+    s++;
+  8029e1:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  8029e4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029e9:	eb d5                	jmp    8029c0 <strtol+0x29>
+    s++, neg = 1;
+  8029eb:	83 c2 01             	add    $0x1,%edx
+  8029ee:	bf 01 00 00 00       	mov    $0x1,%edi
+  8029f3:	eb cb                	jmp    8029c0 <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8029f5:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8029f9:	74 0e                	je     802a09 <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  8029fb:	85 db                	test   %ebx,%ebx
+  8029fd:	75 d8                	jne    8029d7 <strtol+0x40>
+    s++, base = 8;
+  8029ff:	83 c2 01             	add    $0x1,%edx
+  802a02:	bb 08 00 00 00       	mov    $0x8,%ebx
+  802a07:	eb ce                	jmp    8029d7 <strtol+0x40>
+    s += 2, base = 16;
+  802a09:	83 c2 02             	add    $0x2,%edx
+  802a0c:	bb 10 00 00 00       	mov    $0x10,%ebx
+  802a11:	eb c4                	jmp    8029d7 <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  802a13:	0f be c0             	movsbl %al,%eax
+  802a16:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  802a19:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802a1c:	7d 3a                	jge    802a58 <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  802a1e:	83 c2 01             	add    $0x1,%edx
+  802a21:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  802a25:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  802a27:	0f b6 02             	movzbl (%edx),%eax
+  802a2a:	8d 70 d0             	lea    -0x30(%eax),%esi
+  802a2d:	89 f3                	mov    %esi,%ebx
+  802a2f:	80 fb 09             	cmp    $0x9,%bl
+  802a32:	76 df                	jbe    802a13 <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  802a34:	8d 70 9f             	lea    -0x61(%eax),%esi
+  802a37:	89 f3                	mov    %esi,%ebx
+  802a39:	80 fb 19             	cmp    $0x19,%bl
+  802a3c:	77 08                	ja     802a46 <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  802a3e:	0f be c0             	movsbl %al,%eax
+  802a41:	83 e8 57             	sub    $0x57,%eax
+  802a44:	eb d3                	jmp    802a19 <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  802a46:	8d 70 bf             	lea    -0x41(%eax),%esi
+  802a49:	89 f3                	mov    %esi,%ebx
+  802a4b:	80 fb 19             	cmp    $0x19,%bl
+  802a4e:	77 08                	ja     802a58 <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  802a50:	0f be c0             	movsbl %al,%eax
+  802a53:	83 e8 37             	sub    $0x37,%eax
+  802a56:	eb c1                	jmp    802a19 <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  802a58:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802a5c:	74 05                	je     802a63 <strtol+0xcc>
+    *endptr = (char*)s;
+  802a5e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a61:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  802a63:	89 c8                	mov    %ecx,%eax
+  802a65:	f7 d8                	neg    %eax
+  802a67:	85 ff                	test   %edi,%edi
+  802a69:	0f 45 c8             	cmovne %eax,%ecx
+}
+  802a6c:	89 c8                	mov    %ecx,%eax
+  802a6e:	5b                   	pop    %ebx
+  802a6f:	5e                   	pop    %esi
+  802a70:	5f                   	pop    %edi
+  802a71:	5d                   	pop    %ebp
+  802a72:	c3                   	ret
+
+00802a73 <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  802a73:	55                   	push   %ebp
+  802a74:	89 e5                	mov    %esp,%ebp
+  802a76:	57                   	push   %edi
+  802a77:	56                   	push   %esi
+  802a78:	53                   	push   %ebx
+  802a79:	83 ec 14             	sub    $0x14,%esp
+  802a7c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802a7f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a82:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802a85:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  802a88:	85 c0                	test   %eax,%eax
+  802a8a:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802a8f:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  802a92:	ff 33                	push   (%ebx)
+  802a94:	50                   	push   %eax
+  802a95:	e8 f8 d9 ff ff       	call   800492 <sys_ipc_recv>
+  802a9a:	83 c4 10             	add    $0x10,%esp
+  802a9d:	85 c0                	test   %eax,%eax
+  802a9f:	78 39                	js     802ada <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  802aa1:	85 ff                	test   %edi,%edi
+  802aa3:	74 0a                	je     802aaf <ipc_recv_pages+0x3c>
+  802aa5:	a1 44 57 80 00       	mov    0x805744,%eax
+  802aaa:	8b 40 7c             	mov    0x7c(%eax),%eax
+  802aad:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  802aaf:	85 f6                	test   %esi,%esi
+  802ab1:	74 0d                	je     802ac0 <ipc_recv_pages+0x4d>
+  802ab3:	a1 44 57 80 00       	mov    0x805744,%eax
+  802ab8:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  802abe:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  802ac0:	a1 44 57 80 00       	mov    0x805744,%eax
+  802ac5:	8b 40 74             	mov    0x74(%eax),%eax
+  802ac8:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  802aca:	a1 44 57 80 00       	mov    0x805744,%eax
+  802acf:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  802ad2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ad5:	5b                   	pop    %ebx
+  802ad6:	5e                   	pop    %esi
+  802ad7:	5f                   	pop    %edi
+  802ad8:	5d                   	pop    %ebp
+  802ad9:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  802ada:	85 ff                	test   %edi,%edi
+  802adc:	74 06                	je     802ae4 <ipc_recv_pages+0x71>
+  802ade:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  802ae4:	85 f6                	test   %esi,%esi
+  802ae6:	74 06                	je     802aee <ipc_recv_pages+0x7b>
+  802ae8:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  802aee:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  802af4:	eb dc                	jmp    802ad2 <ipc_recv_pages+0x5f>
+
+00802af6 <ipc_recv>:
+{
+  802af6:	55                   	push   %ebp
+  802af7:	89 e5                	mov    %esp,%ebp
+  802af9:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  802afc:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  802b03:	ff 75 10             	push   0x10(%ebp)
+  802b06:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b09:	50                   	push   %eax
+  802b0a:	ff 75 0c             	push   0xc(%ebp)
+  802b0d:	ff 75 08             	push   0x8(%ebp)
+  802b10:	e8 5e ff ff ff       	call   802a73 <ipc_recv_pages>
+}
+  802b15:	c9                   	leave
+  802b16:	c3                   	ret
+
+00802b17 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  802b17:	55                   	push   %ebp
+  802b18:	89 e5                	mov    %esp,%ebp
+  802b1a:	57                   	push   %edi
+  802b1b:	56                   	push   %esi
+  802b1c:	53                   	push   %ebx
+  802b1d:	83 ec 0c             	sub    $0xc,%esp
+  802b20:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802b23:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802b26:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  802b29:	89 c3                	mov    %eax,%ebx
+  802b2b:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  802b31:	85 c0                	test   %eax,%eax
+  802b33:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802b38:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  802b3b:	83 ec 0c             	sub    $0xc,%esp
+  802b3e:	ff 75 14             	push   0x14(%ebp)
+  802b41:	ff 75 18             	push   0x18(%ebp)
+  802b44:	53                   	push   %ebx
+  802b45:	56                   	push   %esi
+  802b46:	57                   	push   %edi
+  802b47:	e8 25 d9 ff ff       	call   800471 <sys_ipc_try_send>
+  802b4c:	83 c4 20             	add    $0x20,%esp
+  802b4f:	85 c0                	test   %eax,%eax
+  802b51:	79 1e                	jns    802b71 <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  802b53:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802b56:	75 07                	jne    802b5f <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  802b58:	e8 fb d5 ff ff       	call   800158 <sys_yield>
+  802b5d:	eb dc                	jmp    802b3b <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  802b5f:	50                   	push   %eax
+  802b60:	68 03 33 80 00       	push   $0x803303
+  802b65:	6a 5c                	push   $0x5c
+  802b67:	68 10 33 80 00       	push   $0x803310
+  802b6c:	e8 09 f5 ff ff       	call   80207a <_panic>
+  }
+}
+  802b71:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b74:	5b                   	pop    %ebx
+  802b75:	5e                   	pop    %esi
+  802b76:	5f                   	pop    %edi
+  802b77:	5d                   	pop    %ebp
+  802b78:	c3                   	ret
+
+00802b79 <ipc_send>:
+{
+  802b79:	55                   	push   %ebp
+  802b7a:	89 e5                	mov    %esp,%ebp
+  802b7c:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  802b7f:	ff 75 14             	push   0x14(%ebp)
+  802b82:	6a 01                	push   $0x1
+  802b84:	ff 75 10             	push   0x10(%ebp)
+  802b87:	ff 75 0c             	push   0xc(%ebp)
+  802b8a:	ff 75 08             	push   0x8(%ebp)
+  802b8d:	e8 85 ff ff ff       	call   802b17 <ipc_send_pages>
+}
+  802b92:	83 c4 20             	add    $0x20,%esp
+  802b95:	c9                   	leave
+  802b96:	c3                   	ret
+
+00802b97 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802b97:	55                   	push   %ebp
+  802b98:	89 e5                	mov    %esp,%ebp
+  802b9a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  802b9d:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  802ba2:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802ba5:	c1 e0 04             	shl    $0x4,%eax
+  802ba8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802bad:	8b 40 50             	mov    0x50(%eax),%eax
+  802bb0:	39 c8                	cmp    %ecx,%eax
+  802bb2:	74 12                	je     802bc6 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  802bb4:	83 c2 01             	add    $0x1,%edx
+  802bb7:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802bbd:	75 e3                	jne    802ba2 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  802bbf:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bc4:	eb 0e                	jmp    802bd4 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  802bc6:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802bc9:	c1 e0 04             	shl    $0x4,%eax
+  802bcc:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802bd1:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802bd4:	5d                   	pop    %ebp
+  802bd5:	c3                   	ret
+
+00802bd6 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802bd6:	55                   	push   %ebp
+  802bd7:	89 e5                	mov    %esp,%ebp
+  802bd9:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802bdc:	89 c2                	mov    %eax,%edx
+  802bde:	c1 ea 16             	shr    $0x16,%edx
+  802be1:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  802be8:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802bed:	f6 c1 01             	test   $0x1,%cl
+  802bf0:	74 1c                	je     802c0e <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  802bf2:	c1 e8 0c             	shr    $0xc,%eax
+  802bf5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  802bfc:	a8 01                	test   $0x1,%al
+  802bfe:	74 0e                	je     802c0e <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  802c00:	c1 e8 0c             	shr    $0xc,%eax
+  802c03:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802c0a:	ef 
+  802c0b:	0f b7 d2             	movzwl %dx,%edx
+}
+  802c0e:	89 d0                	mov    %edx,%eax
+  802c10:	5d                   	pop    %ebp
+  802c11:	c3                   	ret
+
+00802c12 <udivmod>:
+  802c12:	55                   	push   %ebp
+  802c13:	57                   	push   %edi
+  802c14:	56                   	push   %esi
+  802c15:	53                   	push   %ebx
+  802c16:	83 ec 14             	sub    $0x14,%esp
+  802c19:	8b 74 24 28          	mov    0x28(%esp),%esi
+  802c1d:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  802c21:	89 fb                	mov    %edi,%ebx
+  802c23:	09 f3                	or     %esi,%ebx
+  802c25:	0f 84 88 00 00 00    	je     802cb3 <udivmod+0xa1>
+  802c2b:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802c30:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802c37:	00 
+  802c38:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802c3f:	00 
+  802c40:	89 cd                	mov    %ecx,%ebp
+  802c42:	89 34 24             	mov    %esi,(%esp)
+  802c45:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802c49:	eb 08                	jmp    802c53 <udivmod+0x41>
+  802c4b:	83 ed 01             	sub    $0x1,%ebp
+  802c4e:	83 fd ff             	cmp    $0xffffffff,%ebp
+  802c51:	74 6c                	je     802cbf <udivmod+0xad>
+  802c53:	89 c3                	mov    %eax,%ebx
+  802c55:	89 d6                	mov    %edx,%esi
+  802c57:	89 e9                	mov    %ebp,%ecx
+  802c59:	0f ad f3             	shrd   %cl,%esi,%ebx
+  802c5c:	d3 ee                	shr    %cl,%esi
+  802c5e:	f6 c1 20             	test   $0x20,%cl
+  802c61:	74 04                	je     802c67 <udivmod+0x55>
+  802c63:	89 f3                	mov    %esi,%ebx
+  802c65:	31 f6                	xor    %esi,%esi
+  802c67:	8b 3c 24             	mov    (%esp),%edi
+  802c6a:	39 fb                	cmp    %edi,%ebx
+  802c6c:	89 f7                	mov    %esi,%edi
+  802c6e:	8b 1c 24             	mov    (%esp),%ebx
+  802c71:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802c75:	19 f7                	sbb    %esi,%edi
+  802c77:	72 d2                	jb     802c4b <udivmod+0x39>
+  802c79:	89 f7                	mov    %esi,%edi
+  802c7b:	89 de                	mov    %ebx,%esi
+  802c7d:	89 e9                	mov    %ebp,%ecx
+  802c7f:	0f a5 f7             	shld   %cl,%esi,%edi
+  802c82:	d3 e6                	shl    %cl,%esi
+  802c84:	f6 c1 20             	test   $0x20,%cl
+  802c87:	74 04                	je     802c8d <udivmod+0x7b>
+  802c89:	89 f7                	mov    %esi,%edi
+  802c8b:	31 f6                	xor    %esi,%esi
+  802c8d:	29 f0                	sub    %esi,%eax
+  802c8f:	19 fa                	sbb    %edi,%edx
+  802c91:	be 01 00 00 00       	mov    $0x1,%esi
+  802c96:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c9b:	0f a5 f7             	shld   %cl,%esi,%edi
+  802c9e:	d3 e6                	shl    %cl,%esi
+  802ca0:	f6 c1 20             	test   $0x20,%cl
+  802ca3:	74 04                	je     802ca9 <udivmod+0x97>
+  802ca5:	89 f7                	mov    %esi,%edi
+  802ca7:	31 f6                	xor    %esi,%esi
+  802ca9:	09 74 24 08          	or     %esi,0x8(%esp)
+  802cad:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802cb1:	eb 98                	jmp    802c4b <udivmod+0x39>
+  802cb3:	89 f0                	mov    %esi,%eax
+  802cb5:	89 fa                	mov    %edi,%edx
+  802cb7:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802cbb:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802cbf:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802cc3:	89 01                	mov    %eax,(%ecx)
+  802cc5:	89 51 04             	mov    %edx,0x4(%ecx)
+  802cc8:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802ccc:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802cd0:	83 c4 14             	add    $0x14,%esp
+  802cd3:	5b                   	pop    %ebx
+  802cd4:	5e                   	pop    %esi
+  802cd5:	5f                   	pop    %edi
+  802cd6:	5d                   	pop    %ebp
+  802cd7:	c3                   	ret
+
+00802cd8 <__udivdi3>:
+  802cd8:	83 ec 18             	sub    $0x18,%esp
+  802cdb:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802cdf:	50                   	push   %eax
+  802ce0:	ff 74 24 2c          	push   0x2c(%esp)
+  802ce4:	ff 74 24 2c          	push   0x2c(%esp)
+  802ce8:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802cec:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802cf0:	e8 1d ff ff ff       	call   802c12 <udivmod>
+  802cf5:	83 c4 24             	add    $0x24,%esp
+  802cf8:	c3                   	ret
+
+00802cf9 <__umoddi3>:
+  802cf9:	83 ec 18             	sub    $0x18,%esp
+  802cfc:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802d00:	50                   	push   %eax
+  802d01:	ff 74 24 2c          	push   0x2c(%esp)
+  802d05:	ff 74 24 2c          	push   0x2c(%esp)
+  802d09:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802d0d:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802d11:	e8 fc fe ff ff       	call   802c12 <udivmod>
+  802d16:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802d1a:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802d1e:	83 c4 24             	add    $0x24,%esp
+  802d21:	c3                   	ret
+
+00802d22 <__divdi3>:
+  802d22:	56                   	push   %esi
+  802d23:	53                   	push   %ebx
+  802d24:	83 ec 14             	sub    $0x14,%esp
+  802d27:	8b 44 24 20          	mov    0x20(%esp),%eax
+  802d2b:	8b 54 24 24          	mov    0x24(%esp),%edx
+  802d2f:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  802d33:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  802d37:	85 d2                	test   %edx,%edx
+  802d39:	78 18                	js     802d53 <__divdi3+0x31>
+  802d3b:	85 db                	test   %ebx,%ebx
+  802d3d:	78 3e                	js     802d7d <__divdi3+0x5b>
+  802d3f:	83 ec 04             	sub    $0x4,%esp
+  802d42:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802d46:	56                   	push   %esi
+  802d47:	53                   	push   %ebx
+  802d48:	51                   	push   %ecx
+  802d49:	e8 c4 fe ff ff       	call   802c12 <udivmod>
+  802d4e:	83 c4 10             	add    $0x10,%esp
+  802d51:	eb 24                	jmp    802d77 <__divdi3+0x55>
+  802d53:	f7 d8                	neg    %eax
+  802d55:	83 d2 00             	adc    $0x0,%edx
+  802d58:	f7 da                	neg    %edx
+  802d5a:	85 db                	test   %ebx,%ebx
+  802d5c:	78 3a                	js     802d98 <__divdi3+0x76>
+  802d5e:	83 ec 04             	sub    $0x4,%esp
+  802d61:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802d65:	56                   	push   %esi
+  802d66:	53                   	push   %ebx
+  802d67:	51                   	push   %ecx
+  802d68:	e8 a5 fe ff ff       	call   802c12 <udivmod>
+  802d6d:	83 c4 10             	add    $0x10,%esp
+  802d70:	f7 d8                	neg    %eax
+  802d72:	83 d2 00             	adc    $0x0,%edx
+  802d75:	f7 da                	neg    %edx
+  802d77:	83 c4 14             	add    $0x14,%esp
+  802d7a:	5b                   	pop    %ebx
+  802d7b:	5e                   	pop    %esi
+  802d7c:	c3                   	ret
+  802d7d:	83 ec 04             	sub    $0x4,%esp
+  802d80:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802d84:	56                   	push   %esi
+  802d85:	f7 d9                	neg    %ecx
+  802d87:	83 d3 00             	adc    $0x0,%ebx
+  802d8a:	f7 db                	neg    %ebx
+  802d8c:	53                   	push   %ebx
+  802d8d:	51                   	push   %ecx
+  802d8e:	e8 7f fe ff ff       	call   802c12 <udivmod>
+  802d93:	83 c4 10             	add    $0x10,%esp
+  802d96:	eb d8                	jmp    802d70 <__divdi3+0x4e>
+  802d98:	83 ec 04             	sub    $0x4,%esp
+  802d9b:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802d9f:	56                   	push   %esi
+  802da0:	f7 d9                	neg    %ecx
+  802da2:	83 d3 00             	adc    $0x0,%ebx
+  802da5:	f7 db                	neg    %ebx
+  802da7:	53                   	push   %ebx
+  802da8:	51                   	push   %ecx
+  802da9:	e8 64 fe ff ff       	call   802c12 <udivmod>
+  802dae:	83 c4 10             	add    $0x10,%esp
+  802db1:	eb c4                	jmp    802d77 <__divdi3+0x55>
+
+00802db3 <__moddi3>:
+  802db3:	55                   	push   %ebp
+  802db4:	57                   	push   %edi
+  802db5:	56                   	push   %esi
+  802db6:	53                   	push   %ebx
+  802db7:	83 ec 24             	sub    $0x24,%esp
+  802dba:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802dbe:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802dc2:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  802dc6:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  802dca:	85 d2                	test   %edx,%edx
+  802dcc:	78 3b                	js     802e09 <__moddi3+0x56>
+  802dce:	83 ec 04             	sub    $0x4,%esp
+  802dd1:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  802dd5:	56                   	push   %esi
+  802dd6:	89 ce                	mov    %ecx,%esi
+  802dd8:	f7 de                	neg    %esi
+  802dda:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802dde:	89 de                	mov    %ebx,%esi
+  802de0:	83 d6 00             	adc    $0x0,%esi
+  802de3:	f7 de                	neg    %esi
+  802de5:	89 74 24 14          	mov    %esi,0x14(%esp)
+  802de9:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802ded:	0f 48 f1             	cmovs  %ecx,%esi
+  802df0:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  802df5:	53                   	push   %ebx
+  802df6:	56                   	push   %esi
+  802df7:	e8 16 fe ff ff       	call   802c12 <udivmod>
+  802dfc:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802e00:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802e04:	83 c4 10             	add    $0x10,%esp
+  802e07:	eb 47                	jmp    802e50 <__moddi3+0x9d>
+  802e09:	f7 d8                	neg    %eax
+  802e0b:	83 d2 00             	adc    $0x0,%edx
+  802e0e:	f7 da                	neg    %edx
+  802e10:	83 ec 04             	sub    $0x4,%esp
+  802e13:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  802e17:	56                   	push   %esi
+  802e18:	89 cf                	mov    %ecx,%edi
+  802e1a:	f7 df                	neg    %edi
+  802e1c:	89 de                	mov    %ebx,%esi
+  802e1e:	83 d6 00             	adc    $0x0,%esi
+  802e21:	f7 de                	neg    %esi
+  802e23:	0f 49 cf             	cmovns %edi,%ecx
+  802e26:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802e2a:	0f 49 de             	cmovns %esi,%ebx
+  802e2d:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  802e31:	ff 74 24 0c          	push   0xc(%esp)
+  802e35:	ff 74 24 0c          	push   0xc(%esp)
+  802e39:	e8 d4 fd ff ff       	call   802c12 <udivmod>
+  802e3e:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802e42:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802e46:	f7 d8                	neg    %eax
+  802e48:	83 d2 00             	adc    $0x0,%edx
+  802e4b:	f7 da                	neg    %edx
+  802e4d:	83 c4 10             	add    $0x10,%esp
+  802e50:	83 c4 24             	add    $0x24,%esp
+  802e53:	5b                   	pop    %ebx
+  802e54:	5e                   	pop    %esi
+  802e55:	5f                   	pop    %edi
+  802e56:	5d                   	pop    %ebp
+  802e57:	c3                   	ret
@@ -0,0 +1,6655 @@
+
+obj/user/cat.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 fc 00 00 00       	call   80012d <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <cat>:
+// instead of copying it.
+char buf[8192] __attribute__((aligned(PGSIZE)));
+
+void
+cat(int f, char *s)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	8b 75 08             	mov    0x8(%ebp),%esi
+  long n;
+  int r;
+
+  while ((n = read(f, buf, (long)sizeof(buf))) > 0)
+  80003b:	83 ec 04             	sub    $0x4,%esp
+  80003e:	68 00 20 00 00       	push   $0x2000
+  800043:	68 00 60 80 00       	push   $0x806000
+  800048:	56                   	push   %esi
+  800049:	e8 18 14 00 00       	call   801466 <read>
+  80004e:	89 c3                	mov    %eax,%ebx
+  800050:	83 c4 10             	add    $0x10,%esp
+  800053:	85 c0                	test   %eax,%eax
+  800055:	7e 2f                	jle    800086 <cat+0x53>
+    if ((r = write(1, buf, n)) != n)
+  800057:	83 ec 04             	sub    $0x4,%esp
+  80005a:	53                   	push   %ebx
+  80005b:	68 00 60 80 00       	push   $0x806000
+  800060:	6a 01                	push   $0x1
+  800062:	e8 cd 14 00 00       	call   801534 <write>
+  800067:	83 c4 10             	add    $0x10,%esp
+  80006a:	39 c3                	cmp    %eax,%ebx
+  80006c:	74 cd                	je     80003b <cat+0x8>
+      panic("write error copying %s: %e", s, r);
+  80006e:	83 ec 0c             	sub    $0xc,%esp
+  800071:	50                   	push   %eax
+  800072:	ff 75 0c             	push   0xc(%ebp)
+  800075:	68 60 30 80 00       	push   $0x803060
+  80007a:	6a 0f                	push   $0xf
+  80007c:	68 7b 30 80 00       	push   $0x80307b
+  800081:	e8 14 01 00 00       	call   80019a <_panic>
+  if (n < 0)
+  800086:	78 07                	js     80008f <cat+0x5c>
+    panic("error reading %s: %e", s, n);
+}
+  800088:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80008b:	5b                   	pop    %ebx
+  80008c:	5e                   	pop    %esi
+  80008d:	5d                   	pop    %ebp
+  80008e:	c3                   	ret
+    panic("error reading %s: %e", s, n);
+  80008f:	83 ec 0c             	sub    $0xc,%esp
+  800092:	50                   	push   %eax
+  800093:	ff 75 0c             	push   0xc(%ebp)
+  800096:	68 86 30 80 00       	push   $0x803086
+  80009b:	6a 11                	push   $0x11
+  80009d:	68 7b 30 80 00       	push   $0x80307b
+  8000a2:	e8 f3 00 00 00       	call   80019a <_panic>
+
+008000a7 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8000a7:	55                   	push   %ebp
+  8000a8:	89 e5                	mov    %esp,%ebp
+  8000aa:	57                   	push   %edi
+  8000ab:	56                   	push   %esi
+  8000ac:	53                   	push   %ebx
+  8000ad:	83 ec 0c             	sub    $0xc,%esp
+  8000b0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  int f, i;
+
+  binaryname = "cat";
+  8000b3:	c7 05 00 40 80 00 9b 	movl   $0x80309b,0x804000
+  8000ba:	30 80 00 
+  if (argc == 1)
+    cat(0, "<stdin>");
+  else
+    for (i = 1; i < argc; i++) {
+  8000bd:	be 01 00 00 00       	mov    $0x1,%esi
+  if (argc == 1)
+  8000c2:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+  8000c6:	75 31                	jne    8000f9 <umain+0x52>
+    cat(0, "<stdin>");
+  8000c8:	83 ec 08             	sub    $0x8,%esp
+  8000cb:	68 9f 30 80 00       	push   $0x80309f
+  8000d0:	6a 00                	push   $0x0
+  8000d2:	e8 5c ff ff ff       	call   800033 <cat>
+  8000d7:	83 c4 10             	add    $0x10,%esp
+      else {
+        cat(f, argv[i]);
+        close(f);
+      }
+    }
+}
+  8000da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000dd:	5b                   	pop    %ebx
+  8000de:	5e                   	pop    %esi
+  8000df:	5f                   	pop    %edi
+  8000e0:	5d                   	pop    %ebp
+  8000e1:	c3                   	ret
+        printf("can't open %s: %e\n", argv[i], f);
+  8000e2:	83 ec 04             	sub    $0x4,%esp
+  8000e5:	50                   	push   %eax
+  8000e6:	ff 34 b7             	push   (%edi,%esi,4)
+  8000e9:	68 a7 30 80 00       	push   $0x8030a7
+  8000ee:	e8 7d 21 00 00       	call   802270 <printf>
+  8000f3:	83 c4 10             	add    $0x10,%esp
+    for (i = 1; i < argc; i++) {
+  8000f6:	83 c6 01             	add    $0x1,%esi
+  8000f9:	3b 75 08             	cmp    0x8(%ebp),%esi
+  8000fc:	7d dc                	jge    8000da <umain+0x33>
+      f = open(argv[i], O_RDONLY);
+  8000fe:	83 ec 08             	sub    $0x8,%esp
+  800101:	6a 00                	push   $0x0
+  800103:	ff 34 b7             	push   (%edi,%esi,4)
+  800106:	e8 86 1b 00 00       	call   801c91 <open>
+  80010b:	89 c3                	mov    %eax,%ebx
+      if (f < 0)
+  80010d:	83 c4 10             	add    $0x10,%esp
+  800110:	85 c0                	test   %eax,%eax
+  800112:	78 ce                	js     8000e2 <umain+0x3b>
+        cat(f, argv[i]);
+  800114:	83 ec 08             	sub    $0x8,%esp
+  800117:	ff 34 b7             	push   (%edi,%esi,4)
+  80011a:	50                   	push   %eax
+  80011b:	e8 13 ff ff ff       	call   800033 <cat>
+        close(f);
+  800120:	89 1c 24             	mov    %ebx,(%esp)
+  800123:	e8 b6 11 00 00       	call   8012de <close>
+  800128:	83 c4 10             	add    $0x10,%esp
+  80012b:	eb c9                	jmp    8000f6 <umain+0x4f>
+
+0080012d <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80012d:	55                   	push   %ebp
+  80012e:	89 e5                	mov    %esp,%ebp
+  800130:	56                   	push   %esi
+  800131:	53                   	push   %ebx
+  800132:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800135:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  800138:	c7 05 00 80 80 00 00 	movl   $0x0,0x808000
+  80013f:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  800142:	e8 ca 0a 00 00       	call   800c11 <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  800147:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80014c:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80014f:	c1 e0 04             	shl    $0x4,%eax
+  800152:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800157:	a3 00 80 80 00       	mov    %eax,0x808000
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  80015c:	85 db                	test   %ebx,%ebx
+  80015e:	7e 07                	jle    800167 <libmain+0x3a>
+    binaryname = argv[0];
+  800160:	8b 06                	mov    (%esi),%eax
+  800162:	a3 00 40 80 00       	mov    %eax,0x804000
+
+  // call user main routine
+  umain(argc, argv);
+  800167:	83 ec 08             	sub    $0x8,%esp
+  80016a:	56                   	push   %esi
+  80016b:	53                   	push   %ebx
+  80016c:	e8 36 ff ff ff       	call   8000a7 <umain>
+
+  // exit gracefully
+  exit();
+  800171:	e8 0a 00 00 00       	call   800180 <exit>
+}
+  800176:	83 c4 10             	add    $0x10,%esp
+  800179:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80017c:	5b                   	pop    %ebx
+  80017d:	5e                   	pop    %esi
+  80017e:	5d                   	pop    %ebp
+  80017f:	c3                   	ret
+
+00800180 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800180:	55                   	push   %ebp
+  800181:	89 e5                	mov    %esp,%ebp
+  800183:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  800186:	e8 80 11 00 00       	call   80130b <close_all>
+  sys_env_destroy(0);
+  80018b:	83 ec 0c             	sub    $0xc,%esp
+  80018e:	6a 00                	push   $0x0
+  800190:	e8 3b 0a 00 00       	call   800bd0 <sys_env_destroy>
+}
+  800195:	83 c4 10             	add    $0x10,%esp
+  800198:	c9                   	leave
+  800199:	c3                   	ret
+
+0080019a <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80019a:	55                   	push   %ebp
+  80019b:	89 e5                	mov    %esp,%ebp
+  80019d:	56                   	push   %esi
+  80019e:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  80019f:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  8001a2:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  8001a8:	e8 64 0a 00 00       	call   800c11 <sys_getenvid>
+  8001ad:	83 ec 0c             	sub    $0xc,%esp
+  8001b0:	ff 75 0c             	push   0xc(%ebp)
+  8001b3:	ff 75 08             	push   0x8(%ebp)
+  8001b6:	56                   	push   %esi
+  8001b7:	50                   	push   %eax
+  8001b8:	68 c4 30 80 00       	push   $0x8030c4
+  8001bd:	e8 b3 00 00 00       	call   800275 <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  8001c2:	83 c4 18             	add    $0x18,%esp
+  8001c5:	53                   	push   %ebx
+  8001c6:	ff 75 10             	push   0x10(%ebp)
+  8001c9:	e8 56 00 00 00       	call   800224 <vcprintf>
+  cprintf("\n");
+  8001ce:	c7 04 24 40 35 80 00 	movl   $0x803540,(%esp)
+  8001d5:	e8 9b 00 00 00       	call   800275 <cprintf>
+  8001da:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  8001dd:	cc                   	int3
+  while (1)
+  8001de:	eb fd                	jmp    8001dd <_panic+0x43>
+
+008001e0 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8001e0:	55                   	push   %ebp
+  8001e1:	89 e5                	mov    %esp,%ebp
+  8001e3:	53                   	push   %ebx
+  8001e4:	83 ec 04             	sub    $0x4,%esp
+  8001e7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  8001ea:	8b 13                	mov    (%ebx),%edx
+  8001ec:	8d 42 01             	lea    0x1(%edx),%eax
+  8001ef:	89 03                	mov    %eax,(%ebx)
+  8001f1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001f4:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  8001f8:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001fd:	74 09                	je     800208 <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  8001ff:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800203:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800206:	c9                   	leave
+  800207:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  800208:	83 ec 08             	sub    $0x8,%esp
+  80020b:	68 ff 00 00 00       	push   $0xff
+  800210:	8d 43 08             	lea    0x8(%ebx),%eax
+  800213:	50                   	push   %eax
+  800214:	e8 7a 09 00 00       	call   800b93 <sys_cputs>
+    b->idx = 0;
+  800219:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80021f:	83 c4 10             	add    $0x10,%esp
+  800222:	eb db                	jmp    8001ff <putch+0x1f>
+
+00800224 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800224:	55                   	push   %ebp
+  800225:	89 e5                	mov    %esp,%ebp
+  800227:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  80022d:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800234:	00 00 00 
+  b.cnt = 0;
+  800237:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80023e:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  800241:	ff 75 0c             	push   0xc(%ebp)
+  800244:	ff 75 08             	push   0x8(%ebp)
+  800247:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80024d:	50                   	push   %eax
+  80024e:	68 e0 01 80 00       	push   $0x8001e0
+  800253:	e8 14 01 00 00       	call   80036c <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  800258:	83 c4 08             	add    $0x8,%esp
+  80025b:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800261:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800267:	50                   	push   %eax
+  800268:	e8 26 09 00 00       	call   800b93 <sys_cputs>
+
+  return b.cnt;
+}
+  80026d:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800273:	c9                   	leave
+  800274:	c3                   	ret
+
+00800275 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800275:	55                   	push   %ebp
+  800276:	89 e5                	mov    %esp,%ebp
+  800278:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  80027b:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  80027e:	50                   	push   %eax
+  80027f:	ff 75 08             	push   0x8(%ebp)
+  800282:	e8 9d ff ff ff       	call   800224 <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  800287:	c9                   	leave
+  800288:	c3                   	ret
+
+00800289 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  800289:	55                   	push   %ebp
+  80028a:	89 e5                	mov    %esp,%ebp
+  80028c:	57                   	push   %edi
+  80028d:	56                   	push   %esi
+  80028e:	53                   	push   %ebx
+  80028f:	83 ec 1c             	sub    $0x1c,%esp
+  800292:	89 c7                	mov    %eax,%edi
+  800294:	89 d6                	mov    %edx,%esi
+  800296:	8b 45 08             	mov    0x8(%ebp),%eax
+  800299:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80029c:	89 d1                	mov    %edx,%ecx
+  80029e:	89 c2                	mov    %eax,%edx
+  8002a0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8002a3:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8002a6:	8b 45 10             	mov    0x10(%ebp),%eax
+  8002a9:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  8002ac:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8002af:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8002b6:	39 c2                	cmp    %eax,%edx
+  8002b8:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8002bb:	72 3e                	jb     8002fb <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  8002bd:	83 ec 0c             	sub    $0xc,%esp
+  8002c0:	ff 75 18             	push   0x18(%ebp)
+  8002c3:	83 eb 01             	sub    $0x1,%ebx
+  8002c6:	53                   	push   %ebx
+  8002c7:	50                   	push   %eax
+  8002c8:	83 ec 08             	sub    $0x8,%esp
+  8002cb:	ff 75 e4             	push   -0x1c(%ebp)
+  8002ce:	ff 75 e0             	push   -0x20(%ebp)
+  8002d1:	ff 75 dc             	push   -0x24(%ebp)
+  8002d4:	ff 75 d8             	push   -0x28(%ebp)
+  8002d7:	e8 ef 2b 00 00       	call   802ecb <__udivdi3>
+  8002dc:	83 c4 18             	add    $0x18,%esp
+  8002df:	52                   	push   %edx
+  8002e0:	50                   	push   %eax
+  8002e1:	89 f2                	mov    %esi,%edx
+  8002e3:	89 f8                	mov    %edi,%eax
+  8002e5:	e8 9f ff ff ff       	call   800289 <printnum>
+  8002ea:	83 c4 20             	add    $0x20,%esp
+  8002ed:	eb 13                	jmp    800302 <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  8002ef:	83 ec 08             	sub    $0x8,%esp
+  8002f2:	56                   	push   %esi
+  8002f3:	ff 75 18             	push   0x18(%ebp)
+  8002f6:	ff d7                	call   *%edi
+  8002f8:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  8002fb:	83 eb 01             	sub    $0x1,%ebx
+  8002fe:	85 db                	test   %ebx,%ebx
+  800300:	7f ed                	jg     8002ef <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  800302:	83 ec 08             	sub    $0x8,%esp
+  800305:	56                   	push   %esi
+  800306:	83 ec 04             	sub    $0x4,%esp
+  800309:	ff 75 e4             	push   -0x1c(%ebp)
+  80030c:	ff 75 e0             	push   -0x20(%ebp)
+  80030f:	ff 75 dc             	push   -0x24(%ebp)
+  800312:	ff 75 d8             	push   -0x28(%ebp)
+  800315:	e8 d2 2b 00 00       	call   802eec <__umoddi3>
+  80031a:	83 c4 14             	add    $0x14,%esp
+  80031d:	0f be 80 e7 30 80 00 	movsbl 0x8030e7(%eax),%eax
+  800324:	50                   	push   %eax
+  800325:	ff d7                	call   *%edi
+}
+  800327:	83 c4 10             	add    $0x10,%esp
+  80032a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80032d:	5b                   	pop    %ebx
+  80032e:	5e                   	pop    %esi
+  80032f:	5f                   	pop    %edi
+  800330:	5d                   	pop    %ebp
+  800331:	c3                   	ret
+
+00800332 <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800332:	55                   	push   %ebp
+  800333:	89 e5                	mov    %esp,%ebp
+  800335:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  800338:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  80033c:	8b 10                	mov    (%eax),%edx
+  80033e:	3b 50 04             	cmp    0x4(%eax),%edx
+  800341:	73 0a                	jae    80034d <sprintputch+0x1b>
+    *b->buf++ = ch;
+  800343:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800346:	89 08                	mov    %ecx,(%eax)
+  800348:	8b 45 08             	mov    0x8(%ebp),%eax
+  80034b:	88 02                	mov    %al,(%edx)
+}
+  80034d:	5d                   	pop    %ebp
+  80034e:	c3                   	ret
+
+0080034f <printfmt>:
+{
+  80034f:	55                   	push   %ebp
+  800350:	89 e5                	mov    %esp,%ebp
+  800352:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  800355:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  800358:	50                   	push   %eax
+  800359:	ff 75 10             	push   0x10(%ebp)
+  80035c:	ff 75 0c             	push   0xc(%ebp)
+  80035f:	ff 75 08             	push   0x8(%ebp)
+  800362:	e8 05 00 00 00       	call   80036c <vprintfmt>
+}
+  800367:	83 c4 10             	add    $0x10,%esp
+  80036a:	c9                   	leave
+  80036b:	c3                   	ret
+
+0080036c <vprintfmt>:
+{
+  80036c:	55                   	push   %ebp
+  80036d:	89 e5                	mov    %esp,%ebp
+  80036f:	57                   	push   %edi
+  800370:	56                   	push   %esi
+  800371:	53                   	push   %ebx
+  800372:	83 ec 2c             	sub    $0x2c,%esp
+  800375:	8b 75 08             	mov    0x8(%ebp),%esi
+  800378:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80037b:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80037e:	eb 0a                	jmp    80038a <vprintfmt+0x1e>
+      putch(ch, putdat);
+  800380:	83 ec 08             	sub    $0x8,%esp
+  800383:	53                   	push   %ebx
+  800384:	50                   	push   %eax
+  800385:	ff d6                	call   *%esi
+  800387:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  80038a:	83 c7 01             	add    $0x1,%edi
+  80038d:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800391:	83 f8 25             	cmp    $0x25,%eax
+  800394:	74 0c                	je     8003a2 <vprintfmt+0x36>
+      if (ch == '\0')
+  800396:	85 c0                	test   %eax,%eax
+  800398:	75 e6                	jne    800380 <vprintfmt+0x14>
+}
+  80039a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80039d:	5b                   	pop    %ebx
+  80039e:	5e                   	pop    %esi
+  80039f:	5f                   	pop    %edi
+  8003a0:	5d                   	pop    %ebp
+  8003a1:	c3                   	ret
+    padc = ' ';
+  8003a2:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  8003a6:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  8003ad:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  8003b4:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  8003bb:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  8003c0:	8d 47 01             	lea    0x1(%edi),%eax
+  8003c3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8003c6:	0f b6 17             	movzbl (%edi),%edx
+  8003c9:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8003cc:	3c 55                	cmp    $0x55,%al
+  8003ce:	0f 87 cf 03 00 00    	ja     8007a3 <vprintfmt+0x437>
+  8003d4:	0f b6 c0             	movzbl %al,%eax
+  8003d7:	ff 24 85 40 32 80 00 	jmp    *0x803240(,%eax,4)
+  8003de:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  8003e1:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8003e5:	eb d9                	jmp    8003c0 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  8003e7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8003ea:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8003ee:	eb d0                	jmp    8003c0 <vprintfmt+0x54>
+  8003f0:	0f b6 d2             	movzbl %dl,%edx
+  8003f3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  8003f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003fb:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  8003fe:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800401:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  800405:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  800408:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80040b:	83 f9 09             	cmp    $0x9,%ecx
+  80040e:	77 55                	ja     800465 <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  800410:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  800413:	eb e9                	jmp    8003fe <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  800415:	8b 45 14             	mov    0x14(%ebp),%eax
+  800418:	8b 00                	mov    (%eax),%eax
+  80041a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80041d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800420:	8d 40 04             	lea    0x4(%eax),%eax
+  800423:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  800426:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  800429:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80042d:	79 91                	jns    8003c0 <vprintfmt+0x54>
+        width = precision, precision = -1;
+  80042f:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800432:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800435:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80043c:	eb 82                	jmp    8003c0 <vprintfmt+0x54>
+      if (width < 0)
+  80043e:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800441:	85 d2                	test   %edx,%edx
+  800443:	b8 00 00 00 00       	mov    $0x0,%eax
+  800448:	0f 49 c2             	cmovns %edx,%eax
+  80044b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  80044e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  800451:	e9 6a ff ff ff       	jmp    8003c0 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  800456:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  800459:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  800460:	e9 5b ff ff ff       	jmp    8003c0 <vprintfmt+0x54>
+  800465:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800468:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80046b:	eb bc                	jmp    800429 <vprintfmt+0xbd>
+      lflag++;
+  80046d:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  800470:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  800473:	e9 48 ff ff ff       	jmp    8003c0 <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  800478:	8b 45 14             	mov    0x14(%ebp),%eax
+  80047b:	8d 78 04             	lea    0x4(%eax),%edi
+  80047e:	83 ec 08             	sub    $0x8,%esp
+  800481:	53                   	push   %ebx
+  800482:	ff 30                	push   (%eax)
+  800484:	ff d6                	call   *%esi
+      break;
+  800486:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  800489:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  80048c:	e9 b1 02 00 00       	jmp    800742 <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  800491:	8b 45 14             	mov    0x14(%ebp),%eax
+  800494:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  800497:	8b 10                	mov    (%eax),%edx
+  800499:	89 d0                	mov    %edx,%eax
+  80049b:	f7 d8                	neg    %eax
+  80049d:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8004a0:	83 f8 10             	cmp    $0x10,%eax
+  8004a3:	7f 23                	jg     8004c8 <vprintfmt+0x15c>
+  8004a5:	8b 14 85 a0 33 80 00 	mov    0x8033a0(,%eax,4),%edx
+  8004ac:	85 d2                	test   %edx,%edx
+  8004ae:	74 18                	je     8004c8 <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  8004b0:	52                   	push   %edx
+  8004b1:	68 ea 34 80 00       	push   $0x8034ea
+  8004b6:	53                   	push   %ebx
+  8004b7:	56                   	push   %esi
+  8004b8:	e8 92 fe ff ff       	call   80034f <printfmt>
+  8004bd:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  8004c0:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8004c3:	e9 7a 02 00 00       	jmp    800742 <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  8004c8:	50                   	push   %eax
+  8004c9:	68 ff 30 80 00       	push   $0x8030ff
+  8004ce:	53                   	push   %ebx
+  8004cf:	56                   	push   %esi
+  8004d0:	e8 7a fe ff ff       	call   80034f <printfmt>
+  8004d5:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  8004d8:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  8004db:	e9 62 02 00 00       	jmp    800742 <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  8004e0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004e3:	83 c0 04             	add    $0x4,%eax
+  8004e6:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8004e9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004ec:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  8004ee:	85 c9                	test   %ecx,%ecx
+  8004f0:	b8 f8 30 80 00       	mov    $0x8030f8,%eax
+  8004f5:	0f 45 c1             	cmovne %ecx,%eax
+  8004f8:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  8004fb:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004ff:	7e 06                	jle    800507 <vprintfmt+0x19b>
+  800501:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800505:	75 0b                	jne    800512 <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800507:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80050a:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80050d:	89 75 08             	mov    %esi,0x8(%ebp)
+  800510:	eb 5c                	jmp    80056e <vprintfmt+0x202>
+  800512:	83 ec 08             	sub    $0x8,%esp
+  800515:	ff 75 d0             	push   -0x30(%ebp)
+  800518:	ff 75 cc             	push   -0x34(%ebp)
+  80051b:	e8 20 03 00 00       	call   800840 <strnlen>
+  800520:	89 c2                	mov    %eax,%edx
+  800522:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800525:	29 d0                	sub    %edx,%eax
+  800527:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  80052a:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80052e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800531:	89 75 08             	mov    %esi,0x8(%ebp)
+  800534:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800536:	eb 0e                	jmp    800546 <vprintfmt+0x1da>
+          putch(padc, putdat);
+  800538:	83 ec 08             	sub    $0x8,%esp
+  80053b:	53                   	push   %ebx
+  80053c:	57                   	push   %edi
+  80053d:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800540:	83 ee 01             	sub    $0x1,%esi
+  800543:	83 c4 10             	add    $0x10,%esp
+  800546:	85 f6                	test   %esi,%esi
+  800548:	7f ee                	jg     800538 <vprintfmt+0x1cc>
+  80054a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80054d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800550:	85 c0                	test   %eax,%eax
+  800552:	ba 00 00 00 00       	mov    $0x0,%edx
+  800557:	0f 49 d0             	cmovns %eax,%edx
+  80055a:	29 d0                	sub    %edx,%eax
+  80055c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80055f:	eb a6                	jmp    800507 <vprintfmt+0x19b>
+          putch(ch, putdat);
+  800561:	83 ec 08             	sub    $0x8,%esp
+  800564:	53                   	push   %ebx
+  800565:	52                   	push   %edx
+  800566:	ff 55 08             	call   *0x8(%ebp)
+  800569:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80056c:	89 f1                	mov    %esi,%ecx
+  80056e:	8d 71 01             	lea    0x1(%ecx),%esi
+  800571:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800575:	0f be d0             	movsbl %al,%edx
+  800578:	85 d2                	test   %edx,%edx
+  80057a:	74 28                	je     8005a4 <vprintfmt+0x238>
+  80057c:	85 ff                	test   %edi,%edi
+  80057e:	78 05                	js     800585 <vprintfmt+0x219>
+  800580:	83 ef 01             	sub    $0x1,%edi
+  800583:	78 30                	js     8005b5 <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  800585:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800589:	74 d6                	je     800561 <vprintfmt+0x1f5>
+  80058b:	0f be c0             	movsbl %al,%eax
+  80058e:	83 e8 20             	sub    $0x20,%eax
+  800591:	83 f8 5e             	cmp    $0x5e,%eax
+  800594:	76 cb                	jbe    800561 <vprintfmt+0x1f5>
+          putch('?', putdat);
+  800596:	83 ec 08             	sub    $0x8,%esp
+  800599:	53                   	push   %ebx
+  80059a:	6a 3f                	push   $0x3f
+  80059c:	ff 55 08             	call   *0x8(%ebp)
+  80059f:	83 c4 10             	add    $0x10,%esp
+  8005a2:	eb c8                	jmp    80056c <vprintfmt+0x200>
+  8005a4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005a7:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8005aa:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8005ad:	01 d0                	add    %edx,%eax
+  8005af:	29 c8                	sub    %ecx,%eax
+  8005b1:	89 c7                	mov    %eax,%edi
+  8005b3:	eb 13                	jmp    8005c8 <vprintfmt+0x25c>
+  8005b5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005b8:	eb ed                	jmp    8005a7 <vprintfmt+0x23b>
+        putch(' ', putdat);
+  8005ba:	83 ec 08             	sub    $0x8,%esp
+  8005bd:	53                   	push   %ebx
+  8005be:	6a 20                	push   $0x20
+  8005c0:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  8005c2:	83 ef 01             	sub    $0x1,%edi
+  8005c5:	83 c4 10             	add    $0x10,%esp
+  8005c8:	85 ff                	test   %edi,%edi
+  8005ca:	7f ee                	jg     8005ba <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  8005cc:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8005cf:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005d2:	e9 6b 01 00 00       	jmp    800742 <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  8005d7:	83 f9 01             	cmp    $0x1,%ecx
+  8005da:	7f 1f                	jg     8005fb <vprintfmt+0x28f>
+  else if (lflag)
+  8005dc:	85 c9                	test   %ecx,%ecx
+  8005de:	74 67                	je     800647 <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  8005e0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e3:	8b 00                	mov    (%eax),%eax
+  8005e5:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005e8:	89 c1                	mov    %eax,%ecx
+  8005ea:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005ed:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005f0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f3:	8d 40 04             	lea    0x4(%eax),%eax
+  8005f6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005f9:	eb 17                	jmp    800612 <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  8005fb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005fe:	8b 50 04             	mov    0x4(%eax),%edx
+  800601:	8b 00                	mov    (%eax),%eax
+  800603:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800606:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800609:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060c:	8d 40 08             	lea    0x8(%eax),%eax
+  80060f:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  800612:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800615:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  800618:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  80061d:	85 c9                	test   %ecx,%ecx
+  80061f:	0f 89 03 01 00 00    	jns    800728 <vprintfmt+0x3bc>
+        putch('-', putdat);
+  800625:	83 ec 08             	sub    $0x8,%esp
+  800628:	53                   	push   %ebx
+  800629:	6a 2d                	push   $0x2d
+  80062b:	ff d6                	call   *%esi
+        num = -(long long)num;
+  80062d:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800630:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800633:	f7 da                	neg    %edx
+  800635:	83 d1 00             	adc    $0x0,%ecx
+  800638:	f7 d9                	neg    %ecx
+  80063a:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  80063d:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800642:	e9 e1 00 00 00       	jmp    800728 <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  800647:	8b 45 14             	mov    0x14(%ebp),%eax
+  80064a:	8b 00                	mov    (%eax),%eax
+  80064c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80064f:	89 c1                	mov    %eax,%ecx
+  800651:	c1 f9 1f             	sar    $0x1f,%ecx
+  800654:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800657:	8b 45 14             	mov    0x14(%ebp),%eax
+  80065a:	8d 40 04             	lea    0x4(%eax),%eax
+  80065d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800660:	eb b0                	jmp    800612 <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  800662:	83 f9 01             	cmp    $0x1,%ecx
+  800665:	7f 1e                	jg     800685 <vprintfmt+0x319>
+  else if (lflag)
+  800667:	85 c9                	test   %ecx,%ecx
+  800669:	74 32                	je     80069d <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  80066b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80066e:	8b 10                	mov    (%eax),%edx
+  800670:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800675:	8d 40 04             	lea    0x4(%eax),%eax
+  800678:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  80067b:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  800680:	e9 a3 00 00 00       	jmp    800728 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800685:	8b 45 14             	mov    0x14(%ebp),%eax
+  800688:	8b 10                	mov    (%eax),%edx
+  80068a:	8b 48 04             	mov    0x4(%eax),%ecx
+  80068d:	8d 40 08             	lea    0x8(%eax),%eax
+  800690:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800693:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  800698:	e9 8b 00 00 00       	jmp    800728 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  80069d:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a0:	8b 10                	mov    (%eax),%edx
+  8006a2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006a7:	8d 40 04             	lea    0x4(%eax),%eax
+  8006aa:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  8006ad:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  8006b2:	eb 74                	jmp    800728 <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  8006b4:	83 f9 01             	cmp    $0x1,%ecx
+  8006b7:	7f 1b                	jg     8006d4 <vprintfmt+0x368>
+  else if (lflag)
+  8006b9:	85 c9                	test   %ecx,%ecx
+  8006bb:	74 2c                	je     8006e9 <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  8006bd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c0:	8b 10                	mov    (%eax),%edx
+  8006c2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006c7:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ca:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8006cd:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  8006d2:	eb 54                	jmp    800728 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  8006d4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d7:	8b 10                	mov    (%eax),%edx
+  8006d9:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006dc:	8d 40 08             	lea    0x8(%eax),%eax
+  8006df:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8006e2:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  8006e7:	eb 3f                	jmp    800728 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8006e9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ec:	8b 10                	mov    (%eax),%edx
+  8006ee:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006f3:	8d 40 04             	lea    0x4(%eax),%eax
+  8006f6:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8006f9:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  8006fe:	eb 28                	jmp    800728 <vprintfmt+0x3bc>
+      putch('0', putdat);
+  800700:	83 ec 08             	sub    $0x8,%esp
+  800703:	53                   	push   %ebx
+  800704:	6a 30                	push   $0x30
+  800706:	ff d6                	call   *%esi
+      putch('x', putdat);
+  800708:	83 c4 08             	add    $0x8,%esp
+  80070b:	53                   	push   %ebx
+  80070c:	6a 78                	push   $0x78
+  80070e:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  800710:	8b 45 14             	mov    0x14(%ebp),%eax
+  800713:	8b 10                	mov    (%eax),%edx
+  800715:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  80071a:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  80071d:	8d 40 04             	lea    0x4(%eax),%eax
+  800720:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800723:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  800728:	83 ec 0c             	sub    $0xc,%esp
+  80072b:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80072f:	50                   	push   %eax
+  800730:	ff 75 e0             	push   -0x20(%ebp)
+  800733:	57                   	push   %edi
+  800734:	51                   	push   %ecx
+  800735:	52                   	push   %edx
+  800736:	89 da                	mov    %ebx,%edx
+  800738:	89 f0                	mov    %esi,%eax
+  80073a:	e8 4a fb ff ff       	call   800289 <printnum>
+      break;
+  80073f:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  800742:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  800745:	e9 40 fc ff ff       	jmp    80038a <vprintfmt+0x1e>
+  if (lflag >= 2)
+  80074a:	83 f9 01             	cmp    $0x1,%ecx
+  80074d:	7f 1b                	jg     80076a <vprintfmt+0x3fe>
+  else if (lflag)
+  80074f:	85 c9                	test   %ecx,%ecx
+  800751:	74 2c                	je     80077f <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  800753:	8b 45 14             	mov    0x14(%ebp),%eax
+  800756:	8b 10                	mov    (%eax),%edx
+  800758:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80075d:	8d 40 04             	lea    0x4(%eax),%eax
+  800760:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800763:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  800768:	eb be                	jmp    800728 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  80076a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80076d:	8b 10                	mov    (%eax),%edx
+  80076f:	8b 48 04             	mov    0x4(%eax),%ecx
+  800772:	8d 40 08             	lea    0x8(%eax),%eax
+  800775:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800778:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  80077d:	eb a9                	jmp    800728 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  80077f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800782:	8b 10                	mov    (%eax),%edx
+  800784:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800789:	8d 40 04             	lea    0x4(%eax),%eax
+  80078c:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  80078f:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  800794:	eb 92                	jmp    800728 <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  800796:	83 ec 08             	sub    $0x8,%esp
+  800799:	53                   	push   %ebx
+  80079a:	6a 25                	push   $0x25
+  80079c:	ff d6                	call   *%esi
+      break;
+  80079e:	83 c4 10             	add    $0x10,%esp
+  8007a1:	eb 9f                	jmp    800742 <vprintfmt+0x3d6>
+      putch('%', putdat);
+  8007a3:	83 ec 08             	sub    $0x8,%esp
+  8007a6:	53                   	push   %ebx
+  8007a7:	6a 25                	push   $0x25
+  8007a9:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  8007ab:	83 c4 10             	add    $0x10,%esp
+  8007ae:	89 f8                	mov    %edi,%eax
+  8007b0:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8007b4:	74 05                	je     8007bb <vprintfmt+0x44f>
+  8007b6:	83 e8 01             	sub    $0x1,%eax
+  8007b9:	eb f5                	jmp    8007b0 <vprintfmt+0x444>
+  8007bb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8007be:	eb 82                	jmp    800742 <vprintfmt+0x3d6>
+
+008007c0 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8007c0:	55                   	push   %ebp
+  8007c1:	89 e5                	mov    %esp,%ebp
+  8007c3:	83 ec 18             	sub    $0x18,%esp
+  8007c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007c9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  8007cc:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8007cf:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8007d3:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8007d6:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  8007dd:	85 c0                	test   %eax,%eax
+  8007df:	74 26                	je     800807 <vsnprintf+0x47>
+  8007e1:	85 d2                	test   %edx,%edx
+  8007e3:	7e 22                	jle    800807 <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8007e5:	ff 75 14             	push   0x14(%ebp)
+  8007e8:	ff 75 10             	push   0x10(%ebp)
+  8007eb:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8007ee:	50                   	push   %eax
+  8007ef:	68 32 03 80 00       	push   $0x800332
+  8007f4:	e8 73 fb ff ff       	call   80036c <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  8007f9:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8007fc:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  8007ff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800802:	83 c4 10             	add    $0x10,%esp
+}
+  800805:	c9                   	leave
+  800806:	c3                   	ret
+    return -E_INVAL;
+  800807:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80080c:	eb f7                	jmp    800805 <vsnprintf+0x45>
+
+0080080e <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80080e:	55                   	push   %ebp
+  80080f:	89 e5                	mov    %esp,%ebp
+  800811:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  800814:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  800817:	50                   	push   %eax
+  800818:	ff 75 10             	push   0x10(%ebp)
+  80081b:	ff 75 0c             	push   0xc(%ebp)
+  80081e:	ff 75 08             	push   0x8(%ebp)
+  800821:	e8 9a ff ff ff       	call   8007c0 <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  800826:	c9                   	leave
+  800827:	c3                   	ret
+
+00800828 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800828:	55                   	push   %ebp
+  800829:	89 e5                	mov    %esp,%ebp
+  80082b:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  80082e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800833:	eb 03                	jmp    800838 <strlen+0x10>
+    n++;
+  800835:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  800838:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80083c:	75 f7                	jne    800835 <strlen+0xd>
+  return n;
+}
+  80083e:	5d                   	pop    %ebp
+  80083f:	c3                   	ret
+
+00800840 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800840:	55                   	push   %ebp
+  800841:	89 e5                	mov    %esp,%ebp
+  800843:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800846:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800849:	b8 00 00 00 00       	mov    $0x0,%eax
+  80084e:	eb 03                	jmp    800853 <strnlen+0x13>
+    n++;
+  800850:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800853:	39 d0                	cmp    %edx,%eax
+  800855:	74 08                	je     80085f <strnlen+0x1f>
+  800857:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80085b:	75 f3                	jne    800850 <strnlen+0x10>
+  80085d:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  80085f:	89 d0                	mov    %edx,%eax
+  800861:	5d                   	pop    %ebp
+  800862:	c3                   	ret
+
+00800863 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800863:	55                   	push   %ebp
+  800864:	89 e5                	mov    %esp,%ebp
+  800866:	53                   	push   %ebx
+  800867:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80086a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  80086d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800872:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800876:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800879:	83 c0 01             	add    $0x1,%eax
+  80087c:	84 d2                	test   %dl,%dl
+  80087e:	75 f2                	jne    800872 <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  800880:	89 c8                	mov    %ecx,%eax
+  800882:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800885:	c9                   	leave
+  800886:	c3                   	ret
+
+00800887 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800887:	55                   	push   %ebp
+  800888:	89 e5                	mov    %esp,%ebp
+  80088a:	53                   	push   %ebx
+  80088b:	83 ec 10             	sub    $0x10,%esp
+  80088e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  800891:	53                   	push   %ebx
+  800892:	e8 91 ff ff ff       	call   800828 <strlen>
+  800897:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  80089a:	ff 75 0c             	push   0xc(%ebp)
+  80089d:	01 d8                	add    %ebx,%eax
+  80089f:	50                   	push   %eax
+  8008a0:	e8 be ff ff ff       	call   800863 <strcpy>
+  return dst;
+}
+  8008a5:	89 d8                	mov    %ebx,%eax
+  8008a7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008aa:	c9                   	leave
+  8008ab:	c3                   	ret
+
+008008ac <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  8008ac:	55                   	push   %ebp
+  8008ad:	89 e5                	mov    %esp,%ebp
+  8008af:	56                   	push   %esi
+  8008b0:	53                   	push   %ebx
+  8008b1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008b4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  8008b7:	89 f3                	mov    %esi,%ebx
+  8008b9:	03 5d 10             	add    0x10(%ebp),%ebx
+  8008bc:	89 f0                	mov    %esi,%eax
+  8008be:	eb 0f                	jmp    8008cf <strncpy+0x23>
+    *dst++ = *src;
+  8008c0:	83 c0 01             	add    $0x1,%eax
+  8008c3:	0f b6 0a             	movzbl (%edx),%ecx
+  8008c6:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  8008c9:	80 f9 01             	cmp    $0x1,%cl
+  8008cc:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  8008cf:	39 d8                	cmp    %ebx,%eax
+  8008d1:	75 ed                	jne    8008c0 <strncpy+0x14>
+  }
+  return ret;
+}
+  8008d3:	89 f0                	mov    %esi,%eax
+  8008d5:	5b                   	pop    %ebx
+  8008d6:	5e                   	pop    %esi
+  8008d7:	5d                   	pop    %ebp
+  8008d8:	c3                   	ret
+
+008008d9 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8008d9:	55                   	push   %ebp
+  8008da:	89 e5                	mov    %esp,%ebp
+  8008dc:	56                   	push   %esi
+  8008dd:	53                   	push   %ebx
+  8008de:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008e1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008e4:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  8008e7:	89 f0                	mov    %esi,%eax
+  8008e9:	85 d2                	test   %edx,%edx
+  8008eb:	74 21                	je     80090e <strlcpy+0x35>
+  8008ed:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8008f1:	89 f2                	mov    %esi,%edx
+  8008f3:	eb 09                	jmp    8008fe <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  8008f5:	83 c1 01             	add    $0x1,%ecx
+  8008f8:	83 c2 01             	add    $0x1,%edx
+  8008fb:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  8008fe:	39 c2                	cmp    %eax,%edx
+  800900:	74 09                	je     80090b <strlcpy+0x32>
+  800902:	0f b6 19             	movzbl (%ecx),%ebx
+  800905:	84 db                	test   %bl,%bl
+  800907:	75 ec                	jne    8008f5 <strlcpy+0x1c>
+  800909:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  80090b:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  80090e:	29 f0                	sub    %esi,%eax
+}
+  800910:	5b                   	pop    %ebx
+  800911:	5e                   	pop    %esi
+  800912:	5d                   	pop    %ebp
+  800913:	c3                   	ret
+
+00800914 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800914:	55                   	push   %ebp
+  800915:	89 e5                	mov    %esp,%ebp
+  800917:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80091a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  80091d:	eb 06                	jmp    800925 <strcmp+0x11>
+    p++, q++;
+  80091f:	83 c1 01             	add    $0x1,%ecx
+  800922:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  800925:	0f b6 01             	movzbl (%ecx),%eax
+  800928:	84 c0                	test   %al,%al
+  80092a:	74 04                	je     800930 <strcmp+0x1c>
+  80092c:	3a 02                	cmp    (%edx),%al
+  80092e:	74 ef                	je     80091f <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  800930:	0f b6 c0             	movzbl %al,%eax
+  800933:	0f b6 12             	movzbl (%edx),%edx
+  800936:	29 d0                	sub    %edx,%eax
+}
+  800938:	5d                   	pop    %ebp
+  800939:	c3                   	ret
+
+0080093a <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80093a:	55                   	push   %ebp
+  80093b:	89 e5                	mov    %esp,%ebp
+  80093d:	53                   	push   %ebx
+  80093e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800941:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800944:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  800947:	eb 09                	jmp    800952 <strncmp+0x18>
+    n--, p++, q++;
+  800949:	83 ea 01             	sub    $0x1,%edx
+  80094c:	83 c0 01             	add    $0x1,%eax
+  80094f:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  800952:	85 d2                	test   %edx,%edx
+  800954:	74 18                	je     80096e <strncmp+0x34>
+  800956:	0f b6 18             	movzbl (%eax),%ebx
+  800959:	84 db                	test   %bl,%bl
+  80095b:	74 04                	je     800961 <strncmp+0x27>
+  80095d:	3a 19                	cmp    (%ecx),%bl
+  80095f:	74 e8                	je     800949 <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800961:	0f b6 00             	movzbl (%eax),%eax
+  800964:	0f b6 11             	movzbl (%ecx),%edx
+  800967:	29 d0                	sub    %edx,%eax
+}
+  800969:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80096c:	c9                   	leave
+  80096d:	c3                   	ret
+    return 0;
+  80096e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800973:	eb f4                	jmp    800969 <strncmp+0x2f>
+
+00800975 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800975:	55                   	push   %ebp
+  800976:	89 e5                	mov    %esp,%ebp
+  800978:	8b 45 08             	mov    0x8(%ebp),%eax
+  80097b:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  80097f:	eb 03                	jmp    800984 <strchr+0xf>
+  800981:	83 c0 01             	add    $0x1,%eax
+  800984:	0f b6 10             	movzbl (%eax),%edx
+  800987:	84 d2                	test   %dl,%dl
+  800989:	74 06                	je     800991 <strchr+0x1c>
+    if (*s == c)
+  80098b:	38 ca                	cmp    %cl,%dl
+  80098d:	75 f2                	jne    800981 <strchr+0xc>
+  80098f:	eb 05                	jmp    800996 <strchr+0x21>
+      return (char*)s;
+  return 0;
+  800991:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800996:	5d                   	pop    %ebp
+  800997:	c3                   	ret
+
+00800998 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800998:	55                   	push   %ebp
+  800999:	89 e5                	mov    %esp,%ebp
+  80099b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80099e:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  8009a2:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  8009a5:	38 ca                	cmp    %cl,%dl
+  8009a7:	74 09                	je     8009b2 <strfind+0x1a>
+  8009a9:	84 d2                	test   %dl,%dl
+  8009ab:	74 05                	je     8009b2 <strfind+0x1a>
+  for (; *s; s++)
+  8009ad:	83 c0 01             	add    $0x1,%eax
+  8009b0:	eb f0                	jmp    8009a2 <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  8009b2:	5d                   	pop    %ebp
+  8009b3:	c3                   	ret
+
+008009b4 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8009b4:	55                   	push   %ebp
+  8009b5:	89 e5                	mov    %esp,%ebp
+  8009b7:	57                   	push   %edi
+  8009b8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8009bb:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  8009be:	85 c9                	test   %ecx,%ecx
+  8009c0:	74 20                	je     8009e2 <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  8009c2:	89 f8                	mov    %edi,%eax
+  8009c4:	09 c8                	or     %ecx,%eax
+  8009c6:	a8 03                	test   $0x3,%al
+  8009c8:	75 12                	jne    8009dc <memset+0x28>
+    c &= 0xFF;
+  8009ca:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8009ce:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  8009d4:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  8009d7:	fc                   	cld
+  8009d8:	f3 ab                	rep stos %eax,%es:(%edi)
+  8009da:	eb 06                	jmp    8009e2 <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  8009dc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8009df:	fc                   	cld
+  8009e0:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  8009e2:	89 f8                	mov    %edi,%eax
+  8009e4:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8009e7:	c9                   	leave
+  8009e8:	c3                   	ret
+
+008009e9 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8009e9:	55                   	push   %ebp
+  8009ea:	89 e5                	mov    %esp,%ebp
+  8009ec:	57                   	push   %edi
+  8009ed:	56                   	push   %esi
+  8009ee:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009f1:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8009f4:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  8009f7:	39 c6                	cmp    %eax,%esi
+  8009f9:	73 32                	jae    800a2d <memmove+0x44>
+  8009fb:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8009fe:	39 d0                	cmp    %edx,%eax
+  800a00:	73 2b                	jae    800a2d <memmove+0x44>
+    s += n;
+    d += n;
+  800a02:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a05:	89 d6                	mov    %edx,%esi
+  800a07:	09 fe                	or     %edi,%esi
+  800a09:	09 ce                	or     %ecx,%esi
+  800a0b:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a11:	75 0e                	jne    800a21 <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a13:	83 ef 04             	sub    $0x4,%edi
+  800a16:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a19:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  800a1c:	fd                   	std
+  800a1d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a1f:	eb 09                	jmp    800a2a <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a21:	83 ef 01             	sub    $0x1,%edi
+  800a24:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  800a27:	fd                   	std
+  800a28:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  800a2a:	fc                   	cld
+  800a2b:	eb 1a                	jmp    800a47 <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a2d:	89 f2                	mov    %esi,%edx
+  800a2f:	09 c2                	or     %eax,%edx
+  800a31:	09 ca                	or     %ecx,%edx
+  800a33:	f6 c2 03             	test   $0x3,%dl
+  800a36:	75 0a                	jne    800a42 <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a38:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  800a3b:	89 c7                	mov    %eax,%edi
+  800a3d:	fc                   	cld
+  800a3e:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a40:	eb 05                	jmp    800a47 <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  800a42:	89 c7                	mov    %eax,%edi
+  800a44:	fc                   	cld
+  800a45:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  800a47:	5e                   	pop    %esi
+  800a48:	5f                   	pop    %edi
+  800a49:	5d                   	pop    %ebp
+  800a4a:	c3                   	ret
+
+00800a4b <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a4b:	55                   	push   %ebp
+  800a4c:	89 e5                	mov    %esp,%ebp
+  800a4e:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  800a51:	ff 75 10             	push   0x10(%ebp)
+  800a54:	ff 75 0c             	push   0xc(%ebp)
+  800a57:	ff 75 08             	push   0x8(%ebp)
+  800a5a:	e8 8a ff ff ff       	call   8009e9 <memmove>
+}
+  800a5f:	c9                   	leave
+  800a60:	c3                   	ret
+
+00800a61 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a61:	55                   	push   %ebp
+  800a62:	89 e5                	mov    %esp,%ebp
+  800a64:	56                   	push   %esi
+  800a65:	53                   	push   %ebx
+  800a66:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a69:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  800a6c:	89 c6                	mov    %eax,%esi
+  800a6e:	03 75 10             	add    0x10(%ebp),%esi
+  800a71:	eb 06                	jmp    800a79 <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  800a73:	83 c0 01             	add    $0x1,%eax
+  800a76:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  800a79:	39 f0                	cmp    %esi,%eax
+  800a7b:	74 14                	je     800a91 <memcmp+0x30>
+    if (*s1 != *s2)
+  800a7d:	0f b6 08             	movzbl (%eax),%ecx
+  800a80:	0f b6 1a             	movzbl (%edx),%ebx
+  800a83:	38 d9                	cmp    %bl,%cl
+  800a85:	74 ec                	je     800a73 <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  800a87:	0f b6 c1             	movzbl %cl,%eax
+  800a8a:	0f b6 db             	movzbl %bl,%ebx
+  800a8d:	29 d8                	sub    %ebx,%eax
+  800a8f:	eb 05                	jmp    800a96 <memcmp+0x35>
+  }
+
+  return 0;
+  800a91:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a96:	5b                   	pop    %ebx
+  800a97:	5e                   	pop    %esi
+  800a98:	5d                   	pop    %ebp
+  800a99:	c3                   	ret
+
+00800a9a <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a9a:	55                   	push   %ebp
+  800a9b:	89 e5                	mov    %esp,%ebp
+  800a9d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aa0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  800aa3:	89 c2                	mov    %eax,%edx
+  800aa5:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  800aa8:	eb 03                	jmp    800aad <memfind+0x13>
+  800aaa:	83 c0 01             	add    $0x1,%eax
+  800aad:	39 d0                	cmp    %edx,%eax
+  800aaf:	73 04                	jae    800ab5 <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  800ab1:	38 08                	cmp    %cl,(%eax)
+  800ab3:	75 f5                	jne    800aaa <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  800ab5:	5d                   	pop    %ebp
+  800ab6:	c3                   	ret
+
+00800ab7 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800ab7:	55                   	push   %ebp
+  800ab8:	89 e5                	mov    %esp,%ebp
+  800aba:	57                   	push   %edi
+  800abb:	56                   	push   %esi
+  800abc:	53                   	push   %ebx
+  800abd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ac0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  800ac3:	eb 03                	jmp    800ac8 <strtol+0x11>
+    s++;
+  800ac5:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  800ac8:	0f b6 02             	movzbl (%edx),%eax
+  800acb:	3c 20                	cmp    $0x20,%al
+  800acd:	74 f6                	je     800ac5 <strtol+0xe>
+  800acf:	3c 09                	cmp    $0x9,%al
+  800ad1:	74 f2                	je     800ac5 <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  800ad3:	3c 2b                	cmp    $0x2b,%al
+  800ad5:	74 2a                	je     800b01 <strtol+0x4a>
+  int neg = 0;
+  800ad7:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  800adc:	3c 2d                	cmp    $0x2d,%al
+  800ade:	74 2b                	je     800b0b <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ae0:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800ae6:	75 0f                	jne    800af7 <strtol+0x40>
+  800ae8:	80 3a 30             	cmpb   $0x30,(%edx)
+  800aeb:	74 28                	je     800b15 <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  800aed:	85 db                	test   %ebx,%ebx
+  800aef:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800af4:	0f 44 d8             	cmove  %eax,%ebx
+  800af7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800afc:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800aff:	eb 46                	jmp    800b47 <strtol+0x90>
+    s++;
+  800b01:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  800b04:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b09:	eb d5                	jmp    800ae0 <strtol+0x29>
+    s++, neg = 1;
+  800b0b:	83 c2 01             	add    $0x1,%edx
+  800b0e:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b13:	eb cb                	jmp    800ae0 <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b15:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800b19:	74 0e                	je     800b29 <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  800b1b:	85 db                	test   %ebx,%ebx
+  800b1d:	75 d8                	jne    800af7 <strtol+0x40>
+    s++, base = 8;
+  800b1f:	83 c2 01             	add    $0x1,%edx
+  800b22:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800b27:	eb ce                	jmp    800af7 <strtol+0x40>
+    s += 2, base = 16;
+  800b29:	83 c2 02             	add    $0x2,%edx
+  800b2c:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800b31:	eb c4                	jmp    800af7 <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  800b33:	0f be c0             	movsbl %al,%eax
+  800b36:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  800b39:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800b3c:	7d 3a                	jge    800b78 <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  800b3e:	83 c2 01             	add    $0x1,%edx
+  800b41:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800b45:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  800b47:	0f b6 02             	movzbl (%edx),%eax
+  800b4a:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800b4d:	89 f3                	mov    %esi,%ebx
+  800b4f:	80 fb 09             	cmp    $0x9,%bl
+  800b52:	76 df                	jbe    800b33 <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  800b54:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800b57:	89 f3                	mov    %esi,%ebx
+  800b59:	80 fb 19             	cmp    $0x19,%bl
+  800b5c:	77 08                	ja     800b66 <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  800b5e:	0f be c0             	movsbl %al,%eax
+  800b61:	83 e8 57             	sub    $0x57,%eax
+  800b64:	eb d3                	jmp    800b39 <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  800b66:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800b69:	89 f3                	mov    %esi,%ebx
+  800b6b:	80 fb 19             	cmp    $0x19,%bl
+  800b6e:	77 08                	ja     800b78 <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  800b70:	0f be c0             	movsbl %al,%eax
+  800b73:	83 e8 37             	sub    $0x37,%eax
+  800b76:	eb c1                	jmp    800b39 <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  800b78:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b7c:	74 05                	je     800b83 <strtol+0xcc>
+    *endptr = (char*)s;
+  800b7e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b81:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  800b83:	89 c8                	mov    %ecx,%eax
+  800b85:	f7 d8                	neg    %eax
+  800b87:	85 ff                	test   %edi,%edi
+  800b89:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b8c:	89 c8                	mov    %ecx,%eax
+  800b8e:	5b                   	pop    %ebx
+  800b8f:	5e                   	pop    %esi
+  800b90:	5f                   	pop    %edi
+  800b91:	5d                   	pop    %ebp
+  800b92:	c3                   	ret
+
+00800b93 <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800b93:	55                   	push   %ebp
+  800b94:	89 e5                	mov    %esp,%ebp
+  800b96:	57                   	push   %edi
+  800b97:	56                   	push   %esi
+  800b98:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800b99:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b9e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ba1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ba4:	89 c3                	mov    %eax,%ebx
+  800ba6:	89 c7                	mov    %eax,%edi
+  800ba8:	89 c6                	mov    %eax,%esi
+  800baa:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800bac:	5b                   	pop    %ebx
+  800bad:	5e                   	pop    %esi
+  800bae:	5f                   	pop    %edi
+  800baf:	5d                   	pop    %ebp
+  800bb0:	c3                   	ret
+
+00800bb1 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800bb1:	55                   	push   %ebp
+  800bb2:	89 e5                	mov    %esp,%ebp
+  800bb4:	57                   	push   %edi
+  800bb5:	56                   	push   %esi
+  800bb6:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800bb7:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bbc:	b8 01 00 00 00       	mov    $0x1,%eax
+  800bc1:	89 d1                	mov    %edx,%ecx
+  800bc3:	89 d3                	mov    %edx,%ebx
+  800bc5:	89 d7                	mov    %edx,%edi
+  800bc7:	89 d6                	mov    %edx,%esi
+  800bc9:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800bcb:	5b                   	pop    %ebx
+  800bcc:	5e                   	pop    %esi
+  800bcd:	5f                   	pop    %edi
+  800bce:	5d                   	pop    %ebp
+  800bcf:	c3                   	ret
+
+00800bd0 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800bd0:	55                   	push   %ebp
+  800bd1:	89 e5                	mov    %esp,%ebp
+  800bd3:	57                   	push   %edi
+  800bd4:	56                   	push   %esi
+  800bd5:	53                   	push   %ebx
+  800bd6:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800bd9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bde:	8b 55 08             	mov    0x8(%ebp),%edx
+  800be1:	b8 03 00 00 00       	mov    $0x3,%eax
+  800be6:	89 cb                	mov    %ecx,%ebx
+  800be8:	89 cf                	mov    %ecx,%edi
+  800bea:	89 ce                	mov    %ecx,%esi
+  800bec:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800bee:	85 c0                	test   %eax,%eax
+  800bf0:	7f 08                	jg     800bfa <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800bf2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bf5:	5b                   	pop    %ebx
+  800bf6:	5e                   	pop    %esi
+  800bf7:	5f                   	pop    %edi
+  800bf8:	5d                   	pop    %ebp
+  800bf9:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800bfa:	83 ec 0c             	sub    $0xc,%esp
+  800bfd:	50                   	push   %eax
+  800bfe:	6a 03                	push   $0x3
+  800c00:	68 03 34 80 00       	push   $0x803403
+  800c05:	6a 23                	push   $0x23
+  800c07:	68 20 34 80 00       	push   $0x803420
+  800c0c:	e8 89 f5 ff ff       	call   80019a <_panic>
+
+00800c11 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800c11:	55                   	push   %ebp
+  800c12:	89 e5                	mov    %esp,%ebp
+  800c14:	57                   	push   %edi
+  800c15:	56                   	push   %esi
+  800c16:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800c17:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c1c:	b8 02 00 00 00       	mov    $0x2,%eax
+  800c21:	89 d1                	mov    %edx,%ecx
+  800c23:	89 d3                	mov    %edx,%ebx
+  800c25:	89 d7                	mov    %edx,%edi
+  800c27:	89 d6                	mov    %edx,%esi
+  800c29:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800c2b:	5b                   	pop    %ebx
+  800c2c:	5e                   	pop    %esi
+  800c2d:	5f                   	pop    %edi
+  800c2e:	5d                   	pop    %ebp
+  800c2f:	c3                   	ret
+
+00800c30 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800c30:	55                   	push   %ebp
+  800c31:	89 e5                	mov    %esp,%ebp
+  800c33:	57                   	push   %edi
+  800c34:	56                   	push   %esi
+  800c35:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800c36:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c3b:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800c40:	89 d1                	mov    %edx,%ecx
+  800c42:	89 d3                	mov    %edx,%ebx
+  800c44:	89 d7                	mov    %edx,%edi
+  800c46:	89 d6                	mov    %edx,%esi
+  800c48:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800c4a:	5b                   	pop    %ebx
+  800c4b:	5e                   	pop    %esi
+  800c4c:	5f                   	pop    %edi
+  800c4d:	5d                   	pop    %ebp
+  800c4e:	c3                   	ret
+
+00800c4f <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  800c4f:	55                   	push   %ebp
+  800c50:	89 e5                	mov    %esp,%ebp
+  800c52:	57                   	push   %edi
+  800c53:	56                   	push   %esi
+  800c54:	53                   	push   %ebx
+  800c55:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  800c58:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  800c5c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c61:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c64:	b8 14 00 00 00       	mov    $0x14,%eax
+  800c69:	89 df                	mov    %ebx,%edi
+  800c6b:	89 de                	mov    %ebx,%esi
+  800c6d:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c6f:	85 c0                	test   %eax,%eax
+  800c71:	7f 08                	jg     800c7b <sys_env_set_cow+0x2c>
+}
+  800c73:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c76:	5b                   	pop    %ebx
+  800c77:	5e                   	pop    %esi
+  800c78:	5f                   	pop    %edi
+  800c79:	5d                   	pop    %ebp
+  800c7a:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c7b:	83 ec 0c             	sub    $0xc,%esp
+  800c7e:	50                   	push   %eax
+  800c7f:	6a 14                	push   $0x14
+  800c81:	68 03 34 80 00       	push   $0x803403
+  800c86:	6a 23                	push   $0x23
+  800c88:	68 20 34 80 00       	push   $0x803420
+  800c8d:	e8 08 f5 ff ff       	call   80019a <_panic>
+
+00800c92 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800c92:	55                   	push   %ebp
+  800c93:	89 e5                	mov    %esp,%ebp
+  800c95:	57                   	push   %edi
+  800c96:	56                   	push   %esi
+  800c97:	53                   	push   %ebx
+  800c98:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800c9b:	be 00 00 00 00       	mov    $0x0,%esi
+  800ca0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ca3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ca6:	b8 04 00 00 00       	mov    $0x4,%eax
+  800cab:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cae:	89 f7                	mov    %esi,%edi
+  800cb0:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800cb2:	85 c0                	test   %eax,%eax
+  800cb4:	7f 08                	jg     800cbe <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  800cb6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cb9:	5b                   	pop    %ebx
+  800cba:	5e                   	pop    %esi
+  800cbb:	5f                   	pop    %edi
+  800cbc:	5d                   	pop    %ebp
+  800cbd:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800cbe:	83 ec 0c             	sub    $0xc,%esp
+  800cc1:	50                   	push   %eax
+  800cc2:	6a 04                	push   $0x4
+  800cc4:	68 03 34 80 00       	push   $0x803403
+  800cc9:	6a 23                	push   $0x23
+  800ccb:	68 20 34 80 00       	push   $0x803420
+  800cd0:	e8 c5 f4 ff ff       	call   80019a <_panic>
+
+00800cd5 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800cd5:	55                   	push   %ebp
+  800cd6:	89 e5                	mov    %esp,%ebp
+  800cd8:	57                   	push   %edi
+  800cd9:	56                   	push   %esi
+  800cda:	53                   	push   %ebx
+  800cdb:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800cde:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ce1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ce4:	b8 05 00 00 00       	mov    $0x5,%eax
+  800ce9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cec:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800cef:	8b 75 18             	mov    0x18(%ebp),%esi
+  800cf2:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800cf4:	85 c0                	test   %eax,%eax
+  800cf6:	7f 08                	jg     800d00 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  800cf8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cfb:	5b                   	pop    %ebx
+  800cfc:	5e                   	pop    %esi
+  800cfd:	5f                   	pop    %edi
+  800cfe:	5d                   	pop    %ebp
+  800cff:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d00:	83 ec 0c             	sub    $0xc,%esp
+  800d03:	50                   	push   %eax
+  800d04:	6a 05                	push   $0x5
+  800d06:	68 03 34 80 00       	push   $0x803403
+  800d0b:	6a 23                	push   $0x23
+  800d0d:	68 20 34 80 00       	push   $0x803420
+  800d12:	e8 83 f4 ff ff       	call   80019a <_panic>
+
+00800d17 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800d17:	55                   	push   %ebp
+  800d18:	89 e5                	mov    %esp,%ebp
+  800d1a:	57                   	push   %edi
+  800d1b:	56                   	push   %esi
+  800d1c:	53                   	push   %ebx
+  800d1d:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800d20:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d25:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d28:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d2b:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d30:	89 df                	mov    %ebx,%edi
+  800d32:	89 de                	mov    %ebx,%esi
+  800d34:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d36:	85 c0                	test   %eax,%eax
+  800d38:	7f 08                	jg     800d42 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  800d3a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d3d:	5b                   	pop    %ebx
+  800d3e:	5e                   	pop    %esi
+  800d3f:	5f                   	pop    %edi
+  800d40:	5d                   	pop    %ebp
+  800d41:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d42:	83 ec 0c             	sub    $0xc,%esp
+  800d45:	50                   	push   %eax
+  800d46:	6a 06                	push   $0x6
+  800d48:	68 03 34 80 00       	push   $0x803403
+  800d4d:	6a 23                	push   $0x23
+  800d4f:	68 20 34 80 00       	push   $0x803420
+  800d54:	e8 41 f4 ff ff       	call   80019a <_panic>
+
+00800d59 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  800d59:	55                   	push   %ebp
+  800d5a:	89 e5                	mov    %esp,%ebp
+  800d5c:	57                   	push   %edi
+  800d5d:	56                   	push   %esi
+  800d5e:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d5f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d62:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d65:	b8 11 00 00 00       	mov    $0x11,%eax
+  800d6a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d6d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d70:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d73:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  800d75:	5b                   	pop    %ebx
+  800d76:	5e                   	pop    %esi
+  800d77:	5f                   	pop    %edi
+  800d78:	5d                   	pop    %ebp
+  800d79:	c3                   	ret
+
+00800d7a <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  800d7a:	55                   	push   %ebp
+  800d7b:	89 e5                	mov    %esp,%ebp
+  800d7d:	57                   	push   %edi
+  800d7e:	56                   	push   %esi
+  800d7f:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d80:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d83:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d86:	b8 12 00 00 00       	mov    $0x12,%eax
+  800d8b:	be 00 00 00 00       	mov    $0x0,%esi
+  800d90:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d93:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d96:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  800d98:	5b                   	pop    %ebx
+  800d99:	5e                   	pop    %esi
+  800d9a:	5f                   	pop    %edi
+  800d9b:	5d                   	pop    %ebp
+  800d9c:	c3                   	ret
+
+00800d9d <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  800d9d:	55                   	push   %ebp
+  800d9e:	89 e5                	mov    %esp,%ebp
+  800da0:	57                   	push   %edi
+  800da1:	56                   	push   %esi
+  800da2:	53                   	push   %ebx
+  800da3:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800da6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dab:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800db1:	b8 16 00 00 00       	mov    $0x16,%eax
+  800db6:	89 df                	mov    %ebx,%edi
+  800db8:	89 de                	mov    %ebx,%esi
+  800dba:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800dbc:	85 c0                	test   %eax,%eax
+  800dbe:	7f 08                	jg     800dc8 <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  800dc0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dc3:	5b                   	pop    %ebx
+  800dc4:	5e                   	pop    %esi
+  800dc5:	5f                   	pop    %edi
+  800dc6:	5d                   	pop    %ebp
+  800dc7:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800dc8:	83 ec 0c             	sub    $0xc,%esp
+  800dcb:	50                   	push   %eax
+  800dcc:	6a 16                	push   $0x16
+  800dce:	68 03 34 80 00       	push   $0x803403
+  800dd3:	6a 23                	push   $0x23
+  800dd5:	68 20 34 80 00       	push   $0x803420
+  800dda:	e8 bb f3 ff ff       	call   80019a <_panic>
+
+00800ddf <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  800ddf:	55                   	push   %ebp
+  800de0:	89 e5                	mov    %esp,%ebp
+  800de2:	57                   	push   %edi
+  800de3:	56                   	push   %esi
+  800de4:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800de5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800dea:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ded:	b8 17 00 00 00       	mov    $0x17,%eax
+  800df2:	89 cb                	mov    %ecx,%ebx
+  800df4:	89 cf                	mov    %ecx,%edi
+  800df6:	89 ce                	mov    %ecx,%esi
+  800df8:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  800dfa:	5b                   	pop    %ebx
+  800dfb:	5e                   	pop    %esi
+  800dfc:	5f                   	pop    %edi
+  800dfd:	5d                   	pop    %ebp
+  800dfe:	c3                   	ret
+
+00800dff <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  800dff:	55                   	push   %ebp
+  800e00:	89 e5                	mov    %esp,%ebp
+  800e02:	57                   	push   %edi
+  800e03:	56                   	push   %esi
+  800e04:	53                   	push   %ebx
+  800e05:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e08:	be 00 00 00 00       	mov    $0x0,%esi
+  800e0d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e10:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e13:	b8 18 00 00 00       	mov    $0x18,%eax
+  800e18:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e1b:	89 f7                	mov    %esi,%edi
+  800e1d:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e1f:	85 c0                	test   %eax,%eax
+  800e21:	7f 08                	jg     800e2b <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  800e23:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e26:	5b                   	pop    %ebx
+  800e27:	5e                   	pop    %esi
+  800e28:	5f                   	pop    %edi
+  800e29:	5d                   	pop    %ebp
+  800e2a:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e2b:	83 ec 0c             	sub    $0xc,%esp
+  800e2e:	50                   	push   %eax
+  800e2f:	6a 18                	push   $0x18
+  800e31:	68 03 34 80 00       	push   $0x803403
+  800e36:	6a 23                	push   $0x23
+  800e38:	68 20 34 80 00       	push   $0x803420
+  800e3d:	e8 58 f3 ff ff       	call   80019a <_panic>
+
+00800e42 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  800e42:	55                   	push   %ebp
+  800e43:	89 e5                	mov    %esp,%ebp
+  800e45:	57                   	push   %edi
+  800e46:	56                   	push   %esi
+  800e47:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e48:	be 00 00 00 00       	mov    $0x0,%esi
+  800e4d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e50:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e53:	b8 19 00 00 00       	mov    $0x19,%eax
+  800e58:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e5b:	89 f7                	mov    %esi,%edi
+  800e5d:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  800e5f:	5b                   	pop    %ebx
+  800e60:	5e                   	pop    %esi
+  800e61:	5f                   	pop    %edi
+  800e62:	5d                   	pop    %ebp
+  800e63:	c3                   	ret
+
+00800e64 <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  800e64:	55                   	push   %ebp
+  800e65:	89 e5                	mov    %esp,%ebp
+  800e67:	57                   	push   %edi
+  800e68:	56                   	push   %esi
+  800e69:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e6a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e6f:	b8 15 00 00 00       	mov    $0x15,%eax
+  800e74:	89 d1                	mov    %edx,%ecx
+  800e76:	89 d3                	mov    %edx,%ebx
+  800e78:	89 d7                	mov    %edx,%edi
+  800e7a:	89 d6                	mov    %edx,%esi
+  800e7c:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800e7e:	5b                   	pop    %ebx
+  800e7f:	5e                   	pop    %esi
+  800e80:	5f                   	pop    %edi
+  800e81:	5d                   	pop    %ebp
+  800e82:	c3                   	ret
+
+00800e83 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800e83:	55                   	push   %ebp
+  800e84:	89 e5                	mov    %esp,%ebp
+  800e86:	57                   	push   %edi
+  800e87:	56                   	push   %esi
+  800e88:	53                   	push   %ebx
+  800e89:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e8c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e91:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e94:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e97:	b8 08 00 00 00       	mov    $0x8,%eax
+  800e9c:	89 df                	mov    %ebx,%edi
+  800e9e:	89 de                	mov    %ebx,%esi
+  800ea0:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ea2:	85 c0                	test   %eax,%eax
+  800ea4:	7f 08                	jg     800eae <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800ea6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ea9:	5b                   	pop    %ebx
+  800eaa:	5e                   	pop    %esi
+  800eab:	5f                   	pop    %edi
+  800eac:	5d                   	pop    %ebp
+  800ead:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800eae:	83 ec 0c             	sub    $0xc,%esp
+  800eb1:	50                   	push   %eax
+  800eb2:	6a 08                	push   $0x8
+  800eb4:	68 03 34 80 00       	push   $0x803403
+  800eb9:	6a 23                	push   $0x23
+  800ebb:	68 20 34 80 00       	push   $0x803420
+  800ec0:	e8 d5 f2 ff ff       	call   80019a <_panic>
+
+00800ec5 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800ec5:	55                   	push   %ebp
+  800ec6:	89 e5                	mov    %esp,%ebp
+  800ec8:	57                   	push   %edi
+  800ec9:	56                   	push   %esi
+  800eca:	53                   	push   %ebx
+  800ecb:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800ece:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ed3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ed6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ed9:	b8 09 00 00 00       	mov    $0x9,%eax
+  800ede:	89 df                	mov    %ebx,%edi
+  800ee0:	89 de                	mov    %ebx,%esi
+  800ee2:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ee4:	85 c0                	test   %eax,%eax
+  800ee6:	7f 08                	jg     800ef0 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  800ee8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eeb:	5b                   	pop    %ebx
+  800eec:	5e                   	pop    %esi
+  800eed:	5f                   	pop    %edi
+  800eee:	5d                   	pop    %ebp
+  800eef:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ef0:	83 ec 0c             	sub    $0xc,%esp
+  800ef3:	50                   	push   %eax
+  800ef4:	6a 09                	push   $0x9
+  800ef6:	68 03 34 80 00       	push   $0x803403
+  800efb:	6a 23                	push   $0x23
+  800efd:	68 20 34 80 00       	push   $0x803420
+  800f02:	e8 93 f2 ff ff       	call   80019a <_panic>
+
+00800f07 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800f07:	55                   	push   %ebp
+  800f08:	89 e5                	mov    %esp,%ebp
+  800f0a:	57                   	push   %edi
+  800f0b:	56                   	push   %esi
+  800f0c:	53                   	push   %ebx
+  800f0d:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f10:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f15:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f18:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f1b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f20:	89 df                	mov    %ebx,%edi
+  800f22:	89 de                	mov    %ebx,%esi
+  800f24:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f26:	85 c0                	test   %eax,%eax
+  800f28:	7f 08                	jg     800f32 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  800f2a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f2d:	5b                   	pop    %ebx
+  800f2e:	5e                   	pop    %esi
+  800f2f:	5f                   	pop    %edi
+  800f30:	5d                   	pop    %ebp
+  800f31:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f32:	83 ec 0c             	sub    $0xc,%esp
+  800f35:	50                   	push   %eax
+  800f36:	6a 0a                	push   $0xa
+  800f38:	68 03 34 80 00       	push   $0x803403
+  800f3d:	6a 23                	push   $0x23
+  800f3f:	68 20 34 80 00       	push   $0x803420
+  800f44:	e8 51 f2 ff ff       	call   80019a <_panic>
+
+00800f49 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  800f49:	55                   	push   %ebp
+  800f4a:	89 e5                	mov    %esp,%ebp
+  800f4c:	57                   	push   %edi
+  800f4d:	56                   	push   %esi
+  800f4e:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f4f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f52:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f55:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f5a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f5d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f60:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f63:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  800f65:	5b                   	pop    %ebx
+  800f66:	5e                   	pop    %esi
+  800f67:	5f                   	pop    %edi
+  800f68:	5d                   	pop    %ebp
+  800f69:	c3                   	ret
+
+00800f6a <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  800f6a:	55                   	push   %ebp
+  800f6b:	89 e5                	mov    %esp,%ebp
+  800f6d:	57                   	push   %edi
+  800f6e:	56                   	push   %esi
+  800f6f:	53                   	push   %ebx
+  800f70:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f73:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f78:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f7b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f7e:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f83:	89 df                	mov    %ebx,%edi
+  800f85:	89 de                	mov    %ebx,%esi
+  800f87:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f89:	85 c0                	test   %eax,%eax
+  800f8b:	7f 08                	jg     800f95 <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  800f8d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f90:	5b                   	pop    %ebx
+  800f91:	5e                   	pop    %esi
+  800f92:	5f                   	pop    %edi
+  800f93:	5d                   	pop    %ebp
+  800f94:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f95:	83 ec 0c             	sub    $0xc,%esp
+  800f98:	50                   	push   %eax
+  800f99:	6a 0d                	push   $0xd
+  800f9b:	68 03 34 80 00       	push   $0x803403
+  800fa0:	6a 23                	push   $0x23
+  800fa2:	68 20 34 80 00       	push   $0x803420
+  800fa7:	e8 ee f1 ff ff       	call   80019a <_panic>
+
+00800fac <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  800fac:	55                   	push   %ebp
+  800fad:	89 e5                	mov    %esp,%ebp
+  800faf:	57                   	push   %edi
+  800fb0:	56                   	push   %esi
+  800fb1:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800fb2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fb7:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800fbc:	89 d1                	mov    %edx,%ecx
+  800fbe:	89 d3                	mov    %edx,%ebx
+  800fc0:	89 d7                	mov    %edx,%edi
+  800fc2:	89 d6                	mov    %edx,%esi
+  800fc4:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800fc6:	5b                   	pop    %ebx
+  800fc7:	5e                   	pop    %esi
+  800fc8:	5f                   	pop    %edi
+  800fc9:	5d                   	pop    %ebp
+  800fca:	c3                   	ret
+
+00800fcb <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  800fcb:	55                   	push   %ebp
+  800fcc:	89 e5                	mov    %esp,%ebp
+  800fce:	57                   	push   %edi
+  800fcf:	56                   	push   %esi
+  800fd0:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800fd1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fd4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fd7:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800fdc:	be 00 00 00 00       	mov    $0x0,%esi
+  800fe1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fe4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fe7:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  800fe9:	5b                   	pop    %ebx
+  800fea:	5e                   	pop    %esi
+  800feb:	5f                   	pop    %edi
+  800fec:	5d                   	pop    %ebp
+  800fed:	c3                   	ret
+
+00800fee <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  800fee:	55                   	push   %ebp
+  800fef:	89 e5                	mov    %esp,%ebp
+  800ff1:	57                   	push   %edi
+  800ff2:	56                   	push   %esi
+  800ff3:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800ff4:	be 00 00 00 00       	mov    $0x0,%esi
+  800ff9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ffc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fff:	b8 10 00 00 00       	mov    $0x10,%eax
+  801004:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801007:	89 f7                	mov    %esi,%edi
+  801009:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  80100b:	5b                   	pop    %ebx
+  80100c:	5e                   	pop    %esi
+  80100d:	5f                   	pop    %edi
+  80100e:	5d                   	pop    %ebp
+  80100f:	c3                   	ret
+
+00801010 <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  801010:	55                   	push   %ebp
+  801011:	89 e5                	mov    %esp,%ebp
+  801013:	57                   	push   %edi
+  801014:	56                   	push   %esi
+  801015:	53                   	push   %ebx
+  801016:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  801019:	80 3d 04 80 80 00 00 	cmpb   $0x0,0x808004
+  801020:	74 41                	je     801063 <sys_batch+0x53>
+  801022:	8b 45 08             	mov    0x8(%ebp),%eax
+  801025:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  801028:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  80102f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801032:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  801035:	7d 45                	jge    80107c <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  801037:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80103a:	8b 06                	mov    (%esi),%eax
+  80103c:	8b 56 04             	mov    0x4(%esi),%edx
+  80103f:	8b 4e 08             	mov    0x8(%esi),%ecx
+  801042:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  801045:	8b 7e 10             	mov    0x10(%esi),%edi
+  801048:	8b 76 14             	mov    0x14(%esi),%esi
+  80104b:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  80104d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801050:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  801053:	83 c6 1c             	add    $0x1c,%esi
+  801056:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  801059:	85 c0                	test   %eax,%eax
+  80105b:	78 1f                	js     80107c <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  80105d:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  801061:	eb cc                	jmp    80102f <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  801063:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801068:	b8 13 00 00 00       	mov    $0x13,%eax
+  80106d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801070:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801073:	89 df                	mov    %ebx,%edi
+  801075:	89 de                	mov    %ebx,%esi
+  801077:	cd 30                	int    $0x30
+  801079:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  80107c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80107f:	83 c4 08             	add    $0x8,%esp
+  801082:	5b                   	pop    %ebx
+  801083:	5e                   	pop    %esi
+  801084:	5f                   	pop    %edi
+  801085:	5d                   	pop    %ebp
+  801086:	c3                   	ret
+
+00801087 <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  801087:	55                   	push   %ebp
+  801088:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  80108a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80108d:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  801093:	5d                   	pop    %ebp
+  801094:	c3                   	ret
+
+00801095 <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  801095:	55                   	push   %ebp
+  801096:	89 e5                	mov    %esp,%ebp
+  801098:	56                   	push   %esi
+  801099:	53                   	push   %ebx
+  80109a:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  80109d:	8b 1e                	mov    (%esi),%ebx
+  80109f:	85 db                	test   %ebx,%ebx
+  8010a1:	75 09                	jne    8010ac <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  8010a3:	89 d8                	mov    %ebx,%eax
+  8010a5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8010a8:	5b                   	pop    %ebx
+  8010a9:	5e                   	pop    %esi
+  8010aa:	5d                   	pop    %ebp
+  8010ab:	c3                   	ret
+  b->sb_n = 0;
+  8010ac:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  8010b2:	53                   	push   %ebx
+  8010b3:	8d 46 04             	lea    0x4(%esi),%eax
+  8010b6:	50                   	push   %eax
+  8010b7:	e8 54 ff ff ff       	call   801010 <sys_batch>
+  8010bc:	83 c4 08             	add    $0x8,%esp
+  8010bf:	85 c0                	test   %eax,%eax
+  8010c1:	78 1e                	js     8010e1 <sysbatch_flush+0x4c>
+  if (r < n)
+  8010c3:	39 c3                	cmp    %eax,%ebx
+  8010c5:	7f 07                	jg     8010ce <sysbatch_flush+0x39>
+  return 0;
+  8010c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010cc:	eb d5                	jmp    8010a3 <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  8010ce:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8010d1:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  8010d5:	85 db                	test   %ebx,%ebx
+  8010d7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8010dc:	0f 49 d8             	cmovns %eax,%ebx
+  8010df:	eb c2                	jmp    8010a3 <sysbatch_flush+0xe>
+    return r;
+  8010e1:	89 c3                	mov    %eax,%ebx
+  8010e3:	eb be                	jmp    8010a3 <sysbatch_flush+0xe>
+
+008010e5 <sysbatch_add>:
+{
+  8010e5:	55                   	push   %ebp
+  8010e6:	89 e5                	mov    %esp,%ebp
+  8010e8:	53                   	push   %ebx
+  8010e9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  8010ec:	83 3b 40             	cmpl   $0x40,(%ebx)
+  8010ef:	74 41                	je     801132 <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  8010f1:	8b 03                	mov    (%ebx),%eax
+  8010f3:	8d 50 01             	lea    0x1(%eax),%edx
+  8010f6:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  8010f8:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8010fb:	01 d8                	add    %ebx,%eax
+  8010fd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801100:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  801103:	8b 55 10             	mov    0x10(%ebp),%edx
+  801106:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  801109:	8b 55 14             	mov    0x14(%ebp),%edx
+  80110c:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  80110f:	8b 55 18             	mov    0x18(%ebp),%edx
+  801112:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  801115:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  801118:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  80111b:	8b 55 20             	mov    0x20(%ebp),%edx
+  80111e:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  801121:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  801128:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80112d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801130:	c9                   	leave
+  801131:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  801132:	53                   	push   %ebx
+  801133:	e8 5d ff ff ff       	call   801095 <sysbatch_flush>
+  801138:	83 c4 04             	add    $0x4,%esp
+  80113b:	85 c0                	test   %eax,%eax
+  80113d:	79 b2                	jns    8010f1 <sysbatch_add+0xc>
+  80113f:	eb ec                	jmp    80112d <sysbatch_add+0x48>
+
+00801141 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801141:	55                   	push   %ebp
+  801142:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801144:	8b 45 08             	mov    0x8(%ebp),%eax
+  801147:	05 00 00 00 30       	add    $0x30000000,%eax
+  80114c:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80114f:	5d                   	pop    %ebp
+  801150:	c3                   	ret
+
+00801151 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801151:	55                   	push   %ebp
+  801152:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801154:	8b 45 08             	mov    0x8(%ebp),%eax
+  801157:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  80115a:	66 b8 00 00          	mov    $0x0,%ax
+  80115e:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801163:	5d                   	pop    %ebp
+  801164:	c3                   	ret
+
+00801165 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801165:	55                   	push   %ebp
+  801166:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  801168:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80116d:	eb 02                	jmp    801171 <fd_alloc+0xc>
+  80116f:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801171:	89 c2                	mov    %eax,%edx
+  801173:	c1 ea 16             	shr    $0x16,%edx
+  801176:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80117d:	f6 c2 01             	test   $0x1,%dl
+  801180:	74 2b                	je     8011ad <fd_alloc+0x48>
+  801182:	89 c2                	mov    %eax,%edx
+  801184:	c1 ea 0c             	shr    $0xc,%edx
+  801187:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80118e:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801194:	f6 c1 01             	test   $0x1,%cl
+  801197:	74 14                	je     8011ad <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  801199:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  80119f:	75 ce                	jne    80116f <fd_alloc+0xa>
+  8011a1:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  8011a6:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8011ab:	eb 05                	jmp    8011b2 <fd_alloc+0x4d>
+      return 0;
+  8011ad:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  8011b2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011b5:	89 02                	mov    %eax,(%edx)
+}
+  8011b7:	89 c8                	mov    %ecx,%eax
+  8011b9:	5d                   	pop    %ebp
+  8011ba:	c3                   	ret
+
+008011bb <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8011bb:	55                   	push   %ebp
+  8011bc:	89 e5                	mov    %esp,%ebp
+  8011be:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  8011c1:	83 f8 1f             	cmp    $0x1f,%eax
+  8011c4:	77 30                	ja     8011f6 <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  8011c6:	c1 e0 0c             	shl    $0xc,%eax
+  8011c9:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8011ce:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8011d4:	f6 c2 01             	test   $0x1,%dl
+  8011d7:	74 24                	je     8011fd <fd_lookup+0x42>
+  8011d9:	89 c2                	mov    %eax,%edx
+  8011db:	c1 ea 0c             	shr    $0xc,%edx
+  8011de:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8011e5:	f6 c2 01             	test   $0x1,%dl
+  8011e8:	74 1a                	je     801204 <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  8011ea:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8011ed:	89 02                	mov    %eax,(%edx)
+  return 0;
+  8011ef:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011f4:	5d                   	pop    %ebp
+  8011f5:	c3                   	ret
+    return -E_INVAL;
+  8011f6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011fb:	eb f7                	jmp    8011f4 <fd_lookup+0x39>
+    return -E_INVAL;
+  8011fd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801202:	eb f0                	jmp    8011f4 <fd_lookup+0x39>
+  801204:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801209:	eb e9                	jmp    8011f4 <fd_lookup+0x39>
+
+0080120b <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80120b:	55                   	push   %ebp
+  80120c:	89 e5                	mov    %esp,%ebp
+  80120e:	53                   	push   %ebx
+  80120f:	83 ec 04             	sub    $0x4,%esp
+  801212:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  801215:	b8 ac 34 80 00       	mov    $0x8034ac,%eax
+  80121a:	8b 18                	mov    (%eax),%ebx
+  80121c:	85 db                	test   %ebx,%ebx
+  80121e:	74 0e                	je     80122e <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  801220:	83 c0 04             	add    $0x4,%eax
+  801223:	39 13                	cmp    %edx,(%ebx)
+  801225:	75 f3                	jne    80121a <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  801227:	b8 00 00 00 00       	mov    $0x0,%eax
+  80122c:	eb 1f                	jmp    80124d <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80122e:	a1 00 80 80 00       	mov    0x808000,%eax
+  801233:	8b 40 48             	mov    0x48(%eax),%eax
+  801236:	83 ec 04             	sub    $0x4,%esp
+  801239:	52                   	push   %edx
+  80123a:	50                   	push   %eax
+  80123b:	68 30 34 80 00       	push   $0x803430
+  801240:	e8 30 f0 ff ff       	call   800275 <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  801245:	83 c4 10             	add    $0x10,%esp
+  801248:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  80124d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801250:	89 1a                	mov    %ebx,(%edx)
+}
+  801252:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801255:	c9                   	leave
+  801256:	c3                   	ret
+
+00801257 <fd_close>:
+{
+  801257:	55                   	push   %ebp
+  801258:	89 e5                	mov    %esp,%ebp
+  80125a:	57                   	push   %edi
+  80125b:	56                   	push   %esi
+  80125c:	53                   	push   %ebx
+  80125d:	83 ec 24             	sub    $0x24,%esp
+  801260:	8b 75 08             	mov    0x8(%ebp),%esi
+  801263:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801266:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801269:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80126a:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801270:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801273:	50                   	push   %eax
+  801274:	e8 42 ff ff ff       	call   8011bb <fd_lookup>
+  801279:	89 c3                	mov    %eax,%ebx
+  80127b:	83 c4 10             	add    $0x10,%esp
+  80127e:	85 c0                	test   %eax,%eax
+  801280:	78 05                	js     801287 <fd_close+0x30>
+      || fd != fd2)
+  801282:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801285:	74 16                	je     80129d <fd_close+0x46>
+    return must_exist ? r : 0;
+  801287:	89 f8                	mov    %edi,%eax
+  801289:	84 c0                	test   %al,%al
+  80128b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801290:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801293:	89 d8                	mov    %ebx,%eax
+  801295:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801298:	5b                   	pop    %ebx
+  801299:	5e                   	pop    %esi
+  80129a:	5f                   	pop    %edi
+  80129b:	5d                   	pop    %ebp
+  80129c:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80129d:	83 ec 08             	sub    $0x8,%esp
+  8012a0:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8012a3:	50                   	push   %eax
+  8012a4:	ff 36                	push   (%esi)
+  8012a6:	e8 60 ff ff ff       	call   80120b <dev_lookup>
+  8012ab:	89 c3                	mov    %eax,%ebx
+  8012ad:	83 c4 10             	add    $0x10,%esp
+  8012b0:	85 c0                	test   %eax,%eax
+  8012b2:	78 1a                	js     8012ce <fd_close+0x77>
+    if (dev->dev_close)
+  8012b4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8012b7:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  8012ba:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  8012bf:	85 c0                	test   %eax,%eax
+  8012c1:	74 0b                	je     8012ce <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  8012c3:	83 ec 0c             	sub    $0xc,%esp
+  8012c6:	56                   	push   %esi
+  8012c7:	ff d0                	call   *%eax
+  8012c9:	89 c3                	mov    %eax,%ebx
+  8012cb:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  8012ce:	83 ec 08             	sub    $0x8,%esp
+  8012d1:	56                   	push   %esi
+  8012d2:	6a 00                	push   $0x0
+  8012d4:	e8 3e fa ff ff       	call   800d17 <sys_page_unmap>
+  return r;
+  8012d9:	83 c4 10             	add    $0x10,%esp
+  8012dc:	eb b5                	jmp    801293 <fd_close+0x3c>
+
+008012de <close>:
+
+int
+close(int fdnum)
+{
+  8012de:	55                   	push   %ebp
+  8012df:	89 e5                	mov    %esp,%ebp
+  8012e1:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8012e4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8012e7:	50                   	push   %eax
+  8012e8:	ff 75 08             	push   0x8(%ebp)
+  8012eb:	e8 cb fe ff ff       	call   8011bb <fd_lookup>
+  8012f0:	83 c4 10             	add    $0x10,%esp
+  8012f3:	85 c0                	test   %eax,%eax
+  8012f5:	79 02                	jns    8012f9 <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  8012f7:	c9                   	leave
+  8012f8:	c3                   	ret
+    return fd_close(fd, 1);
+  8012f9:	83 ec 08             	sub    $0x8,%esp
+  8012fc:	6a 01                	push   $0x1
+  8012fe:	ff 75 f4             	push   -0xc(%ebp)
+  801301:	e8 51 ff ff ff       	call   801257 <fd_close>
+  801306:	83 c4 10             	add    $0x10,%esp
+  801309:	eb ec                	jmp    8012f7 <close+0x19>
+
+0080130b <close_all>:
+
+void
+close_all(void)
+{
+  80130b:	55                   	push   %ebp
+  80130c:	89 e5                	mov    %esp,%ebp
+  80130e:	53                   	push   %ebx
+  80130f:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  801312:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  801317:	83 ec 0c             	sub    $0xc,%esp
+  80131a:	53                   	push   %ebx
+  80131b:	e8 be ff ff ff       	call   8012de <close>
+  for (i = 0; i < MAXFD; i++)
+  801320:	83 c3 01             	add    $0x1,%ebx
+  801323:	83 c4 10             	add    $0x10,%esp
+  801326:	83 fb 20             	cmp    $0x20,%ebx
+  801329:	75 ec                	jne    801317 <close_all+0xc>
+}
+  80132b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80132e:	c9                   	leave
+  80132f:	c3                   	ret
+
+00801330 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801330:	55                   	push   %ebp
+  801331:	89 e5                	mov    %esp,%ebp
+  801333:	57                   	push   %edi
+  801334:	56                   	push   %esi
+  801335:	53                   	push   %ebx
+  801336:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801339:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80133c:	50                   	push   %eax
+  80133d:	ff 75 08             	push   0x8(%ebp)
+  801340:	e8 76 fe ff ff       	call   8011bb <fd_lookup>
+  801345:	89 c6                	mov    %eax,%esi
+  801347:	83 c4 10             	add    $0x10,%esp
+  80134a:	85 c0                	test   %eax,%eax
+  80134c:	0f 88 0a 01 00 00    	js     80145c <dup+0x12c>
+    return r;
+  close(newfdnum);
+  801352:	83 ec 0c             	sub    $0xc,%esp
+  801355:	ff 75 0c             	push   0xc(%ebp)
+  801358:	e8 81 ff ff ff       	call   8012de <close>
+
+  newfd = INDEX2FD(newfdnum);
+  80135d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801360:	c1 e0 0c             	shl    $0xc,%eax
+  801363:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  801369:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  80136c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80136f:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  801372:	89 04 24             	mov    %eax,(%esp)
+  801375:	e8 d7 fd ff ff       	call   801151 <fd2data>
+  80137a:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  80137c:	89 3c 24             	mov    %edi,(%esp)
+  80137f:	e8 cd fd ff ff       	call   801151 <fd2data>
+  801384:	83 c4 10             	add    $0x10,%esp
+  801387:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80138a:	89 f3                	mov    %esi,%ebx
+  80138c:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  801392:	89 c6                	mov    %eax,%esi
+  801394:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801397:	89 cf                	mov    %ecx,%edi
+  801399:	eb 0c                	jmp    8013a7 <dup+0x77>
+  80139b:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8013a1:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8013a7:	39 fb                	cmp    %edi,%ebx
+  8013a9:	74 7b                	je     801426 <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  8013ab:	89 d8                	mov    %ebx,%eax
+  8013ad:	c1 e8 16             	shr    $0x16,%eax
+  8013b0:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8013b7:	a8 01                	test   $0x1,%al
+  8013b9:	74 e0                	je     80139b <dup+0x6b>
+  8013bb:	89 d8                	mov    %ebx,%eax
+  8013bd:	c1 e8 0c             	shr    $0xc,%eax
+  8013c0:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8013c7:	f6 c2 01             	test   $0x1,%dl
+  8013ca:	74 cf                	je     80139b <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  8013cc:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  8013d3:	83 ec 0c             	sub    $0xc,%esp
+  8013d6:	25 07 0e 00 00       	and    $0xe07,%eax
+  8013db:	50                   	push   %eax
+  8013dc:	56                   	push   %esi
+  8013dd:	6a 00                	push   $0x0
+  8013df:	53                   	push   %ebx
+  8013e0:	6a 00                	push   $0x0
+  8013e2:	e8 ee f8 ff ff       	call   800cd5 <sys_page_map>
+  8013e7:	83 c4 20             	add    $0x20,%esp
+  8013ea:	85 c0                	test   %eax,%eax
+  8013ec:	79 ad                	jns    80139b <dup+0x6b>
+  8013ee:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8013f1:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  8013f3:	83 ec 08             	sub    $0x8,%esp
+  8013f6:	ff 75 d4             	push   -0x2c(%ebp)
+  8013f9:	6a 00                	push   $0x0
+  8013fb:	e8 17 f9 ff ff       	call   800d17 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801400:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  801403:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  801409:	83 c4 10             	add    $0x10,%esp
+  80140c:	39 df                	cmp    %ebx,%edi
+  80140e:	74 4c                	je     80145c <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  801410:	83 ec 08             	sub    $0x8,%esp
+  801413:	57                   	push   %edi
+  801414:	6a 00                	push   $0x0
+  801416:	e8 fc f8 ff ff       	call   800d17 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80141b:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  801421:	83 c4 10             	add    $0x10,%esp
+  801424:	eb e6                	jmp    80140c <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801426:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801429:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80142c:	89 c8                	mov    %ecx,%eax
+  80142e:	c1 e8 0c             	shr    $0xc,%eax
+  801431:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801438:	83 ec 0c             	sub    $0xc,%esp
+  80143b:	25 07 0e 00 00       	and    $0xe07,%eax
+  801440:	50                   	push   %eax
+  801441:	ff 75 d4             	push   -0x2c(%ebp)
+  801444:	6a 00                	push   $0x0
+  801446:	51                   	push   %ecx
+  801447:	6a 00                	push   $0x0
+  801449:	e8 87 f8 ff ff       	call   800cd5 <sys_page_map>
+  80144e:	89 c6                	mov    %eax,%esi
+  801450:	83 c4 20             	add    $0x20,%esp
+  801453:	85 c0                	test   %eax,%eax
+  801455:	78 9c                	js     8013f3 <dup+0xc3>
+  return newfdnum;
+  801457:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80145a:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  80145c:	89 f0                	mov    %esi,%eax
+  80145e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801461:	5b                   	pop    %ebx
+  801462:	5e                   	pop    %esi
+  801463:	5f                   	pop    %edi
+  801464:	5d                   	pop    %ebp
+  801465:	c3                   	ret
+
+00801466 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801466:	55                   	push   %ebp
+  801467:	89 e5                	mov    %esp,%ebp
+  801469:	56                   	push   %esi
+  80146a:	53                   	push   %ebx
+  80146b:	83 ec 18             	sub    $0x18,%esp
+  80146e:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801471:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801474:	50                   	push   %eax
+  801475:	56                   	push   %esi
+  801476:	e8 40 fd ff ff       	call   8011bb <fd_lookup>
+  80147b:	83 c4 10             	add    $0x10,%esp
+  80147e:	85 c0                	test   %eax,%eax
+  801480:	78 3c                	js     8014be <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801482:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801485:	83 ec 08             	sub    $0x8,%esp
+  801488:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80148b:	50                   	push   %eax
+  80148c:	ff 33                	push   (%ebx)
+  80148e:	e8 78 fd ff ff       	call   80120b <dev_lookup>
+  801493:	83 c4 10             	add    $0x10,%esp
+  801496:	85 c0                	test   %eax,%eax
+  801498:	78 24                	js     8014be <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80149a:	8b 43 08             	mov    0x8(%ebx),%eax
+  80149d:	83 e0 03             	and    $0x3,%eax
+  8014a0:	83 f8 01             	cmp    $0x1,%eax
+  8014a3:	74 20                	je     8014c5 <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  8014a5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014a8:	8b 40 08             	mov    0x8(%eax),%eax
+  8014ab:	85 c0                	test   %eax,%eax
+  8014ad:	74 37                	je     8014e6 <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  8014af:	83 ec 04             	sub    $0x4,%esp
+  8014b2:	ff 75 10             	push   0x10(%ebp)
+  8014b5:	ff 75 0c             	push   0xc(%ebp)
+  8014b8:	53                   	push   %ebx
+  8014b9:	ff d0                	call   *%eax
+  8014bb:	83 c4 10             	add    $0x10,%esp
+}
+  8014be:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014c1:	5b                   	pop    %ebx
+  8014c2:	5e                   	pop    %esi
+  8014c3:	5d                   	pop    %ebp
+  8014c4:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8014c5:	a1 00 80 80 00       	mov    0x808000,%eax
+  8014ca:	8b 40 48             	mov    0x48(%eax),%eax
+  8014cd:	83 ec 04             	sub    $0x4,%esp
+  8014d0:	56                   	push   %esi
+  8014d1:	50                   	push   %eax
+  8014d2:	68 71 34 80 00       	push   $0x803471
+  8014d7:	e8 99 ed ff ff       	call   800275 <cprintf>
+    return -E_INVAL;
+  8014dc:	83 c4 10             	add    $0x10,%esp
+  8014df:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014e4:	eb d8                	jmp    8014be <read+0x58>
+    return -E_NOT_SUPP;
+  8014e6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8014eb:	eb d1                	jmp    8014be <read+0x58>
+
+008014ed <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8014ed:	55                   	push   %ebp
+  8014ee:	89 e5                	mov    %esp,%ebp
+  8014f0:	57                   	push   %edi
+  8014f1:	56                   	push   %esi
+  8014f2:	53                   	push   %ebx
+  8014f3:	83 ec 0c             	sub    $0xc,%esp
+  8014f6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8014f9:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  8014fc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801501:	eb 02                	jmp    801505 <readn+0x18>
+  801503:	01 c3                	add    %eax,%ebx
+  801505:	39 f3                	cmp    %esi,%ebx
+  801507:	73 21                	jae    80152a <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  801509:	83 ec 04             	sub    $0x4,%esp
+  80150c:	89 f0                	mov    %esi,%eax
+  80150e:	29 d8                	sub    %ebx,%eax
+  801510:	50                   	push   %eax
+  801511:	89 d8                	mov    %ebx,%eax
+  801513:	03 45 0c             	add    0xc(%ebp),%eax
+  801516:	50                   	push   %eax
+  801517:	57                   	push   %edi
+  801518:	e8 49 ff ff ff       	call   801466 <read>
+    if (m < 0)
+  80151d:	83 c4 10             	add    $0x10,%esp
+  801520:	85 c0                	test   %eax,%eax
+  801522:	78 04                	js     801528 <readn+0x3b>
+      return m;
+    if (m == 0)
+  801524:	75 dd                	jne    801503 <readn+0x16>
+  801526:	eb 02                	jmp    80152a <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  801528:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  80152a:	89 d8                	mov    %ebx,%eax
+  80152c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80152f:	5b                   	pop    %ebx
+  801530:	5e                   	pop    %esi
+  801531:	5f                   	pop    %edi
+  801532:	5d                   	pop    %ebp
+  801533:	c3                   	ret
+
+00801534 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801534:	55                   	push   %ebp
+  801535:	89 e5                	mov    %esp,%ebp
+  801537:	56                   	push   %esi
+  801538:	53                   	push   %ebx
+  801539:	83 ec 18             	sub    $0x18,%esp
+  80153c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  80153f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801542:	50                   	push   %eax
+  801543:	53                   	push   %ebx
+  801544:	e8 72 fc ff ff       	call   8011bb <fd_lookup>
+  801549:	83 c4 10             	add    $0x10,%esp
+  80154c:	85 c0                	test   %eax,%eax
+  80154e:	78 37                	js     801587 <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801550:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801553:	83 ec 08             	sub    $0x8,%esp
+  801556:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801559:	50                   	push   %eax
+  80155a:	ff 36                	push   (%esi)
+  80155c:	e8 aa fc ff ff       	call   80120b <dev_lookup>
+  801561:	83 c4 10             	add    $0x10,%esp
+  801564:	85 c0                	test   %eax,%eax
+  801566:	78 1f                	js     801587 <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801568:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80156c:	74 20                	je     80158e <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  80156e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801571:	8b 40 0c             	mov    0xc(%eax),%eax
+  801574:	85 c0                	test   %eax,%eax
+  801576:	74 37                	je     8015af <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  801578:	83 ec 04             	sub    $0x4,%esp
+  80157b:	ff 75 10             	push   0x10(%ebp)
+  80157e:	ff 75 0c             	push   0xc(%ebp)
+  801581:	56                   	push   %esi
+  801582:	ff d0                	call   *%eax
+  801584:	83 c4 10             	add    $0x10,%esp
+}
+  801587:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80158a:	5b                   	pop    %ebx
+  80158b:	5e                   	pop    %esi
+  80158c:	5d                   	pop    %ebp
+  80158d:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80158e:	a1 00 80 80 00       	mov    0x808000,%eax
+  801593:	8b 40 48             	mov    0x48(%eax),%eax
+  801596:	83 ec 04             	sub    $0x4,%esp
+  801599:	53                   	push   %ebx
+  80159a:	50                   	push   %eax
+  80159b:	68 8d 34 80 00       	push   $0x80348d
+  8015a0:	e8 d0 ec ff ff       	call   800275 <cprintf>
+    return -E_INVAL;
+  8015a5:	83 c4 10             	add    $0x10,%esp
+  8015a8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015ad:	eb d8                	jmp    801587 <write+0x53>
+    return -E_NOT_SUPP;
+  8015af:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015b4:	eb d1                	jmp    801587 <write+0x53>
+
+008015b6 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8015b6:	55                   	push   %ebp
+  8015b7:	89 e5                	mov    %esp,%ebp
+  8015b9:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8015bc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015bf:	50                   	push   %eax
+  8015c0:	ff 75 08             	push   0x8(%ebp)
+  8015c3:	e8 f3 fb ff ff       	call   8011bb <fd_lookup>
+  8015c8:	83 c4 10             	add    $0x10,%esp
+  8015cb:	85 c0                	test   %eax,%eax
+  8015cd:	78 0e                	js     8015dd <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  8015cf:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8015d2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015d5:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  8015d8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015dd:	c9                   	leave
+  8015de:	c3                   	ret
+
+008015df <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8015df:	55                   	push   %ebp
+  8015e0:	89 e5                	mov    %esp,%ebp
+  8015e2:	56                   	push   %esi
+  8015e3:	53                   	push   %ebx
+  8015e4:	83 ec 18             	sub    $0x18,%esp
+  8015e7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  8015ea:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8015ed:	50                   	push   %eax
+  8015ee:	53                   	push   %ebx
+  8015ef:	e8 c7 fb ff ff       	call   8011bb <fd_lookup>
+  8015f4:	83 c4 10             	add    $0x10,%esp
+  8015f7:	85 c0                	test   %eax,%eax
+  8015f9:	78 34                	js     80162f <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8015fb:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8015fe:	83 ec 08             	sub    $0x8,%esp
+  801601:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801604:	50                   	push   %eax
+  801605:	ff 36                	push   (%esi)
+  801607:	e8 ff fb ff ff       	call   80120b <dev_lookup>
+  80160c:	83 c4 10             	add    $0x10,%esp
+  80160f:	85 c0                	test   %eax,%eax
+  801611:	78 1c                	js     80162f <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801613:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801617:	74 1d                	je     801636 <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  801619:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80161c:	8b 40 18             	mov    0x18(%eax),%eax
+  80161f:	85 c0                	test   %eax,%eax
+  801621:	74 34                	je     801657 <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  801623:	83 ec 08             	sub    $0x8,%esp
+  801626:	ff 75 0c             	push   0xc(%ebp)
+  801629:	56                   	push   %esi
+  80162a:	ff d0                	call   *%eax
+  80162c:	83 c4 10             	add    $0x10,%esp
+}
+  80162f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801632:	5b                   	pop    %ebx
+  801633:	5e                   	pop    %esi
+  801634:	5d                   	pop    %ebp
+  801635:	c3                   	ret
+            thisenv->env_id, fdnum);
+  801636:	a1 00 80 80 00       	mov    0x808000,%eax
+  80163b:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80163e:	83 ec 04             	sub    $0x4,%esp
+  801641:	53                   	push   %ebx
+  801642:	50                   	push   %eax
+  801643:	68 50 34 80 00       	push   $0x803450
+  801648:	e8 28 ec ff ff       	call   800275 <cprintf>
+    return -E_INVAL;
+  80164d:	83 c4 10             	add    $0x10,%esp
+  801650:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801655:	eb d8                	jmp    80162f <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  801657:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80165c:	eb d1                	jmp    80162f <ftruncate+0x50>
+
+0080165e <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80165e:	55                   	push   %ebp
+  80165f:	89 e5                	mov    %esp,%ebp
+  801661:	56                   	push   %esi
+  801662:	53                   	push   %ebx
+  801663:	83 ec 18             	sub    $0x18,%esp
+  801666:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801669:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80166c:	50                   	push   %eax
+  80166d:	ff 75 08             	push   0x8(%ebp)
+  801670:	e8 46 fb ff ff       	call   8011bb <fd_lookup>
+  801675:	83 c4 10             	add    $0x10,%esp
+  801678:	85 c0                	test   %eax,%eax
+  80167a:	78 49                	js     8016c5 <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80167c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80167f:	83 ec 08             	sub    $0x8,%esp
+  801682:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801685:	50                   	push   %eax
+  801686:	ff 36                	push   (%esi)
+  801688:	e8 7e fb ff ff       	call   80120b <dev_lookup>
+  80168d:	83 c4 10             	add    $0x10,%esp
+  801690:	85 c0                	test   %eax,%eax
+  801692:	78 31                	js     8016c5 <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  801694:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801697:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80169b:	74 2f                	je     8016cc <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  80169d:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  8016a0:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8016a7:	00 00 00 
+  stat->st_isdir = 0;
+  8016aa:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8016b1:	00 00 00 
+  stat->st_dev = dev;
+  8016b4:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  8016ba:	83 ec 08             	sub    $0x8,%esp
+  8016bd:	53                   	push   %ebx
+  8016be:	56                   	push   %esi
+  8016bf:	ff 50 14             	call   *0x14(%eax)
+  8016c2:	83 c4 10             	add    $0x10,%esp
+}
+  8016c5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016c8:	5b                   	pop    %ebx
+  8016c9:	5e                   	pop    %esi
+  8016ca:	5d                   	pop    %ebp
+  8016cb:	c3                   	ret
+    return -E_NOT_SUPP;
+  8016cc:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016d1:	eb f2                	jmp    8016c5 <fstat+0x67>
+
+008016d3 <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  8016d3:	55                   	push   %ebp
+  8016d4:	89 e5                	mov    %esp,%ebp
+  8016d6:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  8016d9:	ff 75 0c             	push   0xc(%ebp)
+  8016dc:	ff 75 08             	push   0x8(%ebp)
+  8016df:	e8 58 07 00 00       	call   801e3c <file_stat>
+}
+  8016e4:	c9                   	leave
+  8016e5:	c3                   	ret
+
+008016e6 <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  8016e6:	55                   	push   %ebp
+  8016e7:	89 e5                	mov    %esp,%ebp
+  8016e9:	57                   	push   %edi
+  8016ea:	56                   	push   %esi
+  8016eb:	53                   	push   %ebx
+  8016ec:	83 ec 1c             	sub    $0x1c,%esp
+  8016ef:	89 c7                	mov    %eax,%edi
+  8016f1:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8016f4:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8016f7:	e9 a2 00 00 00       	jmp    80179e <fsipc_send+0xb8>
+  nfsenvs = 0;
+  8016fc:	c7 05 00 50 80 00 00 	movl   $0x0,0x805000
+  801703:	00 00 00 
+  801706:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80170b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801710:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801715:	be 01 00 00 00       	mov    $0x1,%esi
+  80171a:	eb 0f                	jmp    80172b <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  80171c:	83 c0 01             	add    $0x1,%eax
+  80171f:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801724:	74 49                	je     80176f <fsipc_send+0x89>
+  801726:	83 f9 07             	cmp    $0x7,%ecx
+  801729:	7f 50                	jg     80177b <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  80172b:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  80172e:	c1 e2 04             	shl    $0x4,%edx
+  801731:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801737:	8b 52 50             	mov    0x50(%edx),%edx
+  80173a:	83 fa 01             	cmp    $0x1,%edx
+  80173d:	75 dd                	jne    80171c <fsipc_send+0x36>
+  80173f:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801742:	c1 e2 04             	shl    $0x4,%edx
+  801745:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80174b:	8b 52 54             	mov    0x54(%edx),%edx
+  80174e:	85 d2                	test   %edx,%edx
+  801750:	74 ca                	je     80171c <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801752:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801755:	c1 e2 04             	shl    $0x4,%edx
+  801758:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80175e:	8b 52 48             	mov    0x48(%edx),%edx
+  801761:	89 14 8d 20 50 80 00 	mov    %edx,0x805020(,%ecx,4)
+  801768:	8d 49 01             	lea    0x1(%ecx),%ecx
+  80176b:	89 f3                	mov    %esi,%ebx
+  80176d:	eb ad                	jmp    80171c <fsipc_send+0x36>
+  80176f:	84 db                	test   %bl,%bl
+  801771:	74 38                	je     8017ab <fsipc_send+0xc5>
+  801773:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  801779:	eb 30                	jmp    8017ab <fsipc_send+0xc5>
+  80177b:	84 db                	test   %bl,%bl
+  80177d:	74 2c                	je     8017ab <fsipc_send+0xc5>
+  80177f:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  801785:	eb 24                	jmp    8017ab <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  801787:	50                   	push   %eax
+  801788:	68 bc 34 80 00       	push   $0x8034bc
+  80178d:	6a 34                	push   $0x34
+  80178f:	68 c6 34 80 00       	push   $0x8034c6
+  801794:	e8 01 ea ff ff       	call   80019a <_panic>
+    }
+    sys_yield();
+  801799:	e8 92 f4 ff ff       	call   800c30 <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  80179e:	83 3d 00 50 80 00 03 	cmpl   $0x3,0x805000
+  8017a5:	0f 8e 51 ff ff ff    	jle    8016fc <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  8017ab:	a1 00 80 80 00       	mov    0x808000,%eax
+  8017b0:	8b 70 48             	mov    0x48(%eax),%esi
+  8017b3:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  8017b9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017be:	8b 0d 00 50 80 00    	mov    0x805000,%ecx
+  8017c4:	39 d9                	cmp    %ebx,%ecx
+  8017c6:	7e d1                	jle    801799 <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  8017c8:	83 ec 0c             	sub    $0xc,%esp
+  8017cb:	ff 75 e0             	push   -0x20(%ebp)
+  8017ce:	6a 07                	push   $0x7
+  8017d0:	ff 75 e4             	push   -0x1c(%ebp)
+  8017d3:	57                   	push   %edi
+  8017d4:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  8017d7:	99                   	cltd
+  8017d8:	f7 f9                	idiv   %ecx
+  8017da:	ff 34 95 20 50 80 00 	push   0x805020(,%edx,4)
+  8017e1:	e8 63 f7 ff ff       	call   800f49 <sys_ipc_try_send>
+      if (r == 0)
+  8017e6:	83 c4 20             	add    $0x20,%esp
+  8017e9:	85 c0                	test   %eax,%eax
+  8017eb:	74 0a                	je     8017f7 <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  8017ed:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8017f0:	75 95                	jne    801787 <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  8017f2:	83 c3 01             	add    $0x1,%ebx
+  8017f5:	eb c7                	jmp    8017be <fsipc_send+0xd8>
+  }
+}
+  8017f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017fa:	5b                   	pop    %ebx
+  8017fb:	5e                   	pop    %esi
+  8017fc:	5f                   	pop    %edi
+  8017fd:	5d                   	pop    %ebp
+  8017fe:	c3                   	ret
+
+008017ff <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8017ff:	55                   	push   %ebp
+  801800:	89 e5                	mov    %esp,%ebp
+  801802:	53                   	push   %ebx
+  801803:	83 ec 14             	sub    $0x14,%esp
+  801806:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  801808:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  80180f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801814:	ba 00 90 80 00       	mov    $0x809000,%edx
+  801819:	e8 c8 fe ff ff       	call   8016e6 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  80181e:	6a 00                	push   $0x0
+  801820:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801823:	50                   	push   %eax
+  801824:	53                   	push   %ebx
+  801825:	6a 00                	push   $0x0
+  801827:	e8 3a 14 00 00       	call   802c66 <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  80182c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80182f:	c9                   	leave
+  801830:	c3                   	ret
+
+00801831 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801831:	55                   	push   %ebp
+  801832:	89 e5                	mov    %esp,%ebp
+  801834:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801837:	8b 45 08             	mov    0x8(%ebp),%eax
+  80183a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80183d:	a3 00 90 80 00       	mov    %eax,0x809000
+  fsipcbuf.set_size.req_size = newsize;
+  801842:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801845:	a3 04 90 80 00       	mov    %eax,0x809004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  80184a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80184f:	b8 02 00 00 00       	mov    $0x2,%eax
+  801854:	e8 a6 ff ff ff       	call   8017ff <fsipc>
+}
+  801859:	c9                   	leave
+  80185a:	c3                   	ret
+
+0080185b <devfile_flush>:
+{
+  80185b:	55                   	push   %ebp
+  80185c:	89 e5                	mov    %esp,%ebp
+  80185e:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801861:	8b 45 08             	mov    0x8(%ebp),%eax
+  801864:	8b 40 0c             	mov    0xc(%eax),%eax
+  801867:	a3 00 90 80 00       	mov    %eax,0x809000
+  return fsipc(FSREQ_FLUSH, NULL);
+  80186c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801871:	b8 06 00 00 00       	mov    $0x6,%eax
+  801876:	e8 84 ff ff ff       	call   8017ff <fsipc>
+}
+  80187b:	c9                   	leave
+  80187c:	c3                   	ret
+
+0080187d <devfile_stat>:
+{
+  80187d:	55                   	push   %ebp
+  80187e:	89 e5                	mov    %esp,%ebp
+  801880:	53                   	push   %ebx
+  801881:	83 ec 04             	sub    $0x4,%esp
+  801884:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801887:	8b 45 08             	mov    0x8(%ebp),%eax
+  80188a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80188d:	a3 00 90 80 00       	mov    %eax,0x809000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801892:	ba 00 00 00 00       	mov    $0x0,%edx
+  801897:	b8 05 00 00 00       	mov    $0x5,%eax
+  80189c:	e8 5e ff ff ff       	call   8017ff <fsipc>
+  8018a1:	85 c0                	test   %eax,%eax
+  8018a3:	78 2c                	js     8018d1 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8018a5:	83 ec 08             	sub    $0x8,%esp
+  8018a8:	68 00 90 80 00       	push   $0x809000
+  8018ad:	53                   	push   %ebx
+  8018ae:	e8 b0 ef ff ff       	call   800863 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  8018b3:	a1 80 90 80 00       	mov    0x809080,%eax
+  8018b8:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8018be:	a1 84 90 80 00       	mov    0x809084,%eax
+  8018c3:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  8018c9:	83 c4 10             	add    $0x10,%esp
+  8018cc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018d4:	c9                   	leave
+  8018d5:	c3                   	ret
+
+008018d6 <fsv_alloc>:
+{
+  8018d6:	55                   	push   %ebp
+  8018d7:	89 e5                	mov    %esp,%ebp
+  8018d9:	56                   	push   %esi
+  8018da:	53                   	push   %ebx
+  8018db:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  8018dd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018e2:	eb 22                	jmp    801906 <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  8018e4:	83 ec 04             	sub    $0x4,%esp
+  8018e7:	6a 00                	push   $0x0
+  8018e9:	6a 00                	push   $0x0
+  8018eb:	6a 07                	push   $0x7
+  8018ed:	50                   	push   %eax
+  8018ee:	6a 00                	push   $0x0
+  8018f0:	6a 04                	push   $0x4
+  8018f2:	68 40 50 80 00       	push   $0x805040
+  8018f7:	e8 e9 f7 ff ff       	call   8010e5 <sysbatch_add>
+  8018fc:	83 c4 20             	add    $0x20,%esp
+  8018ff:	85 c0                	test   %eax,%eax
+  801901:	78 48                	js     80194b <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  801903:	83 c3 01             	add    $0x1,%ebx
+  801906:	39 f3                	cmp    %esi,%ebx
+  801908:	74 31                	je     80193b <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  80190a:	89 d8                	mov    %ebx,%eax
+  80190c:	c1 e0 0c             	shl    $0xc,%eax
+  80190f:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801914:	89 c2                	mov    %eax,%edx
+  801916:	c1 ea 16             	shr    $0x16,%edx
+  801919:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801920:	f6 c2 01             	test   $0x1,%dl
+  801923:	74 bf                	je     8018e4 <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  801925:	89 c2                	mov    %eax,%edx
+  801927:	c1 ea 0c             	shr    $0xc,%edx
+  80192a:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801931:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801934:	83 fa 03             	cmp    $0x3,%edx
+  801937:	75 ab                	jne    8018e4 <fsv_alloc+0xe>
+  801939:	eb c8                	jmp    801903 <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  80193b:	83 ec 0c             	sub    $0xc,%esp
+  80193e:	68 40 50 80 00       	push   $0x805040
+  801943:	e8 4d f7 ff ff       	call   801095 <sysbatch_flush>
+  801948:	83 c4 10             	add    $0x10,%esp
+}
+  80194b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80194e:	5b                   	pop    %ebx
+  80194f:	5e                   	pop    %esi
+  801950:	5d                   	pop    %ebp
+  801951:	c3                   	ret
+
+00801952 <devfile_read>:
+{
+  801952:	55                   	push   %ebp
+  801953:	89 e5                	mov    %esp,%ebp
+  801955:	57                   	push   %edi
+  801956:	56                   	push   %esi
+  801957:	53                   	push   %ebx
+  801958:	83 ec 3c             	sub    $0x3c,%esp
+  80195b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  80195e:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  801964:	77 57                	ja     8019bd <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801966:	8b 45 08             	mov    0x8(%ebp),%eax
+  801969:	8b 40 0c             	mov    0xc(%eax),%eax
+  80196c:	a3 00 90 80 00       	mov    %eax,0x809000
+  fsipcbuf.read.req_n = n;
+  801971:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801977:	ba 00 00 00 00       	mov    $0x0,%edx
+  80197c:	b8 03 00 00 00       	mov    $0x3,%eax
+  801981:	e8 79 fe ff ff       	call   8017ff <fsipc>
+  801986:	89 c6                	mov    %eax,%esi
+  801988:	85 c0                	test   %eax,%eax
+  80198a:	78 27                	js     8019b3 <devfile_read+0x61>
+  assert(r <= n);
+  80198c:	39 c3                	cmp    %eax,%ebx
+  80198e:	0f 82 0e 02 00 00    	jb     801ba2 <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  801994:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801999:	0f 8f 1c 02 00 00    	jg     801bbb <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  80199f:	83 ec 04             	sub    $0x4,%esp
+  8019a2:	50                   	push   %eax
+  8019a3:	68 00 90 80 00       	push   $0x809000
+  8019a8:	ff 75 0c             	push   0xc(%ebp)
+  8019ab:	e8 39 f0 ff ff       	call   8009e9 <memmove>
+  return r;
+  8019b0:	83 c4 10             	add    $0x10,%esp
+}
+  8019b3:	89 f0                	mov    %esi,%eax
+  8019b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019b8:	5b                   	pop    %ebx
+  8019b9:	5e                   	pop    %esi
+  8019ba:	5f                   	pop    %edi
+  8019bb:	5d                   	pop    %ebp
+  8019bc:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  8019bd:	b8 01 00 00 00       	mov    $0x1,%eax
+  8019c2:	e8 0f ff ff ff       	call   8018d6 <fsv_alloc>
+  8019c7:	89 c6                	mov    %eax,%esi
+  8019c9:	85 c0                	test   %eax,%eax
+  8019cb:	78 e6                	js     8019b3 <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  8019cd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019d0:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019d3:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  8019d8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019db:	8b 40 04             	mov    0x4(%eax),%eax
+  8019de:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  8019e3:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  8019e9:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  8019f0:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8019f5:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  8019fa:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8019ff:	e8 e2 fc ff ff       	call   8016e6 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801a04:	6a 00                	push   $0x0
+  801a06:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801a09:	50                   	push   %eax
+  801a0a:	68 00 10 c0 9f       	push   $0x9fc01000
+  801a0f:	6a 00                	push   $0x0
+  801a11:	e8 50 12 00 00       	call   802c66 <ipc_recv_pages>
+  801a16:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  801a18:	83 c4 10             	add    $0x10,%esp
+  801a1b:	85 c0                	test   %eax,%eax
+  801a1d:	7e 94                	jle    8019b3 <devfile_read+0x61>
+  assert(r <= n);
+  801a1f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801a22:	39 c3                	cmp    %eax,%ebx
+  801a24:	72 2e                	jb     801a54 <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801a26:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a29:	8b 40 04             	mov    0x4(%eax),%eax
+  801a2c:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801a31:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  801a34:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801a37:	c1 e2 0c             	shl    $0xc,%edx
+  801a3a:	39 ca                	cmp    %ecx,%edx
+  801a3c:	72 2f                	jb     801a6d <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  801a3e:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  801a43:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  801a46:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  801a4a:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801a4f:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  801a52:	eb 52                	jmp    801aa6 <devfile_read+0x154>
+  assert(r <= n);
+  801a54:	68 d1 34 80 00       	push   $0x8034d1
+  801a59:	68 d8 34 80 00       	push   $0x8034d8
+  801a5e:	68 49 01 00 00       	push   $0x149
+  801a63:	68 c6 34 80 00       	push   $0x8034c6
+  801a68:	e8 2d e7 ff ff       	call   80019a <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801a6d:	68 fc 34 80 00       	push   $0x8034fc
+  801a72:	68 d8 34 80 00       	push   $0x8034d8
+  801a77:	68 4a 01 00 00       	push   $0x14a
+  801a7c:	68 c6 34 80 00       	push   $0x8034c6
+  801a81:	e8 14 e7 ff ff       	call   80019a <_panic>
+      memmove(dst + done, src + done, m);
+  801a86:	83 ec 04             	sub    $0x4,%esp
+  801a89:	53                   	push   %ebx
+  801a8a:	56                   	push   %esi
+  801a8b:	89 f8                	mov    %edi,%eax
+  801a8d:	03 45 0c             	add    0xc(%ebp),%eax
+  801a90:	50                   	push   %eax
+  801a91:	e8 53 ef ff ff       	call   8009e9 <memmove>
+  801a96:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  801a99:	01 df                	add    %ebx,%edi
+  801a9b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801a9e:	39 c7                	cmp    %eax,%edi
+  801aa0:	0f 83 c0 00 00 00    	jae    801b66 <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801aa6:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801aa9:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  801aac:	89 f0                	mov    %esi,%eax
+  801aae:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801ab3:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  801ab8:	29 c3                	sub    %eax,%ebx
+  801aba:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801abd:	29 f8                	sub    %edi,%eax
+  801abf:	39 c3                	cmp    %eax,%ebx
+  801ac1:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  801ac4:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801aca:	75 ba                	jne    801a86 <devfile_read+0x134>
+  801acc:	89 f9                	mov    %edi,%ecx
+  801ace:	03 4d 0c             	add    0xc(%ebp),%ecx
+  801ad1:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  801ad4:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  801ada:	75 aa                	jne    801a86 <devfile_read+0x134>
+  801adc:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  801ae2:	77 a2                	ja     801a86 <devfile_read+0x134>
+  801ae4:	89 c8                	mov    %ecx,%eax
+  801ae6:	c1 e8 16             	shr    $0x16,%eax
+  801ae9:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801af0:	a8 01                	test   $0x1,%al
+  801af2:	74 92                	je     801a86 <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  801af4:	89 c8                	mov    %ecx,%eax
+  801af6:	c1 e8 0c             	shr    $0xc,%eax
+  801af9:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  801b00:	a8 01                	test   $0x1,%al
+  801b02:	74 82                	je     801a86 <devfile_read+0x134>
+  801b04:	a9 02 08 00 00       	test   $0x802,%eax
+  801b09:	0f 84 77 ff ff ff    	je     801a86 <devfile_read+0x134>
+  801b0f:	f6 c4 04             	test   $0x4,%ah
+  801b12:	0f 85 6e ff ff ff    	jne    801a86 <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  801b18:	a1 00 80 80 00       	mov    0x808000,%eax
+  801b1d:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  801b21:	84 c0                	test   %al,%al
+  801b23:	75 17                	jne    801b3c <devfile_read+0x1ea>
+  801b25:	83 ec 08             	sub    $0x8,%esp
+  801b28:	6a 01                	push   $0x1
+  801b2a:	6a 00                	push   $0x0
+  801b2c:	e8 1e f1 ff ff       	call   800c4f <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  801b31:	83 c4 10             	add    $0x10,%esp
+  801b34:	85 c0                	test   %eax,%eax
+  801b36:	0f 85 4a ff ff ff    	jne    801a86 <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  801b3c:	83 ec 04             	sub    $0x4,%esp
+  801b3f:	68 05 08 00 00       	push   $0x805
+  801b44:	ff 75 cc             	push   -0x34(%ebp)
+  801b47:	6a 00                	push   $0x0
+  801b49:	56                   	push   %esi
+  801b4a:	6a 00                	push   $0x0
+  801b4c:	6a 05                	push   $0x5
+  801b4e:	68 40 50 80 00       	push   $0x805040
+  801b53:	e8 8d f5 ff ff       	call   8010e5 <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  801b58:	c1 e8 1f             	shr    $0x1f,%eax
+  801b5b:	08 45 cb             	or     %al,-0x35(%ebp)
+  801b5e:	83 c4 20             	add    $0x20,%esp
+  801b61:	e9 33 ff ff ff       	jmp    801a99 <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  801b66:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  801b69:	83 ec 0c             	sub    $0xc,%esp
+  801b6c:	68 40 50 80 00       	push   $0x805040
+  801b71:	e8 1f f5 ff ff       	call   801095 <sysbatch_flush>
+  801b76:	83 c4 10             	add    $0x10,%esp
+  801b79:	85 c0                	test   %eax,%eax
+  801b7b:	78 06                	js     801b83 <devfile_read+0x231>
+  801b7d:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  801b81:	74 14                	je     801b97 <devfile_read+0x245>
+    memmove(dst, src, r);
+  801b83:	83 ec 04             	sub    $0x4,%esp
+  801b86:	ff 75 d4             	push   -0x2c(%ebp)
+  801b89:	ff 75 d0             	push   -0x30(%ebp)
+  801b8c:	ff 75 0c             	push   0xc(%ebp)
+  801b8f:	e8 55 ee ff ff       	call   8009e9 <memmove>
+  801b94:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  801b97:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b9a:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  801b9d:	e9 11 fe ff ff       	jmp    8019b3 <devfile_read+0x61>
+  assert(r <= n);
+  801ba2:	68 d1 34 80 00       	push   $0x8034d1
+  801ba7:	68 d8 34 80 00       	push   $0x8034d8
+  801bac:	68 1c 01 00 00       	push   $0x11c
+  801bb1:	68 c6 34 80 00       	push   $0x8034c6
+  801bb6:	e8 df e5 ff ff       	call   80019a <_panic>
+  assert(r <= PGSIZE);
+  801bbb:	68 ed 34 80 00       	push   $0x8034ed
+  801bc0:	68 d8 34 80 00       	push   $0x8034d8
+  801bc5:	68 1d 01 00 00       	push   $0x11d
+  801bca:	68 c6 34 80 00       	push   $0x8034c6
+  801bcf:	e8 c6 e5 ff ff       	call   80019a <_panic>
+
+00801bd4 <devfile_write>:
+{
+  801bd4:	55                   	push   %ebp
+  801bd5:	89 e5                	mov    %esp,%ebp
+  801bd7:	57                   	push   %edi
+  801bd8:	56                   	push   %esi
+  801bd9:	53                   	push   %ebx
+  801bda:	83 ec 1c             	sub    $0x1c,%esp
+  801bdd:	8b 75 08             	mov    0x8(%ebp),%esi
+  801be0:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  801be3:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  801be8:	77 39                	ja     801c23 <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801bea:	8b 56 0c             	mov    0xc(%esi),%edx
+  801bed:	89 15 00 90 80 00    	mov    %edx,0x809000
+  fsipcbuf.write.req_n = n;
+  801bf3:	a3 04 90 80 00       	mov    %eax,0x809004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  801bf8:	83 ec 04             	sub    $0x4,%esp
+  801bfb:	50                   	push   %eax
+  801bfc:	ff 75 0c             	push   0xc(%ebp)
+  801bff:	68 08 90 80 00       	push   $0x809008
+  801c04:	e8 e0 ed ff ff       	call   8009e9 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801c09:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c0e:	b8 04 00 00 00       	mov    $0x4,%eax
+  801c13:	e8 e7 fb ff ff       	call   8017ff <fsipc>
+  801c18:	83 c4 10             	add    $0x10,%esp
+}
+  801c1b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c1e:	5b                   	pop    %ebx
+  801c1f:	5e                   	pop    %esi
+  801c20:	5f                   	pop    %edi
+  801c21:	5d                   	pop    %ebp
+  801c22:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  801c23:	ba 00 00 10 00       	mov    $0x100000,%edx
+  801c28:	39 d0                	cmp    %edx,%eax
+  801c2a:	89 d3                	mov    %edx,%ebx
+  801c2c:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  801c2f:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  801c35:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  801c38:	83 c7 01             	add    $0x1,%edi
+  801c3b:	89 f8                	mov    %edi,%eax
+  801c3d:	e8 94 fc ff ff       	call   8018d6 <fsv_alloc>
+  801c42:	85 c0                	test   %eax,%eax
+  801c44:	78 d5                	js     801c1b <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  801c46:	83 ec 04             	sub    $0x4,%esp
+  801c49:	53                   	push   %ebx
+  801c4a:	ff 75 0c             	push   0xc(%ebp)
+  801c4d:	68 00 10 c0 9f       	push   $0x9fc01000
+  801c52:	e8 92 ed ff ff       	call   8009e9 <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  801c57:	8b 46 0c             	mov    0xc(%esi),%eax
+  801c5a:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  801c5f:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  801c65:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801c6c:	89 f9                	mov    %edi,%ecx
+  801c6e:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801c73:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801c78:	e8 69 fa ff ff       	call   8016e6 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801c7d:	6a 00                	push   $0x0
+  801c7f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801c82:	50                   	push   %eax
+  801c83:	6a 00                	push   $0x0
+  801c85:	6a 00                	push   $0x0
+  801c87:	e8 da 0f 00 00       	call   802c66 <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  801c8c:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  801c8f:	eb 8a                	jmp    801c1b <devfile_write+0x47>
+
+00801c91 <open>:
+{
+  801c91:	55                   	push   %ebp
+  801c92:	89 e5                	mov    %esp,%ebp
+  801c94:	56                   	push   %esi
+  801c95:	53                   	push   %ebx
+  801c96:	83 ec 1c             	sub    $0x1c,%esp
+  801c99:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801c9c:	56                   	push   %esi
+  801c9d:	e8 86 eb ff ff       	call   800828 <strlen>
+  801ca2:	83 c4 10             	add    $0x10,%esp
+  801ca5:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801caa:	7f 6c                	jg     801d18 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  801cac:	83 ec 0c             	sub    $0xc,%esp
+  801caf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cb2:	50                   	push   %eax
+  801cb3:	e8 ad f4 ff ff       	call   801165 <fd_alloc>
+  801cb8:	89 c3                	mov    %eax,%ebx
+  801cba:	83 c4 10             	add    $0x10,%esp
+  801cbd:	85 c0                	test   %eax,%eax
+  801cbf:	78 3c                	js     801cfd <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801cc1:	83 ec 08             	sub    $0x8,%esp
+  801cc4:	56                   	push   %esi
+  801cc5:	68 00 90 80 00       	push   $0x809000
+  801cca:	e8 94 eb ff ff       	call   800863 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801ccf:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801cd2:	a3 00 94 80 00       	mov    %eax,0x809400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801cd7:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801cda:	b8 01 00 00 00       	mov    $0x1,%eax
+  801cdf:	e8 1b fb ff ff       	call   8017ff <fsipc>
+  801ce4:	89 c3                	mov    %eax,%ebx
+  801ce6:	83 c4 10             	add    $0x10,%esp
+  801ce9:	85 c0                	test   %eax,%eax
+  801ceb:	78 19                	js     801d06 <open+0x75>
+  return fd2num(fd);
+  801ced:	83 ec 0c             	sub    $0xc,%esp
+  801cf0:	ff 75 f4             	push   -0xc(%ebp)
+  801cf3:	e8 49 f4 ff ff       	call   801141 <fd2num>
+  801cf8:	89 c3                	mov    %eax,%ebx
+  801cfa:	83 c4 10             	add    $0x10,%esp
+}
+  801cfd:	89 d8                	mov    %ebx,%eax
+  801cff:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d02:	5b                   	pop    %ebx
+  801d03:	5e                   	pop    %esi
+  801d04:	5d                   	pop    %ebp
+  801d05:	c3                   	ret
+    fd_close(fd, 0);
+  801d06:	83 ec 08             	sub    $0x8,%esp
+  801d09:	6a 00                	push   $0x0
+  801d0b:	ff 75 f4             	push   -0xc(%ebp)
+  801d0e:	e8 44 f5 ff ff       	call   801257 <fd_close>
+    return r;
+  801d13:	83 c4 10             	add    $0x10,%esp
+  801d16:	eb e5                	jmp    801cfd <open+0x6c>
+    return -E_BAD_PATH;
+  801d18:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801d1d:	eb de                	jmp    801cfd <open+0x6c>
+
+00801d1f <open_read>:
+{
+  801d1f:	55                   	push   %ebp
+  801d20:	89 e5                	mov    %esp,%ebp
+  801d22:	57                   	push   %edi
+  801d23:	56                   	push   %esi
+  801d24:	53                   	push   %ebx
+  801d25:	83 ec 28             	sub    $0x28,%esp
+  801d28:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  801d2b:	57                   	push   %edi
+  801d2c:	e8 f7 ea ff ff       	call   800828 <strlen>
+  801d31:	83 c4 10             	add    $0x10,%esp
+  801d34:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801d39:	0f 87 f6 00 00 00    	ja     801e35 <open_read+0x116>
+  801d3f:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  801d41:	83 ec 0c             	sub    $0xc,%esp
+  801d44:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801d47:	50                   	push   %eax
+  801d48:	e8 18 f4 ff ff       	call   801165 <fd_alloc>
+  801d4d:	89 c3                	mov    %eax,%ebx
+  801d4f:	83 c4 10             	add    $0x10,%esp
+  801d52:	85 c0                	test   %eax,%eax
+  801d54:	0f 88 b2 00 00 00    	js     801e0c <open_read+0xed>
+  strcpy(req->req_buf, path);
+  801d5a:	83 ec 08             	sub    $0x8,%esp
+  801d5d:	57                   	push   %edi
+  801d5e:	68 e4 90 80 00       	push   $0x8090e4
+  801d63:	e8 fb ea ff ff       	call   800863 <strcpy>
+  req->req_nops = 2;
+  801d68:	c7 05 00 90 80 00 02 	movl   $0x2,0x809000
+  801d6f:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  801d72:	c7 05 04 90 80 00 01 	movl   $0x1,0x809004
+  801d79:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  801d7c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d7f:	a3 10 90 80 00       	mov    %eax,0x809010
+  req->req_ops[0].op_buf = 0;
+  801d84:	c7 05 18 90 80 00 00 	movl   $0x0,0x809018
+  801d8b:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  801d8e:	c7 05 20 90 80 00 04 	movl   $0x4,0x809020
+  801d95:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  801d98:	c7 05 24 90 80 00 01 	movl   $0x1,0x809024
+  801d9f:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  801da2:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  801da7:	29 f0                	sub    %esi,%eax
+  801da9:	3b 45 14             	cmp    0x14(%ebp),%eax
+  801dac:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  801db0:	a3 2c 90 80 00       	mov    %eax,0x80902c
+  req->req_ops[1].op_offset = 0;
+  801db5:	c7 05 30 90 80 00 00 	movl   $0x0,0x809030
+  801dbc:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  801dbf:	83 c6 01             	add    $0x1,%esi
+  801dc2:	89 35 34 90 80 00    	mov    %esi,0x809034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  801dc8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801dcb:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801dd0:	e8 2a fa ff ff       	call   8017ff <fsipc>
+  801dd5:	89 c3                	mov    %eax,%ebx
+  801dd7:	83 c4 10             	add    $0x10,%esp
+  801dda:	83 f8 01             	cmp    $0x1,%eax
+  801ddd:	7e 37                	jle    801e16 <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  801ddf:	a1 38 90 80 00       	mov    0x809038,%eax
+  801de4:	8b 55 18             	mov    0x18(%ebp),%edx
+  801de7:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  801de9:	83 ec 04             	sub    $0x4,%esp
+  801dec:	50                   	push   %eax
+  801ded:	81 c6 e4 90 80 00    	add    $0x8090e4,%esi
+  801df3:	56                   	push   %esi
+  801df4:	ff 75 10             	push   0x10(%ebp)
+  801df7:	e8 ed eb ff ff       	call   8009e9 <memmove>
+  return fd2num(fd);
+  801dfc:	83 c4 04             	add    $0x4,%esp
+  801dff:	ff 75 e4             	push   -0x1c(%ebp)
+  801e02:	e8 3a f3 ff ff       	call   801141 <fd2num>
+  801e07:	89 c3                	mov    %eax,%ebx
+  801e09:	83 c4 10             	add    $0x10,%esp
+}
+  801e0c:	89 d8                	mov    %ebx,%eax
+  801e0e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e11:	5b                   	pop    %ebx
+  801e12:	5e                   	pop    %esi
+  801e13:	5f                   	pop    %edi
+  801e14:	5d                   	pop    %ebp
+  801e15:	c3                   	ret
+    fd_close(fd, 0);
+  801e16:	83 ec 08             	sub    $0x8,%esp
+  801e19:	6a 00                	push   $0x0
+  801e1b:	ff 75 e4             	push   -0x1c(%ebp)
+  801e1e:	e8 34 f4 ff ff       	call   801257 <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  801e23:	83 c4 10             	add    $0x10,%esp
+  801e26:	85 db                	test   %ebx,%ebx
+  801e28:	78 e2                	js     801e0c <open_read+0xed>
+  801e2a:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  801e2d:	8b 9b 1c 90 80 00    	mov    0x80901c(%ebx),%ebx
+  801e33:	eb d7                	jmp    801e0c <open_read+0xed>
+    return -E_BAD_PATH;
+  801e35:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801e3a:	eb d0                	jmp    801e0c <open_read+0xed>
+
+00801e3c <file_stat>:
+{
+  801e3c:	55                   	push   %ebp
+  801e3d:	89 e5                	mov    %esp,%ebp
+  801e3f:	57                   	push   %edi
+  801e40:	56                   	push   %esi
+  801e41:	53                   	push   %ebx
+  801e42:	83 ec 18             	sub    $0x18,%esp
+  801e45:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801e48:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801e4b:	57                   	push   %edi
+  801e4c:	e8 d7 e9 ff ff       	call   800828 <strlen>
+  801e51:	83 c4 10             	add    $0x10,%esp
+  801e54:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801e59:	0f 8f c7 00 00 00    	jg     801f26 <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  801e5f:	83 ec 0c             	sub    $0xc,%esp
+  801e62:	57                   	push   %edi
+  801e63:	e8 c0 e9 ff ff       	call   800828 <strlen>
+  801e68:	8d 58 04             	lea    0x4(%eax),%ebx
+  801e6b:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  801e6e:	83 c4 08             	add    $0x8,%esp
+  801e71:	57                   	push   %edi
+  801e72:	68 e4 90 80 00       	push   $0x8090e4
+  801e77:	e8 e7 e9 ff ff       	call   800863 <strcpy>
+  req->req_nops = 2;
+  801e7c:	c7 05 00 90 80 00 02 	movl   $0x2,0x809000
+  801e83:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  801e86:	c7 05 04 90 80 00 02 	movl   $0x2,0x809004
+  801e8d:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  801e90:	c7 05 10 90 80 00 00 	movl   $0x0,0x809010
+  801e97:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  801e9a:	c7 05 18 90 80 00 00 	movl   $0x0,0x809018
+  801ea1:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  801ea4:	c7 05 20 90 80 00 03 	movl   $0x3,0x809020
+  801eab:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  801eae:	c7 05 24 90 80 00 01 	movl   $0x1,0x809024
+  801eb5:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  801eb8:	89 1d 34 90 80 00    	mov    %ebx,0x809034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  801ebe:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ec3:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801ec8:	e8 32 f9 ff ff       	call   8017ff <fsipc>
+  801ecd:	83 c4 10             	add    $0x10,%esp
+  801ed0:	83 f8 01             	cmp    $0x1,%eax
+  801ed3:	7e 42                	jle    801f17 <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  801ed5:	81 c3 e4 90 80 00    	add    $0x8090e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  801edb:	83 ec 08             	sub    $0x8,%esp
+  801ede:	53                   	push   %ebx
+  801edf:	56                   	push   %esi
+  801ee0:	e8 7e e9 ff ff       	call   800863 <strcpy>
+  st->st_size = ret->ret_size;
+  801ee5:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  801eeb:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  801ef1:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  801ef7:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  801efd:	c7 86 88 00 00 00 04 	movl   $0x804004,0x88(%esi)
+  801f04:	40 80 00 
+  return 0;
+  801f07:	83 c4 10             	add    $0x10,%esp
+  801f0a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f0f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f12:	5b                   	pop    %ebx
+  801f13:	5e                   	pop    %esi
+  801f14:	5f                   	pop    %edi
+  801f15:	5d                   	pop    %ebp
+  801f16:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  801f17:	85 c0                	test   %eax,%eax
+  801f19:	78 f4                	js     801f0f <file_stat+0xd3>
+  801f1b:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801f1e:	8b 80 1c 90 80 00    	mov    0x80901c(%eax),%eax
+  801f24:	eb e9                	jmp    801f0f <file_stat+0xd3>
+    return -E_BAD_PATH;
+  801f26:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801f2b:	eb e2                	jmp    801f0f <file_stat+0xd3>
+
+00801f2d <read_map>:
+{
+  801f2d:	55                   	push   %ebp
+  801f2e:	89 e5                	mov    %esp,%ebp
+  801f30:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801f33:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f36:	50                   	push   %eax
+  801f37:	ff 75 08             	push   0x8(%ebp)
+  801f3a:	e8 7c f2 ff ff       	call   8011bb <fd_lookup>
+  801f3f:	83 c4 10             	add    $0x10,%esp
+  801f42:	85 c0                	test   %eax,%eax
+  801f44:	78 2a                	js     801f70 <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  801f46:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f49:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  801f4f:	39 08                	cmp    %ecx,(%eax)
+  801f51:	75 1f                	jne    801f72 <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  801f53:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f56:	a3 00 90 80 00       	mov    %eax,0x809000
+  fsipcbuf.read_map.req_offset = offset;
+  801f5b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f5e:	a3 04 90 80 00       	mov    %eax,0x809004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  801f63:	8b 55 10             	mov    0x10(%ebp),%edx
+  801f66:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801f6b:	e8 8f f8 ff ff       	call   8017ff <fsipc>
+}
+  801f70:	c9                   	leave
+  801f71:	c3                   	ret
+    return -E_INVAL;
+  801f72:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f77:	eb f7                	jmp    801f70 <read_map+0x43>
+
+00801f79 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801f79:	55                   	push   %ebp
+  801f7a:	89 e5                	mov    %esp,%ebp
+  801f7c:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  801f7f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f84:	b8 08 00 00 00       	mov    $0x8,%eax
+  801f89:	e8 71 f8 ff ff       	call   8017ff <fsipc>
+}
+  801f8e:	c9                   	leave
+  801f8f:	c3                   	ret
+
+00801f90 <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  801f90:	55                   	push   %ebp
+  801f91:	89 e5                	mov    %esp,%ebp
+  801f93:	57                   	push   %edi
+  801f94:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  801f95:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f98:	a3 00 90 80 00       	mov    %eax,0x809000
+  fsipcbuf.stats.req_bio_sched = 0;
+  801f9d:	c7 05 04 90 80 00 00 	movl   $0x0,0x809004
+  801fa4:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  801fa7:	c7 05 08 90 80 00 00 	movl   $0x0,0x809008
+  801fae:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  801fb1:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fb6:	b8 09 00 00 00       	mov    $0x9,%eax
+  801fbb:	e8 3f f8 ff ff       	call   8017ff <fsipc>
+  801fc0:	85 c0                	test   %eax,%eax
+  801fc2:	78 14                	js     801fd8 <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  801fc4:	be 00 90 80 00       	mov    $0x809000,%esi
+  801fc9:	b9 16 00 00 00       	mov    $0x16,%ecx
+  801fce:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801fd1:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  801fd3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801fd8:	5e                   	pop    %esi
+  801fd9:	5f                   	pop    %edi
+  801fda:	5d                   	pop    %ebp
+  801fdb:	c3                   	ret
+
+00801fdc <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  801fdc:	55                   	push   %ebp
+  801fdd:	89 e5                	mov    %esp,%ebp
+  801fdf:	53                   	push   %ebx
+  801fe0:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  801fe3:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801fe6:	50                   	push   %eax
+  801fe7:	6a 00                	push   $0x0
+  801fe9:	e8 a2 ff ff ff       	call   801f90 <fs_stats>
+  801fee:	83 c4 10             	add    $0x10,%esp
+  801ff1:	85 c0                	test   %eax,%eax
+  801ff3:	78 28                	js     80201d <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  801ff5:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  801ff8:	83 ec 08             	sub    $0x8,%esp
+  801ffb:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801ffe:	50                   	push   %eax
+  801fff:	6a 20                	push   $0x20
+  802001:	e8 8a ff ff ff       	call   801f90 <fs_stats>
+  802006:	83 c4 10             	add    $0x10,%esp
+  802009:	85 c0                	test   %eax,%eax
+  80200b:	78 10                	js     80201d <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  80200d:	83 ec 08             	sub    $0x8,%esp
+  802010:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802013:	50                   	push   %eax
+  802014:	53                   	push   %ebx
+  802015:	e8 76 ff ff ff       	call   801f90 <fs_stats>
+  80201a:	83 c4 10             	add    $0x10,%esp
+}
+  80201d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802020:	c9                   	leave
+  802021:	c3                   	ret
+
+00802022 <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  802022:	55                   	push   %ebp
+  802023:	89 e5                	mov    %esp,%ebp
+  802025:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  802028:	c7 05 00 90 80 00 00 	movl   $0x0,0x809000
+  80202f:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  802032:	8b 45 08             	mov    0x8(%ebp),%eax
+  802035:	a3 04 90 80 00       	mov    %eax,0x809004
+  fsipcbuf.stats.req_dcache = 0;
+  80203a:	c7 05 08 90 80 00 00 	movl   $0x0,0x809008
+  802041:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  802044:	ba 00 00 00 00       	mov    $0x0,%edx
+  802049:	b8 09 00 00 00       	mov    $0x9,%eax
+  80204e:	e8 ac f7 ff ff       	call   8017ff <fsipc>
+}
+  802053:	c9                   	leave
+  802054:	c3                   	ret
+
+00802055 <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  802055:	55                   	push   %ebp
+  802056:	89 e5                	mov    %esp,%ebp
+  802058:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  80205b:	c7 05 00 90 80 00 00 	movl   $0x0,0x809000
+  802062:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  802065:	c7 05 04 90 80 00 00 	movl   $0x0,0x809004
+  80206c:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  80206f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802072:	a3 08 90 80 00       	mov    %eax,0x809008
+  return fsipc(FSREQ_STATS, NULL);
+  802077:	ba 00 00 00 00       	mov    $0x0,%edx
+  80207c:	b8 09 00 00 00       	mov    $0x9,%eax
+  802081:	e8 79 f7 ff ff       	call   8017ff <fsipc>
+}
+  802086:	c9                   	leave
+  802087:	c3                   	ret
+
+00802088 <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  802088:	55                   	push   %ebp
+  802089:	89 e5                	mov    %esp,%ebp
+  80208b:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80208e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802091:	50                   	push   %eax
+  802092:	ff 75 08             	push   0x8(%ebp)
+  802095:	e8 21 f1 ff ff       	call   8011bb <fd_lookup>
+  80209a:	83 c4 10             	add    $0x10,%esp
+  80209d:	85 c0                	test   %eax,%eax
+  80209f:	78 34                	js     8020d5 <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  8020a1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020a4:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  8020aa:	39 08                	cmp    %ecx,(%eax)
+  8020ac:	75 29                	jne    8020d7 <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  8020ae:	8b 40 0c             	mov    0xc(%eax),%eax
+  8020b1:	a3 00 90 80 00       	mov    %eax,0x809000
+  fsipcbuf.fallocate.req_offset = offset;
+  8020b6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020b9:	a3 04 90 80 00       	mov    %eax,0x809004
+  fsipcbuf.fallocate.req_len = len;
+  8020be:	8b 45 10             	mov    0x10(%ebp),%eax
+  8020c1:	a3 08 90 80 00       	mov    %eax,0x809008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  8020c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020cb:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8020d0:	e8 2a f7 ff ff       	call   8017ff <fsipc>
+}
+  8020d5:	c9                   	leave
+  8020d6:	c3                   	ret
+    return -E_INVAL;
+  8020d7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020dc:	eb f7                	jmp    8020d5 <fallocate+0x4d>
+
+008020de <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  8020de:	55                   	push   %ebp
+  8020df:	89 e5                	mov    %esp,%ebp
+  8020e1:	57                   	push   %edi
+  8020e2:	56                   	push   %esi
+  8020e3:	53                   	push   %ebx
+  8020e4:	83 ec 24             	sub    $0x24,%esp
+  8020e7:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8020ea:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8020ed:	50                   	push   %eax
+  8020ee:	ff 75 08             	push   0x8(%ebp)
+  8020f1:	e8 c5 f0 ff ff       	call   8011bb <fd_lookup>
+  8020f6:	83 c4 10             	add    $0x10,%esp
+  8020f9:	85 c0                	test   %eax,%eax
+  8020fb:	78 66                	js     802163 <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  8020fd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802100:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  802106:	39 08                	cmp    %ecx,(%eax)
+  802108:	75 61                	jne    80216b <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  80210a:	85 f6                	test   %esi,%esi
+  80210c:	7e 50                	jle    80215e <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  80210e:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  802113:	39 de                	cmp    %ebx,%esi
+  802115:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  802118:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80211b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80211e:	a3 00 90 80 00       	mov    %eax,0x809000
+    fsipcbuf.prefetch.req_n = m;
+  802123:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  802129:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  802130:	83 ec 04             	sub    $0x4,%esp
+  802133:	57                   	push   %edi
+  802134:	ff 75 0c             	push   0xc(%ebp)
+  802137:	68 08 90 80 00       	push   $0x809008
+  80213c:	e8 a8 e8 ff ff       	call   8009e9 <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  802141:	ba 00 00 00 00       	mov    $0x0,%edx
+  802146:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80214b:	e8 af f6 ff ff       	call   8017ff <fsipc>
+  802150:	83 c4 10             	add    $0x10,%esp
+  802153:	85 c0                	test   %eax,%eax
+  802155:	78 0c                	js     802163 <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  802157:	01 7d 0c             	add    %edi,0xc(%ebp)
+  80215a:	29 de                	sub    %ebx,%esi
+  80215c:	eb ac                	jmp    80210a <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  80215e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802163:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802166:	5b                   	pop    %ebx
+  802167:	5e                   	pop    %esi
+  802168:	5f                   	pop    %edi
+  802169:	5d                   	pop    %ebp
+  80216a:	c3                   	ret
+    return -E_INVAL;
+  80216b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802170:	eb f1                	jmp    802163 <prefetch+0x85>
+
+00802172 <writebuf>:
+
+
+static void
+writebuf(struct printbuf *b)
+{
+  if (b->error > 0) {
+  802172:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802176:	7f 01                	jg     802179 <writebuf+0x7>
+  802178:	c3                   	ret
+{
+  802179:	55                   	push   %ebp
+  80217a:	89 e5                	mov    %esp,%ebp
+  80217c:	53                   	push   %ebx
+  80217d:	83 ec 08             	sub    $0x8,%esp
+  802180:	89 c3                	mov    %eax,%ebx
+    ssize_t result = write(b->fd, b->buf, b->idx);
+  802182:	ff 70 04             	push   0x4(%eax)
+  802185:	8d 40 10             	lea    0x10(%eax),%eax
+  802188:	50                   	push   %eax
+  802189:	ff 33                	push   (%ebx)
+  80218b:	e8 a4 f3 ff ff       	call   801534 <write>
+    if (result > 0)
+  802190:	83 c4 10             	add    $0x10,%esp
+  802193:	85 c0                	test   %eax,%eax
+  802195:	7e 03                	jle    80219a <writebuf+0x28>
+      b->result += result;
+  802197:	01 43 08             	add    %eax,0x8(%ebx)
+    if (result != b->idx)             // error, or wrote less than supplied
+  80219a:	39 43 04             	cmp    %eax,0x4(%ebx)
+  80219d:	74 0d                	je     8021ac <writebuf+0x3a>
+      b->error = (result < 0 ? result : 0);
+  80219f:	85 c0                	test   %eax,%eax
+  8021a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021a6:	0f 4f c2             	cmovg  %edx,%eax
+  8021a9:	89 43 0c             	mov    %eax,0xc(%ebx)
+  }
+}
+  8021ac:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021af:	c9                   	leave
+  8021b0:	c3                   	ret
+
+008021b1 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  8021b1:	55                   	push   %ebp
+  8021b2:	89 e5                	mov    %esp,%ebp
+  8021b4:	53                   	push   %ebx
+  8021b5:	83 ec 04             	sub    $0x4,%esp
+  8021b8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct printbuf *b = (struct printbuf *)thunk;
+
+  b->buf[b->idx++] = ch;
+  8021bb:	8b 53 04             	mov    0x4(%ebx),%edx
+  8021be:	8d 42 01             	lea    0x1(%edx),%eax
+  8021c1:	89 43 04             	mov    %eax,0x4(%ebx)
+  8021c4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8021c7:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+  if (b->idx == 256) {
+  8021cb:	3d 00 01 00 00       	cmp    $0x100,%eax
+  8021d0:	74 05                	je     8021d7 <putch+0x26>
+    writebuf(b);
+    b->idx = 0;
+  }
+}
+  8021d2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021d5:	c9                   	leave
+  8021d6:	c3                   	ret
+    writebuf(b);
+  8021d7:	89 d8                	mov    %ebx,%eax
+  8021d9:	e8 94 ff ff ff       	call   802172 <writebuf>
+    b->idx = 0;
+  8021de:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+  8021e5:	eb eb                	jmp    8021d2 <putch+0x21>
+
+008021e7 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap)
+{
+  8021e7:	55                   	push   %ebp
+  8021e8:	89 e5                	mov    %esp,%ebp
+  8021ea:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.fd = fd;
+  8021f0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021f3:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+  b.idx = 0;
+  8021f9:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  802200:	00 00 00 
+  b.result = 0;
+  802203:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80220a:	00 00 00 
+  b.error = 1;
+  80220d:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  802214:	00 00 00 
+  vprintfmt(putch, &b, fmt, ap);
+  802217:	ff 75 10             	push   0x10(%ebp)
+  80221a:	ff 75 0c             	push   0xc(%ebp)
+  80221d:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  802223:	50                   	push   %eax
+  802224:	68 b1 21 80 00       	push   $0x8021b1
+  802229:	e8 3e e1 ff ff       	call   80036c <vprintfmt>
+  if (b.idx > 0)
+  80222e:	83 c4 10             	add    $0x10,%esp
+  802231:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  802238:	7f 12                	jg     80224c <vfprintf+0x65>
+    writebuf(&b);
+
+  return b.result ? b.result : b.error;
+  80223a:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  802240:	85 c0                	test   %eax,%eax
+  802242:	75 06                	jne    80224a <vfprintf+0x63>
+  802244:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+}
+  80224a:	c9                   	leave
+  80224b:	c3                   	ret
+    writebuf(&b);
+  80224c:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  802252:	e8 1b ff ff ff       	call   802172 <writebuf>
+  802257:	eb e1                	jmp    80223a <vfprintf+0x53>
+
+00802259 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...)
+{
+  802259:	55                   	push   %ebp
+  80225a:	89 e5                	mov    %esp,%ebp
+  80225c:	83 ec 0c             	sub    $0xc,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  80225f:	8d 45 10             	lea    0x10(%ebp),%eax
+  cnt = vfprintf(fd, fmt, ap);
+  802262:	50                   	push   %eax
+  802263:	ff 75 0c             	push   0xc(%ebp)
+  802266:	ff 75 08             	push   0x8(%ebp)
+  802269:	e8 79 ff ff ff       	call   8021e7 <vfprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  80226e:	c9                   	leave
+  80226f:	c3                   	ret
+
+00802270 <printf>:
+
+int
+printf(const char *fmt, ...)
+{
+  802270:	55                   	push   %ebp
+  802271:	89 e5                	mov    %esp,%ebp
+  802273:	83 ec 0c             	sub    $0xc,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  802276:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vfprintf(1, fmt, ap);
+  802279:	50                   	push   %eax
+  80227a:	ff 75 08             	push   0x8(%ebp)
+  80227d:	6a 01                	push   $0x1
+  80227f:	e8 63 ff ff ff       	call   8021e7 <vfprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  802284:	c9                   	leave
+  802285:	c3                   	ret
+
+00802286 <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  802286:	55                   	push   %ebp
+  802287:	89 e5                	mov    %esp,%ebp
+  802289:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  80228c:	50                   	push   %eax
+  80228d:	e8 bf ee ff ff       	call   801151 <fd2data>
+  802292:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  802297:	c9                   	leave
+  802298:	c3                   	ret
+
+00802299 <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802299:	55                   	push   %ebp
+  80229a:	89 e5                	mov    %esp,%ebp
+  80229c:	56                   	push   %esi
+  80229d:	53                   	push   %ebx
+  80229e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  8022a1:	83 ec 0c             	sub    $0xc,%esp
+  8022a4:	ff 75 08             	push   0x8(%ebp)
+  8022a7:	e8 a5 ee ff ff       	call   801151 <fd2data>
+  8022ac:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  8022ae:	83 c4 08             	add    $0x8,%esp
+  8022b1:	68 28 35 80 00       	push   $0x803528
+  8022b6:	53                   	push   %ebx
+  8022b7:	e8 a7 e5 ff ff       	call   800863 <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  8022bc:	8b 46 04             	mov    0x4(%esi),%eax
+  8022bf:	2b 06                	sub    (%esi),%eax
+  8022c1:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  8022c7:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8022ce:	00 00 00 
+  stat->st_dev = &devpipe;
+  8022d1:	c7 83 88 00 00 00 20 	movl   $0x804020,0x88(%ebx)
+  8022d8:	40 80 00 
+  return 0;
+}
+  8022db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022e0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022e3:	5b                   	pop    %ebx
+  8022e4:	5e                   	pop    %esi
+  8022e5:	5d                   	pop    %ebp
+  8022e6:	c3                   	ret
+
+008022e7 <pipe_wakeup>:
+{
+  8022e7:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  8022e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022ee:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  8022f1:	85 c0                	test   %eax,%eax
+  8022f3:	75 01                	jne    8022f6 <pipe_wakeup+0xf>
+  8022f5:	c3                   	ret
+{
+  8022f6:	55                   	push   %ebp
+  8022f7:	89 e5                	mov    %esp,%ebp
+  8022f9:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  8022fc:	6a 00                	push   $0x0
+  8022fe:	68 00 00 c0 ee       	push   $0xeec00000
+  802303:	52                   	push   %edx
+  802304:	e8 e5 ec ff ff       	call   800fee <sys_chan_wakeup>
+  802309:	83 c4 10             	add    $0x10,%esp
+}
+  80230c:	c9                   	leave
+  80230d:	c3                   	ret
+
+0080230e <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80230e:	55                   	push   %ebp
+  80230f:	89 e5                	mov    %esp,%ebp
+  802311:	57                   	push   %edi
+  802312:	56                   	push   %esi
+  802313:	53                   	push   %ebx
+  802314:	83 ec 18             	sub    $0x18,%esp
+  802317:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  80231a:	57                   	push   %edi
+  80231b:	e8 31 ee ff ff       	call   801151 <fd2data>
+  802320:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  802322:	83 c4 10             	add    $0x10,%esp
+  802325:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  802329:	74 2a                	je     802355 <devpipe_close+0x47>
+  80232b:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  802330:	89 f8                	mov    %edi,%eax
+  802332:	e8 4f ff ff ff       	call   802286 <pipe_ring>
+  802337:	83 ec 08             	sub    $0x8,%esp
+  80233a:	01 d8                	add    %ebx,%eax
+  80233c:	50                   	push   %eax
+  80233d:	6a 00                	push   $0x0
+  80233f:	e8 d3 e9 ff ff       	call   800d17 <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  802344:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80234a:	83 c4 10             	add    $0x10,%esp
+  80234d:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  802353:	75 db                	jne    802330 <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  802355:	83 ec 08             	sub    $0x8,%esp
+  802358:	57                   	push   %edi
+  802359:	6a 00                	push   $0x0
+  80235b:	e8 b7 e9 ff ff       	call   800d17 <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  802360:	83 c4 10             	add    $0x10,%esp
+  802363:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  802367:	75 13                	jne    80237c <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  802369:	83 ec 08             	sub    $0x8,%esp
+  80236c:	56                   	push   %esi
+  80236d:	6a 00                	push   $0x0
+  80236f:	e8 a3 e9 ff ff       	call   800d17 <sys_page_unmap>
+}
+  802374:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802377:	5b                   	pop    %ebx
+  802378:	5e                   	pop    %esi
+  802379:	5f                   	pop    %edi
+  80237a:	5d                   	pop    %ebp
+  80237b:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  80237c:	8d 56 04             	lea    0x4(%esi),%edx
+  80237f:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802382:	e8 60 ff ff ff       	call   8022e7 <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802387:	8d 46 30             	lea    0x30(%esi),%eax
+  80238a:	89 f2                	mov    %esi,%edx
+  80238c:	e8 56 ff ff ff       	call   8022e7 <pipe_wakeup>
+  802391:	eb d6                	jmp    802369 <devpipe_close+0x5b>
+
+00802393 <_pipeisclosed>:
+{
+  802393:	55                   	push   %ebp
+  802394:	89 e5                	mov    %esp,%ebp
+  802396:	57                   	push   %edi
+  802397:	56                   	push   %esi
+  802398:	53                   	push   %ebx
+  802399:	83 ec 1c             	sub    $0x1c,%esp
+  80239c:	89 c7                	mov    %eax,%edi
+  80239e:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  8023a0:	a1 00 80 80 00       	mov    0x808000,%eax
+  8023a5:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  8023a8:	83 ec 0c             	sub    $0xc,%esp
+  8023ab:	57                   	push   %edi
+  8023ac:	e8 18 0a 00 00       	call   802dc9 <pageref>
+  8023b1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8023b4:	89 34 24             	mov    %esi,(%esp)
+  8023b7:	e8 0d 0a 00 00       	call   802dc9 <pageref>
+    nn = thisenv->env_runs;
+  8023bc:	8b 15 00 80 80 00    	mov    0x808000,%edx
+  8023c2:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  8023c5:	83 c4 10             	add    $0x10,%esp
+  8023c8:	39 cb                	cmp    %ecx,%ebx
+  8023ca:	74 1b                	je     8023e7 <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  8023cc:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8023cf:	75 cf                	jne    8023a0 <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8023d1:	8b 42 58             	mov    0x58(%edx),%eax
+  8023d4:	6a 01                	push   $0x1
+  8023d6:	50                   	push   %eax
+  8023d7:	53                   	push   %ebx
+  8023d8:	68 2f 35 80 00       	push   $0x80352f
+  8023dd:	e8 93 de ff ff       	call   800275 <cprintf>
+  8023e2:	83 c4 10             	add    $0x10,%esp
+  8023e5:	eb b9                	jmp    8023a0 <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  8023e7:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8023ea:	0f 94 c0             	sete   %al
+  8023ed:	0f b6 c0             	movzbl %al,%eax
+}
+  8023f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023f3:	5b                   	pop    %ebx
+  8023f4:	5e                   	pop    %esi
+  8023f5:	5f                   	pop    %edi
+  8023f6:	5d                   	pop    %ebp
+  8023f7:	c3                   	ret
+
+008023f8 <devpipe_write_bulk>:
+{
+  8023f8:	55                   	push   %ebp
+  8023f9:	89 e5                	mov    %esp,%ebp
+  8023fb:	57                   	push   %edi
+  8023fc:	56                   	push   %esi
+  8023fd:	53                   	push   %ebx
+  8023fe:	83 ec 1c             	sub    $0x1c,%esp
+  802401:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802404:	89 d6                	mov    %edx,%esi
+  802406:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  802409:	e8 78 fe ff ff       	call   802286 <pipe_ring>
+  80240e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  802411:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802416:	8d 46 04             	lea    0x4(%esi),%eax
+  802419:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  80241c:	eb 75                	jmp    802493 <devpipe_write_bulk+0x9b>
+  80241e:	b8 01 00 00 00       	mov    $0x1,%eax
+  802423:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802427:	6a 64                	push   $0x64
+  802429:	68 00 00 c0 ee       	push   $0xeec00000
+  80242e:	53                   	push   %ebx
+  80242f:	56                   	push   %esi
+  802430:	e8 96 eb ff ff       	call   800fcb <sys_chan_sleep>
+      continue;
+  802435:	83 c4 10             	add    $0x10,%esp
+  802438:	eb 59                	jmp    802493 <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  80243a:	89 d1                	mov    %edx,%ecx
+  80243c:	c1 f9 1f             	sar    $0x1f,%ecx
+  80243f:	c1 e9 11             	shr    $0x11,%ecx
+  802442:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802445:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  80244a:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  80244c:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  802452:	29 d3                	sub    %edx,%ebx
+  802454:	ba 00 80 00 00       	mov    $0x8000,%edx
+  802459:	29 c2                	sub    %eax,%edx
+  80245b:	39 d3                	cmp    %edx,%ebx
+  80245d:	0f 47 da             	cmova  %edx,%ebx
+  802460:	8b 55 08             	mov    0x8(%ebp),%edx
+  802463:	29 fa                	sub    %edi,%edx
+  802465:	39 d3                	cmp    %edx,%ebx
+  802467:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  80246a:	83 ec 04             	sub    $0x4,%esp
+  80246d:	53                   	push   %ebx
+  80246e:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802471:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  802474:	52                   	push   %edx
+  802475:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802478:	01 c8                	add    %ecx,%eax
+  80247a:	50                   	push   %eax
+  80247b:	e8 cb e5 ff ff       	call   800a4b <memcpy>
+    i += m;
+  802480:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  802482:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802485:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802488:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80248b:	e8 57 fe ff ff       	call   8022e7 <pipe_wakeup>
+  802490:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802493:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802496:	73 2b                	jae    8024c3 <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  802498:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  80249a:	8b 56 04             	mov    0x4(%esi),%edx
+  80249d:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  8024a3:	39 d0                	cmp    %edx,%eax
+  8024a5:	7d 93                	jge    80243a <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  8024a7:	89 f2                	mov    %esi,%edx
+  8024a9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8024ac:	e8 e2 fe ff ff       	call   802393 <_pipeisclosed>
+  8024b1:	85 c0                	test   %eax,%eax
+  8024b3:	0f 84 65 ff ff ff    	je     80241e <devpipe_write_bulk+0x26>
+        return i;
+  8024b9:	89 f8                	mov    %edi,%eax
+}
+  8024bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024be:	5b                   	pop    %ebx
+  8024bf:	5e                   	pop    %esi
+  8024c0:	5f                   	pop    %edi
+  8024c1:	5d                   	pop    %ebp
+  8024c2:	c3                   	ret
+  return i;
+  8024c3:	89 f8                	mov    %edi,%eax
+  8024c5:	eb f4                	jmp    8024bb <devpipe_write_bulk+0xc3>
+
+008024c7 <devpipe_write>:
+{
+  8024c7:	55                   	push   %ebp
+  8024c8:	89 e5                	mov    %esp,%ebp
+  8024ca:	57                   	push   %edi
+  8024cb:	56                   	push   %esi
+  8024cc:	53                   	push   %ebx
+  8024cd:	83 ec 28             	sub    $0x28,%esp
+  8024d0:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  8024d3:	56                   	push   %esi
+  8024d4:	e8 78 ec ff ff       	call   801151 <fd2data>
+  8024d9:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  8024db:	8b 78 28             	mov    0x28(%eax),%edi
+  8024de:	83 c4 10             	add    $0x10,%esp
+  8024e1:	85 ff                	test   %edi,%edi
+  8024e3:	75 25                	jne    80250a <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  8024e5:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8024e8:	74 66                	je     802550 <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8024ea:	8b 43 04             	mov    0x4(%ebx),%eax
+  8024ed:	8b 0b                	mov    (%ebx),%ecx
+  8024ef:	8d 51 20             	lea    0x20(%ecx),%edx
+  8024f2:	39 d0                	cmp    %edx,%eax
+  8024f4:	72 2b                	jb     802521 <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  8024f6:	89 da                	mov    %ebx,%edx
+  8024f8:	89 f0                	mov    %esi,%eax
+  8024fa:	e8 94 fe ff ff       	call   802393 <_pipeisclosed>
+  8024ff:	85 c0                	test   %eax,%eax
+  802501:	75 51                	jne    802554 <devpipe_write+0x8d>
+      sys_yield();
+  802503:	e8 28 e7 ff ff       	call   800c30 <sys_yield>
+  802508:	eb e0                	jmp    8024ea <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  80250a:	83 ec 0c             	sub    $0xc,%esp
+  80250d:	ff 75 10             	push   0x10(%ebp)
+  802510:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802513:	89 c2                	mov    %eax,%edx
+  802515:	89 f0                	mov    %esi,%eax
+  802517:	e8 dc fe ff ff       	call   8023f8 <devpipe_write_bulk>
+  80251c:	83 c4 10             	add    $0x10,%esp
+  80251f:	eb 38                	jmp    802559 <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802521:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802524:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802528:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  80252b:	89 c2                	mov    %eax,%edx
+  80252d:	c1 fa 1f             	sar    $0x1f,%edx
+  802530:	89 d1                	mov    %edx,%ecx
+  802532:	c1 e9 1b             	shr    $0x1b,%ecx
+  802535:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802538:	83 e2 1f             	and    $0x1f,%edx
+  80253b:	29 ca                	sub    %ecx,%edx
+  80253d:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802541:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  802545:	83 c0 01             	add    $0x1,%eax
+  802548:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  80254b:	83 c7 01             	add    $0x1,%edi
+  80254e:	eb 95                	jmp    8024e5 <devpipe_write+0x1e>
+  return i;
+  802550:	89 f8                	mov    %edi,%eax
+  802552:	eb 05                	jmp    802559 <devpipe_write+0x92>
+        return 0;
+  802554:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802559:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80255c:	5b                   	pop    %ebx
+  80255d:	5e                   	pop    %esi
+  80255e:	5f                   	pop    %edi
+  80255f:	5d                   	pop    %ebp
+  802560:	c3                   	ret
+
+00802561 <devpipe_read_bulk>:
+{
+  802561:	55                   	push   %ebp
+  802562:	89 e5                	mov    %esp,%ebp
+  802564:	57                   	push   %edi
+  802565:	56                   	push   %esi
+  802566:	53                   	push   %ebx
+  802567:	83 ec 2c             	sub    $0x2c,%esp
+  80256a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80256d:	89 d6                	mov    %edx,%esi
+  80256f:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802572:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  802575:	e8 0c fd ff ff       	call   802286 <pipe_ring>
+  80257a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  80257d:	85 db                	test   %ebx,%ebx
+  80257f:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802584:	0f 45 c3             	cmovne %ebx,%eax
+  802587:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80258a:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  80258f:	8d 46 30             	lea    0x30(%esi),%eax
+  802592:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  802595:	eb 50                	jmp    8025e7 <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  802597:	89 d1                	mov    %edx,%ecx
+  802599:	c1 f9 1f             	sar    $0x1f,%ecx
+  80259c:	c1 e9 11             	shr    $0x11,%ecx
+  80259f:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  8025a2:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8025a7:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  8025a9:	29 d3                	sub    %edx,%ebx
+  8025ab:	ba 00 80 00 00       	mov    $0x8000,%edx
+  8025b0:	29 c2                	sub    %eax,%edx
+  8025b2:	39 d3                	cmp    %edx,%ebx
+  8025b4:	0f 47 da             	cmova  %edx,%ebx
+  8025b7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8025ba:	29 fa                	sub    %edi,%edx
+  8025bc:	39 d3                	cmp    %edx,%ebx
+  8025be:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  8025c1:	83 ec 04             	sub    $0x4,%esp
+  8025c4:	53                   	push   %ebx
+  8025c5:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8025c8:	01 c8                	add    %ecx,%eax
+  8025ca:	50                   	push   %eax
+  8025cb:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8025ce:	01 f8                	add    %edi,%eax
+  8025d0:	50                   	push   %eax
+  8025d1:	e8 75 e4 ff ff       	call   800a4b <memcpy>
+    i += m;
+  8025d6:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  8025d8:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8025da:	89 f2                	mov    %esi,%edx
+  8025dc:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8025df:	e8 03 fd ff ff       	call   8022e7 <pipe_wakeup>
+  8025e4:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  8025e7:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  8025ea:	73 51                	jae    80263d <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  8025ec:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  8025ef:	8b 16                	mov    (%esi),%edx
+  8025f1:	39 da                	cmp    %ebx,%edx
+  8025f3:	75 a2                	jne    802597 <devpipe_read_bulk+0x36>
+      if (i > 0)
+  8025f5:	85 ff                	test   %edi,%edi
+  8025f7:	75 44                	jne    80263d <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  8025f9:	89 f2                	mov    %esi,%edx
+  8025fb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8025fe:	e8 90 fd ff ff       	call   802393 <_pipeisclosed>
+  802603:	85 c0                	test   %eax,%eax
+  802605:	75 3a                	jne    802641 <devpipe_read_bulk+0xe0>
+  802607:	b8 01 00 00 00       	mov    $0x1,%eax
+  80260c:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802610:	6a 64                	push   $0x64
+  802612:	ff 75 d4             	push   -0x2c(%ebp)
+  802615:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  802616:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802619:	50                   	push   %eax
+  80261a:	e8 ac e9 ff ff       	call   800fcb <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  80261f:	85 c0                	test   %eax,%eax
+  802621:	ba 00 00 00 00       	mov    $0x0,%edx
+  802626:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  802629:	83 c4 10             	add    $0x10,%esp
+  80262c:	a8 01                	test   $0x1,%al
+  80262e:	74 b7                	je     8025e7 <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  802630:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  802635:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802638:	5b                   	pop    %ebx
+  802639:	5e                   	pop    %esi
+  80263a:	5f                   	pop    %edi
+  80263b:	5d                   	pop    %ebp
+  80263c:	c3                   	ret
+  return i;
+  80263d:	89 f8                	mov    %edi,%eax
+  80263f:	eb f4                	jmp    802635 <devpipe_read_bulk+0xd4>
+        return 0;
+  802641:	b8 00 00 00 00       	mov    $0x0,%eax
+  802646:	eb ed                	jmp    802635 <devpipe_read_bulk+0xd4>
+
+00802648 <devpipe_read>:
+{
+  802648:	55                   	push   %ebp
+  802649:	89 e5                	mov    %esp,%ebp
+  80264b:	57                   	push   %edi
+  80264c:	56                   	push   %esi
+  80264d:	53                   	push   %ebx
+  80264e:	83 ec 18             	sub    $0x18,%esp
+  802651:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  802654:	57                   	push   %edi
+  802655:	e8 f7 ea ff ff       	call   801151 <fd2data>
+  80265a:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  80265c:	8b 70 28             	mov    0x28(%eax),%esi
+  80265f:	83 c4 10             	add    $0x10,%esp
+  802662:	85 f6                	test   %esi,%esi
+  802664:	75 24                	jne    80268a <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  802666:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802669:	74 60                	je     8026cb <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  80266b:	8b 03                	mov    (%ebx),%eax
+  80266d:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802670:	75 3b                	jne    8026ad <devpipe_read+0x65>
+      if (i > 0)
+  802672:	85 f6                	test   %esi,%esi
+  802674:	75 2d                	jne    8026a3 <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  802676:	89 da                	mov    %ebx,%edx
+  802678:	89 f8                	mov    %edi,%eax
+  80267a:	e8 14 fd ff ff       	call   802393 <_pipeisclosed>
+  80267f:	85 c0                	test   %eax,%eax
+  802681:	75 4c                	jne    8026cf <devpipe_read+0x87>
+      sys_yield();
+  802683:	e8 a8 e5 ff ff       	call   800c30 <sys_yield>
+  802688:	eb e1                	jmp    80266b <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  80268a:	83 ec 08             	sub    $0x8,%esp
+  80268d:	6a 00                	push   $0x0
+  80268f:	ff 75 10             	push   0x10(%ebp)
+  802692:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802695:	89 c2                	mov    %eax,%edx
+  802697:	89 f8                	mov    %edi,%eax
+  802699:	e8 c3 fe ff ff       	call   802561 <devpipe_read_bulk>
+  80269e:	83 c4 10             	add    $0x10,%esp
+  8026a1:	eb 02                	jmp    8026a5 <devpipe_read+0x5d>
+        return i;
+  8026a3:	89 f0                	mov    %esi,%eax
+}
+  8026a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026a8:	5b                   	pop    %ebx
+  8026a9:	5e                   	pop    %esi
+  8026aa:	5f                   	pop    %edi
+  8026ab:	5d                   	pop    %ebp
+  8026ac:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8026ad:	99                   	cltd
+  8026ae:	c1 ea 1b             	shr    $0x1b,%edx
+  8026b1:	01 d0                	add    %edx,%eax
+  8026b3:	83 e0 1f             	and    $0x1f,%eax
+  8026b6:	29 d0                	sub    %edx,%eax
+  8026b8:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8026bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8026c0:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  8026c3:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  8026c6:	83 c6 01             	add    $0x1,%esi
+  8026c9:	eb 9b                	jmp    802666 <devpipe_read+0x1e>
+  return i;
+  8026cb:	89 f0                	mov    %esi,%eax
+  8026cd:	eb d6                	jmp    8026a5 <devpipe_read+0x5d>
+        return 0;
+  8026cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026d4:	eb cf                	jmp    8026a5 <devpipe_read+0x5d>
+
+008026d6 <pipe2>:
+{
+  8026d6:	55                   	push   %ebp
+  8026d7:	89 e5                	mov    %esp,%ebp
+  8026d9:	57                   	push   %edi
+  8026da:	56                   	push   %esi
+  8026db:	53                   	push   %ebx
+  8026dc:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  8026df:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8026e2:	50                   	push   %eax
+  8026e3:	e8 7d ea ff ff       	call   801165 <fd_alloc>
+  8026e8:	89 c3                	mov    %eax,%ebx
+  8026ea:	83 c4 10             	add    $0x10,%esp
+  8026ed:	85 c0                	test   %eax,%eax
+  8026ef:	0f 88 fb 01 00 00    	js     8028f0 <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8026f5:	83 ec 04             	sub    $0x4,%esp
+  8026f8:	68 07 04 00 00       	push   $0x407
+  8026fd:	ff 75 e4             	push   -0x1c(%ebp)
+  802700:	6a 00                	push   $0x0
+  802702:	e8 8b e5 ff ff       	call   800c92 <sys_page_alloc>
+  802707:	89 c3                	mov    %eax,%ebx
+  802709:	83 c4 10             	add    $0x10,%esp
+  80270c:	85 c0                	test   %eax,%eax
+  80270e:	0f 88 dc 01 00 00    	js     8028f0 <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  802714:	83 ec 0c             	sub    $0xc,%esp
+  802717:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80271a:	50                   	push   %eax
+  80271b:	e8 45 ea ff ff       	call   801165 <fd_alloc>
+  802720:	89 c3                	mov    %eax,%ebx
+  802722:	83 c4 10             	add    $0x10,%esp
+  802725:	85 c0                	test   %eax,%eax
+  802727:	0f 88 b3 01 00 00    	js     8028e0 <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80272d:	83 ec 04             	sub    $0x4,%esp
+  802730:	68 07 04 00 00       	push   $0x407
+  802735:	ff 75 e0             	push   -0x20(%ebp)
+  802738:	6a 00                	push   $0x0
+  80273a:	e8 53 e5 ff ff       	call   800c92 <sys_page_alloc>
+  80273f:	89 c3                	mov    %eax,%ebx
+  802741:	83 c4 10             	add    $0x10,%esp
+  802744:	85 c0                	test   %eax,%eax
+  802746:	0f 88 94 01 00 00    	js     8028e0 <pipe2+0x20a>
+  va = fd2data(fd0);
+  80274c:	83 ec 0c             	sub    $0xc,%esp
+  80274f:	ff 75 e4             	push   -0x1c(%ebp)
+  802752:	e8 fa e9 ff ff       	call   801151 <fd2data>
+  802757:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802759:	83 c4 0c             	add    $0xc,%esp
+  80275c:	68 07 04 00 00       	push   $0x407
+  802761:	50                   	push   %eax
+  802762:	6a 00                	push   $0x0
+  802764:	e8 29 e5 ff ff       	call   800c92 <sys_page_alloc>
+  802769:	89 c3                	mov    %eax,%ebx
+  80276b:	83 c4 10             	add    $0x10,%esp
+  80276e:	85 c0                	test   %eax,%eax
+  802770:	0f 88 5a 01 00 00    	js     8028d0 <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802776:	83 ec 0c             	sub    $0xc,%esp
+  802779:	ff 75 e0             	push   -0x20(%ebp)
+  80277c:	e8 d0 e9 ff ff       	call   801151 <fd2data>
+  802781:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802788:	50                   	push   %eax
+  802789:	6a 00                	push   $0x0
+  80278b:	57                   	push   %edi
+  80278c:	6a 00                	push   $0x0
+  80278e:	e8 42 e5 ff ff       	call   800cd5 <sys_page_map>
+  802793:	89 c3                	mov    %eax,%ebx
+  802795:	83 c4 20             	add    $0x20,%esp
+  802798:	85 c0                	test   %eax,%eax
+  80279a:	0f 88 22 01 00 00    	js     8028c2 <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  8027a0:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  8027a4:	74 72                	je     802818 <pipe2+0x142>
+  8027a6:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  8027ab:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8027ae:	e8 d3 fa ff ff       	call   802286 <pipe_ring>
+  8027b3:	83 ec 04             	sub    $0x4,%esp
+  8027b6:	68 07 04 00 00       	push   $0x407
+  8027bb:	01 f0                	add    %esi,%eax
+  8027bd:	50                   	push   %eax
+  8027be:	6a 00                	push   $0x0
+  8027c0:	e8 cd e4 ff ff       	call   800c92 <sys_page_alloc>
+  8027c5:	89 c3                	mov    %eax,%ebx
+  8027c7:	83 c4 10             	add    $0x10,%esp
+  8027ca:	85 c0                	test   %eax,%eax
+  8027cc:	0f 88 97 00 00 00    	js     802869 <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  8027d2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8027d5:	e8 ac fa ff ff       	call   802286 <pipe_ring>
+  8027da:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  8027dd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8027e0:	e8 a1 fa ff ff       	call   802286 <pipe_ring>
+  8027e5:	83 ec 0c             	sub    $0xc,%esp
+  8027e8:	68 07 04 00 00       	push   $0x407
+  8027ed:	53                   	push   %ebx
+  8027ee:	6a 00                	push   $0x0
+  8027f0:	01 f0                	add    %esi,%eax
+  8027f2:	50                   	push   %eax
+  8027f3:	6a 00                	push   $0x0
+  8027f5:	e8 db e4 ff ff       	call   800cd5 <sys_page_map>
+  8027fa:	89 c3                	mov    %eax,%ebx
+  8027fc:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802802:	83 c4 20             	add    $0x20,%esp
+  802805:	85 c0                	test   %eax,%eax
+  802807:	78 60                	js     802869 <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  802809:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  80280f:	75 9a                	jne    8027ab <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  802811:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  802818:	a1 20 40 80 00       	mov    0x804020,%eax
+  80281d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802820:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  802822:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802825:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  80282c:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80282f:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  802831:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802834:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  80283b:	83 ec 0c             	sub    $0xc,%esp
+  80283e:	ff 75 e4             	push   -0x1c(%ebp)
+  802841:	e8 fb e8 ff ff       	call   801141 <fd2num>
+  802846:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802849:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  80284b:	83 c4 04             	add    $0x4,%esp
+  80284e:	ff 75 e0             	push   -0x20(%ebp)
+  802851:	e8 eb e8 ff ff       	call   801141 <fd2num>
+  802856:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802859:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  80285c:	83 c4 10             	add    $0x10,%esp
+  80285f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802864:	e9 87 00 00 00       	jmp    8028f0 <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802869:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  80286e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802871:	e8 10 fa ff ff       	call   802286 <pipe_ring>
+  802876:	83 ec 08             	sub    $0x8,%esp
+  802879:	01 f0                	add    %esi,%eax
+  80287b:	50                   	push   %eax
+  80287c:	6a 00                	push   $0x0
+  80287e:	e8 94 e4 ff ff       	call   800d17 <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  802883:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802886:	e8 fb f9 ff ff       	call   802286 <pipe_ring>
+  80288b:	83 c4 08             	add    $0x8,%esp
+  80288e:	01 f0                	add    %esi,%eax
+  802890:	50                   	push   %eax
+  802891:	6a 00                	push   $0x0
+  802893:	e8 7f e4 ff ff       	call   800d17 <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802898:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80289e:	83 c4 10             	add    $0x10,%esp
+  8028a1:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  8028a7:	75 c5                	jne    80286e <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  8028a9:	83 ec 0c             	sub    $0xc,%esp
+  8028ac:	ff 75 e0             	push   -0x20(%ebp)
+  8028af:	e8 9d e8 ff ff       	call   801151 <fd2data>
+  8028b4:	83 c4 08             	add    $0x8,%esp
+  8028b7:	50                   	push   %eax
+  8028b8:	6a 00                	push   $0x0
+  8028ba:	e8 58 e4 ff ff       	call   800d17 <sys_page_unmap>
+  8028bf:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  8028c2:	83 ec 08             	sub    $0x8,%esp
+  8028c5:	57                   	push   %edi
+  8028c6:	6a 00                	push   $0x0
+  8028c8:	e8 4a e4 ff ff       	call   800d17 <sys_page_unmap>
+  8028cd:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  8028d0:	83 ec 08             	sub    $0x8,%esp
+  8028d3:	ff 75 e0             	push   -0x20(%ebp)
+  8028d6:	6a 00                	push   $0x0
+  8028d8:	e8 3a e4 ff ff       	call   800d17 <sys_page_unmap>
+  8028dd:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  8028e0:	83 ec 08             	sub    $0x8,%esp
+  8028e3:	ff 75 e4             	push   -0x1c(%ebp)
+  8028e6:	6a 00                	push   $0x0
+  8028e8:	e8 2a e4 ff ff       	call   800d17 <sys_page_unmap>
+  8028ed:	83 c4 10             	add    $0x10,%esp
+}
+  8028f0:	89 d8                	mov    %ebx,%eax
+  8028f2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028f5:	5b                   	pop    %ebx
+  8028f6:	5e                   	pop    %esi
+  8028f7:	5f                   	pop    %edi
+  8028f8:	5d                   	pop    %ebp
+  8028f9:	c3                   	ret
+
+008028fa <pipe>:
+{
+  8028fa:	55                   	push   %ebp
+  8028fb:	89 e5                	mov    %esp,%ebp
+  8028fd:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  802900:	6a 00                	push   $0x0
+  802902:	ff 75 08             	push   0x8(%ebp)
+  802905:	e8 cc fd ff ff       	call   8026d6 <pipe2>
+}
+  80290a:	c9                   	leave
+  80290b:	c3                   	ret
+
+0080290c <pipeisclosed>:
+{
+  80290c:	55                   	push   %ebp
+  80290d:	89 e5                	mov    %esp,%ebp
+  80290f:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802912:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802915:	50                   	push   %eax
+  802916:	ff 75 08             	push   0x8(%ebp)
+  802919:	e8 9d e8 ff ff       	call   8011bb <fd_lookup>
+  80291e:	83 c4 10             	add    $0x10,%esp
+  802921:	85 c0                	test   %eax,%eax
+  802923:	78 18                	js     80293d <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  802925:	83 ec 0c             	sub    $0xc,%esp
+  802928:	ff 75 f4             	push   -0xc(%ebp)
+  80292b:	e8 21 e8 ff ff       	call   801151 <fd2data>
+  802930:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  802932:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802935:	e8 59 fa ff ff       	call   802393 <_pipeisclosed>
+  80293a:	83 c4 10             	add    $0x10,%esp
+}
+  80293d:	c9                   	leave
+  80293e:	c3                   	ret
+
+0080293f <pipe_splice>:
+{
+  80293f:	55                   	push   %ebp
+  802940:	89 e5                	mov    %esp,%ebp
+  802942:	57                   	push   %edi
+  802943:	56                   	push   %esi
+  802944:	53                   	push   %ebx
+  802945:	83 ec 34             	sub    $0x34,%esp
+  802948:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80294b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80294e:	50                   	push   %eax
+  80294f:	ff 75 08             	push   0x8(%ebp)
+  802952:	e8 64 e8 ff ff       	call   8011bb <fd_lookup>
+  802957:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80295a:	83 c4 10             	add    $0x10,%esp
+  80295d:	85 c0                	test   %eax,%eax
+  80295f:	0f 88 d7 00 00 00    	js     802a3c <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  802965:	83 ec 0c             	sub    $0xc,%esp
+  802968:	ff 75 e4             	push   -0x1c(%ebp)
+  80296b:	e8 e1 e7 ff ff       	call   801151 <fd2data>
+  802970:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802972:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802975:	83 c4 10             	add    $0x10,%esp
+  802978:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  80297e:	39 10                	cmp    %edx,(%eax)
+  802980:	0f 85 c1 00 00 00    	jne    802a47 <pipe_splice+0x108>
+  802986:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  80298a:	0f 84 c0 00 00 00    	je     802a50 <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  802990:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802994:	0f 84 bf 00 00 00    	je     802a59 <pipe_splice+0x11a>
+  80299a:	89 f7                	mov    %esi,%edi
+  80299c:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  8029a2:	0f 85 ba 00 00 00    	jne    802a62 <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  8029a8:	8d 43 04             	lea    0x4(%ebx),%eax
+  8029ab:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8029ae:	eb 38                	jmp    8029e8 <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  8029b0:	83 ec 0c             	sub    $0xc,%esp
+  8029b3:	68 00 10 00 00       	push   $0x1000
+  8029b8:	89 f1                	mov    %esi,%ecx
+  8029ba:	89 da                	mov    %ebx,%edx
+  8029bc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8029bf:	e8 34 fa ff ff       	call   8023f8 <devpipe_write_bulk>
+  8029c4:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8029c7:	83 c4 10             	add    $0x10,%esp
+  8029ca:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8029cf:	75 53                	jne    802a24 <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  8029d1:	83 ec 08             	sub    $0x8,%esp
+  8029d4:	56                   	push   %esi
+  8029d5:	6a 00                	push   $0x0
+  8029d7:	e8 3b e3 ff ff       	call   800d17 <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  8029dc:	83 c7 01             	add    $0x1,%edi
+  8029df:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8029e5:	83 c4 10             	add    $0x10,%esp
+  8029e8:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8029eb:	74 3a                	je     802a27 <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  8029ed:	8b 03                	mov    (%ebx),%eax
+  8029ef:	39 43 04             	cmp    %eax,0x4(%ebx)
+  8029f2:	75 bc                	jne    8029b0 <pipe_splice+0x71>
+  8029f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029f9:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  8029fd:	85 c0                	test   %eax,%eax
+  8029ff:	74 af                	je     8029b0 <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802a01:	83 ec 04             	sub    $0x4,%esp
+  802a04:	6a 07                	push   $0x7
+  802a06:	56                   	push   %esi
+  802a07:	ff 75 d0             	push   -0x30(%ebp)
+  802a0a:	e8 df e5 ff ff       	call   800fee <sys_chan_wakeup>
+  802a0f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802a12:	83 c4 10             	add    $0x10,%esp
+  802a15:	85 c0                	test   %eax,%eax
+  802a17:	79 b8                	jns    8029d1 <pipe_splice+0x92>
+  802a19:	b8 01 00 00 00       	mov    $0x1,%eax
+  802a1e:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802a22:	eb 8c                	jmp    8029b0 <pipe_splice+0x71>
+  802a24:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  802a27:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802a2b:	75 06                	jne    802a33 <pipe_splice+0xf4>
+  802a2d:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802a31:	78 09                	js     802a3c <pipe_splice+0xfd>
+  return i * PGSIZE;
+  802a33:	8b 45 10             	mov    0x10(%ebp),%eax
+  802a36:	c1 e0 0c             	shl    $0xc,%eax
+  802a39:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  802a3c:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802a3f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a42:	5b                   	pop    %ebx
+  802a43:	5e                   	pop    %esi
+  802a44:	5f                   	pop    %edi
+  802a45:	5d                   	pop    %ebp
+  802a46:	c3                   	ret
+    return -E_INVAL;
+  802a47:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802a4e:	eb ec                	jmp    802a3c <pipe_splice+0xfd>
+  802a50:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802a57:	eb e3                	jmp    802a3c <pipe_splice+0xfd>
+  802a59:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802a60:	eb da                	jmp    802a3c <pipe_splice+0xfd>
+  802a62:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802a69:	eb d1                	jmp    802a3c <pipe_splice+0xfd>
+
+00802a6b <pipe_splice_read>:
+{
+  802a6b:	55                   	push   %ebp
+  802a6c:	89 e5                	mov    %esp,%ebp
+  802a6e:	53                   	push   %ebx
+  802a6f:	83 ec 1c             	sub    $0x1c,%esp
+  802a72:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802a75:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a78:	50                   	push   %eax
+  802a79:	ff 75 08             	push   0x8(%ebp)
+  802a7c:	e8 3a e7 ff ff       	call   8011bb <fd_lookup>
+  802a81:	83 c4 10             	add    $0x10,%esp
+  802a84:	85 c0                	test   %eax,%eax
+  802a86:	78 49                	js     802ad1 <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  802a88:	83 ec 0c             	sub    $0xc,%esp
+  802a8b:	ff 75 f4             	push   -0xc(%ebp)
+  802a8e:	e8 be e6 ff ff       	call   801151 <fd2data>
+  802a93:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802a95:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a98:	83 c4 10             	add    $0x10,%esp
+  802a9b:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  802aa1:	39 08                	cmp    %ecx,(%eax)
+  802aa3:	75 31                	jne    802ad6 <pipe_splice_read+0x6b>
+  802aa5:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  802aa9:	74 32                	je     802add <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  802aab:	8b 48 08             	mov    0x8(%eax),%ecx
+  802aae:	83 e1 03             	and    $0x3,%ecx
+  802ab1:	83 f9 01             	cmp    $0x1,%ecx
+  802ab4:	74 2e                	je     802ae4 <pipe_splice_read+0x79>
+  802ab6:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  802abc:	75 2d                	jne    802aeb <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  802abe:	83 ec 08             	sub    $0x8,%esp
+  802ac1:	53                   	push   %ebx
+  802ac2:	68 00 10 00 00       	push   $0x1000
+  802ac7:	89 d9                	mov    %ebx,%ecx
+  802ac9:	e8 93 fa ff ff       	call   802561 <devpipe_read_bulk>
+  802ace:	83 c4 10             	add    $0x10,%esp
+}
+  802ad1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ad4:	c9                   	leave
+  802ad5:	c3                   	ret
+    return -E_INVAL;
+  802ad6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802adb:	eb f4                	jmp    802ad1 <pipe_splice_read+0x66>
+  802add:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ae2:	eb ed                	jmp    802ad1 <pipe_splice_read+0x66>
+  802ae4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ae9:	eb e6                	jmp    802ad1 <pipe_splice_read+0x66>
+  802aeb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802af0:	eb df                	jmp    802ad1 <pipe_splice_read+0x66>
+
+00802af2 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  802af2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802af7:	c3                   	ret
+
+00802af8 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802af8:	55                   	push   %ebp
+  802af9:	89 e5                	mov    %esp,%ebp
+  802afb:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  802afe:	68 47 35 80 00       	push   $0x803547
+  802b03:	ff 75 0c             	push   0xc(%ebp)
+  802b06:	e8 58 dd ff ff       	call   800863 <strcpy>
+  return 0;
+}
+  802b0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b10:	c9                   	leave
+  802b11:	c3                   	ret
+
+00802b12 <devcons_write>:
+{
+  802b12:	55                   	push   %ebp
+  802b13:	89 e5                	mov    %esp,%ebp
+  802b15:	57                   	push   %edi
+  802b16:	56                   	push   %esi
+  802b17:	53                   	push   %ebx
+  802b18:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  802b1e:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  802b23:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  802b29:	eb 2e                	jmp    802b59 <devcons_write+0x47>
+    m = n - tot;
+  802b2b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802b2e:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  802b30:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802b35:	39 c3                	cmp    %eax,%ebx
+  802b37:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  802b3a:	83 ec 04             	sub    $0x4,%esp
+  802b3d:	53                   	push   %ebx
+  802b3e:	89 f0                	mov    %esi,%eax
+  802b40:	03 45 0c             	add    0xc(%ebp),%eax
+  802b43:	50                   	push   %eax
+  802b44:	57                   	push   %edi
+  802b45:	e8 9f de ff ff       	call   8009e9 <memmove>
+    sys_cputs(buf, m);
+  802b4a:	83 c4 08             	add    $0x8,%esp
+  802b4d:	53                   	push   %ebx
+  802b4e:	57                   	push   %edi
+  802b4f:	e8 3f e0 ff ff       	call   800b93 <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  802b54:	01 de                	add    %ebx,%esi
+  802b56:	83 c4 10             	add    $0x10,%esp
+  802b59:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802b5c:	72 cd                	jb     802b2b <devcons_write+0x19>
+}
+  802b5e:	89 f0                	mov    %esi,%eax
+  802b60:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b63:	5b                   	pop    %ebx
+  802b64:	5e                   	pop    %esi
+  802b65:	5f                   	pop    %edi
+  802b66:	5d                   	pop    %ebp
+  802b67:	c3                   	ret
+
+00802b68 <devcons_read>:
+{
+  802b68:	55                   	push   %ebp
+  802b69:	89 e5                	mov    %esp,%ebp
+  802b6b:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  802b6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b73:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802b77:	75 07                	jne    802b80 <devcons_read+0x18>
+  802b79:	eb 1f                	jmp    802b9a <devcons_read+0x32>
+    sys_yield();
+  802b7b:	e8 b0 e0 ff ff       	call   800c30 <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  802b80:	e8 2c e0 ff ff       	call   800bb1 <sys_cgetc>
+  802b85:	85 c0                	test   %eax,%eax
+  802b87:	74 f2                	je     802b7b <devcons_read+0x13>
+  if (c < 0)
+  802b89:	78 0f                	js     802b9a <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  802b8b:	83 f8 04             	cmp    $0x4,%eax
+  802b8e:	74 0c                	je     802b9c <devcons_read+0x34>
+  *(char*)vbuf = c;
+  802b90:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802b93:	88 02                	mov    %al,(%edx)
+  return 1;
+  802b95:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802b9a:	c9                   	leave
+  802b9b:	c3                   	ret
+    return 0;
+  802b9c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ba1:	eb f7                	jmp    802b9a <devcons_read+0x32>
+
+00802ba3 <cputchar>:
+{
+  802ba3:	55                   	push   %ebp
+  802ba4:	89 e5                	mov    %esp,%ebp
+  802ba6:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  802ba9:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bac:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  802baf:	6a 01                	push   $0x1
+  802bb1:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802bb4:	50                   	push   %eax
+  802bb5:	e8 d9 df ff ff       	call   800b93 <sys_cputs>
+}
+  802bba:	83 c4 10             	add    $0x10,%esp
+  802bbd:	c9                   	leave
+  802bbe:	c3                   	ret
+
+00802bbf <getchar>:
+{
+  802bbf:	55                   	push   %ebp
+  802bc0:	89 e5                	mov    %esp,%ebp
+  802bc2:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  802bc5:	6a 01                	push   $0x1
+  802bc7:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802bca:	50                   	push   %eax
+  802bcb:	6a 00                	push   $0x0
+  802bcd:	e8 94 e8 ff ff       	call   801466 <read>
+  if (r < 0)
+  802bd2:	83 c4 10             	add    $0x10,%esp
+  802bd5:	85 c0                	test   %eax,%eax
+  802bd7:	78 06                	js     802bdf <getchar+0x20>
+  if (r < 1)
+  802bd9:	74 06                	je     802be1 <getchar+0x22>
+  return c;
+  802bdb:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802bdf:	c9                   	leave
+  802be0:	c3                   	ret
+    return -E_EOF;
+  802be1:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802be6:	eb f7                	jmp    802bdf <getchar+0x20>
+
+00802be8 <iscons>:
+{
+  802be8:	55                   	push   %ebp
+  802be9:	89 e5                	mov    %esp,%ebp
+  802beb:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802bee:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802bf1:	50                   	push   %eax
+  802bf2:	ff 75 08             	push   0x8(%ebp)
+  802bf5:	e8 c1 e5 ff ff       	call   8011bb <fd_lookup>
+  802bfa:	83 c4 10             	add    $0x10,%esp
+  802bfd:	85 c0                	test   %eax,%eax
+  802bff:	78 11                	js     802c12 <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  802c01:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c04:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802c0a:	39 10                	cmp    %edx,(%eax)
+  802c0c:	0f 94 c0             	sete   %al
+  802c0f:	0f b6 c0             	movzbl %al,%eax
+}
+  802c12:	c9                   	leave
+  802c13:	c3                   	ret
+
+00802c14 <opencons>:
+{
+  802c14:	55                   	push   %ebp
+  802c15:	89 e5                	mov    %esp,%ebp
+  802c17:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  802c1a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802c1d:	50                   	push   %eax
+  802c1e:	e8 42 e5 ff ff       	call   801165 <fd_alloc>
+  802c23:	83 c4 10             	add    $0x10,%esp
+  802c26:	85 c0                	test   %eax,%eax
+  802c28:	78 3a                	js     802c64 <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802c2a:	83 ec 04             	sub    $0x4,%esp
+  802c2d:	68 07 04 00 00       	push   $0x407
+  802c32:	ff 75 f4             	push   -0xc(%ebp)
+  802c35:	6a 00                	push   $0x0
+  802c37:	e8 56 e0 ff ff       	call   800c92 <sys_page_alloc>
+  802c3c:	83 c4 10             	add    $0x10,%esp
+  802c3f:	85 c0                	test   %eax,%eax
+  802c41:	78 21                	js     802c64 <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  802c43:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c46:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802c4c:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  802c4e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c51:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  802c58:	83 ec 0c             	sub    $0xc,%esp
+  802c5b:	50                   	push   %eax
+  802c5c:	e8 e0 e4 ff ff       	call   801141 <fd2num>
+  802c61:	83 c4 10             	add    $0x10,%esp
+}
+  802c64:	c9                   	leave
+  802c65:	c3                   	ret
+
+00802c66 <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  802c66:	55                   	push   %ebp
+  802c67:	89 e5                	mov    %esp,%ebp
+  802c69:	57                   	push   %edi
+  802c6a:	56                   	push   %esi
+  802c6b:	53                   	push   %ebx
+  802c6c:	83 ec 14             	sub    $0x14,%esp
+  802c6f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802c72:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c75:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802c78:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  802c7b:	85 c0                	test   %eax,%eax
+  802c7d:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802c82:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  802c85:	ff 33                	push   (%ebx)
+  802c87:	50                   	push   %eax
+  802c88:	e8 dd e2 ff ff       	call   800f6a <sys_ipc_recv>
+  802c8d:	83 c4 10             	add    $0x10,%esp
+  802c90:	85 c0                	test   %eax,%eax
+  802c92:	78 39                	js     802ccd <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  802c94:	85 ff                	test   %edi,%edi
+  802c96:	74 0a                	je     802ca2 <ipc_recv_pages+0x3c>
+  802c98:	a1 00 80 80 00       	mov    0x808000,%eax
+  802c9d:	8b 40 7c             	mov    0x7c(%eax),%eax
+  802ca0:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  802ca2:	85 f6                	test   %esi,%esi
+  802ca4:	74 0d                	je     802cb3 <ipc_recv_pages+0x4d>
+  802ca6:	a1 00 80 80 00       	mov    0x808000,%eax
+  802cab:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  802cb1:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  802cb3:	a1 00 80 80 00       	mov    0x808000,%eax
+  802cb8:	8b 40 74             	mov    0x74(%eax),%eax
+  802cbb:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  802cbd:	a1 00 80 80 00       	mov    0x808000,%eax
+  802cc2:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  802cc5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802cc8:	5b                   	pop    %ebx
+  802cc9:	5e                   	pop    %esi
+  802cca:	5f                   	pop    %edi
+  802ccb:	5d                   	pop    %ebp
+  802ccc:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  802ccd:	85 ff                	test   %edi,%edi
+  802ccf:	74 06                	je     802cd7 <ipc_recv_pages+0x71>
+  802cd1:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  802cd7:	85 f6                	test   %esi,%esi
+  802cd9:	74 06                	je     802ce1 <ipc_recv_pages+0x7b>
+  802cdb:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  802ce1:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  802ce7:	eb dc                	jmp    802cc5 <ipc_recv_pages+0x5f>
+
+00802ce9 <ipc_recv>:
+{
+  802ce9:	55                   	push   %ebp
+  802cea:	89 e5                	mov    %esp,%ebp
+  802cec:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  802cef:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  802cf6:	ff 75 10             	push   0x10(%ebp)
+  802cf9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802cfc:	50                   	push   %eax
+  802cfd:	ff 75 0c             	push   0xc(%ebp)
+  802d00:	ff 75 08             	push   0x8(%ebp)
+  802d03:	e8 5e ff ff ff       	call   802c66 <ipc_recv_pages>
+}
+  802d08:	c9                   	leave
+  802d09:	c3                   	ret
+
+00802d0a <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  802d0a:	55                   	push   %ebp
+  802d0b:	89 e5                	mov    %esp,%ebp
+  802d0d:	57                   	push   %edi
+  802d0e:	56                   	push   %esi
+  802d0f:	53                   	push   %ebx
+  802d10:	83 ec 0c             	sub    $0xc,%esp
+  802d13:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802d16:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802d19:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  802d1c:	89 c3                	mov    %eax,%ebx
+  802d1e:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  802d24:	85 c0                	test   %eax,%eax
+  802d26:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802d2b:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  802d2e:	83 ec 0c             	sub    $0xc,%esp
+  802d31:	ff 75 14             	push   0x14(%ebp)
+  802d34:	ff 75 18             	push   0x18(%ebp)
+  802d37:	53                   	push   %ebx
+  802d38:	56                   	push   %esi
+  802d39:	57                   	push   %edi
+  802d3a:	e8 0a e2 ff ff       	call   800f49 <sys_ipc_try_send>
+  802d3f:	83 c4 20             	add    $0x20,%esp
+  802d42:	85 c0                	test   %eax,%eax
+  802d44:	79 1e                	jns    802d64 <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  802d46:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802d49:	75 07                	jne    802d52 <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  802d4b:	e8 e0 de ff ff       	call   800c30 <sys_yield>
+  802d50:	eb dc                	jmp    802d2e <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  802d52:	50                   	push   %eax
+  802d53:	68 53 35 80 00       	push   $0x803553
+  802d58:	6a 5c                	push   $0x5c
+  802d5a:	68 60 35 80 00       	push   $0x803560
+  802d5f:	e8 36 d4 ff ff       	call   80019a <_panic>
+  }
+}
+  802d64:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d67:	5b                   	pop    %ebx
+  802d68:	5e                   	pop    %esi
+  802d69:	5f                   	pop    %edi
+  802d6a:	5d                   	pop    %ebp
+  802d6b:	c3                   	ret
+
+00802d6c <ipc_send>:
+{
+  802d6c:	55                   	push   %ebp
+  802d6d:	89 e5                	mov    %esp,%ebp
+  802d6f:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  802d72:	ff 75 14             	push   0x14(%ebp)
+  802d75:	6a 01                	push   $0x1
+  802d77:	ff 75 10             	push   0x10(%ebp)
+  802d7a:	ff 75 0c             	push   0xc(%ebp)
+  802d7d:	ff 75 08             	push   0x8(%ebp)
+  802d80:	e8 85 ff ff ff       	call   802d0a <ipc_send_pages>
+}
+  802d85:	83 c4 20             	add    $0x20,%esp
+  802d88:	c9                   	leave
+  802d89:	c3                   	ret
+
+00802d8a <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802d8a:	55                   	push   %ebp
+  802d8b:	89 e5                	mov    %esp,%ebp
+  802d8d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  802d90:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  802d95:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802d98:	c1 e0 04             	shl    $0x4,%eax
+  802d9b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802da0:	8b 40 50             	mov    0x50(%eax),%eax
+  802da3:	39 c8                	cmp    %ecx,%eax
+  802da5:	74 12                	je     802db9 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  802da7:	83 c2 01             	add    $0x1,%edx
+  802daa:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802db0:	75 e3                	jne    802d95 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  802db2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802db7:	eb 0e                	jmp    802dc7 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  802db9:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802dbc:	c1 e0 04             	shl    $0x4,%eax
+  802dbf:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802dc4:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802dc7:	5d                   	pop    %ebp
+  802dc8:	c3                   	ret
+
+00802dc9 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802dc9:	55                   	push   %ebp
+  802dca:	89 e5                	mov    %esp,%ebp
+  802dcc:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802dcf:	89 c2                	mov    %eax,%edx
+  802dd1:	c1 ea 16             	shr    $0x16,%edx
+  802dd4:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  802ddb:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802de0:	f6 c1 01             	test   $0x1,%cl
+  802de3:	74 1c                	je     802e01 <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  802de5:	c1 e8 0c             	shr    $0xc,%eax
+  802de8:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  802def:	a8 01                	test   $0x1,%al
+  802df1:	74 0e                	je     802e01 <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  802df3:	c1 e8 0c             	shr    $0xc,%eax
+  802df6:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802dfd:	ef 
+  802dfe:	0f b7 d2             	movzwl %dx,%edx
+}
+  802e01:	89 d0                	mov    %edx,%eax
+  802e03:	5d                   	pop    %ebp
+  802e04:	c3                   	ret
+
+00802e05 <udivmod>:
+  802e05:	55                   	push   %ebp
+  802e06:	57                   	push   %edi
+  802e07:	56                   	push   %esi
+  802e08:	53                   	push   %ebx
+  802e09:	83 ec 14             	sub    $0x14,%esp
+  802e0c:	8b 74 24 28          	mov    0x28(%esp),%esi
+  802e10:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  802e14:	89 fb                	mov    %edi,%ebx
+  802e16:	09 f3                	or     %esi,%ebx
+  802e18:	0f 84 88 00 00 00    	je     802ea6 <udivmod+0xa1>
+  802e1e:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802e23:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802e2a:	00 
+  802e2b:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802e32:	00 
+  802e33:	89 cd                	mov    %ecx,%ebp
+  802e35:	89 34 24             	mov    %esi,(%esp)
+  802e38:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802e3c:	eb 08                	jmp    802e46 <udivmod+0x41>
+  802e3e:	83 ed 01             	sub    $0x1,%ebp
+  802e41:	83 fd ff             	cmp    $0xffffffff,%ebp
+  802e44:	74 6c                	je     802eb2 <udivmod+0xad>
+  802e46:	89 c3                	mov    %eax,%ebx
+  802e48:	89 d6                	mov    %edx,%esi
+  802e4a:	89 e9                	mov    %ebp,%ecx
+  802e4c:	0f ad f3             	shrd   %cl,%esi,%ebx
+  802e4f:	d3 ee                	shr    %cl,%esi
+  802e51:	f6 c1 20             	test   $0x20,%cl
+  802e54:	74 04                	je     802e5a <udivmod+0x55>
+  802e56:	89 f3                	mov    %esi,%ebx
+  802e58:	31 f6                	xor    %esi,%esi
+  802e5a:	8b 3c 24             	mov    (%esp),%edi
+  802e5d:	39 fb                	cmp    %edi,%ebx
+  802e5f:	89 f7                	mov    %esi,%edi
+  802e61:	8b 1c 24             	mov    (%esp),%ebx
+  802e64:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802e68:	19 f7                	sbb    %esi,%edi
+  802e6a:	72 d2                	jb     802e3e <udivmod+0x39>
+  802e6c:	89 f7                	mov    %esi,%edi
+  802e6e:	89 de                	mov    %ebx,%esi
+  802e70:	89 e9                	mov    %ebp,%ecx
+  802e72:	0f a5 f7             	shld   %cl,%esi,%edi
+  802e75:	d3 e6                	shl    %cl,%esi
+  802e77:	f6 c1 20             	test   $0x20,%cl
+  802e7a:	74 04                	je     802e80 <udivmod+0x7b>
+  802e7c:	89 f7                	mov    %esi,%edi
+  802e7e:	31 f6                	xor    %esi,%esi
+  802e80:	29 f0                	sub    %esi,%eax
+  802e82:	19 fa                	sbb    %edi,%edx
+  802e84:	be 01 00 00 00       	mov    $0x1,%esi
+  802e89:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e8e:	0f a5 f7             	shld   %cl,%esi,%edi
+  802e91:	d3 e6                	shl    %cl,%esi
+  802e93:	f6 c1 20             	test   $0x20,%cl
+  802e96:	74 04                	je     802e9c <udivmod+0x97>
+  802e98:	89 f7                	mov    %esi,%edi
+  802e9a:	31 f6                	xor    %esi,%esi
+  802e9c:	09 74 24 08          	or     %esi,0x8(%esp)
+  802ea0:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802ea4:	eb 98                	jmp    802e3e <udivmod+0x39>
+  802ea6:	89 f0                	mov    %esi,%eax
+  802ea8:	89 fa                	mov    %edi,%edx
+  802eaa:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802eae:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802eb2:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802eb6:	89 01                	mov    %eax,(%ecx)
+  802eb8:	89 51 04             	mov    %edx,0x4(%ecx)
+  802ebb:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802ebf:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802ec3:	83 c4 14             	add    $0x14,%esp
+  802ec6:	5b                   	pop    %ebx
+  802ec7:	5e                   	pop    %esi
+  802ec8:	5f                   	pop    %edi
+  802ec9:	5d                   	pop    %ebp
+  802eca:	c3                   	ret
+
+00802ecb <__udivdi3>:
+  802ecb:	83 ec 18             	sub    $0x18,%esp
+  802ece:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802ed2:	50                   	push   %eax
+  802ed3:	ff 74 24 2c          	push   0x2c(%esp)
+  802ed7:	ff 74 24 2c          	push   0x2c(%esp)
+  802edb:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802edf:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802ee3:	e8 1d ff ff ff       	call   802e05 <udivmod>
+  802ee8:	83 c4 24             	add    $0x24,%esp
+  802eeb:	c3                   	ret
+
+00802eec <__umoddi3>:
+  802eec:	83 ec 18             	sub    $0x18,%esp
+  802eef:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802ef3:	50                   	push   %eax
+  802ef4:	ff 74 24 2c          	push   0x2c(%esp)
+  802ef8:	ff 74 24 2c          	push   0x2c(%esp)
+  802efc:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802f00:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802f04:	e8 fc fe ff ff       	call   802e05 <udivmod>
+  802f09:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802f0d:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802f11:	83 c4 24             	add    $0x24,%esp
+  802f14:	c3                   	ret
+
+00802f15 <__divdi3>:
+  802f15:	56                   	push   %esi
+  802f16:	53                   	push   %ebx
+  802f17:	83 ec 14             	sub    $0x14,%esp
+  802f1a:	8b 44 24 20          	mov    0x20(%esp),%eax
+  802f1e:	8b 54 24 24          	mov    0x24(%esp),%edx
+  802f22:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  802f26:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  802f2a:	85 d2                	test   %edx,%edx
+  802f2c:	78 18                	js     802f46 <__divdi3+0x31>
+  802f2e:	85 db                	test   %ebx,%ebx
+  802f30:	78 3e                	js     802f70 <__divdi3+0x5b>
+  802f32:	83 ec 04             	sub    $0x4,%esp
+  802f35:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802f39:	56                   	push   %esi
+  802f3a:	53                   	push   %ebx
+  802f3b:	51                   	push   %ecx
+  802f3c:	e8 c4 fe ff ff       	call   802e05 <udivmod>
+  802f41:	83 c4 10             	add    $0x10,%esp
+  802f44:	eb 24                	jmp    802f6a <__divdi3+0x55>
+  802f46:	f7 d8                	neg    %eax
+  802f48:	83 d2 00             	adc    $0x0,%edx
+  802f4b:	f7 da                	neg    %edx
+  802f4d:	85 db                	test   %ebx,%ebx
+  802f4f:	78 3a                	js     802f8b <__divdi3+0x76>
+  802f51:	83 ec 04             	sub    $0x4,%esp
+  802f54:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802f58:	56                   	push   %esi
+  802f59:	53                   	push   %ebx
+  802f5a:	51                   	push   %ecx
+  802f5b:	e8 a5 fe ff ff       	call   802e05 <udivmod>
+  802f60:	83 c4 10             	add    $0x10,%esp
+  802f63:	f7 d8                	neg    %eax
+  802f65:	83 d2 00             	adc    $0x0,%edx
+  802f68:	f7 da                	neg    %edx
+  802f6a:	83 c4 14             	add    $0x14,%esp
+  802f6d:	5b                   	pop    %ebx
+  802f6e:	5e                   	pop    %esi
+  802f6f:	c3                   	ret
+  802f70:	83 ec 04             	sub    $0x4,%esp
+  802f73:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802f77:	56                   	push   %esi
+  802f78:	f7 d9                	neg    %ecx
+  802f7a:	83 d3 00             	adc    $0x0,%ebx
+  802f7d:	f7 db                	neg    %ebx
+  802f7f:	53                   	push   %ebx
+  802f80:	51                   	push   %ecx
+  802f81:	e8 7f fe ff ff       	call   802e05 <udivmod>
+  802f86:	83 c4 10             	add    $0x10,%esp
+  802f89:	eb d8                	jmp    802f63 <__divdi3+0x4e>
+  802f8b:	83 ec 04             	sub    $0x4,%esp
+  802f8e:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802f92:	56                   	push   %esi
+  802f93:	f7 d9                	neg    %ecx
+  802f95:	83 d3 00             	adc    $0x0,%ebx
+  802f98:	f7 db                	neg    %ebx
+  802f9a:	53                   	push   %ebx
+  802f9b:	51                   	push   %ecx
+  802f9c:	e8 64 fe ff ff       	call   802e05 <udivmod>
+  802fa1:	83 c4 10             	add    $0x10,%esp
+  802fa4:	eb c4                	jmp    802f6a <__divdi3+0x55>
+
+00802fa6 <__moddi3>:
+  802fa6:	55                   	push   %ebp
+  802fa7:	57                   	push   %edi
+  802fa8:	56                   	push   %esi
+  802fa9:	53                   	push   %ebx
+  802faa:	83 ec 24             	sub    $0x24,%esp
+  802fad:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802fb1:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802fb5:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  802fb9:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  802fbd:	85 d2                	test   %edx,%edx
+  802fbf:	78 3b                	js     802ffc <__moddi3+0x56>
+  802fc1:	83 ec 04             	sub    $0x4,%esp
+  802fc4:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  802fc8:	56                   	push   %esi
+  802fc9:	89 ce                	mov    %ecx,%esi
+  802fcb:	f7 de                	neg    %esi
+  802fcd:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802fd1:	89 de                	mov    %ebx,%esi
+  802fd3:	83 d6 00             	adc    $0x0,%esi
+  802fd6:	f7 de                	neg    %esi
+  802fd8:	89 74 24 14          	mov    %esi,0x14(%esp)
+  802fdc:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802fe0:	0f 48 f1             	cmovs  %ecx,%esi
+  802fe3:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  802fe8:	53                   	push   %ebx
+  802fe9:	56                   	push   %esi
+  802fea:	e8 16 fe ff ff       	call   802e05 <udivmod>
+  802fef:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802ff3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802ff7:	83 c4 10             	add    $0x10,%esp
+  802ffa:	eb 47                	jmp    803043 <__moddi3+0x9d>
+  802ffc:	f7 d8                	neg    %eax
+  802ffe:	83 d2 00             	adc    $0x0,%edx
+  803001:	f7 da                	neg    %edx
+  803003:	83 ec 04             	sub    $0x4,%esp
+  803006:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  80300a:	56                   	push   %esi
+  80300b:	89 cf                	mov    %ecx,%edi
+  80300d:	f7 df                	neg    %edi
+  80300f:	89 de                	mov    %ebx,%esi
+  803011:	83 d6 00             	adc    $0x0,%esi
+  803014:	f7 de                	neg    %esi
+  803016:	0f 49 cf             	cmovns %edi,%ecx
+  803019:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  80301d:	0f 49 de             	cmovns %esi,%ebx
+  803020:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  803024:	ff 74 24 0c          	push   0xc(%esp)
+  803028:	ff 74 24 0c          	push   0xc(%esp)
+  80302c:	e8 d4 fd ff ff       	call   802e05 <udivmod>
+  803031:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803035:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803039:	f7 d8                	neg    %eax
+  80303b:	83 d2 00             	adc    $0x0,%edx
+  80303e:	f7 da                	neg    %edx
+  803040:	83 c4 10             	add    $0x10,%esp
+  803043:	83 c4 24             	add    $0x24,%esp
+  803046:	5b                   	pop    %ebx
+  803047:	5e                   	pop    %esi
+  803048:	5f                   	pop    %edi
+  803049:	5d                   	pop    %ebp
+  80304a:	c3                   	ret
@@ -0,0 +1,6670 @@
+
+obj/user/catbench.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 0f 03 00 00       	call   800340 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <readfile>:
+// Read 'path' from 'start' to the end NPASS times into 'dst', checking
+// that whole pages at aligned offsets hold their page number.  Returns
+// the elapsed ms.
+static unsigned
+readfile(const char *path, off_t start, char *dst)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 2c             	sub    $0x2c,%esp
+  80003c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80003f:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  800042:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  unsigned ms;
+  off_t off;
+  int fd, n, pass, i;
+
+  ms = sys_time_msec();
+  800045:	e8 75 11 00 00       	call   8011bf <sys_time_msec>
+  80004a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  for (pass = 0; pass < NPASS; pass++) {
+  80004d:	c7 45 d4 05 00 00 00 	movl   $0x5,-0x2c(%ebp)
+  800054:	e9 a9 00 00 00       	jmp    800102 <readfile+0xcf>
+    if ((fd = open(path, O_RDONLY)) < 0)
+      panic("open %s: %e", path, fd);
+  800059:	83 ec 0c             	sub    $0xc,%esp
+  80005c:	50                   	push   %eax
+  80005d:	ff 75 d8             	push   -0x28(%ebp)
+  800060:	68 60 31 80 00       	push   $0x803160
+  800065:	6a 1d                	push   $0x1d
+  800067:	68 6c 31 80 00       	push   $0x80316c
+  80006c:	e8 3c 03 00 00       	call   8003ad <_panic>
+    if ((n = seek(fd, start)) < 0)
+      panic("seek %s: %e", path, n);
+  800071:	83 ec 0c             	sub    $0xc,%esp
+  800074:	50                   	push   %eax
+  800075:	ff 75 d8             	push   -0x28(%ebp)
+  800078:	68 7c 31 80 00       	push   $0x80317c
+  80007d:	6a 1f                	push   $0x1f
+  80007f:	68 6c 31 80 00       	push   $0x80316c
+  800084:	e8 24 03 00 00       	call   8003ad <_panic>
+    for (off = start; (n = read(fd, dst, 2 * PGSIZE)) > 0; off += n)
+      for (i = 0; start == 0 && i < n; i += PGSIZE)
+  800089:	81 c2 00 10 00 00    	add    $0x1000,%edx
+  80008f:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  800093:	75 38                	jne    8000cd <readfile+0x9a>
+  800095:	39 fa                	cmp    %edi,%edx
+  800097:	7d 34                	jge    8000cd <readfile+0x9a>
+        if (*(int*) (dst + i) != (off + i) / PGSIZE)
+  800099:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80009c:	8b 34 10             	mov    (%eax,%edx,1),%esi
+  80009f:	8d 0c 13             	lea    (%ebx,%edx,1),%ecx
+  8000a2:	8d 81 ff 0f 00 00    	lea    0xfff(%ecx),%eax
+  8000a8:	85 c9                	test   %ecx,%ecx
+  8000aa:	0f 49 c1             	cmovns %ecx,%eax
+  8000ad:	c1 f8 0c             	sar    $0xc,%eax
+  8000b0:	39 c6                	cmp    %eax,%esi
+  8000b2:	74 d5                	je     800089 <readfile+0x56>
+          panic("%s: page %d holds %d", path, (off + i) / PGSIZE,
+  8000b4:	83 ec 08             	sub    $0x8,%esp
+  8000b7:	56                   	push   %esi
+  8000b8:	50                   	push   %eax
+  8000b9:	ff 75 d8             	push   -0x28(%ebp)
+  8000bc:	68 88 31 80 00       	push   $0x803188
+  8000c1:	6a 23                	push   $0x23
+  8000c3:	68 6c 31 80 00       	push   $0x80316c
+  8000c8:	e8 e0 02 00 00       	call   8003ad <_panic>
+    for (off = start; (n = read(fd, dst, 2 * PGSIZE)) > 0; off += n)
+  8000cd:	01 fb                	add    %edi,%ebx
+  8000cf:	83 ec 04             	sub    $0x4,%esp
+  8000d2:	68 00 20 00 00       	push   $0x2000
+  8000d7:	ff 75 e0             	push   -0x20(%ebp)
+  8000da:	ff 75 dc             	push   -0x24(%ebp)
+  8000dd:	e8 97 15 00 00       	call   801679 <read>
+  8000e2:	89 c7                	mov    %eax,%edi
+  8000e4:	83 c4 10             	add    $0x10,%esp
+  8000e7:	85 c0                	test   %eax,%eax
+  8000e9:	7e 07                	jle    8000f2 <readfile+0xbf>
+      for (i = 0; start == 0 && i < n; i += PGSIZE)
+  8000eb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000f0:	eb 9d                	jmp    80008f <readfile+0x5c>
+                *(int*) (dst + i));
+    if (n < 0)
+  8000f2:	78 4d                	js     800141 <readfile+0x10e>
+      panic("read %s: %e", path, n);
+    close(fd);
+  8000f4:	83 ec 0c             	sub    $0xc,%esp
+  8000f7:	ff 75 dc             	push   -0x24(%ebp)
+  8000fa:	e8 f2 13 00 00       	call   8014f1 <close>
+  8000ff:	83 c4 10             	add    $0x10,%esp
+  for (pass = 0; pass < NPASS; pass++) {
+  800102:	83 6d d4 01          	subl   $0x1,-0x2c(%ebp)
+  800106:	74 51                	je     800159 <readfile+0x126>
+    if ((fd = open(path, O_RDONLY)) < 0)
+  800108:	83 ec 08             	sub    $0x8,%esp
+  80010b:	6a 00                	push   $0x0
+  80010d:	ff 75 d8             	push   -0x28(%ebp)
+  800110:	e8 8f 1d 00 00       	call   801ea4 <open>
+  800115:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  800118:	83 c4 10             	add    $0x10,%esp
+  80011b:	85 c0                	test   %eax,%eax
+  80011d:	0f 88 36 ff ff ff    	js     800059 <readfile+0x26>
+    if ((n = seek(fd, start)) < 0)
+  800123:	83 ec 08             	sub    $0x8,%esp
+  800126:	ff 75 e4             	push   -0x1c(%ebp)
+  800129:	ff 75 dc             	push   -0x24(%ebp)
+  80012c:	e8 98 16 00 00       	call   8017c9 <seek>
+  800131:	83 c4 10             	add    $0x10,%esp
+  800134:	85 c0                	test   %eax,%eax
+  800136:	0f 88 35 ff ff ff    	js     800071 <readfile+0x3e>
+    for (off = start; (n = read(fd, dst, 2 * PGSIZE)) > 0; off += n)
+  80013c:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80013f:	eb 8e                	jmp    8000cf <readfile+0x9c>
+      panic("read %s: %e", path, n);
+  800141:	83 ec 0c             	sub    $0xc,%esp
+  800144:	50                   	push   %eax
+  800145:	ff 75 d8             	push   -0x28(%ebp)
+  800148:	68 9d 31 80 00       	push   $0x80319d
+  80014d:	6a 26                	push   $0x26
+  80014f:	68 6c 31 80 00       	push   $0x80316c
+  800154:	e8 54 02 00 00       	call   8003ad <_panic>
+  }
+  return sys_time_msec() - ms;
+  800159:	e8 61 10 00 00       	call   8011bf <sys_time_msec>
+  80015e:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  800161:	29 d8                	sub    %ebx,%eax
+}
+  800163:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800166:	5b                   	pop    %ebx
+  800167:	5e                   	pop    %esi
+  800168:	5f                   	pop    %edi
+  800169:	5d                   	pop    %ebp
+  80016a:	c3                   	ret
+
+0080016b <report>:
+
+static void
+report(const char *how, off_t size, unsigned ms)
+{
+  80016b:	55                   	push   %ebp
+  80016c:	89 e5                	mov    %esp,%ebp
+  80016e:	56                   	push   %esi
+  80016f:	53                   	push   %ebx
+  800170:	89 c3                	mov    %eax,%ebx
+  cprintf("catbench: %-22s %5d ms = %6d KB/s\n", how, ms,
+          size / 1024 * NPASS * 1000 / MAX(ms, 1));
+  800172:	8d 82 ff 03 00 00    	lea    0x3ff(%edx),%eax
+  800178:	85 d2                	test   %edx,%edx
+  80017a:	0f 49 c2             	cmovns %edx,%eax
+  80017d:	c1 f8 0a             	sar    $0xa,%eax
+  800180:	69 c0 a0 0f 00 00    	imul   $0xfa0,%eax,%eax
+  800186:	85 c9                	test   %ecx,%ecx
+  800188:	be 01 00 00 00       	mov    $0x1,%esi
+  80018d:	0f 45 f1             	cmovne %ecx,%esi
+  cprintf("catbench: %-22s %5d ms = %6d KB/s\n", how, ms,
+  800190:	ba 00 00 00 00       	mov    $0x0,%edx
+  800195:	f7 f6                	div    %esi
+  800197:	50                   	push   %eax
+  800198:	51                   	push   %ecx
+  800199:	53                   	push   %ebx
+  80019a:	68 fc 31 80 00       	push   $0x8031fc
+  80019f:	e8 e4 02 00 00       	call   800488 <cprintf>
+}
+  8001a4:	83 c4 10             	add    $0x10,%esp
+  8001a7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8001aa:	5b                   	pop    %ebx
+  8001ab:	5e                   	pop    %esi
+  8001ac:	5d                   	pop    %ebp
+  8001ad:	c3                   	ret
+
+008001ae <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8001ae:	55                   	push   %ebp
+  8001af:	89 e5                	mov    %esp,%ebp
+  8001b1:	57                   	push   %edi
+  8001b2:	56                   	push   %esi
+  8001b3:	53                   	push   %ebx
+  8001b4:	83 ec 0c             	sub    $0xc,%esp
+  off_t size, off;
+  int fd, r;
+
+  binaryname = "catbench";
+  8001b7:	c7 05 00 40 80 00 a9 	movl   $0x8031a9,0x804000
+  8001be:	31 80 00 
+  size = 1024 * 1024;
+  8001c1:	b8 00 00 10 00       	mov    $0x100000,%eax
+  if (argc > 1)
+  8001c6:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+  8001ca:	7f 6c                	jg     800238 <umain+0x8a>
+    size = strtol(argv[1], 0, 0) * 1024;
+  size = ROUNDUP(size, PGSIZE);
+  8001cc:	8d b0 ff 0f 00 00    	lea    0xfff(%eax),%esi
+  8001d2:	81 e6 00 f0 ff ff    	and    $0xfffff000,%esi
+
+  if ((fd = open(BIGNAME, O_RDWR | O_CREAT | O_TRUNC)) < 0)
+  8001d8:	83 ec 08             	sub    $0x8,%esp
+  8001db:	68 02 03 00 00       	push   $0x302
+  8001e0:	68 b2 31 80 00       	push   $0x8031b2
+  8001e5:	e8 ba 1c 00 00       	call   801ea4 <open>
+  8001ea:	89 c7                	mov    %eax,%edi
+  8001ec:	83 c4 10             	add    $0x10,%esp
+  8001ef:	85 c0                	test   %eax,%eax
+  8001f1:	78 62                	js     800255 <umain+0xa7>
+    panic("open %s: %e", BIGNAME, fd);
+  for (off = 0; off < size; off += PGSIZE) {
+  8001f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001f8:	39 f3                	cmp    %esi,%ebx
+  8001fa:	0f 8d 89 00 00 00    	jge    800289 <umain+0xdb>
+    *(int*) buf = off / PGSIZE;
+  800200:	8d 83 ff 0f 00 00    	lea    0xfff(%ebx),%eax
+  800206:	85 db                	test   %ebx,%ebx
+  800208:	0f 49 c3             	cmovns %ebx,%eax
+  80020b:	c1 f8 0c             	sar    $0xc,%eax
+  80020e:	a3 00 50 80 00       	mov    %eax,0x805000
+    if ((r = write(fd, buf, PGSIZE)) != PGSIZE)
+  800213:	83 ec 04             	sub    $0x4,%esp
+  800216:	68 00 10 00 00       	push   $0x1000
+  80021b:	68 00 50 80 00       	push   $0x805000
+  800220:	57                   	push   %edi
+  800221:	e8 21 15 00 00       	call   801747 <write>
+  800226:	83 c4 10             	add    $0x10,%esp
+  800229:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80022e:	75 3f                	jne    80026f <umain+0xc1>
+  for (off = 0; off < size; off += PGSIZE) {
+  800230:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  800236:	eb c0                	jmp    8001f8 <umain+0x4a>
+    size = strtol(argv[1], 0, 0) * 1024;
+  800238:	83 ec 04             	sub    $0x4,%esp
+  80023b:	6a 00                	push   $0x0
+  80023d:	6a 00                	push   $0x0
+  80023f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800242:	ff 70 04             	push   0x4(%eax)
+  800245:	e8 80 0a 00 00       	call   800cca <strtol>
+  80024a:	c1 e0 0a             	shl    $0xa,%eax
+  80024d:	83 c4 10             	add    $0x10,%esp
+  800250:	e9 77 ff ff ff       	jmp    8001cc <umain+0x1e>
+    panic("open %s: %e", BIGNAME, fd);
+  800255:	83 ec 0c             	sub    $0xc,%esp
+  800258:	50                   	push   %eax
+  800259:	68 b2 31 80 00       	push   $0x8031b2
+  80025e:	68 60 31 80 00       	push   $0x803160
+  800263:	6a 40                	push   $0x40
+  800265:	68 6c 31 80 00       	push   $0x80316c
+  80026a:	e8 3e 01 00 00       	call   8003ad <_panic>
+      panic("write %s: %e", BIGNAME, r);
+  80026f:	83 ec 0c             	sub    $0xc,%esp
+  800272:	50                   	push   %eax
+  800273:	68 b2 31 80 00       	push   $0x8031b2
+  800278:	68 c0 31 80 00       	push   $0x8031c0
+  80027d:	6a 44                	push   $0x44
+  80027f:	68 6c 31 80 00       	push   $0x80316c
+  800284:	e8 24 01 00 00       	call   8003ad <_panic>
+  }
+  close(fd);
+  800289:	83 ec 0c             	sub    $0xc,%esp
+  80028c:	57                   	push   %edi
+  80028d:	e8 5f 12 00 00       	call   8014f1 <close>
+  sync();
+  800292:	e8 f5 1e 00 00       	call   80218c <sync>
+
+  // Warm the cache, so that the disk isn't what's measured.
+  readfile(BIGNAME, 0, buf);
+  800297:	b9 00 50 80 00       	mov    $0x805000,%ecx
+  80029c:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002a1:	b8 b2 31 80 00       	mov    $0x8031b2,%eax
+  8002a6:	e8 88 fd ff ff       	call   800033 <readfile>
+
+  report("unaligned offset (copy)", size, readfile(BIGNAME, 1, buf));
+  8002ab:	b9 00 50 80 00       	mov    $0x805000,%ecx
+  8002b0:	ba 01 00 00 00       	mov    $0x1,%edx
+  8002b5:	b8 b2 31 80 00       	mov    $0x8031b2,%eax
+  8002ba:	e8 74 fd ff ff       	call   800033 <readfile>
+  8002bf:	89 c1                	mov    %eax,%ecx
+  8002c1:	89 f2                	mov    %esi,%edx
+  8002c3:	b8 cd 31 80 00       	mov    $0x8031cd,%eax
+  8002c8:	e8 9e fe ff ff       	call   80016b <report>
+  report("unaligned buffer (map)", size, readfile(BIGNAME, 0, buf + 1));
+  8002cd:	b9 01 50 80 00       	mov    $0x805001,%ecx
+  8002d2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002d7:	b8 b2 31 80 00       	mov    $0x8031b2,%eax
+  8002dc:	e8 52 fd ff ff       	call   800033 <readfile>
+  8002e1:	89 c1                	mov    %eax,%ecx
+  8002e3:	89 f2                	mov    %esi,%edx
+  8002e5:	b8 e5 31 80 00       	mov    $0x8031e5,%eax
+  8002ea:	e8 7c fe ff ff       	call   80016b <report>
+  report("aligned buffer (map)", size, readfile(BIGNAME, 0, buf));
+  8002ef:	b9 00 50 80 00       	mov    $0x805000,%ecx
+  8002f4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002f9:	b8 b2 31 80 00       	mov    $0x8031b2,%eax
+  8002fe:	e8 30 fd ff ff       	call   800033 <readfile>
+  800303:	89 c1                	mov    %eax,%ecx
+  800305:	89 f2                	mov    %esi,%edx
+  800307:	b8 e7 31 80 00       	mov    $0x8031e7,%eax
+  80030c:	e8 5a fe ff ff       	call   80016b <report>
+
+  // Give the space back (there is no remove).
+  if ((fd = open(BIGNAME, O_RDWR | O_TRUNC)) >= 0)
+  800311:	83 c4 08             	add    $0x8,%esp
+  800314:	68 02 02 00 00       	push   $0x202
+  800319:	68 b2 31 80 00       	push   $0x8031b2
+  80031e:	e8 81 1b 00 00       	call   801ea4 <open>
+  800323:	83 c4 10             	add    $0x10,%esp
+  800326:	85 c0                	test   %eax,%eax
+  800328:	79 08                	jns    800332 <umain+0x184>
+    close(fd);
+}
+  80032a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80032d:	5b                   	pop    %ebx
+  80032e:	5e                   	pop    %esi
+  80032f:	5f                   	pop    %edi
+  800330:	5d                   	pop    %ebp
+  800331:	c3                   	ret
+    close(fd);
+  800332:	83 ec 0c             	sub    $0xc,%esp
+  800335:	50                   	push   %eax
+  800336:	e8 b6 11 00 00       	call   8014f1 <close>
+  80033b:	83 c4 10             	add    $0x10,%esp
+}
+  80033e:	eb ea                	jmp    80032a <umain+0x17c>
+
+00800340 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800340:	55                   	push   %ebp
+  800341:	89 e5                	mov    %esp,%ebp
+  800343:	56                   	push   %esi
+  800344:	53                   	push   %ebx
+  800345:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800348:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  80034b:	c7 05 44 87 80 00 00 	movl   $0x0,0x808744
+  800352:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  800355:	e8 ca 0a 00 00       	call   800e24 <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  80035a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80035f:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800362:	c1 e0 04             	shl    $0x4,%eax
+  800365:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80036a:	a3 44 87 80 00       	mov    %eax,0x808744
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  80036f:	85 db                	test   %ebx,%ebx
+  800371:	7e 07                	jle    80037a <libmain+0x3a>
+    binaryname = argv[0];
+  800373:	8b 06                	mov    (%esi),%eax
+  800375:	a3 00 40 80 00       	mov    %eax,0x804000
+
+  // call user main routine
+  umain(argc, argv);
+  80037a:	83 ec 08             	sub    $0x8,%esp
+  80037d:	56                   	push   %esi
+  80037e:	53                   	push   %ebx
+  80037f:	e8 2a fe ff ff       	call   8001ae <umain>
+
+  // exit gracefully
+  exit();
+  800384:	e8 0a 00 00 00       	call   800393 <exit>
+}
+  800389:	83 c4 10             	add    $0x10,%esp
+  80038c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80038f:	5b                   	pop    %ebx
+  800390:	5e                   	pop    %esi
+  800391:	5d                   	pop    %ebp
+  800392:	c3                   	ret
+
+00800393 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800393:	55                   	push   %ebp
+  800394:	89 e5                	mov    %esp,%ebp
+  800396:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  800399:	e8 80 11 00 00       	call   80151e <close_all>
+  sys_env_destroy(0);
+  80039e:	83 ec 0c             	sub    $0xc,%esp
+  8003a1:	6a 00                	push   $0x0
+  8003a3:	e8 3b 0a 00 00       	call   800de3 <sys_env_destroy>
+}
+  8003a8:	83 c4 10             	add    $0x10,%esp
+  8003ab:	c9                   	leave
+  8003ac:	c3                   	ret
+
+008003ad <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8003ad:	55                   	push   %ebp
+  8003ae:	89 e5                	mov    %esp,%ebp
+  8003b0:	56                   	push   %esi
+  8003b1:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  8003b2:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  8003b5:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  8003bb:	e8 64 0a 00 00       	call   800e24 <sys_getenvid>
+  8003c0:	83 ec 0c             	sub    $0xc,%esp
+  8003c3:	ff 75 0c             	push   0xc(%ebp)
+  8003c6:	ff 75 08             	push   0x8(%ebp)
+  8003c9:	56                   	push   %esi
+  8003ca:	50                   	push   %eax
+  8003cb:	68 2c 32 80 00       	push   $0x80322c
+  8003d0:	e8 b3 00 00 00       	call   800488 <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  8003d5:	83 c4 18             	add    $0x18,%esp
+  8003d8:	53                   	push   %ebx
+  8003d9:	ff 75 10             	push   0x10(%ebp)
+  8003dc:	e8 56 00 00 00       	call   800437 <vcprintf>
+  cprintf("\n");
+  8003e1:	c7 04 24 a0 36 80 00 	movl   $0x8036a0,(%esp)
+  8003e8:	e8 9b 00 00 00       	call   800488 <cprintf>
+  8003ed:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  8003f0:	cc                   	int3
+  while (1)
+  8003f1:	eb fd                	jmp    8003f0 <_panic+0x43>
+
+008003f3 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8003f3:	55                   	push   %ebp
+  8003f4:	89 e5                	mov    %esp,%ebp
+  8003f6:	53                   	push   %ebx
+  8003f7:	83 ec 04             	sub    $0x4,%esp
+  8003fa:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  8003fd:	8b 13                	mov    (%ebx),%edx
+  8003ff:	8d 42 01             	lea    0x1(%edx),%eax
+  800402:	89 03                	mov    %eax,(%ebx)
+  800404:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800407:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  80040b:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800410:	74 09                	je     80041b <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  800412:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800416:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800419:	c9                   	leave
+  80041a:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  80041b:	83 ec 08             	sub    $0x8,%esp
+  80041e:	68 ff 00 00 00       	push   $0xff
+  800423:	8d 43 08             	lea    0x8(%ebx),%eax
+  800426:	50                   	push   %eax
+  800427:	e8 7a 09 00 00       	call   800da6 <sys_cputs>
+    b->idx = 0;
+  80042c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800432:	83 c4 10             	add    $0x10,%esp
+  800435:	eb db                	jmp    800412 <putch+0x1f>
+
+00800437 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800437:	55                   	push   %ebp
+  800438:	89 e5                	mov    %esp,%ebp
+  80043a:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  800440:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800447:	00 00 00 
+  b.cnt = 0;
+  80044a:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800451:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  800454:	ff 75 0c             	push   0xc(%ebp)
+  800457:	ff 75 08             	push   0x8(%ebp)
+  80045a:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800460:	50                   	push   %eax
+  800461:	68 f3 03 80 00       	push   $0x8003f3
+  800466:	e8 14 01 00 00       	call   80057f <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  80046b:	83 c4 08             	add    $0x8,%esp
+  80046e:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800474:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80047a:	50                   	push   %eax
+  80047b:	e8 26 09 00 00       	call   800da6 <sys_cputs>
+
+  return b.cnt;
+}
+  800480:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800486:	c9                   	leave
+  800487:	c3                   	ret
+
+00800488 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800488:	55                   	push   %ebp
+  800489:	89 e5                	mov    %esp,%ebp
+  80048b:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  80048e:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  800491:	50                   	push   %eax
+  800492:	ff 75 08             	push   0x8(%ebp)
+  800495:	e8 9d ff ff ff       	call   800437 <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  80049a:	c9                   	leave
+  80049b:	c3                   	ret
+
+0080049c <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  80049c:	55                   	push   %ebp
+  80049d:	89 e5                	mov    %esp,%ebp
+  80049f:	57                   	push   %edi
+  8004a0:	56                   	push   %esi
+  8004a1:	53                   	push   %ebx
+  8004a2:	83 ec 1c             	sub    $0x1c,%esp
+  8004a5:	89 c7                	mov    %eax,%edi
+  8004a7:	89 d6                	mov    %edx,%esi
+  8004a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8004ac:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8004af:	89 d1                	mov    %edx,%ecx
+  8004b1:	89 c2                	mov    %eax,%edx
+  8004b3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004b6:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8004b9:	8b 45 10             	mov    0x10(%ebp),%eax
+  8004bc:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  8004bf:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004c2:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8004c9:	39 c2                	cmp    %eax,%edx
+  8004cb:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8004ce:	72 3e                	jb     80050e <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  8004d0:	83 ec 0c             	sub    $0xc,%esp
+  8004d3:	ff 75 18             	push   0x18(%ebp)
+  8004d6:	83 eb 01             	sub    $0x1,%ebx
+  8004d9:	53                   	push   %ebx
+  8004da:	50                   	push   %eax
+  8004db:	83 ec 08             	sub    $0x8,%esp
+  8004de:	ff 75 e4             	push   -0x1c(%ebp)
+  8004e1:	ff 75 e0             	push   -0x20(%ebp)
+  8004e4:	ff 75 dc             	push   -0x24(%ebp)
+  8004e7:	ff 75 d8             	push   -0x28(%ebp)
+  8004ea:	e8 db 2a 00 00       	call   802fca <__udivdi3>
+  8004ef:	83 c4 18             	add    $0x18,%esp
+  8004f2:	52                   	push   %edx
+  8004f3:	50                   	push   %eax
+  8004f4:	89 f2                	mov    %esi,%edx
+  8004f6:	89 f8                	mov    %edi,%eax
+  8004f8:	e8 9f ff ff ff       	call   80049c <printnum>
+  8004fd:	83 c4 20             	add    $0x20,%esp
+  800500:	eb 13                	jmp    800515 <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  800502:	83 ec 08             	sub    $0x8,%esp
+  800505:	56                   	push   %esi
+  800506:	ff 75 18             	push   0x18(%ebp)
+  800509:	ff d7                	call   *%edi
+  80050b:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  80050e:	83 eb 01             	sub    $0x1,%ebx
+  800511:	85 db                	test   %ebx,%ebx
+  800513:	7f ed                	jg     800502 <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  800515:	83 ec 08             	sub    $0x8,%esp
+  800518:	56                   	push   %esi
+  800519:	83 ec 04             	sub    $0x4,%esp
+  80051c:	ff 75 e4             	push   -0x1c(%ebp)
+  80051f:	ff 75 e0             	push   -0x20(%ebp)
+  800522:	ff 75 dc             	push   -0x24(%ebp)
+  800525:	ff 75 d8             	push   -0x28(%ebp)
+  800528:	e8 be 2a 00 00       	call   802feb <__umoddi3>
+  80052d:	83 c4 14             	add    $0x14,%esp
+  800530:	0f be 80 4f 32 80 00 	movsbl 0x80324f(%eax),%eax
+  800537:	50                   	push   %eax
+  800538:	ff d7                	call   *%edi
+}
+  80053a:	83 c4 10             	add    $0x10,%esp
+  80053d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800540:	5b                   	pop    %ebx
+  800541:	5e                   	pop    %esi
+  800542:	5f                   	pop    %edi
+  800543:	5d                   	pop    %ebp
+  800544:	c3                   	ret
+
+00800545 <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800545:	55                   	push   %ebp
+  800546:	89 e5                	mov    %esp,%ebp
+  800548:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  80054b:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  80054f:	8b 10                	mov    (%eax),%edx
+  800551:	3b 50 04             	cmp    0x4(%eax),%edx
+  800554:	73 0a                	jae    800560 <sprintputch+0x1b>
+    *b->buf++ = ch;
+  800556:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800559:	89 08                	mov    %ecx,(%eax)
+  80055b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80055e:	88 02                	mov    %al,(%edx)
+}
+  800560:	5d                   	pop    %ebp
+  800561:	c3                   	ret
+
+00800562 <printfmt>:
+{
+  800562:	55                   	push   %ebp
+  800563:	89 e5                	mov    %esp,%ebp
+  800565:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  800568:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  80056b:	50                   	push   %eax
+  80056c:	ff 75 10             	push   0x10(%ebp)
+  80056f:	ff 75 0c             	push   0xc(%ebp)
+  800572:	ff 75 08             	push   0x8(%ebp)
+  800575:	e8 05 00 00 00       	call   80057f <vprintfmt>
+}
+  80057a:	83 c4 10             	add    $0x10,%esp
+  80057d:	c9                   	leave
+  80057e:	c3                   	ret
+
+0080057f <vprintfmt>:
+{
+  80057f:	55                   	push   %ebp
+  800580:	89 e5                	mov    %esp,%ebp
+  800582:	57                   	push   %edi
+  800583:	56                   	push   %esi
+  800584:	53                   	push   %ebx
+  800585:	83 ec 2c             	sub    $0x2c,%esp
+  800588:	8b 75 08             	mov    0x8(%ebp),%esi
+  80058b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80058e:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800591:	eb 0a                	jmp    80059d <vprintfmt+0x1e>
+      putch(ch, putdat);
+  800593:	83 ec 08             	sub    $0x8,%esp
+  800596:	53                   	push   %ebx
+  800597:	50                   	push   %eax
+  800598:	ff d6                	call   *%esi
+  80059a:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  80059d:	83 c7 01             	add    $0x1,%edi
+  8005a0:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8005a4:	83 f8 25             	cmp    $0x25,%eax
+  8005a7:	74 0c                	je     8005b5 <vprintfmt+0x36>
+      if (ch == '\0')
+  8005a9:	85 c0                	test   %eax,%eax
+  8005ab:	75 e6                	jne    800593 <vprintfmt+0x14>
+}
+  8005ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005b0:	5b                   	pop    %ebx
+  8005b1:	5e                   	pop    %esi
+  8005b2:	5f                   	pop    %edi
+  8005b3:	5d                   	pop    %ebp
+  8005b4:	c3                   	ret
+    padc = ' ';
+  8005b5:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  8005b9:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  8005c0:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  8005c7:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  8005ce:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  8005d3:	8d 47 01             	lea    0x1(%edi),%eax
+  8005d6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8005d9:	0f b6 17             	movzbl (%edi),%edx
+  8005dc:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8005df:	3c 55                	cmp    $0x55,%al
+  8005e1:	0f 87 cf 03 00 00    	ja     8009b6 <vprintfmt+0x437>
+  8005e7:	0f b6 c0             	movzbl %al,%eax
+  8005ea:	ff 24 85 a0 33 80 00 	jmp    *0x8033a0(,%eax,4)
+  8005f1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  8005f4:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8005f8:	eb d9                	jmp    8005d3 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  8005fa:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8005fd:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800601:	eb d0                	jmp    8005d3 <vprintfmt+0x54>
+  800603:	0f b6 d2             	movzbl %dl,%edx
+  800606:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  800609:	b8 00 00 00 00       	mov    $0x0,%eax
+  80060e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  800611:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800614:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  800618:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  80061b:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80061e:	83 f9 09             	cmp    $0x9,%ecx
+  800621:	77 55                	ja     800678 <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  800623:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  800626:	eb e9                	jmp    800611 <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  800628:	8b 45 14             	mov    0x14(%ebp),%eax
+  80062b:	8b 00                	mov    (%eax),%eax
+  80062d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800630:	8b 45 14             	mov    0x14(%ebp),%eax
+  800633:	8d 40 04             	lea    0x4(%eax),%eax
+  800636:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  800639:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  80063c:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800640:	79 91                	jns    8005d3 <vprintfmt+0x54>
+        width = precision, precision = -1;
+  800642:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800645:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800648:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80064f:	eb 82                	jmp    8005d3 <vprintfmt+0x54>
+      if (width < 0)
+  800651:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800654:	85 d2                	test   %edx,%edx
+  800656:	b8 00 00 00 00       	mov    $0x0,%eax
+  80065b:	0f 49 c2             	cmovns %edx,%eax
+  80065e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  800661:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  800664:	e9 6a ff ff ff       	jmp    8005d3 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  800669:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  80066c:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  800673:	e9 5b ff ff ff       	jmp    8005d3 <vprintfmt+0x54>
+  800678:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80067b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80067e:	eb bc                	jmp    80063c <vprintfmt+0xbd>
+      lflag++;
+  800680:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  800683:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  800686:	e9 48 ff ff ff       	jmp    8005d3 <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  80068b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068e:	8d 78 04             	lea    0x4(%eax),%edi
+  800691:	83 ec 08             	sub    $0x8,%esp
+  800694:	53                   	push   %ebx
+  800695:	ff 30                	push   (%eax)
+  800697:	ff d6                	call   *%esi
+      break;
+  800699:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  80069c:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  80069f:	e9 b1 02 00 00       	jmp    800955 <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  8006a4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a7:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  8006aa:	8b 10                	mov    (%eax),%edx
+  8006ac:	89 d0                	mov    %edx,%eax
+  8006ae:	f7 d8                	neg    %eax
+  8006b0:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8006b3:	83 f8 10             	cmp    $0x10,%eax
+  8006b6:	7f 23                	jg     8006db <vprintfmt+0x15c>
+  8006b8:	8b 14 85 00 35 80 00 	mov    0x803500(,%eax,4),%edx
+  8006bf:	85 d2                	test   %edx,%edx
+  8006c1:	74 18                	je     8006db <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  8006c3:	52                   	push   %edx
+  8006c4:	68 4a 36 80 00       	push   $0x80364a
+  8006c9:	53                   	push   %ebx
+  8006ca:	56                   	push   %esi
+  8006cb:	e8 92 fe ff ff       	call   800562 <printfmt>
+  8006d0:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  8006d3:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8006d6:	e9 7a 02 00 00       	jmp    800955 <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  8006db:	50                   	push   %eax
+  8006dc:	68 67 32 80 00       	push   $0x803267
+  8006e1:	53                   	push   %ebx
+  8006e2:	56                   	push   %esi
+  8006e3:	e8 7a fe ff ff       	call   800562 <printfmt>
+  8006e8:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  8006eb:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  8006ee:	e9 62 02 00 00       	jmp    800955 <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  8006f3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f6:	83 c0 04             	add    $0x4,%eax
+  8006f9:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8006fc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ff:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  800701:	85 c9                	test   %ecx,%ecx
+  800703:	b8 60 32 80 00       	mov    $0x803260,%eax
+  800708:	0f 45 c1             	cmovne %ecx,%eax
+  80070b:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  80070e:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800712:	7e 06                	jle    80071a <vprintfmt+0x19b>
+  800714:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800718:	75 0b                	jne    800725 <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  80071a:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80071d:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800720:	89 75 08             	mov    %esi,0x8(%ebp)
+  800723:	eb 5c                	jmp    800781 <vprintfmt+0x202>
+  800725:	83 ec 08             	sub    $0x8,%esp
+  800728:	ff 75 d0             	push   -0x30(%ebp)
+  80072b:	ff 75 cc             	push   -0x34(%ebp)
+  80072e:	e8 20 03 00 00       	call   800a53 <strnlen>
+  800733:	89 c2                	mov    %eax,%edx
+  800735:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800738:	29 d0                	sub    %edx,%eax
+  80073a:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  80073d:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800741:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800744:	89 75 08             	mov    %esi,0x8(%ebp)
+  800747:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800749:	eb 0e                	jmp    800759 <vprintfmt+0x1da>
+          putch(padc, putdat);
+  80074b:	83 ec 08             	sub    $0x8,%esp
+  80074e:	53                   	push   %ebx
+  80074f:	57                   	push   %edi
+  800750:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800753:	83 ee 01             	sub    $0x1,%esi
+  800756:	83 c4 10             	add    $0x10,%esp
+  800759:	85 f6                	test   %esi,%esi
+  80075b:	7f ee                	jg     80074b <vprintfmt+0x1cc>
+  80075d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800760:	8b 75 08             	mov    0x8(%ebp),%esi
+  800763:	85 c0                	test   %eax,%eax
+  800765:	ba 00 00 00 00       	mov    $0x0,%edx
+  80076a:	0f 49 d0             	cmovns %eax,%edx
+  80076d:	29 d0                	sub    %edx,%eax
+  80076f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800772:	eb a6                	jmp    80071a <vprintfmt+0x19b>
+          putch(ch, putdat);
+  800774:	83 ec 08             	sub    $0x8,%esp
+  800777:	53                   	push   %ebx
+  800778:	52                   	push   %edx
+  800779:	ff 55 08             	call   *0x8(%ebp)
+  80077c:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80077f:	89 f1                	mov    %esi,%ecx
+  800781:	8d 71 01             	lea    0x1(%ecx),%esi
+  800784:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800788:	0f be d0             	movsbl %al,%edx
+  80078b:	85 d2                	test   %edx,%edx
+  80078d:	74 28                	je     8007b7 <vprintfmt+0x238>
+  80078f:	85 ff                	test   %edi,%edi
+  800791:	78 05                	js     800798 <vprintfmt+0x219>
+  800793:	83 ef 01             	sub    $0x1,%edi
+  800796:	78 30                	js     8007c8 <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  800798:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80079c:	74 d6                	je     800774 <vprintfmt+0x1f5>
+  80079e:	0f be c0             	movsbl %al,%eax
+  8007a1:	83 e8 20             	sub    $0x20,%eax
+  8007a4:	83 f8 5e             	cmp    $0x5e,%eax
+  8007a7:	76 cb                	jbe    800774 <vprintfmt+0x1f5>
+          putch('?', putdat);
+  8007a9:	83 ec 08             	sub    $0x8,%esp
+  8007ac:	53                   	push   %ebx
+  8007ad:	6a 3f                	push   $0x3f
+  8007af:	ff 55 08             	call   *0x8(%ebp)
+  8007b2:	83 c4 10             	add    $0x10,%esp
+  8007b5:	eb c8                	jmp    80077f <vprintfmt+0x200>
+  8007b7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007ba:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8007bd:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8007c0:	01 d0                	add    %edx,%eax
+  8007c2:	29 c8                	sub    %ecx,%eax
+  8007c4:	89 c7                	mov    %eax,%edi
+  8007c6:	eb 13                	jmp    8007db <vprintfmt+0x25c>
+  8007c8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007cb:	eb ed                	jmp    8007ba <vprintfmt+0x23b>
+        putch(' ', putdat);
+  8007cd:	83 ec 08             	sub    $0x8,%esp
+  8007d0:	53                   	push   %ebx
+  8007d1:	6a 20                	push   $0x20
+  8007d3:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  8007d5:	83 ef 01             	sub    $0x1,%edi
+  8007d8:	83 c4 10             	add    $0x10,%esp
+  8007db:	85 ff                	test   %edi,%edi
+  8007dd:	7f ee                	jg     8007cd <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  8007df:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8007e2:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007e5:	e9 6b 01 00 00       	jmp    800955 <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  8007ea:	83 f9 01             	cmp    $0x1,%ecx
+  8007ed:	7f 1f                	jg     80080e <vprintfmt+0x28f>
+  else if (lflag)
+  8007ef:	85 c9                	test   %ecx,%ecx
+  8007f1:	74 67                	je     80085a <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  8007f3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007f6:	8b 00                	mov    (%eax),%eax
+  8007f8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007fb:	89 c1                	mov    %eax,%ecx
+  8007fd:	c1 f9 1f             	sar    $0x1f,%ecx
+  800800:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800803:	8b 45 14             	mov    0x14(%ebp),%eax
+  800806:	8d 40 04             	lea    0x4(%eax),%eax
+  800809:	89 45 14             	mov    %eax,0x14(%ebp)
+  80080c:	eb 17                	jmp    800825 <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  80080e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800811:	8b 50 04             	mov    0x4(%eax),%edx
+  800814:	8b 00                	mov    (%eax),%eax
+  800816:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800819:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80081c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80081f:	8d 40 08             	lea    0x8(%eax),%eax
+  800822:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  800825:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800828:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  80082b:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  800830:	85 c9                	test   %ecx,%ecx
+  800832:	0f 89 03 01 00 00    	jns    80093b <vprintfmt+0x3bc>
+        putch('-', putdat);
+  800838:	83 ec 08             	sub    $0x8,%esp
+  80083b:	53                   	push   %ebx
+  80083c:	6a 2d                	push   $0x2d
+  80083e:	ff d6                	call   *%esi
+        num = -(long long)num;
+  800840:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800843:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800846:	f7 da                	neg    %edx
+  800848:	83 d1 00             	adc    $0x0,%ecx
+  80084b:	f7 d9                	neg    %ecx
+  80084d:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  800850:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800855:	e9 e1 00 00 00       	jmp    80093b <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  80085a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80085d:	8b 00                	mov    (%eax),%eax
+  80085f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800862:	89 c1                	mov    %eax,%ecx
+  800864:	c1 f9 1f             	sar    $0x1f,%ecx
+  800867:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80086a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80086d:	8d 40 04             	lea    0x4(%eax),%eax
+  800870:	89 45 14             	mov    %eax,0x14(%ebp)
+  800873:	eb b0                	jmp    800825 <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  800875:	83 f9 01             	cmp    $0x1,%ecx
+  800878:	7f 1e                	jg     800898 <vprintfmt+0x319>
+  else if (lflag)
+  80087a:	85 c9                	test   %ecx,%ecx
+  80087c:	74 32                	je     8008b0 <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  80087e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800881:	8b 10                	mov    (%eax),%edx
+  800883:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800888:	8d 40 04             	lea    0x4(%eax),%eax
+  80088b:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  80088e:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  800893:	e9 a3 00 00 00       	jmp    80093b <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800898:	8b 45 14             	mov    0x14(%ebp),%eax
+  80089b:	8b 10                	mov    (%eax),%edx
+  80089d:	8b 48 04             	mov    0x4(%eax),%ecx
+  8008a0:	8d 40 08             	lea    0x8(%eax),%eax
+  8008a3:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  8008a6:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  8008ab:	e9 8b 00 00 00       	jmp    80093b <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8008b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008b3:	8b 10                	mov    (%eax),%edx
+  8008b5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008ba:	8d 40 04             	lea    0x4(%eax),%eax
+  8008bd:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  8008c0:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  8008c5:	eb 74                	jmp    80093b <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  8008c7:	83 f9 01             	cmp    $0x1,%ecx
+  8008ca:	7f 1b                	jg     8008e7 <vprintfmt+0x368>
+  else if (lflag)
+  8008cc:	85 c9                	test   %ecx,%ecx
+  8008ce:	74 2c                	je     8008fc <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  8008d0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008d3:	8b 10                	mov    (%eax),%edx
+  8008d5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008da:	8d 40 04             	lea    0x4(%eax),%eax
+  8008dd:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8008e0:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  8008e5:	eb 54                	jmp    80093b <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  8008e7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008ea:	8b 10                	mov    (%eax),%edx
+  8008ec:	8b 48 04             	mov    0x4(%eax),%ecx
+  8008ef:	8d 40 08             	lea    0x8(%eax),%eax
+  8008f2:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8008f5:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  8008fa:	eb 3f                	jmp    80093b <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8008fc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008ff:	8b 10                	mov    (%eax),%edx
+  800901:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800906:	8d 40 04             	lea    0x4(%eax),%eax
+  800909:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  80090c:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  800911:	eb 28                	jmp    80093b <vprintfmt+0x3bc>
+      putch('0', putdat);
+  800913:	83 ec 08             	sub    $0x8,%esp
+  800916:	53                   	push   %ebx
+  800917:	6a 30                	push   $0x30
+  800919:	ff d6                	call   *%esi
+      putch('x', putdat);
+  80091b:	83 c4 08             	add    $0x8,%esp
+  80091e:	53                   	push   %ebx
+  80091f:	6a 78                	push   $0x78
+  800921:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  800923:	8b 45 14             	mov    0x14(%ebp),%eax
+  800926:	8b 10                	mov    (%eax),%edx
+  800928:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  80092d:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  800930:	8d 40 04             	lea    0x4(%eax),%eax
+  800933:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800936:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  80093b:	83 ec 0c             	sub    $0xc,%esp
+  80093e:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800942:	50                   	push   %eax
+  800943:	ff 75 e0             	push   -0x20(%ebp)
+  800946:	57                   	push   %edi
+  800947:	51                   	push   %ecx
+  800948:	52                   	push   %edx
+  800949:	89 da                	mov    %ebx,%edx
+  80094b:	89 f0                	mov    %esi,%eax
+  80094d:	e8 4a fb ff ff       	call   80049c <printnum>
+      break;
+  800952:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  800955:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  800958:	e9 40 fc ff ff       	jmp    80059d <vprintfmt+0x1e>
+  if (lflag >= 2)
+  80095d:	83 f9 01             	cmp    $0x1,%ecx
+  800960:	7f 1b                	jg     80097d <vprintfmt+0x3fe>
+  else if (lflag)
+  800962:	85 c9                	test   %ecx,%ecx
+  800964:	74 2c                	je     800992 <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  800966:	8b 45 14             	mov    0x14(%ebp),%eax
+  800969:	8b 10                	mov    (%eax),%edx
+  80096b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800970:	8d 40 04             	lea    0x4(%eax),%eax
+  800973:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800976:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  80097b:	eb be                	jmp    80093b <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  80097d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800980:	8b 10                	mov    (%eax),%edx
+  800982:	8b 48 04             	mov    0x4(%eax),%ecx
+  800985:	8d 40 08             	lea    0x8(%eax),%eax
+  800988:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  80098b:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  800990:	eb a9                	jmp    80093b <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800992:	8b 45 14             	mov    0x14(%ebp),%eax
+  800995:	8b 10                	mov    (%eax),%edx
+  800997:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80099c:	8d 40 04             	lea    0x4(%eax),%eax
+  80099f:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8009a2:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  8009a7:	eb 92                	jmp    80093b <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  8009a9:	83 ec 08             	sub    $0x8,%esp
+  8009ac:	53                   	push   %ebx
+  8009ad:	6a 25                	push   $0x25
+  8009af:	ff d6                	call   *%esi
+      break;
+  8009b1:	83 c4 10             	add    $0x10,%esp
+  8009b4:	eb 9f                	jmp    800955 <vprintfmt+0x3d6>
+      putch('%', putdat);
+  8009b6:	83 ec 08             	sub    $0x8,%esp
+  8009b9:	53                   	push   %ebx
+  8009ba:	6a 25                	push   $0x25
+  8009bc:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  8009be:	83 c4 10             	add    $0x10,%esp
+  8009c1:	89 f8                	mov    %edi,%eax
+  8009c3:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8009c7:	74 05                	je     8009ce <vprintfmt+0x44f>
+  8009c9:	83 e8 01             	sub    $0x1,%eax
+  8009cc:	eb f5                	jmp    8009c3 <vprintfmt+0x444>
+  8009ce:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8009d1:	eb 82                	jmp    800955 <vprintfmt+0x3d6>
+
+008009d3 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8009d3:	55                   	push   %ebp
+  8009d4:	89 e5                	mov    %esp,%ebp
+  8009d6:	83 ec 18             	sub    $0x18,%esp
+  8009d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009dc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  8009df:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8009e2:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8009e6:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8009e9:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  8009f0:	85 c0                	test   %eax,%eax
+  8009f2:	74 26                	je     800a1a <vsnprintf+0x47>
+  8009f4:	85 d2                	test   %edx,%edx
+  8009f6:	7e 22                	jle    800a1a <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8009f8:	ff 75 14             	push   0x14(%ebp)
+  8009fb:	ff 75 10             	push   0x10(%ebp)
+  8009fe:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800a01:	50                   	push   %eax
+  800a02:	68 45 05 80 00       	push   $0x800545
+  800a07:	e8 73 fb ff ff       	call   80057f <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800a0c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800a0f:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  800a12:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a15:	83 c4 10             	add    $0x10,%esp
+}
+  800a18:	c9                   	leave
+  800a19:	c3                   	ret
+    return -E_INVAL;
+  800a1a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a1f:	eb f7                	jmp    800a18 <vsnprintf+0x45>
+
+00800a21 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800a21:	55                   	push   %ebp
+  800a22:	89 e5                	mov    %esp,%ebp
+  800a24:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  800a27:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  800a2a:	50                   	push   %eax
+  800a2b:	ff 75 10             	push   0x10(%ebp)
+  800a2e:	ff 75 0c             	push   0xc(%ebp)
+  800a31:	ff 75 08             	push   0x8(%ebp)
+  800a34:	e8 9a ff ff ff       	call   8009d3 <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  800a39:	c9                   	leave
+  800a3a:	c3                   	ret
+
+00800a3b <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800a3b:	55                   	push   %ebp
+  800a3c:	89 e5                	mov    %esp,%ebp
+  800a3e:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  800a41:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a46:	eb 03                	jmp    800a4b <strlen+0x10>
+    n++;
+  800a48:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  800a4b:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800a4f:	75 f7                	jne    800a48 <strlen+0xd>
+  return n;
+}
+  800a51:	5d                   	pop    %ebp
+  800a52:	c3                   	ret
+
+00800a53 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800a53:	55                   	push   %ebp
+  800a54:	89 e5                	mov    %esp,%ebp
+  800a56:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a59:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a61:	eb 03                	jmp    800a66 <strnlen+0x13>
+    n++;
+  800a63:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a66:	39 d0                	cmp    %edx,%eax
+  800a68:	74 08                	je     800a72 <strnlen+0x1f>
+  800a6a:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800a6e:	75 f3                	jne    800a63 <strnlen+0x10>
+  800a70:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  800a72:	89 d0                	mov    %edx,%eax
+  800a74:	5d                   	pop    %ebp
+  800a75:	c3                   	ret
+
+00800a76 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800a76:	55                   	push   %ebp
+  800a77:	89 e5                	mov    %esp,%ebp
+  800a79:	53                   	push   %ebx
+  800a7a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a7d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  800a80:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a85:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800a89:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800a8c:	83 c0 01             	add    $0x1,%eax
+  800a8f:	84 d2                	test   %dl,%dl
+  800a91:	75 f2                	jne    800a85 <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  800a93:	89 c8                	mov    %ecx,%eax
+  800a95:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a98:	c9                   	leave
+  800a99:	c3                   	ret
+
+00800a9a <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800a9a:	55                   	push   %ebp
+  800a9b:	89 e5                	mov    %esp,%ebp
+  800a9d:	53                   	push   %ebx
+  800a9e:	83 ec 10             	sub    $0x10,%esp
+  800aa1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  800aa4:	53                   	push   %ebx
+  800aa5:	e8 91 ff ff ff       	call   800a3b <strlen>
+  800aaa:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  800aad:	ff 75 0c             	push   0xc(%ebp)
+  800ab0:	01 d8                	add    %ebx,%eax
+  800ab2:	50                   	push   %eax
+  800ab3:	e8 be ff ff ff       	call   800a76 <strcpy>
+  return dst;
+}
+  800ab8:	89 d8                	mov    %ebx,%eax
+  800aba:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800abd:	c9                   	leave
+  800abe:	c3                   	ret
+
+00800abf <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  800abf:	55                   	push   %ebp
+  800ac0:	89 e5                	mov    %esp,%ebp
+  800ac2:	56                   	push   %esi
+  800ac3:	53                   	push   %ebx
+  800ac4:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ac7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  800aca:	89 f3                	mov    %esi,%ebx
+  800acc:	03 5d 10             	add    0x10(%ebp),%ebx
+  800acf:	89 f0                	mov    %esi,%eax
+  800ad1:	eb 0f                	jmp    800ae2 <strncpy+0x23>
+    *dst++ = *src;
+  800ad3:	83 c0 01             	add    $0x1,%eax
+  800ad6:	0f b6 0a             	movzbl (%edx),%ecx
+  800ad9:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  800adc:	80 f9 01             	cmp    $0x1,%cl
+  800adf:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  800ae2:	39 d8                	cmp    %ebx,%eax
+  800ae4:	75 ed                	jne    800ad3 <strncpy+0x14>
+  }
+  return ret;
+}
+  800ae6:	89 f0                	mov    %esi,%eax
+  800ae8:	5b                   	pop    %ebx
+  800ae9:	5e                   	pop    %esi
+  800aea:	5d                   	pop    %ebp
+  800aeb:	c3                   	ret
+
+00800aec <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800aec:	55                   	push   %ebp
+  800aed:	89 e5                	mov    %esp,%ebp
+  800aef:	56                   	push   %esi
+  800af0:	53                   	push   %ebx
+  800af1:	8b 75 08             	mov    0x8(%ebp),%esi
+  800af4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800af7:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  800afa:	89 f0                	mov    %esi,%eax
+  800afc:	85 d2                	test   %edx,%edx
+  800afe:	74 21                	je     800b21 <strlcpy+0x35>
+  800b00:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800b04:	89 f2                	mov    %esi,%edx
+  800b06:	eb 09                	jmp    800b11 <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  800b08:	83 c1 01             	add    $0x1,%ecx
+  800b0b:	83 c2 01             	add    $0x1,%edx
+  800b0e:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  800b11:	39 c2                	cmp    %eax,%edx
+  800b13:	74 09                	je     800b1e <strlcpy+0x32>
+  800b15:	0f b6 19             	movzbl (%ecx),%ebx
+  800b18:	84 db                	test   %bl,%bl
+  800b1a:	75 ec                	jne    800b08 <strlcpy+0x1c>
+  800b1c:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  800b1e:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  800b21:	29 f0                	sub    %esi,%eax
+}
+  800b23:	5b                   	pop    %ebx
+  800b24:	5e                   	pop    %esi
+  800b25:	5d                   	pop    %ebp
+  800b26:	c3                   	ret
+
+00800b27 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800b27:	55                   	push   %ebp
+  800b28:	89 e5                	mov    %esp,%ebp
+  800b2a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b2d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  800b30:	eb 06                	jmp    800b38 <strcmp+0x11>
+    p++, q++;
+  800b32:	83 c1 01             	add    $0x1,%ecx
+  800b35:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  800b38:	0f b6 01             	movzbl (%ecx),%eax
+  800b3b:	84 c0                	test   %al,%al
+  800b3d:	74 04                	je     800b43 <strcmp+0x1c>
+  800b3f:	3a 02                	cmp    (%edx),%al
+  800b41:	74 ef                	je     800b32 <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  800b43:	0f b6 c0             	movzbl %al,%eax
+  800b46:	0f b6 12             	movzbl (%edx),%edx
+  800b49:	29 d0                	sub    %edx,%eax
+}
+  800b4b:	5d                   	pop    %ebp
+  800b4c:	c3                   	ret
+
+00800b4d <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800b4d:	55                   	push   %ebp
+  800b4e:	89 e5                	mov    %esp,%ebp
+  800b50:	53                   	push   %ebx
+  800b51:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b54:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b57:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  800b5a:	eb 09                	jmp    800b65 <strncmp+0x18>
+    n--, p++, q++;
+  800b5c:	83 ea 01             	sub    $0x1,%edx
+  800b5f:	83 c0 01             	add    $0x1,%eax
+  800b62:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  800b65:	85 d2                	test   %edx,%edx
+  800b67:	74 18                	je     800b81 <strncmp+0x34>
+  800b69:	0f b6 18             	movzbl (%eax),%ebx
+  800b6c:	84 db                	test   %bl,%bl
+  800b6e:	74 04                	je     800b74 <strncmp+0x27>
+  800b70:	3a 19                	cmp    (%ecx),%bl
+  800b72:	74 e8                	je     800b5c <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800b74:	0f b6 00             	movzbl (%eax),%eax
+  800b77:	0f b6 11             	movzbl (%ecx),%edx
+  800b7a:	29 d0                	sub    %edx,%eax
+}
+  800b7c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b7f:	c9                   	leave
+  800b80:	c3                   	ret
+    return 0;
+  800b81:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b86:	eb f4                	jmp    800b7c <strncmp+0x2f>
+
+00800b88 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800b88:	55                   	push   %ebp
+  800b89:	89 e5                	mov    %esp,%ebp
+  800b8b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b8e:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800b92:	eb 03                	jmp    800b97 <strchr+0xf>
+  800b94:	83 c0 01             	add    $0x1,%eax
+  800b97:	0f b6 10             	movzbl (%eax),%edx
+  800b9a:	84 d2                	test   %dl,%dl
+  800b9c:	74 06                	je     800ba4 <strchr+0x1c>
+    if (*s == c)
+  800b9e:	38 ca                	cmp    %cl,%dl
+  800ba0:	75 f2                	jne    800b94 <strchr+0xc>
+  800ba2:	eb 05                	jmp    800ba9 <strchr+0x21>
+      return (char*)s;
+  return 0;
+  800ba4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ba9:	5d                   	pop    %ebp
+  800baa:	c3                   	ret
+
+00800bab <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800bab:	55                   	push   %ebp
+  800bac:	89 e5                	mov    %esp,%ebp
+  800bae:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bb1:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800bb5:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  800bb8:	38 ca                	cmp    %cl,%dl
+  800bba:	74 09                	je     800bc5 <strfind+0x1a>
+  800bbc:	84 d2                	test   %dl,%dl
+  800bbe:	74 05                	je     800bc5 <strfind+0x1a>
+  for (; *s; s++)
+  800bc0:	83 c0 01             	add    $0x1,%eax
+  800bc3:	eb f0                	jmp    800bb5 <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  800bc5:	5d                   	pop    %ebp
+  800bc6:	c3                   	ret
+
+00800bc7 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800bc7:	55                   	push   %ebp
+  800bc8:	89 e5                	mov    %esp,%ebp
+  800bca:	57                   	push   %edi
+  800bcb:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800bce:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  800bd1:	85 c9                	test   %ecx,%ecx
+  800bd3:	74 20                	je     800bf5 <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  800bd5:	89 f8                	mov    %edi,%eax
+  800bd7:	09 c8                	or     %ecx,%eax
+  800bd9:	a8 03                	test   $0x3,%al
+  800bdb:	75 12                	jne    800bef <memset+0x28>
+    c &= 0xFF;
+  800bdd:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800be1:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  800be7:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  800bea:	fc                   	cld
+  800beb:	f3 ab                	rep stos %eax,%es:(%edi)
+  800bed:	eb 06                	jmp    800bf5 <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  800bef:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800bf2:	fc                   	cld
+  800bf3:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  800bf5:	89 f8                	mov    %edi,%eax
+  800bf7:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800bfa:	c9                   	leave
+  800bfb:	c3                   	ret
+
+00800bfc <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800bfc:	55                   	push   %ebp
+  800bfd:	89 e5                	mov    %esp,%ebp
+  800bff:	57                   	push   %edi
+  800c00:	56                   	push   %esi
+  800c01:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c04:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800c07:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  800c0a:	39 c6                	cmp    %eax,%esi
+  800c0c:	73 32                	jae    800c40 <memmove+0x44>
+  800c0e:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800c11:	39 d0                	cmp    %edx,%eax
+  800c13:	73 2b                	jae    800c40 <memmove+0x44>
+    s += n;
+    d += n;
+  800c15:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c18:	89 d6                	mov    %edx,%esi
+  800c1a:	09 fe                	or     %edi,%esi
+  800c1c:	09 ce                	or     %ecx,%esi
+  800c1e:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800c24:	75 0e                	jne    800c34 <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800c26:	83 ef 04             	sub    $0x4,%edi
+  800c29:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800c2c:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  800c2f:	fd                   	std
+  800c30:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c32:	eb 09                	jmp    800c3d <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800c34:	83 ef 01             	sub    $0x1,%edi
+  800c37:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  800c3a:	fd                   	std
+  800c3b:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  800c3d:	fc                   	cld
+  800c3e:	eb 1a                	jmp    800c5a <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c40:	89 f2                	mov    %esi,%edx
+  800c42:	09 c2                	or     %eax,%edx
+  800c44:	09 ca                	or     %ecx,%edx
+  800c46:	f6 c2 03             	test   $0x3,%dl
+  800c49:	75 0a                	jne    800c55 <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800c4b:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  800c4e:	89 c7                	mov    %eax,%edi
+  800c50:	fc                   	cld
+  800c51:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c53:	eb 05                	jmp    800c5a <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  800c55:	89 c7                	mov    %eax,%edi
+  800c57:	fc                   	cld
+  800c58:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  800c5a:	5e                   	pop    %esi
+  800c5b:	5f                   	pop    %edi
+  800c5c:	5d                   	pop    %ebp
+  800c5d:	c3                   	ret
+
+00800c5e <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800c5e:	55                   	push   %ebp
+  800c5f:	89 e5                	mov    %esp,%ebp
+  800c61:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  800c64:	ff 75 10             	push   0x10(%ebp)
+  800c67:	ff 75 0c             	push   0xc(%ebp)
+  800c6a:	ff 75 08             	push   0x8(%ebp)
+  800c6d:	e8 8a ff ff ff       	call   800bfc <memmove>
+}
+  800c72:	c9                   	leave
+  800c73:	c3                   	ret
+
+00800c74 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800c74:	55                   	push   %ebp
+  800c75:	89 e5                	mov    %esp,%ebp
+  800c77:	56                   	push   %esi
+  800c78:	53                   	push   %ebx
+  800c79:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c7c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  800c7f:	89 c6                	mov    %eax,%esi
+  800c81:	03 75 10             	add    0x10(%ebp),%esi
+  800c84:	eb 06                	jmp    800c8c <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  800c86:	83 c0 01             	add    $0x1,%eax
+  800c89:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  800c8c:	39 f0                	cmp    %esi,%eax
+  800c8e:	74 14                	je     800ca4 <memcmp+0x30>
+    if (*s1 != *s2)
+  800c90:	0f b6 08             	movzbl (%eax),%ecx
+  800c93:	0f b6 1a             	movzbl (%edx),%ebx
+  800c96:	38 d9                	cmp    %bl,%cl
+  800c98:	74 ec                	je     800c86 <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  800c9a:	0f b6 c1             	movzbl %cl,%eax
+  800c9d:	0f b6 db             	movzbl %bl,%ebx
+  800ca0:	29 d8                	sub    %ebx,%eax
+  800ca2:	eb 05                	jmp    800ca9 <memcmp+0x35>
+  }
+
+  return 0;
+  800ca4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ca9:	5b                   	pop    %ebx
+  800caa:	5e                   	pop    %esi
+  800cab:	5d                   	pop    %ebp
+  800cac:	c3                   	ret
+
+00800cad <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800cad:	55                   	push   %ebp
+  800cae:	89 e5                	mov    %esp,%ebp
+  800cb0:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cb3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  800cb6:	89 c2                	mov    %eax,%edx
+  800cb8:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  800cbb:	eb 03                	jmp    800cc0 <memfind+0x13>
+  800cbd:	83 c0 01             	add    $0x1,%eax
+  800cc0:	39 d0                	cmp    %edx,%eax
+  800cc2:	73 04                	jae    800cc8 <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  800cc4:	38 08                	cmp    %cl,(%eax)
+  800cc6:	75 f5                	jne    800cbd <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  800cc8:	5d                   	pop    %ebp
+  800cc9:	c3                   	ret
+
+00800cca <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800cca:	55                   	push   %ebp
+  800ccb:	89 e5                	mov    %esp,%ebp
+  800ccd:	57                   	push   %edi
+  800cce:	56                   	push   %esi
+  800ccf:	53                   	push   %ebx
+  800cd0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cd3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  800cd6:	eb 03                	jmp    800cdb <strtol+0x11>
+    s++;
+  800cd8:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  800cdb:	0f b6 02             	movzbl (%edx),%eax
+  800cde:	3c 20                	cmp    $0x20,%al
+  800ce0:	74 f6                	je     800cd8 <strtol+0xe>
+  800ce2:	3c 09                	cmp    $0x9,%al
+  800ce4:	74 f2                	je     800cd8 <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  800ce6:	3c 2b                	cmp    $0x2b,%al
+  800ce8:	74 2a                	je     800d14 <strtol+0x4a>
+  int neg = 0;
+  800cea:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  800cef:	3c 2d                	cmp    $0x2d,%al
+  800cf1:	74 2b                	je     800d1e <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800cf3:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800cf9:	75 0f                	jne    800d0a <strtol+0x40>
+  800cfb:	80 3a 30             	cmpb   $0x30,(%edx)
+  800cfe:	74 28                	je     800d28 <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  800d00:	85 db                	test   %ebx,%ebx
+  800d02:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d07:	0f 44 d8             	cmove  %eax,%ebx
+  800d0a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d0f:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800d12:	eb 46                	jmp    800d5a <strtol+0x90>
+    s++;
+  800d14:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  800d17:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d1c:	eb d5                	jmp    800cf3 <strtol+0x29>
+    s++, neg = 1;
+  800d1e:	83 c2 01             	add    $0x1,%edx
+  800d21:	bf 01 00 00 00       	mov    $0x1,%edi
+  800d26:	eb cb                	jmp    800cf3 <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d28:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800d2c:	74 0e                	je     800d3c <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  800d2e:	85 db                	test   %ebx,%ebx
+  800d30:	75 d8                	jne    800d0a <strtol+0x40>
+    s++, base = 8;
+  800d32:	83 c2 01             	add    $0x1,%edx
+  800d35:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800d3a:	eb ce                	jmp    800d0a <strtol+0x40>
+    s += 2, base = 16;
+  800d3c:	83 c2 02             	add    $0x2,%edx
+  800d3f:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800d44:	eb c4                	jmp    800d0a <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  800d46:	0f be c0             	movsbl %al,%eax
+  800d49:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  800d4c:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800d4f:	7d 3a                	jge    800d8b <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  800d51:	83 c2 01             	add    $0x1,%edx
+  800d54:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800d58:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  800d5a:	0f b6 02             	movzbl (%edx),%eax
+  800d5d:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800d60:	89 f3                	mov    %esi,%ebx
+  800d62:	80 fb 09             	cmp    $0x9,%bl
+  800d65:	76 df                	jbe    800d46 <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  800d67:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800d6a:	89 f3                	mov    %esi,%ebx
+  800d6c:	80 fb 19             	cmp    $0x19,%bl
+  800d6f:	77 08                	ja     800d79 <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  800d71:	0f be c0             	movsbl %al,%eax
+  800d74:	83 e8 57             	sub    $0x57,%eax
+  800d77:	eb d3                	jmp    800d4c <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  800d79:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800d7c:	89 f3                	mov    %esi,%ebx
+  800d7e:	80 fb 19             	cmp    $0x19,%bl
+  800d81:	77 08                	ja     800d8b <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  800d83:	0f be c0             	movsbl %al,%eax
+  800d86:	83 e8 37             	sub    $0x37,%eax
+  800d89:	eb c1                	jmp    800d4c <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  800d8b:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800d8f:	74 05                	je     800d96 <strtol+0xcc>
+    *endptr = (char*)s;
+  800d91:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d94:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  800d96:	89 c8                	mov    %ecx,%eax
+  800d98:	f7 d8                	neg    %eax
+  800d9a:	85 ff                	test   %edi,%edi
+  800d9c:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800d9f:	89 c8                	mov    %ecx,%eax
+  800da1:	5b                   	pop    %ebx
+  800da2:	5e                   	pop    %esi
+  800da3:	5f                   	pop    %edi
+  800da4:	5d                   	pop    %ebp
+  800da5:	c3                   	ret
+
+00800da6 <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800da6:	55                   	push   %ebp
+  800da7:	89 e5                	mov    %esp,%ebp
+  800da9:	57                   	push   %edi
+  800daa:	56                   	push   %esi
+  800dab:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800dac:	b8 00 00 00 00       	mov    $0x0,%eax
+  800db1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800db4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800db7:	89 c3                	mov    %eax,%ebx
+  800db9:	89 c7                	mov    %eax,%edi
+  800dbb:	89 c6                	mov    %eax,%esi
+  800dbd:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800dbf:	5b                   	pop    %ebx
+  800dc0:	5e                   	pop    %esi
+  800dc1:	5f                   	pop    %edi
+  800dc2:	5d                   	pop    %ebp
+  800dc3:	c3                   	ret
+
+00800dc4 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800dc4:	55                   	push   %ebp
+  800dc5:	89 e5                	mov    %esp,%ebp
+  800dc7:	57                   	push   %edi
+  800dc8:	56                   	push   %esi
+  800dc9:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800dca:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dcf:	b8 01 00 00 00       	mov    $0x1,%eax
+  800dd4:	89 d1                	mov    %edx,%ecx
+  800dd6:	89 d3                	mov    %edx,%ebx
+  800dd8:	89 d7                	mov    %edx,%edi
+  800dda:	89 d6                	mov    %edx,%esi
+  800ddc:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800dde:	5b                   	pop    %ebx
+  800ddf:	5e                   	pop    %esi
+  800de0:	5f                   	pop    %edi
+  800de1:	5d                   	pop    %ebp
+  800de2:	c3                   	ret
+
+00800de3 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800de3:	55                   	push   %ebp
+  800de4:	89 e5                	mov    %esp,%ebp
+  800de6:	57                   	push   %edi
+  800de7:	56                   	push   %esi
+  800de8:	53                   	push   %ebx
+  800de9:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800dec:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800df1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df4:	b8 03 00 00 00       	mov    $0x3,%eax
+  800df9:	89 cb                	mov    %ecx,%ebx
+  800dfb:	89 cf                	mov    %ecx,%edi
+  800dfd:	89 ce                	mov    %ecx,%esi
+  800dff:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e01:	85 c0                	test   %eax,%eax
+  800e03:	7f 08                	jg     800e0d <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800e05:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e08:	5b                   	pop    %ebx
+  800e09:	5e                   	pop    %esi
+  800e0a:	5f                   	pop    %edi
+  800e0b:	5d                   	pop    %ebp
+  800e0c:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e0d:	83 ec 0c             	sub    $0xc,%esp
+  800e10:	50                   	push   %eax
+  800e11:	6a 03                	push   $0x3
+  800e13:	68 63 35 80 00       	push   $0x803563
+  800e18:	6a 23                	push   $0x23
+  800e1a:	68 80 35 80 00       	push   $0x803580
+  800e1f:	e8 89 f5 ff ff       	call   8003ad <_panic>
+
+00800e24 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800e24:	55                   	push   %ebp
+  800e25:	89 e5                	mov    %esp,%ebp
+  800e27:	57                   	push   %edi
+  800e28:	56                   	push   %esi
+  800e29:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e2a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e2f:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e34:	89 d1                	mov    %edx,%ecx
+  800e36:	89 d3                	mov    %edx,%ebx
+  800e38:	89 d7                	mov    %edx,%edi
+  800e3a:	89 d6                	mov    %edx,%esi
+  800e3c:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800e3e:	5b                   	pop    %ebx
+  800e3f:	5e                   	pop    %esi
+  800e40:	5f                   	pop    %edi
+  800e41:	5d                   	pop    %ebp
+  800e42:	c3                   	ret
+
+00800e43 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800e43:	55                   	push   %ebp
+  800e44:	89 e5                	mov    %esp,%ebp
+  800e46:	57                   	push   %edi
+  800e47:	56                   	push   %esi
+  800e48:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e49:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e4e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e53:	89 d1                	mov    %edx,%ecx
+  800e55:	89 d3                	mov    %edx,%ebx
+  800e57:	89 d7                	mov    %edx,%edi
+  800e59:	89 d6                	mov    %edx,%esi
+  800e5b:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800e5d:	5b                   	pop    %ebx
+  800e5e:	5e                   	pop    %esi
+  800e5f:	5f                   	pop    %edi
+  800e60:	5d                   	pop    %ebp
+  800e61:	c3                   	ret
+
+00800e62 <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  800e62:	55                   	push   %ebp
+  800e63:	89 e5                	mov    %esp,%ebp
+  800e65:	57                   	push   %edi
+  800e66:	56                   	push   %esi
+  800e67:	53                   	push   %ebx
+  800e68:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  800e6b:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  800e6f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e74:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e77:	b8 14 00 00 00       	mov    $0x14,%eax
+  800e7c:	89 df                	mov    %ebx,%edi
+  800e7e:	89 de                	mov    %ebx,%esi
+  800e80:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e82:	85 c0                	test   %eax,%eax
+  800e84:	7f 08                	jg     800e8e <sys_env_set_cow+0x2c>
+}
+  800e86:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e89:	5b                   	pop    %ebx
+  800e8a:	5e                   	pop    %esi
+  800e8b:	5f                   	pop    %edi
+  800e8c:	5d                   	pop    %ebp
+  800e8d:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e8e:	83 ec 0c             	sub    $0xc,%esp
+  800e91:	50                   	push   %eax
+  800e92:	6a 14                	push   $0x14
+  800e94:	68 63 35 80 00       	push   $0x803563
+  800e99:	6a 23                	push   $0x23
+  800e9b:	68 80 35 80 00       	push   $0x803580
+  800ea0:	e8 08 f5 ff ff       	call   8003ad <_panic>
+
+00800ea5 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800ea5:	55                   	push   %ebp
+  800ea6:	89 e5                	mov    %esp,%ebp
+  800ea8:	57                   	push   %edi
+  800ea9:	56                   	push   %esi
+  800eaa:	53                   	push   %ebx
+  800eab:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800eae:	be 00 00 00 00       	mov    $0x0,%esi
+  800eb3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eb9:	b8 04 00 00 00       	mov    $0x4,%eax
+  800ebe:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ec1:	89 f7                	mov    %esi,%edi
+  800ec3:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ec5:	85 c0                	test   %eax,%eax
+  800ec7:	7f 08                	jg     800ed1 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  800ec9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ecc:	5b                   	pop    %ebx
+  800ecd:	5e                   	pop    %esi
+  800ece:	5f                   	pop    %edi
+  800ecf:	5d                   	pop    %ebp
+  800ed0:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ed1:	83 ec 0c             	sub    $0xc,%esp
+  800ed4:	50                   	push   %eax
+  800ed5:	6a 04                	push   $0x4
+  800ed7:	68 63 35 80 00       	push   $0x803563
+  800edc:	6a 23                	push   $0x23
+  800ede:	68 80 35 80 00       	push   $0x803580
+  800ee3:	e8 c5 f4 ff ff       	call   8003ad <_panic>
+
+00800ee8 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800ee8:	55                   	push   %ebp
+  800ee9:	89 e5                	mov    %esp,%ebp
+  800eeb:	57                   	push   %edi
+  800eec:	56                   	push   %esi
+  800eed:	53                   	push   %ebx
+  800eee:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800ef1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ef7:	b8 05 00 00 00       	mov    $0x5,%eax
+  800efc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800eff:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f02:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f05:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f07:	85 c0                	test   %eax,%eax
+  800f09:	7f 08                	jg     800f13 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  800f0b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f0e:	5b                   	pop    %ebx
+  800f0f:	5e                   	pop    %esi
+  800f10:	5f                   	pop    %edi
+  800f11:	5d                   	pop    %ebp
+  800f12:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f13:	83 ec 0c             	sub    $0xc,%esp
+  800f16:	50                   	push   %eax
+  800f17:	6a 05                	push   $0x5
+  800f19:	68 63 35 80 00       	push   $0x803563
+  800f1e:	6a 23                	push   $0x23
+  800f20:	68 80 35 80 00       	push   $0x803580
+  800f25:	e8 83 f4 ff ff       	call   8003ad <_panic>
+
+00800f2a <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800f2a:	55                   	push   %ebp
+  800f2b:	89 e5                	mov    %esp,%ebp
+  800f2d:	57                   	push   %edi
+  800f2e:	56                   	push   %esi
+  800f2f:	53                   	push   %ebx
+  800f30:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f33:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f38:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f3b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f3e:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f43:	89 df                	mov    %ebx,%edi
+  800f45:	89 de                	mov    %ebx,%esi
+  800f47:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f49:	85 c0                	test   %eax,%eax
+  800f4b:	7f 08                	jg     800f55 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  800f4d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f50:	5b                   	pop    %ebx
+  800f51:	5e                   	pop    %esi
+  800f52:	5f                   	pop    %edi
+  800f53:	5d                   	pop    %ebp
+  800f54:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f55:	83 ec 0c             	sub    $0xc,%esp
+  800f58:	50                   	push   %eax
+  800f59:	6a 06                	push   $0x6
+  800f5b:	68 63 35 80 00       	push   $0x803563
+  800f60:	6a 23                	push   $0x23
+  800f62:	68 80 35 80 00       	push   $0x803580
+  800f67:	e8 41 f4 ff ff       	call   8003ad <_panic>
+
+00800f6c <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  800f6c:	55                   	push   %ebp
+  800f6d:	89 e5                	mov    %esp,%ebp
+  800f6f:	57                   	push   %edi
+  800f70:	56                   	push   %esi
+  800f71:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f72:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f75:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f78:	b8 11 00 00 00       	mov    $0x11,%eax
+  800f7d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f80:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f83:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f86:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  800f88:	5b                   	pop    %ebx
+  800f89:	5e                   	pop    %esi
+  800f8a:	5f                   	pop    %edi
+  800f8b:	5d                   	pop    %ebp
+  800f8c:	c3                   	ret
+
+00800f8d <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  800f8d:	55                   	push   %ebp
+  800f8e:	89 e5                	mov    %esp,%ebp
+  800f90:	57                   	push   %edi
+  800f91:	56                   	push   %esi
+  800f92:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f93:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f96:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f99:	b8 12 00 00 00       	mov    $0x12,%eax
+  800f9e:	be 00 00 00 00       	mov    $0x0,%esi
+  800fa3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fa6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fa9:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  800fab:	5b                   	pop    %ebx
+  800fac:	5e                   	pop    %esi
+  800fad:	5f                   	pop    %edi
+  800fae:	5d                   	pop    %ebp
+  800faf:	c3                   	ret
+
+00800fb0 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  800fb0:	55                   	push   %ebp
+  800fb1:	89 e5                	mov    %esp,%ebp
+  800fb3:	57                   	push   %edi
+  800fb4:	56                   	push   %esi
+  800fb5:	53                   	push   %ebx
+  800fb6:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800fb9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fbe:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fc4:	b8 16 00 00 00       	mov    $0x16,%eax
+  800fc9:	89 df                	mov    %ebx,%edi
+  800fcb:	89 de                	mov    %ebx,%esi
+  800fcd:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800fcf:	85 c0                	test   %eax,%eax
+  800fd1:	7f 08                	jg     800fdb <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  800fd3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fd6:	5b                   	pop    %ebx
+  800fd7:	5e                   	pop    %esi
+  800fd8:	5f                   	pop    %edi
+  800fd9:	5d                   	pop    %ebp
+  800fda:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800fdb:	83 ec 0c             	sub    $0xc,%esp
+  800fde:	50                   	push   %eax
+  800fdf:	6a 16                	push   $0x16
+  800fe1:	68 63 35 80 00       	push   $0x803563
+  800fe6:	6a 23                	push   $0x23
+  800fe8:	68 80 35 80 00       	push   $0x803580
+  800fed:	e8 bb f3 ff ff       	call   8003ad <_panic>
+
+00800ff2 <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  800ff2:	55                   	push   %ebp
+  800ff3:	89 e5                	mov    %esp,%ebp
+  800ff5:	57                   	push   %edi
+  800ff6:	56                   	push   %esi
+  800ff7:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800ff8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ffd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801000:	b8 17 00 00 00       	mov    $0x17,%eax
+  801005:	89 cb                	mov    %ecx,%ebx
+  801007:	89 cf                	mov    %ecx,%edi
+  801009:	89 ce                	mov    %ecx,%esi
+  80100b:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  80100d:	5b                   	pop    %ebx
+  80100e:	5e                   	pop    %esi
+  80100f:	5f                   	pop    %edi
+  801010:	5d                   	pop    %ebp
+  801011:	c3                   	ret
+
+00801012 <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  801012:	55                   	push   %ebp
+  801013:	89 e5                	mov    %esp,%ebp
+  801015:	57                   	push   %edi
+  801016:	56                   	push   %esi
+  801017:	53                   	push   %ebx
+  801018:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80101b:	be 00 00 00 00       	mov    $0x0,%esi
+  801020:	8b 55 08             	mov    0x8(%ebp),%edx
+  801023:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801026:	b8 18 00 00 00       	mov    $0x18,%eax
+  80102b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80102e:	89 f7                	mov    %esi,%edi
+  801030:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801032:	85 c0                	test   %eax,%eax
+  801034:	7f 08                	jg     80103e <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  801036:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801039:	5b                   	pop    %ebx
+  80103a:	5e                   	pop    %esi
+  80103b:	5f                   	pop    %edi
+  80103c:	5d                   	pop    %ebp
+  80103d:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80103e:	83 ec 0c             	sub    $0xc,%esp
+  801041:	50                   	push   %eax
+  801042:	6a 18                	push   $0x18
+  801044:	68 63 35 80 00       	push   $0x803563
+  801049:	6a 23                	push   $0x23
+  80104b:	68 80 35 80 00       	push   $0x803580
+  801050:	e8 58 f3 ff ff       	call   8003ad <_panic>
+
+00801055 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  801055:	55                   	push   %ebp
+  801056:	89 e5                	mov    %esp,%ebp
+  801058:	57                   	push   %edi
+  801059:	56                   	push   %esi
+  80105a:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80105b:	be 00 00 00 00       	mov    $0x0,%esi
+  801060:	8b 55 08             	mov    0x8(%ebp),%edx
+  801063:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801066:	b8 19 00 00 00       	mov    $0x19,%eax
+  80106b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80106e:	89 f7                	mov    %esi,%edi
+  801070:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  801072:	5b                   	pop    %ebx
+  801073:	5e                   	pop    %esi
+  801074:	5f                   	pop    %edi
+  801075:	5d                   	pop    %ebp
+  801076:	c3                   	ret
+
+00801077 <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  801077:	55                   	push   %ebp
+  801078:	89 e5                	mov    %esp,%ebp
+  80107a:	57                   	push   %edi
+  80107b:	56                   	push   %esi
+  80107c:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80107d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801082:	b8 15 00 00 00       	mov    $0x15,%eax
+  801087:	89 d1                	mov    %edx,%ecx
+  801089:	89 d3                	mov    %edx,%ebx
+  80108b:	89 d7                	mov    %edx,%edi
+  80108d:	89 d6                	mov    %edx,%esi
+  80108f:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  801091:	5b                   	pop    %ebx
+  801092:	5e                   	pop    %esi
+  801093:	5f                   	pop    %edi
+  801094:	5d                   	pop    %ebp
+  801095:	c3                   	ret
+
+00801096 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801096:	55                   	push   %ebp
+  801097:	89 e5                	mov    %esp,%ebp
+  801099:	57                   	push   %edi
+  80109a:	56                   	push   %esi
+  80109b:	53                   	push   %ebx
+  80109c:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80109f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010aa:	b8 08 00 00 00       	mov    $0x8,%eax
+  8010af:	89 df                	mov    %ebx,%edi
+  8010b1:	89 de                	mov    %ebx,%esi
+  8010b3:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8010b5:	85 c0                	test   %eax,%eax
+  8010b7:	7f 08                	jg     8010c1 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8010b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010bc:	5b                   	pop    %ebx
+  8010bd:	5e                   	pop    %esi
+  8010be:	5f                   	pop    %edi
+  8010bf:	5d                   	pop    %ebp
+  8010c0:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8010c1:	83 ec 0c             	sub    $0xc,%esp
+  8010c4:	50                   	push   %eax
+  8010c5:	6a 08                	push   $0x8
+  8010c7:	68 63 35 80 00       	push   $0x803563
+  8010cc:	6a 23                	push   $0x23
+  8010ce:	68 80 35 80 00       	push   $0x803580
+  8010d3:	e8 d5 f2 ff ff       	call   8003ad <_panic>
+
+008010d8 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8010d8:	55                   	push   %ebp
+  8010d9:	89 e5                	mov    %esp,%ebp
+  8010db:	57                   	push   %edi
+  8010dc:	56                   	push   %esi
+  8010dd:	53                   	push   %ebx
+  8010de:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8010e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ec:	b8 09 00 00 00       	mov    $0x9,%eax
+  8010f1:	89 df                	mov    %ebx,%edi
+  8010f3:	89 de                	mov    %ebx,%esi
+  8010f5:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8010f7:	85 c0                	test   %eax,%eax
+  8010f9:	7f 08                	jg     801103 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  8010fb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010fe:	5b                   	pop    %ebx
+  8010ff:	5e                   	pop    %esi
+  801100:	5f                   	pop    %edi
+  801101:	5d                   	pop    %ebp
+  801102:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801103:	83 ec 0c             	sub    $0xc,%esp
+  801106:	50                   	push   %eax
+  801107:	6a 09                	push   $0x9
+  801109:	68 63 35 80 00       	push   $0x803563
+  80110e:	6a 23                	push   $0x23
+  801110:	68 80 35 80 00       	push   $0x803580
+  801115:	e8 93 f2 ff ff       	call   8003ad <_panic>
+
+0080111a <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80111a:	55                   	push   %ebp
+  80111b:	89 e5                	mov    %esp,%ebp
+  80111d:	57                   	push   %edi
+  80111e:	56                   	push   %esi
+  80111f:	53                   	push   %ebx
+  801120:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801123:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801128:	8b 55 08             	mov    0x8(%ebp),%edx
+  80112b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80112e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801133:	89 df                	mov    %ebx,%edi
+  801135:	89 de                	mov    %ebx,%esi
+  801137:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801139:	85 c0                	test   %eax,%eax
+  80113b:	7f 08                	jg     801145 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  80113d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801140:	5b                   	pop    %ebx
+  801141:	5e                   	pop    %esi
+  801142:	5f                   	pop    %edi
+  801143:	5d                   	pop    %ebp
+  801144:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801145:	83 ec 0c             	sub    $0xc,%esp
+  801148:	50                   	push   %eax
+  801149:	6a 0a                	push   $0xa
+  80114b:	68 63 35 80 00       	push   $0x803563
+  801150:	6a 23                	push   $0x23
+  801152:	68 80 35 80 00       	push   $0x803580
+  801157:	e8 51 f2 ff ff       	call   8003ad <_panic>
+
+0080115c <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  80115c:	55                   	push   %ebp
+  80115d:	89 e5                	mov    %esp,%ebp
+  80115f:	57                   	push   %edi
+  801160:	56                   	push   %esi
+  801161:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801162:	8b 55 08             	mov    0x8(%ebp),%edx
+  801165:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801168:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80116d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801170:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801173:	8b 75 18             	mov    0x18(%ebp),%esi
+  801176:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  801178:	5b                   	pop    %ebx
+  801179:	5e                   	pop    %esi
+  80117a:	5f                   	pop    %edi
+  80117b:	5d                   	pop    %ebp
+  80117c:	c3                   	ret
+
+0080117d <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  80117d:	55                   	push   %ebp
+  80117e:	89 e5                	mov    %esp,%ebp
+  801180:	57                   	push   %edi
+  801181:	56                   	push   %esi
+  801182:	53                   	push   %ebx
+  801183:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801186:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80118b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80118e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801191:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801196:	89 df                	mov    %ebx,%edi
+  801198:	89 de                	mov    %ebx,%esi
+  80119a:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80119c:	85 c0                	test   %eax,%eax
+  80119e:	7f 08                	jg     8011a8 <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  8011a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011a3:	5b                   	pop    %ebx
+  8011a4:	5e                   	pop    %esi
+  8011a5:	5f                   	pop    %edi
+  8011a6:	5d                   	pop    %ebp
+  8011a7:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8011a8:	83 ec 0c             	sub    $0xc,%esp
+  8011ab:	50                   	push   %eax
+  8011ac:	6a 0d                	push   $0xd
+  8011ae:	68 63 35 80 00       	push   $0x803563
+  8011b3:	6a 23                	push   $0x23
+  8011b5:	68 80 35 80 00       	push   $0x803580
+  8011ba:	e8 ee f1 ff ff       	call   8003ad <_panic>
+
+008011bf <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  8011bf:	55                   	push   %ebp
+  8011c0:	89 e5                	mov    %esp,%ebp
+  8011c2:	57                   	push   %edi
+  8011c3:	56                   	push   %esi
+  8011c4:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8011c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011ca:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011cf:	89 d1                	mov    %edx,%ecx
+  8011d1:	89 d3                	mov    %edx,%ebx
+  8011d3:	89 d7                	mov    %edx,%edi
+  8011d5:	89 d6                	mov    %edx,%esi
+  8011d7:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8011d9:	5b                   	pop    %ebx
+  8011da:	5e                   	pop    %esi
+  8011db:	5f                   	pop    %edi
+  8011dc:	5d                   	pop    %ebp
+  8011dd:	c3                   	ret
+
+008011de <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  8011de:	55                   	push   %ebp
+  8011df:	89 e5                	mov    %esp,%ebp
+  8011e1:	57                   	push   %edi
+  8011e2:	56                   	push   %esi
+  8011e3:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8011e4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011e7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ea:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8011ef:	be 00 00 00 00       	mov    $0x0,%esi
+  8011f4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011f7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011fa:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  8011fc:	5b                   	pop    %ebx
+  8011fd:	5e                   	pop    %esi
+  8011fe:	5f                   	pop    %edi
+  8011ff:	5d                   	pop    %ebp
+  801200:	c3                   	ret
+
+00801201 <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  801201:	55                   	push   %ebp
+  801202:	89 e5                	mov    %esp,%ebp
+  801204:	57                   	push   %edi
+  801205:	56                   	push   %esi
+  801206:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801207:	be 00 00 00 00       	mov    $0x0,%esi
+  80120c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80120f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801212:	b8 10 00 00 00       	mov    $0x10,%eax
+  801217:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80121a:	89 f7                	mov    %esi,%edi
+  80121c:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  80121e:	5b                   	pop    %ebx
+  80121f:	5e                   	pop    %esi
+  801220:	5f                   	pop    %edi
+  801221:	5d                   	pop    %ebp
+  801222:	c3                   	ret
+
+00801223 <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  801223:	55                   	push   %ebp
+  801224:	89 e5                	mov    %esp,%ebp
+  801226:	57                   	push   %edi
+  801227:	56                   	push   %esi
+  801228:	53                   	push   %ebx
+  801229:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  80122c:	80 3d 48 87 80 00 00 	cmpb   $0x0,0x808748
+  801233:	74 41                	je     801276 <sys_batch+0x53>
+  801235:	8b 45 08             	mov    0x8(%ebp),%eax
+  801238:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  80123b:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  801242:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801245:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  801248:	7d 45                	jge    80128f <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  80124a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80124d:	8b 06                	mov    (%esi),%eax
+  80124f:	8b 56 04             	mov    0x4(%esi),%edx
+  801252:	8b 4e 08             	mov    0x8(%esi),%ecx
+  801255:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  801258:	8b 7e 10             	mov    0x10(%esi),%edi
+  80125b:	8b 76 14             	mov    0x14(%esi),%esi
+  80125e:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  801260:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801263:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  801266:	83 c6 1c             	add    $0x1c,%esi
+  801269:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  80126c:	85 c0                	test   %eax,%eax
+  80126e:	78 1f                	js     80128f <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  801270:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  801274:	eb cc                	jmp    801242 <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  801276:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80127b:	b8 13 00 00 00       	mov    $0x13,%eax
+  801280:	8b 55 08             	mov    0x8(%ebp),%edx
+  801283:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801286:	89 df                	mov    %ebx,%edi
+  801288:	89 de                	mov    %ebx,%esi
+  80128a:	cd 30                	int    $0x30
+  80128c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  80128f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801292:	83 c4 08             	add    $0x8,%esp
+  801295:	5b                   	pop    %ebx
+  801296:	5e                   	pop    %esi
+  801297:	5f                   	pop    %edi
+  801298:	5d                   	pop    %ebp
+  801299:	c3                   	ret
+
+0080129a <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  80129a:	55                   	push   %ebp
+  80129b:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  80129d:	8b 45 08             	mov    0x8(%ebp),%eax
+  8012a0:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8012a6:	5d                   	pop    %ebp
+  8012a7:	c3                   	ret
+
+008012a8 <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  8012a8:	55                   	push   %ebp
+  8012a9:	89 e5                	mov    %esp,%ebp
+  8012ab:	56                   	push   %esi
+  8012ac:	53                   	push   %ebx
+  8012ad:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  8012b0:	8b 1e                	mov    (%esi),%ebx
+  8012b2:	85 db                	test   %ebx,%ebx
+  8012b4:	75 09                	jne    8012bf <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  8012b6:	89 d8                	mov    %ebx,%eax
+  8012b8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8012bb:	5b                   	pop    %ebx
+  8012bc:	5e                   	pop    %esi
+  8012bd:	5d                   	pop    %ebp
+  8012be:	c3                   	ret
+  b->sb_n = 0;
+  8012bf:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  8012c5:	53                   	push   %ebx
+  8012c6:	8d 46 04             	lea    0x4(%esi),%eax
+  8012c9:	50                   	push   %eax
+  8012ca:	e8 54 ff ff ff       	call   801223 <sys_batch>
+  8012cf:	83 c4 08             	add    $0x8,%esp
+  8012d2:	85 c0                	test   %eax,%eax
+  8012d4:	78 1e                	js     8012f4 <sysbatch_flush+0x4c>
+  if (r < n)
+  8012d6:	39 c3                	cmp    %eax,%ebx
+  8012d8:	7f 07                	jg     8012e1 <sysbatch_flush+0x39>
+  return 0;
+  8012da:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012df:	eb d5                	jmp    8012b6 <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  8012e1:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8012e4:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  8012e8:	85 db                	test   %ebx,%ebx
+  8012ea:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012ef:	0f 49 d8             	cmovns %eax,%ebx
+  8012f2:	eb c2                	jmp    8012b6 <sysbatch_flush+0xe>
+    return r;
+  8012f4:	89 c3                	mov    %eax,%ebx
+  8012f6:	eb be                	jmp    8012b6 <sysbatch_flush+0xe>
+
+008012f8 <sysbatch_add>:
+{
+  8012f8:	55                   	push   %ebp
+  8012f9:	89 e5                	mov    %esp,%ebp
+  8012fb:	53                   	push   %ebx
+  8012fc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  8012ff:	83 3b 40             	cmpl   $0x40,(%ebx)
+  801302:	74 41                	je     801345 <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  801304:	8b 03                	mov    (%ebx),%eax
+  801306:	8d 50 01             	lea    0x1(%eax),%edx
+  801309:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  80130b:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80130e:	01 d8                	add    %ebx,%eax
+  801310:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801313:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  801316:	8b 55 10             	mov    0x10(%ebp),%edx
+  801319:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  80131c:	8b 55 14             	mov    0x14(%ebp),%edx
+  80131f:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  801322:	8b 55 18             	mov    0x18(%ebp),%edx
+  801325:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  801328:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  80132b:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  80132e:	8b 55 20             	mov    0x20(%ebp),%edx
+  801331:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  801334:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  80133b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801340:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801343:	c9                   	leave
+  801344:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  801345:	53                   	push   %ebx
+  801346:	e8 5d ff ff ff       	call   8012a8 <sysbatch_flush>
+  80134b:	83 c4 04             	add    $0x4,%esp
+  80134e:	85 c0                	test   %eax,%eax
+  801350:	79 b2                	jns    801304 <sysbatch_add+0xc>
+  801352:	eb ec                	jmp    801340 <sysbatch_add+0x48>
+
+00801354 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801354:	55                   	push   %ebp
+  801355:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801357:	8b 45 08             	mov    0x8(%ebp),%eax
+  80135a:	05 00 00 00 30       	add    $0x30000000,%eax
+  80135f:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801362:	5d                   	pop    %ebp
+  801363:	c3                   	ret
+
+00801364 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801364:	55                   	push   %ebp
+  801365:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801367:	8b 45 08             	mov    0x8(%ebp),%eax
+  80136a:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  80136d:	66 b8 00 00          	mov    $0x0,%ax
+  801371:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801376:	5d                   	pop    %ebp
+  801377:	c3                   	ret
+
+00801378 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801378:	55                   	push   %ebp
+  801379:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  80137b:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801380:	eb 02                	jmp    801384 <fd_alloc+0xc>
+  801382:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801384:	89 c2                	mov    %eax,%edx
+  801386:	c1 ea 16             	shr    $0x16,%edx
+  801389:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801390:	f6 c2 01             	test   $0x1,%dl
+  801393:	74 2b                	je     8013c0 <fd_alloc+0x48>
+  801395:	89 c2                	mov    %eax,%edx
+  801397:	c1 ea 0c             	shr    $0xc,%edx
+  80139a:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8013a1:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8013a7:	f6 c1 01             	test   $0x1,%cl
+  8013aa:	74 14                	je     8013c0 <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  8013ac:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8013b2:	75 ce                	jne    801382 <fd_alloc+0xa>
+  8013b4:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  8013b9:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8013be:	eb 05                	jmp    8013c5 <fd_alloc+0x4d>
+      return 0;
+  8013c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  8013c5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013c8:	89 02                	mov    %eax,(%edx)
+}
+  8013ca:	89 c8                	mov    %ecx,%eax
+  8013cc:	5d                   	pop    %ebp
+  8013cd:	c3                   	ret
+
+008013ce <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8013ce:	55                   	push   %ebp
+  8013cf:	89 e5                	mov    %esp,%ebp
+  8013d1:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  8013d4:	83 f8 1f             	cmp    $0x1f,%eax
+  8013d7:	77 30                	ja     801409 <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  8013d9:	c1 e0 0c             	shl    $0xc,%eax
+  8013dc:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8013e1:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8013e7:	f6 c2 01             	test   $0x1,%dl
+  8013ea:	74 24                	je     801410 <fd_lookup+0x42>
+  8013ec:	89 c2                	mov    %eax,%edx
+  8013ee:	c1 ea 0c             	shr    $0xc,%edx
+  8013f1:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8013f8:	f6 c2 01             	test   $0x1,%dl
+  8013fb:	74 1a                	je     801417 <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  8013fd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801400:	89 02                	mov    %eax,(%edx)
+  return 0;
+  801402:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801407:	5d                   	pop    %ebp
+  801408:	c3                   	ret
+    return -E_INVAL;
+  801409:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80140e:	eb f7                	jmp    801407 <fd_lookup+0x39>
+    return -E_INVAL;
+  801410:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801415:	eb f0                	jmp    801407 <fd_lookup+0x39>
+  801417:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80141c:	eb e9                	jmp    801407 <fd_lookup+0x39>
+
+0080141e <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80141e:	55                   	push   %ebp
+  80141f:	89 e5                	mov    %esp,%ebp
+  801421:	53                   	push   %ebx
+  801422:	83 ec 04             	sub    $0x4,%esp
+  801425:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  801428:	b8 0c 36 80 00       	mov    $0x80360c,%eax
+  80142d:	8b 18                	mov    (%eax),%ebx
+  80142f:	85 db                	test   %ebx,%ebx
+  801431:	74 0e                	je     801441 <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  801433:	83 c0 04             	add    $0x4,%eax
+  801436:	39 13                	cmp    %edx,(%ebx)
+  801438:	75 f3                	jne    80142d <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  80143a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80143f:	eb 1f                	jmp    801460 <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801441:	a1 44 87 80 00       	mov    0x808744,%eax
+  801446:	8b 40 48             	mov    0x48(%eax),%eax
+  801449:	83 ec 04             	sub    $0x4,%esp
+  80144c:	52                   	push   %edx
+  80144d:	50                   	push   %eax
+  80144e:	68 90 35 80 00       	push   $0x803590
+  801453:	e8 30 f0 ff ff       	call   800488 <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  801458:	83 c4 10             	add    $0x10,%esp
+  80145b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  801460:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801463:	89 1a                	mov    %ebx,(%edx)
+}
+  801465:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801468:	c9                   	leave
+  801469:	c3                   	ret
+
+0080146a <fd_close>:
+{
+  80146a:	55                   	push   %ebp
+  80146b:	89 e5                	mov    %esp,%ebp
+  80146d:	57                   	push   %edi
+  80146e:	56                   	push   %esi
+  80146f:	53                   	push   %ebx
+  801470:	83 ec 24             	sub    $0x24,%esp
+  801473:	8b 75 08             	mov    0x8(%ebp),%esi
+  801476:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801479:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80147c:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80147d:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801483:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801486:	50                   	push   %eax
+  801487:	e8 42 ff ff ff       	call   8013ce <fd_lookup>
+  80148c:	89 c3                	mov    %eax,%ebx
+  80148e:	83 c4 10             	add    $0x10,%esp
+  801491:	85 c0                	test   %eax,%eax
+  801493:	78 05                	js     80149a <fd_close+0x30>
+      || fd != fd2)
+  801495:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801498:	74 16                	je     8014b0 <fd_close+0x46>
+    return must_exist ? r : 0;
+  80149a:	89 f8                	mov    %edi,%eax
+  80149c:	84 c0                	test   %al,%al
+  80149e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014a3:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8014a6:	89 d8                	mov    %ebx,%eax
+  8014a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014ab:	5b                   	pop    %ebx
+  8014ac:	5e                   	pop    %esi
+  8014ad:	5f                   	pop    %edi
+  8014ae:	5d                   	pop    %ebp
+  8014af:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8014b0:	83 ec 08             	sub    $0x8,%esp
+  8014b3:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8014b6:	50                   	push   %eax
+  8014b7:	ff 36                	push   (%esi)
+  8014b9:	e8 60 ff ff ff       	call   80141e <dev_lookup>
+  8014be:	89 c3                	mov    %eax,%ebx
+  8014c0:	83 c4 10             	add    $0x10,%esp
+  8014c3:	85 c0                	test   %eax,%eax
+  8014c5:	78 1a                	js     8014e1 <fd_close+0x77>
+    if (dev->dev_close)
+  8014c7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8014ca:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  8014cd:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  8014d2:	85 c0                	test   %eax,%eax
+  8014d4:	74 0b                	je     8014e1 <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  8014d6:	83 ec 0c             	sub    $0xc,%esp
+  8014d9:	56                   	push   %esi
+  8014da:	ff d0                	call   *%eax
+  8014dc:	89 c3                	mov    %eax,%ebx
+  8014de:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  8014e1:	83 ec 08             	sub    $0x8,%esp
+  8014e4:	56                   	push   %esi
+  8014e5:	6a 00                	push   $0x0
+  8014e7:	e8 3e fa ff ff       	call   800f2a <sys_page_unmap>
+  return r;
+  8014ec:	83 c4 10             	add    $0x10,%esp
+  8014ef:	eb b5                	jmp    8014a6 <fd_close+0x3c>
+
+008014f1 <close>:
+
+int
+close(int fdnum)
+{
+  8014f1:	55                   	push   %ebp
+  8014f2:	89 e5                	mov    %esp,%ebp
+  8014f4:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8014f7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014fa:	50                   	push   %eax
+  8014fb:	ff 75 08             	push   0x8(%ebp)
+  8014fe:	e8 cb fe ff ff       	call   8013ce <fd_lookup>
+  801503:	83 c4 10             	add    $0x10,%esp
+  801506:	85 c0                	test   %eax,%eax
+  801508:	79 02                	jns    80150c <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  80150a:	c9                   	leave
+  80150b:	c3                   	ret
+    return fd_close(fd, 1);
+  80150c:	83 ec 08             	sub    $0x8,%esp
+  80150f:	6a 01                	push   $0x1
+  801511:	ff 75 f4             	push   -0xc(%ebp)
+  801514:	e8 51 ff ff ff       	call   80146a <fd_close>
+  801519:	83 c4 10             	add    $0x10,%esp
+  80151c:	eb ec                	jmp    80150a <close+0x19>
+
+0080151e <close_all>:
+
+void
+close_all(void)
+{
+  80151e:	55                   	push   %ebp
+  80151f:	89 e5                	mov    %esp,%ebp
+  801521:	53                   	push   %ebx
+  801522:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  801525:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  80152a:	83 ec 0c             	sub    $0xc,%esp
+  80152d:	53                   	push   %ebx
+  80152e:	e8 be ff ff ff       	call   8014f1 <close>
+  for (i = 0; i < MAXFD; i++)
+  801533:	83 c3 01             	add    $0x1,%ebx
+  801536:	83 c4 10             	add    $0x10,%esp
+  801539:	83 fb 20             	cmp    $0x20,%ebx
+  80153c:	75 ec                	jne    80152a <close_all+0xc>
+}
+  80153e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801541:	c9                   	leave
+  801542:	c3                   	ret
+
+00801543 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801543:	55                   	push   %ebp
+  801544:	89 e5                	mov    %esp,%ebp
+  801546:	57                   	push   %edi
+  801547:	56                   	push   %esi
+  801548:	53                   	push   %ebx
+  801549:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80154c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80154f:	50                   	push   %eax
+  801550:	ff 75 08             	push   0x8(%ebp)
+  801553:	e8 76 fe ff ff       	call   8013ce <fd_lookup>
+  801558:	89 c6                	mov    %eax,%esi
+  80155a:	83 c4 10             	add    $0x10,%esp
+  80155d:	85 c0                	test   %eax,%eax
+  80155f:	0f 88 0a 01 00 00    	js     80166f <dup+0x12c>
+    return r;
+  close(newfdnum);
+  801565:	83 ec 0c             	sub    $0xc,%esp
+  801568:	ff 75 0c             	push   0xc(%ebp)
+  80156b:	e8 81 ff ff ff       	call   8014f1 <close>
+
+  newfd = INDEX2FD(newfdnum);
+  801570:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801573:	c1 e0 0c             	shl    $0xc,%eax
+  801576:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  80157c:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  80157f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801582:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  801585:	89 04 24             	mov    %eax,(%esp)
+  801588:	e8 d7 fd ff ff       	call   801364 <fd2data>
+  80158d:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  80158f:	89 3c 24             	mov    %edi,(%esp)
+  801592:	e8 cd fd ff ff       	call   801364 <fd2data>
+  801597:	83 c4 10             	add    $0x10,%esp
+  80159a:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80159d:	89 f3                	mov    %esi,%ebx
+  80159f:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  8015a5:	89 c6                	mov    %eax,%esi
+  8015a7:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8015aa:	89 cf                	mov    %ecx,%edi
+  8015ac:	eb 0c                	jmp    8015ba <dup+0x77>
+  8015ae:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8015b4:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8015ba:	39 fb                	cmp    %edi,%ebx
+  8015bc:	74 7b                	je     801639 <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  8015be:	89 d8                	mov    %ebx,%eax
+  8015c0:	c1 e8 16             	shr    $0x16,%eax
+  8015c3:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8015ca:	a8 01                	test   $0x1,%al
+  8015cc:	74 e0                	je     8015ae <dup+0x6b>
+  8015ce:	89 d8                	mov    %ebx,%eax
+  8015d0:	c1 e8 0c             	shr    $0xc,%eax
+  8015d3:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8015da:	f6 c2 01             	test   $0x1,%dl
+  8015dd:	74 cf                	je     8015ae <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  8015df:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  8015e6:	83 ec 0c             	sub    $0xc,%esp
+  8015e9:	25 07 0e 00 00       	and    $0xe07,%eax
+  8015ee:	50                   	push   %eax
+  8015ef:	56                   	push   %esi
+  8015f0:	6a 00                	push   $0x0
+  8015f2:	53                   	push   %ebx
+  8015f3:	6a 00                	push   $0x0
+  8015f5:	e8 ee f8 ff ff       	call   800ee8 <sys_page_map>
+  8015fa:	83 c4 20             	add    $0x20,%esp
+  8015fd:	85 c0                	test   %eax,%eax
+  8015ff:	79 ad                	jns    8015ae <dup+0x6b>
+  801601:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801604:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  801606:	83 ec 08             	sub    $0x8,%esp
+  801609:	ff 75 d4             	push   -0x2c(%ebp)
+  80160c:	6a 00                	push   $0x0
+  80160e:	e8 17 f9 ff ff       	call   800f2a <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801613:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  801616:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  80161c:	83 c4 10             	add    $0x10,%esp
+  80161f:	39 df                	cmp    %ebx,%edi
+  801621:	74 4c                	je     80166f <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  801623:	83 ec 08             	sub    $0x8,%esp
+  801626:	57                   	push   %edi
+  801627:	6a 00                	push   $0x0
+  801629:	e8 fc f8 ff ff       	call   800f2a <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80162e:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  801634:	83 c4 10             	add    $0x10,%esp
+  801637:	eb e6                	jmp    80161f <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801639:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80163c:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80163f:	89 c8                	mov    %ecx,%eax
+  801641:	c1 e8 0c             	shr    $0xc,%eax
+  801644:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80164b:	83 ec 0c             	sub    $0xc,%esp
+  80164e:	25 07 0e 00 00       	and    $0xe07,%eax
+  801653:	50                   	push   %eax
+  801654:	ff 75 d4             	push   -0x2c(%ebp)
+  801657:	6a 00                	push   $0x0
+  801659:	51                   	push   %ecx
+  80165a:	6a 00                	push   $0x0
+  80165c:	e8 87 f8 ff ff       	call   800ee8 <sys_page_map>
+  801661:	89 c6                	mov    %eax,%esi
+  801663:	83 c4 20             	add    $0x20,%esp
+  801666:	85 c0                	test   %eax,%eax
+  801668:	78 9c                	js     801606 <dup+0xc3>
+  return newfdnum;
+  80166a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80166d:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  80166f:	89 f0                	mov    %esi,%eax
+  801671:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801674:	5b                   	pop    %ebx
+  801675:	5e                   	pop    %esi
+  801676:	5f                   	pop    %edi
+  801677:	5d                   	pop    %ebp
+  801678:	c3                   	ret
+
+00801679 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801679:	55                   	push   %ebp
+  80167a:	89 e5                	mov    %esp,%ebp
+  80167c:	56                   	push   %esi
+  80167d:	53                   	push   %ebx
+  80167e:	83 ec 18             	sub    $0x18,%esp
+  801681:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801684:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801687:	50                   	push   %eax
+  801688:	56                   	push   %esi
+  801689:	e8 40 fd ff ff       	call   8013ce <fd_lookup>
+  80168e:	83 c4 10             	add    $0x10,%esp
+  801691:	85 c0                	test   %eax,%eax
+  801693:	78 3c                	js     8016d1 <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801695:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801698:	83 ec 08             	sub    $0x8,%esp
+  80169b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80169e:	50                   	push   %eax
+  80169f:	ff 33                	push   (%ebx)
+  8016a1:	e8 78 fd ff ff       	call   80141e <dev_lookup>
+  8016a6:	83 c4 10             	add    $0x10,%esp
+  8016a9:	85 c0                	test   %eax,%eax
+  8016ab:	78 24                	js     8016d1 <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8016ad:	8b 43 08             	mov    0x8(%ebx),%eax
+  8016b0:	83 e0 03             	and    $0x3,%eax
+  8016b3:	83 f8 01             	cmp    $0x1,%eax
+  8016b6:	74 20                	je     8016d8 <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  8016b8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016bb:	8b 40 08             	mov    0x8(%eax),%eax
+  8016be:	85 c0                	test   %eax,%eax
+  8016c0:	74 37                	je     8016f9 <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  8016c2:	83 ec 04             	sub    $0x4,%esp
+  8016c5:	ff 75 10             	push   0x10(%ebp)
+  8016c8:	ff 75 0c             	push   0xc(%ebp)
+  8016cb:	53                   	push   %ebx
+  8016cc:	ff d0                	call   *%eax
+  8016ce:	83 c4 10             	add    $0x10,%esp
+}
+  8016d1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016d4:	5b                   	pop    %ebx
+  8016d5:	5e                   	pop    %esi
+  8016d6:	5d                   	pop    %ebp
+  8016d7:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8016d8:	a1 44 87 80 00       	mov    0x808744,%eax
+  8016dd:	8b 40 48             	mov    0x48(%eax),%eax
+  8016e0:	83 ec 04             	sub    $0x4,%esp
+  8016e3:	56                   	push   %esi
+  8016e4:	50                   	push   %eax
+  8016e5:	68 d1 35 80 00       	push   $0x8035d1
+  8016ea:	e8 99 ed ff ff       	call   800488 <cprintf>
+    return -E_INVAL;
+  8016ef:	83 c4 10             	add    $0x10,%esp
+  8016f2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016f7:	eb d8                	jmp    8016d1 <read+0x58>
+    return -E_NOT_SUPP;
+  8016f9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016fe:	eb d1                	jmp    8016d1 <read+0x58>
+
+00801700 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801700:	55                   	push   %ebp
+  801701:	89 e5                	mov    %esp,%ebp
+  801703:	57                   	push   %edi
+  801704:	56                   	push   %esi
+  801705:	53                   	push   %ebx
+  801706:	83 ec 0c             	sub    $0xc,%esp
+  801709:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80170c:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  80170f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801714:	eb 02                	jmp    801718 <readn+0x18>
+  801716:	01 c3                	add    %eax,%ebx
+  801718:	39 f3                	cmp    %esi,%ebx
+  80171a:	73 21                	jae    80173d <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  80171c:	83 ec 04             	sub    $0x4,%esp
+  80171f:	89 f0                	mov    %esi,%eax
+  801721:	29 d8                	sub    %ebx,%eax
+  801723:	50                   	push   %eax
+  801724:	89 d8                	mov    %ebx,%eax
+  801726:	03 45 0c             	add    0xc(%ebp),%eax
+  801729:	50                   	push   %eax
+  80172a:	57                   	push   %edi
+  80172b:	e8 49 ff ff ff       	call   801679 <read>
+    if (m < 0)
+  801730:	83 c4 10             	add    $0x10,%esp
+  801733:	85 c0                	test   %eax,%eax
+  801735:	78 04                	js     80173b <readn+0x3b>
+      return m;
+    if (m == 0)
+  801737:	75 dd                	jne    801716 <readn+0x16>
+  801739:	eb 02                	jmp    80173d <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  80173b:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  80173d:	89 d8                	mov    %ebx,%eax
+  80173f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801742:	5b                   	pop    %ebx
+  801743:	5e                   	pop    %esi
+  801744:	5f                   	pop    %edi
+  801745:	5d                   	pop    %ebp
+  801746:	c3                   	ret
+
+00801747 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801747:	55                   	push   %ebp
+  801748:	89 e5                	mov    %esp,%ebp
+  80174a:	56                   	push   %esi
+  80174b:	53                   	push   %ebx
+  80174c:	83 ec 18             	sub    $0x18,%esp
+  80174f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801752:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801755:	50                   	push   %eax
+  801756:	53                   	push   %ebx
+  801757:	e8 72 fc ff ff       	call   8013ce <fd_lookup>
+  80175c:	83 c4 10             	add    $0x10,%esp
+  80175f:	85 c0                	test   %eax,%eax
+  801761:	78 37                	js     80179a <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801763:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801766:	83 ec 08             	sub    $0x8,%esp
+  801769:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80176c:	50                   	push   %eax
+  80176d:	ff 36                	push   (%esi)
+  80176f:	e8 aa fc ff ff       	call   80141e <dev_lookup>
+  801774:	83 c4 10             	add    $0x10,%esp
+  801777:	85 c0                	test   %eax,%eax
+  801779:	78 1f                	js     80179a <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80177b:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80177f:	74 20                	je     8017a1 <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  801781:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801784:	8b 40 0c             	mov    0xc(%eax),%eax
+  801787:	85 c0                	test   %eax,%eax
+  801789:	74 37                	je     8017c2 <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  80178b:	83 ec 04             	sub    $0x4,%esp
+  80178e:	ff 75 10             	push   0x10(%ebp)
+  801791:	ff 75 0c             	push   0xc(%ebp)
+  801794:	56                   	push   %esi
+  801795:	ff d0                	call   *%eax
+  801797:	83 c4 10             	add    $0x10,%esp
+}
+  80179a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80179d:	5b                   	pop    %ebx
+  80179e:	5e                   	pop    %esi
+  80179f:	5d                   	pop    %ebp
+  8017a0:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8017a1:	a1 44 87 80 00       	mov    0x808744,%eax
+  8017a6:	8b 40 48             	mov    0x48(%eax),%eax
+  8017a9:	83 ec 04             	sub    $0x4,%esp
+  8017ac:	53                   	push   %ebx
+  8017ad:	50                   	push   %eax
+  8017ae:	68 ed 35 80 00       	push   $0x8035ed
+  8017b3:	e8 d0 ec ff ff       	call   800488 <cprintf>
+    return -E_INVAL;
+  8017b8:	83 c4 10             	add    $0x10,%esp
+  8017bb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017c0:	eb d8                	jmp    80179a <write+0x53>
+    return -E_NOT_SUPP;
+  8017c2:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017c7:	eb d1                	jmp    80179a <write+0x53>
+
+008017c9 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8017c9:	55                   	push   %ebp
+  8017ca:	89 e5                	mov    %esp,%ebp
+  8017cc:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8017cf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017d2:	50                   	push   %eax
+  8017d3:	ff 75 08             	push   0x8(%ebp)
+  8017d6:	e8 f3 fb ff ff       	call   8013ce <fd_lookup>
+  8017db:	83 c4 10             	add    $0x10,%esp
+  8017de:	85 c0                	test   %eax,%eax
+  8017e0:	78 0e                	js     8017f0 <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  8017e2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8017e5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017e8:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  8017eb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017f0:	c9                   	leave
+  8017f1:	c3                   	ret
+
+008017f2 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8017f2:	55                   	push   %ebp
+  8017f3:	89 e5                	mov    %esp,%ebp
+  8017f5:	56                   	push   %esi
+  8017f6:	53                   	push   %ebx
+  8017f7:	83 ec 18             	sub    $0x18,%esp
+  8017fa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017fd:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801800:	50                   	push   %eax
+  801801:	53                   	push   %ebx
+  801802:	e8 c7 fb ff ff       	call   8013ce <fd_lookup>
+  801807:	83 c4 10             	add    $0x10,%esp
+  80180a:	85 c0                	test   %eax,%eax
+  80180c:	78 34                	js     801842 <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80180e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801811:	83 ec 08             	sub    $0x8,%esp
+  801814:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801817:	50                   	push   %eax
+  801818:	ff 36                	push   (%esi)
+  80181a:	e8 ff fb ff ff       	call   80141e <dev_lookup>
+  80181f:	83 c4 10             	add    $0x10,%esp
+  801822:	85 c0                	test   %eax,%eax
+  801824:	78 1c                	js     801842 <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801826:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80182a:	74 1d                	je     801849 <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  80182c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80182f:	8b 40 18             	mov    0x18(%eax),%eax
+  801832:	85 c0                	test   %eax,%eax
+  801834:	74 34                	je     80186a <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  801836:	83 ec 08             	sub    $0x8,%esp
+  801839:	ff 75 0c             	push   0xc(%ebp)
+  80183c:	56                   	push   %esi
+  80183d:	ff d0                	call   *%eax
+  80183f:	83 c4 10             	add    $0x10,%esp
+}
+  801842:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801845:	5b                   	pop    %ebx
+  801846:	5e                   	pop    %esi
+  801847:	5d                   	pop    %ebp
+  801848:	c3                   	ret
+            thisenv->env_id, fdnum);
+  801849:	a1 44 87 80 00       	mov    0x808744,%eax
+  80184e:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801851:	83 ec 04             	sub    $0x4,%esp
+  801854:	53                   	push   %ebx
+  801855:	50                   	push   %eax
+  801856:	68 b0 35 80 00       	push   $0x8035b0
+  80185b:	e8 28 ec ff ff       	call   800488 <cprintf>
+    return -E_INVAL;
+  801860:	83 c4 10             	add    $0x10,%esp
+  801863:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801868:	eb d8                	jmp    801842 <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  80186a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80186f:	eb d1                	jmp    801842 <ftruncate+0x50>
+
+00801871 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801871:	55                   	push   %ebp
+  801872:	89 e5                	mov    %esp,%ebp
+  801874:	56                   	push   %esi
+  801875:	53                   	push   %ebx
+  801876:	83 ec 18             	sub    $0x18,%esp
+  801879:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  80187c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80187f:	50                   	push   %eax
+  801880:	ff 75 08             	push   0x8(%ebp)
+  801883:	e8 46 fb ff ff       	call   8013ce <fd_lookup>
+  801888:	83 c4 10             	add    $0x10,%esp
+  80188b:	85 c0                	test   %eax,%eax
+  80188d:	78 49                	js     8018d8 <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80188f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801892:	83 ec 08             	sub    $0x8,%esp
+  801895:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801898:	50                   	push   %eax
+  801899:	ff 36                	push   (%esi)
+  80189b:	e8 7e fb ff ff       	call   80141e <dev_lookup>
+  8018a0:	83 c4 10             	add    $0x10,%esp
+  8018a3:	85 c0                	test   %eax,%eax
+  8018a5:	78 31                	js     8018d8 <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  8018a7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018aa:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8018ae:	74 2f                	je     8018df <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  8018b0:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  8018b3:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8018ba:	00 00 00 
+  stat->st_isdir = 0;
+  8018bd:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8018c4:	00 00 00 
+  stat->st_dev = dev;
+  8018c7:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  8018cd:	83 ec 08             	sub    $0x8,%esp
+  8018d0:	53                   	push   %ebx
+  8018d1:	56                   	push   %esi
+  8018d2:	ff 50 14             	call   *0x14(%eax)
+  8018d5:	83 c4 10             	add    $0x10,%esp
+}
+  8018d8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018db:	5b                   	pop    %ebx
+  8018dc:	5e                   	pop    %esi
+  8018dd:	5d                   	pop    %ebp
+  8018de:	c3                   	ret
+    return -E_NOT_SUPP;
+  8018df:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8018e4:	eb f2                	jmp    8018d8 <fstat+0x67>
+
+008018e6 <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  8018e6:	55                   	push   %ebp
+  8018e7:	89 e5                	mov    %esp,%ebp
+  8018e9:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  8018ec:	ff 75 0c             	push   0xc(%ebp)
+  8018ef:	ff 75 08             	push   0x8(%ebp)
+  8018f2:	e8 58 07 00 00       	call   80204f <file_stat>
+}
+  8018f7:	c9                   	leave
+  8018f8:	c3                   	ret
+
+008018f9 <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  8018f9:	55                   	push   %ebp
+  8018fa:	89 e5                	mov    %esp,%ebp
+  8018fc:	57                   	push   %edi
+  8018fd:	56                   	push   %esi
+  8018fe:	53                   	push   %ebx
+  8018ff:	83 ec 1c             	sub    $0x1c,%esp
+  801902:	89 c7                	mov    %eax,%edi
+  801904:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801907:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80190a:	e9 a2 00 00 00       	jmp    8019b1 <fsipc_send+0xb8>
+  nfsenvs = 0;
+  80190f:	c7 05 00 80 80 00 00 	movl   $0x0,0x808000
+  801916:	00 00 00 
+  801919:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80191e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801923:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801928:	be 01 00 00 00       	mov    $0x1,%esi
+  80192d:	eb 0f                	jmp    80193e <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  80192f:	83 c0 01             	add    $0x1,%eax
+  801932:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801937:	74 49                	je     801982 <fsipc_send+0x89>
+  801939:	83 f9 07             	cmp    $0x7,%ecx
+  80193c:	7f 50                	jg     80198e <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  80193e:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801941:	c1 e2 04             	shl    $0x4,%edx
+  801944:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80194a:	8b 52 50             	mov    0x50(%edx),%edx
+  80194d:	83 fa 01             	cmp    $0x1,%edx
+  801950:	75 dd                	jne    80192f <fsipc_send+0x36>
+  801952:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801955:	c1 e2 04             	shl    $0x4,%edx
+  801958:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80195e:	8b 52 54             	mov    0x54(%edx),%edx
+  801961:	85 d2                	test   %edx,%edx
+  801963:	74 ca                	je     80192f <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801965:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801968:	c1 e2 04             	shl    $0x4,%edx
+  80196b:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801971:	8b 52 48             	mov    0x48(%edx),%edx
+  801974:	89 14 8d 20 80 80 00 	mov    %edx,0x808020(,%ecx,4)
+  80197b:	8d 49 01             	lea    0x1(%ecx),%ecx
+  80197e:	89 f3                	mov    %esi,%ebx
+  801980:	eb ad                	jmp    80192f <fsipc_send+0x36>
+  801982:	84 db                	test   %bl,%bl
+  801984:	74 38                	je     8019be <fsipc_send+0xc5>
+  801986:	89 0d 00 80 80 00    	mov    %ecx,0x808000
+  80198c:	eb 30                	jmp    8019be <fsipc_send+0xc5>
+  80198e:	84 db                	test   %bl,%bl
+  801990:	74 2c                	je     8019be <fsipc_send+0xc5>
+  801992:	89 0d 00 80 80 00    	mov    %ecx,0x808000
+  801998:	eb 24                	jmp    8019be <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  80199a:	50                   	push   %eax
+  80199b:	68 1c 36 80 00       	push   $0x80361c
+  8019a0:	6a 34                	push   $0x34
+  8019a2:	68 26 36 80 00       	push   $0x803626
+  8019a7:	e8 01 ea ff ff       	call   8003ad <_panic>
+    }
+    sys_yield();
+  8019ac:	e8 92 f4 ff ff       	call   800e43 <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  8019b1:	83 3d 00 80 80 00 03 	cmpl   $0x3,0x808000
+  8019b8:	0f 8e 51 ff ff ff    	jle    80190f <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  8019be:	a1 44 87 80 00       	mov    0x808744,%eax
+  8019c3:	8b 70 48             	mov    0x48(%eax),%esi
+  8019c6:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  8019cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019d1:	8b 0d 00 80 80 00    	mov    0x808000,%ecx
+  8019d7:	39 d9                	cmp    %ebx,%ecx
+  8019d9:	7e d1                	jle    8019ac <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  8019db:	83 ec 0c             	sub    $0xc,%esp
+  8019de:	ff 75 e0             	push   -0x20(%ebp)
+  8019e1:	6a 07                	push   $0x7
+  8019e3:	ff 75 e4             	push   -0x1c(%ebp)
+  8019e6:	57                   	push   %edi
+  8019e7:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  8019ea:	99                   	cltd
+  8019eb:	f7 f9                	idiv   %ecx
+  8019ed:	ff 34 95 20 80 80 00 	push   0x808020(,%edx,4)
+  8019f4:	e8 63 f7 ff ff       	call   80115c <sys_ipc_try_send>
+      if (r == 0)
+  8019f9:	83 c4 20             	add    $0x20,%esp
+  8019fc:	85 c0                	test   %eax,%eax
+  8019fe:	74 0a                	je     801a0a <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  801a00:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801a03:	75 95                	jne    80199a <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  801a05:	83 c3 01             	add    $0x1,%ebx
+  801a08:	eb c7                	jmp    8019d1 <fsipc_send+0xd8>
+  }
+}
+  801a0a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a0d:	5b                   	pop    %ebx
+  801a0e:	5e                   	pop    %esi
+  801a0f:	5f                   	pop    %edi
+  801a10:	5d                   	pop    %ebp
+  801a11:	c3                   	ret
+
+00801a12 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801a12:	55                   	push   %ebp
+  801a13:	89 e5                	mov    %esp,%ebp
+  801a15:	53                   	push   %ebx
+  801a16:	83 ec 14             	sub    $0x14,%esp
+  801a19:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  801a1b:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  801a22:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801a27:	ba 00 90 80 00       	mov    $0x809000,%edx
+  801a2c:	e8 c8 fe ff ff       	call   8018f9 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801a31:	6a 00                	push   $0x0
+  801a33:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a36:	50                   	push   %eax
+  801a37:	53                   	push   %ebx
+  801a38:	6a 00                	push   $0x0
+  801a3a:	e8 26 13 00 00       	call   802d65 <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  801a3f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a42:	c9                   	leave
+  801a43:	c3                   	ret
+
+00801a44 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801a44:	55                   	push   %ebp
+  801a45:	89 e5                	mov    %esp,%ebp
+  801a47:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801a4a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a4d:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a50:	a3 00 90 80 00       	mov    %eax,0x809000
+  fsipcbuf.set_size.req_size = newsize;
+  801a55:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a58:	a3 04 90 80 00       	mov    %eax,0x809004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801a5d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a62:	b8 02 00 00 00       	mov    $0x2,%eax
+  801a67:	e8 a6 ff ff ff       	call   801a12 <fsipc>
+}
+  801a6c:	c9                   	leave
+  801a6d:	c3                   	ret
+
+00801a6e <devfile_flush>:
+{
+  801a6e:	55                   	push   %ebp
+  801a6f:	89 e5                	mov    %esp,%ebp
+  801a71:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801a74:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a77:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a7a:	a3 00 90 80 00       	mov    %eax,0x809000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801a7f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a84:	b8 06 00 00 00       	mov    $0x6,%eax
+  801a89:	e8 84 ff ff ff       	call   801a12 <fsipc>
+}
+  801a8e:	c9                   	leave
+  801a8f:	c3                   	ret
+
+00801a90 <devfile_stat>:
+{
+  801a90:	55                   	push   %ebp
+  801a91:	89 e5                	mov    %esp,%ebp
+  801a93:	53                   	push   %ebx
+  801a94:	83 ec 04             	sub    $0x4,%esp
+  801a97:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801a9a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a9d:	8b 40 0c             	mov    0xc(%eax),%eax
+  801aa0:	a3 00 90 80 00       	mov    %eax,0x809000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801aa5:	ba 00 00 00 00       	mov    $0x0,%edx
+  801aaa:	b8 05 00 00 00       	mov    $0x5,%eax
+  801aaf:	e8 5e ff ff ff       	call   801a12 <fsipc>
+  801ab4:	85 c0                	test   %eax,%eax
+  801ab6:	78 2c                	js     801ae4 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801ab8:	83 ec 08             	sub    $0x8,%esp
+  801abb:	68 00 90 80 00       	push   $0x809000
+  801ac0:	53                   	push   %ebx
+  801ac1:	e8 b0 ef ff ff       	call   800a76 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  801ac6:	a1 80 90 80 00       	mov    0x809080,%eax
+  801acb:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801ad1:	a1 84 90 80 00       	mov    0x809084,%eax
+  801ad6:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801adc:	83 c4 10             	add    $0x10,%esp
+  801adf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ae4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ae7:	c9                   	leave
+  801ae8:	c3                   	ret
+
+00801ae9 <fsv_alloc>:
+{
+  801ae9:	55                   	push   %ebp
+  801aea:	89 e5                	mov    %esp,%ebp
+  801aec:	56                   	push   %esi
+  801aed:	53                   	push   %ebx
+  801aee:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  801af0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801af5:	eb 22                	jmp    801b19 <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  801af7:	83 ec 04             	sub    $0x4,%esp
+  801afa:	6a 00                	push   $0x0
+  801afc:	6a 00                	push   $0x0
+  801afe:	6a 07                	push   $0x7
+  801b00:	50                   	push   %eax
+  801b01:	6a 00                	push   $0x0
+  801b03:	6a 04                	push   $0x4
+  801b05:	68 40 80 80 00       	push   $0x808040
+  801b0a:	e8 e9 f7 ff ff       	call   8012f8 <sysbatch_add>
+  801b0f:	83 c4 20             	add    $0x20,%esp
+  801b12:	85 c0                	test   %eax,%eax
+  801b14:	78 48                	js     801b5e <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  801b16:	83 c3 01             	add    $0x1,%ebx
+  801b19:	39 f3                	cmp    %esi,%ebx
+  801b1b:	74 31                	je     801b4e <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  801b1d:	89 d8                	mov    %ebx,%eax
+  801b1f:	c1 e0 0c             	shl    $0xc,%eax
+  801b22:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801b27:	89 c2                	mov    %eax,%edx
+  801b29:	c1 ea 16             	shr    $0x16,%edx
+  801b2c:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801b33:	f6 c2 01             	test   $0x1,%dl
+  801b36:	74 bf                	je     801af7 <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  801b38:	89 c2                	mov    %eax,%edx
+  801b3a:	c1 ea 0c             	shr    $0xc,%edx
+  801b3d:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801b44:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801b47:	83 fa 03             	cmp    $0x3,%edx
+  801b4a:	75 ab                	jne    801af7 <fsv_alloc+0xe>
+  801b4c:	eb c8                	jmp    801b16 <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  801b4e:	83 ec 0c             	sub    $0xc,%esp
+  801b51:	68 40 80 80 00       	push   $0x808040
+  801b56:	e8 4d f7 ff ff       	call   8012a8 <sysbatch_flush>
+  801b5b:	83 c4 10             	add    $0x10,%esp
+}
+  801b5e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b61:	5b                   	pop    %ebx
+  801b62:	5e                   	pop    %esi
+  801b63:	5d                   	pop    %ebp
+  801b64:	c3                   	ret
+
+00801b65 <devfile_read>:
+{
+  801b65:	55                   	push   %ebp
+  801b66:	89 e5                	mov    %esp,%ebp
+  801b68:	57                   	push   %edi
+  801b69:	56                   	push   %esi
+  801b6a:	53                   	push   %ebx
+  801b6b:	83 ec 3c             	sub    $0x3c,%esp
+  801b6e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  801b71:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  801b77:	77 57                	ja     801bd0 <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801b79:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b7c:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b7f:	a3 00 90 80 00       	mov    %eax,0x809000
+  fsipcbuf.read.req_n = n;
+  801b84:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801b8a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b8f:	b8 03 00 00 00       	mov    $0x3,%eax
+  801b94:	e8 79 fe ff ff       	call   801a12 <fsipc>
+  801b99:	89 c6                	mov    %eax,%esi
+  801b9b:	85 c0                	test   %eax,%eax
+  801b9d:	78 27                	js     801bc6 <devfile_read+0x61>
+  assert(r <= n);
+  801b9f:	39 c3                	cmp    %eax,%ebx
+  801ba1:	0f 82 0e 02 00 00    	jb     801db5 <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  801ba7:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801bac:	0f 8f 1c 02 00 00    	jg     801dce <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801bb2:	83 ec 04             	sub    $0x4,%esp
+  801bb5:	50                   	push   %eax
+  801bb6:	68 00 90 80 00       	push   $0x809000
+  801bbb:	ff 75 0c             	push   0xc(%ebp)
+  801bbe:	e8 39 f0 ff ff       	call   800bfc <memmove>
+  return r;
+  801bc3:	83 c4 10             	add    $0x10,%esp
+}
+  801bc6:	89 f0                	mov    %esi,%eax
+  801bc8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bcb:	5b                   	pop    %ebx
+  801bcc:	5e                   	pop    %esi
+  801bcd:	5f                   	pop    %edi
+  801bce:	5d                   	pop    %ebp
+  801bcf:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  801bd0:	b8 01 00 00 00       	mov    $0x1,%eax
+  801bd5:	e8 0f ff ff ff       	call   801ae9 <fsv_alloc>
+  801bda:	89 c6                	mov    %eax,%esi
+  801bdc:	85 c0                	test   %eax,%eax
+  801bde:	78 e6                	js     801bc6 <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  801be0:	8b 45 08             	mov    0x8(%ebp),%eax
+  801be3:	8b 40 0c             	mov    0xc(%eax),%eax
+  801be6:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  801beb:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bee:	8b 40 04             	mov    0x4(%eax),%eax
+  801bf1:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  801bf6:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  801bfc:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801c03:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801c08:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801c0d:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801c12:	e8 e2 fc ff ff       	call   8018f9 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801c17:	6a 00                	push   $0x0
+  801c19:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801c1c:	50                   	push   %eax
+  801c1d:	68 00 10 c0 9f       	push   $0x9fc01000
+  801c22:	6a 00                	push   $0x0
+  801c24:	e8 3c 11 00 00       	call   802d65 <ipc_recv_pages>
+  801c29:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  801c2b:	83 c4 10             	add    $0x10,%esp
+  801c2e:	85 c0                	test   %eax,%eax
+  801c30:	7e 94                	jle    801bc6 <devfile_read+0x61>
+  assert(r <= n);
+  801c32:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801c35:	39 c3                	cmp    %eax,%ebx
+  801c37:	72 2e                	jb     801c67 <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801c39:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c3c:	8b 40 04             	mov    0x4(%eax),%eax
+  801c3f:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801c44:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  801c47:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801c4a:	c1 e2 0c             	shl    $0xc,%edx
+  801c4d:	39 ca                	cmp    %ecx,%edx
+  801c4f:	72 2f                	jb     801c80 <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  801c51:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  801c56:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  801c59:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  801c5d:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801c62:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  801c65:	eb 52                	jmp    801cb9 <devfile_read+0x154>
+  assert(r <= n);
+  801c67:	68 31 36 80 00       	push   $0x803631
+  801c6c:	68 38 36 80 00       	push   $0x803638
+  801c71:	68 49 01 00 00       	push   $0x149
+  801c76:	68 26 36 80 00       	push   $0x803626
+  801c7b:	e8 2d e7 ff ff       	call   8003ad <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801c80:	68 5c 36 80 00       	push   $0x80365c
+  801c85:	68 38 36 80 00       	push   $0x803638
+  801c8a:	68 4a 01 00 00       	push   $0x14a
+  801c8f:	68 26 36 80 00       	push   $0x803626
+  801c94:	e8 14 e7 ff ff       	call   8003ad <_panic>
+      memmove(dst + done, src + done, m);
+  801c99:	83 ec 04             	sub    $0x4,%esp
+  801c9c:	53                   	push   %ebx
+  801c9d:	56                   	push   %esi
+  801c9e:	89 f8                	mov    %edi,%eax
+  801ca0:	03 45 0c             	add    0xc(%ebp),%eax
+  801ca3:	50                   	push   %eax
+  801ca4:	e8 53 ef ff ff       	call   800bfc <memmove>
+  801ca9:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  801cac:	01 df                	add    %ebx,%edi
+  801cae:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801cb1:	39 c7                	cmp    %eax,%edi
+  801cb3:	0f 83 c0 00 00 00    	jae    801d79 <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801cb9:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801cbc:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  801cbf:	89 f0                	mov    %esi,%eax
+  801cc1:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801cc6:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  801ccb:	29 c3                	sub    %eax,%ebx
+  801ccd:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801cd0:	29 f8                	sub    %edi,%eax
+  801cd2:	39 c3                	cmp    %eax,%ebx
+  801cd4:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  801cd7:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801cdd:	75 ba                	jne    801c99 <devfile_read+0x134>
+  801cdf:	89 f9                	mov    %edi,%ecx
+  801ce1:	03 4d 0c             	add    0xc(%ebp),%ecx
+  801ce4:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  801ce7:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  801ced:	75 aa                	jne    801c99 <devfile_read+0x134>
+  801cef:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  801cf5:	77 a2                	ja     801c99 <devfile_read+0x134>
+  801cf7:	89 c8                	mov    %ecx,%eax
+  801cf9:	c1 e8 16             	shr    $0x16,%eax
+  801cfc:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801d03:	a8 01                	test   $0x1,%al
+  801d05:	74 92                	je     801c99 <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  801d07:	89 c8                	mov    %ecx,%eax
+  801d09:	c1 e8 0c             	shr    $0xc,%eax
+  801d0c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  801d13:	a8 01                	test   $0x1,%al
+  801d15:	74 82                	je     801c99 <devfile_read+0x134>
+  801d17:	a9 02 08 00 00       	test   $0x802,%eax
+  801d1c:	0f 84 77 ff ff ff    	je     801c99 <devfile_read+0x134>
+  801d22:	f6 c4 04             	test   $0x4,%ah
+  801d25:	0f 85 6e ff ff ff    	jne    801c99 <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  801d2b:	a1 44 87 80 00       	mov    0x808744,%eax
+  801d30:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  801d34:	84 c0                	test   %al,%al
+  801d36:	75 17                	jne    801d4f <devfile_read+0x1ea>
+  801d38:	83 ec 08             	sub    $0x8,%esp
+  801d3b:	6a 01                	push   $0x1
+  801d3d:	6a 00                	push   $0x0
+  801d3f:	e8 1e f1 ff ff       	call   800e62 <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  801d44:	83 c4 10             	add    $0x10,%esp
+  801d47:	85 c0                	test   %eax,%eax
+  801d49:	0f 85 4a ff ff ff    	jne    801c99 <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  801d4f:	83 ec 04             	sub    $0x4,%esp
+  801d52:	68 05 08 00 00       	push   $0x805
+  801d57:	ff 75 cc             	push   -0x34(%ebp)
+  801d5a:	6a 00                	push   $0x0
+  801d5c:	56                   	push   %esi
+  801d5d:	6a 00                	push   $0x0
+  801d5f:	6a 05                	push   $0x5
+  801d61:	68 40 80 80 00       	push   $0x808040
+  801d66:	e8 8d f5 ff ff       	call   8012f8 <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  801d6b:	c1 e8 1f             	shr    $0x1f,%eax
+  801d6e:	08 45 cb             	or     %al,-0x35(%ebp)
+  801d71:	83 c4 20             	add    $0x20,%esp
+  801d74:	e9 33 ff ff ff       	jmp    801cac <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  801d79:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  801d7c:	83 ec 0c             	sub    $0xc,%esp
+  801d7f:	68 40 80 80 00       	push   $0x808040
+  801d84:	e8 1f f5 ff ff       	call   8012a8 <sysbatch_flush>
+  801d89:	83 c4 10             	add    $0x10,%esp
+  801d8c:	85 c0                	test   %eax,%eax
+  801d8e:	78 06                	js     801d96 <devfile_read+0x231>
+  801d90:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  801d94:	74 14                	je     801daa <devfile_read+0x245>
+    memmove(dst, src, r);
+  801d96:	83 ec 04             	sub    $0x4,%esp
+  801d99:	ff 75 d4             	push   -0x2c(%ebp)
+  801d9c:	ff 75 d0             	push   -0x30(%ebp)
+  801d9f:	ff 75 0c             	push   0xc(%ebp)
+  801da2:	e8 55 ee ff ff       	call   800bfc <memmove>
+  801da7:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  801daa:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dad:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  801db0:	e9 11 fe ff ff       	jmp    801bc6 <devfile_read+0x61>
+  assert(r <= n);
+  801db5:	68 31 36 80 00       	push   $0x803631
+  801dba:	68 38 36 80 00       	push   $0x803638
+  801dbf:	68 1c 01 00 00       	push   $0x11c
+  801dc4:	68 26 36 80 00       	push   $0x803626
+  801dc9:	e8 df e5 ff ff       	call   8003ad <_panic>
+  assert(r <= PGSIZE);
+  801dce:	68 4d 36 80 00       	push   $0x80364d
+  801dd3:	68 38 36 80 00       	push   $0x803638
+  801dd8:	68 1d 01 00 00       	push   $0x11d
+  801ddd:	68 26 36 80 00       	push   $0x803626
+  801de2:	e8 c6 e5 ff ff       	call   8003ad <_panic>
+
+00801de7 <devfile_write>:
+{
+  801de7:	55                   	push   %ebp
+  801de8:	89 e5                	mov    %esp,%ebp
+  801dea:	57                   	push   %edi
+  801deb:	56                   	push   %esi
+  801dec:	53                   	push   %ebx
+  801ded:	83 ec 1c             	sub    $0x1c,%esp
+  801df0:	8b 75 08             	mov    0x8(%ebp),%esi
+  801df3:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  801df6:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  801dfb:	77 39                	ja     801e36 <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801dfd:	8b 56 0c             	mov    0xc(%esi),%edx
+  801e00:	89 15 00 90 80 00    	mov    %edx,0x809000
+  fsipcbuf.write.req_n = n;
+  801e06:	a3 04 90 80 00       	mov    %eax,0x809004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  801e0b:	83 ec 04             	sub    $0x4,%esp
+  801e0e:	50                   	push   %eax
+  801e0f:	ff 75 0c             	push   0xc(%ebp)
+  801e12:	68 08 90 80 00       	push   $0x809008
+  801e17:	e8 e0 ed ff ff       	call   800bfc <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801e1c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e21:	b8 04 00 00 00       	mov    $0x4,%eax
+  801e26:	e8 e7 fb ff ff       	call   801a12 <fsipc>
+  801e2b:	83 c4 10             	add    $0x10,%esp
+}
+  801e2e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e31:	5b                   	pop    %ebx
+  801e32:	5e                   	pop    %esi
+  801e33:	5f                   	pop    %edi
+  801e34:	5d                   	pop    %ebp
+  801e35:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  801e36:	ba 00 00 10 00       	mov    $0x100000,%edx
+  801e3b:	39 d0                	cmp    %edx,%eax
+  801e3d:	89 d3                	mov    %edx,%ebx
+  801e3f:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  801e42:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  801e48:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  801e4b:	83 c7 01             	add    $0x1,%edi
+  801e4e:	89 f8                	mov    %edi,%eax
+  801e50:	e8 94 fc ff ff       	call   801ae9 <fsv_alloc>
+  801e55:	85 c0                	test   %eax,%eax
+  801e57:	78 d5                	js     801e2e <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  801e59:	83 ec 04             	sub    $0x4,%esp
+  801e5c:	53                   	push   %ebx
+  801e5d:	ff 75 0c             	push   0xc(%ebp)
+  801e60:	68 00 10 c0 9f       	push   $0x9fc01000
+  801e65:	e8 92 ed ff ff       	call   800bfc <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  801e6a:	8b 46 0c             	mov    0xc(%esi),%eax
+  801e6d:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  801e72:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  801e78:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801e7f:	89 f9                	mov    %edi,%ecx
+  801e81:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801e86:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801e8b:	e8 69 fa ff ff       	call   8018f9 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801e90:	6a 00                	push   $0x0
+  801e92:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801e95:	50                   	push   %eax
+  801e96:	6a 00                	push   $0x0
+  801e98:	6a 00                	push   $0x0
+  801e9a:	e8 c6 0e 00 00       	call   802d65 <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  801e9f:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  801ea2:	eb 8a                	jmp    801e2e <devfile_write+0x47>
+
+00801ea4 <open>:
+{
+  801ea4:	55                   	push   %ebp
+  801ea5:	89 e5                	mov    %esp,%ebp
+  801ea7:	56                   	push   %esi
+  801ea8:	53                   	push   %ebx
+  801ea9:	83 ec 1c             	sub    $0x1c,%esp
+  801eac:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801eaf:	56                   	push   %esi
+  801eb0:	e8 86 eb ff ff       	call   800a3b <strlen>
+  801eb5:	83 c4 10             	add    $0x10,%esp
+  801eb8:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801ebd:	7f 6c                	jg     801f2b <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  801ebf:	83 ec 0c             	sub    $0xc,%esp
+  801ec2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ec5:	50                   	push   %eax
+  801ec6:	e8 ad f4 ff ff       	call   801378 <fd_alloc>
+  801ecb:	89 c3                	mov    %eax,%ebx
+  801ecd:	83 c4 10             	add    $0x10,%esp
+  801ed0:	85 c0                	test   %eax,%eax
+  801ed2:	78 3c                	js     801f10 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801ed4:	83 ec 08             	sub    $0x8,%esp
+  801ed7:	56                   	push   %esi
+  801ed8:	68 00 90 80 00       	push   $0x809000
+  801edd:	e8 94 eb ff ff       	call   800a76 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801ee2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ee5:	a3 00 94 80 00       	mov    %eax,0x809400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801eea:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801eed:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ef2:	e8 1b fb ff ff       	call   801a12 <fsipc>
+  801ef7:	89 c3                	mov    %eax,%ebx
+  801ef9:	83 c4 10             	add    $0x10,%esp
+  801efc:	85 c0                	test   %eax,%eax
+  801efe:	78 19                	js     801f19 <open+0x75>
+  return fd2num(fd);
+  801f00:	83 ec 0c             	sub    $0xc,%esp
+  801f03:	ff 75 f4             	push   -0xc(%ebp)
+  801f06:	e8 49 f4 ff ff       	call   801354 <fd2num>
+  801f0b:	89 c3                	mov    %eax,%ebx
+  801f0d:	83 c4 10             	add    $0x10,%esp
+}
+  801f10:	89 d8                	mov    %ebx,%eax
+  801f12:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f15:	5b                   	pop    %ebx
+  801f16:	5e                   	pop    %esi
+  801f17:	5d                   	pop    %ebp
+  801f18:	c3                   	ret
+    fd_close(fd, 0);
+  801f19:	83 ec 08             	sub    $0x8,%esp
+  801f1c:	6a 00                	push   $0x0
+  801f1e:	ff 75 f4             	push   -0xc(%ebp)
+  801f21:	e8 44 f5 ff ff       	call   80146a <fd_close>
+    return r;
+  801f26:	83 c4 10             	add    $0x10,%esp
+  801f29:	eb e5                	jmp    801f10 <open+0x6c>
+    return -E_BAD_PATH;
+  801f2b:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801f30:	eb de                	jmp    801f10 <open+0x6c>
+
+00801f32 <open_read>:
+{
+  801f32:	55                   	push   %ebp
+  801f33:	89 e5                	mov    %esp,%ebp
+  801f35:	57                   	push   %edi
+  801f36:	56                   	push   %esi
+  801f37:	53                   	push   %ebx
+  801f38:	83 ec 28             	sub    $0x28,%esp
+  801f3b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  801f3e:	57                   	push   %edi
+  801f3f:	e8 f7 ea ff ff       	call   800a3b <strlen>
+  801f44:	83 c4 10             	add    $0x10,%esp
+  801f47:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801f4c:	0f 87 f6 00 00 00    	ja     802048 <open_read+0x116>
+  801f52:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  801f54:	83 ec 0c             	sub    $0xc,%esp
+  801f57:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801f5a:	50                   	push   %eax
+  801f5b:	e8 18 f4 ff ff       	call   801378 <fd_alloc>
+  801f60:	89 c3                	mov    %eax,%ebx
+  801f62:	83 c4 10             	add    $0x10,%esp
+  801f65:	85 c0                	test   %eax,%eax
+  801f67:	0f 88 b2 00 00 00    	js     80201f <open_read+0xed>
+  strcpy(req->req_buf, path);
+  801f6d:	83 ec 08             	sub    $0x8,%esp
+  801f70:	57                   	push   %edi
+  801f71:	68 e4 90 80 00       	push   $0x8090e4
+  801f76:	e8 fb ea ff ff       	call   800a76 <strcpy>
+  req->req_nops = 2;
+  801f7b:	c7 05 00 90 80 00 02 	movl   $0x2,0x809000
+  801f82:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  801f85:	c7 05 04 90 80 00 01 	movl   $0x1,0x809004
+  801f8c:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  801f8f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f92:	a3 10 90 80 00       	mov    %eax,0x809010
+  req->req_ops[0].op_buf = 0;
+  801f97:	c7 05 18 90 80 00 00 	movl   $0x0,0x809018
+  801f9e:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  801fa1:	c7 05 20 90 80 00 04 	movl   $0x4,0x809020
+  801fa8:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  801fab:	c7 05 24 90 80 00 01 	movl   $0x1,0x809024
+  801fb2:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  801fb5:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  801fba:	29 f0                	sub    %esi,%eax
+  801fbc:	3b 45 14             	cmp    0x14(%ebp),%eax
+  801fbf:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  801fc3:	a3 2c 90 80 00       	mov    %eax,0x80902c
+  req->req_ops[1].op_offset = 0;
+  801fc8:	c7 05 30 90 80 00 00 	movl   $0x0,0x809030
+  801fcf:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  801fd2:	83 c6 01             	add    $0x1,%esi
+  801fd5:	89 35 34 90 80 00    	mov    %esi,0x809034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  801fdb:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801fde:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801fe3:	e8 2a fa ff ff       	call   801a12 <fsipc>
+  801fe8:	89 c3                	mov    %eax,%ebx
+  801fea:	83 c4 10             	add    $0x10,%esp
+  801fed:	83 f8 01             	cmp    $0x1,%eax
+  801ff0:	7e 37                	jle    802029 <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  801ff2:	a1 38 90 80 00       	mov    0x809038,%eax
+  801ff7:	8b 55 18             	mov    0x18(%ebp),%edx
+  801ffa:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  801ffc:	83 ec 04             	sub    $0x4,%esp
+  801fff:	50                   	push   %eax
+  802000:	81 c6 e4 90 80 00    	add    $0x8090e4,%esi
+  802006:	56                   	push   %esi
+  802007:	ff 75 10             	push   0x10(%ebp)
+  80200a:	e8 ed eb ff ff       	call   800bfc <memmove>
+  return fd2num(fd);
+  80200f:	83 c4 04             	add    $0x4,%esp
+  802012:	ff 75 e4             	push   -0x1c(%ebp)
+  802015:	e8 3a f3 ff ff       	call   801354 <fd2num>
+  80201a:	89 c3                	mov    %eax,%ebx
+  80201c:	83 c4 10             	add    $0x10,%esp
+}
+  80201f:	89 d8                	mov    %ebx,%eax
+  802021:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802024:	5b                   	pop    %ebx
+  802025:	5e                   	pop    %esi
+  802026:	5f                   	pop    %edi
+  802027:	5d                   	pop    %ebp
+  802028:	c3                   	ret
+    fd_close(fd, 0);
+  802029:	83 ec 08             	sub    $0x8,%esp
+  80202c:	6a 00                	push   $0x0
+  80202e:	ff 75 e4             	push   -0x1c(%ebp)
+  802031:	e8 34 f4 ff ff       	call   80146a <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  802036:	83 c4 10             	add    $0x10,%esp
+  802039:	85 db                	test   %ebx,%ebx
+  80203b:	78 e2                	js     80201f <open_read+0xed>
+  80203d:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  802040:	8b 9b 1c 90 80 00    	mov    0x80901c(%ebx),%ebx
+  802046:	eb d7                	jmp    80201f <open_read+0xed>
+    return -E_BAD_PATH;
+  802048:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80204d:	eb d0                	jmp    80201f <open_read+0xed>
+
+0080204f <file_stat>:
+{
+  80204f:	55                   	push   %ebp
+  802050:	89 e5                	mov    %esp,%ebp
+  802052:	57                   	push   %edi
+  802053:	56                   	push   %esi
+  802054:	53                   	push   %ebx
+  802055:	83 ec 18             	sub    $0x18,%esp
+  802058:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80205b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  80205e:	57                   	push   %edi
+  80205f:	e8 d7 e9 ff ff       	call   800a3b <strlen>
+  802064:	83 c4 10             	add    $0x10,%esp
+  802067:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80206c:	0f 8f c7 00 00 00    	jg     802139 <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  802072:	83 ec 0c             	sub    $0xc,%esp
+  802075:	57                   	push   %edi
+  802076:	e8 c0 e9 ff ff       	call   800a3b <strlen>
+  80207b:	8d 58 04             	lea    0x4(%eax),%ebx
+  80207e:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  802081:	83 c4 08             	add    $0x8,%esp
+  802084:	57                   	push   %edi
+  802085:	68 e4 90 80 00       	push   $0x8090e4
+  80208a:	e8 e7 e9 ff ff       	call   800a76 <strcpy>
+  req->req_nops = 2;
+  80208f:	c7 05 00 90 80 00 02 	movl   $0x2,0x809000
+  802096:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  802099:	c7 05 04 90 80 00 02 	movl   $0x2,0x809004
+  8020a0:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  8020a3:	c7 05 10 90 80 00 00 	movl   $0x0,0x809010
+  8020aa:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  8020ad:	c7 05 18 90 80 00 00 	movl   $0x0,0x809018
+  8020b4:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  8020b7:	c7 05 20 90 80 00 03 	movl   $0x3,0x809020
+  8020be:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  8020c1:	c7 05 24 90 80 00 01 	movl   $0x1,0x809024
+  8020c8:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  8020cb:	89 1d 34 90 80 00    	mov    %ebx,0x809034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  8020d1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020d6:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8020db:	e8 32 f9 ff ff       	call   801a12 <fsipc>
+  8020e0:	83 c4 10             	add    $0x10,%esp
+  8020e3:	83 f8 01             	cmp    $0x1,%eax
+  8020e6:	7e 42                	jle    80212a <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  8020e8:	81 c3 e4 90 80 00    	add    $0x8090e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  8020ee:	83 ec 08             	sub    $0x8,%esp
+  8020f1:	53                   	push   %ebx
+  8020f2:	56                   	push   %esi
+  8020f3:	e8 7e e9 ff ff       	call   800a76 <strcpy>
+  st->st_size = ret->ret_size;
+  8020f8:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  8020fe:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  802104:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  80210a:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  802110:	c7 86 88 00 00 00 04 	movl   $0x804004,0x88(%esi)
+  802117:	40 80 00 
+  return 0;
+  80211a:	83 c4 10             	add    $0x10,%esp
+  80211d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802122:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802125:	5b                   	pop    %ebx
+  802126:	5e                   	pop    %esi
+  802127:	5f                   	pop    %edi
+  802128:	5d                   	pop    %ebp
+  802129:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  80212a:	85 c0                	test   %eax,%eax
+  80212c:	78 f4                	js     802122 <file_stat+0xd3>
+  80212e:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802131:	8b 80 1c 90 80 00    	mov    0x80901c(%eax),%eax
+  802137:	eb e9                	jmp    802122 <file_stat+0xd3>
+    return -E_BAD_PATH;
+  802139:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  80213e:	eb e2                	jmp    802122 <file_stat+0xd3>
+
+00802140 <read_map>:
+{
+  802140:	55                   	push   %ebp
+  802141:	89 e5                	mov    %esp,%ebp
+  802143:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802146:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802149:	50                   	push   %eax
+  80214a:	ff 75 08             	push   0x8(%ebp)
+  80214d:	e8 7c f2 ff ff       	call   8013ce <fd_lookup>
+  802152:	83 c4 10             	add    $0x10,%esp
+  802155:	85 c0                	test   %eax,%eax
+  802157:	78 2a                	js     802183 <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  802159:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80215c:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  802162:	39 08                	cmp    %ecx,(%eax)
+  802164:	75 1f                	jne    802185 <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  802166:	8b 40 0c             	mov    0xc(%eax),%eax
+  802169:	a3 00 90 80 00       	mov    %eax,0x809000
+  fsipcbuf.read_map.req_offset = offset;
+  80216e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802171:	a3 04 90 80 00       	mov    %eax,0x809004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  802176:	8b 55 10             	mov    0x10(%ebp),%edx
+  802179:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80217e:	e8 8f f8 ff ff       	call   801a12 <fsipc>
+}
+  802183:	c9                   	leave
+  802184:	c3                   	ret
+    return -E_INVAL;
+  802185:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80218a:	eb f7                	jmp    802183 <read_map+0x43>
+
+0080218c <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80218c:	55                   	push   %ebp
+  80218d:	89 e5                	mov    %esp,%ebp
+  80218f:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  802192:	ba 00 00 00 00       	mov    $0x0,%edx
+  802197:	b8 08 00 00 00       	mov    $0x8,%eax
+  80219c:	e8 71 f8 ff ff       	call   801a12 <fsipc>
+}
+  8021a1:	c9                   	leave
+  8021a2:	c3                   	ret
+
+008021a3 <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  8021a3:	55                   	push   %ebp
+  8021a4:	89 e5                	mov    %esp,%ebp
+  8021a6:	57                   	push   %edi
+  8021a7:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  8021a8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021ab:	a3 00 90 80 00       	mov    %eax,0x809000
+  fsipcbuf.stats.req_bio_sched = 0;
+  8021b0:	c7 05 04 90 80 00 00 	movl   $0x0,0x809004
+  8021b7:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  8021ba:	c7 05 08 90 80 00 00 	movl   $0x0,0x809008
+  8021c1:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  8021c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021c9:	b8 09 00 00 00       	mov    $0x9,%eax
+  8021ce:	e8 3f f8 ff ff       	call   801a12 <fsipc>
+  8021d3:	85 c0                	test   %eax,%eax
+  8021d5:	78 14                	js     8021eb <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  8021d7:	be 00 90 80 00       	mov    $0x809000,%esi
+  8021dc:	b9 16 00 00 00       	mov    $0x16,%ecx
+  8021e1:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8021e4:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  8021e6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021eb:	5e                   	pop    %esi
+  8021ec:	5f                   	pop    %edi
+  8021ed:	5d                   	pop    %ebp
+  8021ee:	c3                   	ret
+
+008021ef <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  8021ef:	55                   	push   %ebp
+  8021f0:	89 e5                	mov    %esp,%ebp
+  8021f2:	53                   	push   %ebx
+  8021f3:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  8021f6:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8021f9:	50                   	push   %eax
+  8021fa:	6a 00                	push   $0x0
+  8021fc:	e8 a2 ff ff ff       	call   8021a3 <fs_stats>
+  802201:	83 c4 10             	add    $0x10,%esp
+  802204:	85 c0                	test   %eax,%eax
+  802206:	78 28                	js     802230 <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  802208:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  80220b:	83 ec 08             	sub    $0x8,%esp
+  80220e:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802211:	50                   	push   %eax
+  802212:	6a 20                	push   $0x20
+  802214:	e8 8a ff ff ff       	call   8021a3 <fs_stats>
+  802219:	83 c4 10             	add    $0x10,%esp
+  80221c:	85 c0                	test   %eax,%eax
+  80221e:	78 10                	js     802230 <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  802220:	83 ec 08             	sub    $0x8,%esp
+  802223:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802226:	50                   	push   %eax
+  802227:	53                   	push   %ebx
+  802228:	e8 76 ff ff ff       	call   8021a3 <fs_stats>
+  80222d:	83 c4 10             	add    $0x10,%esp
+}
+  802230:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802233:	c9                   	leave
+  802234:	c3                   	ret
+
+00802235 <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  802235:	55                   	push   %ebp
+  802236:	89 e5                	mov    %esp,%ebp
+  802238:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  80223b:	c7 05 00 90 80 00 00 	movl   $0x0,0x809000
+  802242:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  802245:	8b 45 08             	mov    0x8(%ebp),%eax
+  802248:	a3 04 90 80 00       	mov    %eax,0x809004
+  fsipcbuf.stats.req_dcache = 0;
+  80224d:	c7 05 08 90 80 00 00 	movl   $0x0,0x809008
+  802254:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  802257:	ba 00 00 00 00       	mov    $0x0,%edx
+  80225c:	b8 09 00 00 00       	mov    $0x9,%eax
+  802261:	e8 ac f7 ff ff       	call   801a12 <fsipc>
+}
+  802266:	c9                   	leave
+  802267:	c3                   	ret
+
+00802268 <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  802268:	55                   	push   %ebp
+  802269:	89 e5                	mov    %esp,%ebp
+  80226b:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  80226e:	c7 05 00 90 80 00 00 	movl   $0x0,0x809000
+  802275:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  802278:	c7 05 04 90 80 00 00 	movl   $0x0,0x809004
+  80227f:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  802282:	8b 45 08             	mov    0x8(%ebp),%eax
+  802285:	a3 08 90 80 00       	mov    %eax,0x809008
+  return fsipc(FSREQ_STATS, NULL);
+  80228a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80228f:	b8 09 00 00 00       	mov    $0x9,%eax
+  802294:	e8 79 f7 ff ff       	call   801a12 <fsipc>
+}
+  802299:	c9                   	leave
+  80229a:	c3                   	ret
+
+0080229b <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  80229b:	55                   	push   %ebp
+  80229c:	89 e5                	mov    %esp,%ebp
+  80229e:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8022a1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022a4:	50                   	push   %eax
+  8022a5:	ff 75 08             	push   0x8(%ebp)
+  8022a8:	e8 21 f1 ff ff       	call   8013ce <fd_lookup>
+  8022ad:	83 c4 10             	add    $0x10,%esp
+  8022b0:	85 c0                	test   %eax,%eax
+  8022b2:	78 34                	js     8022e8 <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  8022b4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022b7:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  8022bd:	39 08                	cmp    %ecx,(%eax)
+  8022bf:	75 29                	jne    8022ea <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  8022c1:	8b 40 0c             	mov    0xc(%eax),%eax
+  8022c4:	a3 00 90 80 00       	mov    %eax,0x809000
+  fsipcbuf.fallocate.req_offset = offset;
+  8022c9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022cc:	a3 04 90 80 00       	mov    %eax,0x809004
+  fsipcbuf.fallocate.req_len = len;
+  8022d1:	8b 45 10             	mov    0x10(%ebp),%eax
+  8022d4:	a3 08 90 80 00       	mov    %eax,0x809008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  8022d9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022de:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8022e3:	e8 2a f7 ff ff       	call   801a12 <fsipc>
+}
+  8022e8:	c9                   	leave
+  8022e9:	c3                   	ret
+    return -E_INVAL;
+  8022ea:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8022ef:	eb f7                	jmp    8022e8 <fallocate+0x4d>
+
+008022f1 <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  8022f1:	55                   	push   %ebp
+  8022f2:	89 e5                	mov    %esp,%ebp
+  8022f4:	57                   	push   %edi
+  8022f5:	56                   	push   %esi
+  8022f6:	53                   	push   %ebx
+  8022f7:	83 ec 24             	sub    $0x24,%esp
+  8022fa:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8022fd:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802300:	50                   	push   %eax
+  802301:	ff 75 08             	push   0x8(%ebp)
+  802304:	e8 c5 f0 ff ff       	call   8013ce <fd_lookup>
+  802309:	83 c4 10             	add    $0x10,%esp
+  80230c:	85 c0                	test   %eax,%eax
+  80230e:	78 66                	js     802376 <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  802310:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802313:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  802319:	39 08                	cmp    %ecx,(%eax)
+  80231b:	75 61                	jne    80237e <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  80231d:	85 f6                	test   %esi,%esi
+  80231f:	7e 50                	jle    802371 <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  802321:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  802326:	39 de                	cmp    %ebx,%esi
+  802328:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  80232b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80232e:	8b 40 0c             	mov    0xc(%eax),%eax
+  802331:	a3 00 90 80 00       	mov    %eax,0x809000
+    fsipcbuf.prefetch.req_n = m;
+  802336:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  80233c:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  802343:	83 ec 04             	sub    $0x4,%esp
+  802346:	57                   	push   %edi
+  802347:	ff 75 0c             	push   0xc(%ebp)
+  80234a:	68 08 90 80 00       	push   $0x809008
+  80234f:	e8 a8 e8 ff ff       	call   800bfc <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  802354:	ba 00 00 00 00       	mov    $0x0,%edx
+  802359:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80235e:	e8 af f6 ff ff       	call   801a12 <fsipc>
+  802363:	83 c4 10             	add    $0x10,%esp
+  802366:	85 c0                	test   %eax,%eax
+  802368:	78 0c                	js     802376 <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  80236a:	01 7d 0c             	add    %edi,0xc(%ebp)
+  80236d:	29 de                	sub    %ebx,%esi
+  80236f:	eb ac                	jmp    80231d <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  802371:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802376:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802379:	5b                   	pop    %ebx
+  80237a:	5e                   	pop    %esi
+  80237b:	5f                   	pop    %edi
+  80237c:	5d                   	pop    %ebp
+  80237d:	c3                   	ret
+    return -E_INVAL;
+  80237e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802383:	eb f1                	jmp    802376 <prefetch+0x85>
+
+00802385 <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  802385:	55                   	push   %ebp
+  802386:	89 e5                	mov    %esp,%ebp
+  802388:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  80238b:	50                   	push   %eax
+  80238c:	e8 d3 ef ff ff       	call   801364 <fd2data>
+  802391:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  802396:	c9                   	leave
+  802397:	c3                   	ret
+
+00802398 <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802398:	55                   	push   %ebp
+  802399:	89 e5                	mov    %esp,%ebp
+  80239b:	56                   	push   %esi
+  80239c:	53                   	push   %ebx
+  80239d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  8023a0:	83 ec 0c             	sub    $0xc,%esp
+  8023a3:	ff 75 08             	push   0x8(%ebp)
+  8023a6:	e8 b9 ef ff ff       	call   801364 <fd2data>
+  8023ab:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  8023ad:	83 c4 08             	add    $0x8,%esp
+  8023b0:	68 88 36 80 00       	push   $0x803688
+  8023b5:	53                   	push   %ebx
+  8023b6:	e8 bb e6 ff ff       	call   800a76 <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  8023bb:	8b 46 04             	mov    0x4(%esi),%eax
+  8023be:	2b 06                	sub    (%esi),%eax
+  8023c0:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  8023c6:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8023cd:	00 00 00 
+  stat->st_dev = &devpipe;
+  8023d0:	c7 83 88 00 00 00 20 	movl   $0x804020,0x88(%ebx)
+  8023d7:	40 80 00 
+  return 0;
+}
+  8023da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023df:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023e2:	5b                   	pop    %ebx
+  8023e3:	5e                   	pop    %esi
+  8023e4:	5d                   	pop    %ebp
+  8023e5:	c3                   	ret
+
+008023e6 <pipe_wakeup>:
+{
+  8023e6:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  8023e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023ed:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  8023f0:	85 c0                	test   %eax,%eax
+  8023f2:	75 01                	jne    8023f5 <pipe_wakeup+0xf>
+  8023f4:	c3                   	ret
+{
+  8023f5:	55                   	push   %ebp
+  8023f6:	89 e5                	mov    %esp,%ebp
+  8023f8:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  8023fb:	6a 00                	push   $0x0
+  8023fd:	68 00 00 c0 ee       	push   $0xeec00000
+  802402:	52                   	push   %edx
+  802403:	e8 f9 ed ff ff       	call   801201 <sys_chan_wakeup>
+  802408:	83 c4 10             	add    $0x10,%esp
+}
+  80240b:	c9                   	leave
+  80240c:	c3                   	ret
+
+0080240d <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80240d:	55                   	push   %ebp
+  80240e:	89 e5                	mov    %esp,%ebp
+  802410:	57                   	push   %edi
+  802411:	56                   	push   %esi
+  802412:	53                   	push   %ebx
+  802413:	83 ec 18             	sub    $0x18,%esp
+  802416:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  802419:	57                   	push   %edi
+  80241a:	e8 45 ef ff ff       	call   801364 <fd2data>
+  80241f:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  802421:	83 c4 10             	add    $0x10,%esp
+  802424:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  802428:	74 2a                	je     802454 <devpipe_close+0x47>
+  80242a:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  80242f:	89 f8                	mov    %edi,%eax
+  802431:	e8 4f ff ff ff       	call   802385 <pipe_ring>
+  802436:	83 ec 08             	sub    $0x8,%esp
+  802439:	01 d8                	add    %ebx,%eax
+  80243b:	50                   	push   %eax
+  80243c:	6a 00                	push   $0x0
+  80243e:	e8 e7 ea ff ff       	call   800f2a <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  802443:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802449:	83 c4 10             	add    $0x10,%esp
+  80244c:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  802452:	75 db                	jne    80242f <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  802454:	83 ec 08             	sub    $0x8,%esp
+  802457:	57                   	push   %edi
+  802458:	6a 00                	push   $0x0
+  80245a:	e8 cb ea ff ff       	call   800f2a <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  80245f:	83 c4 10             	add    $0x10,%esp
+  802462:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  802466:	75 13                	jne    80247b <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  802468:	83 ec 08             	sub    $0x8,%esp
+  80246b:	56                   	push   %esi
+  80246c:	6a 00                	push   $0x0
+  80246e:	e8 b7 ea ff ff       	call   800f2a <sys_page_unmap>
+}
+  802473:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802476:	5b                   	pop    %ebx
+  802477:	5e                   	pop    %esi
+  802478:	5f                   	pop    %edi
+  802479:	5d                   	pop    %ebp
+  80247a:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  80247b:	8d 56 04             	lea    0x4(%esi),%edx
+  80247e:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802481:	e8 60 ff ff ff       	call   8023e6 <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802486:	8d 46 30             	lea    0x30(%esi),%eax
+  802489:	89 f2                	mov    %esi,%edx
+  80248b:	e8 56 ff ff ff       	call   8023e6 <pipe_wakeup>
+  802490:	eb d6                	jmp    802468 <devpipe_close+0x5b>
+
+00802492 <_pipeisclosed>:
+{
+  802492:	55                   	push   %ebp
+  802493:	89 e5                	mov    %esp,%ebp
+  802495:	57                   	push   %edi
+  802496:	56                   	push   %esi
+  802497:	53                   	push   %ebx
+  802498:	83 ec 1c             	sub    $0x1c,%esp
+  80249b:	89 c7                	mov    %eax,%edi
+  80249d:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  80249f:	a1 44 87 80 00       	mov    0x808744,%eax
+  8024a4:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  8024a7:	83 ec 0c             	sub    $0xc,%esp
+  8024aa:	57                   	push   %edi
+  8024ab:	e8 18 0a 00 00       	call   802ec8 <pageref>
+  8024b0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8024b3:	89 34 24             	mov    %esi,(%esp)
+  8024b6:	e8 0d 0a 00 00       	call   802ec8 <pageref>
+    nn = thisenv->env_runs;
+  8024bb:	8b 15 44 87 80 00    	mov    0x808744,%edx
+  8024c1:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  8024c4:	83 c4 10             	add    $0x10,%esp
+  8024c7:	39 cb                	cmp    %ecx,%ebx
+  8024c9:	74 1b                	je     8024e6 <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  8024cb:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8024ce:	75 cf                	jne    80249f <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8024d0:	8b 42 58             	mov    0x58(%edx),%eax
+  8024d3:	6a 01                	push   $0x1
+  8024d5:	50                   	push   %eax
+  8024d6:	53                   	push   %ebx
+  8024d7:	68 8f 36 80 00       	push   $0x80368f
+  8024dc:	e8 a7 df ff ff       	call   800488 <cprintf>
+  8024e1:	83 c4 10             	add    $0x10,%esp
+  8024e4:	eb b9                	jmp    80249f <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  8024e6:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8024e9:	0f 94 c0             	sete   %al
+  8024ec:	0f b6 c0             	movzbl %al,%eax
+}
+  8024ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024f2:	5b                   	pop    %ebx
+  8024f3:	5e                   	pop    %esi
+  8024f4:	5f                   	pop    %edi
+  8024f5:	5d                   	pop    %ebp
+  8024f6:	c3                   	ret
+
+008024f7 <devpipe_write_bulk>:
+{
+  8024f7:	55                   	push   %ebp
+  8024f8:	89 e5                	mov    %esp,%ebp
+  8024fa:	57                   	push   %edi
+  8024fb:	56                   	push   %esi
+  8024fc:	53                   	push   %ebx
+  8024fd:	83 ec 1c             	sub    $0x1c,%esp
+  802500:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802503:	89 d6                	mov    %edx,%esi
+  802505:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  802508:	e8 78 fe ff ff       	call   802385 <pipe_ring>
+  80250d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  802510:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802515:	8d 46 04             	lea    0x4(%esi),%eax
+  802518:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  80251b:	eb 75                	jmp    802592 <devpipe_write_bulk+0x9b>
+  80251d:	b8 01 00 00 00       	mov    $0x1,%eax
+  802522:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802526:	6a 64                	push   $0x64
+  802528:	68 00 00 c0 ee       	push   $0xeec00000
+  80252d:	53                   	push   %ebx
+  80252e:	56                   	push   %esi
+  80252f:	e8 aa ec ff ff       	call   8011de <sys_chan_sleep>
+      continue;
+  802534:	83 c4 10             	add    $0x10,%esp
+  802537:	eb 59                	jmp    802592 <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  802539:	89 d1                	mov    %edx,%ecx
+  80253b:	c1 f9 1f             	sar    $0x1f,%ecx
+  80253e:	c1 e9 11             	shr    $0x11,%ecx
+  802541:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802544:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802549:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  80254b:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  802551:	29 d3                	sub    %edx,%ebx
+  802553:	ba 00 80 00 00       	mov    $0x8000,%edx
+  802558:	29 c2                	sub    %eax,%edx
+  80255a:	39 d3                	cmp    %edx,%ebx
+  80255c:	0f 47 da             	cmova  %edx,%ebx
+  80255f:	8b 55 08             	mov    0x8(%ebp),%edx
+  802562:	29 fa                	sub    %edi,%edx
+  802564:	39 d3                	cmp    %edx,%ebx
+  802566:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  802569:	83 ec 04             	sub    $0x4,%esp
+  80256c:	53                   	push   %ebx
+  80256d:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802570:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  802573:	52                   	push   %edx
+  802574:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802577:	01 c8                	add    %ecx,%eax
+  802579:	50                   	push   %eax
+  80257a:	e8 df e6 ff ff       	call   800c5e <memcpy>
+    i += m;
+  80257f:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  802581:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802584:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802587:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80258a:	e8 57 fe ff ff       	call   8023e6 <pipe_wakeup>
+  80258f:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802592:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802595:	73 2b                	jae    8025c2 <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  802597:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  802599:	8b 56 04             	mov    0x4(%esi),%edx
+  80259c:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  8025a2:	39 d0                	cmp    %edx,%eax
+  8025a4:	7d 93                	jge    802539 <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  8025a6:	89 f2                	mov    %esi,%edx
+  8025a8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8025ab:	e8 e2 fe ff ff       	call   802492 <_pipeisclosed>
+  8025b0:	85 c0                	test   %eax,%eax
+  8025b2:	0f 84 65 ff ff ff    	je     80251d <devpipe_write_bulk+0x26>
+        return i;
+  8025b8:	89 f8                	mov    %edi,%eax
+}
+  8025ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025bd:	5b                   	pop    %ebx
+  8025be:	5e                   	pop    %esi
+  8025bf:	5f                   	pop    %edi
+  8025c0:	5d                   	pop    %ebp
+  8025c1:	c3                   	ret
+  return i;
+  8025c2:	89 f8                	mov    %edi,%eax
+  8025c4:	eb f4                	jmp    8025ba <devpipe_write_bulk+0xc3>
+
+008025c6 <devpipe_write>:
+{
+  8025c6:	55                   	push   %ebp
+  8025c7:	89 e5                	mov    %esp,%ebp
+  8025c9:	57                   	push   %edi
+  8025ca:	56                   	push   %esi
+  8025cb:	53                   	push   %ebx
+  8025cc:	83 ec 28             	sub    $0x28,%esp
+  8025cf:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  8025d2:	56                   	push   %esi
+  8025d3:	e8 8c ed ff ff       	call   801364 <fd2data>
+  8025d8:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  8025da:	8b 78 28             	mov    0x28(%eax),%edi
+  8025dd:	83 c4 10             	add    $0x10,%esp
+  8025e0:	85 ff                	test   %edi,%edi
+  8025e2:	75 25                	jne    802609 <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  8025e4:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8025e7:	74 66                	je     80264f <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8025e9:	8b 43 04             	mov    0x4(%ebx),%eax
+  8025ec:	8b 0b                	mov    (%ebx),%ecx
+  8025ee:	8d 51 20             	lea    0x20(%ecx),%edx
+  8025f1:	39 d0                	cmp    %edx,%eax
+  8025f3:	72 2b                	jb     802620 <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  8025f5:	89 da                	mov    %ebx,%edx
+  8025f7:	89 f0                	mov    %esi,%eax
+  8025f9:	e8 94 fe ff ff       	call   802492 <_pipeisclosed>
+  8025fe:	85 c0                	test   %eax,%eax
+  802600:	75 51                	jne    802653 <devpipe_write+0x8d>
+      sys_yield();
+  802602:	e8 3c e8 ff ff       	call   800e43 <sys_yield>
+  802607:	eb e0                	jmp    8025e9 <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  802609:	83 ec 0c             	sub    $0xc,%esp
+  80260c:	ff 75 10             	push   0x10(%ebp)
+  80260f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802612:	89 c2                	mov    %eax,%edx
+  802614:	89 f0                	mov    %esi,%eax
+  802616:	e8 dc fe ff ff       	call   8024f7 <devpipe_write_bulk>
+  80261b:	83 c4 10             	add    $0x10,%esp
+  80261e:	eb 38                	jmp    802658 <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802620:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802623:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802627:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  80262a:	89 c2                	mov    %eax,%edx
+  80262c:	c1 fa 1f             	sar    $0x1f,%edx
+  80262f:	89 d1                	mov    %edx,%ecx
+  802631:	c1 e9 1b             	shr    $0x1b,%ecx
+  802634:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802637:	83 e2 1f             	and    $0x1f,%edx
+  80263a:	29 ca                	sub    %ecx,%edx
+  80263c:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802640:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  802644:	83 c0 01             	add    $0x1,%eax
+  802647:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  80264a:	83 c7 01             	add    $0x1,%edi
+  80264d:	eb 95                	jmp    8025e4 <devpipe_write+0x1e>
+  return i;
+  80264f:	89 f8                	mov    %edi,%eax
+  802651:	eb 05                	jmp    802658 <devpipe_write+0x92>
+        return 0;
+  802653:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802658:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80265b:	5b                   	pop    %ebx
+  80265c:	5e                   	pop    %esi
+  80265d:	5f                   	pop    %edi
+  80265e:	5d                   	pop    %ebp
+  80265f:	c3                   	ret
+
+00802660 <devpipe_read_bulk>:
+{
+  802660:	55                   	push   %ebp
+  802661:	89 e5                	mov    %esp,%ebp
+  802663:	57                   	push   %edi
+  802664:	56                   	push   %esi
+  802665:	53                   	push   %ebx
+  802666:	83 ec 2c             	sub    $0x2c,%esp
+  802669:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80266c:	89 d6                	mov    %edx,%esi
+  80266e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802671:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  802674:	e8 0c fd ff ff       	call   802385 <pipe_ring>
+  802679:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  80267c:	85 db                	test   %ebx,%ebx
+  80267e:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802683:	0f 45 c3             	cmovne %ebx,%eax
+  802686:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802689:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  80268e:	8d 46 30             	lea    0x30(%esi),%eax
+  802691:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  802694:	eb 50                	jmp    8026e6 <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  802696:	89 d1                	mov    %edx,%ecx
+  802698:	c1 f9 1f             	sar    $0x1f,%ecx
+  80269b:	c1 e9 11             	shr    $0x11,%ecx
+  80269e:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  8026a1:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8026a6:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  8026a8:	29 d3                	sub    %edx,%ebx
+  8026aa:	ba 00 80 00 00       	mov    $0x8000,%edx
+  8026af:	29 c2                	sub    %eax,%edx
+  8026b1:	39 d3                	cmp    %edx,%ebx
+  8026b3:	0f 47 da             	cmova  %edx,%ebx
+  8026b6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8026b9:	29 fa                	sub    %edi,%edx
+  8026bb:	39 d3                	cmp    %edx,%ebx
+  8026bd:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  8026c0:	83 ec 04             	sub    $0x4,%esp
+  8026c3:	53                   	push   %ebx
+  8026c4:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8026c7:	01 c8                	add    %ecx,%eax
+  8026c9:	50                   	push   %eax
+  8026ca:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8026cd:	01 f8                	add    %edi,%eax
+  8026cf:	50                   	push   %eax
+  8026d0:	e8 89 e5 ff ff       	call   800c5e <memcpy>
+    i += m;
+  8026d5:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  8026d7:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8026d9:	89 f2                	mov    %esi,%edx
+  8026db:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8026de:	e8 03 fd ff ff       	call   8023e6 <pipe_wakeup>
+  8026e3:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  8026e6:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  8026e9:	73 51                	jae    80273c <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  8026eb:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  8026ee:	8b 16                	mov    (%esi),%edx
+  8026f0:	39 da                	cmp    %ebx,%edx
+  8026f2:	75 a2                	jne    802696 <devpipe_read_bulk+0x36>
+      if (i > 0)
+  8026f4:	85 ff                	test   %edi,%edi
+  8026f6:	75 44                	jne    80273c <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  8026f8:	89 f2                	mov    %esi,%edx
+  8026fa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8026fd:	e8 90 fd ff ff       	call   802492 <_pipeisclosed>
+  802702:	85 c0                	test   %eax,%eax
+  802704:	75 3a                	jne    802740 <devpipe_read_bulk+0xe0>
+  802706:	b8 01 00 00 00       	mov    $0x1,%eax
+  80270b:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  80270f:	6a 64                	push   $0x64
+  802711:	ff 75 d4             	push   -0x2c(%ebp)
+  802714:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  802715:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802718:	50                   	push   %eax
+  802719:	e8 c0 ea ff ff       	call   8011de <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  80271e:	85 c0                	test   %eax,%eax
+  802720:	ba 00 00 00 00       	mov    $0x0,%edx
+  802725:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  802728:	83 c4 10             	add    $0x10,%esp
+  80272b:	a8 01                	test   $0x1,%al
+  80272d:	74 b7                	je     8026e6 <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  80272f:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  802734:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802737:	5b                   	pop    %ebx
+  802738:	5e                   	pop    %esi
+  802739:	5f                   	pop    %edi
+  80273a:	5d                   	pop    %ebp
+  80273b:	c3                   	ret
+  return i;
+  80273c:	89 f8                	mov    %edi,%eax
+  80273e:	eb f4                	jmp    802734 <devpipe_read_bulk+0xd4>
+        return 0;
+  802740:	b8 00 00 00 00       	mov    $0x0,%eax
+  802745:	eb ed                	jmp    802734 <devpipe_read_bulk+0xd4>
+
+00802747 <devpipe_read>:
+{
+  802747:	55                   	push   %ebp
+  802748:	89 e5                	mov    %esp,%ebp
+  80274a:	57                   	push   %edi
+  80274b:	56                   	push   %esi
+  80274c:	53                   	push   %ebx
+  80274d:	83 ec 18             	sub    $0x18,%esp
+  802750:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  802753:	57                   	push   %edi
+  802754:	e8 0b ec ff ff       	call   801364 <fd2data>
+  802759:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  80275b:	8b 70 28             	mov    0x28(%eax),%esi
+  80275e:	83 c4 10             	add    $0x10,%esp
+  802761:	85 f6                	test   %esi,%esi
+  802763:	75 24                	jne    802789 <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  802765:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802768:	74 60                	je     8027ca <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  80276a:	8b 03                	mov    (%ebx),%eax
+  80276c:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80276f:	75 3b                	jne    8027ac <devpipe_read+0x65>
+      if (i > 0)
+  802771:	85 f6                	test   %esi,%esi
+  802773:	75 2d                	jne    8027a2 <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  802775:	89 da                	mov    %ebx,%edx
+  802777:	89 f8                	mov    %edi,%eax
+  802779:	e8 14 fd ff ff       	call   802492 <_pipeisclosed>
+  80277e:	85 c0                	test   %eax,%eax
+  802780:	75 4c                	jne    8027ce <devpipe_read+0x87>
+      sys_yield();
+  802782:	e8 bc e6 ff ff       	call   800e43 <sys_yield>
+  802787:	eb e1                	jmp    80276a <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  802789:	83 ec 08             	sub    $0x8,%esp
+  80278c:	6a 00                	push   $0x0
+  80278e:	ff 75 10             	push   0x10(%ebp)
+  802791:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802794:	89 c2                	mov    %eax,%edx
+  802796:	89 f8                	mov    %edi,%eax
+  802798:	e8 c3 fe ff ff       	call   802660 <devpipe_read_bulk>
+  80279d:	83 c4 10             	add    $0x10,%esp
+  8027a0:	eb 02                	jmp    8027a4 <devpipe_read+0x5d>
+        return i;
+  8027a2:	89 f0                	mov    %esi,%eax
+}
+  8027a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027a7:	5b                   	pop    %ebx
+  8027a8:	5e                   	pop    %esi
+  8027a9:	5f                   	pop    %edi
+  8027aa:	5d                   	pop    %ebp
+  8027ab:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8027ac:	99                   	cltd
+  8027ad:	c1 ea 1b             	shr    $0x1b,%edx
+  8027b0:	01 d0                	add    %edx,%eax
+  8027b2:	83 e0 1f             	and    $0x1f,%eax
+  8027b5:	29 d0                	sub    %edx,%eax
+  8027b7:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8027bc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8027bf:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  8027c2:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  8027c5:	83 c6 01             	add    $0x1,%esi
+  8027c8:	eb 9b                	jmp    802765 <devpipe_read+0x1e>
+  return i;
+  8027ca:	89 f0                	mov    %esi,%eax
+  8027cc:	eb d6                	jmp    8027a4 <devpipe_read+0x5d>
+        return 0;
+  8027ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027d3:	eb cf                	jmp    8027a4 <devpipe_read+0x5d>
+
+008027d5 <pipe2>:
+{
+  8027d5:	55                   	push   %ebp
+  8027d6:	89 e5                	mov    %esp,%ebp
+  8027d8:	57                   	push   %edi
+  8027d9:	56                   	push   %esi
+  8027da:	53                   	push   %ebx
+  8027db:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  8027de:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8027e1:	50                   	push   %eax
+  8027e2:	e8 91 eb ff ff       	call   801378 <fd_alloc>
+  8027e7:	89 c3                	mov    %eax,%ebx
+  8027e9:	83 c4 10             	add    $0x10,%esp
+  8027ec:	85 c0                	test   %eax,%eax
+  8027ee:	0f 88 fb 01 00 00    	js     8029ef <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8027f4:	83 ec 04             	sub    $0x4,%esp
+  8027f7:	68 07 04 00 00       	push   $0x407
+  8027fc:	ff 75 e4             	push   -0x1c(%ebp)
+  8027ff:	6a 00                	push   $0x0
+  802801:	e8 9f e6 ff ff       	call   800ea5 <sys_page_alloc>
+  802806:	89 c3                	mov    %eax,%ebx
+  802808:	83 c4 10             	add    $0x10,%esp
+  80280b:	85 c0                	test   %eax,%eax
+  80280d:	0f 88 dc 01 00 00    	js     8029ef <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  802813:	83 ec 0c             	sub    $0xc,%esp
+  802816:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  802819:	50                   	push   %eax
+  80281a:	e8 59 eb ff ff       	call   801378 <fd_alloc>
+  80281f:	89 c3                	mov    %eax,%ebx
+  802821:	83 c4 10             	add    $0x10,%esp
+  802824:	85 c0                	test   %eax,%eax
+  802826:	0f 88 b3 01 00 00    	js     8029df <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80282c:	83 ec 04             	sub    $0x4,%esp
+  80282f:	68 07 04 00 00       	push   $0x407
+  802834:	ff 75 e0             	push   -0x20(%ebp)
+  802837:	6a 00                	push   $0x0
+  802839:	e8 67 e6 ff ff       	call   800ea5 <sys_page_alloc>
+  80283e:	89 c3                	mov    %eax,%ebx
+  802840:	83 c4 10             	add    $0x10,%esp
+  802843:	85 c0                	test   %eax,%eax
+  802845:	0f 88 94 01 00 00    	js     8029df <pipe2+0x20a>
+  va = fd2data(fd0);
+  80284b:	83 ec 0c             	sub    $0xc,%esp
+  80284e:	ff 75 e4             	push   -0x1c(%ebp)
+  802851:	e8 0e eb ff ff       	call   801364 <fd2data>
+  802856:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802858:	83 c4 0c             	add    $0xc,%esp
+  80285b:	68 07 04 00 00       	push   $0x407
+  802860:	50                   	push   %eax
+  802861:	6a 00                	push   $0x0
+  802863:	e8 3d e6 ff ff       	call   800ea5 <sys_page_alloc>
+  802868:	89 c3                	mov    %eax,%ebx
+  80286a:	83 c4 10             	add    $0x10,%esp
+  80286d:	85 c0                	test   %eax,%eax
+  80286f:	0f 88 5a 01 00 00    	js     8029cf <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802875:	83 ec 0c             	sub    $0xc,%esp
+  802878:	ff 75 e0             	push   -0x20(%ebp)
+  80287b:	e8 e4 ea ff ff       	call   801364 <fd2data>
+  802880:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802887:	50                   	push   %eax
+  802888:	6a 00                	push   $0x0
+  80288a:	57                   	push   %edi
+  80288b:	6a 00                	push   $0x0
+  80288d:	e8 56 e6 ff ff       	call   800ee8 <sys_page_map>
+  802892:	89 c3                	mov    %eax,%ebx
+  802894:	83 c4 20             	add    $0x20,%esp
+  802897:	85 c0                	test   %eax,%eax
+  802899:	0f 88 22 01 00 00    	js     8029c1 <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  80289f:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  8028a3:	74 72                	je     802917 <pipe2+0x142>
+  8028a5:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  8028aa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8028ad:	e8 d3 fa ff ff       	call   802385 <pipe_ring>
+  8028b2:	83 ec 04             	sub    $0x4,%esp
+  8028b5:	68 07 04 00 00       	push   $0x407
+  8028ba:	01 f0                	add    %esi,%eax
+  8028bc:	50                   	push   %eax
+  8028bd:	6a 00                	push   $0x0
+  8028bf:	e8 e1 e5 ff ff       	call   800ea5 <sys_page_alloc>
+  8028c4:	89 c3                	mov    %eax,%ebx
+  8028c6:	83 c4 10             	add    $0x10,%esp
+  8028c9:	85 c0                	test   %eax,%eax
+  8028cb:	0f 88 97 00 00 00    	js     802968 <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  8028d1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8028d4:	e8 ac fa ff ff       	call   802385 <pipe_ring>
+  8028d9:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  8028dc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8028df:	e8 a1 fa ff ff       	call   802385 <pipe_ring>
+  8028e4:	83 ec 0c             	sub    $0xc,%esp
+  8028e7:	68 07 04 00 00       	push   $0x407
+  8028ec:	53                   	push   %ebx
+  8028ed:	6a 00                	push   $0x0
+  8028ef:	01 f0                	add    %esi,%eax
+  8028f1:	50                   	push   %eax
+  8028f2:	6a 00                	push   $0x0
+  8028f4:	e8 ef e5 ff ff       	call   800ee8 <sys_page_map>
+  8028f9:	89 c3                	mov    %eax,%ebx
+  8028fb:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802901:	83 c4 20             	add    $0x20,%esp
+  802904:	85 c0                	test   %eax,%eax
+  802906:	78 60                	js     802968 <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  802908:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  80290e:	75 9a                	jne    8028aa <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  802910:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  802917:	a1 20 40 80 00       	mov    0x804020,%eax
+  80291c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80291f:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  802921:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802924:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  80292b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80292e:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  802930:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802933:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  80293a:	83 ec 0c             	sub    $0xc,%esp
+  80293d:	ff 75 e4             	push   -0x1c(%ebp)
+  802940:	e8 0f ea ff ff       	call   801354 <fd2num>
+  802945:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802948:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  80294a:	83 c4 04             	add    $0x4,%esp
+  80294d:	ff 75 e0             	push   -0x20(%ebp)
+  802950:	e8 ff e9 ff ff       	call   801354 <fd2num>
+  802955:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802958:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  80295b:	83 c4 10             	add    $0x10,%esp
+  80295e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802963:	e9 87 00 00 00       	jmp    8029ef <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802968:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  80296d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802970:	e8 10 fa ff ff       	call   802385 <pipe_ring>
+  802975:	83 ec 08             	sub    $0x8,%esp
+  802978:	01 f0                	add    %esi,%eax
+  80297a:	50                   	push   %eax
+  80297b:	6a 00                	push   $0x0
+  80297d:	e8 a8 e5 ff ff       	call   800f2a <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  802982:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802985:	e8 fb f9 ff ff       	call   802385 <pipe_ring>
+  80298a:	83 c4 08             	add    $0x8,%esp
+  80298d:	01 f0                	add    %esi,%eax
+  80298f:	50                   	push   %eax
+  802990:	6a 00                	push   $0x0
+  802992:	e8 93 e5 ff ff       	call   800f2a <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802997:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80299d:	83 c4 10             	add    $0x10,%esp
+  8029a0:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  8029a6:	75 c5                	jne    80296d <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  8029a8:	83 ec 0c             	sub    $0xc,%esp
+  8029ab:	ff 75 e0             	push   -0x20(%ebp)
+  8029ae:	e8 b1 e9 ff ff       	call   801364 <fd2data>
+  8029b3:	83 c4 08             	add    $0x8,%esp
+  8029b6:	50                   	push   %eax
+  8029b7:	6a 00                	push   $0x0
+  8029b9:	e8 6c e5 ff ff       	call   800f2a <sys_page_unmap>
+  8029be:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  8029c1:	83 ec 08             	sub    $0x8,%esp
+  8029c4:	57                   	push   %edi
+  8029c5:	6a 00                	push   $0x0
+  8029c7:	e8 5e e5 ff ff       	call   800f2a <sys_page_unmap>
+  8029cc:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  8029cf:	83 ec 08             	sub    $0x8,%esp
+  8029d2:	ff 75 e0             	push   -0x20(%ebp)
+  8029d5:	6a 00                	push   $0x0
+  8029d7:	e8 4e e5 ff ff       	call   800f2a <sys_page_unmap>
+  8029dc:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  8029df:	83 ec 08             	sub    $0x8,%esp
+  8029e2:	ff 75 e4             	push   -0x1c(%ebp)
+  8029e5:	6a 00                	push   $0x0
+  8029e7:	e8 3e e5 ff ff       	call   800f2a <sys_page_unmap>
+  8029ec:	83 c4 10             	add    $0x10,%esp
+}
+  8029ef:	89 d8                	mov    %ebx,%eax
+  8029f1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029f4:	5b                   	pop    %ebx
+  8029f5:	5e                   	pop    %esi
+  8029f6:	5f                   	pop    %edi
+  8029f7:	5d                   	pop    %ebp
+  8029f8:	c3                   	ret
+
+008029f9 <pipe>:
+{
+  8029f9:	55                   	push   %ebp
+  8029fa:	89 e5                	mov    %esp,%ebp
+  8029fc:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  8029ff:	6a 00                	push   $0x0
+  802a01:	ff 75 08             	push   0x8(%ebp)
+  802a04:	e8 cc fd ff ff       	call   8027d5 <pipe2>
+}
+  802a09:	c9                   	leave
+  802a0a:	c3                   	ret
+
+00802a0b <pipeisclosed>:
+{
+  802a0b:	55                   	push   %ebp
+  802a0c:	89 e5                	mov    %esp,%ebp
+  802a0e:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802a11:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a14:	50                   	push   %eax
+  802a15:	ff 75 08             	push   0x8(%ebp)
+  802a18:	e8 b1 e9 ff ff       	call   8013ce <fd_lookup>
+  802a1d:	83 c4 10             	add    $0x10,%esp
+  802a20:	85 c0                	test   %eax,%eax
+  802a22:	78 18                	js     802a3c <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  802a24:	83 ec 0c             	sub    $0xc,%esp
+  802a27:	ff 75 f4             	push   -0xc(%ebp)
+  802a2a:	e8 35 e9 ff ff       	call   801364 <fd2data>
+  802a2f:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  802a31:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a34:	e8 59 fa ff ff       	call   802492 <_pipeisclosed>
+  802a39:	83 c4 10             	add    $0x10,%esp
+}
+  802a3c:	c9                   	leave
+  802a3d:	c3                   	ret
+
+00802a3e <pipe_splice>:
+{
+  802a3e:	55                   	push   %ebp
+  802a3f:	89 e5                	mov    %esp,%ebp
+  802a41:	57                   	push   %edi
+  802a42:	56                   	push   %esi
+  802a43:	53                   	push   %ebx
+  802a44:	83 ec 34             	sub    $0x34,%esp
+  802a47:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802a4a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802a4d:	50                   	push   %eax
+  802a4e:	ff 75 08             	push   0x8(%ebp)
+  802a51:	e8 78 e9 ff ff       	call   8013ce <fd_lookup>
+  802a56:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802a59:	83 c4 10             	add    $0x10,%esp
+  802a5c:	85 c0                	test   %eax,%eax
+  802a5e:	0f 88 d7 00 00 00    	js     802b3b <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  802a64:	83 ec 0c             	sub    $0xc,%esp
+  802a67:	ff 75 e4             	push   -0x1c(%ebp)
+  802a6a:	e8 f5 e8 ff ff       	call   801364 <fd2data>
+  802a6f:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802a71:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802a74:	83 c4 10             	add    $0x10,%esp
+  802a77:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802a7d:	39 10                	cmp    %edx,(%eax)
+  802a7f:	0f 85 c1 00 00 00    	jne    802b46 <pipe_splice+0x108>
+  802a85:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  802a89:	0f 84 c0 00 00 00    	je     802b4f <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  802a8f:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802a93:	0f 84 bf 00 00 00    	je     802b58 <pipe_splice+0x11a>
+  802a99:	89 f7                	mov    %esi,%edi
+  802a9b:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  802aa1:	0f 85 ba 00 00 00    	jne    802b61 <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802aa7:	8d 43 04             	lea    0x4(%ebx),%eax
+  802aaa:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802aad:	eb 38                	jmp    802ae7 <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802aaf:	83 ec 0c             	sub    $0xc,%esp
+  802ab2:	68 00 10 00 00       	push   $0x1000
+  802ab7:	89 f1                	mov    %esi,%ecx
+  802ab9:	89 da                	mov    %ebx,%edx
+  802abb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802abe:	e8 34 fa ff ff       	call   8024f7 <devpipe_write_bulk>
+  802ac3:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802ac6:	83 c4 10             	add    $0x10,%esp
+  802ac9:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802ace:	75 53                	jne    802b23 <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  802ad0:	83 ec 08             	sub    $0x8,%esp
+  802ad3:	56                   	push   %esi
+  802ad4:	6a 00                	push   $0x0
+  802ad6:	e8 4f e4 ff ff       	call   800f2a <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  802adb:	83 c7 01             	add    $0x1,%edi
+  802ade:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802ae4:	83 c4 10             	add    $0x10,%esp
+  802ae7:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802aea:	74 3a                	je     802b26 <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  802aec:	8b 03                	mov    (%ebx),%eax
+  802aee:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802af1:	75 bc                	jne    802aaf <pipe_splice+0x71>
+  802af3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802af8:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  802afc:	85 c0                	test   %eax,%eax
+  802afe:	74 af                	je     802aaf <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802b00:	83 ec 04             	sub    $0x4,%esp
+  802b03:	6a 07                	push   $0x7
+  802b05:	56                   	push   %esi
+  802b06:	ff 75 d0             	push   -0x30(%ebp)
+  802b09:	e8 f3 e6 ff ff       	call   801201 <sys_chan_wakeup>
+  802b0e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802b11:	83 c4 10             	add    $0x10,%esp
+  802b14:	85 c0                	test   %eax,%eax
+  802b16:	79 b8                	jns    802ad0 <pipe_splice+0x92>
+  802b18:	b8 01 00 00 00       	mov    $0x1,%eax
+  802b1d:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802b21:	eb 8c                	jmp    802aaf <pipe_splice+0x71>
+  802b23:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  802b26:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802b2a:	75 06                	jne    802b32 <pipe_splice+0xf4>
+  802b2c:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802b30:	78 09                	js     802b3b <pipe_splice+0xfd>
+  return i * PGSIZE;
+  802b32:	8b 45 10             	mov    0x10(%ebp),%eax
+  802b35:	c1 e0 0c             	shl    $0xc,%eax
+  802b38:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  802b3b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802b3e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b41:	5b                   	pop    %ebx
+  802b42:	5e                   	pop    %esi
+  802b43:	5f                   	pop    %edi
+  802b44:	5d                   	pop    %ebp
+  802b45:	c3                   	ret
+    return -E_INVAL;
+  802b46:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802b4d:	eb ec                	jmp    802b3b <pipe_splice+0xfd>
+  802b4f:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802b56:	eb e3                	jmp    802b3b <pipe_splice+0xfd>
+  802b58:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802b5f:	eb da                	jmp    802b3b <pipe_splice+0xfd>
+  802b61:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802b68:	eb d1                	jmp    802b3b <pipe_splice+0xfd>
+
+00802b6a <pipe_splice_read>:
+{
+  802b6a:	55                   	push   %ebp
+  802b6b:	89 e5                	mov    %esp,%ebp
+  802b6d:	53                   	push   %ebx
+  802b6e:	83 ec 1c             	sub    $0x1c,%esp
+  802b71:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802b74:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b77:	50                   	push   %eax
+  802b78:	ff 75 08             	push   0x8(%ebp)
+  802b7b:	e8 4e e8 ff ff       	call   8013ce <fd_lookup>
+  802b80:	83 c4 10             	add    $0x10,%esp
+  802b83:	85 c0                	test   %eax,%eax
+  802b85:	78 49                	js     802bd0 <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  802b87:	83 ec 0c             	sub    $0xc,%esp
+  802b8a:	ff 75 f4             	push   -0xc(%ebp)
+  802b8d:	e8 d2 e7 ff ff       	call   801364 <fd2data>
+  802b92:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802b94:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b97:	83 c4 10             	add    $0x10,%esp
+  802b9a:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  802ba0:	39 08                	cmp    %ecx,(%eax)
+  802ba2:	75 31                	jne    802bd5 <pipe_splice_read+0x6b>
+  802ba4:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  802ba8:	74 32                	je     802bdc <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  802baa:	8b 48 08             	mov    0x8(%eax),%ecx
+  802bad:	83 e1 03             	and    $0x3,%ecx
+  802bb0:	83 f9 01             	cmp    $0x1,%ecx
+  802bb3:	74 2e                	je     802be3 <pipe_splice_read+0x79>
+  802bb5:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  802bbb:	75 2d                	jne    802bea <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  802bbd:	83 ec 08             	sub    $0x8,%esp
+  802bc0:	53                   	push   %ebx
+  802bc1:	68 00 10 00 00       	push   $0x1000
+  802bc6:	89 d9                	mov    %ebx,%ecx
+  802bc8:	e8 93 fa ff ff       	call   802660 <devpipe_read_bulk>
+  802bcd:	83 c4 10             	add    $0x10,%esp
+}
+  802bd0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802bd3:	c9                   	leave
+  802bd4:	c3                   	ret
+    return -E_INVAL;
+  802bd5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802bda:	eb f4                	jmp    802bd0 <pipe_splice_read+0x66>
+  802bdc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802be1:	eb ed                	jmp    802bd0 <pipe_splice_read+0x66>
+  802be3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802be8:	eb e6                	jmp    802bd0 <pipe_splice_read+0x66>
+  802bea:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802bef:	eb df                	jmp    802bd0 <pipe_splice_read+0x66>
+
+00802bf1 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  802bf1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bf6:	c3                   	ret
+
+00802bf7 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802bf7:	55                   	push   %ebp
+  802bf8:	89 e5                	mov    %esp,%ebp
+  802bfa:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  802bfd:	68 a7 36 80 00       	push   $0x8036a7
+  802c02:	ff 75 0c             	push   0xc(%ebp)
+  802c05:	e8 6c de ff ff       	call   800a76 <strcpy>
+  return 0;
+}
+  802c0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c0f:	c9                   	leave
+  802c10:	c3                   	ret
+
+00802c11 <devcons_write>:
+{
+  802c11:	55                   	push   %ebp
+  802c12:	89 e5                	mov    %esp,%ebp
+  802c14:	57                   	push   %edi
+  802c15:	56                   	push   %esi
+  802c16:	53                   	push   %ebx
+  802c17:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  802c1d:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  802c22:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  802c28:	eb 2e                	jmp    802c58 <devcons_write+0x47>
+    m = n - tot;
+  802c2a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802c2d:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  802c2f:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802c34:	39 c3                	cmp    %eax,%ebx
+  802c36:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  802c39:	83 ec 04             	sub    $0x4,%esp
+  802c3c:	53                   	push   %ebx
+  802c3d:	89 f0                	mov    %esi,%eax
+  802c3f:	03 45 0c             	add    0xc(%ebp),%eax
+  802c42:	50                   	push   %eax
+  802c43:	57                   	push   %edi
+  802c44:	e8 b3 df ff ff       	call   800bfc <memmove>
+    sys_cputs(buf, m);
+  802c49:	83 c4 08             	add    $0x8,%esp
+  802c4c:	53                   	push   %ebx
+  802c4d:	57                   	push   %edi
+  802c4e:	e8 53 e1 ff ff       	call   800da6 <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  802c53:	01 de                	add    %ebx,%esi
+  802c55:	83 c4 10             	add    $0x10,%esp
+  802c58:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802c5b:	72 cd                	jb     802c2a <devcons_write+0x19>
+}
+  802c5d:	89 f0                	mov    %esi,%eax
+  802c5f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c62:	5b                   	pop    %ebx
+  802c63:	5e                   	pop    %esi
+  802c64:	5f                   	pop    %edi
+  802c65:	5d                   	pop    %ebp
+  802c66:	c3                   	ret
+
+00802c67 <devcons_read>:
+{
+  802c67:	55                   	push   %ebp
+  802c68:	89 e5                	mov    %esp,%ebp
+  802c6a:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  802c6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c72:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802c76:	75 07                	jne    802c7f <devcons_read+0x18>
+  802c78:	eb 1f                	jmp    802c99 <devcons_read+0x32>
+    sys_yield();
+  802c7a:	e8 c4 e1 ff ff       	call   800e43 <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  802c7f:	e8 40 e1 ff ff       	call   800dc4 <sys_cgetc>
+  802c84:	85 c0                	test   %eax,%eax
+  802c86:	74 f2                	je     802c7a <devcons_read+0x13>
+  if (c < 0)
+  802c88:	78 0f                	js     802c99 <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  802c8a:	83 f8 04             	cmp    $0x4,%eax
+  802c8d:	74 0c                	je     802c9b <devcons_read+0x34>
+  *(char*)vbuf = c;
+  802c8f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802c92:	88 02                	mov    %al,(%edx)
+  return 1;
+  802c94:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802c99:	c9                   	leave
+  802c9a:	c3                   	ret
+    return 0;
+  802c9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ca0:	eb f7                	jmp    802c99 <devcons_read+0x32>
+
+00802ca2 <cputchar>:
+{
+  802ca2:	55                   	push   %ebp
+  802ca3:	89 e5                	mov    %esp,%ebp
+  802ca5:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  802ca8:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cab:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  802cae:	6a 01                	push   $0x1
+  802cb0:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802cb3:	50                   	push   %eax
+  802cb4:	e8 ed e0 ff ff       	call   800da6 <sys_cputs>
+}
+  802cb9:	83 c4 10             	add    $0x10,%esp
+  802cbc:	c9                   	leave
+  802cbd:	c3                   	ret
+
+00802cbe <getchar>:
+{
+  802cbe:	55                   	push   %ebp
+  802cbf:	89 e5                	mov    %esp,%ebp
+  802cc1:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  802cc4:	6a 01                	push   $0x1
+  802cc6:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802cc9:	50                   	push   %eax
+  802cca:	6a 00                	push   $0x0
+  802ccc:	e8 a8 e9 ff ff       	call   801679 <read>
+  if (r < 0)
+  802cd1:	83 c4 10             	add    $0x10,%esp
+  802cd4:	85 c0                	test   %eax,%eax
+  802cd6:	78 06                	js     802cde <getchar+0x20>
+  if (r < 1)
+  802cd8:	74 06                	je     802ce0 <getchar+0x22>
+  return c;
+  802cda:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802cde:	c9                   	leave
+  802cdf:	c3                   	ret
+    return -E_EOF;
+  802ce0:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802ce5:	eb f7                	jmp    802cde <getchar+0x20>
+
+00802ce7 <iscons>:
+{
+  802ce7:	55                   	push   %ebp
+  802ce8:	89 e5                	mov    %esp,%ebp
+  802cea:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802ced:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802cf0:	50                   	push   %eax
+  802cf1:	ff 75 08             	push   0x8(%ebp)
+  802cf4:	e8 d5 e6 ff ff       	call   8013ce <fd_lookup>
+  802cf9:	83 c4 10             	add    $0x10,%esp
+  802cfc:	85 c0                	test   %eax,%eax
+  802cfe:	78 11                	js     802d11 <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  802d00:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802d03:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802d09:	39 10                	cmp    %edx,(%eax)
+  802d0b:	0f 94 c0             	sete   %al
+  802d0e:	0f b6 c0             	movzbl %al,%eax
+}
+  802d11:	c9                   	leave
+  802d12:	c3                   	ret
+
+00802d13 <opencons>:
+{
+  802d13:	55                   	push   %ebp
+  802d14:	89 e5                	mov    %esp,%ebp
+  802d16:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  802d19:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802d1c:	50                   	push   %eax
+  802d1d:	e8 56 e6 ff ff       	call   801378 <fd_alloc>
+  802d22:	83 c4 10             	add    $0x10,%esp
+  802d25:	85 c0                	test   %eax,%eax
+  802d27:	78 3a                	js     802d63 <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802d29:	83 ec 04             	sub    $0x4,%esp
+  802d2c:	68 07 04 00 00       	push   $0x407
+  802d31:	ff 75 f4             	push   -0xc(%ebp)
+  802d34:	6a 00                	push   $0x0
+  802d36:	e8 6a e1 ff ff       	call   800ea5 <sys_page_alloc>
+  802d3b:	83 c4 10             	add    $0x10,%esp
+  802d3e:	85 c0                	test   %eax,%eax
+  802d40:	78 21                	js     802d63 <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  802d42:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802d45:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802d4b:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  802d4d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802d50:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  802d57:	83 ec 0c             	sub    $0xc,%esp
+  802d5a:	50                   	push   %eax
+  802d5b:	e8 f4 e5 ff ff       	call   801354 <fd2num>
+  802d60:	83 c4 10             	add    $0x10,%esp
+}
+  802d63:	c9                   	leave
+  802d64:	c3                   	ret
+
+00802d65 <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  802d65:	55                   	push   %ebp
+  802d66:	89 e5                	mov    %esp,%ebp
+  802d68:	57                   	push   %edi
+  802d69:	56                   	push   %esi
+  802d6a:	53                   	push   %ebx
+  802d6b:	83 ec 14             	sub    $0x14,%esp
+  802d6e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802d71:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d74:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802d77:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  802d7a:	85 c0                	test   %eax,%eax
+  802d7c:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802d81:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  802d84:	ff 33                	push   (%ebx)
+  802d86:	50                   	push   %eax
+  802d87:	e8 f1 e3 ff ff       	call   80117d <sys_ipc_recv>
+  802d8c:	83 c4 10             	add    $0x10,%esp
+  802d8f:	85 c0                	test   %eax,%eax
+  802d91:	78 39                	js     802dcc <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  802d93:	85 ff                	test   %edi,%edi
+  802d95:	74 0a                	je     802da1 <ipc_recv_pages+0x3c>
+  802d97:	a1 44 87 80 00       	mov    0x808744,%eax
+  802d9c:	8b 40 7c             	mov    0x7c(%eax),%eax
+  802d9f:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  802da1:	85 f6                	test   %esi,%esi
+  802da3:	74 0d                	je     802db2 <ipc_recv_pages+0x4d>
+  802da5:	a1 44 87 80 00       	mov    0x808744,%eax
+  802daa:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  802db0:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  802db2:	a1 44 87 80 00       	mov    0x808744,%eax
+  802db7:	8b 40 74             	mov    0x74(%eax),%eax
+  802dba:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  802dbc:	a1 44 87 80 00       	mov    0x808744,%eax
+  802dc1:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  802dc4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802dc7:	5b                   	pop    %ebx
+  802dc8:	5e                   	pop    %esi
+  802dc9:	5f                   	pop    %edi
+  802dca:	5d                   	pop    %ebp
+  802dcb:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  802dcc:	85 ff                	test   %edi,%edi
+  802dce:	74 06                	je     802dd6 <ipc_recv_pages+0x71>
+  802dd0:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  802dd6:	85 f6                	test   %esi,%esi
+  802dd8:	74 06                	je     802de0 <ipc_recv_pages+0x7b>
+  802dda:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  802de0:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  802de6:	eb dc                	jmp    802dc4 <ipc_recv_pages+0x5f>
+
+00802de8 <ipc_recv>:
+{
+  802de8:	55                   	push   %ebp
+  802de9:	89 e5                	mov    %esp,%ebp
+  802deb:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  802dee:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  802df5:	ff 75 10             	push   0x10(%ebp)
+  802df8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802dfb:	50                   	push   %eax
+  802dfc:	ff 75 0c             	push   0xc(%ebp)
+  802dff:	ff 75 08             	push   0x8(%ebp)
+  802e02:	e8 5e ff ff ff       	call   802d65 <ipc_recv_pages>
+}
+  802e07:	c9                   	leave
+  802e08:	c3                   	ret
+
+00802e09 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  802e09:	55                   	push   %ebp
+  802e0a:	89 e5                	mov    %esp,%ebp
+  802e0c:	57                   	push   %edi
+  802e0d:	56                   	push   %esi
+  802e0e:	53                   	push   %ebx
+  802e0f:	83 ec 0c             	sub    $0xc,%esp
+  802e12:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802e15:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802e18:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  802e1b:	89 c3                	mov    %eax,%ebx
+  802e1d:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  802e23:	85 c0                	test   %eax,%eax
+  802e25:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802e2a:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  802e2d:	83 ec 0c             	sub    $0xc,%esp
+  802e30:	ff 75 14             	push   0x14(%ebp)
+  802e33:	ff 75 18             	push   0x18(%ebp)
+  802e36:	53                   	push   %ebx
+  802e37:	56                   	push   %esi
+  802e38:	57                   	push   %edi
+  802e39:	e8 1e e3 ff ff       	call   80115c <sys_ipc_try_send>
+  802e3e:	83 c4 20             	add    $0x20,%esp
+  802e41:	85 c0                	test   %eax,%eax
+  802e43:	79 1e                	jns    802e63 <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  802e45:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802e48:	75 07                	jne    802e51 <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  802e4a:	e8 f4 df ff ff       	call   800e43 <sys_yield>
+  802e4f:	eb dc                	jmp    802e2d <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  802e51:	50                   	push   %eax
+  802e52:	68 b3 36 80 00       	push   $0x8036b3
+  802e57:	6a 5c                	push   $0x5c
+  802e59:	68 c0 36 80 00       	push   $0x8036c0
+  802e5e:	e8 4a d5 ff ff       	call   8003ad <_panic>
+  }
+}
+  802e63:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e66:	5b                   	pop    %ebx
+  802e67:	5e                   	pop    %esi
+  802e68:	5f                   	pop    %edi
+  802e69:	5d                   	pop    %ebp
+  802e6a:	c3                   	ret
+
+00802e6b <ipc_send>:
+{
+  802e6b:	55                   	push   %ebp
+  802e6c:	89 e5                	mov    %esp,%ebp
+  802e6e:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  802e71:	ff 75 14             	push   0x14(%ebp)
+  802e74:	6a 01                	push   $0x1
+  802e76:	ff 75 10             	push   0x10(%ebp)
+  802e79:	ff 75 0c             	push   0xc(%ebp)
+  802e7c:	ff 75 08             	push   0x8(%ebp)
+  802e7f:	e8 85 ff ff ff       	call   802e09 <ipc_send_pages>
+}
+  802e84:	83 c4 20             	add    $0x20,%esp
+  802e87:	c9                   	leave
+  802e88:	c3                   	ret
+
+00802e89 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802e89:	55                   	push   %ebp
+  802e8a:	89 e5                	mov    %esp,%ebp
+  802e8c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  802e8f:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  802e94:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802e97:	c1 e0 04             	shl    $0x4,%eax
+  802e9a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802e9f:	8b 40 50             	mov    0x50(%eax),%eax
+  802ea2:	39 c8                	cmp    %ecx,%eax
+  802ea4:	74 12                	je     802eb8 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  802ea6:	83 c2 01             	add    $0x1,%edx
+  802ea9:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802eaf:	75 e3                	jne    802e94 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  802eb1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802eb6:	eb 0e                	jmp    802ec6 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  802eb8:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802ebb:	c1 e0 04             	shl    $0x4,%eax
+  802ebe:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802ec3:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802ec6:	5d                   	pop    %ebp
+  802ec7:	c3                   	ret
+
+00802ec8 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802ec8:	55                   	push   %ebp
+  802ec9:	89 e5                	mov    %esp,%ebp
+  802ecb:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802ece:	89 c2                	mov    %eax,%edx
+  802ed0:	c1 ea 16             	shr    $0x16,%edx
+  802ed3:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  802eda:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802edf:	f6 c1 01             	test   $0x1,%cl
+  802ee2:	74 1c                	je     802f00 <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  802ee4:	c1 e8 0c             	shr    $0xc,%eax
+  802ee7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  802eee:	a8 01                	test   $0x1,%al
+  802ef0:	74 0e                	je     802f00 <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  802ef2:	c1 e8 0c             	shr    $0xc,%eax
+  802ef5:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802efc:	ef 
+  802efd:	0f b7 d2             	movzwl %dx,%edx
+}
+  802f00:	89 d0                	mov    %edx,%eax
+  802f02:	5d                   	pop    %ebp
+  802f03:	c3                   	ret
+
+00802f04 <udivmod>:
+  802f04:	55                   	push   %ebp
+  802f05:	57                   	push   %edi
+  802f06:	56                   	push   %esi
+  802f07:	53                   	push   %ebx
+  802f08:	83 ec 14             	sub    $0x14,%esp
+  802f0b:	8b 74 24 28          	mov    0x28(%esp),%esi
+  802f0f:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  802f13:	89 fb                	mov    %edi,%ebx
+  802f15:	09 f3                	or     %esi,%ebx
+  802f17:	0f 84 88 00 00 00    	je     802fa5 <udivmod+0xa1>
+  802f1d:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802f22:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802f29:	00 
+  802f2a:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802f31:	00 
+  802f32:	89 cd                	mov    %ecx,%ebp
+  802f34:	89 34 24             	mov    %esi,(%esp)
+  802f37:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802f3b:	eb 08                	jmp    802f45 <udivmod+0x41>
+  802f3d:	83 ed 01             	sub    $0x1,%ebp
+  802f40:	83 fd ff             	cmp    $0xffffffff,%ebp
+  802f43:	74 6c                	je     802fb1 <udivmod+0xad>
+  802f45:	89 c3                	mov    %eax,%ebx
+  802f47:	89 d6                	mov    %edx,%esi
+  802f49:	89 e9                	mov    %ebp,%ecx
+  802f4b:	0f ad f3             	shrd   %cl,%esi,%ebx
+  802f4e:	d3 ee                	shr    %cl,%esi
+  802f50:	f6 c1 20             	test   $0x20,%cl
+  802f53:	74 04                	je     802f59 <udivmod+0x55>
+  802f55:	89 f3                	mov    %esi,%ebx
+  802f57:	31 f6                	xor    %esi,%esi
+  802f59:	8b 3c 24             	mov    (%esp),%edi
+  802f5c:	39 fb                	cmp    %edi,%ebx
+  802f5e:	89 f7                	mov    %esi,%edi
+  802f60:	8b 1c 24             	mov    (%esp),%ebx
+  802f63:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802f67:	19 f7                	sbb    %esi,%edi
+  802f69:	72 d2                	jb     802f3d <udivmod+0x39>
+  802f6b:	89 f7                	mov    %esi,%edi
+  802f6d:	89 de                	mov    %ebx,%esi
+  802f6f:	89 e9                	mov    %ebp,%ecx
+  802f71:	0f a5 f7             	shld   %cl,%esi,%edi
+  802f74:	d3 e6                	shl    %cl,%esi
+  802f76:	f6 c1 20             	test   $0x20,%cl
+  802f79:	74 04                	je     802f7f <udivmod+0x7b>
+  802f7b:	89 f7                	mov    %esi,%edi
+  802f7d:	31 f6                	xor    %esi,%esi
+  802f7f:	29 f0                	sub    %esi,%eax
+  802f81:	19 fa                	sbb    %edi,%edx
+  802f83:	be 01 00 00 00       	mov    $0x1,%esi
+  802f88:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f8d:	0f a5 f7             	shld   %cl,%esi,%edi
+  802f90:	d3 e6                	shl    %cl,%esi
+  802f92:	f6 c1 20             	test   $0x20,%cl
+  802f95:	74 04                	je     802f9b <udivmod+0x97>
+  802f97:	89 f7                	mov    %esi,%edi
+  802f99:	31 f6                	xor    %esi,%esi
+  802f9b:	09 74 24 08          	or     %esi,0x8(%esp)
+  802f9f:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802fa3:	eb 98                	jmp    802f3d <udivmod+0x39>
+  802fa5:	89 f0                	mov    %esi,%eax
+  802fa7:	89 fa                	mov    %edi,%edx
+  802fa9:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802fad:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802fb1:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802fb5:	89 01                	mov    %eax,(%ecx)
+  802fb7:	89 51 04             	mov    %edx,0x4(%ecx)
+  802fba:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802fbe:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802fc2:	83 c4 14             	add    $0x14,%esp
+  802fc5:	5b                   	pop    %ebx
+  802fc6:	5e                   	pop    %esi
+  802fc7:	5f                   	pop    %edi
+  802fc8:	5d                   	pop    %ebp
+  802fc9:	c3                   	ret
+
+00802fca <__udivdi3>:
+  802fca:	83 ec 18             	sub    $0x18,%esp
+  802fcd:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802fd1:	50                   	push   %eax
+  802fd2:	ff 74 24 2c          	push   0x2c(%esp)
+  802fd6:	ff 74 24 2c          	push   0x2c(%esp)
+  802fda:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802fde:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802fe2:	e8 1d ff ff ff       	call   802f04 <udivmod>
+  802fe7:	83 c4 24             	add    $0x24,%esp
+  802fea:	c3                   	ret
+
+00802feb <__umoddi3>:
+  802feb:	83 ec 18             	sub    $0x18,%esp
+  802fee:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802ff2:	50                   	push   %eax
+  802ff3:	ff 74 24 2c          	push   0x2c(%esp)
+  802ff7:	ff 74 24 2c          	push   0x2c(%esp)
+  802ffb:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802fff:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803003:	e8 fc fe ff ff       	call   802f04 <udivmod>
+  803008:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80300c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803010:	83 c4 24             	add    $0x24,%esp
+  803013:	c3                   	ret
+
+00803014 <__divdi3>:
+  803014:	56                   	push   %esi
+  803015:	53                   	push   %ebx
+  803016:	83 ec 14             	sub    $0x14,%esp
+  803019:	8b 44 24 20          	mov    0x20(%esp),%eax
+  80301d:	8b 54 24 24          	mov    0x24(%esp),%edx
+  803021:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  803025:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  803029:	85 d2                	test   %edx,%edx
+  80302b:	78 18                	js     803045 <__divdi3+0x31>
+  80302d:	85 db                	test   %ebx,%ebx
+  80302f:	78 3e                	js     80306f <__divdi3+0x5b>
+  803031:	83 ec 04             	sub    $0x4,%esp
+  803034:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803038:	56                   	push   %esi
+  803039:	53                   	push   %ebx
+  80303a:	51                   	push   %ecx
+  80303b:	e8 c4 fe ff ff       	call   802f04 <udivmod>
+  803040:	83 c4 10             	add    $0x10,%esp
+  803043:	eb 24                	jmp    803069 <__divdi3+0x55>
+  803045:	f7 d8                	neg    %eax
+  803047:	83 d2 00             	adc    $0x0,%edx
+  80304a:	f7 da                	neg    %edx
+  80304c:	85 db                	test   %ebx,%ebx
+  80304e:	78 3a                	js     80308a <__divdi3+0x76>
+  803050:	83 ec 04             	sub    $0x4,%esp
+  803053:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803057:	56                   	push   %esi
+  803058:	53                   	push   %ebx
+  803059:	51                   	push   %ecx
+  80305a:	e8 a5 fe ff ff       	call   802f04 <udivmod>
+  80305f:	83 c4 10             	add    $0x10,%esp
+  803062:	f7 d8                	neg    %eax
+  803064:	83 d2 00             	adc    $0x0,%edx
+  803067:	f7 da                	neg    %edx
+  803069:	83 c4 14             	add    $0x14,%esp
+  80306c:	5b                   	pop    %ebx
+  80306d:	5e                   	pop    %esi
+  80306e:	c3                   	ret
+  80306f:	83 ec 04             	sub    $0x4,%esp
+  803072:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803076:	56                   	push   %esi
+  803077:	f7 d9                	neg    %ecx
+  803079:	83 d3 00             	adc    $0x0,%ebx
+  80307c:	f7 db                	neg    %ebx
+  80307e:	53                   	push   %ebx
+  80307f:	51                   	push   %ecx
+  803080:	e8 7f fe ff ff       	call   802f04 <udivmod>
+  803085:	83 c4 10             	add    $0x10,%esp
+  803088:	eb d8                	jmp    803062 <__divdi3+0x4e>
+  80308a:	83 ec 04             	sub    $0x4,%esp
+  80308d:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803091:	56                   	push   %esi
+  803092:	f7 d9                	neg    %ecx
+  803094:	83 d3 00             	adc    $0x0,%ebx
+  803097:	f7 db                	neg    %ebx
+  803099:	53                   	push   %ebx
+  80309a:	51                   	push   %ecx
+  80309b:	e8 64 fe ff ff       	call   802f04 <udivmod>
+  8030a0:	83 c4 10             	add    $0x10,%esp
+  8030a3:	eb c4                	jmp    803069 <__divdi3+0x55>
+
+008030a5 <__moddi3>:
+  8030a5:	55                   	push   %ebp
+  8030a6:	57                   	push   %edi
+  8030a7:	56                   	push   %esi
+  8030a8:	53                   	push   %ebx
+  8030a9:	83 ec 24             	sub    $0x24,%esp
+  8030ac:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8030b0:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8030b4:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  8030b8:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  8030bc:	85 d2                	test   %edx,%edx
+  8030be:	78 3b                	js     8030fb <__moddi3+0x56>
+  8030c0:	83 ec 04             	sub    $0x4,%esp
+  8030c3:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8030c7:	56                   	push   %esi
+  8030c8:	89 ce                	mov    %ecx,%esi
+  8030ca:	f7 de                	neg    %esi
+  8030cc:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8030d0:	89 de                	mov    %ebx,%esi
+  8030d2:	83 d6 00             	adc    $0x0,%esi
+  8030d5:	f7 de                	neg    %esi
+  8030d7:	89 74 24 14          	mov    %esi,0x14(%esp)
+  8030db:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8030df:	0f 48 f1             	cmovs  %ecx,%esi
+  8030e2:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  8030e7:	53                   	push   %ebx
+  8030e8:	56                   	push   %esi
+  8030e9:	e8 16 fe ff ff       	call   802f04 <udivmod>
+  8030ee:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8030f2:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8030f6:	83 c4 10             	add    $0x10,%esp
+  8030f9:	eb 47                	jmp    803142 <__moddi3+0x9d>
+  8030fb:	f7 d8                	neg    %eax
+  8030fd:	83 d2 00             	adc    $0x0,%edx
+  803100:	f7 da                	neg    %edx
+  803102:	83 ec 04             	sub    $0x4,%esp
+  803105:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803109:	56                   	push   %esi
+  80310a:	89 cf                	mov    %ecx,%edi
+  80310c:	f7 df                	neg    %edi
+  80310e:	89 de                	mov    %ebx,%esi
+  803110:	83 d6 00             	adc    $0x0,%esi
+  803113:	f7 de                	neg    %esi
+  803115:	0f 49 cf             	cmovns %edi,%ecx
+  803118:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  80311c:	0f 49 de             	cmovns %esi,%ebx
+  80311f:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  803123:	ff 74 24 0c          	push   0xc(%esp)
+  803127:	ff 74 24 0c          	push   0xc(%esp)
+  80312b:	e8 d4 fd ff ff       	call   802f04 <udivmod>
+  803130:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803134:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803138:	f7 d8                	neg    %eax
+  80313a:	83 d2 00             	adc    $0x0,%edx
+  80313d:	f7 da                	neg    %edx
+  80313f:	83 c4 10             	add    $0x10,%esp
+  803142:	83 c4 24             	add    $0x24,%esp
+  803145:	5b                   	pop    %ebx
+  803146:	5e                   	pop    %esi
+  803147:	5f                   	pop    %edi
+  803148:	5d                   	pop    %ebp
+  803149:	c3                   	ret
@@ -0,0 +1,7947 @@
+
+obj/user/cowbench.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 ad 01 00 00       	call   8001de <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <touch>:
+
+#define HEAPVA          0x20000000
+
+static unsigned
+touch(int npages)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	89 c3                	mov    %eax,%ebx
+  unsigned start;
+  int i;
+
+  start = sys_time_msec();
+  80003a:	e8 1e 10 00 00       	call   80105d <sys_time_msec>
+  80003f:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++)
+  800041:	ba 00 00 00 20       	mov    $0x20000000,%edx
+  800046:	b8 00 00 00 00       	mov    $0x0,%eax
+  80004b:	eb 0b                	jmp    800058 <touch+0x25>
+    *(volatile uint32_t *) (HEAPVA + i * PGSIZE) = i;
+  80004d:	89 02                	mov    %eax,(%edx)
+  for (i = 0; i < npages; i++)
+  80004f:	83 c0 01             	add    $0x1,%eax
+  800052:	81 c2 00 10 00 00    	add    $0x1000,%edx
+  800058:	39 d8                	cmp    %ebx,%eax
+  80005a:	7c f1                	jl     80004d <touch+0x1a>
+  return sys_time_msec() - start;
+  80005c:	e8 fc 0f 00 00       	call   80105d <sys_time_msec>
+  800061:	29 f0                	sub    %esi,%eax
+}
+  800063:	5b                   	pop    %ebx
+  800064:	5e                   	pop    %esi
+  800065:	5d                   	pop    %ebp
+  800066:	c3                   	ret
+
+00800067 <run>:
+          mode, what, npages, ms, npages * 1000 / ms);
+}
+
+static void
+run(const char *mode, bool kernel, int npages)
+{
+  800067:	55                   	push   %ebp
+  800068:	89 e5                	mov    %esp,%ebp
+  80006a:	57                   	push   %edi
+  80006b:	56                   	push   %esi
+  80006c:	53                   	push   %ebx
+  80006d:	83 ec 14             	sub    $0x14,%esp
+  800070:	89 c6                	mov    %eax,%esi
+  800072:	89 cb                	mov    %ecx,%ebx
+  envid_t child;
+  unsigned ms;
+  int r;
+
+  if ((r = sys_env_set_cow(0, kernel)) < 0)
+  800074:	0f b6 d2             	movzbl %dl,%edx
+  800077:	52                   	push   %edx
+  800078:	6a 00                	push   $0x0
+  80007a:	e8 81 0c 00 00       	call   800d00 <sys_env_set_cow>
+  80007f:	83 c4 10             	add    $0x10,%esp
+  800082:	85 c0                	test   %eax,%eax
+  800084:	78 57                	js     8000dd <run+0x76>
+    panic("sys_env_set_cow: %e", r);
+
+  if ((child = fork()) < 0)
+  800086:	e8 25 13 00 00       	call   8013b0 <fork>
+  80008b:	89 c7                	mov    %eax,%edi
+  80008d:	85 c0                	test   %eax,%eax
+  80008f:	78 5e                	js     8000ef <run+0x88>
+    panic("fork: %e", child);
+  if (child == 0) {
+  800091:	74 6e                	je     800101 <run+0x9a>
+    report(mode, "copy", npages, touch(npages));
+    exit();
+  }
+  wait(child);
+  800093:	83 ec 0c             	sub    $0xc,%esp
+  800096:	57                   	push   %edi
+  800097:	e8 27 2e 00 00       	call   802ec3 <wait>
+
+  ms = touch(npages);
+  80009c:	89 d8                	mov    %ebx,%eax
+  80009e:	e8 90 ff ff ff       	call   800033 <touch>
+  if (ms == 0)
+  8000a3:	85 c0                	test   %eax,%eax
+  8000a5:	ba 01 00 00 00       	mov    $0x1,%edx
+  8000aa:	89 d1                	mov    %edx,%ecx
+  8000ac:	0f 45 c8             	cmovne %eax,%ecx
+  cprintf("cowbench: %-6s %-6s %5d faults in %5d ms = %7d faults/s\n",
+  8000af:	83 c4 08             	add    $0x8,%esp
+          mode, what, npages, ms, npages * 1000 / ms);
+  8000b2:	69 c3 e8 03 00 00    	imul   $0x3e8,%ebx,%eax
+  cprintf("cowbench: %-6s %-6s %5d faults in %5d ms = %7d faults/s\n",
+  8000b8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000bd:	f7 f1                	div    %ecx
+  8000bf:	50                   	push   %eax
+  8000c0:	51                   	push   %ecx
+  8000c1:	53                   	push   %ebx
+  8000c2:	68 29 3b 80 00       	push   $0x803b29
+  8000c7:	56                   	push   %esi
+  8000c8:	68 5c 3b 80 00       	push   $0x803b5c
+  8000cd:	e8 54 02 00 00       	call   800326 <cprintf>
+  report(mode, "reuse", npages, ms);
+}
+  8000d2:	83 c4 20             	add    $0x20,%esp
+  8000d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000d8:	5b                   	pop    %ebx
+  8000d9:	5e                   	pop    %esi
+  8000da:	5f                   	pop    %edi
+  8000db:	5d                   	pop    %ebp
+  8000dc:	c3                   	ret
+    panic("sys_env_set_cow: %e", r);
+  8000dd:	50                   	push   %eax
+  8000de:	68 00 3b 80 00       	push   $0x803b00
+  8000e3:	6a 2b                	push   $0x2b
+  8000e5:	68 14 3b 80 00       	push   $0x803b14
+  8000ea:	e8 5c 01 00 00       	call   80024b <_panic>
+    panic("fork: %e", child);
+  8000ef:	50                   	push   %eax
+  8000f0:	68 50 3f 80 00       	push   $0x803f50
+  8000f5:	6a 2e                	push   $0x2e
+  8000f7:	68 14 3b 80 00       	push   $0x803b14
+  8000fc:	e8 4a 01 00 00       	call   80024b <_panic>
+    report(mode, "copy", npages, touch(npages));
+  800101:	89 d8                	mov    %ebx,%eax
+  800103:	e8 2b ff ff ff       	call   800033 <touch>
+  if (ms == 0)
+  800108:	85 c0                	test   %eax,%eax
+  80010a:	ba 01 00 00 00       	mov    $0x1,%edx
+  80010f:	0f 45 d0             	cmovne %eax,%edx
+  800112:	89 d1                	mov    %edx,%ecx
+  cprintf("cowbench: %-6s %-6s %5d faults in %5d ms = %7d faults/s\n",
+  800114:	83 ec 08             	sub    $0x8,%esp
+          mode, what, npages, ms, npages * 1000 / ms);
+  800117:	69 c3 e8 03 00 00    	imul   $0x3e8,%ebx,%eax
+  cprintf("cowbench: %-6s %-6s %5d faults in %5d ms = %7d faults/s\n",
+  80011d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800122:	f7 f1                	div    %ecx
+  800124:	50                   	push   %eax
+  800125:	51                   	push   %ecx
+  800126:	53                   	push   %ebx
+  800127:	68 24 3b 80 00       	push   $0x803b24
+  80012c:	56                   	push   %esi
+  80012d:	68 5c 3b 80 00       	push   $0x803b5c
+  800132:	e8 ef 01 00 00       	call   800326 <cprintf>
+    exit();
+  800137:	83 c4 20             	add    $0x20,%esp
+  80013a:	e8 f2 00 00 00       	call   800231 <exit>
+  80013f:	e9 4f ff ff ff       	jmp    800093 <run+0x2c>
+
+00800144 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800144:	55                   	push   %ebp
+  800145:	89 e5                	mov    %esp,%ebp
+  800147:	56                   	push   %esi
+  800148:	53                   	push   %ebx
+  int i, npages, r;
+
+  binaryname = "cowbench";
+  800149:	c7 05 00 50 80 00 2f 	movl   $0x803b2f,0x805000
+  800150:	3b 80 00 
+  npages = 1024;
+  800153:	be 00 04 00 00       	mov    $0x400,%esi
+  if (argc > 1)
+  800158:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+  80015c:	7f 2c                	jg     80018a <umain+0x46>
+    npages = strtol(argv[1], 0, 0);
+
+  for (i = 0; i < npages; i++)
+  80015e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800163:	39 f3                	cmp    %esi,%ebx
+  800165:	7d 4e                	jge    8001b5 <umain+0x71>
+    if ((r = sys_page_alloc(0, (void *) (HEAPVA + i * PGSIZE),
+  800167:	83 ec 04             	sub    $0x4,%esp
+  80016a:	6a 07                	push   $0x7
+  80016c:	89 d8                	mov    %ebx,%eax
+  80016e:	c1 e0 0c             	shl    $0xc,%eax
+  800171:	05 00 00 00 20       	add    $0x20000000,%eax
+  800176:	50                   	push   %eax
+  800177:	6a 00                	push   $0x0
+  800179:	e8 c5 0b 00 00       	call   800d43 <sys_page_alloc>
+  80017e:	83 c4 10             	add    $0x10,%esp
+  800181:	85 c0                	test   %eax,%eax
+  800183:	78 1e                	js     8001a3 <umain+0x5f>
+  for (i = 0; i < npages; i++)
+  800185:	83 c3 01             	add    $0x1,%ebx
+  800188:	eb d9                	jmp    800163 <umain+0x1f>
+    npages = strtol(argv[1], 0, 0);
+  80018a:	83 ec 04             	sub    $0x4,%esp
+  80018d:	6a 00                	push   $0x0
+  80018f:	6a 00                	push   $0x0
+  800191:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800194:	ff 70 04             	push   0x4(%eax)
+  800197:	e8 cc 09 00 00       	call   800b68 <strtol>
+  80019c:	89 c6                	mov    %eax,%esi
+  80019e:	83 c4 10             	add    $0x10,%esp
+  8001a1:	eb bb                	jmp    80015e <umain+0x1a>
+                            PTE_P | PTE_U | PTE_W)) < 0)
+      panic("sys_page_alloc: %e", r);
+  8001a3:	50                   	push   %eax
+  8001a4:	68 38 3b 80 00       	push   $0x803b38
+  8001a9:	6a 46                	push   $0x46
+  8001ab:	68 14 3b 80 00       	push   $0x803b14
+  8001b0:	e8 96 00 00 00       	call   80024b <_panic>
+
+  run("upcall", 0, npages);
+  8001b5:	89 f1                	mov    %esi,%ecx
+  8001b7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001bc:	b8 4b 3b 80 00       	mov    $0x803b4b,%eax
+  8001c1:	e8 a1 fe ff ff       	call   800067 <run>
+  run("kernel", 1, npages);
+  8001c6:	89 f1                	mov    %esi,%ecx
+  8001c8:	ba 01 00 00 00       	mov    $0x1,%edx
+  8001cd:	b8 52 3b 80 00       	mov    $0x803b52,%eax
+  8001d2:	e8 90 fe ff ff       	call   800067 <run>
+}
+  8001d7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8001da:	5b                   	pop    %ebx
+  8001db:	5e                   	pop    %esi
+  8001dc:	5d                   	pop    %ebp
+  8001dd:	c3                   	ret
+
+008001de <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8001de:	55                   	push   %ebp
+  8001df:	89 e5                	mov    %esp,%ebp
+  8001e1:	56                   	push   %esi
+  8001e2:	53                   	push   %ebx
+  8001e3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8001e6:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  8001e9:	c7 05 a0 68 80 00 00 	movl   $0x0,0x8068a0
+  8001f0:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  8001f3:	e8 ca 0a 00 00       	call   800cc2 <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  8001f8:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001fd:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800200:	c1 e0 04             	shl    $0x4,%eax
+  800203:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800208:	a3 a0 68 80 00       	mov    %eax,0x8068a0
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  80020d:	85 db                	test   %ebx,%ebx
+  80020f:	7e 07                	jle    800218 <libmain+0x3a>
+    binaryname = argv[0];
+  800211:	8b 06                	mov    (%esi),%eax
+  800213:	a3 00 50 80 00       	mov    %eax,0x805000
+
+  // call user main routine
+  umain(argc, argv);
+  800218:	83 ec 08             	sub    $0x8,%esp
+  80021b:	56                   	push   %esi
+  80021c:	53                   	push   %ebx
+  80021d:	e8 22 ff ff ff       	call   800144 <umain>
+
+  // exit gracefully
+  exit();
+  800222:	e8 0a 00 00 00       	call   800231 <exit>
+}
+  800227:	83 c4 10             	add    $0x10,%esp
+  80022a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80022d:	5b                   	pop    %ebx
+  80022e:	5e                   	pop    %esi
+  80022f:	5d                   	pop    %ebp
+  800230:	c3                   	ret
+
+00800231 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800231:	55                   	push   %ebp
+  800232:	89 e5                	mov    %esp,%ebp
+  800234:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  800237:	e8 b4 15 00 00       	call   8017f0 <close_all>
+  sys_env_destroy(0);
+  80023c:	83 ec 0c             	sub    $0xc,%esp
+  80023f:	6a 00                	push   $0x0
+  800241:	e8 3b 0a 00 00       	call   800c81 <sys_env_destroy>
+}
+  800246:	83 c4 10             	add    $0x10,%esp
+  800249:	c9                   	leave
+  80024a:	c3                   	ret
+
+0080024b <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80024b:	55                   	push   %ebp
+  80024c:	89 e5                	mov    %esp,%ebp
+  80024e:	56                   	push   %esi
+  80024f:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  800250:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  800253:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  800259:	e8 64 0a 00 00       	call   800cc2 <sys_getenvid>
+  80025e:	83 ec 0c             	sub    $0xc,%esp
+  800261:	ff 75 0c             	push   0xc(%ebp)
+  800264:	ff 75 08             	push   0x8(%ebp)
+  800267:	56                   	push   %esi
+  800268:	50                   	push   %eax
+  800269:	68 a0 3b 80 00       	push   $0x803ba0
+  80026e:	e8 b3 00 00 00       	call   800326 <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  800273:	83 c4 18             	add    $0x18,%esp
+  800276:	53                   	push   %ebx
+  800277:	ff 75 10             	push   0x10(%ebp)
+  80027a:	e8 56 00 00 00       	call   8002d5 <vcprintf>
+  cprintf("\n");
+  80027f:	c7 04 24 b8 40 80 00 	movl   $0x8040b8,(%esp)
+  800286:	e8 9b 00 00 00       	call   800326 <cprintf>
+  80028b:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  80028e:	cc                   	int3
+  while (1)
+  80028f:	eb fd                	jmp    80028e <_panic+0x43>
+
+00800291 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800291:	55                   	push   %ebp
+  800292:	89 e5                	mov    %esp,%ebp
+  800294:	53                   	push   %ebx
+  800295:	83 ec 04             	sub    $0x4,%esp
+  800298:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  80029b:	8b 13                	mov    (%ebx),%edx
+  80029d:	8d 42 01             	lea    0x1(%edx),%eax
+  8002a0:	89 03                	mov    %eax,(%ebx)
+  8002a2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8002a5:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  8002a9:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8002ae:	74 09                	je     8002b9 <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  8002b0:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8002b4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8002b7:	c9                   	leave
+  8002b8:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  8002b9:	83 ec 08             	sub    $0x8,%esp
+  8002bc:	68 ff 00 00 00       	push   $0xff
+  8002c1:	8d 43 08             	lea    0x8(%ebx),%eax
+  8002c4:	50                   	push   %eax
+  8002c5:	e8 7a 09 00 00       	call   800c44 <sys_cputs>
+    b->idx = 0;
+  8002ca:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8002d0:	83 c4 10             	add    $0x10,%esp
+  8002d3:	eb db                	jmp    8002b0 <putch+0x1f>
+
+008002d5 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8002d5:	55                   	push   %ebp
+  8002d6:	89 e5                	mov    %esp,%ebp
+  8002d8:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  8002de:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8002e5:	00 00 00 
+  b.cnt = 0;
+  8002e8:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8002ef:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  8002f2:	ff 75 0c             	push   0xc(%ebp)
+  8002f5:	ff 75 08             	push   0x8(%ebp)
+  8002f8:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8002fe:	50                   	push   %eax
+  8002ff:	68 91 02 80 00       	push   $0x800291
+  800304:	e8 14 01 00 00       	call   80041d <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  800309:	83 c4 08             	add    $0x8,%esp
+  80030c:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800312:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800318:	50                   	push   %eax
+  800319:	e8 26 09 00 00       	call   800c44 <sys_cputs>
+
+  return b.cnt;
+}
+  80031e:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800324:	c9                   	leave
+  800325:	c3                   	ret
+
+00800326 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800326:	55                   	push   %ebp
+  800327:	89 e5                	mov    %esp,%ebp
+  800329:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  80032c:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  80032f:	50                   	push   %eax
+  800330:	ff 75 08             	push   0x8(%ebp)
+  800333:	e8 9d ff ff ff       	call   8002d5 <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  800338:	c9                   	leave
+  800339:	c3                   	ret
+
+0080033a <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  80033a:	55                   	push   %ebp
+  80033b:	89 e5                	mov    %esp,%ebp
+  80033d:	57                   	push   %edi
+  80033e:	56                   	push   %esi
+  80033f:	53                   	push   %ebx
+  800340:	83 ec 1c             	sub    $0x1c,%esp
+  800343:	89 c7                	mov    %eax,%edi
+  800345:	89 d6                	mov    %edx,%esi
+  800347:	8b 45 08             	mov    0x8(%ebp),%eax
+  80034a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80034d:	89 d1                	mov    %edx,%ecx
+  80034f:	89 c2                	mov    %eax,%edx
+  800351:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800354:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800357:	8b 45 10             	mov    0x10(%ebp),%eax
+  80035a:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  80035d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800360:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800367:	39 c2                	cmp    %eax,%edx
+  800369:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80036c:	72 3e                	jb     8003ac <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  80036e:	83 ec 0c             	sub    $0xc,%esp
+  800371:	ff 75 18             	push   0x18(%ebp)
+  800374:	83 eb 01             	sub    $0x1,%ebx
+  800377:	53                   	push   %ebx
+  800378:	50                   	push   %eax
+  800379:	83 ec 08             	sub    $0x8,%esp
+  80037c:	ff 75 e4             	push   -0x1c(%ebp)
+  80037f:	ff 75 e0             	push   -0x20(%ebp)
+  800382:	ff 75 dc             	push   -0x24(%ebp)
+  800385:	ff 75 d8             	push   -0x28(%ebp)
+  800388:	e8 e1 35 00 00       	call   80396e <__udivdi3>
+  80038d:	83 c4 18             	add    $0x18,%esp
+  800390:	52                   	push   %edx
+  800391:	50                   	push   %eax
+  800392:	89 f2                	mov    %esi,%edx
+  800394:	89 f8                	mov    %edi,%eax
+  800396:	e8 9f ff ff ff       	call   80033a <printnum>
+  80039b:	83 c4 20             	add    $0x20,%esp
+  80039e:	eb 13                	jmp    8003b3 <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  8003a0:	83 ec 08             	sub    $0x8,%esp
+  8003a3:	56                   	push   %esi
+  8003a4:	ff 75 18             	push   0x18(%ebp)
+  8003a7:	ff d7                	call   *%edi
+  8003a9:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  8003ac:	83 eb 01             	sub    $0x1,%ebx
+  8003af:	85 db                	test   %ebx,%ebx
+  8003b1:	7f ed                	jg     8003a0 <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  8003b3:	83 ec 08             	sub    $0x8,%esp
+  8003b6:	56                   	push   %esi
+  8003b7:	83 ec 04             	sub    $0x4,%esp
+  8003ba:	ff 75 e4             	push   -0x1c(%ebp)
+  8003bd:	ff 75 e0             	push   -0x20(%ebp)
+  8003c0:	ff 75 dc             	push   -0x24(%ebp)
+  8003c3:	ff 75 d8             	push   -0x28(%ebp)
+  8003c6:	e8 c4 35 00 00       	call   80398f <__umoddi3>
+  8003cb:	83 c4 14             	add    $0x14,%esp
+  8003ce:	0f be 80 c3 3b 80 00 	movsbl 0x803bc3(%eax),%eax
+  8003d5:	50                   	push   %eax
+  8003d6:	ff d7                	call   *%edi
+}
+  8003d8:	83 c4 10             	add    $0x10,%esp
+  8003db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003de:	5b                   	pop    %ebx
+  8003df:	5e                   	pop    %esi
+  8003e0:	5f                   	pop    %edi
+  8003e1:	5d                   	pop    %ebp
+  8003e2:	c3                   	ret
+
+008003e3 <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8003e3:	55                   	push   %ebp
+  8003e4:	89 e5                	mov    %esp,%ebp
+  8003e6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  8003e9:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  8003ed:	8b 10                	mov    (%eax),%edx
+  8003ef:	3b 50 04             	cmp    0x4(%eax),%edx
+  8003f2:	73 0a                	jae    8003fe <sprintputch+0x1b>
+    *b->buf++ = ch;
+  8003f4:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8003f7:	89 08                	mov    %ecx,(%eax)
+  8003f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003fc:	88 02                	mov    %al,(%edx)
+}
+  8003fe:	5d                   	pop    %ebp
+  8003ff:	c3                   	ret
+
+00800400 <printfmt>:
+{
+  800400:	55                   	push   %ebp
+  800401:	89 e5                	mov    %esp,%ebp
+  800403:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  800406:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  800409:	50                   	push   %eax
+  80040a:	ff 75 10             	push   0x10(%ebp)
+  80040d:	ff 75 0c             	push   0xc(%ebp)
+  800410:	ff 75 08             	push   0x8(%ebp)
+  800413:	e8 05 00 00 00       	call   80041d <vprintfmt>
+}
+  800418:	83 c4 10             	add    $0x10,%esp
+  80041b:	c9                   	leave
+  80041c:	c3                   	ret
+
+0080041d <vprintfmt>:
+{
+  80041d:	55                   	push   %ebp
+  80041e:	89 e5                	mov    %esp,%ebp
+  800420:	57                   	push   %edi
+  800421:	56                   	push   %esi
+  800422:	53                   	push   %ebx
+  800423:	83 ec 2c             	sub    $0x2c,%esp
+  800426:	8b 75 08             	mov    0x8(%ebp),%esi
+  800429:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80042c:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80042f:	eb 0a                	jmp    80043b <vprintfmt+0x1e>
+      putch(ch, putdat);
+  800431:	83 ec 08             	sub    $0x8,%esp
+  800434:	53                   	push   %ebx
+  800435:	50                   	push   %eax
+  800436:	ff d6                	call   *%esi
+  800438:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  80043b:	83 c7 01             	add    $0x1,%edi
+  80043e:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800442:	83 f8 25             	cmp    $0x25,%eax
+  800445:	74 0c                	je     800453 <vprintfmt+0x36>
+      if (ch == '\0')
+  800447:	85 c0                	test   %eax,%eax
+  800449:	75 e6                	jne    800431 <vprintfmt+0x14>
+}
+  80044b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80044e:	5b                   	pop    %ebx
+  80044f:	5e                   	pop    %esi
+  800450:	5f                   	pop    %edi
+  800451:	5d                   	pop    %ebp
+  800452:	c3                   	ret
+    padc = ' ';
+  800453:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  800457:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  80045e:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  800465:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  80046c:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  800471:	8d 47 01             	lea    0x1(%edi),%eax
+  800474:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800477:	0f b6 17             	movzbl (%edi),%edx
+  80047a:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80047d:	3c 55                	cmp    $0x55,%al
+  80047f:	0f 87 cf 03 00 00    	ja     800854 <vprintfmt+0x437>
+  800485:	0f b6 c0             	movzbl %al,%eax
+  800488:	ff 24 85 00 3d 80 00 	jmp    *0x803d00(,%eax,4)
+  80048f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  800492:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800496:	eb d9                	jmp    800471 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  800498:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80049b:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80049f:	eb d0                	jmp    800471 <vprintfmt+0x54>
+  8004a1:	0f b6 d2             	movzbl %dl,%edx
+  8004a4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  8004a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004ac:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  8004af:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8004b2:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  8004b6:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  8004b9:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8004bc:	83 f9 09             	cmp    $0x9,%ecx
+  8004bf:	77 55                	ja     800516 <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  8004c1:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  8004c4:	eb e9                	jmp    8004af <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  8004c6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004c9:	8b 00                	mov    (%eax),%eax
+  8004cb:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004ce:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004d1:	8d 40 04             	lea    0x4(%eax),%eax
+  8004d4:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  8004d7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  8004da:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004de:	79 91                	jns    800471 <vprintfmt+0x54>
+        width = precision, precision = -1;
+  8004e0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004e3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004e6:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8004ed:	eb 82                	jmp    800471 <vprintfmt+0x54>
+      if (width < 0)
+  8004ef:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004f2:	85 d2                	test   %edx,%edx
+  8004f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004f9:	0f 49 c2             	cmovns %edx,%eax
+  8004fc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  8004ff:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  800502:	e9 6a ff ff ff       	jmp    800471 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  800507:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  80050a:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  800511:	e9 5b ff ff ff       	jmp    800471 <vprintfmt+0x54>
+  800516:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800519:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80051c:	eb bc                	jmp    8004da <vprintfmt+0xbd>
+      lflag++;
+  80051e:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  800521:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  800524:	e9 48 ff ff ff       	jmp    800471 <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  800529:	8b 45 14             	mov    0x14(%ebp),%eax
+  80052c:	8d 78 04             	lea    0x4(%eax),%edi
+  80052f:	83 ec 08             	sub    $0x8,%esp
+  800532:	53                   	push   %ebx
+  800533:	ff 30                	push   (%eax)
+  800535:	ff d6                	call   *%esi
+      break;
+  800537:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  80053a:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  80053d:	e9 b1 02 00 00       	jmp    8007f3 <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  800542:	8b 45 14             	mov    0x14(%ebp),%eax
+  800545:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  800548:	8b 10                	mov    (%eax),%edx
+  80054a:	89 d0                	mov    %edx,%eax
+  80054c:	f7 d8                	neg    %eax
+  80054e:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800551:	83 f8 10             	cmp    $0x10,%eax
+  800554:	7f 23                	jg     800579 <vprintfmt+0x15c>
+  800556:	8b 14 85 60 3e 80 00 	mov    0x803e60(,%eax,4),%edx
+  80055d:	85 d2                	test   %edx,%edx
+  80055f:	74 18                	je     800579 <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  800561:	52                   	push   %edx
+  800562:	68 62 40 80 00       	push   $0x804062
+  800567:	53                   	push   %ebx
+  800568:	56                   	push   %esi
+  800569:	e8 92 fe ff ff       	call   800400 <printfmt>
+  80056e:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  800571:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800574:	e9 7a 02 00 00       	jmp    8007f3 <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  800579:	50                   	push   %eax
+  80057a:	68 db 3b 80 00       	push   $0x803bdb
+  80057f:	53                   	push   %ebx
+  800580:	56                   	push   %esi
+  800581:	e8 7a fe ff ff       	call   800400 <printfmt>
+  800586:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  800589:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  80058c:	e9 62 02 00 00       	jmp    8007f3 <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  800591:	8b 45 14             	mov    0x14(%ebp),%eax
+  800594:	83 c0 04             	add    $0x4,%eax
+  800597:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80059a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80059d:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  80059f:	85 c9                	test   %ecx,%ecx
+  8005a1:	b8 d4 3b 80 00       	mov    $0x803bd4,%eax
+  8005a6:	0f 45 c1             	cmovne %ecx,%eax
+  8005a9:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  8005ac:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8005b0:	7e 06                	jle    8005b8 <vprintfmt+0x19b>
+  8005b2:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8005b6:	75 0b                	jne    8005c3 <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8005b8:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8005bb:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8005be:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005c1:	eb 5c                	jmp    80061f <vprintfmt+0x202>
+  8005c3:	83 ec 08             	sub    $0x8,%esp
+  8005c6:	ff 75 d0             	push   -0x30(%ebp)
+  8005c9:	ff 75 cc             	push   -0x34(%ebp)
+  8005cc:	e8 20 03 00 00       	call   8008f1 <strnlen>
+  8005d1:	89 c2                	mov    %eax,%edx
+  8005d3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005d6:	29 d0                	sub    %edx,%eax
+  8005d8:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  8005db:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8005df:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005e2:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005e5:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8005e7:	eb 0e                	jmp    8005f7 <vprintfmt+0x1da>
+          putch(padc, putdat);
+  8005e9:	83 ec 08             	sub    $0x8,%esp
+  8005ec:	53                   	push   %ebx
+  8005ed:	57                   	push   %edi
+  8005ee:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8005f1:	83 ee 01             	sub    $0x1,%esi
+  8005f4:	83 c4 10             	add    $0x10,%esp
+  8005f7:	85 f6                	test   %esi,%esi
+  8005f9:	7f ee                	jg     8005e9 <vprintfmt+0x1cc>
+  8005fb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005fe:	8b 75 08             	mov    0x8(%ebp),%esi
+  800601:	85 c0                	test   %eax,%eax
+  800603:	ba 00 00 00 00       	mov    $0x0,%edx
+  800608:	0f 49 d0             	cmovns %eax,%edx
+  80060b:	29 d0                	sub    %edx,%eax
+  80060d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800610:	eb a6                	jmp    8005b8 <vprintfmt+0x19b>
+          putch(ch, putdat);
+  800612:	83 ec 08             	sub    $0x8,%esp
+  800615:	53                   	push   %ebx
+  800616:	52                   	push   %edx
+  800617:	ff 55 08             	call   *0x8(%ebp)
+  80061a:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80061d:	89 f1                	mov    %esi,%ecx
+  80061f:	8d 71 01             	lea    0x1(%ecx),%esi
+  800622:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800626:	0f be d0             	movsbl %al,%edx
+  800629:	85 d2                	test   %edx,%edx
+  80062b:	74 28                	je     800655 <vprintfmt+0x238>
+  80062d:	85 ff                	test   %edi,%edi
+  80062f:	78 05                	js     800636 <vprintfmt+0x219>
+  800631:	83 ef 01             	sub    $0x1,%edi
+  800634:	78 30                	js     800666 <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  800636:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80063a:	74 d6                	je     800612 <vprintfmt+0x1f5>
+  80063c:	0f be c0             	movsbl %al,%eax
+  80063f:	83 e8 20             	sub    $0x20,%eax
+  800642:	83 f8 5e             	cmp    $0x5e,%eax
+  800645:	76 cb                	jbe    800612 <vprintfmt+0x1f5>
+          putch('?', putdat);
+  800647:	83 ec 08             	sub    $0x8,%esp
+  80064a:	53                   	push   %ebx
+  80064b:	6a 3f                	push   $0x3f
+  80064d:	ff 55 08             	call   *0x8(%ebp)
+  800650:	83 c4 10             	add    $0x10,%esp
+  800653:	eb c8                	jmp    80061d <vprintfmt+0x200>
+  800655:	8b 75 08             	mov    0x8(%ebp),%esi
+  800658:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80065b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80065e:	01 d0                	add    %edx,%eax
+  800660:	29 c8                	sub    %ecx,%eax
+  800662:	89 c7                	mov    %eax,%edi
+  800664:	eb 13                	jmp    800679 <vprintfmt+0x25c>
+  800666:	8b 75 08             	mov    0x8(%ebp),%esi
+  800669:	eb ed                	jmp    800658 <vprintfmt+0x23b>
+        putch(' ', putdat);
+  80066b:	83 ec 08             	sub    $0x8,%esp
+  80066e:	53                   	push   %ebx
+  80066f:	6a 20                	push   $0x20
+  800671:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  800673:	83 ef 01             	sub    $0x1,%edi
+  800676:	83 c4 10             	add    $0x10,%esp
+  800679:	85 ff                	test   %edi,%edi
+  80067b:	7f ee                	jg     80066b <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  80067d:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800680:	89 45 14             	mov    %eax,0x14(%ebp)
+  800683:	e9 6b 01 00 00       	jmp    8007f3 <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  800688:	83 f9 01             	cmp    $0x1,%ecx
+  80068b:	7f 1f                	jg     8006ac <vprintfmt+0x28f>
+  else if (lflag)
+  80068d:	85 c9                	test   %ecx,%ecx
+  80068f:	74 67                	je     8006f8 <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  800691:	8b 45 14             	mov    0x14(%ebp),%eax
+  800694:	8b 00                	mov    (%eax),%eax
+  800696:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800699:	89 c1                	mov    %eax,%ecx
+  80069b:	c1 f9 1f             	sar    $0x1f,%ecx
+  80069e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006a1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a4:	8d 40 04             	lea    0x4(%eax),%eax
+  8006a7:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006aa:	eb 17                	jmp    8006c3 <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  8006ac:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006af:	8b 50 04             	mov    0x4(%eax),%edx
+  8006b2:	8b 00                	mov    (%eax),%eax
+  8006b4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006b7:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8006ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006bd:	8d 40 08             	lea    0x8(%eax),%eax
+  8006c0:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  8006c3:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006c6:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  8006c9:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  8006ce:	85 c9                	test   %ecx,%ecx
+  8006d0:	0f 89 03 01 00 00    	jns    8007d9 <vprintfmt+0x3bc>
+        putch('-', putdat);
+  8006d6:	83 ec 08             	sub    $0x8,%esp
+  8006d9:	53                   	push   %ebx
+  8006da:	6a 2d                	push   $0x2d
+  8006dc:	ff d6                	call   *%esi
+        num = -(long long)num;
+  8006de:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006e1:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8006e4:	f7 da                	neg    %edx
+  8006e6:	83 d1 00             	adc    $0x0,%ecx
+  8006e9:	f7 d9                	neg    %ecx
+  8006eb:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  8006ee:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8006f3:	e9 e1 00 00 00       	jmp    8007d9 <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  8006f8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006fb:	8b 00                	mov    (%eax),%eax
+  8006fd:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800700:	89 c1                	mov    %eax,%ecx
+  800702:	c1 f9 1f             	sar    $0x1f,%ecx
+  800705:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800708:	8b 45 14             	mov    0x14(%ebp),%eax
+  80070b:	8d 40 04             	lea    0x4(%eax),%eax
+  80070e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800711:	eb b0                	jmp    8006c3 <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  800713:	83 f9 01             	cmp    $0x1,%ecx
+  800716:	7f 1e                	jg     800736 <vprintfmt+0x319>
+  else if (lflag)
+  800718:	85 c9                	test   %ecx,%ecx
+  80071a:	74 32                	je     80074e <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  80071c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071f:	8b 10                	mov    (%eax),%edx
+  800721:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800726:	8d 40 04             	lea    0x4(%eax),%eax
+  800729:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  80072c:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  800731:	e9 a3 00 00 00       	jmp    8007d9 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800736:	8b 45 14             	mov    0x14(%ebp),%eax
+  800739:	8b 10                	mov    (%eax),%edx
+  80073b:	8b 48 04             	mov    0x4(%eax),%ecx
+  80073e:	8d 40 08             	lea    0x8(%eax),%eax
+  800741:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800744:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  800749:	e9 8b 00 00 00       	jmp    8007d9 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  80074e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800751:	8b 10                	mov    (%eax),%edx
+  800753:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800758:	8d 40 04             	lea    0x4(%eax),%eax
+  80075b:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  80075e:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  800763:	eb 74                	jmp    8007d9 <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  800765:	83 f9 01             	cmp    $0x1,%ecx
+  800768:	7f 1b                	jg     800785 <vprintfmt+0x368>
+  else if (lflag)
+  80076a:	85 c9                	test   %ecx,%ecx
+  80076c:	74 2c                	je     80079a <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  80076e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800771:	8b 10                	mov    (%eax),%edx
+  800773:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800778:	8d 40 04             	lea    0x4(%eax),%eax
+  80077b:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  80077e:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  800783:	eb 54                	jmp    8007d9 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800785:	8b 45 14             	mov    0x14(%ebp),%eax
+  800788:	8b 10                	mov    (%eax),%edx
+  80078a:	8b 48 04             	mov    0x4(%eax),%ecx
+  80078d:	8d 40 08             	lea    0x8(%eax),%eax
+  800790:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800793:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  800798:	eb 3f                	jmp    8007d9 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  80079a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80079d:	8b 10                	mov    (%eax),%edx
+  80079f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007a4:	8d 40 04             	lea    0x4(%eax),%eax
+  8007a7:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8007aa:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  8007af:	eb 28                	jmp    8007d9 <vprintfmt+0x3bc>
+      putch('0', putdat);
+  8007b1:	83 ec 08             	sub    $0x8,%esp
+  8007b4:	53                   	push   %ebx
+  8007b5:	6a 30                	push   $0x30
+  8007b7:	ff d6                	call   *%esi
+      putch('x', putdat);
+  8007b9:	83 c4 08             	add    $0x8,%esp
+  8007bc:	53                   	push   %ebx
+  8007bd:	6a 78                	push   $0x78
+  8007bf:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  8007c1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007c4:	8b 10                	mov    (%eax),%edx
+  8007c6:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  8007cb:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  8007ce:	8d 40 04             	lea    0x4(%eax),%eax
+  8007d1:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8007d4:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  8007d9:	83 ec 0c             	sub    $0xc,%esp
+  8007dc:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8007e0:	50                   	push   %eax
+  8007e1:	ff 75 e0             	push   -0x20(%ebp)
+  8007e4:	57                   	push   %edi
+  8007e5:	51                   	push   %ecx
+  8007e6:	52                   	push   %edx
+  8007e7:	89 da                	mov    %ebx,%edx
+  8007e9:	89 f0                	mov    %esi,%eax
+  8007eb:	e8 4a fb ff ff       	call   80033a <printnum>
+      break;
+  8007f0:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  8007f3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  8007f6:	e9 40 fc ff ff       	jmp    80043b <vprintfmt+0x1e>
+  if (lflag >= 2)
+  8007fb:	83 f9 01             	cmp    $0x1,%ecx
+  8007fe:	7f 1b                	jg     80081b <vprintfmt+0x3fe>
+  else if (lflag)
+  800800:	85 c9                	test   %ecx,%ecx
+  800802:	74 2c                	je     800830 <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  800804:	8b 45 14             	mov    0x14(%ebp),%eax
+  800807:	8b 10                	mov    (%eax),%edx
+  800809:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80080e:	8d 40 04             	lea    0x4(%eax),%eax
+  800811:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800814:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  800819:	eb be                	jmp    8007d9 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  80081b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80081e:	8b 10                	mov    (%eax),%edx
+  800820:	8b 48 04             	mov    0x4(%eax),%ecx
+  800823:	8d 40 08             	lea    0x8(%eax),%eax
+  800826:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800829:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  80082e:	eb a9                	jmp    8007d9 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800830:	8b 45 14             	mov    0x14(%ebp),%eax
+  800833:	8b 10                	mov    (%eax),%edx
+  800835:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80083a:	8d 40 04             	lea    0x4(%eax),%eax
+  80083d:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800840:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  800845:	eb 92                	jmp    8007d9 <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  800847:	83 ec 08             	sub    $0x8,%esp
+  80084a:	53                   	push   %ebx
+  80084b:	6a 25                	push   $0x25
+  80084d:	ff d6                	call   *%esi
+      break;
+  80084f:	83 c4 10             	add    $0x10,%esp
+  800852:	eb 9f                	jmp    8007f3 <vprintfmt+0x3d6>
+      putch('%', putdat);
+  800854:	83 ec 08             	sub    $0x8,%esp
+  800857:	53                   	push   %ebx
+  800858:	6a 25                	push   $0x25
+  80085a:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  80085c:	83 c4 10             	add    $0x10,%esp
+  80085f:	89 f8                	mov    %edi,%eax
+  800861:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800865:	74 05                	je     80086c <vprintfmt+0x44f>
+  800867:	83 e8 01             	sub    $0x1,%eax
+  80086a:	eb f5                	jmp    800861 <vprintfmt+0x444>
+  80086c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80086f:	eb 82                	jmp    8007f3 <vprintfmt+0x3d6>
+
+00800871 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800871:	55                   	push   %ebp
+  800872:	89 e5                	mov    %esp,%ebp
+  800874:	83 ec 18             	sub    $0x18,%esp
+  800877:	8b 45 08             	mov    0x8(%ebp),%eax
+  80087a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  80087d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800880:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800884:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800887:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  80088e:	85 c0                	test   %eax,%eax
+  800890:	74 26                	je     8008b8 <vsnprintf+0x47>
+  800892:	85 d2                	test   %edx,%edx
+  800894:	7e 22                	jle    8008b8 <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800896:	ff 75 14             	push   0x14(%ebp)
+  800899:	ff 75 10             	push   0x10(%ebp)
+  80089c:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80089f:	50                   	push   %eax
+  8008a0:	68 e3 03 80 00       	push   $0x8003e3
+  8008a5:	e8 73 fb ff ff       	call   80041d <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  8008aa:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8008ad:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  8008b0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8008b3:	83 c4 10             	add    $0x10,%esp
+}
+  8008b6:	c9                   	leave
+  8008b7:	c3                   	ret
+    return -E_INVAL;
+  8008b8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008bd:	eb f7                	jmp    8008b6 <vsnprintf+0x45>
+
+008008bf <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8008bf:	55                   	push   %ebp
+  8008c0:	89 e5                	mov    %esp,%ebp
+  8008c2:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  8008c5:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  8008c8:	50                   	push   %eax
+  8008c9:	ff 75 10             	push   0x10(%ebp)
+  8008cc:	ff 75 0c             	push   0xc(%ebp)
+  8008cf:	ff 75 08             	push   0x8(%ebp)
+  8008d2:	e8 9a ff ff ff       	call   800871 <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  8008d7:	c9                   	leave
+  8008d8:	c3                   	ret
+
+008008d9 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8008d9:	55                   	push   %ebp
+  8008da:	89 e5                	mov    %esp,%ebp
+  8008dc:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  8008df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008e4:	eb 03                	jmp    8008e9 <strlen+0x10>
+    n++;
+  8008e6:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  8008e9:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8008ed:	75 f7                	jne    8008e6 <strlen+0xd>
+  return n;
+}
+  8008ef:	5d                   	pop    %ebp
+  8008f0:	c3                   	ret
+
+008008f1 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8008f1:	55                   	push   %ebp
+  8008f2:	89 e5                	mov    %esp,%ebp
+  8008f4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008f7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008ff:	eb 03                	jmp    800904 <strnlen+0x13>
+    n++;
+  800901:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800904:	39 d0                	cmp    %edx,%eax
+  800906:	74 08                	je     800910 <strnlen+0x1f>
+  800908:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80090c:	75 f3                	jne    800901 <strnlen+0x10>
+  80090e:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  800910:	89 d0                	mov    %edx,%eax
+  800912:	5d                   	pop    %ebp
+  800913:	c3                   	ret
+
+00800914 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800914:	55                   	push   %ebp
+  800915:	89 e5                	mov    %esp,%ebp
+  800917:	53                   	push   %ebx
+  800918:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80091b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  80091e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800923:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800927:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80092a:	83 c0 01             	add    $0x1,%eax
+  80092d:	84 d2                	test   %dl,%dl
+  80092f:	75 f2                	jne    800923 <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  800931:	89 c8                	mov    %ecx,%eax
+  800933:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800936:	c9                   	leave
+  800937:	c3                   	ret
+
+00800938 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800938:	55                   	push   %ebp
+  800939:	89 e5                	mov    %esp,%ebp
+  80093b:	53                   	push   %ebx
+  80093c:	83 ec 10             	sub    $0x10,%esp
+  80093f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  800942:	53                   	push   %ebx
+  800943:	e8 91 ff ff ff       	call   8008d9 <strlen>
+  800948:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  80094b:	ff 75 0c             	push   0xc(%ebp)
+  80094e:	01 d8                	add    %ebx,%eax
+  800950:	50                   	push   %eax
+  800951:	e8 be ff ff ff       	call   800914 <strcpy>
+  return dst;
+}
+  800956:	89 d8                	mov    %ebx,%eax
+  800958:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80095b:	c9                   	leave
+  80095c:	c3                   	ret
+
+0080095d <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  80095d:	55                   	push   %ebp
+  80095e:	89 e5                	mov    %esp,%ebp
+  800960:	56                   	push   %esi
+  800961:	53                   	push   %ebx
+  800962:	8b 75 08             	mov    0x8(%ebp),%esi
+  800965:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  800968:	89 f3                	mov    %esi,%ebx
+  80096a:	03 5d 10             	add    0x10(%ebp),%ebx
+  80096d:	89 f0                	mov    %esi,%eax
+  80096f:	eb 0f                	jmp    800980 <strncpy+0x23>
+    *dst++ = *src;
+  800971:	83 c0 01             	add    $0x1,%eax
+  800974:	0f b6 0a             	movzbl (%edx),%ecx
+  800977:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  80097a:	80 f9 01             	cmp    $0x1,%cl
+  80097d:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  800980:	39 d8                	cmp    %ebx,%eax
+  800982:	75 ed                	jne    800971 <strncpy+0x14>
+  }
+  return ret;
+}
+  800984:	89 f0                	mov    %esi,%eax
+  800986:	5b                   	pop    %ebx
+  800987:	5e                   	pop    %esi
+  800988:	5d                   	pop    %ebp
+  800989:	c3                   	ret
+
+0080098a <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80098a:	55                   	push   %ebp
+  80098b:	89 e5                	mov    %esp,%ebp
+  80098d:	56                   	push   %esi
+  80098e:	53                   	push   %ebx
+  80098f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800992:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800995:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  800998:	89 f0                	mov    %esi,%eax
+  80099a:	85 d2                	test   %edx,%edx
+  80099c:	74 21                	je     8009bf <strlcpy+0x35>
+  80099e:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8009a2:	89 f2                	mov    %esi,%edx
+  8009a4:	eb 09                	jmp    8009af <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  8009a6:	83 c1 01             	add    $0x1,%ecx
+  8009a9:	83 c2 01             	add    $0x1,%edx
+  8009ac:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  8009af:	39 c2                	cmp    %eax,%edx
+  8009b1:	74 09                	je     8009bc <strlcpy+0x32>
+  8009b3:	0f b6 19             	movzbl (%ecx),%ebx
+  8009b6:	84 db                	test   %bl,%bl
+  8009b8:	75 ec                	jne    8009a6 <strlcpy+0x1c>
+  8009ba:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  8009bc:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  8009bf:	29 f0                	sub    %esi,%eax
+}
+  8009c1:	5b                   	pop    %ebx
+  8009c2:	5e                   	pop    %esi
+  8009c3:	5d                   	pop    %ebp
+  8009c4:	c3                   	ret
+
+008009c5 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8009c5:	55                   	push   %ebp
+  8009c6:	89 e5                	mov    %esp,%ebp
+  8009c8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009cb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  8009ce:	eb 06                	jmp    8009d6 <strcmp+0x11>
+    p++, q++;
+  8009d0:	83 c1 01             	add    $0x1,%ecx
+  8009d3:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  8009d6:	0f b6 01             	movzbl (%ecx),%eax
+  8009d9:	84 c0                	test   %al,%al
+  8009db:	74 04                	je     8009e1 <strcmp+0x1c>
+  8009dd:	3a 02                	cmp    (%edx),%al
+  8009df:	74 ef                	je     8009d0 <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  8009e1:	0f b6 c0             	movzbl %al,%eax
+  8009e4:	0f b6 12             	movzbl (%edx),%edx
+  8009e7:	29 d0                	sub    %edx,%eax
+}
+  8009e9:	5d                   	pop    %ebp
+  8009ea:	c3                   	ret
+
+008009eb <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8009eb:	55                   	push   %ebp
+  8009ec:	89 e5                	mov    %esp,%ebp
+  8009ee:	53                   	push   %ebx
+  8009ef:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009f2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009f5:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  8009f8:	eb 09                	jmp    800a03 <strncmp+0x18>
+    n--, p++, q++;
+  8009fa:	83 ea 01             	sub    $0x1,%edx
+  8009fd:	83 c0 01             	add    $0x1,%eax
+  800a00:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  800a03:	85 d2                	test   %edx,%edx
+  800a05:	74 18                	je     800a1f <strncmp+0x34>
+  800a07:	0f b6 18             	movzbl (%eax),%ebx
+  800a0a:	84 db                	test   %bl,%bl
+  800a0c:	74 04                	je     800a12 <strncmp+0x27>
+  800a0e:	3a 19                	cmp    (%ecx),%bl
+  800a10:	74 e8                	je     8009fa <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800a12:	0f b6 00             	movzbl (%eax),%eax
+  800a15:	0f b6 11             	movzbl (%ecx),%edx
+  800a18:	29 d0                	sub    %edx,%eax
+}
+  800a1a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a1d:	c9                   	leave
+  800a1e:	c3                   	ret
+    return 0;
+  800a1f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a24:	eb f4                	jmp    800a1a <strncmp+0x2f>
+
+00800a26 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a26:	55                   	push   %ebp
+  800a27:	89 e5                	mov    %esp,%ebp
+  800a29:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a2c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800a30:	eb 03                	jmp    800a35 <strchr+0xf>
+  800a32:	83 c0 01             	add    $0x1,%eax
+  800a35:	0f b6 10             	movzbl (%eax),%edx
+  800a38:	84 d2                	test   %dl,%dl
+  800a3a:	74 06                	je     800a42 <strchr+0x1c>
+    if (*s == c)
+  800a3c:	38 ca                	cmp    %cl,%dl
+  800a3e:	75 f2                	jne    800a32 <strchr+0xc>
+  800a40:	eb 05                	jmp    800a47 <strchr+0x21>
+      return (char*)s;
+  return 0;
+  800a42:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a47:	5d                   	pop    %ebp
+  800a48:	c3                   	ret
+
+00800a49 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a49:	55                   	push   %ebp
+  800a4a:	89 e5                	mov    %esp,%ebp
+  800a4c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a4f:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800a53:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  800a56:	38 ca                	cmp    %cl,%dl
+  800a58:	74 09                	je     800a63 <strfind+0x1a>
+  800a5a:	84 d2                	test   %dl,%dl
+  800a5c:	74 05                	je     800a63 <strfind+0x1a>
+  for (; *s; s++)
+  800a5e:	83 c0 01             	add    $0x1,%eax
+  800a61:	eb f0                	jmp    800a53 <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  800a63:	5d                   	pop    %ebp
+  800a64:	c3                   	ret
+
+00800a65 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a65:	55                   	push   %ebp
+  800a66:	89 e5                	mov    %esp,%ebp
+  800a68:	57                   	push   %edi
+  800a69:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a6c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  800a6f:	85 c9                	test   %ecx,%ecx
+  800a71:	74 20                	je     800a93 <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  800a73:	89 f8                	mov    %edi,%eax
+  800a75:	09 c8                	or     %ecx,%eax
+  800a77:	a8 03                	test   $0x3,%al
+  800a79:	75 12                	jne    800a8d <memset+0x28>
+    c &= 0xFF;
+  800a7b:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a7f:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  800a85:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  800a88:	fc                   	cld
+  800a89:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a8b:	eb 06                	jmp    800a93 <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  800a8d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a90:	fc                   	cld
+  800a91:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  800a93:	89 f8                	mov    %edi,%eax
+  800a95:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a98:	c9                   	leave
+  800a99:	c3                   	ret
+
+00800a9a <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a9a:	55                   	push   %ebp
+  800a9b:	89 e5                	mov    %esp,%ebp
+  800a9d:	57                   	push   %edi
+  800a9e:	56                   	push   %esi
+  800a9f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aa2:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800aa5:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  800aa8:	39 c6                	cmp    %eax,%esi
+  800aaa:	73 32                	jae    800ade <memmove+0x44>
+  800aac:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800aaf:	39 d0                	cmp    %edx,%eax
+  800ab1:	73 2b                	jae    800ade <memmove+0x44>
+    s += n;
+    d += n;
+  800ab3:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ab6:	89 d6                	mov    %edx,%esi
+  800ab8:	09 fe                	or     %edi,%esi
+  800aba:	09 ce                	or     %ecx,%esi
+  800abc:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800ac2:	75 0e                	jne    800ad2 <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800ac4:	83 ef 04             	sub    $0x4,%edi
+  800ac7:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800aca:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  800acd:	fd                   	std
+  800ace:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ad0:	eb 09                	jmp    800adb <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800ad2:	83 ef 01             	sub    $0x1,%edi
+  800ad5:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  800ad8:	fd                   	std
+  800ad9:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  800adb:	fc                   	cld
+  800adc:	eb 1a                	jmp    800af8 <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ade:	89 f2                	mov    %esi,%edx
+  800ae0:	09 c2                	or     %eax,%edx
+  800ae2:	09 ca                	or     %ecx,%edx
+  800ae4:	f6 c2 03             	test   $0x3,%dl
+  800ae7:	75 0a                	jne    800af3 <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800ae9:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  800aec:	89 c7                	mov    %eax,%edi
+  800aee:	fc                   	cld
+  800aef:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800af1:	eb 05                	jmp    800af8 <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  800af3:	89 c7                	mov    %eax,%edi
+  800af5:	fc                   	cld
+  800af6:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  800af8:	5e                   	pop    %esi
+  800af9:	5f                   	pop    %edi
+  800afa:	5d                   	pop    %ebp
+  800afb:	c3                   	ret
+
+00800afc <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800afc:	55                   	push   %ebp
+  800afd:	89 e5                	mov    %esp,%ebp
+  800aff:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  800b02:	ff 75 10             	push   0x10(%ebp)
+  800b05:	ff 75 0c             	push   0xc(%ebp)
+  800b08:	ff 75 08             	push   0x8(%ebp)
+  800b0b:	e8 8a ff ff ff       	call   800a9a <memmove>
+}
+  800b10:	c9                   	leave
+  800b11:	c3                   	ret
+
+00800b12 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800b12:	55                   	push   %ebp
+  800b13:	89 e5                	mov    %esp,%ebp
+  800b15:	56                   	push   %esi
+  800b16:	53                   	push   %ebx
+  800b17:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b1a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  800b1d:	89 c6                	mov    %eax,%esi
+  800b1f:	03 75 10             	add    0x10(%ebp),%esi
+  800b22:	eb 06                	jmp    800b2a <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  800b24:	83 c0 01             	add    $0x1,%eax
+  800b27:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  800b2a:	39 f0                	cmp    %esi,%eax
+  800b2c:	74 14                	je     800b42 <memcmp+0x30>
+    if (*s1 != *s2)
+  800b2e:	0f b6 08             	movzbl (%eax),%ecx
+  800b31:	0f b6 1a             	movzbl (%edx),%ebx
+  800b34:	38 d9                	cmp    %bl,%cl
+  800b36:	74 ec                	je     800b24 <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  800b38:	0f b6 c1             	movzbl %cl,%eax
+  800b3b:	0f b6 db             	movzbl %bl,%ebx
+  800b3e:	29 d8                	sub    %ebx,%eax
+  800b40:	eb 05                	jmp    800b47 <memcmp+0x35>
+  }
+
+  return 0;
+  800b42:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b47:	5b                   	pop    %ebx
+  800b48:	5e                   	pop    %esi
+  800b49:	5d                   	pop    %ebp
+  800b4a:	c3                   	ret
+
+00800b4b <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b4b:	55                   	push   %ebp
+  800b4c:	89 e5                	mov    %esp,%ebp
+  800b4e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b51:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  800b54:	89 c2                	mov    %eax,%edx
+  800b56:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  800b59:	eb 03                	jmp    800b5e <memfind+0x13>
+  800b5b:	83 c0 01             	add    $0x1,%eax
+  800b5e:	39 d0                	cmp    %edx,%eax
+  800b60:	73 04                	jae    800b66 <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  800b62:	38 08                	cmp    %cl,(%eax)
+  800b64:	75 f5                	jne    800b5b <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  800b66:	5d                   	pop    %ebp
+  800b67:	c3                   	ret
+
+00800b68 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800b68:	55                   	push   %ebp
+  800b69:	89 e5                	mov    %esp,%ebp
+  800b6b:	57                   	push   %edi
+  800b6c:	56                   	push   %esi
+  800b6d:	53                   	push   %ebx
+  800b6e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b71:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  800b74:	eb 03                	jmp    800b79 <strtol+0x11>
+    s++;
+  800b76:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  800b79:	0f b6 02             	movzbl (%edx),%eax
+  800b7c:	3c 20                	cmp    $0x20,%al
+  800b7e:	74 f6                	je     800b76 <strtol+0xe>
+  800b80:	3c 09                	cmp    $0x9,%al
+  800b82:	74 f2                	je     800b76 <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  800b84:	3c 2b                	cmp    $0x2b,%al
+  800b86:	74 2a                	je     800bb2 <strtol+0x4a>
+  int neg = 0;
+  800b88:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  800b8d:	3c 2d                	cmp    $0x2d,%al
+  800b8f:	74 2b                	je     800bbc <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b91:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b97:	75 0f                	jne    800ba8 <strtol+0x40>
+  800b99:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b9c:	74 28                	je     800bc6 <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  800b9e:	85 db                	test   %ebx,%ebx
+  800ba0:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ba5:	0f 44 d8             	cmove  %eax,%ebx
+  800ba8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bad:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800bb0:	eb 46                	jmp    800bf8 <strtol+0x90>
+    s++;
+  800bb2:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  800bb5:	bf 00 00 00 00       	mov    $0x0,%edi
+  800bba:	eb d5                	jmp    800b91 <strtol+0x29>
+    s++, neg = 1;
+  800bbc:	83 c2 01             	add    $0x1,%edx
+  800bbf:	bf 01 00 00 00       	mov    $0x1,%edi
+  800bc4:	eb cb                	jmp    800b91 <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800bc6:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800bca:	74 0e                	je     800bda <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  800bcc:	85 db                	test   %ebx,%ebx
+  800bce:	75 d8                	jne    800ba8 <strtol+0x40>
+    s++, base = 8;
+  800bd0:	83 c2 01             	add    $0x1,%edx
+  800bd3:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800bd8:	eb ce                	jmp    800ba8 <strtol+0x40>
+    s += 2, base = 16;
+  800bda:	83 c2 02             	add    $0x2,%edx
+  800bdd:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800be2:	eb c4                	jmp    800ba8 <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  800be4:	0f be c0             	movsbl %al,%eax
+  800be7:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  800bea:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800bed:	7d 3a                	jge    800c29 <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  800bef:	83 c2 01             	add    $0x1,%edx
+  800bf2:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800bf6:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  800bf8:	0f b6 02             	movzbl (%edx),%eax
+  800bfb:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800bfe:	89 f3                	mov    %esi,%ebx
+  800c00:	80 fb 09             	cmp    $0x9,%bl
+  800c03:	76 df                	jbe    800be4 <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  800c05:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800c08:	89 f3                	mov    %esi,%ebx
+  800c0a:	80 fb 19             	cmp    $0x19,%bl
+  800c0d:	77 08                	ja     800c17 <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  800c0f:	0f be c0             	movsbl %al,%eax
+  800c12:	83 e8 57             	sub    $0x57,%eax
+  800c15:	eb d3                	jmp    800bea <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  800c17:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800c1a:	89 f3                	mov    %esi,%ebx
+  800c1c:	80 fb 19             	cmp    $0x19,%bl
+  800c1f:	77 08                	ja     800c29 <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  800c21:	0f be c0             	movsbl %al,%eax
+  800c24:	83 e8 37             	sub    $0x37,%eax
+  800c27:	eb c1                	jmp    800bea <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  800c29:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c2d:	74 05                	je     800c34 <strtol+0xcc>
+    *endptr = (char*)s;
+  800c2f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c32:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  800c34:	89 c8                	mov    %ecx,%eax
+  800c36:	f7 d8                	neg    %eax
+  800c38:	85 ff                	test   %edi,%edi
+  800c3a:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800c3d:	89 c8                	mov    %ecx,%eax
+  800c3f:	5b                   	pop    %ebx
+  800c40:	5e                   	pop    %esi
+  800c41:	5f                   	pop    %edi
+  800c42:	5d                   	pop    %ebp
+  800c43:	c3                   	ret
+
+00800c44 <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800c44:	55                   	push   %ebp
+  800c45:	89 e5                	mov    %esp,%ebp
+  800c47:	57                   	push   %edi
+  800c48:	56                   	push   %esi
+  800c49:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800c4a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c4f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c52:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c55:	89 c3                	mov    %eax,%ebx
+  800c57:	89 c7                	mov    %eax,%edi
+  800c59:	89 c6                	mov    %eax,%esi
+  800c5b:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800c5d:	5b                   	pop    %ebx
+  800c5e:	5e                   	pop    %esi
+  800c5f:	5f                   	pop    %edi
+  800c60:	5d                   	pop    %ebp
+  800c61:	c3                   	ret
+
+00800c62 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800c62:	55                   	push   %ebp
+  800c63:	89 e5                	mov    %esp,%ebp
+  800c65:	57                   	push   %edi
+  800c66:	56                   	push   %esi
+  800c67:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800c68:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c6d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c72:	89 d1                	mov    %edx,%ecx
+  800c74:	89 d3                	mov    %edx,%ebx
+  800c76:	89 d7                	mov    %edx,%edi
+  800c78:	89 d6                	mov    %edx,%esi
+  800c7a:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800c7c:	5b                   	pop    %ebx
+  800c7d:	5e                   	pop    %esi
+  800c7e:	5f                   	pop    %edi
+  800c7f:	5d                   	pop    %ebp
+  800c80:	c3                   	ret
+
+00800c81 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c81:	55                   	push   %ebp
+  800c82:	89 e5                	mov    %esp,%ebp
+  800c84:	57                   	push   %edi
+  800c85:	56                   	push   %esi
+  800c86:	53                   	push   %ebx
+  800c87:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800c8a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c8f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c92:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c97:	89 cb                	mov    %ecx,%ebx
+  800c99:	89 cf                	mov    %ecx,%edi
+  800c9b:	89 ce                	mov    %ecx,%esi
+  800c9d:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c9f:	85 c0                	test   %eax,%eax
+  800ca1:	7f 08                	jg     800cab <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800ca3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ca6:	5b                   	pop    %ebx
+  800ca7:	5e                   	pop    %esi
+  800ca8:	5f                   	pop    %edi
+  800ca9:	5d                   	pop    %ebp
+  800caa:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800cab:	83 ec 0c             	sub    $0xc,%esp
+  800cae:	50                   	push   %eax
+  800caf:	6a 03                	push   $0x3
+  800cb1:	68 c3 3e 80 00       	push   $0x803ec3
+  800cb6:	6a 23                	push   $0x23
+  800cb8:	68 e0 3e 80 00       	push   $0x803ee0
+  800cbd:	e8 89 f5 ff ff       	call   80024b <_panic>
+
+00800cc2 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800cc2:	55                   	push   %ebp
+  800cc3:	89 e5                	mov    %esp,%ebp
+  800cc5:	57                   	push   %edi
+  800cc6:	56                   	push   %esi
+  800cc7:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800cc8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ccd:	b8 02 00 00 00       	mov    $0x2,%eax
+  800cd2:	89 d1                	mov    %edx,%ecx
+  800cd4:	89 d3                	mov    %edx,%ebx
+  800cd6:	89 d7                	mov    %edx,%edi
+  800cd8:	89 d6                	mov    %edx,%esi
+  800cda:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800cdc:	5b                   	pop    %ebx
+  800cdd:	5e                   	pop    %esi
+  800cde:	5f                   	pop    %edi
+  800cdf:	5d                   	pop    %ebp
+  800ce0:	c3                   	ret
+
+00800ce1 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800ce1:	55                   	push   %ebp
+  800ce2:	89 e5                	mov    %esp,%ebp
+  800ce4:	57                   	push   %edi
+  800ce5:	56                   	push   %esi
+  800ce6:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800ce7:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cec:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800cf1:	89 d1                	mov    %edx,%ecx
+  800cf3:	89 d3                	mov    %edx,%ebx
+  800cf5:	89 d7                	mov    %edx,%edi
+  800cf7:	89 d6                	mov    %edx,%esi
+  800cf9:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800cfb:	5b                   	pop    %ebx
+  800cfc:	5e                   	pop    %esi
+  800cfd:	5f                   	pop    %edi
+  800cfe:	5d                   	pop    %ebp
+  800cff:	c3                   	ret
+
+00800d00 <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  800d00:	55                   	push   %ebp
+  800d01:	89 e5                	mov    %esp,%ebp
+  800d03:	57                   	push   %edi
+  800d04:	56                   	push   %esi
+  800d05:	53                   	push   %ebx
+  800d06:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  800d09:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  800d0d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d12:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d15:	b8 14 00 00 00       	mov    $0x14,%eax
+  800d1a:	89 df                	mov    %ebx,%edi
+  800d1c:	89 de                	mov    %ebx,%esi
+  800d1e:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d20:	85 c0                	test   %eax,%eax
+  800d22:	7f 08                	jg     800d2c <sys_env_set_cow+0x2c>
+}
+  800d24:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d27:	5b                   	pop    %ebx
+  800d28:	5e                   	pop    %esi
+  800d29:	5f                   	pop    %edi
+  800d2a:	5d                   	pop    %ebp
+  800d2b:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d2c:	83 ec 0c             	sub    $0xc,%esp
+  800d2f:	50                   	push   %eax
+  800d30:	6a 14                	push   $0x14
+  800d32:	68 c3 3e 80 00       	push   $0x803ec3
+  800d37:	6a 23                	push   $0x23
+  800d39:	68 e0 3e 80 00       	push   $0x803ee0
+  800d3e:	e8 08 f5 ff ff       	call   80024b <_panic>
+
+00800d43 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800d43:	55                   	push   %ebp
+  800d44:	89 e5                	mov    %esp,%ebp
+  800d46:	57                   	push   %edi
+  800d47:	56                   	push   %esi
+  800d48:	53                   	push   %ebx
+  800d49:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800d4c:	be 00 00 00 00       	mov    $0x0,%esi
+  800d51:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d54:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d57:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d5c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d5f:	89 f7                	mov    %esi,%edi
+  800d61:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d63:	85 c0                	test   %eax,%eax
+  800d65:	7f 08                	jg     800d6f <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  800d67:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d6a:	5b                   	pop    %ebx
+  800d6b:	5e                   	pop    %esi
+  800d6c:	5f                   	pop    %edi
+  800d6d:	5d                   	pop    %ebp
+  800d6e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d6f:	83 ec 0c             	sub    $0xc,%esp
+  800d72:	50                   	push   %eax
+  800d73:	6a 04                	push   $0x4
+  800d75:	68 c3 3e 80 00       	push   $0x803ec3
+  800d7a:	6a 23                	push   $0x23
+  800d7c:	68 e0 3e 80 00       	push   $0x803ee0
+  800d81:	e8 c5 f4 ff ff       	call   80024b <_panic>
+
+00800d86 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800d86:	55                   	push   %ebp
+  800d87:	89 e5                	mov    %esp,%ebp
+  800d89:	57                   	push   %edi
+  800d8a:	56                   	push   %esi
+  800d8b:	53                   	push   %ebx
+  800d8c:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800d8f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d92:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d95:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d9a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d9d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800da0:	8b 75 18             	mov    0x18(%ebp),%esi
+  800da3:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800da5:	85 c0                	test   %eax,%eax
+  800da7:	7f 08                	jg     800db1 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  800da9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dac:	5b                   	pop    %ebx
+  800dad:	5e                   	pop    %esi
+  800dae:	5f                   	pop    %edi
+  800daf:	5d                   	pop    %ebp
+  800db0:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800db1:	83 ec 0c             	sub    $0xc,%esp
+  800db4:	50                   	push   %eax
+  800db5:	6a 05                	push   $0x5
+  800db7:	68 c3 3e 80 00       	push   $0x803ec3
+  800dbc:	6a 23                	push   $0x23
+  800dbe:	68 e0 3e 80 00       	push   $0x803ee0
+  800dc3:	e8 83 f4 ff ff       	call   80024b <_panic>
+
+00800dc8 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800dc8:	55                   	push   %ebp
+  800dc9:	89 e5                	mov    %esp,%ebp
+  800dcb:	57                   	push   %edi
+  800dcc:	56                   	push   %esi
+  800dcd:	53                   	push   %ebx
+  800dce:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800dd1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dd6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dd9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ddc:	b8 06 00 00 00       	mov    $0x6,%eax
+  800de1:	89 df                	mov    %ebx,%edi
+  800de3:	89 de                	mov    %ebx,%esi
+  800de5:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800de7:	85 c0                	test   %eax,%eax
+  800de9:	7f 08                	jg     800df3 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  800deb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dee:	5b                   	pop    %ebx
+  800def:	5e                   	pop    %esi
+  800df0:	5f                   	pop    %edi
+  800df1:	5d                   	pop    %ebp
+  800df2:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800df3:	83 ec 0c             	sub    $0xc,%esp
+  800df6:	50                   	push   %eax
+  800df7:	6a 06                	push   $0x6
+  800df9:	68 c3 3e 80 00       	push   $0x803ec3
+  800dfe:	6a 23                	push   $0x23
+  800e00:	68 e0 3e 80 00       	push   $0x803ee0
+  800e05:	e8 41 f4 ff ff       	call   80024b <_panic>
+
+00800e0a <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  800e0a:	55                   	push   %ebp
+  800e0b:	89 e5                	mov    %esp,%ebp
+  800e0d:	57                   	push   %edi
+  800e0e:	56                   	push   %esi
+  800e0f:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e10:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e13:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e16:	b8 11 00 00 00       	mov    $0x11,%eax
+  800e1b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e1e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e21:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e24:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  800e26:	5b                   	pop    %ebx
+  800e27:	5e                   	pop    %esi
+  800e28:	5f                   	pop    %edi
+  800e29:	5d                   	pop    %ebp
+  800e2a:	c3                   	ret
+
+00800e2b <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  800e2b:	55                   	push   %ebp
+  800e2c:	89 e5                	mov    %esp,%ebp
+  800e2e:	57                   	push   %edi
+  800e2f:	56                   	push   %esi
+  800e30:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e31:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e34:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e37:	b8 12 00 00 00       	mov    $0x12,%eax
+  800e3c:	be 00 00 00 00       	mov    $0x0,%esi
+  800e41:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e44:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e47:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  800e49:	5b                   	pop    %ebx
+  800e4a:	5e                   	pop    %esi
+  800e4b:	5f                   	pop    %edi
+  800e4c:	5d                   	pop    %ebp
+  800e4d:	c3                   	ret
+
+00800e4e <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  800e4e:	55                   	push   %ebp
+  800e4f:	89 e5                	mov    %esp,%ebp
+  800e51:	57                   	push   %edi
+  800e52:	56                   	push   %esi
+  800e53:	53                   	push   %ebx
+  800e54:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e57:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e5c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e5f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e62:	b8 16 00 00 00       	mov    $0x16,%eax
+  800e67:	89 df                	mov    %ebx,%edi
+  800e69:	89 de                	mov    %ebx,%esi
+  800e6b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e6d:	85 c0                	test   %eax,%eax
+  800e6f:	7f 08                	jg     800e79 <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  800e71:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e74:	5b                   	pop    %ebx
+  800e75:	5e                   	pop    %esi
+  800e76:	5f                   	pop    %edi
+  800e77:	5d                   	pop    %ebp
+  800e78:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e79:	83 ec 0c             	sub    $0xc,%esp
+  800e7c:	50                   	push   %eax
+  800e7d:	6a 16                	push   $0x16
+  800e7f:	68 c3 3e 80 00       	push   $0x803ec3
+  800e84:	6a 23                	push   $0x23
+  800e86:	68 e0 3e 80 00       	push   $0x803ee0
+  800e8b:	e8 bb f3 ff ff       	call   80024b <_panic>
+
+00800e90 <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  800e90:	55                   	push   %ebp
+  800e91:	89 e5                	mov    %esp,%ebp
+  800e93:	57                   	push   %edi
+  800e94:	56                   	push   %esi
+  800e95:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e96:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e9b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e9e:	b8 17 00 00 00       	mov    $0x17,%eax
+  800ea3:	89 cb                	mov    %ecx,%ebx
+  800ea5:	89 cf                	mov    %ecx,%edi
+  800ea7:	89 ce                	mov    %ecx,%esi
+  800ea9:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  800eab:	5b                   	pop    %ebx
+  800eac:	5e                   	pop    %esi
+  800ead:	5f                   	pop    %edi
+  800eae:	5d                   	pop    %ebp
+  800eaf:	c3                   	ret
+
+00800eb0 <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  800eb0:	55                   	push   %ebp
+  800eb1:	89 e5                	mov    %esp,%ebp
+  800eb3:	57                   	push   %edi
+  800eb4:	56                   	push   %esi
+  800eb5:	53                   	push   %ebx
+  800eb6:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800eb9:	be 00 00 00 00       	mov    $0x0,%esi
+  800ebe:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ec4:	b8 18 00 00 00       	mov    $0x18,%eax
+  800ec9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ecc:	89 f7                	mov    %esi,%edi
+  800ece:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ed0:	85 c0                	test   %eax,%eax
+  800ed2:	7f 08                	jg     800edc <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  800ed4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ed7:	5b                   	pop    %ebx
+  800ed8:	5e                   	pop    %esi
+  800ed9:	5f                   	pop    %edi
+  800eda:	5d                   	pop    %ebp
+  800edb:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800edc:	83 ec 0c             	sub    $0xc,%esp
+  800edf:	50                   	push   %eax
+  800ee0:	6a 18                	push   $0x18
+  800ee2:	68 c3 3e 80 00       	push   $0x803ec3
+  800ee7:	6a 23                	push   $0x23
+  800ee9:	68 e0 3e 80 00       	push   $0x803ee0
+  800eee:	e8 58 f3 ff ff       	call   80024b <_panic>
+
+00800ef3 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  800ef3:	55                   	push   %ebp
+  800ef4:	89 e5                	mov    %esp,%ebp
+  800ef6:	57                   	push   %edi
+  800ef7:	56                   	push   %esi
+  800ef8:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800ef9:	be 00 00 00 00       	mov    $0x0,%esi
+  800efe:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f01:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f04:	b8 19 00 00 00       	mov    $0x19,%eax
+  800f09:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f0c:	89 f7                	mov    %esi,%edi
+  800f0e:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  800f10:	5b                   	pop    %ebx
+  800f11:	5e                   	pop    %esi
+  800f12:	5f                   	pop    %edi
+  800f13:	5d                   	pop    %ebp
+  800f14:	c3                   	ret
+
+00800f15 <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  800f15:	55                   	push   %ebp
+  800f16:	89 e5                	mov    %esp,%ebp
+  800f18:	57                   	push   %edi
+  800f19:	56                   	push   %esi
+  800f1a:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f1b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f20:	b8 15 00 00 00       	mov    $0x15,%eax
+  800f25:	89 d1                	mov    %edx,%ecx
+  800f27:	89 d3                	mov    %edx,%ebx
+  800f29:	89 d7                	mov    %edx,%edi
+  800f2b:	89 d6                	mov    %edx,%esi
+  800f2d:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800f2f:	5b                   	pop    %ebx
+  800f30:	5e                   	pop    %esi
+  800f31:	5f                   	pop    %edi
+  800f32:	5d                   	pop    %ebp
+  800f33:	c3                   	ret
+
+00800f34 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800f34:	55                   	push   %ebp
+  800f35:	89 e5                	mov    %esp,%ebp
+  800f37:	57                   	push   %edi
+  800f38:	56                   	push   %esi
+  800f39:	53                   	push   %ebx
+  800f3a:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f3d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f42:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f45:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f48:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f4d:	89 df                	mov    %ebx,%edi
+  800f4f:	89 de                	mov    %ebx,%esi
+  800f51:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f53:	85 c0                	test   %eax,%eax
+  800f55:	7f 08                	jg     800f5f <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800f57:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f5a:	5b                   	pop    %ebx
+  800f5b:	5e                   	pop    %esi
+  800f5c:	5f                   	pop    %edi
+  800f5d:	5d                   	pop    %ebp
+  800f5e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f5f:	83 ec 0c             	sub    $0xc,%esp
+  800f62:	50                   	push   %eax
+  800f63:	6a 08                	push   $0x8
+  800f65:	68 c3 3e 80 00       	push   $0x803ec3
+  800f6a:	6a 23                	push   $0x23
+  800f6c:	68 e0 3e 80 00       	push   $0x803ee0
+  800f71:	e8 d5 f2 ff ff       	call   80024b <_panic>
+
+00800f76 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800f76:	55                   	push   %ebp
+  800f77:	89 e5                	mov    %esp,%ebp
+  800f79:	57                   	push   %edi
+  800f7a:	56                   	push   %esi
+  800f7b:	53                   	push   %ebx
+  800f7c:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f7f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f84:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f87:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f8a:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f8f:	89 df                	mov    %ebx,%edi
+  800f91:	89 de                	mov    %ebx,%esi
+  800f93:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f95:	85 c0                	test   %eax,%eax
+  800f97:	7f 08                	jg     800fa1 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  800f99:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f9c:	5b                   	pop    %ebx
+  800f9d:	5e                   	pop    %esi
+  800f9e:	5f                   	pop    %edi
+  800f9f:	5d                   	pop    %ebp
+  800fa0:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800fa1:	83 ec 0c             	sub    $0xc,%esp
+  800fa4:	50                   	push   %eax
+  800fa5:	6a 09                	push   $0x9
+  800fa7:	68 c3 3e 80 00       	push   $0x803ec3
+  800fac:	6a 23                	push   $0x23
+  800fae:	68 e0 3e 80 00       	push   $0x803ee0
+  800fb3:	e8 93 f2 ff ff       	call   80024b <_panic>
+
+00800fb8 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800fb8:	55                   	push   %ebp
+  800fb9:	89 e5                	mov    %esp,%ebp
+  800fbb:	57                   	push   %edi
+  800fbc:	56                   	push   %esi
+  800fbd:	53                   	push   %ebx
+  800fbe:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800fc1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fc6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fcc:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800fd1:	89 df                	mov    %ebx,%edi
+  800fd3:	89 de                	mov    %ebx,%esi
+  800fd5:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800fd7:	85 c0                	test   %eax,%eax
+  800fd9:	7f 08                	jg     800fe3 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  800fdb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fde:	5b                   	pop    %ebx
+  800fdf:	5e                   	pop    %esi
+  800fe0:	5f                   	pop    %edi
+  800fe1:	5d                   	pop    %ebp
+  800fe2:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800fe3:	83 ec 0c             	sub    $0xc,%esp
+  800fe6:	50                   	push   %eax
+  800fe7:	6a 0a                	push   $0xa
+  800fe9:	68 c3 3e 80 00       	push   $0x803ec3
+  800fee:	6a 23                	push   $0x23
+  800ff0:	68 e0 3e 80 00       	push   $0x803ee0
+  800ff5:	e8 51 f2 ff ff       	call   80024b <_panic>
+
+00800ffa <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  800ffa:	55                   	push   %ebp
+  800ffb:	89 e5                	mov    %esp,%ebp
+  800ffd:	57                   	push   %edi
+  800ffe:	56                   	push   %esi
+  800fff:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801000:	8b 55 08             	mov    0x8(%ebp),%edx
+  801003:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801006:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80100b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80100e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801011:	8b 75 18             	mov    0x18(%ebp),%esi
+  801014:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  801016:	5b                   	pop    %ebx
+  801017:	5e                   	pop    %esi
+  801018:	5f                   	pop    %edi
+  801019:	5d                   	pop    %ebp
+  80101a:	c3                   	ret
+
+0080101b <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  80101b:	55                   	push   %ebp
+  80101c:	89 e5                	mov    %esp,%ebp
+  80101e:	57                   	push   %edi
+  80101f:	56                   	push   %esi
+  801020:	53                   	push   %ebx
+  801021:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801024:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801029:	8b 55 08             	mov    0x8(%ebp),%edx
+  80102c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80102f:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801034:	89 df                	mov    %ebx,%edi
+  801036:	89 de                	mov    %ebx,%esi
+  801038:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80103a:	85 c0                	test   %eax,%eax
+  80103c:	7f 08                	jg     801046 <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  80103e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801041:	5b                   	pop    %ebx
+  801042:	5e                   	pop    %esi
+  801043:	5f                   	pop    %edi
+  801044:	5d                   	pop    %ebp
+  801045:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801046:	83 ec 0c             	sub    $0xc,%esp
+  801049:	50                   	push   %eax
+  80104a:	6a 0d                	push   $0xd
+  80104c:	68 c3 3e 80 00       	push   $0x803ec3
+  801051:	6a 23                	push   $0x23
+  801053:	68 e0 3e 80 00       	push   $0x803ee0
+  801058:	e8 ee f1 ff ff       	call   80024b <_panic>
+
+0080105d <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  80105d:	55                   	push   %ebp
+  80105e:	89 e5                	mov    %esp,%ebp
+  801060:	57                   	push   %edi
+  801061:	56                   	push   %esi
+  801062:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801063:	ba 00 00 00 00       	mov    $0x0,%edx
+  801068:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80106d:	89 d1                	mov    %edx,%ecx
+  80106f:	89 d3                	mov    %edx,%ebx
+  801071:	89 d7                	mov    %edx,%edi
+  801073:	89 d6                	mov    %edx,%esi
+  801075:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801077:	5b                   	pop    %ebx
+  801078:	5e                   	pop    %esi
+  801079:	5f                   	pop    %edi
+  80107a:	5d                   	pop    %ebp
+  80107b:	c3                   	ret
+
+0080107c <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  80107c:	55                   	push   %ebp
+  80107d:	89 e5                	mov    %esp,%ebp
+  80107f:	57                   	push   %edi
+  801080:	56                   	push   %esi
+  801081:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801082:	8b 55 08             	mov    0x8(%ebp),%edx
+  801085:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801088:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80108d:	be 00 00 00 00       	mov    $0x0,%esi
+  801092:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801095:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801098:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  80109a:	5b                   	pop    %ebx
+  80109b:	5e                   	pop    %esi
+  80109c:	5f                   	pop    %edi
+  80109d:	5d                   	pop    %ebp
+  80109e:	c3                   	ret
+
+0080109f <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  80109f:	55                   	push   %ebp
+  8010a0:	89 e5                	mov    %esp,%ebp
+  8010a2:	57                   	push   %edi
+  8010a3:	56                   	push   %esi
+  8010a4:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8010a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8010aa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010b0:	b8 10 00 00 00       	mov    $0x10,%eax
+  8010b5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010b8:	89 f7                	mov    %esi,%edi
+  8010ba:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  8010bc:	5b                   	pop    %ebx
+  8010bd:	5e                   	pop    %esi
+  8010be:	5f                   	pop    %edi
+  8010bf:	5d                   	pop    %ebp
+  8010c0:	c3                   	ret
+
+008010c1 <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  8010c1:	55                   	push   %ebp
+  8010c2:	89 e5                	mov    %esp,%ebp
+  8010c4:	57                   	push   %edi
+  8010c5:	56                   	push   %esi
+  8010c6:	53                   	push   %ebx
+  8010c7:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  8010ca:	80 3d a4 68 80 00 00 	cmpb   $0x0,0x8068a4
+  8010d1:	74 41                	je     801114 <sys_batch+0x53>
+  8010d3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010d6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  8010d9:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  8010e0:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8010e3:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  8010e6:	7d 45                	jge    80112d <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  8010e8:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8010eb:	8b 06                	mov    (%esi),%eax
+  8010ed:	8b 56 04             	mov    0x4(%esi),%edx
+  8010f0:	8b 4e 08             	mov    0x8(%esi),%ecx
+  8010f3:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  8010f6:	8b 7e 10             	mov    0x10(%esi),%edi
+  8010f9:	8b 76 14             	mov    0x14(%esi),%esi
+  8010fc:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  8010fe:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801101:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  801104:	83 c6 1c             	add    $0x1c,%esi
+  801107:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  80110a:	85 c0                	test   %eax,%eax
+  80110c:	78 1f                	js     80112d <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  80110e:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  801112:	eb cc                	jmp    8010e0 <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  801114:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801119:	b8 13 00 00 00       	mov    $0x13,%eax
+  80111e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801121:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801124:	89 df                	mov    %ebx,%edi
+  801126:	89 de                	mov    %ebx,%esi
+  801128:	cd 30                	int    $0x30
+  80112a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  80112d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801130:	83 c4 08             	add    $0x8,%esp
+  801133:	5b                   	pop    %ebx
+  801134:	5e                   	pop    %esi
+  801135:	5f                   	pop    %edi
+  801136:	5d                   	pop    %ebp
+  801137:	c3                   	ret
+
+00801138 <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  801138:	55                   	push   %ebp
+  801139:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  80113b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80113e:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  801144:	5d                   	pop    %ebp
+  801145:	c3                   	ret
+
+00801146 <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  801146:	55                   	push   %ebp
+  801147:	89 e5                	mov    %esp,%ebp
+  801149:	56                   	push   %esi
+  80114a:	53                   	push   %ebx
+  80114b:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  80114e:	8b 1e                	mov    (%esi),%ebx
+  801150:	85 db                	test   %ebx,%ebx
+  801152:	75 09                	jne    80115d <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  801154:	89 d8                	mov    %ebx,%eax
+  801156:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801159:	5b                   	pop    %ebx
+  80115a:	5e                   	pop    %esi
+  80115b:	5d                   	pop    %ebp
+  80115c:	c3                   	ret
+  b->sb_n = 0;
+  80115d:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  801163:	53                   	push   %ebx
+  801164:	8d 46 04             	lea    0x4(%esi),%eax
+  801167:	50                   	push   %eax
+  801168:	e8 54 ff ff ff       	call   8010c1 <sys_batch>
+  80116d:	83 c4 08             	add    $0x8,%esp
+  801170:	85 c0                	test   %eax,%eax
+  801172:	78 1e                	js     801192 <sysbatch_flush+0x4c>
+  if (r < n)
+  801174:	39 c3                	cmp    %eax,%ebx
+  801176:	7f 07                	jg     80117f <sysbatch_flush+0x39>
+  return 0;
+  801178:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80117d:	eb d5                	jmp    801154 <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  80117f:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801182:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  801186:	85 db                	test   %ebx,%ebx
+  801188:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80118d:	0f 49 d8             	cmovns %eax,%ebx
+  801190:	eb c2                	jmp    801154 <sysbatch_flush+0xe>
+    return r;
+  801192:	89 c3                	mov    %eax,%ebx
+  801194:	eb be                	jmp    801154 <sysbatch_flush+0xe>
+
+00801196 <sysbatch_add>:
+{
+  801196:	55                   	push   %ebp
+  801197:	89 e5                	mov    %esp,%ebp
+  801199:	53                   	push   %ebx
+  80119a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  80119d:	83 3b 40             	cmpl   $0x40,(%ebx)
+  8011a0:	74 41                	je     8011e3 <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  8011a2:	8b 03                	mov    (%ebx),%eax
+  8011a4:	8d 50 01             	lea    0x1(%eax),%edx
+  8011a7:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  8011a9:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8011ac:	01 d8                	add    %ebx,%eax
+  8011ae:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8011b1:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  8011b4:	8b 55 10             	mov    0x10(%ebp),%edx
+  8011b7:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  8011ba:	8b 55 14             	mov    0x14(%ebp),%edx
+  8011bd:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  8011c0:	8b 55 18             	mov    0x18(%ebp),%edx
+  8011c3:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  8011c6:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  8011c9:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  8011cc:	8b 55 20             	mov    0x20(%ebp),%edx
+  8011cf:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  8011d2:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  8011d9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011de:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8011e1:	c9                   	leave
+  8011e2:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  8011e3:	53                   	push   %ebx
+  8011e4:	e8 5d ff ff ff       	call   801146 <sysbatch_flush>
+  8011e9:	83 c4 04             	add    $0x4,%esp
+  8011ec:	85 c0                	test   %eax,%eax
+  8011ee:	79 b2                	jns    8011a2 <sysbatch_add+0xc>
+  8011f0:	eb ec                	jmp    8011de <sysbatch_add+0x48>
+
+008011f2 <pgfault>:
+// Custom page fault handler - if faulting page is copy-on-write,
+// map in our own private writable copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  8011f2:	55                   	push   %ebp
+  8011f3:	89 e5                	mov    %esp,%ebp
+  8011f5:	56                   	push   %esi
+  8011f6:	53                   	push   %ebx
+  8011f7:	8b 45 08             	mov    0x8(%ebp),%eax
+  void *addr = (void*)utf->utf_fault_va;
+  8011fa:	8b 18                	mov    (%eax),%ebx
+  uint32_t err = utf->utf_err;
+  8011fc:	8b 70 04             	mov    0x4(%eax),%esi
+  // Hint:
+  //   Use the read-only page table mappings at uvpt
+  //   (see <inc/memlayout.h>).
+
+  // Faults in file mappings are mmap's to handle.
+  if (mmap_fault(utf))
+  8011ff:	83 ec 0c             	sub    $0xc,%esp
+  801202:	50                   	push   %eax
+  801203:	e8 05 1e 00 00       	call   80300d <mmap_fault>
+  801208:	83 c4 10             	add    $0x10,%esp
+  80120b:	84 c0                	test   %al,%al
+  80120d:	75 7d                	jne    80128c <pgfault+0x9a>
+    return;
+
+  // LAB 4: Your code here.
+  if ( !(err & FEC_WR) ) {
+  80120f:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  801215:	74 7c                	je     801293 <pgfault+0xa1>
+    panic("user_pgfault: %e", err);
+  }
+
+  if ( !(uvpt[PGNUM(addr)] & PTE_COW) ) {
+  801217:	89 d8                	mov    %ebx,%eax
+  801219:	c1 e8 0c             	shr    $0xc,%eax
+  80121c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801223:	f6 c4 08             	test   $0x8,%ah
+  801226:	74 7d                	je     8012a5 <pgfault+0xb3>
+  // page to the old page's address.
+  // Hint:
+  //   You should make three system calls.
+
+  // LAB 4: Your code here.
+  addr = ROUNDDOWN(addr, PGSIZE);
+  801228:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+
+  // map page to temporary location
+  if ( (r = sys_page_alloc(0, PFTEMP, (PTE_P | PTE_U | PTE_W))) < 0) {
+  80122e:	83 ec 04             	sub    $0x4,%esp
+  801231:	6a 07                	push   $0x7
+  801233:	68 00 f0 7f 00       	push   $0x7ff000
+  801238:	6a 00                	push   $0x0
+  80123a:	e8 04 fb ff ff       	call   800d43 <sys_page_alloc>
+  80123f:	83 c4 10             	add    $0x10,%esp
+  801242:	85 c0                	test   %eax,%eax
+  801244:	78 73                	js     8012b9 <pgfault+0xc7>
+    panic("sys_page_alloc: %e", r);
+  }
+
+  // copy data from old page to new page
+  memmove(PFTEMP, addr, PGSIZE);
+  801246:	83 ec 04             	sub    $0x4,%esp
+  801249:	68 00 10 00 00       	push   $0x1000
+  80124e:	53                   	push   %ebx
+  80124f:	68 00 f0 7f 00       	push   $0x7ff000
+  801254:	e8 41 f8 ff ff       	call   800a9a <memmove>
+
+  // move new page to old page address
+  if ( (r = sys_page_map(0, PFTEMP, 0, addr, (PTE_P | PTE_U | PTE_W))) < 0) {
+  801259:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801260:	53                   	push   %ebx
+  801261:	6a 00                	push   $0x0
+  801263:	68 00 f0 7f 00       	push   $0x7ff000
+  801268:	6a 00                	push   $0x0
+  80126a:	e8 17 fb ff ff       	call   800d86 <sys_page_map>
+  80126f:	83 c4 20             	add    $0x20,%esp
+  801272:	85 c0                	test   %eax,%eax
+  801274:	78 55                	js     8012cb <pgfault+0xd9>
+    panic("sys_page_map: %e", r);
+  }
+
+  if ( (r = sys_page_unmap(0, PFTEMP)) < 0) {
+  801276:	83 ec 08             	sub    $0x8,%esp
+  801279:	68 00 f0 7f 00       	push   $0x7ff000
+  80127e:	6a 00                	push   $0x0
+  801280:	e8 43 fb ff ff       	call   800dc8 <sys_page_unmap>
+  801285:	83 c4 10             	add    $0x10,%esp
+  801288:	85 c0                	test   %eax,%eax
+  80128a:	78 51                	js     8012dd <pgfault+0xeb>
+    panic("sys_page_unmap: %e", r);
+  }
+}
+  80128c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80128f:	5b                   	pop    %ebx
+  801290:	5e                   	pop    %esi
+  801291:	5d                   	pop    %ebp
+  801292:	c3                   	ret
+    panic("user_pgfault: %e", err);
+  801293:	56                   	push   %esi
+  801294:	68 ee 3e 80 00       	push   $0x803eee
+  801299:	6a 1d                	push   $0x1d
+  80129b:	68 ff 3e 80 00       	push   $0x803eff
+  8012a0:	e8 a6 ef ff ff       	call   80024b <_panic>
+    panic("user_pgfault: page not COW");
+  8012a5:	83 ec 04             	sub    $0x4,%esp
+  8012a8:	68 0a 3f 80 00       	push   $0x803f0a
+  8012ad:	6a 21                	push   $0x21
+  8012af:	68 ff 3e 80 00       	push   $0x803eff
+  8012b4:	e8 92 ef ff ff       	call   80024b <_panic>
+    panic("sys_page_alloc: %e", r);
+  8012b9:	50                   	push   %eax
+  8012ba:	68 38 3b 80 00       	push   $0x803b38
+  8012bf:	6a 2f                	push   $0x2f
+  8012c1:	68 ff 3e 80 00       	push   $0x803eff
+  8012c6:	e8 80 ef ff ff       	call   80024b <_panic>
+    panic("sys_page_map: %e", r);
+  8012cb:	50                   	push   %eax
+  8012cc:	68 25 3f 80 00       	push   $0x803f25
+  8012d1:	6a 37                	push   $0x37
+  8012d3:	68 ff 3e 80 00       	push   $0x803eff
+  8012d8:	e8 6e ef ff ff       	call   80024b <_panic>
+    panic("sys_page_unmap: %e", r);
+  8012dd:	50                   	push   %eax
+  8012de:	68 36 3f 80 00       	push   $0x803f36
+  8012e3:	6a 3b                	push   $0x3b
+  8012e5:	68 ff 3e 80 00       	push   $0x803eff
+  8012ea:	e8 5c ef ff ff       	call   80024b <_panic>
+
+008012ef <shared_pgfault>:
+
+// Challenge!
+//
+static void
+shared_pgfault(struct UTrapframe *utf)
+{
+  8012ef:	55                   	push   %ebp
+  8012f0:	89 e5                	mov    %esp,%ebp
+  8012f2:	53                   	push   %ebx
+  8012f3:	83 ec 10             	sub    $0x10,%esp
+  8012f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  // just has fewer error checks
+  
+  void *addr = (void*)utf->utf_fault_va;
+  8012f9:	8b 18                	mov    (%eax),%ebx
+  uint32_t err = utf->utf_err;
+  int r;
+
+  if (mmap_fault(utf))
+  8012fb:	50                   	push   %eax
+  8012fc:	e8 0c 1d 00 00       	call   80300d <mmap_fault>
+  801301:	83 c4 10             	add    $0x10,%esp
+  801304:	84 c0                	test   %al,%al
+  801306:	74 05                	je     80130d <shared_pgfault+0x1e>
+  }
+
+  if ( (r = sys_page_unmap(0, PFTEMP)) < 0) {
+    panic("sys_page_unmap: %e", r);
+  }
+}
+  801308:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80130b:	c9                   	leave
+  80130c:	c3                   	ret
+  addr = ROUNDDOWN(addr, PGSIZE);
+  80130d:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if ( (r = sys_page_alloc(0, PFTEMP, (PTE_P | PTE_U | PTE_W))) < 0) {
+  801313:	83 ec 04             	sub    $0x4,%esp
+  801316:	6a 07                	push   $0x7
+  801318:	68 00 f0 7f 00       	push   $0x7ff000
+  80131d:	6a 00                	push   $0x0
+  80131f:	e8 1f fa ff ff       	call   800d43 <sys_page_alloc>
+  801324:	83 c4 10             	add    $0x10,%esp
+  801327:	85 c0                	test   %eax,%eax
+  801329:	78 5b                	js     801386 <shared_pgfault+0x97>
+  memmove(PFTEMP, addr, PGSIZE);
+  80132b:	83 ec 04             	sub    $0x4,%esp
+  80132e:	68 00 10 00 00       	push   $0x1000
+  801333:	53                   	push   %ebx
+  801334:	68 00 f0 7f 00       	push   $0x7ff000
+  801339:	e8 5c f7 ff ff       	call   800a9a <memmove>
+  if ( (r = sys_page_map(0, PFTEMP, 0, addr, (PTE_P | PTE_U | PTE_W))) < 0) {
+  80133e:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801345:	53                   	push   %ebx
+  801346:	6a 00                	push   $0x0
+  801348:	68 00 f0 7f 00       	push   $0x7ff000
+  80134d:	6a 00                	push   $0x0
+  80134f:	e8 32 fa ff ff       	call   800d86 <sys_page_map>
+  801354:	83 c4 20             	add    $0x20,%esp
+  801357:	85 c0                	test   %eax,%eax
+  801359:	78 40                	js     80139b <shared_pgfault+0xac>
+  if ( (r = sys_page_unmap(0, PFTEMP)) < 0) {
+  80135b:	83 ec 08             	sub    $0x8,%esp
+  80135e:	68 00 f0 7f 00       	push   $0x7ff000
+  801363:	6a 00                	push   $0x0
+  801365:	e8 5e fa ff ff       	call   800dc8 <sys_page_unmap>
+  80136a:	83 c4 10             	add    $0x10,%esp
+  80136d:	85 c0                	test   %eax,%eax
+  80136f:	79 97                	jns    801308 <shared_pgfault+0x19>
+    panic("sys_page_unmap: %e", r);
+  801371:	50                   	push   %eax
+  801372:	68 36 3f 80 00       	push   $0x803f36
+  801377:	68 b0 00 00 00       	push   $0xb0
+  80137c:	68 ff 3e 80 00       	push   $0x803eff
+  801381:	e8 c5 ee ff ff       	call   80024b <_panic>
+    panic("sys_page_alloc: %e", r);
+  801386:	50                   	push   %eax
+  801387:	68 38 3b 80 00       	push   $0x803b38
+  80138c:	68 a4 00 00 00       	push   $0xa4
+  801391:	68 ff 3e 80 00       	push   $0x803eff
+  801396:	e8 b0 ee ff ff       	call   80024b <_panic>
+    panic("sys_page_map: %e", r);
+  80139b:	50                   	push   %eax
+  80139c:	68 25 3f 80 00       	push   $0x803f25
+  8013a1:	68 ac 00 00 00       	push   $0xac
+  8013a6:	68 ff 3e 80 00       	push   $0x803eff
+  8013ab:	e8 9b ee ff ff       	call   80024b <_panic>
+
+008013b0 <fork>:
+{
+  8013b0:	55                   	push   %ebp
+  8013b1:	89 e5                	mov    %esp,%ebp
+  8013b3:	53                   	push   %ebx
+  8013b4:	83 ec 04             	sub    $0x4,%esp
+  parent_id = sys_getenvid();
+  8013b7:	e8 06 f9 ff ff       	call   800cc2 <sys_getenvid>
+  set_pgfault_handler(pgfault);
+  8013bc:	83 ec 0c             	sub    $0xc,%esp
+  8013bf:	68 f2 11 80 00       	push   $0x8011f2
+  8013c4:	e8 d3 22 00 00       	call   80369c <set_pgfault_handler>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+  envid_t ret;
+  __asm __volatile("int %2"
+  8013c9:	b8 07 00 00 00       	mov    $0x7,%eax
+  8013ce:	cd 30                	int    $0x30
+  8013d0:	89 c3                	mov    %eax,%ebx
+  if (envid < 0) {
+  8013d2:	83 c4 10             	add    $0x10,%esp
+  8013d5:	85 c0                	test   %eax,%eax
+  8013d7:	78 66                	js     80143f <fork+0x8f>
+  } else if (envid == 0) {
+  8013d9:	74 76                	je     801451 <fork+0xa1>
+  if ( (error = sys_page_map_range(0, 0, UXSTACKTOP - PGSIZE,
+  8013db:	83 ec 0c             	sub    $0xc,%esp
+  8013de:	6a 01                	push   $0x1
+  8013e0:	50                   	push   %eax
+  8013e1:	68 00 f0 bf ee       	push   $0xeebff000
+  8013e6:	6a 00                	push   $0x0
+  8013e8:	6a 00                	push   $0x0
+  8013ea:	e8 1b fa ff ff       	call   800e0a <sys_page_map_range>
+  8013ef:	83 c4 20             	add    $0x20,%esp
+  8013f2:	85 c0                	test   %eax,%eax
+  8013f4:	78 77                	js     80146d <fork+0xbd>
+  if ( (error = sys_page_alloc(envid,
+  8013f6:	83 ec 04             	sub    $0x4,%esp
+  8013f9:	6a 07                	push   $0x7
+  8013fb:	68 00 f0 bf ee       	push   $0xeebff000
+  801400:	53                   	push   %ebx
+  801401:	e8 3d f9 ff ff       	call   800d43 <sys_page_alloc>
+  801406:	83 c4 10             	add    $0x10,%esp
+  801409:	85 c0                	test   %eax,%eax
+  80140b:	78 72                	js     80147f <fork+0xcf>
+          thisenv->env_pgfault_upcall)) < 0) {
+  80140d:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  801412:	8b 40 64             	mov    0x64(%eax),%eax
+  if ( (error = sys_env_set_pgfault_upcall(envid,
+  801415:	83 ec 08             	sub    $0x8,%esp
+  801418:	50                   	push   %eax
+  801419:	53                   	push   %ebx
+  80141a:	e8 99 fb ff ff       	call   800fb8 <sys_env_set_pgfault_upcall>
+  80141f:	83 c4 10             	add    $0x10,%esp
+  801422:	85 c0                	test   %eax,%eax
+  801424:	78 6b                	js     801491 <fork+0xe1>
+  if ( (error = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+  801426:	83 ec 08             	sub    $0x8,%esp
+  801429:	6a 02                	push   $0x2
+  80142b:	53                   	push   %ebx
+  80142c:	e8 03 fb ff ff       	call   800f34 <sys_env_set_status>
+  801431:	83 c4 10             	add    $0x10,%esp
+  801434:	85 c0                	test   %eax,%eax
+  801436:	78 6b                	js     8014a3 <fork+0xf3>
+}
+  801438:	89 d8                	mov    %ebx,%eax
+  80143a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80143d:	c9                   	leave
+  80143e:	c3                   	ret
+    panic("sys_exofork: %e", envid);
+  80143f:	50                   	push   %eax
+  801440:	68 49 3f 80 00       	push   $0x803f49
+  801445:	6a 5e                	push   $0x5e
+  801447:	68 ff 3e 80 00       	push   $0x803eff
+  80144c:	e8 fa ed ff ff       	call   80024b <_panic>
+    thisenv = &envs[ENVX(sys_getenvid())];
+  801451:	e8 6c f8 ff ff       	call   800cc2 <sys_getenvid>
+  801456:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80145b:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80145e:	c1 e0 04             	shl    $0x4,%eax
+  801461:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801466:	a3 a0 68 80 00       	mov    %eax,0x8068a0
+    return 0;
+  80146b:	eb cb                	jmp    801438 <fork+0x88>
+    panic("sys_page_map_range: %e", error);
+  80146d:	50                   	push   %eax
+  80146e:	68 59 3f 80 00       	push   $0x803f59
+  801473:	6a 69                	push   $0x69
+  801475:	68 ff 3e 80 00       	push   $0x803eff
+  80147a:	e8 cc ed ff ff       	call   80024b <_panic>
+    panic("sys_page_alloc: %e", error);
+  80147f:	50                   	push   %eax
+  801480:	68 38 3b 80 00       	push   $0x803b38
+  801485:	6a 70                	push   $0x70
+  801487:	68 ff 3e 80 00       	push   $0x803eff
+  80148c:	e8 ba ed ff ff       	call   80024b <_panic>
+    panic("sys_env_set_pgfault_upcall: %e", error);
+  801491:	50                   	push   %eax
+  801492:	68 88 3f 80 00       	push   $0x803f88
+  801497:	6a 76                	push   $0x76
+  801499:	68 ff 3e 80 00       	push   $0x803eff
+  80149e:	e8 a8 ed ff ff       	call   80024b <_panic>
+    panic("sys_env_set_status: %e", error);
+  8014a3:	50                   	push   %eax
+  8014a4:	68 70 3f 80 00       	push   $0x803f70
+  8014a9:	6a 7a                	push   $0x7a
+  8014ab:	68 ff 3e 80 00       	push   $0x803eff
+  8014b0:	e8 96 ed ff ff       	call   80024b <_panic>
+
+008014b5 <kfork>:
+{
+  8014b5:	55                   	push   %ebp
+  8014b6:	89 e5                	mov    %esp,%ebp
+  8014b8:	53                   	push   %ebx
+  8014b9:	83 ec 10             	sub    $0x10,%esp
+  set_pgfault_handler(pgfault);
+  8014bc:	68 f2 11 80 00       	push   $0x8011f2
+  8014c1:	e8 d6 21 00 00       	call   80369c <set_pgfault_handler>
+  if ((envid = sys_fork()) == 0)
+  8014c6:	e8 4a fa ff ff       	call   800f15 <sys_fork>
+  8014cb:	89 c3                	mov    %eax,%ebx
+  8014cd:	83 c4 10             	add    $0x10,%esp
+  8014d0:	85 c0                	test   %eax,%eax
+  8014d2:	74 07                	je     8014db <kfork+0x26>
+}
+  8014d4:	89 d8                	mov    %ebx,%eax
+  8014d6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014d9:	c9                   	leave
+  8014da:	c3                   	ret
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8014db:	e8 e2 f7 ff ff       	call   800cc2 <sys_getenvid>
+  8014e0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8014e5:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8014e8:	c1 e0 04             	shl    $0x4,%eax
+  8014eb:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8014f0:	a3 a0 68 80 00       	mov    %eax,0x8068a0
+  return envid;
+  8014f5:	eb dd                	jmp    8014d4 <kfork+0x1f>
+
+008014f7 <sfork>:
+
+int
+sfork(void)
+{
+  8014f7:	55                   	push   %ebp
+  8014f8:	89 e5                	mov    %esp,%ebp
+  8014fa:	53                   	push   %ebx
+  8014fb:	83 ec 04             	sub    $0x4,%esp
+  envid_t envid, parent_id;
+  int error;
+
+  parent_id = sys_getenvid();
+  8014fe:	e8 bf f7 ff ff       	call   800cc2 <sys_getenvid>
+
+  // set up page fault handler
+  set_pgfault_handler(shared_pgfault);
+  801503:	83 ec 0c             	sub    $0xc,%esp
+  801506:	68 ef 12 80 00       	push   $0x8012ef
+  80150b:	e8 8c 21 00 00       	call   80369c <set_pgfault_handler>
+  801510:	b8 07 00 00 00       	mov    $0x7,%eax
+  801515:	cd 30                	int    $0x30
+  801517:	89 c3                	mov    %eax,%ebx
+
+  // create a child with sys_exofork
+  envid = sys_exofork();
+  
+  if (envid < 0) {
+  801519:	83 c4 10             	add    $0x10,%esp
+  80151c:	85 c0                	test   %eax,%eax
+  80151e:	78 09                	js     801529 <sfork+0x32>
+    panic("sys_exofork: %e", envid);
+  } else if (envid == 0) {
+  801520:	75 1c                	jne    80153e <sfork+0x47>
+  if ( (error = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+    panic("sys_env_set_status: %e", error);
+  }
+
+  return envid;
+}
+  801522:	89 d8                	mov    %ebx,%eax
+  801524:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801527:	c9                   	leave
+  801528:	c3                   	ret
+    panic("sys_exofork: %e", envid);
+  801529:	50                   	push   %eax
+  80152a:	68 49 3f 80 00       	push   $0x803f49
+  80152f:	68 c3 00 00 00       	push   $0xc3
+  801534:	68 ff 3e 80 00       	push   $0x803eff
+  801539:	e8 0d ed ff ff       	call   80024b <_panic>
+  if ( (error = sys_page_map_range(0, 0, USTACKTOP - PGSIZE,
+  80153e:	83 ec 0c             	sub    $0xc,%esp
+  801541:	6a 00                	push   $0x0
+  801543:	50                   	push   %eax
+  801544:	68 00 d0 bf ee       	push   $0xeebfd000
+  801549:	6a 00                	push   $0x0
+  80154b:	6a 00                	push   $0x0
+  80154d:	e8 b8 f8 ff ff       	call   800e0a <sys_page_map_range>
+  801552:	83 c4 20             	add    $0x20,%esp
+  801555:	85 c0                	test   %eax,%eax
+  801557:	78 79                	js     8015d2 <sfork+0xdb>
+  if ( (error = sys_page_map_range(0, (void *) (USTACKTOP - PGSIZE), PGSIZE,
+  801559:	83 ec 0c             	sub    $0xc,%esp
+  80155c:	6a 01                	push   $0x1
+  80155e:	53                   	push   %ebx
+  80155f:	68 00 10 00 00       	push   $0x1000
+  801564:	68 00 d0 bf ee       	push   $0xeebfd000
+  801569:	6a 00                	push   $0x0
+  80156b:	e8 9a f8 ff ff       	call   800e0a <sys_page_map_range>
+  801570:	83 c4 20             	add    $0x20,%esp
+  801573:	85 c0                	test   %eax,%eax
+  801575:	78 70                	js     8015e7 <sfork+0xf0>
+  if ( (error = sys_page_alloc(envid,
+  801577:	83 ec 04             	sub    $0x4,%esp
+  80157a:	6a 07                	push   $0x7
+  80157c:	68 00 f0 bf ee       	push   $0xeebff000
+  801581:	53                   	push   %ebx
+  801582:	e8 bc f7 ff ff       	call   800d43 <sys_page_alloc>
+  801587:	83 c4 10             	add    $0x10,%esp
+  80158a:	85 c0                	test   %eax,%eax
+  80158c:	78 6e                	js     8015fc <sfork+0x105>
+          thisenv->env_pgfault_upcall)) < 0) {
+  80158e:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  801593:	8b 40 64             	mov    0x64(%eax),%eax
+  if ( (error = sys_env_set_pgfault_upcall(envid,
+  801596:	83 ec 08             	sub    $0x8,%esp
+  801599:	50                   	push   %eax
+  80159a:	53                   	push   %ebx
+  80159b:	e8 18 fa ff ff       	call   800fb8 <sys_env_set_pgfault_upcall>
+  8015a0:	83 c4 10             	add    $0x10,%esp
+  8015a3:	85 c0                	test   %eax,%eax
+  8015a5:	78 6a                	js     801611 <sfork+0x11a>
+  if ( (error = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+  8015a7:	83 ec 08             	sub    $0x8,%esp
+  8015aa:	6a 02                	push   $0x2
+  8015ac:	53                   	push   %ebx
+  8015ad:	e8 82 f9 ff ff       	call   800f34 <sys_env_set_status>
+  8015b2:	83 c4 10             	add    $0x10,%esp
+  8015b5:	85 c0                	test   %eax,%eax
+  8015b7:	0f 89 65 ff ff ff    	jns    801522 <sfork+0x2b>
+    panic("sys_env_set_status: %e", error);
+  8015bd:	50                   	push   %eax
+  8015be:	68 70 3f 80 00       	push   $0x803f70
+  8015c3:	68 e4 00 00 00       	push   $0xe4
+  8015c8:	68 ff 3e 80 00       	push   $0x803eff
+  8015cd:	e8 79 ec ff ff       	call   80024b <_panic>
+    panic("sys_page_map_range: %e", error);
+  8015d2:	50                   	push   %eax
+  8015d3:	68 59 3f 80 00       	push   $0x803f59
+  8015d8:	68 ce 00 00 00       	push   $0xce
+  8015dd:	68 ff 3e 80 00       	push   $0x803eff
+  8015e2:	e8 64 ec ff ff       	call   80024b <_panic>
+    panic("sys_page_map_range: %e", error);
+  8015e7:	50                   	push   %eax
+  8015e8:	68 59 3f 80 00       	push   $0x803f59
+  8015ed:	68 d3 00 00 00       	push   $0xd3
+  8015f2:	68 ff 3e 80 00       	push   $0x803eff
+  8015f7:	e8 4f ec ff ff       	call   80024b <_panic>
+    panic("sys_page_alloc: %e", error);
+  8015fc:	50                   	push   %eax
+  8015fd:	68 38 3b 80 00       	push   $0x803b38
+  801602:	68 da 00 00 00       	push   $0xda
+  801607:	68 ff 3e 80 00       	push   $0x803eff
+  80160c:	e8 3a ec ff ff       	call   80024b <_panic>
+    panic("sys_env_set_pgfault_upcall: %e", error);
+  801611:	50                   	push   %eax
+  801612:	68 88 3f 80 00       	push   $0x803f88
+  801617:	68 e0 00 00 00       	push   $0xe0
+  80161c:	68 ff 3e 80 00       	push   $0x803eff
+  801621:	e8 25 ec ff ff       	call   80024b <_panic>
+
+00801626 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801626:	55                   	push   %ebp
+  801627:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801629:	8b 45 08             	mov    0x8(%ebp),%eax
+  80162c:	05 00 00 00 30       	add    $0x30000000,%eax
+  801631:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801634:	5d                   	pop    %ebp
+  801635:	c3                   	ret
+
+00801636 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801636:	55                   	push   %ebp
+  801637:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801639:	8b 45 08             	mov    0x8(%ebp),%eax
+  80163c:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  80163f:	66 b8 00 00          	mov    $0x0,%ax
+  801643:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801648:	5d                   	pop    %ebp
+  801649:	c3                   	ret
+
+0080164a <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80164a:	55                   	push   %ebp
+  80164b:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  80164d:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801652:	eb 02                	jmp    801656 <fd_alloc+0xc>
+  801654:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801656:	89 c2                	mov    %eax,%edx
+  801658:	c1 ea 16             	shr    $0x16,%edx
+  80165b:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801662:	f6 c2 01             	test   $0x1,%dl
+  801665:	74 2b                	je     801692 <fd_alloc+0x48>
+  801667:	89 c2                	mov    %eax,%edx
+  801669:	c1 ea 0c             	shr    $0xc,%edx
+  80166c:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801673:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801679:	f6 c1 01             	test   $0x1,%cl
+  80167c:	74 14                	je     801692 <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  80167e:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801684:	75 ce                	jne    801654 <fd_alloc+0xa>
+  801686:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  80168b:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801690:	eb 05                	jmp    801697 <fd_alloc+0x4d>
+      return 0;
+  801692:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  801697:	8b 55 08             	mov    0x8(%ebp),%edx
+  80169a:	89 02                	mov    %eax,(%edx)
+}
+  80169c:	89 c8                	mov    %ecx,%eax
+  80169e:	5d                   	pop    %ebp
+  80169f:	c3                   	ret
+
+008016a0 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8016a0:	55                   	push   %ebp
+  8016a1:	89 e5                	mov    %esp,%ebp
+  8016a3:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  8016a6:	83 f8 1f             	cmp    $0x1f,%eax
+  8016a9:	77 30                	ja     8016db <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  8016ab:	c1 e0 0c             	shl    $0xc,%eax
+  8016ae:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8016b3:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8016b9:	f6 c2 01             	test   $0x1,%dl
+  8016bc:	74 24                	je     8016e2 <fd_lookup+0x42>
+  8016be:	89 c2                	mov    %eax,%edx
+  8016c0:	c1 ea 0c             	shr    $0xc,%edx
+  8016c3:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8016ca:	f6 c2 01             	test   $0x1,%dl
+  8016cd:	74 1a                	je     8016e9 <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  8016cf:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8016d2:	89 02                	mov    %eax,(%edx)
+  return 0;
+  8016d4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8016d9:	5d                   	pop    %ebp
+  8016da:	c3                   	ret
+    return -E_INVAL;
+  8016db:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016e0:	eb f7                	jmp    8016d9 <fd_lookup+0x39>
+    return -E_INVAL;
+  8016e2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016e7:	eb f0                	jmp    8016d9 <fd_lookup+0x39>
+  8016e9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016ee:	eb e9                	jmp    8016d9 <fd_lookup+0x39>
+
+008016f0 <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8016f0:	55                   	push   %ebp
+  8016f1:	89 e5                	mov    %esp,%ebp
+  8016f3:	53                   	push   %ebx
+  8016f4:	83 ec 04             	sub    $0x4,%esp
+  8016f7:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  8016fa:	b8 24 40 80 00       	mov    $0x804024,%eax
+  8016ff:	8b 18                	mov    (%eax),%ebx
+  801701:	85 db                	test   %ebx,%ebx
+  801703:	74 0e                	je     801713 <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  801705:	83 c0 04             	add    $0x4,%eax
+  801708:	39 13                	cmp    %edx,(%ebx)
+  80170a:	75 f3                	jne    8016ff <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  80170c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801711:	eb 1f                	jmp    801732 <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801713:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  801718:	8b 40 48             	mov    0x48(%eax),%eax
+  80171b:	83 ec 04             	sub    $0x4,%esp
+  80171e:	52                   	push   %edx
+  80171f:	50                   	push   %eax
+  801720:	68 a8 3f 80 00       	push   $0x803fa8
+  801725:	e8 fc eb ff ff       	call   800326 <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  80172a:	83 c4 10             	add    $0x10,%esp
+  80172d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  801732:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801735:	89 1a                	mov    %ebx,(%edx)
+}
+  801737:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80173a:	c9                   	leave
+  80173b:	c3                   	ret
+
+0080173c <fd_close>:
+{
+  80173c:	55                   	push   %ebp
+  80173d:	89 e5                	mov    %esp,%ebp
+  80173f:	57                   	push   %edi
+  801740:	56                   	push   %esi
+  801741:	53                   	push   %ebx
+  801742:	83 ec 24             	sub    $0x24,%esp
+  801745:	8b 75 08             	mov    0x8(%ebp),%esi
+  801748:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80174b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80174e:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80174f:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801755:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801758:	50                   	push   %eax
+  801759:	e8 42 ff ff ff       	call   8016a0 <fd_lookup>
+  80175e:	89 c3                	mov    %eax,%ebx
+  801760:	83 c4 10             	add    $0x10,%esp
+  801763:	85 c0                	test   %eax,%eax
+  801765:	78 05                	js     80176c <fd_close+0x30>
+      || fd != fd2)
+  801767:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80176a:	74 16                	je     801782 <fd_close+0x46>
+    return must_exist ? r : 0;
+  80176c:	89 f8                	mov    %edi,%eax
+  80176e:	84 c0                	test   %al,%al
+  801770:	b8 00 00 00 00       	mov    $0x0,%eax
+  801775:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801778:	89 d8                	mov    %ebx,%eax
+  80177a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80177d:	5b                   	pop    %ebx
+  80177e:	5e                   	pop    %esi
+  80177f:	5f                   	pop    %edi
+  801780:	5d                   	pop    %ebp
+  801781:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801782:	83 ec 08             	sub    $0x8,%esp
+  801785:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801788:	50                   	push   %eax
+  801789:	ff 36                	push   (%esi)
+  80178b:	e8 60 ff ff ff       	call   8016f0 <dev_lookup>
+  801790:	89 c3                	mov    %eax,%ebx
+  801792:	83 c4 10             	add    $0x10,%esp
+  801795:	85 c0                	test   %eax,%eax
+  801797:	78 1a                	js     8017b3 <fd_close+0x77>
+    if (dev->dev_close)
+  801799:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80179c:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  80179f:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  8017a4:	85 c0                	test   %eax,%eax
+  8017a6:	74 0b                	je     8017b3 <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  8017a8:	83 ec 0c             	sub    $0xc,%esp
+  8017ab:	56                   	push   %esi
+  8017ac:	ff d0                	call   *%eax
+  8017ae:	89 c3                	mov    %eax,%ebx
+  8017b0:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  8017b3:	83 ec 08             	sub    $0x8,%esp
+  8017b6:	56                   	push   %esi
+  8017b7:	6a 00                	push   $0x0
+  8017b9:	e8 0a f6 ff ff       	call   800dc8 <sys_page_unmap>
+  return r;
+  8017be:	83 c4 10             	add    $0x10,%esp
+  8017c1:	eb b5                	jmp    801778 <fd_close+0x3c>
+
+008017c3 <close>:
+
+int
+close(int fdnum)
+{
+  8017c3:	55                   	push   %ebp
+  8017c4:	89 e5                	mov    %esp,%ebp
+  8017c6:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8017c9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017cc:	50                   	push   %eax
+  8017cd:	ff 75 08             	push   0x8(%ebp)
+  8017d0:	e8 cb fe ff ff       	call   8016a0 <fd_lookup>
+  8017d5:	83 c4 10             	add    $0x10,%esp
+  8017d8:	85 c0                	test   %eax,%eax
+  8017da:	79 02                	jns    8017de <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  8017dc:	c9                   	leave
+  8017dd:	c3                   	ret
+    return fd_close(fd, 1);
+  8017de:	83 ec 08             	sub    $0x8,%esp
+  8017e1:	6a 01                	push   $0x1
+  8017e3:	ff 75 f4             	push   -0xc(%ebp)
+  8017e6:	e8 51 ff ff ff       	call   80173c <fd_close>
+  8017eb:	83 c4 10             	add    $0x10,%esp
+  8017ee:	eb ec                	jmp    8017dc <close+0x19>
+
+008017f0 <close_all>:
+
+void
+close_all(void)
+{
+  8017f0:	55                   	push   %ebp
+  8017f1:	89 e5                	mov    %esp,%ebp
+  8017f3:	53                   	push   %ebx
+  8017f4:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  8017f7:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  8017fc:	83 ec 0c             	sub    $0xc,%esp
+  8017ff:	53                   	push   %ebx
+  801800:	e8 be ff ff ff       	call   8017c3 <close>
+  for (i = 0; i < MAXFD; i++)
+  801805:	83 c3 01             	add    $0x1,%ebx
+  801808:	83 c4 10             	add    $0x10,%esp
+  80180b:	83 fb 20             	cmp    $0x20,%ebx
+  80180e:	75 ec                	jne    8017fc <close_all+0xc>
+}
+  801810:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801813:	c9                   	leave
+  801814:	c3                   	ret
+
+00801815 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801815:	55                   	push   %ebp
+  801816:	89 e5                	mov    %esp,%ebp
+  801818:	57                   	push   %edi
+  801819:	56                   	push   %esi
+  80181a:	53                   	push   %ebx
+  80181b:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80181e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801821:	50                   	push   %eax
+  801822:	ff 75 08             	push   0x8(%ebp)
+  801825:	e8 76 fe ff ff       	call   8016a0 <fd_lookup>
+  80182a:	89 c6                	mov    %eax,%esi
+  80182c:	83 c4 10             	add    $0x10,%esp
+  80182f:	85 c0                	test   %eax,%eax
+  801831:	0f 88 0a 01 00 00    	js     801941 <dup+0x12c>
+    return r;
+  close(newfdnum);
+  801837:	83 ec 0c             	sub    $0xc,%esp
+  80183a:	ff 75 0c             	push   0xc(%ebp)
+  80183d:	e8 81 ff ff ff       	call   8017c3 <close>
+
+  newfd = INDEX2FD(newfdnum);
+  801842:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801845:	c1 e0 0c             	shl    $0xc,%eax
+  801848:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  80184e:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  801851:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801854:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  801857:	89 04 24             	mov    %eax,(%esp)
+  80185a:	e8 d7 fd ff ff       	call   801636 <fd2data>
+  80185f:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  801861:	89 3c 24             	mov    %edi,(%esp)
+  801864:	e8 cd fd ff ff       	call   801636 <fd2data>
+  801869:	83 c4 10             	add    $0x10,%esp
+  80186c:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80186f:	89 f3                	mov    %esi,%ebx
+  801871:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  801877:	89 c6                	mov    %eax,%esi
+  801879:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80187c:	89 cf                	mov    %ecx,%edi
+  80187e:	eb 0c                	jmp    80188c <dup+0x77>
+  801880:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801886:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80188c:	39 fb                	cmp    %edi,%ebx
+  80188e:	74 7b                	je     80190b <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  801890:	89 d8                	mov    %ebx,%eax
+  801892:	c1 e8 16             	shr    $0x16,%eax
+  801895:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80189c:	a8 01                	test   $0x1,%al
+  80189e:	74 e0                	je     801880 <dup+0x6b>
+  8018a0:	89 d8                	mov    %ebx,%eax
+  8018a2:	c1 e8 0c             	shr    $0xc,%eax
+  8018a5:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8018ac:	f6 c2 01             	test   $0x1,%dl
+  8018af:	74 cf                	je     801880 <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  8018b1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  8018b8:	83 ec 0c             	sub    $0xc,%esp
+  8018bb:	25 07 0e 00 00       	and    $0xe07,%eax
+  8018c0:	50                   	push   %eax
+  8018c1:	56                   	push   %esi
+  8018c2:	6a 00                	push   $0x0
+  8018c4:	53                   	push   %ebx
+  8018c5:	6a 00                	push   $0x0
+  8018c7:	e8 ba f4 ff ff       	call   800d86 <sys_page_map>
+  8018cc:	83 c4 20             	add    $0x20,%esp
+  8018cf:	85 c0                	test   %eax,%eax
+  8018d1:	79 ad                	jns    801880 <dup+0x6b>
+  8018d3:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8018d6:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  8018d8:	83 ec 08             	sub    $0x8,%esp
+  8018db:	ff 75 d4             	push   -0x2c(%ebp)
+  8018de:	6a 00                	push   $0x0
+  8018e0:	e8 e3 f4 ff ff       	call   800dc8 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8018e5:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  8018e8:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  8018ee:	83 c4 10             	add    $0x10,%esp
+  8018f1:	39 df                	cmp    %ebx,%edi
+  8018f3:	74 4c                	je     801941 <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  8018f5:	83 ec 08             	sub    $0x8,%esp
+  8018f8:	57                   	push   %edi
+  8018f9:	6a 00                	push   $0x0
+  8018fb:	e8 c8 f4 ff ff       	call   800dc8 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801900:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  801906:	83 c4 10             	add    $0x10,%esp
+  801909:	eb e6                	jmp    8018f1 <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80190b:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80190e:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  801911:	89 c8                	mov    %ecx,%eax
+  801913:	c1 e8 0c             	shr    $0xc,%eax
+  801916:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80191d:	83 ec 0c             	sub    $0xc,%esp
+  801920:	25 07 0e 00 00       	and    $0xe07,%eax
+  801925:	50                   	push   %eax
+  801926:	ff 75 d4             	push   -0x2c(%ebp)
+  801929:	6a 00                	push   $0x0
+  80192b:	51                   	push   %ecx
+  80192c:	6a 00                	push   $0x0
+  80192e:	e8 53 f4 ff ff       	call   800d86 <sys_page_map>
+  801933:	89 c6                	mov    %eax,%esi
+  801935:	83 c4 20             	add    $0x20,%esp
+  801938:	85 c0                	test   %eax,%eax
+  80193a:	78 9c                	js     8018d8 <dup+0xc3>
+  return newfdnum;
+  80193c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80193f:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  801941:	89 f0                	mov    %esi,%eax
+  801943:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801946:	5b                   	pop    %ebx
+  801947:	5e                   	pop    %esi
+  801948:	5f                   	pop    %edi
+  801949:	5d                   	pop    %ebp
+  80194a:	c3                   	ret
+
+0080194b <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80194b:	55                   	push   %ebp
+  80194c:	89 e5                	mov    %esp,%ebp
+  80194e:	56                   	push   %esi
+  80194f:	53                   	push   %ebx
+  801950:	83 ec 18             	sub    $0x18,%esp
+  801953:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801956:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801959:	50                   	push   %eax
+  80195a:	56                   	push   %esi
+  80195b:	e8 40 fd ff ff       	call   8016a0 <fd_lookup>
+  801960:	83 c4 10             	add    $0x10,%esp
+  801963:	85 c0                	test   %eax,%eax
+  801965:	78 3c                	js     8019a3 <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801967:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80196a:	83 ec 08             	sub    $0x8,%esp
+  80196d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801970:	50                   	push   %eax
+  801971:	ff 33                	push   (%ebx)
+  801973:	e8 78 fd ff ff       	call   8016f0 <dev_lookup>
+  801978:	83 c4 10             	add    $0x10,%esp
+  80197b:	85 c0                	test   %eax,%eax
+  80197d:	78 24                	js     8019a3 <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80197f:	8b 43 08             	mov    0x8(%ebx),%eax
+  801982:	83 e0 03             	and    $0x3,%eax
+  801985:	83 f8 01             	cmp    $0x1,%eax
+  801988:	74 20                	je     8019aa <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  80198a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80198d:	8b 40 08             	mov    0x8(%eax),%eax
+  801990:	85 c0                	test   %eax,%eax
+  801992:	74 37                	je     8019cb <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  801994:	83 ec 04             	sub    $0x4,%esp
+  801997:	ff 75 10             	push   0x10(%ebp)
+  80199a:	ff 75 0c             	push   0xc(%ebp)
+  80199d:	53                   	push   %ebx
+  80199e:	ff d0                	call   *%eax
+  8019a0:	83 c4 10             	add    $0x10,%esp
+}
+  8019a3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019a6:	5b                   	pop    %ebx
+  8019a7:	5e                   	pop    %esi
+  8019a8:	5d                   	pop    %ebp
+  8019a9:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8019aa:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  8019af:	8b 40 48             	mov    0x48(%eax),%eax
+  8019b2:	83 ec 04             	sub    $0x4,%esp
+  8019b5:	56                   	push   %esi
+  8019b6:	50                   	push   %eax
+  8019b7:	68 e9 3f 80 00       	push   $0x803fe9
+  8019bc:	e8 65 e9 ff ff       	call   800326 <cprintf>
+    return -E_INVAL;
+  8019c1:	83 c4 10             	add    $0x10,%esp
+  8019c4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019c9:	eb d8                	jmp    8019a3 <read+0x58>
+    return -E_NOT_SUPP;
+  8019cb:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8019d0:	eb d1                	jmp    8019a3 <read+0x58>
+
+008019d2 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8019d2:	55                   	push   %ebp
+  8019d3:	89 e5                	mov    %esp,%ebp
+  8019d5:	57                   	push   %edi
+  8019d6:	56                   	push   %esi
+  8019d7:	53                   	push   %ebx
+  8019d8:	83 ec 0c             	sub    $0xc,%esp
+  8019db:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8019de:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  8019e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019e6:	eb 02                	jmp    8019ea <readn+0x18>
+  8019e8:	01 c3                	add    %eax,%ebx
+  8019ea:	39 f3                	cmp    %esi,%ebx
+  8019ec:	73 21                	jae    801a0f <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  8019ee:	83 ec 04             	sub    $0x4,%esp
+  8019f1:	89 f0                	mov    %esi,%eax
+  8019f3:	29 d8                	sub    %ebx,%eax
+  8019f5:	50                   	push   %eax
+  8019f6:	89 d8                	mov    %ebx,%eax
+  8019f8:	03 45 0c             	add    0xc(%ebp),%eax
+  8019fb:	50                   	push   %eax
+  8019fc:	57                   	push   %edi
+  8019fd:	e8 49 ff ff ff       	call   80194b <read>
+    if (m < 0)
+  801a02:	83 c4 10             	add    $0x10,%esp
+  801a05:	85 c0                	test   %eax,%eax
+  801a07:	78 04                	js     801a0d <readn+0x3b>
+      return m;
+    if (m == 0)
+  801a09:	75 dd                	jne    8019e8 <readn+0x16>
+  801a0b:	eb 02                	jmp    801a0f <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  801a0d:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  801a0f:	89 d8                	mov    %ebx,%eax
+  801a11:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a14:	5b                   	pop    %ebx
+  801a15:	5e                   	pop    %esi
+  801a16:	5f                   	pop    %edi
+  801a17:	5d                   	pop    %ebp
+  801a18:	c3                   	ret
+
+00801a19 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801a19:	55                   	push   %ebp
+  801a1a:	89 e5                	mov    %esp,%ebp
+  801a1c:	56                   	push   %esi
+  801a1d:	53                   	push   %ebx
+  801a1e:	83 ec 18             	sub    $0x18,%esp
+  801a21:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a24:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a27:	50                   	push   %eax
+  801a28:	53                   	push   %ebx
+  801a29:	e8 72 fc ff ff       	call   8016a0 <fd_lookup>
+  801a2e:	83 c4 10             	add    $0x10,%esp
+  801a31:	85 c0                	test   %eax,%eax
+  801a33:	78 37                	js     801a6c <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801a35:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801a38:	83 ec 08             	sub    $0x8,%esp
+  801a3b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a3e:	50                   	push   %eax
+  801a3f:	ff 36                	push   (%esi)
+  801a41:	e8 aa fc ff ff       	call   8016f0 <dev_lookup>
+  801a46:	83 c4 10             	add    $0x10,%esp
+  801a49:	85 c0                	test   %eax,%eax
+  801a4b:	78 1f                	js     801a6c <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801a4d:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801a51:	74 20                	je     801a73 <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  801a53:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a56:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a59:	85 c0                	test   %eax,%eax
+  801a5b:	74 37                	je     801a94 <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  801a5d:	83 ec 04             	sub    $0x4,%esp
+  801a60:	ff 75 10             	push   0x10(%ebp)
+  801a63:	ff 75 0c             	push   0xc(%ebp)
+  801a66:	56                   	push   %esi
+  801a67:	ff d0                	call   *%eax
+  801a69:	83 c4 10             	add    $0x10,%esp
+}
+  801a6c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a6f:	5b                   	pop    %ebx
+  801a70:	5e                   	pop    %esi
+  801a71:	5d                   	pop    %ebp
+  801a72:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801a73:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  801a78:	8b 40 48             	mov    0x48(%eax),%eax
+  801a7b:	83 ec 04             	sub    $0x4,%esp
+  801a7e:	53                   	push   %ebx
+  801a7f:	50                   	push   %eax
+  801a80:	68 05 40 80 00       	push   $0x804005
+  801a85:	e8 9c e8 ff ff       	call   800326 <cprintf>
+    return -E_INVAL;
+  801a8a:	83 c4 10             	add    $0x10,%esp
+  801a8d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a92:	eb d8                	jmp    801a6c <write+0x53>
+    return -E_NOT_SUPP;
+  801a94:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a99:	eb d1                	jmp    801a6c <write+0x53>
+
+00801a9b <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801a9b:	55                   	push   %ebp
+  801a9c:	89 e5                	mov    %esp,%ebp
+  801a9e:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801aa1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801aa4:	50                   	push   %eax
+  801aa5:	ff 75 08             	push   0x8(%ebp)
+  801aa8:	e8 f3 fb ff ff       	call   8016a0 <fd_lookup>
+  801aad:	83 c4 10             	add    $0x10,%esp
+  801ab0:	85 c0                	test   %eax,%eax
+  801ab2:	78 0e                	js     801ac2 <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  801ab4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801ab7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801aba:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  801abd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ac2:	c9                   	leave
+  801ac3:	c3                   	ret
+
+00801ac4 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801ac4:	55                   	push   %ebp
+  801ac5:	89 e5                	mov    %esp,%ebp
+  801ac7:	56                   	push   %esi
+  801ac8:	53                   	push   %ebx
+  801ac9:	83 ec 18             	sub    $0x18,%esp
+  801acc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801acf:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ad2:	50                   	push   %eax
+  801ad3:	53                   	push   %ebx
+  801ad4:	e8 c7 fb ff ff       	call   8016a0 <fd_lookup>
+  801ad9:	83 c4 10             	add    $0x10,%esp
+  801adc:	85 c0                	test   %eax,%eax
+  801ade:	78 34                	js     801b14 <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801ae0:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801ae3:	83 ec 08             	sub    $0x8,%esp
+  801ae6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ae9:	50                   	push   %eax
+  801aea:	ff 36                	push   (%esi)
+  801aec:	e8 ff fb ff ff       	call   8016f0 <dev_lookup>
+  801af1:	83 c4 10             	add    $0x10,%esp
+  801af4:	85 c0                	test   %eax,%eax
+  801af6:	78 1c                	js     801b14 <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801af8:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801afc:	74 1d                	je     801b1b <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  801afe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b01:	8b 40 18             	mov    0x18(%eax),%eax
+  801b04:	85 c0                	test   %eax,%eax
+  801b06:	74 34                	je     801b3c <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  801b08:	83 ec 08             	sub    $0x8,%esp
+  801b0b:	ff 75 0c             	push   0xc(%ebp)
+  801b0e:	56                   	push   %esi
+  801b0f:	ff d0                	call   *%eax
+  801b11:	83 c4 10             	add    $0x10,%esp
+}
+  801b14:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b17:	5b                   	pop    %ebx
+  801b18:	5e                   	pop    %esi
+  801b19:	5d                   	pop    %ebp
+  801b1a:	c3                   	ret
+            thisenv->env_id, fdnum);
+  801b1b:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  801b20:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801b23:	83 ec 04             	sub    $0x4,%esp
+  801b26:	53                   	push   %ebx
+  801b27:	50                   	push   %eax
+  801b28:	68 c8 3f 80 00       	push   $0x803fc8
+  801b2d:	e8 f4 e7 ff ff       	call   800326 <cprintf>
+    return -E_INVAL;
+  801b32:	83 c4 10             	add    $0x10,%esp
+  801b35:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b3a:	eb d8                	jmp    801b14 <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  801b3c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b41:	eb d1                	jmp    801b14 <ftruncate+0x50>
+
+00801b43 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801b43:	55                   	push   %ebp
+  801b44:	89 e5                	mov    %esp,%ebp
+  801b46:	56                   	push   %esi
+  801b47:	53                   	push   %ebx
+  801b48:	83 ec 18             	sub    $0x18,%esp
+  801b4b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801b4e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b51:	50                   	push   %eax
+  801b52:	ff 75 08             	push   0x8(%ebp)
+  801b55:	e8 46 fb ff ff       	call   8016a0 <fd_lookup>
+  801b5a:	83 c4 10             	add    $0x10,%esp
+  801b5d:	85 c0                	test   %eax,%eax
+  801b5f:	78 49                	js     801baa <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801b61:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b64:	83 ec 08             	sub    $0x8,%esp
+  801b67:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b6a:	50                   	push   %eax
+  801b6b:	ff 36                	push   (%esi)
+  801b6d:	e8 7e fb ff ff       	call   8016f0 <dev_lookup>
+  801b72:	83 c4 10             	add    $0x10,%esp
+  801b75:	85 c0                	test   %eax,%eax
+  801b77:	78 31                	js     801baa <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  801b79:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b7c:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801b80:	74 2f                	je     801bb1 <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  801b82:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  801b85:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801b8c:	00 00 00 
+  stat->st_isdir = 0;
+  801b8f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801b96:	00 00 00 
+  stat->st_dev = dev;
+  801b99:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  801b9f:	83 ec 08             	sub    $0x8,%esp
+  801ba2:	53                   	push   %ebx
+  801ba3:	56                   	push   %esi
+  801ba4:	ff 50 14             	call   *0x14(%eax)
+  801ba7:	83 c4 10             	add    $0x10,%esp
+}
+  801baa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bad:	5b                   	pop    %ebx
+  801bae:	5e                   	pop    %esi
+  801baf:	5d                   	pop    %ebp
+  801bb0:	c3                   	ret
+    return -E_NOT_SUPP;
+  801bb1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801bb6:	eb f2                	jmp    801baa <fstat+0x67>
+
+00801bb8 <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  801bb8:	55                   	push   %ebp
+  801bb9:	89 e5                	mov    %esp,%ebp
+  801bbb:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  801bbe:	ff 75 0c             	push   0xc(%ebp)
+  801bc1:	ff 75 08             	push   0x8(%ebp)
+  801bc4:	e8 58 07 00 00       	call   802321 <file_stat>
+}
+  801bc9:	c9                   	leave
+  801bca:	c3                   	ret
+
+00801bcb <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  801bcb:	55                   	push   %ebp
+  801bcc:	89 e5                	mov    %esp,%ebp
+  801bce:	57                   	push   %edi
+  801bcf:	56                   	push   %esi
+  801bd0:	53                   	push   %ebx
+  801bd1:	83 ec 1c             	sub    $0x1c,%esp
+  801bd4:	89 c7                	mov    %eax,%edi
+  801bd6:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801bd9:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801bdc:	e9 a2 00 00 00       	jmp    801c83 <fsipc_send+0xb8>
+  nfsenvs = 0;
+  801be1:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  801be8:	00 00 00 
+  801beb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bf0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801bf5:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801bfa:	be 01 00 00 00       	mov    $0x1,%esi
+  801bff:	eb 0f                	jmp    801c10 <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801c01:	83 c0 01             	add    $0x1,%eax
+  801c04:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801c09:	74 49                	je     801c54 <fsipc_send+0x89>
+  801c0b:	83 f9 07             	cmp    $0x7,%ecx
+  801c0e:	7f 50                	jg     801c60 <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  801c10:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801c13:	c1 e2 04             	shl    $0x4,%edx
+  801c16:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801c1c:	8b 52 50             	mov    0x50(%edx),%edx
+  801c1f:	83 fa 01             	cmp    $0x1,%edx
+  801c22:	75 dd                	jne    801c01 <fsipc_send+0x36>
+  801c24:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801c27:	c1 e2 04             	shl    $0x4,%edx
+  801c2a:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801c30:	8b 52 54             	mov    0x54(%edx),%edx
+  801c33:	85 d2                	test   %edx,%edx
+  801c35:	74 ca                	je     801c01 <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801c37:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801c3a:	c1 e2 04             	shl    $0x4,%edx
+  801c3d:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801c43:	8b 52 48             	mov    0x48(%edx),%edx
+  801c46:	89 14 8d 20 60 80 00 	mov    %edx,0x806020(,%ecx,4)
+  801c4d:	8d 49 01             	lea    0x1(%ecx),%ecx
+  801c50:	89 f3                	mov    %esi,%ebx
+  801c52:	eb ad                	jmp    801c01 <fsipc_send+0x36>
+  801c54:	84 db                	test   %bl,%bl
+  801c56:	74 38                	je     801c90 <fsipc_send+0xc5>
+  801c58:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+  801c5e:	eb 30                	jmp    801c90 <fsipc_send+0xc5>
+  801c60:	84 db                	test   %bl,%bl
+  801c62:	74 2c                	je     801c90 <fsipc_send+0xc5>
+  801c64:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+  801c6a:	eb 24                	jmp    801c90 <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  801c6c:	50                   	push   %eax
+  801c6d:	68 34 40 80 00       	push   $0x804034
+  801c72:	6a 34                	push   $0x34
+  801c74:	68 3e 40 80 00       	push   $0x80403e
+  801c79:	e8 cd e5 ff ff       	call   80024b <_panic>
+    }
+    sys_yield();
+  801c7e:	e8 5e f0 ff ff       	call   800ce1 <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  801c83:	83 3d 00 60 80 00 03 	cmpl   $0x3,0x806000
+  801c8a:	0f 8e 51 ff ff ff    	jle    801be1 <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  801c90:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  801c95:	8b 70 48             	mov    0x48(%eax),%esi
+  801c98:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  801c9e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ca3:	8b 0d 00 60 80 00    	mov    0x806000,%ecx
+  801ca9:	39 d9                	cmp    %ebx,%ecx
+  801cab:	7e d1                	jle    801c7e <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  801cad:	83 ec 0c             	sub    $0xc,%esp
+  801cb0:	ff 75 e0             	push   -0x20(%ebp)
+  801cb3:	6a 07                	push   $0x7
+  801cb5:	ff 75 e4             	push   -0x1c(%ebp)
+  801cb8:	57                   	push   %edi
+  801cb9:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  801cbc:	99                   	cltd
+  801cbd:	f7 f9                	idiv   %ecx
+  801cbf:	ff 34 95 20 60 80 00 	push   0x806020(,%edx,4)
+  801cc6:	e8 2f f3 ff ff       	call   800ffa <sys_ipc_try_send>
+      if (r == 0)
+  801ccb:	83 c4 20             	add    $0x20,%esp
+  801cce:	85 c0                	test   %eax,%eax
+  801cd0:	74 0a                	je     801cdc <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  801cd2:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801cd5:	75 95                	jne    801c6c <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  801cd7:	83 c3 01             	add    $0x1,%ebx
+  801cda:	eb c7                	jmp    801ca3 <fsipc_send+0xd8>
+  }
+}
+  801cdc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cdf:	5b                   	pop    %ebx
+  801ce0:	5e                   	pop    %esi
+  801ce1:	5f                   	pop    %edi
+  801ce2:	5d                   	pop    %ebp
+  801ce3:	c3                   	ret
+
+00801ce4 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801ce4:	55                   	push   %ebp
+  801ce5:	89 e5                	mov    %esp,%ebp
+  801ce7:	53                   	push   %ebx
+  801ce8:	83 ec 14             	sub    $0x14,%esp
+  801ceb:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  801ced:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  801cf4:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801cf9:	ba 00 70 80 00       	mov    $0x807000,%edx
+  801cfe:	e8 c8 fe ff ff       	call   801bcb <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801d03:	6a 00                	push   $0x0
+  801d05:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d08:	50                   	push   %eax
+  801d09:	53                   	push   %ebx
+  801d0a:	6a 00                	push   $0x0
+  801d0c:	e8 f8 19 00 00       	call   803709 <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  801d11:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d14:	c9                   	leave
+  801d15:	c3                   	ret
+
+00801d16 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801d16:	55                   	push   %ebp
+  801d17:	89 e5                	mov    %esp,%ebp
+  801d19:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801d1c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d1f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d22:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.set_size.req_size = newsize;
+  801d27:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d2a:	a3 04 70 80 00       	mov    %eax,0x807004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801d2f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d34:	b8 02 00 00 00       	mov    $0x2,%eax
+  801d39:	e8 a6 ff ff ff       	call   801ce4 <fsipc>
+}
+  801d3e:	c9                   	leave
+  801d3f:	c3                   	ret
+
+00801d40 <devfile_flush>:
+{
+  801d40:	55                   	push   %ebp
+  801d41:	89 e5                	mov    %esp,%ebp
+  801d43:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801d46:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d49:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d4c:	a3 00 70 80 00       	mov    %eax,0x807000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801d51:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d56:	b8 06 00 00 00       	mov    $0x6,%eax
+  801d5b:	e8 84 ff ff ff       	call   801ce4 <fsipc>
+}
+  801d60:	c9                   	leave
+  801d61:	c3                   	ret
+
+00801d62 <devfile_stat>:
+{
+  801d62:	55                   	push   %ebp
+  801d63:	89 e5                	mov    %esp,%ebp
+  801d65:	53                   	push   %ebx
+  801d66:	83 ec 04             	sub    $0x4,%esp
+  801d69:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801d6c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d6f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d72:	a3 00 70 80 00       	mov    %eax,0x807000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801d77:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d7c:	b8 05 00 00 00       	mov    $0x5,%eax
+  801d81:	e8 5e ff ff ff       	call   801ce4 <fsipc>
+  801d86:	85 c0                	test   %eax,%eax
+  801d88:	78 2c                	js     801db6 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801d8a:	83 ec 08             	sub    $0x8,%esp
+  801d8d:	68 00 70 80 00       	push   $0x807000
+  801d92:	53                   	push   %ebx
+  801d93:	e8 7c eb ff ff       	call   800914 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  801d98:	a1 80 70 80 00       	mov    0x807080,%eax
+  801d9d:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801da3:	a1 84 70 80 00       	mov    0x807084,%eax
+  801da8:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801dae:	83 c4 10             	add    $0x10,%esp
+  801db1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801db6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801db9:	c9                   	leave
+  801dba:	c3                   	ret
+
+00801dbb <fsv_alloc>:
+{
+  801dbb:	55                   	push   %ebp
+  801dbc:	89 e5                	mov    %esp,%ebp
+  801dbe:	56                   	push   %esi
+  801dbf:	53                   	push   %ebx
+  801dc0:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  801dc2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801dc7:	eb 22                	jmp    801deb <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  801dc9:	83 ec 04             	sub    $0x4,%esp
+  801dcc:	6a 00                	push   $0x0
+  801dce:	6a 00                	push   $0x0
+  801dd0:	6a 07                	push   $0x7
+  801dd2:	50                   	push   %eax
+  801dd3:	6a 00                	push   $0x0
+  801dd5:	6a 04                	push   $0x4
+  801dd7:	68 40 60 80 00       	push   $0x806040
+  801ddc:	e8 b5 f3 ff ff       	call   801196 <sysbatch_add>
+  801de1:	83 c4 20             	add    $0x20,%esp
+  801de4:	85 c0                	test   %eax,%eax
+  801de6:	78 48                	js     801e30 <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  801de8:	83 c3 01             	add    $0x1,%ebx
+  801deb:	39 f3                	cmp    %esi,%ebx
+  801ded:	74 31                	je     801e20 <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  801def:	89 d8                	mov    %ebx,%eax
+  801df1:	c1 e0 0c             	shl    $0xc,%eax
+  801df4:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801df9:	89 c2                	mov    %eax,%edx
+  801dfb:	c1 ea 16             	shr    $0x16,%edx
+  801dfe:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801e05:	f6 c2 01             	test   $0x1,%dl
+  801e08:	74 bf                	je     801dc9 <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  801e0a:	89 c2                	mov    %eax,%edx
+  801e0c:	c1 ea 0c             	shr    $0xc,%edx
+  801e0f:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801e16:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801e19:	83 fa 03             	cmp    $0x3,%edx
+  801e1c:	75 ab                	jne    801dc9 <fsv_alloc+0xe>
+  801e1e:	eb c8                	jmp    801de8 <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  801e20:	83 ec 0c             	sub    $0xc,%esp
+  801e23:	68 40 60 80 00       	push   $0x806040
+  801e28:	e8 19 f3 ff ff       	call   801146 <sysbatch_flush>
+  801e2d:	83 c4 10             	add    $0x10,%esp
+}
+  801e30:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e33:	5b                   	pop    %ebx
+  801e34:	5e                   	pop    %esi
+  801e35:	5d                   	pop    %ebp
+  801e36:	c3                   	ret
+
+00801e37 <devfile_read>:
+{
+  801e37:	55                   	push   %ebp
+  801e38:	89 e5                	mov    %esp,%ebp
+  801e3a:	57                   	push   %edi
+  801e3b:	56                   	push   %esi
+  801e3c:	53                   	push   %ebx
+  801e3d:	83 ec 3c             	sub    $0x3c,%esp
+  801e40:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  801e43:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  801e49:	77 57                	ja     801ea2 <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801e4b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e4e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e51:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.read.req_n = n;
+  801e56:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801e5c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e61:	b8 03 00 00 00       	mov    $0x3,%eax
+  801e66:	e8 79 fe ff ff       	call   801ce4 <fsipc>
+  801e6b:	89 c6                	mov    %eax,%esi
+  801e6d:	85 c0                	test   %eax,%eax
+  801e6f:	78 27                	js     801e98 <devfile_read+0x61>
+  assert(r <= n);
+  801e71:	39 c3                	cmp    %eax,%ebx
+  801e73:	0f 82 0e 02 00 00    	jb     802087 <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  801e79:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801e7e:	0f 8f 1c 02 00 00    	jg     8020a0 <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801e84:	83 ec 04             	sub    $0x4,%esp
+  801e87:	50                   	push   %eax
+  801e88:	68 00 70 80 00       	push   $0x807000
+  801e8d:	ff 75 0c             	push   0xc(%ebp)
+  801e90:	e8 05 ec ff ff       	call   800a9a <memmove>
+  return r;
+  801e95:	83 c4 10             	add    $0x10,%esp
+}
+  801e98:	89 f0                	mov    %esi,%eax
+  801e9a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e9d:	5b                   	pop    %ebx
+  801e9e:	5e                   	pop    %esi
+  801e9f:	5f                   	pop    %edi
+  801ea0:	5d                   	pop    %ebp
+  801ea1:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  801ea2:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ea7:	e8 0f ff ff ff       	call   801dbb <fsv_alloc>
+  801eac:	89 c6                	mov    %eax,%esi
+  801eae:	85 c0                	test   %eax,%eax
+  801eb0:	78 e6                	js     801e98 <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  801eb2:	8b 45 08             	mov    0x8(%ebp),%eax
+  801eb5:	8b 40 0c             	mov    0xc(%eax),%eax
+  801eb8:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  801ebd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ec0:	8b 40 04             	mov    0x4(%eax),%eax
+  801ec3:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  801ec8:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  801ece:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801ed5:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801eda:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801edf:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801ee4:	e8 e2 fc ff ff       	call   801bcb <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801ee9:	6a 00                	push   $0x0
+  801eeb:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801eee:	50                   	push   %eax
+  801eef:	68 00 10 c0 9f       	push   $0x9fc01000
+  801ef4:	6a 00                	push   $0x0
+  801ef6:	e8 0e 18 00 00       	call   803709 <ipc_recv_pages>
+  801efb:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  801efd:	83 c4 10             	add    $0x10,%esp
+  801f00:	85 c0                	test   %eax,%eax
+  801f02:	7e 94                	jle    801e98 <devfile_read+0x61>
+  assert(r <= n);
+  801f04:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801f07:	39 c3                	cmp    %eax,%ebx
+  801f09:	72 2e                	jb     801f39 <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801f0b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f0e:	8b 40 04             	mov    0x4(%eax),%eax
+  801f11:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801f16:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  801f19:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801f1c:	c1 e2 0c             	shl    $0xc,%edx
+  801f1f:	39 ca                	cmp    %ecx,%edx
+  801f21:	72 2f                	jb     801f52 <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  801f23:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  801f28:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  801f2b:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  801f2f:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801f34:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  801f37:	eb 52                	jmp    801f8b <devfile_read+0x154>
+  assert(r <= n);
+  801f39:	68 49 40 80 00       	push   $0x804049
+  801f3e:	68 50 40 80 00       	push   $0x804050
+  801f43:	68 49 01 00 00       	push   $0x149
+  801f48:	68 3e 40 80 00       	push   $0x80403e
+  801f4d:	e8 f9 e2 ff ff       	call   80024b <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801f52:	68 74 40 80 00       	push   $0x804074
+  801f57:	68 50 40 80 00       	push   $0x804050
+  801f5c:	68 4a 01 00 00       	push   $0x14a
+  801f61:	68 3e 40 80 00       	push   $0x80403e
+  801f66:	e8 e0 e2 ff ff       	call   80024b <_panic>
+      memmove(dst + done, src + done, m);
+  801f6b:	83 ec 04             	sub    $0x4,%esp
+  801f6e:	53                   	push   %ebx
+  801f6f:	56                   	push   %esi
+  801f70:	89 f8                	mov    %edi,%eax
+  801f72:	03 45 0c             	add    0xc(%ebp),%eax
+  801f75:	50                   	push   %eax
+  801f76:	e8 1f eb ff ff       	call   800a9a <memmove>
+  801f7b:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  801f7e:	01 df                	add    %ebx,%edi
+  801f80:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801f83:	39 c7                	cmp    %eax,%edi
+  801f85:	0f 83 c0 00 00 00    	jae    80204b <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801f8b:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801f8e:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  801f91:	89 f0                	mov    %esi,%eax
+  801f93:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801f98:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  801f9d:	29 c3                	sub    %eax,%ebx
+  801f9f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801fa2:	29 f8                	sub    %edi,%eax
+  801fa4:	39 c3                	cmp    %eax,%ebx
+  801fa6:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  801fa9:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801faf:	75 ba                	jne    801f6b <devfile_read+0x134>
+  801fb1:	89 f9                	mov    %edi,%ecx
+  801fb3:	03 4d 0c             	add    0xc(%ebp),%ecx
+  801fb6:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  801fb9:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  801fbf:	75 aa                	jne    801f6b <devfile_read+0x134>
+  801fc1:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  801fc7:	77 a2                	ja     801f6b <devfile_read+0x134>
+  801fc9:	89 c8                	mov    %ecx,%eax
+  801fcb:	c1 e8 16             	shr    $0x16,%eax
+  801fce:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801fd5:	a8 01                	test   $0x1,%al
+  801fd7:	74 92                	je     801f6b <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  801fd9:	89 c8                	mov    %ecx,%eax
+  801fdb:	c1 e8 0c             	shr    $0xc,%eax
+  801fde:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  801fe5:	a8 01                	test   $0x1,%al
+  801fe7:	74 82                	je     801f6b <devfile_read+0x134>
+  801fe9:	a9 02 08 00 00       	test   $0x802,%eax
+  801fee:	0f 84 77 ff ff ff    	je     801f6b <devfile_read+0x134>
+  801ff4:	f6 c4 04             	test   $0x4,%ah
+  801ff7:	0f 85 6e ff ff ff    	jne    801f6b <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  801ffd:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  802002:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  802006:	84 c0                	test   %al,%al
+  802008:	75 17                	jne    802021 <devfile_read+0x1ea>
+  80200a:	83 ec 08             	sub    $0x8,%esp
+  80200d:	6a 01                	push   $0x1
+  80200f:	6a 00                	push   $0x0
+  802011:	e8 ea ec ff ff       	call   800d00 <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  802016:	83 c4 10             	add    $0x10,%esp
+  802019:	85 c0                	test   %eax,%eax
+  80201b:	0f 85 4a ff ff ff    	jne    801f6b <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  802021:	83 ec 04             	sub    $0x4,%esp
+  802024:	68 05 08 00 00       	push   $0x805
+  802029:	ff 75 cc             	push   -0x34(%ebp)
+  80202c:	6a 00                	push   $0x0
+  80202e:	56                   	push   %esi
+  80202f:	6a 00                	push   $0x0
+  802031:	6a 05                	push   $0x5
+  802033:	68 40 60 80 00       	push   $0x806040
+  802038:	e8 59 f1 ff ff       	call   801196 <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  80203d:	c1 e8 1f             	shr    $0x1f,%eax
+  802040:	08 45 cb             	or     %al,-0x35(%ebp)
+  802043:	83 c4 20             	add    $0x20,%esp
+  802046:	e9 33 ff ff ff       	jmp    801f7e <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  80204b:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  80204e:	83 ec 0c             	sub    $0xc,%esp
+  802051:	68 40 60 80 00       	push   $0x806040
+  802056:	e8 eb f0 ff ff       	call   801146 <sysbatch_flush>
+  80205b:	83 c4 10             	add    $0x10,%esp
+  80205e:	85 c0                	test   %eax,%eax
+  802060:	78 06                	js     802068 <devfile_read+0x231>
+  802062:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  802066:	74 14                	je     80207c <devfile_read+0x245>
+    memmove(dst, src, r);
+  802068:	83 ec 04             	sub    $0x4,%esp
+  80206b:	ff 75 d4             	push   -0x2c(%ebp)
+  80206e:	ff 75 d0             	push   -0x30(%ebp)
+  802071:	ff 75 0c             	push   0xc(%ebp)
+  802074:	e8 21 ea ff ff       	call   800a9a <memmove>
+  802079:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  80207c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80207f:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  802082:	e9 11 fe ff ff       	jmp    801e98 <devfile_read+0x61>
+  assert(r <= n);
+  802087:	68 49 40 80 00       	push   $0x804049
+  80208c:	68 50 40 80 00       	push   $0x804050
+  802091:	68 1c 01 00 00       	push   $0x11c
+  802096:	68 3e 40 80 00       	push   $0x80403e
+  80209b:	e8 ab e1 ff ff       	call   80024b <_panic>
+  assert(r <= PGSIZE);
+  8020a0:	68 65 40 80 00       	push   $0x804065
+  8020a5:	68 50 40 80 00       	push   $0x804050
+  8020aa:	68 1d 01 00 00       	push   $0x11d
+  8020af:	68 3e 40 80 00       	push   $0x80403e
+  8020b4:	e8 92 e1 ff ff       	call   80024b <_panic>
+
+008020b9 <devfile_write>:
+{
+  8020b9:	55                   	push   %ebp
+  8020ba:	89 e5                	mov    %esp,%ebp
+  8020bc:	57                   	push   %edi
+  8020bd:	56                   	push   %esi
+  8020be:	53                   	push   %ebx
+  8020bf:	83 ec 1c             	sub    $0x1c,%esp
+  8020c2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8020c5:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  8020c8:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  8020cd:	77 39                	ja     802108 <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8020cf:	8b 56 0c             	mov    0xc(%esi),%edx
+  8020d2:	89 15 00 70 80 00    	mov    %edx,0x807000
+  fsipcbuf.write.req_n = n;
+  8020d8:	a3 04 70 80 00       	mov    %eax,0x807004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  8020dd:	83 ec 04             	sub    $0x4,%esp
+  8020e0:	50                   	push   %eax
+  8020e1:	ff 75 0c             	push   0xc(%ebp)
+  8020e4:	68 08 70 80 00       	push   $0x807008
+  8020e9:	e8 ac e9 ff ff       	call   800a9a <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  8020ee:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020f3:	b8 04 00 00 00       	mov    $0x4,%eax
+  8020f8:	e8 e7 fb ff ff       	call   801ce4 <fsipc>
+  8020fd:	83 c4 10             	add    $0x10,%esp
+}
+  802100:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802103:	5b                   	pop    %ebx
+  802104:	5e                   	pop    %esi
+  802105:	5f                   	pop    %edi
+  802106:	5d                   	pop    %ebp
+  802107:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  802108:	ba 00 00 10 00       	mov    $0x100000,%edx
+  80210d:	39 d0                	cmp    %edx,%eax
+  80210f:	89 d3                	mov    %edx,%ebx
+  802111:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  802114:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  80211a:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  80211d:	83 c7 01             	add    $0x1,%edi
+  802120:	89 f8                	mov    %edi,%eax
+  802122:	e8 94 fc ff ff       	call   801dbb <fsv_alloc>
+  802127:	85 c0                	test   %eax,%eax
+  802129:	78 d5                	js     802100 <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  80212b:	83 ec 04             	sub    $0x4,%esp
+  80212e:	53                   	push   %ebx
+  80212f:	ff 75 0c             	push   0xc(%ebp)
+  802132:	68 00 10 c0 9f       	push   $0x9fc01000
+  802137:	e8 5e e9 ff ff       	call   800a9a <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  80213c:	8b 46 0c             	mov    0xc(%esi),%eax
+  80213f:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  802144:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  80214a:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  802151:	89 f9                	mov    %edi,%ecx
+  802153:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  802158:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80215d:	e8 69 fa ff ff       	call   801bcb <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  802162:	6a 00                	push   $0x0
+  802164:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802167:	50                   	push   %eax
+  802168:	6a 00                	push   $0x0
+  80216a:	6a 00                	push   $0x0
+  80216c:	e8 98 15 00 00       	call   803709 <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  802171:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  802174:	eb 8a                	jmp    802100 <devfile_write+0x47>
+
+00802176 <open>:
+{
+  802176:	55                   	push   %ebp
+  802177:	89 e5                	mov    %esp,%ebp
+  802179:	56                   	push   %esi
+  80217a:	53                   	push   %ebx
+  80217b:	83 ec 1c             	sub    $0x1c,%esp
+  80217e:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  802181:	56                   	push   %esi
+  802182:	e8 52 e7 ff ff       	call   8008d9 <strlen>
+  802187:	83 c4 10             	add    $0x10,%esp
+  80218a:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80218f:	7f 6c                	jg     8021fd <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  802191:	83 ec 0c             	sub    $0xc,%esp
+  802194:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802197:	50                   	push   %eax
+  802198:	e8 ad f4 ff ff       	call   80164a <fd_alloc>
+  80219d:	89 c3                	mov    %eax,%ebx
+  80219f:	83 c4 10             	add    $0x10,%esp
+  8021a2:	85 c0                	test   %eax,%eax
+  8021a4:	78 3c                	js     8021e2 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  8021a6:	83 ec 08             	sub    $0x8,%esp
+  8021a9:	56                   	push   %esi
+  8021aa:	68 00 70 80 00       	push   $0x807000
+  8021af:	e8 60 e7 ff ff       	call   800914 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  8021b4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021b7:	a3 00 74 80 00       	mov    %eax,0x807400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8021bc:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8021bf:	b8 01 00 00 00       	mov    $0x1,%eax
+  8021c4:	e8 1b fb ff ff       	call   801ce4 <fsipc>
+  8021c9:	89 c3                	mov    %eax,%ebx
+  8021cb:	83 c4 10             	add    $0x10,%esp
+  8021ce:	85 c0                	test   %eax,%eax
+  8021d0:	78 19                	js     8021eb <open+0x75>
+  return fd2num(fd);
+  8021d2:	83 ec 0c             	sub    $0xc,%esp
+  8021d5:	ff 75 f4             	push   -0xc(%ebp)
+  8021d8:	e8 49 f4 ff ff       	call   801626 <fd2num>
+  8021dd:	89 c3                	mov    %eax,%ebx
+  8021df:	83 c4 10             	add    $0x10,%esp
+}
+  8021e2:	89 d8                	mov    %ebx,%eax
+  8021e4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021e7:	5b                   	pop    %ebx
+  8021e8:	5e                   	pop    %esi
+  8021e9:	5d                   	pop    %ebp
+  8021ea:	c3                   	ret
+    fd_close(fd, 0);
+  8021eb:	83 ec 08             	sub    $0x8,%esp
+  8021ee:	6a 00                	push   $0x0
+  8021f0:	ff 75 f4             	push   -0xc(%ebp)
+  8021f3:	e8 44 f5 ff ff       	call   80173c <fd_close>
+    return r;
+  8021f8:	83 c4 10             	add    $0x10,%esp
+  8021fb:	eb e5                	jmp    8021e2 <open+0x6c>
+    return -E_BAD_PATH;
+  8021fd:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802202:	eb de                	jmp    8021e2 <open+0x6c>
+
+00802204 <open_read>:
+{
+  802204:	55                   	push   %ebp
+  802205:	89 e5                	mov    %esp,%ebp
+  802207:	57                   	push   %edi
+  802208:	56                   	push   %esi
+  802209:	53                   	push   %ebx
+  80220a:	83 ec 28             	sub    $0x28,%esp
+  80220d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  802210:	57                   	push   %edi
+  802211:	e8 c3 e6 ff ff       	call   8008d9 <strlen>
+  802216:	83 c4 10             	add    $0x10,%esp
+  802219:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80221e:	0f 87 f6 00 00 00    	ja     80231a <open_read+0x116>
+  802224:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  802226:	83 ec 0c             	sub    $0xc,%esp
+  802229:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80222c:	50                   	push   %eax
+  80222d:	e8 18 f4 ff ff       	call   80164a <fd_alloc>
+  802232:	89 c3                	mov    %eax,%ebx
+  802234:	83 c4 10             	add    $0x10,%esp
+  802237:	85 c0                	test   %eax,%eax
+  802239:	0f 88 b2 00 00 00    	js     8022f1 <open_read+0xed>
+  strcpy(req->req_buf, path);
+  80223f:	83 ec 08             	sub    $0x8,%esp
+  802242:	57                   	push   %edi
+  802243:	68 e4 70 80 00       	push   $0x8070e4
+  802248:	e8 c7 e6 ff ff       	call   800914 <strcpy>
+  req->req_nops = 2;
+  80224d:	c7 05 00 70 80 00 02 	movl   $0x2,0x807000
+  802254:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  802257:	c7 05 04 70 80 00 01 	movl   $0x1,0x807004
+  80225e:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  802261:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802264:	a3 10 70 80 00       	mov    %eax,0x807010
+  req->req_ops[0].op_buf = 0;
+  802269:	c7 05 18 70 80 00 00 	movl   $0x0,0x807018
+  802270:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  802273:	c7 05 20 70 80 00 04 	movl   $0x4,0x807020
+  80227a:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  80227d:	c7 05 24 70 80 00 01 	movl   $0x1,0x807024
+  802284:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  802287:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  80228c:	29 f0                	sub    %esi,%eax
+  80228e:	3b 45 14             	cmp    0x14(%ebp),%eax
+  802291:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  802295:	a3 2c 70 80 00       	mov    %eax,0x80702c
+  req->req_ops[1].op_offset = 0;
+  80229a:	c7 05 30 70 80 00 00 	movl   $0x0,0x807030
+  8022a1:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  8022a4:	83 c6 01             	add    $0x1,%esi
+  8022a7:	89 35 34 70 80 00    	mov    %esi,0x807034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  8022ad:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8022b0:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8022b5:	e8 2a fa ff ff       	call   801ce4 <fsipc>
+  8022ba:	89 c3                	mov    %eax,%ebx
+  8022bc:	83 c4 10             	add    $0x10,%esp
+  8022bf:	83 f8 01             	cmp    $0x1,%eax
+  8022c2:	7e 37                	jle    8022fb <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  8022c4:	a1 38 70 80 00       	mov    0x807038,%eax
+  8022c9:	8b 55 18             	mov    0x18(%ebp),%edx
+  8022cc:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  8022ce:	83 ec 04             	sub    $0x4,%esp
+  8022d1:	50                   	push   %eax
+  8022d2:	81 c6 e4 70 80 00    	add    $0x8070e4,%esi
+  8022d8:	56                   	push   %esi
+  8022d9:	ff 75 10             	push   0x10(%ebp)
+  8022dc:	e8 b9 e7 ff ff       	call   800a9a <memmove>
+  return fd2num(fd);
+  8022e1:	83 c4 04             	add    $0x4,%esp
+  8022e4:	ff 75 e4             	push   -0x1c(%ebp)
+  8022e7:	e8 3a f3 ff ff       	call   801626 <fd2num>
+  8022ec:	89 c3                	mov    %eax,%ebx
+  8022ee:	83 c4 10             	add    $0x10,%esp
+}
+  8022f1:	89 d8                	mov    %ebx,%eax
+  8022f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022f6:	5b                   	pop    %ebx
+  8022f7:	5e                   	pop    %esi
+  8022f8:	5f                   	pop    %edi
+  8022f9:	5d                   	pop    %ebp
+  8022fa:	c3                   	ret
+    fd_close(fd, 0);
+  8022fb:	83 ec 08             	sub    $0x8,%esp
+  8022fe:	6a 00                	push   $0x0
+  802300:	ff 75 e4             	push   -0x1c(%ebp)
+  802303:	e8 34 f4 ff ff       	call   80173c <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  802308:	83 c4 10             	add    $0x10,%esp
+  80230b:	85 db                	test   %ebx,%ebx
+  80230d:	78 e2                	js     8022f1 <open_read+0xed>
+  80230f:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  802312:	8b 9b 1c 70 80 00    	mov    0x80701c(%ebx),%ebx
+  802318:	eb d7                	jmp    8022f1 <open_read+0xed>
+    return -E_BAD_PATH;
+  80231a:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80231f:	eb d0                	jmp    8022f1 <open_read+0xed>
+
+00802321 <file_stat>:
+{
+  802321:	55                   	push   %ebp
+  802322:	89 e5                	mov    %esp,%ebp
+  802324:	57                   	push   %edi
+  802325:	56                   	push   %esi
+  802326:	53                   	push   %ebx
+  802327:	83 ec 18             	sub    $0x18,%esp
+  80232a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80232d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  802330:	57                   	push   %edi
+  802331:	e8 a3 e5 ff ff       	call   8008d9 <strlen>
+  802336:	83 c4 10             	add    $0x10,%esp
+  802339:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80233e:	0f 8f c7 00 00 00    	jg     80240b <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  802344:	83 ec 0c             	sub    $0xc,%esp
+  802347:	57                   	push   %edi
+  802348:	e8 8c e5 ff ff       	call   8008d9 <strlen>
+  80234d:	8d 58 04             	lea    0x4(%eax),%ebx
+  802350:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  802353:	83 c4 08             	add    $0x8,%esp
+  802356:	57                   	push   %edi
+  802357:	68 e4 70 80 00       	push   $0x8070e4
+  80235c:	e8 b3 e5 ff ff       	call   800914 <strcpy>
+  req->req_nops = 2;
+  802361:	c7 05 00 70 80 00 02 	movl   $0x2,0x807000
+  802368:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  80236b:	c7 05 04 70 80 00 02 	movl   $0x2,0x807004
+  802372:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  802375:	c7 05 10 70 80 00 00 	movl   $0x0,0x807010
+  80237c:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  80237f:	c7 05 18 70 80 00 00 	movl   $0x0,0x807018
+  802386:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  802389:	c7 05 20 70 80 00 03 	movl   $0x3,0x807020
+  802390:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  802393:	c7 05 24 70 80 00 01 	movl   $0x1,0x807024
+  80239a:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  80239d:	89 1d 34 70 80 00    	mov    %ebx,0x807034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  8023a3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023a8:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8023ad:	e8 32 f9 ff ff       	call   801ce4 <fsipc>
+  8023b2:	83 c4 10             	add    $0x10,%esp
+  8023b5:	83 f8 01             	cmp    $0x1,%eax
+  8023b8:	7e 42                	jle    8023fc <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  8023ba:	81 c3 e4 70 80 00    	add    $0x8070e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  8023c0:	83 ec 08             	sub    $0x8,%esp
+  8023c3:	53                   	push   %ebx
+  8023c4:	56                   	push   %esi
+  8023c5:	e8 4a e5 ff ff       	call   800914 <strcpy>
+  st->st_size = ret->ret_size;
+  8023ca:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  8023d0:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  8023d6:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  8023dc:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  8023e2:	c7 86 88 00 00 00 04 	movl   $0x805004,0x88(%esi)
+  8023e9:	50 80 00 
+  return 0;
+  8023ec:	83 c4 10             	add    $0x10,%esp
+  8023ef:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023f7:	5b                   	pop    %ebx
+  8023f8:	5e                   	pop    %esi
+  8023f9:	5f                   	pop    %edi
+  8023fa:	5d                   	pop    %ebp
+  8023fb:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  8023fc:	85 c0                	test   %eax,%eax
+  8023fe:	78 f4                	js     8023f4 <file_stat+0xd3>
+  802400:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802403:	8b 80 1c 70 80 00    	mov    0x80701c(%eax),%eax
+  802409:	eb e9                	jmp    8023f4 <file_stat+0xd3>
+    return -E_BAD_PATH;
+  80240b:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802410:	eb e2                	jmp    8023f4 <file_stat+0xd3>
+
+00802412 <read_map>:
+{
+  802412:	55                   	push   %ebp
+  802413:	89 e5                	mov    %esp,%ebp
+  802415:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802418:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80241b:	50                   	push   %eax
+  80241c:	ff 75 08             	push   0x8(%ebp)
+  80241f:	e8 7c f2 ff ff       	call   8016a0 <fd_lookup>
+  802424:	83 c4 10             	add    $0x10,%esp
+  802427:	85 c0                	test   %eax,%eax
+  802429:	78 2a                	js     802455 <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  80242b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80242e:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  802434:	39 08                	cmp    %ecx,(%eax)
+  802436:	75 1f                	jne    802457 <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  802438:	8b 40 0c             	mov    0xc(%eax),%eax
+  80243b:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.read_map.req_offset = offset;
+  802440:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802443:	a3 04 70 80 00       	mov    %eax,0x807004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  802448:	8b 55 10             	mov    0x10(%ebp),%edx
+  80244b:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802450:	e8 8f f8 ff ff       	call   801ce4 <fsipc>
+}
+  802455:	c9                   	leave
+  802456:	c3                   	ret
+    return -E_INVAL;
+  802457:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80245c:	eb f7                	jmp    802455 <read_map+0x43>
+
+0080245e <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80245e:	55                   	push   %ebp
+  80245f:	89 e5                	mov    %esp,%ebp
+  802461:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  802464:	ba 00 00 00 00       	mov    $0x0,%edx
+  802469:	b8 08 00 00 00       	mov    $0x8,%eax
+  80246e:	e8 71 f8 ff ff       	call   801ce4 <fsipc>
+}
+  802473:	c9                   	leave
+  802474:	c3                   	ret
+
+00802475 <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  802475:	55                   	push   %ebp
+  802476:	89 e5                	mov    %esp,%ebp
+  802478:	57                   	push   %edi
+  802479:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  80247a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80247d:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.stats.req_bio_sched = 0;
+  802482:	c7 05 04 70 80 00 00 	movl   $0x0,0x807004
+  802489:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  80248c:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  802493:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  802496:	ba 00 00 00 00       	mov    $0x0,%edx
+  80249b:	b8 09 00 00 00       	mov    $0x9,%eax
+  8024a0:	e8 3f f8 ff ff       	call   801ce4 <fsipc>
+  8024a5:	85 c0                	test   %eax,%eax
+  8024a7:	78 14                	js     8024bd <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  8024a9:	be 00 70 80 00       	mov    $0x807000,%esi
+  8024ae:	b9 16 00 00 00       	mov    $0x16,%ecx
+  8024b3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8024b6:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  8024b8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024bd:	5e                   	pop    %esi
+  8024be:	5f                   	pop    %edi
+  8024bf:	5d                   	pop    %ebp
+  8024c0:	c3                   	ret
+
+008024c1 <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  8024c1:	55                   	push   %ebp
+  8024c2:	89 e5                	mov    %esp,%ebp
+  8024c4:	53                   	push   %ebx
+  8024c5:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  8024c8:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8024cb:	50                   	push   %eax
+  8024cc:	6a 00                	push   $0x0
+  8024ce:	e8 a2 ff ff ff       	call   802475 <fs_stats>
+  8024d3:	83 c4 10             	add    $0x10,%esp
+  8024d6:	85 c0                	test   %eax,%eax
+  8024d8:	78 28                	js     802502 <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  8024da:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  8024dd:	83 ec 08             	sub    $0x8,%esp
+  8024e0:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8024e3:	50                   	push   %eax
+  8024e4:	6a 20                	push   $0x20
+  8024e6:	e8 8a ff ff ff       	call   802475 <fs_stats>
+  8024eb:	83 c4 10             	add    $0x10,%esp
+  8024ee:	85 c0                	test   %eax,%eax
+  8024f0:	78 10                	js     802502 <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  8024f2:	83 ec 08             	sub    $0x8,%esp
+  8024f5:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8024f8:	50                   	push   %eax
+  8024f9:	53                   	push   %ebx
+  8024fa:	e8 76 ff ff ff       	call   802475 <fs_stats>
+  8024ff:	83 c4 10             	add    $0x10,%esp
+}
+  802502:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802505:	c9                   	leave
+  802506:	c3                   	ret
+
+00802507 <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  802507:	55                   	push   %ebp
+  802508:	89 e5                	mov    %esp,%ebp
+  80250a:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  80250d:	c7 05 00 70 80 00 00 	movl   $0x0,0x807000
+  802514:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  802517:	8b 45 08             	mov    0x8(%ebp),%eax
+  80251a:	a3 04 70 80 00       	mov    %eax,0x807004
+  fsipcbuf.stats.req_dcache = 0;
+  80251f:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  802526:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  802529:	ba 00 00 00 00       	mov    $0x0,%edx
+  80252e:	b8 09 00 00 00       	mov    $0x9,%eax
+  802533:	e8 ac f7 ff ff       	call   801ce4 <fsipc>
+}
+  802538:	c9                   	leave
+  802539:	c3                   	ret
+
+0080253a <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  80253a:	55                   	push   %ebp
+  80253b:	89 e5                	mov    %esp,%ebp
+  80253d:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  802540:	c7 05 00 70 80 00 00 	movl   $0x0,0x807000
+  802547:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  80254a:	c7 05 04 70 80 00 00 	movl   $0x0,0x807004
+  802551:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  802554:	8b 45 08             	mov    0x8(%ebp),%eax
+  802557:	a3 08 70 80 00       	mov    %eax,0x807008
+  return fsipc(FSREQ_STATS, NULL);
+  80255c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802561:	b8 09 00 00 00       	mov    $0x9,%eax
+  802566:	e8 79 f7 ff ff       	call   801ce4 <fsipc>
+}
+  80256b:	c9                   	leave
+  80256c:	c3                   	ret
+
+0080256d <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  80256d:	55                   	push   %ebp
+  80256e:	89 e5                	mov    %esp,%ebp
+  802570:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802573:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802576:	50                   	push   %eax
+  802577:	ff 75 08             	push   0x8(%ebp)
+  80257a:	e8 21 f1 ff ff       	call   8016a0 <fd_lookup>
+  80257f:	83 c4 10             	add    $0x10,%esp
+  802582:	85 c0                	test   %eax,%eax
+  802584:	78 34                	js     8025ba <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  802586:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802589:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  80258f:	39 08                	cmp    %ecx,(%eax)
+  802591:	75 29                	jne    8025bc <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  802593:	8b 40 0c             	mov    0xc(%eax),%eax
+  802596:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.fallocate.req_offset = offset;
+  80259b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80259e:	a3 04 70 80 00       	mov    %eax,0x807004
+  fsipcbuf.fallocate.req_len = len;
+  8025a3:	8b 45 10             	mov    0x10(%ebp),%eax
+  8025a6:	a3 08 70 80 00       	mov    %eax,0x807008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  8025ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025b0:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8025b5:	e8 2a f7 ff ff       	call   801ce4 <fsipc>
+}
+  8025ba:	c9                   	leave
+  8025bb:	c3                   	ret
+    return -E_INVAL;
+  8025bc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8025c1:	eb f7                	jmp    8025ba <fallocate+0x4d>
+
+008025c3 <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  8025c3:	55                   	push   %ebp
+  8025c4:	89 e5                	mov    %esp,%ebp
+  8025c6:	57                   	push   %edi
+  8025c7:	56                   	push   %esi
+  8025c8:	53                   	push   %ebx
+  8025c9:	83 ec 24             	sub    $0x24,%esp
+  8025cc:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8025cf:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8025d2:	50                   	push   %eax
+  8025d3:	ff 75 08             	push   0x8(%ebp)
+  8025d6:	e8 c5 f0 ff ff       	call   8016a0 <fd_lookup>
+  8025db:	83 c4 10             	add    $0x10,%esp
+  8025de:	85 c0                	test   %eax,%eax
+  8025e0:	78 66                	js     802648 <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  8025e2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8025e5:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  8025eb:	39 08                	cmp    %ecx,(%eax)
+  8025ed:	75 61                	jne    802650 <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  8025ef:	85 f6                	test   %esi,%esi
+  8025f1:	7e 50                	jle    802643 <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  8025f3:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  8025f8:	39 de                	cmp    %ebx,%esi
+  8025fa:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  8025fd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802600:	8b 40 0c             	mov    0xc(%eax),%eax
+  802603:	a3 00 70 80 00       	mov    %eax,0x807000
+    fsipcbuf.prefetch.req_n = m;
+  802608:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  80260e:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  802615:	83 ec 04             	sub    $0x4,%esp
+  802618:	57                   	push   %edi
+  802619:	ff 75 0c             	push   0xc(%ebp)
+  80261c:	68 08 70 80 00       	push   $0x807008
+  802621:	e8 74 e4 ff ff       	call   800a9a <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  802626:	ba 00 00 00 00       	mov    $0x0,%edx
+  80262b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802630:	e8 af f6 ff ff       	call   801ce4 <fsipc>
+  802635:	83 c4 10             	add    $0x10,%esp
+  802638:	85 c0                	test   %eax,%eax
+  80263a:	78 0c                	js     802648 <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  80263c:	01 7d 0c             	add    %edi,0xc(%ebp)
+  80263f:	29 de                	sub    %ebx,%esi
+  802641:	eb ac                	jmp    8025ef <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  802643:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802648:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80264b:	5b                   	pop    %ebx
+  80264c:	5e                   	pop    %esi
+  80264d:	5f                   	pop    %edi
+  80264e:	5d                   	pop    %ebp
+  80264f:	c3                   	ret
+    return -E_INVAL;
+  802650:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802655:	eb f1                	jmp    802648 <prefetch+0x85>
+
+00802657 <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  802657:	55                   	push   %ebp
+  802658:	89 e5                	mov    %esp,%ebp
+  80265a:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  80265d:	50                   	push   %eax
+  80265e:	e8 d3 ef ff ff       	call   801636 <fd2data>
+  802663:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  802668:	c9                   	leave
+  802669:	c3                   	ret
+
+0080266a <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80266a:	55                   	push   %ebp
+  80266b:	89 e5                	mov    %esp,%ebp
+  80266d:	56                   	push   %esi
+  80266e:	53                   	push   %ebx
+  80266f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  802672:	83 ec 0c             	sub    $0xc,%esp
+  802675:	ff 75 08             	push   0x8(%ebp)
+  802678:	e8 b9 ef ff ff       	call   801636 <fd2data>
+  80267d:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  80267f:	83 c4 08             	add    $0x8,%esp
+  802682:	68 a0 40 80 00       	push   $0x8040a0
+  802687:	53                   	push   %ebx
+  802688:	e8 87 e2 ff ff       	call   800914 <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  80268d:	8b 46 04             	mov    0x4(%esi),%eax
+  802690:	2b 06                	sub    (%esi),%eax
+  802692:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  802698:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80269f:	00 00 00 
+  stat->st_dev = &devpipe;
+  8026a2:	c7 83 88 00 00 00 20 	movl   $0x805020,0x88(%ebx)
+  8026a9:	50 80 00 
+  return 0;
+}
+  8026ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026b1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026b4:	5b                   	pop    %ebx
+  8026b5:	5e                   	pop    %esi
+  8026b6:	5d                   	pop    %ebp
+  8026b7:	c3                   	ret
+
+008026b8 <pipe_wakeup>:
+{
+  8026b8:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  8026ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026bf:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  8026c2:	85 c0                	test   %eax,%eax
+  8026c4:	75 01                	jne    8026c7 <pipe_wakeup+0xf>
+  8026c6:	c3                   	ret
+{
+  8026c7:	55                   	push   %ebp
+  8026c8:	89 e5                	mov    %esp,%ebp
+  8026ca:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  8026cd:	6a 00                	push   $0x0
+  8026cf:	68 00 00 c0 ee       	push   $0xeec00000
+  8026d4:	52                   	push   %edx
+  8026d5:	e8 c5 e9 ff ff       	call   80109f <sys_chan_wakeup>
+  8026da:	83 c4 10             	add    $0x10,%esp
+}
+  8026dd:	c9                   	leave
+  8026de:	c3                   	ret
+
+008026df <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8026df:	55                   	push   %ebp
+  8026e0:	89 e5                	mov    %esp,%ebp
+  8026e2:	57                   	push   %edi
+  8026e3:	56                   	push   %esi
+  8026e4:	53                   	push   %ebx
+  8026e5:	83 ec 18             	sub    $0x18,%esp
+  8026e8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  8026eb:	57                   	push   %edi
+  8026ec:	e8 45 ef ff ff       	call   801636 <fd2data>
+  8026f1:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  8026f3:	83 c4 10             	add    $0x10,%esp
+  8026f6:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  8026fa:	74 2a                	je     802726 <devpipe_close+0x47>
+  8026fc:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  802701:	89 f8                	mov    %edi,%eax
+  802703:	e8 4f ff ff ff       	call   802657 <pipe_ring>
+  802708:	83 ec 08             	sub    $0x8,%esp
+  80270b:	01 d8                	add    %ebx,%eax
+  80270d:	50                   	push   %eax
+  80270e:	6a 00                	push   $0x0
+  802710:	e8 b3 e6 ff ff       	call   800dc8 <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  802715:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80271b:	83 c4 10             	add    $0x10,%esp
+  80271e:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  802724:	75 db                	jne    802701 <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  802726:	83 ec 08             	sub    $0x8,%esp
+  802729:	57                   	push   %edi
+  80272a:	6a 00                	push   $0x0
+  80272c:	e8 97 e6 ff ff       	call   800dc8 <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  802731:	83 c4 10             	add    $0x10,%esp
+  802734:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  802738:	75 13                	jne    80274d <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  80273a:	83 ec 08             	sub    $0x8,%esp
+  80273d:	56                   	push   %esi
+  80273e:	6a 00                	push   $0x0
+  802740:	e8 83 e6 ff ff       	call   800dc8 <sys_page_unmap>
+}
+  802745:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802748:	5b                   	pop    %ebx
+  802749:	5e                   	pop    %esi
+  80274a:	5f                   	pop    %edi
+  80274b:	5d                   	pop    %ebp
+  80274c:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  80274d:	8d 56 04             	lea    0x4(%esi),%edx
+  802750:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802753:	e8 60 ff ff ff       	call   8026b8 <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802758:	8d 46 30             	lea    0x30(%esi),%eax
+  80275b:	89 f2                	mov    %esi,%edx
+  80275d:	e8 56 ff ff ff       	call   8026b8 <pipe_wakeup>
+  802762:	eb d6                	jmp    80273a <devpipe_close+0x5b>
+
+00802764 <_pipeisclosed>:
+{
+  802764:	55                   	push   %ebp
+  802765:	89 e5                	mov    %esp,%ebp
+  802767:	57                   	push   %edi
+  802768:	56                   	push   %esi
+  802769:	53                   	push   %ebx
+  80276a:	83 ec 1c             	sub    $0x1c,%esp
+  80276d:	89 c7                	mov    %eax,%edi
+  80276f:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  802771:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  802776:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  802779:	83 ec 0c             	sub    $0xc,%esp
+  80277c:	57                   	push   %edi
+  80277d:	e8 ea 10 00 00       	call   80386c <pageref>
+  802782:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802785:	89 34 24             	mov    %esi,(%esp)
+  802788:	e8 df 10 00 00       	call   80386c <pageref>
+    nn = thisenv->env_runs;
+  80278d:	8b 15 a0 68 80 00    	mov    0x8068a0,%edx
+  802793:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  802796:	83 c4 10             	add    $0x10,%esp
+  802799:	39 cb                	cmp    %ecx,%ebx
+  80279b:	74 1b                	je     8027b8 <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  80279d:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8027a0:	75 cf                	jne    802771 <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8027a2:	8b 42 58             	mov    0x58(%edx),%eax
+  8027a5:	6a 01                	push   $0x1
+  8027a7:	50                   	push   %eax
+  8027a8:	53                   	push   %ebx
+  8027a9:	68 a7 40 80 00       	push   $0x8040a7
+  8027ae:	e8 73 db ff ff       	call   800326 <cprintf>
+  8027b3:	83 c4 10             	add    $0x10,%esp
+  8027b6:	eb b9                	jmp    802771 <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  8027b8:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8027bb:	0f 94 c0             	sete   %al
+  8027be:	0f b6 c0             	movzbl %al,%eax
+}
+  8027c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027c4:	5b                   	pop    %ebx
+  8027c5:	5e                   	pop    %esi
+  8027c6:	5f                   	pop    %edi
+  8027c7:	5d                   	pop    %ebp
+  8027c8:	c3                   	ret
+
+008027c9 <devpipe_write_bulk>:
+{
+  8027c9:	55                   	push   %ebp
+  8027ca:	89 e5                	mov    %esp,%ebp
+  8027cc:	57                   	push   %edi
+  8027cd:	56                   	push   %esi
+  8027ce:	53                   	push   %ebx
+  8027cf:	83 ec 1c             	sub    $0x1c,%esp
+  8027d2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8027d5:	89 d6                	mov    %edx,%esi
+  8027d7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  8027da:	e8 78 fe ff ff       	call   802657 <pipe_ring>
+  8027df:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  8027e2:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  8027e7:	8d 46 04             	lea    0x4(%esi),%eax
+  8027ea:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  8027ed:	eb 75                	jmp    802864 <devpipe_write_bulk+0x9b>
+  8027ef:	b8 01 00 00 00       	mov    $0x1,%eax
+  8027f4:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  8027f8:	6a 64                	push   $0x64
+  8027fa:	68 00 00 c0 ee       	push   $0xeec00000
+  8027ff:	53                   	push   %ebx
+  802800:	56                   	push   %esi
+  802801:	e8 76 e8 ff ff       	call   80107c <sys_chan_sleep>
+      continue;
+  802806:	83 c4 10             	add    $0x10,%esp
+  802809:	eb 59                	jmp    802864 <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  80280b:	89 d1                	mov    %edx,%ecx
+  80280d:	c1 f9 1f             	sar    $0x1f,%ecx
+  802810:	c1 e9 11             	shr    $0x11,%ecx
+  802813:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802816:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  80281b:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  80281d:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  802823:	29 d3                	sub    %edx,%ebx
+  802825:	ba 00 80 00 00       	mov    $0x8000,%edx
+  80282a:	29 c2                	sub    %eax,%edx
+  80282c:	39 d3                	cmp    %edx,%ebx
+  80282e:	0f 47 da             	cmova  %edx,%ebx
+  802831:	8b 55 08             	mov    0x8(%ebp),%edx
+  802834:	29 fa                	sub    %edi,%edx
+  802836:	39 d3                	cmp    %edx,%ebx
+  802838:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  80283b:	83 ec 04             	sub    $0x4,%esp
+  80283e:	53                   	push   %ebx
+  80283f:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802842:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  802845:	52                   	push   %edx
+  802846:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802849:	01 c8                	add    %ecx,%eax
+  80284b:	50                   	push   %eax
+  80284c:	e8 ab e2 ff ff       	call   800afc <memcpy>
+    i += m;
+  802851:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  802853:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802856:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802859:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80285c:	e8 57 fe ff ff       	call   8026b8 <pipe_wakeup>
+  802861:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802864:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802867:	73 2b                	jae    802894 <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  802869:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  80286b:	8b 56 04             	mov    0x4(%esi),%edx
+  80286e:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  802874:	39 d0                	cmp    %edx,%eax
+  802876:	7d 93                	jge    80280b <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  802878:	89 f2                	mov    %esi,%edx
+  80287a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80287d:	e8 e2 fe ff ff       	call   802764 <_pipeisclosed>
+  802882:	85 c0                	test   %eax,%eax
+  802884:	0f 84 65 ff ff ff    	je     8027ef <devpipe_write_bulk+0x26>
+        return i;
+  80288a:	89 f8                	mov    %edi,%eax
+}
+  80288c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80288f:	5b                   	pop    %ebx
+  802890:	5e                   	pop    %esi
+  802891:	5f                   	pop    %edi
+  802892:	5d                   	pop    %ebp
+  802893:	c3                   	ret
+  return i;
+  802894:	89 f8                	mov    %edi,%eax
+  802896:	eb f4                	jmp    80288c <devpipe_write_bulk+0xc3>
+
+00802898 <devpipe_write>:
+{
+  802898:	55                   	push   %ebp
+  802899:	89 e5                	mov    %esp,%ebp
+  80289b:	57                   	push   %edi
+  80289c:	56                   	push   %esi
+  80289d:	53                   	push   %ebx
+  80289e:	83 ec 28             	sub    $0x28,%esp
+  8028a1:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  8028a4:	56                   	push   %esi
+  8028a5:	e8 8c ed ff ff       	call   801636 <fd2data>
+  8028aa:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  8028ac:	8b 78 28             	mov    0x28(%eax),%edi
+  8028af:	83 c4 10             	add    $0x10,%esp
+  8028b2:	85 ff                	test   %edi,%edi
+  8028b4:	75 25                	jne    8028db <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  8028b6:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8028b9:	74 66                	je     802921 <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8028bb:	8b 43 04             	mov    0x4(%ebx),%eax
+  8028be:	8b 0b                	mov    (%ebx),%ecx
+  8028c0:	8d 51 20             	lea    0x20(%ecx),%edx
+  8028c3:	39 d0                	cmp    %edx,%eax
+  8028c5:	72 2b                	jb     8028f2 <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  8028c7:	89 da                	mov    %ebx,%edx
+  8028c9:	89 f0                	mov    %esi,%eax
+  8028cb:	e8 94 fe ff ff       	call   802764 <_pipeisclosed>
+  8028d0:	85 c0                	test   %eax,%eax
+  8028d2:	75 51                	jne    802925 <devpipe_write+0x8d>
+      sys_yield();
+  8028d4:	e8 08 e4 ff ff       	call   800ce1 <sys_yield>
+  8028d9:	eb e0                	jmp    8028bb <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  8028db:	83 ec 0c             	sub    $0xc,%esp
+  8028de:	ff 75 10             	push   0x10(%ebp)
+  8028e1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8028e4:	89 c2                	mov    %eax,%edx
+  8028e6:	89 f0                	mov    %esi,%eax
+  8028e8:	e8 dc fe ff ff       	call   8027c9 <devpipe_write_bulk>
+  8028ed:	83 c4 10             	add    $0x10,%esp
+  8028f0:	eb 38                	jmp    80292a <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8028f2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8028f5:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8028f9:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8028fc:	89 c2                	mov    %eax,%edx
+  8028fe:	c1 fa 1f             	sar    $0x1f,%edx
+  802901:	89 d1                	mov    %edx,%ecx
+  802903:	c1 e9 1b             	shr    $0x1b,%ecx
+  802906:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802909:	83 e2 1f             	and    $0x1f,%edx
+  80290c:	29 ca                	sub    %ecx,%edx
+  80290e:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802912:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  802916:	83 c0 01             	add    $0x1,%eax
+  802919:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  80291c:	83 c7 01             	add    $0x1,%edi
+  80291f:	eb 95                	jmp    8028b6 <devpipe_write+0x1e>
+  return i;
+  802921:	89 f8                	mov    %edi,%eax
+  802923:	eb 05                	jmp    80292a <devpipe_write+0x92>
+        return 0;
+  802925:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80292a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80292d:	5b                   	pop    %ebx
+  80292e:	5e                   	pop    %esi
+  80292f:	5f                   	pop    %edi
+  802930:	5d                   	pop    %ebp
+  802931:	c3                   	ret
+
+00802932 <devpipe_read_bulk>:
+{
+  802932:	55                   	push   %ebp
+  802933:	89 e5                	mov    %esp,%ebp
+  802935:	57                   	push   %edi
+  802936:	56                   	push   %esi
+  802937:	53                   	push   %ebx
+  802938:	83 ec 2c             	sub    $0x2c,%esp
+  80293b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80293e:	89 d6                	mov    %edx,%esi
+  802940:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802943:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  802946:	e8 0c fd ff ff       	call   802657 <pipe_ring>
+  80294b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  80294e:	85 db                	test   %ebx,%ebx
+  802950:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802955:	0f 45 c3             	cmovne %ebx,%eax
+  802958:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80295b:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802960:	8d 46 30             	lea    0x30(%esi),%eax
+  802963:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  802966:	eb 50                	jmp    8029b8 <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  802968:	89 d1                	mov    %edx,%ecx
+  80296a:	c1 f9 1f             	sar    $0x1f,%ecx
+  80296d:	c1 e9 11             	shr    $0x11,%ecx
+  802970:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802973:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802978:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  80297a:	29 d3                	sub    %edx,%ebx
+  80297c:	ba 00 80 00 00       	mov    $0x8000,%edx
+  802981:	29 c2                	sub    %eax,%edx
+  802983:	39 d3                	cmp    %edx,%ebx
+  802985:	0f 47 da             	cmova  %edx,%ebx
+  802988:	8b 55 08             	mov    0x8(%ebp),%edx
+  80298b:	29 fa                	sub    %edi,%edx
+  80298d:	39 d3                	cmp    %edx,%ebx
+  80298f:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  802992:	83 ec 04             	sub    $0x4,%esp
+  802995:	53                   	push   %ebx
+  802996:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802999:	01 c8                	add    %ecx,%eax
+  80299b:	50                   	push   %eax
+  80299c:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80299f:	01 f8                	add    %edi,%eax
+  8029a1:	50                   	push   %eax
+  8029a2:	e8 55 e1 ff ff       	call   800afc <memcpy>
+    i += m;
+  8029a7:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  8029a9:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8029ab:	89 f2                	mov    %esi,%edx
+  8029ad:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8029b0:	e8 03 fd ff ff       	call   8026b8 <pipe_wakeup>
+  8029b5:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  8029b8:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  8029bb:	73 51                	jae    802a0e <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  8029bd:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  8029c0:	8b 16                	mov    (%esi),%edx
+  8029c2:	39 da                	cmp    %ebx,%edx
+  8029c4:	75 a2                	jne    802968 <devpipe_read_bulk+0x36>
+      if (i > 0)
+  8029c6:	85 ff                	test   %edi,%edi
+  8029c8:	75 44                	jne    802a0e <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  8029ca:	89 f2                	mov    %esi,%edx
+  8029cc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8029cf:	e8 90 fd ff ff       	call   802764 <_pipeisclosed>
+  8029d4:	85 c0                	test   %eax,%eax
+  8029d6:	75 3a                	jne    802a12 <devpipe_read_bulk+0xe0>
+  8029d8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8029dd:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  8029e1:	6a 64                	push   $0x64
+  8029e3:	ff 75 d4             	push   -0x2c(%ebp)
+  8029e6:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  8029e7:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  8029ea:	50                   	push   %eax
+  8029eb:	e8 8c e6 ff ff       	call   80107c <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  8029f0:	85 c0                	test   %eax,%eax
+  8029f2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029f7:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  8029fa:	83 c4 10             	add    $0x10,%esp
+  8029fd:	a8 01                	test   $0x1,%al
+  8029ff:	74 b7                	je     8029b8 <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  802a01:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  802a06:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a09:	5b                   	pop    %ebx
+  802a0a:	5e                   	pop    %esi
+  802a0b:	5f                   	pop    %edi
+  802a0c:	5d                   	pop    %ebp
+  802a0d:	c3                   	ret
+  return i;
+  802a0e:	89 f8                	mov    %edi,%eax
+  802a10:	eb f4                	jmp    802a06 <devpipe_read_bulk+0xd4>
+        return 0;
+  802a12:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a17:	eb ed                	jmp    802a06 <devpipe_read_bulk+0xd4>
+
+00802a19 <devpipe_read>:
+{
+  802a19:	55                   	push   %ebp
+  802a1a:	89 e5                	mov    %esp,%ebp
+  802a1c:	57                   	push   %edi
+  802a1d:	56                   	push   %esi
+  802a1e:	53                   	push   %ebx
+  802a1f:	83 ec 18             	sub    $0x18,%esp
+  802a22:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  802a25:	57                   	push   %edi
+  802a26:	e8 0b ec ff ff       	call   801636 <fd2data>
+  802a2b:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  802a2d:	8b 70 28             	mov    0x28(%eax),%esi
+  802a30:	83 c4 10             	add    $0x10,%esp
+  802a33:	85 f6                	test   %esi,%esi
+  802a35:	75 24                	jne    802a5b <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  802a37:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802a3a:	74 60                	je     802a9c <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  802a3c:	8b 03                	mov    (%ebx),%eax
+  802a3e:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802a41:	75 3b                	jne    802a7e <devpipe_read+0x65>
+      if (i > 0)
+  802a43:	85 f6                	test   %esi,%esi
+  802a45:	75 2d                	jne    802a74 <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  802a47:	89 da                	mov    %ebx,%edx
+  802a49:	89 f8                	mov    %edi,%eax
+  802a4b:	e8 14 fd ff ff       	call   802764 <_pipeisclosed>
+  802a50:	85 c0                	test   %eax,%eax
+  802a52:	75 4c                	jne    802aa0 <devpipe_read+0x87>
+      sys_yield();
+  802a54:	e8 88 e2 ff ff       	call   800ce1 <sys_yield>
+  802a59:	eb e1                	jmp    802a3c <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  802a5b:	83 ec 08             	sub    $0x8,%esp
+  802a5e:	6a 00                	push   $0x0
+  802a60:	ff 75 10             	push   0x10(%ebp)
+  802a63:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802a66:	89 c2                	mov    %eax,%edx
+  802a68:	89 f8                	mov    %edi,%eax
+  802a6a:	e8 c3 fe ff ff       	call   802932 <devpipe_read_bulk>
+  802a6f:	83 c4 10             	add    $0x10,%esp
+  802a72:	eb 02                	jmp    802a76 <devpipe_read+0x5d>
+        return i;
+  802a74:	89 f0                	mov    %esi,%eax
+}
+  802a76:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a79:	5b                   	pop    %ebx
+  802a7a:	5e                   	pop    %esi
+  802a7b:	5f                   	pop    %edi
+  802a7c:	5d                   	pop    %ebp
+  802a7d:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802a7e:	99                   	cltd
+  802a7f:	c1 ea 1b             	shr    $0x1b,%edx
+  802a82:	01 d0                	add    %edx,%eax
+  802a84:	83 e0 1f             	and    $0x1f,%eax
+  802a87:	29 d0                	sub    %edx,%eax
+  802a89:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802a8e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802a91:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  802a94:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  802a97:	83 c6 01             	add    $0x1,%esi
+  802a9a:	eb 9b                	jmp    802a37 <devpipe_read+0x1e>
+  return i;
+  802a9c:	89 f0                	mov    %esi,%eax
+  802a9e:	eb d6                	jmp    802a76 <devpipe_read+0x5d>
+        return 0;
+  802aa0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aa5:	eb cf                	jmp    802a76 <devpipe_read+0x5d>
+
+00802aa7 <pipe2>:
+{
+  802aa7:	55                   	push   %ebp
+  802aa8:	89 e5                	mov    %esp,%ebp
+  802aaa:	57                   	push   %edi
+  802aab:	56                   	push   %esi
+  802aac:	53                   	push   %ebx
+  802aad:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  802ab0:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802ab3:	50                   	push   %eax
+  802ab4:	e8 91 eb ff ff       	call   80164a <fd_alloc>
+  802ab9:	89 c3                	mov    %eax,%ebx
+  802abb:	83 c4 10             	add    $0x10,%esp
+  802abe:	85 c0                	test   %eax,%eax
+  802ac0:	0f 88 fb 01 00 00    	js     802cc1 <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802ac6:	83 ec 04             	sub    $0x4,%esp
+  802ac9:	68 07 04 00 00       	push   $0x407
+  802ace:	ff 75 e4             	push   -0x1c(%ebp)
+  802ad1:	6a 00                	push   $0x0
+  802ad3:	e8 6b e2 ff ff       	call   800d43 <sys_page_alloc>
+  802ad8:	89 c3                	mov    %eax,%ebx
+  802ada:	83 c4 10             	add    $0x10,%esp
+  802add:	85 c0                	test   %eax,%eax
+  802adf:	0f 88 dc 01 00 00    	js     802cc1 <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  802ae5:	83 ec 0c             	sub    $0xc,%esp
+  802ae8:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  802aeb:	50                   	push   %eax
+  802aec:	e8 59 eb ff ff       	call   80164a <fd_alloc>
+  802af1:	89 c3                	mov    %eax,%ebx
+  802af3:	83 c4 10             	add    $0x10,%esp
+  802af6:	85 c0                	test   %eax,%eax
+  802af8:	0f 88 b3 01 00 00    	js     802cb1 <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802afe:	83 ec 04             	sub    $0x4,%esp
+  802b01:	68 07 04 00 00       	push   $0x407
+  802b06:	ff 75 e0             	push   -0x20(%ebp)
+  802b09:	6a 00                	push   $0x0
+  802b0b:	e8 33 e2 ff ff       	call   800d43 <sys_page_alloc>
+  802b10:	89 c3                	mov    %eax,%ebx
+  802b12:	83 c4 10             	add    $0x10,%esp
+  802b15:	85 c0                	test   %eax,%eax
+  802b17:	0f 88 94 01 00 00    	js     802cb1 <pipe2+0x20a>
+  va = fd2data(fd0);
+  802b1d:	83 ec 0c             	sub    $0xc,%esp
+  802b20:	ff 75 e4             	push   -0x1c(%ebp)
+  802b23:	e8 0e eb ff ff       	call   801636 <fd2data>
+  802b28:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802b2a:	83 c4 0c             	add    $0xc,%esp
+  802b2d:	68 07 04 00 00       	push   $0x407
+  802b32:	50                   	push   %eax
+  802b33:	6a 00                	push   $0x0
+  802b35:	e8 09 e2 ff ff       	call   800d43 <sys_page_alloc>
+  802b3a:	89 c3                	mov    %eax,%ebx
+  802b3c:	83 c4 10             	add    $0x10,%esp
+  802b3f:	85 c0                	test   %eax,%eax
+  802b41:	0f 88 5a 01 00 00    	js     802ca1 <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802b47:	83 ec 0c             	sub    $0xc,%esp
+  802b4a:	ff 75 e0             	push   -0x20(%ebp)
+  802b4d:	e8 e4 ea ff ff       	call   801636 <fd2data>
+  802b52:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802b59:	50                   	push   %eax
+  802b5a:	6a 00                	push   $0x0
+  802b5c:	57                   	push   %edi
+  802b5d:	6a 00                	push   $0x0
+  802b5f:	e8 22 e2 ff ff       	call   800d86 <sys_page_map>
+  802b64:	89 c3                	mov    %eax,%ebx
+  802b66:	83 c4 20             	add    $0x20,%esp
+  802b69:	85 c0                	test   %eax,%eax
+  802b6b:	0f 88 22 01 00 00    	js     802c93 <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  802b71:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  802b75:	74 72                	je     802be9 <pipe2+0x142>
+  802b77:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  802b7c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802b7f:	e8 d3 fa ff ff       	call   802657 <pipe_ring>
+  802b84:	83 ec 04             	sub    $0x4,%esp
+  802b87:	68 07 04 00 00       	push   $0x407
+  802b8c:	01 f0                	add    %esi,%eax
+  802b8e:	50                   	push   %eax
+  802b8f:	6a 00                	push   $0x0
+  802b91:	e8 ad e1 ff ff       	call   800d43 <sys_page_alloc>
+  802b96:	89 c3                	mov    %eax,%ebx
+  802b98:	83 c4 10             	add    $0x10,%esp
+  802b9b:	85 c0                	test   %eax,%eax
+  802b9d:	0f 88 97 00 00 00    	js     802c3a <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  802ba3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802ba6:	e8 ac fa ff ff       	call   802657 <pipe_ring>
+  802bab:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  802bae:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802bb1:	e8 a1 fa ff ff       	call   802657 <pipe_ring>
+  802bb6:	83 ec 0c             	sub    $0xc,%esp
+  802bb9:	68 07 04 00 00       	push   $0x407
+  802bbe:	53                   	push   %ebx
+  802bbf:	6a 00                	push   $0x0
+  802bc1:	01 f0                	add    %esi,%eax
+  802bc3:	50                   	push   %eax
+  802bc4:	6a 00                	push   $0x0
+  802bc6:	e8 bb e1 ff ff       	call   800d86 <sys_page_map>
+  802bcb:	89 c3                	mov    %eax,%ebx
+  802bcd:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802bd3:	83 c4 20             	add    $0x20,%esp
+  802bd6:	85 c0                	test   %eax,%eax
+  802bd8:	78 60                	js     802c3a <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  802bda:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802be0:	75 9a                	jne    802b7c <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  802be2:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  802be9:	a1 20 50 80 00       	mov    0x805020,%eax
+  802bee:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802bf1:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  802bf3:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802bf6:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  802bfd:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802c00:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  802c02:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802c05:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  802c0c:	83 ec 0c             	sub    $0xc,%esp
+  802c0f:	ff 75 e4             	push   -0x1c(%ebp)
+  802c12:	e8 0f ea ff ff       	call   801626 <fd2num>
+  802c17:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802c1a:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  802c1c:	83 c4 04             	add    $0x4,%esp
+  802c1f:	ff 75 e0             	push   -0x20(%ebp)
+  802c22:	e8 ff e9 ff ff       	call   801626 <fd2num>
+  802c27:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802c2a:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  802c2d:	83 c4 10             	add    $0x10,%esp
+  802c30:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c35:	e9 87 00 00 00       	jmp    802cc1 <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802c3a:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  802c3f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802c42:	e8 10 fa ff ff       	call   802657 <pipe_ring>
+  802c47:	83 ec 08             	sub    $0x8,%esp
+  802c4a:	01 f0                	add    %esi,%eax
+  802c4c:	50                   	push   %eax
+  802c4d:	6a 00                	push   $0x0
+  802c4f:	e8 74 e1 ff ff       	call   800dc8 <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  802c54:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802c57:	e8 fb f9 ff ff       	call   802657 <pipe_ring>
+  802c5c:	83 c4 08             	add    $0x8,%esp
+  802c5f:	01 f0                	add    %esi,%eax
+  802c61:	50                   	push   %eax
+  802c62:	6a 00                	push   $0x0
+  802c64:	e8 5f e1 ff ff       	call   800dc8 <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802c69:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802c6f:	83 c4 10             	add    $0x10,%esp
+  802c72:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802c78:	75 c5                	jne    802c3f <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  802c7a:	83 ec 0c             	sub    $0xc,%esp
+  802c7d:	ff 75 e0             	push   -0x20(%ebp)
+  802c80:	e8 b1 e9 ff ff       	call   801636 <fd2data>
+  802c85:	83 c4 08             	add    $0x8,%esp
+  802c88:	50                   	push   %eax
+  802c89:	6a 00                	push   $0x0
+  802c8b:	e8 38 e1 ff ff       	call   800dc8 <sys_page_unmap>
+  802c90:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  802c93:	83 ec 08             	sub    $0x8,%esp
+  802c96:	57                   	push   %edi
+  802c97:	6a 00                	push   $0x0
+  802c99:	e8 2a e1 ff ff       	call   800dc8 <sys_page_unmap>
+  802c9e:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  802ca1:	83 ec 08             	sub    $0x8,%esp
+  802ca4:	ff 75 e0             	push   -0x20(%ebp)
+  802ca7:	6a 00                	push   $0x0
+  802ca9:	e8 1a e1 ff ff       	call   800dc8 <sys_page_unmap>
+  802cae:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  802cb1:	83 ec 08             	sub    $0x8,%esp
+  802cb4:	ff 75 e4             	push   -0x1c(%ebp)
+  802cb7:	6a 00                	push   $0x0
+  802cb9:	e8 0a e1 ff ff       	call   800dc8 <sys_page_unmap>
+  802cbe:	83 c4 10             	add    $0x10,%esp
+}
+  802cc1:	89 d8                	mov    %ebx,%eax
+  802cc3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802cc6:	5b                   	pop    %ebx
+  802cc7:	5e                   	pop    %esi
+  802cc8:	5f                   	pop    %edi
+  802cc9:	5d                   	pop    %ebp
+  802cca:	c3                   	ret
+
+00802ccb <pipe>:
+{
+  802ccb:	55                   	push   %ebp
+  802ccc:	89 e5                	mov    %esp,%ebp
+  802cce:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  802cd1:	6a 00                	push   $0x0
+  802cd3:	ff 75 08             	push   0x8(%ebp)
+  802cd6:	e8 cc fd ff ff       	call   802aa7 <pipe2>
+}
+  802cdb:	c9                   	leave
+  802cdc:	c3                   	ret
+
+00802cdd <pipeisclosed>:
+{
+  802cdd:	55                   	push   %ebp
+  802cde:	89 e5                	mov    %esp,%ebp
+  802ce0:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802ce3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802ce6:	50                   	push   %eax
+  802ce7:	ff 75 08             	push   0x8(%ebp)
+  802cea:	e8 b1 e9 ff ff       	call   8016a0 <fd_lookup>
+  802cef:	83 c4 10             	add    $0x10,%esp
+  802cf2:	85 c0                	test   %eax,%eax
+  802cf4:	78 18                	js     802d0e <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  802cf6:	83 ec 0c             	sub    $0xc,%esp
+  802cf9:	ff 75 f4             	push   -0xc(%ebp)
+  802cfc:	e8 35 e9 ff ff       	call   801636 <fd2data>
+  802d01:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  802d03:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802d06:	e8 59 fa ff ff       	call   802764 <_pipeisclosed>
+  802d0b:	83 c4 10             	add    $0x10,%esp
+}
+  802d0e:	c9                   	leave
+  802d0f:	c3                   	ret
+
+00802d10 <pipe_splice>:
+{
+  802d10:	55                   	push   %ebp
+  802d11:	89 e5                	mov    %esp,%ebp
+  802d13:	57                   	push   %edi
+  802d14:	56                   	push   %esi
+  802d15:	53                   	push   %ebx
+  802d16:	83 ec 34             	sub    $0x34,%esp
+  802d19:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802d1c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802d1f:	50                   	push   %eax
+  802d20:	ff 75 08             	push   0x8(%ebp)
+  802d23:	e8 78 e9 ff ff       	call   8016a0 <fd_lookup>
+  802d28:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802d2b:	83 c4 10             	add    $0x10,%esp
+  802d2e:	85 c0                	test   %eax,%eax
+  802d30:	0f 88 d7 00 00 00    	js     802e0d <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  802d36:	83 ec 0c             	sub    $0xc,%esp
+  802d39:	ff 75 e4             	push   -0x1c(%ebp)
+  802d3c:	e8 f5 e8 ff ff       	call   801636 <fd2data>
+  802d41:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802d43:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802d46:	83 c4 10             	add    $0x10,%esp
+  802d49:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  802d4f:	39 10                	cmp    %edx,(%eax)
+  802d51:	0f 85 c1 00 00 00    	jne    802e18 <pipe_splice+0x108>
+  802d57:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  802d5b:	0f 84 c0 00 00 00    	je     802e21 <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  802d61:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802d65:	0f 84 bf 00 00 00    	je     802e2a <pipe_splice+0x11a>
+  802d6b:	89 f7                	mov    %esi,%edi
+  802d6d:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  802d73:	0f 85 ba 00 00 00    	jne    802e33 <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802d79:	8d 43 04             	lea    0x4(%ebx),%eax
+  802d7c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802d7f:	eb 38                	jmp    802db9 <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802d81:	83 ec 0c             	sub    $0xc,%esp
+  802d84:	68 00 10 00 00       	push   $0x1000
+  802d89:	89 f1                	mov    %esi,%ecx
+  802d8b:	89 da                	mov    %ebx,%edx
+  802d8d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802d90:	e8 34 fa ff ff       	call   8027c9 <devpipe_write_bulk>
+  802d95:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802d98:	83 c4 10             	add    $0x10,%esp
+  802d9b:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802da0:	75 53                	jne    802df5 <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  802da2:	83 ec 08             	sub    $0x8,%esp
+  802da5:	56                   	push   %esi
+  802da6:	6a 00                	push   $0x0
+  802da8:	e8 1b e0 ff ff       	call   800dc8 <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  802dad:	83 c7 01             	add    $0x1,%edi
+  802db0:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802db6:	83 c4 10             	add    $0x10,%esp
+  802db9:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802dbc:	74 3a                	je     802df8 <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  802dbe:	8b 03                	mov    (%ebx),%eax
+  802dc0:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802dc3:	75 bc                	jne    802d81 <pipe_splice+0x71>
+  802dc5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dca:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  802dce:	85 c0                	test   %eax,%eax
+  802dd0:	74 af                	je     802d81 <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802dd2:	83 ec 04             	sub    $0x4,%esp
+  802dd5:	6a 07                	push   $0x7
+  802dd7:	56                   	push   %esi
+  802dd8:	ff 75 d0             	push   -0x30(%ebp)
+  802ddb:	e8 bf e2 ff ff       	call   80109f <sys_chan_wakeup>
+  802de0:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802de3:	83 c4 10             	add    $0x10,%esp
+  802de6:	85 c0                	test   %eax,%eax
+  802de8:	79 b8                	jns    802da2 <pipe_splice+0x92>
+  802dea:	b8 01 00 00 00       	mov    $0x1,%eax
+  802def:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802df3:	eb 8c                	jmp    802d81 <pipe_splice+0x71>
+  802df5:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  802df8:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802dfc:	75 06                	jne    802e04 <pipe_splice+0xf4>
+  802dfe:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802e02:	78 09                	js     802e0d <pipe_splice+0xfd>
+  return i * PGSIZE;
+  802e04:	8b 45 10             	mov    0x10(%ebp),%eax
+  802e07:	c1 e0 0c             	shl    $0xc,%eax
+  802e0a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  802e0d:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802e10:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e13:	5b                   	pop    %ebx
+  802e14:	5e                   	pop    %esi
+  802e15:	5f                   	pop    %edi
+  802e16:	5d                   	pop    %ebp
+  802e17:	c3                   	ret
+    return -E_INVAL;
+  802e18:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802e1f:	eb ec                	jmp    802e0d <pipe_splice+0xfd>
+  802e21:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802e28:	eb e3                	jmp    802e0d <pipe_splice+0xfd>
+  802e2a:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802e31:	eb da                	jmp    802e0d <pipe_splice+0xfd>
+  802e33:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802e3a:	eb d1                	jmp    802e0d <pipe_splice+0xfd>
+
+00802e3c <pipe_splice_read>:
+{
+  802e3c:	55                   	push   %ebp
+  802e3d:	89 e5                	mov    %esp,%ebp
+  802e3f:	53                   	push   %ebx
+  802e40:	83 ec 1c             	sub    $0x1c,%esp
+  802e43:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802e46:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802e49:	50                   	push   %eax
+  802e4a:	ff 75 08             	push   0x8(%ebp)
+  802e4d:	e8 4e e8 ff ff       	call   8016a0 <fd_lookup>
+  802e52:	83 c4 10             	add    $0x10,%esp
+  802e55:	85 c0                	test   %eax,%eax
+  802e57:	78 49                	js     802ea2 <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  802e59:	83 ec 0c             	sub    $0xc,%esp
+  802e5c:	ff 75 f4             	push   -0xc(%ebp)
+  802e5f:	e8 d2 e7 ff ff       	call   801636 <fd2data>
+  802e64:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802e66:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802e69:	83 c4 10             	add    $0x10,%esp
+  802e6c:	8b 0d 20 50 80 00    	mov    0x805020,%ecx
+  802e72:	39 08                	cmp    %ecx,(%eax)
+  802e74:	75 31                	jne    802ea7 <pipe_splice_read+0x6b>
+  802e76:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  802e7a:	74 32                	je     802eae <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  802e7c:	8b 48 08             	mov    0x8(%eax),%ecx
+  802e7f:	83 e1 03             	and    $0x3,%ecx
+  802e82:	83 f9 01             	cmp    $0x1,%ecx
+  802e85:	74 2e                	je     802eb5 <pipe_splice_read+0x79>
+  802e87:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  802e8d:	75 2d                	jne    802ebc <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  802e8f:	83 ec 08             	sub    $0x8,%esp
+  802e92:	53                   	push   %ebx
+  802e93:	68 00 10 00 00       	push   $0x1000
+  802e98:	89 d9                	mov    %ebx,%ecx
+  802e9a:	e8 93 fa ff ff       	call   802932 <devpipe_read_bulk>
+  802e9f:	83 c4 10             	add    $0x10,%esp
+}
+  802ea2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ea5:	c9                   	leave
+  802ea6:	c3                   	ret
+    return -E_INVAL;
+  802ea7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802eac:	eb f4                	jmp    802ea2 <pipe_splice_read+0x66>
+  802eae:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802eb3:	eb ed                	jmp    802ea2 <pipe_splice_read+0x66>
+  802eb5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802eba:	eb e6                	jmp    802ea2 <pipe_splice_read+0x66>
+  802ebc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ec1:	eb df                	jmp    802ea2 <pipe_splice_read+0x66>
+
+00802ec3 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  802ec3:	55                   	push   %ebp
+  802ec4:	89 e5                	mov    %esp,%ebp
+  802ec6:	56                   	push   %esi
+  802ec7:	53                   	push   %ebx
+  802ec8:	8b 75 08             	mov    0x8(%ebp),%esi
+  const volatile struct Env *e;
+
+  assert(envid != 0);
+  802ecb:	85 f6                	test   %esi,%esi
+  802ecd:	74 15                	je     802ee4 <wait+0x21>
+  e = &envs[ENVX(envid)];
+  802ecf:	89 f0                	mov    %esi,%eax
+  802ed1:	25 ff 03 00 00       	and    $0x3ff,%eax
+  while (e->env_id == envid && e->env_status != ENV_FREE)
+  802ed6:	8d 1c c0             	lea    (%eax,%eax,8),%ebx
+  802ed9:	c1 e3 04             	shl    $0x4,%ebx
+  802edc:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  802ee2:	eb 1b                	jmp    802eff <wait+0x3c>
+  assert(envid != 0);
+  802ee4:	68 bf 40 80 00       	push   $0x8040bf
+  802ee9:	68 50 40 80 00       	push   $0x804050
+  802eee:	6a 09                	push   $0x9
+  802ef0:	68 ca 40 80 00       	push   $0x8040ca
+  802ef5:	e8 51 d3 ff ff       	call   80024b <_panic>
+    sys_yield();
+  802efa:	e8 e2 dd ff ff       	call   800ce1 <sys_yield>
+  while (e->env_id == envid && e->env_status != ENV_FREE)
+  802eff:	8b 43 48             	mov    0x48(%ebx),%eax
+  802f02:	39 f0                	cmp    %esi,%eax
+  802f04:	75 07                	jne    802f0d <wait+0x4a>
+  802f06:	8b 43 54             	mov    0x54(%ebx),%eax
+  802f09:	85 c0                	test   %eax,%eax
+  802f0b:	75 ed                	jne    802efa <wait+0x37>
+}
+  802f0d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802f10:	5b                   	pop    %ebx
+  802f11:	5e                   	pop    %esi
+  802f12:	5d                   	pop    %ebp
+  802f13:	c3                   	ret
+
+00802f14 <mmap_find>:
+          utf->utf_eip, utf->utf_err);
+}
+
+static struct Mmap *
+mmap_find(uintptr_t va)
+{
+  802f14:	55                   	push   %ebp
+  802f15:	89 e5                	mov    %esp,%ebp
+  802f17:	56                   	push   %esi
+  802f18:	53                   	push   %ebx
+  int i;
+
+  for (i = 0; i < NMMAP; i++)
+  802f19:	ba 60 67 80 00       	mov    $0x806760,%edx
+  802f1e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f23:	eb 0b                	jmp    802f30 <mmap_find+0x1c>
+  802f25:	83 c3 01             	add    $0x1,%ebx
+  802f28:	83 c2 14             	add    $0x14,%edx
+  802f2b:	83 fb 10             	cmp    $0x10,%ebx
+  802f2e:	74 1d                	je     802f4d <mmap_find+0x39>
+    if (mmaps[i].mm_va && va >= mmaps[i].mm_va &&
+  802f30:	8b 0a                	mov    (%edx),%ecx
+  802f32:	39 c8                	cmp    %ecx,%eax
+  802f34:	72 ef                	jb     802f25 <mmap_find+0x11>
+  802f36:	85 c9                	test   %ecx,%ecx
+  802f38:	74 eb                	je     802f25 <mmap_find+0x11>
+        va < mmaps[i].mm_va + mmaps[i].mm_len)
+  802f3a:	03 4a 04             	add    0x4(%edx),%ecx
+    if (mmaps[i].mm_va && va >= mmaps[i].mm_va &&
+  802f3d:	39 c8                	cmp    %ecx,%eax
+  802f3f:	73 e4                	jae    802f25 <mmap_find+0x11>
+      return &mmaps[i];
+  802f41:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802f44:	8d 04 85 60 67 80 00 	lea    0x806760(,%eax,4),%eax
+  802f4b:	eb 05                	jmp    802f52 <mmap_find+0x3e>
+  return NULL;
+  802f4d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802f52:	5b                   	pop    %ebx
+  802f53:	5e                   	pop    %esi
+  802f54:	5d                   	pop    %ebp
+  802f55:	c3                   	ret
+
+00802f56 <va_mapped>:
+
+static bool
+va_mapped(uintptr_t va)
+{
+  return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+  802f56:	89 c2                	mov    %eax,%edx
+  802f58:	c1 ea 16             	shr    $0x16,%edx
+  802f5b:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802f62:	f6 c2 01             	test   $0x1,%dl
+  802f65:	74 11                	je     802f78 <va_mapped+0x22>
+  802f67:	c1 e8 0c             	shr    $0xc,%eax
+  802f6a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802f71:	83 e0 01             	and    $0x1,%eax
+  802f74:	83 e0 01             	and    $0x1,%eax
+}
+  802f77:	c3                   	ret
+  return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+  802f78:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f7d:	eb f5                	jmp    802f74 <va_mapped+0x1e>
+
+00802f7f <mmap_copy>:
+
+// Replace the page at 'va' with a copy of its first 'n' bytes, the rest
+// zeroed, mapped with 'perm'.
+static void
+mmap_copy(uintptr_t va, size_t n, int perm)
+{
+  802f7f:	55                   	push   %ebp
+  802f80:	89 e5                	mov    %esp,%ebp
+  802f82:	57                   	push   %edi
+  802f83:	56                   	push   %esi
+  802f84:	53                   	push   %ebx
+  802f85:	83 ec 10             	sub    $0x10,%esp
+  802f88:	89 c3                	mov    %eax,%ebx
+  802f8a:	89 d7                	mov    %edx,%edi
+  802f8c:	89 ce                	mov    %ecx,%esi
+  int r;
+
+  if ((r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  802f8e:	6a 07                	push   $0x7
+  802f90:	68 00 f0 7f 00       	push   $0x7ff000
+  802f95:	6a 00                	push   $0x0
+  802f97:	e8 a7 dd ff ff       	call   800d43 <sys_page_alloc>
+  802f9c:	83 c4 10             	add    $0x10,%esp
+  802f9f:	85 c0                	test   %eax,%eax
+  802fa1:	78 46                	js     802fe9 <mmap_copy+0x6a>
+    panic("mmap: %e", r);
+  memmove(PFTEMP, (void *) va, n);
+  802fa3:	83 ec 04             	sub    $0x4,%esp
+  802fa6:	57                   	push   %edi
+  802fa7:	53                   	push   %ebx
+  802fa8:	68 00 f0 7f 00       	push   $0x7ff000
+  802fad:	e8 e8 da ff ff       	call   800a9a <memmove>
+  if ((r = sys_page_map(0, PFTEMP, 0, (void *) va, perm)) < 0 ||
+  802fb2:	89 34 24             	mov    %esi,(%esp)
+  802fb5:	53                   	push   %ebx
+  802fb6:	6a 00                	push   $0x0
+  802fb8:	68 00 f0 7f 00       	push   $0x7ff000
+  802fbd:	6a 00                	push   $0x0
+  802fbf:	e8 c2 dd ff ff       	call   800d86 <sys_page_map>
+  802fc4:	83 c4 20             	add    $0x20,%esp
+  802fc7:	85 c0                	test   %eax,%eax
+  802fc9:	78 30                	js     802ffb <mmap_copy+0x7c>
+      (r = sys_page_unmap(0, PFTEMP)) < 0)
+  802fcb:	83 ec 08             	sub    $0x8,%esp
+  802fce:	68 00 f0 7f 00       	push   $0x7ff000
+  802fd3:	6a 00                	push   $0x0
+  802fd5:	e8 ee dd ff ff       	call   800dc8 <sys_page_unmap>
+  if ((r = sys_page_map(0, PFTEMP, 0, (void *) va, perm)) < 0 ||
+  802fda:	83 c4 10             	add    $0x10,%esp
+  802fdd:	85 c0                	test   %eax,%eax
+  802fdf:	78 1a                	js     802ffb <mmap_copy+0x7c>
+    panic("mmap: %e", r);
+}
+  802fe1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fe4:	5b                   	pop    %ebx
+  802fe5:	5e                   	pop    %esi
+  802fe6:	5f                   	pop    %edi
+  802fe7:	5d                   	pop    %ebp
+  802fe8:	c3                   	ret
+    panic("mmap: %e", r);
+  802fe9:	50                   	push   %eax
+  802fea:	68 d5 40 80 00       	push   $0x8040d5
+  802fef:	6a 3e                	push   $0x3e
+  802ff1:	68 de 40 80 00       	push   $0x8040de
+  802ff6:	e8 50 d2 ff ff       	call   80024b <_panic>
+    panic("mmap: %e", r);
+  802ffb:	50                   	push   %eax
+  802ffc:	68 d5 40 80 00       	push   $0x8040d5
+  803001:	6a 42                	push   $0x42
+  803003:	68 de 40 80 00       	push   $0x8040de
+  803008:	e8 3e d2 ff ff       	call   80024b <_panic>
+
+0080300d <mmap_fault>:
+// Handle a page fault in a mapping, if it is one.  Returns 1 if it was.
+// The fork page fault handlers call this first, so that mappings keep
+// working after a fork.
+bool
+mmap_fault(struct UTrapframe *utf)
+{
+  80300d:	55                   	push   %ebp
+  80300e:	89 e5                	mov    %esp,%ebp
+  803010:	57                   	push   %edi
+  803011:	56                   	push   %esi
+  803012:	53                   	push   %ebx
+  803013:	83 ec 1c             	sub    $0x1c,%esp
+  803016:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Fsreq_read_map saved;
+  struct Mmap *m;
+  uintptr_t va;
+  int perm, r;
+
+  va = ROUNDDOWN(utf->utf_fault_va, PGSIZE);
+  803019:	8b 1f                	mov    (%edi),%ebx
+  80301b:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if (va < MMAPBASE || va >= MMAPTOP || (m = mmap_find(va)) == NULL)
+  803021:	8d 83 00 00 00 60    	lea    0x60000000(%ebx),%eax
+  803027:	3d ff ff ff 2f       	cmp    $0x2fffffff,%eax
+  80302c:	0f 87 24 01 00 00    	ja     803156 <mmap_fault+0x149>
+  803032:	89 d8                	mov    %ebx,%eax
+  803034:	e8 db fe ff ff       	call   802f14 <mmap_find>
+  803039:	89 c6                	mov    %eax,%esi
+  80303b:	85 c0                	test   %eax,%eax
+  80303d:	0f 84 20 01 00 00    	je     803163 <mmap_fault+0x156>
+    return 0;
+  if ((utf->utf_err & FEC_WR) && m->mm_perm == MAP_RDONLY)
+  803043:	f6 47 04 02          	testb  $0x2,0x4(%edi)
+  803047:	74 13                	je     80305c <mmap_fault+0x4f>
+  803049:	83 78 10 00          	cmpl   $0x0,0x10(%eax)
+  80304d:	0f 84 17 01 00 00    	je     80316a <mmap_fault+0x15d>
+    return 0;
+  perm = PTE_P | PTE_U | (m->mm_perm == MAP_RDONLY ? 0 : PTE_W);
+  803053:	c7 45 e4 07 00 00 00 	movl   $0x7,-0x1c(%ebp)
+  80305a:	eb 0f                	jmp    80306b <mmap_fault+0x5e>
+  80305c:	83 78 10 01          	cmpl   $0x1,0x10(%eax)
+  803060:	19 c0                	sbb    %eax,%eax
+  803062:	83 e0 fe             	and    $0xfffffffe,%eax
+  803065:	83 c0 07             	add    $0x7,%eax
+  803068:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+
+  if (!va_mapped(va)) {
+  80306b:	89 d8                	mov    %ebx,%eax
+  80306d:	e8 e4 fe ff ff       	call   802f56 <va_mapped>
+  803072:	84 c0                	test   %al,%al
+  803074:	74 42                	je     8030b8 <mmap_fault+0xab>
+    }
+  }
+
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+    mmap_copy(va, PGSIZE, perm);
+  return 1;
+  803076:	b8 01 00 00 00       	mov    $0x1,%eax
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+  80307b:	f6 47 04 02          	testb  $0x2,0x4(%edi)
+  80307f:	0f 84 d6 00 00 00    	je     80315b <mmap_fault+0x14e>
+  803085:	89 d8                	mov    %ebx,%eax
+  803087:	c1 e8 0c             	shr    $0xc,%eax
+  80308a:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  return 1;
+  803091:	b8 01 00 00 00       	mov    $0x1,%eax
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+  803096:	f6 c2 02             	test   $0x2,%dl
+  803099:	0f 85 bc 00 00 00    	jne    80315b <mmap_fault+0x14e>
+    mmap_copy(va, PGSIZE, perm);
+  80309f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8030a2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8030a7:	89 d8                	mov    %ebx,%eax
+  8030a9:	e8 d1 fe ff ff       	call   802f7f <mmap_copy>
+  return 1;
+  8030ae:	b8 01 00 00 00       	mov    $0x1,%eax
+  8030b3:	e9 a3 00 00 00       	jmp    80315b <mmap_fault+0x14e>
+    saved = fsipcbuf.read_map;
+  8030b8:	a1 00 70 80 00       	mov    0x807000,%eax
+  8030bd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8030c0:	8b 15 04 70 80 00    	mov    0x807004,%edx
+  8030c6:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    r = read_map(m->mm_fd, m->mm_offset + (va - m->mm_va), (void *) va);
+  8030c9:	83 ec 04             	sub    $0x4,%esp
+  8030cc:	53                   	push   %ebx
+  8030cd:	89 d8                	mov    %ebx,%eax
+  8030cf:	03 46 0c             	add    0xc(%esi),%eax
+  8030d2:	2b 06                	sub    (%esi),%eax
+  8030d4:	50                   	push   %eax
+  8030d5:	ff 76 08             	push   0x8(%esi)
+  8030d8:	e8 35 f3 ff ff       	call   802412 <read_map>
+    fsipcbuf.read_map = saved;
+  8030dd:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8030e0:	89 0d 00 70 80 00    	mov    %ecx,0x807000
+  8030e6:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  8030e9:	89 15 04 70 80 00    	mov    %edx,0x807004
+    if (r < 0)
+  8030ef:	83 c4 10             	add    $0x10,%esp
+  8030f2:	85 c0                	test   %eax,%eax
+  8030f4:	78 20                	js     803116 <mmap_fault+0x109>
+    if (r == 0) {
+  8030f6:	74 30                	je     803128 <mmap_fault+0x11b>
+    if (r < PGSIZE) {
+  8030f8:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  8030fd:	0f 8f 73 ff ff ff    	jg     803076 <mmap_fault+0x69>
+      mmap_copy(va, r, perm);
+  803103:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803106:	89 c2                	mov    %eax,%edx
+  803108:	89 d8                	mov    %ebx,%eax
+  80310a:	e8 70 fe ff ff       	call   802f7f <mmap_copy>
+      return 1;
+  80310f:	b8 01 00 00 00       	mov    $0x1,%eax
+  803114:	eb 45                	jmp    80315b <mmap_fault+0x14e>
+      panic("mmap: read_map: %e", r);
+  803116:	50                   	push   %eax
+  803117:	68 e9 40 80 00       	push   $0x8040e9
+  80311c:	6a 5f                	push   $0x5f
+  80311e:	68 de 40 80 00       	push   $0x8040de
+  803123:	e8 23 d1 ff ff       	call   80024b <_panic>
+      if ((r = sys_page_alloc(0, (void *) va, perm)) < 0)
+  803128:	83 ec 04             	sub    $0x4,%esp
+  80312b:	ff 75 e4             	push   -0x1c(%ebp)
+  80312e:	53                   	push   %ebx
+  80312f:	6a 00                	push   $0x0
+  803131:	e8 0d dc ff ff       	call   800d43 <sys_page_alloc>
+  803136:	83 c4 10             	add    $0x10,%esp
+  803139:	85 c0                	test   %eax,%eax
+  80313b:	78 07                	js     803144 <mmap_fault+0x137>
+      return 1;
+  80313d:	b8 01 00 00 00       	mov    $0x1,%eax
+  803142:	eb 17                	jmp    80315b <mmap_fault+0x14e>
+        panic("mmap: %e", r);
+  803144:	50                   	push   %eax
+  803145:	68 d5 40 80 00       	push   $0x8040d5
+  80314a:	6a 64                	push   $0x64
+  80314c:	68 de 40 80 00       	push   $0x8040de
+  803151:	e8 f5 d0 ff ff       	call   80024b <_panic>
+    return 0;
+  803156:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80315b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80315e:	5b                   	pop    %ebx
+  80315f:	5e                   	pop    %esi
+  803160:	5f                   	pop    %edi
+  803161:	5d                   	pop    %ebp
+  803162:	c3                   	ret
+    return 0;
+  803163:	b8 00 00 00 00       	mov    $0x0,%eax
+  803168:	eb f1                	jmp    80315b <mmap_fault+0x14e>
+    return 0;
+  80316a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80316f:	eb ea                	jmp    80315b <mmap_fault+0x14e>
+
+00803171 <mmap_pgfault>:
+{
+  803171:	55                   	push   %ebp
+  803172:	89 e5                	mov    %esp,%ebp
+  803174:	53                   	push   %ebx
+  803175:	83 ec 10             	sub    $0x10,%esp
+  803178:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (!mmap_fault(utf))
+  80317b:	53                   	push   %ebx
+  80317c:	e8 8c fe ff ff       	call   80300d <mmap_fault>
+  803181:	83 c4 10             	add    $0x10,%esp
+  803184:	84 c0                	test   %al,%al
+  803186:	74 05                	je     80318d <mmap_pgfault+0x1c>
+}
+  803188:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80318b:	c9                   	leave
+  80318c:	c3                   	ret
+    panic("page fault at %08x, eip %08x, err %04x", utf->utf_fault_va,
+  80318d:	83 ec 08             	sub    $0x8,%esp
+  803190:	ff 73 04             	push   0x4(%ebx)
+  803193:	ff 73 28             	push   0x28(%ebx)
+  803196:	ff 33                	push   (%ebx)
+  803198:	68 fc 40 80 00       	push   $0x8040fc
+  80319d:	6a 20                	push   $0x20
+  80319f:	68 de 40 80 00       	push   $0x8040de
+  8031a4:	e8 a2 d0 ff ff       	call   80024b <_panic>
+
+008031a9 <mmap>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_INVAL if offset isn't aligned, len is 0, or perm is unknown
+//	-E_NO_MEM if there's no free slot or address space for it
+int
+mmap(int fdnum, off_t offset, size_t len, int perm, void **addr)
+{
+  8031a9:	55                   	push   %ebp
+  8031aa:	89 e5                	mov    %esp,%ebp
+  8031ac:	57                   	push   %edi
+  8031ad:	56                   	push   %esi
+  8031ae:	53                   	push   %ebx
+  8031af:	83 ec 44             	sub    $0x44,%esp
+  8031b2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  struct Fd *fd;
+  uintptr_t va;
+  int i, j, r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8031b5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8031b8:	50                   	push   %eax
+  8031b9:	ff 75 08             	push   0x8(%ebp)
+  8031bc:	e8 df e4 ff ff       	call   8016a0 <fd_lookup>
+  8031c1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8031c4:	83 c4 10             	add    $0x10,%esp
+  8031c7:	85 c0                	test   %eax,%eax
+  8031c9:	0f 88 3e 01 00 00    	js     80330d <mmap+0x164>
+    return r;
+  if (offset < 0 || PGOFF(offset) || len == 0 ||
+  8031cf:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8031d3:	0f 88 d1 00 00 00    	js     8032aa <mmap+0x101>
+  8031d9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8031dc:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8031e1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8031e4:	0f 85 c9 00 00 00    	jne    8032b3 <mmap+0x10a>
+  8031ea:	85 db                	test   %ebx,%ebx
+  8031ec:	0f 84 ca 00 00 00    	je     8032bc <mmap+0x113>
+  8031f2:	83 7d 14 02          	cmpl   $0x2,0x14(%ebp)
+  8031f6:	0f 87 c0 00 00 00    	ja     8032bc <mmap+0x113>
+      (perm != MAP_RDONLY && perm != MAP_PRIVATE && perm != MAP_SHARED))
+    return -E_INVAL;
+  len = ROUNDUP(len, PGSIZE);
+  8031fc:	81 c3 ff 0f 00 00    	add    $0xfff,%ebx
+  803202:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  803208:	89 d9                	mov    %ebx,%ecx
+  80320a:	89 5d c4             	mov    %ebx,-0x3c(%ebp)
+
+  // First fit: try the start of the region and the end of each
+  // mapping.
+  for (i = -1; i < NMMAP; i++) {
+  80320d:	bb 4c 67 80 00       	mov    $0x80674c,%ebx
+  803212:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+    if (i >= 0 && !mmaps[i].mm_va)
+      continue;
+    va = i < 0 ? MMAPBASE : mmaps[i].mm_va + mmaps[i].mm_len;
+  803217:	bf 00 00 00 a0       	mov    $0xa0000000,%edi
+  80321c:	eb 53                	jmp    803271 <mmap+0xc8>
+  80321e:	bf 00 00 00 a0       	mov    $0xa0000000,%edi
+  803223:	eb 4c                	jmp    803271 <mmap+0xc8>
+    if (len > MMAPTOP - va)
+      continue;
+    for (j = 0; j < NMMAP; j++)
+  803225:	83 c0 01             	add    $0x1,%eax
+  803228:	83 f8 10             	cmp    $0x10,%eax
+  80322b:	0f 84 e7 00 00 00    	je     803318 <mmap+0x16f>
+      if (mmaps[j].mm_va && va < mmaps[j].mm_va + mmaps[j].mm_len &&
+  803231:	8d 34 80             	lea    (%eax,%eax,4),%esi
+  803234:	8b 14 b5 60 67 80 00 	mov    0x806760(,%esi,4),%edx
+  80323b:	85 d2                	test   %edx,%edx
+  80323d:	74 e6                	je     803225 <mmap+0x7c>
+  80323f:	89 d1                	mov    %edx,%ecx
+  803241:	03 0c b5 64 67 80 00 	add    0x806764(,%esi,4),%ecx
+  803248:	39 cf                	cmp    %ecx,%edi
+  80324a:	73 d9                	jae    803225 <mmap+0x7c>
+  80324c:	39 da                	cmp    %ebx,%edx
+  80324e:	73 d5                	jae    803225 <mmap+0x7c>
+  803250:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  803253:	8b 55 cc             	mov    -0x34(%ebp),%edx
+  803256:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  for (i = -1; i < NMMAP; i++) {
+  803259:	83 c2 01             	add    $0x1,%edx
+  80325c:	83 c3 14             	add    $0x14,%ebx
+  80325f:	83 fa 10             	cmp    $0x10,%edx
+  803262:	74 2b                	je     80328f <mmap+0xe6>
+    if (i >= 0 && !mmaps[i].mm_va)
+  803264:	85 d2                	test   %edx,%edx
+  803266:	78 b6                	js     80321e <mmap+0x75>
+  803268:	8b 3b                	mov    (%ebx),%edi
+  80326a:	85 ff                	test   %edi,%edi
+  80326c:	74 eb                	je     803259 <mmap+0xb0>
+    va = i < 0 ? MMAPBASE : mmaps[i].mm_va + mmaps[i].mm_len;
+  80326e:	03 7b 04             	add    0x4(%ebx),%edi
+    if (len > MMAPTOP - va)
+  803271:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  803276:	29 f8                	sub    %edi,%eax
+  803278:	39 c8                	cmp    %ecx,%eax
+  80327a:	72 dd                	jb     803259 <mmap+0xb0>
+    for (j = 0; j < NMMAP; j++)
+  80327c:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+          mmaps[j].mm_va < va + len)
+  80327f:	8d 34 0f             	lea    (%edi,%ecx,1),%esi
+  803282:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  803285:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  803288:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+  80328b:	89 f3                	mov    %esi,%ebx
+  80328d:	eb a2                	jmp    803231 <mmap+0x88>
+        break;
+    if (j == NMMAP)
+      break;
+  }
+  if (i == NMMAP)
+    return -E_NO_MEM;
+  80328f:	c7 45 d4 fc ff ff ff 	movl   $0xfffffffc,-0x2c(%ebp)
+  803296:	eb 75                	jmp    80330d <mmap+0x164>
+    ;
+  if (j == NMMAP)
+    return -E_NO_MEM;
+
+  if (_pgfault_handler == 0)
+    set_pgfault_handler(mmap_pgfault);
+  803298:	83 ec 0c             	sub    $0xc,%esp
+  80329b:	68 71 31 80 00       	push   $0x803171
+  8032a0:	e8 f7 03 00 00       	call   80369c <set_pgfault_handler>
+  8032a5:	83 c4 10             	add    $0x10,%esp
+  8032a8:	eb 24                	jmp    8032ce <mmap+0x125>
+    return -E_INVAL;
+  8032aa:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  8032b1:	eb 5a                	jmp    80330d <mmap+0x164>
+  8032b3:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  8032ba:	eb 51                	jmp    80330d <mmap+0x164>
+  8032bc:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  8032c3:	eb 48                	jmp    80330d <mmap+0x164>
+  if (_pgfault_handler == 0)
+  8032c5:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  8032cc:	74 ca                	je     803298 <mmap+0xef>
+
+  mmaps[j].mm_va = va;
+  8032ce:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  8032d5:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  8032d8:	c1 e2 02             	shl    $0x2,%edx
+  8032db:	89 ba 60 67 80 00    	mov    %edi,0x806760(%edx)
+  mmaps[j].mm_len = len;
+  8032e1:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  8032e4:	89 b2 64 67 80 00    	mov    %esi,0x806764(%edx)
+  mmaps[j].mm_fd = fdnum;
+  8032ea:	8b 75 08             	mov    0x8(%ebp),%esi
+  8032ed:	89 b2 68 67 80 00    	mov    %esi,0x806768(%edx)
+  mmaps[j].mm_offset = offset;
+  8032f3:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8032f6:	89 b2 6c 67 80 00    	mov    %esi,0x80676c(%edx)
+  mmaps[j].mm_perm = perm;
+  8032fc:	01 d8                	add    %ebx,%eax
+  8032fe:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  803301:	89 1c 85 70 67 80 00 	mov    %ebx,0x806770(,%eax,4)
+  *addr = (void *) va;
+  803308:	8b 45 18             	mov    0x18(%ebp),%eax
+  80330b:	89 38                	mov    %edi,(%eax)
+  return 0;
+}
+  80330d:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  803310:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803313:	5b                   	pop    %ebx
+  803314:	5e                   	pop    %esi
+  803315:	5f                   	pop    %edi
+  803316:	5d                   	pop    %ebp
+  803317:	c3                   	ret
+  if (i == NMMAP)
+  803318:	b8 60 67 80 00       	mov    $0x806760,%eax
+  for (j = 0; j < NMMAP && mmaps[j].mm_va; j++)
+  80331d:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+  803320:	83 c0 14             	add    $0x14,%eax
+  803323:	83 78 ec 00          	cmpl   $0x0,-0x14(%eax)
+  803327:	74 9c                	je     8032c5 <mmap+0x11c>
+  803329:	83 c3 01             	add    $0x1,%ebx
+  80332c:	83 fb 10             	cmp    $0x10,%ebx
+  80332f:	75 ef                	jne    803320 <mmap+0x177>
+    return -E_NO_MEM;
+  803331:	c7 45 d4 fc ff ff ff 	movl   $0xfffffffc,-0x2c(%ebp)
+  803338:	eb d3                	jmp    80330d <mmap+0x164>
+
+0080333a <msync>:
+// nothing for other kinds of mapping.
+//
+// Returns 0 on success, < 0 on error.
+int
+msync(void *addr)
+{
+  80333a:	55                   	push   %ebp
+  80333b:	89 e5                	mov    %esp,%ebp
+  80333d:	57                   	push   %edi
+  80333e:	56                   	push   %esi
+  80333f:	53                   	push   %ebx
+  803340:	81 ec ac 00 00 00    	sub    $0xac,%esp
+  struct Stat st;
+  off_t saved, off;
+  uintptr_t va;
+  int n, r;
+
+  if ((m = mmap_find((uintptr_t) addr)) == NULL)
+  803346:	8b 45 08             	mov    0x8(%ebp),%eax
+  803349:	e8 c6 fb ff ff       	call   802f14 <mmap_find>
+  80334e:	85 c0                	test   %eax,%eax
+  803350:	0f 84 58 01 00 00    	je     8034ae <msync+0x174>
+  803356:	89 c7                	mov    %eax,%edi
+    return -E_INVAL;
+  if (m->mm_perm != MAP_SHARED)
+    return 0;
+  803358:	bb 00 00 00 00       	mov    $0x0,%ebx
+  if (m->mm_perm != MAP_SHARED)
+  80335d:	83 78 10 02          	cmpl   $0x2,0x10(%eax)
+  803361:	74 0a                	je     80336d <msync+0x33>
+                          PTE_P | PTE_U | PTE_W)) < 0)
+      break;
+  }
+  fd->fd_offset = saved;
+  return r < 0 ? r : 0;
+}
+  803363:	89 d8                	mov    %ebx,%eax
+  803365:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803368:	5b                   	pop    %ebx
+  803369:	5e                   	pop    %esi
+  80336a:	5f                   	pop    %edi
+  80336b:	5d                   	pop    %ebp
+  80336c:	c3                   	ret
+  if ((r = fd_lookup(m->mm_fd, &fd)) < 0 || (r = fstat(m->mm_fd, &st)) < 0)
+  80336d:	83 ec 08             	sub    $0x8,%esp
+  803370:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  803373:	50                   	push   %eax
+  803374:	ff 77 08             	push   0x8(%edi)
+  803377:	e8 24 e3 ff ff       	call   8016a0 <fd_lookup>
+  80337c:	89 c3                	mov    %eax,%ebx
+  80337e:	83 c4 10             	add    $0x10,%esp
+  803381:	85 c0                	test   %eax,%eax
+  803383:	78 de                	js     803363 <msync+0x29>
+  803385:	83 ec 08             	sub    $0x8,%esp
+  803388:	8d 85 58 ff ff ff    	lea    -0xa8(%ebp),%eax
+  80338e:	50                   	push   %eax
+  80338f:	ff 77 08             	push   0x8(%edi)
+  803392:	e8 ac e7 ff ff       	call   801b43 <fstat>
+  803397:	89 c3                	mov    %eax,%ebx
+  803399:	83 c4 10             	add    $0x10,%esp
+  80339c:	85 c0                	test   %eax,%eax
+  80339e:	78 c3                	js     803363 <msync+0x29>
+  saved = fd->fd_offset;
+  8033a0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8033a3:	8b 40 04             	mov    0x4(%eax),%eax
+  8033a6:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%ebp)
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE) {
+  8033ac:	8b 37                	mov    (%edi),%esi
+  8033ae:	eb 29                	jmp    8033d9 <msync+0x9f>
+    if ((r = sys_page_map(0, (void *) va, 0, (void *) va,
+  8033b0:	83 ec 0c             	sub    $0xc,%esp
+  8033b3:	6a 07                	push   $0x7
+  8033b5:	8b 85 50 ff ff ff    	mov    -0xb0(%ebp),%eax
+  8033bb:	50                   	push   %eax
+  8033bc:	6a 00                	push   $0x0
+  8033be:	50                   	push   %eax
+  8033bf:	6a 00                	push   $0x0
+  8033c1:	e8 c0 d9 ff ff       	call   800d86 <sys_page_map>
+  8033c6:	89 c3                	mov    %eax,%ebx
+  8033c8:	83 c4 20             	add    $0x20,%esp
+  8033cb:	85 c0                	test   %eax,%eax
+  8033cd:	0f 88 c0 00 00 00    	js     803493 <msync+0x159>
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE) {
+  8033d3:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8033d9:	8b 07                	mov    (%edi),%eax
+  8033db:	89 85 54 ff ff ff    	mov    %eax,-0xac(%ebp)
+  8033e1:	03 47 04             	add    0x4(%edi),%eax
+  8033e4:	39 c6                	cmp    %eax,%esi
+  8033e6:	0f 83 a7 00 00 00    	jae    803493 <msync+0x159>
+    if (!va_mapped(va) || !(uvpt[PGNUM(va)] & PTE_D))
+  8033ec:	89 f0                	mov    %esi,%eax
+  8033ee:	e8 63 fb ff ff       	call   802f56 <va_mapped>
+  8033f3:	84 c0                	test   %al,%al
+  8033f5:	74 dc                	je     8033d3 <msync+0x99>
+  8033f7:	89 f0                	mov    %esi,%eax
+  8033f9:	c1 e8 0c             	shr    $0xc,%eax
+  8033fc:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803403:	a8 40                	test   $0x40,%al
+  803405:	74 cc                	je     8033d3 <msync+0x99>
+    off = m->mm_offset + (va - m->mm_va);
+  803407:	8b 47 0c             	mov    0xc(%edi),%eax
+  80340a:	8b 8d 54 ff ff ff    	mov    -0xac(%ebp),%ecx
+  803410:	29 c8                	sub    %ecx,%eax
+  803412:	01 f0                	add    %esi,%eax
+    if (off >= st.st_size)
+  803414:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  803417:	39 c2                	cmp    %eax,%edx
+  803419:	7e 78                	jle    803493 <msync+0x159>
+    n = MIN(PGSIZE, st.st_size - off);
+  80341b:	29 c2                	sub    %eax,%edx
+  80341d:	89 d1                	mov    %edx,%ecx
+  80341f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803424:	39 d1                	cmp    %edx,%ecx
+  803426:	0f 4e d1             	cmovle %ecx,%edx
+  803429:	89 95 54 ff ff ff    	mov    %edx,-0xac(%ebp)
+    if ((r = seek(m->mm_fd, off)) < 0 ||
+  80342f:	83 ec 08             	sub    $0x8,%esp
+  803432:	50                   	push   %eax
+  803433:	ff 77 08             	push   0x8(%edi)
+  803436:	e8 60 e6 ff ff       	call   801a9b <seek>
+  80343b:	89 c3                	mov    %eax,%ebx
+  80343d:	83 c4 10             	add    $0x10,%esp
+  803440:	85 c0                	test   %eax,%eax
+  803442:	78 4f                	js     803493 <msync+0x159>
+        (r = write(m->mm_fd, (void *) va, n)) < 0)
+  803444:	89 b5 50 ff ff ff    	mov    %esi,-0xb0(%ebp)
+  80344a:	83 ec 04             	sub    $0x4,%esp
+  80344d:	ff b5 54 ff ff ff    	push   -0xac(%ebp)
+  803453:	56                   	push   %esi
+  803454:	ff 77 08             	push   0x8(%edi)
+  803457:	e8 bd e5 ff ff       	call   801a19 <write>
+  80345c:	89 c3                	mov    %eax,%ebx
+    if ((r = seek(m->mm_fd, off)) < 0 ||
+  80345e:	83 c4 10             	add    $0x10,%esp
+  803461:	85 c0                	test   %eax,%eax
+  803463:	78 2e                	js     803493 <msync+0x159>
+    if (r < n && (r = write(m->mm_fd, (char *) va + r, n - r)) < 0)
+  803465:	8b 95 54 ff ff ff    	mov    -0xac(%ebp),%edx
+  80346b:	39 c2                	cmp    %eax,%edx
+  80346d:	0f 8e 3d ff ff ff    	jle    8033b0 <msync+0x76>
+  803473:	89 d0                	mov    %edx,%eax
+  803475:	29 d8                	sub    %ebx,%eax
+  803477:	01 f3                	add    %esi,%ebx
+  803479:	83 ec 04             	sub    $0x4,%esp
+  80347c:	50                   	push   %eax
+  80347d:	53                   	push   %ebx
+  80347e:	ff 77 08             	push   0x8(%edi)
+  803481:	e8 93 e5 ff ff       	call   801a19 <write>
+  803486:	89 c3                	mov    %eax,%ebx
+  803488:	83 c4 10             	add    $0x10,%esp
+  80348b:	85 c0                	test   %eax,%eax
+  80348d:	0f 89 1d ff ff ff    	jns    8033b0 <msync+0x76>
+  fd->fd_offset = saved;
+  803493:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803496:	8b 8d 4c ff ff ff    	mov    -0xb4(%ebp),%ecx
+  80349c:	89 48 04             	mov    %ecx,0x4(%eax)
+  return r < 0 ? r : 0;
+  80349f:	85 db                	test   %ebx,%ebx
+  8034a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034a6:	0f 4f d8             	cmovg  %eax,%ebx
+  8034a9:	e9 b5 fe ff ff       	jmp    803363 <msync+0x29>
+    return -E_INVAL;
+  8034ae:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8034b3:	e9 ab fe ff ff       	jmp    803363 <msync+0x29>
+
+008034b8 <munmap>:
+// Remove the mapping at 'addr', writing a MAP_SHARED one back first.
+//
+// Returns 0 on success, < 0 on error.
+int
+munmap(void *addr)
+{
+  8034b8:	55                   	push   %ebp
+  8034b9:	89 e5                	mov    %esp,%ebp
+  8034bb:	56                   	push   %esi
+  8034bc:	53                   	push   %ebx
+  8034bd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct Mmap *m;
+  uintptr_t va;
+  int r;
+
+  if ((m = mmap_find((uintptr_t) addr)) == NULL)
+  8034c0:	89 d8                	mov    %ebx,%eax
+  8034c2:	e8 4d fa ff ff       	call   802f14 <mmap_find>
+  8034c7:	85 c0                	test   %eax,%eax
+  8034c9:	74 56                	je     803521 <munmap+0x69>
+  8034cb:	89 c6                	mov    %eax,%esi
+    return -E_INVAL;
+  if ((r = msync(addr)) < 0)
+  8034cd:	83 ec 0c             	sub    $0xc,%esp
+  8034d0:	53                   	push   %ebx
+  8034d1:	e8 64 fe ff ff       	call   80333a <msync>
+  8034d6:	83 c4 10             	add    $0x10,%esp
+  8034d9:	85 c0                	test   %eax,%eax
+  8034db:	78 3d                	js     80351a <munmap+0x62>
+    return r;
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE)
+  8034dd:	8b 1e                	mov    (%esi),%ebx
+  8034df:	eb 06                	jmp    8034e7 <munmap+0x2f>
+  8034e1:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8034e7:	8b 46 04             	mov    0x4(%esi),%eax
+  8034ea:	03 06                	add    (%esi),%eax
+  8034ec:	39 c3                	cmp    %eax,%ebx
+  8034ee:	73 1f                	jae    80350f <munmap+0x57>
+    if (va_mapped(va) && (r = sys_page_unmap(0, (void *) va)) < 0)
+  8034f0:	89 d8                	mov    %ebx,%eax
+  8034f2:	e8 5f fa ff ff       	call   802f56 <va_mapped>
+  8034f7:	84 c0                	test   %al,%al
+  8034f9:	74 e6                	je     8034e1 <munmap+0x29>
+  8034fb:	83 ec 08             	sub    $0x8,%esp
+  8034fe:	53                   	push   %ebx
+  8034ff:	6a 00                	push   $0x0
+  803501:	e8 c2 d8 ff ff       	call   800dc8 <sys_page_unmap>
+  803506:	83 c4 10             	add    $0x10,%esp
+  803509:	85 c0                	test   %eax,%eax
+  80350b:	79 d4                	jns    8034e1 <munmap+0x29>
+  80350d:	eb 0b                	jmp    80351a <munmap+0x62>
+      return r;
+  m->mm_va = 0;
+  80350f:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  return 0;
+  803515:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80351a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80351d:	5b                   	pop    %ebx
+  80351e:	5e                   	pop    %esi
+  80351f:	5d                   	pop    %ebp
+  803520:	c3                   	ret
+    return -E_INVAL;
+  803521:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803526:	eb f2                	jmp    80351a <munmap+0x62>
+
+00803528 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  803528:	b8 00 00 00 00       	mov    $0x0,%eax
+  80352d:	c3                   	ret
+
+0080352e <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80352e:	55                   	push   %ebp
+  80352f:	89 e5                	mov    %esp,%ebp
+  803531:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  803534:	68 23 41 80 00       	push   $0x804123
+  803539:	ff 75 0c             	push   0xc(%ebp)
+  80353c:	e8 d3 d3 ff ff       	call   800914 <strcpy>
+  return 0;
+}
+  803541:	b8 00 00 00 00       	mov    $0x0,%eax
+  803546:	c9                   	leave
+  803547:	c3                   	ret
+
+00803548 <devcons_write>:
+{
+  803548:	55                   	push   %ebp
+  803549:	89 e5                	mov    %esp,%ebp
+  80354b:	57                   	push   %edi
+  80354c:	56                   	push   %esi
+  80354d:	53                   	push   %ebx
+  80354e:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  803554:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  803559:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  80355f:	eb 2e                	jmp    80358f <devcons_write+0x47>
+    m = n - tot;
+  803561:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803564:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  803566:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80356b:	39 c3                	cmp    %eax,%ebx
+  80356d:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  803570:	83 ec 04             	sub    $0x4,%esp
+  803573:	53                   	push   %ebx
+  803574:	89 f0                	mov    %esi,%eax
+  803576:	03 45 0c             	add    0xc(%ebp),%eax
+  803579:	50                   	push   %eax
+  80357a:	57                   	push   %edi
+  80357b:	e8 1a d5 ff ff       	call   800a9a <memmove>
+    sys_cputs(buf, m);
+  803580:	83 c4 08             	add    $0x8,%esp
+  803583:	53                   	push   %ebx
+  803584:	57                   	push   %edi
+  803585:	e8 ba d6 ff ff       	call   800c44 <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  80358a:	01 de                	add    %ebx,%esi
+  80358c:	83 c4 10             	add    $0x10,%esp
+  80358f:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803592:	72 cd                	jb     803561 <devcons_write+0x19>
+}
+  803594:	89 f0                	mov    %esi,%eax
+  803596:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803599:	5b                   	pop    %ebx
+  80359a:	5e                   	pop    %esi
+  80359b:	5f                   	pop    %edi
+  80359c:	5d                   	pop    %ebp
+  80359d:	c3                   	ret
+
+0080359e <devcons_read>:
+{
+  80359e:	55                   	push   %ebp
+  80359f:	89 e5                	mov    %esp,%ebp
+  8035a1:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  8035a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035a9:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8035ad:	75 07                	jne    8035b6 <devcons_read+0x18>
+  8035af:	eb 1f                	jmp    8035d0 <devcons_read+0x32>
+    sys_yield();
+  8035b1:	e8 2b d7 ff ff       	call   800ce1 <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  8035b6:	e8 a7 d6 ff ff       	call   800c62 <sys_cgetc>
+  8035bb:	85 c0                	test   %eax,%eax
+  8035bd:	74 f2                	je     8035b1 <devcons_read+0x13>
+  if (c < 0)
+  8035bf:	78 0f                	js     8035d0 <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  8035c1:	83 f8 04             	cmp    $0x4,%eax
+  8035c4:	74 0c                	je     8035d2 <devcons_read+0x34>
+  *(char*)vbuf = c;
+  8035c6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8035c9:	88 02                	mov    %al,(%edx)
+  return 1;
+  8035cb:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8035d0:	c9                   	leave
+  8035d1:	c3                   	ret
+    return 0;
+  8035d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035d7:	eb f7                	jmp    8035d0 <devcons_read+0x32>
+
+008035d9 <cputchar>:
+{
+  8035d9:	55                   	push   %ebp
+  8035da:	89 e5                	mov    %esp,%ebp
+  8035dc:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  8035df:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035e2:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  8035e5:	6a 01                	push   $0x1
+  8035e7:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8035ea:	50                   	push   %eax
+  8035eb:	e8 54 d6 ff ff       	call   800c44 <sys_cputs>
+}
+  8035f0:	83 c4 10             	add    $0x10,%esp
+  8035f3:	c9                   	leave
+  8035f4:	c3                   	ret
+
+008035f5 <getchar>:
+{
+  8035f5:	55                   	push   %ebp
+  8035f6:	89 e5                	mov    %esp,%ebp
+  8035f8:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  8035fb:	6a 01                	push   $0x1
+  8035fd:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803600:	50                   	push   %eax
+  803601:	6a 00                	push   $0x0
+  803603:	e8 43 e3 ff ff       	call   80194b <read>
+  if (r < 0)
+  803608:	83 c4 10             	add    $0x10,%esp
+  80360b:	85 c0                	test   %eax,%eax
+  80360d:	78 06                	js     803615 <getchar+0x20>
+  if (r < 1)
+  80360f:	74 06                	je     803617 <getchar+0x22>
+  return c;
+  803611:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803615:	c9                   	leave
+  803616:	c3                   	ret
+    return -E_EOF;
+  803617:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80361c:	eb f7                	jmp    803615 <getchar+0x20>
+
+0080361e <iscons>:
+{
+  80361e:	55                   	push   %ebp
+  80361f:	89 e5                	mov    %esp,%ebp
+  803621:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803624:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803627:	50                   	push   %eax
+  803628:	ff 75 08             	push   0x8(%ebp)
+  80362b:	e8 70 e0 ff ff       	call   8016a0 <fd_lookup>
+  803630:	83 c4 10             	add    $0x10,%esp
+  803633:	85 c0                	test   %eax,%eax
+  803635:	78 11                	js     803648 <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  803637:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80363a:	8b 15 3c 50 80 00    	mov    0x80503c,%edx
+  803640:	39 10                	cmp    %edx,(%eax)
+  803642:	0f 94 c0             	sete   %al
+  803645:	0f b6 c0             	movzbl %al,%eax
+}
+  803648:	c9                   	leave
+  803649:	c3                   	ret
+
+0080364a <opencons>:
+{
+  80364a:	55                   	push   %ebp
+  80364b:	89 e5                	mov    %esp,%ebp
+  80364d:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  803650:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803653:	50                   	push   %eax
+  803654:	e8 f1 df ff ff       	call   80164a <fd_alloc>
+  803659:	83 c4 10             	add    $0x10,%esp
+  80365c:	85 c0                	test   %eax,%eax
+  80365e:	78 3a                	js     80369a <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803660:	83 ec 04             	sub    $0x4,%esp
+  803663:	68 07 04 00 00       	push   $0x407
+  803668:	ff 75 f4             	push   -0xc(%ebp)
+  80366b:	6a 00                	push   $0x0
+  80366d:	e8 d1 d6 ff ff       	call   800d43 <sys_page_alloc>
+  803672:	83 c4 10             	add    $0x10,%esp
+  803675:	85 c0                	test   %eax,%eax
+  803677:	78 21                	js     80369a <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  803679:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80367c:	8b 15 3c 50 80 00    	mov    0x80503c,%edx
+  803682:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  803684:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803687:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  80368e:	83 ec 0c             	sub    $0xc,%esp
+  803691:	50                   	push   %eax
+  803692:	e8 8f df ff ff       	call   801626 <fd2num>
+  803697:	83 c4 10             	add    $0x10,%esp
+}
+  80369a:	c9                   	leave
+  80369b:	c3                   	ret
+
+0080369c <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  80369c:	55                   	push   %ebp
+  80369d:	89 e5                	mov    %esp,%ebp
+  80369f:	53                   	push   %ebx
+  8036a0:	83 ec 04             	sub    $0x4,%esp
+  int r;
+
+  if (_pgfault_handler == 0) {
+  8036a3:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  8036aa:	74 0d                	je     8036b9 <set_pgfault_handler+0x1d>
+
+    sys_env_set_pgfault_upcall(id, _pgfault_upcall);
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  8036ac:	8b 45 08             	mov    0x8(%ebp),%eax
+  8036af:	a3 00 80 80 00       	mov    %eax,0x808000
+}
+  8036b4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8036b7:	c9                   	leave
+  8036b8:	c3                   	ret
+    envid_t id = sys_getenvid();
+  8036b9:	e8 04 d6 ff ff       	call   800cc2 <sys_getenvid>
+  8036be:	89 c3                	mov    %eax,%ebx
+    sys_page_alloc(id, (void *) (UXSTACKTOP - PGSIZE), (PTE_P | PTE_U | PTE_W));
+  8036c0:	83 ec 04             	sub    $0x4,%esp
+  8036c3:	6a 07                	push   $0x7
+  8036c5:	68 00 f0 bf ee       	push   $0xeebff000
+  8036ca:	50                   	push   %eax
+  8036cb:	e8 73 d6 ff ff       	call   800d43 <sys_page_alloc>
+    sys_env_set_pgfault_upcall(id, _pgfault_upcall);
+  8036d0:	83 c4 08             	add    $0x8,%esp
+  8036d3:	68 e3 36 80 00       	push   $0x8036e3
+  8036d8:	53                   	push   %ebx
+  8036d9:	e8 da d8 ff ff       	call   800fb8 <sys_env_set_pgfault_upcall>
+  8036de:	83 c4 10             	add    $0x10,%esp
+  8036e1:	eb c9                	jmp    8036ac <set_pgfault_handler+0x10>
+
+008036e3 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8036e3:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8036e4:	a1 00 80 80 00       	mov    0x808000,%eax
+	call *%eax
+  8036e9:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8036eb:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+  movl 48(%esp), %eax       // move trap time esp to eax
+  8036ee:	8b 44 24 30          	mov    0x30(%esp),%eax
+  subl $4, %eax             // make room for eip on trap time esp
+  8036f2:	83 e8 04             	sub    $0x4,%eax
+  movl %eax, 48(%esp)       // move value to esp
+  8036f5:	89 44 24 30          	mov    %eax,0x30(%esp)
+  movl 40(%esp), %ebx       // move trap time eip to ebx
+  8036f9:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+  movl %ebx, 0(%eax)
+  8036fd:	89 18                	mov    %ebx,(%eax)
+
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+  addl $0x08,%esp
+  8036ff:	83 c4 08             	add    $0x8,%esp
+  popal
+  803702:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+  addl $4, %esp          // skip tf->eip
+  803703:	83 c4 04             	add    $0x4,%esp
+  popf                 // pop stack value into flags register
+  803706:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+  popl %esp
+  803707:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+  ret
+  803708:	c3                   	ret
+
+00803709 <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  803709:	55                   	push   %ebp
+  80370a:	89 e5                	mov    %esp,%ebp
+  80370c:	57                   	push   %edi
+  80370d:	56                   	push   %esi
+  80370e:	53                   	push   %ebx
+  80370f:	83 ec 14             	sub    $0x14,%esp
+  803712:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803715:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803718:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80371b:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  80371e:	85 c0                	test   %eax,%eax
+  803720:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803725:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  803728:	ff 33                	push   (%ebx)
+  80372a:	50                   	push   %eax
+  80372b:	e8 eb d8 ff ff       	call   80101b <sys_ipc_recv>
+  803730:	83 c4 10             	add    $0x10,%esp
+  803733:	85 c0                	test   %eax,%eax
+  803735:	78 39                	js     803770 <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  803737:	85 ff                	test   %edi,%edi
+  803739:	74 0a                	je     803745 <ipc_recv_pages+0x3c>
+  80373b:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  803740:	8b 40 7c             	mov    0x7c(%eax),%eax
+  803743:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803745:	85 f6                	test   %esi,%esi
+  803747:	74 0d                	je     803756 <ipc_recv_pages+0x4d>
+  803749:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  80374e:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  803754:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  803756:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  80375b:	8b 40 74             	mov    0x74(%eax),%eax
+  80375e:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  803760:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  803765:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  803768:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80376b:	5b                   	pop    %ebx
+  80376c:	5e                   	pop    %esi
+  80376d:	5f                   	pop    %edi
+  80376e:	5d                   	pop    %ebp
+  80376f:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  803770:	85 ff                	test   %edi,%edi
+  803772:	74 06                	je     80377a <ipc_recv_pages+0x71>
+  803774:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  80377a:	85 f6                	test   %esi,%esi
+  80377c:	74 06                	je     803784 <ipc_recv_pages+0x7b>
+  80377e:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  803784:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  80378a:	eb dc                	jmp    803768 <ipc_recv_pages+0x5f>
+
+0080378c <ipc_recv>:
+{
+  80378c:	55                   	push   %ebp
+  80378d:	89 e5                	mov    %esp,%ebp
+  80378f:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  803792:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  803799:	ff 75 10             	push   0x10(%ebp)
+  80379c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80379f:	50                   	push   %eax
+  8037a0:	ff 75 0c             	push   0xc(%ebp)
+  8037a3:	ff 75 08             	push   0x8(%ebp)
+  8037a6:	e8 5e ff ff ff       	call   803709 <ipc_recv_pages>
+}
+  8037ab:	c9                   	leave
+  8037ac:	c3                   	ret
+
+008037ad <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  8037ad:	55                   	push   %ebp
+  8037ae:	89 e5                	mov    %esp,%ebp
+  8037b0:	57                   	push   %edi
+  8037b1:	56                   	push   %esi
+  8037b2:	53                   	push   %ebx
+  8037b3:	83 ec 0c             	sub    $0xc,%esp
+  8037b6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8037b9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8037bc:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  8037bf:	89 c3                	mov    %eax,%ebx
+  8037c1:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  8037c7:	85 c0                	test   %eax,%eax
+  8037c9:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8037ce:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  8037d1:	83 ec 0c             	sub    $0xc,%esp
+  8037d4:	ff 75 14             	push   0x14(%ebp)
+  8037d7:	ff 75 18             	push   0x18(%ebp)
+  8037da:	53                   	push   %ebx
+  8037db:	56                   	push   %esi
+  8037dc:	57                   	push   %edi
+  8037dd:	e8 18 d8 ff ff       	call   800ffa <sys_ipc_try_send>
+  8037e2:	83 c4 20             	add    $0x20,%esp
+  8037e5:	85 c0                	test   %eax,%eax
+  8037e7:	79 1e                	jns    803807 <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  8037e9:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8037ec:	75 07                	jne    8037f5 <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  8037ee:	e8 ee d4 ff ff       	call   800ce1 <sys_yield>
+  8037f3:	eb dc                	jmp    8037d1 <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  8037f5:	50                   	push   %eax
+  8037f6:	68 2f 41 80 00       	push   $0x80412f
+  8037fb:	6a 5c                	push   $0x5c
+  8037fd:	68 3c 41 80 00       	push   $0x80413c
+  803802:	e8 44 ca ff ff       	call   80024b <_panic>
+  }
+}
+  803807:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80380a:	5b                   	pop    %ebx
+  80380b:	5e                   	pop    %esi
+  80380c:	5f                   	pop    %edi
+  80380d:	5d                   	pop    %ebp
+  80380e:	c3                   	ret
+
+0080380f <ipc_send>:
+{
+  80380f:	55                   	push   %ebp
+  803810:	89 e5                	mov    %esp,%ebp
+  803812:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  803815:	ff 75 14             	push   0x14(%ebp)
+  803818:	6a 01                	push   $0x1
+  80381a:	ff 75 10             	push   0x10(%ebp)
+  80381d:	ff 75 0c             	push   0xc(%ebp)
+  803820:	ff 75 08             	push   0x8(%ebp)
+  803823:	e8 85 ff ff ff       	call   8037ad <ipc_send_pages>
+}
+  803828:	83 c4 20             	add    $0x20,%esp
+  80382b:	c9                   	leave
+  80382c:	c3                   	ret
+
+0080382d <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80382d:	55                   	push   %ebp
+  80382e:	89 e5                	mov    %esp,%ebp
+  803830:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  803833:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  803838:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80383b:	c1 e0 04             	shl    $0x4,%eax
+  80383e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803843:	8b 40 50             	mov    0x50(%eax),%eax
+  803846:	39 c8                	cmp    %ecx,%eax
+  803848:	74 12                	je     80385c <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  80384a:	83 c2 01             	add    $0x1,%edx
+  80384d:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  803853:	75 e3                	jne    803838 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  803855:	b8 00 00 00 00       	mov    $0x0,%eax
+  80385a:	eb 0e                	jmp    80386a <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  80385c:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80385f:	c1 e0 04             	shl    $0x4,%eax
+  803862:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803867:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  80386a:	5d                   	pop    %ebp
+  80386b:	c3                   	ret
+
+0080386c <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80386c:	55                   	push   %ebp
+  80386d:	89 e5                	mov    %esp,%ebp
+  80386f:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  803872:	89 c2                	mov    %eax,%edx
+  803874:	c1 ea 16             	shr    $0x16,%edx
+  803877:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  80387e:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  803883:	f6 c1 01             	test   $0x1,%cl
+  803886:	74 1c                	je     8038a4 <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  803888:	c1 e8 0c             	shr    $0xc,%eax
+  80388b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  803892:	a8 01                	test   $0x1,%al
+  803894:	74 0e                	je     8038a4 <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  803896:	c1 e8 0c             	shr    $0xc,%eax
+  803899:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  8038a0:	ef 
+  8038a1:	0f b7 d2             	movzwl %dx,%edx
+}
+  8038a4:	89 d0                	mov    %edx,%eax
+  8038a6:	5d                   	pop    %ebp
+  8038a7:	c3                   	ret
+
+008038a8 <udivmod>:
+  8038a8:	55                   	push   %ebp
+  8038a9:	57                   	push   %edi
+  8038aa:	56                   	push   %esi
+  8038ab:	53                   	push   %ebx
+  8038ac:	83 ec 14             	sub    $0x14,%esp
+  8038af:	8b 74 24 28          	mov    0x28(%esp),%esi
+  8038b3:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  8038b7:	89 fb                	mov    %edi,%ebx
+  8038b9:	09 f3                	or     %esi,%ebx
+  8038bb:	0f 84 88 00 00 00    	je     803949 <udivmod+0xa1>
+  8038c1:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8038c6:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8038cd:	00 
+  8038ce:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8038d5:	00 
+  8038d6:	89 cd                	mov    %ecx,%ebp
+  8038d8:	89 34 24             	mov    %esi,(%esp)
+  8038db:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  8038df:	eb 08                	jmp    8038e9 <udivmod+0x41>
+  8038e1:	83 ed 01             	sub    $0x1,%ebp
+  8038e4:	83 fd ff             	cmp    $0xffffffff,%ebp
+  8038e7:	74 6c                	je     803955 <udivmod+0xad>
+  8038e9:	89 c3                	mov    %eax,%ebx
+  8038eb:	89 d6                	mov    %edx,%esi
+  8038ed:	89 e9                	mov    %ebp,%ecx
+  8038ef:	0f ad f3             	shrd   %cl,%esi,%ebx
+  8038f2:	d3 ee                	shr    %cl,%esi
+  8038f4:	f6 c1 20             	test   $0x20,%cl
+  8038f7:	74 04                	je     8038fd <udivmod+0x55>
+  8038f9:	89 f3                	mov    %esi,%ebx
+  8038fb:	31 f6                	xor    %esi,%esi
+  8038fd:	8b 3c 24             	mov    (%esp),%edi
+  803900:	39 fb                	cmp    %edi,%ebx
+  803902:	89 f7                	mov    %esi,%edi
+  803904:	8b 1c 24             	mov    (%esp),%ebx
+  803907:	8b 74 24 04          	mov    0x4(%esp),%esi
+  80390b:	19 f7                	sbb    %esi,%edi
+  80390d:	72 d2                	jb     8038e1 <udivmod+0x39>
+  80390f:	89 f7                	mov    %esi,%edi
+  803911:	89 de                	mov    %ebx,%esi
+  803913:	89 e9                	mov    %ebp,%ecx
+  803915:	0f a5 f7             	shld   %cl,%esi,%edi
+  803918:	d3 e6                	shl    %cl,%esi
+  80391a:	f6 c1 20             	test   $0x20,%cl
+  80391d:	74 04                	je     803923 <udivmod+0x7b>
+  80391f:	89 f7                	mov    %esi,%edi
+  803921:	31 f6                	xor    %esi,%esi
+  803923:	29 f0                	sub    %esi,%eax
+  803925:	19 fa                	sbb    %edi,%edx
+  803927:	be 01 00 00 00       	mov    $0x1,%esi
+  80392c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803931:	0f a5 f7             	shld   %cl,%esi,%edi
+  803934:	d3 e6                	shl    %cl,%esi
+  803936:	f6 c1 20             	test   $0x20,%cl
+  803939:	74 04                	je     80393f <udivmod+0x97>
+  80393b:	89 f7                	mov    %esi,%edi
+  80393d:	31 f6                	xor    %esi,%esi
+  80393f:	09 74 24 08          	or     %esi,0x8(%esp)
+  803943:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  803947:	eb 98                	jmp    8038e1 <udivmod+0x39>
+  803949:	89 f0                	mov    %esi,%eax
+  80394b:	89 fa                	mov    %edi,%edx
+  80394d:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803951:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  803955:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  803959:	89 01                	mov    %eax,(%ecx)
+  80395b:	89 51 04             	mov    %edx,0x4(%ecx)
+  80395e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803962:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803966:	83 c4 14             	add    $0x14,%esp
+  803969:	5b                   	pop    %ebx
+  80396a:	5e                   	pop    %esi
+  80396b:	5f                   	pop    %edi
+  80396c:	5d                   	pop    %ebp
+  80396d:	c3                   	ret
+
+0080396e <__udivdi3>:
+  80396e:	83 ec 18             	sub    $0x18,%esp
+  803971:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803975:	50                   	push   %eax
+  803976:	ff 74 24 2c          	push   0x2c(%esp)
+  80397a:	ff 74 24 2c          	push   0x2c(%esp)
+  80397e:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803982:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803986:	e8 1d ff ff ff       	call   8038a8 <udivmod>
+  80398b:	83 c4 24             	add    $0x24,%esp
+  80398e:	c3                   	ret
+
+0080398f <__umoddi3>:
+  80398f:	83 ec 18             	sub    $0x18,%esp
+  803992:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803996:	50                   	push   %eax
+  803997:	ff 74 24 2c          	push   0x2c(%esp)
+  80399b:	ff 74 24 2c          	push   0x2c(%esp)
+  80399f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8039a3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8039a7:	e8 fc fe ff ff       	call   8038a8 <udivmod>
+  8039ac:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8039b0:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8039b4:	83 c4 24             	add    $0x24,%esp
+  8039b7:	c3                   	ret
+
+008039b8 <__divdi3>:
+  8039b8:	56                   	push   %esi
+  8039b9:	53                   	push   %ebx
+  8039ba:	83 ec 14             	sub    $0x14,%esp
+  8039bd:	8b 44 24 20          	mov    0x20(%esp),%eax
+  8039c1:	8b 54 24 24          	mov    0x24(%esp),%edx
+  8039c5:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  8039c9:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  8039cd:	85 d2                	test   %edx,%edx
+  8039cf:	78 18                	js     8039e9 <__divdi3+0x31>
+  8039d1:	85 db                	test   %ebx,%ebx
+  8039d3:	78 3e                	js     803a13 <__divdi3+0x5b>
+  8039d5:	83 ec 04             	sub    $0x4,%esp
+  8039d8:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8039dc:	56                   	push   %esi
+  8039dd:	53                   	push   %ebx
+  8039de:	51                   	push   %ecx
+  8039df:	e8 c4 fe ff ff       	call   8038a8 <udivmod>
+  8039e4:	83 c4 10             	add    $0x10,%esp
+  8039e7:	eb 24                	jmp    803a0d <__divdi3+0x55>
+  8039e9:	f7 d8                	neg    %eax
+  8039eb:	83 d2 00             	adc    $0x0,%edx
+  8039ee:	f7 da                	neg    %edx
+  8039f0:	85 db                	test   %ebx,%ebx
+  8039f2:	78 3a                	js     803a2e <__divdi3+0x76>
+  8039f4:	83 ec 04             	sub    $0x4,%esp
+  8039f7:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8039fb:	56                   	push   %esi
+  8039fc:	53                   	push   %ebx
+  8039fd:	51                   	push   %ecx
+  8039fe:	e8 a5 fe ff ff       	call   8038a8 <udivmod>
+  803a03:	83 c4 10             	add    $0x10,%esp
+  803a06:	f7 d8                	neg    %eax
+  803a08:	83 d2 00             	adc    $0x0,%edx
+  803a0b:	f7 da                	neg    %edx
+  803a0d:	83 c4 14             	add    $0x14,%esp
+  803a10:	5b                   	pop    %ebx
+  803a11:	5e                   	pop    %esi
+  803a12:	c3                   	ret
+  803a13:	83 ec 04             	sub    $0x4,%esp
+  803a16:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803a1a:	56                   	push   %esi
+  803a1b:	f7 d9                	neg    %ecx
+  803a1d:	83 d3 00             	adc    $0x0,%ebx
+  803a20:	f7 db                	neg    %ebx
+  803a22:	53                   	push   %ebx
+  803a23:	51                   	push   %ecx
+  803a24:	e8 7f fe ff ff       	call   8038a8 <udivmod>
+  803a29:	83 c4 10             	add    $0x10,%esp
+  803a2c:	eb d8                	jmp    803a06 <__divdi3+0x4e>
+  803a2e:	83 ec 04             	sub    $0x4,%esp
+  803a31:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803a35:	56                   	push   %esi
+  803a36:	f7 d9                	neg    %ecx
+  803a38:	83 d3 00             	adc    $0x0,%ebx
+  803a3b:	f7 db                	neg    %ebx
+  803a3d:	53                   	push   %ebx
+  803a3e:	51                   	push   %ecx
+  803a3f:	e8 64 fe ff ff       	call   8038a8 <udivmod>
+  803a44:	83 c4 10             	add    $0x10,%esp
+  803a47:	eb c4                	jmp    803a0d <__divdi3+0x55>
+
+00803a49 <__moddi3>:
+  803a49:	55                   	push   %ebp
+  803a4a:	57                   	push   %edi
+  803a4b:	56                   	push   %esi
+  803a4c:	53                   	push   %ebx
+  803a4d:	83 ec 24             	sub    $0x24,%esp
+  803a50:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803a54:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803a58:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  803a5c:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  803a60:	85 d2                	test   %edx,%edx
+  803a62:	78 3b                	js     803a9f <__moddi3+0x56>
+  803a64:	83 ec 04             	sub    $0x4,%esp
+  803a67:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803a6b:	56                   	push   %esi
+  803a6c:	89 ce                	mov    %ecx,%esi
+  803a6e:	f7 de                	neg    %esi
+  803a70:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803a74:	89 de                	mov    %ebx,%esi
+  803a76:	83 d6 00             	adc    $0x0,%esi
+  803a79:	f7 de                	neg    %esi
+  803a7b:	89 74 24 14          	mov    %esi,0x14(%esp)
+  803a7f:	8b 74 24 08          	mov    0x8(%esp),%esi
+  803a83:	0f 48 f1             	cmovs  %ecx,%esi
+  803a86:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  803a8b:	53                   	push   %ebx
+  803a8c:	56                   	push   %esi
+  803a8d:	e8 16 fe ff ff       	call   8038a8 <udivmod>
+  803a92:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803a96:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803a9a:	83 c4 10             	add    $0x10,%esp
+  803a9d:	eb 47                	jmp    803ae6 <__moddi3+0x9d>
+  803a9f:	f7 d8                	neg    %eax
+  803aa1:	83 d2 00             	adc    $0x0,%edx
+  803aa4:	f7 da                	neg    %edx
+  803aa6:	83 ec 04             	sub    $0x4,%esp
+  803aa9:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803aad:	56                   	push   %esi
+  803aae:	89 cf                	mov    %ecx,%edi
+  803ab0:	f7 df                	neg    %edi
+  803ab2:	89 de                	mov    %ebx,%esi
+  803ab4:	83 d6 00             	adc    $0x0,%esi
+  803ab7:	f7 de                	neg    %esi
+  803ab9:	0f 49 cf             	cmovns %edi,%ecx
+  803abc:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  803ac0:	0f 49 de             	cmovns %esi,%ebx
+  803ac3:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  803ac7:	ff 74 24 0c          	push   0xc(%esp)
+  803acb:	ff 74 24 0c          	push   0xc(%esp)
+  803acf:	e8 d4 fd ff ff       	call   8038a8 <udivmod>
+  803ad4:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803ad8:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803adc:	f7 d8                	neg    %eax
+  803ade:	83 d2 00             	adc    $0x0,%edx
+  803ae1:	f7 da                	neg    %edx
+  803ae3:	83 c4 10             	add    $0x10,%esp
+  803ae6:	83 c4 24             	add    $0x24,%esp
+  803ae9:	5b                   	pop    %ebx
+  803aea:	5e                   	pop    %esi
+  803aeb:	5f                   	pop    %edi
+  803aec:	5d                   	pop    %ebp
+  803aed:	c3                   	ret
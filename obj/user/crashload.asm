@@ -0,0 +1,6687 @@
+
+obj/user/crashload.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 53 03 00 00       	call   800384 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <rand>:
+static uint32_t seed;
+
+static uint32_t
+rand(void)
+{
+  seed = seed * 1103515245 + 12345;
+  800033:	69 05 00 50 80 00 6d 	imul   $0x41c64e6d,0x805000,%eax
+  80003a:	4e c6 41 
+  80003d:	05 39 30 00 00       	add    $0x3039,%eax
+  800042:	a3 00 50 80 00       	mov    %eax,0x805000
+  return seed >> 8;
+  800047:	c1 e8 08             	shr    $0x8,%eax
+}
+  80004a:	c3                   	ret
+
+0080004b <append>:
+
+// Append 'n' blocks to the open file 'fd'.
+static void
+append(int fd, int n)
+{
+  80004b:	55                   	push   %ebp
+  80004c:	89 e5                	mov    %esp,%ebp
+  80004e:	56                   	push   %esi
+  80004f:	53                   	push   %ebx
+  800050:	81 ec 98 00 00 00    	sub    $0x98,%esp
+  800056:	89 c6                	mov    %eax,%esi
+  800058:	89 d3                	mov    %edx,%ebx
+  struct Stat st;
+  int r;
+
+  if ((r = fstat(fd, &st)) < 0)
+  80005a:	8d 85 6c ff ff ff    	lea    -0x94(%ebp),%eax
+  800060:	50                   	push   %eax
+  800061:	56                   	push   %esi
+  800062:	e8 4e 18 00 00       	call   8018b5 <fstat>
+  800067:	83 c4 10             	add    $0x10,%esp
+  80006a:	85 c0                	test   %eax,%eax
+  80006c:	78 39                	js     8000a7 <append+0x5c>
+    panic("fstat: %e", r);
+  if ((r = seek(fd, st.st_size)) < 0)
+  80006e:	83 ec 08             	sub    $0x8,%esp
+  800071:	ff 75 ec             	push   -0x14(%ebp)
+  800074:	56                   	push   %esi
+  800075:	e8 93 17 00 00       	call   80180d <seek>
+  80007a:	83 c4 10             	add    $0x10,%esp
+  80007d:	85 c0                	test   %eax,%eax
+  80007f:	78 38                	js     8000b9 <append+0x6e>
+    panic("seek: %e", r);
+  for (; n > 0; n--)
+  800081:	85 db                	test   %ebx,%ebx
+  800083:	7e 58                	jle    8000dd <append+0x92>
+    if ((r = write(fd, buf, BLKSIZE)) != BLKSIZE)
+  800085:	83 ec 04             	sub    $0x4,%esp
+  800088:	68 00 10 00 00       	push   $0x1000
+  80008d:	68 20 50 80 00       	push   $0x805020
+  800092:	56                   	push   %esi
+  800093:	e8 f3 16 00 00       	call   80178b <write>
+  800098:	83 c4 10             	add    $0x10,%esp
+  80009b:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8000a0:	75 29                	jne    8000cb <append+0x80>
+  for (; n > 0; n--)
+  8000a2:	83 eb 01             	sub    $0x1,%ebx
+  8000a5:	eb da                	jmp    800081 <append+0x36>
+    panic("fstat: %e", r);
+  8000a7:	50                   	push   %eax
+  8000a8:	68 a0 31 80 00       	push   $0x8031a0
+  8000ad:	6a 1f                	push   $0x1f
+  8000af:	68 aa 31 80 00       	push   $0x8031aa
+  8000b4:	e8 38 03 00 00       	call   8003f1 <_panic>
+    panic("seek: %e", r);
+  8000b9:	50                   	push   %eax
+  8000ba:	68 bb 31 80 00       	push   $0x8031bb
+  8000bf:	6a 21                	push   $0x21
+  8000c1:	68 aa 31 80 00       	push   $0x8031aa
+  8000c6:	e8 26 03 00 00       	call   8003f1 <_panic>
+      panic("write: %e", r);
+  8000cb:	50                   	push   %eax
+  8000cc:	68 c4 31 80 00       	push   $0x8031c4
+  8000d1:	6a 24                	push   $0x24
+  8000d3:	68 aa 31 80 00       	push   $0x8031aa
+  8000d8:	e8 14 03 00 00       	call   8003f1 <_panic>
+}
+  8000dd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000e0:	5b                   	pop    %ebx
+  8000e1:	5e                   	pop    %esi
+  8000e2:	5d                   	pop    %ebp
+  8000e3:	c3                   	ret
+
+008000e4 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8000e4:	55                   	push   %ebp
+  8000e5:	89 e5                	mov    %esp,%ebp
+  8000e7:	57                   	push   %edi
+  8000e8:	56                   	push   %esi
+  8000e9:	53                   	push   %ebx
+  8000ea:	81 ec 1c 01 00 00    	sub    $0x11c,%esp
+  char name[MAXNAMELEN];
+  struct Stat st;
+  int fd, round, r;
+
+  binaryname = "crashload";
+  8000f0:	c7 05 00 40 80 00 ce 	movl   $0x8031ce,0x804000
+  8000f7:	31 80 00 
+  seed = argc > 1 ? strtol(argv[1], 0, 0) : sys_time_msec();
+  8000fa:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+  8000fe:	7e 38                	jle    800138 <umain+0x54>
+  800100:	83 ec 04             	sub    $0x4,%esp
+  800103:	6a 00                	push   $0x0
+  800105:	6a 00                	push   $0x0
+  800107:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80010a:	ff 70 04             	push   0x4(%eax)
+  80010d:	e8 fc 0b 00 00       	call   800d0e <strtol>
+  800112:	83 c4 10             	add    $0x10,%esp
+  800115:	a3 00 50 80 00       	mov    %eax,0x805000
+  cprintf("crashload: running, seed %d\n", seed);
+  80011a:	83 ec 08             	sub    $0x8,%esp
+  80011d:	50                   	push   %eax
+  80011e:	68 d8 31 80 00       	push   $0x8031d8
+  800123:	e8 a4 03 00 00       	call   8004cc <cprintf>
+  800128:	83 c4 10             	add    $0x10,%esp
+
+  for (round = 0; ; round++) {
+  80012b:	bb 00 00 00 00       	mov    $0x0,%ebx
+    snprintf(name, sizeof(name), "/crash%d", rand() % NFILES);
+  800130:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  800136:	eb 6f                	jmp    8001a7 <umain+0xc3>
+  seed = argc > 1 ? strtol(argv[1], 0, 0) : sys_time_msec();
+  800138:	e8 c6 10 00 00       	call   801203 <sys_time_msec>
+  80013d:	eb d6                	jmp    800115 <umain+0x31>
+    memset(buf, round, sizeof(buf));
+
+    switch (rand() % 4) {
+    case 0:   // rewrite
+      if ((fd = open(name, O_RDWR | O_CREAT | O_TRUNC)) < 0)
+  80013f:	83 ec 08             	sub    $0x8,%esp
+  800142:	68 02 03 00 00       	push   $0x302
+  800147:	57                   	push   %edi
+  800148:	e8 9b 1d 00 00       	call   801ee8 <open>
+  80014d:	89 c6                	mov    %eax,%esi
+  80014f:	83 c4 10             	add    $0x10,%esp
+  800152:	85 c0                	test   %eax,%eax
+  800154:	0f 88 b5 00 00 00    	js     80020f <umain+0x12b>
+        panic("open %s: %e", name, fd);
+      append(fd, rand() % MAXBLOCKS);
+  80015a:	e8 d4 fe ff ff       	call   800033 <rand>
+  80015f:	89 c1                	mov    %eax,%ecx
+  800161:	ba ab aa aa aa       	mov    $0xaaaaaaab,%edx
+  800166:	f7 e2                	mul    %edx
+  800168:	c1 ea 04             	shr    $0x4,%edx
+  80016b:	8d 04 52             	lea    (%edx,%edx,2),%eax
+  80016e:	c1 e0 03             	shl    $0x3,%eax
+  800171:	29 c1                	sub    %eax,%ecx
+  800173:	89 ca                	mov    %ecx,%edx
+  800175:	89 f0                	mov    %esi,%eax
+  800177:	e8 cf fe ff ff       	call   80004b <append>
+    default:
+      if ((r = sync()) < 0)
+        panic("sync: %e", r);
+      continue;
+    }
+    close(fd);
+  80017c:	83 ec 0c             	sub    $0xc,%esp
+  80017f:	56                   	push   %esi
+  800180:	e8 b0 13 00 00       	call   801535 <close>
+
+    if (round % 100 == 0)
+  800185:	b8 1f 85 eb 51       	mov    $0x51eb851f,%eax
+  80018a:	f7 eb                	imul   %ebx
+  80018c:	c1 fa 05             	sar    $0x5,%edx
+  80018f:	89 d8                	mov    %ebx,%eax
+  800191:	c1 f8 1f             	sar    $0x1f,%eax
+  800194:	29 c2                	sub    %eax,%edx
+  800196:	6b d2 64             	imul   $0x64,%edx,%edx
+  800199:	83 c4 10             	add    $0x10,%esp
+  80019c:	39 d3                	cmp    %edx,%ebx
+  80019e:	0f 84 ca 01 00 00    	je     80036e <umain+0x28a>
+  for (round = 0; ; round++) {
+  8001a4:	83 c3 01             	add    $0x1,%ebx
+    snprintf(name, sizeof(name), "/crash%d", rand() % NFILES);
+  8001a7:	e8 87 fe ff ff       	call   800033 <rand>
+  8001ac:	83 e0 07             	and    $0x7,%eax
+  8001af:	50                   	push   %eax
+  8001b0:	68 f5 31 80 00       	push   $0x8031f5
+  8001b5:	68 80 00 00 00       	push   $0x80
+  8001ba:	57                   	push   %edi
+  8001bb:	e8 a5 08 00 00       	call   800a65 <snprintf>
+    memset(buf, round, sizeof(buf));
+  8001c0:	83 c4 0c             	add    $0xc,%esp
+  8001c3:	68 00 10 00 00       	push   $0x1000
+  8001c8:	53                   	push   %ebx
+  8001c9:	68 20 50 80 00       	push   $0x805020
+  8001ce:	e8 38 0a 00 00       	call   800c0b <memset>
+    switch (rand() % 4) {
+  8001d3:	e8 5b fe ff ff       	call   800033 <rand>
+  8001d8:	83 e0 03             	and    $0x3,%eax
+  8001db:	83 c4 10             	add    $0x10,%esp
+  8001de:	83 f8 01             	cmp    $0x1,%eax
+  8001e1:	74 48                	je     80022b <umain+0x147>
+  8001e3:	83 f8 02             	cmp    $0x2,%eax
+  8001e6:	0f 84 d6 00 00 00    	je     8002c2 <umain+0x1de>
+  8001ec:	85 c0                	test   %eax,%eax
+  8001ee:	0f 84 4b ff ff ff    	je     80013f <umain+0x5b>
+      if ((r = sync()) < 0)
+  8001f4:	e8 d7 1f 00 00       	call   8021d0 <sync>
+  8001f9:	85 c0                	test   %eax,%eax
+  8001fb:	79 a7                	jns    8001a4 <umain+0xc0>
+        panic("sync: %e", r);
+  8001fd:	50                   	push   %eax
+  8001fe:	68 28 32 80 00       	push   $0x803228
+  800203:	6a 4d                	push   $0x4d
+  800205:	68 aa 31 80 00       	push   $0x8031aa
+  80020a:	e8 e2 01 00 00       	call   8003f1 <_panic>
+        panic("open %s: %e", name, fd);
+  80020f:	83 ec 0c             	sub    $0xc,%esp
+  800212:	50                   	push   %eax
+  800213:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  800219:	50                   	push   %eax
+  80021a:	68 fe 31 80 00       	push   $0x8031fe
+  80021f:	6a 39                	push   $0x39
+  800221:	68 aa 31 80 00       	push   $0x8031aa
+  800226:	e8 c6 01 00 00       	call   8003f1 <_panic>
+      if ((fd = open(name, O_RDWR | O_CREAT)) < 0)
+  80022b:	83 ec 08             	sub    $0x8,%esp
+  80022e:	68 02 01 00 00       	push   $0x102
+  800233:	57                   	push   %edi
+  800234:	e8 af 1c 00 00       	call   801ee8 <open>
+  800239:	89 c6                	mov    %eax,%esi
+  80023b:	83 c4 10             	add    $0x10,%esp
+  80023e:	85 c0                	test   %eax,%eax
+  800240:	78 48                	js     80028a <umain+0x1a6>
+      if ((r = fstat(fd, &st)) < 0)
+  800242:	83 ec 08             	sub    $0x8,%esp
+  800245:	8d 85 dc fe ff ff    	lea    -0x124(%ebp),%eax
+  80024b:	50                   	push   %eax
+  80024c:	56                   	push   %esi
+  80024d:	e8 63 16 00 00       	call   8018b5 <fstat>
+  800252:	83 c4 10             	add    $0x10,%esp
+  800255:	85 c0                	test   %eax,%eax
+  800257:	78 4d                	js     8002a6 <umain+0x1c2>
+      append(fd, rand() % (MAXBLOCKS - st.st_size / BLKSIZE + 1));
+  800259:	e8 d5 fd ff ff       	call   800033 <rand>
+  80025e:	8b 8d 5c ff ff ff    	mov    -0xa4(%ebp),%ecx
+  800264:	8d 91 ff 0f 00 00    	lea    0xfff(%ecx),%edx
+  80026a:	85 c9                	test   %ecx,%ecx
+  80026c:	0f 49 d1             	cmovns %ecx,%edx
+  80026f:	c1 fa 0c             	sar    $0xc,%edx
+  800272:	f7 da                	neg    %edx
+  800274:	8d 4a 19             	lea    0x19(%edx),%ecx
+  800277:	ba 00 00 00 00       	mov    $0x0,%edx
+  80027c:	f7 f1                	div    %ecx
+  80027e:	89 f0                	mov    %esi,%eax
+  800280:	e8 c6 fd ff ff       	call   80004b <append>
+      break;
+  800285:	e9 f2 fe ff ff       	jmp    80017c <umain+0x98>
+        panic("open %s: %e", name, fd);
+  80028a:	83 ec 0c             	sub    $0xc,%esp
+  80028d:	50                   	push   %eax
+  80028e:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  800294:	50                   	push   %eax
+  800295:	68 fe 31 80 00       	push   $0x8031fe
+  80029a:	6a 3e                	push   $0x3e
+  80029c:	68 aa 31 80 00       	push   $0x8031aa
+  8002a1:	e8 4b 01 00 00       	call   8003f1 <_panic>
+        panic("fstat %s: %e", name, r);
+  8002a6:	83 ec 0c             	sub    $0xc,%esp
+  8002a9:	50                   	push   %eax
+  8002aa:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8002b0:	50                   	push   %eax
+  8002b1:	68 0a 32 80 00       	push   $0x80320a
+  8002b6:	6a 40                	push   $0x40
+  8002b8:	68 aa 31 80 00       	push   $0x8031aa
+  8002bd:	e8 2f 01 00 00       	call   8003f1 <_panic>
+      if ((fd = open(name, O_RDWR | O_CREAT)) < 0)
+  8002c2:	83 ec 08             	sub    $0x8,%esp
+  8002c5:	68 02 01 00 00       	push   $0x102
+  8002ca:	57                   	push   %edi
+  8002cb:	e8 18 1c 00 00       	call   801ee8 <open>
+  8002d0:	89 c6                	mov    %eax,%esi
+  8002d2:	83 c4 10             	add    $0x10,%esp
+  8002d5:	85 c0                	test   %eax,%eax
+  8002d7:	78 5d                	js     800336 <umain+0x252>
+      if ((r = fstat(fd, &st)) < 0)
+  8002d9:	83 ec 08             	sub    $0x8,%esp
+  8002dc:	8d 85 dc fe ff ff    	lea    -0x124(%ebp),%eax
+  8002e2:	50                   	push   %eax
+  8002e3:	56                   	push   %esi
+  8002e4:	e8 cc 15 00 00       	call   8018b5 <fstat>
+  8002e9:	83 c4 10             	add    $0x10,%esp
+  8002ec:	85 c0                	test   %eax,%eax
+  8002ee:	78 62                	js     800352 <umain+0x26e>
+      if ((r = ftruncate(fd, rand() % (st.st_size + 1))) < 0)
+  8002f0:	e8 3e fd ff ff       	call   800033 <rand>
+  8002f5:	83 ec 08             	sub    $0x8,%esp
+  8002f8:	8b 8d 5c ff ff ff    	mov    -0xa4(%ebp),%ecx
+  8002fe:	83 c1 01             	add    $0x1,%ecx
+  800301:	ba 00 00 00 00       	mov    $0x0,%edx
+  800306:	f7 f1                	div    %ecx
+  800308:	52                   	push   %edx
+  800309:	56                   	push   %esi
+  80030a:	e8 27 15 00 00       	call   801836 <ftruncate>
+  80030f:	83 c4 10             	add    $0x10,%esp
+  800312:	85 c0                	test   %eax,%eax
+  800314:	0f 89 62 fe ff ff    	jns    80017c <umain+0x98>
+        panic("ftruncate %s: %e", name, r);
+  80031a:	83 ec 0c             	sub    $0xc,%esp
+  80031d:	50                   	push   %eax
+  80031e:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  800324:	50                   	push   %eax
+  800325:	68 17 32 80 00       	push   $0x803217
+  80032a:	6a 49                	push   $0x49
+  80032c:	68 aa 31 80 00       	push   $0x8031aa
+  800331:	e8 bb 00 00 00       	call   8003f1 <_panic>
+        panic("open %s: %e", name, fd);
+  800336:	83 ec 0c             	sub    $0xc,%esp
+  800339:	50                   	push   %eax
+  80033a:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  800340:	50                   	push   %eax
+  800341:	68 fe 31 80 00       	push   $0x8031fe
+  800346:	6a 45                	push   $0x45
+  800348:	68 aa 31 80 00       	push   $0x8031aa
+  80034d:	e8 9f 00 00 00       	call   8003f1 <_panic>
+        panic("fstat %s: %e", name, r);
+  800352:	83 ec 0c             	sub    $0xc,%esp
+  800355:	50                   	push   %eax
+  800356:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  80035c:	50                   	push   %eax
+  80035d:	68 0a 32 80 00       	push   $0x80320a
+  800362:	6a 47                	push   $0x47
+  800364:	68 aa 31 80 00       	push   $0x8031aa
+  800369:	e8 83 00 00 00       	call   8003f1 <_panic>
+      cprintf("crashload: round %d\n", round);
+  80036e:	83 ec 08             	sub    $0x8,%esp
+  800371:	53                   	push   %ebx
+  800372:	68 31 32 80 00       	push   $0x803231
+  800377:	e8 50 01 00 00       	call   8004cc <cprintf>
+  80037c:	83 c4 10             	add    $0x10,%esp
+  80037f:	e9 20 fe ff ff       	jmp    8001a4 <umain+0xc0>
+
+00800384 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800384:	55                   	push   %ebp
+  800385:	89 e5                	mov    %esp,%ebp
+  800387:	56                   	push   %esi
+  800388:	53                   	push   %ebx
+  800389:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80038c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  80038f:	c7 05 64 67 80 00 00 	movl   $0x0,0x806764
+  800396:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  800399:	e8 ca 0a 00 00       	call   800e68 <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  80039e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8003a3:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8003a6:	c1 e0 04             	shl    $0x4,%eax
+  8003a9:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8003ae:	a3 64 67 80 00       	mov    %eax,0x806764
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8003b3:	85 db                	test   %ebx,%ebx
+  8003b5:	7e 07                	jle    8003be <libmain+0x3a>
+    binaryname = argv[0];
+  8003b7:	8b 06                	mov    (%esi),%eax
+  8003b9:	a3 00 40 80 00       	mov    %eax,0x804000
+
+  // call user main routine
+  umain(argc, argv);
+  8003be:	83 ec 08             	sub    $0x8,%esp
+  8003c1:	56                   	push   %esi
+  8003c2:	53                   	push   %ebx
+  8003c3:	e8 1c fd ff ff       	call   8000e4 <umain>
+
+  // exit gracefully
+  exit();
+  8003c8:	e8 0a 00 00 00       	call   8003d7 <exit>
+}
+  8003cd:	83 c4 10             	add    $0x10,%esp
+  8003d0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8003d3:	5b                   	pop    %ebx
+  8003d4:	5e                   	pop    %esi
+  8003d5:	5d                   	pop    %ebp
+  8003d6:	c3                   	ret
+
+008003d7 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8003d7:	55                   	push   %ebp
+  8003d8:	89 e5                	mov    %esp,%ebp
+  8003da:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  8003dd:	e8 80 11 00 00       	call   801562 <close_all>
+  sys_env_destroy(0);
+  8003e2:	83 ec 0c             	sub    $0xc,%esp
+  8003e5:	6a 00                	push   $0x0
+  8003e7:	e8 3b 0a 00 00       	call   800e27 <sys_env_destroy>
+}
+  8003ec:	83 c4 10             	add    $0x10,%esp
+  8003ef:	c9                   	leave
+  8003f0:	c3                   	ret
+
+008003f1 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8003f1:	55                   	push   %ebp
+  8003f2:	89 e5                	mov    %esp,%ebp
+  8003f4:	56                   	push   %esi
+  8003f5:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  8003f6:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  8003f9:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  8003ff:	e8 64 0a 00 00       	call   800e68 <sys_getenvid>
+  800404:	83 ec 0c             	sub    $0xc,%esp
+  800407:	ff 75 0c             	push   0xc(%ebp)
+  80040a:	ff 75 08             	push   0x8(%ebp)
+  80040d:	56                   	push   %esi
+  80040e:	50                   	push   %eax
+  80040f:	68 50 32 80 00       	push   $0x803250
+  800414:	e8 b3 00 00 00       	call   8004cc <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  800419:	83 c4 18             	add    $0x18,%esp
+  80041c:	53                   	push   %ebx
+  80041d:	ff 75 10             	push   0x10(%ebp)
+  800420:	e8 56 00 00 00       	call   80047b <vcprintf>
+  cprintf("\n");
+  800425:	c7 04 24 f3 31 80 00 	movl   $0x8031f3,(%esp)
+  80042c:	e8 9b 00 00 00       	call   8004cc <cprintf>
+  800431:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  800434:	cc                   	int3
+  while (1)
+  800435:	eb fd                	jmp    800434 <_panic+0x43>
+
+00800437 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800437:	55                   	push   %ebp
+  800438:	89 e5                	mov    %esp,%ebp
+  80043a:	53                   	push   %ebx
+  80043b:	83 ec 04             	sub    $0x4,%esp
+  80043e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  800441:	8b 13                	mov    (%ebx),%edx
+  800443:	8d 42 01             	lea    0x1(%edx),%eax
+  800446:	89 03                	mov    %eax,(%ebx)
+  800448:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80044b:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  80044f:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800454:	74 09                	je     80045f <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  800456:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80045a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80045d:	c9                   	leave
+  80045e:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  80045f:	83 ec 08             	sub    $0x8,%esp
+  800462:	68 ff 00 00 00       	push   $0xff
+  800467:	8d 43 08             	lea    0x8(%ebx),%eax
+  80046a:	50                   	push   %eax
+  80046b:	e8 7a 09 00 00       	call   800dea <sys_cputs>
+    b->idx = 0;
+  800470:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800476:	83 c4 10             	add    $0x10,%esp
+  800479:	eb db                	jmp    800456 <putch+0x1f>
+
+0080047b <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80047b:	55                   	push   %ebp
+  80047c:	89 e5                	mov    %esp,%ebp
+  80047e:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  800484:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80048b:	00 00 00 
+  b.cnt = 0;
+  80048e:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800495:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  800498:	ff 75 0c             	push   0xc(%ebp)
+  80049b:	ff 75 08             	push   0x8(%ebp)
+  80049e:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8004a4:	50                   	push   %eax
+  8004a5:	68 37 04 80 00       	push   $0x800437
+  8004aa:	e8 14 01 00 00       	call   8005c3 <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  8004af:	83 c4 08             	add    $0x8,%esp
+  8004b2:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8004b8:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8004be:	50                   	push   %eax
+  8004bf:	e8 26 09 00 00       	call   800dea <sys_cputs>
+
+  return b.cnt;
+}
+  8004c4:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8004ca:	c9                   	leave
+  8004cb:	c3                   	ret
+
+008004cc <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8004cc:	55                   	push   %ebp
+  8004cd:	89 e5                	mov    %esp,%ebp
+  8004cf:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  8004d2:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  8004d5:	50                   	push   %eax
+  8004d6:	ff 75 08             	push   0x8(%ebp)
+  8004d9:	e8 9d ff ff ff       	call   80047b <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  8004de:	c9                   	leave
+  8004df:	c3                   	ret
+
+008004e0 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  8004e0:	55                   	push   %ebp
+  8004e1:	89 e5                	mov    %esp,%ebp
+  8004e3:	57                   	push   %edi
+  8004e4:	56                   	push   %esi
+  8004e5:	53                   	push   %ebx
+  8004e6:	83 ec 1c             	sub    $0x1c,%esp
+  8004e9:	89 c7                	mov    %eax,%edi
+  8004eb:	89 d6                	mov    %edx,%esi
+  8004ed:	8b 45 08             	mov    0x8(%ebp),%eax
+  8004f0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8004f3:	89 d1                	mov    %edx,%ecx
+  8004f5:	89 c2                	mov    %eax,%edx
+  8004f7:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004fa:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8004fd:	8b 45 10             	mov    0x10(%ebp),%eax
+  800500:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  800503:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800506:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80050d:	39 c2                	cmp    %eax,%edx
+  80050f:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800512:	72 3e                	jb     800552 <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  800514:	83 ec 0c             	sub    $0xc,%esp
+  800517:	ff 75 18             	push   0x18(%ebp)
+  80051a:	83 eb 01             	sub    $0x1,%ebx
+  80051d:	53                   	push   %ebx
+  80051e:	50                   	push   %eax
+  80051f:	83 ec 08             	sub    $0x8,%esp
+  800522:	ff 75 e4             	push   -0x1c(%ebp)
+  800525:	ff 75 e0             	push   -0x20(%ebp)
+  800528:	ff 75 dc             	push   -0x24(%ebp)
+  80052b:	ff 75 d8             	push   -0x28(%ebp)
+  80052e:	e8 db 2a 00 00       	call   80300e <__udivdi3>
+  800533:	83 c4 18             	add    $0x18,%esp
+  800536:	52                   	push   %edx
+  800537:	50                   	push   %eax
+  800538:	89 f2                	mov    %esi,%edx
+  80053a:	89 f8                	mov    %edi,%eax
+  80053c:	e8 9f ff ff ff       	call   8004e0 <printnum>
+  800541:	83 c4 20             	add    $0x20,%esp
+  800544:	eb 13                	jmp    800559 <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  800546:	83 ec 08             	sub    $0x8,%esp
+  800549:	56                   	push   %esi
+  80054a:	ff 75 18             	push   0x18(%ebp)
+  80054d:	ff d7                	call   *%edi
+  80054f:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  800552:	83 eb 01             	sub    $0x1,%ebx
+  800555:	85 db                	test   %ebx,%ebx
+  800557:	7f ed                	jg     800546 <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  800559:	83 ec 08             	sub    $0x8,%esp
+  80055c:	56                   	push   %esi
+  80055d:	83 ec 04             	sub    $0x4,%esp
+  800560:	ff 75 e4             	push   -0x1c(%ebp)
+  800563:	ff 75 e0             	push   -0x20(%ebp)
+  800566:	ff 75 dc             	push   -0x24(%ebp)
+  800569:	ff 75 d8             	push   -0x28(%ebp)
+  80056c:	e8 be 2a 00 00       	call   80302f <__umoddi3>
+  800571:	83 c4 14             	add    $0x14,%esp
+  800574:	0f be 80 73 32 80 00 	movsbl 0x803273(%eax),%eax
+  80057b:	50                   	push   %eax
+  80057c:	ff d7                	call   *%edi
+}
+  80057e:	83 c4 10             	add    $0x10,%esp
+  800581:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800584:	5b                   	pop    %ebx
+  800585:	5e                   	pop    %esi
+  800586:	5f                   	pop    %edi
+  800587:	5d                   	pop    %ebp
+  800588:	c3                   	ret
+
+00800589 <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800589:	55                   	push   %ebp
+  80058a:	89 e5                	mov    %esp,%ebp
+  80058c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  80058f:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  800593:	8b 10                	mov    (%eax),%edx
+  800595:	3b 50 04             	cmp    0x4(%eax),%edx
+  800598:	73 0a                	jae    8005a4 <sprintputch+0x1b>
+    *b->buf++ = ch;
+  80059a:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80059d:	89 08                	mov    %ecx,(%eax)
+  80059f:	8b 45 08             	mov    0x8(%ebp),%eax
+  8005a2:	88 02                	mov    %al,(%edx)
+}
+  8005a4:	5d                   	pop    %ebp
+  8005a5:	c3                   	ret
+
+008005a6 <printfmt>:
+{
+  8005a6:	55                   	push   %ebp
+  8005a7:	89 e5                	mov    %esp,%ebp
+  8005a9:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  8005ac:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  8005af:	50                   	push   %eax
+  8005b0:	ff 75 10             	push   0x10(%ebp)
+  8005b3:	ff 75 0c             	push   0xc(%ebp)
+  8005b6:	ff 75 08             	push   0x8(%ebp)
+  8005b9:	e8 05 00 00 00       	call   8005c3 <vprintfmt>
+}
+  8005be:	83 c4 10             	add    $0x10,%esp
+  8005c1:	c9                   	leave
+  8005c2:	c3                   	ret
+
+008005c3 <vprintfmt>:
+{
+  8005c3:	55                   	push   %ebp
+  8005c4:	89 e5                	mov    %esp,%ebp
+  8005c6:	57                   	push   %edi
+  8005c7:	56                   	push   %esi
+  8005c8:	53                   	push   %ebx
+  8005c9:	83 ec 2c             	sub    $0x2c,%esp
+  8005cc:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005cf:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8005d2:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8005d5:	eb 0a                	jmp    8005e1 <vprintfmt+0x1e>
+      putch(ch, putdat);
+  8005d7:	83 ec 08             	sub    $0x8,%esp
+  8005da:	53                   	push   %ebx
+  8005db:	50                   	push   %eax
+  8005dc:	ff d6                	call   *%esi
+  8005de:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  8005e1:	83 c7 01             	add    $0x1,%edi
+  8005e4:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8005e8:	83 f8 25             	cmp    $0x25,%eax
+  8005eb:	74 0c                	je     8005f9 <vprintfmt+0x36>
+      if (ch == '\0')
+  8005ed:	85 c0                	test   %eax,%eax
+  8005ef:	75 e6                	jne    8005d7 <vprintfmt+0x14>
+}
+  8005f1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005f4:	5b                   	pop    %ebx
+  8005f5:	5e                   	pop    %esi
+  8005f6:	5f                   	pop    %edi
+  8005f7:	5d                   	pop    %ebp
+  8005f8:	c3                   	ret
+    padc = ' ';
+  8005f9:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  8005fd:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  800604:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  80060b:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  800612:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  800617:	8d 47 01             	lea    0x1(%edi),%eax
+  80061a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80061d:	0f b6 17             	movzbl (%edi),%edx
+  800620:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800623:	3c 55                	cmp    $0x55,%al
+  800625:	0f 87 cf 03 00 00    	ja     8009fa <vprintfmt+0x437>
+  80062b:	0f b6 c0             	movzbl %al,%eax
+  80062e:	ff 24 85 c0 33 80 00 	jmp    *0x8033c0(,%eax,4)
+  800635:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  800638:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80063c:	eb d9                	jmp    800617 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  80063e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800641:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800645:	eb d0                	jmp    800617 <vprintfmt+0x54>
+  800647:	0f b6 d2             	movzbl %dl,%edx
+  80064a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  80064d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800652:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  800655:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800658:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  80065c:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  80065f:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800662:	83 f9 09             	cmp    $0x9,%ecx
+  800665:	77 55                	ja     8006bc <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  800667:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  80066a:	eb e9                	jmp    800655 <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  80066c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80066f:	8b 00                	mov    (%eax),%eax
+  800671:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800674:	8b 45 14             	mov    0x14(%ebp),%eax
+  800677:	8d 40 04             	lea    0x4(%eax),%eax
+  80067a:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  80067d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  800680:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800684:	79 91                	jns    800617 <vprintfmt+0x54>
+        width = precision, precision = -1;
+  800686:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800689:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80068c:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800693:	eb 82                	jmp    800617 <vprintfmt+0x54>
+      if (width < 0)
+  800695:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800698:	85 d2                	test   %edx,%edx
+  80069a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80069f:	0f 49 c2             	cmovns %edx,%eax
+  8006a2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  8006a5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  8006a8:	e9 6a ff ff ff       	jmp    800617 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  8006ad:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  8006b0:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  8006b7:	e9 5b ff ff ff       	jmp    800617 <vprintfmt+0x54>
+  8006bc:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8006bf:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8006c2:	eb bc                	jmp    800680 <vprintfmt+0xbd>
+      lflag++;
+  8006c4:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  8006c7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  8006ca:	e9 48 ff ff ff       	jmp    800617 <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  8006cf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d2:	8d 78 04             	lea    0x4(%eax),%edi
+  8006d5:	83 ec 08             	sub    $0x8,%esp
+  8006d8:	53                   	push   %ebx
+  8006d9:	ff 30                	push   (%eax)
+  8006db:	ff d6                	call   *%esi
+      break;
+  8006dd:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  8006e0:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  8006e3:	e9 b1 02 00 00       	jmp    800999 <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  8006e8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006eb:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  8006ee:	8b 10                	mov    (%eax),%edx
+  8006f0:	89 d0                	mov    %edx,%eax
+  8006f2:	f7 d8                	neg    %eax
+  8006f4:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8006f7:	83 f8 10             	cmp    $0x10,%eax
+  8006fa:	7f 23                	jg     80071f <vprintfmt+0x15c>
+  8006fc:	8b 14 85 20 35 80 00 	mov    0x803520(,%eax,4),%edx
+  800703:	85 d2                	test   %edx,%edx
+  800705:	74 18                	je     80071f <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  800707:	52                   	push   %edx
+  800708:	68 6a 36 80 00       	push   $0x80366a
+  80070d:	53                   	push   %ebx
+  80070e:	56                   	push   %esi
+  80070f:	e8 92 fe ff ff       	call   8005a6 <printfmt>
+  800714:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  800717:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80071a:	e9 7a 02 00 00       	jmp    800999 <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  80071f:	50                   	push   %eax
+  800720:	68 8b 32 80 00       	push   $0x80328b
+  800725:	53                   	push   %ebx
+  800726:	56                   	push   %esi
+  800727:	e8 7a fe ff ff       	call   8005a6 <printfmt>
+  80072c:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  80072f:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  800732:	e9 62 02 00 00       	jmp    800999 <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  800737:	8b 45 14             	mov    0x14(%ebp),%eax
+  80073a:	83 c0 04             	add    $0x4,%eax
+  80073d:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800740:	8b 45 14             	mov    0x14(%ebp),%eax
+  800743:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  800745:	85 c9                	test   %ecx,%ecx
+  800747:	b8 84 32 80 00       	mov    $0x803284,%eax
+  80074c:	0f 45 c1             	cmovne %ecx,%eax
+  80074f:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  800752:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800756:	7e 06                	jle    80075e <vprintfmt+0x19b>
+  800758:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80075c:	75 0b                	jne    800769 <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  80075e:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800761:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800764:	89 75 08             	mov    %esi,0x8(%ebp)
+  800767:	eb 5c                	jmp    8007c5 <vprintfmt+0x202>
+  800769:	83 ec 08             	sub    $0x8,%esp
+  80076c:	ff 75 d0             	push   -0x30(%ebp)
+  80076f:	ff 75 cc             	push   -0x34(%ebp)
+  800772:	e8 20 03 00 00       	call   800a97 <strnlen>
+  800777:	89 c2                	mov    %eax,%edx
+  800779:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80077c:	29 d0                	sub    %edx,%eax
+  80077e:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  800781:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800785:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800788:	89 75 08             	mov    %esi,0x8(%ebp)
+  80078b:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  80078d:	eb 0e                	jmp    80079d <vprintfmt+0x1da>
+          putch(padc, putdat);
+  80078f:	83 ec 08             	sub    $0x8,%esp
+  800792:	53                   	push   %ebx
+  800793:	57                   	push   %edi
+  800794:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800797:	83 ee 01             	sub    $0x1,%esi
+  80079a:	83 c4 10             	add    $0x10,%esp
+  80079d:	85 f6                	test   %esi,%esi
+  80079f:	7f ee                	jg     80078f <vprintfmt+0x1cc>
+  8007a1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8007a4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007a7:	85 c0                	test   %eax,%eax
+  8007a9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8007ae:	0f 49 d0             	cmovns %eax,%edx
+  8007b1:	29 d0                	sub    %edx,%eax
+  8007b3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8007b6:	eb a6                	jmp    80075e <vprintfmt+0x19b>
+          putch(ch, putdat);
+  8007b8:	83 ec 08             	sub    $0x8,%esp
+  8007bb:	53                   	push   %ebx
+  8007bc:	52                   	push   %edx
+  8007bd:	ff 55 08             	call   *0x8(%ebp)
+  8007c0:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8007c3:	89 f1                	mov    %esi,%ecx
+  8007c5:	8d 71 01             	lea    0x1(%ecx),%esi
+  8007c8:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8007cc:	0f be d0             	movsbl %al,%edx
+  8007cf:	85 d2                	test   %edx,%edx
+  8007d1:	74 28                	je     8007fb <vprintfmt+0x238>
+  8007d3:	85 ff                	test   %edi,%edi
+  8007d5:	78 05                	js     8007dc <vprintfmt+0x219>
+  8007d7:	83 ef 01             	sub    $0x1,%edi
+  8007da:	78 30                	js     80080c <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  8007dc:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8007e0:	74 d6                	je     8007b8 <vprintfmt+0x1f5>
+  8007e2:	0f be c0             	movsbl %al,%eax
+  8007e5:	83 e8 20             	sub    $0x20,%eax
+  8007e8:	83 f8 5e             	cmp    $0x5e,%eax
+  8007eb:	76 cb                	jbe    8007b8 <vprintfmt+0x1f5>
+          putch('?', putdat);
+  8007ed:	83 ec 08             	sub    $0x8,%esp
+  8007f0:	53                   	push   %ebx
+  8007f1:	6a 3f                	push   $0x3f
+  8007f3:	ff 55 08             	call   *0x8(%ebp)
+  8007f6:	83 c4 10             	add    $0x10,%esp
+  8007f9:	eb c8                	jmp    8007c3 <vprintfmt+0x200>
+  8007fb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007fe:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800801:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800804:	01 d0                	add    %edx,%eax
+  800806:	29 c8                	sub    %ecx,%eax
+  800808:	89 c7                	mov    %eax,%edi
+  80080a:	eb 13                	jmp    80081f <vprintfmt+0x25c>
+  80080c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80080f:	eb ed                	jmp    8007fe <vprintfmt+0x23b>
+        putch(' ', putdat);
+  800811:	83 ec 08             	sub    $0x8,%esp
+  800814:	53                   	push   %ebx
+  800815:	6a 20                	push   $0x20
+  800817:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  800819:	83 ef 01             	sub    $0x1,%edi
+  80081c:	83 c4 10             	add    $0x10,%esp
+  80081f:	85 ff                	test   %edi,%edi
+  800821:	7f ee                	jg     800811 <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  800823:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800826:	89 45 14             	mov    %eax,0x14(%ebp)
+  800829:	e9 6b 01 00 00       	jmp    800999 <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  80082e:	83 f9 01             	cmp    $0x1,%ecx
+  800831:	7f 1f                	jg     800852 <vprintfmt+0x28f>
+  else if (lflag)
+  800833:	85 c9                	test   %ecx,%ecx
+  800835:	74 67                	je     80089e <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  800837:	8b 45 14             	mov    0x14(%ebp),%eax
+  80083a:	8b 00                	mov    (%eax),%eax
+  80083c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80083f:	89 c1                	mov    %eax,%ecx
+  800841:	c1 f9 1f             	sar    $0x1f,%ecx
+  800844:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800847:	8b 45 14             	mov    0x14(%ebp),%eax
+  80084a:	8d 40 04             	lea    0x4(%eax),%eax
+  80084d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800850:	eb 17                	jmp    800869 <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  800852:	8b 45 14             	mov    0x14(%ebp),%eax
+  800855:	8b 50 04             	mov    0x4(%eax),%edx
+  800858:	8b 00                	mov    (%eax),%eax
+  80085a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80085d:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800860:	8b 45 14             	mov    0x14(%ebp),%eax
+  800863:	8d 40 08             	lea    0x8(%eax),%eax
+  800866:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  800869:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80086c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  80086f:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  800874:	85 c9                	test   %ecx,%ecx
+  800876:	0f 89 03 01 00 00    	jns    80097f <vprintfmt+0x3bc>
+        putch('-', putdat);
+  80087c:	83 ec 08             	sub    $0x8,%esp
+  80087f:	53                   	push   %ebx
+  800880:	6a 2d                	push   $0x2d
+  800882:	ff d6                	call   *%esi
+        num = -(long long)num;
+  800884:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800887:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80088a:	f7 da                	neg    %edx
+  80088c:	83 d1 00             	adc    $0x0,%ecx
+  80088f:	f7 d9                	neg    %ecx
+  800891:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  800894:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800899:	e9 e1 00 00 00       	jmp    80097f <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  80089e:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008a1:	8b 00                	mov    (%eax),%eax
+  8008a3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8008a6:	89 c1                	mov    %eax,%ecx
+  8008a8:	c1 f9 1f             	sar    $0x1f,%ecx
+  8008ab:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8008ae:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008b1:	8d 40 04             	lea    0x4(%eax),%eax
+  8008b4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008b7:	eb b0                	jmp    800869 <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  8008b9:	83 f9 01             	cmp    $0x1,%ecx
+  8008bc:	7f 1e                	jg     8008dc <vprintfmt+0x319>
+  else if (lflag)
+  8008be:	85 c9                	test   %ecx,%ecx
+  8008c0:	74 32                	je     8008f4 <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  8008c2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008c5:	8b 10                	mov    (%eax),%edx
+  8008c7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008cc:	8d 40 04             	lea    0x4(%eax),%eax
+  8008cf:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  8008d2:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  8008d7:	e9 a3 00 00 00       	jmp    80097f <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  8008dc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008df:	8b 10                	mov    (%eax),%edx
+  8008e1:	8b 48 04             	mov    0x4(%eax),%ecx
+  8008e4:	8d 40 08             	lea    0x8(%eax),%eax
+  8008e7:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  8008ea:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  8008ef:	e9 8b 00 00 00       	jmp    80097f <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8008f4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008f7:	8b 10                	mov    (%eax),%edx
+  8008f9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008fe:	8d 40 04             	lea    0x4(%eax),%eax
+  800901:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800904:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  800909:	eb 74                	jmp    80097f <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  80090b:	83 f9 01             	cmp    $0x1,%ecx
+  80090e:	7f 1b                	jg     80092b <vprintfmt+0x368>
+  else if (lflag)
+  800910:	85 c9                	test   %ecx,%ecx
+  800912:	74 2c                	je     800940 <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  800914:	8b 45 14             	mov    0x14(%ebp),%eax
+  800917:	8b 10                	mov    (%eax),%edx
+  800919:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80091e:	8d 40 04             	lea    0x4(%eax),%eax
+  800921:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800924:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  800929:	eb 54                	jmp    80097f <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  80092b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80092e:	8b 10                	mov    (%eax),%edx
+  800930:	8b 48 04             	mov    0x4(%eax),%ecx
+  800933:	8d 40 08             	lea    0x8(%eax),%eax
+  800936:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800939:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  80093e:	eb 3f                	jmp    80097f <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800940:	8b 45 14             	mov    0x14(%ebp),%eax
+  800943:	8b 10                	mov    (%eax),%edx
+  800945:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80094a:	8d 40 04             	lea    0x4(%eax),%eax
+  80094d:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800950:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  800955:	eb 28                	jmp    80097f <vprintfmt+0x3bc>
+      putch('0', putdat);
+  800957:	83 ec 08             	sub    $0x8,%esp
+  80095a:	53                   	push   %ebx
+  80095b:	6a 30                	push   $0x30
+  80095d:	ff d6                	call   *%esi
+      putch('x', putdat);
+  80095f:	83 c4 08             	add    $0x8,%esp
+  800962:	53                   	push   %ebx
+  800963:	6a 78                	push   $0x78
+  800965:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  800967:	8b 45 14             	mov    0x14(%ebp),%eax
+  80096a:	8b 10                	mov    (%eax),%edx
+  80096c:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  800971:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  800974:	8d 40 04             	lea    0x4(%eax),%eax
+  800977:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  80097a:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  80097f:	83 ec 0c             	sub    $0xc,%esp
+  800982:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800986:	50                   	push   %eax
+  800987:	ff 75 e0             	push   -0x20(%ebp)
+  80098a:	57                   	push   %edi
+  80098b:	51                   	push   %ecx
+  80098c:	52                   	push   %edx
+  80098d:	89 da                	mov    %ebx,%edx
+  80098f:	89 f0                	mov    %esi,%eax
+  800991:	e8 4a fb ff ff       	call   8004e0 <printnum>
+      break;
+  800996:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  800999:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  80099c:	e9 40 fc ff ff       	jmp    8005e1 <vprintfmt+0x1e>
+  if (lflag >= 2)
+  8009a1:	83 f9 01             	cmp    $0x1,%ecx
+  8009a4:	7f 1b                	jg     8009c1 <vprintfmt+0x3fe>
+  else if (lflag)
+  8009a6:	85 c9                	test   %ecx,%ecx
+  8009a8:	74 2c                	je     8009d6 <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  8009aa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009ad:	8b 10                	mov    (%eax),%edx
+  8009af:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009b4:	8d 40 04             	lea    0x4(%eax),%eax
+  8009b7:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8009ba:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  8009bf:	eb be                	jmp    80097f <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  8009c1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009c4:	8b 10                	mov    (%eax),%edx
+  8009c6:	8b 48 04             	mov    0x4(%eax),%ecx
+  8009c9:	8d 40 08             	lea    0x8(%eax),%eax
+  8009cc:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8009cf:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  8009d4:	eb a9                	jmp    80097f <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8009d6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009d9:	8b 10                	mov    (%eax),%edx
+  8009db:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009e0:	8d 40 04             	lea    0x4(%eax),%eax
+  8009e3:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8009e6:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  8009eb:	eb 92                	jmp    80097f <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  8009ed:	83 ec 08             	sub    $0x8,%esp
+  8009f0:	53                   	push   %ebx
+  8009f1:	6a 25                	push   $0x25
+  8009f3:	ff d6                	call   *%esi
+      break;
+  8009f5:	83 c4 10             	add    $0x10,%esp
+  8009f8:	eb 9f                	jmp    800999 <vprintfmt+0x3d6>
+      putch('%', putdat);
+  8009fa:	83 ec 08             	sub    $0x8,%esp
+  8009fd:	53                   	push   %ebx
+  8009fe:	6a 25                	push   $0x25
+  800a00:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  800a02:	83 c4 10             	add    $0x10,%esp
+  800a05:	89 f8                	mov    %edi,%eax
+  800a07:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800a0b:	74 05                	je     800a12 <vprintfmt+0x44f>
+  800a0d:	83 e8 01             	sub    $0x1,%eax
+  800a10:	eb f5                	jmp    800a07 <vprintfmt+0x444>
+  800a12:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800a15:	eb 82                	jmp    800999 <vprintfmt+0x3d6>
+
+00800a17 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800a17:	55                   	push   %ebp
+  800a18:	89 e5                	mov    %esp,%ebp
+  800a1a:	83 ec 18             	sub    $0x18,%esp
+  800a1d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a20:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  800a23:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800a26:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800a2a:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800a2d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  800a34:	85 c0                	test   %eax,%eax
+  800a36:	74 26                	je     800a5e <vsnprintf+0x47>
+  800a38:	85 d2                	test   %edx,%edx
+  800a3a:	7e 22                	jle    800a5e <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800a3c:	ff 75 14             	push   0x14(%ebp)
+  800a3f:	ff 75 10             	push   0x10(%ebp)
+  800a42:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800a45:	50                   	push   %eax
+  800a46:	68 89 05 80 00       	push   $0x800589
+  800a4b:	e8 73 fb ff ff       	call   8005c3 <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800a50:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800a53:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  800a56:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a59:	83 c4 10             	add    $0x10,%esp
+}
+  800a5c:	c9                   	leave
+  800a5d:	c3                   	ret
+    return -E_INVAL;
+  800a5e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a63:	eb f7                	jmp    800a5c <vsnprintf+0x45>
+
+00800a65 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800a65:	55                   	push   %ebp
+  800a66:	89 e5                	mov    %esp,%ebp
+  800a68:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  800a6b:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  800a6e:	50                   	push   %eax
+  800a6f:	ff 75 10             	push   0x10(%ebp)
+  800a72:	ff 75 0c             	push   0xc(%ebp)
+  800a75:	ff 75 08             	push   0x8(%ebp)
+  800a78:	e8 9a ff ff ff       	call   800a17 <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  800a7d:	c9                   	leave
+  800a7e:	c3                   	ret
+
+00800a7f <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800a7f:	55                   	push   %ebp
+  800a80:	89 e5                	mov    %esp,%ebp
+  800a82:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  800a85:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a8a:	eb 03                	jmp    800a8f <strlen+0x10>
+    n++;
+  800a8c:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  800a8f:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800a93:	75 f7                	jne    800a8c <strlen+0xd>
+  return n;
+}
+  800a95:	5d                   	pop    %ebp
+  800a96:	c3                   	ret
+
+00800a97 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800a97:	55                   	push   %ebp
+  800a98:	89 e5                	mov    %esp,%ebp
+  800a9a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a9d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800aa0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aa5:	eb 03                	jmp    800aaa <strnlen+0x13>
+    n++;
+  800aa7:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800aaa:	39 d0                	cmp    %edx,%eax
+  800aac:	74 08                	je     800ab6 <strnlen+0x1f>
+  800aae:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800ab2:	75 f3                	jne    800aa7 <strnlen+0x10>
+  800ab4:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  800ab6:	89 d0                	mov    %edx,%eax
+  800ab8:	5d                   	pop    %ebp
+  800ab9:	c3                   	ret
+
+00800aba <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800aba:	55                   	push   %ebp
+  800abb:	89 e5                	mov    %esp,%ebp
+  800abd:	53                   	push   %ebx
+  800abe:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ac1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  800ac4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ac9:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800acd:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800ad0:	83 c0 01             	add    $0x1,%eax
+  800ad3:	84 d2                	test   %dl,%dl
+  800ad5:	75 f2                	jne    800ac9 <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  800ad7:	89 c8                	mov    %ecx,%eax
+  800ad9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800adc:	c9                   	leave
+  800add:	c3                   	ret
+
+00800ade <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800ade:	55                   	push   %ebp
+  800adf:	89 e5                	mov    %esp,%ebp
+  800ae1:	53                   	push   %ebx
+  800ae2:	83 ec 10             	sub    $0x10,%esp
+  800ae5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  800ae8:	53                   	push   %ebx
+  800ae9:	e8 91 ff ff ff       	call   800a7f <strlen>
+  800aee:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  800af1:	ff 75 0c             	push   0xc(%ebp)
+  800af4:	01 d8                	add    %ebx,%eax
+  800af6:	50                   	push   %eax
+  800af7:	e8 be ff ff ff       	call   800aba <strcpy>
+  return dst;
+}
+  800afc:	89 d8                	mov    %ebx,%eax
+  800afe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b01:	c9                   	leave
+  800b02:	c3                   	ret
+
+00800b03 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  800b03:	55                   	push   %ebp
+  800b04:	89 e5                	mov    %esp,%ebp
+  800b06:	56                   	push   %esi
+  800b07:	53                   	push   %ebx
+  800b08:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b0b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  800b0e:	89 f3                	mov    %esi,%ebx
+  800b10:	03 5d 10             	add    0x10(%ebp),%ebx
+  800b13:	89 f0                	mov    %esi,%eax
+  800b15:	eb 0f                	jmp    800b26 <strncpy+0x23>
+    *dst++ = *src;
+  800b17:	83 c0 01             	add    $0x1,%eax
+  800b1a:	0f b6 0a             	movzbl (%edx),%ecx
+  800b1d:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  800b20:	80 f9 01             	cmp    $0x1,%cl
+  800b23:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  800b26:	39 d8                	cmp    %ebx,%eax
+  800b28:	75 ed                	jne    800b17 <strncpy+0x14>
+  }
+  return ret;
+}
+  800b2a:	89 f0                	mov    %esi,%eax
+  800b2c:	5b                   	pop    %ebx
+  800b2d:	5e                   	pop    %esi
+  800b2e:	5d                   	pop    %ebp
+  800b2f:	c3                   	ret
+
+00800b30 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800b30:	55                   	push   %ebp
+  800b31:	89 e5                	mov    %esp,%ebp
+  800b33:	56                   	push   %esi
+  800b34:	53                   	push   %ebx
+  800b35:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b38:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b3b:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  800b3e:	89 f0                	mov    %esi,%eax
+  800b40:	85 d2                	test   %edx,%edx
+  800b42:	74 21                	je     800b65 <strlcpy+0x35>
+  800b44:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800b48:	89 f2                	mov    %esi,%edx
+  800b4a:	eb 09                	jmp    800b55 <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  800b4c:	83 c1 01             	add    $0x1,%ecx
+  800b4f:	83 c2 01             	add    $0x1,%edx
+  800b52:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  800b55:	39 c2                	cmp    %eax,%edx
+  800b57:	74 09                	je     800b62 <strlcpy+0x32>
+  800b59:	0f b6 19             	movzbl (%ecx),%ebx
+  800b5c:	84 db                	test   %bl,%bl
+  800b5e:	75 ec                	jne    800b4c <strlcpy+0x1c>
+  800b60:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  800b62:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  800b65:	29 f0                	sub    %esi,%eax
+}
+  800b67:	5b                   	pop    %ebx
+  800b68:	5e                   	pop    %esi
+  800b69:	5d                   	pop    %ebp
+  800b6a:	c3                   	ret
+
+00800b6b <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800b6b:	55                   	push   %ebp
+  800b6c:	89 e5                	mov    %esp,%ebp
+  800b6e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b71:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  800b74:	eb 06                	jmp    800b7c <strcmp+0x11>
+    p++, q++;
+  800b76:	83 c1 01             	add    $0x1,%ecx
+  800b79:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  800b7c:	0f b6 01             	movzbl (%ecx),%eax
+  800b7f:	84 c0                	test   %al,%al
+  800b81:	74 04                	je     800b87 <strcmp+0x1c>
+  800b83:	3a 02                	cmp    (%edx),%al
+  800b85:	74 ef                	je     800b76 <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  800b87:	0f b6 c0             	movzbl %al,%eax
+  800b8a:	0f b6 12             	movzbl (%edx),%edx
+  800b8d:	29 d0                	sub    %edx,%eax
+}
+  800b8f:	5d                   	pop    %ebp
+  800b90:	c3                   	ret
+
+00800b91 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800b91:	55                   	push   %ebp
+  800b92:	89 e5                	mov    %esp,%ebp
+  800b94:	53                   	push   %ebx
+  800b95:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b98:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b9b:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  800b9e:	eb 09                	jmp    800ba9 <strncmp+0x18>
+    n--, p++, q++;
+  800ba0:	83 ea 01             	sub    $0x1,%edx
+  800ba3:	83 c0 01             	add    $0x1,%eax
+  800ba6:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  800ba9:	85 d2                	test   %edx,%edx
+  800bab:	74 18                	je     800bc5 <strncmp+0x34>
+  800bad:	0f b6 18             	movzbl (%eax),%ebx
+  800bb0:	84 db                	test   %bl,%bl
+  800bb2:	74 04                	je     800bb8 <strncmp+0x27>
+  800bb4:	3a 19                	cmp    (%ecx),%bl
+  800bb6:	74 e8                	je     800ba0 <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800bb8:	0f b6 00             	movzbl (%eax),%eax
+  800bbb:	0f b6 11             	movzbl (%ecx),%edx
+  800bbe:	29 d0                	sub    %edx,%eax
+}
+  800bc0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800bc3:	c9                   	leave
+  800bc4:	c3                   	ret
+    return 0;
+  800bc5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bca:	eb f4                	jmp    800bc0 <strncmp+0x2f>
+
+00800bcc <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800bcc:	55                   	push   %ebp
+  800bcd:	89 e5                	mov    %esp,%ebp
+  800bcf:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bd2:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800bd6:	eb 03                	jmp    800bdb <strchr+0xf>
+  800bd8:	83 c0 01             	add    $0x1,%eax
+  800bdb:	0f b6 10             	movzbl (%eax),%edx
+  800bde:	84 d2                	test   %dl,%dl
+  800be0:	74 06                	je     800be8 <strchr+0x1c>
+    if (*s == c)
+  800be2:	38 ca                	cmp    %cl,%dl
+  800be4:	75 f2                	jne    800bd8 <strchr+0xc>
+  800be6:	eb 05                	jmp    800bed <strchr+0x21>
+      return (char*)s;
+  return 0;
+  800be8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800bed:	5d                   	pop    %ebp
+  800bee:	c3                   	ret
+
+00800bef <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800bef:	55                   	push   %ebp
+  800bf0:	89 e5                	mov    %esp,%ebp
+  800bf2:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bf5:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800bf9:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  800bfc:	38 ca                	cmp    %cl,%dl
+  800bfe:	74 09                	je     800c09 <strfind+0x1a>
+  800c00:	84 d2                	test   %dl,%dl
+  800c02:	74 05                	je     800c09 <strfind+0x1a>
+  for (; *s; s++)
+  800c04:	83 c0 01             	add    $0x1,%eax
+  800c07:	eb f0                	jmp    800bf9 <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  800c09:	5d                   	pop    %ebp
+  800c0a:	c3                   	ret
+
+00800c0b <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800c0b:	55                   	push   %ebp
+  800c0c:	89 e5                	mov    %esp,%ebp
+  800c0e:	57                   	push   %edi
+  800c0f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800c12:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  800c15:	85 c9                	test   %ecx,%ecx
+  800c17:	74 20                	je     800c39 <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  800c19:	89 f8                	mov    %edi,%eax
+  800c1b:	09 c8                	or     %ecx,%eax
+  800c1d:	a8 03                	test   $0x3,%al
+  800c1f:	75 12                	jne    800c33 <memset+0x28>
+    c &= 0xFF;
+  800c21:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800c25:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  800c2b:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  800c2e:	fc                   	cld
+  800c2f:	f3 ab                	rep stos %eax,%es:(%edi)
+  800c31:	eb 06                	jmp    800c39 <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  800c33:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c36:	fc                   	cld
+  800c37:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  800c39:	89 f8                	mov    %edi,%eax
+  800c3b:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800c3e:	c9                   	leave
+  800c3f:	c3                   	ret
+
+00800c40 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800c40:	55                   	push   %ebp
+  800c41:	89 e5                	mov    %esp,%ebp
+  800c43:	57                   	push   %edi
+  800c44:	56                   	push   %esi
+  800c45:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c48:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800c4b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  800c4e:	39 c6                	cmp    %eax,%esi
+  800c50:	73 32                	jae    800c84 <memmove+0x44>
+  800c52:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800c55:	39 d0                	cmp    %edx,%eax
+  800c57:	73 2b                	jae    800c84 <memmove+0x44>
+    s += n;
+    d += n;
+  800c59:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c5c:	89 d6                	mov    %edx,%esi
+  800c5e:	09 fe                	or     %edi,%esi
+  800c60:	09 ce                	or     %ecx,%esi
+  800c62:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800c68:	75 0e                	jne    800c78 <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800c6a:	83 ef 04             	sub    $0x4,%edi
+  800c6d:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800c70:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  800c73:	fd                   	std
+  800c74:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c76:	eb 09                	jmp    800c81 <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800c78:	83 ef 01             	sub    $0x1,%edi
+  800c7b:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  800c7e:	fd                   	std
+  800c7f:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  800c81:	fc                   	cld
+  800c82:	eb 1a                	jmp    800c9e <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c84:	89 f2                	mov    %esi,%edx
+  800c86:	09 c2                	or     %eax,%edx
+  800c88:	09 ca                	or     %ecx,%edx
+  800c8a:	f6 c2 03             	test   $0x3,%dl
+  800c8d:	75 0a                	jne    800c99 <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800c8f:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  800c92:	89 c7                	mov    %eax,%edi
+  800c94:	fc                   	cld
+  800c95:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c97:	eb 05                	jmp    800c9e <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  800c99:	89 c7                	mov    %eax,%edi
+  800c9b:	fc                   	cld
+  800c9c:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  800c9e:	5e                   	pop    %esi
+  800c9f:	5f                   	pop    %edi
+  800ca0:	5d                   	pop    %ebp
+  800ca1:	c3                   	ret
+
+00800ca2 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800ca2:	55                   	push   %ebp
+  800ca3:	89 e5                	mov    %esp,%ebp
+  800ca5:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  800ca8:	ff 75 10             	push   0x10(%ebp)
+  800cab:	ff 75 0c             	push   0xc(%ebp)
+  800cae:	ff 75 08             	push   0x8(%ebp)
+  800cb1:	e8 8a ff ff ff       	call   800c40 <memmove>
+}
+  800cb6:	c9                   	leave
+  800cb7:	c3                   	ret
+
+00800cb8 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800cb8:	55                   	push   %ebp
+  800cb9:	89 e5                	mov    %esp,%ebp
+  800cbb:	56                   	push   %esi
+  800cbc:	53                   	push   %ebx
+  800cbd:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cc0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  800cc3:	89 c6                	mov    %eax,%esi
+  800cc5:	03 75 10             	add    0x10(%ebp),%esi
+  800cc8:	eb 06                	jmp    800cd0 <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  800cca:	83 c0 01             	add    $0x1,%eax
+  800ccd:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  800cd0:	39 f0                	cmp    %esi,%eax
+  800cd2:	74 14                	je     800ce8 <memcmp+0x30>
+    if (*s1 != *s2)
+  800cd4:	0f b6 08             	movzbl (%eax),%ecx
+  800cd7:	0f b6 1a             	movzbl (%edx),%ebx
+  800cda:	38 d9                	cmp    %bl,%cl
+  800cdc:	74 ec                	je     800cca <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  800cde:	0f b6 c1             	movzbl %cl,%eax
+  800ce1:	0f b6 db             	movzbl %bl,%ebx
+  800ce4:	29 d8                	sub    %ebx,%eax
+  800ce6:	eb 05                	jmp    800ced <memcmp+0x35>
+  }
+
+  return 0;
+  800ce8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ced:	5b                   	pop    %ebx
+  800cee:	5e                   	pop    %esi
+  800cef:	5d                   	pop    %ebp
+  800cf0:	c3                   	ret
+
+00800cf1 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800cf1:	55                   	push   %ebp
+  800cf2:	89 e5                	mov    %esp,%ebp
+  800cf4:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cf7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  800cfa:	89 c2                	mov    %eax,%edx
+  800cfc:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  800cff:	eb 03                	jmp    800d04 <memfind+0x13>
+  800d01:	83 c0 01             	add    $0x1,%eax
+  800d04:	39 d0                	cmp    %edx,%eax
+  800d06:	73 04                	jae    800d0c <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  800d08:	38 08                	cmp    %cl,(%eax)
+  800d0a:	75 f5                	jne    800d01 <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  800d0c:	5d                   	pop    %ebp
+  800d0d:	c3                   	ret
+
+00800d0e <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800d0e:	55                   	push   %ebp
+  800d0f:	89 e5                	mov    %esp,%ebp
+  800d11:	57                   	push   %edi
+  800d12:	56                   	push   %esi
+  800d13:	53                   	push   %ebx
+  800d14:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d17:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  800d1a:	eb 03                	jmp    800d1f <strtol+0x11>
+    s++;
+  800d1c:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  800d1f:	0f b6 02             	movzbl (%edx),%eax
+  800d22:	3c 20                	cmp    $0x20,%al
+  800d24:	74 f6                	je     800d1c <strtol+0xe>
+  800d26:	3c 09                	cmp    $0x9,%al
+  800d28:	74 f2                	je     800d1c <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  800d2a:	3c 2b                	cmp    $0x2b,%al
+  800d2c:	74 2a                	je     800d58 <strtol+0x4a>
+  int neg = 0;
+  800d2e:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  800d33:	3c 2d                	cmp    $0x2d,%al
+  800d35:	74 2b                	je     800d62 <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d37:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800d3d:	75 0f                	jne    800d4e <strtol+0x40>
+  800d3f:	80 3a 30             	cmpb   $0x30,(%edx)
+  800d42:	74 28                	je     800d6c <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  800d44:	85 db                	test   %ebx,%ebx
+  800d46:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d4b:	0f 44 d8             	cmove  %eax,%ebx
+  800d4e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d53:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800d56:	eb 46                	jmp    800d9e <strtol+0x90>
+    s++;
+  800d58:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  800d5b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d60:	eb d5                	jmp    800d37 <strtol+0x29>
+    s++, neg = 1;
+  800d62:	83 c2 01             	add    $0x1,%edx
+  800d65:	bf 01 00 00 00       	mov    $0x1,%edi
+  800d6a:	eb cb                	jmp    800d37 <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d6c:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800d70:	74 0e                	je     800d80 <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  800d72:	85 db                	test   %ebx,%ebx
+  800d74:	75 d8                	jne    800d4e <strtol+0x40>
+    s++, base = 8;
+  800d76:	83 c2 01             	add    $0x1,%edx
+  800d79:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800d7e:	eb ce                	jmp    800d4e <strtol+0x40>
+    s += 2, base = 16;
+  800d80:	83 c2 02             	add    $0x2,%edx
+  800d83:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800d88:	eb c4                	jmp    800d4e <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  800d8a:	0f be c0             	movsbl %al,%eax
+  800d8d:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  800d90:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800d93:	7d 3a                	jge    800dcf <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  800d95:	83 c2 01             	add    $0x1,%edx
+  800d98:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800d9c:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  800d9e:	0f b6 02             	movzbl (%edx),%eax
+  800da1:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800da4:	89 f3                	mov    %esi,%ebx
+  800da6:	80 fb 09             	cmp    $0x9,%bl
+  800da9:	76 df                	jbe    800d8a <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  800dab:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800dae:	89 f3                	mov    %esi,%ebx
+  800db0:	80 fb 19             	cmp    $0x19,%bl
+  800db3:	77 08                	ja     800dbd <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  800db5:	0f be c0             	movsbl %al,%eax
+  800db8:	83 e8 57             	sub    $0x57,%eax
+  800dbb:	eb d3                	jmp    800d90 <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  800dbd:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800dc0:	89 f3                	mov    %esi,%ebx
+  800dc2:	80 fb 19             	cmp    $0x19,%bl
+  800dc5:	77 08                	ja     800dcf <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  800dc7:	0f be c0             	movsbl %al,%eax
+  800dca:	83 e8 37             	sub    $0x37,%eax
+  800dcd:	eb c1                	jmp    800d90 <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  800dcf:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800dd3:	74 05                	je     800dda <strtol+0xcc>
+    *endptr = (char*)s;
+  800dd5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800dd8:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  800dda:	89 c8                	mov    %ecx,%eax
+  800ddc:	f7 d8                	neg    %eax
+  800dde:	85 ff                	test   %edi,%edi
+  800de0:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800de3:	89 c8                	mov    %ecx,%eax
+  800de5:	5b                   	pop    %ebx
+  800de6:	5e                   	pop    %esi
+  800de7:	5f                   	pop    %edi
+  800de8:	5d                   	pop    %ebp
+  800de9:	c3                   	ret
+
+00800dea <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800dea:	55                   	push   %ebp
+  800deb:	89 e5                	mov    %esp,%ebp
+  800ded:	57                   	push   %edi
+  800dee:	56                   	push   %esi
+  800def:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800df0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800df5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dfb:	89 c3                	mov    %eax,%ebx
+  800dfd:	89 c7                	mov    %eax,%edi
+  800dff:	89 c6                	mov    %eax,%esi
+  800e01:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800e03:	5b                   	pop    %ebx
+  800e04:	5e                   	pop    %esi
+  800e05:	5f                   	pop    %edi
+  800e06:	5d                   	pop    %ebp
+  800e07:	c3                   	ret
+
+00800e08 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800e08:	55                   	push   %ebp
+  800e09:	89 e5                	mov    %esp,%ebp
+  800e0b:	57                   	push   %edi
+  800e0c:	56                   	push   %esi
+  800e0d:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e0e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e13:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e18:	89 d1                	mov    %edx,%ecx
+  800e1a:	89 d3                	mov    %edx,%ebx
+  800e1c:	89 d7                	mov    %edx,%edi
+  800e1e:	89 d6                	mov    %edx,%esi
+  800e20:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800e22:	5b                   	pop    %ebx
+  800e23:	5e                   	pop    %esi
+  800e24:	5f                   	pop    %edi
+  800e25:	5d                   	pop    %ebp
+  800e26:	c3                   	ret
+
+00800e27 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800e27:	55                   	push   %ebp
+  800e28:	89 e5                	mov    %esp,%ebp
+  800e2a:	57                   	push   %edi
+  800e2b:	56                   	push   %esi
+  800e2c:	53                   	push   %ebx
+  800e2d:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e30:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e35:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e38:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e3d:	89 cb                	mov    %ecx,%ebx
+  800e3f:	89 cf                	mov    %ecx,%edi
+  800e41:	89 ce                	mov    %ecx,%esi
+  800e43:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e45:	85 c0                	test   %eax,%eax
+  800e47:	7f 08                	jg     800e51 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800e49:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e4c:	5b                   	pop    %ebx
+  800e4d:	5e                   	pop    %esi
+  800e4e:	5f                   	pop    %edi
+  800e4f:	5d                   	pop    %ebp
+  800e50:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e51:	83 ec 0c             	sub    $0xc,%esp
+  800e54:	50                   	push   %eax
+  800e55:	6a 03                	push   $0x3
+  800e57:	68 83 35 80 00       	push   $0x803583
+  800e5c:	6a 23                	push   $0x23
+  800e5e:	68 a0 35 80 00       	push   $0x8035a0
+  800e63:	e8 89 f5 ff ff       	call   8003f1 <_panic>
+
+00800e68 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800e68:	55                   	push   %ebp
+  800e69:	89 e5                	mov    %esp,%ebp
+  800e6b:	57                   	push   %edi
+  800e6c:	56                   	push   %esi
+  800e6d:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e6e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e73:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e78:	89 d1                	mov    %edx,%ecx
+  800e7a:	89 d3                	mov    %edx,%ebx
+  800e7c:	89 d7                	mov    %edx,%edi
+  800e7e:	89 d6                	mov    %edx,%esi
+  800e80:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800e82:	5b                   	pop    %ebx
+  800e83:	5e                   	pop    %esi
+  800e84:	5f                   	pop    %edi
+  800e85:	5d                   	pop    %ebp
+  800e86:	c3                   	ret
+
+00800e87 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800e87:	55                   	push   %ebp
+  800e88:	89 e5                	mov    %esp,%ebp
+  800e8a:	57                   	push   %edi
+  800e8b:	56                   	push   %esi
+  800e8c:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e8d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e92:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e97:	89 d1                	mov    %edx,%ecx
+  800e99:	89 d3                	mov    %edx,%ebx
+  800e9b:	89 d7                	mov    %edx,%edi
+  800e9d:	89 d6                	mov    %edx,%esi
+  800e9f:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800ea1:	5b                   	pop    %ebx
+  800ea2:	5e                   	pop    %esi
+  800ea3:	5f                   	pop    %edi
+  800ea4:	5d                   	pop    %ebp
+  800ea5:	c3                   	ret
+
+00800ea6 <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  800ea6:	55                   	push   %ebp
+  800ea7:	89 e5                	mov    %esp,%ebp
+  800ea9:	57                   	push   %edi
+  800eaa:	56                   	push   %esi
+  800eab:	53                   	push   %ebx
+  800eac:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  800eaf:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  800eb3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eb8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ebb:	b8 14 00 00 00       	mov    $0x14,%eax
+  800ec0:	89 df                	mov    %ebx,%edi
+  800ec2:	89 de                	mov    %ebx,%esi
+  800ec4:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ec6:	85 c0                	test   %eax,%eax
+  800ec8:	7f 08                	jg     800ed2 <sys_env_set_cow+0x2c>
+}
+  800eca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ecd:	5b                   	pop    %ebx
+  800ece:	5e                   	pop    %esi
+  800ecf:	5f                   	pop    %edi
+  800ed0:	5d                   	pop    %ebp
+  800ed1:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ed2:	83 ec 0c             	sub    $0xc,%esp
+  800ed5:	50                   	push   %eax
+  800ed6:	6a 14                	push   $0x14
+  800ed8:	68 83 35 80 00       	push   $0x803583
+  800edd:	6a 23                	push   $0x23
+  800edf:	68 a0 35 80 00       	push   $0x8035a0
+  800ee4:	e8 08 f5 ff ff       	call   8003f1 <_panic>
+
+00800ee9 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800ee9:	55                   	push   %ebp
+  800eea:	89 e5                	mov    %esp,%ebp
+  800eec:	57                   	push   %edi
+  800eed:	56                   	push   %esi
+  800eee:	53                   	push   %ebx
+  800eef:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800ef2:	be 00 00 00 00       	mov    $0x0,%esi
+  800ef7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800efa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800efd:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f02:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f05:	89 f7                	mov    %esi,%edi
+  800f07:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f09:	85 c0                	test   %eax,%eax
+  800f0b:	7f 08                	jg     800f15 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  800f0d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f10:	5b                   	pop    %ebx
+  800f11:	5e                   	pop    %esi
+  800f12:	5f                   	pop    %edi
+  800f13:	5d                   	pop    %ebp
+  800f14:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f15:	83 ec 0c             	sub    $0xc,%esp
+  800f18:	50                   	push   %eax
+  800f19:	6a 04                	push   $0x4
+  800f1b:	68 83 35 80 00       	push   $0x803583
+  800f20:	6a 23                	push   $0x23
+  800f22:	68 a0 35 80 00       	push   $0x8035a0
+  800f27:	e8 c5 f4 ff ff       	call   8003f1 <_panic>
+
+00800f2c <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800f2c:	55                   	push   %ebp
+  800f2d:	89 e5                	mov    %esp,%ebp
+  800f2f:	57                   	push   %edi
+  800f30:	56                   	push   %esi
+  800f31:	53                   	push   %ebx
+  800f32:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f35:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f38:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f3b:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f40:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f43:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f46:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f49:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f4b:	85 c0                	test   %eax,%eax
+  800f4d:	7f 08                	jg     800f57 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  800f4f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f52:	5b                   	pop    %ebx
+  800f53:	5e                   	pop    %esi
+  800f54:	5f                   	pop    %edi
+  800f55:	5d                   	pop    %ebp
+  800f56:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f57:	83 ec 0c             	sub    $0xc,%esp
+  800f5a:	50                   	push   %eax
+  800f5b:	6a 05                	push   $0x5
+  800f5d:	68 83 35 80 00       	push   $0x803583
+  800f62:	6a 23                	push   $0x23
+  800f64:	68 a0 35 80 00       	push   $0x8035a0
+  800f69:	e8 83 f4 ff ff       	call   8003f1 <_panic>
+
+00800f6e <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800f6e:	55                   	push   %ebp
+  800f6f:	89 e5                	mov    %esp,%ebp
+  800f71:	57                   	push   %edi
+  800f72:	56                   	push   %esi
+  800f73:	53                   	push   %ebx
+  800f74:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f77:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f7c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f7f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f82:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f87:	89 df                	mov    %ebx,%edi
+  800f89:	89 de                	mov    %ebx,%esi
+  800f8b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f8d:	85 c0                	test   %eax,%eax
+  800f8f:	7f 08                	jg     800f99 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  800f91:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f94:	5b                   	pop    %ebx
+  800f95:	5e                   	pop    %esi
+  800f96:	5f                   	pop    %edi
+  800f97:	5d                   	pop    %ebp
+  800f98:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f99:	83 ec 0c             	sub    $0xc,%esp
+  800f9c:	50                   	push   %eax
+  800f9d:	6a 06                	push   $0x6
+  800f9f:	68 83 35 80 00       	push   $0x803583
+  800fa4:	6a 23                	push   $0x23
+  800fa6:	68 a0 35 80 00       	push   $0x8035a0
+  800fab:	e8 41 f4 ff ff       	call   8003f1 <_panic>
+
+00800fb0 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  800fb0:	55                   	push   %ebp
+  800fb1:	89 e5                	mov    %esp,%ebp
+  800fb3:	57                   	push   %edi
+  800fb4:	56                   	push   %esi
+  800fb5:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800fb6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fb9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fbc:	b8 11 00 00 00       	mov    $0x11,%eax
+  800fc1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fc4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fc7:	8b 75 18             	mov    0x18(%ebp),%esi
+  800fca:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  800fcc:	5b                   	pop    %ebx
+  800fcd:	5e                   	pop    %esi
+  800fce:	5f                   	pop    %edi
+  800fcf:	5d                   	pop    %ebp
+  800fd0:	c3                   	ret
+
+00800fd1 <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  800fd1:	55                   	push   %ebp
+  800fd2:	89 e5                	mov    %esp,%ebp
+  800fd4:	57                   	push   %edi
+  800fd5:	56                   	push   %esi
+  800fd6:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800fd7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fda:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fdd:	b8 12 00 00 00       	mov    $0x12,%eax
+  800fe2:	be 00 00 00 00       	mov    $0x0,%esi
+  800fe7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fea:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fed:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  800fef:	5b                   	pop    %ebx
+  800ff0:	5e                   	pop    %esi
+  800ff1:	5f                   	pop    %edi
+  800ff2:	5d                   	pop    %ebp
+  800ff3:	c3                   	ret
+
+00800ff4 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  800ff4:	55                   	push   %ebp
+  800ff5:	89 e5                	mov    %esp,%ebp
+  800ff7:	57                   	push   %edi
+  800ff8:	56                   	push   %esi
+  800ff9:	53                   	push   %ebx
+  800ffa:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800ffd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801002:	8b 55 08             	mov    0x8(%ebp),%edx
+  801005:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801008:	b8 16 00 00 00       	mov    $0x16,%eax
+  80100d:	89 df                	mov    %ebx,%edi
+  80100f:	89 de                	mov    %ebx,%esi
+  801011:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801013:	85 c0                	test   %eax,%eax
+  801015:	7f 08                	jg     80101f <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  801017:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80101a:	5b                   	pop    %ebx
+  80101b:	5e                   	pop    %esi
+  80101c:	5f                   	pop    %edi
+  80101d:	5d                   	pop    %ebp
+  80101e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80101f:	83 ec 0c             	sub    $0xc,%esp
+  801022:	50                   	push   %eax
+  801023:	6a 16                	push   $0x16
+  801025:	68 83 35 80 00       	push   $0x803583
+  80102a:	6a 23                	push   $0x23
+  80102c:	68 a0 35 80 00       	push   $0x8035a0
+  801031:	e8 bb f3 ff ff       	call   8003f1 <_panic>
+
+00801036 <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  801036:	55                   	push   %ebp
+  801037:	89 e5                	mov    %esp,%ebp
+  801039:	57                   	push   %edi
+  80103a:	56                   	push   %esi
+  80103b:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80103c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801041:	8b 55 08             	mov    0x8(%ebp),%edx
+  801044:	b8 17 00 00 00       	mov    $0x17,%eax
+  801049:	89 cb                	mov    %ecx,%ebx
+  80104b:	89 cf                	mov    %ecx,%edi
+  80104d:	89 ce                	mov    %ecx,%esi
+  80104f:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  801051:	5b                   	pop    %ebx
+  801052:	5e                   	pop    %esi
+  801053:	5f                   	pop    %edi
+  801054:	5d                   	pop    %ebp
+  801055:	c3                   	ret
+
+00801056 <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  801056:	55                   	push   %ebp
+  801057:	89 e5                	mov    %esp,%ebp
+  801059:	57                   	push   %edi
+  80105a:	56                   	push   %esi
+  80105b:	53                   	push   %ebx
+  80105c:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80105f:	be 00 00 00 00       	mov    $0x0,%esi
+  801064:	8b 55 08             	mov    0x8(%ebp),%edx
+  801067:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80106a:	b8 18 00 00 00       	mov    $0x18,%eax
+  80106f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801072:	89 f7                	mov    %esi,%edi
+  801074:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801076:	85 c0                	test   %eax,%eax
+  801078:	7f 08                	jg     801082 <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  80107a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80107d:	5b                   	pop    %ebx
+  80107e:	5e                   	pop    %esi
+  80107f:	5f                   	pop    %edi
+  801080:	5d                   	pop    %ebp
+  801081:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801082:	83 ec 0c             	sub    $0xc,%esp
+  801085:	50                   	push   %eax
+  801086:	6a 18                	push   $0x18
+  801088:	68 83 35 80 00       	push   $0x803583
+  80108d:	6a 23                	push   $0x23
+  80108f:	68 a0 35 80 00       	push   $0x8035a0
+  801094:	e8 58 f3 ff ff       	call   8003f1 <_panic>
+
+00801099 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  801099:	55                   	push   %ebp
+  80109a:	89 e5                	mov    %esp,%ebp
+  80109c:	57                   	push   %edi
+  80109d:	56                   	push   %esi
+  80109e:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80109f:	be 00 00 00 00       	mov    $0x0,%esi
+  8010a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010aa:	b8 19 00 00 00       	mov    $0x19,%eax
+  8010af:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010b2:	89 f7                	mov    %esi,%edi
+  8010b4:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  8010b6:	5b                   	pop    %ebx
+  8010b7:	5e                   	pop    %esi
+  8010b8:	5f                   	pop    %edi
+  8010b9:	5d                   	pop    %ebp
+  8010ba:	c3                   	ret
+
+008010bb <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  8010bb:	55                   	push   %ebp
+  8010bc:	89 e5                	mov    %esp,%ebp
+  8010be:	57                   	push   %edi
+  8010bf:	56                   	push   %esi
+  8010c0:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8010c1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010c6:	b8 15 00 00 00       	mov    $0x15,%eax
+  8010cb:	89 d1                	mov    %edx,%ecx
+  8010cd:	89 d3                	mov    %edx,%ebx
+  8010cf:	89 d7                	mov    %edx,%edi
+  8010d1:	89 d6                	mov    %edx,%esi
+  8010d3:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8010d5:	5b                   	pop    %ebx
+  8010d6:	5e                   	pop    %esi
+  8010d7:	5f                   	pop    %edi
+  8010d8:	5d                   	pop    %ebp
+  8010d9:	c3                   	ret
+
+008010da <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8010da:	55                   	push   %ebp
+  8010db:	89 e5                	mov    %esp,%ebp
+  8010dd:	57                   	push   %edi
+  8010de:	56                   	push   %esi
+  8010df:	53                   	push   %ebx
+  8010e0:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8010e3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010e8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010eb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ee:	b8 08 00 00 00       	mov    $0x8,%eax
+  8010f3:	89 df                	mov    %ebx,%edi
+  8010f5:	89 de                	mov    %ebx,%esi
+  8010f7:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8010f9:	85 c0                	test   %eax,%eax
+  8010fb:	7f 08                	jg     801105 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8010fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801100:	5b                   	pop    %ebx
+  801101:	5e                   	pop    %esi
+  801102:	5f                   	pop    %edi
+  801103:	5d                   	pop    %ebp
+  801104:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801105:	83 ec 0c             	sub    $0xc,%esp
+  801108:	50                   	push   %eax
+  801109:	6a 08                	push   $0x8
+  80110b:	68 83 35 80 00       	push   $0x803583
+  801110:	6a 23                	push   $0x23
+  801112:	68 a0 35 80 00       	push   $0x8035a0
+  801117:	e8 d5 f2 ff ff       	call   8003f1 <_panic>
+
+0080111c <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80111c:	55                   	push   %ebp
+  80111d:	89 e5                	mov    %esp,%ebp
+  80111f:	57                   	push   %edi
+  801120:	56                   	push   %esi
+  801121:	53                   	push   %ebx
+  801122:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801125:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80112a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80112d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801130:	b8 09 00 00 00       	mov    $0x9,%eax
+  801135:	89 df                	mov    %ebx,%edi
+  801137:	89 de                	mov    %ebx,%esi
+  801139:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80113b:	85 c0                	test   %eax,%eax
+  80113d:	7f 08                	jg     801147 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  80113f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801142:	5b                   	pop    %ebx
+  801143:	5e                   	pop    %esi
+  801144:	5f                   	pop    %edi
+  801145:	5d                   	pop    %ebp
+  801146:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801147:	83 ec 0c             	sub    $0xc,%esp
+  80114a:	50                   	push   %eax
+  80114b:	6a 09                	push   $0x9
+  80114d:	68 83 35 80 00       	push   $0x803583
+  801152:	6a 23                	push   $0x23
+  801154:	68 a0 35 80 00       	push   $0x8035a0
+  801159:	e8 93 f2 ff ff       	call   8003f1 <_panic>
+
+0080115e <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80115e:	55                   	push   %ebp
+  80115f:	89 e5                	mov    %esp,%ebp
+  801161:	57                   	push   %edi
+  801162:	56                   	push   %esi
+  801163:	53                   	push   %ebx
+  801164:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801167:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80116c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80116f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801172:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801177:	89 df                	mov    %ebx,%edi
+  801179:	89 de                	mov    %ebx,%esi
+  80117b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80117d:	85 c0                	test   %eax,%eax
+  80117f:	7f 08                	jg     801189 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  801181:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801184:	5b                   	pop    %ebx
+  801185:	5e                   	pop    %esi
+  801186:	5f                   	pop    %edi
+  801187:	5d                   	pop    %ebp
+  801188:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801189:	83 ec 0c             	sub    $0xc,%esp
+  80118c:	50                   	push   %eax
+  80118d:	6a 0a                	push   $0xa
+  80118f:	68 83 35 80 00       	push   $0x803583
+  801194:	6a 23                	push   $0x23
+  801196:	68 a0 35 80 00       	push   $0x8035a0
+  80119b:	e8 51 f2 ff ff       	call   8003f1 <_panic>
+
+008011a0 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  8011a0:	55                   	push   %ebp
+  8011a1:	89 e5                	mov    %esp,%ebp
+  8011a3:	57                   	push   %edi
+  8011a4:	56                   	push   %esi
+  8011a5:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8011a6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011a9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ac:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8011b1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011b4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011b7:	8b 75 18             	mov    0x18(%ebp),%esi
+  8011ba:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  8011bc:	5b                   	pop    %ebx
+  8011bd:	5e                   	pop    %esi
+  8011be:	5f                   	pop    %edi
+  8011bf:	5d                   	pop    %ebp
+  8011c0:	c3                   	ret
+
+008011c1 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  8011c1:	55                   	push   %ebp
+  8011c2:	89 e5                	mov    %esp,%ebp
+  8011c4:	57                   	push   %edi
+  8011c5:	56                   	push   %esi
+  8011c6:	53                   	push   %ebx
+  8011c7:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8011ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011cf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011d5:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011da:	89 df                	mov    %ebx,%edi
+  8011dc:	89 de                	mov    %ebx,%esi
+  8011de:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8011e0:	85 c0                	test   %eax,%eax
+  8011e2:	7f 08                	jg     8011ec <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  8011e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011e7:	5b                   	pop    %ebx
+  8011e8:	5e                   	pop    %esi
+  8011e9:	5f                   	pop    %edi
+  8011ea:	5d                   	pop    %ebp
+  8011eb:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8011ec:	83 ec 0c             	sub    $0xc,%esp
+  8011ef:	50                   	push   %eax
+  8011f0:	6a 0d                	push   $0xd
+  8011f2:	68 83 35 80 00       	push   $0x803583
+  8011f7:	6a 23                	push   $0x23
+  8011f9:	68 a0 35 80 00       	push   $0x8035a0
+  8011fe:	e8 ee f1 ff ff       	call   8003f1 <_panic>
+
+00801203 <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  801203:	55                   	push   %ebp
+  801204:	89 e5                	mov    %esp,%ebp
+  801206:	57                   	push   %edi
+  801207:	56                   	push   %esi
+  801208:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801209:	ba 00 00 00 00       	mov    $0x0,%edx
+  80120e:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801213:	89 d1                	mov    %edx,%ecx
+  801215:	89 d3                	mov    %edx,%ebx
+  801217:	89 d7                	mov    %edx,%edi
+  801219:	89 d6                	mov    %edx,%esi
+  80121b:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  80121d:	5b                   	pop    %ebx
+  80121e:	5e                   	pop    %esi
+  80121f:	5f                   	pop    %edi
+  801220:	5d                   	pop    %ebp
+  801221:	c3                   	ret
+
+00801222 <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  801222:	55                   	push   %ebp
+  801223:	89 e5                	mov    %esp,%ebp
+  801225:	57                   	push   %edi
+  801226:	56                   	push   %esi
+  801227:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801228:	8b 55 08             	mov    0x8(%ebp),%edx
+  80122b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80122e:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801233:	be 00 00 00 00       	mov    $0x0,%esi
+  801238:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80123b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80123e:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  801240:	5b                   	pop    %ebx
+  801241:	5e                   	pop    %esi
+  801242:	5f                   	pop    %edi
+  801243:	5d                   	pop    %ebp
+  801244:	c3                   	ret
+
+00801245 <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  801245:	55                   	push   %ebp
+  801246:	89 e5                	mov    %esp,%ebp
+  801248:	57                   	push   %edi
+  801249:	56                   	push   %esi
+  80124a:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80124b:	be 00 00 00 00       	mov    $0x0,%esi
+  801250:	8b 55 08             	mov    0x8(%ebp),%edx
+  801253:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801256:	b8 10 00 00 00       	mov    $0x10,%eax
+  80125b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80125e:	89 f7                	mov    %esi,%edi
+  801260:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  801262:	5b                   	pop    %ebx
+  801263:	5e                   	pop    %esi
+  801264:	5f                   	pop    %edi
+  801265:	5d                   	pop    %ebp
+  801266:	c3                   	ret
+
+00801267 <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  801267:	55                   	push   %ebp
+  801268:	89 e5                	mov    %esp,%ebp
+  80126a:	57                   	push   %edi
+  80126b:	56                   	push   %esi
+  80126c:	53                   	push   %ebx
+  80126d:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  801270:	80 3d 68 67 80 00 00 	cmpb   $0x0,0x806768
+  801277:	74 41                	je     8012ba <sys_batch+0x53>
+  801279:	8b 45 08             	mov    0x8(%ebp),%eax
+  80127c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  80127f:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  801286:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801289:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  80128c:	7d 45                	jge    8012d3 <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  80128e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801291:	8b 06                	mov    (%esi),%eax
+  801293:	8b 56 04             	mov    0x4(%esi),%edx
+  801296:	8b 4e 08             	mov    0x8(%esi),%ecx
+  801299:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  80129c:	8b 7e 10             	mov    0x10(%esi),%edi
+  80129f:	8b 76 14             	mov    0x14(%esi),%esi
+  8012a2:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  8012a4:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8012a7:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  8012aa:	83 c6 1c             	add    $0x1c,%esi
+  8012ad:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  8012b0:	85 c0                	test   %eax,%eax
+  8012b2:	78 1f                	js     8012d3 <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  8012b4:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  8012b8:	eb cc                	jmp    801286 <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  8012ba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012bf:	b8 13 00 00 00       	mov    $0x13,%eax
+  8012c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012ca:	89 df                	mov    %ebx,%edi
+  8012cc:	89 de                	mov    %ebx,%esi
+  8012ce:	cd 30                	int    $0x30
+  8012d0:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  8012d3:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8012d6:	83 c4 08             	add    $0x8,%esp
+  8012d9:	5b                   	pop    %ebx
+  8012da:	5e                   	pop    %esi
+  8012db:	5f                   	pop    %edi
+  8012dc:	5d                   	pop    %ebp
+  8012dd:	c3                   	ret
+
+008012de <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  8012de:	55                   	push   %ebp
+  8012df:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  8012e1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8012e4:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8012ea:	5d                   	pop    %ebp
+  8012eb:	c3                   	ret
+
+008012ec <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  8012ec:	55                   	push   %ebp
+  8012ed:	89 e5                	mov    %esp,%ebp
+  8012ef:	56                   	push   %esi
+  8012f0:	53                   	push   %ebx
+  8012f1:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  8012f4:	8b 1e                	mov    (%esi),%ebx
+  8012f6:	85 db                	test   %ebx,%ebx
+  8012f8:	75 09                	jne    801303 <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  8012fa:	89 d8                	mov    %ebx,%eax
+  8012fc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8012ff:	5b                   	pop    %ebx
+  801300:	5e                   	pop    %esi
+  801301:	5d                   	pop    %ebp
+  801302:	c3                   	ret
+  b->sb_n = 0;
+  801303:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  801309:	53                   	push   %ebx
+  80130a:	8d 46 04             	lea    0x4(%esi),%eax
+  80130d:	50                   	push   %eax
+  80130e:	e8 54 ff ff ff       	call   801267 <sys_batch>
+  801313:	83 c4 08             	add    $0x8,%esp
+  801316:	85 c0                	test   %eax,%eax
+  801318:	78 1e                	js     801338 <sysbatch_flush+0x4c>
+  if (r < n)
+  80131a:	39 c3                	cmp    %eax,%ebx
+  80131c:	7f 07                	jg     801325 <sysbatch_flush+0x39>
+  return 0;
+  80131e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801323:	eb d5                	jmp    8012fa <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  801325:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801328:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  80132c:	85 db                	test   %ebx,%ebx
+  80132e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801333:	0f 49 d8             	cmovns %eax,%ebx
+  801336:	eb c2                	jmp    8012fa <sysbatch_flush+0xe>
+    return r;
+  801338:	89 c3                	mov    %eax,%ebx
+  80133a:	eb be                	jmp    8012fa <sysbatch_flush+0xe>
+
+0080133c <sysbatch_add>:
+{
+  80133c:	55                   	push   %ebp
+  80133d:	89 e5                	mov    %esp,%ebp
+  80133f:	53                   	push   %ebx
+  801340:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  801343:	83 3b 40             	cmpl   $0x40,(%ebx)
+  801346:	74 41                	je     801389 <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  801348:	8b 03                	mov    (%ebx),%eax
+  80134a:	8d 50 01             	lea    0x1(%eax),%edx
+  80134d:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  80134f:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801352:	01 d8                	add    %ebx,%eax
+  801354:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801357:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  80135a:	8b 55 10             	mov    0x10(%ebp),%edx
+  80135d:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  801360:	8b 55 14             	mov    0x14(%ebp),%edx
+  801363:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  801366:	8b 55 18             	mov    0x18(%ebp),%edx
+  801369:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  80136c:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  80136f:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  801372:	8b 55 20             	mov    0x20(%ebp),%edx
+  801375:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  801378:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  80137f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801384:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801387:	c9                   	leave
+  801388:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  801389:	53                   	push   %ebx
+  80138a:	e8 5d ff ff ff       	call   8012ec <sysbatch_flush>
+  80138f:	83 c4 04             	add    $0x4,%esp
+  801392:	85 c0                	test   %eax,%eax
+  801394:	79 b2                	jns    801348 <sysbatch_add+0xc>
+  801396:	eb ec                	jmp    801384 <sysbatch_add+0x48>
+
+00801398 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801398:	55                   	push   %ebp
+  801399:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80139b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80139e:	05 00 00 00 30       	add    $0x30000000,%eax
+  8013a3:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8013a6:	5d                   	pop    %ebp
+  8013a7:	c3                   	ret
+
+008013a8 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8013a8:	55                   	push   %ebp
+  8013a9:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8013ab:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013ae:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  8013b1:	66 b8 00 00          	mov    $0x0,%ax
+  8013b5:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8013ba:	5d                   	pop    %ebp
+  8013bb:	c3                   	ret
+
+008013bc <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8013bc:	55                   	push   %ebp
+  8013bd:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  8013bf:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8013c4:	eb 02                	jmp    8013c8 <fd_alloc+0xc>
+  8013c6:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8013c8:	89 c2                	mov    %eax,%edx
+  8013ca:	c1 ea 16             	shr    $0x16,%edx
+  8013cd:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8013d4:	f6 c2 01             	test   $0x1,%dl
+  8013d7:	74 2b                	je     801404 <fd_alloc+0x48>
+  8013d9:	89 c2                	mov    %eax,%edx
+  8013db:	c1 ea 0c             	shr    $0xc,%edx
+  8013de:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8013e5:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8013eb:	f6 c1 01             	test   $0x1,%cl
+  8013ee:	74 14                	je     801404 <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  8013f0:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8013f6:	75 ce                	jne    8013c6 <fd_alloc+0xa>
+  8013f8:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  8013fd:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801402:	eb 05                	jmp    801409 <fd_alloc+0x4d>
+      return 0;
+  801404:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  801409:	8b 55 08             	mov    0x8(%ebp),%edx
+  80140c:	89 02                	mov    %eax,(%edx)
+}
+  80140e:	89 c8                	mov    %ecx,%eax
+  801410:	5d                   	pop    %ebp
+  801411:	c3                   	ret
+
+00801412 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801412:	55                   	push   %ebp
+  801413:	89 e5                	mov    %esp,%ebp
+  801415:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  801418:	83 f8 1f             	cmp    $0x1f,%eax
+  80141b:	77 30                	ja     80144d <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  80141d:	c1 e0 0c             	shl    $0xc,%eax
+  801420:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801425:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80142b:	f6 c2 01             	test   $0x1,%dl
+  80142e:	74 24                	je     801454 <fd_lookup+0x42>
+  801430:	89 c2                	mov    %eax,%edx
+  801432:	c1 ea 0c             	shr    $0xc,%edx
+  801435:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80143c:	f6 c2 01             	test   $0x1,%dl
+  80143f:	74 1a                	je     80145b <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  801441:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801444:	89 02                	mov    %eax,(%edx)
+  return 0;
+  801446:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80144b:	5d                   	pop    %ebp
+  80144c:	c3                   	ret
+    return -E_INVAL;
+  80144d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801452:	eb f7                	jmp    80144b <fd_lookup+0x39>
+    return -E_INVAL;
+  801454:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801459:	eb f0                	jmp    80144b <fd_lookup+0x39>
+  80145b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801460:	eb e9                	jmp    80144b <fd_lookup+0x39>
+
+00801462 <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801462:	55                   	push   %ebp
+  801463:	89 e5                	mov    %esp,%ebp
+  801465:	53                   	push   %ebx
+  801466:	83 ec 04             	sub    $0x4,%esp
+  801469:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  80146c:	b8 2c 36 80 00       	mov    $0x80362c,%eax
+  801471:	8b 18                	mov    (%eax),%ebx
+  801473:	85 db                	test   %ebx,%ebx
+  801475:	74 0e                	je     801485 <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  801477:	83 c0 04             	add    $0x4,%eax
+  80147a:	39 13                	cmp    %edx,(%ebx)
+  80147c:	75 f3                	jne    801471 <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  80147e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801483:	eb 1f                	jmp    8014a4 <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801485:	a1 64 67 80 00       	mov    0x806764,%eax
+  80148a:	8b 40 48             	mov    0x48(%eax),%eax
+  80148d:	83 ec 04             	sub    $0x4,%esp
+  801490:	52                   	push   %edx
+  801491:	50                   	push   %eax
+  801492:	68 b0 35 80 00       	push   $0x8035b0
+  801497:	e8 30 f0 ff ff       	call   8004cc <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  80149c:	83 c4 10             	add    $0x10,%esp
+  80149f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  8014a4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8014a7:	89 1a                	mov    %ebx,(%edx)
+}
+  8014a9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014ac:	c9                   	leave
+  8014ad:	c3                   	ret
+
+008014ae <fd_close>:
+{
+  8014ae:	55                   	push   %ebp
+  8014af:	89 e5                	mov    %esp,%ebp
+  8014b1:	57                   	push   %edi
+  8014b2:	56                   	push   %esi
+  8014b3:	53                   	push   %ebx
+  8014b4:	83 ec 24             	sub    $0x24,%esp
+  8014b7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8014ba:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8014bd:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8014c0:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8014c1:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8014c7:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8014ca:	50                   	push   %eax
+  8014cb:	e8 42 ff ff ff       	call   801412 <fd_lookup>
+  8014d0:	89 c3                	mov    %eax,%ebx
+  8014d2:	83 c4 10             	add    $0x10,%esp
+  8014d5:	85 c0                	test   %eax,%eax
+  8014d7:	78 05                	js     8014de <fd_close+0x30>
+      || fd != fd2)
+  8014d9:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8014dc:	74 16                	je     8014f4 <fd_close+0x46>
+    return must_exist ? r : 0;
+  8014de:	89 f8                	mov    %edi,%eax
+  8014e0:	84 c0                	test   %al,%al
+  8014e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014e7:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8014ea:	89 d8                	mov    %ebx,%eax
+  8014ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014ef:	5b                   	pop    %ebx
+  8014f0:	5e                   	pop    %esi
+  8014f1:	5f                   	pop    %edi
+  8014f2:	5d                   	pop    %ebp
+  8014f3:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8014f4:	83 ec 08             	sub    $0x8,%esp
+  8014f7:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8014fa:	50                   	push   %eax
+  8014fb:	ff 36                	push   (%esi)
+  8014fd:	e8 60 ff ff ff       	call   801462 <dev_lookup>
+  801502:	89 c3                	mov    %eax,%ebx
+  801504:	83 c4 10             	add    $0x10,%esp
+  801507:	85 c0                	test   %eax,%eax
+  801509:	78 1a                	js     801525 <fd_close+0x77>
+    if (dev->dev_close)
+  80150b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80150e:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  801511:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  801516:	85 c0                	test   %eax,%eax
+  801518:	74 0b                	je     801525 <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  80151a:	83 ec 0c             	sub    $0xc,%esp
+  80151d:	56                   	push   %esi
+  80151e:	ff d0                	call   *%eax
+  801520:	89 c3                	mov    %eax,%ebx
+  801522:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  801525:	83 ec 08             	sub    $0x8,%esp
+  801528:	56                   	push   %esi
+  801529:	6a 00                	push   $0x0
+  80152b:	e8 3e fa ff ff       	call   800f6e <sys_page_unmap>
+  return r;
+  801530:	83 c4 10             	add    $0x10,%esp
+  801533:	eb b5                	jmp    8014ea <fd_close+0x3c>
+
+00801535 <close>:
+
+int
+close(int fdnum)
+{
+  801535:	55                   	push   %ebp
+  801536:	89 e5                	mov    %esp,%ebp
+  801538:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80153b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80153e:	50                   	push   %eax
+  80153f:	ff 75 08             	push   0x8(%ebp)
+  801542:	e8 cb fe ff ff       	call   801412 <fd_lookup>
+  801547:	83 c4 10             	add    $0x10,%esp
+  80154a:	85 c0                	test   %eax,%eax
+  80154c:	79 02                	jns    801550 <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  80154e:	c9                   	leave
+  80154f:	c3                   	ret
+    return fd_close(fd, 1);
+  801550:	83 ec 08             	sub    $0x8,%esp
+  801553:	6a 01                	push   $0x1
+  801555:	ff 75 f4             	push   -0xc(%ebp)
+  801558:	e8 51 ff ff ff       	call   8014ae <fd_close>
+  80155d:	83 c4 10             	add    $0x10,%esp
+  801560:	eb ec                	jmp    80154e <close+0x19>
+
+00801562 <close_all>:
+
+void
+close_all(void)
+{
+  801562:	55                   	push   %ebp
+  801563:	89 e5                	mov    %esp,%ebp
+  801565:	53                   	push   %ebx
+  801566:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  801569:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  80156e:	83 ec 0c             	sub    $0xc,%esp
+  801571:	53                   	push   %ebx
+  801572:	e8 be ff ff ff       	call   801535 <close>
+  for (i = 0; i < MAXFD; i++)
+  801577:	83 c3 01             	add    $0x1,%ebx
+  80157a:	83 c4 10             	add    $0x10,%esp
+  80157d:	83 fb 20             	cmp    $0x20,%ebx
+  801580:	75 ec                	jne    80156e <close_all+0xc>
+}
+  801582:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801585:	c9                   	leave
+  801586:	c3                   	ret
+
+00801587 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801587:	55                   	push   %ebp
+  801588:	89 e5                	mov    %esp,%ebp
+  80158a:	57                   	push   %edi
+  80158b:	56                   	push   %esi
+  80158c:	53                   	push   %ebx
+  80158d:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801590:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801593:	50                   	push   %eax
+  801594:	ff 75 08             	push   0x8(%ebp)
+  801597:	e8 76 fe ff ff       	call   801412 <fd_lookup>
+  80159c:	89 c6                	mov    %eax,%esi
+  80159e:	83 c4 10             	add    $0x10,%esp
+  8015a1:	85 c0                	test   %eax,%eax
+  8015a3:	0f 88 0a 01 00 00    	js     8016b3 <dup+0x12c>
+    return r;
+  close(newfdnum);
+  8015a9:	83 ec 0c             	sub    $0xc,%esp
+  8015ac:	ff 75 0c             	push   0xc(%ebp)
+  8015af:	e8 81 ff ff ff       	call   801535 <close>
+
+  newfd = INDEX2FD(newfdnum);
+  8015b4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8015b7:	c1 e0 0c             	shl    $0xc,%eax
+  8015ba:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  8015c0:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  8015c3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8015c6:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8015c9:	89 04 24             	mov    %eax,(%esp)
+  8015cc:	e8 d7 fd ff ff       	call   8013a8 <fd2data>
+  8015d1:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  8015d3:	89 3c 24             	mov    %edi,(%esp)
+  8015d6:	e8 cd fd ff ff       	call   8013a8 <fd2data>
+  8015db:	83 c4 10             	add    $0x10,%esp
+  8015de:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8015e1:	89 f3                	mov    %esi,%ebx
+  8015e3:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  8015e9:	89 c6                	mov    %eax,%esi
+  8015eb:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8015ee:	89 cf                	mov    %ecx,%edi
+  8015f0:	eb 0c                	jmp    8015fe <dup+0x77>
+  8015f2:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8015f8:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8015fe:	39 fb                	cmp    %edi,%ebx
+  801600:	74 7b                	je     80167d <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  801602:	89 d8                	mov    %ebx,%eax
+  801604:	c1 e8 16             	shr    $0x16,%eax
+  801607:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80160e:	a8 01                	test   $0x1,%al
+  801610:	74 e0                	je     8015f2 <dup+0x6b>
+  801612:	89 d8                	mov    %ebx,%eax
+  801614:	c1 e8 0c             	shr    $0xc,%eax
+  801617:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80161e:	f6 c2 01             	test   $0x1,%dl
+  801621:	74 cf                	je     8015f2 <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  801623:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  80162a:	83 ec 0c             	sub    $0xc,%esp
+  80162d:	25 07 0e 00 00       	and    $0xe07,%eax
+  801632:	50                   	push   %eax
+  801633:	56                   	push   %esi
+  801634:	6a 00                	push   $0x0
+  801636:	53                   	push   %ebx
+  801637:	6a 00                	push   $0x0
+  801639:	e8 ee f8 ff ff       	call   800f2c <sys_page_map>
+  80163e:	83 c4 20             	add    $0x20,%esp
+  801641:	85 c0                	test   %eax,%eax
+  801643:	79 ad                	jns    8015f2 <dup+0x6b>
+  801645:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801648:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  80164a:	83 ec 08             	sub    $0x8,%esp
+  80164d:	ff 75 d4             	push   -0x2c(%ebp)
+  801650:	6a 00                	push   $0x0
+  801652:	e8 17 f9 ff ff       	call   800f6e <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801657:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  80165a:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  801660:	83 c4 10             	add    $0x10,%esp
+  801663:	39 df                	cmp    %ebx,%edi
+  801665:	74 4c                	je     8016b3 <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  801667:	83 ec 08             	sub    $0x8,%esp
+  80166a:	57                   	push   %edi
+  80166b:	6a 00                	push   $0x0
+  80166d:	e8 fc f8 ff ff       	call   800f6e <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801672:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  801678:	83 c4 10             	add    $0x10,%esp
+  80167b:	eb e6                	jmp    801663 <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80167d:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801680:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  801683:	89 c8                	mov    %ecx,%eax
+  801685:	c1 e8 0c             	shr    $0xc,%eax
+  801688:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80168f:	83 ec 0c             	sub    $0xc,%esp
+  801692:	25 07 0e 00 00       	and    $0xe07,%eax
+  801697:	50                   	push   %eax
+  801698:	ff 75 d4             	push   -0x2c(%ebp)
+  80169b:	6a 00                	push   $0x0
+  80169d:	51                   	push   %ecx
+  80169e:	6a 00                	push   $0x0
+  8016a0:	e8 87 f8 ff ff       	call   800f2c <sys_page_map>
+  8016a5:	89 c6                	mov    %eax,%esi
+  8016a7:	83 c4 20             	add    $0x20,%esp
+  8016aa:	85 c0                	test   %eax,%eax
+  8016ac:	78 9c                	js     80164a <dup+0xc3>
+  return newfdnum;
+  8016ae:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8016b1:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  8016b3:	89 f0                	mov    %esi,%eax
+  8016b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016b8:	5b                   	pop    %ebx
+  8016b9:	5e                   	pop    %esi
+  8016ba:	5f                   	pop    %edi
+  8016bb:	5d                   	pop    %ebp
+  8016bc:	c3                   	ret
+
+008016bd <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8016bd:	55                   	push   %ebp
+  8016be:	89 e5                	mov    %esp,%ebp
+  8016c0:	56                   	push   %esi
+  8016c1:	53                   	push   %ebx
+  8016c2:	83 ec 18             	sub    $0x18,%esp
+  8016c5:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016c8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016cb:	50                   	push   %eax
+  8016cc:	56                   	push   %esi
+  8016cd:	e8 40 fd ff ff       	call   801412 <fd_lookup>
+  8016d2:	83 c4 10             	add    $0x10,%esp
+  8016d5:	85 c0                	test   %eax,%eax
+  8016d7:	78 3c                	js     801715 <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8016d9:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8016dc:	83 ec 08             	sub    $0x8,%esp
+  8016df:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016e2:	50                   	push   %eax
+  8016e3:	ff 33                	push   (%ebx)
+  8016e5:	e8 78 fd ff ff       	call   801462 <dev_lookup>
+  8016ea:	83 c4 10             	add    $0x10,%esp
+  8016ed:	85 c0                	test   %eax,%eax
+  8016ef:	78 24                	js     801715 <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8016f1:	8b 43 08             	mov    0x8(%ebx),%eax
+  8016f4:	83 e0 03             	and    $0x3,%eax
+  8016f7:	83 f8 01             	cmp    $0x1,%eax
+  8016fa:	74 20                	je     80171c <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  8016fc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016ff:	8b 40 08             	mov    0x8(%eax),%eax
+  801702:	85 c0                	test   %eax,%eax
+  801704:	74 37                	je     80173d <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  801706:	83 ec 04             	sub    $0x4,%esp
+  801709:	ff 75 10             	push   0x10(%ebp)
+  80170c:	ff 75 0c             	push   0xc(%ebp)
+  80170f:	53                   	push   %ebx
+  801710:	ff d0                	call   *%eax
+  801712:	83 c4 10             	add    $0x10,%esp
+}
+  801715:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801718:	5b                   	pop    %ebx
+  801719:	5e                   	pop    %esi
+  80171a:	5d                   	pop    %ebp
+  80171b:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80171c:	a1 64 67 80 00       	mov    0x806764,%eax
+  801721:	8b 40 48             	mov    0x48(%eax),%eax
+  801724:	83 ec 04             	sub    $0x4,%esp
+  801727:	56                   	push   %esi
+  801728:	50                   	push   %eax
+  801729:	68 f1 35 80 00       	push   $0x8035f1
+  80172e:	e8 99 ed ff ff       	call   8004cc <cprintf>
+    return -E_INVAL;
+  801733:	83 c4 10             	add    $0x10,%esp
+  801736:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80173b:	eb d8                	jmp    801715 <read+0x58>
+    return -E_NOT_SUPP;
+  80173d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801742:	eb d1                	jmp    801715 <read+0x58>
+
+00801744 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801744:	55                   	push   %ebp
+  801745:	89 e5                	mov    %esp,%ebp
+  801747:	57                   	push   %edi
+  801748:	56                   	push   %esi
+  801749:	53                   	push   %ebx
+  80174a:	83 ec 0c             	sub    $0xc,%esp
+  80174d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801750:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  801753:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801758:	eb 02                	jmp    80175c <readn+0x18>
+  80175a:	01 c3                	add    %eax,%ebx
+  80175c:	39 f3                	cmp    %esi,%ebx
+  80175e:	73 21                	jae    801781 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  801760:	83 ec 04             	sub    $0x4,%esp
+  801763:	89 f0                	mov    %esi,%eax
+  801765:	29 d8                	sub    %ebx,%eax
+  801767:	50                   	push   %eax
+  801768:	89 d8                	mov    %ebx,%eax
+  80176a:	03 45 0c             	add    0xc(%ebp),%eax
+  80176d:	50                   	push   %eax
+  80176e:	57                   	push   %edi
+  80176f:	e8 49 ff ff ff       	call   8016bd <read>
+    if (m < 0)
+  801774:	83 c4 10             	add    $0x10,%esp
+  801777:	85 c0                	test   %eax,%eax
+  801779:	78 04                	js     80177f <readn+0x3b>
+      return m;
+    if (m == 0)
+  80177b:	75 dd                	jne    80175a <readn+0x16>
+  80177d:	eb 02                	jmp    801781 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  80177f:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  801781:	89 d8                	mov    %ebx,%eax
+  801783:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801786:	5b                   	pop    %ebx
+  801787:	5e                   	pop    %esi
+  801788:	5f                   	pop    %edi
+  801789:	5d                   	pop    %ebp
+  80178a:	c3                   	ret
+
+0080178b <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80178b:	55                   	push   %ebp
+  80178c:	89 e5                	mov    %esp,%ebp
+  80178e:	56                   	push   %esi
+  80178f:	53                   	push   %ebx
+  801790:	83 ec 18             	sub    $0x18,%esp
+  801793:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801796:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801799:	50                   	push   %eax
+  80179a:	53                   	push   %ebx
+  80179b:	e8 72 fc ff ff       	call   801412 <fd_lookup>
+  8017a0:	83 c4 10             	add    $0x10,%esp
+  8017a3:	85 c0                	test   %eax,%eax
+  8017a5:	78 37                	js     8017de <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017a7:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8017aa:	83 ec 08             	sub    $0x8,%esp
+  8017ad:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017b0:	50                   	push   %eax
+  8017b1:	ff 36                	push   (%esi)
+  8017b3:	e8 aa fc ff ff       	call   801462 <dev_lookup>
+  8017b8:	83 c4 10             	add    $0x10,%esp
+  8017bb:	85 c0                	test   %eax,%eax
+  8017bd:	78 1f                	js     8017de <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8017bf:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8017c3:	74 20                	je     8017e5 <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  8017c5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017c8:	8b 40 0c             	mov    0xc(%eax),%eax
+  8017cb:	85 c0                	test   %eax,%eax
+  8017cd:	74 37                	je     801806 <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  8017cf:	83 ec 04             	sub    $0x4,%esp
+  8017d2:	ff 75 10             	push   0x10(%ebp)
+  8017d5:	ff 75 0c             	push   0xc(%ebp)
+  8017d8:	56                   	push   %esi
+  8017d9:	ff d0                	call   *%eax
+  8017db:	83 c4 10             	add    $0x10,%esp
+}
+  8017de:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017e1:	5b                   	pop    %ebx
+  8017e2:	5e                   	pop    %esi
+  8017e3:	5d                   	pop    %ebp
+  8017e4:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8017e5:	a1 64 67 80 00       	mov    0x806764,%eax
+  8017ea:	8b 40 48             	mov    0x48(%eax),%eax
+  8017ed:	83 ec 04             	sub    $0x4,%esp
+  8017f0:	53                   	push   %ebx
+  8017f1:	50                   	push   %eax
+  8017f2:	68 0d 36 80 00       	push   $0x80360d
+  8017f7:	e8 d0 ec ff ff       	call   8004cc <cprintf>
+    return -E_INVAL;
+  8017fc:	83 c4 10             	add    $0x10,%esp
+  8017ff:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801804:	eb d8                	jmp    8017de <write+0x53>
+    return -E_NOT_SUPP;
+  801806:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80180b:	eb d1                	jmp    8017de <write+0x53>
+
+0080180d <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80180d:	55                   	push   %ebp
+  80180e:	89 e5                	mov    %esp,%ebp
+  801810:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801813:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801816:	50                   	push   %eax
+  801817:	ff 75 08             	push   0x8(%ebp)
+  80181a:	e8 f3 fb ff ff       	call   801412 <fd_lookup>
+  80181f:	83 c4 10             	add    $0x10,%esp
+  801822:	85 c0                	test   %eax,%eax
+  801824:	78 0e                	js     801834 <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  801826:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801829:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80182c:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  80182f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801834:	c9                   	leave
+  801835:	c3                   	ret
+
+00801836 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801836:	55                   	push   %ebp
+  801837:	89 e5                	mov    %esp,%ebp
+  801839:	56                   	push   %esi
+  80183a:	53                   	push   %ebx
+  80183b:	83 ec 18             	sub    $0x18,%esp
+  80183e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801841:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801844:	50                   	push   %eax
+  801845:	53                   	push   %ebx
+  801846:	e8 c7 fb ff ff       	call   801412 <fd_lookup>
+  80184b:	83 c4 10             	add    $0x10,%esp
+  80184e:	85 c0                	test   %eax,%eax
+  801850:	78 34                	js     801886 <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801852:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801855:	83 ec 08             	sub    $0x8,%esp
+  801858:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80185b:	50                   	push   %eax
+  80185c:	ff 36                	push   (%esi)
+  80185e:	e8 ff fb ff ff       	call   801462 <dev_lookup>
+  801863:	83 c4 10             	add    $0x10,%esp
+  801866:	85 c0                	test   %eax,%eax
+  801868:	78 1c                	js     801886 <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80186a:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80186e:	74 1d                	je     80188d <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  801870:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801873:	8b 40 18             	mov    0x18(%eax),%eax
+  801876:	85 c0                	test   %eax,%eax
+  801878:	74 34                	je     8018ae <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  80187a:	83 ec 08             	sub    $0x8,%esp
+  80187d:	ff 75 0c             	push   0xc(%ebp)
+  801880:	56                   	push   %esi
+  801881:	ff d0                	call   *%eax
+  801883:	83 c4 10             	add    $0x10,%esp
+}
+  801886:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801889:	5b                   	pop    %ebx
+  80188a:	5e                   	pop    %esi
+  80188b:	5d                   	pop    %ebp
+  80188c:	c3                   	ret
+            thisenv->env_id, fdnum);
+  80188d:	a1 64 67 80 00       	mov    0x806764,%eax
+  801892:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801895:	83 ec 04             	sub    $0x4,%esp
+  801898:	53                   	push   %ebx
+  801899:	50                   	push   %eax
+  80189a:	68 d0 35 80 00       	push   $0x8035d0
+  80189f:	e8 28 ec ff ff       	call   8004cc <cprintf>
+    return -E_INVAL;
+  8018a4:	83 c4 10             	add    $0x10,%esp
+  8018a7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018ac:	eb d8                	jmp    801886 <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  8018ae:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8018b3:	eb d1                	jmp    801886 <ftruncate+0x50>
+
+008018b5 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8018b5:	55                   	push   %ebp
+  8018b6:	89 e5                	mov    %esp,%ebp
+  8018b8:	56                   	push   %esi
+  8018b9:	53                   	push   %ebx
+  8018ba:	83 ec 18             	sub    $0x18,%esp
+  8018bd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  8018c0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018c3:	50                   	push   %eax
+  8018c4:	ff 75 08             	push   0x8(%ebp)
+  8018c7:	e8 46 fb ff ff       	call   801412 <fd_lookup>
+  8018cc:	83 c4 10             	add    $0x10,%esp
+  8018cf:	85 c0                	test   %eax,%eax
+  8018d1:	78 49                	js     80191c <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8018d3:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8018d6:	83 ec 08             	sub    $0x8,%esp
+  8018d9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018dc:	50                   	push   %eax
+  8018dd:	ff 36                	push   (%esi)
+  8018df:	e8 7e fb ff ff       	call   801462 <dev_lookup>
+  8018e4:	83 c4 10             	add    $0x10,%esp
+  8018e7:	85 c0                	test   %eax,%eax
+  8018e9:	78 31                	js     80191c <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  8018eb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018ee:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8018f2:	74 2f                	je     801923 <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  8018f4:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  8018f7:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8018fe:	00 00 00 
+  stat->st_isdir = 0;
+  801901:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801908:	00 00 00 
+  stat->st_dev = dev;
+  80190b:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  801911:	83 ec 08             	sub    $0x8,%esp
+  801914:	53                   	push   %ebx
+  801915:	56                   	push   %esi
+  801916:	ff 50 14             	call   *0x14(%eax)
+  801919:	83 c4 10             	add    $0x10,%esp
+}
+  80191c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80191f:	5b                   	pop    %ebx
+  801920:	5e                   	pop    %esi
+  801921:	5d                   	pop    %ebp
+  801922:	c3                   	ret
+    return -E_NOT_SUPP;
+  801923:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801928:	eb f2                	jmp    80191c <fstat+0x67>
+
+0080192a <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  80192a:	55                   	push   %ebp
+  80192b:	89 e5                	mov    %esp,%ebp
+  80192d:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  801930:	ff 75 0c             	push   0xc(%ebp)
+  801933:	ff 75 08             	push   0x8(%ebp)
+  801936:	e8 58 07 00 00       	call   802093 <file_stat>
+}
+  80193b:	c9                   	leave
+  80193c:	c3                   	ret
+
+0080193d <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  80193d:	55                   	push   %ebp
+  80193e:	89 e5                	mov    %esp,%ebp
+  801940:	57                   	push   %edi
+  801941:	56                   	push   %esi
+  801942:	53                   	push   %ebx
+  801943:	83 ec 1c             	sub    $0x1c,%esp
+  801946:	89 c7                	mov    %eax,%edi
+  801948:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  80194b:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80194e:	e9 a2 00 00 00       	jmp    8019f5 <fsipc_send+0xb8>
+  nfsenvs = 0;
+  801953:	c7 05 20 60 80 00 00 	movl   $0x0,0x806020
+  80195a:	00 00 00 
+  80195d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801962:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801967:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  80196c:	be 01 00 00 00       	mov    $0x1,%esi
+  801971:	eb 0f                	jmp    801982 <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801973:	83 c0 01             	add    $0x1,%eax
+  801976:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80197b:	74 49                	je     8019c6 <fsipc_send+0x89>
+  80197d:	83 f9 07             	cmp    $0x7,%ecx
+  801980:	7f 50                	jg     8019d2 <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  801982:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801985:	c1 e2 04             	shl    $0x4,%edx
+  801988:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80198e:	8b 52 50             	mov    0x50(%edx),%edx
+  801991:	83 fa 01             	cmp    $0x1,%edx
+  801994:	75 dd                	jne    801973 <fsipc_send+0x36>
+  801996:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801999:	c1 e2 04             	shl    $0x4,%edx
+  80199c:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8019a2:	8b 52 54             	mov    0x54(%edx),%edx
+  8019a5:	85 d2                	test   %edx,%edx
+  8019a7:	74 ca                	je     801973 <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  8019a9:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  8019ac:	c1 e2 04             	shl    $0x4,%edx
+  8019af:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8019b5:	8b 52 48             	mov    0x48(%edx),%edx
+  8019b8:	89 14 8d 40 60 80 00 	mov    %edx,0x806040(,%ecx,4)
+  8019bf:	8d 49 01             	lea    0x1(%ecx),%ecx
+  8019c2:	89 f3                	mov    %esi,%ebx
+  8019c4:	eb ad                	jmp    801973 <fsipc_send+0x36>
+  8019c6:	84 db                	test   %bl,%bl
+  8019c8:	74 38                	je     801a02 <fsipc_send+0xc5>
+  8019ca:	89 0d 20 60 80 00    	mov    %ecx,0x806020
+  8019d0:	eb 30                	jmp    801a02 <fsipc_send+0xc5>
+  8019d2:	84 db                	test   %bl,%bl
+  8019d4:	74 2c                	je     801a02 <fsipc_send+0xc5>
+  8019d6:	89 0d 20 60 80 00    	mov    %ecx,0x806020
+  8019dc:	eb 24                	jmp    801a02 <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  8019de:	50                   	push   %eax
+  8019df:	68 3c 36 80 00       	push   $0x80363c
+  8019e4:	6a 34                	push   $0x34
+  8019e6:	68 46 36 80 00       	push   $0x803646
+  8019eb:	e8 01 ea ff ff       	call   8003f1 <_panic>
+    }
+    sys_yield();
+  8019f0:	e8 92 f4 ff ff       	call   800e87 <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  8019f5:	83 3d 20 60 80 00 03 	cmpl   $0x3,0x806020
+  8019fc:	0f 8e 51 ff ff ff    	jle    801953 <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  801a02:	a1 64 67 80 00       	mov    0x806764,%eax
+  801a07:	8b 70 48             	mov    0x48(%eax),%esi
+  801a0a:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  801a10:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a15:	8b 0d 20 60 80 00    	mov    0x806020,%ecx
+  801a1b:	39 d9                	cmp    %ebx,%ecx
+  801a1d:	7e d1                	jle    8019f0 <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  801a1f:	83 ec 0c             	sub    $0xc,%esp
+  801a22:	ff 75 e0             	push   -0x20(%ebp)
+  801a25:	6a 07                	push   $0x7
+  801a27:	ff 75 e4             	push   -0x1c(%ebp)
+  801a2a:	57                   	push   %edi
+  801a2b:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  801a2e:	99                   	cltd
+  801a2f:	f7 f9                	idiv   %ecx
+  801a31:	ff 34 95 40 60 80 00 	push   0x806040(,%edx,4)
+  801a38:	e8 63 f7 ff ff       	call   8011a0 <sys_ipc_try_send>
+      if (r == 0)
+  801a3d:	83 c4 20             	add    $0x20,%esp
+  801a40:	85 c0                	test   %eax,%eax
+  801a42:	74 0a                	je     801a4e <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  801a44:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801a47:	75 95                	jne    8019de <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  801a49:	83 c3 01             	add    $0x1,%ebx
+  801a4c:	eb c7                	jmp    801a15 <fsipc_send+0xd8>
+  }
+}
+  801a4e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a51:	5b                   	pop    %ebx
+  801a52:	5e                   	pop    %esi
+  801a53:	5f                   	pop    %edi
+  801a54:	5d                   	pop    %ebp
+  801a55:	c3                   	ret
+
+00801a56 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801a56:	55                   	push   %ebp
+  801a57:	89 e5                	mov    %esp,%ebp
+  801a59:	53                   	push   %ebx
+  801a5a:	83 ec 14             	sub    $0x14,%esp
+  801a5d:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  801a5f:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  801a66:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801a6b:	ba 00 70 80 00       	mov    $0x807000,%edx
+  801a70:	e8 c8 fe ff ff       	call   80193d <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801a75:	6a 00                	push   $0x0
+  801a77:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a7a:	50                   	push   %eax
+  801a7b:	53                   	push   %ebx
+  801a7c:	6a 00                	push   $0x0
+  801a7e:	e8 26 13 00 00       	call   802da9 <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  801a83:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a86:	c9                   	leave
+  801a87:	c3                   	ret
+
+00801a88 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801a88:	55                   	push   %ebp
+  801a89:	89 e5                	mov    %esp,%ebp
+  801a8b:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801a8e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a91:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a94:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.set_size.req_size = newsize;
+  801a99:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a9c:	a3 04 70 80 00       	mov    %eax,0x807004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801aa1:	ba 00 00 00 00       	mov    $0x0,%edx
+  801aa6:	b8 02 00 00 00       	mov    $0x2,%eax
+  801aab:	e8 a6 ff ff ff       	call   801a56 <fsipc>
+}
+  801ab0:	c9                   	leave
+  801ab1:	c3                   	ret
+
+00801ab2 <devfile_flush>:
+{
+  801ab2:	55                   	push   %ebp
+  801ab3:	89 e5                	mov    %esp,%ebp
+  801ab5:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801ab8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801abb:	8b 40 0c             	mov    0xc(%eax),%eax
+  801abe:	a3 00 70 80 00       	mov    %eax,0x807000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801ac3:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ac8:	b8 06 00 00 00       	mov    $0x6,%eax
+  801acd:	e8 84 ff ff ff       	call   801a56 <fsipc>
+}
+  801ad2:	c9                   	leave
+  801ad3:	c3                   	ret
+
+00801ad4 <devfile_stat>:
+{
+  801ad4:	55                   	push   %ebp
+  801ad5:	89 e5                	mov    %esp,%ebp
+  801ad7:	53                   	push   %ebx
+  801ad8:	83 ec 04             	sub    $0x4,%esp
+  801adb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801ade:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ae1:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ae4:	a3 00 70 80 00       	mov    %eax,0x807000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801ae9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801aee:	b8 05 00 00 00       	mov    $0x5,%eax
+  801af3:	e8 5e ff ff ff       	call   801a56 <fsipc>
+  801af8:	85 c0                	test   %eax,%eax
+  801afa:	78 2c                	js     801b28 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801afc:	83 ec 08             	sub    $0x8,%esp
+  801aff:	68 00 70 80 00       	push   $0x807000
+  801b04:	53                   	push   %ebx
+  801b05:	e8 b0 ef ff ff       	call   800aba <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  801b0a:	a1 80 70 80 00       	mov    0x807080,%eax
+  801b0f:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801b15:	a1 84 70 80 00       	mov    0x807084,%eax
+  801b1a:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801b20:	83 c4 10             	add    $0x10,%esp
+  801b23:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b28:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b2b:	c9                   	leave
+  801b2c:	c3                   	ret
+
+00801b2d <fsv_alloc>:
+{
+  801b2d:	55                   	push   %ebp
+  801b2e:	89 e5                	mov    %esp,%ebp
+  801b30:	56                   	push   %esi
+  801b31:	53                   	push   %ebx
+  801b32:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  801b34:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b39:	eb 22                	jmp    801b5d <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  801b3b:	83 ec 04             	sub    $0x4,%esp
+  801b3e:	6a 00                	push   $0x0
+  801b40:	6a 00                	push   $0x0
+  801b42:	6a 07                	push   $0x7
+  801b44:	50                   	push   %eax
+  801b45:	6a 00                	push   $0x0
+  801b47:	6a 04                	push   $0x4
+  801b49:	68 60 60 80 00       	push   $0x806060
+  801b4e:	e8 e9 f7 ff ff       	call   80133c <sysbatch_add>
+  801b53:	83 c4 20             	add    $0x20,%esp
+  801b56:	85 c0                	test   %eax,%eax
+  801b58:	78 48                	js     801ba2 <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  801b5a:	83 c3 01             	add    $0x1,%ebx
+  801b5d:	39 f3                	cmp    %esi,%ebx
+  801b5f:	74 31                	je     801b92 <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  801b61:	89 d8                	mov    %ebx,%eax
+  801b63:	c1 e0 0c             	shl    $0xc,%eax
+  801b66:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801b6b:	89 c2                	mov    %eax,%edx
+  801b6d:	c1 ea 16             	shr    $0x16,%edx
+  801b70:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801b77:	f6 c2 01             	test   $0x1,%dl
+  801b7a:	74 bf                	je     801b3b <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  801b7c:	89 c2                	mov    %eax,%edx
+  801b7e:	c1 ea 0c             	shr    $0xc,%edx
+  801b81:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801b88:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801b8b:	83 fa 03             	cmp    $0x3,%edx
+  801b8e:	75 ab                	jne    801b3b <fsv_alloc+0xe>
+  801b90:	eb c8                	jmp    801b5a <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  801b92:	83 ec 0c             	sub    $0xc,%esp
+  801b95:	68 60 60 80 00       	push   $0x806060
+  801b9a:	e8 4d f7 ff ff       	call   8012ec <sysbatch_flush>
+  801b9f:	83 c4 10             	add    $0x10,%esp
+}
+  801ba2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ba5:	5b                   	pop    %ebx
+  801ba6:	5e                   	pop    %esi
+  801ba7:	5d                   	pop    %ebp
+  801ba8:	c3                   	ret
+
+00801ba9 <devfile_read>:
+{
+  801ba9:	55                   	push   %ebp
+  801baa:	89 e5                	mov    %esp,%ebp
+  801bac:	57                   	push   %edi
+  801bad:	56                   	push   %esi
+  801bae:	53                   	push   %ebx
+  801baf:	83 ec 3c             	sub    $0x3c,%esp
+  801bb2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  801bb5:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  801bbb:	77 57                	ja     801c14 <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801bbd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bc0:	8b 40 0c             	mov    0xc(%eax),%eax
+  801bc3:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.read.req_n = n;
+  801bc8:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801bce:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bd3:	b8 03 00 00 00       	mov    $0x3,%eax
+  801bd8:	e8 79 fe ff ff       	call   801a56 <fsipc>
+  801bdd:	89 c6                	mov    %eax,%esi
+  801bdf:	85 c0                	test   %eax,%eax
+  801be1:	78 27                	js     801c0a <devfile_read+0x61>
+  assert(r <= n);
+  801be3:	39 c3                	cmp    %eax,%ebx
+  801be5:	0f 82 0e 02 00 00    	jb     801df9 <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  801beb:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801bf0:	0f 8f 1c 02 00 00    	jg     801e12 <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801bf6:	83 ec 04             	sub    $0x4,%esp
+  801bf9:	50                   	push   %eax
+  801bfa:	68 00 70 80 00       	push   $0x807000
+  801bff:	ff 75 0c             	push   0xc(%ebp)
+  801c02:	e8 39 f0 ff ff       	call   800c40 <memmove>
+  return r;
+  801c07:	83 c4 10             	add    $0x10,%esp
+}
+  801c0a:	89 f0                	mov    %esi,%eax
+  801c0c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c0f:	5b                   	pop    %ebx
+  801c10:	5e                   	pop    %esi
+  801c11:	5f                   	pop    %edi
+  801c12:	5d                   	pop    %ebp
+  801c13:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  801c14:	b8 01 00 00 00       	mov    $0x1,%eax
+  801c19:	e8 0f ff ff ff       	call   801b2d <fsv_alloc>
+  801c1e:	89 c6                	mov    %eax,%esi
+  801c20:	85 c0                	test   %eax,%eax
+  801c22:	78 e6                	js     801c0a <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  801c24:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c27:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c2a:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  801c2f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c32:	8b 40 04             	mov    0x4(%eax),%eax
+  801c35:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  801c3a:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  801c40:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801c47:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801c4c:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801c51:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801c56:	e8 e2 fc ff ff       	call   80193d <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801c5b:	6a 00                	push   $0x0
+  801c5d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801c60:	50                   	push   %eax
+  801c61:	68 00 10 c0 9f       	push   $0x9fc01000
+  801c66:	6a 00                	push   $0x0
+  801c68:	e8 3c 11 00 00       	call   802da9 <ipc_recv_pages>
+  801c6d:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  801c6f:	83 c4 10             	add    $0x10,%esp
+  801c72:	85 c0                	test   %eax,%eax
+  801c74:	7e 94                	jle    801c0a <devfile_read+0x61>
+  assert(r <= n);
+  801c76:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801c79:	39 c3                	cmp    %eax,%ebx
+  801c7b:	72 2e                	jb     801cab <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801c7d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c80:	8b 40 04             	mov    0x4(%eax),%eax
+  801c83:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801c88:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  801c8b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801c8e:	c1 e2 0c             	shl    $0xc,%edx
+  801c91:	39 ca                	cmp    %ecx,%edx
+  801c93:	72 2f                	jb     801cc4 <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  801c95:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  801c9a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  801c9d:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  801ca1:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801ca6:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  801ca9:	eb 52                	jmp    801cfd <devfile_read+0x154>
+  assert(r <= n);
+  801cab:	68 51 36 80 00       	push   $0x803651
+  801cb0:	68 58 36 80 00       	push   $0x803658
+  801cb5:	68 49 01 00 00       	push   $0x149
+  801cba:	68 46 36 80 00       	push   $0x803646
+  801cbf:	e8 2d e7 ff ff       	call   8003f1 <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801cc4:	68 7c 36 80 00       	push   $0x80367c
+  801cc9:	68 58 36 80 00       	push   $0x803658
+  801cce:	68 4a 01 00 00       	push   $0x14a
+  801cd3:	68 46 36 80 00       	push   $0x803646
+  801cd8:	e8 14 e7 ff ff       	call   8003f1 <_panic>
+      memmove(dst + done, src + done, m);
+  801cdd:	83 ec 04             	sub    $0x4,%esp
+  801ce0:	53                   	push   %ebx
+  801ce1:	56                   	push   %esi
+  801ce2:	89 f8                	mov    %edi,%eax
+  801ce4:	03 45 0c             	add    0xc(%ebp),%eax
+  801ce7:	50                   	push   %eax
+  801ce8:	e8 53 ef ff ff       	call   800c40 <memmove>
+  801ced:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  801cf0:	01 df                	add    %ebx,%edi
+  801cf2:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801cf5:	39 c7                	cmp    %eax,%edi
+  801cf7:	0f 83 c0 00 00 00    	jae    801dbd <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801cfd:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801d00:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  801d03:	89 f0                	mov    %esi,%eax
+  801d05:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801d0a:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  801d0f:	29 c3                	sub    %eax,%ebx
+  801d11:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801d14:	29 f8                	sub    %edi,%eax
+  801d16:	39 c3                	cmp    %eax,%ebx
+  801d18:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  801d1b:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801d21:	75 ba                	jne    801cdd <devfile_read+0x134>
+  801d23:	89 f9                	mov    %edi,%ecx
+  801d25:	03 4d 0c             	add    0xc(%ebp),%ecx
+  801d28:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  801d2b:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  801d31:	75 aa                	jne    801cdd <devfile_read+0x134>
+  801d33:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  801d39:	77 a2                	ja     801cdd <devfile_read+0x134>
+  801d3b:	89 c8                	mov    %ecx,%eax
+  801d3d:	c1 e8 16             	shr    $0x16,%eax
+  801d40:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801d47:	a8 01                	test   $0x1,%al
+  801d49:	74 92                	je     801cdd <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  801d4b:	89 c8                	mov    %ecx,%eax
+  801d4d:	c1 e8 0c             	shr    $0xc,%eax
+  801d50:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  801d57:	a8 01                	test   $0x1,%al
+  801d59:	74 82                	je     801cdd <devfile_read+0x134>
+  801d5b:	a9 02 08 00 00       	test   $0x802,%eax
+  801d60:	0f 84 77 ff ff ff    	je     801cdd <devfile_read+0x134>
+  801d66:	f6 c4 04             	test   $0x4,%ah
+  801d69:	0f 85 6e ff ff ff    	jne    801cdd <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  801d6f:	a1 64 67 80 00       	mov    0x806764,%eax
+  801d74:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  801d78:	84 c0                	test   %al,%al
+  801d7a:	75 17                	jne    801d93 <devfile_read+0x1ea>
+  801d7c:	83 ec 08             	sub    $0x8,%esp
+  801d7f:	6a 01                	push   $0x1
+  801d81:	6a 00                	push   $0x0
+  801d83:	e8 1e f1 ff ff       	call   800ea6 <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  801d88:	83 c4 10             	add    $0x10,%esp
+  801d8b:	85 c0                	test   %eax,%eax
+  801d8d:	0f 85 4a ff ff ff    	jne    801cdd <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  801d93:	83 ec 04             	sub    $0x4,%esp
+  801d96:	68 05 08 00 00       	push   $0x805
+  801d9b:	ff 75 cc             	push   -0x34(%ebp)
+  801d9e:	6a 00                	push   $0x0
+  801da0:	56                   	push   %esi
+  801da1:	6a 00                	push   $0x0
+  801da3:	6a 05                	push   $0x5
+  801da5:	68 60 60 80 00       	push   $0x806060
+  801daa:	e8 8d f5 ff ff       	call   80133c <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  801daf:	c1 e8 1f             	shr    $0x1f,%eax
+  801db2:	08 45 cb             	or     %al,-0x35(%ebp)
+  801db5:	83 c4 20             	add    $0x20,%esp
+  801db8:	e9 33 ff ff ff       	jmp    801cf0 <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  801dbd:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  801dc0:	83 ec 0c             	sub    $0xc,%esp
+  801dc3:	68 60 60 80 00       	push   $0x806060
+  801dc8:	e8 1f f5 ff ff       	call   8012ec <sysbatch_flush>
+  801dcd:	83 c4 10             	add    $0x10,%esp
+  801dd0:	85 c0                	test   %eax,%eax
+  801dd2:	78 06                	js     801dda <devfile_read+0x231>
+  801dd4:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  801dd8:	74 14                	je     801dee <devfile_read+0x245>
+    memmove(dst, src, r);
+  801dda:	83 ec 04             	sub    $0x4,%esp
+  801ddd:	ff 75 d4             	push   -0x2c(%ebp)
+  801de0:	ff 75 d0             	push   -0x30(%ebp)
+  801de3:	ff 75 0c             	push   0xc(%ebp)
+  801de6:	e8 55 ee ff ff       	call   800c40 <memmove>
+  801deb:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  801dee:	8b 45 08             	mov    0x8(%ebp),%eax
+  801df1:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  801df4:	e9 11 fe ff ff       	jmp    801c0a <devfile_read+0x61>
+  assert(r <= n);
+  801df9:	68 51 36 80 00       	push   $0x803651
+  801dfe:	68 58 36 80 00       	push   $0x803658
+  801e03:	68 1c 01 00 00       	push   $0x11c
+  801e08:	68 46 36 80 00       	push   $0x803646
+  801e0d:	e8 df e5 ff ff       	call   8003f1 <_panic>
+  assert(r <= PGSIZE);
+  801e12:	68 6d 36 80 00       	push   $0x80366d
+  801e17:	68 58 36 80 00       	push   $0x803658
+  801e1c:	68 1d 01 00 00       	push   $0x11d
+  801e21:	68 46 36 80 00       	push   $0x803646
+  801e26:	e8 c6 e5 ff ff       	call   8003f1 <_panic>
+
+00801e2b <devfile_write>:
+{
+  801e2b:	55                   	push   %ebp
+  801e2c:	89 e5                	mov    %esp,%ebp
+  801e2e:	57                   	push   %edi
+  801e2f:	56                   	push   %esi
+  801e30:	53                   	push   %ebx
+  801e31:	83 ec 1c             	sub    $0x1c,%esp
+  801e34:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e37:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  801e3a:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  801e3f:	77 39                	ja     801e7a <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801e41:	8b 56 0c             	mov    0xc(%esi),%edx
+  801e44:	89 15 00 70 80 00    	mov    %edx,0x807000
+  fsipcbuf.write.req_n = n;
+  801e4a:	a3 04 70 80 00       	mov    %eax,0x807004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  801e4f:	83 ec 04             	sub    $0x4,%esp
+  801e52:	50                   	push   %eax
+  801e53:	ff 75 0c             	push   0xc(%ebp)
+  801e56:	68 08 70 80 00       	push   $0x807008
+  801e5b:	e8 e0 ed ff ff       	call   800c40 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801e60:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e65:	b8 04 00 00 00       	mov    $0x4,%eax
+  801e6a:	e8 e7 fb ff ff       	call   801a56 <fsipc>
+  801e6f:	83 c4 10             	add    $0x10,%esp
+}
+  801e72:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e75:	5b                   	pop    %ebx
+  801e76:	5e                   	pop    %esi
+  801e77:	5f                   	pop    %edi
+  801e78:	5d                   	pop    %ebp
+  801e79:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  801e7a:	ba 00 00 10 00       	mov    $0x100000,%edx
+  801e7f:	39 d0                	cmp    %edx,%eax
+  801e81:	89 d3                	mov    %edx,%ebx
+  801e83:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  801e86:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  801e8c:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  801e8f:	83 c7 01             	add    $0x1,%edi
+  801e92:	89 f8                	mov    %edi,%eax
+  801e94:	e8 94 fc ff ff       	call   801b2d <fsv_alloc>
+  801e99:	85 c0                	test   %eax,%eax
+  801e9b:	78 d5                	js     801e72 <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  801e9d:	83 ec 04             	sub    $0x4,%esp
+  801ea0:	53                   	push   %ebx
+  801ea1:	ff 75 0c             	push   0xc(%ebp)
+  801ea4:	68 00 10 c0 9f       	push   $0x9fc01000
+  801ea9:	e8 92 ed ff ff       	call   800c40 <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  801eae:	8b 46 0c             	mov    0xc(%esi),%eax
+  801eb1:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  801eb6:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  801ebc:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801ec3:	89 f9                	mov    %edi,%ecx
+  801ec5:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801eca:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801ecf:	e8 69 fa ff ff       	call   80193d <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801ed4:	6a 00                	push   $0x0
+  801ed6:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801ed9:	50                   	push   %eax
+  801eda:	6a 00                	push   $0x0
+  801edc:	6a 00                	push   $0x0
+  801ede:	e8 c6 0e 00 00       	call   802da9 <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  801ee3:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  801ee6:	eb 8a                	jmp    801e72 <devfile_write+0x47>
+
+00801ee8 <open>:
+{
+  801ee8:	55                   	push   %ebp
+  801ee9:	89 e5                	mov    %esp,%ebp
+  801eeb:	56                   	push   %esi
+  801eec:	53                   	push   %ebx
+  801eed:	83 ec 1c             	sub    $0x1c,%esp
+  801ef0:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801ef3:	56                   	push   %esi
+  801ef4:	e8 86 eb ff ff       	call   800a7f <strlen>
+  801ef9:	83 c4 10             	add    $0x10,%esp
+  801efc:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801f01:	7f 6c                	jg     801f6f <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  801f03:	83 ec 0c             	sub    $0xc,%esp
+  801f06:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f09:	50                   	push   %eax
+  801f0a:	e8 ad f4 ff ff       	call   8013bc <fd_alloc>
+  801f0f:	89 c3                	mov    %eax,%ebx
+  801f11:	83 c4 10             	add    $0x10,%esp
+  801f14:	85 c0                	test   %eax,%eax
+  801f16:	78 3c                	js     801f54 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801f18:	83 ec 08             	sub    $0x8,%esp
+  801f1b:	56                   	push   %esi
+  801f1c:	68 00 70 80 00       	push   $0x807000
+  801f21:	e8 94 eb ff ff       	call   800aba <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801f26:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f29:	a3 00 74 80 00       	mov    %eax,0x807400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801f2e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801f31:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f36:	e8 1b fb ff ff       	call   801a56 <fsipc>
+  801f3b:	89 c3                	mov    %eax,%ebx
+  801f3d:	83 c4 10             	add    $0x10,%esp
+  801f40:	85 c0                	test   %eax,%eax
+  801f42:	78 19                	js     801f5d <open+0x75>
+  return fd2num(fd);
+  801f44:	83 ec 0c             	sub    $0xc,%esp
+  801f47:	ff 75 f4             	push   -0xc(%ebp)
+  801f4a:	e8 49 f4 ff ff       	call   801398 <fd2num>
+  801f4f:	89 c3                	mov    %eax,%ebx
+  801f51:	83 c4 10             	add    $0x10,%esp
+}
+  801f54:	89 d8                	mov    %ebx,%eax
+  801f56:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f59:	5b                   	pop    %ebx
+  801f5a:	5e                   	pop    %esi
+  801f5b:	5d                   	pop    %ebp
+  801f5c:	c3                   	ret
+    fd_close(fd, 0);
+  801f5d:	83 ec 08             	sub    $0x8,%esp
+  801f60:	6a 00                	push   $0x0
+  801f62:	ff 75 f4             	push   -0xc(%ebp)
+  801f65:	e8 44 f5 ff ff       	call   8014ae <fd_close>
+    return r;
+  801f6a:	83 c4 10             	add    $0x10,%esp
+  801f6d:	eb e5                	jmp    801f54 <open+0x6c>
+    return -E_BAD_PATH;
+  801f6f:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801f74:	eb de                	jmp    801f54 <open+0x6c>
+
+00801f76 <open_read>:
+{
+  801f76:	55                   	push   %ebp
+  801f77:	89 e5                	mov    %esp,%ebp
+  801f79:	57                   	push   %edi
+  801f7a:	56                   	push   %esi
+  801f7b:	53                   	push   %ebx
+  801f7c:	83 ec 28             	sub    $0x28,%esp
+  801f7f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  801f82:	57                   	push   %edi
+  801f83:	e8 f7 ea ff ff       	call   800a7f <strlen>
+  801f88:	83 c4 10             	add    $0x10,%esp
+  801f8b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801f90:	0f 87 f6 00 00 00    	ja     80208c <open_read+0x116>
+  801f96:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  801f98:	83 ec 0c             	sub    $0xc,%esp
+  801f9b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801f9e:	50                   	push   %eax
+  801f9f:	e8 18 f4 ff ff       	call   8013bc <fd_alloc>
+  801fa4:	89 c3                	mov    %eax,%ebx
+  801fa6:	83 c4 10             	add    $0x10,%esp
+  801fa9:	85 c0                	test   %eax,%eax
+  801fab:	0f 88 b2 00 00 00    	js     802063 <open_read+0xed>
+  strcpy(req->req_buf, path);
+  801fb1:	83 ec 08             	sub    $0x8,%esp
+  801fb4:	57                   	push   %edi
+  801fb5:	68 e4 70 80 00       	push   $0x8070e4
+  801fba:	e8 fb ea ff ff       	call   800aba <strcpy>
+  req->req_nops = 2;
+  801fbf:	c7 05 00 70 80 00 02 	movl   $0x2,0x807000
+  801fc6:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  801fc9:	c7 05 04 70 80 00 01 	movl   $0x1,0x807004
+  801fd0:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  801fd3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801fd6:	a3 10 70 80 00       	mov    %eax,0x807010
+  req->req_ops[0].op_buf = 0;
+  801fdb:	c7 05 18 70 80 00 00 	movl   $0x0,0x807018
+  801fe2:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  801fe5:	c7 05 20 70 80 00 04 	movl   $0x4,0x807020
+  801fec:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  801fef:	c7 05 24 70 80 00 01 	movl   $0x1,0x807024
+  801ff6:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  801ff9:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  801ffe:	29 f0                	sub    %esi,%eax
+  802000:	3b 45 14             	cmp    0x14(%ebp),%eax
+  802003:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  802007:	a3 2c 70 80 00       	mov    %eax,0x80702c
+  req->req_ops[1].op_offset = 0;
+  80200c:	c7 05 30 70 80 00 00 	movl   $0x0,0x807030
+  802013:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  802016:	83 c6 01             	add    $0x1,%esi
+  802019:	89 35 34 70 80 00    	mov    %esi,0x807034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  80201f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802022:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802027:	e8 2a fa ff ff       	call   801a56 <fsipc>
+  80202c:	89 c3                	mov    %eax,%ebx
+  80202e:	83 c4 10             	add    $0x10,%esp
+  802031:	83 f8 01             	cmp    $0x1,%eax
+  802034:	7e 37                	jle    80206d <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  802036:	a1 38 70 80 00       	mov    0x807038,%eax
+  80203b:	8b 55 18             	mov    0x18(%ebp),%edx
+  80203e:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  802040:	83 ec 04             	sub    $0x4,%esp
+  802043:	50                   	push   %eax
+  802044:	81 c6 e4 70 80 00    	add    $0x8070e4,%esi
+  80204a:	56                   	push   %esi
+  80204b:	ff 75 10             	push   0x10(%ebp)
+  80204e:	e8 ed eb ff ff       	call   800c40 <memmove>
+  return fd2num(fd);
+  802053:	83 c4 04             	add    $0x4,%esp
+  802056:	ff 75 e4             	push   -0x1c(%ebp)
+  802059:	e8 3a f3 ff ff       	call   801398 <fd2num>
+  80205e:	89 c3                	mov    %eax,%ebx
+  802060:	83 c4 10             	add    $0x10,%esp
+}
+  802063:	89 d8                	mov    %ebx,%eax
+  802065:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802068:	5b                   	pop    %ebx
+  802069:	5e                   	pop    %esi
+  80206a:	5f                   	pop    %edi
+  80206b:	5d                   	pop    %ebp
+  80206c:	c3                   	ret
+    fd_close(fd, 0);
+  80206d:	83 ec 08             	sub    $0x8,%esp
+  802070:	6a 00                	push   $0x0
+  802072:	ff 75 e4             	push   -0x1c(%ebp)
+  802075:	e8 34 f4 ff ff       	call   8014ae <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  80207a:	83 c4 10             	add    $0x10,%esp
+  80207d:	85 db                	test   %ebx,%ebx
+  80207f:	78 e2                	js     802063 <open_read+0xed>
+  802081:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  802084:	8b 9b 1c 70 80 00    	mov    0x80701c(%ebx),%ebx
+  80208a:	eb d7                	jmp    802063 <open_read+0xed>
+    return -E_BAD_PATH;
+  80208c:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802091:	eb d0                	jmp    802063 <open_read+0xed>
+
+00802093 <file_stat>:
+{
+  802093:	55                   	push   %ebp
+  802094:	89 e5                	mov    %esp,%ebp
+  802096:	57                   	push   %edi
+  802097:	56                   	push   %esi
+  802098:	53                   	push   %ebx
+  802099:	83 ec 18             	sub    $0x18,%esp
+  80209c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80209f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  8020a2:	57                   	push   %edi
+  8020a3:	e8 d7 e9 ff ff       	call   800a7f <strlen>
+  8020a8:	83 c4 10             	add    $0x10,%esp
+  8020ab:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8020b0:	0f 8f c7 00 00 00    	jg     80217d <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  8020b6:	83 ec 0c             	sub    $0xc,%esp
+  8020b9:	57                   	push   %edi
+  8020ba:	e8 c0 e9 ff ff       	call   800a7f <strlen>
+  8020bf:	8d 58 04             	lea    0x4(%eax),%ebx
+  8020c2:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  8020c5:	83 c4 08             	add    $0x8,%esp
+  8020c8:	57                   	push   %edi
+  8020c9:	68 e4 70 80 00       	push   $0x8070e4
+  8020ce:	e8 e7 e9 ff ff       	call   800aba <strcpy>
+  req->req_nops = 2;
+  8020d3:	c7 05 00 70 80 00 02 	movl   $0x2,0x807000
+  8020da:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  8020dd:	c7 05 04 70 80 00 02 	movl   $0x2,0x807004
+  8020e4:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  8020e7:	c7 05 10 70 80 00 00 	movl   $0x0,0x807010
+  8020ee:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  8020f1:	c7 05 18 70 80 00 00 	movl   $0x0,0x807018
+  8020f8:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  8020fb:	c7 05 20 70 80 00 03 	movl   $0x3,0x807020
+  802102:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  802105:	c7 05 24 70 80 00 01 	movl   $0x1,0x807024
+  80210c:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  80210f:	89 1d 34 70 80 00    	mov    %ebx,0x807034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  802115:	ba 00 00 00 00       	mov    $0x0,%edx
+  80211a:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80211f:	e8 32 f9 ff ff       	call   801a56 <fsipc>
+  802124:	83 c4 10             	add    $0x10,%esp
+  802127:	83 f8 01             	cmp    $0x1,%eax
+  80212a:	7e 42                	jle    80216e <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  80212c:	81 c3 e4 70 80 00    	add    $0x8070e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  802132:	83 ec 08             	sub    $0x8,%esp
+  802135:	53                   	push   %ebx
+  802136:	56                   	push   %esi
+  802137:	e8 7e e9 ff ff       	call   800aba <strcpy>
+  st->st_size = ret->ret_size;
+  80213c:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  802142:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  802148:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  80214e:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  802154:	c7 86 88 00 00 00 04 	movl   $0x804004,0x88(%esi)
+  80215b:	40 80 00 
+  return 0;
+  80215e:	83 c4 10             	add    $0x10,%esp
+  802161:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802166:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802169:	5b                   	pop    %ebx
+  80216a:	5e                   	pop    %esi
+  80216b:	5f                   	pop    %edi
+  80216c:	5d                   	pop    %ebp
+  80216d:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  80216e:	85 c0                	test   %eax,%eax
+  802170:	78 f4                	js     802166 <file_stat+0xd3>
+  802172:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802175:	8b 80 1c 70 80 00    	mov    0x80701c(%eax),%eax
+  80217b:	eb e9                	jmp    802166 <file_stat+0xd3>
+    return -E_BAD_PATH;
+  80217d:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802182:	eb e2                	jmp    802166 <file_stat+0xd3>
+
+00802184 <read_map>:
+{
+  802184:	55                   	push   %ebp
+  802185:	89 e5                	mov    %esp,%ebp
+  802187:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80218a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80218d:	50                   	push   %eax
+  80218e:	ff 75 08             	push   0x8(%ebp)
+  802191:	e8 7c f2 ff ff       	call   801412 <fd_lookup>
+  802196:	83 c4 10             	add    $0x10,%esp
+  802199:	85 c0                	test   %eax,%eax
+  80219b:	78 2a                	js     8021c7 <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  80219d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021a0:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  8021a6:	39 08                	cmp    %ecx,(%eax)
+  8021a8:	75 1f                	jne    8021c9 <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  8021aa:	8b 40 0c             	mov    0xc(%eax),%eax
+  8021ad:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.read_map.req_offset = offset;
+  8021b2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021b5:	a3 04 70 80 00       	mov    %eax,0x807004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  8021ba:	8b 55 10             	mov    0x10(%ebp),%edx
+  8021bd:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8021c2:	e8 8f f8 ff ff       	call   801a56 <fsipc>
+}
+  8021c7:	c9                   	leave
+  8021c8:	c3                   	ret
+    return -E_INVAL;
+  8021c9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021ce:	eb f7                	jmp    8021c7 <read_map+0x43>
+
+008021d0 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8021d0:	55                   	push   %ebp
+  8021d1:	89 e5                	mov    %esp,%ebp
+  8021d3:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  8021d6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021db:	b8 08 00 00 00       	mov    $0x8,%eax
+  8021e0:	e8 71 f8 ff ff       	call   801a56 <fsipc>
+}
+  8021e5:	c9                   	leave
+  8021e6:	c3                   	ret
+
+008021e7 <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  8021e7:	55                   	push   %ebp
+  8021e8:	89 e5                	mov    %esp,%ebp
+  8021ea:	57                   	push   %edi
+  8021eb:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  8021ec:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021ef:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.stats.req_bio_sched = 0;
+  8021f4:	c7 05 04 70 80 00 00 	movl   $0x0,0x807004
+  8021fb:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  8021fe:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  802205:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  802208:	ba 00 00 00 00       	mov    $0x0,%edx
+  80220d:	b8 09 00 00 00       	mov    $0x9,%eax
+  802212:	e8 3f f8 ff ff       	call   801a56 <fsipc>
+  802217:	85 c0                	test   %eax,%eax
+  802219:	78 14                	js     80222f <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  80221b:	be 00 70 80 00       	mov    $0x807000,%esi
+  802220:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802225:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802228:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  80222a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80222f:	5e                   	pop    %esi
+  802230:	5f                   	pop    %edi
+  802231:	5d                   	pop    %ebp
+  802232:	c3                   	ret
+
+00802233 <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  802233:	55                   	push   %ebp
+  802234:	89 e5                	mov    %esp,%ebp
+  802236:	53                   	push   %ebx
+  802237:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  80223a:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  80223d:	50                   	push   %eax
+  80223e:	6a 00                	push   $0x0
+  802240:	e8 a2 ff ff ff       	call   8021e7 <fs_stats>
+  802245:	83 c4 10             	add    $0x10,%esp
+  802248:	85 c0                	test   %eax,%eax
+  80224a:	78 28                	js     802274 <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  80224c:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  80224f:	83 ec 08             	sub    $0x8,%esp
+  802252:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802255:	50                   	push   %eax
+  802256:	6a 20                	push   $0x20
+  802258:	e8 8a ff ff ff       	call   8021e7 <fs_stats>
+  80225d:	83 c4 10             	add    $0x10,%esp
+  802260:	85 c0                	test   %eax,%eax
+  802262:	78 10                	js     802274 <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  802264:	83 ec 08             	sub    $0x8,%esp
+  802267:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  80226a:	50                   	push   %eax
+  80226b:	53                   	push   %ebx
+  80226c:	e8 76 ff ff ff       	call   8021e7 <fs_stats>
+  802271:	83 c4 10             	add    $0x10,%esp
+}
+  802274:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802277:	c9                   	leave
+  802278:	c3                   	ret
+
+00802279 <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  802279:	55                   	push   %ebp
+  80227a:	89 e5                	mov    %esp,%ebp
+  80227c:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  80227f:	c7 05 00 70 80 00 00 	movl   $0x0,0x807000
+  802286:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  802289:	8b 45 08             	mov    0x8(%ebp),%eax
+  80228c:	a3 04 70 80 00       	mov    %eax,0x807004
+  fsipcbuf.stats.req_dcache = 0;
+  802291:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  802298:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  80229b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022a0:	b8 09 00 00 00       	mov    $0x9,%eax
+  8022a5:	e8 ac f7 ff ff       	call   801a56 <fsipc>
+}
+  8022aa:	c9                   	leave
+  8022ab:	c3                   	ret
+
+008022ac <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  8022ac:	55                   	push   %ebp
+  8022ad:	89 e5                	mov    %esp,%ebp
+  8022af:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  8022b2:	c7 05 00 70 80 00 00 	movl   $0x0,0x807000
+  8022b9:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  8022bc:	c7 05 04 70 80 00 00 	movl   $0x0,0x807004
+  8022c3:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  8022c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022c9:	a3 08 70 80 00       	mov    %eax,0x807008
+  return fsipc(FSREQ_STATS, NULL);
+  8022ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022d3:	b8 09 00 00 00       	mov    $0x9,%eax
+  8022d8:	e8 79 f7 ff ff       	call   801a56 <fsipc>
+}
+  8022dd:	c9                   	leave
+  8022de:	c3                   	ret
+
+008022df <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  8022df:	55                   	push   %ebp
+  8022e0:	89 e5                	mov    %esp,%ebp
+  8022e2:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8022e5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022e8:	50                   	push   %eax
+  8022e9:	ff 75 08             	push   0x8(%ebp)
+  8022ec:	e8 21 f1 ff ff       	call   801412 <fd_lookup>
+  8022f1:	83 c4 10             	add    $0x10,%esp
+  8022f4:	85 c0                	test   %eax,%eax
+  8022f6:	78 34                	js     80232c <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  8022f8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022fb:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  802301:	39 08                	cmp    %ecx,(%eax)
+  802303:	75 29                	jne    80232e <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  802305:	8b 40 0c             	mov    0xc(%eax),%eax
+  802308:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.fallocate.req_offset = offset;
+  80230d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802310:	a3 04 70 80 00       	mov    %eax,0x807004
+  fsipcbuf.fallocate.req_len = len;
+  802315:	8b 45 10             	mov    0x10(%ebp),%eax
+  802318:	a3 08 70 80 00       	mov    %eax,0x807008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  80231d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802322:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802327:	e8 2a f7 ff ff       	call   801a56 <fsipc>
+}
+  80232c:	c9                   	leave
+  80232d:	c3                   	ret
+    return -E_INVAL;
+  80232e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802333:	eb f7                	jmp    80232c <fallocate+0x4d>
+
+00802335 <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  802335:	55                   	push   %ebp
+  802336:	89 e5                	mov    %esp,%ebp
+  802338:	57                   	push   %edi
+  802339:	56                   	push   %esi
+  80233a:	53                   	push   %ebx
+  80233b:	83 ec 24             	sub    $0x24,%esp
+  80233e:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802341:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802344:	50                   	push   %eax
+  802345:	ff 75 08             	push   0x8(%ebp)
+  802348:	e8 c5 f0 ff ff       	call   801412 <fd_lookup>
+  80234d:	83 c4 10             	add    $0x10,%esp
+  802350:	85 c0                	test   %eax,%eax
+  802352:	78 66                	js     8023ba <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  802354:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802357:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  80235d:	39 08                	cmp    %ecx,(%eax)
+  80235f:	75 61                	jne    8023c2 <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  802361:	85 f6                	test   %esi,%esi
+  802363:	7e 50                	jle    8023b5 <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  802365:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  80236a:	39 de                	cmp    %ebx,%esi
+  80236c:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  80236f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802372:	8b 40 0c             	mov    0xc(%eax),%eax
+  802375:	a3 00 70 80 00       	mov    %eax,0x807000
+    fsipcbuf.prefetch.req_n = m;
+  80237a:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  802380:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  802387:	83 ec 04             	sub    $0x4,%esp
+  80238a:	57                   	push   %edi
+  80238b:	ff 75 0c             	push   0xc(%ebp)
+  80238e:	68 08 70 80 00       	push   $0x807008
+  802393:	e8 a8 e8 ff ff       	call   800c40 <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  802398:	ba 00 00 00 00       	mov    $0x0,%edx
+  80239d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8023a2:	e8 af f6 ff ff       	call   801a56 <fsipc>
+  8023a7:	83 c4 10             	add    $0x10,%esp
+  8023aa:	85 c0                	test   %eax,%eax
+  8023ac:	78 0c                	js     8023ba <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  8023ae:	01 7d 0c             	add    %edi,0xc(%ebp)
+  8023b1:	29 de                	sub    %ebx,%esi
+  8023b3:	eb ac                	jmp    802361 <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  8023b5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023bd:	5b                   	pop    %ebx
+  8023be:	5e                   	pop    %esi
+  8023bf:	5f                   	pop    %edi
+  8023c0:	5d                   	pop    %ebp
+  8023c1:	c3                   	ret
+    return -E_INVAL;
+  8023c2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8023c7:	eb f1                	jmp    8023ba <prefetch+0x85>
+
+008023c9 <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  8023c9:	55                   	push   %ebp
+  8023ca:	89 e5                	mov    %esp,%ebp
+  8023cc:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  8023cf:	50                   	push   %eax
+  8023d0:	e8 d3 ef ff ff       	call   8013a8 <fd2data>
+  8023d5:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  8023da:	c9                   	leave
+  8023db:	c3                   	ret
+
+008023dc <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8023dc:	55                   	push   %ebp
+  8023dd:	89 e5                	mov    %esp,%ebp
+  8023df:	56                   	push   %esi
+  8023e0:	53                   	push   %ebx
+  8023e1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  8023e4:	83 ec 0c             	sub    $0xc,%esp
+  8023e7:	ff 75 08             	push   0x8(%ebp)
+  8023ea:	e8 b9 ef ff ff       	call   8013a8 <fd2data>
+  8023ef:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  8023f1:	83 c4 08             	add    $0x8,%esp
+  8023f4:	68 a8 36 80 00       	push   $0x8036a8
+  8023f9:	53                   	push   %ebx
+  8023fa:	e8 bb e6 ff ff       	call   800aba <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  8023ff:	8b 46 04             	mov    0x4(%esi),%eax
+  802402:	2b 06                	sub    (%esi),%eax
+  802404:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  80240a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802411:	00 00 00 
+  stat->st_dev = &devpipe;
+  802414:	c7 83 88 00 00 00 20 	movl   $0x804020,0x88(%ebx)
+  80241b:	40 80 00 
+  return 0;
+}
+  80241e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802423:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802426:	5b                   	pop    %ebx
+  802427:	5e                   	pop    %esi
+  802428:	5d                   	pop    %ebp
+  802429:	c3                   	ret
+
+0080242a <pipe_wakeup>:
+{
+  80242a:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  80242c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802431:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  802434:	85 c0                	test   %eax,%eax
+  802436:	75 01                	jne    802439 <pipe_wakeup+0xf>
+  802438:	c3                   	ret
+{
+  802439:	55                   	push   %ebp
+  80243a:	89 e5                	mov    %esp,%ebp
+  80243c:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  80243f:	6a 00                	push   $0x0
+  802441:	68 00 00 c0 ee       	push   $0xeec00000
+  802446:	52                   	push   %edx
+  802447:	e8 f9 ed ff ff       	call   801245 <sys_chan_wakeup>
+  80244c:	83 c4 10             	add    $0x10,%esp
+}
+  80244f:	c9                   	leave
+  802450:	c3                   	ret
+
+00802451 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802451:	55                   	push   %ebp
+  802452:	89 e5                	mov    %esp,%ebp
+  802454:	57                   	push   %edi
+  802455:	56                   	push   %esi
+  802456:	53                   	push   %ebx
+  802457:	83 ec 18             	sub    $0x18,%esp
+  80245a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  80245d:	57                   	push   %edi
+  80245e:	e8 45 ef ff ff       	call   8013a8 <fd2data>
+  802463:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  802465:	83 c4 10             	add    $0x10,%esp
+  802468:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  80246c:	74 2a                	je     802498 <devpipe_close+0x47>
+  80246e:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  802473:	89 f8                	mov    %edi,%eax
+  802475:	e8 4f ff ff ff       	call   8023c9 <pipe_ring>
+  80247a:	83 ec 08             	sub    $0x8,%esp
+  80247d:	01 d8                	add    %ebx,%eax
+  80247f:	50                   	push   %eax
+  802480:	6a 00                	push   $0x0
+  802482:	e8 e7 ea ff ff       	call   800f6e <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  802487:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80248d:	83 c4 10             	add    $0x10,%esp
+  802490:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  802496:	75 db                	jne    802473 <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  802498:	83 ec 08             	sub    $0x8,%esp
+  80249b:	57                   	push   %edi
+  80249c:	6a 00                	push   $0x0
+  80249e:	e8 cb ea ff ff       	call   800f6e <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  8024a3:	83 c4 10             	add    $0x10,%esp
+  8024a6:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  8024aa:	75 13                	jne    8024bf <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  8024ac:	83 ec 08             	sub    $0x8,%esp
+  8024af:	56                   	push   %esi
+  8024b0:	6a 00                	push   $0x0
+  8024b2:	e8 b7 ea ff ff       	call   800f6e <sys_page_unmap>
+}
+  8024b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024ba:	5b                   	pop    %ebx
+  8024bb:	5e                   	pop    %esi
+  8024bc:	5f                   	pop    %edi
+  8024bd:	5d                   	pop    %ebp
+  8024be:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  8024bf:	8d 56 04             	lea    0x4(%esi),%edx
+  8024c2:	8d 46 2c             	lea    0x2c(%esi),%eax
+  8024c5:	e8 60 ff ff ff       	call   80242a <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8024ca:	8d 46 30             	lea    0x30(%esi),%eax
+  8024cd:	89 f2                	mov    %esi,%edx
+  8024cf:	e8 56 ff ff ff       	call   80242a <pipe_wakeup>
+  8024d4:	eb d6                	jmp    8024ac <devpipe_close+0x5b>
+
+008024d6 <_pipeisclosed>:
+{
+  8024d6:	55                   	push   %ebp
+  8024d7:	89 e5                	mov    %esp,%ebp
+  8024d9:	57                   	push   %edi
+  8024da:	56                   	push   %esi
+  8024db:	53                   	push   %ebx
+  8024dc:	83 ec 1c             	sub    $0x1c,%esp
+  8024df:	89 c7                	mov    %eax,%edi
+  8024e1:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  8024e3:	a1 64 67 80 00       	mov    0x806764,%eax
+  8024e8:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  8024eb:	83 ec 0c             	sub    $0xc,%esp
+  8024ee:	57                   	push   %edi
+  8024ef:	e8 18 0a 00 00       	call   802f0c <pageref>
+  8024f4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8024f7:	89 34 24             	mov    %esi,(%esp)
+  8024fa:	e8 0d 0a 00 00       	call   802f0c <pageref>
+    nn = thisenv->env_runs;
+  8024ff:	8b 15 64 67 80 00    	mov    0x806764,%edx
+  802505:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  802508:	83 c4 10             	add    $0x10,%esp
+  80250b:	39 cb                	cmp    %ecx,%ebx
+  80250d:	74 1b                	je     80252a <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  80250f:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802512:	75 cf                	jne    8024e3 <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802514:	8b 42 58             	mov    0x58(%edx),%eax
+  802517:	6a 01                	push   $0x1
+  802519:	50                   	push   %eax
+  80251a:	53                   	push   %ebx
+  80251b:	68 af 36 80 00       	push   $0x8036af
+  802520:	e8 a7 df ff ff       	call   8004cc <cprintf>
+  802525:	83 c4 10             	add    $0x10,%esp
+  802528:	eb b9                	jmp    8024e3 <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  80252a:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80252d:	0f 94 c0             	sete   %al
+  802530:	0f b6 c0             	movzbl %al,%eax
+}
+  802533:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802536:	5b                   	pop    %ebx
+  802537:	5e                   	pop    %esi
+  802538:	5f                   	pop    %edi
+  802539:	5d                   	pop    %ebp
+  80253a:	c3                   	ret
+
+0080253b <devpipe_write_bulk>:
+{
+  80253b:	55                   	push   %ebp
+  80253c:	89 e5                	mov    %esp,%ebp
+  80253e:	57                   	push   %edi
+  80253f:	56                   	push   %esi
+  802540:	53                   	push   %ebx
+  802541:	83 ec 1c             	sub    $0x1c,%esp
+  802544:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802547:	89 d6                	mov    %edx,%esi
+  802549:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  80254c:	e8 78 fe ff ff       	call   8023c9 <pipe_ring>
+  802551:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  802554:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802559:	8d 46 04             	lea    0x4(%esi),%eax
+  80255c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  80255f:	eb 75                	jmp    8025d6 <devpipe_write_bulk+0x9b>
+  802561:	b8 01 00 00 00       	mov    $0x1,%eax
+  802566:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  80256a:	6a 64                	push   $0x64
+  80256c:	68 00 00 c0 ee       	push   $0xeec00000
+  802571:	53                   	push   %ebx
+  802572:	56                   	push   %esi
+  802573:	e8 aa ec ff ff       	call   801222 <sys_chan_sleep>
+      continue;
+  802578:	83 c4 10             	add    $0x10,%esp
+  80257b:	eb 59                	jmp    8025d6 <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  80257d:	89 d1                	mov    %edx,%ecx
+  80257f:	c1 f9 1f             	sar    $0x1f,%ecx
+  802582:	c1 e9 11             	shr    $0x11,%ecx
+  802585:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802588:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  80258d:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  80258f:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  802595:	29 d3                	sub    %edx,%ebx
+  802597:	ba 00 80 00 00       	mov    $0x8000,%edx
+  80259c:	29 c2                	sub    %eax,%edx
+  80259e:	39 d3                	cmp    %edx,%ebx
+  8025a0:	0f 47 da             	cmova  %edx,%ebx
+  8025a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8025a6:	29 fa                	sub    %edi,%edx
+  8025a8:	39 d3                	cmp    %edx,%ebx
+  8025aa:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  8025ad:	83 ec 04             	sub    $0x4,%esp
+  8025b0:	53                   	push   %ebx
+  8025b1:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8025b4:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  8025b7:	52                   	push   %edx
+  8025b8:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8025bb:	01 c8                	add    %ecx,%eax
+  8025bd:	50                   	push   %eax
+  8025be:	e8 df e6 ff ff       	call   800ca2 <memcpy>
+    i += m;
+  8025c3:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  8025c5:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  8025c8:	8d 46 2c             	lea    0x2c(%esi),%eax
+  8025cb:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8025ce:	e8 57 fe ff ff       	call   80242a <pipe_wakeup>
+  8025d3:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  8025d6:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  8025d9:	73 2b                	jae    802606 <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  8025db:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  8025dd:	8b 56 04             	mov    0x4(%esi),%edx
+  8025e0:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  8025e6:	39 d0                	cmp    %edx,%eax
+  8025e8:	7d 93                	jge    80257d <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  8025ea:	89 f2                	mov    %esi,%edx
+  8025ec:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8025ef:	e8 e2 fe ff ff       	call   8024d6 <_pipeisclosed>
+  8025f4:	85 c0                	test   %eax,%eax
+  8025f6:	0f 84 65 ff ff ff    	je     802561 <devpipe_write_bulk+0x26>
+        return i;
+  8025fc:	89 f8                	mov    %edi,%eax
+}
+  8025fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802601:	5b                   	pop    %ebx
+  802602:	5e                   	pop    %esi
+  802603:	5f                   	pop    %edi
+  802604:	5d                   	pop    %ebp
+  802605:	c3                   	ret
+  return i;
+  802606:	89 f8                	mov    %edi,%eax
+  802608:	eb f4                	jmp    8025fe <devpipe_write_bulk+0xc3>
+
+0080260a <devpipe_write>:
+{
+  80260a:	55                   	push   %ebp
+  80260b:	89 e5                	mov    %esp,%ebp
+  80260d:	57                   	push   %edi
+  80260e:	56                   	push   %esi
+  80260f:	53                   	push   %ebx
+  802610:	83 ec 28             	sub    $0x28,%esp
+  802613:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  802616:	56                   	push   %esi
+  802617:	e8 8c ed ff ff       	call   8013a8 <fd2data>
+  80261c:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  80261e:	8b 78 28             	mov    0x28(%eax),%edi
+  802621:	83 c4 10             	add    $0x10,%esp
+  802624:	85 ff                	test   %edi,%edi
+  802626:	75 25                	jne    80264d <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  802628:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  80262b:	74 66                	je     802693 <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  80262d:	8b 43 04             	mov    0x4(%ebx),%eax
+  802630:	8b 0b                	mov    (%ebx),%ecx
+  802632:	8d 51 20             	lea    0x20(%ecx),%edx
+  802635:	39 d0                	cmp    %edx,%eax
+  802637:	72 2b                	jb     802664 <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  802639:	89 da                	mov    %ebx,%edx
+  80263b:	89 f0                	mov    %esi,%eax
+  80263d:	e8 94 fe ff ff       	call   8024d6 <_pipeisclosed>
+  802642:	85 c0                	test   %eax,%eax
+  802644:	75 51                	jne    802697 <devpipe_write+0x8d>
+      sys_yield();
+  802646:	e8 3c e8 ff ff       	call   800e87 <sys_yield>
+  80264b:	eb e0                	jmp    80262d <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  80264d:	83 ec 0c             	sub    $0xc,%esp
+  802650:	ff 75 10             	push   0x10(%ebp)
+  802653:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802656:	89 c2                	mov    %eax,%edx
+  802658:	89 f0                	mov    %esi,%eax
+  80265a:	e8 dc fe ff ff       	call   80253b <devpipe_write_bulk>
+  80265f:	83 c4 10             	add    $0x10,%esp
+  802662:	eb 38                	jmp    80269c <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802664:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802667:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  80266b:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  80266e:	89 c2                	mov    %eax,%edx
+  802670:	c1 fa 1f             	sar    $0x1f,%edx
+  802673:	89 d1                	mov    %edx,%ecx
+  802675:	c1 e9 1b             	shr    $0x1b,%ecx
+  802678:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80267b:	83 e2 1f             	and    $0x1f,%edx
+  80267e:	29 ca                	sub    %ecx,%edx
+  802680:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802684:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  802688:	83 c0 01             	add    $0x1,%eax
+  80268b:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  80268e:	83 c7 01             	add    $0x1,%edi
+  802691:	eb 95                	jmp    802628 <devpipe_write+0x1e>
+  return i;
+  802693:	89 f8                	mov    %edi,%eax
+  802695:	eb 05                	jmp    80269c <devpipe_write+0x92>
+        return 0;
+  802697:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80269c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80269f:	5b                   	pop    %ebx
+  8026a0:	5e                   	pop    %esi
+  8026a1:	5f                   	pop    %edi
+  8026a2:	5d                   	pop    %ebp
+  8026a3:	c3                   	ret
+
+008026a4 <devpipe_read_bulk>:
+{
+  8026a4:	55                   	push   %ebp
+  8026a5:	89 e5                	mov    %esp,%ebp
+  8026a7:	57                   	push   %edi
+  8026a8:	56                   	push   %esi
+  8026a9:	53                   	push   %ebx
+  8026aa:	83 ec 2c             	sub    $0x2c,%esp
+  8026ad:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8026b0:	89 d6                	mov    %edx,%esi
+  8026b2:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8026b5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  8026b8:	e8 0c fd ff ff       	call   8023c9 <pipe_ring>
+  8026bd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  8026c0:	85 db                	test   %ebx,%ebx
+  8026c2:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8026c7:	0f 45 c3             	cmovne %ebx,%eax
+  8026ca:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8026cd:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8026d2:	8d 46 30             	lea    0x30(%esi),%eax
+  8026d5:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  8026d8:	eb 50                	jmp    80272a <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  8026da:	89 d1                	mov    %edx,%ecx
+  8026dc:	c1 f9 1f             	sar    $0x1f,%ecx
+  8026df:	c1 e9 11             	shr    $0x11,%ecx
+  8026e2:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  8026e5:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8026ea:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  8026ec:	29 d3                	sub    %edx,%ebx
+  8026ee:	ba 00 80 00 00       	mov    $0x8000,%edx
+  8026f3:	29 c2                	sub    %eax,%edx
+  8026f5:	39 d3                	cmp    %edx,%ebx
+  8026f7:	0f 47 da             	cmova  %edx,%ebx
+  8026fa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8026fd:	29 fa                	sub    %edi,%edx
+  8026ff:	39 d3                	cmp    %edx,%ebx
+  802701:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  802704:	83 ec 04             	sub    $0x4,%esp
+  802707:	53                   	push   %ebx
+  802708:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80270b:	01 c8                	add    %ecx,%eax
+  80270d:	50                   	push   %eax
+  80270e:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802711:	01 f8                	add    %edi,%eax
+  802713:	50                   	push   %eax
+  802714:	e8 89 e5 ff ff       	call   800ca2 <memcpy>
+    i += m;
+  802719:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  80271b:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  80271d:	89 f2                	mov    %esi,%edx
+  80271f:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802722:	e8 03 fd ff ff       	call   80242a <pipe_wakeup>
+  802727:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  80272a:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  80272d:	73 51                	jae    802780 <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  80272f:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  802732:	8b 16                	mov    (%esi),%edx
+  802734:	39 da                	cmp    %ebx,%edx
+  802736:	75 a2                	jne    8026da <devpipe_read_bulk+0x36>
+      if (i > 0)
+  802738:	85 ff                	test   %edi,%edi
+  80273a:	75 44                	jne    802780 <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  80273c:	89 f2                	mov    %esi,%edx
+  80273e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802741:	e8 90 fd ff ff       	call   8024d6 <_pipeisclosed>
+  802746:	85 c0                	test   %eax,%eax
+  802748:	75 3a                	jne    802784 <devpipe_read_bulk+0xe0>
+  80274a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80274f:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802753:	6a 64                	push   $0x64
+  802755:	ff 75 d4             	push   -0x2c(%ebp)
+  802758:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  802759:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  80275c:	50                   	push   %eax
+  80275d:	e8 c0 ea ff ff       	call   801222 <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  802762:	85 c0                	test   %eax,%eax
+  802764:	ba 00 00 00 00       	mov    $0x0,%edx
+  802769:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  80276c:	83 c4 10             	add    $0x10,%esp
+  80276f:	a8 01                	test   $0x1,%al
+  802771:	74 b7                	je     80272a <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  802773:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  802778:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80277b:	5b                   	pop    %ebx
+  80277c:	5e                   	pop    %esi
+  80277d:	5f                   	pop    %edi
+  80277e:	5d                   	pop    %ebp
+  80277f:	c3                   	ret
+  return i;
+  802780:	89 f8                	mov    %edi,%eax
+  802782:	eb f4                	jmp    802778 <devpipe_read_bulk+0xd4>
+        return 0;
+  802784:	b8 00 00 00 00       	mov    $0x0,%eax
+  802789:	eb ed                	jmp    802778 <devpipe_read_bulk+0xd4>
+
+0080278b <devpipe_read>:
+{
+  80278b:	55                   	push   %ebp
+  80278c:	89 e5                	mov    %esp,%ebp
+  80278e:	57                   	push   %edi
+  80278f:	56                   	push   %esi
+  802790:	53                   	push   %ebx
+  802791:	83 ec 18             	sub    $0x18,%esp
+  802794:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  802797:	57                   	push   %edi
+  802798:	e8 0b ec ff ff       	call   8013a8 <fd2data>
+  80279d:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  80279f:	8b 70 28             	mov    0x28(%eax),%esi
+  8027a2:	83 c4 10             	add    $0x10,%esp
+  8027a5:	85 f6                	test   %esi,%esi
+  8027a7:	75 24                	jne    8027cd <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  8027a9:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8027ac:	74 60                	je     80280e <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  8027ae:	8b 03                	mov    (%ebx),%eax
+  8027b0:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8027b3:	75 3b                	jne    8027f0 <devpipe_read+0x65>
+      if (i > 0)
+  8027b5:	85 f6                	test   %esi,%esi
+  8027b7:	75 2d                	jne    8027e6 <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  8027b9:	89 da                	mov    %ebx,%edx
+  8027bb:	89 f8                	mov    %edi,%eax
+  8027bd:	e8 14 fd ff ff       	call   8024d6 <_pipeisclosed>
+  8027c2:	85 c0                	test   %eax,%eax
+  8027c4:	75 4c                	jne    802812 <devpipe_read+0x87>
+      sys_yield();
+  8027c6:	e8 bc e6 ff ff       	call   800e87 <sys_yield>
+  8027cb:	eb e1                	jmp    8027ae <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  8027cd:	83 ec 08             	sub    $0x8,%esp
+  8027d0:	6a 00                	push   $0x0
+  8027d2:	ff 75 10             	push   0x10(%ebp)
+  8027d5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8027d8:	89 c2                	mov    %eax,%edx
+  8027da:	89 f8                	mov    %edi,%eax
+  8027dc:	e8 c3 fe ff ff       	call   8026a4 <devpipe_read_bulk>
+  8027e1:	83 c4 10             	add    $0x10,%esp
+  8027e4:	eb 02                	jmp    8027e8 <devpipe_read+0x5d>
+        return i;
+  8027e6:	89 f0                	mov    %esi,%eax
+}
+  8027e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027eb:	5b                   	pop    %ebx
+  8027ec:	5e                   	pop    %esi
+  8027ed:	5f                   	pop    %edi
+  8027ee:	5d                   	pop    %ebp
+  8027ef:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8027f0:	99                   	cltd
+  8027f1:	c1 ea 1b             	shr    $0x1b,%edx
+  8027f4:	01 d0                	add    %edx,%eax
+  8027f6:	83 e0 1f             	and    $0x1f,%eax
+  8027f9:	29 d0                	sub    %edx,%eax
+  8027fb:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802800:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802803:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  802806:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  802809:	83 c6 01             	add    $0x1,%esi
+  80280c:	eb 9b                	jmp    8027a9 <devpipe_read+0x1e>
+  return i;
+  80280e:	89 f0                	mov    %esi,%eax
+  802810:	eb d6                	jmp    8027e8 <devpipe_read+0x5d>
+        return 0;
+  802812:	b8 00 00 00 00       	mov    $0x0,%eax
+  802817:	eb cf                	jmp    8027e8 <devpipe_read+0x5d>
+
+00802819 <pipe2>:
+{
+  802819:	55                   	push   %ebp
+  80281a:	89 e5                	mov    %esp,%ebp
+  80281c:	57                   	push   %edi
+  80281d:	56                   	push   %esi
+  80281e:	53                   	push   %ebx
+  80281f:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  802822:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802825:	50                   	push   %eax
+  802826:	e8 91 eb ff ff       	call   8013bc <fd_alloc>
+  80282b:	89 c3                	mov    %eax,%ebx
+  80282d:	83 c4 10             	add    $0x10,%esp
+  802830:	85 c0                	test   %eax,%eax
+  802832:	0f 88 fb 01 00 00    	js     802a33 <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802838:	83 ec 04             	sub    $0x4,%esp
+  80283b:	68 07 04 00 00       	push   $0x407
+  802840:	ff 75 e4             	push   -0x1c(%ebp)
+  802843:	6a 00                	push   $0x0
+  802845:	e8 9f e6 ff ff       	call   800ee9 <sys_page_alloc>
+  80284a:	89 c3                	mov    %eax,%ebx
+  80284c:	83 c4 10             	add    $0x10,%esp
+  80284f:	85 c0                	test   %eax,%eax
+  802851:	0f 88 dc 01 00 00    	js     802a33 <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  802857:	83 ec 0c             	sub    $0xc,%esp
+  80285a:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80285d:	50                   	push   %eax
+  80285e:	e8 59 eb ff ff       	call   8013bc <fd_alloc>
+  802863:	89 c3                	mov    %eax,%ebx
+  802865:	83 c4 10             	add    $0x10,%esp
+  802868:	85 c0                	test   %eax,%eax
+  80286a:	0f 88 b3 01 00 00    	js     802a23 <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802870:	83 ec 04             	sub    $0x4,%esp
+  802873:	68 07 04 00 00       	push   $0x407
+  802878:	ff 75 e0             	push   -0x20(%ebp)
+  80287b:	6a 00                	push   $0x0
+  80287d:	e8 67 e6 ff ff       	call   800ee9 <sys_page_alloc>
+  802882:	89 c3                	mov    %eax,%ebx
+  802884:	83 c4 10             	add    $0x10,%esp
+  802887:	85 c0                	test   %eax,%eax
+  802889:	0f 88 94 01 00 00    	js     802a23 <pipe2+0x20a>
+  va = fd2data(fd0);
+  80288f:	83 ec 0c             	sub    $0xc,%esp
+  802892:	ff 75 e4             	push   -0x1c(%ebp)
+  802895:	e8 0e eb ff ff       	call   8013a8 <fd2data>
+  80289a:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80289c:	83 c4 0c             	add    $0xc,%esp
+  80289f:	68 07 04 00 00       	push   $0x407
+  8028a4:	50                   	push   %eax
+  8028a5:	6a 00                	push   $0x0
+  8028a7:	e8 3d e6 ff ff       	call   800ee9 <sys_page_alloc>
+  8028ac:	89 c3                	mov    %eax,%ebx
+  8028ae:	83 c4 10             	add    $0x10,%esp
+  8028b1:	85 c0                	test   %eax,%eax
+  8028b3:	0f 88 5a 01 00 00    	js     802a13 <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8028b9:	83 ec 0c             	sub    $0xc,%esp
+  8028bc:	ff 75 e0             	push   -0x20(%ebp)
+  8028bf:	e8 e4 ea ff ff       	call   8013a8 <fd2data>
+  8028c4:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8028cb:	50                   	push   %eax
+  8028cc:	6a 00                	push   $0x0
+  8028ce:	57                   	push   %edi
+  8028cf:	6a 00                	push   $0x0
+  8028d1:	e8 56 e6 ff ff       	call   800f2c <sys_page_map>
+  8028d6:	89 c3                	mov    %eax,%ebx
+  8028d8:	83 c4 20             	add    $0x20,%esp
+  8028db:	85 c0                	test   %eax,%eax
+  8028dd:	0f 88 22 01 00 00    	js     802a05 <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  8028e3:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  8028e7:	74 72                	je     80295b <pipe2+0x142>
+  8028e9:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  8028ee:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8028f1:	e8 d3 fa ff ff       	call   8023c9 <pipe_ring>
+  8028f6:	83 ec 04             	sub    $0x4,%esp
+  8028f9:	68 07 04 00 00       	push   $0x407
+  8028fe:	01 f0                	add    %esi,%eax
+  802900:	50                   	push   %eax
+  802901:	6a 00                	push   $0x0
+  802903:	e8 e1 e5 ff ff       	call   800ee9 <sys_page_alloc>
+  802908:	89 c3                	mov    %eax,%ebx
+  80290a:	83 c4 10             	add    $0x10,%esp
+  80290d:	85 c0                	test   %eax,%eax
+  80290f:	0f 88 97 00 00 00    	js     8029ac <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  802915:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802918:	e8 ac fa ff ff       	call   8023c9 <pipe_ring>
+  80291d:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  802920:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802923:	e8 a1 fa ff ff       	call   8023c9 <pipe_ring>
+  802928:	83 ec 0c             	sub    $0xc,%esp
+  80292b:	68 07 04 00 00       	push   $0x407
+  802930:	53                   	push   %ebx
+  802931:	6a 00                	push   $0x0
+  802933:	01 f0                	add    %esi,%eax
+  802935:	50                   	push   %eax
+  802936:	6a 00                	push   $0x0
+  802938:	e8 ef e5 ff ff       	call   800f2c <sys_page_map>
+  80293d:	89 c3                	mov    %eax,%ebx
+  80293f:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802945:	83 c4 20             	add    $0x20,%esp
+  802948:	85 c0                	test   %eax,%eax
+  80294a:	78 60                	js     8029ac <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  80294c:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802952:	75 9a                	jne    8028ee <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  802954:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  80295b:	a1 20 40 80 00       	mov    0x804020,%eax
+  802960:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802963:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  802965:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802968:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  80296f:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802972:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  802974:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802977:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  80297e:	83 ec 0c             	sub    $0xc,%esp
+  802981:	ff 75 e4             	push   -0x1c(%ebp)
+  802984:	e8 0f ea ff ff       	call   801398 <fd2num>
+  802989:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80298c:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  80298e:	83 c4 04             	add    $0x4,%esp
+  802991:	ff 75 e0             	push   -0x20(%ebp)
+  802994:	e8 ff e9 ff ff       	call   801398 <fd2num>
+  802999:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80299c:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  80299f:	83 c4 10             	add    $0x10,%esp
+  8029a2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029a7:	e9 87 00 00 00       	jmp    802a33 <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  8029ac:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  8029b1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8029b4:	e8 10 fa ff ff       	call   8023c9 <pipe_ring>
+  8029b9:	83 ec 08             	sub    $0x8,%esp
+  8029bc:	01 f0                	add    %esi,%eax
+  8029be:	50                   	push   %eax
+  8029bf:	6a 00                	push   $0x0
+  8029c1:	e8 a8 e5 ff ff       	call   800f6e <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  8029c6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8029c9:	e8 fb f9 ff ff       	call   8023c9 <pipe_ring>
+  8029ce:	83 c4 08             	add    $0x8,%esp
+  8029d1:	01 f0                	add    %esi,%eax
+  8029d3:	50                   	push   %eax
+  8029d4:	6a 00                	push   $0x0
+  8029d6:	e8 93 e5 ff ff       	call   800f6e <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  8029db:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8029e1:	83 c4 10             	add    $0x10,%esp
+  8029e4:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  8029ea:	75 c5                	jne    8029b1 <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  8029ec:	83 ec 0c             	sub    $0xc,%esp
+  8029ef:	ff 75 e0             	push   -0x20(%ebp)
+  8029f2:	e8 b1 e9 ff ff       	call   8013a8 <fd2data>
+  8029f7:	83 c4 08             	add    $0x8,%esp
+  8029fa:	50                   	push   %eax
+  8029fb:	6a 00                	push   $0x0
+  8029fd:	e8 6c e5 ff ff       	call   800f6e <sys_page_unmap>
+  802a02:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  802a05:	83 ec 08             	sub    $0x8,%esp
+  802a08:	57                   	push   %edi
+  802a09:	6a 00                	push   $0x0
+  802a0b:	e8 5e e5 ff ff       	call   800f6e <sys_page_unmap>
+  802a10:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  802a13:	83 ec 08             	sub    $0x8,%esp
+  802a16:	ff 75 e0             	push   -0x20(%ebp)
+  802a19:	6a 00                	push   $0x0
+  802a1b:	e8 4e e5 ff ff       	call   800f6e <sys_page_unmap>
+  802a20:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  802a23:	83 ec 08             	sub    $0x8,%esp
+  802a26:	ff 75 e4             	push   -0x1c(%ebp)
+  802a29:	6a 00                	push   $0x0
+  802a2b:	e8 3e e5 ff ff       	call   800f6e <sys_page_unmap>
+  802a30:	83 c4 10             	add    $0x10,%esp
+}
+  802a33:	89 d8                	mov    %ebx,%eax
+  802a35:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a38:	5b                   	pop    %ebx
+  802a39:	5e                   	pop    %esi
+  802a3a:	5f                   	pop    %edi
+  802a3b:	5d                   	pop    %ebp
+  802a3c:	c3                   	ret
+
+00802a3d <pipe>:
+{
+  802a3d:	55                   	push   %ebp
+  802a3e:	89 e5                	mov    %esp,%ebp
+  802a40:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  802a43:	6a 00                	push   $0x0
+  802a45:	ff 75 08             	push   0x8(%ebp)
+  802a48:	e8 cc fd ff ff       	call   802819 <pipe2>
+}
+  802a4d:	c9                   	leave
+  802a4e:	c3                   	ret
+
+00802a4f <pipeisclosed>:
+{
+  802a4f:	55                   	push   %ebp
+  802a50:	89 e5                	mov    %esp,%ebp
+  802a52:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802a55:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a58:	50                   	push   %eax
+  802a59:	ff 75 08             	push   0x8(%ebp)
+  802a5c:	e8 b1 e9 ff ff       	call   801412 <fd_lookup>
+  802a61:	83 c4 10             	add    $0x10,%esp
+  802a64:	85 c0                	test   %eax,%eax
+  802a66:	78 18                	js     802a80 <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  802a68:	83 ec 0c             	sub    $0xc,%esp
+  802a6b:	ff 75 f4             	push   -0xc(%ebp)
+  802a6e:	e8 35 e9 ff ff       	call   8013a8 <fd2data>
+  802a73:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  802a75:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a78:	e8 59 fa ff ff       	call   8024d6 <_pipeisclosed>
+  802a7d:	83 c4 10             	add    $0x10,%esp
+}
+  802a80:	c9                   	leave
+  802a81:	c3                   	ret
+
+00802a82 <pipe_splice>:
+{
+  802a82:	55                   	push   %ebp
+  802a83:	89 e5                	mov    %esp,%ebp
+  802a85:	57                   	push   %edi
+  802a86:	56                   	push   %esi
+  802a87:	53                   	push   %ebx
+  802a88:	83 ec 34             	sub    $0x34,%esp
+  802a8b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802a8e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802a91:	50                   	push   %eax
+  802a92:	ff 75 08             	push   0x8(%ebp)
+  802a95:	e8 78 e9 ff ff       	call   801412 <fd_lookup>
+  802a9a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802a9d:	83 c4 10             	add    $0x10,%esp
+  802aa0:	85 c0                	test   %eax,%eax
+  802aa2:	0f 88 d7 00 00 00    	js     802b7f <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  802aa8:	83 ec 0c             	sub    $0xc,%esp
+  802aab:	ff 75 e4             	push   -0x1c(%ebp)
+  802aae:	e8 f5 e8 ff ff       	call   8013a8 <fd2data>
+  802ab3:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802ab5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802ab8:	83 c4 10             	add    $0x10,%esp
+  802abb:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802ac1:	39 10                	cmp    %edx,(%eax)
+  802ac3:	0f 85 c1 00 00 00    	jne    802b8a <pipe_splice+0x108>
+  802ac9:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  802acd:	0f 84 c0 00 00 00    	je     802b93 <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  802ad3:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802ad7:	0f 84 bf 00 00 00    	je     802b9c <pipe_splice+0x11a>
+  802add:	89 f7                	mov    %esi,%edi
+  802adf:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  802ae5:	0f 85 ba 00 00 00    	jne    802ba5 <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802aeb:	8d 43 04             	lea    0x4(%ebx),%eax
+  802aee:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802af1:	eb 38                	jmp    802b2b <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802af3:	83 ec 0c             	sub    $0xc,%esp
+  802af6:	68 00 10 00 00       	push   $0x1000
+  802afb:	89 f1                	mov    %esi,%ecx
+  802afd:	89 da                	mov    %ebx,%edx
+  802aff:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802b02:	e8 34 fa ff ff       	call   80253b <devpipe_write_bulk>
+  802b07:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802b0a:	83 c4 10             	add    $0x10,%esp
+  802b0d:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802b12:	75 53                	jne    802b67 <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  802b14:	83 ec 08             	sub    $0x8,%esp
+  802b17:	56                   	push   %esi
+  802b18:	6a 00                	push   $0x0
+  802b1a:	e8 4f e4 ff ff       	call   800f6e <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  802b1f:	83 c7 01             	add    $0x1,%edi
+  802b22:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802b28:	83 c4 10             	add    $0x10,%esp
+  802b2b:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802b2e:	74 3a                	je     802b6a <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  802b30:	8b 03                	mov    (%ebx),%eax
+  802b32:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802b35:	75 bc                	jne    802af3 <pipe_splice+0x71>
+  802b37:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b3c:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  802b40:	85 c0                	test   %eax,%eax
+  802b42:	74 af                	je     802af3 <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802b44:	83 ec 04             	sub    $0x4,%esp
+  802b47:	6a 07                	push   $0x7
+  802b49:	56                   	push   %esi
+  802b4a:	ff 75 d0             	push   -0x30(%ebp)
+  802b4d:	e8 f3 e6 ff ff       	call   801245 <sys_chan_wakeup>
+  802b52:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802b55:	83 c4 10             	add    $0x10,%esp
+  802b58:	85 c0                	test   %eax,%eax
+  802b5a:	79 b8                	jns    802b14 <pipe_splice+0x92>
+  802b5c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802b61:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802b65:	eb 8c                	jmp    802af3 <pipe_splice+0x71>
+  802b67:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  802b6a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802b6e:	75 06                	jne    802b76 <pipe_splice+0xf4>
+  802b70:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802b74:	78 09                	js     802b7f <pipe_splice+0xfd>
+  return i * PGSIZE;
+  802b76:	8b 45 10             	mov    0x10(%ebp),%eax
+  802b79:	c1 e0 0c             	shl    $0xc,%eax
+  802b7c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  802b7f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802b82:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b85:	5b                   	pop    %ebx
+  802b86:	5e                   	pop    %esi
+  802b87:	5f                   	pop    %edi
+  802b88:	5d                   	pop    %ebp
+  802b89:	c3                   	ret
+    return -E_INVAL;
+  802b8a:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802b91:	eb ec                	jmp    802b7f <pipe_splice+0xfd>
+  802b93:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802b9a:	eb e3                	jmp    802b7f <pipe_splice+0xfd>
+  802b9c:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802ba3:	eb da                	jmp    802b7f <pipe_splice+0xfd>
+  802ba5:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802bac:	eb d1                	jmp    802b7f <pipe_splice+0xfd>
+
+00802bae <pipe_splice_read>:
+{
+  802bae:	55                   	push   %ebp
+  802baf:	89 e5                	mov    %esp,%ebp
+  802bb1:	53                   	push   %ebx
+  802bb2:	83 ec 1c             	sub    $0x1c,%esp
+  802bb5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802bb8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802bbb:	50                   	push   %eax
+  802bbc:	ff 75 08             	push   0x8(%ebp)
+  802bbf:	e8 4e e8 ff ff       	call   801412 <fd_lookup>
+  802bc4:	83 c4 10             	add    $0x10,%esp
+  802bc7:	85 c0                	test   %eax,%eax
+  802bc9:	78 49                	js     802c14 <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  802bcb:	83 ec 0c             	sub    $0xc,%esp
+  802bce:	ff 75 f4             	push   -0xc(%ebp)
+  802bd1:	e8 d2 e7 ff ff       	call   8013a8 <fd2data>
+  802bd6:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802bd8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802bdb:	83 c4 10             	add    $0x10,%esp
+  802bde:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  802be4:	39 08                	cmp    %ecx,(%eax)
+  802be6:	75 31                	jne    802c19 <pipe_splice_read+0x6b>
+  802be8:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  802bec:	74 32                	je     802c20 <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  802bee:	8b 48 08             	mov    0x8(%eax),%ecx
+  802bf1:	83 e1 03             	and    $0x3,%ecx
+  802bf4:	83 f9 01             	cmp    $0x1,%ecx
+  802bf7:	74 2e                	je     802c27 <pipe_splice_read+0x79>
+  802bf9:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  802bff:	75 2d                	jne    802c2e <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  802c01:	83 ec 08             	sub    $0x8,%esp
+  802c04:	53                   	push   %ebx
+  802c05:	68 00 10 00 00       	push   $0x1000
+  802c0a:	89 d9                	mov    %ebx,%ecx
+  802c0c:	e8 93 fa ff ff       	call   8026a4 <devpipe_read_bulk>
+  802c11:	83 c4 10             	add    $0x10,%esp
+}
+  802c14:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c17:	c9                   	leave
+  802c18:	c3                   	ret
+    return -E_INVAL;
+  802c19:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c1e:	eb f4                	jmp    802c14 <pipe_splice_read+0x66>
+  802c20:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c25:	eb ed                	jmp    802c14 <pipe_splice_read+0x66>
+  802c27:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c2c:	eb e6                	jmp    802c14 <pipe_splice_read+0x66>
+  802c2e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c33:	eb df                	jmp    802c14 <pipe_splice_read+0x66>
+
+00802c35 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  802c35:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c3a:	c3                   	ret
+
+00802c3b <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802c3b:	55                   	push   %ebp
+  802c3c:	89 e5                	mov    %esp,%ebp
+  802c3e:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  802c41:	68 c7 36 80 00       	push   $0x8036c7
+  802c46:	ff 75 0c             	push   0xc(%ebp)
+  802c49:	e8 6c de ff ff       	call   800aba <strcpy>
+  return 0;
+}
+  802c4e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c53:	c9                   	leave
+  802c54:	c3                   	ret
+
+00802c55 <devcons_write>:
+{
+  802c55:	55                   	push   %ebp
+  802c56:	89 e5                	mov    %esp,%ebp
+  802c58:	57                   	push   %edi
+  802c59:	56                   	push   %esi
+  802c5a:	53                   	push   %ebx
+  802c5b:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  802c61:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  802c66:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  802c6c:	eb 2e                	jmp    802c9c <devcons_write+0x47>
+    m = n - tot;
+  802c6e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802c71:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  802c73:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802c78:	39 c3                	cmp    %eax,%ebx
+  802c7a:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  802c7d:	83 ec 04             	sub    $0x4,%esp
+  802c80:	53                   	push   %ebx
+  802c81:	89 f0                	mov    %esi,%eax
+  802c83:	03 45 0c             	add    0xc(%ebp),%eax
+  802c86:	50                   	push   %eax
+  802c87:	57                   	push   %edi
+  802c88:	e8 b3 df ff ff       	call   800c40 <memmove>
+    sys_cputs(buf, m);
+  802c8d:	83 c4 08             	add    $0x8,%esp
+  802c90:	53                   	push   %ebx
+  802c91:	57                   	push   %edi
+  802c92:	e8 53 e1 ff ff       	call   800dea <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  802c97:	01 de                	add    %ebx,%esi
+  802c99:	83 c4 10             	add    $0x10,%esp
+  802c9c:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802c9f:	72 cd                	jb     802c6e <devcons_write+0x19>
+}
+  802ca1:	89 f0                	mov    %esi,%eax
+  802ca3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ca6:	5b                   	pop    %ebx
+  802ca7:	5e                   	pop    %esi
+  802ca8:	5f                   	pop    %edi
+  802ca9:	5d                   	pop    %ebp
+  802caa:	c3                   	ret
+
+00802cab <devcons_read>:
+{
+  802cab:	55                   	push   %ebp
+  802cac:	89 e5                	mov    %esp,%ebp
+  802cae:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  802cb1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cb6:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802cba:	75 07                	jne    802cc3 <devcons_read+0x18>
+  802cbc:	eb 1f                	jmp    802cdd <devcons_read+0x32>
+    sys_yield();
+  802cbe:	e8 c4 e1 ff ff       	call   800e87 <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  802cc3:	e8 40 e1 ff ff       	call   800e08 <sys_cgetc>
+  802cc8:	85 c0                	test   %eax,%eax
+  802cca:	74 f2                	je     802cbe <devcons_read+0x13>
+  if (c < 0)
+  802ccc:	78 0f                	js     802cdd <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  802cce:	83 f8 04             	cmp    $0x4,%eax
+  802cd1:	74 0c                	je     802cdf <devcons_read+0x34>
+  *(char*)vbuf = c;
+  802cd3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802cd6:	88 02                	mov    %al,(%edx)
+  return 1;
+  802cd8:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802cdd:	c9                   	leave
+  802cde:	c3                   	ret
+    return 0;
+  802cdf:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ce4:	eb f7                	jmp    802cdd <devcons_read+0x32>
+
+00802ce6 <cputchar>:
+{
+  802ce6:	55                   	push   %ebp
+  802ce7:	89 e5                	mov    %esp,%ebp
+  802ce9:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  802cec:	8b 45 08             	mov    0x8(%ebp),%eax
+  802cef:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  802cf2:	6a 01                	push   $0x1
+  802cf4:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802cf7:	50                   	push   %eax
+  802cf8:	e8 ed e0 ff ff       	call   800dea <sys_cputs>
+}
+  802cfd:	83 c4 10             	add    $0x10,%esp
+  802d00:	c9                   	leave
+  802d01:	c3                   	ret
+
+00802d02 <getchar>:
+{
+  802d02:	55                   	push   %ebp
+  802d03:	89 e5                	mov    %esp,%ebp
+  802d05:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  802d08:	6a 01                	push   $0x1
+  802d0a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802d0d:	50                   	push   %eax
+  802d0e:	6a 00                	push   $0x0
+  802d10:	e8 a8 e9 ff ff       	call   8016bd <read>
+  if (r < 0)
+  802d15:	83 c4 10             	add    $0x10,%esp
+  802d18:	85 c0                	test   %eax,%eax
+  802d1a:	78 06                	js     802d22 <getchar+0x20>
+  if (r < 1)
+  802d1c:	74 06                	je     802d24 <getchar+0x22>
+  return c;
+  802d1e:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802d22:	c9                   	leave
+  802d23:	c3                   	ret
+    return -E_EOF;
+  802d24:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802d29:	eb f7                	jmp    802d22 <getchar+0x20>
+
+00802d2b <iscons>:
+{
+  802d2b:	55                   	push   %ebp
+  802d2c:	89 e5                	mov    %esp,%ebp
+  802d2e:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802d31:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802d34:	50                   	push   %eax
+  802d35:	ff 75 08             	push   0x8(%ebp)
+  802d38:	e8 d5 e6 ff ff       	call   801412 <fd_lookup>
+  802d3d:	83 c4 10             	add    $0x10,%esp
+  802d40:	85 c0                	test   %eax,%eax
+  802d42:	78 11                	js     802d55 <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  802d44:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802d47:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802d4d:	39 10                	cmp    %edx,(%eax)
+  802d4f:	0f 94 c0             	sete   %al
+  802d52:	0f b6 c0             	movzbl %al,%eax
+}
+  802d55:	c9                   	leave
+  802d56:	c3                   	ret
+
+00802d57 <opencons>:
+{
+  802d57:	55                   	push   %ebp
+  802d58:	89 e5                	mov    %esp,%ebp
+  802d5a:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  802d5d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802d60:	50                   	push   %eax
+  802d61:	e8 56 e6 ff ff       	call   8013bc <fd_alloc>
+  802d66:	83 c4 10             	add    $0x10,%esp
+  802d69:	85 c0                	test   %eax,%eax
+  802d6b:	78 3a                	js     802da7 <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802d6d:	83 ec 04             	sub    $0x4,%esp
+  802d70:	68 07 04 00 00       	push   $0x407
+  802d75:	ff 75 f4             	push   -0xc(%ebp)
+  802d78:	6a 00                	push   $0x0
+  802d7a:	e8 6a e1 ff ff       	call   800ee9 <sys_page_alloc>
+  802d7f:	83 c4 10             	add    $0x10,%esp
+  802d82:	85 c0                	test   %eax,%eax
+  802d84:	78 21                	js     802da7 <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  802d86:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802d89:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802d8f:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  802d91:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802d94:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  802d9b:	83 ec 0c             	sub    $0xc,%esp
+  802d9e:	50                   	push   %eax
+  802d9f:	e8 f4 e5 ff ff       	call   801398 <fd2num>
+  802da4:	83 c4 10             	add    $0x10,%esp
+}
+  802da7:	c9                   	leave
+  802da8:	c3                   	ret
+
+00802da9 <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  802da9:	55                   	push   %ebp
+  802daa:	89 e5                	mov    %esp,%ebp
+  802dac:	57                   	push   %edi
+  802dad:	56                   	push   %esi
+  802dae:	53                   	push   %ebx
+  802daf:	83 ec 14             	sub    $0x14,%esp
+  802db2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802db5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802db8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802dbb:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  802dbe:	85 c0                	test   %eax,%eax
+  802dc0:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802dc5:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  802dc8:	ff 33                	push   (%ebx)
+  802dca:	50                   	push   %eax
+  802dcb:	e8 f1 e3 ff ff       	call   8011c1 <sys_ipc_recv>
+  802dd0:	83 c4 10             	add    $0x10,%esp
+  802dd3:	85 c0                	test   %eax,%eax
+  802dd5:	78 39                	js     802e10 <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  802dd7:	85 ff                	test   %edi,%edi
+  802dd9:	74 0a                	je     802de5 <ipc_recv_pages+0x3c>
+  802ddb:	a1 64 67 80 00       	mov    0x806764,%eax
+  802de0:	8b 40 7c             	mov    0x7c(%eax),%eax
+  802de3:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  802de5:	85 f6                	test   %esi,%esi
+  802de7:	74 0d                	je     802df6 <ipc_recv_pages+0x4d>
+  802de9:	a1 64 67 80 00       	mov    0x806764,%eax
+  802dee:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  802df4:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  802df6:	a1 64 67 80 00       	mov    0x806764,%eax
+  802dfb:	8b 40 74             	mov    0x74(%eax),%eax
+  802dfe:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  802e00:	a1 64 67 80 00       	mov    0x806764,%eax
+  802e05:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  802e08:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e0b:	5b                   	pop    %ebx
+  802e0c:	5e                   	pop    %esi
+  802e0d:	5f                   	pop    %edi
+  802e0e:	5d                   	pop    %ebp
+  802e0f:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  802e10:	85 ff                	test   %edi,%edi
+  802e12:	74 06                	je     802e1a <ipc_recv_pages+0x71>
+  802e14:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  802e1a:	85 f6                	test   %esi,%esi
+  802e1c:	74 06                	je     802e24 <ipc_recv_pages+0x7b>
+  802e1e:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  802e24:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  802e2a:	eb dc                	jmp    802e08 <ipc_recv_pages+0x5f>
+
+00802e2c <ipc_recv>:
+{
+  802e2c:	55                   	push   %ebp
+  802e2d:	89 e5                	mov    %esp,%ebp
+  802e2f:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  802e32:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  802e39:	ff 75 10             	push   0x10(%ebp)
+  802e3c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802e3f:	50                   	push   %eax
+  802e40:	ff 75 0c             	push   0xc(%ebp)
+  802e43:	ff 75 08             	push   0x8(%ebp)
+  802e46:	e8 5e ff ff ff       	call   802da9 <ipc_recv_pages>
+}
+  802e4b:	c9                   	leave
+  802e4c:	c3                   	ret
+
+00802e4d <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  802e4d:	55                   	push   %ebp
+  802e4e:	89 e5                	mov    %esp,%ebp
+  802e50:	57                   	push   %edi
+  802e51:	56                   	push   %esi
+  802e52:	53                   	push   %ebx
+  802e53:	83 ec 0c             	sub    $0xc,%esp
+  802e56:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802e59:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802e5c:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  802e5f:	89 c3                	mov    %eax,%ebx
+  802e61:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  802e67:	85 c0                	test   %eax,%eax
+  802e69:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802e6e:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  802e71:	83 ec 0c             	sub    $0xc,%esp
+  802e74:	ff 75 14             	push   0x14(%ebp)
+  802e77:	ff 75 18             	push   0x18(%ebp)
+  802e7a:	53                   	push   %ebx
+  802e7b:	56                   	push   %esi
+  802e7c:	57                   	push   %edi
+  802e7d:	e8 1e e3 ff ff       	call   8011a0 <sys_ipc_try_send>
+  802e82:	83 c4 20             	add    $0x20,%esp
+  802e85:	85 c0                	test   %eax,%eax
+  802e87:	79 1e                	jns    802ea7 <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  802e89:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802e8c:	75 07                	jne    802e95 <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  802e8e:	e8 f4 df ff ff       	call   800e87 <sys_yield>
+  802e93:	eb dc                	jmp    802e71 <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  802e95:	50                   	push   %eax
+  802e96:	68 d3 36 80 00       	push   $0x8036d3
+  802e9b:	6a 5c                	push   $0x5c
+  802e9d:	68 e0 36 80 00       	push   $0x8036e0
+  802ea2:	e8 4a d5 ff ff       	call   8003f1 <_panic>
+  }
+}
+  802ea7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802eaa:	5b                   	pop    %ebx
+  802eab:	5e                   	pop    %esi
+  802eac:	5f                   	pop    %edi
+  802ead:	5d                   	pop    %ebp
+  802eae:	c3                   	ret
+
+00802eaf <ipc_send>:
+{
+  802eaf:	55                   	push   %ebp
+  802eb0:	89 e5                	mov    %esp,%ebp
+  802eb2:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  802eb5:	ff 75 14             	push   0x14(%ebp)
+  802eb8:	6a 01                	push   $0x1
+  802eba:	ff 75 10             	push   0x10(%ebp)
+  802ebd:	ff 75 0c             	push   0xc(%ebp)
+  802ec0:	ff 75 08             	push   0x8(%ebp)
+  802ec3:	e8 85 ff ff ff       	call   802e4d <ipc_send_pages>
+}
+  802ec8:	83 c4 20             	add    $0x20,%esp
+  802ecb:	c9                   	leave
+  802ecc:	c3                   	ret
+
+00802ecd <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802ecd:	55                   	push   %ebp
+  802ece:	89 e5                	mov    %esp,%ebp
+  802ed0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  802ed3:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  802ed8:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802edb:	c1 e0 04             	shl    $0x4,%eax
+  802ede:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802ee3:	8b 40 50             	mov    0x50(%eax),%eax
+  802ee6:	39 c8                	cmp    %ecx,%eax
+  802ee8:	74 12                	je     802efc <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  802eea:	83 c2 01             	add    $0x1,%edx
+  802eed:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802ef3:	75 e3                	jne    802ed8 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  802ef5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802efa:	eb 0e                	jmp    802f0a <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  802efc:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802eff:	c1 e0 04             	shl    $0x4,%eax
+  802f02:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802f07:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802f0a:	5d                   	pop    %ebp
+  802f0b:	c3                   	ret
+
+00802f0c <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802f0c:	55                   	push   %ebp
+  802f0d:	89 e5                	mov    %esp,%ebp
+  802f0f:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802f12:	89 c2                	mov    %eax,%edx
+  802f14:	c1 ea 16             	shr    $0x16,%edx
+  802f17:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  802f1e:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802f23:	f6 c1 01             	test   $0x1,%cl
+  802f26:	74 1c                	je     802f44 <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  802f28:	c1 e8 0c             	shr    $0xc,%eax
+  802f2b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  802f32:	a8 01                	test   $0x1,%al
+  802f34:	74 0e                	je     802f44 <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  802f36:	c1 e8 0c             	shr    $0xc,%eax
+  802f39:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802f40:	ef 
+  802f41:	0f b7 d2             	movzwl %dx,%edx
+}
+  802f44:	89 d0                	mov    %edx,%eax
+  802f46:	5d                   	pop    %ebp
+  802f47:	c3                   	ret
+
+00802f48 <udivmod>:
+  802f48:	55                   	push   %ebp
+  802f49:	57                   	push   %edi
+  802f4a:	56                   	push   %esi
+  802f4b:	53                   	push   %ebx
+  802f4c:	83 ec 14             	sub    $0x14,%esp
+  802f4f:	8b 74 24 28          	mov    0x28(%esp),%esi
+  802f53:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  802f57:	89 fb                	mov    %edi,%ebx
+  802f59:	09 f3                	or     %esi,%ebx
+  802f5b:	0f 84 88 00 00 00    	je     802fe9 <udivmod+0xa1>
+  802f61:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802f66:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802f6d:	00 
+  802f6e:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802f75:	00 
+  802f76:	89 cd                	mov    %ecx,%ebp
+  802f78:	89 34 24             	mov    %esi,(%esp)
+  802f7b:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802f7f:	eb 08                	jmp    802f89 <udivmod+0x41>
+  802f81:	83 ed 01             	sub    $0x1,%ebp
+  802f84:	83 fd ff             	cmp    $0xffffffff,%ebp
+  802f87:	74 6c                	je     802ff5 <udivmod+0xad>
+  802f89:	89 c3                	mov    %eax,%ebx
+  802f8b:	89 d6                	mov    %edx,%esi
+  802f8d:	89 e9                	mov    %ebp,%ecx
+  802f8f:	0f ad f3             	shrd   %cl,%esi,%ebx
+  802f92:	d3 ee                	shr    %cl,%esi
+  802f94:	f6 c1 20             	test   $0x20,%cl
+  802f97:	74 04                	je     802f9d <udivmod+0x55>
+  802f99:	89 f3                	mov    %esi,%ebx
+  802f9b:	31 f6                	xor    %esi,%esi
+  802f9d:	8b 3c 24             	mov    (%esp),%edi
+  802fa0:	39 fb                	cmp    %edi,%ebx
+  802fa2:	89 f7                	mov    %esi,%edi
+  802fa4:	8b 1c 24             	mov    (%esp),%ebx
+  802fa7:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802fab:	19 f7                	sbb    %esi,%edi
+  802fad:	72 d2                	jb     802f81 <udivmod+0x39>
+  802faf:	89 f7                	mov    %esi,%edi
+  802fb1:	89 de                	mov    %ebx,%esi
+  802fb3:	89 e9                	mov    %ebp,%ecx
+  802fb5:	0f a5 f7             	shld   %cl,%esi,%edi
+  802fb8:	d3 e6                	shl    %cl,%esi
+  802fba:	f6 c1 20             	test   $0x20,%cl
+  802fbd:	74 04                	je     802fc3 <udivmod+0x7b>
+  802fbf:	89 f7                	mov    %esi,%edi
+  802fc1:	31 f6                	xor    %esi,%esi
+  802fc3:	29 f0                	sub    %esi,%eax
+  802fc5:	19 fa                	sbb    %edi,%edx
+  802fc7:	be 01 00 00 00       	mov    $0x1,%esi
+  802fcc:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fd1:	0f a5 f7             	shld   %cl,%esi,%edi
+  802fd4:	d3 e6                	shl    %cl,%esi
+  802fd6:	f6 c1 20             	test   $0x20,%cl
+  802fd9:	74 04                	je     802fdf <udivmod+0x97>
+  802fdb:	89 f7                	mov    %esi,%edi
+  802fdd:	31 f6                	xor    %esi,%esi
+  802fdf:	09 74 24 08          	or     %esi,0x8(%esp)
+  802fe3:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802fe7:	eb 98                	jmp    802f81 <udivmod+0x39>
+  802fe9:	89 f0                	mov    %esi,%eax
+  802feb:	89 fa                	mov    %edi,%edx
+  802fed:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802ff1:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802ff5:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802ff9:	89 01                	mov    %eax,(%ecx)
+  802ffb:	89 51 04             	mov    %edx,0x4(%ecx)
+  802ffe:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803002:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803006:	83 c4 14             	add    $0x14,%esp
+  803009:	5b                   	pop    %ebx
+  80300a:	5e                   	pop    %esi
+  80300b:	5f                   	pop    %edi
+  80300c:	5d                   	pop    %ebp
+  80300d:	c3                   	ret
+
+0080300e <__udivdi3>:
+  80300e:	83 ec 18             	sub    $0x18,%esp
+  803011:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803015:	50                   	push   %eax
+  803016:	ff 74 24 2c          	push   0x2c(%esp)
+  80301a:	ff 74 24 2c          	push   0x2c(%esp)
+  80301e:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803022:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803026:	e8 1d ff ff ff       	call   802f48 <udivmod>
+  80302b:	83 c4 24             	add    $0x24,%esp
+  80302e:	c3                   	ret
+
+0080302f <__umoddi3>:
+  80302f:	83 ec 18             	sub    $0x18,%esp
+  803032:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803036:	50                   	push   %eax
+  803037:	ff 74 24 2c          	push   0x2c(%esp)
+  80303b:	ff 74 24 2c          	push   0x2c(%esp)
+  80303f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803043:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803047:	e8 fc fe ff ff       	call   802f48 <udivmod>
+  80304c:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803050:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803054:	83 c4 24             	add    $0x24,%esp
+  803057:	c3                   	ret
+
+00803058 <__divdi3>:
+  803058:	56                   	push   %esi
+  803059:	53                   	push   %ebx
+  80305a:	83 ec 14             	sub    $0x14,%esp
+  80305d:	8b 44 24 20          	mov    0x20(%esp),%eax
+  803061:	8b 54 24 24          	mov    0x24(%esp),%edx
+  803065:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  803069:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  80306d:	85 d2                	test   %edx,%edx
+  80306f:	78 18                	js     803089 <__divdi3+0x31>
+  803071:	85 db                	test   %ebx,%ebx
+  803073:	78 3e                	js     8030b3 <__divdi3+0x5b>
+  803075:	83 ec 04             	sub    $0x4,%esp
+  803078:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80307c:	56                   	push   %esi
+  80307d:	53                   	push   %ebx
+  80307e:	51                   	push   %ecx
+  80307f:	e8 c4 fe ff ff       	call   802f48 <udivmod>
+  803084:	83 c4 10             	add    $0x10,%esp
+  803087:	eb 24                	jmp    8030ad <__divdi3+0x55>
+  803089:	f7 d8                	neg    %eax
+  80308b:	83 d2 00             	adc    $0x0,%edx
+  80308e:	f7 da                	neg    %edx
+  803090:	85 db                	test   %ebx,%ebx
+  803092:	78 3a                	js     8030ce <__divdi3+0x76>
+  803094:	83 ec 04             	sub    $0x4,%esp
+  803097:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80309b:	56                   	push   %esi
+  80309c:	53                   	push   %ebx
+  80309d:	51                   	push   %ecx
+  80309e:	e8 a5 fe ff ff       	call   802f48 <udivmod>
+  8030a3:	83 c4 10             	add    $0x10,%esp
+  8030a6:	f7 d8                	neg    %eax
+  8030a8:	83 d2 00             	adc    $0x0,%edx
+  8030ab:	f7 da                	neg    %edx
+  8030ad:	83 c4 14             	add    $0x14,%esp
+  8030b0:	5b                   	pop    %ebx
+  8030b1:	5e                   	pop    %esi
+  8030b2:	c3                   	ret
+  8030b3:	83 ec 04             	sub    $0x4,%esp
+  8030b6:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8030ba:	56                   	push   %esi
+  8030bb:	f7 d9                	neg    %ecx
+  8030bd:	83 d3 00             	adc    $0x0,%ebx
+  8030c0:	f7 db                	neg    %ebx
+  8030c2:	53                   	push   %ebx
+  8030c3:	51                   	push   %ecx
+  8030c4:	e8 7f fe ff ff       	call   802f48 <udivmod>
+  8030c9:	83 c4 10             	add    $0x10,%esp
+  8030cc:	eb d8                	jmp    8030a6 <__divdi3+0x4e>
+  8030ce:	83 ec 04             	sub    $0x4,%esp
+  8030d1:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8030d5:	56                   	push   %esi
+  8030d6:	f7 d9                	neg    %ecx
+  8030d8:	83 d3 00             	adc    $0x0,%ebx
+  8030db:	f7 db                	neg    %ebx
+  8030dd:	53                   	push   %ebx
+  8030de:	51                   	push   %ecx
+  8030df:	e8 64 fe ff ff       	call   802f48 <udivmod>
+  8030e4:	83 c4 10             	add    $0x10,%esp
+  8030e7:	eb c4                	jmp    8030ad <__divdi3+0x55>
+
+008030e9 <__moddi3>:
+  8030e9:	55                   	push   %ebp
+  8030ea:	57                   	push   %edi
+  8030eb:	56                   	push   %esi
+  8030ec:	53                   	push   %ebx
+  8030ed:	83 ec 24             	sub    $0x24,%esp
+  8030f0:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8030f4:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8030f8:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  8030fc:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  803100:	85 d2                	test   %edx,%edx
+  803102:	78 3b                	js     80313f <__moddi3+0x56>
+  803104:	83 ec 04             	sub    $0x4,%esp
+  803107:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  80310b:	56                   	push   %esi
+  80310c:	89 ce                	mov    %ecx,%esi
+  80310e:	f7 de                	neg    %esi
+  803110:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803114:	89 de                	mov    %ebx,%esi
+  803116:	83 d6 00             	adc    $0x0,%esi
+  803119:	f7 de                	neg    %esi
+  80311b:	89 74 24 14          	mov    %esi,0x14(%esp)
+  80311f:	8b 74 24 08          	mov    0x8(%esp),%esi
+  803123:	0f 48 f1             	cmovs  %ecx,%esi
+  803126:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  80312b:	53                   	push   %ebx
+  80312c:	56                   	push   %esi
+  80312d:	e8 16 fe ff ff       	call   802f48 <udivmod>
+  803132:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803136:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80313a:	83 c4 10             	add    $0x10,%esp
+  80313d:	eb 47                	jmp    803186 <__moddi3+0x9d>
+  80313f:	f7 d8                	neg    %eax
+  803141:	83 d2 00             	adc    $0x0,%edx
+  803144:	f7 da                	neg    %edx
+  803146:	83 ec 04             	sub    $0x4,%esp
+  803149:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  80314d:	56                   	push   %esi
+  80314e:	89 cf                	mov    %ecx,%edi
+  803150:	f7 df                	neg    %edi
+  803152:	89 de                	mov    %ebx,%esi
+  803154:	83 d6 00             	adc    $0x0,%esi
+  803157:	f7 de                	neg    %esi
+  803159:	0f 49 cf             	cmovns %edi,%ecx
+  80315c:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  803160:	0f 49 de             	cmovns %esi,%ebx
+  803163:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  803167:	ff 74 24 0c          	push   0xc(%esp)
+  80316b:	ff 74 24 0c          	push   0xc(%esp)
+  80316f:	e8 d4 fd ff ff       	call   802f48 <udivmod>
+  803174:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803178:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80317c:	f7 d8                	neg    %eax
+  80317e:	83 d2 00             	adc    $0x0,%edx
+  803181:	f7 da                	neg    %edx
+  803183:	83 c4 10             	add    $0x10,%esp
+  803186:	83 c4 24             	add    $0x24,%esp
+  803189:	5b                   	pop    %ebx
+  80318a:	5e                   	pop    %esi
+  80318b:	5f                   	pop    %edi
+  80318c:	5d                   	pop    %ebp
+  80318d:	c3                   	ret
@@ -0,0 +1,6587 @@
+
+obj/user/dirbench.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 79 02 00 00       	call   8002aa <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+          hit * 1000 / NOPEN, miss * 1000 / NOPEN);
+}
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	81 ec 2c 01 00 00    	sub    $0x12c,%esp
+  char path[MAXNAMELEN];
+  unsigned ms;
+  int n, i, next, fd;
+
+  binaryname = "dirbench";
+  80003f:	c7 05 00 40 80 00 c0 	movl   $0x8030c0,0x804000
+  800046:	30 80 00 
+  n = 5000;
+  800049:	c7 85 e4 fe ff ff 88 	movl   $0x1388,-0x11c(%ebp)
+  800050:	13 00 00 
+  if (argc > 1)
+  800053:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+  800057:	7f 2f                	jg     800088 <umain+0x55>
+    n = strtol(argv[1], 0, 0);
+  seed = 1;
+  800059:	c7 05 00 50 80 00 01 	movl   $0x1,0x805000
+  800060:	00 00 00 
+
+  ms = sys_time_msec();
+  800063:	e8 c1 10 00 00       	call   801129 <sys_time_msec>
+  800068:	89 85 d4 fe ff ff    	mov    %eax,-0x12c(%ebp)
+  next = 100;
+  80006e:	c7 85 e0 fe ff ff 64 	movl   $0x64,-0x120(%ebp)
+  800075:	00 00 00 
+  for (i = 0; i < n; i++) {
+  800078:	be 00 00 00 00       	mov    $0x0,%esi
+  snprintf(buf, MAXNAMELEN, "/%s%05d", prefix, i);
+  80007d:	8d 9d e8 fe ff ff    	lea    -0x118(%ebp),%ebx
+  for (i = 0; i < n; i++) {
+  800083:	e9 7e 01 00 00       	jmp    800206 <umain+0x1d3>
+    n = strtol(argv[1], 0, 0);
+  800088:	83 ec 04             	sub    $0x4,%esp
+  80008b:	6a 00                	push   $0x0
+  80008d:	6a 00                	push   $0x0
+  80008f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800092:	ff 70 04             	push   0x4(%eax)
+  800095:	e8 9a 0b 00 00       	call   800c34 <strtol>
+  80009a:	89 85 e4 fe ff ff    	mov    %eax,-0x11c(%ebp)
+  8000a0:	83 c4 10             	add    $0x10,%esp
+  8000a3:	eb b4                	jmp    800059 <umain+0x26>
+    name(path, "dirbench", i);
+    if ((fd = open(path, O_RDWR | O_CREAT)) < 0)
+      panic("create %s: %e", path, fd);
+  8000a5:	83 ec 0c             	sub    $0xc,%esp
+  8000a8:	50                   	push   %eax
+  8000a9:	57                   	push   %edi
+  8000aa:	68 d1 30 80 00       	push   $0x8030d1
+  8000af:	6a 4b                	push   $0x4b
+  8000b1:	68 df 30 80 00       	push   $0x8030df
+  8000b6:	e8 5c 02 00 00       	call   800317 <_panic>
+    close(fd);
+  8000bb:	83 ec 0c             	sub    $0xc,%esp
+  8000be:	50                   	push   %eax
+  8000bf:	e8 97 13 00 00       	call   80145b <close>
+  8000c4:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < NOPEN; i++) {
+  8000c7:	83 ef 01             	sub    $0x1,%edi
+  8000ca:	74 65                	je     800131 <umain+0xfe>
+  seed = seed * 1103515245 + 12345;
+  8000cc:	69 05 00 50 80 00 6d 	imul   $0x41c64e6d,0x805000,%eax
+  8000d3:	4e c6 41 
+  8000d6:	05 39 30 00 00       	add    $0x3039,%eax
+  8000db:	a3 00 50 80 00       	mov    %eax,0x805000
+  snprintf(buf, MAXNAMELEN, "/%s%05d", prefix, i);
+  8000e0:	83 ec 0c             	sub    $0xc,%esp
+  return seed >> 8;
+  8000e3:	c1 e8 08             	shr    $0x8,%eax
+    name(path, "dirbench", rand() % n);
+  8000e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000eb:	f7 f6                	div    %esi
+  snprintf(buf, MAXNAMELEN, "/%s%05d", prefix, i);
+  8000ed:	52                   	push   %edx
+  8000ee:	68 c0 30 80 00       	push   $0x8030c0
+  8000f3:	68 c9 30 80 00       	push   $0x8030c9
+  8000f8:	68 80 00 00 00       	push   $0x80
+  8000fd:	53                   	push   %ebx
+  8000fe:	e8 88 08 00 00       	call   80098b <snprintf>
+    if ((fd = open(path, O_RDONLY)) < 0)
+  800103:	83 c4 18             	add    $0x18,%esp
+  800106:	6a 00                	push   $0x0
+  800108:	53                   	push   %ebx
+  800109:	e8 00 1d 00 00       	call   801e0e <open>
+  80010e:	83 c4 10             	add    $0x10,%esp
+  800111:	85 c0                	test   %eax,%eax
+  800113:	79 a6                	jns    8000bb <umain+0x88>
+      panic("open %s: %e", path, fd);
+  800115:	83 ec 0c             	sub    $0xc,%esp
+  800118:	50                   	push   %eax
+  800119:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  80011f:	50                   	push   %eax
+  800120:	68 ef 30 80 00       	push   $0x8030ef
+  800125:	6a 28                	push   $0x28
+  800127:	68 df 30 80 00       	push   $0x8030df
+  80012c:	e8 e6 01 00 00       	call   800317 <_panic>
+  hit = sys_time_msec() - hit;
+  800131:	e8 f3 0f 00 00       	call   801129 <sys_time_msec>
+  800136:	8b 8d dc fe ff ff    	mov    -0x124(%ebp),%ecx
+  80013c:	29 c8                	sub    %ecx,%eax
+  80013e:	89 85 dc fe ff ff    	mov    %eax,-0x124(%ebp)
+  miss = sys_time_msec();
+  800144:	e8 e0 0f 00 00       	call   801129 <sys_time_msec>
+  800149:	89 85 d8 fe ff ff    	mov    %eax,-0x128(%ebp)
+  for (i = 0; i < NOPEN; i++) {
+  80014f:	bf c9 00 00 00       	mov    $0xc9,%edi
+  800154:	83 ef 01             	sub    $0x1,%edi
+  800157:	74 66                	je     8001bf <umain+0x18c>
+  seed = seed * 1103515245 + 12345;
+  800159:	69 05 00 50 80 00 6d 	imul   $0x41c64e6d,0x805000,%eax
+  800160:	4e c6 41 
+  800163:	05 39 30 00 00       	add    $0x3039,%eax
+  800168:	a3 00 50 80 00       	mov    %eax,0x805000
+  snprintf(buf, MAXNAMELEN, "/%s%05d", prefix, i);
+  80016d:	83 ec 0c             	sub    $0xc,%esp
+  return seed >> 8;
+  800170:	c1 e8 08             	shr    $0x8,%eax
+    name(path, "missing", rand() % n);
+  800173:	ba 00 00 00 00       	mov    $0x0,%edx
+  800178:	f7 f6                	div    %esi
+  snprintf(buf, MAXNAMELEN, "/%s%05d", prefix, i);
+  80017a:	52                   	push   %edx
+  80017b:	68 fb 30 80 00       	push   $0x8030fb
+  800180:	68 c9 30 80 00       	push   $0x8030c9
+  800185:	68 80 00 00 00       	push   $0x80
+  80018a:	53                   	push   %ebx
+  80018b:	e8 fb 07 00 00       	call   80098b <snprintf>
+    if ((fd = open(path, O_RDONLY)) != -E_NOT_FOUND)
+  800190:	83 c4 18             	add    $0x18,%esp
+  800193:	6a 00                	push   $0x0
+  800195:	53                   	push   %ebx
+  800196:	e8 73 1c 00 00       	call   801e0e <open>
+  80019b:	83 c4 10             	add    $0x10,%esp
+  80019e:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8001a1:	74 b1                	je     800154 <umain+0x121>
+      panic("open %s: %e", path, fd);
+  8001a3:	83 ec 0c             	sub    $0xc,%esp
+  8001a6:	50                   	push   %eax
+  8001a7:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  8001ad:	50                   	push   %eax
+  8001ae:	68 ef 30 80 00       	push   $0x8030ef
+  8001b3:	6a 31                	push   $0x31
+  8001b5:	68 df 30 80 00       	push   $0x8030df
+  8001ba:	e8 58 01 00 00       	call   800317 <_panic>
+  miss = sys_time_msec() - miss;
+  8001bf:	e8 65 0f 00 00       	call   801129 <sys_time_msec>
+  8001c4:	8b 8d d8 fe ff ff    	mov    -0x128(%ebp),%ecx
+  8001ca:	29 c8                	sub    %ecx,%eax
+          hit * 1000 / NOPEN, miss * 1000 / NOPEN);
+  8001cc:	69 d0 e8 03 00 00    	imul   $0x3e8,%eax,%edx
+  cprintf("dirbench: %5d entries  open %5d us  miss %5d us\n", n,
+  8001d2:	b9 1f 85 eb 51       	mov    $0x51eb851f,%ecx
+  8001d7:	89 d0                	mov    %edx,%eax
+  8001d9:	f7 e1                	mul    %ecx
+  8001db:	c1 ea 06             	shr    $0x6,%edx
+  8001de:	52                   	push   %edx
+          hit * 1000 / NOPEN, miss * 1000 / NOPEN);
+  8001df:	69 95 dc fe ff ff e8 	imul   $0x3e8,-0x124(%ebp),%edx
+  8001e6:	03 00 00 
+  cprintf("dirbench: %5d entries  open %5d us  miss %5d us\n", n,
+  8001e9:	89 d0                	mov    %edx,%eax
+  8001eb:	f7 e1                	mul    %ecx
+  8001ed:	c1 ea 06             	shr    $0x6,%edx
+  8001f0:	52                   	push   %edx
+  8001f1:	56                   	push   %esi
+  8001f2:	68 04 31 80 00       	push   $0x803104
+  8001f7:	e8 f6 01 00 00       	call   8003f2 <cprintf>
+    close(fd);
+    if (i + 1 == next || i + 1 == n) {
+      measure(i + 1);
+      next *= 4;
+  8001fc:	c1 a5 e0 fe ff ff 02 	shll   $0x2,-0x120(%ebp)
+  800203:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; i++) {
+  800206:	39 b5 e4 fe ff ff    	cmp    %esi,-0x11c(%ebp)
+  80020c:	7e 70                	jle    80027e <umain+0x24b>
+  snprintf(buf, MAXNAMELEN, "/%s%05d", prefix, i);
+  80020e:	83 ec 0c             	sub    $0xc,%esp
+  800211:	56                   	push   %esi
+  800212:	68 c0 30 80 00       	push   $0x8030c0
+  800217:	68 c9 30 80 00       	push   $0x8030c9
+  80021c:	68 80 00 00 00       	push   $0x80
+  800221:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  800227:	57                   	push   %edi
+  800228:	e8 5e 07 00 00       	call   80098b <snprintf>
+    if ((fd = open(path, O_RDWR | O_CREAT)) < 0)
+  80022d:	83 c4 18             	add    $0x18,%esp
+  800230:	68 02 01 00 00       	push   $0x102
+  800235:	57                   	push   %edi
+  800236:	e8 d3 1b 00 00       	call   801e0e <open>
+  80023b:	83 c4 10             	add    $0x10,%esp
+  80023e:	85 c0                	test   %eax,%eax
+  800240:	0f 88 5f fe ff ff    	js     8000a5 <umain+0x72>
+    close(fd);
+  800246:	83 ec 0c             	sub    $0xc,%esp
+  800249:	50                   	push   %eax
+  80024a:	e8 0c 12 00 00       	call   80145b <close>
+    if (i + 1 == next || i + 1 == n) {
+  80024f:	83 c6 01             	add    $0x1,%esi
+  800252:	83 c4 10             	add    $0x10,%esp
+  800255:	8b 85 e4 fe ff ff    	mov    -0x11c(%ebp),%eax
+  80025b:	39 c6                	cmp    %eax,%esi
+  80025d:	74 0a                	je     800269 <umain+0x236>
+  80025f:	8b 85 e0 fe ff ff    	mov    -0x120(%ebp),%eax
+  800265:	39 c6                	cmp    %eax,%esi
+  800267:	75 9d                	jne    800206 <umain+0x1d3>
+  hit = sys_time_msec();
+  800269:	e8 bb 0e 00 00       	call   801129 <sys_time_msec>
+  80026e:	89 85 dc fe ff ff    	mov    %eax,-0x124(%ebp)
+  for (i = 0; i < NOPEN; i++) {
+  800274:	bf c9 00 00 00       	mov    $0xc9,%edi
+  800279:	e9 49 fe ff ff       	jmp    8000c7 <umain+0x94>
+    }
+  }
+  cprintf("dirbench: %d files, %d ms in all\n", n, sys_time_msec() - ms);
+  80027e:	e8 a6 0e 00 00       	call   801129 <sys_time_msec>
+  800283:	83 ec 04             	sub    $0x4,%esp
+  800286:	8b 8d d4 fe ff ff    	mov    -0x12c(%ebp),%ecx
+  80028c:	29 c8                	sub    %ecx,%eax
+  80028e:	50                   	push   %eax
+  80028f:	ff b5 e4 fe ff ff    	push   -0x11c(%ebp)
+  800295:	68 38 31 80 00       	push   $0x803138
+  80029a:	e8 53 01 00 00       	call   8003f2 <cprintf>
+}
+  80029f:	83 c4 10             	add    $0x10,%esp
+  8002a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002a5:	5b                   	pop    %ebx
+  8002a6:	5e                   	pop    %esi
+  8002a7:	5f                   	pop    %edi
+  8002a8:	5d                   	pop    %ebp
+  8002a9:	c3                   	ret
+
+008002aa <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8002aa:	55                   	push   %ebp
+  8002ab:	89 e5                	mov    %esp,%ebp
+  8002ad:	56                   	push   %esi
+  8002ae:	53                   	push   %ebx
+  8002af:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8002b2:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  8002b5:	c7 05 64 57 80 00 00 	movl   $0x0,0x805764
+  8002bc:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  8002bf:	e8 ca 0a 00 00       	call   800d8e <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  8002c4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8002c9:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8002cc:	c1 e0 04             	shl    $0x4,%eax
+  8002cf:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8002d4:	a3 64 57 80 00       	mov    %eax,0x805764
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8002d9:	85 db                	test   %ebx,%ebx
+  8002db:	7e 07                	jle    8002e4 <libmain+0x3a>
+    binaryname = argv[0];
+  8002dd:	8b 06                	mov    (%esi),%eax
+  8002df:	a3 00 40 80 00       	mov    %eax,0x804000
+
+  // call user main routine
+  umain(argc, argv);
+  8002e4:	83 ec 08             	sub    $0x8,%esp
+  8002e7:	56                   	push   %esi
+  8002e8:	53                   	push   %ebx
+  8002e9:	e8 45 fd ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  8002ee:	e8 0a 00 00 00       	call   8002fd <exit>
+}
+  8002f3:	83 c4 10             	add    $0x10,%esp
+  8002f6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8002f9:	5b                   	pop    %ebx
+  8002fa:	5e                   	pop    %esi
+  8002fb:	5d                   	pop    %ebp
+  8002fc:	c3                   	ret
+
+008002fd <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8002fd:	55                   	push   %ebp
+  8002fe:	89 e5                	mov    %esp,%ebp
+  800300:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  800303:	e8 80 11 00 00       	call   801488 <close_all>
+  sys_env_destroy(0);
+  800308:	83 ec 0c             	sub    $0xc,%esp
+  80030b:	6a 00                	push   $0x0
+  80030d:	e8 3b 0a 00 00       	call   800d4d <sys_env_destroy>
+}
+  800312:	83 c4 10             	add    $0x10,%esp
+  800315:	c9                   	leave
+  800316:	c3                   	ret
+
+00800317 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800317:	55                   	push   %ebp
+  800318:	89 e5                	mov    %esp,%ebp
+  80031a:	56                   	push   %esi
+  80031b:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  80031c:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  80031f:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  800325:	e8 64 0a 00 00       	call   800d8e <sys_getenvid>
+  80032a:	83 ec 0c             	sub    $0xc,%esp
+  80032d:	ff 75 0c             	push   0xc(%ebp)
+  800330:	ff 75 08             	push   0x8(%ebp)
+  800333:	56                   	push   %esi
+  800334:	50                   	push   %eax
+  800335:	68 64 31 80 00       	push   $0x803164
+  80033a:	e8 b3 00 00 00       	call   8003f2 <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  80033f:	83 c4 18             	add    $0x18,%esp
+  800342:	53                   	push   %ebx
+  800343:	ff 75 10             	push   0x10(%ebp)
+  800346:	e8 56 00 00 00       	call   8003a1 <vcprintf>
+  cprintf("\n");
+  80034b:	c7 04 24 e0 35 80 00 	movl   $0x8035e0,(%esp)
+  800352:	e8 9b 00 00 00       	call   8003f2 <cprintf>
+  800357:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  80035a:	cc                   	int3
+  while (1)
+  80035b:	eb fd                	jmp    80035a <_panic+0x43>
+
+0080035d <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80035d:	55                   	push   %ebp
+  80035e:	89 e5                	mov    %esp,%ebp
+  800360:	53                   	push   %ebx
+  800361:	83 ec 04             	sub    $0x4,%esp
+  800364:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  800367:	8b 13                	mov    (%ebx),%edx
+  800369:	8d 42 01             	lea    0x1(%edx),%eax
+  80036c:	89 03                	mov    %eax,(%ebx)
+  80036e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800371:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  800375:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80037a:	74 09                	je     800385 <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  80037c:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800380:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800383:	c9                   	leave
+  800384:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  800385:	83 ec 08             	sub    $0x8,%esp
+  800388:	68 ff 00 00 00       	push   $0xff
+  80038d:	8d 43 08             	lea    0x8(%ebx),%eax
+  800390:	50                   	push   %eax
+  800391:	e8 7a 09 00 00       	call   800d10 <sys_cputs>
+    b->idx = 0;
+  800396:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80039c:	83 c4 10             	add    $0x10,%esp
+  80039f:	eb db                	jmp    80037c <putch+0x1f>
+
+008003a1 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8003a1:	55                   	push   %ebp
+  8003a2:	89 e5                	mov    %esp,%ebp
+  8003a4:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  8003aa:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8003b1:	00 00 00 
+  b.cnt = 0;
+  8003b4:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8003bb:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  8003be:	ff 75 0c             	push   0xc(%ebp)
+  8003c1:	ff 75 08             	push   0x8(%ebp)
+  8003c4:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8003ca:	50                   	push   %eax
+  8003cb:	68 5d 03 80 00       	push   $0x80035d
+  8003d0:	e8 14 01 00 00       	call   8004e9 <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  8003d5:	83 c4 08             	add    $0x8,%esp
+  8003d8:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8003de:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8003e4:	50                   	push   %eax
+  8003e5:	e8 26 09 00 00       	call   800d10 <sys_cputs>
+
+  return b.cnt;
+}
+  8003ea:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8003f0:	c9                   	leave
+  8003f1:	c3                   	ret
+
+008003f2 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8003f2:	55                   	push   %ebp
+  8003f3:	89 e5                	mov    %esp,%ebp
+  8003f5:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  8003f8:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  8003fb:	50                   	push   %eax
+  8003fc:	ff 75 08             	push   0x8(%ebp)
+  8003ff:	e8 9d ff ff ff       	call   8003a1 <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  800404:	c9                   	leave
+  800405:	c3                   	ret
+
+00800406 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  800406:	55                   	push   %ebp
+  800407:	89 e5                	mov    %esp,%ebp
+  800409:	57                   	push   %edi
+  80040a:	56                   	push   %esi
+  80040b:	53                   	push   %ebx
+  80040c:	83 ec 1c             	sub    $0x1c,%esp
+  80040f:	89 c7                	mov    %eax,%edi
+  800411:	89 d6                	mov    %edx,%esi
+  800413:	8b 45 08             	mov    0x8(%ebp),%eax
+  800416:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800419:	89 d1                	mov    %edx,%ecx
+  80041b:	89 c2                	mov    %eax,%edx
+  80041d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800420:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800423:	8b 45 10             	mov    0x10(%ebp),%eax
+  800426:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  800429:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80042c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800433:	39 c2                	cmp    %eax,%edx
+  800435:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800438:	72 3e                	jb     800478 <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  80043a:	83 ec 0c             	sub    $0xc,%esp
+  80043d:	ff 75 18             	push   0x18(%ebp)
+  800440:	83 eb 01             	sub    $0x1,%ebx
+  800443:	53                   	push   %ebx
+  800444:	50                   	push   %eax
+  800445:	83 ec 08             	sub    $0x8,%esp
+  800448:	ff 75 e4             	push   -0x1c(%ebp)
+  80044b:	ff 75 e0             	push   -0x20(%ebp)
+  80044e:	ff 75 dc             	push   -0x24(%ebp)
+  800451:	ff 75 d8             	push   -0x28(%ebp)
+  800454:	e8 db 2a 00 00       	call   802f34 <__udivdi3>
+  800459:	83 c4 18             	add    $0x18,%esp
+  80045c:	52                   	push   %edx
+  80045d:	50                   	push   %eax
+  80045e:	89 f2                	mov    %esi,%edx
+  800460:	89 f8                	mov    %edi,%eax
+  800462:	e8 9f ff ff ff       	call   800406 <printnum>
+  800467:	83 c4 20             	add    $0x20,%esp
+  80046a:	eb 13                	jmp    80047f <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  80046c:	83 ec 08             	sub    $0x8,%esp
+  80046f:	56                   	push   %esi
+  800470:	ff 75 18             	push   0x18(%ebp)
+  800473:	ff d7                	call   *%edi
+  800475:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  800478:	83 eb 01             	sub    $0x1,%ebx
+  80047b:	85 db                	test   %ebx,%ebx
+  80047d:	7f ed                	jg     80046c <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  80047f:	83 ec 08             	sub    $0x8,%esp
+  800482:	56                   	push   %esi
+  800483:	83 ec 04             	sub    $0x4,%esp
+  800486:	ff 75 e4             	push   -0x1c(%ebp)
+  800489:	ff 75 e0             	push   -0x20(%ebp)
+  80048c:	ff 75 dc             	push   -0x24(%ebp)
+  80048f:	ff 75 d8             	push   -0x28(%ebp)
+  800492:	e8 be 2a 00 00       	call   802f55 <__umoddi3>
+  800497:	83 c4 14             	add    $0x14,%esp
+  80049a:	0f be 80 87 31 80 00 	movsbl 0x803187(%eax),%eax
+  8004a1:	50                   	push   %eax
+  8004a2:	ff d7                	call   *%edi
+}
+  8004a4:	83 c4 10             	add    $0x10,%esp
+  8004a7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004aa:	5b                   	pop    %ebx
+  8004ab:	5e                   	pop    %esi
+  8004ac:	5f                   	pop    %edi
+  8004ad:	5d                   	pop    %ebp
+  8004ae:	c3                   	ret
+
+008004af <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8004af:	55                   	push   %ebp
+  8004b0:	89 e5                	mov    %esp,%ebp
+  8004b2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  8004b5:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  8004b9:	8b 10                	mov    (%eax),%edx
+  8004bb:	3b 50 04             	cmp    0x4(%eax),%edx
+  8004be:	73 0a                	jae    8004ca <sprintputch+0x1b>
+    *b->buf++ = ch;
+  8004c0:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8004c3:	89 08                	mov    %ecx,(%eax)
+  8004c5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8004c8:	88 02                	mov    %al,(%edx)
+}
+  8004ca:	5d                   	pop    %ebp
+  8004cb:	c3                   	ret
+
+008004cc <printfmt>:
+{
+  8004cc:	55                   	push   %ebp
+  8004cd:	89 e5                	mov    %esp,%ebp
+  8004cf:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  8004d2:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  8004d5:	50                   	push   %eax
+  8004d6:	ff 75 10             	push   0x10(%ebp)
+  8004d9:	ff 75 0c             	push   0xc(%ebp)
+  8004dc:	ff 75 08             	push   0x8(%ebp)
+  8004df:	e8 05 00 00 00       	call   8004e9 <vprintfmt>
+}
+  8004e4:	83 c4 10             	add    $0x10,%esp
+  8004e7:	c9                   	leave
+  8004e8:	c3                   	ret
+
+008004e9 <vprintfmt>:
+{
+  8004e9:	55                   	push   %ebp
+  8004ea:	89 e5                	mov    %esp,%ebp
+  8004ec:	57                   	push   %edi
+  8004ed:	56                   	push   %esi
+  8004ee:	53                   	push   %ebx
+  8004ef:	83 ec 2c             	sub    $0x2c,%esp
+  8004f2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004f5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8004f8:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8004fb:	eb 0a                	jmp    800507 <vprintfmt+0x1e>
+      putch(ch, putdat);
+  8004fd:	83 ec 08             	sub    $0x8,%esp
+  800500:	53                   	push   %ebx
+  800501:	50                   	push   %eax
+  800502:	ff d6                	call   *%esi
+  800504:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  800507:	83 c7 01             	add    $0x1,%edi
+  80050a:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80050e:	83 f8 25             	cmp    $0x25,%eax
+  800511:	74 0c                	je     80051f <vprintfmt+0x36>
+      if (ch == '\0')
+  800513:	85 c0                	test   %eax,%eax
+  800515:	75 e6                	jne    8004fd <vprintfmt+0x14>
+}
+  800517:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80051a:	5b                   	pop    %ebx
+  80051b:	5e                   	pop    %esi
+  80051c:	5f                   	pop    %edi
+  80051d:	5d                   	pop    %ebp
+  80051e:	c3                   	ret
+    padc = ' ';
+  80051f:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  800523:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  80052a:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  800531:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  800538:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  80053d:	8d 47 01             	lea    0x1(%edi),%eax
+  800540:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800543:	0f b6 17             	movzbl (%edi),%edx
+  800546:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800549:	3c 55                	cmp    $0x55,%al
+  80054b:	0f 87 cf 03 00 00    	ja     800920 <vprintfmt+0x437>
+  800551:	0f b6 c0             	movzbl %al,%eax
+  800554:	ff 24 85 e0 32 80 00 	jmp    *0x8032e0(,%eax,4)
+  80055b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  80055e:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800562:	eb d9                	jmp    80053d <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  800564:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800567:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80056b:	eb d0                	jmp    80053d <vprintfmt+0x54>
+  80056d:	0f b6 d2             	movzbl %dl,%edx
+  800570:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  800573:	b8 00 00 00 00       	mov    $0x0,%eax
+  800578:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  80057b:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80057e:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  800582:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  800585:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800588:	83 f9 09             	cmp    $0x9,%ecx
+  80058b:	77 55                	ja     8005e2 <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  80058d:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  800590:	eb e9                	jmp    80057b <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  800592:	8b 45 14             	mov    0x14(%ebp),%eax
+  800595:	8b 00                	mov    (%eax),%eax
+  800597:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80059a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80059d:	8d 40 04             	lea    0x4(%eax),%eax
+  8005a0:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  8005a3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  8005a6:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8005aa:	79 91                	jns    80053d <vprintfmt+0x54>
+        width = precision, precision = -1;
+  8005ac:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8005af:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005b2:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8005b9:	eb 82                	jmp    80053d <vprintfmt+0x54>
+      if (width < 0)
+  8005bb:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8005be:	85 d2                	test   %edx,%edx
+  8005c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005c5:	0f 49 c2             	cmovns %edx,%eax
+  8005c8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  8005cb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  8005ce:	e9 6a ff ff ff       	jmp    80053d <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  8005d3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  8005d6:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  8005dd:	e9 5b ff ff ff       	jmp    80053d <vprintfmt+0x54>
+  8005e2:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8005e5:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8005e8:	eb bc                	jmp    8005a6 <vprintfmt+0xbd>
+      lflag++;
+  8005ea:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  8005ed:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  8005f0:	e9 48 ff ff ff       	jmp    80053d <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  8005f5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f8:	8d 78 04             	lea    0x4(%eax),%edi
+  8005fb:	83 ec 08             	sub    $0x8,%esp
+  8005fe:	53                   	push   %ebx
+  8005ff:	ff 30                	push   (%eax)
+  800601:	ff d6                	call   *%esi
+      break;
+  800603:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  800606:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  800609:	e9 b1 02 00 00       	jmp    8008bf <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  80060e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800611:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  800614:	8b 10                	mov    (%eax),%edx
+  800616:	89 d0                	mov    %edx,%eax
+  800618:	f7 d8                	neg    %eax
+  80061a:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80061d:	83 f8 10             	cmp    $0x10,%eax
+  800620:	7f 23                	jg     800645 <vprintfmt+0x15c>
+  800622:	8b 14 85 40 34 80 00 	mov    0x803440(,%eax,4),%edx
+  800629:	85 d2                	test   %edx,%edx
+  80062b:	74 18                	je     800645 <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  80062d:	52                   	push   %edx
+  80062e:	68 8a 35 80 00       	push   $0x80358a
+  800633:	53                   	push   %ebx
+  800634:	56                   	push   %esi
+  800635:	e8 92 fe ff ff       	call   8004cc <printfmt>
+  80063a:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  80063d:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800640:	e9 7a 02 00 00       	jmp    8008bf <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  800645:	50                   	push   %eax
+  800646:	68 9f 31 80 00       	push   $0x80319f
+  80064b:	53                   	push   %ebx
+  80064c:	56                   	push   %esi
+  80064d:	e8 7a fe ff ff       	call   8004cc <printfmt>
+  800652:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  800655:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  800658:	e9 62 02 00 00       	jmp    8008bf <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  80065d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800660:	83 c0 04             	add    $0x4,%eax
+  800663:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800666:	8b 45 14             	mov    0x14(%ebp),%eax
+  800669:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  80066b:	85 c9                	test   %ecx,%ecx
+  80066d:	b8 98 31 80 00       	mov    $0x803198,%eax
+  800672:	0f 45 c1             	cmovne %ecx,%eax
+  800675:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  800678:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80067c:	7e 06                	jle    800684 <vprintfmt+0x19b>
+  80067e:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800682:	75 0b                	jne    80068f <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800684:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800687:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80068a:	89 75 08             	mov    %esi,0x8(%ebp)
+  80068d:	eb 5c                	jmp    8006eb <vprintfmt+0x202>
+  80068f:	83 ec 08             	sub    $0x8,%esp
+  800692:	ff 75 d0             	push   -0x30(%ebp)
+  800695:	ff 75 cc             	push   -0x34(%ebp)
+  800698:	e8 20 03 00 00       	call   8009bd <strnlen>
+  80069d:	89 c2                	mov    %eax,%edx
+  80069f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006a2:	29 d0                	sub    %edx,%eax
+  8006a4:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  8006a7:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8006ab:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006ae:	89 75 08             	mov    %esi,0x8(%ebp)
+  8006b1:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8006b3:	eb 0e                	jmp    8006c3 <vprintfmt+0x1da>
+          putch(padc, putdat);
+  8006b5:	83 ec 08             	sub    $0x8,%esp
+  8006b8:	53                   	push   %ebx
+  8006b9:	57                   	push   %edi
+  8006ba:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8006bd:	83 ee 01             	sub    $0x1,%esi
+  8006c0:	83 c4 10             	add    $0x10,%esp
+  8006c3:	85 f6                	test   %esi,%esi
+  8006c5:	7f ee                	jg     8006b5 <vprintfmt+0x1cc>
+  8006c7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006ca:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006cd:	85 c0                	test   %eax,%eax
+  8006cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006d4:	0f 49 d0             	cmovns %eax,%edx
+  8006d7:	29 d0                	sub    %edx,%eax
+  8006d9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006dc:	eb a6                	jmp    800684 <vprintfmt+0x19b>
+          putch(ch, putdat);
+  8006de:	83 ec 08             	sub    $0x8,%esp
+  8006e1:	53                   	push   %ebx
+  8006e2:	52                   	push   %edx
+  8006e3:	ff 55 08             	call   *0x8(%ebp)
+  8006e6:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8006e9:	89 f1                	mov    %esi,%ecx
+  8006eb:	8d 71 01             	lea    0x1(%ecx),%esi
+  8006ee:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8006f2:	0f be d0             	movsbl %al,%edx
+  8006f5:	85 d2                	test   %edx,%edx
+  8006f7:	74 28                	je     800721 <vprintfmt+0x238>
+  8006f9:	85 ff                	test   %edi,%edi
+  8006fb:	78 05                	js     800702 <vprintfmt+0x219>
+  8006fd:	83 ef 01             	sub    $0x1,%edi
+  800700:	78 30                	js     800732 <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  800702:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800706:	74 d6                	je     8006de <vprintfmt+0x1f5>
+  800708:	0f be c0             	movsbl %al,%eax
+  80070b:	83 e8 20             	sub    $0x20,%eax
+  80070e:	83 f8 5e             	cmp    $0x5e,%eax
+  800711:	76 cb                	jbe    8006de <vprintfmt+0x1f5>
+          putch('?', putdat);
+  800713:	83 ec 08             	sub    $0x8,%esp
+  800716:	53                   	push   %ebx
+  800717:	6a 3f                	push   $0x3f
+  800719:	ff 55 08             	call   *0x8(%ebp)
+  80071c:	83 c4 10             	add    $0x10,%esp
+  80071f:	eb c8                	jmp    8006e9 <vprintfmt+0x200>
+  800721:	8b 75 08             	mov    0x8(%ebp),%esi
+  800724:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800727:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80072a:	01 d0                	add    %edx,%eax
+  80072c:	29 c8                	sub    %ecx,%eax
+  80072e:	89 c7                	mov    %eax,%edi
+  800730:	eb 13                	jmp    800745 <vprintfmt+0x25c>
+  800732:	8b 75 08             	mov    0x8(%ebp),%esi
+  800735:	eb ed                	jmp    800724 <vprintfmt+0x23b>
+        putch(' ', putdat);
+  800737:	83 ec 08             	sub    $0x8,%esp
+  80073a:	53                   	push   %ebx
+  80073b:	6a 20                	push   $0x20
+  80073d:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  80073f:	83 ef 01             	sub    $0x1,%edi
+  800742:	83 c4 10             	add    $0x10,%esp
+  800745:	85 ff                	test   %edi,%edi
+  800747:	7f ee                	jg     800737 <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  800749:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80074c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80074f:	e9 6b 01 00 00       	jmp    8008bf <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  800754:	83 f9 01             	cmp    $0x1,%ecx
+  800757:	7f 1f                	jg     800778 <vprintfmt+0x28f>
+  else if (lflag)
+  800759:	85 c9                	test   %ecx,%ecx
+  80075b:	74 67                	je     8007c4 <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  80075d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800760:	8b 00                	mov    (%eax),%eax
+  800762:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800765:	89 c1                	mov    %eax,%ecx
+  800767:	c1 f9 1f             	sar    $0x1f,%ecx
+  80076a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80076d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800770:	8d 40 04             	lea    0x4(%eax),%eax
+  800773:	89 45 14             	mov    %eax,0x14(%ebp)
+  800776:	eb 17                	jmp    80078f <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  800778:	8b 45 14             	mov    0x14(%ebp),%eax
+  80077b:	8b 50 04             	mov    0x4(%eax),%edx
+  80077e:	8b 00                	mov    (%eax),%eax
+  800780:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800783:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800786:	8b 45 14             	mov    0x14(%ebp),%eax
+  800789:	8d 40 08             	lea    0x8(%eax),%eax
+  80078c:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  80078f:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800792:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  800795:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  80079a:	85 c9                	test   %ecx,%ecx
+  80079c:	0f 89 03 01 00 00    	jns    8008a5 <vprintfmt+0x3bc>
+        putch('-', putdat);
+  8007a2:	83 ec 08             	sub    $0x8,%esp
+  8007a5:	53                   	push   %ebx
+  8007a6:	6a 2d                	push   $0x2d
+  8007a8:	ff d6                	call   *%esi
+        num = -(long long)num;
+  8007aa:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8007ad:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8007b0:	f7 da                	neg    %edx
+  8007b2:	83 d1 00             	adc    $0x0,%ecx
+  8007b5:	f7 d9                	neg    %ecx
+  8007b7:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  8007ba:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8007bf:	e9 e1 00 00 00       	jmp    8008a5 <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  8007c4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007c7:	8b 00                	mov    (%eax),%eax
+  8007c9:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007cc:	89 c1                	mov    %eax,%ecx
+  8007ce:	c1 f9 1f             	sar    $0x1f,%ecx
+  8007d1:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8007d4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d7:	8d 40 04             	lea    0x4(%eax),%eax
+  8007da:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007dd:	eb b0                	jmp    80078f <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  8007df:	83 f9 01             	cmp    $0x1,%ecx
+  8007e2:	7f 1e                	jg     800802 <vprintfmt+0x319>
+  else if (lflag)
+  8007e4:	85 c9                	test   %ecx,%ecx
+  8007e6:	74 32                	je     80081a <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  8007e8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007eb:	8b 10                	mov    (%eax),%edx
+  8007ed:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007f2:	8d 40 04             	lea    0x4(%eax),%eax
+  8007f5:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  8007f8:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  8007fd:	e9 a3 00 00 00       	jmp    8008a5 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800802:	8b 45 14             	mov    0x14(%ebp),%eax
+  800805:	8b 10                	mov    (%eax),%edx
+  800807:	8b 48 04             	mov    0x4(%eax),%ecx
+  80080a:	8d 40 08             	lea    0x8(%eax),%eax
+  80080d:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800810:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  800815:	e9 8b 00 00 00       	jmp    8008a5 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  80081a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80081d:	8b 10                	mov    (%eax),%edx
+  80081f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800824:	8d 40 04             	lea    0x4(%eax),%eax
+  800827:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  80082a:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  80082f:	eb 74                	jmp    8008a5 <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  800831:	83 f9 01             	cmp    $0x1,%ecx
+  800834:	7f 1b                	jg     800851 <vprintfmt+0x368>
+  else if (lflag)
+  800836:	85 c9                	test   %ecx,%ecx
+  800838:	74 2c                	je     800866 <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  80083a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80083d:	8b 10                	mov    (%eax),%edx
+  80083f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800844:	8d 40 04             	lea    0x4(%eax),%eax
+  800847:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  80084a:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  80084f:	eb 54                	jmp    8008a5 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800851:	8b 45 14             	mov    0x14(%ebp),%eax
+  800854:	8b 10                	mov    (%eax),%edx
+  800856:	8b 48 04             	mov    0x4(%eax),%ecx
+  800859:	8d 40 08             	lea    0x8(%eax),%eax
+  80085c:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  80085f:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  800864:	eb 3f                	jmp    8008a5 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800866:	8b 45 14             	mov    0x14(%ebp),%eax
+  800869:	8b 10                	mov    (%eax),%edx
+  80086b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800870:	8d 40 04             	lea    0x4(%eax),%eax
+  800873:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800876:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  80087b:	eb 28                	jmp    8008a5 <vprintfmt+0x3bc>
+      putch('0', putdat);
+  80087d:	83 ec 08             	sub    $0x8,%esp
+  800880:	53                   	push   %ebx
+  800881:	6a 30                	push   $0x30
+  800883:	ff d6                	call   *%esi
+      putch('x', putdat);
+  800885:	83 c4 08             	add    $0x8,%esp
+  800888:	53                   	push   %ebx
+  800889:	6a 78                	push   $0x78
+  80088b:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  80088d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800890:	8b 10                	mov    (%eax),%edx
+  800892:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  800897:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  80089a:	8d 40 04             	lea    0x4(%eax),%eax
+  80089d:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8008a0:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  8008a5:	83 ec 0c             	sub    $0xc,%esp
+  8008a8:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8008ac:	50                   	push   %eax
+  8008ad:	ff 75 e0             	push   -0x20(%ebp)
+  8008b0:	57                   	push   %edi
+  8008b1:	51                   	push   %ecx
+  8008b2:	52                   	push   %edx
+  8008b3:	89 da                	mov    %ebx,%edx
+  8008b5:	89 f0                	mov    %esi,%eax
+  8008b7:	e8 4a fb ff ff       	call   800406 <printnum>
+      break;
+  8008bc:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  8008bf:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  8008c2:	e9 40 fc ff ff       	jmp    800507 <vprintfmt+0x1e>
+  if (lflag >= 2)
+  8008c7:	83 f9 01             	cmp    $0x1,%ecx
+  8008ca:	7f 1b                	jg     8008e7 <vprintfmt+0x3fe>
+  else if (lflag)
+  8008cc:	85 c9                	test   %ecx,%ecx
+  8008ce:	74 2c                	je     8008fc <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  8008d0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008d3:	8b 10                	mov    (%eax),%edx
+  8008d5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008da:	8d 40 04             	lea    0x4(%eax),%eax
+  8008dd:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8008e0:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  8008e5:	eb be                	jmp    8008a5 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  8008e7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008ea:	8b 10                	mov    (%eax),%edx
+  8008ec:	8b 48 04             	mov    0x4(%eax),%ecx
+  8008ef:	8d 40 08             	lea    0x8(%eax),%eax
+  8008f2:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8008f5:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  8008fa:	eb a9                	jmp    8008a5 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8008fc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008ff:	8b 10                	mov    (%eax),%edx
+  800901:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800906:	8d 40 04             	lea    0x4(%eax),%eax
+  800909:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  80090c:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  800911:	eb 92                	jmp    8008a5 <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  800913:	83 ec 08             	sub    $0x8,%esp
+  800916:	53                   	push   %ebx
+  800917:	6a 25                	push   $0x25
+  800919:	ff d6                	call   *%esi
+      break;
+  80091b:	83 c4 10             	add    $0x10,%esp
+  80091e:	eb 9f                	jmp    8008bf <vprintfmt+0x3d6>
+      putch('%', putdat);
+  800920:	83 ec 08             	sub    $0x8,%esp
+  800923:	53                   	push   %ebx
+  800924:	6a 25                	push   $0x25
+  800926:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  800928:	83 c4 10             	add    $0x10,%esp
+  80092b:	89 f8                	mov    %edi,%eax
+  80092d:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800931:	74 05                	je     800938 <vprintfmt+0x44f>
+  800933:	83 e8 01             	sub    $0x1,%eax
+  800936:	eb f5                	jmp    80092d <vprintfmt+0x444>
+  800938:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80093b:	eb 82                	jmp    8008bf <vprintfmt+0x3d6>
+
+0080093d <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80093d:	55                   	push   %ebp
+  80093e:	89 e5                	mov    %esp,%ebp
+  800940:	83 ec 18             	sub    $0x18,%esp
+  800943:	8b 45 08             	mov    0x8(%ebp),%eax
+  800946:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  800949:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80094c:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800950:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800953:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  80095a:	85 c0                	test   %eax,%eax
+  80095c:	74 26                	je     800984 <vsnprintf+0x47>
+  80095e:	85 d2                	test   %edx,%edx
+  800960:	7e 22                	jle    800984 <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800962:	ff 75 14             	push   0x14(%ebp)
+  800965:	ff 75 10             	push   0x10(%ebp)
+  800968:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80096b:	50                   	push   %eax
+  80096c:	68 af 04 80 00       	push   $0x8004af
+  800971:	e8 73 fb ff ff       	call   8004e9 <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800976:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800979:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  80097c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80097f:	83 c4 10             	add    $0x10,%esp
+}
+  800982:	c9                   	leave
+  800983:	c3                   	ret
+    return -E_INVAL;
+  800984:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800989:	eb f7                	jmp    800982 <vsnprintf+0x45>
+
+0080098b <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80098b:	55                   	push   %ebp
+  80098c:	89 e5                	mov    %esp,%ebp
+  80098e:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  800991:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  800994:	50                   	push   %eax
+  800995:	ff 75 10             	push   0x10(%ebp)
+  800998:	ff 75 0c             	push   0xc(%ebp)
+  80099b:	ff 75 08             	push   0x8(%ebp)
+  80099e:	e8 9a ff ff ff       	call   80093d <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  8009a3:	c9                   	leave
+  8009a4:	c3                   	ret
+
+008009a5 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8009a5:	55                   	push   %ebp
+  8009a6:	89 e5                	mov    %esp,%ebp
+  8009a8:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  8009ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009b0:	eb 03                	jmp    8009b5 <strlen+0x10>
+    n++;
+  8009b2:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  8009b5:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8009b9:	75 f7                	jne    8009b2 <strlen+0xd>
+  return n;
+}
+  8009bb:	5d                   	pop    %ebp
+  8009bc:	c3                   	ret
+
+008009bd <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8009bd:	55                   	push   %ebp
+  8009be:	89 e5                	mov    %esp,%ebp
+  8009c0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8009c3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009cb:	eb 03                	jmp    8009d0 <strnlen+0x13>
+    n++;
+  8009cd:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8009d0:	39 d0                	cmp    %edx,%eax
+  8009d2:	74 08                	je     8009dc <strnlen+0x1f>
+  8009d4:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8009d8:	75 f3                	jne    8009cd <strnlen+0x10>
+  8009da:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  8009dc:	89 d0                	mov    %edx,%eax
+  8009de:	5d                   	pop    %ebp
+  8009df:	c3                   	ret
+
+008009e0 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8009e0:	55                   	push   %ebp
+  8009e1:	89 e5                	mov    %esp,%ebp
+  8009e3:	53                   	push   %ebx
+  8009e4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009e7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  8009ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009ef:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8009f3:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8009f6:	83 c0 01             	add    $0x1,%eax
+  8009f9:	84 d2                	test   %dl,%dl
+  8009fb:	75 f2                	jne    8009ef <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  8009fd:	89 c8                	mov    %ecx,%eax
+  8009ff:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a02:	c9                   	leave
+  800a03:	c3                   	ret
+
+00800a04 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800a04:	55                   	push   %ebp
+  800a05:	89 e5                	mov    %esp,%ebp
+  800a07:	53                   	push   %ebx
+  800a08:	83 ec 10             	sub    $0x10,%esp
+  800a0b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  800a0e:	53                   	push   %ebx
+  800a0f:	e8 91 ff ff ff       	call   8009a5 <strlen>
+  800a14:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  800a17:	ff 75 0c             	push   0xc(%ebp)
+  800a1a:	01 d8                	add    %ebx,%eax
+  800a1c:	50                   	push   %eax
+  800a1d:	e8 be ff ff ff       	call   8009e0 <strcpy>
+  return dst;
+}
+  800a22:	89 d8                	mov    %ebx,%eax
+  800a24:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a27:	c9                   	leave
+  800a28:	c3                   	ret
+
+00800a29 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  800a29:	55                   	push   %ebp
+  800a2a:	89 e5                	mov    %esp,%ebp
+  800a2c:	56                   	push   %esi
+  800a2d:	53                   	push   %ebx
+  800a2e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a31:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  800a34:	89 f3                	mov    %esi,%ebx
+  800a36:	03 5d 10             	add    0x10(%ebp),%ebx
+  800a39:	89 f0                	mov    %esi,%eax
+  800a3b:	eb 0f                	jmp    800a4c <strncpy+0x23>
+    *dst++ = *src;
+  800a3d:	83 c0 01             	add    $0x1,%eax
+  800a40:	0f b6 0a             	movzbl (%edx),%ecx
+  800a43:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  800a46:	80 f9 01             	cmp    $0x1,%cl
+  800a49:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  800a4c:	39 d8                	cmp    %ebx,%eax
+  800a4e:	75 ed                	jne    800a3d <strncpy+0x14>
+  }
+  return ret;
+}
+  800a50:	89 f0                	mov    %esi,%eax
+  800a52:	5b                   	pop    %ebx
+  800a53:	5e                   	pop    %esi
+  800a54:	5d                   	pop    %ebp
+  800a55:	c3                   	ret
+
+00800a56 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800a56:	55                   	push   %ebp
+  800a57:	89 e5                	mov    %esp,%ebp
+  800a59:	56                   	push   %esi
+  800a5a:	53                   	push   %ebx
+  800a5b:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a5e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a61:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  800a64:	89 f0                	mov    %esi,%eax
+  800a66:	85 d2                	test   %edx,%edx
+  800a68:	74 21                	je     800a8b <strlcpy+0x35>
+  800a6a:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800a6e:	89 f2                	mov    %esi,%edx
+  800a70:	eb 09                	jmp    800a7b <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  800a72:	83 c1 01             	add    $0x1,%ecx
+  800a75:	83 c2 01             	add    $0x1,%edx
+  800a78:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  800a7b:	39 c2                	cmp    %eax,%edx
+  800a7d:	74 09                	je     800a88 <strlcpy+0x32>
+  800a7f:	0f b6 19             	movzbl (%ecx),%ebx
+  800a82:	84 db                	test   %bl,%bl
+  800a84:	75 ec                	jne    800a72 <strlcpy+0x1c>
+  800a86:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  800a88:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  800a8b:	29 f0                	sub    %esi,%eax
+}
+  800a8d:	5b                   	pop    %ebx
+  800a8e:	5e                   	pop    %esi
+  800a8f:	5d                   	pop    %ebp
+  800a90:	c3                   	ret
+
+00800a91 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800a91:	55                   	push   %ebp
+  800a92:	89 e5                	mov    %esp,%ebp
+  800a94:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a97:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  800a9a:	eb 06                	jmp    800aa2 <strcmp+0x11>
+    p++, q++;
+  800a9c:	83 c1 01             	add    $0x1,%ecx
+  800a9f:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  800aa2:	0f b6 01             	movzbl (%ecx),%eax
+  800aa5:	84 c0                	test   %al,%al
+  800aa7:	74 04                	je     800aad <strcmp+0x1c>
+  800aa9:	3a 02                	cmp    (%edx),%al
+  800aab:	74 ef                	je     800a9c <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  800aad:	0f b6 c0             	movzbl %al,%eax
+  800ab0:	0f b6 12             	movzbl (%edx),%edx
+  800ab3:	29 d0                	sub    %edx,%eax
+}
+  800ab5:	5d                   	pop    %ebp
+  800ab6:	c3                   	ret
+
+00800ab7 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800ab7:	55                   	push   %ebp
+  800ab8:	89 e5                	mov    %esp,%ebp
+  800aba:	53                   	push   %ebx
+  800abb:	8b 45 08             	mov    0x8(%ebp),%eax
+  800abe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ac1:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  800ac4:	eb 09                	jmp    800acf <strncmp+0x18>
+    n--, p++, q++;
+  800ac6:	83 ea 01             	sub    $0x1,%edx
+  800ac9:	83 c0 01             	add    $0x1,%eax
+  800acc:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  800acf:	85 d2                	test   %edx,%edx
+  800ad1:	74 18                	je     800aeb <strncmp+0x34>
+  800ad3:	0f b6 18             	movzbl (%eax),%ebx
+  800ad6:	84 db                	test   %bl,%bl
+  800ad8:	74 04                	je     800ade <strncmp+0x27>
+  800ada:	3a 19                	cmp    (%ecx),%bl
+  800adc:	74 e8                	je     800ac6 <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800ade:	0f b6 00             	movzbl (%eax),%eax
+  800ae1:	0f b6 11             	movzbl (%ecx),%edx
+  800ae4:	29 d0                	sub    %edx,%eax
+}
+  800ae6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ae9:	c9                   	leave
+  800aea:	c3                   	ret
+    return 0;
+  800aeb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800af0:	eb f4                	jmp    800ae6 <strncmp+0x2f>
+
+00800af2 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800af2:	55                   	push   %ebp
+  800af3:	89 e5                	mov    %esp,%ebp
+  800af5:	8b 45 08             	mov    0x8(%ebp),%eax
+  800af8:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800afc:	eb 03                	jmp    800b01 <strchr+0xf>
+  800afe:	83 c0 01             	add    $0x1,%eax
+  800b01:	0f b6 10             	movzbl (%eax),%edx
+  800b04:	84 d2                	test   %dl,%dl
+  800b06:	74 06                	je     800b0e <strchr+0x1c>
+    if (*s == c)
+  800b08:	38 ca                	cmp    %cl,%dl
+  800b0a:	75 f2                	jne    800afe <strchr+0xc>
+  800b0c:	eb 05                	jmp    800b13 <strchr+0x21>
+      return (char*)s;
+  return 0;
+  800b0e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b13:	5d                   	pop    %ebp
+  800b14:	c3                   	ret
+
+00800b15 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800b15:	55                   	push   %ebp
+  800b16:	89 e5                	mov    %esp,%ebp
+  800b18:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b1b:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800b1f:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  800b22:	38 ca                	cmp    %cl,%dl
+  800b24:	74 09                	je     800b2f <strfind+0x1a>
+  800b26:	84 d2                	test   %dl,%dl
+  800b28:	74 05                	je     800b2f <strfind+0x1a>
+  for (; *s; s++)
+  800b2a:	83 c0 01             	add    $0x1,%eax
+  800b2d:	eb f0                	jmp    800b1f <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  800b2f:	5d                   	pop    %ebp
+  800b30:	c3                   	ret
+
+00800b31 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800b31:	55                   	push   %ebp
+  800b32:	89 e5                	mov    %esp,%ebp
+  800b34:	57                   	push   %edi
+  800b35:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b38:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  800b3b:	85 c9                	test   %ecx,%ecx
+  800b3d:	74 20                	je     800b5f <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  800b3f:	89 f8                	mov    %edi,%eax
+  800b41:	09 c8                	or     %ecx,%eax
+  800b43:	a8 03                	test   $0x3,%al
+  800b45:	75 12                	jne    800b59 <memset+0x28>
+    c &= 0xFF;
+  800b47:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800b4b:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  800b51:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  800b54:	fc                   	cld
+  800b55:	f3 ab                	rep stos %eax,%es:(%edi)
+  800b57:	eb 06                	jmp    800b5f <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  800b59:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b5c:	fc                   	cld
+  800b5d:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  800b5f:	89 f8                	mov    %edi,%eax
+  800b61:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800b64:	c9                   	leave
+  800b65:	c3                   	ret
+
+00800b66 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800b66:	55                   	push   %ebp
+  800b67:	89 e5                	mov    %esp,%ebp
+  800b69:	57                   	push   %edi
+  800b6a:	56                   	push   %esi
+  800b6b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b6e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b71:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  800b74:	39 c6                	cmp    %eax,%esi
+  800b76:	73 32                	jae    800baa <memmove+0x44>
+  800b78:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800b7b:	39 d0                	cmp    %edx,%eax
+  800b7d:	73 2b                	jae    800baa <memmove+0x44>
+    s += n;
+    d += n;
+  800b7f:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b82:	89 d6                	mov    %edx,%esi
+  800b84:	09 fe                	or     %edi,%esi
+  800b86:	09 ce                	or     %ecx,%esi
+  800b88:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800b8e:	75 0e                	jne    800b9e <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800b90:	83 ef 04             	sub    $0x4,%edi
+  800b93:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800b96:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  800b99:	fd                   	std
+  800b9a:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b9c:	eb 09                	jmp    800ba7 <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800b9e:	83 ef 01             	sub    $0x1,%edi
+  800ba1:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  800ba4:	fd                   	std
+  800ba5:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  800ba7:	fc                   	cld
+  800ba8:	eb 1a                	jmp    800bc4 <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800baa:	89 f2                	mov    %esi,%edx
+  800bac:	09 c2                	or     %eax,%edx
+  800bae:	09 ca                	or     %ecx,%edx
+  800bb0:	f6 c2 03             	test   $0x3,%dl
+  800bb3:	75 0a                	jne    800bbf <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800bb5:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  800bb8:	89 c7                	mov    %eax,%edi
+  800bba:	fc                   	cld
+  800bbb:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800bbd:	eb 05                	jmp    800bc4 <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  800bbf:	89 c7                	mov    %eax,%edi
+  800bc1:	fc                   	cld
+  800bc2:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  800bc4:	5e                   	pop    %esi
+  800bc5:	5f                   	pop    %edi
+  800bc6:	5d                   	pop    %ebp
+  800bc7:	c3                   	ret
+
+00800bc8 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800bc8:	55                   	push   %ebp
+  800bc9:	89 e5                	mov    %esp,%ebp
+  800bcb:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  800bce:	ff 75 10             	push   0x10(%ebp)
+  800bd1:	ff 75 0c             	push   0xc(%ebp)
+  800bd4:	ff 75 08             	push   0x8(%ebp)
+  800bd7:	e8 8a ff ff ff       	call   800b66 <memmove>
+}
+  800bdc:	c9                   	leave
+  800bdd:	c3                   	ret
+
+00800bde <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800bde:	55                   	push   %ebp
+  800bdf:	89 e5                	mov    %esp,%ebp
+  800be1:	56                   	push   %esi
+  800be2:	53                   	push   %ebx
+  800be3:	8b 45 08             	mov    0x8(%ebp),%eax
+  800be6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  800be9:	89 c6                	mov    %eax,%esi
+  800beb:	03 75 10             	add    0x10(%ebp),%esi
+  800bee:	eb 06                	jmp    800bf6 <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  800bf0:	83 c0 01             	add    $0x1,%eax
+  800bf3:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  800bf6:	39 f0                	cmp    %esi,%eax
+  800bf8:	74 14                	je     800c0e <memcmp+0x30>
+    if (*s1 != *s2)
+  800bfa:	0f b6 08             	movzbl (%eax),%ecx
+  800bfd:	0f b6 1a             	movzbl (%edx),%ebx
+  800c00:	38 d9                	cmp    %bl,%cl
+  800c02:	74 ec                	je     800bf0 <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  800c04:	0f b6 c1             	movzbl %cl,%eax
+  800c07:	0f b6 db             	movzbl %bl,%ebx
+  800c0a:	29 d8                	sub    %ebx,%eax
+  800c0c:	eb 05                	jmp    800c13 <memcmp+0x35>
+  }
+
+  return 0;
+  800c0e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c13:	5b                   	pop    %ebx
+  800c14:	5e                   	pop    %esi
+  800c15:	5d                   	pop    %ebp
+  800c16:	c3                   	ret
+
+00800c17 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800c17:	55                   	push   %ebp
+  800c18:	89 e5                	mov    %esp,%ebp
+  800c1a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c1d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  800c20:	89 c2                	mov    %eax,%edx
+  800c22:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  800c25:	eb 03                	jmp    800c2a <memfind+0x13>
+  800c27:	83 c0 01             	add    $0x1,%eax
+  800c2a:	39 d0                	cmp    %edx,%eax
+  800c2c:	73 04                	jae    800c32 <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  800c2e:	38 08                	cmp    %cl,(%eax)
+  800c30:	75 f5                	jne    800c27 <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  800c32:	5d                   	pop    %ebp
+  800c33:	c3                   	ret
+
+00800c34 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800c34:	55                   	push   %ebp
+  800c35:	89 e5                	mov    %esp,%ebp
+  800c37:	57                   	push   %edi
+  800c38:	56                   	push   %esi
+  800c39:	53                   	push   %ebx
+  800c3a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c3d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  800c40:	eb 03                	jmp    800c45 <strtol+0x11>
+    s++;
+  800c42:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  800c45:	0f b6 02             	movzbl (%edx),%eax
+  800c48:	3c 20                	cmp    $0x20,%al
+  800c4a:	74 f6                	je     800c42 <strtol+0xe>
+  800c4c:	3c 09                	cmp    $0x9,%al
+  800c4e:	74 f2                	je     800c42 <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  800c50:	3c 2b                	cmp    $0x2b,%al
+  800c52:	74 2a                	je     800c7e <strtol+0x4a>
+  int neg = 0;
+  800c54:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  800c59:	3c 2d                	cmp    $0x2d,%al
+  800c5b:	74 2b                	je     800c88 <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c5d:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800c63:	75 0f                	jne    800c74 <strtol+0x40>
+  800c65:	80 3a 30             	cmpb   $0x30,(%edx)
+  800c68:	74 28                	je     800c92 <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  800c6a:	85 db                	test   %ebx,%ebx
+  800c6c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c71:	0f 44 d8             	cmove  %eax,%ebx
+  800c74:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c79:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800c7c:	eb 46                	jmp    800cc4 <strtol+0x90>
+    s++;
+  800c7e:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  800c81:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c86:	eb d5                	jmp    800c5d <strtol+0x29>
+    s++, neg = 1;
+  800c88:	83 c2 01             	add    $0x1,%edx
+  800c8b:	bf 01 00 00 00       	mov    $0x1,%edi
+  800c90:	eb cb                	jmp    800c5d <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c92:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800c96:	74 0e                	je     800ca6 <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  800c98:	85 db                	test   %ebx,%ebx
+  800c9a:	75 d8                	jne    800c74 <strtol+0x40>
+    s++, base = 8;
+  800c9c:	83 c2 01             	add    $0x1,%edx
+  800c9f:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800ca4:	eb ce                	jmp    800c74 <strtol+0x40>
+    s += 2, base = 16;
+  800ca6:	83 c2 02             	add    $0x2,%edx
+  800ca9:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800cae:	eb c4                	jmp    800c74 <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  800cb0:	0f be c0             	movsbl %al,%eax
+  800cb3:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  800cb6:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800cb9:	7d 3a                	jge    800cf5 <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  800cbb:	83 c2 01             	add    $0x1,%edx
+  800cbe:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800cc2:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  800cc4:	0f b6 02             	movzbl (%edx),%eax
+  800cc7:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800cca:	89 f3                	mov    %esi,%ebx
+  800ccc:	80 fb 09             	cmp    $0x9,%bl
+  800ccf:	76 df                	jbe    800cb0 <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  800cd1:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800cd4:	89 f3                	mov    %esi,%ebx
+  800cd6:	80 fb 19             	cmp    $0x19,%bl
+  800cd9:	77 08                	ja     800ce3 <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  800cdb:	0f be c0             	movsbl %al,%eax
+  800cde:	83 e8 57             	sub    $0x57,%eax
+  800ce1:	eb d3                	jmp    800cb6 <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  800ce3:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800ce6:	89 f3                	mov    %esi,%ebx
+  800ce8:	80 fb 19             	cmp    $0x19,%bl
+  800ceb:	77 08                	ja     800cf5 <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  800ced:	0f be c0             	movsbl %al,%eax
+  800cf0:	83 e8 37             	sub    $0x37,%eax
+  800cf3:	eb c1                	jmp    800cb6 <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  800cf5:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800cf9:	74 05                	je     800d00 <strtol+0xcc>
+    *endptr = (char*)s;
+  800cfb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800cfe:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  800d00:	89 c8                	mov    %ecx,%eax
+  800d02:	f7 d8                	neg    %eax
+  800d04:	85 ff                	test   %edi,%edi
+  800d06:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800d09:	89 c8                	mov    %ecx,%eax
+  800d0b:	5b                   	pop    %ebx
+  800d0c:	5e                   	pop    %esi
+  800d0d:	5f                   	pop    %edi
+  800d0e:	5d                   	pop    %ebp
+  800d0f:	c3                   	ret
+
+00800d10 <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800d10:	55                   	push   %ebp
+  800d11:	89 e5                	mov    %esp,%ebp
+  800d13:	57                   	push   %edi
+  800d14:	56                   	push   %esi
+  800d15:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d16:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d1b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d1e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d21:	89 c3                	mov    %eax,%ebx
+  800d23:	89 c7                	mov    %eax,%edi
+  800d25:	89 c6                	mov    %eax,%esi
+  800d27:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800d29:	5b                   	pop    %ebx
+  800d2a:	5e                   	pop    %esi
+  800d2b:	5f                   	pop    %edi
+  800d2c:	5d                   	pop    %ebp
+  800d2d:	c3                   	ret
+
+00800d2e <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800d2e:	55                   	push   %ebp
+  800d2f:	89 e5                	mov    %esp,%ebp
+  800d31:	57                   	push   %edi
+  800d32:	56                   	push   %esi
+  800d33:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d34:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d39:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d3e:	89 d1                	mov    %edx,%ecx
+  800d40:	89 d3                	mov    %edx,%ebx
+  800d42:	89 d7                	mov    %edx,%edi
+  800d44:	89 d6                	mov    %edx,%esi
+  800d46:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800d48:	5b                   	pop    %ebx
+  800d49:	5e                   	pop    %esi
+  800d4a:	5f                   	pop    %edi
+  800d4b:	5d                   	pop    %ebp
+  800d4c:	c3                   	ret
+
+00800d4d <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800d4d:	55                   	push   %ebp
+  800d4e:	89 e5                	mov    %esp,%ebp
+  800d50:	57                   	push   %edi
+  800d51:	56                   	push   %esi
+  800d52:	53                   	push   %ebx
+  800d53:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800d56:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d5b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d5e:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d63:	89 cb                	mov    %ecx,%ebx
+  800d65:	89 cf                	mov    %ecx,%edi
+  800d67:	89 ce                	mov    %ecx,%esi
+  800d69:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d6b:	85 c0                	test   %eax,%eax
+  800d6d:	7f 08                	jg     800d77 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800d6f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d72:	5b                   	pop    %ebx
+  800d73:	5e                   	pop    %esi
+  800d74:	5f                   	pop    %edi
+  800d75:	5d                   	pop    %ebp
+  800d76:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d77:	83 ec 0c             	sub    $0xc,%esp
+  800d7a:	50                   	push   %eax
+  800d7b:	6a 03                	push   $0x3
+  800d7d:	68 a3 34 80 00       	push   $0x8034a3
+  800d82:	6a 23                	push   $0x23
+  800d84:	68 c0 34 80 00       	push   $0x8034c0
+  800d89:	e8 89 f5 ff ff       	call   800317 <_panic>
+
+00800d8e <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800d8e:	55                   	push   %ebp
+  800d8f:	89 e5                	mov    %esp,%ebp
+  800d91:	57                   	push   %edi
+  800d92:	56                   	push   %esi
+  800d93:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d94:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d99:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d9e:	89 d1                	mov    %edx,%ecx
+  800da0:	89 d3                	mov    %edx,%ebx
+  800da2:	89 d7                	mov    %edx,%edi
+  800da4:	89 d6                	mov    %edx,%esi
+  800da6:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800da8:	5b                   	pop    %ebx
+  800da9:	5e                   	pop    %esi
+  800daa:	5f                   	pop    %edi
+  800dab:	5d                   	pop    %ebp
+  800dac:	c3                   	ret
+
+00800dad <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800dad:	55                   	push   %ebp
+  800dae:	89 e5                	mov    %esp,%ebp
+  800db0:	57                   	push   %edi
+  800db1:	56                   	push   %esi
+  800db2:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800db3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800db8:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800dbd:	89 d1                	mov    %edx,%ecx
+  800dbf:	89 d3                	mov    %edx,%ebx
+  800dc1:	89 d7                	mov    %edx,%edi
+  800dc3:	89 d6                	mov    %edx,%esi
+  800dc5:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800dc7:	5b                   	pop    %ebx
+  800dc8:	5e                   	pop    %esi
+  800dc9:	5f                   	pop    %edi
+  800dca:	5d                   	pop    %ebp
+  800dcb:	c3                   	ret
+
+00800dcc <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  800dcc:	55                   	push   %ebp
+  800dcd:	89 e5                	mov    %esp,%ebp
+  800dcf:	57                   	push   %edi
+  800dd0:	56                   	push   %esi
+  800dd1:	53                   	push   %ebx
+  800dd2:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  800dd5:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  800dd9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dde:	8b 55 08             	mov    0x8(%ebp),%edx
+  800de1:	b8 14 00 00 00       	mov    $0x14,%eax
+  800de6:	89 df                	mov    %ebx,%edi
+  800de8:	89 de                	mov    %ebx,%esi
+  800dea:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800dec:	85 c0                	test   %eax,%eax
+  800dee:	7f 08                	jg     800df8 <sys_env_set_cow+0x2c>
+}
+  800df0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800df3:	5b                   	pop    %ebx
+  800df4:	5e                   	pop    %esi
+  800df5:	5f                   	pop    %edi
+  800df6:	5d                   	pop    %ebp
+  800df7:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800df8:	83 ec 0c             	sub    $0xc,%esp
+  800dfb:	50                   	push   %eax
+  800dfc:	6a 14                	push   $0x14
+  800dfe:	68 a3 34 80 00       	push   $0x8034a3
+  800e03:	6a 23                	push   $0x23
+  800e05:	68 c0 34 80 00       	push   $0x8034c0
+  800e0a:	e8 08 f5 ff ff       	call   800317 <_panic>
+
+00800e0f <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800e0f:	55                   	push   %ebp
+  800e10:	89 e5                	mov    %esp,%ebp
+  800e12:	57                   	push   %edi
+  800e13:	56                   	push   %esi
+  800e14:	53                   	push   %ebx
+  800e15:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e18:	be 00 00 00 00       	mov    $0x0,%esi
+  800e1d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e20:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e23:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e28:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e2b:	89 f7                	mov    %esi,%edi
+  800e2d:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e2f:	85 c0                	test   %eax,%eax
+  800e31:	7f 08                	jg     800e3b <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  800e33:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e36:	5b                   	pop    %ebx
+  800e37:	5e                   	pop    %esi
+  800e38:	5f                   	pop    %edi
+  800e39:	5d                   	pop    %ebp
+  800e3a:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e3b:	83 ec 0c             	sub    $0xc,%esp
+  800e3e:	50                   	push   %eax
+  800e3f:	6a 04                	push   $0x4
+  800e41:	68 a3 34 80 00       	push   $0x8034a3
+  800e46:	6a 23                	push   $0x23
+  800e48:	68 c0 34 80 00       	push   $0x8034c0
+  800e4d:	e8 c5 f4 ff ff       	call   800317 <_panic>
+
+00800e52 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800e52:	55                   	push   %ebp
+  800e53:	89 e5                	mov    %esp,%ebp
+  800e55:	57                   	push   %edi
+  800e56:	56                   	push   %esi
+  800e57:	53                   	push   %ebx
+  800e58:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e5b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e5e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e61:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e66:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e69:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e6c:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e6f:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e71:	85 c0                	test   %eax,%eax
+  800e73:	7f 08                	jg     800e7d <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  800e75:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e78:	5b                   	pop    %ebx
+  800e79:	5e                   	pop    %esi
+  800e7a:	5f                   	pop    %edi
+  800e7b:	5d                   	pop    %ebp
+  800e7c:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e7d:	83 ec 0c             	sub    $0xc,%esp
+  800e80:	50                   	push   %eax
+  800e81:	6a 05                	push   $0x5
+  800e83:	68 a3 34 80 00       	push   $0x8034a3
+  800e88:	6a 23                	push   $0x23
+  800e8a:	68 c0 34 80 00       	push   $0x8034c0
+  800e8f:	e8 83 f4 ff ff       	call   800317 <_panic>
+
+00800e94 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800e94:	55                   	push   %ebp
+  800e95:	89 e5                	mov    %esp,%ebp
+  800e97:	57                   	push   %edi
+  800e98:	56                   	push   %esi
+  800e99:	53                   	push   %ebx
+  800e9a:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e9d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ea2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ea5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ea8:	b8 06 00 00 00       	mov    $0x6,%eax
+  800ead:	89 df                	mov    %ebx,%edi
+  800eaf:	89 de                	mov    %ebx,%esi
+  800eb1:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800eb3:	85 c0                	test   %eax,%eax
+  800eb5:	7f 08                	jg     800ebf <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  800eb7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eba:	5b                   	pop    %ebx
+  800ebb:	5e                   	pop    %esi
+  800ebc:	5f                   	pop    %edi
+  800ebd:	5d                   	pop    %ebp
+  800ebe:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ebf:	83 ec 0c             	sub    $0xc,%esp
+  800ec2:	50                   	push   %eax
+  800ec3:	6a 06                	push   $0x6
+  800ec5:	68 a3 34 80 00       	push   $0x8034a3
+  800eca:	6a 23                	push   $0x23
+  800ecc:	68 c0 34 80 00       	push   $0x8034c0
+  800ed1:	e8 41 f4 ff ff       	call   800317 <_panic>
+
+00800ed6 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  800ed6:	55                   	push   %ebp
+  800ed7:	89 e5                	mov    %esp,%ebp
+  800ed9:	57                   	push   %edi
+  800eda:	56                   	push   %esi
+  800edb:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800edc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800edf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ee2:	b8 11 00 00 00       	mov    $0x11,%eax
+  800ee7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800eea:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800eed:	8b 75 18             	mov    0x18(%ebp),%esi
+  800ef0:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  800ef2:	5b                   	pop    %ebx
+  800ef3:	5e                   	pop    %esi
+  800ef4:	5f                   	pop    %edi
+  800ef5:	5d                   	pop    %ebp
+  800ef6:	c3                   	ret
+
+00800ef7 <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  800ef7:	55                   	push   %ebp
+  800ef8:	89 e5                	mov    %esp,%ebp
+  800efa:	57                   	push   %edi
+  800efb:	56                   	push   %esi
+  800efc:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800efd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f00:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f03:	b8 12 00 00 00       	mov    $0x12,%eax
+  800f08:	be 00 00 00 00       	mov    $0x0,%esi
+  800f0d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f10:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f13:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  800f15:	5b                   	pop    %ebx
+  800f16:	5e                   	pop    %esi
+  800f17:	5f                   	pop    %edi
+  800f18:	5d                   	pop    %ebp
+  800f19:	c3                   	ret
+
+00800f1a <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  800f1a:	55                   	push   %ebp
+  800f1b:	89 e5                	mov    %esp,%ebp
+  800f1d:	57                   	push   %edi
+  800f1e:	56                   	push   %esi
+  800f1f:	53                   	push   %ebx
+  800f20:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f23:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f28:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f2b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f2e:	b8 16 00 00 00       	mov    $0x16,%eax
+  800f33:	89 df                	mov    %ebx,%edi
+  800f35:	89 de                	mov    %ebx,%esi
+  800f37:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f39:	85 c0                	test   %eax,%eax
+  800f3b:	7f 08                	jg     800f45 <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  800f3d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f40:	5b                   	pop    %ebx
+  800f41:	5e                   	pop    %esi
+  800f42:	5f                   	pop    %edi
+  800f43:	5d                   	pop    %ebp
+  800f44:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f45:	83 ec 0c             	sub    $0xc,%esp
+  800f48:	50                   	push   %eax
+  800f49:	6a 16                	push   $0x16
+  800f4b:	68 a3 34 80 00       	push   $0x8034a3
+  800f50:	6a 23                	push   $0x23
+  800f52:	68 c0 34 80 00       	push   $0x8034c0
+  800f57:	e8 bb f3 ff ff       	call   800317 <_panic>
+
+00800f5c <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  800f5c:	55                   	push   %ebp
+  800f5d:	89 e5                	mov    %esp,%ebp
+  800f5f:	57                   	push   %edi
+  800f60:	56                   	push   %esi
+  800f61:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f62:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f67:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f6a:	b8 17 00 00 00       	mov    $0x17,%eax
+  800f6f:	89 cb                	mov    %ecx,%ebx
+  800f71:	89 cf                	mov    %ecx,%edi
+  800f73:	89 ce                	mov    %ecx,%esi
+  800f75:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  800f77:	5b                   	pop    %ebx
+  800f78:	5e                   	pop    %esi
+  800f79:	5f                   	pop    %edi
+  800f7a:	5d                   	pop    %ebp
+  800f7b:	c3                   	ret
+
+00800f7c <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  800f7c:	55                   	push   %ebp
+  800f7d:	89 e5                	mov    %esp,%ebp
+  800f7f:	57                   	push   %edi
+  800f80:	56                   	push   %esi
+  800f81:	53                   	push   %ebx
+  800f82:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f85:	be 00 00 00 00       	mov    $0x0,%esi
+  800f8a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f8d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f90:	b8 18 00 00 00       	mov    $0x18,%eax
+  800f95:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f98:	89 f7                	mov    %esi,%edi
+  800f9a:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f9c:	85 c0                	test   %eax,%eax
+  800f9e:	7f 08                	jg     800fa8 <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  800fa0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fa3:	5b                   	pop    %ebx
+  800fa4:	5e                   	pop    %esi
+  800fa5:	5f                   	pop    %edi
+  800fa6:	5d                   	pop    %ebp
+  800fa7:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800fa8:	83 ec 0c             	sub    $0xc,%esp
+  800fab:	50                   	push   %eax
+  800fac:	6a 18                	push   $0x18
+  800fae:	68 a3 34 80 00       	push   $0x8034a3
+  800fb3:	6a 23                	push   $0x23
+  800fb5:	68 c0 34 80 00       	push   $0x8034c0
+  800fba:	e8 58 f3 ff ff       	call   800317 <_panic>
+
+00800fbf <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  800fbf:	55                   	push   %ebp
+  800fc0:	89 e5                	mov    %esp,%ebp
+  800fc2:	57                   	push   %edi
+  800fc3:	56                   	push   %esi
+  800fc4:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800fc5:	be 00 00 00 00       	mov    $0x0,%esi
+  800fca:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fcd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fd0:	b8 19 00 00 00       	mov    $0x19,%eax
+  800fd5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fd8:	89 f7                	mov    %esi,%edi
+  800fda:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  800fdc:	5b                   	pop    %ebx
+  800fdd:	5e                   	pop    %esi
+  800fde:	5f                   	pop    %edi
+  800fdf:	5d                   	pop    %ebp
+  800fe0:	c3                   	ret
+
+00800fe1 <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  800fe1:	55                   	push   %ebp
+  800fe2:	89 e5                	mov    %esp,%ebp
+  800fe4:	57                   	push   %edi
+  800fe5:	56                   	push   %esi
+  800fe6:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800fe7:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fec:	b8 15 00 00 00       	mov    $0x15,%eax
+  800ff1:	89 d1                	mov    %edx,%ecx
+  800ff3:	89 d3                	mov    %edx,%ebx
+  800ff5:	89 d7                	mov    %edx,%edi
+  800ff7:	89 d6                	mov    %edx,%esi
+  800ff9:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800ffb:	5b                   	pop    %ebx
+  800ffc:	5e                   	pop    %esi
+  800ffd:	5f                   	pop    %edi
+  800ffe:	5d                   	pop    %ebp
+  800fff:	c3                   	ret
+
+00801000 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801000:	55                   	push   %ebp
+  801001:	89 e5                	mov    %esp,%ebp
+  801003:	57                   	push   %edi
+  801004:	56                   	push   %esi
+  801005:	53                   	push   %ebx
+  801006:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801009:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80100e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801011:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801014:	b8 08 00 00 00       	mov    $0x8,%eax
+  801019:	89 df                	mov    %ebx,%edi
+  80101b:	89 de                	mov    %ebx,%esi
+  80101d:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80101f:	85 c0                	test   %eax,%eax
+  801021:	7f 08                	jg     80102b <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801023:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801026:	5b                   	pop    %ebx
+  801027:	5e                   	pop    %esi
+  801028:	5f                   	pop    %edi
+  801029:	5d                   	pop    %ebp
+  80102a:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80102b:	83 ec 0c             	sub    $0xc,%esp
+  80102e:	50                   	push   %eax
+  80102f:	6a 08                	push   $0x8
+  801031:	68 a3 34 80 00       	push   $0x8034a3
+  801036:	6a 23                	push   $0x23
+  801038:	68 c0 34 80 00       	push   $0x8034c0
+  80103d:	e8 d5 f2 ff ff       	call   800317 <_panic>
+
+00801042 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801042:	55                   	push   %ebp
+  801043:	89 e5                	mov    %esp,%ebp
+  801045:	57                   	push   %edi
+  801046:	56                   	push   %esi
+  801047:	53                   	push   %ebx
+  801048:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80104b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801050:	8b 55 08             	mov    0x8(%ebp),%edx
+  801053:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801056:	b8 09 00 00 00       	mov    $0x9,%eax
+  80105b:	89 df                	mov    %ebx,%edi
+  80105d:	89 de                	mov    %ebx,%esi
+  80105f:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801061:	85 c0                	test   %eax,%eax
+  801063:	7f 08                	jg     80106d <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  801065:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801068:	5b                   	pop    %ebx
+  801069:	5e                   	pop    %esi
+  80106a:	5f                   	pop    %edi
+  80106b:	5d                   	pop    %ebp
+  80106c:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80106d:	83 ec 0c             	sub    $0xc,%esp
+  801070:	50                   	push   %eax
+  801071:	6a 09                	push   $0x9
+  801073:	68 a3 34 80 00       	push   $0x8034a3
+  801078:	6a 23                	push   $0x23
+  80107a:	68 c0 34 80 00       	push   $0x8034c0
+  80107f:	e8 93 f2 ff ff       	call   800317 <_panic>
+
+00801084 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801084:	55                   	push   %ebp
+  801085:	89 e5                	mov    %esp,%ebp
+  801087:	57                   	push   %edi
+  801088:	56                   	push   %esi
+  801089:	53                   	push   %ebx
+  80108a:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80108d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801092:	8b 55 08             	mov    0x8(%ebp),%edx
+  801095:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801098:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80109d:	89 df                	mov    %ebx,%edi
+  80109f:	89 de                	mov    %ebx,%esi
+  8010a1:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8010a3:	85 c0                	test   %eax,%eax
+  8010a5:	7f 08                	jg     8010af <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  8010a7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010aa:	5b                   	pop    %ebx
+  8010ab:	5e                   	pop    %esi
+  8010ac:	5f                   	pop    %edi
+  8010ad:	5d                   	pop    %ebp
+  8010ae:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8010af:	83 ec 0c             	sub    $0xc,%esp
+  8010b2:	50                   	push   %eax
+  8010b3:	6a 0a                	push   $0xa
+  8010b5:	68 a3 34 80 00       	push   $0x8034a3
+  8010ba:	6a 23                	push   $0x23
+  8010bc:	68 c0 34 80 00       	push   $0x8034c0
+  8010c1:	e8 51 f2 ff ff       	call   800317 <_panic>
+
+008010c6 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  8010c6:	55                   	push   %ebp
+  8010c7:	89 e5                	mov    %esp,%ebp
+  8010c9:	57                   	push   %edi
+  8010ca:	56                   	push   %esi
+  8010cb:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8010cc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010cf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010d2:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010d7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010da:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010dd:	8b 75 18             	mov    0x18(%ebp),%esi
+  8010e0:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  8010e2:	5b                   	pop    %ebx
+  8010e3:	5e                   	pop    %esi
+  8010e4:	5f                   	pop    %edi
+  8010e5:	5d                   	pop    %ebp
+  8010e6:	c3                   	ret
+
+008010e7 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  8010e7:	55                   	push   %ebp
+  8010e8:	89 e5                	mov    %esp,%ebp
+  8010ea:	57                   	push   %edi
+  8010eb:	56                   	push   %esi
+  8010ec:	53                   	push   %ebx
+  8010ed:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8010f0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010f5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010fb:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801100:	89 df                	mov    %ebx,%edi
+  801102:	89 de                	mov    %ebx,%esi
+  801104:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801106:	85 c0                	test   %eax,%eax
+  801108:	7f 08                	jg     801112 <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  80110a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80110d:	5b                   	pop    %ebx
+  80110e:	5e                   	pop    %esi
+  80110f:	5f                   	pop    %edi
+  801110:	5d                   	pop    %ebp
+  801111:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801112:	83 ec 0c             	sub    $0xc,%esp
+  801115:	50                   	push   %eax
+  801116:	6a 0d                	push   $0xd
+  801118:	68 a3 34 80 00       	push   $0x8034a3
+  80111d:	6a 23                	push   $0x23
+  80111f:	68 c0 34 80 00       	push   $0x8034c0
+  801124:	e8 ee f1 ff ff       	call   800317 <_panic>
+
+00801129 <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  801129:	55                   	push   %ebp
+  80112a:	89 e5                	mov    %esp,%ebp
+  80112c:	57                   	push   %edi
+  80112d:	56                   	push   %esi
+  80112e:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80112f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801134:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801139:	89 d1                	mov    %edx,%ecx
+  80113b:	89 d3                	mov    %edx,%ebx
+  80113d:	89 d7                	mov    %edx,%edi
+  80113f:	89 d6                	mov    %edx,%esi
+  801141:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801143:	5b                   	pop    %ebx
+  801144:	5e                   	pop    %esi
+  801145:	5f                   	pop    %edi
+  801146:	5d                   	pop    %ebp
+  801147:	c3                   	ret
+
+00801148 <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  801148:	55                   	push   %ebp
+  801149:	89 e5                	mov    %esp,%ebp
+  80114b:	57                   	push   %edi
+  80114c:	56                   	push   %esi
+  80114d:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80114e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801151:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801154:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801159:	be 00 00 00 00       	mov    $0x0,%esi
+  80115e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801161:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801164:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  801166:	5b                   	pop    %ebx
+  801167:	5e                   	pop    %esi
+  801168:	5f                   	pop    %edi
+  801169:	5d                   	pop    %ebp
+  80116a:	c3                   	ret
+
+0080116b <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  80116b:	55                   	push   %ebp
+  80116c:	89 e5                	mov    %esp,%ebp
+  80116e:	57                   	push   %edi
+  80116f:	56                   	push   %esi
+  801170:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801171:	be 00 00 00 00       	mov    $0x0,%esi
+  801176:	8b 55 08             	mov    0x8(%ebp),%edx
+  801179:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80117c:	b8 10 00 00 00       	mov    $0x10,%eax
+  801181:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801184:	89 f7                	mov    %esi,%edi
+  801186:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  801188:	5b                   	pop    %ebx
+  801189:	5e                   	pop    %esi
+  80118a:	5f                   	pop    %edi
+  80118b:	5d                   	pop    %ebp
+  80118c:	c3                   	ret
+
+0080118d <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  80118d:	55                   	push   %ebp
+  80118e:	89 e5                	mov    %esp,%ebp
+  801190:	57                   	push   %edi
+  801191:	56                   	push   %esi
+  801192:	53                   	push   %ebx
+  801193:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  801196:	80 3d 68 57 80 00 00 	cmpb   $0x0,0x805768
+  80119d:	74 41                	je     8011e0 <sys_batch+0x53>
+  80119f:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011a2:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  8011a5:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  8011ac:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8011af:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  8011b2:	7d 45                	jge    8011f9 <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  8011b4:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8011b7:	8b 06                	mov    (%esi),%eax
+  8011b9:	8b 56 04             	mov    0x4(%esi),%edx
+  8011bc:	8b 4e 08             	mov    0x8(%esi),%ecx
+  8011bf:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  8011c2:	8b 7e 10             	mov    0x10(%esi),%edi
+  8011c5:	8b 76 14             	mov    0x14(%esi),%esi
+  8011c8:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  8011ca:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8011cd:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  8011d0:	83 c6 1c             	add    $0x1c,%esi
+  8011d3:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  8011d6:	85 c0                	test   %eax,%eax
+  8011d8:	78 1f                	js     8011f9 <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  8011da:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  8011de:	eb cc                	jmp    8011ac <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  8011e0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011e5:	b8 13 00 00 00       	mov    $0x13,%eax
+  8011ea:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ed:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011f0:	89 df                	mov    %ebx,%edi
+  8011f2:	89 de                	mov    %ebx,%esi
+  8011f4:	cd 30                	int    $0x30
+  8011f6:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  8011f9:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8011fc:	83 c4 08             	add    $0x8,%esp
+  8011ff:	5b                   	pop    %ebx
+  801200:	5e                   	pop    %esi
+  801201:	5f                   	pop    %edi
+  801202:	5d                   	pop    %ebp
+  801203:	c3                   	ret
+
+00801204 <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  801204:	55                   	push   %ebp
+  801205:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  801207:	8b 45 08             	mov    0x8(%ebp),%eax
+  80120a:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  801210:	5d                   	pop    %ebp
+  801211:	c3                   	ret
+
+00801212 <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  801212:	55                   	push   %ebp
+  801213:	89 e5                	mov    %esp,%ebp
+  801215:	56                   	push   %esi
+  801216:	53                   	push   %ebx
+  801217:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  80121a:	8b 1e                	mov    (%esi),%ebx
+  80121c:	85 db                	test   %ebx,%ebx
+  80121e:	75 09                	jne    801229 <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  801220:	89 d8                	mov    %ebx,%eax
+  801222:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801225:	5b                   	pop    %ebx
+  801226:	5e                   	pop    %esi
+  801227:	5d                   	pop    %ebp
+  801228:	c3                   	ret
+  b->sb_n = 0;
+  801229:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  80122f:	53                   	push   %ebx
+  801230:	8d 46 04             	lea    0x4(%esi),%eax
+  801233:	50                   	push   %eax
+  801234:	e8 54 ff ff ff       	call   80118d <sys_batch>
+  801239:	83 c4 08             	add    $0x8,%esp
+  80123c:	85 c0                	test   %eax,%eax
+  80123e:	78 1e                	js     80125e <sysbatch_flush+0x4c>
+  if (r < n)
+  801240:	39 c3                	cmp    %eax,%ebx
+  801242:	7f 07                	jg     80124b <sysbatch_flush+0x39>
+  return 0;
+  801244:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801249:	eb d5                	jmp    801220 <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  80124b:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80124e:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  801252:	85 db                	test   %ebx,%ebx
+  801254:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801259:	0f 49 d8             	cmovns %eax,%ebx
+  80125c:	eb c2                	jmp    801220 <sysbatch_flush+0xe>
+    return r;
+  80125e:	89 c3                	mov    %eax,%ebx
+  801260:	eb be                	jmp    801220 <sysbatch_flush+0xe>
+
+00801262 <sysbatch_add>:
+{
+  801262:	55                   	push   %ebp
+  801263:	89 e5                	mov    %esp,%ebp
+  801265:	53                   	push   %ebx
+  801266:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  801269:	83 3b 40             	cmpl   $0x40,(%ebx)
+  80126c:	74 41                	je     8012af <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  80126e:	8b 03                	mov    (%ebx),%eax
+  801270:	8d 50 01             	lea    0x1(%eax),%edx
+  801273:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  801275:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801278:	01 d8                	add    %ebx,%eax
+  80127a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80127d:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  801280:	8b 55 10             	mov    0x10(%ebp),%edx
+  801283:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  801286:	8b 55 14             	mov    0x14(%ebp),%edx
+  801289:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  80128c:	8b 55 18             	mov    0x18(%ebp),%edx
+  80128f:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  801292:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  801295:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  801298:	8b 55 20             	mov    0x20(%ebp),%edx
+  80129b:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  80129e:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  8012a5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8012aa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012ad:	c9                   	leave
+  8012ae:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  8012af:	53                   	push   %ebx
+  8012b0:	e8 5d ff ff ff       	call   801212 <sysbatch_flush>
+  8012b5:	83 c4 04             	add    $0x4,%esp
+  8012b8:	85 c0                	test   %eax,%eax
+  8012ba:	79 b2                	jns    80126e <sysbatch_add+0xc>
+  8012bc:	eb ec                	jmp    8012aa <sysbatch_add+0x48>
+
+008012be <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8012be:	55                   	push   %ebp
+  8012bf:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8012c1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8012c4:	05 00 00 00 30       	add    $0x30000000,%eax
+  8012c9:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8012cc:	5d                   	pop    %ebp
+  8012cd:	c3                   	ret
+
+008012ce <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8012ce:	55                   	push   %ebp
+  8012cf:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8012d1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8012d4:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  8012d7:	66 b8 00 00          	mov    $0x0,%ax
+  8012db:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8012e0:	5d                   	pop    %ebp
+  8012e1:	c3                   	ret
+
+008012e2 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8012e2:	55                   	push   %ebp
+  8012e3:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  8012e5:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8012ea:	eb 02                	jmp    8012ee <fd_alloc+0xc>
+  8012ec:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8012ee:	89 c2                	mov    %eax,%edx
+  8012f0:	c1 ea 16             	shr    $0x16,%edx
+  8012f3:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8012fa:	f6 c2 01             	test   $0x1,%dl
+  8012fd:	74 2b                	je     80132a <fd_alloc+0x48>
+  8012ff:	89 c2                	mov    %eax,%edx
+  801301:	c1 ea 0c             	shr    $0xc,%edx
+  801304:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80130b:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801311:	f6 c1 01             	test   $0x1,%cl
+  801314:	74 14                	je     80132a <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  801316:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  80131c:	75 ce                	jne    8012ec <fd_alloc+0xa>
+  80131e:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  801323:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801328:	eb 05                	jmp    80132f <fd_alloc+0x4d>
+      return 0;
+  80132a:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  80132f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801332:	89 02                	mov    %eax,(%edx)
+}
+  801334:	89 c8                	mov    %ecx,%eax
+  801336:	5d                   	pop    %ebp
+  801337:	c3                   	ret
+
+00801338 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801338:	55                   	push   %ebp
+  801339:	89 e5                	mov    %esp,%ebp
+  80133b:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  80133e:	83 f8 1f             	cmp    $0x1f,%eax
+  801341:	77 30                	ja     801373 <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  801343:	c1 e0 0c             	shl    $0xc,%eax
+  801346:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80134b:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801351:	f6 c2 01             	test   $0x1,%dl
+  801354:	74 24                	je     80137a <fd_lookup+0x42>
+  801356:	89 c2                	mov    %eax,%edx
+  801358:	c1 ea 0c             	shr    $0xc,%edx
+  80135b:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801362:	f6 c2 01             	test   $0x1,%dl
+  801365:	74 1a                	je     801381 <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  801367:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80136a:	89 02                	mov    %eax,(%edx)
+  return 0;
+  80136c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801371:	5d                   	pop    %ebp
+  801372:	c3                   	ret
+    return -E_INVAL;
+  801373:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801378:	eb f7                	jmp    801371 <fd_lookup+0x39>
+    return -E_INVAL;
+  80137a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80137f:	eb f0                	jmp    801371 <fd_lookup+0x39>
+  801381:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801386:	eb e9                	jmp    801371 <fd_lookup+0x39>
+
+00801388 <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801388:	55                   	push   %ebp
+  801389:	89 e5                	mov    %esp,%ebp
+  80138b:	53                   	push   %ebx
+  80138c:	83 ec 04             	sub    $0x4,%esp
+  80138f:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  801392:	b8 4c 35 80 00       	mov    $0x80354c,%eax
+  801397:	8b 18                	mov    (%eax),%ebx
+  801399:	85 db                	test   %ebx,%ebx
+  80139b:	74 0e                	je     8013ab <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  80139d:	83 c0 04             	add    $0x4,%eax
+  8013a0:	39 13                	cmp    %edx,(%ebx)
+  8013a2:	75 f3                	jne    801397 <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  8013a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013a9:	eb 1f                	jmp    8013ca <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8013ab:	a1 64 57 80 00       	mov    0x805764,%eax
+  8013b0:	8b 40 48             	mov    0x48(%eax),%eax
+  8013b3:	83 ec 04             	sub    $0x4,%esp
+  8013b6:	52                   	push   %edx
+  8013b7:	50                   	push   %eax
+  8013b8:	68 d0 34 80 00       	push   $0x8034d0
+  8013bd:	e8 30 f0 ff ff       	call   8003f2 <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  8013c2:	83 c4 10             	add    $0x10,%esp
+  8013c5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  8013ca:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8013cd:	89 1a                	mov    %ebx,(%edx)
+}
+  8013cf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013d2:	c9                   	leave
+  8013d3:	c3                   	ret
+
+008013d4 <fd_close>:
+{
+  8013d4:	55                   	push   %ebp
+  8013d5:	89 e5                	mov    %esp,%ebp
+  8013d7:	57                   	push   %edi
+  8013d8:	56                   	push   %esi
+  8013d9:	53                   	push   %ebx
+  8013da:	83 ec 24             	sub    $0x24,%esp
+  8013dd:	8b 75 08             	mov    0x8(%ebp),%esi
+  8013e0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8013e3:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8013e6:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8013e7:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8013ed:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8013f0:	50                   	push   %eax
+  8013f1:	e8 42 ff ff ff       	call   801338 <fd_lookup>
+  8013f6:	89 c3                	mov    %eax,%ebx
+  8013f8:	83 c4 10             	add    $0x10,%esp
+  8013fb:	85 c0                	test   %eax,%eax
+  8013fd:	78 05                	js     801404 <fd_close+0x30>
+      || fd != fd2)
+  8013ff:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801402:	74 16                	je     80141a <fd_close+0x46>
+    return must_exist ? r : 0;
+  801404:	89 f8                	mov    %edi,%eax
+  801406:	84 c0                	test   %al,%al
+  801408:	b8 00 00 00 00       	mov    $0x0,%eax
+  80140d:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801410:	89 d8                	mov    %ebx,%eax
+  801412:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801415:	5b                   	pop    %ebx
+  801416:	5e                   	pop    %esi
+  801417:	5f                   	pop    %edi
+  801418:	5d                   	pop    %ebp
+  801419:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80141a:	83 ec 08             	sub    $0x8,%esp
+  80141d:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801420:	50                   	push   %eax
+  801421:	ff 36                	push   (%esi)
+  801423:	e8 60 ff ff ff       	call   801388 <dev_lookup>
+  801428:	89 c3                	mov    %eax,%ebx
+  80142a:	83 c4 10             	add    $0x10,%esp
+  80142d:	85 c0                	test   %eax,%eax
+  80142f:	78 1a                	js     80144b <fd_close+0x77>
+    if (dev->dev_close)
+  801431:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801434:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  801437:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  80143c:	85 c0                	test   %eax,%eax
+  80143e:	74 0b                	je     80144b <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  801440:	83 ec 0c             	sub    $0xc,%esp
+  801443:	56                   	push   %esi
+  801444:	ff d0                	call   *%eax
+  801446:	89 c3                	mov    %eax,%ebx
+  801448:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  80144b:	83 ec 08             	sub    $0x8,%esp
+  80144e:	56                   	push   %esi
+  80144f:	6a 00                	push   $0x0
+  801451:	e8 3e fa ff ff       	call   800e94 <sys_page_unmap>
+  return r;
+  801456:	83 c4 10             	add    $0x10,%esp
+  801459:	eb b5                	jmp    801410 <fd_close+0x3c>
+
+0080145b <close>:
+
+int
+close(int fdnum)
+{
+  80145b:	55                   	push   %ebp
+  80145c:	89 e5                	mov    %esp,%ebp
+  80145e:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801461:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801464:	50                   	push   %eax
+  801465:	ff 75 08             	push   0x8(%ebp)
+  801468:	e8 cb fe ff ff       	call   801338 <fd_lookup>
+  80146d:	83 c4 10             	add    $0x10,%esp
+  801470:	85 c0                	test   %eax,%eax
+  801472:	79 02                	jns    801476 <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  801474:	c9                   	leave
+  801475:	c3                   	ret
+    return fd_close(fd, 1);
+  801476:	83 ec 08             	sub    $0x8,%esp
+  801479:	6a 01                	push   $0x1
+  80147b:	ff 75 f4             	push   -0xc(%ebp)
+  80147e:	e8 51 ff ff ff       	call   8013d4 <fd_close>
+  801483:	83 c4 10             	add    $0x10,%esp
+  801486:	eb ec                	jmp    801474 <close+0x19>
+
+00801488 <close_all>:
+
+void
+close_all(void)
+{
+  801488:	55                   	push   %ebp
+  801489:	89 e5                	mov    %esp,%ebp
+  80148b:	53                   	push   %ebx
+  80148c:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  80148f:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  801494:	83 ec 0c             	sub    $0xc,%esp
+  801497:	53                   	push   %ebx
+  801498:	e8 be ff ff ff       	call   80145b <close>
+  for (i = 0; i < MAXFD; i++)
+  80149d:	83 c3 01             	add    $0x1,%ebx
+  8014a0:	83 c4 10             	add    $0x10,%esp
+  8014a3:	83 fb 20             	cmp    $0x20,%ebx
+  8014a6:	75 ec                	jne    801494 <close_all+0xc>
+}
+  8014a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014ab:	c9                   	leave
+  8014ac:	c3                   	ret
+
+008014ad <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8014ad:	55                   	push   %ebp
+  8014ae:	89 e5                	mov    %esp,%ebp
+  8014b0:	57                   	push   %edi
+  8014b1:	56                   	push   %esi
+  8014b2:	53                   	push   %ebx
+  8014b3:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8014b6:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8014b9:	50                   	push   %eax
+  8014ba:	ff 75 08             	push   0x8(%ebp)
+  8014bd:	e8 76 fe ff ff       	call   801338 <fd_lookup>
+  8014c2:	89 c6                	mov    %eax,%esi
+  8014c4:	83 c4 10             	add    $0x10,%esp
+  8014c7:	85 c0                	test   %eax,%eax
+  8014c9:	0f 88 0a 01 00 00    	js     8015d9 <dup+0x12c>
+    return r;
+  close(newfdnum);
+  8014cf:	83 ec 0c             	sub    $0xc,%esp
+  8014d2:	ff 75 0c             	push   0xc(%ebp)
+  8014d5:	e8 81 ff ff ff       	call   80145b <close>
+
+  newfd = INDEX2FD(newfdnum);
+  8014da:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8014dd:	c1 e0 0c             	shl    $0xc,%eax
+  8014e0:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  8014e6:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  8014e9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8014ec:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8014ef:	89 04 24             	mov    %eax,(%esp)
+  8014f2:	e8 d7 fd ff ff       	call   8012ce <fd2data>
+  8014f7:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  8014f9:	89 3c 24             	mov    %edi,(%esp)
+  8014fc:	e8 cd fd ff ff       	call   8012ce <fd2data>
+  801501:	83 c4 10             	add    $0x10,%esp
+  801504:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801507:	89 f3                	mov    %esi,%ebx
+  801509:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  80150f:	89 c6                	mov    %eax,%esi
+  801511:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801514:	89 cf                	mov    %ecx,%edi
+  801516:	eb 0c                	jmp    801524 <dup+0x77>
+  801518:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80151e:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801524:	39 fb                	cmp    %edi,%ebx
+  801526:	74 7b                	je     8015a3 <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  801528:	89 d8                	mov    %ebx,%eax
+  80152a:	c1 e8 16             	shr    $0x16,%eax
+  80152d:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801534:	a8 01                	test   $0x1,%al
+  801536:	74 e0                	je     801518 <dup+0x6b>
+  801538:	89 d8                	mov    %ebx,%eax
+  80153a:	c1 e8 0c             	shr    $0xc,%eax
+  80153d:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801544:	f6 c2 01             	test   $0x1,%dl
+  801547:	74 cf                	je     801518 <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  801549:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  801550:	83 ec 0c             	sub    $0xc,%esp
+  801553:	25 07 0e 00 00       	and    $0xe07,%eax
+  801558:	50                   	push   %eax
+  801559:	56                   	push   %esi
+  80155a:	6a 00                	push   $0x0
+  80155c:	53                   	push   %ebx
+  80155d:	6a 00                	push   $0x0
+  80155f:	e8 ee f8 ff ff       	call   800e52 <sys_page_map>
+  801564:	83 c4 20             	add    $0x20,%esp
+  801567:	85 c0                	test   %eax,%eax
+  801569:	79 ad                	jns    801518 <dup+0x6b>
+  80156b:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80156e:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  801570:	83 ec 08             	sub    $0x8,%esp
+  801573:	ff 75 d4             	push   -0x2c(%ebp)
+  801576:	6a 00                	push   $0x0
+  801578:	e8 17 f9 ff ff       	call   800e94 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80157d:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  801580:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  801586:	83 c4 10             	add    $0x10,%esp
+  801589:	39 df                	cmp    %ebx,%edi
+  80158b:	74 4c                	je     8015d9 <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  80158d:	83 ec 08             	sub    $0x8,%esp
+  801590:	57                   	push   %edi
+  801591:	6a 00                	push   $0x0
+  801593:	e8 fc f8 ff ff       	call   800e94 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801598:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  80159e:	83 c4 10             	add    $0x10,%esp
+  8015a1:	eb e6                	jmp    801589 <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8015a3:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8015a6:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8015a9:	89 c8                	mov    %ecx,%eax
+  8015ab:	c1 e8 0c             	shr    $0xc,%eax
+  8015ae:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8015b5:	83 ec 0c             	sub    $0xc,%esp
+  8015b8:	25 07 0e 00 00       	and    $0xe07,%eax
+  8015bd:	50                   	push   %eax
+  8015be:	ff 75 d4             	push   -0x2c(%ebp)
+  8015c1:	6a 00                	push   $0x0
+  8015c3:	51                   	push   %ecx
+  8015c4:	6a 00                	push   $0x0
+  8015c6:	e8 87 f8 ff ff       	call   800e52 <sys_page_map>
+  8015cb:	89 c6                	mov    %eax,%esi
+  8015cd:	83 c4 20             	add    $0x20,%esp
+  8015d0:	85 c0                	test   %eax,%eax
+  8015d2:	78 9c                	js     801570 <dup+0xc3>
+  return newfdnum;
+  8015d4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8015d7:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  8015d9:	89 f0                	mov    %esi,%eax
+  8015db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015de:	5b                   	pop    %ebx
+  8015df:	5e                   	pop    %esi
+  8015e0:	5f                   	pop    %edi
+  8015e1:	5d                   	pop    %ebp
+  8015e2:	c3                   	ret
+
+008015e3 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8015e3:	55                   	push   %ebp
+  8015e4:	89 e5                	mov    %esp,%ebp
+  8015e6:	56                   	push   %esi
+  8015e7:	53                   	push   %ebx
+  8015e8:	83 ec 18             	sub    $0x18,%esp
+  8015eb:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  8015ee:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8015f1:	50                   	push   %eax
+  8015f2:	56                   	push   %esi
+  8015f3:	e8 40 fd ff ff       	call   801338 <fd_lookup>
+  8015f8:	83 c4 10             	add    $0x10,%esp
+  8015fb:	85 c0                	test   %eax,%eax
+  8015fd:	78 3c                	js     80163b <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8015ff:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801602:	83 ec 08             	sub    $0x8,%esp
+  801605:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801608:	50                   	push   %eax
+  801609:	ff 33                	push   (%ebx)
+  80160b:	e8 78 fd ff ff       	call   801388 <dev_lookup>
+  801610:	83 c4 10             	add    $0x10,%esp
+  801613:	85 c0                	test   %eax,%eax
+  801615:	78 24                	js     80163b <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801617:	8b 43 08             	mov    0x8(%ebx),%eax
+  80161a:	83 e0 03             	and    $0x3,%eax
+  80161d:	83 f8 01             	cmp    $0x1,%eax
+  801620:	74 20                	je     801642 <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  801622:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801625:	8b 40 08             	mov    0x8(%eax),%eax
+  801628:	85 c0                	test   %eax,%eax
+  80162a:	74 37                	je     801663 <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  80162c:	83 ec 04             	sub    $0x4,%esp
+  80162f:	ff 75 10             	push   0x10(%ebp)
+  801632:	ff 75 0c             	push   0xc(%ebp)
+  801635:	53                   	push   %ebx
+  801636:	ff d0                	call   *%eax
+  801638:	83 c4 10             	add    $0x10,%esp
+}
+  80163b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80163e:	5b                   	pop    %ebx
+  80163f:	5e                   	pop    %esi
+  801640:	5d                   	pop    %ebp
+  801641:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801642:	a1 64 57 80 00       	mov    0x805764,%eax
+  801647:	8b 40 48             	mov    0x48(%eax),%eax
+  80164a:	83 ec 04             	sub    $0x4,%esp
+  80164d:	56                   	push   %esi
+  80164e:	50                   	push   %eax
+  80164f:	68 11 35 80 00       	push   $0x803511
+  801654:	e8 99 ed ff ff       	call   8003f2 <cprintf>
+    return -E_INVAL;
+  801659:	83 c4 10             	add    $0x10,%esp
+  80165c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801661:	eb d8                	jmp    80163b <read+0x58>
+    return -E_NOT_SUPP;
+  801663:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801668:	eb d1                	jmp    80163b <read+0x58>
+
+0080166a <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80166a:	55                   	push   %ebp
+  80166b:	89 e5                	mov    %esp,%ebp
+  80166d:	57                   	push   %edi
+  80166e:	56                   	push   %esi
+  80166f:	53                   	push   %ebx
+  801670:	83 ec 0c             	sub    $0xc,%esp
+  801673:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801676:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  801679:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80167e:	eb 02                	jmp    801682 <readn+0x18>
+  801680:	01 c3                	add    %eax,%ebx
+  801682:	39 f3                	cmp    %esi,%ebx
+  801684:	73 21                	jae    8016a7 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  801686:	83 ec 04             	sub    $0x4,%esp
+  801689:	89 f0                	mov    %esi,%eax
+  80168b:	29 d8                	sub    %ebx,%eax
+  80168d:	50                   	push   %eax
+  80168e:	89 d8                	mov    %ebx,%eax
+  801690:	03 45 0c             	add    0xc(%ebp),%eax
+  801693:	50                   	push   %eax
+  801694:	57                   	push   %edi
+  801695:	e8 49 ff ff ff       	call   8015e3 <read>
+    if (m < 0)
+  80169a:	83 c4 10             	add    $0x10,%esp
+  80169d:	85 c0                	test   %eax,%eax
+  80169f:	78 04                	js     8016a5 <readn+0x3b>
+      return m;
+    if (m == 0)
+  8016a1:	75 dd                	jne    801680 <readn+0x16>
+  8016a3:	eb 02                	jmp    8016a7 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  8016a5:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  8016a7:	89 d8                	mov    %ebx,%eax
+  8016a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016ac:	5b                   	pop    %ebx
+  8016ad:	5e                   	pop    %esi
+  8016ae:	5f                   	pop    %edi
+  8016af:	5d                   	pop    %ebp
+  8016b0:	c3                   	ret
+
+008016b1 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8016b1:	55                   	push   %ebp
+  8016b2:	89 e5                	mov    %esp,%ebp
+  8016b4:	56                   	push   %esi
+  8016b5:	53                   	push   %ebx
+  8016b6:	83 ec 18             	sub    $0x18,%esp
+  8016b9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016bc:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016bf:	50                   	push   %eax
+  8016c0:	53                   	push   %ebx
+  8016c1:	e8 72 fc ff ff       	call   801338 <fd_lookup>
+  8016c6:	83 c4 10             	add    $0x10,%esp
+  8016c9:	85 c0                	test   %eax,%eax
+  8016cb:	78 37                	js     801704 <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8016cd:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8016d0:	83 ec 08             	sub    $0x8,%esp
+  8016d3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016d6:	50                   	push   %eax
+  8016d7:	ff 36                	push   (%esi)
+  8016d9:	e8 aa fc ff ff       	call   801388 <dev_lookup>
+  8016de:	83 c4 10             	add    $0x10,%esp
+  8016e1:	85 c0                	test   %eax,%eax
+  8016e3:	78 1f                	js     801704 <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8016e5:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8016e9:	74 20                	je     80170b <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  8016eb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016ee:	8b 40 0c             	mov    0xc(%eax),%eax
+  8016f1:	85 c0                	test   %eax,%eax
+  8016f3:	74 37                	je     80172c <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  8016f5:	83 ec 04             	sub    $0x4,%esp
+  8016f8:	ff 75 10             	push   0x10(%ebp)
+  8016fb:	ff 75 0c             	push   0xc(%ebp)
+  8016fe:	56                   	push   %esi
+  8016ff:	ff d0                	call   *%eax
+  801701:	83 c4 10             	add    $0x10,%esp
+}
+  801704:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801707:	5b                   	pop    %ebx
+  801708:	5e                   	pop    %esi
+  801709:	5d                   	pop    %ebp
+  80170a:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80170b:	a1 64 57 80 00       	mov    0x805764,%eax
+  801710:	8b 40 48             	mov    0x48(%eax),%eax
+  801713:	83 ec 04             	sub    $0x4,%esp
+  801716:	53                   	push   %ebx
+  801717:	50                   	push   %eax
+  801718:	68 2d 35 80 00       	push   $0x80352d
+  80171d:	e8 d0 ec ff ff       	call   8003f2 <cprintf>
+    return -E_INVAL;
+  801722:	83 c4 10             	add    $0x10,%esp
+  801725:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80172a:	eb d8                	jmp    801704 <write+0x53>
+    return -E_NOT_SUPP;
+  80172c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801731:	eb d1                	jmp    801704 <write+0x53>
+
+00801733 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801733:	55                   	push   %ebp
+  801734:	89 e5                	mov    %esp,%ebp
+  801736:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801739:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80173c:	50                   	push   %eax
+  80173d:	ff 75 08             	push   0x8(%ebp)
+  801740:	e8 f3 fb ff ff       	call   801338 <fd_lookup>
+  801745:	83 c4 10             	add    $0x10,%esp
+  801748:	85 c0                	test   %eax,%eax
+  80174a:	78 0e                	js     80175a <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  80174c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80174f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801752:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  801755:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80175a:	c9                   	leave
+  80175b:	c3                   	ret
+
+0080175c <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80175c:	55                   	push   %ebp
+  80175d:	89 e5                	mov    %esp,%ebp
+  80175f:	56                   	push   %esi
+  801760:	53                   	push   %ebx
+  801761:	83 ec 18             	sub    $0x18,%esp
+  801764:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801767:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80176a:	50                   	push   %eax
+  80176b:	53                   	push   %ebx
+  80176c:	e8 c7 fb ff ff       	call   801338 <fd_lookup>
+  801771:	83 c4 10             	add    $0x10,%esp
+  801774:	85 c0                	test   %eax,%eax
+  801776:	78 34                	js     8017ac <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801778:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80177b:	83 ec 08             	sub    $0x8,%esp
+  80177e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801781:	50                   	push   %eax
+  801782:	ff 36                	push   (%esi)
+  801784:	e8 ff fb ff ff       	call   801388 <dev_lookup>
+  801789:	83 c4 10             	add    $0x10,%esp
+  80178c:	85 c0                	test   %eax,%eax
+  80178e:	78 1c                	js     8017ac <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801790:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801794:	74 1d                	je     8017b3 <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  801796:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801799:	8b 40 18             	mov    0x18(%eax),%eax
+  80179c:	85 c0                	test   %eax,%eax
+  80179e:	74 34                	je     8017d4 <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  8017a0:	83 ec 08             	sub    $0x8,%esp
+  8017a3:	ff 75 0c             	push   0xc(%ebp)
+  8017a6:	56                   	push   %esi
+  8017a7:	ff d0                	call   *%eax
+  8017a9:	83 c4 10             	add    $0x10,%esp
+}
+  8017ac:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017af:	5b                   	pop    %ebx
+  8017b0:	5e                   	pop    %esi
+  8017b1:	5d                   	pop    %ebp
+  8017b2:	c3                   	ret
+            thisenv->env_id, fdnum);
+  8017b3:	a1 64 57 80 00       	mov    0x805764,%eax
+  8017b8:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8017bb:	83 ec 04             	sub    $0x4,%esp
+  8017be:	53                   	push   %ebx
+  8017bf:	50                   	push   %eax
+  8017c0:	68 f0 34 80 00       	push   $0x8034f0
+  8017c5:	e8 28 ec ff ff       	call   8003f2 <cprintf>
+    return -E_INVAL;
+  8017ca:	83 c4 10             	add    $0x10,%esp
+  8017cd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017d2:	eb d8                	jmp    8017ac <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  8017d4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017d9:	eb d1                	jmp    8017ac <ftruncate+0x50>
+
+008017db <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8017db:	55                   	push   %ebp
+  8017dc:	89 e5                	mov    %esp,%ebp
+  8017de:	56                   	push   %esi
+  8017df:	53                   	push   %ebx
+  8017e0:	83 ec 18             	sub    $0x18,%esp
+  8017e3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017e6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017e9:	50                   	push   %eax
+  8017ea:	ff 75 08             	push   0x8(%ebp)
+  8017ed:	e8 46 fb ff ff       	call   801338 <fd_lookup>
+  8017f2:	83 c4 10             	add    $0x10,%esp
+  8017f5:	85 c0                	test   %eax,%eax
+  8017f7:	78 49                	js     801842 <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017f9:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8017fc:	83 ec 08             	sub    $0x8,%esp
+  8017ff:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801802:	50                   	push   %eax
+  801803:	ff 36                	push   (%esi)
+  801805:	e8 7e fb ff ff       	call   801388 <dev_lookup>
+  80180a:	83 c4 10             	add    $0x10,%esp
+  80180d:	85 c0                	test   %eax,%eax
+  80180f:	78 31                	js     801842 <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  801811:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801814:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801818:	74 2f                	je     801849 <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  80181a:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  80181d:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801824:	00 00 00 
+  stat->st_isdir = 0;
+  801827:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80182e:	00 00 00 
+  stat->st_dev = dev;
+  801831:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  801837:	83 ec 08             	sub    $0x8,%esp
+  80183a:	53                   	push   %ebx
+  80183b:	56                   	push   %esi
+  80183c:	ff 50 14             	call   *0x14(%eax)
+  80183f:	83 c4 10             	add    $0x10,%esp
+}
+  801842:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801845:	5b                   	pop    %ebx
+  801846:	5e                   	pop    %esi
+  801847:	5d                   	pop    %ebp
+  801848:	c3                   	ret
+    return -E_NOT_SUPP;
+  801849:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80184e:	eb f2                	jmp    801842 <fstat+0x67>
+
+00801850 <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  801850:	55                   	push   %ebp
+  801851:	89 e5                	mov    %esp,%ebp
+  801853:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  801856:	ff 75 0c             	push   0xc(%ebp)
+  801859:	ff 75 08             	push   0x8(%ebp)
+  80185c:	e8 58 07 00 00       	call   801fb9 <file_stat>
+}
+  801861:	c9                   	leave
+  801862:	c3                   	ret
+
+00801863 <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  801863:	55                   	push   %ebp
+  801864:	89 e5                	mov    %esp,%ebp
+  801866:	57                   	push   %edi
+  801867:	56                   	push   %esi
+  801868:	53                   	push   %ebx
+  801869:	83 ec 1c             	sub    $0x1c,%esp
+  80186c:	89 c7                	mov    %eax,%edi
+  80186e:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801871:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801874:	e9 a2 00 00 00       	jmp    80191b <fsipc_send+0xb8>
+  nfsenvs = 0;
+  801879:	c7 05 20 50 80 00 00 	movl   $0x0,0x805020
+  801880:	00 00 00 
+  801883:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801888:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  80188d:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801892:	be 01 00 00 00       	mov    $0x1,%esi
+  801897:	eb 0f                	jmp    8018a8 <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801899:	83 c0 01             	add    $0x1,%eax
+  80189c:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8018a1:	74 49                	je     8018ec <fsipc_send+0x89>
+  8018a3:	83 f9 07             	cmp    $0x7,%ecx
+  8018a6:	7f 50                	jg     8018f8 <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  8018a8:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  8018ab:	c1 e2 04             	shl    $0x4,%edx
+  8018ae:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8018b4:	8b 52 50             	mov    0x50(%edx),%edx
+  8018b7:	83 fa 01             	cmp    $0x1,%edx
+  8018ba:	75 dd                	jne    801899 <fsipc_send+0x36>
+  8018bc:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  8018bf:	c1 e2 04             	shl    $0x4,%edx
+  8018c2:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8018c8:	8b 52 54             	mov    0x54(%edx),%edx
+  8018cb:	85 d2                	test   %edx,%edx
+  8018cd:	74 ca                	je     801899 <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  8018cf:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  8018d2:	c1 e2 04             	shl    $0x4,%edx
+  8018d5:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8018db:	8b 52 48             	mov    0x48(%edx),%edx
+  8018de:	89 14 8d 40 50 80 00 	mov    %edx,0x805040(,%ecx,4)
+  8018e5:	8d 49 01             	lea    0x1(%ecx),%ecx
+  8018e8:	89 f3                	mov    %esi,%ebx
+  8018ea:	eb ad                	jmp    801899 <fsipc_send+0x36>
+  8018ec:	84 db                	test   %bl,%bl
+  8018ee:	74 38                	je     801928 <fsipc_send+0xc5>
+  8018f0:	89 0d 20 50 80 00    	mov    %ecx,0x805020
+  8018f6:	eb 30                	jmp    801928 <fsipc_send+0xc5>
+  8018f8:	84 db                	test   %bl,%bl
+  8018fa:	74 2c                	je     801928 <fsipc_send+0xc5>
+  8018fc:	89 0d 20 50 80 00    	mov    %ecx,0x805020
+  801902:	eb 24                	jmp    801928 <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  801904:	50                   	push   %eax
+  801905:	68 5c 35 80 00       	push   $0x80355c
+  80190a:	6a 34                	push   $0x34
+  80190c:	68 66 35 80 00       	push   $0x803566
+  801911:	e8 01 ea ff ff       	call   800317 <_panic>
+    }
+    sys_yield();
+  801916:	e8 92 f4 ff ff       	call   800dad <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  80191b:	83 3d 20 50 80 00 03 	cmpl   $0x3,0x805020
+  801922:	0f 8e 51 ff ff ff    	jle    801879 <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  801928:	a1 64 57 80 00       	mov    0x805764,%eax
+  80192d:	8b 70 48             	mov    0x48(%eax),%esi
+  801930:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  801936:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80193b:	8b 0d 20 50 80 00    	mov    0x805020,%ecx
+  801941:	39 d9                	cmp    %ebx,%ecx
+  801943:	7e d1                	jle    801916 <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  801945:	83 ec 0c             	sub    $0xc,%esp
+  801948:	ff 75 e0             	push   -0x20(%ebp)
+  80194b:	6a 07                	push   $0x7
+  80194d:	ff 75 e4             	push   -0x1c(%ebp)
+  801950:	57                   	push   %edi
+  801951:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  801954:	99                   	cltd
+  801955:	f7 f9                	idiv   %ecx
+  801957:	ff 34 95 40 50 80 00 	push   0x805040(,%edx,4)
+  80195e:	e8 63 f7 ff ff       	call   8010c6 <sys_ipc_try_send>
+      if (r == 0)
+  801963:	83 c4 20             	add    $0x20,%esp
+  801966:	85 c0                	test   %eax,%eax
+  801968:	74 0a                	je     801974 <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  80196a:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80196d:	75 95                	jne    801904 <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  80196f:	83 c3 01             	add    $0x1,%ebx
+  801972:	eb c7                	jmp    80193b <fsipc_send+0xd8>
+  }
+}
+  801974:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801977:	5b                   	pop    %ebx
+  801978:	5e                   	pop    %esi
+  801979:	5f                   	pop    %edi
+  80197a:	5d                   	pop    %ebp
+  80197b:	c3                   	ret
+
+0080197c <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  80197c:	55                   	push   %ebp
+  80197d:	89 e5                	mov    %esp,%ebp
+  80197f:	53                   	push   %ebx
+  801980:	83 ec 14             	sub    $0x14,%esp
+  801983:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  801985:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  80198c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801991:	ba 00 60 80 00       	mov    $0x806000,%edx
+  801996:	e8 c8 fe ff ff       	call   801863 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  80199b:	6a 00                	push   $0x0
+  80199d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019a0:	50                   	push   %eax
+  8019a1:	53                   	push   %ebx
+  8019a2:	6a 00                	push   $0x0
+  8019a4:	e8 26 13 00 00       	call   802ccf <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  8019a9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019ac:	c9                   	leave
+  8019ad:	c3                   	ret
+
+008019ae <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8019ae:	55                   	push   %ebp
+  8019af:	89 e5                	mov    %esp,%ebp
+  8019b1:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8019b4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019b7:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019ba:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.set_size.req_size = newsize;
+  8019bf:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8019c2:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  8019c7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019cc:	b8 02 00 00 00       	mov    $0x2,%eax
+  8019d1:	e8 a6 ff ff ff       	call   80197c <fsipc>
+}
+  8019d6:	c9                   	leave
+  8019d7:	c3                   	ret
+
+008019d8 <devfile_flush>:
+{
+  8019d8:	55                   	push   %ebp
+  8019d9:	89 e5                	mov    %esp,%ebp
+  8019db:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8019de:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019e1:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019e4:	a3 00 60 80 00       	mov    %eax,0x806000
+  return fsipc(FSREQ_FLUSH, NULL);
+  8019e9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019ee:	b8 06 00 00 00       	mov    $0x6,%eax
+  8019f3:	e8 84 ff ff ff       	call   80197c <fsipc>
+}
+  8019f8:	c9                   	leave
+  8019f9:	c3                   	ret
+
+008019fa <devfile_stat>:
+{
+  8019fa:	55                   	push   %ebp
+  8019fb:	89 e5                	mov    %esp,%ebp
+  8019fd:	53                   	push   %ebx
+  8019fe:	83 ec 04             	sub    $0x4,%esp
+  801a01:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801a04:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a07:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a0a:	a3 00 60 80 00       	mov    %eax,0x806000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801a0f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a14:	b8 05 00 00 00       	mov    $0x5,%eax
+  801a19:	e8 5e ff ff ff       	call   80197c <fsipc>
+  801a1e:	85 c0                	test   %eax,%eax
+  801a20:	78 2c                	js     801a4e <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801a22:	83 ec 08             	sub    $0x8,%esp
+  801a25:	68 00 60 80 00       	push   $0x806000
+  801a2a:	53                   	push   %ebx
+  801a2b:	e8 b0 ef ff ff       	call   8009e0 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  801a30:	a1 80 60 80 00       	mov    0x806080,%eax
+  801a35:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801a3b:	a1 84 60 80 00       	mov    0x806084,%eax
+  801a40:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801a46:	83 c4 10             	add    $0x10,%esp
+  801a49:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a4e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a51:	c9                   	leave
+  801a52:	c3                   	ret
+
+00801a53 <fsv_alloc>:
+{
+  801a53:	55                   	push   %ebp
+  801a54:	89 e5                	mov    %esp,%ebp
+  801a56:	56                   	push   %esi
+  801a57:	53                   	push   %ebx
+  801a58:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  801a5a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a5f:	eb 22                	jmp    801a83 <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  801a61:	83 ec 04             	sub    $0x4,%esp
+  801a64:	6a 00                	push   $0x0
+  801a66:	6a 00                	push   $0x0
+  801a68:	6a 07                	push   $0x7
+  801a6a:	50                   	push   %eax
+  801a6b:	6a 00                	push   $0x0
+  801a6d:	6a 04                	push   $0x4
+  801a6f:	68 60 50 80 00       	push   $0x805060
+  801a74:	e8 e9 f7 ff ff       	call   801262 <sysbatch_add>
+  801a79:	83 c4 20             	add    $0x20,%esp
+  801a7c:	85 c0                	test   %eax,%eax
+  801a7e:	78 48                	js     801ac8 <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  801a80:	83 c3 01             	add    $0x1,%ebx
+  801a83:	39 f3                	cmp    %esi,%ebx
+  801a85:	74 31                	je     801ab8 <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  801a87:	89 d8                	mov    %ebx,%eax
+  801a89:	c1 e0 0c             	shl    $0xc,%eax
+  801a8c:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801a91:	89 c2                	mov    %eax,%edx
+  801a93:	c1 ea 16             	shr    $0x16,%edx
+  801a96:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801a9d:	f6 c2 01             	test   $0x1,%dl
+  801aa0:	74 bf                	je     801a61 <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  801aa2:	89 c2                	mov    %eax,%edx
+  801aa4:	c1 ea 0c             	shr    $0xc,%edx
+  801aa7:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801aae:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801ab1:	83 fa 03             	cmp    $0x3,%edx
+  801ab4:	75 ab                	jne    801a61 <fsv_alloc+0xe>
+  801ab6:	eb c8                	jmp    801a80 <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  801ab8:	83 ec 0c             	sub    $0xc,%esp
+  801abb:	68 60 50 80 00       	push   $0x805060
+  801ac0:	e8 4d f7 ff ff       	call   801212 <sysbatch_flush>
+  801ac5:	83 c4 10             	add    $0x10,%esp
+}
+  801ac8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801acb:	5b                   	pop    %ebx
+  801acc:	5e                   	pop    %esi
+  801acd:	5d                   	pop    %ebp
+  801ace:	c3                   	ret
+
+00801acf <devfile_read>:
+{
+  801acf:	55                   	push   %ebp
+  801ad0:	89 e5                	mov    %esp,%ebp
+  801ad2:	57                   	push   %edi
+  801ad3:	56                   	push   %esi
+  801ad4:	53                   	push   %ebx
+  801ad5:	83 ec 3c             	sub    $0x3c,%esp
+  801ad8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  801adb:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  801ae1:	77 57                	ja     801b3a <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801ae3:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ae6:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ae9:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read.req_n = n;
+  801aee:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801af4:	ba 00 00 00 00       	mov    $0x0,%edx
+  801af9:	b8 03 00 00 00       	mov    $0x3,%eax
+  801afe:	e8 79 fe ff ff       	call   80197c <fsipc>
+  801b03:	89 c6                	mov    %eax,%esi
+  801b05:	85 c0                	test   %eax,%eax
+  801b07:	78 27                	js     801b30 <devfile_read+0x61>
+  assert(r <= n);
+  801b09:	39 c3                	cmp    %eax,%ebx
+  801b0b:	0f 82 0e 02 00 00    	jb     801d1f <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  801b11:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801b16:	0f 8f 1c 02 00 00    	jg     801d38 <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801b1c:	83 ec 04             	sub    $0x4,%esp
+  801b1f:	50                   	push   %eax
+  801b20:	68 00 60 80 00       	push   $0x806000
+  801b25:	ff 75 0c             	push   0xc(%ebp)
+  801b28:	e8 39 f0 ff ff       	call   800b66 <memmove>
+  return r;
+  801b2d:	83 c4 10             	add    $0x10,%esp
+}
+  801b30:	89 f0                	mov    %esi,%eax
+  801b32:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b35:	5b                   	pop    %ebx
+  801b36:	5e                   	pop    %esi
+  801b37:	5f                   	pop    %edi
+  801b38:	5d                   	pop    %ebp
+  801b39:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  801b3a:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b3f:	e8 0f ff ff ff       	call   801a53 <fsv_alloc>
+  801b44:	89 c6                	mov    %eax,%esi
+  801b46:	85 c0                	test   %eax,%eax
+  801b48:	78 e6                	js     801b30 <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  801b4a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b4d:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b50:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  801b55:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b58:	8b 40 04             	mov    0x4(%eax),%eax
+  801b5b:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  801b60:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  801b66:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801b6d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801b72:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801b77:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801b7c:	e8 e2 fc ff ff       	call   801863 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801b81:	6a 00                	push   $0x0
+  801b83:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801b86:	50                   	push   %eax
+  801b87:	68 00 10 c0 9f       	push   $0x9fc01000
+  801b8c:	6a 00                	push   $0x0
+  801b8e:	e8 3c 11 00 00       	call   802ccf <ipc_recv_pages>
+  801b93:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  801b95:	83 c4 10             	add    $0x10,%esp
+  801b98:	85 c0                	test   %eax,%eax
+  801b9a:	7e 94                	jle    801b30 <devfile_read+0x61>
+  assert(r <= n);
+  801b9c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801b9f:	39 c3                	cmp    %eax,%ebx
+  801ba1:	72 2e                	jb     801bd1 <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801ba3:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ba6:	8b 40 04             	mov    0x4(%eax),%eax
+  801ba9:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801bae:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  801bb1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801bb4:	c1 e2 0c             	shl    $0xc,%edx
+  801bb7:	39 ca                	cmp    %ecx,%edx
+  801bb9:	72 2f                	jb     801bea <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  801bbb:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  801bc0:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  801bc3:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  801bc7:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801bcc:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  801bcf:	eb 52                	jmp    801c23 <devfile_read+0x154>
+  assert(r <= n);
+  801bd1:	68 71 35 80 00       	push   $0x803571
+  801bd6:	68 78 35 80 00       	push   $0x803578
+  801bdb:	68 49 01 00 00       	push   $0x149
+  801be0:	68 66 35 80 00       	push   $0x803566
+  801be5:	e8 2d e7 ff ff       	call   800317 <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801bea:	68 9c 35 80 00       	push   $0x80359c
+  801bef:	68 78 35 80 00       	push   $0x803578
+  801bf4:	68 4a 01 00 00       	push   $0x14a
+  801bf9:	68 66 35 80 00       	push   $0x803566
+  801bfe:	e8 14 e7 ff ff       	call   800317 <_panic>
+      memmove(dst + done, src + done, m);
+  801c03:	83 ec 04             	sub    $0x4,%esp
+  801c06:	53                   	push   %ebx
+  801c07:	56                   	push   %esi
+  801c08:	89 f8                	mov    %edi,%eax
+  801c0a:	03 45 0c             	add    0xc(%ebp),%eax
+  801c0d:	50                   	push   %eax
+  801c0e:	e8 53 ef ff ff       	call   800b66 <memmove>
+  801c13:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  801c16:	01 df                	add    %ebx,%edi
+  801c18:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801c1b:	39 c7                	cmp    %eax,%edi
+  801c1d:	0f 83 c0 00 00 00    	jae    801ce3 <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801c23:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801c26:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  801c29:	89 f0                	mov    %esi,%eax
+  801c2b:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801c30:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  801c35:	29 c3                	sub    %eax,%ebx
+  801c37:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801c3a:	29 f8                	sub    %edi,%eax
+  801c3c:	39 c3                	cmp    %eax,%ebx
+  801c3e:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  801c41:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801c47:	75 ba                	jne    801c03 <devfile_read+0x134>
+  801c49:	89 f9                	mov    %edi,%ecx
+  801c4b:	03 4d 0c             	add    0xc(%ebp),%ecx
+  801c4e:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  801c51:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  801c57:	75 aa                	jne    801c03 <devfile_read+0x134>
+  801c59:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  801c5f:	77 a2                	ja     801c03 <devfile_read+0x134>
+  801c61:	89 c8                	mov    %ecx,%eax
+  801c63:	c1 e8 16             	shr    $0x16,%eax
+  801c66:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801c6d:	a8 01                	test   $0x1,%al
+  801c6f:	74 92                	je     801c03 <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  801c71:	89 c8                	mov    %ecx,%eax
+  801c73:	c1 e8 0c             	shr    $0xc,%eax
+  801c76:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  801c7d:	a8 01                	test   $0x1,%al
+  801c7f:	74 82                	je     801c03 <devfile_read+0x134>
+  801c81:	a9 02 08 00 00       	test   $0x802,%eax
+  801c86:	0f 84 77 ff ff ff    	je     801c03 <devfile_read+0x134>
+  801c8c:	f6 c4 04             	test   $0x4,%ah
+  801c8f:	0f 85 6e ff ff ff    	jne    801c03 <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  801c95:	a1 64 57 80 00       	mov    0x805764,%eax
+  801c9a:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  801c9e:	84 c0                	test   %al,%al
+  801ca0:	75 17                	jne    801cb9 <devfile_read+0x1ea>
+  801ca2:	83 ec 08             	sub    $0x8,%esp
+  801ca5:	6a 01                	push   $0x1
+  801ca7:	6a 00                	push   $0x0
+  801ca9:	e8 1e f1 ff ff       	call   800dcc <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  801cae:	83 c4 10             	add    $0x10,%esp
+  801cb1:	85 c0                	test   %eax,%eax
+  801cb3:	0f 85 4a ff ff ff    	jne    801c03 <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  801cb9:	83 ec 04             	sub    $0x4,%esp
+  801cbc:	68 05 08 00 00       	push   $0x805
+  801cc1:	ff 75 cc             	push   -0x34(%ebp)
+  801cc4:	6a 00                	push   $0x0
+  801cc6:	56                   	push   %esi
+  801cc7:	6a 00                	push   $0x0
+  801cc9:	6a 05                	push   $0x5
+  801ccb:	68 60 50 80 00       	push   $0x805060
+  801cd0:	e8 8d f5 ff ff       	call   801262 <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  801cd5:	c1 e8 1f             	shr    $0x1f,%eax
+  801cd8:	08 45 cb             	or     %al,-0x35(%ebp)
+  801cdb:	83 c4 20             	add    $0x20,%esp
+  801cde:	e9 33 ff ff ff       	jmp    801c16 <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  801ce3:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  801ce6:	83 ec 0c             	sub    $0xc,%esp
+  801ce9:	68 60 50 80 00       	push   $0x805060
+  801cee:	e8 1f f5 ff ff       	call   801212 <sysbatch_flush>
+  801cf3:	83 c4 10             	add    $0x10,%esp
+  801cf6:	85 c0                	test   %eax,%eax
+  801cf8:	78 06                	js     801d00 <devfile_read+0x231>
+  801cfa:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  801cfe:	74 14                	je     801d14 <devfile_read+0x245>
+    memmove(dst, src, r);
+  801d00:	83 ec 04             	sub    $0x4,%esp
+  801d03:	ff 75 d4             	push   -0x2c(%ebp)
+  801d06:	ff 75 d0             	push   -0x30(%ebp)
+  801d09:	ff 75 0c             	push   0xc(%ebp)
+  801d0c:	e8 55 ee ff ff       	call   800b66 <memmove>
+  801d11:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  801d14:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d17:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  801d1a:	e9 11 fe ff ff       	jmp    801b30 <devfile_read+0x61>
+  assert(r <= n);
+  801d1f:	68 71 35 80 00       	push   $0x803571
+  801d24:	68 78 35 80 00       	push   $0x803578
+  801d29:	68 1c 01 00 00       	push   $0x11c
+  801d2e:	68 66 35 80 00       	push   $0x803566
+  801d33:	e8 df e5 ff ff       	call   800317 <_panic>
+  assert(r <= PGSIZE);
+  801d38:	68 8d 35 80 00       	push   $0x80358d
+  801d3d:	68 78 35 80 00       	push   $0x803578
+  801d42:	68 1d 01 00 00       	push   $0x11d
+  801d47:	68 66 35 80 00       	push   $0x803566
+  801d4c:	e8 c6 e5 ff ff       	call   800317 <_panic>
+
+00801d51 <devfile_write>:
+{
+  801d51:	55                   	push   %ebp
+  801d52:	89 e5                	mov    %esp,%ebp
+  801d54:	57                   	push   %edi
+  801d55:	56                   	push   %esi
+  801d56:	53                   	push   %ebx
+  801d57:	83 ec 1c             	sub    $0x1c,%esp
+  801d5a:	8b 75 08             	mov    0x8(%ebp),%esi
+  801d5d:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  801d60:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  801d65:	77 39                	ja     801da0 <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801d67:	8b 56 0c             	mov    0xc(%esi),%edx
+  801d6a:	89 15 00 60 80 00    	mov    %edx,0x806000
+  fsipcbuf.write.req_n = n;
+  801d70:	a3 04 60 80 00       	mov    %eax,0x806004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  801d75:	83 ec 04             	sub    $0x4,%esp
+  801d78:	50                   	push   %eax
+  801d79:	ff 75 0c             	push   0xc(%ebp)
+  801d7c:	68 08 60 80 00       	push   $0x806008
+  801d81:	e8 e0 ed ff ff       	call   800b66 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801d86:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d8b:	b8 04 00 00 00       	mov    $0x4,%eax
+  801d90:	e8 e7 fb ff ff       	call   80197c <fsipc>
+  801d95:	83 c4 10             	add    $0x10,%esp
+}
+  801d98:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d9b:	5b                   	pop    %ebx
+  801d9c:	5e                   	pop    %esi
+  801d9d:	5f                   	pop    %edi
+  801d9e:	5d                   	pop    %ebp
+  801d9f:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  801da0:	ba 00 00 10 00       	mov    $0x100000,%edx
+  801da5:	39 d0                	cmp    %edx,%eax
+  801da7:	89 d3                	mov    %edx,%ebx
+  801da9:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  801dac:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  801db2:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  801db5:	83 c7 01             	add    $0x1,%edi
+  801db8:	89 f8                	mov    %edi,%eax
+  801dba:	e8 94 fc ff ff       	call   801a53 <fsv_alloc>
+  801dbf:	85 c0                	test   %eax,%eax
+  801dc1:	78 d5                	js     801d98 <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  801dc3:	83 ec 04             	sub    $0x4,%esp
+  801dc6:	53                   	push   %ebx
+  801dc7:	ff 75 0c             	push   0xc(%ebp)
+  801dca:	68 00 10 c0 9f       	push   $0x9fc01000
+  801dcf:	e8 92 ed ff ff       	call   800b66 <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  801dd4:	8b 46 0c             	mov    0xc(%esi),%eax
+  801dd7:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  801ddc:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  801de2:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801de9:	89 f9                	mov    %edi,%ecx
+  801deb:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801df0:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801df5:	e8 69 fa ff ff       	call   801863 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801dfa:	6a 00                	push   $0x0
+  801dfc:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801dff:	50                   	push   %eax
+  801e00:	6a 00                	push   $0x0
+  801e02:	6a 00                	push   $0x0
+  801e04:	e8 c6 0e 00 00       	call   802ccf <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  801e09:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  801e0c:	eb 8a                	jmp    801d98 <devfile_write+0x47>
+
+00801e0e <open>:
+{
+  801e0e:	55                   	push   %ebp
+  801e0f:	89 e5                	mov    %esp,%ebp
+  801e11:	56                   	push   %esi
+  801e12:	53                   	push   %ebx
+  801e13:	83 ec 1c             	sub    $0x1c,%esp
+  801e16:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801e19:	56                   	push   %esi
+  801e1a:	e8 86 eb ff ff       	call   8009a5 <strlen>
+  801e1f:	83 c4 10             	add    $0x10,%esp
+  801e22:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801e27:	7f 6c                	jg     801e95 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  801e29:	83 ec 0c             	sub    $0xc,%esp
+  801e2c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e2f:	50                   	push   %eax
+  801e30:	e8 ad f4 ff ff       	call   8012e2 <fd_alloc>
+  801e35:	89 c3                	mov    %eax,%ebx
+  801e37:	83 c4 10             	add    $0x10,%esp
+  801e3a:	85 c0                	test   %eax,%eax
+  801e3c:	78 3c                	js     801e7a <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801e3e:	83 ec 08             	sub    $0x8,%esp
+  801e41:	56                   	push   %esi
+  801e42:	68 00 60 80 00       	push   $0x806000
+  801e47:	e8 94 eb ff ff       	call   8009e0 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801e4c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e4f:	a3 00 64 80 00       	mov    %eax,0x806400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801e54:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801e57:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e5c:	e8 1b fb ff ff       	call   80197c <fsipc>
+  801e61:	89 c3                	mov    %eax,%ebx
+  801e63:	83 c4 10             	add    $0x10,%esp
+  801e66:	85 c0                	test   %eax,%eax
+  801e68:	78 19                	js     801e83 <open+0x75>
+  return fd2num(fd);
+  801e6a:	83 ec 0c             	sub    $0xc,%esp
+  801e6d:	ff 75 f4             	push   -0xc(%ebp)
+  801e70:	e8 49 f4 ff ff       	call   8012be <fd2num>
+  801e75:	89 c3                	mov    %eax,%ebx
+  801e77:	83 c4 10             	add    $0x10,%esp
+}
+  801e7a:	89 d8                	mov    %ebx,%eax
+  801e7c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e7f:	5b                   	pop    %ebx
+  801e80:	5e                   	pop    %esi
+  801e81:	5d                   	pop    %ebp
+  801e82:	c3                   	ret
+    fd_close(fd, 0);
+  801e83:	83 ec 08             	sub    $0x8,%esp
+  801e86:	6a 00                	push   $0x0
+  801e88:	ff 75 f4             	push   -0xc(%ebp)
+  801e8b:	e8 44 f5 ff ff       	call   8013d4 <fd_close>
+    return r;
+  801e90:	83 c4 10             	add    $0x10,%esp
+  801e93:	eb e5                	jmp    801e7a <open+0x6c>
+    return -E_BAD_PATH;
+  801e95:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801e9a:	eb de                	jmp    801e7a <open+0x6c>
+
+00801e9c <open_read>:
+{
+  801e9c:	55                   	push   %ebp
+  801e9d:	89 e5                	mov    %esp,%ebp
+  801e9f:	57                   	push   %edi
+  801ea0:	56                   	push   %esi
+  801ea1:	53                   	push   %ebx
+  801ea2:	83 ec 28             	sub    $0x28,%esp
+  801ea5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  801ea8:	57                   	push   %edi
+  801ea9:	e8 f7 ea ff ff       	call   8009a5 <strlen>
+  801eae:	83 c4 10             	add    $0x10,%esp
+  801eb1:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801eb6:	0f 87 f6 00 00 00    	ja     801fb2 <open_read+0x116>
+  801ebc:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  801ebe:	83 ec 0c             	sub    $0xc,%esp
+  801ec1:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801ec4:	50                   	push   %eax
+  801ec5:	e8 18 f4 ff ff       	call   8012e2 <fd_alloc>
+  801eca:	89 c3                	mov    %eax,%ebx
+  801ecc:	83 c4 10             	add    $0x10,%esp
+  801ecf:	85 c0                	test   %eax,%eax
+  801ed1:	0f 88 b2 00 00 00    	js     801f89 <open_read+0xed>
+  strcpy(req->req_buf, path);
+  801ed7:	83 ec 08             	sub    $0x8,%esp
+  801eda:	57                   	push   %edi
+  801edb:	68 e4 60 80 00       	push   $0x8060e4
+  801ee0:	e8 fb ea ff ff       	call   8009e0 <strcpy>
+  req->req_nops = 2;
+  801ee5:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  801eec:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  801eef:	c7 05 04 60 80 00 01 	movl   $0x1,0x806004
+  801ef6:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  801ef9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801efc:	a3 10 60 80 00       	mov    %eax,0x806010
+  req->req_ops[0].op_buf = 0;
+  801f01:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  801f08:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  801f0b:	c7 05 20 60 80 00 04 	movl   $0x4,0x806020
+  801f12:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  801f15:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  801f1c:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  801f1f:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  801f24:	29 f0                	sub    %esi,%eax
+  801f26:	3b 45 14             	cmp    0x14(%ebp),%eax
+  801f29:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  801f2d:	a3 2c 60 80 00       	mov    %eax,0x80602c
+  req->req_ops[1].op_offset = 0;
+  801f32:	c7 05 30 60 80 00 00 	movl   $0x0,0x806030
+  801f39:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  801f3c:	83 c6 01             	add    $0x1,%esi
+  801f3f:	89 35 34 60 80 00    	mov    %esi,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  801f45:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801f48:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801f4d:	e8 2a fa ff ff       	call   80197c <fsipc>
+  801f52:	89 c3                	mov    %eax,%ebx
+  801f54:	83 c4 10             	add    $0x10,%esp
+  801f57:	83 f8 01             	cmp    $0x1,%eax
+  801f5a:	7e 37                	jle    801f93 <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  801f5c:	a1 38 60 80 00       	mov    0x806038,%eax
+  801f61:	8b 55 18             	mov    0x18(%ebp),%edx
+  801f64:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  801f66:	83 ec 04             	sub    $0x4,%esp
+  801f69:	50                   	push   %eax
+  801f6a:	81 c6 e4 60 80 00    	add    $0x8060e4,%esi
+  801f70:	56                   	push   %esi
+  801f71:	ff 75 10             	push   0x10(%ebp)
+  801f74:	e8 ed eb ff ff       	call   800b66 <memmove>
+  return fd2num(fd);
+  801f79:	83 c4 04             	add    $0x4,%esp
+  801f7c:	ff 75 e4             	push   -0x1c(%ebp)
+  801f7f:	e8 3a f3 ff ff       	call   8012be <fd2num>
+  801f84:	89 c3                	mov    %eax,%ebx
+  801f86:	83 c4 10             	add    $0x10,%esp
+}
+  801f89:	89 d8                	mov    %ebx,%eax
+  801f8b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f8e:	5b                   	pop    %ebx
+  801f8f:	5e                   	pop    %esi
+  801f90:	5f                   	pop    %edi
+  801f91:	5d                   	pop    %ebp
+  801f92:	c3                   	ret
+    fd_close(fd, 0);
+  801f93:	83 ec 08             	sub    $0x8,%esp
+  801f96:	6a 00                	push   $0x0
+  801f98:	ff 75 e4             	push   -0x1c(%ebp)
+  801f9b:	e8 34 f4 ff ff       	call   8013d4 <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  801fa0:	83 c4 10             	add    $0x10,%esp
+  801fa3:	85 db                	test   %ebx,%ebx
+  801fa5:	78 e2                	js     801f89 <open_read+0xed>
+  801fa7:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  801faa:	8b 9b 1c 60 80 00    	mov    0x80601c(%ebx),%ebx
+  801fb0:	eb d7                	jmp    801f89 <open_read+0xed>
+    return -E_BAD_PATH;
+  801fb2:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801fb7:	eb d0                	jmp    801f89 <open_read+0xed>
+
+00801fb9 <file_stat>:
+{
+  801fb9:	55                   	push   %ebp
+  801fba:	89 e5                	mov    %esp,%ebp
+  801fbc:	57                   	push   %edi
+  801fbd:	56                   	push   %esi
+  801fbe:	53                   	push   %ebx
+  801fbf:	83 ec 18             	sub    $0x18,%esp
+  801fc2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801fc5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801fc8:	57                   	push   %edi
+  801fc9:	e8 d7 e9 ff ff       	call   8009a5 <strlen>
+  801fce:	83 c4 10             	add    $0x10,%esp
+  801fd1:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801fd6:	0f 8f c7 00 00 00    	jg     8020a3 <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  801fdc:	83 ec 0c             	sub    $0xc,%esp
+  801fdf:	57                   	push   %edi
+  801fe0:	e8 c0 e9 ff ff       	call   8009a5 <strlen>
+  801fe5:	8d 58 04             	lea    0x4(%eax),%ebx
+  801fe8:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  801feb:	83 c4 08             	add    $0x8,%esp
+  801fee:	57                   	push   %edi
+  801fef:	68 e4 60 80 00       	push   $0x8060e4
+  801ff4:	e8 e7 e9 ff ff       	call   8009e0 <strcpy>
+  req->req_nops = 2;
+  801ff9:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  802000:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  802003:	c7 05 04 60 80 00 02 	movl   $0x2,0x806004
+  80200a:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  80200d:	c7 05 10 60 80 00 00 	movl   $0x0,0x806010
+  802014:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  802017:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  80201e:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  802021:	c7 05 20 60 80 00 03 	movl   $0x3,0x806020
+  802028:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  80202b:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  802032:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  802035:	89 1d 34 60 80 00    	mov    %ebx,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  80203b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802040:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802045:	e8 32 f9 ff ff       	call   80197c <fsipc>
+  80204a:	83 c4 10             	add    $0x10,%esp
+  80204d:	83 f8 01             	cmp    $0x1,%eax
+  802050:	7e 42                	jle    802094 <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  802052:	81 c3 e4 60 80 00    	add    $0x8060e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  802058:	83 ec 08             	sub    $0x8,%esp
+  80205b:	53                   	push   %ebx
+  80205c:	56                   	push   %esi
+  80205d:	e8 7e e9 ff ff       	call   8009e0 <strcpy>
+  st->st_size = ret->ret_size;
+  802062:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  802068:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  80206e:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  802074:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  80207a:	c7 86 88 00 00 00 04 	movl   $0x804004,0x88(%esi)
+  802081:	40 80 00 
+  return 0;
+  802084:	83 c4 10             	add    $0x10,%esp
+  802087:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80208c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80208f:	5b                   	pop    %ebx
+  802090:	5e                   	pop    %esi
+  802091:	5f                   	pop    %edi
+  802092:	5d                   	pop    %ebp
+  802093:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  802094:	85 c0                	test   %eax,%eax
+  802096:	78 f4                	js     80208c <file_stat+0xd3>
+  802098:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80209b:	8b 80 1c 60 80 00    	mov    0x80601c(%eax),%eax
+  8020a1:	eb e9                	jmp    80208c <file_stat+0xd3>
+    return -E_BAD_PATH;
+  8020a3:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8020a8:	eb e2                	jmp    80208c <file_stat+0xd3>
+
+008020aa <read_map>:
+{
+  8020aa:	55                   	push   %ebp
+  8020ab:	89 e5                	mov    %esp,%ebp
+  8020ad:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8020b0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020b3:	50                   	push   %eax
+  8020b4:	ff 75 08             	push   0x8(%ebp)
+  8020b7:	e8 7c f2 ff ff       	call   801338 <fd_lookup>
+  8020bc:	83 c4 10             	add    $0x10,%esp
+  8020bf:	85 c0                	test   %eax,%eax
+  8020c1:	78 2a                	js     8020ed <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  8020c3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020c6:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  8020cc:	39 08                	cmp    %ecx,(%eax)
+  8020ce:	75 1f                	jne    8020ef <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  8020d0:	8b 40 0c             	mov    0xc(%eax),%eax
+  8020d3:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read_map.req_offset = offset;
+  8020d8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020db:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  8020e0:	8b 55 10             	mov    0x10(%ebp),%edx
+  8020e3:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8020e8:	e8 8f f8 ff ff       	call   80197c <fsipc>
+}
+  8020ed:	c9                   	leave
+  8020ee:	c3                   	ret
+    return -E_INVAL;
+  8020ef:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020f4:	eb f7                	jmp    8020ed <read_map+0x43>
+
+008020f6 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8020f6:	55                   	push   %ebp
+  8020f7:	89 e5                	mov    %esp,%ebp
+  8020f9:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  8020fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  802101:	b8 08 00 00 00       	mov    $0x8,%eax
+  802106:	e8 71 f8 ff ff       	call   80197c <fsipc>
+}
+  80210b:	c9                   	leave
+  80210c:	c3                   	ret
+
+0080210d <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  80210d:	55                   	push   %ebp
+  80210e:	89 e5                	mov    %esp,%ebp
+  802110:	57                   	push   %edi
+  802111:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  802112:	8b 45 08             	mov    0x8(%ebp),%eax
+  802115:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.stats.req_bio_sched = 0;
+  80211a:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  802121:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  802124:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  80212b:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  80212e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802133:	b8 09 00 00 00       	mov    $0x9,%eax
+  802138:	e8 3f f8 ff ff       	call   80197c <fsipc>
+  80213d:	85 c0                	test   %eax,%eax
+  80213f:	78 14                	js     802155 <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  802141:	be 00 60 80 00       	mov    $0x806000,%esi
+  802146:	b9 16 00 00 00       	mov    $0x16,%ecx
+  80214b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80214e:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  802150:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802155:	5e                   	pop    %esi
+  802156:	5f                   	pop    %edi
+  802157:	5d                   	pop    %ebp
+  802158:	c3                   	ret
+
+00802159 <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  802159:	55                   	push   %ebp
+  80215a:	89 e5                	mov    %esp,%ebp
+  80215c:	53                   	push   %ebx
+  80215d:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  802160:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802163:	50                   	push   %eax
+  802164:	6a 00                	push   $0x0
+  802166:	e8 a2 ff ff ff       	call   80210d <fs_stats>
+  80216b:	83 c4 10             	add    $0x10,%esp
+  80216e:	85 c0                	test   %eax,%eax
+  802170:	78 28                	js     80219a <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  802172:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  802175:	83 ec 08             	sub    $0x8,%esp
+  802178:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  80217b:	50                   	push   %eax
+  80217c:	6a 20                	push   $0x20
+  80217e:	e8 8a ff ff ff       	call   80210d <fs_stats>
+  802183:	83 c4 10             	add    $0x10,%esp
+  802186:	85 c0                	test   %eax,%eax
+  802188:	78 10                	js     80219a <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  80218a:	83 ec 08             	sub    $0x8,%esp
+  80218d:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802190:	50                   	push   %eax
+  802191:	53                   	push   %ebx
+  802192:	e8 76 ff ff ff       	call   80210d <fs_stats>
+  802197:	83 c4 10             	add    $0x10,%esp
+}
+  80219a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80219d:	c9                   	leave
+  80219e:	c3                   	ret
+
+0080219f <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  80219f:	55                   	push   %ebp
+  8021a0:	89 e5                	mov    %esp,%ebp
+  8021a2:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  8021a5:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  8021ac:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  8021af:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021b2:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.stats.req_dcache = 0;
+  8021b7:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  8021be:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  8021c1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021c6:	b8 09 00 00 00       	mov    $0x9,%eax
+  8021cb:	e8 ac f7 ff ff       	call   80197c <fsipc>
+}
+  8021d0:	c9                   	leave
+  8021d1:	c3                   	ret
+
+008021d2 <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  8021d2:	55                   	push   %ebp
+  8021d3:	89 e5                	mov    %esp,%ebp
+  8021d5:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  8021d8:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  8021df:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  8021e2:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  8021e9:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  8021ec:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021ef:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_STATS, NULL);
+  8021f4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021f9:	b8 09 00 00 00       	mov    $0x9,%eax
+  8021fe:	e8 79 f7 ff ff       	call   80197c <fsipc>
+}
+  802203:	c9                   	leave
+  802204:	c3                   	ret
+
+00802205 <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  802205:	55                   	push   %ebp
+  802206:	89 e5                	mov    %esp,%ebp
+  802208:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80220b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80220e:	50                   	push   %eax
+  80220f:	ff 75 08             	push   0x8(%ebp)
+  802212:	e8 21 f1 ff ff       	call   801338 <fd_lookup>
+  802217:	83 c4 10             	add    $0x10,%esp
+  80221a:	85 c0                	test   %eax,%eax
+  80221c:	78 34                	js     802252 <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  80221e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802221:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  802227:	39 08                	cmp    %ecx,(%eax)
+  802229:	75 29                	jne    802254 <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  80222b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80222e:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.fallocate.req_offset = offset;
+  802233:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802236:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.fallocate.req_len = len;
+  80223b:	8b 45 10             	mov    0x10(%ebp),%eax
+  80223e:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  802243:	ba 00 00 00 00       	mov    $0x0,%edx
+  802248:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80224d:	e8 2a f7 ff ff       	call   80197c <fsipc>
+}
+  802252:	c9                   	leave
+  802253:	c3                   	ret
+    return -E_INVAL;
+  802254:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802259:	eb f7                	jmp    802252 <fallocate+0x4d>
+
+0080225b <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  80225b:	55                   	push   %ebp
+  80225c:	89 e5                	mov    %esp,%ebp
+  80225e:	57                   	push   %edi
+  80225f:	56                   	push   %esi
+  802260:	53                   	push   %ebx
+  802261:	83 ec 24             	sub    $0x24,%esp
+  802264:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802267:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80226a:	50                   	push   %eax
+  80226b:	ff 75 08             	push   0x8(%ebp)
+  80226e:	e8 c5 f0 ff ff       	call   801338 <fd_lookup>
+  802273:	83 c4 10             	add    $0x10,%esp
+  802276:	85 c0                	test   %eax,%eax
+  802278:	78 66                	js     8022e0 <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  80227a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80227d:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  802283:	39 08                	cmp    %ecx,(%eax)
+  802285:	75 61                	jne    8022e8 <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  802287:	85 f6                	test   %esi,%esi
+  802289:	7e 50                	jle    8022db <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  80228b:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  802290:	39 de                	cmp    %ebx,%esi
+  802292:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  802295:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802298:	8b 40 0c             	mov    0xc(%eax),%eax
+  80229b:	a3 00 60 80 00       	mov    %eax,0x806000
+    fsipcbuf.prefetch.req_n = m;
+  8022a0:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  8022a6:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  8022ad:	83 ec 04             	sub    $0x4,%esp
+  8022b0:	57                   	push   %edi
+  8022b1:	ff 75 0c             	push   0xc(%ebp)
+  8022b4:	68 08 60 80 00       	push   $0x806008
+  8022b9:	e8 a8 e8 ff ff       	call   800b66 <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  8022be:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022c3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8022c8:	e8 af f6 ff ff       	call   80197c <fsipc>
+  8022cd:	83 c4 10             	add    $0x10,%esp
+  8022d0:	85 c0                	test   %eax,%eax
+  8022d2:	78 0c                	js     8022e0 <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  8022d4:	01 7d 0c             	add    %edi,0xc(%ebp)
+  8022d7:	29 de                	sub    %ebx,%esi
+  8022d9:	eb ac                	jmp    802287 <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  8022db:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022e3:	5b                   	pop    %ebx
+  8022e4:	5e                   	pop    %esi
+  8022e5:	5f                   	pop    %edi
+  8022e6:	5d                   	pop    %ebp
+  8022e7:	c3                   	ret
+    return -E_INVAL;
+  8022e8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8022ed:	eb f1                	jmp    8022e0 <prefetch+0x85>
+
+008022ef <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  8022ef:	55                   	push   %ebp
+  8022f0:	89 e5                	mov    %esp,%ebp
+  8022f2:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  8022f5:	50                   	push   %eax
+  8022f6:	e8 d3 ef ff ff       	call   8012ce <fd2data>
+  8022fb:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  802300:	c9                   	leave
+  802301:	c3                   	ret
+
+00802302 <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802302:	55                   	push   %ebp
+  802303:	89 e5                	mov    %esp,%ebp
+  802305:	56                   	push   %esi
+  802306:	53                   	push   %ebx
+  802307:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  80230a:	83 ec 0c             	sub    $0xc,%esp
+  80230d:	ff 75 08             	push   0x8(%ebp)
+  802310:	e8 b9 ef ff ff       	call   8012ce <fd2data>
+  802315:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  802317:	83 c4 08             	add    $0x8,%esp
+  80231a:	68 c8 35 80 00       	push   $0x8035c8
+  80231f:	53                   	push   %ebx
+  802320:	e8 bb e6 ff ff       	call   8009e0 <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  802325:	8b 46 04             	mov    0x4(%esi),%eax
+  802328:	2b 06                	sub    (%esi),%eax
+  80232a:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  802330:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802337:	00 00 00 
+  stat->st_dev = &devpipe;
+  80233a:	c7 83 88 00 00 00 20 	movl   $0x804020,0x88(%ebx)
+  802341:	40 80 00 
+  return 0;
+}
+  802344:	b8 00 00 00 00       	mov    $0x0,%eax
+  802349:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80234c:	5b                   	pop    %ebx
+  80234d:	5e                   	pop    %esi
+  80234e:	5d                   	pop    %ebp
+  80234f:	c3                   	ret
+
+00802350 <pipe_wakeup>:
+{
+  802350:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  802352:	b8 00 00 00 00       	mov    $0x0,%eax
+  802357:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  80235a:	85 c0                	test   %eax,%eax
+  80235c:	75 01                	jne    80235f <pipe_wakeup+0xf>
+  80235e:	c3                   	ret
+{
+  80235f:	55                   	push   %ebp
+  802360:	89 e5                	mov    %esp,%ebp
+  802362:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  802365:	6a 00                	push   $0x0
+  802367:	68 00 00 c0 ee       	push   $0xeec00000
+  80236c:	52                   	push   %edx
+  80236d:	e8 f9 ed ff ff       	call   80116b <sys_chan_wakeup>
+  802372:	83 c4 10             	add    $0x10,%esp
+}
+  802375:	c9                   	leave
+  802376:	c3                   	ret
+
+00802377 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802377:	55                   	push   %ebp
+  802378:	89 e5                	mov    %esp,%ebp
+  80237a:	57                   	push   %edi
+  80237b:	56                   	push   %esi
+  80237c:	53                   	push   %ebx
+  80237d:	83 ec 18             	sub    $0x18,%esp
+  802380:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  802383:	57                   	push   %edi
+  802384:	e8 45 ef ff ff       	call   8012ce <fd2data>
+  802389:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  80238b:	83 c4 10             	add    $0x10,%esp
+  80238e:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  802392:	74 2a                	je     8023be <devpipe_close+0x47>
+  802394:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  802399:	89 f8                	mov    %edi,%eax
+  80239b:	e8 4f ff ff ff       	call   8022ef <pipe_ring>
+  8023a0:	83 ec 08             	sub    $0x8,%esp
+  8023a3:	01 d8                	add    %ebx,%eax
+  8023a5:	50                   	push   %eax
+  8023a6:	6a 00                	push   $0x0
+  8023a8:	e8 e7 ea ff ff       	call   800e94 <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  8023ad:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8023b3:	83 c4 10             	add    $0x10,%esp
+  8023b6:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  8023bc:	75 db                	jne    802399 <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  8023be:	83 ec 08             	sub    $0x8,%esp
+  8023c1:	57                   	push   %edi
+  8023c2:	6a 00                	push   $0x0
+  8023c4:	e8 cb ea ff ff       	call   800e94 <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  8023c9:	83 c4 10             	add    $0x10,%esp
+  8023cc:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  8023d0:	75 13                	jne    8023e5 <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  8023d2:	83 ec 08             	sub    $0x8,%esp
+  8023d5:	56                   	push   %esi
+  8023d6:	6a 00                	push   $0x0
+  8023d8:	e8 b7 ea ff ff       	call   800e94 <sys_page_unmap>
+}
+  8023dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023e0:	5b                   	pop    %ebx
+  8023e1:	5e                   	pop    %esi
+  8023e2:	5f                   	pop    %edi
+  8023e3:	5d                   	pop    %ebp
+  8023e4:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  8023e5:	8d 56 04             	lea    0x4(%esi),%edx
+  8023e8:	8d 46 2c             	lea    0x2c(%esi),%eax
+  8023eb:	e8 60 ff ff ff       	call   802350 <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8023f0:	8d 46 30             	lea    0x30(%esi),%eax
+  8023f3:	89 f2                	mov    %esi,%edx
+  8023f5:	e8 56 ff ff ff       	call   802350 <pipe_wakeup>
+  8023fa:	eb d6                	jmp    8023d2 <devpipe_close+0x5b>
+
+008023fc <_pipeisclosed>:
+{
+  8023fc:	55                   	push   %ebp
+  8023fd:	89 e5                	mov    %esp,%ebp
+  8023ff:	57                   	push   %edi
+  802400:	56                   	push   %esi
+  802401:	53                   	push   %ebx
+  802402:	83 ec 1c             	sub    $0x1c,%esp
+  802405:	89 c7                	mov    %eax,%edi
+  802407:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  802409:	a1 64 57 80 00       	mov    0x805764,%eax
+  80240e:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  802411:	83 ec 0c             	sub    $0xc,%esp
+  802414:	57                   	push   %edi
+  802415:	e8 18 0a 00 00       	call   802e32 <pageref>
+  80241a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80241d:	89 34 24             	mov    %esi,(%esp)
+  802420:	e8 0d 0a 00 00       	call   802e32 <pageref>
+    nn = thisenv->env_runs;
+  802425:	8b 15 64 57 80 00    	mov    0x805764,%edx
+  80242b:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  80242e:	83 c4 10             	add    $0x10,%esp
+  802431:	39 cb                	cmp    %ecx,%ebx
+  802433:	74 1b                	je     802450 <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  802435:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802438:	75 cf                	jne    802409 <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80243a:	8b 42 58             	mov    0x58(%edx),%eax
+  80243d:	6a 01                	push   $0x1
+  80243f:	50                   	push   %eax
+  802440:	53                   	push   %ebx
+  802441:	68 cf 35 80 00       	push   $0x8035cf
+  802446:	e8 a7 df ff ff       	call   8003f2 <cprintf>
+  80244b:	83 c4 10             	add    $0x10,%esp
+  80244e:	eb b9                	jmp    802409 <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  802450:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802453:	0f 94 c0             	sete   %al
+  802456:	0f b6 c0             	movzbl %al,%eax
+}
+  802459:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80245c:	5b                   	pop    %ebx
+  80245d:	5e                   	pop    %esi
+  80245e:	5f                   	pop    %edi
+  80245f:	5d                   	pop    %ebp
+  802460:	c3                   	ret
+
+00802461 <devpipe_write_bulk>:
+{
+  802461:	55                   	push   %ebp
+  802462:	89 e5                	mov    %esp,%ebp
+  802464:	57                   	push   %edi
+  802465:	56                   	push   %esi
+  802466:	53                   	push   %ebx
+  802467:	83 ec 1c             	sub    $0x1c,%esp
+  80246a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80246d:	89 d6                	mov    %edx,%esi
+  80246f:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  802472:	e8 78 fe ff ff       	call   8022ef <pipe_ring>
+  802477:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  80247a:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  80247f:	8d 46 04             	lea    0x4(%esi),%eax
+  802482:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  802485:	eb 75                	jmp    8024fc <devpipe_write_bulk+0x9b>
+  802487:	b8 01 00 00 00       	mov    $0x1,%eax
+  80248c:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802490:	6a 64                	push   $0x64
+  802492:	68 00 00 c0 ee       	push   $0xeec00000
+  802497:	53                   	push   %ebx
+  802498:	56                   	push   %esi
+  802499:	e8 aa ec ff ff       	call   801148 <sys_chan_sleep>
+      continue;
+  80249e:	83 c4 10             	add    $0x10,%esp
+  8024a1:	eb 59                	jmp    8024fc <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  8024a3:	89 d1                	mov    %edx,%ecx
+  8024a5:	c1 f9 1f             	sar    $0x1f,%ecx
+  8024a8:	c1 e9 11             	shr    $0x11,%ecx
+  8024ab:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  8024ae:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8024b3:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  8024b5:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  8024bb:	29 d3                	sub    %edx,%ebx
+  8024bd:	ba 00 80 00 00       	mov    $0x8000,%edx
+  8024c2:	29 c2                	sub    %eax,%edx
+  8024c4:	39 d3                	cmp    %edx,%ebx
+  8024c6:	0f 47 da             	cmova  %edx,%ebx
+  8024c9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024cc:	29 fa                	sub    %edi,%edx
+  8024ce:	39 d3                	cmp    %edx,%ebx
+  8024d0:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  8024d3:	83 ec 04             	sub    $0x4,%esp
+  8024d6:	53                   	push   %ebx
+  8024d7:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8024da:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  8024dd:	52                   	push   %edx
+  8024de:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8024e1:	01 c8                	add    %ecx,%eax
+  8024e3:	50                   	push   %eax
+  8024e4:	e8 df e6 ff ff       	call   800bc8 <memcpy>
+    i += m;
+  8024e9:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  8024eb:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  8024ee:	8d 46 2c             	lea    0x2c(%esi),%eax
+  8024f1:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8024f4:	e8 57 fe ff ff       	call   802350 <pipe_wakeup>
+  8024f9:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  8024fc:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  8024ff:	73 2b                	jae    80252c <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  802501:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  802503:	8b 56 04             	mov    0x4(%esi),%edx
+  802506:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  80250c:	39 d0                	cmp    %edx,%eax
+  80250e:	7d 93                	jge    8024a3 <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  802510:	89 f2                	mov    %esi,%edx
+  802512:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802515:	e8 e2 fe ff ff       	call   8023fc <_pipeisclosed>
+  80251a:	85 c0                	test   %eax,%eax
+  80251c:	0f 84 65 ff ff ff    	je     802487 <devpipe_write_bulk+0x26>
+        return i;
+  802522:	89 f8                	mov    %edi,%eax
+}
+  802524:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802527:	5b                   	pop    %ebx
+  802528:	5e                   	pop    %esi
+  802529:	5f                   	pop    %edi
+  80252a:	5d                   	pop    %ebp
+  80252b:	c3                   	ret
+  return i;
+  80252c:	89 f8                	mov    %edi,%eax
+  80252e:	eb f4                	jmp    802524 <devpipe_write_bulk+0xc3>
+
+00802530 <devpipe_write>:
+{
+  802530:	55                   	push   %ebp
+  802531:	89 e5                	mov    %esp,%ebp
+  802533:	57                   	push   %edi
+  802534:	56                   	push   %esi
+  802535:	53                   	push   %ebx
+  802536:	83 ec 28             	sub    $0x28,%esp
+  802539:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  80253c:	56                   	push   %esi
+  80253d:	e8 8c ed ff ff       	call   8012ce <fd2data>
+  802542:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  802544:	8b 78 28             	mov    0x28(%eax),%edi
+  802547:	83 c4 10             	add    $0x10,%esp
+  80254a:	85 ff                	test   %edi,%edi
+  80254c:	75 25                	jne    802573 <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  80254e:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802551:	74 66                	je     8025b9 <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802553:	8b 43 04             	mov    0x4(%ebx),%eax
+  802556:	8b 0b                	mov    (%ebx),%ecx
+  802558:	8d 51 20             	lea    0x20(%ecx),%edx
+  80255b:	39 d0                	cmp    %edx,%eax
+  80255d:	72 2b                	jb     80258a <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  80255f:	89 da                	mov    %ebx,%edx
+  802561:	89 f0                	mov    %esi,%eax
+  802563:	e8 94 fe ff ff       	call   8023fc <_pipeisclosed>
+  802568:	85 c0                	test   %eax,%eax
+  80256a:	75 51                	jne    8025bd <devpipe_write+0x8d>
+      sys_yield();
+  80256c:	e8 3c e8 ff ff       	call   800dad <sys_yield>
+  802571:	eb e0                	jmp    802553 <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  802573:	83 ec 0c             	sub    $0xc,%esp
+  802576:	ff 75 10             	push   0x10(%ebp)
+  802579:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80257c:	89 c2                	mov    %eax,%edx
+  80257e:	89 f0                	mov    %esi,%eax
+  802580:	e8 dc fe ff ff       	call   802461 <devpipe_write_bulk>
+  802585:	83 c4 10             	add    $0x10,%esp
+  802588:	eb 38                	jmp    8025c2 <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80258a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80258d:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802591:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802594:	89 c2                	mov    %eax,%edx
+  802596:	c1 fa 1f             	sar    $0x1f,%edx
+  802599:	89 d1                	mov    %edx,%ecx
+  80259b:	c1 e9 1b             	shr    $0x1b,%ecx
+  80259e:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8025a1:	83 e2 1f             	and    $0x1f,%edx
+  8025a4:	29 ca                	sub    %ecx,%edx
+  8025a6:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8025aa:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  8025ae:	83 c0 01             	add    $0x1,%eax
+  8025b1:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  8025b4:	83 c7 01             	add    $0x1,%edi
+  8025b7:	eb 95                	jmp    80254e <devpipe_write+0x1e>
+  return i;
+  8025b9:	89 f8                	mov    %edi,%eax
+  8025bb:	eb 05                	jmp    8025c2 <devpipe_write+0x92>
+        return 0;
+  8025bd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025c2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025c5:	5b                   	pop    %ebx
+  8025c6:	5e                   	pop    %esi
+  8025c7:	5f                   	pop    %edi
+  8025c8:	5d                   	pop    %ebp
+  8025c9:	c3                   	ret
+
+008025ca <devpipe_read_bulk>:
+{
+  8025ca:	55                   	push   %ebp
+  8025cb:	89 e5                	mov    %esp,%ebp
+  8025cd:	57                   	push   %edi
+  8025ce:	56                   	push   %esi
+  8025cf:	53                   	push   %ebx
+  8025d0:	83 ec 2c             	sub    $0x2c,%esp
+  8025d3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8025d6:	89 d6                	mov    %edx,%esi
+  8025d8:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8025db:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  8025de:	e8 0c fd ff ff       	call   8022ef <pipe_ring>
+  8025e3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  8025e6:	85 db                	test   %ebx,%ebx
+  8025e8:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8025ed:	0f 45 c3             	cmovne %ebx,%eax
+  8025f0:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8025f3:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8025f8:	8d 46 30             	lea    0x30(%esi),%eax
+  8025fb:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  8025fe:	eb 50                	jmp    802650 <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  802600:	89 d1                	mov    %edx,%ecx
+  802602:	c1 f9 1f             	sar    $0x1f,%ecx
+  802605:	c1 e9 11             	shr    $0x11,%ecx
+  802608:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  80260b:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802610:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  802612:	29 d3                	sub    %edx,%ebx
+  802614:	ba 00 80 00 00       	mov    $0x8000,%edx
+  802619:	29 c2                	sub    %eax,%edx
+  80261b:	39 d3                	cmp    %edx,%ebx
+  80261d:	0f 47 da             	cmova  %edx,%ebx
+  802620:	8b 55 08             	mov    0x8(%ebp),%edx
+  802623:	29 fa                	sub    %edi,%edx
+  802625:	39 d3                	cmp    %edx,%ebx
+  802627:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  80262a:	83 ec 04             	sub    $0x4,%esp
+  80262d:	53                   	push   %ebx
+  80262e:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802631:	01 c8                	add    %ecx,%eax
+  802633:	50                   	push   %eax
+  802634:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802637:	01 f8                	add    %edi,%eax
+  802639:	50                   	push   %eax
+  80263a:	e8 89 e5 ff ff       	call   800bc8 <memcpy>
+    i += m;
+  80263f:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  802641:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802643:	89 f2                	mov    %esi,%edx
+  802645:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802648:	e8 03 fd ff ff       	call   802350 <pipe_wakeup>
+  80264d:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802650:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802653:	73 51                	jae    8026a6 <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  802655:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  802658:	8b 16                	mov    (%esi),%edx
+  80265a:	39 da                	cmp    %ebx,%edx
+  80265c:	75 a2                	jne    802600 <devpipe_read_bulk+0x36>
+      if (i > 0)
+  80265e:	85 ff                	test   %edi,%edi
+  802660:	75 44                	jne    8026a6 <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  802662:	89 f2                	mov    %esi,%edx
+  802664:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802667:	e8 90 fd ff ff       	call   8023fc <_pipeisclosed>
+  80266c:	85 c0                	test   %eax,%eax
+  80266e:	75 3a                	jne    8026aa <devpipe_read_bulk+0xe0>
+  802670:	b8 01 00 00 00       	mov    $0x1,%eax
+  802675:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802679:	6a 64                	push   $0x64
+  80267b:	ff 75 d4             	push   -0x2c(%ebp)
+  80267e:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  80267f:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802682:	50                   	push   %eax
+  802683:	e8 c0 ea ff ff       	call   801148 <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  802688:	85 c0                	test   %eax,%eax
+  80268a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80268f:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  802692:	83 c4 10             	add    $0x10,%esp
+  802695:	a8 01                	test   $0x1,%al
+  802697:	74 b7                	je     802650 <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  802699:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  80269e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026a1:	5b                   	pop    %ebx
+  8026a2:	5e                   	pop    %esi
+  8026a3:	5f                   	pop    %edi
+  8026a4:	5d                   	pop    %ebp
+  8026a5:	c3                   	ret
+  return i;
+  8026a6:	89 f8                	mov    %edi,%eax
+  8026a8:	eb f4                	jmp    80269e <devpipe_read_bulk+0xd4>
+        return 0;
+  8026aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026af:	eb ed                	jmp    80269e <devpipe_read_bulk+0xd4>
+
+008026b1 <devpipe_read>:
+{
+  8026b1:	55                   	push   %ebp
+  8026b2:	89 e5                	mov    %esp,%ebp
+  8026b4:	57                   	push   %edi
+  8026b5:	56                   	push   %esi
+  8026b6:	53                   	push   %ebx
+  8026b7:	83 ec 18             	sub    $0x18,%esp
+  8026ba:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  8026bd:	57                   	push   %edi
+  8026be:	e8 0b ec ff ff       	call   8012ce <fd2data>
+  8026c3:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  8026c5:	8b 70 28             	mov    0x28(%eax),%esi
+  8026c8:	83 c4 10             	add    $0x10,%esp
+  8026cb:	85 f6                	test   %esi,%esi
+  8026cd:	75 24                	jne    8026f3 <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  8026cf:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8026d2:	74 60                	je     802734 <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  8026d4:	8b 03                	mov    (%ebx),%eax
+  8026d6:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8026d9:	75 3b                	jne    802716 <devpipe_read+0x65>
+      if (i > 0)
+  8026db:	85 f6                	test   %esi,%esi
+  8026dd:	75 2d                	jne    80270c <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  8026df:	89 da                	mov    %ebx,%edx
+  8026e1:	89 f8                	mov    %edi,%eax
+  8026e3:	e8 14 fd ff ff       	call   8023fc <_pipeisclosed>
+  8026e8:	85 c0                	test   %eax,%eax
+  8026ea:	75 4c                	jne    802738 <devpipe_read+0x87>
+      sys_yield();
+  8026ec:	e8 bc e6 ff ff       	call   800dad <sys_yield>
+  8026f1:	eb e1                	jmp    8026d4 <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  8026f3:	83 ec 08             	sub    $0x8,%esp
+  8026f6:	6a 00                	push   $0x0
+  8026f8:	ff 75 10             	push   0x10(%ebp)
+  8026fb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8026fe:	89 c2                	mov    %eax,%edx
+  802700:	89 f8                	mov    %edi,%eax
+  802702:	e8 c3 fe ff ff       	call   8025ca <devpipe_read_bulk>
+  802707:	83 c4 10             	add    $0x10,%esp
+  80270a:	eb 02                	jmp    80270e <devpipe_read+0x5d>
+        return i;
+  80270c:	89 f0                	mov    %esi,%eax
+}
+  80270e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802711:	5b                   	pop    %ebx
+  802712:	5e                   	pop    %esi
+  802713:	5f                   	pop    %edi
+  802714:	5d                   	pop    %ebp
+  802715:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802716:	99                   	cltd
+  802717:	c1 ea 1b             	shr    $0x1b,%edx
+  80271a:	01 d0                	add    %edx,%eax
+  80271c:	83 e0 1f             	and    $0x1f,%eax
+  80271f:	29 d0                	sub    %edx,%eax
+  802721:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802726:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802729:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  80272c:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  80272f:	83 c6 01             	add    $0x1,%esi
+  802732:	eb 9b                	jmp    8026cf <devpipe_read+0x1e>
+  return i;
+  802734:	89 f0                	mov    %esi,%eax
+  802736:	eb d6                	jmp    80270e <devpipe_read+0x5d>
+        return 0;
+  802738:	b8 00 00 00 00       	mov    $0x0,%eax
+  80273d:	eb cf                	jmp    80270e <devpipe_read+0x5d>
+
+0080273f <pipe2>:
+{
+  80273f:	55                   	push   %ebp
+  802740:	89 e5                	mov    %esp,%ebp
+  802742:	57                   	push   %edi
+  802743:	56                   	push   %esi
+  802744:	53                   	push   %ebx
+  802745:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  802748:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80274b:	50                   	push   %eax
+  80274c:	e8 91 eb ff ff       	call   8012e2 <fd_alloc>
+  802751:	89 c3                	mov    %eax,%ebx
+  802753:	83 c4 10             	add    $0x10,%esp
+  802756:	85 c0                	test   %eax,%eax
+  802758:	0f 88 fb 01 00 00    	js     802959 <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80275e:	83 ec 04             	sub    $0x4,%esp
+  802761:	68 07 04 00 00       	push   $0x407
+  802766:	ff 75 e4             	push   -0x1c(%ebp)
+  802769:	6a 00                	push   $0x0
+  80276b:	e8 9f e6 ff ff       	call   800e0f <sys_page_alloc>
+  802770:	89 c3                	mov    %eax,%ebx
+  802772:	83 c4 10             	add    $0x10,%esp
+  802775:	85 c0                	test   %eax,%eax
+  802777:	0f 88 dc 01 00 00    	js     802959 <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  80277d:	83 ec 0c             	sub    $0xc,%esp
+  802780:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  802783:	50                   	push   %eax
+  802784:	e8 59 eb ff ff       	call   8012e2 <fd_alloc>
+  802789:	89 c3                	mov    %eax,%ebx
+  80278b:	83 c4 10             	add    $0x10,%esp
+  80278e:	85 c0                	test   %eax,%eax
+  802790:	0f 88 b3 01 00 00    	js     802949 <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802796:	83 ec 04             	sub    $0x4,%esp
+  802799:	68 07 04 00 00       	push   $0x407
+  80279e:	ff 75 e0             	push   -0x20(%ebp)
+  8027a1:	6a 00                	push   $0x0
+  8027a3:	e8 67 e6 ff ff       	call   800e0f <sys_page_alloc>
+  8027a8:	89 c3                	mov    %eax,%ebx
+  8027aa:	83 c4 10             	add    $0x10,%esp
+  8027ad:	85 c0                	test   %eax,%eax
+  8027af:	0f 88 94 01 00 00    	js     802949 <pipe2+0x20a>
+  va = fd2data(fd0);
+  8027b5:	83 ec 0c             	sub    $0xc,%esp
+  8027b8:	ff 75 e4             	push   -0x1c(%ebp)
+  8027bb:	e8 0e eb ff ff       	call   8012ce <fd2data>
+  8027c0:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8027c2:	83 c4 0c             	add    $0xc,%esp
+  8027c5:	68 07 04 00 00       	push   $0x407
+  8027ca:	50                   	push   %eax
+  8027cb:	6a 00                	push   $0x0
+  8027cd:	e8 3d e6 ff ff       	call   800e0f <sys_page_alloc>
+  8027d2:	89 c3                	mov    %eax,%ebx
+  8027d4:	83 c4 10             	add    $0x10,%esp
+  8027d7:	85 c0                	test   %eax,%eax
+  8027d9:	0f 88 5a 01 00 00    	js     802939 <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8027df:	83 ec 0c             	sub    $0xc,%esp
+  8027e2:	ff 75 e0             	push   -0x20(%ebp)
+  8027e5:	e8 e4 ea ff ff       	call   8012ce <fd2data>
+  8027ea:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8027f1:	50                   	push   %eax
+  8027f2:	6a 00                	push   $0x0
+  8027f4:	57                   	push   %edi
+  8027f5:	6a 00                	push   $0x0
+  8027f7:	e8 56 e6 ff ff       	call   800e52 <sys_page_map>
+  8027fc:	89 c3                	mov    %eax,%ebx
+  8027fe:	83 c4 20             	add    $0x20,%esp
+  802801:	85 c0                	test   %eax,%eax
+  802803:	0f 88 22 01 00 00    	js     80292b <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  802809:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  80280d:	74 72                	je     802881 <pipe2+0x142>
+  80280f:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  802814:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802817:	e8 d3 fa ff ff       	call   8022ef <pipe_ring>
+  80281c:	83 ec 04             	sub    $0x4,%esp
+  80281f:	68 07 04 00 00       	push   $0x407
+  802824:	01 f0                	add    %esi,%eax
+  802826:	50                   	push   %eax
+  802827:	6a 00                	push   $0x0
+  802829:	e8 e1 e5 ff ff       	call   800e0f <sys_page_alloc>
+  80282e:	89 c3                	mov    %eax,%ebx
+  802830:	83 c4 10             	add    $0x10,%esp
+  802833:	85 c0                	test   %eax,%eax
+  802835:	0f 88 97 00 00 00    	js     8028d2 <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  80283b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80283e:	e8 ac fa ff ff       	call   8022ef <pipe_ring>
+  802843:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  802846:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802849:	e8 a1 fa ff ff       	call   8022ef <pipe_ring>
+  80284e:	83 ec 0c             	sub    $0xc,%esp
+  802851:	68 07 04 00 00       	push   $0x407
+  802856:	53                   	push   %ebx
+  802857:	6a 00                	push   $0x0
+  802859:	01 f0                	add    %esi,%eax
+  80285b:	50                   	push   %eax
+  80285c:	6a 00                	push   $0x0
+  80285e:	e8 ef e5 ff ff       	call   800e52 <sys_page_map>
+  802863:	89 c3                	mov    %eax,%ebx
+  802865:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80286b:	83 c4 20             	add    $0x20,%esp
+  80286e:	85 c0                	test   %eax,%eax
+  802870:	78 60                	js     8028d2 <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  802872:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802878:	75 9a                	jne    802814 <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  80287a:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  802881:	a1 20 40 80 00       	mov    0x804020,%eax
+  802886:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802889:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  80288b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80288e:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  802895:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802898:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  80289a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80289d:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  8028a4:	83 ec 0c             	sub    $0xc,%esp
+  8028a7:	ff 75 e4             	push   -0x1c(%ebp)
+  8028aa:	e8 0f ea ff ff       	call   8012be <fd2num>
+  8028af:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8028b2:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  8028b4:	83 c4 04             	add    $0x4,%esp
+  8028b7:	ff 75 e0             	push   -0x20(%ebp)
+  8028ba:	e8 ff e9 ff ff       	call   8012be <fd2num>
+  8028bf:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8028c2:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  8028c5:	83 c4 10             	add    $0x10,%esp
+  8028c8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028cd:	e9 87 00 00 00       	jmp    802959 <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  8028d2:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  8028d7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8028da:	e8 10 fa ff ff       	call   8022ef <pipe_ring>
+  8028df:	83 ec 08             	sub    $0x8,%esp
+  8028e2:	01 f0                	add    %esi,%eax
+  8028e4:	50                   	push   %eax
+  8028e5:	6a 00                	push   $0x0
+  8028e7:	e8 a8 e5 ff ff       	call   800e94 <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  8028ec:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8028ef:	e8 fb f9 ff ff       	call   8022ef <pipe_ring>
+  8028f4:	83 c4 08             	add    $0x8,%esp
+  8028f7:	01 f0                	add    %esi,%eax
+  8028f9:	50                   	push   %eax
+  8028fa:	6a 00                	push   $0x0
+  8028fc:	e8 93 e5 ff ff       	call   800e94 <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802901:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802907:	83 c4 10             	add    $0x10,%esp
+  80290a:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802910:	75 c5                	jne    8028d7 <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  802912:	83 ec 0c             	sub    $0xc,%esp
+  802915:	ff 75 e0             	push   -0x20(%ebp)
+  802918:	e8 b1 e9 ff ff       	call   8012ce <fd2data>
+  80291d:	83 c4 08             	add    $0x8,%esp
+  802920:	50                   	push   %eax
+  802921:	6a 00                	push   $0x0
+  802923:	e8 6c e5 ff ff       	call   800e94 <sys_page_unmap>
+  802928:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  80292b:	83 ec 08             	sub    $0x8,%esp
+  80292e:	57                   	push   %edi
+  80292f:	6a 00                	push   $0x0
+  802931:	e8 5e e5 ff ff       	call   800e94 <sys_page_unmap>
+  802936:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  802939:	83 ec 08             	sub    $0x8,%esp
+  80293c:	ff 75 e0             	push   -0x20(%ebp)
+  80293f:	6a 00                	push   $0x0
+  802941:	e8 4e e5 ff ff       	call   800e94 <sys_page_unmap>
+  802946:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  802949:	83 ec 08             	sub    $0x8,%esp
+  80294c:	ff 75 e4             	push   -0x1c(%ebp)
+  80294f:	6a 00                	push   $0x0
+  802951:	e8 3e e5 ff ff       	call   800e94 <sys_page_unmap>
+  802956:	83 c4 10             	add    $0x10,%esp
+}
+  802959:	89 d8                	mov    %ebx,%eax
+  80295b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80295e:	5b                   	pop    %ebx
+  80295f:	5e                   	pop    %esi
+  802960:	5f                   	pop    %edi
+  802961:	5d                   	pop    %ebp
+  802962:	c3                   	ret
+
+00802963 <pipe>:
+{
+  802963:	55                   	push   %ebp
+  802964:	89 e5                	mov    %esp,%ebp
+  802966:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  802969:	6a 00                	push   $0x0
+  80296b:	ff 75 08             	push   0x8(%ebp)
+  80296e:	e8 cc fd ff ff       	call   80273f <pipe2>
+}
+  802973:	c9                   	leave
+  802974:	c3                   	ret
+
+00802975 <pipeisclosed>:
+{
+  802975:	55                   	push   %ebp
+  802976:	89 e5                	mov    %esp,%ebp
+  802978:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80297b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80297e:	50                   	push   %eax
+  80297f:	ff 75 08             	push   0x8(%ebp)
+  802982:	e8 b1 e9 ff ff       	call   801338 <fd_lookup>
+  802987:	83 c4 10             	add    $0x10,%esp
+  80298a:	85 c0                	test   %eax,%eax
+  80298c:	78 18                	js     8029a6 <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  80298e:	83 ec 0c             	sub    $0xc,%esp
+  802991:	ff 75 f4             	push   -0xc(%ebp)
+  802994:	e8 35 e9 ff ff       	call   8012ce <fd2data>
+  802999:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  80299b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80299e:	e8 59 fa ff ff       	call   8023fc <_pipeisclosed>
+  8029a3:	83 c4 10             	add    $0x10,%esp
+}
+  8029a6:	c9                   	leave
+  8029a7:	c3                   	ret
+
+008029a8 <pipe_splice>:
+{
+  8029a8:	55                   	push   %ebp
+  8029a9:	89 e5                	mov    %esp,%ebp
+  8029ab:	57                   	push   %edi
+  8029ac:	56                   	push   %esi
+  8029ad:	53                   	push   %ebx
+  8029ae:	83 ec 34             	sub    $0x34,%esp
+  8029b1:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8029b4:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8029b7:	50                   	push   %eax
+  8029b8:	ff 75 08             	push   0x8(%ebp)
+  8029bb:	e8 78 e9 ff ff       	call   801338 <fd_lookup>
+  8029c0:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8029c3:	83 c4 10             	add    $0x10,%esp
+  8029c6:	85 c0                	test   %eax,%eax
+  8029c8:	0f 88 d7 00 00 00    	js     802aa5 <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  8029ce:	83 ec 0c             	sub    $0xc,%esp
+  8029d1:	ff 75 e4             	push   -0x1c(%ebp)
+  8029d4:	e8 f5 e8 ff ff       	call   8012ce <fd2data>
+  8029d9:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  8029db:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8029de:	83 c4 10             	add    $0x10,%esp
+  8029e1:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  8029e7:	39 10                	cmp    %edx,(%eax)
+  8029e9:	0f 85 c1 00 00 00    	jne    802ab0 <pipe_splice+0x108>
+  8029ef:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  8029f3:	0f 84 c0 00 00 00    	je     802ab9 <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  8029f9:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  8029fd:	0f 84 bf 00 00 00    	je     802ac2 <pipe_splice+0x11a>
+  802a03:	89 f7                	mov    %esi,%edi
+  802a05:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  802a0b:	0f 85 ba 00 00 00    	jne    802acb <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802a11:	8d 43 04             	lea    0x4(%ebx),%eax
+  802a14:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802a17:	eb 38                	jmp    802a51 <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802a19:	83 ec 0c             	sub    $0xc,%esp
+  802a1c:	68 00 10 00 00       	push   $0x1000
+  802a21:	89 f1                	mov    %esi,%ecx
+  802a23:	89 da                	mov    %ebx,%edx
+  802a25:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802a28:	e8 34 fa ff ff       	call   802461 <devpipe_write_bulk>
+  802a2d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802a30:	83 c4 10             	add    $0x10,%esp
+  802a33:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802a38:	75 53                	jne    802a8d <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  802a3a:	83 ec 08             	sub    $0x8,%esp
+  802a3d:	56                   	push   %esi
+  802a3e:	6a 00                	push   $0x0
+  802a40:	e8 4f e4 ff ff       	call   800e94 <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  802a45:	83 c7 01             	add    $0x1,%edi
+  802a48:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802a4e:	83 c4 10             	add    $0x10,%esp
+  802a51:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802a54:	74 3a                	je     802a90 <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  802a56:	8b 03                	mov    (%ebx),%eax
+  802a58:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802a5b:	75 bc                	jne    802a19 <pipe_splice+0x71>
+  802a5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a62:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  802a66:	85 c0                	test   %eax,%eax
+  802a68:	74 af                	je     802a19 <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802a6a:	83 ec 04             	sub    $0x4,%esp
+  802a6d:	6a 07                	push   $0x7
+  802a6f:	56                   	push   %esi
+  802a70:	ff 75 d0             	push   -0x30(%ebp)
+  802a73:	e8 f3 e6 ff ff       	call   80116b <sys_chan_wakeup>
+  802a78:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802a7b:	83 c4 10             	add    $0x10,%esp
+  802a7e:	85 c0                	test   %eax,%eax
+  802a80:	79 b8                	jns    802a3a <pipe_splice+0x92>
+  802a82:	b8 01 00 00 00       	mov    $0x1,%eax
+  802a87:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802a8b:	eb 8c                	jmp    802a19 <pipe_splice+0x71>
+  802a8d:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  802a90:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802a94:	75 06                	jne    802a9c <pipe_splice+0xf4>
+  802a96:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802a9a:	78 09                	js     802aa5 <pipe_splice+0xfd>
+  return i * PGSIZE;
+  802a9c:	8b 45 10             	mov    0x10(%ebp),%eax
+  802a9f:	c1 e0 0c             	shl    $0xc,%eax
+  802aa2:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  802aa5:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802aa8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802aab:	5b                   	pop    %ebx
+  802aac:	5e                   	pop    %esi
+  802aad:	5f                   	pop    %edi
+  802aae:	5d                   	pop    %ebp
+  802aaf:	c3                   	ret
+    return -E_INVAL;
+  802ab0:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802ab7:	eb ec                	jmp    802aa5 <pipe_splice+0xfd>
+  802ab9:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802ac0:	eb e3                	jmp    802aa5 <pipe_splice+0xfd>
+  802ac2:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802ac9:	eb da                	jmp    802aa5 <pipe_splice+0xfd>
+  802acb:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802ad2:	eb d1                	jmp    802aa5 <pipe_splice+0xfd>
+
+00802ad4 <pipe_splice_read>:
+{
+  802ad4:	55                   	push   %ebp
+  802ad5:	89 e5                	mov    %esp,%ebp
+  802ad7:	53                   	push   %ebx
+  802ad8:	83 ec 1c             	sub    $0x1c,%esp
+  802adb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802ade:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802ae1:	50                   	push   %eax
+  802ae2:	ff 75 08             	push   0x8(%ebp)
+  802ae5:	e8 4e e8 ff ff       	call   801338 <fd_lookup>
+  802aea:	83 c4 10             	add    $0x10,%esp
+  802aed:	85 c0                	test   %eax,%eax
+  802aef:	78 49                	js     802b3a <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  802af1:	83 ec 0c             	sub    $0xc,%esp
+  802af4:	ff 75 f4             	push   -0xc(%ebp)
+  802af7:	e8 d2 e7 ff ff       	call   8012ce <fd2data>
+  802afc:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802afe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b01:	83 c4 10             	add    $0x10,%esp
+  802b04:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  802b0a:	39 08                	cmp    %ecx,(%eax)
+  802b0c:	75 31                	jne    802b3f <pipe_splice_read+0x6b>
+  802b0e:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  802b12:	74 32                	je     802b46 <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  802b14:	8b 48 08             	mov    0x8(%eax),%ecx
+  802b17:	83 e1 03             	and    $0x3,%ecx
+  802b1a:	83 f9 01             	cmp    $0x1,%ecx
+  802b1d:	74 2e                	je     802b4d <pipe_splice_read+0x79>
+  802b1f:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  802b25:	75 2d                	jne    802b54 <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  802b27:	83 ec 08             	sub    $0x8,%esp
+  802b2a:	53                   	push   %ebx
+  802b2b:	68 00 10 00 00       	push   $0x1000
+  802b30:	89 d9                	mov    %ebx,%ecx
+  802b32:	e8 93 fa ff ff       	call   8025ca <devpipe_read_bulk>
+  802b37:	83 c4 10             	add    $0x10,%esp
+}
+  802b3a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b3d:	c9                   	leave
+  802b3e:	c3                   	ret
+    return -E_INVAL;
+  802b3f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b44:	eb f4                	jmp    802b3a <pipe_splice_read+0x66>
+  802b46:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b4b:	eb ed                	jmp    802b3a <pipe_splice_read+0x66>
+  802b4d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b52:	eb e6                	jmp    802b3a <pipe_splice_read+0x66>
+  802b54:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b59:	eb df                	jmp    802b3a <pipe_splice_read+0x66>
+
+00802b5b <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  802b5b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b60:	c3                   	ret
+
+00802b61 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802b61:	55                   	push   %ebp
+  802b62:	89 e5                	mov    %esp,%ebp
+  802b64:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  802b67:	68 e7 35 80 00       	push   $0x8035e7
+  802b6c:	ff 75 0c             	push   0xc(%ebp)
+  802b6f:	e8 6c de ff ff       	call   8009e0 <strcpy>
+  return 0;
+}
+  802b74:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b79:	c9                   	leave
+  802b7a:	c3                   	ret
+
+00802b7b <devcons_write>:
+{
+  802b7b:	55                   	push   %ebp
+  802b7c:	89 e5                	mov    %esp,%ebp
+  802b7e:	57                   	push   %edi
+  802b7f:	56                   	push   %esi
+  802b80:	53                   	push   %ebx
+  802b81:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  802b87:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  802b8c:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  802b92:	eb 2e                	jmp    802bc2 <devcons_write+0x47>
+    m = n - tot;
+  802b94:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802b97:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  802b99:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802b9e:	39 c3                	cmp    %eax,%ebx
+  802ba0:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  802ba3:	83 ec 04             	sub    $0x4,%esp
+  802ba6:	53                   	push   %ebx
+  802ba7:	89 f0                	mov    %esi,%eax
+  802ba9:	03 45 0c             	add    0xc(%ebp),%eax
+  802bac:	50                   	push   %eax
+  802bad:	57                   	push   %edi
+  802bae:	e8 b3 df ff ff       	call   800b66 <memmove>
+    sys_cputs(buf, m);
+  802bb3:	83 c4 08             	add    $0x8,%esp
+  802bb6:	53                   	push   %ebx
+  802bb7:	57                   	push   %edi
+  802bb8:	e8 53 e1 ff ff       	call   800d10 <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  802bbd:	01 de                	add    %ebx,%esi
+  802bbf:	83 c4 10             	add    $0x10,%esp
+  802bc2:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802bc5:	72 cd                	jb     802b94 <devcons_write+0x19>
+}
+  802bc7:	89 f0                	mov    %esi,%eax
+  802bc9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802bcc:	5b                   	pop    %ebx
+  802bcd:	5e                   	pop    %esi
+  802bce:	5f                   	pop    %edi
+  802bcf:	5d                   	pop    %ebp
+  802bd0:	c3                   	ret
+
+00802bd1 <devcons_read>:
+{
+  802bd1:	55                   	push   %ebp
+  802bd2:	89 e5                	mov    %esp,%ebp
+  802bd4:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  802bd7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bdc:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802be0:	75 07                	jne    802be9 <devcons_read+0x18>
+  802be2:	eb 1f                	jmp    802c03 <devcons_read+0x32>
+    sys_yield();
+  802be4:	e8 c4 e1 ff ff       	call   800dad <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  802be9:	e8 40 e1 ff ff       	call   800d2e <sys_cgetc>
+  802bee:	85 c0                	test   %eax,%eax
+  802bf0:	74 f2                	je     802be4 <devcons_read+0x13>
+  if (c < 0)
+  802bf2:	78 0f                	js     802c03 <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  802bf4:	83 f8 04             	cmp    $0x4,%eax
+  802bf7:	74 0c                	je     802c05 <devcons_read+0x34>
+  *(char*)vbuf = c;
+  802bf9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802bfc:	88 02                	mov    %al,(%edx)
+  return 1;
+  802bfe:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802c03:	c9                   	leave
+  802c04:	c3                   	ret
+    return 0;
+  802c05:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c0a:	eb f7                	jmp    802c03 <devcons_read+0x32>
+
+00802c0c <cputchar>:
+{
+  802c0c:	55                   	push   %ebp
+  802c0d:	89 e5                	mov    %esp,%ebp
+  802c0f:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  802c12:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c15:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  802c18:	6a 01                	push   $0x1
+  802c1a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802c1d:	50                   	push   %eax
+  802c1e:	e8 ed e0 ff ff       	call   800d10 <sys_cputs>
+}
+  802c23:	83 c4 10             	add    $0x10,%esp
+  802c26:	c9                   	leave
+  802c27:	c3                   	ret
+
+00802c28 <getchar>:
+{
+  802c28:	55                   	push   %ebp
+  802c29:	89 e5                	mov    %esp,%ebp
+  802c2b:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  802c2e:	6a 01                	push   $0x1
+  802c30:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802c33:	50                   	push   %eax
+  802c34:	6a 00                	push   $0x0
+  802c36:	e8 a8 e9 ff ff       	call   8015e3 <read>
+  if (r < 0)
+  802c3b:	83 c4 10             	add    $0x10,%esp
+  802c3e:	85 c0                	test   %eax,%eax
+  802c40:	78 06                	js     802c48 <getchar+0x20>
+  if (r < 1)
+  802c42:	74 06                	je     802c4a <getchar+0x22>
+  return c;
+  802c44:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802c48:	c9                   	leave
+  802c49:	c3                   	ret
+    return -E_EOF;
+  802c4a:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802c4f:	eb f7                	jmp    802c48 <getchar+0x20>
+
+00802c51 <iscons>:
+{
+  802c51:	55                   	push   %ebp
+  802c52:	89 e5                	mov    %esp,%ebp
+  802c54:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802c57:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802c5a:	50                   	push   %eax
+  802c5b:	ff 75 08             	push   0x8(%ebp)
+  802c5e:	e8 d5 e6 ff ff       	call   801338 <fd_lookup>
+  802c63:	83 c4 10             	add    $0x10,%esp
+  802c66:	85 c0                	test   %eax,%eax
+  802c68:	78 11                	js     802c7b <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  802c6a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c6d:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802c73:	39 10                	cmp    %edx,(%eax)
+  802c75:	0f 94 c0             	sete   %al
+  802c78:	0f b6 c0             	movzbl %al,%eax
+}
+  802c7b:	c9                   	leave
+  802c7c:	c3                   	ret
+
+00802c7d <opencons>:
+{
+  802c7d:	55                   	push   %ebp
+  802c7e:	89 e5                	mov    %esp,%ebp
+  802c80:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  802c83:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802c86:	50                   	push   %eax
+  802c87:	e8 56 e6 ff ff       	call   8012e2 <fd_alloc>
+  802c8c:	83 c4 10             	add    $0x10,%esp
+  802c8f:	85 c0                	test   %eax,%eax
+  802c91:	78 3a                	js     802ccd <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802c93:	83 ec 04             	sub    $0x4,%esp
+  802c96:	68 07 04 00 00       	push   $0x407
+  802c9b:	ff 75 f4             	push   -0xc(%ebp)
+  802c9e:	6a 00                	push   $0x0
+  802ca0:	e8 6a e1 ff ff       	call   800e0f <sys_page_alloc>
+  802ca5:	83 c4 10             	add    $0x10,%esp
+  802ca8:	85 c0                	test   %eax,%eax
+  802caa:	78 21                	js     802ccd <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  802cac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802caf:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802cb5:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  802cb7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802cba:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  802cc1:	83 ec 0c             	sub    $0xc,%esp
+  802cc4:	50                   	push   %eax
+  802cc5:	e8 f4 e5 ff ff       	call   8012be <fd2num>
+  802cca:	83 c4 10             	add    $0x10,%esp
+}
+  802ccd:	c9                   	leave
+  802cce:	c3                   	ret
+
+00802ccf <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  802ccf:	55                   	push   %ebp
+  802cd0:	89 e5                	mov    %esp,%ebp
+  802cd2:	57                   	push   %edi
+  802cd3:	56                   	push   %esi
+  802cd4:	53                   	push   %ebx
+  802cd5:	83 ec 14             	sub    $0x14,%esp
+  802cd8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802cdb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802cde:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802ce1:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  802ce4:	85 c0                	test   %eax,%eax
+  802ce6:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802ceb:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  802cee:	ff 33                	push   (%ebx)
+  802cf0:	50                   	push   %eax
+  802cf1:	e8 f1 e3 ff ff       	call   8010e7 <sys_ipc_recv>
+  802cf6:	83 c4 10             	add    $0x10,%esp
+  802cf9:	85 c0                	test   %eax,%eax
+  802cfb:	78 39                	js     802d36 <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  802cfd:	85 ff                	test   %edi,%edi
+  802cff:	74 0a                	je     802d0b <ipc_recv_pages+0x3c>
+  802d01:	a1 64 57 80 00       	mov    0x805764,%eax
+  802d06:	8b 40 7c             	mov    0x7c(%eax),%eax
+  802d09:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  802d0b:	85 f6                	test   %esi,%esi
+  802d0d:	74 0d                	je     802d1c <ipc_recv_pages+0x4d>
+  802d0f:	a1 64 57 80 00       	mov    0x805764,%eax
+  802d14:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  802d1a:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  802d1c:	a1 64 57 80 00       	mov    0x805764,%eax
+  802d21:	8b 40 74             	mov    0x74(%eax),%eax
+  802d24:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  802d26:	a1 64 57 80 00       	mov    0x805764,%eax
+  802d2b:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  802d2e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d31:	5b                   	pop    %ebx
+  802d32:	5e                   	pop    %esi
+  802d33:	5f                   	pop    %edi
+  802d34:	5d                   	pop    %ebp
+  802d35:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  802d36:	85 ff                	test   %edi,%edi
+  802d38:	74 06                	je     802d40 <ipc_recv_pages+0x71>
+  802d3a:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  802d40:	85 f6                	test   %esi,%esi
+  802d42:	74 06                	je     802d4a <ipc_recv_pages+0x7b>
+  802d44:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  802d4a:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  802d50:	eb dc                	jmp    802d2e <ipc_recv_pages+0x5f>
+
+00802d52 <ipc_recv>:
+{
+  802d52:	55                   	push   %ebp
+  802d53:	89 e5                	mov    %esp,%ebp
+  802d55:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  802d58:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  802d5f:	ff 75 10             	push   0x10(%ebp)
+  802d62:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802d65:	50                   	push   %eax
+  802d66:	ff 75 0c             	push   0xc(%ebp)
+  802d69:	ff 75 08             	push   0x8(%ebp)
+  802d6c:	e8 5e ff ff ff       	call   802ccf <ipc_recv_pages>
+}
+  802d71:	c9                   	leave
+  802d72:	c3                   	ret
+
+00802d73 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  802d73:	55                   	push   %ebp
+  802d74:	89 e5                	mov    %esp,%ebp
+  802d76:	57                   	push   %edi
+  802d77:	56                   	push   %esi
+  802d78:	53                   	push   %ebx
+  802d79:	83 ec 0c             	sub    $0xc,%esp
+  802d7c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802d7f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802d82:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  802d85:	89 c3                	mov    %eax,%ebx
+  802d87:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  802d8d:	85 c0                	test   %eax,%eax
+  802d8f:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802d94:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  802d97:	83 ec 0c             	sub    $0xc,%esp
+  802d9a:	ff 75 14             	push   0x14(%ebp)
+  802d9d:	ff 75 18             	push   0x18(%ebp)
+  802da0:	53                   	push   %ebx
+  802da1:	56                   	push   %esi
+  802da2:	57                   	push   %edi
+  802da3:	e8 1e e3 ff ff       	call   8010c6 <sys_ipc_try_send>
+  802da8:	83 c4 20             	add    $0x20,%esp
+  802dab:	85 c0                	test   %eax,%eax
+  802dad:	79 1e                	jns    802dcd <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  802daf:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802db2:	75 07                	jne    802dbb <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  802db4:	e8 f4 df ff ff       	call   800dad <sys_yield>
+  802db9:	eb dc                	jmp    802d97 <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  802dbb:	50                   	push   %eax
+  802dbc:	68 f3 35 80 00       	push   $0x8035f3
+  802dc1:	6a 5c                	push   $0x5c
+  802dc3:	68 00 36 80 00       	push   $0x803600
+  802dc8:	e8 4a d5 ff ff       	call   800317 <_panic>
+  }
+}
+  802dcd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802dd0:	5b                   	pop    %ebx
+  802dd1:	5e                   	pop    %esi
+  802dd2:	5f                   	pop    %edi
+  802dd3:	5d                   	pop    %ebp
+  802dd4:	c3                   	ret
+
+00802dd5 <ipc_send>:
+{
+  802dd5:	55                   	push   %ebp
+  802dd6:	89 e5                	mov    %esp,%ebp
+  802dd8:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  802ddb:	ff 75 14             	push   0x14(%ebp)
+  802dde:	6a 01                	push   $0x1
+  802de0:	ff 75 10             	push   0x10(%ebp)
+  802de3:	ff 75 0c             	push   0xc(%ebp)
+  802de6:	ff 75 08             	push   0x8(%ebp)
+  802de9:	e8 85 ff ff ff       	call   802d73 <ipc_send_pages>
+}
+  802dee:	83 c4 20             	add    $0x20,%esp
+  802df1:	c9                   	leave
+  802df2:	c3                   	ret
+
+00802df3 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802df3:	55                   	push   %ebp
+  802df4:	89 e5                	mov    %esp,%ebp
+  802df6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  802df9:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  802dfe:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802e01:	c1 e0 04             	shl    $0x4,%eax
+  802e04:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802e09:	8b 40 50             	mov    0x50(%eax),%eax
+  802e0c:	39 c8                	cmp    %ecx,%eax
+  802e0e:	74 12                	je     802e22 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  802e10:	83 c2 01             	add    $0x1,%edx
+  802e13:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802e19:	75 e3                	jne    802dfe <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  802e1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e20:	eb 0e                	jmp    802e30 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  802e22:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802e25:	c1 e0 04             	shl    $0x4,%eax
+  802e28:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802e2d:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802e30:	5d                   	pop    %ebp
+  802e31:	c3                   	ret
+
+00802e32 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802e32:	55                   	push   %ebp
+  802e33:	89 e5                	mov    %esp,%ebp
+  802e35:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802e38:	89 c2                	mov    %eax,%edx
+  802e3a:	c1 ea 16             	shr    $0x16,%edx
+  802e3d:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  802e44:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802e49:	f6 c1 01             	test   $0x1,%cl
+  802e4c:	74 1c                	je     802e6a <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  802e4e:	c1 e8 0c             	shr    $0xc,%eax
+  802e51:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  802e58:	a8 01                	test   $0x1,%al
+  802e5a:	74 0e                	je     802e6a <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  802e5c:	c1 e8 0c             	shr    $0xc,%eax
+  802e5f:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802e66:	ef 
+  802e67:	0f b7 d2             	movzwl %dx,%edx
+}
+  802e6a:	89 d0                	mov    %edx,%eax
+  802e6c:	5d                   	pop    %ebp
+  802e6d:	c3                   	ret
+
+00802e6e <udivmod>:
+  802e6e:	55                   	push   %ebp
+  802e6f:	57                   	push   %edi
+  802e70:	56                   	push   %esi
+  802e71:	53                   	push   %ebx
+  802e72:	83 ec 14             	sub    $0x14,%esp
+  802e75:	8b 74 24 28          	mov    0x28(%esp),%esi
+  802e79:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  802e7d:	89 fb                	mov    %edi,%ebx
+  802e7f:	09 f3                	or     %esi,%ebx
+  802e81:	0f 84 88 00 00 00    	je     802f0f <udivmod+0xa1>
+  802e87:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802e8c:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802e93:	00 
+  802e94:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802e9b:	00 
+  802e9c:	89 cd                	mov    %ecx,%ebp
+  802e9e:	89 34 24             	mov    %esi,(%esp)
+  802ea1:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802ea5:	eb 08                	jmp    802eaf <udivmod+0x41>
+  802ea7:	83 ed 01             	sub    $0x1,%ebp
+  802eaa:	83 fd ff             	cmp    $0xffffffff,%ebp
+  802ead:	74 6c                	je     802f1b <udivmod+0xad>
+  802eaf:	89 c3                	mov    %eax,%ebx
+  802eb1:	89 d6                	mov    %edx,%esi
+  802eb3:	89 e9                	mov    %ebp,%ecx
+  802eb5:	0f ad f3             	shrd   %cl,%esi,%ebx
+  802eb8:	d3 ee                	shr    %cl,%esi
+  802eba:	f6 c1 20             	test   $0x20,%cl
+  802ebd:	74 04                	je     802ec3 <udivmod+0x55>
+  802ebf:	89 f3                	mov    %esi,%ebx
+  802ec1:	31 f6                	xor    %esi,%esi
+  802ec3:	8b 3c 24             	mov    (%esp),%edi
+  802ec6:	39 fb                	cmp    %edi,%ebx
+  802ec8:	89 f7                	mov    %esi,%edi
+  802eca:	8b 1c 24             	mov    (%esp),%ebx
+  802ecd:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802ed1:	19 f7                	sbb    %esi,%edi
+  802ed3:	72 d2                	jb     802ea7 <udivmod+0x39>
+  802ed5:	89 f7                	mov    %esi,%edi
+  802ed7:	89 de                	mov    %ebx,%esi
+  802ed9:	89 e9                	mov    %ebp,%ecx
+  802edb:	0f a5 f7             	shld   %cl,%esi,%edi
+  802ede:	d3 e6                	shl    %cl,%esi
+  802ee0:	f6 c1 20             	test   $0x20,%cl
+  802ee3:	74 04                	je     802ee9 <udivmod+0x7b>
+  802ee5:	89 f7                	mov    %esi,%edi
+  802ee7:	31 f6                	xor    %esi,%esi
+  802ee9:	29 f0                	sub    %esi,%eax
+  802eeb:	19 fa                	sbb    %edi,%edx
+  802eed:	be 01 00 00 00       	mov    $0x1,%esi
+  802ef2:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ef7:	0f a5 f7             	shld   %cl,%esi,%edi
+  802efa:	d3 e6                	shl    %cl,%esi
+  802efc:	f6 c1 20             	test   $0x20,%cl
+  802eff:	74 04                	je     802f05 <udivmod+0x97>
+  802f01:	89 f7                	mov    %esi,%edi
+  802f03:	31 f6                	xor    %esi,%esi
+  802f05:	09 74 24 08          	or     %esi,0x8(%esp)
+  802f09:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802f0d:	eb 98                	jmp    802ea7 <udivmod+0x39>
+  802f0f:	89 f0                	mov    %esi,%eax
+  802f11:	89 fa                	mov    %edi,%edx
+  802f13:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802f17:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802f1b:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802f1f:	89 01                	mov    %eax,(%ecx)
+  802f21:	89 51 04             	mov    %edx,0x4(%ecx)
+  802f24:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802f28:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802f2c:	83 c4 14             	add    $0x14,%esp
+  802f2f:	5b                   	pop    %ebx
+  802f30:	5e                   	pop    %esi
+  802f31:	5f                   	pop    %edi
+  802f32:	5d                   	pop    %ebp
+  802f33:	c3                   	ret
+
+00802f34 <__udivdi3>:
+  802f34:	83 ec 18             	sub    $0x18,%esp
+  802f37:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802f3b:	50                   	push   %eax
+  802f3c:	ff 74 24 2c          	push   0x2c(%esp)
+  802f40:	ff 74 24 2c          	push   0x2c(%esp)
+  802f44:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802f48:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802f4c:	e8 1d ff ff ff       	call   802e6e <udivmod>
+  802f51:	83 c4 24             	add    $0x24,%esp
+  802f54:	c3                   	ret
+
+00802f55 <__umoddi3>:
+  802f55:	83 ec 18             	sub    $0x18,%esp
+  802f58:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802f5c:	50                   	push   %eax
+  802f5d:	ff 74 24 2c          	push   0x2c(%esp)
+  802f61:	ff 74 24 2c          	push   0x2c(%esp)
+  802f65:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802f69:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802f6d:	e8 fc fe ff ff       	call   802e6e <udivmod>
+  802f72:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802f76:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802f7a:	83 c4 24             	add    $0x24,%esp
+  802f7d:	c3                   	ret
+
+00802f7e <__divdi3>:
+  802f7e:	56                   	push   %esi
+  802f7f:	53                   	push   %ebx
+  802f80:	83 ec 14             	sub    $0x14,%esp
+  802f83:	8b 44 24 20          	mov    0x20(%esp),%eax
+  802f87:	8b 54 24 24          	mov    0x24(%esp),%edx
+  802f8b:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  802f8f:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  802f93:	85 d2                	test   %edx,%edx
+  802f95:	78 18                	js     802faf <__divdi3+0x31>
+  802f97:	85 db                	test   %ebx,%ebx
+  802f99:	78 3e                	js     802fd9 <__divdi3+0x5b>
+  802f9b:	83 ec 04             	sub    $0x4,%esp
+  802f9e:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802fa2:	56                   	push   %esi
+  802fa3:	53                   	push   %ebx
+  802fa4:	51                   	push   %ecx
+  802fa5:	e8 c4 fe ff ff       	call   802e6e <udivmod>
+  802faa:	83 c4 10             	add    $0x10,%esp
+  802fad:	eb 24                	jmp    802fd3 <__divdi3+0x55>
+  802faf:	f7 d8                	neg    %eax
+  802fb1:	83 d2 00             	adc    $0x0,%edx
+  802fb4:	f7 da                	neg    %edx
+  802fb6:	85 db                	test   %ebx,%ebx
+  802fb8:	78 3a                	js     802ff4 <__divdi3+0x76>
+  802fba:	83 ec 04             	sub    $0x4,%esp
+  802fbd:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802fc1:	56                   	push   %esi
+  802fc2:	53                   	push   %ebx
+  802fc3:	51                   	push   %ecx
+  802fc4:	e8 a5 fe ff ff       	call   802e6e <udivmod>
+  802fc9:	83 c4 10             	add    $0x10,%esp
+  802fcc:	f7 d8                	neg    %eax
+  802fce:	83 d2 00             	adc    $0x0,%edx
+  802fd1:	f7 da                	neg    %edx
+  802fd3:	83 c4 14             	add    $0x14,%esp
+  802fd6:	5b                   	pop    %ebx
+  802fd7:	5e                   	pop    %esi
+  802fd8:	c3                   	ret
+  802fd9:	83 ec 04             	sub    $0x4,%esp
+  802fdc:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802fe0:	56                   	push   %esi
+  802fe1:	f7 d9                	neg    %ecx
+  802fe3:	83 d3 00             	adc    $0x0,%ebx
+  802fe6:	f7 db                	neg    %ebx
+  802fe8:	53                   	push   %ebx
+  802fe9:	51                   	push   %ecx
+  802fea:	e8 7f fe ff ff       	call   802e6e <udivmod>
+  802fef:	83 c4 10             	add    $0x10,%esp
+  802ff2:	eb d8                	jmp    802fcc <__divdi3+0x4e>
+  802ff4:	83 ec 04             	sub    $0x4,%esp
+  802ff7:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802ffb:	56                   	push   %esi
+  802ffc:	f7 d9                	neg    %ecx
+  802ffe:	83 d3 00             	adc    $0x0,%ebx
+  803001:	f7 db                	neg    %ebx
+  803003:	53                   	push   %ebx
+  803004:	51                   	push   %ecx
+  803005:	e8 64 fe ff ff       	call   802e6e <udivmod>
+  80300a:	83 c4 10             	add    $0x10,%esp
+  80300d:	eb c4                	jmp    802fd3 <__divdi3+0x55>
+
+0080300f <__moddi3>:
+  80300f:	55                   	push   %ebp
+  803010:	57                   	push   %edi
+  803011:	56                   	push   %esi
+  803012:	53                   	push   %ebx
+  803013:	83 ec 24             	sub    $0x24,%esp
+  803016:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80301a:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80301e:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  803022:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  803026:	85 d2                	test   %edx,%edx
+  803028:	78 3b                	js     803065 <__moddi3+0x56>
+  80302a:	83 ec 04             	sub    $0x4,%esp
+  80302d:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803031:	56                   	push   %esi
+  803032:	89 ce                	mov    %ecx,%esi
+  803034:	f7 de                	neg    %esi
+  803036:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80303a:	89 de                	mov    %ebx,%esi
+  80303c:	83 d6 00             	adc    $0x0,%esi
+  80303f:	f7 de                	neg    %esi
+  803041:	89 74 24 14          	mov    %esi,0x14(%esp)
+  803045:	8b 74 24 08          	mov    0x8(%esp),%esi
+  803049:	0f 48 f1             	cmovs  %ecx,%esi
+  80304c:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  803051:	53                   	push   %ebx
+  803052:	56                   	push   %esi
+  803053:	e8 16 fe ff ff       	call   802e6e <udivmod>
+  803058:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80305c:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803060:	83 c4 10             	add    $0x10,%esp
+  803063:	eb 47                	jmp    8030ac <__moddi3+0x9d>
+  803065:	f7 d8                	neg    %eax
+  803067:	83 d2 00             	adc    $0x0,%edx
+  80306a:	f7 da                	neg    %edx
+  80306c:	83 ec 04             	sub    $0x4,%esp
+  80306f:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803073:	56                   	push   %esi
+  803074:	89 cf                	mov    %ecx,%edi
+  803076:	f7 df                	neg    %edi
+  803078:	89 de                	mov    %ebx,%esi
+  80307a:	83 d6 00             	adc    $0x0,%esi
+  80307d:	f7 de                	neg    %esi
+  80307f:	0f 49 cf             	cmovns %edi,%ecx
+  803082:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  803086:	0f 49 de             	cmovns %esi,%ebx
+  803089:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  80308d:	ff 74 24 0c          	push   0xc(%esp)
+  803091:	ff 74 24 0c          	push   0xc(%esp)
+  803095:	e8 d4 fd ff ff       	call   802e6e <udivmod>
+  80309a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80309e:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8030a2:	f7 d8                	neg    %eax
+  8030a4:	83 d2 00             	adc    $0x0,%edx
+  8030a7:	f7 da                	neg    %edx
+  8030a9:	83 c4 10             	add    $0x10,%esp
+  8030ac:	83 c4 24             	add    $0x24,%esp
+  8030af:	5b                   	pop    %ebx
+  8030b0:	5e                   	pop    %esi
+  8030b1:	5f                   	pop    %edi
+  8030b2:	5d                   	pop    %ebp
+  8030b3:	c3                   	ret
@@ -0,0 +1,6637 @@
+
+obj/user/diskbench.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 eb 02 00 00       	call   80031c <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+          what, size / 1024, ms, size / 1024 * 1000 / MAX(ms, 1));
+}
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 1c             	sub    $0x1c,%esp
+  unsigned start;
+  off_t size, off;
+  int fd, r;
+
+  binaryname = "diskbench";
+  80003c:	c7 05 00 40 80 00 40 	movl   $0x803140,0x804000
+  800043:	31 80 00 
+  size = 1024 * 1024;
+  800046:	bb 00 00 10 00       	mov    $0x100000,%ebx
+  if (argc > 1)
+  80004b:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+  80004f:	7f 61                	jg     8000b2 <umain+0x7f>
+    size = ROUNDUP(strtol(argv[1], 0, 0) * 1024, BLKSIZE);
+  memset(buf, 'd', sizeof(buf));
+  800051:	83 ec 04             	sub    $0x4,%esp
+  800054:	68 00 10 00 00       	push   $0x1000
+  800059:	6a 64                	push   $0x64
+  80005b:	68 00 50 80 00       	push   $0x805000
+  800060:	e8 3e 0b 00 00       	call   800ba3 <memset>
+
+  // Allocate the blocks first, so the timed write only moves data.
+  if ((fd = open(NAME, O_RDWR | O_CREAT | O_TRUNC)) < 0)
+  800065:	83 c4 08             	add    $0x8,%esp
+  800068:	68 02 03 00 00       	push   $0x302
+  80006d:	68 4a 31 80 00       	push   $0x80314a
+  800072:	e8 09 1e 00 00       	call   801e80 <open>
+  800077:	89 c6                	mov    %eax,%esi
+  800079:	83 c4 10             	add    $0x10,%esp
+  80007c:	85 c0                	test   %eax,%eax
+  80007e:	78 5d                	js     8000dd <umain+0xaa>
+    panic("open %s: %e", NAME, fd);
+  for (off = 0; off < size; off += BLKSIZE)
+  800080:	bf 00 00 00 00       	mov    $0x0,%edi
+  800085:	39 fb                	cmp    %edi,%ebx
+  800087:	0f 8e 84 00 00 00    	jle    800111 <umain+0xde>
+    if ((r = write(fd, buf, BLKSIZE)) != BLKSIZE)
+  80008d:	83 ec 04             	sub    $0x4,%esp
+  800090:	68 00 10 00 00       	push   $0x1000
+  800095:	68 00 50 80 00       	push   $0x805000
+  80009a:	56                   	push   %esi
+  80009b:	e8 83 16 00 00       	call   801723 <write>
+  8000a0:	83 c4 10             	add    $0x10,%esp
+  8000a3:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8000a8:	75 4d                	jne    8000f7 <umain+0xc4>
+  for (off = 0; off < size; off += BLKSIZE)
+  8000aa:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  8000b0:	eb d3                	jmp    800085 <umain+0x52>
+    size = ROUNDUP(strtol(argv[1], 0, 0) * 1024, BLKSIZE);
+  8000b2:	83 ec 04             	sub    $0x4,%esp
+  8000b5:	6a 00                	push   $0x0
+  8000b7:	6a 00                	push   $0x0
+  8000b9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8000bc:	ff 70 04             	push   0x4(%eax)
+  8000bf:	e8 e2 0b 00 00       	call   800ca6 <strtol>
+  8000c4:	c1 e0 0a             	shl    $0xa,%eax
+  8000c7:	89 c3                	mov    %eax,%ebx
+  8000c9:	81 c3 ff 0f 00 00    	add    $0xfff,%ebx
+  8000cf:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  8000d5:	83 c4 10             	add    $0x10,%esp
+  8000d8:	e9 74 ff ff ff       	jmp    800051 <umain+0x1e>
+    panic("open %s: %e", NAME, fd);
+  8000dd:	83 ec 0c             	sub    $0xc,%esp
+  8000e0:	50                   	push   %eax
+  8000e1:	68 4a 31 80 00       	push   $0x80314a
+  8000e6:	68 5a 31 80 00       	push   $0x80315a
+  8000eb:	6a 24                	push   $0x24
+  8000ed:	68 66 31 80 00       	push   $0x803166
+  8000f2:	e8 92 02 00 00       	call   800389 <_panic>
+      panic("write %s: %e", NAME, r);
+  8000f7:	83 ec 0c             	sub    $0xc,%esp
+  8000fa:	50                   	push   %eax
+  8000fb:	68 4a 31 80 00       	push   $0x80314a
+  800100:	68 77 31 80 00       	push   $0x803177
+  800105:	6a 27                	push   $0x27
+  800107:	68 66 31 80 00       	push   $0x803166
+  80010c:	e8 78 02 00 00       	call   800389 <_panic>
+  if ((r = sync()) < 0)
+  800111:	e8 52 20 00 00       	call   802168 <sync>
+  800116:	85 c0                	test   %eax,%eax
+  800118:	78 48                	js     800162 <umain+0x12f>
+    panic("sync: %e", r);
+
+  start = sys_time_msec();
+  80011a:	e8 7c 10 00 00       	call   80119b <sys_time_msec>
+  80011f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if ((r = seek(fd, 0)) < 0)
+  800122:	83 ec 08             	sub    $0x8,%esp
+  800125:	6a 00                	push   $0x0
+  800127:	56                   	push   %esi
+  800128:	e8 78 16 00 00       	call   8017a5 <seek>
+  80012d:	83 c4 10             	add    $0x10,%esp
+  800130:	85 c0                	test   %eax,%eax
+  800132:	78 40                	js     800174 <umain+0x141>
+    panic("seek %s: %e", NAME, r);
+  for (off = 0; off < size; off += BLKSIZE)
+  800134:	bf 00 00 00 00       	mov    $0x0,%edi
+  800139:	39 fb                	cmp    %edi,%ebx
+  80013b:	7e 6b                	jle    8001a8 <umain+0x175>
+    if ((r = write(fd, buf, BLKSIZE)) != BLKSIZE)
+  80013d:	83 ec 04             	sub    $0x4,%esp
+  800140:	68 00 10 00 00       	push   $0x1000
+  800145:	68 00 50 80 00       	push   $0x805000
+  80014a:	56                   	push   %esi
+  80014b:	e8 d3 15 00 00       	call   801723 <write>
+  800150:	83 c4 10             	add    $0x10,%esp
+  800153:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800158:	75 34                	jne    80018e <umain+0x15b>
+  for (off = 0; off < size; off += BLKSIZE)
+  80015a:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  800160:	eb d7                	jmp    800139 <umain+0x106>
+    panic("sync: %e", r);
+  800162:	50                   	push   %eax
+  800163:	68 84 31 80 00       	push   $0x803184
+  800168:	6a 29                	push   $0x29
+  80016a:	68 66 31 80 00       	push   $0x803166
+  80016f:	e8 15 02 00 00       	call   800389 <_panic>
+    panic("seek %s: %e", NAME, r);
+  800174:	83 ec 0c             	sub    $0xc,%esp
+  800177:	50                   	push   %eax
+  800178:	68 4a 31 80 00       	push   $0x80314a
+  80017d:	68 8d 31 80 00       	push   $0x80318d
+  800182:	6a 2d                	push   $0x2d
+  800184:	68 66 31 80 00       	push   $0x803166
+  800189:	e8 fb 01 00 00       	call   800389 <_panic>
+      panic("write %s: %e", NAME, r);
+  80018e:	83 ec 0c             	sub    $0xc,%esp
+  800191:	50                   	push   %eax
+  800192:	68 4a 31 80 00       	push   $0x80314a
+  800197:	68 77 31 80 00       	push   $0x803177
+  80019c:	6a 30                	push   $0x30
+  80019e:	68 66 31 80 00       	push   $0x803166
+  8001a3:	e8 e1 01 00 00       	call   800389 <_panic>
+  if ((r = sync()) < 0)
+  8001a8:	e8 bb 1f 00 00       	call   802168 <sync>
+  8001ad:	85 c0                	test   %eax,%eax
+  8001af:	78 7d                	js     80022e <umain+0x1fb>
+    panic("sync: %e", r);
+  report("write", size, sys_time_msec() - start);
+  8001b1:	e8 e5 0f 00 00       	call   80119b <sys_time_msec>
+  8001b6:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8001b9:	29 d0                	sub    %edx,%eax
+  8001bb:	89 c1                	mov    %eax,%ecx
+          what, size / 1024, ms, size / 1024 * 1000 / MAX(ms, 1));
+  8001bd:	8d 83 ff 03 00 00    	lea    0x3ff(%ebx),%eax
+  8001c3:	85 db                	test   %ebx,%ebx
+  8001c5:	0f 49 c3             	cmovns %ebx,%eax
+  8001c8:	c1 f8 0a             	sar    $0xa,%eax
+  8001cb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8001ce:	69 d0 e8 03 00 00    	imul   $0x3e8,%eax,%edx
+  8001d4:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  cprintf("diskbench: %-5s %6d KB in %5d ms = %6d KB/s\n",
+  8001d7:	83 ec 0c             	sub    $0xc,%esp
+          what, size / 1024, ms, size / 1024 * 1000 / MAX(ms, 1));
+  8001da:	85 c9                	test   %ecx,%ecx
+  8001dc:	bf 01 00 00 00       	mov    $0x1,%edi
+  8001e1:	0f 45 f9             	cmovne %ecx,%edi
+  cprintf("diskbench: %-5s %6d KB in %5d ms = %6d KB/s\n",
+  8001e4:	89 d0                	mov    %edx,%eax
+  8001e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001eb:	f7 f7                	div    %edi
+  8001ed:	50                   	push   %eax
+  8001ee:	51                   	push   %ecx
+  8001ef:	ff 75 e4             	push   -0x1c(%ebp)
+  8001f2:	68 99 31 80 00       	push   $0x803199
+  8001f7:	68 c4 31 80 00       	push   $0x8031c4
+  8001fc:	e8 63 02 00 00       	call   800464 <cprintf>
+
+  if ((r = fs_dropcache()) < 0)
+  800201:	83 c4 20             	add    $0x20,%esp
+  800204:	e8 c2 1f 00 00       	call   8021cb <fs_dropcache>
+  800209:	85 c0                	test   %eax,%eax
+  80020b:	78 33                	js     800240 <umain+0x20d>
+    panic("fs_dropcache: %e", r);
+  start = sys_time_msec();
+  80020d:	e8 89 0f 00 00       	call   80119b <sys_time_msec>
+  800212:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if ((r = seek(fd, 0)) < 0)
+  800215:	83 ec 08             	sub    $0x8,%esp
+  800218:	6a 00                	push   $0x0
+  80021a:	56                   	push   %esi
+  80021b:	e8 85 15 00 00       	call   8017a5 <seek>
+  800220:	83 c4 10             	add    $0x10,%esp
+  800223:	85 c0                	test   %eax,%eax
+  800225:	78 2b                	js     800252 <umain+0x21f>
+    panic("seek %s: %e", NAME, r);
+  for (off = 0; off < size; off += BLKSIZE)
+  800227:	bf 00 00 00 00       	mov    $0x0,%edi
+  80022c:	eb 44                	jmp    800272 <umain+0x23f>
+    panic("sync: %e", r);
+  80022e:	50                   	push   %eax
+  80022f:	68 84 31 80 00       	push   $0x803184
+  800234:	6a 32                	push   $0x32
+  800236:	68 66 31 80 00       	push   $0x803166
+  80023b:	e8 49 01 00 00       	call   800389 <_panic>
+    panic("fs_dropcache: %e", r);
+  800240:	50                   	push   %eax
+  800241:	68 9f 31 80 00       	push   $0x80319f
+  800246:	6a 36                	push   $0x36
+  800248:	68 66 31 80 00       	push   $0x803166
+  80024d:	e8 37 01 00 00       	call   800389 <_panic>
+    panic("seek %s: %e", NAME, r);
+  800252:	83 ec 0c             	sub    $0xc,%esp
+  800255:	50                   	push   %eax
+  800256:	68 4a 31 80 00       	push   $0x80314a
+  80025b:	68 8d 31 80 00       	push   $0x80318d
+  800260:	6a 39                	push   $0x39
+  800262:	68 66 31 80 00       	push   $0x803166
+  800267:	e8 1d 01 00 00       	call   800389 <_panic>
+  for (off = 0; off < size; off += BLKSIZE)
+  80026c:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  800272:	39 fb                	cmp    %edi,%ebx
+  800274:	7e 37                	jle    8002ad <umain+0x27a>
+    if ((r = readn(fd, buf, BLKSIZE)) != BLKSIZE)
+  800276:	83 ec 04             	sub    $0x4,%esp
+  800279:	68 00 10 00 00       	push   $0x1000
+  80027e:	68 00 50 80 00       	push   $0x805000
+  800283:	56                   	push   %esi
+  800284:	e8 53 14 00 00       	call   8016dc <readn>
+  800289:	83 c4 10             	add    $0x10,%esp
+  80028c:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800291:	74 d9                	je     80026c <umain+0x239>
+      panic("read %s: %e", NAME, r);
+  800293:	83 ec 0c             	sub    $0xc,%esp
+  800296:	50                   	push   %eax
+  800297:	68 4a 31 80 00       	push   $0x80314a
+  80029c:	68 b0 31 80 00       	push   $0x8031b0
+  8002a1:	6a 3c                	push   $0x3c
+  8002a3:	68 66 31 80 00       	push   $0x803166
+  8002a8:	e8 dc 00 00 00       	call   800389 <_panic>
+  report("read", size, sys_time_msec() - start);
+  8002ad:	e8 e9 0e 00 00       	call   80119b <sys_time_msec>
+  8002b2:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8002b5:	29 c8                	sub    %ecx,%eax
+  8002b7:	89 c1                	mov    %eax,%ecx
+  cprintf("diskbench: %-5s %6d KB in %5d ms = %6d KB/s\n",
+  8002b9:	83 ec 0c             	sub    $0xc,%esp
+          what, size / 1024, ms, size / 1024 * 1000 / MAX(ms, 1));
+  8002bc:	85 c0                	test   %eax,%eax
+  8002be:	bb 01 00 00 00       	mov    $0x1,%ebx
+  8002c3:	0f 45 d8             	cmovne %eax,%ebx
+  cprintf("diskbench: %-5s %6d KB in %5d ms = %6d KB/s\n",
+  8002c6:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8002c9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002ce:	f7 f3                	div    %ebx
+  8002d0:	50                   	push   %eax
+  8002d1:	51                   	push   %ecx
+  8002d2:	ff 75 e4             	push   -0x1c(%ebp)
+  8002d5:	68 bc 31 80 00       	push   $0x8031bc
+  8002da:	68 c4 31 80 00       	push   $0x8031c4
+  8002df:	e8 80 01 00 00       	call   800464 <cprintf>
+  close(fd);
+  8002e4:	83 c4 14             	add    $0x14,%esp
+  8002e7:	56                   	push   %esi
+  8002e8:	e8 e0 11 00 00       	call   8014cd <close>
+
+  // Give the space back (there is no remove).
+  if ((fd = open(NAME, O_RDWR | O_TRUNC)) >= 0)
+  8002ed:	83 c4 08             	add    $0x8,%esp
+  8002f0:	68 02 02 00 00       	push   $0x202
+  8002f5:	68 4a 31 80 00       	push   $0x80314a
+  8002fa:	e8 81 1b 00 00       	call   801e80 <open>
+  8002ff:	83 c4 10             	add    $0x10,%esp
+  800302:	85 c0                	test   %eax,%eax
+  800304:	79 08                	jns    80030e <umain+0x2db>
+    close(fd);
+}
+  800306:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800309:	5b                   	pop    %ebx
+  80030a:	5e                   	pop    %esi
+  80030b:	5f                   	pop    %edi
+  80030c:	5d                   	pop    %ebp
+  80030d:	c3                   	ret
+    close(fd);
+  80030e:	83 ec 0c             	sub    $0xc,%esp
+  800311:	50                   	push   %eax
+  800312:	e8 b6 11 00 00       	call   8014cd <close>
+  800317:	83 c4 10             	add    $0x10,%esp
+}
+  80031a:	eb ea                	jmp    800306 <umain+0x2d3>
+
+0080031c <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80031c:	55                   	push   %ebp
+  80031d:	89 e5                	mov    %esp,%ebp
+  80031f:	56                   	push   %esi
+  800320:	53                   	push   %ebx
+  800321:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800324:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  800327:	c7 05 44 67 80 00 00 	movl   $0x0,0x806744
+  80032e:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  800331:	e8 ca 0a 00 00       	call   800e00 <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  800336:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80033b:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80033e:	c1 e0 04             	shl    $0x4,%eax
+  800341:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800346:	a3 44 67 80 00       	mov    %eax,0x806744
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  80034b:	85 db                	test   %ebx,%ebx
+  80034d:	7e 07                	jle    800356 <libmain+0x3a>
+    binaryname = argv[0];
+  80034f:	8b 06                	mov    (%esi),%eax
+  800351:	a3 00 40 80 00       	mov    %eax,0x804000
+
+  // call user main routine
+  umain(argc, argv);
+  800356:	83 ec 08             	sub    $0x8,%esp
+  800359:	56                   	push   %esi
+  80035a:	53                   	push   %ebx
+  80035b:	e8 d3 fc ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  800360:	e8 0a 00 00 00       	call   80036f <exit>
+}
+  800365:	83 c4 10             	add    $0x10,%esp
+  800368:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80036b:	5b                   	pop    %ebx
+  80036c:	5e                   	pop    %esi
+  80036d:	5d                   	pop    %ebp
+  80036e:	c3                   	ret
+
+0080036f <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80036f:	55                   	push   %ebp
+  800370:	89 e5                	mov    %esp,%ebp
+  800372:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  800375:	e8 80 11 00 00       	call   8014fa <close_all>
+  sys_env_destroy(0);
+  80037a:	83 ec 0c             	sub    $0xc,%esp
+  80037d:	6a 00                	push   $0x0
+  80037f:	e8 3b 0a 00 00       	call   800dbf <sys_env_destroy>
+}
+  800384:	83 c4 10             	add    $0x10,%esp
+  800387:	c9                   	leave
+  800388:	c3                   	ret
+
+00800389 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800389:	55                   	push   %ebp
+  80038a:	89 e5                	mov    %esp,%ebp
+  80038c:	56                   	push   %esi
+  80038d:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  80038e:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  800391:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  800397:	e8 64 0a 00 00       	call   800e00 <sys_getenvid>
+  80039c:	83 ec 0c             	sub    $0xc,%esp
+  80039f:	ff 75 0c             	push   0xc(%ebp)
+  8003a2:	ff 75 08             	push   0x8(%ebp)
+  8003a5:	56                   	push   %esi
+  8003a6:	50                   	push   %eax
+  8003a7:	68 fc 31 80 00       	push   $0x8031fc
+  8003ac:	e8 b3 00 00 00       	call   800464 <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  8003b1:	83 c4 18             	add    $0x18,%esp
+  8003b4:	53                   	push   %ebx
+  8003b5:	ff 75 10             	push   0x10(%ebp)
+  8003b8:	e8 56 00 00 00       	call   800413 <vcprintf>
+  cprintf("\n");
+  8003bd:	c7 04 24 60 36 80 00 	movl   $0x803660,(%esp)
+  8003c4:	e8 9b 00 00 00       	call   800464 <cprintf>
+  8003c9:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  8003cc:	cc                   	int3
+  while (1)
+  8003cd:	eb fd                	jmp    8003cc <_panic+0x43>
+
+008003cf <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8003cf:	55                   	push   %ebp
+  8003d0:	89 e5                	mov    %esp,%ebp
+  8003d2:	53                   	push   %ebx
+  8003d3:	83 ec 04             	sub    $0x4,%esp
+  8003d6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  8003d9:	8b 13                	mov    (%ebx),%edx
+  8003db:	8d 42 01             	lea    0x1(%edx),%eax
+  8003de:	89 03                	mov    %eax,(%ebx)
+  8003e0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8003e3:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  8003e7:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8003ec:	74 09                	je     8003f7 <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  8003ee:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8003f2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8003f5:	c9                   	leave
+  8003f6:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  8003f7:	83 ec 08             	sub    $0x8,%esp
+  8003fa:	68 ff 00 00 00       	push   $0xff
+  8003ff:	8d 43 08             	lea    0x8(%ebx),%eax
+  800402:	50                   	push   %eax
+  800403:	e8 7a 09 00 00       	call   800d82 <sys_cputs>
+    b->idx = 0;
+  800408:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80040e:	83 c4 10             	add    $0x10,%esp
+  800411:	eb db                	jmp    8003ee <putch+0x1f>
+
+00800413 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800413:	55                   	push   %ebp
+  800414:	89 e5                	mov    %esp,%ebp
+  800416:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  80041c:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800423:	00 00 00 
+  b.cnt = 0;
+  800426:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80042d:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  800430:	ff 75 0c             	push   0xc(%ebp)
+  800433:	ff 75 08             	push   0x8(%ebp)
+  800436:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80043c:	50                   	push   %eax
+  80043d:	68 cf 03 80 00       	push   $0x8003cf
+  800442:	e8 14 01 00 00       	call   80055b <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  800447:	83 c4 08             	add    $0x8,%esp
+  80044a:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800450:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800456:	50                   	push   %eax
+  800457:	e8 26 09 00 00       	call   800d82 <sys_cputs>
+
+  return b.cnt;
+}
+  80045c:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800462:	c9                   	leave
+  800463:	c3                   	ret
+
+00800464 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800464:	55                   	push   %ebp
+  800465:	89 e5                	mov    %esp,%ebp
+  800467:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  80046a:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  80046d:	50                   	push   %eax
+  80046e:	ff 75 08             	push   0x8(%ebp)
+  800471:	e8 9d ff ff ff       	call   800413 <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  800476:	c9                   	leave
+  800477:	c3                   	ret
+
+00800478 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  800478:	55                   	push   %ebp
+  800479:	89 e5                	mov    %esp,%ebp
+  80047b:	57                   	push   %edi
+  80047c:	56                   	push   %esi
+  80047d:	53                   	push   %ebx
+  80047e:	83 ec 1c             	sub    $0x1c,%esp
+  800481:	89 c7                	mov    %eax,%edi
+  800483:	89 d6                	mov    %edx,%esi
+  800485:	8b 45 08             	mov    0x8(%ebp),%eax
+  800488:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80048b:	89 d1                	mov    %edx,%ecx
+  80048d:	89 c2                	mov    %eax,%edx
+  80048f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800492:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800495:	8b 45 10             	mov    0x10(%ebp),%eax
+  800498:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  80049b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80049e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8004a5:	39 c2                	cmp    %eax,%edx
+  8004a7:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8004aa:	72 3e                	jb     8004ea <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  8004ac:	83 ec 0c             	sub    $0xc,%esp
+  8004af:	ff 75 18             	push   0x18(%ebp)
+  8004b2:	83 eb 01             	sub    $0x1,%ebx
+  8004b5:	53                   	push   %ebx
+  8004b6:	50                   	push   %eax
+  8004b7:	83 ec 08             	sub    $0x8,%esp
+  8004ba:	ff 75 e4             	push   -0x1c(%ebp)
+  8004bd:	ff 75 e0             	push   -0x20(%ebp)
+  8004c0:	ff 75 dc             	push   -0x24(%ebp)
+  8004c3:	ff 75 d8             	push   -0x28(%ebp)
+  8004c6:	e8 db 2a 00 00       	call   802fa6 <__udivdi3>
+  8004cb:	83 c4 18             	add    $0x18,%esp
+  8004ce:	52                   	push   %edx
+  8004cf:	50                   	push   %eax
+  8004d0:	89 f2                	mov    %esi,%edx
+  8004d2:	89 f8                	mov    %edi,%eax
+  8004d4:	e8 9f ff ff ff       	call   800478 <printnum>
+  8004d9:	83 c4 20             	add    $0x20,%esp
+  8004dc:	eb 13                	jmp    8004f1 <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  8004de:	83 ec 08             	sub    $0x8,%esp
+  8004e1:	56                   	push   %esi
+  8004e2:	ff 75 18             	push   0x18(%ebp)
+  8004e5:	ff d7                	call   *%edi
+  8004e7:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  8004ea:	83 eb 01             	sub    $0x1,%ebx
+  8004ed:	85 db                	test   %ebx,%ebx
+  8004ef:	7f ed                	jg     8004de <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  8004f1:	83 ec 08             	sub    $0x8,%esp
+  8004f4:	56                   	push   %esi
+  8004f5:	83 ec 04             	sub    $0x4,%esp
+  8004f8:	ff 75 e4             	push   -0x1c(%ebp)
+  8004fb:	ff 75 e0             	push   -0x20(%ebp)
+  8004fe:	ff 75 dc             	push   -0x24(%ebp)
+  800501:	ff 75 d8             	push   -0x28(%ebp)
+  800504:	e8 be 2a 00 00       	call   802fc7 <__umoddi3>
+  800509:	83 c4 14             	add    $0x14,%esp
+  80050c:	0f be 80 1f 32 80 00 	movsbl 0x80321f(%eax),%eax
+  800513:	50                   	push   %eax
+  800514:	ff d7                	call   *%edi
+}
+  800516:	83 c4 10             	add    $0x10,%esp
+  800519:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80051c:	5b                   	pop    %ebx
+  80051d:	5e                   	pop    %esi
+  80051e:	5f                   	pop    %edi
+  80051f:	5d                   	pop    %ebp
+  800520:	c3                   	ret
+
+00800521 <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800521:	55                   	push   %ebp
+  800522:	89 e5                	mov    %esp,%ebp
+  800524:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  800527:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  80052b:	8b 10                	mov    (%eax),%edx
+  80052d:	3b 50 04             	cmp    0x4(%eax),%edx
+  800530:	73 0a                	jae    80053c <sprintputch+0x1b>
+    *b->buf++ = ch;
+  800532:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800535:	89 08                	mov    %ecx,(%eax)
+  800537:	8b 45 08             	mov    0x8(%ebp),%eax
+  80053a:	88 02                	mov    %al,(%edx)
+}
+  80053c:	5d                   	pop    %ebp
+  80053d:	c3                   	ret
+
+0080053e <printfmt>:
+{
+  80053e:	55                   	push   %ebp
+  80053f:	89 e5                	mov    %esp,%ebp
+  800541:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  800544:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  800547:	50                   	push   %eax
+  800548:	ff 75 10             	push   0x10(%ebp)
+  80054b:	ff 75 0c             	push   0xc(%ebp)
+  80054e:	ff 75 08             	push   0x8(%ebp)
+  800551:	e8 05 00 00 00       	call   80055b <vprintfmt>
+}
+  800556:	83 c4 10             	add    $0x10,%esp
+  800559:	c9                   	leave
+  80055a:	c3                   	ret
+
+0080055b <vprintfmt>:
+{
+  80055b:	55                   	push   %ebp
+  80055c:	89 e5                	mov    %esp,%ebp
+  80055e:	57                   	push   %edi
+  80055f:	56                   	push   %esi
+  800560:	53                   	push   %ebx
+  800561:	83 ec 2c             	sub    $0x2c,%esp
+  800564:	8b 75 08             	mov    0x8(%ebp),%esi
+  800567:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80056a:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80056d:	eb 0a                	jmp    800579 <vprintfmt+0x1e>
+      putch(ch, putdat);
+  80056f:	83 ec 08             	sub    $0x8,%esp
+  800572:	53                   	push   %ebx
+  800573:	50                   	push   %eax
+  800574:	ff d6                	call   *%esi
+  800576:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  800579:	83 c7 01             	add    $0x1,%edi
+  80057c:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800580:	83 f8 25             	cmp    $0x25,%eax
+  800583:	74 0c                	je     800591 <vprintfmt+0x36>
+      if (ch == '\0')
+  800585:	85 c0                	test   %eax,%eax
+  800587:	75 e6                	jne    80056f <vprintfmt+0x14>
+}
+  800589:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80058c:	5b                   	pop    %ebx
+  80058d:	5e                   	pop    %esi
+  80058e:	5f                   	pop    %edi
+  80058f:	5d                   	pop    %ebp
+  800590:	c3                   	ret
+    padc = ' ';
+  800591:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  800595:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  80059c:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  8005a3:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  8005aa:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  8005af:	8d 47 01             	lea    0x1(%edi),%eax
+  8005b2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8005b5:	0f b6 17             	movzbl (%edi),%edx
+  8005b8:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8005bb:	3c 55                	cmp    $0x55,%al
+  8005bd:	0f 87 cf 03 00 00    	ja     800992 <vprintfmt+0x437>
+  8005c3:	0f b6 c0             	movzbl %al,%eax
+  8005c6:	ff 24 85 60 33 80 00 	jmp    *0x803360(,%eax,4)
+  8005cd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  8005d0:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8005d4:	eb d9                	jmp    8005af <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  8005d6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8005d9:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8005dd:	eb d0                	jmp    8005af <vprintfmt+0x54>
+  8005df:	0f b6 d2             	movzbl %dl,%edx
+  8005e2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  8005e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005ea:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  8005ed:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8005f0:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  8005f4:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  8005f7:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8005fa:	83 f9 09             	cmp    $0x9,%ecx
+  8005fd:	77 55                	ja     800654 <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  8005ff:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  800602:	eb e9                	jmp    8005ed <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  800604:	8b 45 14             	mov    0x14(%ebp),%eax
+  800607:	8b 00                	mov    (%eax),%eax
+  800609:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80060c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060f:	8d 40 04             	lea    0x4(%eax),%eax
+  800612:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  800615:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  800618:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80061c:	79 91                	jns    8005af <vprintfmt+0x54>
+        width = precision, precision = -1;
+  80061e:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800621:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800624:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80062b:	eb 82                	jmp    8005af <vprintfmt+0x54>
+      if (width < 0)
+  80062d:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800630:	85 d2                	test   %edx,%edx
+  800632:	b8 00 00 00 00       	mov    $0x0,%eax
+  800637:	0f 49 c2             	cmovns %edx,%eax
+  80063a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  80063d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  800640:	e9 6a ff ff ff       	jmp    8005af <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  800645:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  800648:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  80064f:	e9 5b ff ff ff       	jmp    8005af <vprintfmt+0x54>
+  800654:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800657:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80065a:	eb bc                	jmp    800618 <vprintfmt+0xbd>
+      lflag++;
+  80065c:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  80065f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  800662:	e9 48 ff ff ff       	jmp    8005af <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  800667:	8b 45 14             	mov    0x14(%ebp),%eax
+  80066a:	8d 78 04             	lea    0x4(%eax),%edi
+  80066d:	83 ec 08             	sub    $0x8,%esp
+  800670:	53                   	push   %ebx
+  800671:	ff 30                	push   (%eax)
+  800673:	ff d6                	call   *%esi
+      break;
+  800675:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  800678:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  80067b:	e9 b1 02 00 00       	jmp    800931 <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  800680:	8b 45 14             	mov    0x14(%ebp),%eax
+  800683:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  800686:	8b 10                	mov    (%eax),%edx
+  800688:	89 d0                	mov    %edx,%eax
+  80068a:	f7 d8                	neg    %eax
+  80068c:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80068f:	83 f8 10             	cmp    $0x10,%eax
+  800692:	7f 23                	jg     8006b7 <vprintfmt+0x15c>
+  800694:	8b 14 85 c0 34 80 00 	mov    0x8034c0(,%eax,4),%edx
+  80069b:	85 d2                	test   %edx,%edx
+  80069d:	74 18                	je     8006b7 <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  80069f:	52                   	push   %edx
+  8006a0:	68 0a 36 80 00       	push   $0x80360a
+  8006a5:	53                   	push   %ebx
+  8006a6:	56                   	push   %esi
+  8006a7:	e8 92 fe ff ff       	call   80053e <printfmt>
+  8006ac:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  8006af:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8006b2:	e9 7a 02 00 00       	jmp    800931 <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  8006b7:	50                   	push   %eax
+  8006b8:	68 37 32 80 00       	push   $0x803237
+  8006bd:	53                   	push   %ebx
+  8006be:	56                   	push   %esi
+  8006bf:	e8 7a fe ff ff       	call   80053e <printfmt>
+  8006c4:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  8006c7:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  8006ca:	e9 62 02 00 00       	jmp    800931 <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  8006cf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d2:	83 c0 04             	add    $0x4,%eax
+  8006d5:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8006d8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006db:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  8006dd:	85 c9                	test   %ecx,%ecx
+  8006df:	b8 30 32 80 00       	mov    $0x803230,%eax
+  8006e4:	0f 45 c1             	cmovne %ecx,%eax
+  8006e7:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  8006ea:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8006ee:	7e 06                	jle    8006f6 <vprintfmt+0x19b>
+  8006f0:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8006f4:	75 0b                	jne    800701 <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8006f6:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8006f9:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8006fc:	89 75 08             	mov    %esi,0x8(%ebp)
+  8006ff:	eb 5c                	jmp    80075d <vprintfmt+0x202>
+  800701:	83 ec 08             	sub    $0x8,%esp
+  800704:	ff 75 d0             	push   -0x30(%ebp)
+  800707:	ff 75 cc             	push   -0x34(%ebp)
+  80070a:	e8 20 03 00 00       	call   800a2f <strnlen>
+  80070f:	89 c2                	mov    %eax,%edx
+  800711:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800714:	29 d0                	sub    %edx,%eax
+  800716:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  800719:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80071d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800720:	89 75 08             	mov    %esi,0x8(%ebp)
+  800723:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800725:	eb 0e                	jmp    800735 <vprintfmt+0x1da>
+          putch(padc, putdat);
+  800727:	83 ec 08             	sub    $0x8,%esp
+  80072a:	53                   	push   %ebx
+  80072b:	57                   	push   %edi
+  80072c:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  80072f:	83 ee 01             	sub    $0x1,%esi
+  800732:	83 c4 10             	add    $0x10,%esp
+  800735:	85 f6                	test   %esi,%esi
+  800737:	7f ee                	jg     800727 <vprintfmt+0x1cc>
+  800739:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80073c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80073f:	85 c0                	test   %eax,%eax
+  800741:	ba 00 00 00 00       	mov    $0x0,%edx
+  800746:	0f 49 d0             	cmovns %eax,%edx
+  800749:	29 d0                	sub    %edx,%eax
+  80074b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80074e:	eb a6                	jmp    8006f6 <vprintfmt+0x19b>
+          putch(ch, putdat);
+  800750:	83 ec 08             	sub    $0x8,%esp
+  800753:	53                   	push   %ebx
+  800754:	52                   	push   %edx
+  800755:	ff 55 08             	call   *0x8(%ebp)
+  800758:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80075b:	89 f1                	mov    %esi,%ecx
+  80075d:	8d 71 01             	lea    0x1(%ecx),%esi
+  800760:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800764:	0f be d0             	movsbl %al,%edx
+  800767:	85 d2                	test   %edx,%edx
+  800769:	74 28                	je     800793 <vprintfmt+0x238>
+  80076b:	85 ff                	test   %edi,%edi
+  80076d:	78 05                	js     800774 <vprintfmt+0x219>
+  80076f:	83 ef 01             	sub    $0x1,%edi
+  800772:	78 30                	js     8007a4 <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  800774:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800778:	74 d6                	je     800750 <vprintfmt+0x1f5>
+  80077a:	0f be c0             	movsbl %al,%eax
+  80077d:	83 e8 20             	sub    $0x20,%eax
+  800780:	83 f8 5e             	cmp    $0x5e,%eax
+  800783:	76 cb                	jbe    800750 <vprintfmt+0x1f5>
+          putch('?', putdat);
+  800785:	83 ec 08             	sub    $0x8,%esp
+  800788:	53                   	push   %ebx
+  800789:	6a 3f                	push   $0x3f
+  80078b:	ff 55 08             	call   *0x8(%ebp)
+  80078e:	83 c4 10             	add    $0x10,%esp
+  800791:	eb c8                	jmp    80075b <vprintfmt+0x200>
+  800793:	8b 75 08             	mov    0x8(%ebp),%esi
+  800796:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800799:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80079c:	01 d0                	add    %edx,%eax
+  80079e:	29 c8                	sub    %ecx,%eax
+  8007a0:	89 c7                	mov    %eax,%edi
+  8007a2:	eb 13                	jmp    8007b7 <vprintfmt+0x25c>
+  8007a4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007a7:	eb ed                	jmp    800796 <vprintfmt+0x23b>
+        putch(' ', putdat);
+  8007a9:	83 ec 08             	sub    $0x8,%esp
+  8007ac:	53                   	push   %ebx
+  8007ad:	6a 20                	push   $0x20
+  8007af:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  8007b1:	83 ef 01             	sub    $0x1,%edi
+  8007b4:	83 c4 10             	add    $0x10,%esp
+  8007b7:	85 ff                	test   %edi,%edi
+  8007b9:	7f ee                	jg     8007a9 <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  8007bb:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8007be:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007c1:	e9 6b 01 00 00       	jmp    800931 <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  8007c6:	83 f9 01             	cmp    $0x1,%ecx
+  8007c9:	7f 1f                	jg     8007ea <vprintfmt+0x28f>
+  else if (lflag)
+  8007cb:	85 c9                	test   %ecx,%ecx
+  8007cd:	74 67                	je     800836 <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  8007cf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d2:	8b 00                	mov    (%eax),%eax
+  8007d4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007d7:	89 c1                	mov    %eax,%ecx
+  8007d9:	c1 f9 1f             	sar    $0x1f,%ecx
+  8007dc:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8007df:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e2:	8d 40 04             	lea    0x4(%eax),%eax
+  8007e5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007e8:	eb 17                	jmp    800801 <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  8007ea:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ed:	8b 50 04             	mov    0x4(%eax),%edx
+  8007f0:	8b 00                	mov    (%eax),%eax
+  8007f2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007f5:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8007f8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007fb:	8d 40 08             	lea    0x8(%eax),%eax
+  8007fe:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  800801:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800804:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  800807:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  80080c:	85 c9                	test   %ecx,%ecx
+  80080e:	0f 89 03 01 00 00    	jns    800917 <vprintfmt+0x3bc>
+        putch('-', putdat);
+  800814:	83 ec 08             	sub    $0x8,%esp
+  800817:	53                   	push   %ebx
+  800818:	6a 2d                	push   $0x2d
+  80081a:	ff d6                	call   *%esi
+        num = -(long long)num;
+  80081c:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80081f:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800822:	f7 da                	neg    %edx
+  800824:	83 d1 00             	adc    $0x0,%ecx
+  800827:	f7 d9                	neg    %ecx
+  800829:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  80082c:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800831:	e9 e1 00 00 00       	jmp    800917 <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  800836:	8b 45 14             	mov    0x14(%ebp),%eax
+  800839:	8b 00                	mov    (%eax),%eax
+  80083b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80083e:	89 c1                	mov    %eax,%ecx
+  800840:	c1 f9 1f             	sar    $0x1f,%ecx
+  800843:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800846:	8b 45 14             	mov    0x14(%ebp),%eax
+  800849:	8d 40 04             	lea    0x4(%eax),%eax
+  80084c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80084f:	eb b0                	jmp    800801 <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  800851:	83 f9 01             	cmp    $0x1,%ecx
+  800854:	7f 1e                	jg     800874 <vprintfmt+0x319>
+  else if (lflag)
+  800856:	85 c9                	test   %ecx,%ecx
+  800858:	74 32                	je     80088c <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  80085a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80085d:	8b 10                	mov    (%eax),%edx
+  80085f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800864:	8d 40 04             	lea    0x4(%eax),%eax
+  800867:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  80086a:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  80086f:	e9 a3 00 00 00       	jmp    800917 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800874:	8b 45 14             	mov    0x14(%ebp),%eax
+  800877:	8b 10                	mov    (%eax),%edx
+  800879:	8b 48 04             	mov    0x4(%eax),%ecx
+  80087c:	8d 40 08             	lea    0x8(%eax),%eax
+  80087f:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800882:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  800887:	e9 8b 00 00 00       	jmp    800917 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  80088c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80088f:	8b 10                	mov    (%eax),%edx
+  800891:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800896:	8d 40 04             	lea    0x4(%eax),%eax
+  800899:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  80089c:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  8008a1:	eb 74                	jmp    800917 <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  8008a3:	83 f9 01             	cmp    $0x1,%ecx
+  8008a6:	7f 1b                	jg     8008c3 <vprintfmt+0x368>
+  else if (lflag)
+  8008a8:	85 c9                	test   %ecx,%ecx
+  8008aa:	74 2c                	je     8008d8 <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  8008ac:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008af:	8b 10                	mov    (%eax),%edx
+  8008b1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008b6:	8d 40 04             	lea    0x4(%eax),%eax
+  8008b9:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8008bc:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  8008c1:	eb 54                	jmp    800917 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  8008c3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008c6:	8b 10                	mov    (%eax),%edx
+  8008c8:	8b 48 04             	mov    0x4(%eax),%ecx
+  8008cb:	8d 40 08             	lea    0x8(%eax),%eax
+  8008ce:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8008d1:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  8008d6:	eb 3f                	jmp    800917 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8008d8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008db:	8b 10                	mov    (%eax),%edx
+  8008dd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008e2:	8d 40 04             	lea    0x4(%eax),%eax
+  8008e5:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8008e8:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  8008ed:	eb 28                	jmp    800917 <vprintfmt+0x3bc>
+      putch('0', putdat);
+  8008ef:	83 ec 08             	sub    $0x8,%esp
+  8008f2:	53                   	push   %ebx
+  8008f3:	6a 30                	push   $0x30
+  8008f5:	ff d6                	call   *%esi
+      putch('x', putdat);
+  8008f7:	83 c4 08             	add    $0x8,%esp
+  8008fa:	53                   	push   %ebx
+  8008fb:	6a 78                	push   $0x78
+  8008fd:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  8008ff:	8b 45 14             	mov    0x14(%ebp),%eax
+  800902:	8b 10                	mov    (%eax),%edx
+  800904:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  800909:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  80090c:	8d 40 04             	lea    0x4(%eax),%eax
+  80090f:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800912:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  800917:	83 ec 0c             	sub    $0xc,%esp
+  80091a:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80091e:	50                   	push   %eax
+  80091f:	ff 75 e0             	push   -0x20(%ebp)
+  800922:	57                   	push   %edi
+  800923:	51                   	push   %ecx
+  800924:	52                   	push   %edx
+  800925:	89 da                	mov    %ebx,%edx
+  800927:	89 f0                	mov    %esi,%eax
+  800929:	e8 4a fb ff ff       	call   800478 <printnum>
+      break;
+  80092e:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  800931:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  800934:	e9 40 fc ff ff       	jmp    800579 <vprintfmt+0x1e>
+  if (lflag >= 2)
+  800939:	83 f9 01             	cmp    $0x1,%ecx
+  80093c:	7f 1b                	jg     800959 <vprintfmt+0x3fe>
+  else if (lflag)
+  80093e:	85 c9                	test   %ecx,%ecx
+  800940:	74 2c                	je     80096e <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  800942:	8b 45 14             	mov    0x14(%ebp),%eax
+  800945:	8b 10                	mov    (%eax),%edx
+  800947:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80094c:	8d 40 04             	lea    0x4(%eax),%eax
+  80094f:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800952:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  800957:	eb be                	jmp    800917 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800959:	8b 45 14             	mov    0x14(%ebp),%eax
+  80095c:	8b 10                	mov    (%eax),%edx
+  80095e:	8b 48 04             	mov    0x4(%eax),%ecx
+  800961:	8d 40 08             	lea    0x8(%eax),%eax
+  800964:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800967:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  80096c:	eb a9                	jmp    800917 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  80096e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800971:	8b 10                	mov    (%eax),%edx
+  800973:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800978:	8d 40 04             	lea    0x4(%eax),%eax
+  80097b:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  80097e:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  800983:	eb 92                	jmp    800917 <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  800985:	83 ec 08             	sub    $0x8,%esp
+  800988:	53                   	push   %ebx
+  800989:	6a 25                	push   $0x25
+  80098b:	ff d6                	call   *%esi
+      break;
+  80098d:	83 c4 10             	add    $0x10,%esp
+  800990:	eb 9f                	jmp    800931 <vprintfmt+0x3d6>
+      putch('%', putdat);
+  800992:	83 ec 08             	sub    $0x8,%esp
+  800995:	53                   	push   %ebx
+  800996:	6a 25                	push   $0x25
+  800998:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  80099a:	83 c4 10             	add    $0x10,%esp
+  80099d:	89 f8                	mov    %edi,%eax
+  80099f:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8009a3:	74 05                	je     8009aa <vprintfmt+0x44f>
+  8009a5:	83 e8 01             	sub    $0x1,%eax
+  8009a8:	eb f5                	jmp    80099f <vprintfmt+0x444>
+  8009aa:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8009ad:	eb 82                	jmp    800931 <vprintfmt+0x3d6>
+
+008009af <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8009af:	55                   	push   %ebp
+  8009b0:	89 e5                	mov    %esp,%ebp
+  8009b2:	83 ec 18             	sub    $0x18,%esp
+  8009b5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009b8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  8009bb:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8009be:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8009c2:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8009c5:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  8009cc:	85 c0                	test   %eax,%eax
+  8009ce:	74 26                	je     8009f6 <vsnprintf+0x47>
+  8009d0:	85 d2                	test   %edx,%edx
+  8009d2:	7e 22                	jle    8009f6 <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8009d4:	ff 75 14             	push   0x14(%ebp)
+  8009d7:	ff 75 10             	push   0x10(%ebp)
+  8009da:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8009dd:	50                   	push   %eax
+  8009de:	68 21 05 80 00       	push   $0x800521
+  8009e3:	e8 73 fb ff ff       	call   80055b <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  8009e8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8009eb:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  8009ee:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009f1:	83 c4 10             	add    $0x10,%esp
+}
+  8009f4:	c9                   	leave
+  8009f5:	c3                   	ret
+    return -E_INVAL;
+  8009f6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8009fb:	eb f7                	jmp    8009f4 <vsnprintf+0x45>
+
+008009fd <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8009fd:	55                   	push   %ebp
+  8009fe:	89 e5                	mov    %esp,%ebp
+  800a00:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  800a03:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  800a06:	50                   	push   %eax
+  800a07:	ff 75 10             	push   0x10(%ebp)
+  800a0a:	ff 75 0c             	push   0xc(%ebp)
+  800a0d:	ff 75 08             	push   0x8(%ebp)
+  800a10:	e8 9a ff ff ff       	call   8009af <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  800a15:	c9                   	leave
+  800a16:	c3                   	ret
+
+00800a17 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800a17:	55                   	push   %ebp
+  800a18:	89 e5                	mov    %esp,%ebp
+  800a1a:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  800a1d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a22:	eb 03                	jmp    800a27 <strlen+0x10>
+    n++;
+  800a24:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  800a27:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800a2b:	75 f7                	jne    800a24 <strlen+0xd>
+  return n;
+}
+  800a2d:	5d                   	pop    %ebp
+  800a2e:	c3                   	ret
+
+00800a2f <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800a2f:	55                   	push   %ebp
+  800a30:	89 e5                	mov    %esp,%ebp
+  800a32:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a35:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a38:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a3d:	eb 03                	jmp    800a42 <strnlen+0x13>
+    n++;
+  800a3f:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a42:	39 d0                	cmp    %edx,%eax
+  800a44:	74 08                	je     800a4e <strnlen+0x1f>
+  800a46:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800a4a:	75 f3                	jne    800a3f <strnlen+0x10>
+  800a4c:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  800a4e:	89 d0                	mov    %edx,%eax
+  800a50:	5d                   	pop    %ebp
+  800a51:	c3                   	ret
+
+00800a52 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800a52:	55                   	push   %ebp
+  800a53:	89 e5                	mov    %esp,%ebp
+  800a55:	53                   	push   %ebx
+  800a56:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a59:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  800a5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a61:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800a65:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800a68:	83 c0 01             	add    $0x1,%eax
+  800a6b:	84 d2                	test   %dl,%dl
+  800a6d:	75 f2                	jne    800a61 <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  800a6f:	89 c8                	mov    %ecx,%eax
+  800a71:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a74:	c9                   	leave
+  800a75:	c3                   	ret
+
+00800a76 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800a76:	55                   	push   %ebp
+  800a77:	89 e5                	mov    %esp,%ebp
+  800a79:	53                   	push   %ebx
+  800a7a:	83 ec 10             	sub    $0x10,%esp
+  800a7d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  800a80:	53                   	push   %ebx
+  800a81:	e8 91 ff ff ff       	call   800a17 <strlen>
+  800a86:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  800a89:	ff 75 0c             	push   0xc(%ebp)
+  800a8c:	01 d8                	add    %ebx,%eax
+  800a8e:	50                   	push   %eax
+  800a8f:	e8 be ff ff ff       	call   800a52 <strcpy>
+  return dst;
+}
+  800a94:	89 d8                	mov    %ebx,%eax
+  800a96:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a99:	c9                   	leave
+  800a9a:	c3                   	ret
+
+00800a9b <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  800a9b:	55                   	push   %ebp
+  800a9c:	89 e5                	mov    %esp,%ebp
+  800a9e:	56                   	push   %esi
+  800a9f:	53                   	push   %ebx
+  800aa0:	8b 75 08             	mov    0x8(%ebp),%esi
+  800aa3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  800aa6:	89 f3                	mov    %esi,%ebx
+  800aa8:	03 5d 10             	add    0x10(%ebp),%ebx
+  800aab:	89 f0                	mov    %esi,%eax
+  800aad:	eb 0f                	jmp    800abe <strncpy+0x23>
+    *dst++ = *src;
+  800aaf:	83 c0 01             	add    $0x1,%eax
+  800ab2:	0f b6 0a             	movzbl (%edx),%ecx
+  800ab5:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  800ab8:	80 f9 01             	cmp    $0x1,%cl
+  800abb:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  800abe:	39 d8                	cmp    %ebx,%eax
+  800ac0:	75 ed                	jne    800aaf <strncpy+0x14>
+  }
+  return ret;
+}
+  800ac2:	89 f0                	mov    %esi,%eax
+  800ac4:	5b                   	pop    %ebx
+  800ac5:	5e                   	pop    %esi
+  800ac6:	5d                   	pop    %ebp
+  800ac7:	c3                   	ret
+
+00800ac8 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800ac8:	55                   	push   %ebp
+  800ac9:	89 e5                	mov    %esp,%ebp
+  800acb:	56                   	push   %esi
+  800acc:	53                   	push   %ebx
+  800acd:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ad0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ad3:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  800ad6:	89 f0                	mov    %esi,%eax
+  800ad8:	85 d2                	test   %edx,%edx
+  800ada:	74 21                	je     800afd <strlcpy+0x35>
+  800adc:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800ae0:	89 f2                	mov    %esi,%edx
+  800ae2:	eb 09                	jmp    800aed <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  800ae4:	83 c1 01             	add    $0x1,%ecx
+  800ae7:	83 c2 01             	add    $0x1,%edx
+  800aea:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  800aed:	39 c2                	cmp    %eax,%edx
+  800aef:	74 09                	je     800afa <strlcpy+0x32>
+  800af1:	0f b6 19             	movzbl (%ecx),%ebx
+  800af4:	84 db                	test   %bl,%bl
+  800af6:	75 ec                	jne    800ae4 <strlcpy+0x1c>
+  800af8:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  800afa:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  800afd:	29 f0                	sub    %esi,%eax
+}
+  800aff:	5b                   	pop    %ebx
+  800b00:	5e                   	pop    %esi
+  800b01:	5d                   	pop    %ebp
+  800b02:	c3                   	ret
+
+00800b03 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800b03:	55                   	push   %ebp
+  800b04:	89 e5                	mov    %esp,%ebp
+  800b06:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b09:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  800b0c:	eb 06                	jmp    800b14 <strcmp+0x11>
+    p++, q++;
+  800b0e:	83 c1 01             	add    $0x1,%ecx
+  800b11:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  800b14:	0f b6 01             	movzbl (%ecx),%eax
+  800b17:	84 c0                	test   %al,%al
+  800b19:	74 04                	je     800b1f <strcmp+0x1c>
+  800b1b:	3a 02                	cmp    (%edx),%al
+  800b1d:	74 ef                	je     800b0e <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  800b1f:	0f b6 c0             	movzbl %al,%eax
+  800b22:	0f b6 12             	movzbl (%edx),%edx
+  800b25:	29 d0                	sub    %edx,%eax
+}
+  800b27:	5d                   	pop    %ebp
+  800b28:	c3                   	ret
+
+00800b29 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800b29:	55                   	push   %ebp
+  800b2a:	89 e5                	mov    %esp,%ebp
+  800b2c:	53                   	push   %ebx
+  800b2d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b30:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b33:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  800b36:	eb 09                	jmp    800b41 <strncmp+0x18>
+    n--, p++, q++;
+  800b38:	83 ea 01             	sub    $0x1,%edx
+  800b3b:	83 c0 01             	add    $0x1,%eax
+  800b3e:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  800b41:	85 d2                	test   %edx,%edx
+  800b43:	74 18                	je     800b5d <strncmp+0x34>
+  800b45:	0f b6 18             	movzbl (%eax),%ebx
+  800b48:	84 db                	test   %bl,%bl
+  800b4a:	74 04                	je     800b50 <strncmp+0x27>
+  800b4c:	3a 19                	cmp    (%ecx),%bl
+  800b4e:	74 e8                	je     800b38 <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800b50:	0f b6 00             	movzbl (%eax),%eax
+  800b53:	0f b6 11             	movzbl (%ecx),%edx
+  800b56:	29 d0                	sub    %edx,%eax
+}
+  800b58:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b5b:	c9                   	leave
+  800b5c:	c3                   	ret
+    return 0;
+  800b5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b62:	eb f4                	jmp    800b58 <strncmp+0x2f>
+
+00800b64 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800b64:	55                   	push   %ebp
+  800b65:	89 e5                	mov    %esp,%ebp
+  800b67:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b6a:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800b6e:	eb 03                	jmp    800b73 <strchr+0xf>
+  800b70:	83 c0 01             	add    $0x1,%eax
+  800b73:	0f b6 10             	movzbl (%eax),%edx
+  800b76:	84 d2                	test   %dl,%dl
+  800b78:	74 06                	je     800b80 <strchr+0x1c>
+    if (*s == c)
+  800b7a:	38 ca                	cmp    %cl,%dl
+  800b7c:	75 f2                	jne    800b70 <strchr+0xc>
+  800b7e:	eb 05                	jmp    800b85 <strchr+0x21>
+      return (char*)s;
+  return 0;
+  800b80:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b85:	5d                   	pop    %ebp
+  800b86:	c3                   	ret
+
+00800b87 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800b87:	55                   	push   %ebp
+  800b88:	89 e5                	mov    %esp,%ebp
+  800b8a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b8d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800b91:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  800b94:	38 ca                	cmp    %cl,%dl
+  800b96:	74 09                	je     800ba1 <strfind+0x1a>
+  800b98:	84 d2                	test   %dl,%dl
+  800b9a:	74 05                	je     800ba1 <strfind+0x1a>
+  for (; *s; s++)
+  800b9c:	83 c0 01             	add    $0x1,%eax
+  800b9f:	eb f0                	jmp    800b91 <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  800ba1:	5d                   	pop    %ebp
+  800ba2:	c3                   	ret
+
+00800ba3 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800ba3:	55                   	push   %ebp
+  800ba4:	89 e5                	mov    %esp,%ebp
+  800ba6:	57                   	push   %edi
+  800ba7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800baa:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  800bad:	85 c9                	test   %ecx,%ecx
+  800baf:	74 20                	je     800bd1 <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  800bb1:	89 f8                	mov    %edi,%eax
+  800bb3:	09 c8                	or     %ecx,%eax
+  800bb5:	a8 03                	test   $0x3,%al
+  800bb7:	75 12                	jne    800bcb <memset+0x28>
+    c &= 0xFF;
+  800bb9:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800bbd:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  800bc3:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  800bc6:	fc                   	cld
+  800bc7:	f3 ab                	rep stos %eax,%es:(%edi)
+  800bc9:	eb 06                	jmp    800bd1 <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  800bcb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800bce:	fc                   	cld
+  800bcf:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  800bd1:	89 f8                	mov    %edi,%eax
+  800bd3:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800bd6:	c9                   	leave
+  800bd7:	c3                   	ret
+
+00800bd8 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800bd8:	55                   	push   %ebp
+  800bd9:	89 e5                	mov    %esp,%ebp
+  800bdb:	57                   	push   %edi
+  800bdc:	56                   	push   %esi
+  800bdd:	8b 45 08             	mov    0x8(%ebp),%eax
+  800be0:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800be3:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  800be6:	39 c6                	cmp    %eax,%esi
+  800be8:	73 32                	jae    800c1c <memmove+0x44>
+  800bea:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800bed:	39 d0                	cmp    %edx,%eax
+  800bef:	73 2b                	jae    800c1c <memmove+0x44>
+    s += n;
+    d += n;
+  800bf1:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800bf4:	89 d6                	mov    %edx,%esi
+  800bf6:	09 fe                	or     %edi,%esi
+  800bf8:	09 ce                	or     %ecx,%esi
+  800bfa:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800c00:	75 0e                	jne    800c10 <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800c02:	83 ef 04             	sub    $0x4,%edi
+  800c05:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800c08:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  800c0b:	fd                   	std
+  800c0c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c0e:	eb 09                	jmp    800c19 <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800c10:	83 ef 01             	sub    $0x1,%edi
+  800c13:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  800c16:	fd                   	std
+  800c17:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  800c19:	fc                   	cld
+  800c1a:	eb 1a                	jmp    800c36 <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c1c:	89 f2                	mov    %esi,%edx
+  800c1e:	09 c2                	or     %eax,%edx
+  800c20:	09 ca                	or     %ecx,%edx
+  800c22:	f6 c2 03             	test   $0x3,%dl
+  800c25:	75 0a                	jne    800c31 <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800c27:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  800c2a:	89 c7                	mov    %eax,%edi
+  800c2c:	fc                   	cld
+  800c2d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c2f:	eb 05                	jmp    800c36 <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  800c31:	89 c7                	mov    %eax,%edi
+  800c33:	fc                   	cld
+  800c34:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  800c36:	5e                   	pop    %esi
+  800c37:	5f                   	pop    %edi
+  800c38:	5d                   	pop    %ebp
+  800c39:	c3                   	ret
+
+00800c3a <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800c3a:	55                   	push   %ebp
+  800c3b:	89 e5                	mov    %esp,%ebp
+  800c3d:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  800c40:	ff 75 10             	push   0x10(%ebp)
+  800c43:	ff 75 0c             	push   0xc(%ebp)
+  800c46:	ff 75 08             	push   0x8(%ebp)
+  800c49:	e8 8a ff ff ff       	call   800bd8 <memmove>
+}
+  800c4e:	c9                   	leave
+  800c4f:	c3                   	ret
+
+00800c50 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800c50:	55                   	push   %ebp
+  800c51:	89 e5                	mov    %esp,%ebp
+  800c53:	56                   	push   %esi
+  800c54:	53                   	push   %ebx
+  800c55:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c58:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  800c5b:	89 c6                	mov    %eax,%esi
+  800c5d:	03 75 10             	add    0x10(%ebp),%esi
+  800c60:	eb 06                	jmp    800c68 <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  800c62:	83 c0 01             	add    $0x1,%eax
+  800c65:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  800c68:	39 f0                	cmp    %esi,%eax
+  800c6a:	74 14                	je     800c80 <memcmp+0x30>
+    if (*s1 != *s2)
+  800c6c:	0f b6 08             	movzbl (%eax),%ecx
+  800c6f:	0f b6 1a             	movzbl (%edx),%ebx
+  800c72:	38 d9                	cmp    %bl,%cl
+  800c74:	74 ec                	je     800c62 <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  800c76:	0f b6 c1             	movzbl %cl,%eax
+  800c79:	0f b6 db             	movzbl %bl,%ebx
+  800c7c:	29 d8                	sub    %ebx,%eax
+  800c7e:	eb 05                	jmp    800c85 <memcmp+0x35>
+  }
+
+  return 0;
+  800c80:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c85:	5b                   	pop    %ebx
+  800c86:	5e                   	pop    %esi
+  800c87:	5d                   	pop    %ebp
+  800c88:	c3                   	ret
+
+00800c89 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800c89:	55                   	push   %ebp
+  800c8a:	89 e5                	mov    %esp,%ebp
+  800c8c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c8f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  800c92:	89 c2                	mov    %eax,%edx
+  800c94:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  800c97:	eb 03                	jmp    800c9c <memfind+0x13>
+  800c99:	83 c0 01             	add    $0x1,%eax
+  800c9c:	39 d0                	cmp    %edx,%eax
+  800c9e:	73 04                	jae    800ca4 <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  800ca0:	38 08                	cmp    %cl,(%eax)
+  800ca2:	75 f5                	jne    800c99 <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  800ca4:	5d                   	pop    %ebp
+  800ca5:	c3                   	ret
+
+00800ca6 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800ca6:	55                   	push   %ebp
+  800ca7:	89 e5                	mov    %esp,%ebp
+  800ca9:	57                   	push   %edi
+  800caa:	56                   	push   %esi
+  800cab:	53                   	push   %ebx
+  800cac:	8b 55 08             	mov    0x8(%ebp),%edx
+  800caf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  800cb2:	eb 03                	jmp    800cb7 <strtol+0x11>
+    s++;
+  800cb4:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  800cb7:	0f b6 02             	movzbl (%edx),%eax
+  800cba:	3c 20                	cmp    $0x20,%al
+  800cbc:	74 f6                	je     800cb4 <strtol+0xe>
+  800cbe:	3c 09                	cmp    $0x9,%al
+  800cc0:	74 f2                	je     800cb4 <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  800cc2:	3c 2b                	cmp    $0x2b,%al
+  800cc4:	74 2a                	je     800cf0 <strtol+0x4a>
+  int neg = 0;
+  800cc6:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  800ccb:	3c 2d                	cmp    $0x2d,%al
+  800ccd:	74 2b                	je     800cfa <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ccf:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800cd5:	75 0f                	jne    800ce6 <strtol+0x40>
+  800cd7:	80 3a 30             	cmpb   $0x30,(%edx)
+  800cda:	74 28                	je     800d04 <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  800cdc:	85 db                	test   %ebx,%ebx
+  800cde:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ce3:	0f 44 d8             	cmove  %eax,%ebx
+  800ce6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ceb:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800cee:	eb 46                	jmp    800d36 <strtol+0x90>
+    s++;
+  800cf0:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  800cf3:	bf 00 00 00 00       	mov    $0x0,%edi
+  800cf8:	eb d5                	jmp    800ccf <strtol+0x29>
+    s++, neg = 1;
+  800cfa:	83 c2 01             	add    $0x1,%edx
+  800cfd:	bf 01 00 00 00       	mov    $0x1,%edi
+  800d02:	eb cb                	jmp    800ccf <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d04:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800d08:	74 0e                	je     800d18 <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  800d0a:	85 db                	test   %ebx,%ebx
+  800d0c:	75 d8                	jne    800ce6 <strtol+0x40>
+    s++, base = 8;
+  800d0e:	83 c2 01             	add    $0x1,%edx
+  800d11:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800d16:	eb ce                	jmp    800ce6 <strtol+0x40>
+    s += 2, base = 16;
+  800d18:	83 c2 02             	add    $0x2,%edx
+  800d1b:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800d20:	eb c4                	jmp    800ce6 <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  800d22:	0f be c0             	movsbl %al,%eax
+  800d25:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  800d28:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800d2b:	7d 3a                	jge    800d67 <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  800d2d:	83 c2 01             	add    $0x1,%edx
+  800d30:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800d34:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  800d36:	0f b6 02             	movzbl (%edx),%eax
+  800d39:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800d3c:	89 f3                	mov    %esi,%ebx
+  800d3e:	80 fb 09             	cmp    $0x9,%bl
+  800d41:	76 df                	jbe    800d22 <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  800d43:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800d46:	89 f3                	mov    %esi,%ebx
+  800d48:	80 fb 19             	cmp    $0x19,%bl
+  800d4b:	77 08                	ja     800d55 <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  800d4d:	0f be c0             	movsbl %al,%eax
+  800d50:	83 e8 57             	sub    $0x57,%eax
+  800d53:	eb d3                	jmp    800d28 <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  800d55:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800d58:	89 f3                	mov    %esi,%ebx
+  800d5a:	80 fb 19             	cmp    $0x19,%bl
+  800d5d:	77 08                	ja     800d67 <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  800d5f:	0f be c0             	movsbl %al,%eax
+  800d62:	83 e8 37             	sub    $0x37,%eax
+  800d65:	eb c1                	jmp    800d28 <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  800d67:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800d6b:	74 05                	je     800d72 <strtol+0xcc>
+    *endptr = (char*)s;
+  800d6d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d70:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  800d72:	89 c8                	mov    %ecx,%eax
+  800d74:	f7 d8                	neg    %eax
+  800d76:	85 ff                	test   %edi,%edi
+  800d78:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800d7b:	89 c8                	mov    %ecx,%eax
+  800d7d:	5b                   	pop    %ebx
+  800d7e:	5e                   	pop    %esi
+  800d7f:	5f                   	pop    %edi
+  800d80:	5d                   	pop    %ebp
+  800d81:	c3                   	ret
+
+00800d82 <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800d82:	55                   	push   %ebp
+  800d83:	89 e5                	mov    %esp,%ebp
+  800d85:	57                   	push   %edi
+  800d86:	56                   	push   %esi
+  800d87:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d88:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d8d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d90:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d93:	89 c3                	mov    %eax,%ebx
+  800d95:	89 c7                	mov    %eax,%edi
+  800d97:	89 c6                	mov    %eax,%esi
+  800d99:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800d9b:	5b                   	pop    %ebx
+  800d9c:	5e                   	pop    %esi
+  800d9d:	5f                   	pop    %edi
+  800d9e:	5d                   	pop    %ebp
+  800d9f:	c3                   	ret
+
+00800da0 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800da0:	55                   	push   %ebp
+  800da1:	89 e5                	mov    %esp,%ebp
+  800da3:	57                   	push   %edi
+  800da4:	56                   	push   %esi
+  800da5:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800da6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dab:	b8 01 00 00 00       	mov    $0x1,%eax
+  800db0:	89 d1                	mov    %edx,%ecx
+  800db2:	89 d3                	mov    %edx,%ebx
+  800db4:	89 d7                	mov    %edx,%edi
+  800db6:	89 d6                	mov    %edx,%esi
+  800db8:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800dba:	5b                   	pop    %ebx
+  800dbb:	5e                   	pop    %esi
+  800dbc:	5f                   	pop    %edi
+  800dbd:	5d                   	pop    %ebp
+  800dbe:	c3                   	ret
+
+00800dbf <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800dbf:	55                   	push   %ebp
+  800dc0:	89 e5                	mov    %esp,%ebp
+  800dc2:	57                   	push   %edi
+  800dc3:	56                   	push   %esi
+  800dc4:	53                   	push   %ebx
+  800dc5:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800dc8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800dcd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dd0:	b8 03 00 00 00       	mov    $0x3,%eax
+  800dd5:	89 cb                	mov    %ecx,%ebx
+  800dd7:	89 cf                	mov    %ecx,%edi
+  800dd9:	89 ce                	mov    %ecx,%esi
+  800ddb:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ddd:	85 c0                	test   %eax,%eax
+  800ddf:	7f 08                	jg     800de9 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800de1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800de4:	5b                   	pop    %ebx
+  800de5:	5e                   	pop    %esi
+  800de6:	5f                   	pop    %edi
+  800de7:	5d                   	pop    %ebp
+  800de8:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800de9:	83 ec 0c             	sub    $0xc,%esp
+  800dec:	50                   	push   %eax
+  800ded:	6a 03                	push   $0x3
+  800def:	68 23 35 80 00       	push   $0x803523
+  800df4:	6a 23                	push   $0x23
+  800df6:	68 40 35 80 00       	push   $0x803540
+  800dfb:	e8 89 f5 ff ff       	call   800389 <_panic>
+
+00800e00 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800e00:	55                   	push   %ebp
+  800e01:	89 e5                	mov    %esp,%ebp
+  800e03:	57                   	push   %edi
+  800e04:	56                   	push   %esi
+  800e05:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e06:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e0b:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e10:	89 d1                	mov    %edx,%ecx
+  800e12:	89 d3                	mov    %edx,%ebx
+  800e14:	89 d7                	mov    %edx,%edi
+  800e16:	89 d6                	mov    %edx,%esi
+  800e18:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800e1a:	5b                   	pop    %ebx
+  800e1b:	5e                   	pop    %esi
+  800e1c:	5f                   	pop    %edi
+  800e1d:	5d                   	pop    %ebp
+  800e1e:	c3                   	ret
+
+00800e1f <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800e1f:	55                   	push   %ebp
+  800e20:	89 e5                	mov    %esp,%ebp
+  800e22:	57                   	push   %edi
+  800e23:	56                   	push   %esi
+  800e24:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e25:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e2a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e2f:	89 d1                	mov    %edx,%ecx
+  800e31:	89 d3                	mov    %edx,%ebx
+  800e33:	89 d7                	mov    %edx,%edi
+  800e35:	89 d6                	mov    %edx,%esi
+  800e37:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800e39:	5b                   	pop    %ebx
+  800e3a:	5e                   	pop    %esi
+  800e3b:	5f                   	pop    %edi
+  800e3c:	5d                   	pop    %ebp
+  800e3d:	c3                   	ret
+
+00800e3e <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  800e3e:	55                   	push   %ebp
+  800e3f:	89 e5                	mov    %esp,%ebp
+  800e41:	57                   	push   %edi
+  800e42:	56                   	push   %esi
+  800e43:	53                   	push   %ebx
+  800e44:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  800e47:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  800e4b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e50:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e53:	b8 14 00 00 00       	mov    $0x14,%eax
+  800e58:	89 df                	mov    %ebx,%edi
+  800e5a:	89 de                	mov    %ebx,%esi
+  800e5c:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e5e:	85 c0                	test   %eax,%eax
+  800e60:	7f 08                	jg     800e6a <sys_env_set_cow+0x2c>
+}
+  800e62:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e65:	5b                   	pop    %ebx
+  800e66:	5e                   	pop    %esi
+  800e67:	5f                   	pop    %edi
+  800e68:	5d                   	pop    %ebp
+  800e69:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e6a:	83 ec 0c             	sub    $0xc,%esp
+  800e6d:	50                   	push   %eax
+  800e6e:	6a 14                	push   $0x14
+  800e70:	68 23 35 80 00       	push   $0x803523
+  800e75:	6a 23                	push   $0x23
+  800e77:	68 40 35 80 00       	push   $0x803540
+  800e7c:	e8 08 f5 ff ff       	call   800389 <_panic>
+
+00800e81 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800e81:	55                   	push   %ebp
+  800e82:	89 e5                	mov    %esp,%ebp
+  800e84:	57                   	push   %edi
+  800e85:	56                   	push   %esi
+  800e86:	53                   	push   %ebx
+  800e87:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e8a:	be 00 00 00 00       	mov    $0x0,%esi
+  800e8f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e92:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e95:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e9a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e9d:	89 f7                	mov    %esi,%edi
+  800e9f:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ea1:	85 c0                	test   %eax,%eax
+  800ea3:	7f 08                	jg     800ead <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  800ea5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ea8:	5b                   	pop    %ebx
+  800ea9:	5e                   	pop    %esi
+  800eaa:	5f                   	pop    %edi
+  800eab:	5d                   	pop    %ebp
+  800eac:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ead:	83 ec 0c             	sub    $0xc,%esp
+  800eb0:	50                   	push   %eax
+  800eb1:	6a 04                	push   $0x4
+  800eb3:	68 23 35 80 00       	push   $0x803523
+  800eb8:	6a 23                	push   $0x23
+  800eba:	68 40 35 80 00       	push   $0x803540
+  800ebf:	e8 c5 f4 ff ff       	call   800389 <_panic>
+
+00800ec4 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800ec4:	55                   	push   %ebp
+  800ec5:	89 e5                	mov    %esp,%ebp
+  800ec7:	57                   	push   %edi
+  800ec8:	56                   	push   %esi
+  800ec9:	53                   	push   %ebx
+  800eca:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800ecd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ed0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ed3:	b8 05 00 00 00       	mov    $0x5,%eax
+  800ed8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800edb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ede:	8b 75 18             	mov    0x18(%ebp),%esi
+  800ee1:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ee3:	85 c0                	test   %eax,%eax
+  800ee5:	7f 08                	jg     800eef <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  800ee7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eea:	5b                   	pop    %ebx
+  800eeb:	5e                   	pop    %esi
+  800eec:	5f                   	pop    %edi
+  800eed:	5d                   	pop    %ebp
+  800eee:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800eef:	83 ec 0c             	sub    $0xc,%esp
+  800ef2:	50                   	push   %eax
+  800ef3:	6a 05                	push   $0x5
+  800ef5:	68 23 35 80 00       	push   $0x803523
+  800efa:	6a 23                	push   $0x23
+  800efc:	68 40 35 80 00       	push   $0x803540
+  800f01:	e8 83 f4 ff ff       	call   800389 <_panic>
+
+00800f06 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800f06:	55                   	push   %ebp
+  800f07:	89 e5                	mov    %esp,%ebp
+  800f09:	57                   	push   %edi
+  800f0a:	56                   	push   %esi
+  800f0b:	53                   	push   %ebx
+  800f0c:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f0f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f14:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f17:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f1a:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f1f:	89 df                	mov    %ebx,%edi
+  800f21:	89 de                	mov    %ebx,%esi
+  800f23:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f25:	85 c0                	test   %eax,%eax
+  800f27:	7f 08                	jg     800f31 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  800f29:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f2c:	5b                   	pop    %ebx
+  800f2d:	5e                   	pop    %esi
+  800f2e:	5f                   	pop    %edi
+  800f2f:	5d                   	pop    %ebp
+  800f30:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f31:	83 ec 0c             	sub    $0xc,%esp
+  800f34:	50                   	push   %eax
+  800f35:	6a 06                	push   $0x6
+  800f37:	68 23 35 80 00       	push   $0x803523
+  800f3c:	6a 23                	push   $0x23
+  800f3e:	68 40 35 80 00       	push   $0x803540
+  800f43:	e8 41 f4 ff ff       	call   800389 <_panic>
+
+00800f48 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  800f48:	55                   	push   %ebp
+  800f49:	89 e5                	mov    %esp,%ebp
+  800f4b:	57                   	push   %edi
+  800f4c:	56                   	push   %esi
+  800f4d:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f4e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f51:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f54:	b8 11 00 00 00       	mov    $0x11,%eax
+  800f59:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f5c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f5f:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f62:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  800f64:	5b                   	pop    %ebx
+  800f65:	5e                   	pop    %esi
+  800f66:	5f                   	pop    %edi
+  800f67:	5d                   	pop    %ebp
+  800f68:	c3                   	ret
+
+00800f69 <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  800f69:	55                   	push   %ebp
+  800f6a:	89 e5                	mov    %esp,%ebp
+  800f6c:	57                   	push   %edi
+  800f6d:	56                   	push   %esi
+  800f6e:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f6f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f72:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f75:	b8 12 00 00 00       	mov    $0x12,%eax
+  800f7a:	be 00 00 00 00       	mov    $0x0,%esi
+  800f7f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f82:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f85:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  800f87:	5b                   	pop    %ebx
+  800f88:	5e                   	pop    %esi
+  800f89:	5f                   	pop    %edi
+  800f8a:	5d                   	pop    %ebp
+  800f8b:	c3                   	ret
+
+00800f8c <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  800f8c:	55                   	push   %ebp
+  800f8d:	89 e5                	mov    %esp,%ebp
+  800f8f:	57                   	push   %edi
+  800f90:	56                   	push   %esi
+  800f91:	53                   	push   %ebx
+  800f92:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f95:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f9a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f9d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fa0:	b8 16 00 00 00       	mov    $0x16,%eax
+  800fa5:	89 df                	mov    %ebx,%edi
+  800fa7:	89 de                	mov    %ebx,%esi
+  800fa9:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800fab:	85 c0                	test   %eax,%eax
+  800fad:	7f 08                	jg     800fb7 <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  800faf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fb2:	5b                   	pop    %ebx
+  800fb3:	5e                   	pop    %esi
+  800fb4:	5f                   	pop    %edi
+  800fb5:	5d                   	pop    %ebp
+  800fb6:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800fb7:	83 ec 0c             	sub    $0xc,%esp
+  800fba:	50                   	push   %eax
+  800fbb:	6a 16                	push   $0x16
+  800fbd:	68 23 35 80 00       	push   $0x803523
+  800fc2:	6a 23                	push   $0x23
+  800fc4:	68 40 35 80 00       	push   $0x803540
+  800fc9:	e8 bb f3 ff ff       	call   800389 <_panic>
+
+00800fce <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  800fce:	55                   	push   %ebp
+  800fcf:	89 e5                	mov    %esp,%ebp
+  800fd1:	57                   	push   %edi
+  800fd2:	56                   	push   %esi
+  800fd3:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800fd4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fd9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fdc:	b8 17 00 00 00       	mov    $0x17,%eax
+  800fe1:	89 cb                	mov    %ecx,%ebx
+  800fe3:	89 cf                	mov    %ecx,%edi
+  800fe5:	89 ce                	mov    %ecx,%esi
+  800fe7:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  800fe9:	5b                   	pop    %ebx
+  800fea:	5e                   	pop    %esi
+  800feb:	5f                   	pop    %edi
+  800fec:	5d                   	pop    %ebp
+  800fed:	c3                   	ret
+
+00800fee <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  800fee:	55                   	push   %ebp
+  800fef:	89 e5                	mov    %esp,%ebp
+  800ff1:	57                   	push   %edi
+  800ff2:	56                   	push   %esi
+  800ff3:	53                   	push   %ebx
+  800ff4:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800ff7:	be 00 00 00 00       	mov    $0x0,%esi
+  800ffc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801002:	b8 18 00 00 00       	mov    $0x18,%eax
+  801007:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80100a:	89 f7                	mov    %esi,%edi
+  80100c:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80100e:	85 c0                	test   %eax,%eax
+  801010:	7f 08                	jg     80101a <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  801012:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801015:	5b                   	pop    %ebx
+  801016:	5e                   	pop    %esi
+  801017:	5f                   	pop    %edi
+  801018:	5d                   	pop    %ebp
+  801019:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80101a:	83 ec 0c             	sub    $0xc,%esp
+  80101d:	50                   	push   %eax
+  80101e:	6a 18                	push   $0x18
+  801020:	68 23 35 80 00       	push   $0x803523
+  801025:	6a 23                	push   $0x23
+  801027:	68 40 35 80 00       	push   $0x803540
+  80102c:	e8 58 f3 ff ff       	call   800389 <_panic>
+
+00801031 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  801031:	55                   	push   %ebp
+  801032:	89 e5                	mov    %esp,%ebp
+  801034:	57                   	push   %edi
+  801035:	56                   	push   %esi
+  801036:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801037:	be 00 00 00 00       	mov    $0x0,%esi
+  80103c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80103f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801042:	b8 19 00 00 00       	mov    $0x19,%eax
+  801047:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80104a:	89 f7                	mov    %esi,%edi
+  80104c:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  80104e:	5b                   	pop    %ebx
+  80104f:	5e                   	pop    %esi
+  801050:	5f                   	pop    %edi
+  801051:	5d                   	pop    %ebp
+  801052:	c3                   	ret
+
+00801053 <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  801053:	55                   	push   %ebp
+  801054:	89 e5                	mov    %esp,%ebp
+  801056:	57                   	push   %edi
+  801057:	56                   	push   %esi
+  801058:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801059:	ba 00 00 00 00       	mov    $0x0,%edx
+  80105e:	b8 15 00 00 00       	mov    $0x15,%eax
+  801063:	89 d1                	mov    %edx,%ecx
+  801065:	89 d3                	mov    %edx,%ebx
+  801067:	89 d7                	mov    %edx,%edi
+  801069:	89 d6                	mov    %edx,%esi
+  80106b:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  80106d:	5b                   	pop    %ebx
+  80106e:	5e                   	pop    %esi
+  80106f:	5f                   	pop    %edi
+  801070:	5d                   	pop    %ebp
+  801071:	c3                   	ret
+
+00801072 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801072:	55                   	push   %ebp
+  801073:	89 e5                	mov    %esp,%ebp
+  801075:	57                   	push   %edi
+  801076:	56                   	push   %esi
+  801077:	53                   	push   %ebx
+  801078:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80107b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801080:	8b 55 08             	mov    0x8(%ebp),%edx
+  801083:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801086:	b8 08 00 00 00       	mov    $0x8,%eax
+  80108b:	89 df                	mov    %ebx,%edi
+  80108d:	89 de                	mov    %ebx,%esi
+  80108f:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801091:	85 c0                	test   %eax,%eax
+  801093:	7f 08                	jg     80109d <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801095:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801098:	5b                   	pop    %ebx
+  801099:	5e                   	pop    %esi
+  80109a:	5f                   	pop    %edi
+  80109b:	5d                   	pop    %ebp
+  80109c:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80109d:	83 ec 0c             	sub    $0xc,%esp
+  8010a0:	50                   	push   %eax
+  8010a1:	6a 08                	push   $0x8
+  8010a3:	68 23 35 80 00       	push   $0x803523
+  8010a8:	6a 23                	push   $0x23
+  8010aa:	68 40 35 80 00       	push   $0x803540
+  8010af:	e8 d5 f2 ff ff       	call   800389 <_panic>
+
+008010b4 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8010b4:	55                   	push   %ebp
+  8010b5:	89 e5                	mov    %esp,%ebp
+  8010b7:	57                   	push   %edi
+  8010b8:	56                   	push   %esi
+  8010b9:	53                   	push   %ebx
+  8010ba:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8010bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010c8:	b8 09 00 00 00       	mov    $0x9,%eax
+  8010cd:	89 df                	mov    %ebx,%edi
+  8010cf:	89 de                	mov    %ebx,%esi
+  8010d1:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8010d3:	85 c0                	test   %eax,%eax
+  8010d5:	7f 08                	jg     8010df <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  8010d7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010da:	5b                   	pop    %ebx
+  8010db:	5e                   	pop    %esi
+  8010dc:	5f                   	pop    %edi
+  8010dd:	5d                   	pop    %ebp
+  8010de:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8010df:	83 ec 0c             	sub    $0xc,%esp
+  8010e2:	50                   	push   %eax
+  8010e3:	6a 09                	push   $0x9
+  8010e5:	68 23 35 80 00       	push   $0x803523
+  8010ea:	6a 23                	push   $0x23
+  8010ec:	68 40 35 80 00       	push   $0x803540
+  8010f1:	e8 93 f2 ff ff       	call   800389 <_panic>
+
+008010f6 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8010f6:	55                   	push   %ebp
+  8010f7:	89 e5                	mov    %esp,%ebp
+  8010f9:	57                   	push   %edi
+  8010fa:	56                   	push   %esi
+  8010fb:	53                   	push   %ebx
+  8010fc:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8010ff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801104:	8b 55 08             	mov    0x8(%ebp),%edx
+  801107:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80110a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80110f:	89 df                	mov    %ebx,%edi
+  801111:	89 de                	mov    %ebx,%esi
+  801113:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801115:	85 c0                	test   %eax,%eax
+  801117:	7f 08                	jg     801121 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  801119:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80111c:	5b                   	pop    %ebx
+  80111d:	5e                   	pop    %esi
+  80111e:	5f                   	pop    %edi
+  80111f:	5d                   	pop    %ebp
+  801120:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801121:	83 ec 0c             	sub    $0xc,%esp
+  801124:	50                   	push   %eax
+  801125:	6a 0a                	push   $0xa
+  801127:	68 23 35 80 00       	push   $0x803523
+  80112c:	6a 23                	push   $0x23
+  80112e:	68 40 35 80 00       	push   $0x803540
+  801133:	e8 51 f2 ff ff       	call   800389 <_panic>
+
+00801138 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  801138:	55                   	push   %ebp
+  801139:	89 e5                	mov    %esp,%ebp
+  80113b:	57                   	push   %edi
+  80113c:	56                   	push   %esi
+  80113d:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80113e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801141:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801144:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801149:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80114c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80114f:	8b 75 18             	mov    0x18(%ebp),%esi
+  801152:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  801154:	5b                   	pop    %ebx
+  801155:	5e                   	pop    %esi
+  801156:	5f                   	pop    %edi
+  801157:	5d                   	pop    %ebp
+  801158:	c3                   	ret
+
+00801159 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  801159:	55                   	push   %ebp
+  80115a:	89 e5                	mov    %esp,%ebp
+  80115c:	57                   	push   %edi
+  80115d:	56                   	push   %esi
+  80115e:	53                   	push   %ebx
+  80115f:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801162:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801167:	8b 55 08             	mov    0x8(%ebp),%edx
+  80116a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80116d:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801172:	89 df                	mov    %ebx,%edi
+  801174:	89 de                	mov    %ebx,%esi
+  801176:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801178:	85 c0                	test   %eax,%eax
+  80117a:	7f 08                	jg     801184 <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  80117c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80117f:	5b                   	pop    %ebx
+  801180:	5e                   	pop    %esi
+  801181:	5f                   	pop    %edi
+  801182:	5d                   	pop    %ebp
+  801183:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801184:	83 ec 0c             	sub    $0xc,%esp
+  801187:	50                   	push   %eax
+  801188:	6a 0d                	push   $0xd
+  80118a:	68 23 35 80 00       	push   $0x803523
+  80118f:	6a 23                	push   $0x23
+  801191:	68 40 35 80 00       	push   $0x803540
+  801196:	e8 ee f1 ff ff       	call   800389 <_panic>
+
+0080119b <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  80119b:	55                   	push   %ebp
+  80119c:	89 e5                	mov    %esp,%ebp
+  80119e:	57                   	push   %edi
+  80119f:	56                   	push   %esi
+  8011a0:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8011a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011a6:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011ab:	89 d1                	mov    %edx,%ecx
+  8011ad:	89 d3                	mov    %edx,%ebx
+  8011af:	89 d7                	mov    %edx,%edi
+  8011b1:	89 d6                	mov    %edx,%esi
+  8011b3:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8011b5:	5b                   	pop    %ebx
+  8011b6:	5e                   	pop    %esi
+  8011b7:	5f                   	pop    %edi
+  8011b8:	5d                   	pop    %ebp
+  8011b9:	c3                   	ret
+
+008011ba <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  8011ba:	55                   	push   %ebp
+  8011bb:	89 e5                	mov    %esp,%ebp
+  8011bd:	57                   	push   %edi
+  8011be:	56                   	push   %esi
+  8011bf:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8011c0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011c3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011c6:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8011cb:	be 00 00 00 00       	mov    $0x0,%esi
+  8011d0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011d3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011d6:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  8011d8:	5b                   	pop    %ebx
+  8011d9:	5e                   	pop    %esi
+  8011da:	5f                   	pop    %edi
+  8011db:	5d                   	pop    %ebp
+  8011dc:	c3                   	ret
+
+008011dd <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  8011dd:	55                   	push   %ebp
+  8011de:	89 e5                	mov    %esp,%ebp
+  8011e0:	57                   	push   %edi
+  8011e1:	56                   	push   %esi
+  8011e2:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8011e3:	be 00 00 00 00       	mov    $0x0,%esi
+  8011e8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011eb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ee:	b8 10 00 00 00       	mov    $0x10,%eax
+  8011f3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011f6:	89 f7                	mov    %esi,%edi
+  8011f8:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  8011fa:	5b                   	pop    %ebx
+  8011fb:	5e                   	pop    %esi
+  8011fc:	5f                   	pop    %edi
+  8011fd:	5d                   	pop    %ebp
+  8011fe:	c3                   	ret
+
+008011ff <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  8011ff:	55                   	push   %ebp
+  801200:	89 e5                	mov    %esp,%ebp
+  801202:	57                   	push   %edi
+  801203:	56                   	push   %esi
+  801204:	53                   	push   %ebx
+  801205:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  801208:	80 3d 48 67 80 00 00 	cmpb   $0x0,0x806748
+  80120f:	74 41                	je     801252 <sys_batch+0x53>
+  801211:	8b 45 08             	mov    0x8(%ebp),%eax
+  801214:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  801217:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  80121e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801221:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  801224:	7d 45                	jge    80126b <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  801226:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801229:	8b 06                	mov    (%esi),%eax
+  80122b:	8b 56 04             	mov    0x4(%esi),%edx
+  80122e:	8b 4e 08             	mov    0x8(%esi),%ecx
+  801231:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  801234:	8b 7e 10             	mov    0x10(%esi),%edi
+  801237:	8b 76 14             	mov    0x14(%esi),%esi
+  80123a:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  80123c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80123f:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  801242:	83 c6 1c             	add    $0x1c,%esi
+  801245:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  801248:	85 c0                	test   %eax,%eax
+  80124a:	78 1f                	js     80126b <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  80124c:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  801250:	eb cc                	jmp    80121e <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  801252:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801257:	b8 13 00 00 00       	mov    $0x13,%eax
+  80125c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80125f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801262:	89 df                	mov    %ebx,%edi
+  801264:	89 de                	mov    %ebx,%esi
+  801266:	cd 30                	int    $0x30
+  801268:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  80126b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80126e:	83 c4 08             	add    $0x8,%esp
+  801271:	5b                   	pop    %ebx
+  801272:	5e                   	pop    %esi
+  801273:	5f                   	pop    %edi
+  801274:	5d                   	pop    %ebp
+  801275:	c3                   	ret
+
+00801276 <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  801276:	55                   	push   %ebp
+  801277:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  801279:	8b 45 08             	mov    0x8(%ebp),%eax
+  80127c:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  801282:	5d                   	pop    %ebp
+  801283:	c3                   	ret
+
+00801284 <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  801284:	55                   	push   %ebp
+  801285:	89 e5                	mov    %esp,%ebp
+  801287:	56                   	push   %esi
+  801288:	53                   	push   %ebx
+  801289:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  80128c:	8b 1e                	mov    (%esi),%ebx
+  80128e:	85 db                	test   %ebx,%ebx
+  801290:	75 09                	jne    80129b <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  801292:	89 d8                	mov    %ebx,%eax
+  801294:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801297:	5b                   	pop    %ebx
+  801298:	5e                   	pop    %esi
+  801299:	5d                   	pop    %ebp
+  80129a:	c3                   	ret
+  b->sb_n = 0;
+  80129b:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  8012a1:	53                   	push   %ebx
+  8012a2:	8d 46 04             	lea    0x4(%esi),%eax
+  8012a5:	50                   	push   %eax
+  8012a6:	e8 54 ff ff ff       	call   8011ff <sys_batch>
+  8012ab:	83 c4 08             	add    $0x8,%esp
+  8012ae:	85 c0                	test   %eax,%eax
+  8012b0:	78 1e                	js     8012d0 <sysbatch_flush+0x4c>
+  if (r < n)
+  8012b2:	39 c3                	cmp    %eax,%ebx
+  8012b4:	7f 07                	jg     8012bd <sysbatch_flush+0x39>
+  return 0;
+  8012b6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012bb:	eb d5                	jmp    801292 <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  8012bd:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8012c0:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  8012c4:	85 db                	test   %ebx,%ebx
+  8012c6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012cb:	0f 49 d8             	cmovns %eax,%ebx
+  8012ce:	eb c2                	jmp    801292 <sysbatch_flush+0xe>
+    return r;
+  8012d0:	89 c3                	mov    %eax,%ebx
+  8012d2:	eb be                	jmp    801292 <sysbatch_flush+0xe>
+
+008012d4 <sysbatch_add>:
+{
+  8012d4:	55                   	push   %ebp
+  8012d5:	89 e5                	mov    %esp,%ebp
+  8012d7:	53                   	push   %ebx
+  8012d8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  8012db:	83 3b 40             	cmpl   $0x40,(%ebx)
+  8012de:	74 41                	je     801321 <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  8012e0:	8b 03                	mov    (%ebx),%eax
+  8012e2:	8d 50 01             	lea    0x1(%eax),%edx
+  8012e5:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  8012e7:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8012ea:	01 d8                	add    %ebx,%eax
+  8012ec:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8012ef:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  8012f2:	8b 55 10             	mov    0x10(%ebp),%edx
+  8012f5:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  8012f8:	8b 55 14             	mov    0x14(%ebp),%edx
+  8012fb:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  8012fe:	8b 55 18             	mov    0x18(%ebp),%edx
+  801301:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  801304:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  801307:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  80130a:	8b 55 20             	mov    0x20(%ebp),%edx
+  80130d:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  801310:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  801317:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80131c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80131f:	c9                   	leave
+  801320:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  801321:	53                   	push   %ebx
+  801322:	e8 5d ff ff ff       	call   801284 <sysbatch_flush>
+  801327:	83 c4 04             	add    $0x4,%esp
+  80132a:	85 c0                	test   %eax,%eax
+  80132c:	79 b2                	jns    8012e0 <sysbatch_add+0xc>
+  80132e:	eb ec                	jmp    80131c <sysbatch_add+0x48>
+
+00801330 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801330:	55                   	push   %ebp
+  801331:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801333:	8b 45 08             	mov    0x8(%ebp),%eax
+  801336:	05 00 00 00 30       	add    $0x30000000,%eax
+  80133b:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80133e:	5d                   	pop    %ebp
+  80133f:	c3                   	ret
+
+00801340 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801340:	55                   	push   %ebp
+  801341:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801343:	8b 45 08             	mov    0x8(%ebp),%eax
+  801346:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  801349:	66 b8 00 00          	mov    $0x0,%ax
+  80134d:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801352:	5d                   	pop    %ebp
+  801353:	c3                   	ret
+
+00801354 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801354:	55                   	push   %ebp
+  801355:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  801357:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80135c:	eb 02                	jmp    801360 <fd_alloc+0xc>
+  80135e:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801360:	89 c2                	mov    %eax,%edx
+  801362:	c1 ea 16             	shr    $0x16,%edx
+  801365:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80136c:	f6 c2 01             	test   $0x1,%dl
+  80136f:	74 2b                	je     80139c <fd_alloc+0x48>
+  801371:	89 c2                	mov    %eax,%edx
+  801373:	c1 ea 0c             	shr    $0xc,%edx
+  801376:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80137d:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801383:	f6 c1 01             	test   $0x1,%cl
+  801386:	74 14                	je     80139c <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  801388:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  80138e:	75 ce                	jne    80135e <fd_alloc+0xa>
+  801390:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  801395:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80139a:	eb 05                	jmp    8013a1 <fd_alloc+0x4d>
+      return 0;
+  80139c:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  8013a1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013a4:	89 02                	mov    %eax,(%edx)
+}
+  8013a6:	89 c8                	mov    %ecx,%eax
+  8013a8:	5d                   	pop    %ebp
+  8013a9:	c3                   	ret
+
+008013aa <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8013aa:	55                   	push   %ebp
+  8013ab:	89 e5                	mov    %esp,%ebp
+  8013ad:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  8013b0:	83 f8 1f             	cmp    $0x1f,%eax
+  8013b3:	77 30                	ja     8013e5 <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  8013b5:	c1 e0 0c             	shl    $0xc,%eax
+  8013b8:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8013bd:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8013c3:	f6 c2 01             	test   $0x1,%dl
+  8013c6:	74 24                	je     8013ec <fd_lookup+0x42>
+  8013c8:	89 c2                	mov    %eax,%edx
+  8013ca:	c1 ea 0c             	shr    $0xc,%edx
+  8013cd:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8013d4:	f6 c2 01             	test   $0x1,%dl
+  8013d7:	74 1a                	je     8013f3 <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  8013d9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8013dc:	89 02                	mov    %eax,(%edx)
+  return 0;
+  8013de:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013e3:	5d                   	pop    %ebp
+  8013e4:	c3                   	ret
+    return -E_INVAL;
+  8013e5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013ea:	eb f7                	jmp    8013e3 <fd_lookup+0x39>
+    return -E_INVAL;
+  8013ec:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013f1:	eb f0                	jmp    8013e3 <fd_lookup+0x39>
+  8013f3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013f8:	eb e9                	jmp    8013e3 <fd_lookup+0x39>
+
+008013fa <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8013fa:	55                   	push   %ebp
+  8013fb:	89 e5                	mov    %esp,%ebp
+  8013fd:	53                   	push   %ebx
+  8013fe:	83 ec 04             	sub    $0x4,%esp
+  801401:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  801404:	b8 cc 35 80 00       	mov    $0x8035cc,%eax
+  801409:	8b 18                	mov    (%eax),%ebx
+  80140b:	85 db                	test   %ebx,%ebx
+  80140d:	74 0e                	je     80141d <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  80140f:	83 c0 04             	add    $0x4,%eax
+  801412:	39 13                	cmp    %edx,(%ebx)
+  801414:	75 f3                	jne    801409 <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  801416:	b8 00 00 00 00       	mov    $0x0,%eax
+  80141b:	eb 1f                	jmp    80143c <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80141d:	a1 44 67 80 00       	mov    0x806744,%eax
+  801422:	8b 40 48             	mov    0x48(%eax),%eax
+  801425:	83 ec 04             	sub    $0x4,%esp
+  801428:	52                   	push   %edx
+  801429:	50                   	push   %eax
+  80142a:	68 50 35 80 00       	push   $0x803550
+  80142f:	e8 30 f0 ff ff       	call   800464 <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  801434:	83 c4 10             	add    $0x10,%esp
+  801437:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  80143c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80143f:	89 1a                	mov    %ebx,(%edx)
+}
+  801441:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801444:	c9                   	leave
+  801445:	c3                   	ret
+
+00801446 <fd_close>:
+{
+  801446:	55                   	push   %ebp
+  801447:	89 e5                	mov    %esp,%ebp
+  801449:	57                   	push   %edi
+  80144a:	56                   	push   %esi
+  80144b:	53                   	push   %ebx
+  80144c:	83 ec 24             	sub    $0x24,%esp
+  80144f:	8b 75 08             	mov    0x8(%ebp),%esi
+  801452:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801455:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801458:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801459:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80145f:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801462:	50                   	push   %eax
+  801463:	e8 42 ff ff ff       	call   8013aa <fd_lookup>
+  801468:	89 c3                	mov    %eax,%ebx
+  80146a:	83 c4 10             	add    $0x10,%esp
+  80146d:	85 c0                	test   %eax,%eax
+  80146f:	78 05                	js     801476 <fd_close+0x30>
+      || fd != fd2)
+  801471:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801474:	74 16                	je     80148c <fd_close+0x46>
+    return must_exist ? r : 0;
+  801476:	89 f8                	mov    %edi,%eax
+  801478:	84 c0                	test   %al,%al
+  80147a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80147f:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801482:	89 d8                	mov    %ebx,%eax
+  801484:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801487:	5b                   	pop    %ebx
+  801488:	5e                   	pop    %esi
+  801489:	5f                   	pop    %edi
+  80148a:	5d                   	pop    %ebp
+  80148b:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80148c:	83 ec 08             	sub    $0x8,%esp
+  80148f:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801492:	50                   	push   %eax
+  801493:	ff 36                	push   (%esi)
+  801495:	e8 60 ff ff ff       	call   8013fa <dev_lookup>
+  80149a:	89 c3                	mov    %eax,%ebx
+  80149c:	83 c4 10             	add    $0x10,%esp
+  80149f:	85 c0                	test   %eax,%eax
+  8014a1:	78 1a                	js     8014bd <fd_close+0x77>
+    if (dev->dev_close)
+  8014a3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8014a6:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  8014a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  8014ae:	85 c0                	test   %eax,%eax
+  8014b0:	74 0b                	je     8014bd <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  8014b2:	83 ec 0c             	sub    $0xc,%esp
+  8014b5:	56                   	push   %esi
+  8014b6:	ff d0                	call   *%eax
+  8014b8:	89 c3                	mov    %eax,%ebx
+  8014ba:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  8014bd:	83 ec 08             	sub    $0x8,%esp
+  8014c0:	56                   	push   %esi
+  8014c1:	6a 00                	push   $0x0
+  8014c3:	e8 3e fa ff ff       	call   800f06 <sys_page_unmap>
+  return r;
+  8014c8:	83 c4 10             	add    $0x10,%esp
+  8014cb:	eb b5                	jmp    801482 <fd_close+0x3c>
+
+008014cd <close>:
+
+int
+close(int fdnum)
+{
+  8014cd:	55                   	push   %ebp
+  8014ce:	89 e5                	mov    %esp,%ebp
+  8014d0:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8014d3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014d6:	50                   	push   %eax
+  8014d7:	ff 75 08             	push   0x8(%ebp)
+  8014da:	e8 cb fe ff ff       	call   8013aa <fd_lookup>
+  8014df:	83 c4 10             	add    $0x10,%esp
+  8014e2:	85 c0                	test   %eax,%eax
+  8014e4:	79 02                	jns    8014e8 <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  8014e6:	c9                   	leave
+  8014e7:	c3                   	ret
+    return fd_close(fd, 1);
+  8014e8:	83 ec 08             	sub    $0x8,%esp
+  8014eb:	6a 01                	push   $0x1
+  8014ed:	ff 75 f4             	push   -0xc(%ebp)
+  8014f0:	e8 51 ff ff ff       	call   801446 <fd_close>
+  8014f5:	83 c4 10             	add    $0x10,%esp
+  8014f8:	eb ec                	jmp    8014e6 <close+0x19>
+
+008014fa <close_all>:
+
+void
+close_all(void)
+{
+  8014fa:	55                   	push   %ebp
+  8014fb:	89 e5                	mov    %esp,%ebp
+  8014fd:	53                   	push   %ebx
+  8014fe:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  801501:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  801506:	83 ec 0c             	sub    $0xc,%esp
+  801509:	53                   	push   %ebx
+  80150a:	e8 be ff ff ff       	call   8014cd <close>
+  for (i = 0; i < MAXFD; i++)
+  80150f:	83 c3 01             	add    $0x1,%ebx
+  801512:	83 c4 10             	add    $0x10,%esp
+  801515:	83 fb 20             	cmp    $0x20,%ebx
+  801518:	75 ec                	jne    801506 <close_all+0xc>
+}
+  80151a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80151d:	c9                   	leave
+  80151e:	c3                   	ret
+
+0080151f <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80151f:	55                   	push   %ebp
+  801520:	89 e5                	mov    %esp,%ebp
+  801522:	57                   	push   %edi
+  801523:	56                   	push   %esi
+  801524:	53                   	push   %ebx
+  801525:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801528:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80152b:	50                   	push   %eax
+  80152c:	ff 75 08             	push   0x8(%ebp)
+  80152f:	e8 76 fe ff ff       	call   8013aa <fd_lookup>
+  801534:	89 c6                	mov    %eax,%esi
+  801536:	83 c4 10             	add    $0x10,%esp
+  801539:	85 c0                	test   %eax,%eax
+  80153b:	0f 88 0a 01 00 00    	js     80164b <dup+0x12c>
+    return r;
+  close(newfdnum);
+  801541:	83 ec 0c             	sub    $0xc,%esp
+  801544:	ff 75 0c             	push   0xc(%ebp)
+  801547:	e8 81 ff ff ff       	call   8014cd <close>
+
+  newfd = INDEX2FD(newfdnum);
+  80154c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80154f:	c1 e0 0c             	shl    $0xc,%eax
+  801552:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  801558:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  80155b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80155e:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  801561:	89 04 24             	mov    %eax,(%esp)
+  801564:	e8 d7 fd ff ff       	call   801340 <fd2data>
+  801569:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  80156b:	89 3c 24             	mov    %edi,(%esp)
+  80156e:	e8 cd fd ff ff       	call   801340 <fd2data>
+  801573:	83 c4 10             	add    $0x10,%esp
+  801576:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801579:	89 f3                	mov    %esi,%ebx
+  80157b:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  801581:	89 c6                	mov    %eax,%esi
+  801583:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801586:	89 cf                	mov    %ecx,%edi
+  801588:	eb 0c                	jmp    801596 <dup+0x77>
+  80158a:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801590:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801596:	39 fb                	cmp    %edi,%ebx
+  801598:	74 7b                	je     801615 <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  80159a:	89 d8                	mov    %ebx,%eax
+  80159c:	c1 e8 16             	shr    $0x16,%eax
+  80159f:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8015a6:	a8 01                	test   $0x1,%al
+  8015a8:	74 e0                	je     80158a <dup+0x6b>
+  8015aa:	89 d8                	mov    %ebx,%eax
+  8015ac:	c1 e8 0c             	shr    $0xc,%eax
+  8015af:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8015b6:	f6 c2 01             	test   $0x1,%dl
+  8015b9:	74 cf                	je     80158a <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  8015bb:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  8015c2:	83 ec 0c             	sub    $0xc,%esp
+  8015c5:	25 07 0e 00 00       	and    $0xe07,%eax
+  8015ca:	50                   	push   %eax
+  8015cb:	56                   	push   %esi
+  8015cc:	6a 00                	push   $0x0
+  8015ce:	53                   	push   %ebx
+  8015cf:	6a 00                	push   $0x0
+  8015d1:	e8 ee f8 ff ff       	call   800ec4 <sys_page_map>
+  8015d6:	83 c4 20             	add    $0x20,%esp
+  8015d9:	85 c0                	test   %eax,%eax
+  8015db:	79 ad                	jns    80158a <dup+0x6b>
+  8015dd:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8015e0:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  8015e2:	83 ec 08             	sub    $0x8,%esp
+  8015e5:	ff 75 d4             	push   -0x2c(%ebp)
+  8015e8:	6a 00                	push   $0x0
+  8015ea:	e8 17 f9 ff ff       	call   800f06 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8015ef:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  8015f2:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  8015f8:	83 c4 10             	add    $0x10,%esp
+  8015fb:	39 df                	cmp    %ebx,%edi
+  8015fd:	74 4c                	je     80164b <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  8015ff:	83 ec 08             	sub    $0x8,%esp
+  801602:	57                   	push   %edi
+  801603:	6a 00                	push   $0x0
+  801605:	e8 fc f8 ff ff       	call   800f06 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80160a:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  801610:	83 c4 10             	add    $0x10,%esp
+  801613:	eb e6                	jmp    8015fb <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801615:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801618:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80161b:	89 c8                	mov    %ecx,%eax
+  80161d:	c1 e8 0c             	shr    $0xc,%eax
+  801620:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801627:	83 ec 0c             	sub    $0xc,%esp
+  80162a:	25 07 0e 00 00       	and    $0xe07,%eax
+  80162f:	50                   	push   %eax
+  801630:	ff 75 d4             	push   -0x2c(%ebp)
+  801633:	6a 00                	push   $0x0
+  801635:	51                   	push   %ecx
+  801636:	6a 00                	push   $0x0
+  801638:	e8 87 f8 ff ff       	call   800ec4 <sys_page_map>
+  80163d:	89 c6                	mov    %eax,%esi
+  80163f:	83 c4 20             	add    $0x20,%esp
+  801642:	85 c0                	test   %eax,%eax
+  801644:	78 9c                	js     8015e2 <dup+0xc3>
+  return newfdnum;
+  801646:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801649:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  80164b:	89 f0                	mov    %esi,%eax
+  80164d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801650:	5b                   	pop    %ebx
+  801651:	5e                   	pop    %esi
+  801652:	5f                   	pop    %edi
+  801653:	5d                   	pop    %ebp
+  801654:	c3                   	ret
+
+00801655 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801655:	55                   	push   %ebp
+  801656:	89 e5                	mov    %esp,%ebp
+  801658:	56                   	push   %esi
+  801659:	53                   	push   %ebx
+  80165a:	83 ec 18             	sub    $0x18,%esp
+  80165d:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801660:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801663:	50                   	push   %eax
+  801664:	56                   	push   %esi
+  801665:	e8 40 fd ff ff       	call   8013aa <fd_lookup>
+  80166a:	83 c4 10             	add    $0x10,%esp
+  80166d:	85 c0                	test   %eax,%eax
+  80166f:	78 3c                	js     8016ad <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801671:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801674:	83 ec 08             	sub    $0x8,%esp
+  801677:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80167a:	50                   	push   %eax
+  80167b:	ff 33                	push   (%ebx)
+  80167d:	e8 78 fd ff ff       	call   8013fa <dev_lookup>
+  801682:	83 c4 10             	add    $0x10,%esp
+  801685:	85 c0                	test   %eax,%eax
+  801687:	78 24                	js     8016ad <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801689:	8b 43 08             	mov    0x8(%ebx),%eax
+  80168c:	83 e0 03             	and    $0x3,%eax
+  80168f:	83 f8 01             	cmp    $0x1,%eax
+  801692:	74 20                	je     8016b4 <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  801694:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801697:	8b 40 08             	mov    0x8(%eax),%eax
+  80169a:	85 c0                	test   %eax,%eax
+  80169c:	74 37                	je     8016d5 <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  80169e:	83 ec 04             	sub    $0x4,%esp
+  8016a1:	ff 75 10             	push   0x10(%ebp)
+  8016a4:	ff 75 0c             	push   0xc(%ebp)
+  8016a7:	53                   	push   %ebx
+  8016a8:	ff d0                	call   *%eax
+  8016aa:	83 c4 10             	add    $0x10,%esp
+}
+  8016ad:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016b0:	5b                   	pop    %ebx
+  8016b1:	5e                   	pop    %esi
+  8016b2:	5d                   	pop    %ebp
+  8016b3:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8016b4:	a1 44 67 80 00       	mov    0x806744,%eax
+  8016b9:	8b 40 48             	mov    0x48(%eax),%eax
+  8016bc:	83 ec 04             	sub    $0x4,%esp
+  8016bf:	56                   	push   %esi
+  8016c0:	50                   	push   %eax
+  8016c1:	68 91 35 80 00       	push   $0x803591
+  8016c6:	e8 99 ed ff ff       	call   800464 <cprintf>
+    return -E_INVAL;
+  8016cb:	83 c4 10             	add    $0x10,%esp
+  8016ce:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016d3:	eb d8                	jmp    8016ad <read+0x58>
+    return -E_NOT_SUPP;
+  8016d5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016da:	eb d1                	jmp    8016ad <read+0x58>
+
+008016dc <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8016dc:	55                   	push   %ebp
+  8016dd:	89 e5                	mov    %esp,%ebp
+  8016df:	57                   	push   %edi
+  8016e0:	56                   	push   %esi
+  8016e1:	53                   	push   %ebx
+  8016e2:	83 ec 0c             	sub    $0xc,%esp
+  8016e5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8016e8:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  8016eb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016f0:	eb 02                	jmp    8016f4 <readn+0x18>
+  8016f2:	01 c3                	add    %eax,%ebx
+  8016f4:	39 f3                	cmp    %esi,%ebx
+  8016f6:	73 21                	jae    801719 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  8016f8:	83 ec 04             	sub    $0x4,%esp
+  8016fb:	89 f0                	mov    %esi,%eax
+  8016fd:	29 d8                	sub    %ebx,%eax
+  8016ff:	50                   	push   %eax
+  801700:	89 d8                	mov    %ebx,%eax
+  801702:	03 45 0c             	add    0xc(%ebp),%eax
+  801705:	50                   	push   %eax
+  801706:	57                   	push   %edi
+  801707:	e8 49 ff ff ff       	call   801655 <read>
+    if (m < 0)
+  80170c:	83 c4 10             	add    $0x10,%esp
+  80170f:	85 c0                	test   %eax,%eax
+  801711:	78 04                	js     801717 <readn+0x3b>
+      return m;
+    if (m == 0)
+  801713:	75 dd                	jne    8016f2 <readn+0x16>
+  801715:	eb 02                	jmp    801719 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  801717:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  801719:	89 d8                	mov    %ebx,%eax
+  80171b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80171e:	5b                   	pop    %ebx
+  80171f:	5e                   	pop    %esi
+  801720:	5f                   	pop    %edi
+  801721:	5d                   	pop    %ebp
+  801722:	c3                   	ret
+
+00801723 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801723:	55                   	push   %ebp
+  801724:	89 e5                	mov    %esp,%ebp
+  801726:	56                   	push   %esi
+  801727:	53                   	push   %ebx
+  801728:	83 ec 18             	sub    $0x18,%esp
+  80172b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  80172e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801731:	50                   	push   %eax
+  801732:	53                   	push   %ebx
+  801733:	e8 72 fc ff ff       	call   8013aa <fd_lookup>
+  801738:	83 c4 10             	add    $0x10,%esp
+  80173b:	85 c0                	test   %eax,%eax
+  80173d:	78 37                	js     801776 <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80173f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801742:	83 ec 08             	sub    $0x8,%esp
+  801745:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801748:	50                   	push   %eax
+  801749:	ff 36                	push   (%esi)
+  80174b:	e8 aa fc ff ff       	call   8013fa <dev_lookup>
+  801750:	83 c4 10             	add    $0x10,%esp
+  801753:	85 c0                	test   %eax,%eax
+  801755:	78 1f                	js     801776 <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801757:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80175b:	74 20                	je     80177d <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  80175d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801760:	8b 40 0c             	mov    0xc(%eax),%eax
+  801763:	85 c0                	test   %eax,%eax
+  801765:	74 37                	je     80179e <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  801767:	83 ec 04             	sub    $0x4,%esp
+  80176a:	ff 75 10             	push   0x10(%ebp)
+  80176d:	ff 75 0c             	push   0xc(%ebp)
+  801770:	56                   	push   %esi
+  801771:	ff d0                	call   *%eax
+  801773:	83 c4 10             	add    $0x10,%esp
+}
+  801776:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801779:	5b                   	pop    %ebx
+  80177a:	5e                   	pop    %esi
+  80177b:	5d                   	pop    %ebp
+  80177c:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80177d:	a1 44 67 80 00       	mov    0x806744,%eax
+  801782:	8b 40 48             	mov    0x48(%eax),%eax
+  801785:	83 ec 04             	sub    $0x4,%esp
+  801788:	53                   	push   %ebx
+  801789:	50                   	push   %eax
+  80178a:	68 ad 35 80 00       	push   $0x8035ad
+  80178f:	e8 d0 ec ff ff       	call   800464 <cprintf>
+    return -E_INVAL;
+  801794:	83 c4 10             	add    $0x10,%esp
+  801797:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80179c:	eb d8                	jmp    801776 <write+0x53>
+    return -E_NOT_SUPP;
+  80179e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017a3:	eb d1                	jmp    801776 <write+0x53>
+
+008017a5 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8017a5:	55                   	push   %ebp
+  8017a6:	89 e5                	mov    %esp,%ebp
+  8017a8:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8017ab:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017ae:	50                   	push   %eax
+  8017af:	ff 75 08             	push   0x8(%ebp)
+  8017b2:	e8 f3 fb ff ff       	call   8013aa <fd_lookup>
+  8017b7:	83 c4 10             	add    $0x10,%esp
+  8017ba:	85 c0                	test   %eax,%eax
+  8017bc:	78 0e                	js     8017cc <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  8017be:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8017c1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017c4:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  8017c7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017cc:	c9                   	leave
+  8017cd:	c3                   	ret
+
+008017ce <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8017ce:	55                   	push   %ebp
+  8017cf:	89 e5                	mov    %esp,%ebp
+  8017d1:	56                   	push   %esi
+  8017d2:	53                   	push   %ebx
+  8017d3:	83 ec 18             	sub    $0x18,%esp
+  8017d6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017d9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017dc:	50                   	push   %eax
+  8017dd:	53                   	push   %ebx
+  8017de:	e8 c7 fb ff ff       	call   8013aa <fd_lookup>
+  8017e3:	83 c4 10             	add    $0x10,%esp
+  8017e6:	85 c0                	test   %eax,%eax
+  8017e8:	78 34                	js     80181e <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017ea:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8017ed:	83 ec 08             	sub    $0x8,%esp
+  8017f0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017f3:	50                   	push   %eax
+  8017f4:	ff 36                	push   (%esi)
+  8017f6:	e8 ff fb ff ff       	call   8013fa <dev_lookup>
+  8017fb:	83 c4 10             	add    $0x10,%esp
+  8017fe:	85 c0                	test   %eax,%eax
+  801800:	78 1c                	js     80181e <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801802:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801806:	74 1d                	je     801825 <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  801808:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80180b:	8b 40 18             	mov    0x18(%eax),%eax
+  80180e:	85 c0                	test   %eax,%eax
+  801810:	74 34                	je     801846 <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  801812:	83 ec 08             	sub    $0x8,%esp
+  801815:	ff 75 0c             	push   0xc(%ebp)
+  801818:	56                   	push   %esi
+  801819:	ff d0                	call   *%eax
+  80181b:	83 c4 10             	add    $0x10,%esp
+}
+  80181e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801821:	5b                   	pop    %ebx
+  801822:	5e                   	pop    %esi
+  801823:	5d                   	pop    %ebp
+  801824:	c3                   	ret
+            thisenv->env_id, fdnum);
+  801825:	a1 44 67 80 00       	mov    0x806744,%eax
+  80182a:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80182d:	83 ec 04             	sub    $0x4,%esp
+  801830:	53                   	push   %ebx
+  801831:	50                   	push   %eax
+  801832:	68 70 35 80 00       	push   $0x803570
+  801837:	e8 28 ec ff ff       	call   800464 <cprintf>
+    return -E_INVAL;
+  80183c:	83 c4 10             	add    $0x10,%esp
+  80183f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801844:	eb d8                	jmp    80181e <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  801846:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80184b:	eb d1                	jmp    80181e <ftruncate+0x50>
+
+0080184d <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80184d:	55                   	push   %ebp
+  80184e:	89 e5                	mov    %esp,%ebp
+  801850:	56                   	push   %esi
+  801851:	53                   	push   %ebx
+  801852:	83 ec 18             	sub    $0x18,%esp
+  801855:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801858:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80185b:	50                   	push   %eax
+  80185c:	ff 75 08             	push   0x8(%ebp)
+  80185f:	e8 46 fb ff ff       	call   8013aa <fd_lookup>
+  801864:	83 c4 10             	add    $0x10,%esp
+  801867:	85 c0                	test   %eax,%eax
+  801869:	78 49                	js     8018b4 <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80186b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80186e:	83 ec 08             	sub    $0x8,%esp
+  801871:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801874:	50                   	push   %eax
+  801875:	ff 36                	push   (%esi)
+  801877:	e8 7e fb ff ff       	call   8013fa <dev_lookup>
+  80187c:	83 c4 10             	add    $0x10,%esp
+  80187f:	85 c0                	test   %eax,%eax
+  801881:	78 31                	js     8018b4 <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  801883:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801886:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80188a:	74 2f                	je     8018bb <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  80188c:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  80188f:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801896:	00 00 00 
+  stat->st_isdir = 0;
+  801899:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8018a0:	00 00 00 
+  stat->st_dev = dev;
+  8018a3:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  8018a9:	83 ec 08             	sub    $0x8,%esp
+  8018ac:	53                   	push   %ebx
+  8018ad:	56                   	push   %esi
+  8018ae:	ff 50 14             	call   *0x14(%eax)
+  8018b1:	83 c4 10             	add    $0x10,%esp
+}
+  8018b4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018b7:	5b                   	pop    %ebx
+  8018b8:	5e                   	pop    %esi
+  8018b9:	5d                   	pop    %ebp
+  8018ba:	c3                   	ret
+    return -E_NOT_SUPP;
+  8018bb:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8018c0:	eb f2                	jmp    8018b4 <fstat+0x67>
+
+008018c2 <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  8018c2:	55                   	push   %ebp
+  8018c3:	89 e5                	mov    %esp,%ebp
+  8018c5:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  8018c8:	ff 75 0c             	push   0xc(%ebp)
+  8018cb:	ff 75 08             	push   0x8(%ebp)
+  8018ce:	e8 58 07 00 00       	call   80202b <file_stat>
+}
+  8018d3:	c9                   	leave
+  8018d4:	c3                   	ret
+
+008018d5 <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  8018d5:	55                   	push   %ebp
+  8018d6:	89 e5                	mov    %esp,%ebp
+  8018d8:	57                   	push   %edi
+  8018d9:	56                   	push   %esi
+  8018da:	53                   	push   %ebx
+  8018db:	83 ec 1c             	sub    $0x1c,%esp
+  8018de:	89 c7                	mov    %eax,%edi
+  8018e0:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8018e3:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8018e6:	e9 a2 00 00 00       	jmp    80198d <fsipc_send+0xb8>
+  nfsenvs = 0;
+  8018eb:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  8018f2:	00 00 00 
+  8018f5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  8018ff:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801904:	be 01 00 00 00       	mov    $0x1,%esi
+  801909:	eb 0f                	jmp    80191a <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  80190b:	83 c0 01             	add    $0x1,%eax
+  80190e:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801913:	74 49                	je     80195e <fsipc_send+0x89>
+  801915:	83 f9 07             	cmp    $0x7,%ecx
+  801918:	7f 50                	jg     80196a <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  80191a:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  80191d:	c1 e2 04             	shl    $0x4,%edx
+  801920:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801926:	8b 52 50             	mov    0x50(%edx),%edx
+  801929:	83 fa 01             	cmp    $0x1,%edx
+  80192c:	75 dd                	jne    80190b <fsipc_send+0x36>
+  80192e:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801931:	c1 e2 04             	shl    $0x4,%edx
+  801934:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80193a:	8b 52 54             	mov    0x54(%edx),%edx
+  80193d:	85 d2                	test   %edx,%edx
+  80193f:	74 ca                	je     80190b <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801941:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801944:	c1 e2 04             	shl    $0x4,%edx
+  801947:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80194d:	8b 52 48             	mov    0x48(%edx),%edx
+  801950:	89 14 8d 20 60 80 00 	mov    %edx,0x806020(,%ecx,4)
+  801957:	8d 49 01             	lea    0x1(%ecx),%ecx
+  80195a:	89 f3                	mov    %esi,%ebx
+  80195c:	eb ad                	jmp    80190b <fsipc_send+0x36>
+  80195e:	84 db                	test   %bl,%bl
+  801960:	74 38                	je     80199a <fsipc_send+0xc5>
+  801962:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+  801968:	eb 30                	jmp    80199a <fsipc_send+0xc5>
+  80196a:	84 db                	test   %bl,%bl
+  80196c:	74 2c                	je     80199a <fsipc_send+0xc5>
+  80196e:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+  801974:	eb 24                	jmp    80199a <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  801976:	50                   	push   %eax
+  801977:	68 dc 35 80 00       	push   $0x8035dc
+  80197c:	6a 34                	push   $0x34
+  80197e:	68 e6 35 80 00       	push   $0x8035e6
+  801983:	e8 01 ea ff ff       	call   800389 <_panic>
+    }
+    sys_yield();
+  801988:	e8 92 f4 ff ff       	call   800e1f <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  80198d:	83 3d 00 60 80 00 03 	cmpl   $0x3,0x806000
+  801994:	0f 8e 51 ff ff ff    	jle    8018eb <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  80199a:	a1 44 67 80 00       	mov    0x806744,%eax
+  80199f:	8b 70 48             	mov    0x48(%eax),%esi
+  8019a2:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  8019a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019ad:	8b 0d 00 60 80 00    	mov    0x806000,%ecx
+  8019b3:	39 d9                	cmp    %ebx,%ecx
+  8019b5:	7e d1                	jle    801988 <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  8019b7:	83 ec 0c             	sub    $0xc,%esp
+  8019ba:	ff 75 e0             	push   -0x20(%ebp)
+  8019bd:	6a 07                	push   $0x7
+  8019bf:	ff 75 e4             	push   -0x1c(%ebp)
+  8019c2:	57                   	push   %edi
+  8019c3:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  8019c6:	99                   	cltd
+  8019c7:	f7 f9                	idiv   %ecx
+  8019c9:	ff 34 95 20 60 80 00 	push   0x806020(,%edx,4)
+  8019d0:	e8 63 f7 ff ff       	call   801138 <sys_ipc_try_send>
+      if (r == 0)
+  8019d5:	83 c4 20             	add    $0x20,%esp
+  8019d8:	85 c0                	test   %eax,%eax
+  8019da:	74 0a                	je     8019e6 <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  8019dc:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8019df:	75 95                	jne    801976 <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  8019e1:	83 c3 01             	add    $0x1,%ebx
+  8019e4:	eb c7                	jmp    8019ad <fsipc_send+0xd8>
+  }
+}
+  8019e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019e9:	5b                   	pop    %ebx
+  8019ea:	5e                   	pop    %esi
+  8019eb:	5f                   	pop    %edi
+  8019ec:	5d                   	pop    %ebp
+  8019ed:	c3                   	ret
+
+008019ee <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8019ee:	55                   	push   %ebp
+  8019ef:	89 e5                	mov    %esp,%ebp
+  8019f1:	53                   	push   %ebx
+  8019f2:	83 ec 14             	sub    $0x14,%esp
+  8019f5:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  8019f7:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  8019fe:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801a03:	ba 00 70 80 00       	mov    $0x807000,%edx
+  801a08:	e8 c8 fe ff ff       	call   8018d5 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801a0d:	6a 00                	push   $0x0
+  801a0f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a12:	50                   	push   %eax
+  801a13:	53                   	push   %ebx
+  801a14:	6a 00                	push   $0x0
+  801a16:	e8 26 13 00 00       	call   802d41 <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  801a1b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a1e:	c9                   	leave
+  801a1f:	c3                   	ret
+
+00801a20 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801a20:	55                   	push   %ebp
+  801a21:	89 e5                	mov    %esp,%ebp
+  801a23:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801a26:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a29:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a2c:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.set_size.req_size = newsize;
+  801a31:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a34:	a3 04 70 80 00       	mov    %eax,0x807004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801a39:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a3e:	b8 02 00 00 00       	mov    $0x2,%eax
+  801a43:	e8 a6 ff ff ff       	call   8019ee <fsipc>
+}
+  801a48:	c9                   	leave
+  801a49:	c3                   	ret
+
+00801a4a <devfile_flush>:
+{
+  801a4a:	55                   	push   %ebp
+  801a4b:	89 e5                	mov    %esp,%ebp
+  801a4d:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801a50:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a53:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a56:	a3 00 70 80 00       	mov    %eax,0x807000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801a5b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a60:	b8 06 00 00 00       	mov    $0x6,%eax
+  801a65:	e8 84 ff ff ff       	call   8019ee <fsipc>
+}
+  801a6a:	c9                   	leave
+  801a6b:	c3                   	ret
+
+00801a6c <devfile_stat>:
+{
+  801a6c:	55                   	push   %ebp
+  801a6d:	89 e5                	mov    %esp,%ebp
+  801a6f:	53                   	push   %ebx
+  801a70:	83 ec 04             	sub    $0x4,%esp
+  801a73:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801a76:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a79:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a7c:	a3 00 70 80 00       	mov    %eax,0x807000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801a81:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a86:	b8 05 00 00 00       	mov    $0x5,%eax
+  801a8b:	e8 5e ff ff ff       	call   8019ee <fsipc>
+  801a90:	85 c0                	test   %eax,%eax
+  801a92:	78 2c                	js     801ac0 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801a94:	83 ec 08             	sub    $0x8,%esp
+  801a97:	68 00 70 80 00       	push   $0x807000
+  801a9c:	53                   	push   %ebx
+  801a9d:	e8 b0 ef ff ff       	call   800a52 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  801aa2:	a1 80 70 80 00       	mov    0x807080,%eax
+  801aa7:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801aad:	a1 84 70 80 00       	mov    0x807084,%eax
+  801ab2:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801ab8:	83 c4 10             	add    $0x10,%esp
+  801abb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ac0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ac3:	c9                   	leave
+  801ac4:	c3                   	ret
+
+00801ac5 <fsv_alloc>:
+{
+  801ac5:	55                   	push   %ebp
+  801ac6:	89 e5                	mov    %esp,%ebp
+  801ac8:	56                   	push   %esi
+  801ac9:	53                   	push   %ebx
+  801aca:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  801acc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ad1:	eb 22                	jmp    801af5 <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  801ad3:	83 ec 04             	sub    $0x4,%esp
+  801ad6:	6a 00                	push   $0x0
+  801ad8:	6a 00                	push   $0x0
+  801ada:	6a 07                	push   $0x7
+  801adc:	50                   	push   %eax
+  801add:	6a 00                	push   $0x0
+  801adf:	6a 04                	push   $0x4
+  801ae1:	68 40 60 80 00       	push   $0x806040
+  801ae6:	e8 e9 f7 ff ff       	call   8012d4 <sysbatch_add>
+  801aeb:	83 c4 20             	add    $0x20,%esp
+  801aee:	85 c0                	test   %eax,%eax
+  801af0:	78 48                	js     801b3a <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  801af2:	83 c3 01             	add    $0x1,%ebx
+  801af5:	39 f3                	cmp    %esi,%ebx
+  801af7:	74 31                	je     801b2a <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  801af9:	89 d8                	mov    %ebx,%eax
+  801afb:	c1 e0 0c             	shl    $0xc,%eax
+  801afe:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801b03:	89 c2                	mov    %eax,%edx
+  801b05:	c1 ea 16             	shr    $0x16,%edx
+  801b08:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801b0f:	f6 c2 01             	test   $0x1,%dl
+  801b12:	74 bf                	je     801ad3 <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  801b14:	89 c2                	mov    %eax,%edx
+  801b16:	c1 ea 0c             	shr    $0xc,%edx
+  801b19:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801b20:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801b23:	83 fa 03             	cmp    $0x3,%edx
+  801b26:	75 ab                	jne    801ad3 <fsv_alloc+0xe>
+  801b28:	eb c8                	jmp    801af2 <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  801b2a:	83 ec 0c             	sub    $0xc,%esp
+  801b2d:	68 40 60 80 00       	push   $0x806040
+  801b32:	e8 4d f7 ff ff       	call   801284 <sysbatch_flush>
+  801b37:	83 c4 10             	add    $0x10,%esp
+}
+  801b3a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b3d:	5b                   	pop    %ebx
+  801b3e:	5e                   	pop    %esi
+  801b3f:	5d                   	pop    %ebp
+  801b40:	c3                   	ret
+
+00801b41 <devfile_read>:
+{
+  801b41:	55                   	push   %ebp
+  801b42:	89 e5                	mov    %esp,%ebp
+  801b44:	57                   	push   %edi
+  801b45:	56                   	push   %esi
+  801b46:	53                   	push   %ebx
+  801b47:	83 ec 3c             	sub    $0x3c,%esp
+  801b4a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  801b4d:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  801b53:	77 57                	ja     801bac <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801b55:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b58:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b5b:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.read.req_n = n;
+  801b60:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801b66:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b6b:	b8 03 00 00 00       	mov    $0x3,%eax
+  801b70:	e8 79 fe ff ff       	call   8019ee <fsipc>
+  801b75:	89 c6                	mov    %eax,%esi
+  801b77:	85 c0                	test   %eax,%eax
+  801b79:	78 27                	js     801ba2 <devfile_read+0x61>
+  assert(r <= n);
+  801b7b:	39 c3                	cmp    %eax,%ebx
+  801b7d:	0f 82 0e 02 00 00    	jb     801d91 <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  801b83:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801b88:	0f 8f 1c 02 00 00    	jg     801daa <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801b8e:	83 ec 04             	sub    $0x4,%esp
+  801b91:	50                   	push   %eax
+  801b92:	68 00 70 80 00       	push   $0x807000
+  801b97:	ff 75 0c             	push   0xc(%ebp)
+  801b9a:	e8 39 f0 ff ff       	call   800bd8 <memmove>
+  return r;
+  801b9f:	83 c4 10             	add    $0x10,%esp
+}
+  801ba2:	89 f0                	mov    %esi,%eax
+  801ba4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ba7:	5b                   	pop    %ebx
+  801ba8:	5e                   	pop    %esi
+  801ba9:	5f                   	pop    %edi
+  801baa:	5d                   	pop    %ebp
+  801bab:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  801bac:	b8 01 00 00 00       	mov    $0x1,%eax
+  801bb1:	e8 0f ff ff ff       	call   801ac5 <fsv_alloc>
+  801bb6:	89 c6                	mov    %eax,%esi
+  801bb8:	85 c0                	test   %eax,%eax
+  801bba:	78 e6                	js     801ba2 <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  801bbc:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bbf:	8b 40 0c             	mov    0xc(%eax),%eax
+  801bc2:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  801bc7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bca:	8b 40 04             	mov    0x4(%eax),%eax
+  801bcd:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  801bd2:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  801bd8:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801bdf:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801be4:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801be9:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801bee:	e8 e2 fc ff ff       	call   8018d5 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801bf3:	6a 00                	push   $0x0
+  801bf5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801bf8:	50                   	push   %eax
+  801bf9:	68 00 10 c0 9f       	push   $0x9fc01000
+  801bfe:	6a 00                	push   $0x0
+  801c00:	e8 3c 11 00 00       	call   802d41 <ipc_recv_pages>
+  801c05:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  801c07:	83 c4 10             	add    $0x10,%esp
+  801c0a:	85 c0                	test   %eax,%eax
+  801c0c:	7e 94                	jle    801ba2 <devfile_read+0x61>
+  assert(r <= n);
+  801c0e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801c11:	39 c3                	cmp    %eax,%ebx
+  801c13:	72 2e                	jb     801c43 <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801c15:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c18:	8b 40 04             	mov    0x4(%eax),%eax
+  801c1b:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801c20:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  801c23:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801c26:	c1 e2 0c             	shl    $0xc,%edx
+  801c29:	39 ca                	cmp    %ecx,%edx
+  801c2b:	72 2f                	jb     801c5c <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  801c2d:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  801c32:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  801c35:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  801c39:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801c3e:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  801c41:	eb 52                	jmp    801c95 <devfile_read+0x154>
+  assert(r <= n);
+  801c43:	68 f1 35 80 00       	push   $0x8035f1
+  801c48:	68 f8 35 80 00       	push   $0x8035f8
+  801c4d:	68 49 01 00 00       	push   $0x149
+  801c52:	68 e6 35 80 00       	push   $0x8035e6
+  801c57:	e8 2d e7 ff ff       	call   800389 <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801c5c:	68 1c 36 80 00       	push   $0x80361c
+  801c61:	68 f8 35 80 00       	push   $0x8035f8
+  801c66:	68 4a 01 00 00       	push   $0x14a
+  801c6b:	68 e6 35 80 00       	push   $0x8035e6
+  801c70:	e8 14 e7 ff ff       	call   800389 <_panic>
+      memmove(dst + done, src + done, m);
+  801c75:	83 ec 04             	sub    $0x4,%esp
+  801c78:	53                   	push   %ebx
+  801c79:	56                   	push   %esi
+  801c7a:	89 f8                	mov    %edi,%eax
+  801c7c:	03 45 0c             	add    0xc(%ebp),%eax
+  801c7f:	50                   	push   %eax
+  801c80:	e8 53 ef ff ff       	call   800bd8 <memmove>
+  801c85:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  801c88:	01 df                	add    %ebx,%edi
+  801c8a:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801c8d:	39 c7                	cmp    %eax,%edi
+  801c8f:	0f 83 c0 00 00 00    	jae    801d55 <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801c95:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801c98:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  801c9b:	89 f0                	mov    %esi,%eax
+  801c9d:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801ca2:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  801ca7:	29 c3                	sub    %eax,%ebx
+  801ca9:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801cac:	29 f8                	sub    %edi,%eax
+  801cae:	39 c3                	cmp    %eax,%ebx
+  801cb0:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  801cb3:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801cb9:	75 ba                	jne    801c75 <devfile_read+0x134>
+  801cbb:	89 f9                	mov    %edi,%ecx
+  801cbd:	03 4d 0c             	add    0xc(%ebp),%ecx
+  801cc0:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  801cc3:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  801cc9:	75 aa                	jne    801c75 <devfile_read+0x134>
+  801ccb:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  801cd1:	77 a2                	ja     801c75 <devfile_read+0x134>
+  801cd3:	89 c8                	mov    %ecx,%eax
+  801cd5:	c1 e8 16             	shr    $0x16,%eax
+  801cd8:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801cdf:	a8 01                	test   $0x1,%al
+  801ce1:	74 92                	je     801c75 <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  801ce3:	89 c8                	mov    %ecx,%eax
+  801ce5:	c1 e8 0c             	shr    $0xc,%eax
+  801ce8:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  801cef:	a8 01                	test   $0x1,%al
+  801cf1:	74 82                	je     801c75 <devfile_read+0x134>
+  801cf3:	a9 02 08 00 00       	test   $0x802,%eax
+  801cf8:	0f 84 77 ff ff ff    	je     801c75 <devfile_read+0x134>
+  801cfe:	f6 c4 04             	test   $0x4,%ah
+  801d01:	0f 85 6e ff ff ff    	jne    801c75 <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  801d07:	a1 44 67 80 00       	mov    0x806744,%eax
+  801d0c:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  801d10:	84 c0                	test   %al,%al
+  801d12:	75 17                	jne    801d2b <devfile_read+0x1ea>
+  801d14:	83 ec 08             	sub    $0x8,%esp
+  801d17:	6a 01                	push   $0x1
+  801d19:	6a 00                	push   $0x0
+  801d1b:	e8 1e f1 ff ff       	call   800e3e <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  801d20:	83 c4 10             	add    $0x10,%esp
+  801d23:	85 c0                	test   %eax,%eax
+  801d25:	0f 85 4a ff ff ff    	jne    801c75 <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  801d2b:	83 ec 04             	sub    $0x4,%esp
+  801d2e:	68 05 08 00 00       	push   $0x805
+  801d33:	ff 75 cc             	push   -0x34(%ebp)
+  801d36:	6a 00                	push   $0x0
+  801d38:	56                   	push   %esi
+  801d39:	6a 00                	push   $0x0
+  801d3b:	6a 05                	push   $0x5
+  801d3d:	68 40 60 80 00       	push   $0x806040
+  801d42:	e8 8d f5 ff ff       	call   8012d4 <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  801d47:	c1 e8 1f             	shr    $0x1f,%eax
+  801d4a:	08 45 cb             	or     %al,-0x35(%ebp)
+  801d4d:	83 c4 20             	add    $0x20,%esp
+  801d50:	e9 33 ff ff ff       	jmp    801c88 <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  801d55:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  801d58:	83 ec 0c             	sub    $0xc,%esp
+  801d5b:	68 40 60 80 00       	push   $0x806040
+  801d60:	e8 1f f5 ff ff       	call   801284 <sysbatch_flush>
+  801d65:	83 c4 10             	add    $0x10,%esp
+  801d68:	85 c0                	test   %eax,%eax
+  801d6a:	78 06                	js     801d72 <devfile_read+0x231>
+  801d6c:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  801d70:	74 14                	je     801d86 <devfile_read+0x245>
+    memmove(dst, src, r);
+  801d72:	83 ec 04             	sub    $0x4,%esp
+  801d75:	ff 75 d4             	push   -0x2c(%ebp)
+  801d78:	ff 75 d0             	push   -0x30(%ebp)
+  801d7b:	ff 75 0c             	push   0xc(%ebp)
+  801d7e:	e8 55 ee ff ff       	call   800bd8 <memmove>
+  801d83:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  801d86:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d89:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  801d8c:	e9 11 fe ff ff       	jmp    801ba2 <devfile_read+0x61>
+  assert(r <= n);
+  801d91:	68 f1 35 80 00       	push   $0x8035f1
+  801d96:	68 f8 35 80 00       	push   $0x8035f8
+  801d9b:	68 1c 01 00 00       	push   $0x11c
+  801da0:	68 e6 35 80 00       	push   $0x8035e6
+  801da5:	e8 df e5 ff ff       	call   800389 <_panic>
+  assert(r <= PGSIZE);
+  801daa:	68 0d 36 80 00       	push   $0x80360d
+  801daf:	68 f8 35 80 00       	push   $0x8035f8
+  801db4:	68 1d 01 00 00       	push   $0x11d
+  801db9:	68 e6 35 80 00       	push   $0x8035e6
+  801dbe:	e8 c6 e5 ff ff       	call   800389 <_panic>
+
+00801dc3 <devfile_write>:
+{
+  801dc3:	55                   	push   %ebp
+  801dc4:	89 e5                	mov    %esp,%ebp
+  801dc6:	57                   	push   %edi
+  801dc7:	56                   	push   %esi
+  801dc8:	53                   	push   %ebx
+  801dc9:	83 ec 1c             	sub    $0x1c,%esp
+  801dcc:	8b 75 08             	mov    0x8(%ebp),%esi
+  801dcf:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  801dd2:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  801dd7:	77 39                	ja     801e12 <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801dd9:	8b 56 0c             	mov    0xc(%esi),%edx
+  801ddc:	89 15 00 70 80 00    	mov    %edx,0x807000
+  fsipcbuf.write.req_n = n;
+  801de2:	a3 04 70 80 00       	mov    %eax,0x807004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  801de7:	83 ec 04             	sub    $0x4,%esp
+  801dea:	50                   	push   %eax
+  801deb:	ff 75 0c             	push   0xc(%ebp)
+  801dee:	68 08 70 80 00       	push   $0x807008
+  801df3:	e8 e0 ed ff ff       	call   800bd8 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801df8:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dfd:	b8 04 00 00 00       	mov    $0x4,%eax
+  801e02:	e8 e7 fb ff ff       	call   8019ee <fsipc>
+  801e07:	83 c4 10             	add    $0x10,%esp
+}
+  801e0a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e0d:	5b                   	pop    %ebx
+  801e0e:	5e                   	pop    %esi
+  801e0f:	5f                   	pop    %edi
+  801e10:	5d                   	pop    %ebp
+  801e11:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  801e12:	ba 00 00 10 00       	mov    $0x100000,%edx
+  801e17:	39 d0                	cmp    %edx,%eax
+  801e19:	89 d3                	mov    %edx,%ebx
+  801e1b:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  801e1e:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  801e24:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  801e27:	83 c7 01             	add    $0x1,%edi
+  801e2a:	89 f8                	mov    %edi,%eax
+  801e2c:	e8 94 fc ff ff       	call   801ac5 <fsv_alloc>
+  801e31:	85 c0                	test   %eax,%eax
+  801e33:	78 d5                	js     801e0a <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  801e35:	83 ec 04             	sub    $0x4,%esp
+  801e38:	53                   	push   %ebx
+  801e39:	ff 75 0c             	push   0xc(%ebp)
+  801e3c:	68 00 10 c0 9f       	push   $0x9fc01000
+  801e41:	e8 92 ed ff ff       	call   800bd8 <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  801e46:	8b 46 0c             	mov    0xc(%esi),%eax
+  801e49:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  801e4e:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  801e54:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801e5b:	89 f9                	mov    %edi,%ecx
+  801e5d:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801e62:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801e67:	e8 69 fa ff ff       	call   8018d5 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801e6c:	6a 00                	push   $0x0
+  801e6e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801e71:	50                   	push   %eax
+  801e72:	6a 00                	push   $0x0
+  801e74:	6a 00                	push   $0x0
+  801e76:	e8 c6 0e 00 00       	call   802d41 <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  801e7b:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  801e7e:	eb 8a                	jmp    801e0a <devfile_write+0x47>
+
+00801e80 <open>:
+{
+  801e80:	55                   	push   %ebp
+  801e81:	89 e5                	mov    %esp,%ebp
+  801e83:	56                   	push   %esi
+  801e84:	53                   	push   %ebx
+  801e85:	83 ec 1c             	sub    $0x1c,%esp
+  801e88:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801e8b:	56                   	push   %esi
+  801e8c:	e8 86 eb ff ff       	call   800a17 <strlen>
+  801e91:	83 c4 10             	add    $0x10,%esp
+  801e94:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801e99:	7f 6c                	jg     801f07 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  801e9b:	83 ec 0c             	sub    $0xc,%esp
+  801e9e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ea1:	50                   	push   %eax
+  801ea2:	e8 ad f4 ff ff       	call   801354 <fd_alloc>
+  801ea7:	89 c3                	mov    %eax,%ebx
+  801ea9:	83 c4 10             	add    $0x10,%esp
+  801eac:	85 c0                	test   %eax,%eax
+  801eae:	78 3c                	js     801eec <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801eb0:	83 ec 08             	sub    $0x8,%esp
+  801eb3:	56                   	push   %esi
+  801eb4:	68 00 70 80 00       	push   $0x807000
+  801eb9:	e8 94 eb ff ff       	call   800a52 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801ebe:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ec1:	a3 00 74 80 00       	mov    %eax,0x807400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801ec6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801ec9:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ece:	e8 1b fb ff ff       	call   8019ee <fsipc>
+  801ed3:	89 c3                	mov    %eax,%ebx
+  801ed5:	83 c4 10             	add    $0x10,%esp
+  801ed8:	85 c0                	test   %eax,%eax
+  801eda:	78 19                	js     801ef5 <open+0x75>
+  return fd2num(fd);
+  801edc:	83 ec 0c             	sub    $0xc,%esp
+  801edf:	ff 75 f4             	push   -0xc(%ebp)
+  801ee2:	e8 49 f4 ff ff       	call   801330 <fd2num>
+  801ee7:	89 c3                	mov    %eax,%ebx
+  801ee9:	83 c4 10             	add    $0x10,%esp
+}
+  801eec:	89 d8                	mov    %ebx,%eax
+  801eee:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ef1:	5b                   	pop    %ebx
+  801ef2:	5e                   	pop    %esi
+  801ef3:	5d                   	pop    %ebp
+  801ef4:	c3                   	ret
+    fd_close(fd, 0);
+  801ef5:	83 ec 08             	sub    $0x8,%esp
+  801ef8:	6a 00                	push   $0x0
+  801efa:	ff 75 f4             	push   -0xc(%ebp)
+  801efd:	e8 44 f5 ff ff       	call   801446 <fd_close>
+    return r;
+  801f02:	83 c4 10             	add    $0x10,%esp
+  801f05:	eb e5                	jmp    801eec <open+0x6c>
+    return -E_BAD_PATH;
+  801f07:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801f0c:	eb de                	jmp    801eec <open+0x6c>
+
+00801f0e <open_read>:
+{
+  801f0e:	55                   	push   %ebp
+  801f0f:	89 e5                	mov    %esp,%ebp
+  801f11:	57                   	push   %edi
+  801f12:	56                   	push   %esi
+  801f13:	53                   	push   %ebx
+  801f14:	83 ec 28             	sub    $0x28,%esp
+  801f17:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  801f1a:	57                   	push   %edi
+  801f1b:	e8 f7 ea ff ff       	call   800a17 <strlen>
+  801f20:	83 c4 10             	add    $0x10,%esp
+  801f23:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801f28:	0f 87 f6 00 00 00    	ja     802024 <open_read+0x116>
+  801f2e:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  801f30:	83 ec 0c             	sub    $0xc,%esp
+  801f33:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801f36:	50                   	push   %eax
+  801f37:	e8 18 f4 ff ff       	call   801354 <fd_alloc>
+  801f3c:	89 c3                	mov    %eax,%ebx
+  801f3e:	83 c4 10             	add    $0x10,%esp
+  801f41:	85 c0                	test   %eax,%eax
+  801f43:	0f 88 b2 00 00 00    	js     801ffb <open_read+0xed>
+  strcpy(req->req_buf, path);
+  801f49:	83 ec 08             	sub    $0x8,%esp
+  801f4c:	57                   	push   %edi
+  801f4d:	68 e4 70 80 00       	push   $0x8070e4
+  801f52:	e8 fb ea ff ff       	call   800a52 <strcpy>
+  req->req_nops = 2;
+  801f57:	c7 05 00 70 80 00 02 	movl   $0x2,0x807000
+  801f5e:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  801f61:	c7 05 04 70 80 00 01 	movl   $0x1,0x807004
+  801f68:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  801f6b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f6e:	a3 10 70 80 00       	mov    %eax,0x807010
+  req->req_ops[0].op_buf = 0;
+  801f73:	c7 05 18 70 80 00 00 	movl   $0x0,0x807018
+  801f7a:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  801f7d:	c7 05 20 70 80 00 04 	movl   $0x4,0x807020
+  801f84:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  801f87:	c7 05 24 70 80 00 01 	movl   $0x1,0x807024
+  801f8e:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  801f91:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  801f96:	29 f0                	sub    %esi,%eax
+  801f98:	3b 45 14             	cmp    0x14(%ebp),%eax
+  801f9b:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  801f9f:	a3 2c 70 80 00       	mov    %eax,0x80702c
+  req->req_ops[1].op_offset = 0;
+  801fa4:	c7 05 30 70 80 00 00 	movl   $0x0,0x807030
+  801fab:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  801fae:	83 c6 01             	add    $0x1,%esi
+  801fb1:	89 35 34 70 80 00    	mov    %esi,0x807034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  801fb7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801fba:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801fbf:	e8 2a fa ff ff       	call   8019ee <fsipc>
+  801fc4:	89 c3                	mov    %eax,%ebx
+  801fc6:	83 c4 10             	add    $0x10,%esp
+  801fc9:	83 f8 01             	cmp    $0x1,%eax
+  801fcc:	7e 37                	jle    802005 <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  801fce:	a1 38 70 80 00       	mov    0x807038,%eax
+  801fd3:	8b 55 18             	mov    0x18(%ebp),%edx
+  801fd6:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  801fd8:	83 ec 04             	sub    $0x4,%esp
+  801fdb:	50                   	push   %eax
+  801fdc:	81 c6 e4 70 80 00    	add    $0x8070e4,%esi
+  801fe2:	56                   	push   %esi
+  801fe3:	ff 75 10             	push   0x10(%ebp)
+  801fe6:	e8 ed eb ff ff       	call   800bd8 <memmove>
+  return fd2num(fd);
+  801feb:	83 c4 04             	add    $0x4,%esp
+  801fee:	ff 75 e4             	push   -0x1c(%ebp)
+  801ff1:	e8 3a f3 ff ff       	call   801330 <fd2num>
+  801ff6:	89 c3                	mov    %eax,%ebx
+  801ff8:	83 c4 10             	add    $0x10,%esp
+}
+  801ffb:	89 d8                	mov    %ebx,%eax
+  801ffd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802000:	5b                   	pop    %ebx
+  802001:	5e                   	pop    %esi
+  802002:	5f                   	pop    %edi
+  802003:	5d                   	pop    %ebp
+  802004:	c3                   	ret
+    fd_close(fd, 0);
+  802005:	83 ec 08             	sub    $0x8,%esp
+  802008:	6a 00                	push   $0x0
+  80200a:	ff 75 e4             	push   -0x1c(%ebp)
+  80200d:	e8 34 f4 ff ff       	call   801446 <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  802012:	83 c4 10             	add    $0x10,%esp
+  802015:	85 db                	test   %ebx,%ebx
+  802017:	78 e2                	js     801ffb <open_read+0xed>
+  802019:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  80201c:	8b 9b 1c 70 80 00    	mov    0x80701c(%ebx),%ebx
+  802022:	eb d7                	jmp    801ffb <open_read+0xed>
+    return -E_BAD_PATH;
+  802024:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802029:	eb d0                	jmp    801ffb <open_read+0xed>
+
+0080202b <file_stat>:
+{
+  80202b:	55                   	push   %ebp
+  80202c:	89 e5                	mov    %esp,%ebp
+  80202e:	57                   	push   %edi
+  80202f:	56                   	push   %esi
+  802030:	53                   	push   %ebx
+  802031:	83 ec 18             	sub    $0x18,%esp
+  802034:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802037:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  80203a:	57                   	push   %edi
+  80203b:	e8 d7 e9 ff ff       	call   800a17 <strlen>
+  802040:	83 c4 10             	add    $0x10,%esp
+  802043:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802048:	0f 8f c7 00 00 00    	jg     802115 <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  80204e:	83 ec 0c             	sub    $0xc,%esp
+  802051:	57                   	push   %edi
+  802052:	e8 c0 e9 ff ff       	call   800a17 <strlen>
+  802057:	8d 58 04             	lea    0x4(%eax),%ebx
+  80205a:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  80205d:	83 c4 08             	add    $0x8,%esp
+  802060:	57                   	push   %edi
+  802061:	68 e4 70 80 00       	push   $0x8070e4
+  802066:	e8 e7 e9 ff ff       	call   800a52 <strcpy>
+  req->req_nops = 2;
+  80206b:	c7 05 00 70 80 00 02 	movl   $0x2,0x807000
+  802072:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  802075:	c7 05 04 70 80 00 02 	movl   $0x2,0x807004
+  80207c:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  80207f:	c7 05 10 70 80 00 00 	movl   $0x0,0x807010
+  802086:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  802089:	c7 05 18 70 80 00 00 	movl   $0x0,0x807018
+  802090:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  802093:	c7 05 20 70 80 00 03 	movl   $0x3,0x807020
+  80209a:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  80209d:	c7 05 24 70 80 00 01 	movl   $0x1,0x807024
+  8020a4:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  8020a7:	89 1d 34 70 80 00    	mov    %ebx,0x807034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  8020ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020b2:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8020b7:	e8 32 f9 ff ff       	call   8019ee <fsipc>
+  8020bc:	83 c4 10             	add    $0x10,%esp
+  8020bf:	83 f8 01             	cmp    $0x1,%eax
+  8020c2:	7e 42                	jle    802106 <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  8020c4:	81 c3 e4 70 80 00    	add    $0x8070e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  8020ca:	83 ec 08             	sub    $0x8,%esp
+  8020cd:	53                   	push   %ebx
+  8020ce:	56                   	push   %esi
+  8020cf:	e8 7e e9 ff ff       	call   800a52 <strcpy>
+  st->st_size = ret->ret_size;
+  8020d4:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  8020da:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  8020e0:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  8020e6:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  8020ec:	c7 86 88 00 00 00 04 	movl   $0x804004,0x88(%esi)
+  8020f3:	40 80 00 
+  return 0;
+  8020f6:	83 c4 10             	add    $0x10,%esp
+  8020f9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802101:	5b                   	pop    %ebx
+  802102:	5e                   	pop    %esi
+  802103:	5f                   	pop    %edi
+  802104:	5d                   	pop    %ebp
+  802105:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  802106:	85 c0                	test   %eax,%eax
+  802108:	78 f4                	js     8020fe <file_stat+0xd3>
+  80210a:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80210d:	8b 80 1c 70 80 00    	mov    0x80701c(%eax),%eax
+  802113:	eb e9                	jmp    8020fe <file_stat+0xd3>
+    return -E_BAD_PATH;
+  802115:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  80211a:	eb e2                	jmp    8020fe <file_stat+0xd3>
+
+0080211c <read_map>:
+{
+  80211c:	55                   	push   %ebp
+  80211d:	89 e5                	mov    %esp,%ebp
+  80211f:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802122:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802125:	50                   	push   %eax
+  802126:	ff 75 08             	push   0x8(%ebp)
+  802129:	e8 7c f2 ff ff       	call   8013aa <fd_lookup>
+  80212e:	83 c4 10             	add    $0x10,%esp
+  802131:	85 c0                	test   %eax,%eax
+  802133:	78 2a                	js     80215f <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  802135:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802138:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  80213e:	39 08                	cmp    %ecx,(%eax)
+  802140:	75 1f                	jne    802161 <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  802142:	8b 40 0c             	mov    0xc(%eax),%eax
+  802145:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.read_map.req_offset = offset;
+  80214a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80214d:	a3 04 70 80 00       	mov    %eax,0x807004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  802152:	8b 55 10             	mov    0x10(%ebp),%edx
+  802155:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80215a:	e8 8f f8 ff ff       	call   8019ee <fsipc>
+}
+  80215f:	c9                   	leave
+  802160:	c3                   	ret
+    return -E_INVAL;
+  802161:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802166:	eb f7                	jmp    80215f <read_map+0x43>
+
+00802168 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802168:	55                   	push   %ebp
+  802169:	89 e5                	mov    %esp,%ebp
+  80216b:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  80216e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802173:	b8 08 00 00 00       	mov    $0x8,%eax
+  802178:	e8 71 f8 ff ff       	call   8019ee <fsipc>
+}
+  80217d:	c9                   	leave
+  80217e:	c3                   	ret
+
+0080217f <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  80217f:	55                   	push   %ebp
+  802180:	89 e5                	mov    %esp,%ebp
+  802182:	57                   	push   %edi
+  802183:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  802184:	8b 45 08             	mov    0x8(%ebp),%eax
+  802187:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.stats.req_bio_sched = 0;
+  80218c:	c7 05 04 70 80 00 00 	movl   $0x0,0x807004
+  802193:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  802196:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  80219d:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  8021a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021a5:	b8 09 00 00 00       	mov    $0x9,%eax
+  8021aa:	e8 3f f8 ff ff       	call   8019ee <fsipc>
+  8021af:	85 c0                	test   %eax,%eax
+  8021b1:	78 14                	js     8021c7 <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  8021b3:	be 00 70 80 00       	mov    $0x807000,%esi
+  8021b8:	b9 16 00 00 00       	mov    $0x16,%ecx
+  8021bd:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8021c0:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  8021c2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021c7:	5e                   	pop    %esi
+  8021c8:	5f                   	pop    %edi
+  8021c9:	5d                   	pop    %ebp
+  8021ca:	c3                   	ret
+
+008021cb <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  8021cb:	55                   	push   %ebp
+  8021cc:	89 e5                	mov    %esp,%ebp
+  8021ce:	53                   	push   %ebx
+  8021cf:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  8021d2:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8021d5:	50                   	push   %eax
+  8021d6:	6a 00                	push   $0x0
+  8021d8:	e8 a2 ff ff ff       	call   80217f <fs_stats>
+  8021dd:	83 c4 10             	add    $0x10,%esp
+  8021e0:	85 c0                	test   %eax,%eax
+  8021e2:	78 28                	js     80220c <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  8021e4:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  8021e7:	83 ec 08             	sub    $0x8,%esp
+  8021ea:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8021ed:	50                   	push   %eax
+  8021ee:	6a 20                	push   $0x20
+  8021f0:	e8 8a ff ff ff       	call   80217f <fs_stats>
+  8021f5:	83 c4 10             	add    $0x10,%esp
+  8021f8:	85 c0                	test   %eax,%eax
+  8021fa:	78 10                	js     80220c <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  8021fc:	83 ec 08             	sub    $0x8,%esp
+  8021ff:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802202:	50                   	push   %eax
+  802203:	53                   	push   %ebx
+  802204:	e8 76 ff ff ff       	call   80217f <fs_stats>
+  802209:	83 c4 10             	add    $0x10,%esp
+}
+  80220c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80220f:	c9                   	leave
+  802210:	c3                   	ret
+
+00802211 <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  802211:	55                   	push   %ebp
+  802212:	89 e5                	mov    %esp,%ebp
+  802214:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  802217:	c7 05 00 70 80 00 00 	movl   $0x0,0x807000
+  80221e:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  802221:	8b 45 08             	mov    0x8(%ebp),%eax
+  802224:	a3 04 70 80 00       	mov    %eax,0x807004
+  fsipcbuf.stats.req_dcache = 0;
+  802229:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  802230:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  802233:	ba 00 00 00 00       	mov    $0x0,%edx
+  802238:	b8 09 00 00 00       	mov    $0x9,%eax
+  80223d:	e8 ac f7 ff ff       	call   8019ee <fsipc>
+}
+  802242:	c9                   	leave
+  802243:	c3                   	ret
+
+00802244 <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  802244:	55                   	push   %ebp
+  802245:	89 e5                	mov    %esp,%ebp
+  802247:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  80224a:	c7 05 00 70 80 00 00 	movl   $0x0,0x807000
+  802251:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  802254:	c7 05 04 70 80 00 00 	movl   $0x0,0x807004
+  80225b:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  80225e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802261:	a3 08 70 80 00       	mov    %eax,0x807008
+  return fsipc(FSREQ_STATS, NULL);
+  802266:	ba 00 00 00 00       	mov    $0x0,%edx
+  80226b:	b8 09 00 00 00       	mov    $0x9,%eax
+  802270:	e8 79 f7 ff ff       	call   8019ee <fsipc>
+}
+  802275:	c9                   	leave
+  802276:	c3                   	ret
+
+00802277 <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  802277:	55                   	push   %ebp
+  802278:	89 e5                	mov    %esp,%ebp
+  80227a:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80227d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802280:	50                   	push   %eax
+  802281:	ff 75 08             	push   0x8(%ebp)
+  802284:	e8 21 f1 ff ff       	call   8013aa <fd_lookup>
+  802289:	83 c4 10             	add    $0x10,%esp
+  80228c:	85 c0                	test   %eax,%eax
+  80228e:	78 34                	js     8022c4 <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  802290:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802293:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  802299:	39 08                	cmp    %ecx,(%eax)
+  80229b:	75 29                	jne    8022c6 <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  80229d:	8b 40 0c             	mov    0xc(%eax),%eax
+  8022a0:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.fallocate.req_offset = offset;
+  8022a5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022a8:	a3 04 70 80 00       	mov    %eax,0x807004
+  fsipcbuf.fallocate.req_len = len;
+  8022ad:	8b 45 10             	mov    0x10(%ebp),%eax
+  8022b0:	a3 08 70 80 00       	mov    %eax,0x807008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  8022b5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022ba:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8022bf:	e8 2a f7 ff ff       	call   8019ee <fsipc>
+}
+  8022c4:	c9                   	leave
+  8022c5:	c3                   	ret
+    return -E_INVAL;
+  8022c6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8022cb:	eb f7                	jmp    8022c4 <fallocate+0x4d>
+
+008022cd <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  8022cd:	55                   	push   %ebp
+  8022ce:	89 e5                	mov    %esp,%ebp
+  8022d0:	57                   	push   %edi
+  8022d1:	56                   	push   %esi
+  8022d2:	53                   	push   %ebx
+  8022d3:	83 ec 24             	sub    $0x24,%esp
+  8022d6:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8022d9:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8022dc:	50                   	push   %eax
+  8022dd:	ff 75 08             	push   0x8(%ebp)
+  8022e0:	e8 c5 f0 ff ff       	call   8013aa <fd_lookup>
+  8022e5:	83 c4 10             	add    $0x10,%esp
+  8022e8:	85 c0                	test   %eax,%eax
+  8022ea:	78 66                	js     802352 <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  8022ec:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8022ef:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  8022f5:	39 08                	cmp    %ecx,(%eax)
+  8022f7:	75 61                	jne    80235a <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  8022f9:	85 f6                	test   %esi,%esi
+  8022fb:	7e 50                	jle    80234d <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  8022fd:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  802302:	39 de                	cmp    %ebx,%esi
+  802304:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  802307:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80230a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80230d:	a3 00 70 80 00       	mov    %eax,0x807000
+    fsipcbuf.prefetch.req_n = m;
+  802312:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  802318:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  80231f:	83 ec 04             	sub    $0x4,%esp
+  802322:	57                   	push   %edi
+  802323:	ff 75 0c             	push   0xc(%ebp)
+  802326:	68 08 70 80 00       	push   $0x807008
+  80232b:	e8 a8 e8 ff ff       	call   800bd8 <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  802330:	ba 00 00 00 00       	mov    $0x0,%edx
+  802335:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80233a:	e8 af f6 ff ff       	call   8019ee <fsipc>
+  80233f:	83 c4 10             	add    $0x10,%esp
+  802342:	85 c0                	test   %eax,%eax
+  802344:	78 0c                	js     802352 <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  802346:	01 7d 0c             	add    %edi,0xc(%ebp)
+  802349:	29 de                	sub    %ebx,%esi
+  80234b:	eb ac                	jmp    8022f9 <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  80234d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802352:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802355:	5b                   	pop    %ebx
+  802356:	5e                   	pop    %esi
+  802357:	5f                   	pop    %edi
+  802358:	5d                   	pop    %ebp
+  802359:	c3                   	ret
+    return -E_INVAL;
+  80235a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80235f:	eb f1                	jmp    802352 <prefetch+0x85>
+
+00802361 <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  802361:	55                   	push   %ebp
+  802362:	89 e5                	mov    %esp,%ebp
+  802364:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  802367:	50                   	push   %eax
+  802368:	e8 d3 ef ff ff       	call   801340 <fd2data>
+  80236d:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  802372:	c9                   	leave
+  802373:	c3                   	ret
+
+00802374 <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802374:	55                   	push   %ebp
+  802375:	89 e5                	mov    %esp,%ebp
+  802377:	56                   	push   %esi
+  802378:	53                   	push   %ebx
+  802379:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  80237c:	83 ec 0c             	sub    $0xc,%esp
+  80237f:	ff 75 08             	push   0x8(%ebp)
+  802382:	e8 b9 ef ff ff       	call   801340 <fd2data>
+  802387:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  802389:	83 c4 08             	add    $0x8,%esp
+  80238c:	68 48 36 80 00       	push   $0x803648
+  802391:	53                   	push   %ebx
+  802392:	e8 bb e6 ff ff       	call   800a52 <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  802397:	8b 46 04             	mov    0x4(%esi),%eax
+  80239a:	2b 06                	sub    (%esi),%eax
+  80239c:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  8023a2:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8023a9:	00 00 00 
+  stat->st_dev = &devpipe;
+  8023ac:	c7 83 88 00 00 00 20 	movl   $0x804020,0x88(%ebx)
+  8023b3:	40 80 00 
+  return 0;
+}
+  8023b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023bb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023be:	5b                   	pop    %ebx
+  8023bf:	5e                   	pop    %esi
+  8023c0:	5d                   	pop    %ebp
+  8023c1:	c3                   	ret
+
+008023c2 <pipe_wakeup>:
+{
+  8023c2:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  8023c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023c9:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  8023cc:	85 c0                	test   %eax,%eax
+  8023ce:	75 01                	jne    8023d1 <pipe_wakeup+0xf>
+  8023d0:	c3                   	ret
+{
+  8023d1:	55                   	push   %ebp
+  8023d2:	89 e5                	mov    %esp,%ebp
+  8023d4:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  8023d7:	6a 00                	push   $0x0
+  8023d9:	68 00 00 c0 ee       	push   $0xeec00000
+  8023de:	52                   	push   %edx
+  8023df:	e8 f9 ed ff ff       	call   8011dd <sys_chan_wakeup>
+  8023e4:	83 c4 10             	add    $0x10,%esp
+}
+  8023e7:	c9                   	leave
+  8023e8:	c3                   	ret
+
+008023e9 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8023e9:	55                   	push   %ebp
+  8023ea:	89 e5                	mov    %esp,%ebp
+  8023ec:	57                   	push   %edi
+  8023ed:	56                   	push   %esi
+  8023ee:	53                   	push   %ebx
+  8023ef:	83 ec 18             	sub    $0x18,%esp
+  8023f2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  8023f5:	57                   	push   %edi
+  8023f6:	e8 45 ef ff ff       	call   801340 <fd2data>
+  8023fb:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  8023fd:	83 c4 10             	add    $0x10,%esp
+  802400:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  802404:	74 2a                	je     802430 <devpipe_close+0x47>
+  802406:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  80240b:	89 f8                	mov    %edi,%eax
+  80240d:	e8 4f ff ff ff       	call   802361 <pipe_ring>
+  802412:	83 ec 08             	sub    $0x8,%esp
+  802415:	01 d8                	add    %ebx,%eax
+  802417:	50                   	push   %eax
+  802418:	6a 00                	push   $0x0
+  80241a:	e8 e7 ea ff ff       	call   800f06 <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  80241f:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802425:	83 c4 10             	add    $0x10,%esp
+  802428:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  80242e:	75 db                	jne    80240b <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  802430:	83 ec 08             	sub    $0x8,%esp
+  802433:	57                   	push   %edi
+  802434:	6a 00                	push   $0x0
+  802436:	e8 cb ea ff ff       	call   800f06 <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  80243b:	83 c4 10             	add    $0x10,%esp
+  80243e:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  802442:	75 13                	jne    802457 <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  802444:	83 ec 08             	sub    $0x8,%esp
+  802447:	56                   	push   %esi
+  802448:	6a 00                	push   $0x0
+  80244a:	e8 b7 ea ff ff       	call   800f06 <sys_page_unmap>
+}
+  80244f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802452:	5b                   	pop    %ebx
+  802453:	5e                   	pop    %esi
+  802454:	5f                   	pop    %edi
+  802455:	5d                   	pop    %ebp
+  802456:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802457:	8d 56 04             	lea    0x4(%esi),%edx
+  80245a:	8d 46 2c             	lea    0x2c(%esi),%eax
+  80245d:	e8 60 ff ff ff       	call   8023c2 <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802462:	8d 46 30             	lea    0x30(%esi),%eax
+  802465:	89 f2                	mov    %esi,%edx
+  802467:	e8 56 ff ff ff       	call   8023c2 <pipe_wakeup>
+  80246c:	eb d6                	jmp    802444 <devpipe_close+0x5b>
+
+0080246e <_pipeisclosed>:
+{
+  80246e:	55                   	push   %ebp
+  80246f:	89 e5                	mov    %esp,%ebp
+  802471:	57                   	push   %edi
+  802472:	56                   	push   %esi
+  802473:	53                   	push   %ebx
+  802474:	83 ec 1c             	sub    $0x1c,%esp
+  802477:	89 c7                	mov    %eax,%edi
+  802479:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  80247b:	a1 44 67 80 00       	mov    0x806744,%eax
+  802480:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  802483:	83 ec 0c             	sub    $0xc,%esp
+  802486:	57                   	push   %edi
+  802487:	e8 18 0a 00 00       	call   802ea4 <pageref>
+  80248c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80248f:	89 34 24             	mov    %esi,(%esp)
+  802492:	e8 0d 0a 00 00       	call   802ea4 <pageref>
+    nn = thisenv->env_runs;
+  802497:	8b 15 44 67 80 00    	mov    0x806744,%edx
+  80249d:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  8024a0:	83 c4 10             	add    $0x10,%esp
+  8024a3:	39 cb                	cmp    %ecx,%ebx
+  8024a5:	74 1b                	je     8024c2 <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  8024a7:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8024aa:	75 cf                	jne    80247b <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8024ac:	8b 42 58             	mov    0x58(%edx),%eax
+  8024af:	6a 01                	push   $0x1
+  8024b1:	50                   	push   %eax
+  8024b2:	53                   	push   %ebx
+  8024b3:	68 4f 36 80 00       	push   $0x80364f
+  8024b8:	e8 a7 df ff ff       	call   800464 <cprintf>
+  8024bd:	83 c4 10             	add    $0x10,%esp
+  8024c0:	eb b9                	jmp    80247b <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  8024c2:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8024c5:	0f 94 c0             	sete   %al
+  8024c8:	0f b6 c0             	movzbl %al,%eax
+}
+  8024cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024ce:	5b                   	pop    %ebx
+  8024cf:	5e                   	pop    %esi
+  8024d0:	5f                   	pop    %edi
+  8024d1:	5d                   	pop    %ebp
+  8024d2:	c3                   	ret
+
+008024d3 <devpipe_write_bulk>:
+{
+  8024d3:	55                   	push   %ebp
+  8024d4:	89 e5                	mov    %esp,%ebp
+  8024d6:	57                   	push   %edi
+  8024d7:	56                   	push   %esi
+  8024d8:	53                   	push   %ebx
+  8024d9:	83 ec 1c             	sub    $0x1c,%esp
+  8024dc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8024df:	89 d6                	mov    %edx,%esi
+  8024e1:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  8024e4:	e8 78 fe ff ff       	call   802361 <pipe_ring>
+  8024e9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  8024ec:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  8024f1:	8d 46 04             	lea    0x4(%esi),%eax
+  8024f4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  8024f7:	eb 75                	jmp    80256e <devpipe_write_bulk+0x9b>
+  8024f9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8024fe:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802502:	6a 64                	push   $0x64
+  802504:	68 00 00 c0 ee       	push   $0xeec00000
+  802509:	53                   	push   %ebx
+  80250a:	56                   	push   %esi
+  80250b:	e8 aa ec ff ff       	call   8011ba <sys_chan_sleep>
+      continue;
+  802510:	83 c4 10             	add    $0x10,%esp
+  802513:	eb 59                	jmp    80256e <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  802515:	89 d1                	mov    %edx,%ecx
+  802517:	c1 f9 1f             	sar    $0x1f,%ecx
+  80251a:	c1 e9 11             	shr    $0x11,%ecx
+  80251d:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802520:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802525:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  802527:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  80252d:	29 d3                	sub    %edx,%ebx
+  80252f:	ba 00 80 00 00       	mov    $0x8000,%edx
+  802534:	29 c2                	sub    %eax,%edx
+  802536:	39 d3                	cmp    %edx,%ebx
+  802538:	0f 47 da             	cmova  %edx,%ebx
+  80253b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80253e:	29 fa                	sub    %edi,%edx
+  802540:	39 d3                	cmp    %edx,%ebx
+  802542:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  802545:	83 ec 04             	sub    $0x4,%esp
+  802548:	53                   	push   %ebx
+  802549:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80254c:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  80254f:	52                   	push   %edx
+  802550:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802553:	01 c8                	add    %ecx,%eax
+  802555:	50                   	push   %eax
+  802556:	e8 df e6 ff ff       	call   800c3a <memcpy>
+    i += m;
+  80255b:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  80255d:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802560:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802563:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802566:	e8 57 fe ff ff       	call   8023c2 <pipe_wakeup>
+  80256b:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  80256e:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802571:	73 2b                	jae    80259e <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  802573:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  802575:	8b 56 04             	mov    0x4(%esi),%edx
+  802578:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  80257e:	39 d0                	cmp    %edx,%eax
+  802580:	7d 93                	jge    802515 <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  802582:	89 f2                	mov    %esi,%edx
+  802584:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802587:	e8 e2 fe ff ff       	call   80246e <_pipeisclosed>
+  80258c:	85 c0                	test   %eax,%eax
+  80258e:	0f 84 65 ff ff ff    	je     8024f9 <devpipe_write_bulk+0x26>
+        return i;
+  802594:	89 f8                	mov    %edi,%eax
+}
+  802596:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802599:	5b                   	pop    %ebx
+  80259a:	5e                   	pop    %esi
+  80259b:	5f                   	pop    %edi
+  80259c:	5d                   	pop    %ebp
+  80259d:	c3                   	ret
+  return i;
+  80259e:	89 f8                	mov    %edi,%eax
+  8025a0:	eb f4                	jmp    802596 <devpipe_write_bulk+0xc3>
+
+008025a2 <devpipe_write>:
+{
+  8025a2:	55                   	push   %ebp
+  8025a3:	89 e5                	mov    %esp,%ebp
+  8025a5:	57                   	push   %edi
+  8025a6:	56                   	push   %esi
+  8025a7:	53                   	push   %ebx
+  8025a8:	83 ec 28             	sub    $0x28,%esp
+  8025ab:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  8025ae:	56                   	push   %esi
+  8025af:	e8 8c ed ff ff       	call   801340 <fd2data>
+  8025b4:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  8025b6:	8b 78 28             	mov    0x28(%eax),%edi
+  8025b9:	83 c4 10             	add    $0x10,%esp
+  8025bc:	85 ff                	test   %edi,%edi
+  8025be:	75 25                	jne    8025e5 <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  8025c0:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8025c3:	74 66                	je     80262b <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8025c5:	8b 43 04             	mov    0x4(%ebx),%eax
+  8025c8:	8b 0b                	mov    (%ebx),%ecx
+  8025ca:	8d 51 20             	lea    0x20(%ecx),%edx
+  8025cd:	39 d0                	cmp    %edx,%eax
+  8025cf:	72 2b                	jb     8025fc <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  8025d1:	89 da                	mov    %ebx,%edx
+  8025d3:	89 f0                	mov    %esi,%eax
+  8025d5:	e8 94 fe ff ff       	call   80246e <_pipeisclosed>
+  8025da:	85 c0                	test   %eax,%eax
+  8025dc:	75 51                	jne    80262f <devpipe_write+0x8d>
+      sys_yield();
+  8025de:	e8 3c e8 ff ff       	call   800e1f <sys_yield>
+  8025e3:	eb e0                	jmp    8025c5 <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  8025e5:	83 ec 0c             	sub    $0xc,%esp
+  8025e8:	ff 75 10             	push   0x10(%ebp)
+  8025eb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8025ee:	89 c2                	mov    %eax,%edx
+  8025f0:	89 f0                	mov    %esi,%eax
+  8025f2:	e8 dc fe ff ff       	call   8024d3 <devpipe_write_bulk>
+  8025f7:	83 c4 10             	add    $0x10,%esp
+  8025fa:	eb 38                	jmp    802634 <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8025fc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8025ff:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802603:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802606:	89 c2                	mov    %eax,%edx
+  802608:	c1 fa 1f             	sar    $0x1f,%edx
+  80260b:	89 d1                	mov    %edx,%ecx
+  80260d:	c1 e9 1b             	shr    $0x1b,%ecx
+  802610:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802613:	83 e2 1f             	and    $0x1f,%edx
+  802616:	29 ca                	sub    %ecx,%edx
+  802618:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  80261c:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  802620:	83 c0 01             	add    $0x1,%eax
+  802623:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  802626:	83 c7 01             	add    $0x1,%edi
+  802629:	eb 95                	jmp    8025c0 <devpipe_write+0x1e>
+  return i;
+  80262b:	89 f8                	mov    %edi,%eax
+  80262d:	eb 05                	jmp    802634 <devpipe_write+0x92>
+        return 0;
+  80262f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802634:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802637:	5b                   	pop    %ebx
+  802638:	5e                   	pop    %esi
+  802639:	5f                   	pop    %edi
+  80263a:	5d                   	pop    %ebp
+  80263b:	c3                   	ret
+
+0080263c <devpipe_read_bulk>:
+{
+  80263c:	55                   	push   %ebp
+  80263d:	89 e5                	mov    %esp,%ebp
+  80263f:	57                   	push   %edi
+  802640:	56                   	push   %esi
+  802641:	53                   	push   %ebx
+  802642:	83 ec 2c             	sub    $0x2c,%esp
+  802645:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802648:	89 d6                	mov    %edx,%esi
+  80264a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80264d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  802650:	e8 0c fd ff ff       	call   802361 <pipe_ring>
+  802655:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  802658:	85 db                	test   %ebx,%ebx
+  80265a:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80265f:	0f 45 c3             	cmovne %ebx,%eax
+  802662:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802665:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  80266a:	8d 46 30             	lea    0x30(%esi),%eax
+  80266d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  802670:	eb 50                	jmp    8026c2 <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  802672:	89 d1                	mov    %edx,%ecx
+  802674:	c1 f9 1f             	sar    $0x1f,%ecx
+  802677:	c1 e9 11             	shr    $0x11,%ecx
+  80267a:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  80267d:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802682:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  802684:	29 d3                	sub    %edx,%ebx
+  802686:	ba 00 80 00 00       	mov    $0x8000,%edx
+  80268b:	29 c2                	sub    %eax,%edx
+  80268d:	39 d3                	cmp    %edx,%ebx
+  80268f:	0f 47 da             	cmova  %edx,%ebx
+  802692:	8b 55 08             	mov    0x8(%ebp),%edx
+  802695:	29 fa                	sub    %edi,%edx
+  802697:	39 d3                	cmp    %edx,%ebx
+  802699:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  80269c:	83 ec 04             	sub    $0x4,%esp
+  80269f:	53                   	push   %ebx
+  8026a0:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8026a3:	01 c8                	add    %ecx,%eax
+  8026a5:	50                   	push   %eax
+  8026a6:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8026a9:	01 f8                	add    %edi,%eax
+  8026ab:	50                   	push   %eax
+  8026ac:	e8 89 e5 ff ff       	call   800c3a <memcpy>
+    i += m;
+  8026b1:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  8026b3:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8026b5:	89 f2                	mov    %esi,%edx
+  8026b7:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8026ba:	e8 03 fd ff ff       	call   8023c2 <pipe_wakeup>
+  8026bf:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  8026c2:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  8026c5:	73 51                	jae    802718 <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  8026c7:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  8026ca:	8b 16                	mov    (%esi),%edx
+  8026cc:	39 da                	cmp    %ebx,%edx
+  8026ce:	75 a2                	jne    802672 <devpipe_read_bulk+0x36>
+      if (i > 0)
+  8026d0:	85 ff                	test   %edi,%edi
+  8026d2:	75 44                	jne    802718 <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  8026d4:	89 f2                	mov    %esi,%edx
+  8026d6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8026d9:	e8 90 fd ff ff       	call   80246e <_pipeisclosed>
+  8026de:	85 c0                	test   %eax,%eax
+  8026e0:	75 3a                	jne    80271c <devpipe_read_bulk+0xe0>
+  8026e2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8026e7:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  8026eb:	6a 64                	push   $0x64
+  8026ed:	ff 75 d4             	push   -0x2c(%ebp)
+  8026f0:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  8026f1:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  8026f4:	50                   	push   %eax
+  8026f5:	e8 c0 ea ff ff       	call   8011ba <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  8026fa:	85 c0                	test   %eax,%eax
+  8026fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  802701:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  802704:	83 c4 10             	add    $0x10,%esp
+  802707:	a8 01                	test   $0x1,%al
+  802709:	74 b7                	je     8026c2 <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  80270b:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  802710:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802713:	5b                   	pop    %ebx
+  802714:	5e                   	pop    %esi
+  802715:	5f                   	pop    %edi
+  802716:	5d                   	pop    %ebp
+  802717:	c3                   	ret
+  return i;
+  802718:	89 f8                	mov    %edi,%eax
+  80271a:	eb f4                	jmp    802710 <devpipe_read_bulk+0xd4>
+        return 0;
+  80271c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802721:	eb ed                	jmp    802710 <devpipe_read_bulk+0xd4>
+
+00802723 <devpipe_read>:
+{
+  802723:	55                   	push   %ebp
+  802724:	89 e5                	mov    %esp,%ebp
+  802726:	57                   	push   %edi
+  802727:	56                   	push   %esi
+  802728:	53                   	push   %ebx
+  802729:	83 ec 18             	sub    $0x18,%esp
+  80272c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  80272f:	57                   	push   %edi
+  802730:	e8 0b ec ff ff       	call   801340 <fd2data>
+  802735:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  802737:	8b 70 28             	mov    0x28(%eax),%esi
+  80273a:	83 c4 10             	add    $0x10,%esp
+  80273d:	85 f6                	test   %esi,%esi
+  80273f:	75 24                	jne    802765 <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  802741:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802744:	74 60                	je     8027a6 <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  802746:	8b 03                	mov    (%ebx),%eax
+  802748:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80274b:	75 3b                	jne    802788 <devpipe_read+0x65>
+      if (i > 0)
+  80274d:	85 f6                	test   %esi,%esi
+  80274f:	75 2d                	jne    80277e <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  802751:	89 da                	mov    %ebx,%edx
+  802753:	89 f8                	mov    %edi,%eax
+  802755:	e8 14 fd ff ff       	call   80246e <_pipeisclosed>
+  80275a:	85 c0                	test   %eax,%eax
+  80275c:	75 4c                	jne    8027aa <devpipe_read+0x87>
+      sys_yield();
+  80275e:	e8 bc e6 ff ff       	call   800e1f <sys_yield>
+  802763:	eb e1                	jmp    802746 <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  802765:	83 ec 08             	sub    $0x8,%esp
+  802768:	6a 00                	push   $0x0
+  80276a:	ff 75 10             	push   0x10(%ebp)
+  80276d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802770:	89 c2                	mov    %eax,%edx
+  802772:	89 f8                	mov    %edi,%eax
+  802774:	e8 c3 fe ff ff       	call   80263c <devpipe_read_bulk>
+  802779:	83 c4 10             	add    $0x10,%esp
+  80277c:	eb 02                	jmp    802780 <devpipe_read+0x5d>
+        return i;
+  80277e:	89 f0                	mov    %esi,%eax
+}
+  802780:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802783:	5b                   	pop    %ebx
+  802784:	5e                   	pop    %esi
+  802785:	5f                   	pop    %edi
+  802786:	5d                   	pop    %ebp
+  802787:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802788:	99                   	cltd
+  802789:	c1 ea 1b             	shr    $0x1b,%edx
+  80278c:	01 d0                	add    %edx,%eax
+  80278e:	83 e0 1f             	and    $0x1f,%eax
+  802791:	29 d0                	sub    %edx,%eax
+  802793:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802798:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80279b:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  80279e:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  8027a1:	83 c6 01             	add    $0x1,%esi
+  8027a4:	eb 9b                	jmp    802741 <devpipe_read+0x1e>
+  return i;
+  8027a6:	89 f0                	mov    %esi,%eax
+  8027a8:	eb d6                	jmp    802780 <devpipe_read+0x5d>
+        return 0;
+  8027aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027af:	eb cf                	jmp    802780 <devpipe_read+0x5d>
+
+008027b1 <pipe2>:
+{
+  8027b1:	55                   	push   %ebp
+  8027b2:	89 e5                	mov    %esp,%ebp
+  8027b4:	57                   	push   %edi
+  8027b5:	56                   	push   %esi
+  8027b6:	53                   	push   %ebx
+  8027b7:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  8027ba:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8027bd:	50                   	push   %eax
+  8027be:	e8 91 eb ff ff       	call   801354 <fd_alloc>
+  8027c3:	89 c3                	mov    %eax,%ebx
+  8027c5:	83 c4 10             	add    $0x10,%esp
+  8027c8:	85 c0                	test   %eax,%eax
+  8027ca:	0f 88 fb 01 00 00    	js     8029cb <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8027d0:	83 ec 04             	sub    $0x4,%esp
+  8027d3:	68 07 04 00 00       	push   $0x407
+  8027d8:	ff 75 e4             	push   -0x1c(%ebp)
+  8027db:	6a 00                	push   $0x0
+  8027dd:	e8 9f e6 ff ff       	call   800e81 <sys_page_alloc>
+  8027e2:	89 c3                	mov    %eax,%ebx
+  8027e4:	83 c4 10             	add    $0x10,%esp
+  8027e7:	85 c0                	test   %eax,%eax
+  8027e9:	0f 88 dc 01 00 00    	js     8029cb <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  8027ef:	83 ec 0c             	sub    $0xc,%esp
+  8027f2:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8027f5:	50                   	push   %eax
+  8027f6:	e8 59 eb ff ff       	call   801354 <fd_alloc>
+  8027fb:	89 c3                	mov    %eax,%ebx
+  8027fd:	83 c4 10             	add    $0x10,%esp
+  802800:	85 c0                	test   %eax,%eax
+  802802:	0f 88 b3 01 00 00    	js     8029bb <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802808:	83 ec 04             	sub    $0x4,%esp
+  80280b:	68 07 04 00 00       	push   $0x407
+  802810:	ff 75 e0             	push   -0x20(%ebp)
+  802813:	6a 00                	push   $0x0
+  802815:	e8 67 e6 ff ff       	call   800e81 <sys_page_alloc>
+  80281a:	89 c3                	mov    %eax,%ebx
+  80281c:	83 c4 10             	add    $0x10,%esp
+  80281f:	85 c0                	test   %eax,%eax
+  802821:	0f 88 94 01 00 00    	js     8029bb <pipe2+0x20a>
+  va = fd2data(fd0);
+  802827:	83 ec 0c             	sub    $0xc,%esp
+  80282a:	ff 75 e4             	push   -0x1c(%ebp)
+  80282d:	e8 0e eb ff ff       	call   801340 <fd2data>
+  802832:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802834:	83 c4 0c             	add    $0xc,%esp
+  802837:	68 07 04 00 00       	push   $0x407
+  80283c:	50                   	push   %eax
+  80283d:	6a 00                	push   $0x0
+  80283f:	e8 3d e6 ff ff       	call   800e81 <sys_page_alloc>
+  802844:	89 c3                	mov    %eax,%ebx
+  802846:	83 c4 10             	add    $0x10,%esp
+  802849:	85 c0                	test   %eax,%eax
+  80284b:	0f 88 5a 01 00 00    	js     8029ab <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802851:	83 ec 0c             	sub    $0xc,%esp
+  802854:	ff 75 e0             	push   -0x20(%ebp)
+  802857:	e8 e4 ea ff ff       	call   801340 <fd2data>
+  80285c:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802863:	50                   	push   %eax
+  802864:	6a 00                	push   $0x0
+  802866:	57                   	push   %edi
+  802867:	6a 00                	push   $0x0
+  802869:	e8 56 e6 ff ff       	call   800ec4 <sys_page_map>
+  80286e:	89 c3                	mov    %eax,%ebx
+  802870:	83 c4 20             	add    $0x20,%esp
+  802873:	85 c0                	test   %eax,%eax
+  802875:	0f 88 22 01 00 00    	js     80299d <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  80287b:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  80287f:	74 72                	je     8028f3 <pipe2+0x142>
+  802881:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  802886:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802889:	e8 d3 fa ff ff       	call   802361 <pipe_ring>
+  80288e:	83 ec 04             	sub    $0x4,%esp
+  802891:	68 07 04 00 00       	push   $0x407
+  802896:	01 f0                	add    %esi,%eax
+  802898:	50                   	push   %eax
+  802899:	6a 00                	push   $0x0
+  80289b:	e8 e1 e5 ff ff       	call   800e81 <sys_page_alloc>
+  8028a0:	89 c3                	mov    %eax,%ebx
+  8028a2:	83 c4 10             	add    $0x10,%esp
+  8028a5:	85 c0                	test   %eax,%eax
+  8028a7:	0f 88 97 00 00 00    	js     802944 <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  8028ad:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8028b0:	e8 ac fa ff ff       	call   802361 <pipe_ring>
+  8028b5:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  8028b8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8028bb:	e8 a1 fa ff ff       	call   802361 <pipe_ring>
+  8028c0:	83 ec 0c             	sub    $0xc,%esp
+  8028c3:	68 07 04 00 00       	push   $0x407
+  8028c8:	53                   	push   %ebx
+  8028c9:	6a 00                	push   $0x0
+  8028cb:	01 f0                	add    %esi,%eax
+  8028cd:	50                   	push   %eax
+  8028ce:	6a 00                	push   $0x0
+  8028d0:	e8 ef e5 ff ff       	call   800ec4 <sys_page_map>
+  8028d5:	89 c3                	mov    %eax,%ebx
+  8028d7:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8028dd:	83 c4 20             	add    $0x20,%esp
+  8028e0:	85 c0                	test   %eax,%eax
+  8028e2:	78 60                	js     802944 <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  8028e4:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  8028ea:	75 9a                	jne    802886 <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  8028ec:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  8028f3:	a1 20 40 80 00       	mov    0x804020,%eax
+  8028f8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8028fb:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  8028fd:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802900:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  802907:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80290a:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  80290c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80290f:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  802916:	83 ec 0c             	sub    $0xc,%esp
+  802919:	ff 75 e4             	push   -0x1c(%ebp)
+  80291c:	e8 0f ea ff ff       	call   801330 <fd2num>
+  802921:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802924:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  802926:	83 c4 04             	add    $0x4,%esp
+  802929:	ff 75 e0             	push   -0x20(%ebp)
+  80292c:	e8 ff e9 ff ff       	call   801330 <fd2num>
+  802931:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802934:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  802937:	83 c4 10             	add    $0x10,%esp
+  80293a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80293f:	e9 87 00 00 00       	jmp    8029cb <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802944:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  802949:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80294c:	e8 10 fa ff ff       	call   802361 <pipe_ring>
+  802951:	83 ec 08             	sub    $0x8,%esp
+  802954:	01 f0                	add    %esi,%eax
+  802956:	50                   	push   %eax
+  802957:	6a 00                	push   $0x0
+  802959:	e8 a8 e5 ff ff       	call   800f06 <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  80295e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802961:	e8 fb f9 ff ff       	call   802361 <pipe_ring>
+  802966:	83 c4 08             	add    $0x8,%esp
+  802969:	01 f0                	add    %esi,%eax
+  80296b:	50                   	push   %eax
+  80296c:	6a 00                	push   $0x0
+  80296e:	e8 93 e5 ff ff       	call   800f06 <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802973:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802979:	83 c4 10             	add    $0x10,%esp
+  80297c:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802982:	75 c5                	jne    802949 <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  802984:	83 ec 0c             	sub    $0xc,%esp
+  802987:	ff 75 e0             	push   -0x20(%ebp)
+  80298a:	e8 b1 e9 ff ff       	call   801340 <fd2data>
+  80298f:	83 c4 08             	add    $0x8,%esp
+  802992:	50                   	push   %eax
+  802993:	6a 00                	push   $0x0
+  802995:	e8 6c e5 ff ff       	call   800f06 <sys_page_unmap>
+  80299a:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  80299d:	83 ec 08             	sub    $0x8,%esp
+  8029a0:	57                   	push   %edi
+  8029a1:	6a 00                	push   $0x0
+  8029a3:	e8 5e e5 ff ff       	call   800f06 <sys_page_unmap>
+  8029a8:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  8029ab:	83 ec 08             	sub    $0x8,%esp
+  8029ae:	ff 75 e0             	push   -0x20(%ebp)
+  8029b1:	6a 00                	push   $0x0
+  8029b3:	e8 4e e5 ff ff       	call   800f06 <sys_page_unmap>
+  8029b8:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  8029bb:	83 ec 08             	sub    $0x8,%esp
+  8029be:	ff 75 e4             	push   -0x1c(%ebp)
+  8029c1:	6a 00                	push   $0x0
+  8029c3:	e8 3e e5 ff ff       	call   800f06 <sys_page_unmap>
+  8029c8:	83 c4 10             	add    $0x10,%esp
+}
+  8029cb:	89 d8                	mov    %ebx,%eax
+  8029cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029d0:	5b                   	pop    %ebx
+  8029d1:	5e                   	pop    %esi
+  8029d2:	5f                   	pop    %edi
+  8029d3:	5d                   	pop    %ebp
+  8029d4:	c3                   	ret
+
+008029d5 <pipe>:
+{
+  8029d5:	55                   	push   %ebp
+  8029d6:	89 e5                	mov    %esp,%ebp
+  8029d8:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  8029db:	6a 00                	push   $0x0
+  8029dd:	ff 75 08             	push   0x8(%ebp)
+  8029e0:	e8 cc fd ff ff       	call   8027b1 <pipe2>
+}
+  8029e5:	c9                   	leave
+  8029e6:	c3                   	ret
+
+008029e7 <pipeisclosed>:
+{
+  8029e7:	55                   	push   %ebp
+  8029e8:	89 e5                	mov    %esp,%ebp
+  8029ea:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8029ed:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8029f0:	50                   	push   %eax
+  8029f1:	ff 75 08             	push   0x8(%ebp)
+  8029f4:	e8 b1 e9 ff ff       	call   8013aa <fd_lookup>
+  8029f9:	83 c4 10             	add    $0x10,%esp
+  8029fc:	85 c0                	test   %eax,%eax
+  8029fe:	78 18                	js     802a18 <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  802a00:	83 ec 0c             	sub    $0xc,%esp
+  802a03:	ff 75 f4             	push   -0xc(%ebp)
+  802a06:	e8 35 e9 ff ff       	call   801340 <fd2data>
+  802a0b:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  802a0d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a10:	e8 59 fa ff ff       	call   80246e <_pipeisclosed>
+  802a15:	83 c4 10             	add    $0x10,%esp
+}
+  802a18:	c9                   	leave
+  802a19:	c3                   	ret
+
+00802a1a <pipe_splice>:
+{
+  802a1a:	55                   	push   %ebp
+  802a1b:	89 e5                	mov    %esp,%ebp
+  802a1d:	57                   	push   %edi
+  802a1e:	56                   	push   %esi
+  802a1f:	53                   	push   %ebx
+  802a20:	83 ec 34             	sub    $0x34,%esp
+  802a23:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802a26:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802a29:	50                   	push   %eax
+  802a2a:	ff 75 08             	push   0x8(%ebp)
+  802a2d:	e8 78 e9 ff ff       	call   8013aa <fd_lookup>
+  802a32:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802a35:	83 c4 10             	add    $0x10,%esp
+  802a38:	85 c0                	test   %eax,%eax
+  802a3a:	0f 88 d7 00 00 00    	js     802b17 <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  802a40:	83 ec 0c             	sub    $0xc,%esp
+  802a43:	ff 75 e4             	push   -0x1c(%ebp)
+  802a46:	e8 f5 e8 ff ff       	call   801340 <fd2data>
+  802a4b:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802a4d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802a50:	83 c4 10             	add    $0x10,%esp
+  802a53:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802a59:	39 10                	cmp    %edx,(%eax)
+  802a5b:	0f 85 c1 00 00 00    	jne    802b22 <pipe_splice+0x108>
+  802a61:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  802a65:	0f 84 c0 00 00 00    	je     802b2b <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  802a6b:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802a6f:	0f 84 bf 00 00 00    	je     802b34 <pipe_splice+0x11a>
+  802a75:	89 f7                	mov    %esi,%edi
+  802a77:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  802a7d:	0f 85 ba 00 00 00    	jne    802b3d <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802a83:	8d 43 04             	lea    0x4(%ebx),%eax
+  802a86:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802a89:	eb 38                	jmp    802ac3 <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802a8b:	83 ec 0c             	sub    $0xc,%esp
+  802a8e:	68 00 10 00 00       	push   $0x1000
+  802a93:	89 f1                	mov    %esi,%ecx
+  802a95:	89 da                	mov    %ebx,%edx
+  802a97:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802a9a:	e8 34 fa ff ff       	call   8024d3 <devpipe_write_bulk>
+  802a9f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802aa2:	83 c4 10             	add    $0x10,%esp
+  802aa5:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802aaa:	75 53                	jne    802aff <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  802aac:	83 ec 08             	sub    $0x8,%esp
+  802aaf:	56                   	push   %esi
+  802ab0:	6a 00                	push   $0x0
+  802ab2:	e8 4f e4 ff ff       	call   800f06 <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  802ab7:	83 c7 01             	add    $0x1,%edi
+  802aba:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802ac0:	83 c4 10             	add    $0x10,%esp
+  802ac3:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802ac6:	74 3a                	je     802b02 <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  802ac8:	8b 03                	mov    (%ebx),%eax
+  802aca:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802acd:	75 bc                	jne    802a8b <pipe_splice+0x71>
+  802acf:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ad4:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  802ad8:	85 c0                	test   %eax,%eax
+  802ada:	74 af                	je     802a8b <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802adc:	83 ec 04             	sub    $0x4,%esp
+  802adf:	6a 07                	push   $0x7
+  802ae1:	56                   	push   %esi
+  802ae2:	ff 75 d0             	push   -0x30(%ebp)
+  802ae5:	e8 f3 e6 ff ff       	call   8011dd <sys_chan_wakeup>
+  802aea:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802aed:	83 c4 10             	add    $0x10,%esp
+  802af0:	85 c0                	test   %eax,%eax
+  802af2:	79 b8                	jns    802aac <pipe_splice+0x92>
+  802af4:	b8 01 00 00 00       	mov    $0x1,%eax
+  802af9:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802afd:	eb 8c                	jmp    802a8b <pipe_splice+0x71>
+  802aff:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  802b02:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802b06:	75 06                	jne    802b0e <pipe_splice+0xf4>
+  802b08:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802b0c:	78 09                	js     802b17 <pipe_splice+0xfd>
+  return i * PGSIZE;
+  802b0e:	8b 45 10             	mov    0x10(%ebp),%eax
+  802b11:	c1 e0 0c             	shl    $0xc,%eax
+  802b14:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  802b17:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802b1a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b1d:	5b                   	pop    %ebx
+  802b1e:	5e                   	pop    %esi
+  802b1f:	5f                   	pop    %edi
+  802b20:	5d                   	pop    %ebp
+  802b21:	c3                   	ret
+    return -E_INVAL;
+  802b22:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802b29:	eb ec                	jmp    802b17 <pipe_splice+0xfd>
+  802b2b:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802b32:	eb e3                	jmp    802b17 <pipe_splice+0xfd>
+  802b34:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802b3b:	eb da                	jmp    802b17 <pipe_splice+0xfd>
+  802b3d:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802b44:	eb d1                	jmp    802b17 <pipe_splice+0xfd>
+
+00802b46 <pipe_splice_read>:
+{
+  802b46:	55                   	push   %ebp
+  802b47:	89 e5                	mov    %esp,%ebp
+  802b49:	53                   	push   %ebx
+  802b4a:	83 ec 1c             	sub    $0x1c,%esp
+  802b4d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802b50:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b53:	50                   	push   %eax
+  802b54:	ff 75 08             	push   0x8(%ebp)
+  802b57:	e8 4e e8 ff ff       	call   8013aa <fd_lookup>
+  802b5c:	83 c4 10             	add    $0x10,%esp
+  802b5f:	85 c0                	test   %eax,%eax
+  802b61:	78 49                	js     802bac <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  802b63:	83 ec 0c             	sub    $0xc,%esp
+  802b66:	ff 75 f4             	push   -0xc(%ebp)
+  802b69:	e8 d2 e7 ff ff       	call   801340 <fd2data>
+  802b6e:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802b70:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b73:	83 c4 10             	add    $0x10,%esp
+  802b76:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  802b7c:	39 08                	cmp    %ecx,(%eax)
+  802b7e:	75 31                	jne    802bb1 <pipe_splice_read+0x6b>
+  802b80:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  802b84:	74 32                	je     802bb8 <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  802b86:	8b 48 08             	mov    0x8(%eax),%ecx
+  802b89:	83 e1 03             	and    $0x3,%ecx
+  802b8c:	83 f9 01             	cmp    $0x1,%ecx
+  802b8f:	74 2e                	je     802bbf <pipe_splice_read+0x79>
+  802b91:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  802b97:	75 2d                	jne    802bc6 <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  802b99:	83 ec 08             	sub    $0x8,%esp
+  802b9c:	53                   	push   %ebx
+  802b9d:	68 00 10 00 00       	push   $0x1000
+  802ba2:	89 d9                	mov    %ebx,%ecx
+  802ba4:	e8 93 fa ff ff       	call   80263c <devpipe_read_bulk>
+  802ba9:	83 c4 10             	add    $0x10,%esp
+}
+  802bac:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802baf:	c9                   	leave
+  802bb0:	c3                   	ret
+    return -E_INVAL;
+  802bb1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802bb6:	eb f4                	jmp    802bac <pipe_splice_read+0x66>
+  802bb8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802bbd:	eb ed                	jmp    802bac <pipe_splice_read+0x66>
+  802bbf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802bc4:	eb e6                	jmp    802bac <pipe_splice_read+0x66>
+  802bc6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802bcb:	eb df                	jmp    802bac <pipe_splice_read+0x66>
+
+00802bcd <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  802bcd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bd2:	c3                   	ret
+
+00802bd3 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802bd3:	55                   	push   %ebp
+  802bd4:	89 e5                	mov    %esp,%ebp
+  802bd6:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  802bd9:	68 67 36 80 00       	push   $0x803667
+  802bde:	ff 75 0c             	push   0xc(%ebp)
+  802be1:	e8 6c de ff ff       	call   800a52 <strcpy>
+  return 0;
+}
+  802be6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802beb:	c9                   	leave
+  802bec:	c3                   	ret
+
+00802bed <devcons_write>:
+{
+  802bed:	55                   	push   %ebp
+  802bee:	89 e5                	mov    %esp,%ebp
+  802bf0:	57                   	push   %edi
+  802bf1:	56                   	push   %esi
+  802bf2:	53                   	push   %ebx
+  802bf3:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  802bf9:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  802bfe:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  802c04:	eb 2e                	jmp    802c34 <devcons_write+0x47>
+    m = n - tot;
+  802c06:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802c09:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  802c0b:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802c10:	39 c3                	cmp    %eax,%ebx
+  802c12:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  802c15:	83 ec 04             	sub    $0x4,%esp
+  802c18:	53                   	push   %ebx
+  802c19:	89 f0                	mov    %esi,%eax
+  802c1b:	03 45 0c             	add    0xc(%ebp),%eax
+  802c1e:	50                   	push   %eax
+  802c1f:	57                   	push   %edi
+  802c20:	e8 b3 df ff ff       	call   800bd8 <memmove>
+    sys_cputs(buf, m);
+  802c25:	83 c4 08             	add    $0x8,%esp
+  802c28:	53                   	push   %ebx
+  802c29:	57                   	push   %edi
+  802c2a:	e8 53 e1 ff ff       	call   800d82 <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  802c2f:	01 de                	add    %ebx,%esi
+  802c31:	83 c4 10             	add    $0x10,%esp
+  802c34:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802c37:	72 cd                	jb     802c06 <devcons_write+0x19>
+}
+  802c39:	89 f0                	mov    %esi,%eax
+  802c3b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c3e:	5b                   	pop    %ebx
+  802c3f:	5e                   	pop    %esi
+  802c40:	5f                   	pop    %edi
+  802c41:	5d                   	pop    %ebp
+  802c42:	c3                   	ret
+
+00802c43 <devcons_read>:
+{
+  802c43:	55                   	push   %ebp
+  802c44:	89 e5                	mov    %esp,%ebp
+  802c46:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  802c49:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c4e:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802c52:	75 07                	jne    802c5b <devcons_read+0x18>
+  802c54:	eb 1f                	jmp    802c75 <devcons_read+0x32>
+    sys_yield();
+  802c56:	e8 c4 e1 ff ff       	call   800e1f <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  802c5b:	e8 40 e1 ff ff       	call   800da0 <sys_cgetc>
+  802c60:	85 c0                	test   %eax,%eax
+  802c62:	74 f2                	je     802c56 <devcons_read+0x13>
+  if (c < 0)
+  802c64:	78 0f                	js     802c75 <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  802c66:	83 f8 04             	cmp    $0x4,%eax
+  802c69:	74 0c                	je     802c77 <devcons_read+0x34>
+  *(char*)vbuf = c;
+  802c6b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802c6e:	88 02                	mov    %al,(%edx)
+  return 1;
+  802c70:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802c75:	c9                   	leave
+  802c76:	c3                   	ret
+    return 0;
+  802c77:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c7c:	eb f7                	jmp    802c75 <devcons_read+0x32>
+
+00802c7e <cputchar>:
+{
+  802c7e:	55                   	push   %ebp
+  802c7f:	89 e5                	mov    %esp,%ebp
+  802c81:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  802c84:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c87:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  802c8a:	6a 01                	push   $0x1
+  802c8c:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802c8f:	50                   	push   %eax
+  802c90:	e8 ed e0 ff ff       	call   800d82 <sys_cputs>
+}
+  802c95:	83 c4 10             	add    $0x10,%esp
+  802c98:	c9                   	leave
+  802c99:	c3                   	ret
+
+00802c9a <getchar>:
+{
+  802c9a:	55                   	push   %ebp
+  802c9b:	89 e5                	mov    %esp,%ebp
+  802c9d:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  802ca0:	6a 01                	push   $0x1
+  802ca2:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802ca5:	50                   	push   %eax
+  802ca6:	6a 00                	push   $0x0
+  802ca8:	e8 a8 e9 ff ff       	call   801655 <read>
+  if (r < 0)
+  802cad:	83 c4 10             	add    $0x10,%esp
+  802cb0:	85 c0                	test   %eax,%eax
+  802cb2:	78 06                	js     802cba <getchar+0x20>
+  if (r < 1)
+  802cb4:	74 06                	je     802cbc <getchar+0x22>
+  return c;
+  802cb6:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802cba:	c9                   	leave
+  802cbb:	c3                   	ret
+    return -E_EOF;
+  802cbc:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802cc1:	eb f7                	jmp    802cba <getchar+0x20>
+
+00802cc3 <iscons>:
+{
+  802cc3:	55                   	push   %ebp
+  802cc4:	89 e5                	mov    %esp,%ebp
+  802cc6:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802cc9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802ccc:	50                   	push   %eax
+  802ccd:	ff 75 08             	push   0x8(%ebp)
+  802cd0:	e8 d5 e6 ff ff       	call   8013aa <fd_lookup>
+  802cd5:	83 c4 10             	add    $0x10,%esp
+  802cd8:	85 c0                	test   %eax,%eax
+  802cda:	78 11                	js     802ced <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  802cdc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802cdf:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802ce5:	39 10                	cmp    %edx,(%eax)
+  802ce7:	0f 94 c0             	sete   %al
+  802cea:	0f b6 c0             	movzbl %al,%eax
+}
+  802ced:	c9                   	leave
+  802cee:	c3                   	ret
+
+00802cef <opencons>:
+{
+  802cef:	55                   	push   %ebp
+  802cf0:	89 e5                	mov    %esp,%ebp
+  802cf2:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  802cf5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802cf8:	50                   	push   %eax
+  802cf9:	e8 56 e6 ff ff       	call   801354 <fd_alloc>
+  802cfe:	83 c4 10             	add    $0x10,%esp
+  802d01:	85 c0                	test   %eax,%eax
+  802d03:	78 3a                	js     802d3f <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802d05:	83 ec 04             	sub    $0x4,%esp
+  802d08:	68 07 04 00 00       	push   $0x407
+  802d0d:	ff 75 f4             	push   -0xc(%ebp)
+  802d10:	6a 00                	push   $0x0
+  802d12:	e8 6a e1 ff ff       	call   800e81 <sys_page_alloc>
+  802d17:	83 c4 10             	add    $0x10,%esp
+  802d1a:	85 c0                	test   %eax,%eax
+  802d1c:	78 21                	js     802d3f <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  802d1e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802d21:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802d27:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  802d29:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802d2c:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  802d33:	83 ec 0c             	sub    $0xc,%esp
+  802d36:	50                   	push   %eax
+  802d37:	e8 f4 e5 ff ff       	call   801330 <fd2num>
+  802d3c:	83 c4 10             	add    $0x10,%esp
+}
+  802d3f:	c9                   	leave
+  802d40:	c3                   	ret
+
+00802d41 <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  802d41:	55                   	push   %ebp
+  802d42:	89 e5                	mov    %esp,%ebp
+  802d44:	57                   	push   %edi
+  802d45:	56                   	push   %esi
+  802d46:	53                   	push   %ebx
+  802d47:	83 ec 14             	sub    $0x14,%esp
+  802d4a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802d4d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d50:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802d53:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  802d56:	85 c0                	test   %eax,%eax
+  802d58:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802d5d:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  802d60:	ff 33                	push   (%ebx)
+  802d62:	50                   	push   %eax
+  802d63:	e8 f1 e3 ff ff       	call   801159 <sys_ipc_recv>
+  802d68:	83 c4 10             	add    $0x10,%esp
+  802d6b:	85 c0                	test   %eax,%eax
+  802d6d:	78 39                	js     802da8 <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  802d6f:	85 ff                	test   %edi,%edi
+  802d71:	74 0a                	je     802d7d <ipc_recv_pages+0x3c>
+  802d73:	a1 44 67 80 00       	mov    0x806744,%eax
+  802d78:	8b 40 7c             	mov    0x7c(%eax),%eax
+  802d7b:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  802d7d:	85 f6                	test   %esi,%esi
+  802d7f:	74 0d                	je     802d8e <ipc_recv_pages+0x4d>
+  802d81:	a1 44 67 80 00       	mov    0x806744,%eax
+  802d86:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  802d8c:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  802d8e:	a1 44 67 80 00       	mov    0x806744,%eax
+  802d93:	8b 40 74             	mov    0x74(%eax),%eax
+  802d96:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  802d98:	a1 44 67 80 00       	mov    0x806744,%eax
+  802d9d:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  802da0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802da3:	5b                   	pop    %ebx
+  802da4:	5e                   	pop    %esi
+  802da5:	5f                   	pop    %edi
+  802da6:	5d                   	pop    %ebp
+  802da7:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  802da8:	85 ff                	test   %edi,%edi
+  802daa:	74 06                	je     802db2 <ipc_recv_pages+0x71>
+  802dac:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  802db2:	85 f6                	test   %esi,%esi
+  802db4:	74 06                	je     802dbc <ipc_recv_pages+0x7b>
+  802db6:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  802dbc:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  802dc2:	eb dc                	jmp    802da0 <ipc_recv_pages+0x5f>
+
+00802dc4 <ipc_recv>:
+{
+  802dc4:	55                   	push   %ebp
+  802dc5:	89 e5                	mov    %esp,%ebp
+  802dc7:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  802dca:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  802dd1:	ff 75 10             	push   0x10(%ebp)
+  802dd4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802dd7:	50                   	push   %eax
+  802dd8:	ff 75 0c             	push   0xc(%ebp)
+  802ddb:	ff 75 08             	push   0x8(%ebp)
+  802dde:	e8 5e ff ff ff       	call   802d41 <ipc_recv_pages>
+}
+  802de3:	c9                   	leave
+  802de4:	c3                   	ret
+
+00802de5 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  802de5:	55                   	push   %ebp
+  802de6:	89 e5                	mov    %esp,%ebp
+  802de8:	57                   	push   %edi
+  802de9:	56                   	push   %esi
+  802dea:	53                   	push   %ebx
+  802deb:	83 ec 0c             	sub    $0xc,%esp
+  802dee:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802df1:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802df4:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  802df7:	89 c3                	mov    %eax,%ebx
+  802df9:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  802dff:	85 c0                	test   %eax,%eax
+  802e01:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802e06:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  802e09:	83 ec 0c             	sub    $0xc,%esp
+  802e0c:	ff 75 14             	push   0x14(%ebp)
+  802e0f:	ff 75 18             	push   0x18(%ebp)
+  802e12:	53                   	push   %ebx
+  802e13:	56                   	push   %esi
+  802e14:	57                   	push   %edi
+  802e15:	e8 1e e3 ff ff       	call   801138 <sys_ipc_try_send>
+  802e1a:	83 c4 20             	add    $0x20,%esp
+  802e1d:	85 c0                	test   %eax,%eax
+  802e1f:	79 1e                	jns    802e3f <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  802e21:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802e24:	75 07                	jne    802e2d <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  802e26:	e8 f4 df ff ff       	call   800e1f <sys_yield>
+  802e2b:	eb dc                	jmp    802e09 <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  802e2d:	50                   	push   %eax
+  802e2e:	68 73 36 80 00       	push   $0x803673
+  802e33:	6a 5c                	push   $0x5c
+  802e35:	68 80 36 80 00       	push   $0x803680
+  802e3a:	e8 4a d5 ff ff       	call   800389 <_panic>
+  }
+}
+  802e3f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e42:	5b                   	pop    %ebx
+  802e43:	5e                   	pop    %esi
+  802e44:	5f                   	pop    %edi
+  802e45:	5d                   	pop    %ebp
+  802e46:	c3                   	ret
+
+00802e47 <ipc_send>:
+{
+  802e47:	55                   	push   %ebp
+  802e48:	89 e5                	mov    %esp,%ebp
+  802e4a:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  802e4d:	ff 75 14             	push   0x14(%ebp)
+  802e50:	6a 01                	push   $0x1
+  802e52:	ff 75 10             	push   0x10(%ebp)
+  802e55:	ff 75 0c             	push   0xc(%ebp)
+  802e58:	ff 75 08             	push   0x8(%ebp)
+  802e5b:	e8 85 ff ff ff       	call   802de5 <ipc_send_pages>
+}
+  802e60:	83 c4 20             	add    $0x20,%esp
+  802e63:	c9                   	leave
+  802e64:	c3                   	ret
+
+00802e65 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802e65:	55                   	push   %ebp
+  802e66:	89 e5                	mov    %esp,%ebp
+  802e68:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  802e6b:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  802e70:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802e73:	c1 e0 04             	shl    $0x4,%eax
+  802e76:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802e7b:	8b 40 50             	mov    0x50(%eax),%eax
+  802e7e:	39 c8                	cmp    %ecx,%eax
+  802e80:	74 12                	je     802e94 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  802e82:	83 c2 01             	add    $0x1,%edx
+  802e85:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802e8b:	75 e3                	jne    802e70 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  802e8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e92:	eb 0e                	jmp    802ea2 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  802e94:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802e97:	c1 e0 04             	shl    $0x4,%eax
+  802e9a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802e9f:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802ea2:	5d                   	pop    %ebp
+  802ea3:	c3                   	ret
+
+00802ea4 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802ea4:	55                   	push   %ebp
+  802ea5:	89 e5                	mov    %esp,%ebp
+  802ea7:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802eaa:	89 c2                	mov    %eax,%edx
+  802eac:	c1 ea 16             	shr    $0x16,%edx
+  802eaf:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  802eb6:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802ebb:	f6 c1 01             	test   $0x1,%cl
+  802ebe:	74 1c                	je     802edc <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  802ec0:	c1 e8 0c             	shr    $0xc,%eax
+  802ec3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  802eca:	a8 01                	test   $0x1,%al
+  802ecc:	74 0e                	je     802edc <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  802ece:	c1 e8 0c             	shr    $0xc,%eax
+  802ed1:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802ed8:	ef 
+  802ed9:	0f b7 d2             	movzwl %dx,%edx
+}
+  802edc:	89 d0                	mov    %edx,%eax
+  802ede:	5d                   	pop    %ebp
+  802edf:	c3                   	ret
+
+00802ee0 <udivmod>:
+  802ee0:	55                   	push   %ebp
+  802ee1:	57                   	push   %edi
+  802ee2:	56                   	push   %esi
+  802ee3:	53                   	push   %ebx
+  802ee4:	83 ec 14             	sub    $0x14,%esp
+  802ee7:	8b 74 24 28          	mov    0x28(%esp),%esi
+  802eeb:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  802eef:	89 fb                	mov    %edi,%ebx
+  802ef1:	09 f3                	or     %esi,%ebx
+  802ef3:	0f 84 88 00 00 00    	je     802f81 <udivmod+0xa1>
+  802ef9:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802efe:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802f05:	00 
+  802f06:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802f0d:	00 
+  802f0e:	89 cd                	mov    %ecx,%ebp
+  802f10:	89 34 24             	mov    %esi,(%esp)
+  802f13:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802f17:	eb 08                	jmp    802f21 <udivmod+0x41>
+  802f19:	83 ed 01             	sub    $0x1,%ebp
+  802f1c:	83 fd ff             	cmp    $0xffffffff,%ebp
+  802f1f:	74 6c                	je     802f8d <udivmod+0xad>
+  802f21:	89 c3                	mov    %eax,%ebx
+  802f23:	89 d6                	mov    %edx,%esi
+  802f25:	89 e9                	mov    %ebp,%ecx
+  802f27:	0f ad f3             	shrd   %cl,%esi,%ebx
+  802f2a:	d3 ee                	shr    %cl,%esi
+  802f2c:	f6 c1 20             	test   $0x20,%cl
+  802f2f:	74 04                	je     802f35 <udivmod+0x55>
+  802f31:	89 f3                	mov    %esi,%ebx
+  802f33:	31 f6                	xor    %esi,%esi
+  802f35:	8b 3c 24             	mov    (%esp),%edi
+  802f38:	39 fb                	cmp    %edi,%ebx
+  802f3a:	89 f7                	mov    %esi,%edi
+  802f3c:	8b 1c 24             	mov    (%esp),%ebx
+  802f3f:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802f43:	19 f7                	sbb    %esi,%edi
+  802f45:	72 d2                	jb     802f19 <udivmod+0x39>
+  802f47:	89 f7                	mov    %esi,%edi
+  802f49:	89 de                	mov    %ebx,%esi
+  802f4b:	89 e9                	mov    %ebp,%ecx
+  802f4d:	0f a5 f7             	shld   %cl,%esi,%edi
+  802f50:	d3 e6                	shl    %cl,%esi
+  802f52:	f6 c1 20             	test   $0x20,%cl
+  802f55:	74 04                	je     802f5b <udivmod+0x7b>
+  802f57:	89 f7                	mov    %esi,%edi
+  802f59:	31 f6                	xor    %esi,%esi
+  802f5b:	29 f0                	sub    %esi,%eax
+  802f5d:	19 fa                	sbb    %edi,%edx
+  802f5f:	be 01 00 00 00       	mov    $0x1,%esi
+  802f64:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f69:	0f a5 f7             	shld   %cl,%esi,%edi
+  802f6c:	d3 e6                	shl    %cl,%esi
+  802f6e:	f6 c1 20             	test   $0x20,%cl
+  802f71:	74 04                	je     802f77 <udivmod+0x97>
+  802f73:	89 f7                	mov    %esi,%edi
+  802f75:	31 f6                	xor    %esi,%esi
+  802f77:	09 74 24 08          	or     %esi,0x8(%esp)
+  802f7b:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802f7f:	eb 98                	jmp    802f19 <udivmod+0x39>
+  802f81:	89 f0                	mov    %esi,%eax
+  802f83:	89 fa                	mov    %edi,%edx
+  802f85:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802f89:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802f8d:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802f91:	89 01                	mov    %eax,(%ecx)
+  802f93:	89 51 04             	mov    %edx,0x4(%ecx)
+  802f96:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802f9a:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802f9e:	83 c4 14             	add    $0x14,%esp
+  802fa1:	5b                   	pop    %ebx
+  802fa2:	5e                   	pop    %esi
+  802fa3:	5f                   	pop    %edi
+  802fa4:	5d                   	pop    %ebp
+  802fa5:	c3                   	ret
+
+00802fa6 <__udivdi3>:
+  802fa6:	83 ec 18             	sub    $0x18,%esp
+  802fa9:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802fad:	50                   	push   %eax
+  802fae:	ff 74 24 2c          	push   0x2c(%esp)
+  802fb2:	ff 74 24 2c          	push   0x2c(%esp)
+  802fb6:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802fba:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802fbe:	e8 1d ff ff ff       	call   802ee0 <udivmod>
+  802fc3:	83 c4 24             	add    $0x24,%esp
+  802fc6:	c3                   	ret
+
+00802fc7 <__umoddi3>:
+  802fc7:	83 ec 18             	sub    $0x18,%esp
+  802fca:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802fce:	50                   	push   %eax
+  802fcf:	ff 74 24 2c          	push   0x2c(%esp)
+  802fd3:	ff 74 24 2c          	push   0x2c(%esp)
+  802fd7:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802fdb:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802fdf:	e8 fc fe ff ff       	call   802ee0 <udivmod>
+  802fe4:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802fe8:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802fec:	83 c4 24             	add    $0x24,%esp
+  802fef:	c3                   	ret
+
+00802ff0 <__divdi3>:
+  802ff0:	56                   	push   %esi
+  802ff1:	53                   	push   %ebx
+  802ff2:	83 ec 14             	sub    $0x14,%esp
+  802ff5:	8b 44 24 20          	mov    0x20(%esp),%eax
+  802ff9:	8b 54 24 24          	mov    0x24(%esp),%edx
+  802ffd:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  803001:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  803005:	85 d2                	test   %edx,%edx
+  803007:	78 18                	js     803021 <__divdi3+0x31>
+  803009:	85 db                	test   %ebx,%ebx
+  80300b:	78 3e                	js     80304b <__divdi3+0x5b>
+  80300d:	83 ec 04             	sub    $0x4,%esp
+  803010:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803014:	56                   	push   %esi
+  803015:	53                   	push   %ebx
+  803016:	51                   	push   %ecx
+  803017:	e8 c4 fe ff ff       	call   802ee0 <udivmod>
+  80301c:	83 c4 10             	add    $0x10,%esp
+  80301f:	eb 24                	jmp    803045 <__divdi3+0x55>
+  803021:	f7 d8                	neg    %eax
+  803023:	83 d2 00             	adc    $0x0,%edx
+  803026:	f7 da                	neg    %edx
+  803028:	85 db                	test   %ebx,%ebx
+  80302a:	78 3a                	js     803066 <__divdi3+0x76>
+  80302c:	83 ec 04             	sub    $0x4,%esp
+  80302f:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803033:	56                   	push   %esi
+  803034:	53                   	push   %ebx
+  803035:	51                   	push   %ecx
+  803036:	e8 a5 fe ff ff       	call   802ee0 <udivmod>
+  80303b:	83 c4 10             	add    $0x10,%esp
+  80303e:	f7 d8                	neg    %eax
+  803040:	83 d2 00             	adc    $0x0,%edx
+  803043:	f7 da                	neg    %edx
+  803045:	83 c4 14             	add    $0x14,%esp
+  803048:	5b                   	pop    %ebx
+  803049:	5e                   	pop    %esi
+  80304a:	c3                   	ret
+  80304b:	83 ec 04             	sub    $0x4,%esp
+  80304e:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803052:	56                   	push   %esi
+  803053:	f7 d9                	neg    %ecx
+  803055:	83 d3 00             	adc    $0x0,%ebx
+  803058:	f7 db                	neg    %ebx
+  80305a:	53                   	push   %ebx
+  80305b:	51                   	push   %ecx
+  80305c:	e8 7f fe ff ff       	call   802ee0 <udivmod>
+  803061:	83 c4 10             	add    $0x10,%esp
+  803064:	eb d8                	jmp    80303e <__divdi3+0x4e>
+  803066:	83 ec 04             	sub    $0x4,%esp
+  803069:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80306d:	56                   	push   %esi
+  80306e:	f7 d9                	neg    %ecx
+  803070:	83 d3 00             	adc    $0x0,%ebx
+  803073:	f7 db                	neg    %ebx
+  803075:	53                   	push   %ebx
+  803076:	51                   	push   %ecx
+  803077:	e8 64 fe ff ff       	call   802ee0 <udivmod>
+  80307c:	83 c4 10             	add    $0x10,%esp
+  80307f:	eb c4                	jmp    803045 <__divdi3+0x55>
+
+00803081 <__moddi3>:
+  803081:	55                   	push   %ebp
+  803082:	57                   	push   %edi
+  803083:	56                   	push   %esi
+  803084:	53                   	push   %ebx
+  803085:	83 ec 24             	sub    $0x24,%esp
+  803088:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80308c:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803090:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  803094:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  803098:	85 d2                	test   %edx,%edx
+  80309a:	78 3b                	js     8030d7 <__moddi3+0x56>
+  80309c:	83 ec 04             	sub    $0x4,%esp
+  80309f:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8030a3:	56                   	push   %esi
+  8030a4:	89 ce                	mov    %ecx,%esi
+  8030a6:	f7 de                	neg    %esi
+  8030a8:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8030ac:	89 de                	mov    %ebx,%esi
+  8030ae:	83 d6 00             	adc    $0x0,%esi
+  8030b1:	f7 de                	neg    %esi
+  8030b3:	89 74 24 14          	mov    %esi,0x14(%esp)
+  8030b7:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8030bb:	0f 48 f1             	cmovs  %ecx,%esi
+  8030be:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  8030c3:	53                   	push   %ebx
+  8030c4:	56                   	push   %esi
+  8030c5:	e8 16 fe ff ff       	call   802ee0 <udivmod>
+  8030ca:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8030ce:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8030d2:	83 c4 10             	add    $0x10,%esp
+  8030d5:	eb 47                	jmp    80311e <__moddi3+0x9d>
+  8030d7:	f7 d8                	neg    %eax
+  8030d9:	83 d2 00             	adc    $0x0,%edx
+  8030dc:	f7 da                	neg    %edx
+  8030de:	83 ec 04             	sub    $0x4,%esp
+  8030e1:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8030e5:	56                   	push   %esi
+  8030e6:	89 cf                	mov    %ecx,%edi
+  8030e8:	f7 df                	neg    %edi
+  8030ea:	89 de                	mov    %ebx,%esi
+  8030ec:	83 d6 00             	adc    $0x0,%esi
+  8030ef:	f7 de                	neg    %esi
+  8030f1:	0f 49 cf             	cmovns %edi,%ecx
+  8030f4:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  8030f8:	0f 49 de             	cmovns %esi,%ebx
+  8030fb:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  8030ff:	ff 74 24 0c          	push   0xc(%esp)
+  803103:	ff 74 24 0c          	push   0xc(%esp)
+  803107:	e8 d4 fd ff ff       	call   802ee0 <udivmod>
+  80310c:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803110:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803114:	f7 d8                	neg    %eax
+  803116:	83 d2 00             	adc    $0x0,%edx
+  803119:	f7 da                	neg    %edx
+  80311b:	83 c4 10             	add    $0x10,%esp
+  80311e:	83 c4 24             	add    $0x24,%esp
+  803121:	5b                   	pop    %ebx
+  803122:	5e                   	pop    %esi
+  803123:	5f                   	pop    %edi
+  803124:	5d                   	pop    %ebp
+  803125:	c3                   	ret
@@ -0,0 +1,6366 @@
+
+obj/user/divzero.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 23 00 00 00       	call   800054 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+int zero;
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+  zero = 0;
+  800039:	c7 05 44 57 80 00 00 	movl   $0x0,0x805744
+  800040:	00 00 00 
+  cprintf("1/0 is %08x!\n", 1/zero);
+  800043:	6a 00                	push   $0x0
+  800045:	68 60 2e 80 00       	push   $0x802e60
+  80004a:	e8 07 01 00 00       	call   800156 <cprintf>
+}
+  80004f:	83 c4 10             	add    $0x10,%esp
+  800052:	c9                   	leave
+  800053:	c3                   	ret
+
+00800054 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800054:	55                   	push   %ebp
+  800055:	89 e5                	mov    %esp,%ebp
+  800057:	56                   	push   %esi
+  800058:	53                   	push   %ebx
+  800059:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80005c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  80005f:	c7 05 48 57 80 00 00 	movl   $0x0,0x805748
+  800066:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  800069:	e8 84 0a 00 00       	call   800af2 <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  80006e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800073:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800076:	c1 e0 04             	shl    $0x4,%eax
+  800079:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80007e:	a3 48 57 80 00       	mov    %eax,0x805748
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800083:	85 db                	test   %ebx,%ebx
+  800085:	7e 07                	jle    80008e <libmain+0x3a>
+    binaryname = argv[0];
+  800087:	8b 06                	mov    (%esi),%eax
+  800089:	a3 00 40 80 00       	mov    %eax,0x804000
+
+  // call user main routine
+  umain(argc, argv);
+  80008e:	83 ec 08             	sub    $0x8,%esp
+  800091:	56                   	push   %esi
+  800092:	53                   	push   %ebx
+  800093:	e8 9b ff ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  800098:	e8 0a 00 00 00       	call   8000a7 <exit>
+}
+  80009d:	83 c4 10             	add    $0x10,%esp
+  8000a0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000a3:	5b                   	pop    %ebx
+  8000a4:	5e                   	pop    %esi
+  8000a5:	5d                   	pop    %ebp
+  8000a6:	c3                   	ret
+
+008000a7 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000a7:	55                   	push   %ebp
+  8000a8:	89 e5                	mov    %esp,%ebp
+  8000aa:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  8000ad:	e8 3a 11 00 00       	call   8011ec <close_all>
+  sys_env_destroy(0);
+  8000b2:	83 ec 0c             	sub    $0xc,%esp
+  8000b5:	6a 00                	push   $0x0
+  8000b7:	e8 f5 09 00 00       	call   800ab1 <sys_env_destroy>
+}
+  8000bc:	83 c4 10             	add    $0x10,%esp
+  8000bf:	c9                   	leave
+  8000c0:	c3                   	ret
+
+008000c1 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8000c1:	55                   	push   %ebp
+  8000c2:	89 e5                	mov    %esp,%ebp
+  8000c4:	53                   	push   %ebx
+  8000c5:	83 ec 04             	sub    $0x4,%esp
+  8000c8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  8000cb:	8b 13                	mov    (%ebx),%edx
+  8000cd:	8d 42 01             	lea    0x1(%edx),%eax
+  8000d0:	89 03                	mov    %eax,(%ebx)
+  8000d2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8000d5:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  8000d9:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8000de:	74 09                	je     8000e9 <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  8000e0:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8000e4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8000e7:	c9                   	leave
+  8000e8:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  8000e9:	83 ec 08             	sub    $0x8,%esp
+  8000ec:	68 ff 00 00 00       	push   $0xff
+  8000f1:	8d 43 08             	lea    0x8(%ebx),%eax
+  8000f4:	50                   	push   %eax
+  8000f5:	e8 7a 09 00 00       	call   800a74 <sys_cputs>
+    b->idx = 0;
+  8000fa:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800100:	83 c4 10             	add    $0x10,%esp
+  800103:	eb db                	jmp    8000e0 <putch+0x1f>
+
+00800105 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800105:	55                   	push   %ebp
+  800106:	89 e5                	mov    %esp,%ebp
+  800108:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  80010e:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800115:	00 00 00 
+  b.cnt = 0;
+  800118:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80011f:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  800122:	ff 75 0c             	push   0xc(%ebp)
+  800125:	ff 75 08             	push   0x8(%ebp)
+  800128:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80012e:	50                   	push   %eax
+  80012f:	68 c1 00 80 00       	push   $0x8000c1
+  800134:	e8 14 01 00 00       	call   80024d <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  800139:	83 c4 08             	add    $0x8,%esp
+  80013c:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800142:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800148:	50                   	push   %eax
+  800149:	e8 26 09 00 00       	call   800a74 <sys_cputs>
+
+  return b.cnt;
+}
+  80014e:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800154:	c9                   	leave
+  800155:	c3                   	ret
+
+00800156 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800156:	55                   	push   %ebp
+  800157:	89 e5                	mov    %esp,%ebp
+  800159:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  80015c:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  80015f:	50                   	push   %eax
+  800160:	ff 75 08             	push   0x8(%ebp)
+  800163:	e8 9d ff ff ff       	call   800105 <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  800168:	c9                   	leave
+  800169:	c3                   	ret
+
+0080016a <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  80016a:	55                   	push   %ebp
+  80016b:	89 e5                	mov    %esp,%ebp
+  80016d:	57                   	push   %edi
+  80016e:	56                   	push   %esi
+  80016f:	53                   	push   %ebx
+  800170:	83 ec 1c             	sub    $0x1c,%esp
+  800173:	89 c7                	mov    %eax,%edi
+  800175:	89 d6                	mov    %edx,%esi
+  800177:	8b 45 08             	mov    0x8(%ebp),%eax
+  80017a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80017d:	89 d1                	mov    %edx,%ecx
+  80017f:	89 c2                	mov    %eax,%edx
+  800181:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800184:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800187:	8b 45 10             	mov    0x10(%ebp),%eax
+  80018a:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  80018d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800190:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800197:	39 c2                	cmp    %eax,%edx
+  800199:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80019c:	72 3e                	jb     8001dc <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  80019e:	83 ec 0c             	sub    $0xc,%esp
+  8001a1:	ff 75 18             	push   0x18(%ebp)
+  8001a4:	83 eb 01             	sub    $0x1,%ebx
+  8001a7:	53                   	push   %ebx
+  8001a8:	50                   	push   %eax
+  8001a9:	83 ec 08             	sub    $0x8,%esp
+  8001ac:	ff 75 e4             	push   -0x1c(%ebp)
+  8001af:	ff 75 e0             	push   -0x20(%ebp)
+  8001b2:	ff 75 dc             	push   -0x24(%ebp)
+  8001b5:	ff 75 d8             	push   -0x28(%ebp)
+  8001b8:	e8 21 2b 00 00       	call   802cde <__udivdi3>
+  8001bd:	83 c4 18             	add    $0x18,%esp
+  8001c0:	52                   	push   %edx
+  8001c1:	50                   	push   %eax
+  8001c2:	89 f2                	mov    %esi,%edx
+  8001c4:	89 f8                	mov    %edi,%eax
+  8001c6:	e8 9f ff ff ff       	call   80016a <printnum>
+  8001cb:	83 c4 20             	add    $0x20,%esp
+  8001ce:	eb 13                	jmp    8001e3 <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  8001d0:	83 ec 08             	sub    $0x8,%esp
+  8001d3:	56                   	push   %esi
+  8001d4:	ff 75 18             	push   0x18(%ebp)
+  8001d7:	ff d7                	call   *%edi
+  8001d9:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  8001dc:	83 eb 01             	sub    $0x1,%ebx
+  8001df:	85 db                	test   %ebx,%ebx
+  8001e1:	7f ed                	jg     8001d0 <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  8001e3:	83 ec 08             	sub    $0x8,%esp
+  8001e6:	56                   	push   %esi
+  8001e7:	83 ec 04             	sub    $0x4,%esp
+  8001ea:	ff 75 e4             	push   -0x1c(%ebp)
+  8001ed:	ff 75 e0             	push   -0x20(%ebp)
+  8001f0:	ff 75 dc             	push   -0x24(%ebp)
+  8001f3:	ff 75 d8             	push   -0x28(%ebp)
+  8001f6:	e8 04 2b 00 00       	call   802cff <__umoddi3>
+  8001fb:	83 c4 14             	add    $0x14,%esp
+  8001fe:	0f be 80 78 2e 80 00 	movsbl 0x802e78(%eax),%eax
+  800205:	50                   	push   %eax
+  800206:	ff d7                	call   *%edi
+}
+  800208:	83 c4 10             	add    $0x10,%esp
+  80020b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80020e:	5b                   	pop    %ebx
+  80020f:	5e                   	pop    %esi
+  800210:	5f                   	pop    %edi
+  800211:	5d                   	pop    %ebp
+  800212:	c3                   	ret
+
+00800213 <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800213:	55                   	push   %ebp
+  800214:	89 e5                	mov    %esp,%ebp
+  800216:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  800219:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  80021d:	8b 10                	mov    (%eax),%edx
+  80021f:	3b 50 04             	cmp    0x4(%eax),%edx
+  800222:	73 0a                	jae    80022e <sprintputch+0x1b>
+    *b->buf++ = ch;
+  800224:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800227:	89 08                	mov    %ecx,(%eax)
+  800229:	8b 45 08             	mov    0x8(%ebp),%eax
+  80022c:	88 02                	mov    %al,(%edx)
+}
+  80022e:	5d                   	pop    %ebp
+  80022f:	c3                   	ret
+
+00800230 <printfmt>:
+{
+  800230:	55                   	push   %ebp
+  800231:	89 e5                	mov    %esp,%ebp
+  800233:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  800236:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  800239:	50                   	push   %eax
+  80023a:	ff 75 10             	push   0x10(%ebp)
+  80023d:	ff 75 0c             	push   0xc(%ebp)
+  800240:	ff 75 08             	push   0x8(%ebp)
+  800243:	e8 05 00 00 00       	call   80024d <vprintfmt>
+}
+  800248:	83 c4 10             	add    $0x10,%esp
+  80024b:	c9                   	leave
+  80024c:	c3                   	ret
+
+0080024d <vprintfmt>:
+{
+  80024d:	55                   	push   %ebp
+  80024e:	89 e5                	mov    %esp,%ebp
+  800250:	57                   	push   %edi
+  800251:	56                   	push   %esi
+  800252:	53                   	push   %ebx
+  800253:	83 ec 2c             	sub    $0x2c,%esp
+  800256:	8b 75 08             	mov    0x8(%ebp),%esi
+  800259:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80025c:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80025f:	eb 0a                	jmp    80026b <vprintfmt+0x1e>
+      putch(ch, putdat);
+  800261:	83 ec 08             	sub    $0x8,%esp
+  800264:	53                   	push   %ebx
+  800265:	50                   	push   %eax
+  800266:	ff d6                	call   *%esi
+  800268:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  80026b:	83 c7 01             	add    $0x1,%edi
+  80026e:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800272:	83 f8 25             	cmp    $0x25,%eax
+  800275:	74 0c                	je     800283 <vprintfmt+0x36>
+      if (ch == '\0')
+  800277:	85 c0                	test   %eax,%eax
+  800279:	75 e6                	jne    800261 <vprintfmt+0x14>
+}
+  80027b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80027e:	5b                   	pop    %ebx
+  80027f:	5e                   	pop    %esi
+  800280:	5f                   	pop    %edi
+  800281:	5d                   	pop    %ebp
+  800282:	c3                   	ret
+    padc = ' ';
+  800283:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  800287:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  80028e:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  800295:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  80029c:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  8002a1:	8d 47 01             	lea    0x1(%edi),%eax
+  8002a4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8002a7:	0f b6 17             	movzbl (%edi),%edx
+  8002aa:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8002ad:	3c 55                	cmp    $0x55,%al
+  8002af:	0f 87 cf 03 00 00    	ja     800684 <vprintfmt+0x437>
+  8002b5:	0f b6 c0             	movzbl %al,%eax
+  8002b8:	ff 24 85 c0 2f 80 00 	jmp    *0x802fc0(,%eax,4)
+  8002bf:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  8002c2:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8002c6:	eb d9                	jmp    8002a1 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  8002c8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8002cb:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8002cf:	eb d0                	jmp    8002a1 <vprintfmt+0x54>
+  8002d1:	0f b6 d2             	movzbl %dl,%edx
+  8002d4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  8002d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002dc:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  8002df:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8002e2:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  8002e6:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  8002e9:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8002ec:	83 f9 09             	cmp    $0x9,%ecx
+  8002ef:	77 55                	ja     800346 <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  8002f1:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  8002f4:	eb e9                	jmp    8002df <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  8002f6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8002f9:	8b 00                	mov    (%eax),%eax
+  8002fb:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8002fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800301:	8d 40 04             	lea    0x4(%eax),%eax
+  800304:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  800307:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  80030a:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80030e:	79 91                	jns    8002a1 <vprintfmt+0x54>
+        width = precision, precision = -1;
+  800310:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800313:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800316:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80031d:	eb 82                	jmp    8002a1 <vprintfmt+0x54>
+      if (width < 0)
+  80031f:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800322:	85 d2                	test   %edx,%edx
+  800324:	b8 00 00 00 00       	mov    $0x0,%eax
+  800329:	0f 49 c2             	cmovns %edx,%eax
+  80032c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  80032f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  800332:	e9 6a ff ff ff       	jmp    8002a1 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  800337:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  80033a:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  800341:	e9 5b ff ff ff       	jmp    8002a1 <vprintfmt+0x54>
+  800346:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800349:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80034c:	eb bc                	jmp    80030a <vprintfmt+0xbd>
+      lflag++;
+  80034e:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  800351:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  800354:	e9 48 ff ff ff       	jmp    8002a1 <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  800359:	8b 45 14             	mov    0x14(%ebp),%eax
+  80035c:	8d 78 04             	lea    0x4(%eax),%edi
+  80035f:	83 ec 08             	sub    $0x8,%esp
+  800362:	53                   	push   %ebx
+  800363:	ff 30                	push   (%eax)
+  800365:	ff d6                	call   *%esi
+      break;
+  800367:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  80036a:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  80036d:	e9 b1 02 00 00       	jmp    800623 <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  800372:	8b 45 14             	mov    0x14(%ebp),%eax
+  800375:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  800378:	8b 10                	mov    (%eax),%edx
+  80037a:	89 d0                	mov    %edx,%eax
+  80037c:	f7 d8                	neg    %eax
+  80037e:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800381:	83 f8 10             	cmp    $0x10,%eax
+  800384:	7f 23                	jg     8003a9 <vprintfmt+0x15c>
+  800386:	8b 14 85 20 31 80 00 	mov    0x803120(,%eax,4),%edx
+  80038d:	85 d2                	test   %edx,%edx
+  80038f:	74 18                	je     8003a9 <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  800391:	52                   	push   %edx
+  800392:	68 6a 32 80 00       	push   $0x80326a
+  800397:	53                   	push   %ebx
+  800398:	56                   	push   %esi
+  800399:	e8 92 fe ff ff       	call   800230 <printfmt>
+  80039e:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  8003a1:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8003a4:	e9 7a 02 00 00       	jmp    800623 <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  8003a9:	50                   	push   %eax
+  8003aa:	68 90 2e 80 00       	push   $0x802e90
+  8003af:	53                   	push   %ebx
+  8003b0:	56                   	push   %esi
+  8003b1:	e8 7a fe ff ff       	call   800230 <printfmt>
+  8003b6:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  8003b9:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  8003bc:	e9 62 02 00 00       	jmp    800623 <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  8003c1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003c4:	83 c0 04             	add    $0x4,%eax
+  8003c7:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8003ca:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003cd:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  8003cf:	85 c9                	test   %ecx,%ecx
+  8003d1:	b8 89 2e 80 00       	mov    $0x802e89,%eax
+  8003d6:	0f 45 c1             	cmovne %ecx,%eax
+  8003d9:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  8003dc:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003e0:	7e 06                	jle    8003e8 <vprintfmt+0x19b>
+  8003e2:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8003e6:	75 0b                	jne    8003f3 <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8003e8:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8003eb:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8003ee:	89 75 08             	mov    %esi,0x8(%ebp)
+  8003f1:	eb 5c                	jmp    80044f <vprintfmt+0x202>
+  8003f3:	83 ec 08             	sub    $0x8,%esp
+  8003f6:	ff 75 d0             	push   -0x30(%ebp)
+  8003f9:	ff 75 cc             	push   -0x34(%ebp)
+  8003fc:	e8 20 03 00 00       	call   800721 <strnlen>
+  800401:	89 c2                	mov    %eax,%edx
+  800403:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800406:	29 d0                	sub    %edx,%eax
+  800408:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  80040b:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80040f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800412:	89 75 08             	mov    %esi,0x8(%ebp)
+  800415:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800417:	eb 0e                	jmp    800427 <vprintfmt+0x1da>
+          putch(padc, putdat);
+  800419:	83 ec 08             	sub    $0x8,%esp
+  80041c:	53                   	push   %ebx
+  80041d:	57                   	push   %edi
+  80041e:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800421:	83 ee 01             	sub    $0x1,%esi
+  800424:	83 c4 10             	add    $0x10,%esp
+  800427:	85 f6                	test   %esi,%esi
+  800429:	7f ee                	jg     800419 <vprintfmt+0x1cc>
+  80042b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80042e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800431:	85 c0                	test   %eax,%eax
+  800433:	ba 00 00 00 00       	mov    $0x0,%edx
+  800438:	0f 49 d0             	cmovns %eax,%edx
+  80043b:	29 d0                	sub    %edx,%eax
+  80043d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800440:	eb a6                	jmp    8003e8 <vprintfmt+0x19b>
+          putch(ch, putdat);
+  800442:	83 ec 08             	sub    $0x8,%esp
+  800445:	53                   	push   %ebx
+  800446:	52                   	push   %edx
+  800447:	ff 55 08             	call   *0x8(%ebp)
+  80044a:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80044d:	89 f1                	mov    %esi,%ecx
+  80044f:	8d 71 01             	lea    0x1(%ecx),%esi
+  800452:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800456:	0f be d0             	movsbl %al,%edx
+  800459:	85 d2                	test   %edx,%edx
+  80045b:	74 28                	je     800485 <vprintfmt+0x238>
+  80045d:	85 ff                	test   %edi,%edi
+  80045f:	78 05                	js     800466 <vprintfmt+0x219>
+  800461:	83 ef 01             	sub    $0x1,%edi
+  800464:	78 30                	js     800496 <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  800466:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80046a:	74 d6                	je     800442 <vprintfmt+0x1f5>
+  80046c:	0f be c0             	movsbl %al,%eax
+  80046f:	83 e8 20             	sub    $0x20,%eax
+  800472:	83 f8 5e             	cmp    $0x5e,%eax
+  800475:	76 cb                	jbe    800442 <vprintfmt+0x1f5>
+          putch('?', putdat);
+  800477:	83 ec 08             	sub    $0x8,%esp
+  80047a:	53                   	push   %ebx
+  80047b:	6a 3f                	push   $0x3f
+  80047d:	ff 55 08             	call   *0x8(%ebp)
+  800480:	83 c4 10             	add    $0x10,%esp
+  800483:	eb c8                	jmp    80044d <vprintfmt+0x200>
+  800485:	8b 75 08             	mov    0x8(%ebp),%esi
+  800488:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80048b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80048e:	01 d0                	add    %edx,%eax
+  800490:	29 c8                	sub    %ecx,%eax
+  800492:	89 c7                	mov    %eax,%edi
+  800494:	eb 13                	jmp    8004a9 <vprintfmt+0x25c>
+  800496:	8b 75 08             	mov    0x8(%ebp),%esi
+  800499:	eb ed                	jmp    800488 <vprintfmt+0x23b>
+        putch(' ', putdat);
+  80049b:	83 ec 08             	sub    $0x8,%esp
+  80049e:	53                   	push   %ebx
+  80049f:	6a 20                	push   $0x20
+  8004a1:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  8004a3:	83 ef 01             	sub    $0x1,%edi
+  8004a6:	83 c4 10             	add    $0x10,%esp
+  8004a9:	85 ff                	test   %edi,%edi
+  8004ab:	7f ee                	jg     80049b <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  8004ad:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8004b0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004b3:	e9 6b 01 00 00       	jmp    800623 <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  8004b8:	83 f9 01             	cmp    $0x1,%ecx
+  8004bb:	7f 1f                	jg     8004dc <vprintfmt+0x28f>
+  else if (lflag)
+  8004bd:	85 c9                	test   %ecx,%ecx
+  8004bf:	74 67                	je     800528 <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  8004c1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004c4:	8b 00                	mov    (%eax),%eax
+  8004c6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004c9:	89 c1                	mov    %eax,%ecx
+  8004cb:	c1 f9 1f             	sar    $0x1f,%ecx
+  8004ce:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8004d1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004d4:	8d 40 04             	lea    0x4(%eax),%eax
+  8004d7:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004da:	eb 17                	jmp    8004f3 <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  8004dc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004df:	8b 50 04             	mov    0x4(%eax),%edx
+  8004e2:	8b 00                	mov    (%eax),%eax
+  8004e4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004e7:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8004ea:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004ed:	8d 40 08             	lea    0x8(%eax),%eax
+  8004f0:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  8004f3:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8004f6:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  8004f9:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  8004fe:	85 c9                	test   %ecx,%ecx
+  800500:	0f 89 03 01 00 00    	jns    800609 <vprintfmt+0x3bc>
+        putch('-', putdat);
+  800506:	83 ec 08             	sub    $0x8,%esp
+  800509:	53                   	push   %ebx
+  80050a:	6a 2d                	push   $0x2d
+  80050c:	ff d6                	call   *%esi
+        num = -(long long)num;
+  80050e:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800511:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800514:	f7 da                	neg    %edx
+  800516:	83 d1 00             	adc    $0x0,%ecx
+  800519:	f7 d9                	neg    %ecx
+  80051b:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  80051e:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800523:	e9 e1 00 00 00       	jmp    800609 <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  800528:	8b 45 14             	mov    0x14(%ebp),%eax
+  80052b:	8b 00                	mov    (%eax),%eax
+  80052d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800530:	89 c1                	mov    %eax,%ecx
+  800532:	c1 f9 1f             	sar    $0x1f,%ecx
+  800535:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800538:	8b 45 14             	mov    0x14(%ebp),%eax
+  80053b:	8d 40 04             	lea    0x4(%eax),%eax
+  80053e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800541:	eb b0                	jmp    8004f3 <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  800543:	83 f9 01             	cmp    $0x1,%ecx
+  800546:	7f 1e                	jg     800566 <vprintfmt+0x319>
+  else if (lflag)
+  800548:	85 c9                	test   %ecx,%ecx
+  80054a:	74 32                	je     80057e <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  80054c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80054f:	8b 10                	mov    (%eax),%edx
+  800551:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800556:	8d 40 04             	lea    0x4(%eax),%eax
+  800559:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  80055c:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  800561:	e9 a3 00 00 00       	jmp    800609 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800566:	8b 45 14             	mov    0x14(%ebp),%eax
+  800569:	8b 10                	mov    (%eax),%edx
+  80056b:	8b 48 04             	mov    0x4(%eax),%ecx
+  80056e:	8d 40 08             	lea    0x8(%eax),%eax
+  800571:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800574:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  800579:	e9 8b 00 00 00       	jmp    800609 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  80057e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800581:	8b 10                	mov    (%eax),%edx
+  800583:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800588:	8d 40 04             	lea    0x4(%eax),%eax
+  80058b:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  80058e:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  800593:	eb 74                	jmp    800609 <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  800595:	83 f9 01             	cmp    $0x1,%ecx
+  800598:	7f 1b                	jg     8005b5 <vprintfmt+0x368>
+  else if (lflag)
+  80059a:	85 c9                	test   %ecx,%ecx
+  80059c:	74 2c                	je     8005ca <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  80059e:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a1:	8b 10                	mov    (%eax),%edx
+  8005a3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005a8:	8d 40 04             	lea    0x4(%eax),%eax
+  8005ab:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8005ae:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  8005b3:	eb 54                	jmp    800609 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  8005b5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b8:	8b 10                	mov    (%eax),%edx
+  8005ba:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005bd:	8d 40 08             	lea    0x8(%eax),%eax
+  8005c0:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8005c3:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  8005c8:	eb 3f                	jmp    800609 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8005ca:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005cd:	8b 10                	mov    (%eax),%edx
+  8005cf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005d4:	8d 40 04             	lea    0x4(%eax),%eax
+  8005d7:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8005da:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  8005df:	eb 28                	jmp    800609 <vprintfmt+0x3bc>
+      putch('0', putdat);
+  8005e1:	83 ec 08             	sub    $0x8,%esp
+  8005e4:	53                   	push   %ebx
+  8005e5:	6a 30                	push   $0x30
+  8005e7:	ff d6                	call   *%esi
+      putch('x', putdat);
+  8005e9:	83 c4 08             	add    $0x8,%esp
+  8005ec:	53                   	push   %ebx
+  8005ed:	6a 78                	push   $0x78
+  8005ef:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  8005f1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f4:	8b 10                	mov    (%eax),%edx
+  8005f6:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  8005fb:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  8005fe:	8d 40 04             	lea    0x4(%eax),%eax
+  800601:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800604:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  800609:	83 ec 0c             	sub    $0xc,%esp
+  80060c:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800610:	50                   	push   %eax
+  800611:	ff 75 e0             	push   -0x20(%ebp)
+  800614:	57                   	push   %edi
+  800615:	51                   	push   %ecx
+  800616:	52                   	push   %edx
+  800617:	89 da                	mov    %ebx,%edx
+  800619:	89 f0                	mov    %esi,%eax
+  80061b:	e8 4a fb ff ff       	call   80016a <printnum>
+      break;
+  800620:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  800623:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  800626:	e9 40 fc ff ff       	jmp    80026b <vprintfmt+0x1e>
+  if (lflag >= 2)
+  80062b:	83 f9 01             	cmp    $0x1,%ecx
+  80062e:	7f 1b                	jg     80064b <vprintfmt+0x3fe>
+  else if (lflag)
+  800630:	85 c9                	test   %ecx,%ecx
+  800632:	74 2c                	je     800660 <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  800634:	8b 45 14             	mov    0x14(%ebp),%eax
+  800637:	8b 10                	mov    (%eax),%edx
+  800639:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80063e:	8d 40 04             	lea    0x4(%eax),%eax
+  800641:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800644:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  800649:	eb be                	jmp    800609 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  80064b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80064e:	8b 10                	mov    (%eax),%edx
+  800650:	8b 48 04             	mov    0x4(%eax),%ecx
+  800653:	8d 40 08             	lea    0x8(%eax),%eax
+  800656:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800659:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  80065e:	eb a9                	jmp    800609 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800660:	8b 45 14             	mov    0x14(%ebp),%eax
+  800663:	8b 10                	mov    (%eax),%edx
+  800665:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80066a:	8d 40 04             	lea    0x4(%eax),%eax
+  80066d:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800670:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  800675:	eb 92                	jmp    800609 <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  800677:	83 ec 08             	sub    $0x8,%esp
+  80067a:	53                   	push   %ebx
+  80067b:	6a 25                	push   $0x25
+  80067d:	ff d6                	call   *%esi
+      break;
+  80067f:	83 c4 10             	add    $0x10,%esp
+  800682:	eb 9f                	jmp    800623 <vprintfmt+0x3d6>
+      putch('%', putdat);
+  800684:	83 ec 08             	sub    $0x8,%esp
+  800687:	53                   	push   %ebx
+  800688:	6a 25                	push   $0x25
+  80068a:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  80068c:	83 c4 10             	add    $0x10,%esp
+  80068f:	89 f8                	mov    %edi,%eax
+  800691:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800695:	74 05                	je     80069c <vprintfmt+0x44f>
+  800697:	83 e8 01             	sub    $0x1,%eax
+  80069a:	eb f5                	jmp    800691 <vprintfmt+0x444>
+  80069c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80069f:	eb 82                	jmp    800623 <vprintfmt+0x3d6>
+
+008006a1 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8006a1:	55                   	push   %ebp
+  8006a2:	89 e5                	mov    %esp,%ebp
+  8006a4:	83 ec 18             	sub    $0x18,%esp
+  8006a7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006aa:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  8006ad:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8006b0:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8006b4:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8006b7:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  8006be:	85 c0                	test   %eax,%eax
+  8006c0:	74 26                	je     8006e8 <vsnprintf+0x47>
+  8006c2:	85 d2                	test   %edx,%edx
+  8006c4:	7e 22                	jle    8006e8 <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8006c6:	ff 75 14             	push   0x14(%ebp)
+  8006c9:	ff 75 10             	push   0x10(%ebp)
+  8006cc:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8006cf:	50                   	push   %eax
+  8006d0:	68 13 02 80 00       	push   $0x800213
+  8006d5:	e8 73 fb ff ff       	call   80024d <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  8006da:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8006dd:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  8006e0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8006e3:	83 c4 10             	add    $0x10,%esp
+}
+  8006e6:	c9                   	leave
+  8006e7:	c3                   	ret
+    return -E_INVAL;
+  8006e8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006ed:	eb f7                	jmp    8006e6 <vsnprintf+0x45>
+
+008006ef <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8006ef:	55                   	push   %ebp
+  8006f0:	89 e5                	mov    %esp,%ebp
+  8006f2:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  8006f5:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  8006f8:	50                   	push   %eax
+  8006f9:	ff 75 10             	push   0x10(%ebp)
+  8006fc:	ff 75 0c             	push   0xc(%ebp)
+  8006ff:	ff 75 08             	push   0x8(%ebp)
+  800702:	e8 9a ff ff ff       	call   8006a1 <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  800707:	c9                   	leave
+  800708:	c3                   	ret
+
+00800709 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800709:	55                   	push   %ebp
+  80070a:	89 e5                	mov    %esp,%ebp
+  80070c:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  80070f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800714:	eb 03                	jmp    800719 <strlen+0x10>
+    n++;
+  800716:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  800719:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80071d:	75 f7                	jne    800716 <strlen+0xd>
+  return n;
+}
+  80071f:	5d                   	pop    %ebp
+  800720:	c3                   	ret
+
+00800721 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800721:	55                   	push   %ebp
+  800722:	89 e5                	mov    %esp,%ebp
+  800724:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800727:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80072a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80072f:	eb 03                	jmp    800734 <strnlen+0x13>
+    n++;
+  800731:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800734:	39 d0                	cmp    %edx,%eax
+  800736:	74 08                	je     800740 <strnlen+0x1f>
+  800738:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80073c:	75 f3                	jne    800731 <strnlen+0x10>
+  80073e:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  800740:	89 d0                	mov    %edx,%eax
+  800742:	5d                   	pop    %ebp
+  800743:	c3                   	ret
+
+00800744 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800744:	55                   	push   %ebp
+  800745:	89 e5                	mov    %esp,%ebp
+  800747:	53                   	push   %ebx
+  800748:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80074b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  80074e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800753:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800757:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80075a:	83 c0 01             	add    $0x1,%eax
+  80075d:	84 d2                	test   %dl,%dl
+  80075f:	75 f2                	jne    800753 <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  800761:	89 c8                	mov    %ecx,%eax
+  800763:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800766:	c9                   	leave
+  800767:	c3                   	ret
+
+00800768 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800768:	55                   	push   %ebp
+  800769:	89 e5                	mov    %esp,%ebp
+  80076b:	53                   	push   %ebx
+  80076c:	83 ec 10             	sub    $0x10,%esp
+  80076f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  800772:	53                   	push   %ebx
+  800773:	e8 91 ff ff ff       	call   800709 <strlen>
+  800778:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  80077b:	ff 75 0c             	push   0xc(%ebp)
+  80077e:	01 d8                	add    %ebx,%eax
+  800780:	50                   	push   %eax
+  800781:	e8 be ff ff ff       	call   800744 <strcpy>
+  return dst;
+}
+  800786:	89 d8                	mov    %ebx,%eax
+  800788:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80078b:	c9                   	leave
+  80078c:	c3                   	ret
+
+0080078d <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  80078d:	55                   	push   %ebp
+  80078e:	89 e5                	mov    %esp,%ebp
+  800790:	56                   	push   %esi
+  800791:	53                   	push   %ebx
+  800792:	8b 75 08             	mov    0x8(%ebp),%esi
+  800795:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  800798:	89 f3                	mov    %esi,%ebx
+  80079a:	03 5d 10             	add    0x10(%ebp),%ebx
+  80079d:	89 f0                	mov    %esi,%eax
+  80079f:	eb 0f                	jmp    8007b0 <strncpy+0x23>
+    *dst++ = *src;
+  8007a1:	83 c0 01             	add    $0x1,%eax
+  8007a4:	0f b6 0a             	movzbl (%edx),%ecx
+  8007a7:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  8007aa:	80 f9 01             	cmp    $0x1,%cl
+  8007ad:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  8007b0:	39 d8                	cmp    %ebx,%eax
+  8007b2:	75 ed                	jne    8007a1 <strncpy+0x14>
+  }
+  return ret;
+}
+  8007b4:	89 f0                	mov    %esi,%eax
+  8007b6:	5b                   	pop    %ebx
+  8007b7:	5e                   	pop    %esi
+  8007b8:	5d                   	pop    %ebp
+  8007b9:	c3                   	ret
+
+008007ba <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8007ba:	55                   	push   %ebp
+  8007bb:	89 e5                	mov    %esp,%ebp
+  8007bd:	56                   	push   %esi
+  8007be:	53                   	push   %ebx
+  8007bf:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007c2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007c5:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  8007c8:	89 f0                	mov    %esi,%eax
+  8007ca:	85 d2                	test   %edx,%edx
+  8007cc:	74 21                	je     8007ef <strlcpy+0x35>
+  8007ce:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8007d2:	89 f2                	mov    %esi,%edx
+  8007d4:	eb 09                	jmp    8007df <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  8007d6:	83 c1 01             	add    $0x1,%ecx
+  8007d9:	83 c2 01             	add    $0x1,%edx
+  8007dc:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  8007df:	39 c2                	cmp    %eax,%edx
+  8007e1:	74 09                	je     8007ec <strlcpy+0x32>
+  8007e3:	0f b6 19             	movzbl (%ecx),%ebx
+  8007e6:	84 db                	test   %bl,%bl
+  8007e8:	75 ec                	jne    8007d6 <strlcpy+0x1c>
+  8007ea:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  8007ec:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  8007ef:	29 f0                	sub    %esi,%eax
+}
+  8007f1:	5b                   	pop    %ebx
+  8007f2:	5e                   	pop    %esi
+  8007f3:	5d                   	pop    %ebp
+  8007f4:	c3                   	ret
+
+008007f5 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8007f5:	55                   	push   %ebp
+  8007f6:	89 e5                	mov    %esp,%ebp
+  8007f8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007fb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  8007fe:	eb 06                	jmp    800806 <strcmp+0x11>
+    p++, q++;
+  800800:	83 c1 01             	add    $0x1,%ecx
+  800803:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  800806:	0f b6 01             	movzbl (%ecx),%eax
+  800809:	84 c0                	test   %al,%al
+  80080b:	74 04                	je     800811 <strcmp+0x1c>
+  80080d:	3a 02                	cmp    (%edx),%al
+  80080f:	74 ef                	je     800800 <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  800811:	0f b6 c0             	movzbl %al,%eax
+  800814:	0f b6 12             	movzbl (%edx),%edx
+  800817:	29 d0                	sub    %edx,%eax
+}
+  800819:	5d                   	pop    %ebp
+  80081a:	c3                   	ret
+
+0080081b <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80081b:	55                   	push   %ebp
+  80081c:	89 e5                	mov    %esp,%ebp
+  80081e:	53                   	push   %ebx
+  80081f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800822:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800825:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  800828:	eb 09                	jmp    800833 <strncmp+0x18>
+    n--, p++, q++;
+  80082a:	83 ea 01             	sub    $0x1,%edx
+  80082d:	83 c0 01             	add    $0x1,%eax
+  800830:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  800833:	85 d2                	test   %edx,%edx
+  800835:	74 18                	je     80084f <strncmp+0x34>
+  800837:	0f b6 18             	movzbl (%eax),%ebx
+  80083a:	84 db                	test   %bl,%bl
+  80083c:	74 04                	je     800842 <strncmp+0x27>
+  80083e:	3a 19                	cmp    (%ecx),%bl
+  800840:	74 e8                	je     80082a <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800842:	0f b6 00             	movzbl (%eax),%eax
+  800845:	0f b6 11             	movzbl (%ecx),%edx
+  800848:	29 d0                	sub    %edx,%eax
+}
+  80084a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80084d:	c9                   	leave
+  80084e:	c3                   	ret
+    return 0;
+  80084f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800854:	eb f4                	jmp    80084a <strncmp+0x2f>
+
+00800856 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800856:	55                   	push   %ebp
+  800857:	89 e5                	mov    %esp,%ebp
+  800859:	8b 45 08             	mov    0x8(%ebp),%eax
+  80085c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800860:	eb 03                	jmp    800865 <strchr+0xf>
+  800862:	83 c0 01             	add    $0x1,%eax
+  800865:	0f b6 10             	movzbl (%eax),%edx
+  800868:	84 d2                	test   %dl,%dl
+  80086a:	74 06                	je     800872 <strchr+0x1c>
+    if (*s == c)
+  80086c:	38 ca                	cmp    %cl,%dl
+  80086e:	75 f2                	jne    800862 <strchr+0xc>
+  800870:	eb 05                	jmp    800877 <strchr+0x21>
+      return (char*)s;
+  return 0;
+  800872:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800877:	5d                   	pop    %ebp
+  800878:	c3                   	ret
+
+00800879 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800879:	55                   	push   %ebp
+  80087a:	89 e5                	mov    %esp,%ebp
+  80087c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80087f:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800883:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  800886:	38 ca                	cmp    %cl,%dl
+  800888:	74 09                	je     800893 <strfind+0x1a>
+  80088a:	84 d2                	test   %dl,%dl
+  80088c:	74 05                	je     800893 <strfind+0x1a>
+  for (; *s; s++)
+  80088e:	83 c0 01             	add    $0x1,%eax
+  800891:	eb f0                	jmp    800883 <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  800893:	5d                   	pop    %ebp
+  800894:	c3                   	ret
+
+00800895 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800895:	55                   	push   %ebp
+  800896:	89 e5                	mov    %esp,%ebp
+  800898:	57                   	push   %edi
+  800899:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80089c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  80089f:	85 c9                	test   %ecx,%ecx
+  8008a1:	74 20                	je     8008c3 <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  8008a3:	89 f8                	mov    %edi,%eax
+  8008a5:	09 c8                	or     %ecx,%eax
+  8008a7:	a8 03                	test   $0x3,%al
+  8008a9:	75 12                	jne    8008bd <memset+0x28>
+    c &= 0xFF;
+  8008ab:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8008af:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  8008b5:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  8008b8:	fc                   	cld
+  8008b9:	f3 ab                	rep stos %eax,%es:(%edi)
+  8008bb:	eb 06                	jmp    8008c3 <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  8008bd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8008c0:	fc                   	cld
+  8008c1:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  8008c3:	89 f8                	mov    %edi,%eax
+  8008c5:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8008c8:	c9                   	leave
+  8008c9:	c3                   	ret
+
+008008ca <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8008ca:	55                   	push   %ebp
+  8008cb:	89 e5                	mov    %esp,%ebp
+  8008cd:	57                   	push   %edi
+  8008ce:	56                   	push   %esi
+  8008cf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008d2:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8008d5:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  8008d8:	39 c6                	cmp    %eax,%esi
+  8008da:	73 32                	jae    80090e <memmove+0x44>
+  8008dc:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8008df:	39 d0                	cmp    %edx,%eax
+  8008e1:	73 2b                	jae    80090e <memmove+0x44>
+    s += n;
+    d += n;
+  8008e3:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8008e6:	89 d6                	mov    %edx,%esi
+  8008e8:	09 fe                	or     %edi,%esi
+  8008ea:	09 ce                	or     %ecx,%esi
+  8008ec:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8008f2:	75 0e                	jne    800902 <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8008f4:	83 ef 04             	sub    $0x4,%edi
+  8008f7:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8008fa:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  8008fd:	fd                   	std
+  8008fe:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800900:	eb 09                	jmp    80090b <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800902:	83 ef 01             	sub    $0x1,%edi
+  800905:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  800908:	fd                   	std
+  800909:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  80090b:	fc                   	cld
+  80090c:	eb 1a                	jmp    800928 <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80090e:	89 f2                	mov    %esi,%edx
+  800910:	09 c2                	or     %eax,%edx
+  800912:	09 ca                	or     %ecx,%edx
+  800914:	f6 c2 03             	test   $0x3,%dl
+  800917:	75 0a                	jne    800923 <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800919:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  80091c:	89 c7                	mov    %eax,%edi
+  80091e:	fc                   	cld
+  80091f:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800921:	eb 05                	jmp    800928 <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  800923:	89 c7                	mov    %eax,%edi
+  800925:	fc                   	cld
+  800926:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  800928:	5e                   	pop    %esi
+  800929:	5f                   	pop    %edi
+  80092a:	5d                   	pop    %ebp
+  80092b:	c3                   	ret
+
+0080092c <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  80092c:	55                   	push   %ebp
+  80092d:	89 e5                	mov    %esp,%ebp
+  80092f:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  800932:	ff 75 10             	push   0x10(%ebp)
+  800935:	ff 75 0c             	push   0xc(%ebp)
+  800938:	ff 75 08             	push   0x8(%ebp)
+  80093b:	e8 8a ff ff ff       	call   8008ca <memmove>
+}
+  800940:	c9                   	leave
+  800941:	c3                   	ret
+
+00800942 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800942:	55                   	push   %ebp
+  800943:	89 e5                	mov    %esp,%ebp
+  800945:	56                   	push   %esi
+  800946:	53                   	push   %ebx
+  800947:	8b 45 08             	mov    0x8(%ebp),%eax
+  80094a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  80094d:	89 c6                	mov    %eax,%esi
+  80094f:	03 75 10             	add    0x10(%ebp),%esi
+  800952:	eb 06                	jmp    80095a <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  800954:	83 c0 01             	add    $0x1,%eax
+  800957:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  80095a:	39 f0                	cmp    %esi,%eax
+  80095c:	74 14                	je     800972 <memcmp+0x30>
+    if (*s1 != *s2)
+  80095e:	0f b6 08             	movzbl (%eax),%ecx
+  800961:	0f b6 1a             	movzbl (%edx),%ebx
+  800964:	38 d9                	cmp    %bl,%cl
+  800966:	74 ec                	je     800954 <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  800968:	0f b6 c1             	movzbl %cl,%eax
+  80096b:	0f b6 db             	movzbl %bl,%ebx
+  80096e:	29 d8                	sub    %ebx,%eax
+  800970:	eb 05                	jmp    800977 <memcmp+0x35>
+  }
+
+  return 0;
+  800972:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800977:	5b                   	pop    %ebx
+  800978:	5e                   	pop    %esi
+  800979:	5d                   	pop    %ebp
+  80097a:	c3                   	ret
+
+0080097b <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  80097b:	55                   	push   %ebp
+  80097c:	89 e5                	mov    %esp,%ebp
+  80097e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800981:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  800984:	89 c2                	mov    %eax,%edx
+  800986:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  800989:	eb 03                	jmp    80098e <memfind+0x13>
+  80098b:	83 c0 01             	add    $0x1,%eax
+  80098e:	39 d0                	cmp    %edx,%eax
+  800990:	73 04                	jae    800996 <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  800992:	38 08                	cmp    %cl,(%eax)
+  800994:	75 f5                	jne    80098b <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  800996:	5d                   	pop    %ebp
+  800997:	c3                   	ret
+
+00800998 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800998:	55                   	push   %ebp
+  800999:	89 e5                	mov    %esp,%ebp
+  80099b:	57                   	push   %edi
+  80099c:	56                   	push   %esi
+  80099d:	53                   	push   %ebx
+  80099e:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009a1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  8009a4:	eb 03                	jmp    8009a9 <strtol+0x11>
+    s++;
+  8009a6:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  8009a9:	0f b6 02             	movzbl (%edx),%eax
+  8009ac:	3c 20                	cmp    $0x20,%al
+  8009ae:	74 f6                	je     8009a6 <strtol+0xe>
+  8009b0:	3c 09                	cmp    $0x9,%al
+  8009b2:	74 f2                	je     8009a6 <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  8009b4:	3c 2b                	cmp    $0x2b,%al
+  8009b6:	74 2a                	je     8009e2 <strtol+0x4a>
+  int neg = 0;
+  8009b8:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  8009bd:	3c 2d                	cmp    $0x2d,%al
+  8009bf:	74 2b                	je     8009ec <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8009c1:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8009c7:	75 0f                	jne    8009d8 <strtol+0x40>
+  8009c9:	80 3a 30             	cmpb   $0x30,(%edx)
+  8009cc:	74 28                	je     8009f6 <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  8009ce:	85 db                	test   %ebx,%ebx
+  8009d0:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8009d5:	0f 44 d8             	cmove  %eax,%ebx
+  8009d8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009dd:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8009e0:	eb 46                	jmp    800a28 <strtol+0x90>
+    s++;
+  8009e2:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  8009e5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009ea:	eb d5                	jmp    8009c1 <strtol+0x29>
+    s++, neg = 1;
+  8009ec:	83 c2 01             	add    $0x1,%edx
+  8009ef:	bf 01 00 00 00       	mov    $0x1,%edi
+  8009f4:	eb cb                	jmp    8009c1 <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8009f6:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8009fa:	74 0e                	je     800a0a <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  8009fc:	85 db                	test   %ebx,%ebx
+  8009fe:	75 d8                	jne    8009d8 <strtol+0x40>
+    s++, base = 8;
+  800a00:	83 c2 01             	add    $0x1,%edx
+  800a03:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a08:	eb ce                	jmp    8009d8 <strtol+0x40>
+    s += 2, base = 16;
+  800a0a:	83 c2 02             	add    $0x2,%edx
+  800a0d:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a12:	eb c4                	jmp    8009d8 <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  800a14:	0f be c0             	movsbl %al,%eax
+  800a17:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  800a1a:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a1d:	7d 3a                	jge    800a59 <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  800a1f:	83 c2 01             	add    $0x1,%edx
+  800a22:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a26:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  800a28:	0f b6 02             	movzbl (%edx),%eax
+  800a2b:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a2e:	89 f3                	mov    %esi,%ebx
+  800a30:	80 fb 09             	cmp    $0x9,%bl
+  800a33:	76 df                	jbe    800a14 <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  800a35:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800a38:	89 f3                	mov    %esi,%ebx
+  800a3a:	80 fb 19             	cmp    $0x19,%bl
+  800a3d:	77 08                	ja     800a47 <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  800a3f:	0f be c0             	movsbl %al,%eax
+  800a42:	83 e8 57             	sub    $0x57,%eax
+  800a45:	eb d3                	jmp    800a1a <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  800a47:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800a4a:	89 f3                	mov    %esi,%ebx
+  800a4c:	80 fb 19             	cmp    $0x19,%bl
+  800a4f:	77 08                	ja     800a59 <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  800a51:	0f be c0             	movsbl %al,%eax
+  800a54:	83 e8 37             	sub    $0x37,%eax
+  800a57:	eb c1                	jmp    800a1a <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  800a59:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800a5d:	74 05                	je     800a64 <strtol+0xcc>
+    *endptr = (char*)s;
+  800a5f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a62:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  800a64:	89 c8                	mov    %ecx,%eax
+  800a66:	f7 d8                	neg    %eax
+  800a68:	85 ff                	test   %edi,%edi
+  800a6a:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800a6d:	89 c8                	mov    %ecx,%eax
+  800a6f:	5b                   	pop    %ebx
+  800a70:	5e                   	pop    %esi
+  800a71:	5f                   	pop    %edi
+  800a72:	5d                   	pop    %ebp
+  800a73:	c3                   	ret
+
+00800a74 <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800a74:	55                   	push   %ebp
+  800a75:	89 e5                	mov    %esp,%ebp
+  800a77:	57                   	push   %edi
+  800a78:	56                   	push   %esi
+  800a79:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800a7a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a7f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a82:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a85:	89 c3                	mov    %eax,%ebx
+  800a87:	89 c7                	mov    %eax,%edi
+  800a89:	89 c6                	mov    %eax,%esi
+  800a8b:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800a8d:	5b                   	pop    %ebx
+  800a8e:	5e                   	pop    %esi
+  800a8f:	5f                   	pop    %edi
+  800a90:	5d                   	pop    %ebp
+  800a91:	c3                   	ret
+
+00800a92 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800a92:	55                   	push   %ebp
+  800a93:	89 e5                	mov    %esp,%ebp
+  800a95:	57                   	push   %edi
+  800a96:	56                   	push   %esi
+  800a97:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800a98:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a9d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800aa2:	89 d1                	mov    %edx,%ecx
+  800aa4:	89 d3                	mov    %edx,%ebx
+  800aa6:	89 d7                	mov    %edx,%edi
+  800aa8:	89 d6                	mov    %edx,%esi
+  800aaa:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800aac:	5b                   	pop    %ebx
+  800aad:	5e                   	pop    %esi
+  800aae:	5f                   	pop    %edi
+  800aaf:	5d                   	pop    %ebp
+  800ab0:	c3                   	ret
+
+00800ab1 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800ab1:	55                   	push   %ebp
+  800ab2:	89 e5                	mov    %esp,%ebp
+  800ab4:	57                   	push   %edi
+  800ab5:	56                   	push   %esi
+  800ab6:	53                   	push   %ebx
+  800ab7:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800aba:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800abf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ac2:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ac7:	89 cb                	mov    %ecx,%ebx
+  800ac9:	89 cf                	mov    %ecx,%edi
+  800acb:	89 ce                	mov    %ecx,%esi
+  800acd:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800acf:	85 c0                	test   %eax,%eax
+  800ad1:	7f 08                	jg     800adb <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800ad3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ad6:	5b                   	pop    %ebx
+  800ad7:	5e                   	pop    %esi
+  800ad8:	5f                   	pop    %edi
+  800ad9:	5d                   	pop    %ebp
+  800ada:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800adb:	83 ec 0c             	sub    $0xc,%esp
+  800ade:	50                   	push   %eax
+  800adf:	6a 03                	push   $0x3
+  800ae1:	68 83 31 80 00       	push   $0x803183
+  800ae6:	6a 23                	push   $0x23
+  800ae8:	68 a0 31 80 00       	push   $0x8031a0
+  800aed:	e8 41 1f 00 00       	call   802a33 <_panic>
+
+00800af2 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800af2:	55                   	push   %ebp
+  800af3:	89 e5                	mov    %esp,%ebp
+  800af5:	57                   	push   %edi
+  800af6:	56                   	push   %esi
+  800af7:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800af8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800afd:	b8 02 00 00 00       	mov    $0x2,%eax
+  800b02:	89 d1                	mov    %edx,%ecx
+  800b04:	89 d3                	mov    %edx,%ebx
+  800b06:	89 d7                	mov    %edx,%edi
+  800b08:	89 d6                	mov    %edx,%esi
+  800b0a:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800b0c:	5b                   	pop    %ebx
+  800b0d:	5e                   	pop    %esi
+  800b0e:	5f                   	pop    %edi
+  800b0f:	5d                   	pop    %ebp
+  800b10:	c3                   	ret
+
+00800b11 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800b11:	55                   	push   %ebp
+  800b12:	89 e5                	mov    %esp,%ebp
+  800b14:	57                   	push   %edi
+  800b15:	56                   	push   %esi
+  800b16:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800b17:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b1c:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800b21:	89 d1                	mov    %edx,%ecx
+  800b23:	89 d3                	mov    %edx,%ebx
+  800b25:	89 d7                	mov    %edx,%edi
+  800b27:	89 d6                	mov    %edx,%esi
+  800b29:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800b2b:	5b                   	pop    %ebx
+  800b2c:	5e                   	pop    %esi
+  800b2d:	5f                   	pop    %edi
+  800b2e:	5d                   	pop    %ebp
+  800b2f:	c3                   	ret
+
+00800b30 <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  800b30:	55                   	push   %ebp
+  800b31:	89 e5                	mov    %esp,%ebp
+  800b33:	57                   	push   %edi
+  800b34:	56                   	push   %esi
+  800b35:	53                   	push   %ebx
+  800b36:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  800b39:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  800b3d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b42:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b45:	b8 14 00 00 00       	mov    $0x14,%eax
+  800b4a:	89 df                	mov    %ebx,%edi
+  800b4c:	89 de                	mov    %ebx,%esi
+  800b4e:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800b50:	85 c0                	test   %eax,%eax
+  800b52:	7f 08                	jg     800b5c <sys_env_set_cow+0x2c>
+}
+  800b54:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b57:	5b                   	pop    %ebx
+  800b58:	5e                   	pop    %esi
+  800b59:	5f                   	pop    %edi
+  800b5a:	5d                   	pop    %ebp
+  800b5b:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800b5c:	83 ec 0c             	sub    $0xc,%esp
+  800b5f:	50                   	push   %eax
+  800b60:	6a 14                	push   $0x14
+  800b62:	68 83 31 80 00       	push   $0x803183
+  800b67:	6a 23                	push   $0x23
+  800b69:	68 a0 31 80 00       	push   $0x8031a0
+  800b6e:	e8 c0 1e 00 00       	call   802a33 <_panic>
+
+00800b73 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800b73:	55                   	push   %ebp
+  800b74:	89 e5                	mov    %esp,%ebp
+  800b76:	57                   	push   %edi
+  800b77:	56                   	push   %esi
+  800b78:	53                   	push   %ebx
+  800b79:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800b7c:	be 00 00 00 00       	mov    $0x0,%esi
+  800b81:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b84:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b87:	b8 04 00 00 00       	mov    $0x4,%eax
+  800b8c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800b8f:	89 f7                	mov    %esi,%edi
+  800b91:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800b93:	85 c0                	test   %eax,%eax
+  800b95:	7f 08                	jg     800b9f <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  800b97:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b9a:	5b                   	pop    %ebx
+  800b9b:	5e                   	pop    %esi
+  800b9c:	5f                   	pop    %edi
+  800b9d:	5d                   	pop    %ebp
+  800b9e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800b9f:	83 ec 0c             	sub    $0xc,%esp
+  800ba2:	50                   	push   %eax
+  800ba3:	6a 04                	push   $0x4
+  800ba5:	68 83 31 80 00       	push   $0x803183
+  800baa:	6a 23                	push   $0x23
+  800bac:	68 a0 31 80 00       	push   $0x8031a0
+  800bb1:	e8 7d 1e 00 00       	call   802a33 <_panic>
+
+00800bb6 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800bb6:	55                   	push   %ebp
+  800bb7:	89 e5                	mov    %esp,%ebp
+  800bb9:	57                   	push   %edi
+  800bba:	56                   	push   %esi
+  800bbb:	53                   	push   %ebx
+  800bbc:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800bbf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bc2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bc5:	b8 05 00 00 00       	mov    $0x5,%eax
+  800bca:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800bcd:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800bd0:	8b 75 18             	mov    0x18(%ebp),%esi
+  800bd3:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800bd5:	85 c0                	test   %eax,%eax
+  800bd7:	7f 08                	jg     800be1 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  800bd9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bdc:	5b                   	pop    %ebx
+  800bdd:	5e                   	pop    %esi
+  800bde:	5f                   	pop    %edi
+  800bdf:	5d                   	pop    %ebp
+  800be0:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800be1:	83 ec 0c             	sub    $0xc,%esp
+  800be4:	50                   	push   %eax
+  800be5:	6a 05                	push   $0x5
+  800be7:	68 83 31 80 00       	push   $0x803183
+  800bec:	6a 23                	push   $0x23
+  800bee:	68 a0 31 80 00       	push   $0x8031a0
+  800bf3:	e8 3b 1e 00 00       	call   802a33 <_panic>
+
+00800bf8 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800bf8:	55                   	push   %ebp
+  800bf9:	89 e5                	mov    %esp,%ebp
+  800bfb:	57                   	push   %edi
+  800bfc:	56                   	push   %esi
+  800bfd:	53                   	push   %ebx
+  800bfe:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800c01:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c06:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c09:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c0c:	b8 06 00 00 00       	mov    $0x6,%eax
+  800c11:	89 df                	mov    %ebx,%edi
+  800c13:	89 de                	mov    %ebx,%esi
+  800c15:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c17:	85 c0                	test   %eax,%eax
+  800c19:	7f 08                	jg     800c23 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  800c1b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c1e:	5b                   	pop    %ebx
+  800c1f:	5e                   	pop    %esi
+  800c20:	5f                   	pop    %edi
+  800c21:	5d                   	pop    %ebp
+  800c22:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c23:	83 ec 0c             	sub    $0xc,%esp
+  800c26:	50                   	push   %eax
+  800c27:	6a 06                	push   $0x6
+  800c29:	68 83 31 80 00       	push   $0x803183
+  800c2e:	6a 23                	push   $0x23
+  800c30:	68 a0 31 80 00       	push   $0x8031a0
+  800c35:	e8 f9 1d 00 00       	call   802a33 <_panic>
+
+00800c3a <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  800c3a:	55                   	push   %ebp
+  800c3b:	89 e5                	mov    %esp,%ebp
+  800c3d:	57                   	push   %edi
+  800c3e:	56                   	push   %esi
+  800c3f:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800c40:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c43:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c46:	b8 11 00 00 00       	mov    $0x11,%eax
+  800c4b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c4e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c51:	8b 75 18             	mov    0x18(%ebp),%esi
+  800c54:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  800c56:	5b                   	pop    %ebx
+  800c57:	5e                   	pop    %esi
+  800c58:	5f                   	pop    %edi
+  800c59:	5d                   	pop    %ebp
+  800c5a:	c3                   	ret
+
+00800c5b <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  800c5b:	55                   	push   %ebp
+  800c5c:	89 e5                	mov    %esp,%ebp
+  800c5e:	57                   	push   %edi
+  800c5f:	56                   	push   %esi
+  800c60:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800c61:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c64:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c67:	b8 12 00 00 00       	mov    $0x12,%eax
+  800c6c:	be 00 00 00 00       	mov    $0x0,%esi
+  800c71:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c74:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c77:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  800c79:	5b                   	pop    %ebx
+  800c7a:	5e                   	pop    %esi
+  800c7b:	5f                   	pop    %edi
+  800c7c:	5d                   	pop    %ebp
+  800c7d:	c3                   	ret
+
+00800c7e <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  800c7e:	55                   	push   %ebp
+  800c7f:	89 e5                	mov    %esp,%ebp
+  800c81:	57                   	push   %edi
+  800c82:	56                   	push   %esi
+  800c83:	53                   	push   %ebx
+  800c84:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800c87:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c8c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c8f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c92:	b8 16 00 00 00       	mov    $0x16,%eax
+  800c97:	89 df                	mov    %ebx,%edi
+  800c99:	89 de                	mov    %ebx,%esi
+  800c9b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c9d:	85 c0                	test   %eax,%eax
+  800c9f:	7f 08                	jg     800ca9 <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  800ca1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ca4:	5b                   	pop    %ebx
+  800ca5:	5e                   	pop    %esi
+  800ca6:	5f                   	pop    %edi
+  800ca7:	5d                   	pop    %ebp
+  800ca8:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ca9:	83 ec 0c             	sub    $0xc,%esp
+  800cac:	50                   	push   %eax
+  800cad:	6a 16                	push   $0x16
+  800caf:	68 83 31 80 00       	push   $0x803183
+  800cb4:	6a 23                	push   $0x23
+  800cb6:	68 a0 31 80 00       	push   $0x8031a0
+  800cbb:	e8 73 1d 00 00       	call   802a33 <_panic>
+
+00800cc0 <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  800cc0:	55                   	push   %ebp
+  800cc1:	89 e5                	mov    %esp,%ebp
+  800cc3:	57                   	push   %edi
+  800cc4:	56                   	push   %esi
+  800cc5:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800cc6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ccb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cce:	b8 17 00 00 00       	mov    $0x17,%eax
+  800cd3:	89 cb                	mov    %ecx,%ebx
+  800cd5:	89 cf                	mov    %ecx,%edi
+  800cd7:	89 ce                	mov    %ecx,%esi
+  800cd9:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  800cdb:	5b                   	pop    %ebx
+  800cdc:	5e                   	pop    %esi
+  800cdd:	5f                   	pop    %edi
+  800cde:	5d                   	pop    %ebp
+  800cdf:	c3                   	ret
+
+00800ce0 <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  800ce0:	55                   	push   %ebp
+  800ce1:	89 e5                	mov    %esp,%ebp
+  800ce3:	57                   	push   %edi
+  800ce4:	56                   	push   %esi
+  800ce5:	53                   	push   %ebx
+  800ce6:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800ce9:	be 00 00 00 00       	mov    $0x0,%esi
+  800cee:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cf1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cf4:	b8 18 00 00 00       	mov    $0x18,%eax
+  800cf9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cfc:	89 f7                	mov    %esi,%edi
+  800cfe:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d00:	85 c0                	test   %eax,%eax
+  800d02:	7f 08                	jg     800d0c <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  800d04:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d07:	5b                   	pop    %ebx
+  800d08:	5e                   	pop    %esi
+  800d09:	5f                   	pop    %edi
+  800d0a:	5d                   	pop    %ebp
+  800d0b:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d0c:	83 ec 0c             	sub    $0xc,%esp
+  800d0f:	50                   	push   %eax
+  800d10:	6a 18                	push   $0x18
+  800d12:	68 83 31 80 00       	push   $0x803183
+  800d17:	6a 23                	push   $0x23
+  800d19:	68 a0 31 80 00       	push   $0x8031a0
+  800d1e:	e8 10 1d 00 00       	call   802a33 <_panic>
+
+00800d23 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  800d23:	55                   	push   %ebp
+  800d24:	89 e5                	mov    %esp,%ebp
+  800d26:	57                   	push   %edi
+  800d27:	56                   	push   %esi
+  800d28:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d29:	be 00 00 00 00       	mov    $0x0,%esi
+  800d2e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d31:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d34:	b8 19 00 00 00       	mov    $0x19,%eax
+  800d39:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d3c:	89 f7                	mov    %esi,%edi
+  800d3e:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  800d40:	5b                   	pop    %ebx
+  800d41:	5e                   	pop    %esi
+  800d42:	5f                   	pop    %edi
+  800d43:	5d                   	pop    %ebp
+  800d44:	c3                   	ret
+
+00800d45 <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  800d45:	55                   	push   %ebp
+  800d46:	89 e5                	mov    %esp,%ebp
+  800d48:	57                   	push   %edi
+  800d49:	56                   	push   %esi
+  800d4a:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d4b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d50:	b8 15 00 00 00       	mov    $0x15,%eax
+  800d55:	89 d1                	mov    %edx,%ecx
+  800d57:	89 d3                	mov    %edx,%ebx
+  800d59:	89 d7                	mov    %edx,%edi
+  800d5b:	89 d6                	mov    %edx,%esi
+  800d5d:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800d5f:	5b                   	pop    %ebx
+  800d60:	5e                   	pop    %esi
+  800d61:	5f                   	pop    %edi
+  800d62:	5d                   	pop    %ebp
+  800d63:	c3                   	ret
+
+00800d64 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800d64:	55                   	push   %ebp
+  800d65:	89 e5                	mov    %esp,%ebp
+  800d67:	57                   	push   %edi
+  800d68:	56                   	push   %esi
+  800d69:	53                   	push   %ebx
+  800d6a:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800d6d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d72:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d75:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d78:	b8 08 00 00 00       	mov    $0x8,%eax
+  800d7d:	89 df                	mov    %ebx,%edi
+  800d7f:	89 de                	mov    %ebx,%esi
+  800d81:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d83:	85 c0                	test   %eax,%eax
+  800d85:	7f 08                	jg     800d8f <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800d87:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d8a:	5b                   	pop    %ebx
+  800d8b:	5e                   	pop    %esi
+  800d8c:	5f                   	pop    %edi
+  800d8d:	5d                   	pop    %ebp
+  800d8e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d8f:	83 ec 0c             	sub    $0xc,%esp
+  800d92:	50                   	push   %eax
+  800d93:	6a 08                	push   $0x8
+  800d95:	68 83 31 80 00       	push   $0x803183
+  800d9a:	6a 23                	push   $0x23
+  800d9c:	68 a0 31 80 00       	push   $0x8031a0
+  800da1:	e8 8d 1c 00 00       	call   802a33 <_panic>
+
+00800da6 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800da6:	55                   	push   %ebp
+  800da7:	89 e5                	mov    %esp,%ebp
+  800da9:	57                   	push   %edi
+  800daa:	56                   	push   %esi
+  800dab:	53                   	push   %ebx
+  800dac:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800daf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800db4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800db7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dba:	b8 09 00 00 00       	mov    $0x9,%eax
+  800dbf:	89 df                	mov    %ebx,%edi
+  800dc1:	89 de                	mov    %ebx,%esi
+  800dc3:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800dc5:	85 c0                	test   %eax,%eax
+  800dc7:	7f 08                	jg     800dd1 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  800dc9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dcc:	5b                   	pop    %ebx
+  800dcd:	5e                   	pop    %esi
+  800dce:	5f                   	pop    %edi
+  800dcf:	5d                   	pop    %ebp
+  800dd0:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800dd1:	83 ec 0c             	sub    $0xc,%esp
+  800dd4:	50                   	push   %eax
+  800dd5:	6a 09                	push   $0x9
+  800dd7:	68 83 31 80 00       	push   $0x803183
+  800ddc:	6a 23                	push   $0x23
+  800dde:	68 a0 31 80 00       	push   $0x8031a0
+  800de3:	e8 4b 1c 00 00       	call   802a33 <_panic>
+
+00800de8 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800de8:	55                   	push   %ebp
+  800de9:	89 e5                	mov    %esp,%ebp
+  800deb:	57                   	push   %edi
+  800dec:	56                   	push   %esi
+  800ded:	53                   	push   %ebx
+  800dee:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800df1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800df6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dfc:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e01:	89 df                	mov    %ebx,%edi
+  800e03:	89 de                	mov    %ebx,%esi
+  800e05:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e07:	85 c0                	test   %eax,%eax
+  800e09:	7f 08                	jg     800e13 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  800e0b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e0e:	5b                   	pop    %ebx
+  800e0f:	5e                   	pop    %esi
+  800e10:	5f                   	pop    %edi
+  800e11:	5d                   	pop    %ebp
+  800e12:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e13:	83 ec 0c             	sub    $0xc,%esp
+  800e16:	50                   	push   %eax
+  800e17:	6a 0a                	push   $0xa
+  800e19:	68 83 31 80 00       	push   $0x803183
+  800e1e:	6a 23                	push   $0x23
+  800e20:	68 a0 31 80 00       	push   $0x8031a0
+  800e25:	e8 09 1c 00 00       	call   802a33 <_panic>
+
+00800e2a <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  800e2a:	55                   	push   %ebp
+  800e2b:	89 e5                	mov    %esp,%ebp
+  800e2d:	57                   	push   %edi
+  800e2e:	56                   	push   %esi
+  800e2f:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e30:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e33:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e36:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800e3b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e3e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e41:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e44:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  800e46:	5b                   	pop    %ebx
+  800e47:	5e                   	pop    %esi
+  800e48:	5f                   	pop    %edi
+  800e49:	5d                   	pop    %ebp
+  800e4a:	c3                   	ret
+
+00800e4b <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  800e4b:	55                   	push   %ebp
+  800e4c:	89 e5                	mov    %esp,%ebp
+  800e4e:	57                   	push   %edi
+  800e4f:	56                   	push   %esi
+  800e50:	53                   	push   %ebx
+  800e51:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e54:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e59:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e5c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e5f:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e64:	89 df                	mov    %ebx,%edi
+  800e66:	89 de                	mov    %ebx,%esi
+  800e68:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e6a:	85 c0                	test   %eax,%eax
+  800e6c:	7f 08                	jg     800e76 <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  800e6e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e71:	5b                   	pop    %ebx
+  800e72:	5e                   	pop    %esi
+  800e73:	5f                   	pop    %edi
+  800e74:	5d                   	pop    %ebp
+  800e75:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e76:	83 ec 0c             	sub    $0xc,%esp
+  800e79:	50                   	push   %eax
+  800e7a:	6a 0d                	push   $0xd
+  800e7c:	68 83 31 80 00       	push   $0x803183
+  800e81:	6a 23                	push   $0x23
+  800e83:	68 a0 31 80 00       	push   $0x8031a0
+  800e88:	e8 a6 1b 00 00       	call   802a33 <_panic>
+
+00800e8d <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  800e8d:	55                   	push   %ebp
+  800e8e:	89 e5                	mov    %esp,%ebp
+  800e90:	57                   	push   %edi
+  800e91:	56                   	push   %esi
+  800e92:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e93:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e98:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800e9d:	89 d1                	mov    %edx,%ecx
+  800e9f:	89 d3                	mov    %edx,%ebx
+  800ea1:	89 d7                	mov    %edx,%edi
+  800ea3:	89 d6                	mov    %edx,%esi
+  800ea5:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800ea7:	5b                   	pop    %ebx
+  800ea8:	5e                   	pop    %esi
+  800ea9:	5f                   	pop    %edi
+  800eaa:	5d                   	pop    %ebp
+  800eab:	c3                   	ret
+
+00800eac <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  800eac:	55                   	push   %ebp
+  800ead:	89 e5                	mov    %esp,%ebp
+  800eaf:	57                   	push   %edi
+  800eb0:	56                   	push   %esi
+  800eb1:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800eb2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eb8:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800ebd:	be 00 00 00 00       	mov    $0x0,%esi
+  800ec2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ec5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ec8:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  800eca:	5b                   	pop    %ebx
+  800ecb:	5e                   	pop    %esi
+  800ecc:	5f                   	pop    %edi
+  800ecd:	5d                   	pop    %ebp
+  800ece:	c3                   	ret
+
+00800ecf <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  800ecf:	55                   	push   %ebp
+  800ed0:	89 e5                	mov    %esp,%ebp
+  800ed2:	57                   	push   %edi
+  800ed3:	56                   	push   %esi
+  800ed4:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800ed5:	be 00 00 00 00       	mov    $0x0,%esi
+  800eda:	8b 55 08             	mov    0x8(%ebp),%edx
+  800edd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ee0:	b8 10 00 00 00       	mov    $0x10,%eax
+  800ee5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ee8:	89 f7                	mov    %esi,%edi
+  800eea:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  800eec:	5b                   	pop    %ebx
+  800eed:	5e                   	pop    %esi
+  800eee:	5f                   	pop    %edi
+  800eef:	5d                   	pop    %ebp
+  800ef0:	c3                   	ret
+
+00800ef1 <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  800ef1:	55                   	push   %ebp
+  800ef2:	89 e5                	mov    %esp,%ebp
+  800ef4:	57                   	push   %edi
+  800ef5:	56                   	push   %esi
+  800ef6:	53                   	push   %ebx
+  800ef7:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  800efa:	80 3d 4c 57 80 00 00 	cmpb   $0x0,0x80574c
+  800f01:	74 41                	je     800f44 <sys_batch+0x53>
+  800f03:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f06:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  800f09:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  800f10:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800f13:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  800f16:	7d 45                	jge    800f5d <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  800f18:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800f1b:	8b 06                	mov    (%esi),%eax
+  800f1d:	8b 56 04             	mov    0x4(%esi),%edx
+  800f20:	8b 4e 08             	mov    0x8(%esi),%ecx
+  800f23:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  800f26:	8b 7e 10             	mov    0x10(%esi),%edi
+  800f29:	8b 76 14             	mov    0x14(%esi),%esi
+  800f2c:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  800f2e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800f31:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  800f34:	83 c6 1c             	add    $0x1c,%esi
+  800f37:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  800f3a:	85 c0                	test   %eax,%eax
+  800f3c:	78 1f                	js     800f5d <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  800f3e:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  800f42:	eb cc                	jmp    800f10 <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  800f44:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f49:	b8 13 00 00 00       	mov    $0x13,%eax
+  800f4e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f51:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f54:	89 df                	mov    %ebx,%edi
+  800f56:	89 de                	mov    %ebx,%esi
+  800f58:	cd 30                	int    $0x30
+  800f5a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  800f5d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800f60:	83 c4 08             	add    $0x8,%esp
+  800f63:	5b                   	pop    %ebx
+  800f64:	5e                   	pop    %esi
+  800f65:	5f                   	pop    %edi
+  800f66:	5d                   	pop    %ebp
+  800f67:	c3                   	ret
+
+00800f68 <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  800f68:	55                   	push   %ebp
+  800f69:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  800f6b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f6e:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  800f74:	5d                   	pop    %ebp
+  800f75:	c3                   	ret
+
+00800f76 <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  800f76:	55                   	push   %ebp
+  800f77:	89 e5                	mov    %esp,%ebp
+  800f79:	56                   	push   %esi
+  800f7a:	53                   	push   %ebx
+  800f7b:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  800f7e:	8b 1e                	mov    (%esi),%ebx
+  800f80:	85 db                	test   %ebx,%ebx
+  800f82:	75 09                	jne    800f8d <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  800f84:	89 d8                	mov    %ebx,%eax
+  800f86:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f89:	5b                   	pop    %ebx
+  800f8a:	5e                   	pop    %esi
+  800f8b:	5d                   	pop    %ebp
+  800f8c:	c3                   	ret
+  b->sb_n = 0;
+  800f8d:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  800f93:	53                   	push   %ebx
+  800f94:	8d 46 04             	lea    0x4(%esi),%eax
+  800f97:	50                   	push   %eax
+  800f98:	e8 54 ff ff ff       	call   800ef1 <sys_batch>
+  800f9d:	83 c4 08             	add    $0x8,%esp
+  800fa0:	85 c0                	test   %eax,%eax
+  800fa2:	78 1e                	js     800fc2 <sysbatch_flush+0x4c>
+  if (r < n)
+  800fa4:	39 c3                	cmp    %eax,%ebx
+  800fa6:	7f 07                	jg     800faf <sysbatch_flush+0x39>
+  return 0;
+  800fa8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fad:	eb d5                	jmp    800f84 <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  800faf:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  800fb2:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  800fb6:	85 db                	test   %ebx,%ebx
+  800fb8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800fbd:	0f 49 d8             	cmovns %eax,%ebx
+  800fc0:	eb c2                	jmp    800f84 <sysbatch_flush+0xe>
+    return r;
+  800fc2:	89 c3                	mov    %eax,%ebx
+  800fc4:	eb be                	jmp    800f84 <sysbatch_flush+0xe>
+
+00800fc6 <sysbatch_add>:
+{
+  800fc6:	55                   	push   %ebp
+  800fc7:	89 e5                	mov    %esp,%ebp
+  800fc9:	53                   	push   %ebx
+  800fca:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  800fcd:	83 3b 40             	cmpl   $0x40,(%ebx)
+  800fd0:	74 41                	je     801013 <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  800fd2:	8b 03                	mov    (%ebx),%eax
+  800fd4:	8d 50 01             	lea    0x1(%eax),%edx
+  800fd7:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  800fd9:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  800fdc:	01 d8                	add    %ebx,%eax
+  800fde:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800fe1:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  800fe4:	8b 55 10             	mov    0x10(%ebp),%edx
+  800fe7:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  800fea:	8b 55 14             	mov    0x14(%ebp),%edx
+  800fed:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  800ff0:	8b 55 18             	mov    0x18(%ebp),%edx
+  800ff3:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  800ff6:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  800ff9:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  800ffc:	8b 55 20             	mov    0x20(%ebp),%edx
+  800fff:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  801002:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  801009:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80100e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801011:	c9                   	leave
+  801012:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  801013:	53                   	push   %ebx
+  801014:	e8 5d ff ff ff       	call   800f76 <sysbatch_flush>
+  801019:	83 c4 04             	add    $0x4,%esp
+  80101c:	85 c0                	test   %eax,%eax
+  80101e:	79 b2                	jns    800fd2 <sysbatch_add+0xc>
+  801020:	eb ec                	jmp    80100e <sysbatch_add+0x48>
+
+00801022 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801022:	55                   	push   %ebp
+  801023:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801025:	8b 45 08             	mov    0x8(%ebp),%eax
+  801028:	05 00 00 00 30       	add    $0x30000000,%eax
+  80102d:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801030:	5d                   	pop    %ebp
+  801031:	c3                   	ret
+
+00801032 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801032:	55                   	push   %ebp
+  801033:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801035:	8b 45 08             	mov    0x8(%ebp),%eax
+  801038:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  80103b:	66 b8 00 00          	mov    $0x0,%ax
+  80103f:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801044:	5d                   	pop    %ebp
+  801045:	c3                   	ret
+
+00801046 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801046:	55                   	push   %ebp
+  801047:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  801049:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80104e:	eb 02                	jmp    801052 <fd_alloc+0xc>
+  801050:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801052:	89 c2                	mov    %eax,%edx
+  801054:	c1 ea 16             	shr    $0x16,%edx
+  801057:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80105e:	f6 c2 01             	test   $0x1,%dl
+  801061:	74 2b                	je     80108e <fd_alloc+0x48>
+  801063:	89 c2                	mov    %eax,%edx
+  801065:	c1 ea 0c             	shr    $0xc,%edx
+  801068:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80106f:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801075:	f6 c1 01             	test   $0x1,%cl
+  801078:	74 14                	je     80108e <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  80107a:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801080:	75 ce                	jne    801050 <fd_alloc+0xa>
+  801082:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  801087:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80108c:	eb 05                	jmp    801093 <fd_alloc+0x4d>
+      return 0;
+  80108e:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  801093:	8b 55 08             	mov    0x8(%ebp),%edx
+  801096:	89 02                	mov    %eax,(%edx)
+}
+  801098:	89 c8                	mov    %ecx,%eax
+  80109a:	5d                   	pop    %ebp
+  80109b:	c3                   	ret
+
+0080109c <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80109c:	55                   	push   %ebp
+  80109d:	89 e5                	mov    %esp,%ebp
+  80109f:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  8010a2:	83 f8 1f             	cmp    $0x1f,%eax
+  8010a5:	77 30                	ja     8010d7 <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  8010a7:	c1 e0 0c             	shl    $0xc,%eax
+  8010aa:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8010af:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8010b5:	f6 c2 01             	test   $0x1,%dl
+  8010b8:	74 24                	je     8010de <fd_lookup+0x42>
+  8010ba:	89 c2                	mov    %eax,%edx
+  8010bc:	c1 ea 0c             	shr    $0xc,%edx
+  8010bf:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8010c6:	f6 c2 01             	test   $0x1,%dl
+  8010c9:	74 1a                	je     8010e5 <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  8010cb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8010ce:	89 02                	mov    %eax,(%edx)
+  return 0;
+  8010d0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8010d5:	5d                   	pop    %ebp
+  8010d6:	c3                   	ret
+    return -E_INVAL;
+  8010d7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8010dc:	eb f7                	jmp    8010d5 <fd_lookup+0x39>
+    return -E_INVAL;
+  8010de:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8010e3:	eb f0                	jmp    8010d5 <fd_lookup+0x39>
+  8010e5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8010ea:	eb e9                	jmp    8010d5 <fd_lookup+0x39>
+
+008010ec <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8010ec:	55                   	push   %ebp
+  8010ed:	89 e5                	mov    %esp,%ebp
+  8010ef:	53                   	push   %ebx
+  8010f0:	83 ec 04             	sub    $0x4,%esp
+  8010f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  8010f6:	b8 2c 32 80 00       	mov    $0x80322c,%eax
+  8010fb:	8b 18                	mov    (%eax),%ebx
+  8010fd:	85 db                	test   %ebx,%ebx
+  8010ff:	74 0e                	je     80110f <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  801101:	83 c0 04             	add    $0x4,%eax
+  801104:	39 13                	cmp    %edx,(%ebx)
+  801106:	75 f3                	jne    8010fb <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  801108:	b8 00 00 00 00       	mov    $0x0,%eax
+  80110d:	eb 1f                	jmp    80112e <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80110f:	a1 48 57 80 00       	mov    0x805748,%eax
+  801114:	8b 40 48             	mov    0x48(%eax),%eax
+  801117:	83 ec 04             	sub    $0x4,%esp
+  80111a:	52                   	push   %edx
+  80111b:	50                   	push   %eax
+  80111c:	68 b0 31 80 00       	push   $0x8031b0
+  801121:	e8 30 f0 ff ff       	call   800156 <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  801126:	83 c4 10             	add    $0x10,%esp
+  801129:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  80112e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801131:	89 1a                	mov    %ebx,(%edx)
+}
+  801133:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801136:	c9                   	leave
+  801137:	c3                   	ret
+
+00801138 <fd_close>:
+{
+  801138:	55                   	push   %ebp
+  801139:	89 e5                	mov    %esp,%ebp
+  80113b:	57                   	push   %edi
+  80113c:	56                   	push   %esi
+  80113d:	53                   	push   %ebx
+  80113e:	83 ec 24             	sub    $0x24,%esp
+  801141:	8b 75 08             	mov    0x8(%ebp),%esi
+  801144:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801147:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80114a:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80114b:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801151:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801154:	50                   	push   %eax
+  801155:	e8 42 ff ff ff       	call   80109c <fd_lookup>
+  80115a:	89 c3                	mov    %eax,%ebx
+  80115c:	83 c4 10             	add    $0x10,%esp
+  80115f:	85 c0                	test   %eax,%eax
+  801161:	78 05                	js     801168 <fd_close+0x30>
+      || fd != fd2)
+  801163:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801166:	74 16                	je     80117e <fd_close+0x46>
+    return must_exist ? r : 0;
+  801168:	89 f8                	mov    %edi,%eax
+  80116a:	84 c0                	test   %al,%al
+  80116c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801171:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801174:	89 d8                	mov    %ebx,%eax
+  801176:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801179:	5b                   	pop    %ebx
+  80117a:	5e                   	pop    %esi
+  80117b:	5f                   	pop    %edi
+  80117c:	5d                   	pop    %ebp
+  80117d:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80117e:	83 ec 08             	sub    $0x8,%esp
+  801181:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801184:	50                   	push   %eax
+  801185:	ff 36                	push   (%esi)
+  801187:	e8 60 ff ff ff       	call   8010ec <dev_lookup>
+  80118c:	89 c3                	mov    %eax,%ebx
+  80118e:	83 c4 10             	add    $0x10,%esp
+  801191:	85 c0                	test   %eax,%eax
+  801193:	78 1a                	js     8011af <fd_close+0x77>
+    if (dev->dev_close)
+  801195:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801198:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  80119b:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  8011a0:	85 c0                	test   %eax,%eax
+  8011a2:	74 0b                	je     8011af <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  8011a4:	83 ec 0c             	sub    $0xc,%esp
+  8011a7:	56                   	push   %esi
+  8011a8:	ff d0                	call   *%eax
+  8011aa:	89 c3                	mov    %eax,%ebx
+  8011ac:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  8011af:	83 ec 08             	sub    $0x8,%esp
+  8011b2:	56                   	push   %esi
+  8011b3:	6a 00                	push   $0x0
+  8011b5:	e8 3e fa ff ff       	call   800bf8 <sys_page_unmap>
+  return r;
+  8011ba:	83 c4 10             	add    $0x10,%esp
+  8011bd:	eb b5                	jmp    801174 <fd_close+0x3c>
+
+008011bf <close>:
+
+int
+close(int fdnum)
+{
+  8011bf:	55                   	push   %ebp
+  8011c0:	89 e5                	mov    %esp,%ebp
+  8011c2:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8011c5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8011c8:	50                   	push   %eax
+  8011c9:	ff 75 08             	push   0x8(%ebp)
+  8011cc:	e8 cb fe ff ff       	call   80109c <fd_lookup>
+  8011d1:	83 c4 10             	add    $0x10,%esp
+  8011d4:	85 c0                	test   %eax,%eax
+  8011d6:	79 02                	jns    8011da <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  8011d8:	c9                   	leave
+  8011d9:	c3                   	ret
+    return fd_close(fd, 1);
+  8011da:	83 ec 08             	sub    $0x8,%esp
+  8011dd:	6a 01                	push   $0x1
+  8011df:	ff 75 f4             	push   -0xc(%ebp)
+  8011e2:	e8 51 ff ff ff       	call   801138 <fd_close>
+  8011e7:	83 c4 10             	add    $0x10,%esp
+  8011ea:	eb ec                	jmp    8011d8 <close+0x19>
+
+008011ec <close_all>:
+
+void
+close_all(void)
+{
+  8011ec:	55                   	push   %ebp
+  8011ed:	89 e5                	mov    %esp,%ebp
+  8011ef:	53                   	push   %ebx
+  8011f0:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  8011f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  8011f8:	83 ec 0c             	sub    $0xc,%esp
+  8011fb:	53                   	push   %ebx
+  8011fc:	e8 be ff ff ff       	call   8011bf <close>
+  for (i = 0; i < MAXFD; i++)
+  801201:	83 c3 01             	add    $0x1,%ebx
+  801204:	83 c4 10             	add    $0x10,%esp
+  801207:	83 fb 20             	cmp    $0x20,%ebx
+  80120a:	75 ec                	jne    8011f8 <close_all+0xc>
+}
+  80120c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80120f:	c9                   	leave
+  801210:	c3                   	ret
+
+00801211 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801211:	55                   	push   %ebp
+  801212:	89 e5                	mov    %esp,%ebp
+  801214:	57                   	push   %edi
+  801215:	56                   	push   %esi
+  801216:	53                   	push   %ebx
+  801217:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80121a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80121d:	50                   	push   %eax
+  80121e:	ff 75 08             	push   0x8(%ebp)
+  801221:	e8 76 fe ff ff       	call   80109c <fd_lookup>
+  801226:	89 c6                	mov    %eax,%esi
+  801228:	83 c4 10             	add    $0x10,%esp
+  80122b:	85 c0                	test   %eax,%eax
+  80122d:	0f 88 0a 01 00 00    	js     80133d <dup+0x12c>
+    return r;
+  close(newfdnum);
+  801233:	83 ec 0c             	sub    $0xc,%esp
+  801236:	ff 75 0c             	push   0xc(%ebp)
+  801239:	e8 81 ff ff ff       	call   8011bf <close>
+
+  newfd = INDEX2FD(newfdnum);
+  80123e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801241:	c1 e0 0c             	shl    $0xc,%eax
+  801244:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  80124a:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  80124d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801250:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  801253:	89 04 24             	mov    %eax,(%esp)
+  801256:	e8 d7 fd ff ff       	call   801032 <fd2data>
+  80125b:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  80125d:	89 3c 24             	mov    %edi,(%esp)
+  801260:	e8 cd fd ff ff       	call   801032 <fd2data>
+  801265:	83 c4 10             	add    $0x10,%esp
+  801268:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80126b:	89 f3                	mov    %esi,%ebx
+  80126d:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  801273:	89 c6                	mov    %eax,%esi
+  801275:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801278:	89 cf                	mov    %ecx,%edi
+  80127a:	eb 0c                	jmp    801288 <dup+0x77>
+  80127c:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801282:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801288:	39 fb                	cmp    %edi,%ebx
+  80128a:	74 7b                	je     801307 <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  80128c:	89 d8                	mov    %ebx,%eax
+  80128e:	c1 e8 16             	shr    $0x16,%eax
+  801291:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801298:	a8 01                	test   $0x1,%al
+  80129a:	74 e0                	je     80127c <dup+0x6b>
+  80129c:	89 d8                	mov    %ebx,%eax
+  80129e:	c1 e8 0c             	shr    $0xc,%eax
+  8012a1:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8012a8:	f6 c2 01             	test   $0x1,%dl
+  8012ab:	74 cf                	je     80127c <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  8012ad:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  8012b4:	83 ec 0c             	sub    $0xc,%esp
+  8012b7:	25 07 0e 00 00       	and    $0xe07,%eax
+  8012bc:	50                   	push   %eax
+  8012bd:	56                   	push   %esi
+  8012be:	6a 00                	push   $0x0
+  8012c0:	53                   	push   %ebx
+  8012c1:	6a 00                	push   $0x0
+  8012c3:	e8 ee f8 ff ff       	call   800bb6 <sys_page_map>
+  8012c8:	83 c4 20             	add    $0x20,%esp
+  8012cb:	85 c0                	test   %eax,%eax
+  8012cd:	79 ad                	jns    80127c <dup+0x6b>
+  8012cf:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8012d2:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  8012d4:	83 ec 08             	sub    $0x8,%esp
+  8012d7:	ff 75 d4             	push   -0x2c(%ebp)
+  8012da:	6a 00                	push   $0x0
+  8012dc:	e8 17 f9 ff ff       	call   800bf8 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8012e1:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  8012e4:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  8012ea:	83 c4 10             	add    $0x10,%esp
+  8012ed:	39 df                	cmp    %ebx,%edi
+  8012ef:	74 4c                	je     80133d <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  8012f1:	83 ec 08             	sub    $0x8,%esp
+  8012f4:	57                   	push   %edi
+  8012f5:	6a 00                	push   $0x0
+  8012f7:	e8 fc f8 ff ff       	call   800bf8 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8012fc:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  801302:	83 c4 10             	add    $0x10,%esp
+  801305:	eb e6                	jmp    8012ed <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801307:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80130a:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80130d:	89 c8                	mov    %ecx,%eax
+  80130f:	c1 e8 0c             	shr    $0xc,%eax
+  801312:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801319:	83 ec 0c             	sub    $0xc,%esp
+  80131c:	25 07 0e 00 00       	and    $0xe07,%eax
+  801321:	50                   	push   %eax
+  801322:	ff 75 d4             	push   -0x2c(%ebp)
+  801325:	6a 00                	push   $0x0
+  801327:	51                   	push   %ecx
+  801328:	6a 00                	push   $0x0
+  80132a:	e8 87 f8 ff ff       	call   800bb6 <sys_page_map>
+  80132f:	89 c6                	mov    %eax,%esi
+  801331:	83 c4 20             	add    $0x20,%esp
+  801334:	85 c0                	test   %eax,%eax
+  801336:	78 9c                	js     8012d4 <dup+0xc3>
+  return newfdnum;
+  801338:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80133b:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  80133d:	89 f0                	mov    %esi,%eax
+  80133f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801342:	5b                   	pop    %ebx
+  801343:	5e                   	pop    %esi
+  801344:	5f                   	pop    %edi
+  801345:	5d                   	pop    %ebp
+  801346:	c3                   	ret
+
+00801347 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801347:	55                   	push   %ebp
+  801348:	89 e5                	mov    %esp,%ebp
+  80134a:	56                   	push   %esi
+  80134b:	53                   	push   %ebx
+  80134c:	83 ec 18             	sub    $0x18,%esp
+  80134f:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801352:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801355:	50                   	push   %eax
+  801356:	56                   	push   %esi
+  801357:	e8 40 fd ff ff       	call   80109c <fd_lookup>
+  80135c:	83 c4 10             	add    $0x10,%esp
+  80135f:	85 c0                	test   %eax,%eax
+  801361:	78 3c                	js     80139f <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801363:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801366:	83 ec 08             	sub    $0x8,%esp
+  801369:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80136c:	50                   	push   %eax
+  80136d:	ff 33                	push   (%ebx)
+  80136f:	e8 78 fd ff ff       	call   8010ec <dev_lookup>
+  801374:	83 c4 10             	add    $0x10,%esp
+  801377:	85 c0                	test   %eax,%eax
+  801379:	78 24                	js     80139f <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80137b:	8b 43 08             	mov    0x8(%ebx),%eax
+  80137e:	83 e0 03             	and    $0x3,%eax
+  801381:	83 f8 01             	cmp    $0x1,%eax
+  801384:	74 20                	je     8013a6 <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  801386:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801389:	8b 40 08             	mov    0x8(%eax),%eax
+  80138c:	85 c0                	test   %eax,%eax
+  80138e:	74 37                	je     8013c7 <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  801390:	83 ec 04             	sub    $0x4,%esp
+  801393:	ff 75 10             	push   0x10(%ebp)
+  801396:	ff 75 0c             	push   0xc(%ebp)
+  801399:	53                   	push   %ebx
+  80139a:	ff d0                	call   *%eax
+  80139c:	83 c4 10             	add    $0x10,%esp
+}
+  80139f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013a2:	5b                   	pop    %ebx
+  8013a3:	5e                   	pop    %esi
+  8013a4:	5d                   	pop    %ebp
+  8013a5:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8013a6:	a1 48 57 80 00       	mov    0x805748,%eax
+  8013ab:	8b 40 48             	mov    0x48(%eax),%eax
+  8013ae:	83 ec 04             	sub    $0x4,%esp
+  8013b1:	56                   	push   %esi
+  8013b2:	50                   	push   %eax
+  8013b3:	68 f1 31 80 00       	push   $0x8031f1
+  8013b8:	e8 99 ed ff ff       	call   800156 <cprintf>
+    return -E_INVAL;
+  8013bd:	83 c4 10             	add    $0x10,%esp
+  8013c0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013c5:	eb d8                	jmp    80139f <read+0x58>
+    return -E_NOT_SUPP;
+  8013c7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8013cc:	eb d1                	jmp    80139f <read+0x58>
+
+008013ce <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8013ce:	55                   	push   %ebp
+  8013cf:	89 e5                	mov    %esp,%ebp
+  8013d1:	57                   	push   %edi
+  8013d2:	56                   	push   %esi
+  8013d3:	53                   	push   %ebx
+  8013d4:	83 ec 0c             	sub    $0xc,%esp
+  8013d7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8013da:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  8013dd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013e2:	eb 02                	jmp    8013e6 <readn+0x18>
+  8013e4:	01 c3                	add    %eax,%ebx
+  8013e6:	39 f3                	cmp    %esi,%ebx
+  8013e8:	73 21                	jae    80140b <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  8013ea:	83 ec 04             	sub    $0x4,%esp
+  8013ed:	89 f0                	mov    %esi,%eax
+  8013ef:	29 d8                	sub    %ebx,%eax
+  8013f1:	50                   	push   %eax
+  8013f2:	89 d8                	mov    %ebx,%eax
+  8013f4:	03 45 0c             	add    0xc(%ebp),%eax
+  8013f7:	50                   	push   %eax
+  8013f8:	57                   	push   %edi
+  8013f9:	e8 49 ff ff ff       	call   801347 <read>
+    if (m < 0)
+  8013fe:	83 c4 10             	add    $0x10,%esp
+  801401:	85 c0                	test   %eax,%eax
+  801403:	78 04                	js     801409 <readn+0x3b>
+      return m;
+    if (m == 0)
+  801405:	75 dd                	jne    8013e4 <readn+0x16>
+  801407:	eb 02                	jmp    80140b <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  801409:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  80140b:	89 d8                	mov    %ebx,%eax
+  80140d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801410:	5b                   	pop    %ebx
+  801411:	5e                   	pop    %esi
+  801412:	5f                   	pop    %edi
+  801413:	5d                   	pop    %ebp
+  801414:	c3                   	ret
+
+00801415 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801415:	55                   	push   %ebp
+  801416:	89 e5                	mov    %esp,%ebp
+  801418:	56                   	push   %esi
+  801419:	53                   	push   %ebx
+  80141a:	83 ec 18             	sub    $0x18,%esp
+  80141d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801420:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801423:	50                   	push   %eax
+  801424:	53                   	push   %ebx
+  801425:	e8 72 fc ff ff       	call   80109c <fd_lookup>
+  80142a:	83 c4 10             	add    $0x10,%esp
+  80142d:	85 c0                	test   %eax,%eax
+  80142f:	78 37                	js     801468 <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801431:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801434:	83 ec 08             	sub    $0x8,%esp
+  801437:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80143a:	50                   	push   %eax
+  80143b:	ff 36                	push   (%esi)
+  80143d:	e8 aa fc ff ff       	call   8010ec <dev_lookup>
+  801442:	83 c4 10             	add    $0x10,%esp
+  801445:	85 c0                	test   %eax,%eax
+  801447:	78 1f                	js     801468 <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801449:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80144d:	74 20                	je     80146f <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  80144f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801452:	8b 40 0c             	mov    0xc(%eax),%eax
+  801455:	85 c0                	test   %eax,%eax
+  801457:	74 37                	je     801490 <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  801459:	83 ec 04             	sub    $0x4,%esp
+  80145c:	ff 75 10             	push   0x10(%ebp)
+  80145f:	ff 75 0c             	push   0xc(%ebp)
+  801462:	56                   	push   %esi
+  801463:	ff d0                	call   *%eax
+  801465:	83 c4 10             	add    $0x10,%esp
+}
+  801468:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80146b:	5b                   	pop    %ebx
+  80146c:	5e                   	pop    %esi
+  80146d:	5d                   	pop    %ebp
+  80146e:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80146f:	a1 48 57 80 00       	mov    0x805748,%eax
+  801474:	8b 40 48             	mov    0x48(%eax),%eax
+  801477:	83 ec 04             	sub    $0x4,%esp
+  80147a:	53                   	push   %ebx
+  80147b:	50                   	push   %eax
+  80147c:	68 0d 32 80 00       	push   $0x80320d
+  801481:	e8 d0 ec ff ff       	call   800156 <cprintf>
+    return -E_INVAL;
+  801486:	83 c4 10             	add    $0x10,%esp
+  801489:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80148e:	eb d8                	jmp    801468 <write+0x53>
+    return -E_NOT_SUPP;
+  801490:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801495:	eb d1                	jmp    801468 <write+0x53>
+
+00801497 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801497:	55                   	push   %ebp
+  801498:	89 e5                	mov    %esp,%ebp
+  80149a:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80149d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014a0:	50                   	push   %eax
+  8014a1:	ff 75 08             	push   0x8(%ebp)
+  8014a4:	e8 f3 fb ff ff       	call   80109c <fd_lookup>
+  8014a9:	83 c4 10             	add    $0x10,%esp
+  8014ac:	85 c0                	test   %eax,%eax
+  8014ae:	78 0e                	js     8014be <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  8014b0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8014b3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014b6:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  8014b9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8014be:	c9                   	leave
+  8014bf:	c3                   	ret
+
+008014c0 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8014c0:	55                   	push   %ebp
+  8014c1:	89 e5                	mov    %esp,%ebp
+  8014c3:	56                   	push   %esi
+  8014c4:	53                   	push   %ebx
+  8014c5:	83 ec 18             	sub    $0x18,%esp
+  8014c8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  8014cb:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8014ce:	50                   	push   %eax
+  8014cf:	53                   	push   %ebx
+  8014d0:	e8 c7 fb ff ff       	call   80109c <fd_lookup>
+  8014d5:	83 c4 10             	add    $0x10,%esp
+  8014d8:	85 c0                	test   %eax,%eax
+  8014da:	78 34                	js     801510 <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8014dc:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8014df:	83 ec 08             	sub    $0x8,%esp
+  8014e2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014e5:	50                   	push   %eax
+  8014e6:	ff 36                	push   (%esi)
+  8014e8:	e8 ff fb ff ff       	call   8010ec <dev_lookup>
+  8014ed:	83 c4 10             	add    $0x10,%esp
+  8014f0:	85 c0                	test   %eax,%eax
+  8014f2:	78 1c                	js     801510 <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8014f4:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8014f8:	74 1d                	je     801517 <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  8014fa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014fd:	8b 40 18             	mov    0x18(%eax),%eax
+  801500:	85 c0                	test   %eax,%eax
+  801502:	74 34                	je     801538 <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  801504:	83 ec 08             	sub    $0x8,%esp
+  801507:	ff 75 0c             	push   0xc(%ebp)
+  80150a:	56                   	push   %esi
+  80150b:	ff d0                	call   *%eax
+  80150d:	83 c4 10             	add    $0x10,%esp
+}
+  801510:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801513:	5b                   	pop    %ebx
+  801514:	5e                   	pop    %esi
+  801515:	5d                   	pop    %ebp
+  801516:	c3                   	ret
+            thisenv->env_id, fdnum);
+  801517:	a1 48 57 80 00       	mov    0x805748,%eax
+  80151c:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80151f:	83 ec 04             	sub    $0x4,%esp
+  801522:	53                   	push   %ebx
+  801523:	50                   	push   %eax
+  801524:	68 d0 31 80 00       	push   $0x8031d0
+  801529:	e8 28 ec ff ff       	call   800156 <cprintf>
+    return -E_INVAL;
+  80152e:	83 c4 10             	add    $0x10,%esp
+  801531:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801536:	eb d8                	jmp    801510 <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  801538:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80153d:	eb d1                	jmp    801510 <ftruncate+0x50>
+
+0080153f <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80153f:	55                   	push   %ebp
+  801540:	89 e5                	mov    %esp,%ebp
+  801542:	56                   	push   %esi
+  801543:	53                   	push   %ebx
+  801544:	83 ec 18             	sub    $0x18,%esp
+  801547:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  80154a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80154d:	50                   	push   %eax
+  80154e:	ff 75 08             	push   0x8(%ebp)
+  801551:	e8 46 fb ff ff       	call   80109c <fd_lookup>
+  801556:	83 c4 10             	add    $0x10,%esp
+  801559:	85 c0                	test   %eax,%eax
+  80155b:	78 49                	js     8015a6 <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80155d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801560:	83 ec 08             	sub    $0x8,%esp
+  801563:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801566:	50                   	push   %eax
+  801567:	ff 36                	push   (%esi)
+  801569:	e8 7e fb ff ff       	call   8010ec <dev_lookup>
+  80156e:	83 c4 10             	add    $0x10,%esp
+  801571:	85 c0                	test   %eax,%eax
+  801573:	78 31                	js     8015a6 <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  801575:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801578:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80157c:	74 2f                	je     8015ad <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  80157e:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  801581:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801588:	00 00 00 
+  stat->st_isdir = 0;
+  80158b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801592:	00 00 00 
+  stat->st_dev = dev;
+  801595:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  80159b:	83 ec 08             	sub    $0x8,%esp
+  80159e:	53                   	push   %ebx
+  80159f:	56                   	push   %esi
+  8015a0:	ff 50 14             	call   *0x14(%eax)
+  8015a3:	83 c4 10             	add    $0x10,%esp
+}
+  8015a6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015a9:	5b                   	pop    %ebx
+  8015aa:	5e                   	pop    %esi
+  8015ab:	5d                   	pop    %ebp
+  8015ac:	c3                   	ret
+    return -E_NOT_SUPP;
+  8015ad:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015b2:	eb f2                	jmp    8015a6 <fstat+0x67>
+
+008015b4 <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  8015b4:	55                   	push   %ebp
+  8015b5:	89 e5                	mov    %esp,%ebp
+  8015b7:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  8015ba:	ff 75 0c             	push   0xc(%ebp)
+  8015bd:	ff 75 08             	push   0x8(%ebp)
+  8015c0:	e8 58 07 00 00       	call   801d1d <file_stat>
+}
+  8015c5:	c9                   	leave
+  8015c6:	c3                   	ret
+
+008015c7 <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  8015c7:	55                   	push   %ebp
+  8015c8:	89 e5                	mov    %esp,%ebp
+  8015ca:	57                   	push   %edi
+  8015cb:	56                   	push   %esi
+  8015cc:	53                   	push   %ebx
+  8015cd:	83 ec 1c             	sub    $0x1c,%esp
+  8015d0:	89 c7                	mov    %eax,%edi
+  8015d2:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8015d5:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8015d8:	e9 a2 00 00 00       	jmp    80167f <fsipc_send+0xb8>
+  nfsenvs = 0;
+  8015dd:	c7 05 00 50 80 00 00 	movl   $0x0,0x805000
+  8015e4:	00 00 00 
+  8015e7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015ec:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  8015f1:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  8015f6:	be 01 00 00 00       	mov    $0x1,%esi
+  8015fb:	eb 0f                	jmp    80160c <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  8015fd:	83 c0 01             	add    $0x1,%eax
+  801600:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801605:	74 49                	je     801650 <fsipc_send+0x89>
+  801607:	83 f9 07             	cmp    $0x7,%ecx
+  80160a:	7f 50                	jg     80165c <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  80160c:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  80160f:	c1 e2 04             	shl    $0x4,%edx
+  801612:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801618:	8b 52 50             	mov    0x50(%edx),%edx
+  80161b:	83 fa 01             	cmp    $0x1,%edx
+  80161e:	75 dd                	jne    8015fd <fsipc_send+0x36>
+  801620:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801623:	c1 e2 04             	shl    $0x4,%edx
+  801626:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80162c:	8b 52 54             	mov    0x54(%edx),%edx
+  80162f:	85 d2                	test   %edx,%edx
+  801631:	74 ca                	je     8015fd <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801633:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801636:	c1 e2 04             	shl    $0x4,%edx
+  801639:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80163f:	8b 52 48             	mov    0x48(%edx),%edx
+  801642:	89 14 8d 20 50 80 00 	mov    %edx,0x805020(,%ecx,4)
+  801649:	8d 49 01             	lea    0x1(%ecx),%ecx
+  80164c:	89 f3                	mov    %esi,%ebx
+  80164e:	eb ad                	jmp    8015fd <fsipc_send+0x36>
+  801650:	84 db                	test   %bl,%bl
+  801652:	74 38                	je     80168c <fsipc_send+0xc5>
+  801654:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  80165a:	eb 30                	jmp    80168c <fsipc_send+0xc5>
+  80165c:	84 db                	test   %bl,%bl
+  80165e:	74 2c                	je     80168c <fsipc_send+0xc5>
+  801660:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  801666:	eb 24                	jmp    80168c <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  801668:	50                   	push   %eax
+  801669:	68 3c 32 80 00       	push   $0x80323c
+  80166e:	6a 34                	push   $0x34
+  801670:	68 46 32 80 00       	push   $0x803246
+  801675:	e8 b9 13 00 00       	call   802a33 <_panic>
+    }
+    sys_yield();
+  80167a:	e8 92 f4 ff ff       	call   800b11 <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  80167f:	83 3d 00 50 80 00 03 	cmpl   $0x3,0x805000
+  801686:	0f 8e 51 ff ff ff    	jle    8015dd <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  80168c:	a1 48 57 80 00       	mov    0x805748,%eax
+  801691:	8b 70 48             	mov    0x48(%eax),%esi
+  801694:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  80169a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80169f:	8b 0d 00 50 80 00    	mov    0x805000,%ecx
+  8016a5:	39 d9                	cmp    %ebx,%ecx
+  8016a7:	7e d1                	jle    80167a <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  8016a9:	83 ec 0c             	sub    $0xc,%esp
+  8016ac:	ff 75 e0             	push   -0x20(%ebp)
+  8016af:	6a 07                	push   $0x7
+  8016b1:	ff 75 e4             	push   -0x1c(%ebp)
+  8016b4:	57                   	push   %edi
+  8016b5:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  8016b8:	99                   	cltd
+  8016b9:	f7 f9                	idiv   %ecx
+  8016bb:	ff 34 95 20 50 80 00 	push   0x805020(,%edx,4)
+  8016c2:	e8 63 f7 ff ff       	call   800e2a <sys_ipc_try_send>
+      if (r == 0)
+  8016c7:	83 c4 20             	add    $0x20,%esp
+  8016ca:	85 c0                	test   %eax,%eax
+  8016cc:	74 0a                	je     8016d8 <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  8016ce:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8016d1:	75 95                	jne    801668 <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  8016d3:	83 c3 01             	add    $0x1,%ebx
+  8016d6:	eb c7                	jmp    80169f <fsipc_send+0xd8>
+  }
+}
+  8016d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016db:	5b                   	pop    %ebx
+  8016dc:	5e                   	pop    %esi
+  8016dd:	5f                   	pop    %edi
+  8016de:	5d                   	pop    %ebp
+  8016df:	c3                   	ret
+
+008016e0 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8016e0:	55                   	push   %ebp
+  8016e1:	89 e5                	mov    %esp,%ebp
+  8016e3:	53                   	push   %ebx
+  8016e4:	83 ec 14             	sub    $0x14,%esp
+  8016e7:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  8016e9:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  8016f0:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8016f5:	ba 00 60 80 00       	mov    $0x806000,%edx
+  8016fa:	e8 c8 fe ff ff       	call   8015c7 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  8016ff:	6a 00                	push   $0x0
+  801701:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801704:	50                   	push   %eax
+  801705:	53                   	push   %ebx
+  801706:	6a 00                	push   $0x0
+  801708:	e8 6c 13 00 00       	call   802a79 <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  80170d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801710:	c9                   	leave
+  801711:	c3                   	ret
+
+00801712 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801712:	55                   	push   %ebp
+  801713:	89 e5                	mov    %esp,%ebp
+  801715:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801718:	8b 45 08             	mov    0x8(%ebp),%eax
+  80171b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80171e:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.set_size.req_size = newsize;
+  801723:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801726:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  80172b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801730:	b8 02 00 00 00       	mov    $0x2,%eax
+  801735:	e8 a6 ff ff ff       	call   8016e0 <fsipc>
+}
+  80173a:	c9                   	leave
+  80173b:	c3                   	ret
+
+0080173c <devfile_flush>:
+{
+  80173c:	55                   	push   %ebp
+  80173d:	89 e5                	mov    %esp,%ebp
+  80173f:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801742:	8b 45 08             	mov    0x8(%ebp),%eax
+  801745:	8b 40 0c             	mov    0xc(%eax),%eax
+  801748:	a3 00 60 80 00       	mov    %eax,0x806000
+  return fsipc(FSREQ_FLUSH, NULL);
+  80174d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801752:	b8 06 00 00 00       	mov    $0x6,%eax
+  801757:	e8 84 ff ff ff       	call   8016e0 <fsipc>
+}
+  80175c:	c9                   	leave
+  80175d:	c3                   	ret
+
+0080175e <devfile_stat>:
+{
+  80175e:	55                   	push   %ebp
+  80175f:	89 e5                	mov    %esp,%ebp
+  801761:	53                   	push   %ebx
+  801762:	83 ec 04             	sub    $0x4,%esp
+  801765:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801768:	8b 45 08             	mov    0x8(%ebp),%eax
+  80176b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80176e:	a3 00 60 80 00       	mov    %eax,0x806000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801773:	ba 00 00 00 00       	mov    $0x0,%edx
+  801778:	b8 05 00 00 00       	mov    $0x5,%eax
+  80177d:	e8 5e ff ff ff       	call   8016e0 <fsipc>
+  801782:	85 c0                	test   %eax,%eax
+  801784:	78 2c                	js     8017b2 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801786:	83 ec 08             	sub    $0x8,%esp
+  801789:	68 00 60 80 00       	push   $0x806000
+  80178e:	53                   	push   %ebx
+  80178f:	e8 b0 ef ff ff       	call   800744 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  801794:	a1 80 60 80 00       	mov    0x806080,%eax
+  801799:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80179f:	a1 84 60 80 00       	mov    0x806084,%eax
+  8017a4:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  8017aa:	83 c4 10             	add    $0x10,%esp
+  8017ad:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017b2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017b5:	c9                   	leave
+  8017b6:	c3                   	ret
+
+008017b7 <fsv_alloc>:
+{
+  8017b7:	55                   	push   %ebp
+  8017b8:	89 e5                	mov    %esp,%ebp
+  8017ba:	56                   	push   %esi
+  8017bb:	53                   	push   %ebx
+  8017bc:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  8017be:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017c3:	eb 22                	jmp    8017e7 <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  8017c5:	83 ec 04             	sub    $0x4,%esp
+  8017c8:	6a 00                	push   $0x0
+  8017ca:	6a 00                	push   $0x0
+  8017cc:	6a 07                	push   $0x7
+  8017ce:	50                   	push   %eax
+  8017cf:	6a 00                	push   $0x0
+  8017d1:	6a 04                	push   $0x4
+  8017d3:	68 40 50 80 00       	push   $0x805040
+  8017d8:	e8 e9 f7 ff ff       	call   800fc6 <sysbatch_add>
+  8017dd:	83 c4 20             	add    $0x20,%esp
+  8017e0:	85 c0                	test   %eax,%eax
+  8017e2:	78 48                	js     80182c <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  8017e4:	83 c3 01             	add    $0x1,%ebx
+  8017e7:	39 f3                	cmp    %esi,%ebx
+  8017e9:	74 31                	je     80181c <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  8017eb:	89 d8                	mov    %ebx,%eax
+  8017ed:	c1 e0 0c             	shl    $0xc,%eax
+  8017f0:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  8017f5:	89 c2                	mov    %eax,%edx
+  8017f7:	c1 ea 16             	shr    $0x16,%edx
+  8017fa:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801801:	f6 c2 01             	test   $0x1,%dl
+  801804:	74 bf                	je     8017c5 <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  801806:	89 c2                	mov    %eax,%edx
+  801808:	c1 ea 0c             	shr    $0xc,%edx
+  80180b:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801812:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801815:	83 fa 03             	cmp    $0x3,%edx
+  801818:	75 ab                	jne    8017c5 <fsv_alloc+0xe>
+  80181a:	eb c8                	jmp    8017e4 <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  80181c:	83 ec 0c             	sub    $0xc,%esp
+  80181f:	68 40 50 80 00       	push   $0x805040
+  801824:	e8 4d f7 ff ff       	call   800f76 <sysbatch_flush>
+  801829:	83 c4 10             	add    $0x10,%esp
+}
+  80182c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80182f:	5b                   	pop    %ebx
+  801830:	5e                   	pop    %esi
+  801831:	5d                   	pop    %ebp
+  801832:	c3                   	ret
+
+00801833 <devfile_read>:
+{
+  801833:	55                   	push   %ebp
+  801834:	89 e5                	mov    %esp,%ebp
+  801836:	57                   	push   %edi
+  801837:	56                   	push   %esi
+  801838:	53                   	push   %ebx
+  801839:	83 ec 3c             	sub    $0x3c,%esp
+  80183c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  80183f:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  801845:	77 57                	ja     80189e <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801847:	8b 45 08             	mov    0x8(%ebp),%eax
+  80184a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80184d:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read.req_n = n;
+  801852:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801858:	ba 00 00 00 00       	mov    $0x0,%edx
+  80185d:	b8 03 00 00 00       	mov    $0x3,%eax
+  801862:	e8 79 fe ff ff       	call   8016e0 <fsipc>
+  801867:	89 c6                	mov    %eax,%esi
+  801869:	85 c0                	test   %eax,%eax
+  80186b:	78 27                	js     801894 <devfile_read+0x61>
+  assert(r <= n);
+  80186d:	39 c3                	cmp    %eax,%ebx
+  80186f:	0f 82 0e 02 00 00    	jb     801a83 <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  801875:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80187a:	0f 8f 1c 02 00 00    	jg     801a9c <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801880:	83 ec 04             	sub    $0x4,%esp
+  801883:	50                   	push   %eax
+  801884:	68 00 60 80 00       	push   $0x806000
+  801889:	ff 75 0c             	push   0xc(%ebp)
+  80188c:	e8 39 f0 ff ff       	call   8008ca <memmove>
+  return r;
+  801891:	83 c4 10             	add    $0x10,%esp
+}
+  801894:	89 f0                	mov    %esi,%eax
+  801896:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801899:	5b                   	pop    %ebx
+  80189a:	5e                   	pop    %esi
+  80189b:	5f                   	pop    %edi
+  80189c:	5d                   	pop    %ebp
+  80189d:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  80189e:	b8 01 00 00 00       	mov    $0x1,%eax
+  8018a3:	e8 0f ff ff ff       	call   8017b7 <fsv_alloc>
+  8018a8:	89 c6                	mov    %eax,%esi
+  8018aa:	85 c0                	test   %eax,%eax
+  8018ac:	78 e6                	js     801894 <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  8018ae:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018b1:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018b4:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  8018b9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018bc:	8b 40 04             	mov    0x4(%eax),%eax
+  8018bf:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  8018c4:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  8018ca:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  8018d1:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8018d6:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  8018db:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8018e0:	e8 e2 fc ff ff       	call   8015c7 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  8018e5:	6a 00                	push   $0x0
+  8018e7:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8018ea:	50                   	push   %eax
+  8018eb:	68 00 10 c0 9f       	push   $0x9fc01000
+  8018f0:	6a 00                	push   $0x0
+  8018f2:	e8 82 11 00 00       	call   802a79 <ipc_recv_pages>
+  8018f7:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  8018f9:	83 c4 10             	add    $0x10,%esp
+  8018fc:	85 c0                	test   %eax,%eax
+  8018fe:	7e 94                	jle    801894 <devfile_read+0x61>
+  assert(r <= n);
+  801900:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801903:	39 c3                	cmp    %eax,%ebx
+  801905:	72 2e                	jb     801935 <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801907:	8b 45 08             	mov    0x8(%ebp),%eax
+  80190a:	8b 40 04             	mov    0x4(%eax),%eax
+  80190d:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801912:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  801915:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801918:	c1 e2 0c             	shl    $0xc,%edx
+  80191b:	39 ca                	cmp    %ecx,%edx
+  80191d:	72 2f                	jb     80194e <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  80191f:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  801924:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  801927:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  80192b:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801930:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  801933:	eb 52                	jmp    801987 <devfile_read+0x154>
+  assert(r <= n);
+  801935:	68 51 32 80 00       	push   $0x803251
+  80193a:	68 58 32 80 00       	push   $0x803258
+  80193f:	68 49 01 00 00       	push   $0x149
+  801944:	68 46 32 80 00       	push   $0x803246
+  801949:	e8 e5 10 00 00       	call   802a33 <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  80194e:	68 7c 32 80 00       	push   $0x80327c
+  801953:	68 58 32 80 00       	push   $0x803258
+  801958:	68 4a 01 00 00       	push   $0x14a
+  80195d:	68 46 32 80 00       	push   $0x803246
+  801962:	e8 cc 10 00 00       	call   802a33 <_panic>
+      memmove(dst + done, src + done, m);
+  801967:	83 ec 04             	sub    $0x4,%esp
+  80196a:	53                   	push   %ebx
+  80196b:	56                   	push   %esi
+  80196c:	89 f8                	mov    %edi,%eax
+  80196e:	03 45 0c             	add    0xc(%ebp),%eax
+  801971:	50                   	push   %eax
+  801972:	e8 53 ef ff ff       	call   8008ca <memmove>
+  801977:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  80197a:	01 df                	add    %ebx,%edi
+  80197c:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80197f:	39 c7                	cmp    %eax,%edi
+  801981:	0f 83 c0 00 00 00    	jae    801a47 <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801987:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80198a:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  80198d:	89 f0                	mov    %esi,%eax
+  80198f:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801994:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  801999:	29 c3                	sub    %eax,%ebx
+  80199b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80199e:	29 f8                	sub    %edi,%eax
+  8019a0:	39 c3                	cmp    %eax,%ebx
+  8019a2:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  8019a5:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  8019ab:	75 ba                	jne    801967 <devfile_read+0x134>
+  8019ad:	89 f9                	mov    %edi,%ecx
+  8019af:	03 4d 0c             	add    0xc(%ebp),%ecx
+  8019b2:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  8019b5:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  8019bb:	75 aa                	jne    801967 <devfile_read+0x134>
+  8019bd:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  8019c3:	77 a2                	ja     801967 <devfile_read+0x134>
+  8019c5:	89 c8                	mov    %ecx,%eax
+  8019c7:	c1 e8 16             	shr    $0x16,%eax
+  8019ca:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8019d1:	a8 01                	test   $0x1,%al
+  8019d3:	74 92                	je     801967 <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  8019d5:	89 c8                	mov    %ecx,%eax
+  8019d7:	c1 e8 0c             	shr    $0xc,%eax
+  8019da:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  8019e1:	a8 01                	test   $0x1,%al
+  8019e3:	74 82                	je     801967 <devfile_read+0x134>
+  8019e5:	a9 02 08 00 00       	test   $0x802,%eax
+  8019ea:	0f 84 77 ff ff ff    	je     801967 <devfile_read+0x134>
+  8019f0:	f6 c4 04             	test   $0x4,%ah
+  8019f3:	0f 85 6e ff ff ff    	jne    801967 <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  8019f9:	a1 48 57 80 00       	mov    0x805748,%eax
+  8019fe:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  801a02:	84 c0                	test   %al,%al
+  801a04:	75 17                	jne    801a1d <devfile_read+0x1ea>
+  801a06:	83 ec 08             	sub    $0x8,%esp
+  801a09:	6a 01                	push   $0x1
+  801a0b:	6a 00                	push   $0x0
+  801a0d:	e8 1e f1 ff ff       	call   800b30 <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  801a12:	83 c4 10             	add    $0x10,%esp
+  801a15:	85 c0                	test   %eax,%eax
+  801a17:	0f 85 4a ff ff ff    	jne    801967 <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  801a1d:	83 ec 04             	sub    $0x4,%esp
+  801a20:	68 05 08 00 00       	push   $0x805
+  801a25:	ff 75 cc             	push   -0x34(%ebp)
+  801a28:	6a 00                	push   $0x0
+  801a2a:	56                   	push   %esi
+  801a2b:	6a 00                	push   $0x0
+  801a2d:	6a 05                	push   $0x5
+  801a2f:	68 40 50 80 00       	push   $0x805040
+  801a34:	e8 8d f5 ff ff       	call   800fc6 <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  801a39:	c1 e8 1f             	shr    $0x1f,%eax
+  801a3c:	08 45 cb             	or     %al,-0x35(%ebp)
+  801a3f:	83 c4 20             	add    $0x20,%esp
+  801a42:	e9 33 ff ff ff       	jmp    80197a <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  801a47:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  801a4a:	83 ec 0c             	sub    $0xc,%esp
+  801a4d:	68 40 50 80 00       	push   $0x805040
+  801a52:	e8 1f f5 ff ff       	call   800f76 <sysbatch_flush>
+  801a57:	83 c4 10             	add    $0x10,%esp
+  801a5a:	85 c0                	test   %eax,%eax
+  801a5c:	78 06                	js     801a64 <devfile_read+0x231>
+  801a5e:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  801a62:	74 14                	je     801a78 <devfile_read+0x245>
+    memmove(dst, src, r);
+  801a64:	83 ec 04             	sub    $0x4,%esp
+  801a67:	ff 75 d4             	push   -0x2c(%ebp)
+  801a6a:	ff 75 d0             	push   -0x30(%ebp)
+  801a6d:	ff 75 0c             	push   0xc(%ebp)
+  801a70:	e8 55 ee ff ff       	call   8008ca <memmove>
+  801a75:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  801a78:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a7b:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  801a7e:	e9 11 fe ff ff       	jmp    801894 <devfile_read+0x61>
+  assert(r <= n);
+  801a83:	68 51 32 80 00       	push   $0x803251
+  801a88:	68 58 32 80 00       	push   $0x803258
+  801a8d:	68 1c 01 00 00       	push   $0x11c
+  801a92:	68 46 32 80 00       	push   $0x803246
+  801a97:	e8 97 0f 00 00       	call   802a33 <_panic>
+  assert(r <= PGSIZE);
+  801a9c:	68 6d 32 80 00       	push   $0x80326d
+  801aa1:	68 58 32 80 00       	push   $0x803258
+  801aa6:	68 1d 01 00 00       	push   $0x11d
+  801aab:	68 46 32 80 00       	push   $0x803246
+  801ab0:	e8 7e 0f 00 00       	call   802a33 <_panic>
+
+00801ab5 <devfile_write>:
+{
+  801ab5:	55                   	push   %ebp
+  801ab6:	89 e5                	mov    %esp,%ebp
+  801ab8:	57                   	push   %edi
+  801ab9:	56                   	push   %esi
+  801aba:	53                   	push   %ebx
+  801abb:	83 ec 1c             	sub    $0x1c,%esp
+  801abe:	8b 75 08             	mov    0x8(%ebp),%esi
+  801ac1:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  801ac4:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  801ac9:	77 39                	ja     801b04 <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801acb:	8b 56 0c             	mov    0xc(%esi),%edx
+  801ace:	89 15 00 60 80 00    	mov    %edx,0x806000
+  fsipcbuf.write.req_n = n;
+  801ad4:	a3 04 60 80 00       	mov    %eax,0x806004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  801ad9:	83 ec 04             	sub    $0x4,%esp
+  801adc:	50                   	push   %eax
+  801add:	ff 75 0c             	push   0xc(%ebp)
+  801ae0:	68 08 60 80 00       	push   $0x806008
+  801ae5:	e8 e0 ed ff ff       	call   8008ca <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801aea:	ba 00 00 00 00       	mov    $0x0,%edx
+  801aef:	b8 04 00 00 00       	mov    $0x4,%eax
+  801af4:	e8 e7 fb ff ff       	call   8016e0 <fsipc>
+  801af9:	83 c4 10             	add    $0x10,%esp
+}
+  801afc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801aff:	5b                   	pop    %ebx
+  801b00:	5e                   	pop    %esi
+  801b01:	5f                   	pop    %edi
+  801b02:	5d                   	pop    %ebp
+  801b03:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  801b04:	ba 00 00 10 00       	mov    $0x100000,%edx
+  801b09:	39 d0                	cmp    %edx,%eax
+  801b0b:	89 d3                	mov    %edx,%ebx
+  801b0d:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  801b10:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  801b16:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  801b19:	83 c7 01             	add    $0x1,%edi
+  801b1c:	89 f8                	mov    %edi,%eax
+  801b1e:	e8 94 fc ff ff       	call   8017b7 <fsv_alloc>
+  801b23:	85 c0                	test   %eax,%eax
+  801b25:	78 d5                	js     801afc <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  801b27:	83 ec 04             	sub    $0x4,%esp
+  801b2a:	53                   	push   %ebx
+  801b2b:	ff 75 0c             	push   0xc(%ebp)
+  801b2e:	68 00 10 c0 9f       	push   $0x9fc01000
+  801b33:	e8 92 ed ff ff       	call   8008ca <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  801b38:	8b 46 0c             	mov    0xc(%esi),%eax
+  801b3b:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  801b40:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  801b46:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801b4d:	89 f9                	mov    %edi,%ecx
+  801b4f:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801b54:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801b59:	e8 69 fa ff ff       	call   8015c7 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801b5e:	6a 00                	push   $0x0
+  801b60:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801b63:	50                   	push   %eax
+  801b64:	6a 00                	push   $0x0
+  801b66:	6a 00                	push   $0x0
+  801b68:	e8 0c 0f 00 00       	call   802a79 <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  801b6d:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  801b70:	eb 8a                	jmp    801afc <devfile_write+0x47>
+
+00801b72 <open>:
+{
+  801b72:	55                   	push   %ebp
+  801b73:	89 e5                	mov    %esp,%ebp
+  801b75:	56                   	push   %esi
+  801b76:	53                   	push   %ebx
+  801b77:	83 ec 1c             	sub    $0x1c,%esp
+  801b7a:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801b7d:	56                   	push   %esi
+  801b7e:	e8 86 eb ff ff       	call   800709 <strlen>
+  801b83:	83 c4 10             	add    $0x10,%esp
+  801b86:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801b8b:	7f 6c                	jg     801bf9 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  801b8d:	83 ec 0c             	sub    $0xc,%esp
+  801b90:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b93:	50                   	push   %eax
+  801b94:	e8 ad f4 ff ff       	call   801046 <fd_alloc>
+  801b99:	89 c3                	mov    %eax,%ebx
+  801b9b:	83 c4 10             	add    $0x10,%esp
+  801b9e:	85 c0                	test   %eax,%eax
+  801ba0:	78 3c                	js     801bde <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801ba2:	83 ec 08             	sub    $0x8,%esp
+  801ba5:	56                   	push   %esi
+  801ba6:	68 00 60 80 00       	push   $0x806000
+  801bab:	e8 94 eb ff ff       	call   800744 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801bb0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801bb3:	a3 00 64 80 00       	mov    %eax,0x806400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801bb8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801bbb:	b8 01 00 00 00       	mov    $0x1,%eax
+  801bc0:	e8 1b fb ff ff       	call   8016e0 <fsipc>
+  801bc5:	89 c3                	mov    %eax,%ebx
+  801bc7:	83 c4 10             	add    $0x10,%esp
+  801bca:	85 c0                	test   %eax,%eax
+  801bcc:	78 19                	js     801be7 <open+0x75>
+  return fd2num(fd);
+  801bce:	83 ec 0c             	sub    $0xc,%esp
+  801bd1:	ff 75 f4             	push   -0xc(%ebp)
+  801bd4:	e8 49 f4 ff ff       	call   801022 <fd2num>
+  801bd9:	89 c3                	mov    %eax,%ebx
+  801bdb:	83 c4 10             	add    $0x10,%esp
+}
+  801bde:	89 d8                	mov    %ebx,%eax
+  801be0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801be3:	5b                   	pop    %ebx
+  801be4:	5e                   	pop    %esi
+  801be5:	5d                   	pop    %ebp
+  801be6:	c3                   	ret
+    fd_close(fd, 0);
+  801be7:	83 ec 08             	sub    $0x8,%esp
+  801bea:	6a 00                	push   $0x0
+  801bec:	ff 75 f4             	push   -0xc(%ebp)
+  801bef:	e8 44 f5 ff ff       	call   801138 <fd_close>
+    return r;
+  801bf4:	83 c4 10             	add    $0x10,%esp
+  801bf7:	eb e5                	jmp    801bde <open+0x6c>
+    return -E_BAD_PATH;
+  801bf9:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801bfe:	eb de                	jmp    801bde <open+0x6c>
+
+00801c00 <open_read>:
+{
+  801c00:	55                   	push   %ebp
+  801c01:	89 e5                	mov    %esp,%ebp
+  801c03:	57                   	push   %edi
+  801c04:	56                   	push   %esi
+  801c05:	53                   	push   %ebx
+  801c06:	83 ec 28             	sub    $0x28,%esp
+  801c09:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  801c0c:	57                   	push   %edi
+  801c0d:	e8 f7 ea ff ff       	call   800709 <strlen>
+  801c12:	83 c4 10             	add    $0x10,%esp
+  801c15:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801c1a:	0f 87 f6 00 00 00    	ja     801d16 <open_read+0x116>
+  801c20:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  801c22:	83 ec 0c             	sub    $0xc,%esp
+  801c25:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801c28:	50                   	push   %eax
+  801c29:	e8 18 f4 ff ff       	call   801046 <fd_alloc>
+  801c2e:	89 c3                	mov    %eax,%ebx
+  801c30:	83 c4 10             	add    $0x10,%esp
+  801c33:	85 c0                	test   %eax,%eax
+  801c35:	0f 88 b2 00 00 00    	js     801ced <open_read+0xed>
+  strcpy(req->req_buf, path);
+  801c3b:	83 ec 08             	sub    $0x8,%esp
+  801c3e:	57                   	push   %edi
+  801c3f:	68 e4 60 80 00       	push   $0x8060e4
+  801c44:	e8 fb ea ff ff       	call   800744 <strcpy>
+  req->req_nops = 2;
+  801c49:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  801c50:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  801c53:	c7 05 04 60 80 00 01 	movl   $0x1,0x806004
+  801c5a:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  801c5d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c60:	a3 10 60 80 00       	mov    %eax,0x806010
+  req->req_ops[0].op_buf = 0;
+  801c65:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  801c6c:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  801c6f:	c7 05 20 60 80 00 04 	movl   $0x4,0x806020
+  801c76:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  801c79:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  801c80:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  801c83:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  801c88:	29 f0                	sub    %esi,%eax
+  801c8a:	3b 45 14             	cmp    0x14(%ebp),%eax
+  801c8d:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  801c91:	a3 2c 60 80 00       	mov    %eax,0x80602c
+  req->req_ops[1].op_offset = 0;
+  801c96:	c7 05 30 60 80 00 00 	movl   $0x0,0x806030
+  801c9d:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  801ca0:	83 c6 01             	add    $0x1,%esi
+  801ca3:	89 35 34 60 80 00    	mov    %esi,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  801ca9:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801cac:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801cb1:	e8 2a fa ff ff       	call   8016e0 <fsipc>
+  801cb6:	89 c3                	mov    %eax,%ebx
+  801cb8:	83 c4 10             	add    $0x10,%esp
+  801cbb:	83 f8 01             	cmp    $0x1,%eax
+  801cbe:	7e 37                	jle    801cf7 <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  801cc0:	a1 38 60 80 00       	mov    0x806038,%eax
+  801cc5:	8b 55 18             	mov    0x18(%ebp),%edx
+  801cc8:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  801cca:	83 ec 04             	sub    $0x4,%esp
+  801ccd:	50                   	push   %eax
+  801cce:	81 c6 e4 60 80 00    	add    $0x8060e4,%esi
+  801cd4:	56                   	push   %esi
+  801cd5:	ff 75 10             	push   0x10(%ebp)
+  801cd8:	e8 ed eb ff ff       	call   8008ca <memmove>
+  return fd2num(fd);
+  801cdd:	83 c4 04             	add    $0x4,%esp
+  801ce0:	ff 75 e4             	push   -0x1c(%ebp)
+  801ce3:	e8 3a f3 ff ff       	call   801022 <fd2num>
+  801ce8:	89 c3                	mov    %eax,%ebx
+  801cea:	83 c4 10             	add    $0x10,%esp
+}
+  801ced:	89 d8                	mov    %ebx,%eax
+  801cef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cf2:	5b                   	pop    %ebx
+  801cf3:	5e                   	pop    %esi
+  801cf4:	5f                   	pop    %edi
+  801cf5:	5d                   	pop    %ebp
+  801cf6:	c3                   	ret
+    fd_close(fd, 0);
+  801cf7:	83 ec 08             	sub    $0x8,%esp
+  801cfa:	6a 00                	push   $0x0
+  801cfc:	ff 75 e4             	push   -0x1c(%ebp)
+  801cff:	e8 34 f4 ff ff       	call   801138 <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  801d04:	83 c4 10             	add    $0x10,%esp
+  801d07:	85 db                	test   %ebx,%ebx
+  801d09:	78 e2                	js     801ced <open_read+0xed>
+  801d0b:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  801d0e:	8b 9b 1c 60 80 00    	mov    0x80601c(%ebx),%ebx
+  801d14:	eb d7                	jmp    801ced <open_read+0xed>
+    return -E_BAD_PATH;
+  801d16:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801d1b:	eb d0                	jmp    801ced <open_read+0xed>
+
+00801d1d <file_stat>:
+{
+  801d1d:	55                   	push   %ebp
+  801d1e:	89 e5                	mov    %esp,%ebp
+  801d20:	57                   	push   %edi
+  801d21:	56                   	push   %esi
+  801d22:	53                   	push   %ebx
+  801d23:	83 ec 18             	sub    $0x18,%esp
+  801d26:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801d29:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801d2c:	57                   	push   %edi
+  801d2d:	e8 d7 e9 ff ff       	call   800709 <strlen>
+  801d32:	83 c4 10             	add    $0x10,%esp
+  801d35:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801d3a:	0f 8f c7 00 00 00    	jg     801e07 <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  801d40:	83 ec 0c             	sub    $0xc,%esp
+  801d43:	57                   	push   %edi
+  801d44:	e8 c0 e9 ff ff       	call   800709 <strlen>
+  801d49:	8d 58 04             	lea    0x4(%eax),%ebx
+  801d4c:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  801d4f:	83 c4 08             	add    $0x8,%esp
+  801d52:	57                   	push   %edi
+  801d53:	68 e4 60 80 00       	push   $0x8060e4
+  801d58:	e8 e7 e9 ff ff       	call   800744 <strcpy>
+  req->req_nops = 2;
+  801d5d:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  801d64:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  801d67:	c7 05 04 60 80 00 02 	movl   $0x2,0x806004
+  801d6e:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  801d71:	c7 05 10 60 80 00 00 	movl   $0x0,0x806010
+  801d78:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  801d7b:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  801d82:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  801d85:	c7 05 20 60 80 00 03 	movl   $0x3,0x806020
+  801d8c:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  801d8f:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  801d96:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  801d99:	89 1d 34 60 80 00    	mov    %ebx,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  801d9f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801da4:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801da9:	e8 32 f9 ff ff       	call   8016e0 <fsipc>
+  801dae:	83 c4 10             	add    $0x10,%esp
+  801db1:	83 f8 01             	cmp    $0x1,%eax
+  801db4:	7e 42                	jle    801df8 <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  801db6:	81 c3 e4 60 80 00    	add    $0x8060e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  801dbc:	83 ec 08             	sub    $0x8,%esp
+  801dbf:	53                   	push   %ebx
+  801dc0:	56                   	push   %esi
+  801dc1:	e8 7e e9 ff ff       	call   800744 <strcpy>
+  st->st_size = ret->ret_size;
+  801dc6:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  801dcc:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  801dd2:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  801dd8:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  801dde:	c7 86 88 00 00 00 04 	movl   $0x804004,0x88(%esi)
+  801de5:	40 80 00 
+  return 0;
+  801de8:	83 c4 10             	add    $0x10,%esp
+  801deb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801df0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801df3:	5b                   	pop    %ebx
+  801df4:	5e                   	pop    %esi
+  801df5:	5f                   	pop    %edi
+  801df6:	5d                   	pop    %ebp
+  801df7:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  801df8:	85 c0                	test   %eax,%eax
+  801dfa:	78 f4                	js     801df0 <file_stat+0xd3>
+  801dfc:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801dff:	8b 80 1c 60 80 00    	mov    0x80601c(%eax),%eax
+  801e05:	eb e9                	jmp    801df0 <file_stat+0xd3>
+    return -E_BAD_PATH;
+  801e07:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801e0c:	eb e2                	jmp    801df0 <file_stat+0xd3>
+
+00801e0e <read_map>:
+{
+  801e0e:	55                   	push   %ebp
+  801e0f:	89 e5                	mov    %esp,%ebp
+  801e11:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801e14:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e17:	50                   	push   %eax
+  801e18:	ff 75 08             	push   0x8(%ebp)
+  801e1b:	e8 7c f2 ff ff       	call   80109c <fd_lookup>
+  801e20:	83 c4 10             	add    $0x10,%esp
+  801e23:	85 c0                	test   %eax,%eax
+  801e25:	78 2a                	js     801e51 <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  801e27:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e2a:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  801e30:	39 08                	cmp    %ecx,(%eax)
+  801e32:	75 1f                	jne    801e53 <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  801e34:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e37:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read_map.req_offset = offset;
+  801e3c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e3f:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  801e44:	8b 55 10             	mov    0x10(%ebp),%edx
+  801e47:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801e4c:	e8 8f f8 ff ff       	call   8016e0 <fsipc>
+}
+  801e51:	c9                   	leave
+  801e52:	c3                   	ret
+    return -E_INVAL;
+  801e53:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e58:	eb f7                	jmp    801e51 <read_map+0x43>
+
+00801e5a <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801e5a:	55                   	push   %ebp
+  801e5b:	89 e5                	mov    %esp,%ebp
+  801e5d:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  801e60:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e65:	b8 08 00 00 00       	mov    $0x8,%eax
+  801e6a:	e8 71 f8 ff ff       	call   8016e0 <fsipc>
+}
+  801e6f:	c9                   	leave
+  801e70:	c3                   	ret
+
+00801e71 <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  801e71:	55                   	push   %ebp
+  801e72:	89 e5                	mov    %esp,%ebp
+  801e74:	57                   	push   %edi
+  801e75:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  801e76:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e79:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.stats.req_bio_sched = 0;
+  801e7e:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  801e85:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  801e88:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  801e8f:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  801e92:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e97:	b8 09 00 00 00       	mov    $0x9,%eax
+  801e9c:	e8 3f f8 ff ff       	call   8016e0 <fsipc>
+  801ea1:	85 c0                	test   %eax,%eax
+  801ea3:	78 14                	js     801eb9 <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  801ea5:	be 00 60 80 00       	mov    $0x806000,%esi
+  801eaa:	b9 16 00 00 00       	mov    $0x16,%ecx
+  801eaf:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801eb2:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  801eb4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801eb9:	5e                   	pop    %esi
+  801eba:	5f                   	pop    %edi
+  801ebb:	5d                   	pop    %ebp
+  801ebc:	c3                   	ret
+
+00801ebd <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  801ebd:	55                   	push   %ebp
+  801ebe:	89 e5                	mov    %esp,%ebp
+  801ec0:	53                   	push   %ebx
+  801ec1:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  801ec4:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801ec7:	50                   	push   %eax
+  801ec8:	6a 00                	push   $0x0
+  801eca:	e8 a2 ff ff ff       	call   801e71 <fs_stats>
+  801ecf:	83 c4 10             	add    $0x10,%esp
+  801ed2:	85 c0                	test   %eax,%eax
+  801ed4:	78 28                	js     801efe <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  801ed6:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  801ed9:	83 ec 08             	sub    $0x8,%esp
+  801edc:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801edf:	50                   	push   %eax
+  801ee0:	6a 20                	push   $0x20
+  801ee2:	e8 8a ff ff ff       	call   801e71 <fs_stats>
+  801ee7:	83 c4 10             	add    $0x10,%esp
+  801eea:	85 c0                	test   %eax,%eax
+  801eec:	78 10                	js     801efe <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  801eee:	83 ec 08             	sub    $0x8,%esp
+  801ef1:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801ef4:	50                   	push   %eax
+  801ef5:	53                   	push   %ebx
+  801ef6:	e8 76 ff ff ff       	call   801e71 <fs_stats>
+  801efb:	83 c4 10             	add    $0x10,%esp
+}
+  801efe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f01:	c9                   	leave
+  801f02:	c3                   	ret
+
+00801f03 <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  801f03:	55                   	push   %ebp
+  801f04:	89 e5                	mov    %esp,%ebp
+  801f06:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  801f09:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  801f10:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  801f13:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f16:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.stats.req_dcache = 0;
+  801f1b:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  801f22:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  801f25:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f2a:	b8 09 00 00 00       	mov    $0x9,%eax
+  801f2f:	e8 ac f7 ff ff       	call   8016e0 <fsipc>
+}
+  801f34:	c9                   	leave
+  801f35:	c3                   	ret
+
+00801f36 <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  801f36:	55                   	push   %ebp
+  801f37:	89 e5                	mov    %esp,%ebp
+  801f39:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  801f3c:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  801f43:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  801f46:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  801f4d:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  801f50:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f53:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_STATS, NULL);
+  801f58:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f5d:	b8 09 00 00 00       	mov    $0x9,%eax
+  801f62:	e8 79 f7 ff ff       	call   8016e0 <fsipc>
+}
+  801f67:	c9                   	leave
+  801f68:	c3                   	ret
+
+00801f69 <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  801f69:	55                   	push   %ebp
+  801f6a:	89 e5                	mov    %esp,%ebp
+  801f6c:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801f6f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f72:	50                   	push   %eax
+  801f73:	ff 75 08             	push   0x8(%ebp)
+  801f76:	e8 21 f1 ff ff       	call   80109c <fd_lookup>
+  801f7b:	83 c4 10             	add    $0x10,%esp
+  801f7e:	85 c0                	test   %eax,%eax
+  801f80:	78 34                	js     801fb6 <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  801f82:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f85:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  801f8b:	39 08                	cmp    %ecx,(%eax)
+  801f8d:	75 29                	jne    801fb8 <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  801f8f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f92:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.fallocate.req_offset = offset;
+  801f97:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f9a:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.fallocate.req_len = len;
+  801f9f:	8b 45 10             	mov    0x10(%ebp),%eax
+  801fa2:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  801fa7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fac:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801fb1:	e8 2a f7 ff ff       	call   8016e0 <fsipc>
+}
+  801fb6:	c9                   	leave
+  801fb7:	c3                   	ret
+    return -E_INVAL;
+  801fb8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801fbd:	eb f7                	jmp    801fb6 <fallocate+0x4d>
+
+00801fbf <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  801fbf:	55                   	push   %ebp
+  801fc0:	89 e5                	mov    %esp,%ebp
+  801fc2:	57                   	push   %edi
+  801fc3:	56                   	push   %esi
+  801fc4:	53                   	push   %ebx
+  801fc5:	83 ec 24             	sub    $0x24,%esp
+  801fc8:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801fcb:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801fce:	50                   	push   %eax
+  801fcf:	ff 75 08             	push   0x8(%ebp)
+  801fd2:	e8 c5 f0 ff ff       	call   80109c <fd_lookup>
+  801fd7:	83 c4 10             	add    $0x10,%esp
+  801fda:	85 c0                	test   %eax,%eax
+  801fdc:	78 66                	js     802044 <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  801fde:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801fe1:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  801fe7:	39 08                	cmp    %ecx,(%eax)
+  801fe9:	75 61                	jne    80204c <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  801feb:	85 f6                	test   %esi,%esi
+  801fed:	7e 50                	jle    80203f <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  801fef:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  801ff4:	39 de                	cmp    %ebx,%esi
+  801ff6:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  801ff9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801ffc:	8b 40 0c             	mov    0xc(%eax),%eax
+  801fff:	a3 00 60 80 00       	mov    %eax,0x806000
+    fsipcbuf.prefetch.req_n = m;
+  802004:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  80200a:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  802011:	83 ec 04             	sub    $0x4,%esp
+  802014:	57                   	push   %edi
+  802015:	ff 75 0c             	push   0xc(%ebp)
+  802018:	68 08 60 80 00       	push   $0x806008
+  80201d:	e8 a8 e8 ff ff       	call   8008ca <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  802022:	ba 00 00 00 00       	mov    $0x0,%edx
+  802027:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80202c:	e8 af f6 ff ff       	call   8016e0 <fsipc>
+  802031:	83 c4 10             	add    $0x10,%esp
+  802034:	85 c0                	test   %eax,%eax
+  802036:	78 0c                	js     802044 <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  802038:	01 7d 0c             	add    %edi,0xc(%ebp)
+  80203b:	29 de                	sub    %ebx,%esi
+  80203d:	eb ac                	jmp    801feb <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  80203f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802044:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802047:	5b                   	pop    %ebx
+  802048:	5e                   	pop    %esi
+  802049:	5f                   	pop    %edi
+  80204a:	5d                   	pop    %ebp
+  80204b:	c3                   	ret
+    return -E_INVAL;
+  80204c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802051:	eb f1                	jmp    802044 <prefetch+0x85>
+
+00802053 <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  802053:	55                   	push   %ebp
+  802054:	89 e5                	mov    %esp,%ebp
+  802056:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  802059:	50                   	push   %eax
+  80205a:	e8 d3 ef ff ff       	call   801032 <fd2data>
+  80205f:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  802064:	c9                   	leave
+  802065:	c3                   	ret
+
+00802066 <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802066:	55                   	push   %ebp
+  802067:	89 e5                	mov    %esp,%ebp
+  802069:	56                   	push   %esi
+  80206a:	53                   	push   %ebx
+  80206b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  80206e:	83 ec 0c             	sub    $0xc,%esp
+  802071:	ff 75 08             	push   0x8(%ebp)
+  802074:	e8 b9 ef ff ff       	call   801032 <fd2data>
+  802079:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  80207b:	83 c4 08             	add    $0x8,%esp
+  80207e:	68 a8 32 80 00       	push   $0x8032a8
+  802083:	53                   	push   %ebx
+  802084:	e8 bb e6 ff ff       	call   800744 <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  802089:	8b 46 04             	mov    0x4(%esi),%eax
+  80208c:	2b 06                	sub    (%esi),%eax
+  80208e:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  802094:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80209b:	00 00 00 
+  stat->st_dev = &devpipe;
+  80209e:	c7 83 88 00 00 00 20 	movl   $0x804020,0x88(%ebx)
+  8020a5:	40 80 00 
+  return 0;
+}
+  8020a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020ad:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020b0:	5b                   	pop    %ebx
+  8020b1:	5e                   	pop    %esi
+  8020b2:	5d                   	pop    %ebp
+  8020b3:	c3                   	ret
+
+008020b4 <pipe_wakeup>:
+{
+  8020b4:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  8020b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020bb:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  8020be:	85 c0                	test   %eax,%eax
+  8020c0:	75 01                	jne    8020c3 <pipe_wakeup+0xf>
+  8020c2:	c3                   	ret
+{
+  8020c3:	55                   	push   %ebp
+  8020c4:	89 e5                	mov    %esp,%ebp
+  8020c6:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  8020c9:	6a 00                	push   $0x0
+  8020cb:	68 00 00 c0 ee       	push   $0xeec00000
+  8020d0:	52                   	push   %edx
+  8020d1:	e8 f9 ed ff ff       	call   800ecf <sys_chan_wakeup>
+  8020d6:	83 c4 10             	add    $0x10,%esp
+}
+  8020d9:	c9                   	leave
+  8020da:	c3                   	ret
+
+008020db <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8020db:	55                   	push   %ebp
+  8020dc:	89 e5                	mov    %esp,%ebp
+  8020de:	57                   	push   %edi
+  8020df:	56                   	push   %esi
+  8020e0:	53                   	push   %ebx
+  8020e1:	83 ec 18             	sub    $0x18,%esp
+  8020e4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  8020e7:	57                   	push   %edi
+  8020e8:	e8 45 ef ff ff       	call   801032 <fd2data>
+  8020ed:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  8020ef:	83 c4 10             	add    $0x10,%esp
+  8020f2:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  8020f6:	74 2a                	je     802122 <devpipe_close+0x47>
+  8020f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  8020fd:	89 f8                	mov    %edi,%eax
+  8020ff:	e8 4f ff ff ff       	call   802053 <pipe_ring>
+  802104:	83 ec 08             	sub    $0x8,%esp
+  802107:	01 d8                	add    %ebx,%eax
+  802109:	50                   	push   %eax
+  80210a:	6a 00                	push   $0x0
+  80210c:	e8 e7 ea ff ff       	call   800bf8 <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  802111:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802117:	83 c4 10             	add    $0x10,%esp
+  80211a:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  802120:	75 db                	jne    8020fd <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  802122:	83 ec 08             	sub    $0x8,%esp
+  802125:	57                   	push   %edi
+  802126:	6a 00                	push   $0x0
+  802128:	e8 cb ea ff ff       	call   800bf8 <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  80212d:	83 c4 10             	add    $0x10,%esp
+  802130:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  802134:	75 13                	jne    802149 <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  802136:	83 ec 08             	sub    $0x8,%esp
+  802139:	56                   	push   %esi
+  80213a:	6a 00                	push   $0x0
+  80213c:	e8 b7 ea ff ff       	call   800bf8 <sys_page_unmap>
+}
+  802141:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802144:	5b                   	pop    %ebx
+  802145:	5e                   	pop    %esi
+  802146:	5f                   	pop    %edi
+  802147:	5d                   	pop    %ebp
+  802148:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802149:	8d 56 04             	lea    0x4(%esi),%edx
+  80214c:	8d 46 2c             	lea    0x2c(%esi),%eax
+  80214f:	e8 60 ff ff ff       	call   8020b4 <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802154:	8d 46 30             	lea    0x30(%esi),%eax
+  802157:	89 f2                	mov    %esi,%edx
+  802159:	e8 56 ff ff ff       	call   8020b4 <pipe_wakeup>
+  80215e:	eb d6                	jmp    802136 <devpipe_close+0x5b>
+
+00802160 <_pipeisclosed>:
+{
+  802160:	55                   	push   %ebp
+  802161:	89 e5                	mov    %esp,%ebp
+  802163:	57                   	push   %edi
+  802164:	56                   	push   %esi
+  802165:	53                   	push   %ebx
+  802166:	83 ec 1c             	sub    $0x1c,%esp
+  802169:	89 c7                	mov    %eax,%edi
+  80216b:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  80216d:	a1 48 57 80 00       	mov    0x805748,%eax
+  802172:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  802175:	83 ec 0c             	sub    $0xc,%esp
+  802178:	57                   	push   %edi
+  802179:	e8 5e 0a 00 00       	call   802bdc <pageref>
+  80217e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802181:	89 34 24             	mov    %esi,(%esp)
+  802184:	e8 53 0a 00 00       	call   802bdc <pageref>
+    nn = thisenv->env_runs;
+  802189:	8b 15 48 57 80 00    	mov    0x805748,%edx
+  80218f:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  802192:	83 c4 10             	add    $0x10,%esp
+  802195:	39 cb                	cmp    %ecx,%ebx
+  802197:	74 1b                	je     8021b4 <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  802199:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80219c:	75 cf                	jne    80216d <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80219e:	8b 42 58             	mov    0x58(%edx),%eax
+  8021a1:	6a 01                	push   $0x1
+  8021a3:	50                   	push   %eax
+  8021a4:	53                   	push   %ebx
+  8021a5:	68 af 32 80 00       	push   $0x8032af
+  8021aa:	e8 a7 df ff ff       	call   800156 <cprintf>
+  8021af:	83 c4 10             	add    $0x10,%esp
+  8021b2:	eb b9                	jmp    80216d <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  8021b4:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8021b7:	0f 94 c0             	sete   %al
+  8021ba:	0f b6 c0             	movzbl %al,%eax
+}
+  8021bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021c0:	5b                   	pop    %ebx
+  8021c1:	5e                   	pop    %esi
+  8021c2:	5f                   	pop    %edi
+  8021c3:	5d                   	pop    %ebp
+  8021c4:	c3                   	ret
+
+008021c5 <devpipe_write_bulk>:
+{
+  8021c5:	55                   	push   %ebp
+  8021c6:	89 e5                	mov    %esp,%ebp
+  8021c8:	57                   	push   %edi
+  8021c9:	56                   	push   %esi
+  8021ca:	53                   	push   %ebx
+  8021cb:	83 ec 1c             	sub    $0x1c,%esp
+  8021ce:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8021d1:	89 d6                	mov    %edx,%esi
+  8021d3:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  8021d6:	e8 78 fe ff ff       	call   802053 <pipe_ring>
+  8021db:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  8021de:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  8021e3:	8d 46 04             	lea    0x4(%esi),%eax
+  8021e6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  8021e9:	eb 75                	jmp    802260 <devpipe_write_bulk+0x9b>
+  8021eb:	b8 01 00 00 00       	mov    $0x1,%eax
+  8021f0:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  8021f4:	6a 64                	push   $0x64
+  8021f6:	68 00 00 c0 ee       	push   $0xeec00000
+  8021fb:	53                   	push   %ebx
+  8021fc:	56                   	push   %esi
+  8021fd:	e8 aa ec ff ff       	call   800eac <sys_chan_sleep>
+      continue;
+  802202:	83 c4 10             	add    $0x10,%esp
+  802205:	eb 59                	jmp    802260 <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  802207:	89 d1                	mov    %edx,%ecx
+  802209:	c1 f9 1f             	sar    $0x1f,%ecx
+  80220c:	c1 e9 11             	shr    $0x11,%ecx
+  80220f:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802212:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802217:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  802219:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  80221f:	29 d3                	sub    %edx,%ebx
+  802221:	ba 00 80 00 00       	mov    $0x8000,%edx
+  802226:	29 c2                	sub    %eax,%edx
+  802228:	39 d3                	cmp    %edx,%ebx
+  80222a:	0f 47 da             	cmova  %edx,%ebx
+  80222d:	8b 55 08             	mov    0x8(%ebp),%edx
+  802230:	29 fa                	sub    %edi,%edx
+  802232:	39 d3                	cmp    %edx,%ebx
+  802234:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  802237:	83 ec 04             	sub    $0x4,%esp
+  80223a:	53                   	push   %ebx
+  80223b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80223e:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  802241:	52                   	push   %edx
+  802242:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802245:	01 c8                	add    %ecx,%eax
+  802247:	50                   	push   %eax
+  802248:	e8 df e6 ff ff       	call   80092c <memcpy>
+    i += m;
+  80224d:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  80224f:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802252:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802255:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802258:	e8 57 fe ff ff       	call   8020b4 <pipe_wakeup>
+  80225d:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802260:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802263:	73 2b                	jae    802290 <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  802265:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  802267:	8b 56 04             	mov    0x4(%esi),%edx
+  80226a:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  802270:	39 d0                	cmp    %edx,%eax
+  802272:	7d 93                	jge    802207 <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  802274:	89 f2                	mov    %esi,%edx
+  802276:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802279:	e8 e2 fe ff ff       	call   802160 <_pipeisclosed>
+  80227e:	85 c0                	test   %eax,%eax
+  802280:	0f 84 65 ff ff ff    	je     8021eb <devpipe_write_bulk+0x26>
+        return i;
+  802286:	89 f8                	mov    %edi,%eax
+}
+  802288:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80228b:	5b                   	pop    %ebx
+  80228c:	5e                   	pop    %esi
+  80228d:	5f                   	pop    %edi
+  80228e:	5d                   	pop    %ebp
+  80228f:	c3                   	ret
+  return i;
+  802290:	89 f8                	mov    %edi,%eax
+  802292:	eb f4                	jmp    802288 <devpipe_write_bulk+0xc3>
+
+00802294 <devpipe_write>:
+{
+  802294:	55                   	push   %ebp
+  802295:	89 e5                	mov    %esp,%ebp
+  802297:	57                   	push   %edi
+  802298:	56                   	push   %esi
+  802299:	53                   	push   %ebx
+  80229a:	83 ec 28             	sub    $0x28,%esp
+  80229d:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  8022a0:	56                   	push   %esi
+  8022a1:	e8 8c ed ff ff       	call   801032 <fd2data>
+  8022a6:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  8022a8:	8b 78 28             	mov    0x28(%eax),%edi
+  8022ab:	83 c4 10             	add    $0x10,%esp
+  8022ae:	85 ff                	test   %edi,%edi
+  8022b0:	75 25                	jne    8022d7 <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  8022b2:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8022b5:	74 66                	je     80231d <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8022b7:	8b 43 04             	mov    0x4(%ebx),%eax
+  8022ba:	8b 0b                	mov    (%ebx),%ecx
+  8022bc:	8d 51 20             	lea    0x20(%ecx),%edx
+  8022bf:	39 d0                	cmp    %edx,%eax
+  8022c1:	72 2b                	jb     8022ee <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  8022c3:	89 da                	mov    %ebx,%edx
+  8022c5:	89 f0                	mov    %esi,%eax
+  8022c7:	e8 94 fe ff ff       	call   802160 <_pipeisclosed>
+  8022cc:	85 c0                	test   %eax,%eax
+  8022ce:	75 51                	jne    802321 <devpipe_write+0x8d>
+      sys_yield();
+  8022d0:	e8 3c e8 ff ff       	call   800b11 <sys_yield>
+  8022d5:	eb e0                	jmp    8022b7 <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  8022d7:	83 ec 0c             	sub    $0xc,%esp
+  8022da:	ff 75 10             	push   0x10(%ebp)
+  8022dd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8022e0:	89 c2                	mov    %eax,%edx
+  8022e2:	89 f0                	mov    %esi,%eax
+  8022e4:	e8 dc fe ff ff       	call   8021c5 <devpipe_write_bulk>
+  8022e9:	83 c4 10             	add    $0x10,%esp
+  8022ec:	eb 38                	jmp    802326 <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8022ee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8022f1:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8022f5:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8022f8:	89 c2                	mov    %eax,%edx
+  8022fa:	c1 fa 1f             	sar    $0x1f,%edx
+  8022fd:	89 d1                	mov    %edx,%ecx
+  8022ff:	c1 e9 1b             	shr    $0x1b,%ecx
+  802302:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802305:	83 e2 1f             	and    $0x1f,%edx
+  802308:	29 ca                	sub    %ecx,%edx
+  80230a:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  80230e:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  802312:	83 c0 01             	add    $0x1,%eax
+  802315:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  802318:	83 c7 01             	add    $0x1,%edi
+  80231b:	eb 95                	jmp    8022b2 <devpipe_write+0x1e>
+  return i;
+  80231d:	89 f8                	mov    %edi,%eax
+  80231f:	eb 05                	jmp    802326 <devpipe_write+0x92>
+        return 0;
+  802321:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802326:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802329:	5b                   	pop    %ebx
+  80232a:	5e                   	pop    %esi
+  80232b:	5f                   	pop    %edi
+  80232c:	5d                   	pop    %ebp
+  80232d:	c3                   	ret
+
+0080232e <devpipe_read_bulk>:
+{
+  80232e:	55                   	push   %ebp
+  80232f:	89 e5                	mov    %esp,%ebp
+  802331:	57                   	push   %edi
+  802332:	56                   	push   %esi
+  802333:	53                   	push   %ebx
+  802334:	83 ec 2c             	sub    $0x2c,%esp
+  802337:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80233a:	89 d6                	mov    %edx,%esi
+  80233c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80233f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  802342:	e8 0c fd ff ff       	call   802053 <pipe_ring>
+  802347:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  80234a:	85 db                	test   %ebx,%ebx
+  80234c:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802351:	0f 45 c3             	cmovne %ebx,%eax
+  802354:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802357:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  80235c:	8d 46 30             	lea    0x30(%esi),%eax
+  80235f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  802362:	eb 50                	jmp    8023b4 <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  802364:	89 d1                	mov    %edx,%ecx
+  802366:	c1 f9 1f             	sar    $0x1f,%ecx
+  802369:	c1 e9 11             	shr    $0x11,%ecx
+  80236c:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  80236f:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802374:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  802376:	29 d3                	sub    %edx,%ebx
+  802378:	ba 00 80 00 00       	mov    $0x8000,%edx
+  80237d:	29 c2                	sub    %eax,%edx
+  80237f:	39 d3                	cmp    %edx,%ebx
+  802381:	0f 47 da             	cmova  %edx,%ebx
+  802384:	8b 55 08             	mov    0x8(%ebp),%edx
+  802387:	29 fa                	sub    %edi,%edx
+  802389:	39 d3                	cmp    %edx,%ebx
+  80238b:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  80238e:	83 ec 04             	sub    $0x4,%esp
+  802391:	53                   	push   %ebx
+  802392:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802395:	01 c8                	add    %ecx,%eax
+  802397:	50                   	push   %eax
+  802398:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80239b:	01 f8                	add    %edi,%eax
+  80239d:	50                   	push   %eax
+  80239e:	e8 89 e5 ff ff       	call   80092c <memcpy>
+    i += m;
+  8023a3:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  8023a5:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8023a7:	89 f2                	mov    %esi,%edx
+  8023a9:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8023ac:	e8 03 fd ff ff       	call   8020b4 <pipe_wakeup>
+  8023b1:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  8023b4:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  8023b7:	73 51                	jae    80240a <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  8023b9:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  8023bc:	8b 16                	mov    (%esi),%edx
+  8023be:	39 da                	cmp    %ebx,%edx
+  8023c0:	75 a2                	jne    802364 <devpipe_read_bulk+0x36>
+      if (i > 0)
+  8023c2:	85 ff                	test   %edi,%edi
+  8023c4:	75 44                	jne    80240a <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  8023c6:	89 f2                	mov    %esi,%edx
+  8023c8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8023cb:	e8 90 fd ff ff       	call   802160 <_pipeisclosed>
+  8023d0:	85 c0                	test   %eax,%eax
+  8023d2:	75 3a                	jne    80240e <devpipe_read_bulk+0xe0>
+  8023d4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8023d9:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  8023dd:	6a 64                	push   $0x64
+  8023df:	ff 75 d4             	push   -0x2c(%ebp)
+  8023e2:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  8023e3:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  8023e6:	50                   	push   %eax
+  8023e7:	e8 c0 ea ff ff       	call   800eac <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  8023ec:	85 c0                	test   %eax,%eax
+  8023ee:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023f3:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  8023f6:	83 c4 10             	add    $0x10,%esp
+  8023f9:	a8 01                	test   $0x1,%al
+  8023fb:	74 b7                	je     8023b4 <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  8023fd:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  802402:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802405:	5b                   	pop    %ebx
+  802406:	5e                   	pop    %esi
+  802407:	5f                   	pop    %edi
+  802408:	5d                   	pop    %ebp
+  802409:	c3                   	ret
+  return i;
+  80240a:	89 f8                	mov    %edi,%eax
+  80240c:	eb f4                	jmp    802402 <devpipe_read_bulk+0xd4>
+        return 0;
+  80240e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802413:	eb ed                	jmp    802402 <devpipe_read_bulk+0xd4>
+
+00802415 <devpipe_read>:
+{
+  802415:	55                   	push   %ebp
+  802416:	89 e5                	mov    %esp,%ebp
+  802418:	57                   	push   %edi
+  802419:	56                   	push   %esi
+  80241a:	53                   	push   %ebx
+  80241b:	83 ec 18             	sub    $0x18,%esp
+  80241e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  802421:	57                   	push   %edi
+  802422:	e8 0b ec ff ff       	call   801032 <fd2data>
+  802427:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  802429:	8b 70 28             	mov    0x28(%eax),%esi
+  80242c:	83 c4 10             	add    $0x10,%esp
+  80242f:	85 f6                	test   %esi,%esi
+  802431:	75 24                	jne    802457 <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  802433:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802436:	74 60                	je     802498 <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  802438:	8b 03                	mov    (%ebx),%eax
+  80243a:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80243d:	75 3b                	jne    80247a <devpipe_read+0x65>
+      if (i > 0)
+  80243f:	85 f6                	test   %esi,%esi
+  802441:	75 2d                	jne    802470 <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  802443:	89 da                	mov    %ebx,%edx
+  802445:	89 f8                	mov    %edi,%eax
+  802447:	e8 14 fd ff ff       	call   802160 <_pipeisclosed>
+  80244c:	85 c0                	test   %eax,%eax
+  80244e:	75 4c                	jne    80249c <devpipe_read+0x87>
+      sys_yield();
+  802450:	e8 bc e6 ff ff       	call   800b11 <sys_yield>
+  802455:	eb e1                	jmp    802438 <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  802457:	83 ec 08             	sub    $0x8,%esp
+  80245a:	6a 00                	push   $0x0
+  80245c:	ff 75 10             	push   0x10(%ebp)
+  80245f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802462:	89 c2                	mov    %eax,%edx
+  802464:	89 f8                	mov    %edi,%eax
+  802466:	e8 c3 fe ff ff       	call   80232e <devpipe_read_bulk>
+  80246b:	83 c4 10             	add    $0x10,%esp
+  80246e:	eb 02                	jmp    802472 <devpipe_read+0x5d>
+        return i;
+  802470:	89 f0                	mov    %esi,%eax
+}
+  802472:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802475:	5b                   	pop    %ebx
+  802476:	5e                   	pop    %esi
+  802477:	5f                   	pop    %edi
+  802478:	5d                   	pop    %ebp
+  802479:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80247a:	99                   	cltd
+  80247b:	c1 ea 1b             	shr    $0x1b,%edx
+  80247e:	01 d0                	add    %edx,%eax
+  802480:	83 e0 1f             	and    $0x1f,%eax
+  802483:	29 d0                	sub    %edx,%eax
+  802485:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  80248a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80248d:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  802490:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  802493:	83 c6 01             	add    $0x1,%esi
+  802496:	eb 9b                	jmp    802433 <devpipe_read+0x1e>
+  return i;
+  802498:	89 f0                	mov    %esi,%eax
+  80249a:	eb d6                	jmp    802472 <devpipe_read+0x5d>
+        return 0;
+  80249c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024a1:	eb cf                	jmp    802472 <devpipe_read+0x5d>
+
+008024a3 <pipe2>:
+{
+  8024a3:	55                   	push   %ebp
+  8024a4:	89 e5                	mov    %esp,%ebp
+  8024a6:	57                   	push   %edi
+  8024a7:	56                   	push   %esi
+  8024a8:	53                   	push   %ebx
+  8024a9:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  8024ac:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8024af:	50                   	push   %eax
+  8024b0:	e8 91 eb ff ff       	call   801046 <fd_alloc>
+  8024b5:	89 c3                	mov    %eax,%ebx
+  8024b7:	83 c4 10             	add    $0x10,%esp
+  8024ba:	85 c0                	test   %eax,%eax
+  8024bc:	0f 88 fb 01 00 00    	js     8026bd <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8024c2:	83 ec 04             	sub    $0x4,%esp
+  8024c5:	68 07 04 00 00       	push   $0x407
+  8024ca:	ff 75 e4             	push   -0x1c(%ebp)
+  8024cd:	6a 00                	push   $0x0
+  8024cf:	e8 9f e6 ff ff       	call   800b73 <sys_page_alloc>
+  8024d4:	89 c3                	mov    %eax,%ebx
+  8024d6:	83 c4 10             	add    $0x10,%esp
+  8024d9:	85 c0                	test   %eax,%eax
+  8024db:	0f 88 dc 01 00 00    	js     8026bd <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  8024e1:	83 ec 0c             	sub    $0xc,%esp
+  8024e4:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8024e7:	50                   	push   %eax
+  8024e8:	e8 59 eb ff ff       	call   801046 <fd_alloc>
+  8024ed:	89 c3                	mov    %eax,%ebx
+  8024ef:	83 c4 10             	add    $0x10,%esp
+  8024f2:	85 c0                	test   %eax,%eax
+  8024f4:	0f 88 b3 01 00 00    	js     8026ad <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8024fa:	83 ec 04             	sub    $0x4,%esp
+  8024fd:	68 07 04 00 00       	push   $0x407
+  802502:	ff 75 e0             	push   -0x20(%ebp)
+  802505:	6a 00                	push   $0x0
+  802507:	e8 67 e6 ff ff       	call   800b73 <sys_page_alloc>
+  80250c:	89 c3                	mov    %eax,%ebx
+  80250e:	83 c4 10             	add    $0x10,%esp
+  802511:	85 c0                	test   %eax,%eax
+  802513:	0f 88 94 01 00 00    	js     8026ad <pipe2+0x20a>
+  va = fd2data(fd0);
+  802519:	83 ec 0c             	sub    $0xc,%esp
+  80251c:	ff 75 e4             	push   -0x1c(%ebp)
+  80251f:	e8 0e eb ff ff       	call   801032 <fd2data>
+  802524:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802526:	83 c4 0c             	add    $0xc,%esp
+  802529:	68 07 04 00 00       	push   $0x407
+  80252e:	50                   	push   %eax
+  80252f:	6a 00                	push   $0x0
+  802531:	e8 3d e6 ff ff       	call   800b73 <sys_page_alloc>
+  802536:	89 c3                	mov    %eax,%ebx
+  802538:	83 c4 10             	add    $0x10,%esp
+  80253b:	85 c0                	test   %eax,%eax
+  80253d:	0f 88 5a 01 00 00    	js     80269d <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802543:	83 ec 0c             	sub    $0xc,%esp
+  802546:	ff 75 e0             	push   -0x20(%ebp)
+  802549:	e8 e4 ea ff ff       	call   801032 <fd2data>
+  80254e:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802555:	50                   	push   %eax
+  802556:	6a 00                	push   $0x0
+  802558:	57                   	push   %edi
+  802559:	6a 00                	push   $0x0
+  80255b:	e8 56 e6 ff ff       	call   800bb6 <sys_page_map>
+  802560:	89 c3                	mov    %eax,%ebx
+  802562:	83 c4 20             	add    $0x20,%esp
+  802565:	85 c0                	test   %eax,%eax
+  802567:	0f 88 22 01 00 00    	js     80268f <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  80256d:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  802571:	74 72                	je     8025e5 <pipe2+0x142>
+  802573:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  802578:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80257b:	e8 d3 fa ff ff       	call   802053 <pipe_ring>
+  802580:	83 ec 04             	sub    $0x4,%esp
+  802583:	68 07 04 00 00       	push   $0x407
+  802588:	01 f0                	add    %esi,%eax
+  80258a:	50                   	push   %eax
+  80258b:	6a 00                	push   $0x0
+  80258d:	e8 e1 e5 ff ff       	call   800b73 <sys_page_alloc>
+  802592:	89 c3                	mov    %eax,%ebx
+  802594:	83 c4 10             	add    $0x10,%esp
+  802597:	85 c0                	test   %eax,%eax
+  802599:	0f 88 97 00 00 00    	js     802636 <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  80259f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8025a2:	e8 ac fa ff ff       	call   802053 <pipe_ring>
+  8025a7:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  8025aa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8025ad:	e8 a1 fa ff ff       	call   802053 <pipe_ring>
+  8025b2:	83 ec 0c             	sub    $0xc,%esp
+  8025b5:	68 07 04 00 00       	push   $0x407
+  8025ba:	53                   	push   %ebx
+  8025bb:	6a 00                	push   $0x0
+  8025bd:	01 f0                	add    %esi,%eax
+  8025bf:	50                   	push   %eax
+  8025c0:	6a 00                	push   $0x0
+  8025c2:	e8 ef e5 ff ff       	call   800bb6 <sys_page_map>
+  8025c7:	89 c3                	mov    %eax,%ebx
+  8025c9:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8025cf:	83 c4 20             	add    $0x20,%esp
+  8025d2:	85 c0                	test   %eax,%eax
+  8025d4:	78 60                	js     802636 <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  8025d6:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  8025dc:	75 9a                	jne    802578 <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  8025de:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  8025e5:	a1 20 40 80 00       	mov    0x804020,%eax
+  8025ea:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8025ed:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  8025ef:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8025f2:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  8025f9:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8025fc:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  8025fe:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802601:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  802608:	83 ec 0c             	sub    $0xc,%esp
+  80260b:	ff 75 e4             	push   -0x1c(%ebp)
+  80260e:	e8 0f ea ff ff       	call   801022 <fd2num>
+  802613:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802616:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  802618:	83 c4 04             	add    $0x4,%esp
+  80261b:	ff 75 e0             	push   -0x20(%ebp)
+  80261e:	e8 ff e9 ff ff       	call   801022 <fd2num>
+  802623:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802626:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  802629:	83 c4 10             	add    $0x10,%esp
+  80262c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802631:	e9 87 00 00 00       	jmp    8026bd <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802636:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  80263b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80263e:	e8 10 fa ff ff       	call   802053 <pipe_ring>
+  802643:	83 ec 08             	sub    $0x8,%esp
+  802646:	01 f0                	add    %esi,%eax
+  802648:	50                   	push   %eax
+  802649:	6a 00                	push   $0x0
+  80264b:	e8 a8 e5 ff ff       	call   800bf8 <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  802650:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802653:	e8 fb f9 ff ff       	call   802053 <pipe_ring>
+  802658:	83 c4 08             	add    $0x8,%esp
+  80265b:	01 f0                	add    %esi,%eax
+  80265d:	50                   	push   %eax
+  80265e:	6a 00                	push   $0x0
+  802660:	e8 93 e5 ff ff       	call   800bf8 <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802665:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80266b:	83 c4 10             	add    $0x10,%esp
+  80266e:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802674:	75 c5                	jne    80263b <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  802676:	83 ec 0c             	sub    $0xc,%esp
+  802679:	ff 75 e0             	push   -0x20(%ebp)
+  80267c:	e8 b1 e9 ff ff       	call   801032 <fd2data>
+  802681:	83 c4 08             	add    $0x8,%esp
+  802684:	50                   	push   %eax
+  802685:	6a 00                	push   $0x0
+  802687:	e8 6c e5 ff ff       	call   800bf8 <sys_page_unmap>
+  80268c:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  80268f:	83 ec 08             	sub    $0x8,%esp
+  802692:	57                   	push   %edi
+  802693:	6a 00                	push   $0x0
+  802695:	e8 5e e5 ff ff       	call   800bf8 <sys_page_unmap>
+  80269a:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  80269d:	83 ec 08             	sub    $0x8,%esp
+  8026a0:	ff 75 e0             	push   -0x20(%ebp)
+  8026a3:	6a 00                	push   $0x0
+  8026a5:	e8 4e e5 ff ff       	call   800bf8 <sys_page_unmap>
+  8026aa:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  8026ad:	83 ec 08             	sub    $0x8,%esp
+  8026b0:	ff 75 e4             	push   -0x1c(%ebp)
+  8026b3:	6a 00                	push   $0x0
+  8026b5:	e8 3e e5 ff ff       	call   800bf8 <sys_page_unmap>
+  8026ba:	83 c4 10             	add    $0x10,%esp
+}
+  8026bd:	89 d8                	mov    %ebx,%eax
+  8026bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026c2:	5b                   	pop    %ebx
+  8026c3:	5e                   	pop    %esi
+  8026c4:	5f                   	pop    %edi
+  8026c5:	5d                   	pop    %ebp
+  8026c6:	c3                   	ret
+
+008026c7 <pipe>:
+{
+  8026c7:	55                   	push   %ebp
+  8026c8:	89 e5                	mov    %esp,%ebp
+  8026ca:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  8026cd:	6a 00                	push   $0x0
+  8026cf:	ff 75 08             	push   0x8(%ebp)
+  8026d2:	e8 cc fd ff ff       	call   8024a3 <pipe2>
+}
+  8026d7:	c9                   	leave
+  8026d8:	c3                   	ret
+
+008026d9 <pipeisclosed>:
+{
+  8026d9:	55                   	push   %ebp
+  8026da:	89 e5                	mov    %esp,%ebp
+  8026dc:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8026df:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026e2:	50                   	push   %eax
+  8026e3:	ff 75 08             	push   0x8(%ebp)
+  8026e6:	e8 b1 e9 ff ff       	call   80109c <fd_lookup>
+  8026eb:	83 c4 10             	add    $0x10,%esp
+  8026ee:	85 c0                	test   %eax,%eax
+  8026f0:	78 18                	js     80270a <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  8026f2:	83 ec 0c             	sub    $0xc,%esp
+  8026f5:	ff 75 f4             	push   -0xc(%ebp)
+  8026f8:	e8 35 e9 ff ff       	call   801032 <fd2data>
+  8026fd:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  8026ff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802702:	e8 59 fa ff ff       	call   802160 <_pipeisclosed>
+  802707:	83 c4 10             	add    $0x10,%esp
+}
+  80270a:	c9                   	leave
+  80270b:	c3                   	ret
+
+0080270c <pipe_splice>:
+{
+  80270c:	55                   	push   %ebp
+  80270d:	89 e5                	mov    %esp,%ebp
+  80270f:	57                   	push   %edi
+  802710:	56                   	push   %esi
+  802711:	53                   	push   %ebx
+  802712:	83 ec 34             	sub    $0x34,%esp
+  802715:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802718:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80271b:	50                   	push   %eax
+  80271c:	ff 75 08             	push   0x8(%ebp)
+  80271f:	e8 78 e9 ff ff       	call   80109c <fd_lookup>
+  802724:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802727:	83 c4 10             	add    $0x10,%esp
+  80272a:	85 c0                	test   %eax,%eax
+  80272c:	0f 88 d7 00 00 00    	js     802809 <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  802732:	83 ec 0c             	sub    $0xc,%esp
+  802735:	ff 75 e4             	push   -0x1c(%ebp)
+  802738:	e8 f5 e8 ff ff       	call   801032 <fd2data>
+  80273d:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  80273f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802742:	83 c4 10             	add    $0x10,%esp
+  802745:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  80274b:	39 10                	cmp    %edx,(%eax)
+  80274d:	0f 85 c1 00 00 00    	jne    802814 <pipe_splice+0x108>
+  802753:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  802757:	0f 84 c0 00 00 00    	je     80281d <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  80275d:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802761:	0f 84 bf 00 00 00    	je     802826 <pipe_splice+0x11a>
+  802767:	89 f7                	mov    %esi,%edi
+  802769:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  80276f:	0f 85 ba 00 00 00    	jne    80282f <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802775:	8d 43 04             	lea    0x4(%ebx),%eax
+  802778:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80277b:	eb 38                	jmp    8027b5 <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  80277d:	83 ec 0c             	sub    $0xc,%esp
+  802780:	68 00 10 00 00       	push   $0x1000
+  802785:	89 f1                	mov    %esi,%ecx
+  802787:	89 da                	mov    %ebx,%edx
+  802789:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80278c:	e8 34 fa ff ff       	call   8021c5 <devpipe_write_bulk>
+  802791:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802794:	83 c4 10             	add    $0x10,%esp
+  802797:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80279c:	75 53                	jne    8027f1 <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  80279e:	83 ec 08             	sub    $0x8,%esp
+  8027a1:	56                   	push   %esi
+  8027a2:	6a 00                	push   $0x0
+  8027a4:	e8 4f e4 ff ff       	call   800bf8 <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  8027a9:	83 c7 01             	add    $0x1,%edi
+  8027ac:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8027b2:	83 c4 10             	add    $0x10,%esp
+  8027b5:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8027b8:	74 3a                	je     8027f4 <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  8027ba:	8b 03                	mov    (%ebx),%eax
+  8027bc:	39 43 04             	cmp    %eax,0x4(%ebx)
+  8027bf:	75 bc                	jne    80277d <pipe_splice+0x71>
+  8027c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027c6:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  8027ca:	85 c0                	test   %eax,%eax
+  8027cc:	74 af                	je     80277d <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  8027ce:	83 ec 04             	sub    $0x4,%esp
+  8027d1:	6a 07                	push   $0x7
+  8027d3:	56                   	push   %esi
+  8027d4:	ff 75 d0             	push   -0x30(%ebp)
+  8027d7:	e8 f3 e6 ff ff       	call   800ecf <sys_chan_wakeup>
+  8027dc:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8027df:	83 c4 10             	add    $0x10,%esp
+  8027e2:	85 c0                	test   %eax,%eax
+  8027e4:	79 b8                	jns    80279e <pipe_splice+0x92>
+  8027e6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8027eb:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  8027ef:	eb 8c                	jmp    80277d <pipe_splice+0x71>
+  8027f1:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  8027f4:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8027f8:	75 06                	jne    802800 <pipe_splice+0xf4>
+  8027fa:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  8027fe:	78 09                	js     802809 <pipe_splice+0xfd>
+  return i * PGSIZE;
+  802800:	8b 45 10             	mov    0x10(%ebp),%eax
+  802803:	c1 e0 0c             	shl    $0xc,%eax
+  802806:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  802809:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80280c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80280f:	5b                   	pop    %ebx
+  802810:	5e                   	pop    %esi
+  802811:	5f                   	pop    %edi
+  802812:	5d                   	pop    %ebp
+  802813:	c3                   	ret
+    return -E_INVAL;
+  802814:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  80281b:	eb ec                	jmp    802809 <pipe_splice+0xfd>
+  80281d:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802824:	eb e3                	jmp    802809 <pipe_splice+0xfd>
+  802826:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  80282d:	eb da                	jmp    802809 <pipe_splice+0xfd>
+  80282f:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802836:	eb d1                	jmp    802809 <pipe_splice+0xfd>
+
+00802838 <pipe_splice_read>:
+{
+  802838:	55                   	push   %ebp
+  802839:	89 e5                	mov    %esp,%ebp
+  80283b:	53                   	push   %ebx
+  80283c:	83 ec 1c             	sub    $0x1c,%esp
+  80283f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802842:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802845:	50                   	push   %eax
+  802846:	ff 75 08             	push   0x8(%ebp)
+  802849:	e8 4e e8 ff ff       	call   80109c <fd_lookup>
+  80284e:	83 c4 10             	add    $0x10,%esp
+  802851:	85 c0                	test   %eax,%eax
+  802853:	78 49                	js     80289e <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  802855:	83 ec 0c             	sub    $0xc,%esp
+  802858:	ff 75 f4             	push   -0xc(%ebp)
+  80285b:	e8 d2 e7 ff ff       	call   801032 <fd2data>
+  802860:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802862:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802865:	83 c4 10             	add    $0x10,%esp
+  802868:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  80286e:	39 08                	cmp    %ecx,(%eax)
+  802870:	75 31                	jne    8028a3 <pipe_splice_read+0x6b>
+  802872:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  802876:	74 32                	je     8028aa <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  802878:	8b 48 08             	mov    0x8(%eax),%ecx
+  80287b:	83 e1 03             	and    $0x3,%ecx
+  80287e:	83 f9 01             	cmp    $0x1,%ecx
+  802881:	74 2e                	je     8028b1 <pipe_splice_read+0x79>
+  802883:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  802889:	75 2d                	jne    8028b8 <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  80288b:	83 ec 08             	sub    $0x8,%esp
+  80288e:	53                   	push   %ebx
+  80288f:	68 00 10 00 00       	push   $0x1000
+  802894:	89 d9                	mov    %ebx,%ecx
+  802896:	e8 93 fa ff ff       	call   80232e <devpipe_read_bulk>
+  80289b:	83 c4 10             	add    $0x10,%esp
+}
+  80289e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028a1:	c9                   	leave
+  8028a2:	c3                   	ret
+    return -E_INVAL;
+  8028a3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028a8:	eb f4                	jmp    80289e <pipe_splice_read+0x66>
+  8028aa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028af:	eb ed                	jmp    80289e <pipe_splice_read+0x66>
+  8028b1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028b6:	eb e6                	jmp    80289e <pipe_splice_read+0x66>
+  8028b8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028bd:	eb df                	jmp    80289e <pipe_splice_read+0x66>
+
+008028bf <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  8028bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028c4:	c3                   	ret
+
+008028c5 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8028c5:	55                   	push   %ebp
+  8028c6:	89 e5                	mov    %esp,%ebp
+  8028c8:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  8028cb:	68 c7 32 80 00       	push   $0x8032c7
+  8028d0:	ff 75 0c             	push   0xc(%ebp)
+  8028d3:	e8 6c de ff ff       	call   800744 <strcpy>
+  return 0;
+}
+  8028d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028dd:	c9                   	leave
+  8028de:	c3                   	ret
+
+008028df <devcons_write>:
+{
+  8028df:	55                   	push   %ebp
+  8028e0:	89 e5                	mov    %esp,%ebp
+  8028e2:	57                   	push   %edi
+  8028e3:	56                   	push   %esi
+  8028e4:	53                   	push   %ebx
+  8028e5:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  8028eb:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  8028f0:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  8028f6:	eb 2e                	jmp    802926 <devcons_write+0x47>
+    m = n - tot;
+  8028f8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8028fb:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  8028fd:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802902:	39 c3                	cmp    %eax,%ebx
+  802904:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  802907:	83 ec 04             	sub    $0x4,%esp
+  80290a:	53                   	push   %ebx
+  80290b:	89 f0                	mov    %esi,%eax
+  80290d:	03 45 0c             	add    0xc(%ebp),%eax
+  802910:	50                   	push   %eax
+  802911:	57                   	push   %edi
+  802912:	e8 b3 df ff ff       	call   8008ca <memmove>
+    sys_cputs(buf, m);
+  802917:	83 c4 08             	add    $0x8,%esp
+  80291a:	53                   	push   %ebx
+  80291b:	57                   	push   %edi
+  80291c:	e8 53 e1 ff ff       	call   800a74 <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  802921:	01 de                	add    %ebx,%esi
+  802923:	83 c4 10             	add    $0x10,%esp
+  802926:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802929:	72 cd                	jb     8028f8 <devcons_write+0x19>
+}
+  80292b:	89 f0                	mov    %esi,%eax
+  80292d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802930:	5b                   	pop    %ebx
+  802931:	5e                   	pop    %esi
+  802932:	5f                   	pop    %edi
+  802933:	5d                   	pop    %ebp
+  802934:	c3                   	ret
+
+00802935 <devcons_read>:
+{
+  802935:	55                   	push   %ebp
+  802936:	89 e5                	mov    %esp,%ebp
+  802938:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  80293b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802940:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802944:	75 07                	jne    80294d <devcons_read+0x18>
+  802946:	eb 1f                	jmp    802967 <devcons_read+0x32>
+    sys_yield();
+  802948:	e8 c4 e1 ff ff       	call   800b11 <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  80294d:	e8 40 e1 ff ff       	call   800a92 <sys_cgetc>
+  802952:	85 c0                	test   %eax,%eax
+  802954:	74 f2                	je     802948 <devcons_read+0x13>
+  if (c < 0)
+  802956:	78 0f                	js     802967 <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  802958:	83 f8 04             	cmp    $0x4,%eax
+  80295b:	74 0c                	je     802969 <devcons_read+0x34>
+  *(char*)vbuf = c;
+  80295d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802960:	88 02                	mov    %al,(%edx)
+  return 1;
+  802962:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802967:	c9                   	leave
+  802968:	c3                   	ret
+    return 0;
+  802969:	b8 00 00 00 00       	mov    $0x0,%eax
+  80296e:	eb f7                	jmp    802967 <devcons_read+0x32>
+
+00802970 <cputchar>:
+{
+  802970:	55                   	push   %ebp
+  802971:	89 e5                	mov    %esp,%ebp
+  802973:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  802976:	8b 45 08             	mov    0x8(%ebp),%eax
+  802979:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  80297c:	6a 01                	push   $0x1
+  80297e:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802981:	50                   	push   %eax
+  802982:	e8 ed e0 ff ff       	call   800a74 <sys_cputs>
+}
+  802987:	83 c4 10             	add    $0x10,%esp
+  80298a:	c9                   	leave
+  80298b:	c3                   	ret
+
+0080298c <getchar>:
+{
+  80298c:	55                   	push   %ebp
+  80298d:	89 e5                	mov    %esp,%ebp
+  80298f:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  802992:	6a 01                	push   $0x1
+  802994:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802997:	50                   	push   %eax
+  802998:	6a 00                	push   $0x0
+  80299a:	e8 a8 e9 ff ff       	call   801347 <read>
+  if (r < 0)
+  80299f:	83 c4 10             	add    $0x10,%esp
+  8029a2:	85 c0                	test   %eax,%eax
+  8029a4:	78 06                	js     8029ac <getchar+0x20>
+  if (r < 1)
+  8029a6:	74 06                	je     8029ae <getchar+0x22>
+  return c;
+  8029a8:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8029ac:	c9                   	leave
+  8029ad:	c3                   	ret
+    return -E_EOF;
+  8029ae:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8029b3:	eb f7                	jmp    8029ac <getchar+0x20>
+
+008029b5 <iscons>:
+{
+  8029b5:	55                   	push   %ebp
+  8029b6:	89 e5                	mov    %esp,%ebp
+  8029b8:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8029bb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8029be:	50                   	push   %eax
+  8029bf:	ff 75 08             	push   0x8(%ebp)
+  8029c2:	e8 d5 e6 ff ff       	call   80109c <fd_lookup>
+  8029c7:	83 c4 10             	add    $0x10,%esp
+  8029ca:	85 c0                	test   %eax,%eax
+  8029cc:	78 11                	js     8029df <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  8029ce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029d1:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  8029d7:	39 10                	cmp    %edx,(%eax)
+  8029d9:	0f 94 c0             	sete   %al
+  8029dc:	0f b6 c0             	movzbl %al,%eax
+}
+  8029df:	c9                   	leave
+  8029e0:	c3                   	ret
+
+008029e1 <opencons>:
+{
+  8029e1:	55                   	push   %ebp
+  8029e2:	89 e5                	mov    %esp,%ebp
+  8029e4:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  8029e7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8029ea:	50                   	push   %eax
+  8029eb:	e8 56 e6 ff ff       	call   801046 <fd_alloc>
+  8029f0:	83 c4 10             	add    $0x10,%esp
+  8029f3:	85 c0                	test   %eax,%eax
+  8029f5:	78 3a                	js     802a31 <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8029f7:	83 ec 04             	sub    $0x4,%esp
+  8029fa:	68 07 04 00 00       	push   $0x407
+  8029ff:	ff 75 f4             	push   -0xc(%ebp)
+  802a02:	6a 00                	push   $0x0
+  802a04:	e8 6a e1 ff ff       	call   800b73 <sys_page_alloc>
+  802a09:	83 c4 10             	add    $0x10,%esp
+  802a0c:	85 c0                	test   %eax,%eax
+  802a0e:	78 21                	js     802a31 <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  802a10:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a13:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802a19:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  802a1b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a1e:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  802a25:	83 ec 0c             	sub    $0xc,%esp
+  802a28:	50                   	push   %eax
+  802a29:	e8 f4 e5 ff ff       	call   801022 <fd2num>
+  802a2e:	83 c4 10             	add    $0x10,%esp
+}
+  802a31:	c9                   	leave
+  802a32:	c3                   	ret
+
+00802a33 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  802a33:	55                   	push   %ebp
+  802a34:	89 e5                	mov    %esp,%ebp
+  802a36:	56                   	push   %esi
+  802a37:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  802a38:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  802a3b:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  802a41:	e8 ac e0 ff ff       	call   800af2 <sys_getenvid>
+  802a46:	83 ec 0c             	sub    $0xc,%esp
+  802a49:	ff 75 0c             	push   0xc(%ebp)
+  802a4c:	ff 75 08             	push   0x8(%ebp)
+  802a4f:	56                   	push   %esi
+  802a50:	50                   	push   %eax
+  802a51:	68 d4 32 80 00       	push   $0x8032d4
+  802a56:	e8 fb d6 ff ff       	call   800156 <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  802a5b:	83 c4 18             	add    $0x18,%esp
+  802a5e:	53                   	push   %ebx
+  802a5f:	ff 75 10             	push   0x10(%ebp)
+  802a62:	e8 9e d6 ff ff       	call   800105 <vcprintf>
+  cprintf("\n");
+  802a67:	c7 04 24 6c 2e 80 00 	movl   $0x802e6c,(%esp)
+  802a6e:	e8 e3 d6 ff ff       	call   800156 <cprintf>
+  802a73:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  802a76:	cc                   	int3
+  while (1)
+  802a77:	eb fd                	jmp    802a76 <_panic+0x43>
+
+00802a79 <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  802a79:	55                   	push   %ebp
+  802a7a:	89 e5                	mov    %esp,%ebp
+  802a7c:	57                   	push   %edi
+  802a7d:	56                   	push   %esi
+  802a7e:	53                   	push   %ebx
+  802a7f:	83 ec 14             	sub    $0x14,%esp
+  802a82:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802a85:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a88:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802a8b:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  802a8e:	85 c0                	test   %eax,%eax
+  802a90:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802a95:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  802a98:	ff 33                	push   (%ebx)
+  802a9a:	50                   	push   %eax
+  802a9b:	e8 ab e3 ff ff       	call   800e4b <sys_ipc_recv>
+  802aa0:	83 c4 10             	add    $0x10,%esp
+  802aa3:	85 c0                	test   %eax,%eax
+  802aa5:	78 39                	js     802ae0 <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  802aa7:	85 ff                	test   %edi,%edi
+  802aa9:	74 0a                	je     802ab5 <ipc_recv_pages+0x3c>
+  802aab:	a1 48 57 80 00       	mov    0x805748,%eax
+  802ab0:	8b 40 7c             	mov    0x7c(%eax),%eax
+  802ab3:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  802ab5:	85 f6                	test   %esi,%esi
+  802ab7:	74 0d                	je     802ac6 <ipc_recv_pages+0x4d>
+  802ab9:	a1 48 57 80 00       	mov    0x805748,%eax
+  802abe:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  802ac4:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  802ac6:	a1 48 57 80 00       	mov    0x805748,%eax
+  802acb:	8b 40 74             	mov    0x74(%eax),%eax
+  802ace:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  802ad0:	a1 48 57 80 00       	mov    0x805748,%eax
+  802ad5:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  802ad8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802adb:	5b                   	pop    %ebx
+  802adc:	5e                   	pop    %esi
+  802add:	5f                   	pop    %edi
+  802ade:	5d                   	pop    %ebp
+  802adf:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  802ae0:	85 ff                	test   %edi,%edi
+  802ae2:	74 06                	je     802aea <ipc_recv_pages+0x71>
+  802ae4:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  802aea:	85 f6                	test   %esi,%esi
+  802aec:	74 06                	je     802af4 <ipc_recv_pages+0x7b>
+  802aee:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  802af4:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  802afa:	eb dc                	jmp    802ad8 <ipc_recv_pages+0x5f>
+
+00802afc <ipc_recv>:
+{
+  802afc:	55                   	push   %ebp
+  802afd:	89 e5                	mov    %esp,%ebp
+  802aff:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  802b02:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  802b09:	ff 75 10             	push   0x10(%ebp)
+  802b0c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b0f:	50                   	push   %eax
+  802b10:	ff 75 0c             	push   0xc(%ebp)
+  802b13:	ff 75 08             	push   0x8(%ebp)
+  802b16:	e8 5e ff ff ff       	call   802a79 <ipc_recv_pages>
+}
+  802b1b:	c9                   	leave
+  802b1c:	c3                   	ret
+
+00802b1d <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  802b1d:	55                   	push   %ebp
+  802b1e:	89 e5                	mov    %esp,%ebp
+  802b20:	57                   	push   %edi
+  802b21:	56                   	push   %esi
+  802b22:	53                   	push   %ebx
+  802b23:	83 ec 0c             	sub    $0xc,%esp
+  802b26:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802b29:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802b2c:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  802b2f:	89 c3                	mov    %eax,%ebx
+  802b31:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  802b37:	85 c0                	test   %eax,%eax
+  802b39:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802b3e:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  802b41:	83 ec 0c             	sub    $0xc,%esp
+  802b44:	ff 75 14             	push   0x14(%ebp)
+  802b47:	ff 75 18             	push   0x18(%ebp)
+  802b4a:	53                   	push   %ebx
+  802b4b:	56                   	push   %esi
+  802b4c:	57                   	push   %edi
+  802b4d:	e8 d8 e2 ff ff       	call   800e2a <sys_ipc_try_send>
+  802b52:	83 c4 20             	add    $0x20,%esp
+  802b55:	85 c0                	test   %eax,%eax
+  802b57:	79 1e                	jns    802b77 <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  802b59:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802b5c:	75 07                	jne    802b65 <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  802b5e:	e8 ae df ff ff       	call   800b11 <sys_yield>
+  802b63:	eb dc                	jmp    802b41 <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  802b65:	50                   	push   %eax
+  802b66:	68 f7 32 80 00       	push   $0x8032f7
+  802b6b:	6a 5c                	push   $0x5c
+  802b6d:	68 04 33 80 00       	push   $0x803304
+  802b72:	e8 bc fe ff ff       	call   802a33 <_panic>
+  }
+}
+  802b77:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b7a:	5b                   	pop    %ebx
+  802b7b:	5e                   	pop    %esi
+  802b7c:	5f                   	pop    %edi
+  802b7d:	5d                   	pop    %ebp
+  802b7e:	c3                   	ret
+
+00802b7f <ipc_send>:
+{
+  802b7f:	55                   	push   %ebp
+  802b80:	89 e5                	mov    %esp,%ebp
+  802b82:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  802b85:	ff 75 14             	push   0x14(%ebp)
+  802b88:	6a 01                	push   $0x1
+  802b8a:	ff 75 10             	push   0x10(%ebp)
+  802b8d:	ff 75 0c             	push   0xc(%ebp)
+  802b90:	ff 75 08             	push   0x8(%ebp)
+  802b93:	e8 85 ff ff ff       	call   802b1d <ipc_send_pages>
+}
+  802b98:	83 c4 20             	add    $0x20,%esp
+  802b9b:	c9                   	leave
+  802b9c:	c3                   	ret
+
+00802b9d <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802b9d:	55                   	push   %ebp
+  802b9e:	89 e5                	mov    %esp,%ebp
+  802ba0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  802ba3:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  802ba8:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802bab:	c1 e0 04             	shl    $0x4,%eax
+  802bae:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802bb3:	8b 40 50             	mov    0x50(%eax),%eax
+  802bb6:	39 c8                	cmp    %ecx,%eax
+  802bb8:	74 12                	je     802bcc <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  802bba:	83 c2 01             	add    $0x1,%edx
+  802bbd:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802bc3:	75 e3                	jne    802ba8 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  802bc5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bca:	eb 0e                	jmp    802bda <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  802bcc:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802bcf:	c1 e0 04             	shl    $0x4,%eax
+  802bd2:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802bd7:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802bda:	5d                   	pop    %ebp
+  802bdb:	c3                   	ret
+
+00802bdc <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802bdc:	55                   	push   %ebp
+  802bdd:	89 e5                	mov    %esp,%ebp
+  802bdf:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802be2:	89 c2                	mov    %eax,%edx
+  802be4:	c1 ea 16             	shr    $0x16,%edx
+  802be7:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  802bee:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802bf3:	f6 c1 01             	test   $0x1,%cl
+  802bf6:	74 1c                	je     802c14 <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  802bf8:	c1 e8 0c             	shr    $0xc,%eax
+  802bfb:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  802c02:	a8 01                	test   $0x1,%al
+  802c04:	74 0e                	je     802c14 <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  802c06:	c1 e8 0c             	shr    $0xc,%eax
+  802c09:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802c10:	ef 
+  802c11:	0f b7 d2             	movzwl %dx,%edx
+}
+  802c14:	89 d0                	mov    %edx,%eax
+  802c16:	5d                   	pop    %ebp
+  802c17:	c3                   	ret
+
+00802c18 <udivmod>:
+  802c18:	55                   	push   %ebp
+  802c19:	57                   	push   %edi
+  802c1a:	56                   	push   %esi
+  802c1b:	53                   	push   %ebx
+  802c1c:	83 ec 14             	sub    $0x14,%esp
+  802c1f:	8b 74 24 28          	mov    0x28(%esp),%esi
+  802c23:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  802c27:	89 fb                	mov    %edi,%ebx
+  802c29:	09 f3                	or     %esi,%ebx
+  802c2b:	0f 84 88 00 00 00    	je     802cb9 <udivmod+0xa1>
+  802c31:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802c36:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802c3d:	00 
+  802c3e:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802c45:	00 
+  802c46:	89 cd                	mov    %ecx,%ebp
+  802c48:	89 34 24             	mov    %esi,(%esp)
+  802c4b:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802c4f:	eb 08                	jmp    802c59 <udivmod+0x41>
+  802c51:	83 ed 01             	sub    $0x1,%ebp
+  802c54:	83 fd ff             	cmp    $0xffffffff,%ebp
+  802c57:	74 6c                	je     802cc5 <udivmod+0xad>
+  802c59:	89 c3                	mov    %eax,%ebx
+  802c5b:	89 d6                	mov    %edx,%esi
+  802c5d:	89 e9                	mov    %ebp,%ecx
+  802c5f:	0f ad f3             	shrd   %cl,%esi,%ebx
+  802c62:	d3 ee                	shr    %cl,%esi
+  802c64:	f6 c1 20             	test   $0x20,%cl
+  802c67:	74 04                	je     802c6d <udivmod+0x55>
+  802c69:	89 f3                	mov    %esi,%ebx
+  802c6b:	31 f6                	xor    %esi,%esi
+  802c6d:	8b 3c 24             	mov    (%esp),%edi
+  802c70:	39 fb                	cmp    %edi,%ebx
+  802c72:	89 f7                	mov    %esi,%edi
+  802c74:	8b 1c 24             	mov    (%esp),%ebx
+  802c77:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802c7b:	19 f7                	sbb    %esi,%edi
+  802c7d:	72 d2                	jb     802c51 <udivmod+0x39>
+  802c7f:	89 f7                	mov    %esi,%edi
+  802c81:	89 de                	mov    %ebx,%esi
+  802c83:	89 e9                	mov    %ebp,%ecx
+  802c85:	0f a5 f7             	shld   %cl,%esi,%edi
+  802c88:	d3 e6                	shl    %cl,%esi
+  802c8a:	f6 c1 20             	test   $0x20,%cl
+  802c8d:	74 04                	je     802c93 <udivmod+0x7b>
+  802c8f:	89 f7                	mov    %esi,%edi
+  802c91:	31 f6                	xor    %esi,%esi
+  802c93:	29 f0                	sub    %esi,%eax
+  802c95:	19 fa                	sbb    %edi,%edx
+  802c97:	be 01 00 00 00       	mov    $0x1,%esi
+  802c9c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ca1:	0f a5 f7             	shld   %cl,%esi,%edi
+  802ca4:	d3 e6                	shl    %cl,%esi
+  802ca6:	f6 c1 20             	test   $0x20,%cl
+  802ca9:	74 04                	je     802caf <udivmod+0x97>
+  802cab:	89 f7                	mov    %esi,%edi
+  802cad:	31 f6                	xor    %esi,%esi
+  802caf:	09 74 24 08          	or     %esi,0x8(%esp)
+  802cb3:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802cb7:	eb 98                	jmp    802c51 <udivmod+0x39>
+  802cb9:	89 f0                	mov    %esi,%eax
+  802cbb:	89 fa                	mov    %edi,%edx
+  802cbd:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802cc1:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802cc5:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802cc9:	89 01                	mov    %eax,(%ecx)
+  802ccb:	89 51 04             	mov    %edx,0x4(%ecx)
+  802cce:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802cd2:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802cd6:	83 c4 14             	add    $0x14,%esp
+  802cd9:	5b                   	pop    %ebx
+  802cda:	5e                   	pop    %esi
+  802cdb:	5f                   	pop    %edi
+  802cdc:	5d                   	pop    %ebp
+  802cdd:	c3                   	ret
+
+00802cde <__udivdi3>:
+  802cde:	83 ec 18             	sub    $0x18,%esp
+  802ce1:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802ce5:	50                   	push   %eax
+  802ce6:	ff 74 24 2c          	push   0x2c(%esp)
+  802cea:	ff 74 24 2c          	push   0x2c(%esp)
+  802cee:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802cf2:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802cf6:	e8 1d ff ff ff       	call   802c18 <udivmod>
+  802cfb:	83 c4 24             	add    $0x24,%esp
+  802cfe:	c3                   	ret
+
+00802cff <__umoddi3>:
+  802cff:	83 ec 18             	sub    $0x18,%esp
+  802d02:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802d06:	50                   	push   %eax
+  802d07:	ff 74 24 2c          	push   0x2c(%esp)
+  802d0b:	ff 74 24 2c          	push   0x2c(%esp)
+  802d0f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802d13:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802d17:	e8 fc fe ff ff       	call   802c18 <udivmod>
+  802d1c:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802d20:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802d24:	83 c4 24             	add    $0x24,%esp
+  802d27:	c3                   	ret
+
+00802d28 <__divdi3>:
+  802d28:	56                   	push   %esi
+  802d29:	53                   	push   %ebx
+  802d2a:	83 ec 14             	sub    $0x14,%esp
+  802d2d:	8b 44 24 20          	mov    0x20(%esp),%eax
+  802d31:	8b 54 24 24          	mov    0x24(%esp),%edx
+  802d35:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  802d39:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  802d3d:	85 d2                	test   %edx,%edx
+  802d3f:	78 18                	js     802d59 <__divdi3+0x31>
+  802d41:	85 db                	test   %ebx,%ebx
+  802d43:	78 3e                	js     802d83 <__divdi3+0x5b>
+  802d45:	83 ec 04             	sub    $0x4,%esp
+  802d48:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802d4c:	56                   	push   %esi
+  802d4d:	53                   	push   %ebx
+  802d4e:	51                   	push   %ecx
+  802d4f:	e8 c4 fe ff ff       	call   802c18 <udivmod>
+  802d54:	83 c4 10             	add    $0x10,%esp
+  802d57:	eb 24                	jmp    802d7d <__divdi3+0x55>
+  802d59:	f7 d8                	neg    %eax
+  802d5b:	83 d2 00             	adc    $0x0,%edx
+  802d5e:	f7 da                	neg    %edx
+  802d60:	85 db                	test   %ebx,%ebx
+  802d62:	78 3a                	js     802d9e <__divdi3+0x76>
+  802d64:	83 ec 04             	sub    $0x4,%esp
+  802d67:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802d6b:	56                   	push   %esi
+  802d6c:	53                   	push   %ebx
+  802d6d:	51                   	push   %ecx
+  802d6e:	e8 a5 fe ff ff       	call   802c18 <udivmod>
+  802d73:	83 c4 10             	add    $0x10,%esp
+  802d76:	f7 d8                	neg    %eax
+  802d78:	83 d2 00             	adc    $0x0,%edx
+  802d7b:	f7 da                	neg    %edx
+  802d7d:	83 c4 14             	add    $0x14,%esp
+  802d80:	5b                   	pop    %ebx
+  802d81:	5e                   	pop    %esi
+  802d82:	c3                   	ret
+  802d83:	83 ec 04             	sub    $0x4,%esp
+  802d86:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802d8a:	56                   	push   %esi
+  802d8b:	f7 d9                	neg    %ecx
+  802d8d:	83 d3 00             	adc    $0x0,%ebx
+  802d90:	f7 db                	neg    %ebx
+  802d92:	53                   	push   %ebx
+  802d93:	51                   	push   %ecx
+  802d94:	e8 7f fe ff ff       	call   802c18 <udivmod>
+  802d99:	83 c4 10             	add    $0x10,%esp
+  802d9c:	eb d8                	jmp    802d76 <__divdi3+0x4e>
+  802d9e:	83 ec 04             	sub    $0x4,%esp
+  802da1:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802da5:	56                   	push   %esi
+  802da6:	f7 d9                	neg    %ecx
+  802da8:	83 d3 00             	adc    $0x0,%ebx
+  802dab:	f7 db                	neg    %ebx
+  802dad:	53                   	push   %ebx
+  802dae:	51                   	push   %ecx
+  802daf:	e8 64 fe ff ff       	call   802c18 <udivmod>
+  802db4:	83 c4 10             	add    $0x10,%esp
+  802db7:	eb c4                	jmp    802d7d <__divdi3+0x55>
+
+00802db9 <__moddi3>:
+  802db9:	55                   	push   %ebp
+  802dba:	57                   	push   %edi
+  802dbb:	56                   	push   %esi
+  802dbc:	53                   	push   %ebx
+  802dbd:	83 ec 24             	sub    $0x24,%esp
+  802dc0:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802dc4:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802dc8:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  802dcc:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  802dd0:	85 d2                	test   %edx,%edx
+  802dd2:	78 3b                	js     802e0f <__moddi3+0x56>
+  802dd4:	83 ec 04             	sub    $0x4,%esp
+  802dd7:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  802ddb:	56                   	push   %esi
+  802ddc:	89 ce                	mov    %ecx,%esi
+  802dde:	f7 de                	neg    %esi
+  802de0:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802de4:	89 de                	mov    %ebx,%esi
+  802de6:	83 d6 00             	adc    $0x0,%esi
+  802de9:	f7 de                	neg    %esi
+  802deb:	89 74 24 14          	mov    %esi,0x14(%esp)
+  802def:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802df3:	0f 48 f1             	cmovs  %ecx,%esi
+  802df6:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  802dfb:	53                   	push   %ebx
+  802dfc:	56                   	push   %esi
+  802dfd:	e8 16 fe ff ff       	call   802c18 <udivmod>
+  802e02:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802e06:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802e0a:	83 c4 10             	add    $0x10,%esp
+  802e0d:	eb 47                	jmp    802e56 <__moddi3+0x9d>
+  802e0f:	f7 d8                	neg    %eax
+  802e11:	83 d2 00             	adc    $0x0,%edx
+  802e14:	f7 da                	neg    %edx
+  802e16:	83 ec 04             	sub    $0x4,%esp
+  802e19:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  802e1d:	56                   	push   %esi
+  802e1e:	89 cf                	mov    %ecx,%edi
+  802e20:	f7 df                	neg    %edi
+  802e22:	89 de                	mov    %ebx,%esi
+  802e24:	83 d6 00             	adc    $0x0,%esi
+  802e27:	f7 de                	neg    %esi
+  802e29:	0f 49 cf             	cmovns %edi,%ecx
+  802e2c:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802e30:	0f 49 de             	cmovns %esi,%ebx
+  802e33:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  802e37:	ff 74 24 0c          	push   0xc(%esp)
+  802e3b:	ff 74 24 0c          	push   0xc(%esp)
+  802e3f:	e8 d4 fd ff ff       	call   802c18 <udivmod>
+  802e44:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802e48:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802e4c:	f7 d8                	neg    %eax
+  802e4e:	83 d2 00             	adc    $0x0,%edx
+  802e51:	f7 da                	neg    %edx
+  802e53:	83 c4 10             	add    $0x10,%esp
+  802e56:	83 c4 24             	add    $0x24,%esp
+  802e59:	5b                   	pop    %ebx
+  802e5a:	5e                   	pop    %esi
+  802e5b:	5f                   	pop    %edi
+  802e5c:	5d                   	pop    %ebp
+  802e5d:	c3                   	ret
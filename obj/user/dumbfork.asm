@@ -0,0 +1,6566 @@
+
+obj/user/dumbfork.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 9d 01 00 00       	call   8001ce <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <duppage>:
+  }
+}
+
+void
+duppage(envid_t dstenv, void *addr)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	8b 75 08             	mov    0x8(%ebp),%esi
+  80003b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+
+  // This is NOT what you should do in your fork.
+  if ((r = sys_page_alloc(dstenv, addr, PTE_P|PTE_U|PTE_W)) < 0)
+  80003e:	83 ec 04             	sub    $0x4,%esp
+  800041:	6a 07                	push   $0x7
+  800043:	53                   	push   %ebx
+  800044:	56                   	push   %esi
+  800045:	e8 e9 0c 00 00       	call   800d33 <sys_page_alloc>
+  80004a:	83 c4 10             	add    $0x10,%esp
+  80004d:	85 c0                	test   %eax,%eax
+  80004f:	78 4a                	js     80009b <duppage+0x68>
+    panic("sys_page_alloc: %e", r);
+  if ((r = sys_page_map(dstenv, addr, 0, UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  800051:	83 ec 0c             	sub    $0xc,%esp
+  800054:	6a 07                	push   $0x7
+  800056:	68 00 00 40 00       	push   $0x400000
+  80005b:	6a 00                	push   $0x0
+  80005d:	53                   	push   %ebx
+  80005e:	56                   	push   %esi
+  80005f:	e8 12 0d 00 00       	call   800d76 <sys_page_map>
+  800064:	83 c4 20             	add    $0x20,%esp
+  800067:	85 c0                	test   %eax,%eax
+  800069:	78 42                	js     8000ad <duppage+0x7a>
+    panic("sys_page_map: %e", r);
+  memmove(UTEMP, addr, PGSIZE);
+  80006b:	83 ec 04             	sub    $0x4,%esp
+  80006e:	68 00 10 00 00       	push   $0x1000
+  800073:	53                   	push   %ebx
+  800074:	68 00 00 40 00       	push   $0x400000
+  800079:	e8 0c 0a 00 00       	call   800a8a <memmove>
+  if ((r = sys_page_unmap(0, UTEMP)) < 0)
+  80007e:	83 c4 08             	add    $0x8,%esp
+  800081:	68 00 00 40 00       	push   $0x400000
+  800086:	6a 00                	push   $0x0
+  800088:	e8 2b 0d 00 00       	call   800db8 <sys_page_unmap>
+  80008d:	83 c4 10             	add    $0x10,%esp
+  800090:	85 c0                	test   %eax,%eax
+  800092:	78 2b                	js     8000bf <duppage+0x8c>
+    panic("sys_page_unmap: %e", r);
+}
+  800094:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800097:	5b                   	pop    %ebx
+  800098:	5e                   	pop    %esi
+  800099:	5d                   	pop    %ebp
+  80009a:	c3                   	ret
+    panic("sys_page_alloc: %e", r);
+  80009b:	50                   	push   %eax
+  80009c:	68 e0 2f 80 00       	push   $0x802fe0
+  8000a1:	6a 20                	push   $0x20
+  8000a3:	68 f3 2f 80 00       	push   $0x802ff3
+  8000a8:	e8 8e 01 00 00       	call   80023b <_panic>
+    panic("sys_page_map: %e", r);
+  8000ad:	50                   	push   %eax
+  8000ae:	68 03 30 80 00       	push   $0x803003
+  8000b3:	6a 22                	push   $0x22
+  8000b5:	68 f3 2f 80 00       	push   $0x802ff3
+  8000ba:	e8 7c 01 00 00       	call   80023b <_panic>
+    panic("sys_page_unmap: %e", r);
+  8000bf:	50                   	push   %eax
+  8000c0:	68 14 30 80 00       	push   $0x803014
+  8000c5:	6a 25                	push   $0x25
+  8000c7:	68 f3 2f 80 00       	push   $0x802ff3
+  8000cc:	e8 6a 01 00 00       	call   80023b <_panic>
+
+008000d1 <dumbfork>:
+
+envid_t
+dumbfork(void)
+{
+  8000d1:	55                   	push   %ebp
+  8000d2:	89 e5                	mov    %esp,%ebp
+  8000d4:	53                   	push   %ebx
+  8000d5:	83 ec 14             	sub    $0x14,%esp
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+  envid_t ret;
+  __asm __volatile("int %2"
+  8000d8:	b8 07 00 00 00       	mov    $0x7,%eax
+  8000dd:	cd 30                	int    $0x30
+  8000df:	89 c3                	mov    %eax,%ebx
+  // The kernel will initialize it with a copy of our register state,
+  // so that the child will appear to have called sys_exofork() too -
+  // except that in the child, this "fake" call to sys_exofork()
+  // will return 0 instead of the envid of the child.
+  envid = sys_exofork();
+  if (envid < 0)
+  8000e1:	85 c0                	test   %eax,%eax
+  8000e3:	78 23                	js     800108 <dumbfork+0x37>
+    panic("sys_exofork: %e", envid);
+  if (envid == 0) {
+  8000e5:	ba 00 00 80 00       	mov    $0x800000,%edx
+  8000ea:	75 44                	jne    800130 <dumbfork+0x5f>
+    // The copied value of the global variable 'thisenv'
+    // is no longer valid (it refers to the parent!).
+    // Fix it and return 0.
+    //
+    // Commenting out for Lab 4 Challenge
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8000ec:	e8 c1 0b 00 00       	call   800cb2 <sys_getenvid>
+  8000f1:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000f6:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8000f9:	c1 e0 04             	shl    $0x4,%eax
+  8000fc:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800101:	a3 44 57 80 00       	mov    %eax,0x805744
+    return 0;
+  800106:	eb 57                	jmp    80015f <dumbfork+0x8e>
+    panic("sys_exofork: %e", envid);
+  800108:	50                   	push   %eax
+  800109:	68 27 30 80 00       	push   $0x803027
+  80010e:	6a 37                	push   $0x37
+  800110:	68 f3 2f 80 00       	push   $0x802ff3
+  800115:	e8 21 01 00 00       	call   80023b <_panic>
+
+  // We're the parent.
+  // Eagerly copy our entire address space into the child.
+  // This is NOT what you should do in your fork implementation.
+  for (addr = (uint8_t*)UTEXT; addr < end; addr += PGSIZE)
+    duppage(envid, addr);
+  80011a:	83 ec 08             	sub    $0x8,%esp
+  80011d:	52                   	push   %edx
+  80011e:	53                   	push   %ebx
+  80011f:	e8 0f ff ff ff       	call   800033 <duppage>
+  for (addr = (uint8_t*)UTEXT; addr < end; addr += PGSIZE)
+  800124:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800127:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80012d:	83 c4 10             	add    $0x10,%esp
+  800130:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  800133:	81 fa 00 70 80 00    	cmp    $0x807000,%edx
+  800139:	72 df                	jb     80011a <dumbfork+0x49>
+
+  // Also copy the stack we are currently running on.
+  duppage(envid, ROUNDDOWN(&addr, PGSIZE));
+  80013b:	83 ec 08             	sub    $0x8,%esp
+  80013e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800141:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800146:	50                   	push   %eax
+  800147:	53                   	push   %ebx
+  800148:	e8 e6 fe ff ff       	call   800033 <duppage>
+
+  // Start the child environment running
+  if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  80014d:	83 c4 08             	add    $0x8,%esp
+  800150:	6a 02                	push   $0x2
+  800152:	53                   	push   %ebx
+  800153:	e8 cc 0d 00 00       	call   800f24 <sys_env_set_status>
+  800158:	83 c4 10             	add    $0x10,%esp
+  80015b:	85 c0                	test   %eax,%eax
+  80015d:	78 07                	js     800166 <dumbfork+0x95>
+    panic("sys_env_set_status: %e", r);
+
+  return envid;
+}
+  80015f:	89 d8                	mov    %ebx,%eax
+  800161:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800164:	c9                   	leave
+  800165:	c3                   	ret
+    panic("sys_env_set_status: %e", r);
+  800166:	50                   	push   %eax
+  800167:	68 37 30 80 00       	push   $0x803037
+  80016c:	6a 4e                	push   $0x4e
+  80016e:	68 f3 2f 80 00       	push   $0x802ff3
+  800173:	e8 c3 00 00 00       	call   80023b <_panic>
+
+00800178 <umain>:
+{
+  800178:	55                   	push   %ebp
+  800179:	89 e5                	mov    %esp,%ebp
+  80017b:	57                   	push   %edi
+  80017c:	56                   	push   %esi
+  80017d:	53                   	push   %ebx
+  80017e:	83 ec 0c             	sub    $0xc,%esp
+  who = dumbfork();
+  800181:	e8 4b ff ff ff       	call   8000d1 <dumbfork>
+  800186:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < (who ? 10 : 20); i++) {
+  800188:	85 c0                	test   %eax,%eax
+  80018a:	bf 4e 30 80 00       	mov    $0x80304e,%edi
+  80018f:	b8 55 30 80 00       	mov    $0x803055,%eax
+  800194:	0f 44 f8             	cmove  %eax,%edi
+  800197:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80019c:	eb 1f                	jmp    8001bd <umain+0x45>
+  80019e:	83 fb 13             	cmp    $0x13,%ebx
+  8001a1:	7f 23                	jg     8001c6 <umain+0x4e>
+    cprintf("%d: I am the %s!\n", i, who ? "parent" : "child");
+  8001a3:	83 ec 04             	sub    $0x4,%esp
+  8001a6:	57                   	push   %edi
+  8001a7:	53                   	push   %ebx
+  8001a8:	68 5b 30 80 00       	push   $0x80305b
+  8001ad:	e8 64 01 00 00       	call   800316 <cprintf>
+    sys_yield();
+  8001b2:	e8 1a 0b 00 00       	call   800cd1 <sys_yield>
+  for (i = 0; i < (who ? 10 : 20); i++) {
+  8001b7:	83 c3 01             	add    $0x1,%ebx
+  8001ba:	83 c4 10             	add    $0x10,%esp
+  8001bd:	85 f6                	test   %esi,%esi
+  8001bf:	74 dd                	je     80019e <umain+0x26>
+  8001c1:	83 fb 09             	cmp    $0x9,%ebx
+  8001c4:	7e dd                	jle    8001a3 <umain+0x2b>
+}
+  8001c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001c9:	5b                   	pop    %ebx
+  8001ca:	5e                   	pop    %esi
+  8001cb:	5f                   	pop    %edi
+  8001cc:	5d                   	pop    %ebp
+  8001cd:	c3                   	ret
+
+008001ce <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8001ce:	55                   	push   %ebp
+  8001cf:	89 e5                	mov    %esp,%ebp
+  8001d1:	56                   	push   %esi
+  8001d2:	53                   	push   %ebx
+  8001d3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8001d6:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  8001d9:	c7 05 44 57 80 00 00 	movl   $0x0,0x805744
+  8001e0:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  8001e3:	e8 ca 0a 00 00       	call   800cb2 <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  8001e8:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001ed:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8001f0:	c1 e0 04             	shl    $0x4,%eax
+  8001f3:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8001f8:	a3 44 57 80 00       	mov    %eax,0x805744
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8001fd:	85 db                	test   %ebx,%ebx
+  8001ff:	7e 07                	jle    800208 <libmain+0x3a>
+    binaryname = argv[0];
+  800201:	8b 06                	mov    (%esi),%eax
+  800203:	a3 00 40 80 00       	mov    %eax,0x804000
+
+  // call user main routine
+  umain(argc, argv);
+  800208:	83 ec 08             	sub    $0x8,%esp
+  80020b:	56                   	push   %esi
+  80020c:	53                   	push   %ebx
+  80020d:	e8 66 ff ff ff       	call   800178 <umain>
+
+  // exit gracefully
+  exit();
+  800212:	e8 0a 00 00 00       	call   800221 <exit>
+}
+  800217:	83 c4 10             	add    $0x10,%esp
+  80021a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80021d:	5b                   	pop    %ebx
+  80021e:	5e                   	pop    %esi
+  80021f:	5d                   	pop    %ebp
+  800220:	c3                   	ret
+
+00800221 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800221:	55                   	push   %ebp
+  800222:	89 e5                	mov    %esp,%ebp
+  800224:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  800227:	e8 80 11 00 00       	call   8013ac <close_all>
+  sys_env_destroy(0);
+  80022c:	83 ec 0c             	sub    $0xc,%esp
+  80022f:	6a 00                	push   $0x0
+  800231:	e8 3b 0a 00 00       	call   800c71 <sys_env_destroy>
+}
+  800236:	83 c4 10             	add    $0x10,%esp
+  800239:	c9                   	leave
+  80023a:	c3                   	ret
+
+0080023b <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80023b:	55                   	push   %ebp
+  80023c:	89 e5                	mov    %esp,%ebp
+  80023e:	56                   	push   %esi
+  80023f:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  800240:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  800243:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  800249:	e8 64 0a 00 00       	call   800cb2 <sys_getenvid>
+  80024e:	83 ec 0c             	sub    $0xc,%esp
+  800251:	ff 75 0c             	push   0xc(%ebp)
+  800254:	ff 75 08             	push   0x8(%ebp)
+  800257:	56                   	push   %esi
+  800258:	50                   	push   %eax
+  800259:	68 78 30 80 00       	push   $0x803078
+  80025e:	e8 b3 00 00 00       	call   800316 <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  800263:	83 c4 18             	add    $0x18,%esp
+  800266:	53                   	push   %ebx
+  800267:	ff 75 10             	push   0x10(%ebp)
+  80026a:	e8 56 00 00 00       	call   8002c5 <vcprintf>
+  cprintf("\n");
+  80026f:	c7 04 24 6b 30 80 00 	movl   $0x80306b,(%esp)
+  800276:	e8 9b 00 00 00       	call   800316 <cprintf>
+  80027b:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  80027e:	cc                   	int3
+  while (1)
+  80027f:	eb fd                	jmp    80027e <_panic+0x43>
+
+00800281 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800281:	55                   	push   %ebp
+  800282:	89 e5                	mov    %esp,%ebp
+  800284:	53                   	push   %ebx
+  800285:	83 ec 04             	sub    $0x4,%esp
+  800288:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  80028b:	8b 13                	mov    (%ebx),%edx
+  80028d:	8d 42 01             	lea    0x1(%edx),%eax
+  800290:	89 03                	mov    %eax,(%ebx)
+  800292:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800295:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  800299:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80029e:	74 09                	je     8002a9 <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  8002a0:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8002a4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8002a7:	c9                   	leave
+  8002a8:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  8002a9:	83 ec 08             	sub    $0x8,%esp
+  8002ac:	68 ff 00 00 00       	push   $0xff
+  8002b1:	8d 43 08             	lea    0x8(%ebx),%eax
+  8002b4:	50                   	push   %eax
+  8002b5:	e8 7a 09 00 00       	call   800c34 <sys_cputs>
+    b->idx = 0;
+  8002ba:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8002c0:	83 c4 10             	add    $0x10,%esp
+  8002c3:	eb db                	jmp    8002a0 <putch+0x1f>
+
+008002c5 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8002c5:	55                   	push   %ebp
+  8002c6:	89 e5                	mov    %esp,%ebp
+  8002c8:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  8002ce:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8002d5:	00 00 00 
+  b.cnt = 0;
+  8002d8:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8002df:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  8002e2:	ff 75 0c             	push   0xc(%ebp)
+  8002e5:	ff 75 08             	push   0x8(%ebp)
+  8002e8:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8002ee:	50                   	push   %eax
+  8002ef:	68 81 02 80 00       	push   $0x800281
+  8002f4:	e8 14 01 00 00       	call   80040d <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  8002f9:	83 c4 08             	add    $0x8,%esp
+  8002fc:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800302:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800308:	50                   	push   %eax
+  800309:	e8 26 09 00 00       	call   800c34 <sys_cputs>
+
+  return b.cnt;
+}
+  80030e:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800314:	c9                   	leave
+  800315:	c3                   	ret
+
+00800316 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800316:	55                   	push   %ebp
+  800317:	89 e5                	mov    %esp,%ebp
+  800319:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  80031c:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  80031f:	50                   	push   %eax
+  800320:	ff 75 08             	push   0x8(%ebp)
+  800323:	e8 9d ff ff ff       	call   8002c5 <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  800328:	c9                   	leave
+  800329:	c3                   	ret
+
+0080032a <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  80032a:	55                   	push   %ebp
+  80032b:	89 e5                	mov    %esp,%ebp
+  80032d:	57                   	push   %edi
+  80032e:	56                   	push   %esi
+  80032f:	53                   	push   %ebx
+  800330:	83 ec 1c             	sub    $0x1c,%esp
+  800333:	89 c7                	mov    %eax,%edi
+  800335:	89 d6                	mov    %edx,%esi
+  800337:	8b 45 08             	mov    0x8(%ebp),%eax
+  80033a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80033d:	89 d1                	mov    %edx,%ecx
+  80033f:	89 c2                	mov    %eax,%edx
+  800341:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800344:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800347:	8b 45 10             	mov    0x10(%ebp),%eax
+  80034a:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  80034d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800350:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800357:	39 c2                	cmp    %eax,%edx
+  800359:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80035c:	72 3e                	jb     80039c <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  80035e:	83 ec 0c             	sub    $0xc,%esp
+  800361:	ff 75 18             	push   0x18(%ebp)
+  800364:	83 eb 01             	sub    $0x1,%ebx
+  800367:	53                   	push   %ebx
+  800368:	50                   	push   %eax
+  800369:	83 ec 08             	sub    $0x8,%esp
+  80036c:	ff 75 e4             	push   -0x1c(%ebp)
+  80036f:	ff 75 e0             	push   -0x20(%ebp)
+  800372:	ff 75 dc             	push   -0x24(%ebp)
+  800375:	ff 75 d8             	push   -0x28(%ebp)
+  800378:	e8 db 2a 00 00       	call   802e58 <__udivdi3>
+  80037d:	83 c4 18             	add    $0x18,%esp
+  800380:	52                   	push   %edx
+  800381:	50                   	push   %eax
+  800382:	89 f2                	mov    %esi,%edx
+  800384:	89 f8                	mov    %edi,%eax
+  800386:	e8 9f ff ff ff       	call   80032a <printnum>
+  80038b:	83 c4 20             	add    $0x20,%esp
+  80038e:	eb 13                	jmp    8003a3 <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  800390:	83 ec 08             	sub    $0x8,%esp
+  800393:	56                   	push   %esi
+  800394:	ff 75 18             	push   0x18(%ebp)
+  800397:	ff d7                	call   *%edi
+  800399:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  80039c:	83 eb 01             	sub    $0x1,%ebx
+  80039f:	85 db                	test   %ebx,%ebx
+  8003a1:	7f ed                	jg     800390 <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  8003a3:	83 ec 08             	sub    $0x8,%esp
+  8003a6:	56                   	push   %esi
+  8003a7:	83 ec 04             	sub    $0x4,%esp
+  8003aa:	ff 75 e4             	push   -0x1c(%ebp)
+  8003ad:	ff 75 e0             	push   -0x20(%ebp)
+  8003b0:	ff 75 dc             	push   -0x24(%ebp)
+  8003b3:	ff 75 d8             	push   -0x28(%ebp)
+  8003b6:	e8 be 2a 00 00       	call   802e79 <__umoddi3>
+  8003bb:	83 c4 14             	add    $0x14,%esp
+  8003be:	0f be 80 9b 30 80 00 	movsbl 0x80309b(%eax),%eax
+  8003c5:	50                   	push   %eax
+  8003c6:	ff d7                	call   *%edi
+}
+  8003c8:	83 c4 10             	add    $0x10,%esp
+  8003cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003ce:	5b                   	pop    %ebx
+  8003cf:	5e                   	pop    %esi
+  8003d0:	5f                   	pop    %edi
+  8003d1:	5d                   	pop    %ebp
+  8003d2:	c3                   	ret
+
+008003d3 <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8003d3:	55                   	push   %ebp
+  8003d4:	89 e5                	mov    %esp,%ebp
+  8003d6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  8003d9:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  8003dd:	8b 10                	mov    (%eax),%edx
+  8003df:	3b 50 04             	cmp    0x4(%eax),%edx
+  8003e2:	73 0a                	jae    8003ee <sprintputch+0x1b>
+    *b->buf++ = ch;
+  8003e4:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8003e7:	89 08                	mov    %ecx,(%eax)
+  8003e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003ec:	88 02                	mov    %al,(%edx)
+}
+  8003ee:	5d                   	pop    %ebp
+  8003ef:	c3                   	ret
+
+008003f0 <printfmt>:
+{
+  8003f0:	55                   	push   %ebp
+  8003f1:	89 e5                	mov    %esp,%ebp
+  8003f3:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  8003f6:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  8003f9:	50                   	push   %eax
+  8003fa:	ff 75 10             	push   0x10(%ebp)
+  8003fd:	ff 75 0c             	push   0xc(%ebp)
+  800400:	ff 75 08             	push   0x8(%ebp)
+  800403:	e8 05 00 00 00       	call   80040d <vprintfmt>
+}
+  800408:	83 c4 10             	add    $0x10,%esp
+  80040b:	c9                   	leave
+  80040c:	c3                   	ret
+
+0080040d <vprintfmt>:
+{
+  80040d:	55                   	push   %ebp
+  80040e:	89 e5                	mov    %esp,%ebp
+  800410:	57                   	push   %edi
+  800411:	56                   	push   %esi
+  800412:	53                   	push   %ebx
+  800413:	83 ec 2c             	sub    $0x2c,%esp
+  800416:	8b 75 08             	mov    0x8(%ebp),%esi
+  800419:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80041c:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80041f:	eb 0a                	jmp    80042b <vprintfmt+0x1e>
+      putch(ch, putdat);
+  800421:	83 ec 08             	sub    $0x8,%esp
+  800424:	53                   	push   %ebx
+  800425:	50                   	push   %eax
+  800426:	ff d6                	call   *%esi
+  800428:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  80042b:	83 c7 01             	add    $0x1,%edi
+  80042e:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800432:	83 f8 25             	cmp    $0x25,%eax
+  800435:	74 0c                	je     800443 <vprintfmt+0x36>
+      if (ch == '\0')
+  800437:	85 c0                	test   %eax,%eax
+  800439:	75 e6                	jne    800421 <vprintfmt+0x14>
+}
+  80043b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80043e:	5b                   	pop    %ebx
+  80043f:	5e                   	pop    %esi
+  800440:	5f                   	pop    %edi
+  800441:	5d                   	pop    %ebp
+  800442:	c3                   	ret
+    padc = ' ';
+  800443:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  800447:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  80044e:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  800455:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  80045c:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  800461:	8d 47 01             	lea    0x1(%edi),%eax
+  800464:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800467:	0f b6 17             	movzbl (%edi),%edx
+  80046a:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80046d:	3c 55                	cmp    $0x55,%al
+  80046f:	0f 87 cf 03 00 00    	ja     800844 <vprintfmt+0x437>
+  800475:	0f b6 c0             	movzbl %al,%eax
+  800478:	ff 24 85 e0 31 80 00 	jmp    *0x8031e0(,%eax,4)
+  80047f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  800482:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800486:	eb d9                	jmp    800461 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  800488:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80048b:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80048f:	eb d0                	jmp    800461 <vprintfmt+0x54>
+  800491:	0f b6 d2             	movzbl %dl,%edx
+  800494:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  800497:	b8 00 00 00 00       	mov    $0x0,%eax
+  80049c:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  80049f:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8004a2:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  8004a6:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  8004a9:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8004ac:	83 f9 09             	cmp    $0x9,%ecx
+  8004af:	77 55                	ja     800506 <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  8004b1:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  8004b4:	eb e9                	jmp    80049f <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  8004b6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004b9:	8b 00                	mov    (%eax),%eax
+  8004bb:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004be:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004c1:	8d 40 04             	lea    0x4(%eax),%eax
+  8004c4:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  8004c7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  8004ca:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004ce:	79 91                	jns    800461 <vprintfmt+0x54>
+        width = precision, precision = -1;
+  8004d0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004d3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004d6:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8004dd:	eb 82                	jmp    800461 <vprintfmt+0x54>
+      if (width < 0)
+  8004df:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004e2:	85 d2                	test   %edx,%edx
+  8004e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004e9:	0f 49 c2             	cmovns %edx,%eax
+  8004ec:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  8004ef:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  8004f2:	e9 6a ff ff ff       	jmp    800461 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  8004f7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  8004fa:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  800501:	e9 5b ff ff ff       	jmp    800461 <vprintfmt+0x54>
+  800506:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800509:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80050c:	eb bc                	jmp    8004ca <vprintfmt+0xbd>
+      lflag++;
+  80050e:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  800511:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  800514:	e9 48 ff ff ff       	jmp    800461 <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  800519:	8b 45 14             	mov    0x14(%ebp),%eax
+  80051c:	8d 78 04             	lea    0x4(%eax),%edi
+  80051f:	83 ec 08             	sub    $0x8,%esp
+  800522:	53                   	push   %ebx
+  800523:	ff 30                	push   (%eax)
+  800525:	ff d6                	call   *%esi
+      break;
+  800527:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  80052a:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  80052d:	e9 b1 02 00 00       	jmp    8007e3 <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  800532:	8b 45 14             	mov    0x14(%ebp),%eax
+  800535:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  800538:	8b 10                	mov    (%eax),%edx
+  80053a:	89 d0                	mov    %edx,%eax
+  80053c:	f7 d8                	neg    %eax
+  80053e:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800541:	83 f8 10             	cmp    $0x10,%eax
+  800544:	7f 23                	jg     800569 <vprintfmt+0x15c>
+  800546:	8b 14 85 40 33 80 00 	mov    0x803340(,%eax,4),%edx
+  80054d:	85 d2                	test   %edx,%edx
+  80054f:	74 18                	je     800569 <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  800551:	52                   	push   %edx
+  800552:	68 8a 34 80 00       	push   $0x80348a
+  800557:	53                   	push   %ebx
+  800558:	56                   	push   %esi
+  800559:	e8 92 fe ff ff       	call   8003f0 <printfmt>
+  80055e:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  800561:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800564:	e9 7a 02 00 00       	jmp    8007e3 <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  800569:	50                   	push   %eax
+  80056a:	68 b3 30 80 00       	push   $0x8030b3
+  80056f:	53                   	push   %ebx
+  800570:	56                   	push   %esi
+  800571:	e8 7a fe ff ff       	call   8003f0 <printfmt>
+  800576:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  800579:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  80057c:	e9 62 02 00 00       	jmp    8007e3 <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  800581:	8b 45 14             	mov    0x14(%ebp),%eax
+  800584:	83 c0 04             	add    $0x4,%eax
+  800587:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80058a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80058d:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  80058f:	85 c9                	test   %ecx,%ecx
+  800591:	b8 ac 30 80 00       	mov    $0x8030ac,%eax
+  800596:	0f 45 c1             	cmovne %ecx,%eax
+  800599:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  80059c:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8005a0:	7e 06                	jle    8005a8 <vprintfmt+0x19b>
+  8005a2:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8005a6:	75 0b                	jne    8005b3 <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8005a8:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8005ab:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8005ae:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005b1:	eb 5c                	jmp    80060f <vprintfmt+0x202>
+  8005b3:	83 ec 08             	sub    $0x8,%esp
+  8005b6:	ff 75 d0             	push   -0x30(%ebp)
+  8005b9:	ff 75 cc             	push   -0x34(%ebp)
+  8005bc:	e8 20 03 00 00       	call   8008e1 <strnlen>
+  8005c1:	89 c2                	mov    %eax,%edx
+  8005c3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005c6:	29 d0                	sub    %edx,%eax
+  8005c8:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  8005cb:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8005cf:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005d2:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005d5:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8005d7:	eb 0e                	jmp    8005e7 <vprintfmt+0x1da>
+          putch(padc, putdat);
+  8005d9:	83 ec 08             	sub    $0x8,%esp
+  8005dc:	53                   	push   %ebx
+  8005dd:	57                   	push   %edi
+  8005de:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8005e1:	83 ee 01             	sub    $0x1,%esi
+  8005e4:	83 c4 10             	add    $0x10,%esp
+  8005e7:	85 f6                	test   %esi,%esi
+  8005e9:	7f ee                	jg     8005d9 <vprintfmt+0x1cc>
+  8005eb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005ee:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005f1:	85 c0                	test   %eax,%eax
+  8005f3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005f8:	0f 49 d0             	cmovns %eax,%edx
+  8005fb:	29 d0                	sub    %edx,%eax
+  8005fd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800600:	eb a6                	jmp    8005a8 <vprintfmt+0x19b>
+          putch(ch, putdat);
+  800602:	83 ec 08             	sub    $0x8,%esp
+  800605:	53                   	push   %ebx
+  800606:	52                   	push   %edx
+  800607:	ff 55 08             	call   *0x8(%ebp)
+  80060a:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80060d:	89 f1                	mov    %esi,%ecx
+  80060f:	8d 71 01             	lea    0x1(%ecx),%esi
+  800612:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800616:	0f be d0             	movsbl %al,%edx
+  800619:	85 d2                	test   %edx,%edx
+  80061b:	74 28                	je     800645 <vprintfmt+0x238>
+  80061d:	85 ff                	test   %edi,%edi
+  80061f:	78 05                	js     800626 <vprintfmt+0x219>
+  800621:	83 ef 01             	sub    $0x1,%edi
+  800624:	78 30                	js     800656 <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  800626:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80062a:	74 d6                	je     800602 <vprintfmt+0x1f5>
+  80062c:	0f be c0             	movsbl %al,%eax
+  80062f:	83 e8 20             	sub    $0x20,%eax
+  800632:	83 f8 5e             	cmp    $0x5e,%eax
+  800635:	76 cb                	jbe    800602 <vprintfmt+0x1f5>
+          putch('?', putdat);
+  800637:	83 ec 08             	sub    $0x8,%esp
+  80063a:	53                   	push   %ebx
+  80063b:	6a 3f                	push   $0x3f
+  80063d:	ff 55 08             	call   *0x8(%ebp)
+  800640:	83 c4 10             	add    $0x10,%esp
+  800643:	eb c8                	jmp    80060d <vprintfmt+0x200>
+  800645:	8b 75 08             	mov    0x8(%ebp),%esi
+  800648:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80064b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80064e:	01 d0                	add    %edx,%eax
+  800650:	29 c8                	sub    %ecx,%eax
+  800652:	89 c7                	mov    %eax,%edi
+  800654:	eb 13                	jmp    800669 <vprintfmt+0x25c>
+  800656:	8b 75 08             	mov    0x8(%ebp),%esi
+  800659:	eb ed                	jmp    800648 <vprintfmt+0x23b>
+        putch(' ', putdat);
+  80065b:	83 ec 08             	sub    $0x8,%esp
+  80065e:	53                   	push   %ebx
+  80065f:	6a 20                	push   $0x20
+  800661:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  800663:	83 ef 01             	sub    $0x1,%edi
+  800666:	83 c4 10             	add    $0x10,%esp
+  800669:	85 ff                	test   %edi,%edi
+  80066b:	7f ee                	jg     80065b <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  80066d:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800670:	89 45 14             	mov    %eax,0x14(%ebp)
+  800673:	e9 6b 01 00 00       	jmp    8007e3 <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  800678:	83 f9 01             	cmp    $0x1,%ecx
+  80067b:	7f 1f                	jg     80069c <vprintfmt+0x28f>
+  else if (lflag)
+  80067d:	85 c9                	test   %ecx,%ecx
+  80067f:	74 67                	je     8006e8 <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  800681:	8b 45 14             	mov    0x14(%ebp),%eax
+  800684:	8b 00                	mov    (%eax),%eax
+  800686:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800689:	89 c1                	mov    %eax,%ecx
+  80068b:	c1 f9 1f             	sar    $0x1f,%ecx
+  80068e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800691:	8b 45 14             	mov    0x14(%ebp),%eax
+  800694:	8d 40 04             	lea    0x4(%eax),%eax
+  800697:	89 45 14             	mov    %eax,0x14(%ebp)
+  80069a:	eb 17                	jmp    8006b3 <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  80069c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069f:	8b 50 04             	mov    0x4(%eax),%edx
+  8006a2:	8b 00                	mov    (%eax),%eax
+  8006a4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006a7:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8006aa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ad:	8d 40 08             	lea    0x8(%eax),%eax
+  8006b0:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  8006b3:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006b6:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  8006b9:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  8006be:	85 c9                	test   %ecx,%ecx
+  8006c0:	0f 89 03 01 00 00    	jns    8007c9 <vprintfmt+0x3bc>
+        putch('-', putdat);
+  8006c6:	83 ec 08             	sub    $0x8,%esp
+  8006c9:	53                   	push   %ebx
+  8006ca:	6a 2d                	push   $0x2d
+  8006cc:	ff d6                	call   *%esi
+        num = -(long long)num;
+  8006ce:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006d1:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8006d4:	f7 da                	neg    %edx
+  8006d6:	83 d1 00             	adc    $0x0,%ecx
+  8006d9:	f7 d9                	neg    %ecx
+  8006db:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  8006de:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8006e3:	e9 e1 00 00 00       	jmp    8007c9 <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  8006e8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006eb:	8b 00                	mov    (%eax),%eax
+  8006ed:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006f0:	89 c1                	mov    %eax,%ecx
+  8006f2:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006f5:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006f8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006fb:	8d 40 04             	lea    0x4(%eax),%eax
+  8006fe:	89 45 14             	mov    %eax,0x14(%ebp)
+  800701:	eb b0                	jmp    8006b3 <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  800703:	83 f9 01             	cmp    $0x1,%ecx
+  800706:	7f 1e                	jg     800726 <vprintfmt+0x319>
+  else if (lflag)
+  800708:	85 c9                	test   %ecx,%ecx
+  80070a:	74 32                	je     80073e <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  80070c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80070f:	8b 10                	mov    (%eax),%edx
+  800711:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800716:	8d 40 04             	lea    0x4(%eax),%eax
+  800719:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  80071c:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  800721:	e9 a3 00 00 00       	jmp    8007c9 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800726:	8b 45 14             	mov    0x14(%ebp),%eax
+  800729:	8b 10                	mov    (%eax),%edx
+  80072b:	8b 48 04             	mov    0x4(%eax),%ecx
+  80072e:	8d 40 08             	lea    0x8(%eax),%eax
+  800731:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800734:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  800739:	e9 8b 00 00 00       	jmp    8007c9 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  80073e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800741:	8b 10                	mov    (%eax),%edx
+  800743:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800748:	8d 40 04             	lea    0x4(%eax),%eax
+  80074b:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  80074e:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  800753:	eb 74                	jmp    8007c9 <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  800755:	83 f9 01             	cmp    $0x1,%ecx
+  800758:	7f 1b                	jg     800775 <vprintfmt+0x368>
+  else if (lflag)
+  80075a:	85 c9                	test   %ecx,%ecx
+  80075c:	74 2c                	je     80078a <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  80075e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800761:	8b 10                	mov    (%eax),%edx
+  800763:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800768:	8d 40 04             	lea    0x4(%eax),%eax
+  80076b:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  80076e:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  800773:	eb 54                	jmp    8007c9 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800775:	8b 45 14             	mov    0x14(%ebp),%eax
+  800778:	8b 10                	mov    (%eax),%edx
+  80077a:	8b 48 04             	mov    0x4(%eax),%ecx
+  80077d:	8d 40 08             	lea    0x8(%eax),%eax
+  800780:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800783:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  800788:	eb 3f                	jmp    8007c9 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  80078a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80078d:	8b 10                	mov    (%eax),%edx
+  80078f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800794:	8d 40 04             	lea    0x4(%eax),%eax
+  800797:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  80079a:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  80079f:	eb 28                	jmp    8007c9 <vprintfmt+0x3bc>
+      putch('0', putdat);
+  8007a1:	83 ec 08             	sub    $0x8,%esp
+  8007a4:	53                   	push   %ebx
+  8007a5:	6a 30                	push   $0x30
+  8007a7:	ff d6                	call   *%esi
+      putch('x', putdat);
+  8007a9:	83 c4 08             	add    $0x8,%esp
+  8007ac:	53                   	push   %ebx
+  8007ad:	6a 78                	push   $0x78
+  8007af:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  8007b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b4:	8b 10                	mov    (%eax),%edx
+  8007b6:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  8007bb:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  8007be:	8d 40 04             	lea    0x4(%eax),%eax
+  8007c1:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8007c4:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  8007c9:	83 ec 0c             	sub    $0xc,%esp
+  8007cc:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8007d0:	50                   	push   %eax
+  8007d1:	ff 75 e0             	push   -0x20(%ebp)
+  8007d4:	57                   	push   %edi
+  8007d5:	51                   	push   %ecx
+  8007d6:	52                   	push   %edx
+  8007d7:	89 da                	mov    %ebx,%edx
+  8007d9:	89 f0                	mov    %esi,%eax
+  8007db:	e8 4a fb ff ff       	call   80032a <printnum>
+      break;
+  8007e0:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  8007e3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  8007e6:	e9 40 fc ff ff       	jmp    80042b <vprintfmt+0x1e>
+  if (lflag >= 2)
+  8007eb:	83 f9 01             	cmp    $0x1,%ecx
+  8007ee:	7f 1b                	jg     80080b <vprintfmt+0x3fe>
+  else if (lflag)
+  8007f0:	85 c9                	test   %ecx,%ecx
+  8007f2:	74 2c                	je     800820 <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  8007f4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007f7:	8b 10                	mov    (%eax),%edx
+  8007f9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007fe:	8d 40 04             	lea    0x4(%eax),%eax
+  800801:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800804:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  800809:	eb be                	jmp    8007c9 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  80080b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80080e:	8b 10                	mov    (%eax),%edx
+  800810:	8b 48 04             	mov    0x4(%eax),%ecx
+  800813:	8d 40 08             	lea    0x8(%eax),%eax
+  800816:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800819:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  80081e:	eb a9                	jmp    8007c9 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800820:	8b 45 14             	mov    0x14(%ebp),%eax
+  800823:	8b 10                	mov    (%eax),%edx
+  800825:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80082a:	8d 40 04             	lea    0x4(%eax),%eax
+  80082d:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800830:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  800835:	eb 92                	jmp    8007c9 <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  800837:	83 ec 08             	sub    $0x8,%esp
+  80083a:	53                   	push   %ebx
+  80083b:	6a 25                	push   $0x25
+  80083d:	ff d6                	call   *%esi
+      break;
+  80083f:	83 c4 10             	add    $0x10,%esp
+  800842:	eb 9f                	jmp    8007e3 <vprintfmt+0x3d6>
+      putch('%', putdat);
+  800844:	83 ec 08             	sub    $0x8,%esp
+  800847:	53                   	push   %ebx
+  800848:	6a 25                	push   $0x25
+  80084a:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  80084c:	83 c4 10             	add    $0x10,%esp
+  80084f:	89 f8                	mov    %edi,%eax
+  800851:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800855:	74 05                	je     80085c <vprintfmt+0x44f>
+  800857:	83 e8 01             	sub    $0x1,%eax
+  80085a:	eb f5                	jmp    800851 <vprintfmt+0x444>
+  80085c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80085f:	eb 82                	jmp    8007e3 <vprintfmt+0x3d6>
+
+00800861 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800861:	55                   	push   %ebp
+  800862:	89 e5                	mov    %esp,%ebp
+  800864:	83 ec 18             	sub    $0x18,%esp
+  800867:	8b 45 08             	mov    0x8(%ebp),%eax
+  80086a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  80086d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800870:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800874:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800877:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  80087e:	85 c0                	test   %eax,%eax
+  800880:	74 26                	je     8008a8 <vsnprintf+0x47>
+  800882:	85 d2                	test   %edx,%edx
+  800884:	7e 22                	jle    8008a8 <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800886:	ff 75 14             	push   0x14(%ebp)
+  800889:	ff 75 10             	push   0x10(%ebp)
+  80088c:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80088f:	50                   	push   %eax
+  800890:	68 d3 03 80 00       	push   $0x8003d3
+  800895:	e8 73 fb ff ff       	call   80040d <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  80089a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80089d:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  8008a0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8008a3:	83 c4 10             	add    $0x10,%esp
+}
+  8008a6:	c9                   	leave
+  8008a7:	c3                   	ret
+    return -E_INVAL;
+  8008a8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008ad:	eb f7                	jmp    8008a6 <vsnprintf+0x45>
+
+008008af <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8008af:	55                   	push   %ebp
+  8008b0:	89 e5                	mov    %esp,%ebp
+  8008b2:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  8008b5:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  8008b8:	50                   	push   %eax
+  8008b9:	ff 75 10             	push   0x10(%ebp)
+  8008bc:	ff 75 0c             	push   0xc(%ebp)
+  8008bf:	ff 75 08             	push   0x8(%ebp)
+  8008c2:	e8 9a ff ff ff       	call   800861 <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  8008c7:	c9                   	leave
+  8008c8:	c3                   	ret
+
+008008c9 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8008c9:	55                   	push   %ebp
+  8008ca:	89 e5                	mov    %esp,%ebp
+  8008cc:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  8008cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d4:	eb 03                	jmp    8008d9 <strlen+0x10>
+    n++;
+  8008d6:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  8008d9:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8008dd:	75 f7                	jne    8008d6 <strlen+0xd>
+  return n;
+}
+  8008df:	5d                   	pop    %ebp
+  8008e0:	c3                   	ret
+
+008008e1 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8008e1:	55                   	push   %ebp
+  8008e2:	89 e5                	mov    %esp,%ebp
+  8008e4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008e7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008ef:	eb 03                	jmp    8008f4 <strnlen+0x13>
+    n++;
+  8008f1:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008f4:	39 d0                	cmp    %edx,%eax
+  8008f6:	74 08                	je     800900 <strnlen+0x1f>
+  8008f8:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8008fc:	75 f3                	jne    8008f1 <strnlen+0x10>
+  8008fe:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  800900:	89 d0                	mov    %edx,%eax
+  800902:	5d                   	pop    %ebp
+  800903:	c3                   	ret
+
+00800904 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800904:	55                   	push   %ebp
+  800905:	89 e5                	mov    %esp,%ebp
+  800907:	53                   	push   %ebx
+  800908:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80090b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  80090e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800913:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800917:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  80091a:	83 c0 01             	add    $0x1,%eax
+  80091d:	84 d2                	test   %dl,%dl
+  80091f:	75 f2                	jne    800913 <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  800921:	89 c8                	mov    %ecx,%eax
+  800923:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800926:	c9                   	leave
+  800927:	c3                   	ret
+
+00800928 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800928:	55                   	push   %ebp
+  800929:	89 e5                	mov    %esp,%ebp
+  80092b:	53                   	push   %ebx
+  80092c:	83 ec 10             	sub    $0x10,%esp
+  80092f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  800932:	53                   	push   %ebx
+  800933:	e8 91 ff ff ff       	call   8008c9 <strlen>
+  800938:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  80093b:	ff 75 0c             	push   0xc(%ebp)
+  80093e:	01 d8                	add    %ebx,%eax
+  800940:	50                   	push   %eax
+  800941:	e8 be ff ff ff       	call   800904 <strcpy>
+  return dst;
+}
+  800946:	89 d8                	mov    %ebx,%eax
+  800948:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80094b:	c9                   	leave
+  80094c:	c3                   	ret
+
+0080094d <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  80094d:	55                   	push   %ebp
+  80094e:	89 e5                	mov    %esp,%ebp
+  800950:	56                   	push   %esi
+  800951:	53                   	push   %ebx
+  800952:	8b 75 08             	mov    0x8(%ebp),%esi
+  800955:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  800958:	89 f3                	mov    %esi,%ebx
+  80095a:	03 5d 10             	add    0x10(%ebp),%ebx
+  80095d:	89 f0                	mov    %esi,%eax
+  80095f:	eb 0f                	jmp    800970 <strncpy+0x23>
+    *dst++ = *src;
+  800961:	83 c0 01             	add    $0x1,%eax
+  800964:	0f b6 0a             	movzbl (%edx),%ecx
+  800967:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  80096a:	80 f9 01             	cmp    $0x1,%cl
+  80096d:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  800970:	39 d8                	cmp    %ebx,%eax
+  800972:	75 ed                	jne    800961 <strncpy+0x14>
+  }
+  return ret;
+}
+  800974:	89 f0                	mov    %esi,%eax
+  800976:	5b                   	pop    %ebx
+  800977:	5e                   	pop    %esi
+  800978:	5d                   	pop    %ebp
+  800979:	c3                   	ret
+
+0080097a <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80097a:	55                   	push   %ebp
+  80097b:	89 e5                	mov    %esp,%ebp
+  80097d:	56                   	push   %esi
+  80097e:	53                   	push   %ebx
+  80097f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800982:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800985:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  800988:	89 f0                	mov    %esi,%eax
+  80098a:	85 d2                	test   %edx,%edx
+  80098c:	74 21                	je     8009af <strlcpy+0x35>
+  80098e:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800992:	89 f2                	mov    %esi,%edx
+  800994:	eb 09                	jmp    80099f <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  800996:	83 c1 01             	add    $0x1,%ecx
+  800999:	83 c2 01             	add    $0x1,%edx
+  80099c:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  80099f:	39 c2                	cmp    %eax,%edx
+  8009a1:	74 09                	je     8009ac <strlcpy+0x32>
+  8009a3:	0f b6 19             	movzbl (%ecx),%ebx
+  8009a6:	84 db                	test   %bl,%bl
+  8009a8:	75 ec                	jne    800996 <strlcpy+0x1c>
+  8009aa:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  8009ac:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  8009af:	29 f0                	sub    %esi,%eax
+}
+  8009b1:	5b                   	pop    %ebx
+  8009b2:	5e                   	pop    %esi
+  8009b3:	5d                   	pop    %ebp
+  8009b4:	c3                   	ret
+
+008009b5 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8009b5:	55                   	push   %ebp
+  8009b6:	89 e5                	mov    %esp,%ebp
+  8009b8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009bb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  8009be:	eb 06                	jmp    8009c6 <strcmp+0x11>
+    p++, q++;
+  8009c0:	83 c1 01             	add    $0x1,%ecx
+  8009c3:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  8009c6:	0f b6 01             	movzbl (%ecx),%eax
+  8009c9:	84 c0                	test   %al,%al
+  8009cb:	74 04                	je     8009d1 <strcmp+0x1c>
+  8009cd:	3a 02                	cmp    (%edx),%al
+  8009cf:	74 ef                	je     8009c0 <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  8009d1:	0f b6 c0             	movzbl %al,%eax
+  8009d4:	0f b6 12             	movzbl (%edx),%edx
+  8009d7:	29 d0                	sub    %edx,%eax
+}
+  8009d9:	5d                   	pop    %ebp
+  8009da:	c3                   	ret
+
+008009db <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8009db:	55                   	push   %ebp
+  8009dc:	89 e5                	mov    %esp,%ebp
+  8009de:	53                   	push   %ebx
+  8009df:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009e2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009e5:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  8009e8:	eb 09                	jmp    8009f3 <strncmp+0x18>
+    n--, p++, q++;
+  8009ea:	83 ea 01             	sub    $0x1,%edx
+  8009ed:	83 c0 01             	add    $0x1,%eax
+  8009f0:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  8009f3:	85 d2                	test   %edx,%edx
+  8009f5:	74 18                	je     800a0f <strncmp+0x34>
+  8009f7:	0f b6 18             	movzbl (%eax),%ebx
+  8009fa:	84 db                	test   %bl,%bl
+  8009fc:	74 04                	je     800a02 <strncmp+0x27>
+  8009fe:	3a 19                	cmp    (%ecx),%bl
+  800a00:	74 e8                	je     8009ea <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800a02:	0f b6 00             	movzbl (%eax),%eax
+  800a05:	0f b6 11             	movzbl (%ecx),%edx
+  800a08:	29 d0                	sub    %edx,%eax
+}
+  800a0a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a0d:	c9                   	leave
+  800a0e:	c3                   	ret
+    return 0;
+  800a0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a14:	eb f4                	jmp    800a0a <strncmp+0x2f>
+
+00800a16 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a16:	55                   	push   %ebp
+  800a17:	89 e5                	mov    %esp,%ebp
+  800a19:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a1c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800a20:	eb 03                	jmp    800a25 <strchr+0xf>
+  800a22:	83 c0 01             	add    $0x1,%eax
+  800a25:	0f b6 10             	movzbl (%eax),%edx
+  800a28:	84 d2                	test   %dl,%dl
+  800a2a:	74 06                	je     800a32 <strchr+0x1c>
+    if (*s == c)
+  800a2c:	38 ca                	cmp    %cl,%dl
+  800a2e:	75 f2                	jne    800a22 <strchr+0xc>
+  800a30:	eb 05                	jmp    800a37 <strchr+0x21>
+      return (char*)s;
+  return 0;
+  800a32:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a37:	5d                   	pop    %ebp
+  800a38:	c3                   	ret
+
+00800a39 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a39:	55                   	push   %ebp
+  800a3a:	89 e5                	mov    %esp,%ebp
+  800a3c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a3f:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800a43:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  800a46:	38 ca                	cmp    %cl,%dl
+  800a48:	74 09                	je     800a53 <strfind+0x1a>
+  800a4a:	84 d2                	test   %dl,%dl
+  800a4c:	74 05                	je     800a53 <strfind+0x1a>
+  for (; *s; s++)
+  800a4e:	83 c0 01             	add    $0x1,%eax
+  800a51:	eb f0                	jmp    800a43 <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  800a53:	5d                   	pop    %ebp
+  800a54:	c3                   	ret
+
+00800a55 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a55:	55                   	push   %ebp
+  800a56:	89 e5                	mov    %esp,%ebp
+  800a58:	57                   	push   %edi
+  800a59:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a5c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  800a5f:	85 c9                	test   %ecx,%ecx
+  800a61:	74 20                	je     800a83 <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  800a63:	89 f8                	mov    %edi,%eax
+  800a65:	09 c8                	or     %ecx,%eax
+  800a67:	a8 03                	test   $0x3,%al
+  800a69:	75 12                	jne    800a7d <memset+0x28>
+    c &= 0xFF;
+  800a6b:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a6f:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  800a75:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  800a78:	fc                   	cld
+  800a79:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a7b:	eb 06                	jmp    800a83 <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  800a7d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a80:	fc                   	cld
+  800a81:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  800a83:	89 f8                	mov    %edi,%eax
+  800a85:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a88:	c9                   	leave
+  800a89:	c3                   	ret
+
+00800a8a <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a8a:	55                   	push   %ebp
+  800a8b:	89 e5                	mov    %esp,%ebp
+  800a8d:	57                   	push   %edi
+  800a8e:	56                   	push   %esi
+  800a8f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a92:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a95:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  800a98:	39 c6                	cmp    %eax,%esi
+  800a9a:	73 32                	jae    800ace <memmove+0x44>
+  800a9c:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a9f:	39 d0                	cmp    %edx,%eax
+  800aa1:	73 2b                	jae    800ace <memmove+0x44>
+    s += n;
+    d += n;
+  800aa3:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800aa6:	89 d6                	mov    %edx,%esi
+  800aa8:	09 fe                	or     %edi,%esi
+  800aaa:	09 ce                	or     %ecx,%esi
+  800aac:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800ab2:	75 0e                	jne    800ac2 <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800ab4:	83 ef 04             	sub    $0x4,%edi
+  800ab7:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800aba:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  800abd:	fd                   	std
+  800abe:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ac0:	eb 09                	jmp    800acb <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800ac2:	83 ef 01             	sub    $0x1,%edi
+  800ac5:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  800ac8:	fd                   	std
+  800ac9:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  800acb:	fc                   	cld
+  800acc:	eb 1a                	jmp    800ae8 <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ace:	89 f2                	mov    %esi,%edx
+  800ad0:	09 c2                	or     %eax,%edx
+  800ad2:	09 ca                	or     %ecx,%edx
+  800ad4:	f6 c2 03             	test   $0x3,%dl
+  800ad7:	75 0a                	jne    800ae3 <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800ad9:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  800adc:	89 c7                	mov    %eax,%edi
+  800ade:	fc                   	cld
+  800adf:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ae1:	eb 05                	jmp    800ae8 <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  800ae3:	89 c7                	mov    %eax,%edi
+  800ae5:	fc                   	cld
+  800ae6:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  800ae8:	5e                   	pop    %esi
+  800ae9:	5f                   	pop    %edi
+  800aea:	5d                   	pop    %ebp
+  800aeb:	c3                   	ret
+
+00800aec <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800aec:	55                   	push   %ebp
+  800aed:	89 e5                	mov    %esp,%ebp
+  800aef:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  800af2:	ff 75 10             	push   0x10(%ebp)
+  800af5:	ff 75 0c             	push   0xc(%ebp)
+  800af8:	ff 75 08             	push   0x8(%ebp)
+  800afb:	e8 8a ff ff ff       	call   800a8a <memmove>
+}
+  800b00:	c9                   	leave
+  800b01:	c3                   	ret
+
+00800b02 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800b02:	55                   	push   %ebp
+  800b03:	89 e5                	mov    %esp,%ebp
+  800b05:	56                   	push   %esi
+  800b06:	53                   	push   %ebx
+  800b07:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b0a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  800b0d:	89 c6                	mov    %eax,%esi
+  800b0f:	03 75 10             	add    0x10(%ebp),%esi
+  800b12:	eb 06                	jmp    800b1a <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  800b14:	83 c0 01             	add    $0x1,%eax
+  800b17:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  800b1a:	39 f0                	cmp    %esi,%eax
+  800b1c:	74 14                	je     800b32 <memcmp+0x30>
+    if (*s1 != *s2)
+  800b1e:	0f b6 08             	movzbl (%eax),%ecx
+  800b21:	0f b6 1a             	movzbl (%edx),%ebx
+  800b24:	38 d9                	cmp    %bl,%cl
+  800b26:	74 ec                	je     800b14 <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  800b28:	0f b6 c1             	movzbl %cl,%eax
+  800b2b:	0f b6 db             	movzbl %bl,%ebx
+  800b2e:	29 d8                	sub    %ebx,%eax
+  800b30:	eb 05                	jmp    800b37 <memcmp+0x35>
+  }
+
+  return 0;
+  800b32:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b37:	5b                   	pop    %ebx
+  800b38:	5e                   	pop    %esi
+  800b39:	5d                   	pop    %ebp
+  800b3a:	c3                   	ret
+
+00800b3b <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b3b:	55                   	push   %ebp
+  800b3c:	89 e5                	mov    %esp,%ebp
+  800b3e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b41:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  800b44:	89 c2                	mov    %eax,%edx
+  800b46:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  800b49:	eb 03                	jmp    800b4e <memfind+0x13>
+  800b4b:	83 c0 01             	add    $0x1,%eax
+  800b4e:	39 d0                	cmp    %edx,%eax
+  800b50:	73 04                	jae    800b56 <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  800b52:	38 08                	cmp    %cl,(%eax)
+  800b54:	75 f5                	jne    800b4b <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  800b56:	5d                   	pop    %ebp
+  800b57:	c3                   	ret
+
+00800b58 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800b58:	55                   	push   %ebp
+  800b59:	89 e5                	mov    %esp,%ebp
+  800b5b:	57                   	push   %edi
+  800b5c:	56                   	push   %esi
+  800b5d:	53                   	push   %ebx
+  800b5e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b61:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  800b64:	eb 03                	jmp    800b69 <strtol+0x11>
+    s++;
+  800b66:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  800b69:	0f b6 02             	movzbl (%edx),%eax
+  800b6c:	3c 20                	cmp    $0x20,%al
+  800b6e:	74 f6                	je     800b66 <strtol+0xe>
+  800b70:	3c 09                	cmp    $0x9,%al
+  800b72:	74 f2                	je     800b66 <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  800b74:	3c 2b                	cmp    $0x2b,%al
+  800b76:	74 2a                	je     800ba2 <strtol+0x4a>
+  int neg = 0;
+  800b78:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  800b7d:	3c 2d                	cmp    $0x2d,%al
+  800b7f:	74 2b                	je     800bac <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b81:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b87:	75 0f                	jne    800b98 <strtol+0x40>
+  800b89:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b8c:	74 28                	je     800bb6 <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  800b8e:	85 db                	test   %ebx,%ebx
+  800b90:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b95:	0f 44 d8             	cmove  %eax,%ebx
+  800b98:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b9d:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800ba0:	eb 46                	jmp    800be8 <strtol+0x90>
+    s++;
+  800ba2:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  800ba5:	bf 00 00 00 00       	mov    $0x0,%edi
+  800baa:	eb d5                	jmp    800b81 <strtol+0x29>
+    s++, neg = 1;
+  800bac:	83 c2 01             	add    $0x1,%edx
+  800baf:	bf 01 00 00 00       	mov    $0x1,%edi
+  800bb4:	eb cb                	jmp    800b81 <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800bb6:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800bba:	74 0e                	je     800bca <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  800bbc:	85 db                	test   %ebx,%ebx
+  800bbe:	75 d8                	jne    800b98 <strtol+0x40>
+    s++, base = 8;
+  800bc0:	83 c2 01             	add    $0x1,%edx
+  800bc3:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800bc8:	eb ce                	jmp    800b98 <strtol+0x40>
+    s += 2, base = 16;
+  800bca:	83 c2 02             	add    $0x2,%edx
+  800bcd:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800bd2:	eb c4                	jmp    800b98 <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  800bd4:	0f be c0             	movsbl %al,%eax
+  800bd7:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  800bda:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800bdd:	7d 3a                	jge    800c19 <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  800bdf:	83 c2 01             	add    $0x1,%edx
+  800be2:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800be6:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  800be8:	0f b6 02             	movzbl (%edx),%eax
+  800beb:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800bee:	89 f3                	mov    %esi,%ebx
+  800bf0:	80 fb 09             	cmp    $0x9,%bl
+  800bf3:	76 df                	jbe    800bd4 <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  800bf5:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800bf8:	89 f3                	mov    %esi,%ebx
+  800bfa:	80 fb 19             	cmp    $0x19,%bl
+  800bfd:	77 08                	ja     800c07 <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  800bff:	0f be c0             	movsbl %al,%eax
+  800c02:	83 e8 57             	sub    $0x57,%eax
+  800c05:	eb d3                	jmp    800bda <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  800c07:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800c0a:	89 f3                	mov    %esi,%ebx
+  800c0c:	80 fb 19             	cmp    $0x19,%bl
+  800c0f:	77 08                	ja     800c19 <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  800c11:	0f be c0             	movsbl %al,%eax
+  800c14:	83 e8 37             	sub    $0x37,%eax
+  800c17:	eb c1                	jmp    800bda <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  800c19:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c1d:	74 05                	je     800c24 <strtol+0xcc>
+    *endptr = (char*)s;
+  800c1f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c22:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  800c24:	89 c8                	mov    %ecx,%eax
+  800c26:	f7 d8                	neg    %eax
+  800c28:	85 ff                	test   %edi,%edi
+  800c2a:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800c2d:	89 c8                	mov    %ecx,%eax
+  800c2f:	5b                   	pop    %ebx
+  800c30:	5e                   	pop    %esi
+  800c31:	5f                   	pop    %edi
+  800c32:	5d                   	pop    %ebp
+  800c33:	c3                   	ret
+
+00800c34 <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800c34:	55                   	push   %ebp
+  800c35:	89 e5                	mov    %esp,%ebp
+  800c37:	57                   	push   %edi
+  800c38:	56                   	push   %esi
+  800c39:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800c3a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c3f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c42:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c45:	89 c3                	mov    %eax,%ebx
+  800c47:	89 c7                	mov    %eax,%edi
+  800c49:	89 c6                	mov    %eax,%esi
+  800c4b:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800c4d:	5b                   	pop    %ebx
+  800c4e:	5e                   	pop    %esi
+  800c4f:	5f                   	pop    %edi
+  800c50:	5d                   	pop    %ebp
+  800c51:	c3                   	ret
+
+00800c52 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800c52:	55                   	push   %ebp
+  800c53:	89 e5                	mov    %esp,%ebp
+  800c55:	57                   	push   %edi
+  800c56:	56                   	push   %esi
+  800c57:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800c58:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c5d:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c62:	89 d1                	mov    %edx,%ecx
+  800c64:	89 d3                	mov    %edx,%ebx
+  800c66:	89 d7                	mov    %edx,%edi
+  800c68:	89 d6                	mov    %edx,%esi
+  800c6a:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800c6c:	5b                   	pop    %ebx
+  800c6d:	5e                   	pop    %esi
+  800c6e:	5f                   	pop    %edi
+  800c6f:	5d                   	pop    %ebp
+  800c70:	c3                   	ret
+
+00800c71 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c71:	55                   	push   %ebp
+  800c72:	89 e5                	mov    %esp,%ebp
+  800c74:	57                   	push   %edi
+  800c75:	56                   	push   %esi
+  800c76:	53                   	push   %ebx
+  800c77:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800c7a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c7f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c82:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c87:	89 cb                	mov    %ecx,%ebx
+  800c89:	89 cf                	mov    %ecx,%edi
+  800c8b:	89 ce                	mov    %ecx,%esi
+  800c8d:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c8f:	85 c0                	test   %eax,%eax
+  800c91:	7f 08                	jg     800c9b <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800c93:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c96:	5b                   	pop    %ebx
+  800c97:	5e                   	pop    %esi
+  800c98:	5f                   	pop    %edi
+  800c99:	5d                   	pop    %ebp
+  800c9a:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c9b:	83 ec 0c             	sub    $0xc,%esp
+  800c9e:	50                   	push   %eax
+  800c9f:	6a 03                	push   $0x3
+  800ca1:	68 a3 33 80 00       	push   $0x8033a3
+  800ca6:	6a 23                	push   $0x23
+  800ca8:	68 c0 33 80 00       	push   $0x8033c0
+  800cad:	e8 89 f5 ff ff       	call   80023b <_panic>
+
+00800cb2 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800cb2:	55                   	push   %ebp
+  800cb3:	89 e5                	mov    %esp,%ebp
+  800cb5:	57                   	push   %edi
+  800cb6:	56                   	push   %esi
+  800cb7:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800cb8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cbd:	b8 02 00 00 00       	mov    $0x2,%eax
+  800cc2:	89 d1                	mov    %edx,%ecx
+  800cc4:	89 d3                	mov    %edx,%ebx
+  800cc6:	89 d7                	mov    %edx,%edi
+  800cc8:	89 d6                	mov    %edx,%esi
+  800cca:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800ccc:	5b                   	pop    %ebx
+  800ccd:	5e                   	pop    %esi
+  800cce:	5f                   	pop    %edi
+  800ccf:	5d                   	pop    %ebp
+  800cd0:	c3                   	ret
+
+00800cd1 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800cd1:	55                   	push   %ebp
+  800cd2:	89 e5                	mov    %esp,%ebp
+  800cd4:	57                   	push   %edi
+  800cd5:	56                   	push   %esi
+  800cd6:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800cd7:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cdc:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800ce1:	89 d1                	mov    %edx,%ecx
+  800ce3:	89 d3                	mov    %edx,%ebx
+  800ce5:	89 d7                	mov    %edx,%edi
+  800ce7:	89 d6                	mov    %edx,%esi
+  800ce9:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800ceb:	5b                   	pop    %ebx
+  800cec:	5e                   	pop    %esi
+  800ced:	5f                   	pop    %edi
+  800cee:	5d                   	pop    %ebp
+  800cef:	c3                   	ret
+
+00800cf0 <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  800cf0:	55                   	push   %ebp
+  800cf1:	89 e5                	mov    %esp,%ebp
+  800cf3:	57                   	push   %edi
+  800cf4:	56                   	push   %esi
+  800cf5:	53                   	push   %ebx
+  800cf6:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  800cf9:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  800cfd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d02:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d05:	b8 14 00 00 00       	mov    $0x14,%eax
+  800d0a:	89 df                	mov    %ebx,%edi
+  800d0c:	89 de                	mov    %ebx,%esi
+  800d0e:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d10:	85 c0                	test   %eax,%eax
+  800d12:	7f 08                	jg     800d1c <sys_env_set_cow+0x2c>
+}
+  800d14:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d17:	5b                   	pop    %ebx
+  800d18:	5e                   	pop    %esi
+  800d19:	5f                   	pop    %edi
+  800d1a:	5d                   	pop    %ebp
+  800d1b:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d1c:	83 ec 0c             	sub    $0xc,%esp
+  800d1f:	50                   	push   %eax
+  800d20:	6a 14                	push   $0x14
+  800d22:	68 a3 33 80 00       	push   $0x8033a3
+  800d27:	6a 23                	push   $0x23
+  800d29:	68 c0 33 80 00       	push   $0x8033c0
+  800d2e:	e8 08 f5 ff ff       	call   80023b <_panic>
+
+00800d33 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800d33:	55                   	push   %ebp
+  800d34:	89 e5                	mov    %esp,%ebp
+  800d36:	57                   	push   %edi
+  800d37:	56                   	push   %esi
+  800d38:	53                   	push   %ebx
+  800d39:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800d3c:	be 00 00 00 00       	mov    $0x0,%esi
+  800d41:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d44:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d47:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d4c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d4f:	89 f7                	mov    %esi,%edi
+  800d51:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d53:	85 c0                	test   %eax,%eax
+  800d55:	7f 08                	jg     800d5f <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  800d57:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d5a:	5b                   	pop    %ebx
+  800d5b:	5e                   	pop    %esi
+  800d5c:	5f                   	pop    %edi
+  800d5d:	5d                   	pop    %ebp
+  800d5e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d5f:	83 ec 0c             	sub    $0xc,%esp
+  800d62:	50                   	push   %eax
+  800d63:	6a 04                	push   $0x4
+  800d65:	68 a3 33 80 00       	push   $0x8033a3
+  800d6a:	6a 23                	push   $0x23
+  800d6c:	68 c0 33 80 00       	push   $0x8033c0
+  800d71:	e8 c5 f4 ff ff       	call   80023b <_panic>
+
+00800d76 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800d76:	55                   	push   %ebp
+  800d77:	89 e5                	mov    %esp,%ebp
+  800d79:	57                   	push   %edi
+  800d7a:	56                   	push   %esi
+  800d7b:	53                   	push   %ebx
+  800d7c:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800d7f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d82:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d85:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d8a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d8d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d90:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d93:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d95:	85 c0                	test   %eax,%eax
+  800d97:	7f 08                	jg     800da1 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  800d99:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d9c:	5b                   	pop    %ebx
+  800d9d:	5e                   	pop    %esi
+  800d9e:	5f                   	pop    %edi
+  800d9f:	5d                   	pop    %ebp
+  800da0:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800da1:	83 ec 0c             	sub    $0xc,%esp
+  800da4:	50                   	push   %eax
+  800da5:	6a 05                	push   $0x5
+  800da7:	68 a3 33 80 00       	push   $0x8033a3
+  800dac:	6a 23                	push   $0x23
+  800dae:	68 c0 33 80 00       	push   $0x8033c0
+  800db3:	e8 83 f4 ff ff       	call   80023b <_panic>
+
+00800db8 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800db8:	55                   	push   %ebp
+  800db9:	89 e5                	mov    %esp,%ebp
+  800dbb:	57                   	push   %edi
+  800dbc:	56                   	push   %esi
+  800dbd:	53                   	push   %ebx
+  800dbe:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800dc1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dc6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dc9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dcc:	b8 06 00 00 00       	mov    $0x6,%eax
+  800dd1:	89 df                	mov    %ebx,%edi
+  800dd3:	89 de                	mov    %ebx,%esi
+  800dd5:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800dd7:	85 c0                	test   %eax,%eax
+  800dd9:	7f 08                	jg     800de3 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  800ddb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dde:	5b                   	pop    %ebx
+  800ddf:	5e                   	pop    %esi
+  800de0:	5f                   	pop    %edi
+  800de1:	5d                   	pop    %ebp
+  800de2:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800de3:	83 ec 0c             	sub    $0xc,%esp
+  800de6:	50                   	push   %eax
+  800de7:	6a 06                	push   $0x6
+  800de9:	68 a3 33 80 00       	push   $0x8033a3
+  800dee:	6a 23                	push   $0x23
+  800df0:	68 c0 33 80 00       	push   $0x8033c0
+  800df5:	e8 41 f4 ff ff       	call   80023b <_panic>
+
+00800dfa <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  800dfa:	55                   	push   %ebp
+  800dfb:	89 e5                	mov    %esp,%ebp
+  800dfd:	57                   	push   %edi
+  800dfe:	56                   	push   %esi
+  800dff:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e00:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e03:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e06:	b8 11 00 00 00       	mov    $0x11,%eax
+  800e0b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e0e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e11:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e14:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  800e16:	5b                   	pop    %ebx
+  800e17:	5e                   	pop    %esi
+  800e18:	5f                   	pop    %edi
+  800e19:	5d                   	pop    %ebp
+  800e1a:	c3                   	ret
+
+00800e1b <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  800e1b:	55                   	push   %ebp
+  800e1c:	89 e5                	mov    %esp,%ebp
+  800e1e:	57                   	push   %edi
+  800e1f:	56                   	push   %esi
+  800e20:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e21:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e24:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e27:	b8 12 00 00 00       	mov    $0x12,%eax
+  800e2c:	be 00 00 00 00       	mov    $0x0,%esi
+  800e31:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e34:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e37:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  800e39:	5b                   	pop    %ebx
+  800e3a:	5e                   	pop    %esi
+  800e3b:	5f                   	pop    %edi
+  800e3c:	5d                   	pop    %ebp
+  800e3d:	c3                   	ret
+
+00800e3e <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  800e3e:	55                   	push   %ebp
+  800e3f:	89 e5                	mov    %esp,%ebp
+  800e41:	57                   	push   %edi
+  800e42:	56                   	push   %esi
+  800e43:	53                   	push   %ebx
+  800e44:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e47:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e4c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e4f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e52:	b8 16 00 00 00       	mov    $0x16,%eax
+  800e57:	89 df                	mov    %ebx,%edi
+  800e59:	89 de                	mov    %ebx,%esi
+  800e5b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e5d:	85 c0                	test   %eax,%eax
+  800e5f:	7f 08                	jg     800e69 <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  800e61:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e64:	5b                   	pop    %ebx
+  800e65:	5e                   	pop    %esi
+  800e66:	5f                   	pop    %edi
+  800e67:	5d                   	pop    %ebp
+  800e68:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e69:	83 ec 0c             	sub    $0xc,%esp
+  800e6c:	50                   	push   %eax
+  800e6d:	6a 16                	push   $0x16
+  800e6f:	68 a3 33 80 00       	push   $0x8033a3
+  800e74:	6a 23                	push   $0x23
+  800e76:	68 c0 33 80 00       	push   $0x8033c0
+  800e7b:	e8 bb f3 ff ff       	call   80023b <_panic>
+
+00800e80 <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  800e80:	55                   	push   %ebp
+  800e81:	89 e5                	mov    %esp,%ebp
+  800e83:	57                   	push   %edi
+  800e84:	56                   	push   %esi
+  800e85:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e86:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e8b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e8e:	b8 17 00 00 00       	mov    $0x17,%eax
+  800e93:	89 cb                	mov    %ecx,%ebx
+  800e95:	89 cf                	mov    %ecx,%edi
+  800e97:	89 ce                	mov    %ecx,%esi
+  800e99:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  800e9b:	5b                   	pop    %ebx
+  800e9c:	5e                   	pop    %esi
+  800e9d:	5f                   	pop    %edi
+  800e9e:	5d                   	pop    %ebp
+  800e9f:	c3                   	ret
+
+00800ea0 <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  800ea0:	55                   	push   %ebp
+  800ea1:	89 e5                	mov    %esp,%ebp
+  800ea3:	57                   	push   %edi
+  800ea4:	56                   	push   %esi
+  800ea5:	53                   	push   %ebx
+  800ea6:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800ea9:	be 00 00 00 00       	mov    $0x0,%esi
+  800eae:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eb4:	b8 18 00 00 00       	mov    $0x18,%eax
+  800eb9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ebc:	89 f7                	mov    %esi,%edi
+  800ebe:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ec0:	85 c0                	test   %eax,%eax
+  800ec2:	7f 08                	jg     800ecc <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  800ec4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ec7:	5b                   	pop    %ebx
+  800ec8:	5e                   	pop    %esi
+  800ec9:	5f                   	pop    %edi
+  800eca:	5d                   	pop    %ebp
+  800ecb:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ecc:	83 ec 0c             	sub    $0xc,%esp
+  800ecf:	50                   	push   %eax
+  800ed0:	6a 18                	push   $0x18
+  800ed2:	68 a3 33 80 00       	push   $0x8033a3
+  800ed7:	6a 23                	push   $0x23
+  800ed9:	68 c0 33 80 00       	push   $0x8033c0
+  800ede:	e8 58 f3 ff ff       	call   80023b <_panic>
+
+00800ee3 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  800ee3:	55                   	push   %ebp
+  800ee4:	89 e5                	mov    %esp,%ebp
+  800ee6:	57                   	push   %edi
+  800ee7:	56                   	push   %esi
+  800ee8:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800ee9:	be 00 00 00 00       	mov    $0x0,%esi
+  800eee:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ef4:	b8 19 00 00 00       	mov    $0x19,%eax
+  800ef9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800efc:	89 f7                	mov    %esi,%edi
+  800efe:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  800f00:	5b                   	pop    %ebx
+  800f01:	5e                   	pop    %esi
+  800f02:	5f                   	pop    %edi
+  800f03:	5d                   	pop    %ebp
+  800f04:	c3                   	ret
+
+00800f05 <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  800f05:	55                   	push   %ebp
+  800f06:	89 e5                	mov    %esp,%ebp
+  800f08:	57                   	push   %edi
+  800f09:	56                   	push   %esi
+  800f0a:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f0b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f10:	b8 15 00 00 00       	mov    $0x15,%eax
+  800f15:	89 d1                	mov    %edx,%ecx
+  800f17:	89 d3                	mov    %edx,%ebx
+  800f19:	89 d7                	mov    %edx,%edi
+  800f1b:	89 d6                	mov    %edx,%esi
+  800f1d:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800f1f:	5b                   	pop    %ebx
+  800f20:	5e                   	pop    %esi
+  800f21:	5f                   	pop    %edi
+  800f22:	5d                   	pop    %ebp
+  800f23:	c3                   	ret
+
+00800f24 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800f24:	55                   	push   %ebp
+  800f25:	89 e5                	mov    %esp,%ebp
+  800f27:	57                   	push   %edi
+  800f28:	56                   	push   %esi
+  800f29:	53                   	push   %ebx
+  800f2a:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f2d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f32:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f35:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f38:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f3d:	89 df                	mov    %ebx,%edi
+  800f3f:	89 de                	mov    %ebx,%esi
+  800f41:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f43:	85 c0                	test   %eax,%eax
+  800f45:	7f 08                	jg     800f4f <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800f47:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f4a:	5b                   	pop    %ebx
+  800f4b:	5e                   	pop    %esi
+  800f4c:	5f                   	pop    %edi
+  800f4d:	5d                   	pop    %ebp
+  800f4e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f4f:	83 ec 0c             	sub    $0xc,%esp
+  800f52:	50                   	push   %eax
+  800f53:	6a 08                	push   $0x8
+  800f55:	68 a3 33 80 00       	push   $0x8033a3
+  800f5a:	6a 23                	push   $0x23
+  800f5c:	68 c0 33 80 00       	push   $0x8033c0
+  800f61:	e8 d5 f2 ff ff       	call   80023b <_panic>
+
+00800f66 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800f66:	55                   	push   %ebp
+  800f67:	89 e5                	mov    %esp,%ebp
+  800f69:	57                   	push   %edi
+  800f6a:	56                   	push   %esi
+  800f6b:	53                   	push   %ebx
+  800f6c:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f6f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f74:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f77:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f7a:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f7f:	89 df                	mov    %ebx,%edi
+  800f81:	89 de                	mov    %ebx,%esi
+  800f83:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f85:	85 c0                	test   %eax,%eax
+  800f87:	7f 08                	jg     800f91 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  800f89:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f8c:	5b                   	pop    %ebx
+  800f8d:	5e                   	pop    %esi
+  800f8e:	5f                   	pop    %edi
+  800f8f:	5d                   	pop    %ebp
+  800f90:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f91:	83 ec 0c             	sub    $0xc,%esp
+  800f94:	50                   	push   %eax
+  800f95:	6a 09                	push   $0x9
+  800f97:	68 a3 33 80 00       	push   $0x8033a3
+  800f9c:	6a 23                	push   $0x23
+  800f9e:	68 c0 33 80 00       	push   $0x8033c0
+  800fa3:	e8 93 f2 ff ff       	call   80023b <_panic>
+
+00800fa8 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800fa8:	55                   	push   %ebp
+  800fa9:	89 e5                	mov    %esp,%ebp
+  800fab:	57                   	push   %edi
+  800fac:	56                   	push   %esi
+  800fad:	53                   	push   %ebx
+  800fae:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800fb1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fb6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fb9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fbc:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800fc1:	89 df                	mov    %ebx,%edi
+  800fc3:	89 de                	mov    %ebx,%esi
+  800fc5:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800fc7:	85 c0                	test   %eax,%eax
+  800fc9:	7f 08                	jg     800fd3 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  800fcb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fce:	5b                   	pop    %ebx
+  800fcf:	5e                   	pop    %esi
+  800fd0:	5f                   	pop    %edi
+  800fd1:	5d                   	pop    %ebp
+  800fd2:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800fd3:	83 ec 0c             	sub    $0xc,%esp
+  800fd6:	50                   	push   %eax
+  800fd7:	6a 0a                	push   $0xa
+  800fd9:	68 a3 33 80 00       	push   $0x8033a3
+  800fde:	6a 23                	push   $0x23
+  800fe0:	68 c0 33 80 00       	push   $0x8033c0
+  800fe5:	e8 51 f2 ff ff       	call   80023b <_panic>
+
+00800fea <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  800fea:	55                   	push   %ebp
+  800feb:	89 e5                	mov    %esp,%ebp
+  800fed:	57                   	push   %edi
+  800fee:	56                   	push   %esi
+  800fef:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800ff0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ff3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ff6:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800ffb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ffe:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801001:	8b 75 18             	mov    0x18(%ebp),%esi
+  801004:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  801006:	5b                   	pop    %ebx
+  801007:	5e                   	pop    %esi
+  801008:	5f                   	pop    %edi
+  801009:	5d                   	pop    %ebp
+  80100a:	c3                   	ret
+
+0080100b <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  80100b:	55                   	push   %ebp
+  80100c:	89 e5                	mov    %esp,%ebp
+  80100e:	57                   	push   %edi
+  80100f:	56                   	push   %esi
+  801010:	53                   	push   %ebx
+  801011:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801014:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801019:	8b 55 08             	mov    0x8(%ebp),%edx
+  80101c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80101f:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801024:	89 df                	mov    %ebx,%edi
+  801026:	89 de                	mov    %ebx,%esi
+  801028:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80102a:	85 c0                	test   %eax,%eax
+  80102c:	7f 08                	jg     801036 <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  80102e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801031:	5b                   	pop    %ebx
+  801032:	5e                   	pop    %esi
+  801033:	5f                   	pop    %edi
+  801034:	5d                   	pop    %ebp
+  801035:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801036:	83 ec 0c             	sub    $0xc,%esp
+  801039:	50                   	push   %eax
+  80103a:	6a 0d                	push   $0xd
+  80103c:	68 a3 33 80 00       	push   $0x8033a3
+  801041:	6a 23                	push   $0x23
+  801043:	68 c0 33 80 00       	push   $0x8033c0
+  801048:	e8 ee f1 ff ff       	call   80023b <_panic>
+
+0080104d <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  80104d:	55                   	push   %ebp
+  80104e:	89 e5                	mov    %esp,%ebp
+  801050:	57                   	push   %edi
+  801051:	56                   	push   %esi
+  801052:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801053:	ba 00 00 00 00       	mov    $0x0,%edx
+  801058:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80105d:	89 d1                	mov    %edx,%ecx
+  80105f:	89 d3                	mov    %edx,%ebx
+  801061:	89 d7                	mov    %edx,%edi
+  801063:	89 d6                	mov    %edx,%esi
+  801065:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801067:	5b                   	pop    %ebx
+  801068:	5e                   	pop    %esi
+  801069:	5f                   	pop    %edi
+  80106a:	5d                   	pop    %ebp
+  80106b:	c3                   	ret
+
+0080106c <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  80106c:	55                   	push   %ebp
+  80106d:	89 e5                	mov    %esp,%ebp
+  80106f:	57                   	push   %edi
+  801070:	56                   	push   %esi
+  801071:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801072:	8b 55 08             	mov    0x8(%ebp),%edx
+  801075:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801078:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80107d:	be 00 00 00 00       	mov    $0x0,%esi
+  801082:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801085:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801088:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  80108a:	5b                   	pop    %ebx
+  80108b:	5e                   	pop    %esi
+  80108c:	5f                   	pop    %edi
+  80108d:	5d                   	pop    %ebp
+  80108e:	c3                   	ret
+
+0080108f <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  80108f:	55                   	push   %ebp
+  801090:	89 e5                	mov    %esp,%ebp
+  801092:	57                   	push   %edi
+  801093:	56                   	push   %esi
+  801094:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801095:	be 00 00 00 00       	mov    $0x0,%esi
+  80109a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80109d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a0:	b8 10 00 00 00       	mov    $0x10,%eax
+  8010a5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010a8:	89 f7                	mov    %esi,%edi
+  8010aa:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  8010ac:	5b                   	pop    %ebx
+  8010ad:	5e                   	pop    %esi
+  8010ae:	5f                   	pop    %edi
+  8010af:	5d                   	pop    %ebp
+  8010b0:	c3                   	ret
+
+008010b1 <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  8010b1:	55                   	push   %ebp
+  8010b2:	89 e5                	mov    %esp,%ebp
+  8010b4:	57                   	push   %edi
+  8010b5:	56                   	push   %esi
+  8010b6:	53                   	push   %ebx
+  8010b7:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  8010ba:	80 3d 48 57 80 00 00 	cmpb   $0x0,0x805748
+  8010c1:	74 41                	je     801104 <sys_batch+0x53>
+  8010c3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010c6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  8010c9:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  8010d0:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8010d3:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  8010d6:	7d 45                	jge    80111d <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  8010d8:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8010db:	8b 06                	mov    (%esi),%eax
+  8010dd:	8b 56 04             	mov    0x4(%esi),%edx
+  8010e0:	8b 4e 08             	mov    0x8(%esi),%ecx
+  8010e3:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  8010e6:	8b 7e 10             	mov    0x10(%esi),%edi
+  8010e9:	8b 76 14             	mov    0x14(%esi),%esi
+  8010ec:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  8010ee:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8010f1:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  8010f4:	83 c6 1c             	add    $0x1c,%esi
+  8010f7:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  8010fa:	85 c0                	test   %eax,%eax
+  8010fc:	78 1f                	js     80111d <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  8010fe:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  801102:	eb cc                	jmp    8010d0 <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  801104:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801109:	b8 13 00 00 00       	mov    $0x13,%eax
+  80110e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801111:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801114:	89 df                	mov    %ebx,%edi
+  801116:	89 de                	mov    %ebx,%esi
+  801118:	cd 30                	int    $0x30
+  80111a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  80111d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801120:	83 c4 08             	add    $0x8,%esp
+  801123:	5b                   	pop    %ebx
+  801124:	5e                   	pop    %esi
+  801125:	5f                   	pop    %edi
+  801126:	5d                   	pop    %ebp
+  801127:	c3                   	ret
+
+00801128 <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  801128:	55                   	push   %ebp
+  801129:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  80112b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80112e:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  801134:	5d                   	pop    %ebp
+  801135:	c3                   	ret
+
+00801136 <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  801136:	55                   	push   %ebp
+  801137:	89 e5                	mov    %esp,%ebp
+  801139:	56                   	push   %esi
+  80113a:	53                   	push   %ebx
+  80113b:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  80113e:	8b 1e                	mov    (%esi),%ebx
+  801140:	85 db                	test   %ebx,%ebx
+  801142:	75 09                	jne    80114d <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  801144:	89 d8                	mov    %ebx,%eax
+  801146:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801149:	5b                   	pop    %ebx
+  80114a:	5e                   	pop    %esi
+  80114b:	5d                   	pop    %ebp
+  80114c:	c3                   	ret
+  b->sb_n = 0;
+  80114d:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  801153:	53                   	push   %ebx
+  801154:	8d 46 04             	lea    0x4(%esi),%eax
+  801157:	50                   	push   %eax
+  801158:	e8 54 ff ff ff       	call   8010b1 <sys_batch>
+  80115d:	83 c4 08             	add    $0x8,%esp
+  801160:	85 c0                	test   %eax,%eax
+  801162:	78 1e                	js     801182 <sysbatch_flush+0x4c>
+  if (r < n)
+  801164:	39 c3                	cmp    %eax,%ebx
+  801166:	7f 07                	jg     80116f <sysbatch_flush+0x39>
+  return 0;
+  801168:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80116d:	eb d5                	jmp    801144 <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  80116f:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801172:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  801176:	85 db                	test   %ebx,%ebx
+  801178:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80117d:	0f 49 d8             	cmovns %eax,%ebx
+  801180:	eb c2                	jmp    801144 <sysbatch_flush+0xe>
+    return r;
+  801182:	89 c3                	mov    %eax,%ebx
+  801184:	eb be                	jmp    801144 <sysbatch_flush+0xe>
+
+00801186 <sysbatch_add>:
+{
+  801186:	55                   	push   %ebp
+  801187:	89 e5                	mov    %esp,%ebp
+  801189:	53                   	push   %ebx
+  80118a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  80118d:	83 3b 40             	cmpl   $0x40,(%ebx)
+  801190:	74 41                	je     8011d3 <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  801192:	8b 03                	mov    (%ebx),%eax
+  801194:	8d 50 01             	lea    0x1(%eax),%edx
+  801197:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  801199:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80119c:	01 d8                	add    %ebx,%eax
+  80119e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8011a1:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  8011a4:	8b 55 10             	mov    0x10(%ebp),%edx
+  8011a7:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  8011aa:	8b 55 14             	mov    0x14(%ebp),%edx
+  8011ad:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  8011b0:	8b 55 18             	mov    0x18(%ebp),%edx
+  8011b3:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  8011b6:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  8011b9:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  8011bc:	8b 55 20             	mov    0x20(%ebp),%edx
+  8011bf:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  8011c2:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  8011c9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8011d1:	c9                   	leave
+  8011d2:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  8011d3:	53                   	push   %ebx
+  8011d4:	e8 5d ff ff ff       	call   801136 <sysbatch_flush>
+  8011d9:	83 c4 04             	add    $0x4,%esp
+  8011dc:	85 c0                	test   %eax,%eax
+  8011de:	79 b2                	jns    801192 <sysbatch_add+0xc>
+  8011e0:	eb ec                	jmp    8011ce <sysbatch_add+0x48>
+
+008011e2 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8011e2:	55                   	push   %ebp
+  8011e3:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8011e5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011e8:	05 00 00 00 30       	add    $0x30000000,%eax
+  8011ed:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8011f0:	5d                   	pop    %ebp
+  8011f1:	c3                   	ret
+
+008011f2 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8011f2:	55                   	push   %ebp
+  8011f3:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8011f5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011f8:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  8011fb:	66 b8 00 00          	mov    $0x0,%ax
+  8011ff:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801204:	5d                   	pop    %ebp
+  801205:	c3                   	ret
+
+00801206 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801206:	55                   	push   %ebp
+  801207:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  801209:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80120e:	eb 02                	jmp    801212 <fd_alloc+0xc>
+  801210:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801212:	89 c2                	mov    %eax,%edx
+  801214:	c1 ea 16             	shr    $0x16,%edx
+  801217:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80121e:	f6 c2 01             	test   $0x1,%dl
+  801221:	74 2b                	je     80124e <fd_alloc+0x48>
+  801223:	89 c2                	mov    %eax,%edx
+  801225:	c1 ea 0c             	shr    $0xc,%edx
+  801228:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80122f:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801235:	f6 c1 01             	test   $0x1,%cl
+  801238:	74 14                	je     80124e <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  80123a:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801240:	75 ce                	jne    801210 <fd_alloc+0xa>
+  801242:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  801247:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80124c:	eb 05                	jmp    801253 <fd_alloc+0x4d>
+      return 0;
+  80124e:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  801253:	8b 55 08             	mov    0x8(%ebp),%edx
+  801256:	89 02                	mov    %eax,(%edx)
+}
+  801258:	89 c8                	mov    %ecx,%eax
+  80125a:	5d                   	pop    %ebp
+  80125b:	c3                   	ret
+
+0080125c <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80125c:	55                   	push   %ebp
+  80125d:	89 e5                	mov    %esp,%ebp
+  80125f:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  801262:	83 f8 1f             	cmp    $0x1f,%eax
+  801265:	77 30                	ja     801297 <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  801267:	c1 e0 0c             	shl    $0xc,%eax
+  80126a:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80126f:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801275:	f6 c2 01             	test   $0x1,%dl
+  801278:	74 24                	je     80129e <fd_lookup+0x42>
+  80127a:	89 c2                	mov    %eax,%edx
+  80127c:	c1 ea 0c             	shr    $0xc,%edx
+  80127f:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801286:	f6 c2 01             	test   $0x1,%dl
+  801289:	74 1a                	je     8012a5 <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  80128b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80128e:	89 02                	mov    %eax,(%edx)
+  return 0;
+  801290:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801295:	5d                   	pop    %ebp
+  801296:	c3                   	ret
+    return -E_INVAL;
+  801297:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80129c:	eb f7                	jmp    801295 <fd_lookup+0x39>
+    return -E_INVAL;
+  80129e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012a3:	eb f0                	jmp    801295 <fd_lookup+0x39>
+  8012a5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012aa:	eb e9                	jmp    801295 <fd_lookup+0x39>
+
+008012ac <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8012ac:	55                   	push   %ebp
+  8012ad:	89 e5                	mov    %esp,%ebp
+  8012af:	53                   	push   %ebx
+  8012b0:	83 ec 04             	sub    $0x4,%esp
+  8012b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  8012b6:	b8 4c 34 80 00       	mov    $0x80344c,%eax
+  8012bb:	8b 18                	mov    (%eax),%ebx
+  8012bd:	85 db                	test   %ebx,%ebx
+  8012bf:	74 0e                	je     8012cf <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  8012c1:	83 c0 04             	add    $0x4,%eax
+  8012c4:	39 13                	cmp    %edx,(%ebx)
+  8012c6:	75 f3                	jne    8012bb <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  8012c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012cd:	eb 1f                	jmp    8012ee <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8012cf:	a1 44 57 80 00       	mov    0x805744,%eax
+  8012d4:	8b 40 48             	mov    0x48(%eax),%eax
+  8012d7:	83 ec 04             	sub    $0x4,%esp
+  8012da:	52                   	push   %edx
+  8012db:	50                   	push   %eax
+  8012dc:	68 d0 33 80 00       	push   $0x8033d0
+  8012e1:	e8 30 f0 ff ff       	call   800316 <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  8012e6:	83 c4 10             	add    $0x10,%esp
+  8012e9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  8012ee:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8012f1:	89 1a                	mov    %ebx,(%edx)
+}
+  8012f3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012f6:	c9                   	leave
+  8012f7:	c3                   	ret
+
+008012f8 <fd_close>:
+{
+  8012f8:	55                   	push   %ebp
+  8012f9:	89 e5                	mov    %esp,%ebp
+  8012fb:	57                   	push   %edi
+  8012fc:	56                   	push   %esi
+  8012fd:	53                   	push   %ebx
+  8012fe:	83 ec 24             	sub    $0x24,%esp
+  801301:	8b 75 08             	mov    0x8(%ebp),%esi
+  801304:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801307:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80130a:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80130b:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801311:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801314:	50                   	push   %eax
+  801315:	e8 42 ff ff ff       	call   80125c <fd_lookup>
+  80131a:	89 c3                	mov    %eax,%ebx
+  80131c:	83 c4 10             	add    $0x10,%esp
+  80131f:	85 c0                	test   %eax,%eax
+  801321:	78 05                	js     801328 <fd_close+0x30>
+      || fd != fd2)
+  801323:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801326:	74 16                	je     80133e <fd_close+0x46>
+    return must_exist ? r : 0;
+  801328:	89 f8                	mov    %edi,%eax
+  80132a:	84 c0                	test   %al,%al
+  80132c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801331:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801334:	89 d8                	mov    %ebx,%eax
+  801336:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801339:	5b                   	pop    %ebx
+  80133a:	5e                   	pop    %esi
+  80133b:	5f                   	pop    %edi
+  80133c:	5d                   	pop    %ebp
+  80133d:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80133e:	83 ec 08             	sub    $0x8,%esp
+  801341:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801344:	50                   	push   %eax
+  801345:	ff 36                	push   (%esi)
+  801347:	e8 60 ff ff ff       	call   8012ac <dev_lookup>
+  80134c:	89 c3                	mov    %eax,%ebx
+  80134e:	83 c4 10             	add    $0x10,%esp
+  801351:	85 c0                	test   %eax,%eax
+  801353:	78 1a                	js     80136f <fd_close+0x77>
+    if (dev->dev_close)
+  801355:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801358:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  80135b:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  801360:	85 c0                	test   %eax,%eax
+  801362:	74 0b                	je     80136f <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  801364:	83 ec 0c             	sub    $0xc,%esp
+  801367:	56                   	push   %esi
+  801368:	ff d0                	call   *%eax
+  80136a:	89 c3                	mov    %eax,%ebx
+  80136c:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  80136f:	83 ec 08             	sub    $0x8,%esp
+  801372:	56                   	push   %esi
+  801373:	6a 00                	push   $0x0
+  801375:	e8 3e fa ff ff       	call   800db8 <sys_page_unmap>
+  return r;
+  80137a:	83 c4 10             	add    $0x10,%esp
+  80137d:	eb b5                	jmp    801334 <fd_close+0x3c>
+
+0080137f <close>:
+
+int
+close(int fdnum)
+{
+  80137f:	55                   	push   %ebp
+  801380:	89 e5                	mov    %esp,%ebp
+  801382:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801385:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801388:	50                   	push   %eax
+  801389:	ff 75 08             	push   0x8(%ebp)
+  80138c:	e8 cb fe ff ff       	call   80125c <fd_lookup>
+  801391:	83 c4 10             	add    $0x10,%esp
+  801394:	85 c0                	test   %eax,%eax
+  801396:	79 02                	jns    80139a <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  801398:	c9                   	leave
+  801399:	c3                   	ret
+    return fd_close(fd, 1);
+  80139a:	83 ec 08             	sub    $0x8,%esp
+  80139d:	6a 01                	push   $0x1
+  80139f:	ff 75 f4             	push   -0xc(%ebp)
+  8013a2:	e8 51 ff ff ff       	call   8012f8 <fd_close>
+  8013a7:	83 c4 10             	add    $0x10,%esp
+  8013aa:	eb ec                	jmp    801398 <close+0x19>
+
+008013ac <close_all>:
+
+void
+close_all(void)
+{
+  8013ac:	55                   	push   %ebp
+  8013ad:	89 e5                	mov    %esp,%ebp
+  8013af:	53                   	push   %ebx
+  8013b0:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  8013b3:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  8013b8:	83 ec 0c             	sub    $0xc,%esp
+  8013bb:	53                   	push   %ebx
+  8013bc:	e8 be ff ff ff       	call   80137f <close>
+  for (i = 0; i < MAXFD; i++)
+  8013c1:	83 c3 01             	add    $0x1,%ebx
+  8013c4:	83 c4 10             	add    $0x10,%esp
+  8013c7:	83 fb 20             	cmp    $0x20,%ebx
+  8013ca:	75 ec                	jne    8013b8 <close_all+0xc>
+}
+  8013cc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013cf:	c9                   	leave
+  8013d0:	c3                   	ret
+
+008013d1 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8013d1:	55                   	push   %ebp
+  8013d2:	89 e5                	mov    %esp,%ebp
+  8013d4:	57                   	push   %edi
+  8013d5:	56                   	push   %esi
+  8013d6:	53                   	push   %ebx
+  8013d7:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8013da:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8013dd:	50                   	push   %eax
+  8013de:	ff 75 08             	push   0x8(%ebp)
+  8013e1:	e8 76 fe ff ff       	call   80125c <fd_lookup>
+  8013e6:	89 c6                	mov    %eax,%esi
+  8013e8:	83 c4 10             	add    $0x10,%esp
+  8013eb:	85 c0                	test   %eax,%eax
+  8013ed:	0f 88 0a 01 00 00    	js     8014fd <dup+0x12c>
+    return r;
+  close(newfdnum);
+  8013f3:	83 ec 0c             	sub    $0xc,%esp
+  8013f6:	ff 75 0c             	push   0xc(%ebp)
+  8013f9:	e8 81 ff ff ff       	call   80137f <close>
+
+  newfd = INDEX2FD(newfdnum);
+  8013fe:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801401:	c1 e0 0c             	shl    $0xc,%eax
+  801404:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  80140a:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  80140d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801410:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  801413:	89 04 24             	mov    %eax,(%esp)
+  801416:	e8 d7 fd ff ff       	call   8011f2 <fd2data>
+  80141b:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  80141d:	89 3c 24             	mov    %edi,(%esp)
+  801420:	e8 cd fd ff ff       	call   8011f2 <fd2data>
+  801425:	83 c4 10             	add    $0x10,%esp
+  801428:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80142b:	89 f3                	mov    %esi,%ebx
+  80142d:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  801433:	89 c6                	mov    %eax,%esi
+  801435:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801438:	89 cf                	mov    %ecx,%edi
+  80143a:	eb 0c                	jmp    801448 <dup+0x77>
+  80143c:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801442:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801448:	39 fb                	cmp    %edi,%ebx
+  80144a:	74 7b                	je     8014c7 <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  80144c:	89 d8                	mov    %ebx,%eax
+  80144e:	c1 e8 16             	shr    $0x16,%eax
+  801451:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801458:	a8 01                	test   $0x1,%al
+  80145a:	74 e0                	je     80143c <dup+0x6b>
+  80145c:	89 d8                	mov    %ebx,%eax
+  80145e:	c1 e8 0c             	shr    $0xc,%eax
+  801461:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801468:	f6 c2 01             	test   $0x1,%dl
+  80146b:	74 cf                	je     80143c <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  80146d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  801474:	83 ec 0c             	sub    $0xc,%esp
+  801477:	25 07 0e 00 00       	and    $0xe07,%eax
+  80147c:	50                   	push   %eax
+  80147d:	56                   	push   %esi
+  80147e:	6a 00                	push   $0x0
+  801480:	53                   	push   %ebx
+  801481:	6a 00                	push   $0x0
+  801483:	e8 ee f8 ff ff       	call   800d76 <sys_page_map>
+  801488:	83 c4 20             	add    $0x20,%esp
+  80148b:	85 c0                	test   %eax,%eax
+  80148d:	79 ad                	jns    80143c <dup+0x6b>
+  80148f:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801492:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  801494:	83 ec 08             	sub    $0x8,%esp
+  801497:	ff 75 d4             	push   -0x2c(%ebp)
+  80149a:	6a 00                	push   $0x0
+  80149c:	e8 17 f9 ff ff       	call   800db8 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8014a1:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  8014a4:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  8014aa:	83 c4 10             	add    $0x10,%esp
+  8014ad:	39 df                	cmp    %ebx,%edi
+  8014af:	74 4c                	je     8014fd <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  8014b1:	83 ec 08             	sub    $0x8,%esp
+  8014b4:	57                   	push   %edi
+  8014b5:	6a 00                	push   $0x0
+  8014b7:	e8 fc f8 ff ff       	call   800db8 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8014bc:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  8014c2:	83 c4 10             	add    $0x10,%esp
+  8014c5:	eb e6                	jmp    8014ad <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8014c7:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8014ca:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8014cd:	89 c8                	mov    %ecx,%eax
+  8014cf:	c1 e8 0c             	shr    $0xc,%eax
+  8014d2:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8014d9:	83 ec 0c             	sub    $0xc,%esp
+  8014dc:	25 07 0e 00 00       	and    $0xe07,%eax
+  8014e1:	50                   	push   %eax
+  8014e2:	ff 75 d4             	push   -0x2c(%ebp)
+  8014e5:	6a 00                	push   $0x0
+  8014e7:	51                   	push   %ecx
+  8014e8:	6a 00                	push   $0x0
+  8014ea:	e8 87 f8 ff ff       	call   800d76 <sys_page_map>
+  8014ef:	89 c6                	mov    %eax,%esi
+  8014f1:	83 c4 20             	add    $0x20,%esp
+  8014f4:	85 c0                	test   %eax,%eax
+  8014f6:	78 9c                	js     801494 <dup+0xc3>
+  return newfdnum;
+  8014f8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8014fb:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  8014fd:	89 f0                	mov    %esi,%eax
+  8014ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801502:	5b                   	pop    %ebx
+  801503:	5e                   	pop    %esi
+  801504:	5f                   	pop    %edi
+  801505:	5d                   	pop    %ebp
+  801506:	c3                   	ret
+
+00801507 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801507:	55                   	push   %ebp
+  801508:	89 e5                	mov    %esp,%ebp
+  80150a:	56                   	push   %esi
+  80150b:	53                   	push   %ebx
+  80150c:	83 ec 18             	sub    $0x18,%esp
+  80150f:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801512:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801515:	50                   	push   %eax
+  801516:	56                   	push   %esi
+  801517:	e8 40 fd ff ff       	call   80125c <fd_lookup>
+  80151c:	83 c4 10             	add    $0x10,%esp
+  80151f:	85 c0                	test   %eax,%eax
+  801521:	78 3c                	js     80155f <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801523:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801526:	83 ec 08             	sub    $0x8,%esp
+  801529:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80152c:	50                   	push   %eax
+  80152d:	ff 33                	push   (%ebx)
+  80152f:	e8 78 fd ff ff       	call   8012ac <dev_lookup>
+  801534:	83 c4 10             	add    $0x10,%esp
+  801537:	85 c0                	test   %eax,%eax
+  801539:	78 24                	js     80155f <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80153b:	8b 43 08             	mov    0x8(%ebx),%eax
+  80153e:	83 e0 03             	and    $0x3,%eax
+  801541:	83 f8 01             	cmp    $0x1,%eax
+  801544:	74 20                	je     801566 <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  801546:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801549:	8b 40 08             	mov    0x8(%eax),%eax
+  80154c:	85 c0                	test   %eax,%eax
+  80154e:	74 37                	je     801587 <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  801550:	83 ec 04             	sub    $0x4,%esp
+  801553:	ff 75 10             	push   0x10(%ebp)
+  801556:	ff 75 0c             	push   0xc(%ebp)
+  801559:	53                   	push   %ebx
+  80155a:	ff d0                	call   *%eax
+  80155c:	83 c4 10             	add    $0x10,%esp
+}
+  80155f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801562:	5b                   	pop    %ebx
+  801563:	5e                   	pop    %esi
+  801564:	5d                   	pop    %ebp
+  801565:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801566:	a1 44 57 80 00       	mov    0x805744,%eax
+  80156b:	8b 40 48             	mov    0x48(%eax),%eax
+  80156e:	83 ec 04             	sub    $0x4,%esp
+  801571:	56                   	push   %esi
+  801572:	50                   	push   %eax
+  801573:	68 11 34 80 00       	push   $0x803411
+  801578:	e8 99 ed ff ff       	call   800316 <cprintf>
+    return -E_INVAL;
+  80157d:	83 c4 10             	add    $0x10,%esp
+  801580:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801585:	eb d8                	jmp    80155f <read+0x58>
+    return -E_NOT_SUPP;
+  801587:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80158c:	eb d1                	jmp    80155f <read+0x58>
+
+0080158e <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80158e:	55                   	push   %ebp
+  80158f:	89 e5                	mov    %esp,%ebp
+  801591:	57                   	push   %edi
+  801592:	56                   	push   %esi
+  801593:	53                   	push   %ebx
+  801594:	83 ec 0c             	sub    $0xc,%esp
+  801597:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80159a:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  80159d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015a2:	eb 02                	jmp    8015a6 <readn+0x18>
+  8015a4:	01 c3                	add    %eax,%ebx
+  8015a6:	39 f3                	cmp    %esi,%ebx
+  8015a8:	73 21                	jae    8015cb <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  8015aa:	83 ec 04             	sub    $0x4,%esp
+  8015ad:	89 f0                	mov    %esi,%eax
+  8015af:	29 d8                	sub    %ebx,%eax
+  8015b1:	50                   	push   %eax
+  8015b2:	89 d8                	mov    %ebx,%eax
+  8015b4:	03 45 0c             	add    0xc(%ebp),%eax
+  8015b7:	50                   	push   %eax
+  8015b8:	57                   	push   %edi
+  8015b9:	e8 49 ff ff ff       	call   801507 <read>
+    if (m < 0)
+  8015be:	83 c4 10             	add    $0x10,%esp
+  8015c1:	85 c0                	test   %eax,%eax
+  8015c3:	78 04                	js     8015c9 <readn+0x3b>
+      return m;
+    if (m == 0)
+  8015c5:	75 dd                	jne    8015a4 <readn+0x16>
+  8015c7:	eb 02                	jmp    8015cb <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  8015c9:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  8015cb:	89 d8                	mov    %ebx,%eax
+  8015cd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015d0:	5b                   	pop    %ebx
+  8015d1:	5e                   	pop    %esi
+  8015d2:	5f                   	pop    %edi
+  8015d3:	5d                   	pop    %ebp
+  8015d4:	c3                   	ret
+
+008015d5 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8015d5:	55                   	push   %ebp
+  8015d6:	89 e5                	mov    %esp,%ebp
+  8015d8:	56                   	push   %esi
+  8015d9:	53                   	push   %ebx
+  8015da:	83 ec 18             	sub    $0x18,%esp
+  8015dd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  8015e0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8015e3:	50                   	push   %eax
+  8015e4:	53                   	push   %ebx
+  8015e5:	e8 72 fc ff ff       	call   80125c <fd_lookup>
+  8015ea:	83 c4 10             	add    $0x10,%esp
+  8015ed:	85 c0                	test   %eax,%eax
+  8015ef:	78 37                	js     801628 <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8015f1:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8015f4:	83 ec 08             	sub    $0x8,%esp
+  8015f7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015fa:	50                   	push   %eax
+  8015fb:	ff 36                	push   (%esi)
+  8015fd:	e8 aa fc ff ff       	call   8012ac <dev_lookup>
+  801602:	83 c4 10             	add    $0x10,%esp
+  801605:	85 c0                	test   %eax,%eax
+  801607:	78 1f                	js     801628 <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801609:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80160d:	74 20                	je     80162f <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  80160f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801612:	8b 40 0c             	mov    0xc(%eax),%eax
+  801615:	85 c0                	test   %eax,%eax
+  801617:	74 37                	je     801650 <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  801619:	83 ec 04             	sub    $0x4,%esp
+  80161c:	ff 75 10             	push   0x10(%ebp)
+  80161f:	ff 75 0c             	push   0xc(%ebp)
+  801622:	56                   	push   %esi
+  801623:	ff d0                	call   *%eax
+  801625:	83 c4 10             	add    $0x10,%esp
+}
+  801628:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80162b:	5b                   	pop    %ebx
+  80162c:	5e                   	pop    %esi
+  80162d:	5d                   	pop    %ebp
+  80162e:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80162f:	a1 44 57 80 00       	mov    0x805744,%eax
+  801634:	8b 40 48             	mov    0x48(%eax),%eax
+  801637:	83 ec 04             	sub    $0x4,%esp
+  80163a:	53                   	push   %ebx
+  80163b:	50                   	push   %eax
+  80163c:	68 2d 34 80 00       	push   $0x80342d
+  801641:	e8 d0 ec ff ff       	call   800316 <cprintf>
+    return -E_INVAL;
+  801646:	83 c4 10             	add    $0x10,%esp
+  801649:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80164e:	eb d8                	jmp    801628 <write+0x53>
+    return -E_NOT_SUPP;
+  801650:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801655:	eb d1                	jmp    801628 <write+0x53>
+
+00801657 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801657:	55                   	push   %ebp
+  801658:	89 e5                	mov    %esp,%ebp
+  80165a:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80165d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801660:	50                   	push   %eax
+  801661:	ff 75 08             	push   0x8(%ebp)
+  801664:	e8 f3 fb ff ff       	call   80125c <fd_lookup>
+  801669:	83 c4 10             	add    $0x10,%esp
+  80166c:	85 c0                	test   %eax,%eax
+  80166e:	78 0e                	js     80167e <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  801670:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801673:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801676:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  801679:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80167e:	c9                   	leave
+  80167f:	c3                   	ret
+
+00801680 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801680:	55                   	push   %ebp
+  801681:	89 e5                	mov    %esp,%ebp
+  801683:	56                   	push   %esi
+  801684:	53                   	push   %ebx
+  801685:	83 ec 18             	sub    $0x18,%esp
+  801688:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  80168b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80168e:	50                   	push   %eax
+  80168f:	53                   	push   %ebx
+  801690:	e8 c7 fb ff ff       	call   80125c <fd_lookup>
+  801695:	83 c4 10             	add    $0x10,%esp
+  801698:	85 c0                	test   %eax,%eax
+  80169a:	78 34                	js     8016d0 <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80169c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80169f:	83 ec 08             	sub    $0x8,%esp
+  8016a2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016a5:	50                   	push   %eax
+  8016a6:	ff 36                	push   (%esi)
+  8016a8:	e8 ff fb ff ff       	call   8012ac <dev_lookup>
+  8016ad:	83 c4 10             	add    $0x10,%esp
+  8016b0:	85 c0                	test   %eax,%eax
+  8016b2:	78 1c                	js     8016d0 <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8016b4:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8016b8:	74 1d                	je     8016d7 <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  8016ba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016bd:	8b 40 18             	mov    0x18(%eax),%eax
+  8016c0:	85 c0                	test   %eax,%eax
+  8016c2:	74 34                	je     8016f8 <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  8016c4:	83 ec 08             	sub    $0x8,%esp
+  8016c7:	ff 75 0c             	push   0xc(%ebp)
+  8016ca:	56                   	push   %esi
+  8016cb:	ff d0                	call   *%eax
+  8016cd:	83 c4 10             	add    $0x10,%esp
+}
+  8016d0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016d3:	5b                   	pop    %ebx
+  8016d4:	5e                   	pop    %esi
+  8016d5:	5d                   	pop    %ebp
+  8016d6:	c3                   	ret
+            thisenv->env_id, fdnum);
+  8016d7:	a1 44 57 80 00       	mov    0x805744,%eax
+  8016dc:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8016df:	83 ec 04             	sub    $0x4,%esp
+  8016e2:	53                   	push   %ebx
+  8016e3:	50                   	push   %eax
+  8016e4:	68 f0 33 80 00       	push   $0x8033f0
+  8016e9:	e8 28 ec ff ff       	call   800316 <cprintf>
+    return -E_INVAL;
+  8016ee:	83 c4 10             	add    $0x10,%esp
+  8016f1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016f6:	eb d8                	jmp    8016d0 <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  8016f8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016fd:	eb d1                	jmp    8016d0 <ftruncate+0x50>
+
+008016ff <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8016ff:	55                   	push   %ebp
+  801700:	89 e5                	mov    %esp,%ebp
+  801702:	56                   	push   %esi
+  801703:	53                   	push   %ebx
+  801704:	83 ec 18             	sub    $0x18,%esp
+  801707:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  80170a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80170d:	50                   	push   %eax
+  80170e:	ff 75 08             	push   0x8(%ebp)
+  801711:	e8 46 fb ff ff       	call   80125c <fd_lookup>
+  801716:	83 c4 10             	add    $0x10,%esp
+  801719:	85 c0                	test   %eax,%eax
+  80171b:	78 49                	js     801766 <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80171d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801720:	83 ec 08             	sub    $0x8,%esp
+  801723:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801726:	50                   	push   %eax
+  801727:	ff 36                	push   (%esi)
+  801729:	e8 7e fb ff ff       	call   8012ac <dev_lookup>
+  80172e:	83 c4 10             	add    $0x10,%esp
+  801731:	85 c0                	test   %eax,%eax
+  801733:	78 31                	js     801766 <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  801735:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801738:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80173c:	74 2f                	je     80176d <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  80173e:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  801741:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801748:	00 00 00 
+  stat->st_isdir = 0;
+  80174b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801752:	00 00 00 
+  stat->st_dev = dev;
+  801755:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  80175b:	83 ec 08             	sub    $0x8,%esp
+  80175e:	53                   	push   %ebx
+  80175f:	56                   	push   %esi
+  801760:	ff 50 14             	call   *0x14(%eax)
+  801763:	83 c4 10             	add    $0x10,%esp
+}
+  801766:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801769:	5b                   	pop    %ebx
+  80176a:	5e                   	pop    %esi
+  80176b:	5d                   	pop    %ebp
+  80176c:	c3                   	ret
+    return -E_NOT_SUPP;
+  80176d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801772:	eb f2                	jmp    801766 <fstat+0x67>
+
+00801774 <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  801774:	55                   	push   %ebp
+  801775:	89 e5                	mov    %esp,%ebp
+  801777:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  80177a:	ff 75 0c             	push   0xc(%ebp)
+  80177d:	ff 75 08             	push   0x8(%ebp)
+  801780:	e8 58 07 00 00       	call   801edd <file_stat>
+}
+  801785:	c9                   	leave
+  801786:	c3                   	ret
+
+00801787 <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  801787:	55                   	push   %ebp
+  801788:	89 e5                	mov    %esp,%ebp
+  80178a:	57                   	push   %edi
+  80178b:	56                   	push   %esi
+  80178c:	53                   	push   %ebx
+  80178d:	83 ec 1c             	sub    $0x1c,%esp
+  801790:	89 c7                	mov    %eax,%edi
+  801792:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801795:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801798:	e9 a2 00 00 00       	jmp    80183f <fsipc_send+0xb8>
+  nfsenvs = 0;
+  80179d:	c7 05 00 50 80 00 00 	movl   $0x0,0x805000
+  8017a4:	00 00 00 
+  8017a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017ac:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  8017b1:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  8017b6:	be 01 00 00 00       	mov    $0x1,%esi
+  8017bb:	eb 0f                	jmp    8017cc <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  8017bd:	83 c0 01             	add    $0x1,%eax
+  8017c0:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8017c5:	74 49                	je     801810 <fsipc_send+0x89>
+  8017c7:	83 f9 07             	cmp    $0x7,%ecx
+  8017ca:	7f 50                	jg     80181c <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  8017cc:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  8017cf:	c1 e2 04             	shl    $0x4,%edx
+  8017d2:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8017d8:	8b 52 50             	mov    0x50(%edx),%edx
+  8017db:	83 fa 01             	cmp    $0x1,%edx
+  8017de:	75 dd                	jne    8017bd <fsipc_send+0x36>
+  8017e0:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  8017e3:	c1 e2 04             	shl    $0x4,%edx
+  8017e6:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8017ec:	8b 52 54             	mov    0x54(%edx),%edx
+  8017ef:	85 d2                	test   %edx,%edx
+  8017f1:	74 ca                	je     8017bd <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  8017f3:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  8017f6:	c1 e2 04             	shl    $0x4,%edx
+  8017f9:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8017ff:	8b 52 48             	mov    0x48(%edx),%edx
+  801802:	89 14 8d 20 50 80 00 	mov    %edx,0x805020(,%ecx,4)
+  801809:	8d 49 01             	lea    0x1(%ecx),%ecx
+  80180c:	89 f3                	mov    %esi,%ebx
+  80180e:	eb ad                	jmp    8017bd <fsipc_send+0x36>
+  801810:	84 db                	test   %bl,%bl
+  801812:	74 38                	je     80184c <fsipc_send+0xc5>
+  801814:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  80181a:	eb 30                	jmp    80184c <fsipc_send+0xc5>
+  80181c:	84 db                	test   %bl,%bl
+  80181e:	74 2c                	je     80184c <fsipc_send+0xc5>
+  801820:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  801826:	eb 24                	jmp    80184c <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  801828:	50                   	push   %eax
+  801829:	68 5c 34 80 00       	push   $0x80345c
+  80182e:	6a 34                	push   $0x34
+  801830:	68 66 34 80 00       	push   $0x803466
+  801835:	e8 01 ea ff ff       	call   80023b <_panic>
+    }
+    sys_yield();
+  80183a:	e8 92 f4 ff ff       	call   800cd1 <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  80183f:	83 3d 00 50 80 00 03 	cmpl   $0x3,0x805000
+  801846:	0f 8e 51 ff ff ff    	jle    80179d <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  80184c:	a1 44 57 80 00       	mov    0x805744,%eax
+  801851:	8b 70 48             	mov    0x48(%eax),%esi
+  801854:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  80185a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80185f:	8b 0d 00 50 80 00    	mov    0x805000,%ecx
+  801865:	39 d9                	cmp    %ebx,%ecx
+  801867:	7e d1                	jle    80183a <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  801869:	83 ec 0c             	sub    $0xc,%esp
+  80186c:	ff 75 e0             	push   -0x20(%ebp)
+  80186f:	6a 07                	push   $0x7
+  801871:	ff 75 e4             	push   -0x1c(%ebp)
+  801874:	57                   	push   %edi
+  801875:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  801878:	99                   	cltd
+  801879:	f7 f9                	idiv   %ecx
+  80187b:	ff 34 95 20 50 80 00 	push   0x805020(,%edx,4)
+  801882:	e8 63 f7 ff ff       	call   800fea <sys_ipc_try_send>
+      if (r == 0)
+  801887:	83 c4 20             	add    $0x20,%esp
+  80188a:	85 c0                	test   %eax,%eax
+  80188c:	74 0a                	je     801898 <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  80188e:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801891:	75 95                	jne    801828 <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  801893:	83 c3 01             	add    $0x1,%ebx
+  801896:	eb c7                	jmp    80185f <fsipc_send+0xd8>
+  }
+}
+  801898:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80189b:	5b                   	pop    %ebx
+  80189c:	5e                   	pop    %esi
+  80189d:	5f                   	pop    %edi
+  80189e:	5d                   	pop    %ebp
+  80189f:	c3                   	ret
+
+008018a0 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8018a0:	55                   	push   %ebp
+  8018a1:	89 e5                	mov    %esp,%ebp
+  8018a3:	53                   	push   %ebx
+  8018a4:	83 ec 14             	sub    $0x14,%esp
+  8018a7:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  8018a9:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  8018b0:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8018b5:	ba 00 60 80 00       	mov    $0x806000,%edx
+  8018ba:	e8 c8 fe ff ff       	call   801787 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  8018bf:	6a 00                	push   $0x0
+  8018c1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018c4:	50                   	push   %eax
+  8018c5:	53                   	push   %ebx
+  8018c6:	6a 00                	push   $0x0
+  8018c8:	e8 26 13 00 00       	call   802bf3 <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  8018cd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018d0:	c9                   	leave
+  8018d1:	c3                   	ret
+
+008018d2 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8018d2:	55                   	push   %ebp
+  8018d3:	89 e5                	mov    %esp,%ebp
+  8018d5:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8018d8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018db:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018de:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.set_size.req_size = newsize;
+  8018e3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8018e6:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  8018eb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018f0:	b8 02 00 00 00       	mov    $0x2,%eax
+  8018f5:	e8 a6 ff ff ff       	call   8018a0 <fsipc>
+}
+  8018fa:	c9                   	leave
+  8018fb:	c3                   	ret
+
+008018fc <devfile_flush>:
+{
+  8018fc:	55                   	push   %ebp
+  8018fd:	89 e5                	mov    %esp,%ebp
+  8018ff:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801902:	8b 45 08             	mov    0x8(%ebp),%eax
+  801905:	8b 40 0c             	mov    0xc(%eax),%eax
+  801908:	a3 00 60 80 00       	mov    %eax,0x806000
+  return fsipc(FSREQ_FLUSH, NULL);
+  80190d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801912:	b8 06 00 00 00       	mov    $0x6,%eax
+  801917:	e8 84 ff ff ff       	call   8018a0 <fsipc>
+}
+  80191c:	c9                   	leave
+  80191d:	c3                   	ret
+
+0080191e <devfile_stat>:
+{
+  80191e:	55                   	push   %ebp
+  80191f:	89 e5                	mov    %esp,%ebp
+  801921:	53                   	push   %ebx
+  801922:	83 ec 04             	sub    $0x4,%esp
+  801925:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801928:	8b 45 08             	mov    0x8(%ebp),%eax
+  80192b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80192e:	a3 00 60 80 00       	mov    %eax,0x806000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801933:	ba 00 00 00 00       	mov    $0x0,%edx
+  801938:	b8 05 00 00 00       	mov    $0x5,%eax
+  80193d:	e8 5e ff ff ff       	call   8018a0 <fsipc>
+  801942:	85 c0                	test   %eax,%eax
+  801944:	78 2c                	js     801972 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801946:	83 ec 08             	sub    $0x8,%esp
+  801949:	68 00 60 80 00       	push   $0x806000
+  80194e:	53                   	push   %ebx
+  80194f:	e8 b0 ef ff ff       	call   800904 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  801954:	a1 80 60 80 00       	mov    0x806080,%eax
+  801959:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80195f:	a1 84 60 80 00       	mov    0x806084,%eax
+  801964:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  80196a:	83 c4 10             	add    $0x10,%esp
+  80196d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801972:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801975:	c9                   	leave
+  801976:	c3                   	ret
+
+00801977 <fsv_alloc>:
+{
+  801977:	55                   	push   %ebp
+  801978:	89 e5                	mov    %esp,%ebp
+  80197a:	56                   	push   %esi
+  80197b:	53                   	push   %ebx
+  80197c:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  80197e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801983:	eb 22                	jmp    8019a7 <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  801985:	83 ec 04             	sub    $0x4,%esp
+  801988:	6a 00                	push   $0x0
+  80198a:	6a 00                	push   $0x0
+  80198c:	6a 07                	push   $0x7
+  80198e:	50                   	push   %eax
+  80198f:	6a 00                	push   $0x0
+  801991:	6a 04                	push   $0x4
+  801993:	68 40 50 80 00       	push   $0x805040
+  801998:	e8 e9 f7 ff ff       	call   801186 <sysbatch_add>
+  80199d:	83 c4 20             	add    $0x20,%esp
+  8019a0:	85 c0                	test   %eax,%eax
+  8019a2:	78 48                	js     8019ec <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  8019a4:	83 c3 01             	add    $0x1,%ebx
+  8019a7:	39 f3                	cmp    %esi,%ebx
+  8019a9:	74 31                	je     8019dc <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  8019ab:	89 d8                	mov    %ebx,%eax
+  8019ad:	c1 e0 0c             	shl    $0xc,%eax
+  8019b0:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  8019b5:	89 c2                	mov    %eax,%edx
+  8019b7:	c1 ea 16             	shr    $0x16,%edx
+  8019ba:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8019c1:	f6 c2 01             	test   $0x1,%dl
+  8019c4:	74 bf                	je     801985 <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  8019c6:	89 c2                	mov    %eax,%edx
+  8019c8:	c1 ea 0c             	shr    $0xc,%edx
+  8019cb:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8019d2:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  8019d5:	83 fa 03             	cmp    $0x3,%edx
+  8019d8:	75 ab                	jne    801985 <fsv_alloc+0xe>
+  8019da:	eb c8                	jmp    8019a4 <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  8019dc:	83 ec 0c             	sub    $0xc,%esp
+  8019df:	68 40 50 80 00       	push   $0x805040
+  8019e4:	e8 4d f7 ff ff       	call   801136 <sysbatch_flush>
+  8019e9:	83 c4 10             	add    $0x10,%esp
+}
+  8019ec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019ef:	5b                   	pop    %ebx
+  8019f0:	5e                   	pop    %esi
+  8019f1:	5d                   	pop    %ebp
+  8019f2:	c3                   	ret
+
+008019f3 <devfile_read>:
+{
+  8019f3:	55                   	push   %ebp
+  8019f4:	89 e5                	mov    %esp,%ebp
+  8019f6:	57                   	push   %edi
+  8019f7:	56                   	push   %esi
+  8019f8:	53                   	push   %ebx
+  8019f9:	83 ec 3c             	sub    $0x3c,%esp
+  8019fc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  8019ff:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  801a05:	77 57                	ja     801a5e <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801a07:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a0a:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a0d:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read.req_n = n;
+  801a12:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801a18:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a1d:	b8 03 00 00 00       	mov    $0x3,%eax
+  801a22:	e8 79 fe ff ff       	call   8018a0 <fsipc>
+  801a27:	89 c6                	mov    %eax,%esi
+  801a29:	85 c0                	test   %eax,%eax
+  801a2b:	78 27                	js     801a54 <devfile_read+0x61>
+  assert(r <= n);
+  801a2d:	39 c3                	cmp    %eax,%ebx
+  801a2f:	0f 82 0e 02 00 00    	jb     801c43 <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  801a35:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801a3a:	0f 8f 1c 02 00 00    	jg     801c5c <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801a40:	83 ec 04             	sub    $0x4,%esp
+  801a43:	50                   	push   %eax
+  801a44:	68 00 60 80 00       	push   $0x806000
+  801a49:	ff 75 0c             	push   0xc(%ebp)
+  801a4c:	e8 39 f0 ff ff       	call   800a8a <memmove>
+  return r;
+  801a51:	83 c4 10             	add    $0x10,%esp
+}
+  801a54:	89 f0                	mov    %esi,%eax
+  801a56:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a59:	5b                   	pop    %ebx
+  801a5a:	5e                   	pop    %esi
+  801a5b:	5f                   	pop    %edi
+  801a5c:	5d                   	pop    %ebp
+  801a5d:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  801a5e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a63:	e8 0f ff ff ff       	call   801977 <fsv_alloc>
+  801a68:	89 c6                	mov    %eax,%esi
+  801a6a:	85 c0                	test   %eax,%eax
+  801a6c:	78 e6                	js     801a54 <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  801a6e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a71:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a74:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  801a79:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a7c:	8b 40 04             	mov    0x4(%eax),%eax
+  801a7f:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  801a84:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  801a8a:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801a91:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801a96:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801a9b:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801aa0:	e8 e2 fc ff ff       	call   801787 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801aa5:	6a 00                	push   $0x0
+  801aa7:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801aaa:	50                   	push   %eax
+  801aab:	68 00 10 c0 9f       	push   $0x9fc01000
+  801ab0:	6a 00                	push   $0x0
+  801ab2:	e8 3c 11 00 00       	call   802bf3 <ipc_recv_pages>
+  801ab7:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  801ab9:	83 c4 10             	add    $0x10,%esp
+  801abc:	85 c0                	test   %eax,%eax
+  801abe:	7e 94                	jle    801a54 <devfile_read+0x61>
+  assert(r <= n);
+  801ac0:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801ac3:	39 c3                	cmp    %eax,%ebx
+  801ac5:	72 2e                	jb     801af5 <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801ac7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801aca:	8b 40 04             	mov    0x4(%eax),%eax
+  801acd:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801ad2:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  801ad5:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801ad8:	c1 e2 0c             	shl    $0xc,%edx
+  801adb:	39 ca                	cmp    %ecx,%edx
+  801add:	72 2f                	jb     801b0e <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  801adf:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  801ae4:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  801ae7:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  801aeb:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801af0:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  801af3:	eb 52                	jmp    801b47 <devfile_read+0x154>
+  assert(r <= n);
+  801af5:	68 71 34 80 00       	push   $0x803471
+  801afa:	68 78 34 80 00       	push   $0x803478
+  801aff:	68 49 01 00 00       	push   $0x149
+  801b04:	68 66 34 80 00       	push   $0x803466
+  801b09:	e8 2d e7 ff ff       	call   80023b <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801b0e:	68 9c 34 80 00       	push   $0x80349c
+  801b13:	68 78 34 80 00       	push   $0x803478
+  801b18:	68 4a 01 00 00       	push   $0x14a
+  801b1d:	68 66 34 80 00       	push   $0x803466
+  801b22:	e8 14 e7 ff ff       	call   80023b <_panic>
+      memmove(dst + done, src + done, m);
+  801b27:	83 ec 04             	sub    $0x4,%esp
+  801b2a:	53                   	push   %ebx
+  801b2b:	56                   	push   %esi
+  801b2c:	89 f8                	mov    %edi,%eax
+  801b2e:	03 45 0c             	add    0xc(%ebp),%eax
+  801b31:	50                   	push   %eax
+  801b32:	e8 53 ef ff ff       	call   800a8a <memmove>
+  801b37:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  801b3a:	01 df                	add    %ebx,%edi
+  801b3c:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801b3f:	39 c7                	cmp    %eax,%edi
+  801b41:	0f 83 c0 00 00 00    	jae    801c07 <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801b47:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801b4a:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  801b4d:	89 f0                	mov    %esi,%eax
+  801b4f:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801b54:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  801b59:	29 c3                	sub    %eax,%ebx
+  801b5b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801b5e:	29 f8                	sub    %edi,%eax
+  801b60:	39 c3                	cmp    %eax,%ebx
+  801b62:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  801b65:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801b6b:	75 ba                	jne    801b27 <devfile_read+0x134>
+  801b6d:	89 f9                	mov    %edi,%ecx
+  801b6f:	03 4d 0c             	add    0xc(%ebp),%ecx
+  801b72:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  801b75:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  801b7b:	75 aa                	jne    801b27 <devfile_read+0x134>
+  801b7d:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  801b83:	77 a2                	ja     801b27 <devfile_read+0x134>
+  801b85:	89 c8                	mov    %ecx,%eax
+  801b87:	c1 e8 16             	shr    $0x16,%eax
+  801b8a:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801b91:	a8 01                	test   $0x1,%al
+  801b93:	74 92                	je     801b27 <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  801b95:	89 c8                	mov    %ecx,%eax
+  801b97:	c1 e8 0c             	shr    $0xc,%eax
+  801b9a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  801ba1:	a8 01                	test   $0x1,%al
+  801ba3:	74 82                	je     801b27 <devfile_read+0x134>
+  801ba5:	a9 02 08 00 00       	test   $0x802,%eax
+  801baa:	0f 84 77 ff ff ff    	je     801b27 <devfile_read+0x134>
+  801bb0:	f6 c4 04             	test   $0x4,%ah
+  801bb3:	0f 85 6e ff ff ff    	jne    801b27 <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  801bb9:	a1 44 57 80 00       	mov    0x805744,%eax
+  801bbe:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  801bc2:	84 c0                	test   %al,%al
+  801bc4:	75 17                	jne    801bdd <devfile_read+0x1ea>
+  801bc6:	83 ec 08             	sub    $0x8,%esp
+  801bc9:	6a 01                	push   $0x1
+  801bcb:	6a 00                	push   $0x0
+  801bcd:	e8 1e f1 ff ff       	call   800cf0 <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  801bd2:	83 c4 10             	add    $0x10,%esp
+  801bd5:	85 c0                	test   %eax,%eax
+  801bd7:	0f 85 4a ff ff ff    	jne    801b27 <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  801bdd:	83 ec 04             	sub    $0x4,%esp
+  801be0:	68 05 08 00 00       	push   $0x805
+  801be5:	ff 75 cc             	push   -0x34(%ebp)
+  801be8:	6a 00                	push   $0x0
+  801bea:	56                   	push   %esi
+  801beb:	6a 00                	push   $0x0
+  801bed:	6a 05                	push   $0x5
+  801bef:	68 40 50 80 00       	push   $0x805040
+  801bf4:	e8 8d f5 ff ff       	call   801186 <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  801bf9:	c1 e8 1f             	shr    $0x1f,%eax
+  801bfc:	08 45 cb             	or     %al,-0x35(%ebp)
+  801bff:	83 c4 20             	add    $0x20,%esp
+  801c02:	e9 33 ff ff ff       	jmp    801b3a <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  801c07:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  801c0a:	83 ec 0c             	sub    $0xc,%esp
+  801c0d:	68 40 50 80 00       	push   $0x805040
+  801c12:	e8 1f f5 ff ff       	call   801136 <sysbatch_flush>
+  801c17:	83 c4 10             	add    $0x10,%esp
+  801c1a:	85 c0                	test   %eax,%eax
+  801c1c:	78 06                	js     801c24 <devfile_read+0x231>
+  801c1e:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  801c22:	74 14                	je     801c38 <devfile_read+0x245>
+    memmove(dst, src, r);
+  801c24:	83 ec 04             	sub    $0x4,%esp
+  801c27:	ff 75 d4             	push   -0x2c(%ebp)
+  801c2a:	ff 75 d0             	push   -0x30(%ebp)
+  801c2d:	ff 75 0c             	push   0xc(%ebp)
+  801c30:	e8 55 ee ff ff       	call   800a8a <memmove>
+  801c35:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  801c38:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c3b:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  801c3e:	e9 11 fe ff ff       	jmp    801a54 <devfile_read+0x61>
+  assert(r <= n);
+  801c43:	68 71 34 80 00       	push   $0x803471
+  801c48:	68 78 34 80 00       	push   $0x803478
+  801c4d:	68 1c 01 00 00       	push   $0x11c
+  801c52:	68 66 34 80 00       	push   $0x803466
+  801c57:	e8 df e5 ff ff       	call   80023b <_panic>
+  assert(r <= PGSIZE);
+  801c5c:	68 8d 34 80 00       	push   $0x80348d
+  801c61:	68 78 34 80 00       	push   $0x803478
+  801c66:	68 1d 01 00 00       	push   $0x11d
+  801c6b:	68 66 34 80 00       	push   $0x803466
+  801c70:	e8 c6 e5 ff ff       	call   80023b <_panic>
+
+00801c75 <devfile_write>:
+{
+  801c75:	55                   	push   %ebp
+  801c76:	89 e5                	mov    %esp,%ebp
+  801c78:	57                   	push   %edi
+  801c79:	56                   	push   %esi
+  801c7a:	53                   	push   %ebx
+  801c7b:	83 ec 1c             	sub    $0x1c,%esp
+  801c7e:	8b 75 08             	mov    0x8(%ebp),%esi
+  801c81:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  801c84:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  801c89:	77 39                	ja     801cc4 <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801c8b:	8b 56 0c             	mov    0xc(%esi),%edx
+  801c8e:	89 15 00 60 80 00    	mov    %edx,0x806000
+  fsipcbuf.write.req_n = n;
+  801c94:	a3 04 60 80 00       	mov    %eax,0x806004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  801c99:	83 ec 04             	sub    $0x4,%esp
+  801c9c:	50                   	push   %eax
+  801c9d:	ff 75 0c             	push   0xc(%ebp)
+  801ca0:	68 08 60 80 00       	push   $0x806008
+  801ca5:	e8 e0 ed ff ff       	call   800a8a <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801caa:	ba 00 00 00 00       	mov    $0x0,%edx
+  801caf:	b8 04 00 00 00       	mov    $0x4,%eax
+  801cb4:	e8 e7 fb ff ff       	call   8018a0 <fsipc>
+  801cb9:	83 c4 10             	add    $0x10,%esp
+}
+  801cbc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cbf:	5b                   	pop    %ebx
+  801cc0:	5e                   	pop    %esi
+  801cc1:	5f                   	pop    %edi
+  801cc2:	5d                   	pop    %ebp
+  801cc3:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  801cc4:	ba 00 00 10 00       	mov    $0x100000,%edx
+  801cc9:	39 d0                	cmp    %edx,%eax
+  801ccb:	89 d3                	mov    %edx,%ebx
+  801ccd:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  801cd0:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  801cd6:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  801cd9:	83 c7 01             	add    $0x1,%edi
+  801cdc:	89 f8                	mov    %edi,%eax
+  801cde:	e8 94 fc ff ff       	call   801977 <fsv_alloc>
+  801ce3:	85 c0                	test   %eax,%eax
+  801ce5:	78 d5                	js     801cbc <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  801ce7:	83 ec 04             	sub    $0x4,%esp
+  801cea:	53                   	push   %ebx
+  801ceb:	ff 75 0c             	push   0xc(%ebp)
+  801cee:	68 00 10 c0 9f       	push   $0x9fc01000
+  801cf3:	e8 92 ed ff ff       	call   800a8a <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  801cf8:	8b 46 0c             	mov    0xc(%esi),%eax
+  801cfb:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  801d00:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  801d06:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801d0d:	89 f9                	mov    %edi,%ecx
+  801d0f:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801d14:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801d19:	e8 69 fa ff ff       	call   801787 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801d1e:	6a 00                	push   $0x0
+  801d20:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801d23:	50                   	push   %eax
+  801d24:	6a 00                	push   $0x0
+  801d26:	6a 00                	push   $0x0
+  801d28:	e8 c6 0e 00 00       	call   802bf3 <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  801d2d:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  801d30:	eb 8a                	jmp    801cbc <devfile_write+0x47>
+
+00801d32 <open>:
+{
+  801d32:	55                   	push   %ebp
+  801d33:	89 e5                	mov    %esp,%ebp
+  801d35:	56                   	push   %esi
+  801d36:	53                   	push   %ebx
+  801d37:	83 ec 1c             	sub    $0x1c,%esp
+  801d3a:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801d3d:	56                   	push   %esi
+  801d3e:	e8 86 eb ff ff       	call   8008c9 <strlen>
+  801d43:	83 c4 10             	add    $0x10,%esp
+  801d46:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801d4b:	7f 6c                	jg     801db9 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  801d4d:	83 ec 0c             	sub    $0xc,%esp
+  801d50:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d53:	50                   	push   %eax
+  801d54:	e8 ad f4 ff ff       	call   801206 <fd_alloc>
+  801d59:	89 c3                	mov    %eax,%ebx
+  801d5b:	83 c4 10             	add    $0x10,%esp
+  801d5e:	85 c0                	test   %eax,%eax
+  801d60:	78 3c                	js     801d9e <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801d62:	83 ec 08             	sub    $0x8,%esp
+  801d65:	56                   	push   %esi
+  801d66:	68 00 60 80 00       	push   $0x806000
+  801d6b:	e8 94 eb ff ff       	call   800904 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801d70:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d73:	a3 00 64 80 00       	mov    %eax,0x806400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801d78:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801d7b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801d80:	e8 1b fb ff ff       	call   8018a0 <fsipc>
+  801d85:	89 c3                	mov    %eax,%ebx
+  801d87:	83 c4 10             	add    $0x10,%esp
+  801d8a:	85 c0                	test   %eax,%eax
+  801d8c:	78 19                	js     801da7 <open+0x75>
+  return fd2num(fd);
+  801d8e:	83 ec 0c             	sub    $0xc,%esp
+  801d91:	ff 75 f4             	push   -0xc(%ebp)
+  801d94:	e8 49 f4 ff ff       	call   8011e2 <fd2num>
+  801d99:	89 c3                	mov    %eax,%ebx
+  801d9b:	83 c4 10             	add    $0x10,%esp
+}
+  801d9e:	89 d8                	mov    %ebx,%eax
+  801da0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801da3:	5b                   	pop    %ebx
+  801da4:	5e                   	pop    %esi
+  801da5:	5d                   	pop    %ebp
+  801da6:	c3                   	ret
+    fd_close(fd, 0);
+  801da7:	83 ec 08             	sub    $0x8,%esp
+  801daa:	6a 00                	push   $0x0
+  801dac:	ff 75 f4             	push   -0xc(%ebp)
+  801daf:	e8 44 f5 ff ff       	call   8012f8 <fd_close>
+    return r;
+  801db4:	83 c4 10             	add    $0x10,%esp
+  801db7:	eb e5                	jmp    801d9e <open+0x6c>
+    return -E_BAD_PATH;
+  801db9:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801dbe:	eb de                	jmp    801d9e <open+0x6c>
+
+00801dc0 <open_read>:
+{
+  801dc0:	55                   	push   %ebp
+  801dc1:	89 e5                	mov    %esp,%ebp
+  801dc3:	57                   	push   %edi
+  801dc4:	56                   	push   %esi
+  801dc5:	53                   	push   %ebx
+  801dc6:	83 ec 28             	sub    $0x28,%esp
+  801dc9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  801dcc:	57                   	push   %edi
+  801dcd:	e8 f7 ea ff ff       	call   8008c9 <strlen>
+  801dd2:	83 c4 10             	add    $0x10,%esp
+  801dd5:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801dda:	0f 87 f6 00 00 00    	ja     801ed6 <open_read+0x116>
+  801de0:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  801de2:	83 ec 0c             	sub    $0xc,%esp
+  801de5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801de8:	50                   	push   %eax
+  801de9:	e8 18 f4 ff ff       	call   801206 <fd_alloc>
+  801dee:	89 c3                	mov    %eax,%ebx
+  801df0:	83 c4 10             	add    $0x10,%esp
+  801df3:	85 c0                	test   %eax,%eax
+  801df5:	0f 88 b2 00 00 00    	js     801ead <open_read+0xed>
+  strcpy(req->req_buf, path);
+  801dfb:	83 ec 08             	sub    $0x8,%esp
+  801dfe:	57                   	push   %edi
+  801dff:	68 e4 60 80 00       	push   $0x8060e4
+  801e04:	e8 fb ea ff ff       	call   800904 <strcpy>
+  req->req_nops = 2;
+  801e09:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  801e10:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  801e13:	c7 05 04 60 80 00 01 	movl   $0x1,0x806004
+  801e1a:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  801e1d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e20:	a3 10 60 80 00       	mov    %eax,0x806010
+  req->req_ops[0].op_buf = 0;
+  801e25:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  801e2c:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  801e2f:	c7 05 20 60 80 00 04 	movl   $0x4,0x806020
+  801e36:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  801e39:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  801e40:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  801e43:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  801e48:	29 f0                	sub    %esi,%eax
+  801e4a:	3b 45 14             	cmp    0x14(%ebp),%eax
+  801e4d:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  801e51:	a3 2c 60 80 00       	mov    %eax,0x80602c
+  req->req_ops[1].op_offset = 0;
+  801e56:	c7 05 30 60 80 00 00 	movl   $0x0,0x806030
+  801e5d:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  801e60:	83 c6 01             	add    $0x1,%esi
+  801e63:	89 35 34 60 80 00    	mov    %esi,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  801e69:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801e6c:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801e71:	e8 2a fa ff ff       	call   8018a0 <fsipc>
+  801e76:	89 c3                	mov    %eax,%ebx
+  801e78:	83 c4 10             	add    $0x10,%esp
+  801e7b:	83 f8 01             	cmp    $0x1,%eax
+  801e7e:	7e 37                	jle    801eb7 <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  801e80:	a1 38 60 80 00       	mov    0x806038,%eax
+  801e85:	8b 55 18             	mov    0x18(%ebp),%edx
+  801e88:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  801e8a:	83 ec 04             	sub    $0x4,%esp
+  801e8d:	50                   	push   %eax
+  801e8e:	81 c6 e4 60 80 00    	add    $0x8060e4,%esi
+  801e94:	56                   	push   %esi
+  801e95:	ff 75 10             	push   0x10(%ebp)
+  801e98:	e8 ed eb ff ff       	call   800a8a <memmove>
+  return fd2num(fd);
+  801e9d:	83 c4 04             	add    $0x4,%esp
+  801ea0:	ff 75 e4             	push   -0x1c(%ebp)
+  801ea3:	e8 3a f3 ff ff       	call   8011e2 <fd2num>
+  801ea8:	89 c3                	mov    %eax,%ebx
+  801eaa:	83 c4 10             	add    $0x10,%esp
+}
+  801ead:	89 d8                	mov    %ebx,%eax
+  801eaf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801eb2:	5b                   	pop    %ebx
+  801eb3:	5e                   	pop    %esi
+  801eb4:	5f                   	pop    %edi
+  801eb5:	5d                   	pop    %ebp
+  801eb6:	c3                   	ret
+    fd_close(fd, 0);
+  801eb7:	83 ec 08             	sub    $0x8,%esp
+  801eba:	6a 00                	push   $0x0
+  801ebc:	ff 75 e4             	push   -0x1c(%ebp)
+  801ebf:	e8 34 f4 ff ff       	call   8012f8 <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  801ec4:	83 c4 10             	add    $0x10,%esp
+  801ec7:	85 db                	test   %ebx,%ebx
+  801ec9:	78 e2                	js     801ead <open_read+0xed>
+  801ecb:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  801ece:	8b 9b 1c 60 80 00    	mov    0x80601c(%ebx),%ebx
+  801ed4:	eb d7                	jmp    801ead <open_read+0xed>
+    return -E_BAD_PATH;
+  801ed6:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801edb:	eb d0                	jmp    801ead <open_read+0xed>
+
+00801edd <file_stat>:
+{
+  801edd:	55                   	push   %ebp
+  801ede:	89 e5                	mov    %esp,%ebp
+  801ee0:	57                   	push   %edi
+  801ee1:	56                   	push   %esi
+  801ee2:	53                   	push   %ebx
+  801ee3:	83 ec 18             	sub    $0x18,%esp
+  801ee6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801ee9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801eec:	57                   	push   %edi
+  801eed:	e8 d7 e9 ff ff       	call   8008c9 <strlen>
+  801ef2:	83 c4 10             	add    $0x10,%esp
+  801ef5:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801efa:	0f 8f c7 00 00 00    	jg     801fc7 <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  801f00:	83 ec 0c             	sub    $0xc,%esp
+  801f03:	57                   	push   %edi
+  801f04:	e8 c0 e9 ff ff       	call   8008c9 <strlen>
+  801f09:	8d 58 04             	lea    0x4(%eax),%ebx
+  801f0c:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  801f0f:	83 c4 08             	add    $0x8,%esp
+  801f12:	57                   	push   %edi
+  801f13:	68 e4 60 80 00       	push   $0x8060e4
+  801f18:	e8 e7 e9 ff ff       	call   800904 <strcpy>
+  req->req_nops = 2;
+  801f1d:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  801f24:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  801f27:	c7 05 04 60 80 00 02 	movl   $0x2,0x806004
+  801f2e:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  801f31:	c7 05 10 60 80 00 00 	movl   $0x0,0x806010
+  801f38:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  801f3b:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  801f42:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  801f45:	c7 05 20 60 80 00 03 	movl   $0x3,0x806020
+  801f4c:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  801f4f:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  801f56:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  801f59:	89 1d 34 60 80 00    	mov    %ebx,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  801f5f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f64:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801f69:	e8 32 f9 ff ff       	call   8018a0 <fsipc>
+  801f6e:	83 c4 10             	add    $0x10,%esp
+  801f71:	83 f8 01             	cmp    $0x1,%eax
+  801f74:	7e 42                	jle    801fb8 <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  801f76:	81 c3 e4 60 80 00    	add    $0x8060e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  801f7c:	83 ec 08             	sub    $0x8,%esp
+  801f7f:	53                   	push   %ebx
+  801f80:	56                   	push   %esi
+  801f81:	e8 7e e9 ff ff       	call   800904 <strcpy>
+  st->st_size = ret->ret_size;
+  801f86:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  801f8c:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  801f92:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  801f98:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  801f9e:	c7 86 88 00 00 00 04 	movl   $0x804004,0x88(%esi)
+  801fa5:	40 80 00 
+  return 0;
+  801fa8:	83 c4 10             	add    $0x10,%esp
+  801fab:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801fb0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fb3:	5b                   	pop    %ebx
+  801fb4:	5e                   	pop    %esi
+  801fb5:	5f                   	pop    %edi
+  801fb6:	5d                   	pop    %ebp
+  801fb7:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  801fb8:	85 c0                	test   %eax,%eax
+  801fba:	78 f4                	js     801fb0 <file_stat+0xd3>
+  801fbc:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801fbf:	8b 80 1c 60 80 00    	mov    0x80601c(%eax),%eax
+  801fc5:	eb e9                	jmp    801fb0 <file_stat+0xd3>
+    return -E_BAD_PATH;
+  801fc7:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801fcc:	eb e2                	jmp    801fb0 <file_stat+0xd3>
+
+00801fce <read_map>:
+{
+  801fce:	55                   	push   %ebp
+  801fcf:	89 e5                	mov    %esp,%ebp
+  801fd1:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801fd4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fd7:	50                   	push   %eax
+  801fd8:	ff 75 08             	push   0x8(%ebp)
+  801fdb:	e8 7c f2 ff ff       	call   80125c <fd_lookup>
+  801fe0:	83 c4 10             	add    $0x10,%esp
+  801fe3:	85 c0                	test   %eax,%eax
+  801fe5:	78 2a                	js     802011 <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  801fe7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801fea:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  801ff0:	39 08                	cmp    %ecx,(%eax)
+  801ff2:	75 1f                	jne    802013 <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  801ff4:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ff7:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read_map.req_offset = offset;
+  801ffc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801fff:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  802004:	8b 55 10             	mov    0x10(%ebp),%edx
+  802007:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80200c:	e8 8f f8 ff ff       	call   8018a0 <fsipc>
+}
+  802011:	c9                   	leave
+  802012:	c3                   	ret
+    return -E_INVAL;
+  802013:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802018:	eb f7                	jmp    802011 <read_map+0x43>
+
+0080201a <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80201a:	55                   	push   %ebp
+  80201b:	89 e5                	mov    %esp,%ebp
+  80201d:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  802020:	ba 00 00 00 00       	mov    $0x0,%edx
+  802025:	b8 08 00 00 00       	mov    $0x8,%eax
+  80202a:	e8 71 f8 ff ff       	call   8018a0 <fsipc>
+}
+  80202f:	c9                   	leave
+  802030:	c3                   	ret
+
+00802031 <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  802031:	55                   	push   %ebp
+  802032:	89 e5                	mov    %esp,%ebp
+  802034:	57                   	push   %edi
+  802035:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  802036:	8b 45 08             	mov    0x8(%ebp),%eax
+  802039:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.stats.req_bio_sched = 0;
+  80203e:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  802045:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  802048:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  80204f:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  802052:	ba 00 00 00 00       	mov    $0x0,%edx
+  802057:	b8 09 00 00 00       	mov    $0x9,%eax
+  80205c:	e8 3f f8 ff ff       	call   8018a0 <fsipc>
+  802061:	85 c0                	test   %eax,%eax
+  802063:	78 14                	js     802079 <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  802065:	be 00 60 80 00       	mov    $0x806000,%esi
+  80206a:	b9 16 00 00 00       	mov    $0x16,%ecx
+  80206f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802072:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  802074:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802079:	5e                   	pop    %esi
+  80207a:	5f                   	pop    %edi
+  80207b:	5d                   	pop    %ebp
+  80207c:	c3                   	ret
+
+0080207d <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  80207d:	55                   	push   %ebp
+  80207e:	89 e5                	mov    %esp,%ebp
+  802080:	53                   	push   %ebx
+  802081:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  802084:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802087:	50                   	push   %eax
+  802088:	6a 00                	push   $0x0
+  80208a:	e8 a2 ff ff ff       	call   802031 <fs_stats>
+  80208f:	83 c4 10             	add    $0x10,%esp
+  802092:	85 c0                	test   %eax,%eax
+  802094:	78 28                	js     8020be <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  802096:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  802099:	83 ec 08             	sub    $0x8,%esp
+  80209c:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  80209f:	50                   	push   %eax
+  8020a0:	6a 20                	push   $0x20
+  8020a2:	e8 8a ff ff ff       	call   802031 <fs_stats>
+  8020a7:	83 c4 10             	add    $0x10,%esp
+  8020aa:	85 c0                	test   %eax,%eax
+  8020ac:	78 10                	js     8020be <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  8020ae:	83 ec 08             	sub    $0x8,%esp
+  8020b1:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8020b4:	50                   	push   %eax
+  8020b5:	53                   	push   %ebx
+  8020b6:	e8 76 ff ff ff       	call   802031 <fs_stats>
+  8020bb:	83 c4 10             	add    $0x10,%esp
+}
+  8020be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020c1:	c9                   	leave
+  8020c2:	c3                   	ret
+
+008020c3 <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  8020c3:	55                   	push   %ebp
+  8020c4:	89 e5                	mov    %esp,%ebp
+  8020c6:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  8020c9:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  8020d0:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  8020d3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020d6:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.stats.req_dcache = 0;
+  8020db:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  8020e2:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  8020e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020ea:	b8 09 00 00 00       	mov    $0x9,%eax
+  8020ef:	e8 ac f7 ff ff       	call   8018a0 <fsipc>
+}
+  8020f4:	c9                   	leave
+  8020f5:	c3                   	ret
+
+008020f6 <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  8020f6:	55                   	push   %ebp
+  8020f7:	89 e5                	mov    %esp,%ebp
+  8020f9:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  8020fc:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  802103:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  802106:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  80210d:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  802110:	8b 45 08             	mov    0x8(%ebp),%eax
+  802113:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_STATS, NULL);
+  802118:	ba 00 00 00 00       	mov    $0x0,%edx
+  80211d:	b8 09 00 00 00       	mov    $0x9,%eax
+  802122:	e8 79 f7 ff ff       	call   8018a0 <fsipc>
+}
+  802127:	c9                   	leave
+  802128:	c3                   	ret
+
+00802129 <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  802129:	55                   	push   %ebp
+  80212a:	89 e5                	mov    %esp,%ebp
+  80212c:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80212f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802132:	50                   	push   %eax
+  802133:	ff 75 08             	push   0x8(%ebp)
+  802136:	e8 21 f1 ff ff       	call   80125c <fd_lookup>
+  80213b:	83 c4 10             	add    $0x10,%esp
+  80213e:	85 c0                	test   %eax,%eax
+  802140:	78 34                	js     802176 <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  802142:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802145:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  80214b:	39 08                	cmp    %ecx,(%eax)
+  80214d:	75 29                	jne    802178 <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  80214f:	8b 40 0c             	mov    0xc(%eax),%eax
+  802152:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.fallocate.req_offset = offset;
+  802157:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80215a:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.fallocate.req_len = len;
+  80215f:	8b 45 10             	mov    0x10(%ebp),%eax
+  802162:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  802167:	ba 00 00 00 00       	mov    $0x0,%edx
+  80216c:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802171:	e8 2a f7 ff ff       	call   8018a0 <fsipc>
+}
+  802176:	c9                   	leave
+  802177:	c3                   	ret
+    return -E_INVAL;
+  802178:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80217d:	eb f7                	jmp    802176 <fallocate+0x4d>
+
+0080217f <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  80217f:	55                   	push   %ebp
+  802180:	89 e5                	mov    %esp,%ebp
+  802182:	57                   	push   %edi
+  802183:	56                   	push   %esi
+  802184:	53                   	push   %ebx
+  802185:	83 ec 24             	sub    $0x24,%esp
+  802188:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80218b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80218e:	50                   	push   %eax
+  80218f:	ff 75 08             	push   0x8(%ebp)
+  802192:	e8 c5 f0 ff ff       	call   80125c <fd_lookup>
+  802197:	83 c4 10             	add    $0x10,%esp
+  80219a:	85 c0                	test   %eax,%eax
+  80219c:	78 66                	js     802204 <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  80219e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8021a1:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  8021a7:	39 08                	cmp    %ecx,(%eax)
+  8021a9:	75 61                	jne    80220c <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  8021ab:	85 f6                	test   %esi,%esi
+  8021ad:	7e 50                	jle    8021ff <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  8021af:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  8021b4:	39 de                	cmp    %ebx,%esi
+  8021b6:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  8021b9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8021bc:	8b 40 0c             	mov    0xc(%eax),%eax
+  8021bf:	a3 00 60 80 00       	mov    %eax,0x806000
+    fsipcbuf.prefetch.req_n = m;
+  8021c4:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  8021ca:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  8021d1:	83 ec 04             	sub    $0x4,%esp
+  8021d4:	57                   	push   %edi
+  8021d5:	ff 75 0c             	push   0xc(%ebp)
+  8021d8:	68 08 60 80 00       	push   $0x806008
+  8021dd:	e8 a8 e8 ff ff       	call   800a8a <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  8021e2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021e7:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8021ec:	e8 af f6 ff ff       	call   8018a0 <fsipc>
+  8021f1:	83 c4 10             	add    $0x10,%esp
+  8021f4:	85 c0                	test   %eax,%eax
+  8021f6:	78 0c                	js     802204 <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  8021f8:	01 7d 0c             	add    %edi,0xc(%ebp)
+  8021fb:	29 de                	sub    %ebx,%esi
+  8021fd:	eb ac                	jmp    8021ab <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  8021ff:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802204:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802207:	5b                   	pop    %ebx
+  802208:	5e                   	pop    %esi
+  802209:	5f                   	pop    %edi
+  80220a:	5d                   	pop    %ebp
+  80220b:	c3                   	ret
+    return -E_INVAL;
+  80220c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802211:	eb f1                	jmp    802204 <prefetch+0x85>
+
+00802213 <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  802213:	55                   	push   %ebp
+  802214:	89 e5                	mov    %esp,%ebp
+  802216:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  802219:	50                   	push   %eax
+  80221a:	e8 d3 ef ff ff       	call   8011f2 <fd2data>
+  80221f:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  802224:	c9                   	leave
+  802225:	c3                   	ret
+
+00802226 <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802226:	55                   	push   %ebp
+  802227:	89 e5                	mov    %esp,%ebp
+  802229:	56                   	push   %esi
+  80222a:	53                   	push   %ebx
+  80222b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  80222e:	83 ec 0c             	sub    $0xc,%esp
+  802231:	ff 75 08             	push   0x8(%ebp)
+  802234:	e8 b9 ef ff ff       	call   8011f2 <fd2data>
+  802239:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  80223b:	83 c4 08             	add    $0x8,%esp
+  80223e:	68 c8 34 80 00       	push   $0x8034c8
+  802243:	53                   	push   %ebx
+  802244:	e8 bb e6 ff ff       	call   800904 <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  802249:	8b 46 04             	mov    0x4(%esi),%eax
+  80224c:	2b 06                	sub    (%esi),%eax
+  80224e:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  802254:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80225b:	00 00 00 
+  stat->st_dev = &devpipe;
+  80225e:	c7 83 88 00 00 00 20 	movl   $0x804020,0x88(%ebx)
+  802265:	40 80 00 
+  return 0;
+}
+  802268:	b8 00 00 00 00       	mov    $0x0,%eax
+  80226d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802270:	5b                   	pop    %ebx
+  802271:	5e                   	pop    %esi
+  802272:	5d                   	pop    %ebp
+  802273:	c3                   	ret
+
+00802274 <pipe_wakeup>:
+{
+  802274:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  802276:	b8 00 00 00 00       	mov    $0x0,%eax
+  80227b:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  80227e:	85 c0                	test   %eax,%eax
+  802280:	75 01                	jne    802283 <pipe_wakeup+0xf>
+  802282:	c3                   	ret
+{
+  802283:	55                   	push   %ebp
+  802284:	89 e5                	mov    %esp,%ebp
+  802286:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  802289:	6a 00                	push   $0x0
+  80228b:	68 00 00 c0 ee       	push   $0xeec00000
+  802290:	52                   	push   %edx
+  802291:	e8 f9 ed ff ff       	call   80108f <sys_chan_wakeup>
+  802296:	83 c4 10             	add    $0x10,%esp
+}
+  802299:	c9                   	leave
+  80229a:	c3                   	ret
+
+0080229b <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80229b:	55                   	push   %ebp
+  80229c:	89 e5                	mov    %esp,%ebp
+  80229e:	57                   	push   %edi
+  80229f:	56                   	push   %esi
+  8022a0:	53                   	push   %ebx
+  8022a1:	83 ec 18             	sub    $0x18,%esp
+  8022a4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  8022a7:	57                   	push   %edi
+  8022a8:	e8 45 ef ff ff       	call   8011f2 <fd2data>
+  8022ad:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  8022af:	83 c4 10             	add    $0x10,%esp
+  8022b2:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  8022b6:	74 2a                	je     8022e2 <devpipe_close+0x47>
+  8022b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  8022bd:	89 f8                	mov    %edi,%eax
+  8022bf:	e8 4f ff ff ff       	call   802213 <pipe_ring>
+  8022c4:	83 ec 08             	sub    $0x8,%esp
+  8022c7:	01 d8                	add    %ebx,%eax
+  8022c9:	50                   	push   %eax
+  8022ca:	6a 00                	push   $0x0
+  8022cc:	e8 e7 ea ff ff       	call   800db8 <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  8022d1:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8022d7:	83 c4 10             	add    $0x10,%esp
+  8022da:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  8022e0:	75 db                	jne    8022bd <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  8022e2:	83 ec 08             	sub    $0x8,%esp
+  8022e5:	57                   	push   %edi
+  8022e6:	6a 00                	push   $0x0
+  8022e8:	e8 cb ea ff ff       	call   800db8 <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  8022ed:	83 c4 10             	add    $0x10,%esp
+  8022f0:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  8022f4:	75 13                	jne    802309 <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  8022f6:	83 ec 08             	sub    $0x8,%esp
+  8022f9:	56                   	push   %esi
+  8022fa:	6a 00                	push   $0x0
+  8022fc:	e8 b7 ea ff ff       	call   800db8 <sys_page_unmap>
+}
+  802301:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802304:	5b                   	pop    %ebx
+  802305:	5e                   	pop    %esi
+  802306:	5f                   	pop    %edi
+  802307:	5d                   	pop    %ebp
+  802308:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802309:	8d 56 04             	lea    0x4(%esi),%edx
+  80230c:	8d 46 2c             	lea    0x2c(%esi),%eax
+  80230f:	e8 60 ff ff ff       	call   802274 <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802314:	8d 46 30             	lea    0x30(%esi),%eax
+  802317:	89 f2                	mov    %esi,%edx
+  802319:	e8 56 ff ff ff       	call   802274 <pipe_wakeup>
+  80231e:	eb d6                	jmp    8022f6 <devpipe_close+0x5b>
+
+00802320 <_pipeisclosed>:
+{
+  802320:	55                   	push   %ebp
+  802321:	89 e5                	mov    %esp,%ebp
+  802323:	57                   	push   %edi
+  802324:	56                   	push   %esi
+  802325:	53                   	push   %ebx
+  802326:	83 ec 1c             	sub    $0x1c,%esp
+  802329:	89 c7                	mov    %eax,%edi
+  80232b:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  80232d:	a1 44 57 80 00       	mov    0x805744,%eax
+  802332:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  802335:	83 ec 0c             	sub    $0xc,%esp
+  802338:	57                   	push   %edi
+  802339:	e8 18 0a 00 00       	call   802d56 <pageref>
+  80233e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802341:	89 34 24             	mov    %esi,(%esp)
+  802344:	e8 0d 0a 00 00       	call   802d56 <pageref>
+    nn = thisenv->env_runs;
+  802349:	8b 15 44 57 80 00    	mov    0x805744,%edx
+  80234f:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  802352:	83 c4 10             	add    $0x10,%esp
+  802355:	39 cb                	cmp    %ecx,%ebx
+  802357:	74 1b                	je     802374 <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  802359:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80235c:	75 cf                	jne    80232d <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80235e:	8b 42 58             	mov    0x58(%edx),%eax
+  802361:	6a 01                	push   $0x1
+  802363:	50                   	push   %eax
+  802364:	53                   	push   %ebx
+  802365:	68 cf 34 80 00       	push   $0x8034cf
+  80236a:	e8 a7 df ff ff       	call   800316 <cprintf>
+  80236f:	83 c4 10             	add    $0x10,%esp
+  802372:	eb b9                	jmp    80232d <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  802374:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802377:	0f 94 c0             	sete   %al
+  80237a:	0f b6 c0             	movzbl %al,%eax
+}
+  80237d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802380:	5b                   	pop    %ebx
+  802381:	5e                   	pop    %esi
+  802382:	5f                   	pop    %edi
+  802383:	5d                   	pop    %ebp
+  802384:	c3                   	ret
+
+00802385 <devpipe_write_bulk>:
+{
+  802385:	55                   	push   %ebp
+  802386:	89 e5                	mov    %esp,%ebp
+  802388:	57                   	push   %edi
+  802389:	56                   	push   %esi
+  80238a:	53                   	push   %ebx
+  80238b:	83 ec 1c             	sub    $0x1c,%esp
+  80238e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802391:	89 d6                	mov    %edx,%esi
+  802393:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  802396:	e8 78 fe ff ff       	call   802213 <pipe_ring>
+  80239b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  80239e:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  8023a3:	8d 46 04             	lea    0x4(%esi),%eax
+  8023a6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  8023a9:	eb 75                	jmp    802420 <devpipe_write_bulk+0x9b>
+  8023ab:	b8 01 00 00 00       	mov    $0x1,%eax
+  8023b0:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  8023b4:	6a 64                	push   $0x64
+  8023b6:	68 00 00 c0 ee       	push   $0xeec00000
+  8023bb:	53                   	push   %ebx
+  8023bc:	56                   	push   %esi
+  8023bd:	e8 aa ec ff ff       	call   80106c <sys_chan_sleep>
+      continue;
+  8023c2:	83 c4 10             	add    $0x10,%esp
+  8023c5:	eb 59                	jmp    802420 <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  8023c7:	89 d1                	mov    %edx,%ecx
+  8023c9:	c1 f9 1f             	sar    $0x1f,%ecx
+  8023cc:	c1 e9 11             	shr    $0x11,%ecx
+  8023cf:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  8023d2:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8023d7:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  8023d9:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  8023df:	29 d3                	sub    %edx,%ebx
+  8023e1:	ba 00 80 00 00       	mov    $0x8000,%edx
+  8023e6:	29 c2                	sub    %eax,%edx
+  8023e8:	39 d3                	cmp    %edx,%ebx
+  8023ea:	0f 47 da             	cmova  %edx,%ebx
+  8023ed:	8b 55 08             	mov    0x8(%ebp),%edx
+  8023f0:	29 fa                	sub    %edi,%edx
+  8023f2:	39 d3                	cmp    %edx,%ebx
+  8023f4:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  8023f7:	83 ec 04             	sub    $0x4,%esp
+  8023fa:	53                   	push   %ebx
+  8023fb:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8023fe:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  802401:	52                   	push   %edx
+  802402:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802405:	01 c8                	add    %ecx,%eax
+  802407:	50                   	push   %eax
+  802408:	e8 df e6 ff ff       	call   800aec <memcpy>
+    i += m;
+  80240d:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  80240f:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802412:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802415:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802418:	e8 57 fe ff ff       	call   802274 <pipe_wakeup>
+  80241d:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802420:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802423:	73 2b                	jae    802450 <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  802425:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  802427:	8b 56 04             	mov    0x4(%esi),%edx
+  80242a:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  802430:	39 d0                	cmp    %edx,%eax
+  802432:	7d 93                	jge    8023c7 <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  802434:	89 f2                	mov    %esi,%edx
+  802436:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802439:	e8 e2 fe ff ff       	call   802320 <_pipeisclosed>
+  80243e:	85 c0                	test   %eax,%eax
+  802440:	0f 84 65 ff ff ff    	je     8023ab <devpipe_write_bulk+0x26>
+        return i;
+  802446:	89 f8                	mov    %edi,%eax
+}
+  802448:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80244b:	5b                   	pop    %ebx
+  80244c:	5e                   	pop    %esi
+  80244d:	5f                   	pop    %edi
+  80244e:	5d                   	pop    %ebp
+  80244f:	c3                   	ret
+  return i;
+  802450:	89 f8                	mov    %edi,%eax
+  802452:	eb f4                	jmp    802448 <devpipe_write_bulk+0xc3>
+
+00802454 <devpipe_write>:
+{
+  802454:	55                   	push   %ebp
+  802455:	89 e5                	mov    %esp,%ebp
+  802457:	57                   	push   %edi
+  802458:	56                   	push   %esi
+  802459:	53                   	push   %ebx
+  80245a:	83 ec 28             	sub    $0x28,%esp
+  80245d:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  802460:	56                   	push   %esi
+  802461:	e8 8c ed ff ff       	call   8011f2 <fd2data>
+  802466:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  802468:	8b 78 28             	mov    0x28(%eax),%edi
+  80246b:	83 c4 10             	add    $0x10,%esp
+  80246e:	85 ff                	test   %edi,%edi
+  802470:	75 25                	jne    802497 <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  802472:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802475:	74 66                	je     8024dd <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802477:	8b 43 04             	mov    0x4(%ebx),%eax
+  80247a:	8b 0b                	mov    (%ebx),%ecx
+  80247c:	8d 51 20             	lea    0x20(%ecx),%edx
+  80247f:	39 d0                	cmp    %edx,%eax
+  802481:	72 2b                	jb     8024ae <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  802483:	89 da                	mov    %ebx,%edx
+  802485:	89 f0                	mov    %esi,%eax
+  802487:	e8 94 fe ff ff       	call   802320 <_pipeisclosed>
+  80248c:	85 c0                	test   %eax,%eax
+  80248e:	75 51                	jne    8024e1 <devpipe_write+0x8d>
+      sys_yield();
+  802490:	e8 3c e8 ff ff       	call   800cd1 <sys_yield>
+  802495:	eb e0                	jmp    802477 <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  802497:	83 ec 0c             	sub    $0xc,%esp
+  80249a:	ff 75 10             	push   0x10(%ebp)
+  80249d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8024a0:	89 c2                	mov    %eax,%edx
+  8024a2:	89 f0                	mov    %esi,%eax
+  8024a4:	e8 dc fe ff ff       	call   802385 <devpipe_write_bulk>
+  8024a9:	83 c4 10             	add    $0x10,%esp
+  8024ac:	eb 38                	jmp    8024e6 <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8024ae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8024b1:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8024b5:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8024b8:	89 c2                	mov    %eax,%edx
+  8024ba:	c1 fa 1f             	sar    $0x1f,%edx
+  8024bd:	89 d1                	mov    %edx,%ecx
+  8024bf:	c1 e9 1b             	shr    $0x1b,%ecx
+  8024c2:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8024c5:	83 e2 1f             	and    $0x1f,%edx
+  8024c8:	29 ca                	sub    %ecx,%edx
+  8024ca:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8024ce:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  8024d2:	83 c0 01             	add    $0x1,%eax
+  8024d5:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  8024d8:	83 c7 01             	add    $0x1,%edi
+  8024db:	eb 95                	jmp    802472 <devpipe_write+0x1e>
+  return i;
+  8024dd:	89 f8                	mov    %edi,%eax
+  8024df:	eb 05                	jmp    8024e6 <devpipe_write+0x92>
+        return 0;
+  8024e1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024e9:	5b                   	pop    %ebx
+  8024ea:	5e                   	pop    %esi
+  8024eb:	5f                   	pop    %edi
+  8024ec:	5d                   	pop    %ebp
+  8024ed:	c3                   	ret
+
+008024ee <devpipe_read_bulk>:
+{
+  8024ee:	55                   	push   %ebp
+  8024ef:	89 e5                	mov    %esp,%ebp
+  8024f1:	57                   	push   %edi
+  8024f2:	56                   	push   %esi
+  8024f3:	53                   	push   %ebx
+  8024f4:	83 ec 2c             	sub    $0x2c,%esp
+  8024f7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8024fa:	89 d6                	mov    %edx,%esi
+  8024fc:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8024ff:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  802502:	e8 0c fd ff ff       	call   802213 <pipe_ring>
+  802507:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  80250a:	85 db                	test   %ebx,%ebx
+  80250c:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802511:	0f 45 c3             	cmovne %ebx,%eax
+  802514:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802517:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  80251c:	8d 46 30             	lea    0x30(%esi),%eax
+  80251f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  802522:	eb 50                	jmp    802574 <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  802524:	89 d1                	mov    %edx,%ecx
+  802526:	c1 f9 1f             	sar    $0x1f,%ecx
+  802529:	c1 e9 11             	shr    $0x11,%ecx
+  80252c:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  80252f:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802534:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  802536:	29 d3                	sub    %edx,%ebx
+  802538:	ba 00 80 00 00       	mov    $0x8000,%edx
+  80253d:	29 c2                	sub    %eax,%edx
+  80253f:	39 d3                	cmp    %edx,%ebx
+  802541:	0f 47 da             	cmova  %edx,%ebx
+  802544:	8b 55 08             	mov    0x8(%ebp),%edx
+  802547:	29 fa                	sub    %edi,%edx
+  802549:	39 d3                	cmp    %edx,%ebx
+  80254b:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  80254e:	83 ec 04             	sub    $0x4,%esp
+  802551:	53                   	push   %ebx
+  802552:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802555:	01 c8                	add    %ecx,%eax
+  802557:	50                   	push   %eax
+  802558:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80255b:	01 f8                	add    %edi,%eax
+  80255d:	50                   	push   %eax
+  80255e:	e8 89 e5 ff ff       	call   800aec <memcpy>
+    i += m;
+  802563:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  802565:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802567:	89 f2                	mov    %esi,%edx
+  802569:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80256c:	e8 03 fd ff ff       	call   802274 <pipe_wakeup>
+  802571:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802574:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802577:	73 51                	jae    8025ca <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  802579:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  80257c:	8b 16                	mov    (%esi),%edx
+  80257e:	39 da                	cmp    %ebx,%edx
+  802580:	75 a2                	jne    802524 <devpipe_read_bulk+0x36>
+      if (i > 0)
+  802582:	85 ff                	test   %edi,%edi
+  802584:	75 44                	jne    8025ca <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  802586:	89 f2                	mov    %esi,%edx
+  802588:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80258b:	e8 90 fd ff ff       	call   802320 <_pipeisclosed>
+  802590:	85 c0                	test   %eax,%eax
+  802592:	75 3a                	jne    8025ce <devpipe_read_bulk+0xe0>
+  802594:	b8 01 00 00 00       	mov    $0x1,%eax
+  802599:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  80259d:	6a 64                	push   $0x64
+  80259f:	ff 75 d4             	push   -0x2c(%ebp)
+  8025a2:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  8025a3:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  8025a6:	50                   	push   %eax
+  8025a7:	e8 c0 ea ff ff       	call   80106c <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  8025ac:	85 c0                	test   %eax,%eax
+  8025ae:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025b3:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  8025b6:	83 c4 10             	add    $0x10,%esp
+  8025b9:	a8 01                	test   $0x1,%al
+  8025bb:	74 b7                	je     802574 <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  8025bd:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  8025c2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025c5:	5b                   	pop    %ebx
+  8025c6:	5e                   	pop    %esi
+  8025c7:	5f                   	pop    %edi
+  8025c8:	5d                   	pop    %ebp
+  8025c9:	c3                   	ret
+  return i;
+  8025ca:	89 f8                	mov    %edi,%eax
+  8025cc:	eb f4                	jmp    8025c2 <devpipe_read_bulk+0xd4>
+        return 0;
+  8025ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025d3:	eb ed                	jmp    8025c2 <devpipe_read_bulk+0xd4>
+
+008025d5 <devpipe_read>:
+{
+  8025d5:	55                   	push   %ebp
+  8025d6:	89 e5                	mov    %esp,%ebp
+  8025d8:	57                   	push   %edi
+  8025d9:	56                   	push   %esi
+  8025da:	53                   	push   %ebx
+  8025db:	83 ec 18             	sub    $0x18,%esp
+  8025de:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  8025e1:	57                   	push   %edi
+  8025e2:	e8 0b ec ff ff       	call   8011f2 <fd2data>
+  8025e7:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  8025e9:	8b 70 28             	mov    0x28(%eax),%esi
+  8025ec:	83 c4 10             	add    $0x10,%esp
+  8025ef:	85 f6                	test   %esi,%esi
+  8025f1:	75 24                	jne    802617 <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  8025f3:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8025f6:	74 60                	je     802658 <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  8025f8:	8b 03                	mov    (%ebx),%eax
+  8025fa:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8025fd:	75 3b                	jne    80263a <devpipe_read+0x65>
+      if (i > 0)
+  8025ff:	85 f6                	test   %esi,%esi
+  802601:	75 2d                	jne    802630 <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  802603:	89 da                	mov    %ebx,%edx
+  802605:	89 f8                	mov    %edi,%eax
+  802607:	e8 14 fd ff ff       	call   802320 <_pipeisclosed>
+  80260c:	85 c0                	test   %eax,%eax
+  80260e:	75 4c                	jne    80265c <devpipe_read+0x87>
+      sys_yield();
+  802610:	e8 bc e6 ff ff       	call   800cd1 <sys_yield>
+  802615:	eb e1                	jmp    8025f8 <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  802617:	83 ec 08             	sub    $0x8,%esp
+  80261a:	6a 00                	push   $0x0
+  80261c:	ff 75 10             	push   0x10(%ebp)
+  80261f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802622:	89 c2                	mov    %eax,%edx
+  802624:	89 f8                	mov    %edi,%eax
+  802626:	e8 c3 fe ff ff       	call   8024ee <devpipe_read_bulk>
+  80262b:	83 c4 10             	add    $0x10,%esp
+  80262e:	eb 02                	jmp    802632 <devpipe_read+0x5d>
+        return i;
+  802630:	89 f0                	mov    %esi,%eax
+}
+  802632:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802635:	5b                   	pop    %ebx
+  802636:	5e                   	pop    %esi
+  802637:	5f                   	pop    %edi
+  802638:	5d                   	pop    %ebp
+  802639:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80263a:	99                   	cltd
+  80263b:	c1 ea 1b             	shr    $0x1b,%edx
+  80263e:	01 d0                	add    %edx,%eax
+  802640:	83 e0 1f             	and    $0x1f,%eax
+  802643:	29 d0                	sub    %edx,%eax
+  802645:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  80264a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80264d:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  802650:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  802653:	83 c6 01             	add    $0x1,%esi
+  802656:	eb 9b                	jmp    8025f3 <devpipe_read+0x1e>
+  return i;
+  802658:	89 f0                	mov    %esi,%eax
+  80265a:	eb d6                	jmp    802632 <devpipe_read+0x5d>
+        return 0;
+  80265c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802661:	eb cf                	jmp    802632 <devpipe_read+0x5d>
+
+00802663 <pipe2>:
+{
+  802663:	55                   	push   %ebp
+  802664:	89 e5                	mov    %esp,%ebp
+  802666:	57                   	push   %edi
+  802667:	56                   	push   %esi
+  802668:	53                   	push   %ebx
+  802669:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  80266c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80266f:	50                   	push   %eax
+  802670:	e8 91 eb ff ff       	call   801206 <fd_alloc>
+  802675:	89 c3                	mov    %eax,%ebx
+  802677:	83 c4 10             	add    $0x10,%esp
+  80267a:	85 c0                	test   %eax,%eax
+  80267c:	0f 88 fb 01 00 00    	js     80287d <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802682:	83 ec 04             	sub    $0x4,%esp
+  802685:	68 07 04 00 00       	push   $0x407
+  80268a:	ff 75 e4             	push   -0x1c(%ebp)
+  80268d:	6a 00                	push   $0x0
+  80268f:	e8 9f e6 ff ff       	call   800d33 <sys_page_alloc>
+  802694:	89 c3                	mov    %eax,%ebx
+  802696:	83 c4 10             	add    $0x10,%esp
+  802699:	85 c0                	test   %eax,%eax
+  80269b:	0f 88 dc 01 00 00    	js     80287d <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  8026a1:	83 ec 0c             	sub    $0xc,%esp
+  8026a4:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8026a7:	50                   	push   %eax
+  8026a8:	e8 59 eb ff ff       	call   801206 <fd_alloc>
+  8026ad:	89 c3                	mov    %eax,%ebx
+  8026af:	83 c4 10             	add    $0x10,%esp
+  8026b2:	85 c0                	test   %eax,%eax
+  8026b4:	0f 88 b3 01 00 00    	js     80286d <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8026ba:	83 ec 04             	sub    $0x4,%esp
+  8026bd:	68 07 04 00 00       	push   $0x407
+  8026c2:	ff 75 e0             	push   -0x20(%ebp)
+  8026c5:	6a 00                	push   $0x0
+  8026c7:	e8 67 e6 ff ff       	call   800d33 <sys_page_alloc>
+  8026cc:	89 c3                	mov    %eax,%ebx
+  8026ce:	83 c4 10             	add    $0x10,%esp
+  8026d1:	85 c0                	test   %eax,%eax
+  8026d3:	0f 88 94 01 00 00    	js     80286d <pipe2+0x20a>
+  va = fd2data(fd0);
+  8026d9:	83 ec 0c             	sub    $0xc,%esp
+  8026dc:	ff 75 e4             	push   -0x1c(%ebp)
+  8026df:	e8 0e eb ff ff       	call   8011f2 <fd2data>
+  8026e4:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8026e6:	83 c4 0c             	add    $0xc,%esp
+  8026e9:	68 07 04 00 00       	push   $0x407
+  8026ee:	50                   	push   %eax
+  8026ef:	6a 00                	push   $0x0
+  8026f1:	e8 3d e6 ff ff       	call   800d33 <sys_page_alloc>
+  8026f6:	89 c3                	mov    %eax,%ebx
+  8026f8:	83 c4 10             	add    $0x10,%esp
+  8026fb:	85 c0                	test   %eax,%eax
+  8026fd:	0f 88 5a 01 00 00    	js     80285d <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802703:	83 ec 0c             	sub    $0xc,%esp
+  802706:	ff 75 e0             	push   -0x20(%ebp)
+  802709:	e8 e4 ea ff ff       	call   8011f2 <fd2data>
+  80270e:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802715:	50                   	push   %eax
+  802716:	6a 00                	push   $0x0
+  802718:	57                   	push   %edi
+  802719:	6a 00                	push   $0x0
+  80271b:	e8 56 e6 ff ff       	call   800d76 <sys_page_map>
+  802720:	89 c3                	mov    %eax,%ebx
+  802722:	83 c4 20             	add    $0x20,%esp
+  802725:	85 c0                	test   %eax,%eax
+  802727:	0f 88 22 01 00 00    	js     80284f <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  80272d:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  802731:	74 72                	je     8027a5 <pipe2+0x142>
+  802733:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  802738:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80273b:	e8 d3 fa ff ff       	call   802213 <pipe_ring>
+  802740:	83 ec 04             	sub    $0x4,%esp
+  802743:	68 07 04 00 00       	push   $0x407
+  802748:	01 f0                	add    %esi,%eax
+  80274a:	50                   	push   %eax
+  80274b:	6a 00                	push   $0x0
+  80274d:	e8 e1 e5 ff ff       	call   800d33 <sys_page_alloc>
+  802752:	89 c3                	mov    %eax,%ebx
+  802754:	83 c4 10             	add    $0x10,%esp
+  802757:	85 c0                	test   %eax,%eax
+  802759:	0f 88 97 00 00 00    	js     8027f6 <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  80275f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802762:	e8 ac fa ff ff       	call   802213 <pipe_ring>
+  802767:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  80276a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80276d:	e8 a1 fa ff ff       	call   802213 <pipe_ring>
+  802772:	83 ec 0c             	sub    $0xc,%esp
+  802775:	68 07 04 00 00       	push   $0x407
+  80277a:	53                   	push   %ebx
+  80277b:	6a 00                	push   $0x0
+  80277d:	01 f0                	add    %esi,%eax
+  80277f:	50                   	push   %eax
+  802780:	6a 00                	push   $0x0
+  802782:	e8 ef e5 ff ff       	call   800d76 <sys_page_map>
+  802787:	89 c3                	mov    %eax,%ebx
+  802789:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80278f:	83 c4 20             	add    $0x20,%esp
+  802792:	85 c0                	test   %eax,%eax
+  802794:	78 60                	js     8027f6 <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  802796:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  80279c:	75 9a                	jne    802738 <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  80279e:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  8027a5:	a1 20 40 80 00       	mov    0x804020,%eax
+  8027aa:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8027ad:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  8027af:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8027b2:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  8027b9:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8027bc:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  8027be:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8027c1:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  8027c8:	83 ec 0c             	sub    $0xc,%esp
+  8027cb:	ff 75 e4             	push   -0x1c(%ebp)
+  8027ce:	e8 0f ea ff ff       	call   8011e2 <fd2num>
+  8027d3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8027d6:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  8027d8:	83 c4 04             	add    $0x4,%esp
+  8027db:	ff 75 e0             	push   -0x20(%ebp)
+  8027de:	e8 ff e9 ff ff       	call   8011e2 <fd2num>
+  8027e3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8027e6:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  8027e9:	83 c4 10             	add    $0x10,%esp
+  8027ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027f1:	e9 87 00 00 00       	jmp    80287d <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  8027f6:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  8027fb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8027fe:	e8 10 fa ff ff       	call   802213 <pipe_ring>
+  802803:	83 ec 08             	sub    $0x8,%esp
+  802806:	01 f0                	add    %esi,%eax
+  802808:	50                   	push   %eax
+  802809:	6a 00                	push   $0x0
+  80280b:	e8 a8 e5 ff ff       	call   800db8 <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  802810:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802813:	e8 fb f9 ff ff       	call   802213 <pipe_ring>
+  802818:	83 c4 08             	add    $0x8,%esp
+  80281b:	01 f0                	add    %esi,%eax
+  80281d:	50                   	push   %eax
+  80281e:	6a 00                	push   $0x0
+  802820:	e8 93 e5 ff ff       	call   800db8 <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802825:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80282b:	83 c4 10             	add    $0x10,%esp
+  80282e:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802834:	75 c5                	jne    8027fb <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  802836:	83 ec 0c             	sub    $0xc,%esp
+  802839:	ff 75 e0             	push   -0x20(%ebp)
+  80283c:	e8 b1 e9 ff ff       	call   8011f2 <fd2data>
+  802841:	83 c4 08             	add    $0x8,%esp
+  802844:	50                   	push   %eax
+  802845:	6a 00                	push   $0x0
+  802847:	e8 6c e5 ff ff       	call   800db8 <sys_page_unmap>
+  80284c:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  80284f:	83 ec 08             	sub    $0x8,%esp
+  802852:	57                   	push   %edi
+  802853:	6a 00                	push   $0x0
+  802855:	e8 5e e5 ff ff       	call   800db8 <sys_page_unmap>
+  80285a:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  80285d:	83 ec 08             	sub    $0x8,%esp
+  802860:	ff 75 e0             	push   -0x20(%ebp)
+  802863:	6a 00                	push   $0x0
+  802865:	e8 4e e5 ff ff       	call   800db8 <sys_page_unmap>
+  80286a:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  80286d:	83 ec 08             	sub    $0x8,%esp
+  802870:	ff 75 e4             	push   -0x1c(%ebp)
+  802873:	6a 00                	push   $0x0
+  802875:	e8 3e e5 ff ff       	call   800db8 <sys_page_unmap>
+  80287a:	83 c4 10             	add    $0x10,%esp
+}
+  80287d:	89 d8                	mov    %ebx,%eax
+  80287f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802882:	5b                   	pop    %ebx
+  802883:	5e                   	pop    %esi
+  802884:	5f                   	pop    %edi
+  802885:	5d                   	pop    %ebp
+  802886:	c3                   	ret
+
+00802887 <pipe>:
+{
+  802887:	55                   	push   %ebp
+  802888:	89 e5                	mov    %esp,%ebp
+  80288a:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  80288d:	6a 00                	push   $0x0
+  80288f:	ff 75 08             	push   0x8(%ebp)
+  802892:	e8 cc fd ff ff       	call   802663 <pipe2>
+}
+  802897:	c9                   	leave
+  802898:	c3                   	ret
+
+00802899 <pipeisclosed>:
+{
+  802899:	55                   	push   %ebp
+  80289a:	89 e5                	mov    %esp,%ebp
+  80289c:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80289f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8028a2:	50                   	push   %eax
+  8028a3:	ff 75 08             	push   0x8(%ebp)
+  8028a6:	e8 b1 e9 ff ff       	call   80125c <fd_lookup>
+  8028ab:	83 c4 10             	add    $0x10,%esp
+  8028ae:	85 c0                	test   %eax,%eax
+  8028b0:	78 18                	js     8028ca <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  8028b2:	83 ec 0c             	sub    $0xc,%esp
+  8028b5:	ff 75 f4             	push   -0xc(%ebp)
+  8028b8:	e8 35 e9 ff ff       	call   8011f2 <fd2data>
+  8028bd:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  8028bf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8028c2:	e8 59 fa ff ff       	call   802320 <_pipeisclosed>
+  8028c7:	83 c4 10             	add    $0x10,%esp
+}
+  8028ca:	c9                   	leave
+  8028cb:	c3                   	ret
+
+008028cc <pipe_splice>:
+{
+  8028cc:	55                   	push   %ebp
+  8028cd:	89 e5                	mov    %esp,%ebp
+  8028cf:	57                   	push   %edi
+  8028d0:	56                   	push   %esi
+  8028d1:	53                   	push   %ebx
+  8028d2:	83 ec 34             	sub    $0x34,%esp
+  8028d5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8028d8:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8028db:	50                   	push   %eax
+  8028dc:	ff 75 08             	push   0x8(%ebp)
+  8028df:	e8 78 e9 ff ff       	call   80125c <fd_lookup>
+  8028e4:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8028e7:	83 c4 10             	add    $0x10,%esp
+  8028ea:	85 c0                	test   %eax,%eax
+  8028ec:	0f 88 d7 00 00 00    	js     8029c9 <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  8028f2:	83 ec 0c             	sub    $0xc,%esp
+  8028f5:	ff 75 e4             	push   -0x1c(%ebp)
+  8028f8:	e8 f5 e8 ff ff       	call   8011f2 <fd2data>
+  8028fd:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  8028ff:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802902:	83 c4 10             	add    $0x10,%esp
+  802905:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  80290b:	39 10                	cmp    %edx,(%eax)
+  80290d:	0f 85 c1 00 00 00    	jne    8029d4 <pipe_splice+0x108>
+  802913:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  802917:	0f 84 c0 00 00 00    	je     8029dd <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  80291d:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802921:	0f 84 bf 00 00 00    	je     8029e6 <pipe_splice+0x11a>
+  802927:	89 f7                	mov    %esi,%edi
+  802929:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  80292f:	0f 85 ba 00 00 00    	jne    8029ef <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802935:	8d 43 04             	lea    0x4(%ebx),%eax
+  802938:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80293b:	eb 38                	jmp    802975 <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  80293d:	83 ec 0c             	sub    $0xc,%esp
+  802940:	68 00 10 00 00       	push   $0x1000
+  802945:	89 f1                	mov    %esi,%ecx
+  802947:	89 da                	mov    %ebx,%edx
+  802949:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80294c:	e8 34 fa ff ff       	call   802385 <devpipe_write_bulk>
+  802951:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802954:	83 c4 10             	add    $0x10,%esp
+  802957:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80295c:	75 53                	jne    8029b1 <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  80295e:	83 ec 08             	sub    $0x8,%esp
+  802961:	56                   	push   %esi
+  802962:	6a 00                	push   $0x0
+  802964:	e8 4f e4 ff ff       	call   800db8 <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  802969:	83 c7 01             	add    $0x1,%edi
+  80296c:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802972:	83 c4 10             	add    $0x10,%esp
+  802975:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802978:	74 3a                	je     8029b4 <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  80297a:	8b 03                	mov    (%ebx),%eax
+  80297c:	39 43 04             	cmp    %eax,0x4(%ebx)
+  80297f:	75 bc                	jne    80293d <pipe_splice+0x71>
+  802981:	b8 00 00 00 00       	mov    $0x0,%eax
+  802986:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  80298a:	85 c0                	test   %eax,%eax
+  80298c:	74 af                	je     80293d <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  80298e:	83 ec 04             	sub    $0x4,%esp
+  802991:	6a 07                	push   $0x7
+  802993:	56                   	push   %esi
+  802994:	ff 75 d0             	push   -0x30(%ebp)
+  802997:	e8 f3 e6 ff ff       	call   80108f <sys_chan_wakeup>
+  80299c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80299f:	83 c4 10             	add    $0x10,%esp
+  8029a2:	85 c0                	test   %eax,%eax
+  8029a4:	79 b8                	jns    80295e <pipe_splice+0x92>
+  8029a6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8029ab:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  8029af:	eb 8c                	jmp    80293d <pipe_splice+0x71>
+  8029b1:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  8029b4:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8029b8:	75 06                	jne    8029c0 <pipe_splice+0xf4>
+  8029ba:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  8029be:	78 09                	js     8029c9 <pipe_splice+0xfd>
+  return i * PGSIZE;
+  8029c0:	8b 45 10             	mov    0x10(%ebp),%eax
+  8029c3:	c1 e0 0c             	shl    $0xc,%eax
+  8029c6:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  8029c9:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8029cc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029cf:	5b                   	pop    %ebx
+  8029d0:	5e                   	pop    %esi
+  8029d1:	5f                   	pop    %edi
+  8029d2:	5d                   	pop    %ebp
+  8029d3:	c3                   	ret
+    return -E_INVAL;
+  8029d4:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  8029db:	eb ec                	jmp    8029c9 <pipe_splice+0xfd>
+  8029dd:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  8029e4:	eb e3                	jmp    8029c9 <pipe_splice+0xfd>
+  8029e6:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  8029ed:	eb da                	jmp    8029c9 <pipe_splice+0xfd>
+  8029ef:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  8029f6:	eb d1                	jmp    8029c9 <pipe_splice+0xfd>
+
+008029f8 <pipe_splice_read>:
+{
+  8029f8:	55                   	push   %ebp
+  8029f9:	89 e5                	mov    %esp,%ebp
+  8029fb:	53                   	push   %ebx
+  8029fc:	83 ec 1c             	sub    $0x1c,%esp
+  8029ff:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802a02:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a05:	50                   	push   %eax
+  802a06:	ff 75 08             	push   0x8(%ebp)
+  802a09:	e8 4e e8 ff ff       	call   80125c <fd_lookup>
+  802a0e:	83 c4 10             	add    $0x10,%esp
+  802a11:	85 c0                	test   %eax,%eax
+  802a13:	78 49                	js     802a5e <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  802a15:	83 ec 0c             	sub    $0xc,%esp
+  802a18:	ff 75 f4             	push   -0xc(%ebp)
+  802a1b:	e8 d2 e7 ff ff       	call   8011f2 <fd2data>
+  802a20:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802a22:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a25:	83 c4 10             	add    $0x10,%esp
+  802a28:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  802a2e:	39 08                	cmp    %ecx,(%eax)
+  802a30:	75 31                	jne    802a63 <pipe_splice_read+0x6b>
+  802a32:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  802a36:	74 32                	je     802a6a <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  802a38:	8b 48 08             	mov    0x8(%eax),%ecx
+  802a3b:	83 e1 03             	and    $0x3,%ecx
+  802a3e:	83 f9 01             	cmp    $0x1,%ecx
+  802a41:	74 2e                	je     802a71 <pipe_splice_read+0x79>
+  802a43:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  802a49:	75 2d                	jne    802a78 <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  802a4b:	83 ec 08             	sub    $0x8,%esp
+  802a4e:	53                   	push   %ebx
+  802a4f:	68 00 10 00 00       	push   $0x1000
+  802a54:	89 d9                	mov    %ebx,%ecx
+  802a56:	e8 93 fa ff ff       	call   8024ee <devpipe_read_bulk>
+  802a5b:	83 c4 10             	add    $0x10,%esp
+}
+  802a5e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a61:	c9                   	leave
+  802a62:	c3                   	ret
+    return -E_INVAL;
+  802a63:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a68:	eb f4                	jmp    802a5e <pipe_splice_read+0x66>
+  802a6a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a6f:	eb ed                	jmp    802a5e <pipe_splice_read+0x66>
+  802a71:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a76:	eb e6                	jmp    802a5e <pipe_splice_read+0x66>
+  802a78:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a7d:	eb df                	jmp    802a5e <pipe_splice_read+0x66>
+
+00802a7f <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  802a7f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a84:	c3                   	ret
+
+00802a85 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802a85:	55                   	push   %ebp
+  802a86:	89 e5                	mov    %esp,%ebp
+  802a88:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  802a8b:	68 e7 34 80 00       	push   $0x8034e7
+  802a90:	ff 75 0c             	push   0xc(%ebp)
+  802a93:	e8 6c de ff ff       	call   800904 <strcpy>
+  return 0;
+}
+  802a98:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a9d:	c9                   	leave
+  802a9e:	c3                   	ret
+
+00802a9f <devcons_write>:
+{
+  802a9f:	55                   	push   %ebp
+  802aa0:	89 e5                	mov    %esp,%ebp
+  802aa2:	57                   	push   %edi
+  802aa3:	56                   	push   %esi
+  802aa4:	53                   	push   %ebx
+  802aa5:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  802aab:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  802ab0:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  802ab6:	eb 2e                	jmp    802ae6 <devcons_write+0x47>
+    m = n - tot;
+  802ab8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802abb:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  802abd:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802ac2:	39 c3                	cmp    %eax,%ebx
+  802ac4:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  802ac7:	83 ec 04             	sub    $0x4,%esp
+  802aca:	53                   	push   %ebx
+  802acb:	89 f0                	mov    %esi,%eax
+  802acd:	03 45 0c             	add    0xc(%ebp),%eax
+  802ad0:	50                   	push   %eax
+  802ad1:	57                   	push   %edi
+  802ad2:	e8 b3 df ff ff       	call   800a8a <memmove>
+    sys_cputs(buf, m);
+  802ad7:	83 c4 08             	add    $0x8,%esp
+  802ada:	53                   	push   %ebx
+  802adb:	57                   	push   %edi
+  802adc:	e8 53 e1 ff ff       	call   800c34 <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  802ae1:	01 de                	add    %ebx,%esi
+  802ae3:	83 c4 10             	add    $0x10,%esp
+  802ae6:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802ae9:	72 cd                	jb     802ab8 <devcons_write+0x19>
+}
+  802aeb:	89 f0                	mov    %esi,%eax
+  802aed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802af0:	5b                   	pop    %ebx
+  802af1:	5e                   	pop    %esi
+  802af2:	5f                   	pop    %edi
+  802af3:	5d                   	pop    %ebp
+  802af4:	c3                   	ret
+
+00802af5 <devcons_read>:
+{
+  802af5:	55                   	push   %ebp
+  802af6:	89 e5                	mov    %esp,%ebp
+  802af8:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  802afb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b00:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802b04:	75 07                	jne    802b0d <devcons_read+0x18>
+  802b06:	eb 1f                	jmp    802b27 <devcons_read+0x32>
+    sys_yield();
+  802b08:	e8 c4 e1 ff ff       	call   800cd1 <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  802b0d:	e8 40 e1 ff ff       	call   800c52 <sys_cgetc>
+  802b12:	85 c0                	test   %eax,%eax
+  802b14:	74 f2                	je     802b08 <devcons_read+0x13>
+  if (c < 0)
+  802b16:	78 0f                	js     802b27 <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  802b18:	83 f8 04             	cmp    $0x4,%eax
+  802b1b:	74 0c                	je     802b29 <devcons_read+0x34>
+  *(char*)vbuf = c;
+  802b1d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802b20:	88 02                	mov    %al,(%edx)
+  return 1;
+  802b22:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802b27:	c9                   	leave
+  802b28:	c3                   	ret
+    return 0;
+  802b29:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b2e:	eb f7                	jmp    802b27 <devcons_read+0x32>
+
+00802b30 <cputchar>:
+{
+  802b30:	55                   	push   %ebp
+  802b31:	89 e5                	mov    %esp,%ebp
+  802b33:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  802b36:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b39:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  802b3c:	6a 01                	push   $0x1
+  802b3e:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802b41:	50                   	push   %eax
+  802b42:	e8 ed e0 ff ff       	call   800c34 <sys_cputs>
+}
+  802b47:	83 c4 10             	add    $0x10,%esp
+  802b4a:	c9                   	leave
+  802b4b:	c3                   	ret
+
+00802b4c <getchar>:
+{
+  802b4c:	55                   	push   %ebp
+  802b4d:	89 e5                	mov    %esp,%ebp
+  802b4f:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  802b52:	6a 01                	push   $0x1
+  802b54:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802b57:	50                   	push   %eax
+  802b58:	6a 00                	push   $0x0
+  802b5a:	e8 a8 e9 ff ff       	call   801507 <read>
+  if (r < 0)
+  802b5f:	83 c4 10             	add    $0x10,%esp
+  802b62:	85 c0                	test   %eax,%eax
+  802b64:	78 06                	js     802b6c <getchar+0x20>
+  if (r < 1)
+  802b66:	74 06                	je     802b6e <getchar+0x22>
+  return c;
+  802b68:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802b6c:	c9                   	leave
+  802b6d:	c3                   	ret
+    return -E_EOF;
+  802b6e:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802b73:	eb f7                	jmp    802b6c <getchar+0x20>
+
+00802b75 <iscons>:
+{
+  802b75:	55                   	push   %ebp
+  802b76:	89 e5                	mov    %esp,%ebp
+  802b78:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802b7b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b7e:	50                   	push   %eax
+  802b7f:	ff 75 08             	push   0x8(%ebp)
+  802b82:	e8 d5 e6 ff ff       	call   80125c <fd_lookup>
+  802b87:	83 c4 10             	add    $0x10,%esp
+  802b8a:	85 c0                	test   %eax,%eax
+  802b8c:	78 11                	js     802b9f <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  802b8e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b91:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802b97:	39 10                	cmp    %edx,(%eax)
+  802b99:	0f 94 c0             	sete   %al
+  802b9c:	0f b6 c0             	movzbl %al,%eax
+}
+  802b9f:	c9                   	leave
+  802ba0:	c3                   	ret
+
+00802ba1 <opencons>:
+{
+  802ba1:	55                   	push   %ebp
+  802ba2:	89 e5                	mov    %esp,%ebp
+  802ba4:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  802ba7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802baa:	50                   	push   %eax
+  802bab:	e8 56 e6 ff ff       	call   801206 <fd_alloc>
+  802bb0:	83 c4 10             	add    $0x10,%esp
+  802bb3:	85 c0                	test   %eax,%eax
+  802bb5:	78 3a                	js     802bf1 <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802bb7:	83 ec 04             	sub    $0x4,%esp
+  802bba:	68 07 04 00 00       	push   $0x407
+  802bbf:	ff 75 f4             	push   -0xc(%ebp)
+  802bc2:	6a 00                	push   $0x0
+  802bc4:	e8 6a e1 ff ff       	call   800d33 <sys_page_alloc>
+  802bc9:	83 c4 10             	add    $0x10,%esp
+  802bcc:	85 c0                	test   %eax,%eax
+  802bce:	78 21                	js     802bf1 <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  802bd0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802bd3:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802bd9:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  802bdb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802bde:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  802be5:	83 ec 0c             	sub    $0xc,%esp
+  802be8:	50                   	push   %eax
+  802be9:	e8 f4 e5 ff ff       	call   8011e2 <fd2num>
+  802bee:	83 c4 10             	add    $0x10,%esp
+}
+  802bf1:	c9                   	leave
+  802bf2:	c3                   	ret
+
+00802bf3 <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  802bf3:	55                   	push   %ebp
+  802bf4:	89 e5                	mov    %esp,%ebp
+  802bf6:	57                   	push   %edi
+  802bf7:	56                   	push   %esi
+  802bf8:	53                   	push   %ebx
+  802bf9:	83 ec 14             	sub    $0x14,%esp
+  802bfc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802bff:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c02:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802c05:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  802c08:	85 c0                	test   %eax,%eax
+  802c0a:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802c0f:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  802c12:	ff 33                	push   (%ebx)
+  802c14:	50                   	push   %eax
+  802c15:	e8 f1 e3 ff ff       	call   80100b <sys_ipc_recv>
+  802c1a:	83 c4 10             	add    $0x10,%esp
+  802c1d:	85 c0                	test   %eax,%eax
+  802c1f:	78 39                	js     802c5a <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  802c21:	85 ff                	test   %edi,%edi
+  802c23:	74 0a                	je     802c2f <ipc_recv_pages+0x3c>
+  802c25:	a1 44 57 80 00       	mov    0x805744,%eax
+  802c2a:	8b 40 7c             	mov    0x7c(%eax),%eax
+  802c2d:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  802c2f:	85 f6                	test   %esi,%esi
+  802c31:	74 0d                	je     802c40 <ipc_recv_pages+0x4d>
+  802c33:	a1 44 57 80 00       	mov    0x805744,%eax
+  802c38:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  802c3e:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  802c40:	a1 44 57 80 00       	mov    0x805744,%eax
+  802c45:	8b 40 74             	mov    0x74(%eax),%eax
+  802c48:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  802c4a:	a1 44 57 80 00       	mov    0x805744,%eax
+  802c4f:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  802c52:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c55:	5b                   	pop    %ebx
+  802c56:	5e                   	pop    %esi
+  802c57:	5f                   	pop    %edi
+  802c58:	5d                   	pop    %ebp
+  802c59:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  802c5a:	85 ff                	test   %edi,%edi
+  802c5c:	74 06                	je     802c64 <ipc_recv_pages+0x71>
+  802c5e:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  802c64:	85 f6                	test   %esi,%esi
+  802c66:	74 06                	je     802c6e <ipc_recv_pages+0x7b>
+  802c68:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  802c6e:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  802c74:	eb dc                	jmp    802c52 <ipc_recv_pages+0x5f>
+
+00802c76 <ipc_recv>:
+{
+  802c76:	55                   	push   %ebp
+  802c77:	89 e5                	mov    %esp,%ebp
+  802c79:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  802c7c:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  802c83:	ff 75 10             	push   0x10(%ebp)
+  802c86:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802c89:	50                   	push   %eax
+  802c8a:	ff 75 0c             	push   0xc(%ebp)
+  802c8d:	ff 75 08             	push   0x8(%ebp)
+  802c90:	e8 5e ff ff ff       	call   802bf3 <ipc_recv_pages>
+}
+  802c95:	c9                   	leave
+  802c96:	c3                   	ret
+
+00802c97 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  802c97:	55                   	push   %ebp
+  802c98:	89 e5                	mov    %esp,%ebp
+  802c9a:	57                   	push   %edi
+  802c9b:	56                   	push   %esi
+  802c9c:	53                   	push   %ebx
+  802c9d:	83 ec 0c             	sub    $0xc,%esp
+  802ca0:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802ca3:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802ca6:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  802ca9:	89 c3                	mov    %eax,%ebx
+  802cab:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  802cb1:	85 c0                	test   %eax,%eax
+  802cb3:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802cb8:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  802cbb:	83 ec 0c             	sub    $0xc,%esp
+  802cbe:	ff 75 14             	push   0x14(%ebp)
+  802cc1:	ff 75 18             	push   0x18(%ebp)
+  802cc4:	53                   	push   %ebx
+  802cc5:	56                   	push   %esi
+  802cc6:	57                   	push   %edi
+  802cc7:	e8 1e e3 ff ff       	call   800fea <sys_ipc_try_send>
+  802ccc:	83 c4 20             	add    $0x20,%esp
+  802ccf:	85 c0                	test   %eax,%eax
+  802cd1:	79 1e                	jns    802cf1 <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  802cd3:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802cd6:	75 07                	jne    802cdf <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  802cd8:	e8 f4 df ff ff       	call   800cd1 <sys_yield>
+  802cdd:	eb dc                	jmp    802cbb <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  802cdf:	50                   	push   %eax
+  802ce0:	68 f3 34 80 00       	push   $0x8034f3
+  802ce5:	6a 5c                	push   $0x5c
+  802ce7:	68 00 35 80 00       	push   $0x803500
+  802cec:	e8 4a d5 ff ff       	call   80023b <_panic>
+  }
+}
+  802cf1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802cf4:	5b                   	pop    %ebx
+  802cf5:	5e                   	pop    %esi
+  802cf6:	5f                   	pop    %edi
+  802cf7:	5d                   	pop    %ebp
+  802cf8:	c3                   	ret
+
+00802cf9 <ipc_send>:
+{
+  802cf9:	55                   	push   %ebp
+  802cfa:	89 e5                	mov    %esp,%ebp
+  802cfc:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  802cff:	ff 75 14             	push   0x14(%ebp)
+  802d02:	6a 01                	push   $0x1
+  802d04:	ff 75 10             	push   0x10(%ebp)
+  802d07:	ff 75 0c             	push   0xc(%ebp)
+  802d0a:	ff 75 08             	push   0x8(%ebp)
+  802d0d:	e8 85 ff ff ff       	call   802c97 <ipc_send_pages>
+}
+  802d12:	83 c4 20             	add    $0x20,%esp
+  802d15:	c9                   	leave
+  802d16:	c3                   	ret
+
+00802d17 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802d17:	55                   	push   %ebp
+  802d18:	89 e5                	mov    %esp,%ebp
+  802d1a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  802d1d:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  802d22:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802d25:	c1 e0 04             	shl    $0x4,%eax
+  802d28:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802d2d:	8b 40 50             	mov    0x50(%eax),%eax
+  802d30:	39 c8                	cmp    %ecx,%eax
+  802d32:	74 12                	je     802d46 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  802d34:	83 c2 01             	add    $0x1,%edx
+  802d37:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802d3d:	75 e3                	jne    802d22 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  802d3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d44:	eb 0e                	jmp    802d54 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  802d46:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802d49:	c1 e0 04             	shl    $0x4,%eax
+  802d4c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802d51:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802d54:	5d                   	pop    %ebp
+  802d55:	c3                   	ret
+
+00802d56 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802d56:	55                   	push   %ebp
+  802d57:	89 e5                	mov    %esp,%ebp
+  802d59:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802d5c:	89 c2                	mov    %eax,%edx
+  802d5e:	c1 ea 16             	shr    $0x16,%edx
+  802d61:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  802d68:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802d6d:	f6 c1 01             	test   $0x1,%cl
+  802d70:	74 1c                	je     802d8e <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  802d72:	c1 e8 0c             	shr    $0xc,%eax
+  802d75:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  802d7c:	a8 01                	test   $0x1,%al
+  802d7e:	74 0e                	je     802d8e <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  802d80:	c1 e8 0c             	shr    $0xc,%eax
+  802d83:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802d8a:	ef 
+  802d8b:	0f b7 d2             	movzwl %dx,%edx
+}
+  802d8e:	89 d0                	mov    %edx,%eax
+  802d90:	5d                   	pop    %ebp
+  802d91:	c3                   	ret
+
+00802d92 <udivmod>:
+  802d92:	55                   	push   %ebp
+  802d93:	57                   	push   %edi
+  802d94:	56                   	push   %esi
+  802d95:	53                   	push   %ebx
+  802d96:	83 ec 14             	sub    $0x14,%esp
+  802d99:	8b 74 24 28          	mov    0x28(%esp),%esi
+  802d9d:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  802da1:	89 fb                	mov    %edi,%ebx
+  802da3:	09 f3                	or     %esi,%ebx
+  802da5:	0f 84 88 00 00 00    	je     802e33 <udivmod+0xa1>
+  802dab:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802db0:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802db7:	00 
+  802db8:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802dbf:	00 
+  802dc0:	89 cd                	mov    %ecx,%ebp
+  802dc2:	89 34 24             	mov    %esi,(%esp)
+  802dc5:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802dc9:	eb 08                	jmp    802dd3 <udivmod+0x41>
+  802dcb:	83 ed 01             	sub    $0x1,%ebp
+  802dce:	83 fd ff             	cmp    $0xffffffff,%ebp
+  802dd1:	74 6c                	je     802e3f <udivmod+0xad>
+  802dd3:	89 c3                	mov    %eax,%ebx
+  802dd5:	89 d6                	mov    %edx,%esi
+  802dd7:	89 e9                	mov    %ebp,%ecx
+  802dd9:	0f ad f3             	shrd   %cl,%esi,%ebx
+  802ddc:	d3 ee                	shr    %cl,%esi
+  802dde:	f6 c1 20             	test   $0x20,%cl
+  802de1:	74 04                	je     802de7 <udivmod+0x55>
+  802de3:	89 f3                	mov    %esi,%ebx
+  802de5:	31 f6                	xor    %esi,%esi
+  802de7:	8b 3c 24             	mov    (%esp),%edi
+  802dea:	39 fb                	cmp    %edi,%ebx
+  802dec:	89 f7                	mov    %esi,%edi
+  802dee:	8b 1c 24             	mov    (%esp),%ebx
+  802df1:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802df5:	19 f7                	sbb    %esi,%edi
+  802df7:	72 d2                	jb     802dcb <udivmod+0x39>
+  802df9:	89 f7                	mov    %esi,%edi
+  802dfb:	89 de                	mov    %ebx,%esi
+  802dfd:	89 e9                	mov    %ebp,%ecx
+  802dff:	0f a5 f7             	shld   %cl,%esi,%edi
+  802e02:	d3 e6                	shl    %cl,%esi
+  802e04:	f6 c1 20             	test   $0x20,%cl
+  802e07:	74 04                	je     802e0d <udivmod+0x7b>
+  802e09:	89 f7                	mov    %esi,%edi
+  802e0b:	31 f6                	xor    %esi,%esi
+  802e0d:	29 f0                	sub    %esi,%eax
+  802e0f:	19 fa                	sbb    %edi,%edx
+  802e11:	be 01 00 00 00       	mov    $0x1,%esi
+  802e16:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e1b:	0f a5 f7             	shld   %cl,%esi,%edi
+  802e1e:	d3 e6                	shl    %cl,%esi
+  802e20:	f6 c1 20             	test   $0x20,%cl
+  802e23:	74 04                	je     802e29 <udivmod+0x97>
+  802e25:	89 f7                	mov    %esi,%edi
+  802e27:	31 f6                	xor    %esi,%esi
+  802e29:	09 74 24 08          	or     %esi,0x8(%esp)
+  802e2d:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802e31:	eb 98                	jmp    802dcb <udivmod+0x39>
+  802e33:	89 f0                	mov    %esi,%eax
+  802e35:	89 fa                	mov    %edi,%edx
+  802e37:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802e3b:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802e3f:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802e43:	89 01                	mov    %eax,(%ecx)
+  802e45:	89 51 04             	mov    %edx,0x4(%ecx)
+  802e48:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802e4c:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802e50:	83 c4 14             	add    $0x14,%esp
+  802e53:	5b                   	pop    %ebx
+  802e54:	5e                   	pop    %esi
+  802e55:	5f                   	pop    %edi
+  802e56:	5d                   	pop    %ebp
+  802e57:	c3                   	ret
+
+00802e58 <__udivdi3>:
+  802e58:	83 ec 18             	sub    $0x18,%esp
+  802e5b:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802e5f:	50                   	push   %eax
+  802e60:	ff 74 24 2c          	push   0x2c(%esp)
+  802e64:	ff 74 24 2c          	push   0x2c(%esp)
+  802e68:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802e6c:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802e70:	e8 1d ff ff ff       	call   802d92 <udivmod>
+  802e75:	83 c4 24             	add    $0x24,%esp
+  802e78:	c3                   	ret
+
+00802e79 <__umoddi3>:
+  802e79:	83 ec 18             	sub    $0x18,%esp
+  802e7c:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802e80:	50                   	push   %eax
+  802e81:	ff 74 24 2c          	push   0x2c(%esp)
+  802e85:	ff 74 24 2c          	push   0x2c(%esp)
+  802e89:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802e8d:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802e91:	e8 fc fe ff ff       	call   802d92 <udivmod>
+  802e96:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802e9a:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802e9e:	83 c4 24             	add    $0x24,%esp
+  802ea1:	c3                   	ret
+
+00802ea2 <__divdi3>:
+  802ea2:	56                   	push   %esi
+  802ea3:	53                   	push   %ebx
+  802ea4:	83 ec 14             	sub    $0x14,%esp
+  802ea7:	8b 44 24 20          	mov    0x20(%esp),%eax
+  802eab:	8b 54 24 24          	mov    0x24(%esp),%edx
+  802eaf:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  802eb3:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  802eb7:	85 d2                	test   %edx,%edx
+  802eb9:	78 18                	js     802ed3 <__divdi3+0x31>
+  802ebb:	85 db                	test   %ebx,%ebx
+  802ebd:	78 3e                	js     802efd <__divdi3+0x5b>
+  802ebf:	83 ec 04             	sub    $0x4,%esp
+  802ec2:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802ec6:	56                   	push   %esi
+  802ec7:	53                   	push   %ebx
+  802ec8:	51                   	push   %ecx
+  802ec9:	e8 c4 fe ff ff       	call   802d92 <udivmod>
+  802ece:	83 c4 10             	add    $0x10,%esp
+  802ed1:	eb 24                	jmp    802ef7 <__divdi3+0x55>
+  802ed3:	f7 d8                	neg    %eax
+  802ed5:	83 d2 00             	adc    $0x0,%edx
+  802ed8:	f7 da                	neg    %edx
+  802eda:	85 db                	test   %ebx,%ebx
+  802edc:	78 3a                	js     802f18 <__divdi3+0x76>
+  802ede:	83 ec 04             	sub    $0x4,%esp
+  802ee1:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802ee5:	56                   	push   %esi
+  802ee6:	53                   	push   %ebx
+  802ee7:	51                   	push   %ecx
+  802ee8:	e8 a5 fe ff ff       	call   802d92 <udivmod>
+  802eed:	83 c4 10             	add    $0x10,%esp
+  802ef0:	f7 d8                	neg    %eax
+  802ef2:	83 d2 00             	adc    $0x0,%edx
+  802ef5:	f7 da                	neg    %edx
+  802ef7:	83 c4 14             	add    $0x14,%esp
+  802efa:	5b                   	pop    %ebx
+  802efb:	5e                   	pop    %esi
+  802efc:	c3                   	ret
+  802efd:	83 ec 04             	sub    $0x4,%esp
+  802f00:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802f04:	56                   	push   %esi
+  802f05:	f7 d9                	neg    %ecx
+  802f07:	83 d3 00             	adc    $0x0,%ebx
+  802f0a:	f7 db                	neg    %ebx
+  802f0c:	53                   	push   %ebx
+  802f0d:	51                   	push   %ecx
+  802f0e:	e8 7f fe ff ff       	call   802d92 <udivmod>
+  802f13:	83 c4 10             	add    $0x10,%esp
+  802f16:	eb d8                	jmp    802ef0 <__divdi3+0x4e>
+  802f18:	83 ec 04             	sub    $0x4,%esp
+  802f1b:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802f1f:	56                   	push   %esi
+  802f20:	f7 d9                	neg    %ecx
+  802f22:	83 d3 00             	adc    $0x0,%ebx
+  802f25:	f7 db                	neg    %ebx
+  802f27:	53                   	push   %ebx
+  802f28:	51                   	push   %ecx
+  802f29:	e8 64 fe ff ff       	call   802d92 <udivmod>
+  802f2e:	83 c4 10             	add    $0x10,%esp
+  802f31:	eb c4                	jmp    802ef7 <__divdi3+0x55>
+
+00802f33 <__moddi3>:
+  802f33:	55                   	push   %ebp
+  802f34:	57                   	push   %edi
+  802f35:	56                   	push   %esi
+  802f36:	53                   	push   %ebx
+  802f37:	83 ec 24             	sub    $0x24,%esp
+  802f3a:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802f3e:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802f42:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  802f46:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  802f4a:	85 d2                	test   %edx,%edx
+  802f4c:	78 3b                	js     802f89 <__moddi3+0x56>
+  802f4e:	83 ec 04             	sub    $0x4,%esp
+  802f51:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  802f55:	56                   	push   %esi
+  802f56:	89 ce                	mov    %ecx,%esi
+  802f58:	f7 de                	neg    %esi
+  802f5a:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802f5e:	89 de                	mov    %ebx,%esi
+  802f60:	83 d6 00             	adc    $0x0,%esi
+  802f63:	f7 de                	neg    %esi
+  802f65:	89 74 24 14          	mov    %esi,0x14(%esp)
+  802f69:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802f6d:	0f 48 f1             	cmovs  %ecx,%esi
+  802f70:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  802f75:	53                   	push   %ebx
+  802f76:	56                   	push   %esi
+  802f77:	e8 16 fe ff ff       	call   802d92 <udivmod>
+  802f7c:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802f80:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802f84:	83 c4 10             	add    $0x10,%esp
+  802f87:	eb 47                	jmp    802fd0 <__moddi3+0x9d>
+  802f89:	f7 d8                	neg    %eax
+  802f8b:	83 d2 00             	adc    $0x0,%edx
+  802f8e:	f7 da                	neg    %edx
+  802f90:	83 ec 04             	sub    $0x4,%esp
+  802f93:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  802f97:	56                   	push   %esi
+  802f98:	89 cf                	mov    %ecx,%edi
+  802f9a:	f7 df                	neg    %edi
+  802f9c:	89 de                	mov    %ebx,%esi
+  802f9e:	83 d6 00             	adc    $0x0,%esi
+  802fa1:	f7 de                	neg    %esi
+  802fa3:	0f 49 cf             	cmovns %edi,%ecx
+  802fa6:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802faa:	0f 49 de             	cmovns %esi,%ebx
+  802fad:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  802fb1:	ff 74 24 0c          	push   0xc(%esp)
+  802fb5:	ff 74 24 0c          	push   0xc(%esp)
+  802fb9:	e8 d4 fd ff ff       	call   802d92 <udivmod>
+  802fbe:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802fc2:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802fc6:	f7 d8                	neg    %eax
+  802fc8:	83 d2 00             	adc    $0x0,%edx
+  802fcb:	f7 da                	neg    %edx
+  802fcd:	83 c4 10             	add    $0x10,%esp
+  802fd0:	83 c4 24             	add    $0x24,%esp
+  802fd3:	5b                   	pop    %ebx
+  802fd4:	5e                   	pop    %esi
+  802fd5:	5f                   	pop    %edi
+  802fd6:	5d                   	pop    %ebp
+  802fd7:	c3                   	ret
@@ -0,0 +1,6439 @@
+
+obj/user/echo.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 b3 00 00 00       	call   8000e4 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 1c             	sub    $0x1c,%esp
+  80003c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80003f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  int i, nflag;
+
+  nflag = 0;
+  800042:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  if (argc > 1 && strcmp(argv[1], "-n") == 0) {
+  800049:	83 ff 01             	cmp    $0x1,%edi
+  80004c:	7f 07                	jg     800055 <umain+0x22>
+    nflag = 1;
+    argc--;
+    argv++;
+  }
+  for (i = 1; i < argc; i++) {
+  80004e:	bb 01 00 00 00       	mov    $0x1,%ebx
+  800053:	eb 4c                	jmp    8000a1 <umain+0x6e>
+  if (argc > 1 && strcmp(argv[1], "-n") == 0) {
+  800055:	83 ec 08             	sub    $0x8,%esp
+  800058:	68 00 2f 80 00       	push   $0x802f00
+  80005d:	ff 76 04             	push   0x4(%esi)
+  800060:	e8 d8 01 00 00       	call   80023d <strcmp>
+  800065:	83 c4 10             	add    $0x10,%esp
+  nflag = 0;
+  800068:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  if (argc > 1 && strcmp(argv[1], "-n") == 0) {
+  80006f:	85 c0                	test   %eax,%eax
+  800071:	75 db                	jne    80004e <umain+0x1b>
+    argc--;
+  800073:	83 ef 01             	sub    $0x1,%edi
+    argv++;
+  800076:	83 c6 04             	add    $0x4,%esi
+    nflag = 1;
+  800079:	c7 45 e4 01 00 00 00 	movl   $0x1,-0x1c(%ebp)
+  800080:	eb cc                	jmp    80004e <umain+0x1b>
+    if (i > 1)
+      write(1, " ", 1);
+    write(1, argv[i], strlen(argv[i]));
+  800082:	83 ec 0c             	sub    $0xc,%esp
+  800085:	ff 34 9e             	push   (%esi,%ebx,4)
+  800088:	e8 c4 00 00 00       	call   800151 <strlen>
+  80008d:	83 c4 0c             	add    $0xc,%esp
+  800090:	50                   	push   %eax
+  800091:	ff 34 9e             	push   (%esi,%ebx,4)
+  800094:	6a 01                	push   $0x1
+  800096:	e8 c2 0d 00 00       	call   800e5d <write>
+  for (i = 1; i < argc; i++) {
+  80009b:	83 c3 01             	add    $0x1,%ebx
+  80009e:	83 c4 10             	add    $0x10,%esp
+  8000a1:	39 df                	cmp    %ebx,%edi
+  8000a3:	7e 1b                	jle    8000c0 <umain+0x8d>
+    if (i > 1)
+  8000a5:	83 fb 01             	cmp    $0x1,%ebx
+  8000a8:	7e d8                	jle    800082 <umain+0x4f>
+      write(1, " ", 1);
+  8000aa:	83 ec 04             	sub    $0x4,%esp
+  8000ad:	6a 01                	push   $0x1
+  8000af:	68 03 2f 80 00       	push   $0x802f03
+  8000b4:	6a 01                	push   $0x1
+  8000b6:	e8 a2 0d 00 00       	call   800e5d <write>
+  8000bb:	83 c4 10             	add    $0x10,%esp
+  8000be:	eb c2                	jmp    800082 <umain+0x4f>
+  }
+  if (!nflag)
+  8000c0:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  8000c4:	74 08                	je     8000ce <umain+0x9b>
+    write(1, "\n", 1);
+}
+  8000c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000c9:	5b                   	pop    %ebx
+  8000ca:	5e                   	pop    %esi
+  8000cb:	5f                   	pop    %edi
+  8000cc:	5d                   	pop    %ebp
+  8000cd:	c3                   	ret
+    write(1, "\n", 1);
+  8000ce:	83 ec 04             	sub    $0x4,%esp
+  8000d1:	6a 01                	push   $0x1
+  8000d3:	68 4c 30 80 00       	push   $0x80304c
+  8000d8:	6a 01                	push   $0x1
+  8000da:	e8 7e 0d 00 00       	call   800e5d <write>
+  8000df:	83 c4 10             	add    $0x10,%esp
+}
+  8000e2:	eb e2                	jmp    8000c6 <umain+0x93>
+
+008000e4 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000e4:	55                   	push   %ebp
+  8000e5:	89 e5                	mov    %esp,%ebp
+  8000e7:	56                   	push   %esi
+  8000e8:	53                   	push   %ebx
+  8000e9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000ec:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  8000ef:	c7 05 44 57 80 00 00 	movl   $0x0,0x805744
+  8000f6:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  8000f9:	e8 3c 04 00 00       	call   80053a <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  8000fe:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800103:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800106:	c1 e0 04             	shl    $0x4,%eax
+  800109:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80010e:	a3 44 57 80 00       	mov    %eax,0x805744
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800113:	85 db                	test   %ebx,%ebx
+  800115:	7e 07                	jle    80011e <libmain+0x3a>
+    binaryname = argv[0];
+  800117:	8b 06                	mov    (%esi),%eax
+  800119:	a3 00 40 80 00       	mov    %eax,0x804000
+
+  // call user main routine
+  umain(argc, argv);
+  80011e:	83 ec 08             	sub    $0x8,%esp
+  800121:	56                   	push   %esi
+  800122:	53                   	push   %ebx
+  800123:	e8 0b ff ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  800128:	e8 0a 00 00 00       	call   800137 <exit>
+}
+  80012d:	83 c4 10             	add    $0x10,%esp
+  800130:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800133:	5b                   	pop    %ebx
+  800134:	5e                   	pop    %esi
+  800135:	5d                   	pop    %ebp
+  800136:	c3                   	ret
+
+00800137 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800137:	55                   	push   %ebp
+  800138:	89 e5                	mov    %esp,%ebp
+  80013a:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  80013d:	e8 f2 0a 00 00       	call   800c34 <close_all>
+  sys_env_destroy(0);
+  800142:	83 ec 0c             	sub    $0xc,%esp
+  800145:	6a 00                	push   $0x0
+  800147:	e8 ad 03 00 00       	call   8004f9 <sys_env_destroy>
+}
+  80014c:	83 c4 10             	add    $0x10,%esp
+  80014f:	c9                   	leave
+  800150:	c3                   	ret
+
+00800151 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800151:	55                   	push   %ebp
+  800152:	89 e5                	mov    %esp,%ebp
+  800154:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  800157:	b8 00 00 00 00       	mov    $0x0,%eax
+  80015c:	eb 03                	jmp    800161 <strlen+0x10>
+    n++;
+  80015e:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  800161:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800165:	75 f7                	jne    80015e <strlen+0xd>
+  return n;
+}
+  800167:	5d                   	pop    %ebp
+  800168:	c3                   	ret
+
+00800169 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800169:	55                   	push   %ebp
+  80016a:	89 e5                	mov    %esp,%ebp
+  80016c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80016f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800172:	b8 00 00 00 00       	mov    $0x0,%eax
+  800177:	eb 03                	jmp    80017c <strnlen+0x13>
+    n++;
+  800179:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80017c:	39 d0                	cmp    %edx,%eax
+  80017e:	74 08                	je     800188 <strnlen+0x1f>
+  800180:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800184:	75 f3                	jne    800179 <strnlen+0x10>
+  800186:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  800188:	89 d0                	mov    %edx,%eax
+  80018a:	5d                   	pop    %ebp
+  80018b:	c3                   	ret
+
+0080018c <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80018c:	55                   	push   %ebp
+  80018d:	89 e5                	mov    %esp,%ebp
+  80018f:	53                   	push   %ebx
+  800190:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800193:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  800196:	b8 00 00 00 00       	mov    $0x0,%eax
+  80019b:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80019f:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8001a2:	83 c0 01             	add    $0x1,%eax
+  8001a5:	84 d2                	test   %dl,%dl
+  8001a7:	75 f2                	jne    80019b <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  8001a9:	89 c8                	mov    %ecx,%eax
+  8001ab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001ae:	c9                   	leave
+  8001af:	c3                   	ret
+
+008001b0 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8001b0:	55                   	push   %ebp
+  8001b1:	89 e5                	mov    %esp,%ebp
+  8001b3:	53                   	push   %ebx
+  8001b4:	83 ec 10             	sub    $0x10,%esp
+  8001b7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  8001ba:	53                   	push   %ebx
+  8001bb:	e8 91 ff ff ff       	call   800151 <strlen>
+  8001c0:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  8001c3:	ff 75 0c             	push   0xc(%ebp)
+  8001c6:	01 d8                	add    %ebx,%eax
+  8001c8:	50                   	push   %eax
+  8001c9:	e8 be ff ff ff       	call   80018c <strcpy>
+  return dst;
+}
+  8001ce:	89 d8                	mov    %ebx,%eax
+  8001d0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001d3:	c9                   	leave
+  8001d4:	c3                   	ret
+
+008001d5 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  8001d5:	55                   	push   %ebp
+  8001d6:	89 e5                	mov    %esp,%ebp
+  8001d8:	56                   	push   %esi
+  8001d9:	53                   	push   %ebx
+  8001da:	8b 75 08             	mov    0x8(%ebp),%esi
+  8001dd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  8001e0:	89 f3                	mov    %esi,%ebx
+  8001e2:	03 5d 10             	add    0x10(%ebp),%ebx
+  8001e5:	89 f0                	mov    %esi,%eax
+  8001e7:	eb 0f                	jmp    8001f8 <strncpy+0x23>
+    *dst++ = *src;
+  8001e9:	83 c0 01             	add    $0x1,%eax
+  8001ec:	0f b6 0a             	movzbl (%edx),%ecx
+  8001ef:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  8001f2:	80 f9 01             	cmp    $0x1,%cl
+  8001f5:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  8001f8:	39 d8                	cmp    %ebx,%eax
+  8001fa:	75 ed                	jne    8001e9 <strncpy+0x14>
+  }
+  return ret;
+}
+  8001fc:	89 f0                	mov    %esi,%eax
+  8001fe:	5b                   	pop    %ebx
+  8001ff:	5e                   	pop    %esi
+  800200:	5d                   	pop    %ebp
+  800201:	c3                   	ret
+
+00800202 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800202:	55                   	push   %ebp
+  800203:	89 e5                	mov    %esp,%ebp
+  800205:	56                   	push   %esi
+  800206:	53                   	push   %ebx
+  800207:	8b 75 08             	mov    0x8(%ebp),%esi
+  80020a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80020d:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  800210:	89 f0                	mov    %esi,%eax
+  800212:	85 d2                	test   %edx,%edx
+  800214:	74 21                	je     800237 <strlcpy+0x35>
+  800216:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80021a:	89 f2                	mov    %esi,%edx
+  80021c:	eb 09                	jmp    800227 <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  80021e:	83 c1 01             	add    $0x1,%ecx
+  800221:	83 c2 01             	add    $0x1,%edx
+  800224:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  800227:	39 c2                	cmp    %eax,%edx
+  800229:	74 09                	je     800234 <strlcpy+0x32>
+  80022b:	0f b6 19             	movzbl (%ecx),%ebx
+  80022e:	84 db                	test   %bl,%bl
+  800230:	75 ec                	jne    80021e <strlcpy+0x1c>
+  800232:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  800234:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  800237:	29 f0                	sub    %esi,%eax
+}
+  800239:	5b                   	pop    %ebx
+  80023a:	5e                   	pop    %esi
+  80023b:	5d                   	pop    %ebp
+  80023c:	c3                   	ret
+
+0080023d <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80023d:	55                   	push   %ebp
+  80023e:	89 e5                	mov    %esp,%ebp
+  800240:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800243:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  800246:	eb 06                	jmp    80024e <strcmp+0x11>
+    p++, q++;
+  800248:	83 c1 01             	add    $0x1,%ecx
+  80024b:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  80024e:	0f b6 01             	movzbl (%ecx),%eax
+  800251:	84 c0                	test   %al,%al
+  800253:	74 04                	je     800259 <strcmp+0x1c>
+  800255:	3a 02                	cmp    (%edx),%al
+  800257:	74 ef                	je     800248 <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  800259:	0f b6 c0             	movzbl %al,%eax
+  80025c:	0f b6 12             	movzbl (%edx),%edx
+  80025f:	29 d0                	sub    %edx,%eax
+}
+  800261:	5d                   	pop    %ebp
+  800262:	c3                   	ret
+
+00800263 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800263:	55                   	push   %ebp
+  800264:	89 e5                	mov    %esp,%ebp
+  800266:	53                   	push   %ebx
+  800267:	8b 45 08             	mov    0x8(%ebp),%eax
+  80026a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80026d:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  800270:	eb 09                	jmp    80027b <strncmp+0x18>
+    n--, p++, q++;
+  800272:	83 ea 01             	sub    $0x1,%edx
+  800275:	83 c0 01             	add    $0x1,%eax
+  800278:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  80027b:	85 d2                	test   %edx,%edx
+  80027d:	74 18                	je     800297 <strncmp+0x34>
+  80027f:	0f b6 18             	movzbl (%eax),%ebx
+  800282:	84 db                	test   %bl,%bl
+  800284:	74 04                	je     80028a <strncmp+0x27>
+  800286:	3a 19                	cmp    (%ecx),%bl
+  800288:	74 e8                	je     800272 <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80028a:	0f b6 00             	movzbl (%eax),%eax
+  80028d:	0f b6 11             	movzbl (%ecx),%edx
+  800290:	29 d0                	sub    %edx,%eax
+}
+  800292:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800295:	c9                   	leave
+  800296:	c3                   	ret
+    return 0;
+  800297:	b8 00 00 00 00       	mov    $0x0,%eax
+  80029c:	eb f4                	jmp    800292 <strncmp+0x2f>
+
+0080029e <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80029e:	55                   	push   %ebp
+  80029f:	89 e5                	mov    %esp,%ebp
+  8002a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002a4:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  8002a8:	eb 03                	jmp    8002ad <strchr+0xf>
+  8002aa:	83 c0 01             	add    $0x1,%eax
+  8002ad:	0f b6 10             	movzbl (%eax),%edx
+  8002b0:	84 d2                	test   %dl,%dl
+  8002b2:	74 06                	je     8002ba <strchr+0x1c>
+    if (*s == c)
+  8002b4:	38 ca                	cmp    %cl,%dl
+  8002b6:	75 f2                	jne    8002aa <strchr+0xc>
+  8002b8:	eb 05                	jmp    8002bf <strchr+0x21>
+      return (char*)s;
+  return 0;
+  8002ba:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8002bf:	5d                   	pop    %ebp
+  8002c0:	c3                   	ret
+
+008002c1 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8002c1:	55                   	push   %ebp
+  8002c2:	89 e5                	mov    %esp,%ebp
+  8002c4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002c7:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  8002cb:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  8002ce:	38 ca                	cmp    %cl,%dl
+  8002d0:	74 09                	je     8002db <strfind+0x1a>
+  8002d2:	84 d2                	test   %dl,%dl
+  8002d4:	74 05                	je     8002db <strfind+0x1a>
+  for (; *s; s++)
+  8002d6:	83 c0 01             	add    $0x1,%eax
+  8002d9:	eb f0                	jmp    8002cb <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  8002db:	5d                   	pop    %ebp
+  8002dc:	c3                   	ret
+
+008002dd <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8002dd:	55                   	push   %ebp
+  8002de:	89 e5                	mov    %esp,%ebp
+  8002e0:	57                   	push   %edi
+  8002e1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8002e4:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  8002e7:	85 c9                	test   %ecx,%ecx
+  8002e9:	74 20                	je     80030b <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  8002eb:	89 f8                	mov    %edi,%eax
+  8002ed:	09 c8                	or     %ecx,%eax
+  8002ef:	a8 03                	test   $0x3,%al
+  8002f1:	75 12                	jne    800305 <memset+0x28>
+    c &= 0xFF;
+  8002f3:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8002f7:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  8002fd:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  800300:	fc                   	cld
+  800301:	f3 ab                	rep stos %eax,%es:(%edi)
+  800303:	eb 06                	jmp    80030b <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  800305:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800308:	fc                   	cld
+  800309:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  80030b:	89 f8                	mov    %edi,%eax
+  80030d:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800310:	c9                   	leave
+  800311:	c3                   	ret
+
+00800312 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800312:	55                   	push   %ebp
+  800313:	89 e5                	mov    %esp,%ebp
+  800315:	57                   	push   %edi
+  800316:	56                   	push   %esi
+  800317:	8b 45 08             	mov    0x8(%ebp),%eax
+  80031a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80031d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  800320:	39 c6                	cmp    %eax,%esi
+  800322:	73 32                	jae    800356 <memmove+0x44>
+  800324:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800327:	39 d0                	cmp    %edx,%eax
+  800329:	73 2b                	jae    800356 <memmove+0x44>
+    s += n;
+    d += n;
+  80032b:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80032e:	89 d6                	mov    %edx,%esi
+  800330:	09 fe                	or     %edi,%esi
+  800332:	09 ce                	or     %ecx,%esi
+  800334:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  80033a:	75 0e                	jne    80034a <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  80033c:	83 ef 04             	sub    $0x4,%edi
+  80033f:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800342:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  800345:	fd                   	std
+  800346:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800348:	eb 09                	jmp    800353 <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  80034a:	83 ef 01             	sub    $0x1,%edi
+  80034d:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  800350:	fd                   	std
+  800351:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  800353:	fc                   	cld
+  800354:	eb 1a                	jmp    800370 <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800356:	89 f2                	mov    %esi,%edx
+  800358:	09 c2                	or     %eax,%edx
+  80035a:	09 ca                	or     %ecx,%edx
+  80035c:	f6 c2 03             	test   $0x3,%dl
+  80035f:	75 0a                	jne    80036b <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800361:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  800364:	89 c7                	mov    %eax,%edi
+  800366:	fc                   	cld
+  800367:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800369:	eb 05                	jmp    800370 <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  80036b:	89 c7                	mov    %eax,%edi
+  80036d:	fc                   	cld
+  80036e:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  800370:	5e                   	pop    %esi
+  800371:	5f                   	pop    %edi
+  800372:	5d                   	pop    %ebp
+  800373:	c3                   	ret
+
+00800374 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800374:	55                   	push   %ebp
+  800375:	89 e5                	mov    %esp,%ebp
+  800377:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  80037a:	ff 75 10             	push   0x10(%ebp)
+  80037d:	ff 75 0c             	push   0xc(%ebp)
+  800380:	ff 75 08             	push   0x8(%ebp)
+  800383:	e8 8a ff ff ff       	call   800312 <memmove>
+}
+  800388:	c9                   	leave
+  800389:	c3                   	ret
+
+0080038a <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  80038a:	55                   	push   %ebp
+  80038b:	89 e5                	mov    %esp,%ebp
+  80038d:	56                   	push   %esi
+  80038e:	53                   	push   %ebx
+  80038f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800392:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  800395:	89 c6                	mov    %eax,%esi
+  800397:	03 75 10             	add    0x10(%ebp),%esi
+  80039a:	eb 06                	jmp    8003a2 <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  80039c:	83 c0 01             	add    $0x1,%eax
+  80039f:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  8003a2:	39 f0                	cmp    %esi,%eax
+  8003a4:	74 14                	je     8003ba <memcmp+0x30>
+    if (*s1 != *s2)
+  8003a6:	0f b6 08             	movzbl (%eax),%ecx
+  8003a9:	0f b6 1a             	movzbl (%edx),%ebx
+  8003ac:	38 d9                	cmp    %bl,%cl
+  8003ae:	74 ec                	je     80039c <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  8003b0:	0f b6 c1             	movzbl %cl,%eax
+  8003b3:	0f b6 db             	movzbl %bl,%ebx
+  8003b6:	29 d8                	sub    %ebx,%eax
+  8003b8:	eb 05                	jmp    8003bf <memcmp+0x35>
+  }
+
+  return 0;
+  8003ba:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8003bf:	5b                   	pop    %ebx
+  8003c0:	5e                   	pop    %esi
+  8003c1:	5d                   	pop    %ebp
+  8003c2:	c3                   	ret
+
+008003c3 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8003c3:	55                   	push   %ebp
+  8003c4:	89 e5                	mov    %esp,%ebp
+  8003c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003c9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  8003cc:	89 c2                	mov    %eax,%edx
+  8003ce:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  8003d1:	eb 03                	jmp    8003d6 <memfind+0x13>
+  8003d3:	83 c0 01             	add    $0x1,%eax
+  8003d6:	39 d0                	cmp    %edx,%eax
+  8003d8:	73 04                	jae    8003de <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  8003da:	38 08                	cmp    %cl,(%eax)
+  8003dc:	75 f5                	jne    8003d3 <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  8003de:	5d                   	pop    %ebp
+  8003df:	c3                   	ret
+
+008003e0 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8003e0:	55                   	push   %ebp
+  8003e1:	89 e5                	mov    %esp,%ebp
+  8003e3:	57                   	push   %edi
+  8003e4:	56                   	push   %esi
+  8003e5:	53                   	push   %ebx
+  8003e6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003e9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  8003ec:	eb 03                	jmp    8003f1 <strtol+0x11>
+    s++;
+  8003ee:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  8003f1:	0f b6 02             	movzbl (%edx),%eax
+  8003f4:	3c 20                	cmp    $0x20,%al
+  8003f6:	74 f6                	je     8003ee <strtol+0xe>
+  8003f8:	3c 09                	cmp    $0x9,%al
+  8003fa:	74 f2                	je     8003ee <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  8003fc:	3c 2b                	cmp    $0x2b,%al
+  8003fe:	74 2a                	je     80042a <strtol+0x4a>
+  int neg = 0;
+  800400:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  800405:	3c 2d                	cmp    $0x2d,%al
+  800407:	74 2b                	je     800434 <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800409:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  80040f:	75 0f                	jne    800420 <strtol+0x40>
+  800411:	80 3a 30             	cmpb   $0x30,(%edx)
+  800414:	74 28                	je     80043e <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  800416:	85 db                	test   %ebx,%ebx
+  800418:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80041d:	0f 44 d8             	cmove  %eax,%ebx
+  800420:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800425:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800428:	eb 46                	jmp    800470 <strtol+0x90>
+    s++;
+  80042a:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  80042d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800432:	eb d5                	jmp    800409 <strtol+0x29>
+    s++, neg = 1;
+  800434:	83 c2 01             	add    $0x1,%edx
+  800437:	bf 01 00 00 00       	mov    $0x1,%edi
+  80043c:	eb cb                	jmp    800409 <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80043e:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800442:	74 0e                	je     800452 <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  800444:	85 db                	test   %ebx,%ebx
+  800446:	75 d8                	jne    800420 <strtol+0x40>
+    s++, base = 8;
+  800448:	83 c2 01             	add    $0x1,%edx
+  80044b:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800450:	eb ce                	jmp    800420 <strtol+0x40>
+    s += 2, base = 16;
+  800452:	83 c2 02             	add    $0x2,%edx
+  800455:	bb 10 00 00 00       	mov    $0x10,%ebx
+  80045a:	eb c4                	jmp    800420 <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  80045c:	0f be c0             	movsbl %al,%eax
+  80045f:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  800462:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800465:	7d 3a                	jge    8004a1 <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  800467:	83 c2 01             	add    $0x1,%edx
+  80046a:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  80046e:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  800470:	0f b6 02             	movzbl (%edx),%eax
+  800473:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800476:	89 f3                	mov    %esi,%ebx
+  800478:	80 fb 09             	cmp    $0x9,%bl
+  80047b:	76 df                	jbe    80045c <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  80047d:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800480:	89 f3                	mov    %esi,%ebx
+  800482:	80 fb 19             	cmp    $0x19,%bl
+  800485:	77 08                	ja     80048f <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  800487:	0f be c0             	movsbl %al,%eax
+  80048a:	83 e8 57             	sub    $0x57,%eax
+  80048d:	eb d3                	jmp    800462 <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  80048f:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800492:	89 f3                	mov    %esi,%ebx
+  800494:	80 fb 19             	cmp    $0x19,%bl
+  800497:	77 08                	ja     8004a1 <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  800499:	0f be c0             	movsbl %al,%eax
+  80049c:	83 e8 37             	sub    $0x37,%eax
+  80049f:	eb c1                	jmp    800462 <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  8004a1:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8004a5:	74 05                	je     8004ac <strtol+0xcc>
+    *endptr = (char*)s;
+  8004a7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8004aa:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  8004ac:	89 c8                	mov    %ecx,%eax
+  8004ae:	f7 d8                	neg    %eax
+  8004b0:	85 ff                	test   %edi,%edi
+  8004b2:	0f 45 c8             	cmovne %eax,%ecx
+}
+  8004b5:	89 c8                	mov    %ecx,%eax
+  8004b7:	5b                   	pop    %ebx
+  8004b8:	5e                   	pop    %esi
+  8004b9:	5f                   	pop    %edi
+  8004ba:	5d                   	pop    %ebp
+  8004bb:	c3                   	ret
+
+008004bc <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8004bc:	55                   	push   %ebp
+  8004bd:	89 e5                	mov    %esp,%ebp
+  8004bf:	57                   	push   %edi
+  8004c0:	56                   	push   %esi
+  8004c1:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8004c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004c7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004ca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004cd:	89 c3                	mov    %eax,%ebx
+  8004cf:	89 c7                	mov    %eax,%edi
+  8004d1:	89 c6                	mov    %eax,%esi
+  8004d3:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  8004d5:	5b                   	pop    %ebx
+  8004d6:	5e                   	pop    %esi
+  8004d7:	5f                   	pop    %edi
+  8004d8:	5d                   	pop    %ebp
+  8004d9:	c3                   	ret
+
+008004da <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  8004da:	55                   	push   %ebp
+  8004db:	89 e5                	mov    %esp,%ebp
+  8004dd:	57                   	push   %edi
+  8004de:	56                   	push   %esi
+  8004df:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8004e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004e5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8004ea:	89 d1                	mov    %edx,%ecx
+  8004ec:	89 d3                	mov    %edx,%ebx
+  8004ee:	89 d7                	mov    %edx,%edi
+  8004f0:	89 d6                	mov    %edx,%esi
+  8004f2:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  8004f4:	5b                   	pop    %ebx
+  8004f5:	5e                   	pop    %esi
+  8004f6:	5f                   	pop    %edi
+  8004f7:	5d                   	pop    %ebp
+  8004f8:	c3                   	ret
+
+008004f9 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8004f9:	55                   	push   %ebp
+  8004fa:	89 e5                	mov    %esp,%ebp
+  8004fc:	57                   	push   %edi
+  8004fd:	56                   	push   %esi
+  8004fe:	53                   	push   %ebx
+  8004ff:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800502:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800507:	8b 55 08             	mov    0x8(%ebp),%edx
+  80050a:	b8 03 00 00 00       	mov    $0x3,%eax
+  80050f:	89 cb                	mov    %ecx,%ebx
+  800511:	89 cf                	mov    %ecx,%edi
+  800513:	89 ce                	mov    %ecx,%esi
+  800515:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800517:	85 c0                	test   %eax,%eax
+  800519:	7f 08                	jg     800523 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  80051b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80051e:	5b                   	pop    %ebx
+  80051f:	5e                   	pop    %esi
+  800520:	5f                   	pop    %edi
+  800521:	5d                   	pop    %ebp
+  800522:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800523:	83 ec 0c             	sub    $0xc,%esp
+  800526:	50                   	push   %eax
+  800527:	6a 03                	push   $0x3
+  800529:	68 0f 2f 80 00       	push   $0x802f0f
+  80052e:	6a 23                	push   $0x23
+  800530:	68 2c 2f 80 00       	push   $0x802f2c
+  800535:	e8 41 1f 00 00       	call   80247b <_panic>
+
+0080053a <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  80053a:	55                   	push   %ebp
+  80053b:	89 e5                	mov    %esp,%ebp
+  80053d:	57                   	push   %edi
+  80053e:	56                   	push   %esi
+  80053f:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800540:	ba 00 00 00 00       	mov    $0x0,%edx
+  800545:	b8 02 00 00 00       	mov    $0x2,%eax
+  80054a:	89 d1                	mov    %edx,%ecx
+  80054c:	89 d3                	mov    %edx,%ebx
+  80054e:	89 d7                	mov    %edx,%edi
+  800550:	89 d6                	mov    %edx,%esi
+  800552:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800554:	5b                   	pop    %ebx
+  800555:	5e                   	pop    %esi
+  800556:	5f                   	pop    %edi
+  800557:	5d                   	pop    %ebp
+  800558:	c3                   	ret
+
+00800559 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800559:	55                   	push   %ebp
+  80055a:	89 e5                	mov    %esp,%ebp
+  80055c:	57                   	push   %edi
+  80055d:	56                   	push   %esi
+  80055e:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80055f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800564:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800569:	89 d1                	mov    %edx,%ecx
+  80056b:	89 d3                	mov    %edx,%ebx
+  80056d:	89 d7                	mov    %edx,%edi
+  80056f:	89 d6                	mov    %edx,%esi
+  800571:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800573:	5b                   	pop    %ebx
+  800574:	5e                   	pop    %esi
+  800575:	5f                   	pop    %edi
+  800576:	5d                   	pop    %ebp
+  800577:	c3                   	ret
+
+00800578 <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  800578:	55                   	push   %ebp
+  800579:	89 e5                	mov    %esp,%ebp
+  80057b:	57                   	push   %edi
+  80057c:	56                   	push   %esi
+  80057d:	53                   	push   %ebx
+  80057e:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  800581:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  800585:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80058a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80058d:	b8 14 00 00 00       	mov    $0x14,%eax
+  800592:	89 df                	mov    %ebx,%edi
+  800594:	89 de                	mov    %ebx,%esi
+  800596:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800598:	85 c0                	test   %eax,%eax
+  80059a:	7f 08                	jg     8005a4 <sys_env_set_cow+0x2c>
+}
+  80059c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80059f:	5b                   	pop    %ebx
+  8005a0:	5e                   	pop    %esi
+  8005a1:	5f                   	pop    %edi
+  8005a2:	5d                   	pop    %ebp
+  8005a3:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8005a4:	83 ec 0c             	sub    $0xc,%esp
+  8005a7:	50                   	push   %eax
+  8005a8:	6a 14                	push   $0x14
+  8005aa:	68 0f 2f 80 00       	push   $0x802f0f
+  8005af:	6a 23                	push   $0x23
+  8005b1:	68 2c 2f 80 00       	push   $0x802f2c
+  8005b6:	e8 c0 1e 00 00       	call   80247b <_panic>
+
+008005bb <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8005bb:	55                   	push   %ebp
+  8005bc:	89 e5                	mov    %esp,%ebp
+  8005be:	57                   	push   %edi
+  8005bf:	56                   	push   %esi
+  8005c0:	53                   	push   %ebx
+  8005c1:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8005c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8005c9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005cc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005cf:	b8 04 00 00 00       	mov    $0x4,%eax
+  8005d4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8005d7:	89 f7                	mov    %esi,%edi
+  8005d9:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8005db:	85 c0                	test   %eax,%eax
+  8005dd:	7f 08                	jg     8005e7 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  8005df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005e2:	5b                   	pop    %ebx
+  8005e3:	5e                   	pop    %esi
+  8005e4:	5f                   	pop    %edi
+  8005e5:	5d                   	pop    %ebp
+  8005e6:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8005e7:	83 ec 0c             	sub    $0xc,%esp
+  8005ea:	50                   	push   %eax
+  8005eb:	6a 04                	push   $0x4
+  8005ed:	68 0f 2f 80 00       	push   $0x802f0f
+  8005f2:	6a 23                	push   $0x23
+  8005f4:	68 2c 2f 80 00       	push   $0x802f2c
+  8005f9:	e8 7d 1e 00 00       	call   80247b <_panic>
+
+008005fe <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8005fe:	55                   	push   %ebp
+  8005ff:	89 e5                	mov    %esp,%ebp
+  800601:	57                   	push   %edi
+  800602:	56                   	push   %esi
+  800603:	53                   	push   %ebx
+  800604:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800607:	8b 55 08             	mov    0x8(%ebp),%edx
+  80060a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80060d:	b8 05 00 00 00       	mov    $0x5,%eax
+  800612:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800615:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800618:	8b 75 18             	mov    0x18(%ebp),%esi
+  80061b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80061d:	85 c0                	test   %eax,%eax
+  80061f:	7f 08                	jg     800629 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  800621:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800624:	5b                   	pop    %ebx
+  800625:	5e                   	pop    %esi
+  800626:	5f                   	pop    %edi
+  800627:	5d                   	pop    %ebp
+  800628:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800629:	83 ec 0c             	sub    $0xc,%esp
+  80062c:	50                   	push   %eax
+  80062d:	6a 05                	push   $0x5
+  80062f:	68 0f 2f 80 00       	push   $0x802f0f
+  800634:	6a 23                	push   $0x23
+  800636:	68 2c 2f 80 00       	push   $0x802f2c
+  80063b:	e8 3b 1e 00 00       	call   80247b <_panic>
+
+00800640 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800640:	55                   	push   %ebp
+  800641:	89 e5                	mov    %esp,%ebp
+  800643:	57                   	push   %edi
+  800644:	56                   	push   %esi
+  800645:	53                   	push   %ebx
+  800646:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800649:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80064e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800651:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800654:	b8 06 00 00 00       	mov    $0x6,%eax
+  800659:	89 df                	mov    %ebx,%edi
+  80065b:	89 de                	mov    %ebx,%esi
+  80065d:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80065f:	85 c0                	test   %eax,%eax
+  800661:	7f 08                	jg     80066b <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  800663:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800666:	5b                   	pop    %ebx
+  800667:	5e                   	pop    %esi
+  800668:	5f                   	pop    %edi
+  800669:	5d                   	pop    %ebp
+  80066a:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80066b:	83 ec 0c             	sub    $0xc,%esp
+  80066e:	50                   	push   %eax
+  80066f:	6a 06                	push   $0x6
+  800671:	68 0f 2f 80 00       	push   $0x802f0f
+  800676:	6a 23                	push   $0x23
+  800678:	68 2c 2f 80 00       	push   $0x802f2c
+  80067d:	e8 f9 1d 00 00       	call   80247b <_panic>
+
+00800682 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  800682:	55                   	push   %ebp
+  800683:	89 e5                	mov    %esp,%ebp
+  800685:	57                   	push   %edi
+  800686:	56                   	push   %esi
+  800687:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800688:	8b 55 08             	mov    0x8(%ebp),%edx
+  80068b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80068e:	b8 11 00 00 00       	mov    $0x11,%eax
+  800693:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800696:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800699:	8b 75 18             	mov    0x18(%ebp),%esi
+  80069c:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  80069e:	5b                   	pop    %ebx
+  80069f:	5e                   	pop    %esi
+  8006a0:	5f                   	pop    %edi
+  8006a1:	5d                   	pop    %ebp
+  8006a2:	c3                   	ret
+
+008006a3 <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  8006a3:	55                   	push   %ebp
+  8006a4:	89 e5                	mov    %esp,%ebp
+  8006a6:	57                   	push   %edi
+  8006a7:	56                   	push   %esi
+  8006a8:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8006a9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006ac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8006af:	b8 12 00 00 00       	mov    $0x12,%eax
+  8006b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8006b9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8006bc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8006bf:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  8006c1:	5b                   	pop    %ebx
+  8006c2:	5e                   	pop    %esi
+  8006c3:	5f                   	pop    %edi
+  8006c4:	5d                   	pop    %ebp
+  8006c5:	c3                   	ret
+
+008006c6 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  8006c6:	55                   	push   %ebp
+  8006c7:	89 e5                	mov    %esp,%ebp
+  8006c9:	57                   	push   %edi
+  8006ca:	56                   	push   %esi
+  8006cb:	53                   	push   %ebx
+  8006cc:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8006cf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8006d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8006da:	b8 16 00 00 00       	mov    $0x16,%eax
+  8006df:	89 df                	mov    %ebx,%edi
+  8006e1:	89 de                	mov    %ebx,%esi
+  8006e3:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8006e5:	85 c0                	test   %eax,%eax
+  8006e7:	7f 08                	jg     8006f1 <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  8006e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006ec:	5b                   	pop    %ebx
+  8006ed:	5e                   	pop    %esi
+  8006ee:	5f                   	pop    %edi
+  8006ef:	5d                   	pop    %ebp
+  8006f0:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8006f1:	83 ec 0c             	sub    $0xc,%esp
+  8006f4:	50                   	push   %eax
+  8006f5:	6a 16                	push   $0x16
+  8006f7:	68 0f 2f 80 00       	push   $0x802f0f
+  8006fc:	6a 23                	push   $0x23
+  8006fe:	68 2c 2f 80 00       	push   $0x802f2c
+  800703:	e8 73 1d 00 00       	call   80247b <_panic>
+
+00800708 <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  800708:	55                   	push   %ebp
+  800709:	89 e5                	mov    %esp,%ebp
+  80070b:	57                   	push   %edi
+  80070c:	56                   	push   %esi
+  80070d:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80070e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800713:	8b 55 08             	mov    0x8(%ebp),%edx
+  800716:	b8 17 00 00 00       	mov    $0x17,%eax
+  80071b:	89 cb                	mov    %ecx,%ebx
+  80071d:	89 cf                	mov    %ecx,%edi
+  80071f:	89 ce                	mov    %ecx,%esi
+  800721:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  800723:	5b                   	pop    %ebx
+  800724:	5e                   	pop    %esi
+  800725:	5f                   	pop    %edi
+  800726:	5d                   	pop    %ebp
+  800727:	c3                   	ret
+
+00800728 <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  800728:	55                   	push   %ebp
+  800729:	89 e5                	mov    %esp,%ebp
+  80072b:	57                   	push   %edi
+  80072c:	56                   	push   %esi
+  80072d:	53                   	push   %ebx
+  80072e:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800731:	be 00 00 00 00       	mov    $0x0,%esi
+  800736:	8b 55 08             	mov    0x8(%ebp),%edx
+  800739:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80073c:	b8 18 00 00 00       	mov    $0x18,%eax
+  800741:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800744:	89 f7                	mov    %esi,%edi
+  800746:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800748:	85 c0                	test   %eax,%eax
+  80074a:	7f 08                	jg     800754 <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  80074c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80074f:	5b                   	pop    %ebx
+  800750:	5e                   	pop    %esi
+  800751:	5f                   	pop    %edi
+  800752:	5d                   	pop    %ebp
+  800753:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800754:	83 ec 0c             	sub    $0xc,%esp
+  800757:	50                   	push   %eax
+  800758:	6a 18                	push   $0x18
+  80075a:	68 0f 2f 80 00       	push   $0x802f0f
+  80075f:	6a 23                	push   $0x23
+  800761:	68 2c 2f 80 00       	push   $0x802f2c
+  800766:	e8 10 1d 00 00       	call   80247b <_panic>
+
+0080076b <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  80076b:	55                   	push   %ebp
+  80076c:	89 e5                	mov    %esp,%ebp
+  80076e:	57                   	push   %edi
+  80076f:	56                   	push   %esi
+  800770:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800771:	be 00 00 00 00       	mov    $0x0,%esi
+  800776:	8b 55 08             	mov    0x8(%ebp),%edx
+  800779:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80077c:	b8 19 00 00 00       	mov    $0x19,%eax
+  800781:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800784:	89 f7                	mov    %esi,%edi
+  800786:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  800788:	5b                   	pop    %ebx
+  800789:	5e                   	pop    %esi
+  80078a:	5f                   	pop    %edi
+  80078b:	5d                   	pop    %ebp
+  80078c:	c3                   	ret
+
+0080078d <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  80078d:	55                   	push   %ebp
+  80078e:	89 e5                	mov    %esp,%ebp
+  800790:	57                   	push   %edi
+  800791:	56                   	push   %esi
+  800792:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800793:	ba 00 00 00 00       	mov    $0x0,%edx
+  800798:	b8 15 00 00 00       	mov    $0x15,%eax
+  80079d:	89 d1                	mov    %edx,%ecx
+  80079f:	89 d3                	mov    %edx,%ebx
+  8007a1:	89 d7                	mov    %edx,%edi
+  8007a3:	89 d6                	mov    %edx,%esi
+  8007a5:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8007a7:	5b                   	pop    %ebx
+  8007a8:	5e                   	pop    %esi
+  8007a9:	5f                   	pop    %edi
+  8007aa:	5d                   	pop    %ebp
+  8007ab:	c3                   	ret
+
+008007ac <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8007ac:	55                   	push   %ebp
+  8007ad:	89 e5                	mov    %esp,%ebp
+  8007af:	57                   	push   %edi
+  8007b0:	56                   	push   %esi
+  8007b1:	53                   	push   %ebx
+  8007b2:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8007b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8007ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007c0:	b8 08 00 00 00       	mov    $0x8,%eax
+  8007c5:	89 df                	mov    %ebx,%edi
+  8007c7:	89 de                	mov    %ebx,%esi
+  8007c9:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8007cb:	85 c0                	test   %eax,%eax
+  8007cd:	7f 08                	jg     8007d7 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8007cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007d2:	5b                   	pop    %ebx
+  8007d3:	5e                   	pop    %esi
+  8007d4:	5f                   	pop    %edi
+  8007d5:	5d                   	pop    %ebp
+  8007d6:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8007d7:	83 ec 0c             	sub    $0xc,%esp
+  8007da:	50                   	push   %eax
+  8007db:	6a 08                	push   $0x8
+  8007dd:	68 0f 2f 80 00       	push   $0x802f0f
+  8007e2:	6a 23                	push   $0x23
+  8007e4:	68 2c 2f 80 00       	push   $0x802f2c
+  8007e9:	e8 8d 1c 00 00       	call   80247b <_panic>
+
+008007ee <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8007ee:	55                   	push   %ebp
+  8007ef:	89 e5                	mov    %esp,%ebp
+  8007f1:	57                   	push   %edi
+  8007f2:	56                   	push   %esi
+  8007f3:	53                   	push   %ebx
+  8007f4:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8007f7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8007fc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8007ff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800802:	b8 09 00 00 00       	mov    $0x9,%eax
+  800807:	89 df                	mov    %ebx,%edi
+  800809:	89 de                	mov    %ebx,%esi
+  80080b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80080d:	85 c0                	test   %eax,%eax
+  80080f:	7f 08                	jg     800819 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  800811:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800814:	5b                   	pop    %ebx
+  800815:	5e                   	pop    %esi
+  800816:	5f                   	pop    %edi
+  800817:	5d                   	pop    %ebp
+  800818:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800819:	83 ec 0c             	sub    $0xc,%esp
+  80081c:	50                   	push   %eax
+  80081d:	6a 09                	push   $0x9
+  80081f:	68 0f 2f 80 00       	push   $0x802f0f
+  800824:	6a 23                	push   $0x23
+  800826:	68 2c 2f 80 00       	push   $0x802f2c
+  80082b:	e8 4b 1c 00 00       	call   80247b <_panic>
+
+00800830 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800830:	55                   	push   %ebp
+  800831:	89 e5                	mov    %esp,%ebp
+  800833:	57                   	push   %edi
+  800834:	56                   	push   %esi
+  800835:	53                   	push   %ebx
+  800836:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800839:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80083e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800841:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800844:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800849:	89 df                	mov    %ebx,%edi
+  80084b:	89 de                	mov    %ebx,%esi
+  80084d:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80084f:	85 c0                	test   %eax,%eax
+  800851:	7f 08                	jg     80085b <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  800853:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800856:	5b                   	pop    %ebx
+  800857:	5e                   	pop    %esi
+  800858:	5f                   	pop    %edi
+  800859:	5d                   	pop    %ebp
+  80085a:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80085b:	83 ec 0c             	sub    $0xc,%esp
+  80085e:	50                   	push   %eax
+  80085f:	6a 0a                	push   $0xa
+  800861:	68 0f 2f 80 00       	push   $0x802f0f
+  800866:	6a 23                	push   $0x23
+  800868:	68 2c 2f 80 00       	push   $0x802f2c
+  80086d:	e8 09 1c 00 00       	call   80247b <_panic>
+
+00800872 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  800872:	55                   	push   %ebp
+  800873:	89 e5                	mov    %esp,%ebp
+  800875:	57                   	push   %edi
+  800876:	56                   	push   %esi
+  800877:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800878:	8b 55 08             	mov    0x8(%ebp),%edx
+  80087b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80087e:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800883:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800886:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800889:	8b 75 18             	mov    0x18(%ebp),%esi
+  80088c:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  80088e:	5b                   	pop    %ebx
+  80088f:	5e                   	pop    %esi
+  800890:	5f                   	pop    %edi
+  800891:	5d                   	pop    %ebp
+  800892:	c3                   	ret
+
+00800893 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  800893:	55                   	push   %ebp
+  800894:	89 e5                	mov    %esp,%ebp
+  800896:	57                   	push   %edi
+  800897:	56                   	push   %esi
+  800898:	53                   	push   %ebx
+  800899:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80089c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8008a1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8008a4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008a7:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8008ac:	89 df                	mov    %ebx,%edi
+  8008ae:	89 de                	mov    %ebx,%esi
+  8008b0:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8008b2:	85 c0                	test   %eax,%eax
+  8008b4:	7f 08                	jg     8008be <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  8008b6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8008b9:	5b                   	pop    %ebx
+  8008ba:	5e                   	pop    %esi
+  8008bb:	5f                   	pop    %edi
+  8008bc:	5d                   	pop    %ebp
+  8008bd:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8008be:	83 ec 0c             	sub    $0xc,%esp
+  8008c1:	50                   	push   %eax
+  8008c2:	6a 0d                	push   $0xd
+  8008c4:	68 0f 2f 80 00       	push   $0x802f0f
+  8008c9:	6a 23                	push   $0x23
+  8008cb:	68 2c 2f 80 00       	push   $0x802f2c
+  8008d0:	e8 a6 1b 00 00       	call   80247b <_panic>
+
+008008d5 <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  8008d5:	55                   	push   %ebp
+  8008d6:	89 e5                	mov    %esp,%ebp
+  8008d8:	57                   	push   %edi
+  8008d9:	56                   	push   %esi
+  8008da:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8008db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008e0:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8008e5:	89 d1                	mov    %edx,%ecx
+  8008e7:	89 d3                	mov    %edx,%ebx
+  8008e9:	89 d7                	mov    %edx,%edi
+  8008eb:	89 d6                	mov    %edx,%esi
+  8008ed:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8008ef:	5b                   	pop    %ebx
+  8008f0:	5e                   	pop    %esi
+  8008f1:	5f                   	pop    %edi
+  8008f2:	5d                   	pop    %ebp
+  8008f3:	c3                   	ret
+
+008008f4 <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  8008f4:	55                   	push   %ebp
+  8008f5:	89 e5                	mov    %esp,%ebp
+  8008f7:	57                   	push   %edi
+  8008f8:	56                   	push   %esi
+  8008f9:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8008fa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8008fd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800900:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800905:	be 00 00 00 00       	mov    $0x0,%esi
+  80090a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80090d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800910:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  800912:	5b                   	pop    %ebx
+  800913:	5e                   	pop    %esi
+  800914:	5f                   	pop    %edi
+  800915:	5d                   	pop    %ebp
+  800916:	c3                   	ret
+
+00800917 <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  800917:	55                   	push   %ebp
+  800918:	89 e5                	mov    %esp,%ebp
+  80091a:	57                   	push   %edi
+  80091b:	56                   	push   %esi
+  80091c:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80091d:	be 00 00 00 00       	mov    $0x0,%esi
+  800922:	8b 55 08             	mov    0x8(%ebp),%edx
+  800925:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800928:	b8 10 00 00 00       	mov    $0x10,%eax
+  80092d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800930:	89 f7                	mov    %esi,%edi
+  800932:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  800934:	5b                   	pop    %ebx
+  800935:	5e                   	pop    %esi
+  800936:	5f                   	pop    %edi
+  800937:	5d                   	pop    %ebp
+  800938:	c3                   	ret
+
+00800939 <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  800939:	55                   	push   %ebp
+  80093a:	89 e5                	mov    %esp,%ebp
+  80093c:	57                   	push   %edi
+  80093d:	56                   	push   %esi
+  80093e:	53                   	push   %ebx
+  80093f:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  800942:	80 3d 48 57 80 00 00 	cmpb   $0x0,0x805748
+  800949:	74 41                	je     80098c <sys_batch+0x53>
+  80094b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80094e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  800951:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  800958:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80095b:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  80095e:	7d 45                	jge    8009a5 <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  800960:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800963:	8b 06                	mov    (%esi),%eax
+  800965:	8b 56 04             	mov    0x4(%esi),%edx
+  800968:	8b 4e 08             	mov    0x8(%esi),%ecx
+  80096b:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  80096e:	8b 7e 10             	mov    0x10(%esi),%edi
+  800971:	8b 76 14             	mov    0x14(%esi),%esi
+  800974:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  800976:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800979:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  80097c:	83 c6 1c             	add    $0x1c,%esi
+  80097f:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  800982:	85 c0                	test   %eax,%eax
+  800984:	78 1f                	js     8009a5 <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  800986:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  80098a:	eb cc                	jmp    800958 <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  80098c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800991:	b8 13 00 00 00       	mov    $0x13,%eax
+  800996:	8b 55 08             	mov    0x8(%ebp),%edx
+  800999:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80099c:	89 df                	mov    %ebx,%edi
+  80099e:	89 de                	mov    %ebx,%esi
+  8009a0:	cd 30                	int    $0x30
+  8009a2:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  8009a5:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8009a8:	83 c4 08             	add    $0x8,%esp
+  8009ab:	5b                   	pop    %ebx
+  8009ac:	5e                   	pop    %esi
+  8009ad:	5f                   	pop    %edi
+  8009ae:	5d                   	pop    %ebp
+  8009af:	c3                   	ret
+
+008009b0 <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  8009b0:	55                   	push   %ebp
+  8009b1:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  8009b3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009b6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8009bc:	5d                   	pop    %ebp
+  8009bd:	c3                   	ret
+
+008009be <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  8009be:	55                   	push   %ebp
+  8009bf:	89 e5                	mov    %esp,%ebp
+  8009c1:	56                   	push   %esi
+  8009c2:	53                   	push   %ebx
+  8009c3:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  8009c6:	8b 1e                	mov    (%esi),%ebx
+  8009c8:	85 db                	test   %ebx,%ebx
+  8009ca:	75 09                	jne    8009d5 <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  8009cc:	89 d8                	mov    %ebx,%eax
+  8009ce:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8009d1:	5b                   	pop    %ebx
+  8009d2:	5e                   	pop    %esi
+  8009d3:	5d                   	pop    %ebp
+  8009d4:	c3                   	ret
+  b->sb_n = 0;
+  8009d5:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  8009db:	53                   	push   %ebx
+  8009dc:	8d 46 04             	lea    0x4(%esi),%eax
+  8009df:	50                   	push   %eax
+  8009e0:	e8 54 ff ff ff       	call   800939 <sys_batch>
+  8009e5:	83 c4 08             	add    $0x8,%esp
+  8009e8:	85 c0                	test   %eax,%eax
+  8009ea:	78 1e                	js     800a0a <sysbatch_flush+0x4c>
+  if (r < n)
+  8009ec:	39 c3                	cmp    %eax,%ebx
+  8009ee:	7f 07                	jg     8009f7 <sysbatch_flush+0x39>
+  return 0;
+  8009f0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8009f5:	eb d5                	jmp    8009cc <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  8009f7:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8009fa:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  8009fe:	85 db                	test   %ebx,%ebx
+  800a00:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a05:	0f 49 d8             	cmovns %eax,%ebx
+  800a08:	eb c2                	jmp    8009cc <sysbatch_flush+0xe>
+    return r;
+  800a0a:	89 c3                	mov    %eax,%ebx
+  800a0c:	eb be                	jmp    8009cc <sysbatch_flush+0xe>
+
+00800a0e <sysbatch_add>:
+{
+  800a0e:	55                   	push   %ebp
+  800a0f:	89 e5                	mov    %esp,%ebp
+  800a11:	53                   	push   %ebx
+  800a12:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  800a15:	83 3b 40             	cmpl   $0x40,(%ebx)
+  800a18:	74 41                	je     800a5b <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  800a1a:	8b 03                	mov    (%ebx),%eax
+  800a1c:	8d 50 01             	lea    0x1(%eax),%edx
+  800a1f:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  800a21:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  800a24:	01 d8                	add    %ebx,%eax
+  800a26:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a29:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  800a2c:	8b 55 10             	mov    0x10(%ebp),%edx
+  800a2f:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  800a32:	8b 55 14             	mov    0x14(%ebp),%edx
+  800a35:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  800a38:	8b 55 18             	mov    0x18(%ebp),%edx
+  800a3b:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  800a3e:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  800a41:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  800a44:	8b 55 20             	mov    0x20(%ebp),%edx
+  800a47:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  800a4a:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  800a51:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a56:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a59:	c9                   	leave
+  800a5a:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  800a5b:	53                   	push   %ebx
+  800a5c:	e8 5d ff ff ff       	call   8009be <sysbatch_flush>
+  800a61:	83 c4 04             	add    $0x4,%esp
+  800a64:	85 c0                	test   %eax,%eax
+  800a66:	79 b2                	jns    800a1a <sysbatch_add+0xc>
+  800a68:	eb ec                	jmp    800a56 <sysbatch_add+0x48>
+
+00800a6a <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800a6a:	55                   	push   %ebp
+  800a6b:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  800a6d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a70:	05 00 00 00 30       	add    $0x30000000,%eax
+  800a75:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800a78:	5d                   	pop    %ebp
+  800a79:	c3                   	ret
+
+00800a7a <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800a7a:	55                   	push   %ebp
+  800a7b:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  800a7d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a80:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  800a83:	66 b8 00 00          	mov    $0x0,%ax
+  800a87:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  800a8c:	5d                   	pop    %ebp
+  800a8d:	c3                   	ret
+
+00800a8e <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800a8e:	55                   	push   %ebp
+  800a8f:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  800a91:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  800a96:	eb 02                	jmp    800a9a <fd_alloc+0xc>
+  800a98:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800a9a:	89 c2                	mov    %eax,%edx
+  800a9c:	c1 ea 16             	shr    $0x16,%edx
+  800a9f:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800aa6:	f6 c2 01             	test   $0x1,%dl
+  800aa9:	74 2b                	je     800ad6 <fd_alloc+0x48>
+  800aab:	89 c2                	mov    %eax,%edx
+  800aad:	c1 ea 0c             	shr    $0xc,%edx
+  800ab0:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  800ab7:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  800abd:	f6 c1 01             	test   $0x1,%cl
+  800ac0:	74 14                	je     800ad6 <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  800ac2:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  800ac8:	75 ce                	jne    800a98 <fd_alloc+0xa>
+  800aca:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  800acf:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  800ad4:	eb 05                	jmp    800adb <fd_alloc+0x4d>
+      return 0;
+  800ad6:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  800adb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ade:	89 02                	mov    %eax,(%edx)
+}
+  800ae0:	89 c8                	mov    %ecx,%eax
+  800ae2:	5d                   	pop    %ebp
+  800ae3:	c3                   	ret
+
+00800ae4 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  800ae4:	55                   	push   %ebp
+  800ae5:	89 e5                	mov    %esp,%ebp
+  800ae7:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  800aea:	83 f8 1f             	cmp    $0x1f,%eax
+  800aed:	77 30                	ja     800b1f <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  800aef:	c1 e0 0c             	shl    $0xc,%eax
+  800af2:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  800af7:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  800afd:	f6 c2 01             	test   $0x1,%dl
+  800b00:	74 24                	je     800b26 <fd_lookup+0x42>
+  800b02:	89 c2                	mov    %eax,%edx
+  800b04:	c1 ea 0c             	shr    $0xc,%edx
+  800b07:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800b0e:	f6 c2 01             	test   $0x1,%dl
+  800b11:	74 1a                	je     800b2d <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  800b13:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b16:	89 02                	mov    %eax,(%edx)
+  return 0;
+  800b18:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b1d:	5d                   	pop    %ebp
+  800b1e:	c3                   	ret
+    return -E_INVAL;
+  800b1f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b24:	eb f7                	jmp    800b1d <fd_lookup+0x39>
+    return -E_INVAL;
+  800b26:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b2b:	eb f0                	jmp    800b1d <fd_lookup+0x39>
+  800b2d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b32:	eb e9                	jmp    800b1d <fd_lookup+0x39>
+
+00800b34 <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  800b34:	55                   	push   %ebp
+  800b35:	89 e5                	mov    %esp,%ebp
+  800b37:	53                   	push   %ebx
+  800b38:	83 ec 04             	sub    $0x4,%esp
+  800b3b:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  800b3e:	b8 b8 2f 80 00       	mov    $0x802fb8,%eax
+  800b43:	8b 18                	mov    (%eax),%ebx
+  800b45:	85 db                	test   %ebx,%ebx
+  800b47:	74 0e                	je     800b57 <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  800b49:	83 c0 04             	add    $0x4,%eax
+  800b4c:	39 13                	cmp    %edx,(%ebx)
+  800b4e:	75 f3                	jne    800b43 <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  800b50:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b55:	eb 1f                	jmp    800b76 <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800b57:	a1 44 57 80 00       	mov    0x805744,%eax
+  800b5c:	8b 40 48             	mov    0x48(%eax),%eax
+  800b5f:	83 ec 04             	sub    $0x4,%esp
+  800b62:	52                   	push   %edx
+  800b63:	50                   	push   %eax
+  800b64:	68 3c 2f 80 00       	push   $0x802f3c
+  800b69:	e8 e8 19 00 00       	call   802556 <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  800b6e:	83 c4 10             	add    $0x10,%esp
+  800b71:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  800b76:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b79:	89 1a                	mov    %ebx,(%edx)
+}
+  800b7b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b7e:	c9                   	leave
+  800b7f:	c3                   	ret
+
+00800b80 <fd_close>:
+{
+  800b80:	55                   	push   %ebp
+  800b81:	89 e5                	mov    %esp,%ebp
+  800b83:	57                   	push   %edi
+  800b84:	56                   	push   %esi
+  800b85:	53                   	push   %ebx
+  800b86:	83 ec 24             	sub    $0x24,%esp
+  800b89:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b8c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800b8f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800b92:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  800b93:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800b99:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800b9c:	50                   	push   %eax
+  800b9d:	e8 42 ff ff ff       	call   800ae4 <fd_lookup>
+  800ba2:	89 c3                	mov    %eax,%ebx
+  800ba4:	83 c4 10             	add    $0x10,%esp
+  800ba7:	85 c0                	test   %eax,%eax
+  800ba9:	78 05                	js     800bb0 <fd_close+0x30>
+      || fd != fd2)
+  800bab:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  800bae:	74 16                	je     800bc6 <fd_close+0x46>
+    return must_exist ? r : 0;
+  800bb0:	89 f8                	mov    %edi,%eax
+  800bb2:	84 c0                	test   %al,%al
+  800bb4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bb9:	0f 44 d8             	cmove  %eax,%ebx
+}
+  800bbc:	89 d8                	mov    %ebx,%eax
+  800bbe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bc1:	5b                   	pop    %ebx
+  800bc2:	5e                   	pop    %esi
+  800bc3:	5f                   	pop    %edi
+  800bc4:	5d                   	pop    %ebp
+  800bc5:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800bc6:	83 ec 08             	sub    $0x8,%esp
+  800bc9:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800bcc:	50                   	push   %eax
+  800bcd:	ff 36                	push   (%esi)
+  800bcf:	e8 60 ff ff ff       	call   800b34 <dev_lookup>
+  800bd4:	89 c3                	mov    %eax,%ebx
+  800bd6:	83 c4 10             	add    $0x10,%esp
+  800bd9:	85 c0                	test   %eax,%eax
+  800bdb:	78 1a                	js     800bf7 <fd_close+0x77>
+    if (dev->dev_close)
+  800bdd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800be0:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  800be3:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  800be8:	85 c0                	test   %eax,%eax
+  800bea:	74 0b                	je     800bf7 <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  800bec:	83 ec 0c             	sub    $0xc,%esp
+  800bef:	56                   	push   %esi
+  800bf0:	ff d0                	call   *%eax
+  800bf2:	89 c3                	mov    %eax,%ebx
+  800bf4:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  800bf7:	83 ec 08             	sub    $0x8,%esp
+  800bfa:	56                   	push   %esi
+  800bfb:	6a 00                	push   $0x0
+  800bfd:	e8 3e fa ff ff       	call   800640 <sys_page_unmap>
+  return r;
+  800c02:	83 c4 10             	add    $0x10,%esp
+  800c05:	eb b5                	jmp    800bbc <fd_close+0x3c>
+
+00800c07 <close>:
+
+int
+close(int fdnum)
+{
+  800c07:	55                   	push   %ebp
+  800c08:	89 e5                	mov    %esp,%ebp
+  800c0a:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800c0d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800c10:	50                   	push   %eax
+  800c11:	ff 75 08             	push   0x8(%ebp)
+  800c14:	e8 cb fe ff ff       	call   800ae4 <fd_lookup>
+  800c19:	83 c4 10             	add    $0x10,%esp
+  800c1c:	85 c0                	test   %eax,%eax
+  800c1e:	79 02                	jns    800c22 <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  800c20:	c9                   	leave
+  800c21:	c3                   	ret
+    return fd_close(fd, 1);
+  800c22:	83 ec 08             	sub    $0x8,%esp
+  800c25:	6a 01                	push   $0x1
+  800c27:	ff 75 f4             	push   -0xc(%ebp)
+  800c2a:	e8 51 ff ff ff       	call   800b80 <fd_close>
+  800c2f:	83 c4 10             	add    $0x10,%esp
+  800c32:	eb ec                	jmp    800c20 <close+0x19>
+
+00800c34 <close_all>:
+
+void
+close_all(void)
+{
+  800c34:	55                   	push   %ebp
+  800c35:	89 e5                	mov    %esp,%ebp
+  800c37:	53                   	push   %ebx
+  800c38:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  800c3b:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  800c40:	83 ec 0c             	sub    $0xc,%esp
+  800c43:	53                   	push   %ebx
+  800c44:	e8 be ff ff ff       	call   800c07 <close>
+  for (i = 0; i < MAXFD; i++)
+  800c49:	83 c3 01             	add    $0x1,%ebx
+  800c4c:	83 c4 10             	add    $0x10,%esp
+  800c4f:	83 fb 20             	cmp    $0x20,%ebx
+  800c52:	75 ec                	jne    800c40 <close_all+0xc>
+}
+  800c54:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c57:	c9                   	leave
+  800c58:	c3                   	ret
+
+00800c59 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  800c59:	55                   	push   %ebp
+  800c5a:	89 e5                	mov    %esp,%ebp
+  800c5c:	57                   	push   %edi
+  800c5d:	56                   	push   %esi
+  800c5e:	53                   	push   %ebx
+  800c5f:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  800c62:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800c65:	50                   	push   %eax
+  800c66:	ff 75 08             	push   0x8(%ebp)
+  800c69:	e8 76 fe ff ff       	call   800ae4 <fd_lookup>
+  800c6e:	89 c6                	mov    %eax,%esi
+  800c70:	83 c4 10             	add    $0x10,%esp
+  800c73:	85 c0                	test   %eax,%eax
+  800c75:	0f 88 0a 01 00 00    	js     800d85 <dup+0x12c>
+    return r;
+  close(newfdnum);
+  800c7b:	83 ec 0c             	sub    $0xc,%esp
+  800c7e:	ff 75 0c             	push   0xc(%ebp)
+  800c81:	e8 81 ff ff ff       	call   800c07 <close>
+
+  newfd = INDEX2FD(newfdnum);
+  800c86:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c89:	c1 e0 0c             	shl    $0xc,%eax
+  800c8c:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  800c92:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  800c95:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800c98:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800c9b:	89 04 24             	mov    %eax,(%esp)
+  800c9e:	e8 d7 fd ff ff       	call   800a7a <fd2data>
+  800ca3:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  800ca5:	89 3c 24             	mov    %edi,(%esp)
+  800ca8:	e8 cd fd ff ff       	call   800a7a <fd2data>
+  800cad:	83 c4 10             	add    $0x10,%esp
+  800cb0:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  800cb3:	89 f3                	mov    %esi,%ebx
+  800cb5:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  800cbb:	89 c6                	mov    %eax,%esi
+  800cbd:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800cc0:	89 cf                	mov    %ecx,%edi
+  800cc2:	eb 0c                	jmp    800cd0 <dup+0x77>
+  800cc4:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  800cca:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  800cd0:	39 fb                	cmp    %edi,%ebx
+  800cd2:	74 7b                	je     800d4f <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  800cd4:	89 d8                	mov    %ebx,%eax
+  800cd6:	c1 e8 16             	shr    $0x16,%eax
+  800cd9:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  800ce0:	a8 01                	test   $0x1,%al
+  800ce2:	74 e0                	je     800cc4 <dup+0x6b>
+  800ce4:	89 d8                	mov    %ebx,%eax
+  800ce6:	c1 e8 0c             	shr    $0xc,%eax
+  800ce9:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  800cf0:	f6 c2 01             	test   $0x1,%dl
+  800cf3:	74 cf                	je     800cc4 <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  800cf5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  800cfc:	83 ec 0c             	sub    $0xc,%esp
+  800cff:	25 07 0e 00 00       	and    $0xe07,%eax
+  800d04:	50                   	push   %eax
+  800d05:	56                   	push   %esi
+  800d06:	6a 00                	push   $0x0
+  800d08:	53                   	push   %ebx
+  800d09:	6a 00                	push   $0x0
+  800d0b:	e8 ee f8 ff ff       	call   8005fe <sys_page_map>
+  800d10:	83 c4 20             	add    $0x20,%esp
+  800d13:	85 c0                	test   %eax,%eax
+  800d15:	79 ad                	jns    800cc4 <dup+0x6b>
+  800d17:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800d1a:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  800d1c:	83 ec 08             	sub    $0x8,%esp
+  800d1f:	ff 75 d4             	push   -0x2c(%ebp)
+  800d22:	6a 00                	push   $0x0
+  800d24:	e8 17 f9 ff ff       	call   800640 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  800d29:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  800d2c:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  800d32:	83 c4 10             	add    $0x10,%esp
+  800d35:	39 df                	cmp    %ebx,%edi
+  800d37:	74 4c                	je     800d85 <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  800d39:	83 ec 08             	sub    $0x8,%esp
+  800d3c:	57                   	push   %edi
+  800d3d:	6a 00                	push   $0x0
+  800d3f:	e8 fc f8 ff ff       	call   800640 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  800d44:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  800d4a:	83 c4 10             	add    $0x10,%esp
+  800d4d:	eb e6                	jmp    800d35 <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  800d4f:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800d52:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800d55:	89 c8                	mov    %ecx,%eax
+  800d57:	c1 e8 0c             	shr    $0xc,%eax
+  800d5a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800d61:	83 ec 0c             	sub    $0xc,%esp
+  800d64:	25 07 0e 00 00       	and    $0xe07,%eax
+  800d69:	50                   	push   %eax
+  800d6a:	ff 75 d4             	push   -0x2c(%ebp)
+  800d6d:	6a 00                	push   $0x0
+  800d6f:	51                   	push   %ecx
+  800d70:	6a 00                	push   $0x0
+  800d72:	e8 87 f8 ff ff       	call   8005fe <sys_page_map>
+  800d77:	89 c6                	mov    %eax,%esi
+  800d79:	83 c4 20             	add    $0x20,%esp
+  800d7c:	85 c0                	test   %eax,%eax
+  800d7e:	78 9c                	js     800d1c <dup+0xc3>
+  return newfdnum;
+  800d80:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d83:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  800d85:	89 f0                	mov    %esi,%eax
+  800d87:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d8a:	5b                   	pop    %ebx
+  800d8b:	5e                   	pop    %esi
+  800d8c:	5f                   	pop    %edi
+  800d8d:	5d                   	pop    %ebp
+  800d8e:	c3                   	ret
+
+00800d8f <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  800d8f:	55                   	push   %ebp
+  800d90:	89 e5                	mov    %esp,%ebp
+  800d92:	56                   	push   %esi
+  800d93:	53                   	push   %ebx
+  800d94:	83 ec 18             	sub    $0x18,%esp
+  800d97:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  800d9a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800d9d:	50                   	push   %eax
+  800d9e:	56                   	push   %esi
+  800d9f:	e8 40 fd ff ff       	call   800ae4 <fd_lookup>
+  800da4:	83 c4 10             	add    $0x10,%esp
+  800da7:	85 c0                	test   %eax,%eax
+  800da9:	78 3c                	js     800de7 <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800dab:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  800dae:	83 ec 08             	sub    $0x8,%esp
+  800db1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800db4:	50                   	push   %eax
+  800db5:	ff 33                	push   (%ebx)
+  800db7:	e8 78 fd ff ff       	call   800b34 <dev_lookup>
+  800dbc:	83 c4 10             	add    $0x10,%esp
+  800dbf:	85 c0                	test   %eax,%eax
+  800dc1:	78 24                	js     800de7 <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800dc3:	8b 43 08             	mov    0x8(%ebx),%eax
+  800dc6:	83 e0 03             	and    $0x3,%eax
+  800dc9:	83 f8 01             	cmp    $0x1,%eax
+  800dcc:	74 20                	je     800dee <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  800dce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800dd1:	8b 40 08             	mov    0x8(%eax),%eax
+  800dd4:	85 c0                	test   %eax,%eax
+  800dd6:	74 37                	je     800e0f <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  800dd8:	83 ec 04             	sub    $0x4,%esp
+  800ddb:	ff 75 10             	push   0x10(%ebp)
+  800dde:	ff 75 0c             	push   0xc(%ebp)
+  800de1:	53                   	push   %ebx
+  800de2:	ff d0                	call   *%eax
+  800de4:	83 c4 10             	add    $0x10,%esp
+}
+  800de7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800dea:	5b                   	pop    %ebx
+  800deb:	5e                   	pop    %esi
+  800dec:	5d                   	pop    %ebp
+  800ded:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800dee:	a1 44 57 80 00       	mov    0x805744,%eax
+  800df3:	8b 40 48             	mov    0x48(%eax),%eax
+  800df6:	83 ec 04             	sub    $0x4,%esp
+  800df9:	56                   	push   %esi
+  800dfa:	50                   	push   %eax
+  800dfb:	68 7d 2f 80 00       	push   $0x802f7d
+  800e00:	e8 51 17 00 00       	call   802556 <cprintf>
+    return -E_INVAL;
+  800e05:	83 c4 10             	add    $0x10,%esp
+  800e08:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e0d:	eb d8                	jmp    800de7 <read+0x58>
+    return -E_NOT_SUPP;
+  800e0f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800e14:	eb d1                	jmp    800de7 <read+0x58>
+
+00800e16 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  800e16:	55                   	push   %ebp
+  800e17:	89 e5                	mov    %esp,%ebp
+  800e19:	57                   	push   %edi
+  800e1a:	56                   	push   %esi
+  800e1b:	53                   	push   %ebx
+  800e1c:	83 ec 0c             	sub    $0xc,%esp
+  800e1f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800e22:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  800e25:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e2a:	eb 02                	jmp    800e2e <readn+0x18>
+  800e2c:	01 c3                	add    %eax,%ebx
+  800e2e:	39 f3                	cmp    %esi,%ebx
+  800e30:	73 21                	jae    800e53 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  800e32:	83 ec 04             	sub    $0x4,%esp
+  800e35:	89 f0                	mov    %esi,%eax
+  800e37:	29 d8                	sub    %ebx,%eax
+  800e39:	50                   	push   %eax
+  800e3a:	89 d8                	mov    %ebx,%eax
+  800e3c:	03 45 0c             	add    0xc(%ebp),%eax
+  800e3f:	50                   	push   %eax
+  800e40:	57                   	push   %edi
+  800e41:	e8 49 ff ff ff       	call   800d8f <read>
+    if (m < 0)
+  800e46:	83 c4 10             	add    $0x10,%esp
+  800e49:	85 c0                	test   %eax,%eax
+  800e4b:	78 04                	js     800e51 <readn+0x3b>
+      return m;
+    if (m == 0)
+  800e4d:	75 dd                	jne    800e2c <readn+0x16>
+  800e4f:	eb 02                	jmp    800e53 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  800e51:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  800e53:	89 d8                	mov    %ebx,%eax
+  800e55:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e58:	5b                   	pop    %ebx
+  800e59:	5e                   	pop    %esi
+  800e5a:	5f                   	pop    %edi
+  800e5b:	5d                   	pop    %ebp
+  800e5c:	c3                   	ret
+
+00800e5d <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  800e5d:	55                   	push   %ebp
+  800e5e:	89 e5                	mov    %esp,%ebp
+  800e60:	56                   	push   %esi
+  800e61:	53                   	push   %ebx
+  800e62:	83 ec 18             	sub    $0x18,%esp
+  800e65:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  800e68:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800e6b:	50                   	push   %eax
+  800e6c:	53                   	push   %ebx
+  800e6d:	e8 72 fc ff ff       	call   800ae4 <fd_lookup>
+  800e72:	83 c4 10             	add    $0x10,%esp
+  800e75:	85 c0                	test   %eax,%eax
+  800e77:	78 37                	js     800eb0 <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800e79:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800e7c:	83 ec 08             	sub    $0x8,%esp
+  800e7f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800e82:	50                   	push   %eax
+  800e83:	ff 36                	push   (%esi)
+  800e85:	e8 aa fc ff ff       	call   800b34 <dev_lookup>
+  800e8a:	83 c4 10             	add    $0x10,%esp
+  800e8d:	85 c0                	test   %eax,%eax
+  800e8f:	78 1f                	js     800eb0 <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800e91:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800e95:	74 20                	je     800eb7 <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  800e97:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800e9a:	8b 40 0c             	mov    0xc(%eax),%eax
+  800e9d:	85 c0                	test   %eax,%eax
+  800e9f:	74 37                	je     800ed8 <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  800ea1:	83 ec 04             	sub    $0x4,%esp
+  800ea4:	ff 75 10             	push   0x10(%ebp)
+  800ea7:	ff 75 0c             	push   0xc(%ebp)
+  800eaa:	56                   	push   %esi
+  800eab:	ff d0                	call   *%eax
+  800ead:	83 c4 10             	add    $0x10,%esp
+}
+  800eb0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800eb3:	5b                   	pop    %ebx
+  800eb4:	5e                   	pop    %esi
+  800eb5:	5d                   	pop    %ebp
+  800eb6:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800eb7:	a1 44 57 80 00       	mov    0x805744,%eax
+  800ebc:	8b 40 48             	mov    0x48(%eax),%eax
+  800ebf:	83 ec 04             	sub    $0x4,%esp
+  800ec2:	53                   	push   %ebx
+  800ec3:	50                   	push   %eax
+  800ec4:	68 99 2f 80 00       	push   $0x802f99
+  800ec9:	e8 88 16 00 00       	call   802556 <cprintf>
+    return -E_INVAL;
+  800ece:	83 c4 10             	add    $0x10,%esp
+  800ed1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ed6:	eb d8                	jmp    800eb0 <write+0x53>
+    return -E_NOT_SUPP;
+  800ed8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800edd:	eb d1                	jmp    800eb0 <write+0x53>
+
+00800edf <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  800edf:	55                   	push   %ebp
+  800ee0:	89 e5                	mov    %esp,%ebp
+  800ee2:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800ee5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800ee8:	50                   	push   %eax
+  800ee9:	ff 75 08             	push   0x8(%ebp)
+  800eec:	e8 f3 fb ff ff       	call   800ae4 <fd_lookup>
+  800ef1:	83 c4 10             	add    $0x10,%esp
+  800ef4:	85 c0                	test   %eax,%eax
+  800ef6:	78 0e                	js     800f06 <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  800ef8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800efb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800efe:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  800f01:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f06:	c9                   	leave
+  800f07:	c3                   	ret
+
+00800f08 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800f08:	55                   	push   %ebp
+  800f09:	89 e5                	mov    %esp,%ebp
+  800f0b:	56                   	push   %esi
+  800f0c:	53                   	push   %ebx
+  800f0d:	83 ec 18             	sub    $0x18,%esp
+  800f10:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  800f13:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800f16:	50                   	push   %eax
+  800f17:	53                   	push   %ebx
+  800f18:	e8 c7 fb ff ff       	call   800ae4 <fd_lookup>
+  800f1d:	83 c4 10             	add    $0x10,%esp
+  800f20:	85 c0                	test   %eax,%eax
+  800f22:	78 34                	js     800f58 <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800f24:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800f27:	83 ec 08             	sub    $0x8,%esp
+  800f2a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800f2d:	50                   	push   %eax
+  800f2e:	ff 36                	push   (%esi)
+  800f30:	e8 ff fb ff ff       	call   800b34 <dev_lookup>
+  800f35:	83 c4 10             	add    $0x10,%esp
+  800f38:	85 c0                	test   %eax,%eax
+  800f3a:	78 1c                	js     800f58 <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800f3c:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800f40:	74 1d                	je     800f5f <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  800f42:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800f45:	8b 40 18             	mov    0x18(%eax),%eax
+  800f48:	85 c0                	test   %eax,%eax
+  800f4a:	74 34                	je     800f80 <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  800f4c:	83 ec 08             	sub    $0x8,%esp
+  800f4f:	ff 75 0c             	push   0xc(%ebp)
+  800f52:	56                   	push   %esi
+  800f53:	ff d0                	call   *%eax
+  800f55:	83 c4 10             	add    $0x10,%esp
+}
+  800f58:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f5b:	5b                   	pop    %ebx
+  800f5c:	5e                   	pop    %esi
+  800f5d:	5d                   	pop    %ebp
+  800f5e:	c3                   	ret
+            thisenv->env_id, fdnum);
+  800f5f:	a1 44 57 80 00       	mov    0x805744,%eax
+  800f64:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800f67:	83 ec 04             	sub    $0x4,%esp
+  800f6a:	53                   	push   %ebx
+  800f6b:	50                   	push   %eax
+  800f6c:	68 5c 2f 80 00       	push   $0x802f5c
+  800f71:	e8 e0 15 00 00       	call   802556 <cprintf>
+    return -E_INVAL;
+  800f76:	83 c4 10             	add    $0x10,%esp
+  800f79:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f7e:	eb d8                	jmp    800f58 <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  800f80:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800f85:	eb d1                	jmp    800f58 <ftruncate+0x50>
+
+00800f87 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800f87:	55                   	push   %ebp
+  800f88:	89 e5                	mov    %esp,%ebp
+  800f8a:	56                   	push   %esi
+  800f8b:	53                   	push   %ebx
+  800f8c:	83 ec 18             	sub    $0x18,%esp
+  800f8f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  800f92:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800f95:	50                   	push   %eax
+  800f96:	ff 75 08             	push   0x8(%ebp)
+  800f99:	e8 46 fb ff ff       	call   800ae4 <fd_lookup>
+  800f9e:	83 c4 10             	add    $0x10,%esp
+  800fa1:	85 c0                	test   %eax,%eax
+  800fa3:	78 49                	js     800fee <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800fa5:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800fa8:	83 ec 08             	sub    $0x8,%esp
+  800fab:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800fae:	50                   	push   %eax
+  800faf:	ff 36                	push   (%esi)
+  800fb1:	e8 7e fb ff ff       	call   800b34 <dev_lookup>
+  800fb6:	83 c4 10             	add    $0x10,%esp
+  800fb9:	85 c0                	test   %eax,%eax
+  800fbb:	78 31                	js     800fee <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  800fbd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800fc0:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800fc4:	74 2f                	je     800ff5 <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  800fc6:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  800fc9:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800fd0:	00 00 00 
+  stat->st_isdir = 0;
+  800fd3:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800fda:	00 00 00 
+  stat->st_dev = dev;
+  800fdd:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  800fe3:	83 ec 08             	sub    $0x8,%esp
+  800fe6:	53                   	push   %ebx
+  800fe7:	56                   	push   %esi
+  800fe8:	ff 50 14             	call   *0x14(%eax)
+  800feb:	83 c4 10             	add    $0x10,%esp
+}
+  800fee:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ff1:	5b                   	pop    %ebx
+  800ff2:	5e                   	pop    %esi
+  800ff3:	5d                   	pop    %ebp
+  800ff4:	c3                   	ret
+    return -E_NOT_SUPP;
+  800ff5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800ffa:	eb f2                	jmp    800fee <fstat+0x67>
+
+00800ffc <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  800ffc:	55                   	push   %ebp
+  800ffd:	89 e5                	mov    %esp,%ebp
+  800fff:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  801002:	ff 75 0c             	push   0xc(%ebp)
+  801005:	ff 75 08             	push   0x8(%ebp)
+  801008:	e8 58 07 00 00       	call   801765 <file_stat>
+}
+  80100d:	c9                   	leave
+  80100e:	c3                   	ret
+
+0080100f <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  80100f:	55                   	push   %ebp
+  801010:	89 e5                	mov    %esp,%ebp
+  801012:	57                   	push   %edi
+  801013:	56                   	push   %esi
+  801014:	53                   	push   %ebx
+  801015:	83 ec 1c             	sub    $0x1c,%esp
+  801018:	89 c7                	mov    %eax,%edi
+  80101a:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  80101d:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801020:	e9 a2 00 00 00       	jmp    8010c7 <fsipc_send+0xb8>
+  nfsenvs = 0;
+  801025:	c7 05 00 50 80 00 00 	movl   $0x0,0x805000
+  80102c:	00 00 00 
+  80102f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801034:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801039:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  80103e:	be 01 00 00 00       	mov    $0x1,%esi
+  801043:	eb 0f                	jmp    801054 <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801045:	83 c0 01             	add    $0x1,%eax
+  801048:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80104d:	74 49                	je     801098 <fsipc_send+0x89>
+  80104f:	83 f9 07             	cmp    $0x7,%ecx
+  801052:	7f 50                	jg     8010a4 <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  801054:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801057:	c1 e2 04             	shl    $0x4,%edx
+  80105a:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801060:	8b 52 50             	mov    0x50(%edx),%edx
+  801063:	83 fa 01             	cmp    $0x1,%edx
+  801066:	75 dd                	jne    801045 <fsipc_send+0x36>
+  801068:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  80106b:	c1 e2 04             	shl    $0x4,%edx
+  80106e:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801074:	8b 52 54             	mov    0x54(%edx),%edx
+  801077:	85 d2                	test   %edx,%edx
+  801079:	74 ca                	je     801045 <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  80107b:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  80107e:	c1 e2 04             	shl    $0x4,%edx
+  801081:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801087:	8b 52 48             	mov    0x48(%edx),%edx
+  80108a:	89 14 8d 20 50 80 00 	mov    %edx,0x805020(,%ecx,4)
+  801091:	8d 49 01             	lea    0x1(%ecx),%ecx
+  801094:	89 f3                	mov    %esi,%ebx
+  801096:	eb ad                	jmp    801045 <fsipc_send+0x36>
+  801098:	84 db                	test   %bl,%bl
+  80109a:	74 38                	je     8010d4 <fsipc_send+0xc5>
+  80109c:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  8010a2:	eb 30                	jmp    8010d4 <fsipc_send+0xc5>
+  8010a4:	84 db                	test   %bl,%bl
+  8010a6:	74 2c                	je     8010d4 <fsipc_send+0xc5>
+  8010a8:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  8010ae:	eb 24                	jmp    8010d4 <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  8010b0:	50                   	push   %eax
+  8010b1:	68 c8 2f 80 00       	push   $0x802fc8
+  8010b6:	6a 34                	push   $0x34
+  8010b8:	68 d2 2f 80 00       	push   $0x802fd2
+  8010bd:	e8 b9 13 00 00       	call   80247b <_panic>
+    }
+    sys_yield();
+  8010c2:	e8 92 f4 ff ff       	call   800559 <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  8010c7:	83 3d 00 50 80 00 03 	cmpl   $0x3,0x805000
+  8010ce:	0f 8e 51 ff ff ff    	jle    801025 <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  8010d4:	a1 44 57 80 00       	mov    0x805744,%eax
+  8010d9:	8b 70 48             	mov    0x48(%eax),%esi
+  8010dc:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  8010e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010e7:	8b 0d 00 50 80 00    	mov    0x805000,%ecx
+  8010ed:	39 d9                	cmp    %ebx,%ecx
+  8010ef:	7e d1                	jle    8010c2 <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  8010f1:	83 ec 0c             	sub    $0xc,%esp
+  8010f4:	ff 75 e0             	push   -0x20(%ebp)
+  8010f7:	6a 07                	push   $0x7
+  8010f9:	ff 75 e4             	push   -0x1c(%ebp)
+  8010fc:	57                   	push   %edi
+  8010fd:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  801100:	99                   	cltd
+  801101:	f7 f9                	idiv   %ecx
+  801103:	ff 34 95 20 50 80 00 	push   0x805020(,%edx,4)
+  80110a:	e8 63 f7 ff ff       	call   800872 <sys_ipc_try_send>
+      if (r == 0)
+  80110f:	83 c4 20             	add    $0x20,%esp
+  801112:	85 c0                	test   %eax,%eax
+  801114:	74 0a                	je     801120 <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  801116:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801119:	75 95                	jne    8010b0 <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  80111b:	83 c3 01             	add    $0x1,%ebx
+  80111e:	eb c7                	jmp    8010e7 <fsipc_send+0xd8>
+  }
+}
+  801120:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801123:	5b                   	pop    %ebx
+  801124:	5e                   	pop    %esi
+  801125:	5f                   	pop    %edi
+  801126:	5d                   	pop    %ebp
+  801127:	c3                   	ret
+
+00801128 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801128:	55                   	push   %ebp
+  801129:	89 e5                	mov    %esp,%ebp
+  80112b:	53                   	push   %ebx
+  80112c:	83 ec 14             	sub    $0x14,%esp
+  80112f:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  801131:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  801138:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80113d:	ba 00 60 80 00       	mov    $0x806000,%edx
+  801142:	e8 c8 fe ff ff       	call   80100f <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801147:	6a 00                	push   $0x0
+  801149:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80114c:	50                   	push   %eax
+  80114d:	53                   	push   %ebx
+  80114e:	6a 00                	push   $0x0
+  801150:	e8 b4 19 00 00       	call   802b09 <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  801155:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801158:	c9                   	leave
+  801159:	c3                   	ret
+
+0080115a <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  80115a:	55                   	push   %ebp
+  80115b:	89 e5                	mov    %esp,%ebp
+  80115d:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801160:	8b 45 08             	mov    0x8(%ebp),%eax
+  801163:	8b 40 0c             	mov    0xc(%eax),%eax
+  801166:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.set_size.req_size = newsize;
+  80116b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80116e:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801173:	ba 00 00 00 00       	mov    $0x0,%edx
+  801178:	b8 02 00 00 00       	mov    $0x2,%eax
+  80117d:	e8 a6 ff ff ff       	call   801128 <fsipc>
+}
+  801182:	c9                   	leave
+  801183:	c3                   	ret
+
+00801184 <devfile_flush>:
+{
+  801184:	55                   	push   %ebp
+  801185:	89 e5                	mov    %esp,%ebp
+  801187:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80118a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80118d:	8b 40 0c             	mov    0xc(%eax),%eax
+  801190:	a3 00 60 80 00       	mov    %eax,0x806000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801195:	ba 00 00 00 00       	mov    $0x0,%edx
+  80119a:	b8 06 00 00 00       	mov    $0x6,%eax
+  80119f:	e8 84 ff ff ff       	call   801128 <fsipc>
+}
+  8011a4:	c9                   	leave
+  8011a5:	c3                   	ret
+
+008011a6 <devfile_stat>:
+{
+  8011a6:	55                   	push   %ebp
+  8011a7:	89 e5                	mov    %esp,%ebp
+  8011a9:	53                   	push   %ebx
+  8011aa:	83 ec 04             	sub    $0x4,%esp
+  8011ad:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8011b0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011b3:	8b 40 0c             	mov    0xc(%eax),%eax
+  8011b6:	a3 00 60 80 00       	mov    %eax,0x806000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8011bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011c0:	b8 05 00 00 00       	mov    $0x5,%eax
+  8011c5:	e8 5e ff ff ff       	call   801128 <fsipc>
+  8011ca:	85 c0                	test   %eax,%eax
+  8011cc:	78 2c                	js     8011fa <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8011ce:	83 ec 08             	sub    $0x8,%esp
+  8011d1:	68 00 60 80 00       	push   $0x806000
+  8011d6:	53                   	push   %ebx
+  8011d7:	e8 b0 ef ff ff       	call   80018c <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  8011dc:	a1 80 60 80 00       	mov    0x806080,%eax
+  8011e1:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8011e7:	a1 84 60 80 00       	mov    0x806084,%eax
+  8011ec:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  8011f2:	83 c4 10             	add    $0x10,%esp
+  8011f5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011fa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8011fd:	c9                   	leave
+  8011fe:	c3                   	ret
+
+008011ff <fsv_alloc>:
+{
+  8011ff:	55                   	push   %ebp
+  801200:	89 e5                	mov    %esp,%ebp
+  801202:	56                   	push   %esi
+  801203:	53                   	push   %ebx
+  801204:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  801206:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80120b:	eb 22                	jmp    80122f <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  80120d:	83 ec 04             	sub    $0x4,%esp
+  801210:	6a 00                	push   $0x0
+  801212:	6a 00                	push   $0x0
+  801214:	6a 07                	push   $0x7
+  801216:	50                   	push   %eax
+  801217:	6a 00                	push   $0x0
+  801219:	6a 04                	push   $0x4
+  80121b:	68 40 50 80 00       	push   $0x805040
+  801220:	e8 e9 f7 ff ff       	call   800a0e <sysbatch_add>
+  801225:	83 c4 20             	add    $0x20,%esp
+  801228:	85 c0                	test   %eax,%eax
+  80122a:	78 48                	js     801274 <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  80122c:	83 c3 01             	add    $0x1,%ebx
+  80122f:	39 f3                	cmp    %esi,%ebx
+  801231:	74 31                	je     801264 <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  801233:	89 d8                	mov    %ebx,%eax
+  801235:	c1 e0 0c             	shl    $0xc,%eax
+  801238:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  80123d:	89 c2                	mov    %eax,%edx
+  80123f:	c1 ea 16             	shr    $0x16,%edx
+  801242:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801249:	f6 c2 01             	test   $0x1,%dl
+  80124c:	74 bf                	je     80120d <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  80124e:	89 c2                	mov    %eax,%edx
+  801250:	c1 ea 0c             	shr    $0xc,%edx
+  801253:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80125a:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  80125d:	83 fa 03             	cmp    $0x3,%edx
+  801260:	75 ab                	jne    80120d <fsv_alloc+0xe>
+  801262:	eb c8                	jmp    80122c <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  801264:	83 ec 0c             	sub    $0xc,%esp
+  801267:	68 40 50 80 00       	push   $0x805040
+  80126c:	e8 4d f7 ff ff       	call   8009be <sysbatch_flush>
+  801271:	83 c4 10             	add    $0x10,%esp
+}
+  801274:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801277:	5b                   	pop    %ebx
+  801278:	5e                   	pop    %esi
+  801279:	5d                   	pop    %ebp
+  80127a:	c3                   	ret
+
+0080127b <devfile_read>:
+{
+  80127b:	55                   	push   %ebp
+  80127c:	89 e5                	mov    %esp,%ebp
+  80127e:	57                   	push   %edi
+  80127f:	56                   	push   %esi
+  801280:	53                   	push   %ebx
+  801281:	83 ec 3c             	sub    $0x3c,%esp
+  801284:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  801287:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  80128d:	77 57                	ja     8012e6 <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80128f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801292:	8b 40 0c             	mov    0xc(%eax),%eax
+  801295:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read.req_n = n;
+  80129a:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8012a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012a5:	b8 03 00 00 00       	mov    $0x3,%eax
+  8012aa:	e8 79 fe ff ff       	call   801128 <fsipc>
+  8012af:	89 c6                	mov    %eax,%esi
+  8012b1:	85 c0                	test   %eax,%eax
+  8012b3:	78 27                	js     8012dc <devfile_read+0x61>
+  assert(r <= n);
+  8012b5:	39 c3                	cmp    %eax,%ebx
+  8012b7:	0f 82 0e 02 00 00    	jb     8014cb <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  8012bd:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8012c2:	0f 8f 1c 02 00 00    	jg     8014e4 <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8012c8:	83 ec 04             	sub    $0x4,%esp
+  8012cb:	50                   	push   %eax
+  8012cc:	68 00 60 80 00       	push   $0x806000
+  8012d1:	ff 75 0c             	push   0xc(%ebp)
+  8012d4:	e8 39 f0 ff ff       	call   800312 <memmove>
+  return r;
+  8012d9:	83 c4 10             	add    $0x10,%esp
+}
+  8012dc:	89 f0                	mov    %esi,%eax
+  8012de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012e1:	5b                   	pop    %ebx
+  8012e2:	5e                   	pop    %esi
+  8012e3:	5f                   	pop    %edi
+  8012e4:	5d                   	pop    %ebp
+  8012e5:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  8012e6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8012eb:	e8 0f ff ff ff       	call   8011ff <fsv_alloc>
+  8012f0:	89 c6                	mov    %eax,%esi
+  8012f2:	85 c0                	test   %eax,%eax
+  8012f4:	78 e6                	js     8012dc <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  8012f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8012f9:	8b 40 0c             	mov    0xc(%eax),%eax
+  8012fc:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  801301:	8b 45 08             	mov    0x8(%ebp),%eax
+  801304:	8b 40 04             	mov    0x4(%eax),%eax
+  801307:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  80130c:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  801312:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801319:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80131e:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801323:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801328:	e8 e2 fc ff ff       	call   80100f <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  80132d:	6a 00                	push   $0x0
+  80132f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801332:	50                   	push   %eax
+  801333:	68 00 10 c0 9f       	push   $0x9fc01000
+  801338:	6a 00                	push   $0x0
+  80133a:	e8 ca 17 00 00       	call   802b09 <ipc_recv_pages>
+  80133f:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  801341:	83 c4 10             	add    $0x10,%esp
+  801344:	85 c0                	test   %eax,%eax
+  801346:	7e 94                	jle    8012dc <devfile_read+0x61>
+  assert(r <= n);
+  801348:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80134b:	39 c3                	cmp    %eax,%ebx
+  80134d:	72 2e                	jb     80137d <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  80134f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801352:	8b 40 04             	mov    0x4(%eax),%eax
+  801355:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80135a:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  80135d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801360:	c1 e2 0c             	shl    $0xc,%edx
+  801363:	39 ca                	cmp    %ecx,%edx
+  801365:	72 2f                	jb     801396 <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  801367:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  80136c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  80136f:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  801373:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801378:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  80137b:	eb 52                	jmp    8013cf <devfile_read+0x154>
+  assert(r <= n);
+  80137d:	68 dd 2f 80 00       	push   $0x802fdd
+  801382:	68 e4 2f 80 00       	push   $0x802fe4
+  801387:	68 49 01 00 00       	push   $0x149
+  80138c:	68 d2 2f 80 00       	push   $0x802fd2
+  801391:	e8 e5 10 00 00       	call   80247b <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801396:	68 08 30 80 00       	push   $0x803008
+  80139b:	68 e4 2f 80 00       	push   $0x802fe4
+  8013a0:	68 4a 01 00 00       	push   $0x14a
+  8013a5:	68 d2 2f 80 00       	push   $0x802fd2
+  8013aa:	e8 cc 10 00 00       	call   80247b <_panic>
+      memmove(dst + done, src + done, m);
+  8013af:	83 ec 04             	sub    $0x4,%esp
+  8013b2:	53                   	push   %ebx
+  8013b3:	56                   	push   %esi
+  8013b4:	89 f8                	mov    %edi,%eax
+  8013b6:	03 45 0c             	add    0xc(%ebp),%eax
+  8013b9:	50                   	push   %eax
+  8013ba:	e8 53 ef ff ff       	call   800312 <memmove>
+  8013bf:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  8013c2:	01 df                	add    %ebx,%edi
+  8013c4:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8013c7:	39 c7                	cmp    %eax,%edi
+  8013c9:	0f 83 c0 00 00 00    	jae    80148f <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  8013cf:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8013d2:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  8013d5:	89 f0                	mov    %esi,%eax
+  8013d7:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8013dc:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  8013e1:	29 c3                	sub    %eax,%ebx
+  8013e3:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8013e6:	29 f8                	sub    %edi,%eax
+  8013e8:	39 c3                	cmp    %eax,%ebx
+  8013ea:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  8013ed:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  8013f3:	75 ba                	jne    8013af <devfile_read+0x134>
+  8013f5:	89 f9                	mov    %edi,%ecx
+  8013f7:	03 4d 0c             	add    0xc(%ebp),%ecx
+  8013fa:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  8013fd:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  801403:	75 aa                	jne    8013af <devfile_read+0x134>
+  801405:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  80140b:	77 a2                	ja     8013af <devfile_read+0x134>
+  80140d:	89 c8                	mov    %ecx,%eax
+  80140f:	c1 e8 16             	shr    $0x16,%eax
+  801412:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801419:	a8 01                	test   $0x1,%al
+  80141b:	74 92                	je     8013af <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  80141d:	89 c8                	mov    %ecx,%eax
+  80141f:	c1 e8 0c             	shr    $0xc,%eax
+  801422:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  801429:	a8 01                	test   $0x1,%al
+  80142b:	74 82                	je     8013af <devfile_read+0x134>
+  80142d:	a9 02 08 00 00       	test   $0x802,%eax
+  801432:	0f 84 77 ff ff ff    	je     8013af <devfile_read+0x134>
+  801438:	f6 c4 04             	test   $0x4,%ah
+  80143b:	0f 85 6e ff ff ff    	jne    8013af <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  801441:	a1 44 57 80 00       	mov    0x805744,%eax
+  801446:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  80144a:	84 c0                	test   %al,%al
+  80144c:	75 17                	jne    801465 <devfile_read+0x1ea>
+  80144e:	83 ec 08             	sub    $0x8,%esp
+  801451:	6a 01                	push   $0x1
+  801453:	6a 00                	push   $0x0
+  801455:	e8 1e f1 ff ff       	call   800578 <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  80145a:	83 c4 10             	add    $0x10,%esp
+  80145d:	85 c0                	test   %eax,%eax
+  80145f:	0f 85 4a ff ff ff    	jne    8013af <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  801465:	83 ec 04             	sub    $0x4,%esp
+  801468:	68 05 08 00 00       	push   $0x805
+  80146d:	ff 75 cc             	push   -0x34(%ebp)
+  801470:	6a 00                	push   $0x0
+  801472:	56                   	push   %esi
+  801473:	6a 00                	push   $0x0
+  801475:	6a 05                	push   $0x5
+  801477:	68 40 50 80 00       	push   $0x805040
+  80147c:	e8 8d f5 ff ff       	call   800a0e <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  801481:	c1 e8 1f             	shr    $0x1f,%eax
+  801484:	08 45 cb             	or     %al,-0x35(%ebp)
+  801487:	83 c4 20             	add    $0x20,%esp
+  80148a:	e9 33 ff ff ff       	jmp    8013c2 <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  80148f:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  801492:	83 ec 0c             	sub    $0xc,%esp
+  801495:	68 40 50 80 00       	push   $0x805040
+  80149a:	e8 1f f5 ff ff       	call   8009be <sysbatch_flush>
+  80149f:	83 c4 10             	add    $0x10,%esp
+  8014a2:	85 c0                	test   %eax,%eax
+  8014a4:	78 06                	js     8014ac <devfile_read+0x231>
+  8014a6:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  8014aa:	74 14                	je     8014c0 <devfile_read+0x245>
+    memmove(dst, src, r);
+  8014ac:	83 ec 04             	sub    $0x4,%esp
+  8014af:	ff 75 d4             	push   -0x2c(%ebp)
+  8014b2:	ff 75 d0             	push   -0x30(%ebp)
+  8014b5:	ff 75 0c             	push   0xc(%ebp)
+  8014b8:	e8 55 ee ff ff       	call   800312 <memmove>
+  8014bd:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  8014c0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014c3:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  8014c6:	e9 11 fe ff ff       	jmp    8012dc <devfile_read+0x61>
+  assert(r <= n);
+  8014cb:	68 dd 2f 80 00       	push   $0x802fdd
+  8014d0:	68 e4 2f 80 00       	push   $0x802fe4
+  8014d5:	68 1c 01 00 00       	push   $0x11c
+  8014da:	68 d2 2f 80 00       	push   $0x802fd2
+  8014df:	e8 97 0f 00 00       	call   80247b <_panic>
+  assert(r <= PGSIZE);
+  8014e4:	68 f9 2f 80 00       	push   $0x802ff9
+  8014e9:	68 e4 2f 80 00       	push   $0x802fe4
+  8014ee:	68 1d 01 00 00       	push   $0x11d
+  8014f3:	68 d2 2f 80 00       	push   $0x802fd2
+  8014f8:	e8 7e 0f 00 00       	call   80247b <_panic>
+
+008014fd <devfile_write>:
+{
+  8014fd:	55                   	push   %ebp
+  8014fe:	89 e5                	mov    %esp,%ebp
+  801500:	57                   	push   %edi
+  801501:	56                   	push   %esi
+  801502:	53                   	push   %ebx
+  801503:	83 ec 1c             	sub    $0x1c,%esp
+  801506:	8b 75 08             	mov    0x8(%ebp),%esi
+  801509:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  80150c:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  801511:	77 39                	ja     80154c <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801513:	8b 56 0c             	mov    0xc(%esi),%edx
+  801516:	89 15 00 60 80 00    	mov    %edx,0x806000
+  fsipcbuf.write.req_n = n;
+  80151c:	a3 04 60 80 00       	mov    %eax,0x806004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  801521:	83 ec 04             	sub    $0x4,%esp
+  801524:	50                   	push   %eax
+  801525:	ff 75 0c             	push   0xc(%ebp)
+  801528:	68 08 60 80 00       	push   $0x806008
+  80152d:	e8 e0 ed ff ff       	call   800312 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801532:	ba 00 00 00 00       	mov    $0x0,%edx
+  801537:	b8 04 00 00 00       	mov    $0x4,%eax
+  80153c:	e8 e7 fb ff ff       	call   801128 <fsipc>
+  801541:	83 c4 10             	add    $0x10,%esp
+}
+  801544:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801547:	5b                   	pop    %ebx
+  801548:	5e                   	pop    %esi
+  801549:	5f                   	pop    %edi
+  80154a:	5d                   	pop    %ebp
+  80154b:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  80154c:	ba 00 00 10 00       	mov    $0x100000,%edx
+  801551:	39 d0                	cmp    %edx,%eax
+  801553:	89 d3                	mov    %edx,%ebx
+  801555:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  801558:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  80155e:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  801561:	83 c7 01             	add    $0x1,%edi
+  801564:	89 f8                	mov    %edi,%eax
+  801566:	e8 94 fc ff ff       	call   8011ff <fsv_alloc>
+  80156b:	85 c0                	test   %eax,%eax
+  80156d:	78 d5                	js     801544 <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  80156f:	83 ec 04             	sub    $0x4,%esp
+  801572:	53                   	push   %ebx
+  801573:	ff 75 0c             	push   0xc(%ebp)
+  801576:	68 00 10 c0 9f       	push   $0x9fc01000
+  80157b:	e8 92 ed ff ff       	call   800312 <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  801580:	8b 46 0c             	mov    0xc(%esi),%eax
+  801583:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  801588:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  80158e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801595:	89 f9                	mov    %edi,%ecx
+  801597:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  80159c:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8015a1:	e8 69 fa ff ff       	call   80100f <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  8015a6:	6a 00                	push   $0x0
+  8015a8:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8015ab:	50                   	push   %eax
+  8015ac:	6a 00                	push   $0x0
+  8015ae:	6a 00                	push   $0x0
+  8015b0:	e8 54 15 00 00       	call   802b09 <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  8015b5:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  8015b8:	eb 8a                	jmp    801544 <devfile_write+0x47>
+
+008015ba <open>:
+{
+  8015ba:	55                   	push   %ebp
+  8015bb:	89 e5                	mov    %esp,%ebp
+  8015bd:	56                   	push   %esi
+  8015be:	53                   	push   %ebx
+  8015bf:	83 ec 1c             	sub    $0x1c,%esp
+  8015c2:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  8015c5:	56                   	push   %esi
+  8015c6:	e8 86 eb ff ff       	call   800151 <strlen>
+  8015cb:	83 c4 10             	add    $0x10,%esp
+  8015ce:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8015d3:	7f 6c                	jg     801641 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  8015d5:	83 ec 0c             	sub    $0xc,%esp
+  8015d8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015db:	50                   	push   %eax
+  8015dc:	e8 ad f4 ff ff       	call   800a8e <fd_alloc>
+  8015e1:	89 c3                	mov    %eax,%ebx
+  8015e3:	83 c4 10             	add    $0x10,%esp
+  8015e6:	85 c0                	test   %eax,%eax
+  8015e8:	78 3c                	js     801626 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  8015ea:	83 ec 08             	sub    $0x8,%esp
+  8015ed:	56                   	push   %esi
+  8015ee:	68 00 60 80 00       	push   $0x806000
+  8015f3:	e8 94 eb ff ff       	call   80018c <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  8015f8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8015fb:	a3 00 64 80 00       	mov    %eax,0x806400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801600:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801603:	b8 01 00 00 00       	mov    $0x1,%eax
+  801608:	e8 1b fb ff ff       	call   801128 <fsipc>
+  80160d:	89 c3                	mov    %eax,%ebx
+  80160f:	83 c4 10             	add    $0x10,%esp
+  801612:	85 c0                	test   %eax,%eax
+  801614:	78 19                	js     80162f <open+0x75>
+  return fd2num(fd);
+  801616:	83 ec 0c             	sub    $0xc,%esp
+  801619:	ff 75 f4             	push   -0xc(%ebp)
+  80161c:	e8 49 f4 ff ff       	call   800a6a <fd2num>
+  801621:	89 c3                	mov    %eax,%ebx
+  801623:	83 c4 10             	add    $0x10,%esp
+}
+  801626:	89 d8                	mov    %ebx,%eax
+  801628:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80162b:	5b                   	pop    %ebx
+  80162c:	5e                   	pop    %esi
+  80162d:	5d                   	pop    %ebp
+  80162e:	c3                   	ret
+    fd_close(fd, 0);
+  80162f:	83 ec 08             	sub    $0x8,%esp
+  801632:	6a 00                	push   $0x0
+  801634:	ff 75 f4             	push   -0xc(%ebp)
+  801637:	e8 44 f5 ff ff       	call   800b80 <fd_close>
+    return r;
+  80163c:	83 c4 10             	add    $0x10,%esp
+  80163f:	eb e5                	jmp    801626 <open+0x6c>
+    return -E_BAD_PATH;
+  801641:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801646:	eb de                	jmp    801626 <open+0x6c>
+
+00801648 <open_read>:
+{
+  801648:	55                   	push   %ebp
+  801649:	89 e5                	mov    %esp,%ebp
+  80164b:	57                   	push   %edi
+  80164c:	56                   	push   %esi
+  80164d:	53                   	push   %ebx
+  80164e:	83 ec 28             	sub    $0x28,%esp
+  801651:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  801654:	57                   	push   %edi
+  801655:	e8 f7 ea ff ff       	call   800151 <strlen>
+  80165a:	83 c4 10             	add    $0x10,%esp
+  80165d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801662:	0f 87 f6 00 00 00    	ja     80175e <open_read+0x116>
+  801668:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  80166a:	83 ec 0c             	sub    $0xc,%esp
+  80166d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801670:	50                   	push   %eax
+  801671:	e8 18 f4 ff ff       	call   800a8e <fd_alloc>
+  801676:	89 c3                	mov    %eax,%ebx
+  801678:	83 c4 10             	add    $0x10,%esp
+  80167b:	85 c0                	test   %eax,%eax
+  80167d:	0f 88 b2 00 00 00    	js     801735 <open_read+0xed>
+  strcpy(req->req_buf, path);
+  801683:	83 ec 08             	sub    $0x8,%esp
+  801686:	57                   	push   %edi
+  801687:	68 e4 60 80 00       	push   $0x8060e4
+  80168c:	e8 fb ea ff ff       	call   80018c <strcpy>
+  req->req_nops = 2;
+  801691:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  801698:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  80169b:	c7 05 04 60 80 00 01 	movl   $0x1,0x806004
+  8016a2:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  8016a5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8016a8:	a3 10 60 80 00       	mov    %eax,0x806010
+  req->req_ops[0].op_buf = 0;
+  8016ad:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  8016b4:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  8016b7:	c7 05 20 60 80 00 04 	movl   $0x4,0x806020
+  8016be:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  8016c1:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  8016c8:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  8016cb:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  8016d0:	29 f0                	sub    %esi,%eax
+  8016d2:	3b 45 14             	cmp    0x14(%ebp),%eax
+  8016d5:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  8016d9:	a3 2c 60 80 00       	mov    %eax,0x80602c
+  req->req_ops[1].op_offset = 0;
+  8016de:	c7 05 30 60 80 00 00 	movl   $0x0,0x806030
+  8016e5:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  8016e8:	83 c6 01             	add    $0x1,%esi
+  8016eb:	89 35 34 60 80 00    	mov    %esi,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  8016f1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8016f4:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8016f9:	e8 2a fa ff ff       	call   801128 <fsipc>
+  8016fe:	89 c3                	mov    %eax,%ebx
+  801700:	83 c4 10             	add    $0x10,%esp
+  801703:	83 f8 01             	cmp    $0x1,%eax
+  801706:	7e 37                	jle    80173f <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  801708:	a1 38 60 80 00       	mov    0x806038,%eax
+  80170d:	8b 55 18             	mov    0x18(%ebp),%edx
+  801710:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  801712:	83 ec 04             	sub    $0x4,%esp
+  801715:	50                   	push   %eax
+  801716:	81 c6 e4 60 80 00    	add    $0x8060e4,%esi
+  80171c:	56                   	push   %esi
+  80171d:	ff 75 10             	push   0x10(%ebp)
+  801720:	e8 ed eb ff ff       	call   800312 <memmove>
+  return fd2num(fd);
+  801725:	83 c4 04             	add    $0x4,%esp
+  801728:	ff 75 e4             	push   -0x1c(%ebp)
+  80172b:	e8 3a f3 ff ff       	call   800a6a <fd2num>
+  801730:	89 c3                	mov    %eax,%ebx
+  801732:	83 c4 10             	add    $0x10,%esp
+}
+  801735:	89 d8                	mov    %ebx,%eax
+  801737:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80173a:	5b                   	pop    %ebx
+  80173b:	5e                   	pop    %esi
+  80173c:	5f                   	pop    %edi
+  80173d:	5d                   	pop    %ebp
+  80173e:	c3                   	ret
+    fd_close(fd, 0);
+  80173f:	83 ec 08             	sub    $0x8,%esp
+  801742:	6a 00                	push   $0x0
+  801744:	ff 75 e4             	push   -0x1c(%ebp)
+  801747:	e8 34 f4 ff ff       	call   800b80 <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  80174c:	83 c4 10             	add    $0x10,%esp
+  80174f:	85 db                	test   %ebx,%ebx
+  801751:	78 e2                	js     801735 <open_read+0xed>
+  801753:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  801756:	8b 9b 1c 60 80 00    	mov    0x80601c(%ebx),%ebx
+  80175c:	eb d7                	jmp    801735 <open_read+0xed>
+    return -E_BAD_PATH;
+  80175e:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801763:	eb d0                	jmp    801735 <open_read+0xed>
+
+00801765 <file_stat>:
+{
+  801765:	55                   	push   %ebp
+  801766:	89 e5                	mov    %esp,%ebp
+  801768:	57                   	push   %edi
+  801769:	56                   	push   %esi
+  80176a:	53                   	push   %ebx
+  80176b:	83 ec 18             	sub    $0x18,%esp
+  80176e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801771:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801774:	57                   	push   %edi
+  801775:	e8 d7 e9 ff ff       	call   800151 <strlen>
+  80177a:	83 c4 10             	add    $0x10,%esp
+  80177d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801782:	0f 8f c7 00 00 00    	jg     80184f <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  801788:	83 ec 0c             	sub    $0xc,%esp
+  80178b:	57                   	push   %edi
+  80178c:	e8 c0 e9 ff ff       	call   800151 <strlen>
+  801791:	8d 58 04             	lea    0x4(%eax),%ebx
+  801794:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  801797:	83 c4 08             	add    $0x8,%esp
+  80179a:	57                   	push   %edi
+  80179b:	68 e4 60 80 00       	push   $0x8060e4
+  8017a0:	e8 e7 e9 ff ff       	call   80018c <strcpy>
+  req->req_nops = 2;
+  8017a5:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  8017ac:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  8017af:	c7 05 04 60 80 00 02 	movl   $0x2,0x806004
+  8017b6:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  8017b9:	c7 05 10 60 80 00 00 	movl   $0x0,0x806010
+  8017c0:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  8017c3:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  8017ca:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  8017cd:	c7 05 20 60 80 00 03 	movl   $0x3,0x806020
+  8017d4:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  8017d7:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  8017de:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  8017e1:	89 1d 34 60 80 00    	mov    %ebx,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  8017e7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017ec:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8017f1:	e8 32 f9 ff ff       	call   801128 <fsipc>
+  8017f6:	83 c4 10             	add    $0x10,%esp
+  8017f9:	83 f8 01             	cmp    $0x1,%eax
+  8017fc:	7e 42                	jle    801840 <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  8017fe:	81 c3 e4 60 80 00    	add    $0x8060e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  801804:	83 ec 08             	sub    $0x8,%esp
+  801807:	53                   	push   %ebx
+  801808:	56                   	push   %esi
+  801809:	e8 7e e9 ff ff       	call   80018c <strcpy>
+  st->st_size = ret->ret_size;
+  80180e:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  801814:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  80181a:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  801820:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  801826:	c7 86 88 00 00 00 04 	movl   $0x804004,0x88(%esi)
+  80182d:	40 80 00 
+  return 0;
+  801830:	83 c4 10             	add    $0x10,%esp
+  801833:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801838:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80183b:	5b                   	pop    %ebx
+  80183c:	5e                   	pop    %esi
+  80183d:	5f                   	pop    %edi
+  80183e:	5d                   	pop    %ebp
+  80183f:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  801840:	85 c0                	test   %eax,%eax
+  801842:	78 f4                	js     801838 <file_stat+0xd3>
+  801844:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801847:	8b 80 1c 60 80 00    	mov    0x80601c(%eax),%eax
+  80184d:	eb e9                	jmp    801838 <file_stat+0xd3>
+    return -E_BAD_PATH;
+  80184f:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801854:	eb e2                	jmp    801838 <file_stat+0xd3>
+
+00801856 <read_map>:
+{
+  801856:	55                   	push   %ebp
+  801857:	89 e5                	mov    %esp,%ebp
+  801859:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80185c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80185f:	50                   	push   %eax
+  801860:	ff 75 08             	push   0x8(%ebp)
+  801863:	e8 7c f2 ff ff       	call   800ae4 <fd_lookup>
+  801868:	83 c4 10             	add    $0x10,%esp
+  80186b:	85 c0                	test   %eax,%eax
+  80186d:	78 2a                	js     801899 <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  80186f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801872:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  801878:	39 08                	cmp    %ecx,(%eax)
+  80187a:	75 1f                	jne    80189b <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  80187c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80187f:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read_map.req_offset = offset;
+  801884:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801887:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  80188c:	8b 55 10             	mov    0x10(%ebp),%edx
+  80188f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801894:	e8 8f f8 ff ff       	call   801128 <fsipc>
+}
+  801899:	c9                   	leave
+  80189a:	c3                   	ret
+    return -E_INVAL;
+  80189b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018a0:	eb f7                	jmp    801899 <read_map+0x43>
+
+008018a2 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8018a2:	55                   	push   %ebp
+  8018a3:	89 e5                	mov    %esp,%ebp
+  8018a5:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  8018a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018ad:	b8 08 00 00 00       	mov    $0x8,%eax
+  8018b2:	e8 71 f8 ff ff       	call   801128 <fsipc>
+}
+  8018b7:	c9                   	leave
+  8018b8:	c3                   	ret
+
+008018b9 <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  8018b9:	55                   	push   %ebp
+  8018ba:	89 e5                	mov    %esp,%ebp
+  8018bc:	57                   	push   %edi
+  8018bd:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  8018be:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018c1:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.stats.req_bio_sched = 0;
+  8018c6:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  8018cd:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  8018d0:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  8018d7:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  8018da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018df:	b8 09 00 00 00       	mov    $0x9,%eax
+  8018e4:	e8 3f f8 ff ff       	call   801128 <fsipc>
+  8018e9:	85 c0                	test   %eax,%eax
+  8018eb:	78 14                	js     801901 <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  8018ed:	be 00 60 80 00       	mov    $0x806000,%esi
+  8018f2:	b9 16 00 00 00       	mov    $0x16,%ecx
+  8018f7:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8018fa:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  8018fc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801901:	5e                   	pop    %esi
+  801902:	5f                   	pop    %edi
+  801903:	5d                   	pop    %ebp
+  801904:	c3                   	ret
+
+00801905 <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  801905:	55                   	push   %ebp
+  801906:	89 e5                	mov    %esp,%ebp
+  801908:	53                   	push   %ebx
+  801909:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  80190c:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  80190f:	50                   	push   %eax
+  801910:	6a 00                	push   $0x0
+  801912:	e8 a2 ff ff ff       	call   8018b9 <fs_stats>
+  801917:	83 c4 10             	add    $0x10,%esp
+  80191a:	85 c0                	test   %eax,%eax
+  80191c:	78 28                	js     801946 <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  80191e:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  801921:	83 ec 08             	sub    $0x8,%esp
+  801924:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801927:	50                   	push   %eax
+  801928:	6a 20                	push   $0x20
+  80192a:	e8 8a ff ff ff       	call   8018b9 <fs_stats>
+  80192f:	83 c4 10             	add    $0x10,%esp
+  801932:	85 c0                	test   %eax,%eax
+  801934:	78 10                	js     801946 <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  801936:	83 ec 08             	sub    $0x8,%esp
+  801939:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  80193c:	50                   	push   %eax
+  80193d:	53                   	push   %ebx
+  80193e:	e8 76 ff ff ff       	call   8018b9 <fs_stats>
+  801943:	83 c4 10             	add    $0x10,%esp
+}
+  801946:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801949:	c9                   	leave
+  80194a:	c3                   	ret
+
+0080194b <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  80194b:	55                   	push   %ebp
+  80194c:	89 e5                	mov    %esp,%ebp
+  80194e:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  801951:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  801958:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  80195b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80195e:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.stats.req_dcache = 0;
+  801963:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  80196a:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  80196d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801972:	b8 09 00 00 00       	mov    $0x9,%eax
+  801977:	e8 ac f7 ff ff       	call   801128 <fsipc>
+}
+  80197c:	c9                   	leave
+  80197d:	c3                   	ret
+
+0080197e <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  80197e:	55                   	push   %ebp
+  80197f:	89 e5                	mov    %esp,%ebp
+  801981:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  801984:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  80198b:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  80198e:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  801995:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  801998:	8b 45 08             	mov    0x8(%ebp),%eax
+  80199b:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_STATS, NULL);
+  8019a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019a5:	b8 09 00 00 00       	mov    $0x9,%eax
+  8019aa:	e8 79 f7 ff ff       	call   801128 <fsipc>
+}
+  8019af:	c9                   	leave
+  8019b0:	c3                   	ret
+
+008019b1 <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  8019b1:	55                   	push   %ebp
+  8019b2:	89 e5                	mov    %esp,%ebp
+  8019b4:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8019b7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019ba:	50                   	push   %eax
+  8019bb:	ff 75 08             	push   0x8(%ebp)
+  8019be:	e8 21 f1 ff ff       	call   800ae4 <fd_lookup>
+  8019c3:	83 c4 10             	add    $0x10,%esp
+  8019c6:	85 c0                	test   %eax,%eax
+  8019c8:	78 34                	js     8019fe <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  8019ca:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019cd:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  8019d3:	39 08                	cmp    %ecx,(%eax)
+  8019d5:	75 29                	jne    801a00 <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  8019d7:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019da:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.fallocate.req_offset = offset;
+  8019df:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8019e2:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.fallocate.req_len = len;
+  8019e7:	8b 45 10             	mov    0x10(%ebp),%eax
+  8019ea:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  8019ef:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019f4:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8019f9:	e8 2a f7 ff ff       	call   801128 <fsipc>
+}
+  8019fe:	c9                   	leave
+  8019ff:	c3                   	ret
+    return -E_INVAL;
+  801a00:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a05:	eb f7                	jmp    8019fe <fallocate+0x4d>
+
+00801a07 <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  801a07:	55                   	push   %ebp
+  801a08:	89 e5                	mov    %esp,%ebp
+  801a0a:	57                   	push   %edi
+  801a0b:	56                   	push   %esi
+  801a0c:	53                   	push   %ebx
+  801a0d:	83 ec 24             	sub    $0x24,%esp
+  801a10:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801a13:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801a16:	50                   	push   %eax
+  801a17:	ff 75 08             	push   0x8(%ebp)
+  801a1a:	e8 c5 f0 ff ff       	call   800ae4 <fd_lookup>
+  801a1f:	83 c4 10             	add    $0x10,%esp
+  801a22:	85 c0                	test   %eax,%eax
+  801a24:	78 66                	js     801a8c <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  801a26:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801a29:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  801a2f:	39 08                	cmp    %ecx,(%eax)
+  801a31:	75 61                	jne    801a94 <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  801a33:	85 f6                	test   %esi,%esi
+  801a35:	7e 50                	jle    801a87 <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  801a37:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  801a3c:	39 de                	cmp    %ebx,%esi
+  801a3e:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  801a41:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801a44:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a47:	a3 00 60 80 00       	mov    %eax,0x806000
+    fsipcbuf.prefetch.req_n = m;
+  801a4c:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  801a52:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  801a59:	83 ec 04             	sub    $0x4,%esp
+  801a5c:	57                   	push   %edi
+  801a5d:	ff 75 0c             	push   0xc(%ebp)
+  801a60:	68 08 60 80 00       	push   $0x806008
+  801a65:	e8 a8 e8 ff ff       	call   800312 <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  801a6a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a6f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801a74:	e8 af f6 ff ff       	call   801128 <fsipc>
+  801a79:	83 c4 10             	add    $0x10,%esp
+  801a7c:	85 c0                	test   %eax,%eax
+  801a7e:	78 0c                	js     801a8c <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  801a80:	01 7d 0c             	add    %edi,0xc(%ebp)
+  801a83:	29 de                	sub    %ebx,%esi
+  801a85:	eb ac                	jmp    801a33 <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  801a87:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a8c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a8f:	5b                   	pop    %ebx
+  801a90:	5e                   	pop    %esi
+  801a91:	5f                   	pop    %edi
+  801a92:	5d                   	pop    %ebp
+  801a93:	c3                   	ret
+    return -E_INVAL;
+  801a94:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a99:	eb f1                	jmp    801a8c <prefetch+0x85>
+
+00801a9b <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  801a9b:	55                   	push   %ebp
+  801a9c:	89 e5                	mov    %esp,%ebp
+  801a9e:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  801aa1:	50                   	push   %eax
+  801aa2:	e8 d3 ef ff ff       	call   800a7a <fd2data>
+  801aa7:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  801aac:	c9                   	leave
+  801aad:	c3                   	ret
+
+00801aae <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801aae:	55                   	push   %ebp
+  801aaf:	89 e5                	mov    %esp,%ebp
+  801ab1:	56                   	push   %esi
+  801ab2:	53                   	push   %ebx
+  801ab3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  801ab6:	83 ec 0c             	sub    $0xc,%esp
+  801ab9:	ff 75 08             	push   0x8(%ebp)
+  801abc:	e8 b9 ef ff ff       	call   800a7a <fd2data>
+  801ac1:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  801ac3:	83 c4 08             	add    $0x8,%esp
+  801ac6:	68 34 30 80 00       	push   $0x803034
+  801acb:	53                   	push   %ebx
+  801acc:	e8 bb e6 ff ff       	call   80018c <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  801ad1:	8b 46 04             	mov    0x4(%esi),%eax
+  801ad4:	2b 06                	sub    (%esi),%eax
+  801ad6:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  801adc:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801ae3:	00 00 00 
+  stat->st_dev = &devpipe;
+  801ae6:	c7 83 88 00 00 00 20 	movl   $0x804020,0x88(%ebx)
+  801aed:	40 80 00 
+  return 0;
+}
+  801af0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801af5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801af8:	5b                   	pop    %ebx
+  801af9:	5e                   	pop    %esi
+  801afa:	5d                   	pop    %ebp
+  801afb:	c3                   	ret
+
+00801afc <pipe_wakeup>:
+{
+  801afc:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  801afe:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b03:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  801b06:	85 c0                	test   %eax,%eax
+  801b08:	75 01                	jne    801b0b <pipe_wakeup+0xf>
+  801b0a:	c3                   	ret
+{
+  801b0b:	55                   	push   %ebp
+  801b0c:	89 e5                	mov    %esp,%ebp
+  801b0e:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  801b11:	6a 00                	push   $0x0
+  801b13:	68 00 00 c0 ee       	push   $0xeec00000
+  801b18:	52                   	push   %edx
+  801b19:	e8 f9 ed ff ff       	call   800917 <sys_chan_wakeup>
+  801b1e:	83 c4 10             	add    $0x10,%esp
+}
+  801b21:	c9                   	leave
+  801b22:	c3                   	ret
+
+00801b23 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801b23:	55                   	push   %ebp
+  801b24:	89 e5                	mov    %esp,%ebp
+  801b26:	57                   	push   %edi
+  801b27:	56                   	push   %esi
+  801b28:	53                   	push   %ebx
+  801b29:	83 ec 18             	sub    $0x18,%esp
+  801b2c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  801b2f:	57                   	push   %edi
+  801b30:	e8 45 ef ff ff       	call   800a7a <fd2data>
+  801b35:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  801b37:	83 c4 10             	add    $0x10,%esp
+  801b3a:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  801b3e:	74 2a                	je     801b6a <devpipe_close+0x47>
+  801b40:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  801b45:	89 f8                	mov    %edi,%eax
+  801b47:	e8 4f ff ff ff       	call   801a9b <pipe_ring>
+  801b4c:	83 ec 08             	sub    $0x8,%esp
+  801b4f:	01 d8                	add    %ebx,%eax
+  801b51:	50                   	push   %eax
+  801b52:	6a 00                	push   $0x0
+  801b54:	e8 e7 ea ff ff       	call   800640 <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  801b59:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801b5f:	83 c4 10             	add    $0x10,%esp
+  801b62:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  801b68:	75 db                	jne    801b45 <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  801b6a:	83 ec 08             	sub    $0x8,%esp
+  801b6d:	57                   	push   %edi
+  801b6e:	6a 00                	push   $0x0
+  801b70:	e8 cb ea ff ff       	call   800640 <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  801b75:	83 c4 10             	add    $0x10,%esp
+  801b78:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  801b7c:	75 13                	jne    801b91 <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  801b7e:	83 ec 08             	sub    $0x8,%esp
+  801b81:	56                   	push   %esi
+  801b82:	6a 00                	push   $0x0
+  801b84:	e8 b7 ea ff ff       	call   800640 <sys_page_unmap>
+}
+  801b89:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b8c:	5b                   	pop    %ebx
+  801b8d:	5e                   	pop    %esi
+  801b8e:	5f                   	pop    %edi
+  801b8f:	5d                   	pop    %ebp
+  801b90:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  801b91:	8d 56 04             	lea    0x4(%esi),%edx
+  801b94:	8d 46 2c             	lea    0x2c(%esi),%eax
+  801b97:	e8 60 ff ff ff       	call   801afc <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  801b9c:	8d 46 30             	lea    0x30(%esi),%eax
+  801b9f:	89 f2                	mov    %esi,%edx
+  801ba1:	e8 56 ff ff ff       	call   801afc <pipe_wakeup>
+  801ba6:	eb d6                	jmp    801b7e <devpipe_close+0x5b>
+
+00801ba8 <_pipeisclosed>:
+{
+  801ba8:	55                   	push   %ebp
+  801ba9:	89 e5                	mov    %esp,%ebp
+  801bab:	57                   	push   %edi
+  801bac:	56                   	push   %esi
+  801bad:	53                   	push   %ebx
+  801bae:	83 ec 1c             	sub    $0x1c,%esp
+  801bb1:	89 c7                	mov    %eax,%edi
+  801bb3:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  801bb5:	a1 44 57 80 00       	mov    0x805744,%eax
+  801bba:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  801bbd:	83 ec 0c             	sub    $0xc,%esp
+  801bc0:	57                   	push   %edi
+  801bc1:	e8 a6 10 00 00       	call   802c6c <pageref>
+  801bc6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801bc9:	89 34 24             	mov    %esi,(%esp)
+  801bcc:	e8 9b 10 00 00       	call   802c6c <pageref>
+    nn = thisenv->env_runs;
+  801bd1:	8b 15 44 57 80 00    	mov    0x805744,%edx
+  801bd7:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  801bda:	83 c4 10             	add    $0x10,%esp
+  801bdd:	39 cb                	cmp    %ecx,%ebx
+  801bdf:	74 1b                	je     801bfc <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  801be1:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801be4:	75 cf                	jne    801bb5 <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801be6:	8b 42 58             	mov    0x58(%edx),%eax
+  801be9:	6a 01                	push   $0x1
+  801beb:	50                   	push   %eax
+  801bec:	53                   	push   %ebx
+  801bed:	68 3b 30 80 00       	push   $0x80303b
+  801bf2:	e8 5f 09 00 00       	call   802556 <cprintf>
+  801bf7:	83 c4 10             	add    $0x10,%esp
+  801bfa:	eb b9                	jmp    801bb5 <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  801bfc:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801bff:	0f 94 c0             	sete   %al
+  801c02:	0f b6 c0             	movzbl %al,%eax
+}
+  801c05:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c08:	5b                   	pop    %ebx
+  801c09:	5e                   	pop    %esi
+  801c0a:	5f                   	pop    %edi
+  801c0b:	5d                   	pop    %ebp
+  801c0c:	c3                   	ret
+
+00801c0d <devpipe_write_bulk>:
+{
+  801c0d:	55                   	push   %ebp
+  801c0e:	89 e5                	mov    %esp,%ebp
+  801c10:	57                   	push   %edi
+  801c11:	56                   	push   %esi
+  801c12:	53                   	push   %ebx
+  801c13:	83 ec 1c             	sub    $0x1c,%esp
+  801c16:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801c19:	89 d6                	mov    %edx,%esi
+  801c1b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  801c1e:	e8 78 fe ff ff       	call   801a9b <pipe_ring>
+  801c23:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  801c26:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  801c2b:	8d 46 04             	lea    0x4(%esi),%eax
+  801c2e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  801c31:	eb 75                	jmp    801ca8 <devpipe_write_bulk+0x9b>
+  801c33:	b8 01 00 00 00       	mov    $0x1,%eax
+  801c38:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  801c3c:	6a 64                	push   $0x64
+  801c3e:	68 00 00 c0 ee       	push   $0xeec00000
+  801c43:	53                   	push   %ebx
+  801c44:	56                   	push   %esi
+  801c45:	e8 aa ec ff ff       	call   8008f4 <sys_chan_sleep>
+      continue;
+  801c4a:	83 c4 10             	add    $0x10,%esp
+  801c4d:	eb 59                	jmp    801ca8 <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  801c4f:	89 d1                	mov    %edx,%ecx
+  801c51:	c1 f9 1f             	sar    $0x1f,%ecx
+  801c54:	c1 e9 11             	shr    $0x11,%ecx
+  801c57:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  801c5a:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  801c5f:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  801c61:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  801c67:	29 d3                	sub    %edx,%ebx
+  801c69:	ba 00 80 00 00       	mov    $0x8000,%edx
+  801c6e:	29 c2                	sub    %eax,%edx
+  801c70:	39 d3                	cmp    %edx,%ebx
+  801c72:	0f 47 da             	cmova  %edx,%ebx
+  801c75:	8b 55 08             	mov    0x8(%ebp),%edx
+  801c78:	29 fa                	sub    %edi,%edx
+  801c7a:	39 d3                	cmp    %edx,%ebx
+  801c7c:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  801c7f:	83 ec 04             	sub    $0x4,%esp
+  801c82:	53                   	push   %ebx
+  801c83:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801c86:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  801c89:	52                   	push   %edx
+  801c8a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801c8d:	01 c8                	add    %ecx,%eax
+  801c8f:	50                   	push   %eax
+  801c90:	e8 df e6 ff ff       	call   800374 <memcpy>
+    i += m;
+  801c95:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  801c97:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  801c9a:	8d 46 2c             	lea    0x2c(%esi),%eax
+  801c9d:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801ca0:	e8 57 fe ff ff       	call   801afc <pipe_wakeup>
+  801ca5:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  801ca8:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  801cab:	73 2b                	jae    801cd8 <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  801cad:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  801caf:	8b 56 04             	mov    0x4(%esi),%edx
+  801cb2:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  801cb8:	39 d0                	cmp    %edx,%eax
+  801cba:	7d 93                	jge    801c4f <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  801cbc:	89 f2                	mov    %esi,%edx
+  801cbe:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801cc1:	e8 e2 fe ff ff       	call   801ba8 <_pipeisclosed>
+  801cc6:	85 c0                	test   %eax,%eax
+  801cc8:	0f 84 65 ff ff ff    	je     801c33 <devpipe_write_bulk+0x26>
+        return i;
+  801cce:	89 f8                	mov    %edi,%eax
+}
+  801cd0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cd3:	5b                   	pop    %ebx
+  801cd4:	5e                   	pop    %esi
+  801cd5:	5f                   	pop    %edi
+  801cd6:	5d                   	pop    %ebp
+  801cd7:	c3                   	ret
+  return i;
+  801cd8:	89 f8                	mov    %edi,%eax
+  801cda:	eb f4                	jmp    801cd0 <devpipe_write_bulk+0xc3>
+
+00801cdc <devpipe_write>:
+{
+  801cdc:	55                   	push   %ebp
+  801cdd:	89 e5                	mov    %esp,%ebp
+  801cdf:	57                   	push   %edi
+  801ce0:	56                   	push   %esi
+  801ce1:	53                   	push   %ebx
+  801ce2:	83 ec 28             	sub    $0x28,%esp
+  801ce5:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  801ce8:	56                   	push   %esi
+  801ce9:	e8 8c ed ff ff       	call   800a7a <fd2data>
+  801cee:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  801cf0:	8b 78 28             	mov    0x28(%eax),%edi
+  801cf3:	83 c4 10             	add    $0x10,%esp
+  801cf6:	85 ff                	test   %edi,%edi
+  801cf8:	75 25                	jne    801d1f <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  801cfa:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801cfd:	74 66                	je     801d65 <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  801cff:	8b 43 04             	mov    0x4(%ebx),%eax
+  801d02:	8b 0b                	mov    (%ebx),%ecx
+  801d04:	8d 51 20             	lea    0x20(%ecx),%edx
+  801d07:	39 d0                	cmp    %edx,%eax
+  801d09:	72 2b                	jb     801d36 <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  801d0b:	89 da                	mov    %ebx,%edx
+  801d0d:	89 f0                	mov    %esi,%eax
+  801d0f:	e8 94 fe ff ff       	call   801ba8 <_pipeisclosed>
+  801d14:	85 c0                	test   %eax,%eax
+  801d16:	75 51                	jne    801d69 <devpipe_write+0x8d>
+      sys_yield();
+  801d18:	e8 3c e8 ff ff       	call   800559 <sys_yield>
+  801d1d:	eb e0                	jmp    801cff <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  801d1f:	83 ec 0c             	sub    $0xc,%esp
+  801d22:	ff 75 10             	push   0x10(%ebp)
+  801d25:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d28:	89 c2                	mov    %eax,%edx
+  801d2a:	89 f0                	mov    %esi,%eax
+  801d2c:	e8 dc fe ff ff       	call   801c0d <devpipe_write_bulk>
+  801d31:	83 c4 10             	add    $0x10,%esp
+  801d34:	eb 38                	jmp    801d6e <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801d36:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801d39:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801d3d:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  801d40:	89 c2                	mov    %eax,%edx
+  801d42:	c1 fa 1f             	sar    $0x1f,%edx
+  801d45:	89 d1                	mov    %edx,%ecx
+  801d47:	c1 e9 1b             	shr    $0x1b,%ecx
+  801d4a:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801d4d:	83 e2 1f             	and    $0x1f,%edx
+  801d50:	29 ca                	sub    %ecx,%edx
+  801d52:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  801d56:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  801d5a:	83 c0 01             	add    $0x1,%eax
+  801d5d:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  801d60:	83 c7 01             	add    $0x1,%edi
+  801d63:	eb 95                	jmp    801cfa <devpipe_write+0x1e>
+  return i;
+  801d65:	89 f8                	mov    %edi,%eax
+  801d67:	eb 05                	jmp    801d6e <devpipe_write+0x92>
+        return 0;
+  801d69:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d6e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d71:	5b                   	pop    %ebx
+  801d72:	5e                   	pop    %esi
+  801d73:	5f                   	pop    %edi
+  801d74:	5d                   	pop    %ebp
+  801d75:	c3                   	ret
+
+00801d76 <devpipe_read_bulk>:
+{
+  801d76:	55                   	push   %ebp
+  801d77:	89 e5                	mov    %esp,%ebp
+  801d79:	57                   	push   %edi
+  801d7a:	56                   	push   %esi
+  801d7b:	53                   	push   %ebx
+  801d7c:	83 ec 2c             	sub    $0x2c,%esp
+  801d7f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801d82:	89 d6                	mov    %edx,%esi
+  801d84:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801d87:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  801d8a:	e8 0c fd ff ff       	call   801a9b <pipe_ring>
+  801d8f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  801d92:	85 db                	test   %ebx,%ebx
+  801d94:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801d99:	0f 45 c3             	cmovne %ebx,%eax
+  801d9c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801d9f:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  801da4:	8d 46 30             	lea    0x30(%esi),%eax
+  801da7:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  801daa:	eb 50                	jmp    801dfc <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  801dac:	89 d1                	mov    %edx,%ecx
+  801dae:	c1 f9 1f             	sar    $0x1f,%ecx
+  801db1:	c1 e9 11             	shr    $0x11,%ecx
+  801db4:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  801db7:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  801dbc:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  801dbe:	29 d3                	sub    %edx,%ebx
+  801dc0:	ba 00 80 00 00       	mov    $0x8000,%edx
+  801dc5:	29 c2                	sub    %eax,%edx
+  801dc7:	39 d3                	cmp    %edx,%ebx
+  801dc9:	0f 47 da             	cmova  %edx,%ebx
+  801dcc:	8b 55 08             	mov    0x8(%ebp),%edx
+  801dcf:	29 fa                	sub    %edi,%edx
+  801dd1:	39 d3                	cmp    %edx,%ebx
+  801dd3:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  801dd6:	83 ec 04             	sub    $0x4,%esp
+  801dd9:	53                   	push   %ebx
+  801dda:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801ddd:	01 c8                	add    %ecx,%eax
+  801ddf:	50                   	push   %eax
+  801de0:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  801de3:	01 f8                	add    %edi,%eax
+  801de5:	50                   	push   %eax
+  801de6:	e8 89 e5 ff ff       	call   800374 <memcpy>
+    i += m;
+  801deb:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  801ded:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  801def:	89 f2                	mov    %esi,%edx
+  801df1:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  801df4:	e8 03 fd ff ff       	call   801afc <pipe_wakeup>
+  801df9:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  801dfc:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  801dff:	73 51                	jae    801e52 <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  801e01:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  801e04:	8b 16                	mov    (%esi),%edx
+  801e06:	39 da                	cmp    %ebx,%edx
+  801e08:	75 a2                	jne    801dac <devpipe_read_bulk+0x36>
+      if (i > 0)
+  801e0a:	85 ff                	test   %edi,%edi
+  801e0c:	75 44                	jne    801e52 <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  801e0e:	89 f2                	mov    %esi,%edx
+  801e10:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801e13:	e8 90 fd ff ff       	call   801ba8 <_pipeisclosed>
+  801e18:	85 c0                	test   %eax,%eax
+  801e1a:	75 3a                	jne    801e56 <devpipe_read_bulk+0xe0>
+  801e1c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e21:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  801e25:	6a 64                	push   $0x64
+  801e27:	ff 75 d4             	push   -0x2c(%ebp)
+  801e2a:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  801e2b:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  801e2e:	50                   	push   %eax
+  801e2f:	e8 c0 ea ff ff       	call   8008f4 <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  801e34:	85 c0                	test   %eax,%eax
+  801e36:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e3b:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  801e3e:	83 c4 10             	add    $0x10,%esp
+  801e41:	a8 01                	test   $0x1,%al
+  801e43:	74 b7                	je     801dfc <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  801e45:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  801e4a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e4d:	5b                   	pop    %ebx
+  801e4e:	5e                   	pop    %esi
+  801e4f:	5f                   	pop    %edi
+  801e50:	5d                   	pop    %ebp
+  801e51:	c3                   	ret
+  return i;
+  801e52:	89 f8                	mov    %edi,%eax
+  801e54:	eb f4                	jmp    801e4a <devpipe_read_bulk+0xd4>
+        return 0;
+  801e56:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e5b:	eb ed                	jmp    801e4a <devpipe_read_bulk+0xd4>
+
+00801e5d <devpipe_read>:
+{
+  801e5d:	55                   	push   %ebp
+  801e5e:	89 e5                	mov    %esp,%ebp
+  801e60:	57                   	push   %edi
+  801e61:	56                   	push   %esi
+  801e62:	53                   	push   %ebx
+  801e63:	83 ec 18             	sub    $0x18,%esp
+  801e66:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  801e69:	57                   	push   %edi
+  801e6a:	e8 0b ec ff ff       	call   800a7a <fd2data>
+  801e6f:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  801e71:	8b 70 28             	mov    0x28(%eax),%esi
+  801e74:	83 c4 10             	add    $0x10,%esp
+  801e77:	85 f6                	test   %esi,%esi
+  801e79:	75 24                	jne    801e9f <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  801e7b:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801e7e:	74 60                	je     801ee0 <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  801e80:	8b 03                	mov    (%ebx),%eax
+  801e82:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801e85:	75 3b                	jne    801ec2 <devpipe_read+0x65>
+      if (i > 0)
+  801e87:	85 f6                	test   %esi,%esi
+  801e89:	75 2d                	jne    801eb8 <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  801e8b:	89 da                	mov    %ebx,%edx
+  801e8d:	89 f8                	mov    %edi,%eax
+  801e8f:	e8 14 fd ff ff       	call   801ba8 <_pipeisclosed>
+  801e94:	85 c0                	test   %eax,%eax
+  801e96:	75 4c                	jne    801ee4 <devpipe_read+0x87>
+      sys_yield();
+  801e98:	e8 bc e6 ff ff       	call   800559 <sys_yield>
+  801e9d:	eb e1                	jmp    801e80 <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  801e9f:	83 ec 08             	sub    $0x8,%esp
+  801ea2:	6a 00                	push   $0x0
+  801ea4:	ff 75 10             	push   0x10(%ebp)
+  801ea7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801eaa:	89 c2                	mov    %eax,%edx
+  801eac:	89 f8                	mov    %edi,%eax
+  801eae:	e8 c3 fe ff ff       	call   801d76 <devpipe_read_bulk>
+  801eb3:	83 c4 10             	add    $0x10,%esp
+  801eb6:	eb 02                	jmp    801eba <devpipe_read+0x5d>
+        return i;
+  801eb8:	89 f0                	mov    %esi,%eax
+}
+  801eba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ebd:	5b                   	pop    %ebx
+  801ebe:	5e                   	pop    %esi
+  801ebf:	5f                   	pop    %edi
+  801ec0:	5d                   	pop    %ebp
+  801ec1:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801ec2:	99                   	cltd
+  801ec3:	c1 ea 1b             	shr    $0x1b,%edx
+  801ec6:	01 d0                	add    %edx,%eax
+  801ec8:	83 e0 1f             	and    $0x1f,%eax
+  801ecb:	29 d0                	sub    %edx,%eax
+  801ecd:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801ed2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ed5:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  801ed8:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  801edb:	83 c6 01             	add    $0x1,%esi
+  801ede:	eb 9b                	jmp    801e7b <devpipe_read+0x1e>
+  return i;
+  801ee0:	89 f0                	mov    %esi,%eax
+  801ee2:	eb d6                	jmp    801eba <devpipe_read+0x5d>
+        return 0;
+  801ee4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ee9:	eb cf                	jmp    801eba <devpipe_read+0x5d>
+
+00801eeb <pipe2>:
+{
+  801eeb:	55                   	push   %ebp
+  801eec:	89 e5                	mov    %esp,%ebp
+  801eee:	57                   	push   %edi
+  801eef:	56                   	push   %esi
+  801ef0:	53                   	push   %ebx
+  801ef1:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  801ef4:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801ef7:	50                   	push   %eax
+  801ef8:	e8 91 eb ff ff       	call   800a8e <fd_alloc>
+  801efd:	89 c3                	mov    %eax,%ebx
+  801eff:	83 c4 10             	add    $0x10,%esp
+  801f02:	85 c0                	test   %eax,%eax
+  801f04:	0f 88 fb 01 00 00    	js     802105 <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801f0a:	83 ec 04             	sub    $0x4,%esp
+  801f0d:	68 07 04 00 00       	push   $0x407
+  801f12:	ff 75 e4             	push   -0x1c(%ebp)
+  801f15:	6a 00                	push   $0x0
+  801f17:	e8 9f e6 ff ff       	call   8005bb <sys_page_alloc>
+  801f1c:	89 c3                	mov    %eax,%ebx
+  801f1e:	83 c4 10             	add    $0x10,%esp
+  801f21:	85 c0                	test   %eax,%eax
+  801f23:	0f 88 dc 01 00 00    	js     802105 <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  801f29:	83 ec 0c             	sub    $0xc,%esp
+  801f2c:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801f2f:	50                   	push   %eax
+  801f30:	e8 59 eb ff ff       	call   800a8e <fd_alloc>
+  801f35:	89 c3                	mov    %eax,%ebx
+  801f37:	83 c4 10             	add    $0x10,%esp
+  801f3a:	85 c0                	test   %eax,%eax
+  801f3c:	0f 88 b3 01 00 00    	js     8020f5 <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801f42:	83 ec 04             	sub    $0x4,%esp
+  801f45:	68 07 04 00 00       	push   $0x407
+  801f4a:	ff 75 e0             	push   -0x20(%ebp)
+  801f4d:	6a 00                	push   $0x0
+  801f4f:	e8 67 e6 ff ff       	call   8005bb <sys_page_alloc>
+  801f54:	89 c3                	mov    %eax,%ebx
+  801f56:	83 c4 10             	add    $0x10,%esp
+  801f59:	85 c0                	test   %eax,%eax
+  801f5b:	0f 88 94 01 00 00    	js     8020f5 <pipe2+0x20a>
+  va = fd2data(fd0);
+  801f61:	83 ec 0c             	sub    $0xc,%esp
+  801f64:	ff 75 e4             	push   -0x1c(%ebp)
+  801f67:	e8 0e eb ff ff       	call   800a7a <fd2data>
+  801f6c:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801f6e:	83 c4 0c             	add    $0xc,%esp
+  801f71:	68 07 04 00 00       	push   $0x407
+  801f76:	50                   	push   %eax
+  801f77:	6a 00                	push   $0x0
+  801f79:	e8 3d e6 ff ff       	call   8005bb <sys_page_alloc>
+  801f7e:	89 c3                	mov    %eax,%ebx
+  801f80:	83 c4 10             	add    $0x10,%esp
+  801f83:	85 c0                	test   %eax,%eax
+  801f85:	0f 88 5a 01 00 00    	js     8020e5 <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801f8b:	83 ec 0c             	sub    $0xc,%esp
+  801f8e:	ff 75 e0             	push   -0x20(%ebp)
+  801f91:	e8 e4 ea ff ff       	call   800a7a <fd2data>
+  801f96:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  801f9d:	50                   	push   %eax
+  801f9e:	6a 00                	push   $0x0
+  801fa0:	57                   	push   %edi
+  801fa1:	6a 00                	push   $0x0
+  801fa3:	e8 56 e6 ff ff       	call   8005fe <sys_page_map>
+  801fa8:	89 c3                	mov    %eax,%ebx
+  801faa:	83 c4 20             	add    $0x20,%esp
+  801fad:	85 c0                	test   %eax,%eax
+  801faf:	0f 88 22 01 00 00    	js     8020d7 <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  801fb5:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  801fb9:	74 72                	je     80202d <pipe2+0x142>
+  801fbb:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  801fc0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801fc3:	e8 d3 fa ff ff       	call   801a9b <pipe_ring>
+  801fc8:	83 ec 04             	sub    $0x4,%esp
+  801fcb:	68 07 04 00 00       	push   $0x407
+  801fd0:	01 f0                	add    %esi,%eax
+  801fd2:	50                   	push   %eax
+  801fd3:	6a 00                	push   $0x0
+  801fd5:	e8 e1 e5 ff ff       	call   8005bb <sys_page_alloc>
+  801fda:	89 c3                	mov    %eax,%ebx
+  801fdc:	83 c4 10             	add    $0x10,%esp
+  801fdf:	85 c0                	test   %eax,%eax
+  801fe1:	0f 88 97 00 00 00    	js     80207e <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  801fe7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801fea:	e8 ac fa ff ff       	call   801a9b <pipe_ring>
+  801fef:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  801ff2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801ff5:	e8 a1 fa ff ff       	call   801a9b <pipe_ring>
+  801ffa:	83 ec 0c             	sub    $0xc,%esp
+  801ffd:	68 07 04 00 00       	push   $0x407
+  802002:	53                   	push   %ebx
+  802003:	6a 00                	push   $0x0
+  802005:	01 f0                	add    %esi,%eax
+  802007:	50                   	push   %eax
+  802008:	6a 00                	push   $0x0
+  80200a:	e8 ef e5 ff ff       	call   8005fe <sys_page_map>
+  80200f:	89 c3                	mov    %eax,%ebx
+  802011:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802017:	83 c4 20             	add    $0x20,%esp
+  80201a:	85 c0                	test   %eax,%eax
+  80201c:	78 60                	js     80207e <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  80201e:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802024:	75 9a                	jne    801fc0 <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  802026:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  80202d:	a1 20 40 80 00       	mov    0x804020,%eax
+  802032:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802035:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  802037:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80203a:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  802041:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802044:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  802046:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802049:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  802050:	83 ec 0c             	sub    $0xc,%esp
+  802053:	ff 75 e4             	push   -0x1c(%ebp)
+  802056:	e8 0f ea ff ff       	call   800a6a <fd2num>
+  80205b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80205e:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  802060:	83 c4 04             	add    $0x4,%esp
+  802063:	ff 75 e0             	push   -0x20(%ebp)
+  802066:	e8 ff e9 ff ff       	call   800a6a <fd2num>
+  80206b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80206e:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  802071:	83 c4 10             	add    $0x10,%esp
+  802074:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802079:	e9 87 00 00 00       	jmp    802105 <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  80207e:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  802083:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802086:	e8 10 fa ff ff       	call   801a9b <pipe_ring>
+  80208b:	83 ec 08             	sub    $0x8,%esp
+  80208e:	01 f0                	add    %esi,%eax
+  802090:	50                   	push   %eax
+  802091:	6a 00                	push   $0x0
+  802093:	e8 a8 e5 ff ff       	call   800640 <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  802098:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80209b:	e8 fb f9 ff ff       	call   801a9b <pipe_ring>
+  8020a0:	83 c4 08             	add    $0x8,%esp
+  8020a3:	01 f0                	add    %esi,%eax
+  8020a5:	50                   	push   %eax
+  8020a6:	6a 00                	push   $0x0
+  8020a8:	e8 93 e5 ff ff       	call   800640 <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  8020ad:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8020b3:	83 c4 10             	add    $0x10,%esp
+  8020b6:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  8020bc:	75 c5                	jne    802083 <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  8020be:	83 ec 0c             	sub    $0xc,%esp
+  8020c1:	ff 75 e0             	push   -0x20(%ebp)
+  8020c4:	e8 b1 e9 ff ff       	call   800a7a <fd2data>
+  8020c9:	83 c4 08             	add    $0x8,%esp
+  8020cc:	50                   	push   %eax
+  8020cd:	6a 00                	push   $0x0
+  8020cf:	e8 6c e5 ff ff       	call   800640 <sys_page_unmap>
+  8020d4:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  8020d7:	83 ec 08             	sub    $0x8,%esp
+  8020da:	57                   	push   %edi
+  8020db:	6a 00                	push   $0x0
+  8020dd:	e8 5e e5 ff ff       	call   800640 <sys_page_unmap>
+  8020e2:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  8020e5:	83 ec 08             	sub    $0x8,%esp
+  8020e8:	ff 75 e0             	push   -0x20(%ebp)
+  8020eb:	6a 00                	push   $0x0
+  8020ed:	e8 4e e5 ff ff       	call   800640 <sys_page_unmap>
+  8020f2:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  8020f5:	83 ec 08             	sub    $0x8,%esp
+  8020f8:	ff 75 e4             	push   -0x1c(%ebp)
+  8020fb:	6a 00                	push   $0x0
+  8020fd:	e8 3e e5 ff ff       	call   800640 <sys_page_unmap>
+  802102:	83 c4 10             	add    $0x10,%esp
+}
+  802105:	89 d8                	mov    %ebx,%eax
+  802107:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80210a:	5b                   	pop    %ebx
+  80210b:	5e                   	pop    %esi
+  80210c:	5f                   	pop    %edi
+  80210d:	5d                   	pop    %ebp
+  80210e:	c3                   	ret
+
+0080210f <pipe>:
+{
+  80210f:	55                   	push   %ebp
+  802110:	89 e5                	mov    %esp,%ebp
+  802112:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  802115:	6a 00                	push   $0x0
+  802117:	ff 75 08             	push   0x8(%ebp)
+  80211a:	e8 cc fd ff ff       	call   801eeb <pipe2>
+}
+  80211f:	c9                   	leave
+  802120:	c3                   	ret
+
+00802121 <pipeisclosed>:
+{
+  802121:	55                   	push   %ebp
+  802122:	89 e5                	mov    %esp,%ebp
+  802124:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802127:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80212a:	50                   	push   %eax
+  80212b:	ff 75 08             	push   0x8(%ebp)
+  80212e:	e8 b1 e9 ff ff       	call   800ae4 <fd_lookup>
+  802133:	83 c4 10             	add    $0x10,%esp
+  802136:	85 c0                	test   %eax,%eax
+  802138:	78 18                	js     802152 <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  80213a:	83 ec 0c             	sub    $0xc,%esp
+  80213d:	ff 75 f4             	push   -0xc(%ebp)
+  802140:	e8 35 e9 ff ff       	call   800a7a <fd2data>
+  802145:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  802147:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80214a:	e8 59 fa ff ff       	call   801ba8 <_pipeisclosed>
+  80214f:	83 c4 10             	add    $0x10,%esp
+}
+  802152:	c9                   	leave
+  802153:	c3                   	ret
+
+00802154 <pipe_splice>:
+{
+  802154:	55                   	push   %ebp
+  802155:	89 e5                	mov    %esp,%ebp
+  802157:	57                   	push   %edi
+  802158:	56                   	push   %esi
+  802159:	53                   	push   %ebx
+  80215a:	83 ec 34             	sub    $0x34,%esp
+  80215d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802160:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802163:	50                   	push   %eax
+  802164:	ff 75 08             	push   0x8(%ebp)
+  802167:	e8 78 e9 ff ff       	call   800ae4 <fd_lookup>
+  80216c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80216f:	83 c4 10             	add    $0x10,%esp
+  802172:	85 c0                	test   %eax,%eax
+  802174:	0f 88 d7 00 00 00    	js     802251 <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  80217a:	83 ec 0c             	sub    $0xc,%esp
+  80217d:	ff 75 e4             	push   -0x1c(%ebp)
+  802180:	e8 f5 e8 ff ff       	call   800a7a <fd2data>
+  802185:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802187:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80218a:	83 c4 10             	add    $0x10,%esp
+  80218d:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802193:	39 10                	cmp    %edx,(%eax)
+  802195:	0f 85 c1 00 00 00    	jne    80225c <pipe_splice+0x108>
+  80219b:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  80219f:	0f 84 c0 00 00 00    	je     802265 <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  8021a5:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  8021a9:	0f 84 bf 00 00 00    	je     80226e <pipe_splice+0x11a>
+  8021af:	89 f7                	mov    %esi,%edi
+  8021b1:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  8021b7:	0f 85 ba 00 00 00    	jne    802277 <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  8021bd:	8d 43 04             	lea    0x4(%ebx),%eax
+  8021c0:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8021c3:	eb 38                	jmp    8021fd <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  8021c5:	83 ec 0c             	sub    $0xc,%esp
+  8021c8:	68 00 10 00 00       	push   $0x1000
+  8021cd:	89 f1                	mov    %esi,%ecx
+  8021cf:	89 da                	mov    %ebx,%edx
+  8021d1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8021d4:	e8 34 fa ff ff       	call   801c0d <devpipe_write_bulk>
+  8021d9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8021dc:	83 c4 10             	add    $0x10,%esp
+  8021df:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8021e4:	75 53                	jne    802239 <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  8021e6:	83 ec 08             	sub    $0x8,%esp
+  8021e9:	56                   	push   %esi
+  8021ea:	6a 00                	push   $0x0
+  8021ec:	e8 4f e4 ff ff       	call   800640 <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  8021f1:	83 c7 01             	add    $0x1,%edi
+  8021f4:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8021fa:	83 c4 10             	add    $0x10,%esp
+  8021fd:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802200:	74 3a                	je     80223c <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  802202:	8b 03                	mov    (%ebx),%eax
+  802204:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802207:	75 bc                	jne    8021c5 <pipe_splice+0x71>
+  802209:	b8 00 00 00 00       	mov    $0x0,%eax
+  80220e:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  802212:	85 c0                	test   %eax,%eax
+  802214:	74 af                	je     8021c5 <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802216:	83 ec 04             	sub    $0x4,%esp
+  802219:	6a 07                	push   $0x7
+  80221b:	56                   	push   %esi
+  80221c:	ff 75 d0             	push   -0x30(%ebp)
+  80221f:	e8 f3 e6 ff ff       	call   800917 <sys_chan_wakeup>
+  802224:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802227:	83 c4 10             	add    $0x10,%esp
+  80222a:	85 c0                	test   %eax,%eax
+  80222c:	79 b8                	jns    8021e6 <pipe_splice+0x92>
+  80222e:	b8 01 00 00 00       	mov    $0x1,%eax
+  802233:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802237:	eb 8c                	jmp    8021c5 <pipe_splice+0x71>
+  802239:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  80223c:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802240:	75 06                	jne    802248 <pipe_splice+0xf4>
+  802242:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802246:	78 09                	js     802251 <pipe_splice+0xfd>
+  return i * PGSIZE;
+  802248:	8b 45 10             	mov    0x10(%ebp),%eax
+  80224b:	c1 e0 0c             	shl    $0xc,%eax
+  80224e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  802251:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802254:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802257:	5b                   	pop    %ebx
+  802258:	5e                   	pop    %esi
+  802259:	5f                   	pop    %edi
+  80225a:	5d                   	pop    %ebp
+  80225b:	c3                   	ret
+    return -E_INVAL;
+  80225c:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802263:	eb ec                	jmp    802251 <pipe_splice+0xfd>
+  802265:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  80226c:	eb e3                	jmp    802251 <pipe_splice+0xfd>
+  80226e:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802275:	eb da                	jmp    802251 <pipe_splice+0xfd>
+  802277:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  80227e:	eb d1                	jmp    802251 <pipe_splice+0xfd>
+
+00802280 <pipe_splice_read>:
+{
+  802280:	55                   	push   %ebp
+  802281:	89 e5                	mov    %esp,%ebp
+  802283:	53                   	push   %ebx
+  802284:	83 ec 1c             	sub    $0x1c,%esp
+  802287:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80228a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80228d:	50                   	push   %eax
+  80228e:	ff 75 08             	push   0x8(%ebp)
+  802291:	e8 4e e8 ff ff       	call   800ae4 <fd_lookup>
+  802296:	83 c4 10             	add    $0x10,%esp
+  802299:	85 c0                	test   %eax,%eax
+  80229b:	78 49                	js     8022e6 <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  80229d:	83 ec 0c             	sub    $0xc,%esp
+  8022a0:	ff 75 f4             	push   -0xc(%ebp)
+  8022a3:	e8 d2 e7 ff ff       	call   800a7a <fd2data>
+  8022a8:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  8022aa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022ad:	83 c4 10             	add    $0x10,%esp
+  8022b0:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  8022b6:	39 08                	cmp    %ecx,(%eax)
+  8022b8:	75 31                	jne    8022eb <pipe_splice_read+0x6b>
+  8022ba:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  8022be:	74 32                	je     8022f2 <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  8022c0:	8b 48 08             	mov    0x8(%eax),%ecx
+  8022c3:	83 e1 03             	and    $0x3,%ecx
+  8022c6:	83 f9 01             	cmp    $0x1,%ecx
+  8022c9:	74 2e                	je     8022f9 <pipe_splice_read+0x79>
+  8022cb:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  8022d1:	75 2d                	jne    802300 <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  8022d3:	83 ec 08             	sub    $0x8,%esp
+  8022d6:	53                   	push   %ebx
+  8022d7:	68 00 10 00 00       	push   $0x1000
+  8022dc:	89 d9                	mov    %ebx,%ecx
+  8022de:	e8 93 fa ff ff       	call   801d76 <devpipe_read_bulk>
+  8022e3:	83 c4 10             	add    $0x10,%esp
+}
+  8022e6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022e9:	c9                   	leave
+  8022ea:	c3                   	ret
+    return -E_INVAL;
+  8022eb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8022f0:	eb f4                	jmp    8022e6 <pipe_splice_read+0x66>
+  8022f2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8022f7:	eb ed                	jmp    8022e6 <pipe_splice_read+0x66>
+  8022f9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8022fe:	eb e6                	jmp    8022e6 <pipe_splice_read+0x66>
+  802300:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802305:	eb df                	jmp    8022e6 <pipe_splice_read+0x66>
+
+00802307 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  802307:	b8 00 00 00 00       	mov    $0x0,%eax
+  80230c:	c3                   	ret
+
+0080230d <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80230d:	55                   	push   %ebp
+  80230e:	89 e5                	mov    %esp,%ebp
+  802310:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  802313:	68 53 30 80 00       	push   $0x803053
+  802318:	ff 75 0c             	push   0xc(%ebp)
+  80231b:	e8 6c de ff ff       	call   80018c <strcpy>
+  return 0;
+}
+  802320:	b8 00 00 00 00       	mov    $0x0,%eax
+  802325:	c9                   	leave
+  802326:	c3                   	ret
+
+00802327 <devcons_write>:
+{
+  802327:	55                   	push   %ebp
+  802328:	89 e5                	mov    %esp,%ebp
+  80232a:	57                   	push   %edi
+  80232b:	56                   	push   %esi
+  80232c:	53                   	push   %ebx
+  80232d:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  802333:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  802338:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  80233e:	eb 2e                	jmp    80236e <devcons_write+0x47>
+    m = n - tot;
+  802340:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802343:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  802345:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80234a:	39 c3                	cmp    %eax,%ebx
+  80234c:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  80234f:	83 ec 04             	sub    $0x4,%esp
+  802352:	53                   	push   %ebx
+  802353:	89 f0                	mov    %esi,%eax
+  802355:	03 45 0c             	add    0xc(%ebp),%eax
+  802358:	50                   	push   %eax
+  802359:	57                   	push   %edi
+  80235a:	e8 b3 df ff ff       	call   800312 <memmove>
+    sys_cputs(buf, m);
+  80235f:	83 c4 08             	add    $0x8,%esp
+  802362:	53                   	push   %ebx
+  802363:	57                   	push   %edi
+  802364:	e8 53 e1 ff ff       	call   8004bc <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  802369:	01 de                	add    %ebx,%esi
+  80236b:	83 c4 10             	add    $0x10,%esp
+  80236e:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802371:	72 cd                	jb     802340 <devcons_write+0x19>
+}
+  802373:	89 f0                	mov    %esi,%eax
+  802375:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802378:	5b                   	pop    %ebx
+  802379:	5e                   	pop    %esi
+  80237a:	5f                   	pop    %edi
+  80237b:	5d                   	pop    %ebp
+  80237c:	c3                   	ret
+
+0080237d <devcons_read>:
+{
+  80237d:	55                   	push   %ebp
+  80237e:	89 e5                	mov    %esp,%ebp
+  802380:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  802383:	b8 00 00 00 00       	mov    $0x0,%eax
+  802388:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80238c:	75 07                	jne    802395 <devcons_read+0x18>
+  80238e:	eb 1f                	jmp    8023af <devcons_read+0x32>
+    sys_yield();
+  802390:	e8 c4 e1 ff ff       	call   800559 <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  802395:	e8 40 e1 ff ff       	call   8004da <sys_cgetc>
+  80239a:	85 c0                	test   %eax,%eax
+  80239c:	74 f2                	je     802390 <devcons_read+0x13>
+  if (c < 0)
+  80239e:	78 0f                	js     8023af <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  8023a0:	83 f8 04             	cmp    $0x4,%eax
+  8023a3:	74 0c                	je     8023b1 <devcons_read+0x34>
+  *(char*)vbuf = c;
+  8023a5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8023a8:	88 02                	mov    %al,(%edx)
+  return 1;
+  8023aa:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8023af:	c9                   	leave
+  8023b0:	c3                   	ret
+    return 0;
+  8023b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023b6:	eb f7                	jmp    8023af <devcons_read+0x32>
+
+008023b8 <cputchar>:
+{
+  8023b8:	55                   	push   %ebp
+  8023b9:	89 e5                	mov    %esp,%ebp
+  8023bb:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  8023be:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023c1:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  8023c4:	6a 01                	push   $0x1
+  8023c6:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8023c9:	50                   	push   %eax
+  8023ca:	e8 ed e0 ff ff       	call   8004bc <sys_cputs>
+}
+  8023cf:	83 c4 10             	add    $0x10,%esp
+  8023d2:	c9                   	leave
+  8023d3:	c3                   	ret
+
+008023d4 <getchar>:
+{
+  8023d4:	55                   	push   %ebp
+  8023d5:	89 e5                	mov    %esp,%ebp
+  8023d7:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  8023da:	6a 01                	push   $0x1
+  8023dc:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8023df:	50                   	push   %eax
+  8023e0:	6a 00                	push   $0x0
+  8023e2:	e8 a8 e9 ff ff       	call   800d8f <read>
+  if (r < 0)
+  8023e7:	83 c4 10             	add    $0x10,%esp
+  8023ea:	85 c0                	test   %eax,%eax
+  8023ec:	78 06                	js     8023f4 <getchar+0x20>
+  if (r < 1)
+  8023ee:	74 06                	je     8023f6 <getchar+0x22>
+  return c;
+  8023f0:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8023f4:	c9                   	leave
+  8023f5:	c3                   	ret
+    return -E_EOF;
+  8023f6:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8023fb:	eb f7                	jmp    8023f4 <getchar+0x20>
+
+008023fd <iscons>:
+{
+  8023fd:	55                   	push   %ebp
+  8023fe:	89 e5                	mov    %esp,%ebp
+  802400:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802403:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802406:	50                   	push   %eax
+  802407:	ff 75 08             	push   0x8(%ebp)
+  80240a:	e8 d5 e6 ff ff       	call   800ae4 <fd_lookup>
+  80240f:	83 c4 10             	add    $0x10,%esp
+  802412:	85 c0                	test   %eax,%eax
+  802414:	78 11                	js     802427 <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  802416:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802419:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  80241f:	39 10                	cmp    %edx,(%eax)
+  802421:	0f 94 c0             	sete   %al
+  802424:	0f b6 c0             	movzbl %al,%eax
+}
+  802427:	c9                   	leave
+  802428:	c3                   	ret
+
+00802429 <opencons>:
+{
+  802429:	55                   	push   %ebp
+  80242a:	89 e5                	mov    %esp,%ebp
+  80242c:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  80242f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802432:	50                   	push   %eax
+  802433:	e8 56 e6 ff ff       	call   800a8e <fd_alloc>
+  802438:	83 c4 10             	add    $0x10,%esp
+  80243b:	85 c0                	test   %eax,%eax
+  80243d:	78 3a                	js     802479 <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80243f:	83 ec 04             	sub    $0x4,%esp
+  802442:	68 07 04 00 00       	push   $0x407
+  802447:	ff 75 f4             	push   -0xc(%ebp)
+  80244a:	6a 00                	push   $0x0
+  80244c:	e8 6a e1 ff ff       	call   8005bb <sys_page_alloc>
+  802451:	83 c4 10             	add    $0x10,%esp
+  802454:	85 c0                	test   %eax,%eax
+  802456:	78 21                	js     802479 <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  802458:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80245b:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802461:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  802463:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802466:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  80246d:	83 ec 0c             	sub    $0xc,%esp
+  802470:	50                   	push   %eax
+  802471:	e8 f4 e5 ff ff       	call   800a6a <fd2num>
+  802476:	83 c4 10             	add    $0x10,%esp
+}
+  802479:	c9                   	leave
+  80247a:	c3                   	ret
+
+0080247b <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80247b:	55                   	push   %ebp
+  80247c:	89 e5                	mov    %esp,%ebp
+  80247e:	56                   	push   %esi
+  80247f:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  802480:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  802483:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  802489:	e8 ac e0 ff ff       	call   80053a <sys_getenvid>
+  80248e:	83 ec 0c             	sub    $0xc,%esp
+  802491:	ff 75 0c             	push   0xc(%ebp)
+  802494:	ff 75 08             	push   0x8(%ebp)
+  802497:	56                   	push   %esi
+  802498:	50                   	push   %eax
+  802499:	68 60 30 80 00       	push   $0x803060
+  80249e:	e8 b3 00 00 00       	call   802556 <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  8024a3:	83 c4 18             	add    $0x18,%esp
+  8024a6:	53                   	push   %ebx
+  8024a7:	ff 75 10             	push   0x10(%ebp)
+  8024aa:	e8 56 00 00 00       	call   802505 <vcprintf>
+  cprintf("\n");
+  8024af:	c7 04 24 4c 30 80 00 	movl   $0x80304c,(%esp)
+  8024b6:	e8 9b 00 00 00       	call   802556 <cprintf>
+  8024bb:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  8024be:	cc                   	int3
+  while (1)
+  8024bf:	eb fd                	jmp    8024be <_panic+0x43>
+
+008024c1 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8024c1:	55                   	push   %ebp
+  8024c2:	89 e5                	mov    %esp,%ebp
+  8024c4:	53                   	push   %ebx
+  8024c5:	83 ec 04             	sub    $0x4,%esp
+  8024c8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  8024cb:	8b 13                	mov    (%ebx),%edx
+  8024cd:	8d 42 01             	lea    0x1(%edx),%eax
+  8024d0:	89 03                	mov    %eax,(%ebx)
+  8024d2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8024d5:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  8024d9:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8024de:	74 09                	je     8024e9 <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  8024e0:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8024e4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024e7:	c9                   	leave
+  8024e8:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  8024e9:	83 ec 08             	sub    $0x8,%esp
+  8024ec:	68 ff 00 00 00       	push   $0xff
+  8024f1:	8d 43 08             	lea    0x8(%ebx),%eax
+  8024f4:	50                   	push   %eax
+  8024f5:	e8 c2 df ff ff       	call   8004bc <sys_cputs>
+    b->idx = 0;
+  8024fa:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802500:	83 c4 10             	add    $0x10,%esp
+  802503:	eb db                	jmp    8024e0 <putch+0x1f>
+
+00802505 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  802505:	55                   	push   %ebp
+  802506:	89 e5                	mov    %esp,%ebp
+  802508:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  80250e:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  802515:	00 00 00 
+  b.cnt = 0;
+  802518:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80251f:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  802522:	ff 75 0c             	push   0xc(%ebp)
+  802525:	ff 75 08             	push   0x8(%ebp)
+  802528:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80252e:	50                   	push   %eax
+  80252f:	68 c1 24 80 00       	push   $0x8024c1
+  802534:	e8 14 01 00 00       	call   80264d <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  802539:	83 c4 08             	add    $0x8,%esp
+  80253c:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  802542:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  802548:	50                   	push   %eax
+  802549:	e8 6e df ff ff       	call   8004bc <sys_cputs>
+
+  return b.cnt;
+}
+  80254e:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  802554:	c9                   	leave
+  802555:	c3                   	ret
+
+00802556 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  802556:	55                   	push   %ebp
+  802557:	89 e5                	mov    %esp,%ebp
+  802559:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  80255c:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  80255f:	50                   	push   %eax
+  802560:	ff 75 08             	push   0x8(%ebp)
+  802563:	e8 9d ff ff ff       	call   802505 <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  802568:	c9                   	leave
+  802569:	c3                   	ret
+
+0080256a <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  80256a:	55                   	push   %ebp
+  80256b:	89 e5                	mov    %esp,%ebp
+  80256d:	57                   	push   %edi
+  80256e:	56                   	push   %esi
+  80256f:	53                   	push   %ebx
+  802570:	83 ec 1c             	sub    $0x1c,%esp
+  802573:	89 c7                	mov    %eax,%edi
+  802575:	89 d6                	mov    %edx,%esi
+  802577:	8b 45 08             	mov    0x8(%ebp),%eax
+  80257a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80257d:	89 d1                	mov    %edx,%ecx
+  80257f:	89 c2                	mov    %eax,%edx
+  802581:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802584:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802587:	8b 45 10             	mov    0x10(%ebp),%eax
+  80258a:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  80258d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802590:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802597:	39 c2                	cmp    %eax,%edx
+  802599:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80259c:	72 3e                	jb     8025dc <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  80259e:	83 ec 0c             	sub    $0xc,%esp
+  8025a1:	ff 75 18             	push   0x18(%ebp)
+  8025a4:	83 eb 01             	sub    $0x1,%ebx
+  8025a7:	53                   	push   %ebx
+  8025a8:	50                   	push   %eax
+  8025a9:	83 ec 08             	sub    $0x8,%esp
+  8025ac:	ff 75 e4             	push   -0x1c(%ebp)
+  8025af:	ff 75 e0             	push   -0x20(%ebp)
+  8025b2:	ff 75 dc             	push   -0x24(%ebp)
+  8025b5:	ff 75 d8             	push   -0x28(%ebp)
+  8025b8:	e8 b1 07 00 00       	call   802d6e <__udivdi3>
+  8025bd:	83 c4 18             	add    $0x18,%esp
+  8025c0:	52                   	push   %edx
+  8025c1:	50                   	push   %eax
+  8025c2:	89 f2                	mov    %esi,%edx
+  8025c4:	89 f8                	mov    %edi,%eax
+  8025c6:	e8 9f ff ff ff       	call   80256a <printnum>
+  8025cb:	83 c4 20             	add    $0x20,%esp
+  8025ce:	eb 13                	jmp    8025e3 <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  8025d0:	83 ec 08             	sub    $0x8,%esp
+  8025d3:	56                   	push   %esi
+  8025d4:	ff 75 18             	push   0x18(%ebp)
+  8025d7:	ff d7                	call   *%edi
+  8025d9:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  8025dc:	83 eb 01             	sub    $0x1,%ebx
+  8025df:	85 db                	test   %ebx,%ebx
+  8025e1:	7f ed                	jg     8025d0 <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  8025e3:	83 ec 08             	sub    $0x8,%esp
+  8025e6:	56                   	push   %esi
+  8025e7:	83 ec 04             	sub    $0x4,%esp
+  8025ea:	ff 75 e4             	push   -0x1c(%ebp)
+  8025ed:	ff 75 e0             	push   -0x20(%ebp)
+  8025f0:	ff 75 dc             	push   -0x24(%ebp)
+  8025f3:	ff 75 d8             	push   -0x28(%ebp)
+  8025f6:	e8 94 07 00 00       	call   802d8f <__umoddi3>
+  8025fb:	83 c4 14             	add    $0x14,%esp
+  8025fe:	0f be 80 83 30 80 00 	movsbl 0x803083(%eax),%eax
+  802605:	50                   	push   %eax
+  802606:	ff d7                	call   *%edi
+}
+  802608:	83 c4 10             	add    $0x10,%esp
+  80260b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80260e:	5b                   	pop    %ebx
+  80260f:	5e                   	pop    %esi
+  802610:	5f                   	pop    %edi
+  802611:	5d                   	pop    %ebp
+  802612:	c3                   	ret
+
+00802613 <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  802613:	55                   	push   %ebp
+  802614:	89 e5                	mov    %esp,%ebp
+  802616:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  802619:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  80261d:	8b 10                	mov    (%eax),%edx
+  80261f:	3b 50 04             	cmp    0x4(%eax),%edx
+  802622:	73 0a                	jae    80262e <sprintputch+0x1b>
+    *b->buf++ = ch;
+  802624:	8d 4a 01             	lea    0x1(%edx),%ecx
+  802627:	89 08                	mov    %ecx,(%eax)
+  802629:	8b 45 08             	mov    0x8(%ebp),%eax
+  80262c:	88 02                	mov    %al,(%edx)
+}
+  80262e:	5d                   	pop    %ebp
+  80262f:	c3                   	ret
+
+00802630 <printfmt>:
+{
+  802630:	55                   	push   %ebp
+  802631:	89 e5                	mov    %esp,%ebp
+  802633:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  802636:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  802639:	50                   	push   %eax
+  80263a:	ff 75 10             	push   0x10(%ebp)
+  80263d:	ff 75 0c             	push   0xc(%ebp)
+  802640:	ff 75 08             	push   0x8(%ebp)
+  802643:	e8 05 00 00 00       	call   80264d <vprintfmt>
+}
+  802648:	83 c4 10             	add    $0x10,%esp
+  80264b:	c9                   	leave
+  80264c:	c3                   	ret
+
+0080264d <vprintfmt>:
+{
+  80264d:	55                   	push   %ebp
+  80264e:	89 e5                	mov    %esp,%ebp
+  802650:	57                   	push   %edi
+  802651:	56                   	push   %esi
+  802652:	53                   	push   %ebx
+  802653:	83 ec 2c             	sub    $0x2c,%esp
+  802656:	8b 75 08             	mov    0x8(%ebp),%esi
+  802659:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80265c:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80265f:	eb 0a                	jmp    80266b <vprintfmt+0x1e>
+      putch(ch, putdat);
+  802661:	83 ec 08             	sub    $0x8,%esp
+  802664:	53                   	push   %ebx
+  802665:	50                   	push   %eax
+  802666:	ff d6                	call   *%esi
+  802668:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  80266b:	83 c7 01             	add    $0x1,%edi
+  80266e:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  802672:	83 f8 25             	cmp    $0x25,%eax
+  802675:	74 0c                	je     802683 <vprintfmt+0x36>
+      if (ch == '\0')
+  802677:	85 c0                	test   %eax,%eax
+  802679:	75 e6                	jne    802661 <vprintfmt+0x14>
+}
+  80267b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80267e:	5b                   	pop    %ebx
+  80267f:	5e                   	pop    %esi
+  802680:	5f                   	pop    %edi
+  802681:	5d                   	pop    %ebp
+  802682:	c3                   	ret
+    padc = ' ';
+  802683:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  802687:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  80268e:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  802695:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  80269c:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  8026a1:	8d 47 01             	lea    0x1(%edi),%eax
+  8026a4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8026a7:	0f b6 17             	movzbl (%edi),%edx
+  8026aa:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8026ad:	3c 55                	cmp    $0x55,%al
+  8026af:	0f 87 cf 03 00 00    	ja     802a84 <vprintfmt+0x437>
+  8026b5:	0f b6 c0             	movzbl %al,%eax
+  8026b8:	ff 24 85 c0 31 80 00 	jmp    *0x8031c0(,%eax,4)
+  8026bf:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  8026c2:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8026c6:	eb d9                	jmp    8026a1 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  8026c8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8026cb:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8026cf:	eb d0                	jmp    8026a1 <vprintfmt+0x54>
+  8026d1:	0f b6 d2             	movzbl %dl,%edx
+  8026d4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  8026d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026dc:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  8026df:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8026e2:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  8026e6:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  8026e9:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8026ec:	83 f9 09             	cmp    $0x9,%ecx
+  8026ef:	77 55                	ja     802746 <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  8026f1:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  8026f4:	eb e9                	jmp    8026df <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  8026f6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8026f9:	8b 00                	mov    (%eax),%eax
+  8026fb:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8026fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  802701:	8d 40 04             	lea    0x4(%eax),%eax
+  802704:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  802707:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  80270a:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80270e:	79 91                	jns    8026a1 <vprintfmt+0x54>
+        width = precision, precision = -1;
+  802710:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802713:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802716:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80271d:	eb 82                	jmp    8026a1 <vprintfmt+0x54>
+      if (width < 0)
+  80271f:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802722:	85 d2                	test   %edx,%edx
+  802724:	b8 00 00 00 00       	mov    $0x0,%eax
+  802729:	0f 49 c2             	cmovns %edx,%eax
+  80272c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  80272f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  802732:	e9 6a ff ff ff       	jmp    8026a1 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  802737:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  80273a:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  802741:	e9 5b ff ff ff       	jmp    8026a1 <vprintfmt+0x54>
+  802746:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802749:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80274c:	eb bc                	jmp    80270a <vprintfmt+0xbd>
+      lflag++;
+  80274e:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  802751:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  802754:	e9 48 ff ff ff       	jmp    8026a1 <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  802759:	8b 45 14             	mov    0x14(%ebp),%eax
+  80275c:	8d 78 04             	lea    0x4(%eax),%edi
+  80275f:	83 ec 08             	sub    $0x8,%esp
+  802762:	53                   	push   %ebx
+  802763:	ff 30                	push   (%eax)
+  802765:	ff d6                	call   *%esi
+      break;
+  802767:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  80276a:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  80276d:	e9 b1 02 00 00       	jmp    802a23 <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  802772:	8b 45 14             	mov    0x14(%ebp),%eax
+  802775:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  802778:	8b 10                	mov    (%eax),%edx
+  80277a:	89 d0                	mov    %edx,%eax
+  80277c:	f7 d8                	neg    %eax
+  80277e:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  802781:	83 f8 10             	cmp    $0x10,%eax
+  802784:	7f 23                	jg     8027a9 <vprintfmt+0x15c>
+  802786:	8b 14 85 20 33 80 00 	mov    0x803320(,%eax,4),%edx
+  80278d:	85 d2                	test   %edx,%edx
+  80278f:	74 18                	je     8027a9 <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  802791:	52                   	push   %edx
+  802792:	68 f6 2f 80 00       	push   $0x802ff6
+  802797:	53                   	push   %ebx
+  802798:	56                   	push   %esi
+  802799:	e8 92 fe ff ff       	call   802630 <printfmt>
+  80279e:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  8027a1:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8027a4:	e9 7a 02 00 00       	jmp    802a23 <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  8027a9:	50                   	push   %eax
+  8027aa:	68 9b 30 80 00       	push   $0x80309b
+  8027af:	53                   	push   %ebx
+  8027b0:	56                   	push   %esi
+  8027b1:	e8 7a fe ff ff       	call   802630 <printfmt>
+  8027b6:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  8027b9:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  8027bc:	e9 62 02 00 00       	jmp    802a23 <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  8027c1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8027c4:	83 c0 04             	add    $0x4,%eax
+  8027c7:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8027ca:	8b 45 14             	mov    0x14(%ebp),%eax
+  8027cd:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  8027cf:	85 c9                	test   %ecx,%ecx
+  8027d1:	b8 94 30 80 00       	mov    $0x803094,%eax
+  8027d6:	0f 45 c1             	cmovne %ecx,%eax
+  8027d9:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  8027dc:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8027e0:	7e 06                	jle    8027e8 <vprintfmt+0x19b>
+  8027e2:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8027e6:	75 0b                	jne    8027f3 <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8027e8:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8027eb:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8027ee:	89 75 08             	mov    %esi,0x8(%ebp)
+  8027f1:	eb 5c                	jmp    80284f <vprintfmt+0x202>
+  8027f3:	83 ec 08             	sub    $0x8,%esp
+  8027f6:	ff 75 d0             	push   -0x30(%ebp)
+  8027f9:	ff 75 cc             	push   -0x34(%ebp)
+  8027fc:	e8 68 d9 ff ff       	call   800169 <strnlen>
+  802801:	89 c2                	mov    %eax,%edx
+  802803:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802806:	29 d0                	sub    %edx,%eax
+  802808:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  80280b:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80280f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802812:	89 75 08             	mov    %esi,0x8(%ebp)
+  802815:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  802817:	eb 0e                	jmp    802827 <vprintfmt+0x1da>
+          putch(padc, putdat);
+  802819:	83 ec 08             	sub    $0x8,%esp
+  80281c:	53                   	push   %ebx
+  80281d:	57                   	push   %edi
+  80281e:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  802821:	83 ee 01             	sub    $0x1,%esi
+  802824:	83 c4 10             	add    $0x10,%esp
+  802827:	85 f6                	test   %esi,%esi
+  802829:	7f ee                	jg     802819 <vprintfmt+0x1cc>
+  80282b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80282e:	8b 75 08             	mov    0x8(%ebp),%esi
+  802831:	85 c0                	test   %eax,%eax
+  802833:	ba 00 00 00 00       	mov    $0x0,%edx
+  802838:	0f 49 d0             	cmovns %eax,%edx
+  80283b:	29 d0                	sub    %edx,%eax
+  80283d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802840:	eb a6                	jmp    8027e8 <vprintfmt+0x19b>
+          putch(ch, putdat);
+  802842:	83 ec 08             	sub    $0x8,%esp
+  802845:	53                   	push   %ebx
+  802846:	52                   	push   %edx
+  802847:	ff 55 08             	call   *0x8(%ebp)
+  80284a:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80284d:	89 f1                	mov    %esi,%ecx
+  80284f:	8d 71 01             	lea    0x1(%ecx),%esi
+  802852:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  802856:	0f be d0             	movsbl %al,%edx
+  802859:	85 d2                	test   %edx,%edx
+  80285b:	74 28                	je     802885 <vprintfmt+0x238>
+  80285d:	85 ff                	test   %edi,%edi
+  80285f:	78 05                	js     802866 <vprintfmt+0x219>
+  802861:	83 ef 01             	sub    $0x1,%edi
+  802864:	78 30                	js     802896 <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  802866:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80286a:	74 d6                	je     802842 <vprintfmt+0x1f5>
+  80286c:	0f be c0             	movsbl %al,%eax
+  80286f:	83 e8 20             	sub    $0x20,%eax
+  802872:	83 f8 5e             	cmp    $0x5e,%eax
+  802875:	76 cb                	jbe    802842 <vprintfmt+0x1f5>
+          putch('?', putdat);
+  802877:	83 ec 08             	sub    $0x8,%esp
+  80287a:	53                   	push   %ebx
+  80287b:	6a 3f                	push   $0x3f
+  80287d:	ff 55 08             	call   *0x8(%ebp)
+  802880:	83 c4 10             	add    $0x10,%esp
+  802883:	eb c8                	jmp    80284d <vprintfmt+0x200>
+  802885:	8b 75 08             	mov    0x8(%ebp),%esi
+  802888:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80288b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80288e:	01 d0                	add    %edx,%eax
+  802890:	29 c8                	sub    %ecx,%eax
+  802892:	89 c7                	mov    %eax,%edi
+  802894:	eb 13                	jmp    8028a9 <vprintfmt+0x25c>
+  802896:	8b 75 08             	mov    0x8(%ebp),%esi
+  802899:	eb ed                	jmp    802888 <vprintfmt+0x23b>
+        putch(' ', putdat);
+  80289b:	83 ec 08             	sub    $0x8,%esp
+  80289e:	53                   	push   %ebx
+  80289f:	6a 20                	push   $0x20
+  8028a1:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  8028a3:	83 ef 01             	sub    $0x1,%edi
+  8028a6:	83 c4 10             	add    $0x10,%esp
+  8028a9:	85 ff                	test   %edi,%edi
+  8028ab:	7f ee                	jg     80289b <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  8028ad:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8028b0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8028b3:	e9 6b 01 00 00       	jmp    802a23 <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  8028b8:	83 f9 01             	cmp    $0x1,%ecx
+  8028bb:	7f 1f                	jg     8028dc <vprintfmt+0x28f>
+  else if (lflag)
+  8028bd:	85 c9                	test   %ecx,%ecx
+  8028bf:	74 67                	je     802928 <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  8028c1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8028c4:	8b 00                	mov    (%eax),%eax
+  8028c6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8028c9:	89 c1                	mov    %eax,%ecx
+  8028cb:	c1 f9 1f             	sar    $0x1f,%ecx
+  8028ce:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8028d1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8028d4:	8d 40 04             	lea    0x4(%eax),%eax
+  8028d7:	89 45 14             	mov    %eax,0x14(%ebp)
+  8028da:	eb 17                	jmp    8028f3 <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  8028dc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8028df:	8b 50 04             	mov    0x4(%eax),%edx
+  8028e2:	8b 00                	mov    (%eax),%eax
+  8028e4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8028e7:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8028ea:	8b 45 14             	mov    0x14(%ebp),%eax
+  8028ed:	8d 40 08             	lea    0x8(%eax),%eax
+  8028f0:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  8028f3:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8028f6:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  8028f9:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  8028fe:	85 c9                	test   %ecx,%ecx
+  802900:	0f 89 03 01 00 00    	jns    802a09 <vprintfmt+0x3bc>
+        putch('-', putdat);
+  802906:	83 ec 08             	sub    $0x8,%esp
+  802909:	53                   	push   %ebx
+  80290a:	6a 2d                	push   $0x2d
+  80290c:	ff d6                	call   *%esi
+        num = -(long long)num;
+  80290e:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802911:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802914:	f7 da                	neg    %edx
+  802916:	83 d1 00             	adc    $0x0,%ecx
+  802919:	f7 d9                	neg    %ecx
+  80291b:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  80291e:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802923:	e9 e1 00 00 00       	jmp    802a09 <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  802928:	8b 45 14             	mov    0x14(%ebp),%eax
+  80292b:	8b 00                	mov    (%eax),%eax
+  80292d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802930:	89 c1                	mov    %eax,%ecx
+  802932:	c1 f9 1f             	sar    $0x1f,%ecx
+  802935:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802938:	8b 45 14             	mov    0x14(%ebp),%eax
+  80293b:	8d 40 04             	lea    0x4(%eax),%eax
+  80293e:	89 45 14             	mov    %eax,0x14(%ebp)
+  802941:	eb b0                	jmp    8028f3 <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  802943:	83 f9 01             	cmp    $0x1,%ecx
+  802946:	7f 1e                	jg     802966 <vprintfmt+0x319>
+  else if (lflag)
+  802948:	85 c9                	test   %ecx,%ecx
+  80294a:	74 32                	je     80297e <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  80294c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80294f:	8b 10                	mov    (%eax),%edx
+  802951:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802956:	8d 40 04             	lea    0x4(%eax),%eax
+  802959:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  80295c:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  802961:	e9 a3 00 00 00       	jmp    802a09 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  802966:	8b 45 14             	mov    0x14(%ebp),%eax
+  802969:	8b 10                	mov    (%eax),%edx
+  80296b:	8b 48 04             	mov    0x4(%eax),%ecx
+  80296e:	8d 40 08             	lea    0x8(%eax),%eax
+  802971:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  802974:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  802979:	e9 8b 00 00 00       	jmp    802a09 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  80297e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802981:	8b 10                	mov    (%eax),%edx
+  802983:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802988:	8d 40 04             	lea    0x4(%eax),%eax
+  80298b:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  80298e:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  802993:	eb 74                	jmp    802a09 <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  802995:	83 f9 01             	cmp    $0x1,%ecx
+  802998:	7f 1b                	jg     8029b5 <vprintfmt+0x368>
+  else if (lflag)
+  80299a:	85 c9                	test   %ecx,%ecx
+  80299c:	74 2c                	je     8029ca <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  80299e:	8b 45 14             	mov    0x14(%ebp),%eax
+  8029a1:	8b 10                	mov    (%eax),%edx
+  8029a3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8029a8:	8d 40 04             	lea    0x4(%eax),%eax
+  8029ab:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8029ae:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  8029b3:	eb 54                	jmp    802a09 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  8029b5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8029b8:	8b 10                	mov    (%eax),%edx
+  8029ba:	8b 48 04             	mov    0x4(%eax),%ecx
+  8029bd:	8d 40 08             	lea    0x8(%eax),%eax
+  8029c0:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8029c3:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  8029c8:	eb 3f                	jmp    802a09 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8029ca:	8b 45 14             	mov    0x14(%ebp),%eax
+  8029cd:	8b 10                	mov    (%eax),%edx
+  8029cf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8029d4:	8d 40 04             	lea    0x4(%eax),%eax
+  8029d7:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8029da:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  8029df:	eb 28                	jmp    802a09 <vprintfmt+0x3bc>
+      putch('0', putdat);
+  8029e1:	83 ec 08             	sub    $0x8,%esp
+  8029e4:	53                   	push   %ebx
+  8029e5:	6a 30                	push   $0x30
+  8029e7:	ff d6                	call   *%esi
+      putch('x', putdat);
+  8029e9:	83 c4 08             	add    $0x8,%esp
+  8029ec:	53                   	push   %ebx
+  8029ed:	6a 78                	push   $0x78
+  8029ef:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  8029f1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8029f4:	8b 10                	mov    (%eax),%edx
+  8029f6:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  8029fb:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  8029fe:	8d 40 04             	lea    0x4(%eax),%eax
+  802a01:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  802a04:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  802a09:	83 ec 0c             	sub    $0xc,%esp
+  802a0c:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  802a10:	50                   	push   %eax
+  802a11:	ff 75 e0             	push   -0x20(%ebp)
+  802a14:	57                   	push   %edi
+  802a15:	51                   	push   %ecx
+  802a16:	52                   	push   %edx
+  802a17:	89 da                	mov    %ebx,%edx
+  802a19:	89 f0                	mov    %esi,%eax
+  802a1b:	e8 4a fb ff ff       	call   80256a <printnum>
+      break;
+  802a20:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  802a23:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  802a26:	e9 40 fc ff ff       	jmp    80266b <vprintfmt+0x1e>
+  if (lflag >= 2)
+  802a2b:	83 f9 01             	cmp    $0x1,%ecx
+  802a2e:	7f 1b                	jg     802a4b <vprintfmt+0x3fe>
+  else if (lflag)
+  802a30:	85 c9                	test   %ecx,%ecx
+  802a32:	74 2c                	je     802a60 <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  802a34:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a37:	8b 10                	mov    (%eax),%edx
+  802a39:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a3e:	8d 40 04             	lea    0x4(%eax),%eax
+  802a41:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  802a44:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  802a49:	eb be                	jmp    802a09 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  802a4b:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a4e:	8b 10                	mov    (%eax),%edx
+  802a50:	8b 48 04             	mov    0x4(%eax),%ecx
+  802a53:	8d 40 08             	lea    0x8(%eax),%eax
+  802a56:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  802a59:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  802a5e:	eb a9                	jmp    802a09 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  802a60:	8b 45 14             	mov    0x14(%ebp),%eax
+  802a63:	8b 10                	mov    (%eax),%edx
+  802a65:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a6a:	8d 40 04             	lea    0x4(%eax),%eax
+  802a6d:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  802a70:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  802a75:	eb 92                	jmp    802a09 <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  802a77:	83 ec 08             	sub    $0x8,%esp
+  802a7a:	53                   	push   %ebx
+  802a7b:	6a 25                	push   $0x25
+  802a7d:	ff d6                	call   *%esi
+      break;
+  802a7f:	83 c4 10             	add    $0x10,%esp
+  802a82:	eb 9f                	jmp    802a23 <vprintfmt+0x3d6>
+      putch('%', putdat);
+  802a84:	83 ec 08             	sub    $0x8,%esp
+  802a87:	53                   	push   %ebx
+  802a88:	6a 25                	push   $0x25
+  802a8a:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  802a8c:	83 c4 10             	add    $0x10,%esp
+  802a8f:	89 f8                	mov    %edi,%eax
+  802a91:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  802a95:	74 05                	je     802a9c <vprintfmt+0x44f>
+  802a97:	83 e8 01             	sub    $0x1,%eax
+  802a9a:	eb f5                	jmp    802a91 <vprintfmt+0x444>
+  802a9c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802a9f:	eb 82                	jmp    802a23 <vprintfmt+0x3d6>
+
+00802aa1 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  802aa1:	55                   	push   %ebp
+  802aa2:	89 e5                	mov    %esp,%ebp
+  802aa4:	83 ec 18             	sub    $0x18,%esp
+  802aa7:	8b 45 08             	mov    0x8(%ebp),%eax
+  802aaa:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  802aad:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  802ab0:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  802ab4:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  802ab7:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  802abe:	85 c0                	test   %eax,%eax
+  802ac0:	74 26                	je     802ae8 <vsnprintf+0x47>
+  802ac2:	85 d2                	test   %edx,%edx
+  802ac4:	7e 22                	jle    802ae8 <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  802ac6:	ff 75 14             	push   0x14(%ebp)
+  802ac9:	ff 75 10             	push   0x10(%ebp)
+  802acc:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  802acf:	50                   	push   %eax
+  802ad0:	68 13 26 80 00       	push   $0x802613
+  802ad5:	e8 73 fb ff ff       	call   80264d <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  802ada:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  802add:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  802ae0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ae3:	83 c4 10             	add    $0x10,%esp
+}
+  802ae6:	c9                   	leave
+  802ae7:	c3                   	ret
+    return -E_INVAL;
+  802ae8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802aed:	eb f7                	jmp    802ae6 <vsnprintf+0x45>
+
+00802aef <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  802aef:	55                   	push   %ebp
+  802af0:	89 e5                	mov    %esp,%ebp
+  802af2:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  802af5:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  802af8:	50                   	push   %eax
+  802af9:	ff 75 10             	push   0x10(%ebp)
+  802afc:	ff 75 0c             	push   0xc(%ebp)
+  802aff:	ff 75 08             	push   0x8(%ebp)
+  802b02:	e8 9a ff ff ff       	call   802aa1 <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  802b07:	c9                   	leave
+  802b08:	c3                   	ret
+
+00802b09 <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  802b09:	55                   	push   %ebp
+  802b0a:	89 e5                	mov    %esp,%ebp
+  802b0c:	57                   	push   %edi
+  802b0d:	56                   	push   %esi
+  802b0e:	53                   	push   %ebx
+  802b0f:	83 ec 14             	sub    $0x14,%esp
+  802b12:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802b15:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b18:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802b1b:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  802b1e:	85 c0                	test   %eax,%eax
+  802b20:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802b25:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  802b28:	ff 33                	push   (%ebx)
+  802b2a:	50                   	push   %eax
+  802b2b:	e8 63 dd ff ff       	call   800893 <sys_ipc_recv>
+  802b30:	83 c4 10             	add    $0x10,%esp
+  802b33:	85 c0                	test   %eax,%eax
+  802b35:	78 39                	js     802b70 <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  802b37:	85 ff                	test   %edi,%edi
+  802b39:	74 0a                	je     802b45 <ipc_recv_pages+0x3c>
+  802b3b:	a1 44 57 80 00       	mov    0x805744,%eax
+  802b40:	8b 40 7c             	mov    0x7c(%eax),%eax
+  802b43:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  802b45:	85 f6                	test   %esi,%esi
+  802b47:	74 0d                	je     802b56 <ipc_recv_pages+0x4d>
+  802b49:	a1 44 57 80 00       	mov    0x805744,%eax
+  802b4e:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  802b54:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  802b56:	a1 44 57 80 00       	mov    0x805744,%eax
+  802b5b:	8b 40 74             	mov    0x74(%eax),%eax
+  802b5e:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  802b60:	a1 44 57 80 00       	mov    0x805744,%eax
+  802b65:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  802b68:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b6b:	5b                   	pop    %ebx
+  802b6c:	5e                   	pop    %esi
+  802b6d:	5f                   	pop    %edi
+  802b6e:	5d                   	pop    %ebp
+  802b6f:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  802b70:	85 ff                	test   %edi,%edi
+  802b72:	74 06                	je     802b7a <ipc_recv_pages+0x71>
+  802b74:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  802b7a:	85 f6                	test   %esi,%esi
+  802b7c:	74 06                	je     802b84 <ipc_recv_pages+0x7b>
+  802b7e:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  802b84:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  802b8a:	eb dc                	jmp    802b68 <ipc_recv_pages+0x5f>
+
+00802b8c <ipc_recv>:
+{
+  802b8c:	55                   	push   %ebp
+  802b8d:	89 e5                	mov    %esp,%ebp
+  802b8f:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  802b92:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  802b99:	ff 75 10             	push   0x10(%ebp)
+  802b9c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b9f:	50                   	push   %eax
+  802ba0:	ff 75 0c             	push   0xc(%ebp)
+  802ba3:	ff 75 08             	push   0x8(%ebp)
+  802ba6:	e8 5e ff ff ff       	call   802b09 <ipc_recv_pages>
+}
+  802bab:	c9                   	leave
+  802bac:	c3                   	ret
+
+00802bad <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  802bad:	55                   	push   %ebp
+  802bae:	89 e5                	mov    %esp,%ebp
+  802bb0:	57                   	push   %edi
+  802bb1:	56                   	push   %esi
+  802bb2:	53                   	push   %ebx
+  802bb3:	83 ec 0c             	sub    $0xc,%esp
+  802bb6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802bb9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802bbc:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  802bbf:	89 c3                	mov    %eax,%ebx
+  802bc1:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  802bc7:	85 c0                	test   %eax,%eax
+  802bc9:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802bce:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  802bd1:	83 ec 0c             	sub    $0xc,%esp
+  802bd4:	ff 75 14             	push   0x14(%ebp)
+  802bd7:	ff 75 18             	push   0x18(%ebp)
+  802bda:	53                   	push   %ebx
+  802bdb:	56                   	push   %esi
+  802bdc:	57                   	push   %edi
+  802bdd:	e8 90 dc ff ff       	call   800872 <sys_ipc_try_send>
+  802be2:	83 c4 20             	add    $0x20,%esp
+  802be5:	85 c0                	test   %eax,%eax
+  802be7:	79 1e                	jns    802c07 <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  802be9:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802bec:	75 07                	jne    802bf5 <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  802bee:	e8 66 d9 ff ff       	call   800559 <sys_yield>
+  802bf3:	eb dc                	jmp    802bd1 <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  802bf5:	50                   	push   %eax
+  802bf6:	68 83 33 80 00       	push   $0x803383
+  802bfb:	6a 5c                	push   $0x5c
+  802bfd:	68 90 33 80 00       	push   $0x803390
+  802c02:	e8 74 f8 ff ff       	call   80247b <_panic>
+  }
+}
+  802c07:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c0a:	5b                   	pop    %ebx
+  802c0b:	5e                   	pop    %esi
+  802c0c:	5f                   	pop    %edi
+  802c0d:	5d                   	pop    %ebp
+  802c0e:	c3                   	ret
+
+00802c0f <ipc_send>:
+{
+  802c0f:	55                   	push   %ebp
+  802c10:	89 e5                	mov    %esp,%ebp
+  802c12:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  802c15:	ff 75 14             	push   0x14(%ebp)
+  802c18:	6a 01                	push   $0x1
+  802c1a:	ff 75 10             	push   0x10(%ebp)
+  802c1d:	ff 75 0c             	push   0xc(%ebp)
+  802c20:	ff 75 08             	push   0x8(%ebp)
+  802c23:	e8 85 ff ff ff       	call   802bad <ipc_send_pages>
+}
+  802c28:	83 c4 20             	add    $0x20,%esp
+  802c2b:	c9                   	leave
+  802c2c:	c3                   	ret
+
+00802c2d <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802c2d:	55                   	push   %ebp
+  802c2e:	89 e5                	mov    %esp,%ebp
+  802c30:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  802c33:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  802c38:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802c3b:	c1 e0 04             	shl    $0x4,%eax
+  802c3e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802c43:	8b 40 50             	mov    0x50(%eax),%eax
+  802c46:	39 c8                	cmp    %ecx,%eax
+  802c48:	74 12                	je     802c5c <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  802c4a:	83 c2 01             	add    $0x1,%edx
+  802c4d:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802c53:	75 e3                	jne    802c38 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  802c55:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c5a:	eb 0e                	jmp    802c6a <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  802c5c:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802c5f:	c1 e0 04             	shl    $0x4,%eax
+  802c62:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802c67:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802c6a:	5d                   	pop    %ebp
+  802c6b:	c3                   	ret
+
+00802c6c <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802c6c:	55                   	push   %ebp
+  802c6d:	89 e5                	mov    %esp,%ebp
+  802c6f:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802c72:	89 c2                	mov    %eax,%edx
+  802c74:	c1 ea 16             	shr    $0x16,%edx
+  802c77:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  802c7e:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802c83:	f6 c1 01             	test   $0x1,%cl
+  802c86:	74 1c                	je     802ca4 <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  802c88:	c1 e8 0c             	shr    $0xc,%eax
+  802c8b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  802c92:	a8 01                	test   $0x1,%al
+  802c94:	74 0e                	je     802ca4 <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  802c96:	c1 e8 0c             	shr    $0xc,%eax
+  802c99:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802ca0:	ef 
+  802ca1:	0f b7 d2             	movzwl %dx,%edx
+}
+  802ca4:	89 d0                	mov    %edx,%eax
+  802ca6:	5d                   	pop    %ebp
+  802ca7:	c3                   	ret
+
+00802ca8 <udivmod>:
+  802ca8:	55                   	push   %ebp
+  802ca9:	57                   	push   %edi
+  802caa:	56                   	push   %esi
+  802cab:	53                   	push   %ebx
+  802cac:	83 ec 14             	sub    $0x14,%esp
+  802caf:	8b 74 24 28          	mov    0x28(%esp),%esi
+  802cb3:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  802cb7:	89 fb                	mov    %edi,%ebx
+  802cb9:	09 f3                	or     %esi,%ebx
+  802cbb:	0f 84 88 00 00 00    	je     802d49 <udivmod+0xa1>
+  802cc1:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802cc6:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802ccd:	00 
+  802cce:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802cd5:	00 
+  802cd6:	89 cd                	mov    %ecx,%ebp
+  802cd8:	89 34 24             	mov    %esi,(%esp)
+  802cdb:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802cdf:	eb 08                	jmp    802ce9 <udivmod+0x41>
+  802ce1:	83 ed 01             	sub    $0x1,%ebp
+  802ce4:	83 fd ff             	cmp    $0xffffffff,%ebp
+  802ce7:	74 6c                	je     802d55 <udivmod+0xad>
+  802ce9:	89 c3                	mov    %eax,%ebx
+  802ceb:	89 d6                	mov    %edx,%esi
+  802ced:	89 e9                	mov    %ebp,%ecx
+  802cef:	0f ad f3             	shrd   %cl,%esi,%ebx
+  802cf2:	d3 ee                	shr    %cl,%esi
+  802cf4:	f6 c1 20             	test   $0x20,%cl
+  802cf7:	74 04                	je     802cfd <udivmod+0x55>
+  802cf9:	89 f3                	mov    %esi,%ebx
+  802cfb:	31 f6                	xor    %esi,%esi
+  802cfd:	8b 3c 24             	mov    (%esp),%edi
+  802d00:	39 fb                	cmp    %edi,%ebx
+  802d02:	89 f7                	mov    %esi,%edi
+  802d04:	8b 1c 24             	mov    (%esp),%ebx
+  802d07:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802d0b:	19 f7                	sbb    %esi,%edi
+  802d0d:	72 d2                	jb     802ce1 <udivmod+0x39>
+  802d0f:	89 f7                	mov    %esi,%edi
+  802d11:	89 de                	mov    %ebx,%esi
+  802d13:	89 e9                	mov    %ebp,%ecx
+  802d15:	0f a5 f7             	shld   %cl,%esi,%edi
+  802d18:	d3 e6                	shl    %cl,%esi
+  802d1a:	f6 c1 20             	test   $0x20,%cl
+  802d1d:	74 04                	je     802d23 <udivmod+0x7b>
+  802d1f:	89 f7                	mov    %esi,%edi
+  802d21:	31 f6                	xor    %esi,%esi
+  802d23:	29 f0                	sub    %esi,%eax
+  802d25:	19 fa                	sbb    %edi,%edx
+  802d27:	be 01 00 00 00       	mov    $0x1,%esi
+  802d2c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d31:	0f a5 f7             	shld   %cl,%esi,%edi
+  802d34:	d3 e6                	shl    %cl,%esi
+  802d36:	f6 c1 20             	test   $0x20,%cl
+  802d39:	74 04                	je     802d3f <udivmod+0x97>
+  802d3b:	89 f7                	mov    %esi,%edi
+  802d3d:	31 f6                	xor    %esi,%esi
+  802d3f:	09 74 24 08          	or     %esi,0x8(%esp)
+  802d43:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802d47:	eb 98                	jmp    802ce1 <udivmod+0x39>
+  802d49:	89 f0                	mov    %esi,%eax
+  802d4b:	89 fa                	mov    %edi,%edx
+  802d4d:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802d51:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802d55:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802d59:	89 01                	mov    %eax,(%ecx)
+  802d5b:	89 51 04             	mov    %edx,0x4(%ecx)
+  802d5e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802d62:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802d66:	83 c4 14             	add    $0x14,%esp
+  802d69:	5b                   	pop    %ebx
+  802d6a:	5e                   	pop    %esi
+  802d6b:	5f                   	pop    %edi
+  802d6c:	5d                   	pop    %ebp
+  802d6d:	c3                   	ret
+
+00802d6e <__udivdi3>:
+  802d6e:	83 ec 18             	sub    $0x18,%esp
+  802d71:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802d75:	50                   	push   %eax
+  802d76:	ff 74 24 2c          	push   0x2c(%esp)
+  802d7a:	ff 74 24 2c          	push   0x2c(%esp)
+  802d7e:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802d82:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802d86:	e8 1d ff ff ff       	call   802ca8 <udivmod>
+  802d8b:	83 c4 24             	add    $0x24,%esp
+  802d8e:	c3                   	ret
+
+00802d8f <__umoddi3>:
+  802d8f:	83 ec 18             	sub    $0x18,%esp
+  802d92:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802d96:	50                   	push   %eax
+  802d97:	ff 74 24 2c          	push   0x2c(%esp)
+  802d9b:	ff 74 24 2c          	push   0x2c(%esp)
+  802d9f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802da3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802da7:	e8 fc fe ff ff       	call   802ca8 <udivmod>
+  802dac:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802db0:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802db4:	83 c4 24             	add    $0x24,%esp
+  802db7:	c3                   	ret
+
+00802db8 <__divdi3>:
+  802db8:	56                   	push   %esi
+  802db9:	53                   	push   %ebx
+  802dba:	83 ec 14             	sub    $0x14,%esp
+  802dbd:	8b 44 24 20          	mov    0x20(%esp),%eax
+  802dc1:	8b 54 24 24          	mov    0x24(%esp),%edx
+  802dc5:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  802dc9:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  802dcd:	85 d2                	test   %edx,%edx
+  802dcf:	78 18                	js     802de9 <__divdi3+0x31>
+  802dd1:	85 db                	test   %ebx,%ebx
+  802dd3:	78 3e                	js     802e13 <__divdi3+0x5b>
+  802dd5:	83 ec 04             	sub    $0x4,%esp
+  802dd8:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802ddc:	56                   	push   %esi
+  802ddd:	53                   	push   %ebx
+  802dde:	51                   	push   %ecx
+  802ddf:	e8 c4 fe ff ff       	call   802ca8 <udivmod>
+  802de4:	83 c4 10             	add    $0x10,%esp
+  802de7:	eb 24                	jmp    802e0d <__divdi3+0x55>
+  802de9:	f7 d8                	neg    %eax
+  802deb:	83 d2 00             	adc    $0x0,%edx
+  802dee:	f7 da                	neg    %edx
+  802df0:	85 db                	test   %ebx,%ebx
+  802df2:	78 3a                	js     802e2e <__divdi3+0x76>
+  802df4:	83 ec 04             	sub    $0x4,%esp
+  802df7:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802dfb:	56                   	push   %esi
+  802dfc:	53                   	push   %ebx
+  802dfd:	51                   	push   %ecx
+  802dfe:	e8 a5 fe ff ff       	call   802ca8 <udivmod>
+  802e03:	83 c4 10             	add    $0x10,%esp
+  802e06:	f7 d8                	neg    %eax
+  802e08:	83 d2 00             	adc    $0x0,%edx
+  802e0b:	f7 da                	neg    %edx
+  802e0d:	83 c4 14             	add    $0x14,%esp
+  802e10:	5b                   	pop    %ebx
+  802e11:	5e                   	pop    %esi
+  802e12:	c3                   	ret
+  802e13:	83 ec 04             	sub    $0x4,%esp
+  802e16:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802e1a:	56                   	push   %esi
+  802e1b:	f7 d9                	neg    %ecx
+  802e1d:	83 d3 00             	adc    $0x0,%ebx
+  802e20:	f7 db                	neg    %ebx
+  802e22:	53                   	push   %ebx
+  802e23:	51                   	push   %ecx
+  802e24:	e8 7f fe ff ff       	call   802ca8 <udivmod>
+  802e29:	83 c4 10             	add    $0x10,%esp
+  802e2c:	eb d8                	jmp    802e06 <__divdi3+0x4e>
+  802e2e:	83 ec 04             	sub    $0x4,%esp
+  802e31:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802e35:	56                   	push   %esi
+  802e36:	f7 d9                	neg    %ecx
+  802e38:	83 d3 00             	adc    $0x0,%ebx
+  802e3b:	f7 db                	neg    %ebx
+  802e3d:	53                   	push   %ebx
+  802e3e:	51                   	push   %ecx
+  802e3f:	e8 64 fe ff ff       	call   802ca8 <udivmod>
+  802e44:	83 c4 10             	add    $0x10,%esp
+  802e47:	eb c4                	jmp    802e0d <__divdi3+0x55>
+
+00802e49 <__moddi3>:
+  802e49:	55                   	push   %ebp
+  802e4a:	57                   	push   %edi
+  802e4b:	56                   	push   %esi
+  802e4c:	53                   	push   %ebx
+  802e4d:	83 ec 24             	sub    $0x24,%esp
+  802e50:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802e54:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802e58:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  802e5c:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  802e60:	85 d2                	test   %edx,%edx
+  802e62:	78 3b                	js     802e9f <__moddi3+0x56>
+  802e64:	83 ec 04             	sub    $0x4,%esp
+  802e67:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  802e6b:	56                   	push   %esi
+  802e6c:	89 ce                	mov    %ecx,%esi
+  802e6e:	f7 de                	neg    %esi
+  802e70:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802e74:	89 de                	mov    %ebx,%esi
+  802e76:	83 d6 00             	adc    $0x0,%esi
+  802e79:	f7 de                	neg    %esi
+  802e7b:	89 74 24 14          	mov    %esi,0x14(%esp)
+  802e7f:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802e83:	0f 48 f1             	cmovs  %ecx,%esi
+  802e86:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  802e8b:	53                   	push   %ebx
+  802e8c:	56                   	push   %esi
+  802e8d:	e8 16 fe ff ff       	call   802ca8 <udivmod>
+  802e92:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802e96:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802e9a:	83 c4 10             	add    $0x10,%esp
+  802e9d:	eb 47                	jmp    802ee6 <__moddi3+0x9d>
+  802e9f:	f7 d8                	neg    %eax
+  802ea1:	83 d2 00             	adc    $0x0,%edx
+  802ea4:	f7 da                	neg    %edx
+  802ea6:	83 ec 04             	sub    $0x4,%esp
+  802ea9:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  802ead:	56                   	push   %esi
+  802eae:	89 cf                	mov    %ecx,%edi
+  802eb0:	f7 df                	neg    %edi
+  802eb2:	89 de                	mov    %ebx,%esi
+  802eb4:	83 d6 00             	adc    $0x0,%esi
+  802eb7:	f7 de                	neg    %esi
+  802eb9:	0f 49 cf             	cmovns %edi,%ecx
+  802ebc:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802ec0:	0f 49 de             	cmovns %esi,%ebx
+  802ec3:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  802ec7:	ff 74 24 0c          	push   0xc(%esp)
+  802ecb:	ff 74 24 0c          	push   0xc(%esp)
+  802ecf:	e8 d4 fd ff ff       	call   802ca8 <udivmod>
+  802ed4:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802ed8:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802edc:	f7 d8                	neg    %eax
+  802ede:	83 d2 00             	adc    $0x0,%edx
+  802ee1:	f7 da                	neg    %edx
+  802ee3:	83 c4 10             	add    $0x10,%esp
+  802ee6:	83 c4 24             	add    $0x24,%esp
+  802ee9:	5b                   	pop    %ebx
+  802eea:	5e                   	pop    %esi
+  802eeb:	5f                   	pop    %edi
+  802eec:	5d                   	pop    %ebp
+  802eed:	c3                   	ret
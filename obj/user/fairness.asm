@@ -0,0 +1,6405 @@
+
+obj/user/fairness.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 70 00 00 00       	call   8000a1 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	83 ec 10             	sub    $0x10,%esp
+  envid_t who, id;
+
+  id = sys_getenvid();
+  80003b:	e8 ff 0a 00 00       	call   800b3f <sys_getenvid>
+  800040:	89 c3                	mov    %eax,%ebx
+
+  if (thisenv == &envs[1]) {
+  800042:	81 3d 44 57 80 00 90 	cmpl   $0xeec00090,0x805744
+  800049:	00 c0 ee 
+  80004c:	74 2d                	je     80007b <umain+0x48>
+    while (1) {
+      ipc_recv(&who, 0, 0);
+      cprintf("%x recv from %x\n", id, who);
+    }
+  } else {
+    cprintf("%x loop sending to %x\n", id, envs[1].env_id);
+  80004e:	a1 d8 00 c0 ee       	mov    0xeec000d8,%eax
+  800053:	83 ec 04             	sub    $0x4,%esp
+  800056:	50                   	push   %eax
+  800057:	53                   	push   %ebx
+  800058:	68 d1 2e 80 00       	push   $0x802ed1
+  80005d:	e8 41 01 00 00       	call   8001a3 <cprintf>
+  800062:	83 c4 10             	add    $0x10,%esp
+    while (1)
+      ipc_send(envs[1].env_id, 0, 0, 0);
+  800065:	a1 d8 00 c0 ee       	mov    0xeec000d8,%eax
+  80006a:	6a 00                	push   $0x0
+  80006c:	6a 00                	push   $0x0
+  80006e:	6a 00                	push   $0x0
+  800070:	50                   	push   %eax
+  800071:	e8 ff 10 00 00       	call   801175 <ipc_send>
+  800076:	83 c4 10             	add    $0x10,%esp
+  800079:	eb ea                	jmp    800065 <umain+0x32>
+      ipc_recv(&who, 0, 0);
+  80007b:	8d 75 f4             	lea    -0xc(%ebp),%esi
+  80007e:	83 ec 04             	sub    $0x4,%esp
+  800081:	6a 00                	push   $0x0
+  800083:	6a 00                	push   $0x0
+  800085:	56                   	push   %esi
+  800086:	e8 67 10 00 00       	call   8010f2 <ipc_recv>
+      cprintf("%x recv from %x\n", id, who);
+  80008b:	83 c4 0c             	add    $0xc,%esp
+  80008e:	ff 75 f4             	push   -0xc(%ebp)
+  800091:	53                   	push   %ebx
+  800092:	68 c0 2e 80 00       	push   $0x802ec0
+  800097:	e8 07 01 00 00       	call   8001a3 <cprintf>
+  80009c:	83 c4 10             	add    $0x10,%esp
+  80009f:	eb dd                	jmp    80007e <umain+0x4b>
+
+008000a1 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000a1:	55                   	push   %ebp
+  8000a2:	89 e5                	mov    %esp,%ebp
+  8000a4:	56                   	push   %esi
+  8000a5:	53                   	push   %ebx
+  8000a6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000a9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  8000ac:	c7 05 44 57 80 00 00 	movl   $0x0,0x805744
+  8000b3:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  8000b6:	e8 84 0a 00 00       	call   800b3f <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  8000bb:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000c0:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8000c3:	c1 e0 04             	shl    $0x4,%eax
+  8000c6:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000cb:	a3 44 57 80 00       	mov    %eax,0x805744
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8000d0:	85 db                	test   %ebx,%ebx
+  8000d2:	7e 07                	jle    8000db <libmain+0x3a>
+    binaryname = argv[0];
+  8000d4:	8b 06                	mov    (%esi),%eax
+  8000d6:	a3 00 40 80 00       	mov    %eax,0x804000
+
+  // call user main routine
+  umain(argc, argv);
+  8000db:	83 ec 08             	sub    $0x8,%esp
+  8000de:	56                   	push   %esi
+  8000df:	53                   	push   %ebx
+  8000e0:	e8 4e ff ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  8000e5:	e8 0a 00 00 00       	call   8000f4 <exit>
+}
+  8000ea:	83 c4 10             	add    $0x10,%esp
+  8000ed:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000f0:	5b                   	pop    %ebx
+  8000f1:	5e                   	pop    %esi
+  8000f2:	5d                   	pop    %ebp
+  8000f3:	c3                   	ret
+
+008000f4 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000f4:	55                   	push   %ebp
+  8000f5:	89 e5                	mov    %esp,%ebp
+  8000f7:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  8000fa:	e8 9d 12 00 00       	call   80139c <close_all>
+  sys_env_destroy(0);
+  8000ff:	83 ec 0c             	sub    $0xc,%esp
+  800102:	6a 00                	push   $0x0
+  800104:	e8 f5 09 00 00       	call   800afe <sys_env_destroy>
+}
+  800109:	83 c4 10             	add    $0x10,%esp
+  80010c:	c9                   	leave
+  80010d:	c3                   	ret
+
+0080010e <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80010e:	55                   	push   %ebp
+  80010f:	89 e5                	mov    %esp,%ebp
+  800111:	53                   	push   %ebx
+  800112:	83 ec 04             	sub    $0x4,%esp
+  800115:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  800118:	8b 13                	mov    (%ebx),%edx
+  80011a:	8d 42 01             	lea    0x1(%edx),%eax
+  80011d:	89 03                	mov    %eax,(%ebx)
+  80011f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800122:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  800126:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80012b:	74 09                	je     800136 <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  80012d:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800131:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800134:	c9                   	leave
+  800135:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  800136:	83 ec 08             	sub    $0x8,%esp
+  800139:	68 ff 00 00 00       	push   $0xff
+  80013e:	8d 43 08             	lea    0x8(%ebx),%eax
+  800141:	50                   	push   %eax
+  800142:	e8 7a 09 00 00       	call   800ac1 <sys_cputs>
+    b->idx = 0;
+  800147:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80014d:	83 c4 10             	add    $0x10,%esp
+  800150:	eb db                	jmp    80012d <putch+0x1f>
+
+00800152 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800152:	55                   	push   %ebp
+  800153:	89 e5                	mov    %esp,%ebp
+  800155:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  80015b:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800162:	00 00 00 
+  b.cnt = 0;
+  800165:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80016c:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  80016f:	ff 75 0c             	push   0xc(%ebp)
+  800172:	ff 75 08             	push   0x8(%ebp)
+  800175:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80017b:	50                   	push   %eax
+  80017c:	68 0e 01 80 00       	push   $0x80010e
+  800181:	e8 14 01 00 00       	call   80029a <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  800186:	83 c4 08             	add    $0x8,%esp
+  800189:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80018f:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800195:	50                   	push   %eax
+  800196:	e8 26 09 00 00       	call   800ac1 <sys_cputs>
+
+  return b.cnt;
+}
+  80019b:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001a1:	c9                   	leave
+  8001a2:	c3                   	ret
+
+008001a3 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8001a3:	55                   	push   %ebp
+  8001a4:	89 e5                	mov    %esp,%ebp
+  8001a6:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  8001a9:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  8001ac:	50                   	push   %eax
+  8001ad:	ff 75 08             	push   0x8(%ebp)
+  8001b0:	e8 9d ff ff ff       	call   800152 <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  8001b5:	c9                   	leave
+  8001b6:	c3                   	ret
+
+008001b7 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  8001b7:	55                   	push   %ebp
+  8001b8:	89 e5                	mov    %esp,%ebp
+  8001ba:	57                   	push   %edi
+  8001bb:	56                   	push   %esi
+  8001bc:	53                   	push   %ebx
+  8001bd:	83 ec 1c             	sub    $0x1c,%esp
+  8001c0:	89 c7                	mov    %eax,%edi
+  8001c2:	89 d6                	mov    %edx,%esi
+  8001c4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001c7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8001ca:	89 d1                	mov    %edx,%ecx
+  8001cc:	89 c2                	mov    %eax,%edx
+  8001ce:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001d1:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001d4:	8b 45 10             	mov    0x10(%ebp),%eax
+  8001d7:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  8001da:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001dd:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8001e4:	39 c2                	cmp    %eax,%edx
+  8001e6:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8001e9:	72 3e                	jb     800229 <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  8001eb:	83 ec 0c             	sub    $0xc,%esp
+  8001ee:	ff 75 18             	push   0x18(%ebp)
+  8001f1:	83 eb 01             	sub    $0x1,%ebx
+  8001f4:	53                   	push   %ebx
+  8001f5:	50                   	push   %eax
+  8001f6:	83 ec 08             	sub    $0x8,%esp
+  8001f9:	ff 75 e4             	push   -0x1c(%ebp)
+  8001fc:	ff 75 e0             	push   -0x20(%ebp)
+  8001ff:	ff 75 dc             	push   -0x24(%ebp)
+  800202:	ff 75 d8             	push   -0x28(%ebp)
+  800205:	e8 21 2b 00 00       	call   802d2b <__udivdi3>
+  80020a:	83 c4 18             	add    $0x18,%esp
+  80020d:	52                   	push   %edx
+  80020e:	50                   	push   %eax
+  80020f:	89 f2                	mov    %esi,%edx
+  800211:	89 f8                	mov    %edi,%eax
+  800213:	e8 9f ff ff ff       	call   8001b7 <printnum>
+  800218:	83 c4 20             	add    $0x20,%esp
+  80021b:	eb 13                	jmp    800230 <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  80021d:	83 ec 08             	sub    $0x8,%esp
+  800220:	56                   	push   %esi
+  800221:	ff 75 18             	push   0x18(%ebp)
+  800224:	ff d7                	call   *%edi
+  800226:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  800229:	83 eb 01             	sub    $0x1,%ebx
+  80022c:	85 db                	test   %ebx,%ebx
+  80022e:	7f ed                	jg     80021d <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  800230:	83 ec 08             	sub    $0x8,%esp
+  800233:	56                   	push   %esi
+  800234:	83 ec 04             	sub    $0x4,%esp
+  800237:	ff 75 e4             	push   -0x1c(%ebp)
+  80023a:	ff 75 e0             	push   -0x20(%ebp)
+  80023d:	ff 75 dc             	push   -0x24(%ebp)
+  800240:	ff 75 d8             	push   -0x28(%ebp)
+  800243:	e8 04 2b 00 00       	call   802d4c <__umoddi3>
+  800248:	83 c4 14             	add    $0x14,%esp
+  80024b:	0f be 80 f2 2e 80 00 	movsbl 0x802ef2(%eax),%eax
+  800252:	50                   	push   %eax
+  800253:	ff d7                	call   *%edi
+}
+  800255:	83 c4 10             	add    $0x10,%esp
+  800258:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80025b:	5b                   	pop    %ebx
+  80025c:	5e                   	pop    %esi
+  80025d:	5f                   	pop    %edi
+  80025e:	5d                   	pop    %ebp
+  80025f:	c3                   	ret
+
+00800260 <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800260:	55                   	push   %ebp
+  800261:	89 e5                	mov    %esp,%ebp
+  800263:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  800266:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  80026a:	8b 10                	mov    (%eax),%edx
+  80026c:	3b 50 04             	cmp    0x4(%eax),%edx
+  80026f:	73 0a                	jae    80027b <sprintputch+0x1b>
+    *b->buf++ = ch;
+  800271:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800274:	89 08                	mov    %ecx,(%eax)
+  800276:	8b 45 08             	mov    0x8(%ebp),%eax
+  800279:	88 02                	mov    %al,(%edx)
+}
+  80027b:	5d                   	pop    %ebp
+  80027c:	c3                   	ret
+
+0080027d <printfmt>:
+{
+  80027d:	55                   	push   %ebp
+  80027e:	89 e5                	mov    %esp,%ebp
+  800280:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  800283:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  800286:	50                   	push   %eax
+  800287:	ff 75 10             	push   0x10(%ebp)
+  80028a:	ff 75 0c             	push   0xc(%ebp)
+  80028d:	ff 75 08             	push   0x8(%ebp)
+  800290:	e8 05 00 00 00       	call   80029a <vprintfmt>
+}
+  800295:	83 c4 10             	add    $0x10,%esp
+  800298:	c9                   	leave
+  800299:	c3                   	ret
+
+0080029a <vprintfmt>:
+{
+  80029a:	55                   	push   %ebp
+  80029b:	89 e5                	mov    %esp,%ebp
+  80029d:	57                   	push   %edi
+  80029e:	56                   	push   %esi
+  80029f:	53                   	push   %ebx
+  8002a0:	83 ec 2c             	sub    $0x2c,%esp
+  8002a3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8002a6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8002a9:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8002ac:	eb 0a                	jmp    8002b8 <vprintfmt+0x1e>
+      putch(ch, putdat);
+  8002ae:	83 ec 08             	sub    $0x8,%esp
+  8002b1:	53                   	push   %ebx
+  8002b2:	50                   	push   %eax
+  8002b3:	ff d6                	call   *%esi
+  8002b5:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  8002b8:	83 c7 01             	add    $0x1,%edi
+  8002bb:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8002bf:	83 f8 25             	cmp    $0x25,%eax
+  8002c2:	74 0c                	je     8002d0 <vprintfmt+0x36>
+      if (ch == '\0')
+  8002c4:	85 c0                	test   %eax,%eax
+  8002c6:	75 e6                	jne    8002ae <vprintfmt+0x14>
+}
+  8002c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002cb:	5b                   	pop    %ebx
+  8002cc:	5e                   	pop    %esi
+  8002cd:	5f                   	pop    %edi
+  8002ce:	5d                   	pop    %ebp
+  8002cf:	c3                   	ret
+    padc = ' ';
+  8002d0:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  8002d4:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  8002db:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  8002e2:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  8002e9:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  8002ee:	8d 47 01             	lea    0x1(%edi),%eax
+  8002f1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8002f4:	0f b6 17             	movzbl (%edi),%edx
+  8002f7:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8002fa:	3c 55                	cmp    $0x55,%al
+  8002fc:	0f 87 cf 03 00 00    	ja     8006d1 <vprintfmt+0x437>
+  800302:	0f b6 c0             	movzbl %al,%eax
+  800305:	ff 24 85 40 30 80 00 	jmp    *0x803040(,%eax,4)
+  80030c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  80030f:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800313:	eb d9                	jmp    8002ee <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  800315:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800318:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80031c:	eb d0                	jmp    8002ee <vprintfmt+0x54>
+  80031e:	0f b6 d2             	movzbl %dl,%edx
+  800321:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  800324:	b8 00 00 00 00       	mov    $0x0,%eax
+  800329:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  80032c:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80032f:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  800333:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  800336:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800339:	83 f9 09             	cmp    $0x9,%ecx
+  80033c:	77 55                	ja     800393 <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  80033e:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  800341:	eb e9                	jmp    80032c <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  800343:	8b 45 14             	mov    0x14(%ebp),%eax
+  800346:	8b 00                	mov    (%eax),%eax
+  800348:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80034b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80034e:	8d 40 04             	lea    0x4(%eax),%eax
+  800351:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  800354:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  800357:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80035b:	79 91                	jns    8002ee <vprintfmt+0x54>
+        width = precision, precision = -1;
+  80035d:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800360:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800363:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80036a:	eb 82                	jmp    8002ee <vprintfmt+0x54>
+      if (width < 0)
+  80036c:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80036f:	85 d2                	test   %edx,%edx
+  800371:	b8 00 00 00 00       	mov    $0x0,%eax
+  800376:	0f 49 c2             	cmovns %edx,%eax
+  800379:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  80037c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  80037f:	e9 6a ff ff ff       	jmp    8002ee <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  800384:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  800387:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  80038e:	e9 5b ff ff ff       	jmp    8002ee <vprintfmt+0x54>
+  800393:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800396:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800399:	eb bc                	jmp    800357 <vprintfmt+0xbd>
+      lflag++;
+  80039b:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  80039e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  8003a1:	e9 48 ff ff ff       	jmp    8002ee <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  8003a6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003a9:	8d 78 04             	lea    0x4(%eax),%edi
+  8003ac:	83 ec 08             	sub    $0x8,%esp
+  8003af:	53                   	push   %ebx
+  8003b0:	ff 30                	push   (%eax)
+  8003b2:	ff d6                	call   *%esi
+      break;
+  8003b4:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  8003b7:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  8003ba:	e9 b1 02 00 00       	jmp    800670 <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  8003bf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003c2:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  8003c5:	8b 10                	mov    (%eax),%edx
+  8003c7:	89 d0                	mov    %edx,%eax
+  8003c9:	f7 d8                	neg    %eax
+  8003cb:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8003ce:	83 f8 10             	cmp    $0x10,%eax
+  8003d1:	7f 23                	jg     8003f6 <vprintfmt+0x15c>
+  8003d3:	8b 14 85 a0 31 80 00 	mov    0x8031a0(,%eax,4),%edx
+  8003da:	85 d2                	test   %edx,%edx
+  8003dc:	74 18                	je     8003f6 <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  8003de:	52                   	push   %edx
+  8003df:	68 02 33 80 00       	push   $0x803302
+  8003e4:	53                   	push   %ebx
+  8003e5:	56                   	push   %esi
+  8003e6:	e8 92 fe ff ff       	call   80027d <printfmt>
+  8003eb:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  8003ee:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8003f1:	e9 7a 02 00 00       	jmp    800670 <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  8003f6:	50                   	push   %eax
+  8003f7:	68 0a 2f 80 00       	push   $0x802f0a
+  8003fc:	53                   	push   %ebx
+  8003fd:	56                   	push   %esi
+  8003fe:	e8 7a fe ff ff       	call   80027d <printfmt>
+  800403:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  800406:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  800409:	e9 62 02 00 00       	jmp    800670 <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  80040e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800411:	83 c0 04             	add    $0x4,%eax
+  800414:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800417:	8b 45 14             	mov    0x14(%ebp),%eax
+  80041a:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  80041c:	85 c9                	test   %ecx,%ecx
+  80041e:	b8 03 2f 80 00       	mov    $0x802f03,%eax
+  800423:	0f 45 c1             	cmovne %ecx,%eax
+  800426:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  800429:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80042d:	7e 06                	jle    800435 <vprintfmt+0x19b>
+  80042f:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800433:	75 0b                	jne    800440 <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800435:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800438:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80043b:	89 75 08             	mov    %esi,0x8(%ebp)
+  80043e:	eb 5c                	jmp    80049c <vprintfmt+0x202>
+  800440:	83 ec 08             	sub    $0x8,%esp
+  800443:	ff 75 d0             	push   -0x30(%ebp)
+  800446:	ff 75 cc             	push   -0x34(%ebp)
+  800449:	e8 20 03 00 00       	call   80076e <strnlen>
+  80044e:	89 c2                	mov    %eax,%edx
+  800450:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800453:	29 d0                	sub    %edx,%eax
+  800455:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  800458:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80045c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80045f:	89 75 08             	mov    %esi,0x8(%ebp)
+  800462:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800464:	eb 0e                	jmp    800474 <vprintfmt+0x1da>
+          putch(padc, putdat);
+  800466:	83 ec 08             	sub    $0x8,%esp
+  800469:	53                   	push   %ebx
+  80046a:	57                   	push   %edi
+  80046b:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  80046e:	83 ee 01             	sub    $0x1,%esi
+  800471:	83 c4 10             	add    $0x10,%esp
+  800474:	85 f6                	test   %esi,%esi
+  800476:	7f ee                	jg     800466 <vprintfmt+0x1cc>
+  800478:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80047b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80047e:	85 c0                	test   %eax,%eax
+  800480:	ba 00 00 00 00       	mov    $0x0,%edx
+  800485:	0f 49 d0             	cmovns %eax,%edx
+  800488:	29 d0                	sub    %edx,%eax
+  80048a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80048d:	eb a6                	jmp    800435 <vprintfmt+0x19b>
+          putch(ch, putdat);
+  80048f:	83 ec 08             	sub    $0x8,%esp
+  800492:	53                   	push   %ebx
+  800493:	52                   	push   %edx
+  800494:	ff 55 08             	call   *0x8(%ebp)
+  800497:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80049a:	89 f1                	mov    %esi,%ecx
+  80049c:	8d 71 01             	lea    0x1(%ecx),%esi
+  80049f:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004a3:	0f be d0             	movsbl %al,%edx
+  8004a6:	85 d2                	test   %edx,%edx
+  8004a8:	74 28                	je     8004d2 <vprintfmt+0x238>
+  8004aa:	85 ff                	test   %edi,%edi
+  8004ac:	78 05                	js     8004b3 <vprintfmt+0x219>
+  8004ae:	83 ef 01             	sub    $0x1,%edi
+  8004b1:	78 30                	js     8004e3 <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  8004b3:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8004b7:	74 d6                	je     80048f <vprintfmt+0x1f5>
+  8004b9:	0f be c0             	movsbl %al,%eax
+  8004bc:	83 e8 20             	sub    $0x20,%eax
+  8004bf:	83 f8 5e             	cmp    $0x5e,%eax
+  8004c2:	76 cb                	jbe    80048f <vprintfmt+0x1f5>
+          putch('?', putdat);
+  8004c4:	83 ec 08             	sub    $0x8,%esp
+  8004c7:	53                   	push   %ebx
+  8004c8:	6a 3f                	push   $0x3f
+  8004ca:	ff 55 08             	call   *0x8(%ebp)
+  8004cd:	83 c4 10             	add    $0x10,%esp
+  8004d0:	eb c8                	jmp    80049a <vprintfmt+0x200>
+  8004d2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004d5:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8004d8:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004db:	01 d0                	add    %edx,%eax
+  8004dd:	29 c8                	sub    %ecx,%eax
+  8004df:	89 c7                	mov    %eax,%edi
+  8004e1:	eb 13                	jmp    8004f6 <vprintfmt+0x25c>
+  8004e3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004e6:	eb ed                	jmp    8004d5 <vprintfmt+0x23b>
+        putch(' ', putdat);
+  8004e8:	83 ec 08             	sub    $0x8,%esp
+  8004eb:	53                   	push   %ebx
+  8004ec:	6a 20                	push   $0x20
+  8004ee:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  8004f0:	83 ef 01             	sub    $0x1,%edi
+  8004f3:	83 c4 10             	add    $0x10,%esp
+  8004f6:	85 ff                	test   %edi,%edi
+  8004f8:	7f ee                	jg     8004e8 <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  8004fa:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8004fd:	89 45 14             	mov    %eax,0x14(%ebp)
+  800500:	e9 6b 01 00 00       	jmp    800670 <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  800505:	83 f9 01             	cmp    $0x1,%ecx
+  800508:	7f 1f                	jg     800529 <vprintfmt+0x28f>
+  else if (lflag)
+  80050a:	85 c9                	test   %ecx,%ecx
+  80050c:	74 67                	je     800575 <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  80050e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800511:	8b 00                	mov    (%eax),%eax
+  800513:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800516:	89 c1                	mov    %eax,%ecx
+  800518:	c1 f9 1f             	sar    $0x1f,%ecx
+  80051b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80051e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800521:	8d 40 04             	lea    0x4(%eax),%eax
+  800524:	89 45 14             	mov    %eax,0x14(%ebp)
+  800527:	eb 17                	jmp    800540 <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  800529:	8b 45 14             	mov    0x14(%ebp),%eax
+  80052c:	8b 50 04             	mov    0x4(%eax),%edx
+  80052f:	8b 00                	mov    (%eax),%eax
+  800531:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800534:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800537:	8b 45 14             	mov    0x14(%ebp),%eax
+  80053a:	8d 40 08             	lea    0x8(%eax),%eax
+  80053d:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  800540:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800543:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  800546:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  80054b:	85 c9                	test   %ecx,%ecx
+  80054d:	0f 89 03 01 00 00    	jns    800656 <vprintfmt+0x3bc>
+        putch('-', putdat);
+  800553:	83 ec 08             	sub    $0x8,%esp
+  800556:	53                   	push   %ebx
+  800557:	6a 2d                	push   $0x2d
+  800559:	ff d6                	call   *%esi
+        num = -(long long)num;
+  80055b:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80055e:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800561:	f7 da                	neg    %edx
+  800563:	83 d1 00             	adc    $0x0,%ecx
+  800566:	f7 d9                	neg    %ecx
+  800568:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  80056b:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800570:	e9 e1 00 00 00       	jmp    800656 <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  800575:	8b 45 14             	mov    0x14(%ebp),%eax
+  800578:	8b 00                	mov    (%eax),%eax
+  80057a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80057d:	89 c1                	mov    %eax,%ecx
+  80057f:	c1 f9 1f             	sar    $0x1f,%ecx
+  800582:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800585:	8b 45 14             	mov    0x14(%ebp),%eax
+  800588:	8d 40 04             	lea    0x4(%eax),%eax
+  80058b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80058e:	eb b0                	jmp    800540 <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  800590:	83 f9 01             	cmp    $0x1,%ecx
+  800593:	7f 1e                	jg     8005b3 <vprintfmt+0x319>
+  else if (lflag)
+  800595:	85 c9                	test   %ecx,%ecx
+  800597:	74 32                	je     8005cb <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  800599:	8b 45 14             	mov    0x14(%ebp),%eax
+  80059c:	8b 10                	mov    (%eax),%edx
+  80059e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005a3:	8d 40 04             	lea    0x4(%eax),%eax
+  8005a6:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  8005a9:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  8005ae:	e9 a3 00 00 00       	jmp    800656 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  8005b3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b6:	8b 10                	mov    (%eax),%edx
+  8005b8:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005bb:	8d 40 08             	lea    0x8(%eax),%eax
+  8005be:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  8005c1:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  8005c6:	e9 8b 00 00 00       	jmp    800656 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8005cb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ce:	8b 10                	mov    (%eax),%edx
+  8005d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005d5:	8d 40 04             	lea    0x4(%eax),%eax
+  8005d8:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  8005db:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  8005e0:	eb 74                	jmp    800656 <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  8005e2:	83 f9 01             	cmp    $0x1,%ecx
+  8005e5:	7f 1b                	jg     800602 <vprintfmt+0x368>
+  else if (lflag)
+  8005e7:	85 c9                	test   %ecx,%ecx
+  8005e9:	74 2c                	je     800617 <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  8005eb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ee:	8b 10                	mov    (%eax),%edx
+  8005f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005f5:	8d 40 04             	lea    0x4(%eax),%eax
+  8005f8:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8005fb:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  800600:	eb 54                	jmp    800656 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800602:	8b 45 14             	mov    0x14(%ebp),%eax
+  800605:	8b 10                	mov    (%eax),%edx
+  800607:	8b 48 04             	mov    0x4(%eax),%ecx
+  80060a:	8d 40 08             	lea    0x8(%eax),%eax
+  80060d:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800610:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  800615:	eb 3f                	jmp    800656 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800617:	8b 45 14             	mov    0x14(%ebp),%eax
+  80061a:	8b 10                	mov    (%eax),%edx
+  80061c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800621:	8d 40 04             	lea    0x4(%eax),%eax
+  800624:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800627:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  80062c:	eb 28                	jmp    800656 <vprintfmt+0x3bc>
+      putch('0', putdat);
+  80062e:	83 ec 08             	sub    $0x8,%esp
+  800631:	53                   	push   %ebx
+  800632:	6a 30                	push   $0x30
+  800634:	ff d6                	call   *%esi
+      putch('x', putdat);
+  800636:	83 c4 08             	add    $0x8,%esp
+  800639:	53                   	push   %ebx
+  80063a:	6a 78                	push   $0x78
+  80063c:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  80063e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800641:	8b 10                	mov    (%eax),%edx
+  800643:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  800648:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  80064b:	8d 40 04             	lea    0x4(%eax),%eax
+  80064e:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800651:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  800656:	83 ec 0c             	sub    $0xc,%esp
+  800659:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80065d:	50                   	push   %eax
+  80065e:	ff 75 e0             	push   -0x20(%ebp)
+  800661:	57                   	push   %edi
+  800662:	51                   	push   %ecx
+  800663:	52                   	push   %edx
+  800664:	89 da                	mov    %ebx,%edx
+  800666:	89 f0                	mov    %esi,%eax
+  800668:	e8 4a fb ff ff       	call   8001b7 <printnum>
+      break;
+  80066d:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  800670:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  800673:	e9 40 fc ff ff       	jmp    8002b8 <vprintfmt+0x1e>
+  if (lflag >= 2)
+  800678:	83 f9 01             	cmp    $0x1,%ecx
+  80067b:	7f 1b                	jg     800698 <vprintfmt+0x3fe>
+  else if (lflag)
+  80067d:	85 c9                	test   %ecx,%ecx
+  80067f:	74 2c                	je     8006ad <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  800681:	8b 45 14             	mov    0x14(%ebp),%eax
+  800684:	8b 10                	mov    (%eax),%edx
+  800686:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80068b:	8d 40 04             	lea    0x4(%eax),%eax
+  80068e:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800691:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  800696:	eb be                	jmp    800656 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800698:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069b:	8b 10                	mov    (%eax),%edx
+  80069d:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006a0:	8d 40 08             	lea    0x8(%eax),%eax
+  8006a3:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8006a6:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  8006ab:	eb a9                	jmp    800656 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8006ad:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b0:	8b 10                	mov    (%eax),%edx
+  8006b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006b7:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ba:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8006bd:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  8006c2:	eb 92                	jmp    800656 <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  8006c4:	83 ec 08             	sub    $0x8,%esp
+  8006c7:	53                   	push   %ebx
+  8006c8:	6a 25                	push   $0x25
+  8006ca:	ff d6                	call   *%esi
+      break;
+  8006cc:	83 c4 10             	add    $0x10,%esp
+  8006cf:	eb 9f                	jmp    800670 <vprintfmt+0x3d6>
+      putch('%', putdat);
+  8006d1:	83 ec 08             	sub    $0x8,%esp
+  8006d4:	53                   	push   %ebx
+  8006d5:	6a 25                	push   $0x25
+  8006d7:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  8006d9:	83 c4 10             	add    $0x10,%esp
+  8006dc:	89 f8                	mov    %edi,%eax
+  8006de:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8006e2:	74 05                	je     8006e9 <vprintfmt+0x44f>
+  8006e4:	83 e8 01             	sub    $0x1,%eax
+  8006e7:	eb f5                	jmp    8006de <vprintfmt+0x444>
+  8006e9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8006ec:	eb 82                	jmp    800670 <vprintfmt+0x3d6>
+
+008006ee <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8006ee:	55                   	push   %ebp
+  8006ef:	89 e5                	mov    %esp,%ebp
+  8006f1:	83 ec 18             	sub    $0x18,%esp
+  8006f4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006f7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  8006fa:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8006fd:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800701:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800704:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  80070b:	85 c0                	test   %eax,%eax
+  80070d:	74 26                	je     800735 <vsnprintf+0x47>
+  80070f:	85 d2                	test   %edx,%edx
+  800711:	7e 22                	jle    800735 <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800713:	ff 75 14             	push   0x14(%ebp)
+  800716:	ff 75 10             	push   0x10(%ebp)
+  800719:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80071c:	50                   	push   %eax
+  80071d:	68 60 02 80 00       	push   $0x800260
+  800722:	e8 73 fb ff ff       	call   80029a <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800727:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80072a:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  80072d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800730:	83 c4 10             	add    $0x10,%esp
+}
+  800733:	c9                   	leave
+  800734:	c3                   	ret
+    return -E_INVAL;
+  800735:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80073a:	eb f7                	jmp    800733 <vsnprintf+0x45>
+
+0080073c <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80073c:	55                   	push   %ebp
+  80073d:	89 e5                	mov    %esp,%ebp
+  80073f:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  800742:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  800745:	50                   	push   %eax
+  800746:	ff 75 10             	push   0x10(%ebp)
+  800749:	ff 75 0c             	push   0xc(%ebp)
+  80074c:	ff 75 08             	push   0x8(%ebp)
+  80074f:	e8 9a ff ff ff       	call   8006ee <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  800754:	c9                   	leave
+  800755:	c3                   	ret
+
+00800756 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800756:	55                   	push   %ebp
+  800757:	89 e5                	mov    %esp,%ebp
+  800759:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  80075c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800761:	eb 03                	jmp    800766 <strlen+0x10>
+    n++;
+  800763:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  800766:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80076a:	75 f7                	jne    800763 <strlen+0xd>
+  return n;
+}
+  80076c:	5d                   	pop    %ebp
+  80076d:	c3                   	ret
+
+0080076e <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80076e:	55                   	push   %ebp
+  80076f:	89 e5                	mov    %esp,%ebp
+  800771:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800774:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800777:	b8 00 00 00 00       	mov    $0x0,%eax
+  80077c:	eb 03                	jmp    800781 <strnlen+0x13>
+    n++;
+  80077e:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800781:	39 d0                	cmp    %edx,%eax
+  800783:	74 08                	je     80078d <strnlen+0x1f>
+  800785:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800789:	75 f3                	jne    80077e <strnlen+0x10>
+  80078b:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  80078d:	89 d0                	mov    %edx,%eax
+  80078f:	5d                   	pop    %ebp
+  800790:	c3                   	ret
+
+00800791 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800791:	55                   	push   %ebp
+  800792:	89 e5                	mov    %esp,%ebp
+  800794:	53                   	push   %ebx
+  800795:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800798:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  80079b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007a0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8007a4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8007a7:	83 c0 01             	add    $0x1,%eax
+  8007aa:	84 d2                	test   %dl,%dl
+  8007ac:	75 f2                	jne    8007a0 <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  8007ae:	89 c8                	mov    %ecx,%eax
+  8007b0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007b3:	c9                   	leave
+  8007b4:	c3                   	ret
+
+008007b5 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8007b5:	55                   	push   %ebp
+  8007b6:	89 e5                	mov    %esp,%ebp
+  8007b8:	53                   	push   %ebx
+  8007b9:	83 ec 10             	sub    $0x10,%esp
+  8007bc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  8007bf:	53                   	push   %ebx
+  8007c0:	e8 91 ff ff ff       	call   800756 <strlen>
+  8007c5:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  8007c8:	ff 75 0c             	push   0xc(%ebp)
+  8007cb:	01 d8                	add    %ebx,%eax
+  8007cd:	50                   	push   %eax
+  8007ce:	e8 be ff ff ff       	call   800791 <strcpy>
+  return dst;
+}
+  8007d3:	89 d8                	mov    %ebx,%eax
+  8007d5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007d8:	c9                   	leave
+  8007d9:	c3                   	ret
+
+008007da <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  8007da:	55                   	push   %ebp
+  8007db:	89 e5                	mov    %esp,%ebp
+  8007dd:	56                   	push   %esi
+  8007de:	53                   	push   %ebx
+  8007df:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007e2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  8007e5:	89 f3                	mov    %esi,%ebx
+  8007e7:	03 5d 10             	add    0x10(%ebp),%ebx
+  8007ea:	89 f0                	mov    %esi,%eax
+  8007ec:	eb 0f                	jmp    8007fd <strncpy+0x23>
+    *dst++ = *src;
+  8007ee:	83 c0 01             	add    $0x1,%eax
+  8007f1:	0f b6 0a             	movzbl (%edx),%ecx
+  8007f4:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  8007f7:	80 f9 01             	cmp    $0x1,%cl
+  8007fa:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  8007fd:	39 d8                	cmp    %ebx,%eax
+  8007ff:	75 ed                	jne    8007ee <strncpy+0x14>
+  }
+  return ret;
+}
+  800801:	89 f0                	mov    %esi,%eax
+  800803:	5b                   	pop    %ebx
+  800804:	5e                   	pop    %esi
+  800805:	5d                   	pop    %ebp
+  800806:	c3                   	ret
+
+00800807 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800807:	55                   	push   %ebp
+  800808:	89 e5                	mov    %esp,%ebp
+  80080a:	56                   	push   %esi
+  80080b:	53                   	push   %ebx
+  80080c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80080f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800812:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  800815:	89 f0                	mov    %esi,%eax
+  800817:	85 d2                	test   %edx,%edx
+  800819:	74 21                	je     80083c <strlcpy+0x35>
+  80081b:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80081f:	89 f2                	mov    %esi,%edx
+  800821:	eb 09                	jmp    80082c <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  800823:	83 c1 01             	add    $0x1,%ecx
+  800826:	83 c2 01             	add    $0x1,%edx
+  800829:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  80082c:	39 c2                	cmp    %eax,%edx
+  80082e:	74 09                	je     800839 <strlcpy+0x32>
+  800830:	0f b6 19             	movzbl (%ecx),%ebx
+  800833:	84 db                	test   %bl,%bl
+  800835:	75 ec                	jne    800823 <strlcpy+0x1c>
+  800837:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  800839:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  80083c:	29 f0                	sub    %esi,%eax
+}
+  80083e:	5b                   	pop    %ebx
+  80083f:	5e                   	pop    %esi
+  800840:	5d                   	pop    %ebp
+  800841:	c3                   	ret
+
+00800842 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800842:	55                   	push   %ebp
+  800843:	89 e5                	mov    %esp,%ebp
+  800845:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800848:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  80084b:	eb 06                	jmp    800853 <strcmp+0x11>
+    p++, q++;
+  80084d:	83 c1 01             	add    $0x1,%ecx
+  800850:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  800853:	0f b6 01             	movzbl (%ecx),%eax
+  800856:	84 c0                	test   %al,%al
+  800858:	74 04                	je     80085e <strcmp+0x1c>
+  80085a:	3a 02                	cmp    (%edx),%al
+  80085c:	74 ef                	je     80084d <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  80085e:	0f b6 c0             	movzbl %al,%eax
+  800861:	0f b6 12             	movzbl (%edx),%edx
+  800864:	29 d0                	sub    %edx,%eax
+}
+  800866:	5d                   	pop    %ebp
+  800867:	c3                   	ret
+
+00800868 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800868:	55                   	push   %ebp
+  800869:	89 e5                	mov    %esp,%ebp
+  80086b:	53                   	push   %ebx
+  80086c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80086f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800872:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  800875:	eb 09                	jmp    800880 <strncmp+0x18>
+    n--, p++, q++;
+  800877:	83 ea 01             	sub    $0x1,%edx
+  80087a:	83 c0 01             	add    $0x1,%eax
+  80087d:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  800880:	85 d2                	test   %edx,%edx
+  800882:	74 18                	je     80089c <strncmp+0x34>
+  800884:	0f b6 18             	movzbl (%eax),%ebx
+  800887:	84 db                	test   %bl,%bl
+  800889:	74 04                	je     80088f <strncmp+0x27>
+  80088b:	3a 19                	cmp    (%ecx),%bl
+  80088d:	74 e8                	je     800877 <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80088f:	0f b6 00             	movzbl (%eax),%eax
+  800892:	0f b6 11             	movzbl (%ecx),%edx
+  800895:	29 d0                	sub    %edx,%eax
+}
+  800897:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80089a:	c9                   	leave
+  80089b:	c3                   	ret
+    return 0;
+  80089c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008a1:	eb f4                	jmp    800897 <strncmp+0x2f>
+
+008008a3 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8008a3:	55                   	push   %ebp
+  8008a4:	89 e5                	mov    %esp,%ebp
+  8008a6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008a9:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  8008ad:	eb 03                	jmp    8008b2 <strchr+0xf>
+  8008af:	83 c0 01             	add    $0x1,%eax
+  8008b2:	0f b6 10             	movzbl (%eax),%edx
+  8008b5:	84 d2                	test   %dl,%dl
+  8008b7:	74 06                	je     8008bf <strchr+0x1c>
+    if (*s == c)
+  8008b9:	38 ca                	cmp    %cl,%dl
+  8008bb:	75 f2                	jne    8008af <strchr+0xc>
+  8008bd:	eb 05                	jmp    8008c4 <strchr+0x21>
+      return (char*)s;
+  return 0;
+  8008bf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008c4:	5d                   	pop    %ebp
+  8008c5:	c3                   	ret
+
+008008c6 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8008c6:	55                   	push   %ebp
+  8008c7:	89 e5                	mov    %esp,%ebp
+  8008c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008cc:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  8008d0:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  8008d3:	38 ca                	cmp    %cl,%dl
+  8008d5:	74 09                	je     8008e0 <strfind+0x1a>
+  8008d7:	84 d2                	test   %dl,%dl
+  8008d9:	74 05                	je     8008e0 <strfind+0x1a>
+  for (; *s; s++)
+  8008db:	83 c0 01             	add    $0x1,%eax
+  8008de:	eb f0                	jmp    8008d0 <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  8008e0:	5d                   	pop    %ebp
+  8008e1:	c3                   	ret
+
+008008e2 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8008e2:	55                   	push   %ebp
+  8008e3:	89 e5                	mov    %esp,%ebp
+  8008e5:	57                   	push   %edi
+  8008e6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8008e9:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  8008ec:	85 c9                	test   %ecx,%ecx
+  8008ee:	74 20                	je     800910 <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  8008f0:	89 f8                	mov    %edi,%eax
+  8008f2:	09 c8                	or     %ecx,%eax
+  8008f4:	a8 03                	test   $0x3,%al
+  8008f6:	75 12                	jne    80090a <memset+0x28>
+    c &= 0xFF;
+  8008f8:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8008fc:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  800902:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  800905:	fc                   	cld
+  800906:	f3 ab                	rep stos %eax,%es:(%edi)
+  800908:	eb 06                	jmp    800910 <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  80090a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80090d:	fc                   	cld
+  80090e:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  800910:	89 f8                	mov    %edi,%eax
+  800912:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800915:	c9                   	leave
+  800916:	c3                   	ret
+
+00800917 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800917:	55                   	push   %ebp
+  800918:	89 e5                	mov    %esp,%ebp
+  80091a:	57                   	push   %edi
+  80091b:	56                   	push   %esi
+  80091c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80091f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800922:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  800925:	39 c6                	cmp    %eax,%esi
+  800927:	73 32                	jae    80095b <memmove+0x44>
+  800929:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80092c:	39 d0                	cmp    %edx,%eax
+  80092e:	73 2b                	jae    80095b <memmove+0x44>
+    s += n;
+    d += n;
+  800930:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800933:	89 d6                	mov    %edx,%esi
+  800935:	09 fe                	or     %edi,%esi
+  800937:	09 ce                	or     %ecx,%esi
+  800939:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  80093f:	75 0e                	jne    80094f <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800941:	83 ef 04             	sub    $0x4,%edi
+  800944:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800947:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  80094a:	fd                   	std
+  80094b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80094d:	eb 09                	jmp    800958 <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  80094f:	83 ef 01             	sub    $0x1,%edi
+  800952:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  800955:	fd                   	std
+  800956:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  800958:	fc                   	cld
+  800959:	eb 1a                	jmp    800975 <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80095b:	89 f2                	mov    %esi,%edx
+  80095d:	09 c2                	or     %eax,%edx
+  80095f:	09 ca                	or     %ecx,%edx
+  800961:	f6 c2 03             	test   $0x3,%dl
+  800964:	75 0a                	jne    800970 <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800966:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  800969:	89 c7                	mov    %eax,%edi
+  80096b:	fc                   	cld
+  80096c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80096e:	eb 05                	jmp    800975 <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  800970:	89 c7                	mov    %eax,%edi
+  800972:	fc                   	cld
+  800973:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  800975:	5e                   	pop    %esi
+  800976:	5f                   	pop    %edi
+  800977:	5d                   	pop    %ebp
+  800978:	c3                   	ret
+
+00800979 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800979:	55                   	push   %ebp
+  80097a:	89 e5                	mov    %esp,%ebp
+  80097c:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  80097f:	ff 75 10             	push   0x10(%ebp)
+  800982:	ff 75 0c             	push   0xc(%ebp)
+  800985:	ff 75 08             	push   0x8(%ebp)
+  800988:	e8 8a ff ff ff       	call   800917 <memmove>
+}
+  80098d:	c9                   	leave
+  80098e:	c3                   	ret
+
+0080098f <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  80098f:	55                   	push   %ebp
+  800990:	89 e5                	mov    %esp,%ebp
+  800992:	56                   	push   %esi
+  800993:	53                   	push   %ebx
+  800994:	8b 45 08             	mov    0x8(%ebp),%eax
+  800997:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  80099a:	89 c6                	mov    %eax,%esi
+  80099c:	03 75 10             	add    0x10(%ebp),%esi
+  80099f:	eb 06                	jmp    8009a7 <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  8009a1:	83 c0 01             	add    $0x1,%eax
+  8009a4:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  8009a7:	39 f0                	cmp    %esi,%eax
+  8009a9:	74 14                	je     8009bf <memcmp+0x30>
+    if (*s1 != *s2)
+  8009ab:	0f b6 08             	movzbl (%eax),%ecx
+  8009ae:	0f b6 1a             	movzbl (%edx),%ebx
+  8009b1:	38 d9                	cmp    %bl,%cl
+  8009b3:	74 ec                	je     8009a1 <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  8009b5:	0f b6 c1             	movzbl %cl,%eax
+  8009b8:	0f b6 db             	movzbl %bl,%ebx
+  8009bb:	29 d8                	sub    %ebx,%eax
+  8009bd:	eb 05                	jmp    8009c4 <memcmp+0x35>
+  }
+
+  return 0;
+  8009bf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009c4:	5b                   	pop    %ebx
+  8009c5:	5e                   	pop    %esi
+  8009c6:	5d                   	pop    %ebp
+  8009c7:	c3                   	ret
+
+008009c8 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8009c8:	55                   	push   %ebp
+  8009c9:	89 e5                	mov    %esp,%ebp
+  8009cb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009ce:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  8009d1:	89 c2                	mov    %eax,%edx
+  8009d3:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  8009d6:	eb 03                	jmp    8009db <memfind+0x13>
+  8009d8:	83 c0 01             	add    $0x1,%eax
+  8009db:	39 d0                	cmp    %edx,%eax
+  8009dd:	73 04                	jae    8009e3 <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  8009df:	38 08                	cmp    %cl,(%eax)
+  8009e1:	75 f5                	jne    8009d8 <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  8009e3:	5d                   	pop    %ebp
+  8009e4:	c3                   	ret
+
+008009e5 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8009e5:	55                   	push   %ebp
+  8009e6:	89 e5                	mov    %esp,%ebp
+  8009e8:	57                   	push   %edi
+  8009e9:	56                   	push   %esi
+  8009ea:	53                   	push   %ebx
+  8009eb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009ee:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  8009f1:	eb 03                	jmp    8009f6 <strtol+0x11>
+    s++;
+  8009f3:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  8009f6:	0f b6 02             	movzbl (%edx),%eax
+  8009f9:	3c 20                	cmp    $0x20,%al
+  8009fb:	74 f6                	je     8009f3 <strtol+0xe>
+  8009fd:	3c 09                	cmp    $0x9,%al
+  8009ff:	74 f2                	je     8009f3 <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  800a01:	3c 2b                	cmp    $0x2b,%al
+  800a03:	74 2a                	je     800a2f <strtol+0x4a>
+  int neg = 0;
+  800a05:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  800a0a:	3c 2d                	cmp    $0x2d,%al
+  800a0c:	74 2b                	je     800a39 <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a0e:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a14:	75 0f                	jne    800a25 <strtol+0x40>
+  800a16:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a19:	74 28                	je     800a43 <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  800a1b:	85 db                	test   %ebx,%ebx
+  800a1d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a22:	0f 44 d8             	cmove  %eax,%ebx
+  800a25:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a2a:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a2d:	eb 46                	jmp    800a75 <strtol+0x90>
+    s++;
+  800a2f:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  800a32:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a37:	eb d5                	jmp    800a0e <strtol+0x29>
+    s++, neg = 1;
+  800a39:	83 c2 01             	add    $0x1,%edx
+  800a3c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a41:	eb cb                	jmp    800a0e <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a43:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a47:	74 0e                	je     800a57 <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  800a49:	85 db                	test   %ebx,%ebx
+  800a4b:	75 d8                	jne    800a25 <strtol+0x40>
+    s++, base = 8;
+  800a4d:	83 c2 01             	add    $0x1,%edx
+  800a50:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a55:	eb ce                	jmp    800a25 <strtol+0x40>
+    s += 2, base = 16;
+  800a57:	83 c2 02             	add    $0x2,%edx
+  800a5a:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a5f:	eb c4                	jmp    800a25 <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  800a61:	0f be c0             	movsbl %al,%eax
+  800a64:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  800a67:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a6a:	7d 3a                	jge    800aa6 <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  800a6c:	83 c2 01             	add    $0x1,%edx
+  800a6f:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a73:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  800a75:	0f b6 02             	movzbl (%edx),%eax
+  800a78:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a7b:	89 f3                	mov    %esi,%ebx
+  800a7d:	80 fb 09             	cmp    $0x9,%bl
+  800a80:	76 df                	jbe    800a61 <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  800a82:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800a85:	89 f3                	mov    %esi,%ebx
+  800a87:	80 fb 19             	cmp    $0x19,%bl
+  800a8a:	77 08                	ja     800a94 <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  800a8c:	0f be c0             	movsbl %al,%eax
+  800a8f:	83 e8 57             	sub    $0x57,%eax
+  800a92:	eb d3                	jmp    800a67 <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  800a94:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800a97:	89 f3                	mov    %esi,%ebx
+  800a99:	80 fb 19             	cmp    $0x19,%bl
+  800a9c:	77 08                	ja     800aa6 <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  800a9e:	0f be c0             	movsbl %al,%eax
+  800aa1:	83 e8 37             	sub    $0x37,%eax
+  800aa4:	eb c1                	jmp    800a67 <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  800aa6:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800aaa:	74 05                	je     800ab1 <strtol+0xcc>
+    *endptr = (char*)s;
+  800aac:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800aaf:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  800ab1:	89 c8                	mov    %ecx,%eax
+  800ab3:	f7 d8                	neg    %eax
+  800ab5:	85 ff                	test   %edi,%edi
+  800ab7:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800aba:	89 c8                	mov    %ecx,%eax
+  800abc:	5b                   	pop    %ebx
+  800abd:	5e                   	pop    %esi
+  800abe:	5f                   	pop    %edi
+  800abf:	5d                   	pop    %ebp
+  800ac0:	c3                   	ret
+
+00800ac1 <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800ac1:	55                   	push   %ebp
+  800ac2:	89 e5                	mov    %esp,%ebp
+  800ac4:	57                   	push   %edi
+  800ac5:	56                   	push   %esi
+  800ac6:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800ac7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800acc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800acf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ad2:	89 c3                	mov    %eax,%ebx
+  800ad4:	89 c7                	mov    %eax,%edi
+  800ad6:	89 c6                	mov    %eax,%esi
+  800ad8:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800ada:	5b                   	pop    %ebx
+  800adb:	5e                   	pop    %esi
+  800adc:	5f                   	pop    %edi
+  800add:	5d                   	pop    %ebp
+  800ade:	c3                   	ret
+
+00800adf <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800adf:	55                   	push   %ebp
+  800ae0:	89 e5                	mov    %esp,%ebp
+  800ae2:	57                   	push   %edi
+  800ae3:	56                   	push   %esi
+  800ae4:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800ae5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800aea:	b8 01 00 00 00       	mov    $0x1,%eax
+  800aef:	89 d1                	mov    %edx,%ecx
+  800af1:	89 d3                	mov    %edx,%ebx
+  800af3:	89 d7                	mov    %edx,%edi
+  800af5:	89 d6                	mov    %edx,%esi
+  800af7:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800af9:	5b                   	pop    %ebx
+  800afa:	5e                   	pop    %esi
+  800afb:	5f                   	pop    %edi
+  800afc:	5d                   	pop    %ebp
+  800afd:	c3                   	ret
+
+00800afe <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800afe:	55                   	push   %ebp
+  800aff:	89 e5                	mov    %esp,%ebp
+  800b01:	57                   	push   %edi
+  800b02:	56                   	push   %esi
+  800b03:	53                   	push   %ebx
+  800b04:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800b07:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b0c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b0f:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b14:	89 cb                	mov    %ecx,%ebx
+  800b16:	89 cf                	mov    %ecx,%edi
+  800b18:	89 ce                	mov    %ecx,%esi
+  800b1a:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800b1c:	85 c0                	test   %eax,%eax
+  800b1e:	7f 08                	jg     800b28 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800b20:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b23:	5b                   	pop    %ebx
+  800b24:	5e                   	pop    %esi
+  800b25:	5f                   	pop    %edi
+  800b26:	5d                   	pop    %ebp
+  800b27:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800b28:	83 ec 0c             	sub    $0xc,%esp
+  800b2b:	50                   	push   %eax
+  800b2c:	6a 03                	push   $0x3
+  800b2e:	68 03 32 80 00       	push   $0x803203
+  800b33:	6a 23                	push   $0x23
+  800b35:	68 20 32 80 00       	push   $0x803220
+  800b3a:	e8 a4 20 00 00       	call   802be3 <_panic>
+
+00800b3f <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800b3f:	55                   	push   %ebp
+  800b40:	89 e5                	mov    %esp,%ebp
+  800b42:	57                   	push   %edi
+  800b43:	56                   	push   %esi
+  800b44:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800b45:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b4a:	b8 02 00 00 00       	mov    $0x2,%eax
+  800b4f:	89 d1                	mov    %edx,%ecx
+  800b51:	89 d3                	mov    %edx,%ebx
+  800b53:	89 d7                	mov    %edx,%edi
+  800b55:	89 d6                	mov    %edx,%esi
+  800b57:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800b59:	5b                   	pop    %ebx
+  800b5a:	5e                   	pop    %esi
+  800b5b:	5f                   	pop    %edi
+  800b5c:	5d                   	pop    %ebp
+  800b5d:	c3                   	ret
+
+00800b5e <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800b5e:	55                   	push   %ebp
+  800b5f:	89 e5                	mov    %esp,%ebp
+  800b61:	57                   	push   %edi
+  800b62:	56                   	push   %esi
+  800b63:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800b64:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b69:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800b6e:	89 d1                	mov    %edx,%ecx
+  800b70:	89 d3                	mov    %edx,%ebx
+  800b72:	89 d7                	mov    %edx,%edi
+  800b74:	89 d6                	mov    %edx,%esi
+  800b76:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800b78:	5b                   	pop    %ebx
+  800b79:	5e                   	pop    %esi
+  800b7a:	5f                   	pop    %edi
+  800b7b:	5d                   	pop    %ebp
+  800b7c:	c3                   	ret
+
+00800b7d <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  800b7d:	55                   	push   %ebp
+  800b7e:	89 e5                	mov    %esp,%ebp
+  800b80:	57                   	push   %edi
+  800b81:	56                   	push   %esi
+  800b82:	53                   	push   %ebx
+  800b83:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  800b86:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  800b8a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b8f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b92:	b8 14 00 00 00       	mov    $0x14,%eax
+  800b97:	89 df                	mov    %ebx,%edi
+  800b99:	89 de                	mov    %ebx,%esi
+  800b9b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800b9d:	85 c0                	test   %eax,%eax
+  800b9f:	7f 08                	jg     800ba9 <sys_env_set_cow+0x2c>
+}
+  800ba1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ba4:	5b                   	pop    %ebx
+  800ba5:	5e                   	pop    %esi
+  800ba6:	5f                   	pop    %edi
+  800ba7:	5d                   	pop    %ebp
+  800ba8:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ba9:	83 ec 0c             	sub    $0xc,%esp
+  800bac:	50                   	push   %eax
+  800bad:	6a 14                	push   $0x14
+  800baf:	68 03 32 80 00       	push   $0x803203
+  800bb4:	6a 23                	push   $0x23
+  800bb6:	68 20 32 80 00       	push   $0x803220
+  800bbb:	e8 23 20 00 00       	call   802be3 <_panic>
+
+00800bc0 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800bc0:	55                   	push   %ebp
+  800bc1:	89 e5                	mov    %esp,%ebp
+  800bc3:	57                   	push   %edi
+  800bc4:	56                   	push   %esi
+  800bc5:	53                   	push   %ebx
+  800bc6:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800bc9:	be 00 00 00 00       	mov    $0x0,%esi
+  800bce:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bd1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bd4:	b8 04 00 00 00       	mov    $0x4,%eax
+  800bd9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800bdc:	89 f7                	mov    %esi,%edi
+  800bde:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800be0:	85 c0                	test   %eax,%eax
+  800be2:	7f 08                	jg     800bec <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  800be4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800be7:	5b                   	pop    %ebx
+  800be8:	5e                   	pop    %esi
+  800be9:	5f                   	pop    %edi
+  800bea:	5d                   	pop    %ebp
+  800beb:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800bec:	83 ec 0c             	sub    $0xc,%esp
+  800bef:	50                   	push   %eax
+  800bf0:	6a 04                	push   $0x4
+  800bf2:	68 03 32 80 00       	push   $0x803203
+  800bf7:	6a 23                	push   $0x23
+  800bf9:	68 20 32 80 00       	push   $0x803220
+  800bfe:	e8 e0 1f 00 00       	call   802be3 <_panic>
+
+00800c03 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800c03:	55                   	push   %ebp
+  800c04:	89 e5                	mov    %esp,%ebp
+  800c06:	57                   	push   %edi
+  800c07:	56                   	push   %esi
+  800c08:	53                   	push   %ebx
+  800c09:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800c0c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c0f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c12:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c17:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c1a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c1d:	8b 75 18             	mov    0x18(%ebp),%esi
+  800c20:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c22:	85 c0                	test   %eax,%eax
+  800c24:	7f 08                	jg     800c2e <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  800c26:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c29:	5b                   	pop    %ebx
+  800c2a:	5e                   	pop    %esi
+  800c2b:	5f                   	pop    %edi
+  800c2c:	5d                   	pop    %ebp
+  800c2d:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c2e:	83 ec 0c             	sub    $0xc,%esp
+  800c31:	50                   	push   %eax
+  800c32:	6a 05                	push   $0x5
+  800c34:	68 03 32 80 00       	push   $0x803203
+  800c39:	6a 23                	push   $0x23
+  800c3b:	68 20 32 80 00       	push   $0x803220
+  800c40:	e8 9e 1f 00 00       	call   802be3 <_panic>
+
+00800c45 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800c45:	55                   	push   %ebp
+  800c46:	89 e5                	mov    %esp,%ebp
+  800c48:	57                   	push   %edi
+  800c49:	56                   	push   %esi
+  800c4a:	53                   	push   %ebx
+  800c4b:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800c4e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c53:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c56:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c59:	b8 06 00 00 00       	mov    $0x6,%eax
+  800c5e:	89 df                	mov    %ebx,%edi
+  800c60:	89 de                	mov    %ebx,%esi
+  800c62:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c64:	85 c0                	test   %eax,%eax
+  800c66:	7f 08                	jg     800c70 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  800c68:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c6b:	5b                   	pop    %ebx
+  800c6c:	5e                   	pop    %esi
+  800c6d:	5f                   	pop    %edi
+  800c6e:	5d                   	pop    %ebp
+  800c6f:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c70:	83 ec 0c             	sub    $0xc,%esp
+  800c73:	50                   	push   %eax
+  800c74:	6a 06                	push   $0x6
+  800c76:	68 03 32 80 00       	push   $0x803203
+  800c7b:	6a 23                	push   $0x23
+  800c7d:	68 20 32 80 00       	push   $0x803220
+  800c82:	e8 5c 1f 00 00       	call   802be3 <_panic>
+
+00800c87 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  800c87:	55                   	push   %ebp
+  800c88:	89 e5                	mov    %esp,%ebp
+  800c8a:	57                   	push   %edi
+  800c8b:	56                   	push   %esi
+  800c8c:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800c8d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c90:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c93:	b8 11 00 00 00       	mov    $0x11,%eax
+  800c98:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c9b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c9e:	8b 75 18             	mov    0x18(%ebp),%esi
+  800ca1:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  800ca3:	5b                   	pop    %ebx
+  800ca4:	5e                   	pop    %esi
+  800ca5:	5f                   	pop    %edi
+  800ca6:	5d                   	pop    %ebp
+  800ca7:	c3                   	ret
+
+00800ca8 <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  800ca8:	55                   	push   %ebp
+  800ca9:	89 e5                	mov    %esp,%ebp
+  800cab:	57                   	push   %edi
+  800cac:	56                   	push   %esi
+  800cad:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800cae:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cb1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cb4:	b8 12 00 00 00       	mov    $0x12,%eax
+  800cb9:	be 00 00 00 00       	mov    $0x0,%esi
+  800cbe:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cc1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800cc4:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  800cc6:	5b                   	pop    %ebx
+  800cc7:	5e                   	pop    %esi
+  800cc8:	5f                   	pop    %edi
+  800cc9:	5d                   	pop    %ebp
+  800cca:	c3                   	ret
+
+00800ccb <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  800ccb:	55                   	push   %ebp
+  800ccc:	89 e5                	mov    %esp,%ebp
+  800cce:	57                   	push   %edi
+  800ccf:	56                   	push   %esi
+  800cd0:	53                   	push   %ebx
+  800cd1:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800cd4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cd9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cdc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cdf:	b8 16 00 00 00       	mov    $0x16,%eax
+  800ce4:	89 df                	mov    %ebx,%edi
+  800ce6:	89 de                	mov    %ebx,%esi
+  800ce8:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800cea:	85 c0                	test   %eax,%eax
+  800cec:	7f 08                	jg     800cf6 <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  800cee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cf1:	5b                   	pop    %ebx
+  800cf2:	5e                   	pop    %esi
+  800cf3:	5f                   	pop    %edi
+  800cf4:	5d                   	pop    %ebp
+  800cf5:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800cf6:	83 ec 0c             	sub    $0xc,%esp
+  800cf9:	50                   	push   %eax
+  800cfa:	6a 16                	push   $0x16
+  800cfc:	68 03 32 80 00       	push   $0x803203
+  800d01:	6a 23                	push   $0x23
+  800d03:	68 20 32 80 00       	push   $0x803220
+  800d08:	e8 d6 1e 00 00       	call   802be3 <_panic>
+
+00800d0d <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  800d0d:	55                   	push   %ebp
+  800d0e:	89 e5                	mov    %esp,%ebp
+  800d10:	57                   	push   %edi
+  800d11:	56                   	push   %esi
+  800d12:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d13:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d18:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d1b:	b8 17 00 00 00       	mov    $0x17,%eax
+  800d20:	89 cb                	mov    %ecx,%ebx
+  800d22:	89 cf                	mov    %ecx,%edi
+  800d24:	89 ce                	mov    %ecx,%esi
+  800d26:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  800d28:	5b                   	pop    %ebx
+  800d29:	5e                   	pop    %esi
+  800d2a:	5f                   	pop    %edi
+  800d2b:	5d                   	pop    %ebp
+  800d2c:	c3                   	ret
+
+00800d2d <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  800d2d:	55                   	push   %ebp
+  800d2e:	89 e5                	mov    %esp,%ebp
+  800d30:	57                   	push   %edi
+  800d31:	56                   	push   %esi
+  800d32:	53                   	push   %ebx
+  800d33:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800d36:	be 00 00 00 00       	mov    $0x0,%esi
+  800d3b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d3e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d41:	b8 18 00 00 00       	mov    $0x18,%eax
+  800d46:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d49:	89 f7                	mov    %esi,%edi
+  800d4b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d4d:	85 c0                	test   %eax,%eax
+  800d4f:	7f 08                	jg     800d59 <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  800d51:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d54:	5b                   	pop    %ebx
+  800d55:	5e                   	pop    %esi
+  800d56:	5f                   	pop    %edi
+  800d57:	5d                   	pop    %ebp
+  800d58:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d59:	83 ec 0c             	sub    $0xc,%esp
+  800d5c:	50                   	push   %eax
+  800d5d:	6a 18                	push   $0x18
+  800d5f:	68 03 32 80 00       	push   $0x803203
+  800d64:	6a 23                	push   $0x23
+  800d66:	68 20 32 80 00       	push   $0x803220
+  800d6b:	e8 73 1e 00 00       	call   802be3 <_panic>
+
+00800d70 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  800d70:	55                   	push   %ebp
+  800d71:	89 e5                	mov    %esp,%ebp
+  800d73:	57                   	push   %edi
+  800d74:	56                   	push   %esi
+  800d75:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d76:	be 00 00 00 00       	mov    $0x0,%esi
+  800d7b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d7e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d81:	b8 19 00 00 00       	mov    $0x19,%eax
+  800d86:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d89:	89 f7                	mov    %esi,%edi
+  800d8b:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  800d8d:	5b                   	pop    %ebx
+  800d8e:	5e                   	pop    %esi
+  800d8f:	5f                   	pop    %edi
+  800d90:	5d                   	pop    %ebp
+  800d91:	c3                   	ret
+
+00800d92 <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  800d92:	55                   	push   %ebp
+  800d93:	89 e5                	mov    %esp,%ebp
+  800d95:	57                   	push   %edi
+  800d96:	56                   	push   %esi
+  800d97:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d98:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d9d:	b8 15 00 00 00       	mov    $0x15,%eax
+  800da2:	89 d1                	mov    %edx,%ecx
+  800da4:	89 d3                	mov    %edx,%ebx
+  800da6:	89 d7                	mov    %edx,%edi
+  800da8:	89 d6                	mov    %edx,%esi
+  800daa:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800dac:	5b                   	pop    %ebx
+  800dad:	5e                   	pop    %esi
+  800dae:	5f                   	pop    %edi
+  800daf:	5d                   	pop    %ebp
+  800db0:	c3                   	ret
+
+00800db1 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800db1:	55                   	push   %ebp
+  800db2:	89 e5                	mov    %esp,%ebp
+  800db4:	57                   	push   %edi
+  800db5:	56                   	push   %esi
+  800db6:	53                   	push   %ebx
+  800db7:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800dba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dbf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dc2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dc5:	b8 08 00 00 00       	mov    $0x8,%eax
+  800dca:	89 df                	mov    %ebx,%edi
+  800dcc:	89 de                	mov    %ebx,%esi
+  800dce:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800dd0:	85 c0                	test   %eax,%eax
+  800dd2:	7f 08                	jg     800ddc <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800dd4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dd7:	5b                   	pop    %ebx
+  800dd8:	5e                   	pop    %esi
+  800dd9:	5f                   	pop    %edi
+  800dda:	5d                   	pop    %ebp
+  800ddb:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ddc:	83 ec 0c             	sub    $0xc,%esp
+  800ddf:	50                   	push   %eax
+  800de0:	6a 08                	push   $0x8
+  800de2:	68 03 32 80 00       	push   $0x803203
+  800de7:	6a 23                	push   $0x23
+  800de9:	68 20 32 80 00       	push   $0x803220
+  800dee:	e8 f0 1d 00 00       	call   802be3 <_panic>
+
+00800df3 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800df3:	55                   	push   %ebp
+  800df4:	89 e5                	mov    %esp,%ebp
+  800df6:	57                   	push   %edi
+  800df7:	56                   	push   %esi
+  800df8:	53                   	push   %ebx
+  800df9:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800dfc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e01:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e04:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e07:	b8 09 00 00 00       	mov    $0x9,%eax
+  800e0c:	89 df                	mov    %ebx,%edi
+  800e0e:	89 de                	mov    %ebx,%esi
+  800e10:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e12:	85 c0                	test   %eax,%eax
+  800e14:	7f 08                	jg     800e1e <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  800e16:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e19:	5b                   	pop    %ebx
+  800e1a:	5e                   	pop    %esi
+  800e1b:	5f                   	pop    %edi
+  800e1c:	5d                   	pop    %ebp
+  800e1d:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e1e:	83 ec 0c             	sub    $0xc,%esp
+  800e21:	50                   	push   %eax
+  800e22:	6a 09                	push   $0x9
+  800e24:	68 03 32 80 00       	push   $0x803203
+  800e29:	6a 23                	push   $0x23
+  800e2b:	68 20 32 80 00       	push   $0x803220
+  800e30:	e8 ae 1d 00 00       	call   802be3 <_panic>
+
+00800e35 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800e35:	55                   	push   %ebp
+  800e36:	89 e5                	mov    %esp,%ebp
+  800e38:	57                   	push   %edi
+  800e39:	56                   	push   %esi
+  800e3a:	53                   	push   %ebx
+  800e3b:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e3e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e43:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e46:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e49:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e4e:	89 df                	mov    %ebx,%edi
+  800e50:	89 de                	mov    %ebx,%esi
+  800e52:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e54:	85 c0                	test   %eax,%eax
+  800e56:	7f 08                	jg     800e60 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  800e58:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e5b:	5b                   	pop    %ebx
+  800e5c:	5e                   	pop    %esi
+  800e5d:	5f                   	pop    %edi
+  800e5e:	5d                   	pop    %ebp
+  800e5f:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e60:	83 ec 0c             	sub    $0xc,%esp
+  800e63:	50                   	push   %eax
+  800e64:	6a 0a                	push   $0xa
+  800e66:	68 03 32 80 00       	push   $0x803203
+  800e6b:	6a 23                	push   $0x23
+  800e6d:	68 20 32 80 00       	push   $0x803220
+  800e72:	e8 6c 1d 00 00       	call   802be3 <_panic>
+
+00800e77 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  800e77:	55                   	push   %ebp
+  800e78:	89 e5                	mov    %esp,%ebp
+  800e7a:	57                   	push   %edi
+  800e7b:	56                   	push   %esi
+  800e7c:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e7d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e80:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e83:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800e88:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e8b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e8e:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e91:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  800e93:	5b                   	pop    %ebx
+  800e94:	5e                   	pop    %esi
+  800e95:	5f                   	pop    %edi
+  800e96:	5d                   	pop    %ebp
+  800e97:	c3                   	ret
+
+00800e98 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  800e98:	55                   	push   %ebp
+  800e99:	89 e5                	mov    %esp,%ebp
+  800e9b:	57                   	push   %edi
+  800e9c:	56                   	push   %esi
+  800e9d:	53                   	push   %ebx
+  800e9e:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800ea1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ea6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ea9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eac:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800eb1:	89 df                	mov    %ebx,%edi
+  800eb3:	89 de                	mov    %ebx,%esi
+  800eb5:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800eb7:	85 c0                	test   %eax,%eax
+  800eb9:	7f 08                	jg     800ec3 <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  800ebb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ebe:	5b                   	pop    %ebx
+  800ebf:	5e                   	pop    %esi
+  800ec0:	5f                   	pop    %edi
+  800ec1:	5d                   	pop    %ebp
+  800ec2:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ec3:	83 ec 0c             	sub    $0xc,%esp
+  800ec6:	50                   	push   %eax
+  800ec7:	6a 0d                	push   $0xd
+  800ec9:	68 03 32 80 00       	push   $0x803203
+  800ece:	6a 23                	push   $0x23
+  800ed0:	68 20 32 80 00       	push   $0x803220
+  800ed5:	e8 09 1d 00 00       	call   802be3 <_panic>
+
+00800eda <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  800eda:	55                   	push   %ebp
+  800edb:	89 e5                	mov    %esp,%ebp
+  800edd:	57                   	push   %edi
+  800ede:	56                   	push   %esi
+  800edf:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800ee0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ee5:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800eea:	89 d1                	mov    %edx,%ecx
+  800eec:	89 d3                	mov    %edx,%ebx
+  800eee:	89 d7                	mov    %edx,%edi
+  800ef0:	89 d6                	mov    %edx,%esi
+  800ef2:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800ef4:	5b                   	pop    %ebx
+  800ef5:	5e                   	pop    %esi
+  800ef6:	5f                   	pop    %edi
+  800ef7:	5d                   	pop    %ebp
+  800ef8:	c3                   	ret
+
+00800ef9 <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  800ef9:	55                   	push   %ebp
+  800efa:	89 e5                	mov    %esp,%ebp
+  800efc:	57                   	push   %edi
+  800efd:	56                   	push   %esi
+  800efe:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800eff:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f02:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f05:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f0a:	be 00 00 00 00       	mov    $0x0,%esi
+  800f0f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f12:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f15:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  800f17:	5b                   	pop    %ebx
+  800f18:	5e                   	pop    %esi
+  800f19:	5f                   	pop    %edi
+  800f1a:	5d                   	pop    %ebp
+  800f1b:	c3                   	ret
+
+00800f1c <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  800f1c:	55                   	push   %ebp
+  800f1d:	89 e5                	mov    %esp,%ebp
+  800f1f:	57                   	push   %edi
+  800f20:	56                   	push   %esi
+  800f21:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f22:	be 00 00 00 00       	mov    $0x0,%esi
+  800f27:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f2a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f2d:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f32:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f35:	89 f7                	mov    %esi,%edi
+  800f37:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  800f39:	5b                   	pop    %ebx
+  800f3a:	5e                   	pop    %esi
+  800f3b:	5f                   	pop    %edi
+  800f3c:	5d                   	pop    %ebp
+  800f3d:	c3                   	ret
+
+00800f3e <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  800f3e:	55                   	push   %ebp
+  800f3f:	89 e5                	mov    %esp,%ebp
+  800f41:	57                   	push   %edi
+  800f42:	56                   	push   %esi
+  800f43:	53                   	push   %ebx
+  800f44:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  800f47:	80 3d 48 57 80 00 00 	cmpb   $0x0,0x805748
+  800f4e:	74 41                	je     800f91 <sys_batch+0x53>
+  800f50:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f53:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  800f56:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  800f5d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800f60:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  800f63:	7d 45                	jge    800faa <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  800f65:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800f68:	8b 06                	mov    (%esi),%eax
+  800f6a:	8b 56 04             	mov    0x4(%esi),%edx
+  800f6d:	8b 4e 08             	mov    0x8(%esi),%ecx
+  800f70:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  800f73:	8b 7e 10             	mov    0x10(%esi),%edi
+  800f76:	8b 76 14             	mov    0x14(%esi),%esi
+  800f79:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  800f7b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800f7e:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  800f81:	83 c6 1c             	add    $0x1c,%esi
+  800f84:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  800f87:	85 c0                	test   %eax,%eax
+  800f89:	78 1f                	js     800faa <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  800f8b:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  800f8f:	eb cc                	jmp    800f5d <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  800f91:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f96:	b8 13 00 00 00       	mov    $0x13,%eax
+  800f9b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f9e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fa1:	89 df                	mov    %ebx,%edi
+  800fa3:	89 de                	mov    %ebx,%esi
+  800fa5:	cd 30                	int    $0x30
+  800fa7:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  800faa:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800fad:	83 c4 08             	add    $0x8,%esp
+  800fb0:	5b                   	pop    %ebx
+  800fb1:	5e                   	pop    %esi
+  800fb2:	5f                   	pop    %edi
+  800fb3:	5d                   	pop    %ebp
+  800fb4:	c3                   	ret
+
+00800fb5 <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  800fb5:	55                   	push   %ebp
+  800fb6:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  800fb8:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fbb:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  800fc1:	5d                   	pop    %ebp
+  800fc2:	c3                   	ret
+
+00800fc3 <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  800fc3:	55                   	push   %ebp
+  800fc4:	89 e5                	mov    %esp,%ebp
+  800fc6:	56                   	push   %esi
+  800fc7:	53                   	push   %ebx
+  800fc8:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  800fcb:	8b 1e                	mov    (%esi),%ebx
+  800fcd:	85 db                	test   %ebx,%ebx
+  800fcf:	75 09                	jne    800fda <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  800fd1:	89 d8                	mov    %ebx,%eax
+  800fd3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fd6:	5b                   	pop    %ebx
+  800fd7:	5e                   	pop    %esi
+  800fd8:	5d                   	pop    %ebp
+  800fd9:	c3                   	ret
+  b->sb_n = 0;
+  800fda:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  800fe0:	53                   	push   %ebx
+  800fe1:	8d 46 04             	lea    0x4(%esi),%eax
+  800fe4:	50                   	push   %eax
+  800fe5:	e8 54 ff ff ff       	call   800f3e <sys_batch>
+  800fea:	83 c4 08             	add    $0x8,%esp
+  800fed:	85 c0                	test   %eax,%eax
+  800fef:	78 1e                	js     80100f <sysbatch_flush+0x4c>
+  if (r < n)
+  800ff1:	39 c3                	cmp    %eax,%ebx
+  800ff3:	7f 07                	jg     800ffc <sysbatch_flush+0x39>
+  return 0;
+  800ff5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ffa:	eb d5                	jmp    800fd1 <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  800ffc:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  800fff:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  801003:	85 db                	test   %ebx,%ebx
+  801005:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80100a:	0f 49 d8             	cmovns %eax,%ebx
+  80100d:	eb c2                	jmp    800fd1 <sysbatch_flush+0xe>
+    return r;
+  80100f:	89 c3                	mov    %eax,%ebx
+  801011:	eb be                	jmp    800fd1 <sysbatch_flush+0xe>
+
+00801013 <sysbatch_add>:
+{
+  801013:	55                   	push   %ebp
+  801014:	89 e5                	mov    %esp,%ebp
+  801016:	53                   	push   %ebx
+  801017:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  80101a:	83 3b 40             	cmpl   $0x40,(%ebx)
+  80101d:	74 41                	je     801060 <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  80101f:	8b 03                	mov    (%ebx),%eax
+  801021:	8d 50 01             	lea    0x1(%eax),%edx
+  801024:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  801026:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801029:	01 d8                	add    %ebx,%eax
+  80102b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80102e:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  801031:	8b 55 10             	mov    0x10(%ebp),%edx
+  801034:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  801037:	8b 55 14             	mov    0x14(%ebp),%edx
+  80103a:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  80103d:	8b 55 18             	mov    0x18(%ebp),%edx
+  801040:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  801043:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  801046:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  801049:	8b 55 20             	mov    0x20(%ebp),%edx
+  80104c:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  80104f:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  801056:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80105b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80105e:	c9                   	leave
+  80105f:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  801060:	53                   	push   %ebx
+  801061:	e8 5d ff ff ff       	call   800fc3 <sysbatch_flush>
+  801066:	83 c4 04             	add    $0x4,%esp
+  801069:	85 c0                	test   %eax,%eax
+  80106b:	79 b2                	jns    80101f <sysbatch_add+0xc>
+  80106d:	eb ec                	jmp    80105b <sysbatch_add+0x48>
+
+0080106f <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  80106f:	55                   	push   %ebp
+  801070:	89 e5                	mov    %esp,%ebp
+  801072:	57                   	push   %edi
+  801073:	56                   	push   %esi
+  801074:	53                   	push   %ebx
+  801075:	83 ec 14             	sub    $0x14,%esp
+  801078:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80107b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80107e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801081:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  801084:	85 c0                	test   %eax,%eax
+  801086:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80108b:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  80108e:	ff 33                	push   (%ebx)
+  801090:	50                   	push   %eax
+  801091:	e8 02 fe ff ff       	call   800e98 <sys_ipc_recv>
+  801096:	83 c4 10             	add    $0x10,%esp
+  801099:	85 c0                	test   %eax,%eax
+  80109b:	78 39                	js     8010d6 <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  80109d:	85 ff                	test   %edi,%edi
+  80109f:	74 0a                	je     8010ab <ipc_recv_pages+0x3c>
+  8010a1:	a1 44 57 80 00       	mov    0x805744,%eax
+  8010a6:	8b 40 7c             	mov    0x7c(%eax),%eax
+  8010a9:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  8010ab:	85 f6                	test   %esi,%esi
+  8010ad:	74 0d                	je     8010bc <ipc_recv_pages+0x4d>
+  8010af:	a1 44 57 80 00       	mov    0x805744,%eax
+  8010b4:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  8010ba:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  8010bc:	a1 44 57 80 00       	mov    0x805744,%eax
+  8010c1:	8b 40 74             	mov    0x74(%eax),%eax
+  8010c4:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  8010c6:	a1 44 57 80 00       	mov    0x805744,%eax
+  8010cb:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  8010ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010d1:	5b                   	pop    %ebx
+  8010d2:	5e                   	pop    %esi
+  8010d3:	5f                   	pop    %edi
+  8010d4:	5d                   	pop    %ebp
+  8010d5:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  8010d6:	85 ff                	test   %edi,%edi
+  8010d8:	74 06                	je     8010e0 <ipc_recv_pages+0x71>
+  8010da:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  8010e0:	85 f6                	test   %esi,%esi
+  8010e2:	74 06                	je     8010ea <ipc_recv_pages+0x7b>
+  8010e4:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  8010ea:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  8010f0:	eb dc                	jmp    8010ce <ipc_recv_pages+0x5f>
+
+008010f2 <ipc_recv>:
+{
+  8010f2:	55                   	push   %ebp
+  8010f3:	89 e5                	mov    %esp,%ebp
+  8010f5:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  8010f8:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  8010ff:	ff 75 10             	push   0x10(%ebp)
+  801102:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801105:	50                   	push   %eax
+  801106:	ff 75 0c             	push   0xc(%ebp)
+  801109:	ff 75 08             	push   0x8(%ebp)
+  80110c:	e8 5e ff ff ff       	call   80106f <ipc_recv_pages>
+}
+  801111:	c9                   	leave
+  801112:	c3                   	ret
+
+00801113 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  801113:	55                   	push   %ebp
+  801114:	89 e5                	mov    %esp,%ebp
+  801116:	57                   	push   %edi
+  801117:	56                   	push   %esi
+  801118:	53                   	push   %ebx
+  801119:	83 ec 0c             	sub    $0xc,%esp
+  80111c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80111f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801122:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  801125:	89 c3                	mov    %eax,%ebx
+  801127:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  80112d:	85 c0                	test   %eax,%eax
+  80112f:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801134:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  801137:	83 ec 0c             	sub    $0xc,%esp
+  80113a:	ff 75 14             	push   0x14(%ebp)
+  80113d:	ff 75 18             	push   0x18(%ebp)
+  801140:	53                   	push   %ebx
+  801141:	56                   	push   %esi
+  801142:	57                   	push   %edi
+  801143:	e8 2f fd ff ff       	call   800e77 <sys_ipc_try_send>
+  801148:	83 c4 20             	add    $0x20,%esp
+  80114b:	85 c0                	test   %eax,%eax
+  80114d:	79 1e                	jns    80116d <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  80114f:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801152:	75 07                	jne    80115b <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  801154:	e8 05 fa ff ff       	call   800b5e <sys_yield>
+  801159:	eb dc                	jmp    801137 <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  80115b:	50                   	push   %eax
+  80115c:	68 2e 32 80 00       	push   $0x80322e
+  801161:	6a 5c                	push   $0x5c
+  801163:	68 3b 32 80 00       	push   $0x80323b
+  801168:	e8 76 1a 00 00       	call   802be3 <_panic>
+  }
+}
+  80116d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801170:	5b                   	pop    %ebx
+  801171:	5e                   	pop    %esi
+  801172:	5f                   	pop    %edi
+  801173:	5d                   	pop    %ebp
+  801174:	c3                   	ret
+
+00801175 <ipc_send>:
+{
+  801175:	55                   	push   %ebp
+  801176:	89 e5                	mov    %esp,%ebp
+  801178:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  80117b:	ff 75 14             	push   0x14(%ebp)
+  80117e:	6a 01                	push   $0x1
+  801180:	ff 75 10             	push   0x10(%ebp)
+  801183:	ff 75 0c             	push   0xc(%ebp)
+  801186:	ff 75 08             	push   0x8(%ebp)
+  801189:	e8 85 ff ff ff       	call   801113 <ipc_send_pages>
+}
+  80118e:	83 c4 20             	add    $0x20,%esp
+  801191:	c9                   	leave
+  801192:	c3                   	ret
+
+00801193 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  801193:	55                   	push   %ebp
+  801194:	89 e5                	mov    %esp,%ebp
+  801196:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  801199:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  80119e:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8011a1:	c1 e0 04             	shl    $0x4,%eax
+  8011a4:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8011a9:	8b 40 50             	mov    0x50(%eax),%eax
+  8011ac:	39 c8                	cmp    %ecx,%eax
+  8011ae:	74 12                	je     8011c2 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  8011b0:	83 c2 01             	add    $0x1,%edx
+  8011b3:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  8011b9:	75 e3                	jne    80119e <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  8011bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011c0:	eb 0e                	jmp    8011d0 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  8011c2:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8011c5:	c1 e0 04             	shl    $0x4,%eax
+  8011c8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8011cd:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8011d0:	5d                   	pop    %ebp
+  8011d1:	c3                   	ret
+
+008011d2 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8011d2:	55                   	push   %ebp
+  8011d3:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8011d5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011d8:	05 00 00 00 30       	add    $0x30000000,%eax
+  8011dd:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8011e0:	5d                   	pop    %ebp
+  8011e1:	c3                   	ret
+
+008011e2 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8011e2:	55                   	push   %ebp
+  8011e3:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8011e5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011e8:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  8011eb:	66 b8 00 00          	mov    $0x0,%ax
+  8011ef:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8011f4:	5d                   	pop    %ebp
+  8011f5:	c3                   	ret
+
+008011f6 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8011f6:	55                   	push   %ebp
+  8011f7:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  8011f9:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8011fe:	eb 02                	jmp    801202 <fd_alloc+0xc>
+  801200:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801202:	89 c2                	mov    %eax,%edx
+  801204:	c1 ea 16             	shr    $0x16,%edx
+  801207:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80120e:	f6 c2 01             	test   $0x1,%dl
+  801211:	74 2b                	je     80123e <fd_alloc+0x48>
+  801213:	89 c2                	mov    %eax,%edx
+  801215:	c1 ea 0c             	shr    $0xc,%edx
+  801218:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80121f:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801225:	f6 c1 01             	test   $0x1,%cl
+  801228:	74 14                	je     80123e <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  80122a:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801230:	75 ce                	jne    801200 <fd_alloc+0xa>
+  801232:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  801237:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80123c:	eb 05                	jmp    801243 <fd_alloc+0x4d>
+      return 0;
+  80123e:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  801243:	8b 55 08             	mov    0x8(%ebp),%edx
+  801246:	89 02                	mov    %eax,(%edx)
+}
+  801248:	89 c8                	mov    %ecx,%eax
+  80124a:	5d                   	pop    %ebp
+  80124b:	c3                   	ret
+
+0080124c <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80124c:	55                   	push   %ebp
+  80124d:	89 e5                	mov    %esp,%ebp
+  80124f:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  801252:	83 f8 1f             	cmp    $0x1f,%eax
+  801255:	77 30                	ja     801287 <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  801257:	c1 e0 0c             	shl    $0xc,%eax
+  80125a:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80125f:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801265:	f6 c2 01             	test   $0x1,%dl
+  801268:	74 24                	je     80128e <fd_lookup+0x42>
+  80126a:	89 c2                	mov    %eax,%edx
+  80126c:	c1 ea 0c             	shr    $0xc,%edx
+  80126f:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801276:	f6 c2 01             	test   $0x1,%dl
+  801279:	74 1a                	je     801295 <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  80127b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80127e:	89 02                	mov    %eax,(%edx)
+  return 0;
+  801280:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801285:	5d                   	pop    %ebp
+  801286:	c3                   	ret
+    return -E_INVAL;
+  801287:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80128c:	eb f7                	jmp    801285 <fd_lookup+0x39>
+    return -E_INVAL;
+  80128e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801293:	eb f0                	jmp    801285 <fd_lookup+0x39>
+  801295:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80129a:	eb e9                	jmp    801285 <fd_lookup+0x39>
+
+0080129c <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80129c:	55                   	push   %ebp
+  80129d:	89 e5                	mov    %esp,%ebp
+  80129f:	53                   	push   %ebx
+  8012a0:	83 ec 04             	sub    $0x4,%esp
+  8012a3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  8012a6:	b8 c4 32 80 00       	mov    $0x8032c4,%eax
+  8012ab:	8b 18                	mov    (%eax),%ebx
+  8012ad:	85 db                	test   %ebx,%ebx
+  8012af:	74 0e                	je     8012bf <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  8012b1:	83 c0 04             	add    $0x4,%eax
+  8012b4:	39 13                	cmp    %edx,(%ebx)
+  8012b6:	75 f3                	jne    8012ab <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  8012b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012bd:	eb 1f                	jmp    8012de <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8012bf:	a1 44 57 80 00       	mov    0x805744,%eax
+  8012c4:	8b 40 48             	mov    0x48(%eax),%eax
+  8012c7:	83 ec 04             	sub    $0x4,%esp
+  8012ca:	52                   	push   %edx
+  8012cb:	50                   	push   %eax
+  8012cc:	68 48 32 80 00       	push   $0x803248
+  8012d1:	e8 cd ee ff ff       	call   8001a3 <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  8012d6:	83 c4 10             	add    $0x10,%esp
+  8012d9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  8012de:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8012e1:	89 1a                	mov    %ebx,(%edx)
+}
+  8012e3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012e6:	c9                   	leave
+  8012e7:	c3                   	ret
+
+008012e8 <fd_close>:
+{
+  8012e8:	55                   	push   %ebp
+  8012e9:	89 e5                	mov    %esp,%ebp
+  8012eb:	57                   	push   %edi
+  8012ec:	56                   	push   %esi
+  8012ed:	53                   	push   %ebx
+  8012ee:	83 ec 24             	sub    $0x24,%esp
+  8012f1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8012f4:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8012f7:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8012fa:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8012fb:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801301:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801304:	50                   	push   %eax
+  801305:	e8 42 ff ff ff       	call   80124c <fd_lookup>
+  80130a:	89 c3                	mov    %eax,%ebx
+  80130c:	83 c4 10             	add    $0x10,%esp
+  80130f:	85 c0                	test   %eax,%eax
+  801311:	78 05                	js     801318 <fd_close+0x30>
+      || fd != fd2)
+  801313:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801316:	74 16                	je     80132e <fd_close+0x46>
+    return must_exist ? r : 0;
+  801318:	89 f8                	mov    %edi,%eax
+  80131a:	84 c0                	test   %al,%al
+  80131c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801321:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801324:	89 d8                	mov    %ebx,%eax
+  801326:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801329:	5b                   	pop    %ebx
+  80132a:	5e                   	pop    %esi
+  80132b:	5f                   	pop    %edi
+  80132c:	5d                   	pop    %ebp
+  80132d:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80132e:	83 ec 08             	sub    $0x8,%esp
+  801331:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801334:	50                   	push   %eax
+  801335:	ff 36                	push   (%esi)
+  801337:	e8 60 ff ff ff       	call   80129c <dev_lookup>
+  80133c:	89 c3                	mov    %eax,%ebx
+  80133e:	83 c4 10             	add    $0x10,%esp
+  801341:	85 c0                	test   %eax,%eax
+  801343:	78 1a                	js     80135f <fd_close+0x77>
+    if (dev->dev_close)
+  801345:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801348:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  80134b:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  801350:	85 c0                	test   %eax,%eax
+  801352:	74 0b                	je     80135f <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  801354:	83 ec 0c             	sub    $0xc,%esp
+  801357:	56                   	push   %esi
+  801358:	ff d0                	call   *%eax
+  80135a:	89 c3                	mov    %eax,%ebx
+  80135c:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  80135f:	83 ec 08             	sub    $0x8,%esp
+  801362:	56                   	push   %esi
+  801363:	6a 00                	push   $0x0
+  801365:	e8 db f8 ff ff       	call   800c45 <sys_page_unmap>
+  return r;
+  80136a:	83 c4 10             	add    $0x10,%esp
+  80136d:	eb b5                	jmp    801324 <fd_close+0x3c>
+
+0080136f <close>:
+
+int
+close(int fdnum)
+{
+  80136f:	55                   	push   %ebp
+  801370:	89 e5                	mov    %esp,%ebp
+  801372:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801375:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801378:	50                   	push   %eax
+  801379:	ff 75 08             	push   0x8(%ebp)
+  80137c:	e8 cb fe ff ff       	call   80124c <fd_lookup>
+  801381:	83 c4 10             	add    $0x10,%esp
+  801384:	85 c0                	test   %eax,%eax
+  801386:	79 02                	jns    80138a <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  801388:	c9                   	leave
+  801389:	c3                   	ret
+    return fd_close(fd, 1);
+  80138a:	83 ec 08             	sub    $0x8,%esp
+  80138d:	6a 01                	push   $0x1
+  80138f:	ff 75 f4             	push   -0xc(%ebp)
+  801392:	e8 51 ff ff ff       	call   8012e8 <fd_close>
+  801397:	83 c4 10             	add    $0x10,%esp
+  80139a:	eb ec                	jmp    801388 <close+0x19>
+
+0080139c <close_all>:
+
+void
+close_all(void)
+{
+  80139c:	55                   	push   %ebp
+  80139d:	89 e5                	mov    %esp,%ebp
+  80139f:	53                   	push   %ebx
+  8013a0:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  8013a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  8013a8:	83 ec 0c             	sub    $0xc,%esp
+  8013ab:	53                   	push   %ebx
+  8013ac:	e8 be ff ff ff       	call   80136f <close>
+  for (i = 0; i < MAXFD; i++)
+  8013b1:	83 c3 01             	add    $0x1,%ebx
+  8013b4:	83 c4 10             	add    $0x10,%esp
+  8013b7:	83 fb 20             	cmp    $0x20,%ebx
+  8013ba:	75 ec                	jne    8013a8 <close_all+0xc>
+}
+  8013bc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013bf:	c9                   	leave
+  8013c0:	c3                   	ret
+
+008013c1 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8013c1:	55                   	push   %ebp
+  8013c2:	89 e5                	mov    %esp,%ebp
+  8013c4:	57                   	push   %edi
+  8013c5:	56                   	push   %esi
+  8013c6:	53                   	push   %ebx
+  8013c7:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8013ca:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8013cd:	50                   	push   %eax
+  8013ce:	ff 75 08             	push   0x8(%ebp)
+  8013d1:	e8 76 fe ff ff       	call   80124c <fd_lookup>
+  8013d6:	89 c6                	mov    %eax,%esi
+  8013d8:	83 c4 10             	add    $0x10,%esp
+  8013db:	85 c0                	test   %eax,%eax
+  8013dd:	0f 88 0a 01 00 00    	js     8014ed <dup+0x12c>
+    return r;
+  close(newfdnum);
+  8013e3:	83 ec 0c             	sub    $0xc,%esp
+  8013e6:	ff 75 0c             	push   0xc(%ebp)
+  8013e9:	e8 81 ff ff ff       	call   80136f <close>
+
+  newfd = INDEX2FD(newfdnum);
+  8013ee:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8013f1:	c1 e0 0c             	shl    $0xc,%eax
+  8013f4:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  8013fa:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  8013fd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801400:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  801403:	89 04 24             	mov    %eax,(%esp)
+  801406:	e8 d7 fd ff ff       	call   8011e2 <fd2data>
+  80140b:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  80140d:	89 3c 24             	mov    %edi,(%esp)
+  801410:	e8 cd fd ff ff       	call   8011e2 <fd2data>
+  801415:	83 c4 10             	add    $0x10,%esp
+  801418:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80141b:	89 f3                	mov    %esi,%ebx
+  80141d:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  801423:	89 c6                	mov    %eax,%esi
+  801425:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801428:	89 cf                	mov    %ecx,%edi
+  80142a:	eb 0c                	jmp    801438 <dup+0x77>
+  80142c:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801432:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801438:	39 fb                	cmp    %edi,%ebx
+  80143a:	74 7b                	je     8014b7 <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  80143c:	89 d8                	mov    %ebx,%eax
+  80143e:	c1 e8 16             	shr    $0x16,%eax
+  801441:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801448:	a8 01                	test   $0x1,%al
+  80144a:	74 e0                	je     80142c <dup+0x6b>
+  80144c:	89 d8                	mov    %ebx,%eax
+  80144e:	c1 e8 0c             	shr    $0xc,%eax
+  801451:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801458:	f6 c2 01             	test   $0x1,%dl
+  80145b:	74 cf                	je     80142c <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  80145d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  801464:	83 ec 0c             	sub    $0xc,%esp
+  801467:	25 07 0e 00 00       	and    $0xe07,%eax
+  80146c:	50                   	push   %eax
+  80146d:	56                   	push   %esi
+  80146e:	6a 00                	push   $0x0
+  801470:	53                   	push   %ebx
+  801471:	6a 00                	push   $0x0
+  801473:	e8 8b f7 ff ff       	call   800c03 <sys_page_map>
+  801478:	83 c4 20             	add    $0x20,%esp
+  80147b:	85 c0                	test   %eax,%eax
+  80147d:	79 ad                	jns    80142c <dup+0x6b>
+  80147f:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801482:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  801484:	83 ec 08             	sub    $0x8,%esp
+  801487:	ff 75 d4             	push   -0x2c(%ebp)
+  80148a:	6a 00                	push   $0x0
+  80148c:	e8 b4 f7 ff ff       	call   800c45 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801491:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  801494:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  80149a:	83 c4 10             	add    $0x10,%esp
+  80149d:	39 df                	cmp    %ebx,%edi
+  80149f:	74 4c                	je     8014ed <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  8014a1:	83 ec 08             	sub    $0x8,%esp
+  8014a4:	57                   	push   %edi
+  8014a5:	6a 00                	push   $0x0
+  8014a7:	e8 99 f7 ff ff       	call   800c45 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8014ac:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  8014b2:	83 c4 10             	add    $0x10,%esp
+  8014b5:	eb e6                	jmp    80149d <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8014b7:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8014ba:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8014bd:	89 c8                	mov    %ecx,%eax
+  8014bf:	c1 e8 0c             	shr    $0xc,%eax
+  8014c2:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8014c9:	83 ec 0c             	sub    $0xc,%esp
+  8014cc:	25 07 0e 00 00       	and    $0xe07,%eax
+  8014d1:	50                   	push   %eax
+  8014d2:	ff 75 d4             	push   -0x2c(%ebp)
+  8014d5:	6a 00                	push   $0x0
+  8014d7:	51                   	push   %ecx
+  8014d8:	6a 00                	push   $0x0
+  8014da:	e8 24 f7 ff ff       	call   800c03 <sys_page_map>
+  8014df:	89 c6                	mov    %eax,%esi
+  8014e1:	83 c4 20             	add    $0x20,%esp
+  8014e4:	85 c0                	test   %eax,%eax
+  8014e6:	78 9c                	js     801484 <dup+0xc3>
+  return newfdnum;
+  8014e8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8014eb:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  8014ed:	89 f0                	mov    %esi,%eax
+  8014ef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014f2:	5b                   	pop    %ebx
+  8014f3:	5e                   	pop    %esi
+  8014f4:	5f                   	pop    %edi
+  8014f5:	5d                   	pop    %ebp
+  8014f6:	c3                   	ret
+
+008014f7 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8014f7:	55                   	push   %ebp
+  8014f8:	89 e5                	mov    %esp,%ebp
+  8014fa:	56                   	push   %esi
+  8014fb:	53                   	push   %ebx
+  8014fc:	83 ec 18             	sub    $0x18,%esp
+  8014ff:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801502:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801505:	50                   	push   %eax
+  801506:	56                   	push   %esi
+  801507:	e8 40 fd ff ff       	call   80124c <fd_lookup>
+  80150c:	83 c4 10             	add    $0x10,%esp
+  80150f:	85 c0                	test   %eax,%eax
+  801511:	78 3c                	js     80154f <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801513:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801516:	83 ec 08             	sub    $0x8,%esp
+  801519:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80151c:	50                   	push   %eax
+  80151d:	ff 33                	push   (%ebx)
+  80151f:	e8 78 fd ff ff       	call   80129c <dev_lookup>
+  801524:	83 c4 10             	add    $0x10,%esp
+  801527:	85 c0                	test   %eax,%eax
+  801529:	78 24                	js     80154f <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80152b:	8b 43 08             	mov    0x8(%ebx),%eax
+  80152e:	83 e0 03             	and    $0x3,%eax
+  801531:	83 f8 01             	cmp    $0x1,%eax
+  801534:	74 20                	je     801556 <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  801536:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801539:	8b 40 08             	mov    0x8(%eax),%eax
+  80153c:	85 c0                	test   %eax,%eax
+  80153e:	74 37                	je     801577 <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  801540:	83 ec 04             	sub    $0x4,%esp
+  801543:	ff 75 10             	push   0x10(%ebp)
+  801546:	ff 75 0c             	push   0xc(%ebp)
+  801549:	53                   	push   %ebx
+  80154a:	ff d0                	call   *%eax
+  80154c:	83 c4 10             	add    $0x10,%esp
+}
+  80154f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801552:	5b                   	pop    %ebx
+  801553:	5e                   	pop    %esi
+  801554:	5d                   	pop    %ebp
+  801555:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801556:	a1 44 57 80 00       	mov    0x805744,%eax
+  80155b:	8b 40 48             	mov    0x48(%eax),%eax
+  80155e:	83 ec 04             	sub    $0x4,%esp
+  801561:	56                   	push   %esi
+  801562:	50                   	push   %eax
+  801563:	68 89 32 80 00       	push   $0x803289
+  801568:	e8 36 ec ff ff       	call   8001a3 <cprintf>
+    return -E_INVAL;
+  80156d:	83 c4 10             	add    $0x10,%esp
+  801570:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801575:	eb d8                	jmp    80154f <read+0x58>
+    return -E_NOT_SUPP;
+  801577:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80157c:	eb d1                	jmp    80154f <read+0x58>
+
+0080157e <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80157e:	55                   	push   %ebp
+  80157f:	89 e5                	mov    %esp,%ebp
+  801581:	57                   	push   %edi
+  801582:	56                   	push   %esi
+  801583:	53                   	push   %ebx
+  801584:	83 ec 0c             	sub    $0xc,%esp
+  801587:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80158a:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  80158d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801592:	eb 02                	jmp    801596 <readn+0x18>
+  801594:	01 c3                	add    %eax,%ebx
+  801596:	39 f3                	cmp    %esi,%ebx
+  801598:	73 21                	jae    8015bb <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  80159a:	83 ec 04             	sub    $0x4,%esp
+  80159d:	89 f0                	mov    %esi,%eax
+  80159f:	29 d8                	sub    %ebx,%eax
+  8015a1:	50                   	push   %eax
+  8015a2:	89 d8                	mov    %ebx,%eax
+  8015a4:	03 45 0c             	add    0xc(%ebp),%eax
+  8015a7:	50                   	push   %eax
+  8015a8:	57                   	push   %edi
+  8015a9:	e8 49 ff ff ff       	call   8014f7 <read>
+    if (m < 0)
+  8015ae:	83 c4 10             	add    $0x10,%esp
+  8015b1:	85 c0                	test   %eax,%eax
+  8015b3:	78 04                	js     8015b9 <readn+0x3b>
+      return m;
+    if (m == 0)
+  8015b5:	75 dd                	jne    801594 <readn+0x16>
+  8015b7:	eb 02                	jmp    8015bb <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  8015b9:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  8015bb:	89 d8                	mov    %ebx,%eax
+  8015bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015c0:	5b                   	pop    %ebx
+  8015c1:	5e                   	pop    %esi
+  8015c2:	5f                   	pop    %edi
+  8015c3:	5d                   	pop    %ebp
+  8015c4:	c3                   	ret
+
+008015c5 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8015c5:	55                   	push   %ebp
+  8015c6:	89 e5                	mov    %esp,%ebp
+  8015c8:	56                   	push   %esi
+  8015c9:	53                   	push   %ebx
+  8015ca:	83 ec 18             	sub    $0x18,%esp
+  8015cd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  8015d0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8015d3:	50                   	push   %eax
+  8015d4:	53                   	push   %ebx
+  8015d5:	e8 72 fc ff ff       	call   80124c <fd_lookup>
+  8015da:	83 c4 10             	add    $0x10,%esp
+  8015dd:	85 c0                	test   %eax,%eax
+  8015df:	78 37                	js     801618 <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8015e1:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8015e4:	83 ec 08             	sub    $0x8,%esp
+  8015e7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015ea:	50                   	push   %eax
+  8015eb:	ff 36                	push   (%esi)
+  8015ed:	e8 aa fc ff ff       	call   80129c <dev_lookup>
+  8015f2:	83 c4 10             	add    $0x10,%esp
+  8015f5:	85 c0                	test   %eax,%eax
+  8015f7:	78 1f                	js     801618 <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8015f9:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8015fd:	74 20                	je     80161f <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  8015ff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801602:	8b 40 0c             	mov    0xc(%eax),%eax
+  801605:	85 c0                	test   %eax,%eax
+  801607:	74 37                	je     801640 <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  801609:	83 ec 04             	sub    $0x4,%esp
+  80160c:	ff 75 10             	push   0x10(%ebp)
+  80160f:	ff 75 0c             	push   0xc(%ebp)
+  801612:	56                   	push   %esi
+  801613:	ff d0                	call   *%eax
+  801615:	83 c4 10             	add    $0x10,%esp
+}
+  801618:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80161b:	5b                   	pop    %ebx
+  80161c:	5e                   	pop    %esi
+  80161d:	5d                   	pop    %ebp
+  80161e:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80161f:	a1 44 57 80 00       	mov    0x805744,%eax
+  801624:	8b 40 48             	mov    0x48(%eax),%eax
+  801627:	83 ec 04             	sub    $0x4,%esp
+  80162a:	53                   	push   %ebx
+  80162b:	50                   	push   %eax
+  80162c:	68 a5 32 80 00       	push   $0x8032a5
+  801631:	e8 6d eb ff ff       	call   8001a3 <cprintf>
+    return -E_INVAL;
+  801636:	83 c4 10             	add    $0x10,%esp
+  801639:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80163e:	eb d8                	jmp    801618 <write+0x53>
+    return -E_NOT_SUPP;
+  801640:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801645:	eb d1                	jmp    801618 <write+0x53>
+
+00801647 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801647:	55                   	push   %ebp
+  801648:	89 e5                	mov    %esp,%ebp
+  80164a:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80164d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801650:	50                   	push   %eax
+  801651:	ff 75 08             	push   0x8(%ebp)
+  801654:	e8 f3 fb ff ff       	call   80124c <fd_lookup>
+  801659:	83 c4 10             	add    $0x10,%esp
+  80165c:	85 c0                	test   %eax,%eax
+  80165e:	78 0e                	js     80166e <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  801660:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801663:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801666:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  801669:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80166e:	c9                   	leave
+  80166f:	c3                   	ret
+
+00801670 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801670:	55                   	push   %ebp
+  801671:	89 e5                	mov    %esp,%ebp
+  801673:	56                   	push   %esi
+  801674:	53                   	push   %ebx
+  801675:	83 ec 18             	sub    $0x18,%esp
+  801678:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  80167b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80167e:	50                   	push   %eax
+  80167f:	53                   	push   %ebx
+  801680:	e8 c7 fb ff ff       	call   80124c <fd_lookup>
+  801685:	83 c4 10             	add    $0x10,%esp
+  801688:	85 c0                	test   %eax,%eax
+  80168a:	78 34                	js     8016c0 <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80168c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80168f:	83 ec 08             	sub    $0x8,%esp
+  801692:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801695:	50                   	push   %eax
+  801696:	ff 36                	push   (%esi)
+  801698:	e8 ff fb ff ff       	call   80129c <dev_lookup>
+  80169d:	83 c4 10             	add    $0x10,%esp
+  8016a0:	85 c0                	test   %eax,%eax
+  8016a2:	78 1c                	js     8016c0 <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8016a4:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8016a8:	74 1d                	je     8016c7 <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  8016aa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016ad:	8b 40 18             	mov    0x18(%eax),%eax
+  8016b0:	85 c0                	test   %eax,%eax
+  8016b2:	74 34                	je     8016e8 <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  8016b4:	83 ec 08             	sub    $0x8,%esp
+  8016b7:	ff 75 0c             	push   0xc(%ebp)
+  8016ba:	56                   	push   %esi
+  8016bb:	ff d0                	call   *%eax
+  8016bd:	83 c4 10             	add    $0x10,%esp
+}
+  8016c0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016c3:	5b                   	pop    %ebx
+  8016c4:	5e                   	pop    %esi
+  8016c5:	5d                   	pop    %ebp
+  8016c6:	c3                   	ret
+            thisenv->env_id, fdnum);
+  8016c7:	a1 44 57 80 00       	mov    0x805744,%eax
+  8016cc:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8016cf:	83 ec 04             	sub    $0x4,%esp
+  8016d2:	53                   	push   %ebx
+  8016d3:	50                   	push   %eax
+  8016d4:	68 68 32 80 00       	push   $0x803268
+  8016d9:	e8 c5 ea ff ff       	call   8001a3 <cprintf>
+    return -E_INVAL;
+  8016de:	83 c4 10             	add    $0x10,%esp
+  8016e1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016e6:	eb d8                	jmp    8016c0 <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  8016e8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016ed:	eb d1                	jmp    8016c0 <ftruncate+0x50>
+
+008016ef <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8016ef:	55                   	push   %ebp
+  8016f0:	89 e5                	mov    %esp,%ebp
+  8016f2:	56                   	push   %esi
+  8016f3:	53                   	push   %ebx
+  8016f4:	83 ec 18             	sub    $0x18,%esp
+  8016f7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016fa:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016fd:	50                   	push   %eax
+  8016fe:	ff 75 08             	push   0x8(%ebp)
+  801701:	e8 46 fb ff ff       	call   80124c <fd_lookup>
+  801706:	83 c4 10             	add    $0x10,%esp
+  801709:	85 c0                	test   %eax,%eax
+  80170b:	78 49                	js     801756 <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80170d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801710:	83 ec 08             	sub    $0x8,%esp
+  801713:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801716:	50                   	push   %eax
+  801717:	ff 36                	push   (%esi)
+  801719:	e8 7e fb ff ff       	call   80129c <dev_lookup>
+  80171e:	83 c4 10             	add    $0x10,%esp
+  801721:	85 c0                	test   %eax,%eax
+  801723:	78 31                	js     801756 <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  801725:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801728:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80172c:	74 2f                	je     80175d <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  80172e:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  801731:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801738:	00 00 00 
+  stat->st_isdir = 0;
+  80173b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801742:	00 00 00 
+  stat->st_dev = dev;
+  801745:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  80174b:	83 ec 08             	sub    $0x8,%esp
+  80174e:	53                   	push   %ebx
+  80174f:	56                   	push   %esi
+  801750:	ff 50 14             	call   *0x14(%eax)
+  801753:	83 c4 10             	add    $0x10,%esp
+}
+  801756:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801759:	5b                   	pop    %ebx
+  80175a:	5e                   	pop    %esi
+  80175b:	5d                   	pop    %ebp
+  80175c:	c3                   	ret
+    return -E_NOT_SUPP;
+  80175d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801762:	eb f2                	jmp    801756 <fstat+0x67>
+
+00801764 <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  801764:	55                   	push   %ebp
+  801765:	89 e5                	mov    %esp,%ebp
+  801767:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  80176a:	ff 75 0c             	push   0xc(%ebp)
+  80176d:	ff 75 08             	push   0x8(%ebp)
+  801770:	e8 58 07 00 00       	call   801ecd <file_stat>
+}
+  801775:	c9                   	leave
+  801776:	c3                   	ret
+
+00801777 <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  801777:	55                   	push   %ebp
+  801778:	89 e5                	mov    %esp,%ebp
+  80177a:	57                   	push   %edi
+  80177b:	56                   	push   %esi
+  80177c:	53                   	push   %ebx
+  80177d:	83 ec 1c             	sub    $0x1c,%esp
+  801780:	89 c7                	mov    %eax,%edi
+  801782:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801785:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801788:	e9 a2 00 00 00       	jmp    80182f <fsipc_send+0xb8>
+  nfsenvs = 0;
+  80178d:	c7 05 00 50 80 00 00 	movl   $0x0,0x805000
+  801794:	00 00 00 
+  801797:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80179c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  8017a1:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  8017a6:	be 01 00 00 00       	mov    $0x1,%esi
+  8017ab:	eb 0f                	jmp    8017bc <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  8017ad:	83 c0 01             	add    $0x1,%eax
+  8017b0:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8017b5:	74 49                	je     801800 <fsipc_send+0x89>
+  8017b7:	83 f9 07             	cmp    $0x7,%ecx
+  8017ba:	7f 50                	jg     80180c <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  8017bc:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  8017bf:	c1 e2 04             	shl    $0x4,%edx
+  8017c2:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8017c8:	8b 52 50             	mov    0x50(%edx),%edx
+  8017cb:	83 fa 01             	cmp    $0x1,%edx
+  8017ce:	75 dd                	jne    8017ad <fsipc_send+0x36>
+  8017d0:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  8017d3:	c1 e2 04             	shl    $0x4,%edx
+  8017d6:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8017dc:	8b 52 54             	mov    0x54(%edx),%edx
+  8017df:	85 d2                	test   %edx,%edx
+  8017e1:	74 ca                	je     8017ad <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  8017e3:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  8017e6:	c1 e2 04             	shl    $0x4,%edx
+  8017e9:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8017ef:	8b 52 48             	mov    0x48(%edx),%edx
+  8017f2:	89 14 8d 20 50 80 00 	mov    %edx,0x805020(,%ecx,4)
+  8017f9:	8d 49 01             	lea    0x1(%ecx),%ecx
+  8017fc:	89 f3                	mov    %esi,%ebx
+  8017fe:	eb ad                	jmp    8017ad <fsipc_send+0x36>
+  801800:	84 db                	test   %bl,%bl
+  801802:	74 38                	je     80183c <fsipc_send+0xc5>
+  801804:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  80180a:	eb 30                	jmp    80183c <fsipc_send+0xc5>
+  80180c:	84 db                	test   %bl,%bl
+  80180e:	74 2c                	je     80183c <fsipc_send+0xc5>
+  801810:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  801816:	eb 24                	jmp    80183c <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  801818:	50                   	push   %eax
+  801819:	68 d4 32 80 00       	push   $0x8032d4
+  80181e:	6a 34                	push   $0x34
+  801820:	68 de 32 80 00       	push   $0x8032de
+  801825:	e8 b9 13 00 00       	call   802be3 <_panic>
+    }
+    sys_yield();
+  80182a:	e8 2f f3 ff ff       	call   800b5e <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  80182f:	83 3d 00 50 80 00 03 	cmpl   $0x3,0x805000
+  801836:	0f 8e 51 ff ff ff    	jle    80178d <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  80183c:	a1 44 57 80 00       	mov    0x805744,%eax
+  801841:	8b 70 48             	mov    0x48(%eax),%esi
+  801844:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  80184a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80184f:	8b 0d 00 50 80 00    	mov    0x805000,%ecx
+  801855:	39 d9                	cmp    %ebx,%ecx
+  801857:	7e d1                	jle    80182a <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  801859:	83 ec 0c             	sub    $0xc,%esp
+  80185c:	ff 75 e0             	push   -0x20(%ebp)
+  80185f:	6a 07                	push   $0x7
+  801861:	ff 75 e4             	push   -0x1c(%ebp)
+  801864:	57                   	push   %edi
+  801865:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  801868:	99                   	cltd
+  801869:	f7 f9                	idiv   %ecx
+  80186b:	ff 34 95 20 50 80 00 	push   0x805020(,%edx,4)
+  801872:	e8 00 f6 ff ff       	call   800e77 <sys_ipc_try_send>
+      if (r == 0)
+  801877:	83 c4 20             	add    $0x20,%esp
+  80187a:	85 c0                	test   %eax,%eax
+  80187c:	74 0a                	je     801888 <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  80187e:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801881:	75 95                	jne    801818 <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  801883:	83 c3 01             	add    $0x1,%ebx
+  801886:	eb c7                	jmp    80184f <fsipc_send+0xd8>
+  }
+}
+  801888:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80188b:	5b                   	pop    %ebx
+  80188c:	5e                   	pop    %esi
+  80188d:	5f                   	pop    %edi
+  80188e:	5d                   	pop    %ebp
+  80188f:	c3                   	ret
+
+00801890 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801890:	55                   	push   %ebp
+  801891:	89 e5                	mov    %esp,%ebp
+  801893:	53                   	push   %ebx
+  801894:	83 ec 14             	sub    $0x14,%esp
+  801897:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  801899:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  8018a0:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8018a5:	ba 00 60 80 00       	mov    $0x806000,%edx
+  8018aa:	e8 c8 fe ff ff       	call   801777 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  8018af:	6a 00                	push   $0x0
+  8018b1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018b4:	50                   	push   %eax
+  8018b5:	53                   	push   %ebx
+  8018b6:	6a 00                	push   $0x0
+  8018b8:	e8 b2 f7 ff ff       	call   80106f <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  8018bd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018c0:	c9                   	leave
+  8018c1:	c3                   	ret
+
+008018c2 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8018c2:	55                   	push   %ebp
+  8018c3:	89 e5                	mov    %esp,%ebp
+  8018c5:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8018c8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018cb:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018ce:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.set_size.req_size = newsize;
+  8018d3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8018d6:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  8018db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018e0:	b8 02 00 00 00       	mov    $0x2,%eax
+  8018e5:	e8 a6 ff ff ff       	call   801890 <fsipc>
+}
+  8018ea:	c9                   	leave
+  8018eb:	c3                   	ret
+
+008018ec <devfile_flush>:
+{
+  8018ec:	55                   	push   %ebp
+  8018ed:	89 e5                	mov    %esp,%ebp
+  8018ef:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8018f2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018f5:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018f8:	a3 00 60 80 00       	mov    %eax,0x806000
+  return fsipc(FSREQ_FLUSH, NULL);
+  8018fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  801902:	b8 06 00 00 00       	mov    $0x6,%eax
+  801907:	e8 84 ff ff ff       	call   801890 <fsipc>
+}
+  80190c:	c9                   	leave
+  80190d:	c3                   	ret
+
+0080190e <devfile_stat>:
+{
+  80190e:	55                   	push   %ebp
+  80190f:	89 e5                	mov    %esp,%ebp
+  801911:	53                   	push   %ebx
+  801912:	83 ec 04             	sub    $0x4,%esp
+  801915:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801918:	8b 45 08             	mov    0x8(%ebp),%eax
+  80191b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80191e:	a3 00 60 80 00       	mov    %eax,0x806000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801923:	ba 00 00 00 00       	mov    $0x0,%edx
+  801928:	b8 05 00 00 00       	mov    $0x5,%eax
+  80192d:	e8 5e ff ff ff       	call   801890 <fsipc>
+  801932:	85 c0                	test   %eax,%eax
+  801934:	78 2c                	js     801962 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801936:	83 ec 08             	sub    $0x8,%esp
+  801939:	68 00 60 80 00       	push   $0x806000
+  80193e:	53                   	push   %ebx
+  80193f:	e8 4d ee ff ff       	call   800791 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  801944:	a1 80 60 80 00       	mov    0x806080,%eax
+  801949:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80194f:	a1 84 60 80 00       	mov    0x806084,%eax
+  801954:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  80195a:	83 c4 10             	add    $0x10,%esp
+  80195d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801962:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801965:	c9                   	leave
+  801966:	c3                   	ret
+
+00801967 <fsv_alloc>:
+{
+  801967:	55                   	push   %ebp
+  801968:	89 e5                	mov    %esp,%ebp
+  80196a:	56                   	push   %esi
+  80196b:	53                   	push   %ebx
+  80196c:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  80196e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801973:	eb 22                	jmp    801997 <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  801975:	83 ec 04             	sub    $0x4,%esp
+  801978:	6a 00                	push   $0x0
+  80197a:	6a 00                	push   $0x0
+  80197c:	6a 07                	push   $0x7
+  80197e:	50                   	push   %eax
+  80197f:	6a 00                	push   $0x0
+  801981:	6a 04                	push   $0x4
+  801983:	68 40 50 80 00       	push   $0x805040
+  801988:	e8 86 f6 ff ff       	call   801013 <sysbatch_add>
+  80198d:	83 c4 20             	add    $0x20,%esp
+  801990:	85 c0                	test   %eax,%eax
+  801992:	78 48                	js     8019dc <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  801994:	83 c3 01             	add    $0x1,%ebx
+  801997:	39 f3                	cmp    %esi,%ebx
+  801999:	74 31                	je     8019cc <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  80199b:	89 d8                	mov    %ebx,%eax
+  80199d:	c1 e0 0c             	shl    $0xc,%eax
+  8019a0:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  8019a5:	89 c2                	mov    %eax,%edx
+  8019a7:	c1 ea 16             	shr    $0x16,%edx
+  8019aa:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8019b1:	f6 c2 01             	test   $0x1,%dl
+  8019b4:	74 bf                	je     801975 <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  8019b6:	89 c2                	mov    %eax,%edx
+  8019b8:	c1 ea 0c             	shr    $0xc,%edx
+  8019bb:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8019c2:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  8019c5:	83 fa 03             	cmp    $0x3,%edx
+  8019c8:	75 ab                	jne    801975 <fsv_alloc+0xe>
+  8019ca:	eb c8                	jmp    801994 <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  8019cc:	83 ec 0c             	sub    $0xc,%esp
+  8019cf:	68 40 50 80 00       	push   $0x805040
+  8019d4:	e8 ea f5 ff ff       	call   800fc3 <sysbatch_flush>
+  8019d9:	83 c4 10             	add    $0x10,%esp
+}
+  8019dc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019df:	5b                   	pop    %ebx
+  8019e0:	5e                   	pop    %esi
+  8019e1:	5d                   	pop    %ebp
+  8019e2:	c3                   	ret
+
+008019e3 <devfile_read>:
+{
+  8019e3:	55                   	push   %ebp
+  8019e4:	89 e5                	mov    %esp,%ebp
+  8019e6:	57                   	push   %edi
+  8019e7:	56                   	push   %esi
+  8019e8:	53                   	push   %ebx
+  8019e9:	83 ec 3c             	sub    $0x3c,%esp
+  8019ec:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  8019ef:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  8019f5:	77 57                	ja     801a4e <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8019f7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019fa:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019fd:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read.req_n = n;
+  801a02:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801a08:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a0d:	b8 03 00 00 00       	mov    $0x3,%eax
+  801a12:	e8 79 fe ff ff       	call   801890 <fsipc>
+  801a17:	89 c6                	mov    %eax,%esi
+  801a19:	85 c0                	test   %eax,%eax
+  801a1b:	78 27                	js     801a44 <devfile_read+0x61>
+  assert(r <= n);
+  801a1d:	39 c3                	cmp    %eax,%ebx
+  801a1f:	0f 82 0e 02 00 00    	jb     801c33 <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  801a25:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801a2a:	0f 8f 1c 02 00 00    	jg     801c4c <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801a30:	83 ec 04             	sub    $0x4,%esp
+  801a33:	50                   	push   %eax
+  801a34:	68 00 60 80 00       	push   $0x806000
+  801a39:	ff 75 0c             	push   0xc(%ebp)
+  801a3c:	e8 d6 ee ff ff       	call   800917 <memmove>
+  return r;
+  801a41:	83 c4 10             	add    $0x10,%esp
+}
+  801a44:	89 f0                	mov    %esi,%eax
+  801a46:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a49:	5b                   	pop    %ebx
+  801a4a:	5e                   	pop    %esi
+  801a4b:	5f                   	pop    %edi
+  801a4c:	5d                   	pop    %ebp
+  801a4d:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  801a4e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a53:	e8 0f ff ff ff       	call   801967 <fsv_alloc>
+  801a58:	89 c6                	mov    %eax,%esi
+  801a5a:	85 c0                	test   %eax,%eax
+  801a5c:	78 e6                	js     801a44 <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  801a5e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a61:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a64:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  801a69:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a6c:	8b 40 04             	mov    0x4(%eax),%eax
+  801a6f:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  801a74:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  801a7a:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801a81:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801a86:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801a8b:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801a90:	e8 e2 fc ff ff       	call   801777 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801a95:	6a 00                	push   $0x0
+  801a97:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801a9a:	50                   	push   %eax
+  801a9b:	68 00 10 c0 9f       	push   $0x9fc01000
+  801aa0:	6a 00                	push   $0x0
+  801aa2:	e8 c8 f5 ff ff       	call   80106f <ipc_recv_pages>
+  801aa7:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  801aa9:	83 c4 10             	add    $0x10,%esp
+  801aac:	85 c0                	test   %eax,%eax
+  801aae:	7e 94                	jle    801a44 <devfile_read+0x61>
+  assert(r <= n);
+  801ab0:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801ab3:	39 c3                	cmp    %eax,%ebx
+  801ab5:	72 2e                	jb     801ae5 <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801ab7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801aba:	8b 40 04             	mov    0x4(%eax),%eax
+  801abd:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801ac2:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  801ac5:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801ac8:	c1 e2 0c             	shl    $0xc,%edx
+  801acb:	39 ca                	cmp    %ecx,%edx
+  801acd:	72 2f                	jb     801afe <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  801acf:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  801ad4:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  801ad7:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  801adb:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801ae0:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  801ae3:	eb 52                	jmp    801b37 <devfile_read+0x154>
+  assert(r <= n);
+  801ae5:	68 e9 32 80 00       	push   $0x8032e9
+  801aea:	68 f0 32 80 00       	push   $0x8032f0
+  801aef:	68 49 01 00 00       	push   $0x149
+  801af4:	68 de 32 80 00       	push   $0x8032de
+  801af9:	e8 e5 10 00 00       	call   802be3 <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801afe:	68 14 33 80 00       	push   $0x803314
+  801b03:	68 f0 32 80 00       	push   $0x8032f0
+  801b08:	68 4a 01 00 00       	push   $0x14a
+  801b0d:	68 de 32 80 00       	push   $0x8032de
+  801b12:	e8 cc 10 00 00       	call   802be3 <_panic>
+      memmove(dst + done, src + done, m);
+  801b17:	83 ec 04             	sub    $0x4,%esp
+  801b1a:	53                   	push   %ebx
+  801b1b:	56                   	push   %esi
+  801b1c:	89 f8                	mov    %edi,%eax
+  801b1e:	03 45 0c             	add    0xc(%ebp),%eax
+  801b21:	50                   	push   %eax
+  801b22:	e8 f0 ed ff ff       	call   800917 <memmove>
+  801b27:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  801b2a:	01 df                	add    %ebx,%edi
+  801b2c:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801b2f:	39 c7                	cmp    %eax,%edi
+  801b31:	0f 83 c0 00 00 00    	jae    801bf7 <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801b37:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801b3a:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  801b3d:	89 f0                	mov    %esi,%eax
+  801b3f:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801b44:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  801b49:	29 c3                	sub    %eax,%ebx
+  801b4b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801b4e:	29 f8                	sub    %edi,%eax
+  801b50:	39 c3                	cmp    %eax,%ebx
+  801b52:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  801b55:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801b5b:	75 ba                	jne    801b17 <devfile_read+0x134>
+  801b5d:	89 f9                	mov    %edi,%ecx
+  801b5f:	03 4d 0c             	add    0xc(%ebp),%ecx
+  801b62:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  801b65:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  801b6b:	75 aa                	jne    801b17 <devfile_read+0x134>
+  801b6d:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  801b73:	77 a2                	ja     801b17 <devfile_read+0x134>
+  801b75:	89 c8                	mov    %ecx,%eax
+  801b77:	c1 e8 16             	shr    $0x16,%eax
+  801b7a:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801b81:	a8 01                	test   $0x1,%al
+  801b83:	74 92                	je     801b17 <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  801b85:	89 c8                	mov    %ecx,%eax
+  801b87:	c1 e8 0c             	shr    $0xc,%eax
+  801b8a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  801b91:	a8 01                	test   $0x1,%al
+  801b93:	74 82                	je     801b17 <devfile_read+0x134>
+  801b95:	a9 02 08 00 00       	test   $0x802,%eax
+  801b9a:	0f 84 77 ff ff ff    	je     801b17 <devfile_read+0x134>
+  801ba0:	f6 c4 04             	test   $0x4,%ah
+  801ba3:	0f 85 6e ff ff ff    	jne    801b17 <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  801ba9:	a1 44 57 80 00       	mov    0x805744,%eax
+  801bae:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  801bb2:	84 c0                	test   %al,%al
+  801bb4:	75 17                	jne    801bcd <devfile_read+0x1ea>
+  801bb6:	83 ec 08             	sub    $0x8,%esp
+  801bb9:	6a 01                	push   $0x1
+  801bbb:	6a 00                	push   $0x0
+  801bbd:	e8 bb ef ff ff       	call   800b7d <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  801bc2:	83 c4 10             	add    $0x10,%esp
+  801bc5:	85 c0                	test   %eax,%eax
+  801bc7:	0f 85 4a ff ff ff    	jne    801b17 <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  801bcd:	83 ec 04             	sub    $0x4,%esp
+  801bd0:	68 05 08 00 00       	push   $0x805
+  801bd5:	ff 75 cc             	push   -0x34(%ebp)
+  801bd8:	6a 00                	push   $0x0
+  801bda:	56                   	push   %esi
+  801bdb:	6a 00                	push   $0x0
+  801bdd:	6a 05                	push   $0x5
+  801bdf:	68 40 50 80 00       	push   $0x805040
+  801be4:	e8 2a f4 ff ff       	call   801013 <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  801be9:	c1 e8 1f             	shr    $0x1f,%eax
+  801bec:	08 45 cb             	or     %al,-0x35(%ebp)
+  801bef:	83 c4 20             	add    $0x20,%esp
+  801bf2:	e9 33 ff ff ff       	jmp    801b2a <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  801bf7:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  801bfa:	83 ec 0c             	sub    $0xc,%esp
+  801bfd:	68 40 50 80 00       	push   $0x805040
+  801c02:	e8 bc f3 ff ff       	call   800fc3 <sysbatch_flush>
+  801c07:	83 c4 10             	add    $0x10,%esp
+  801c0a:	85 c0                	test   %eax,%eax
+  801c0c:	78 06                	js     801c14 <devfile_read+0x231>
+  801c0e:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  801c12:	74 14                	je     801c28 <devfile_read+0x245>
+    memmove(dst, src, r);
+  801c14:	83 ec 04             	sub    $0x4,%esp
+  801c17:	ff 75 d4             	push   -0x2c(%ebp)
+  801c1a:	ff 75 d0             	push   -0x30(%ebp)
+  801c1d:	ff 75 0c             	push   0xc(%ebp)
+  801c20:	e8 f2 ec ff ff       	call   800917 <memmove>
+  801c25:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  801c28:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c2b:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  801c2e:	e9 11 fe ff ff       	jmp    801a44 <devfile_read+0x61>
+  assert(r <= n);
+  801c33:	68 e9 32 80 00       	push   $0x8032e9
+  801c38:	68 f0 32 80 00       	push   $0x8032f0
+  801c3d:	68 1c 01 00 00       	push   $0x11c
+  801c42:	68 de 32 80 00       	push   $0x8032de
+  801c47:	e8 97 0f 00 00       	call   802be3 <_panic>
+  assert(r <= PGSIZE);
+  801c4c:	68 05 33 80 00       	push   $0x803305
+  801c51:	68 f0 32 80 00       	push   $0x8032f0
+  801c56:	68 1d 01 00 00       	push   $0x11d
+  801c5b:	68 de 32 80 00       	push   $0x8032de
+  801c60:	e8 7e 0f 00 00       	call   802be3 <_panic>
+
+00801c65 <devfile_write>:
+{
+  801c65:	55                   	push   %ebp
+  801c66:	89 e5                	mov    %esp,%ebp
+  801c68:	57                   	push   %edi
+  801c69:	56                   	push   %esi
+  801c6a:	53                   	push   %ebx
+  801c6b:	83 ec 1c             	sub    $0x1c,%esp
+  801c6e:	8b 75 08             	mov    0x8(%ebp),%esi
+  801c71:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  801c74:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  801c79:	77 39                	ja     801cb4 <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801c7b:	8b 56 0c             	mov    0xc(%esi),%edx
+  801c7e:	89 15 00 60 80 00    	mov    %edx,0x806000
+  fsipcbuf.write.req_n = n;
+  801c84:	a3 04 60 80 00       	mov    %eax,0x806004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  801c89:	83 ec 04             	sub    $0x4,%esp
+  801c8c:	50                   	push   %eax
+  801c8d:	ff 75 0c             	push   0xc(%ebp)
+  801c90:	68 08 60 80 00       	push   $0x806008
+  801c95:	e8 7d ec ff ff       	call   800917 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801c9a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c9f:	b8 04 00 00 00       	mov    $0x4,%eax
+  801ca4:	e8 e7 fb ff ff       	call   801890 <fsipc>
+  801ca9:	83 c4 10             	add    $0x10,%esp
+}
+  801cac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801caf:	5b                   	pop    %ebx
+  801cb0:	5e                   	pop    %esi
+  801cb1:	5f                   	pop    %edi
+  801cb2:	5d                   	pop    %ebp
+  801cb3:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  801cb4:	ba 00 00 10 00       	mov    $0x100000,%edx
+  801cb9:	39 d0                	cmp    %edx,%eax
+  801cbb:	89 d3                	mov    %edx,%ebx
+  801cbd:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  801cc0:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  801cc6:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  801cc9:	83 c7 01             	add    $0x1,%edi
+  801ccc:	89 f8                	mov    %edi,%eax
+  801cce:	e8 94 fc ff ff       	call   801967 <fsv_alloc>
+  801cd3:	85 c0                	test   %eax,%eax
+  801cd5:	78 d5                	js     801cac <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  801cd7:	83 ec 04             	sub    $0x4,%esp
+  801cda:	53                   	push   %ebx
+  801cdb:	ff 75 0c             	push   0xc(%ebp)
+  801cde:	68 00 10 c0 9f       	push   $0x9fc01000
+  801ce3:	e8 2f ec ff ff       	call   800917 <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  801ce8:	8b 46 0c             	mov    0xc(%esi),%eax
+  801ceb:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  801cf0:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  801cf6:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801cfd:	89 f9                	mov    %edi,%ecx
+  801cff:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801d04:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801d09:	e8 69 fa ff ff       	call   801777 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801d0e:	6a 00                	push   $0x0
+  801d10:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801d13:	50                   	push   %eax
+  801d14:	6a 00                	push   $0x0
+  801d16:	6a 00                	push   $0x0
+  801d18:	e8 52 f3 ff ff       	call   80106f <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  801d1d:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  801d20:	eb 8a                	jmp    801cac <devfile_write+0x47>
+
+00801d22 <open>:
+{
+  801d22:	55                   	push   %ebp
+  801d23:	89 e5                	mov    %esp,%ebp
+  801d25:	56                   	push   %esi
+  801d26:	53                   	push   %ebx
+  801d27:	83 ec 1c             	sub    $0x1c,%esp
+  801d2a:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801d2d:	56                   	push   %esi
+  801d2e:	e8 23 ea ff ff       	call   800756 <strlen>
+  801d33:	83 c4 10             	add    $0x10,%esp
+  801d36:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801d3b:	7f 6c                	jg     801da9 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  801d3d:	83 ec 0c             	sub    $0xc,%esp
+  801d40:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d43:	50                   	push   %eax
+  801d44:	e8 ad f4 ff ff       	call   8011f6 <fd_alloc>
+  801d49:	89 c3                	mov    %eax,%ebx
+  801d4b:	83 c4 10             	add    $0x10,%esp
+  801d4e:	85 c0                	test   %eax,%eax
+  801d50:	78 3c                	js     801d8e <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801d52:	83 ec 08             	sub    $0x8,%esp
+  801d55:	56                   	push   %esi
+  801d56:	68 00 60 80 00       	push   $0x806000
+  801d5b:	e8 31 ea ff ff       	call   800791 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801d60:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d63:	a3 00 64 80 00       	mov    %eax,0x806400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801d68:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801d6b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801d70:	e8 1b fb ff ff       	call   801890 <fsipc>
+  801d75:	89 c3                	mov    %eax,%ebx
+  801d77:	83 c4 10             	add    $0x10,%esp
+  801d7a:	85 c0                	test   %eax,%eax
+  801d7c:	78 19                	js     801d97 <open+0x75>
+  return fd2num(fd);
+  801d7e:	83 ec 0c             	sub    $0xc,%esp
+  801d81:	ff 75 f4             	push   -0xc(%ebp)
+  801d84:	e8 49 f4 ff ff       	call   8011d2 <fd2num>
+  801d89:	89 c3                	mov    %eax,%ebx
+  801d8b:	83 c4 10             	add    $0x10,%esp
+}
+  801d8e:	89 d8                	mov    %ebx,%eax
+  801d90:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d93:	5b                   	pop    %ebx
+  801d94:	5e                   	pop    %esi
+  801d95:	5d                   	pop    %ebp
+  801d96:	c3                   	ret
+    fd_close(fd, 0);
+  801d97:	83 ec 08             	sub    $0x8,%esp
+  801d9a:	6a 00                	push   $0x0
+  801d9c:	ff 75 f4             	push   -0xc(%ebp)
+  801d9f:	e8 44 f5 ff ff       	call   8012e8 <fd_close>
+    return r;
+  801da4:	83 c4 10             	add    $0x10,%esp
+  801da7:	eb e5                	jmp    801d8e <open+0x6c>
+    return -E_BAD_PATH;
+  801da9:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801dae:	eb de                	jmp    801d8e <open+0x6c>
+
+00801db0 <open_read>:
+{
+  801db0:	55                   	push   %ebp
+  801db1:	89 e5                	mov    %esp,%ebp
+  801db3:	57                   	push   %edi
+  801db4:	56                   	push   %esi
+  801db5:	53                   	push   %ebx
+  801db6:	83 ec 28             	sub    $0x28,%esp
+  801db9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  801dbc:	57                   	push   %edi
+  801dbd:	e8 94 e9 ff ff       	call   800756 <strlen>
+  801dc2:	83 c4 10             	add    $0x10,%esp
+  801dc5:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801dca:	0f 87 f6 00 00 00    	ja     801ec6 <open_read+0x116>
+  801dd0:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  801dd2:	83 ec 0c             	sub    $0xc,%esp
+  801dd5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801dd8:	50                   	push   %eax
+  801dd9:	e8 18 f4 ff ff       	call   8011f6 <fd_alloc>
+  801dde:	89 c3                	mov    %eax,%ebx
+  801de0:	83 c4 10             	add    $0x10,%esp
+  801de3:	85 c0                	test   %eax,%eax
+  801de5:	0f 88 b2 00 00 00    	js     801e9d <open_read+0xed>
+  strcpy(req->req_buf, path);
+  801deb:	83 ec 08             	sub    $0x8,%esp
+  801dee:	57                   	push   %edi
+  801def:	68 e4 60 80 00       	push   $0x8060e4
+  801df4:	e8 98 e9 ff ff       	call   800791 <strcpy>
+  req->req_nops = 2;
+  801df9:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  801e00:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  801e03:	c7 05 04 60 80 00 01 	movl   $0x1,0x806004
+  801e0a:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  801e0d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e10:	a3 10 60 80 00       	mov    %eax,0x806010
+  req->req_ops[0].op_buf = 0;
+  801e15:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  801e1c:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  801e1f:	c7 05 20 60 80 00 04 	movl   $0x4,0x806020
+  801e26:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  801e29:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  801e30:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  801e33:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  801e38:	29 f0                	sub    %esi,%eax
+  801e3a:	3b 45 14             	cmp    0x14(%ebp),%eax
+  801e3d:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  801e41:	a3 2c 60 80 00       	mov    %eax,0x80602c
+  req->req_ops[1].op_offset = 0;
+  801e46:	c7 05 30 60 80 00 00 	movl   $0x0,0x806030
+  801e4d:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  801e50:	83 c6 01             	add    $0x1,%esi
+  801e53:	89 35 34 60 80 00    	mov    %esi,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  801e59:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801e5c:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801e61:	e8 2a fa ff ff       	call   801890 <fsipc>
+  801e66:	89 c3                	mov    %eax,%ebx
+  801e68:	83 c4 10             	add    $0x10,%esp
+  801e6b:	83 f8 01             	cmp    $0x1,%eax
+  801e6e:	7e 37                	jle    801ea7 <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  801e70:	a1 38 60 80 00       	mov    0x806038,%eax
+  801e75:	8b 55 18             	mov    0x18(%ebp),%edx
+  801e78:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  801e7a:	83 ec 04             	sub    $0x4,%esp
+  801e7d:	50                   	push   %eax
+  801e7e:	81 c6 e4 60 80 00    	add    $0x8060e4,%esi
+  801e84:	56                   	push   %esi
+  801e85:	ff 75 10             	push   0x10(%ebp)
+  801e88:	e8 8a ea ff ff       	call   800917 <memmove>
+  return fd2num(fd);
+  801e8d:	83 c4 04             	add    $0x4,%esp
+  801e90:	ff 75 e4             	push   -0x1c(%ebp)
+  801e93:	e8 3a f3 ff ff       	call   8011d2 <fd2num>
+  801e98:	89 c3                	mov    %eax,%ebx
+  801e9a:	83 c4 10             	add    $0x10,%esp
+}
+  801e9d:	89 d8                	mov    %ebx,%eax
+  801e9f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ea2:	5b                   	pop    %ebx
+  801ea3:	5e                   	pop    %esi
+  801ea4:	5f                   	pop    %edi
+  801ea5:	5d                   	pop    %ebp
+  801ea6:	c3                   	ret
+    fd_close(fd, 0);
+  801ea7:	83 ec 08             	sub    $0x8,%esp
+  801eaa:	6a 00                	push   $0x0
+  801eac:	ff 75 e4             	push   -0x1c(%ebp)
+  801eaf:	e8 34 f4 ff ff       	call   8012e8 <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  801eb4:	83 c4 10             	add    $0x10,%esp
+  801eb7:	85 db                	test   %ebx,%ebx
+  801eb9:	78 e2                	js     801e9d <open_read+0xed>
+  801ebb:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  801ebe:	8b 9b 1c 60 80 00    	mov    0x80601c(%ebx),%ebx
+  801ec4:	eb d7                	jmp    801e9d <open_read+0xed>
+    return -E_BAD_PATH;
+  801ec6:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801ecb:	eb d0                	jmp    801e9d <open_read+0xed>
+
+00801ecd <file_stat>:
+{
+  801ecd:	55                   	push   %ebp
+  801ece:	89 e5                	mov    %esp,%ebp
+  801ed0:	57                   	push   %edi
+  801ed1:	56                   	push   %esi
+  801ed2:	53                   	push   %ebx
+  801ed3:	83 ec 18             	sub    $0x18,%esp
+  801ed6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801ed9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801edc:	57                   	push   %edi
+  801edd:	e8 74 e8 ff ff       	call   800756 <strlen>
+  801ee2:	83 c4 10             	add    $0x10,%esp
+  801ee5:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801eea:	0f 8f c7 00 00 00    	jg     801fb7 <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  801ef0:	83 ec 0c             	sub    $0xc,%esp
+  801ef3:	57                   	push   %edi
+  801ef4:	e8 5d e8 ff ff       	call   800756 <strlen>
+  801ef9:	8d 58 04             	lea    0x4(%eax),%ebx
+  801efc:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  801eff:	83 c4 08             	add    $0x8,%esp
+  801f02:	57                   	push   %edi
+  801f03:	68 e4 60 80 00       	push   $0x8060e4
+  801f08:	e8 84 e8 ff ff       	call   800791 <strcpy>
+  req->req_nops = 2;
+  801f0d:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  801f14:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  801f17:	c7 05 04 60 80 00 02 	movl   $0x2,0x806004
+  801f1e:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  801f21:	c7 05 10 60 80 00 00 	movl   $0x0,0x806010
+  801f28:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  801f2b:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  801f32:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  801f35:	c7 05 20 60 80 00 03 	movl   $0x3,0x806020
+  801f3c:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  801f3f:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  801f46:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  801f49:	89 1d 34 60 80 00    	mov    %ebx,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  801f4f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f54:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801f59:	e8 32 f9 ff ff       	call   801890 <fsipc>
+  801f5e:	83 c4 10             	add    $0x10,%esp
+  801f61:	83 f8 01             	cmp    $0x1,%eax
+  801f64:	7e 42                	jle    801fa8 <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  801f66:	81 c3 e4 60 80 00    	add    $0x8060e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  801f6c:	83 ec 08             	sub    $0x8,%esp
+  801f6f:	53                   	push   %ebx
+  801f70:	56                   	push   %esi
+  801f71:	e8 1b e8 ff ff       	call   800791 <strcpy>
+  st->st_size = ret->ret_size;
+  801f76:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  801f7c:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  801f82:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  801f88:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  801f8e:	c7 86 88 00 00 00 04 	movl   $0x804004,0x88(%esi)
+  801f95:	40 80 00 
+  return 0;
+  801f98:	83 c4 10             	add    $0x10,%esp
+  801f9b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801fa0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fa3:	5b                   	pop    %ebx
+  801fa4:	5e                   	pop    %esi
+  801fa5:	5f                   	pop    %edi
+  801fa6:	5d                   	pop    %ebp
+  801fa7:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  801fa8:	85 c0                	test   %eax,%eax
+  801faa:	78 f4                	js     801fa0 <file_stat+0xd3>
+  801fac:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801faf:	8b 80 1c 60 80 00    	mov    0x80601c(%eax),%eax
+  801fb5:	eb e9                	jmp    801fa0 <file_stat+0xd3>
+    return -E_BAD_PATH;
+  801fb7:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801fbc:	eb e2                	jmp    801fa0 <file_stat+0xd3>
+
+00801fbe <read_map>:
+{
+  801fbe:	55                   	push   %ebp
+  801fbf:	89 e5                	mov    %esp,%ebp
+  801fc1:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801fc4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fc7:	50                   	push   %eax
+  801fc8:	ff 75 08             	push   0x8(%ebp)
+  801fcb:	e8 7c f2 ff ff       	call   80124c <fd_lookup>
+  801fd0:	83 c4 10             	add    $0x10,%esp
+  801fd3:	85 c0                	test   %eax,%eax
+  801fd5:	78 2a                	js     802001 <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  801fd7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801fda:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  801fe0:	39 08                	cmp    %ecx,(%eax)
+  801fe2:	75 1f                	jne    802003 <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  801fe4:	8b 40 0c             	mov    0xc(%eax),%eax
+  801fe7:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read_map.req_offset = offset;
+  801fec:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801fef:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  801ff4:	8b 55 10             	mov    0x10(%ebp),%edx
+  801ff7:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801ffc:	e8 8f f8 ff ff       	call   801890 <fsipc>
+}
+  802001:	c9                   	leave
+  802002:	c3                   	ret
+    return -E_INVAL;
+  802003:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802008:	eb f7                	jmp    802001 <read_map+0x43>
+
+0080200a <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80200a:	55                   	push   %ebp
+  80200b:	89 e5                	mov    %esp,%ebp
+  80200d:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  802010:	ba 00 00 00 00       	mov    $0x0,%edx
+  802015:	b8 08 00 00 00       	mov    $0x8,%eax
+  80201a:	e8 71 f8 ff ff       	call   801890 <fsipc>
+}
+  80201f:	c9                   	leave
+  802020:	c3                   	ret
+
+00802021 <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  802021:	55                   	push   %ebp
+  802022:	89 e5                	mov    %esp,%ebp
+  802024:	57                   	push   %edi
+  802025:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  802026:	8b 45 08             	mov    0x8(%ebp),%eax
+  802029:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.stats.req_bio_sched = 0;
+  80202e:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  802035:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  802038:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  80203f:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  802042:	ba 00 00 00 00       	mov    $0x0,%edx
+  802047:	b8 09 00 00 00       	mov    $0x9,%eax
+  80204c:	e8 3f f8 ff ff       	call   801890 <fsipc>
+  802051:	85 c0                	test   %eax,%eax
+  802053:	78 14                	js     802069 <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  802055:	be 00 60 80 00       	mov    $0x806000,%esi
+  80205a:	b9 16 00 00 00       	mov    $0x16,%ecx
+  80205f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802062:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  802064:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802069:	5e                   	pop    %esi
+  80206a:	5f                   	pop    %edi
+  80206b:	5d                   	pop    %ebp
+  80206c:	c3                   	ret
+
+0080206d <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  80206d:	55                   	push   %ebp
+  80206e:	89 e5                	mov    %esp,%ebp
+  802070:	53                   	push   %ebx
+  802071:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  802074:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802077:	50                   	push   %eax
+  802078:	6a 00                	push   $0x0
+  80207a:	e8 a2 ff ff ff       	call   802021 <fs_stats>
+  80207f:	83 c4 10             	add    $0x10,%esp
+  802082:	85 c0                	test   %eax,%eax
+  802084:	78 28                	js     8020ae <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  802086:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  802089:	83 ec 08             	sub    $0x8,%esp
+  80208c:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  80208f:	50                   	push   %eax
+  802090:	6a 20                	push   $0x20
+  802092:	e8 8a ff ff ff       	call   802021 <fs_stats>
+  802097:	83 c4 10             	add    $0x10,%esp
+  80209a:	85 c0                	test   %eax,%eax
+  80209c:	78 10                	js     8020ae <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  80209e:	83 ec 08             	sub    $0x8,%esp
+  8020a1:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8020a4:	50                   	push   %eax
+  8020a5:	53                   	push   %ebx
+  8020a6:	e8 76 ff ff ff       	call   802021 <fs_stats>
+  8020ab:	83 c4 10             	add    $0x10,%esp
+}
+  8020ae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020b1:	c9                   	leave
+  8020b2:	c3                   	ret
+
+008020b3 <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  8020b3:	55                   	push   %ebp
+  8020b4:	89 e5                	mov    %esp,%ebp
+  8020b6:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  8020b9:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  8020c0:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  8020c3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020c6:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.stats.req_dcache = 0;
+  8020cb:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  8020d2:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  8020d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020da:	b8 09 00 00 00       	mov    $0x9,%eax
+  8020df:	e8 ac f7 ff ff       	call   801890 <fsipc>
+}
+  8020e4:	c9                   	leave
+  8020e5:	c3                   	ret
+
+008020e6 <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  8020e6:	55                   	push   %ebp
+  8020e7:	89 e5                	mov    %esp,%ebp
+  8020e9:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  8020ec:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  8020f3:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  8020f6:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  8020fd:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  802100:	8b 45 08             	mov    0x8(%ebp),%eax
+  802103:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_STATS, NULL);
+  802108:	ba 00 00 00 00       	mov    $0x0,%edx
+  80210d:	b8 09 00 00 00       	mov    $0x9,%eax
+  802112:	e8 79 f7 ff ff       	call   801890 <fsipc>
+}
+  802117:	c9                   	leave
+  802118:	c3                   	ret
+
+00802119 <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  802119:	55                   	push   %ebp
+  80211a:	89 e5                	mov    %esp,%ebp
+  80211c:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80211f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802122:	50                   	push   %eax
+  802123:	ff 75 08             	push   0x8(%ebp)
+  802126:	e8 21 f1 ff ff       	call   80124c <fd_lookup>
+  80212b:	83 c4 10             	add    $0x10,%esp
+  80212e:	85 c0                	test   %eax,%eax
+  802130:	78 34                	js     802166 <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  802132:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802135:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  80213b:	39 08                	cmp    %ecx,(%eax)
+  80213d:	75 29                	jne    802168 <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  80213f:	8b 40 0c             	mov    0xc(%eax),%eax
+  802142:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.fallocate.req_offset = offset;
+  802147:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80214a:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.fallocate.req_len = len;
+  80214f:	8b 45 10             	mov    0x10(%ebp),%eax
+  802152:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  802157:	ba 00 00 00 00       	mov    $0x0,%edx
+  80215c:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802161:	e8 2a f7 ff ff       	call   801890 <fsipc>
+}
+  802166:	c9                   	leave
+  802167:	c3                   	ret
+    return -E_INVAL;
+  802168:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80216d:	eb f7                	jmp    802166 <fallocate+0x4d>
+
+0080216f <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  80216f:	55                   	push   %ebp
+  802170:	89 e5                	mov    %esp,%ebp
+  802172:	57                   	push   %edi
+  802173:	56                   	push   %esi
+  802174:	53                   	push   %ebx
+  802175:	83 ec 24             	sub    $0x24,%esp
+  802178:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80217b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80217e:	50                   	push   %eax
+  80217f:	ff 75 08             	push   0x8(%ebp)
+  802182:	e8 c5 f0 ff ff       	call   80124c <fd_lookup>
+  802187:	83 c4 10             	add    $0x10,%esp
+  80218a:	85 c0                	test   %eax,%eax
+  80218c:	78 66                	js     8021f4 <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  80218e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802191:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  802197:	39 08                	cmp    %ecx,(%eax)
+  802199:	75 61                	jne    8021fc <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  80219b:	85 f6                	test   %esi,%esi
+  80219d:	7e 50                	jle    8021ef <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  80219f:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  8021a4:	39 de                	cmp    %ebx,%esi
+  8021a6:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  8021a9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8021ac:	8b 40 0c             	mov    0xc(%eax),%eax
+  8021af:	a3 00 60 80 00       	mov    %eax,0x806000
+    fsipcbuf.prefetch.req_n = m;
+  8021b4:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  8021ba:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  8021c1:	83 ec 04             	sub    $0x4,%esp
+  8021c4:	57                   	push   %edi
+  8021c5:	ff 75 0c             	push   0xc(%ebp)
+  8021c8:	68 08 60 80 00       	push   $0x806008
+  8021cd:	e8 45 e7 ff ff       	call   800917 <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  8021d2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021d7:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8021dc:	e8 af f6 ff ff       	call   801890 <fsipc>
+  8021e1:	83 c4 10             	add    $0x10,%esp
+  8021e4:	85 c0                	test   %eax,%eax
+  8021e6:	78 0c                	js     8021f4 <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  8021e8:	01 7d 0c             	add    %edi,0xc(%ebp)
+  8021eb:	29 de                	sub    %ebx,%esi
+  8021ed:	eb ac                	jmp    80219b <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  8021ef:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021f7:	5b                   	pop    %ebx
+  8021f8:	5e                   	pop    %esi
+  8021f9:	5f                   	pop    %edi
+  8021fa:	5d                   	pop    %ebp
+  8021fb:	c3                   	ret
+    return -E_INVAL;
+  8021fc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802201:	eb f1                	jmp    8021f4 <prefetch+0x85>
+
+00802203 <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  802203:	55                   	push   %ebp
+  802204:	89 e5                	mov    %esp,%ebp
+  802206:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  802209:	50                   	push   %eax
+  80220a:	e8 d3 ef ff ff       	call   8011e2 <fd2data>
+  80220f:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  802214:	c9                   	leave
+  802215:	c3                   	ret
+
+00802216 <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802216:	55                   	push   %ebp
+  802217:	89 e5                	mov    %esp,%ebp
+  802219:	56                   	push   %esi
+  80221a:	53                   	push   %ebx
+  80221b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  80221e:	83 ec 0c             	sub    $0xc,%esp
+  802221:	ff 75 08             	push   0x8(%ebp)
+  802224:	e8 b9 ef ff ff       	call   8011e2 <fd2data>
+  802229:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  80222b:	83 c4 08             	add    $0x8,%esp
+  80222e:	68 40 33 80 00       	push   $0x803340
+  802233:	53                   	push   %ebx
+  802234:	e8 58 e5 ff ff       	call   800791 <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  802239:	8b 46 04             	mov    0x4(%esi),%eax
+  80223c:	2b 06                	sub    (%esi),%eax
+  80223e:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  802244:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80224b:	00 00 00 
+  stat->st_dev = &devpipe;
+  80224e:	c7 83 88 00 00 00 20 	movl   $0x804020,0x88(%ebx)
+  802255:	40 80 00 
+  return 0;
+}
+  802258:	b8 00 00 00 00       	mov    $0x0,%eax
+  80225d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802260:	5b                   	pop    %ebx
+  802261:	5e                   	pop    %esi
+  802262:	5d                   	pop    %ebp
+  802263:	c3                   	ret
+
+00802264 <pipe_wakeup>:
+{
+  802264:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  802266:	b8 00 00 00 00       	mov    $0x0,%eax
+  80226b:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  80226e:	85 c0                	test   %eax,%eax
+  802270:	75 01                	jne    802273 <pipe_wakeup+0xf>
+  802272:	c3                   	ret
+{
+  802273:	55                   	push   %ebp
+  802274:	89 e5                	mov    %esp,%ebp
+  802276:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  802279:	6a 00                	push   $0x0
+  80227b:	68 00 00 c0 ee       	push   $0xeec00000
+  802280:	52                   	push   %edx
+  802281:	e8 96 ec ff ff       	call   800f1c <sys_chan_wakeup>
+  802286:	83 c4 10             	add    $0x10,%esp
+}
+  802289:	c9                   	leave
+  80228a:	c3                   	ret
+
+0080228b <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80228b:	55                   	push   %ebp
+  80228c:	89 e5                	mov    %esp,%ebp
+  80228e:	57                   	push   %edi
+  80228f:	56                   	push   %esi
+  802290:	53                   	push   %ebx
+  802291:	83 ec 18             	sub    $0x18,%esp
+  802294:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  802297:	57                   	push   %edi
+  802298:	e8 45 ef ff ff       	call   8011e2 <fd2data>
+  80229d:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  80229f:	83 c4 10             	add    $0x10,%esp
+  8022a2:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  8022a6:	74 2a                	je     8022d2 <devpipe_close+0x47>
+  8022a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  8022ad:	89 f8                	mov    %edi,%eax
+  8022af:	e8 4f ff ff ff       	call   802203 <pipe_ring>
+  8022b4:	83 ec 08             	sub    $0x8,%esp
+  8022b7:	01 d8                	add    %ebx,%eax
+  8022b9:	50                   	push   %eax
+  8022ba:	6a 00                	push   $0x0
+  8022bc:	e8 84 e9 ff ff       	call   800c45 <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  8022c1:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8022c7:	83 c4 10             	add    $0x10,%esp
+  8022ca:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  8022d0:	75 db                	jne    8022ad <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  8022d2:	83 ec 08             	sub    $0x8,%esp
+  8022d5:	57                   	push   %edi
+  8022d6:	6a 00                	push   $0x0
+  8022d8:	e8 68 e9 ff ff       	call   800c45 <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  8022dd:	83 c4 10             	add    $0x10,%esp
+  8022e0:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  8022e4:	75 13                	jne    8022f9 <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  8022e6:	83 ec 08             	sub    $0x8,%esp
+  8022e9:	56                   	push   %esi
+  8022ea:	6a 00                	push   $0x0
+  8022ec:	e8 54 e9 ff ff       	call   800c45 <sys_page_unmap>
+}
+  8022f1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022f4:	5b                   	pop    %ebx
+  8022f5:	5e                   	pop    %esi
+  8022f6:	5f                   	pop    %edi
+  8022f7:	5d                   	pop    %ebp
+  8022f8:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  8022f9:	8d 56 04             	lea    0x4(%esi),%edx
+  8022fc:	8d 46 2c             	lea    0x2c(%esi),%eax
+  8022ff:	e8 60 ff ff ff       	call   802264 <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802304:	8d 46 30             	lea    0x30(%esi),%eax
+  802307:	89 f2                	mov    %esi,%edx
+  802309:	e8 56 ff ff ff       	call   802264 <pipe_wakeup>
+  80230e:	eb d6                	jmp    8022e6 <devpipe_close+0x5b>
+
+00802310 <_pipeisclosed>:
+{
+  802310:	55                   	push   %ebp
+  802311:	89 e5                	mov    %esp,%ebp
+  802313:	57                   	push   %edi
+  802314:	56                   	push   %esi
+  802315:	53                   	push   %ebx
+  802316:	83 ec 1c             	sub    $0x1c,%esp
+  802319:	89 c7                	mov    %eax,%edi
+  80231b:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  80231d:	a1 44 57 80 00       	mov    0x805744,%eax
+  802322:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  802325:	83 ec 0c             	sub    $0xc,%esp
+  802328:	57                   	push   %edi
+  802329:	e8 fb 08 00 00       	call   802c29 <pageref>
+  80232e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802331:	89 34 24             	mov    %esi,(%esp)
+  802334:	e8 f0 08 00 00       	call   802c29 <pageref>
+    nn = thisenv->env_runs;
+  802339:	8b 15 44 57 80 00    	mov    0x805744,%edx
+  80233f:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  802342:	83 c4 10             	add    $0x10,%esp
+  802345:	39 cb                	cmp    %ecx,%ebx
+  802347:	74 1b                	je     802364 <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  802349:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80234c:	75 cf                	jne    80231d <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80234e:	8b 42 58             	mov    0x58(%edx),%eax
+  802351:	6a 01                	push   $0x1
+  802353:	50                   	push   %eax
+  802354:	53                   	push   %ebx
+  802355:	68 47 33 80 00       	push   $0x803347
+  80235a:	e8 44 de ff ff       	call   8001a3 <cprintf>
+  80235f:	83 c4 10             	add    $0x10,%esp
+  802362:	eb b9                	jmp    80231d <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  802364:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802367:	0f 94 c0             	sete   %al
+  80236a:	0f b6 c0             	movzbl %al,%eax
+}
+  80236d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802370:	5b                   	pop    %ebx
+  802371:	5e                   	pop    %esi
+  802372:	5f                   	pop    %edi
+  802373:	5d                   	pop    %ebp
+  802374:	c3                   	ret
+
+00802375 <devpipe_write_bulk>:
+{
+  802375:	55                   	push   %ebp
+  802376:	89 e5                	mov    %esp,%ebp
+  802378:	57                   	push   %edi
+  802379:	56                   	push   %esi
+  80237a:	53                   	push   %ebx
+  80237b:	83 ec 1c             	sub    $0x1c,%esp
+  80237e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802381:	89 d6                	mov    %edx,%esi
+  802383:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  802386:	e8 78 fe ff ff       	call   802203 <pipe_ring>
+  80238b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  80238e:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802393:	8d 46 04             	lea    0x4(%esi),%eax
+  802396:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  802399:	eb 75                	jmp    802410 <devpipe_write_bulk+0x9b>
+  80239b:	b8 01 00 00 00       	mov    $0x1,%eax
+  8023a0:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  8023a4:	6a 64                	push   $0x64
+  8023a6:	68 00 00 c0 ee       	push   $0xeec00000
+  8023ab:	53                   	push   %ebx
+  8023ac:	56                   	push   %esi
+  8023ad:	e8 47 eb ff ff       	call   800ef9 <sys_chan_sleep>
+      continue;
+  8023b2:	83 c4 10             	add    $0x10,%esp
+  8023b5:	eb 59                	jmp    802410 <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  8023b7:	89 d1                	mov    %edx,%ecx
+  8023b9:	c1 f9 1f             	sar    $0x1f,%ecx
+  8023bc:	c1 e9 11             	shr    $0x11,%ecx
+  8023bf:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  8023c2:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8023c7:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  8023c9:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  8023cf:	29 d3                	sub    %edx,%ebx
+  8023d1:	ba 00 80 00 00       	mov    $0x8000,%edx
+  8023d6:	29 c2                	sub    %eax,%edx
+  8023d8:	39 d3                	cmp    %edx,%ebx
+  8023da:	0f 47 da             	cmova  %edx,%ebx
+  8023dd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8023e0:	29 fa                	sub    %edi,%edx
+  8023e2:	39 d3                	cmp    %edx,%ebx
+  8023e4:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  8023e7:	83 ec 04             	sub    $0x4,%esp
+  8023ea:	53                   	push   %ebx
+  8023eb:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8023ee:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  8023f1:	52                   	push   %edx
+  8023f2:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8023f5:	01 c8                	add    %ecx,%eax
+  8023f7:	50                   	push   %eax
+  8023f8:	e8 7c e5 ff ff       	call   800979 <memcpy>
+    i += m;
+  8023fd:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  8023ff:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802402:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802405:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802408:	e8 57 fe ff ff       	call   802264 <pipe_wakeup>
+  80240d:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802410:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802413:	73 2b                	jae    802440 <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  802415:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  802417:	8b 56 04             	mov    0x4(%esi),%edx
+  80241a:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  802420:	39 d0                	cmp    %edx,%eax
+  802422:	7d 93                	jge    8023b7 <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  802424:	89 f2                	mov    %esi,%edx
+  802426:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802429:	e8 e2 fe ff ff       	call   802310 <_pipeisclosed>
+  80242e:	85 c0                	test   %eax,%eax
+  802430:	0f 84 65 ff ff ff    	je     80239b <devpipe_write_bulk+0x26>
+        return i;
+  802436:	89 f8                	mov    %edi,%eax
+}
+  802438:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80243b:	5b                   	pop    %ebx
+  80243c:	5e                   	pop    %esi
+  80243d:	5f                   	pop    %edi
+  80243e:	5d                   	pop    %ebp
+  80243f:	c3                   	ret
+  return i;
+  802440:	89 f8                	mov    %edi,%eax
+  802442:	eb f4                	jmp    802438 <devpipe_write_bulk+0xc3>
+
+00802444 <devpipe_write>:
+{
+  802444:	55                   	push   %ebp
+  802445:	89 e5                	mov    %esp,%ebp
+  802447:	57                   	push   %edi
+  802448:	56                   	push   %esi
+  802449:	53                   	push   %ebx
+  80244a:	83 ec 28             	sub    $0x28,%esp
+  80244d:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  802450:	56                   	push   %esi
+  802451:	e8 8c ed ff ff       	call   8011e2 <fd2data>
+  802456:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  802458:	8b 78 28             	mov    0x28(%eax),%edi
+  80245b:	83 c4 10             	add    $0x10,%esp
+  80245e:	85 ff                	test   %edi,%edi
+  802460:	75 25                	jne    802487 <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  802462:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802465:	74 66                	je     8024cd <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802467:	8b 43 04             	mov    0x4(%ebx),%eax
+  80246a:	8b 0b                	mov    (%ebx),%ecx
+  80246c:	8d 51 20             	lea    0x20(%ecx),%edx
+  80246f:	39 d0                	cmp    %edx,%eax
+  802471:	72 2b                	jb     80249e <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  802473:	89 da                	mov    %ebx,%edx
+  802475:	89 f0                	mov    %esi,%eax
+  802477:	e8 94 fe ff ff       	call   802310 <_pipeisclosed>
+  80247c:	85 c0                	test   %eax,%eax
+  80247e:	75 51                	jne    8024d1 <devpipe_write+0x8d>
+      sys_yield();
+  802480:	e8 d9 e6 ff ff       	call   800b5e <sys_yield>
+  802485:	eb e0                	jmp    802467 <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  802487:	83 ec 0c             	sub    $0xc,%esp
+  80248a:	ff 75 10             	push   0x10(%ebp)
+  80248d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802490:	89 c2                	mov    %eax,%edx
+  802492:	89 f0                	mov    %esi,%eax
+  802494:	e8 dc fe ff ff       	call   802375 <devpipe_write_bulk>
+  802499:	83 c4 10             	add    $0x10,%esp
+  80249c:	eb 38                	jmp    8024d6 <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80249e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8024a1:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8024a5:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8024a8:	89 c2                	mov    %eax,%edx
+  8024aa:	c1 fa 1f             	sar    $0x1f,%edx
+  8024ad:	89 d1                	mov    %edx,%ecx
+  8024af:	c1 e9 1b             	shr    $0x1b,%ecx
+  8024b2:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8024b5:	83 e2 1f             	and    $0x1f,%edx
+  8024b8:	29 ca                	sub    %ecx,%edx
+  8024ba:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8024be:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  8024c2:	83 c0 01             	add    $0x1,%eax
+  8024c5:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  8024c8:	83 c7 01             	add    $0x1,%edi
+  8024cb:	eb 95                	jmp    802462 <devpipe_write+0x1e>
+  return i;
+  8024cd:	89 f8                	mov    %edi,%eax
+  8024cf:	eb 05                	jmp    8024d6 <devpipe_write+0x92>
+        return 0;
+  8024d1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024d9:	5b                   	pop    %ebx
+  8024da:	5e                   	pop    %esi
+  8024db:	5f                   	pop    %edi
+  8024dc:	5d                   	pop    %ebp
+  8024dd:	c3                   	ret
+
+008024de <devpipe_read_bulk>:
+{
+  8024de:	55                   	push   %ebp
+  8024df:	89 e5                	mov    %esp,%ebp
+  8024e1:	57                   	push   %edi
+  8024e2:	56                   	push   %esi
+  8024e3:	53                   	push   %ebx
+  8024e4:	83 ec 2c             	sub    $0x2c,%esp
+  8024e7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8024ea:	89 d6                	mov    %edx,%esi
+  8024ec:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8024ef:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  8024f2:	e8 0c fd ff ff       	call   802203 <pipe_ring>
+  8024f7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  8024fa:	85 db                	test   %ebx,%ebx
+  8024fc:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802501:	0f 45 c3             	cmovne %ebx,%eax
+  802504:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802507:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  80250c:	8d 46 30             	lea    0x30(%esi),%eax
+  80250f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  802512:	eb 50                	jmp    802564 <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  802514:	89 d1                	mov    %edx,%ecx
+  802516:	c1 f9 1f             	sar    $0x1f,%ecx
+  802519:	c1 e9 11             	shr    $0x11,%ecx
+  80251c:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  80251f:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802524:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  802526:	29 d3                	sub    %edx,%ebx
+  802528:	ba 00 80 00 00       	mov    $0x8000,%edx
+  80252d:	29 c2                	sub    %eax,%edx
+  80252f:	39 d3                	cmp    %edx,%ebx
+  802531:	0f 47 da             	cmova  %edx,%ebx
+  802534:	8b 55 08             	mov    0x8(%ebp),%edx
+  802537:	29 fa                	sub    %edi,%edx
+  802539:	39 d3                	cmp    %edx,%ebx
+  80253b:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  80253e:	83 ec 04             	sub    $0x4,%esp
+  802541:	53                   	push   %ebx
+  802542:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802545:	01 c8                	add    %ecx,%eax
+  802547:	50                   	push   %eax
+  802548:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80254b:	01 f8                	add    %edi,%eax
+  80254d:	50                   	push   %eax
+  80254e:	e8 26 e4 ff ff       	call   800979 <memcpy>
+    i += m;
+  802553:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  802555:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802557:	89 f2                	mov    %esi,%edx
+  802559:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80255c:	e8 03 fd ff ff       	call   802264 <pipe_wakeup>
+  802561:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802564:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802567:	73 51                	jae    8025ba <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  802569:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  80256c:	8b 16                	mov    (%esi),%edx
+  80256e:	39 da                	cmp    %ebx,%edx
+  802570:	75 a2                	jne    802514 <devpipe_read_bulk+0x36>
+      if (i > 0)
+  802572:	85 ff                	test   %edi,%edi
+  802574:	75 44                	jne    8025ba <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  802576:	89 f2                	mov    %esi,%edx
+  802578:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80257b:	e8 90 fd ff ff       	call   802310 <_pipeisclosed>
+  802580:	85 c0                	test   %eax,%eax
+  802582:	75 3a                	jne    8025be <devpipe_read_bulk+0xe0>
+  802584:	b8 01 00 00 00       	mov    $0x1,%eax
+  802589:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  80258d:	6a 64                	push   $0x64
+  80258f:	ff 75 d4             	push   -0x2c(%ebp)
+  802592:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  802593:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802596:	50                   	push   %eax
+  802597:	e8 5d e9 ff ff       	call   800ef9 <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  80259c:	85 c0                	test   %eax,%eax
+  80259e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025a3:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  8025a6:	83 c4 10             	add    $0x10,%esp
+  8025a9:	a8 01                	test   $0x1,%al
+  8025ab:	74 b7                	je     802564 <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  8025ad:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  8025b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025b5:	5b                   	pop    %ebx
+  8025b6:	5e                   	pop    %esi
+  8025b7:	5f                   	pop    %edi
+  8025b8:	5d                   	pop    %ebp
+  8025b9:	c3                   	ret
+  return i;
+  8025ba:	89 f8                	mov    %edi,%eax
+  8025bc:	eb f4                	jmp    8025b2 <devpipe_read_bulk+0xd4>
+        return 0;
+  8025be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025c3:	eb ed                	jmp    8025b2 <devpipe_read_bulk+0xd4>
+
+008025c5 <devpipe_read>:
+{
+  8025c5:	55                   	push   %ebp
+  8025c6:	89 e5                	mov    %esp,%ebp
+  8025c8:	57                   	push   %edi
+  8025c9:	56                   	push   %esi
+  8025ca:	53                   	push   %ebx
+  8025cb:	83 ec 18             	sub    $0x18,%esp
+  8025ce:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  8025d1:	57                   	push   %edi
+  8025d2:	e8 0b ec ff ff       	call   8011e2 <fd2data>
+  8025d7:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  8025d9:	8b 70 28             	mov    0x28(%eax),%esi
+  8025dc:	83 c4 10             	add    $0x10,%esp
+  8025df:	85 f6                	test   %esi,%esi
+  8025e1:	75 24                	jne    802607 <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  8025e3:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8025e6:	74 60                	je     802648 <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  8025e8:	8b 03                	mov    (%ebx),%eax
+  8025ea:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8025ed:	75 3b                	jne    80262a <devpipe_read+0x65>
+      if (i > 0)
+  8025ef:	85 f6                	test   %esi,%esi
+  8025f1:	75 2d                	jne    802620 <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  8025f3:	89 da                	mov    %ebx,%edx
+  8025f5:	89 f8                	mov    %edi,%eax
+  8025f7:	e8 14 fd ff ff       	call   802310 <_pipeisclosed>
+  8025fc:	85 c0                	test   %eax,%eax
+  8025fe:	75 4c                	jne    80264c <devpipe_read+0x87>
+      sys_yield();
+  802600:	e8 59 e5 ff ff       	call   800b5e <sys_yield>
+  802605:	eb e1                	jmp    8025e8 <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  802607:	83 ec 08             	sub    $0x8,%esp
+  80260a:	6a 00                	push   $0x0
+  80260c:	ff 75 10             	push   0x10(%ebp)
+  80260f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802612:	89 c2                	mov    %eax,%edx
+  802614:	89 f8                	mov    %edi,%eax
+  802616:	e8 c3 fe ff ff       	call   8024de <devpipe_read_bulk>
+  80261b:	83 c4 10             	add    $0x10,%esp
+  80261e:	eb 02                	jmp    802622 <devpipe_read+0x5d>
+        return i;
+  802620:	89 f0                	mov    %esi,%eax
+}
+  802622:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802625:	5b                   	pop    %ebx
+  802626:	5e                   	pop    %esi
+  802627:	5f                   	pop    %edi
+  802628:	5d                   	pop    %ebp
+  802629:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80262a:	99                   	cltd
+  80262b:	c1 ea 1b             	shr    $0x1b,%edx
+  80262e:	01 d0                	add    %edx,%eax
+  802630:	83 e0 1f             	and    $0x1f,%eax
+  802633:	29 d0                	sub    %edx,%eax
+  802635:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  80263a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80263d:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  802640:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  802643:	83 c6 01             	add    $0x1,%esi
+  802646:	eb 9b                	jmp    8025e3 <devpipe_read+0x1e>
+  return i;
+  802648:	89 f0                	mov    %esi,%eax
+  80264a:	eb d6                	jmp    802622 <devpipe_read+0x5d>
+        return 0;
+  80264c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802651:	eb cf                	jmp    802622 <devpipe_read+0x5d>
+
+00802653 <pipe2>:
+{
+  802653:	55                   	push   %ebp
+  802654:	89 e5                	mov    %esp,%ebp
+  802656:	57                   	push   %edi
+  802657:	56                   	push   %esi
+  802658:	53                   	push   %ebx
+  802659:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  80265c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80265f:	50                   	push   %eax
+  802660:	e8 91 eb ff ff       	call   8011f6 <fd_alloc>
+  802665:	89 c3                	mov    %eax,%ebx
+  802667:	83 c4 10             	add    $0x10,%esp
+  80266a:	85 c0                	test   %eax,%eax
+  80266c:	0f 88 fb 01 00 00    	js     80286d <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802672:	83 ec 04             	sub    $0x4,%esp
+  802675:	68 07 04 00 00       	push   $0x407
+  80267a:	ff 75 e4             	push   -0x1c(%ebp)
+  80267d:	6a 00                	push   $0x0
+  80267f:	e8 3c e5 ff ff       	call   800bc0 <sys_page_alloc>
+  802684:	89 c3                	mov    %eax,%ebx
+  802686:	83 c4 10             	add    $0x10,%esp
+  802689:	85 c0                	test   %eax,%eax
+  80268b:	0f 88 dc 01 00 00    	js     80286d <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  802691:	83 ec 0c             	sub    $0xc,%esp
+  802694:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  802697:	50                   	push   %eax
+  802698:	e8 59 eb ff ff       	call   8011f6 <fd_alloc>
+  80269d:	89 c3                	mov    %eax,%ebx
+  80269f:	83 c4 10             	add    $0x10,%esp
+  8026a2:	85 c0                	test   %eax,%eax
+  8026a4:	0f 88 b3 01 00 00    	js     80285d <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8026aa:	83 ec 04             	sub    $0x4,%esp
+  8026ad:	68 07 04 00 00       	push   $0x407
+  8026b2:	ff 75 e0             	push   -0x20(%ebp)
+  8026b5:	6a 00                	push   $0x0
+  8026b7:	e8 04 e5 ff ff       	call   800bc0 <sys_page_alloc>
+  8026bc:	89 c3                	mov    %eax,%ebx
+  8026be:	83 c4 10             	add    $0x10,%esp
+  8026c1:	85 c0                	test   %eax,%eax
+  8026c3:	0f 88 94 01 00 00    	js     80285d <pipe2+0x20a>
+  va = fd2data(fd0);
+  8026c9:	83 ec 0c             	sub    $0xc,%esp
+  8026cc:	ff 75 e4             	push   -0x1c(%ebp)
+  8026cf:	e8 0e eb ff ff       	call   8011e2 <fd2data>
+  8026d4:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8026d6:	83 c4 0c             	add    $0xc,%esp
+  8026d9:	68 07 04 00 00       	push   $0x407
+  8026de:	50                   	push   %eax
+  8026df:	6a 00                	push   $0x0
+  8026e1:	e8 da e4 ff ff       	call   800bc0 <sys_page_alloc>
+  8026e6:	89 c3                	mov    %eax,%ebx
+  8026e8:	83 c4 10             	add    $0x10,%esp
+  8026eb:	85 c0                	test   %eax,%eax
+  8026ed:	0f 88 5a 01 00 00    	js     80284d <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8026f3:	83 ec 0c             	sub    $0xc,%esp
+  8026f6:	ff 75 e0             	push   -0x20(%ebp)
+  8026f9:	e8 e4 ea ff ff       	call   8011e2 <fd2data>
+  8026fe:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802705:	50                   	push   %eax
+  802706:	6a 00                	push   $0x0
+  802708:	57                   	push   %edi
+  802709:	6a 00                	push   $0x0
+  80270b:	e8 f3 e4 ff ff       	call   800c03 <sys_page_map>
+  802710:	89 c3                	mov    %eax,%ebx
+  802712:	83 c4 20             	add    $0x20,%esp
+  802715:	85 c0                	test   %eax,%eax
+  802717:	0f 88 22 01 00 00    	js     80283f <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  80271d:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  802721:	74 72                	je     802795 <pipe2+0x142>
+  802723:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  802728:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80272b:	e8 d3 fa ff ff       	call   802203 <pipe_ring>
+  802730:	83 ec 04             	sub    $0x4,%esp
+  802733:	68 07 04 00 00       	push   $0x407
+  802738:	01 f0                	add    %esi,%eax
+  80273a:	50                   	push   %eax
+  80273b:	6a 00                	push   $0x0
+  80273d:	e8 7e e4 ff ff       	call   800bc0 <sys_page_alloc>
+  802742:	89 c3                	mov    %eax,%ebx
+  802744:	83 c4 10             	add    $0x10,%esp
+  802747:	85 c0                	test   %eax,%eax
+  802749:	0f 88 97 00 00 00    	js     8027e6 <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  80274f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802752:	e8 ac fa ff ff       	call   802203 <pipe_ring>
+  802757:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  80275a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80275d:	e8 a1 fa ff ff       	call   802203 <pipe_ring>
+  802762:	83 ec 0c             	sub    $0xc,%esp
+  802765:	68 07 04 00 00       	push   $0x407
+  80276a:	53                   	push   %ebx
+  80276b:	6a 00                	push   $0x0
+  80276d:	01 f0                	add    %esi,%eax
+  80276f:	50                   	push   %eax
+  802770:	6a 00                	push   $0x0
+  802772:	e8 8c e4 ff ff       	call   800c03 <sys_page_map>
+  802777:	89 c3                	mov    %eax,%ebx
+  802779:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80277f:	83 c4 20             	add    $0x20,%esp
+  802782:	85 c0                	test   %eax,%eax
+  802784:	78 60                	js     8027e6 <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  802786:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  80278c:	75 9a                	jne    802728 <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  80278e:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  802795:	a1 20 40 80 00       	mov    0x804020,%eax
+  80279a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80279d:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  80279f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8027a2:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  8027a9:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8027ac:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  8027ae:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8027b1:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  8027b8:	83 ec 0c             	sub    $0xc,%esp
+  8027bb:	ff 75 e4             	push   -0x1c(%ebp)
+  8027be:	e8 0f ea ff ff       	call   8011d2 <fd2num>
+  8027c3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8027c6:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  8027c8:	83 c4 04             	add    $0x4,%esp
+  8027cb:	ff 75 e0             	push   -0x20(%ebp)
+  8027ce:	e8 ff e9 ff ff       	call   8011d2 <fd2num>
+  8027d3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8027d6:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  8027d9:	83 c4 10             	add    $0x10,%esp
+  8027dc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8027e1:	e9 87 00 00 00       	jmp    80286d <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  8027e6:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  8027eb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8027ee:	e8 10 fa ff ff       	call   802203 <pipe_ring>
+  8027f3:	83 ec 08             	sub    $0x8,%esp
+  8027f6:	01 f0                	add    %esi,%eax
+  8027f8:	50                   	push   %eax
+  8027f9:	6a 00                	push   $0x0
+  8027fb:	e8 45 e4 ff ff       	call   800c45 <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  802800:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802803:	e8 fb f9 ff ff       	call   802203 <pipe_ring>
+  802808:	83 c4 08             	add    $0x8,%esp
+  80280b:	01 f0                	add    %esi,%eax
+  80280d:	50                   	push   %eax
+  80280e:	6a 00                	push   $0x0
+  802810:	e8 30 e4 ff ff       	call   800c45 <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802815:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80281b:	83 c4 10             	add    $0x10,%esp
+  80281e:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802824:	75 c5                	jne    8027eb <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  802826:	83 ec 0c             	sub    $0xc,%esp
+  802829:	ff 75 e0             	push   -0x20(%ebp)
+  80282c:	e8 b1 e9 ff ff       	call   8011e2 <fd2data>
+  802831:	83 c4 08             	add    $0x8,%esp
+  802834:	50                   	push   %eax
+  802835:	6a 00                	push   $0x0
+  802837:	e8 09 e4 ff ff       	call   800c45 <sys_page_unmap>
+  80283c:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  80283f:	83 ec 08             	sub    $0x8,%esp
+  802842:	57                   	push   %edi
+  802843:	6a 00                	push   $0x0
+  802845:	e8 fb e3 ff ff       	call   800c45 <sys_page_unmap>
+  80284a:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  80284d:	83 ec 08             	sub    $0x8,%esp
+  802850:	ff 75 e0             	push   -0x20(%ebp)
+  802853:	6a 00                	push   $0x0
+  802855:	e8 eb e3 ff ff       	call   800c45 <sys_page_unmap>
+  80285a:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  80285d:	83 ec 08             	sub    $0x8,%esp
+  802860:	ff 75 e4             	push   -0x1c(%ebp)
+  802863:	6a 00                	push   $0x0
+  802865:	e8 db e3 ff ff       	call   800c45 <sys_page_unmap>
+  80286a:	83 c4 10             	add    $0x10,%esp
+}
+  80286d:	89 d8                	mov    %ebx,%eax
+  80286f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802872:	5b                   	pop    %ebx
+  802873:	5e                   	pop    %esi
+  802874:	5f                   	pop    %edi
+  802875:	5d                   	pop    %ebp
+  802876:	c3                   	ret
+
+00802877 <pipe>:
+{
+  802877:	55                   	push   %ebp
+  802878:	89 e5                	mov    %esp,%ebp
+  80287a:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  80287d:	6a 00                	push   $0x0
+  80287f:	ff 75 08             	push   0x8(%ebp)
+  802882:	e8 cc fd ff ff       	call   802653 <pipe2>
+}
+  802887:	c9                   	leave
+  802888:	c3                   	ret
+
+00802889 <pipeisclosed>:
+{
+  802889:	55                   	push   %ebp
+  80288a:	89 e5                	mov    %esp,%ebp
+  80288c:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80288f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802892:	50                   	push   %eax
+  802893:	ff 75 08             	push   0x8(%ebp)
+  802896:	e8 b1 e9 ff ff       	call   80124c <fd_lookup>
+  80289b:	83 c4 10             	add    $0x10,%esp
+  80289e:	85 c0                	test   %eax,%eax
+  8028a0:	78 18                	js     8028ba <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  8028a2:	83 ec 0c             	sub    $0xc,%esp
+  8028a5:	ff 75 f4             	push   -0xc(%ebp)
+  8028a8:	e8 35 e9 ff ff       	call   8011e2 <fd2data>
+  8028ad:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  8028af:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8028b2:	e8 59 fa ff ff       	call   802310 <_pipeisclosed>
+  8028b7:	83 c4 10             	add    $0x10,%esp
+}
+  8028ba:	c9                   	leave
+  8028bb:	c3                   	ret
+
+008028bc <pipe_splice>:
+{
+  8028bc:	55                   	push   %ebp
+  8028bd:	89 e5                	mov    %esp,%ebp
+  8028bf:	57                   	push   %edi
+  8028c0:	56                   	push   %esi
+  8028c1:	53                   	push   %ebx
+  8028c2:	83 ec 34             	sub    $0x34,%esp
+  8028c5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8028c8:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8028cb:	50                   	push   %eax
+  8028cc:	ff 75 08             	push   0x8(%ebp)
+  8028cf:	e8 78 e9 ff ff       	call   80124c <fd_lookup>
+  8028d4:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8028d7:	83 c4 10             	add    $0x10,%esp
+  8028da:	85 c0                	test   %eax,%eax
+  8028dc:	0f 88 d7 00 00 00    	js     8029b9 <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  8028e2:	83 ec 0c             	sub    $0xc,%esp
+  8028e5:	ff 75 e4             	push   -0x1c(%ebp)
+  8028e8:	e8 f5 e8 ff ff       	call   8011e2 <fd2data>
+  8028ed:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  8028ef:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8028f2:	83 c4 10             	add    $0x10,%esp
+  8028f5:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  8028fb:	39 10                	cmp    %edx,(%eax)
+  8028fd:	0f 85 c1 00 00 00    	jne    8029c4 <pipe_splice+0x108>
+  802903:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  802907:	0f 84 c0 00 00 00    	je     8029cd <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  80290d:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802911:	0f 84 bf 00 00 00    	je     8029d6 <pipe_splice+0x11a>
+  802917:	89 f7                	mov    %esi,%edi
+  802919:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  80291f:	0f 85 ba 00 00 00    	jne    8029df <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802925:	8d 43 04             	lea    0x4(%ebx),%eax
+  802928:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80292b:	eb 38                	jmp    802965 <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  80292d:	83 ec 0c             	sub    $0xc,%esp
+  802930:	68 00 10 00 00       	push   $0x1000
+  802935:	89 f1                	mov    %esi,%ecx
+  802937:	89 da                	mov    %ebx,%edx
+  802939:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80293c:	e8 34 fa ff ff       	call   802375 <devpipe_write_bulk>
+  802941:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802944:	83 c4 10             	add    $0x10,%esp
+  802947:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80294c:	75 53                	jne    8029a1 <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  80294e:	83 ec 08             	sub    $0x8,%esp
+  802951:	56                   	push   %esi
+  802952:	6a 00                	push   $0x0
+  802954:	e8 ec e2 ff ff       	call   800c45 <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  802959:	83 c7 01             	add    $0x1,%edi
+  80295c:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802962:	83 c4 10             	add    $0x10,%esp
+  802965:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802968:	74 3a                	je     8029a4 <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  80296a:	8b 03                	mov    (%ebx),%eax
+  80296c:	39 43 04             	cmp    %eax,0x4(%ebx)
+  80296f:	75 bc                	jne    80292d <pipe_splice+0x71>
+  802971:	b8 00 00 00 00       	mov    $0x0,%eax
+  802976:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  80297a:	85 c0                	test   %eax,%eax
+  80297c:	74 af                	je     80292d <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  80297e:	83 ec 04             	sub    $0x4,%esp
+  802981:	6a 07                	push   $0x7
+  802983:	56                   	push   %esi
+  802984:	ff 75 d0             	push   -0x30(%ebp)
+  802987:	e8 90 e5 ff ff       	call   800f1c <sys_chan_wakeup>
+  80298c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80298f:	83 c4 10             	add    $0x10,%esp
+  802992:	85 c0                	test   %eax,%eax
+  802994:	79 b8                	jns    80294e <pipe_splice+0x92>
+  802996:	b8 01 00 00 00       	mov    $0x1,%eax
+  80299b:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  80299f:	eb 8c                	jmp    80292d <pipe_splice+0x71>
+  8029a1:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  8029a4:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8029a8:	75 06                	jne    8029b0 <pipe_splice+0xf4>
+  8029aa:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  8029ae:	78 09                	js     8029b9 <pipe_splice+0xfd>
+  return i * PGSIZE;
+  8029b0:	8b 45 10             	mov    0x10(%ebp),%eax
+  8029b3:	c1 e0 0c             	shl    $0xc,%eax
+  8029b6:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  8029b9:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8029bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029bf:	5b                   	pop    %ebx
+  8029c0:	5e                   	pop    %esi
+  8029c1:	5f                   	pop    %edi
+  8029c2:	5d                   	pop    %ebp
+  8029c3:	c3                   	ret
+    return -E_INVAL;
+  8029c4:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  8029cb:	eb ec                	jmp    8029b9 <pipe_splice+0xfd>
+  8029cd:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  8029d4:	eb e3                	jmp    8029b9 <pipe_splice+0xfd>
+  8029d6:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  8029dd:	eb da                	jmp    8029b9 <pipe_splice+0xfd>
+  8029df:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  8029e6:	eb d1                	jmp    8029b9 <pipe_splice+0xfd>
+
+008029e8 <pipe_splice_read>:
+{
+  8029e8:	55                   	push   %ebp
+  8029e9:	89 e5                	mov    %esp,%ebp
+  8029eb:	53                   	push   %ebx
+  8029ec:	83 ec 1c             	sub    $0x1c,%esp
+  8029ef:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8029f2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8029f5:	50                   	push   %eax
+  8029f6:	ff 75 08             	push   0x8(%ebp)
+  8029f9:	e8 4e e8 ff ff       	call   80124c <fd_lookup>
+  8029fe:	83 c4 10             	add    $0x10,%esp
+  802a01:	85 c0                	test   %eax,%eax
+  802a03:	78 49                	js     802a4e <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  802a05:	83 ec 0c             	sub    $0xc,%esp
+  802a08:	ff 75 f4             	push   -0xc(%ebp)
+  802a0b:	e8 d2 e7 ff ff       	call   8011e2 <fd2data>
+  802a10:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802a12:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a15:	83 c4 10             	add    $0x10,%esp
+  802a18:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  802a1e:	39 08                	cmp    %ecx,(%eax)
+  802a20:	75 31                	jne    802a53 <pipe_splice_read+0x6b>
+  802a22:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  802a26:	74 32                	je     802a5a <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  802a28:	8b 48 08             	mov    0x8(%eax),%ecx
+  802a2b:	83 e1 03             	and    $0x3,%ecx
+  802a2e:	83 f9 01             	cmp    $0x1,%ecx
+  802a31:	74 2e                	je     802a61 <pipe_splice_read+0x79>
+  802a33:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  802a39:	75 2d                	jne    802a68 <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  802a3b:	83 ec 08             	sub    $0x8,%esp
+  802a3e:	53                   	push   %ebx
+  802a3f:	68 00 10 00 00       	push   $0x1000
+  802a44:	89 d9                	mov    %ebx,%ecx
+  802a46:	e8 93 fa ff ff       	call   8024de <devpipe_read_bulk>
+  802a4b:	83 c4 10             	add    $0x10,%esp
+}
+  802a4e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802a51:	c9                   	leave
+  802a52:	c3                   	ret
+    return -E_INVAL;
+  802a53:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a58:	eb f4                	jmp    802a4e <pipe_splice_read+0x66>
+  802a5a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a5f:	eb ed                	jmp    802a4e <pipe_splice_read+0x66>
+  802a61:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a66:	eb e6                	jmp    802a4e <pipe_splice_read+0x66>
+  802a68:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a6d:	eb df                	jmp    802a4e <pipe_splice_read+0x66>
+
+00802a6f <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  802a6f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a74:	c3                   	ret
+
+00802a75 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802a75:	55                   	push   %ebp
+  802a76:	89 e5                	mov    %esp,%ebp
+  802a78:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  802a7b:	68 5f 33 80 00       	push   $0x80335f
+  802a80:	ff 75 0c             	push   0xc(%ebp)
+  802a83:	e8 09 dd ff ff       	call   800791 <strcpy>
+  return 0;
+}
+  802a88:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a8d:	c9                   	leave
+  802a8e:	c3                   	ret
+
+00802a8f <devcons_write>:
+{
+  802a8f:	55                   	push   %ebp
+  802a90:	89 e5                	mov    %esp,%ebp
+  802a92:	57                   	push   %edi
+  802a93:	56                   	push   %esi
+  802a94:	53                   	push   %ebx
+  802a95:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  802a9b:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  802aa0:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  802aa6:	eb 2e                	jmp    802ad6 <devcons_write+0x47>
+    m = n - tot;
+  802aa8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802aab:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  802aad:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802ab2:	39 c3                	cmp    %eax,%ebx
+  802ab4:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  802ab7:	83 ec 04             	sub    $0x4,%esp
+  802aba:	53                   	push   %ebx
+  802abb:	89 f0                	mov    %esi,%eax
+  802abd:	03 45 0c             	add    0xc(%ebp),%eax
+  802ac0:	50                   	push   %eax
+  802ac1:	57                   	push   %edi
+  802ac2:	e8 50 de ff ff       	call   800917 <memmove>
+    sys_cputs(buf, m);
+  802ac7:	83 c4 08             	add    $0x8,%esp
+  802aca:	53                   	push   %ebx
+  802acb:	57                   	push   %edi
+  802acc:	e8 f0 df ff ff       	call   800ac1 <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  802ad1:	01 de                	add    %ebx,%esi
+  802ad3:	83 c4 10             	add    $0x10,%esp
+  802ad6:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802ad9:	72 cd                	jb     802aa8 <devcons_write+0x19>
+}
+  802adb:	89 f0                	mov    %esi,%eax
+  802add:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ae0:	5b                   	pop    %ebx
+  802ae1:	5e                   	pop    %esi
+  802ae2:	5f                   	pop    %edi
+  802ae3:	5d                   	pop    %ebp
+  802ae4:	c3                   	ret
+
+00802ae5 <devcons_read>:
+{
+  802ae5:	55                   	push   %ebp
+  802ae6:	89 e5                	mov    %esp,%ebp
+  802ae8:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  802aeb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802af0:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802af4:	75 07                	jne    802afd <devcons_read+0x18>
+  802af6:	eb 1f                	jmp    802b17 <devcons_read+0x32>
+    sys_yield();
+  802af8:	e8 61 e0 ff ff       	call   800b5e <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  802afd:	e8 dd df ff ff       	call   800adf <sys_cgetc>
+  802b02:	85 c0                	test   %eax,%eax
+  802b04:	74 f2                	je     802af8 <devcons_read+0x13>
+  if (c < 0)
+  802b06:	78 0f                	js     802b17 <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  802b08:	83 f8 04             	cmp    $0x4,%eax
+  802b0b:	74 0c                	je     802b19 <devcons_read+0x34>
+  *(char*)vbuf = c;
+  802b0d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802b10:	88 02                	mov    %al,(%edx)
+  return 1;
+  802b12:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802b17:	c9                   	leave
+  802b18:	c3                   	ret
+    return 0;
+  802b19:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b1e:	eb f7                	jmp    802b17 <devcons_read+0x32>
+
+00802b20 <cputchar>:
+{
+  802b20:	55                   	push   %ebp
+  802b21:	89 e5                	mov    %esp,%ebp
+  802b23:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  802b26:	8b 45 08             	mov    0x8(%ebp),%eax
+  802b29:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  802b2c:	6a 01                	push   $0x1
+  802b2e:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802b31:	50                   	push   %eax
+  802b32:	e8 8a df ff ff       	call   800ac1 <sys_cputs>
+}
+  802b37:	83 c4 10             	add    $0x10,%esp
+  802b3a:	c9                   	leave
+  802b3b:	c3                   	ret
+
+00802b3c <getchar>:
+{
+  802b3c:	55                   	push   %ebp
+  802b3d:	89 e5                	mov    %esp,%ebp
+  802b3f:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  802b42:	6a 01                	push   $0x1
+  802b44:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802b47:	50                   	push   %eax
+  802b48:	6a 00                	push   $0x0
+  802b4a:	e8 a8 e9 ff ff       	call   8014f7 <read>
+  if (r < 0)
+  802b4f:	83 c4 10             	add    $0x10,%esp
+  802b52:	85 c0                	test   %eax,%eax
+  802b54:	78 06                	js     802b5c <getchar+0x20>
+  if (r < 1)
+  802b56:	74 06                	je     802b5e <getchar+0x22>
+  return c;
+  802b58:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802b5c:	c9                   	leave
+  802b5d:	c3                   	ret
+    return -E_EOF;
+  802b5e:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802b63:	eb f7                	jmp    802b5c <getchar+0x20>
+
+00802b65 <iscons>:
+{
+  802b65:	55                   	push   %ebp
+  802b66:	89 e5                	mov    %esp,%ebp
+  802b68:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802b6b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b6e:	50                   	push   %eax
+  802b6f:	ff 75 08             	push   0x8(%ebp)
+  802b72:	e8 d5 e6 ff ff       	call   80124c <fd_lookup>
+  802b77:	83 c4 10             	add    $0x10,%esp
+  802b7a:	85 c0                	test   %eax,%eax
+  802b7c:	78 11                	js     802b8f <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  802b7e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b81:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802b87:	39 10                	cmp    %edx,(%eax)
+  802b89:	0f 94 c0             	sete   %al
+  802b8c:	0f b6 c0             	movzbl %al,%eax
+}
+  802b8f:	c9                   	leave
+  802b90:	c3                   	ret
+
+00802b91 <opencons>:
+{
+  802b91:	55                   	push   %ebp
+  802b92:	89 e5                	mov    %esp,%ebp
+  802b94:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  802b97:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b9a:	50                   	push   %eax
+  802b9b:	e8 56 e6 ff ff       	call   8011f6 <fd_alloc>
+  802ba0:	83 c4 10             	add    $0x10,%esp
+  802ba3:	85 c0                	test   %eax,%eax
+  802ba5:	78 3a                	js     802be1 <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802ba7:	83 ec 04             	sub    $0x4,%esp
+  802baa:	68 07 04 00 00       	push   $0x407
+  802baf:	ff 75 f4             	push   -0xc(%ebp)
+  802bb2:	6a 00                	push   $0x0
+  802bb4:	e8 07 e0 ff ff       	call   800bc0 <sys_page_alloc>
+  802bb9:	83 c4 10             	add    $0x10,%esp
+  802bbc:	85 c0                	test   %eax,%eax
+  802bbe:	78 21                	js     802be1 <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  802bc0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802bc3:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802bc9:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  802bcb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802bce:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  802bd5:	83 ec 0c             	sub    $0xc,%esp
+  802bd8:	50                   	push   %eax
+  802bd9:	e8 f4 e5 ff ff       	call   8011d2 <fd2num>
+  802bde:	83 c4 10             	add    $0x10,%esp
+}
+  802be1:	c9                   	leave
+  802be2:	c3                   	ret
+
+00802be3 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  802be3:	55                   	push   %ebp
+  802be4:	89 e5                	mov    %esp,%ebp
+  802be6:	56                   	push   %esi
+  802be7:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  802be8:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  802beb:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  802bf1:	e8 49 df ff ff       	call   800b3f <sys_getenvid>
+  802bf6:	83 ec 0c             	sub    $0xc,%esp
+  802bf9:	ff 75 0c             	push   0xc(%ebp)
+  802bfc:	ff 75 08             	push   0x8(%ebp)
+  802bff:	56                   	push   %esi
+  802c00:	50                   	push   %eax
+  802c01:	68 6c 33 80 00       	push   $0x80336c
+  802c06:	e8 98 d5 ff ff       	call   8001a3 <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  802c0b:	83 c4 18             	add    $0x18,%esp
+  802c0e:	53                   	push   %ebx
+  802c0f:	ff 75 10             	push   0x10(%ebp)
+  802c12:	e8 3b d5 ff ff       	call   800152 <vcprintf>
+  cprintf("\n");
+  802c17:	c7 04 24 58 33 80 00 	movl   $0x803358,(%esp)
+  802c1e:	e8 80 d5 ff ff       	call   8001a3 <cprintf>
+  802c23:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  802c26:	cc                   	int3
+  while (1)
+  802c27:	eb fd                	jmp    802c26 <_panic+0x43>
+
+00802c29 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802c29:	55                   	push   %ebp
+  802c2a:	89 e5                	mov    %esp,%ebp
+  802c2c:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802c2f:	89 c2                	mov    %eax,%edx
+  802c31:	c1 ea 16             	shr    $0x16,%edx
+  802c34:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  802c3b:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802c40:	f6 c1 01             	test   $0x1,%cl
+  802c43:	74 1c                	je     802c61 <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  802c45:	c1 e8 0c             	shr    $0xc,%eax
+  802c48:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  802c4f:	a8 01                	test   $0x1,%al
+  802c51:	74 0e                	je     802c61 <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  802c53:	c1 e8 0c             	shr    $0xc,%eax
+  802c56:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802c5d:	ef 
+  802c5e:	0f b7 d2             	movzwl %dx,%edx
+}
+  802c61:	89 d0                	mov    %edx,%eax
+  802c63:	5d                   	pop    %ebp
+  802c64:	c3                   	ret
+
+00802c65 <udivmod>:
+  802c65:	55                   	push   %ebp
+  802c66:	57                   	push   %edi
+  802c67:	56                   	push   %esi
+  802c68:	53                   	push   %ebx
+  802c69:	83 ec 14             	sub    $0x14,%esp
+  802c6c:	8b 74 24 28          	mov    0x28(%esp),%esi
+  802c70:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  802c74:	89 fb                	mov    %edi,%ebx
+  802c76:	09 f3                	or     %esi,%ebx
+  802c78:	0f 84 88 00 00 00    	je     802d06 <udivmod+0xa1>
+  802c7e:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802c83:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802c8a:	00 
+  802c8b:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802c92:	00 
+  802c93:	89 cd                	mov    %ecx,%ebp
+  802c95:	89 34 24             	mov    %esi,(%esp)
+  802c98:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802c9c:	eb 08                	jmp    802ca6 <udivmod+0x41>
+  802c9e:	83 ed 01             	sub    $0x1,%ebp
+  802ca1:	83 fd ff             	cmp    $0xffffffff,%ebp
+  802ca4:	74 6c                	je     802d12 <udivmod+0xad>
+  802ca6:	89 c3                	mov    %eax,%ebx
+  802ca8:	89 d6                	mov    %edx,%esi
+  802caa:	89 e9                	mov    %ebp,%ecx
+  802cac:	0f ad f3             	shrd   %cl,%esi,%ebx
+  802caf:	d3 ee                	shr    %cl,%esi
+  802cb1:	f6 c1 20             	test   $0x20,%cl
+  802cb4:	74 04                	je     802cba <udivmod+0x55>
+  802cb6:	89 f3                	mov    %esi,%ebx
+  802cb8:	31 f6                	xor    %esi,%esi
+  802cba:	8b 3c 24             	mov    (%esp),%edi
+  802cbd:	39 fb                	cmp    %edi,%ebx
+  802cbf:	89 f7                	mov    %esi,%edi
+  802cc1:	8b 1c 24             	mov    (%esp),%ebx
+  802cc4:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802cc8:	19 f7                	sbb    %esi,%edi
+  802cca:	72 d2                	jb     802c9e <udivmod+0x39>
+  802ccc:	89 f7                	mov    %esi,%edi
+  802cce:	89 de                	mov    %ebx,%esi
+  802cd0:	89 e9                	mov    %ebp,%ecx
+  802cd2:	0f a5 f7             	shld   %cl,%esi,%edi
+  802cd5:	d3 e6                	shl    %cl,%esi
+  802cd7:	f6 c1 20             	test   $0x20,%cl
+  802cda:	74 04                	je     802ce0 <udivmod+0x7b>
+  802cdc:	89 f7                	mov    %esi,%edi
+  802cde:	31 f6                	xor    %esi,%esi
+  802ce0:	29 f0                	sub    %esi,%eax
+  802ce2:	19 fa                	sbb    %edi,%edx
+  802ce4:	be 01 00 00 00       	mov    $0x1,%esi
+  802ce9:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cee:	0f a5 f7             	shld   %cl,%esi,%edi
+  802cf1:	d3 e6                	shl    %cl,%esi
+  802cf3:	f6 c1 20             	test   $0x20,%cl
+  802cf6:	74 04                	je     802cfc <udivmod+0x97>
+  802cf8:	89 f7                	mov    %esi,%edi
+  802cfa:	31 f6                	xor    %esi,%esi
+  802cfc:	09 74 24 08          	or     %esi,0x8(%esp)
+  802d00:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802d04:	eb 98                	jmp    802c9e <udivmod+0x39>
+  802d06:	89 f0                	mov    %esi,%eax
+  802d08:	89 fa                	mov    %edi,%edx
+  802d0a:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802d0e:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802d12:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802d16:	89 01                	mov    %eax,(%ecx)
+  802d18:	89 51 04             	mov    %edx,0x4(%ecx)
+  802d1b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802d1f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802d23:	83 c4 14             	add    $0x14,%esp
+  802d26:	5b                   	pop    %ebx
+  802d27:	5e                   	pop    %esi
+  802d28:	5f                   	pop    %edi
+  802d29:	5d                   	pop    %ebp
+  802d2a:	c3                   	ret
+
+00802d2b <__udivdi3>:
+  802d2b:	83 ec 18             	sub    $0x18,%esp
+  802d2e:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802d32:	50                   	push   %eax
+  802d33:	ff 74 24 2c          	push   0x2c(%esp)
+  802d37:	ff 74 24 2c          	push   0x2c(%esp)
+  802d3b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802d3f:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802d43:	e8 1d ff ff ff       	call   802c65 <udivmod>
+  802d48:	83 c4 24             	add    $0x24,%esp
+  802d4b:	c3                   	ret
+
+00802d4c <__umoddi3>:
+  802d4c:	83 ec 18             	sub    $0x18,%esp
+  802d4f:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802d53:	50                   	push   %eax
+  802d54:	ff 74 24 2c          	push   0x2c(%esp)
+  802d58:	ff 74 24 2c          	push   0x2c(%esp)
+  802d5c:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802d60:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802d64:	e8 fc fe ff ff       	call   802c65 <udivmod>
+  802d69:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802d6d:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802d71:	83 c4 24             	add    $0x24,%esp
+  802d74:	c3                   	ret
+
+00802d75 <__divdi3>:
+  802d75:	56                   	push   %esi
+  802d76:	53                   	push   %ebx
+  802d77:	83 ec 14             	sub    $0x14,%esp
+  802d7a:	8b 44 24 20          	mov    0x20(%esp),%eax
+  802d7e:	8b 54 24 24          	mov    0x24(%esp),%edx
+  802d82:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  802d86:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  802d8a:	85 d2                	test   %edx,%edx
+  802d8c:	78 18                	js     802da6 <__divdi3+0x31>
+  802d8e:	85 db                	test   %ebx,%ebx
+  802d90:	78 3e                	js     802dd0 <__divdi3+0x5b>
+  802d92:	83 ec 04             	sub    $0x4,%esp
+  802d95:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802d99:	56                   	push   %esi
+  802d9a:	53                   	push   %ebx
+  802d9b:	51                   	push   %ecx
+  802d9c:	e8 c4 fe ff ff       	call   802c65 <udivmod>
+  802da1:	83 c4 10             	add    $0x10,%esp
+  802da4:	eb 24                	jmp    802dca <__divdi3+0x55>
+  802da6:	f7 d8                	neg    %eax
+  802da8:	83 d2 00             	adc    $0x0,%edx
+  802dab:	f7 da                	neg    %edx
+  802dad:	85 db                	test   %ebx,%ebx
+  802daf:	78 3a                	js     802deb <__divdi3+0x76>
+  802db1:	83 ec 04             	sub    $0x4,%esp
+  802db4:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802db8:	56                   	push   %esi
+  802db9:	53                   	push   %ebx
+  802dba:	51                   	push   %ecx
+  802dbb:	e8 a5 fe ff ff       	call   802c65 <udivmod>
+  802dc0:	83 c4 10             	add    $0x10,%esp
+  802dc3:	f7 d8                	neg    %eax
+  802dc5:	83 d2 00             	adc    $0x0,%edx
+  802dc8:	f7 da                	neg    %edx
+  802dca:	83 c4 14             	add    $0x14,%esp
+  802dcd:	5b                   	pop    %ebx
+  802dce:	5e                   	pop    %esi
+  802dcf:	c3                   	ret
+  802dd0:	83 ec 04             	sub    $0x4,%esp
+  802dd3:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802dd7:	56                   	push   %esi
+  802dd8:	f7 d9                	neg    %ecx
+  802dda:	83 d3 00             	adc    $0x0,%ebx
+  802ddd:	f7 db                	neg    %ebx
+  802ddf:	53                   	push   %ebx
+  802de0:	51                   	push   %ecx
+  802de1:	e8 7f fe ff ff       	call   802c65 <udivmod>
+  802de6:	83 c4 10             	add    $0x10,%esp
+  802de9:	eb d8                	jmp    802dc3 <__divdi3+0x4e>
+  802deb:	83 ec 04             	sub    $0x4,%esp
+  802dee:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802df2:	56                   	push   %esi
+  802df3:	f7 d9                	neg    %ecx
+  802df5:	83 d3 00             	adc    $0x0,%ebx
+  802df8:	f7 db                	neg    %ebx
+  802dfa:	53                   	push   %ebx
+  802dfb:	51                   	push   %ecx
+  802dfc:	e8 64 fe ff ff       	call   802c65 <udivmod>
+  802e01:	83 c4 10             	add    $0x10,%esp
+  802e04:	eb c4                	jmp    802dca <__divdi3+0x55>
+
+00802e06 <__moddi3>:
+  802e06:	55                   	push   %ebp
+  802e07:	57                   	push   %edi
+  802e08:	56                   	push   %esi
+  802e09:	53                   	push   %ebx
+  802e0a:	83 ec 24             	sub    $0x24,%esp
+  802e0d:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802e11:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802e15:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  802e19:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  802e1d:	85 d2                	test   %edx,%edx
+  802e1f:	78 3b                	js     802e5c <__moddi3+0x56>
+  802e21:	83 ec 04             	sub    $0x4,%esp
+  802e24:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  802e28:	56                   	push   %esi
+  802e29:	89 ce                	mov    %ecx,%esi
+  802e2b:	f7 de                	neg    %esi
+  802e2d:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802e31:	89 de                	mov    %ebx,%esi
+  802e33:	83 d6 00             	adc    $0x0,%esi
+  802e36:	f7 de                	neg    %esi
+  802e38:	89 74 24 14          	mov    %esi,0x14(%esp)
+  802e3c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802e40:	0f 48 f1             	cmovs  %ecx,%esi
+  802e43:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  802e48:	53                   	push   %ebx
+  802e49:	56                   	push   %esi
+  802e4a:	e8 16 fe ff ff       	call   802c65 <udivmod>
+  802e4f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802e53:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802e57:	83 c4 10             	add    $0x10,%esp
+  802e5a:	eb 47                	jmp    802ea3 <__moddi3+0x9d>
+  802e5c:	f7 d8                	neg    %eax
+  802e5e:	83 d2 00             	adc    $0x0,%edx
+  802e61:	f7 da                	neg    %edx
+  802e63:	83 ec 04             	sub    $0x4,%esp
+  802e66:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  802e6a:	56                   	push   %esi
+  802e6b:	89 cf                	mov    %ecx,%edi
+  802e6d:	f7 df                	neg    %edi
+  802e6f:	89 de                	mov    %ebx,%esi
+  802e71:	83 d6 00             	adc    $0x0,%esi
+  802e74:	f7 de                	neg    %esi
+  802e76:	0f 49 cf             	cmovns %edi,%ecx
+  802e79:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802e7d:	0f 49 de             	cmovns %esi,%ebx
+  802e80:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  802e84:	ff 74 24 0c          	push   0xc(%esp)
+  802e88:	ff 74 24 0c          	push   0xc(%esp)
+  802e8c:	e8 d4 fd ff ff       	call   802c65 <udivmod>
+  802e91:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802e95:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802e99:	f7 d8                	neg    %eax
+  802e9b:	83 d2 00             	adc    $0x0,%edx
+  802e9e:	f7 da                	neg    %edx
+  802ea0:	83 c4 10             	add    $0x10,%esp
+  802ea3:	83 c4 24             	add    $0x24,%esp
+  802ea6:	5b                   	pop    %ebx
+  802ea7:	5e                   	pop    %esi
+  802ea8:	5f                   	pop    %edi
+  802ea9:	5d                   	pop    %ebp
+  802eaa:	c3                   	ret
@@ -0,0 +1,6572 @@
+
+obj/user/fallocbench.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 0c 02 00 00       	call   80023d <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <stream>:
+
+// Write NAME of 'size' bytes, reserving its blocks first if 'reserve';
+// returns KB/s.
+static unsigned
+stream(off_t size, bool reserve)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 24             	sub    $0x24,%esp
+  80003c:	89 c6                	mov    %eax,%esi
+  80003e:	89 d3                	mov    %edx,%ebx
+  unsigned start, ms;
+  off_t off;
+  int fd, r;
+
+  if ((fd = open(NAME, O_RDWR | O_CREAT | O_TRUNC)) < 0)
+  800040:	68 02 03 00 00       	push   $0x302
+  800045:	68 60 30 80 00       	push   $0x803060
+  80004a:	e8 52 1d 00 00       	call   801da1 <open>
+  80004f:	89 c7                	mov    %eax,%edi
+  800051:	83 c4 10             	add    $0x10,%esp
+  800054:	85 c0                	test   %eax,%eax
+  800056:	78 47                	js     80009f <stream+0x6c>
+    panic("open %s: %e", NAME, fd);
+  if ((r = sync()) < 0)
+  800058:	e8 2c 20 00 00       	call   802089 <sync>
+  80005d:	85 c0                	test   %eax,%eax
+  80005f:	78 58                	js     8000b9 <stream+0x86>
+    panic("sync: %e", r);
+
+  start = sys_time_msec();
+  800061:	e8 56 10 00 00       	call   8010bc <sys_time_msec>
+  800066:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if (reserve && (r = fallocate(fd, 0, size)) < 0)
+  800069:	84 db                	test   %bl,%bl
+  80006b:	75 5e                	jne    8000cb <stream+0x98>
+{
+  80006d:	bb 00 00 00 00       	mov    $0x0,%ebx
+    panic("fallocate %s: %e", NAME, r);
+  for (off = 0; off < size; off += BLKSIZE)
+  800072:	39 f3                	cmp    %esi,%ebx
+  800074:	0f 8d 98 00 00 00    	jge    800112 <stream+0xdf>
+    if ((r = write(fd, buf, BLKSIZE)) != BLKSIZE)
+  80007a:	83 ec 04             	sub    $0x4,%esp
+  80007d:	68 00 10 00 00       	push   $0x1000
+  800082:	68 00 50 80 00       	push   $0x805000
+  800087:	57                   	push   %edi
+  800088:	e8 b7 15 00 00       	call   801644 <write>
+  80008d:	83 c4 10             	add    $0x10,%esp
+  800090:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800095:	75 61                	jne    8000f8 <stream+0xc5>
+  for (off = 0; off < size; off += BLKSIZE)
+  800097:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80009d:	eb d3                	jmp    800072 <stream+0x3f>
+    panic("open %s: %e", NAME, fd);
+  80009f:	83 ec 0c             	sub    $0xc,%esp
+  8000a2:	50                   	push   %eax
+  8000a3:	68 60 30 80 00       	push   $0x803060
+  8000a8:	68 6d 30 80 00       	push   $0x80306d
+  8000ad:	6a 18                	push   $0x18
+  8000af:	68 79 30 80 00       	push   $0x803079
+  8000b4:	e8 f1 01 00 00       	call   8002aa <_panic>
+    panic("sync: %e", r);
+  8000b9:	50                   	push   %eax
+  8000ba:	68 8c 30 80 00       	push   $0x80308c
+  8000bf:	6a 1a                	push   $0x1a
+  8000c1:	68 79 30 80 00       	push   $0x803079
+  8000c6:	e8 df 01 00 00       	call   8002aa <_panic>
+  if (reserve && (r = fallocate(fd, 0, size)) < 0)
+  8000cb:	83 ec 04             	sub    $0x4,%esp
+  8000ce:	56                   	push   %esi
+  8000cf:	6a 00                	push   $0x0
+  8000d1:	57                   	push   %edi
+  8000d2:	e8 c1 20 00 00       	call   802198 <fallocate>
+  8000d7:	83 c4 10             	add    $0x10,%esp
+  8000da:	85 c0                	test   %eax,%eax
+  8000dc:	79 8f                	jns    80006d <stream+0x3a>
+    panic("fallocate %s: %e", NAME, r);
+  8000de:	83 ec 0c             	sub    $0xc,%esp
+  8000e1:	50                   	push   %eax
+  8000e2:	68 60 30 80 00       	push   $0x803060
+  8000e7:	68 95 30 80 00       	push   $0x803095
+  8000ec:	6a 1e                	push   $0x1e
+  8000ee:	68 79 30 80 00       	push   $0x803079
+  8000f3:	e8 b2 01 00 00       	call   8002aa <_panic>
+      panic("write %s: %e", NAME, r);
+  8000f8:	83 ec 0c             	sub    $0xc,%esp
+  8000fb:	50                   	push   %eax
+  8000fc:	68 60 30 80 00       	push   $0x803060
+  800101:	68 a6 30 80 00       	push   $0x8030a6
+  800106:	6a 21                	push   $0x21
+  800108:	68 79 30 80 00       	push   $0x803079
+  80010d:	e8 98 01 00 00       	call   8002aa <_panic>
+  close(fd);
+  800112:	83 ec 0c             	sub    $0xc,%esp
+  800115:	57                   	push   %edi
+  800116:	e8 d3 12 00 00       	call   8013ee <close>
+  if ((r = sync()) < 0)
+  80011b:	e8 69 1f 00 00       	call   802089 <sync>
+  800120:	83 c4 10             	add    $0x10,%esp
+  800123:	85 c0                	test   %eax,%eax
+  800125:	78 37                	js     80015e <stream+0x12b>
+    panic("sync: %e", r);
+  ms = sys_time_msec() - start;
+  800127:	e8 90 0f 00 00       	call   8010bc <sys_time_msec>
+  80012c:	89 c1                	mov    %eax,%ecx
+  return size / 1024 * 1000 / MAX(ms, 1);
+  80012e:	8d 86 ff 03 00 00    	lea    0x3ff(%esi),%eax
+  800134:	85 f6                	test   %esi,%esi
+  800136:	0f 49 c6             	cmovns %esi,%eax
+  800139:	c1 f8 0a             	sar    $0xa,%eax
+  80013c:	69 c0 e8 03 00 00    	imul   $0x3e8,%eax,%eax
+  ms = sys_time_msec() - start;
+  800142:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800145:	29 d1                	sub    %edx,%ecx
+  return size / 1024 * 1000 / MAX(ms, 1);
+  800147:	ba 01 00 00 00       	mov    $0x1,%edx
+  80014c:	0f 44 ca             	cmove  %edx,%ecx
+  80014f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800154:	f7 f1                	div    %ecx
+}
+  800156:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800159:	5b                   	pop    %ebx
+  80015a:	5e                   	pop    %esi
+  80015b:	5f                   	pop    %edi
+  80015c:	5d                   	pop    %ebp
+  80015d:	c3                   	ret
+    panic("sync: %e", r);
+  80015e:	50                   	push   %eax
+  80015f:	68 8c 30 80 00       	push   $0x80308c
+  800164:	6a 24                	push   $0x24
+  800166:	68 79 30 80 00       	push   $0x803079
+  80016b:	e8 3a 01 00 00       	call   8002aa <_panic>
+
+00800170 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800170:	55                   	push   %ebp
+  800171:	89 e5                	mov    %esp,%ebp
+  800173:	56                   	push   %esi
+  800174:	53                   	push   %ebx
+  off_t size;
+  int fd;
+
+  binaryname = "fallocbench";
+  800175:	c7 05 00 40 80 00 61 	movl   $0x803061,0x804000
+  80017c:	30 80 00 
+  size = 2 * 1024 * 1024;
+  80017f:	b8 00 00 20 00       	mov    $0x200000,%eax
+  if (argc > 1)
+  800184:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+  800188:	0f 8f 84 00 00 00    	jg     800212 <umain+0xa2>
+    size = strtol(argv[1], 0, 0) * 1024;
+  size = ROUNDUP(size, BLKSIZE);
+  80018e:	8d 98 ff 0f 00 00    	lea    0xfff(%eax),%ebx
+  800194:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  memset(buf, 'a', sizeof(buf));
+  80019a:	83 ec 04             	sub    $0x4,%esp
+  80019d:	68 00 10 00 00       	push   $0x1000
+  8001a2:	6a 61                	push   $0x61
+  8001a4:	68 00 50 80 00       	push   $0x805000
+  8001a9:	e8 16 09 00 00       	call   800ac4 <memset>
+
+  cprintf("fallocbench: %d KB appended:                 %5d KB/s\n",
+  8001ae:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001b3:	89 d8                	mov    %ebx,%eax
+  8001b5:	e8 79 fe ff ff       	call   800033 <stream>
+  8001ba:	8d b3 ff 03 00 00    	lea    0x3ff(%ebx),%esi
+  8001c0:	83 c4 0c             	add    $0xc,%esp
+  8001c3:	85 db                	test   %ebx,%ebx
+  8001c5:	0f 49 f3             	cmovns %ebx,%esi
+  8001c8:	c1 fe 0a             	sar    $0xa,%esi
+  8001cb:	50                   	push   %eax
+  8001cc:	56                   	push   %esi
+  8001cd:	68 b4 30 80 00       	push   $0x8030b4
+  8001d2:	e8 ae 01 00 00       	call   800385 <cprintf>
+          size / 1024, stream(size, 0));
+  cprintf("fallocbench: %d KB appended after fallocate: %5d KB/s\n",
+  8001d7:	ba 01 00 00 00       	mov    $0x1,%edx
+  8001dc:	89 d8                	mov    %ebx,%eax
+  8001de:	e8 50 fe ff ff       	call   800033 <stream>
+  8001e3:	83 c4 0c             	add    $0xc,%esp
+  8001e6:	50                   	push   %eax
+  8001e7:	56                   	push   %esi
+  8001e8:	68 ec 30 80 00       	push   $0x8030ec
+  8001ed:	e8 93 01 00 00       	call   800385 <cprintf>
+          size / 1024, stream(size, 1));
+
+  // Give the space back (there is no remove).
+  if ((fd = open(NAME, O_RDWR | O_TRUNC)) >= 0)
+  8001f2:	83 c4 08             	add    $0x8,%esp
+  8001f5:	68 02 02 00 00       	push   $0x202
+  8001fa:	68 60 30 80 00       	push   $0x803060
+  8001ff:	e8 9d 1b 00 00       	call   801da1 <open>
+  800204:	83 c4 10             	add    $0x10,%esp
+  800207:	85 c0                	test   %eax,%eax
+  800209:	79 24                	jns    80022f <umain+0xbf>
+    close(fd);
+}
+  80020b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80020e:	5b                   	pop    %ebx
+  80020f:	5e                   	pop    %esi
+  800210:	5d                   	pop    %ebp
+  800211:	c3                   	ret
+    size = strtol(argv[1], 0, 0) * 1024;
+  800212:	83 ec 04             	sub    $0x4,%esp
+  800215:	6a 00                	push   $0x0
+  800217:	6a 00                	push   $0x0
+  800219:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80021c:	ff 70 04             	push   0x4(%eax)
+  80021f:	e8 a3 09 00 00       	call   800bc7 <strtol>
+  800224:	c1 e0 0a             	shl    $0xa,%eax
+  800227:	83 c4 10             	add    $0x10,%esp
+  80022a:	e9 5f ff ff ff       	jmp    80018e <umain+0x1e>
+    close(fd);
+  80022f:	83 ec 0c             	sub    $0xc,%esp
+  800232:	50                   	push   %eax
+  800233:	e8 b6 11 00 00       	call   8013ee <close>
+  800238:	83 c4 10             	add    $0x10,%esp
+}
+  80023b:	eb ce                	jmp    80020b <umain+0x9b>
+
+0080023d <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80023d:	55                   	push   %ebp
+  80023e:	89 e5                	mov    %esp,%ebp
+  800240:	56                   	push   %esi
+  800241:	53                   	push   %ebx
+  800242:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800245:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  800248:	c7 05 44 67 80 00 00 	movl   $0x0,0x806744
+  80024f:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  800252:	e8 ca 0a 00 00       	call   800d21 <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  800257:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80025c:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80025f:	c1 e0 04             	shl    $0x4,%eax
+  800262:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800267:	a3 44 67 80 00       	mov    %eax,0x806744
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  80026c:	85 db                	test   %ebx,%ebx
+  80026e:	7e 07                	jle    800277 <libmain+0x3a>
+    binaryname = argv[0];
+  800270:	8b 06                	mov    (%esi),%eax
+  800272:	a3 00 40 80 00       	mov    %eax,0x804000
+
+  // call user main routine
+  umain(argc, argv);
+  800277:	83 ec 08             	sub    $0x8,%esp
+  80027a:	56                   	push   %esi
+  80027b:	53                   	push   %ebx
+  80027c:	e8 ef fe ff ff       	call   800170 <umain>
+
+  // exit gracefully
+  exit();
+  800281:	e8 0a 00 00 00       	call   800290 <exit>
+}
+  800286:	83 c4 10             	add    $0x10,%esp
+  800289:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80028c:	5b                   	pop    %ebx
+  80028d:	5e                   	pop    %esi
+  80028e:	5d                   	pop    %ebp
+  80028f:	c3                   	ret
+
+00800290 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800290:	55                   	push   %ebp
+  800291:	89 e5                	mov    %esp,%ebp
+  800293:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  800296:	e8 80 11 00 00       	call   80141b <close_all>
+  sys_env_destroy(0);
+  80029b:	83 ec 0c             	sub    $0xc,%esp
+  80029e:	6a 00                	push   $0x0
+  8002a0:	e8 3b 0a 00 00       	call   800ce0 <sys_env_destroy>
+}
+  8002a5:	83 c4 10             	add    $0x10,%esp
+  8002a8:	c9                   	leave
+  8002a9:	c3                   	ret
+
+008002aa <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8002aa:	55                   	push   %ebp
+  8002ab:	89 e5                	mov    %esp,%ebp
+  8002ad:	56                   	push   %esi
+  8002ae:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  8002af:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  8002b2:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  8002b8:	e8 64 0a 00 00       	call   800d21 <sys_getenvid>
+  8002bd:	83 ec 0c             	sub    $0xc,%esp
+  8002c0:	ff 75 0c             	push   0xc(%ebp)
+  8002c3:	ff 75 08             	push   0x8(%ebp)
+  8002c6:	56                   	push   %esi
+  8002c7:	50                   	push   %eax
+  8002c8:	68 30 31 80 00       	push   $0x803130
+  8002cd:	e8 b3 00 00 00       	call   800385 <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  8002d2:	83 c4 18             	add    $0x18,%esp
+  8002d5:	53                   	push   %ebx
+  8002d6:	ff 75 10             	push   0x10(%ebp)
+  8002d9:	e8 56 00 00 00       	call   800334 <vcprintf>
+  cprintf("\n");
+  8002de:	c7 04 24 a0 35 80 00 	movl   $0x8035a0,(%esp)
+  8002e5:	e8 9b 00 00 00       	call   800385 <cprintf>
+  8002ea:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  8002ed:	cc                   	int3
+  while (1)
+  8002ee:	eb fd                	jmp    8002ed <_panic+0x43>
+
+008002f0 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8002f0:	55                   	push   %ebp
+  8002f1:	89 e5                	mov    %esp,%ebp
+  8002f3:	53                   	push   %ebx
+  8002f4:	83 ec 04             	sub    $0x4,%esp
+  8002f7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  8002fa:	8b 13                	mov    (%ebx),%edx
+  8002fc:	8d 42 01             	lea    0x1(%edx),%eax
+  8002ff:	89 03                	mov    %eax,(%ebx)
+  800301:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800304:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  800308:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80030d:	74 09                	je     800318 <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  80030f:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800313:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800316:	c9                   	leave
+  800317:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  800318:	83 ec 08             	sub    $0x8,%esp
+  80031b:	68 ff 00 00 00       	push   $0xff
+  800320:	8d 43 08             	lea    0x8(%ebx),%eax
+  800323:	50                   	push   %eax
+  800324:	e8 7a 09 00 00       	call   800ca3 <sys_cputs>
+    b->idx = 0;
+  800329:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80032f:	83 c4 10             	add    $0x10,%esp
+  800332:	eb db                	jmp    80030f <putch+0x1f>
+
+00800334 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800334:	55                   	push   %ebp
+  800335:	89 e5                	mov    %esp,%ebp
+  800337:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  80033d:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800344:	00 00 00 
+  b.cnt = 0;
+  800347:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80034e:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  800351:	ff 75 0c             	push   0xc(%ebp)
+  800354:	ff 75 08             	push   0x8(%ebp)
+  800357:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80035d:	50                   	push   %eax
+  80035e:	68 f0 02 80 00       	push   $0x8002f0
+  800363:	e8 14 01 00 00       	call   80047c <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  800368:	83 c4 08             	add    $0x8,%esp
+  80036b:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800371:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800377:	50                   	push   %eax
+  800378:	e8 26 09 00 00       	call   800ca3 <sys_cputs>
+
+  return b.cnt;
+}
+  80037d:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800383:	c9                   	leave
+  800384:	c3                   	ret
+
+00800385 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800385:	55                   	push   %ebp
+  800386:	89 e5                	mov    %esp,%ebp
+  800388:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  80038b:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  80038e:	50                   	push   %eax
+  80038f:	ff 75 08             	push   0x8(%ebp)
+  800392:	e8 9d ff ff ff       	call   800334 <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  800397:	c9                   	leave
+  800398:	c3                   	ret
+
+00800399 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  800399:	55                   	push   %ebp
+  80039a:	89 e5                	mov    %esp,%ebp
+  80039c:	57                   	push   %edi
+  80039d:	56                   	push   %esi
+  80039e:	53                   	push   %ebx
+  80039f:	83 ec 1c             	sub    $0x1c,%esp
+  8003a2:	89 c7                	mov    %eax,%edi
+  8003a4:	89 d6                	mov    %edx,%esi
+  8003a6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003a9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8003ac:	89 d1                	mov    %edx,%ecx
+  8003ae:	89 c2                	mov    %eax,%edx
+  8003b0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8003b3:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8003b6:	8b 45 10             	mov    0x10(%ebp),%eax
+  8003b9:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  8003bc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003bf:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8003c6:	39 c2                	cmp    %eax,%edx
+  8003c8:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8003cb:	72 3e                	jb     80040b <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  8003cd:	83 ec 0c             	sub    $0xc,%esp
+  8003d0:	ff 75 18             	push   0x18(%ebp)
+  8003d3:	83 eb 01             	sub    $0x1,%ebx
+  8003d6:	53                   	push   %ebx
+  8003d7:	50                   	push   %eax
+  8003d8:	83 ec 08             	sub    $0x8,%esp
+  8003db:	ff 75 e4             	push   -0x1c(%ebp)
+  8003de:	ff 75 e0             	push   -0x20(%ebp)
+  8003e1:	ff 75 dc             	push   -0x24(%ebp)
+  8003e4:	ff 75 d8             	push   -0x28(%ebp)
+  8003e7:	e8 db 2a 00 00       	call   802ec7 <__udivdi3>
+  8003ec:	83 c4 18             	add    $0x18,%esp
+  8003ef:	52                   	push   %edx
+  8003f0:	50                   	push   %eax
+  8003f1:	89 f2                	mov    %esi,%edx
+  8003f3:	89 f8                	mov    %edi,%eax
+  8003f5:	e8 9f ff ff ff       	call   800399 <printnum>
+  8003fa:	83 c4 20             	add    $0x20,%esp
+  8003fd:	eb 13                	jmp    800412 <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  8003ff:	83 ec 08             	sub    $0x8,%esp
+  800402:	56                   	push   %esi
+  800403:	ff 75 18             	push   0x18(%ebp)
+  800406:	ff d7                	call   *%edi
+  800408:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  80040b:	83 eb 01             	sub    $0x1,%ebx
+  80040e:	85 db                	test   %ebx,%ebx
+  800410:	7f ed                	jg     8003ff <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  800412:	83 ec 08             	sub    $0x8,%esp
+  800415:	56                   	push   %esi
+  800416:	83 ec 04             	sub    $0x4,%esp
+  800419:	ff 75 e4             	push   -0x1c(%ebp)
+  80041c:	ff 75 e0             	push   -0x20(%ebp)
+  80041f:	ff 75 dc             	push   -0x24(%ebp)
+  800422:	ff 75 d8             	push   -0x28(%ebp)
+  800425:	e8 be 2a 00 00       	call   802ee8 <__umoddi3>
+  80042a:	83 c4 14             	add    $0x14,%esp
+  80042d:	0f be 80 53 31 80 00 	movsbl 0x803153(%eax),%eax
+  800434:	50                   	push   %eax
+  800435:	ff d7                	call   *%edi
+}
+  800437:	83 c4 10             	add    $0x10,%esp
+  80043a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80043d:	5b                   	pop    %ebx
+  80043e:	5e                   	pop    %esi
+  80043f:	5f                   	pop    %edi
+  800440:	5d                   	pop    %ebp
+  800441:	c3                   	ret
+
+00800442 <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800442:	55                   	push   %ebp
+  800443:	89 e5                	mov    %esp,%ebp
+  800445:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  800448:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  80044c:	8b 10                	mov    (%eax),%edx
+  80044e:	3b 50 04             	cmp    0x4(%eax),%edx
+  800451:	73 0a                	jae    80045d <sprintputch+0x1b>
+    *b->buf++ = ch;
+  800453:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800456:	89 08                	mov    %ecx,(%eax)
+  800458:	8b 45 08             	mov    0x8(%ebp),%eax
+  80045b:	88 02                	mov    %al,(%edx)
+}
+  80045d:	5d                   	pop    %ebp
+  80045e:	c3                   	ret
+
+0080045f <printfmt>:
+{
+  80045f:	55                   	push   %ebp
+  800460:	89 e5                	mov    %esp,%ebp
+  800462:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  800465:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  800468:	50                   	push   %eax
+  800469:	ff 75 10             	push   0x10(%ebp)
+  80046c:	ff 75 0c             	push   0xc(%ebp)
+  80046f:	ff 75 08             	push   0x8(%ebp)
+  800472:	e8 05 00 00 00       	call   80047c <vprintfmt>
+}
+  800477:	83 c4 10             	add    $0x10,%esp
+  80047a:	c9                   	leave
+  80047b:	c3                   	ret
+
+0080047c <vprintfmt>:
+{
+  80047c:	55                   	push   %ebp
+  80047d:	89 e5                	mov    %esp,%ebp
+  80047f:	57                   	push   %edi
+  800480:	56                   	push   %esi
+  800481:	53                   	push   %ebx
+  800482:	83 ec 2c             	sub    $0x2c,%esp
+  800485:	8b 75 08             	mov    0x8(%ebp),%esi
+  800488:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80048b:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80048e:	eb 0a                	jmp    80049a <vprintfmt+0x1e>
+      putch(ch, putdat);
+  800490:	83 ec 08             	sub    $0x8,%esp
+  800493:	53                   	push   %ebx
+  800494:	50                   	push   %eax
+  800495:	ff d6                	call   *%esi
+  800497:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  80049a:	83 c7 01             	add    $0x1,%edi
+  80049d:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8004a1:	83 f8 25             	cmp    $0x25,%eax
+  8004a4:	74 0c                	je     8004b2 <vprintfmt+0x36>
+      if (ch == '\0')
+  8004a6:	85 c0                	test   %eax,%eax
+  8004a8:	75 e6                	jne    800490 <vprintfmt+0x14>
+}
+  8004aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004ad:	5b                   	pop    %ebx
+  8004ae:	5e                   	pop    %esi
+  8004af:	5f                   	pop    %edi
+  8004b0:	5d                   	pop    %ebp
+  8004b1:	c3                   	ret
+    padc = ' ';
+  8004b2:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  8004b6:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  8004bd:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  8004c4:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  8004cb:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  8004d0:	8d 47 01             	lea    0x1(%edi),%eax
+  8004d3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8004d6:	0f b6 17             	movzbl (%edi),%edx
+  8004d9:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8004dc:	3c 55                	cmp    $0x55,%al
+  8004de:	0f 87 cf 03 00 00    	ja     8008b3 <vprintfmt+0x437>
+  8004e4:	0f b6 c0             	movzbl %al,%eax
+  8004e7:	ff 24 85 a0 32 80 00 	jmp    *0x8032a0(,%eax,4)
+  8004ee:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  8004f1:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8004f5:	eb d9                	jmp    8004d0 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  8004f7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8004fa:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8004fe:	eb d0                	jmp    8004d0 <vprintfmt+0x54>
+  800500:	0f b6 d2             	movzbl %dl,%edx
+  800503:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  800506:	b8 00 00 00 00       	mov    $0x0,%eax
+  80050b:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  80050e:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800511:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  800515:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  800518:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80051b:	83 f9 09             	cmp    $0x9,%ecx
+  80051e:	77 55                	ja     800575 <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  800520:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  800523:	eb e9                	jmp    80050e <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  800525:	8b 45 14             	mov    0x14(%ebp),%eax
+  800528:	8b 00                	mov    (%eax),%eax
+  80052a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80052d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800530:	8d 40 04             	lea    0x4(%eax),%eax
+  800533:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  800536:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  800539:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80053d:	79 91                	jns    8004d0 <vprintfmt+0x54>
+        width = precision, precision = -1;
+  80053f:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800542:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800545:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80054c:	eb 82                	jmp    8004d0 <vprintfmt+0x54>
+      if (width < 0)
+  80054e:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800551:	85 d2                	test   %edx,%edx
+  800553:	b8 00 00 00 00       	mov    $0x0,%eax
+  800558:	0f 49 c2             	cmovns %edx,%eax
+  80055b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  80055e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  800561:	e9 6a ff ff ff       	jmp    8004d0 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  800566:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  800569:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  800570:	e9 5b ff ff ff       	jmp    8004d0 <vprintfmt+0x54>
+  800575:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800578:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80057b:	eb bc                	jmp    800539 <vprintfmt+0xbd>
+      lflag++;
+  80057d:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  800580:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  800583:	e9 48 ff ff ff       	jmp    8004d0 <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  800588:	8b 45 14             	mov    0x14(%ebp),%eax
+  80058b:	8d 78 04             	lea    0x4(%eax),%edi
+  80058e:	83 ec 08             	sub    $0x8,%esp
+  800591:	53                   	push   %ebx
+  800592:	ff 30                	push   (%eax)
+  800594:	ff d6                	call   *%esi
+      break;
+  800596:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  800599:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  80059c:	e9 b1 02 00 00       	jmp    800852 <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  8005a1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a4:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  8005a7:	8b 10                	mov    (%eax),%edx
+  8005a9:	89 d0                	mov    %edx,%eax
+  8005ab:	f7 d8                	neg    %eax
+  8005ad:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8005b0:	83 f8 10             	cmp    $0x10,%eax
+  8005b3:	7f 23                	jg     8005d8 <vprintfmt+0x15c>
+  8005b5:	8b 14 85 00 34 80 00 	mov    0x803400(,%eax,4),%edx
+  8005bc:	85 d2                	test   %edx,%edx
+  8005be:	74 18                	je     8005d8 <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  8005c0:	52                   	push   %edx
+  8005c1:	68 4a 35 80 00       	push   $0x80354a
+  8005c6:	53                   	push   %ebx
+  8005c7:	56                   	push   %esi
+  8005c8:	e8 92 fe ff ff       	call   80045f <printfmt>
+  8005cd:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  8005d0:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8005d3:	e9 7a 02 00 00       	jmp    800852 <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  8005d8:	50                   	push   %eax
+  8005d9:	68 6b 31 80 00       	push   $0x80316b
+  8005de:	53                   	push   %ebx
+  8005df:	56                   	push   %esi
+  8005e0:	e8 7a fe ff ff       	call   80045f <printfmt>
+  8005e5:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  8005e8:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  8005eb:	e9 62 02 00 00       	jmp    800852 <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  8005f0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f3:	83 c0 04             	add    $0x4,%eax
+  8005f6:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8005f9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005fc:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  8005fe:	85 c9                	test   %ecx,%ecx
+  800600:	b8 64 31 80 00       	mov    $0x803164,%eax
+  800605:	0f 45 c1             	cmovne %ecx,%eax
+  800608:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  80060b:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80060f:	7e 06                	jle    800617 <vprintfmt+0x19b>
+  800611:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800615:	75 0b                	jne    800622 <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800617:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80061a:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80061d:	89 75 08             	mov    %esi,0x8(%ebp)
+  800620:	eb 5c                	jmp    80067e <vprintfmt+0x202>
+  800622:	83 ec 08             	sub    $0x8,%esp
+  800625:	ff 75 d0             	push   -0x30(%ebp)
+  800628:	ff 75 cc             	push   -0x34(%ebp)
+  80062b:	e8 20 03 00 00       	call   800950 <strnlen>
+  800630:	89 c2                	mov    %eax,%edx
+  800632:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800635:	29 d0                	sub    %edx,%eax
+  800637:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  80063a:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80063e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800641:	89 75 08             	mov    %esi,0x8(%ebp)
+  800644:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800646:	eb 0e                	jmp    800656 <vprintfmt+0x1da>
+          putch(padc, putdat);
+  800648:	83 ec 08             	sub    $0x8,%esp
+  80064b:	53                   	push   %ebx
+  80064c:	57                   	push   %edi
+  80064d:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800650:	83 ee 01             	sub    $0x1,%esi
+  800653:	83 c4 10             	add    $0x10,%esp
+  800656:	85 f6                	test   %esi,%esi
+  800658:	7f ee                	jg     800648 <vprintfmt+0x1cc>
+  80065a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80065d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800660:	85 c0                	test   %eax,%eax
+  800662:	ba 00 00 00 00       	mov    $0x0,%edx
+  800667:	0f 49 d0             	cmovns %eax,%edx
+  80066a:	29 d0                	sub    %edx,%eax
+  80066c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80066f:	eb a6                	jmp    800617 <vprintfmt+0x19b>
+          putch(ch, putdat);
+  800671:	83 ec 08             	sub    $0x8,%esp
+  800674:	53                   	push   %ebx
+  800675:	52                   	push   %edx
+  800676:	ff 55 08             	call   *0x8(%ebp)
+  800679:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80067c:	89 f1                	mov    %esi,%ecx
+  80067e:	8d 71 01             	lea    0x1(%ecx),%esi
+  800681:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800685:	0f be d0             	movsbl %al,%edx
+  800688:	85 d2                	test   %edx,%edx
+  80068a:	74 28                	je     8006b4 <vprintfmt+0x238>
+  80068c:	85 ff                	test   %edi,%edi
+  80068e:	78 05                	js     800695 <vprintfmt+0x219>
+  800690:	83 ef 01             	sub    $0x1,%edi
+  800693:	78 30                	js     8006c5 <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  800695:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800699:	74 d6                	je     800671 <vprintfmt+0x1f5>
+  80069b:	0f be c0             	movsbl %al,%eax
+  80069e:	83 e8 20             	sub    $0x20,%eax
+  8006a1:	83 f8 5e             	cmp    $0x5e,%eax
+  8006a4:	76 cb                	jbe    800671 <vprintfmt+0x1f5>
+          putch('?', putdat);
+  8006a6:	83 ec 08             	sub    $0x8,%esp
+  8006a9:	53                   	push   %ebx
+  8006aa:	6a 3f                	push   $0x3f
+  8006ac:	ff 55 08             	call   *0x8(%ebp)
+  8006af:	83 c4 10             	add    $0x10,%esp
+  8006b2:	eb c8                	jmp    80067c <vprintfmt+0x200>
+  8006b4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006b7:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8006ba:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8006bd:	01 d0                	add    %edx,%eax
+  8006bf:	29 c8                	sub    %ecx,%eax
+  8006c1:	89 c7                	mov    %eax,%edi
+  8006c3:	eb 13                	jmp    8006d8 <vprintfmt+0x25c>
+  8006c5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006c8:	eb ed                	jmp    8006b7 <vprintfmt+0x23b>
+        putch(' ', putdat);
+  8006ca:	83 ec 08             	sub    $0x8,%esp
+  8006cd:	53                   	push   %ebx
+  8006ce:	6a 20                	push   $0x20
+  8006d0:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  8006d2:	83 ef 01             	sub    $0x1,%edi
+  8006d5:	83 c4 10             	add    $0x10,%esp
+  8006d8:	85 ff                	test   %edi,%edi
+  8006da:	7f ee                	jg     8006ca <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  8006dc:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8006df:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006e2:	e9 6b 01 00 00       	jmp    800852 <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  8006e7:	83 f9 01             	cmp    $0x1,%ecx
+  8006ea:	7f 1f                	jg     80070b <vprintfmt+0x28f>
+  else if (lflag)
+  8006ec:	85 c9                	test   %ecx,%ecx
+  8006ee:	74 67                	je     800757 <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  8006f0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f3:	8b 00                	mov    (%eax),%eax
+  8006f5:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006f8:	89 c1                	mov    %eax,%ecx
+  8006fa:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006fd:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800700:	8b 45 14             	mov    0x14(%ebp),%eax
+  800703:	8d 40 04             	lea    0x4(%eax),%eax
+  800706:	89 45 14             	mov    %eax,0x14(%ebp)
+  800709:	eb 17                	jmp    800722 <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  80070b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80070e:	8b 50 04             	mov    0x4(%eax),%edx
+  800711:	8b 00                	mov    (%eax),%eax
+  800713:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800716:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800719:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071c:	8d 40 08             	lea    0x8(%eax),%eax
+  80071f:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  800722:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800725:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  800728:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  80072d:	85 c9                	test   %ecx,%ecx
+  80072f:	0f 89 03 01 00 00    	jns    800838 <vprintfmt+0x3bc>
+        putch('-', putdat);
+  800735:	83 ec 08             	sub    $0x8,%esp
+  800738:	53                   	push   %ebx
+  800739:	6a 2d                	push   $0x2d
+  80073b:	ff d6                	call   *%esi
+        num = -(long long)num;
+  80073d:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800740:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800743:	f7 da                	neg    %edx
+  800745:	83 d1 00             	adc    $0x0,%ecx
+  800748:	f7 d9                	neg    %ecx
+  80074a:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  80074d:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800752:	e9 e1 00 00 00       	jmp    800838 <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  800757:	8b 45 14             	mov    0x14(%ebp),%eax
+  80075a:	8b 00                	mov    (%eax),%eax
+  80075c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80075f:	89 c1                	mov    %eax,%ecx
+  800761:	c1 f9 1f             	sar    $0x1f,%ecx
+  800764:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800767:	8b 45 14             	mov    0x14(%ebp),%eax
+  80076a:	8d 40 04             	lea    0x4(%eax),%eax
+  80076d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800770:	eb b0                	jmp    800722 <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  800772:	83 f9 01             	cmp    $0x1,%ecx
+  800775:	7f 1e                	jg     800795 <vprintfmt+0x319>
+  else if (lflag)
+  800777:	85 c9                	test   %ecx,%ecx
+  800779:	74 32                	je     8007ad <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  80077b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80077e:	8b 10                	mov    (%eax),%edx
+  800780:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800785:	8d 40 04             	lea    0x4(%eax),%eax
+  800788:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  80078b:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  800790:	e9 a3 00 00 00       	jmp    800838 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800795:	8b 45 14             	mov    0x14(%ebp),%eax
+  800798:	8b 10                	mov    (%eax),%edx
+  80079a:	8b 48 04             	mov    0x4(%eax),%ecx
+  80079d:	8d 40 08             	lea    0x8(%eax),%eax
+  8007a0:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  8007a3:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  8007a8:	e9 8b 00 00 00       	jmp    800838 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8007ad:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b0:	8b 10                	mov    (%eax),%edx
+  8007b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007b7:	8d 40 04             	lea    0x4(%eax),%eax
+  8007ba:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  8007bd:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  8007c2:	eb 74                	jmp    800838 <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  8007c4:	83 f9 01             	cmp    $0x1,%ecx
+  8007c7:	7f 1b                	jg     8007e4 <vprintfmt+0x368>
+  else if (lflag)
+  8007c9:	85 c9                	test   %ecx,%ecx
+  8007cb:	74 2c                	je     8007f9 <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  8007cd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d0:	8b 10                	mov    (%eax),%edx
+  8007d2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007d7:	8d 40 04             	lea    0x4(%eax),%eax
+  8007da:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8007dd:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  8007e2:	eb 54                	jmp    800838 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  8007e4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e7:	8b 10                	mov    (%eax),%edx
+  8007e9:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007ec:	8d 40 08             	lea    0x8(%eax),%eax
+  8007ef:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8007f2:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  8007f7:	eb 3f                	jmp    800838 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8007f9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007fc:	8b 10                	mov    (%eax),%edx
+  8007fe:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800803:	8d 40 04             	lea    0x4(%eax),%eax
+  800806:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800809:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  80080e:	eb 28                	jmp    800838 <vprintfmt+0x3bc>
+      putch('0', putdat);
+  800810:	83 ec 08             	sub    $0x8,%esp
+  800813:	53                   	push   %ebx
+  800814:	6a 30                	push   $0x30
+  800816:	ff d6                	call   *%esi
+      putch('x', putdat);
+  800818:	83 c4 08             	add    $0x8,%esp
+  80081b:	53                   	push   %ebx
+  80081c:	6a 78                	push   $0x78
+  80081e:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  800820:	8b 45 14             	mov    0x14(%ebp),%eax
+  800823:	8b 10                	mov    (%eax),%edx
+  800825:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  80082a:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  80082d:	8d 40 04             	lea    0x4(%eax),%eax
+  800830:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800833:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  800838:	83 ec 0c             	sub    $0xc,%esp
+  80083b:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80083f:	50                   	push   %eax
+  800840:	ff 75 e0             	push   -0x20(%ebp)
+  800843:	57                   	push   %edi
+  800844:	51                   	push   %ecx
+  800845:	52                   	push   %edx
+  800846:	89 da                	mov    %ebx,%edx
+  800848:	89 f0                	mov    %esi,%eax
+  80084a:	e8 4a fb ff ff       	call   800399 <printnum>
+      break;
+  80084f:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  800852:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  800855:	e9 40 fc ff ff       	jmp    80049a <vprintfmt+0x1e>
+  if (lflag >= 2)
+  80085a:	83 f9 01             	cmp    $0x1,%ecx
+  80085d:	7f 1b                	jg     80087a <vprintfmt+0x3fe>
+  else if (lflag)
+  80085f:	85 c9                	test   %ecx,%ecx
+  800861:	74 2c                	je     80088f <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  800863:	8b 45 14             	mov    0x14(%ebp),%eax
+  800866:	8b 10                	mov    (%eax),%edx
+  800868:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80086d:	8d 40 04             	lea    0x4(%eax),%eax
+  800870:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800873:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  800878:	eb be                	jmp    800838 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  80087a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80087d:	8b 10                	mov    (%eax),%edx
+  80087f:	8b 48 04             	mov    0x4(%eax),%ecx
+  800882:	8d 40 08             	lea    0x8(%eax),%eax
+  800885:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800888:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  80088d:	eb a9                	jmp    800838 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  80088f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800892:	8b 10                	mov    (%eax),%edx
+  800894:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800899:	8d 40 04             	lea    0x4(%eax),%eax
+  80089c:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  80089f:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  8008a4:	eb 92                	jmp    800838 <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  8008a6:	83 ec 08             	sub    $0x8,%esp
+  8008a9:	53                   	push   %ebx
+  8008aa:	6a 25                	push   $0x25
+  8008ac:	ff d6                	call   *%esi
+      break;
+  8008ae:	83 c4 10             	add    $0x10,%esp
+  8008b1:	eb 9f                	jmp    800852 <vprintfmt+0x3d6>
+      putch('%', putdat);
+  8008b3:	83 ec 08             	sub    $0x8,%esp
+  8008b6:	53                   	push   %ebx
+  8008b7:	6a 25                	push   $0x25
+  8008b9:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  8008bb:	83 c4 10             	add    $0x10,%esp
+  8008be:	89 f8                	mov    %edi,%eax
+  8008c0:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8008c4:	74 05                	je     8008cb <vprintfmt+0x44f>
+  8008c6:	83 e8 01             	sub    $0x1,%eax
+  8008c9:	eb f5                	jmp    8008c0 <vprintfmt+0x444>
+  8008cb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8008ce:	eb 82                	jmp    800852 <vprintfmt+0x3d6>
+
+008008d0 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8008d0:	55                   	push   %ebp
+  8008d1:	89 e5                	mov    %esp,%ebp
+  8008d3:	83 ec 18             	sub    $0x18,%esp
+  8008d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008d9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  8008dc:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8008df:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8008e3:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8008e6:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  8008ed:	85 c0                	test   %eax,%eax
+  8008ef:	74 26                	je     800917 <vsnprintf+0x47>
+  8008f1:	85 d2                	test   %edx,%edx
+  8008f3:	7e 22                	jle    800917 <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8008f5:	ff 75 14             	push   0x14(%ebp)
+  8008f8:	ff 75 10             	push   0x10(%ebp)
+  8008fb:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8008fe:	50                   	push   %eax
+  8008ff:	68 42 04 80 00       	push   $0x800442
+  800904:	e8 73 fb ff ff       	call   80047c <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800909:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80090c:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  80090f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800912:	83 c4 10             	add    $0x10,%esp
+}
+  800915:	c9                   	leave
+  800916:	c3                   	ret
+    return -E_INVAL;
+  800917:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80091c:	eb f7                	jmp    800915 <vsnprintf+0x45>
+
+0080091e <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80091e:	55                   	push   %ebp
+  80091f:	89 e5                	mov    %esp,%ebp
+  800921:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  800924:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  800927:	50                   	push   %eax
+  800928:	ff 75 10             	push   0x10(%ebp)
+  80092b:	ff 75 0c             	push   0xc(%ebp)
+  80092e:	ff 75 08             	push   0x8(%ebp)
+  800931:	e8 9a ff ff ff       	call   8008d0 <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  800936:	c9                   	leave
+  800937:	c3                   	ret
+
+00800938 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800938:	55                   	push   %ebp
+  800939:	89 e5                	mov    %esp,%ebp
+  80093b:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  80093e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800943:	eb 03                	jmp    800948 <strlen+0x10>
+    n++;
+  800945:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  800948:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80094c:	75 f7                	jne    800945 <strlen+0xd>
+  return n;
+}
+  80094e:	5d                   	pop    %ebp
+  80094f:	c3                   	ret
+
+00800950 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800950:	55                   	push   %ebp
+  800951:	89 e5                	mov    %esp,%ebp
+  800953:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800956:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800959:	b8 00 00 00 00       	mov    $0x0,%eax
+  80095e:	eb 03                	jmp    800963 <strnlen+0x13>
+    n++;
+  800960:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800963:	39 d0                	cmp    %edx,%eax
+  800965:	74 08                	je     80096f <strnlen+0x1f>
+  800967:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80096b:	75 f3                	jne    800960 <strnlen+0x10>
+  80096d:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  80096f:	89 d0                	mov    %edx,%eax
+  800971:	5d                   	pop    %ebp
+  800972:	c3                   	ret
+
+00800973 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800973:	55                   	push   %ebp
+  800974:	89 e5                	mov    %esp,%ebp
+  800976:	53                   	push   %ebx
+  800977:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80097a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  80097d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800982:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800986:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800989:	83 c0 01             	add    $0x1,%eax
+  80098c:	84 d2                	test   %dl,%dl
+  80098e:	75 f2                	jne    800982 <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  800990:	89 c8                	mov    %ecx,%eax
+  800992:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800995:	c9                   	leave
+  800996:	c3                   	ret
+
+00800997 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800997:	55                   	push   %ebp
+  800998:	89 e5                	mov    %esp,%ebp
+  80099a:	53                   	push   %ebx
+  80099b:	83 ec 10             	sub    $0x10,%esp
+  80099e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  8009a1:	53                   	push   %ebx
+  8009a2:	e8 91 ff ff ff       	call   800938 <strlen>
+  8009a7:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  8009aa:	ff 75 0c             	push   0xc(%ebp)
+  8009ad:	01 d8                	add    %ebx,%eax
+  8009af:	50                   	push   %eax
+  8009b0:	e8 be ff ff ff       	call   800973 <strcpy>
+  return dst;
+}
+  8009b5:	89 d8                	mov    %ebx,%eax
+  8009b7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009ba:	c9                   	leave
+  8009bb:	c3                   	ret
+
+008009bc <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  8009bc:	55                   	push   %ebp
+  8009bd:	89 e5                	mov    %esp,%ebp
+  8009bf:	56                   	push   %esi
+  8009c0:	53                   	push   %ebx
+  8009c1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009c4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  8009c7:	89 f3                	mov    %esi,%ebx
+  8009c9:	03 5d 10             	add    0x10(%ebp),%ebx
+  8009cc:	89 f0                	mov    %esi,%eax
+  8009ce:	eb 0f                	jmp    8009df <strncpy+0x23>
+    *dst++ = *src;
+  8009d0:	83 c0 01             	add    $0x1,%eax
+  8009d3:	0f b6 0a             	movzbl (%edx),%ecx
+  8009d6:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  8009d9:	80 f9 01             	cmp    $0x1,%cl
+  8009dc:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  8009df:	39 d8                	cmp    %ebx,%eax
+  8009e1:	75 ed                	jne    8009d0 <strncpy+0x14>
+  }
+  return ret;
+}
+  8009e3:	89 f0                	mov    %esi,%eax
+  8009e5:	5b                   	pop    %ebx
+  8009e6:	5e                   	pop    %esi
+  8009e7:	5d                   	pop    %ebp
+  8009e8:	c3                   	ret
+
+008009e9 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8009e9:	55                   	push   %ebp
+  8009ea:	89 e5                	mov    %esp,%ebp
+  8009ec:	56                   	push   %esi
+  8009ed:	53                   	push   %ebx
+  8009ee:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009f1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009f4:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  8009f7:	89 f0                	mov    %esi,%eax
+  8009f9:	85 d2                	test   %edx,%edx
+  8009fb:	74 21                	je     800a1e <strlcpy+0x35>
+  8009fd:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800a01:	89 f2                	mov    %esi,%edx
+  800a03:	eb 09                	jmp    800a0e <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  800a05:	83 c1 01             	add    $0x1,%ecx
+  800a08:	83 c2 01             	add    $0x1,%edx
+  800a0b:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  800a0e:	39 c2                	cmp    %eax,%edx
+  800a10:	74 09                	je     800a1b <strlcpy+0x32>
+  800a12:	0f b6 19             	movzbl (%ecx),%ebx
+  800a15:	84 db                	test   %bl,%bl
+  800a17:	75 ec                	jne    800a05 <strlcpy+0x1c>
+  800a19:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  800a1b:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  800a1e:	29 f0                	sub    %esi,%eax
+}
+  800a20:	5b                   	pop    %ebx
+  800a21:	5e                   	pop    %esi
+  800a22:	5d                   	pop    %ebp
+  800a23:	c3                   	ret
+
+00800a24 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800a24:	55                   	push   %ebp
+  800a25:	89 e5                	mov    %esp,%ebp
+  800a27:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a2a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  800a2d:	eb 06                	jmp    800a35 <strcmp+0x11>
+    p++, q++;
+  800a2f:	83 c1 01             	add    $0x1,%ecx
+  800a32:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  800a35:	0f b6 01             	movzbl (%ecx),%eax
+  800a38:	84 c0                	test   %al,%al
+  800a3a:	74 04                	je     800a40 <strcmp+0x1c>
+  800a3c:	3a 02                	cmp    (%edx),%al
+  800a3e:	74 ef                	je     800a2f <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  800a40:	0f b6 c0             	movzbl %al,%eax
+  800a43:	0f b6 12             	movzbl (%edx),%edx
+  800a46:	29 d0                	sub    %edx,%eax
+}
+  800a48:	5d                   	pop    %ebp
+  800a49:	c3                   	ret
+
+00800a4a <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800a4a:	55                   	push   %ebp
+  800a4b:	89 e5                	mov    %esp,%ebp
+  800a4d:	53                   	push   %ebx
+  800a4e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a51:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a54:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  800a57:	eb 09                	jmp    800a62 <strncmp+0x18>
+    n--, p++, q++;
+  800a59:	83 ea 01             	sub    $0x1,%edx
+  800a5c:	83 c0 01             	add    $0x1,%eax
+  800a5f:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  800a62:	85 d2                	test   %edx,%edx
+  800a64:	74 18                	je     800a7e <strncmp+0x34>
+  800a66:	0f b6 18             	movzbl (%eax),%ebx
+  800a69:	84 db                	test   %bl,%bl
+  800a6b:	74 04                	je     800a71 <strncmp+0x27>
+  800a6d:	3a 19                	cmp    (%ecx),%bl
+  800a6f:	74 e8                	je     800a59 <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800a71:	0f b6 00             	movzbl (%eax),%eax
+  800a74:	0f b6 11             	movzbl (%ecx),%edx
+  800a77:	29 d0                	sub    %edx,%eax
+}
+  800a79:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a7c:	c9                   	leave
+  800a7d:	c3                   	ret
+    return 0;
+  800a7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a83:	eb f4                	jmp    800a79 <strncmp+0x2f>
+
+00800a85 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a85:	55                   	push   %ebp
+  800a86:	89 e5                	mov    %esp,%ebp
+  800a88:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a8b:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800a8f:	eb 03                	jmp    800a94 <strchr+0xf>
+  800a91:	83 c0 01             	add    $0x1,%eax
+  800a94:	0f b6 10             	movzbl (%eax),%edx
+  800a97:	84 d2                	test   %dl,%dl
+  800a99:	74 06                	je     800aa1 <strchr+0x1c>
+    if (*s == c)
+  800a9b:	38 ca                	cmp    %cl,%dl
+  800a9d:	75 f2                	jne    800a91 <strchr+0xc>
+  800a9f:	eb 05                	jmp    800aa6 <strchr+0x21>
+      return (char*)s;
+  return 0;
+  800aa1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800aa6:	5d                   	pop    %ebp
+  800aa7:	c3                   	ret
+
+00800aa8 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800aa8:	55                   	push   %ebp
+  800aa9:	89 e5                	mov    %esp,%ebp
+  800aab:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aae:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800ab2:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  800ab5:	38 ca                	cmp    %cl,%dl
+  800ab7:	74 09                	je     800ac2 <strfind+0x1a>
+  800ab9:	84 d2                	test   %dl,%dl
+  800abb:	74 05                	je     800ac2 <strfind+0x1a>
+  for (; *s; s++)
+  800abd:	83 c0 01             	add    $0x1,%eax
+  800ac0:	eb f0                	jmp    800ab2 <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  800ac2:	5d                   	pop    %ebp
+  800ac3:	c3                   	ret
+
+00800ac4 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800ac4:	55                   	push   %ebp
+  800ac5:	89 e5                	mov    %esp,%ebp
+  800ac7:	57                   	push   %edi
+  800ac8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800acb:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  800ace:	85 c9                	test   %ecx,%ecx
+  800ad0:	74 20                	je     800af2 <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  800ad2:	89 f8                	mov    %edi,%eax
+  800ad4:	09 c8                	or     %ecx,%eax
+  800ad6:	a8 03                	test   $0x3,%al
+  800ad8:	75 12                	jne    800aec <memset+0x28>
+    c &= 0xFF;
+  800ada:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800ade:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  800ae4:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  800ae7:	fc                   	cld
+  800ae8:	f3 ab                	rep stos %eax,%es:(%edi)
+  800aea:	eb 06                	jmp    800af2 <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  800aec:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800aef:	fc                   	cld
+  800af0:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  800af2:	89 f8                	mov    %edi,%eax
+  800af4:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800af7:	c9                   	leave
+  800af8:	c3                   	ret
+
+00800af9 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800af9:	55                   	push   %ebp
+  800afa:	89 e5                	mov    %esp,%ebp
+  800afc:	57                   	push   %edi
+  800afd:	56                   	push   %esi
+  800afe:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b01:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b04:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  800b07:	39 c6                	cmp    %eax,%esi
+  800b09:	73 32                	jae    800b3d <memmove+0x44>
+  800b0b:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800b0e:	39 d0                	cmp    %edx,%eax
+  800b10:	73 2b                	jae    800b3d <memmove+0x44>
+    s += n;
+    d += n;
+  800b12:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b15:	89 d6                	mov    %edx,%esi
+  800b17:	09 fe                	or     %edi,%esi
+  800b19:	09 ce                	or     %ecx,%esi
+  800b1b:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800b21:	75 0e                	jne    800b31 <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800b23:	83 ef 04             	sub    $0x4,%edi
+  800b26:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800b29:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  800b2c:	fd                   	std
+  800b2d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b2f:	eb 09                	jmp    800b3a <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800b31:	83 ef 01             	sub    $0x1,%edi
+  800b34:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  800b37:	fd                   	std
+  800b38:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  800b3a:	fc                   	cld
+  800b3b:	eb 1a                	jmp    800b57 <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b3d:	89 f2                	mov    %esi,%edx
+  800b3f:	09 c2                	or     %eax,%edx
+  800b41:	09 ca                	or     %ecx,%edx
+  800b43:	f6 c2 03             	test   $0x3,%dl
+  800b46:	75 0a                	jne    800b52 <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800b48:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  800b4b:	89 c7                	mov    %eax,%edi
+  800b4d:	fc                   	cld
+  800b4e:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b50:	eb 05                	jmp    800b57 <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  800b52:	89 c7                	mov    %eax,%edi
+  800b54:	fc                   	cld
+  800b55:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  800b57:	5e                   	pop    %esi
+  800b58:	5f                   	pop    %edi
+  800b59:	5d                   	pop    %ebp
+  800b5a:	c3                   	ret
+
+00800b5b <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800b5b:	55                   	push   %ebp
+  800b5c:	89 e5                	mov    %esp,%ebp
+  800b5e:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  800b61:	ff 75 10             	push   0x10(%ebp)
+  800b64:	ff 75 0c             	push   0xc(%ebp)
+  800b67:	ff 75 08             	push   0x8(%ebp)
+  800b6a:	e8 8a ff ff ff       	call   800af9 <memmove>
+}
+  800b6f:	c9                   	leave
+  800b70:	c3                   	ret
+
+00800b71 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800b71:	55                   	push   %ebp
+  800b72:	89 e5                	mov    %esp,%ebp
+  800b74:	56                   	push   %esi
+  800b75:	53                   	push   %ebx
+  800b76:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b79:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  800b7c:	89 c6                	mov    %eax,%esi
+  800b7e:	03 75 10             	add    0x10(%ebp),%esi
+  800b81:	eb 06                	jmp    800b89 <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  800b83:	83 c0 01             	add    $0x1,%eax
+  800b86:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  800b89:	39 f0                	cmp    %esi,%eax
+  800b8b:	74 14                	je     800ba1 <memcmp+0x30>
+    if (*s1 != *s2)
+  800b8d:	0f b6 08             	movzbl (%eax),%ecx
+  800b90:	0f b6 1a             	movzbl (%edx),%ebx
+  800b93:	38 d9                	cmp    %bl,%cl
+  800b95:	74 ec                	je     800b83 <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  800b97:	0f b6 c1             	movzbl %cl,%eax
+  800b9a:	0f b6 db             	movzbl %bl,%ebx
+  800b9d:	29 d8                	sub    %ebx,%eax
+  800b9f:	eb 05                	jmp    800ba6 <memcmp+0x35>
+  }
+
+  return 0;
+  800ba1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ba6:	5b                   	pop    %ebx
+  800ba7:	5e                   	pop    %esi
+  800ba8:	5d                   	pop    %ebp
+  800ba9:	c3                   	ret
+
+00800baa <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800baa:	55                   	push   %ebp
+  800bab:	89 e5                	mov    %esp,%ebp
+  800bad:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bb0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  800bb3:	89 c2                	mov    %eax,%edx
+  800bb5:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  800bb8:	eb 03                	jmp    800bbd <memfind+0x13>
+  800bba:	83 c0 01             	add    $0x1,%eax
+  800bbd:	39 d0                	cmp    %edx,%eax
+  800bbf:	73 04                	jae    800bc5 <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  800bc1:	38 08                	cmp    %cl,(%eax)
+  800bc3:	75 f5                	jne    800bba <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  800bc5:	5d                   	pop    %ebp
+  800bc6:	c3                   	ret
+
+00800bc7 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800bc7:	55                   	push   %ebp
+  800bc8:	89 e5                	mov    %esp,%ebp
+  800bca:	57                   	push   %edi
+  800bcb:	56                   	push   %esi
+  800bcc:	53                   	push   %ebx
+  800bcd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bd0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  800bd3:	eb 03                	jmp    800bd8 <strtol+0x11>
+    s++;
+  800bd5:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  800bd8:	0f b6 02             	movzbl (%edx),%eax
+  800bdb:	3c 20                	cmp    $0x20,%al
+  800bdd:	74 f6                	je     800bd5 <strtol+0xe>
+  800bdf:	3c 09                	cmp    $0x9,%al
+  800be1:	74 f2                	je     800bd5 <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  800be3:	3c 2b                	cmp    $0x2b,%al
+  800be5:	74 2a                	je     800c11 <strtol+0x4a>
+  int neg = 0;
+  800be7:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  800bec:	3c 2d                	cmp    $0x2d,%al
+  800bee:	74 2b                	je     800c1b <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800bf0:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800bf6:	75 0f                	jne    800c07 <strtol+0x40>
+  800bf8:	80 3a 30             	cmpb   $0x30,(%edx)
+  800bfb:	74 28                	je     800c25 <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  800bfd:	85 db                	test   %ebx,%ebx
+  800bff:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c04:	0f 44 d8             	cmove  %eax,%ebx
+  800c07:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c0c:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800c0f:	eb 46                	jmp    800c57 <strtol+0x90>
+    s++;
+  800c11:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  800c14:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c19:	eb d5                	jmp    800bf0 <strtol+0x29>
+    s++, neg = 1;
+  800c1b:	83 c2 01             	add    $0x1,%edx
+  800c1e:	bf 01 00 00 00       	mov    $0x1,%edi
+  800c23:	eb cb                	jmp    800bf0 <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c25:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800c29:	74 0e                	je     800c39 <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  800c2b:	85 db                	test   %ebx,%ebx
+  800c2d:	75 d8                	jne    800c07 <strtol+0x40>
+    s++, base = 8;
+  800c2f:	83 c2 01             	add    $0x1,%edx
+  800c32:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800c37:	eb ce                	jmp    800c07 <strtol+0x40>
+    s += 2, base = 16;
+  800c39:	83 c2 02             	add    $0x2,%edx
+  800c3c:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800c41:	eb c4                	jmp    800c07 <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  800c43:	0f be c0             	movsbl %al,%eax
+  800c46:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  800c49:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800c4c:	7d 3a                	jge    800c88 <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  800c4e:	83 c2 01             	add    $0x1,%edx
+  800c51:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800c55:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  800c57:	0f b6 02             	movzbl (%edx),%eax
+  800c5a:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800c5d:	89 f3                	mov    %esi,%ebx
+  800c5f:	80 fb 09             	cmp    $0x9,%bl
+  800c62:	76 df                	jbe    800c43 <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  800c64:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800c67:	89 f3                	mov    %esi,%ebx
+  800c69:	80 fb 19             	cmp    $0x19,%bl
+  800c6c:	77 08                	ja     800c76 <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  800c6e:	0f be c0             	movsbl %al,%eax
+  800c71:	83 e8 57             	sub    $0x57,%eax
+  800c74:	eb d3                	jmp    800c49 <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  800c76:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800c79:	89 f3                	mov    %esi,%ebx
+  800c7b:	80 fb 19             	cmp    $0x19,%bl
+  800c7e:	77 08                	ja     800c88 <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  800c80:	0f be c0             	movsbl %al,%eax
+  800c83:	83 e8 37             	sub    $0x37,%eax
+  800c86:	eb c1                	jmp    800c49 <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  800c88:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c8c:	74 05                	je     800c93 <strtol+0xcc>
+    *endptr = (char*)s;
+  800c8e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c91:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  800c93:	89 c8                	mov    %ecx,%eax
+  800c95:	f7 d8                	neg    %eax
+  800c97:	85 ff                	test   %edi,%edi
+  800c99:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800c9c:	89 c8                	mov    %ecx,%eax
+  800c9e:	5b                   	pop    %ebx
+  800c9f:	5e                   	pop    %esi
+  800ca0:	5f                   	pop    %edi
+  800ca1:	5d                   	pop    %ebp
+  800ca2:	c3                   	ret
+
+00800ca3 <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800ca3:	55                   	push   %ebp
+  800ca4:	89 e5                	mov    %esp,%ebp
+  800ca6:	57                   	push   %edi
+  800ca7:	56                   	push   %esi
+  800ca8:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800ca9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cae:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cb1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cb4:	89 c3                	mov    %eax,%ebx
+  800cb6:	89 c7                	mov    %eax,%edi
+  800cb8:	89 c6                	mov    %eax,%esi
+  800cba:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800cbc:	5b                   	pop    %ebx
+  800cbd:	5e                   	pop    %esi
+  800cbe:	5f                   	pop    %edi
+  800cbf:	5d                   	pop    %ebp
+  800cc0:	c3                   	ret
+
+00800cc1 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800cc1:	55                   	push   %ebp
+  800cc2:	89 e5                	mov    %esp,%ebp
+  800cc4:	57                   	push   %edi
+  800cc5:	56                   	push   %esi
+  800cc6:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800cc7:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ccc:	b8 01 00 00 00       	mov    $0x1,%eax
+  800cd1:	89 d1                	mov    %edx,%ecx
+  800cd3:	89 d3                	mov    %edx,%ebx
+  800cd5:	89 d7                	mov    %edx,%edi
+  800cd7:	89 d6                	mov    %edx,%esi
+  800cd9:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800cdb:	5b                   	pop    %ebx
+  800cdc:	5e                   	pop    %esi
+  800cdd:	5f                   	pop    %edi
+  800cde:	5d                   	pop    %ebp
+  800cdf:	c3                   	ret
+
+00800ce0 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800ce0:	55                   	push   %ebp
+  800ce1:	89 e5                	mov    %esp,%ebp
+  800ce3:	57                   	push   %edi
+  800ce4:	56                   	push   %esi
+  800ce5:	53                   	push   %ebx
+  800ce6:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800ce9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cee:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cf1:	b8 03 00 00 00       	mov    $0x3,%eax
+  800cf6:	89 cb                	mov    %ecx,%ebx
+  800cf8:	89 cf                	mov    %ecx,%edi
+  800cfa:	89 ce                	mov    %ecx,%esi
+  800cfc:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800cfe:	85 c0                	test   %eax,%eax
+  800d00:	7f 08                	jg     800d0a <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800d02:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d05:	5b                   	pop    %ebx
+  800d06:	5e                   	pop    %esi
+  800d07:	5f                   	pop    %edi
+  800d08:	5d                   	pop    %ebp
+  800d09:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d0a:	83 ec 0c             	sub    $0xc,%esp
+  800d0d:	50                   	push   %eax
+  800d0e:	6a 03                	push   $0x3
+  800d10:	68 63 34 80 00       	push   $0x803463
+  800d15:	6a 23                	push   $0x23
+  800d17:	68 80 34 80 00       	push   $0x803480
+  800d1c:	e8 89 f5 ff ff       	call   8002aa <_panic>
+
+00800d21 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800d21:	55                   	push   %ebp
+  800d22:	89 e5                	mov    %esp,%ebp
+  800d24:	57                   	push   %edi
+  800d25:	56                   	push   %esi
+  800d26:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d27:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d2c:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d31:	89 d1                	mov    %edx,%ecx
+  800d33:	89 d3                	mov    %edx,%ebx
+  800d35:	89 d7                	mov    %edx,%edi
+  800d37:	89 d6                	mov    %edx,%esi
+  800d39:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800d3b:	5b                   	pop    %ebx
+  800d3c:	5e                   	pop    %esi
+  800d3d:	5f                   	pop    %edi
+  800d3e:	5d                   	pop    %ebp
+  800d3f:	c3                   	ret
+
+00800d40 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800d40:	55                   	push   %ebp
+  800d41:	89 e5                	mov    %esp,%ebp
+  800d43:	57                   	push   %edi
+  800d44:	56                   	push   %esi
+  800d45:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d46:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d4b:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d50:	89 d1                	mov    %edx,%ecx
+  800d52:	89 d3                	mov    %edx,%ebx
+  800d54:	89 d7                	mov    %edx,%edi
+  800d56:	89 d6                	mov    %edx,%esi
+  800d58:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800d5a:	5b                   	pop    %ebx
+  800d5b:	5e                   	pop    %esi
+  800d5c:	5f                   	pop    %edi
+  800d5d:	5d                   	pop    %ebp
+  800d5e:	c3                   	ret
+
+00800d5f <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  800d5f:	55                   	push   %ebp
+  800d60:	89 e5                	mov    %esp,%ebp
+  800d62:	57                   	push   %edi
+  800d63:	56                   	push   %esi
+  800d64:	53                   	push   %ebx
+  800d65:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  800d68:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  800d6c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d71:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d74:	b8 14 00 00 00       	mov    $0x14,%eax
+  800d79:	89 df                	mov    %ebx,%edi
+  800d7b:	89 de                	mov    %ebx,%esi
+  800d7d:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d7f:	85 c0                	test   %eax,%eax
+  800d81:	7f 08                	jg     800d8b <sys_env_set_cow+0x2c>
+}
+  800d83:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d86:	5b                   	pop    %ebx
+  800d87:	5e                   	pop    %esi
+  800d88:	5f                   	pop    %edi
+  800d89:	5d                   	pop    %ebp
+  800d8a:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d8b:	83 ec 0c             	sub    $0xc,%esp
+  800d8e:	50                   	push   %eax
+  800d8f:	6a 14                	push   $0x14
+  800d91:	68 63 34 80 00       	push   $0x803463
+  800d96:	6a 23                	push   $0x23
+  800d98:	68 80 34 80 00       	push   $0x803480
+  800d9d:	e8 08 f5 ff ff       	call   8002aa <_panic>
+
+00800da2 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800da2:	55                   	push   %ebp
+  800da3:	89 e5                	mov    %esp,%ebp
+  800da5:	57                   	push   %edi
+  800da6:	56                   	push   %esi
+  800da7:	53                   	push   %ebx
+  800da8:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800dab:	be 00 00 00 00       	mov    $0x0,%esi
+  800db0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800db3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800db6:	b8 04 00 00 00       	mov    $0x4,%eax
+  800dbb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dbe:	89 f7                	mov    %esi,%edi
+  800dc0:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800dc2:	85 c0                	test   %eax,%eax
+  800dc4:	7f 08                	jg     800dce <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  800dc6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dc9:	5b                   	pop    %ebx
+  800dca:	5e                   	pop    %esi
+  800dcb:	5f                   	pop    %edi
+  800dcc:	5d                   	pop    %ebp
+  800dcd:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800dce:	83 ec 0c             	sub    $0xc,%esp
+  800dd1:	50                   	push   %eax
+  800dd2:	6a 04                	push   $0x4
+  800dd4:	68 63 34 80 00       	push   $0x803463
+  800dd9:	6a 23                	push   $0x23
+  800ddb:	68 80 34 80 00       	push   $0x803480
+  800de0:	e8 c5 f4 ff ff       	call   8002aa <_panic>
+
+00800de5 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800de5:	55                   	push   %ebp
+  800de6:	89 e5                	mov    %esp,%ebp
+  800de8:	57                   	push   %edi
+  800de9:	56                   	push   %esi
+  800dea:	53                   	push   %ebx
+  800deb:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800dee:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800df4:	b8 05 00 00 00       	mov    $0x5,%eax
+  800df9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dfc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dff:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e02:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e04:	85 c0                	test   %eax,%eax
+  800e06:	7f 08                	jg     800e10 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  800e08:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e0b:	5b                   	pop    %ebx
+  800e0c:	5e                   	pop    %esi
+  800e0d:	5f                   	pop    %edi
+  800e0e:	5d                   	pop    %ebp
+  800e0f:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e10:	83 ec 0c             	sub    $0xc,%esp
+  800e13:	50                   	push   %eax
+  800e14:	6a 05                	push   $0x5
+  800e16:	68 63 34 80 00       	push   $0x803463
+  800e1b:	6a 23                	push   $0x23
+  800e1d:	68 80 34 80 00       	push   $0x803480
+  800e22:	e8 83 f4 ff ff       	call   8002aa <_panic>
+
+00800e27 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800e27:	55                   	push   %ebp
+  800e28:	89 e5                	mov    %esp,%ebp
+  800e2a:	57                   	push   %edi
+  800e2b:	56                   	push   %esi
+  800e2c:	53                   	push   %ebx
+  800e2d:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e30:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e35:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e38:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e3b:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e40:	89 df                	mov    %ebx,%edi
+  800e42:	89 de                	mov    %ebx,%esi
+  800e44:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e46:	85 c0                	test   %eax,%eax
+  800e48:	7f 08                	jg     800e52 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  800e4a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e4d:	5b                   	pop    %ebx
+  800e4e:	5e                   	pop    %esi
+  800e4f:	5f                   	pop    %edi
+  800e50:	5d                   	pop    %ebp
+  800e51:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e52:	83 ec 0c             	sub    $0xc,%esp
+  800e55:	50                   	push   %eax
+  800e56:	6a 06                	push   $0x6
+  800e58:	68 63 34 80 00       	push   $0x803463
+  800e5d:	6a 23                	push   $0x23
+  800e5f:	68 80 34 80 00       	push   $0x803480
+  800e64:	e8 41 f4 ff ff       	call   8002aa <_panic>
+
+00800e69 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  800e69:	55                   	push   %ebp
+  800e6a:	89 e5                	mov    %esp,%ebp
+  800e6c:	57                   	push   %edi
+  800e6d:	56                   	push   %esi
+  800e6e:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e6f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e72:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e75:	b8 11 00 00 00       	mov    $0x11,%eax
+  800e7a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e7d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e80:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e83:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  800e85:	5b                   	pop    %ebx
+  800e86:	5e                   	pop    %esi
+  800e87:	5f                   	pop    %edi
+  800e88:	5d                   	pop    %ebp
+  800e89:	c3                   	ret
+
+00800e8a <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  800e8a:	55                   	push   %ebp
+  800e8b:	89 e5                	mov    %esp,%ebp
+  800e8d:	57                   	push   %edi
+  800e8e:	56                   	push   %esi
+  800e8f:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e90:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e93:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e96:	b8 12 00 00 00       	mov    $0x12,%eax
+  800e9b:	be 00 00 00 00       	mov    $0x0,%esi
+  800ea0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ea3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ea6:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  800ea8:	5b                   	pop    %ebx
+  800ea9:	5e                   	pop    %esi
+  800eaa:	5f                   	pop    %edi
+  800eab:	5d                   	pop    %ebp
+  800eac:	c3                   	ret
+
+00800ead <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  800ead:	55                   	push   %ebp
+  800eae:	89 e5                	mov    %esp,%ebp
+  800eb0:	57                   	push   %edi
+  800eb1:	56                   	push   %esi
+  800eb2:	53                   	push   %ebx
+  800eb3:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800eb6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ebb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ebe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ec1:	b8 16 00 00 00       	mov    $0x16,%eax
+  800ec6:	89 df                	mov    %ebx,%edi
+  800ec8:	89 de                	mov    %ebx,%esi
+  800eca:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ecc:	85 c0                	test   %eax,%eax
+  800ece:	7f 08                	jg     800ed8 <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  800ed0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ed3:	5b                   	pop    %ebx
+  800ed4:	5e                   	pop    %esi
+  800ed5:	5f                   	pop    %edi
+  800ed6:	5d                   	pop    %ebp
+  800ed7:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ed8:	83 ec 0c             	sub    $0xc,%esp
+  800edb:	50                   	push   %eax
+  800edc:	6a 16                	push   $0x16
+  800ede:	68 63 34 80 00       	push   $0x803463
+  800ee3:	6a 23                	push   $0x23
+  800ee5:	68 80 34 80 00       	push   $0x803480
+  800eea:	e8 bb f3 ff ff       	call   8002aa <_panic>
+
+00800eef <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  800eef:	55                   	push   %ebp
+  800ef0:	89 e5                	mov    %esp,%ebp
+  800ef2:	57                   	push   %edi
+  800ef3:	56                   	push   %esi
+  800ef4:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800ef5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800efa:	8b 55 08             	mov    0x8(%ebp),%edx
+  800efd:	b8 17 00 00 00       	mov    $0x17,%eax
+  800f02:	89 cb                	mov    %ecx,%ebx
+  800f04:	89 cf                	mov    %ecx,%edi
+  800f06:	89 ce                	mov    %ecx,%esi
+  800f08:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  800f0a:	5b                   	pop    %ebx
+  800f0b:	5e                   	pop    %esi
+  800f0c:	5f                   	pop    %edi
+  800f0d:	5d                   	pop    %ebp
+  800f0e:	c3                   	ret
+
+00800f0f <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  800f0f:	55                   	push   %ebp
+  800f10:	89 e5                	mov    %esp,%ebp
+  800f12:	57                   	push   %edi
+  800f13:	56                   	push   %esi
+  800f14:	53                   	push   %ebx
+  800f15:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f18:	be 00 00 00 00       	mov    $0x0,%esi
+  800f1d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f20:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f23:	b8 18 00 00 00       	mov    $0x18,%eax
+  800f28:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f2b:	89 f7                	mov    %esi,%edi
+  800f2d:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f2f:	85 c0                	test   %eax,%eax
+  800f31:	7f 08                	jg     800f3b <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  800f33:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f36:	5b                   	pop    %ebx
+  800f37:	5e                   	pop    %esi
+  800f38:	5f                   	pop    %edi
+  800f39:	5d                   	pop    %ebp
+  800f3a:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f3b:	83 ec 0c             	sub    $0xc,%esp
+  800f3e:	50                   	push   %eax
+  800f3f:	6a 18                	push   $0x18
+  800f41:	68 63 34 80 00       	push   $0x803463
+  800f46:	6a 23                	push   $0x23
+  800f48:	68 80 34 80 00       	push   $0x803480
+  800f4d:	e8 58 f3 ff ff       	call   8002aa <_panic>
+
+00800f52 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  800f52:	55                   	push   %ebp
+  800f53:	89 e5                	mov    %esp,%ebp
+  800f55:	57                   	push   %edi
+  800f56:	56                   	push   %esi
+  800f57:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f58:	be 00 00 00 00       	mov    $0x0,%esi
+  800f5d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f60:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f63:	b8 19 00 00 00       	mov    $0x19,%eax
+  800f68:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f6b:	89 f7                	mov    %esi,%edi
+  800f6d:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  800f6f:	5b                   	pop    %ebx
+  800f70:	5e                   	pop    %esi
+  800f71:	5f                   	pop    %edi
+  800f72:	5d                   	pop    %ebp
+  800f73:	c3                   	ret
+
+00800f74 <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  800f74:	55                   	push   %ebp
+  800f75:	89 e5                	mov    %esp,%ebp
+  800f77:	57                   	push   %edi
+  800f78:	56                   	push   %esi
+  800f79:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f7a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f7f:	b8 15 00 00 00       	mov    $0x15,%eax
+  800f84:	89 d1                	mov    %edx,%ecx
+  800f86:	89 d3                	mov    %edx,%ebx
+  800f88:	89 d7                	mov    %edx,%edi
+  800f8a:	89 d6                	mov    %edx,%esi
+  800f8c:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800f8e:	5b                   	pop    %ebx
+  800f8f:	5e                   	pop    %esi
+  800f90:	5f                   	pop    %edi
+  800f91:	5d                   	pop    %ebp
+  800f92:	c3                   	ret
+
+00800f93 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800f93:	55                   	push   %ebp
+  800f94:	89 e5                	mov    %esp,%ebp
+  800f96:	57                   	push   %edi
+  800f97:	56                   	push   %esi
+  800f98:	53                   	push   %ebx
+  800f99:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f9c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fa1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fa7:	b8 08 00 00 00       	mov    $0x8,%eax
+  800fac:	89 df                	mov    %ebx,%edi
+  800fae:	89 de                	mov    %ebx,%esi
+  800fb0:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800fb2:	85 c0                	test   %eax,%eax
+  800fb4:	7f 08                	jg     800fbe <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800fb6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fb9:	5b                   	pop    %ebx
+  800fba:	5e                   	pop    %esi
+  800fbb:	5f                   	pop    %edi
+  800fbc:	5d                   	pop    %ebp
+  800fbd:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800fbe:	83 ec 0c             	sub    $0xc,%esp
+  800fc1:	50                   	push   %eax
+  800fc2:	6a 08                	push   $0x8
+  800fc4:	68 63 34 80 00       	push   $0x803463
+  800fc9:	6a 23                	push   $0x23
+  800fcb:	68 80 34 80 00       	push   $0x803480
+  800fd0:	e8 d5 f2 ff ff       	call   8002aa <_panic>
+
+00800fd5 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800fd5:	55                   	push   %ebp
+  800fd6:	89 e5                	mov    %esp,%ebp
+  800fd8:	57                   	push   %edi
+  800fd9:	56                   	push   %esi
+  800fda:	53                   	push   %ebx
+  800fdb:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800fde:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fe3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fe9:	b8 09 00 00 00       	mov    $0x9,%eax
+  800fee:	89 df                	mov    %ebx,%edi
+  800ff0:	89 de                	mov    %ebx,%esi
+  800ff2:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ff4:	85 c0                	test   %eax,%eax
+  800ff6:	7f 08                	jg     801000 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  800ff8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ffb:	5b                   	pop    %ebx
+  800ffc:	5e                   	pop    %esi
+  800ffd:	5f                   	pop    %edi
+  800ffe:	5d                   	pop    %ebp
+  800fff:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801000:	83 ec 0c             	sub    $0xc,%esp
+  801003:	50                   	push   %eax
+  801004:	6a 09                	push   $0x9
+  801006:	68 63 34 80 00       	push   $0x803463
+  80100b:	6a 23                	push   $0x23
+  80100d:	68 80 34 80 00       	push   $0x803480
+  801012:	e8 93 f2 ff ff       	call   8002aa <_panic>
+
+00801017 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801017:	55                   	push   %ebp
+  801018:	89 e5                	mov    %esp,%ebp
+  80101a:	57                   	push   %edi
+  80101b:	56                   	push   %esi
+  80101c:	53                   	push   %ebx
+  80101d:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801020:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801025:	8b 55 08             	mov    0x8(%ebp),%edx
+  801028:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80102b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801030:	89 df                	mov    %ebx,%edi
+  801032:	89 de                	mov    %ebx,%esi
+  801034:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801036:	85 c0                	test   %eax,%eax
+  801038:	7f 08                	jg     801042 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  80103a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80103d:	5b                   	pop    %ebx
+  80103e:	5e                   	pop    %esi
+  80103f:	5f                   	pop    %edi
+  801040:	5d                   	pop    %ebp
+  801041:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801042:	83 ec 0c             	sub    $0xc,%esp
+  801045:	50                   	push   %eax
+  801046:	6a 0a                	push   $0xa
+  801048:	68 63 34 80 00       	push   $0x803463
+  80104d:	6a 23                	push   $0x23
+  80104f:	68 80 34 80 00       	push   $0x803480
+  801054:	e8 51 f2 ff ff       	call   8002aa <_panic>
+
+00801059 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  801059:	55                   	push   %ebp
+  80105a:	89 e5                	mov    %esp,%ebp
+  80105c:	57                   	push   %edi
+  80105d:	56                   	push   %esi
+  80105e:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80105f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801062:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801065:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80106a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80106d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801070:	8b 75 18             	mov    0x18(%ebp),%esi
+  801073:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  801075:	5b                   	pop    %ebx
+  801076:	5e                   	pop    %esi
+  801077:	5f                   	pop    %edi
+  801078:	5d                   	pop    %ebp
+  801079:	c3                   	ret
+
+0080107a <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  80107a:	55                   	push   %ebp
+  80107b:	89 e5                	mov    %esp,%ebp
+  80107d:	57                   	push   %edi
+  80107e:	56                   	push   %esi
+  80107f:	53                   	push   %ebx
+  801080:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801083:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801088:	8b 55 08             	mov    0x8(%ebp),%edx
+  80108b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80108e:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801093:	89 df                	mov    %ebx,%edi
+  801095:	89 de                	mov    %ebx,%esi
+  801097:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801099:	85 c0                	test   %eax,%eax
+  80109b:	7f 08                	jg     8010a5 <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  80109d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010a0:	5b                   	pop    %ebx
+  8010a1:	5e                   	pop    %esi
+  8010a2:	5f                   	pop    %edi
+  8010a3:	5d                   	pop    %ebp
+  8010a4:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8010a5:	83 ec 0c             	sub    $0xc,%esp
+  8010a8:	50                   	push   %eax
+  8010a9:	6a 0d                	push   $0xd
+  8010ab:	68 63 34 80 00       	push   $0x803463
+  8010b0:	6a 23                	push   $0x23
+  8010b2:	68 80 34 80 00       	push   $0x803480
+  8010b7:	e8 ee f1 ff ff       	call   8002aa <_panic>
+
+008010bc <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  8010bc:	55                   	push   %ebp
+  8010bd:	89 e5                	mov    %esp,%ebp
+  8010bf:	57                   	push   %edi
+  8010c0:	56                   	push   %esi
+  8010c1:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8010c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010c7:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8010cc:	89 d1                	mov    %edx,%ecx
+  8010ce:	89 d3                	mov    %edx,%ebx
+  8010d0:	89 d7                	mov    %edx,%edi
+  8010d2:	89 d6                	mov    %edx,%esi
+  8010d4:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8010d6:	5b                   	pop    %ebx
+  8010d7:	5e                   	pop    %esi
+  8010d8:	5f                   	pop    %edi
+  8010d9:	5d                   	pop    %ebp
+  8010da:	c3                   	ret
+
+008010db <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  8010db:	55                   	push   %ebp
+  8010dc:	89 e5                	mov    %esp,%ebp
+  8010de:	57                   	push   %edi
+  8010df:	56                   	push   %esi
+  8010e0:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8010e1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010e7:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8010ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8010f1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010f4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010f7:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  8010f9:	5b                   	pop    %ebx
+  8010fa:	5e                   	pop    %esi
+  8010fb:	5f                   	pop    %edi
+  8010fc:	5d                   	pop    %ebp
+  8010fd:	c3                   	ret
+
+008010fe <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  8010fe:	55                   	push   %ebp
+  8010ff:	89 e5                	mov    %esp,%ebp
+  801101:	57                   	push   %edi
+  801102:	56                   	push   %esi
+  801103:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801104:	be 00 00 00 00       	mov    $0x0,%esi
+  801109:	8b 55 08             	mov    0x8(%ebp),%edx
+  80110c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80110f:	b8 10 00 00 00       	mov    $0x10,%eax
+  801114:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801117:	89 f7                	mov    %esi,%edi
+  801119:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  80111b:	5b                   	pop    %ebx
+  80111c:	5e                   	pop    %esi
+  80111d:	5f                   	pop    %edi
+  80111e:	5d                   	pop    %ebp
+  80111f:	c3                   	ret
+
+00801120 <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  801120:	55                   	push   %ebp
+  801121:	89 e5                	mov    %esp,%ebp
+  801123:	57                   	push   %edi
+  801124:	56                   	push   %esi
+  801125:	53                   	push   %ebx
+  801126:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  801129:	80 3d 48 67 80 00 00 	cmpb   $0x0,0x806748
+  801130:	74 41                	je     801173 <sys_batch+0x53>
+  801132:	8b 45 08             	mov    0x8(%ebp),%eax
+  801135:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  801138:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  80113f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801142:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  801145:	7d 45                	jge    80118c <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  801147:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80114a:	8b 06                	mov    (%esi),%eax
+  80114c:	8b 56 04             	mov    0x4(%esi),%edx
+  80114f:	8b 4e 08             	mov    0x8(%esi),%ecx
+  801152:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  801155:	8b 7e 10             	mov    0x10(%esi),%edi
+  801158:	8b 76 14             	mov    0x14(%esi),%esi
+  80115b:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  80115d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801160:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  801163:	83 c6 1c             	add    $0x1c,%esi
+  801166:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  801169:	85 c0                	test   %eax,%eax
+  80116b:	78 1f                	js     80118c <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  80116d:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  801171:	eb cc                	jmp    80113f <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  801173:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801178:	b8 13 00 00 00       	mov    $0x13,%eax
+  80117d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801180:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801183:	89 df                	mov    %ebx,%edi
+  801185:	89 de                	mov    %ebx,%esi
+  801187:	cd 30                	int    $0x30
+  801189:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  80118c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80118f:	83 c4 08             	add    $0x8,%esp
+  801192:	5b                   	pop    %ebx
+  801193:	5e                   	pop    %esi
+  801194:	5f                   	pop    %edi
+  801195:	5d                   	pop    %ebp
+  801196:	c3                   	ret
+
+00801197 <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  801197:	55                   	push   %ebp
+  801198:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  80119a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80119d:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8011a3:	5d                   	pop    %ebp
+  8011a4:	c3                   	ret
+
+008011a5 <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  8011a5:	55                   	push   %ebp
+  8011a6:	89 e5                	mov    %esp,%ebp
+  8011a8:	56                   	push   %esi
+  8011a9:	53                   	push   %ebx
+  8011aa:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  8011ad:	8b 1e                	mov    (%esi),%ebx
+  8011af:	85 db                	test   %ebx,%ebx
+  8011b1:	75 09                	jne    8011bc <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  8011b3:	89 d8                	mov    %ebx,%eax
+  8011b5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8011b8:	5b                   	pop    %ebx
+  8011b9:	5e                   	pop    %esi
+  8011ba:	5d                   	pop    %ebp
+  8011bb:	c3                   	ret
+  b->sb_n = 0;
+  8011bc:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  8011c2:	53                   	push   %ebx
+  8011c3:	8d 46 04             	lea    0x4(%esi),%eax
+  8011c6:	50                   	push   %eax
+  8011c7:	e8 54 ff ff ff       	call   801120 <sys_batch>
+  8011cc:	83 c4 08             	add    $0x8,%esp
+  8011cf:	85 c0                	test   %eax,%eax
+  8011d1:	78 1e                	js     8011f1 <sysbatch_flush+0x4c>
+  if (r < n)
+  8011d3:	39 c3                	cmp    %eax,%ebx
+  8011d5:	7f 07                	jg     8011de <sysbatch_flush+0x39>
+  return 0;
+  8011d7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011dc:	eb d5                	jmp    8011b3 <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  8011de:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8011e1:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  8011e5:	85 db                	test   %ebx,%ebx
+  8011e7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011ec:	0f 49 d8             	cmovns %eax,%ebx
+  8011ef:	eb c2                	jmp    8011b3 <sysbatch_flush+0xe>
+    return r;
+  8011f1:	89 c3                	mov    %eax,%ebx
+  8011f3:	eb be                	jmp    8011b3 <sysbatch_flush+0xe>
+
+008011f5 <sysbatch_add>:
+{
+  8011f5:	55                   	push   %ebp
+  8011f6:	89 e5                	mov    %esp,%ebp
+  8011f8:	53                   	push   %ebx
+  8011f9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  8011fc:	83 3b 40             	cmpl   $0x40,(%ebx)
+  8011ff:	74 41                	je     801242 <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  801201:	8b 03                	mov    (%ebx),%eax
+  801203:	8d 50 01             	lea    0x1(%eax),%edx
+  801206:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  801208:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80120b:	01 d8                	add    %ebx,%eax
+  80120d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801210:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  801213:	8b 55 10             	mov    0x10(%ebp),%edx
+  801216:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  801219:	8b 55 14             	mov    0x14(%ebp),%edx
+  80121c:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  80121f:	8b 55 18             	mov    0x18(%ebp),%edx
+  801222:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  801225:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  801228:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  80122b:	8b 55 20             	mov    0x20(%ebp),%edx
+  80122e:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  801231:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  801238:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80123d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801240:	c9                   	leave
+  801241:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  801242:	53                   	push   %ebx
+  801243:	e8 5d ff ff ff       	call   8011a5 <sysbatch_flush>
+  801248:	83 c4 04             	add    $0x4,%esp
+  80124b:	85 c0                	test   %eax,%eax
+  80124d:	79 b2                	jns    801201 <sysbatch_add+0xc>
+  80124f:	eb ec                	jmp    80123d <sysbatch_add+0x48>
+
+00801251 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801251:	55                   	push   %ebp
+  801252:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801254:	8b 45 08             	mov    0x8(%ebp),%eax
+  801257:	05 00 00 00 30       	add    $0x30000000,%eax
+  80125c:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80125f:	5d                   	pop    %ebp
+  801260:	c3                   	ret
+
+00801261 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801261:	55                   	push   %ebp
+  801262:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801264:	8b 45 08             	mov    0x8(%ebp),%eax
+  801267:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  80126a:	66 b8 00 00          	mov    $0x0,%ax
+  80126e:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801273:	5d                   	pop    %ebp
+  801274:	c3                   	ret
+
+00801275 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801275:	55                   	push   %ebp
+  801276:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  801278:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80127d:	eb 02                	jmp    801281 <fd_alloc+0xc>
+  80127f:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801281:	89 c2                	mov    %eax,%edx
+  801283:	c1 ea 16             	shr    $0x16,%edx
+  801286:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80128d:	f6 c2 01             	test   $0x1,%dl
+  801290:	74 2b                	je     8012bd <fd_alloc+0x48>
+  801292:	89 c2                	mov    %eax,%edx
+  801294:	c1 ea 0c             	shr    $0xc,%edx
+  801297:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80129e:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8012a4:	f6 c1 01             	test   $0x1,%cl
+  8012a7:	74 14                	je     8012bd <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  8012a9:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8012af:	75 ce                	jne    80127f <fd_alloc+0xa>
+  8012b1:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  8012b6:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8012bb:	eb 05                	jmp    8012c2 <fd_alloc+0x4d>
+      return 0;
+  8012bd:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  8012c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012c5:	89 02                	mov    %eax,(%edx)
+}
+  8012c7:	89 c8                	mov    %ecx,%eax
+  8012c9:	5d                   	pop    %ebp
+  8012ca:	c3                   	ret
+
+008012cb <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8012cb:	55                   	push   %ebp
+  8012cc:	89 e5                	mov    %esp,%ebp
+  8012ce:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  8012d1:	83 f8 1f             	cmp    $0x1f,%eax
+  8012d4:	77 30                	ja     801306 <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  8012d6:	c1 e0 0c             	shl    $0xc,%eax
+  8012d9:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8012de:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8012e4:	f6 c2 01             	test   $0x1,%dl
+  8012e7:	74 24                	je     80130d <fd_lookup+0x42>
+  8012e9:	89 c2                	mov    %eax,%edx
+  8012eb:	c1 ea 0c             	shr    $0xc,%edx
+  8012ee:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8012f5:	f6 c2 01             	test   $0x1,%dl
+  8012f8:	74 1a                	je     801314 <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  8012fa:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8012fd:	89 02                	mov    %eax,(%edx)
+  return 0;
+  8012ff:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801304:	5d                   	pop    %ebp
+  801305:	c3                   	ret
+    return -E_INVAL;
+  801306:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80130b:	eb f7                	jmp    801304 <fd_lookup+0x39>
+    return -E_INVAL;
+  80130d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801312:	eb f0                	jmp    801304 <fd_lookup+0x39>
+  801314:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801319:	eb e9                	jmp    801304 <fd_lookup+0x39>
+
+0080131b <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80131b:	55                   	push   %ebp
+  80131c:	89 e5                	mov    %esp,%ebp
+  80131e:	53                   	push   %ebx
+  80131f:	83 ec 04             	sub    $0x4,%esp
+  801322:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  801325:	b8 0c 35 80 00       	mov    $0x80350c,%eax
+  80132a:	8b 18                	mov    (%eax),%ebx
+  80132c:	85 db                	test   %ebx,%ebx
+  80132e:	74 0e                	je     80133e <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  801330:	83 c0 04             	add    $0x4,%eax
+  801333:	39 13                	cmp    %edx,(%ebx)
+  801335:	75 f3                	jne    80132a <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  801337:	b8 00 00 00 00       	mov    $0x0,%eax
+  80133c:	eb 1f                	jmp    80135d <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80133e:	a1 44 67 80 00       	mov    0x806744,%eax
+  801343:	8b 40 48             	mov    0x48(%eax),%eax
+  801346:	83 ec 04             	sub    $0x4,%esp
+  801349:	52                   	push   %edx
+  80134a:	50                   	push   %eax
+  80134b:	68 90 34 80 00       	push   $0x803490
+  801350:	e8 30 f0 ff ff       	call   800385 <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  801355:	83 c4 10             	add    $0x10,%esp
+  801358:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  80135d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801360:	89 1a                	mov    %ebx,(%edx)
+}
+  801362:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801365:	c9                   	leave
+  801366:	c3                   	ret
+
+00801367 <fd_close>:
+{
+  801367:	55                   	push   %ebp
+  801368:	89 e5                	mov    %esp,%ebp
+  80136a:	57                   	push   %edi
+  80136b:	56                   	push   %esi
+  80136c:	53                   	push   %ebx
+  80136d:	83 ec 24             	sub    $0x24,%esp
+  801370:	8b 75 08             	mov    0x8(%ebp),%esi
+  801373:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801376:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801379:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80137a:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801380:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801383:	50                   	push   %eax
+  801384:	e8 42 ff ff ff       	call   8012cb <fd_lookup>
+  801389:	89 c3                	mov    %eax,%ebx
+  80138b:	83 c4 10             	add    $0x10,%esp
+  80138e:	85 c0                	test   %eax,%eax
+  801390:	78 05                	js     801397 <fd_close+0x30>
+      || fd != fd2)
+  801392:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801395:	74 16                	je     8013ad <fd_close+0x46>
+    return must_exist ? r : 0;
+  801397:	89 f8                	mov    %edi,%eax
+  801399:	84 c0                	test   %al,%al
+  80139b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013a0:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8013a3:	89 d8                	mov    %ebx,%eax
+  8013a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013a8:	5b                   	pop    %ebx
+  8013a9:	5e                   	pop    %esi
+  8013aa:	5f                   	pop    %edi
+  8013ab:	5d                   	pop    %ebp
+  8013ac:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8013ad:	83 ec 08             	sub    $0x8,%esp
+  8013b0:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8013b3:	50                   	push   %eax
+  8013b4:	ff 36                	push   (%esi)
+  8013b6:	e8 60 ff ff ff       	call   80131b <dev_lookup>
+  8013bb:	89 c3                	mov    %eax,%ebx
+  8013bd:	83 c4 10             	add    $0x10,%esp
+  8013c0:	85 c0                	test   %eax,%eax
+  8013c2:	78 1a                	js     8013de <fd_close+0x77>
+    if (dev->dev_close)
+  8013c4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8013c7:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  8013ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  8013cf:	85 c0                	test   %eax,%eax
+  8013d1:	74 0b                	je     8013de <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  8013d3:	83 ec 0c             	sub    $0xc,%esp
+  8013d6:	56                   	push   %esi
+  8013d7:	ff d0                	call   *%eax
+  8013d9:	89 c3                	mov    %eax,%ebx
+  8013db:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  8013de:	83 ec 08             	sub    $0x8,%esp
+  8013e1:	56                   	push   %esi
+  8013e2:	6a 00                	push   $0x0
+  8013e4:	e8 3e fa ff ff       	call   800e27 <sys_page_unmap>
+  return r;
+  8013e9:	83 c4 10             	add    $0x10,%esp
+  8013ec:	eb b5                	jmp    8013a3 <fd_close+0x3c>
+
+008013ee <close>:
+
+int
+close(int fdnum)
+{
+  8013ee:	55                   	push   %ebp
+  8013ef:	89 e5                	mov    %esp,%ebp
+  8013f1:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8013f4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013f7:	50                   	push   %eax
+  8013f8:	ff 75 08             	push   0x8(%ebp)
+  8013fb:	e8 cb fe ff ff       	call   8012cb <fd_lookup>
+  801400:	83 c4 10             	add    $0x10,%esp
+  801403:	85 c0                	test   %eax,%eax
+  801405:	79 02                	jns    801409 <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  801407:	c9                   	leave
+  801408:	c3                   	ret
+    return fd_close(fd, 1);
+  801409:	83 ec 08             	sub    $0x8,%esp
+  80140c:	6a 01                	push   $0x1
+  80140e:	ff 75 f4             	push   -0xc(%ebp)
+  801411:	e8 51 ff ff ff       	call   801367 <fd_close>
+  801416:	83 c4 10             	add    $0x10,%esp
+  801419:	eb ec                	jmp    801407 <close+0x19>
+
+0080141b <close_all>:
+
+void
+close_all(void)
+{
+  80141b:	55                   	push   %ebp
+  80141c:	89 e5                	mov    %esp,%ebp
+  80141e:	53                   	push   %ebx
+  80141f:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  801422:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  801427:	83 ec 0c             	sub    $0xc,%esp
+  80142a:	53                   	push   %ebx
+  80142b:	e8 be ff ff ff       	call   8013ee <close>
+  for (i = 0; i < MAXFD; i++)
+  801430:	83 c3 01             	add    $0x1,%ebx
+  801433:	83 c4 10             	add    $0x10,%esp
+  801436:	83 fb 20             	cmp    $0x20,%ebx
+  801439:	75 ec                	jne    801427 <close_all+0xc>
+}
+  80143b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80143e:	c9                   	leave
+  80143f:	c3                   	ret
+
+00801440 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801440:	55                   	push   %ebp
+  801441:	89 e5                	mov    %esp,%ebp
+  801443:	57                   	push   %edi
+  801444:	56                   	push   %esi
+  801445:	53                   	push   %ebx
+  801446:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801449:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80144c:	50                   	push   %eax
+  80144d:	ff 75 08             	push   0x8(%ebp)
+  801450:	e8 76 fe ff ff       	call   8012cb <fd_lookup>
+  801455:	89 c6                	mov    %eax,%esi
+  801457:	83 c4 10             	add    $0x10,%esp
+  80145a:	85 c0                	test   %eax,%eax
+  80145c:	0f 88 0a 01 00 00    	js     80156c <dup+0x12c>
+    return r;
+  close(newfdnum);
+  801462:	83 ec 0c             	sub    $0xc,%esp
+  801465:	ff 75 0c             	push   0xc(%ebp)
+  801468:	e8 81 ff ff ff       	call   8013ee <close>
+
+  newfd = INDEX2FD(newfdnum);
+  80146d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801470:	c1 e0 0c             	shl    $0xc,%eax
+  801473:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  801479:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  80147c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80147f:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  801482:	89 04 24             	mov    %eax,(%esp)
+  801485:	e8 d7 fd ff ff       	call   801261 <fd2data>
+  80148a:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  80148c:	89 3c 24             	mov    %edi,(%esp)
+  80148f:	e8 cd fd ff ff       	call   801261 <fd2data>
+  801494:	83 c4 10             	add    $0x10,%esp
+  801497:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80149a:	89 f3                	mov    %esi,%ebx
+  80149c:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  8014a2:	89 c6                	mov    %eax,%esi
+  8014a4:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8014a7:	89 cf                	mov    %ecx,%edi
+  8014a9:	eb 0c                	jmp    8014b7 <dup+0x77>
+  8014ab:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8014b1:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8014b7:	39 fb                	cmp    %edi,%ebx
+  8014b9:	74 7b                	je     801536 <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  8014bb:	89 d8                	mov    %ebx,%eax
+  8014bd:	c1 e8 16             	shr    $0x16,%eax
+  8014c0:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8014c7:	a8 01                	test   $0x1,%al
+  8014c9:	74 e0                	je     8014ab <dup+0x6b>
+  8014cb:	89 d8                	mov    %ebx,%eax
+  8014cd:	c1 e8 0c             	shr    $0xc,%eax
+  8014d0:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8014d7:	f6 c2 01             	test   $0x1,%dl
+  8014da:	74 cf                	je     8014ab <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  8014dc:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  8014e3:	83 ec 0c             	sub    $0xc,%esp
+  8014e6:	25 07 0e 00 00       	and    $0xe07,%eax
+  8014eb:	50                   	push   %eax
+  8014ec:	56                   	push   %esi
+  8014ed:	6a 00                	push   $0x0
+  8014ef:	53                   	push   %ebx
+  8014f0:	6a 00                	push   $0x0
+  8014f2:	e8 ee f8 ff ff       	call   800de5 <sys_page_map>
+  8014f7:	83 c4 20             	add    $0x20,%esp
+  8014fa:	85 c0                	test   %eax,%eax
+  8014fc:	79 ad                	jns    8014ab <dup+0x6b>
+  8014fe:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801501:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  801503:	83 ec 08             	sub    $0x8,%esp
+  801506:	ff 75 d4             	push   -0x2c(%ebp)
+  801509:	6a 00                	push   $0x0
+  80150b:	e8 17 f9 ff ff       	call   800e27 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801510:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  801513:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  801519:	83 c4 10             	add    $0x10,%esp
+  80151c:	39 df                	cmp    %ebx,%edi
+  80151e:	74 4c                	je     80156c <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  801520:	83 ec 08             	sub    $0x8,%esp
+  801523:	57                   	push   %edi
+  801524:	6a 00                	push   $0x0
+  801526:	e8 fc f8 ff ff       	call   800e27 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80152b:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  801531:	83 c4 10             	add    $0x10,%esp
+  801534:	eb e6                	jmp    80151c <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801536:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801539:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80153c:	89 c8                	mov    %ecx,%eax
+  80153e:	c1 e8 0c             	shr    $0xc,%eax
+  801541:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801548:	83 ec 0c             	sub    $0xc,%esp
+  80154b:	25 07 0e 00 00       	and    $0xe07,%eax
+  801550:	50                   	push   %eax
+  801551:	ff 75 d4             	push   -0x2c(%ebp)
+  801554:	6a 00                	push   $0x0
+  801556:	51                   	push   %ecx
+  801557:	6a 00                	push   $0x0
+  801559:	e8 87 f8 ff ff       	call   800de5 <sys_page_map>
+  80155e:	89 c6                	mov    %eax,%esi
+  801560:	83 c4 20             	add    $0x20,%esp
+  801563:	85 c0                	test   %eax,%eax
+  801565:	78 9c                	js     801503 <dup+0xc3>
+  return newfdnum;
+  801567:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80156a:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  80156c:	89 f0                	mov    %esi,%eax
+  80156e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801571:	5b                   	pop    %ebx
+  801572:	5e                   	pop    %esi
+  801573:	5f                   	pop    %edi
+  801574:	5d                   	pop    %ebp
+  801575:	c3                   	ret
+
+00801576 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801576:	55                   	push   %ebp
+  801577:	89 e5                	mov    %esp,%ebp
+  801579:	56                   	push   %esi
+  80157a:	53                   	push   %ebx
+  80157b:	83 ec 18             	sub    $0x18,%esp
+  80157e:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801581:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801584:	50                   	push   %eax
+  801585:	56                   	push   %esi
+  801586:	e8 40 fd ff ff       	call   8012cb <fd_lookup>
+  80158b:	83 c4 10             	add    $0x10,%esp
+  80158e:	85 c0                	test   %eax,%eax
+  801590:	78 3c                	js     8015ce <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801592:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801595:	83 ec 08             	sub    $0x8,%esp
+  801598:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80159b:	50                   	push   %eax
+  80159c:	ff 33                	push   (%ebx)
+  80159e:	e8 78 fd ff ff       	call   80131b <dev_lookup>
+  8015a3:	83 c4 10             	add    $0x10,%esp
+  8015a6:	85 c0                	test   %eax,%eax
+  8015a8:	78 24                	js     8015ce <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8015aa:	8b 43 08             	mov    0x8(%ebx),%eax
+  8015ad:	83 e0 03             	and    $0x3,%eax
+  8015b0:	83 f8 01             	cmp    $0x1,%eax
+  8015b3:	74 20                	je     8015d5 <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  8015b5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015b8:	8b 40 08             	mov    0x8(%eax),%eax
+  8015bb:	85 c0                	test   %eax,%eax
+  8015bd:	74 37                	je     8015f6 <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  8015bf:	83 ec 04             	sub    $0x4,%esp
+  8015c2:	ff 75 10             	push   0x10(%ebp)
+  8015c5:	ff 75 0c             	push   0xc(%ebp)
+  8015c8:	53                   	push   %ebx
+  8015c9:	ff d0                	call   *%eax
+  8015cb:	83 c4 10             	add    $0x10,%esp
+}
+  8015ce:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015d1:	5b                   	pop    %ebx
+  8015d2:	5e                   	pop    %esi
+  8015d3:	5d                   	pop    %ebp
+  8015d4:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8015d5:	a1 44 67 80 00       	mov    0x806744,%eax
+  8015da:	8b 40 48             	mov    0x48(%eax),%eax
+  8015dd:	83 ec 04             	sub    $0x4,%esp
+  8015e0:	56                   	push   %esi
+  8015e1:	50                   	push   %eax
+  8015e2:	68 d1 34 80 00       	push   $0x8034d1
+  8015e7:	e8 99 ed ff ff       	call   800385 <cprintf>
+    return -E_INVAL;
+  8015ec:	83 c4 10             	add    $0x10,%esp
+  8015ef:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015f4:	eb d8                	jmp    8015ce <read+0x58>
+    return -E_NOT_SUPP;
+  8015f6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015fb:	eb d1                	jmp    8015ce <read+0x58>
+
+008015fd <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8015fd:	55                   	push   %ebp
+  8015fe:	89 e5                	mov    %esp,%ebp
+  801600:	57                   	push   %edi
+  801601:	56                   	push   %esi
+  801602:	53                   	push   %ebx
+  801603:	83 ec 0c             	sub    $0xc,%esp
+  801606:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801609:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  80160c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801611:	eb 02                	jmp    801615 <readn+0x18>
+  801613:	01 c3                	add    %eax,%ebx
+  801615:	39 f3                	cmp    %esi,%ebx
+  801617:	73 21                	jae    80163a <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  801619:	83 ec 04             	sub    $0x4,%esp
+  80161c:	89 f0                	mov    %esi,%eax
+  80161e:	29 d8                	sub    %ebx,%eax
+  801620:	50                   	push   %eax
+  801621:	89 d8                	mov    %ebx,%eax
+  801623:	03 45 0c             	add    0xc(%ebp),%eax
+  801626:	50                   	push   %eax
+  801627:	57                   	push   %edi
+  801628:	e8 49 ff ff ff       	call   801576 <read>
+    if (m < 0)
+  80162d:	83 c4 10             	add    $0x10,%esp
+  801630:	85 c0                	test   %eax,%eax
+  801632:	78 04                	js     801638 <readn+0x3b>
+      return m;
+    if (m == 0)
+  801634:	75 dd                	jne    801613 <readn+0x16>
+  801636:	eb 02                	jmp    80163a <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  801638:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  80163a:	89 d8                	mov    %ebx,%eax
+  80163c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80163f:	5b                   	pop    %ebx
+  801640:	5e                   	pop    %esi
+  801641:	5f                   	pop    %edi
+  801642:	5d                   	pop    %ebp
+  801643:	c3                   	ret
+
+00801644 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801644:	55                   	push   %ebp
+  801645:	89 e5                	mov    %esp,%ebp
+  801647:	56                   	push   %esi
+  801648:	53                   	push   %ebx
+  801649:	83 ec 18             	sub    $0x18,%esp
+  80164c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  80164f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801652:	50                   	push   %eax
+  801653:	53                   	push   %ebx
+  801654:	e8 72 fc ff ff       	call   8012cb <fd_lookup>
+  801659:	83 c4 10             	add    $0x10,%esp
+  80165c:	85 c0                	test   %eax,%eax
+  80165e:	78 37                	js     801697 <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801660:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801663:	83 ec 08             	sub    $0x8,%esp
+  801666:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801669:	50                   	push   %eax
+  80166a:	ff 36                	push   (%esi)
+  80166c:	e8 aa fc ff ff       	call   80131b <dev_lookup>
+  801671:	83 c4 10             	add    $0x10,%esp
+  801674:	85 c0                	test   %eax,%eax
+  801676:	78 1f                	js     801697 <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801678:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80167c:	74 20                	je     80169e <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  80167e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801681:	8b 40 0c             	mov    0xc(%eax),%eax
+  801684:	85 c0                	test   %eax,%eax
+  801686:	74 37                	je     8016bf <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  801688:	83 ec 04             	sub    $0x4,%esp
+  80168b:	ff 75 10             	push   0x10(%ebp)
+  80168e:	ff 75 0c             	push   0xc(%ebp)
+  801691:	56                   	push   %esi
+  801692:	ff d0                	call   *%eax
+  801694:	83 c4 10             	add    $0x10,%esp
+}
+  801697:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80169a:	5b                   	pop    %ebx
+  80169b:	5e                   	pop    %esi
+  80169c:	5d                   	pop    %ebp
+  80169d:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80169e:	a1 44 67 80 00       	mov    0x806744,%eax
+  8016a3:	8b 40 48             	mov    0x48(%eax),%eax
+  8016a6:	83 ec 04             	sub    $0x4,%esp
+  8016a9:	53                   	push   %ebx
+  8016aa:	50                   	push   %eax
+  8016ab:	68 ed 34 80 00       	push   $0x8034ed
+  8016b0:	e8 d0 ec ff ff       	call   800385 <cprintf>
+    return -E_INVAL;
+  8016b5:	83 c4 10             	add    $0x10,%esp
+  8016b8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016bd:	eb d8                	jmp    801697 <write+0x53>
+    return -E_NOT_SUPP;
+  8016bf:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016c4:	eb d1                	jmp    801697 <write+0x53>
+
+008016c6 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8016c6:	55                   	push   %ebp
+  8016c7:	89 e5                	mov    %esp,%ebp
+  8016c9:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8016cc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016cf:	50                   	push   %eax
+  8016d0:	ff 75 08             	push   0x8(%ebp)
+  8016d3:	e8 f3 fb ff ff       	call   8012cb <fd_lookup>
+  8016d8:	83 c4 10             	add    $0x10,%esp
+  8016db:	85 c0                	test   %eax,%eax
+  8016dd:	78 0e                	js     8016ed <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  8016df:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8016e2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016e5:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  8016e8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8016ed:	c9                   	leave
+  8016ee:	c3                   	ret
+
+008016ef <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8016ef:	55                   	push   %ebp
+  8016f0:	89 e5                	mov    %esp,%ebp
+  8016f2:	56                   	push   %esi
+  8016f3:	53                   	push   %ebx
+  8016f4:	83 ec 18             	sub    $0x18,%esp
+  8016f7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016fa:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016fd:	50                   	push   %eax
+  8016fe:	53                   	push   %ebx
+  8016ff:	e8 c7 fb ff ff       	call   8012cb <fd_lookup>
+  801704:	83 c4 10             	add    $0x10,%esp
+  801707:	85 c0                	test   %eax,%eax
+  801709:	78 34                	js     80173f <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80170b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80170e:	83 ec 08             	sub    $0x8,%esp
+  801711:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801714:	50                   	push   %eax
+  801715:	ff 36                	push   (%esi)
+  801717:	e8 ff fb ff ff       	call   80131b <dev_lookup>
+  80171c:	83 c4 10             	add    $0x10,%esp
+  80171f:	85 c0                	test   %eax,%eax
+  801721:	78 1c                	js     80173f <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801723:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801727:	74 1d                	je     801746 <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  801729:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80172c:	8b 40 18             	mov    0x18(%eax),%eax
+  80172f:	85 c0                	test   %eax,%eax
+  801731:	74 34                	je     801767 <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  801733:	83 ec 08             	sub    $0x8,%esp
+  801736:	ff 75 0c             	push   0xc(%ebp)
+  801739:	56                   	push   %esi
+  80173a:	ff d0                	call   *%eax
+  80173c:	83 c4 10             	add    $0x10,%esp
+}
+  80173f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801742:	5b                   	pop    %ebx
+  801743:	5e                   	pop    %esi
+  801744:	5d                   	pop    %ebp
+  801745:	c3                   	ret
+            thisenv->env_id, fdnum);
+  801746:	a1 44 67 80 00       	mov    0x806744,%eax
+  80174b:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80174e:	83 ec 04             	sub    $0x4,%esp
+  801751:	53                   	push   %ebx
+  801752:	50                   	push   %eax
+  801753:	68 b0 34 80 00       	push   $0x8034b0
+  801758:	e8 28 ec ff ff       	call   800385 <cprintf>
+    return -E_INVAL;
+  80175d:	83 c4 10             	add    $0x10,%esp
+  801760:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801765:	eb d8                	jmp    80173f <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  801767:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80176c:	eb d1                	jmp    80173f <ftruncate+0x50>
+
+0080176e <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80176e:	55                   	push   %ebp
+  80176f:	89 e5                	mov    %esp,%ebp
+  801771:	56                   	push   %esi
+  801772:	53                   	push   %ebx
+  801773:	83 ec 18             	sub    $0x18,%esp
+  801776:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801779:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80177c:	50                   	push   %eax
+  80177d:	ff 75 08             	push   0x8(%ebp)
+  801780:	e8 46 fb ff ff       	call   8012cb <fd_lookup>
+  801785:	83 c4 10             	add    $0x10,%esp
+  801788:	85 c0                	test   %eax,%eax
+  80178a:	78 49                	js     8017d5 <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80178c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80178f:	83 ec 08             	sub    $0x8,%esp
+  801792:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801795:	50                   	push   %eax
+  801796:	ff 36                	push   (%esi)
+  801798:	e8 7e fb ff ff       	call   80131b <dev_lookup>
+  80179d:	83 c4 10             	add    $0x10,%esp
+  8017a0:	85 c0                	test   %eax,%eax
+  8017a2:	78 31                	js     8017d5 <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  8017a4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017a7:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8017ab:	74 2f                	je     8017dc <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  8017ad:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  8017b0:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8017b7:	00 00 00 
+  stat->st_isdir = 0;
+  8017ba:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8017c1:	00 00 00 
+  stat->st_dev = dev;
+  8017c4:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  8017ca:	83 ec 08             	sub    $0x8,%esp
+  8017cd:	53                   	push   %ebx
+  8017ce:	56                   	push   %esi
+  8017cf:	ff 50 14             	call   *0x14(%eax)
+  8017d2:	83 c4 10             	add    $0x10,%esp
+}
+  8017d5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017d8:	5b                   	pop    %ebx
+  8017d9:	5e                   	pop    %esi
+  8017da:	5d                   	pop    %ebp
+  8017db:	c3                   	ret
+    return -E_NOT_SUPP;
+  8017dc:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017e1:	eb f2                	jmp    8017d5 <fstat+0x67>
+
+008017e3 <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  8017e3:	55                   	push   %ebp
+  8017e4:	89 e5                	mov    %esp,%ebp
+  8017e6:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  8017e9:	ff 75 0c             	push   0xc(%ebp)
+  8017ec:	ff 75 08             	push   0x8(%ebp)
+  8017ef:	e8 58 07 00 00       	call   801f4c <file_stat>
+}
+  8017f4:	c9                   	leave
+  8017f5:	c3                   	ret
+
+008017f6 <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  8017f6:	55                   	push   %ebp
+  8017f7:	89 e5                	mov    %esp,%ebp
+  8017f9:	57                   	push   %edi
+  8017fa:	56                   	push   %esi
+  8017fb:	53                   	push   %ebx
+  8017fc:	83 ec 1c             	sub    $0x1c,%esp
+  8017ff:	89 c7                	mov    %eax,%edi
+  801801:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801804:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801807:	e9 a2 00 00 00       	jmp    8018ae <fsipc_send+0xb8>
+  nfsenvs = 0;
+  80180c:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  801813:	00 00 00 
+  801816:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80181b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801820:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801825:	be 01 00 00 00       	mov    $0x1,%esi
+  80182a:	eb 0f                	jmp    80183b <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  80182c:	83 c0 01             	add    $0x1,%eax
+  80182f:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801834:	74 49                	je     80187f <fsipc_send+0x89>
+  801836:	83 f9 07             	cmp    $0x7,%ecx
+  801839:	7f 50                	jg     80188b <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  80183b:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  80183e:	c1 e2 04             	shl    $0x4,%edx
+  801841:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801847:	8b 52 50             	mov    0x50(%edx),%edx
+  80184a:	83 fa 01             	cmp    $0x1,%edx
+  80184d:	75 dd                	jne    80182c <fsipc_send+0x36>
+  80184f:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801852:	c1 e2 04             	shl    $0x4,%edx
+  801855:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80185b:	8b 52 54             	mov    0x54(%edx),%edx
+  80185e:	85 d2                	test   %edx,%edx
+  801860:	74 ca                	je     80182c <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801862:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801865:	c1 e2 04             	shl    $0x4,%edx
+  801868:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80186e:	8b 52 48             	mov    0x48(%edx),%edx
+  801871:	89 14 8d 20 60 80 00 	mov    %edx,0x806020(,%ecx,4)
+  801878:	8d 49 01             	lea    0x1(%ecx),%ecx
+  80187b:	89 f3                	mov    %esi,%ebx
+  80187d:	eb ad                	jmp    80182c <fsipc_send+0x36>
+  80187f:	84 db                	test   %bl,%bl
+  801881:	74 38                	je     8018bb <fsipc_send+0xc5>
+  801883:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+  801889:	eb 30                	jmp    8018bb <fsipc_send+0xc5>
+  80188b:	84 db                	test   %bl,%bl
+  80188d:	74 2c                	je     8018bb <fsipc_send+0xc5>
+  80188f:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+  801895:	eb 24                	jmp    8018bb <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  801897:	50                   	push   %eax
+  801898:	68 1c 35 80 00       	push   $0x80351c
+  80189d:	6a 34                	push   $0x34
+  80189f:	68 26 35 80 00       	push   $0x803526
+  8018a4:	e8 01 ea ff ff       	call   8002aa <_panic>
+    }
+    sys_yield();
+  8018a9:	e8 92 f4 ff ff       	call   800d40 <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  8018ae:	83 3d 00 60 80 00 03 	cmpl   $0x3,0x806000
+  8018b5:	0f 8e 51 ff ff ff    	jle    80180c <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  8018bb:	a1 44 67 80 00       	mov    0x806744,%eax
+  8018c0:	8b 70 48             	mov    0x48(%eax),%esi
+  8018c3:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  8018c9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018ce:	8b 0d 00 60 80 00    	mov    0x806000,%ecx
+  8018d4:	39 d9                	cmp    %ebx,%ecx
+  8018d6:	7e d1                	jle    8018a9 <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  8018d8:	83 ec 0c             	sub    $0xc,%esp
+  8018db:	ff 75 e0             	push   -0x20(%ebp)
+  8018de:	6a 07                	push   $0x7
+  8018e0:	ff 75 e4             	push   -0x1c(%ebp)
+  8018e3:	57                   	push   %edi
+  8018e4:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  8018e7:	99                   	cltd
+  8018e8:	f7 f9                	idiv   %ecx
+  8018ea:	ff 34 95 20 60 80 00 	push   0x806020(,%edx,4)
+  8018f1:	e8 63 f7 ff ff       	call   801059 <sys_ipc_try_send>
+      if (r == 0)
+  8018f6:	83 c4 20             	add    $0x20,%esp
+  8018f9:	85 c0                	test   %eax,%eax
+  8018fb:	74 0a                	je     801907 <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  8018fd:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801900:	75 95                	jne    801897 <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  801902:	83 c3 01             	add    $0x1,%ebx
+  801905:	eb c7                	jmp    8018ce <fsipc_send+0xd8>
+  }
+}
+  801907:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80190a:	5b                   	pop    %ebx
+  80190b:	5e                   	pop    %esi
+  80190c:	5f                   	pop    %edi
+  80190d:	5d                   	pop    %ebp
+  80190e:	c3                   	ret
+
+0080190f <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  80190f:	55                   	push   %ebp
+  801910:	89 e5                	mov    %esp,%ebp
+  801912:	53                   	push   %ebx
+  801913:	83 ec 14             	sub    $0x14,%esp
+  801916:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  801918:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  80191f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801924:	ba 00 70 80 00       	mov    $0x807000,%edx
+  801929:	e8 c8 fe ff ff       	call   8017f6 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  80192e:	6a 00                	push   $0x0
+  801930:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801933:	50                   	push   %eax
+  801934:	53                   	push   %ebx
+  801935:	6a 00                	push   $0x0
+  801937:	e8 26 13 00 00       	call   802c62 <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  80193c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80193f:	c9                   	leave
+  801940:	c3                   	ret
+
+00801941 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801941:	55                   	push   %ebp
+  801942:	89 e5                	mov    %esp,%ebp
+  801944:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801947:	8b 45 08             	mov    0x8(%ebp),%eax
+  80194a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80194d:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.set_size.req_size = newsize;
+  801952:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801955:	a3 04 70 80 00       	mov    %eax,0x807004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  80195a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80195f:	b8 02 00 00 00       	mov    $0x2,%eax
+  801964:	e8 a6 ff ff ff       	call   80190f <fsipc>
+}
+  801969:	c9                   	leave
+  80196a:	c3                   	ret
+
+0080196b <devfile_flush>:
+{
+  80196b:	55                   	push   %ebp
+  80196c:	89 e5                	mov    %esp,%ebp
+  80196e:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801971:	8b 45 08             	mov    0x8(%ebp),%eax
+  801974:	8b 40 0c             	mov    0xc(%eax),%eax
+  801977:	a3 00 70 80 00       	mov    %eax,0x807000
+  return fsipc(FSREQ_FLUSH, NULL);
+  80197c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801981:	b8 06 00 00 00       	mov    $0x6,%eax
+  801986:	e8 84 ff ff ff       	call   80190f <fsipc>
+}
+  80198b:	c9                   	leave
+  80198c:	c3                   	ret
+
+0080198d <devfile_stat>:
+{
+  80198d:	55                   	push   %ebp
+  80198e:	89 e5                	mov    %esp,%ebp
+  801990:	53                   	push   %ebx
+  801991:	83 ec 04             	sub    $0x4,%esp
+  801994:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801997:	8b 45 08             	mov    0x8(%ebp),%eax
+  80199a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80199d:	a3 00 70 80 00       	mov    %eax,0x807000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8019a2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019a7:	b8 05 00 00 00       	mov    $0x5,%eax
+  8019ac:	e8 5e ff ff ff       	call   80190f <fsipc>
+  8019b1:	85 c0                	test   %eax,%eax
+  8019b3:	78 2c                	js     8019e1 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8019b5:	83 ec 08             	sub    $0x8,%esp
+  8019b8:	68 00 70 80 00       	push   $0x807000
+  8019bd:	53                   	push   %ebx
+  8019be:	e8 b0 ef ff ff       	call   800973 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  8019c3:	a1 80 70 80 00       	mov    0x807080,%eax
+  8019c8:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8019ce:	a1 84 70 80 00       	mov    0x807084,%eax
+  8019d3:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  8019d9:	83 c4 10             	add    $0x10,%esp
+  8019dc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019e4:	c9                   	leave
+  8019e5:	c3                   	ret
+
+008019e6 <fsv_alloc>:
+{
+  8019e6:	55                   	push   %ebp
+  8019e7:	89 e5                	mov    %esp,%ebp
+  8019e9:	56                   	push   %esi
+  8019ea:	53                   	push   %ebx
+  8019eb:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  8019ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019f2:	eb 22                	jmp    801a16 <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  8019f4:	83 ec 04             	sub    $0x4,%esp
+  8019f7:	6a 00                	push   $0x0
+  8019f9:	6a 00                	push   $0x0
+  8019fb:	6a 07                	push   $0x7
+  8019fd:	50                   	push   %eax
+  8019fe:	6a 00                	push   $0x0
+  801a00:	6a 04                	push   $0x4
+  801a02:	68 40 60 80 00       	push   $0x806040
+  801a07:	e8 e9 f7 ff ff       	call   8011f5 <sysbatch_add>
+  801a0c:	83 c4 20             	add    $0x20,%esp
+  801a0f:	85 c0                	test   %eax,%eax
+  801a11:	78 48                	js     801a5b <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  801a13:	83 c3 01             	add    $0x1,%ebx
+  801a16:	39 f3                	cmp    %esi,%ebx
+  801a18:	74 31                	je     801a4b <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  801a1a:	89 d8                	mov    %ebx,%eax
+  801a1c:	c1 e0 0c             	shl    $0xc,%eax
+  801a1f:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801a24:	89 c2                	mov    %eax,%edx
+  801a26:	c1 ea 16             	shr    $0x16,%edx
+  801a29:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801a30:	f6 c2 01             	test   $0x1,%dl
+  801a33:	74 bf                	je     8019f4 <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  801a35:	89 c2                	mov    %eax,%edx
+  801a37:	c1 ea 0c             	shr    $0xc,%edx
+  801a3a:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801a41:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801a44:	83 fa 03             	cmp    $0x3,%edx
+  801a47:	75 ab                	jne    8019f4 <fsv_alloc+0xe>
+  801a49:	eb c8                	jmp    801a13 <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  801a4b:	83 ec 0c             	sub    $0xc,%esp
+  801a4e:	68 40 60 80 00       	push   $0x806040
+  801a53:	e8 4d f7 ff ff       	call   8011a5 <sysbatch_flush>
+  801a58:	83 c4 10             	add    $0x10,%esp
+}
+  801a5b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a5e:	5b                   	pop    %ebx
+  801a5f:	5e                   	pop    %esi
+  801a60:	5d                   	pop    %ebp
+  801a61:	c3                   	ret
+
+00801a62 <devfile_read>:
+{
+  801a62:	55                   	push   %ebp
+  801a63:	89 e5                	mov    %esp,%ebp
+  801a65:	57                   	push   %edi
+  801a66:	56                   	push   %esi
+  801a67:	53                   	push   %ebx
+  801a68:	83 ec 3c             	sub    $0x3c,%esp
+  801a6b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  801a6e:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  801a74:	77 57                	ja     801acd <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801a76:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a79:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a7c:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.read.req_n = n;
+  801a81:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801a87:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a8c:	b8 03 00 00 00       	mov    $0x3,%eax
+  801a91:	e8 79 fe ff ff       	call   80190f <fsipc>
+  801a96:	89 c6                	mov    %eax,%esi
+  801a98:	85 c0                	test   %eax,%eax
+  801a9a:	78 27                	js     801ac3 <devfile_read+0x61>
+  assert(r <= n);
+  801a9c:	39 c3                	cmp    %eax,%ebx
+  801a9e:	0f 82 0e 02 00 00    	jb     801cb2 <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  801aa4:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801aa9:	0f 8f 1c 02 00 00    	jg     801ccb <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801aaf:	83 ec 04             	sub    $0x4,%esp
+  801ab2:	50                   	push   %eax
+  801ab3:	68 00 70 80 00       	push   $0x807000
+  801ab8:	ff 75 0c             	push   0xc(%ebp)
+  801abb:	e8 39 f0 ff ff       	call   800af9 <memmove>
+  return r;
+  801ac0:	83 c4 10             	add    $0x10,%esp
+}
+  801ac3:	89 f0                	mov    %esi,%eax
+  801ac5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ac8:	5b                   	pop    %ebx
+  801ac9:	5e                   	pop    %esi
+  801aca:	5f                   	pop    %edi
+  801acb:	5d                   	pop    %ebp
+  801acc:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  801acd:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ad2:	e8 0f ff ff ff       	call   8019e6 <fsv_alloc>
+  801ad7:	89 c6                	mov    %eax,%esi
+  801ad9:	85 c0                	test   %eax,%eax
+  801adb:	78 e6                	js     801ac3 <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  801add:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ae0:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ae3:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  801ae8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801aeb:	8b 40 04             	mov    0x4(%eax),%eax
+  801aee:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  801af3:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  801af9:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801b00:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801b05:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801b0a:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801b0f:	e8 e2 fc ff ff       	call   8017f6 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801b14:	6a 00                	push   $0x0
+  801b16:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801b19:	50                   	push   %eax
+  801b1a:	68 00 10 c0 9f       	push   $0x9fc01000
+  801b1f:	6a 00                	push   $0x0
+  801b21:	e8 3c 11 00 00       	call   802c62 <ipc_recv_pages>
+  801b26:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  801b28:	83 c4 10             	add    $0x10,%esp
+  801b2b:	85 c0                	test   %eax,%eax
+  801b2d:	7e 94                	jle    801ac3 <devfile_read+0x61>
+  assert(r <= n);
+  801b2f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801b32:	39 c3                	cmp    %eax,%ebx
+  801b34:	72 2e                	jb     801b64 <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801b36:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b39:	8b 40 04             	mov    0x4(%eax),%eax
+  801b3c:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801b41:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  801b44:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801b47:	c1 e2 0c             	shl    $0xc,%edx
+  801b4a:	39 ca                	cmp    %ecx,%edx
+  801b4c:	72 2f                	jb     801b7d <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  801b4e:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  801b53:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  801b56:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  801b5a:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801b5f:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  801b62:	eb 52                	jmp    801bb6 <devfile_read+0x154>
+  assert(r <= n);
+  801b64:	68 31 35 80 00       	push   $0x803531
+  801b69:	68 38 35 80 00       	push   $0x803538
+  801b6e:	68 49 01 00 00       	push   $0x149
+  801b73:	68 26 35 80 00       	push   $0x803526
+  801b78:	e8 2d e7 ff ff       	call   8002aa <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801b7d:	68 5c 35 80 00       	push   $0x80355c
+  801b82:	68 38 35 80 00       	push   $0x803538
+  801b87:	68 4a 01 00 00       	push   $0x14a
+  801b8c:	68 26 35 80 00       	push   $0x803526
+  801b91:	e8 14 e7 ff ff       	call   8002aa <_panic>
+      memmove(dst + done, src + done, m);
+  801b96:	83 ec 04             	sub    $0x4,%esp
+  801b99:	53                   	push   %ebx
+  801b9a:	56                   	push   %esi
+  801b9b:	89 f8                	mov    %edi,%eax
+  801b9d:	03 45 0c             	add    0xc(%ebp),%eax
+  801ba0:	50                   	push   %eax
+  801ba1:	e8 53 ef ff ff       	call   800af9 <memmove>
+  801ba6:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  801ba9:	01 df                	add    %ebx,%edi
+  801bab:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801bae:	39 c7                	cmp    %eax,%edi
+  801bb0:	0f 83 c0 00 00 00    	jae    801c76 <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801bb6:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801bb9:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  801bbc:	89 f0                	mov    %esi,%eax
+  801bbe:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801bc3:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  801bc8:	29 c3                	sub    %eax,%ebx
+  801bca:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801bcd:	29 f8                	sub    %edi,%eax
+  801bcf:	39 c3                	cmp    %eax,%ebx
+  801bd1:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  801bd4:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801bda:	75 ba                	jne    801b96 <devfile_read+0x134>
+  801bdc:	89 f9                	mov    %edi,%ecx
+  801bde:	03 4d 0c             	add    0xc(%ebp),%ecx
+  801be1:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  801be4:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  801bea:	75 aa                	jne    801b96 <devfile_read+0x134>
+  801bec:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  801bf2:	77 a2                	ja     801b96 <devfile_read+0x134>
+  801bf4:	89 c8                	mov    %ecx,%eax
+  801bf6:	c1 e8 16             	shr    $0x16,%eax
+  801bf9:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801c00:	a8 01                	test   $0x1,%al
+  801c02:	74 92                	je     801b96 <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  801c04:	89 c8                	mov    %ecx,%eax
+  801c06:	c1 e8 0c             	shr    $0xc,%eax
+  801c09:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  801c10:	a8 01                	test   $0x1,%al
+  801c12:	74 82                	je     801b96 <devfile_read+0x134>
+  801c14:	a9 02 08 00 00       	test   $0x802,%eax
+  801c19:	0f 84 77 ff ff ff    	je     801b96 <devfile_read+0x134>
+  801c1f:	f6 c4 04             	test   $0x4,%ah
+  801c22:	0f 85 6e ff ff ff    	jne    801b96 <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  801c28:	a1 44 67 80 00       	mov    0x806744,%eax
+  801c2d:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  801c31:	84 c0                	test   %al,%al
+  801c33:	75 17                	jne    801c4c <devfile_read+0x1ea>
+  801c35:	83 ec 08             	sub    $0x8,%esp
+  801c38:	6a 01                	push   $0x1
+  801c3a:	6a 00                	push   $0x0
+  801c3c:	e8 1e f1 ff ff       	call   800d5f <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  801c41:	83 c4 10             	add    $0x10,%esp
+  801c44:	85 c0                	test   %eax,%eax
+  801c46:	0f 85 4a ff ff ff    	jne    801b96 <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  801c4c:	83 ec 04             	sub    $0x4,%esp
+  801c4f:	68 05 08 00 00       	push   $0x805
+  801c54:	ff 75 cc             	push   -0x34(%ebp)
+  801c57:	6a 00                	push   $0x0
+  801c59:	56                   	push   %esi
+  801c5a:	6a 00                	push   $0x0
+  801c5c:	6a 05                	push   $0x5
+  801c5e:	68 40 60 80 00       	push   $0x806040
+  801c63:	e8 8d f5 ff ff       	call   8011f5 <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  801c68:	c1 e8 1f             	shr    $0x1f,%eax
+  801c6b:	08 45 cb             	or     %al,-0x35(%ebp)
+  801c6e:	83 c4 20             	add    $0x20,%esp
+  801c71:	e9 33 ff ff ff       	jmp    801ba9 <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  801c76:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  801c79:	83 ec 0c             	sub    $0xc,%esp
+  801c7c:	68 40 60 80 00       	push   $0x806040
+  801c81:	e8 1f f5 ff ff       	call   8011a5 <sysbatch_flush>
+  801c86:	83 c4 10             	add    $0x10,%esp
+  801c89:	85 c0                	test   %eax,%eax
+  801c8b:	78 06                	js     801c93 <devfile_read+0x231>
+  801c8d:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  801c91:	74 14                	je     801ca7 <devfile_read+0x245>
+    memmove(dst, src, r);
+  801c93:	83 ec 04             	sub    $0x4,%esp
+  801c96:	ff 75 d4             	push   -0x2c(%ebp)
+  801c99:	ff 75 d0             	push   -0x30(%ebp)
+  801c9c:	ff 75 0c             	push   0xc(%ebp)
+  801c9f:	e8 55 ee ff ff       	call   800af9 <memmove>
+  801ca4:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  801ca7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801caa:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  801cad:	e9 11 fe ff ff       	jmp    801ac3 <devfile_read+0x61>
+  assert(r <= n);
+  801cb2:	68 31 35 80 00       	push   $0x803531
+  801cb7:	68 38 35 80 00       	push   $0x803538
+  801cbc:	68 1c 01 00 00       	push   $0x11c
+  801cc1:	68 26 35 80 00       	push   $0x803526
+  801cc6:	e8 df e5 ff ff       	call   8002aa <_panic>
+  assert(r <= PGSIZE);
+  801ccb:	68 4d 35 80 00       	push   $0x80354d
+  801cd0:	68 38 35 80 00       	push   $0x803538
+  801cd5:	68 1d 01 00 00       	push   $0x11d
+  801cda:	68 26 35 80 00       	push   $0x803526
+  801cdf:	e8 c6 e5 ff ff       	call   8002aa <_panic>
+
+00801ce4 <devfile_write>:
+{
+  801ce4:	55                   	push   %ebp
+  801ce5:	89 e5                	mov    %esp,%ebp
+  801ce7:	57                   	push   %edi
+  801ce8:	56                   	push   %esi
+  801ce9:	53                   	push   %ebx
+  801cea:	83 ec 1c             	sub    $0x1c,%esp
+  801ced:	8b 75 08             	mov    0x8(%ebp),%esi
+  801cf0:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  801cf3:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  801cf8:	77 39                	ja     801d33 <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801cfa:	8b 56 0c             	mov    0xc(%esi),%edx
+  801cfd:	89 15 00 70 80 00    	mov    %edx,0x807000
+  fsipcbuf.write.req_n = n;
+  801d03:	a3 04 70 80 00       	mov    %eax,0x807004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  801d08:	83 ec 04             	sub    $0x4,%esp
+  801d0b:	50                   	push   %eax
+  801d0c:	ff 75 0c             	push   0xc(%ebp)
+  801d0f:	68 08 70 80 00       	push   $0x807008
+  801d14:	e8 e0 ed ff ff       	call   800af9 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801d19:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d1e:	b8 04 00 00 00       	mov    $0x4,%eax
+  801d23:	e8 e7 fb ff ff       	call   80190f <fsipc>
+  801d28:	83 c4 10             	add    $0x10,%esp
+}
+  801d2b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d2e:	5b                   	pop    %ebx
+  801d2f:	5e                   	pop    %esi
+  801d30:	5f                   	pop    %edi
+  801d31:	5d                   	pop    %ebp
+  801d32:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  801d33:	ba 00 00 10 00       	mov    $0x100000,%edx
+  801d38:	39 d0                	cmp    %edx,%eax
+  801d3a:	89 d3                	mov    %edx,%ebx
+  801d3c:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  801d3f:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  801d45:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  801d48:	83 c7 01             	add    $0x1,%edi
+  801d4b:	89 f8                	mov    %edi,%eax
+  801d4d:	e8 94 fc ff ff       	call   8019e6 <fsv_alloc>
+  801d52:	85 c0                	test   %eax,%eax
+  801d54:	78 d5                	js     801d2b <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  801d56:	83 ec 04             	sub    $0x4,%esp
+  801d59:	53                   	push   %ebx
+  801d5a:	ff 75 0c             	push   0xc(%ebp)
+  801d5d:	68 00 10 c0 9f       	push   $0x9fc01000
+  801d62:	e8 92 ed ff ff       	call   800af9 <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  801d67:	8b 46 0c             	mov    0xc(%esi),%eax
+  801d6a:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  801d6f:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  801d75:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801d7c:	89 f9                	mov    %edi,%ecx
+  801d7e:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801d83:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801d88:	e8 69 fa ff ff       	call   8017f6 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801d8d:	6a 00                	push   $0x0
+  801d8f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801d92:	50                   	push   %eax
+  801d93:	6a 00                	push   $0x0
+  801d95:	6a 00                	push   $0x0
+  801d97:	e8 c6 0e 00 00       	call   802c62 <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  801d9c:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  801d9f:	eb 8a                	jmp    801d2b <devfile_write+0x47>
+
+00801da1 <open>:
+{
+  801da1:	55                   	push   %ebp
+  801da2:	89 e5                	mov    %esp,%ebp
+  801da4:	56                   	push   %esi
+  801da5:	53                   	push   %ebx
+  801da6:	83 ec 1c             	sub    $0x1c,%esp
+  801da9:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801dac:	56                   	push   %esi
+  801dad:	e8 86 eb ff ff       	call   800938 <strlen>
+  801db2:	83 c4 10             	add    $0x10,%esp
+  801db5:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801dba:	7f 6c                	jg     801e28 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  801dbc:	83 ec 0c             	sub    $0xc,%esp
+  801dbf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801dc2:	50                   	push   %eax
+  801dc3:	e8 ad f4 ff ff       	call   801275 <fd_alloc>
+  801dc8:	89 c3                	mov    %eax,%ebx
+  801dca:	83 c4 10             	add    $0x10,%esp
+  801dcd:	85 c0                	test   %eax,%eax
+  801dcf:	78 3c                	js     801e0d <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801dd1:	83 ec 08             	sub    $0x8,%esp
+  801dd4:	56                   	push   %esi
+  801dd5:	68 00 70 80 00       	push   $0x807000
+  801dda:	e8 94 eb ff ff       	call   800973 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801ddf:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801de2:	a3 00 74 80 00       	mov    %eax,0x807400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801de7:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801dea:	b8 01 00 00 00       	mov    $0x1,%eax
+  801def:	e8 1b fb ff ff       	call   80190f <fsipc>
+  801df4:	89 c3                	mov    %eax,%ebx
+  801df6:	83 c4 10             	add    $0x10,%esp
+  801df9:	85 c0                	test   %eax,%eax
+  801dfb:	78 19                	js     801e16 <open+0x75>
+  return fd2num(fd);
+  801dfd:	83 ec 0c             	sub    $0xc,%esp
+  801e00:	ff 75 f4             	push   -0xc(%ebp)
+  801e03:	e8 49 f4 ff ff       	call   801251 <fd2num>
+  801e08:	89 c3                	mov    %eax,%ebx
+  801e0a:	83 c4 10             	add    $0x10,%esp
+}
+  801e0d:	89 d8                	mov    %ebx,%eax
+  801e0f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e12:	5b                   	pop    %ebx
+  801e13:	5e                   	pop    %esi
+  801e14:	5d                   	pop    %ebp
+  801e15:	c3                   	ret
+    fd_close(fd, 0);
+  801e16:	83 ec 08             	sub    $0x8,%esp
+  801e19:	6a 00                	push   $0x0
+  801e1b:	ff 75 f4             	push   -0xc(%ebp)
+  801e1e:	e8 44 f5 ff ff       	call   801367 <fd_close>
+    return r;
+  801e23:	83 c4 10             	add    $0x10,%esp
+  801e26:	eb e5                	jmp    801e0d <open+0x6c>
+    return -E_BAD_PATH;
+  801e28:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801e2d:	eb de                	jmp    801e0d <open+0x6c>
+
+00801e2f <open_read>:
+{
+  801e2f:	55                   	push   %ebp
+  801e30:	89 e5                	mov    %esp,%ebp
+  801e32:	57                   	push   %edi
+  801e33:	56                   	push   %esi
+  801e34:	53                   	push   %ebx
+  801e35:	83 ec 28             	sub    $0x28,%esp
+  801e38:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  801e3b:	57                   	push   %edi
+  801e3c:	e8 f7 ea ff ff       	call   800938 <strlen>
+  801e41:	83 c4 10             	add    $0x10,%esp
+  801e44:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801e49:	0f 87 f6 00 00 00    	ja     801f45 <open_read+0x116>
+  801e4f:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  801e51:	83 ec 0c             	sub    $0xc,%esp
+  801e54:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801e57:	50                   	push   %eax
+  801e58:	e8 18 f4 ff ff       	call   801275 <fd_alloc>
+  801e5d:	89 c3                	mov    %eax,%ebx
+  801e5f:	83 c4 10             	add    $0x10,%esp
+  801e62:	85 c0                	test   %eax,%eax
+  801e64:	0f 88 b2 00 00 00    	js     801f1c <open_read+0xed>
+  strcpy(req->req_buf, path);
+  801e6a:	83 ec 08             	sub    $0x8,%esp
+  801e6d:	57                   	push   %edi
+  801e6e:	68 e4 70 80 00       	push   $0x8070e4
+  801e73:	e8 fb ea ff ff       	call   800973 <strcpy>
+  req->req_nops = 2;
+  801e78:	c7 05 00 70 80 00 02 	movl   $0x2,0x807000
+  801e7f:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  801e82:	c7 05 04 70 80 00 01 	movl   $0x1,0x807004
+  801e89:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  801e8c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e8f:	a3 10 70 80 00       	mov    %eax,0x807010
+  req->req_ops[0].op_buf = 0;
+  801e94:	c7 05 18 70 80 00 00 	movl   $0x0,0x807018
+  801e9b:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  801e9e:	c7 05 20 70 80 00 04 	movl   $0x4,0x807020
+  801ea5:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  801ea8:	c7 05 24 70 80 00 01 	movl   $0x1,0x807024
+  801eaf:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  801eb2:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  801eb7:	29 f0                	sub    %esi,%eax
+  801eb9:	3b 45 14             	cmp    0x14(%ebp),%eax
+  801ebc:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  801ec0:	a3 2c 70 80 00       	mov    %eax,0x80702c
+  req->req_ops[1].op_offset = 0;
+  801ec5:	c7 05 30 70 80 00 00 	movl   $0x0,0x807030
+  801ecc:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  801ecf:	83 c6 01             	add    $0x1,%esi
+  801ed2:	89 35 34 70 80 00    	mov    %esi,0x807034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  801ed8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801edb:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801ee0:	e8 2a fa ff ff       	call   80190f <fsipc>
+  801ee5:	89 c3                	mov    %eax,%ebx
+  801ee7:	83 c4 10             	add    $0x10,%esp
+  801eea:	83 f8 01             	cmp    $0x1,%eax
+  801eed:	7e 37                	jle    801f26 <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  801eef:	a1 38 70 80 00       	mov    0x807038,%eax
+  801ef4:	8b 55 18             	mov    0x18(%ebp),%edx
+  801ef7:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  801ef9:	83 ec 04             	sub    $0x4,%esp
+  801efc:	50                   	push   %eax
+  801efd:	81 c6 e4 70 80 00    	add    $0x8070e4,%esi
+  801f03:	56                   	push   %esi
+  801f04:	ff 75 10             	push   0x10(%ebp)
+  801f07:	e8 ed eb ff ff       	call   800af9 <memmove>
+  return fd2num(fd);
+  801f0c:	83 c4 04             	add    $0x4,%esp
+  801f0f:	ff 75 e4             	push   -0x1c(%ebp)
+  801f12:	e8 3a f3 ff ff       	call   801251 <fd2num>
+  801f17:	89 c3                	mov    %eax,%ebx
+  801f19:	83 c4 10             	add    $0x10,%esp
+}
+  801f1c:	89 d8                	mov    %ebx,%eax
+  801f1e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f21:	5b                   	pop    %ebx
+  801f22:	5e                   	pop    %esi
+  801f23:	5f                   	pop    %edi
+  801f24:	5d                   	pop    %ebp
+  801f25:	c3                   	ret
+    fd_close(fd, 0);
+  801f26:	83 ec 08             	sub    $0x8,%esp
+  801f29:	6a 00                	push   $0x0
+  801f2b:	ff 75 e4             	push   -0x1c(%ebp)
+  801f2e:	e8 34 f4 ff ff       	call   801367 <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  801f33:	83 c4 10             	add    $0x10,%esp
+  801f36:	85 db                	test   %ebx,%ebx
+  801f38:	78 e2                	js     801f1c <open_read+0xed>
+  801f3a:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  801f3d:	8b 9b 1c 70 80 00    	mov    0x80701c(%ebx),%ebx
+  801f43:	eb d7                	jmp    801f1c <open_read+0xed>
+    return -E_BAD_PATH;
+  801f45:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801f4a:	eb d0                	jmp    801f1c <open_read+0xed>
+
+00801f4c <file_stat>:
+{
+  801f4c:	55                   	push   %ebp
+  801f4d:	89 e5                	mov    %esp,%ebp
+  801f4f:	57                   	push   %edi
+  801f50:	56                   	push   %esi
+  801f51:	53                   	push   %ebx
+  801f52:	83 ec 18             	sub    $0x18,%esp
+  801f55:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801f58:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801f5b:	57                   	push   %edi
+  801f5c:	e8 d7 e9 ff ff       	call   800938 <strlen>
+  801f61:	83 c4 10             	add    $0x10,%esp
+  801f64:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801f69:	0f 8f c7 00 00 00    	jg     802036 <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  801f6f:	83 ec 0c             	sub    $0xc,%esp
+  801f72:	57                   	push   %edi
+  801f73:	e8 c0 e9 ff ff       	call   800938 <strlen>
+  801f78:	8d 58 04             	lea    0x4(%eax),%ebx
+  801f7b:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  801f7e:	83 c4 08             	add    $0x8,%esp
+  801f81:	57                   	push   %edi
+  801f82:	68 e4 70 80 00       	push   $0x8070e4
+  801f87:	e8 e7 e9 ff ff       	call   800973 <strcpy>
+  req->req_nops = 2;
+  801f8c:	c7 05 00 70 80 00 02 	movl   $0x2,0x807000
+  801f93:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  801f96:	c7 05 04 70 80 00 02 	movl   $0x2,0x807004
+  801f9d:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  801fa0:	c7 05 10 70 80 00 00 	movl   $0x0,0x807010
+  801fa7:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  801faa:	c7 05 18 70 80 00 00 	movl   $0x0,0x807018
+  801fb1:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  801fb4:	c7 05 20 70 80 00 03 	movl   $0x3,0x807020
+  801fbb:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  801fbe:	c7 05 24 70 80 00 01 	movl   $0x1,0x807024
+  801fc5:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  801fc8:	89 1d 34 70 80 00    	mov    %ebx,0x807034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  801fce:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fd3:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801fd8:	e8 32 f9 ff ff       	call   80190f <fsipc>
+  801fdd:	83 c4 10             	add    $0x10,%esp
+  801fe0:	83 f8 01             	cmp    $0x1,%eax
+  801fe3:	7e 42                	jle    802027 <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  801fe5:	81 c3 e4 70 80 00    	add    $0x8070e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  801feb:	83 ec 08             	sub    $0x8,%esp
+  801fee:	53                   	push   %ebx
+  801fef:	56                   	push   %esi
+  801ff0:	e8 7e e9 ff ff       	call   800973 <strcpy>
+  st->st_size = ret->ret_size;
+  801ff5:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  801ffb:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  802001:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  802007:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  80200d:	c7 86 88 00 00 00 04 	movl   $0x804004,0x88(%esi)
+  802014:	40 80 00 
+  return 0;
+  802017:	83 c4 10             	add    $0x10,%esp
+  80201a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80201f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802022:	5b                   	pop    %ebx
+  802023:	5e                   	pop    %esi
+  802024:	5f                   	pop    %edi
+  802025:	5d                   	pop    %ebp
+  802026:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  802027:	85 c0                	test   %eax,%eax
+  802029:	78 f4                	js     80201f <file_stat+0xd3>
+  80202b:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80202e:	8b 80 1c 70 80 00    	mov    0x80701c(%eax),%eax
+  802034:	eb e9                	jmp    80201f <file_stat+0xd3>
+    return -E_BAD_PATH;
+  802036:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  80203b:	eb e2                	jmp    80201f <file_stat+0xd3>
+
+0080203d <read_map>:
+{
+  80203d:	55                   	push   %ebp
+  80203e:	89 e5                	mov    %esp,%ebp
+  802040:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802043:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802046:	50                   	push   %eax
+  802047:	ff 75 08             	push   0x8(%ebp)
+  80204a:	e8 7c f2 ff ff       	call   8012cb <fd_lookup>
+  80204f:	83 c4 10             	add    $0x10,%esp
+  802052:	85 c0                	test   %eax,%eax
+  802054:	78 2a                	js     802080 <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  802056:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802059:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  80205f:	39 08                	cmp    %ecx,(%eax)
+  802061:	75 1f                	jne    802082 <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  802063:	8b 40 0c             	mov    0xc(%eax),%eax
+  802066:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.read_map.req_offset = offset;
+  80206b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80206e:	a3 04 70 80 00       	mov    %eax,0x807004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  802073:	8b 55 10             	mov    0x10(%ebp),%edx
+  802076:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80207b:	e8 8f f8 ff ff       	call   80190f <fsipc>
+}
+  802080:	c9                   	leave
+  802081:	c3                   	ret
+    return -E_INVAL;
+  802082:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802087:	eb f7                	jmp    802080 <read_map+0x43>
+
+00802089 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802089:	55                   	push   %ebp
+  80208a:	89 e5                	mov    %esp,%ebp
+  80208c:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  80208f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802094:	b8 08 00 00 00       	mov    $0x8,%eax
+  802099:	e8 71 f8 ff ff       	call   80190f <fsipc>
+}
+  80209e:	c9                   	leave
+  80209f:	c3                   	ret
+
+008020a0 <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  8020a0:	55                   	push   %ebp
+  8020a1:	89 e5                	mov    %esp,%ebp
+  8020a3:	57                   	push   %edi
+  8020a4:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  8020a5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020a8:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.stats.req_bio_sched = 0;
+  8020ad:	c7 05 04 70 80 00 00 	movl   $0x0,0x807004
+  8020b4:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  8020b7:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  8020be:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  8020c1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020c6:	b8 09 00 00 00       	mov    $0x9,%eax
+  8020cb:	e8 3f f8 ff ff       	call   80190f <fsipc>
+  8020d0:	85 c0                	test   %eax,%eax
+  8020d2:	78 14                	js     8020e8 <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  8020d4:	be 00 70 80 00       	mov    $0x807000,%esi
+  8020d9:	b9 16 00 00 00       	mov    $0x16,%ecx
+  8020de:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8020e1:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  8020e3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020e8:	5e                   	pop    %esi
+  8020e9:	5f                   	pop    %edi
+  8020ea:	5d                   	pop    %ebp
+  8020eb:	c3                   	ret
+
+008020ec <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  8020ec:	55                   	push   %ebp
+  8020ed:	89 e5                	mov    %esp,%ebp
+  8020ef:	53                   	push   %ebx
+  8020f0:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  8020f3:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8020f6:	50                   	push   %eax
+  8020f7:	6a 00                	push   $0x0
+  8020f9:	e8 a2 ff ff ff       	call   8020a0 <fs_stats>
+  8020fe:	83 c4 10             	add    $0x10,%esp
+  802101:	85 c0                	test   %eax,%eax
+  802103:	78 28                	js     80212d <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  802105:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  802108:	83 ec 08             	sub    $0x8,%esp
+  80210b:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  80210e:	50                   	push   %eax
+  80210f:	6a 20                	push   $0x20
+  802111:	e8 8a ff ff ff       	call   8020a0 <fs_stats>
+  802116:	83 c4 10             	add    $0x10,%esp
+  802119:	85 c0                	test   %eax,%eax
+  80211b:	78 10                	js     80212d <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  80211d:	83 ec 08             	sub    $0x8,%esp
+  802120:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802123:	50                   	push   %eax
+  802124:	53                   	push   %ebx
+  802125:	e8 76 ff ff ff       	call   8020a0 <fs_stats>
+  80212a:	83 c4 10             	add    $0x10,%esp
+}
+  80212d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802130:	c9                   	leave
+  802131:	c3                   	ret
+
+00802132 <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  802132:	55                   	push   %ebp
+  802133:	89 e5                	mov    %esp,%ebp
+  802135:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  802138:	c7 05 00 70 80 00 00 	movl   $0x0,0x807000
+  80213f:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  802142:	8b 45 08             	mov    0x8(%ebp),%eax
+  802145:	a3 04 70 80 00       	mov    %eax,0x807004
+  fsipcbuf.stats.req_dcache = 0;
+  80214a:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  802151:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  802154:	ba 00 00 00 00       	mov    $0x0,%edx
+  802159:	b8 09 00 00 00       	mov    $0x9,%eax
+  80215e:	e8 ac f7 ff ff       	call   80190f <fsipc>
+}
+  802163:	c9                   	leave
+  802164:	c3                   	ret
+
+00802165 <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  802165:	55                   	push   %ebp
+  802166:	89 e5                	mov    %esp,%ebp
+  802168:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  80216b:	c7 05 00 70 80 00 00 	movl   $0x0,0x807000
+  802172:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  802175:	c7 05 04 70 80 00 00 	movl   $0x0,0x807004
+  80217c:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  80217f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802182:	a3 08 70 80 00       	mov    %eax,0x807008
+  return fsipc(FSREQ_STATS, NULL);
+  802187:	ba 00 00 00 00       	mov    $0x0,%edx
+  80218c:	b8 09 00 00 00       	mov    $0x9,%eax
+  802191:	e8 79 f7 ff ff       	call   80190f <fsipc>
+}
+  802196:	c9                   	leave
+  802197:	c3                   	ret
+
+00802198 <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  802198:	55                   	push   %ebp
+  802199:	89 e5                	mov    %esp,%ebp
+  80219b:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80219e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021a1:	50                   	push   %eax
+  8021a2:	ff 75 08             	push   0x8(%ebp)
+  8021a5:	e8 21 f1 ff ff       	call   8012cb <fd_lookup>
+  8021aa:	83 c4 10             	add    $0x10,%esp
+  8021ad:	85 c0                	test   %eax,%eax
+  8021af:	78 34                	js     8021e5 <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  8021b1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021b4:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  8021ba:	39 08                	cmp    %ecx,(%eax)
+  8021bc:	75 29                	jne    8021e7 <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  8021be:	8b 40 0c             	mov    0xc(%eax),%eax
+  8021c1:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.fallocate.req_offset = offset;
+  8021c6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021c9:	a3 04 70 80 00       	mov    %eax,0x807004
+  fsipcbuf.fallocate.req_len = len;
+  8021ce:	8b 45 10             	mov    0x10(%ebp),%eax
+  8021d1:	a3 08 70 80 00       	mov    %eax,0x807008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  8021d6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021db:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8021e0:	e8 2a f7 ff ff       	call   80190f <fsipc>
+}
+  8021e5:	c9                   	leave
+  8021e6:	c3                   	ret
+    return -E_INVAL;
+  8021e7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021ec:	eb f7                	jmp    8021e5 <fallocate+0x4d>
+
+008021ee <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  8021ee:	55                   	push   %ebp
+  8021ef:	89 e5                	mov    %esp,%ebp
+  8021f1:	57                   	push   %edi
+  8021f2:	56                   	push   %esi
+  8021f3:	53                   	push   %ebx
+  8021f4:	83 ec 24             	sub    $0x24,%esp
+  8021f7:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8021fa:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8021fd:	50                   	push   %eax
+  8021fe:	ff 75 08             	push   0x8(%ebp)
+  802201:	e8 c5 f0 ff ff       	call   8012cb <fd_lookup>
+  802206:	83 c4 10             	add    $0x10,%esp
+  802209:	85 c0                	test   %eax,%eax
+  80220b:	78 66                	js     802273 <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  80220d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802210:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  802216:	39 08                	cmp    %ecx,(%eax)
+  802218:	75 61                	jne    80227b <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  80221a:	85 f6                	test   %esi,%esi
+  80221c:	7e 50                	jle    80226e <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  80221e:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  802223:	39 de                	cmp    %ebx,%esi
+  802225:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  802228:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80222b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80222e:	a3 00 70 80 00       	mov    %eax,0x807000
+    fsipcbuf.prefetch.req_n = m;
+  802233:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  802239:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  802240:	83 ec 04             	sub    $0x4,%esp
+  802243:	57                   	push   %edi
+  802244:	ff 75 0c             	push   0xc(%ebp)
+  802247:	68 08 70 80 00       	push   $0x807008
+  80224c:	e8 a8 e8 ff ff       	call   800af9 <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  802251:	ba 00 00 00 00       	mov    $0x0,%edx
+  802256:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80225b:	e8 af f6 ff ff       	call   80190f <fsipc>
+  802260:	83 c4 10             	add    $0x10,%esp
+  802263:	85 c0                	test   %eax,%eax
+  802265:	78 0c                	js     802273 <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  802267:	01 7d 0c             	add    %edi,0xc(%ebp)
+  80226a:	29 de                	sub    %ebx,%esi
+  80226c:	eb ac                	jmp    80221a <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  80226e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802273:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802276:	5b                   	pop    %ebx
+  802277:	5e                   	pop    %esi
+  802278:	5f                   	pop    %edi
+  802279:	5d                   	pop    %ebp
+  80227a:	c3                   	ret
+    return -E_INVAL;
+  80227b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802280:	eb f1                	jmp    802273 <prefetch+0x85>
+
+00802282 <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  802282:	55                   	push   %ebp
+  802283:	89 e5                	mov    %esp,%ebp
+  802285:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  802288:	50                   	push   %eax
+  802289:	e8 d3 ef ff ff       	call   801261 <fd2data>
+  80228e:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  802293:	c9                   	leave
+  802294:	c3                   	ret
+
+00802295 <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802295:	55                   	push   %ebp
+  802296:	89 e5                	mov    %esp,%ebp
+  802298:	56                   	push   %esi
+  802299:	53                   	push   %ebx
+  80229a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  80229d:	83 ec 0c             	sub    $0xc,%esp
+  8022a0:	ff 75 08             	push   0x8(%ebp)
+  8022a3:	e8 b9 ef ff ff       	call   801261 <fd2data>
+  8022a8:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  8022aa:	83 c4 08             	add    $0x8,%esp
+  8022ad:	68 88 35 80 00       	push   $0x803588
+  8022b2:	53                   	push   %ebx
+  8022b3:	e8 bb e6 ff ff       	call   800973 <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  8022b8:	8b 46 04             	mov    0x4(%esi),%eax
+  8022bb:	2b 06                	sub    (%esi),%eax
+  8022bd:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  8022c3:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8022ca:	00 00 00 
+  stat->st_dev = &devpipe;
+  8022cd:	c7 83 88 00 00 00 20 	movl   $0x804020,0x88(%ebx)
+  8022d4:	40 80 00 
+  return 0;
+}
+  8022d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022dc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022df:	5b                   	pop    %ebx
+  8022e0:	5e                   	pop    %esi
+  8022e1:	5d                   	pop    %ebp
+  8022e2:	c3                   	ret
+
+008022e3 <pipe_wakeup>:
+{
+  8022e3:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  8022e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022ea:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  8022ed:	85 c0                	test   %eax,%eax
+  8022ef:	75 01                	jne    8022f2 <pipe_wakeup+0xf>
+  8022f1:	c3                   	ret
+{
+  8022f2:	55                   	push   %ebp
+  8022f3:	89 e5                	mov    %esp,%ebp
+  8022f5:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  8022f8:	6a 00                	push   $0x0
+  8022fa:	68 00 00 c0 ee       	push   $0xeec00000
+  8022ff:	52                   	push   %edx
+  802300:	e8 f9 ed ff ff       	call   8010fe <sys_chan_wakeup>
+  802305:	83 c4 10             	add    $0x10,%esp
+}
+  802308:	c9                   	leave
+  802309:	c3                   	ret
+
+0080230a <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80230a:	55                   	push   %ebp
+  80230b:	89 e5                	mov    %esp,%ebp
+  80230d:	57                   	push   %edi
+  80230e:	56                   	push   %esi
+  80230f:	53                   	push   %ebx
+  802310:	83 ec 18             	sub    $0x18,%esp
+  802313:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  802316:	57                   	push   %edi
+  802317:	e8 45 ef ff ff       	call   801261 <fd2data>
+  80231c:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  80231e:	83 c4 10             	add    $0x10,%esp
+  802321:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  802325:	74 2a                	je     802351 <devpipe_close+0x47>
+  802327:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  80232c:	89 f8                	mov    %edi,%eax
+  80232e:	e8 4f ff ff ff       	call   802282 <pipe_ring>
+  802333:	83 ec 08             	sub    $0x8,%esp
+  802336:	01 d8                	add    %ebx,%eax
+  802338:	50                   	push   %eax
+  802339:	6a 00                	push   $0x0
+  80233b:	e8 e7 ea ff ff       	call   800e27 <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  802340:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802346:	83 c4 10             	add    $0x10,%esp
+  802349:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  80234f:	75 db                	jne    80232c <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  802351:	83 ec 08             	sub    $0x8,%esp
+  802354:	57                   	push   %edi
+  802355:	6a 00                	push   $0x0
+  802357:	e8 cb ea ff ff       	call   800e27 <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  80235c:	83 c4 10             	add    $0x10,%esp
+  80235f:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  802363:	75 13                	jne    802378 <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  802365:	83 ec 08             	sub    $0x8,%esp
+  802368:	56                   	push   %esi
+  802369:	6a 00                	push   $0x0
+  80236b:	e8 b7 ea ff ff       	call   800e27 <sys_page_unmap>
+}
+  802370:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802373:	5b                   	pop    %ebx
+  802374:	5e                   	pop    %esi
+  802375:	5f                   	pop    %edi
+  802376:	5d                   	pop    %ebp
+  802377:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802378:	8d 56 04             	lea    0x4(%esi),%edx
+  80237b:	8d 46 2c             	lea    0x2c(%esi),%eax
+  80237e:	e8 60 ff ff ff       	call   8022e3 <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802383:	8d 46 30             	lea    0x30(%esi),%eax
+  802386:	89 f2                	mov    %esi,%edx
+  802388:	e8 56 ff ff ff       	call   8022e3 <pipe_wakeup>
+  80238d:	eb d6                	jmp    802365 <devpipe_close+0x5b>
+
+0080238f <_pipeisclosed>:
+{
+  80238f:	55                   	push   %ebp
+  802390:	89 e5                	mov    %esp,%ebp
+  802392:	57                   	push   %edi
+  802393:	56                   	push   %esi
+  802394:	53                   	push   %ebx
+  802395:	83 ec 1c             	sub    $0x1c,%esp
+  802398:	89 c7                	mov    %eax,%edi
+  80239a:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  80239c:	a1 44 67 80 00       	mov    0x806744,%eax
+  8023a1:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  8023a4:	83 ec 0c             	sub    $0xc,%esp
+  8023a7:	57                   	push   %edi
+  8023a8:	e8 18 0a 00 00       	call   802dc5 <pageref>
+  8023ad:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8023b0:	89 34 24             	mov    %esi,(%esp)
+  8023b3:	e8 0d 0a 00 00       	call   802dc5 <pageref>
+    nn = thisenv->env_runs;
+  8023b8:	8b 15 44 67 80 00    	mov    0x806744,%edx
+  8023be:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  8023c1:	83 c4 10             	add    $0x10,%esp
+  8023c4:	39 cb                	cmp    %ecx,%ebx
+  8023c6:	74 1b                	je     8023e3 <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  8023c8:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8023cb:	75 cf                	jne    80239c <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8023cd:	8b 42 58             	mov    0x58(%edx),%eax
+  8023d0:	6a 01                	push   $0x1
+  8023d2:	50                   	push   %eax
+  8023d3:	53                   	push   %ebx
+  8023d4:	68 8f 35 80 00       	push   $0x80358f
+  8023d9:	e8 a7 df ff ff       	call   800385 <cprintf>
+  8023de:	83 c4 10             	add    $0x10,%esp
+  8023e1:	eb b9                	jmp    80239c <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  8023e3:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8023e6:	0f 94 c0             	sete   %al
+  8023e9:	0f b6 c0             	movzbl %al,%eax
+}
+  8023ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023ef:	5b                   	pop    %ebx
+  8023f0:	5e                   	pop    %esi
+  8023f1:	5f                   	pop    %edi
+  8023f2:	5d                   	pop    %ebp
+  8023f3:	c3                   	ret
+
+008023f4 <devpipe_write_bulk>:
+{
+  8023f4:	55                   	push   %ebp
+  8023f5:	89 e5                	mov    %esp,%ebp
+  8023f7:	57                   	push   %edi
+  8023f8:	56                   	push   %esi
+  8023f9:	53                   	push   %ebx
+  8023fa:	83 ec 1c             	sub    $0x1c,%esp
+  8023fd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802400:	89 d6                	mov    %edx,%esi
+  802402:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  802405:	e8 78 fe ff ff       	call   802282 <pipe_ring>
+  80240a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  80240d:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802412:	8d 46 04             	lea    0x4(%esi),%eax
+  802415:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  802418:	eb 75                	jmp    80248f <devpipe_write_bulk+0x9b>
+  80241a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80241f:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802423:	6a 64                	push   $0x64
+  802425:	68 00 00 c0 ee       	push   $0xeec00000
+  80242a:	53                   	push   %ebx
+  80242b:	56                   	push   %esi
+  80242c:	e8 aa ec ff ff       	call   8010db <sys_chan_sleep>
+      continue;
+  802431:	83 c4 10             	add    $0x10,%esp
+  802434:	eb 59                	jmp    80248f <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  802436:	89 d1                	mov    %edx,%ecx
+  802438:	c1 f9 1f             	sar    $0x1f,%ecx
+  80243b:	c1 e9 11             	shr    $0x11,%ecx
+  80243e:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802441:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802446:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  802448:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  80244e:	29 d3                	sub    %edx,%ebx
+  802450:	ba 00 80 00 00       	mov    $0x8000,%edx
+  802455:	29 c2                	sub    %eax,%edx
+  802457:	39 d3                	cmp    %edx,%ebx
+  802459:	0f 47 da             	cmova  %edx,%ebx
+  80245c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80245f:	29 fa                	sub    %edi,%edx
+  802461:	39 d3                	cmp    %edx,%ebx
+  802463:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  802466:	83 ec 04             	sub    $0x4,%esp
+  802469:	53                   	push   %ebx
+  80246a:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80246d:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  802470:	52                   	push   %edx
+  802471:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802474:	01 c8                	add    %ecx,%eax
+  802476:	50                   	push   %eax
+  802477:	e8 df e6 ff ff       	call   800b5b <memcpy>
+    i += m;
+  80247c:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  80247e:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802481:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802484:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802487:	e8 57 fe ff ff       	call   8022e3 <pipe_wakeup>
+  80248c:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  80248f:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802492:	73 2b                	jae    8024bf <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  802494:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  802496:	8b 56 04             	mov    0x4(%esi),%edx
+  802499:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  80249f:	39 d0                	cmp    %edx,%eax
+  8024a1:	7d 93                	jge    802436 <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  8024a3:	89 f2                	mov    %esi,%edx
+  8024a5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8024a8:	e8 e2 fe ff ff       	call   80238f <_pipeisclosed>
+  8024ad:	85 c0                	test   %eax,%eax
+  8024af:	0f 84 65 ff ff ff    	je     80241a <devpipe_write_bulk+0x26>
+        return i;
+  8024b5:	89 f8                	mov    %edi,%eax
+}
+  8024b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024ba:	5b                   	pop    %ebx
+  8024bb:	5e                   	pop    %esi
+  8024bc:	5f                   	pop    %edi
+  8024bd:	5d                   	pop    %ebp
+  8024be:	c3                   	ret
+  return i;
+  8024bf:	89 f8                	mov    %edi,%eax
+  8024c1:	eb f4                	jmp    8024b7 <devpipe_write_bulk+0xc3>
+
+008024c3 <devpipe_write>:
+{
+  8024c3:	55                   	push   %ebp
+  8024c4:	89 e5                	mov    %esp,%ebp
+  8024c6:	57                   	push   %edi
+  8024c7:	56                   	push   %esi
+  8024c8:	53                   	push   %ebx
+  8024c9:	83 ec 28             	sub    $0x28,%esp
+  8024cc:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  8024cf:	56                   	push   %esi
+  8024d0:	e8 8c ed ff ff       	call   801261 <fd2data>
+  8024d5:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  8024d7:	8b 78 28             	mov    0x28(%eax),%edi
+  8024da:	83 c4 10             	add    $0x10,%esp
+  8024dd:	85 ff                	test   %edi,%edi
+  8024df:	75 25                	jne    802506 <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  8024e1:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8024e4:	74 66                	je     80254c <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8024e6:	8b 43 04             	mov    0x4(%ebx),%eax
+  8024e9:	8b 0b                	mov    (%ebx),%ecx
+  8024eb:	8d 51 20             	lea    0x20(%ecx),%edx
+  8024ee:	39 d0                	cmp    %edx,%eax
+  8024f0:	72 2b                	jb     80251d <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  8024f2:	89 da                	mov    %ebx,%edx
+  8024f4:	89 f0                	mov    %esi,%eax
+  8024f6:	e8 94 fe ff ff       	call   80238f <_pipeisclosed>
+  8024fb:	85 c0                	test   %eax,%eax
+  8024fd:	75 51                	jne    802550 <devpipe_write+0x8d>
+      sys_yield();
+  8024ff:	e8 3c e8 ff ff       	call   800d40 <sys_yield>
+  802504:	eb e0                	jmp    8024e6 <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  802506:	83 ec 0c             	sub    $0xc,%esp
+  802509:	ff 75 10             	push   0x10(%ebp)
+  80250c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80250f:	89 c2                	mov    %eax,%edx
+  802511:	89 f0                	mov    %esi,%eax
+  802513:	e8 dc fe ff ff       	call   8023f4 <devpipe_write_bulk>
+  802518:	83 c4 10             	add    $0x10,%esp
+  80251b:	eb 38                	jmp    802555 <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80251d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802520:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802524:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802527:	89 c2                	mov    %eax,%edx
+  802529:	c1 fa 1f             	sar    $0x1f,%edx
+  80252c:	89 d1                	mov    %edx,%ecx
+  80252e:	c1 e9 1b             	shr    $0x1b,%ecx
+  802531:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802534:	83 e2 1f             	and    $0x1f,%edx
+  802537:	29 ca                	sub    %ecx,%edx
+  802539:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  80253d:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  802541:	83 c0 01             	add    $0x1,%eax
+  802544:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  802547:	83 c7 01             	add    $0x1,%edi
+  80254a:	eb 95                	jmp    8024e1 <devpipe_write+0x1e>
+  return i;
+  80254c:	89 f8                	mov    %edi,%eax
+  80254e:	eb 05                	jmp    802555 <devpipe_write+0x92>
+        return 0;
+  802550:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802555:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802558:	5b                   	pop    %ebx
+  802559:	5e                   	pop    %esi
+  80255a:	5f                   	pop    %edi
+  80255b:	5d                   	pop    %ebp
+  80255c:	c3                   	ret
+
+0080255d <devpipe_read_bulk>:
+{
+  80255d:	55                   	push   %ebp
+  80255e:	89 e5                	mov    %esp,%ebp
+  802560:	57                   	push   %edi
+  802561:	56                   	push   %esi
+  802562:	53                   	push   %ebx
+  802563:	83 ec 2c             	sub    $0x2c,%esp
+  802566:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802569:	89 d6                	mov    %edx,%esi
+  80256b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80256e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  802571:	e8 0c fd ff ff       	call   802282 <pipe_ring>
+  802576:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  802579:	85 db                	test   %ebx,%ebx
+  80257b:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802580:	0f 45 c3             	cmovne %ebx,%eax
+  802583:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802586:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  80258b:	8d 46 30             	lea    0x30(%esi),%eax
+  80258e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  802591:	eb 50                	jmp    8025e3 <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  802593:	89 d1                	mov    %edx,%ecx
+  802595:	c1 f9 1f             	sar    $0x1f,%ecx
+  802598:	c1 e9 11             	shr    $0x11,%ecx
+  80259b:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  80259e:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8025a3:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  8025a5:	29 d3                	sub    %edx,%ebx
+  8025a7:	ba 00 80 00 00       	mov    $0x8000,%edx
+  8025ac:	29 c2                	sub    %eax,%edx
+  8025ae:	39 d3                	cmp    %edx,%ebx
+  8025b0:	0f 47 da             	cmova  %edx,%ebx
+  8025b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8025b6:	29 fa                	sub    %edi,%edx
+  8025b8:	39 d3                	cmp    %edx,%ebx
+  8025ba:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  8025bd:	83 ec 04             	sub    $0x4,%esp
+  8025c0:	53                   	push   %ebx
+  8025c1:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8025c4:	01 c8                	add    %ecx,%eax
+  8025c6:	50                   	push   %eax
+  8025c7:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8025ca:	01 f8                	add    %edi,%eax
+  8025cc:	50                   	push   %eax
+  8025cd:	e8 89 e5 ff ff       	call   800b5b <memcpy>
+    i += m;
+  8025d2:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  8025d4:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8025d6:	89 f2                	mov    %esi,%edx
+  8025d8:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8025db:	e8 03 fd ff ff       	call   8022e3 <pipe_wakeup>
+  8025e0:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  8025e3:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  8025e6:	73 51                	jae    802639 <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  8025e8:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  8025eb:	8b 16                	mov    (%esi),%edx
+  8025ed:	39 da                	cmp    %ebx,%edx
+  8025ef:	75 a2                	jne    802593 <devpipe_read_bulk+0x36>
+      if (i > 0)
+  8025f1:	85 ff                	test   %edi,%edi
+  8025f3:	75 44                	jne    802639 <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  8025f5:	89 f2                	mov    %esi,%edx
+  8025f7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8025fa:	e8 90 fd ff ff       	call   80238f <_pipeisclosed>
+  8025ff:	85 c0                	test   %eax,%eax
+  802601:	75 3a                	jne    80263d <devpipe_read_bulk+0xe0>
+  802603:	b8 01 00 00 00       	mov    $0x1,%eax
+  802608:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  80260c:	6a 64                	push   $0x64
+  80260e:	ff 75 d4             	push   -0x2c(%ebp)
+  802611:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  802612:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802615:	50                   	push   %eax
+  802616:	e8 c0 ea ff ff       	call   8010db <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  80261b:	85 c0                	test   %eax,%eax
+  80261d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802622:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  802625:	83 c4 10             	add    $0x10,%esp
+  802628:	a8 01                	test   $0x1,%al
+  80262a:	74 b7                	je     8025e3 <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  80262c:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  802631:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802634:	5b                   	pop    %ebx
+  802635:	5e                   	pop    %esi
+  802636:	5f                   	pop    %edi
+  802637:	5d                   	pop    %ebp
+  802638:	c3                   	ret
+  return i;
+  802639:	89 f8                	mov    %edi,%eax
+  80263b:	eb f4                	jmp    802631 <devpipe_read_bulk+0xd4>
+        return 0;
+  80263d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802642:	eb ed                	jmp    802631 <devpipe_read_bulk+0xd4>
+
+00802644 <devpipe_read>:
+{
+  802644:	55                   	push   %ebp
+  802645:	89 e5                	mov    %esp,%ebp
+  802647:	57                   	push   %edi
+  802648:	56                   	push   %esi
+  802649:	53                   	push   %ebx
+  80264a:	83 ec 18             	sub    $0x18,%esp
+  80264d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  802650:	57                   	push   %edi
+  802651:	e8 0b ec ff ff       	call   801261 <fd2data>
+  802656:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  802658:	8b 70 28             	mov    0x28(%eax),%esi
+  80265b:	83 c4 10             	add    $0x10,%esp
+  80265e:	85 f6                	test   %esi,%esi
+  802660:	75 24                	jne    802686 <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  802662:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802665:	74 60                	je     8026c7 <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  802667:	8b 03                	mov    (%ebx),%eax
+  802669:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80266c:	75 3b                	jne    8026a9 <devpipe_read+0x65>
+      if (i > 0)
+  80266e:	85 f6                	test   %esi,%esi
+  802670:	75 2d                	jne    80269f <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  802672:	89 da                	mov    %ebx,%edx
+  802674:	89 f8                	mov    %edi,%eax
+  802676:	e8 14 fd ff ff       	call   80238f <_pipeisclosed>
+  80267b:	85 c0                	test   %eax,%eax
+  80267d:	75 4c                	jne    8026cb <devpipe_read+0x87>
+      sys_yield();
+  80267f:	e8 bc e6 ff ff       	call   800d40 <sys_yield>
+  802684:	eb e1                	jmp    802667 <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  802686:	83 ec 08             	sub    $0x8,%esp
+  802689:	6a 00                	push   $0x0
+  80268b:	ff 75 10             	push   0x10(%ebp)
+  80268e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802691:	89 c2                	mov    %eax,%edx
+  802693:	89 f8                	mov    %edi,%eax
+  802695:	e8 c3 fe ff ff       	call   80255d <devpipe_read_bulk>
+  80269a:	83 c4 10             	add    $0x10,%esp
+  80269d:	eb 02                	jmp    8026a1 <devpipe_read+0x5d>
+        return i;
+  80269f:	89 f0                	mov    %esi,%eax
+}
+  8026a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026a4:	5b                   	pop    %ebx
+  8026a5:	5e                   	pop    %esi
+  8026a6:	5f                   	pop    %edi
+  8026a7:	5d                   	pop    %ebp
+  8026a8:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8026a9:	99                   	cltd
+  8026aa:	c1 ea 1b             	shr    $0x1b,%edx
+  8026ad:	01 d0                	add    %edx,%eax
+  8026af:	83 e0 1f             	and    $0x1f,%eax
+  8026b2:	29 d0                	sub    %edx,%eax
+  8026b4:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8026b9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8026bc:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  8026bf:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  8026c2:	83 c6 01             	add    $0x1,%esi
+  8026c5:	eb 9b                	jmp    802662 <devpipe_read+0x1e>
+  return i;
+  8026c7:	89 f0                	mov    %esi,%eax
+  8026c9:	eb d6                	jmp    8026a1 <devpipe_read+0x5d>
+        return 0;
+  8026cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026d0:	eb cf                	jmp    8026a1 <devpipe_read+0x5d>
+
+008026d2 <pipe2>:
+{
+  8026d2:	55                   	push   %ebp
+  8026d3:	89 e5                	mov    %esp,%ebp
+  8026d5:	57                   	push   %edi
+  8026d6:	56                   	push   %esi
+  8026d7:	53                   	push   %ebx
+  8026d8:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  8026db:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8026de:	50                   	push   %eax
+  8026df:	e8 91 eb ff ff       	call   801275 <fd_alloc>
+  8026e4:	89 c3                	mov    %eax,%ebx
+  8026e6:	83 c4 10             	add    $0x10,%esp
+  8026e9:	85 c0                	test   %eax,%eax
+  8026eb:	0f 88 fb 01 00 00    	js     8028ec <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8026f1:	83 ec 04             	sub    $0x4,%esp
+  8026f4:	68 07 04 00 00       	push   $0x407
+  8026f9:	ff 75 e4             	push   -0x1c(%ebp)
+  8026fc:	6a 00                	push   $0x0
+  8026fe:	e8 9f e6 ff ff       	call   800da2 <sys_page_alloc>
+  802703:	89 c3                	mov    %eax,%ebx
+  802705:	83 c4 10             	add    $0x10,%esp
+  802708:	85 c0                	test   %eax,%eax
+  80270a:	0f 88 dc 01 00 00    	js     8028ec <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  802710:	83 ec 0c             	sub    $0xc,%esp
+  802713:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  802716:	50                   	push   %eax
+  802717:	e8 59 eb ff ff       	call   801275 <fd_alloc>
+  80271c:	89 c3                	mov    %eax,%ebx
+  80271e:	83 c4 10             	add    $0x10,%esp
+  802721:	85 c0                	test   %eax,%eax
+  802723:	0f 88 b3 01 00 00    	js     8028dc <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802729:	83 ec 04             	sub    $0x4,%esp
+  80272c:	68 07 04 00 00       	push   $0x407
+  802731:	ff 75 e0             	push   -0x20(%ebp)
+  802734:	6a 00                	push   $0x0
+  802736:	e8 67 e6 ff ff       	call   800da2 <sys_page_alloc>
+  80273b:	89 c3                	mov    %eax,%ebx
+  80273d:	83 c4 10             	add    $0x10,%esp
+  802740:	85 c0                	test   %eax,%eax
+  802742:	0f 88 94 01 00 00    	js     8028dc <pipe2+0x20a>
+  va = fd2data(fd0);
+  802748:	83 ec 0c             	sub    $0xc,%esp
+  80274b:	ff 75 e4             	push   -0x1c(%ebp)
+  80274e:	e8 0e eb ff ff       	call   801261 <fd2data>
+  802753:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802755:	83 c4 0c             	add    $0xc,%esp
+  802758:	68 07 04 00 00       	push   $0x407
+  80275d:	50                   	push   %eax
+  80275e:	6a 00                	push   $0x0
+  802760:	e8 3d e6 ff ff       	call   800da2 <sys_page_alloc>
+  802765:	89 c3                	mov    %eax,%ebx
+  802767:	83 c4 10             	add    $0x10,%esp
+  80276a:	85 c0                	test   %eax,%eax
+  80276c:	0f 88 5a 01 00 00    	js     8028cc <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802772:	83 ec 0c             	sub    $0xc,%esp
+  802775:	ff 75 e0             	push   -0x20(%ebp)
+  802778:	e8 e4 ea ff ff       	call   801261 <fd2data>
+  80277d:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802784:	50                   	push   %eax
+  802785:	6a 00                	push   $0x0
+  802787:	57                   	push   %edi
+  802788:	6a 00                	push   $0x0
+  80278a:	e8 56 e6 ff ff       	call   800de5 <sys_page_map>
+  80278f:	89 c3                	mov    %eax,%ebx
+  802791:	83 c4 20             	add    $0x20,%esp
+  802794:	85 c0                	test   %eax,%eax
+  802796:	0f 88 22 01 00 00    	js     8028be <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  80279c:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  8027a0:	74 72                	je     802814 <pipe2+0x142>
+  8027a2:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  8027a7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8027aa:	e8 d3 fa ff ff       	call   802282 <pipe_ring>
+  8027af:	83 ec 04             	sub    $0x4,%esp
+  8027b2:	68 07 04 00 00       	push   $0x407
+  8027b7:	01 f0                	add    %esi,%eax
+  8027b9:	50                   	push   %eax
+  8027ba:	6a 00                	push   $0x0
+  8027bc:	e8 e1 e5 ff ff       	call   800da2 <sys_page_alloc>
+  8027c1:	89 c3                	mov    %eax,%ebx
+  8027c3:	83 c4 10             	add    $0x10,%esp
+  8027c6:	85 c0                	test   %eax,%eax
+  8027c8:	0f 88 97 00 00 00    	js     802865 <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  8027ce:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8027d1:	e8 ac fa ff ff       	call   802282 <pipe_ring>
+  8027d6:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  8027d9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8027dc:	e8 a1 fa ff ff       	call   802282 <pipe_ring>
+  8027e1:	83 ec 0c             	sub    $0xc,%esp
+  8027e4:	68 07 04 00 00       	push   $0x407
+  8027e9:	53                   	push   %ebx
+  8027ea:	6a 00                	push   $0x0
+  8027ec:	01 f0                	add    %esi,%eax
+  8027ee:	50                   	push   %eax
+  8027ef:	6a 00                	push   $0x0
+  8027f1:	e8 ef e5 ff ff       	call   800de5 <sys_page_map>
+  8027f6:	89 c3                	mov    %eax,%ebx
+  8027f8:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8027fe:	83 c4 20             	add    $0x20,%esp
+  802801:	85 c0                	test   %eax,%eax
+  802803:	78 60                	js     802865 <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  802805:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  80280b:	75 9a                	jne    8027a7 <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  80280d:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  802814:	a1 20 40 80 00       	mov    0x804020,%eax
+  802819:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80281c:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  80281e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802821:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  802828:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80282b:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  80282d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802830:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  802837:	83 ec 0c             	sub    $0xc,%esp
+  80283a:	ff 75 e4             	push   -0x1c(%ebp)
+  80283d:	e8 0f ea ff ff       	call   801251 <fd2num>
+  802842:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802845:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  802847:	83 c4 04             	add    $0x4,%esp
+  80284a:	ff 75 e0             	push   -0x20(%ebp)
+  80284d:	e8 ff e9 ff ff       	call   801251 <fd2num>
+  802852:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802855:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  802858:	83 c4 10             	add    $0x10,%esp
+  80285b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802860:	e9 87 00 00 00       	jmp    8028ec <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802865:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  80286a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80286d:	e8 10 fa ff ff       	call   802282 <pipe_ring>
+  802872:	83 ec 08             	sub    $0x8,%esp
+  802875:	01 f0                	add    %esi,%eax
+  802877:	50                   	push   %eax
+  802878:	6a 00                	push   $0x0
+  80287a:	e8 a8 e5 ff ff       	call   800e27 <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  80287f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802882:	e8 fb f9 ff ff       	call   802282 <pipe_ring>
+  802887:	83 c4 08             	add    $0x8,%esp
+  80288a:	01 f0                	add    %esi,%eax
+  80288c:	50                   	push   %eax
+  80288d:	6a 00                	push   $0x0
+  80288f:	e8 93 e5 ff ff       	call   800e27 <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802894:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80289a:	83 c4 10             	add    $0x10,%esp
+  80289d:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  8028a3:	75 c5                	jne    80286a <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  8028a5:	83 ec 0c             	sub    $0xc,%esp
+  8028a8:	ff 75 e0             	push   -0x20(%ebp)
+  8028ab:	e8 b1 e9 ff ff       	call   801261 <fd2data>
+  8028b0:	83 c4 08             	add    $0x8,%esp
+  8028b3:	50                   	push   %eax
+  8028b4:	6a 00                	push   $0x0
+  8028b6:	e8 6c e5 ff ff       	call   800e27 <sys_page_unmap>
+  8028bb:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  8028be:	83 ec 08             	sub    $0x8,%esp
+  8028c1:	57                   	push   %edi
+  8028c2:	6a 00                	push   $0x0
+  8028c4:	e8 5e e5 ff ff       	call   800e27 <sys_page_unmap>
+  8028c9:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  8028cc:	83 ec 08             	sub    $0x8,%esp
+  8028cf:	ff 75 e0             	push   -0x20(%ebp)
+  8028d2:	6a 00                	push   $0x0
+  8028d4:	e8 4e e5 ff ff       	call   800e27 <sys_page_unmap>
+  8028d9:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  8028dc:	83 ec 08             	sub    $0x8,%esp
+  8028df:	ff 75 e4             	push   -0x1c(%ebp)
+  8028e2:	6a 00                	push   $0x0
+  8028e4:	e8 3e e5 ff ff       	call   800e27 <sys_page_unmap>
+  8028e9:	83 c4 10             	add    $0x10,%esp
+}
+  8028ec:	89 d8                	mov    %ebx,%eax
+  8028ee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028f1:	5b                   	pop    %ebx
+  8028f2:	5e                   	pop    %esi
+  8028f3:	5f                   	pop    %edi
+  8028f4:	5d                   	pop    %ebp
+  8028f5:	c3                   	ret
+
+008028f6 <pipe>:
+{
+  8028f6:	55                   	push   %ebp
+  8028f7:	89 e5                	mov    %esp,%ebp
+  8028f9:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  8028fc:	6a 00                	push   $0x0
+  8028fe:	ff 75 08             	push   0x8(%ebp)
+  802901:	e8 cc fd ff ff       	call   8026d2 <pipe2>
+}
+  802906:	c9                   	leave
+  802907:	c3                   	ret
+
+00802908 <pipeisclosed>:
+{
+  802908:	55                   	push   %ebp
+  802909:	89 e5                	mov    %esp,%ebp
+  80290b:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80290e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802911:	50                   	push   %eax
+  802912:	ff 75 08             	push   0x8(%ebp)
+  802915:	e8 b1 e9 ff ff       	call   8012cb <fd_lookup>
+  80291a:	83 c4 10             	add    $0x10,%esp
+  80291d:	85 c0                	test   %eax,%eax
+  80291f:	78 18                	js     802939 <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  802921:	83 ec 0c             	sub    $0xc,%esp
+  802924:	ff 75 f4             	push   -0xc(%ebp)
+  802927:	e8 35 e9 ff ff       	call   801261 <fd2data>
+  80292c:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  80292e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802931:	e8 59 fa ff ff       	call   80238f <_pipeisclosed>
+  802936:	83 c4 10             	add    $0x10,%esp
+}
+  802939:	c9                   	leave
+  80293a:	c3                   	ret
+
+0080293b <pipe_splice>:
+{
+  80293b:	55                   	push   %ebp
+  80293c:	89 e5                	mov    %esp,%ebp
+  80293e:	57                   	push   %edi
+  80293f:	56                   	push   %esi
+  802940:	53                   	push   %ebx
+  802941:	83 ec 34             	sub    $0x34,%esp
+  802944:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802947:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80294a:	50                   	push   %eax
+  80294b:	ff 75 08             	push   0x8(%ebp)
+  80294e:	e8 78 e9 ff ff       	call   8012cb <fd_lookup>
+  802953:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802956:	83 c4 10             	add    $0x10,%esp
+  802959:	85 c0                	test   %eax,%eax
+  80295b:	0f 88 d7 00 00 00    	js     802a38 <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  802961:	83 ec 0c             	sub    $0xc,%esp
+  802964:	ff 75 e4             	push   -0x1c(%ebp)
+  802967:	e8 f5 e8 ff ff       	call   801261 <fd2data>
+  80296c:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  80296e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802971:	83 c4 10             	add    $0x10,%esp
+  802974:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  80297a:	39 10                	cmp    %edx,(%eax)
+  80297c:	0f 85 c1 00 00 00    	jne    802a43 <pipe_splice+0x108>
+  802982:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  802986:	0f 84 c0 00 00 00    	je     802a4c <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  80298c:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802990:	0f 84 bf 00 00 00    	je     802a55 <pipe_splice+0x11a>
+  802996:	89 f7                	mov    %esi,%edi
+  802998:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  80299e:	0f 85 ba 00 00 00    	jne    802a5e <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  8029a4:	8d 43 04             	lea    0x4(%ebx),%eax
+  8029a7:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8029aa:	eb 38                	jmp    8029e4 <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  8029ac:	83 ec 0c             	sub    $0xc,%esp
+  8029af:	68 00 10 00 00       	push   $0x1000
+  8029b4:	89 f1                	mov    %esi,%ecx
+  8029b6:	89 da                	mov    %ebx,%edx
+  8029b8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8029bb:	e8 34 fa ff ff       	call   8023f4 <devpipe_write_bulk>
+  8029c0:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8029c3:	83 c4 10             	add    $0x10,%esp
+  8029c6:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8029cb:	75 53                	jne    802a20 <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  8029cd:	83 ec 08             	sub    $0x8,%esp
+  8029d0:	56                   	push   %esi
+  8029d1:	6a 00                	push   $0x0
+  8029d3:	e8 4f e4 ff ff       	call   800e27 <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  8029d8:	83 c7 01             	add    $0x1,%edi
+  8029db:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8029e1:	83 c4 10             	add    $0x10,%esp
+  8029e4:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8029e7:	74 3a                	je     802a23 <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  8029e9:	8b 03                	mov    (%ebx),%eax
+  8029eb:	39 43 04             	cmp    %eax,0x4(%ebx)
+  8029ee:	75 bc                	jne    8029ac <pipe_splice+0x71>
+  8029f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029f5:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  8029f9:	85 c0                	test   %eax,%eax
+  8029fb:	74 af                	je     8029ac <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  8029fd:	83 ec 04             	sub    $0x4,%esp
+  802a00:	6a 07                	push   $0x7
+  802a02:	56                   	push   %esi
+  802a03:	ff 75 d0             	push   -0x30(%ebp)
+  802a06:	e8 f3 e6 ff ff       	call   8010fe <sys_chan_wakeup>
+  802a0b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802a0e:	83 c4 10             	add    $0x10,%esp
+  802a11:	85 c0                	test   %eax,%eax
+  802a13:	79 b8                	jns    8029cd <pipe_splice+0x92>
+  802a15:	b8 01 00 00 00       	mov    $0x1,%eax
+  802a1a:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802a1e:	eb 8c                	jmp    8029ac <pipe_splice+0x71>
+  802a20:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  802a23:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802a27:	75 06                	jne    802a2f <pipe_splice+0xf4>
+  802a29:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802a2d:	78 09                	js     802a38 <pipe_splice+0xfd>
+  return i * PGSIZE;
+  802a2f:	8b 45 10             	mov    0x10(%ebp),%eax
+  802a32:	c1 e0 0c             	shl    $0xc,%eax
+  802a35:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  802a38:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802a3b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a3e:	5b                   	pop    %ebx
+  802a3f:	5e                   	pop    %esi
+  802a40:	5f                   	pop    %edi
+  802a41:	5d                   	pop    %ebp
+  802a42:	c3                   	ret
+    return -E_INVAL;
+  802a43:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802a4a:	eb ec                	jmp    802a38 <pipe_splice+0xfd>
+  802a4c:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802a53:	eb e3                	jmp    802a38 <pipe_splice+0xfd>
+  802a55:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802a5c:	eb da                	jmp    802a38 <pipe_splice+0xfd>
+  802a5e:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802a65:	eb d1                	jmp    802a38 <pipe_splice+0xfd>
+
+00802a67 <pipe_splice_read>:
+{
+  802a67:	55                   	push   %ebp
+  802a68:	89 e5                	mov    %esp,%ebp
+  802a6a:	53                   	push   %ebx
+  802a6b:	83 ec 1c             	sub    $0x1c,%esp
+  802a6e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802a71:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a74:	50                   	push   %eax
+  802a75:	ff 75 08             	push   0x8(%ebp)
+  802a78:	e8 4e e8 ff ff       	call   8012cb <fd_lookup>
+  802a7d:	83 c4 10             	add    $0x10,%esp
+  802a80:	85 c0                	test   %eax,%eax
+  802a82:	78 49                	js     802acd <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  802a84:	83 ec 0c             	sub    $0xc,%esp
+  802a87:	ff 75 f4             	push   -0xc(%ebp)
+  802a8a:	e8 d2 e7 ff ff       	call   801261 <fd2data>
+  802a8f:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802a91:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a94:	83 c4 10             	add    $0x10,%esp
+  802a97:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  802a9d:	39 08                	cmp    %ecx,(%eax)
+  802a9f:	75 31                	jne    802ad2 <pipe_splice_read+0x6b>
+  802aa1:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  802aa5:	74 32                	je     802ad9 <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  802aa7:	8b 48 08             	mov    0x8(%eax),%ecx
+  802aaa:	83 e1 03             	and    $0x3,%ecx
+  802aad:	83 f9 01             	cmp    $0x1,%ecx
+  802ab0:	74 2e                	je     802ae0 <pipe_splice_read+0x79>
+  802ab2:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  802ab8:	75 2d                	jne    802ae7 <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  802aba:	83 ec 08             	sub    $0x8,%esp
+  802abd:	53                   	push   %ebx
+  802abe:	68 00 10 00 00       	push   $0x1000
+  802ac3:	89 d9                	mov    %ebx,%ecx
+  802ac5:	e8 93 fa ff ff       	call   80255d <devpipe_read_bulk>
+  802aca:	83 c4 10             	add    $0x10,%esp
+}
+  802acd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ad0:	c9                   	leave
+  802ad1:	c3                   	ret
+    return -E_INVAL;
+  802ad2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ad7:	eb f4                	jmp    802acd <pipe_splice_read+0x66>
+  802ad9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ade:	eb ed                	jmp    802acd <pipe_splice_read+0x66>
+  802ae0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ae5:	eb e6                	jmp    802acd <pipe_splice_read+0x66>
+  802ae7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802aec:	eb df                	jmp    802acd <pipe_splice_read+0x66>
+
+00802aee <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  802aee:	b8 00 00 00 00       	mov    $0x0,%eax
+  802af3:	c3                   	ret
+
+00802af4 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802af4:	55                   	push   %ebp
+  802af5:	89 e5                	mov    %esp,%ebp
+  802af7:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  802afa:	68 a7 35 80 00       	push   $0x8035a7
+  802aff:	ff 75 0c             	push   0xc(%ebp)
+  802b02:	e8 6c de ff ff       	call   800973 <strcpy>
+  return 0;
+}
+  802b07:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b0c:	c9                   	leave
+  802b0d:	c3                   	ret
+
+00802b0e <devcons_write>:
+{
+  802b0e:	55                   	push   %ebp
+  802b0f:	89 e5                	mov    %esp,%ebp
+  802b11:	57                   	push   %edi
+  802b12:	56                   	push   %esi
+  802b13:	53                   	push   %ebx
+  802b14:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  802b1a:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  802b1f:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  802b25:	eb 2e                	jmp    802b55 <devcons_write+0x47>
+    m = n - tot;
+  802b27:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802b2a:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  802b2c:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802b31:	39 c3                	cmp    %eax,%ebx
+  802b33:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  802b36:	83 ec 04             	sub    $0x4,%esp
+  802b39:	53                   	push   %ebx
+  802b3a:	89 f0                	mov    %esi,%eax
+  802b3c:	03 45 0c             	add    0xc(%ebp),%eax
+  802b3f:	50                   	push   %eax
+  802b40:	57                   	push   %edi
+  802b41:	e8 b3 df ff ff       	call   800af9 <memmove>
+    sys_cputs(buf, m);
+  802b46:	83 c4 08             	add    $0x8,%esp
+  802b49:	53                   	push   %ebx
+  802b4a:	57                   	push   %edi
+  802b4b:	e8 53 e1 ff ff       	call   800ca3 <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  802b50:	01 de                	add    %ebx,%esi
+  802b52:	83 c4 10             	add    $0x10,%esp
+  802b55:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802b58:	72 cd                	jb     802b27 <devcons_write+0x19>
+}
+  802b5a:	89 f0                	mov    %esi,%eax
+  802b5c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b5f:	5b                   	pop    %ebx
+  802b60:	5e                   	pop    %esi
+  802b61:	5f                   	pop    %edi
+  802b62:	5d                   	pop    %ebp
+  802b63:	c3                   	ret
+
+00802b64 <devcons_read>:
+{
+  802b64:	55                   	push   %ebp
+  802b65:	89 e5                	mov    %esp,%ebp
+  802b67:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  802b6a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b6f:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802b73:	75 07                	jne    802b7c <devcons_read+0x18>
+  802b75:	eb 1f                	jmp    802b96 <devcons_read+0x32>
+    sys_yield();
+  802b77:	e8 c4 e1 ff ff       	call   800d40 <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  802b7c:	e8 40 e1 ff ff       	call   800cc1 <sys_cgetc>
+  802b81:	85 c0                	test   %eax,%eax
+  802b83:	74 f2                	je     802b77 <devcons_read+0x13>
+  if (c < 0)
+  802b85:	78 0f                	js     802b96 <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  802b87:	83 f8 04             	cmp    $0x4,%eax
+  802b8a:	74 0c                	je     802b98 <devcons_read+0x34>
+  *(char*)vbuf = c;
+  802b8c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802b8f:	88 02                	mov    %al,(%edx)
+  return 1;
+  802b91:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802b96:	c9                   	leave
+  802b97:	c3                   	ret
+    return 0;
+  802b98:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b9d:	eb f7                	jmp    802b96 <devcons_read+0x32>
+
+00802b9f <cputchar>:
+{
+  802b9f:	55                   	push   %ebp
+  802ba0:	89 e5                	mov    %esp,%ebp
+  802ba2:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  802ba5:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ba8:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  802bab:	6a 01                	push   $0x1
+  802bad:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802bb0:	50                   	push   %eax
+  802bb1:	e8 ed e0 ff ff       	call   800ca3 <sys_cputs>
+}
+  802bb6:	83 c4 10             	add    $0x10,%esp
+  802bb9:	c9                   	leave
+  802bba:	c3                   	ret
+
+00802bbb <getchar>:
+{
+  802bbb:	55                   	push   %ebp
+  802bbc:	89 e5                	mov    %esp,%ebp
+  802bbe:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  802bc1:	6a 01                	push   $0x1
+  802bc3:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802bc6:	50                   	push   %eax
+  802bc7:	6a 00                	push   $0x0
+  802bc9:	e8 a8 e9 ff ff       	call   801576 <read>
+  if (r < 0)
+  802bce:	83 c4 10             	add    $0x10,%esp
+  802bd1:	85 c0                	test   %eax,%eax
+  802bd3:	78 06                	js     802bdb <getchar+0x20>
+  if (r < 1)
+  802bd5:	74 06                	je     802bdd <getchar+0x22>
+  return c;
+  802bd7:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802bdb:	c9                   	leave
+  802bdc:	c3                   	ret
+    return -E_EOF;
+  802bdd:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802be2:	eb f7                	jmp    802bdb <getchar+0x20>
+
+00802be4 <iscons>:
+{
+  802be4:	55                   	push   %ebp
+  802be5:	89 e5                	mov    %esp,%ebp
+  802be7:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802bea:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802bed:	50                   	push   %eax
+  802bee:	ff 75 08             	push   0x8(%ebp)
+  802bf1:	e8 d5 e6 ff ff       	call   8012cb <fd_lookup>
+  802bf6:	83 c4 10             	add    $0x10,%esp
+  802bf9:	85 c0                	test   %eax,%eax
+  802bfb:	78 11                	js     802c0e <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  802bfd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c00:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802c06:	39 10                	cmp    %edx,(%eax)
+  802c08:	0f 94 c0             	sete   %al
+  802c0b:	0f b6 c0             	movzbl %al,%eax
+}
+  802c0e:	c9                   	leave
+  802c0f:	c3                   	ret
+
+00802c10 <opencons>:
+{
+  802c10:	55                   	push   %ebp
+  802c11:	89 e5                	mov    %esp,%ebp
+  802c13:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  802c16:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802c19:	50                   	push   %eax
+  802c1a:	e8 56 e6 ff ff       	call   801275 <fd_alloc>
+  802c1f:	83 c4 10             	add    $0x10,%esp
+  802c22:	85 c0                	test   %eax,%eax
+  802c24:	78 3a                	js     802c60 <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802c26:	83 ec 04             	sub    $0x4,%esp
+  802c29:	68 07 04 00 00       	push   $0x407
+  802c2e:	ff 75 f4             	push   -0xc(%ebp)
+  802c31:	6a 00                	push   $0x0
+  802c33:	e8 6a e1 ff ff       	call   800da2 <sys_page_alloc>
+  802c38:	83 c4 10             	add    $0x10,%esp
+  802c3b:	85 c0                	test   %eax,%eax
+  802c3d:	78 21                	js     802c60 <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  802c3f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c42:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802c48:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  802c4a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c4d:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  802c54:	83 ec 0c             	sub    $0xc,%esp
+  802c57:	50                   	push   %eax
+  802c58:	e8 f4 e5 ff ff       	call   801251 <fd2num>
+  802c5d:	83 c4 10             	add    $0x10,%esp
+}
+  802c60:	c9                   	leave
+  802c61:	c3                   	ret
+
+00802c62 <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  802c62:	55                   	push   %ebp
+  802c63:	89 e5                	mov    %esp,%ebp
+  802c65:	57                   	push   %edi
+  802c66:	56                   	push   %esi
+  802c67:	53                   	push   %ebx
+  802c68:	83 ec 14             	sub    $0x14,%esp
+  802c6b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802c6e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c71:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802c74:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  802c77:	85 c0                	test   %eax,%eax
+  802c79:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802c7e:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  802c81:	ff 33                	push   (%ebx)
+  802c83:	50                   	push   %eax
+  802c84:	e8 f1 e3 ff ff       	call   80107a <sys_ipc_recv>
+  802c89:	83 c4 10             	add    $0x10,%esp
+  802c8c:	85 c0                	test   %eax,%eax
+  802c8e:	78 39                	js     802cc9 <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  802c90:	85 ff                	test   %edi,%edi
+  802c92:	74 0a                	je     802c9e <ipc_recv_pages+0x3c>
+  802c94:	a1 44 67 80 00       	mov    0x806744,%eax
+  802c99:	8b 40 7c             	mov    0x7c(%eax),%eax
+  802c9c:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  802c9e:	85 f6                	test   %esi,%esi
+  802ca0:	74 0d                	je     802caf <ipc_recv_pages+0x4d>
+  802ca2:	a1 44 67 80 00       	mov    0x806744,%eax
+  802ca7:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  802cad:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  802caf:	a1 44 67 80 00       	mov    0x806744,%eax
+  802cb4:	8b 40 74             	mov    0x74(%eax),%eax
+  802cb7:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  802cb9:	a1 44 67 80 00       	mov    0x806744,%eax
+  802cbe:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  802cc1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802cc4:	5b                   	pop    %ebx
+  802cc5:	5e                   	pop    %esi
+  802cc6:	5f                   	pop    %edi
+  802cc7:	5d                   	pop    %ebp
+  802cc8:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  802cc9:	85 ff                	test   %edi,%edi
+  802ccb:	74 06                	je     802cd3 <ipc_recv_pages+0x71>
+  802ccd:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  802cd3:	85 f6                	test   %esi,%esi
+  802cd5:	74 06                	je     802cdd <ipc_recv_pages+0x7b>
+  802cd7:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  802cdd:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  802ce3:	eb dc                	jmp    802cc1 <ipc_recv_pages+0x5f>
+
+00802ce5 <ipc_recv>:
+{
+  802ce5:	55                   	push   %ebp
+  802ce6:	89 e5                	mov    %esp,%ebp
+  802ce8:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  802ceb:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  802cf2:	ff 75 10             	push   0x10(%ebp)
+  802cf5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802cf8:	50                   	push   %eax
+  802cf9:	ff 75 0c             	push   0xc(%ebp)
+  802cfc:	ff 75 08             	push   0x8(%ebp)
+  802cff:	e8 5e ff ff ff       	call   802c62 <ipc_recv_pages>
+}
+  802d04:	c9                   	leave
+  802d05:	c3                   	ret
+
+00802d06 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  802d06:	55                   	push   %ebp
+  802d07:	89 e5                	mov    %esp,%ebp
+  802d09:	57                   	push   %edi
+  802d0a:	56                   	push   %esi
+  802d0b:	53                   	push   %ebx
+  802d0c:	83 ec 0c             	sub    $0xc,%esp
+  802d0f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802d12:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802d15:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  802d18:	89 c3                	mov    %eax,%ebx
+  802d1a:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  802d20:	85 c0                	test   %eax,%eax
+  802d22:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802d27:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  802d2a:	83 ec 0c             	sub    $0xc,%esp
+  802d2d:	ff 75 14             	push   0x14(%ebp)
+  802d30:	ff 75 18             	push   0x18(%ebp)
+  802d33:	53                   	push   %ebx
+  802d34:	56                   	push   %esi
+  802d35:	57                   	push   %edi
+  802d36:	e8 1e e3 ff ff       	call   801059 <sys_ipc_try_send>
+  802d3b:	83 c4 20             	add    $0x20,%esp
+  802d3e:	85 c0                	test   %eax,%eax
+  802d40:	79 1e                	jns    802d60 <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  802d42:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802d45:	75 07                	jne    802d4e <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  802d47:	e8 f4 df ff ff       	call   800d40 <sys_yield>
+  802d4c:	eb dc                	jmp    802d2a <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  802d4e:	50                   	push   %eax
+  802d4f:	68 b3 35 80 00       	push   $0x8035b3
+  802d54:	6a 5c                	push   $0x5c
+  802d56:	68 c0 35 80 00       	push   $0x8035c0
+  802d5b:	e8 4a d5 ff ff       	call   8002aa <_panic>
+  }
+}
+  802d60:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d63:	5b                   	pop    %ebx
+  802d64:	5e                   	pop    %esi
+  802d65:	5f                   	pop    %edi
+  802d66:	5d                   	pop    %ebp
+  802d67:	c3                   	ret
+
+00802d68 <ipc_send>:
+{
+  802d68:	55                   	push   %ebp
+  802d69:	89 e5                	mov    %esp,%ebp
+  802d6b:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  802d6e:	ff 75 14             	push   0x14(%ebp)
+  802d71:	6a 01                	push   $0x1
+  802d73:	ff 75 10             	push   0x10(%ebp)
+  802d76:	ff 75 0c             	push   0xc(%ebp)
+  802d79:	ff 75 08             	push   0x8(%ebp)
+  802d7c:	e8 85 ff ff ff       	call   802d06 <ipc_send_pages>
+}
+  802d81:	83 c4 20             	add    $0x20,%esp
+  802d84:	c9                   	leave
+  802d85:	c3                   	ret
+
+00802d86 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802d86:	55                   	push   %ebp
+  802d87:	89 e5                	mov    %esp,%ebp
+  802d89:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  802d8c:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  802d91:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802d94:	c1 e0 04             	shl    $0x4,%eax
+  802d97:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802d9c:	8b 40 50             	mov    0x50(%eax),%eax
+  802d9f:	39 c8                	cmp    %ecx,%eax
+  802da1:	74 12                	je     802db5 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  802da3:	83 c2 01             	add    $0x1,%edx
+  802da6:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802dac:	75 e3                	jne    802d91 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  802dae:	b8 00 00 00 00       	mov    $0x0,%eax
+  802db3:	eb 0e                	jmp    802dc3 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  802db5:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802db8:	c1 e0 04             	shl    $0x4,%eax
+  802dbb:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802dc0:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802dc3:	5d                   	pop    %ebp
+  802dc4:	c3                   	ret
+
+00802dc5 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802dc5:	55                   	push   %ebp
+  802dc6:	89 e5                	mov    %esp,%ebp
+  802dc8:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802dcb:	89 c2                	mov    %eax,%edx
+  802dcd:	c1 ea 16             	shr    $0x16,%edx
+  802dd0:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  802dd7:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802ddc:	f6 c1 01             	test   $0x1,%cl
+  802ddf:	74 1c                	je     802dfd <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  802de1:	c1 e8 0c             	shr    $0xc,%eax
+  802de4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  802deb:	a8 01                	test   $0x1,%al
+  802ded:	74 0e                	je     802dfd <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  802def:	c1 e8 0c             	shr    $0xc,%eax
+  802df2:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802df9:	ef 
+  802dfa:	0f b7 d2             	movzwl %dx,%edx
+}
+  802dfd:	89 d0                	mov    %edx,%eax
+  802dff:	5d                   	pop    %ebp
+  802e00:	c3                   	ret
+
+00802e01 <udivmod>:
+  802e01:	55                   	push   %ebp
+  802e02:	57                   	push   %edi
+  802e03:	56                   	push   %esi
+  802e04:	53                   	push   %ebx
+  802e05:	83 ec 14             	sub    $0x14,%esp
+  802e08:	8b 74 24 28          	mov    0x28(%esp),%esi
+  802e0c:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  802e10:	89 fb                	mov    %edi,%ebx
+  802e12:	09 f3                	or     %esi,%ebx
+  802e14:	0f 84 88 00 00 00    	je     802ea2 <udivmod+0xa1>
+  802e1a:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802e1f:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802e26:	00 
+  802e27:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802e2e:	00 
+  802e2f:	89 cd                	mov    %ecx,%ebp
+  802e31:	89 34 24             	mov    %esi,(%esp)
+  802e34:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802e38:	eb 08                	jmp    802e42 <udivmod+0x41>
+  802e3a:	83 ed 01             	sub    $0x1,%ebp
+  802e3d:	83 fd ff             	cmp    $0xffffffff,%ebp
+  802e40:	74 6c                	je     802eae <udivmod+0xad>
+  802e42:	89 c3                	mov    %eax,%ebx
+  802e44:	89 d6                	mov    %edx,%esi
+  802e46:	89 e9                	mov    %ebp,%ecx
+  802e48:	0f ad f3             	shrd   %cl,%esi,%ebx
+  802e4b:	d3 ee                	shr    %cl,%esi
+  802e4d:	f6 c1 20             	test   $0x20,%cl
+  802e50:	74 04                	je     802e56 <udivmod+0x55>
+  802e52:	89 f3                	mov    %esi,%ebx
+  802e54:	31 f6                	xor    %esi,%esi
+  802e56:	8b 3c 24             	mov    (%esp),%edi
+  802e59:	39 fb                	cmp    %edi,%ebx
+  802e5b:	89 f7                	mov    %esi,%edi
+  802e5d:	8b 1c 24             	mov    (%esp),%ebx
+  802e60:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802e64:	19 f7                	sbb    %esi,%edi
+  802e66:	72 d2                	jb     802e3a <udivmod+0x39>
+  802e68:	89 f7                	mov    %esi,%edi
+  802e6a:	89 de                	mov    %ebx,%esi
+  802e6c:	89 e9                	mov    %ebp,%ecx
+  802e6e:	0f a5 f7             	shld   %cl,%esi,%edi
+  802e71:	d3 e6                	shl    %cl,%esi
+  802e73:	f6 c1 20             	test   $0x20,%cl
+  802e76:	74 04                	je     802e7c <udivmod+0x7b>
+  802e78:	89 f7                	mov    %esi,%edi
+  802e7a:	31 f6                	xor    %esi,%esi
+  802e7c:	29 f0                	sub    %esi,%eax
+  802e7e:	19 fa                	sbb    %edi,%edx
+  802e80:	be 01 00 00 00       	mov    $0x1,%esi
+  802e85:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e8a:	0f a5 f7             	shld   %cl,%esi,%edi
+  802e8d:	d3 e6                	shl    %cl,%esi
+  802e8f:	f6 c1 20             	test   $0x20,%cl
+  802e92:	74 04                	je     802e98 <udivmod+0x97>
+  802e94:	89 f7                	mov    %esi,%edi
+  802e96:	31 f6                	xor    %esi,%esi
+  802e98:	09 74 24 08          	or     %esi,0x8(%esp)
+  802e9c:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802ea0:	eb 98                	jmp    802e3a <udivmod+0x39>
+  802ea2:	89 f0                	mov    %esi,%eax
+  802ea4:	89 fa                	mov    %edi,%edx
+  802ea6:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802eaa:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802eae:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802eb2:	89 01                	mov    %eax,(%ecx)
+  802eb4:	89 51 04             	mov    %edx,0x4(%ecx)
+  802eb7:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802ebb:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802ebf:	83 c4 14             	add    $0x14,%esp
+  802ec2:	5b                   	pop    %ebx
+  802ec3:	5e                   	pop    %esi
+  802ec4:	5f                   	pop    %edi
+  802ec5:	5d                   	pop    %ebp
+  802ec6:	c3                   	ret
+
+00802ec7 <__udivdi3>:
+  802ec7:	83 ec 18             	sub    $0x18,%esp
+  802eca:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802ece:	50                   	push   %eax
+  802ecf:	ff 74 24 2c          	push   0x2c(%esp)
+  802ed3:	ff 74 24 2c          	push   0x2c(%esp)
+  802ed7:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802edb:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802edf:	e8 1d ff ff ff       	call   802e01 <udivmod>
+  802ee4:	83 c4 24             	add    $0x24,%esp
+  802ee7:	c3                   	ret
+
+00802ee8 <__umoddi3>:
+  802ee8:	83 ec 18             	sub    $0x18,%esp
+  802eeb:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802eef:	50                   	push   %eax
+  802ef0:	ff 74 24 2c          	push   0x2c(%esp)
+  802ef4:	ff 74 24 2c          	push   0x2c(%esp)
+  802ef8:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802efc:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802f00:	e8 fc fe ff ff       	call   802e01 <udivmod>
+  802f05:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802f09:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802f0d:	83 c4 24             	add    $0x24,%esp
+  802f10:	c3                   	ret
+
+00802f11 <__divdi3>:
+  802f11:	56                   	push   %esi
+  802f12:	53                   	push   %ebx
+  802f13:	83 ec 14             	sub    $0x14,%esp
+  802f16:	8b 44 24 20          	mov    0x20(%esp),%eax
+  802f1a:	8b 54 24 24          	mov    0x24(%esp),%edx
+  802f1e:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  802f22:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  802f26:	85 d2                	test   %edx,%edx
+  802f28:	78 18                	js     802f42 <__divdi3+0x31>
+  802f2a:	85 db                	test   %ebx,%ebx
+  802f2c:	78 3e                	js     802f6c <__divdi3+0x5b>
+  802f2e:	83 ec 04             	sub    $0x4,%esp
+  802f31:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802f35:	56                   	push   %esi
+  802f36:	53                   	push   %ebx
+  802f37:	51                   	push   %ecx
+  802f38:	e8 c4 fe ff ff       	call   802e01 <udivmod>
+  802f3d:	83 c4 10             	add    $0x10,%esp
+  802f40:	eb 24                	jmp    802f66 <__divdi3+0x55>
+  802f42:	f7 d8                	neg    %eax
+  802f44:	83 d2 00             	adc    $0x0,%edx
+  802f47:	f7 da                	neg    %edx
+  802f49:	85 db                	test   %ebx,%ebx
+  802f4b:	78 3a                	js     802f87 <__divdi3+0x76>
+  802f4d:	83 ec 04             	sub    $0x4,%esp
+  802f50:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802f54:	56                   	push   %esi
+  802f55:	53                   	push   %ebx
+  802f56:	51                   	push   %ecx
+  802f57:	e8 a5 fe ff ff       	call   802e01 <udivmod>
+  802f5c:	83 c4 10             	add    $0x10,%esp
+  802f5f:	f7 d8                	neg    %eax
+  802f61:	83 d2 00             	adc    $0x0,%edx
+  802f64:	f7 da                	neg    %edx
+  802f66:	83 c4 14             	add    $0x14,%esp
+  802f69:	5b                   	pop    %ebx
+  802f6a:	5e                   	pop    %esi
+  802f6b:	c3                   	ret
+  802f6c:	83 ec 04             	sub    $0x4,%esp
+  802f6f:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802f73:	56                   	push   %esi
+  802f74:	f7 d9                	neg    %ecx
+  802f76:	83 d3 00             	adc    $0x0,%ebx
+  802f79:	f7 db                	neg    %ebx
+  802f7b:	53                   	push   %ebx
+  802f7c:	51                   	push   %ecx
+  802f7d:	e8 7f fe ff ff       	call   802e01 <udivmod>
+  802f82:	83 c4 10             	add    $0x10,%esp
+  802f85:	eb d8                	jmp    802f5f <__divdi3+0x4e>
+  802f87:	83 ec 04             	sub    $0x4,%esp
+  802f8a:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802f8e:	56                   	push   %esi
+  802f8f:	f7 d9                	neg    %ecx
+  802f91:	83 d3 00             	adc    $0x0,%ebx
+  802f94:	f7 db                	neg    %ebx
+  802f96:	53                   	push   %ebx
+  802f97:	51                   	push   %ecx
+  802f98:	e8 64 fe ff ff       	call   802e01 <udivmod>
+  802f9d:	83 c4 10             	add    $0x10,%esp
+  802fa0:	eb c4                	jmp    802f66 <__divdi3+0x55>
+
+00802fa2 <__moddi3>:
+  802fa2:	55                   	push   %ebp
+  802fa3:	57                   	push   %edi
+  802fa4:	56                   	push   %esi
+  802fa5:	53                   	push   %ebx
+  802fa6:	83 ec 24             	sub    $0x24,%esp
+  802fa9:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802fad:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802fb1:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  802fb5:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  802fb9:	85 d2                	test   %edx,%edx
+  802fbb:	78 3b                	js     802ff8 <__moddi3+0x56>
+  802fbd:	83 ec 04             	sub    $0x4,%esp
+  802fc0:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  802fc4:	56                   	push   %esi
+  802fc5:	89 ce                	mov    %ecx,%esi
+  802fc7:	f7 de                	neg    %esi
+  802fc9:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802fcd:	89 de                	mov    %ebx,%esi
+  802fcf:	83 d6 00             	adc    $0x0,%esi
+  802fd2:	f7 de                	neg    %esi
+  802fd4:	89 74 24 14          	mov    %esi,0x14(%esp)
+  802fd8:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802fdc:	0f 48 f1             	cmovs  %ecx,%esi
+  802fdf:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  802fe4:	53                   	push   %ebx
+  802fe5:	56                   	push   %esi
+  802fe6:	e8 16 fe ff ff       	call   802e01 <udivmod>
+  802feb:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802fef:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802ff3:	83 c4 10             	add    $0x10,%esp
+  802ff6:	eb 47                	jmp    80303f <__moddi3+0x9d>
+  802ff8:	f7 d8                	neg    %eax
+  802ffa:	83 d2 00             	adc    $0x0,%edx
+  802ffd:	f7 da                	neg    %edx
+  802fff:	83 ec 04             	sub    $0x4,%esp
+  803002:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803006:	56                   	push   %esi
+  803007:	89 cf                	mov    %ecx,%edi
+  803009:	f7 df                	neg    %edi
+  80300b:	89 de                	mov    %ebx,%esi
+  80300d:	83 d6 00             	adc    $0x0,%esi
+  803010:	f7 de                	neg    %esi
+  803012:	0f 49 cf             	cmovns %edi,%ecx
+  803015:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  803019:	0f 49 de             	cmovns %esi,%ebx
+  80301c:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  803020:	ff 74 24 0c          	push   0xc(%esp)
+  803024:	ff 74 24 0c          	push   0xc(%esp)
+  803028:	e8 d4 fd ff ff       	call   802e01 <udivmod>
+  80302d:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803031:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803035:	f7 d8                	neg    %eax
+  803037:	83 d2 00             	adc    $0x0,%edx
+  80303a:	f7 da                	neg    %edx
+  80303c:	83 c4 10             	add    $0x10,%esp
+  80303f:	83 c4 24             	add    $0x24,%esp
+  803042:	5b                   	pop    %ebx
+  803043:	5e                   	pop    %esi
+  803044:	5f                   	pop    %edi
+  803045:	5d                   	pop    %ebp
+  803046:	c3                   	ret
@@ -0,0 +1,6526 @@
+
+obj/user/faultalloc.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 99 00 00 00       	call   8000ca <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <handler>:
+
+#include <inc/lib.h>
+
+void
+handler(struct UTrapframe *utf)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 0c             	sub    $0xc,%esp
+  int r;
+  void *addr = (void*)utf->utf_fault_va;
+  80003a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80003d:	8b 18                	mov    (%eax),%ebx
+
+  cprintf("fault %x\n", addr);
+  80003f:	53                   	push   %ebx
+  800040:	68 60 2f 80 00       	push   $0x802f60
+  800045:	e8 c8 01 00 00       	call   800212 <cprintf>
+  if ((r = sys_page_alloc(0, ROUNDDOWN(addr, PGSIZE),
+  80004a:	83 c4 0c             	add    $0xc,%esp
+  80004d:	6a 07                	push   $0x7
+  80004f:	89 d8                	mov    %ebx,%eax
+  800051:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800056:	50                   	push   %eax
+  800057:	6a 00                	push   $0x0
+  800059:	e8 d1 0b 00 00       	call   800c2f <sys_page_alloc>
+  80005e:	83 c4 10             	add    $0x10,%esp
+  800061:	85 c0                	test   %eax,%eax
+  800063:	78 16                	js     80007b <handler+0x48>
+                          PTE_P|PTE_U|PTE_W)) < 0)
+    panic("allocating at %x in page fault handler: %e", addr, r);
+  snprintf((char*)addr, 100, "this string was faulted in at %x", addr);
+  800065:	53                   	push   %ebx
+  800066:	68 ac 2f 80 00       	push   $0x802fac
+  80006b:	6a 64                	push   $0x64
+  80006d:	53                   	push   %ebx
+  80006e:	e8 38 07 00 00       	call   8007ab <snprintf>
+}
+  800073:	83 c4 10             	add    $0x10,%esp
+  800076:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800079:	c9                   	leave
+  80007a:	c3                   	ret
+    panic("allocating at %x in page fault handler: %e", addr, r);
+  80007b:	83 ec 0c             	sub    $0xc,%esp
+  80007e:	50                   	push   %eax
+  80007f:	53                   	push   %ebx
+  800080:	68 80 2f 80 00       	push   $0x802f80
+  800085:	6a 0e                	push   $0xe
+  800087:	68 6a 2f 80 00       	push   $0x802f6a
+  80008c:	e8 a6 00 00 00       	call   800137 <_panic>
+
+00800091 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800091:	55                   	push   %ebp
+  800092:	89 e5                	mov    %esp,%ebp
+  800094:	83 ec 14             	sub    $0x14,%esp
+  set_pgfault_handler(handler);
+  800097:	68 33 00 80 00       	push   $0x800033
+  80009c:	e8 3d 10 00 00       	call   8010de <set_pgfault_handler>
+  cprintf("%s\n", (char*)0xDeadBeef);
+  8000a1:	83 c4 08             	add    $0x8,%esp
+  8000a4:	68 ef be ad de       	push   $0xdeadbeef
+  8000a9:	68 7c 2f 80 00       	push   $0x802f7c
+  8000ae:	e8 5f 01 00 00       	call   800212 <cprintf>
+  cprintf("%s\n", (char*)0xCafeBffe);
+  8000b3:	83 c4 08             	add    $0x8,%esp
+  8000b6:	68 fe bf fe ca       	push   $0xcafebffe
+  8000bb:	68 7c 2f 80 00       	push   $0x802f7c
+  8000c0:	e8 4d 01 00 00       	call   800212 <cprintf>
+}
+  8000c5:	83 c4 10             	add    $0x10,%esp
+  8000c8:	c9                   	leave
+  8000c9:	c3                   	ret
+
+008000ca <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000ca:	55                   	push   %ebp
+  8000cb:	89 e5                	mov    %esp,%ebp
+  8000cd:	56                   	push   %esi
+  8000ce:	53                   	push   %ebx
+  8000cf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000d2:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  8000d5:	c7 05 44 57 80 00 00 	movl   $0x0,0x805744
+  8000dc:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  8000df:	e8 ca 0a 00 00       	call   800bae <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  8000e4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000e9:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8000ec:	c1 e0 04             	shl    $0x4,%eax
+  8000ef:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000f4:	a3 44 57 80 00       	mov    %eax,0x805744
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8000f9:	85 db                	test   %ebx,%ebx
+  8000fb:	7e 07                	jle    800104 <libmain+0x3a>
+    binaryname = argv[0];
+  8000fd:	8b 06                	mov    (%esi),%eax
+  8000ff:	a3 00 40 80 00       	mov    %eax,0x804000
+
+  // call user main routine
+  umain(argc, argv);
+  800104:	83 ec 08             	sub    $0x8,%esp
+  800107:	56                   	push   %esi
+  800108:	53                   	push   %ebx
+  800109:	e8 83 ff ff ff       	call   800091 <umain>
+
+  // exit gracefully
+  exit();
+  80010e:	e8 0a 00 00 00       	call   80011d <exit>
+}
+  800113:	83 c4 10             	add    $0x10,%esp
+  800116:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800119:	5b                   	pop    %ebx
+  80011a:	5e                   	pop    %esi
+  80011b:	5d                   	pop    %ebp
+  80011c:	c3                   	ret
+
+0080011d <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80011d:	55                   	push   %ebp
+  80011e:	89 e5                	mov    %esp,%ebp
+  800120:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  800123:	e8 ed 11 00 00       	call   801315 <close_all>
+  sys_env_destroy(0);
+  800128:	83 ec 0c             	sub    $0xc,%esp
+  80012b:	6a 00                	push   $0x0
+  80012d:	e8 3b 0a 00 00       	call   800b6d <sys_env_destroy>
+}
+  800132:	83 c4 10             	add    $0x10,%esp
+  800135:	c9                   	leave
+  800136:	c3                   	ret
+
+00800137 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800137:	55                   	push   %ebp
+  800138:	89 e5                	mov    %esp,%ebp
+  80013a:	56                   	push   %esi
+  80013b:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  80013c:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  80013f:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  800145:	e8 64 0a 00 00       	call   800bae <sys_getenvid>
+  80014a:	83 ec 0c             	sub    $0xc,%esp
+  80014d:	ff 75 0c             	push   0xc(%ebp)
+  800150:	ff 75 08             	push   0x8(%ebp)
+  800153:	56                   	push   %esi
+  800154:	50                   	push   %eax
+  800155:	68 d8 2f 80 00       	push   $0x802fd8
+  80015a:	e8 b3 00 00 00       	call   800212 <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  80015f:	83 c4 18             	add    $0x18,%esp
+  800162:	53                   	push   %ebx
+  800163:	ff 75 10             	push   0x10(%ebp)
+  800166:	e8 56 00 00 00       	call   8001c1 <vcprintf>
+  cprintf("\n");
+  80016b:	c7 04 24 40 34 80 00 	movl   $0x803440,(%esp)
+  800172:	e8 9b 00 00 00       	call   800212 <cprintf>
+  800177:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  80017a:	cc                   	int3
+  while (1)
+  80017b:	eb fd                	jmp    80017a <_panic+0x43>
+
+0080017d <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80017d:	55                   	push   %ebp
+  80017e:	89 e5                	mov    %esp,%ebp
+  800180:	53                   	push   %ebx
+  800181:	83 ec 04             	sub    $0x4,%esp
+  800184:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  800187:	8b 13                	mov    (%ebx),%edx
+  800189:	8d 42 01             	lea    0x1(%edx),%eax
+  80018c:	89 03                	mov    %eax,(%ebx)
+  80018e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800191:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  800195:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80019a:	74 09                	je     8001a5 <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  80019c:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8001a0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001a3:	c9                   	leave
+  8001a4:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  8001a5:	83 ec 08             	sub    $0x8,%esp
+  8001a8:	68 ff 00 00 00       	push   $0xff
+  8001ad:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001b0:	50                   	push   %eax
+  8001b1:	e8 7a 09 00 00       	call   800b30 <sys_cputs>
+    b->idx = 0;
+  8001b6:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001bc:	83 c4 10             	add    $0x10,%esp
+  8001bf:	eb db                	jmp    80019c <putch+0x1f>
+
+008001c1 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001c1:	55                   	push   %ebp
+  8001c2:	89 e5                	mov    %esp,%ebp
+  8001c4:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  8001ca:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001d1:	00 00 00 
+  b.cnt = 0;
+  8001d4:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001db:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  8001de:	ff 75 0c             	push   0xc(%ebp)
+  8001e1:	ff 75 08             	push   0x8(%ebp)
+  8001e4:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001ea:	50                   	push   %eax
+  8001eb:	68 7d 01 80 00       	push   $0x80017d
+  8001f0:	e8 14 01 00 00       	call   800309 <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  8001f5:	83 c4 08             	add    $0x8,%esp
+  8001f8:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001fe:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800204:	50                   	push   %eax
+  800205:	e8 26 09 00 00       	call   800b30 <sys_cputs>
+
+  return b.cnt;
+}
+  80020a:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800210:	c9                   	leave
+  800211:	c3                   	ret
+
+00800212 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800212:	55                   	push   %ebp
+  800213:	89 e5                	mov    %esp,%ebp
+  800215:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  800218:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  80021b:	50                   	push   %eax
+  80021c:	ff 75 08             	push   0x8(%ebp)
+  80021f:	e8 9d ff ff ff       	call   8001c1 <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  800224:	c9                   	leave
+  800225:	c3                   	ret
+
+00800226 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  800226:	55                   	push   %ebp
+  800227:	89 e5                	mov    %esp,%ebp
+  800229:	57                   	push   %edi
+  80022a:	56                   	push   %esi
+  80022b:	53                   	push   %ebx
+  80022c:	83 ec 1c             	sub    $0x1c,%esp
+  80022f:	89 c7                	mov    %eax,%edi
+  800231:	89 d6                	mov    %edx,%esi
+  800233:	8b 45 08             	mov    0x8(%ebp),%eax
+  800236:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800239:	89 d1                	mov    %edx,%ecx
+  80023b:	89 c2                	mov    %eax,%edx
+  80023d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800240:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800243:	8b 45 10             	mov    0x10(%ebp),%eax
+  800246:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  800249:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80024c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800253:	39 c2                	cmp    %eax,%edx
+  800255:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800258:	72 3e                	jb     800298 <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  80025a:	83 ec 0c             	sub    $0xc,%esp
+  80025d:	ff 75 18             	push   0x18(%ebp)
+  800260:	83 eb 01             	sub    $0x1,%ebx
+  800263:	53                   	push   %ebx
+  800264:	50                   	push   %eax
+  800265:	83 ec 08             	sub    $0x8,%esp
+  800268:	ff 75 e4             	push   -0x1c(%ebp)
+  80026b:	ff 75 e0             	push   -0x20(%ebp)
+  80026e:	ff 75 dc             	push   -0x24(%ebp)
+  800271:	ff 75 d8             	push   -0x28(%ebp)
+  800274:	e8 48 2b 00 00       	call   802dc1 <__udivdi3>
+  800279:	83 c4 18             	add    $0x18,%esp
+  80027c:	52                   	push   %edx
+  80027d:	50                   	push   %eax
+  80027e:	89 f2                	mov    %esi,%edx
+  800280:	89 f8                	mov    %edi,%eax
+  800282:	e8 9f ff ff ff       	call   800226 <printnum>
+  800287:	83 c4 20             	add    $0x20,%esp
+  80028a:	eb 13                	jmp    80029f <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  80028c:	83 ec 08             	sub    $0x8,%esp
+  80028f:	56                   	push   %esi
+  800290:	ff 75 18             	push   0x18(%ebp)
+  800293:	ff d7                	call   *%edi
+  800295:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  800298:	83 eb 01             	sub    $0x1,%ebx
+  80029b:	85 db                	test   %ebx,%ebx
+  80029d:	7f ed                	jg     80028c <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  80029f:	83 ec 08             	sub    $0x8,%esp
+  8002a2:	56                   	push   %esi
+  8002a3:	83 ec 04             	sub    $0x4,%esp
+  8002a6:	ff 75 e4             	push   -0x1c(%ebp)
+  8002a9:	ff 75 e0             	push   -0x20(%ebp)
+  8002ac:	ff 75 dc             	push   -0x24(%ebp)
+  8002af:	ff 75 d8             	push   -0x28(%ebp)
+  8002b2:	e8 2b 2b 00 00       	call   802de2 <__umoddi3>
+  8002b7:	83 c4 14             	add    $0x14,%esp
+  8002ba:	0f be 80 fb 2f 80 00 	movsbl 0x802ffb(%eax),%eax
+  8002c1:	50                   	push   %eax
+  8002c2:	ff d7                	call   *%edi
+}
+  8002c4:	83 c4 10             	add    $0x10,%esp
+  8002c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002ca:	5b                   	pop    %ebx
+  8002cb:	5e                   	pop    %esi
+  8002cc:	5f                   	pop    %edi
+  8002cd:	5d                   	pop    %ebp
+  8002ce:	c3                   	ret
+
+008002cf <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002cf:	55                   	push   %ebp
+  8002d0:	89 e5                	mov    %esp,%ebp
+  8002d2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  8002d5:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  8002d9:	8b 10                	mov    (%eax),%edx
+  8002db:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002de:	73 0a                	jae    8002ea <sprintputch+0x1b>
+    *b->buf++ = ch;
+  8002e0:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002e3:	89 08                	mov    %ecx,(%eax)
+  8002e5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002e8:	88 02                	mov    %al,(%edx)
+}
+  8002ea:	5d                   	pop    %ebp
+  8002eb:	c3                   	ret
+
+008002ec <printfmt>:
+{
+  8002ec:	55                   	push   %ebp
+  8002ed:	89 e5                	mov    %esp,%ebp
+  8002ef:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  8002f2:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  8002f5:	50                   	push   %eax
+  8002f6:	ff 75 10             	push   0x10(%ebp)
+  8002f9:	ff 75 0c             	push   0xc(%ebp)
+  8002fc:	ff 75 08             	push   0x8(%ebp)
+  8002ff:	e8 05 00 00 00       	call   800309 <vprintfmt>
+}
+  800304:	83 c4 10             	add    $0x10,%esp
+  800307:	c9                   	leave
+  800308:	c3                   	ret
+
+00800309 <vprintfmt>:
+{
+  800309:	55                   	push   %ebp
+  80030a:	89 e5                	mov    %esp,%ebp
+  80030c:	57                   	push   %edi
+  80030d:	56                   	push   %esi
+  80030e:	53                   	push   %ebx
+  80030f:	83 ec 2c             	sub    $0x2c,%esp
+  800312:	8b 75 08             	mov    0x8(%ebp),%esi
+  800315:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800318:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80031b:	eb 0a                	jmp    800327 <vprintfmt+0x1e>
+      putch(ch, putdat);
+  80031d:	83 ec 08             	sub    $0x8,%esp
+  800320:	53                   	push   %ebx
+  800321:	50                   	push   %eax
+  800322:	ff d6                	call   *%esi
+  800324:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  800327:	83 c7 01             	add    $0x1,%edi
+  80032a:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80032e:	83 f8 25             	cmp    $0x25,%eax
+  800331:	74 0c                	je     80033f <vprintfmt+0x36>
+      if (ch == '\0')
+  800333:	85 c0                	test   %eax,%eax
+  800335:	75 e6                	jne    80031d <vprintfmt+0x14>
+}
+  800337:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80033a:	5b                   	pop    %ebx
+  80033b:	5e                   	pop    %esi
+  80033c:	5f                   	pop    %edi
+  80033d:	5d                   	pop    %ebp
+  80033e:	c3                   	ret
+    padc = ' ';
+  80033f:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  800343:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  80034a:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  800351:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  800358:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  80035d:	8d 47 01             	lea    0x1(%edi),%eax
+  800360:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800363:	0f b6 17             	movzbl (%edi),%edx
+  800366:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800369:	3c 55                	cmp    $0x55,%al
+  80036b:	0f 87 cf 03 00 00    	ja     800740 <vprintfmt+0x437>
+  800371:	0f b6 c0             	movzbl %al,%eax
+  800374:	ff 24 85 40 31 80 00 	jmp    *0x803140(,%eax,4)
+  80037b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  80037e:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800382:	eb d9                	jmp    80035d <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  800384:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800387:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80038b:	eb d0                	jmp    80035d <vprintfmt+0x54>
+  80038d:	0f b6 d2             	movzbl %dl,%edx
+  800390:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  800393:	b8 00 00 00 00       	mov    $0x0,%eax
+  800398:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  80039b:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80039e:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  8003a2:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  8003a5:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8003a8:	83 f9 09             	cmp    $0x9,%ecx
+  8003ab:	77 55                	ja     800402 <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  8003ad:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  8003b0:	eb e9                	jmp    80039b <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  8003b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003b5:	8b 00                	mov    (%eax),%eax
+  8003b7:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003bd:	8d 40 04             	lea    0x4(%eax),%eax
+  8003c0:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  8003c3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  8003c6:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003ca:	79 91                	jns    80035d <vprintfmt+0x54>
+        width = precision, precision = -1;
+  8003cc:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003cf:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003d2:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003d9:	eb 82                	jmp    80035d <vprintfmt+0x54>
+      if (width < 0)
+  8003db:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8003de:	85 d2                	test   %edx,%edx
+  8003e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003e5:	0f 49 c2             	cmovns %edx,%eax
+  8003e8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  8003eb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  8003ee:	e9 6a ff ff ff       	jmp    80035d <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  8003f3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  8003f6:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  8003fd:	e9 5b ff ff ff       	jmp    80035d <vprintfmt+0x54>
+  800402:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800405:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800408:	eb bc                	jmp    8003c6 <vprintfmt+0xbd>
+      lflag++;
+  80040a:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  80040d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  800410:	e9 48 ff ff ff       	jmp    80035d <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  800415:	8b 45 14             	mov    0x14(%ebp),%eax
+  800418:	8d 78 04             	lea    0x4(%eax),%edi
+  80041b:	83 ec 08             	sub    $0x8,%esp
+  80041e:	53                   	push   %ebx
+  80041f:	ff 30                	push   (%eax)
+  800421:	ff d6                	call   *%esi
+      break;
+  800423:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  800426:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  800429:	e9 b1 02 00 00       	jmp    8006df <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  80042e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800431:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  800434:	8b 10                	mov    (%eax),%edx
+  800436:	89 d0                	mov    %edx,%eax
+  800438:	f7 d8                	neg    %eax
+  80043a:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80043d:	83 f8 10             	cmp    $0x10,%eax
+  800440:	7f 23                	jg     800465 <vprintfmt+0x15c>
+  800442:	8b 14 85 a0 32 80 00 	mov    0x8032a0(,%eax,4),%edx
+  800449:	85 d2                	test   %edx,%edx
+  80044b:	74 18                	je     800465 <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  80044d:	52                   	push   %edx
+  80044e:	68 ea 33 80 00       	push   $0x8033ea
+  800453:	53                   	push   %ebx
+  800454:	56                   	push   %esi
+  800455:	e8 92 fe ff ff       	call   8002ec <printfmt>
+  80045a:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  80045d:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800460:	e9 7a 02 00 00       	jmp    8006df <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  800465:	50                   	push   %eax
+  800466:	68 13 30 80 00       	push   $0x803013
+  80046b:	53                   	push   %ebx
+  80046c:	56                   	push   %esi
+  80046d:	e8 7a fe ff ff       	call   8002ec <printfmt>
+  800472:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  800475:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  800478:	e9 62 02 00 00       	jmp    8006df <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  80047d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800480:	83 c0 04             	add    $0x4,%eax
+  800483:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800486:	8b 45 14             	mov    0x14(%ebp),%eax
+  800489:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  80048b:	85 c9                	test   %ecx,%ecx
+  80048d:	b8 0c 30 80 00       	mov    $0x80300c,%eax
+  800492:	0f 45 c1             	cmovne %ecx,%eax
+  800495:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  800498:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80049c:	7e 06                	jle    8004a4 <vprintfmt+0x19b>
+  80049e:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8004a2:	75 0b                	jne    8004af <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8004a4:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8004a7:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8004aa:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004ad:	eb 5c                	jmp    80050b <vprintfmt+0x202>
+  8004af:	83 ec 08             	sub    $0x8,%esp
+  8004b2:	ff 75 d0             	push   -0x30(%ebp)
+  8004b5:	ff 75 cc             	push   -0x34(%ebp)
+  8004b8:	e8 20 03 00 00       	call   8007dd <strnlen>
+  8004bd:	89 c2                	mov    %eax,%edx
+  8004bf:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004c2:	29 d0                	sub    %edx,%eax
+  8004c4:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  8004c7:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8004cb:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004ce:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004d1:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8004d3:	eb 0e                	jmp    8004e3 <vprintfmt+0x1da>
+          putch(padc, putdat);
+  8004d5:	83 ec 08             	sub    $0x8,%esp
+  8004d8:	53                   	push   %ebx
+  8004d9:	57                   	push   %edi
+  8004da:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8004dd:	83 ee 01             	sub    $0x1,%esi
+  8004e0:	83 c4 10             	add    $0x10,%esp
+  8004e3:	85 f6                	test   %esi,%esi
+  8004e5:	7f ee                	jg     8004d5 <vprintfmt+0x1cc>
+  8004e7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004ea:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004ed:	85 c0                	test   %eax,%eax
+  8004ef:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004f4:	0f 49 d0             	cmovns %eax,%edx
+  8004f7:	29 d0                	sub    %edx,%eax
+  8004f9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004fc:	eb a6                	jmp    8004a4 <vprintfmt+0x19b>
+          putch(ch, putdat);
+  8004fe:	83 ec 08             	sub    $0x8,%esp
+  800501:	53                   	push   %ebx
+  800502:	52                   	push   %edx
+  800503:	ff 55 08             	call   *0x8(%ebp)
+  800506:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800509:	89 f1                	mov    %esi,%ecx
+  80050b:	8d 71 01             	lea    0x1(%ecx),%esi
+  80050e:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800512:	0f be d0             	movsbl %al,%edx
+  800515:	85 d2                	test   %edx,%edx
+  800517:	74 28                	je     800541 <vprintfmt+0x238>
+  800519:	85 ff                	test   %edi,%edi
+  80051b:	78 05                	js     800522 <vprintfmt+0x219>
+  80051d:	83 ef 01             	sub    $0x1,%edi
+  800520:	78 30                	js     800552 <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  800522:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800526:	74 d6                	je     8004fe <vprintfmt+0x1f5>
+  800528:	0f be c0             	movsbl %al,%eax
+  80052b:	83 e8 20             	sub    $0x20,%eax
+  80052e:	83 f8 5e             	cmp    $0x5e,%eax
+  800531:	76 cb                	jbe    8004fe <vprintfmt+0x1f5>
+          putch('?', putdat);
+  800533:	83 ec 08             	sub    $0x8,%esp
+  800536:	53                   	push   %ebx
+  800537:	6a 3f                	push   $0x3f
+  800539:	ff 55 08             	call   *0x8(%ebp)
+  80053c:	83 c4 10             	add    $0x10,%esp
+  80053f:	eb c8                	jmp    800509 <vprintfmt+0x200>
+  800541:	8b 75 08             	mov    0x8(%ebp),%esi
+  800544:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800547:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80054a:	01 d0                	add    %edx,%eax
+  80054c:	29 c8                	sub    %ecx,%eax
+  80054e:	89 c7                	mov    %eax,%edi
+  800550:	eb 13                	jmp    800565 <vprintfmt+0x25c>
+  800552:	8b 75 08             	mov    0x8(%ebp),%esi
+  800555:	eb ed                	jmp    800544 <vprintfmt+0x23b>
+        putch(' ', putdat);
+  800557:	83 ec 08             	sub    $0x8,%esp
+  80055a:	53                   	push   %ebx
+  80055b:	6a 20                	push   $0x20
+  80055d:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  80055f:	83 ef 01             	sub    $0x1,%edi
+  800562:	83 c4 10             	add    $0x10,%esp
+  800565:	85 ff                	test   %edi,%edi
+  800567:	7f ee                	jg     800557 <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  800569:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80056c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80056f:	e9 6b 01 00 00       	jmp    8006df <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  800574:	83 f9 01             	cmp    $0x1,%ecx
+  800577:	7f 1f                	jg     800598 <vprintfmt+0x28f>
+  else if (lflag)
+  800579:	85 c9                	test   %ecx,%ecx
+  80057b:	74 67                	je     8005e4 <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  80057d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800580:	8b 00                	mov    (%eax),%eax
+  800582:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800585:	89 c1                	mov    %eax,%ecx
+  800587:	c1 f9 1f             	sar    $0x1f,%ecx
+  80058a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80058d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800590:	8d 40 04             	lea    0x4(%eax),%eax
+  800593:	89 45 14             	mov    %eax,0x14(%ebp)
+  800596:	eb 17                	jmp    8005af <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  800598:	8b 45 14             	mov    0x14(%ebp),%eax
+  80059b:	8b 50 04             	mov    0x4(%eax),%edx
+  80059e:	8b 00                	mov    (%eax),%eax
+  8005a0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005a3:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005a6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a9:	8d 40 08             	lea    0x8(%eax),%eax
+  8005ac:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  8005af:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005b2:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  8005b5:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  8005ba:	85 c9                	test   %ecx,%ecx
+  8005bc:	0f 89 03 01 00 00    	jns    8006c5 <vprintfmt+0x3bc>
+        putch('-', putdat);
+  8005c2:	83 ec 08             	sub    $0x8,%esp
+  8005c5:	53                   	push   %ebx
+  8005c6:	6a 2d                	push   $0x2d
+  8005c8:	ff d6                	call   *%esi
+        num = -(long long)num;
+  8005ca:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005cd:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005d0:	f7 da                	neg    %edx
+  8005d2:	83 d1 00             	adc    $0x0,%ecx
+  8005d5:	f7 d9                	neg    %ecx
+  8005d7:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  8005da:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005df:	e9 e1 00 00 00       	jmp    8006c5 <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  8005e4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e7:	8b 00                	mov    (%eax),%eax
+  8005e9:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005ec:	89 c1                	mov    %eax,%ecx
+  8005ee:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005f1:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005f4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f7:	8d 40 04             	lea    0x4(%eax),%eax
+  8005fa:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005fd:	eb b0                	jmp    8005af <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  8005ff:	83 f9 01             	cmp    $0x1,%ecx
+  800602:	7f 1e                	jg     800622 <vprintfmt+0x319>
+  else if (lflag)
+  800604:	85 c9                	test   %ecx,%ecx
+  800606:	74 32                	je     80063a <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  800608:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060b:	8b 10                	mov    (%eax),%edx
+  80060d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800612:	8d 40 04             	lea    0x4(%eax),%eax
+  800615:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800618:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  80061d:	e9 a3 00 00 00       	jmp    8006c5 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800622:	8b 45 14             	mov    0x14(%ebp),%eax
+  800625:	8b 10                	mov    (%eax),%edx
+  800627:	8b 48 04             	mov    0x4(%eax),%ecx
+  80062a:	8d 40 08             	lea    0x8(%eax),%eax
+  80062d:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800630:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  800635:	e9 8b 00 00 00       	jmp    8006c5 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  80063a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80063d:	8b 10                	mov    (%eax),%edx
+  80063f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800644:	8d 40 04             	lea    0x4(%eax),%eax
+  800647:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  80064a:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  80064f:	eb 74                	jmp    8006c5 <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  800651:	83 f9 01             	cmp    $0x1,%ecx
+  800654:	7f 1b                	jg     800671 <vprintfmt+0x368>
+  else if (lflag)
+  800656:	85 c9                	test   %ecx,%ecx
+  800658:	74 2c                	je     800686 <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  80065a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80065d:	8b 10                	mov    (%eax),%edx
+  80065f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800664:	8d 40 04             	lea    0x4(%eax),%eax
+  800667:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  80066a:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  80066f:	eb 54                	jmp    8006c5 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800671:	8b 45 14             	mov    0x14(%ebp),%eax
+  800674:	8b 10                	mov    (%eax),%edx
+  800676:	8b 48 04             	mov    0x4(%eax),%ecx
+  800679:	8d 40 08             	lea    0x8(%eax),%eax
+  80067c:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  80067f:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  800684:	eb 3f                	jmp    8006c5 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800686:	8b 45 14             	mov    0x14(%ebp),%eax
+  800689:	8b 10                	mov    (%eax),%edx
+  80068b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800690:	8d 40 04             	lea    0x4(%eax),%eax
+  800693:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800696:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  80069b:	eb 28                	jmp    8006c5 <vprintfmt+0x3bc>
+      putch('0', putdat);
+  80069d:	83 ec 08             	sub    $0x8,%esp
+  8006a0:	53                   	push   %ebx
+  8006a1:	6a 30                	push   $0x30
+  8006a3:	ff d6                	call   *%esi
+      putch('x', putdat);
+  8006a5:	83 c4 08             	add    $0x8,%esp
+  8006a8:	53                   	push   %ebx
+  8006a9:	6a 78                	push   $0x78
+  8006ab:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  8006ad:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b0:	8b 10                	mov    (%eax),%edx
+  8006b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  8006b7:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  8006ba:	8d 40 04             	lea    0x4(%eax),%eax
+  8006bd:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8006c0:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  8006c5:	83 ec 0c             	sub    $0xc,%esp
+  8006c8:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8006cc:	50                   	push   %eax
+  8006cd:	ff 75 e0             	push   -0x20(%ebp)
+  8006d0:	57                   	push   %edi
+  8006d1:	51                   	push   %ecx
+  8006d2:	52                   	push   %edx
+  8006d3:	89 da                	mov    %ebx,%edx
+  8006d5:	89 f0                	mov    %esi,%eax
+  8006d7:	e8 4a fb ff ff       	call   800226 <printnum>
+      break;
+  8006dc:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  8006df:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  8006e2:	e9 40 fc ff ff       	jmp    800327 <vprintfmt+0x1e>
+  if (lflag >= 2)
+  8006e7:	83 f9 01             	cmp    $0x1,%ecx
+  8006ea:	7f 1b                	jg     800707 <vprintfmt+0x3fe>
+  else if (lflag)
+  8006ec:	85 c9                	test   %ecx,%ecx
+  8006ee:	74 2c                	je     80071c <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  8006f0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f3:	8b 10                	mov    (%eax),%edx
+  8006f5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006fa:	8d 40 04             	lea    0x4(%eax),%eax
+  8006fd:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800700:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  800705:	eb be                	jmp    8006c5 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800707:	8b 45 14             	mov    0x14(%ebp),%eax
+  80070a:	8b 10                	mov    (%eax),%edx
+  80070c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80070f:	8d 40 08             	lea    0x8(%eax),%eax
+  800712:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800715:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  80071a:	eb a9                	jmp    8006c5 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  80071c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071f:	8b 10                	mov    (%eax),%edx
+  800721:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800726:	8d 40 04             	lea    0x4(%eax),%eax
+  800729:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  80072c:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  800731:	eb 92                	jmp    8006c5 <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  800733:	83 ec 08             	sub    $0x8,%esp
+  800736:	53                   	push   %ebx
+  800737:	6a 25                	push   $0x25
+  800739:	ff d6                	call   *%esi
+      break;
+  80073b:	83 c4 10             	add    $0x10,%esp
+  80073e:	eb 9f                	jmp    8006df <vprintfmt+0x3d6>
+      putch('%', putdat);
+  800740:	83 ec 08             	sub    $0x8,%esp
+  800743:	53                   	push   %ebx
+  800744:	6a 25                	push   $0x25
+  800746:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  800748:	83 c4 10             	add    $0x10,%esp
+  80074b:	89 f8                	mov    %edi,%eax
+  80074d:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800751:	74 05                	je     800758 <vprintfmt+0x44f>
+  800753:	83 e8 01             	sub    $0x1,%eax
+  800756:	eb f5                	jmp    80074d <vprintfmt+0x444>
+  800758:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80075b:	eb 82                	jmp    8006df <vprintfmt+0x3d6>
+
+0080075d <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80075d:	55                   	push   %ebp
+  80075e:	89 e5                	mov    %esp,%ebp
+  800760:	83 ec 18             	sub    $0x18,%esp
+  800763:	8b 45 08             	mov    0x8(%ebp),%eax
+  800766:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  800769:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80076c:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800770:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800773:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  80077a:	85 c0                	test   %eax,%eax
+  80077c:	74 26                	je     8007a4 <vsnprintf+0x47>
+  80077e:	85 d2                	test   %edx,%edx
+  800780:	7e 22                	jle    8007a4 <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800782:	ff 75 14             	push   0x14(%ebp)
+  800785:	ff 75 10             	push   0x10(%ebp)
+  800788:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80078b:	50                   	push   %eax
+  80078c:	68 cf 02 80 00       	push   $0x8002cf
+  800791:	e8 73 fb ff ff       	call   800309 <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800796:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800799:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  80079c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80079f:	83 c4 10             	add    $0x10,%esp
+}
+  8007a2:	c9                   	leave
+  8007a3:	c3                   	ret
+    return -E_INVAL;
+  8007a4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007a9:	eb f7                	jmp    8007a2 <vsnprintf+0x45>
+
+008007ab <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8007ab:	55                   	push   %ebp
+  8007ac:	89 e5                	mov    %esp,%ebp
+  8007ae:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  8007b1:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  8007b4:	50                   	push   %eax
+  8007b5:	ff 75 10             	push   0x10(%ebp)
+  8007b8:	ff 75 0c             	push   0xc(%ebp)
+  8007bb:	ff 75 08             	push   0x8(%ebp)
+  8007be:	e8 9a ff ff ff       	call   80075d <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  8007c3:	c9                   	leave
+  8007c4:	c3                   	ret
+
+008007c5 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8007c5:	55                   	push   %ebp
+  8007c6:	89 e5                	mov    %esp,%ebp
+  8007c8:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  8007cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007d0:	eb 03                	jmp    8007d5 <strlen+0x10>
+    n++;
+  8007d2:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  8007d5:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8007d9:	75 f7                	jne    8007d2 <strlen+0xd>
+  return n;
+}
+  8007db:	5d                   	pop    %ebp
+  8007dc:	c3                   	ret
+
+008007dd <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8007dd:	55                   	push   %ebp
+  8007de:	89 e5                	mov    %esp,%ebp
+  8007e0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007e3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007eb:	eb 03                	jmp    8007f0 <strnlen+0x13>
+    n++;
+  8007ed:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007f0:	39 d0                	cmp    %edx,%eax
+  8007f2:	74 08                	je     8007fc <strnlen+0x1f>
+  8007f4:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8007f8:	75 f3                	jne    8007ed <strnlen+0x10>
+  8007fa:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  8007fc:	89 d0                	mov    %edx,%eax
+  8007fe:	5d                   	pop    %ebp
+  8007ff:	c3                   	ret
+
+00800800 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800800:	55                   	push   %ebp
+  800801:	89 e5                	mov    %esp,%ebp
+  800803:	53                   	push   %ebx
+  800804:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800807:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  80080a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80080f:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800813:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800816:	83 c0 01             	add    $0x1,%eax
+  800819:	84 d2                	test   %dl,%dl
+  80081b:	75 f2                	jne    80080f <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  80081d:	89 c8                	mov    %ecx,%eax
+  80081f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800822:	c9                   	leave
+  800823:	c3                   	ret
+
+00800824 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800824:	55                   	push   %ebp
+  800825:	89 e5                	mov    %esp,%ebp
+  800827:	53                   	push   %ebx
+  800828:	83 ec 10             	sub    $0x10,%esp
+  80082b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  80082e:	53                   	push   %ebx
+  80082f:	e8 91 ff ff ff       	call   8007c5 <strlen>
+  800834:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  800837:	ff 75 0c             	push   0xc(%ebp)
+  80083a:	01 d8                	add    %ebx,%eax
+  80083c:	50                   	push   %eax
+  80083d:	e8 be ff ff ff       	call   800800 <strcpy>
+  return dst;
+}
+  800842:	89 d8                	mov    %ebx,%eax
+  800844:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800847:	c9                   	leave
+  800848:	c3                   	ret
+
+00800849 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  800849:	55                   	push   %ebp
+  80084a:	89 e5                	mov    %esp,%ebp
+  80084c:	56                   	push   %esi
+  80084d:	53                   	push   %ebx
+  80084e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800851:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  800854:	89 f3                	mov    %esi,%ebx
+  800856:	03 5d 10             	add    0x10(%ebp),%ebx
+  800859:	89 f0                	mov    %esi,%eax
+  80085b:	eb 0f                	jmp    80086c <strncpy+0x23>
+    *dst++ = *src;
+  80085d:	83 c0 01             	add    $0x1,%eax
+  800860:	0f b6 0a             	movzbl (%edx),%ecx
+  800863:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  800866:	80 f9 01             	cmp    $0x1,%cl
+  800869:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  80086c:	39 d8                	cmp    %ebx,%eax
+  80086e:	75 ed                	jne    80085d <strncpy+0x14>
+  }
+  return ret;
+}
+  800870:	89 f0                	mov    %esi,%eax
+  800872:	5b                   	pop    %ebx
+  800873:	5e                   	pop    %esi
+  800874:	5d                   	pop    %ebp
+  800875:	c3                   	ret
+
+00800876 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800876:	55                   	push   %ebp
+  800877:	89 e5                	mov    %esp,%ebp
+  800879:	56                   	push   %esi
+  80087a:	53                   	push   %ebx
+  80087b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80087e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800881:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  800884:	89 f0                	mov    %esi,%eax
+  800886:	85 d2                	test   %edx,%edx
+  800888:	74 21                	je     8008ab <strlcpy+0x35>
+  80088a:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80088e:	89 f2                	mov    %esi,%edx
+  800890:	eb 09                	jmp    80089b <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  800892:	83 c1 01             	add    $0x1,%ecx
+  800895:	83 c2 01             	add    $0x1,%edx
+  800898:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  80089b:	39 c2                	cmp    %eax,%edx
+  80089d:	74 09                	je     8008a8 <strlcpy+0x32>
+  80089f:	0f b6 19             	movzbl (%ecx),%ebx
+  8008a2:	84 db                	test   %bl,%bl
+  8008a4:	75 ec                	jne    800892 <strlcpy+0x1c>
+  8008a6:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  8008a8:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  8008ab:	29 f0                	sub    %esi,%eax
+}
+  8008ad:	5b                   	pop    %ebx
+  8008ae:	5e                   	pop    %esi
+  8008af:	5d                   	pop    %ebp
+  8008b0:	c3                   	ret
+
+008008b1 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8008b1:	55                   	push   %ebp
+  8008b2:	89 e5                	mov    %esp,%ebp
+  8008b4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008b7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  8008ba:	eb 06                	jmp    8008c2 <strcmp+0x11>
+    p++, q++;
+  8008bc:	83 c1 01             	add    $0x1,%ecx
+  8008bf:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  8008c2:	0f b6 01             	movzbl (%ecx),%eax
+  8008c5:	84 c0                	test   %al,%al
+  8008c7:	74 04                	je     8008cd <strcmp+0x1c>
+  8008c9:	3a 02                	cmp    (%edx),%al
+  8008cb:	74 ef                	je     8008bc <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  8008cd:	0f b6 c0             	movzbl %al,%eax
+  8008d0:	0f b6 12             	movzbl (%edx),%edx
+  8008d3:	29 d0                	sub    %edx,%eax
+}
+  8008d5:	5d                   	pop    %ebp
+  8008d6:	c3                   	ret
+
+008008d7 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8008d7:	55                   	push   %ebp
+  8008d8:	89 e5                	mov    %esp,%ebp
+  8008da:	53                   	push   %ebx
+  8008db:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008de:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008e1:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  8008e4:	eb 09                	jmp    8008ef <strncmp+0x18>
+    n--, p++, q++;
+  8008e6:	83 ea 01             	sub    $0x1,%edx
+  8008e9:	83 c0 01             	add    $0x1,%eax
+  8008ec:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  8008ef:	85 d2                	test   %edx,%edx
+  8008f1:	74 18                	je     80090b <strncmp+0x34>
+  8008f3:	0f b6 18             	movzbl (%eax),%ebx
+  8008f6:	84 db                	test   %bl,%bl
+  8008f8:	74 04                	je     8008fe <strncmp+0x27>
+  8008fa:	3a 19                	cmp    (%ecx),%bl
+  8008fc:	74 e8                	je     8008e6 <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8008fe:	0f b6 00             	movzbl (%eax),%eax
+  800901:	0f b6 11             	movzbl (%ecx),%edx
+  800904:	29 d0                	sub    %edx,%eax
+}
+  800906:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800909:	c9                   	leave
+  80090a:	c3                   	ret
+    return 0;
+  80090b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800910:	eb f4                	jmp    800906 <strncmp+0x2f>
+
+00800912 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800912:	55                   	push   %ebp
+  800913:	89 e5                	mov    %esp,%ebp
+  800915:	8b 45 08             	mov    0x8(%ebp),%eax
+  800918:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  80091c:	eb 03                	jmp    800921 <strchr+0xf>
+  80091e:	83 c0 01             	add    $0x1,%eax
+  800921:	0f b6 10             	movzbl (%eax),%edx
+  800924:	84 d2                	test   %dl,%dl
+  800926:	74 06                	je     80092e <strchr+0x1c>
+    if (*s == c)
+  800928:	38 ca                	cmp    %cl,%dl
+  80092a:	75 f2                	jne    80091e <strchr+0xc>
+  80092c:	eb 05                	jmp    800933 <strchr+0x21>
+      return (char*)s;
+  return 0;
+  80092e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800933:	5d                   	pop    %ebp
+  800934:	c3                   	ret
+
+00800935 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800935:	55                   	push   %ebp
+  800936:	89 e5                	mov    %esp,%ebp
+  800938:	8b 45 08             	mov    0x8(%ebp),%eax
+  80093b:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  80093f:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  800942:	38 ca                	cmp    %cl,%dl
+  800944:	74 09                	je     80094f <strfind+0x1a>
+  800946:	84 d2                	test   %dl,%dl
+  800948:	74 05                	je     80094f <strfind+0x1a>
+  for (; *s; s++)
+  80094a:	83 c0 01             	add    $0x1,%eax
+  80094d:	eb f0                	jmp    80093f <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  80094f:	5d                   	pop    %ebp
+  800950:	c3                   	ret
+
+00800951 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800951:	55                   	push   %ebp
+  800952:	89 e5                	mov    %esp,%ebp
+  800954:	57                   	push   %edi
+  800955:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800958:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  80095b:	85 c9                	test   %ecx,%ecx
+  80095d:	74 20                	je     80097f <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  80095f:	89 f8                	mov    %edi,%eax
+  800961:	09 c8                	or     %ecx,%eax
+  800963:	a8 03                	test   $0x3,%al
+  800965:	75 12                	jne    800979 <memset+0x28>
+    c &= 0xFF;
+  800967:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80096b:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  800971:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  800974:	fc                   	cld
+  800975:	f3 ab                	rep stos %eax,%es:(%edi)
+  800977:	eb 06                	jmp    80097f <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  800979:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80097c:	fc                   	cld
+  80097d:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  80097f:	89 f8                	mov    %edi,%eax
+  800981:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800984:	c9                   	leave
+  800985:	c3                   	ret
+
+00800986 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800986:	55                   	push   %ebp
+  800987:	89 e5                	mov    %esp,%ebp
+  800989:	57                   	push   %edi
+  80098a:	56                   	push   %esi
+  80098b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80098e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800991:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  800994:	39 c6                	cmp    %eax,%esi
+  800996:	73 32                	jae    8009ca <memmove+0x44>
+  800998:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80099b:	39 d0                	cmp    %edx,%eax
+  80099d:	73 2b                	jae    8009ca <memmove+0x44>
+    s += n;
+    d += n;
+  80099f:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009a2:	89 d6                	mov    %edx,%esi
+  8009a4:	09 fe                	or     %edi,%esi
+  8009a6:	09 ce                	or     %ecx,%esi
+  8009a8:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8009ae:	75 0e                	jne    8009be <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8009b0:	83 ef 04             	sub    $0x4,%edi
+  8009b3:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8009b6:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  8009b9:	fd                   	std
+  8009ba:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009bc:	eb 09                	jmp    8009c7 <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8009be:	83 ef 01             	sub    $0x1,%edi
+  8009c1:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  8009c4:	fd                   	std
+  8009c5:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  8009c7:	fc                   	cld
+  8009c8:	eb 1a                	jmp    8009e4 <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009ca:	89 f2                	mov    %esi,%edx
+  8009cc:	09 c2                	or     %eax,%edx
+  8009ce:	09 ca                	or     %ecx,%edx
+  8009d0:	f6 c2 03             	test   $0x3,%dl
+  8009d3:	75 0a                	jne    8009df <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8009d5:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  8009d8:	89 c7                	mov    %eax,%edi
+  8009da:	fc                   	cld
+  8009db:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009dd:	eb 05                	jmp    8009e4 <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  8009df:	89 c7                	mov    %eax,%edi
+  8009e1:	fc                   	cld
+  8009e2:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  8009e4:	5e                   	pop    %esi
+  8009e5:	5f                   	pop    %edi
+  8009e6:	5d                   	pop    %ebp
+  8009e7:	c3                   	ret
+
+008009e8 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8009e8:	55                   	push   %ebp
+  8009e9:	89 e5                	mov    %esp,%ebp
+  8009eb:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  8009ee:	ff 75 10             	push   0x10(%ebp)
+  8009f1:	ff 75 0c             	push   0xc(%ebp)
+  8009f4:	ff 75 08             	push   0x8(%ebp)
+  8009f7:	e8 8a ff ff ff       	call   800986 <memmove>
+}
+  8009fc:	c9                   	leave
+  8009fd:	c3                   	ret
+
+008009fe <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8009fe:	55                   	push   %ebp
+  8009ff:	89 e5                	mov    %esp,%ebp
+  800a01:	56                   	push   %esi
+  800a02:	53                   	push   %ebx
+  800a03:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a06:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  800a09:	89 c6                	mov    %eax,%esi
+  800a0b:	03 75 10             	add    0x10(%ebp),%esi
+  800a0e:	eb 06                	jmp    800a16 <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  800a10:	83 c0 01             	add    $0x1,%eax
+  800a13:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  800a16:	39 f0                	cmp    %esi,%eax
+  800a18:	74 14                	je     800a2e <memcmp+0x30>
+    if (*s1 != *s2)
+  800a1a:	0f b6 08             	movzbl (%eax),%ecx
+  800a1d:	0f b6 1a             	movzbl (%edx),%ebx
+  800a20:	38 d9                	cmp    %bl,%cl
+  800a22:	74 ec                	je     800a10 <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  800a24:	0f b6 c1             	movzbl %cl,%eax
+  800a27:	0f b6 db             	movzbl %bl,%ebx
+  800a2a:	29 d8                	sub    %ebx,%eax
+  800a2c:	eb 05                	jmp    800a33 <memcmp+0x35>
+  }
+
+  return 0;
+  800a2e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a33:	5b                   	pop    %ebx
+  800a34:	5e                   	pop    %esi
+  800a35:	5d                   	pop    %ebp
+  800a36:	c3                   	ret
+
+00800a37 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a37:	55                   	push   %ebp
+  800a38:	89 e5                	mov    %esp,%ebp
+  800a3a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a3d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  800a40:	89 c2                	mov    %eax,%edx
+  800a42:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  800a45:	eb 03                	jmp    800a4a <memfind+0x13>
+  800a47:	83 c0 01             	add    $0x1,%eax
+  800a4a:	39 d0                	cmp    %edx,%eax
+  800a4c:	73 04                	jae    800a52 <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  800a4e:	38 08                	cmp    %cl,(%eax)
+  800a50:	75 f5                	jne    800a47 <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  800a52:	5d                   	pop    %ebp
+  800a53:	c3                   	ret
+
+00800a54 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a54:	55                   	push   %ebp
+  800a55:	89 e5                	mov    %esp,%ebp
+  800a57:	57                   	push   %edi
+  800a58:	56                   	push   %esi
+  800a59:	53                   	push   %ebx
+  800a5a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a5d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  800a60:	eb 03                	jmp    800a65 <strtol+0x11>
+    s++;
+  800a62:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  800a65:	0f b6 02             	movzbl (%edx),%eax
+  800a68:	3c 20                	cmp    $0x20,%al
+  800a6a:	74 f6                	je     800a62 <strtol+0xe>
+  800a6c:	3c 09                	cmp    $0x9,%al
+  800a6e:	74 f2                	je     800a62 <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  800a70:	3c 2b                	cmp    $0x2b,%al
+  800a72:	74 2a                	je     800a9e <strtol+0x4a>
+  int neg = 0;
+  800a74:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  800a79:	3c 2d                	cmp    $0x2d,%al
+  800a7b:	74 2b                	je     800aa8 <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a7d:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a83:	75 0f                	jne    800a94 <strtol+0x40>
+  800a85:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a88:	74 28                	je     800ab2 <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  800a8a:	85 db                	test   %ebx,%ebx
+  800a8c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a91:	0f 44 d8             	cmove  %eax,%ebx
+  800a94:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a99:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a9c:	eb 46                	jmp    800ae4 <strtol+0x90>
+    s++;
+  800a9e:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  800aa1:	bf 00 00 00 00       	mov    $0x0,%edi
+  800aa6:	eb d5                	jmp    800a7d <strtol+0x29>
+    s++, neg = 1;
+  800aa8:	83 c2 01             	add    $0x1,%edx
+  800aab:	bf 01 00 00 00       	mov    $0x1,%edi
+  800ab0:	eb cb                	jmp    800a7d <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ab2:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800ab6:	74 0e                	je     800ac6 <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  800ab8:	85 db                	test   %ebx,%ebx
+  800aba:	75 d8                	jne    800a94 <strtol+0x40>
+    s++, base = 8;
+  800abc:	83 c2 01             	add    $0x1,%edx
+  800abf:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800ac4:	eb ce                	jmp    800a94 <strtol+0x40>
+    s += 2, base = 16;
+  800ac6:	83 c2 02             	add    $0x2,%edx
+  800ac9:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800ace:	eb c4                	jmp    800a94 <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  800ad0:	0f be c0             	movsbl %al,%eax
+  800ad3:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  800ad6:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800ad9:	7d 3a                	jge    800b15 <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  800adb:	83 c2 01             	add    $0x1,%edx
+  800ade:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800ae2:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  800ae4:	0f b6 02             	movzbl (%edx),%eax
+  800ae7:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800aea:	89 f3                	mov    %esi,%ebx
+  800aec:	80 fb 09             	cmp    $0x9,%bl
+  800aef:	76 df                	jbe    800ad0 <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  800af1:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800af4:	89 f3                	mov    %esi,%ebx
+  800af6:	80 fb 19             	cmp    $0x19,%bl
+  800af9:	77 08                	ja     800b03 <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  800afb:	0f be c0             	movsbl %al,%eax
+  800afe:	83 e8 57             	sub    $0x57,%eax
+  800b01:	eb d3                	jmp    800ad6 <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  800b03:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800b06:	89 f3                	mov    %esi,%ebx
+  800b08:	80 fb 19             	cmp    $0x19,%bl
+  800b0b:	77 08                	ja     800b15 <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  800b0d:	0f be c0             	movsbl %al,%eax
+  800b10:	83 e8 37             	sub    $0x37,%eax
+  800b13:	eb c1                	jmp    800ad6 <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  800b15:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b19:	74 05                	je     800b20 <strtol+0xcc>
+    *endptr = (char*)s;
+  800b1b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b1e:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  800b20:	89 c8                	mov    %ecx,%eax
+  800b22:	f7 d8                	neg    %eax
+  800b24:	85 ff                	test   %edi,%edi
+  800b26:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b29:	89 c8                	mov    %ecx,%eax
+  800b2b:	5b                   	pop    %ebx
+  800b2c:	5e                   	pop    %esi
+  800b2d:	5f                   	pop    %edi
+  800b2e:	5d                   	pop    %ebp
+  800b2f:	c3                   	ret
+
+00800b30 <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800b30:	55                   	push   %ebp
+  800b31:	89 e5                	mov    %esp,%ebp
+  800b33:	57                   	push   %edi
+  800b34:	56                   	push   %esi
+  800b35:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800b36:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b3b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b3e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b41:	89 c3                	mov    %eax,%ebx
+  800b43:	89 c7                	mov    %eax,%edi
+  800b45:	89 c6                	mov    %eax,%esi
+  800b47:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800b49:	5b                   	pop    %ebx
+  800b4a:	5e                   	pop    %esi
+  800b4b:	5f                   	pop    %edi
+  800b4c:	5d                   	pop    %ebp
+  800b4d:	c3                   	ret
+
+00800b4e <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800b4e:	55                   	push   %ebp
+  800b4f:	89 e5                	mov    %esp,%ebp
+  800b51:	57                   	push   %edi
+  800b52:	56                   	push   %esi
+  800b53:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800b54:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b59:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b5e:	89 d1                	mov    %edx,%ecx
+  800b60:	89 d3                	mov    %edx,%ebx
+  800b62:	89 d7                	mov    %edx,%edi
+  800b64:	89 d6                	mov    %edx,%esi
+  800b66:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800b68:	5b                   	pop    %ebx
+  800b69:	5e                   	pop    %esi
+  800b6a:	5f                   	pop    %edi
+  800b6b:	5d                   	pop    %ebp
+  800b6c:	c3                   	ret
+
+00800b6d <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800b6d:	55                   	push   %ebp
+  800b6e:	89 e5                	mov    %esp,%ebp
+  800b70:	57                   	push   %edi
+  800b71:	56                   	push   %esi
+  800b72:	53                   	push   %ebx
+  800b73:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800b76:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b7b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b7e:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b83:	89 cb                	mov    %ecx,%ebx
+  800b85:	89 cf                	mov    %ecx,%edi
+  800b87:	89 ce                	mov    %ecx,%esi
+  800b89:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800b8b:	85 c0                	test   %eax,%eax
+  800b8d:	7f 08                	jg     800b97 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800b8f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b92:	5b                   	pop    %ebx
+  800b93:	5e                   	pop    %esi
+  800b94:	5f                   	pop    %edi
+  800b95:	5d                   	pop    %ebp
+  800b96:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800b97:	83 ec 0c             	sub    $0xc,%esp
+  800b9a:	50                   	push   %eax
+  800b9b:	6a 03                	push   $0x3
+  800b9d:	68 03 33 80 00       	push   $0x803303
+  800ba2:	6a 23                	push   $0x23
+  800ba4:	68 20 33 80 00       	push   $0x803320
+  800ba9:	e8 89 f5 ff ff       	call   800137 <_panic>
+
+00800bae <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800bae:	55                   	push   %ebp
+  800baf:	89 e5                	mov    %esp,%ebp
+  800bb1:	57                   	push   %edi
+  800bb2:	56                   	push   %esi
+  800bb3:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800bb4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bb9:	b8 02 00 00 00       	mov    $0x2,%eax
+  800bbe:	89 d1                	mov    %edx,%ecx
+  800bc0:	89 d3                	mov    %edx,%ebx
+  800bc2:	89 d7                	mov    %edx,%edi
+  800bc4:	89 d6                	mov    %edx,%esi
+  800bc6:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800bc8:	5b                   	pop    %ebx
+  800bc9:	5e                   	pop    %esi
+  800bca:	5f                   	pop    %edi
+  800bcb:	5d                   	pop    %ebp
+  800bcc:	c3                   	ret
+
+00800bcd <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800bcd:	55                   	push   %ebp
+  800bce:	89 e5                	mov    %esp,%ebp
+  800bd0:	57                   	push   %edi
+  800bd1:	56                   	push   %esi
+  800bd2:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800bd3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bd8:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800bdd:	89 d1                	mov    %edx,%ecx
+  800bdf:	89 d3                	mov    %edx,%ebx
+  800be1:	89 d7                	mov    %edx,%edi
+  800be3:	89 d6                	mov    %edx,%esi
+  800be5:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800be7:	5b                   	pop    %ebx
+  800be8:	5e                   	pop    %esi
+  800be9:	5f                   	pop    %edi
+  800bea:	5d                   	pop    %ebp
+  800beb:	c3                   	ret
+
+00800bec <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  800bec:	55                   	push   %ebp
+  800bed:	89 e5                	mov    %esp,%ebp
+  800bef:	57                   	push   %edi
+  800bf0:	56                   	push   %esi
+  800bf1:	53                   	push   %ebx
+  800bf2:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  800bf5:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  800bf9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800bfe:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c01:	b8 14 00 00 00       	mov    $0x14,%eax
+  800c06:	89 df                	mov    %ebx,%edi
+  800c08:	89 de                	mov    %ebx,%esi
+  800c0a:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c0c:	85 c0                	test   %eax,%eax
+  800c0e:	7f 08                	jg     800c18 <sys_env_set_cow+0x2c>
+}
+  800c10:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c13:	5b                   	pop    %ebx
+  800c14:	5e                   	pop    %esi
+  800c15:	5f                   	pop    %edi
+  800c16:	5d                   	pop    %ebp
+  800c17:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c18:	83 ec 0c             	sub    $0xc,%esp
+  800c1b:	50                   	push   %eax
+  800c1c:	6a 14                	push   $0x14
+  800c1e:	68 03 33 80 00       	push   $0x803303
+  800c23:	6a 23                	push   $0x23
+  800c25:	68 20 33 80 00       	push   $0x803320
+  800c2a:	e8 08 f5 ff ff       	call   800137 <_panic>
+
+00800c2f <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800c2f:	55                   	push   %ebp
+  800c30:	89 e5                	mov    %esp,%ebp
+  800c32:	57                   	push   %edi
+  800c33:	56                   	push   %esi
+  800c34:	53                   	push   %ebx
+  800c35:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800c38:	be 00 00 00 00       	mov    $0x0,%esi
+  800c3d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c40:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c43:	b8 04 00 00 00       	mov    $0x4,%eax
+  800c48:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c4b:	89 f7                	mov    %esi,%edi
+  800c4d:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c4f:	85 c0                	test   %eax,%eax
+  800c51:	7f 08                	jg     800c5b <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  800c53:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c56:	5b                   	pop    %ebx
+  800c57:	5e                   	pop    %esi
+  800c58:	5f                   	pop    %edi
+  800c59:	5d                   	pop    %ebp
+  800c5a:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c5b:	83 ec 0c             	sub    $0xc,%esp
+  800c5e:	50                   	push   %eax
+  800c5f:	6a 04                	push   $0x4
+  800c61:	68 03 33 80 00       	push   $0x803303
+  800c66:	6a 23                	push   $0x23
+  800c68:	68 20 33 80 00       	push   $0x803320
+  800c6d:	e8 c5 f4 ff ff       	call   800137 <_panic>
+
+00800c72 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800c72:	55                   	push   %ebp
+  800c73:	89 e5                	mov    %esp,%ebp
+  800c75:	57                   	push   %edi
+  800c76:	56                   	push   %esi
+  800c77:	53                   	push   %ebx
+  800c78:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800c7b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c7e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c81:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c86:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c89:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c8c:	8b 75 18             	mov    0x18(%ebp),%esi
+  800c8f:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c91:	85 c0                	test   %eax,%eax
+  800c93:	7f 08                	jg     800c9d <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  800c95:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c98:	5b                   	pop    %ebx
+  800c99:	5e                   	pop    %esi
+  800c9a:	5f                   	pop    %edi
+  800c9b:	5d                   	pop    %ebp
+  800c9c:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c9d:	83 ec 0c             	sub    $0xc,%esp
+  800ca0:	50                   	push   %eax
+  800ca1:	6a 05                	push   $0x5
+  800ca3:	68 03 33 80 00       	push   $0x803303
+  800ca8:	6a 23                	push   $0x23
+  800caa:	68 20 33 80 00       	push   $0x803320
+  800caf:	e8 83 f4 ff ff       	call   800137 <_panic>
+
+00800cb4 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800cb4:	55                   	push   %ebp
+  800cb5:	89 e5                	mov    %esp,%ebp
+  800cb7:	57                   	push   %edi
+  800cb8:	56                   	push   %esi
+  800cb9:	53                   	push   %ebx
+  800cba:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800cbd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cc2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cc5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cc8:	b8 06 00 00 00       	mov    $0x6,%eax
+  800ccd:	89 df                	mov    %ebx,%edi
+  800ccf:	89 de                	mov    %ebx,%esi
+  800cd1:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800cd3:	85 c0                	test   %eax,%eax
+  800cd5:	7f 08                	jg     800cdf <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  800cd7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cda:	5b                   	pop    %ebx
+  800cdb:	5e                   	pop    %esi
+  800cdc:	5f                   	pop    %edi
+  800cdd:	5d                   	pop    %ebp
+  800cde:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800cdf:	83 ec 0c             	sub    $0xc,%esp
+  800ce2:	50                   	push   %eax
+  800ce3:	6a 06                	push   $0x6
+  800ce5:	68 03 33 80 00       	push   $0x803303
+  800cea:	6a 23                	push   $0x23
+  800cec:	68 20 33 80 00       	push   $0x803320
+  800cf1:	e8 41 f4 ff ff       	call   800137 <_panic>
+
+00800cf6 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  800cf6:	55                   	push   %ebp
+  800cf7:	89 e5                	mov    %esp,%ebp
+  800cf9:	57                   	push   %edi
+  800cfa:	56                   	push   %esi
+  800cfb:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800cfc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d02:	b8 11 00 00 00       	mov    $0x11,%eax
+  800d07:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d0a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d0d:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d10:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  800d12:	5b                   	pop    %ebx
+  800d13:	5e                   	pop    %esi
+  800d14:	5f                   	pop    %edi
+  800d15:	5d                   	pop    %ebp
+  800d16:	c3                   	ret
+
+00800d17 <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  800d17:	55                   	push   %ebp
+  800d18:	89 e5                	mov    %esp,%ebp
+  800d1a:	57                   	push   %edi
+  800d1b:	56                   	push   %esi
+  800d1c:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d1d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d20:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d23:	b8 12 00 00 00       	mov    $0x12,%eax
+  800d28:	be 00 00 00 00       	mov    $0x0,%esi
+  800d2d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d30:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d33:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  800d35:	5b                   	pop    %ebx
+  800d36:	5e                   	pop    %esi
+  800d37:	5f                   	pop    %edi
+  800d38:	5d                   	pop    %ebp
+  800d39:	c3                   	ret
+
+00800d3a <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  800d3a:	55                   	push   %ebp
+  800d3b:	89 e5                	mov    %esp,%ebp
+  800d3d:	57                   	push   %edi
+  800d3e:	56                   	push   %esi
+  800d3f:	53                   	push   %ebx
+  800d40:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800d43:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d48:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d4b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d4e:	b8 16 00 00 00       	mov    $0x16,%eax
+  800d53:	89 df                	mov    %ebx,%edi
+  800d55:	89 de                	mov    %ebx,%esi
+  800d57:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d59:	85 c0                	test   %eax,%eax
+  800d5b:	7f 08                	jg     800d65 <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  800d5d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d60:	5b                   	pop    %ebx
+  800d61:	5e                   	pop    %esi
+  800d62:	5f                   	pop    %edi
+  800d63:	5d                   	pop    %ebp
+  800d64:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d65:	83 ec 0c             	sub    $0xc,%esp
+  800d68:	50                   	push   %eax
+  800d69:	6a 16                	push   $0x16
+  800d6b:	68 03 33 80 00       	push   $0x803303
+  800d70:	6a 23                	push   $0x23
+  800d72:	68 20 33 80 00       	push   $0x803320
+  800d77:	e8 bb f3 ff ff       	call   800137 <_panic>
+
+00800d7c <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  800d7c:	55                   	push   %ebp
+  800d7d:	89 e5                	mov    %esp,%ebp
+  800d7f:	57                   	push   %edi
+  800d80:	56                   	push   %esi
+  800d81:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d82:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d87:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d8a:	b8 17 00 00 00       	mov    $0x17,%eax
+  800d8f:	89 cb                	mov    %ecx,%ebx
+  800d91:	89 cf                	mov    %ecx,%edi
+  800d93:	89 ce                	mov    %ecx,%esi
+  800d95:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  800d97:	5b                   	pop    %ebx
+  800d98:	5e                   	pop    %esi
+  800d99:	5f                   	pop    %edi
+  800d9a:	5d                   	pop    %ebp
+  800d9b:	c3                   	ret
+
+00800d9c <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  800d9c:	55                   	push   %ebp
+  800d9d:	89 e5                	mov    %esp,%ebp
+  800d9f:	57                   	push   %edi
+  800da0:	56                   	push   %esi
+  800da1:	53                   	push   %ebx
+  800da2:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800da5:	be 00 00 00 00       	mov    $0x0,%esi
+  800daa:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800db0:	b8 18 00 00 00       	mov    $0x18,%eax
+  800db5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800db8:	89 f7                	mov    %esi,%edi
+  800dba:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800dbc:	85 c0                	test   %eax,%eax
+  800dbe:	7f 08                	jg     800dc8 <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  800dc0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dc3:	5b                   	pop    %ebx
+  800dc4:	5e                   	pop    %esi
+  800dc5:	5f                   	pop    %edi
+  800dc6:	5d                   	pop    %ebp
+  800dc7:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800dc8:	83 ec 0c             	sub    $0xc,%esp
+  800dcb:	50                   	push   %eax
+  800dcc:	6a 18                	push   $0x18
+  800dce:	68 03 33 80 00       	push   $0x803303
+  800dd3:	6a 23                	push   $0x23
+  800dd5:	68 20 33 80 00       	push   $0x803320
+  800dda:	e8 58 f3 ff ff       	call   800137 <_panic>
+
+00800ddf <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  800ddf:	55                   	push   %ebp
+  800de0:	89 e5                	mov    %esp,%ebp
+  800de2:	57                   	push   %edi
+  800de3:	56                   	push   %esi
+  800de4:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800de5:	be 00 00 00 00       	mov    $0x0,%esi
+  800dea:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ded:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800df0:	b8 19 00 00 00       	mov    $0x19,%eax
+  800df5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800df8:	89 f7                	mov    %esi,%edi
+  800dfa:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  800dfc:	5b                   	pop    %ebx
+  800dfd:	5e                   	pop    %esi
+  800dfe:	5f                   	pop    %edi
+  800dff:	5d                   	pop    %ebp
+  800e00:	c3                   	ret
+
+00800e01 <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  800e01:	55                   	push   %ebp
+  800e02:	89 e5                	mov    %esp,%ebp
+  800e04:	57                   	push   %edi
+  800e05:	56                   	push   %esi
+  800e06:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e07:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e0c:	b8 15 00 00 00       	mov    $0x15,%eax
+  800e11:	89 d1                	mov    %edx,%ecx
+  800e13:	89 d3                	mov    %edx,%ebx
+  800e15:	89 d7                	mov    %edx,%edi
+  800e17:	89 d6                	mov    %edx,%esi
+  800e19:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800e1b:	5b                   	pop    %ebx
+  800e1c:	5e                   	pop    %esi
+  800e1d:	5f                   	pop    %edi
+  800e1e:	5d                   	pop    %ebp
+  800e1f:	c3                   	ret
+
+00800e20 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800e20:	55                   	push   %ebp
+  800e21:	89 e5                	mov    %esp,%ebp
+  800e23:	57                   	push   %edi
+  800e24:	56                   	push   %esi
+  800e25:	53                   	push   %ebx
+  800e26:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e29:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e2e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e31:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e34:	b8 08 00 00 00       	mov    $0x8,%eax
+  800e39:	89 df                	mov    %ebx,%edi
+  800e3b:	89 de                	mov    %ebx,%esi
+  800e3d:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e3f:	85 c0                	test   %eax,%eax
+  800e41:	7f 08                	jg     800e4b <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800e43:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e46:	5b                   	pop    %ebx
+  800e47:	5e                   	pop    %esi
+  800e48:	5f                   	pop    %edi
+  800e49:	5d                   	pop    %ebp
+  800e4a:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e4b:	83 ec 0c             	sub    $0xc,%esp
+  800e4e:	50                   	push   %eax
+  800e4f:	6a 08                	push   $0x8
+  800e51:	68 03 33 80 00       	push   $0x803303
+  800e56:	6a 23                	push   $0x23
+  800e58:	68 20 33 80 00       	push   $0x803320
+  800e5d:	e8 d5 f2 ff ff       	call   800137 <_panic>
+
+00800e62 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800e62:	55                   	push   %ebp
+  800e63:	89 e5                	mov    %esp,%ebp
+  800e65:	57                   	push   %edi
+  800e66:	56                   	push   %esi
+  800e67:	53                   	push   %ebx
+  800e68:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e6b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e70:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e73:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e76:	b8 09 00 00 00       	mov    $0x9,%eax
+  800e7b:	89 df                	mov    %ebx,%edi
+  800e7d:	89 de                	mov    %ebx,%esi
+  800e7f:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e81:	85 c0                	test   %eax,%eax
+  800e83:	7f 08                	jg     800e8d <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  800e85:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e88:	5b                   	pop    %ebx
+  800e89:	5e                   	pop    %esi
+  800e8a:	5f                   	pop    %edi
+  800e8b:	5d                   	pop    %ebp
+  800e8c:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e8d:	83 ec 0c             	sub    $0xc,%esp
+  800e90:	50                   	push   %eax
+  800e91:	6a 09                	push   $0x9
+  800e93:	68 03 33 80 00       	push   $0x803303
+  800e98:	6a 23                	push   $0x23
+  800e9a:	68 20 33 80 00       	push   $0x803320
+  800e9f:	e8 93 f2 ff ff       	call   800137 <_panic>
+
+00800ea4 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800ea4:	55                   	push   %ebp
+  800ea5:	89 e5                	mov    %esp,%ebp
+  800ea7:	57                   	push   %edi
+  800ea8:	56                   	push   %esi
+  800ea9:	53                   	push   %ebx
+  800eaa:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800ead:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eb2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eb8:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ebd:	89 df                	mov    %ebx,%edi
+  800ebf:	89 de                	mov    %ebx,%esi
+  800ec1:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ec3:	85 c0                	test   %eax,%eax
+  800ec5:	7f 08                	jg     800ecf <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  800ec7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eca:	5b                   	pop    %ebx
+  800ecb:	5e                   	pop    %esi
+  800ecc:	5f                   	pop    %edi
+  800ecd:	5d                   	pop    %ebp
+  800ece:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ecf:	83 ec 0c             	sub    $0xc,%esp
+  800ed2:	50                   	push   %eax
+  800ed3:	6a 0a                	push   $0xa
+  800ed5:	68 03 33 80 00       	push   $0x803303
+  800eda:	6a 23                	push   $0x23
+  800edc:	68 20 33 80 00       	push   $0x803320
+  800ee1:	e8 51 f2 ff ff       	call   800137 <_panic>
+
+00800ee6 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  800ee6:	55                   	push   %ebp
+  800ee7:	89 e5                	mov    %esp,%ebp
+  800ee9:	57                   	push   %edi
+  800eea:	56                   	push   %esi
+  800eeb:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800eec:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ef2:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800ef7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800efa:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800efd:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f00:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  800f02:	5b                   	pop    %ebx
+  800f03:	5e                   	pop    %esi
+  800f04:	5f                   	pop    %edi
+  800f05:	5d                   	pop    %ebp
+  800f06:	c3                   	ret
+
+00800f07 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  800f07:	55                   	push   %ebp
+  800f08:	89 e5                	mov    %esp,%ebp
+  800f0a:	57                   	push   %edi
+  800f0b:	56                   	push   %esi
+  800f0c:	53                   	push   %ebx
+  800f0d:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f10:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f15:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f18:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f1b:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f20:	89 df                	mov    %ebx,%edi
+  800f22:	89 de                	mov    %ebx,%esi
+  800f24:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f26:	85 c0                	test   %eax,%eax
+  800f28:	7f 08                	jg     800f32 <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  800f2a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f2d:	5b                   	pop    %ebx
+  800f2e:	5e                   	pop    %esi
+  800f2f:	5f                   	pop    %edi
+  800f30:	5d                   	pop    %ebp
+  800f31:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f32:	83 ec 0c             	sub    $0xc,%esp
+  800f35:	50                   	push   %eax
+  800f36:	6a 0d                	push   $0xd
+  800f38:	68 03 33 80 00       	push   $0x803303
+  800f3d:	6a 23                	push   $0x23
+  800f3f:	68 20 33 80 00       	push   $0x803320
+  800f44:	e8 ee f1 ff ff       	call   800137 <_panic>
+
+00800f49 <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  800f49:	55                   	push   %ebp
+  800f4a:	89 e5                	mov    %esp,%ebp
+  800f4c:	57                   	push   %edi
+  800f4d:	56                   	push   %esi
+  800f4e:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f4f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f54:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800f59:	89 d1                	mov    %edx,%ecx
+  800f5b:	89 d3                	mov    %edx,%ebx
+  800f5d:	89 d7                	mov    %edx,%edi
+  800f5f:	89 d6                	mov    %edx,%esi
+  800f61:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800f63:	5b                   	pop    %ebx
+  800f64:	5e                   	pop    %esi
+  800f65:	5f                   	pop    %edi
+  800f66:	5d                   	pop    %ebp
+  800f67:	c3                   	ret
+
+00800f68 <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  800f68:	55                   	push   %ebp
+  800f69:	89 e5                	mov    %esp,%ebp
+  800f6b:	57                   	push   %edi
+  800f6c:	56                   	push   %esi
+  800f6d:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f6e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f71:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f74:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f79:	be 00 00 00 00       	mov    $0x0,%esi
+  800f7e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f81:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f84:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  800f86:	5b                   	pop    %ebx
+  800f87:	5e                   	pop    %esi
+  800f88:	5f                   	pop    %edi
+  800f89:	5d                   	pop    %ebp
+  800f8a:	c3                   	ret
+
+00800f8b <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  800f8b:	55                   	push   %ebp
+  800f8c:	89 e5                	mov    %esp,%ebp
+  800f8e:	57                   	push   %edi
+  800f8f:	56                   	push   %esi
+  800f90:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f91:	be 00 00 00 00       	mov    $0x0,%esi
+  800f96:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f99:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f9c:	b8 10 00 00 00       	mov    $0x10,%eax
+  800fa1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fa4:	89 f7                	mov    %esi,%edi
+  800fa6:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  800fa8:	5b                   	pop    %ebx
+  800fa9:	5e                   	pop    %esi
+  800faa:	5f                   	pop    %edi
+  800fab:	5d                   	pop    %ebp
+  800fac:	c3                   	ret
+
+00800fad <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  800fad:	55                   	push   %ebp
+  800fae:	89 e5                	mov    %esp,%ebp
+  800fb0:	57                   	push   %edi
+  800fb1:	56                   	push   %esi
+  800fb2:	53                   	push   %ebx
+  800fb3:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  800fb6:	80 3d 48 57 80 00 00 	cmpb   $0x0,0x805748
+  800fbd:	74 41                	je     801000 <sys_batch+0x53>
+  800fbf:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fc2:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  800fc5:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  800fcc:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800fcf:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  800fd2:	7d 45                	jge    801019 <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  800fd4:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800fd7:	8b 06                	mov    (%esi),%eax
+  800fd9:	8b 56 04             	mov    0x4(%esi),%edx
+  800fdc:	8b 4e 08             	mov    0x8(%esi),%ecx
+  800fdf:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  800fe2:	8b 7e 10             	mov    0x10(%esi),%edi
+  800fe5:	8b 76 14             	mov    0x14(%esi),%esi
+  800fe8:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  800fea:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800fed:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  800ff0:	83 c6 1c             	add    $0x1c,%esi
+  800ff3:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  800ff6:	85 c0                	test   %eax,%eax
+  800ff8:	78 1f                	js     801019 <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  800ffa:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  800ffe:	eb cc                	jmp    800fcc <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  801000:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801005:	b8 13 00 00 00       	mov    $0x13,%eax
+  80100a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80100d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801010:	89 df                	mov    %ebx,%edi
+  801012:	89 de                	mov    %ebx,%esi
+  801014:	cd 30                	int    $0x30
+  801016:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  801019:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80101c:	83 c4 08             	add    $0x8,%esp
+  80101f:	5b                   	pop    %ebx
+  801020:	5e                   	pop    %esi
+  801021:	5f                   	pop    %edi
+  801022:	5d                   	pop    %ebp
+  801023:	c3                   	ret
+
+00801024 <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  801024:	55                   	push   %ebp
+  801025:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  801027:	8b 45 08             	mov    0x8(%ebp),%eax
+  80102a:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  801030:	5d                   	pop    %ebp
+  801031:	c3                   	ret
+
+00801032 <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  801032:	55                   	push   %ebp
+  801033:	89 e5                	mov    %esp,%ebp
+  801035:	56                   	push   %esi
+  801036:	53                   	push   %ebx
+  801037:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  80103a:	8b 1e                	mov    (%esi),%ebx
+  80103c:	85 db                	test   %ebx,%ebx
+  80103e:	75 09                	jne    801049 <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  801040:	89 d8                	mov    %ebx,%eax
+  801042:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801045:	5b                   	pop    %ebx
+  801046:	5e                   	pop    %esi
+  801047:	5d                   	pop    %ebp
+  801048:	c3                   	ret
+  b->sb_n = 0;
+  801049:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  80104f:	53                   	push   %ebx
+  801050:	8d 46 04             	lea    0x4(%esi),%eax
+  801053:	50                   	push   %eax
+  801054:	e8 54 ff ff ff       	call   800fad <sys_batch>
+  801059:	83 c4 08             	add    $0x8,%esp
+  80105c:	85 c0                	test   %eax,%eax
+  80105e:	78 1e                	js     80107e <sysbatch_flush+0x4c>
+  if (r < n)
+  801060:	39 c3                	cmp    %eax,%ebx
+  801062:	7f 07                	jg     80106b <sysbatch_flush+0x39>
+  return 0;
+  801064:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801069:	eb d5                	jmp    801040 <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  80106b:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80106e:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  801072:	85 db                	test   %ebx,%ebx
+  801074:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801079:	0f 49 d8             	cmovns %eax,%ebx
+  80107c:	eb c2                	jmp    801040 <sysbatch_flush+0xe>
+    return r;
+  80107e:	89 c3                	mov    %eax,%ebx
+  801080:	eb be                	jmp    801040 <sysbatch_flush+0xe>
+
+00801082 <sysbatch_add>:
+{
+  801082:	55                   	push   %ebp
+  801083:	89 e5                	mov    %esp,%ebp
+  801085:	53                   	push   %ebx
+  801086:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  801089:	83 3b 40             	cmpl   $0x40,(%ebx)
+  80108c:	74 41                	je     8010cf <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  80108e:	8b 03                	mov    (%ebx),%eax
+  801090:	8d 50 01             	lea    0x1(%eax),%edx
+  801093:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  801095:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801098:	01 d8                	add    %ebx,%eax
+  80109a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80109d:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  8010a0:	8b 55 10             	mov    0x10(%ebp),%edx
+  8010a3:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  8010a6:	8b 55 14             	mov    0x14(%ebp),%edx
+  8010a9:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  8010ac:	8b 55 18             	mov    0x18(%ebp),%edx
+  8010af:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  8010b2:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  8010b5:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  8010b8:	8b 55 20             	mov    0x20(%ebp),%edx
+  8010bb:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  8010be:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  8010c5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8010ca:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8010cd:	c9                   	leave
+  8010ce:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  8010cf:	53                   	push   %ebx
+  8010d0:	e8 5d ff ff ff       	call   801032 <sysbatch_flush>
+  8010d5:	83 c4 04             	add    $0x4,%esp
+  8010d8:	85 c0                	test   %eax,%eax
+  8010da:	79 b2                	jns    80108e <sysbatch_add+0xc>
+  8010dc:	eb ec                	jmp    8010ca <sysbatch_add+0x48>
+
+008010de <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8010de:	55                   	push   %ebp
+  8010df:	89 e5                	mov    %esp,%ebp
+  8010e1:	53                   	push   %ebx
+  8010e2:	83 ec 04             	sub    $0x4,%esp
+  int r;
+
+  if (_pgfault_handler == 0) {
+  8010e5:	83 3d 4c 57 80 00 00 	cmpl   $0x0,0x80574c
+  8010ec:	74 0d                	je     8010fb <set_pgfault_handler+0x1d>
+
+    sys_env_set_pgfault_upcall(id, _pgfault_upcall);
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  8010ee:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010f1:	a3 4c 57 80 00       	mov    %eax,0x80574c
+}
+  8010f6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8010f9:	c9                   	leave
+  8010fa:	c3                   	ret
+    envid_t id = sys_getenvid();
+  8010fb:	e8 ae fa ff ff       	call   800bae <sys_getenvid>
+  801100:	89 c3                	mov    %eax,%ebx
+    sys_page_alloc(id, (void *) (UXSTACKTOP - PGSIZE), (PTE_P | PTE_U | PTE_W));
+  801102:	83 ec 04             	sub    $0x4,%esp
+  801105:	6a 07                	push   $0x7
+  801107:	68 00 f0 bf ee       	push   $0xeebff000
+  80110c:	50                   	push   %eax
+  80110d:	e8 1d fb ff ff       	call   800c2f <sys_page_alloc>
+    sys_env_set_pgfault_upcall(id, _pgfault_upcall);
+  801112:	83 c4 08             	add    $0x8,%esp
+  801115:	68 25 11 80 00       	push   $0x801125
+  80111a:	53                   	push   %ebx
+  80111b:	e8 84 fd ff ff       	call   800ea4 <sys_env_set_pgfault_upcall>
+  801120:	83 c4 10             	add    $0x10,%esp
+  801123:	eb c9                	jmp    8010ee <set_pgfault_handler+0x10>
+
+00801125 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  801125:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  801126:	a1 4c 57 80 00       	mov    0x80574c,%eax
+	call *%eax
+  80112b:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80112d:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+  movl 48(%esp), %eax       // move trap time esp to eax
+  801130:	8b 44 24 30          	mov    0x30(%esp),%eax
+  subl $4, %eax             // make room for eip on trap time esp
+  801134:	83 e8 04             	sub    $0x4,%eax
+  movl %eax, 48(%esp)       // move value to esp
+  801137:	89 44 24 30          	mov    %eax,0x30(%esp)
+  movl 40(%esp), %ebx       // move trap time eip to ebx
+  80113b:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+  movl %ebx, 0(%eax)
+  80113f:	89 18                	mov    %ebx,(%eax)
+
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+  addl $0x08,%esp
+  801141:	83 c4 08             	add    $0x8,%esp
+  popal
+  801144:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+  addl $4, %esp          // skip tf->eip
+  801145:	83 c4 04             	add    $0x4,%esp
+  popf                 // pop stack value into flags register
+  801148:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+  popl %esp
+  801149:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+  ret
+  80114a:	c3                   	ret
+
+0080114b <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80114b:	55                   	push   %ebp
+  80114c:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80114e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801151:	05 00 00 00 30       	add    $0x30000000,%eax
+  801156:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801159:	5d                   	pop    %ebp
+  80115a:	c3                   	ret
+
+0080115b <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80115b:	55                   	push   %ebp
+  80115c:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80115e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801161:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  801164:	66 b8 00 00          	mov    $0x0,%ax
+  801168:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80116d:	5d                   	pop    %ebp
+  80116e:	c3                   	ret
+
+0080116f <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80116f:	55                   	push   %ebp
+  801170:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  801172:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801177:	eb 02                	jmp    80117b <fd_alloc+0xc>
+  801179:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80117b:	89 c2                	mov    %eax,%edx
+  80117d:	c1 ea 16             	shr    $0x16,%edx
+  801180:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801187:	f6 c2 01             	test   $0x1,%dl
+  80118a:	74 2b                	je     8011b7 <fd_alloc+0x48>
+  80118c:	89 c2                	mov    %eax,%edx
+  80118e:	c1 ea 0c             	shr    $0xc,%edx
+  801191:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801198:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80119e:	f6 c1 01             	test   $0x1,%cl
+  8011a1:	74 14                	je     8011b7 <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  8011a3:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8011a9:	75 ce                	jne    801179 <fd_alloc+0xa>
+  8011ab:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  8011b0:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8011b5:	eb 05                	jmp    8011bc <fd_alloc+0x4d>
+      return 0;
+  8011b7:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  8011bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011bf:	89 02                	mov    %eax,(%edx)
+}
+  8011c1:	89 c8                	mov    %ecx,%eax
+  8011c3:	5d                   	pop    %ebp
+  8011c4:	c3                   	ret
+
+008011c5 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8011c5:	55                   	push   %ebp
+  8011c6:	89 e5                	mov    %esp,%ebp
+  8011c8:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  8011cb:	83 f8 1f             	cmp    $0x1f,%eax
+  8011ce:	77 30                	ja     801200 <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  8011d0:	c1 e0 0c             	shl    $0xc,%eax
+  8011d3:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8011d8:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8011de:	f6 c2 01             	test   $0x1,%dl
+  8011e1:	74 24                	je     801207 <fd_lookup+0x42>
+  8011e3:	89 c2                	mov    %eax,%edx
+  8011e5:	c1 ea 0c             	shr    $0xc,%edx
+  8011e8:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8011ef:	f6 c2 01             	test   $0x1,%dl
+  8011f2:	74 1a                	je     80120e <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  8011f4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8011f7:	89 02                	mov    %eax,(%edx)
+  return 0;
+  8011f9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011fe:	5d                   	pop    %ebp
+  8011ff:	c3                   	ret
+    return -E_INVAL;
+  801200:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801205:	eb f7                	jmp    8011fe <fd_lookup+0x39>
+    return -E_INVAL;
+  801207:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80120c:	eb f0                	jmp    8011fe <fd_lookup+0x39>
+  80120e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801213:	eb e9                	jmp    8011fe <fd_lookup+0x39>
+
+00801215 <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801215:	55                   	push   %ebp
+  801216:	89 e5                	mov    %esp,%ebp
+  801218:	53                   	push   %ebx
+  801219:	83 ec 04             	sub    $0x4,%esp
+  80121c:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  80121f:	b8 ac 33 80 00       	mov    $0x8033ac,%eax
+  801224:	8b 18                	mov    (%eax),%ebx
+  801226:	85 db                	test   %ebx,%ebx
+  801228:	74 0e                	je     801238 <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  80122a:	83 c0 04             	add    $0x4,%eax
+  80122d:	39 13                	cmp    %edx,(%ebx)
+  80122f:	75 f3                	jne    801224 <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  801231:	b8 00 00 00 00       	mov    $0x0,%eax
+  801236:	eb 1f                	jmp    801257 <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801238:	a1 44 57 80 00       	mov    0x805744,%eax
+  80123d:	8b 40 48             	mov    0x48(%eax),%eax
+  801240:	83 ec 04             	sub    $0x4,%esp
+  801243:	52                   	push   %edx
+  801244:	50                   	push   %eax
+  801245:	68 30 33 80 00       	push   $0x803330
+  80124a:	e8 c3 ef ff ff       	call   800212 <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  80124f:	83 c4 10             	add    $0x10,%esp
+  801252:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  801257:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80125a:	89 1a                	mov    %ebx,(%edx)
+}
+  80125c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80125f:	c9                   	leave
+  801260:	c3                   	ret
+
+00801261 <fd_close>:
+{
+  801261:	55                   	push   %ebp
+  801262:	89 e5                	mov    %esp,%ebp
+  801264:	57                   	push   %edi
+  801265:	56                   	push   %esi
+  801266:	53                   	push   %ebx
+  801267:	83 ec 24             	sub    $0x24,%esp
+  80126a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80126d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801270:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801273:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801274:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80127a:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80127d:	50                   	push   %eax
+  80127e:	e8 42 ff ff ff       	call   8011c5 <fd_lookup>
+  801283:	89 c3                	mov    %eax,%ebx
+  801285:	83 c4 10             	add    $0x10,%esp
+  801288:	85 c0                	test   %eax,%eax
+  80128a:	78 05                	js     801291 <fd_close+0x30>
+      || fd != fd2)
+  80128c:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80128f:	74 16                	je     8012a7 <fd_close+0x46>
+    return must_exist ? r : 0;
+  801291:	89 f8                	mov    %edi,%eax
+  801293:	84 c0                	test   %al,%al
+  801295:	b8 00 00 00 00       	mov    $0x0,%eax
+  80129a:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80129d:	89 d8                	mov    %ebx,%eax
+  80129f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012a2:	5b                   	pop    %ebx
+  8012a3:	5e                   	pop    %esi
+  8012a4:	5f                   	pop    %edi
+  8012a5:	5d                   	pop    %ebp
+  8012a6:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8012a7:	83 ec 08             	sub    $0x8,%esp
+  8012aa:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8012ad:	50                   	push   %eax
+  8012ae:	ff 36                	push   (%esi)
+  8012b0:	e8 60 ff ff ff       	call   801215 <dev_lookup>
+  8012b5:	89 c3                	mov    %eax,%ebx
+  8012b7:	83 c4 10             	add    $0x10,%esp
+  8012ba:	85 c0                	test   %eax,%eax
+  8012bc:	78 1a                	js     8012d8 <fd_close+0x77>
+    if (dev->dev_close)
+  8012be:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8012c1:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  8012c4:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  8012c9:	85 c0                	test   %eax,%eax
+  8012cb:	74 0b                	je     8012d8 <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  8012cd:	83 ec 0c             	sub    $0xc,%esp
+  8012d0:	56                   	push   %esi
+  8012d1:	ff d0                	call   *%eax
+  8012d3:	89 c3                	mov    %eax,%ebx
+  8012d5:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  8012d8:	83 ec 08             	sub    $0x8,%esp
+  8012db:	56                   	push   %esi
+  8012dc:	6a 00                	push   $0x0
+  8012de:	e8 d1 f9 ff ff       	call   800cb4 <sys_page_unmap>
+  return r;
+  8012e3:	83 c4 10             	add    $0x10,%esp
+  8012e6:	eb b5                	jmp    80129d <fd_close+0x3c>
+
+008012e8 <close>:
+
+int
+close(int fdnum)
+{
+  8012e8:	55                   	push   %ebp
+  8012e9:	89 e5                	mov    %esp,%ebp
+  8012eb:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8012ee:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8012f1:	50                   	push   %eax
+  8012f2:	ff 75 08             	push   0x8(%ebp)
+  8012f5:	e8 cb fe ff ff       	call   8011c5 <fd_lookup>
+  8012fa:	83 c4 10             	add    $0x10,%esp
+  8012fd:	85 c0                	test   %eax,%eax
+  8012ff:	79 02                	jns    801303 <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  801301:	c9                   	leave
+  801302:	c3                   	ret
+    return fd_close(fd, 1);
+  801303:	83 ec 08             	sub    $0x8,%esp
+  801306:	6a 01                	push   $0x1
+  801308:	ff 75 f4             	push   -0xc(%ebp)
+  80130b:	e8 51 ff ff ff       	call   801261 <fd_close>
+  801310:	83 c4 10             	add    $0x10,%esp
+  801313:	eb ec                	jmp    801301 <close+0x19>
+
+00801315 <close_all>:
+
+void
+close_all(void)
+{
+  801315:	55                   	push   %ebp
+  801316:	89 e5                	mov    %esp,%ebp
+  801318:	53                   	push   %ebx
+  801319:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  80131c:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  801321:	83 ec 0c             	sub    $0xc,%esp
+  801324:	53                   	push   %ebx
+  801325:	e8 be ff ff ff       	call   8012e8 <close>
+  for (i = 0; i < MAXFD; i++)
+  80132a:	83 c3 01             	add    $0x1,%ebx
+  80132d:	83 c4 10             	add    $0x10,%esp
+  801330:	83 fb 20             	cmp    $0x20,%ebx
+  801333:	75 ec                	jne    801321 <close_all+0xc>
+}
+  801335:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801338:	c9                   	leave
+  801339:	c3                   	ret
+
+0080133a <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80133a:	55                   	push   %ebp
+  80133b:	89 e5                	mov    %esp,%ebp
+  80133d:	57                   	push   %edi
+  80133e:	56                   	push   %esi
+  80133f:	53                   	push   %ebx
+  801340:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801343:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801346:	50                   	push   %eax
+  801347:	ff 75 08             	push   0x8(%ebp)
+  80134a:	e8 76 fe ff ff       	call   8011c5 <fd_lookup>
+  80134f:	89 c6                	mov    %eax,%esi
+  801351:	83 c4 10             	add    $0x10,%esp
+  801354:	85 c0                	test   %eax,%eax
+  801356:	0f 88 0a 01 00 00    	js     801466 <dup+0x12c>
+    return r;
+  close(newfdnum);
+  80135c:	83 ec 0c             	sub    $0xc,%esp
+  80135f:	ff 75 0c             	push   0xc(%ebp)
+  801362:	e8 81 ff ff ff       	call   8012e8 <close>
+
+  newfd = INDEX2FD(newfdnum);
+  801367:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80136a:	c1 e0 0c             	shl    $0xc,%eax
+  80136d:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  801373:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  801376:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801379:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  80137c:	89 04 24             	mov    %eax,(%esp)
+  80137f:	e8 d7 fd ff ff       	call   80115b <fd2data>
+  801384:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  801386:	89 3c 24             	mov    %edi,(%esp)
+  801389:	e8 cd fd ff ff       	call   80115b <fd2data>
+  80138e:	83 c4 10             	add    $0x10,%esp
+  801391:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801394:	89 f3                	mov    %esi,%ebx
+  801396:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  80139c:	89 c6                	mov    %eax,%esi
+  80139e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8013a1:	89 cf                	mov    %ecx,%edi
+  8013a3:	eb 0c                	jmp    8013b1 <dup+0x77>
+  8013a5:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8013ab:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8013b1:	39 fb                	cmp    %edi,%ebx
+  8013b3:	74 7b                	je     801430 <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  8013b5:	89 d8                	mov    %ebx,%eax
+  8013b7:	c1 e8 16             	shr    $0x16,%eax
+  8013ba:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8013c1:	a8 01                	test   $0x1,%al
+  8013c3:	74 e0                	je     8013a5 <dup+0x6b>
+  8013c5:	89 d8                	mov    %ebx,%eax
+  8013c7:	c1 e8 0c             	shr    $0xc,%eax
+  8013ca:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8013d1:	f6 c2 01             	test   $0x1,%dl
+  8013d4:	74 cf                	je     8013a5 <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  8013d6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  8013dd:	83 ec 0c             	sub    $0xc,%esp
+  8013e0:	25 07 0e 00 00       	and    $0xe07,%eax
+  8013e5:	50                   	push   %eax
+  8013e6:	56                   	push   %esi
+  8013e7:	6a 00                	push   $0x0
+  8013e9:	53                   	push   %ebx
+  8013ea:	6a 00                	push   $0x0
+  8013ec:	e8 81 f8 ff ff       	call   800c72 <sys_page_map>
+  8013f1:	83 c4 20             	add    $0x20,%esp
+  8013f4:	85 c0                	test   %eax,%eax
+  8013f6:	79 ad                	jns    8013a5 <dup+0x6b>
+  8013f8:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8013fb:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  8013fd:	83 ec 08             	sub    $0x8,%esp
+  801400:	ff 75 d4             	push   -0x2c(%ebp)
+  801403:	6a 00                	push   $0x0
+  801405:	e8 aa f8 ff ff       	call   800cb4 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80140a:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  80140d:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  801413:	83 c4 10             	add    $0x10,%esp
+  801416:	39 df                	cmp    %ebx,%edi
+  801418:	74 4c                	je     801466 <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  80141a:	83 ec 08             	sub    $0x8,%esp
+  80141d:	57                   	push   %edi
+  80141e:	6a 00                	push   $0x0
+  801420:	e8 8f f8 ff ff       	call   800cb4 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801425:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  80142b:	83 c4 10             	add    $0x10,%esp
+  80142e:	eb e6                	jmp    801416 <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801430:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801433:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  801436:	89 c8                	mov    %ecx,%eax
+  801438:	c1 e8 0c             	shr    $0xc,%eax
+  80143b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801442:	83 ec 0c             	sub    $0xc,%esp
+  801445:	25 07 0e 00 00       	and    $0xe07,%eax
+  80144a:	50                   	push   %eax
+  80144b:	ff 75 d4             	push   -0x2c(%ebp)
+  80144e:	6a 00                	push   $0x0
+  801450:	51                   	push   %ecx
+  801451:	6a 00                	push   $0x0
+  801453:	e8 1a f8 ff ff       	call   800c72 <sys_page_map>
+  801458:	89 c6                	mov    %eax,%esi
+  80145a:	83 c4 20             	add    $0x20,%esp
+  80145d:	85 c0                	test   %eax,%eax
+  80145f:	78 9c                	js     8013fd <dup+0xc3>
+  return newfdnum;
+  801461:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801464:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  801466:	89 f0                	mov    %esi,%eax
+  801468:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80146b:	5b                   	pop    %ebx
+  80146c:	5e                   	pop    %esi
+  80146d:	5f                   	pop    %edi
+  80146e:	5d                   	pop    %ebp
+  80146f:	c3                   	ret
+
+00801470 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801470:	55                   	push   %ebp
+  801471:	89 e5                	mov    %esp,%ebp
+  801473:	56                   	push   %esi
+  801474:	53                   	push   %ebx
+  801475:	83 ec 18             	sub    $0x18,%esp
+  801478:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  80147b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80147e:	50                   	push   %eax
+  80147f:	56                   	push   %esi
+  801480:	e8 40 fd ff ff       	call   8011c5 <fd_lookup>
+  801485:	83 c4 10             	add    $0x10,%esp
+  801488:	85 c0                	test   %eax,%eax
+  80148a:	78 3c                	js     8014c8 <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80148c:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80148f:	83 ec 08             	sub    $0x8,%esp
+  801492:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801495:	50                   	push   %eax
+  801496:	ff 33                	push   (%ebx)
+  801498:	e8 78 fd ff ff       	call   801215 <dev_lookup>
+  80149d:	83 c4 10             	add    $0x10,%esp
+  8014a0:	85 c0                	test   %eax,%eax
+  8014a2:	78 24                	js     8014c8 <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8014a4:	8b 43 08             	mov    0x8(%ebx),%eax
+  8014a7:	83 e0 03             	and    $0x3,%eax
+  8014aa:	83 f8 01             	cmp    $0x1,%eax
+  8014ad:	74 20                	je     8014cf <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  8014af:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014b2:	8b 40 08             	mov    0x8(%eax),%eax
+  8014b5:	85 c0                	test   %eax,%eax
+  8014b7:	74 37                	je     8014f0 <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  8014b9:	83 ec 04             	sub    $0x4,%esp
+  8014bc:	ff 75 10             	push   0x10(%ebp)
+  8014bf:	ff 75 0c             	push   0xc(%ebp)
+  8014c2:	53                   	push   %ebx
+  8014c3:	ff d0                	call   *%eax
+  8014c5:	83 c4 10             	add    $0x10,%esp
+}
+  8014c8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014cb:	5b                   	pop    %ebx
+  8014cc:	5e                   	pop    %esi
+  8014cd:	5d                   	pop    %ebp
+  8014ce:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8014cf:	a1 44 57 80 00       	mov    0x805744,%eax
+  8014d4:	8b 40 48             	mov    0x48(%eax),%eax
+  8014d7:	83 ec 04             	sub    $0x4,%esp
+  8014da:	56                   	push   %esi
+  8014db:	50                   	push   %eax
+  8014dc:	68 71 33 80 00       	push   $0x803371
+  8014e1:	e8 2c ed ff ff       	call   800212 <cprintf>
+    return -E_INVAL;
+  8014e6:	83 c4 10             	add    $0x10,%esp
+  8014e9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014ee:	eb d8                	jmp    8014c8 <read+0x58>
+    return -E_NOT_SUPP;
+  8014f0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8014f5:	eb d1                	jmp    8014c8 <read+0x58>
+
+008014f7 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8014f7:	55                   	push   %ebp
+  8014f8:	89 e5                	mov    %esp,%ebp
+  8014fa:	57                   	push   %edi
+  8014fb:	56                   	push   %esi
+  8014fc:	53                   	push   %ebx
+  8014fd:	83 ec 0c             	sub    $0xc,%esp
+  801500:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801503:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  801506:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80150b:	eb 02                	jmp    80150f <readn+0x18>
+  80150d:	01 c3                	add    %eax,%ebx
+  80150f:	39 f3                	cmp    %esi,%ebx
+  801511:	73 21                	jae    801534 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  801513:	83 ec 04             	sub    $0x4,%esp
+  801516:	89 f0                	mov    %esi,%eax
+  801518:	29 d8                	sub    %ebx,%eax
+  80151a:	50                   	push   %eax
+  80151b:	89 d8                	mov    %ebx,%eax
+  80151d:	03 45 0c             	add    0xc(%ebp),%eax
+  801520:	50                   	push   %eax
+  801521:	57                   	push   %edi
+  801522:	e8 49 ff ff ff       	call   801470 <read>
+    if (m < 0)
+  801527:	83 c4 10             	add    $0x10,%esp
+  80152a:	85 c0                	test   %eax,%eax
+  80152c:	78 04                	js     801532 <readn+0x3b>
+      return m;
+    if (m == 0)
+  80152e:	75 dd                	jne    80150d <readn+0x16>
+  801530:	eb 02                	jmp    801534 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  801532:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  801534:	89 d8                	mov    %ebx,%eax
+  801536:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801539:	5b                   	pop    %ebx
+  80153a:	5e                   	pop    %esi
+  80153b:	5f                   	pop    %edi
+  80153c:	5d                   	pop    %ebp
+  80153d:	c3                   	ret
+
+0080153e <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80153e:	55                   	push   %ebp
+  80153f:	89 e5                	mov    %esp,%ebp
+  801541:	56                   	push   %esi
+  801542:	53                   	push   %ebx
+  801543:	83 ec 18             	sub    $0x18,%esp
+  801546:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801549:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80154c:	50                   	push   %eax
+  80154d:	53                   	push   %ebx
+  80154e:	e8 72 fc ff ff       	call   8011c5 <fd_lookup>
+  801553:	83 c4 10             	add    $0x10,%esp
+  801556:	85 c0                	test   %eax,%eax
+  801558:	78 37                	js     801591 <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80155a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80155d:	83 ec 08             	sub    $0x8,%esp
+  801560:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801563:	50                   	push   %eax
+  801564:	ff 36                	push   (%esi)
+  801566:	e8 aa fc ff ff       	call   801215 <dev_lookup>
+  80156b:	83 c4 10             	add    $0x10,%esp
+  80156e:	85 c0                	test   %eax,%eax
+  801570:	78 1f                	js     801591 <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801572:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801576:	74 20                	je     801598 <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  801578:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80157b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80157e:	85 c0                	test   %eax,%eax
+  801580:	74 37                	je     8015b9 <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  801582:	83 ec 04             	sub    $0x4,%esp
+  801585:	ff 75 10             	push   0x10(%ebp)
+  801588:	ff 75 0c             	push   0xc(%ebp)
+  80158b:	56                   	push   %esi
+  80158c:	ff d0                	call   *%eax
+  80158e:	83 c4 10             	add    $0x10,%esp
+}
+  801591:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801594:	5b                   	pop    %ebx
+  801595:	5e                   	pop    %esi
+  801596:	5d                   	pop    %ebp
+  801597:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801598:	a1 44 57 80 00       	mov    0x805744,%eax
+  80159d:	8b 40 48             	mov    0x48(%eax),%eax
+  8015a0:	83 ec 04             	sub    $0x4,%esp
+  8015a3:	53                   	push   %ebx
+  8015a4:	50                   	push   %eax
+  8015a5:	68 8d 33 80 00       	push   $0x80338d
+  8015aa:	e8 63 ec ff ff       	call   800212 <cprintf>
+    return -E_INVAL;
+  8015af:	83 c4 10             	add    $0x10,%esp
+  8015b2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015b7:	eb d8                	jmp    801591 <write+0x53>
+    return -E_NOT_SUPP;
+  8015b9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015be:	eb d1                	jmp    801591 <write+0x53>
+
+008015c0 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8015c0:	55                   	push   %ebp
+  8015c1:	89 e5                	mov    %esp,%ebp
+  8015c3:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8015c6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015c9:	50                   	push   %eax
+  8015ca:	ff 75 08             	push   0x8(%ebp)
+  8015cd:	e8 f3 fb ff ff       	call   8011c5 <fd_lookup>
+  8015d2:	83 c4 10             	add    $0x10,%esp
+  8015d5:	85 c0                	test   %eax,%eax
+  8015d7:	78 0e                	js     8015e7 <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  8015d9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8015dc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015df:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  8015e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015e7:	c9                   	leave
+  8015e8:	c3                   	ret
+
+008015e9 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8015e9:	55                   	push   %ebp
+  8015ea:	89 e5                	mov    %esp,%ebp
+  8015ec:	56                   	push   %esi
+  8015ed:	53                   	push   %ebx
+  8015ee:	83 ec 18             	sub    $0x18,%esp
+  8015f1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  8015f4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8015f7:	50                   	push   %eax
+  8015f8:	53                   	push   %ebx
+  8015f9:	e8 c7 fb ff ff       	call   8011c5 <fd_lookup>
+  8015fe:	83 c4 10             	add    $0x10,%esp
+  801601:	85 c0                	test   %eax,%eax
+  801603:	78 34                	js     801639 <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801605:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801608:	83 ec 08             	sub    $0x8,%esp
+  80160b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80160e:	50                   	push   %eax
+  80160f:	ff 36                	push   (%esi)
+  801611:	e8 ff fb ff ff       	call   801215 <dev_lookup>
+  801616:	83 c4 10             	add    $0x10,%esp
+  801619:	85 c0                	test   %eax,%eax
+  80161b:	78 1c                	js     801639 <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80161d:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801621:	74 1d                	je     801640 <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  801623:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801626:	8b 40 18             	mov    0x18(%eax),%eax
+  801629:	85 c0                	test   %eax,%eax
+  80162b:	74 34                	je     801661 <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  80162d:	83 ec 08             	sub    $0x8,%esp
+  801630:	ff 75 0c             	push   0xc(%ebp)
+  801633:	56                   	push   %esi
+  801634:	ff d0                	call   *%eax
+  801636:	83 c4 10             	add    $0x10,%esp
+}
+  801639:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80163c:	5b                   	pop    %ebx
+  80163d:	5e                   	pop    %esi
+  80163e:	5d                   	pop    %ebp
+  80163f:	c3                   	ret
+            thisenv->env_id, fdnum);
+  801640:	a1 44 57 80 00       	mov    0x805744,%eax
+  801645:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801648:	83 ec 04             	sub    $0x4,%esp
+  80164b:	53                   	push   %ebx
+  80164c:	50                   	push   %eax
+  80164d:	68 50 33 80 00       	push   $0x803350
+  801652:	e8 bb eb ff ff       	call   800212 <cprintf>
+    return -E_INVAL;
+  801657:	83 c4 10             	add    $0x10,%esp
+  80165a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80165f:	eb d8                	jmp    801639 <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  801661:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801666:	eb d1                	jmp    801639 <ftruncate+0x50>
+
+00801668 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801668:	55                   	push   %ebp
+  801669:	89 e5                	mov    %esp,%ebp
+  80166b:	56                   	push   %esi
+  80166c:	53                   	push   %ebx
+  80166d:	83 ec 18             	sub    $0x18,%esp
+  801670:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801673:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801676:	50                   	push   %eax
+  801677:	ff 75 08             	push   0x8(%ebp)
+  80167a:	e8 46 fb ff ff       	call   8011c5 <fd_lookup>
+  80167f:	83 c4 10             	add    $0x10,%esp
+  801682:	85 c0                	test   %eax,%eax
+  801684:	78 49                	js     8016cf <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801686:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801689:	83 ec 08             	sub    $0x8,%esp
+  80168c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80168f:	50                   	push   %eax
+  801690:	ff 36                	push   (%esi)
+  801692:	e8 7e fb ff ff       	call   801215 <dev_lookup>
+  801697:	83 c4 10             	add    $0x10,%esp
+  80169a:	85 c0                	test   %eax,%eax
+  80169c:	78 31                	js     8016cf <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  80169e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016a1:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8016a5:	74 2f                	je     8016d6 <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  8016a7:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  8016aa:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8016b1:	00 00 00 
+  stat->st_isdir = 0;
+  8016b4:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8016bb:	00 00 00 
+  stat->st_dev = dev;
+  8016be:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  8016c4:	83 ec 08             	sub    $0x8,%esp
+  8016c7:	53                   	push   %ebx
+  8016c8:	56                   	push   %esi
+  8016c9:	ff 50 14             	call   *0x14(%eax)
+  8016cc:	83 c4 10             	add    $0x10,%esp
+}
+  8016cf:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016d2:	5b                   	pop    %ebx
+  8016d3:	5e                   	pop    %esi
+  8016d4:	5d                   	pop    %ebp
+  8016d5:	c3                   	ret
+    return -E_NOT_SUPP;
+  8016d6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016db:	eb f2                	jmp    8016cf <fstat+0x67>
+
+008016dd <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  8016dd:	55                   	push   %ebp
+  8016de:	89 e5                	mov    %esp,%ebp
+  8016e0:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  8016e3:	ff 75 0c             	push   0xc(%ebp)
+  8016e6:	ff 75 08             	push   0x8(%ebp)
+  8016e9:	e8 58 07 00 00       	call   801e46 <file_stat>
+}
+  8016ee:	c9                   	leave
+  8016ef:	c3                   	ret
+
+008016f0 <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  8016f0:	55                   	push   %ebp
+  8016f1:	89 e5                	mov    %esp,%ebp
+  8016f3:	57                   	push   %edi
+  8016f4:	56                   	push   %esi
+  8016f5:	53                   	push   %ebx
+  8016f6:	83 ec 1c             	sub    $0x1c,%esp
+  8016f9:	89 c7                	mov    %eax,%edi
+  8016fb:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8016fe:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801701:	e9 a2 00 00 00       	jmp    8017a8 <fsipc_send+0xb8>
+  nfsenvs = 0;
+  801706:	c7 05 00 50 80 00 00 	movl   $0x0,0x805000
+  80170d:	00 00 00 
+  801710:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801715:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  80171a:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  80171f:	be 01 00 00 00       	mov    $0x1,%esi
+  801724:	eb 0f                	jmp    801735 <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801726:	83 c0 01             	add    $0x1,%eax
+  801729:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80172e:	74 49                	je     801779 <fsipc_send+0x89>
+  801730:	83 f9 07             	cmp    $0x7,%ecx
+  801733:	7f 50                	jg     801785 <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  801735:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801738:	c1 e2 04             	shl    $0x4,%edx
+  80173b:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801741:	8b 52 50             	mov    0x50(%edx),%edx
+  801744:	83 fa 01             	cmp    $0x1,%edx
+  801747:	75 dd                	jne    801726 <fsipc_send+0x36>
+  801749:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  80174c:	c1 e2 04             	shl    $0x4,%edx
+  80174f:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801755:	8b 52 54             	mov    0x54(%edx),%edx
+  801758:	85 d2                	test   %edx,%edx
+  80175a:	74 ca                	je     801726 <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  80175c:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  80175f:	c1 e2 04             	shl    $0x4,%edx
+  801762:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801768:	8b 52 48             	mov    0x48(%edx),%edx
+  80176b:	89 14 8d 20 50 80 00 	mov    %edx,0x805020(,%ecx,4)
+  801772:	8d 49 01             	lea    0x1(%ecx),%ecx
+  801775:	89 f3                	mov    %esi,%ebx
+  801777:	eb ad                	jmp    801726 <fsipc_send+0x36>
+  801779:	84 db                	test   %bl,%bl
+  80177b:	74 38                	je     8017b5 <fsipc_send+0xc5>
+  80177d:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  801783:	eb 30                	jmp    8017b5 <fsipc_send+0xc5>
+  801785:	84 db                	test   %bl,%bl
+  801787:	74 2c                	je     8017b5 <fsipc_send+0xc5>
+  801789:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  80178f:	eb 24                	jmp    8017b5 <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  801791:	50                   	push   %eax
+  801792:	68 bc 33 80 00       	push   $0x8033bc
+  801797:	6a 34                	push   $0x34
+  801799:	68 c6 33 80 00       	push   $0x8033c6
+  80179e:	e8 94 e9 ff ff       	call   800137 <_panic>
+    }
+    sys_yield();
+  8017a3:	e8 25 f4 ff ff       	call   800bcd <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  8017a8:	83 3d 00 50 80 00 03 	cmpl   $0x3,0x805000
+  8017af:	0f 8e 51 ff ff ff    	jle    801706 <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  8017b5:	a1 44 57 80 00       	mov    0x805744,%eax
+  8017ba:	8b 70 48             	mov    0x48(%eax),%esi
+  8017bd:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  8017c3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017c8:	8b 0d 00 50 80 00    	mov    0x805000,%ecx
+  8017ce:	39 d9                	cmp    %ebx,%ecx
+  8017d0:	7e d1                	jle    8017a3 <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  8017d2:	83 ec 0c             	sub    $0xc,%esp
+  8017d5:	ff 75 e0             	push   -0x20(%ebp)
+  8017d8:	6a 07                	push   $0x7
+  8017da:	ff 75 e4             	push   -0x1c(%ebp)
+  8017dd:	57                   	push   %edi
+  8017de:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  8017e1:	99                   	cltd
+  8017e2:	f7 f9                	idiv   %ecx
+  8017e4:	ff 34 95 20 50 80 00 	push   0x805020(,%edx,4)
+  8017eb:	e8 f6 f6 ff ff       	call   800ee6 <sys_ipc_try_send>
+      if (r == 0)
+  8017f0:	83 c4 20             	add    $0x20,%esp
+  8017f3:	85 c0                	test   %eax,%eax
+  8017f5:	74 0a                	je     801801 <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  8017f7:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8017fa:	75 95                	jne    801791 <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  8017fc:	83 c3 01             	add    $0x1,%ebx
+  8017ff:	eb c7                	jmp    8017c8 <fsipc_send+0xd8>
+  }
+}
+  801801:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801804:	5b                   	pop    %ebx
+  801805:	5e                   	pop    %esi
+  801806:	5f                   	pop    %edi
+  801807:	5d                   	pop    %ebp
+  801808:	c3                   	ret
+
+00801809 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801809:	55                   	push   %ebp
+  80180a:	89 e5                	mov    %esp,%ebp
+  80180c:	53                   	push   %ebx
+  80180d:	83 ec 14             	sub    $0x14,%esp
+  801810:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  801812:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  801819:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80181e:	ba 00 60 80 00       	mov    $0x806000,%edx
+  801823:	e8 c8 fe ff ff       	call   8016f0 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801828:	6a 00                	push   $0x0
+  80182a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80182d:	50                   	push   %eax
+  80182e:	53                   	push   %ebx
+  80182f:	6a 00                	push   $0x0
+  801831:	e8 26 13 00 00       	call   802b5c <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  801836:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801839:	c9                   	leave
+  80183a:	c3                   	ret
+
+0080183b <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  80183b:	55                   	push   %ebp
+  80183c:	89 e5                	mov    %esp,%ebp
+  80183e:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801841:	8b 45 08             	mov    0x8(%ebp),%eax
+  801844:	8b 40 0c             	mov    0xc(%eax),%eax
+  801847:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.set_size.req_size = newsize;
+  80184c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80184f:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801854:	ba 00 00 00 00       	mov    $0x0,%edx
+  801859:	b8 02 00 00 00       	mov    $0x2,%eax
+  80185e:	e8 a6 ff ff ff       	call   801809 <fsipc>
+}
+  801863:	c9                   	leave
+  801864:	c3                   	ret
+
+00801865 <devfile_flush>:
+{
+  801865:	55                   	push   %ebp
+  801866:	89 e5                	mov    %esp,%ebp
+  801868:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80186b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80186e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801871:	a3 00 60 80 00       	mov    %eax,0x806000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801876:	ba 00 00 00 00       	mov    $0x0,%edx
+  80187b:	b8 06 00 00 00       	mov    $0x6,%eax
+  801880:	e8 84 ff ff ff       	call   801809 <fsipc>
+}
+  801885:	c9                   	leave
+  801886:	c3                   	ret
+
+00801887 <devfile_stat>:
+{
+  801887:	55                   	push   %ebp
+  801888:	89 e5                	mov    %esp,%ebp
+  80188a:	53                   	push   %ebx
+  80188b:	83 ec 04             	sub    $0x4,%esp
+  80188e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801891:	8b 45 08             	mov    0x8(%ebp),%eax
+  801894:	8b 40 0c             	mov    0xc(%eax),%eax
+  801897:	a3 00 60 80 00       	mov    %eax,0x806000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80189c:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018a1:	b8 05 00 00 00       	mov    $0x5,%eax
+  8018a6:	e8 5e ff ff ff       	call   801809 <fsipc>
+  8018ab:	85 c0                	test   %eax,%eax
+  8018ad:	78 2c                	js     8018db <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8018af:	83 ec 08             	sub    $0x8,%esp
+  8018b2:	68 00 60 80 00       	push   $0x806000
+  8018b7:	53                   	push   %ebx
+  8018b8:	e8 43 ef ff ff       	call   800800 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  8018bd:	a1 80 60 80 00       	mov    0x806080,%eax
+  8018c2:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8018c8:	a1 84 60 80 00       	mov    0x806084,%eax
+  8018cd:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  8018d3:	83 c4 10             	add    $0x10,%esp
+  8018d6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018db:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018de:	c9                   	leave
+  8018df:	c3                   	ret
+
+008018e0 <fsv_alloc>:
+{
+  8018e0:	55                   	push   %ebp
+  8018e1:	89 e5                	mov    %esp,%ebp
+  8018e3:	56                   	push   %esi
+  8018e4:	53                   	push   %ebx
+  8018e5:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  8018e7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018ec:	eb 22                	jmp    801910 <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  8018ee:	83 ec 04             	sub    $0x4,%esp
+  8018f1:	6a 00                	push   $0x0
+  8018f3:	6a 00                	push   $0x0
+  8018f5:	6a 07                	push   $0x7
+  8018f7:	50                   	push   %eax
+  8018f8:	6a 00                	push   $0x0
+  8018fa:	6a 04                	push   $0x4
+  8018fc:	68 40 50 80 00       	push   $0x805040
+  801901:	e8 7c f7 ff ff       	call   801082 <sysbatch_add>
+  801906:	83 c4 20             	add    $0x20,%esp
+  801909:	85 c0                	test   %eax,%eax
+  80190b:	78 48                	js     801955 <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  80190d:	83 c3 01             	add    $0x1,%ebx
+  801910:	39 f3                	cmp    %esi,%ebx
+  801912:	74 31                	je     801945 <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  801914:	89 d8                	mov    %ebx,%eax
+  801916:	c1 e0 0c             	shl    $0xc,%eax
+  801919:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  80191e:	89 c2                	mov    %eax,%edx
+  801920:	c1 ea 16             	shr    $0x16,%edx
+  801923:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80192a:	f6 c2 01             	test   $0x1,%dl
+  80192d:	74 bf                	je     8018ee <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  80192f:	89 c2                	mov    %eax,%edx
+  801931:	c1 ea 0c             	shr    $0xc,%edx
+  801934:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80193b:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  80193e:	83 fa 03             	cmp    $0x3,%edx
+  801941:	75 ab                	jne    8018ee <fsv_alloc+0xe>
+  801943:	eb c8                	jmp    80190d <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  801945:	83 ec 0c             	sub    $0xc,%esp
+  801948:	68 40 50 80 00       	push   $0x805040
+  80194d:	e8 e0 f6 ff ff       	call   801032 <sysbatch_flush>
+  801952:	83 c4 10             	add    $0x10,%esp
+}
+  801955:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801958:	5b                   	pop    %ebx
+  801959:	5e                   	pop    %esi
+  80195a:	5d                   	pop    %ebp
+  80195b:	c3                   	ret
+
+0080195c <devfile_read>:
+{
+  80195c:	55                   	push   %ebp
+  80195d:	89 e5                	mov    %esp,%ebp
+  80195f:	57                   	push   %edi
+  801960:	56                   	push   %esi
+  801961:	53                   	push   %ebx
+  801962:	83 ec 3c             	sub    $0x3c,%esp
+  801965:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  801968:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  80196e:	77 57                	ja     8019c7 <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801970:	8b 45 08             	mov    0x8(%ebp),%eax
+  801973:	8b 40 0c             	mov    0xc(%eax),%eax
+  801976:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read.req_n = n;
+  80197b:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801981:	ba 00 00 00 00       	mov    $0x0,%edx
+  801986:	b8 03 00 00 00       	mov    $0x3,%eax
+  80198b:	e8 79 fe ff ff       	call   801809 <fsipc>
+  801990:	89 c6                	mov    %eax,%esi
+  801992:	85 c0                	test   %eax,%eax
+  801994:	78 27                	js     8019bd <devfile_read+0x61>
+  assert(r <= n);
+  801996:	39 c3                	cmp    %eax,%ebx
+  801998:	0f 82 0e 02 00 00    	jb     801bac <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  80199e:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8019a3:	0f 8f 1c 02 00 00    	jg     801bc5 <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8019a9:	83 ec 04             	sub    $0x4,%esp
+  8019ac:	50                   	push   %eax
+  8019ad:	68 00 60 80 00       	push   $0x806000
+  8019b2:	ff 75 0c             	push   0xc(%ebp)
+  8019b5:	e8 cc ef ff ff       	call   800986 <memmove>
+  return r;
+  8019ba:	83 c4 10             	add    $0x10,%esp
+}
+  8019bd:	89 f0                	mov    %esi,%eax
+  8019bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019c2:	5b                   	pop    %ebx
+  8019c3:	5e                   	pop    %esi
+  8019c4:	5f                   	pop    %edi
+  8019c5:	5d                   	pop    %ebp
+  8019c6:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  8019c7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8019cc:	e8 0f ff ff ff       	call   8018e0 <fsv_alloc>
+  8019d1:	89 c6                	mov    %eax,%esi
+  8019d3:	85 c0                	test   %eax,%eax
+  8019d5:	78 e6                	js     8019bd <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  8019d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019da:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019dd:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  8019e2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019e5:	8b 40 04             	mov    0x4(%eax),%eax
+  8019e8:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  8019ed:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  8019f3:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  8019fa:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8019ff:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801a04:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801a09:	e8 e2 fc ff ff       	call   8016f0 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801a0e:	6a 00                	push   $0x0
+  801a10:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801a13:	50                   	push   %eax
+  801a14:	68 00 10 c0 9f       	push   $0x9fc01000
+  801a19:	6a 00                	push   $0x0
+  801a1b:	e8 3c 11 00 00       	call   802b5c <ipc_recv_pages>
+  801a20:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  801a22:	83 c4 10             	add    $0x10,%esp
+  801a25:	85 c0                	test   %eax,%eax
+  801a27:	7e 94                	jle    8019bd <devfile_read+0x61>
+  assert(r <= n);
+  801a29:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801a2c:	39 c3                	cmp    %eax,%ebx
+  801a2e:	72 2e                	jb     801a5e <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801a30:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a33:	8b 40 04             	mov    0x4(%eax),%eax
+  801a36:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801a3b:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  801a3e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801a41:	c1 e2 0c             	shl    $0xc,%edx
+  801a44:	39 ca                	cmp    %ecx,%edx
+  801a46:	72 2f                	jb     801a77 <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  801a48:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  801a4d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  801a50:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  801a54:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801a59:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  801a5c:	eb 52                	jmp    801ab0 <devfile_read+0x154>
+  assert(r <= n);
+  801a5e:	68 d1 33 80 00       	push   $0x8033d1
+  801a63:	68 d8 33 80 00       	push   $0x8033d8
+  801a68:	68 49 01 00 00       	push   $0x149
+  801a6d:	68 c6 33 80 00       	push   $0x8033c6
+  801a72:	e8 c0 e6 ff ff       	call   800137 <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801a77:	68 fc 33 80 00       	push   $0x8033fc
+  801a7c:	68 d8 33 80 00       	push   $0x8033d8
+  801a81:	68 4a 01 00 00       	push   $0x14a
+  801a86:	68 c6 33 80 00       	push   $0x8033c6
+  801a8b:	e8 a7 e6 ff ff       	call   800137 <_panic>
+      memmove(dst + done, src + done, m);
+  801a90:	83 ec 04             	sub    $0x4,%esp
+  801a93:	53                   	push   %ebx
+  801a94:	56                   	push   %esi
+  801a95:	89 f8                	mov    %edi,%eax
+  801a97:	03 45 0c             	add    0xc(%ebp),%eax
+  801a9a:	50                   	push   %eax
+  801a9b:	e8 e6 ee ff ff       	call   800986 <memmove>
+  801aa0:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  801aa3:	01 df                	add    %ebx,%edi
+  801aa5:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801aa8:	39 c7                	cmp    %eax,%edi
+  801aaa:	0f 83 c0 00 00 00    	jae    801b70 <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801ab0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801ab3:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  801ab6:	89 f0                	mov    %esi,%eax
+  801ab8:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801abd:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  801ac2:	29 c3                	sub    %eax,%ebx
+  801ac4:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801ac7:	29 f8                	sub    %edi,%eax
+  801ac9:	39 c3                	cmp    %eax,%ebx
+  801acb:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  801ace:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801ad4:	75 ba                	jne    801a90 <devfile_read+0x134>
+  801ad6:	89 f9                	mov    %edi,%ecx
+  801ad8:	03 4d 0c             	add    0xc(%ebp),%ecx
+  801adb:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  801ade:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  801ae4:	75 aa                	jne    801a90 <devfile_read+0x134>
+  801ae6:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  801aec:	77 a2                	ja     801a90 <devfile_read+0x134>
+  801aee:	89 c8                	mov    %ecx,%eax
+  801af0:	c1 e8 16             	shr    $0x16,%eax
+  801af3:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801afa:	a8 01                	test   $0x1,%al
+  801afc:	74 92                	je     801a90 <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  801afe:	89 c8                	mov    %ecx,%eax
+  801b00:	c1 e8 0c             	shr    $0xc,%eax
+  801b03:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  801b0a:	a8 01                	test   $0x1,%al
+  801b0c:	74 82                	je     801a90 <devfile_read+0x134>
+  801b0e:	a9 02 08 00 00       	test   $0x802,%eax
+  801b13:	0f 84 77 ff ff ff    	je     801a90 <devfile_read+0x134>
+  801b19:	f6 c4 04             	test   $0x4,%ah
+  801b1c:	0f 85 6e ff ff ff    	jne    801a90 <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  801b22:	a1 44 57 80 00       	mov    0x805744,%eax
+  801b27:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  801b2b:	84 c0                	test   %al,%al
+  801b2d:	75 17                	jne    801b46 <devfile_read+0x1ea>
+  801b2f:	83 ec 08             	sub    $0x8,%esp
+  801b32:	6a 01                	push   $0x1
+  801b34:	6a 00                	push   $0x0
+  801b36:	e8 b1 f0 ff ff       	call   800bec <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  801b3b:	83 c4 10             	add    $0x10,%esp
+  801b3e:	85 c0                	test   %eax,%eax
+  801b40:	0f 85 4a ff ff ff    	jne    801a90 <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  801b46:	83 ec 04             	sub    $0x4,%esp
+  801b49:	68 05 08 00 00       	push   $0x805
+  801b4e:	ff 75 cc             	push   -0x34(%ebp)
+  801b51:	6a 00                	push   $0x0
+  801b53:	56                   	push   %esi
+  801b54:	6a 00                	push   $0x0
+  801b56:	6a 05                	push   $0x5
+  801b58:	68 40 50 80 00       	push   $0x805040
+  801b5d:	e8 20 f5 ff ff       	call   801082 <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  801b62:	c1 e8 1f             	shr    $0x1f,%eax
+  801b65:	08 45 cb             	or     %al,-0x35(%ebp)
+  801b68:	83 c4 20             	add    $0x20,%esp
+  801b6b:	e9 33 ff ff ff       	jmp    801aa3 <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  801b70:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  801b73:	83 ec 0c             	sub    $0xc,%esp
+  801b76:	68 40 50 80 00       	push   $0x805040
+  801b7b:	e8 b2 f4 ff ff       	call   801032 <sysbatch_flush>
+  801b80:	83 c4 10             	add    $0x10,%esp
+  801b83:	85 c0                	test   %eax,%eax
+  801b85:	78 06                	js     801b8d <devfile_read+0x231>
+  801b87:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  801b8b:	74 14                	je     801ba1 <devfile_read+0x245>
+    memmove(dst, src, r);
+  801b8d:	83 ec 04             	sub    $0x4,%esp
+  801b90:	ff 75 d4             	push   -0x2c(%ebp)
+  801b93:	ff 75 d0             	push   -0x30(%ebp)
+  801b96:	ff 75 0c             	push   0xc(%ebp)
+  801b99:	e8 e8 ed ff ff       	call   800986 <memmove>
+  801b9e:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  801ba1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ba4:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  801ba7:	e9 11 fe ff ff       	jmp    8019bd <devfile_read+0x61>
+  assert(r <= n);
+  801bac:	68 d1 33 80 00       	push   $0x8033d1
+  801bb1:	68 d8 33 80 00       	push   $0x8033d8
+  801bb6:	68 1c 01 00 00       	push   $0x11c
+  801bbb:	68 c6 33 80 00       	push   $0x8033c6
+  801bc0:	e8 72 e5 ff ff       	call   800137 <_panic>
+  assert(r <= PGSIZE);
+  801bc5:	68 ed 33 80 00       	push   $0x8033ed
+  801bca:	68 d8 33 80 00       	push   $0x8033d8
+  801bcf:	68 1d 01 00 00       	push   $0x11d
+  801bd4:	68 c6 33 80 00       	push   $0x8033c6
+  801bd9:	e8 59 e5 ff ff       	call   800137 <_panic>
+
+00801bde <devfile_write>:
+{
+  801bde:	55                   	push   %ebp
+  801bdf:	89 e5                	mov    %esp,%ebp
+  801be1:	57                   	push   %edi
+  801be2:	56                   	push   %esi
+  801be3:	53                   	push   %ebx
+  801be4:	83 ec 1c             	sub    $0x1c,%esp
+  801be7:	8b 75 08             	mov    0x8(%ebp),%esi
+  801bea:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  801bed:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  801bf2:	77 39                	ja     801c2d <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801bf4:	8b 56 0c             	mov    0xc(%esi),%edx
+  801bf7:	89 15 00 60 80 00    	mov    %edx,0x806000
+  fsipcbuf.write.req_n = n;
+  801bfd:	a3 04 60 80 00       	mov    %eax,0x806004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  801c02:	83 ec 04             	sub    $0x4,%esp
+  801c05:	50                   	push   %eax
+  801c06:	ff 75 0c             	push   0xc(%ebp)
+  801c09:	68 08 60 80 00       	push   $0x806008
+  801c0e:	e8 73 ed ff ff       	call   800986 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801c13:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c18:	b8 04 00 00 00       	mov    $0x4,%eax
+  801c1d:	e8 e7 fb ff ff       	call   801809 <fsipc>
+  801c22:	83 c4 10             	add    $0x10,%esp
+}
+  801c25:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c28:	5b                   	pop    %ebx
+  801c29:	5e                   	pop    %esi
+  801c2a:	5f                   	pop    %edi
+  801c2b:	5d                   	pop    %ebp
+  801c2c:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  801c2d:	ba 00 00 10 00       	mov    $0x100000,%edx
+  801c32:	39 d0                	cmp    %edx,%eax
+  801c34:	89 d3                	mov    %edx,%ebx
+  801c36:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  801c39:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  801c3f:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  801c42:	83 c7 01             	add    $0x1,%edi
+  801c45:	89 f8                	mov    %edi,%eax
+  801c47:	e8 94 fc ff ff       	call   8018e0 <fsv_alloc>
+  801c4c:	85 c0                	test   %eax,%eax
+  801c4e:	78 d5                	js     801c25 <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  801c50:	83 ec 04             	sub    $0x4,%esp
+  801c53:	53                   	push   %ebx
+  801c54:	ff 75 0c             	push   0xc(%ebp)
+  801c57:	68 00 10 c0 9f       	push   $0x9fc01000
+  801c5c:	e8 25 ed ff ff       	call   800986 <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  801c61:	8b 46 0c             	mov    0xc(%esi),%eax
+  801c64:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  801c69:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  801c6f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801c76:	89 f9                	mov    %edi,%ecx
+  801c78:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801c7d:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801c82:	e8 69 fa ff ff       	call   8016f0 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801c87:	6a 00                	push   $0x0
+  801c89:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801c8c:	50                   	push   %eax
+  801c8d:	6a 00                	push   $0x0
+  801c8f:	6a 00                	push   $0x0
+  801c91:	e8 c6 0e 00 00       	call   802b5c <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  801c96:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  801c99:	eb 8a                	jmp    801c25 <devfile_write+0x47>
+
+00801c9b <open>:
+{
+  801c9b:	55                   	push   %ebp
+  801c9c:	89 e5                	mov    %esp,%ebp
+  801c9e:	56                   	push   %esi
+  801c9f:	53                   	push   %ebx
+  801ca0:	83 ec 1c             	sub    $0x1c,%esp
+  801ca3:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801ca6:	56                   	push   %esi
+  801ca7:	e8 19 eb ff ff       	call   8007c5 <strlen>
+  801cac:	83 c4 10             	add    $0x10,%esp
+  801caf:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801cb4:	7f 6c                	jg     801d22 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  801cb6:	83 ec 0c             	sub    $0xc,%esp
+  801cb9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cbc:	50                   	push   %eax
+  801cbd:	e8 ad f4 ff ff       	call   80116f <fd_alloc>
+  801cc2:	89 c3                	mov    %eax,%ebx
+  801cc4:	83 c4 10             	add    $0x10,%esp
+  801cc7:	85 c0                	test   %eax,%eax
+  801cc9:	78 3c                	js     801d07 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801ccb:	83 ec 08             	sub    $0x8,%esp
+  801cce:	56                   	push   %esi
+  801ccf:	68 00 60 80 00       	push   $0x806000
+  801cd4:	e8 27 eb ff ff       	call   800800 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801cd9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801cdc:	a3 00 64 80 00       	mov    %eax,0x806400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801ce1:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801ce4:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ce9:	e8 1b fb ff ff       	call   801809 <fsipc>
+  801cee:	89 c3                	mov    %eax,%ebx
+  801cf0:	83 c4 10             	add    $0x10,%esp
+  801cf3:	85 c0                	test   %eax,%eax
+  801cf5:	78 19                	js     801d10 <open+0x75>
+  return fd2num(fd);
+  801cf7:	83 ec 0c             	sub    $0xc,%esp
+  801cfa:	ff 75 f4             	push   -0xc(%ebp)
+  801cfd:	e8 49 f4 ff ff       	call   80114b <fd2num>
+  801d02:	89 c3                	mov    %eax,%ebx
+  801d04:	83 c4 10             	add    $0x10,%esp
+}
+  801d07:	89 d8                	mov    %ebx,%eax
+  801d09:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d0c:	5b                   	pop    %ebx
+  801d0d:	5e                   	pop    %esi
+  801d0e:	5d                   	pop    %ebp
+  801d0f:	c3                   	ret
+    fd_close(fd, 0);
+  801d10:	83 ec 08             	sub    $0x8,%esp
+  801d13:	6a 00                	push   $0x0
+  801d15:	ff 75 f4             	push   -0xc(%ebp)
+  801d18:	e8 44 f5 ff ff       	call   801261 <fd_close>
+    return r;
+  801d1d:	83 c4 10             	add    $0x10,%esp
+  801d20:	eb e5                	jmp    801d07 <open+0x6c>
+    return -E_BAD_PATH;
+  801d22:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801d27:	eb de                	jmp    801d07 <open+0x6c>
+
+00801d29 <open_read>:
+{
+  801d29:	55                   	push   %ebp
+  801d2a:	89 e5                	mov    %esp,%ebp
+  801d2c:	57                   	push   %edi
+  801d2d:	56                   	push   %esi
+  801d2e:	53                   	push   %ebx
+  801d2f:	83 ec 28             	sub    $0x28,%esp
+  801d32:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  801d35:	57                   	push   %edi
+  801d36:	e8 8a ea ff ff       	call   8007c5 <strlen>
+  801d3b:	83 c4 10             	add    $0x10,%esp
+  801d3e:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801d43:	0f 87 f6 00 00 00    	ja     801e3f <open_read+0x116>
+  801d49:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  801d4b:	83 ec 0c             	sub    $0xc,%esp
+  801d4e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801d51:	50                   	push   %eax
+  801d52:	e8 18 f4 ff ff       	call   80116f <fd_alloc>
+  801d57:	89 c3                	mov    %eax,%ebx
+  801d59:	83 c4 10             	add    $0x10,%esp
+  801d5c:	85 c0                	test   %eax,%eax
+  801d5e:	0f 88 b2 00 00 00    	js     801e16 <open_read+0xed>
+  strcpy(req->req_buf, path);
+  801d64:	83 ec 08             	sub    $0x8,%esp
+  801d67:	57                   	push   %edi
+  801d68:	68 e4 60 80 00       	push   $0x8060e4
+  801d6d:	e8 8e ea ff ff       	call   800800 <strcpy>
+  req->req_nops = 2;
+  801d72:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  801d79:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  801d7c:	c7 05 04 60 80 00 01 	movl   $0x1,0x806004
+  801d83:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  801d86:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d89:	a3 10 60 80 00       	mov    %eax,0x806010
+  req->req_ops[0].op_buf = 0;
+  801d8e:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  801d95:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  801d98:	c7 05 20 60 80 00 04 	movl   $0x4,0x806020
+  801d9f:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  801da2:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  801da9:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  801dac:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  801db1:	29 f0                	sub    %esi,%eax
+  801db3:	3b 45 14             	cmp    0x14(%ebp),%eax
+  801db6:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  801dba:	a3 2c 60 80 00       	mov    %eax,0x80602c
+  req->req_ops[1].op_offset = 0;
+  801dbf:	c7 05 30 60 80 00 00 	movl   $0x0,0x806030
+  801dc6:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  801dc9:	83 c6 01             	add    $0x1,%esi
+  801dcc:	89 35 34 60 80 00    	mov    %esi,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  801dd2:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801dd5:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801dda:	e8 2a fa ff ff       	call   801809 <fsipc>
+  801ddf:	89 c3                	mov    %eax,%ebx
+  801de1:	83 c4 10             	add    $0x10,%esp
+  801de4:	83 f8 01             	cmp    $0x1,%eax
+  801de7:	7e 37                	jle    801e20 <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  801de9:	a1 38 60 80 00       	mov    0x806038,%eax
+  801dee:	8b 55 18             	mov    0x18(%ebp),%edx
+  801df1:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  801df3:	83 ec 04             	sub    $0x4,%esp
+  801df6:	50                   	push   %eax
+  801df7:	81 c6 e4 60 80 00    	add    $0x8060e4,%esi
+  801dfd:	56                   	push   %esi
+  801dfe:	ff 75 10             	push   0x10(%ebp)
+  801e01:	e8 80 eb ff ff       	call   800986 <memmove>
+  return fd2num(fd);
+  801e06:	83 c4 04             	add    $0x4,%esp
+  801e09:	ff 75 e4             	push   -0x1c(%ebp)
+  801e0c:	e8 3a f3 ff ff       	call   80114b <fd2num>
+  801e11:	89 c3                	mov    %eax,%ebx
+  801e13:	83 c4 10             	add    $0x10,%esp
+}
+  801e16:	89 d8                	mov    %ebx,%eax
+  801e18:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e1b:	5b                   	pop    %ebx
+  801e1c:	5e                   	pop    %esi
+  801e1d:	5f                   	pop    %edi
+  801e1e:	5d                   	pop    %ebp
+  801e1f:	c3                   	ret
+    fd_close(fd, 0);
+  801e20:	83 ec 08             	sub    $0x8,%esp
+  801e23:	6a 00                	push   $0x0
+  801e25:	ff 75 e4             	push   -0x1c(%ebp)
+  801e28:	e8 34 f4 ff ff       	call   801261 <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  801e2d:	83 c4 10             	add    $0x10,%esp
+  801e30:	85 db                	test   %ebx,%ebx
+  801e32:	78 e2                	js     801e16 <open_read+0xed>
+  801e34:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  801e37:	8b 9b 1c 60 80 00    	mov    0x80601c(%ebx),%ebx
+  801e3d:	eb d7                	jmp    801e16 <open_read+0xed>
+    return -E_BAD_PATH;
+  801e3f:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801e44:	eb d0                	jmp    801e16 <open_read+0xed>
+
+00801e46 <file_stat>:
+{
+  801e46:	55                   	push   %ebp
+  801e47:	89 e5                	mov    %esp,%ebp
+  801e49:	57                   	push   %edi
+  801e4a:	56                   	push   %esi
+  801e4b:	53                   	push   %ebx
+  801e4c:	83 ec 18             	sub    $0x18,%esp
+  801e4f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801e52:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801e55:	57                   	push   %edi
+  801e56:	e8 6a e9 ff ff       	call   8007c5 <strlen>
+  801e5b:	83 c4 10             	add    $0x10,%esp
+  801e5e:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801e63:	0f 8f c7 00 00 00    	jg     801f30 <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  801e69:	83 ec 0c             	sub    $0xc,%esp
+  801e6c:	57                   	push   %edi
+  801e6d:	e8 53 e9 ff ff       	call   8007c5 <strlen>
+  801e72:	8d 58 04             	lea    0x4(%eax),%ebx
+  801e75:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  801e78:	83 c4 08             	add    $0x8,%esp
+  801e7b:	57                   	push   %edi
+  801e7c:	68 e4 60 80 00       	push   $0x8060e4
+  801e81:	e8 7a e9 ff ff       	call   800800 <strcpy>
+  req->req_nops = 2;
+  801e86:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  801e8d:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  801e90:	c7 05 04 60 80 00 02 	movl   $0x2,0x806004
+  801e97:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  801e9a:	c7 05 10 60 80 00 00 	movl   $0x0,0x806010
+  801ea1:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  801ea4:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  801eab:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  801eae:	c7 05 20 60 80 00 03 	movl   $0x3,0x806020
+  801eb5:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  801eb8:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  801ebf:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  801ec2:	89 1d 34 60 80 00    	mov    %ebx,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  801ec8:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ecd:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801ed2:	e8 32 f9 ff ff       	call   801809 <fsipc>
+  801ed7:	83 c4 10             	add    $0x10,%esp
+  801eda:	83 f8 01             	cmp    $0x1,%eax
+  801edd:	7e 42                	jle    801f21 <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  801edf:	81 c3 e4 60 80 00    	add    $0x8060e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  801ee5:	83 ec 08             	sub    $0x8,%esp
+  801ee8:	53                   	push   %ebx
+  801ee9:	56                   	push   %esi
+  801eea:	e8 11 e9 ff ff       	call   800800 <strcpy>
+  st->st_size = ret->ret_size;
+  801eef:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  801ef5:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  801efb:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  801f01:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  801f07:	c7 86 88 00 00 00 04 	movl   $0x804004,0x88(%esi)
+  801f0e:	40 80 00 
+  return 0;
+  801f11:	83 c4 10             	add    $0x10,%esp
+  801f14:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f19:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f1c:	5b                   	pop    %ebx
+  801f1d:	5e                   	pop    %esi
+  801f1e:	5f                   	pop    %edi
+  801f1f:	5d                   	pop    %ebp
+  801f20:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  801f21:	85 c0                	test   %eax,%eax
+  801f23:	78 f4                	js     801f19 <file_stat+0xd3>
+  801f25:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801f28:	8b 80 1c 60 80 00    	mov    0x80601c(%eax),%eax
+  801f2e:	eb e9                	jmp    801f19 <file_stat+0xd3>
+    return -E_BAD_PATH;
+  801f30:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801f35:	eb e2                	jmp    801f19 <file_stat+0xd3>
+
+00801f37 <read_map>:
+{
+  801f37:	55                   	push   %ebp
+  801f38:	89 e5                	mov    %esp,%ebp
+  801f3a:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801f3d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f40:	50                   	push   %eax
+  801f41:	ff 75 08             	push   0x8(%ebp)
+  801f44:	e8 7c f2 ff ff       	call   8011c5 <fd_lookup>
+  801f49:	83 c4 10             	add    $0x10,%esp
+  801f4c:	85 c0                	test   %eax,%eax
+  801f4e:	78 2a                	js     801f7a <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  801f50:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f53:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  801f59:	39 08                	cmp    %ecx,(%eax)
+  801f5b:	75 1f                	jne    801f7c <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  801f5d:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f60:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read_map.req_offset = offset;
+  801f65:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f68:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  801f6d:	8b 55 10             	mov    0x10(%ebp),%edx
+  801f70:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801f75:	e8 8f f8 ff ff       	call   801809 <fsipc>
+}
+  801f7a:	c9                   	leave
+  801f7b:	c3                   	ret
+    return -E_INVAL;
+  801f7c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f81:	eb f7                	jmp    801f7a <read_map+0x43>
+
+00801f83 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801f83:	55                   	push   %ebp
+  801f84:	89 e5                	mov    %esp,%ebp
+  801f86:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  801f89:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f8e:	b8 08 00 00 00       	mov    $0x8,%eax
+  801f93:	e8 71 f8 ff ff       	call   801809 <fsipc>
+}
+  801f98:	c9                   	leave
+  801f99:	c3                   	ret
+
+00801f9a <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  801f9a:	55                   	push   %ebp
+  801f9b:	89 e5                	mov    %esp,%ebp
+  801f9d:	57                   	push   %edi
+  801f9e:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  801f9f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fa2:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.stats.req_bio_sched = 0;
+  801fa7:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  801fae:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  801fb1:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  801fb8:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  801fbb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fc0:	b8 09 00 00 00       	mov    $0x9,%eax
+  801fc5:	e8 3f f8 ff ff       	call   801809 <fsipc>
+  801fca:	85 c0                	test   %eax,%eax
+  801fcc:	78 14                	js     801fe2 <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  801fce:	be 00 60 80 00       	mov    $0x806000,%esi
+  801fd3:	b9 16 00 00 00       	mov    $0x16,%ecx
+  801fd8:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801fdb:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  801fdd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801fe2:	5e                   	pop    %esi
+  801fe3:	5f                   	pop    %edi
+  801fe4:	5d                   	pop    %ebp
+  801fe5:	c3                   	ret
+
+00801fe6 <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  801fe6:	55                   	push   %ebp
+  801fe7:	89 e5                	mov    %esp,%ebp
+  801fe9:	53                   	push   %ebx
+  801fea:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  801fed:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801ff0:	50                   	push   %eax
+  801ff1:	6a 00                	push   $0x0
+  801ff3:	e8 a2 ff ff ff       	call   801f9a <fs_stats>
+  801ff8:	83 c4 10             	add    $0x10,%esp
+  801ffb:	85 c0                	test   %eax,%eax
+  801ffd:	78 28                	js     802027 <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  801fff:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  802002:	83 ec 08             	sub    $0x8,%esp
+  802005:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802008:	50                   	push   %eax
+  802009:	6a 20                	push   $0x20
+  80200b:	e8 8a ff ff ff       	call   801f9a <fs_stats>
+  802010:	83 c4 10             	add    $0x10,%esp
+  802013:	85 c0                	test   %eax,%eax
+  802015:	78 10                	js     802027 <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  802017:	83 ec 08             	sub    $0x8,%esp
+  80201a:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  80201d:	50                   	push   %eax
+  80201e:	53                   	push   %ebx
+  80201f:	e8 76 ff ff ff       	call   801f9a <fs_stats>
+  802024:	83 c4 10             	add    $0x10,%esp
+}
+  802027:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80202a:	c9                   	leave
+  80202b:	c3                   	ret
+
+0080202c <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  80202c:	55                   	push   %ebp
+  80202d:	89 e5                	mov    %esp,%ebp
+  80202f:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  802032:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  802039:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  80203c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80203f:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.stats.req_dcache = 0;
+  802044:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  80204b:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  80204e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802053:	b8 09 00 00 00       	mov    $0x9,%eax
+  802058:	e8 ac f7 ff ff       	call   801809 <fsipc>
+}
+  80205d:	c9                   	leave
+  80205e:	c3                   	ret
+
+0080205f <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  80205f:	55                   	push   %ebp
+  802060:	89 e5                	mov    %esp,%ebp
+  802062:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  802065:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  80206c:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  80206f:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  802076:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  802079:	8b 45 08             	mov    0x8(%ebp),%eax
+  80207c:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_STATS, NULL);
+  802081:	ba 00 00 00 00       	mov    $0x0,%edx
+  802086:	b8 09 00 00 00       	mov    $0x9,%eax
+  80208b:	e8 79 f7 ff ff       	call   801809 <fsipc>
+}
+  802090:	c9                   	leave
+  802091:	c3                   	ret
+
+00802092 <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  802092:	55                   	push   %ebp
+  802093:	89 e5                	mov    %esp,%ebp
+  802095:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802098:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80209b:	50                   	push   %eax
+  80209c:	ff 75 08             	push   0x8(%ebp)
+  80209f:	e8 21 f1 ff ff       	call   8011c5 <fd_lookup>
+  8020a4:	83 c4 10             	add    $0x10,%esp
+  8020a7:	85 c0                	test   %eax,%eax
+  8020a9:	78 34                	js     8020df <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  8020ab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020ae:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  8020b4:	39 08                	cmp    %ecx,(%eax)
+  8020b6:	75 29                	jne    8020e1 <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  8020b8:	8b 40 0c             	mov    0xc(%eax),%eax
+  8020bb:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.fallocate.req_offset = offset;
+  8020c0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020c3:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.fallocate.req_len = len;
+  8020c8:	8b 45 10             	mov    0x10(%ebp),%eax
+  8020cb:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  8020d0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020d5:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8020da:	e8 2a f7 ff ff       	call   801809 <fsipc>
+}
+  8020df:	c9                   	leave
+  8020e0:	c3                   	ret
+    return -E_INVAL;
+  8020e1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020e6:	eb f7                	jmp    8020df <fallocate+0x4d>
+
+008020e8 <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  8020e8:	55                   	push   %ebp
+  8020e9:	89 e5                	mov    %esp,%ebp
+  8020eb:	57                   	push   %edi
+  8020ec:	56                   	push   %esi
+  8020ed:	53                   	push   %ebx
+  8020ee:	83 ec 24             	sub    $0x24,%esp
+  8020f1:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8020f4:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8020f7:	50                   	push   %eax
+  8020f8:	ff 75 08             	push   0x8(%ebp)
+  8020fb:	e8 c5 f0 ff ff       	call   8011c5 <fd_lookup>
+  802100:	83 c4 10             	add    $0x10,%esp
+  802103:	85 c0                	test   %eax,%eax
+  802105:	78 66                	js     80216d <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  802107:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80210a:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  802110:	39 08                	cmp    %ecx,(%eax)
+  802112:	75 61                	jne    802175 <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  802114:	85 f6                	test   %esi,%esi
+  802116:	7e 50                	jle    802168 <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  802118:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  80211d:	39 de                	cmp    %ebx,%esi
+  80211f:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  802122:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802125:	8b 40 0c             	mov    0xc(%eax),%eax
+  802128:	a3 00 60 80 00       	mov    %eax,0x806000
+    fsipcbuf.prefetch.req_n = m;
+  80212d:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  802133:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  80213a:	83 ec 04             	sub    $0x4,%esp
+  80213d:	57                   	push   %edi
+  80213e:	ff 75 0c             	push   0xc(%ebp)
+  802141:	68 08 60 80 00       	push   $0x806008
+  802146:	e8 3b e8 ff ff       	call   800986 <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  80214b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802150:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802155:	e8 af f6 ff ff       	call   801809 <fsipc>
+  80215a:	83 c4 10             	add    $0x10,%esp
+  80215d:	85 c0                	test   %eax,%eax
+  80215f:	78 0c                	js     80216d <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  802161:	01 7d 0c             	add    %edi,0xc(%ebp)
+  802164:	29 de                	sub    %ebx,%esi
+  802166:	eb ac                	jmp    802114 <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  802168:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80216d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802170:	5b                   	pop    %ebx
+  802171:	5e                   	pop    %esi
+  802172:	5f                   	pop    %edi
+  802173:	5d                   	pop    %ebp
+  802174:	c3                   	ret
+    return -E_INVAL;
+  802175:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80217a:	eb f1                	jmp    80216d <prefetch+0x85>
+
+0080217c <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  80217c:	55                   	push   %ebp
+  80217d:	89 e5                	mov    %esp,%ebp
+  80217f:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  802182:	50                   	push   %eax
+  802183:	e8 d3 ef ff ff       	call   80115b <fd2data>
+  802188:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  80218d:	c9                   	leave
+  80218e:	c3                   	ret
+
+0080218f <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80218f:	55                   	push   %ebp
+  802190:	89 e5                	mov    %esp,%ebp
+  802192:	56                   	push   %esi
+  802193:	53                   	push   %ebx
+  802194:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  802197:	83 ec 0c             	sub    $0xc,%esp
+  80219a:	ff 75 08             	push   0x8(%ebp)
+  80219d:	e8 b9 ef ff ff       	call   80115b <fd2data>
+  8021a2:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  8021a4:	83 c4 08             	add    $0x8,%esp
+  8021a7:	68 28 34 80 00       	push   $0x803428
+  8021ac:	53                   	push   %ebx
+  8021ad:	e8 4e e6 ff ff       	call   800800 <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  8021b2:	8b 46 04             	mov    0x4(%esi),%eax
+  8021b5:	2b 06                	sub    (%esi),%eax
+  8021b7:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  8021bd:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8021c4:	00 00 00 
+  stat->st_dev = &devpipe;
+  8021c7:	c7 83 88 00 00 00 20 	movl   $0x804020,0x88(%ebx)
+  8021ce:	40 80 00 
+  return 0;
+}
+  8021d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021d6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021d9:	5b                   	pop    %ebx
+  8021da:	5e                   	pop    %esi
+  8021db:	5d                   	pop    %ebp
+  8021dc:	c3                   	ret
+
+008021dd <pipe_wakeup>:
+{
+  8021dd:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  8021df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021e4:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  8021e7:	85 c0                	test   %eax,%eax
+  8021e9:	75 01                	jne    8021ec <pipe_wakeup+0xf>
+  8021eb:	c3                   	ret
+{
+  8021ec:	55                   	push   %ebp
+  8021ed:	89 e5                	mov    %esp,%ebp
+  8021ef:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  8021f2:	6a 00                	push   $0x0
+  8021f4:	68 00 00 c0 ee       	push   $0xeec00000
+  8021f9:	52                   	push   %edx
+  8021fa:	e8 8c ed ff ff       	call   800f8b <sys_chan_wakeup>
+  8021ff:	83 c4 10             	add    $0x10,%esp
+}
+  802202:	c9                   	leave
+  802203:	c3                   	ret
+
+00802204 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802204:	55                   	push   %ebp
+  802205:	89 e5                	mov    %esp,%ebp
+  802207:	57                   	push   %edi
+  802208:	56                   	push   %esi
+  802209:	53                   	push   %ebx
+  80220a:	83 ec 18             	sub    $0x18,%esp
+  80220d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  802210:	57                   	push   %edi
+  802211:	e8 45 ef ff ff       	call   80115b <fd2data>
+  802216:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  802218:	83 c4 10             	add    $0x10,%esp
+  80221b:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  80221f:	74 2a                	je     80224b <devpipe_close+0x47>
+  802221:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  802226:	89 f8                	mov    %edi,%eax
+  802228:	e8 4f ff ff ff       	call   80217c <pipe_ring>
+  80222d:	83 ec 08             	sub    $0x8,%esp
+  802230:	01 d8                	add    %ebx,%eax
+  802232:	50                   	push   %eax
+  802233:	6a 00                	push   $0x0
+  802235:	e8 7a ea ff ff       	call   800cb4 <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  80223a:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802240:	83 c4 10             	add    $0x10,%esp
+  802243:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  802249:	75 db                	jne    802226 <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  80224b:	83 ec 08             	sub    $0x8,%esp
+  80224e:	57                   	push   %edi
+  80224f:	6a 00                	push   $0x0
+  802251:	e8 5e ea ff ff       	call   800cb4 <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  802256:	83 c4 10             	add    $0x10,%esp
+  802259:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  80225d:	75 13                	jne    802272 <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  80225f:	83 ec 08             	sub    $0x8,%esp
+  802262:	56                   	push   %esi
+  802263:	6a 00                	push   $0x0
+  802265:	e8 4a ea ff ff       	call   800cb4 <sys_page_unmap>
+}
+  80226a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80226d:	5b                   	pop    %ebx
+  80226e:	5e                   	pop    %esi
+  80226f:	5f                   	pop    %edi
+  802270:	5d                   	pop    %ebp
+  802271:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802272:	8d 56 04             	lea    0x4(%esi),%edx
+  802275:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802278:	e8 60 ff ff ff       	call   8021dd <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  80227d:	8d 46 30             	lea    0x30(%esi),%eax
+  802280:	89 f2                	mov    %esi,%edx
+  802282:	e8 56 ff ff ff       	call   8021dd <pipe_wakeup>
+  802287:	eb d6                	jmp    80225f <devpipe_close+0x5b>
+
+00802289 <_pipeisclosed>:
+{
+  802289:	55                   	push   %ebp
+  80228a:	89 e5                	mov    %esp,%ebp
+  80228c:	57                   	push   %edi
+  80228d:	56                   	push   %esi
+  80228e:	53                   	push   %ebx
+  80228f:	83 ec 1c             	sub    $0x1c,%esp
+  802292:	89 c7                	mov    %eax,%edi
+  802294:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  802296:	a1 44 57 80 00       	mov    0x805744,%eax
+  80229b:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  80229e:	83 ec 0c             	sub    $0xc,%esp
+  8022a1:	57                   	push   %edi
+  8022a2:	e8 18 0a 00 00       	call   802cbf <pageref>
+  8022a7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8022aa:	89 34 24             	mov    %esi,(%esp)
+  8022ad:	e8 0d 0a 00 00       	call   802cbf <pageref>
+    nn = thisenv->env_runs;
+  8022b2:	8b 15 44 57 80 00    	mov    0x805744,%edx
+  8022b8:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  8022bb:	83 c4 10             	add    $0x10,%esp
+  8022be:	39 cb                	cmp    %ecx,%ebx
+  8022c0:	74 1b                	je     8022dd <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  8022c2:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8022c5:	75 cf                	jne    802296 <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8022c7:	8b 42 58             	mov    0x58(%edx),%eax
+  8022ca:	6a 01                	push   $0x1
+  8022cc:	50                   	push   %eax
+  8022cd:	53                   	push   %ebx
+  8022ce:	68 2f 34 80 00       	push   $0x80342f
+  8022d3:	e8 3a df ff ff       	call   800212 <cprintf>
+  8022d8:	83 c4 10             	add    $0x10,%esp
+  8022db:	eb b9                	jmp    802296 <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  8022dd:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8022e0:	0f 94 c0             	sete   %al
+  8022e3:	0f b6 c0             	movzbl %al,%eax
+}
+  8022e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022e9:	5b                   	pop    %ebx
+  8022ea:	5e                   	pop    %esi
+  8022eb:	5f                   	pop    %edi
+  8022ec:	5d                   	pop    %ebp
+  8022ed:	c3                   	ret
+
+008022ee <devpipe_write_bulk>:
+{
+  8022ee:	55                   	push   %ebp
+  8022ef:	89 e5                	mov    %esp,%ebp
+  8022f1:	57                   	push   %edi
+  8022f2:	56                   	push   %esi
+  8022f3:	53                   	push   %ebx
+  8022f4:	83 ec 1c             	sub    $0x1c,%esp
+  8022f7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8022fa:	89 d6                	mov    %edx,%esi
+  8022fc:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  8022ff:	e8 78 fe ff ff       	call   80217c <pipe_ring>
+  802304:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  802307:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  80230c:	8d 46 04             	lea    0x4(%esi),%eax
+  80230f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  802312:	eb 75                	jmp    802389 <devpipe_write_bulk+0x9b>
+  802314:	b8 01 00 00 00       	mov    $0x1,%eax
+  802319:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  80231d:	6a 64                	push   $0x64
+  80231f:	68 00 00 c0 ee       	push   $0xeec00000
+  802324:	53                   	push   %ebx
+  802325:	56                   	push   %esi
+  802326:	e8 3d ec ff ff       	call   800f68 <sys_chan_sleep>
+      continue;
+  80232b:	83 c4 10             	add    $0x10,%esp
+  80232e:	eb 59                	jmp    802389 <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  802330:	89 d1                	mov    %edx,%ecx
+  802332:	c1 f9 1f             	sar    $0x1f,%ecx
+  802335:	c1 e9 11             	shr    $0x11,%ecx
+  802338:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  80233b:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802340:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  802342:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  802348:	29 d3                	sub    %edx,%ebx
+  80234a:	ba 00 80 00 00       	mov    $0x8000,%edx
+  80234f:	29 c2                	sub    %eax,%edx
+  802351:	39 d3                	cmp    %edx,%ebx
+  802353:	0f 47 da             	cmova  %edx,%ebx
+  802356:	8b 55 08             	mov    0x8(%ebp),%edx
+  802359:	29 fa                	sub    %edi,%edx
+  80235b:	39 d3                	cmp    %edx,%ebx
+  80235d:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  802360:	83 ec 04             	sub    $0x4,%esp
+  802363:	53                   	push   %ebx
+  802364:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802367:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  80236a:	52                   	push   %edx
+  80236b:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80236e:	01 c8                	add    %ecx,%eax
+  802370:	50                   	push   %eax
+  802371:	e8 72 e6 ff ff       	call   8009e8 <memcpy>
+    i += m;
+  802376:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  802378:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  80237b:	8d 46 2c             	lea    0x2c(%esi),%eax
+  80237e:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802381:	e8 57 fe ff ff       	call   8021dd <pipe_wakeup>
+  802386:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802389:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  80238c:	73 2b                	jae    8023b9 <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  80238e:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  802390:	8b 56 04             	mov    0x4(%esi),%edx
+  802393:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  802399:	39 d0                	cmp    %edx,%eax
+  80239b:	7d 93                	jge    802330 <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  80239d:	89 f2                	mov    %esi,%edx
+  80239f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8023a2:	e8 e2 fe ff ff       	call   802289 <_pipeisclosed>
+  8023a7:	85 c0                	test   %eax,%eax
+  8023a9:	0f 84 65 ff ff ff    	je     802314 <devpipe_write_bulk+0x26>
+        return i;
+  8023af:	89 f8                	mov    %edi,%eax
+}
+  8023b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023b4:	5b                   	pop    %ebx
+  8023b5:	5e                   	pop    %esi
+  8023b6:	5f                   	pop    %edi
+  8023b7:	5d                   	pop    %ebp
+  8023b8:	c3                   	ret
+  return i;
+  8023b9:	89 f8                	mov    %edi,%eax
+  8023bb:	eb f4                	jmp    8023b1 <devpipe_write_bulk+0xc3>
+
+008023bd <devpipe_write>:
+{
+  8023bd:	55                   	push   %ebp
+  8023be:	89 e5                	mov    %esp,%ebp
+  8023c0:	57                   	push   %edi
+  8023c1:	56                   	push   %esi
+  8023c2:	53                   	push   %ebx
+  8023c3:	83 ec 28             	sub    $0x28,%esp
+  8023c6:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  8023c9:	56                   	push   %esi
+  8023ca:	e8 8c ed ff ff       	call   80115b <fd2data>
+  8023cf:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  8023d1:	8b 78 28             	mov    0x28(%eax),%edi
+  8023d4:	83 c4 10             	add    $0x10,%esp
+  8023d7:	85 ff                	test   %edi,%edi
+  8023d9:	75 25                	jne    802400 <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  8023db:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8023de:	74 66                	je     802446 <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8023e0:	8b 43 04             	mov    0x4(%ebx),%eax
+  8023e3:	8b 0b                	mov    (%ebx),%ecx
+  8023e5:	8d 51 20             	lea    0x20(%ecx),%edx
+  8023e8:	39 d0                	cmp    %edx,%eax
+  8023ea:	72 2b                	jb     802417 <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  8023ec:	89 da                	mov    %ebx,%edx
+  8023ee:	89 f0                	mov    %esi,%eax
+  8023f0:	e8 94 fe ff ff       	call   802289 <_pipeisclosed>
+  8023f5:	85 c0                	test   %eax,%eax
+  8023f7:	75 51                	jne    80244a <devpipe_write+0x8d>
+      sys_yield();
+  8023f9:	e8 cf e7 ff ff       	call   800bcd <sys_yield>
+  8023fe:	eb e0                	jmp    8023e0 <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  802400:	83 ec 0c             	sub    $0xc,%esp
+  802403:	ff 75 10             	push   0x10(%ebp)
+  802406:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802409:	89 c2                	mov    %eax,%edx
+  80240b:	89 f0                	mov    %esi,%eax
+  80240d:	e8 dc fe ff ff       	call   8022ee <devpipe_write_bulk>
+  802412:	83 c4 10             	add    $0x10,%esp
+  802415:	eb 38                	jmp    80244f <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802417:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80241a:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  80241e:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802421:	89 c2                	mov    %eax,%edx
+  802423:	c1 fa 1f             	sar    $0x1f,%edx
+  802426:	89 d1                	mov    %edx,%ecx
+  802428:	c1 e9 1b             	shr    $0x1b,%ecx
+  80242b:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80242e:	83 e2 1f             	and    $0x1f,%edx
+  802431:	29 ca                	sub    %ecx,%edx
+  802433:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802437:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  80243b:	83 c0 01             	add    $0x1,%eax
+  80243e:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  802441:	83 c7 01             	add    $0x1,%edi
+  802444:	eb 95                	jmp    8023db <devpipe_write+0x1e>
+  return i;
+  802446:	89 f8                	mov    %edi,%eax
+  802448:	eb 05                	jmp    80244f <devpipe_write+0x92>
+        return 0;
+  80244a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80244f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802452:	5b                   	pop    %ebx
+  802453:	5e                   	pop    %esi
+  802454:	5f                   	pop    %edi
+  802455:	5d                   	pop    %ebp
+  802456:	c3                   	ret
+
+00802457 <devpipe_read_bulk>:
+{
+  802457:	55                   	push   %ebp
+  802458:	89 e5                	mov    %esp,%ebp
+  80245a:	57                   	push   %edi
+  80245b:	56                   	push   %esi
+  80245c:	53                   	push   %ebx
+  80245d:	83 ec 2c             	sub    $0x2c,%esp
+  802460:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802463:	89 d6                	mov    %edx,%esi
+  802465:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802468:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  80246b:	e8 0c fd ff ff       	call   80217c <pipe_ring>
+  802470:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  802473:	85 db                	test   %ebx,%ebx
+  802475:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80247a:	0f 45 c3             	cmovne %ebx,%eax
+  80247d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802480:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802485:	8d 46 30             	lea    0x30(%esi),%eax
+  802488:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  80248b:	eb 50                	jmp    8024dd <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  80248d:	89 d1                	mov    %edx,%ecx
+  80248f:	c1 f9 1f             	sar    $0x1f,%ecx
+  802492:	c1 e9 11             	shr    $0x11,%ecx
+  802495:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802498:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  80249d:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  80249f:	29 d3                	sub    %edx,%ebx
+  8024a1:	ba 00 80 00 00       	mov    $0x8000,%edx
+  8024a6:	29 c2                	sub    %eax,%edx
+  8024a8:	39 d3                	cmp    %edx,%ebx
+  8024aa:	0f 47 da             	cmova  %edx,%ebx
+  8024ad:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024b0:	29 fa                	sub    %edi,%edx
+  8024b2:	39 d3                	cmp    %edx,%ebx
+  8024b4:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  8024b7:	83 ec 04             	sub    $0x4,%esp
+  8024ba:	53                   	push   %ebx
+  8024bb:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8024be:	01 c8                	add    %ecx,%eax
+  8024c0:	50                   	push   %eax
+  8024c1:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8024c4:	01 f8                	add    %edi,%eax
+  8024c6:	50                   	push   %eax
+  8024c7:	e8 1c e5 ff ff       	call   8009e8 <memcpy>
+    i += m;
+  8024cc:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  8024ce:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8024d0:	89 f2                	mov    %esi,%edx
+  8024d2:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8024d5:	e8 03 fd ff ff       	call   8021dd <pipe_wakeup>
+  8024da:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  8024dd:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  8024e0:	73 51                	jae    802533 <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  8024e2:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  8024e5:	8b 16                	mov    (%esi),%edx
+  8024e7:	39 da                	cmp    %ebx,%edx
+  8024e9:	75 a2                	jne    80248d <devpipe_read_bulk+0x36>
+      if (i > 0)
+  8024eb:	85 ff                	test   %edi,%edi
+  8024ed:	75 44                	jne    802533 <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  8024ef:	89 f2                	mov    %esi,%edx
+  8024f1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8024f4:	e8 90 fd ff ff       	call   802289 <_pipeisclosed>
+  8024f9:	85 c0                	test   %eax,%eax
+  8024fb:	75 3a                	jne    802537 <devpipe_read_bulk+0xe0>
+  8024fd:	b8 01 00 00 00       	mov    $0x1,%eax
+  802502:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802506:	6a 64                	push   $0x64
+  802508:	ff 75 d4             	push   -0x2c(%ebp)
+  80250b:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  80250c:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  80250f:	50                   	push   %eax
+  802510:	e8 53 ea ff ff       	call   800f68 <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  802515:	85 c0                	test   %eax,%eax
+  802517:	ba 00 00 00 00       	mov    $0x0,%edx
+  80251c:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  80251f:	83 c4 10             	add    $0x10,%esp
+  802522:	a8 01                	test   $0x1,%al
+  802524:	74 b7                	je     8024dd <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  802526:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  80252b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80252e:	5b                   	pop    %ebx
+  80252f:	5e                   	pop    %esi
+  802530:	5f                   	pop    %edi
+  802531:	5d                   	pop    %ebp
+  802532:	c3                   	ret
+  return i;
+  802533:	89 f8                	mov    %edi,%eax
+  802535:	eb f4                	jmp    80252b <devpipe_read_bulk+0xd4>
+        return 0;
+  802537:	b8 00 00 00 00       	mov    $0x0,%eax
+  80253c:	eb ed                	jmp    80252b <devpipe_read_bulk+0xd4>
+
+0080253e <devpipe_read>:
+{
+  80253e:	55                   	push   %ebp
+  80253f:	89 e5                	mov    %esp,%ebp
+  802541:	57                   	push   %edi
+  802542:	56                   	push   %esi
+  802543:	53                   	push   %ebx
+  802544:	83 ec 18             	sub    $0x18,%esp
+  802547:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  80254a:	57                   	push   %edi
+  80254b:	e8 0b ec ff ff       	call   80115b <fd2data>
+  802550:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  802552:	8b 70 28             	mov    0x28(%eax),%esi
+  802555:	83 c4 10             	add    $0x10,%esp
+  802558:	85 f6                	test   %esi,%esi
+  80255a:	75 24                	jne    802580 <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  80255c:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80255f:	74 60                	je     8025c1 <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  802561:	8b 03                	mov    (%ebx),%eax
+  802563:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802566:	75 3b                	jne    8025a3 <devpipe_read+0x65>
+      if (i > 0)
+  802568:	85 f6                	test   %esi,%esi
+  80256a:	75 2d                	jne    802599 <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  80256c:	89 da                	mov    %ebx,%edx
+  80256e:	89 f8                	mov    %edi,%eax
+  802570:	e8 14 fd ff ff       	call   802289 <_pipeisclosed>
+  802575:	85 c0                	test   %eax,%eax
+  802577:	75 4c                	jne    8025c5 <devpipe_read+0x87>
+      sys_yield();
+  802579:	e8 4f e6 ff ff       	call   800bcd <sys_yield>
+  80257e:	eb e1                	jmp    802561 <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  802580:	83 ec 08             	sub    $0x8,%esp
+  802583:	6a 00                	push   $0x0
+  802585:	ff 75 10             	push   0x10(%ebp)
+  802588:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80258b:	89 c2                	mov    %eax,%edx
+  80258d:	89 f8                	mov    %edi,%eax
+  80258f:	e8 c3 fe ff ff       	call   802457 <devpipe_read_bulk>
+  802594:	83 c4 10             	add    $0x10,%esp
+  802597:	eb 02                	jmp    80259b <devpipe_read+0x5d>
+        return i;
+  802599:	89 f0                	mov    %esi,%eax
+}
+  80259b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80259e:	5b                   	pop    %ebx
+  80259f:	5e                   	pop    %esi
+  8025a0:	5f                   	pop    %edi
+  8025a1:	5d                   	pop    %ebp
+  8025a2:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8025a3:	99                   	cltd
+  8025a4:	c1 ea 1b             	shr    $0x1b,%edx
+  8025a7:	01 d0                	add    %edx,%eax
+  8025a9:	83 e0 1f             	and    $0x1f,%eax
+  8025ac:	29 d0                	sub    %edx,%eax
+  8025ae:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8025b3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8025b6:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  8025b9:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  8025bc:	83 c6 01             	add    $0x1,%esi
+  8025bf:	eb 9b                	jmp    80255c <devpipe_read+0x1e>
+  return i;
+  8025c1:	89 f0                	mov    %esi,%eax
+  8025c3:	eb d6                	jmp    80259b <devpipe_read+0x5d>
+        return 0;
+  8025c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025ca:	eb cf                	jmp    80259b <devpipe_read+0x5d>
+
+008025cc <pipe2>:
+{
+  8025cc:	55                   	push   %ebp
+  8025cd:	89 e5                	mov    %esp,%ebp
+  8025cf:	57                   	push   %edi
+  8025d0:	56                   	push   %esi
+  8025d1:	53                   	push   %ebx
+  8025d2:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  8025d5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8025d8:	50                   	push   %eax
+  8025d9:	e8 91 eb ff ff       	call   80116f <fd_alloc>
+  8025de:	89 c3                	mov    %eax,%ebx
+  8025e0:	83 c4 10             	add    $0x10,%esp
+  8025e3:	85 c0                	test   %eax,%eax
+  8025e5:	0f 88 fb 01 00 00    	js     8027e6 <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8025eb:	83 ec 04             	sub    $0x4,%esp
+  8025ee:	68 07 04 00 00       	push   $0x407
+  8025f3:	ff 75 e4             	push   -0x1c(%ebp)
+  8025f6:	6a 00                	push   $0x0
+  8025f8:	e8 32 e6 ff ff       	call   800c2f <sys_page_alloc>
+  8025fd:	89 c3                	mov    %eax,%ebx
+  8025ff:	83 c4 10             	add    $0x10,%esp
+  802602:	85 c0                	test   %eax,%eax
+  802604:	0f 88 dc 01 00 00    	js     8027e6 <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  80260a:	83 ec 0c             	sub    $0xc,%esp
+  80260d:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  802610:	50                   	push   %eax
+  802611:	e8 59 eb ff ff       	call   80116f <fd_alloc>
+  802616:	89 c3                	mov    %eax,%ebx
+  802618:	83 c4 10             	add    $0x10,%esp
+  80261b:	85 c0                	test   %eax,%eax
+  80261d:	0f 88 b3 01 00 00    	js     8027d6 <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802623:	83 ec 04             	sub    $0x4,%esp
+  802626:	68 07 04 00 00       	push   $0x407
+  80262b:	ff 75 e0             	push   -0x20(%ebp)
+  80262e:	6a 00                	push   $0x0
+  802630:	e8 fa e5 ff ff       	call   800c2f <sys_page_alloc>
+  802635:	89 c3                	mov    %eax,%ebx
+  802637:	83 c4 10             	add    $0x10,%esp
+  80263a:	85 c0                	test   %eax,%eax
+  80263c:	0f 88 94 01 00 00    	js     8027d6 <pipe2+0x20a>
+  va = fd2data(fd0);
+  802642:	83 ec 0c             	sub    $0xc,%esp
+  802645:	ff 75 e4             	push   -0x1c(%ebp)
+  802648:	e8 0e eb ff ff       	call   80115b <fd2data>
+  80264d:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80264f:	83 c4 0c             	add    $0xc,%esp
+  802652:	68 07 04 00 00       	push   $0x407
+  802657:	50                   	push   %eax
+  802658:	6a 00                	push   $0x0
+  80265a:	e8 d0 e5 ff ff       	call   800c2f <sys_page_alloc>
+  80265f:	89 c3                	mov    %eax,%ebx
+  802661:	83 c4 10             	add    $0x10,%esp
+  802664:	85 c0                	test   %eax,%eax
+  802666:	0f 88 5a 01 00 00    	js     8027c6 <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80266c:	83 ec 0c             	sub    $0xc,%esp
+  80266f:	ff 75 e0             	push   -0x20(%ebp)
+  802672:	e8 e4 ea ff ff       	call   80115b <fd2data>
+  802677:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80267e:	50                   	push   %eax
+  80267f:	6a 00                	push   $0x0
+  802681:	57                   	push   %edi
+  802682:	6a 00                	push   $0x0
+  802684:	e8 e9 e5 ff ff       	call   800c72 <sys_page_map>
+  802689:	89 c3                	mov    %eax,%ebx
+  80268b:	83 c4 20             	add    $0x20,%esp
+  80268e:	85 c0                	test   %eax,%eax
+  802690:	0f 88 22 01 00 00    	js     8027b8 <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  802696:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  80269a:	74 72                	je     80270e <pipe2+0x142>
+  80269c:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  8026a1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8026a4:	e8 d3 fa ff ff       	call   80217c <pipe_ring>
+  8026a9:	83 ec 04             	sub    $0x4,%esp
+  8026ac:	68 07 04 00 00       	push   $0x407
+  8026b1:	01 f0                	add    %esi,%eax
+  8026b3:	50                   	push   %eax
+  8026b4:	6a 00                	push   $0x0
+  8026b6:	e8 74 e5 ff ff       	call   800c2f <sys_page_alloc>
+  8026bb:	89 c3                	mov    %eax,%ebx
+  8026bd:	83 c4 10             	add    $0x10,%esp
+  8026c0:	85 c0                	test   %eax,%eax
+  8026c2:	0f 88 97 00 00 00    	js     80275f <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  8026c8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8026cb:	e8 ac fa ff ff       	call   80217c <pipe_ring>
+  8026d0:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  8026d3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8026d6:	e8 a1 fa ff ff       	call   80217c <pipe_ring>
+  8026db:	83 ec 0c             	sub    $0xc,%esp
+  8026de:	68 07 04 00 00       	push   $0x407
+  8026e3:	53                   	push   %ebx
+  8026e4:	6a 00                	push   $0x0
+  8026e6:	01 f0                	add    %esi,%eax
+  8026e8:	50                   	push   %eax
+  8026e9:	6a 00                	push   $0x0
+  8026eb:	e8 82 e5 ff ff       	call   800c72 <sys_page_map>
+  8026f0:	89 c3                	mov    %eax,%ebx
+  8026f2:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8026f8:	83 c4 20             	add    $0x20,%esp
+  8026fb:	85 c0                	test   %eax,%eax
+  8026fd:	78 60                	js     80275f <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  8026ff:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802705:	75 9a                	jne    8026a1 <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  802707:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  80270e:	a1 20 40 80 00       	mov    0x804020,%eax
+  802713:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802716:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  802718:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80271b:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  802722:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802725:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  802727:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80272a:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  802731:	83 ec 0c             	sub    $0xc,%esp
+  802734:	ff 75 e4             	push   -0x1c(%ebp)
+  802737:	e8 0f ea ff ff       	call   80114b <fd2num>
+  80273c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80273f:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  802741:	83 c4 04             	add    $0x4,%esp
+  802744:	ff 75 e0             	push   -0x20(%ebp)
+  802747:	e8 ff e9 ff ff       	call   80114b <fd2num>
+  80274c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80274f:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  802752:	83 c4 10             	add    $0x10,%esp
+  802755:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80275a:	e9 87 00 00 00       	jmp    8027e6 <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  80275f:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  802764:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802767:	e8 10 fa ff ff       	call   80217c <pipe_ring>
+  80276c:	83 ec 08             	sub    $0x8,%esp
+  80276f:	01 f0                	add    %esi,%eax
+  802771:	50                   	push   %eax
+  802772:	6a 00                	push   $0x0
+  802774:	e8 3b e5 ff ff       	call   800cb4 <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  802779:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80277c:	e8 fb f9 ff ff       	call   80217c <pipe_ring>
+  802781:	83 c4 08             	add    $0x8,%esp
+  802784:	01 f0                	add    %esi,%eax
+  802786:	50                   	push   %eax
+  802787:	6a 00                	push   $0x0
+  802789:	e8 26 e5 ff ff       	call   800cb4 <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  80278e:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802794:	83 c4 10             	add    $0x10,%esp
+  802797:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  80279d:	75 c5                	jne    802764 <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  80279f:	83 ec 0c             	sub    $0xc,%esp
+  8027a2:	ff 75 e0             	push   -0x20(%ebp)
+  8027a5:	e8 b1 e9 ff ff       	call   80115b <fd2data>
+  8027aa:	83 c4 08             	add    $0x8,%esp
+  8027ad:	50                   	push   %eax
+  8027ae:	6a 00                	push   $0x0
+  8027b0:	e8 ff e4 ff ff       	call   800cb4 <sys_page_unmap>
+  8027b5:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  8027b8:	83 ec 08             	sub    $0x8,%esp
+  8027bb:	57                   	push   %edi
+  8027bc:	6a 00                	push   $0x0
+  8027be:	e8 f1 e4 ff ff       	call   800cb4 <sys_page_unmap>
+  8027c3:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  8027c6:	83 ec 08             	sub    $0x8,%esp
+  8027c9:	ff 75 e0             	push   -0x20(%ebp)
+  8027cc:	6a 00                	push   $0x0
+  8027ce:	e8 e1 e4 ff ff       	call   800cb4 <sys_page_unmap>
+  8027d3:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  8027d6:	83 ec 08             	sub    $0x8,%esp
+  8027d9:	ff 75 e4             	push   -0x1c(%ebp)
+  8027dc:	6a 00                	push   $0x0
+  8027de:	e8 d1 e4 ff ff       	call   800cb4 <sys_page_unmap>
+  8027e3:	83 c4 10             	add    $0x10,%esp
+}
+  8027e6:	89 d8                	mov    %ebx,%eax
+  8027e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027eb:	5b                   	pop    %ebx
+  8027ec:	5e                   	pop    %esi
+  8027ed:	5f                   	pop    %edi
+  8027ee:	5d                   	pop    %ebp
+  8027ef:	c3                   	ret
+
+008027f0 <pipe>:
+{
+  8027f0:	55                   	push   %ebp
+  8027f1:	89 e5                	mov    %esp,%ebp
+  8027f3:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  8027f6:	6a 00                	push   $0x0
+  8027f8:	ff 75 08             	push   0x8(%ebp)
+  8027fb:	e8 cc fd ff ff       	call   8025cc <pipe2>
+}
+  802800:	c9                   	leave
+  802801:	c3                   	ret
+
+00802802 <pipeisclosed>:
+{
+  802802:	55                   	push   %ebp
+  802803:	89 e5                	mov    %esp,%ebp
+  802805:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802808:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80280b:	50                   	push   %eax
+  80280c:	ff 75 08             	push   0x8(%ebp)
+  80280f:	e8 b1 e9 ff ff       	call   8011c5 <fd_lookup>
+  802814:	83 c4 10             	add    $0x10,%esp
+  802817:	85 c0                	test   %eax,%eax
+  802819:	78 18                	js     802833 <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  80281b:	83 ec 0c             	sub    $0xc,%esp
+  80281e:	ff 75 f4             	push   -0xc(%ebp)
+  802821:	e8 35 e9 ff ff       	call   80115b <fd2data>
+  802826:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  802828:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80282b:	e8 59 fa ff ff       	call   802289 <_pipeisclosed>
+  802830:	83 c4 10             	add    $0x10,%esp
+}
+  802833:	c9                   	leave
+  802834:	c3                   	ret
+
+00802835 <pipe_splice>:
+{
+  802835:	55                   	push   %ebp
+  802836:	89 e5                	mov    %esp,%ebp
+  802838:	57                   	push   %edi
+  802839:	56                   	push   %esi
+  80283a:	53                   	push   %ebx
+  80283b:	83 ec 34             	sub    $0x34,%esp
+  80283e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802841:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802844:	50                   	push   %eax
+  802845:	ff 75 08             	push   0x8(%ebp)
+  802848:	e8 78 e9 ff ff       	call   8011c5 <fd_lookup>
+  80284d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802850:	83 c4 10             	add    $0x10,%esp
+  802853:	85 c0                	test   %eax,%eax
+  802855:	0f 88 d7 00 00 00    	js     802932 <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  80285b:	83 ec 0c             	sub    $0xc,%esp
+  80285e:	ff 75 e4             	push   -0x1c(%ebp)
+  802861:	e8 f5 e8 ff ff       	call   80115b <fd2data>
+  802866:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802868:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80286b:	83 c4 10             	add    $0x10,%esp
+  80286e:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802874:	39 10                	cmp    %edx,(%eax)
+  802876:	0f 85 c1 00 00 00    	jne    80293d <pipe_splice+0x108>
+  80287c:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  802880:	0f 84 c0 00 00 00    	je     802946 <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  802886:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  80288a:	0f 84 bf 00 00 00    	je     80294f <pipe_splice+0x11a>
+  802890:	89 f7                	mov    %esi,%edi
+  802892:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  802898:	0f 85 ba 00 00 00    	jne    802958 <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  80289e:	8d 43 04             	lea    0x4(%ebx),%eax
+  8028a1:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8028a4:	eb 38                	jmp    8028de <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  8028a6:	83 ec 0c             	sub    $0xc,%esp
+  8028a9:	68 00 10 00 00       	push   $0x1000
+  8028ae:	89 f1                	mov    %esi,%ecx
+  8028b0:	89 da                	mov    %ebx,%edx
+  8028b2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8028b5:	e8 34 fa ff ff       	call   8022ee <devpipe_write_bulk>
+  8028ba:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8028bd:	83 c4 10             	add    $0x10,%esp
+  8028c0:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8028c5:	75 53                	jne    80291a <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  8028c7:	83 ec 08             	sub    $0x8,%esp
+  8028ca:	56                   	push   %esi
+  8028cb:	6a 00                	push   $0x0
+  8028cd:	e8 e2 e3 ff ff       	call   800cb4 <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  8028d2:	83 c7 01             	add    $0x1,%edi
+  8028d5:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8028db:	83 c4 10             	add    $0x10,%esp
+  8028de:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8028e1:	74 3a                	je     80291d <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  8028e3:	8b 03                	mov    (%ebx),%eax
+  8028e5:	39 43 04             	cmp    %eax,0x4(%ebx)
+  8028e8:	75 bc                	jne    8028a6 <pipe_splice+0x71>
+  8028ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028ef:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  8028f3:	85 c0                	test   %eax,%eax
+  8028f5:	74 af                	je     8028a6 <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  8028f7:	83 ec 04             	sub    $0x4,%esp
+  8028fa:	6a 07                	push   $0x7
+  8028fc:	56                   	push   %esi
+  8028fd:	ff 75 d0             	push   -0x30(%ebp)
+  802900:	e8 86 e6 ff ff       	call   800f8b <sys_chan_wakeup>
+  802905:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802908:	83 c4 10             	add    $0x10,%esp
+  80290b:	85 c0                	test   %eax,%eax
+  80290d:	79 b8                	jns    8028c7 <pipe_splice+0x92>
+  80290f:	b8 01 00 00 00       	mov    $0x1,%eax
+  802914:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802918:	eb 8c                	jmp    8028a6 <pipe_splice+0x71>
+  80291a:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  80291d:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802921:	75 06                	jne    802929 <pipe_splice+0xf4>
+  802923:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802927:	78 09                	js     802932 <pipe_splice+0xfd>
+  return i * PGSIZE;
+  802929:	8b 45 10             	mov    0x10(%ebp),%eax
+  80292c:	c1 e0 0c             	shl    $0xc,%eax
+  80292f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  802932:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802935:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802938:	5b                   	pop    %ebx
+  802939:	5e                   	pop    %esi
+  80293a:	5f                   	pop    %edi
+  80293b:	5d                   	pop    %ebp
+  80293c:	c3                   	ret
+    return -E_INVAL;
+  80293d:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802944:	eb ec                	jmp    802932 <pipe_splice+0xfd>
+  802946:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  80294d:	eb e3                	jmp    802932 <pipe_splice+0xfd>
+  80294f:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802956:	eb da                	jmp    802932 <pipe_splice+0xfd>
+  802958:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  80295f:	eb d1                	jmp    802932 <pipe_splice+0xfd>
+
+00802961 <pipe_splice_read>:
+{
+  802961:	55                   	push   %ebp
+  802962:	89 e5                	mov    %esp,%ebp
+  802964:	53                   	push   %ebx
+  802965:	83 ec 1c             	sub    $0x1c,%esp
+  802968:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80296b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80296e:	50                   	push   %eax
+  80296f:	ff 75 08             	push   0x8(%ebp)
+  802972:	e8 4e e8 ff ff       	call   8011c5 <fd_lookup>
+  802977:	83 c4 10             	add    $0x10,%esp
+  80297a:	85 c0                	test   %eax,%eax
+  80297c:	78 49                	js     8029c7 <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  80297e:	83 ec 0c             	sub    $0xc,%esp
+  802981:	ff 75 f4             	push   -0xc(%ebp)
+  802984:	e8 d2 e7 ff ff       	call   80115b <fd2data>
+  802989:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  80298b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80298e:	83 c4 10             	add    $0x10,%esp
+  802991:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  802997:	39 08                	cmp    %ecx,(%eax)
+  802999:	75 31                	jne    8029cc <pipe_splice_read+0x6b>
+  80299b:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  80299f:	74 32                	je     8029d3 <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  8029a1:	8b 48 08             	mov    0x8(%eax),%ecx
+  8029a4:	83 e1 03             	and    $0x3,%ecx
+  8029a7:	83 f9 01             	cmp    $0x1,%ecx
+  8029aa:	74 2e                	je     8029da <pipe_splice_read+0x79>
+  8029ac:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  8029b2:	75 2d                	jne    8029e1 <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  8029b4:	83 ec 08             	sub    $0x8,%esp
+  8029b7:	53                   	push   %ebx
+  8029b8:	68 00 10 00 00       	push   $0x1000
+  8029bd:	89 d9                	mov    %ebx,%ecx
+  8029bf:	e8 93 fa ff ff       	call   802457 <devpipe_read_bulk>
+  8029c4:	83 c4 10             	add    $0x10,%esp
+}
+  8029c7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029ca:	c9                   	leave
+  8029cb:	c3                   	ret
+    return -E_INVAL;
+  8029cc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8029d1:	eb f4                	jmp    8029c7 <pipe_splice_read+0x66>
+  8029d3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8029d8:	eb ed                	jmp    8029c7 <pipe_splice_read+0x66>
+  8029da:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8029df:	eb e6                	jmp    8029c7 <pipe_splice_read+0x66>
+  8029e1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8029e6:	eb df                	jmp    8029c7 <pipe_splice_read+0x66>
+
+008029e8 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  8029e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029ed:	c3                   	ret
+
+008029ee <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8029ee:	55                   	push   %ebp
+  8029ef:	89 e5                	mov    %esp,%ebp
+  8029f1:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  8029f4:	68 47 34 80 00       	push   $0x803447
+  8029f9:	ff 75 0c             	push   0xc(%ebp)
+  8029fc:	e8 ff dd ff ff       	call   800800 <strcpy>
+  return 0;
+}
+  802a01:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a06:	c9                   	leave
+  802a07:	c3                   	ret
+
+00802a08 <devcons_write>:
+{
+  802a08:	55                   	push   %ebp
+  802a09:	89 e5                	mov    %esp,%ebp
+  802a0b:	57                   	push   %edi
+  802a0c:	56                   	push   %esi
+  802a0d:	53                   	push   %ebx
+  802a0e:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  802a14:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  802a19:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  802a1f:	eb 2e                	jmp    802a4f <devcons_write+0x47>
+    m = n - tot;
+  802a21:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802a24:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  802a26:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802a2b:	39 c3                	cmp    %eax,%ebx
+  802a2d:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  802a30:	83 ec 04             	sub    $0x4,%esp
+  802a33:	53                   	push   %ebx
+  802a34:	89 f0                	mov    %esi,%eax
+  802a36:	03 45 0c             	add    0xc(%ebp),%eax
+  802a39:	50                   	push   %eax
+  802a3a:	57                   	push   %edi
+  802a3b:	e8 46 df ff ff       	call   800986 <memmove>
+    sys_cputs(buf, m);
+  802a40:	83 c4 08             	add    $0x8,%esp
+  802a43:	53                   	push   %ebx
+  802a44:	57                   	push   %edi
+  802a45:	e8 e6 e0 ff ff       	call   800b30 <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  802a4a:	01 de                	add    %ebx,%esi
+  802a4c:	83 c4 10             	add    $0x10,%esp
+  802a4f:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802a52:	72 cd                	jb     802a21 <devcons_write+0x19>
+}
+  802a54:	89 f0                	mov    %esi,%eax
+  802a56:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a59:	5b                   	pop    %ebx
+  802a5a:	5e                   	pop    %esi
+  802a5b:	5f                   	pop    %edi
+  802a5c:	5d                   	pop    %ebp
+  802a5d:	c3                   	ret
+
+00802a5e <devcons_read>:
+{
+  802a5e:	55                   	push   %ebp
+  802a5f:	89 e5                	mov    %esp,%ebp
+  802a61:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  802a64:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a69:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802a6d:	75 07                	jne    802a76 <devcons_read+0x18>
+  802a6f:	eb 1f                	jmp    802a90 <devcons_read+0x32>
+    sys_yield();
+  802a71:	e8 57 e1 ff ff       	call   800bcd <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  802a76:	e8 d3 e0 ff ff       	call   800b4e <sys_cgetc>
+  802a7b:	85 c0                	test   %eax,%eax
+  802a7d:	74 f2                	je     802a71 <devcons_read+0x13>
+  if (c < 0)
+  802a7f:	78 0f                	js     802a90 <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  802a81:	83 f8 04             	cmp    $0x4,%eax
+  802a84:	74 0c                	je     802a92 <devcons_read+0x34>
+  *(char*)vbuf = c;
+  802a86:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802a89:	88 02                	mov    %al,(%edx)
+  return 1;
+  802a8b:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802a90:	c9                   	leave
+  802a91:	c3                   	ret
+    return 0;
+  802a92:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a97:	eb f7                	jmp    802a90 <devcons_read+0x32>
+
+00802a99 <cputchar>:
+{
+  802a99:	55                   	push   %ebp
+  802a9a:	89 e5                	mov    %esp,%ebp
+  802a9c:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  802a9f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802aa2:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  802aa5:	6a 01                	push   $0x1
+  802aa7:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802aaa:	50                   	push   %eax
+  802aab:	e8 80 e0 ff ff       	call   800b30 <sys_cputs>
+}
+  802ab0:	83 c4 10             	add    $0x10,%esp
+  802ab3:	c9                   	leave
+  802ab4:	c3                   	ret
+
+00802ab5 <getchar>:
+{
+  802ab5:	55                   	push   %ebp
+  802ab6:	89 e5                	mov    %esp,%ebp
+  802ab8:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  802abb:	6a 01                	push   $0x1
+  802abd:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802ac0:	50                   	push   %eax
+  802ac1:	6a 00                	push   $0x0
+  802ac3:	e8 a8 e9 ff ff       	call   801470 <read>
+  if (r < 0)
+  802ac8:	83 c4 10             	add    $0x10,%esp
+  802acb:	85 c0                	test   %eax,%eax
+  802acd:	78 06                	js     802ad5 <getchar+0x20>
+  if (r < 1)
+  802acf:	74 06                	je     802ad7 <getchar+0x22>
+  return c;
+  802ad1:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802ad5:	c9                   	leave
+  802ad6:	c3                   	ret
+    return -E_EOF;
+  802ad7:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802adc:	eb f7                	jmp    802ad5 <getchar+0x20>
+
+00802ade <iscons>:
+{
+  802ade:	55                   	push   %ebp
+  802adf:	89 e5                	mov    %esp,%ebp
+  802ae1:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802ae4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802ae7:	50                   	push   %eax
+  802ae8:	ff 75 08             	push   0x8(%ebp)
+  802aeb:	e8 d5 e6 ff ff       	call   8011c5 <fd_lookup>
+  802af0:	83 c4 10             	add    $0x10,%esp
+  802af3:	85 c0                	test   %eax,%eax
+  802af5:	78 11                	js     802b08 <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  802af7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802afa:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802b00:	39 10                	cmp    %edx,(%eax)
+  802b02:	0f 94 c0             	sete   %al
+  802b05:	0f b6 c0             	movzbl %al,%eax
+}
+  802b08:	c9                   	leave
+  802b09:	c3                   	ret
+
+00802b0a <opencons>:
+{
+  802b0a:	55                   	push   %ebp
+  802b0b:	89 e5                	mov    %esp,%ebp
+  802b0d:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  802b10:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b13:	50                   	push   %eax
+  802b14:	e8 56 e6 ff ff       	call   80116f <fd_alloc>
+  802b19:	83 c4 10             	add    $0x10,%esp
+  802b1c:	85 c0                	test   %eax,%eax
+  802b1e:	78 3a                	js     802b5a <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802b20:	83 ec 04             	sub    $0x4,%esp
+  802b23:	68 07 04 00 00       	push   $0x407
+  802b28:	ff 75 f4             	push   -0xc(%ebp)
+  802b2b:	6a 00                	push   $0x0
+  802b2d:	e8 fd e0 ff ff       	call   800c2f <sys_page_alloc>
+  802b32:	83 c4 10             	add    $0x10,%esp
+  802b35:	85 c0                	test   %eax,%eax
+  802b37:	78 21                	js     802b5a <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  802b39:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b3c:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802b42:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  802b44:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b47:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  802b4e:	83 ec 0c             	sub    $0xc,%esp
+  802b51:	50                   	push   %eax
+  802b52:	e8 f4 e5 ff ff       	call   80114b <fd2num>
+  802b57:	83 c4 10             	add    $0x10,%esp
+}
+  802b5a:	c9                   	leave
+  802b5b:	c3                   	ret
+
+00802b5c <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  802b5c:	55                   	push   %ebp
+  802b5d:	89 e5                	mov    %esp,%ebp
+  802b5f:	57                   	push   %edi
+  802b60:	56                   	push   %esi
+  802b61:	53                   	push   %ebx
+  802b62:	83 ec 14             	sub    $0x14,%esp
+  802b65:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802b68:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b6b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802b6e:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  802b71:	85 c0                	test   %eax,%eax
+  802b73:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802b78:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  802b7b:	ff 33                	push   (%ebx)
+  802b7d:	50                   	push   %eax
+  802b7e:	e8 84 e3 ff ff       	call   800f07 <sys_ipc_recv>
+  802b83:	83 c4 10             	add    $0x10,%esp
+  802b86:	85 c0                	test   %eax,%eax
+  802b88:	78 39                	js     802bc3 <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  802b8a:	85 ff                	test   %edi,%edi
+  802b8c:	74 0a                	je     802b98 <ipc_recv_pages+0x3c>
+  802b8e:	a1 44 57 80 00       	mov    0x805744,%eax
+  802b93:	8b 40 7c             	mov    0x7c(%eax),%eax
+  802b96:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  802b98:	85 f6                	test   %esi,%esi
+  802b9a:	74 0d                	je     802ba9 <ipc_recv_pages+0x4d>
+  802b9c:	a1 44 57 80 00       	mov    0x805744,%eax
+  802ba1:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  802ba7:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  802ba9:	a1 44 57 80 00       	mov    0x805744,%eax
+  802bae:	8b 40 74             	mov    0x74(%eax),%eax
+  802bb1:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  802bb3:	a1 44 57 80 00       	mov    0x805744,%eax
+  802bb8:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  802bbb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802bbe:	5b                   	pop    %ebx
+  802bbf:	5e                   	pop    %esi
+  802bc0:	5f                   	pop    %edi
+  802bc1:	5d                   	pop    %ebp
+  802bc2:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  802bc3:	85 ff                	test   %edi,%edi
+  802bc5:	74 06                	je     802bcd <ipc_recv_pages+0x71>
+  802bc7:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  802bcd:	85 f6                	test   %esi,%esi
+  802bcf:	74 06                	je     802bd7 <ipc_recv_pages+0x7b>
+  802bd1:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  802bd7:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  802bdd:	eb dc                	jmp    802bbb <ipc_recv_pages+0x5f>
+
+00802bdf <ipc_recv>:
+{
+  802bdf:	55                   	push   %ebp
+  802be0:	89 e5                	mov    %esp,%ebp
+  802be2:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  802be5:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  802bec:	ff 75 10             	push   0x10(%ebp)
+  802bef:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802bf2:	50                   	push   %eax
+  802bf3:	ff 75 0c             	push   0xc(%ebp)
+  802bf6:	ff 75 08             	push   0x8(%ebp)
+  802bf9:	e8 5e ff ff ff       	call   802b5c <ipc_recv_pages>
+}
+  802bfe:	c9                   	leave
+  802bff:	c3                   	ret
+
+00802c00 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  802c00:	55                   	push   %ebp
+  802c01:	89 e5                	mov    %esp,%ebp
+  802c03:	57                   	push   %edi
+  802c04:	56                   	push   %esi
+  802c05:	53                   	push   %ebx
+  802c06:	83 ec 0c             	sub    $0xc,%esp
+  802c09:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802c0c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802c0f:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  802c12:	89 c3                	mov    %eax,%ebx
+  802c14:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  802c1a:	85 c0                	test   %eax,%eax
+  802c1c:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802c21:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  802c24:	83 ec 0c             	sub    $0xc,%esp
+  802c27:	ff 75 14             	push   0x14(%ebp)
+  802c2a:	ff 75 18             	push   0x18(%ebp)
+  802c2d:	53                   	push   %ebx
+  802c2e:	56                   	push   %esi
+  802c2f:	57                   	push   %edi
+  802c30:	e8 b1 e2 ff ff       	call   800ee6 <sys_ipc_try_send>
+  802c35:	83 c4 20             	add    $0x20,%esp
+  802c38:	85 c0                	test   %eax,%eax
+  802c3a:	79 1e                	jns    802c5a <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  802c3c:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802c3f:	75 07                	jne    802c48 <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  802c41:	e8 87 df ff ff       	call   800bcd <sys_yield>
+  802c46:	eb dc                	jmp    802c24 <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  802c48:	50                   	push   %eax
+  802c49:	68 53 34 80 00       	push   $0x803453
+  802c4e:	6a 5c                	push   $0x5c
+  802c50:	68 60 34 80 00       	push   $0x803460
+  802c55:	e8 dd d4 ff ff       	call   800137 <_panic>
+  }
+}
+  802c5a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c5d:	5b                   	pop    %ebx
+  802c5e:	5e                   	pop    %esi
+  802c5f:	5f                   	pop    %edi
+  802c60:	5d                   	pop    %ebp
+  802c61:	c3                   	ret
+
+00802c62 <ipc_send>:
+{
+  802c62:	55                   	push   %ebp
+  802c63:	89 e5                	mov    %esp,%ebp
+  802c65:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  802c68:	ff 75 14             	push   0x14(%ebp)
+  802c6b:	6a 01                	push   $0x1
+  802c6d:	ff 75 10             	push   0x10(%ebp)
+  802c70:	ff 75 0c             	push   0xc(%ebp)
+  802c73:	ff 75 08             	push   0x8(%ebp)
+  802c76:	e8 85 ff ff ff       	call   802c00 <ipc_send_pages>
+}
+  802c7b:	83 c4 20             	add    $0x20,%esp
+  802c7e:	c9                   	leave
+  802c7f:	c3                   	ret
+
+00802c80 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802c80:	55                   	push   %ebp
+  802c81:	89 e5                	mov    %esp,%ebp
+  802c83:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  802c86:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  802c8b:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802c8e:	c1 e0 04             	shl    $0x4,%eax
+  802c91:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802c96:	8b 40 50             	mov    0x50(%eax),%eax
+  802c99:	39 c8                	cmp    %ecx,%eax
+  802c9b:	74 12                	je     802caf <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  802c9d:	83 c2 01             	add    $0x1,%edx
+  802ca0:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802ca6:	75 e3                	jne    802c8b <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  802ca8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cad:	eb 0e                	jmp    802cbd <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  802caf:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802cb2:	c1 e0 04             	shl    $0x4,%eax
+  802cb5:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802cba:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802cbd:	5d                   	pop    %ebp
+  802cbe:	c3                   	ret
+
+00802cbf <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802cbf:	55                   	push   %ebp
+  802cc0:	89 e5                	mov    %esp,%ebp
+  802cc2:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802cc5:	89 c2                	mov    %eax,%edx
+  802cc7:	c1 ea 16             	shr    $0x16,%edx
+  802cca:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  802cd1:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802cd6:	f6 c1 01             	test   $0x1,%cl
+  802cd9:	74 1c                	je     802cf7 <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  802cdb:	c1 e8 0c             	shr    $0xc,%eax
+  802cde:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  802ce5:	a8 01                	test   $0x1,%al
+  802ce7:	74 0e                	je     802cf7 <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  802ce9:	c1 e8 0c             	shr    $0xc,%eax
+  802cec:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802cf3:	ef 
+  802cf4:	0f b7 d2             	movzwl %dx,%edx
+}
+  802cf7:	89 d0                	mov    %edx,%eax
+  802cf9:	5d                   	pop    %ebp
+  802cfa:	c3                   	ret
+
+00802cfb <udivmod>:
+  802cfb:	55                   	push   %ebp
+  802cfc:	57                   	push   %edi
+  802cfd:	56                   	push   %esi
+  802cfe:	53                   	push   %ebx
+  802cff:	83 ec 14             	sub    $0x14,%esp
+  802d02:	8b 74 24 28          	mov    0x28(%esp),%esi
+  802d06:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  802d0a:	89 fb                	mov    %edi,%ebx
+  802d0c:	09 f3                	or     %esi,%ebx
+  802d0e:	0f 84 88 00 00 00    	je     802d9c <udivmod+0xa1>
+  802d14:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802d19:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802d20:	00 
+  802d21:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802d28:	00 
+  802d29:	89 cd                	mov    %ecx,%ebp
+  802d2b:	89 34 24             	mov    %esi,(%esp)
+  802d2e:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802d32:	eb 08                	jmp    802d3c <udivmod+0x41>
+  802d34:	83 ed 01             	sub    $0x1,%ebp
+  802d37:	83 fd ff             	cmp    $0xffffffff,%ebp
+  802d3a:	74 6c                	je     802da8 <udivmod+0xad>
+  802d3c:	89 c3                	mov    %eax,%ebx
+  802d3e:	89 d6                	mov    %edx,%esi
+  802d40:	89 e9                	mov    %ebp,%ecx
+  802d42:	0f ad f3             	shrd   %cl,%esi,%ebx
+  802d45:	d3 ee                	shr    %cl,%esi
+  802d47:	f6 c1 20             	test   $0x20,%cl
+  802d4a:	74 04                	je     802d50 <udivmod+0x55>
+  802d4c:	89 f3                	mov    %esi,%ebx
+  802d4e:	31 f6                	xor    %esi,%esi
+  802d50:	8b 3c 24             	mov    (%esp),%edi
+  802d53:	39 fb                	cmp    %edi,%ebx
+  802d55:	89 f7                	mov    %esi,%edi
+  802d57:	8b 1c 24             	mov    (%esp),%ebx
+  802d5a:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802d5e:	19 f7                	sbb    %esi,%edi
+  802d60:	72 d2                	jb     802d34 <udivmod+0x39>
+  802d62:	89 f7                	mov    %esi,%edi
+  802d64:	89 de                	mov    %ebx,%esi
+  802d66:	89 e9                	mov    %ebp,%ecx
+  802d68:	0f a5 f7             	shld   %cl,%esi,%edi
+  802d6b:	d3 e6                	shl    %cl,%esi
+  802d6d:	f6 c1 20             	test   $0x20,%cl
+  802d70:	74 04                	je     802d76 <udivmod+0x7b>
+  802d72:	89 f7                	mov    %esi,%edi
+  802d74:	31 f6                	xor    %esi,%esi
+  802d76:	29 f0                	sub    %esi,%eax
+  802d78:	19 fa                	sbb    %edi,%edx
+  802d7a:	be 01 00 00 00       	mov    $0x1,%esi
+  802d7f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d84:	0f a5 f7             	shld   %cl,%esi,%edi
+  802d87:	d3 e6                	shl    %cl,%esi
+  802d89:	f6 c1 20             	test   $0x20,%cl
+  802d8c:	74 04                	je     802d92 <udivmod+0x97>
+  802d8e:	89 f7                	mov    %esi,%edi
+  802d90:	31 f6                	xor    %esi,%esi
+  802d92:	09 74 24 08          	or     %esi,0x8(%esp)
+  802d96:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802d9a:	eb 98                	jmp    802d34 <udivmod+0x39>
+  802d9c:	89 f0                	mov    %esi,%eax
+  802d9e:	89 fa                	mov    %edi,%edx
+  802da0:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802da4:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802da8:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802dac:	89 01                	mov    %eax,(%ecx)
+  802dae:	89 51 04             	mov    %edx,0x4(%ecx)
+  802db1:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802db5:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802db9:	83 c4 14             	add    $0x14,%esp
+  802dbc:	5b                   	pop    %ebx
+  802dbd:	5e                   	pop    %esi
+  802dbe:	5f                   	pop    %edi
+  802dbf:	5d                   	pop    %ebp
+  802dc0:	c3                   	ret
+
+00802dc1 <__udivdi3>:
+  802dc1:	83 ec 18             	sub    $0x18,%esp
+  802dc4:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802dc8:	50                   	push   %eax
+  802dc9:	ff 74 24 2c          	push   0x2c(%esp)
+  802dcd:	ff 74 24 2c          	push   0x2c(%esp)
+  802dd1:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802dd5:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802dd9:	e8 1d ff ff ff       	call   802cfb <udivmod>
+  802dde:	83 c4 24             	add    $0x24,%esp
+  802de1:	c3                   	ret
+
+00802de2 <__umoddi3>:
+  802de2:	83 ec 18             	sub    $0x18,%esp
+  802de5:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802de9:	50                   	push   %eax
+  802dea:	ff 74 24 2c          	push   0x2c(%esp)
+  802dee:	ff 74 24 2c          	push   0x2c(%esp)
+  802df2:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802df6:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802dfa:	e8 fc fe ff ff       	call   802cfb <udivmod>
+  802dff:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802e03:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802e07:	83 c4 24             	add    $0x24,%esp
+  802e0a:	c3                   	ret
+
+00802e0b <__divdi3>:
+  802e0b:	56                   	push   %esi
+  802e0c:	53                   	push   %ebx
+  802e0d:	83 ec 14             	sub    $0x14,%esp
+  802e10:	8b 44 24 20          	mov    0x20(%esp),%eax
+  802e14:	8b 54 24 24          	mov    0x24(%esp),%edx
+  802e18:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  802e1c:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  802e20:	85 d2                	test   %edx,%edx
+  802e22:	78 18                	js     802e3c <__divdi3+0x31>
+  802e24:	85 db                	test   %ebx,%ebx
+  802e26:	78 3e                	js     802e66 <__divdi3+0x5b>
+  802e28:	83 ec 04             	sub    $0x4,%esp
+  802e2b:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802e2f:	56                   	push   %esi
+  802e30:	53                   	push   %ebx
+  802e31:	51                   	push   %ecx
+  802e32:	e8 c4 fe ff ff       	call   802cfb <udivmod>
+  802e37:	83 c4 10             	add    $0x10,%esp
+  802e3a:	eb 24                	jmp    802e60 <__divdi3+0x55>
+  802e3c:	f7 d8                	neg    %eax
+  802e3e:	83 d2 00             	adc    $0x0,%edx
+  802e41:	f7 da                	neg    %edx
+  802e43:	85 db                	test   %ebx,%ebx
+  802e45:	78 3a                	js     802e81 <__divdi3+0x76>
+  802e47:	83 ec 04             	sub    $0x4,%esp
+  802e4a:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802e4e:	56                   	push   %esi
+  802e4f:	53                   	push   %ebx
+  802e50:	51                   	push   %ecx
+  802e51:	e8 a5 fe ff ff       	call   802cfb <udivmod>
+  802e56:	83 c4 10             	add    $0x10,%esp
+  802e59:	f7 d8                	neg    %eax
+  802e5b:	83 d2 00             	adc    $0x0,%edx
+  802e5e:	f7 da                	neg    %edx
+  802e60:	83 c4 14             	add    $0x14,%esp
+  802e63:	5b                   	pop    %ebx
+  802e64:	5e                   	pop    %esi
+  802e65:	c3                   	ret
+  802e66:	83 ec 04             	sub    $0x4,%esp
+  802e69:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802e6d:	56                   	push   %esi
+  802e6e:	f7 d9                	neg    %ecx
+  802e70:	83 d3 00             	adc    $0x0,%ebx
+  802e73:	f7 db                	neg    %ebx
+  802e75:	53                   	push   %ebx
+  802e76:	51                   	push   %ecx
+  802e77:	e8 7f fe ff ff       	call   802cfb <udivmod>
+  802e7c:	83 c4 10             	add    $0x10,%esp
+  802e7f:	eb d8                	jmp    802e59 <__divdi3+0x4e>
+  802e81:	83 ec 04             	sub    $0x4,%esp
+  802e84:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802e88:	56                   	push   %esi
+  802e89:	f7 d9                	neg    %ecx
+  802e8b:	83 d3 00             	adc    $0x0,%ebx
+  802e8e:	f7 db                	neg    %ebx
+  802e90:	53                   	push   %ebx
+  802e91:	51                   	push   %ecx
+  802e92:	e8 64 fe ff ff       	call   802cfb <udivmod>
+  802e97:	83 c4 10             	add    $0x10,%esp
+  802e9a:	eb c4                	jmp    802e60 <__divdi3+0x55>
+
+00802e9c <__moddi3>:
+  802e9c:	55                   	push   %ebp
+  802e9d:	57                   	push   %edi
+  802e9e:	56                   	push   %esi
+  802e9f:	53                   	push   %ebx
+  802ea0:	83 ec 24             	sub    $0x24,%esp
+  802ea3:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802ea7:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802eab:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  802eaf:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  802eb3:	85 d2                	test   %edx,%edx
+  802eb5:	78 3b                	js     802ef2 <__moddi3+0x56>
+  802eb7:	83 ec 04             	sub    $0x4,%esp
+  802eba:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  802ebe:	56                   	push   %esi
+  802ebf:	89 ce                	mov    %ecx,%esi
+  802ec1:	f7 de                	neg    %esi
+  802ec3:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802ec7:	89 de                	mov    %ebx,%esi
+  802ec9:	83 d6 00             	adc    $0x0,%esi
+  802ecc:	f7 de                	neg    %esi
+  802ece:	89 74 24 14          	mov    %esi,0x14(%esp)
+  802ed2:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802ed6:	0f 48 f1             	cmovs  %ecx,%esi
+  802ed9:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  802ede:	53                   	push   %ebx
+  802edf:	56                   	push   %esi
+  802ee0:	e8 16 fe ff ff       	call   802cfb <udivmod>
+  802ee5:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802ee9:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802eed:	83 c4 10             	add    $0x10,%esp
+  802ef0:	eb 47                	jmp    802f39 <__moddi3+0x9d>
+  802ef2:	f7 d8                	neg    %eax
+  802ef4:	83 d2 00             	adc    $0x0,%edx
+  802ef7:	f7 da                	neg    %edx
+  802ef9:	83 ec 04             	sub    $0x4,%esp
+  802efc:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  802f00:	56                   	push   %esi
+  802f01:	89 cf                	mov    %ecx,%edi
+  802f03:	f7 df                	neg    %edi
+  802f05:	89 de                	mov    %ebx,%esi
+  802f07:	83 d6 00             	adc    $0x0,%esi
+  802f0a:	f7 de                	neg    %esi
+  802f0c:	0f 49 cf             	cmovns %edi,%ecx
+  802f0f:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802f13:	0f 49 de             	cmovns %esi,%ebx
+  802f16:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  802f1a:	ff 74 24 0c          	push   0xc(%esp)
+  802f1e:	ff 74 24 0c          	push   0xc(%esp)
+  802f22:	e8 d4 fd ff ff       	call   802cfb <udivmod>
+  802f27:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802f2b:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802f2f:	f7 d8                	neg    %eax
+  802f31:	83 d2 00             	adc    $0x0,%edx
+  802f34:	f7 da                	neg    %edx
+  802f36:	83 c4 10             	add    $0x10,%esp
+  802f39:	83 c4 24             	add    $0x24,%esp
+  802f3c:	5b                   	pop    %ebx
+  802f3d:	5e                   	pop    %esi
+  802f3e:	5f                   	pop    %edi
+  802f3f:	5d                   	pop    %ebp
+  802f40:	c3                   	ret
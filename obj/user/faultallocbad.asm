@@ -0,0 +1,6521 @@
+
+obj/user/faultallocbad.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 84 00 00 00       	call   8000b5 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <handler>:
+
+#include <inc/lib.h>
+
+void
+handler(struct UTrapframe *utf)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 0c             	sub    $0xc,%esp
+  int r;
+  void *addr = (void*)utf->utf_fault_va;
+  80003a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80003d:	8b 18                	mov    (%eax),%ebx
+
+  cprintf("fault %x\n", addr);
+  80003f:	53                   	push   %ebx
+  800040:	68 40 2f 80 00       	push   $0x802f40
+  800045:	e8 b3 01 00 00       	call   8001fd <cprintf>
+  if ((r = sys_page_alloc(0, ROUNDDOWN(addr, PGSIZE),
+  80004a:	83 c4 0c             	add    $0xc,%esp
+  80004d:	6a 07                	push   $0x7
+  80004f:	89 d8                	mov    %ebx,%eax
+  800051:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  800056:	50                   	push   %eax
+  800057:	6a 00                	push   $0x0
+  800059:	e8 bc 0b 00 00       	call   800c1a <sys_page_alloc>
+  80005e:	83 c4 10             	add    $0x10,%esp
+  800061:	85 c0                	test   %eax,%eax
+  800063:	78 16                	js     80007b <handler+0x48>
+                          PTE_P|PTE_U|PTE_W)) < 0)
+    panic("allocating at %x in page fault handler: %e", addr, r);
+  snprintf((char*)addr, 100, "this string was faulted in at %x", addr);
+  800065:	53                   	push   %ebx
+  800066:	68 8c 2f 80 00       	push   $0x802f8c
+  80006b:	6a 64                	push   $0x64
+  80006d:	53                   	push   %ebx
+  80006e:	e8 23 07 00 00       	call   800796 <snprintf>
+}
+  800073:	83 c4 10             	add    $0x10,%esp
+  800076:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800079:	c9                   	leave
+  80007a:	c3                   	ret
+    panic("allocating at %x in page fault handler: %e", addr, r);
+  80007b:	83 ec 0c             	sub    $0xc,%esp
+  80007e:	50                   	push   %eax
+  80007f:	53                   	push   %ebx
+  800080:	68 60 2f 80 00       	push   $0x802f60
+  800085:	6a 0f                	push   $0xf
+  800087:	68 4a 2f 80 00       	push   $0x802f4a
+  80008c:	e8 91 00 00 00       	call   800122 <_panic>
+
+00800091 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800091:	55                   	push   %ebp
+  800092:	89 e5                	mov    %esp,%ebp
+  800094:	83 ec 14             	sub    $0x14,%esp
+  set_pgfault_handler(handler);
+  800097:	68 33 00 80 00       	push   $0x800033
+  80009c:	e8 28 10 00 00       	call   8010c9 <set_pgfault_handler>
+  sys_cputs((char*)0xDEADBEEF, 4);
+  8000a1:	83 c4 08             	add    $0x8,%esp
+  8000a4:	6a 04                	push   $0x4
+  8000a6:	68 ef be ad de       	push   $0xdeadbeef
+  8000ab:	e8 6b 0a 00 00       	call   800b1b <sys_cputs>
+}
+  8000b0:	83 c4 10             	add    $0x10,%esp
+  8000b3:	c9                   	leave
+  8000b4:	c3                   	ret
+
+008000b5 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000b5:	55                   	push   %ebp
+  8000b6:	89 e5                	mov    %esp,%ebp
+  8000b8:	56                   	push   %esi
+  8000b9:	53                   	push   %ebx
+  8000ba:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000bd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  8000c0:	c7 05 44 57 80 00 00 	movl   $0x0,0x805744
+  8000c7:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  8000ca:	e8 ca 0a 00 00       	call   800b99 <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  8000cf:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000d4:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8000d7:	c1 e0 04             	shl    $0x4,%eax
+  8000da:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000df:	a3 44 57 80 00       	mov    %eax,0x805744
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8000e4:	85 db                	test   %ebx,%ebx
+  8000e6:	7e 07                	jle    8000ef <libmain+0x3a>
+    binaryname = argv[0];
+  8000e8:	8b 06                	mov    (%esi),%eax
+  8000ea:	a3 00 40 80 00       	mov    %eax,0x804000
+
+  // call user main routine
+  umain(argc, argv);
+  8000ef:	83 ec 08             	sub    $0x8,%esp
+  8000f2:	56                   	push   %esi
+  8000f3:	53                   	push   %ebx
+  8000f4:	e8 98 ff ff ff       	call   800091 <umain>
+
+  // exit gracefully
+  exit();
+  8000f9:	e8 0a 00 00 00       	call   800108 <exit>
+}
+  8000fe:	83 c4 10             	add    $0x10,%esp
+  800101:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800104:	5b                   	pop    %ebx
+  800105:	5e                   	pop    %esi
+  800106:	5d                   	pop    %ebp
+  800107:	c3                   	ret
+
+00800108 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800108:	55                   	push   %ebp
+  800109:	89 e5                	mov    %esp,%ebp
+  80010b:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  80010e:	e8 ed 11 00 00       	call   801300 <close_all>
+  sys_env_destroy(0);
+  800113:	83 ec 0c             	sub    $0xc,%esp
+  800116:	6a 00                	push   $0x0
+  800118:	e8 3b 0a 00 00       	call   800b58 <sys_env_destroy>
+}
+  80011d:	83 c4 10             	add    $0x10,%esp
+  800120:	c9                   	leave
+  800121:	c3                   	ret
+
+00800122 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800122:	55                   	push   %ebp
+  800123:	89 e5                	mov    %esp,%ebp
+  800125:	56                   	push   %esi
+  800126:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  800127:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  80012a:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  800130:	e8 64 0a 00 00       	call   800b99 <sys_getenvid>
+  800135:	83 ec 0c             	sub    $0xc,%esp
+  800138:	ff 75 0c             	push   0xc(%ebp)
+  80013b:	ff 75 08             	push   0x8(%ebp)
+  80013e:	56                   	push   %esi
+  80013f:	50                   	push   %eax
+  800140:	68 b8 2f 80 00       	push   $0x802fb8
+  800145:	e8 b3 00 00 00       	call   8001fd <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  80014a:	83 c4 18             	add    $0x18,%esp
+  80014d:	53                   	push   %ebx
+  80014e:	ff 75 10             	push   0x10(%ebp)
+  800151:	e8 56 00 00 00       	call   8001ac <vcprintf>
+  cprintf("\n");
+  800156:	c7 04 24 20 34 80 00 	movl   $0x803420,(%esp)
+  80015d:	e8 9b 00 00 00       	call   8001fd <cprintf>
+  800162:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  800165:	cc                   	int3
+  while (1)
+  800166:	eb fd                	jmp    800165 <_panic+0x43>
+
+00800168 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800168:	55                   	push   %ebp
+  800169:	89 e5                	mov    %esp,%ebp
+  80016b:	53                   	push   %ebx
+  80016c:	83 ec 04             	sub    $0x4,%esp
+  80016f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  800172:	8b 13                	mov    (%ebx),%edx
+  800174:	8d 42 01             	lea    0x1(%edx),%eax
+  800177:	89 03                	mov    %eax,(%ebx)
+  800179:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80017c:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  800180:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800185:	74 09                	je     800190 <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  800187:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80018b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80018e:	c9                   	leave
+  80018f:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  800190:	83 ec 08             	sub    $0x8,%esp
+  800193:	68 ff 00 00 00       	push   $0xff
+  800198:	8d 43 08             	lea    0x8(%ebx),%eax
+  80019b:	50                   	push   %eax
+  80019c:	e8 7a 09 00 00       	call   800b1b <sys_cputs>
+    b->idx = 0;
+  8001a1:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001a7:	83 c4 10             	add    $0x10,%esp
+  8001aa:	eb db                	jmp    800187 <putch+0x1f>
+
+008001ac <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001ac:	55                   	push   %ebp
+  8001ad:	89 e5                	mov    %esp,%ebp
+  8001af:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  8001b5:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001bc:	00 00 00 
+  b.cnt = 0;
+  8001bf:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001c6:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  8001c9:	ff 75 0c             	push   0xc(%ebp)
+  8001cc:	ff 75 08             	push   0x8(%ebp)
+  8001cf:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001d5:	50                   	push   %eax
+  8001d6:	68 68 01 80 00       	push   $0x800168
+  8001db:	e8 14 01 00 00       	call   8002f4 <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  8001e0:	83 c4 08             	add    $0x8,%esp
+  8001e3:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001e9:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001ef:	50                   	push   %eax
+  8001f0:	e8 26 09 00 00       	call   800b1b <sys_cputs>
+
+  return b.cnt;
+}
+  8001f5:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001fb:	c9                   	leave
+  8001fc:	c3                   	ret
+
+008001fd <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8001fd:	55                   	push   %ebp
+  8001fe:	89 e5                	mov    %esp,%ebp
+  800200:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  800203:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  800206:	50                   	push   %eax
+  800207:	ff 75 08             	push   0x8(%ebp)
+  80020a:	e8 9d ff ff ff       	call   8001ac <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  80020f:	c9                   	leave
+  800210:	c3                   	ret
+
+00800211 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  800211:	55                   	push   %ebp
+  800212:	89 e5                	mov    %esp,%ebp
+  800214:	57                   	push   %edi
+  800215:	56                   	push   %esi
+  800216:	53                   	push   %ebx
+  800217:	83 ec 1c             	sub    $0x1c,%esp
+  80021a:	89 c7                	mov    %eax,%edi
+  80021c:	89 d6                	mov    %edx,%esi
+  80021e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800221:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800224:	89 d1                	mov    %edx,%ecx
+  800226:	89 c2                	mov    %eax,%edx
+  800228:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80022b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80022e:	8b 45 10             	mov    0x10(%ebp),%eax
+  800231:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  800234:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800237:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80023e:	39 c2                	cmp    %eax,%edx
+  800240:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800243:	72 3e                	jb     800283 <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  800245:	83 ec 0c             	sub    $0xc,%esp
+  800248:	ff 75 18             	push   0x18(%ebp)
+  80024b:	83 eb 01             	sub    $0x1,%ebx
+  80024e:	53                   	push   %ebx
+  80024f:	50                   	push   %eax
+  800250:	83 ec 08             	sub    $0x8,%esp
+  800253:	ff 75 e4             	push   -0x1c(%ebp)
+  800256:	ff 75 e0             	push   -0x20(%ebp)
+  800259:	ff 75 dc             	push   -0x24(%ebp)
+  80025c:	ff 75 d8             	push   -0x28(%ebp)
+  80025f:	e8 48 2b 00 00       	call   802dac <__udivdi3>
+  800264:	83 c4 18             	add    $0x18,%esp
+  800267:	52                   	push   %edx
+  800268:	50                   	push   %eax
+  800269:	89 f2                	mov    %esi,%edx
+  80026b:	89 f8                	mov    %edi,%eax
+  80026d:	e8 9f ff ff ff       	call   800211 <printnum>
+  800272:	83 c4 20             	add    $0x20,%esp
+  800275:	eb 13                	jmp    80028a <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  800277:	83 ec 08             	sub    $0x8,%esp
+  80027a:	56                   	push   %esi
+  80027b:	ff 75 18             	push   0x18(%ebp)
+  80027e:	ff d7                	call   *%edi
+  800280:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  800283:	83 eb 01             	sub    $0x1,%ebx
+  800286:	85 db                	test   %ebx,%ebx
+  800288:	7f ed                	jg     800277 <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  80028a:	83 ec 08             	sub    $0x8,%esp
+  80028d:	56                   	push   %esi
+  80028e:	83 ec 04             	sub    $0x4,%esp
+  800291:	ff 75 e4             	push   -0x1c(%ebp)
+  800294:	ff 75 e0             	push   -0x20(%ebp)
+  800297:	ff 75 dc             	push   -0x24(%ebp)
+  80029a:	ff 75 d8             	push   -0x28(%ebp)
+  80029d:	e8 2b 2b 00 00       	call   802dcd <__umoddi3>
+  8002a2:	83 c4 14             	add    $0x14,%esp
+  8002a5:	0f be 80 db 2f 80 00 	movsbl 0x802fdb(%eax),%eax
+  8002ac:	50                   	push   %eax
+  8002ad:	ff d7                	call   *%edi
+}
+  8002af:	83 c4 10             	add    $0x10,%esp
+  8002b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002b5:	5b                   	pop    %ebx
+  8002b6:	5e                   	pop    %esi
+  8002b7:	5f                   	pop    %edi
+  8002b8:	5d                   	pop    %ebp
+  8002b9:	c3                   	ret
+
+008002ba <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002ba:	55                   	push   %ebp
+  8002bb:	89 e5                	mov    %esp,%ebp
+  8002bd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  8002c0:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  8002c4:	8b 10                	mov    (%eax),%edx
+  8002c6:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002c9:	73 0a                	jae    8002d5 <sprintputch+0x1b>
+    *b->buf++ = ch;
+  8002cb:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002ce:	89 08                	mov    %ecx,(%eax)
+  8002d0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002d3:	88 02                	mov    %al,(%edx)
+}
+  8002d5:	5d                   	pop    %ebp
+  8002d6:	c3                   	ret
+
+008002d7 <printfmt>:
+{
+  8002d7:	55                   	push   %ebp
+  8002d8:	89 e5                	mov    %esp,%ebp
+  8002da:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  8002dd:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  8002e0:	50                   	push   %eax
+  8002e1:	ff 75 10             	push   0x10(%ebp)
+  8002e4:	ff 75 0c             	push   0xc(%ebp)
+  8002e7:	ff 75 08             	push   0x8(%ebp)
+  8002ea:	e8 05 00 00 00       	call   8002f4 <vprintfmt>
+}
+  8002ef:	83 c4 10             	add    $0x10,%esp
+  8002f2:	c9                   	leave
+  8002f3:	c3                   	ret
+
+008002f4 <vprintfmt>:
+{
+  8002f4:	55                   	push   %ebp
+  8002f5:	89 e5                	mov    %esp,%ebp
+  8002f7:	57                   	push   %edi
+  8002f8:	56                   	push   %esi
+  8002f9:	53                   	push   %ebx
+  8002fa:	83 ec 2c             	sub    $0x2c,%esp
+  8002fd:	8b 75 08             	mov    0x8(%ebp),%esi
+  800300:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800303:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800306:	eb 0a                	jmp    800312 <vprintfmt+0x1e>
+      putch(ch, putdat);
+  800308:	83 ec 08             	sub    $0x8,%esp
+  80030b:	53                   	push   %ebx
+  80030c:	50                   	push   %eax
+  80030d:	ff d6                	call   *%esi
+  80030f:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  800312:	83 c7 01             	add    $0x1,%edi
+  800315:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800319:	83 f8 25             	cmp    $0x25,%eax
+  80031c:	74 0c                	je     80032a <vprintfmt+0x36>
+      if (ch == '\0')
+  80031e:	85 c0                	test   %eax,%eax
+  800320:	75 e6                	jne    800308 <vprintfmt+0x14>
+}
+  800322:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800325:	5b                   	pop    %ebx
+  800326:	5e                   	pop    %esi
+  800327:	5f                   	pop    %edi
+  800328:	5d                   	pop    %ebp
+  800329:	c3                   	ret
+    padc = ' ';
+  80032a:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  80032e:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  800335:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  80033c:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  800343:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  800348:	8d 47 01             	lea    0x1(%edi),%eax
+  80034b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80034e:	0f b6 17             	movzbl (%edi),%edx
+  800351:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800354:	3c 55                	cmp    $0x55,%al
+  800356:	0f 87 cf 03 00 00    	ja     80072b <vprintfmt+0x437>
+  80035c:	0f b6 c0             	movzbl %al,%eax
+  80035f:	ff 24 85 20 31 80 00 	jmp    *0x803120(,%eax,4)
+  800366:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  800369:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80036d:	eb d9                	jmp    800348 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  80036f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800372:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800376:	eb d0                	jmp    800348 <vprintfmt+0x54>
+  800378:	0f b6 d2             	movzbl %dl,%edx
+  80037b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  80037e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800383:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  800386:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800389:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  80038d:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  800390:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800393:	83 f9 09             	cmp    $0x9,%ecx
+  800396:	77 55                	ja     8003ed <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  800398:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  80039b:	eb e9                	jmp    800386 <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  80039d:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003a0:	8b 00                	mov    (%eax),%eax
+  8003a2:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003a5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003a8:	8d 40 04             	lea    0x4(%eax),%eax
+  8003ab:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  8003ae:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  8003b1:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003b5:	79 91                	jns    800348 <vprintfmt+0x54>
+        width = precision, precision = -1;
+  8003b7:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003ba:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003bd:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003c4:	eb 82                	jmp    800348 <vprintfmt+0x54>
+      if (width < 0)
+  8003c6:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8003c9:	85 d2                	test   %edx,%edx
+  8003cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003d0:	0f 49 c2             	cmovns %edx,%eax
+  8003d3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  8003d6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  8003d9:	e9 6a ff ff ff       	jmp    800348 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  8003de:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  8003e1:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  8003e8:	e9 5b ff ff ff       	jmp    800348 <vprintfmt+0x54>
+  8003ed:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003f0:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003f3:	eb bc                	jmp    8003b1 <vprintfmt+0xbd>
+      lflag++;
+  8003f5:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  8003f8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  8003fb:	e9 48 ff ff ff       	jmp    800348 <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  800400:	8b 45 14             	mov    0x14(%ebp),%eax
+  800403:	8d 78 04             	lea    0x4(%eax),%edi
+  800406:	83 ec 08             	sub    $0x8,%esp
+  800409:	53                   	push   %ebx
+  80040a:	ff 30                	push   (%eax)
+  80040c:	ff d6                	call   *%esi
+      break;
+  80040e:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  800411:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  800414:	e9 b1 02 00 00       	jmp    8006ca <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  800419:	8b 45 14             	mov    0x14(%ebp),%eax
+  80041c:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  80041f:	8b 10                	mov    (%eax),%edx
+  800421:	89 d0                	mov    %edx,%eax
+  800423:	f7 d8                	neg    %eax
+  800425:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800428:	83 f8 10             	cmp    $0x10,%eax
+  80042b:	7f 23                	jg     800450 <vprintfmt+0x15c>
+  80042d:	8b 14 85 80 32 80 00 	mov    0x803280(,%eax,4),%edx
+  800434:	85 d2                	test   %edx,%edx
+  800436:	74 18                	je     800450 <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  800438:	52                   	push   %edx
+  800439:	68 ca 33 80 00       	push   $0x8033ca
+  80043e:	53                   	push   %ebx
+  80043f:	56                   	push   %esi
+  800440:	e8 92 fe ff ff       	call   8002d7 <printfmt>
+  800445:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  800448:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80044b:	e9 7a 02 00 00       	jmp    8006ca <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  800450:	50                   	push   %eax
+  800451:	68 f3 2f 80 00       	push   $0x802ff3
+  800456:	53                   	push   %ebx
+  800457:	56                   	push   %esi
+  800458:	e8 7a fe ff ff       	call   8002d7 <printfmt>
+  80045d:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  800460:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  800463:	e9 62 02 00 00       	jmp    8006ca <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  800468:	8b 45 14             	mov    0x14(%ebp),%eax
+  80046b:	83 c0 04             	add    $0x4,%eax
+  80046e:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800471:	8b 45 14             	mov    0x14(%ebp),%eax
+  800474:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  800476:	85 c9                	test   %ecx,%ecx
+  800478:	b8 ec 2f 80 00       	mov    $0x802fec,%eax
+  80047d:	0f 45 c1             	cmovne %ecx,%eax
+  800480:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  800483:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800487:	7e 06                	jle    80048f <vprintfmt+0x19b>
+  800489:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80048d:	75 0b                	jne    80049a <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  80048f:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800492:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800495:	89 75 08             	mov    %esi,0x8(%ebp)
+  800498:	eb 5c                	jmp    8004f6 <vprintfmt+0x202>
+  80049a:	83 ec 08             	sub    $0x8,%esp
+  80049d:	ff 75 d0             	push   -0x30(%ebp)
+  8004a0:	ff 75 cc             	push   -0x34(%ebp)
+  8004a3:	e8 20 03 00 00       	call   8007c8 <strnlen>
+  8004a8:	89 c2                	mov    %eax,%edx
+  8004aa:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004ad:	29 d0                	sub    %edx,%eax
+  8004af:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  8004b2:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8004b6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004b9:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004bc:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8004be:	eb 0e                	jmp    8004ce <vprintfmt+0x1da>
+          putch(padc, putdat);
+  8004c0:	83 ec 08             	sub    $0x8,%esp
+  8004c3:	53                   	push   %ebx
+  8004c4:	57                   	push   %edi
+  8004c5:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8004c8:	83 ee 01             	sub    $0x1,%esi
+  8004cb:	83 c4 10             	add    $0x10,%esp
+  8004ce:	85 f6                	test   %esi,%esi
+  8004d0:	7f ee                	jg     8004c0 <vprintfmt+0x1cc>
+  8004d2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004d5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004d8:	85 c0                	test   %eax,%eax
+  8004da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004df:	0f 49 d0             	cmovns %eax,%edx
+  8004e2:	29 d0                	sub    %edx,%eax
+  8004e4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004e7:	eb a6                	jmp    80048f <vprintfmt+0x19b>
+          putch(ch, putdat);
+  8004e9:	83 ec 08             	sub    $0x8,%esp
+  8004ec:	53                   	push   %ebx
+  8004ed:	52                   	push   %edx
+  8004ee:	ff 55 08             	call   *0x8(%ebp)
+  8004f1:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8004f4:	89 f1                	mov    %esi,%ecx
+  8004f6:	8d 71 01             	lea    0x1(%ecx),%esi
+  8004f9:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004fd:	0f be d0             	movsbl %al,%edx
+  800500:	85 d2                	test   %edx,%edx
+  800502:	74 28                	je     80052c <vprintfmt+0x238>
+  800504:	85 ff                	test   %edi,%edi
+  800506:	78 05                	js     80050d <vprintfmt+0x219>
+  800508:	83 ef 01             	sub    $0x1,%edi
+  80050b:	78 30                	js     80053d <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  80050d:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800511:	74 d6                	je     8004e9 <vprintfmt+0x1f5>
+  800513:	0f be c0             	movsbl %al,%eax
+  800516:	83 e8 20             	sub    $0x20,%eax
+  800519:	83 f8 5e             	cmp    $0x5e,%eax
+  80051c:	76 cb                	jbe    8004e9 <vprintfmt+0x1f5>
+          putch('?', putdat);
+  80051e:	83 ec 08             	sub    $0x8,%esp
+  800521:	53                   	push   %ebx
+  800522:	6a 3f                	push   $0x3f
+  800524:	ff 55 08             	call   *0x8(%ebp)
+  800527:	83 c4 10             	add    $0x10,%esp
+  80052a:	eb c8                	jmp    8004f4 <vprintfmt+0x200>
+  80052c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80052f:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800532:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800535:	01 d0                	add    %edx,%eax
+  800537:	29 c8                	sub    %ecx,%eax
+  800539:	89 c7                	mov    %eax,%edi
+  80053b:	eb 13                	jmp    800550 <vprintfmt+0x25c>
+  80053d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800540:	eb ed                	jmp    80052f <vprintfmt+0x23b>
+        putch(' ', putdat);
+  800542:	83 ec 08             	sub    $0x8,%esp
+  800545:	53                   	push   %ebx
+  800546:	6a 20                	push   $0x20
+  800548:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  80054a:	83 ef 01             	sub    $0x1,%edi
+  80054d:	83 c4 10             	add    $0x10,%esp
+  800550:	85 ff                	test   %edi,%edi
+  800552:	7f ee                	jg     800542 <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  800554:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800557:	89 45 14             	mov    %eax,0x14(%ebp)
+  80055a:	e9 6b 01 00 00       	jmp    8006ca <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  80055f:	83 f9 01             	cmp    $0x1,%ecx
+  800562:	7f 1f                	jg     800583 <vprintfmt+0x28f>
+  else if (lflag)
+  800564:	85 c9                	test   %ecx,%ecx
+  800566:	74 67                	je     8005cf <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  800568:	8b 45 14             	mov    0x14(%ebp),%eax
+  80056b:	8b 00                	mov    (%eax),%eax
+  80056d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800570:	89 c1                	mov    %eax,%ecx
+  800572:	c1 f9 1f             	sar    $0x1f,%ecx
+  800575:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800578:	8b 45 14             	mov    0x14(%ebp),%eax
+  80057b:	8d 40 04             	lea    0x4(%eax),%eax
+  80057e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800581:	eb 17                	jmp    80059a <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  800583:	8b 45 14             	mov    0x14(%ebp),%eax
+  800586:	8b 50 04             	mov    0x4(%eax),%edx
+  800589:	8b 00                	mov    (%eax),%eax
+  80058b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80058e:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800591:	8b 45 14             	mov    0x14(%ebp),%eax
+  800594:	8d 40 08             	lea    0x8(%eax),%eax
+  800597:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  80059a:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80059d:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  8005a0:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  8005a5:	85 c9                	test   %ecx,%ecx
+  8005a7:	0f 89 03 01 00 00    	jns    8006b0 <vprintfmt+0x3bc>
+        putch('-', putdat);
+  8005ad:	83 ec 08             	sub    $0x8,%esp
+  8005b0:	53                   	push   %ebx
+  8005b1:	6a 2d                	push   $0x2d
+  8005b3:	ff d6                	call   *%esi
+        num = -(long long)num;
+  8005b5:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005b8:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005bb:	f7 da                	neg    %edx
+  8005bd:	83 d1 00             	adc    $0x0,%ecx
+  8005c0:	f7 d9                	neg    %ecx
+  8005c2:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  8005c5:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005ca:	e9 e1 00 00 00       	jmp    8006b0 <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  8005cf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d2:	8b 00                	mov    (%eax),%eax
+  8005d4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005d7:	89 c1                	mov    %eax,%ecx
+  8005d9:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005dc:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005df:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e2:	8d 40 04             	lea    0x4(%eax),%eax
+  8005e5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005e8:	eb b0                	jmp    80059a <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  8005ea:	83 f9 01             	cmp    $0x1,%ecx
+  8005ed:	7f 1e                	jg     80060d <vprintfmt+0x319>
+  else if (lflag)
+  8005ef:	85 c9                	test   %ecx,%ecx
+  8005f1:	74 32                	je     800625 <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  8005f3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f6:	8b 10                	mov    (%eax),%edx
+  8005f8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005fd:	8d 40 04             	lea    0x4(%eax),%eax
+  800600:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800603:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  800608:	e9 a3 00 00 00       	jmp    8006b0 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  80060d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800610:	8b 10                	mov    (%eax),%edx
+  800612:	8b 48 04             	mov    0x4(%eax),%ecx
+  800615:	8d 40 08             	lea    0x8(%eax),%eax
+  800618:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  80061b:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  800620:	e9 8b 00 00 00       	jmp    8006b0 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800625:	8b 45 14             	mov    0x14(%ebp),%eax
+  800628:	8b 10                	mov    (%eax),%edx
+  80062a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80062f:	8d 40 04             	lea    0x4(%eax),%eax
+  800632:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800635:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  80063a:	eb 74                	jmp    8006b0 <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  80063c:	83 f9 01             	cmp    $0x1,%ecx
+  80063f:	7f 1b                	jg     80065c <vprintfmt+0x368>
+  else if (lflag)
+  800641:	85 c9                	test   %ecx,%ecx
+  800643:	74 2c                	je     800671 <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  800645:	8b 45 14             	mov    0x14(%ebp),%eax
+  800648:	8b 10                	mov    (%eax),%edx
+  80064a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80064f:	8d 40 04             	lea    0x4(%eax),%eax
+  800652:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800655:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  80065a:	eb 54                	jmp    8006b0 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  80065c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80065f:	8b 10                	mov    (%eax),%edx
+  800661:	8b 48 04             	mov    0x4(%eax),%ecx
+  800664:	8d 40 08             	lea    0x8(%eax),%eax
+  800667:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  80066a:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  80066f:	eb 3f                	jmp    8006b0 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800671:	8b 45 14             	mov    0x14(%ebp),%eax
+  800674:	8b 10                	mov    (%eax),%edx
+  800676:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80067b:	8d 40 04             	lea    0x4(%eax),%eax
+  80067e:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800681:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  800686:	eb 28                	jmp    8006b0 <vprintfmt+0x3bc>
+      putch('0', putdat);
+  800688:	83 ec 08             	sub    $0x8,%esp
+  80068b:	53                   	push   %ebx
+  80068c:	6a 30                	push   $0x30
+  80068e:	ff d6                	call   *%esi
+      putch('x', putdat);
+  800690:	83 c4 08             	add    $0x8,%esp
+  800693:	53                   	push   %ebx
+  800694:	6a 78                	push   $0x78
+  800696:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  800698:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069b:	8b 10                	mov    (%eax),%edx
+  80069d:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  8006a2:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  8006a5:	8d 40 04             	lea    0x4(%eax),%eax
+  8006a8:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8006ab:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  8006b0:	83 ec 0c             	sub    $0xc,%esp
+  8006b3:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8006b7:	50                   	push   %eax
+  8006b8:	ff 75 e0             	push   -0x20(%ebp)
+  8006bb:	57                   	push   %edi
+  8006bc:	51                   	push   %ecx
+  8006bd:	52                   	push   %edx
+  8006be:	89 da                	mov    %ebx,%edx
+  8006c0:	89 f0                	mov    %esi,%eax
+  8006c2:	e8 4a fb ff ff       	call   800211 <printnum>
+      break;
+  8006c7:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  8006ca:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  8006cd:	e9 40 fc ff ff       	jmp    800312 <vprintfmt+0x1e>
+  if (lflag >= 2)
+  8006d2:	83 f9 01             	cmp    $0x1,%ecx
+  8006d5:	7f 1b                	jg     8006f2 <vprintfmt+0x3fe>
+  else if (lflag)
+  8006d7:	85 c9                	test   %ecx,%ecx
+  8006d9:	74 2c                	je     800707 <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  8006db:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006de:	8b 10                	mov    (%eax),%edx
+  8006e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006e5:	8d 40 04             	lea    0x4(%eax),%eax
+  8006e8:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8006eb:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  8006f0:	eb be                	jmp    8006b0 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  8006f2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f5:	8b 10                	mov    (%eax),%edx
+  8006f7:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006fa:	8d 40 08             	lea    0x8(%eax),%eax
+  8006fd:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800700:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  800705:	eb a9                	jmp    8006b0 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800707:	8b 45 14             	mov    0x14(%ebp),%eax
+  80070a:	8b 10                	mov    (%eax),%edx
+  80070c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800711:	8d 40 04             	lea    0x4(%eax),%eax
+  800714:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800717:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  80071c:	eb 92                	jmp    8006b0 <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  80071e:	83 ec 08             	sub    $0x8,%esp
+  800721:	53                   	push   %ebx
+  800722:	6a 25                	push   $0x25
+  800724:	ff d6                	call   *%esi
+      break;
+  800726:	83 c4 10             	add    $0x10,%esp
+  800729:	eb 9f                	jmp    8006ca <vprintfmt+0x3d6>
+      putch('%', putdat);
+  80072b:	83 ec 08             	sub    $0x8,%esp
+  80072e:	53                   	push   %ebx
+  80072f:	6a 25                	push   $0x25
+  800731:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  800733:	83 c4 10             	add    $0x10,%esp
+  800736:	89 f8                	mov    %edi,%eax
+  800738:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80073c:	74 05                	je     800743 <vprintfmt+0x44f>
+  80073e:	83 e8 01             	sub    $0x1,%eax
+  800741:	eb f5                	jmp    800738 <vprintfmt+0x444>
+  800743:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800746:	eb 82                	jmp    8006ca <vprintfmt+0x3d6>
+
+00800748 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800748:	55                   	push   %ebp
+  800749:	89 e5                	mov    %esp,%ebp
+  80074b:	83 ec 18             	sub    $0x18,%esp
+  80074e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800751:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  800754:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800757:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80075b:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80075e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  800765:	85 c0                	test   %eax,%eax
+  800767:	74 26                	je     80078f <vsnprintf+0x47>
+  800769:	85 d2                	test   %edx,%edx
+  80076b:	7e 22                	jle    80078f <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80076d:	ff 75 14             	push   0x14(%ebp)
+  800770:	ff 75 10             	push   0x10(%ebp)
+  800773:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800776:	50                   	push   %eax
+  800777:	68 ba 02 80 00       	push   $0x8002ba
+  80077c:	e8 73 fb ff ff       	call   8002f4 <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800781:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800784:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  800787:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80078a:	83 c4 10             	add    $0x10,%esp
+}
+  80078d:	c9                   	leave
+  80078e:	c3                   	ret
+    return -E_INVAL;
+  80078f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800794:	eb f7                	jmp    80078d <vsnprintf+0x45>
+
+00800796 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800796:	55                   	push   %ebp
+  800797:	89 e5                	mov    %esp,%ebp
+  800799:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  80079c:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  80079f:	50                   	push   %eax
+  8007a0:	ff 75 10             	push   0x10(%ebp)
+  8007a3:	ff 75 0c             	push   0xc(%ebp)
+  8007a6:	ff 75 08             	push   0x8(%ebp)
+  8007a9:	e8 9a ff ff ff       	call   800748 <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  8007ae:	c9                   	leave
+  8007af:	c3                   	ret
+
+008007b0 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8007b0:	55                   	push   %ebp
+  8007b1:	89 e5                	mov    %esp,%ebp
+  8007b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  8007b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007bb:	eb 03                	jmp    8007c0 <strlen+0x10>
+    n++;
+  8007bd:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  8007c0:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8007c4:	75 f7                	jne    8007bd <strlen+0xd>
+  return n;
+}
+  8007c6:	5d                   	pop    %ebp
+  8007c7:	c3                   	ret
+
+008007c8 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8007c8:	55                   	push   %ebp
+  8007c9:	89 e5                	mov    %esp,%ebp
+  8007cb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007ce:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007d6:	eb 03                	jmp    8007db <strnlen+0x13>
+    n++;
+  8007d8:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007db:	39 d0                	cmp    %edx,%eax
+  8007dd:	74 08                	je     8007e7 <strnlen+0x1f>
+  8007df:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8007e3:	75 f3                	jne    8007d8 <strnlen+0x10>
+  8007e5:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  8007e7:	89 d0                	mov    %edx,%eax
+  8007e9:	5d                   	pop    %ebp
+  8007ea:	c3                   	ret
+
+008007eb <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8007eb:	55                   	push   %ebp
+  8007ec:	89 e5                	mov    %esp,%ebp
+  8007ee:	53                   	push   %ebx
+  8007ef:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007f2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  8007f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fa:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8007fe:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800801:	83 c0 01             	add    $0x1,%eax
+  800804:	84 d2                	test   %dl,%dl
+  800806:	75 f2                	jne    8007fa <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  800808:	89 c8                	mov    %ecx,%eax
+  80080a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80080d:	c9                   	leave
+  80080e:	c3                   	ret
+
+0080080f <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80080f:	55                   	push   %ebp
+  800810:	89 e5                	mov    %esp,%ebp
+  800812:	53                   	push   %ebx
+  800813:	83 ec 10             	sub    $0x10,%esp
+  800816:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  800819:	53                   	push   %ebx
+  80081a:	e8 91 ff ff ff       	call   8007b0 <strlen>
+  80081f:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  800822:	ff 75 0c             	push   0xc(%ebp)
+  800825:	01 d8                	add    %ebx,%eax
+  800827:	50                   	push   %eax
+  800828:	e8 be ff ff ff       	call   8007eb <strcpy>
+  return dst;
+}
+  80082d:	89 d8                	mov    %ebx,%eax
+  80082f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800832:	c9                   	leave
+  800833:	c3                   	ret
+
+00800834 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  800834:	55                   	push   %ebp
+  800835:	89 e5                	mov    %esp,%ebp
+  800837:	56                   	push   %esi
+  800838:	53                   	push   %ebx
+  800839:	8b 75 08             	mov    0x8(%ebp),%esi
+  80083c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  80083f:	89 f3                	mov    %esi,%ebx
+  800841:	03 5d 10             	add    0x10(%ebp),%ebx
+  800844:	89 f0                	mov    %esi,%eax
+  800846:	eb 0f                	jmp    800857 <strncpy+0x23>
+    *dst++ = *src;
+  800848:	83 c0 01             	add    $0x1,%eax
+  80084b:	0f b6 0a             	movzbl (%edx),%ecx
+  80084e:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  800851:	80 f9 01             	cmp    $0x1,%cl
+  800854:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  800857:	39 d8                	cmp    %ebx,%eax
+  800859:	75 ed                	jne    800848 <strncpy+0x14>
+  }
+  return ret;
+}
+  80085b:	89 f0                	mov    %esi,%eax
+  80085d:	5b                   	pop    %ebx
+  80085e:	5e                   	pop    %esi
+  80085f:	5d                   	pop    %ebp
+  800860:	c3                   	ret
+
+00800861 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800861:	55                   	push   %ebp
+  800862:	89 e5                	mov    %esp,%ebp
+  800864:	56                   	push   %esi
+  800865:	53                   	push   %ebx
+  800866:	8b 75 08             	mov    0x8(%ebp),%esi
+  800869:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80086c:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  80086f:	89 f0                	mov    %esi,%eax
+  800871:	85 d2                	test   %edx,%edx
+  800873:	74 21                	je     800896 <strlcpy+0x35>
+  800875:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800879:	89 f2                	mov    %esi,%edx
+  80087b:	eb 09                	jmp    800886 <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  80087d:	83 c1 01             	add    $0x1,%ecx
+  800880:	83 c2 01             	add    $0x1,%edx
+  800883:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  800886:	39 c2                	cmp    %eax,%edx
+  800888:	74 09                	je     800893 <strlcpy+0x32>
+  80088a:	0f b6 19             	movzbl (%ecx),%ebx
+  80088d:	84 db                	test   %bl,%bl
+  80088f:	75 ec                	jne    80087d <strlcpy+0x1c>
+  800891:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  800893:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  800896:	29 f0                	sub    %esi,%eax
+}
+  800898:	5b                   	pop    %ebx
+  800899:	5e                   	pop    %esi
+  80089a:	5d                   	pop    %ebp
+  80089b:	c3                   	ret
+
+0080089c <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80089c:	55                   	push   %ebp
+  80089d:	89 e5                	mov    %esp,%ebp
+  80089f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008a2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  8008a5:	eb 06                	jmp    8008ad <strcmp+0x11>
+    p++, q++;
+  8008a7:	83 c1 01             	add    $0x1,%ecx
+  8008aa:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  8008ad:	0f b6 01             	movzbl (%ecx),%eax
+  8008b0:	84 c0                	test   %al,%al
+  8008b2:	74 04                	je     8008b8 <strcmp+0x1c>
+  8008b4:	3a 02                	cmp    (%edx),%al
+  8008b6:	74 ef                	je     8008a7 <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  8008b8:	0f b6 c0             	movzbl %al,%eax
+  8008bb:	0f b6 12             	movzbl (%edx),%edx
+  8008be:	29 d0                	sub    %edx,%eax
+}
+  8008c0:	5d                   	pop    %ebp
+  8008c1:	c3                   	ret
+
+008008c2 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8008c2:	55                   	push   %ebp
+  8008c3:	89 e5                	mov    %esp,%ebp
+  8008c5:	53                   	push   %ebx
+  8008c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008c9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008cc:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  8008cf:	eb 09                	jmp    8008da <strncmp+0x18>
+    n--, p++, q++;
+  8008d1:	83 ea 01             	sub    $0x1,%edx
+  8008d4:	83 c0 01             	add    $0x1,%eax
+  8008d7:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  8008da:	85 d2                	test   %edx,%edx
+  8008dc:	74 18                	je     8008f6 <strncmp+0x34>
+  8008de:	0f b6 18             	movzbl (%eax),%ebx
+  8008e1:	84 db                	test   %bl,%bl
+  8008e3:	74 04                	je     8008e9 <strncmp+0x27>
+  8008e5:	3a 19                	cmp    (%ecx),%bl
+  8008e7:	74 e8                	je     8008d1 <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8008e9:	0f b6 00             	movzbl (%eax),%eax
+  8008ec:	0f b6 11             	movzbl (%ecx),%edx
+  8008ef:	29 d0                	sub    %edx,%eax
+}
+  8008f1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008f4:	c9                   	leave
+  8008f5:	c3                   	ret
+    return 0;
+  8008f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008fb:	eb f4                	jmp    8008f1 <strncmp+0x2f>
+
+008008fd <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8008fd:	55                   	push   %ebp
+  8008fe:	89 e5                	mov    %esp,%ebp
+  800900:	8b 45 08             	mov    0x8(%ebp),%eax
+  800903:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800907:	eb 03                	jmp    80090c <strchr+0xf>
+  800909:	83 c0 01             	add    $0x1,%eax
+  80090c:	0f b6 10             	movzbl (%eax),%edx
+  80090f:	84 d2                	test   %dl,%dl
+  800911:	74 06                	je     800919 <strchr+0x1c>
+    if (*s == c)
+  800913:	38 ca                	cmp    %cl,%dl
+  800915:	75 f2                	jne    800909 <strchr+0xc>
+  800917:	eb 05                	jmp    80091e <strchr+0x21>
+      return (char*)s;
+  return 0;
+  800919:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80091e:	5d                   	pop    %ebp
+  80091f:	c3                   	ret
+
+00800920 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800920:	55                   	push   %ebp
+  800921:	89 e5                	mov    %esp,%ebp
+  800923:	8b 45 08             	mov    0x8(%ebp),%eax
+  800926:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  80092a:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  80092d:	38 ca                	cmp    %cl,%dl
+  80092f:	74 09                	je     80093a <strfind+0x1a>
+  800931:	84 d2                	test   %dl,%dl
+  800933:	74 05                	je     80093a <strfind+0x1a>
+  for (; *s; s++)
+  800935:	83 c0 01             	add    $0x1,%eax
+  800938:	eb f0                	jmp    80092a <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  80093a:	5d                   	pop    %ebp
+  80093b:	c3                   	ret
+
+0080093c <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  80093c:	55                   	push   %ebp
+  80093d:	89 e5                	mov    %esp,%ebp
+  80093f:	57                   	push   %edi
+  800940:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800943:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  800946:	85 c9                	test   %ecx,%ecx
+  800948:	74 20                	je     80096a <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  80094a:	89 f8                	mov    %edi,%eax
+  80094c:	09 c8                	or     %ecx,%eax
+  80094e:	a8 03                	test   $0x3,%al
+  800950:	75 12                	jne    800964 <memset+0x28>
+    c &= 0xFF;
+  800952:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800956:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  80095c:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  80095f:	fc                   	cld
+  800960:	f3 ab                	rep stos %eax,%es:(%edi)
+  800962:	eb 06                	jmp    80096a <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  800964:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800967:	fc                   	cld
+  800968:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  80096a:	89 f8                	mov    %edi,%eax
+  80096c:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  80096f:	c9                   	leave
+  800970:	c3                   	ret
+
+00800971 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800971:	55                   	push   %ebp
+  800972:	89 e5                	mov    %esp,%ebp
+  800974:	57                   	push   %edi
+  800975:	56                   	push   %esi
+  800976:	8b 45 08             	mov    0x8(%ebp),%eax
+  800979:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80097c:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  80097f:	39 c6                	cmp    %eax,%esi
+  800981:	73 32                	jae    8009b5 <memmove+0x44>
+  800983:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800986:	39 d0                	cmp    %edx,%eax
+  800988:	73 2b                	jae    8009b5 <memmove+0x44>
+    s += n;
+    d += n;
+  80098a:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80098d:	89 d6                	mov    %edx,%esi
+  80098f:	09 fe                	or     %edi,%esi
+  800991:	09 ce                	or     %ecx,%esi
+  800993:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800999:	75 0e                	jne    8009a9 <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  80099b:	83 ef 04             	sub    $0x4,%edi
+  80099e:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8009a1:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  8009a4:	fd                   	std
+  8009a5:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009a7:	eb 09                	jmp    8009b2 <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8009a9:	83 ef 01             	sub    $0x1,%edi
+  8009ac:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  8009af:	fd                   	std
+  8009b0:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  8009b2:	fc                   	cld
+  8009b3:	eb 1a                	jmp    8009cf <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009b5:	89 f2                	mov    %esi,%edx
+  8009b7:	09 c2                	or     %eax,%edx
+  8009b9:	09 ca                	or     %ecx,%edx
+  8009bb:	f6 c2 03             	test   $0x3,%dl
+  8009be:	75 0a                	jne    8009ca <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8009c0:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  8009c3:	89 c7                	mov    %eax,%edi
+  8009c5:	fc                   	cld
+  8009c6:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009c8:	eb 05                	jmp    8009cf <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  8009ca:	89 c7                	mov    %eax,%edi
+  8009cc:	fc                   	cld
+  8009cd:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  8009cf:	5e                   	pop    %esi
+  8009d0:	5f                   	pop    %edi
+  8009d1:	5d                   	pop    %ebp
+  8009d2:	c3                   	ret
+
+008009d3 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8009d3:	55                   	push   %ebp
+  8009d4:	89 e5                	mov    %esp,%ebp
+  8009d6:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  8009d9:	ff 75 10             	push   0x10(%ebp)
+  8009dc:	ff 75 0c             	push   0xc(%ebp)
+  8009df:	ff 75 08             	push   0x8(%ebp)
+  8009e2:	e8 8a ff ff ff       	call   800971 <memmove>
+}
+  8009e7:	c9                   	leave
+  8009e8:	c3                   	ret
+
+008009e9 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8009e9:	55                   	push   %ebp
+  8009ea:	89 e5                	mov    %esp,%ebp
+  8009ec:	56                   	push   %esi
+  8009ed:	53                   	push   %ebx
+  8009ee:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009f1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  8009f4:	89 c6                	mov    %eax,%esi
+  8009f6:	03 75 10             	add    0x10(%ebp),%esi
+  8009f9:	eb 06                	jmp    800a01 <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  8009fb:	83 c0 01             	add    $0x1,%eax
+  8009fe:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  800a01:	39 f0                	cmp    %esi,%eax
+  800a03:	74 14                	je     800a19 <memcmp+0x30>
+    if (*s1 != *s2)
+  800a05:	0f b6 08             	movzbl (%eax),%ecx
+  800a08:	0f b6 1a             	movzbl (%edx),%ebx
+  800a0b:	38 d9                	cmp    %bl,%cl
+  800a0d:	74 ec                	je     8009fb <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  800a0f:	0f b6 c1             	movzbl %cl,%eax
+  800a12:	0f b6 db             	movzbl %bl,%ebx
+  800a15:	29 d8                	sub    %ebx,%eax
+  800a17:	eb 05                	jmp    800a1e <memcmp+0x35>
+  }
+
+  return 0;
+  800a19:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a1e:	5b                   	pop    %ebx
+  800a1f:	5e                   	pop    %esi
+  800a20:	5d                   	pop    %ebp
+  800a21:	c3                   	ret
+
+00800a22 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a22:	55                   	push   %ebp
+  800a23:	89 e5                	mov    %esp,%ebp
+  800a25:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a28:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  800a2b:	89 c2                	mov    %eax,%edx
+  800a2d:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  800a30:	eb 03                	jmp    800a35 <memfind+0x13>
+  800a32:	83 c0 01             	add    $0x1,%eax
+  800a35:	39 d0                	cmp    %edx,%eax
+  800a37:	73 04                	jae    800a3d <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  800a39:	38 08                	cmp    %cl,(%eax)
+  800a3b:	75 f5                	jne    800a32 <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  800a3d:	5d                   	pop    %ebp
+  800a3e:	c3                   	ret
+
+00800a3f <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a3f:	55                   	push   %ebp
+  800a40:	89 e5                	mov    %esp,%ebp
+  800a42:	57                   	push   %edi
+  800a43:	56                   	push   %esi
+  800a44:	53                   	push   %ebx
+  800a45:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a48:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  800a4b:	eb 03                	jmp    800a50 <strtol+0x11>
+    s++;
+  800a4d:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  800a50:	0f b6 02             	movzbl (%edx),%eax
+  800a53:	3c 20                	cmp    $0x20,%al
+  800a55:	74 f6                	je     800a4d <strtol+0xe>
+  800a57:	3c 09                	cmp    $0x9,%al
+  800a59:	74 f2                	je     800a4d <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  800a5b:	3c 2b                	cmp    $0x2b,%al
+  800a5d:	74 2a                	je     800a89 <strtol+0x4a>
+  int neg = 0;
+  800a5f:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  800a64:	3c 2d                	cmp    $0x2d,%al
+  800a66:	74 2b                	je     800a93 <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a68:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a6e:	75 0f                	jne    800a7f <strtol+0x40>
+  800a70:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a73:	74 28                	je     800a9d <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  800a75:	85 db                	test   %ebx,%ebx
+  800a77:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a7c:	0f 44 d8             	cmove  %eax,%ebx
+  800a7f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a84:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a87:	eb 46                	jmp    800acf <strtol+0x90>
+    s++;
+  800a89:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  800a8c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a91:	eb d5                	jmp    800a68 <strtol+0x29>
+    s++, neg = 1;
+  800a93:	83 c2 01             	add    $0x1,%edx
+  800a96:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a9b:	eb cb                	jmp    800a68 <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a9d:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800aa1:	74 0e                	je     800ab1 <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  800aa3:	85 db                	test   %ebx,%ebx
+  800aa5:	75 d8                	jne    800a7f <strtol+0x40>
+    s++, base = 8;
+  800aa7:	83 c2 01             	add    $0x1,%edx
+  800aaa:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800aaf:	eb ce                	jmp    800a7f <strtol+0x40>
+    s += 2, base = 16;
+  800ab1:	83 c2 02             	add    $0x2,%edx
+  800ab4:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800ab9:	eb c4                	jmp    800a7f <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  800abb:	0f be c0             	movsbl %al,%eax
+  800abe:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  800ac1:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800ac4:	7d 3a                	jge    800b00 <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  800ac6:	83 c2 01             	add    $0x1,%edx
+  800ac9:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800acd:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  800acf:	0f b6 02             	movzbl (%edx),%eax
+  800ad2:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800ad5:	89 f3                	mov    %esi,%ebx
+  800ad7:	80 fb 09             	cmp    $0x9,%bl
+  800ada:	76 df                	jbe    800abb <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  800adc:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800adf:	89 f3                	mov    %esi,%ebx
+  800ae1:	80 fb 19             	cmp    $0x19,%bl
+  800ae4:	77 08                	ja     800aee <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  800ae6:	0f be c0             	movsbl %al,%eax
+  800ae9:	83 e8 57             	sub    $0x57,%eax
+  800aec:	eb d3                	jmp    800ac1 <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  800aee:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800af1:	89 f3                	mov    %esi,%ebx
+  800af3:	80 fb 19             	cmp    $0x19,%bl
+  800af6:	77 08                	ja     800b00 <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  800af8:	0f be c0             	movsbl %al,%eax
+  800afb:	83 e8 37             	sub    $0x37,%eax
+  800afe:	eb c1                	jmp    800ac1 <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  800b00:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b04:	74 05                	je     800b0b <strtol+0xcc>
+    *endptr = (char*)s;
+  800b06:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b09:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  800b0b:	89 c8                	mov    %ecx,%eax
+  800b0d:	f7 d8                	neg    %eax
+  800b0f:	85 ff                	test   %edi,%edi
+  800b11:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b14:	89 c8                	mov    %ecx,%eax
+  800b16:	5b                   	pop    %ebx
+  800b17:	5e                   	pop    %esi
+  800b18:	5f                   	pop    %edi
+  800b19:	5d                   	pop    %ebp
+  800b1a:	c3                   	ret
+
+00800b1b <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800b1b:	55                   	push   %ebp
+  800b1c:	89 e5                	mov    %esp,%ebp
+  800b1e:	57                   	push   %edi
+  800b1f:	56                   	push   %esi
+  800b20:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800b21:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b26:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b29:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b2c:	89 c3                	mov    %eax,%ebx
+  800b2e:	89 c7                	mov    %eax,%edi
+  800b30:	89 c6                	mov    %eax,%esi
+  800b32:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800b34:	5b                   	pop    %ebx
+  800b35:	5e                   	pop    %esi
+  800b36:	5f                   	pop    %edi
+  800b37:	5d                   	pop    %ebp
+  800b38:	c3                   	ret
+
+00800b39 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800b39:	55                   	push   %ebp
+  800b3a:	89 e5                	mov    %esp,%ebp
+  800b3c:	57                   	push   %edi
+  800b3d:	56                   	push   %esi
+  800b3e:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800b3f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b44:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b49:	89 d1                	mov    %edx,%ecx
+  800b4b:	89 d3                	mov    %edx,%ebx
+  800b4d:	89 d7                	mov    %edx,%edi
+  800b4f:	89 d6                	mov    %edx,%esi
+  800b51:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800b53:	5b                   	pop    %ebx
+  800b54:	5e                   	pop    %esi
+  800b55:	5f                   	pop    %edi
+  800b56:	5d                   	pop    %ebp
+  800b57:	c3                   	ret
+
+00800b58 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800b58:	55                   	push   %ebp
+  800b59:	89 e5                	mov    %esp,%ebp
+  800b5b:	57                   	push   %edi
+  800b5c:	56                   	push   %esi
+  800b5d:	53                   	push   %ebx
+  800b5e:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800b61:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b66:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b69:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b6e:	89 cb                	mov    %ecx,%ebx
+  800b70:	89 cf                	mov    %ecx,%edi
+  800b72:	89 ce                	mov    %ecx,%esi
+  800b74:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800b76:	85 c0                	test   %eax,%eax
+  800b78:	7f 08                	jg     800b82 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800b7a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b7d:	5b                   	pop    %ebx
+  800b7e:	5e                   	pop    %esi
+  800b7f:	5f                   	pop    %edi
+  800b80:	5d                   	pop    %ebp
+  800b81:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800b82:	83 ec 0c             	sub    $0xc,%esp
+  800b85:	50                   	push   %eax
+  800b86:	6a 03                	push   $0x3
+  800b88:	68 e3 32 80 00       	push   $0x8032e3
+  800b8d:	6a 23                	push   $0x23
+  800b8f:	68 00 33 80 00       	push   $0x803300
+  800b94:	e8 89 f5 ff ff       	call   800122 <_panic>
+
+00800b99 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800b99:	55                   	push   %ebp
+  800b9a:	89 e5                	mov    %esp,%ebp
+  800b9c:	57                   	push   %edi
+  800b9d:	56                   	push   %esi
+  800b9e:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800b9f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ba4:	b8 02 00 00 00       	mov    $0x2,%eax
+  800ba9:	89 d1                	mov    %edx,%ecx
+  800bab:	89 d3                	mov    %edx,%ebx
+  800bad:	89 d7                	mov    %edx,%edi
+  800baf:	89 d6                	mov    %edx,%esi
+  800bb1:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800bb3:	5b                   	pop    %ebx
+  800bb4:	5e                   	pop    %esi
+  800bb5:	5f                   	pop    %edi
+  800bb6:	5d                   	pop    %ebp
+  800bb7:	c3                   	ret
+
+00800bb8 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800bb8:	55                   	push   %ebp
+  800bb9:	89 e5                	mov    %esp,%ebp
+  800bbb:	57                   	push   %edi
+  800bbc:	56                   	push   %esi
+  800bbd:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800bbe:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bc3:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800bc8:	89 d1                	mov    %edx,%ecx
+  800bca:	89 d3                	mov    %edx,%ebx
+  800bcc:	89 d7                	mov    %edx,%edi
+  800bce:	89 d6                	mov    %edx,%esi
+  800bd0:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800bd2:	5b                   	pop    %ebx
+  800bd3:	5e                   	pop    %esi
+  800bd4:	5f                   	pop    %edi
+  800bd5:	5d                   	pop    %ebp
+  800bd6:	c3                   	ret
+
+00800bd7 <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  800bd7:	55                   	push   %ebp
+  800bd8:	89 e5                	mov    %esp,%ebp
+  800bda:	57                   	push   %edi
+  800bdb:	56                   	push   %esi
+  800bdc:	53                   	push   %ebx
+  800bdd:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  800be0:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  800be4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800be9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bec:	b8 14 00 00 00       	mov    $0x14,%eax
+  800bf1:	89 df                	mov    %ebx,%edi
+  800bf3:	89 de                	mov    %ebx,%esi
+  800bf5:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800bf7:	85 c0                	test   %eax,%eax
+  800bf9:	7f 08                	jg     800c03 <sys_env_set_cow+0x2c>
+}
+  800bfb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bfe:	5b                   	pop    %ebx
+  800bff:	5e                   	pop    %esi
+  800c00:	5f                   	pop    %edi
+  800c01:	5d                   	pop    %ebp
+  800c02:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c03:	83 ec 0c             	sub    $0xc,%esp
+  800c06:	50                   	push   %eax
+  800c07:	6a 14                	push   $0x14
+  800c09:	68 e3 32 80 00       	push   $0x8032e3
+  800c0e:	6a 23                	push   $0x23
+  800c10:	68 00 33 80 00       	push   $0x803300
+  800c15:	e8 08 f5 ff ff       	call   800122 <_panic>
+
+00800c1a <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800c1a:	55                   	push   %ebp
+  800c1b:	89 e5                	mov    %esp,%ebp
+  800c1d:	57                   	push   %edi
+  800c1e:	56                   	push   %esi
+  800c1f:	53                   	push   %ebx
+  800c20:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800c23:	be 00 00 00 00       	mov    $0x0,%esi
+  800c28:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c2b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c2e:	b8 04 00 00 00       	mov    $0x4,%eax
+  800c33:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c36:	89 f7                	mov    %esi,%edi
+  800c38:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c3a:	85 c0                	test   %eax,%eax
+  800c3c:	7f 08                	jg     800c46 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  800c3e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c41:	5b                   	pop    %ebx
+  800c42:	5e                   	pop    %esi
+  800c43:	5f                   	pop    %edi
+  800c44:	5d                   	pop    %ebp
+  800c45:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c46:	83 ec 0c             	sub    $0xc,%esp
+  800c49:	50                   	push   %eax
+  800c4a:	6a 04                	push   $0x4
+  800c4c:	68 e3 32 80 00       	push   $0x8032e3
+  800c51:	6a 23                	push   $0x23
+  800c53:	68 00 33 80 00       	push   $0x803300
+  800c58:	e8 c5 f4 ff ff       	call   800122 <_panic>
+
+00800c5d <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800c5d:	55                   	push   %ebp
+  800c5e:	89 e5                	mov    %esp,%ebp
+  800c60:	57                   	push   %edi
+  800c61:	56                   	push   %esi
+  800c62:	53                   	push   %ebx
+  800c63:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800c66:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c69:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c6c:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c71:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c74:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c77:	8b 75 18             	mov    0x18(%ebp),%esi
+  800c7a:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c7c:	85 c0                	test   %eax,%eax
+  800c7e:	7f 08                	jg     800c88 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  800c80:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c83:	5b                   	pop    %ebx
+  800c84:	5e                   	pop    %esi
+  800c85:	5f                   	pop    %edi
+  800c86:	5d                   	pop    %ebp
+  800c87:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c88:	83 ec 0c             	sub    $0xc,%esp
+  800c8b:	50                   	push   %eax
+  800c8c:	6a 05                	push   $0x5
+  800c8e:	68 e3 32 80 00       	push   $0x8032e3
+  800c93:	6a 23                	push   $0x23
+  800c95:	68 00 33 80 00       	push   $0x803300
+  800c9a:	e8 83 f4 ff ff       	call   800122 <_panic>
+
+00800c9f <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800c9f:	55                   	push   %ebp
+  800ca0:	89 e5                	mov    %esp,%ebp
+  800ca2:	57                   	push   %edi
+  800ca3:	56                   	push   %esi
+  800ca4:	53                   	push   %ebx
+  800ca5:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800ca8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cad:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cb0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cb3:	b8 06 00 00 00       	mov    $0x6,%eax
+  800cb8:	89 df                	mov    %ebx,%edi
+  800cba:	89 de                	mov    %ebx,%esi
+  800cbc:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800cbe:	85 c0                	test   %eax,%eax
+  800cc0:	7f 08                	jg     800cca <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  800cc2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cc5:	5b                   	pop    %ebx
+  800cc6:	5e                   	pop    %esi
+  800cc7:	5f                   	pop    %edi
+  800cc8:	5d                   	pop    %ebp
+  800cc9:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800cca:	83 ec 0c             	sub    $0xc,%esp
+  800ccd:	50                   	push   %eax
+  800cce:	6a 06                	push   $0x6
+  800cd0:	68 e3 32 80 00       	push   $0x8032e3
+  800cd5:	6a 23                	push   $0x23
+  800cd7:	68 00 33 80 00       	push   $0x803300
+  800cdc:	e8 41 f4 ff ff       	call   800122 <_panic>
+
+00800ce1 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  800ce1:	55                   	push   %ebp
+  800ce2:	89 e5                	mov    %esp,%ebp
+  800ce4:	57                   	push   %edi
+  800ce5:	56                   	push   %esi
+  800ce6:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800ce7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ced:	b8 11 00 00 00       	mov    $0x11,%eax
+  800cf2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cf5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800cf8:	8b 75 18             	mov    0x18(%ebp),%esi
+  800cfb:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  800cfd:	5b                   	pop    %ebx
+  800cfe:	5e                   	pop    %esi
+  800cff:	5f                   	pop    %edi
+  800d00:	5d                   	pop    %ebp
+  800d01:	c3                   	ret
+
+00800d02 <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  800d02:	55                   	push   %ebp
+  800d03:	89 e5                	mov    %esp,%ebp
+  800d05:	57                   	push   %edi
+  800d06:	56                   	push   %esi
+  800d07:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d08:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d0b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d0e:	b8 12 00 00 00       	mov    $0x12,%eax
+  800d13:	be 00 00 00 00       	mov    $0x0,%esi
+  800d18:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d1b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d1e:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  800d20:	5b                   	pop    %ebx
+  800d21:	5e                   	pop    %esi
+  800d22:	5f                   	pop    %edi
+  800d23:	5d                   	pop    %ebp
+  800d24:	c3                   	ret
+
+00800d25 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  800d25:	55                   	push   %ebp
+  800d26:	89 e5                	mov    %esp,%ebp
+  800d28:	57                   	push   %edi
+  800d29:	56                   	push   %esi
+  800d2a:	53                   	push   %ebx
+  800d2b:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800d2e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d33:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d36:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d39:	b8 16 00 00 00       	mov    $0x16,%eax
+  800d3e:	89 df                	mov    %ebx,%edi
+  800d40:	89 de                	mov    %ebx,%esi
+  800d42:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d44:	85 c0                	test   %eax,%eax
+  800d46:	7f 08                	jg     800d50 <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  800d48:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d4b:	5b                   	pop    %ebx
+  800d4c:	5e                   	pop    %esi
+  800d4d:	5f                   	pop    %edi
+  800d4e:	5d                   	pop    %ebp
+  800d4f:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d50:	83 ec 0c             	sub    $0xc,%esp
+  800d53:	50                   	push   %eax
+  800d54:	6a 16                	push   $0x16
+  800d56:	68 e3 32 80 00       	push   $0x8032e3
+  800d5b:	6a 23                	push   $0x23
+  800d5d:	68 00 33 80 00       	push   $0x803300
+  800d62:	e8 bb f3 ff ff       	call   800122 <_panic>
+
+00800d67 <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  800d67:	55                   	push   %ebp
+  800d68:	89 e5                	mov    %esp,%ebp
+  800d6a:	57                   	push   %edi
+  800d6b:	56                   	push   %esi
+  800d6c:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d6d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d72:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d75:	b8 17 00 00 00       	mov    $0x17,%eax
+  800d7a:	89 cb                	mov    %ecx,%ebx
+  800d7c:	89 cf                	mov    %ecx,%edi
+  800d7e:	89 ce                	mov    %ecx,%esi
+  800d80:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  800d82:	5b                   	pop    %ebx
+  800d83:	5e                   	pop    %esi
+  800d84:	5f                   	pop    %edi
+  800d85:	5d                   	pop    %ebp
+  800d86:	c3                   	ret
+
+00800d87 <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  800d87:	55                   	push   %ebp
+  800d88:	89 e5                	mov    %esp,%ebp
+  800d8a:	57                   	push   %edi
+  800d8b:	56                   	push   %esi
+  800d8c:	53                   	push   %ebx
+  800d8d:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800d90:	be 00 00 00 00       	mov    $0x0,%esi
+  800d95:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d98:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d9b:	b8 18 00 00 00       	mov    $0x18,%eax
+  800da0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800da3:	89 f7                	mov    %esi,%edi
+  800da5:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800da7:	85 c0                	test   %eax,%eax
+  800da9:	7f 08                	jg     800db3 <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  800dab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dae:	5b                   	pop    %ebx
+  800daf:	5e                   	pop    %esi
+  800db0:	5f                   	pop    %edi
+  800db1:	5d                   	pop    %ebp
+  800db2:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800db3:	83 ec 0c             	sub    $0xc,%esp
+  800db6:	50                   	push   %eax
+  800db7:	6a 18                	push   $0x18
+  800db9:	68 e3 32 80 00       	push   $0x8032e3
+  800dbe:	6a 23                	push   $0x23
+  800dc0:	68 00 33 80 00       	push   $0x803300
+  800dc5:	e8 58 f3 ff ff       	call   800122 <_panic>
+
+00800dca <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  800dca:	55                   	push   %ebp
+  800dcb:	89 e5                	mov    %esp,%ebp
+  800dcd:	57                   	push   %edi
+  800dce:	56                   	push   %esi
+  800dcf:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800dd0:	be 00 00 00 00       	mov    $0x0,%esi
+  800dd5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dd8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ddb:	b8 19 00 00 00       	mov    $0x19,%eax
+  800de0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800de3:	89 f7                	mov    %esi,%edi
+  800de5:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  800de7:	5b                   	pop    %ebx
+  800de8:	5e                   	pop    %esi
+  800de9:	5f                   	pop    %edi
+  800dea:	5d                   	pop    %ebp
+  800deb:	c3                   	ret
+
+00800dec <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  800dec:	55                   	push   %ebp
+  800ded:	89 e5                	mov    %esp,%ebp
+  800def:	57                   	push   %edi
+  800df0:	56                   	push   %esi
+  800df1:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800df2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800df7:	b8 15 00 00 00       	mov    $0x15,%eax
+  800dfc:	89 d1                	mov    %edx,%ecx
+  800dfe:	89 d3                	mov    %edx,%ebx
+  800e00:	89 d7                	mov    %edx,%edi
+  800e02:	89 d6                	mov    %edx,%esi
+  800e04:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800e06:	5b                   	pop    %ebx
+  800e07:	5e                   	pop    %esi
+  800e08:	5f                   	pop    %edi
+  800e09:	5d                   	pop    %ebp
+  800e0a:	c3                   	ret
+
+00800e0b <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800e0b:	55                   	push   %ebp
+  800e0c:	89 e5                	mov    %esp,%ebp
+  800e0e:	57                   	push   %edi
+  800e0f:	56                   	push   %esi
+  800e10:	53                   	push   %ebx
+  800e11:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e14:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e19:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e1c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e1f:	b8 08 00 00 00       	mov    $0x8,%eax
+  800e24:	89 df                	mov    %ebx,%edi
+  800e26:	89 de                	mov    %ebx,%esi
+  800e28:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e2a:	85 c0                	test   %eax,%eax
+  800e2c:	7f 08                	jg     800e36 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800e2e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e31:	5b                   	pop    %ebx
+  800e32:	5e                   	pop    %esi
+  800e33:	5f                   	pop    %edi
+  800e34:	5d                   	pop    %ebp
+  800e35:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e36:	83 ec 0c             	sub    $0xc,%esp
+  800e39:	50                   	push   %eax
+  800e3a:	6a 08                	push   $0x8
+  800e3c:	68 e3 32 80 00       	push   $0x8032e3
+  800e41:	6a 23                	push   $0x23
+  800e43:	68 00 33 80 00       	push   $0x803300
+  800e48:	e8 d5 f2 ff ff       	call   800122 <_panic>
+
+00800e4d <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800e4d:	55                   	push   %ebp
+  800e4e:	89 e5                	mov    %esp,%ebp
+  800e50:	57                   	push   %edi
+  800e51:	56                   	push   %esi
+  800e52:	53                   	push   %ebx
+  800e53:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e56:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e5b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e5e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e61:	b8 09 00 00 00       	mov    $0x9,%eax
+  800e66:	89 df                	mov    %ebx,%edi
+  800e68:	89 de                	mov    %ebx,%esi
+  800e6a:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e6c:	85 c0                	test   %eax,%eax
+  800e6e:	7f 08                	jg     800e78 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  800e70:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e73:	5b                   	pop    %ebx
+  800e74:	5e                   	pop    %esi
+  800e75:	5f                   	pop    %edi
+  800e76:	5d                   	pop    %ebp
+  800e77:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e78:	83 ec 0c             	sub    $0xc,%esp
+  800e7b:	50                   	push   %eax
+  800e7c:	6a 09                	push   $0x9
+  800e7e:	68 e3 32 80 00       	push   $0x8032e3
+  800e83:	6a 23                	push   $0x23
+  800e85:	68 00 33 80 00       	push   $0x803300
+  800e8a:	e8 93 f2 ff ff       	call   800122 <_panic>
+
+00800e8f <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800e8f:	55                   	push   %ebp
+  800e90:	89 e5                	mov    %esp,%ebp
+  800e92:	57                   	push   %edi
+  800e93:	56                   	push   %esi
+  800e94:	53                   	push   %ebx
+  800e95:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e98:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e9d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ea0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ea3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ea8:	89 df                	mov    %ebx,%edi
+  800eaa:	89 de                	mov    %ebx,%esi
+  800eac:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800eae:	85 c0                	test   %eax,%eax
+  800eb0:	7f 08                	jg     800eba <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  800eb2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eb5:	5b                   	pop    %ebx
+  800eb6:	5e                   	pop    %esi
+  800eb7:	5f                   	pop    %edi
+  800eb8:	5d                   	pop    %ebp
+  800eb9:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800eba:	83 ec 0c             	sub    $0xc,%esp
+  800ebd:	50                   	push   %eax
+  800ebe:	6a 0a                	push   $0xa
+  800ec0:	68 e3 32 80 00       	push   $0x8032e3
+  800ec5:	6a 23                	push   $0x23
+  800ec7:	68 00 33 80 00       	push   $0x803300
+  800ecc:	e8 51 f2 ff ff       	call   800122 <_panic>
+
+00800ed1 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  800ed1:	55                   	push   %ebp
+  800ed2:	89 e5                	mov    %esp,%ebp
+  800ed4:	57                   	push   %edi
+  800ed5:	56                   	push   %esi
+  800ed6:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800ed7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eda:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800edd:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800ee2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ee5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ee8:	8b 75 18             	mov    0x18(%ebp),%esi
+  800eeb:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  800eed:	5b                   	pop    %ebx
+  800eee:	5e                   	pop    %esi
+  800eef:	5f                   	pop    %edi
+  800ef0:	5d                   	pop    %ebp
+  800ef1:	c3                   	ret
+
+00800ef2 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  800ef2:	55                   	push   %ebp
+  800ef3:	89 e5                	mov    %esp,%ebp
+  800ef5:	57                   	push   %edi
+  800ef6:	56                   	push   %esi
+  800ef7:	53                   	push   %ebx
+  800ef8:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800efb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f00:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f03:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f06:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f0b:	89 df                	mov    %ebx,%edi
+  800f0d:	89 de                	mov    %ebx,%esi
+  800f0f:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f11:	85 c0                	test   %eax,%eax
+  800f13:	7f 08                	jg     800f1d <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  800f15:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f18:	5b                   	pop    %ebx
+  800f19:	5e                   	pop    %esi
+  800f1a:	5f                   	pop    %edi
+  800f1b:	5d                   	pop    %ebp
+  800f1c:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f1d:	83 ec 0c             	sub    $0xc,%esp
+  800f20:	50                   	push   %eax
+  800f21:	6a 0d                	push   $0xd
+  800f23:	68 e3 32 80 00       	push   $0x8032e3
+  800f28:	6a 23                	push   $0x23
+  800f2a:	68 00 33 80 00       	push   $0x803300
+  800f2f:	e8 ee f1 ff ff       	call   800122 <_panic>
+
+00800f34 <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  800f34:	55                   	push   %ebp
+  800f35:	89 e5                	mov    %esp,%ebp
+  800f37:	57                   	push   %edi
+  800f38:	56                   	push   %esi
+  800f39:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f3a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f3f:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800f44:	89 d1                	mov    %edx,%ecx
+  800f46:	89 d3                	mov    %edx,%ebx
+  800f48:	89 d7                	mov    %edx,%edi
+  800f4a:	89 d6                	mov    %edx,%esi
+  800f4c:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800f4e:	5b                   	pop    %ebx
+  800f4f:	5e                   	pop    %esi
+  800f50:	5f                   	pop    %edi
+  800f51:	5d                   	pop    %ebp
+  800f52:	c3                   	ret
+
+00800f53 <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  800f53:	55                   	push   %ebp
+  800f54:	89 e5                	mov    %esp,%ebp
+  800f56:	57                   	push   %edi
+  800f57:	56                   	push   %esi
+  800f58:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f59:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f5c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f5f:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f64:	be 00 00 00 00       	mov    $0x0,%esi
+  800f69:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f6c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f6f:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  800f71:	5b                   	pop    %ebx
+  800f72:	5e                   	pop    %esi
+  800f73:	5f                   	pop    %edi
+  800f74:	5d                   	pop    %ebp
+  800f75:	c3                   	ret
+
+00800f76 <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  800f76:	55                   	push   %ebp
+  800f77:	89 e5                	mov    %esp,%ebp
+  800f79:	57                   	push   %edi
+  800f7a:	56                   	push   %esi
+  800f7b:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f7c:	be 00 00 00 00       	mov    $0x0,%esi
+  800f81:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f84:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f87:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f8c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f8f:	89 f7                	mov    %esi,%edi
+  800f91:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  800f93:	5b                   	pop    %ebx
+  800f94:	5e                   	pop    %esi
+  800f95:	5f                   	pop    %edi
+  800f96:	5d                   	pop    %ebp
+  800f97:	c3                   	ret
+
+00800f98 <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  800f98:	55                   	push   %ebp
+  800f99:	89 e5                	mov    %esp,%ebp
+  800f9b:	57                   	push   %edi
+  800f9c:	56                   	push   %esi
+  800f9d:	53                   	push   %ebx
+  800f9e:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  800fa1:	80 3d 48 57 80 00 00 	cmpb   $0x0,0x805748
+  800fa8:	74 41                	je     800feb <sys_batch+0x53>
+  800faa:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fad:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  800fb0:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  800fb7:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800fba:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  800fbd:	7d 45                	jge    801004 <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  800fbf:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800fc2:	8b 06                	mov    (%esi),%eax
+  800fc4:	8b 56 04             	mov    0x4(%esi),%edx
+  800fc7:	8b 4e 08             	mov    0x8(%esi),%ecx
+  800fca:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  800fcd:	8b 7e 10             	mov    0x10(%esi),%edi
+  800fd0:	8b 76 14             	mov    0x14(%esi),%esi
+  800fd3:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  800fd5:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800fd8:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  800fdb:	83 c6 1c             	add    $0x1c,%esi
+  800fde:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  800fe1:	85 c0                	test   %eax,%eax
+  800fe3:	78 1f                	js     801004 <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  800fe5:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  800fe9:	eb cc                	jmp    800fb7 <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  800feb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ff0:	b8 13 00 00 00       	mov    $0x13,%eax
+  800ff5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ff8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ffb:	89 df                	mov    %ebx,%edi
+  800ffd:	89 de                	mov    %ebx,%esi
+  800fff:	cd 30                	int    $0x30
+  801001:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  801004:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801007:	83 c4 08             	add    $0x8,%esp
+  80100a:	5b                   	pop    %ebx
+  80100b:	5e                   	pop    %esi
+  80100c:	5f                   	pop    %edi
+  80100d:	5d                   	pop    %ebp
+  80100e:	c3                   	ret
+
+0080100f <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  80100f:	55                   	push   %ebp
+  801010:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  801012:	8b 45 08             	mov    0x8(%ebp),%eax
+  801015:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  80101b:	5d                   	pop    %ebp
+  80101c:	c3                   	ret
+
+0080101d <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  80101d:	55                   	push   %ebp
+  80101e:	89 e5                	mov    %esp,%ebp
+  801020:	56                   	push   %esi
+  801021:	53                   	push   %ebx
+  801022:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  801025:	8b 1e                	mov    (%esi),%ebx
+  801027:	85 db                	test   %ebx,%ebx
+  801029:	75 09                	jne    801034 <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  80102b:	89 d8                	mov    %ebx,%eax
+  80102d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801030:	5b                   	pop    %ebx
+  801031:	5e                   	pop    %esi
+  801032:	5d                   	pop    %ebp
+  801033:	c3                   	ret
+  b->sb_n = 0;
+  801034:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  80103a:	53                   	push   %ebx
+  80103b:	8d 46 04             	lea    0x4(%esi),%eax
+  80103e:	50                   	push   %eax
+  80103f:	e8 54 ff ff ff       	call   800f98 <sys_batch>
+  801044:	83 c4 08             	add    $0x8,%esp
+  801047:	85 c0                	test   %eax,%eax
+  801049:	78 1e                	js     801069 <sysbatch_flush+0x4c>
+  if (r < n)
+  80104b:	39 c3                	cmp    %eax,%ebx
+  80104d:	7f 07                	jg     801056 <sysbatch_flush+0x39>
+  return 0;
+  80104f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801054:	eb d5                	jmp    80102b <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  801056:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801059:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  80105d:	85 db                	test   %ebx,%ebx
+  80105f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801064:	0f 49 d8             	cmovns %eax,%ebx
+  801067:	eb c2                	jmp    80102b <sysbatch_flush+0xe>
+    return r;
+  801069:	89 c3                	mov    %eax,%ebx
+  80106b:	eb be                	jmp    80102b <sysbatch_flush+0xe>
+
+0080106d <sysbatch_add>:
+{
+  80106d:	55                   	push   %ebp
+  80106e:	89 e5                	mov    %esp,%ebp
+  801070:	53                   	push   %ebx
+  801071:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  801074:	83 3b 40             	cmpl   $0x40,(%ebx)
+  801077:	74 41                	je     8010ba <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  801079:	8b 03                	mov    (%ebx),%eax
+  80107b:	8d 50 01             	lea    0x1(%eax),%edx
+  80107e:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  801080:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801083:	01 d8                	add    %ebx,%eax
+  801085:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801088:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  80108b:	8b 55 10             	mov    0x10(%ebp),%edx
+  80108e:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  801091:	8b 55 14             	mov    0x14(%ebp),%edx
+  801094:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  801097:	8b 55 18             	mov    0x18(%ebp),%edx
+  80109a:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  80109d:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  8010a0:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  8010a3:	8b 55 20             	mov    0x20(%ebp),%edx
+  8010a6:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  8010a9:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  8010b0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8010b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8010b8:	c9                   	leave
+  8010b9:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  8010ba:	53                   	push   %ebx
+  8010bb:	e8 5d ff ff ff       	call   80101d <sysbatch_flush>
+  8010c0:	83 c4 04             	add    $0x4,%esp
+  8010c3:	85 c0                	test   %eax,%eax
+  8010c5:	79 b2                	jns    801079 <sysbatch_add+0xc>
+  8010c7:	eb ec                	jmp    8010b5 <sysbatch_add+0x48>
+
+008010c9 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8010c9:	55                   	push   %ebp
+  8010ca:	89 e5                	mov    %esp,%ebp
+  8010cc:	53                   	push   %ebx
+  8010cd:	83 ec 04             	sub    $0x4,%esp
+  int r;
+
+  if (_pgfault_handler == 0) {
+  8010d0:	83 3d 4c 57 80 00 00 	cmpl   $0x0,0x80574c
+  8010d7:	74 0d                	je     8010e6 <set_pgfault_handler+0x1d>
+
+    sys_env_set_pgfault_upcall(id, _pgfault_upcall);
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  8010d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010dc:	a3 4c 57 80 00       	mov    %eax,0x80574c
+}
+  8010e1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8010e4:	c9                   	leave
+  8010e5:	c3                   	ret
+    envid_t id = sys_getenvid();
+  8010e6:	e8 ae fa ff ff       	call   800b99 <sys_getenvid>
+  8010eb:	89 c3                	mov    %eax,%ebx
+    sys_page_alloc(id, (void *) (UXSTACKTOP - PGSIZE), (PTE_P | PTE_U | PTE_W));
+  8010ed:	83 ec 04             	sub    $0x4,%esp
+  8010f0:	6a 07                	push   $0x7
+  8010f2:	68 00 f0 bf ee       	push   $0xeebff000
+  8010f7:	50                   	push   %eax
+  8010f8:	e8 1d fb ff ff       	call   800c1a <sys_page_alloc>
+    sys_env_set_pgfault_upcall(id, _pgfault_upcall);
+  8010fd:	83 c4 08             	add    $0x8,%esp
+  801100:	68 10 11 80 00       	push   $0x801110
+  801105:	53                   	push   %ebx
+  801106:	e8 84 fd ff ff       	call   800e8f <sys_env_set_pgfault_upcall>
+  80110b:	83 c4 10             	add    $0x10,%esp
+  80110e:	eb c9                	jmp    8010d9 <set_pgfault_handler+0x10>
+
+00801110 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  801110:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  801111:	a1 4c 57 80 00       	mov    0x80574c,%eax
+	call *%eax
+  801116:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  801118:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+  movl 48(%esp), %eax       // move trap time esp to eax
+  80111b:	8b 44 24 30          	mov    0x30(%esp),%eax
+  subl $4, %eax             // make room for eip on trap time esp
+  80111f:	83 e8 04             	sub    $0x4,%eax
+  movl %eax, 48(%esp)       // move value to esp
+  801122:	89 44 24 30          	mov    %eax,0x30(%esp)
+  movl 40(%esp), %ebx       // move trap time eip to ebx
+  801126:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+  movl %ebx, 0(%eax)
+  80112a:	89 18                	mov    %ebx,(%eax)
+
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+  addl $0x08,%esp
+  80112c:	83 c4 08             	add    $0x8,%esp
+  popal
+  80112f:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+  addl $4, %esp          // skip tf->eip
+  801130:	83 c4 04             	add    $0x4,%esp
+  popf                 // pop stack value into flags register
+  801133:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+  popl %esp
+  801134:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+  ret
+  801135:	c3                   	ret
+
+00801136 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801136:	55                   	push   %ebp
+  801137:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801139:	8b 45 08             	mov    0x8(%ebp),%eax
+  80113c:	05 00 00 00 30       	add    $0x30000000,%eax
+  801141:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801144:	5d                   	pop    %ebp
+  801145:	c3                   	ret
+
+00801146 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801146:	55                   	push   %ebp
+  801147:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801149:	8b 45 08             	mov    0x8(%ebp),%eax
+  80114c:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  80114f:	66 b8 00 00          	mov    $0x0,%ax
+  801153:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801158:	5d                   	pop    %ebp
+  801159:	c3                   	ret
+
+0080115a <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80115a:	55                   	push   %ebp
+  80115b:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  80115d:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801162:	eb 02                	jmp    801166 <fd_alloc+0xc>
+  801164:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801166:	89 c2                	mov    %eax,%edx
+  801168:	c1 ea 16             	shr    $0x16,%edx
+  80116b:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801172:	f6 c2 01             	test   $0x1,%dl
+  801175:	74 2b                	je     8011a2 <fd_alloc+0x48>
+  801177:	89 c2                	mov    %eax,%edx
+  801179:	c1 ea 0c             	shr    $0xc,%edx
+  80117c:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801183:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801189:	f6 c1 01             	test   $0x1,%cl
+  80118c:	74 14                	je     8011a2 <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  80118e:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801194:	75 ce                	jne    801164 <fd_alloc+0xa>
+  801196:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  80119b:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8011a0:	eb 05                	jmp    8011a7 <fd_alloc+0x4d>
+      return 0;
+  8011a2:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  8011a7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011aa:	89 02                	mov    %eax,(%edx)
+}
+  8011ac:	89 c8                	mov    %ecx,%eax
+  8011ae:	5d                   	pop    %ebp
+  8011af:	c3                   	ret
+
+008011b0 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8011b0:	55                   	push   %ebp
+  8011b1:	89 e5                	mov    %esp,%ebp
+  8011b3:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  8011b6:	83 f8 1f             	cmp    $0x1f,%eax
+  8011b9:	77 30                	ja     8011eb <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  8011bb:	c1 e0 0c             	shl    $0xc,%eax
+  8011be:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8011c3:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8011c9:	f6 c2 01             	test   $0x1,%dl
+  8011cc:	74 24                	je     8011f2 <fd_lookup+0x42>
+  8011ce:	89 c2                	mov    %eax,%edx
+  8011d0:	c1 ea 0c             	shr    $0xc,%edx
+  8011d3:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8011da:	f6 c2 01             	test   $0x1,%dl
+  8011dd:	74 1a                	je     8011f9 <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  8011df:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8011e2:	89 02                	mov    %eax,(%edx)
+  return 0;
+  8011e4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011e9:	5d                   	pop    %ebp
+  8011ea:	c3                   	ret
+    return -E_INVAL;
+  8011eb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011f0:	eb f7                	jmp    8011e9 <fd_lookup+0x39>
+    return -E_INVAL;
+  8011f2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011f7:	eb f0                	jmp    8011e9 <fd_lookup+0x39>
+  8011f9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011fe:	eb e9                	jmp    8011e9 <fd_lookup+0x39>
+
+00801200 <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801200:	55                   	push   %ebp
+  801201:	89 e5                	mov    %esp,%ebp
+  801203:	53                   	push   %ebx
+  801204:	83 ec 04             	sub    $0x4,%esp
+  801207:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  80120a:	b8 8c 33 80 00       	mov    $0x80338c,%eax
+  80120f:	8b 18                	mov    (%eax),%ebx
+  801211:	85 db                	test   %ebx,%ebx
+  801213:	74 0e                	je     801223 <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  801215:	83 c0 04             	add    $0x4,%eax
+  801218:	39 13                	cmp    %edx,(%ebx)
+  80121a:	75 f3                	jne    80120f <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  80121c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801221:	eb 1f                	jmp    801242 <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801223:	a1 44 57 80 00       	mov    0x805744,%eax
+  801228:	8b 40 48             	mov    0x48(%eax),%eax
+  80122b:	83 ec 04             	sub    $0x4,%esp
+  80122e:	52                   	push   %edx
+  80122f:	50                   	push   %eax
+  801230:	68 10 33 80 00       	push   $0x803310
+  801235:	e8 c3 ef ff ff       	call   8001fd <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  80123a:	83 c4 10             	add    $0x10,%esp
+  80123d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  801242:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801245:	89 1a                	mov    %ebx,(%edx)
+}
+  801247:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80124a:	c9                   	leave
+  80124b:	c3                   	ret
+
+0080124c <fd_close>:
+{
+  80124c:	55                   	push   %ebp
+  80124d:	89 e5                	mov    %esp,%ebp
+  80124f:	57                   	push   %edi
+  801250:	56                   	push   %esi
+  801251:	53                   	push   %ebx
+  801252:	83 ec 24             	sub    $0x24,%esp
+  801255:	8b 75 08             	mov    0x8(%ebp),%esi
+  801258:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80125b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80125e:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80125f:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801265:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801268:	50                   	push   %eax
+  801269:	e8 42 ff ff ff       	call   8011b0 <fd_lookup>
+  80126e:	89 c3                	mov    %eax,%ebx
+  801270:	83 c4 10             	add    $0x10,%esp
+  801273:	85 c0                	test   %eax,%eax
+  801275:	78 05                	js     80127c <fd_close+0x30>
+      || fd != fd2)
+  801277:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80127a:	74 16                	je     801292 <fd_close+0x46>
+    return must_exist ? r : 0;
+  80127c:	89 f8                	mov    %edi,%eax
+  80127e:	84 c0                	test   %al,%al
+  801280:	b8 00 00 00 00       	mov    $0x0,%eax
+  801285:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801288:	89 d8                	mov    %ebx,%eax
+  80128a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80128d:	5b                   	pop    %ebx
+  80128e:	5e                   	pop    %esi
+  80128f:	5f                   	pop    %edi
+  801290:	5d                   	pop    %ebp
+  801291:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801292:	83 ec 08             	sub    $0x8,%esp
+  801295:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801298:	50                   	push   %eax
+  801299:	ff 36                	push   (%esi)
+  80129b:	e8 60 ff ff ff       	call   801200 <dev_lookup>
+  8012a0:	89 c3                	mov    %eax,%ebx
+  8012a2:	83 c4 10             	add    $0x10,%esp
+  8012a5:	85 c0                	test   %eax,%eax
+  8012a7:	78 1a                	js     8012c3 <fd_close+0x77>
+    if (dev->dev_close)
+  8012a9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8012ac:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  8012af:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  8012b4:	85 c0                	test   %eax,%eax
+  8012b6:	74 0b                	je     8012c3 <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  8012b8:	83 ec 0c             	sub    $0xc,%esp
+  8012bb:	56                   	push   %esi
+  8012bc:	ff d0                	call   *%eax
+  8012be:	89 c3                	mov    %eax,%ebx
+  8012c0:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  8012c3:	83 ec 08             	sub    $0x8,%esp
+  8012c6:	56                   	push   %esi
+  8012c7:	6a 00                	push   $0x0
+  8012c9:	e8 d1 f9 ff ff       	call   800c9f <sys_page_unmap>
+  return r;
+  8012ce:	83 c4 10             	add    $0x10,%esp
+  8012d1:	eb b5                	jmp    801288 <fd_close+0x3c>
+
+008012d3 <close>:
+
+int
+close(int fdnum)
+{
+  8012d3:	55                   	push   %ebp
+  8012d4:	89 e5                	mov    %esp,%ebp
+  8012d6:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8012d9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8012dc:	50                   	push   %eax
+  8012dd:	ff 75 08             	push   0x8(%ebp)
+  8012e0:	e8 cb fe ff ff       	call   8011b0 <fd_lookup>
+  8012e5:	83 c4 10             	add    $0x10,%esp
+  8012e8:	85 c0                	test   %eax,%eax
+  8012ea:	79 02                	jns    8012ee <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  8012ec:	c9                   	leave
+  8012ed:	c3                   	ret
+    return fd_close(fd, 1);
+  8012ee:	83 ec 08             	sub    $0x8,%esp
+  8012f1:	6a 01                	push   $0x1
+  8012f3:	ff 75 f4             	push   -0xc(%ebp)
+  8012f6:	e8 51 ff ff ff       	call   80124c <fd_close>
+  8012fb:	83 c4 10             	add    $0x10,%esp
+  8012fe:	eb ec                	jmp    8012ec <close+0x19>
+
+00801300 <close_all>:
+
+void
+close_all(void)
+{
+  801300:	55                   	push   %ebp
+  801301:	89 e5                	mov    %esp,%ebp
+  801303:	53                   	push   %ebx
+  801304:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  801307:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  80130c:	83 ec 0c             	sub    $0xc,%esp
+  80130f:	53                   	push   %ebx
+  801310:	e8 be ff ff ff       	call   8012d3 <close>
+  for (i = 0; i < MAXFD; i++)
+  801315:	83 c3 01             	add    $0x1,%ebx
+  801318:	83 c4 10             	add    $0x10,%esp
+  80131b:	83 fb 20             	cmp    $0x20,%ebx
+  80131e:	75 ec                	jne    80130c <close_all+0xc>
+}
+  801320:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801323:	c9                   	leave
+  801324:	c3                   	ret
+
+00801325 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801325:	55                   	push   %ebp
+  801326:	89 e5                	mov    %esp,%ebp
+  801328:	57                   	push   %edi
+  801329:	56                   	push   %esi
+  80132a:	53                   	push   %ebx
+  80132b:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80132e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801331:	50                   	push   %eax
+  801332:	ff 75 08             	push   0x8(%ebp)
+  801335:	e8 76 fe ff ff       	call   8011b0 <fd_lookup>
+  80133a:	89 c6                	mov    %eax,%esi
+  80133c:	83 c4 10             	add    $0x10,%esp
+  80133f:	85 c0                	test   %eax,%eax
+  801341:	0f 88 0a 01 00 00    	js     801451 <dup+0x12c>
+    return r;
+  close(newfdnum);
+  801347:	83 ec 0c             	sub    $0xc,%esp
+  80134a:	ff 75 0c             	push   0xc(%ebp)
+  80134d:	e8 81 ff ff ff       	call   8012d3 <close>
+
+  newfd = INDEX2FD(newfdnum);
+  801352:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801355:	c1 e0 0c             	shl    $0xc,%eax
+  801358:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  80135e:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  801361:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801364:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  801367:	89 04 24             	mov    %eax,(%esp)
+  80136a:	e8 d7 fd ff ff       	call   801146 <fd2data>
+  80136f:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  801371:	89 3c 24             	mov    %edi,(%esp)
+  801374:	e8 cd fd ff ff       	call   801146 <fd2data>
+  801379:	83 c4 10             	add    $0x10,%esp
+  80137c:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80137f:	89 f3                	mov    %esi,%ebx
+  801381:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  801387:	89 c6                	mov    %eax,%esi
+  801389:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80138c:	89 cf                	mov    %ecx,%edi
+  80138e:	eb 0c                	jmp    80139c <dup+0x77>
+  801390:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801396:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80139c:	39 fb                	cmp    %edi,%ebx
+  80139e:	74 7b                	je     80141b <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  8013a0:	89 d8                	mov    %ebx,%eax
+  8013a2:	c1 e8 16             	shr    $0x16,%eax
+  8013a5:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8013ac:	a8 01                	test   $0x1,%al
+  8013ae:	74 e0                	je     801390 <dup+0x6b>
+  8013b0:	89 d8                	mov    %ebx,%eax
+  8013b2:	c1 e8 0c             	shr    $0xc,%eax
+  8013b5:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8013bc:	f6 c2 01             	test   $0x1,%dl
+  8013bf:	74 cf                	je     801390 <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  8013c1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  8013c8:	83 ec 0c             	sub    $0xc,%esp
+  8013cb:	25 07 0e 00 00       	and    $0xe07,%eax
+  8013d0:	50                   	push   %eax
+  8013d1:	56                   	push   %esi
+  8013d2:	6a 00                	push   $0x0
+  8013d4:	53                   	push   %ebx
+  8013d5:	6a 00                	push   $0x0
+  8013d7:	e8 81 f8 ff ff       	call   800c5d <sys_page_map>
+  8013dc:	83 c4 20             	add    $0x20,%esp
+  8013df:	85 c0                	test   %eax,%eax
+  8013e1:	79 ad                	jns    801390 <dup+0x6b>
+  8013e3:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8013e6:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  8013e8:	83 ec 08             	sub    $0x8,%esp
+  8013eb:	ff 75 d4             	push   -0x2c(%ebp)
+  8013ee:	6a 00                	push   $0x0
+  8013f0:	e8 aa f8 ff ff       	call   800c9f <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8013f5:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  8013f8:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  8013fe:	83 c4 10             	add    $0x10,%esp
+  801401:	39 df                	cmp    %ebx,%edi
+  801403:	74 4c                	je     801451 <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  801405:	83 ec 08             	sub    $0x8,%esp
+  801408:	57                   	push   %edi
+  801409:	6a 00                	push   $0x0
+  80140b:	e8 8f f8 ff ff       	call   800c9f <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801410:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  801416:	83 c4 10             	add    $0x10,%esp
+  801419:	eb e6                	jmp    801401 <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80141b:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80141e:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  801421:	89 c8                	mov    %ecx,%eax
+  801423:	c1 e8 0c             	shr    $0xc,%eax
+  801426:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80142d:	83 ec 0c             	sub    $0xc,%esp
+  801430:	25 07 0e 00 00       	and    $0xe07,%eax
+  801435:	50                   	push   %eax
+  801436:	ff 75 d4             	push   -0x2c(%ebp)
+  801439:	6a 00                	push   $0x0
+  80143b:	51                   	push   %ecx
+  80143c:	6a 00                	push   $0x0
+  80143e:	e8 1a f8 ff ff       	call   800c5d <sys_page_map>
+  801443:	89 c6                	mov    %eax,%esi
+  801445:	83 c4 20             	add    $0x20,%esp
+  801448:	85 c0                	test   %eax,%eax
+  80144a:	78 9c                	js     8013e8 <dup+0xc3>
+  return newfdnum;
+  80144c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80144f:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  801451:	89 f0                	mov    %esi,%eax
+  801453:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801456:	5b                   	pop    %ebx
+  801457:	5e                   	pop    %esi
+  801458:	5f                   	pop    %edi
+  801459:	5d                   	pop    %ebp
+  80145a:	c3                   	ret
+
+0080145b <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80145b:	55                   	push   %ebp
+  80145c:	89 e5                	mov    %esp,%ebp
+  80145e:	56                   	push   %esi
+  80145f:	53                   	push   %ebx
+  801460:	83 ec 18             	sub    $0x18,%esp
+  801463:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801466:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801469:	50                   	push   %eax
+  80146a:	56                   	push   %esi
+  80146b:	e8 40 fd ff ff       	call   8011b0 <fd_lookup>
+  801470:	83 c4 10             	add    $0x10,%esp
+  801473:	85 c0                	test   %eax,%eax
+  801475:	78 3c                	js     8014b3 <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801477:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80147a:	83 ec 08             	sub    $0x8,%esp
+  80147d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801480:	50                   	push   %eax
+  801481:	ff 33                	push   (%ebx)
+  801483:	e8 78 fd ff ff       	call   801200 <dev_lookup>
+  801488:	83 c4 10             	add    $0x10,%esp
+  80148b:	85 c0                	test   %eax,%eax
+  80148d:	78 24                	js     8014b3 <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80148f:	8b 43 08             	mov    0x8(%ebx),%eax
+  801492:	83 e0 03             	and    $0x3,%eax
+  801495:	83 f8 01             	cmp    $0x1,%eax
+  801498:	74 20                	je     8014ba <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  80149a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80149d:	8b 40 08             	mov    0x8(%eax),%eax
+  8014a0:	85 c0                	test   %eax,%eax
+  8014a2:	74 37                	je     8014db <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  8014a4:	83 ec 04             	sub    $0x4,%esp
+  8014a7:	ff 75 10             	push   0x10(%ebp)
+  8014aa:	ff 75 0c             	push   0xc(%ebp)
+  8014ad:	53                   	push   %ebx
+  8014ae:	ff d0                	call   *%eax
+  8014b0:	83 c4 10             	add    $0x10,%esp
+}
+  8014b3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014b6:	5b                   	pop    %ebx
+  8014b7:	5e                   	pop    %esi
+  8014b8:	5d                   	pop    %ebp
+  8014b9:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8014ba:	a1 44 57 80 00       	mov    0x805744,%eax
+  8014bf:	8b 40 48             	mov    0x48(%eax),%eax
+  8014c2:	83 ec 04             	sub    $0x4,%esp
+  8014c5:	56                   	push   %esi
+  8014c6:	50                   	push   %eax
+  8014c7:	68 51 33 80 00       	push   $0x803351
+  8014cc:	e8 2c ed ff ff       	call   8001fd <cprintf>
+    return -E_INVAL;
+  8014d1:	83 c4 10             	add    $0x10,%esp
+  8014d4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014d9:	eb d8                	jmp    8014b3 <read+0x58>
+    return -E_NOT_SUPP;
+  8014db:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8014e0:	eb d1                	jmp    8014b3 <read+0x58>
+
+008014e2 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8014e2:	55                   	push   %ebp
+  8014e3:	89 e5                	mov    %esp,%ebp
+  8014e5:	57                   	push   %edi
+  8014e6:	56                   	push   %esi
+  8014e7:	53                   	push   %ebx
+  8014e8:	83 ec 0c             	sub    $0xc,%esp
+  8014eb:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8014ee:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  8014f1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014f6:	eb 02                	jmp    8014fa <readn+0x18>
+  8014f8:	01 c3                	add    %eax,%ebx
+  8014fa:	39 f3                	cmp    %esi,%ebx
+  8014fc:	73 21                	jae    80151f <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  8014fe:	83 ec 04             	sub    $0x4,%esp
+  801501:	89 f0                	mov    %esi,%eax
+  801503:	29 d8                	sub    %ebx,%eax
+  801505:	50                   	push   %eax
+  801506:	89 d8                	mov    %ebx,%eax
+  801508:	03 45 0c             	add    0xc(%ebp),%eax
+  80150b:	50                   	push   %eax
+  80150c:	57                   	push   %edi
+  80150d:	e8 49 ff ff ff       	call   80145b <read>
+    if (m < 0)
+  801512:	83 c4 10             	add    $0x10,%esp
+  801515:	85 c0                	test   %eax,%eax
+  801517:	78 04                	js     80151d <readn+0x3b>
+      return m;
+    if (m == 0)
+  801519:	75 dd                	jne    8014f8 <readn+0x16>
+  80151b:	eb 02                	jmp    80151f <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  80151d:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  80151f:	89 d8                	mov    %ebx,%eax
+  801521:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801524:	5b                   	pop    %ebx
+  801525:	5e                   	pop    %esi
+  801526:	5f                   	pop    %edi
+  801527:	5d                   	pop    %ebp
+  801528:	c3                   	ret
+
+00801529 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801529:	55                   	push   %ebp
+  80152a:	89 e5                	mov    %esp,%ebp
+  80152c:	56                   	push   %esi
+  80152d:	53                   	push   %ebx
+  80152e:	83 ec 18             	sub    $0x18,%esp
+  801531:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801534:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801537:	50                   	push   %eax
+  801538:	53                   	push   %ebx
+  801539:	e8 72 fc ff ff       	call   8011b0 <fd_lookup>
+  80153e:	83 c4 10             	add    $0x10,%esp
+  801541:	85 c0                	test   %eax,%eax
+  801543:	78 37                	js     80157c <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801545:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801548:	83 ec 08             	sub    $0x8,%esp
+  80154b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80154e:	50                   	push   %eax
+  80154f:	ff 36                	push   (%esi)
+  801551:	e8 aa fc ff ff       	call   801200 <dev_lookup>
+  801556:	83 c4 10             	add    $0x10,%esp
+  801559:	85 c0                	test   %eax,%eax
+  80155b:	78 1f                	js     80157c <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80155d:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801561:	74 20                	je     801583 <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  801563:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801566:	8b 40 0c             	mov    0xc(%eax),%eax
+  801569:	85 c0                	test   %eax,%eax
+  80156b:	74 37                	je     8015a4 <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  80156d:	83 ec 04             	sub    $0x4,%esp
+  801570:	ff 75 10             	push   0x10(%ebp)
+  801573:	ff 75 0c             	push   0xc(%ebp)
+  801576:	56                   	push   %esi
+  801577:	ff d0                	call   *%eax
+  801579:	83 c4 10             	add    $0x10,%esp
+}
+  80157c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80157f:	5b                   	pop    %ebx
+  801580:	5e                   	pop    %esi
+  801581:	5d                   	pop    %ebp
+  801582:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801583:	a1 44 57 80 00       	mov    0x805744,%eax
+  801588:	8b 40 48             	mov    0x48(%eax),%eax
+  80158b:	83 ec 04             	sub    $0x4,%esp
+  80158e:	53                   	push   %ebx
+  80158f:	50                   	push   %eax
+  801590:	68 6d 33 80 00       	push   $0x80336d
+  801595:	e8 63 ec ff ff       	call   8001fd <cprintf>
+    return -E_INVAL;
+  80159a:	83 c4 10             	add    $0x10,%esp
+  80159d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015a2:	eb d8                	jmp    80157c <write+0x53>
+    return -E_NOT_SUPP;
+  8015a4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015a9:	eb d1                	jmp    80157c <write+0x53>
+
+008015ab <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8015ab:	55                   	push   %ebp
+  8015ac:	89 e5                	mov    %esp,%ebp
+  8015ae:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8015b1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015b4:	50                   	push   %eax
+  8015b5:	ff 75 08             	push   0x8(%ebp)
+  8015b8:	e8 f3 fb ff ff       	call   8011b0 <fd_lookup>
+  8015bd:	83 c4 10             	add    $0x10,%esp
+  8015c0:	85 c0                	test   %eax,%eax
+  8015c2:	78 0e                	js     8015d2 <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  8015c4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8015c7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015ca:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  8015cd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015d2:	c9                   	leave
+  8015d3:	c3                   	ret
+
+008015d4 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8015d4:	55                   	push   %ebp
+  8015d5:	89 e5                	mov    %esp,%ebp
+  8015d7:	56                   	push   %esi
+  8015d8:	53                   	push   %ebx
+  8015d9:	83 ec 18             	sub    $0x18,%esp
+  8015dc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  8015df:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8015e2:	50                   	push   %eax
+  8015e3:	53                   	push   %ebx
+  8015e4:	e8 c7 fb ff ff       	call   8011b0 <fd_lookup>
+  8015e9:	83 c4 10             	add    $0x10,%esp
+  8015ec:	85 c0                	test   %eax,%eax
+  8015ee:	78 34                	js     801624 <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8015f0:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8015f3:	83 ec 08             	sub    $0x8,%esp
+  8015f6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015f9:	50                   	push   %eax
+  8015fa:	ff 36                	push   (%esi)
+  8015fc:	e8 ff fb ff ff       	call   801200 <dev_lookup>
+  801601:	83 c4 10             	add    $0x10,%esp
+  801604:	85 c0                	test   %eax,%eax
+  801606:	78 1c                	js     801624 <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801608:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80160c:	74 1d                	je     80162b <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  80160e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801611:	8b 40 18             	mov    0x18(%eax),%eax
+  801614:	85 c0                	test   %eax,%eax
+  801616:	74 34                	je     80164c <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  801618:	83 ec 08             	sub    $0x8,%esp
+  80161b:	ff 75 0c             	push   0xc(%ebp)
+  80161e:	56                   	push   %esi
+  80161f:	ff d0                	call   *%eax
+  801621:	83 c4 10             	add    $0x10,%esp
+}
+  801624:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801627:	5b                   	pop    %ebx
+  801628:	5e                   	pop    %esi
+  801629:	5d                   	pop    %ebp
+  80162a:	c3                   	ret
+            thisenv->env_id, fdnum);
+  80162b:	a1 44 57 80 00       	mov    0x805744,%eax
+  801630:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801633:	83 ec 04             	sub    $0x4,%esp
+  801636:	53                   	push   %ebx
+  801637:	50                   	push   %eax
+  801638:	68 30 33 80 00       	push   $0x803330
+  80163d:	e8 bb eb ff ff       	call   8001fd <cprintf>
+    return -E_INVAL;
+  801642:	83 c4 10             	add    $0x10,%esp
+  801645:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80164a:	eb d8                	jmp    801624 <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  80164c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801651:	eb d1                	jmp    801624 <ftruncate+0x50>
+
+00801653 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801653:	55                   	push   %ebp
+  801654:	89 e5                	mov    %esp,%ebp
+  801656:	56                   	push   %esi
+  801657:	53                   	push   %ebx
+  801658:	83 ec 18             	sub    $0x18,%esp
+  80165b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  80165e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801661:	50                   	push   %eax
+  801662:	ff 75 08             	push   0x8(%ebp)
+  801665:	e8 46 fb ff ff       	call   8011b0 <fd_lookup>
+  80166a:	83 c4 10             	add    $0x10,%esp
+  80166d:	85 c0                	test   %eax,%eax
+  80166f:	78 49                	js     8016ba <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801671:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801674:	83 ec 08             	sub    $0x8,%esp
+  801677:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80167a:	50                   	push   %eax
+  80167b:	ff 36                	push   (%esi)
+  80167d:	e8 7e fb ff ff       	call   801200 <dev_lookup>
+  801682:	83 c4 10             	add    $0x10,%esp
+  801685:	85 c0                	test   %eax,%eax
+  801687:	78 31                	js     8016ba <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  801689:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80168c:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801690:	74 2f                	je     8016c1 <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  801692:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  801695:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80169c:	00 00 00 
+  stat->st_isdir = 0;
+  80169f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8016a6:	00 00 00 
+  stat->st_dev = dev;
+  8016a9:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  8016af:	83 ec 08             	sub    $0x8,%esp
+  8016b2:	53                   	push   %ebx
+  8016b3:	56                   	push   %esi
+  8016b4:	ff 50 14             	call   *0x14(%eax)
+  8016b7:	83 c4 10             	add    $0x10,%esp
+}
+  8016ba:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016bd:	5b                   	pop    %ebx
+  8016be:	5e                   	pop    %esi
+  8016bf:	5d                   	pop    %ebp
+  8016c0:	c3                   	ret
+    return -E_NOT_SUPP;
+  8016c1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016c6:	eb f2                	jmp    8016ba <fstat+0x67>
+
+008016c8 <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  8016c8:	55                   	push   %ebp
+  8016c9:	89 e5                	mov    %esp,%ebp
+  8016cb:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  8016ce:	ff 75 0c             	push   0xc(%ebp)
+  8016d1:	ff 75 08             	push   0x8(%ebp)
+  8016d4:	e8 58 07 00 00       	call   801e31 <file_stat>
+}
+  8016d9:	c9                   	leave
+  8016da:	c3                   	ret
+
+008016db <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  8016db:	55                   	push   %ebp
+  8016dc:	89 e5                	mov    %esp,%ebp
+  8016de:	57                   	push   %edi
+  8016df:	56                   	push   %esi
+  8016e0:	53                   	push   %ebx
+  8016e1:	83 ec 1c             	sub    $0x1c,%esp
+  8016e4:	89 c7                	mov    %eax,%edi
+  8016e6:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8016e9:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8016ec:	e9 a2 00 00 00       	jmp    801793 <fsipc_send+0xb8>
+  nfsenvs = 0;
+  8016f1:	c7 05 00 50 80 00 00 	movl   $0x0,0x805000
+  8016f8:	00 00 00 
+  8016fb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801700:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801705:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  80170a:	be 01 00 00 00       	mov    $0x1,%esi
+  80170f:	eb 0f                	jmp    801720 <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801711:	83 c0 01             	add    $0x1,%eax
+  801714:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801719:	74 49                	je     801764 <fsipc_send+0x89>
+  80171b:	83 f9 07             	cmp    $0x7,%ecx
+  80171e:	7f 50                	jg     801770 <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  801720:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801723:	c1 e2 04             	shl    $0x4,%edx
+  801726:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80172c:	8b 52 50             	mov    0x50(%edx),%edx
+  80172f:	83 fa 01             	cmp    $0x1,%edx
+  801732:	75 dd                	jne    801711 <fsipc_send+0x36>
+  801734:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801737:	c1 e2 04             	shl    $0x4,%edx
+  80173a:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801740:	8b 52 54             	mov    0x54(%edx),%edx
+  801743:	85 d2                	test   %edx,%edx
+  801745:	74 ca                	je     801711 <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801747:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  80174a:	c1 e2 04             	shl    $0x4,%edx
+  80174d:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801753:	8b 52 48             	mov    0x48(%edx),%edx
+  801756:	89 14 8d 20 50 80 00 	mov    %edx,0x805020(,%ecx,4)
+  80175d:	8d 49 01             	lea    0x1(%ecx),%ecx
+  801760:	89 f3                	mov    %esi,%ebx
+  801762:	eb ad                	jmp    801711 <fsipc_send+0x36>
+  801764:	84 db                	test   %bl,%bl
+  801766:	74 38                	je     8017a0 <fsipc_send+0xc5>
+  801768:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  80176e:	eb 30                	jmp    8017a0 <fsipc_send+0xc5>
+  801770:	84 db                	test   %bl,%bl
+  801772:	74 2c                	je     8017a0 <fsipc_send+0xc5>
+  801774:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  80177a:	eb 24                	jmp    8017a0 <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  80177c:	50                   	push   %eax
+  80177d:	68 9c 33 80 00       	push   $0x80339c
+  801782:	6a 34                	push   $0x34
+  801784:	68 a6 33 80 00       	push   $0x8033a6
+  801789:	e8 94 e9 ff ff       	call   800122 <_panic>
+    }
+    sys_yield();
+  80178e:	e8 25 f4 ff ff       	call   800bb8 <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  801793:	83 3d 00 50 80 00 03 	cmpl   $0x3,0x805000
+  80179a:	0f 8e 51 ff ff ff    	jle    8016f1 <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  8017a0:	a1 44 57 80 00       	mov    0x805744,%eax
+  8017a5:	8b 70 48             	mov    0x48(%eax),%esi
+  8017a8:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  8017ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017b3:	8b 0d 00 50 80 00    	mov    0x805000,%ecx
+  8017b9:	39 d9                	cmp    %ebx,%ecx
+  8017bb:	7e d1                	jle    80178e <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  8017bd:	83 ec 0c             	sub    $0xc,%esp
+  8017c0:	ff 75 e0             	push   -0x20(%ebp)
+  8017c3:	6a 07                	push   $0x7
+  8017c5:	ff 75 e4             	push   -0x1c(%ebp)
+  8017c8:	57                   	push   %edi
+  8017c9:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  8017cc:	99                   	cltd
+  8017cd:	f7 f9                	idiv   %ecx
+  8017cf:	ff 34 95 20 50 80 00 	push   0x805020(,%edx,4)
+  8017d6:	e8 f6 f6 ff ff       	call   800ed1 <sys_ipc_try_send>
+      if (r == 0)
+  8017db:	83 c4 20             	add    $0x20,%esp
+  8017de:	85 c0                	test   %eax,%eax
+  8017e0:	74 0a                	je     8017ec <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  8017e2:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8017e5:	75 95                	jne    80177c <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  8017e7:	83 c3 01             	add    $0x1,%ebx
+  8017ea:	eb c7                	jmp    8017b3 <fsipc_send+0xd8>
+  }
+}
+  8017ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017ef:	5b                   	pop    %ebx
+  8017f0:	5e                   	pop    %esi
+  8017f1:	5f                   	pop    %edi
+  8017f2:	5d                   	pop    %ebp
+  8017f3:	c3                   	ret
+
+008017f4 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8017f4:	55                   	push   %ebp
+  8017f5:	89 e5                	mov    %esp,%ebp
+  8017f7:	53                   	push   %ebx
+  8017f8:	83 ec 14             	sub    $0x14,%esp
+  8017fb:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  8017fd:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  801804:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801809:	ba 00 60 80 00       	mov    $0x806000,%edx
+  80180e:	e8 c8 fe ff ff       	call   8016db <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801813:	6a 00                	push   $0x0
+  801815:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801818:	50                   	push   %eax
+  801819:	53                   	push   %ebx
+  80181a:	6a 00                	push   $0x0
+  80181c:	e8 26 13 00 00       	call   802b47 <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  801821:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801824:	c9                   	leave
+  801825:	c3                   	ret
+
+00801826 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801826:	55                   	push   %ebp
+  801827:	89 e5                	mov    %esp,%ebp
+  801829:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80182c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80182f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801832:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.set_size.req_size = newsize;
+  801837:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80183a:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  80183f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801844:	b8 02 00 00 00       	mov    $0x2,%eax
+  801849:	e8 a6 ff ff ff       	call   8017f4 <fsipc>
+}
+  80184e:	c9                   	leave
+  80184f:	c3                   	ret
+
+00801850 <devfile_flush>:
+{
+  801850:	55                   	push   %ebp
+  801851:	89 e5                	mov    %esp,%ebp
+  801853:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801856:	8b 45 08             	mov    0x8(%ebp),%eax
+  801859:	8b 40 0c             	mov    0xc(%eax),%eax
+  80185c:	a3 00 60 80 00       	mov    %eax,0x806000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801861:	ba 00 00 00 00       	mov    $0x0,%edx
+  801866:	b8 06 00 00 00       	mov    $0x6,%eax
+  80186b:	e8 84 ff ff ff       	call   8017f4 <fsipc>
+}
+  801870:	c9                   	leave
+  801871:	c3                   	ret
+
+00801872 <devfile_stat>:
+{
+  801872:	55                   	push   %ebp
+  801873:	89 e5                	mov    %esp,%ebp
+  801875:	53                   	push   %ebx
+  801876:	83 ec 04             	sub    $0x4,%esp
+  801879:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80187c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80187f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801882:	a3 00 60 80 00       	mov    %eax,0x806000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801887:	ba 00 00 00 00       	mov    $0x0,%edx
+  80188c:	b8 05 00 00 00       	mov    $0x5,%eax
+  801891:	e8 5e ff ff ff       	call   8017f4 <fsipc>
+  801896:	85 c0                	test   %eax,%eax
+  801898:	78 2c                	js     8018c6 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80189a:	83 ec 08             	sub    $0x8,%esp
+  80189d:	68 00 60 80 00       	push   $0x806000
+  8018a2:	53                   	push   %ebx
+  8018a3:	e8 43 ef ff ff       	call   8007eb <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  8018a8:	a1 80 60 80 00       	mov    0x806080,%eax
+  8018ad:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8018b3:	a1 84 60 80 00       	mov    0x806084,%eax
+  8018b8:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  8018be:	83 c4 10             	add    $0x10,%esp
+  8018c1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018c6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018c9:	c9                   	leave
+  8018ca:	c3                   	ret
+
+008018cb <fsv_alloc>:
+{
+  8018cb:	55                   	push   %ebp
+  8018cc:	89 e5                	mov    %esp,%ebp
+  8018ce:	56                   	push   %esi
+  8018cf:	53                   	push   %ebx
+  8018d0:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  8018d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018d7:	eb 22                	jmp    8018fb <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  8018d9:	83 ec 04             	sub    $0x4,%esp
+  8018dc:	6a 00                	push   $0x0
+  8018de:	6a 00                	push   $0x0
+  8018e0:	6a 07                	push   $0x7
+  8018e2:	50                   	push   %eax
+  8018e3:	6a 00                	push   $0x0
+  8018e5:	6a 04                	push   $0x4
+  8018e7:	68 40 50 80 00       	push   $0x805040
+  8018ec:	e8 7c f7 ff ff       	call   80106d <sysbatch_add>
+  8018f1:	83 c4 20             	add    $0x20,%esp
+  8018f4:	85 c0                	test   %eax,%eax
+  8018f6:	78 48                	js     801940 <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  8018f8:	83 c3 01             	add    $0x1,%ebx
+  8018fb:	39 f3                	cmp    %esi,%ebx
+  8018fd:	74 31                	je     801930 <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  8018ff:	89 d8                	mov    %ebx,%eax
+  801901:	c1 e0 0c             	shl    $0xc,%eax
+  801904:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801909:	89 c2                	mov    %eax,%edx
+  80190b:	c1 ea 16             	shr    $0x16,%edx
+  80190e:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801915:	f6 c2 01             	test   $0x1,%dl
+  801918:	74 bf                	je     8018d9 <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  80191a:	89 c2                	mov    %eax,%edx
+  80191c:	c1 ea 0c             	shr    $0xc,%edx
+  80191f:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801926:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801929:	83 fa 03             	cmp    $0x3,%edx
+  80192c:	75 ab                	jne    8018d9 <fsv_alloc+0xe>
+  80192e:	eb c8                	jmp    8018f8 <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  801930:	83 ec 0c             	sub    $0xc,%esp
+  801933:	68 40 50 80 00       	push   $0x805040
+  801938:	e8 e0 f6 ff ff       	call   80101d <sysbatch_flush>
+  80193d:	83 c4 10             	add    $0x10,%esp
+}
+  801940:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801943:	5b                   	pop    %ebx
+  801944:	5e                   	pop    %esi
+  801945:	5d                   	pop    %ebp
+  801946:	c3                   	ret
+
+00801947 <devfile_read>:
+{
+  801947:	55                   	push   %ebp
+  801948:	89 e5                	mov    %esp,%ebp
+  80194a:	57                   	push   %edi
+  80194b:	56                   	push   %esi
+  80194c:	53                   	push   %ebx
+  80194d:	83 ec 3c             	sub    $0x3c,%esp
+  801950:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  801953:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  801959:	77 57                	ja     8019b2 <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80195b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80195e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801961:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read.req_n = n;
+  801966:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  80196c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801971:	b8 03 00 00 00       	mov    $0x3,%eax
+  801976:	e8 79 fe ff ff       	call   8017f4 <fsipc>
+  80197b:	89 c6                	mov    %eax,%esi
+  80197d:	85 c0                	test   %eax,%eax
+  80197f:	78 27                	js     8019a8 <devfile_read+0x61>
+  assert(r <= n);
+  801981:	39 c3                	cmp    %eax,%ebx
+  801983:	0f 82 0e 02 00 00    	jb     801b97 <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  801989:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80198e:	0f 8f 1c 02 00 00    	jg     801bb0 <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801994:	83 ec 04             	sub    $0x4,%esp
+  801997:	50                   	push   %eax
+  801998:	68 00 60 80 00       	push   $0x806000
+  80199d:	ff 75 0c             	push   0xc(%ebp)
+  8019a0:	e8 cc ef ff ff       	call   800971 <memmove>
+  return r;
+  8019a5:	83 c4 10             	add    $0x10,%esp
+}
+  8019a8:	89 f0                	mov    %esi,%eax
+  8019aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019ad:	5b                   	pop    %ebx
+  8019ae:	5e                   	pop    %esi
+  8019af:	5f                   	pop    %edi
+  8019b0:	5d                   	pop    %ebp
+  8019b1:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  8019b2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8019b7:	e8 0f ff ff ff       	call   8018cb <fsv_alloc>
+  8019bc:	89 c6                	mov    %eax,%esi
+  8019be:	85 c0                	test   %eax,%eax
+  8019c0:	78 e6                	js     8019a8 <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  8019c2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019c5:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019c8:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  8019cd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019d0:	8b 40 04             	mov    0x4(%eax),%eax
+  8019d3:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  8019d8:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  8019de:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  8019e5:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8019ea:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  8019ef:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8019f4:	e8 e2 fc ff ff       	call   8016db <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  8019f9:	6a 00                	push   $0x0
+  8019fb:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8019fe:	50                   	push   %eax
+  8019ff:	68 00 10 c0 9f       	push   $0x9fc01000
+  801a04:	6a 00                	push   $0x0
+  801a06:	e8 3c 11 00 00       	call   802b47 <ipc_recv_pages>
+  801a0b:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  801a0d:	83 c4 10             	add    $0x10,%esp
+  801a10:	85 c0                	test   %eax,%eax
+  801a12:	7e 94                	jle    8019a8 <devfile_read+0x61>
+  assert(r <= n);
+  801a14:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801a17:	39 c3                	cmp    %eax,%ebx
+  801a19:	72 2e                	jb     801a49 <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801a1b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a1e:	8b 40 04             	mov    0x4(%eax),%eax
+  801a21:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801a26:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  801a29:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801a2c:	c1 e2 0c             	shl    $0xc,%edx
+  801a2f:	39 ca                	cmp    %ecx,%edx
+  801a31:	72 2f                	jb     801a62 <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  801a33:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  801a38:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  801a3b:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  801a3f:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801a44:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  801a47:	eb 52                	jmp    801a9b <devfile_read+0x154>
+  assert(r <= n);
+  801a49:	68 b1 33 80 00       	push   $0x8033b1
+  801a4e:	68 b8 33 80 00       	push   $0x8033b8
+  801a53:	68 49 01 00 00       	push   $0x149
+  801a58:	68 a6 33 80 00       	push   $0x8033a6
+  801a5d:	e8 c0 e6 ff ff       	call   800122 <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801a62:	68 dc 33 80 00       	push   $0x8033dc
+  801a67:	68 b8 33 80 00       	push   $0x8033b8
+  801a6c:	68 4a 01 00 00       	push   $0x14a
+  801a71:	68 a6 33 80 00       	push   $0x8033a6
+  801a76:	e8 a7 e6 ff ff       	call   800122 <_panic>
+      memmove(dst + done, src + done, m);
+  801a7b:	83 ec 04             	sub    $0x4,%esp
+  801a7e:	53                   	push   %ebx
+  801a7f:	56                   	push   %esi
+  801a80:	89 f8                	mov    %edi,%eax
+  801a82:	03 45 0c             	add    0xc(%ebp),%eax
+  801a85:	50                   	push   %eax
+  801a86:	e8 e6 ee ff ff       	call   800971 <memmove>
+  801a8b:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  801a8e:	01 df                	add    %ebx,%edi
+  801a90:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801a93:	39 c7                	cmp    %eax,%edi
+  801a95:	0f 83 c0 00 00 00    	jae    801b5b <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801a9b:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801a9e:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  801aa1:	89 f0                	mov    %esi,%eax
+  801aa3:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801aa8:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  801aad:	29 c3                	sub    %eax,%ebx
+  801aaf:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801ab2:	29 f8                	sub    %edi,%eax
+  801ab4:	39 c3                	cmp    %eax,%ebx
+  801ab6:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  801ab9:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801abf:	75 ba                	jne    801a7b <devfile_read+0x134>
+  801ac1:	89 f9                	mov    %edi,%ecx
+  801ac3:	03 4d 0c             	add    0xc(%ebp),%ecx
+  801ac6:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  801ac9:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  801acf:	75 aa                	jne    801a7b <devfile_read+0x134>
+  801ad1:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  801ad7:	77 a2                	ja     801a7b <devfile_read+0x134>
+  801ad9:	89 c8                	mov    %ecx,%eax
+  801adb:	c1 e8 16             	shr    $0x16,%eax
+  801ade:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801ae5:	a8 01                	test   $0x1,%al
+  801ae7:	74 92                	je     801a7b <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  801ae9:	89 c8                	mov    %ecx,%eax
+  801aeb:	c1 e8 0c             	shr    $0xc,%eax
+  801aee:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  801af5:	a8 01                	test   $0x1,%al
+  801af7:	74 82                	je     801a7b <devfile_read+0x134>
+  801af9:	a9 02 08 00 00       	test   $0x802,%eax
+  801afe:	0f 84 77 ff ff ff    	je     801a7b <devfile_read+0x134>
+  801b04:	f6 c4 04             	test   $0x4,%ah
+  801b07:	0f 85 6e ff ff ff    	jne    801a7b <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  801b0d:	a1 44 57 80 00       	mov    0x805744,%eax
+  801b12:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  801b16:	84 c0                	test   %al,%al
+  801b18:	75 17                	jne    801b31 <devfile_read+0x1ea>
+  801b1a:	83 ec 08             	sub    $0x8,%esp
+  801b1d:	6a 01                	push   $0x1
+  801b1f:	6a 00                	push   $0x0
+  801b21:	e8 b1 f0 ff ff       	call   800bd7 <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  801b26:	83 c4 10             	add    $0x10,%esp
+  801b29:	85 c0                	test   %eax,%eax
+  801b2b:	0f 85 4a ff ff ff    	jne    801a7b <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  801b31:	83 ec 04             	sub    $0x4,%esp
+  801b34:	68 05 08 00 00       	push   $0x805
+  801b39:	ff 75 cc             	push   -0x34(%ebp)
+  801b3c:	6a 00                	push   $0x0
+  801b3e:	56                   	push   %esi
+  801b3f:	6a 00                	push   $0x0
+  801b41:	6a 05                	push   $0x5
+  801b43:	68 40 50 80 00       	push   $0x805040
+  801b48:	e8 20 f5 ff ff       	call   80106d <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  801b4d:	c1 e8 1f             	shr    $0x1f,%eax
+  801b50:	08 45 cb             	or     %al,-0x35(%ebp)
+  801b53:	83 c4 20             	add    $0x20,%esp
+  801b56:	e9 33 ff ff ff       	jmp    801a8e <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  801b5b:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  801b5e:	83 ec 0c             	sub    $0xc,%esp
+  801b61:	68 40 50 80 00       	push   $0x805040
+  801b66:	e8 b2 f4 ff ff       	call   80101d <sysbatch_flush>
+  801b6b:	83 c4 10             	add    $0x10,%esp
+  801b6e:	85 c0                	test   %eax,%eax
+  801b70:	78 06                	js     801b78 <devfile_read+0x231>
+  801b72:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  801b76:	74 14                	je     801b8c <devfile_read+0x245>
+    memmove(dst, src, r);
+  801b78:	83 ec 04             	sub    $0x4,%esp
+  801b7b:	ff 75 d4             	push   -0x2c(%ebp)
+  801b7e:	ff 75 d0             	push   -0x30(%ebp)
+  801b81:	ff 75 0c             	push   0xc(%ebp)
+  801b84:	e8 e8 ed ff ff       	call   800971 <memmove>
+  801b89:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  801b8c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b8f:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  801b92:	e9 11 fe ff ff       	jmp    8019a8 <devfile_read+0x61>
+  assert(r <= n);
+  801b97:	68 b1 33 80 00       	push   $0x8033b1
+  801b9c:	68 b8 33 80 00       	push   $0x8033b8
+  801ba1:	68 1c 01 00 00       	push   $0x11c
+  801ba6:	68 a6 33 80 00       	push   $0x8033a6
+  801bab:	e8 72 e5 ff ff       	call   800122 <_panic>
+  assert(r <= PGSIZE);
+  801bb0:	68 cd 33 80 00       	push   $0x8033cd
+  801bb5:	68 b8 33 80 00       	push   $0x8033b8
+  801bba:	68 1d 01 00 00       	push   $0x11d
+  801bbf:	68 a6 33 80 00       	push   $0x8033a6
+  801bc4:	e8 59 e5 ff ff       	call   800122 <_panic>
+
+00801bc9 <devfile_write>:
+{
+  801bc9:	55                   	push   %ebp
+  801bca:	89 e5                	mov    %esp,%ebp
+  801bcc:	57                   	push   %edi
+  801bcd:	56                   	push   %esi
+  801bce:	53                   	push   %ebx
+  801bcf:	83 ec 1c             	sub    $0x1c,%esp
+  801bd2:	8b 75 08             	mov    0x8(%ebp),%esi
+  801bd5:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  801bd8:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  801bdd:	77 39                	ja     801c18 <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801bdf:	8b 56 0c             	mov    0xc(%esi),%edx
+  801be2:	89 15 00 60 80 00    	mov    %edx,0x806000
+  fsipcbuf.write.req_n = n;
+  801be8:	a3 04 60 80 00       	mov    %eax,0x806004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  801bed:	83 ec 04             	sub    $0x4,%esp
+  801bf0:	50                   	push   %eax
+  801bf1:	ff 75 0c             	push   0xc(%ebp)
+  801bf4:	68 08 60 80 00       	push   $0x806008
+  801bf9:	e8 73 ed ff ff       	call   800971 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801bfe:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c03:	b8 04 00 00 00       	mov    $0x4,%eax
+  801c08:	e8 e7 fb ff ff       	call   8017f4 <fsipc>
+  801c0d:	83 c4 10             	add    $0x10,%esp
+}
+  801c10:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c13:	5b                   	pop    %ebx
+  801c14:	5e                   	pop    %esi
+  801c15:	5f                   	pop    %edi
+  801c16:	5d                   	pop    %ebp
+  801c17:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  801c18:	ba 00 00 10 00       	mov    $0x100000,%edx
+  801c1d:	39 d0                	cmp    %edx,%eax
+  801c1f:	89 d3                	mov    %edx,%ebx
+  801c21:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  801c24:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  801c2a:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  801c2d:	83 c7 01             	add    $0x1,%edi
+  801c30:	89 f8                	mov    %edi,%eax
+  801c32:	e8 94 fc ff ff       	call   8018cb <fsv_alloc>
+  801c37:	85 c0                	test   %eax,%eax
+  801c39:	78 d5                	js     801c10 <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  801c3b:	83 ec 04             	sub    $0x4,%esp
+  801c3e:	53                   	push   %ebx
+  801c3f:	ff 75 0c             	push   0xc(%ebp)
+  801c42:	68 00 10 c0 9f       	push   $0x9fc01000
+  801c47:	e8 25 ed ff ff       	call   800971 <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  801c4c:	8b 46 0c             	mov    0xc(%esi),%eax
+  801c4f:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  801c54:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  801c5a:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801c61:	89 f9                	mov    %edi,%ecx
+  801c63:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801c68:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801c6d:	e8 69 fa ff ff       	call   8016db <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801c72:	6a 00                	push   $0x0
+  801c74:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801c77:	50                   	push   %eax
+  801c78:	6a 00                	push   $0x0
+  801c7a:	6a 00                	push   $0x0
+  801c7c:	e8 c6 0e 00 00       	call   802b47 <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  801c81:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  801c84:	eb 8a                	jmp    801c10 <devfile_write+0x47>
+
+00801c86 <open>:
+{
+  801c86:	55                   	push   %ebp
+  801c87:	89 e5                	mov    %esp,%ebp
+  801c89:	56                   	push   %esi
+  801c8a:	53                   	push   %ebx
+  801c8b:	83 ec 1c             	sub    $0x1c,%esp
+  801c8e:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801c91:	56                   	push   %esi
+  801c92:	e8 19 eb ff ff       	call   8007b0 <strlen>
+  801c97:	83 c4 10             	add    $0x10,%esp
+  801c9a:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801c9f:	7f 6c                	jg     801d0d <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  801ca1:	83 ec 0c             	sub    $0xc,%esp
+  801ca4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ca7:	50                   	push   %eax
+  801ca8:	e8 ad f4 ff ff       	call   80115a <fd_alloc>
+  801cad:	89 c3                	mov    %eax,%ebx
+  801caf:	83 c4 10             	add    $0x10,%esp
+  801cb2:	85 c0                	test   %eax,%eax
+  801cb4:	78 3c                	js     801cf2 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801cb6:	83 ec 08             	sub    $0x8,%esp
+  801cb9:	56                   	push   %esi
+  801cba:	68 00 60 80 00       	push   $0x806000
+  801cbf:	e8 27 eb ff ff       	call   8007eb <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801cc4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801cc7:	a3 00 64 80 00       	mov    %eax,0x806400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801ccc:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801ccf:	b8 01 00 00 00       	mov    $0x1,%eax
+  801cd4:	e8 1b fb ff ff       	call   8017f4 <fsipc>
+  801cd9:	89 c3                	mov    %eax,%ebx
+  801cdb:	83 c4 10             	add    $0x10,%esp
+  801cde:	85 c0                	test   %eax,%eax
+  801ce0:	78 19                	js     801cfb <open+0x75>
+  return fd2num(fd);
+  801ce2:	83 ec 0c             	sub    $0xc,%esp
+  801ce5:	ff 75 f4             	push   -0xc(%ebp)
+  801ce8:	e8 49 f4 ff ff       	call   801136 <fd2num>
+  801ced:	89 c3                	mov    %eax,%ebx
+  801cef:	83 c4 10             	add    $0x10,%esp
+}
+  801cf2:	89 d8                	mov    %ebx,%eax
+  801cf4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cf7:	5b                   	pop    %ebx
+  801cf8:	5e                   	pop    %esi
+  801cf9:	5d                   	pop    %ebp
+  801cfa:	c3                   	ret
+    fd_close(fd, 0);
+  801cfb:	83 ec 08             	sub    $0x8,%esp
+  801cfe:	6a 00                	push   $0x0
+  801d00:	ff 75 f4             	push   -0xc(%ebp)
+  801d03:	e8 44 f5 ff ff       	call   80124c <fd_close>
+    return r;
+  801d08:	83 c4 10             	add    $0x10,%esp
+  801d0b:	eb e5                	jmp    801cf2 <open+0x6c>
+    return -E_BAD_PATH;
+  801d0d:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801d12:	eb de                	jmp    801cf2 <open+0x6c>
+
+00801d14 <open_read>:
+{
+  801d14:	55                   	push   %ebp
+  801d15:	89 e5                	mov    %esp,%ebp
+  801d17:	57                   	push   %edi
+  801d18:	56                   	push   %esi
+  801d19:	53                   	push   %ebx
+  801d1a:	83 ec 28             	sub    $0x28,%esp
+  801d1d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  801d20:	57                   	push   %edi
+  801d21:	e8 8a ea ff ff       	call   8007b0 <strlen>
+  801d26:	83 c4 10             	add    $0x10,%esp
+  801d29:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801d2e:	0f 87 f6 00 00 00    	ja     801e2a <open_read+0x116>
+  801d34:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  801d36:	83 ec 0c             	sub    $0xc,%esp
+  801d39:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801d3c:	50                   	push   %eax
+  801d3d:	e8 18 f4 ff ff       	call   80115a <fd_alloc>
+  801d42:	89 c3                	mov    %eax,%ebx
+  801d44:	83 c4 10             	add    $0x10,%esp
+  801d47:	85 c0                	test   %eax,%eax
+  801d49:	0f 88 b2 00 00 00    	js     801e01 <open_read+0xed>
+  strcpy(req->req_buf, path);
+  801d4f:	83 ec 08             	sub    $0x8,%esp
+  801d52:	57                   	push   %edi
+  801d53:	68 e4 60 80 00       	push   $0x8060e4
+  801d58:	e8 8e ea ff ff       	call   8007eb <strcpy>
+  req->req_nops = 2;
+  801d5d:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  801d64:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  801d67:	c7 05 04 60 80 00 01 	movl   $0x1,0x806004
+  801d6e:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  801d71:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d74:	a3 10 60 80 00       	mov    %eax,0x806010
+  req->req_ops[0].op_buf = 0;
+  801d79:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  801d80:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  801d83:	c7 05 20 60 80 00 04 	movl   $0x4,0x806020
+  801d8a:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  801d8d:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  801d94:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  801d97:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  801d9c:	29 f0                	sub    %esi,%eax
+  801d9e:	3b 45 14             	cmp    0x14(%ebp),%eax
+  801da1:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  801da5:	a3 2c 60 80 00       	mov    %eax,0x80602c
+  req->req_ops[1].op_offset = 0;
+  801daa:	c7 05 30 60 80 00 00 	movl   $0x0,0x806030
+  801db1:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  801db4:	83 c6 01             	add    $0x1,%esi
+  801db7:	89 35 34 60 80 00    	mov    %esi,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  801dbd:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801dc0:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801dc5:	e8 2a fa ff ff       	call   8017f4 <fsipc>
+  801dca:	89 c3                	mov    %eax,%ebx
+  801dcc:	83 c4 10             	add    $0x10,%esp
+  801dcf:	83 f8 01             	cmp    $0x1,%eax
+  801dd2:	7e 37                	jle    801e0b <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  801dd4:	a1 38 60 80 00       	mov    0x806038,%eax
+  801dd9:	8b 55 18             	mov    0x18(%ebp),%edx
+  801ddc:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  801dde:	83 ec 04             	sub    $0x4,%esp
+  801de1:	50                   	push   %eax
+  801de2:	81 c6 e4 60 80 00    	add    $0x8060e4,%esi
+  801de8:	56                   	push   %esi
+  801de9:	ff 75 10             	push   0x10(%ebp)
+  801dec:	e8 80 eb ff ff       	call   800971 <memmove>
+  return fd2num(fd);
+  801df1:	83 c4 04             	add    $0x4,%esp
+  801df4:	ff 75 e4             	push   -0x1c(%ebp)
+  801df7:	e8 3a f3 ff ff       	call   801136 <fd2num>
+  801dfc:	89 c3                	mov    %eax,%ebx
+  801dfe:	83 c4 10             	add    $0x10,%esp
+}
+  801e01:	89 d8                	mov    %ebx,%eax
+  801e03:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e06:	5b                   	pop    %ebx
+  801e07:	5e                   	pop    %esi
+  801e08:	5f                   	pop    %edi
+  801e09:	5d                   	pop    %ebp
+  801e0a:	c3                   	ret
+    fd_close(fd, 0);
+  801e0b:	83 ec 08             	sub    $0x8,%esp
+  801e0e:	6a 00                	push   $0x0
+  801e10:	ff 75 e4             	push   -0x1c(%ebp)
+  801e13:	e8 34 f4 ff ff       	call   80124c <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  801e18:	83 c4 10             	add    $0x10,%esp
+  801e1b:	85 db                	test   %ebx,%ebx
+  801e1d:	78 e2                	js     801e01 <open_read+0xed>
+  801e1f:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  801e22:	8b 9b 1c 60 80 00    	mov    0x80601c(%ebx),%ebx
+  801e28:	eb d7                	jmp    801e01 <open_read+0xed>
+    return -E_BAD_PATH;
+  801e2a:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801e2f:	eb d0                	jmp    801e01 <open_read+0xed>
+
+00801e31 <file_stat>:
+{
+  801e31:	55                   	push   %ebp
+  801e32:	89 e5                	mov    %esp,%ebp
+  801e34:	57                   	push   %edi
+  801e35:	56                   	push   %esi
+  801e36:	53                   	push   %ebx
+  801e37:	83 ec 18             	sub    $0x18,%esp
+  801e3a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801e3d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801e40:	57                   	push   %edi
+  801e41:	e8 6a e9 ff ff       	call   8007b0 <strlen>
+  801e46:	83 c4 10             	add    $0x10,%esp
+  801e49:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801e4e:	0f 8f c7 00 00 00    	jg     801f1b <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  801e54:	83 ec 0c             	sub    $0xc,%esp
+  801e57:	57                   	push   %edi
+  801e58:	e8 53 e9 ff ff       	call   8007b0 <strlen>
+  801e5d:	8d 58 04             	lea    0x4(%eax),%ebx
+  801e60:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  801e63:	83 c4 08             	add    $0x8,%esp
+  801e66:	57                   	push   %edi
+  801e67:	68 e4 60 80 00       	push   $0x8060e4
+  801e6c:	e8 7a e9 ff ff       	call   8007eb <strcpy>
+  req->req_nops = 2;
+  801e71:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  801e78:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  801e7b:	c7 05 04 60 80 00 02 	movl   $0x2,0x806004
+  801e82:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  801e85:	c7 05 10 60 80 00 00 	movl   $0x0,0x806010
+  801e8c:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  801e8f:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  801e96:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  801e99:	c7 05 20 60 80 00 03 	movl   $0x3,0x806020
+  801ea0:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  801ea3:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  801eaa:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  801ead:	89 1d 34 60 80 00    	mov    %ebx,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  801eb3:	ba 00 00 00 00       	mov    $0x0,%edx
+  801eb8:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801ebd:	e8 32 f9 ff ff       	call   8017f4 <fsipc>
+  801ec2:	83 c4 10             	add    $0x10,%esp
+  801ec5:	83 f8 01             	cmp    $0x1,%eax
+  801ec8:	7e 42                	jle    801f0c <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  801eca:	81 c3 e4 60 80 00    	add    $0x8060e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  801ed0:	83 ec 08             	sub    $0x8,%esp
+  801ed3:	53                   	push   %ebx
+  801ed4:	56                   	push   %esi
+  801ed5:	e8 11 e9 ff ff       	call   8007eb <strcpy>
+  st->st_size = ret->ret_size;
+  801eda:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  801ee0:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  801ee6:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  801eec:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  801ef2:	c7 86 88 00 00 00 04 	movl   $0x804004,0x88(%esi)
+  801ef9:	40 80 00 
+  return 0;
+  801efc:	83 c4 10             	add    $0x10,%esp
+  801eff:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f04:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f07:	5b                   	pop    %ebx
+  801f08:	5e                   	pop    %esi
+  801f09:	5f                   	pop    %edi
+  801f0a:	5d                   	pop    %ebp
+  801f0b:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  801f0c:	85 c0                	test   %eax,%eax
+  801f0e:	78 f4                	js     801f04 <file_stat+0xd3>
+  801f10:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801f13:	8b 80 1c 60 80 00    	mov    0x80601c(%eax),%eax
+  801f19:	eb e9                	jmp    801f04 <file_stat+0xd3>
+    return -E_BAD_PATH;
+  801f1b:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801f20:	eb e2                	jmp    801f04 <file_stat+0xd3>
+
+00801f22 <read_map>:
+{
+  801f22:	55                   	push   %ebp
+  801f23:	89 e5                	mov    %esp,%ebp
+  801f25:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801f28:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f2b:	50                   	push   %eax
+  801f2c:	ff 75 08             	push   0x8(%ebp)
+  801f2f:	e8 7c f2 ff ff       	call   8011b0 <fd_lookup>
+  801f34:	83 c4 10             	add    $0x10,%esp
+  801f37:	85 c0                	test   %eax,%eax
+  801f39:	78 2a                	js     801f65 <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  801f3b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f3e:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  801f44:	39 08                	cmp    %ecx,(%eax)
+  801f46:	75 1f                	jne    801f67 <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  801f48:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f4b:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read_map.req_offset = offset;
+  801f50:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f53:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  801f58:	8b 55 10             	mov    0x10(%ebp),%edx
+  801f5b:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801f60:	e8 8f f8 ff ff       	call   8017f4 <fsipc>
+}
+  801f65:	c9                   	leave
+  801f66:	c3                   	ret
+    return -E_INVAL;
+  801f67:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f6c:	eb f7                	jmp    801f65 <read_map+0x43>
+
+00801f6e <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801f6e:	55                   	push   %ebp
+  801f6f:	89 e5                	mov    %esp,%ebp
+  801f71:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  801f74:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f79:	b8 08 00 00 00       	mov    $0x8,%eax
+  801f7e:	e8 71 f8 ff ff       	call   8017f4 <fsipc>
+}
+  801f83:	c9                   	leave
+  801f84:	c3                   	ret
+
+00801f85 <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  801f85:	55                   	push   %ebp
+  801f86:	89 e5                	mov    %esp,%ebp
+  801f88:	57                   	push   %edi
+  801f89:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  801f8a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f8d:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.stats.req_bio_sched = 0;
+  801f92:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  801f99:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  801f9c:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  801fa3:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  801fa6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fab:	b8 09 00 00 00       	mov    $0x9,%eax
+  801fb0:	e8 3f f8 ff ff       	call   8017f4 <fsipc>
+  801fb5:	85 c0                	test   %eax,%eax
+  801fb7:	78 14                	js     801fcd <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  801fb9:	be 00 60 80 00       	mov    $0x806000,%esi
+  801fbe:	b9 16 00 00 00       	mov    $0x16,%ecx
+  801fc3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801fc6:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  801fc8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801fcd:	5e                   	pop    %esi
+  801fce:	5f                   	pop    %edi
+  801fcf:	5d                   	pop    %ebp
+  801fd0:	c3                   	ret
+
+00801fd1 <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  801fd1:	55                   	push   %ebp
+  801fd2:	89 e5                	mov    %esp,%ebp
+  801fd4:	53                   	push   %ebx
+  801fd5:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  801fd8:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801fdb:	50                   	push   %eax
+  801fdc:	6a 00                	push   $0x0
+  801fde:	e8 a2 ff ff ff       	call   801f85 <fs_stats>
+  801fe3:	83 c4 10             	add    $0x10,%esp
+  801fe6:	85 c0                	test   %eax,%eax
+  801fe8:	78 28                	js     802012 <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  801fea:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  801fed:	83 ec 08             	sub    $0x8,%esp
+  801ff0:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801ff3:	50                   	push   %eax
+  801ff4:	6a 20                	push   $0x20
+  801ff6:	e8 8a ff ff ff       	call   801f85 <fs_stats>
+  801ffb:	83 c4 10             	add    $0x10,%esp
+  801ffe:	85 c0                	test   %eax,%eax
+  802000:	78 10                	js     802012 <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  802002:	83 ec 08             	sub    $0x8,%esp
+  802005:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802008:	50                   	push   %eax
+  802009:	53                   	push   %ebx
+  80200a:	e8 76 ff ff ff       	call   801f85 <fs_stats>
+  80200f:	83 c4 10             	add    $0x10,%esp
+}
+  802012:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802015:	c9                   	leave
+  802016:	c3                   	ret
+
+00802017 <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  802017:	55                   	push   %ebp
+  802018:	89 e5                	mov    %esp,%ebp
+  80201a:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  80201d:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  802024:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  802027:	8b 45 08             	mov    0x8(%ebp),%eax
+  80202a:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.stats.req_dcache = 0;
+  80202f:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  802036:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  802039:	ba 00 00 00 00       	mov    $0x0,%edx
+  80203e:	b8 09 00 00 00       	mov    $0x9,%eax
+  802043:	e8 ac f7 ff ff       	call   8017f4 <fsipc>
+}
+  802048:	c9                   	leave
+  802049:	c3                   	ret
+
+0080204a <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  80204a:	55                   	push   %ebp
+  80204b:	89 e5                	mov    %esp,%ebp
+  80204d:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  802050:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  802057:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  80205a:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  802061:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  802064:	8b 45 08             	mov    0x8(%ebp),%eax
+  802067:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_STATS, NULL);
+  80206c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802071:	b8 09 00 00 00       	mov    $0x9,%eax
+  802076:	e8 79 f7 ff ff       	call   8017f4 <fsipc>
+}
+  80207b:	c9                   	leave
+  80207c:	c3                   	ret
+
+0080207d <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  80207d:	55                   	push   %ebp
+  80207e:	89 e5                	mov    %esp,%ebp
+  802080:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802083:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802086:	50                   	push   %eax
+  802087:	ff 75 08             	push   0x8(%ebp)
+  80208a:	e8 21 f1 ff ff       	call   8011b0 <fd_lookup>
+  80208f:	83 c4 10             	add    $0x10,%esp
+  802092:	85 c0                	test   %eax,%eax
+  802094:	78 34                	js     8020ca <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  802096:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802099:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  80209f:	39 08                	cmp    %ecx,(%eax)
+  8020a1:	75 29                	jne    8020cc <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  8020a3:	8b 40 0c             	mov    0xc(%eax),%eax
+  8020a6:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.fallocate.req_offset = offset;
+  8020ab:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020ae:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.fallocate.req_len = len;
+  8020b3:	8b 45 10             	mov    0x10(%ebp),%eax
+  8020b6:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  8020bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020c0:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8020c5:	e8 2a f7 ff ff       	call   8017f4 <fsipc>
+}
+  8020ca:	c9                   	leave
+  8020cb:	c3                   	ret
+    return -E_INVAL;
+  8020cc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020d1:	eb f7                	jmp    8020ca <fallocate+0x4d>
+
+008020d3 <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  8020d3:	55                   	push   %ebp
+  8020d4:	89 e5                	mov    %esp,%ebp
+  8020d6:	57                   	push   %edi
+  8020d7:	56                   	push   %esi
+  8020d8:	53                   	push   %ebx
+  8020d9:	83 ec 24             	sub    $0x24,%esp
+  8020dc:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8020df:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8020e2:	50                   	push   %eax
+  8020e3:	ff 75 08             	push   0x8(%ebp)
+  8020e6:	e8 c5 f0 ff ff       	call   8011b0 <fd_lookup>
+  8020eb:	83 c4 10             	add    $0x10,%esp
+  8020ee:	85 c0                	test   %eax,%eax
+  8020f0:	78 66                	js     802158 <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  8020f2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8020f5:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  8020fb:	39 08                	cmp    %ecx,(%eax)
+  8020fd:	75 61                	jne    802160 <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  8020ff:	85 f6                	test   %esi,%esi
+  802101:	7e 50                	jle    802153 <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  802103:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  802108:	39 de                	cmp    %ebx,%esi
+  80210a:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  80210d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802110:	8b 40 0c             	mov    0xc(%eax),%eax
+  802113:	a3 00 60 80 00       	mov    %eax,0x806000
+    fsipcbuf.prefetch.req_n = m;
+  802118:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  80211e:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  802125:	83 ec 04             	sub    $0x4,%esp
+  802128:	57                   	push   %edi
+  802129:	ff 75 0c             	push   0xc(%ebp)
+  80212c:	68 08 60 80 00       	push   $0x806008
+  802131:	e8 3b e8 ff ff       	call   800971 <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  802136:	ba 00 00 00 00       	mov    $0x0,%edx
+  80213b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802140:	e8 af f6 ff ff       	call   8017f4 <fsipc>
+  802145:	83 c4 10             	add    $0x10,%esp
+  802148:	85 c0                	test   %eax,%eax
+  80214a:	78 0c                	js     802158 <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  80214c:	01 7d 0c             	add    %edi,0xc(%ebp)
+  80214f:	29 de                	sub    %ebx,%esi
+  802151:	eb ac                	jmp    8020ff <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  802153:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802158:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80215b:	5b                   	pop    %ebx
+  80215c:	5e                   	pop    %esi
+  80215d:	5f                   	pop    %edi
+  80215e:	5d                   	pop    %ebp
+  80215f:	c3                   	ret
+    return -E_INVAL;
+  802160:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802165:	eb f1                	jmp    802158 <prefetch+0x85>
+
+00802167 <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  802167:	55                   	push   %ebp
+  802168:	89 e5                	mov    %esp,%ebp
+  80216a:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  80216d:	50                   	push   %eax
+  80216e:	e8 d3 ef ff ff       	call   801146 <fd2data>
+  802173:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  802178:	c9                   	leave
+  802179:	c3                   	ret
+
+0080217a <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80217a:	55                   	push   %ebp
+  80217b:	89 e5                	mov    %esp,%ebp
+  80217d:	56                   	push   %esi
+  80217e:	53                   	push   %ebx
+  80217f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  802182:	83 ec 0c             	sub    $0xc,%esp
+  802185:	ff 75 08             	push   0x8(%ebp)
+  802188:	e8 b9 ef ff ff       	call   801146 <fd2data>
+  80218d:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  80218f:	83 c4 08             	add    $0x8,%esp
+  802192:	68 08 34 80 00       	push   $0x803408
+  802197:	53                   	push   %ebx
+  802198:	e8 4e e6 ff ff       	call   8007eb <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  80219d:	8b 46 04             	mov    0x4(%esi),%eax
+  8021a0:	2b 06                	sub    (%esi),%eax
+  8021a2:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  8021a8:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8021af:	00 00 00 
+  stat->st_dev = &devpipe;
+  8021b2:	c7 83 88 00 00 00 20 	movl   $0x804020,0x88(%ebx)
+  8021b9:	40 80 00 
+  return 0;
+}
+  8021bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021c1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021c4:	5b                   	pop    %ebx
+  8021c5:	5e                   	pop    %esi
+  8021c6:	5d                   	pop    %ebp
+  8021c7:	c3                   	ret
+
+008021c8 <pipe_wakeup>:
+{
+  8021c8:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  8021ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021cf:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  8021d2:	85 c0                	test   %eax,%eax
+  8021d4:	75 01                	jne    8021d7 <pipe_wakeup+0xf>
+  8021d6:	c3                   	ret
+{
+  8021d7:	55                   	push   %ebp
+  8021d8:	89 e5                	mov    %esp,%ebp
+  8021da:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  8021dd:	6a 00                	push   $0x0
+  8021df:	68 00 00 c0 ee       	push   $0xeec00000
+  8021e4:	52                   	push   %edx
+  8021e5:	e8 8c ed ff ff       	call   800f76 <sys_chan_wakeup>
+  8021ea:	83 c4 10             	add    $0x10,%esp
+}
+  8021ed:	c9                   	leave
+  8021ee:	c3                   	ret
+
+008021ef <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8021ef:	55                   	push   %ebp
+  8021f0:	89 e5                	mov    %esp,%ebp
+  8021f2:	57                   	push   %edi
+  8021f3:	56                   	push   %esi
+  8021f4:	53                   	push   %ebx
+  8021f5:	83 ec 18             	sub    $0x18,%esp
+  8021f8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  8021fb:	57                   	push   %edi
+  8021fc:	e8 45 ef ff ff       	call   801146 <fd2data>
+  802201:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  802203:	83 c4 10             	add    $0x10,%esp
+  802206:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  80220a:	74 2a                	je     802236 <devpipe_close+0x47>
+  80220c:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  802211:	89 f8                	mov    %edi,%eax
+  802213:	e8 4f ff ff ff       	call   802167 <pipe_ring>
+  802218:	83 ec 08             	sub    $0x8,%esp
+  80221b:	01 d8                	add    %ebx,%eax
+  80221d:	50                   	push   %eax
+  80221e:	6a 00                	push   $0x0
+  802220:	e8 7a ea ff ff       	call   800c9f <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  802225:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80222b:	83 c4 10             	add    $0x10,%esp
+  80222e:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  802234:	75 db                	jne    802211 <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  802236:	83 ec 08             	sub    $0x8,%esp
+  802239:	57                   	push   %edi
+  80223a:	6a 00                	push   $0x0
+  80223c:	e8 5e ea ff ff       	call   800c9f <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  802241:	83 c4 10             	add    $0x10,%esp
+  802244:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  802248:	75 13                	jne    80225d <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  80224a:	83 ec 08             	sub    $0x8,%esp
+  80224d:	56                   	push   %esi
+  80224e:	6a 00                	push   $0x0
+  802250:	e8 4a ea ff ff       	call   800c9f <sys_page_unmap>
+}
+  802255:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802258:	5b                   	pop    %ebx
+  802259:	5e                   	pop    %esi
+  80225a:	5f                   	pop    %edi
+  80225b:	5d                   	pop    %ebp
+  80225c:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  80225d:	8d 56 04             	lea    0x4(%esi),%edx
+  802260:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802263:	e8 60 ff ff ff       	call   8021c8 <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802268:	8d 46 30             	lea    0x30(%esi),%eax
+  80226b:	89 f2                	mov    %esi,%edx
+  80226d:	e8 56 ff ff ff       	call   8021c8 <pipe_wakeup>
+  802272:	eb d6                	jmp    80224a <devpipe_close+0x5b>
+
+00802274 <_pipeisclosed>:
+{
+  802274:	55                   	push   %ebp
+  802275:	89 e5                	mov    %esp,%ebp
+  802277:	57                   	push   %edi
+  802278:	56                   	push   %esi
+  802279:	53                   	push   %ebx
+  80227a:	83 ec 1c             	sub    $0x1c,%esp
+  80227d:	89 c7                	mov    %eax,%edi
+  80227f:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  802281:	a1 44 57 80 00       	mov    0x805744,%eax
+  802286:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  802289:	83 ec 0c             	sub    $0xc,%esp
+  80228c:	57                   	push   %edi
+  80228d:	e8 18 0a 00 00       	call   802caa <pageref>
+  802292:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802295:	89 34 24             	mov    %esi,(%esp)
+  802298:	e8 0d 0a 00 00       	call   802caa <pageref>
+    nn = thisenv->env_runs;
+  80229d:	8b 15 44 57 80 00    	mov    0x805744,%edx
+  8022a3:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  8022a6:	83 c4 10             	add    $0x10,%esp
+  8022a9:	39 cb                	cmp    %ecx,%ebx
+  8022ab:	74 1b                	je     8022c8 <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  8022ad:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8022b0:	75 cf                	jne    802281 <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8022b2:	8b 42 58             	mov    0x58(%edx),%eax
+  8022b5:	6a 01                	push   $0x1
+  8022b7:	50                   	push   %eax
+  8022b8:	53                   	push   %ebx
+  8022b9:	68 0f 34 80 00       	push   $0x80340f
+  8022be:	e8 3a df ff ff       	call   8001fd <cprintf>
+  8022c3:	83 c4 10             	add    $0x10,%esp
+  8022c6:	eb b9                	jmp    802281 <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  8022c8:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8022cb:	0f 94 c0             	sete   %al
+  8022ce:	0f b6 c0             	movzbl %al,%eax
+}
+  8022d1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022d4:	5b                   	pop    %ebx
+  8022d5:	5e                   	pop    %esi
+  8022d6:	5f                   	pop    %edi
+  8022d7:	5d                   	pop    %ebp
+  8022d8:	c3                   	ret
+
+008022d9 <devpipe_write_bulk>:
+{
+  8022d9:	55                   	push   %ebp
+  8022da:	89 e5                	mov    %esp,%ebp
+  8022dc:	57                   	push   %edi
+  8022dd:	56                   	push   %esi
+  8022de:	53                   	push   %ebx
+  8022df:	83 ec 1c             	sub    $0x1c,%esp
+  8022e2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8022e5:	89 d6                	mov    %edx,%esi
+  8022e7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  8022ea:	e8 78 fe ff ff       	call   802167 <pipe_ring>
+  8022ef:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  8022f2:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  8022f7:	8d 46 04             	lea    0x4(%esi),%eax
+  8022fa:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  8022fd:	eb 75                	jmp    802374 <devpipe_write_bulk+0x9b>
+  8022ff:	b8 01 00 00 00       	mov    $0x1,%eax
+  802304:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802308:	6a 64                	push   $0x64
+  80230a:	68 00 00 c0 ee       	push   $0xeec00000
+  80230f:	53                   	push   %ebx
+  802310:	56                   	push   %esi
+  802311:	e8 3d ec ff ff       	call   800f53 <sys_chan_sleep>
+      continue;
+  802316:	83 c4 10             	add    $0x10,%esp
+  802319:	eb 59                	jmp    802374 <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  80231b:	89 d1                	mov    %edx,%ecx
+  80231d:	c1 f9 1f             	sar    $0x1f,%ecx
+  802320:	c1 e9 11             	shr    $0x11,%ecx
+  802323:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802326:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  80232b:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  80232d:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  802333:	29 d3                	sub    %edx,%ebx
+  802335:	ba 00 80 00 00       	mov    $0x8000,%edx
+  80233a:	29 c2                	sub    %eax,%edx
+  80233c:	39 d3                	cmp    %edx,%ebx
+  80233e:	0f 47 da             	cmova  %edx,%ebx
+  802341:	8b 55 08             	mov    0x8(%ebp),%edx
+  802344:	29 fa                	sub    %edi,%edx
+  802346:	39 d3                	cmp    %edx,%ebx
+  802348:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  80234b:	83 ec 04             	sub    $0x4,%esp
+  80234e:	53                   	push   %ebx
+  80234f:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802352:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  802355:	52                   	push   %edx
+  802356:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802359:	01 c8                	add    %ecx,%eax
+  80235b:	50                   	push   %eax
+  80235c:	e8 72 e6 ff ff       	call   8009d3 <memcpy>
+    i += m;
+  802361:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  802363:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802366:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802369:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80236c:	e8 57 fe ff ff       	call   8021c8 <pipe_wakeup>
+  802371:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802374:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802377:	73 2b                	jae    8023a4 <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  802379:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  80237b:	8b 56 04             	mov    0x4(%esi),%edx
+  80237e:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  802384:	39 d0                	cmp    %edx,%eax
+  802386:	7d 93                	jge    80231b <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  802388:	89 f2                	mov    %esi,%edx
+  80238a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80238d:	e8 e2 fe ff ff       	call   802274 <_pipeisclosed>
+  802392:	85 c0                	test   %eax,%eax
+  802394:	0f 84 65 ff ff ff    	je     8022ff <devpipe_write_bulk+0x26>
+        return i;
+  80239a:	89 f8                	mov    %edi,%eax
+}
+  80239c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80239f:	5b                   	pop    %ebx
+  8023a0:	5e                   	pop    %esi
+  8023a1:	5f                   	pop    %edi
+  8023a2:	5d                   	pop    %ebp
+  8023a3:	c3                   	ret
+  return i;
+  8023a4:	89 f8                	mov    %edi,%eax
+  8023a6:	eb f4                	jmp    80239c <devpipe_write_bulk+0xc3>
+
+008023a8 <devpipe_write>:
+{
+  8023a8:	55                   	push   %ebp
+  8023a9:	89 e5                	mov    %esp,%ebp
+  8023ab:	57                   	push   %edi
+  8023ac:	56                   	push   %esi
+  8023ad:	53                   	push   %ebx
+  8023ae:	83 ec 28             	sub    $0x28,%esp
+  8023b1:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  8023b4:	56                   	push   %esi
+  8023b5:	e8 8c ed ff ff       	call   801146 <fd2data>
+  8023ba:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  8023bc:	8b 78 28             	mov    0x28(%eax),%edi
+  8023bf:	83 c4 10             	add    $0x10,%esp
+  8023c2:	85 ff                	test   %edi,%edi
+  8023c4:	75 25                	jne    8023eb <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  8023c6:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8023c9:	74 66                	je     802431 <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8023cb:	8b 43 04             	mov    0x4(%ebx),%eax
+  8023ce:	8b 0b                	mov    (%ebx),%ecx
+  8023d0:	8d 51 20             	lea    0x20(%ecx),%edx
+  8023d3:	39 d0                	cmp    %edx,%eax
+  8023d5:	72 2b                	jb     802402 <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  8023d7:	89 da                	mov    %ebx,%edx
+  8023d9:	89 f0                	mov    %esi,%eax
+  8023db:	e8 94 fe ff ff       	call   802274 <_pipeisclosed>
+  8023e0:	85 c0                	test   %eax,%eax
+  8023e2:	75 51                	jne    802435 <devpipe_write+0x8d>
+      sys_yield();
+  8023e4:	e8 cf e7 ff ff       	call   800bb8 <sys_yield>
+  8023e9:	eb e0                	jmp    8023cb <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  8023eb:	83 ec 0c             	sub    $0xc,%esp
+  8023ee:	ff 75 10             	push   0x10(%ebp)
+  8023f1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8023f4:	89 c2                	mov    %eax,%edx
+  8023f6:	89 f0                	mov    %esi,%eax
+  8023f8:	e8 dc fe ff ff       	call   8022d9 <devpipe_write_bulk>
+  8023fd:	83 c4 10             	add    $0x10,%esp
+  802400:	eb 38                	jmp    80243a <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802402:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802405:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802409:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  80240c:	89 c2                	mov    %eax,%edx
+  80240e:	c1 fa 1f             	sar    $0x1f,%edx
+  802411:	89 d1                	mov    %edx,%ecx
+  802413:	c1 e9 1b             	shr    $0x1b,%ecx
+  802416:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802419:	83 e2 1f             	and    $0x1f,%edx
+  80241c:	29 ca                	sub    %ecx,%edx
+  80241e:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802422:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  802426:	83 c0 01             	add    $0x1,%eax
+  802429:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  80242c:	83 c7 01             	add    $0x1,%edi
+  80242f:	eb 95                	jmp    8023c6 <devpipe_write+0x1e>
+  return i;
+  802431:	89 f8                	mov    %edi,%eax
+  802433:	eb 05                	jmp    80243a <devpipe_write+0x92>
+        return 0;
+  802435:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80243a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80243d:	5b                   	pop    %ebx
+  80243e:	5e                   	pop    %esi
+  80243f:	5f                   	pop    %edi
+  802440:	5d                   	pop    %ebp
+  802441:	c3                   	ret
+
+00802442 <devpipe_read_bulk>:
+{
+  802442:	55                   	push   %ebp
+  802443:	89 e5                	mov    %esp,%ebp
+  802445:	57                   	push   %edi
+  802446:	56                   	push   %esi
+  802447:	53                   	push   %ebx
+  802448:	83 ec 2c             	sub    $0x2c,%esp
+  80244b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80244e:	89 d6                	mov    %edx,%esi
+  802450:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802453:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  802456:	e8 0c fd ff ff       	call   802167 <pipe_ring>
+  80245b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  80245e:	85 db                	test   %ebx,%ebx
+  802460:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802465:	0f 45 c3             	cmovne %ebx,%eax
+  802468:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80246b:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802470:	8d 46 30             	lea    0x30(%esi),%eax
+  802473:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  802476:	eb 50                	jmp    8024c8 <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  802478:	89 d1                	mov    %edx,%ecx
+  80247a:	c1 f9 1f             	sar    $0x1f,%ecx
+  80247d:	c1 e9 11             	shr    $0x11,%ecx
+  802480:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802483:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802488:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  80248a:	29 d3                	sub    %edx,%ebx
+  80248c:	ba 00 80 00 00       	mov    $0x8000,%edx
+  802491:	29 c2                	sub    %eax,%edx
+  802493:	39 d3                	cmp    %edx,%ebx
+  802495:	0f 47 da             	cmova  %edx,%ebx
+  802498:	8b 55 08             	mov    0x8(%ebp),%edx
+  80249b:	29 fa                	sub    %edi,%edx
+  80249d:	39 d3                	cmp    %edx,%ebx
+  80249f:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  8024a2:	83 ec 04             	sub    $0x4,%esp
+  8024a5:	53                   	push   %ebx
+  8024a6:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8024a9:	01 c8                	add    %ecx,%eax
+  8024ab:	50                   	push   %eax
+  8024ac:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8024af:	01 f8                	add    %edi,%eax
+  8024b1:	50                   	push   %eax
+  8024b2:	e8 1c e5 ff ff       	call   8009d3 <memcpy>
+    i += m;
+  8024b7:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  8024b9:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8024bb:	89 f2                	mov    %esi,%edx
+  8024bd:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8024c0:	e8 03 fd ff ff       	call   8021c8 <pipe_wakeup>
+  8024c5:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  8024c8:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  8024cb:	73 51                	jae    80251e <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  8024cd:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  8024d0:	8b 16                	mov    (%esi),%edx
+  8024d2:	39 da                	cmp    %ebx,%edx
+  8024d4:	75 a2                	jne    802478 <devpipe_read_bulk+0x36>
+      if (i > 0)
+  8024d6:	85 ff                	test   %edi,%edi
+  8024d8:	75 44                	jne    80251e <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  8024da:	89 f2                	mov    %esi,%edx
+  8024dc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8024df:	e8 90 fd ff ff       	call   802274 <_pipeisclosed>
+  8024e4:	85 c0                	test   %eax,%eax
+  8024e6:	75 3a                	jne    802522 <devpipe_read_bulk+0xe0>
+  8024e8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8024ed:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  8024f1:	6a 64                	push   $0x64
+  8024f3:	ff 75 d4             	push   -0x2c(%ebp)
+  8024f6:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  8024f7:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  8024fa:	50                   	push   %eax
+  8024fb:	e8 53 ea ff ff       	call   800f53 <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  802500:	85 c0                	test   %eax,%eax
+  802502:	ba 00 00 00 00       	mov    $0x0,%edx
+  802507:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  80250a:	83 c4 10             	add    $0x10,%esp
+  80250d:	a8 01                	test   $0x1,%al
+  80250f:	74 b7                	je     8024c8 <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  802511:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  802516:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802519:	5b                   	pop    %ebx
+  80251a:	5e                   	pop    %esi
+  80251b:	5f                   	pop    %edi
+  80251c:	5d                   	pop    %ebp
+  80251d:	c3                   	ret
+  return i;
+  80251e:	89 f8                	mov    %edi,%eax
+  802520:	eb f4                	jmp    802516 <devpipe_read_bulk+0xd4>
+        return 0;
+  802522:	b8 00 00 00 00       	mov    $0x0,%eax
+  802527:	eb ed                	jmp    802516 <devpipe_read_bulk+0xd4>
+
+00802529 <devpipe_read>:
+{
+  802529:	55                   	push   %ebp
+  80252a:	89 e5                	mov    %esp,%ebp
+  80252c:	57                   	push   %edi
+  80252d:	56                   	push   %esi
+  80252e:	53                   	push   %ebx
+  80252f:	83 ec 18             	sub    $0x18,%esp
+  802532:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  802535:	57                   	push   %edi
+  802536:	e8 0b ec ff ff       	call   801146 <fd2data>
+  80253b:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  80253d:	8b 70 28             	mov    0x28(%eax),%esi
+  802540:	83 c4 10             	add    $0x10,%esp
+  802543:	85 f6                	test   %esi,%esi
+  802545:	75 24                	jne    80256b <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  802547:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80254a:	74 60                	je     8025ac <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  80254c:	8b 03                	mov    (%ebx),%eax
+  80254e:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802551:	75 3b                	jne    80258e <devpipe_read+0x65>
+      if (i > 0)
+  802553:	85 f6                	test   %esi,%esi
+  802555:	75 2d                	jne    802584 <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  802557:	89 da                	mov    %ebx,%edx
+  802559:	89 f8                	mov    %edi,%eax
+  80255b:	e8 14 fd ff ff       	call   802274 <_pipeisclosed>
+  802560:	85 c0                	test   %eax,%eax
+  802562:	75 4c                	jne    8025b0 <devpipe_read+0x87>
+      sys_yield();
+  802564:	e8 4f e6 ff ff       	call   800bb8 <sys_yield>
+  802569:	eb e1                	jmp    80254c <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  80256b:	83 ec 08             	sub    $0x8,%esp
+  80256e:	6a 00                	push   $0x0
+  802570:	ff 75 10             	push   0x10(%ebp)
+  802573:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802576:	89 c2                	mov    %eax,%edx
+  802578:	89 f8                	mov    %edi,%eax
+  80257a:	e8 c3 fe ff ff       	call   802442 <devpipe_read_bulk>
+  80257f:	83 c4 10             	add    $0x10,%esp
+  802582:	eb 02                	jmp    802586 <devpipe_read+0x5d>
+        return i;
+  802584:	89 f0                	mov    %esi,%eax
+}
+  802586:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802589:	5b                   	pop    %ebx
+  80258a:	5e                   	pop    %esi
+  80258b:	5f                   	pop    %edi
+  80258c:	5d                   	pop    %ebp
+  80258d:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80258e:	99                   	cltd
+  80258f:	c1 ea 1b             	shr    $0x1b,%edx
+  802592:	01 d0                	add    %edx,%eax
+  802594:	83 e0 1f             	and    $0x1f,%eax
+  802597:	29 d0                	sub    %edx,%eax
+  802599:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  80259e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8025a1:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  8025a4:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  8025a7:	83 c6 01             	add    $0x1,%esi
+  8025aa:	eb 9b                	jmp    802547 <devpipe_read+0x1e>
+  return i;
+  8025ac:	89 f0                	mov    %esi,%eax
+  8025ae:	eb d6                	jmp    802586 <devpipe_read+0x5d>
+        return 0;
+  8025b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025b5:	eb cf                	jmp    802586 <devpipe_read+0x5d>
+
+008025b7 <pipe2>:
+{
+  8025b7:	55                   	push   %ebp
+  8025b8:	89 e5                	mov    %esp,%ebp
+  8025ba:	57                   	push   %edi
+  8025bb:	56                   	push   %esi
+  8025bc:	53                   	push   %ebx
+  8025bd:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  8025c0:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8025c3:	50                   	push   %eax
+  8025c4:	e8 91 eb ff ff       	call   80115a <fd_alloc>
+  8025c9:	89 c3                	mov    %eax,%ebx
+  8025cb:	83 c4 10             	add    $0x10,%esp
+  8025ce:	85 c0                	test   %eax,%eax
+  8025d0:	0f 88 fb 01 00 00    	js     8027d1 <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8025d6:	83 ec 04             	sub    $0x4,%esp
+  8025d9:	68 07 04 00 00       	push   $0x407
+  8025de:	ff 75 e4             	push   -0x1c(%ebp)
+  8025e1:	6a 00                	push   $0x0
+  8025e3:	e8 32 e6 ff ff       	call   800c1a <sys_page_alloc>
+  8025e8:	89 c3                	mov    %eax,%ebx
+  8025ea:	83 c4 10             	add    $0x10,%esp
+  8025ed:	85 c0                	test   %eax,%eax
+  8025ef:	0f 88 dc 01 00 00    	js     8027d1 <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  8025f5:	83 ec 0c             	sub    $0xc,%esp
+  8025f8:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8025fb:	50                   	push   %eax
+  8025fc:	e8 59 eb ff ff       	call   80115a <fd_alloc>
+  802601:	89 c3                	mov    %eax,%ebx
+  802603:	83 c4 10             	add    $0x10,%esp
+  802606:	85 c0                	test   %eax,%eax
+  802608:	0f 88 b3 01 00 00    	js     8027c1 <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80260e:	83 ec 04             	sub    $0x4,%esp
+  802611:	68 07 04 00 00       	push   $0x407
+  802616:	ff 75 e0             	push   -0x20(%ebp)
+  802619:	6a 00                	push   $0x0
+  80261b:	e8 fa e5 ff ff       	call   800c1a <sys_page_alloc>
+  802620:	89 c3                	mov    %eax,%ebx
+  802622:	83 c4 10             	add    $0x10,%esp
+  802625:	85 c0                	test   %eax,%eax
+  802627:	0f 88 94 01 00 00    	js     8027c1 <pipe2+0x20a>
+  va = fd2data(fd0);
+  80262d:	83 ec 0c             	sub    $0xc,%esp
+  802630:	ff 75 e4             	push   -0x1c(%ebp)
+  802633:	e8 0e eb ff ff       	call   801146 <fd2data>
+  802638:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80263a:	83 c4 0c             	add    $0xc,%esp
+  80263d:	68 07 04 00 00       	push   $0x407
+  802642:	50                   	push   %eax
+  802643:	6a 00                	push   $0x0
+  802645:	e8 d0 e5 ff ff       	call   800c1a <sys_page_alloc>
+  80264a:	89 c3                	mov    %eax,%ebx
+  80264c:	83 c4 10             	add    $0x10,%esp
+  80264f:	85 c0                	test   %eax,%eax
+  802651:	0f 88 5a 01 00 00    	js     8027b1 <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802657:	83 ec 0c             	sub    $0xc,%esp
+  80265a:	ff 75 e0             	push   -0x20(%ebp)
+  80265d:	e8 e4 ea ff ff       	call   801146 <fd2data>
+  802662:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802669:	50                   	push   %eax
+  80266a:	6a 00                	push   $0x0
+  80266c:	57                   	push   %edi
+  80266d:	6a 00                	push   $0x0
+  80266f:	e8 e9 e5 ff ff       	call   800c5d <sys_page_map>
+  802674:	89 c3                	mov    %eax,%ebx
+  802676:	83 c4 20             	add    $0x20,%esp
+  802679:	85 c0                	test   %eax,%eax
+  80267b:	0f 88 22 01 00 00    	js     8027a3 <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  802681:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  802685:	74 72                	je     8026f9 <pipe2+0x142>
+  802687:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  80268c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80268f:	e8 d3 fa ff ff       	call   802167 <pipe_ring>
+  802694:	83 ec 04             	sub    $0x4,%esp
+  802697:	68 07 04 00 00       	push   $0x407
+  80269c:	01 f0                	add    %esi,%eax
+  80269e:	50                   	push   %eax
+  80269f:	6a 00                	push   $0x0
+  8026a1:	e8 74 e5 ff ff       	call   800c1a <sys_page_alloc>
+  8026a6:	89 c3                	mov    %eax,%ebx
+  8026a8:	83 c4 10             	add    $0x10,%esp
+  8026ab:	85 c0                	test   %eax,%eax
+  8026ad:	0f 88 97 00 00 00    	js     80274a <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  8026b3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8026b6:	e8 ac fa ff ff       	call   802167 <pipe_ring>
+  8026bb:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  8026be:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8026c1:	e8 a1 fa ff ff       	call   802167 <pipe_ring>
+  8026c6:	83 ec 0c             	sub    $0xc,%esp
+  8026c9:	68 07 04 00 00       	push   $0x407
+  8026ce:	53                   	push   %ebx
+  8026cf:	6a 00                	push   $0x0
+  8026d1:	01 f0                	add    %esi,%eax
+  8026d3:	50                   	push   %eax
+  8026d4:	6a 00                	push   $0x0
+  8026d6:	e8 82 e5 ff ff       	call   800c5d <sys_page_map>
+  8026db:	89 c3                	mov    %eax,%ebx
+  8026dd:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8026e3:	83 c4 20             	add    $0x20,%esp
+  8026e6:	85 c0                	test   %eax,%eax
+  8026e8:	78 60                	js     80274a <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  8026ea:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  8026f0:	75 9a                	jne    80268c <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  8026f2:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  8026f9:	a1 20 40 80 00       	mov    0x804020,%eax
+  8026fe:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802701:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  802703:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802706:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  80270d:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802710:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  802712:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802715:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  80271c:	83 ec 0c             	sub    $0xc,%esp
+  80271f:	ff 75 e4             	push   -0x1c(%ebp)
+  802722:	e8 0f ea ff ff       	call   801136 <fd2num>
+  802727:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80272a:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  80272c:	83 c4 04             	add    $0x4,%esp
+  80272f:	ff 75 e0             	push   -0x20(%ebp)
+  802732:	e8 ff e9 ff ff       	call   801136 <fd2num>
+  802737:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80273a:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  80273d:	83 c4 10             	add    $0x10,%esp
+  802740:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802745:	e9 87 00 00 00       	jmp    8027d1 <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  80274a:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  80274f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802752:	e8 10 fa ff ff       	call   802167 <pipe_ring>
+  802757:	83 ec 08             	sub    $0x8,%esp
+  80275a:	01 f0                	add    %esi,%eax
+  80275c:	50                   	push   %eax
+  80275d:	6a 00                	push   $0x0
+  80275f:	e8 3b e5 ff ff       	call   800c9f <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  802764:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802767:	e8 fb f9 ff ff       	call   802167 <pipe_ring>
+  80276c:	83 c4 08             	add    $0x8,%esp
+  80276f:	01 f0                	add    %esi,%eax
+  802771:	50                   	push   %eax
+  802772:	6a 00                	push   $0x0
+  802774:	e8 26 e5 ff ff       	call   800c9f <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802779:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80277f:	83 c4 10             	add    $0x10,%esp
+  802782:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802788:	75 c5                	jne    80274f <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  80278a:	83 ec 0c             	sub    $0xc,%esp
+  80278d:	ff 75 e0             	push   -0x20(%ebp)
+  802790:	e8 b1 e9 ff ff       	call   801146 <fd2data>
+  802795:	83 c4 08             	add    $0x8,%esp
+  802798:	50                   	push   %eax
+  802799:	6a 00                	push   $0x0
+  80279b:	e8 ff e4 ff ff       	call   800c9f <sys_page_unmap>
+  8027a0:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  8027a3:	83 ec 08             	sub    $0x8,%esp
+  8027a6:	57                   	push   %edi
+  8027a7:	6a 00                	push   $0x0
+  8027a9:	e8 f1 e4 ff ff       	call   800c9f <sys_page_unmap>
+  8027ae:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  8027b1:	83 ec 08             	sub    $0x8,%esp
+  8027b4:	ff 75 e0             	push   -0x20(%ebp)
+  8027b7:	6a 00                	push   $0x0
+  8027b9:	e8 e1 e4 ff ff       	call   800c9f <sys_page_unmap>
+  8027be:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  8027c1:	83 ec 08             	sub    $0x8,%esp
+  8027c4:	ff 75 e4             	push   -0x1c(%ebp)
+  8027c7:	6a 00                	push   $0x0
+  8027c9:	e8 d1 e4 ff ff       	call   800c9f <sys_page_unmap>
+  8027ce:	83 c4 10             	add    $0x10,%esp
+}
+  8027d1:	89 d8                	mov    %ebx,%eax
+  8027d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027d6:	5b                   	pop    %ebx
+  8027d7:	5e                   	pop    %esi
+  8027d8:	5f                   	pop    %edi
+  8027d9:	5d                   	pop    %ebp
+  8027da:	c3                   	ret
+
+008027db <pipe>:
+{
+  8027db:	55                   	push   %ebp
+  8027dc:	89 e5                	mov    %esp,%ebp
+  8027de:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  8027e1:	6a 00                	push   $0x0
+  8027e3:	ff 75 08             	push   0x8(%ebp)
+  8027e6:	e8 cc fd ff ff       	call   8025b7 <pipe2>
+}
+  8027eb:	c9                   	leave
+  8027ec:	c3                   	ret
+
+008027ed <pipeisclosed>:
+{
+  8027ed:	55                   	push   %ebp
+  8027ee:	89 e5                	mov    %esp,%ebp
+  8027f0:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8027f3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8027f6:	50                   	push   %eax
+  8027f7:	ff 75 08             	push   0x8(%ebp)
+  8027fa:	e8 b1 e9 ff ff       	call   8011b0 <fd_lookup>
+  8027ff:	83 c4 10             	add    $0x10,%esp
+  802802:	85 c0                	test   %eax,%eax
+  802804:	78 18                	js     80281e <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  802806:	83 ec 0c             	sub    $0xc,%esp
+  802809:	ff 75 f4             	push   -0xc(%ebp)
+  80280c:	e8 35 e9 ff ff       	call   801146 <fd2data>
+  802811:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  802813:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802816:	e8 59 fa ff ff       	call   802274 <_pipeisclosed>
+  80281b:	83 c4 10             	add    $0x10,%esp
+}
+  80281e:	c9                   	leave
+  80281f:	c3                   	ret
+
+00802820 <pipe_splice>:
+{
+  802820:	55                   	push   %ebp
+  802821:	89 e5                	mov    %esp,%ebp
+  802823:	57                   	push   %edi
+  802824:	56                   	push   %esi
+  802825:	53                   	push   %ebx
+  802826:	83 ec 34             	sub    $0x34,%esp
+  802829:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80282c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80282f:	50                   	push   %eax
+  802830:	ff 75 08             	push   0x8(%ebp)
+  802833:	e8 78 e9 ff ff       	call   8011b0 <fd_lookup>
+  802838:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80283b:	83 c4 10             	add    $0x10,%esp
+  80283e:	85 c0                	test   %eax,%eax
+  802840:	0f 88 d7 00 00 00    	js     80291d <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  802846:	83 ec 0c             	sub    $0xc,%esp
+  802849:	ff 75 e4             	push   -0x1c(%ebp)
+  80284c:	e8 f5 e8 ff ff       	call   801146 <fd2data>
+  802851:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802853:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802856:	83 c4 10             	add    $0x10,%esp
+  802859:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  80285f:	39 10                	cmp    %edx,(%eax)
+  802861:	0f 85 c1 00 00 00    	jne    802928 <pipe_splice+0x108>
+  802867:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  80286b:	0f 84 c0 00 00 00    	je     802931 <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  802871:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802875:	0f 84 bf 00 00 00    	je     80293a <pipe_splice+0x11a>
+  80287b:	89 f7                	mov    %esi,%edi
+  80287d:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  802883:	0f 85 ba 00 00 00    	jne    802943 <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802889:	8d 43 04             	lea    0x4(%ebx),%eax
+  80288c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80288f:	eb 38                	jmp    8028c9 <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802891:	83 ec 0c             	sub    $0xc,%esp
+  802894:	68 00 10 00 00       	push   $0x1000
+  802899:	89 f1                	mov    %esi,%ecx
+  80289b:	89 da                	mov    %ebx,%edx
+  80289d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8028a0:	e8 34 fa ff ff       	call   8022d9 <devpipe_write_bulk>
+  8028a5:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8028a8:	83 c4 10             	add    $0x10,%esp
+  8028ab:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8028b0:	75 53                	jne    802905 <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  8028b2:	83 ec 08             	sub    $0x8,%esp
+  8028b5:	56                   	push   %esi
+  8028b6:	6a 00                	push   $0x0
+  8028b8:	e8 e2 e3 ff ff       	call   800c9f <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  8028bd:	83 c7 01             	add    $0x1,%edi
+  8028c0:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8028c6:	83 c4 10             	add    $0x10,%esp
+  8028c9:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8028cc:	74 3a                	je     802908 <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  8028ce:	8b 03                	mov    (%ebx),%eax
+  8028d0:	39 43 04             	cmp    %eax,0x4(%ebx)
+  8028d3:	75 bc                	jne    802891 <pipe_splice+0x71>
+  8028d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028da:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  8028de:	85 c0                	test   %eax,%eax
+  8028e0:	74 af                	je     802891 <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  8028e2:	83 ec 04             	sub    $0x4,%esp
+  8028e5:	6a 07                	push   $0x7
+  8028e7:	56                   	push   %esi
+  8028e8:	ff 75 d0             	push   -0x30(%ebp)
+  8028eb:	e8 86 e6 ff ff       	call   800f76 <sys_chan_wakeup>
+  8028f0:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8028f3:	83 c4 10             	add    $0x10,%esp
+  8028f6:	85 c0                	test   %eax,%eax
+  8028f8:	79 b8                	jns    8028b2 <pipe_splice+0x92>
+  8028fa:	b8 01 00 00 00       	mov    $0x1,%eax
+  8028ff:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802903:	eb 8c                	jmp    802891 <pipe_splice+0x71>
+  802905:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  802908:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80290c:	75 06                	jne    802914 <pipe_splice+0xf4>
+  80290e:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802912:	78 09                	js     80291d <pipe_splice+0xfd>
+  return i * PGSIZE;
+  802914:	8b 45 10             	mov    0x10(%ebp),%eax
+  802917:	c1 e0 0c             	shl    $0xc,%eax
+  80291a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  80291d:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802920:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802923:	5b                   	pop    %ebx
+  802924:	5e                   	pop    %esi
+  802925:	5f                   	pop    %edi
+  802926:	5d                   	pop    %ebp
+  802927:	c3                   	ret
+    return -E_INVAL;
+  802928:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  80292f:	eb ec                	jmp    80291d <pipe_splice+0xfd>
+  802931:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802938:	eb e3                	jmp    80291d <pipe_splice+0xfd>
+  80293a:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802941:	eb da                	jmp    80291d <pipe_splice+0xfd>
+  802943:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  80294a:	eb d1                	jmp    80291d <pipe_splice+0xfd>
+
+0080294c <pipe_splice_read>:
+{
+  80294c:	55                   	push   %ebp
+  80294d:	89 e5                	mov    %esp,%ebp
+  80294f:	53                   	push   %ebx
+  802950:	83 ec 1c             	sub    $0x1c,%esp
+  802953:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802956:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802959:	50                   	push   %eax
+  80295a:	ff 75 08             	push   0x8(%ebp)
+  80295d:	e8 4e e8 ff ff       	call   8011b0 <fd_lookup>
+  802962:	83 c4 10             	add    $0x10,%esp
+  802965:	85 c0                	test   %eax,%eax
+  802967:	78 49                	js     8029b2 <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  802969:	83 ec 0c             	sub    $0xc,%esp
+  80296c:	ff 75 f4             	push   -0xc(%ebp)
+  80296f:	e8 d2 e7 ff ff       	call   801146 <fd2data>
+  802974:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802976:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802979:	83 c4 10             	add    $0x10,%esp
+  80297c:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  802982:	39 08                	cmp    %ecx,(%eax)
+  802984:	75 31                	jne    8029b7 <pipe_splice_read+0x6b>
+  802986:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  80298a:	74 32                	je     8029be <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  80298c:	8b 48 08             	mov    0x8(%eax),%ecx
+  80298f:	83 e1 03             	and    $0x3,%ecx
+  802992:	83 f9 01             	cmp    $0x1,%ecx
+  802995:	74 2e                	je     8029c5 <pipe_splice_read+0x79>
+  802997:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  80299d:	75 2d                	jne    8029cc <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  80299f:	83 ec 08             	sub    $0x8,%esp
+  8029a2:	53                   	push   %ebx
+  8029a3:	68 00 10 00 00       	push   $0x1000
+  8029a8:	89 d9                	mov    %ebx,%ecx
+  8029aa:	e8 93 fa ff ff       	call   802442 <devpipe_read_bulk>
+  8029af:	83 c4 10             	add    $0x10,%esp
+}
+  8029b2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8029b5:	c9                   	leave
+  8029b6:	c3                   	ret
+    return -E_INVAL;
+  8029b7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8029bc:	eb f4                	jmp    8029b2 <pipe_splice_read+0x66>
+  8029be:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8029c3:	eb ed                	jmp    8029b2 <pipe_splice_read+0x66>
+  8029c5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8029ca:	eb e6                	jmp    8029b2 <pipe_splice_read+0x66>
+  8029cc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8029d1:	eb df                	jmp    8029b2 <pipe_splice_read+0x66>
+
+008029d3 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  8029d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029d8:	c3                   	ret
+
+008029d9 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8029d9:	55                   	push   %ebp
+  8029da:	89 e5                	mov    %esp,%ebp
+  8029dc:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  8029df:	68 27 34 80 00       	push   $0x803427
+  8029e4:	ff 75 0c             	push   0xc(%ebp)
+  8029e7:	e8 ff dd ff ff       	call   8007eb <strcpy>
+  return 0;
+}
+  8029ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029f1:	c9                   	leave
+  8029f2:	c3                   	ret
+
+008029f3 <devcons_write>:
+{
+  8029f3:	55                   	push   %ebp
+  8029f4:	89 e5                	mov    %esp,%ebp
+  8029f6:	57                   	push   %edi
+  8029f7:	56                   	push   %esi
+  8029f8:	53                   	push   %ebx
+  8029f9:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  8029ff:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  802a04:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  802a0a:	eb 2e                	jmp    802a3a <devcons_write+0x47>
+    m = n - tot;
+  802a0c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802a0f:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  802a11:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802a16:	39 c3                	cmp    %eax,%ebx
+  802a18:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  802a1b:	83 ec 04             	sub    $0x4,%esp
+  802a1e:	53                   	push   %ebx
+  802a1f:	89 f0                	mov    %esi,%eax
+  802a21:	03 45 0c             	add    0xc(%ebp),%eax
+  802a24:	50                   	push   %eax
+  802a25:	57                   	push   %edi
+  802a26:	e8 46 df ff ff       	call   800971 <memmove>
+    sys_cputs(buf, m);
+  802a2b:	83 c4 08             	add    $0x8,%esp
+  802a2e:	53                   	push   %ebx
+  802a2f:	57                   	push   %edi
+  802a30:	e8 e6 e0 ff ff       	call   800b1b <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  802a35:	01 de                	add    %ebx,%esi
+  802a37:	83 c4 10             	add    $0x10,%esp
+  802a3a:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802a3d:	72 cd                	jb     802a0c <devcons_write+0x19>
+}
+  802a3f:	89 f0                	mov    %esi,%eax
+  802a41:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a44:	5b                   	pop    %ebx
+  802a45:	5e                   	pop    %esi
+  802a46:	5f                   	pop    %edi
+  802a47:	5d                   	pop    %ebp
+  802a48:	c3                   	ret
+
+00802a49 <devcons_read>:
+{
+  802a49:	55                   	push   %ebp
+  802a4a:	89 e5                	mov    %esp,%ebp
+  802a4c:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  802a4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a54:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802a58:	75 07                	jne    802a61 <devcons_read+0x18>
+  802a5a:	eb 1f                	jmp    802a7b <devcons_read+0x32>
+    sys_yield();
+  802a5c:	e8 57 e1 ff ff       	call   800bb8 <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  802a61:	e8 d3 e0 ff ff       	call   800b39 <sys_cgetc>
+  802a66:	85 c0                	test   %eax,%eax
+  802a68:	74 f2                	je     802a5c <devcons_read+0x13>
+  if (c < 0)
+  802a6a:	78 0f                	js     802a7b <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  802a6c:	83 f8 04             	cmp    $0x4,%eax
+  802a6f:	74 0c                	je     802a7d <devcons_read+0x34>
+  *(char*)vbuf = c;
+  802a71:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802a74:	88 02                	mov    %al,(%edx)
+  return 1;
+  802a76:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802a7b:	c9                   	leave
+  802a7c:	c3                   	ret
+    return 0;
+  802a7d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a82:	eb f7                	jmp    802a7b <devcons_read+0x32>
+
+00802a84 <cputchar>:
+{
+  802a84:	55                   	push   %ebp
+  802a85:	89 e5                	mov    %esp,%ebp
+  802a87:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  802a8a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a8d:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  802a90:	6a 01                	push   $0x1
+  802a92:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802a95:	50                   	push   %eax
+  802a96:	e8 80 e0 ff ff       	call   800b1b <sys_cputs>
+}
+  802a9b:	83 c4 10             	add    $0x10,%esp
+  802a9e:	c9                   	leave
+  802a9f:	c3                   	ret
+
+00802aa0 <getchar>:
+{
+  802aa0:	55                   	push   %ebp
+  802aa1:	89 e5                	mov    %esp,%ebp
+  802aa3:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  802aa6:	6a 01                	push   $0x1
+  802aa8:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802aab:	50                   	push   %eax
+  802aac:	6a 00                	push   $0x0
+  802aae:	e8 a8 e9 ff ff       	call   80145b <read>
+  if (r < 0)
+  802ab3:	83 c4 10             	add    $0x10,%esp
+  802ab6:	85 c0                	test   %eax,%eax
+  802ab8:	78 06                	js     802ac0 <getchar+0x20>
+  if (r < 1)
+  802aba:	74 06                	je     802ac2 <getchar+0x22>
+  return c;
+  802abc:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802ac0:	c9                   	leave
+  802ac1:	c3                   	ret
+    return -E_EOF;
+  802ac2:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802ac7:	eb f7                	jmp    802ac0 <getchar+0x20>
+
+00802ac9 <iscons>:
+{
+  802ac9:	55                   	push   %ebp
+  802aca:	89 e5                	mov    %esp,%ebp
+  802acc:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802acf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802ad2:	50                   	push   %eax
+  802ad3:	ff 75 08             	push   0x8(%ebp)
+  802ad6:	e8 d5 e6 ff ff       	call   8011b0 <fd_lookup>
+  802adb:	83 c4 10             	add    $0x10,%esp
+  802ade:	85 c0                	test   %eax,%eax
+  802ae0:	78 11                	js     802af3 <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  802ae2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ae5:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802aeb:	39 10                	cmp    %edx,(%eax)
+  802aed:	0f 94 c0             	sete   %al
+  802af0:	0f b6 c0             	movzbl %al,%eax
+}
+  802af3:	c9                   	leave
+  802af4:	c3                   	ret
+
+00802af5 <opencons>:
+{
+  802af5:	55                   	push   %ebp
+  802af6:	89 e5                	mov    %esp,%ebp
+  802af8:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  802afb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802afe:	50                   	push   %eax
+  802aff:	e8 56 e6 ff ff       	call   80115a <fd_alloc>
+  802b04:	83 c4 10             	add    $0x10,%esp
+  802b07:	85 c0                	test   %eax,%eax
+  802b09:	78 3a                	js     802b45 <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802b0b:	83 ec 04             	sub    $0x4,%esp
+  802b0e:	68 07 04 00 00       	push   $0x407
+  802b13:	ff 75 f4             	push   -0xc(%ebp)
+  802b16:	6a 00                	push   $0x0
+  802b18:	e8 fd e0 ff ff       	call   800c1a <sys_page_alloc>
+  802b1d:	83 c4 10             	add    $0x10,%esp
+  802b20:	85 c0                	test   %eax,%eax
+  802b22:	78 21                	js     802b45 <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  802b24:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b27:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802b2d:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  802b2f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b32:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  802b39:	83 ec 0c             	sub    $0xc,%esp
+  802b3c:	50                   	push   %eax
+  802b3d:	e8 f4 e5 ff ff       	call   801136 <fd2num>
+  802b42:	83 c4 10             	add    $0x10,%esp
+}
+  802b45:	c9                   	leave
+  802b46:	c3                   	ret
+
+00802b47 <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  802b47:	55                   	push   %ebp
+  802b48:	89 e5                	mov    %esp,%ebp
+  802b4a:	57                   	push   %edi
+  802b4b:	56                   	push   %esi
+  802b4c:	53                   	push   %ebx
+  802b4d:	83 ec 14             	sub    $0x14,%esp
+  802b50:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802b53:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b56:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802b59:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  802b5c:	85 c0                	test   %eax,%eax
+  802b5e:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802b63:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  802b66:	ff 33                	push   (%ebx)
+  802b68:	50                   	push   %eax
+  802b69:	e8 84 e3 ff ff       	call   800ef2 <sys_ipc_recv>
+  802b6e:	83 c4 10             	add    $0x10,%esp
+  802b71:	85 c0                	test   %eax,%eax
+  802b73:	78 39                	js     802bae <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  802b75:	85 ff                	test   %edi,%edi
+  802b77:	74 0a                	je     802b83 <ipc_recv_pages+0x3c>
+  802b79:	a1 44 57 80 00       	mov    0x805744,%eax
+  802b7e:	8b 40 7c             	mov    0x7c(%eax),%eax
+  802b81:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  802b83:	85 f6                	test   %esi,%esi
+  802b85:	74 0d                	je     802b94 <ipc_recv_pages+0x4d>
+  802b87:	a1 44 57 80 00       	mov    0x805744,%eax
+  802b8c:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  802b92:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  802b94:	a1 44 57 80 00       	mov    0x805744,%eax
+  802b99:	8b 40 74             	mov    0x74(%eax),%eax
+  802b9c:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  802b9e:	a1 44 57 80 00       	mov    0x805744,%eax
+  802ba3:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  802ba6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ba9:	5b                   	pop    %ebx
+  802baa:	5e                   	pop    %esi
+  802bab:	5f                   	pop    %edi
+  802bac:	5d                   	pop    %ebp
+  802bad:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  802bae:	85 ff                	test   %edi,%edi
+  802bb0:	74 06                	je     802bb8 <ipc_recv_pages+0x71>
+  802bb2:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  802bb8:	85 f6                	test   %esi,%esi
+  802bba:	74 06                	je     802bc2 <ipc_recv_pages+0x7b>
+  802bbc:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  802bc2:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  802bc8:	eb dc                	jmp    802ba6 <ipc_recv_pages+0x5f>
+
+00802bca <ipc_recv>:
+{
+  802bca:	55                   	push   %ebp
+  802bcb:	89 e5                	mov    %esp,%ebp
+  802bcd:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  802bd0:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  802bd7:	ff 75 10             	push   0x10(%ebp)
+  802bda:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802bdd:	50                   	push   %eax
+  802bde:	ff 75 0c             	push   0xc(%ebp)
+  802be1:	ff 75 08             	push   0x8(%ebp)
+  802be4:	e8 5e ff ff ff       	call   802b47 <ipc_recv_pages>
+}
+  802be9:	c9                   	leave
+  802bea:	c3                   	ret
+
+00802beb <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  802beb:	55                   	push   %ebp
+  802bec:	89 e5                	mov    %esp,%ebp
+  802bee:	57                   	push   %edi
+  802bef:	56                   	push   %esi
+  802bf0:	53                   	push   %ebx
+  802bf1:	83 ec 0c             	sub    $0xc,%esp
+  802bf4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802bf7:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802bfa:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  802bfd:	89 c3                	mov    %eax,%ebx
+  802bff:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  802c05:	85 c0                	test   %eax,%eax
+  802c07:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802c0c:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  802c0f:	83 ec 0c             	sub    $0xc,%esp
+  802c12:	ff 75 14             	push   0x14(%ebp)
+  802c15:	ff 75 18             	push   0x18(%ebp)
+  802c18:	53                   	push   %ebx
+  802c19:	56                   	push   %esi
+  802c1a:	57                   	push   %edi
+  802c1b:	e8 b1 e2 ff ff       	call   800ed1 <sys_ipc_try_send>
+  802c20:	83 c4 20             	add    $0x20,%esp
+  802c23:	85 c0                	test   %eax,%eax
+  802c25:	79 1e                	jns    802c45 <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  802c27:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802c2a:	75 07                	jne    802c33 <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  802c2c:	e8 87 df ff ff       	call   800bb8 <sys_yield>
+  802c31:	eb dc                	jmp    802c0f <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  802c33:	50                   	push   %eax
+  802c34:	68 33 34 80 00       	push   $0x803433
+  802c39:	6a 5c                	push   $0x5c
+  802c3b:	68 40 34 80 00       	push   $0x803440
+  802c40:	e8 dd d4 ff ff       	call   800122 <_panic>
+  }
+}
+  802c45:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c48:	5b                   	pop    %ebx
+  802c49:	5e                   	pop    %esi
+  802c4a:	5f                   	pop    %edi
+  802c4b:	5d                   	pop    %ebp
+  802c4c:	c3                   	ret
+
+00802c4d <ipc_send>:
+{
+  802c4d:	55                   	push   %ebp
+  802c4e:	89 e5                	mov    %esp,%ebp
+  802c50:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  802c53:	ff 75 14             	push   0x14(%ebp)
+  802c56:	6a 01                	push   $0x1
+  802c58:	ff 75 10             	push   0x10(%ebp)
+  802c5b:	ff 75 0c             	push   0xc(%ebp)
+  802c5e:	ff 75 08             	push   0x8(%ebp)
+  802c61:	e8 85 ff ff ff       	call   802beb <ipc_send_pages>
+}
+  802c66:	83 c4 20             	add    $0x20,%esp
+  802c69:	c9                   	leave
+  802c6a:	c3                   	ret
+
+00802c6b <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802c6b:	55                   	push   %ebp
+  802c6c:	89 e5                	mov    %esp,%ebp
+  802c6e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  802c71:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  802c76:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802c79:	c1 e0 04             	shl    $0x4,%eax
+  802c7c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802c81:	8b 40 50             	mov    0x50(%eax),%eax
+  802c84:	39 c8                	cmp    %ecx,%eax
+  802c86:	74 12                	je     802c9a <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  802c88:	83 c2 01             	add    $0x1,%edx
+  802c8b:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802c91:	75 e3                	jne    802c76 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  802c93:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c98:	eb 0e                	jmp    802ca8 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  802c9a:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802c9d:	c1 e0 04             	shl    $0x4,%eax
+  802ca0:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802ca5:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802ca8:	5d                   	pop    %ebp
+  802ca9:	c3                   	ret
+
+00802caa <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802caa:	55                   	push   %ebp
+  802cab:	89 e5                	mov    %esp,%ebp
+  802cad:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802cb0:	89 c2                	mov    %eax,%edx
+  802cb2:	c1 ea 16             	shr    $0x16,%edx
+  802cb5:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  802cbc:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802cc1:	f6 c1 01             	test   $0x1,%cl
+  802cc4:	74 1c                	je     802ce2 <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  802cc6:	c1 e8 0c             	shr    $0xc,%eax
+  802cc9:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  802cd0:	a8 01                	test   $0x1,%al
+  802cd2:	74 0e                	je     802ce2 <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  802cd4:	c1 e8 0c             	shr    $0xc,%eax
+  802cd7:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802cde:	ef 
+  802cdf:	0f b7 d2             	movzwl %dx,%edx
+}
+  802ce2:	89 d0                	mov    %edx,%eax
+  802ce4:	5d                   	pop    %ebp
+  802ce5:	c3                   	ret
+
+00802ce6 <udivmod>:
+  802ce6:	55                   	push   %ebp
+  802ce7:	57                   	push   %edi
+  802ce8:	56                   	push   %esi
+  802ce9:	53                   	push   %ebx
+  802cea:	83 ec 14             	sub    $0x14,%esp
+  802ced:	8b 74 24 28          	mov    0x28(%esp),%esi
+  802cf1:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  802cf5:	89 fb                	mov    %edi,%ebx
+  802cf7:	09 f3                	or     %esi,%ebx
+  802cf9:	0f 84 88 00 00 00    	je     802d87 <udivmod+0xa1>
+  802cff:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802d04:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802d0b:	00 
+  802d0c:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802d13:	00 
+  802d14:	89 cd                	mov    %ecx,%ebp
+  802d16:	89 34 24             	mov    %esi,(%esp)
+  802d19:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802d1d:	eb 08                	jmp    802d27 <udivmod+0x41>
+  802d1f:	83 ed 01             	sub    $0x1,%ebp
+  802d22:	83 fd ff             	cmp    $0xffffffff,%ebp
+  802d25:	74 6c                	je     802d93 <udivmod+0xad>
+  802d27:	89 c3                	mov    %eax,%ebx
+  802d29:	89 d6                	mov    %edx,%esi
+  802d2b:	89 e9                	mov    %ebp,%ecx
+  802d2d:	0f ad f3             	shrd   %cl,%esi,%ebx
+  802d30:	d3 ee                	shr    %cl,%esi
+  802d32:	f6 c1 20             	test   $0x20,%cl
+  802d35:	74 04                	je     802d3b <udivmod+0x55>
+  802d37:	89 f3                	mov    %esi,%ebx
+  802d39:	31 f6                	xor    %esi,%esi
+  802d3b:	8b 3c 24             	mov    (%esp),%edi
+  802d3e:	39 fb                	cmp    %edi,%ebx
+  802d40:	89 f7                	mov    %esi,%edi
+  802d42:	8b 1c 24             	mov    (%esp),%ebx
+  802d45:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802d49:	19 f7                	sbb    %esi,%edi
+  802d4b:	72 d2                	jb     802d1f <udivmod+0x39>
+  802d4d:	89 f7                	mov    %esi,%edi
+  802d4f:	89 de                	mov    %ebx,%esi
+  802d51:	89 e9                	mov    %ebp,%ecx
+  802d53:	0f a5 f7             	shld   %cl,%esi,%edi
+  802d56:	d3 e6                	shl    %cl,%esi
+  802d58:	f6 c1 20             	test   $0x20,%cl
+  802d5b:	74 04                	je     802d61 <udivmod+0x7b>
+  802d5d:	89 f7                	mov    %esi,%edi
+  802d5f:	31 f6                	xor    %esi,%esi
+  802d61:	29 f0                	sub    %esi,%eax
+  802d63:	19 fa                	sbb    %edi,%edx
+  802d65:	be 01 00 00 00       	mov    $0x1,%esi
+  802d6a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d6f:	0f a5 f7             	shld   %cl,%esi,%edi
+  802d72:	d3 e6                	shl    %cl,%esi
+  802d74:	f6 c1 20             	test   $0x20,%cl
+  802d77:	74 04                	je     802d7d <udivmod+0x97>
+  802d79:	89 f7                	mov    %esi,%edi
+  802d7b:	31 f6                	xor    %esi,%esi
+  802d7d:	09 74 24 08          	or     %esi,0x8(%esp)
+  802d81:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802d85:	eb 98                	jmp    802d1f <udivmod+0x39>
+  802d87:	89 f0                	mov    %esi,%eax
+  802d89:	89 fa                	mov    %edi,%edx
+  802d8b:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802d8f:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802d93:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802d97:	89 01                	mov    %eax,(%ecx)
+  802d99:	89 51 04             	mov    %edx,0x4(%ecx)
+  802d9c:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802da0:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802da4:	83 c4 14             	add    $0x14,%esp
+  802da7:	5b                   	pop    %ebx
+  802da8:	5e                   	pop    %esi
+  802da9:	5f                   	pop    %edi
+  802daa:	5d                   	pop    %ebp
+  802dab:	c3                   	ret
+
+00802dac <__udivdi3>:
+  802dac:	83 ec 18             	sub    $0x18,%esp
+  802daf:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802db3:	50                   	push   %eax
+  802db4:	ff 74 24 2c          	push   0x2c(%esp)
+  802db8:	ff 74 24 2c          	push   0x2c(%esp)
+  802dbc:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802dc0:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802dc4:	e8 1d ff ff ff       	call   802ce6 <udivmod>
+  802dc9:	83 c4 24             	add    $0x24,%esp
+  802dcc:	c3                   	ret
+
+00802dcd <__umoddi3>:
+  802dcd:	83 ec 18             	sub    $0x18,%esp
+  802dd0:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802dd4:	50                   	push   %eax
+  802dd5:	ff 74 24 2c          	push   0x2c(%esp)
+  802dd9:	ff 74 24 2c          	push   0x2c(%esp)
+  802ddd:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802de1:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802de5:	e8 fc fe ff ff       	call   802ce6 <udivmod>
+  802dea:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802dee:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802df2:	83 c4 24             	add    $0x24,%esp
+  802df5:	c3                   	ret
+
+00802df6 <__divdi3>:
+  802df6:	56                   	push   %esi
+  802df7:	53                   	push   %ebx
+  802df8:	83 ec 14             	sub    $0x14,%esp
+  802dfb:	8b 44 24 20          	mov    0x20(%esp),%eax
+  802dff:	8b 54 24 24          	mov    0x24(%esp),%edx
+  802e03:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  802e07:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  802e0b:	85 d2                	test   %edx,%edx
+  802e0d:	78 18                	js     802e27 <__divdi3+0x31>
+  802e0f:	85 db                	test   %ebx,%ebx
+  802e11:	78 3e                	js     802e51 <__divdi3+0x5b>
+  802e13:	83 ec 04             	sub    $0x4,%esp
+  802e16:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802e1a:	56                   	push   %esi
+  802e1b:	53                   	push   %ebx
+  802e1c:	51                   	push   %ecx
+  802e1d:	e8 c4 fe ff ff       	call   802ce6 <udivmod>
+  802e22:	83 c4 10             	add    $0x10,%esp
+  802e25:	eb 24                	jmp    802e4b <__divdi3+0x55>
+  802e27:	f7 d8                	neg    %eax
+  802e29:	83 d2 00             	adc    $0x0,%edx
+  802e2c:	f7 da                	neg    %edx
+  802e2e:	85 db                	test   %ebx,%ebx
+  802e30:	78 3a                	js     802e6c <__divdi3+0x76>
+  802e32:	83 ec 04             	sub    $0x4,%esp
+  802e35:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802e39:	56                   	push   %esi
+  802e3a:	53                   	push   %ebx
+  802e3b:	51                   	push   %ecx
+  802e3c:	e8 a5 fe ff ff       	call   802ce6 <udivmod>
+  802e41:	83 c4 10             	add    $0x10,%esp
+  802e44:	f7 d8                	neg    %eax
+  802e46:	83 d2 00             	adc    $0x0,%edx
+  802e49:	f7 da                	neg    %edx
+  802e4b:	83 c4 14             	add    $0x14,%esp
+  802e4e:	5b                   	pop    %ebx
+  802e4f:	5e                   	pop    %esi
+  802e50:	c3                   	ret
+  802e51:	83 ec 04             	sub    $0x4,%esp
+  802e54:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802e58:	56                   	push   %esi
+  802e59:	f7 d9                	neg    %ecx
+  802e5b:	83 d3 00             	adc    $0x0,%ebx
+  802e5e:	f7 db                	neg    %ebx
+  802e60:	53                   	push   %ebx
+  802e61:	51                   	push   %ecx
+  802e62:	e8 7f fe ff ff       	call   802ce6 <udivmod>
+  802e67:	83 c4 10             	add    $0x10,%esp
+  802e6a:	eb d8                	jmp    802e44 <__divdi3+0x4e>
+  802e6c:	83 ec 04             	sub    $0x4,%esp
+  802e6f:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802e73:	56                   	push   %esi
+  802e74:	f7 d9                	neg    %ecx
+  802e76:	83 d3 00             	adc    $0x0,%ebx
+  802e79:	f7 db                	neg    %ebx
+  802e7b:	53                   	push   %ebx
+  802e7c:	51                   	push   %ecx
+  802e7d:	e8 64 fe ff ff       	call   802ce6 <udivmod>
+  802e82:	83 c4 10             	add    $0x10,%esp
+  802e85:	eb c4                	jmp    802e4b <__divdi3+0x55>
+
+00802e87 <__moddi3>:
+  802e87:	55                   	push   %ebp
+  802e88:	57                   	push   %edi
+  802e89:	56                   	push   %esi
+  802e8a:	53                   	push   %ebx
+  802e8b:	83 ec 24             	sub    $0x24,%esp
+  802e8e:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802e92:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802e96:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  802e9a:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  802e9e:	85 d2                	test   %edx,%edx
+  802ea0:	78 3b                	js     802edd <__moddi3+0x56>
+  802ea2:	83 ec 04             	sub    $0x4,%esp
+  802ea5:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  802ea9:	56                   	push   %esi
+  802eaa:	89 ce                	mov    %ecx,%esi
+  802eac:	f7 de                	neg    %esi
+  802eae:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802eb2:	89 de                	mov    %ebx,%esi
+  802eb4:	83 d6 00             	adc    $0x0,%esi
+  802eb7:	f7 de                	neg    %esi
+  802eb9:	89 74 24 14          	mov    %esi,0x14(%esp)
+  802ebd:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802ec1:	0f 48 f1             	cmovs  %ecx,%esi
+  802ec4:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  802ec9:	53                   	push   %ebx
+  802eca:	56                   	push   %esi
+  802ecb:	e8 16 fe ff ff       	call   802ce6 <udivmod>
+  802ed0:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802ed4:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802ed8:	83 c4 10             	add    $0x10,%esp
+  802edb:	eb 47                	jmp    802f24 <__moddi3+0x9d>
+  802edd:	f7 d8                	neg    %eax
+  802edf:	83 d2 00             	adc    $0x0,%edx
+  802ee2:	f7 da                	neg    %edx
+  802ee4:	83 ec 04             	sub    $0x4,%esp
+  802ee7:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  802eeb:	56                   	push   %esi
+  802eec:	89 cf                	mov    %ecx,%edi
+  802eee:	f7 df                	neg    %edi
+  802ef0:	89 de                	mov    %ebx,%esi
+  802ef2:	83 d6 00             	adc    $0x0,%esi
+  802ef5:	f7 de                	neg    %esi
+  802ef7:	0f 49 cf             	cmovns %edi,%ecx
+  802efa:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802efe:	0f 49 de             	cmovns %esi,%ebx
+  802f01:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  802f05:	ff 74 24 0c          	push   0xc(%esp)
+  802f09:	ff 74 24 0c          	push   0xc(%esp)
+  802f0d:	e8 d4 fd ff ff       	call   802ce6 <udivmod>
+  802f12:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802f16:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802f1a:	f7 d8                	neg    %eax
+  802f1c:	83 d2 00             	adc    $0x0,%edx
+  802f1f:	f7 da                	neg    %edx
+  802f21:	83 c4 10             	add    $0x10,%esp
+  802f24:	83 c4 24             	add    $0x24,%esp
+  802f27:	5b                   	pop    %ebx
+  802f28:	5e                   	pop    %esi
+  802f29:	5f                   	pop    %edi
+  802f2a:	5d                   	pop    %ebp
+  802f2b:	c3                   	ret
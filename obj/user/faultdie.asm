@@ -0,0 +1,6496 @@
+
+obj/user/faultdie.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 4f 00 00 00       	call   800080 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <handler>:
+
+#include <inc/lib.h>
+
+void
+handler(struct UTrapframe *utf)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 0c             	sub    $0xc,%esp
+  800039:	8b 55 08             	mov    0x8(%ebp),%edx
+  void *addr = (void*)utf->utf_fault_va;
+  uint32_t err = utf->utf_err;
+
+  cprintf("i faulted at va %x, err %x\n", addr, err & 7);
+  80003c:	8b 42 04             	mov    0x4(%edx),%eax
+  80003f:	83 e0 07             	and    $0x7,%eax
+  800042:	50                   	push   %eax
+  800043:	ff 32                	push   (%edx)
+  800045:	68 00 2f 80 00       	push   $0x802f00
+  80004a:	e8 33 01 00 00       	call   800182 <cprintf>
+  sys_env_destroy(sys_getenvid());
+  80004f:	e8 ca 0a 00 00       	call   800b1e <sys_getenvid>
+  800054:	89 04 24             	mov    %eax,(%esp)
+  800057:	e8 81 0a 00 00       	call   800add <sys_env_destroy>
+}
+  80005c:	83 c4 10             	add    $0x10,%esp
+  80005f:	c9                   	leave
+  800060:	c3                   	ret
+
+00800061 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800061:	55                   	push   %ebp
+  800062:	89 e5                	mov    %esp,%ebp
+  800064:	83 ec 14             	sub    $0x14,%esp
+  set_pgfault_handler(handler);
+  800067:	68 33 00 80 00       	push   $0x800033
+  80006c:	e8 dd 0f 00 00       	call   80104e <set_pgfault_handler>
+  *(int*)0xDeadBeef = 0;
+  800071:	c7 05 ef be ad de 00 	movl   $0x0,0xdeadbeef
+  800078:	00 00 00 
+}
+  80007b:	83 c4 10             	add    $0x10,%esp
+  80007e:	c9                   	leave
+  80007f:	c3                   	ret
+
+00800080 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800080:	55                   	push   %ebp
+  800081:	89 e5                	mov    %esp,%ebp
+  800083:	56                   	push   %esi
+  800084:	53                   	push   %ebx
+  800085:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800088:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  80008b:	c7 05 44 57 80 00 00 	movl   $0x0,0x805744
+  800092:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  800095:	e8 84 0a 00 00       	call   800b1e <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  80009a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80009f:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8000a2:	c1 e0 04             	shl    $0x4,%eax
+  8000a5:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000aa:	a3 44 57 80 00       	mov    %eax,0x805744
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8000af:	85 db                	test   %ebx,%ebx
+  8000b1:	7e 07                	jle    8000ba <libmain+0x3a>
+    binaryname = argv[0];
+  8000b3:	8b 06                	mov    (%esi),%eax
+  8000b5:	a3 00 40 80 00       	mov    %eax,0x804000
+
+  // call user main routine
+  umain(argc, argv);
+  8000ba:	83 ec 08             	sub    $0x8,%esp
+  8000bd:	56                   	push   %esi
+  8000be:	53                   	push   %ebx
+  8000bf:	e8 9d ff ff ff       	call   800061 <umain>
+
+  // exit gracefully
+  exit();
+  8000c4:	e8 0a 00 00 00       	call   8000d3 <exit>
+}
+  8000c9:	83 c4 10             	add    $0x10,%esp
+  8000cc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000cf:	5b                   	pop    %ebx
+  8000d0:	5e                   	pop    %esi
+  8000d1:	5d                   	pop    %ebp
+  8000d2:	c3                   	ret
+
+008000d3 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000d3:	55                   	push   %ebp
+  8000d4:	89 e5                	mov    %esp,%ebp
+  8000d6:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  8000d9:	e8 a7 11 00 00       	call   801285 <close_all>
+  sys_env_destroy(0);
+  8000de:	83 ec 0c             	sub    $0xc,%esp
+  8000e1:	6a 00                	push   $0x0
+  8000e3:	e8 f5 09 00 00       	call   800add <sys_env_destroy>
+}
+  8000e8:	83 c4 10             	add    $0x10,%esp
+  8000eb:	c9                   	leave
+  8000ec:	c3                   	ret
+
+008000ed <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8000ed:	55                   	push   %ebp
+  8000ee:	89 e5                	mov    %esp,%ebp
+  8000f0:	53                   	push   %ebx
+  8000f1:	83 ec 04             	sub    $0x4,%esp
+  8000f4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  8000f7:	8b 13                	mov    (%ebx),%edx
+  8000f9:	8d 42 01             	lea    0x1(%edx),%eax
+  8000fc:	89 03                	mov    %eax,(%ebx)
+  8000fe:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800101:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  800105:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80010a:	74 09                	je     800115 <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  80010c:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800110:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800113:	c9                   	leave
+  800114:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  800115:	83 ec 08             	sub    $0x8,%esp
+  800118:	68 ff 00 00 00       	push   $0xff
+  80011d:	8d 43 08             	lea    0x8(%ebx),%eax
+  800120:	50                   	push   %eax
+  800121:	e8 7a 09 00 00       	call   800aa0 <sys_cputs>
+    b->idx = 0;
+  800126:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80012c:	83 c4 10             	add    $0x10,%esp
+  80012f:	eb db                	jmp    80010c <putch+0x1f>
+
+00800131 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800131:	55                   	push   %ebp
+  800132:	89 e5                	mov    %esp,%ebp
+  800134:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  80013a:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800141:	00 00 00 
+  b.cnt = 0;
+  800144:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80014b:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  80014e:	ff 75 0c             	push   0xc(%ebp)
+  800151:	ff 75 08             	push   0x8(%ebp)
+  800154:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80015a:	50                   	push   %eax
+  80015b:	68 ed 00 80 00       	push   $0x8000ed
+  800160:	e8 14 01 00 00       	call   800279 <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  800165:	83 c4 08             	add    $0x8,%esp
+  800168:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80016e:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800174:	50                   	push   %eax
+  800175:	e8 26 09 00 00       	call   800aa0 <sys_cputs>
+
+  return b.cnt;
+}
+  80017a:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800180:	c9                   	leave
+  800181:	c3                   	ret
+
+00800182 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800182:	55                   	push   %ebp
+  800183:	89 e5                	mov    %esp,%ebp
+  800185:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  800188:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  80018b:	50                   	push   %eax
+  80018c:	ff 75 08             	push   0x8(%ebp)
+  80018f:	e8 9d ff ff ff       	call   800131 <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  800194:	c9                   	leave
+  800195:	c3                   	ret
+
+00800196 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  800196:	55                   	push   %ebp
+  800197:	89 e5                	mov    %esp,%ebp
+  800199:	57                   	push   %edi
+  80019a:	56                   	push   %esi
+  80019b:	53                   	push   %ebx
+  80019c:	83 ec 1c             	sub    $0x1c,%esp
+  80019f:	89 c7                	mov    %eax,%edi
+  8001a1:	89 d6                	mov    %edx,%esi
+  8001a3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001a6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8001a9:	89 d1                	mov    %edx,%ecx
+  8001ab:	89 c2                	mov    %eax,%edx
+  8001ad:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001b0:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001b3:	8b 45 10             	mov    0x10(%ebp),%eax
+  8001b6:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  8001b9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001bc:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8001c3:	39 c2                	cmp    %eax,%edx
+  8001c5:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8001c8:	72 3e                	jb     800208 <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  8001ca:	83 ec 0c             	sub    $0xc,%esp
+  8001cd:	ff 75 18             	push   0x18(%ebp)
+  8001d0:	83 eb 01             	sub    $0x1,%ebx
+  8001d3:	53                   	push   %ebx
+  8001d4:	50                   	push   %eax
+  8001d5:	83 ec 08             	sub    $0x8,%esp
+  8001d8:	ff 75 e4             	push   -0x1c(%ebp)
+  8001db:	ff 75 e0             	push   -0x20(%ebp)
+  8001de:	ff 75 dc             	push   -0x24(%ebp)
+  8001e1:	ff 75 d8             	push   -0x28(%ebp)
+  8001e4:	e8 8e 2b 00 00       	call   802d77 <__udivdi3>
+  8001e9:	83 c4 18             	add    $0x18,%esp
+  8001ec:	52                   	push   %edx
+  8001ed:	50                   	push   %eax
+  8001ee:	89 f2                	mov    %esi,%edx
+  8001f0:	89 f8                	mov    %edi,%eax
+  8001f2:	e8 9f ff ff ff       	call   800196 <printnum>
+  8001f7:	83 c4 20             	add    $0x20,%esp
+  8001fa:	eb 13                	jmp    80020f <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  8001fc:	83 ec 08             	sub    $0x8,%esp
+  8001ff:	56                   	push   %esi
+  800200:	ff 75 18             	push   0x18(%ebp)
+  800203:	ff d7                	call   *%edi
+  800205:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  800208:	83 eb 01             	sub    $0x1,%ebx
+  80020b:	85 db                	test   %ebx,%ebx
+  80020d:	7f ed                	jg     8001fc <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  80020f:	83 ec 08             	sub    $0x8,%esp
+  800212:	56                   	push   %esi
+  800213:	83 ec 04             	sub    $0x4,%esp
+  800216:	ff 75 e4             	push   -0x1c(%ebp)
+  800219:	ff 75 e0             	push   -0x20(%ebp)
+  80021c:	ff 75 dc             	push   -0x24(%ebp)
+  80021f:	ff 75 d8             	push   -0x28(%ebp)
+  800222:	e8 71 2b 00 00       	call   802d98 <__umoddi3>
+  800227:	83 c4 14             	add    $0x14,%esp
+  80022a:	0f be 80 26 2f 80 00 	movsbl 0x802f26(%eax),%eax
+  800231:	50                   	push   %eax
+  800232:	ff d7                	call   *%edi
+}
+  800234:	83 c4 10             	add    $0x10,%esp
+  800237:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80023a:	5b                   	pop    %ebx
+  80023b:	5e                   	pop    %esi
+  80023c:	5f                   	pop    %edi
+  80023d:	5d                   	pop    %ebp
+  80023e:	c3                   	ret
+
+0080023f <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80023f:	55                   	push   %ebp
+  800240:	89 e5                	mov    %esp,%ebp
+  800242:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  800245:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  800249:	8b 10                	mov    (%eax),%edx
+  80024b:	3b 50 04             	cmp    0x4(%eax),%edx
+  80024e:	73 0a                	jae    80025a <sprintputch+0x1b>
+    *b->buf++ = ch;
+  800250:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800253:	89 08                	mov    %ecx,(%eax)
+  800255:	8b 45 08             	mov    0x8(%ebp),%eax
+  800258:	88 02                	mov    %al,(%edx)
+}
+  80025a:	5d                   	pop    %ebp
+  80025b:	c3                   	ret
+
+0080025c <printfmt>:
+{
+  80025c:	55                   	push   %ebp
+  80025d:	89 e5                	mov    %esp,%ebp
+  80025f:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  800262:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  800265:	50                   	push   %eax
+  800266:	ff 75 10             	push   0x10(%ebp)
+  800269:	ff 75 0c             	push   0xc(%ebp)
+  80026c:	ff 75 08             	push   0x8(%ebp)
+  80026f:	e8 05 00 00 00       	call   800279 <vprintfmt>
+}
+  800274:	83 c4 10             	add    $0x10,%esp
+  800277:	c9                   	leave
+  800278:	c3                   	ret
+
+00800279 <vprintfmt>:
+{
+  800279:	55                   	push   %ebp
+  80027a:	89 e5                	mov    %esp,%ebp
+  80027c:	57                   	push   %edi
+  80027d:	56                   	push   %esi
+  80027e:	53                   	push   %ebx
+  80027f:	83 ec 2c             	sub    $0x2c,%esp
+  800282:	8b 75 08             	mov    0x8(%ebp),%esi
+  800285:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800288:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80028b:	eb 0a                	jmp    800297 <vprintfmt+0x1e>
+      putch(ch, putdat);
+  80028d:	83 ec 08             	sub    $0x8,%esp
+  800290:	53                   	push   %ebx
+  800291:	50                   	push   %eax
+  800292:	ff d6                	call   *%esi
+  800294:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  800297:	83 c7 01             	add    $0x1,%edi
+  80029a:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80029e:	83 f8 25             	cmp    $0x25,%eax
+  8002a1:	74 0c                	je     8002af <vprintfmt+0x36>
+      if (ch == '\0')
+  8002a3:	85 c0                	test   %eax,%eax
+  8002a5:	75 e6                	jne    80028d <vprintfmt+0x14>
+}
+  8002a7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002aa:	5b                   	pop    %ebx
+  8002ab:	5e                   	pop    %esi
+  8002ac:	5f                   	pop    %edi
+  8002ad:	5d                   	pop    %ebp
+  8002ae:	c3                   	ret
+    padc = ' ';
+  8002af:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  8002b3:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  8002ba:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  8002c1:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  8002c8:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  8002cd:	8d 47 01             	lea    0x1(%edi),%eax
+  8002d0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8002d3:	0f b6 17             	movzbl (%edi),%edx
+  8002d6:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8002d9:	3c 55                	cmp    $0x55,%al
+  8002db:	0f 87 cf 03 00 00    	ja     8006b0 <vprintfmt+0x437>
+  8002e1:	0f b6 c0             	movzbl %al,%eax
+  8002e4:	ff 24 85 80 30 80 00 	jmp    *0x803080(,%eax,4)
+  8002eb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  8002ee:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8002f2:	eb d9                	jmp    8002cd <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  8002f4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8002f7:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8002fb:	eb d0                	jmp    8002cd <vprintfmt+0x54>
+  8002fd:	0f b6 d2             	movzbl %dl,%edx
+  800300:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  800303:	b8 00 00 00 00       	mov    $0x0,%eax
+  800308:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  80030b:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80030e:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  800312:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  800315:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800318:	83 f9 09             	cmp    $0x9,%ecx
+  80031b:	77 55                	ja     800372 <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  80031d:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  800320:	eb e9                	jmp    80030b <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  800322:	8b 45 14             	mov    0x14(%ebp),%eax
+  800325:	8b 00                	mov    (%eax),%eax
+  800327:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80032a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80032d:	8d 40 04             	lea    0x4(%eax),%eax
+  800330:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  800333:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  800336:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80033a:	79 91                	jns    8002cd <vprintfmt+0x54>
+        width = precision, precision = -1;
+  80033c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80033f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800342:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800349:	eb 82                	jmp    8002cd <vprintfmt+0x54>
+      if (width < 0)
+  80034b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80034e:	85 d2                	test   %edx,%edx
+  800350:	b8 00 00 00 00       	mov    $0x0,%eax
+  800355:	0f 49 c2             	cmovns %edx,%eax
+  800358:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  80035b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  80035e:	e9 6a ff ff ff       	jmp    8002cd <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  800363:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  800366:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  80036d:	e9 5b ff ff ff       	jmp    8002cd <vprintfmt+0x54>
+  800372:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800375:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800378:	eb bc                	jmp    800336 <vprintfmt+0xbd>
+      lflag++;
+  80037a:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  80037d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  800380:	e9 48 ff ff ff       	jmp    8002cd <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  800385:	8b 45 14             	mov    0x14(%ebp),%eax
+  800388:	8d 78 04             	lea    0x4(%eax),%edi
+  80038b:	83 ec 08             	sub    $0x8,%esp
+  80038e:	53                   	push   %ebx
+  80038f:	ff 30                	push   (%eax)
+  800391:	ff d6                	call   *%esi
+      break;
+  800393:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  800396:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  800399:	e9 b1 02 00 00       	jmp    80064f <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  80039e:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003a1:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  8003a4:	8b 10                	mov    (%eax),%edx
+  8003a6:	89 d0                	mov    %edx,%eax
+  8003a8:	f7 d8                	neg    %eax
+  8003aa:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8003ad:	83 f8 10             	cmp    $0x10,%eax
+  8003b0:	7f 23                	jg     8003d5 <vprintfmt+0x15c>
+  8003b2:	8b 14 85 e0 31 80 00 	mov    0x8031e0(,%eax,4),%edx
+  8003b9:	85 d2                	test   %edx,%edx
+  8003bb:	74 18                	je     8003d5 <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  8003bd:	52                   	push   %edx
+  8003be:	68 2a 33 80 00       	push   $0x80332a
+  8003c3:	53                   	push   %ebx
+  8003c4:	56                   	push   %esi
+  8003c5:	e8 92 fe ff ff       	call   80025c <printfmt>
+  8003ca:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  8003cd:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8003d0:	e9 7a 02 00 00       	jmp    80064f <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  8003d5:	50                   	push   %eax
+  8003d6:	68 3e 2f 80 00       	push   $0x802f3e
+  8003db:	53                   	push   %ebx
+  8003dc:	56                   	push   %esi
+  8003dd:	e8 7a fe ff ff       	call   80025c <printfmt>
+  8003e2:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  8003e5:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  8003e8:	e9 62 02 00 00       	jmp    80064f <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  8003ed:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003f0:	83 c0 04             	add    $0x4,%eax
+  8003f3:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8003f6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003f9:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  8003fb:	85 c9                	test   %ecx,%ecx
+  8003fd:	b8 37 2f 80 00       	mov    $0x802f37,%eax
+  800402:	0f 45 c1             	cmovne %ecx,%eax
+  800405:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  800408:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80040c:	7e 06                	jle    800414 <vprintfmt+0x19b>
+  80040e:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800412:	75 0b                	jne    80041f <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800414:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800417:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80041a:	89 75 08             	mov    %esi,0x8(%ebp)
+  80041d:	eb 5c                	jmp    80047b <vprintfmt+0x202>
+  80041f:	83 ec 08             	sub    $0x8,%esp
+  800422:	ff 75 d0             	push   -0x30(%ebp)
+  800425:	ff 75 cc             	push   -0x34(%ebp)
+  800428:	e8 20 03 00 00       	call   80074d <strnlen>
+  80042d:	89 c2                	mov    %eax,%edx
+  80042f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800432:	29 d0                	sub    %edx,%eax
+  800434:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  800437:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80043b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80043e:	89 75 08             	mov    %esi,0x8(%ebp)
+  800441:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800443:	eb 0e                	jmp    800453 <vprintfmt+0x1da>
+          putch(padc, putdat);
+  800445:	83 ec 08             	sub    $0x8,%esp
+  800448:	53                   	push   %ebx
+  800449:	57                   	push   %edi
+  80044a:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  80044d:	83 ee 01             	sub    $0x1,%esi
+  800450:	83 c4 10             	add    $0x10,%esp
+  800453:	85 f6                	test   %esi,%esi
+  800455:	7f ee                	jg     800445 <vprintfmt+0x1cc>
+  800457:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80045a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80045d:	85 c0                	test   %eax,%eax
+  80045f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800464:	0f 49 d0             	cmovns %eax,%edx
+  800467:	29 d0                	sub    %edx,%eax
+  800469:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80046c:	eb a6                	jmp    800414 <vprintfmt+0x19b>
+          putch(ch, putdat);
+  80046e:	83 ec 08             	sub    $0x8,%esp
+  800471:	53                   	push   %ebx
+  800472:	52                   	push   %edx
+  800473:	ff 55 08             	call   *0x8(%ebp)
+  800476:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800479:	89 f1                	mov    %esi,%ecx
+  80047b:	8d 71 01             	lea    0x1(%ecx),%esi
+  80047e:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800482:	0f be d0             	movsbl %al,%edx
+  800485:	85 d2                	test   %edx,%edx
+  800487:	74 28                	je     8004b1 <vprintfmt+0x238>
+  800489:	85 ff                	test   %edi,%edi
+  80048b:	78 05                	js     800492 <vprintfmt+0x219>
+  80048d:	83 ef 01             	sub    $0x1,%edi
+  800490:	78 30                	js     8004c2 <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  800492:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800496:	74 d6                	je     80046e <vprintfmt+0x1f5>
+  800498:	0f be c0             	movsbl %al,%eax
+  80049b:	83 e8 20             	sub    $0x20,%eax
+  80049e:	83 f8 5e             	cmp    $0x5e,%eax
+  8004a1:	76 cb                	jbe    80046e <vprintfmt+0x1f5>
+          putch('?', putdat);
+  8004a3:	83 ec 08             	sub    $0x8,%esp
+  8004a6:	53                   	push   %ebx
+  8004a7:	6a 3f                	push   $0x3f
+  8004a9:	ff 55 08             	call   *0x8(%ebp)
+  8004ac:	83 c4 10             	add    $0x10,%esp
+  8004af:	eb c8                	jmp    800479 <vprintfmt+0x200>
+  8004b1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004b4:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8004b7:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004ba:	01 d0                	add    %edx,%eax
+  8004bc:	29 c8                	sub    %ecx,%eax
+  8004be:	89 c7                	mov    %eax,%edi
+  8004c0:	eb 13                	jmp    8004d5 <vprintfmt+0x25c>
+  8004c2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004c5:	eb ed                	jmp    8004b4 <vprintfmt+0x23b>
+        putch(' ', putdat);
+  8004c7:	83 ec 08             	sub    $0x8,%esp
+  8004ca:	53                   	push   %ebx
+  8004cb:	6a 20                	push   $0x20
+  8004cd:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  8004cf:	83 ef 01             	sub    $0x1,%edi
+  8004d2:	83 c4 10             	add    $0x10,%esp
+  8004d5:	85 ff                	test   %edi,%edi
+  8004d7:	7f ee                	jg     8004c7 <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  8004d9:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8004dc:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004df:	e9 6b 01 00 00       	jmp    80064f <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  8004e4:	83 f9 01             	cmp    $0x1,%ecx
+  8004e7:	7f 1f                	jg     800508 <vprintfmt+0x28f>
+  else if (lflag)
+  8004e9:	85 c9                	test   %ecx,%ecx
+  8004eb:	74 67                	je     800554 <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  8004ed:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004f0:	8b 00                	mov    (%eax),%eax
+  8004f2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004f5:	89 c1                	mov    %eax,%ecx
+  8004f7:	c1 f9 1f             	sar    $0x1f,%ecx
+  8004fa:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8004fd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800500:	8d 40 04             	lea    0x4(%eax),%eax
+  800503:	89 45 14             	mov    %eax,0x14(%ebp)
+  800506:	eb 17                	jmp    80051f <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  800508:	8b 45 14             	mov    0x14(%ebp),%eax
+  80050b:	8b 50 04             	mov    0x4(%eax),%edx
+  80050e:	8b 00                	mov    (%eax),%eax
+  800510:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800513:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800516:	8b 45 14             	mov    0x14(%ebp),%eax
+  800519:	8d 40 08             	lea    0x8(%eax),%eax
+  80051c:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  80051f:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800522:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  800525:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  80052a:	85 c9                	test   %ecx,%ecx
+  80052c:	0f 89 03 01 00 00    	jns    800635 <vprintfmt+0x3bc>
+        putch('-', putdat);
+  800532:	83 ec 08             	sub    $0x8,%esp
+  800535:	53                   	push   %ebx
+  800536:	6a 2d                	push   $0x2d
+  800538:	ff d6                	call   *%esi
+        num = -(long long)num;
+  80053a:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80053d:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800540:	f7 da                	neg    %edx
+  800542:	83 d1 00             	adc    $0x0,%ecx
+  800545:	f7 d9                	neg    %ecx
+  800547:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  80054a:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80054f:	e9 e1 00 00 00       	jmp    800635 <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  800554:	8b 45 14             	mov    0x14(%ebp),%eax
+  800557:	8b 00                	mov    (%eax),%eax
+  800559:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80055c:	89 c1                	mov    %eax,%ecx
+  80055e:	c1 f9 1f             	sar    $0x1f,%ecx
+  800561:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800564:	8b 45 14             	mov    0x14(%ebp),%eax
+  800567:	8d 40 04             	lea    0x4(%eax),%eax
+  80056a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80056d:	eb b0                	jmp    80051f <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  80056f:	83 f9 01             	cmp    $0x1,%ecx
+  800572:	7f 1e                	jg     800592 <vprintfmt+0x319>
+  else if (lflag)
+  800574:	85 c9                	test   %ecx,%ecx
+  800576:	74 32                	je     8005aa <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  800578:	8b 45 14             	mov    0x14(%ebp),%eax
+  80057b:	8b 10                	mov    (%eax),%edx
+  80057d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800582:	8d 40 04             	lea    0x4(%eax),%eax
+  800585:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800588:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  80058d:	e9 a3 00 00 00       	jmp    800635 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800592:	8b 45 14             	mov    0x14(%ebp),%eax
+  800595:	8b 10                	mov    (%eax),%edx
+  800597:	8b 48 04             	mov    0x4(%eax),%ecx
+  80059a:	8d 40 08             	lea    0x8(%eax),%eax
+  80059d:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  8005a0:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  8005a5:	e9 8b 00 00 00       	jmp    800635 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8005aa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ad:	8b 10                	mov    (%eax),%edx
+  8005af:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005b4:	8d 40 04             	lea    0x4(%eax),%eax
+  8005b7:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  8005ba:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  8005bf:	eb 74                	jmp    800635 <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  8005c1:	83 f9 01             	cmp    $0x1,%ecx
+  8005c4:	7f 1b                	jg     8005e1 <vprintfmt+0x368>
+  else if (lflag)
+  8005c6:	85 c9                	test   %ecx,%ecx
+  8005c8:	74 2c                	je     8005f6 <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  8005ca:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005cd:	8b 10                	mov    (%eax),%edx
+  8005cf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005d4:	8d 40 04             	lea    0x4(%eax),%eax
+  8005d7:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8005da:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  8005df:	eb 54                	jmp    800635 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  8005e1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e4:	8b 10                	mov    (%eax),%edx
+  8005e6:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005e9:	8d 40 08             	lea    0x8(%eax),%eax
+  8005ec:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8005ef:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  8005f4:	eb 3f                	jmp    800635 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8005f6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f9:	8b 10                	mov    (%eax),%edx
+  8005fb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800600:	8d 40 04             	lea    0x4(%eax),%eax
+  800603:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800606:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  80060b:	eb 28                	jmp    800635 <vprintfmt+0x3bc>
+      putch('0', putdat);
+  80060d:	83 ec 08             	sub    $0x8,%esp
+  800610:	53                   	push   %ebx
+  800611:	6a 30                	push   $0x30
+  800613:	ff d6                	call   *%esi
+      putch('x', putdat);
+  800615:	83 c4 08             	add    $0x8,%esp
+  800618:	53                   	push   %ebx
+  800619:	6a 78                	push   $0x78
+  80061b:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  80061d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800620:	8b 10                	mov    (%eax),%edx
+  800622:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  800627:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  80062a:	8d 40 04             	lea    0x4(%eax),%eax
+  80062d:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800630:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  800635:	83 ec 0c             	sub    $0xc,%esp
+  800638:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80063c:	50                   	push   %eax
+  80063d:	ff 75 e0             	push   -0x20(%ebp)
+  800640:	57                   	push   %edi
+  800641:	51                   	push   %ecx
+  800642:	52                   	push   %edx
+  800643:	89 da                	mov    %ebx,%edx
+  800645:	89 f0                	mov    %esi,%eax
+  800647:	e8 4a fb ff ff       	call   800196 <printnum>
+      break;
+  80064c:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  80064f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  800652:	e9 40 fc ff ff       	jmp    800297 <vprintfmt+0x1e>
+  if (lflag >= 2)
+  800657:	83 f9 01             	cmp    $0x1,%ecx
+  80065a:	7f 1b                	jg     800677 <vprintfmt+0x3fe>
+  else if (lflag)
+  80065c:	85 c9                	test   %ecx,%ecx
+  80065e:	74 2c                	je     80068c <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  800660:	8b 45 14             	mov    0x14(%ebp),%eax
+  800663:	8b 10                	mov    (%eax),%edx
+  800665:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80066a:	8d 40 04             	lea    0x4(%eax),%eax
+  80066d:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800670:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  800675:	eb be                	jmp    800635 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800677:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067a:	8b 10                	mov    (%eax),%edx
+  80067c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80067f:	8d 40 08             	lea    0x8(%eax),%eax
+  800682:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800685:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  80068a:	eb a9                	jmp    800635 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  80068c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068f:	8b 10                	mov    (%eax),%edx
+  800691:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800696:	8d 40 04             	lea    0x4(%eax),%eax
+  800699:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  80069c:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  8006a1:	eb 92                	jmp    800635 <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  8006a3:	83 ec 08             	sub    $0x8,%esp
+  8006a6:	53                   	push   %ebx
+  8006a7:	6a 25                	push   $0x25
+  8006a9:	ff d6                	call   *%esi
+      break;
+  8006ab:	83 c4 10             	add    $0x10,%esp
+  8006ae:	eb 9f                	jmp    80064f <vprintfmt+0x3d6>
+      putch('%', putdat);
+  8006b0:	83 ec 08             	sub    $0x8,%esp
+  8006b3:	53                   	push   %ebx
+  8006b4:	6a 25                	push   $0x25
+  8006b6:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  8006b8:	83 c4 10             	add    $0x10,%esp
+  8006bb:	89 f8                	mov    %edi,%eax
+  8006bd:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8006c1:	74 05                	je     8006c8 <vprintfmt+0x44f>
+  8006c3:	83 e8 01             	sub    $0x1,%eax
+  8006c6:	eb f5                	jmp    8006bd <vprintfmt+0x444>
+  8006c8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8006cb:	eb 82                	jmp    80064f <vprintfmt+0x3d6>
+
+008006cd <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8006cd:	55                   	push   %ebp
+  8006ce:	89 e5                	mov    %esp,%ebp
+  8006d0:	83 ec 18             	sub    $0x18,%esp
+  8006d3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006d6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  8006d9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8006dc:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8006e0:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8006e3:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  8006ea:	85 c0                	test   %eax,%eax
+  8006ec:	74 26                	je     800714 <vsnprintf+0x47>
+  8006ee:	85 d2                	test   %edx,%edx
+  8006f0:	7e 22                	jle    800714 <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8006f2:	ff 75 14             	push   0x14(%ebp)
+  8006f5:	ff 75 10             	push   0x10(%ebp)
+  8006f8:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8006fb:	50                   	push   %eax
+  8006fc:	68 3f 02 80 00       	push   $0x80023f
+  800701:	e8 73 fb ff ff       	call   800279 <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800706:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800709:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  80070c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80070f:	83 c4 10             	add    $0x10,%esp
+}
+  800712:	c9                   	leave
+  800713:	c3                   	ret
+    return -E_INVAL;
+  800714:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800719:	eb f7                	jmp    800712 <vsnprintf+0x45>
+
+0080071b <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80071b:	55                   	push   %ebp
+  80071c:	89 e5                	mov    %esp,%ebp
+  80071e:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  800721:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  800724:	50                   	push   %eax
+  800725:	ff 75 10             	push   0x10(%ebp)
+  800728:	ff 75 0c             	push   0xc(%ebp)
+  80072b:	ff 75 08             	push   0x8(%ebp)
+  80072e:	e8 9a ff ff ff       	call   8006cd <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  800733:	c9                   	leave
+  800734:	c3                   	ret
+
+00800735 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800735:	55                   	push   %ebp
+  800736:	89 e5                	mov    %esp,%ebp
+  800738:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  80073b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800740:	eb 03                	jmp    800745 <strlen+0x10>
+    n++;
+  800742:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  800745:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800749:	75 f7                	jne    800742 <strlen+0xd>
+  return n;
+}
+  80074b:	5d                   	pop    %ebp
+  80074c:	c3                   	ret
+
+0080074d <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80074d:	55                   	push   %ebp
+  80074e:	89 e5                	mov    %esp,%ebp
+  800750:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800753:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800756:	b8 00 00 00 00       	mov    $0x0,%eax
+  80075b:	eb 03                	jmp    800760 <strnlen+0x13>
+    n++;
+  80075d:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800760:	39 d0                	cmp    %edx,%eax
+  800762:	74 08                	je     80076c <strnlen+0x1f>
+  800764:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800768:	75 f3                	jne    80075d <strnlen+0x10>
+  80076a:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  80076c:	89 d0                	mov    %edx,%eax
+  80076e:	5d                   	pop    %ebp
+  80076f:	c3                   	ret
+
+00800770 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800770:	55                   	push   %ebp
+  800771:	89 e5                	mov    %esp,%ebp
+  800773:	53                   	push   %ebx
+  800774:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800777:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  80077a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80077f:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800783:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800786:	83 c0 01             	add    $0x1,%eax
+  800789:	84 d2                	test   %dl,%dl
+  80078b:	75 f2                	jne    80077f <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  80078d:	89 c8                	mov    %ecx,%eax
+  80078f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800792:	c9                   	leave
+  800793:	c3                   	ret
+
+00800794 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800794:	55                   	push   %ebp
+  800795:	89 e5                	mov    %esp,%ebp
+  800797:	53                   	push   %ebx
+  800798:	83 ec 10             	sub    $0x10,%esp
+  80079b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  80079e:	53                   	push   %ebx
+  80079f:	e8 91 ff ff ff       	call   800735 <strlen>
+  8007a4:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  8007a7:	ff 75 0c             	push   0xc(%ebp)
+  8007aa:	01 d8                	add    %ebx,%eax
+  8007ac:	50                   	push   %eax
+  8007ad:	e8 be ff ff ff       	call   800770 <strcpy>
+  return dst;
+}
+  8007b2:	89 d8                	mov    %ebx,%eax
+  8007b4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007b7:	c9                   	leave
+  8007b8:	c3                   	ret
+
+008007b9 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  8007b9:	55                   	push   %ebp
+  8007ba:	89 e5                	mov    %esp,%ebp
+  8007bc:	56                   	push   %esi
+  8007bd:	53                   	push   %ebx
+  8007be:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007c1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  8007c4:	89 f3                	mov    %esi,%ebx
+  8007c6:	03 5d 10             	add    0x10(%ebp),%ebx
+  8007c9:	89 f0                	mov    %esi,%eax
+  8007cb:	eb 0f                	jmp    8007dc <strncpy+0x23>
+    *dst++ = *src;
+  8007cd:	83 c0 01             	add    $0x1,%eax
+  8007d0:	0f b6 0a             	movzbl (%edx),%ecx
+  8007d3:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  8007d6:	80 f9 01             	cmp    $0x1,%cl
+  8007d9:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  8007dc:	39 d8                	cmp    %ebx,%eax
+  8007de:	75 ed                	jne    8007cd <strncpy+0x14>
+  }
+  return ret;
+}
+  8007e0:	89 f0                	mov    %esi,%eax
+  8007e2:	5b                   	pop    %ebx
+  8007e3:	5e                   	pop    %esi
+  8007e4:	5d                   	pop    %ebp
+  8007e5:	c3                   	ret
+
+008007e6 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8007e6:	55                   	push   %ebp
+  8007e7:	89 e5                	mov    %esp,%ebp
+  8007e9:	56                   	push   %esi
+  8007ea:	53                   	push   %ebx
+  8007eb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007ee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007f1:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  8007f4:	89 f0                	mov    %esi,%eax
+  8007f6:	85 d2                	test   %edx,%edx
+  8007f8:	74 21                	je     80081b <strlcpy+0x35>
+  8007fa:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8007fe:	89 f2                	mov    %esi,%edx
+  800800:	eb 09                	jmp    80080b <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  800802:	83 c1 01             	add    $0x1,%ecx
+  800805:	83 c2 01             	add    $0x1,%edx
+  800808:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  80080b:	39 c2                	cmp    %eax,%edx
+  80080d:	74 09                	je     800818 <strlcpy+0x32>
+  80080f:	0f b6 19             	movzbl (%ecx),%ebx
+  800812:	84 db                	test   %bl,%bl
+  800814:	75 ec                	jne    800802 <strlcpy+0x1c>
+  800816:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  800818:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  80081b:	29 f0                	sub    %esi,%eax
+}
+  80081d:	5b                   	pop    %ebx
+  80081e:	5e                   	pop    %esi
+  80081f:	5d                   	pop    %ebp
+  800820:	c3                   	ret
+
+00800821 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800821:	55                   	push   %ebp
+  800822:	89 e5                	mov    %esp,%ebp
+  800824:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800827:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  80082a:	eb 06                	jmp    800832 <strcmp+0x11>
+    p++, q++;
+  80082c:	83 c1 01             	add    $0x1,%ecx
+  80082f:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  800832:	0f b6 01             	movzbl (%ecx),%eax
+  800835:	84 c0                	test   %al,%al
+  800837:	74 04                	je     80083d <strcmp+0x1c>
+  800839:	3a 02                	cmp    (%edx),%al
+  80083b:	74 ef                	je     80082c <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  80083d:	0f b6 c0             	movzbl %al,%eax
+  800840:	0f b6 12             	movzbl (%edx),%edx
+  800843:	29 d0                	sub    %edx,%eax
+}
+  800845:	5d                   	pop    %ebp
+  800846:	c3                   	ret
+
+00800847 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800847:	55                   	push   %ebp
+  800848:	89 e5                	mov    %esp,%ebp
+  80084a:	53                   	push   %ebx
+  80084b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80084e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800851:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  800854:	eb 09                	jmp    80085f <strncmp+0x18>
+    n--, p++, q++;
+  800856:	83 ea 01             	sub    $0x1,%edx
+  800859:	83 c0 01             	add    $0x1,%eax
+  80085c:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  80085f:	85 d2                	test   %edx,%edx
+  800861:	74 18                	je     80087b <strncmp+0x34>
+  800863:	0f b6 18             	movzbl (%eax),%ebx
+  800866:	84 db                	test   %bl,%bl
+  800868:	74 04                	je     80086e <strncmp+0x27>
+  80086a:	3a 19                	cmp    (%ecx),%bl
+  80086c:	74 e8                	je     800856 <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80086e:	0f b6 00             	movzbl (%eax),%eax
+  800871:	0f b6 11             	movzbl (%ecx),%edx
+  800874:	29 d0                	sub    %edx,%eax
+}
+  800876:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800879:	c9                   	leave
+  80087a:	c3                   	ret
+    return 0;
+  80087b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800880:	eb f4                	jmp    800876 <strncmp+0x2f>
+
+00800882 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800882:	55                   	push   %ebp
+  800883:	89 e5                	mov    %esp,%ebp
+  800885:	8b 45 08             	mov    0x8(%ebp),%eax
+  800888:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  80088c:	eb 03                	jmp    800891 <strchr+0xf>
+  80088e:	83 c0 01             	add    $0x1,%eax
+  800891:	0f b6 10             	movzbl (%eax),%edx
+  800894:	84 d2                	test   %dl,%dl
+  800896:	74 06                	je     80089e <strchr+0x1c>
+    if (*s == c)
+  800898:	38 ca                	cmp    %cl,%dl
+  80089a:	75 f2                	jne    80088e <strchr+0xc>
+  80089c:	eb 05                	jmp    8008a3 <strchr+0x21>
+      return (char*)s;
+  return 0;
+  80089e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008a3:	5d                   	pop    %ebp
+  8008a4:	c3                   	ret
+
+008008a5 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8008a5:	55                   	push   %ebp
+  8008a6:	89 e5                	mov    %esp,%ebp
+  8008a8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008ab:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  8008af:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  8008b2:	38 ca                	cmp    %cl,%dl
+  8008b4:	74 09                	je     8008bf <strfind+0x1a>
+  8008b6:	84 d2                	test   %dl,%dl
+  8008b8:	74 05                	je     8008bf <strfind+0x1a>
+  for (; *s; s++)
+  8008ba:	83 c0 01             	add    $0x1,%eax
+  8008bd:	eb f0                	jmp    8008af <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  8008bf:	5d                   	pop    %ebp
+  8008c0:	c3                   	ret
+
+008008c1 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8008c1:	55                   	push   %ebp
+  8008c2:	89 e5                	mov    %esp,%ebp
+  8008c4:	57                   	push   %edi
+  8008c5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8008c8:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  8008cb:	85 c9                	test   %ecx,%ecx
+  8008cd:	74 20                	je     8008ef <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  8008cf:	89 f8                	mov    %edi,%eax
+  8008d1:	09 c8                	or     %ecx,%eax
+  8008d3:	a8 03                	test   $0x3,%al
+  8008d5:	75 12                	jne    8008e9 <memset+0x28>
+    c &= 0xFF;
+  8008d7:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8008db:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  8008e1:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  8008e4:	fc                   	cld
+  8008e5:	f3 ab                	rep stos %eax,%es:(%edi)
+  8008e7:	eb 06                	jmp    8008ef <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  8008e9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8008ec:	fc                   	cld
+  8008ed:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  8008ef:	89 f8                	mov    %edi,%eax
+  8008f1:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8008f4:	c9                   	leave
+  8008f5:	c3                   	ret
+
+008008f6 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8008f6:	55                   	push   %ebp
+  8008f7:	89 e5                	mov    %esp,%ebp
+  8008f9:	57                   	push   %edi
+  8008fa:	56                   	push   %esi
+  8008fb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008fe:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800901:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  800904:	39 c6                	cmp    %eax,%esi
+  800906:	73 32                	jae    80093a <memmove+0x44>
+  800908:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80090b:	39 d0                	cmp    %edx,%eax
+  80090d:	73 2b                	jae    80093a <memmove+0x44>
+    s += n;
+    d += n;
+  80090f:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800912:	89 d6                	mov    %edx,%esi
+  800914:	09 fe                	or     %edi,%esi
+  800916:	09 ce                	or     %ecx,%esi
+  800918:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  80091e:	75 0e                	jne    80092e <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800920:	83 ef 04             	sub    $0x4,%edi
+  800923:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800926:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  800929:	fd                   	std
+  80092a:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80092c:	eb 09                	jmp    800937 <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  80092e:	83 ef 01             	sub    $0x1,%edi
+  800931:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  800934:	fd                   	std
+  800935:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  800937:	fc                   	cld
+  800938:	eb 1a                	jmp    800954 <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80093a:	89 f2                	mov    %esi,%edx
+  80093c:	09 c2                	or     %eax,%edx
+  80093e:	09 ca                	or     %ecx,%edx
+  800940:	f6 c2 03             	test   $0x3,%dl
+  800943:	75 0a                	jne    80094f <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800945:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  800948:	89 c7                	mov    %eax,%edi
+  80094a:	fc                   	cld
+  80094b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80094d:	eb 05                	jmp    800954 <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  80094f:	89 c7                	mov    %eax,%edi
+  800951:	fc                   	cld
+  800952:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  800954:	5e                   	pop    %esi
+  800955:	5f                   	pop    %edi
+  800956:	5d                   	pop    %ebp
+  800957:	c3                   	ret
+
+00800958 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800958:	55                   	push   %ebp
+  800959:	89 e5                	mov    %esp,%ebp
+  80095b:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  80095e:	ff 75 10             	push   0x10(%ebp)
+  800961:	ff 75 0c             	push   0xc(%ebp)
+  800964:	ff 75 08             	push   0x8(%ebp)
+  800967:	e8 8a ff ff ff       	call   8008f6 <memmove>
+}
+  80096c:	c9                   	leave
+  80096d:	c3                   	ret
+
+0080096e <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  80096e:	55                   	push   %ebp
+  80096f:	89 e5                	mov    %esp,%ebp
+  800971:	56                   	push   %esi
+  800972:	53                   	push   %ebx
+  800973:	8b 45 08             	mov    0x8(%ebp),%eax
+  800976:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  800979:	89 c6                	mov    %eax,%esi
+  80097b:	03 75 10             	add    0x10(%ebp),%esi
+  80097e:	eb 06                	jmp    800986 <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  800980:	83 c0 01             	add    $0x1,%eax
+  800983:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  800986:	39 f0                	cmp    %esi,%eax
+  800988:	74 14                	je     80099e <memcmp+0x30>
+    if (*s1 != *s2)
+  80098a:	0f b6 08             	movzbl (%eax),%ecx
+  80098d:	0f b6 1a             	movzbl (%edx),%ebx
+  800990:	38 d9                	cmp    %bl,%cl
+  800992:	74 ec                	je     800980 <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  800994:	0f b6 c1             	movzbl %cl,%eax
+  800997:	0f b6 db             	movzbl %bl,%ebx
+  80099a:	29 d8                	sub    %ebx,%eax
+  80099c:	eb 05                	jmp    8009a3 <memcmp+0x35>
+  }
+
+  return 0;
+  80099e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009a3:	5b                   	pop    %ebx
+  8009a4:	5e                   	pop    %esi
+  8009a5:	5d                   	pop    %ebp
+  8009a6:	c3                   	ret
+
+008009a7 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8009a7:	55                   	push   %ebp
+  8009a8:	89 e5                	mov    %esp,%ebp
+  8009aa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009ad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  8009b0:	89 c2                	mov    %eax,%edx
+  8009b2:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  8009b5:	eb 03                	jmp    8009ba <memfind+0x13>
+  8009b7:	83 c0 01             	add    $0x1,%eax
+  8009ba:	39 d0                	cmp    %edx,%eax
+  8009bc:	73 04                	jae    8009c2 <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  8009be:	38 08                	cmp    %cl,(%eax)
+  8009c0:	75 f5                	jne    8009b7 <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  8009c2:	5d                   	pop    %ebp
+  8009c3:	c3                   	ret
+
+008009c4 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8009c4:	55                   	push   %ebp
+  8009c5:	89 e5                	mov    %esp,%ebp
+  8009c7:	57                   	push   %edi
+  8009c8:	56                   	push   %esi
+  8009c9:	53                   	push   %ebx
+  8009ca:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009cd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  8009d0:	eb 03                	jmp    8009d5 <strtol+0x11>
+    s++;
+  8009d2:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  8009d5:	0f b6 02             	movzbl (%edx),%eax
+  8009d8:	3c 20                	cmp    $0x20,%al
+  8009da:	74 f6                	je     8009d2 <strtol+0xe>
+  8009dc:	3c 09                	cmp    $0x9,%al
+  8009de:	74 f2                	je     8009d2 <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  8009e0:	3c 2b                	cmp    $0x2b,%al
+  8009e2:	74 2a                	je     800a0e <strtol+0x4a>
+  int neg = 0;
+  8009e4:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  8009e9:	3c 2d                	cmp    $0x2d,%al
+  8009eb:	74 2b                	je     800a18 <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8009ed:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8009f3:	75 0f                	jne    800a04 <strtol+0x40>
+  8009f5:	80 3a 30             	cmpb   $0x30,(%edx)
+  8009f8:	74 28                	je     800a22 <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  8009fa:	85 db                	test   %ebx,%ebx
+  8009fc:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a01:	0f 44 d8             	cmove  %eax,%ebx
+  800a04:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a09:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a0c:	eb 46                	jmp    800a54 <strtol+0x90>
+    s++;
+  800a0e:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  800a11:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a16:	eb d5                	jmp    8009ed <strtol+0x29>
+    s++, neg = 1;
+  800a18:	83 c2 01             	add    $0x1,%edx
+  800a1b:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a20:	eb cb                	jmp    8009ed <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a22:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a26:	74 0e                	je     800a36 <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  800a28:	85 db                	test   %ebx,%ebx
+  800a2a:	75 d8                	jne    800a04 <strtol+0x40>
+    s++, base = 8;
+  800a2c:	83 c2 01             	add    $0x1,%edx
+  800a2f:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a34:	eb ce                	jmp    800a04 <strtol+0x40>
+    s += 2, base = 16;
+  800a36:	83 c2 02             	add    $0x2,%edx
+  800a39:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a3e:	eb c4                	jmp    800a04 <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  800a40:	0f be c0             	movsbl %al,%eax
+  800a43:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  800a46:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a49:	7d 3a                	jge    800a85 <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  800a4b:	83 c2 01             	add    $0x1,%edx
+  800a4e:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a52:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  800a54:	0f b6 02             	movzbl (%edx),%eax
+  800a57:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a5a:	89 f3                	mov    %esi,%ebx
+  800a5c:	80 fb 09             	cmp    $0x9,%bl
+  800a5f:	76 df                	jbe    800a40 <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  800a61:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800a64:	89 f3                	mov    %esi,%ebx
+  800a66:	80 fb 19             	cmp    $0x19,%bl
+  800a69:	77 08                	ja     800a73 <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  800a6b:	0f be c0             	movsbl %al,%eax
+  800a6e:	83 e8 57             	sub    $0x57,%eax
+  800a71:	eb d3                	jmp    800a46 <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  800a73:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800a76:	89 f3                	mov    %esi,%ebx
+  800a78:	80 fb 19             	cmp    $0x19,%bl
+  800a7b:	77 08                	ja     800a85 <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  800a7d:	0f be c0             	movsbl %al,%eax
+  800a80:	83 e8 37             	sub    $0x37,%eax
+  800a83:	eb c1                	jmp    800a46 <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  800a85:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800a89:	74 05                	je     800a90 <strtol+0xcc>
+    *endptr = (char*)s;
+  800a8b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a8e:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  800a90:	89 c8                	mov    %ecx,%eax
+  800a92:	f7 d8                	neg    %eax
+  800a94:	85 ff                	test   %edi,%edi
+  800a96:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800a99:	89 c8                	mov    %ecx,%eax
+  800a9b:	5b                   	pop    %ebx
+  800a9c:	5e                   	pop    %esi
+  800a9d:	5f                   	pop    %edi
+  800a9e:	5d                   	pop    %ebp
+  800a9f:	c3                   	ret
+
+00800aa0 <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800aa0:	55                   	push   %ebp
+  800aa1:	89 e5                	mov    %esp,%ebp
+  800aa3:	57                   	push   %edi
+  800aa4:	56                   	push   %esi
+  800aa5:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800aa6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aab:	8b 55 08             	mov    0x8(%ebp),%edx
+  800aae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ab1:	89 c3                	mov    %eax,%ebx
+  800ab3:	89 c7                	mov    %eax,%edi
+  800ab5:	89 c6                	mov    %eax,%esi
+  800ab7:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800ab9:	5b                   	pop    %ebx
+  800aba:	5e                   	pop    %esi
+  800abb:	5f                   	pop    %edi
+  800abc:	5d                   	pop    %ebp
+  800abd:	c3                   	ret
+
+00800abe <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800abe:	55                   	push   %ebp
+  800abf:	89 e5                	mov    %esp,%ebp
+  800ac1:	57                   	push   %edi
+  800ac2:	56                   	push   %esi
+  800ac3:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800ac4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ac9:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ace:	89 d1                	mov    %edx,%ecx
+  800ad0:	89 d3                	mov    %edx,%ebx
+  800ad2:	89 d7                	mov    %edx,%edi
+  800ad4:	89 d6                	mov    %edx,%esi
+  800ad6:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800ad8:	5b                   	pop    %ebx
+  800ad9:	5e                   	pop    %esi
+  800ada:	5f                   	pop    %edi
+  800adb:	5d                   	pop    %ebp
+  800adc:	c3                   	ret
+
+00800add <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800add:	55                   	push   %ebp
+  800ade:	89 e5                	mov    %esp,%ebp
+  800ae0:	57                   	push   %edi
+  800ae1:	56                   	push   %esi
+  800ae2:	53                   	push   %ebx
+  800ae3:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800ae6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800aeb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800aee:	b8 03 00 00 00       	mov    $0x3,%eax
+  800af3:	89 cb                	mov    %ecx,%ebx
+  800af5:	89 cf                	mov    %ecx,%edi
+  800af7:	89 ce                	mov    %ecx,%esi
+  800af9:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800afb:	85 c0                	test   %eax,%eax
+  800afd:	7f 08                	jg     800b07 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800aff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b02:	5b                   	pop    %ebx
+  800b03:	5e                   	pop    %esi
+  800b04:	5f                   	pop    %edi
+  800b05:	5d                   	pop    %ebp
+  800b06:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800b07:	83 ec 0c             	sub    $0xc,%esp
+  800b0a:	50                   	push   %eax
+  800b0b:	6a 03                	push   $0x3
+  800b0d:	68 43 32 80 00       	push   $0x803243
+  800b12:	6a 23                	push   $0x23
+  800b14:	68 60 32 80 00       	push   $0x803260
+  800b19:	e8 ae 1f 00 00       	call   802acc <_panic>
+
+00800b1e <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800b1e:	55                   	push   %ebp
+  800b1f:	89 e5                	mov    %esp,%ebp
+  800b21:	57                   	push   %edi
+  800b22:	56                   	push   %esi
+  800b23:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800b24:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b29:	b8 02 00 00 00       	mov    $0x2,%eax
+  800b2e:	89 d1                	mov    %edx,%ecx
+  800b30:	89 d3                	mov    %edx,%ebx
+  800b32:	89 d7                	mov    %edx,%edi
+  800b34:	89 d6                	mov    %edx,%esi
+  800b36:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800b38:	5b                   	pop    %ebx
+  800b39:	5e                   	pop    %esi
+  800b3a:	5f                   	pop    %edi
+  800b3b:	5d                   	pop    %ebp
+  800b3c:	c3                   	ret
+
+00800b3d <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800b3d:	55                   	push   %ebp
+  800b3e:	89 e5                	mov    %esp,%ebp
+  800b40:	57                   	push   %edi
+  800b41:	56                   	push   %esi
+  800b42:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800b43:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b48:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800b4d:	89 d1                	mov    %edx,%ecx
+  800b4f:	89 d3                	mov    %edx,%ebx
+  800b51:	89 d7                	mov    %edx,%edi
+  800b53:	89 d6                	mov    %edx,%esi
+  800b55:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800b57:	5b                   	pop    %ebx
+  800b58:	5e                   	pop    %esi
+  800b59:	5f                   	pop    %edi
+  800b5a:	5d                   	pop    %ebp
+  800b5b:	c3                   	ret
+
+00800b5c <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  800b5c:	55                   	push   %ebp
+  800b5d:	89 e5                	mov    %esp,%ebp
+  800b5f:	57                   	push   %edi
+  800b60:	56                   	push   %esi
+  800b61:	53                   	push   %ebx
+  800b62:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  800b65:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  800b69:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b6e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b71:	b8 14 00 00 00       	mov    $0x14,%eax
+  800b76:	89 df                	mov    %ebx,%edi
+  800b78:	89 de                	mov    %ebx,%esi
+  800b7a:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800b7c:	85 c0                	test   %eax,%eax
+  800b7e:	7f 08                	jg     800b88 <sys_env_set_cow+0x2c>
+}
+  800b80:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b83:	5b                   	pop    %ebx
+  800b84:	5e                   	pop    %esi
+  800b85:	5f                   	pop    %edi
+  800b86:	5d                   	pop    %ebp
+  800b87:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800b88:	83 ec 0c             	sub    $0xc,%esp
+  800b8b:	50                   	push   %eax
+  800b8c:	6a 14                	push   $0x14
+  800b8e:	68 43 32 80 00       	push   $0x803243
+  800b93:	6a 23                	push   $0x23
+  800b95:	68 60 32 80 00       	push   $0x803260
+  800b9a:	e8 2d 1f 00 00       	call   802acc <_panic>
+
+00800b9f <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800b9f:	55                   	push   %ebp
+  800ba0:	89 e5                	mov    %esp,%ebp
+  800ba2:	57                   	push   %edi
+  800ba3:	56                   	push   %esi
+  800ba4:	53                   	push   %ebx
+  800ba5:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800ba8:	be 00 00 00 00       	mov    $0x0,%esi
+  800bad:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bb0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bb3:	b8 04 00 00 00       	mov    $0x4,%eax
+  800bb8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800bbb:	89 f7                	mov    %esi,%edi
+  800bbd:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800bbf:	85 c0                	test   %eax,%eax
+  800bc1:	7f 08                	jg     800bcb <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  800bc3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bc6:	5b                   	pop    %ebx
+  800bc7:	5e                   	pop    %esi
+  800bc8:	5f                   	pop    %edi
+  800bc9:	5d                   	pop    %ebp
+  800bca:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800bcb:	83 ec 0c             	sub    $0xc,%esp
+  800bce:	50                   	push   %eax
+  800bcf:	6a 04                	push   $0x4
+  800bd1:	68 43 32 80 00       	push   $0x803243
+  800bd6:	6a 23                	push   $0x23
+  800bd8:	68 60 32 80 00       	push   $0x803260
+  800bdd:	e8 ea 1e 00 00       	call   802acc <_panic>
+
+00800be2 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800be2:	55                   	push   %ebp
+  800be3:	89 e5                	mov    %esp,%ebp
+  800be5:	57                   	push   %edi
+  800be6:	56                   	push   %esi
+  800be7:	53                   	push   %ebx
+  800be8:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800beb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bf1:	b8 05 00 00 00       	mov    $0x5,%eax
+  800bf6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800bf9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800bfc:	8b 75 18             	mov    0x18(%ebp),%esi
+  800bff:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c01:	85 c0                	test   %eax,%eax
+  800c03:	7f 08                	jg     800c0d <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  800c05:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c08:	5b                   	pop    %ebx
+  800c09:	5e                   	pop    %esi
+  800c0a:	5f                   	pop    %edi
+  800c0b:	5d                   	pop    %ebp
+  800c0c:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c0d:	83 ec 0c             	sub    $0xc,%esp
+  800c10:	50                   	push   %eax
+  800c11:	6a 05                	push   $0x5
+  800c13:	68 43 32 80 00       	push   $0x803243
+  800c18:	6a 23                	push   $0x23
+  800c1a:	68 60 32 80 00       	push   $0x803260
+  800c1f:	e8 a8 1e 00 00       	call   802acc <_panic>
+
+00800c24 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800c24:	55                   	push   %ebp
+  800c25:	89 e5                	mov    %esp,%ebp
+  800c27:	57                   	push   %edi
+  800c28:	56                   	push   %esi
+  800c29:	53                   	push   %ebx
+  800c2a:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800c2d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c32:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c35:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c38:	b8 06 00 00 00       	mov    $0x6,%eax
+  800c3d:	89 df                	mov    %ebx,%edi
+  800c3f:	89 de                	mov    %ebx,%esi
+  800c41:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c43:	85 c0                	test   %eax,%eax
+  800c45:	7f 08                	jg     800c4f <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  800c47:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c4a:	5b                   	pop    %ebx
+  800c4b:	5e                   	pop    %esi
+  800c4c:	5f                   	pop    %edi
+  800c4d:	5d                   	pop    %ebp
+  800c4e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c4f:	83 ec 0c             	sub    $0xc,%esp
+  800c52:	50                   	push   %eax
+  800c53:	6a 06                	push   $0x6
+  800c55:	68 43 32 80 00       	push   $0x803243
+  800c5a:	6a 23                	push   $0x23
+  800c5c:	68 60 32 80 00       	push   $0x803260
+  800c61:	e8 66 1e 00 00       	call   802acc <_panic>
+
+00800c66 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  800c66:	55                   	push   %ebp
+  800c67:	89 e5                	mov    %esp,%ebp
+  800c69:	57                   	push   %edi
+  800c6a:	56                   	push   %esi
+  800c6b:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800c6c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c6f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c72:	b8 11 00 00 00       	mov    $0x11,%eax
+  800c77:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c7a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c7d:	8b 75 18             	mov    0x18(%ebp),%esi
+  800c80:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  800c82:	5b                   	pop    %ebx
+  800c83:	5e                   	pop    %esi
+  800c84:	5f                   	pop    %edi
+  800c85:	5d                   	pop    %ebp
+  800c86:	c3                   	ret
+
+00800c87 <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  800c87:	55                   	push   %ebp
+  800c88:	89 e5                	mov    %esp,%ebp
+  800c8a:	57                   	push   %edi
+  800c8b:	56                   	push   %esi
+  800c8c:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800c8d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c90:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c93:	b8 12 00 00 00       	mov    $0x12,%eax
+  800c98:	be 00 00 00 00       	mov    $0x0,%esi
+  800c9d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ca0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ca3:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  800ca5:	5b                   	pop    %ebx
+  800ca6:	5e                   	pop    %esi
+  800ca7:	5f                   	pop    %edi
+  800ca8:	5d                   	pop    %ebp
+  800ca9:	c3                   	ret
+
+00800caa <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  800caa:	55                   	push   %ebp
+  800cab:	89 e5                	mov    %esp,%ebp
+  800cad:	57                   	push   %edi
+  800cae:	56                   	push   %esi
+  800caf:	53                   	push   %ebx
+  800cb0:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800cb3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cb8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cbb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cbe:	b8 16 00 00 00       	mov    $0x16,%eax
+  800cc3:	89 df                	mov    %ebx,%edi
+  800cc5:	89 de                	mov    %ebx,%esi
+  800cc7:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800cc9:	85 c0                	test   %eax,%eax
+  800ccb:	7f 08                	jg     800cd5 <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  800ccd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cd0:	5b                   	pop    %ebx
+  800cd1:	5e                   	pop    %esi
+  800cd2:	5f                   	pop    %edi
+  800cd3:	5d                   	pop    %ebp
+  800cd4:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800cd5:	83 ec 0c             	sub    $0xc,%esp
+  800cd8:	50                   	push   %eax
+  800cd9:	6a 16                	push   $0x16
+  800cdb:	68 43 32 80 00       	push   $0x803243
+  800ce0:	6a 23                	push   $0x23
+  800ce2:	68 60 32 80 00       	push   $0x803260
+  800ce7:	e8 e0 1d 00 00       	call   802acc <_panic>
+
+00800cec <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  800cec:	55                   	push   %ebp
+  800ced:	89 e5                	mov    %esp,%ebp
+  800cef:	57                   	push   %edi
+  800cf0:	56                   	push   %esi
+  800cf1:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800cf2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cf7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cfa:	b8 17 00 00 00       	mov    $0x17,%eax
+  800cff:	89 cb                	mov    %ecx,%ebx
+  800d01:	89 cf                	mov    %ecx,%edi
+  800d03:	89 ce                	mov    %ecx,%esi
+  800d05:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  800d07:	5b                   	pop    %ebx
+  800d08:	5e                   	pop    %esi
+  800d09:	5f                   	pop    %edi
+  800d0a:	5d                   	pop    %ebp
+  800d0b:	c3                   	ret
+
+00800d0c <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  800d0c:	55                   	push   %ebp
+  800d0d:	89 e5                	mov    %esp,%ebp
+  800d0f:	57                   	push   %edi
+  800d10:	56                   	push   %esi
+  800d11:	53                   	push   %ebx
+  800d12:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800d15:	be 00 00 00 00       	mov    $0x0,%esi
+  800d1a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d1d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d20:	b8 18 00 00 00       	mov    $0x18,%eax
+  800d25:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d28:	89 f7                	mov    %esi,%edi
+  800d2a:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d2c:	85 c0                	test   %eax,%eax
+  800d2e:	7f 08                	jg     800d38 <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  800d30:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d33:	5b                   	pop    %ebx
+  800d34:	5e                   	pop    %esi
+  800d35:	5f                   	pop    %edi
+  800d36:	5d                   	pop    %ebp
+  800d37:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d38:	83 ec 0c             	sub    $0xc,%esp
+  800d3b:	50                   	push   %eax
+  800d3c:	6a 18                	push   $0x18
+  800d3e:	68 43 32 80 00       	push   $0x803243
+  800d43:	6a 23                	push   $0x23
+  800d45:	68 60 32 80 00       	push   $0x803260
+  800d4a:	e8 7d 1d 00 00       	call   802acc <_panic>
+
+00800d4f <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  800d4f:	55                   	push   %ebp
+  800d50:	89 e5                	mov    %esp,%ebp
+  800d52:	57                   	push   %edi
+  800d53:	56                   	push   %esi
+  800d54:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d55:	be 00 00 00 00       	mov    $0x0,%esi
+  800d5a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d5d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d60:	b8 19 00 00 00       	mov    $0x19,%eax
+  800d65:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d68:	89 f7                	mov    %esi,%edi
+  800d6a:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  800d6c:	5b                   	pop    %ebx
+  800d6d:	5e                   	pop    %esi
+  800d6e:	5f                   	pop    %edi
+  800d6f:	5d                   	pop    %ebp
+  800d70:	c3                   	ret
+
+00800d71 <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  800d71:	55                   	push   %ebp
+  800d72:	89 e5                	mov    %esp,%ebp
+  800d74:	57                   	push   %edi
+  800d75:	56                   	push   %esi
+  800d76:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d77:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d7c:	b8 15 00 00 00       	mov    $0x15,%eax
+  800d81:	89 d1                	mov    %edx,%ecx
+  800d83:	89 d3                	mov    %edx,%ebx
+  800d85:	89 d7                	mov    %edx,%edi
+  800d87:	89 d6                	mov    %edx,%esi
+  800d89:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800d8b:	5b                   	pop    %ebx
+  800d8c:	5e                   	pop    %esi
+  800d8d:	5f                   	pop    %edi
+  800d8e:	5d                   	pop    %ebp
+  800d8f:	c3                   	ret
+
+00800d90 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800d90:	55                   	push   %ebp
+  800d91:	89 e5                	mov    %esp,%ebp
+  800d93:	57                   	push   %edi
+  800d94:	56                   	push   %esi
+  800d95:	53                   	push   %ebx
+  800d96:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800d99:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d9e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800da1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800da4:	b8 08 00 00 00       	mov    $0x8,%eax
+  800da9:	89 df                	mov    %ebx,%edi
+  800dab:	89 de                	mov    %ebx,%esi
+  800dad:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800daf:	85 c0                	test   %eax,%eax
+  800db1:	7f 08                	jg     800dbb <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800db3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800db6:	5b                   	pop    %ebx
+  800db7:	5e                   	pop    %esi
+  800db8:	5f                   	pop    %edi
+  800db9:	5d                   	pop    %ebp
+  800dba:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800dbb:	83 ec 0c             	sub    $0xc,%esp
+  800dbe:	50                   	push   %eax
+  800dbf:	6a 08                	push   $0x8
+  800dc1:	68 43 32 80 00       	push   $0x803243
+  800dc6:	6a 23                	push   $0x23
+  800dc8:	68 60 32 80 00       	push   $0x803260
+  800dcd:	e8 fa 1c 00 00       	call   802acc <_panic>
+
+00800dd2 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800dd2:	55                   	push   %ebp
+  800dd3:	89 e5                	mov    %esp,%ebp
+  800dd5:	57                   	push   %edi
+  800dd6:	56                   	push   %esi
+  800dd7:	53                   	push   %ebx
+  800dd8:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800ddb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800de0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800de3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800de6:	b8 09 00 00 00       	mov    $0x9,%eax
+  800deb:	89 df                	mov    %ebx,%edi
+  800ded:	89 de                	mov    %ebx,%esi
+  800def:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800df1:	85 c0                	test   %eax,%eax
+  800df3:	7f 08                	jg     800dfd <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  800df5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800df8:	5b                   	pop    %ebx
+  800df9:	5e                   	pop    %esi
+  800dfa:	5f                   	pop    %edi
+  800dfb:	5d                   	pop    %ebp
+  800dfc:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800dfd:	83 ec 0c             	sub    $0xc,%esp
+  800e00:	50                   	push   %eax
+  800e01:	6a 09                	push   $0x9
+  800e03:	68 43 32 80 00       	push   $0x803243
+  800e08:	6a 23                	push   $0x23
+  800e0a:	68 60 32 80 00       	push   $0x803260
+  800e0f:	e8 b8 1c 00 00       	call   802acc <_panic>
+
+00800e14 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800e14:	55                   	push   %ebp
+  800e15:	89 e5                	mov    %esp,%ebp
+  800e17:	57                   	push   %edi
+  800e18:	56                   	push   %esi
+  800e19:	53                   	push   %ebx
+  800e1a:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e1d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e22:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e25:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e28:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e2d:	89 df                	mov    %ebx,%edi
+  800e2f:	89 de                	mov    %ebx,%esi
+  800e31:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e33:	85 c0                	test   %eax,%eax
+  800e35:	7f 08                	jg     800e3f <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  800e37:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e3a:	5b                   	pop    %ebx
+  800e3b:	5e                   	pop    %esi
+  800e3c:	5f                   	pop    %edi
+  800e3d:	5d                   	pop    %ebp
+  800e3e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e3f:	83 ec 0c             	sub    $0xc,%esp
+  800e42:	50                   	push   %eax
+  800e43:	6a 0a                	push   $0xa
+  800e45:	68 43 32 80 00       	push   $0x803243
+  800e4a:	6a 23                	push   $0x23
+  800e4c:	68 60 32 80 00       	push   $0x803260
+  800e51:	e8 76 1c 00 00       	call   802acc <_panic>
+
+00800e56 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  800e56:	55                   	push   %ebp
+  800e57:	89 e5                	mov    %esp,%ebp
+  800e59:	57                   	push   %edi
+  800e5a:	56                   	push   %esi
+  800e5b:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e5c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e5f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e62:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800e67:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e6a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e6d:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e70:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  800e72:	5b                   	pop    %ebx
+  800e73:	5e                   	pop    %esi
+  800e74:	5f                   	pop    %edi
+  800e75:	5d                   	pop    %ebp
+  800e76:	c3                   	ret
+
+00800e77 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  800e77:	55                   	push   %ebp
+  800e78:	89 e5                	mov    %esp,%ebp
+  800e7a:	57                   	push   %edi
+  800e7b:	56                   	push   %esi
+  800e7c:	53                   	push   %ebx
+  800e7d:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e80:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e85:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e88:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e8b:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e90:	89 df                	mov    %ebx,%edi
+  800e92:	89 de                	mov    %ebx,%esi
+  800e94:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e96:	85 c0                	test   %eax,%eax
+  800e98:	7f 08                	jg     800ea2 <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  800e9a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e9d:	5b                   	pop    %ebx
+  800e9e:	5e                   	pop    %esi
+  800e9f:	5f                   	pop    %edi
+  800ea0:	5d                   	pop    %ebp
+  800ea1:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ea2:	83 ec 0c             	sub    $0xc,%esp
+  800ea5:	50                   	push   %eax
+  800ea6:	6a 0d                	push   $0xd
+  800ea8:	68 43 32 80 00       	push   $0x803243
+  800ead:	6a 23                	push   $0x23
+  800eaf:	68 60 32 80 00       	push   $0x803260
+  800eb4:	e8 13 1c 00 00       	call   802acc <_panic>
+
+00800eb9 <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  800eb9:	55                   	push   %ebp
+  800eba:	89 e5                	mov    %esp,%ebp
+  800ebc:	57                   	push   %edi
+  800ebd:	56                   	push   %esi
+  800ebe:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800ebf:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ec4:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800ec9:	89 d1                	mov    %edx,%ecx
+  800ecb:	89 d3                	mov    %edx,%ebx
+  800ecd:	89 d7                	mov    %edx,%edi
+  800ecf:	89 d6                	mov    %edx,%esi
+  800ed1:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800ed3:	5b                   	pop    %ebx
+  800ed4:	5e                   	pop    %esi
+  800ed5:	5f                   	pop    %edi
+  800ed6:	5d                   	pop    %ebp
+  800ed7:	c3                   	ret
+
+00800ed8 <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  800ed8:	55                   	push   %ebp
+  800ed9:	89 e5                	mov    %esp,%ebp
+  800edb:	57                   	push   %edi
+  800edc:	56                   	push   %esi
+  800edd:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800ede:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ee4:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800ee9:	be 00 00 00 00       	mov    $0x0,%esi
+  800eee:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ef1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ef4:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  800ef6:	5b                   	pop    %ebx
+  800ef7:	5e                   	pop    %esi
+  800ef8:	5f                   	pop    %edi
+  800ef9:	5d                   	pop    %ebp
+  800efa:	c3                   	ret
+
+00800efb <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  800efb:	55                   	push   %ebp
+  800efc:	89 e5                	mov    %esp,%ebp
+  800efe:	57                   	push   %edi
+  800eff:	56                   	push   %esi
+  800f00:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f01:	be 00 00 00 00       	mov    $0x0,%esi
+  800f06:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f09:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f0c:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f11:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f14:	89 f7                	mov    %esi,%edi
+  800f16:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  800f18:	5b                   	pop    %ebx
+  800f19:	5e                   	pop    %esi
+  800f1a:	5f                   	pop    %edi
+  800f1b:	5d                   	pop    %ebp
+  800f1c:	c3                   	ret
+
+00800f1d <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  800f1d:	55                   	push   %ebp
+  800f1e:	89 e5                	mov    %esp,%ebp
+  800f20:	57                   	push   %edi
+  800f21:	56                   	push   %esi
+  800f22:	53                   	push   %ebx
+  800f23:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  800f26:	80 3d 48 57 80 00 00 	cmpb   $0x0,0x805748
+  800f2d:	74 41                	je     800f70 <sys_batch+0x53>
+  800f2f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f32:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  800f35:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  800f3c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800f3f:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  800f42:	7d 45                	jge    800f89 <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  800f44:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800f47:	8b 06                	mov    (%esi),%eax
+  800f49:	8b 56 04             	mov    0x4(%esi),%edx
+  800f4c:	8b 4e 08             	mov    0x8(%esi),%ecx
+  800f4f:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  800f52:	8b 7e 10             	mov    0x10(%esi),%edi
+  800f55:	8b 76 14             	mov    0x14(%esi),%esi
+  800f58:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  800f5a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800f5d:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  800f60:	83 c6 1c             	add    $0x1c,%esi
+  800f63:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  800f66:	85 c0                	test   %eax,%eax
+  800f68:	78 1f                	js     800f89 <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  800f6a:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  800f6e:	eb cc                	jmp    800f3c <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  800f70:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f75:	b8 13 00 00 00       	mov    $0x13,%eax
+  800f7a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f7d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f80:	89 df                	mov    %ebx,%edi
+  800f82:	89 de                	mov    %ebx,%esi
+  800f84:	cd 30                	int    $0x30
+  800f86:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  800f89:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800f8c:	83 c4 08             	add    $0x8,%esp
+  800f8f:	5b                   	pop    %ebx
+  800f90:	5e                   	pop    %esi
+  800f91:	5f                   	pop    %edi
+  800f92:	5d                   	pop    %ebp
+  800f93:	c3                   	ret
+
+00800f94 <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  800f94:	55                   	push   %ebp
+  800f95:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  800f97:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f9a:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  800fa0:	5d                   	pop    %ebp
+  800fa1:	c3                   	ret
+
+00800fa2 <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  800fa2:	55                   	push   %ebp
+  800fa3:	89 e5                	mov    %esp,%ebp
+  800fa5:	56                   	push   %esi
+  800fa6:	53                   	push   %ebx
+  800fa7:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  800faa:	8b 1e                	mov    (%esi),%ebx
+  800fac:	85 db                	test   %ebx,%ebx
+  800fae:	75 09                	jne    800fb9 <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  800fb0:	89 d8                	mov    %ebx,%eax
+  800fb2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fb5:	5b                   	pop    %ebx
+  800fb6:	5e                   	pop    %esi
+  800fb7:	5d                   	pop    %ebp
+  800fb8:	c3                   	ret
+  b->sb_n = 0;
+  800fb9:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  800fbf:	53                   	push   %ebx
+  800fc0:	8d 46 04             	lea    0x4(%esi),%eax
+  800fc3:	50                   	push   %eax
+  800fc4:	e8 54 ff ff ff       	call   800f1d <sys_batch>
+  800fc9:	83 c4 08             	add    $0x8,%esp
+  800fcc:	85 c0                	test   %eax,%eax
+  800fce:	78 1e                	js     800fee <sysbatch_flush+0x4c>
+  if (r < n)
+  800fd0:	39 c3                	cmp    %eax,%ebx
+  800fd2:	7f 07                	jg     800fdb <sysbatch_flush+0x39>
+  return 0;
+  800fd4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fd9:	eb d5                	jmp    800fb0 <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  800fdb:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  800fde:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  800fe2:	85 db                	test   %ebx,%ebx
+  800fe4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800fe9:	0f 49 d8             	cmovns %eax,%ebx
+  800fec:	eb c2                	jmp    800fb0 <sysbatch_flush+0xe>
+    return r;
+  800fee:	89 c3                	mov    %eax,%ebx
+  800ff0:	eb be                	jmp    800fb0 <sysbatch_flush+0xe>
+
+00800ff2 <sysbatch_add>:
+{
+  800ff2:	55                   	push   %ebp
+  800ff3:	89 e5                	mov    %esp,%ebp
+  800ff5:	53                   	push   %ebx
+  800ff6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  800ff9:	83 3b 40             	cmpl   $0x40,(%ebx)
+  800ffc:	74 41                	je     80103f <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  800ffe:	8b 03                	mov    (%ebx),%eax
+  801000:	8d 50 01             	lea    0x1(%eax),%edx
+  801003:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  801005:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801008:	01 d8                	add    %ebx,%eax
+  80100a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80100d:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  801010:	8b 55 10             	mov    0x10(%ebp),%edx
+  801013:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  801016:	8b 55 14             	mov    0x14(%ebp),%edx
+  801019:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  80101c:	8b 55 18             	mov    0x18(%ebp),%edx
+  80101f:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  801022:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  801025:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  801028:	8b 55 20             	mov    0x20(%ebp),%edx
+  80102b:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  80102e:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  801035:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80103a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80103d:	c9                   	leave
+  80103e:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  80103f:	53                   	push   %ebx
+  801040:	e8 5d ff ff ff       	call   800fa2 <sysbatch_flush>
+  801045:	83 c4 04             	add    $0x4,%esp
+  801048:	85 c0                	test   %eax,%eax
+  80104a:	79 b2                	jns    800ffe <sysbatch_add+0xc>
+  80104c:	eb ec                	jmp    80103a <sysbatch_add+0x48>
+
+0080104e <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  80104e:	55                   	push   %ebp
+  80104f:	89 e5                	mov    %esp,%ebp
+  801051:	53                   	push   %ebx
+  801052:	83 ec 04             	sub    $0x4,%esp
+  int r;
+
+  if (_pgfault_handler == 0) {
+  801055:	83 3d 4c 57 80 00 00 	cmpl   $0x0,0x80574c
+  80105c:	74 0d                	je     80106b <set_pgfault_handler+0x1d>
+
+    sys_env_set_pgfault_upcall(id, _pgfault_upcall);
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  80105e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801061:	a3 4c 57 80 00       	mov    %eax,0x80574c
+}
+  801066:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801069:	c9                   	leave
+  80106a:	c3                   	ret
+    envid_t id = sys_getenvid();
+  80106b:	e8 ae fa ff ff       	call   800b1e <sys_getenvid>
+  801070:	89 c3                	mov    %eax,%ebx
+    sys_page_alloc(id, (void *) (UXSTACKTOP - PGSIZE), (PTE_P | PTE_U | PTE_W));
+  801072:	83 ec 04             	sub    $0x4,%esp
+  801075:	6a 07                	push   $0x7
+  801077:	68 00 f0 bf ee       	push   $0xeebff000
+  80107c:	50                   	push   %eax
+  80107d:	e8 1d fb ff ff       	call   800b9f <sys_page_alloc>
+    sys_env_set_pgfault_upcall(id, _pgfault_upcall);
+  801082:	83 c4 08             	add    $0x8,%esp
+  801085:	68 95 10 80 00       	push   $0x801095
+  80108a:	53                   	push   %ebx
+  80108b:	e8 84 fd ff ff       	call   800e14 <sys_env_set_pgfault_upcall>
+  801090:	83 c4 10             	add    $0x10,%esp
+  801093:	eb c9                	jmp    80105e <set_pgfault_handler+0x10>
+
+00801095 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  801095:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  801096:	a1 4c 57 80 00       	mov    0x80574c,%eax
+	call *%eax
+  80109b:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80109d:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+  movl 48(%esp), %eax       // move trap time esp to eax
+  8010a0:	8b 44 24 30          	mov    0x30(%esp),%eax
+  subl $4, %eax             // make room for eip on trap time esp
+  8010a4:	83 e8 04             	sub    $0x4,%eax
+  movl %eax, 48(%esp)       // move value to esp
+  8010a7:	89 44 24 30          	mov    %eax,0x30(%esp)
+  movl 40(%esp), %ebx       // move trap time eip to ebx
+  8010ab:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+  movl %ebx, 0(%eax)
+  8010af:	89 18                	mov    %ebx,(%eax)
+
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+  addl $0x08,%esp
+  8010b1:	83 c4 08             	add    $0x8,%esp
+  popal
+  8010b4:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+  addl $4, %esp          // skip tf->eip
+  8010b5:	83 c4 04             	add    $0x4,%esp
+  popf                 // pop stack value into flags register
+  8010b8:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+  popl %esp
+  8010b9:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+  ret
+  8010ba:	c3                   	ret
+
+008010bb <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8010bb:	55                   	push   %ebp
+  8010bc:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8010be:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010c1:	05 00 00 00 30       	add    $0x30000000,%eax
+  8010c6:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8010c9:	5d                   	pop    %ebp
+  8010ca:	c3                   	ret
+
+008010cb <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8010cb:	55                   	push   %ebp
+  8010cc:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8010ce:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010d1:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  8010d4:	66 b8 00 00          	mov    $0x0,%ax
+  8010d8:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8010dd:	5d                   	pop    %ebp
+  8010de:	c3                   	ret
+
+008010df <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8010df:	55                   	push   %ebp
+  8010e0:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  8010e2:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8010e7:	eb 02                	jmp    8010eb <fd_alloc+0xc>
+  8010e9:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8010eb:	89 c2                	mov    %eax,%edx
+  8010ed:	c1 ea 16             	shr    $0x16,%edx
+  8010f0:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8010f7:	f6 c2 01             	test   $0x1,%dl
+  8010fa:	74 2b                	je     801127 <fd_alloc+0x48>
+  8010fc:	89 c2                	mov    %eax,%edx
+  8010fe:	c1 ea 0c             	shr    $0xc,%edx
+  801101:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801108:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80110e:	f6 c1 01             	test   $0x1,%cl
+  801111:	74 14                	je     801127 <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  801113:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801119:	75 ce                	jne    8010e9 <fd_alloc+0xa>
+  80111b:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  801120:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801125:	eb 05                	jmp    80112c <fd_alloc+0x4d>
+      return 0;
+  801127:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  80112c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80112f:	89 02                	mov    %eax,(%edx)
+}
+  801131:	89 c8                	mov    %ecx,%eax
+  801133:	5d                   	pop    %ebp
+  801134:	c3                   	ret
+
+00801135 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801135:	55                   	push   %ebp
+  801136:	89 e5                	mov    %esp,%ebp
+  801138:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  80113b:	83 f8 1f             	cmp    $0x1f,%eax
+  80113e:	77 30                	ja     801170 <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  801140:	c1 e0 0c             	shl    $0xc,%eax
+  801143:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801148:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80114e:	f6 c2 01             	test   $0x1,%dl
+  801151:	74 24                	je     801177 <fd_lookup+0x42>
+  801153:	89 c2                	mov    %eax,%edx
+  801155:	c1 ea 0c             	shr    $0xc,%edx
+  801158:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80115f:	f6 c2 01             	test   $0x1,%dl
+  801162:	74 1a                	je     80117e <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  801164:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801167:	89 02                	mov    %eax,(%edx)
+  return 0;
+  801169:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80116e:	5d                   	pop    %ebp
+  80116f:	c3                   	ret
+    return -E_INVAL;
+  801170:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801175:	eb f7                	jmp    80116e <fd_lookup+0x39>
+    return -E_INVAL;
+  801177:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80117c:	eb f0                	jmp    80116e <fd_lookup+0x39>
+  80117e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801183:	eb e9                	jmp    80116e <fd_lookup+0x39>
+
+00801185 <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801185:	55                   	push   %ebp
+  801186:	89 e5                	mov    %esp,%ebp
+  801188:	53                   	push   %ebx
+  801189:	83 ec 04             	sub    $0x4,%esp
+  80118c:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  80118f:	b8 ec 32 80 00       	mov    $0x8032ec,%eax
+  801194:	8b 18                	mov    (%eax),%ebx
+  801196:	85 db                	test   %ebx,%ebx
+  801198:	74 0e                	je     8011a8 <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  80119a:	83 c0 04             	add    $0x4,%eax
+  80119d:	39 13                	cmp    %edx,(%ebx)
+  80119f:	75 f3                	jne    801194 <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  8011a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011a6:	eb 1f                	jmp    8011c7 <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8011a8:	a1 44 57 80 00       	mov    0x805744,%eax
+  8011ad:	8b 40 48             	mov    0x48(%eax),%eax
+  8011b0:	83 ec 04             	sub    $0x4,%esp
+  8011b3:	52                   	push   %edx
+  8011b4:	50                   	push   %eax
+  8011b5:	68 70 32 80 00       	push   $0x803270
+  8011ba:	e8 c3 ef ff ff       	call   800182 <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  8011bf:	83 c4 10             	add    $0x10,%esp
+  8011c2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  8011c7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8011ca:	89 1a                	mov    %ebx,(%edx)
+}
+  8011cc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8011cf:	c9                   	leave
+  8011d0:	c3                   	ret
+
+008011d1 <fd_close>:
+{
+  8011d1:	55                   	push   %ebp
+  8011d2:	89 e5                	mov    %esp,%ebp
+  8011d4:	57                   	push   %edi
+  8011d5:	56                   	push   %esi
+  8011d6:	53                   	push   %ebx
+  8011d7:	83 ec 24             	sub    $0x24,%esp
+  8011da:	8b 75 08             	mov    0x8(%ebp),%esi
+  8011dd:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8011e0:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8011e3:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8011e4:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8011ea:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8011ed:	50                   	push   %eax
+  8011ee:	e8 42 ff ff ff       	call   801135 <fd_lookup>
+  8011f3:	89 c3                	mov    %eax,%ebx
+  8011f5:	83 c4 10             	add    $0x10,%esp
+  8011f8:	85 c0                	test   %eax,%eax
+  8011fa:	78 05                	js     801201 <fd_close+0x30>
+      || fd != fd2)
+  8011fc:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8011ff:	74 16                	je     801217 <fd_close+0x46>
+    return must_exist ? r : 0;
+  801201:	89 f8                	mov    %edi,%eax
+  801203:	84 c0                	test   %al,%al
+  801205:	b8 00 00 00 00       	mov    $0x0,%eax
+  80120a:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80120d:	89 d8                	mov    %ebx,%eax
+  80120f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801212:	5b                   	pop    %ebx
+  801213:	5e                   	pop    %esi
+  801214:	5f                   	pop    %edi
+  801215:	5d                   	pop    %ebp
+  801216:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801217:	83 ec 08             	sub    $0x8,%esp
+  80121a:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80121d:	50                   	push   %eax
+  80121e:	ff 36                	push   (%esi)
+  801220:	e8 60 ff ff ff       	call   801185 <dev_lookup>
+  801225:	89 c3                	mov    %eax,%ebx
+  801227:	83 c4 10             	add    $0x10,%esp
+  80122a:	85 c0                	test   %eax,%eax
+  80122c:	78 1a                	js     801248 <fd_close+0x77>
+    if (dev->dev_close)
+  80122e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801231:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  801234:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  801239:	85 c0                	test   %eax,%eax
+  80123b:	74 0b                	je     801248 <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  80123d:	83 ec 0c             	sub    $0xc,%esp
+  801240:	56                   	push   %esi
+  801241:	ff d0                	call   *%eax
+  801243:	89 c3                	mov    %eax,%ebx
+  801245:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  801248:	83 ec 08             	sub    $0x8,%esp
+  80124b:	56                   	push   %esi
+  80124c:	6a 00                	push   $0x0
+  80124e:	e8 d1 f9 ff ff       	call   800c24 <sys_page_unmap>
+  return r;
+  801253:	83 c4 10             	add    $0x10,%esp
+  801256:	eb b5                	jmp    80120d <fd_close+0x3c>
+
+00801258 <close>:
+
+int
+close(int fdnum)
+{
+  801258:	55                   	push   %ebp
+  801259:	89 e5                	mov    %esp,%ebp
+  80125b:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80125e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801261:	50                   	push   %eax
+  801262:	ff 75 08             	push   0x8(%ebp)
+  801265:	e8 cb fe ff ff       	call   801135 <fd_lookup>
+  80126a:	83 c4 10             	add    $0x10,%esp
+  80126d:	85 c0                	test   %eax,%eax
+  80126f:	79 02                	jns    801273 <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  801271:	c9                   	leave
+  801272:	c3                   	ret
+    return fd_close(fd, 1);
+  801273:	83 ec 08             	sub    $0x8,%esp
+  801276:	6a 01                	push   $0x1
+  801278:	ff 75 f4             	push   -0xc(%ebp)
+  80127b:	e8 51 ff ff ff       	call   8011d1 <fd_close>
+  801280:	83 c4 10             	add    $0x10,%esp
+  801283:	eb ec                	jmp    801271 <close+0x19>
+
+00801285 <close_all>:
+
+void
+close_all(void)
+{
+  801285:	55                   	push   %ebp
+  801286:	89 e5                	mov    %esp,%ebp
+  801288:	53                   	push   %ebx
+  801289:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  80128c:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  801291:	83 ec 0c             	sub    $0xc,%esp
+  801294:	53                   	push   %ebx
+  801295:	e8 be ff ff ff       	call   801258 <close>
+  for (i = 0; i < MAXFD; i++)
+  80129a:	83 c3 01             	add    $0x1,%ebx
+  80129d:	83 c4 10             	add    $0x10,%esp
+  8012a0:	83 fb 20             	cmp    $0x20,%ebx
+  8012a3:	75 ec                	jne    801291 <close_all+0xc>
+}
+  8012a5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012a8:	c9                   	leave
+  8012a9:	c3                   	ret
+
+008012aa <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8012aa:	55                   	push   %ebp
+  8012ab:	89 e5                	mov    %esp,%ebp
+  8012ad:	57                   	push   %edi
+  8012ae:	56                   	push   %esi
+  8012af:	53                   	push   %ebx
+  8012b0:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8012b3:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8012b6:	50                   	push   %eax
+  8012b7:	ff 75 08             	push   0x8(%ebp)
+  8012ba:	e8 76 fe ff ff       	call   801135 <fd_lookup>
+  8012bf:	89 c6                	mov    %eax,%esi
+  8012c1:	83 c4 10             	add    $0x10,%esp
+  8012c4:	85 c0                	test   %eax,%eax
+  8012c6:	0f 88 0a 01 00 00    	js     8013d6 <dup+0x12c>
+    return r;
+  close(newfdnum);
+  8012cc:	83 ec 0c             	sub    $0xc,%esp
+  8012cf:	ff 75 0c             	push   0xc(%ebp)
+  8012d2:	e8 81 ff ff ff       	call   801258 <close>
+
+  newfd = INDEX2FD(newfdnum);
+  8012d7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8012da:	c1 e0 0c             	shl    $0xc,%eax
+  8012dd:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  8012e3:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  8012e6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8012e9:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8012ec:	89 04 24             	mov    %eax,(%esp)
+  8012ef:	e8 d7 fd ff ff       	call   8010cb <fd2data>
+  8012f4:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  8012f6:	89 3c 24             	mov    %edi,(%esp)
+  8012f9:	e8 cd fd ff ff       	call   8010cb <fd2data>
+  8012fe:	83 c4 10             	add    $0x10,%esp
+  801301:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801304:	89 f3                	mov    %esi,%ebx
+  801306:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  80130c:	89 c6                	mov    %eax,%esi
+  80130e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801311:	89 cf                	mov    %ecx,%edi
+  801313:	eb 0c                	jmp    801321 <dup+0x77>
+  801315:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80131b:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801321:	39 fb                	cmp    %edi,%ebx
+  801323:	74 7b                	je     8013a0 <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  801325:	89 d8                	mov    %ebx,%eax
+  801327:	c1 e8 16             	shr    $0x16,%eax
+  80132a:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801331:	a8 01                	test   $0x1,%al
+  801333:	74 e0                	je     801315 <dup+0x6b>
+  801335:	89 d8                	mov    %ebx,%eax
+  801337:	c1 e8 0c             	shr    $0xc,%eax
+  80133a:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801341:	f6 c2 01             	test   $0x1,%dl
+  801344:	74 cf                	je     801315 <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  801346:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  80134d:	83 ec 0c             	sub    $0xc,%esp
+  801350:	25 07 0e 00 00       	and    $0xe07,%eax
+  801355:	50                   	push   %eax
+  801356:	56                   	push   %esi
+  801357:	6a 00                	push   $0x0
+  801359:	53                   	push   %ebx
+  80135a:	6a 00                	push   $0x0
+  80135c:	e8 81 f8 ff ff       	call   800be2 <sys_page_map>
+  801361:	83 c4 20             	add    $0x20,%esp
+  801364:	85 c0                	test   %eax,%eax
+  801366:	79 ad                	jns    801315 <dup+0x6b>
+  801368:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80136b:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  80136d:	83 ec 08             	sub    $0x8,%esp
+  801370:	ff 75 d4             	push   -0x2c(%ebp)
+  801373:	6a 00                	push   $0x0
+  801375:	e8 aa f8 ff ff       	call   800c24 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80137a:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  80137d:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  801383:	83 c4 10             	add    $0x10,%esp
+  801386:	39 df                	cmp    %ebx,%edi
+  801388:	74 4c                	je     8013d6 <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  80138a:	83 ec 08             	sub    $0x8,%esp
+  80138d:	57                   	push   %edi
+  80138e:	6a 00                	push   $0x0
+  801390:	e8 8f f8 ff ff       	call   800c24 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801395:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  80139b:	83 c4 10             	add    $0x10,%esp
+  80139e:	eb e6                	jmp    801386 <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8013a0:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8013a3:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8013a6:	89 c8                	mov    %ecx,%eax
+  8013a8:	c1 e8 0c             	shr    $0xc,%eax
+  8013ab:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8013b2:	83 ec 0c             	sub    $0xc,%esp
+  8013b5:	25 07 0e 00 00       	and    $0xe07,%eax
+  8013ba:	50                   	push   %eax
+  8013bb:	ff 75 d4             	push   -0x2c(%ebp)
+  8013be:	6a 00                	push   $0x0
+  8013c0:	51                   	push   %ecx
+  8013c1:	6a 00                	push   $0x0
+  8013c3:	e8 1a f8 ff ff       	call   800be2 <sys_page_map>
+  8013c8:	89 c6                	mov    %eax,%esi
+  8013ca:	83 c4 20             	add    $0x20,%esp
+  8013cd:	85 c0                	test   %eax,%eax
+  8013cf:	78 9c                	js     80136d <dup+0xc3>
+  return newfdnum;
+  8013d1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8013d4:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  8013d6:	89 f0                	mov    %esi,%eax
+  8013d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013db:	5b                   	pop    %ebx
+  8013dc:	5e                   	pop    %esi
+  8013dd:	5f                   	pop    %edi
+  8013de:	5d                   	pop    %ebp
+  8013df:	c3                   	ret
+
+008013e0 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8013e0:	55                   	push   %ebp
+  8013e1:	89 e5                	mov    %esp,%ebp
+  8013e3:	56                   	push   %esi
+  8013e4:	53                   	push   %ebx
+  8013e5:	83 ec 18             	sub    $0x18,%esp
+  8013e8:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  8013eb:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8013ee:	50                   	push   %eax
+  8013ef:	56                   	push   %esi
+  8013f0:	e8 40 fd ff ff       	call   801135 <fd_lookup>
+  8013f5:	83 c4 10             	add    $0x10,%esp
+  8013f8:	85 c0                	test   %eax,%eax
+  8013fa:	78 3c                	js     801438 <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8013fc:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8013ff:	83 ec 08             	sub    $0x8,%esp
+  801402:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801405:	50                   	push   %eax
+  801406:	ff 33                	push   (%ebx)
+  801408:	e8 78 fd ff ff       	call   801185 <dev_lookup>
+  80140d:	83 c4 10             	add    $0x10,%esp
+  801410:	85 c0                	test   %eax,%eax
+  801412:	78 24                	js     801438 <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801414:	8b 43 08             	mov    0x8(%ebx),%eax
+  801417:	83 e0 03             	and    $0x3,%eax
+  80141a:	83 f8 01             	cmp    $0x1,%eax
+  80141d:	74 20                	je     80143f <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  80141f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801422:	8b 40 08             	mov    0x8(%eax),%eax
+  801425:	85 c0                	test   %eax,%eax
+  801427:	74 37                	je     801460 <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  801429:	83 ec 04             	sub    $0x4,%esp
+  80142c:	ff 75 10             	push   0x10(%ebp)
+  80142f:	ff 75 0c             	push   0xc(%ebp)
+  801432:	53                   	push   %ebx
+  801433:	ff d0                	call   *%eax
+  801435:	83 c4 10             	add    $0x10,%esp
+}
+  801438:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80143b:	5b                   	pop    %ebx
+  80143c:	5e                   	pop    %esi
+  80143d:	5d                   	pop    %ebp
+  80143e:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80143f:	a1 44 57 80 00       	mov    0x805744,%eax
+  801444:	8b 40 48             	mov    0x48(%eax),%eax
+  801447:	83 ec 04             	sub    $0x4,%esp
+  80144a:	56                   	push   %esi
+  80144b:	50                   	push   %eax
+  80144c:	68 b1 32 80 00       	push   $0x8032b1
+  801451:	e8 2c ed ff ff       	call   800182 <cprintf>
+    return -E_INVAL;
+  801456:	83 c4 10             	add    $0x10,%esp
+  801459:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80145e:	eb d8                	jmp    801438 <read+0x58>
+    return -E_NOT_SUPP;
+  801460:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801465:	eb d1                	jmp    801438 <read+0x58>
+
+00801467 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801467:	55                   	push   %ebp
+  801468:	89 e5                	mov    %esp,%ebp
+  80146a:	57                   	push   %edi
+  80146b:	56                   	push   %esi
+  80146c:	53                   	push   %ebx
+  80146d:	83 ec 0c             	sub    $0xc,%esp
+  801470:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801473:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  801476:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80147b:	eb 02                	jmp    80147f <readn+0x18>
+  80147d:	01 c3                	add    %eax,%ebx
+  80147f:	39 f3                	cmp    %esi,%ebx
+  801481:	73 21                	jae    8014a4 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  801483:	83 ec 04             	sub    $0x4,%esp
+  801486:	89 f0                	mov    %esi,%eax
+  801488:	29 d8                	sub    %ebx,%eax
+  80148a:	50                   	push   %eax
+  80148b:	89 d8                	mov    %ebx,%eax
+  80148d:	03 45 0c             	add    0xc(%ebp),%eax
+  801490:	50                   	push   %eax
+  801491:	57                   	push   %edi
+  801492:	e8 49 ff ff ff       	call   8013e0 <read>
+    if (m < 0)
+  801497:	83 c4 10             	add    $0x10,%esp
+  80149a:	85 c0                	test   %eax,%eax
+  80149c:	78 04                	js     8014a2 <readn+0x3b>
+      return m;
+    if (m == 0)
+  80149e:	75 dd                	jne    80147d <readn+0x16>
+  8014a0:	eb 02                	jmp    8014a4 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  8014a2:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  8014a4:	89 d8                	mov    %ebx,%eax
+  8014a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014a9:	5b                   	pop    %ebx
+  8014aa:	5e                   	pop    %esi
+  8014ab:	5f                   	pop    %edi
+  8014ac:	5d                   	pop    %ebp
+  8014ad:	c3                   	ret
+
+008014ae <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8014ae:	55                   	push   %ebp
+  8014af:	89 e5                	mov    %esp,%ebp
+  8014b1:	56                   	push   %esi
+  8014b2:	53                   	push   %ebx
+  8014b3:	83 ec 18             	sub    $0x18,%esp
+  8014b6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  8014b9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8014bc:	50                   	push   %eax
+  8014bd:	53                   	push   %ebx
+  8014be:	e8 72 fc ff ff       	call   801135 <fd_lookup>
+  8014c3:	83 c4 10             	add    $0x10,%esp
+  8014c6:	85 c0                	test   %eax,%eax
+  8014c8:	78 37                	js     801501 <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8014ca:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8014cd:	83 ec 08             	sub    $0x8,%esp
+  8014d0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014d3:	50                   	push   %eax
+  8014d4:	ff 36                	push   (%esi)
+  8014d6:	e8 aa fc ff ff       	call   801185 <dev_lookup>
+  8014db:	83 c4 10             	add    $0x10,%esp
+  8014de:	85 c0                	test   %eax,%eax
+  8014e0:	78 1f                	js     801501 <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8014e2:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8014e6:	74 20                	je     801508 <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  8014e8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014eb:	8b 40 0c             	mov    0xc(%eax),%eax
+  8014ee:	85 c0                	test   %eax,%eax
+  8014f0:	74 37                	je     801529 <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  8014f2:	83 ec 04             	sub    $0x4,%esp
+  8014f5:	ff 75 10             	push   0x10(%ebp)
+  8014f8:	ff 75 0c             	push   0xc(%ebp)
+  8014fb:	56                   	push   %esi
+  8014fc:	ff d0                	call   *%eax
+  8014fe:	83 c4 10             	add    $0x10,%esp
+}
+  801501:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801504:	5b                   	pop    %ebx
+  801505:	5e                   	pop    %esi
+  801506:	5d                   	pop    %ebp
+  801507:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801508:	a1 44 57 80 00       	mov    0x805744,%eax
+  80150d:	8b 40 48             	mov    0x48(%eax),%eax
+  801510:	83 ec 04             	sub    $0x4,%esp
+  801513:	53                   	push   %ebx
+  801514:	50                   	push   %eax
+  801515:	68 cd 32 80 00       	push   $0x8032cd
+  80151a:	e8 63 ec ff ff       	call   800182 <cprintf>
+    return -E_INVAL;
+  80151f:	83 c4 10             	add    $0x10,%esp
+  801522:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801527:	eb d8                	jmp    801501 <write+0x53>
+    return -E_NOT_SUPP;
+  801529:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80152e:	eb d1                	jmp    801501 <write+0x53>
+
+00801530 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801530:	55                   	push   %ebp
+  801531:	89 e5                	mov    %esp,%ebp
+  801533:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801536:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801539:	50                   	push   %eax
+  80153a:	ff 75 08             	push   0x8(%ebp)
+  80153d:	e8 f3 fb ff ff       	call   801135 <fd_lookup>
+  801542:	83 c4 10             	add    $0x10,%esp
+  801545:	85 c0                	test   %eax,%eax
+  801547:	78 0e                	js     801557 <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  801549:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80154c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80154f:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  801552:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801557:	c9                   	leave
+  801558:	c3                   	ret
+
+00801559 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801559:	55                   	push   %ebp
+  80155a:	89 e5                	mov    %esp,%ebp
+  80155c:	56                   	push   %esi
+  80155d:	53                   	push   %ebx
+  80155e:	83 ec 18             	sub    $0x18,%esp
+  801561:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801564:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801567:	50                   	push   %eax
+  801568:	53                   	push   %ebx
+  801569:	e8 c7 fb ff ff       	call   801135 <fd_lookup>
+  80156e:	83 c4 10             	add    $0x10,%esp
+  801571:	85 c0                	test   %eax,%eax
+  801573:	78 34                	js     8015a9 <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801575:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801578:	83 ec 08             	sub    $0x8,%esp
+  80157b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80157e:	50                   	push   %eax
+  80157f:	ff 36                	push   (%esi)
+  801581:	e8 ff fb ff ff       	call   801185 <dev_lookup>
+  801586:	83 c4 10             	add    $0x10,%esp
+  801589:	85 c0                	test   %eax,%eax
+  80158b:	78 1c                	js     8015a9 <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80158d:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801591:	74 1d                	je     8015b0 <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  801593:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801596:	8b 40 18             	mov    0x18(%eax),%eax
+  801599:	85 c0                	test   %eax,%eax
+  80159b:	74 34                	je     8015d1 <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  80159d:	83 ec 08             	sub    $0x8,%esp
+  8015a0:	ff 75 0c             	push   0xc(%ebp)
+  8015a3:	56                   	push   %esi
+  8015a4:	ff d0                	call   *%eax
+  8015a6:	83 c4 10             	add    $0x10,%esp
+}
+  8015a9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015ac:	5b                   	pop    %ebx
+  8015ad:	5e                   	pop    %esi
+  8015ae:	5d                   	pop    %ebp
+  8015af:	c3                   	ret
+            thisenv->env_id, fdnum);
+  8015b0:	a1 44 57 80 00       	mov    0x805744,%eax
+  8015b5:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8015b8:	83 ec 04             	sub    $0x4,%esp
+  8015bb:	53                   	push   %ebx
+  8015bc:	50                   	push   %eax
+  8015bd:	68 90 32 80 00       	push   $0x803290
+  8015c2:	e8 bb eb ff ff       	call   800182 <cprintf>
+    return -E_INVAL;
+  8015c7:	83 c4 10             	add    $0x10,%esp
+  8015ca:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015cf:	eb d8                	jmp    8015a9 <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  8015d1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015d6:	eb d1                	jmp    8015a9 <ftruncate+0x50>
+
+008015d8 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8015d8:	55                   	push   %ebp
+  8015d9:	89 e5                	mov    %esp,%ebp
+  8015db:	56                   	push   %esi
+  8015dc:	53                   	push   %ebx
+  8015dd:	83 ec 18             	sub    $0x18,%esp
+  8015e0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  8015e3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8015e6:	50                   	push   %eax
+  8015e7:	ff 75 08             	push   0x8(%ebp)
+  8015ea:	e8 46 fb ff ff       	call   801135 <fd_lookup>
+  8015ef:	83 c4 10             	add    $0x10,%esp
+  8015f2:	85 c0                	test   %eax,%eax
+  8015f4:	78 49                	js     80163f <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8015f6:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8015f9:	83 ec 08             	sub    $0x8,%esp
+  8015fc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015ff:	50                   	push   %eax
+  801600:	ff 36                	push   (%esi)
+  801602:	e8 7e fb ff ff       	call   801185 <dev_lookup>
+  801607:	83 c4 10             	add    $0x10,%esp
+  80160a:	85 c0                	test   %eax,%eax
+  80160c:	78 31                	js     80163f <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  80160e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801611:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801615:	74 2f                	je     801646 <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  801617:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  80161a:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801621:	00 00 00 
+  stat->st_isdir = 0;
+  801624:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80162b:	00 00 00 
+  stat->st_dev = dev;
+  80162e:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  801634:	83 ec 08             	sub    $0x8,%esp
+  801637:	53                   	push   %ebx
+  801638:	56                   	push   %esi
+  801639:	ff 50 14             	call   *0x14(%eax)
+  80163c:	83 c4 10             	add    $0x10,%esp
+}
+  80163f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801642:	5b                   	pop    %ebx
+  801643:	5e                   	pop    %esi
+  801644:	5d                   	pop    %ebp
+  801645:	c3                   	ret
+    return -E_NOT_SUPP;
+  801646:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80164b:	eb f2                	jmp    80163f <fstat+0x67>
+
+0080164d <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  80164d:	55                   	push   %ebp
+  80164e:	89 e5                	mov    %esp,%ebp
+  801650:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  801653:	ff 75 0c             	push   0xc(%ebp)
+  801656:	ff 75 08             	push   0x8(%ebp)
+  801659:	e8 58 07 00 00       	call   801db6 <file_stat>
+}
+  80165e:	c9                   	leave
+  80165f:	c3                   	ret
+
+00801660 <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  801660:	55                   	push   %ebp
+  801661:	89 e5                	mov    %esp,%ebp
+  801663:	57                   	push   %edi
+  801664:	56                   	push   %esi
+  801665:	53                   	push   %ebx
+  801666:	83 ec 1c             	sub    $0x1c,%esp
+  801669:	89 c7                	mov    %eax,%edi
+  80166b:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  80166e:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801671:	e9 a2 00 00 00       	jmp    801718 <fsipc_send+0xb8>
+  nfsenvs = 0;
+  801676:	c7 05 00 50 80 00 00 	movl   $0x0,0x805000
+  80167d:	00 00 00 
+  801680:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801685:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  80168a:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  80168f:	be 01 00 00 00       	mov    $0x1,%esi
+  801694:	eb 0f                	jmp    8016a5 <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801696:	83 c0 01             	add    $0x1,%eax
+  801699:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80169e:	74 49                	je     8016e9 <fsipc_send+0x89>
+  8016a0:	83 f9 07             	cmp    $0x7,%ecx
+  8016a3:	7f 50                	jg     8016f5 <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  8016a5:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  8016a8:	c1 e2 04             	shl    $0x4,%edx
+  8016ab:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8016b1:	8b 52 50             	mov    0x50(%edx),%edx
+  8016b4:	83 fa 01             	cmp    $0x1,%edx
+  8016b7:	75 dd                	jne    801696 <fsipc_send+0x36>
+  8016b9:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  8016bc:	c1 e2 04             	shl    $0x4,%edx
+  8016bf:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8016c5:	8b 52 54             	mov    0x54(%edx),%edx
+  8016c8:	85 d2                	test   %edx,%edx
+  8016ca:	74 ca                	je     801696 <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  8016cc:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  8016cf:	c1 e2 04             	shl    $0x4,%edx
+  8016d2:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8016d8:	8b 52 48             	mov    0x48(%edx),%edx
+  8016db:	89 14 8d 20 50 80 00 	mov    %edx,0x805020(,%ecx,4)
+  8016e2:	8d 49 01             	lea    0x1(%ecx),%ecx
+  8016e5:	89 f3                	mov    %esi,%ebx
+  8016e7:	eb ad                	jmp    801696 <fsipc_send+0x36>
+  8016e9:	84 db                	test   %bl,%bl
+  8016eb:	74 38                	je     801725 <fsipc_send+0xc5>
+  8016ed:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  8016f3:	eb 30                	jmp    801725 <fsipc_send+0xc5>
+  8016f5:	84 db                	test   %bl,%bl
+  8016f7:	74 2c                	je     801725 <fsipc_send+0xc5>
+  8016f9:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  8016ff:	eb 24                	jmp    801725 <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  801701:	50                   	push   %eax
+  801702:	68 fc 32 80 00       	push   $0x8032fc
+  801707:	6a 34                	push   $0x34
+  801709:	68 06 33 80 00       	push   $0x803306
+  80170e:	e8 b9 13 00 00       	call   802acc <_panic>
+    }
+    sys_yield();
+  801713:	e8 25 f4 ff ff       	call   800b3d <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  801718:	83 3d 00 50 80 00 03 	cmpl   $0x3,0x805000
+  80171f:	0f 8e 51 ff ff ff    	jle    801676 <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  801725:	a1 44 57 80 00       	mov    0x805744,%eax
+  80172a:	8b 70 48             	mov    0x48(%eax),%esi
+  80172d:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  801733:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801738:	8b 0d 00 50 80 00    	mov    0x805000,%ecx
+  80173e:	39 d9                	cmp    %ebx,%ecx
+  801740:	7e d1                	jle    801713 <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  801742:	83 ec 0c             	sub    $0xc,%esp
+  801745:	ff 75 e0             	push   -0x20(%ebp)
+  801748:	6a 07                	push   $0x7
+  80174a:	ff 75 e4             	push   -0x1c(%ebp)
+  80174d:	57                   	push   %edi
+  80174e:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  801751:	99                   	cltd
+  801752:	f7 f9                	idiv   %ecx
+  801754:	ff 34 95 20 50 80 00 	push   0x805020(,%edx,4)
+  80175b:	e8 f6 f6 ff ff       	call   800e56 <sys_ipc_try_send>
+      if (r == 0)
+  801760:	83 c4 20             	add    $0x20,%esp
+  801763:	85 c0                	test   %eax,%eax
+  801765:	74 0a                	je     801771 <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  801767:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80176a:	75 95                	jne    801701 <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  80176c:	83 c3 01             	add    $0x1,%ebx
+  80176f:	eb c7                	jmp    801738 <fsipc_send+0xd8>
+  }
+}
+  801771:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801774:	5b                   	pop    %ebx
+  801775:	5e                   	pop    %esi
+  801776:	5f                   	pop    %edi
+  801777:	5d                   	pop    %ebp
+  801778:	c3                   	ret
+
+00801779 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801779:	55                   	push   %ebp
+  80177a:	89 e5                	mov    %esp,%ebp
+  80177c:	53                   	push   %ebx
+  80177d:	83 ec 14             	sub    $0x14,%esp
+  801780:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  801782:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  801789:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80178e:	ba 00 60 80 00       	mov    $0x806000,%edx
+  801793:	e8 c8 fe ff ff       	call   801660 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801798:	6a 00                	push   $0x0
+  80179a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80179d:	50                   	push   %eax
+  80179e:	53                   	push   %ebx
+  80179f:	6a 00                	push   $0x0
+  8017a1:	e8 6c 13 00 00       	call   802b12 <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  8017a6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017a9:	c9                   	leave
+  8017aa:	c3                   	ret
+
+008017ab <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8017ab:	55                   	push   %ebp
+  8017ac:	89 e5                	mov    %esp,%ebp
+  8017ae:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8017b1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017b4:	8b 40 0c             	mov    0xc(%eax),%eax
+  8017b7:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.set_size.req_size = newsize;
+  8017bc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8017bf:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  8017c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017c9:	b8 02 00 00 00       	mov    $0x2,%eax
+  8017ce:	e8 a6 ff ff ff       	call   801779 <fsipc>
+}
+  8017d3:	c9                   	leave
+  8017d4:	c3                   	ret
+
+008017d5 <devfile_flush>:
+{
+  8017d5:	55                   	push   %ebp
+  8017d6:	89 e5                	mov    %esp,%ebp
+  8017d8:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8017db:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017de:	8b 40 0c             	mov    0xc(%eax),%eax
+  8017e1:	a3 00 60 80 00       	mov    %eax,0x806000
+  return fsipc(FSREQ_FLUSH, NULL);
+  8017e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017eb:	b8 06 00 00 00       	mov    $0x6,%eax
+  8017f0:	e8 84 ff ff ff       	call   801779 <fsipc>
+}
+  8017f5:	c9                   	leave
+  8017f6:	c3                   	ret
+
+008017f7 <devfile_stat>:
+{
+  8017f7:	55                   	push   %ebp
+  8017f8:	89 e5                	mov    %esp,%ebp
+  8017fa:	53                   	push   %ebx
+  8017fb:	83 ec 04             	sub    $0x4,%esp
+  8017fe:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801801:	8b 45 08             	mov    0x8(%ebp),%eax
+  801804:	8b 40 0c             	mov    0xc(%eax),%eax
+  801807:	a3 00 60 80 00       	mov    %eax,0x806000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80180c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801811:	b8 05 00 00 00       	mov    $0x5,%eax
+  801816:	e8 5e ff ff ff       	call   801779 <fsipc>
+  80181b:	85 c0                	test   %eax,%eax
+  80181d:	78 2c                	js     80184b <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80181f:	83 ec 08             	sub    $0x8,%esp
+  801822:	68 00 60 80 00       	push   $0x806000
+  801827:	53                   	push   %ebx
+  801828:	e8 43 ef ff ff       	call   800770 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  80182d:	a1 80 60 80 00       	mov    0x806080,%eax
+  801832:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801838:	a1 84 60 80 00       	mov    0x806084,%eax
+  80183d:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801843:	83 c4 10             	add    $0x10,%esp
+  801846:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80184b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80184e:	c9                   	leave
+  80184f:	c3                   	ret
+
+00801850 <fsv_alloc>:
+{
+  801850:	55                   	push   %ebp
+  801851:	89 e5                	mov    %esp,%ebp
+  801853:	56                   	push   %esi
+  801854:	53                   	push   %ebx
+  801855:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  801857:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80185c:	eb 22                	jmp    801880 <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  80185e:	83 ec 04             	sub    $0x4,%esp
+  801861:	6a 00                	push   $0x0
+  801863:	6a 00                	push   $0x0
+  801865:	6a 07                	push   $0x7
+  801867:	50                   	push   %eax
+  801868:	6a 00                	push   $0x0
+  80186a:	6a 04                	push   $0x4
+  80186c:	68 40 50 80 00       	push   $0x805040
+  801871:	e8 7c f7 ff ff       	call   800ff2 <sysbatch_add>
+  801876:	83 c4 20             	add    $0x20,%esp
+  801879:	85 c0                	test   %eax,%eax
+  80187b:	78 48                	js     8018c5 <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  80187d:	83 c3 01             	add    $0x1,%ebx
+  801880:	39 f3                	cmp    %esi,%ebx
+  801882:	74 31                	je     8018b5 <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  801884:	89 d8                	mov    %ebx,%eax
+  801886:	c1 e0 0c             	shl    $0xc,%eax
+  801889:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  80188e:	89 c2                	mov    %eax,%edx
+  801890:	c1 ea 16             	shr    $0x16,%edx
+  801893:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80189a:	f6 c2 01             	test   $0x1,%dl
+  80189d:	74 bf                	je     80185e <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  80189f:	89 c2                	mov    %eax,%edx
+  8018a1:	c1 ea 0c             	shr    $0xc,%edx
+  8018a4:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8018ab:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  8018ae:	83 fa 03             	cmp    $0x3,%edx
+  8018b1:	75 ab                	jne    80185e <fsv_alloc+0xe>
+  8018b3:	eb c8                	jmp    80187d <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  8018b5:	83 ec 0c             	sub    $0xc,%esp
+  8018b8:	68 40 50 80 00       	push   $0x805040
+  8018bd:	e8 e0 f6 ff ff       	call   800fa2 <sysbatch_flush>
+  8018c2:	83 c4 10             	add    $0x10,%esp
+}
+  8018c5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018c8:	5b                   	pop    %ebx
+  8018c9:	5e                   	pop    %esi
+  8018ca:	5d                   	pop    %ebp
+  8018cb:	c3                   	ret
+
+008018cc <devfile_read>:
+{
+  8018cc:	55                   	push   %ebp
+  8018cd:	89 e5                	mov    %esp,%ebp
+  8018cf:	57                   	push   %edi
+  8018d0:	56                   	push   %esi
+  8018d1:	53                   	push   %ebx
+  8018d2:	83 ec 3c             	sub    $0x3c,%esp
+  8018d5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  8018d8:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  8018de:	77 57                	ja     801937 <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8018e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018e3:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018e6:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read.req_n = n;
+  8018eb:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8018f1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018f6:	b8 03 00 00 00       	mov    $0x3,%eax
+  8018fb:	e8 79 fe ff ff       	call   801779 <fsipc>
+  801900:	89 c6                	mov    %eax,%esi
+  801902:	85 c0                	test   %eax,%eax
+  801904:	78 27                	js     80192d <devfile_read+0x61>
+  assert(r <= n);
+  801906:	39 c3                	cmp    %eax,%ebx
+  801908:	0f 82 0e 02 00 00    	jb     801b1c <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  80190e:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801913:	0f 8f 1c 02 00 00    	jg     801b35 <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801919:	83 ec 04             	sub    $0x4,%esp
+  80191c:	50                   	push   %eax
+  80191d:	68 00 60 80 00       	push   $0x806000
+  801922:	ff 75 0c             	push   0xc(%ebp)
+  801925:	e8 cc ef ff ff       	call   8008f6 <memmove>
+  return r;
+  80192a:	83 c4 10             	add    $0x10,%esp
+}
+  80192d:	89 f0                	mov    %esi,%eax
+  80192f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801932:	5b                   	pop    %ebx
+  801933:	5e                   	pop    %esi
+  801934:	5f                   	pop    %edi
+  801935:	5d                   	pop    %ebp
+  801936:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  801937:	b8 01 00 00 00       	mov    $0x1,%eax
+  80193c:	e8 0f ff ff ff       	call   801850 <fsv_alloc>
+  801941:	89 c6                	mov    %eax,%esi
+  801943:	85 c0                	test   %eax,%eax
+  801945:	78 e6                	js     80192d <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  801947:	8b 45 08             	mov    0x8(%ebp),%eax
+  80194a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80194d:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  801952:	8b 45 08             	mov    0x8(%ebp),%eax
+  801955:	8b 40 04             	mov    0x4(%eax),%eax
+  801958:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  80195d:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  801963:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  80196a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80196f:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801974:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801979:	e8 e2 fc ff ff       	call   801660 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  80197e:	6a 00                	push   $0x0
+  801980:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801983:	50                   	push   %eax
+  801984:	68 00 10 c0 9f       	push   $0x9fc01000
+  801989:	6a 00                	push   $0x0
+  80198b:	e8 82 11 00 00       	call   802b12 <ipc_recv_pages>
+  801990:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  801992:	83 c4 10             	add    $0x10,%esp
+  801995:	85 c0                	test   %eax,%eax
+  801997:	7e 94                	jle    80192d <devfile_read+0x61>
+  assert(r <= n);
+  801999:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80199c:	39 c3                	cmp    %eax,%ebx
+  80199e:	72 2e                	jb     8019ce <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  8019a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019a3:	8b 40 04             	mov    0x4(%eax),%eax
+  8019a6:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8019ab:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  8019ae:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8019b1:	c1 e2 0c             	shl    $0xc,%edx
+  8019b4:	39 ca                	cmp    %ecx,%edx
+  8019b6:	72 2f                	jb     8019e7 <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  8019b8:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  8019bd:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  8019c0:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  8019c4:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  8019c9:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  8019cc:	eb 52                	jmp    801a20 <devfile_read+0x154>
+  assert(r <= n);
+  8019ce:	68 11 33 80 00       	push   $0x803311
+  8019d3:	68 18 33 80 00       	push   $0x803318
+  8019d8:	68 49 01 00 00       	push   $0x149
+  8019dd:	68 06 33 80 00       	push   $0x803306
+  8019e2:	e8 e5 10 00 00       	call   802acc <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  8019e7:	68 3c 33 80 00       	push   $0x80333c
+  8019ec:	68 18 33 80 00       	push   $0x803318
+  8019f1:	68 4a 01 00 00       	push   $0x14a
+  8019f6:	68 06 33 80 00       	push   $0x803306
+  8019fb:	e8 cc 10 00 00       	call   802acc <_panic>
+      memmove(dst + done, src + done, m);
+  801a00:	83 ec 04             	sub    $0x4,%esp
+  801a03:	53                   	push   %ebx
+  801a04:	56                   	push   %esi
+  801a05:	89 f8                	mov    %edi,%eax
+  801a07:	03 45 0c             	add    0xc(%ebp),%eax
+  801a0a:	50                   	push   %eax
+  801a0b:	e8 e6 ee ff ff       	call   8008f6 <memmove>
+  801a10:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  801a13:	01 df                	add    %ebx,%edi
+  801a15:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801a18:	39 c7                	cmp    %eax,%edi
+  801a1a:	0f 83 c0 00 00 00    	jae    801ae0 <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801a20:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801a23:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  801a26:	89 f0                	mov    %esi,%eax
+  801a28:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801a2d:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  801a32:	29 c3                	sub    %eax,%ebx
+  801a34:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801a37:	29 f8                	sub    %edi,%eax
+  801a39:	39 c3                	cmp    %eax,%ebx
+  801a3b:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  801a3e:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801a44:	75 ba                	jne    801a00 <devfile_read+0x134>
+  801a46:	89 f9                	mov    %edi,%ecx
+  801a48:	03 4d 0c             	add    0xc(%ebp),%ecx
+  801a4b:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  801a4e:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  801a54:	75 aa                	jne    801a00 <devfile_read+0x134>
+  801a56:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  801a5c:	77 a2                	ja     801a00 <devfile_read+0x134>
+  801a5e:	89 c8                	mov    %ecx,%eax
+  801a60:	c1 e8 16             	shr    $0x16,%eax
+  801a63:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801a6a:	a8 01                	test   $0x1,%al
+  801a6c:	74 92                	je     801a00 <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  801a6e:	89 c8                	mov    %ecx,%eax
+  801a70:	c1 e8 0c             	shr    $0xc,%eax
+  801a73:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  801a7a:	a8 01                	test   $0x1,%al
+  801a7c:	74 82                	je     801a00 <devfile_read+0x134>
+  801a7e:	a9 02 08 00 00       	test   $0x802,%eax
+  801a83:	0f 84 77 ff ff ff    	je     801a00 <devfile_read+0x134>
+  801a89:	f6 c4 04             	test   $0x4,%ah
+  801a8c:	0f 85 6e ff ff ff    	jne    801a00 <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  801a92:	a1 44 57 80 00       	mov    0x805744,%eax
+  801a97:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  801a9b:	84 c0                	test   %al,%al
+  801a9d:	75 17                	jne    801ab6 <devfile_read+0x1ea>
+  801a9f:	83 ec 08             	sub    $0x8,%esp
+  801aa2:	6a 01                	push   $0x1
+  801aa4:	6a 00                	push   $0x0
+  801aa6:	e8 b1 f0 ff ff       	call   800b5c <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  801aab:	83 c4 10             	add    $0x10,%esp
+  801aae:	85 c0                	test   %eax,%eax
+  801ab0:	0f 85 4a ff ff ff    	jne    801a00 <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  801ab6:	83 ec 04             	sub    $0x4,%esp
+  801ab9:	68 05 08 00 00       	push   $0x805
+  801abe:	ff 75 cc             	push   -0x34(%ebp)
+  801ac1:	6a 00                	push   $0x0
+  801ac3:	56                   	push   %esi
+  801ac4:	6a 00                	push   $0x0
+  801ac6:	6a 05                	push   $0x5
+  801ac8:	68 40 50 80 00       	push   $0x805040
+  801acd:	e8 20 f5 ff ff       	call   800ff2 <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  801ad2:	c1 e8 1f             	shr    $0x1f,%eax
+  801ad5:	08 45 cb             	or     %al,-0x35(%ebp)
+  801ad8:	83 c4 20             	add    $0x20,%esp
+  801adb:	e9 33 ff ff ff       	jmp    801a13 <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  801ae0:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  801ae3:	83 ec 0c             	sub    $0xc,%esp
+  801ae6:	68 40 50 80 00       	push   $0x805040
+  801aeb:	e8 b2 f4 ff ff       	call   800fa2 <sysbatch_flush>
+  801af0:	83 c4 10             	add    $0x10,%esp
+  801af3:	85 c0                	test   %eax,%eax
+  801af5:	78 06                	js     801afd <devfile_read+0x231>
+  801af7:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  801afb:	74 14                	je     801b11 <devfile_read+0x245>
+    memmove(dst, src, r);
+  801afd:	83 ec 04             	sub    $0x4,%esp
+  801b00:	ff 75 d4             	push   -0x2c(%ebp)
+  801b03:	ff 75 d0             	push   -0x30(%ebp)
+  801b06:	ff 75 0c             	push   0xc(%ebp)
+  801b09:	e8 e8 ed ff ff       	call   8008f6 <memmove>
+  801b0e:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  801b11:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b14:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  801b17:	e9 11 fe ff ff       	jmp    80192d <devfile_read+0x61>
+  assert(r <= n);
+  801b1c:	68 11 33 80 00       	push   $0x803311
+  801b21:	68 18 33 80 00       	push   $0x803318
+  801b26:	68 1c 01 00 00       	push   $0x11c
+  801b2b:	68 06 33 80 00       	push   $0x803306
+  801b30:	e8 97 0f 00 00       	call   802acc <_panic>
+  assert(r <= PGSIZE);
+  801b35:	68 2d 33 80 00       	push   $0x80332d
+  801b3a:	68 18 33 80 00       	push   $0x803318
+  801b3f:	68 1d 01 00 00       	push   $0x11d
+  801b44:	68 06 33 80 00       	push   $0x803306
+  801b49:	e8 7e 0f 00 00       	call   802acc <_panic>
+
+00801b4e <devfile_write>:
+{
+  801b4e:	55                   	push   %ebp
+  801b4f:	89 e5                	mov    %esp,%ebp
+  801b51:	57                   	push   %edi
+  801b52:	56                   	push   %esi
+  801b53:	53                   	push   %ebx
+  801b54:	83 ec 1c             	sub    $0x1c,%esp
+  801b57:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b5a:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  801b5d:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  801b62:	77 39                	ja     801b9d <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801b64:	8b 56 0c             	mov    0xc(%esi),%edx
+  801b67:	89 15 00 60 80 00    	mov    %edx,0x806000
+  fsipcbuf.write.req_n = n;
+  801b6d:	a3 04 60 80 00       	mov    %eax,0x806004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  801b72:	83 ec 04             	sub    $0x4,%esp
+  801b75:	50                   	push   %eax
+  801b76:	ff 75 0c             	push   0xc(%ebp)
+  801b79:	68 08 60 80 00       	push   $0x806008
+  801b7e:	e8 73 ed ff ff       	call   8008f6 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801b83:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b88:	b8 04 00 00 00       	mov    $0x4,%eax
+  801b8d:	e8 e7 fb ff ff       	call   801779 <fsipc>
+  801b92:	83 c4 10             	add    $0x10,%esp
+}
+  801b95:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b98:	5b                   	pop    %ebx
+  801b99:	5e                   	pop    %esi
+  801b9a:	5f                   	pop    %edi
+  801b9b:	5d                   	pop    %ebp
+  801b9c:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  801b9d:	ba 00 00 10 00       	mov    $0x100000,%edx
+  801ba2:	39 d0                	cmp    %edx,%eax
+  801ba4:	89 d3                	mov    %edx,%ebx
+  801ba6:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  801ba9:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  801baf:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  801bb2:	83 c7 01             	add    $0x1,%edi
+  801bb5:	89 f8                	mov    %edi,%eax
+  801bb7:	e8 94 fc ff ff       	call   801850 <fsv_alloc>
+  801bbc:	85 c0                	test   %eax,%eax
+  801bbe:	78 d5                	js     801b95 <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  801bc0:	83 ec 04             	sub    $0x4,%esp
+  801bc3:	53                   	push   %ebx
+  801bc4:	ff 75 0c             	push   0xc(%ebp)
+  801bc7:	68 00 10 c0 9f       	push   $0x9fc01000
+  801bcc:	e8 25 ed ff ff       	call   8008f6 <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  801bd1:	8b 46 0c             	mov    0xc(%esi),%eax
+  801bd4:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  801bd9:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  801bdf:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801be6:	89 f9                	mov    %edi,%ecx
+  801be8:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801bed:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801bf2:	e8 69 fa ff ff       	call   801660 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801bf7:	6a 00                	push   $0x0
+  801bf9:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801bfc:	50                   	push   %eax
+  801bfd:	6a 00                	push   $0x0
+  801bff:	6a 00                	push   $0x0
+  801c01:	e8 0c 0f 00 00       	call   802b12 <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  801c06:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  801c09:	eb 8a                	jmp    801b95 <devfile_write+0x47>
+
+00801c0b <open>:
+{
+  801c0b:	55                   	push   %ebp
+  801c0c:	89 e5                	mov    %esp,%ebp
+  801c0e:	56                   	push   %esi
+  801c0f:	53                   	push   %ebx
+  801c10:	83 ec 1c             	sub    $0x1c,%esp
+  801c13:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801c16:	56                   	push   %esi
+  801c17:	e8 19 eb ff ff       	call   800735 <strlen>
+  801c1c:	83 c4 10             	add    $0x10,%esp
+  801c1f:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801c24:	7f 6c                	jg     801c92 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  801c26:	83 ec 0c             	sub    $0xc,%esp
+  801c29:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c2c:	50                   	push   %eax
+  801c2d:	e8 ad f4 ff ff       	call   8010df <fd_alloc>
+  801c32:	89 c3                	mov    %eax,%ebx
+  801c34:	83 c4 10             	add    $0x10,%esp
+  801c37:	85 c0                	test   %eax,%eax
+  801c39:	78 3c                	js     801c77 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801c3b:	83 ec 08             	sub    $0x8,%esp
+  801c3e:	56                   	push   %esi
+  801c3f:	68 00 60 80 00       	push   $0x806000
+  801c44:	e8 27 eb ff ff       	call   800770 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801c49:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c4c:	a3 00 64 80 00       	mov    %eax,0x806400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801c51:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801c54:	b8 01 00 00 00       	mov    $0x1,%eax
+  801c59:	e8 1b fb ff ff       	call   801779 <fsipc>
+  801c5e:	89 c3                	mov    %eax,%ebx
+  801c60:	83 c4 10             	add    $0x10,%esp
+  801c63:	85 c0                	test   %eax,%eax
+  801c65:	78 19                	js     801c80 <open+0x75>
+  return fd2num(fd);
+  801c67:	83 ec 0c             	sub    $0xc,%esp
+  801c6a:	ff 75 f4             	push   -0xc(%ebp)
+  801c6d:	e8 49 f4 ff ff       	call   8010bb <fd2num>
+  801c72:	89 c3                	mov    %eax,%ebx
+  801c74:	83 c4 10             	add    $0x10,%esp
+}
+  801c77:	89 d8                	mov    %ebx,%eax
+  801c79:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c7c:	5b                   	pop    %ebx
+  801c7d:	5e                   	pop    %esi
+  801c7e:	5d                   	pop    %ebp
+  801c7f:	c3                   	ret
+    fd_close(fd, 0);
+  801c80:	83 ec 08             	sub    $0x8,%esp
+  801c83:	6a 00                	push   $0x0
+  801c85:	ff 75 f4             	push   -0xc(%ebp)
+  801c88:	e8 44 f5 ff ff       	call   8011d1 <fd_close>
+    return r;
+  801c8d:	83 c4 10             	add    $0x10,%esp
+  801c90:	eb e5                	jmp    801c77 <open+0x6c>
+    return -E_BAD_PATH;
+  801c92:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801c97:	eb de                	jmp    801c77 <open+0x6c>
+
+00801c99 <open_read>:
+{
+  801c99:	55                   	push   %ebp
+  801c9a:	89 e5                	mov    %esp,%ebp
+  801c9c:	57                   	push   %edi
+  801c9d:	56                   	push   %esi
+  801c9e:	53                   	push   %ebx
+  801c9f:	83 ec 28             	sub    $0x28,%esp
+  801ca2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  801ca5:	57                   	push   %edi
+  801ca6:	e8 8a ea ff ff       	call   800735 <strlen>
+  801cab:	83 c4 10             	add    $0x10,%esp
+  801cae:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801cb3:	0f 87 f6 00 00 00    	ja     801daf <open_read+0x116>
+  801cb9:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  801cbb:	83 ec 0c             	sub    $0xc,%esp
+  801cbe:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801cc1:	50                   	push   %eax
+  801cc2:	e8 18 f4 ff ff       	call   8010df <fd_alloc>
+  801cc7:	89 c3                	mov    %eax,%ebx
+  801cc9:	83 c4 10             	add    $0x10,%esp
+  801ccc:	85 c0                	test   %eax,%eax
+  801cce:	0f 88 b2 00 00 00    	js     801d86 <open_read+0xed>
+  strcpy(req->req_buf, path);
+  801cd4:	83 ec 08             	sub    $0x8,%esp
+  801cd7:	57                   	push   %edi
+  801cd8:	68 e4 60 80 00       	push   $0x8060e4
+  801cdd:	e8 8e ea ff ff       	call   800770 <strcpy>
+  req->req_nops = 2;
+  801ce2:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  801ce9:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  801cec:	c7 05 04 60 80 00 01 	movl   $0x1,0x806004
+  801cf3:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  801cf6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801cf9:	a3 10 60 80 00       	mov    %eax,0x806010
+  req->req_ops[0].op_buf = 0;
+  801cfe:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  801d05:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  801d08:	c7 05 20 60 80 00 04 	movl   $0x4,0x806020
+  801d0f:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  801d12:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  801d19:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  801d1c:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  801d21:	29 f0                	sub    %esi,%eax
+  801d23:	3b 45 14             	cmp    0x14(%ebp),%eax
+  801d26:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  801d2a:	a3 2c 60 80 00       	mov    %eax,0x80602c
+  req->req_ops[1].op_offset = 0;
+  801d2f:	c7 05 30 60 80 00 00 	movl   $0x0,0x806030
+  801d36:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  801d39:	83 c6 01             	add    $0x1,%esi
+  801d3c:	89 35 34 60 80 00    	mov    %esi,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  801d42:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801d45:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801d4a:	e8 2a fa ff ff       	call   801779 <fsipc>
+  801d4f:	89 c3                	mov    %eax,%ebx
+  801d51:	83 c4 10             	add    $0x10,%esp
+  801d54:	83 f8 01             	cmp    $0x1,%eax
+  801d57:	7e 37                	jle    801d90 <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  801d59:	a1 38 60 80 00       	mov    0x806038,%eax
+  801d5e:	8b 55 18             	mov    0x18(%ebp),%edx
+  801d61:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  801d63:	83 ec 04             	sub    $0x4,%esp
+  801d66:	50                   	push   %eax
+  801d67:	81 c6 e4 60 80 00    	add    $0x8060e4,%esi
+  801d6d:	56                   	push   %esi
+  801d6e:	ff 75 10             	push   0x10(%ebp)
+  801d71:	e8 80 eb ff ff       	call   8008f6 <memmove>
+  return fd2num(fd);
+  801d76:	83 c4 04             	add    $0x4,%esp
+  801d79:	ff 75 e4             	push   -0x1c(%ebp)
+  801d7c:	e8 3a f3 ff ff       	call   8010bb <fd2num>
+  801d81:	89 c3                	mov    %eax,%ebx
+  801d83:	83 c4 10             	add    $0x10,%esp
+}
+  801d86:	89 d8                	mov    %ebx,%eax
+  801d88:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d8b:	5b                   	pop    %ebx
+  801d8c:	5e                   	pop    %esi
+  801d8d:	5f                   	pop    %edi
+  801d8e:	5d                   	pop    %ebp
+  801d8f:	c3                   	ret
+    fd_close(fd, 0);
+  801d90:	83 ec 08             	sub    $0x8,%esp
+  801d93:	6a 00                	push   $0x0
+  801d95:	ff 75 e4             	push   -0x1c(%ebp)
+  801d98:	e8 34 f4 ff ff       	call   8011d1 <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  801d9d:	83 c4 10             	add    $0x10,%esp
+  801da0:	85 db                	test   %ebx,%ebx
+  801da2:	78 e2                	js     801d86 <open_read+0xed>
+  801da4:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  801da7:	8b 9b 1c 60 80 00    	mov    0x80601c(%ebx),%ebx
+  801dad:	eb d7                	jmp    801d86 <open_read+0xed>
+    return -E_BAD_PATH;
+  801daf:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801db4:	eb d0                	jmp    801d86 <open_read+0xed>
+
+00801db6 <file_stat>:
+{
+  801db6:	55                   	push   %ebp
+  801db7:	89 e5                	mov    %esp,%ebp
+  801db9:	57                   	push   %edi
+  801dba:	56                   	push   %esi
+  801dbb:	53                   	push   %ebx
+  801dbc:	83 ec 18             	sub    $0x18,%esp
+  801dbf:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801dc2:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801dc5:	57                   	push   %edi
+  801dc6:	e8 6a e9 ff ff       	call   800735 <strlen>
+  801dcb:	83 c4 10             	add    $0x10,%esp
+  801dce:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801dd3:	0f 8f c7 00 00 00    	jg     801ea0 <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  801dd9:	83 ec 0c             	sub    $0xc,%esp
+  801ddc:	57                   	push   %edi
+  801ddd:	e8 53 e9 ff ff       	call   800735 <strlen>
+  801de2:	8d 58 04             	lea    0x4(%eax),%ebx
+  801de5:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  801de8:	83 c4 08             	add    $0x8,%esp
+  801deb:	57                   	push   %edi
+  801dec:	68 e4 60 80 00       	push   $0x8060e4
+  801df1:	e8 7a e9 ff ff       	call   800770 <strcpy>
+  req->req_nops = 2;
+  801df6:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  801dfd:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  801e00:	c7 05 04 60 80 00 02 	movl   $0x2,0x806004
+  801e07:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  801e0a:	c7 05 10 60 80 00 00 	movl   $0x0,0x806010
+  801e11:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  801e14:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  801e1b:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  801e1e:	c7 05 20 60 80 00 03 	movl   $0x3,0x806020
+  801e25:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  801e28:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  801e2f:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  801e32:	89 1d 34 60 80 00    	mov    %ebx,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  801e38:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e3d:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801e42:	e8 32 f9 ff ff       	call   801779 <fsipc>
+  801e47:	83 c4 10             	add    $0x10,%esp
+  801e4a:	83 f8 01             	cmp    $0x1,%eax
+  801e4d:	7e 42                	jle    801e91 <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  801e4f:	81 c3 e4 60 80 00    	add    $0x8060e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  801e55:	83 ec 08             	sub    $0x8,%esp
+  801e58:	53                   	push   %ebx
+  801e59:	56                   	push   %esi
+  801e5a:	e8 11 e9 ff ff       	call   800770 <strcpy>
+  st->st_size = ret->ret_size;
+  801e5f:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  801e65:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  801e6b:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  801e71:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  801e77:	c7 86 88 00 00 00 04 	movl   $0x804004,0x88(%esi)
+  801e7e:	40 80 00 
+  return 0;
+  801e81:	83 c4 10             	add    $0x10,%esp
+  801e84:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e89:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e8c:	5b                   	pop    %ebx
+  801e8d:	5e                   	pop    %esi
+  801e8e:	5f                   	pop    %edi
+  801e8f:	5d                   	pop    %ebp
+  801e90:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  801e91:	85 c0                	test   %eax,%eax
+  801e93:	78 f4                	js     801e89 <file_stat+0xd3>
+  801e95:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801e98:	8b 80 1c 60 80 00    	mov    0x80601c(%eax),%eax
+  801e9e:	eb e9                	jmp    801e89 <file_stat+0xd3>
+    return -E_BAD_PATH;
+  801ea0:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801ea5:	eb e2                	jmp    801e89 <file_stat+0xd3>
+
+00801ea7 <read_map>:
+{
+  801ea7:	55                   	push   %ebp
+  801ea8:	89 e5                	mov    %esp,%ebp
+  801eaa:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801ead:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801eb0:	50                   	push   %eax
+  801eb1:	ff 75 08             	push   0x8(%ebp)
+  801eb4:	e8 7c f2 ff ff       	call   801135 <fd_lookup>
+  801eb9:	83 c4 10             	add    $0x10,%esp
+  801ebc:	85 c0                	test   %eax,%eax
+  801ebe:	78 2a                	js     801eea <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  801ec0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ec3:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  801ec9:	39 08                	cmp    %ecx,(%eax)
+  801ecb:	75 1f                	jne    801eec <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  801ecd:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ed0:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read_map.req_offset = offset;
+  801ed5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ed8:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  801edd:	8b 55 10             	mov    0x10(%ebp),%edx
+  801ee0:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801ee5:	e8 8f f8 ff ff       	call   801779 <fsipc>
+}
+  801eea:	c9                   	leave
+  801eeb:	c3                   	ret
+    return -E_INVAL;
+  801eec:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ef1:	eb f7                	jmp    801eea <read_map+0x43>
+
+00801ef3 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801ef3:	55                   	push   %ebp
+  801ef4:	89 e5                	mov    %esp,%ebp
+  801ef6:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  801ef9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801efe:	b8 08 00 00 00       	mov    $0x8,%eax
+  801f03:	e8 71 f8 ff ff       	call   801779 <fsipc>
+}
+  801f08:	c9                   	leave
+  801f09:	c3                   	ret
+
+00801f0a <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  801f0a:	55                   	push   %ebp
+  801f0b:	89 e5                	mov    %esp,%ebp
+  801f0d:	57                   	push   %edi
+  801f0e:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  801f0f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f12:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.stats.req_bio_sched = 0;
+  801f17:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  801f1e:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  801f21:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  801f28:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  801f2b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f30:	b8 09 00 00 00       	mov    $0x9,%eax
+  801f35:	e8 3f f8 ff ff       	call   801779 <fsipc>
+  801f3a:	85 c0                	test   %eax,%eax
+  801f3c:	78 14                	js     801f52 <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  801f3e:	be 00 60 80 00       	mov    $0x806000,%esi
+  801f43:	b9 16 00 00 00       	mov    $0x16,%ecx
+  801f48:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801f4b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  801f4d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f52:	5e                   	pop    %esi
+  801f53:	5f                   	pop    %edi
+  801f54:	5d                   	pop    %ebp
+  801f55:	c3                   	ret
+
+00801f56 <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  801f56:	55                   	push   %ebp
+  801f57:	89 e5                	mov    %esp,%ebp
+  801f59:	53                   	push   %ebx
+  801f5a:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  801f5d:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801f60:	50                   	push   %eax
+  801f61:	6a 00                	push   $0x0
+  801f63:	e8 a2 ff ff ff       	call   801f0a <fs_stats>
+  801f68:	83 c4 10             	add    $0x10,%esp
+  801f6b:	85 c0                	test   %eax,%eax
+  801f6d:	78 28                	js     801f97 <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  801f6f:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  801f72:	83 ec 08             	sub    $0x8,%esp
+  801f75:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801f78:	50                   	push   %eax
+  801f79:	6a 20                	push   $0x20
+  801f7b:	e8 8a ff ff ff       	call   801f0a <fs_stats>
+  801f80:	83 c4 10             	add    $0x10,%esp
+  801f83:	85 c0                	test   %eax,%eax
+  801f85:	78 10                	js     801f97 <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  801f87:	83 ec 08             	sub    $0x8,%esp
+  801f8a:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801f8d:	50                   	push   %eax
+  801f8e:	53                   	push   %ebx
+  801f8f:	e8 76 ff ff ff       	call   801f0a <fs_stats>
+  801f94:	83 c4 10             	add    $0x10,%esp
+}
+  801f97:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f9a:	c9                   	leave
+  801f9b:	c3                   	ret
+
+00801f9c <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  801f9c:	55                   	push   %ebp
+  801f9d:	89 e5                	mov    %esp,%ebp
+  801f9f:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  801fa2:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  801fa9:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  801fac:	8b 45 08             	mov    0x8(%ebp),%eax
+  801faf:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.stats.req_dcache = 0;
+  801fb4:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  801fbb:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  801fbe:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fc3:	b8 09 00 00 00       	mov    $0x9,%eax
+  801fc8:	e8 ac f7 ff ff       	call   801779 <fsipc>
+}
+  801fcd:	c9                   	leave
+  801fce:	c3                   	ret
+
+00801fcf <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  801fcf:	55                   	push   %ebp
+  801fd0:	89 e5                	mov    %esp,%ebp
+  801fd2:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  801fd5:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  801fdc:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  801fdf:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  801fe6:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  801fe9:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fec:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_STATS, NULL);
+  801ff1:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ff6:	b8 09 00 00 00       	mov    $0x9,%eax
+  801ffb:	e8 79 f7 ff ff       	call   801779 <fsipc>
+}
+  802000:	c9                   	leave
+  802001:	c3                   	ret
+
+00802002 <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  802002:	55                   	push   %ebp
+  802003:	89 e5                	mov    %esp,%ebp
+  802005:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802008:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80200b:	50                   	push   %eax
+  80200c:	ff 75 08             	push   0x8(%ebp)
+  80200f:	e8 21 f1 ff ff       	call   801135 <fd_lookup>
+  802014:	83 c4 10             	add    $0x10,%esp
+  802017:	85 c0                	test   %eax,%eax
+  802019:	78 34                	js     80204f <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  80201b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80201e:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  802024:	39 08                	cmp    %ecx,(%eax)
+  802026:	75 29                	jne    802051 <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  802028:	8b 40 0c             	mov    0xc(%eax),%eax
+  80202b:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.fallocate.req_offset = offset;
+  802030:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802033:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.fallocate.req_len = len;
+  802038:	8b 45 10             	mov    0x10(%ebp),%eax
+  80203b:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  802040:	ba 00 00 00 00       	mov    $0x0,%edx
+  802045:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80204a:	e8 2a f7 ff ff       	call   801779 <fsipc>
+}
+  80204f:	c9                   	leave
+  802050:	c3                   	ret
+    return -E_INVAL;
+  802051:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802056:	eb f7                	jmp    80204f <fallocate+0x4d>
+
+00802058 <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  802058:	55                   	push   %ebp
+  802059:	89 e5                	mov    %esp,%ebp
+  80205b:	57                   	push   %edi
+  80205c:	56                   	push   %esi
+  80205d:	53                   	push   %ebx
+  80205e:	83 ec 24             	sub    $0x24,%esp
+  802061:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802064:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802067:	50                   	push   %eax
+  802068:	ff 75 08             	push   0x8(%ebp)
+  80206b:	e8 c5 f0 ff ff       	call   801135 <fd_lookup>
+  802070:	83 c4 10             	add    $0x10,%esp
+  802073:	85 c0                	test   %eax,%eax
+  802075:	78 66                	js     8020dd <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  802077:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80207a:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  802080:	39 08                	cmp    %ecx,(%eax)
+  802082:	75 61                	jne    8020e5 <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  802084:	85 f6                	test   %esi,%esi
+  802086:	7e 50                	jle    8020d8 <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  802088:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  80208d:	39 de                	cmp    %ebx,%esi
+  80208f:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  802092:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802095:	8b 40 0c             	mov    0xc(%eax),%eax
+  802098:	a3 00 60 80 00       	mov    %eax,0x806000
+    fsipcbuf.prefetch.req_n = m;
+  80209d:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  8020a3:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  8020aa:	83 ec 04             	sub    $0x4,%esp
+  8020ad:	57                   	push   %edi
+  8020ae:	ff 75 0c             	push   0xc(%ebp)
+  8020b1:	68 08 60 80 00       	push   $0x806008
+  8020b6:	e8 3b e8 ff ff       	call   8008f6 <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  8020bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020c0:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8020c5:	e8 af f6 ff ff       	call   801779 <fsipc>
+  8020ca:	83 c4 10             	add    $0x10,%esp
+  8020cd:	85 c0                	test   %eax,%eax
+  8020cf:	78 0c                	js     8020dd <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  8020d1:	01 7d 0c             	add    %edi,0xc(%ebp)
+  8020d4:	29 de                	sub    %ebx,%esi
+  8020d6:	eb ac                	jmp    802084 <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  8020d8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020e0:	5b                   	pop    %ebx
+  8020e1:	5e                   	pop    %esi
+  8020e2:	5f                   	pop    %edi
+  8020e3:	5d                   	pop    %ebp
+  8020e4:	c3                   	ret
+    return -E_INVAL;
+  8020e5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020ea:	eb f1                	jmp    8020dd <prefetch+0x85>
+
+008020ec <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  8020ec:	55                   	push   %ebp
+  8020ed:	89 e5                	mov    %esp,%ebp
+  8020ef:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  8020f2:	50                   	push   %eax
+  8020f3:	e8 d3 ef ff ff       	call   8010cb <fd2data>
+  8020f8:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  8020fd:	c9                   	leave
+  8020fe:	c3                   	ret
+
+008020ff <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8020ff:	55                   	push   %ebp
+  802100:	89 e5                	mov    %esp,%ebp
+  802102:	56                   	push   %esi
+  802103:	53                   	push   %ebx
+  802104:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  802107:	83 ec 0c             	sub    $0xc,%esp
+  80210a:	ff 75 08             	push   0x8(%ebp)
+  80210d:	e8 b9 ef ff ff       	call   8010cb <fd2data>
+  802112:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  802114:	83 c4 08             	add    $0x8,%esp
+  802117:	68 68 33 80 00       	push   $0x803368
+  80211c:	53                   	push   %ebx
+  80211d:	e8 4e e6 ff ff       	call   800770 <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  802122:	8b 46 04             	mov    0x4(%esi),%eax
+  802125:	2b 06                	sub    (%esi),%eax
+  802127:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  80212d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802134:	00 00 00 
+  stat->st_dev = &devpipe;
+  802137:	c7 83 88 00 00 00 20 	movl   $0x804020,0x88(%ebx)
+  80213e:	40 80 00 
+  return 0;
+}
+  802141:	b8 00 00 00 00       	mov    $0x0,%eax
+  802146:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802149:	5b                   	pop    %ebx
+  80214a:	5e                   	pop    %esi
+  80214b:	5d                   	pop    %ebp
+  80214c:	c3                   	ret
+
+0080214d <pipe_wakeup>:
+{
+  80214d:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  80214f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802154:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  802157:	85 c0                	test   %eax,%eax
+  802159:	75 01                	jne    80215c <pipe_wakeup+0xf>
+  80215b:	c3                   	ret
+{
+  80215c:	55                   	push   %ebp
+  80215d:	89 e5                	mov    %esp,%ebp
+  80215f:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  802162:	6a 00                	push   $0x0
+  802164:	68 00 00 c0 ee       	push   $0xeec00000
+  802169:	52                   	push   %edx
+  80216a:	e8 8c ed ff ff       	call   800efb <sys_chan_wakeup>
+  80216f:	83 c4 10             	add    $0x10,%esp
+}
+  802172:	c9                   	leave
+  802173:	c3                   	ret
+
+00802174 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802174:	55                   	push   %ebp
+  802175:	89 e5                	mov    %esp,%ebp
+  802177:	57                   	push   %edi
+  802178:	56                   	push   %esi
+  802179:	53                   	push   %ebx
+  80217a:	83 ec 18             	sub    $0x18,%esp
+  80217d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  802180:	57                   	push   %edi
+  802181:	e8 45 ef ff ff       	call   8010cb <fd2data>
+  802186:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  802188:	83 c4 10             	add    $0x10,%esp
+  80218b:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  80218f:	74 2a                	je     8021bb <devpipe_close+0x47>
+  802191:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  802196:	89 f8                	mov    %edi,%eax
+  802198:	e8 4f ff ff ff       	call   8020ec <pipe_ring>
+  80219d:	83 ec 08             	sub    $0x8,%esp
+  8021a0:	01 d8                	add    %ebx,%eax
+  8021a2:	50                   	push   %eax
+  8021a3:	6a 00                	push   $0x0
+  8021a5:	e8 7a ea ff ff       	call   800c24 <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  8021aa:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8021b0:	83 c4 10             	add    $0x10,%esp
+  8021b3:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  8021b9:	75 db                	jne    802196 <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  8021bb:	83 ec 08             	sub    $0x8,%esp
+  8021be:	57                   	push   %edi
+  8021bf:	6a 00                	push   $0x0
+  8021c1:	e8 5e ea ff ff       	call   800c24 <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  8021c6:	83 c4 10             	add    $0x10,%esp
+  8021c9:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  8021cd:	75 13                	jne    8021e2 <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  8021cf:	83 ec 08             	sub    $0x8,%esp
+  8021d2:	56                   	push   %esi
+  8021d3:	6a 00                	push   $0x0
+  8021d5:	e8 4a ea ff ff       	call   800c24 <sys_page_unmap>
+}
+  8021da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021dd:	5b                   	pop    %ebx
+  8021de:	5e                   	pop    %esi
+  8021df:	5f                   	pop    %edi
+  8021e0:	5d                   	pop    %ebp
+  8021e1:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  8021e2:	8d 56 04             	lea    0x4(%esi),%edx
+  8021e5:	8d 46 2c             	lea    0x2c(%esi),%eax
+  8021e8:	e8 60 ff ff ff       	call   80214d <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8021ed:	8d 46 30             	lea    0x30(%esi),%eax
+  8021f0:	89 f2                	mov    %esi,%edx
+  8021f2:	e8 56 ff ff ff       	call   80214d <pipe_wakeup>
+  8021f7:	eb d6                	jmp    8021cf <devpipe_close+0x5b>
+
+008021f9 <_pipeisclosed>:
+{
+  8021f9:	55                   	push   %ebp
+  8021fa:	89 e5                	mov    %esp,%ebp
+  8021fc:	57                   	push   %edi
+  8021fd:	56                   	push   %esi
+  8021fe:	53                   	push   %ebx
+  8021ff:	83 ec 1c             	sub    $0x1c,%esp
+  802202:	89 c7                	mov    %eax,%edi
+  802204:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  802206:	a1 44 57 80 00       	mov    0x805744,%eax
+  80220b:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  80220e:	83 ec 0c             	sub    $0xc,%esp
+  802211:	57                   	push   %edi
+  802212:	e8 5e 0a 00 00       	call   802c75 <pageref>
+  802217:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80221a:	89 34 24             	mov    %esi,(%esp)
+  80221d:	e8 53 0a 00 00       	call   802c75 <pageref>
+    nn = thisenv->env_runs;
+  802222:	8b 15 44 57 80 00    	mov    0x805744,%edx
+  802228:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  80222b:	83 c4 10             	add    $0x10,%esp
+  80222e:	39 cb                	cmp    %ecx,%ebx
+  802230:	74 1b                	je     80224d <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  802232:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802235:	75 cf                	jne    802206 <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802237:	8b 42 58             	mov    0x58(%edx),%eax
+  80223a:	6a 01                	push   $0x1
+  80223c:	50                   	push   %eax
+  80223d:	53                   	push   %ebx
+  80223e:	68 6f 33 80 00       	push   $0x80336f
+  802243:	e8 3a df ff ff       	call   800182 <cprintf>
+  802248:	83 c4 10             	add    $0x10,%esp
+  80224b:	eb b9                	jmp    802206 <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  80224d:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802250:	0f 94 c0             	sete   %al
+  802253:	0f b6 c0             	movzbl %al,%eax
+}
+  802256:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802259:	5b                   	pop    %ebx
+  80225a:	5e                   	pop    %esi
+  80225b:	5f                   	pop    %edi
+  80225c:	5d                   	pop    %ebp
+  80225d:	c3                   	ret
+
+0080225e <devpipe_write_bulk>:
+{
+  80225e:	55                   	push   %ebp
+  80225f:	89 e5                	mov    %esp,%ebp
+  802261:	57                   	push   %edi
+  802262:	56                   	push   %esi
+  802263:	53                   	push   %ebx
+  802264:	83 ec 1c             	sub    $0x1c,%esp
+  802267:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80226a:	89 d6                	mov    %edx,%esi
+  80226c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  80226f:	e8 78 fe ff ff       	call   8020ec <pipe_ring>
+  802274:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  802277:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  80227c:	8d 46 04             	lea    0x4(%esi),%eax
+  80227f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  802282:	eb 75                	jmp    8022f9 <devpipe_write_bulk+0x9b>
+  802284:	b8 01 00 00 00       	mov    $0x1,%eax
+  802289:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  80228d:	6a 64                	push   $0x64
+  80228f:	68 00 00 c0 ee       	push   $0xeec00000
+  802294:	53                   	push   %ebx
+  802295:	56                   	push   %esi
+  802296:	e8 3d ec ff ff       	call   800ed8 <sys_chan_sleep>
+      continue;
+  80229b:	83 c4 10             	add    $0x10,%esp
+  80229e:	eb 59                	jmp    8022f9 <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  8022a0:	89 d1                	mov    %edx,%ecx
+  8022a2:	c1 f9 1f             	sar    $0x1f,%ecx
+  8022a5:	c1 e9 11             	shr    $0x11,%ecx
+  8022a8:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  8022ab:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8022b0:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  8022b2:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  8022b8:	29 d3                	sub    %edx,%ebx
+  8022ba:	ba 00 80 00 00       	mov    $0x8000,%edx
+  8022bf:	29 c2                	sub    %eax,%edx
+  8022c1:	39 d3                	cmp    %edx,%ebx
+  8022c3:	0f 47 da             	cmova  %edx,%ebx
+  8022c6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8022c9:	29 fa                	sub    %edi,%edx
+  8022cb:	39 d3                	cmp    %edx,%ebx
+  8022cd:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  8022d0:	83 ec 04             	sub    $0x4,%esp
+  8022d3:	53                   	push   %ebx
+  8022d4:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8022d7:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  8022da:	52                   	push   %edx
+  8022db:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8022de:	01 c8                	add    %ecx,%eax
+  8022e0:	50                   	push   %eax
+  8022e1:	e8 72 e6 ff ff       	call   800958 <memcpy>
+    i += m;
+  8022e6:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  8022e8:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  8022eb:	8d 46 2c             	lea    0x2c(%esi),%eax
+  8022ee:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8022f1:	e8 57 fe ff ff       	call   80214d <pipe_wakeup>
+  8022f6:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  8022f9:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  8022fc:	73 2b                	jae    802329 <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  8022fe:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  802300:	8b 56 04             	mov    0x4(%esi),%edx
+  802303:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  802309:	39 d0                	cmp    %edx,%eax
+  80230b:	7d 93                	jge    8022a0 <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  80230d:	89 f2                	mov    %esi,%edx
+  80230f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802312:	e8 e2 fe ff ff       	call   8021f9 <_pipeisclosed>
+  802317:	85 c0                	test   %eax,%eax
+  802319:	0f 84 65 ff ff ff    	je     802284 <devpipe_write_bulk+0x26>
+        return i;
+  80231f:	89 f8                	mov    %edi,%eax
+}
+  802321:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802324:	5b                   	pop    %ebx
+  802325:	5e                   	pop    %esi
+  802326:	5f                   	pop    %edi
+  802327:	5d                   	pop    %ebp
+  802328:	c3                   	ret
+  return i;
+  802329:	89 f8                	mov    %edi,%eax
+  80232b:	eb f4                	jmp    802321 <devpipe_write_bulk+0xc3>
+
+0080232d <devpipe_write>:
+{
+  80232d:	55                   	push   %ebp
+  80232e:	89 e5                	mov    %esp,%ebp
+  802330:	57                   	push   %edi
+  802331:	56                   	push   %esi
+  802332:	53                   	push   %ebx
+  802333:	83 ec 28             	sub    $0x28,%esp
+  802336:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  802339:	56                   	push   %esi
+  80233a:	e8 8c ed ff ff       	call   8010cb <fd2data>
+  80233f:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  802341:	8b 78 28             	mov    0x28(%eax),%edi
+  802344:	83 c4 10             	add    $0x10,%esp
+  802347:	85 ff                	test   %edi,%edi
+  802349:	75 25                	jne    802370 <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  80234b:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  80234e:	74 66                	je     8023b6 <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802350:	8b 43 04             	mov    0x4(%ebx),%eax
+  802353:	8b 0b                	mov    (%ebx),%ecx
+  802355:	8d 51 20             	lea    0x20(%ecx),%edx
+  802358:	39 d0                	cmp    %edx,%eax
+  80235a:	72 2b                	jb     802387 <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  80235c:	89 da                	mov    %ebx,%edx
+  80235e:	89 f0                	mov    %esi,%eax
+  802360:	e8 94 fe ff ff       	call   8021f9 <_pipeisclosed>
+  802365:	85 c0                	test   %eax,%eax
+  802367:	75 51                	jne    8023ba <devpipe_write+0x8d>
+      sys_yield();
+  802369:	e8 cf e7 ff ff       	call   800b3d <sys_yield>
+  80236e:	eb e0                	jmp    802350 <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  802370:	83 ec 0c             	sub    $0xc,%esp
+  802373:	ff 75 10             	push   0x10(%ebp)
+  802376:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802379:	89 c2                	mov    %eax,%edx
+  80237b:	89 f0                	mov    %esi,%eax
+  80237d:	e8 dc fe ff ff       	call   80225e <devpipe_write_bulk>
+  802382:	83 c4 10             	add    $0x10,%esp
+  802385:	eb 38                	jmp    8023bf <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802387:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80238a:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  80238e:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802391:	89 c2                	mov    %eax,%edx
+  802393:	c1 fa 1f             	sar    $0x1f,%edx
+  802396:	89 d1                	mov    %edx,%ecx
+  802398:	c1 e9 1b             	shr    $0x1b,%ecx
+  80239b:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80239e:	83 e2 1f             	and    $0x1f,%edx
+  8023a1:	29 ca                	sub    %ecx,%edx
+  8023a3:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8023a7:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  8023ab:	83 c0 01             	add    $0x1,%eax
+  8023ae:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  8023b1:	83 c7 01             	add    $0x1,%edi
+  8023b4:	eb 95                	jmp    80234b <devpipe_write+0x1e>
+  return i;
+  8023b6:	89 f8                	mov    %edi,%eax
+  8023b8:	eb 05                	jmp    8023bf <devpipe_write+0x92>
+        return 0;
+  8023ba:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023c2:	5b                   	pop    %ebx
+  8023c3:	5e                   	pop    %esi
+  8023c4:	5f                   	pop    %edi
+  8023c5:	5d                   	pop    %ebp
+  8023c6:	c3                   	ret
+
+008023c7 <devpipe_read_bulk>:
+{
+  8023c7:	55                   	push   %ebp
+  8023c8:	89 e5                	mov    %esp,%ebp
+  8023ca:	57                   	push   %edi
+  8023cb:	56                   	push   %esi
+  8023cc:	53                   	push   %ebx
+  8023cd:	83 ec 2c             	sub    $0x2c,%esp
+  8023d0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8023d3:	89 d6                	mov    %edx,%esi
+  8023d5:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8023d8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  8023db:	e8 0c fd ff ff       	call   8020ec <pipe_ring>
+  8023e0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  8023e3:	85 db                	test   %ebx,%ebx
+  8023e5:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8023ea:	0f 45 c3             	cmovne %ebx,%eax
+  8023ed:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8023f0:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8023f5:	8d 46 30             	lea    0x30(%esi),%eax
+  8023f8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  8023fb:	eb 50                	jmp    80244d <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  8023fd:	89 d1                	mov    %edx,%ecx
+  8023ff:	c1 f9 1f             	sar    $0x1f,%ecx
+  802402:	c1 e9 11             	shr    $0x11,%ecx
+  802405:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802408:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  80240d:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  80240f:	29 d3                	sub    %edx,%ebx
+  802411:	ba 00 80 00 00       	mov    $0x8000,%edx
+  802416:	29 c2                	sub    %eax,%edx
+  802418:	39 d3                	cmp    %edx,%ebx
+  80241a:	0f 47 da             	cmova  %edx,%ebx
+  80241d:	8b 55 08             	mov    0x8(%ebp),%edx
+  802420:	29 fa                	sub    %edi,%edx
+  802422:	39 d3                	cmp    %edx,%ebx
+  802424:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  802427:	83 ec 04             	sub    $0x4,%esp
+  80242a:	53                   	push   %ebx
+  80242b:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80242e:	01 c8                	add    %ecx,%eax
+  802430:	50                   	push   %eax
+  802431:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802434:	01 f8                	add    %edi,%eax
+  802436:	50                   	push   %eax
+  802437:	e8 1c e5 ff ff       	call   800958 <memcpy>
+    i += m;
+  80243c:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  80243e:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802440:	89 f2                	mov    %esi,%edx
+  802442:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802445:	e8 03 fd ff ff       	call   80214d <pipe_wakeup>
+  80244a:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  80244d:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802450:	73 51                	jae    8024a3 <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  802452:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  802455:	8b 16                	mov    (%esi),%edx
+  802457:	39 da                	cmp    %ebx,%edx
+  802459:	75 a2                	jne    8023fd <devpipe_read_bulk+0x36>
+      if (i > 0)
+  80245b:	85 ff                	test   %edi,%edi
+  80245d:	75 44                	jne    8024a3 <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  80245f:	89 f2                	mov    %esi,%edx
+  802461:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802464:	e8 90 fd ff ff       	call   8021f9 <_pipeisclosed>
+  802469:	85 c0                	test   %eax,%eax
+  80246b:	75 3a                	jne    8024a7 <devpipe_read_bulk+0xe0>
+  80246d:	b8 01 00 00 00       	mov    $0x1,%eax
+  802472:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802476:	6a 64                	push   $0x64
+  802478:	ff 75 d4             	push   -0x2c(%ebp)
+  80247b:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  80247c:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  80247f:	50                   	push   %eax
+  802480:	e8 53 ea ff ff       	call   800ed8 <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  802485:	85 c0                	test   %eax,%eax
+  802487:	ba 00 00 00 00       	mov    $0x0,%edx
+  80248c:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  80248f:	83 c4 10             	add    $0x10,%esp
+  802492:	a8 01                	test   $0x1,%al
+  802494:	74 b7                	je     80244d <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  802496:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  80249b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80249e:	5b                   	pop    %ebx
+  80249f:	5e                   	pop    %esi
+  8024a0:	5f                   	pop    %edi
+  8024a1:	5d                   	pop    %ebp
+  8024a2:	c3                   	ret
+  return i;
+  8024a3:	89 f8                	mov    %edi,%eax
+  8024a5:	eb f4                	jmp    80249b <devpipe_read_bulk+0xd4>
+        return 0;
+  8024a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024ac:	eb ed                	jmp    80249b <devpipe_read_bulk+0xd4>
+
+008024ae <devpipe_read>:
+{
+  8024ae:	55                   	push   %ebp
+  8024af:	89 e5                	mov    %esp,%ebp
+  8024b1:	57                   	push   %edi
+  8024b2:	56                   	push   %esi
+  8024b3:	53                   	push   %ebx
+  8024b4:	83 ec 18             	sub    $0x18,%esp
+  8024b7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  8024ba:	57                   	push   %edi
+  8024bb:	e8 0b ec ff ff       	call   8010cb <fd2data>
+  8024c0:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  8024c2:	8b 70 28             	mov    0x28(%eax),%esi
+  8024c5:	83 c4 10             	add    $0x10,%esp
+  8024c8:	85 f6                	test   %esi,%esi
+  8024ca:	75 24                	jne    8024f0 <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  8024cc:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8024cf:	74 60                	je     802531 <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  8024d1:	8b 03                	mov    (%ebx),%eax
+  8024d3:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8024d6:	75 3b                	jne    802513 <devpipe_read+0x65>
+      if (i > 0)
+  8024d8:	85 f6                	test   %esi,%esi
+  8024da:	75 2d                	jne    802509 <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  8024dc:	89 da                	mov    %ebx,%edx
+  8024de:	89 f8                	mov    %edi,%eax
+  8024e0:	e8 14 fd ff ff       	call   8021f9 <_pipeisclosed>
+  8024e5:	85 c0                	test   %eax,%eax
+  8024e7:	75 4c                	jne    802535 <devpipe_read+0x87>
+      sys_yield();
+  8024e9:	e8 4f e6 ff ff       	call   800b3d <sys_yield>
+  8024ee:	eb e1                	jmp    8024d1 <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  8024f0:	83 ec 08             	sub    $0x8,%esp
+  8024f3:	6a 00                	push   $0x0
+  8024f5:	ff 75 10             	push   0x10(%ebp)
+  8024f8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8024fb:	89 c2                	mov    %eax,%edx
+  8024fd:	89 f8                	mov    %edi,%eax
+  8024ff:	e8 c3 fe ff ff       	call   8023c7 <devpipe_read_bulk>
+  802504:	83 c4 10             	add    $0x10,%esp
+  802507:	eb 02                	jmp    80250b <devpipe_read+0x5d>
+        return i;
+  802509:	89 f0                	mov    %esi,%eax
+}
+  80250b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80250e:	5b                   	pop    %ebx
+  80250f:	5e                   	pop    %esi
+  802510:	5f                   	pop    %edi
+  802511:	5d                   	pop    %ebp
+  802512:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802513:	99                   	cltd
+  802514:	c1 ea 1b             	shr    $0x1b,%edx
+  802517:	01 d0                	add    %edx,%eax
+  802519:	83 e0 1f             	and    $0x1f,%eax
+  80251c:	29 d0                	sub    %edx,%eax
+  80251e:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802523:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802526:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  802529:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  80252c:	83 c6 01             	add    $0x1,%esi
+  80252f:	eb 9b                	jmp    8024cc <devpipe_read+0x1e>
+  return i;
+  802531:	89 f0                	mov    %esi,%eax
+  802533:	eb d6                	jmp    80250b <devpipe_read+0x5d>
+        return 0;
+  802535:	b8 00 00 00 00       	mov    $0x0,%eax
+  80253a:	eb cf                	jmp    80250b <devpipe_read+0x5d>
+
+0080253c <pipe2>:
+{
+  80253c:	55                   	push   %ebp
+  80253d:	89 e5                	mov    %esp,%ebp
+  80253f:	57                   	push   %edi
+  802540:	56                   	push   %esi
+  802541:	53                   	push   %ebx
+  802542:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  802545:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802548:	50                   	push   %eax
+  802549:	e8 91 eb ff ff       	call   8010df <fd_alloc>
+  80254e:	89 c3                	mov    %eax,%ebx
+  802550:	83 c4 10             	add    $0x10,%esp
+  802553:	85 c0                	test   %eax,%eax
+  802555:	0f 88 fb 01 00 00    	js     802756 <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80255b:	83 ec 04             	sub    $0x4,%esp
+  80255e:	68 07 04 00 00       	push   $0x407
+  802563:	ff 75 e4             	push   -0x1c(%ebp)
+  802566:	6a 00                	push   $0x0
+  802568:	e8 32 e6 ff ff       	call   800b9f <sys_page_alloc>
+  80256d:	89 c3                	mov    %eax,%ebx
+  80256f:	83 c4 10             	add    $0x10,%esp
+  802572:	85 c0                	test   %eax,%eax
+  802574:	0f 88 dc 01 00 00    	js     802756 <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  80257a:	83 ec 0c             	sub    $0xc,%esp
+  80257d:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  802580:	50                   	push   %eax
+  802581:	e8 59 eb ff ff       	call   8010df <fd_alloc>
+  802586:	89 c3                	mov    %eax,%ebx
+  802588:	83 c4 10             	add    $0x10,%esp
+  80258b:	85 c0                	test   %eax,%eax
+  80258d:	0f 88 b3 01 00 00    	js     802746 <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802593:	83 ec 04             	sub    $0x4,%esp
+  802596:	68 07 04 00 00       	push   $0x407
+  80259b:	ff 75 e0             	push   -0x20(%ebp)
+  80259e:	6a 00                	push   $0x0
+  8025a0:	e8 fa e5 ff ff       	call   800b9f <sys_page_alloc>
+  8025a5:	89 c3                	mov    %eax,%ebx
+  8025a7:	83 c4 10             	add    $0x10,%esp
+  8025aa:	85 c0                	test   %eax,%eax
+  8025ac:	0f 88 94 01 00 00    	js     802746 <pipe2+0x20a>
+  va = fd2data(fd0);
+  8025b2:	83 ec 0c             	sub    $0xc,%esp
+  8025b5:	ff 75 e4             	push   -0x1c(%ebp)
+  8025b8:	e8 0e eb ff ff       	call   8010cb <fd2data>
+  8025bd:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8025bf:	83 c4 0c             	add    $0xc,%esp
+  8025c2:	68 07 04 00 00       	push   $0x407
+  8025c7:	50                   	push   %eax
+  8025c8:	6a 00                	push   $0x0
+  8025ca:	e8 d0 e5 ff ff       	call   800b9f <sys_page_alloc>
+  8025cf:	89 c3                	mov    %eax,%ebx
+  8025d1:	83 c4 10             	add    $0x10,%esp
+  8025d4:	85 c0                	test   %eax,%eax
+  8025d6:	0f 88 5a 01 00 00    	js     802736 <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8025dc:	83 ec 0c             	sub    $0xc,%esp
+  8025df:	ff 75 e0             	push   -0x20(%ebp)
+  8025e2:	e8 e4 ea ff ff       	call   8010cb <fd2data>
+  8025e7:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8025ee:	50                   	push   %eax
+  8025ef:	6a 00                	push   $0x0
+  8025f1:	57                   	push   %edi
+  8025f2:	6a 00                	push   $0x0
+  8025f4:	e8 e9 e5 ff ff       	call   800be2 <sys_page_map>
+  8025f9:	89 c3                	mov    %eax,%ebx
+  8025fb:	83 c4 20             	add    $0x20,%esp
+  8025fe:	85 c0                	test   %eax,%eax
+  802600:	0f 88 22 01 00 00    	js     802728 <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  802606:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  80260a:	74 72                	je     80267e <pipe2+0x142>
+  80260c:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  802611:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802614:	e8 d3 fa ff ff       	call   8020ec <pipe_ring>
+  802619:	83 ec 04             	sub    $0x4,%esp
+  80261c:	68 07 04 00 00       	push   $0x407
+  802621:	01 f0                	add    %esi,%eax
+  802623:	50                   	push   %eax
+  802624:	6a 00                	push   $0x0
+  802626:	e8 74 e5 ff ff       	call   800b9f <sys_page_alloc>
+  80262b:	89 c3                	mov    %eax,%ebx
+  80262d:	83 c4 10             	add    $0x10,%esp
+  802630:	85 c0                	test   %eax,%eax
+  802632:	0f 88 97 00 00 00    	js     8026cf <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  802638:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80263b:	e8 ac fa ff ff       	call   8020ec <pipe_ring>
+  802640:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  802643:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802646:	e8 a1 fa ff ff       	call   8020ec <pipe_ring>
+  80264b:	83 ec 0c             	sub    $0xc,%esp
+  80264e:	68 07 04 00 00       	push   $0x407
+  802653:	53                   	push   %ebx
+  802654:	6a 00                	push   $0x0
+  802656:	01 f0                	add    %esi,%eax
+  802658:	50                   	push   %eax
+  802659:	6a 00                	push   $0x0
+  80265b:	e8 82 e5 ff ff       	call   800be2 <sys_page_map>
+  802660:	89 c3                	mov    %eax,%ebx
+  802662:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802668:	83 c4 20             	add    $0x20,%esp
+  80266b:	85 c0                	test   %eax,%eax
+  80266d:	78 60                	js     8026cf <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  80266f:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802675:	75 9a                	jne    802611 <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  802677:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  80267e:	a1 20 40 80 00       	mov    0x804020,%eax
+  802683:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802686:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  802688:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80268b:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  802692:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802695:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  802697:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80269a:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  8026a1:	83 ec 0c             	sub    $0xc,%esp
+  8026a4:	ff 75 e4             	push   -0x1c(%ebp)
+  8026a7:	e8 0f ea ff ff       	call   8010bb <fd2num>
+  8026ac:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8026af:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  8026b1:	83 c4 04             	add    $0x4,%esp
+  8026b4:	ff 75 e0             	push   -0x20(%ebp)
+  8026b7:	e8 ff e9 ff ff       	call   8010bb <fd2num>
+  8026bc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8026bf:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  8026c2:	83 c4 10             	add    $0x10,%esp
+  8026c5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8026ca:	e9 87 00 00 00       	jmp    802756 <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  8026cf:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  8026d4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8026d7:	e8 10 fa ff ff       	call   8020ec <pipe_ring>
+  8026dc:	83 ec 08             	sub    $0x8,%esp
+  8026df:	01 f0                	add    %esi,%eax
+  8026e1:	50                   	push   %eax
+  8026e2:	6a 00                	push   $0x0
+  8026e4:	e8 3b e5 ff ff       	call   800c24 <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  8026e9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8026ec:	e8 fb f9 ff ff       	call   8020ec <pipe_ring>
+  8026f1:	83 c4 08             	add    $0x8,%esp
+  8026f4:	01 f0                	add    %esi,%eax
+  8026f6:	50                   	push   %eax
+  8026f7:	6a 00                	push   $0x0
+  8026f9:	e8 26 e5 ff ff       	call   800c24 <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  8026fe:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802704:	83 c4 10             	add    $0x10,%esp
+  802707:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  80270d:	75 c5                	jne    8026d4 <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  80270f:	83 ec 0c             	sub    $0xc,%esp
+  802712:	ff 75 e0             	push   -0x20(%ebp)
+  802715:	e8 b1 e9 ff ff       	call   8010cb <fd2data>
+  80271a:	83 c4 08             	add    $0x8,%esp
+  80271d:	50                   	push   %eax
+  80271e:	6a 00                	push   $0x0
+  802720:	e8 ff e4 ff ff       	call   800c24 <sys_page_unmap>
+  802725:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  802728:	83 ec 08             	sub    $0x8,%esp
+  80272b:	57                   	push   %edi
+  80272c:	6a 00                	push   $0x0
+  80272e:	e8 f1 e4 ff ff       	call   800c24 <sys_page_unmap>
+  802733:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  802736:	83 ec 08             	sub    $0x8,%esp
+  802739:	ff 75 e0             	push   -0x20(%ebp)
+  80273c:	6a 00                	push   $0x0
+  80273e:	e8 e1 e4 ff ff       	call   800c24 <sys_page_unmap>
+  802743:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  802746:	83 ec 08             	sub    $0x8,%esp
+  802749:	ff 75 e4             	push   -0x1c(%ebp)
+  80274c:	6a 00                	push   $0x0
+  80274e:	e8 d1 e4 ff ff       	call   800c24 <sys_page_unmap>
+  802753:	83 c4 10             	add    $0x10,%esp
+}
+  802756:	89 d8                	mov    %ebx,%eax
+  802758:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80275b:	5b                   	pop    %ebx
+  80275c:	5e                   	pop    %esi
+  80275d:	5f                   	pop    %edi
+  80275e:	5d                   	pop    %ebp
+  80275f:	c3                   	ret
+
+00802760 <pipe>:
+{
+  802760:	55                   	push   %ebp
+  802761:	89 e5                	mov    %esp,%ebp
+  802763:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  802766:	6a 00                	push   $0x0
+  802768:	ff 75 08             	push   0x8(%ebp)
+  80276b:	e8 cc fd ff ff       	call   80253c <pipe2>
+}
+  802770:	c9                   	leave
+  802771:	c3                   	ret
+
+00802772 <pipeisclosed>:
+{
+  802772:	55                   	push   %ebp
+  802773:	89 e5                	mov    %esp,%ebp
+  802775:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802778:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80277b:	50                   	push   %eax
+  80277c:	ff 75 08             	push   0x8(%ebp)
+  80277f:	e8 b1 e9 ff ff       	call   801135 <fd_lookup>
+  802784:	83 c4 10             	add    $0x10,%esp
+  802787:	85 c0                	test   %eax,%eax
+  802789:	78 18                	js     8027a3 <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  80278b:	83 ec 0c             	sub    $0xc,%esp
+  80278e:	ff 75 f4             	push   -0xc(%ebp)
+  802791:	e8 35 e9 ff ff       	call   8010cb <fd2data>
+  802796:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  802798:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80279b:	e8 59 fa ff ff       	call   8021f9 <_pipeisclosed>
+  8027a0:	83 c4 10             	add    $0x10,%esp
+}
+  8027a3:	c9                   	leave
+  8027a4:	c3                   	ret
+
+008027a5 <pipe_splice>:
+{
+  8027a5:	55                   	push   %ebp
+  8027a6:	89 e5                	mov    %esp,%ebp
+  8027a8:	57                   	push   %edi
+  8027a9:	56                   	push   %esi
+  8027aa:	53                   	push   %ebx
+  8027ab:	83 ec 34             	sub    $0x34,%esp
+  8027ae:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8027b1:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8027b4:	50                   	push   %eax
+  8027b5:	ff 75 08             	push   0x8(%ebp)
+  8027b8:	e8 78 e9 ff ff       	call   801135 <fd_lookup>
+  8027bd:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8027c0:	83 c4 10             	add    $0x10,%esp
+  8027c3:	85 c0                	test   %eax,%eax
+  8027c5:	0f 88 d7 00 00 00    	js     8028a2 <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  8027cb:	83 ec 0c             	sub    $0xc,%esp
+  8027ce:	ff 75 e4             	push   -0x1c(%ebp)
+  8027d1:	e8 f5 e8 ff ff       	call   8010cb <fd2data>
+  8027d6:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  8027d8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8027db:	83 c4 10             	add    $0x10,%esp
+  8027de:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  8027e4:	39 10                	cmp    %edx,(%eax)
+  8027e6:	0f 85 c1 00 00 00    	jne    8028ad <pipe_splice+0x108>
+  8027ec:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  8027f0:	0f 84 c0 00 00 00    	je     8028b6 <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  8027f6:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  8027fa:	0f 84 bf 00 00 00    	je     8028bf <pipe_splice+0x11a>
+  802800:	89 f7                	mov    %esi,%edi
+  802802:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  802808:	0f 85 ba 00 00 00    	jne    8028c8 <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  80280e:	8d 43 04             	lea    0x4(%ebx),%eax
+  802811:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802814:	eb 38                	jmp    80284e <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802816:	83 ec 0c             	sub    $0xc,%esp
+  802819:	68 00 10 00 00       	push   $0x1000
+  80281e:	89 f1                	mov    %esi,%ecx
+  802820:	89 da                	mov    %ebx,%edx
+  802822:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802825:	e8 34 fa ff ff       	call   80225e <devpipe_write_bulk>
+  80282a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80282d:	83 c4 10             	add    $0x10,%esp
+  802830:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802835:	75 53                	jne    80288a <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  802837:	83 ec 08             	sub    $0x8,%esp
+  80283a:	56                   	push   %esi
+  80283b:	6a 00                	push   $0x0
+  80283d:	e8 e2 e3 ff ff       	call   800c24 <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  802842:	83 c7 01             	add    $0x1,%edi
+  802845:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80284b:	83 c4 10             	add    $0x10,%esp
+  80284e:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802851:	74 3a                	je     80288d <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  802853:	8b 03                	mov    (%ebx),%eax
+  802855:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802858:	75 bc                	jne    802816 <pipe_splice+0x71>
+  80285a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80285f:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  802863:	85 c0                	test   %eax,%eax
+  802865:	74 af                	je     802816 <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802867:	83 ec 04             	sub    $0x4,%esp
+  80286a:	6a 07                	push   $0x7
+  80286c:	56                   	push   %esi
+  80286d:	ff 75 d0             	push   -0x30(%ebp)
+  802870:	e8 86 e6 ff ff       	call   800efb <sys_chan_wakeup>
+  802875:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802878:	83 c4 10             	add    $0x10,%esp
+  80287b:	85 c0                	test   %eax,%eax
+  80287d:	79 b8                	jns    802837 <pipe_splice+0x92>
+  80287f:	b8 01 00 00 00       	mov    $0x1,%eax
+  802884:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802888:	eb 8c                	jmp    802816 <pipe_splice+0x71>
+  80288a:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  80288d:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802891:	75 06                	jne    802899 <pipe_splice+0xf4>
+  802893:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802897:	78 09                	js     8028a2 <pipe_splice+0xfd>
+  return i * PGSIZE;
+  802899:	8b 45 10             	mov    0x10(%ebp),%eax
+  80289c:	c1 e0 0c             	shl    $0xc,%eax
+  80289f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  8028a2:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8028a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028a8:	5b                   	pop    %ebx
+  8028a9:	5e                   	pop    %esi
+  8028aa:	5f                   	pop    %edi
+  8028ab:	5d                   	pop    %ebp
+  8028ac:	c3                   	ret
+    return -E_INVAL;
+  8028ad:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  8028b4:	eb ec                	jmp    8028a2 <pipe_splice+0xfd>
+  8028b6:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  8028bd:	eb e3                	jmp    8028a2 <pipe_splice+0xfd>
+  8028bf:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  8028c6:	eb da                	jmp    8028a2 <pipe_splice+0xfd>
+  8028c8:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  8028cf:	eb d1                	jmp    8028a2 <pipe_splice+0xfd>
+
+008028d1 <pipe_splice_read>:
+{
+  8028d1:	55                   	push   %ebp
+  8028d2:	89 e5                	mov    %esp,%ebp
+  8028d4:	53                   	push   %ebx
+  8028d5:	83 ec 1c             	sub    $0x1c,%esp
+  8028d8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8028db:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8028de:	50                   	push   %eax
+  8028df:	ff 75 08             	push   0x8(%ebp)
+  8028e2:	e8 4e e8 ff ff       	call   801135 <fd_lookup>
+  8028e7:	83 c4 10             	add    $0x10,%esp
+  8028ea:	85 c0                	test   %eax,%eax
+  8028ec:	78 49                	js     802937 <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  8028ee:	83 ec 0c             	sub    $0xc,%esp
+  8028f1:	ff 75 f4             	push   -0xc(%ebp)
+  8028f4:	e8 d2 e7 ff ff       	call   8010cb <fd2data>
+  8028f9:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  8028fb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8028fe:	83 c4 10             	add    $0x10,%esp
+  802901:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  802907:	39 08                	cmp    %ecx,(%eax)
+  802909:	75 31                	jne    80293c <pipe_splice_read+0x6b>
+  80290b:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  80290f:	74 32                	je     802943 <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  802911:	8b 48 08             	mov    0x8(%eax),%ecx
+  802914:	83 e1 03             	and    $0x3,%ecx
+  802917:	83 f9 01             	cmp    $0x1,%ecx
+  80291a:	74 2e                	je     80294a <pipe_splice_read+0x79>
+  80291c:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  802922:	75 2d                	jne    802951 <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  802924:	83 ec 08             	sub    $0x8,%esp
+  802927:	53                   	push   %ebx
+  802928:	68 00 10 00 00       	push   $0x1000
+  80292d:	89 d9                	mov    %ebx,%ecx
+  80292f:	e8 93 fa ff ff       	call   8023c7 <devpipe_read_bulk>
+  802934:	83 c4 10             	add    $0x10,%esp
+}
+  802937:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80293a:	c9                   	leave
+  80293b:	c3                   	ret
+    return -E_INVAL;
+  80293c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802941:	eb f4                	jmp    802937 <pipe_splice_read+0x66>
+  802943:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802948:	eb ed                	jmp    802937 <pipe_splice_read+0x66>
+  80294a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80294f:	eb e6                	jmp    802937 <pipe_splice_read+0x66>
+  802951:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802956:	eb df                	jmp    802937 <pipe_splice_read+0x66>
+
+00802958 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  802958:	b8 00 00 00 00       	mov    $0x0,%eax
+  80295d:	c3                   	ret
+
+0080295e <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80295e:	55                   	push   %ebp
+  80295f:	89 e5                	mov    %esp,%ebp
+  802961:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  802964:	68 87 33 80 00       	push   $0x803387
+  802969:	ff 75 0c             	push   0xc(%ebp)
+  80296c:	e8 ff dd ff ff       	call   800770 <strcpy>
+  return 0;
+}
+  802971:	b8 00 00 00 00       	mov    $0x0,%eax
+  802976:	c9                   	leave
+  802977:	c3                   	ret
+
+00802978 <devcons_write>:
+{
+  802978:	55                   	push   %ebp
+  802979:	89 e5                	mov    %esp,%ebp
+  80297b:	57                   	push   %edi
+  80297c:	56                   	push   %esi
+  80297d:	53                   	push   %ebx
+  80297e:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  802984:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  802989:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  80298f:	eb 2e                	jmp    8029bf <devcons_write+0x47>
+    m = n - tot;
+  802991:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802994:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  802996:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80299b:	39 c3                	cmp    %eax,%ebx
+  80299d:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  8029a0:	83 ec 04             	sub    $0x4,%esp
+  8029a3:	53                   	push   %ebx
+  8029a4:	89 f0                	mov    %esi,%eax
+  8029a6:	03 45 0c             	add    0xc(%ebp),%eax
+  8029a9:	50                   	push   %eax
+  8029aa:	57                   	push   %edi
+  8029ab:	e8 46 df ff ff       	call   8008f6 <memmove>
+    sys_cputs(buf, m);
+  8029b0:	83 c4 08             	add    $0x8,%esp
+  8029b3:	53                   	push   %ebx
+  8029b4:	57                   	push   %edi
+  8029b5:	e8 e6 e0 ff ff       	call   800aa0 <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  8029ba:	01 de                	add    %ebx,%esi
+  8029bc:	83 c4 10             	add    $0x10,%esp
+  8029bf:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8029c2:	72 cd                	jb     802991 <devcons_write+0x19>
+}
+  8029c4:	89 f0                	mov    %esi,%eax
+  8029c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029c9:	5b                   	pop    %ebx
+  8029ca:	5e                   	pop    %esi
+  8029cb:	5f                   	pop    %edi
+  8029cc:	5d                   	pop    %ebp
+  8029cd:	c3                   	ret
+
+008029ce <devcons_read>:
+{
+  8029ce:	55                   	push   %ebp
+  8029cf:	89 e5                	mov    %esp,%ebp
+  8029d1:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  8029d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029d9:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8029dd:	75 07                	jne    8029e6 <devcons_read+0x18>
+  8029df:	eb 1f                	jmp    802a00 <devcons_read+0x32>
+    sys_yield();
+  8029e1:	e8 57 e1 ff ff       	call   800b3d <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  8029e6:	e8 d3 e0 ff ff       	call   800abe <sys_cgetc>
+  8029eb:	85 c0                	test   %eax,%eax
+  8029ed:	74 f2                	je     8029e1 <devcons_read+0x13>
+  if (c < 0)
+  8029ef:	78 0f                	js     802a00 <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  8029f1:	83 f8 04             	cmp    $0x4,%eax
+  8029f4:	74 0c                	je     802a02 <devcons_read+0x34>
+  *(char*)vbuf = c;
+  8029f6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8029f9:	88 02                	mov    %al,(%edx)
+  return 1;
+  8029fb:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802a00:	c9                   	leave
+  802a01:	c3                   	ret
+    return 0;
+  802a02:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a07:	eb f7                	jmp    802a00 <devcons_read+0x32>
+
+00802a09 <cputchar>:
+{
+  802a09:	55                   	push   %ebp
+  802a0a:	89 e5                	mov    %esp,%ebp
+  802a0c:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  802a0f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a12:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  802a15:	6a 01                	push   $0x1
+  802a17:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802a1a:	50                   	push   %eax
+  802a1b:	e8 80 e0 ff ff       	call   800aa0 <sys_cputs>
+}
+  802a20:	83 c4 10             	add    $0x10,%esp
+  802a23:	c9                   	leave
+  802a24:	c3                   	ret
+
+00802a25 <getchar>:
+{
+  802a25:	55                   	push   %ebp
+  802a26:	89 e5                	mov    %esp,%ebp
+  802a28:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  802a2b:	6a 01                	push   $0x1
+  802a2d:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802a30:	50                   	push   %eax
+  802a31:	6a 00                	push   $0x0
+  802a33:	e8 a8 e9 ff ff       	call   8013e0 <read>
+  if (r < 0)
+  802a38:	83 c4 10             	add    $0x10,%esp
+  802a3b:	85 c0                	test   %eax,%eax
+  802a3d:	78 06                	js     802a45 <getchar+0x20>
+  if (r < 1)
+  802a3f:	74 06                	je     802a47 <getchar+0x22>
+  return c;
+  802a41:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802a45:	c9                   	leave
+  802a46:	c3                   	ret
+    return -E_EOF;
+  802a47:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802a4c:	eb f7                	jmp    802a45 <getchar+0x20>
+
+00802a4e <iscons>:
+{
+  802a4e:	55                   	push   %ebp
+  802a4f:	89 e5                	mov    %esp,%ebp
+  802a51:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802a54:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a57:	50                   	push   %eax
+  802a58:	ff 75 08             	push   0x8(%ebp)
+  802a5b:	e8 d5 e6 ff ff       	call   801135 <fd_lookup>
+  802a60:	83 c4 10             	add    $0x10,%esp
+  802a63:	85 c0                	test   %eax,%eax
+  802a65:	78 11                	js     802a78 <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  802a67:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a6a:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802a70:	39 10                	cmp    %edx,(%eax)
+  802a72:	0f 94 c0             	sete   %al
+  802a75:	0f b6 c0             	movzbl %al,%eax
+}
+  802a78:	c9                   	leave
+  802a79:	c3                   	ret
+
+00802a7a <opencons>:
+{
+  802a7a:	55                   	push   %ebp
+  802a7b:	89 e5                	mov    %esp,%ebp
+  802a7d:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  802a80:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a83:	50                   	push   %eax
+  802a84:	e8 56 e6 ff ff       	call   8010df <fd_alloc>
+  802a89:	83 c4 10             	add    $0x10,%esp
+  802a8c:	85 c0                	test   %eax,%eax
+  802a8e:	78 3a                	js     802aca <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802a90:	83 ec 04             	sub    $0x4,%esp
+  802a93:	68 07 04 00 00       	push   $0x407
+  802a98:	ff 75 f4             	push   -0xc(%ebp)
+  802a9b:	6a 00                	push   $0x0
+  802a9d:	e8 fd e0 ff ff       	call   800b9f <sys_page_alloc>
+  802aa2:	83 c4 10             	add    $0x10,%esp
+  802aa5:	85 c0                	test   %eax,%eax
+  802aa7:	78 21                	js     802aca <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  802aa9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802aac:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802ab2:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  802ab4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ab7:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  802abe:	83 ec 0c             	sub    $0xc,%esp
+  802ac1:	50                   	push   %eax
+  802ac2:	e8 f4 e5 ff ff       	call   8010bb <fd2num>
+  802ac7:	83 c4 10             	add    $0x10,%esp
+}
+  802aca:	c9                   	leave
+  802acb:	c3                   	ret
+
+00802acc <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  802acc:	55                   	push   %ebp
+  802acd:	89 e5                	mov    %esp,%ebp
+  802acf:	56                   	push   %esi
+  802ad0:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  802ad1:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  802ad4:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  802ada:	e8 3f e0 ff ff       	call   800b1e <sys_getenvid>
+  802adf:	83 ec 0c             	sub    $0xc,%esp
+  802ae2:	ff 75 0c             	push   0xc(%ebp)
+  802ae5:	ff 75 08             	push   0x8(%ebp)
+  802ae8:	56                   	push   %esi
+  802ae9:	50                   	push   %eax
+  802aea:	68 94 33 80 00       	push   $0x803394
+  802aef:	e8 8e d6 ff ff       	call   800182 <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  802af4:	83 c4 18             	add    $0x18,%esp
+  802af7:	53                   	push   %ebx
+  802af8:	ff 75 10             	push   0x10(%ebp)
+  802afb:	e8 31 d6 ff ff       	call   800131 <vcprintf>
+  cprintf("\n");
+  802b00:	c7 04 24 80 33 80 00 	movl   $0x803380,(%esp)
+  802b07:	e8 76 d6 ff ff       	call   800182 <cprintf>
+  802b0c:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  802b0f:	cc                   	int3
+  while (1)
+  802b10:	eb fd                	jmp    802b0f <_panic+0x43>
+
+00802b12 <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  802b12:	55                   	push   %ebp
+  802b13:	89 e5                	mov    %esp,%ebp
+  802b15:	57                   	push   %edi
+  802b16:	56                   	push   %esi
+  802b17:	53                   	push   %ebx
+  802b18:	83 ec 14             	sub    $0x14,%esp
+  802b1b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802b1e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b21:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802b24:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  802b27:	85 c0                	test   %eax,%eax
+  802b29:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802b2e:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  802b31:	ff 33                	push   (%ebx)
+  802b33:	50                   	push   %eax
+  802b34:	e8 3e e3 ff ff       	call   800e77 <sys_ipc_recv>
+  802b39:	83 c4 10             	add    $0x10,%esp
+  802b3c:	85 c0                	test   %eax,%eax
+  802b3e:	78 39                	js     802b79 <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  802b40:	85 ff                	test   %edi,%edi
+  802b42:	74 0a                	je     802b4e <ipc_recv_pages+0x3c>
+  802b44:	a1 44 57 80 00       	mov    0x805744,%eax
+  802b49:	8b 40 7c             	mov    0x7c(%eax),%eax
+  802b4c:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  802b4e:	85 f6                	test   %esi,%esi
+  802b50:	74 0d                	je     802b5f <ipc_recv_pages+0x4d>
+  802b52:	a1 44 57 80 00       	mov    0x805744,%eax
+  802b57:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  802b5d:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  802b5f:	a1 44 57 80 00       	mov    0x805744,%eax
+  802b64:	8b 40 74             	mov    0x74(%eax),%eax
+  802b67:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  802b69:	a1 44 57 80 00       	mov    0x805744,%eax
+  802b6e:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  802b71:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b74:	5b                   	pop    %ebx
+  802b75:	5e                   	pop    %esi
+  802b76:	5f                   	pop    %edi
+  802b77:	5d                   	pop    %ebp
+  802b78:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  802b79:	85 ff                	test   %edi,%edi
+  802b7b:	74 06                	je     802b83 <ipc_recv_pages+0x71>
+  802b7d:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  802b83:	85 f6                	test   %esi,%esi
+  802b85:	74 06                	je     802b8d <ipc_recv_pages+0x7b>
+  802b87:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  802b8d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  802b93:	eb dc                	jmp    802b71 <ipc_recv_pages+0x5f>
+
+00802b95 <ipc_recv>:
+{
+  802b95:	55                   	push   %ebp
+  802b96:	89 e5                	mov    %esp,%ebp
+  802b98:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  802b9b:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  802ba2:	ff 75 10             	push   0x10(%ebp)
+  802ba5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802ba8:	50                   	push   %eax
+  802ba9:	ff 75 0c             	push   0xc(%ebp)
+  802bac:	ff 75 08             	push   0x8(%ebp)
+  802baf:	e8 5e ff ff ff       	call   802b12 <ipc_recv_pages>
+}
+  802bb4:	c9                   	leave
+  802bb5:	c3                   	ret
+
+00802bb6 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  802bb6:	55                   	push   %ebp
+  802bb7:	89 e5                	mov    %esp,%ebp
+  802bb9:	57                   	push   %edi
+  802bba:	56                   	push   %esi
+  802bbb:	53                   	push   %ebx
+  802bbc:	83 ec 0c             	sub    $0xc,%esp
+  802bbf:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802bc2:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802bc5:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  802bc8:	89 c3                	mov    %eax,%ebx
+  802bca:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  802bd0:	85 c0                	test   %eax,%eax
+  802bd2:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802bd7:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  802bda:	83 ec 0c             	sub    $0xc,%esp
+  802bdd:	ff 75 14             	push   0x14(%ebp)
+  802be0:	ff 75 18             	push   0x18(%ebp)
+  802be3:	53                   	push   %ebx
+  802be4:	56                   	push   %esi
+  802be5:	57                   	push   %edi
+  802be6:	e8 6b e2 ff ff       	call   800e56 <sys_ipc_try_send>
+  802beb:	83 c4 20             	add    $0x20,%esp
+  802bee:	85 c0                	test   %eax,%eax
+  802bf0:	79 1e                	jns    802c10 <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  802bf2:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802bf5:	75 07                	jne    802bfe <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  802bf7:	e8 41 df ff ff       	call   800b3d <sys_yield>
+  802bfc:	eb dc                	jmp    802bda <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  802bfe:	50                   	push   %eax
+  802bff:	68 b7 33 80 00       	push   $0x8033b7
+  802c04:	6a 5c                	push   $0x5c
+  802c06:	68 c4 33 80 00       	push   $0x8033c4
+  802c0b:	e8 bc fe ff ff       	call   802acc <_panic>
+  }
+}
+  802c10:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c13:	5b                   	pop    %ebx
+  802c14:	5e                   	pop    %esi
+  802c15:	5f                   	pop    %edi
+  802c16:	5d                   	pop    %ebp
+  802c17:	c3                   	ret
+
+00802c18 <ipc_send>:
+{
+  802c18:	55                   	push   %ebp
+  802c19:	89 e5                	mov    %esp,%ebp
+  802c1b:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  802c1e:	ff 75 14             	push   0x14(%ebp)
+  802c21:	6a 01                	push   $0x1
+  802c23:	ff 75 10             	push   0x10(%ebp)
+  802c26:	ff 75 0c             	push   0xc(%ebp)
+  802c29:	ff 75 08             	push   0x8(%ebp)
+  802c2c:	e8 85 ff ff ff       	call   802bb6 <ipc_send_pages>
+}
+  802c31:	83 c4 20             	add    $0x20,%esp
+  802c34:	c9                   	leave
+  802c35:	c3                   	ret
+
+00802c36 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802c36:	55                   	push   %ebp
+  802c37:	89 e5                	mov    %esp,%ebp
+  802c39:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  802c3c:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  802c41:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802c44:	c1 e0 04             	shl    $0x4,%eax
+  802c47:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802c4c:	8b 40 50             	mov    0x50(%eax),%eax
+  802c4f:	39 c8                	cmp    %ecx,%eax
+  802c51:	74 12                	je     802c65 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  802c53:	83 c2 01             	add    $0x1,%edx
+  802c56:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802c5c:	75 e3                	jne    802c41 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  802c5e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c63:	eb 0e                	jmp    802c73 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  802c65:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802c68:	c1 e0 04             	shl    $0x4,%eax
+  802c6b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802c70:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802c73:	5d                   	pop    %ebp
+  802c74:	c3                   	ret
+
+00802c75 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802c75:	55                   	push   %ebp
+  802c76:	89 e5                	mov    %esp,%ebp
+  802c78:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802c7b:	89 c2                	mov    %eax,%edx
+  802c7d:	c1 ea 16             	shr    $0x16,%edx
+  802c80:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  802c87:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802c8c:	f6 c1 01             	test   $0x1,%cl
+  802c8f:	74 1c                	je     802cad <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  802c91:	c1 e8 0c             	shr    $0xc,%eax
+  802c94:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  802c9b:	a8 01                	test   $0x1,%al
+  802c9d:	74 0e                	je     802cad <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  802c9f:	c1 e8 0c             	shr    $0xc,%eax
+  802ca2:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802ca9:	ef 
+  802caa:	0f b7 d2             	movzwl %dx,%edx
+}
+  802cad:	89 d0                	mov    %edx,%eax
+  802caf:	5d                   	pop    %ebp
+  802cb0:	c3                   	ret
+
+00802cb1 <udivmod>:
+  802cb1:	55                   	push   %ebp
+  802cb2:	57                   	push   %edi
+  802cb3:	56                   	push   %esi
+  802cb4:	53                   	push   %ebx
+  802cb5:	83 ec 14             	sub    $0x14,%esp
+  802cb8:	8b 74 24 28          	mov    0x28(%esp),%esi
+  802cbc:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  802cc0:	89 fb                	mov    %edi,%ebx
+  802cc2:	09 f3                	or     %esi,%ebx
+  802cc4:	0f 84 88 00 00 00    	je     802d52 <udivmod+0xa1>
+  802cca:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802ccf:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802cd6:	00 
+  802cd7:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802cde:	00 
+  802cdf:	89 cd                	mov    %ecx,%ebp
+  802ce1:	89 34 24             	mov    %esi,(%esp)
+  802ce4:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802ce8:	eb 08                	jmp    802cf2 <udivmod+0x41>
+  802cea:	83 ed 01             	sub    $0x1,%ebp
+  802ced:	83 fd ff             	cmp    $0xffffffff,%ebp
+  802cf0:	74 6c                	je     802d5e <udivmod+0xad>
+  802cf2:	89 c3                	mov    %eax,%ebx
+  802cf4:	89 d6                	mov    %edx,%esi
+  802cf6:	89 e9                	mov    %ebp,%ecx
+  802cf8:	0f ad f3             	shrd   %cl,%esi,%ebx
+  802cfb:	d3 ee                	shr    %cl,%esi
+  802cfd:	f6 c1 20             	test   $0x20,%cl
+  802d00:	74 04                	je     802d06 <udivmod+0x55>
+  802d02:	89 f3                	mov    %esi,%ebx
+  802d04:	31 f6                	xor    %esi,%esi
+  802d06:	8b 3c 24             	mov    (%esp),%edi
+  802d09:	39 fb                	cmp    %edi,%ebx
+  802d0b:	89 f7                	mov    %esi,%edi
+  802d0d:	8b 1c 24             	mov    (%esp),%ebx
+  802d10:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802d14:	19 f7                	sbb    %esi,%edi
+  802d16:	72 d2                	jb     802cea <udivmod+0x39>
+  802d18:	89 f7                	mov    %esi,%edi
+  802d1a:	89 de                	mov    %ebx,%esi
+  802d1c:	89 e9                	mov    %ebp,%ecx
+  802d1e:	0f a5 f7             	shld   %cl,%esi,%edi
+  802d21:	d3 e6                	shl    %cl,%esi
+  802d23:	f6 c1 20             	test   $0x20,%cl
+  802d26:	74 04                	je     802d2c <udivmod+0x7b>
+  802d28:	89 f7                	mov    %esi,%edi
+  802d2a:	31 f6                	xor    %esi,%esi
+  802d2c:	29 f0                	sub    %esi,%eax
+  802d2e:	19 fa                	sbb    %edi,%edx
+  802d30:	be 01 00 00 00       	mov    $0x1,%esi
+  802d35:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d3a:	0f a5 f7             	shld   %cl,%esi,%edi
+  802d3d:	d3 e6                	shl    %cl,%esi
+  802d3f:	f6 c1 20             	test   $0x20,%cl
+  802d42:	74 04                	je     802d48 <udivmod+0x97>
+  802d44:	89 f7                	mov    %esi,%edi
+  802d46:	31 f6                	xor    %esi,%esi
+  802d48:	09 74 24 08          	or     %esi,0x8(%esp)
+  802d4c:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802d50:	eb 98                	jmp    802cea <udivmod+0x39>
+  802d52:	89 f0                	mov    %esi,%eax
+  802d54:	89 fa                	mov    %edi,%edx
+  802d56:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802d5a:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802d5e:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802d62:	89 01                	mov    %eax,(%ecx)
+  802d64:	89 51 04             	mov    %edx,0x4(%ecx)
+  802d67:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802d6b:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802d6f:	83 c4 14             	add    $0x14,%esp
+  802d72:	5b                   	pop    %ebx
+  802d73:	5e                   	pop    %esi
+  802d74:	5f                   	pop    %edi
+  802d75:	5d                   	pop    %ebp
+  802d76:	c3                   	ret
+
+00802d77 <__udivdi3>:
+  802d77:	83 ec 18             	sub    $0x18,%esp
+  802d7a:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802d7e:	50                   	push   %eax
+  802d7f:	ff 74 24 2c          	push   0x2c(%esp)
+  802d83:	ff 74 24 2c          	push   0x2c(%esp)
+  802d87:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802d8b:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802d8f:	e8 1d ff ff ff       	call   802cb1 <udivmod>
+  802d94:	83 c4 24             	add    $0x24,%esp
+  802d97:	c3                   	ret
+
+00802d98 <__umoddi3>:
+  802d98:	83 ec 18             	sub    $0x18,%esp
+  802d9b:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802d9f:	50                   	push   %eax
+  802da0:	ff 74 24 2c          	push   0x2c(%esp)
+  802da4:	ff 74 24 2c          	push   0x2c(%esp)
+  802da8:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802dac:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802db0:	e8 fc fe ff ff       	call   802cb1 <udivmod>
+  802db5:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802db9:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802dbd:	83 c4 24             	add    $0x24,%esp
+  802dc0:	c3                   	ret
+
+00802dc1 <__divdi3>:
+  802dc1:	56                   	push   %esi
+  802dc2:	53                   	push   %ebx
+  802dc3:	83 ec 14             	sub    $0x14,%esp
+  802dc6:	8b 44 24 20          	mov    0x20(%esp),%eax
+  802dca:	8b 54 24 24          	mov    0x24(%esp),%edx
+  802dce:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  802dd2:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  802dd6:	85 d2                	test   %edx,%edx
+  802dd8:	78 18                	js     802df2 <__divdi3+0x31>
+  802dda:	85 db                	test   %ebx,%ebx
+  802ddc:	78 3e                	js     802e1c <__divdi3+0x5b>
+  802dde:	83 ec 04             	sub    $0x4,%esp
+  802de1:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802de5:	56                   	push   %esi
+  802de6:	53                   	push   %ebx
+  802de7:	51                   	push   %ecx
+  802de8:	e8 c4 fe ff ff       	call   802cb1 <udivmod>
+  802ded:	83 c4 10             	add    $0x10,%esp
+  802df0:	eb 24                	jmp    802e16 <__divdi3+0x55>
+  802df2:	f7 d8                	neg    %eax
+  802df4:	83 d2 00             	adc    $0x0,%edx
+  802df7:	f7 da                	neg    %edx
+  802df9:	85 db                	test   %ebx,%ebx
+  802dfb:	78 3a                	js     802e37 <__divdi3+0x76>
+  802dfd:	83 ec 04             	sub    $0x4,%esp
+  802e00:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802e04:	56                   	push   %esi
+  802e05:	53                   	push   %ebx
+  802e06:	51                   	push   %ecx
+  802e07:	e8 a5 fe ff ff       	call   802cb1 <udivmod>
+  802e0c:	83 c4 10             	add    $0x10,%esp
+  802e0f:	f7 d8                	neg    %eax
+  802e11:	83 d2 00             	adc    $0x0,%edx
+  802e14:	f7 da                	neg    %edx
+  802e16:	83 c4 14             	add    $0x14,%esp
+  802e19:	5b                   	pop    %ebx
+  802e1a:	5e                   	pop    %esi
+  802e1b:	c3                   	ret
+  802e1c:	83 ec 04             	sub    $0x4,%esp
+  802e1f:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802e23:	56                   	push   %esi
+  802e24:	f7 d9                	neg    %ecx
+  802e26:	83 d3 00             	adc    $0x0,%ebx
+  802e29:	f7 db                	neg    %ebx
+  802e2b:	53                   	push   %ebx
+  802e2c:	51                   	push   %ecx
+  802e2d:	e8 7f fe ff ff       	call   802cb1 <udivmod>
+  802e32:	83 c4 10             	add    $0x10,%esp
+  802e35:	eb d8                	jmp    802e0f <__divdi3+0x4e>
+  802e37:	83 ec 04             	sub    $0x4,%esp
+  802e3a:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802e3e:	56                   	push   %esi
+  802e3f:	f7 d9                	neg    %ecx
+  802e41:	83 d3 00             	adc    $0x0,%ebx
+  802e44:	f7 db                	neg    %ebx
+  802e46:	53                   	push   %ebx
+  802e47:	51                   	push   %ecx
+  802e48:	e8 64 fe ff ff       	call   802cb1 <udivmod>
+  802e4d:	83 c4 10             	add    $0x10,%esp
+  802e50:	eb c4                	jmp    802e16 <__divdi3+0x55>
+
+00802e52 <__moddi3>:
+  802e52:	55                   	push   %ebp
+  802e53:	57                   	push   %edi
+  802e54:	56                   	push   %esi
+  802e55:	53                   	push   %ebx
+  802e56:	83 ec 24             	sub    $0x24,%esp
+  802e59:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802e5d:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802e61:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  802e65:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  802e69:	85 d2                	test   %edx,%edx
+  802e6b:	78 3b                	js     802ea8 <__moddi3+0x56>
+  802e6d:	83 ec 04             	sub    $0x4,%esp
+  802e70:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  802e74:	56                   	push   %esi
+  802e75:	89 ce                	mov    %ecx,%esi
+  802e77:	f7 de                	neg    %esi
+  802e79:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802e7d:	89 de                	mov    %ebx,%esi
+  802e7f:	83 d6 00             	adc    $0x0,%esi
+  802e82:	f7 de                	neg    %esi
+  802e84:	89 74 24 14          	mov    %esi,0x14(%esp)
+  802e88:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802e8c:	0f 48 f1             	cmovs  %ecx,%esi
+  802e8f:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  802e94:	53                   	push   %ebx
+  802e95:	56                   	push   %esi
+  802e96:	e8 16 fe ff ff       	call   802cb1 <udivmod>
+  802e9b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802e9f:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802ea3:	83 c4 10             	add    $0x10,%esp
+  802ea6:	eb 47                	jmp    802eef <__moddi3+0x9d>
+  802ea8:	f7 d8                	neg    %eax
+  802eaa:	83 d2 00             	adc    $0x0,%edx
+  802ead:	f7 da                	neg    %edx
+  802eaf:	83 ec 04             	sub    $0x4,%esp
+  802eb2:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  802eb6:	56                   	push   %esi
+  802eb7:	89 cf                	mov    %ecx,%edi
+  802eb9:	f7 df                	neg    %edi
+  802ebb:	89 de                	mov    %ebx,%esi
+  802ebd:	83 d6 00             	adc    $0x0,%esi
+  802ec0:	f7 de                	neg    %esi
+  802ec2:	0f 49 cf             	cmovns %edi,%ecx
+  802ec5:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802ec9:	0f 49 de             	cmovns %esi,%ebx
+  802ecc:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  802ed0:	ff 74 24 0c          	push   0xc(%esp)
+  802ed4:	ff 74 24 0c          	push   0xc(%esp)
+  802ed8:	e8 d4 fd ff ff       	call   802cb1 <udivmod>
+  802edd:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802ee1:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802ee5:	f7 d8                	neg    %eax
+  802ee7:	83 d2 00             	adc    $0x0,%edx
+  802eea:	f7 da                	neg    %edx
+  802eec:	83 c4 10             	add    $0x10,%esp
+  802eef:	83 c4 24             	add    $0x24,%esp
+  802ef2:	5b                   	pop    %ebx
+  802ef3:	5e                   	pop    %esi
+  802ef4:	5f                   	pop    %edi
+  802ef5:	5d                   	pop    %ebp
+  802ef6:	c3                   	ret
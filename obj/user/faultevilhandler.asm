@@ -0,0 +1,6372 @@
+
+obj/user/faultevilhandler.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 34 00 00 00       	call   800065 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 0c             	sub    $0xc,%esp
+  sys_page_alloc(0, (void*)(UXSTACKTOP - PGSIZE), PTE_P|PTE_U|PTE_W);
+  800039:	6a 07                	push   $0x7
+  80003b:	68 00 f0 bf ee       	push   $0xeebff000
+  800040:	6a 00                	push   $0x0
+  800042:	e8 8a 01 00 00       	call   8001d1 <sys_page_alloc>
+  sys_env_set_pgfault_upcall(0, (void*)0xF0100020);
+  800047:	83 c4 08             	add    $0x8,%esp
+  80004a:	68 20 00 10 f0       	push   $0xf0100020
+  80004f:	6a 00                	push   $0x0
+  800051:	e8 f0 03 00 00       	call   800446 <sys_env_set_pgfault_upcall>
+  *(int*)0 = 0;
+  800056:	c7 05 00 00 00 00 00 	movl   $0x0,0x0
+  80005d:	00 00 00 
+}
+  800060:	83 c4 10             	add    $0x10,%esp
+  800063:	c9                   	leave
+  800064:	c3                   	ret
+
+00800065 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800065:	55                   	push   %ebp
+  800066:	89 e5                	mov    %esp,%ebp
+  800068:	56                   	push   %esi
+  800069:	53                   	push   %ebx
+  80006a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80006d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  800070:	c7 05 44 57 80 00 00 	movl   $0x0,0x805744
+  800077:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  80007a:	e8 d1 00 00 00       	call   800150 <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  80007f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800084:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800087:	c1 e0 04             	shl    $0x4,%eax
+  80008a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80008f:	a3 44 57 80 00       	mov    %eax,0x805744
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800094:	85 db                	test   %ebx,%ebx
+  800096:	7e 07                	jle    80009f <libmain+0x3a>
+    binaryname = argv[0];
+  800098:	8b 06                	mov    (%esi),%eax
+  80009a:	a3 00 40 80 00       	mov    %eax,0x804000
+
+  // call user main routine
+  umain(argc, argv);
+  80009f:	83 ec 08             	sub    $0x8,%esp
+  8000a2:	56                   	push   %esi
+  8000a3:	53                   	push   %ebx
+  8000a4:	e8 8a ff ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  8000a9:	e8 0a 00 00 00       	call   8000b8 <exit>
+}
+  8000ae:	83 c4 10             	add    $0x10,%esp
+  8000b1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000b4:	5b                   	pop    %ebx
+  8000b5:	5e                   	pop    %esi
+  8000b6:	5d                   	pop    %ebp
+  8000b7:	c3                   	ret
+
+008000b8 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000b8:	55                   	push   %ebp
+  8000b9:	89 e5                	mov    %esp,%ebp
+  8000bb:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  8000be:	e8 87 07 00 00       	call   80084a <close_all>
+  sys_env_destroy(0);
+  8000c3:	83 ec 0c             	sub    $0xc,%esp
+  8000c6:	6a 00                	push   $0x0
+  8000c8:	e8 42 00 00 00       	call   80010f <sys_env_destroy>
+}
+  8000cd:	83 c4 10             	add    $0x10,%esp
+  8000d0:	c9                   	leave
+  8000d1:	c3                   	ret
+
+008000d2 <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8000d2:	55                   	push   %ebp
+  8000d3:	89 e5                	mov    %esp,%ebp
+  8000d5:	57                   	push   %edi
+  8000d6:	56                   	push   %esi
+  8000d7:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8000d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000dd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000e0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000e3:	89 c3                	mov    %eax,%ebx
+  8000e5:	89 c7                	mov    %eax,%edi
+  8000e7:	89 c6                	mov    %eax,%esi
+  8000e9:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  8000eb:	5b                   	pop    %ebx
+  8000ec:	5e                   	pop    %esi
+  8000ed:	5f                   	pop    %edi
+  8000ee:	5d                   	pop    %ebp
+  8000ef:	c3                   	ret
+
+008000f0 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  8000f0:	55                   	push   %ebp
+  8000f1:	89 e5                	mov    %esp,%ebp
+  8000f3:	57                   	push   %edi
+  8000f4:	56                   	push   %esi
+  8000f5:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8000f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000fb:	b8 01 00 00 00       	mov    $0x1,%eax
+  800100:	89 d1                	mov    %edx,%ecx
+  800102:	89 d3                	mov    %edx,%ebx
+  800104:	89 d7                	mov    %edx,%edi
+  800106:	89 d6                	mov    %edx,%esi
+  800108:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  80010a:	5b                   	pop    %ebx
+  80010b:	5e                   	pop    %esi
+  80010c:	5f                   	pop    %edi
+  80010d:	5d                   	pop    %ebp
+  80010e:	c3                   	ret
+
+0080010f <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  80010f:	55                   	push   %ebp
+  800110:	89 e5                	mov    %esp,%ebp
+  800112:	57                   	push   %edi
+  800113:	56                   	push   %esi
+  800114:	53                   	push   %ebx
+  800115:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800118:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80011d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800120:	b8 03 00 00 00       	mov    $0x3,%eax
+  800125:	89 cb                	mov    %ecx,%ebx
+  800127:	89 cf                	mov    %ecx,%edi
+  800129:	89 ce                	mov    %ecx,%esi
+  80012b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80012d:	85 c0                	test   %eax,%eax
+  80012f:	7f 08                	jg     800139 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800131:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800134:	5b                   	pop    %ebx
+  800135:	5e                   	pop    %esi
+  800136:	5f                   	pop    %edi
+  800137:	5d                   	pop    %ebp
+  800138:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800139:	83 ec 0c             	sub    $0xc,%esp
+  80013c:	50                   	push   %eax
+  80013d:	6a 03                	push   $0x3
+  80013f:	68 8a 2e 80 00       	push   $0x802e8a
+  800144:	6a 23                	push   $0x23
+  800146:	68 a7 2e 80 00       	push   $0x802ea7
+  80014b:	e8 41 1f 00 00       	call   802091 <_panic>
+
+00800150 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800150:	55                   	push   %ebp
+  800151:	89 e5                	mov    %esp,%ebp
+  800153:	57                   	push   %edi
+  800154:	56                   	push   %esi
+  800155:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800156:	ba 00 00 00 00       	mov    $0x0,%edx
+  80015b:	b8 02 00 00 00       	mov    $0x2,%eax
+  800160:	89 d1                	mov    %edx,%ecx
+  800162:	89 d3                	mov    %edx,%ebx
+  800164:	89 d7                	mov    %edx,%edi
+  800166:	89 d6                	mov    %edx,%esi
+  800168:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  80016a:	5b                   	pop    %ebx
+  80016b:	5e                   	pop    %esi
+  80016c:	5f                   	pop    %edi
+  80016d:	5d                   	pop    %ebp
+  80016e:	c3                   	ret
+
+0080016f <sys_yield>:
+
+void
+sys_yield(void)
+{
+  80016f:	55                   	push   %ebp
+  800170:	89 e5                	mov    %esp,%ebp
+  800172:	57                   	push   %edi
+  800173:	56                   	push   %esi
+  800174:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800175:	ba 00 00 00 00       	mov    $0x0,%edx
+  80017a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80017f:	89 d1                	mov    %edx,%ecx
+  800181:	89 d3                	mov    %edx,%ebx
+  800183:	89 d7                	mov    %edx,%edi
+  800185:	89 d6                	mov    %edx,%esi
+  800187:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800189:	5b                   	pop    %ebx
+  80018a:	5e                   	pop    %esi
+  80018b:	5f                   	pop    %edi
+  80018c:	5d                   	pop    %ebp
+  80018d:	c3                   	ret
+
+0080018e <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  80018e:	55                   	push   %ebp
+  80018f:	89 e5                	mov    %esp,%ebp
+  800191:	57                   	push   %edi
+  800192:	56                   	push   %esi
+  800193:	53                   	push   %ebx
+  800194:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  800197:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  80019b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001a0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001a3:	b8 14 00 00 00       	mov    $0x14,%eax
+  8001a8:	89 df                	mov    %ebx,%edi
+  8001aa:	89 de                	mov    %ebx,%esi
+  8001ac:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8001ae:	85 c0                	test   %eax,%eax
+  8001b0:	7f 08                	jg     8001ba <sys_env_set_cow+0x2c>
+}
+  8001b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001b5:	5b                   	pop    %ebx
+  8001b6:	5e                   	pop    %esi
+  8001b7:	5f                   	pop    %edi
+  8001b8:	5d                   	pop    %ebp
+  8001b9:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8001ba:	83 ec 0c             	sub    $0xc,%esp
+  8001bd:	50                   	push   %eax
+  8001be:	6a 14                	push   $0x14
+  8001c0:	68 8a 2e 80 00       	push   $0x802e8a
+  8001c5:	6a 23                	push   $0x23
+  8001c7:	68 a7 2e 80 00       	push   $0x802ea7
+  8001cc:	e8 c0 1e 00 00       	call   802091 <_panic>
+
+008001d1 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8001d1:	55                   	push   %ebp
+  8001d2:	89 e5                	mov    %esp,%ebp
+  8001d4:	57                   	push   %edi
+  8001d5:	56                   	push   %esi
+  8001d6:	53                   	push   %ebx
+  8001d7:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8001da:	be 00 00 00 00       	mov    $0x0,%esi
+  8001df:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001e2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001e5:	b8 04 00 00 00       	mov    $0x4,%eax
+  8001ea:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001ed:	89 f7                	mov    %esi,%edi
+  8001ef:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8001f1:	85 c0                	test   %eax,%eax
+  8001f3:	7f 08                	jg     8001fd <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  8001f5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001f8:	5b                   	pop    %ebx
+  8001f9:	5e                   	pop    %esi
+  8001fa:	5f                   	pop    %edi
+  8001fb:	5d                   	pop    %ebp
+  8001fc:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8001fd:	83 ec 0c             	sub    $0xc,%esp
+  800200:	50                   	push   %eax
+  800201:	6a 04                	push   $0x4
+  800203:	68 8a 2e 80 00       	push   $0x802e8a
+  800208:	6a 23                	push   $0x23
+  80020a:	68 a7 2e 80 00       	push   $0x802ea7
+  80020f:	e8 7d 1e 00 00       	call   802091 <_panic>
+
+00800214 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800214:	55                   	push   %ebp
+  800215:	89 e5                	mov    %esp,%ebp
+  800217:	57                   	push   %edi
+  800218:	56                   	push   %esi
+  800219:	53                   	push   %ebx
+  80021a:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80021d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800220:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800223:	b8 05 00 00 00       	mov    $0x5,%eax
+  800228:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80022b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80022e:	8b 75 18             	mov    0x18(%ebp),%esi
+  800231:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800233:	85 c0                	test   %eax,%eax
+  800235:	7f 08                	jg     80023f <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  800237:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80023a:	5b                   	pop    %ebx
+  80023b:	5e                   	pop    %esi
+  80023c:	5f                   	pop    %edi
+  80023d:	5d                   	pop    %ebp
+  80023e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80023f:	83 ec 0c             	sub    $0xc,%esp
+  800242:	50                   	push   %eax
+  800243:	6a 05                	push   $0x5
+  800245:	68 8a 2e 80 00       	push   $0x802e8a
+  80024a:	6a 23                	push   $0x23
+  80024c:	68 a7 2e 80 00       	push   $0x802ea7
+  800251:	e8 3b 1e 00 00       	call   802091 <_panic>
+
+00800256 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800256:	55                   	push   %ebp
+  800257:	89 e5                	mov    %esp,%ebp
+  800259:	57                   	push   %edi
+  80025a:	56                   	push   %esi
+  80025b:	53                   	push   %ebx
+  80025c:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80025f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800264:	8b 55 08             	mov    0x8(%ebp),%edx
+  800267:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80026a:	b8 06 00 00 00       	mov    $0x6,%eax
+  80026f:	89 df                	mov    %ebx,%edi
+  800271:	89 de                	mov    %ebx,%esi
+  800273:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800275:	85 c0                	test   %eax,%eax
+  800277:	7f 08                	jg     800281 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  800279:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80027c:	5b                   	pop    %ebx
+  80027d:	5e                   	pop    %esi
+  80027e:	5f                   	pop    %edi
+  80027f:	5d                   	pop    %ebp
+  800280:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800281:	83 ec 0c             	sub    $0xc,%esp
+  800284:	50                   	push   %eax
+  800285:	6a 06                	push   $0x6
+  800287:	68 8a 2e 80 00       	push   $0x802e8a
+  80028c:	6a 23                	push   $0x23
+  80028e:	68 a7 2e 80 00       	push   $0x802ea7
+  800293:	e8 f9 1d 00 00       	call   802091 <_panic>
+
+00800298 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  800298:	55                   	push   %ebp
+  800299:	89 e5                	mov    %esp,%ebp
+  80029b:	57                   	push   %edi
+  80029c:	56                   	push   %esi
+  80029d:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80029e:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002a1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002a4:	b8 11 00 00 00       	mov    $0x11,%eax
+  8002a9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8002ac:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8002af:	8b 75 18             	mov    0x18(%ebp),%esi
+  8002b2:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  8002b4:	5b                   	pop    %ebx
+  8002b5:	5e                   	pop    %esi
+  8002b6:	5f                   	pop    %edi
+  8002b7:	5d                   	pop    %ebp
+  8002b8:	c3                   	ret
+
+008002b9 <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  8002b9:	55                   	push   %ebp
+  8002ba:	89 e5                	mov    %esp,%ebp
+  8002bc:	57                   	push   %edi
+  8002bd:	56                   	push   %esi
+  8002be:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8002bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002c2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002c5:	b8 12 00 00 00       	mov    $0x12,%eax
+  8002ca:	be 00 00 00 00       	mov    $0x0,%esi
+  8002cf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8002d2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8002d5:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  8002d7:	5b                   	pop    %ebx
+  8002d8:	5e                   	pop    %esi
+  8002d9:	5f                   	pop    %edi
+  8002da:	5d                   	pop    %ebp
+  8002db:	c3                   	ret
+
+008002dc <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  8002dc:	55                   	push   %ebp
+  8002dd:	89 e5                	mov    %esp,%ebp
+  8002df:	57                   	push   %edi
+  8002e0:	56                   	push   %esi
+  8002e1:	53                   	push   %ebx
+  8002e2:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8002e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002ea:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002ed:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002f0:	b8 16 00 00 00       	mov    $0x16,%eax
+  8002f5:	89 df                	mov    %ebx,%edi
+  8002f7:	89 de                	mov    %ebx,%esi
+  8002f9:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8002fb:	85 c0                	test   %eax,%eax
+  8002fd:	7f 08                	jg     800307 <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  8002ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800302:	5b                   	pop    %ebx
+  800303:	5e                   	pop    %esi
+  800304:	5f                   	pop    %edi
+  800305:	5d                   	pop    %ebp
+  800306:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800307:	83 ec 0c             	sub    $0xc,%esp
+  80030a:	50                   	push   %eax
+  80030b:	6a 16                	push   $0x16
+  80030d:	68 8a 2e 80 00       	push   $0x802e8a
+  800312:	6a 23                	push   $0x23
+  800314:	68 a7 2e 80 00       	push   $0x802ea7
+  800319:	e8 73 1d 00 00       	call   802091 <_panic>
+
+0080031e <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  80031e:	55                   	push   %ebp
+  80031f:	89 e5                	mov    %esp,%ebp
+  800321:	57                   	push   %edi
+  800322:	56                   	push   %esi
+  800323:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800324:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800329:	8b 55 08             	mov    0x8(%ebp),%edx
+  80032c:	b8 17 00 00 00       	mov    $0x17,%eax
+  800331:	89 cb                	mov    %ecx,%ebx
+  800333:	89 cf                	mov    %ecx,%edi
+  800335:	89 ce                	mov    %ecx,%esi
+  800337:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  800339:	5b                   	pop    %ebx
+  80033a:	5e                   	pop    %esi
+  80033b:	5f                   	pop    %edi
+  80033c:	5d                   	pop    %ebp
+  80033d:	c3                   	ret
+
+0080033e <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  80033e:	55                   	push   %ebp
+  80033f:	89 e5                	mov    %esp,%ebp
+  800341:	57                   	push   %edi
+  800342:	56                   	push   %esi
+  800343:	53                   	push   %ebx
+  800344:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800347:	be 00 00 00 00       	mov    $0x0,%esi
+  80034c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80034f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800352:	b8 18 00 00 00       	mov    $0x18,%eax
+  800357:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80035a:	89 f7                	mov    %esi,%edi
+  80035c:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80035e:	85 c0                	test   %eax,%eax
+  800360:	7f 08                	jg     80036a <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  800362:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800365:	5b                   	pop    %ebx
+  800366:	5e                   	pop    %esi
+  800367:	5f                   	pop    %edi
+  800368:	5d                   	pop    %ebp
+  800369:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80036a:	83 ec 0c             	sub    $0xc,%esp
+  80036d:	50                   	push   %eax
+  80036e:	6a 18                	push   $0x18
+  800370:	68 8a 2e 80 00       	push   $0x802e8a
+  800375:	6a 23                	push   $0x23
+  800377:	68 a7 2e 80 00       	push   $0x802ea7
+  80037c:	e8 10 1d 00 00       	call   802091 <_panic>
+
+00800381 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  800381:	55                   	push   %ebp
+  800382:	89 e5                	mov    %esp,%ebp
+  800384:	57                   	push   %edi
+  800385:	56                   	push   %esi
+  800386:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800387:	be 00 00 00 00       	mov    $0x0,%esi
+  80038c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80038f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800392:	b8 19 00 00 00       	mov    $0x19,%eax
+  800397:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80039a:	89 f7                	mov    %esi,%edi
+  80039c:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  80039e:	5b                   	pop    %ebx
+  80039f:	5e                   	pop    %esi
+  8003a0:	5f                   	pop    %edi
+  8003a1:	5d                   	pop    %ebp
+  8003a2:	c3                   	ret
+
+008003a3 <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  8003a3:	55                   	push   %ebp
+  8003a4:	89 e5                	mov    %esp,%ebp
+  8003a6:	57                   	push   %edi
+  8003a7:	56                   	push   %esi
+  8003a8:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8003a9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003ae:	b8 15 00 00 00       	mov    $0x15,%eax
+  8003b3:	89 d1                	mov    %edx,%ecx
+  8003b5:	89 d3                	mov    %edx,%ebx
+  8003b7:	89 d7                	mov    %edx,%edi
+  8003b9:	89 d6                	mov    %edx,%esi
+  8003bb:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8003bd:	5b                   	pop    %ebx
+  8003be:	5e                   	pop    %esi
+  8003bf:	5f                   	pop    %edi
+  8003c0:	5d                   	pop    %ebp
+  8003c1:	c3                   	ret
+
+008003c2 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8003c2:	55                   	push   %ebp
+  8003c3:	89 e5                	mov    %esp,%ebp
+  8003c5:	57                   	push   %edi
+  8003c6:	56                   	push   %esi
+  8003c7:	53                   	push   %ebx
+  8003c8:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8003cb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003d0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003d3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003d6:	b8 08 00 00 00       	mov    $0x8,%eax
+  8003db:	89 df                	mov    %ebx,%edi
+  8003dd:	89 de                	mov    %ebx,%esi
+  8003df:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8003e1:	85 c0                	test   %eax,%eax
+  8003e3:	7f 08                	jg     8003ed <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8003e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003e8:	5b                   	pop    %ebx
+  8003e9:	5e                   	pop    %esi
+  8003ea:	5f                   	pop    %edi
+  8003eb:	5d                   	pop    %ebp
+  8003ec:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8003ed:	83 ec 0c             	sub    $0xc,%esp
+  8003f0:	50                   	push   %eax
+  8003f1:	6a 08                	push   $0x8
+  8003f3:	68 8a 2e 80 00       	push   $0x802e8a
+  8003f8:	6a 23                	push   $0x23
+  8003fa:	68 a7 2e 80 00       	push   $0x802ea7
+  8003ff:	e8 8d 1c 00 00       	call   802091 <_panic>
+
+00800404 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800404:	55                   	push   %ebp
+  800405:	89 e5                	mov    %esp,%ebp
+  800407:	57                   	push   %edi
+  800408:	56                   	push   %esi
+  800409:	53                   	push   %ebx
+  80040a:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80040d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800412:	8b 55 08             	mov    0x8(%ebp),%edx
+  800415:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800418:	b8 09 00 00 00       	mov    $0x9,%eax
+  80041d:	89 df                	mov    %ebx,%edi
+  80041f:	89 de                	mov    %ebx,%esi
+  800421:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800423:	85 c0                	test   %eax,%eax
+  800425:	7f 08                	jg     80042f <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  800427:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80042a:	5b                   	pop    %ebx
+  80042b:	5e                   	pop    %esi
+  80042c:	5f                   	pop    %edi
+  80042d:	5d                   	pop    %ebp
+  80042e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80042f:	83 ec 0c             	sub    $0xc,%esp
+  800432:	50                   	push   %eax
+  800433:	6a 09                	push   $0x9
+  800435:	68 8a 2e 80 00       	push   $0x802e8a
+  80043a:	6a 23                	push   $0x23
+  80043c:	68 a7 2e 80 00       	push   $0x802ea7
+  800441:	e8 4b 1c 00 00       	call   802091 <_panic>
+
+00800446 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800446:	55                   	push   %ebp
+  800447:	89 e5                	mov    %esp,%ebp
+  800449:	57                   	push   %edi
+  80044a:	56                   	push   %esi
+  80044b:	53                   	push   %ebx
+  80044c:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80044f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800454:	8b 55 08             	mov    0x8(%ebp),%edx
+  800457:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80045a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80045f:	89 df                	mov    %ebx,%edi
+  800461:	89 de                	mov    %ebx,%esi
+  800463:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800465:	85 c0                	test   %eax,%eax
+  800467:	7f 08                	jg     800471 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  800469:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80046c:	5b                   	pop    %ebx
+  80046d:	5e                   	pop    %esi
+  80046e:	5f                   	pop    %edi
+  80046f:	5d                   	pop    %ebp
+  800470:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800471:	83 ec 0c             	sub    $0xc,%esp
+  800474:	50                   	push   %eax
+  800475:	6a 0a                	push   $0xa
+  800477:	68 8a 2e 80 00       	push   $0x802e8a
+  80047c:	6a 23                	push   $0x23
+  80047e:	68 a7 2e 80 00       	push   $0x802ea7
+  800483:	e8 09 1c 00 00       	call   802091 <_panic>
+
+00800488 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  800488:	55                   	push   %ebp
+  800489:	89 e5                	mov    %esp,%ebp
+  80048b:	57                   	push   %edi
+  80048c:	56                   	push   %esi
+  80048d:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80048e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800491:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800494:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800499:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80049c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80049f:	8b 75 18             	mov    0x18(%ebp),%esi
+  8004a2:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  8004a4:	5b                   	pop    %ebx
+  8004a5:	5e                   	pop    %esi
+  8004a6:	5f                   	pop    %edi
+  8004a7:	5d                   	pop    %ebp
+  8004a8:	c3                   	ret
+
+008004a9 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  8004a9:	55                   	push   %ebp
+  8004aa:	89 e5                	mov    %esp,%ebp
+  8004ac:	57                   	push   %edi
+  8004ad:	56                   	push   %esi
+  8004ae:	53                   	push   %ebx
+  8004af:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8004b2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004b7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004ba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004bd:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8004c2:	89 df                	mov    %ebx,%edi
+  8004c4:	89 de                	mov    %ebx,%esi
+  8004c6:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8004c8:	85 c0                	test   %eax,%eax
+  8004ca:	7f 08                	jg     8004d4 <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  8004cc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004cf:	5b                   	pop    %ebx
+  8004d0:	5e                   	pop    %esi
+  8004d1:	5f                   	pop    %edi
+  8004d2:	5d                   	pop    %ebp
+  8004d3:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8004d4:	83 ec 0c             	sub    $0xc,%esp
+  8004d7:	50                   	push   %eax
+  8004d8:	6a 0d                	push   $0xd
+  8004da:	68 8a 2e 80 00       	push   $0x802e8a
+  8004df:	6a 23                	push   $0x23
+  8004e1:	68 a7 2e 80 00       	push   $0x802ea7
+  8004e6:	e8 a6 1b 00 00       	call   802091 <_panic>
+
+008004eb <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  8004eb:	55                   	push   %ebp
+  8004ec:	89 e5                	mov    %esp,%ebp
+  8004ee:	57                   	push   %edi
+  8004ef:	56                   	push   %esi
+  8004f0:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8004f1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004f6:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8004fb:	89 d1                	mov    %edx,%ecx
+  8004fd:	89 d3                	mov    %edx,%ebx
+  8004ff:	89 d7                	mov    %edx,%edi
+  800501:	89 d6                	mov    %edx,%esi
+  800503:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800505:	5b                   	pop    %ebx
+  800506:	5e                   	pop    %esi
+  800507:	5f                   	pop    %edi
+  800508:	5d                   	pop    %ebp
+  800509:	c3                   	ret
+
+0080050a <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  80050a:	55                   	push   %ebp
+  80050b:	89 e5                	mov    %esp,%ebp
+  80050d:	57                   	push   %edi
+  80050e:	56                   	push   %esi
+  80050f:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800510:	8b 55 08             	mov    0x8(%ebp),%edx
+  800513:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800516:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80051b:	be 00 00 00 00       	mov    $0x0,%esi
+  800520:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800523:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800526:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  800528:	5b                   	pop    %ebx
+  800529:	5e                   	pop    %esi
+  80052a:	5f                   	pop    %edi
+  80052b:	5d                   	pop    %ebp
+  80052c:	c3                   	ret
+
+0080052d <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  80052d:	55                   	push   %ebp
+  80052e:	89 e5                	mov    %esp,%ebp
+  800530:	57                   	push   %edi
+  800531:	56                   	push   %esi
+  800532:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800533:	be 00 00 00 00       	mov    $0x0,%esi
+  800538:	8b 55 08             	mov    0x8(%ebp),%edx
+  80053b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80053e:	b8 10 00 00 00       	mov    $0x10,%eax
+  800543:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800546:	89 f7                	mov    %esi,%edi
+  800548:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  80054a:	5b                   	pop    %ebx
+  80054b:	5e                   	pop    %esi
+  80054c:	5f                   	pop    %edi
+  80054d:	5d                   	pop    %ebp
+  80054e:	c3                   	ret
+
+0080054f <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  80054f:	55                   	push   %ebp
+  800550:	89 e5                	mov    %esp,%ebp
+  800552:	57                   	push   %edi
+  800553:	56                   	push   %esi
+  800554:	53                   	push   %ebx
+  800555:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  800558:	80 3d 48 57 80 00 00 	cmpb   $0x0,0x805748
+  80055f:	74 41                	je     8005a2 <sys_batch+0x53>
+  800561:	8b 45 08             	mov    0x8(%ebp),%eax
+  800564:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  800567:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  80056e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800571:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  800574:	7d 45                	jge    8005bb <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  800576:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800579:	8b 06                	mov    (%esi),%eax
+  80057b:	8b 56 04             	mov    0x4(%esi),%edx
+  80057e:	8b 4e 08             	mov    0x8(%esi),%ecx
+  800581:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  800584:	8b 7e 10             	mov    0x10(%esi),%edi
+  800587:	8b 76 14             	mov    0x14(%esi),%esi
+  80058a:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  80058c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80058f:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  800592:	83 c6 1c             	add    $0x1c,%esi
+  800595:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  800598:	85 c0                	test   %eax,%eax
+  80059a:	78 1f                	js     8005bb <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  80059c:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  8005a0:	eb cc                	jmp    80056e <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  8005a2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005a7:	b8 13 00 00 00       	mov    $0x13,%eax
+  8005ac:	8b 55 08             	mov    0x8(%ebp),%edx
+  8005af:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005b2:	89 df                	mov    %ebx,%edi
+  8005b4:	89 de                	mov    %ebx,%esi
+  8005b6:	cd 30                	int    $0x30
+  8005b8:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  8005bb:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8005be:	83 c4 08             	add    $0x8,%esp
+  8005c1:	5b                   	pop    %ebx
+  8005c2:	5e                   	pop    %esi
+  8005c3:	5f                   	pop    %edi
+  8005c4:	5d                   	pop    %ebp
+  8005c5:	c3                   	ret
+
+008005c6 <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  8005c6:	55                   	push   %ebp
+  8005c7:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  8005c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8005cc:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8005d2:	5d                   	pop    %ebp
+  8005d3:	c3                   	ret
+
+008005d4 <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  8005d4:	55                   	push   %ebp
+  8005d5:	89 e5                	mov    %esp,%ebp
+  8005d7:	56                   	push   %esi
+  8005d8:	53                   	push   %ebx
+  8005d9:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  8005dc:	8b 1e                	mov    (%esi),%ebx
+  8005de:	85 db                	test   %ebx,%ebx
+  8005e0:	75 09                	jne    8005eb <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  8005e2:	89 d8                	mov    %ebx,%eax
+  8005e4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8005e7:	5b                   	pop    %ebx
+  8005e8:	5e                   	pop    %esi
+  8005e9:	5d                   	pop    %ebp
+  8005ea:	c3                   	ret
+  b->sb_n = 0;
+  8005eb:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  8005f1:	53                   	push   %ebx
+  8005f2:	8d 46 04             	lea    0x4(%esi),%eax
+  8005f5:	50                   	push   %eax
+  8005f6:	e8 54 ff ff ff       	call   80054f <sys_batch>
+  8005fb:	83 c4 08             	add    $0x8,%esp
+  8005fe:	85 c0                	test   %eax,%eax
+  800600:	78 1e                	js     800620 <sysbatch_flush+0x4c>
+  if (r < n)
+  800602:	39 c3                	cmp    %eax,%ebx
+  800604:	7f 07                	jg     80060d <sysbatch_flush+0x39>
+  return 0;
+  800606:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80060b:	eb d5                	jmp    8005e2 <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  80060d:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  800610:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  800614:	85 db                	test   %ebx,%ebx
+  800616:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80061b:	0f 49 d8             	cmovns %eax,%ebx
+  80061e:	eb c2                	jmp    8005e2 <sysbatch_flush+0xe>
+    return r;
+  800620:	89 c3                	mov    %eax,%ebx
+  800622:	eb be                	jmp    8005e2 <sysbatch_flush+0xe>
+
+00800624 <sysbatch_add>:
+{
+  800624:	55                   	push   %ebp
+  800625:	89 e5                	mov    %esp,%ebp
+  800627:	53                   	push   %ebx
+  800628:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  80062b:	83 3b 40             	cmpl   $0x40,(%ebx)
+  80062e:	74 41                	je     800671 <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  800630:	8b 03                	mov    (%ebx),%eax
+  800632:	8d 50 01             	lea    0x1(%eax),%edx
+  800635:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  800637:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80063a:	01 d8                	add    %ebx,%eax
+  80063c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80063f:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  800642:	8b 55 10             	mov    0x10(%ebp),%edx
+  800645:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  800648:	8b 55 14             	mov    0x14(%ebp),%edx
+  80064b:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  80064e:	8b 55 18             	mov    0x18(%ebp),%edx
+  800651:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  800654:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  800657:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  80065a:	8b 55 20             	mov    0x20(%ebp),%edx
+  80065d:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  800660:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  800667:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80066c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80066f:	c9                   	leave
+  800670:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  800671:	53                   	push   %ebx
+  800672:	e8 5d ff ff ff       	call   8005d4 <sysbatch_flush>
+  800677:	83 c4 04             	add    $0x4,%esp
+  80067a:	85 c0                	test   %eax,%eax
+  80067c:	79 b2                	jns    800630 <sysbatch_add+0xc>
+  80067e:	eb ec                	jmp    80066c <sysbatch_add+0x48>
+
+00800680 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800680:	55                   	push   %ebp
+  800681:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  800683:	8b 45 08             	mov    0x8(%ebp),%eax
+  800686:	05 00 00 00 30       	add    $0x30000000,%eax
+  80068b:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80068e:	5d                   	pop    %ebp
+  80068f:	c3                   	ret
+
+00800690 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800690:	55                   	push   %ebp
+  800691:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  800693:	8b 45 08             	mov    0x8(%ebp),%eax
+  800696:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  800699:	66 b8 00 00          	mov    $0x0,%ax
+  80069d:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8006a2:	5d                   	pop    %ebp
+  8006a3:	c3                   	ret
+
+008006a4 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8006a4:	55                   	push   %ebp
+  8006a5:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  8006a7:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8006ac:	eb 02                	jmp    8006b0 <fd_alloc+0xc>
+  8006ae:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8006b0:	89 c2                	mov    %eax,%edx
+  8006b2:	c1 ea 16             	shr    $0x16,%edx
+  8006b5:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8006bc:	f6 c2 01             	test   $0x1,%dl
+  8006bf:	74 2b                	je     8006ec <fd_alloc+0x48>
+  8006c1:	89 c2                	mov    %eax,%edx
+  8006c3:	c1 ea 0c             	shr    $0xc,%edx
+  8006c6:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8006cd:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8006d3:	f6 c1 01             	test   $0x1,%cl
+  8006d6:	74 14                	je     8006ec <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  8006d8:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8006de:	75 ce                	jne    8006ae <fd_alloc+0xa>
+  8006e0:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  8006e5:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8006ea:	eb 05                	jmp    8006f1 <fd_alloc+0x4d>
+      return 0;
+  8006ec:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  8006f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006f4:	89 02                	mov    %eax,(%edx)
+}
+  8006f6:	89 c8                	mov    %ecx,%eax
+  8006f8:	5d                   	pop    %ebp
+  8006f9:	c3                   	ret
+
+008006fa <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8006fa:	55                   	push   %ebp
+  8006fb:	89 e5                	mov    %esp,%ebp
+  8006fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  800700:	83 f8 1f             	cmp    $0x1f,%eax
+  800703:	77 30                	ja     800735 <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  800705:	c1 e0 0c             	shl    $0xc,%eax
+  800708:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80070d:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  800713:	f6 c2 01             	test   $0x1,%dl
+  800716:	74 24                	je     80073c <fd_lookup+0x42>
+  800718:	89 c2                	mov    %eax,%edx
+  80071a:	c1 ea 0c             	shr    $0xc,%edx
+  80071d:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800724:	f6 c2 01             	test   $0x1,%dl
+  800727:	74 1a                	je     800743 <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  800729:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80072c:	89 02                	mov    %eax,(%edx)
+  return 0;
+  80072e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800733:	5d                   	pop    %ebp
+  800734:	c3                   	ret
+    return -E_INVAL;
+  800735:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80073a:	eb f7                	jmp    800733 <fd_lookup+0x39>
+    return -E_INVAL;
+  80073c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800741:	eb f0                	jmp    800733 <fd_lookup+0x39>
+  800743:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800748:	eb e9                	jmp    800733 <fd_lookup+0x39>
+
+0080074a <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80074a:	55                   	push   %ebp
+  80074b:	89 e5                	mov    %esp,%ebp
+  80074d:	53                   	push   %ebx
+  80074e:	83 ec 04             	sub    $0x4,%esp
+  800751:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  800754:	b8 34 2f 80 00       	mov    $0x802f34,%eax
+  800759:	8b 18                	mov    (%eax),%ebx
+  80075b:	85 db                	test   %ebx,%ebx
+  80075d:	74 0e                	je     80076d <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  80075f:	83 c0 04             	add    $0x4,%eax
+  800762:	39 13                	cmp    %edx,(%ebx)
+  800764:	75 f3                	jne    800759 <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  800766:	b8 00 00 00 00       	mov    $0x0,%eax
+  80076b:	eb 1f                	jmp    80078c <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80076d:	a1 44 57 80 00       	mov    0x805744,%eax
+  800772:	8b 40 48             	mov    0x48(%eax),%eax
+  800775:	83 ec 04             	sub    $0x4,%esp
+  800778:	52                   	push   %edx
+  800779:	50                   	push   %eax
+  80077a:	68 b8 2e 80 00       	push   $0x802eb8
+  80077f:	e8 e8 19 00 00       	call   80216c <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  800784:	83 c4 10             	add    $0x10,%esp
+  800787:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  80078c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80078f:	89 1a                	mov    %ebx,(%edx)
+}
+  800791:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800794:	c9                   	leave
+  800795:	c3                   	ret
+
+00800796 <fd_close>:
+{
+  800796:	55                   	push   %ebp
+  800797:	89 e5                	mov    %esp,%ebp
+  800799:	57                   	push   %edi
+  80079a:	56                   	push   %esi
+  80079b:	53                   	push   %ebx
+  80079c:	83 ec 24             	sub    $0x24,%esp
+  80079f:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007a2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8007a5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8007a8:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8007a9:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8007af:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8007b2:	50                   	push   %eax
+  8007b3:	e8 42 ff ff ff       	call   8006fa <fd_lookup>
+  8007b8:	89 c3                	mov    %eax,%ebx
+  8007ba:	83 c4 10             	add    $0x10,%esp
+  8007bd:	85 c0                	test   %eax,%eax
+  8007bf:	78 05                	js     8007c6 <fd_close+0x30>
+      || fd != fd2)
+  8007c1:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8007c4:	74 16                	je     8007dc <fd_close+0x46>
+    return must_exist ? r : 0;
+  8007c6:	89 f8                	mov    %edi,%eax
+  8007c8:	84 c0                	test   %al,%al
+  8007ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007cf:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8007d2:	89 d8                	mov    %ebx,%eax
+  8007d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007d7:	5b                   	pop    %ebx
+  8007d8:	5e                   	pop    %esi
+  8007d9:	5f                   	pop    %edi
+  8007da:	5d                   	pop    %ebp
+  8007db:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8007dc:	83 ec 08             	sub    $0x8,%esp
+  8007df:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8007e2:	50                   	push   %eax
+  8007e3:	ff 36                	push   (%esi)
+  8007e5:	e8 60 ff ff ff       	call   80074a <dev_lookup>
+  8007ea:	89 c3                	mov    %eax,%ebx
+  8007ec:	83 c4 10             	add    $0x10,%esp
+  8007ef:	85 c0                	test   %eax,%eax
+  8007f1:	78 1a                	js     80080d <fd_close+0x77>
+    if (dev->dev_close)
+  8007f3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8007f6:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  8007f9:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  8007fe:	85 c0                	test   %eax,%eax
+  800800:	74 0b                	je     80080d <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  800802:	83 ec 0c             	sub    $0xc,%esp
+  800805:	56                   	push   %esi
+  800806:	ff d0                	call   *%eax
+  800808:	89 c3                	mov    %eax,%ebx
+  80080a:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  80080d:	83 ec 08             	sub    $0x8,%esp
+  800810:	56                   	push   %esi
+  800811:	6a 00                	push   $0x0
+  800813:	e8 3e fa ff ff       	call   800256 <sys_page_unmap>
+  return r;
+  800818:	83 c4 10             	add    $0x10,%esp
+  80081b:	eb b5                	jmp    8007d2 <fd_close+0x3c>
+
+0080081d <close>:
+
+int
+close(int fdnum)
+{
+  80081d:	55                   	push   %ebp
+  80081e:	89 e5                	mov    %esp,%ebp
+  800820:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800823:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800826:	50                   	push   %eax
+  800827:	ff 75 08             	push   0x8(%ebp)
+  80082a:	e8 cb fe ff ff       	call   8006fa <fd_lookup>
+  80082f:	83 c4 10             	add    $0x10,%esp
+  800832:	85 c0                	test   %eax,%eax
+  800834:	79 02                	jns    800838 <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  800836:	c9                   	leave
+  800837:	c3                   	ret
+    return fd_close(fd, 1);
+  800838:	83 ec 08             	sub    $0x8,%esp
+  80083b:	6a 01                	push   $0x1
+  80083d:	ff 75 f4             	push   -0xc(%ebp)
+  800840:	e8 51 ff ff ff       	call   800796 <fd_close>
+  800845:	83 c4 10             	add    $0x10,%esp
+  800848:	eb ec                	jmp    800836 <close+0x19>
+
+0080084a <close_all>:
+
+void
+close_all(void)
+{
+  80084a:	55                   	push   %ebp
+  80084b:	89 e5                	mov    %esp,%ebp
+  80084d:	53                   	push   %ebx
+  80084e:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  800851:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  800856:	83 ec 0c             	sub    $0xc,%esp
+  800859:	53                   	push   %ebx
+  80085a:	e8 be ff ff ff       	call   80081d <close>
+  for (i = 0; i < MAXFD; i++)
+  80085f:	83 c3 01             	add    $0x1,%ebx
+  800862:	83 c4 10             	add    $0x10,%esp
+  800865:	83 fb 20             	cmp    $0x20,%ebx
+  800868:	75 ec                	jne    800856 <close_all+0xc>
+}
+  80086a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80086d:	c9                   	leave
+  80086e:	c3                   	ret
+
+0080086f <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80086f:	55                   	push   %ebp
+  800870:	89 e5                	mov    %esp,%ebp
+  800872:	57                   	push   %edi
+  800873:	56                   	push   %esi
+  800874:	53                   	push   %ebx
+  800875:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  800878:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80087b:	50                   	push   %eax
+  80087c:	ff 75 08             	push   0x8(%ebp)
+  80087f:	e8 76 fe ff ff       	call   8006fa <fd_lookup>
+  800884:	89 c6                	mov    %eax,%esi
+  800886:	83 c4 10             	add    $0x10,%esp
+  800889:	85 c0                	test   %eax,%eax
+  80088b:	0f 88 0a 01 00 00    	js     80099b <dup+0x12c>
+    return r;
+  close(newfdnum);
+  800891:	83 ec 0c             	sub    $0xc,%esp
+  800894:	ff 75 0c             	push   0xc(%ebp)
+  800897:	e8 81 ff ff ff       	call   80081d <close>
+
+  newfd = INDEX2FD(newfdnum);
+  80089c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80089f:	c1 e0 0c             	shl    $0xc,%eax
+  8008a2:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  8008a8:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  8008ab:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8008ae:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8008b1:	89 04 24             	mov    %eax,(%esp)
+  8008b4:	e8 d7 fd ff ff       	call   800690 <fd2data>
+  8008b9:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  8008bb:	89 3c 24             	mov    %edi,(%esp)
+  8008be:	e8 cd fd ff ff       	call   800690 <fd2data>
+  8008c3:	83 c4 10             	add    $0x10,%esp
+  8008c6:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8008c9:	89 f3                	mov    %esi,%ebx
+  8008cb:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  8008d1:	89 c6                	mov    %eax,%esi
+  8008d3:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8008d6:	89 cf                	mov    %ecx,%edi
+  8008d8:	eb 0c                	jmp    8008e6 <dup+0x77>
+  8008da:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8008e0:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8008e6:	39 fb                	cmp    %edi,%ebx
+  8008e8:	74 7b                	je     800965 <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  8008ea:	89 d8                	mov    %ebx,%eax
+  8008ec:	c1 e8 16             	shr    $0x16,%eax
+  8008ef:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8008f6:	a8 01                	test   $0x1,%al
+  8008f8:	74 e0                	je     8008da <dup+0x6b>
+  8008fa:	89 d8                	mov    %ebx,%eax
+  8008fc:	c1 e8 0c             	shr    $0xc,%eax
+  8008ff:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  800906:	f6 c2 01             	test   $0x1,%dl
+  800909:	74 cf                	je     8008da <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  80090b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  800912:	83 ec 0c             	sub    $0xc,%esp
+  800915:	25 07 0e 00 00       	and    $0xe07,%eax
+  80091a:	50                   	push   %eax
+  80091b:	56                   	push   %esi
+  80091c:	6a 00                	push   $0x0
+  80091e:	53                   	push   %ebx
+  80091f:	6a 00                	push   $0x0
+  800921:	e8 ee f8 ff ff       	call   800214 <sys_page_map>
+  800926:	83 c4 20             	add    $0x20,%esp
+  800929:	85 c0                	test   %eax,%eax
+  80092b:	79 ad                	jns    8008da <dup+0x6b>
+  80092d:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800930:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  800932:	83 ec 08             	sub    $0x8,%esp
+  800935:	ff 75 d4             	push   -0x2c(%ebp)
+  800938:	6a 00                	push   $0x0
+  80093a:	e8 17 f9 ff ff       	call   800256 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80093f:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  800942:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  800948:	83 c4 10             	add    $0x10,%esp
+  80094b:	39 df                	cmp    %ebx,%edi
+  80094d:	74 4c                	je     80099b <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  80094f:	83 ec 08             	sub    $0x8,%esp
+  800952:	57                   	push   %edi
+  800953:	6a 00                	push   $0x0
+  800955:	e8 fc f8 ff ff       	call   800256 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80095a:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  800960:	83 c4 10             	add    $0x10,%esp
+  800963:	eb e6                	jmp    80094b <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  800965:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800968:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80096b:	89 c8                	mov    %ecx,%eax
+  80096d:	c1 e8 0c             	shr    $0xc,%eax
+  800970:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800977:	83 ec 0c             	sub    $0xc,%esp
+  80097a:	25 07 0e 00 00       	and    $0xe07,%eax
+  80097f:	50                   	push   %eax
+  800980:	ff 75 d4             	push   -0x2c(%ebp)
+  800983:	6a 00                	push   $0x0
+  800985:	51                   	push   %ecx
+  800986:	6a 00                	push   $0x0
+  800988:	e8 87 f8 ff ff       	call   800214 <sys_page_map>
+  80098d:	89 c6                	mov    %eax,%esi
+  80098f:	83 c4 20             	add    $0x20,%esp
+  800992:	85 c0                	test   %eax,%eax
+  800994:	78 9c                	js     800932 <dup+0xc3>
+  return newfdnum;
+  800996:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800999:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  80099b:	89 f0                	mov    %esi,%eax
+  80099d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009a0:	5b                   	pop    %ebx
+  8009a1:	5e                   	pop    %esi
+  8009a2:	5f                   	pop    %edi
+  8009a3:	5d                   	pop    %ebp
+  8009a4:	c3                   	ret
+
+008009a5 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8009a5:	55                   	push   %ebp
+  8009a6:	89 e5                	mov    %esp,%ebp
+  8009a8:	56                   	push   %esi
+  8009a9:	53                   	push   %ebx
+  8009aa:	83 ec 18             	sub    $0x18,%esp
+  8009ad:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  8009b0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8009b3:	50                   	push   %eax
+  8009b4:	56                   	push   %esi
+  8009b5:	e8 40 fd ff ff       	call   8006fa <fd_lookup>
+  8009ba:	83 c4 10             	add    $0x10,%esp
+  8009bd:	85 c0                	test   %eax,%eax
+  8009bf:	78 3c                	js     8009fd <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8009c1:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8009c4:	83 ec 08             	sub    $0x8,%esp
+  8009c7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8009ca:	50                   	push   %eax
+  8009cb:	ff 33                	push   (%ebx)
+  8009cd:	e8 78 fd ff ff       	call   80074a <dev_lookup>
+  8009d2:	83 c4 10             	add    $0x10,%esp
+  8009d5:	85 c0                	test   %eax,%eax
+  8009d7:	78 24                	js     8009fd <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8009d9:	8b 43 08             	mov    0x8(%ebx),%eax
+  8009dc:	83 e0 03             	and    $0x3,%eax
+  8009df:	83 f8 01             	cmp    $0x1,%eax
+  8009e2:	74 20                	je     800a04 <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  8009e4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009e7:	8b 40 08             	mov    0x8(%eax),%eax
+  8009ea:	85 c0                	test   %eax,%eax
+  8009ec:	74 37                	je     800a25 <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  8009ee:	83 ec 04             	sub    $0x4,%esp
+  8009f1:	ff 75 10             	push   0x10(%ebp)
+  8009f4:	ff 75 0c             	push   0xc(%ebp)
+  8009f7:	53                   	push   %ebx
+  8009f8:	ff d0                	call   *%eax
+  8009fa:	83 c4 10             	add    $0x10,%esp
+}
+  8009fd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800a00:	5b                   	pop    %ebx
+  800a01:	5e                   	pop    %esi
+  800a02:	5d                   	pop    %ebp
+  800a03:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800a04:	a1 44 57 80 00       	mov    0x805744,%eax
+  800a09:	8b 40 48             	mov    0x48(%eax),%eax
+  800a0c:	83 ec 04             	sub    $0x4,%esp
+  800a0f:	56                   	push   %esi
+  800a10:	50                   	push   %eax
+  800a11:	68 f9 2e 80 00       	push   $0x802ef9
+  800a16:	e8 51 17 00 00       	call   80216c <cprintf>
+    return -E_INVAL;
+  800a1b:	83 c4 10             	add    $0x10,%esp
+  800a1e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a23:	eb d8                	jmp    8009fd <read+0x58>
+    return -E_NOT_SUPP;
+  800a25:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800a2a:	eb d1                	jmp    8009fd <read+0x58>
+
+00800a2c <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  800a2c:	55                   	push   %ebp
+  800a2d:	89 e5                	mov    %esp,%ebp
+  800a2f:	57                   	push   %edi
+  800a30:	56                   	push   %esi
+  800a31:	53                   	push   %ebx
+  800a32:	83 ec 0c             	sub    $0xc,%esp
+  800a35:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a38:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  800a3b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800a40:	eb 02                	jmp    800a44 <readn+0x18>
+  800a42:	01 c3                	add    %eax,%ebx
+  800a44:	39 f3                	cmp    %esi,%ebx
+  800a46:	73 21                	jae    800a69 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  800a48:	83 ec 04             	sub    $0x4,%esp
+  800a4b:	89 f0                	mov    %esi,%eax
+  800a4d:	29 d8                	sub    %ebx,%eax
+  800a4f:	50                   	push   %eax
+  800a50:	89 d8                	mov    %ebx,%eax
+  800a52:	03 45 0c             	add    0xc(%ebp),%eax
+  800a55:	50                   	push   %eax
+  800a56:	57                   	push   %edi
+  800a57:	e8 49 ff ff ff       	call   8009a5 <read>
+    if (m < 0)
+  800a5c:	83 c4 10             	add    $0x10,%esp
+  800a5f:	85 c0                	test   %eax,%eax
+  800a61:	78 04                	js     800a67 <readn+0x3b>
+      return m;
+    if (m == 0)
+  800a63:	75 dd                	jne    800a42 <readn+0x16>
+  800a65:	eb 02                	jmp    800a69 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  800a67:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  800a69:	89 d8                	mov    %ebx,%eax
+  800a6b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a6e:	5b                   	pop    %ebx
+  800a6f:	5e                   	pop    %esi
+  800a70:	5f                   	pop    %edi
+  800a71:	5d                   	pop    %ebp
+  800a72:	c3                   	ret
+
+00800a73 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  800a73:	55                   	push   %ebp
+  800a74:	89 e5                	mov    %esp,%ebp
+  800a76:	56                   	push   %esi
+  800a77:	53                   	push   %ebx
+  800a78:	83 ec 18             	sub    $0x18,%esp
+  800a7b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  800a7e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800a81:	50                   	push   %eax
+  800a82:	53                   	push   %ebx
+  800a83:	e8 72 fc ff ff       	call   8006fa <fd_lookup>
+  800a88:	83 c4 10             	add    $0x10,%esp
+  800a8b:	85 c0                	test   %eax,%eax
+  800a8d:	78 37                	js     800ac6 <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800a8f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800a92:	83 ec 08             	sub    $0x8,%esp
+  800a95:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a98:	50                   	push   %eax
+  800a99:	ff 36                	push   (%esi)
+  800a9b:	e8 aa fc ff ff       	call   80074a <dev_lookup>
+  800aa0:	83 c4 10             	add    $0x10,%esp
+  800aa3:	85 c0                	test   %eax,%eax
+  800aa5:	78 1f                	js     800ac6 <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800aa7:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800aab:	74 20                	je     800acd <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  800aad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ab0:	8b 40 0c             	mov    0xc(%eax),%eax
+  800ab3:	85 c0                	test   %eax,%eax
+  800ab5:	74 37                	je     800aee <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  800ab7:	83 ec 04             	sub    $0x4,%esp
+  800aba:	ff 75 10             	push   0x10(%ebp)
+  800abd:	ff 75 0c             	push   0xc(%ebp)
+  800ac0:	56                   	push   %esi
+  800ac1:	ff d0                	call   *%eax
+  800ac3:	83 c4 10             	add    $0x10,%esp
+}
+  800ac6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ac9:	5b                   	pop    %ebx
+  800aca:	5e                   	pop    %esi
+  800acb:	5d                   	pop    %ebp
+  800acc:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800acd:	a1 44 57 80 00       	mov    0x805744,%eax
+  800ad2:	8b 40 48             	mov    0x48(%eax),%eax
+  800ad5:	83 ec 04             	sub    $0x4,%esp
+  800ad8:	53                   	push   %ebx
+  800ad9:	50                   	push   %eax
+  800ada:	68 15 2f 80 00       	push   $0x802f15
+  800adf:	e8 88 16 00 00       	call   80216c <cprintf>
+    return -E_INVAL;
+  800ae4:	83 c4 10             	add    $0x10,%esp
+  800ae7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800aec:	eb d8                	jmp    800ac6 <write+0x53>
+    return -E_NOT_SUPP;
+  800aee:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800af3:	eb d1                	jmp    800ac6 <write+0x53>
+
+00800af5 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  800af5:	55                   	push   %ebp
+  800af6:	89 e5                	mov    %esp,%ebp
+  800af8:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800afb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800afe:	50                   	push   %eax
+  800aff:	ff 75 08             	push   0x8(%ebp)
+  800b02:	e8 f3 fb ff ff       	call   8006fa <fd_lookup>
+  800b07:	83 c4 10             	add    $0x10,%esp
+  800b0a:	85 c0                	test   %eax,%eax
+  800b0c:	78 0e                	js     800b1c <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  800b0e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b11:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b14:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  800b17:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b1c:	c9                   	leave
+  800b1d:	c3                   	ret
+
+00800b1e <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800b1e:	55                   	push   %ebp
+  800b1f:	89 e5                	mov    %esp,%ebp
+  800b21:	56                   	push   %esi
+  800b22:	53                   	push   %ebx
+  800b23:	83 ec 18             	sub    $0x18,%esp
+  800b26:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  800b29:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800b2c:	50                   	push   %eax
+  800b2d:	53                   	push   %ebx
+  800b2e:	e8 c7 fb ff ff       	call   8006fa <fd_lookup>
+  800b33:	83 c4 10             	add    $0x10,%esp
+  800b36:	85 c0                	test   %eax,%eax
+  800b38:	78 34                	js     800b6e <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800b3a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800b3d:	83 ec 08             	sub    $0x8,%esp
+  800b40:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b43:	50                   	push   %eax
+  800b44:	ff 36                	push   (%esi)
+  800b46:	e8 ff fb ff ff       	call   80074a <dev_lookup>
+  800b4b:	83 c4 10             	add    $0x10,%esp
+  800b4e:	85 c0                	test   %eax,%eax
+  800b50:	78 1c                	js     800b6e <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800b52:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800b56:	74 1d                	je     800b75 <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  800b58:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b5b:	8b 40 18             	mov    0x18(%eax),%eax
+  800b5e:	85 c0                	test   %eax,%eax
+  800b60:	74 34                	je     800b96 <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  800b62:	83 ec 08             	sub    $0x8,%esp
+  800b65:	ff 75 0c             	push   0xc(%ebp)
+  800b68:	56                   	push   %esi
+  800b69:	ff d0                	call   *%eax
+  800b6b:	83 c4 10             	add    $0x10,%esp
+}
+  800b6e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b71:	5b                   	pop    %ebx
+  800b72:	5e                   	pop    %esi
+  800b73:	5d                   	pop    %ebp
+  800b74:	c3                   	ret
+            thisenv->env_id, fdnum);
+  800b75:	a1 44 57 80 00       	mov    0x805744,%eax
+  800b7a:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800b7d:	83 ec 04             	sub    $0x4,%esp
+  800b80:	53                   	push   %ebx
+  800b81:	50                   	push   %eax
+  800b82:	68 d8 2e 80 00       	push   $0x802ed8
+  800b87:	e8 e0 15 00 00       	call   80216c <cprintf>
+    return -E_INVAL;
+  800b8c:	83 c4 10             	add    $0x10,%esp
+  800b8f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b94:	eb d8                	jmp    800b6e <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  800b96:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800b9b:	eb d1                	jmp    800b6e <ftruncate+0x50>
+
+00800b9d <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800b9d:	55                   	push   %ebp
+  800b9e:	89 e5                	mov    %esp,%ebp
+  800ba0:	56                   	push   %esi
+  800ba1:	53                   	push   %ebx
+  800ba2:	83 ec 18             	sub    $0x18,%esp
+  800ba5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  800ba8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800bab:	50                   	push   %eax
+  800bac:	ff 75 08             	push   0x8(%ebp)
+  800baf:	e8 46 fb ff ff       	call   8006fa <fd_lookup>
+  800bb4:	83 c4 10             	add    $0x10,%esp
+  800bb7:	85 c0                	test   %eax,%eax
+  800bb9:	78 49                	js     800c04 <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800bbb:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800bbe:	83 ec 08             	sub    $0x8,%esp
+  800bc1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800bc4:	50                   	push   %eax
+  800bc5:	ff 36                	push   (%esi)
+  800bc7:	e8 7e fb ff ff       	call   80074a <dev_lookup>
+  800bcc:	83 c4 10             	add    $0x10,%esp
+  800bcf:	85 c0                	test   %eax,%eax
+  800bd1:	78 31                	js     800c04 <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  800bd3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800bd6:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800bda:	74 2f                	je     800c0b <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  800bdc:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  800bdf:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800be6:	00 00 00 
+  stat->st_isdir = 0;
+  800be9:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800bf0:	00 00 00 
+  stat->st_dev = dev;
+  800bf3:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  800bf9:	83 ec 08             	sub    $0x8,%esp
+  800bfc:	53                   	push   %ebx
+  800bfd:	56                   	push   %esi
+  800bfe:	ff 50 14             	call   *0x14(%eax)
+  800c01:	83 c4 10             	add    $0x10,%esp
+}
+  800c04:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c07:	5b                   	pop    %ebx
+  800c08:	5e                   	pop    %esi
+  800c09:	5d                   	pop    %ebp
+  800c0a:	c3                   	ret
+    return -E_NOT_SUPP;
+  800c0b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800c10:	eb f2                	jmp    800c04 <fstat+0x67>
+
+00800c12 <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  800c12:	55                   	push   %ebp
+  800c13:	89 e5                	mov    %esp,%ebp
+  800c15:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  800c18:	ff 75 0c             	push   0xc(%ebp)
+  800c1b:	ff 75 08             	push   0x8(%ebp)
+  800c1e:	e8 58 07 00 00       	call   80137b <file_stat>
+}
+  800c23:	c9                   	leave
+  800c24:	c3                   	ret
+
+00800c25 <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  800c25:	55                   	push   %ebp
+  800c26:	89 e5                	mov    %esp,%ebp
+  800c28:	57                   	push   %edi
+  800c29:	56                   	push   %esi
+  800c2a:	53                   	push   %ebx
+  800c2b:	83 ec 1c             	sub    $0x1c,%esp
+  800c2e:	89 c7                	mov    %eax,%edi
+  800c30:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  800c33:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  800c36:	e9 a2 00 00 00       	jmp    800cdd <fsipc_send+0xb8>
+  nfsenvs = 0;
+  800c3b:	c7 05 00 50 80 00 00 	movl   $0x0,0x805000
+  800c42:	00 00 00 
+  800c45:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c4a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  800c4f:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  800c54:	be 01 00 00 00       	mov    $0x1,%esi
+  800c59:	eb 0f                	jmp    800c6a <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  800c5b:	83 c0 01             	add    $0x1,%eax
+  800c5e:	3d 00 04 00 00       	cmp    $0x400,%eax
+  800c63:	74 49                	je     800cae <fsipc_send+0x89>
+  800c65:	83 f9 07             	cmp    $0x7,%ecx
+  800c68:	7f 50                	jg     800cba <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  800c6a:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  800c6d:	c1 e2 04             	shl    $0x4,%edx
+  800c70:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800c76:	8b 52 50             	mov    0x50(%edx),%edx
+  800c79:	83 fa 01             	cmp    $0x1,%edx
+  800c7c:	75 dd                	jne    800c5b <fsipc_send+0x36>
+  800c7e:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  800c81:	c1 e2 04             	shl    $0x4,%edx
+  800c84:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800c8a:	8b 52 54             	mov    0x54(%edx),%edx
+  800c8d:	85 d2                	test   %edx,%edx
+  800c8f:	74 ca                	je     800c5b <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  800c91:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  800c94:	c1 e2 04             	shl    $0x4,%edx
+  800c97:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800c9d:	8b 52 48             	mov    0x48(%edx),%edx
+  800ca0:	89 14 8d 20 50 80 00 	mov    %edx,0x805020(,%ecx,4)
+  800ca7:	8d 49 01             	lea    0x1(%ecx),%ecx
+  800caa:	89 f3                	mov    %esi,%ebx
+  800cac:	eb ad                	jmp    800c5b <fsipc_send+0x36>
+  800cae:	84 db                	test   %bl,%bl
+  800cb0:	74 38                	je     800cea <fsipc_send+0xc5>
+  800cb2:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  800cb8:	eb 30                	jmp    800cea <fsipc_send+0xc5>
+  800cba:	84 db                	test   %bl,%bl
+  800cbc:	74 2c                	je     800cea <fsipc_send+0xc5>
+  800cbe:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  800cc4:	eb 24                	jmp    800cea <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  800cc6:	50                   	push   %eax
+  800cc7:	68 44 2f 80 00       	push   $0x802f44
+  800ccc:	6a 34                	push   $0x34
+  800cce:	68 4e 2f 80 00       	push   $0x802f4e
+  800cd3:	e8 b9 13 00 00       	call   802091 <_panic>
+    }
+    sys_yield();
+  800cd8:	e8 92 f4 ff ff       	call   80016f <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  800cdd:	83 3d 00 50 80 00 03 	cmpl   $0x3,0x805000
+  800ce4:	0f 8e 51 ff ff ff    	jle    800c3b <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  800cea:	a1 44 57 80 00       	mov    0x805744,%eax
+  800cef:	8b 70 48             	mov    0x48(%eax),%esi
+  800cf2:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  800cf8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cfd:	8b 0d 00 50 80 00    	mov    0x805000,%ecx
+  800d03:	39 d9                	cmp    %ebx,%ecx
+  800d05:	7e d1                	jle    800cd8 <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  800d07:	83 ec 0c             	sub    $0xc,%esp
+  800d0a:	ff 75 e0             	push   -0x20(%ebp)
+  800d0d:	6a 07                	push   $0x7
+  800d0f:	ff 75 e4             	push   -0x1c(%ebp)
+  800d12:	57                   	push   %edi
+  800d13:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  800d16:	99                   	cltd
+  800d17:	f7 f9                	idiv   %ecx
+  800d19:	ff 34 95 20 50 80 00 	push   0x805020(,%edx,4)
+  800d20:	e8 63 f7 ff ff       	call   800488 <sys_ipc_try_send>
+      if (r == 0)
+  800d25:	83 c4 20             	add    $0x20,%esp
+  800d28:	85 c0                	test   %eax,%eax
+  800d2a:	74 0a                	je     800d36 <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  800d2c:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  800d2f:	75 95                	jne    800cc6 <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  800d31:	83 c3 01             	add    $0x1,%ebx
+  800d34:	eb c7                	jmp    800cfd <fsipc_send+0xd8>
+  }
+}
+  800d36:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d39:	5b                   	pop    %ebx
+  800d3a:	5e                   	pop    %esi
+  800d3b:	5f                   	pop    %edi
+  800d3c:	5d                   	pop    %ebp
+  800d3d:	c3                   	ret
+
+00800d3e <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  800d3e:	55                   	push   %ebp
+  800d3f:	89 e5                	mov    %esp,%ebp
+  800d41:	53                   	push   %ebx
+  800d42:	83 ec 14             	sub    $0x14,%esp
+  800d45:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  800d47:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  800d4e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800d53:	ba 00 60 80 00       	mov    $0x806000,%edx
+  800d58:	e8 c8 fe ff ff       	call   800c25 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  800d5d:	6a 00                	push   $0x0
+  800d5f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800d62:	50                   	push   %eax
+  800d63:	53                   	push   %ebx
+  800d64:	6a 00                	push   $0x0
+  800d66:	e8 1f 1d 00 00       	call   802a8a <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  800d6b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d6e:	c9                   	leave
+  800d6f:	c3                   	ret
+
+00800d70 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  800d70:	55                   	push   %ebp
+  800d71:	89 e5                	mov    %esp,%ebp
+  800d73:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800d76:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d79:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d7c:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.set_size.req_size = newsize;
+  800d81:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d84:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  800d89:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d8e:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d93:	e8 a6 ff ff ff       	call   800d3e <fsipc>
+}
+  800d98:	c9                   	leave
+  800d99:	c3                   	ret
+
+00800d9a <devfile_flush>:
+{
+  800d9a:	55                   	push   %ebp
+  800d9b:	89 e5                	mov    %esp,%ebp
+  800d9d:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800da0:	8b 45 08             	mov    0x8(%ebp),%eax
+  800da3:	8b 40 0c             	mov    0xc(%eax),%eax
+  800da6:	a3 00 60 80 00       	mov    %eax,0x806000
+  return fsipc(FSREQ_FLUSH, NULL);
+  800dab:	ba 00 00 00 00       	mov    $0x0,%edx
+  800db0:	b8 06 00 00 00       	mov    $0x6,%eax
+  800db5:	e8 84 ff ff ff       	call   800d3e <fsipc>
+}
+  800dba:	c9                   	leave
+  800dbb:	c3                   	ret
+
+00800dbc <devfile_stat>:
+{
+  800dbc:	55                   	push   %ebp
+  800dbd:	89 e5                	mov    %esp,%ebp
+  800dbf:	53                   	push   %ebx
+  800dc0:	83 ec 04             	sub    $0x4,%esp
+  800dc3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800dc6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dc9:	8b 40 0c             	mov    0xc(%eax),%eax
+  800dcc:	a3 00 60 80 00       	mov    %eax,0x806000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  800dd1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dd6:	b8 05 00 00 00       	mov    $0x5,%eax
+  800ddb:	e8 5e ff ff ff       	call   800d3e <fsipc>
+  800de0:	85 c0                	test   %eax,%eax
+  800de2:	78 2c                	js     800e10 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800de4:	83 ec 08             	sub    $0x8,%esp
+  800de7:	68 00 60 80 00       	push   $0x806000
+  800dec:	53                   	push   %ebx
+  800ded:	e8 68 19 00 00       	call   80275a <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  800df2:	a1 80 60 80 00       	mov    0x806080,%eax
+  800df7:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800dfd:	a1 84 60 80 00       	mov    0x806084,%eax
+  800e02:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  800e08:	83 c4 10             	add    $0x10,%esp
+  800e0b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e10:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e13:	c9                   	leave
+  800e14:	c3                   	ret
+
+00800e15 <fsv_alloc>:
+{
+  800e15:	55                   	push   %ebp
+  800e16:	89 e5                	mov    %esp,%ebp
+  800e18:	56                   	push   %esi
+  800e19:	53                   	push   %ebx
+  800e1a:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  800e1c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e21:	eb 22                	jmp    800e45 <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  800e23:	83 ec 04             	sub    $0x4,%esp
+  800e26:	6a 00                	push   $0x0
+  800e28:	6a 00                	push   $0x0
+  800e2a:	6a 07                	push   $0x7
+  800e2c:	50                   	push   %eax
+  800e2d:	6a 00                	push   $0x0
+  800e2f:	6a 04                	push   $0x4
+  800e31:	68 40 50 80 00       	push   $0x805040
+  800e36:	e8 e9 f7 ff ff       	call   800624 <sysbatch_add>
+  800e3b:	83 c4 20             	add    $0x20,%esp
+  800e3e:	85 c0                	test   %eax,%eax
+  800e40:	78 48                	js     800e8a <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  800e42:	83 c3 01             	add    $0x1,%ebx
+  800e45:	39 f3                	cmp    %esi,%ebx
+  800e47:	74 31                	je     800e7a <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  800e49:	89 d8                	mov    %ebx,%eax
+  800e4b:	c1 e0 0c             	shl    $0xc,%eax
+  800e4e:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  800e53:	89 c2                	mov    %eax,%edx
+  800e55:	c1 ea 16             	shr    $0x16,%edx
+  800e58:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800e5f:	f6 c2 01             	test   $0x1,%dl
+  800e62:	74 bf                	je     800e23 <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  800e64:	89 c2                	mov    %eax,%edx
+  800e66:	c1 ea 0c             	shr    $0xc,%edx
+  800e69:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800e70:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  800e73:	83 fa 03             	cmp    $0x3,%edx
+  800e76:	75 ab                	jne    800e23 <fsv_alloc+0xe>
+  800e78:	eb c8                	jmp    800e42 <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  800e7a:	83 ec 0c             	sub    $0xc,%esp
+  800e7d:	68 40 50 80 00       	push   $0x805040
+  800e82:	e8 4d f7 ff ff       	call   8005d4 <sysbatch_flush>
+  800e87:	83 c4 10             	add    $0x10,%esp
+}
+  800e8a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e8d:	5b                   	pop    %ebx
+  800e8e:	5e                   	pop    %esi
+  800e8f:	5d                   	pop    %ebp
+  800e90:	c3                   	ret
+
+00800e91 <devfile_read>:
+{
+  800e91:	55                   	push   %ebp
+  800e92:	89 e5                	mov    %esp,%ebp
+  800e94:	57                   	push   %edi
+  800e95:	56                   	push   %esi
+  800e96:	53                   	push   %ebx
+  800e97:	83 ec 3c             	sub    $0x3c,%esp
+  800e9a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  800e9d:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  800ea3:	77 57                	ja     800efc <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800ea5:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ea8:	8b 40 0c             	mov    0xc(%eax),%eax
+  800eab:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read.req_n = n;
+  800eb0:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  800eb6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ebb:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ec0:	e8 79 fe ff ff       	call   800d3e <fsipc>
+  800ec5:	89 c6                	mov    %eax,%esi
+  800ec7:	85 c0                	test   %eax,%eax
+  800ec9:	78 27                	js     800ef2 <devfile_read+0x61>
+  assert(r <= n);
+  800ecb:	39 c3                	cmp    %eax,%ebx
+  800ecd:	0f 82 0e 02 00 00    	jb     8010e1 <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  800ed3:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800ed8:	0f 8f 1c 02 00 00    	jg     8010fa <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  800ede:	83 ec 04             	sub    $0x4,%esp
+  800ee1:	50                   	push   %eax
+  800ee2:	68 00 60 80 00       	push   $0x806000
+  800ee7:	ff 75 0c             	push   0xc(%ebp)
+  800eea:	e8 f1 19 00 00       	call   8028e0 <memmove>
+  return r;
+  800eef:	83 c4 10             	add    $0x10,%esp
+}
+  800ef2:	89 f0                	mov    %esi,%eax
+  800ef4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ef7:	5b                   	pop    %ebx
+  800ef8:	5e                   	pop    %esi
+  800ef9:	5f                   	pop    %edi
+  800efa:	5d                   	pop    %ebp
+  800efb:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  800efc:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f01:	e8 0f ff ff ff       	call   800e15 <fsv_alloc>
+  800f06:	89 c6                	mov    %eax,%esi
+  800f08:	85 c0                	test   %eax,%eax
+  800f0a:	78 e6                	js     800ef2 <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  800f0c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f0f:	8b 40 0c             	mov    0xc(%eax),%eax
+  800f12:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  800f17:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f1a:	8b 40 04             	mov    0x4(%eax),%eax
+  800f1d:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  800f22:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  800f28:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  800f2f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800f34:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  800f39:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f3e:	e8 e2 fc ff ff       	call   800c25 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  800f43:	6a 00                	push   $0x0
+  800f45:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800f48:	50                   	push   %eax
+  800f49:	68 00 10 c0 9f       	push   $0x9fc01000
+  800f4e:	6a 00                	push   $0x0
+  800f50:	e8 35 1b 00 00       	call   802a8a <ipc_recv_pages>
+  800f55:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  800f57:	83 c4 10             	add    $0x10,%esp
+  800f5a:	85 c0                	test   %eax,%eax
+  800f5c:	7e 94                	jle    800ef2 <devfile_read+0x61>
+  assert(r <= n);
+  800f5e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800f61:	39 c3                	cmp    %eax,%ebx
+  800f63:	72 2e                	jb     800f93 <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  800f65:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f68:	8b 40 04             	mov    0x4(%eax),%eax
+  800f6b:	25 ff 0f 00 00       	and    $0xfff,%eax
+  800f70:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  800f73:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800f76:	c1 e2 0c             	shl    $0xc,%edx
+  800f79:	39 ca                	cmp    %ecx,%edx
+  800f7b:	72 2f                	jb     800fac <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  800f7d:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  800f82:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  800f85:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  800f89:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  800f8e:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  800f91:	eb 52                	jmp    800fe5 <devfile_read+0x154>
+  assert(r <= n);
+  800f93:	68 59 2f 80 00       	push   $0x802f59
+  800f98:	68 60 2f 80 00       	push   $0x802f60
+  800f9d:	68 49 01 00 00       	push   $0x149
+  800fa2:	68 4e 2f 80 00       	push   $0x802f4e
+  800fa7:	e8 e5 10 00 00       	call   802091 <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  800fac:	68 84 2f 80 00       	push   $0x802f84
+  800fb1:	68 60 2f 80 00       	push   $0x802f60
+  800fb6:	68 4a 01 00 00       	push   $0x14a
+  800fbb:	68 4e 2f 80 00       	push   $0x802f4e
+  800fc0:	e8 cc 10 00 00       	call   802091 <_panic>
+      memmove(dst + done, src + done, m);
+  800fc5:	83 ec 04             	sub    $0x4,%esp
+  800fc8:	53                   	push   %ebx
+  800fc9:	56                   	push   %esi
+  800fca:	89 f8                	mov    %edi,%eax
+  800fcc:	03 45 0c             	add    0xc(%ebp),%eax
+  800fcf:	50                   	push   %eax
+  800fd0:	e8 0b 19 00 00       	call   8028e0 <memmove>
+  800fd5:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  800fd8:	01 df                	add    %ebx,%edi
+  800fda:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800fdd:	39 c7                	cmp    %eax,%edi
+  800fdf:	0f 83 c0 00 00 00    	jae    8010a5 <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  800fe5:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800fe8:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  800feb:	89 f0                	mov    %esi,%eax
+  800fed:	25 ff 0f 00 00       	and    $0xfff,%eax
+  800ff2:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  800ff7:	29 c3                	sub    %eax,%ebx
+  800ff9:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800ffc:	29 f8                	sub    %edi,%eax
+  800ffe:	39 c3                	cmp    %eax,%ebx
+  801000:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  801003:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801009:	75 ba                	jne    800fc5 <devfile_read+0x134>
+  80100b:	89 f9                	mov    %edi,%ecx
+  80100d:	03 4d 0c             	add    0xc(%ebp),%ecx
+  801010:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  801013:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  801019:	75 aa                	jne    800fc5 <devfile_read+0x134>
+  80101b:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  801021:	77 a2                	ja     800fc5 <devfile_read+0x134>
+  801023:	89 c8                	mov    %ecx,%eax
+  801025:	c1 e8 16             	shr    $0x16,%eax
+  801028:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80102f:	a8 01                	test   $0x1,%al
+  801031:	74 92                	je     800fc5 <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  801033:	89 c8                	mov    %ecx,%eax
+  801035:	c1 e8 0c             	shr    $0xc,%eax
+  801038:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  80103f:	a8 01                	test   $0x1,%al
+  801041:	74 82                	je     800fc5 <devfile_read+0x134>
+  801043:	a9 02 08 00 00       	test   $0x802,%eax
+  801048:	0f 84 77 ff ff ff    	je     800fc5 <devfile_read+0x134>
+  80104e:	f6 c4 04             	test   $0x4,%ah
+  801051:	0f 85 6e ff ff ff    	jne    800fc5 <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  801057:	a1 44 57 80 00       	mov    0x805744,%eax
+  80105c:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  801060:	84 c0                	test   %al,%al
+  801062:	75 17                	jne    80107b <devfile_read+0x1ea>
+  801064:	83 ec 08             	sub    $0x8,%esp
+  801067:	6a 01                	push   $0x1
+  801069:	6a 00                	push   $0x0
+  80106b:	e8 1e f1 ff ff       	call   80018e <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  801070:	83 c4 10             	add    $0x10,%esp
+  801073:	85 c0                	test   %eax,%eax
+  801075:	0f 85 4a ff ff ff    	jne    800fc5 <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  80107b:	83 ec 04             	sub    $0x4,%esp
+  80107e:	68 05 08 00 00       	push   $0x805
+  801083:	ff 75 cc             	push   -0x34(%ebp)
+  801086:	6a 00                	push   $0x0
+  801088:	56                   	push   %esi
+  801089:	6a 00                	push   $0x0
+  80108b:	6a 05                	push   $0x5
+  80108d:	68 40 50 80 00       	push   $0x805040
+  801092:	e8 8d f5 ff ff       	call   800624 <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  801097:	c1 e8 1f             	shr    $0x1f,%eax
+  80109a:	08 45 cb             	or     %al,-0x35(%ebp)
+  80109d:	83 c4 20             	add    $0x20,%esp
+  8010a0:	e9 33 ff ff ff       	jmp    800fd8 <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  8010a5:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  8010a8:	83 ec 0c             	sub    $0xc,%esp
+  8010ab:	68 40 50 80 00       	push   $0x805040
+  8010b0:	e8 1f f5 ff ff       	call   8005d4 <sysbatch_flush>
+  8010b5:	83 c4 10             	add    $0x10,%esp
+  8010b8:	85 c0                	test   %eax,%eax
+  8010ba:	78 06                	js     8010c2 <devfile_read+0x231>
+  8010bc:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  8010c0:	74 14                	je     8010d6 <devfile_read+0x245>
+    memmove(dst, src, r);
+  8010c2:	83 ec 04             	sub    $0x4,%esp
+  8010c5:	ff 75 d4             	push   -0x2c(%ebp)
+  8010c8:	ff 75 d0             	push   -0x30(%ebp)
+  8010cb:	ff 75 0c             	push   0xc(%ebp)
+  8010ce:	e8 0d 18 00 00       	call   8028e0 <memmove>
+  8010d3:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  8010d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010d9:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  8010dc:	e9 11 fe ff ff       	jmp    800ef2 <devfile_read+0x61>
+  assert(r <= n);
+  8010e1:	68 59 2f 80 00       	push   $0x802f59
+  8010e6:	68 60 2f 80 00       	push   $0x802f60
+  8010eb:	68 1c 01 00 00       	push   $0x11c
+  8010f0:	68 4e 2f 80 00       	push   $0x802f4e
+  8010f5:	e8 97 0f 00 00       	call   802091 <_panic>
+  assert(r <= PGSIZE);
+  8010fa:	68 75 2f 80 00       	push   $0x802f75
+  8010ff:	68 60 2f 80 00       	push   $0x802f60
+  801104:	68 1d 01 00 00       	push   $0x11d
+  801109:	68 4e 2f 80 00       	push   $0x802f4e
+  80110e:	e8 7e 0f 00 00       	call   802091 <_panic>
+
+00801113 <devfile_write>:
+{
+  801113:	55                   	push   %ebp
+  801114:	89 e5                	mov    %esp,%ebp
+  801116:	57                   	push   %edi
+  801117:	56                   	push   %esi
+  801118:	53                   	push   %ebx
+  801119:	83 ec 1c             	sub    $0x1c,%esp
+  80111c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80111f:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  801122:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  801127:	77 39                	ja     801162 <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801129:	8b 56 0c             	mov    0xc(%esi),%edx
+  80112c:	89 15 00 60 80 00    	mov    %edx,0x806000
+  fsipcbuf.write.req_n = n;
+  801132:	a3 04 60 80 00       	mov    %eax,0x806004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  801137:	83 ec 04             	sub    $0x4,%esp
+  80113a:	50                   	push   %eax
+  80113b:	ff 75 0c             	push   0xc(%ebp)
+  80113e:	68 08 60 80 00       	push   $0x806008
+  801143:	e8 98 17 00 00       	call   8028e0 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801148:	ba 00 00 00 00       	mov    $0x0,%edx
+  80114d:	b8 04 00 00 00       	mov    $0x4,%eax
+  801152:	e8 e7 fb ff ff       	call   800d3e <fsipc>
+  801157:	83 c4 10             	add    $0x10,%esp
+}
+  80115a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80115d:	5b                   	pop    %ebx
+  80115e:	5e                   	pop    %esi
+  80115f:	5f                   	pop    %edi
+  801160:	5d                   	pop    %ebp
+  801161:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  801162:	ba 00 00 10 00       	mov    $0x100000,%edx
+  801167:	39 d0                	cmp    %edx,%eax
+  801169:	89 d3                	mov    %edx,%ebx
+  80116b:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  80116e:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  801174:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  801177:	83 c7 01             	add    $0x1,%edi
+  80117a:	89 f8                	mov    %edi,%eax
+  80117c:	e8 94 fc ff ff       	call   800e15 <fsv_alloc>
+  801181:	85 c0                	test   %eax,%eax
+  801183:	78 d5                	js     80115a <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  801185:	83 ec 04             	sub    $0x4,%esp
+  801188:	53                   	push   %ebx
+  801189:	ff 75 0c             	push   0xc(%ebp)
+  80118c:	68 00 10 c0 9f       	push   $0x9fc01000
+  801191:	e8 4a 17 00 00       	call   8028e0 <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  801196:	8b 46 0c             	mov    0xc(%esi),%eax
+  801199:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  80119e:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  8011a4:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  8011ab:	89 f9                	mov    %edi,%ecx
+  8011ad:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  8011b2:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011b7:	e8 69 fa ff ff       	call   800c25 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  8011bc:	6a 00                	push   $0x0
+  8011be:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8011c1:	50                   	push   %eax
+  8011c2:	6a 00                	push   $0x0
+  8011c4:	6a 00                	push   $0x0
+  8011c6:	e8 bf 18 00 00       	call   802a8a <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  8011cb:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  8011ce:	eb 8a                	jmp    80115a <devfile_write+0x47>
+
+008011d0 <open>:
+{
+  8011d0:	55                   	push   %ebp
+  8011d1:	89 e5                	mov    %esp,%ebp
+  8011d3:	56                   	push   %esi
+  8011d4:	53                   	push   %ebx
+  8011d5:	83 ec 1c             	sub    $0x1c,%esp
+  8011d8:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  8011db:	56                   	push   %esi
+  8011dc:	e8 3e 15 00 00       	call   80271f <strlen>
+  8011e1:	83 c4 10             	add    $0x10,%esp
+  8011e4:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8011e9:	7f 6c                	jg     801257 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  8011eb:	83 ec 0c             	sub    $0xc,%esp
+  8011ee:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8011f1:	50                   	push   %eax
+  8011f2:	e8 ad f4 ff ff       	call   8006a4 <fd_alloc>
+  8011f7:	89 c3                	mov    %eax,%ebx
+  8011f9:	83 c4 10             	add    $0x10,%esp
+  8011fc:	85 c0                	test   %eax,%eax
+  8011fe:	78 3c                	js     80123c <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801200:	83 ec 08             	sub    $0x8,%esp
+  801203:	56                   	push   %esi
+  801204:	68 00 60 80 00       	push   $0x806000
+  801209:	e8 4c 15 00 00       	call   80275a <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  80120e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801211:	a3 00 64 80 00       	mov    %eax,0x806400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801216:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801219:	b8 01 00 00 00       	mov    $0x1,%eax
+  80121e:	e8 1b fb ff ff       	call   800d3e <fsipc>
+  801223:	89 c3                	mov    %eax,%ebx
+  801225:	83 c4 10             	add    $0x10,%esp
+  801228:	85 c0                	test   %eax,%eax
+  80122a:	78 19                	js     801245 <open+0x75>
+  return fd2num(fd);
+  80122c:	83 ec 0c             	sub    $0xc,%esp
+  80122f:	ff 75 f4             	push   -0xc(%ebp)
+  801232:	e8 49 f4 ff ff       	call   800680 <fd2num>
+  801237:	89 c3                	mov    %eax,%ebx
+  801239:	83 c4 10             	add    $0x10,%esp
+}
+  80123c:	89 d8                	mov    %ebx,%eax
+  80123e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801241:	5b                   	pop    %ebx
+  801242:	5e                   	pop    %esi
+  801243:	5d                   	pop    %ebp
+  801244:	c3                   	ret
+    fd_close(fd, 0);
+  801245:	83 ec 08             	sub    $0x8,%esp
+  801248:	6a 00                	push   $0x0
+  80124a:	ff 75 f4             	push   -0xc(%ebp)
+  80124d:	e8 44 f5 ff ff       	call   800796 <fd_close>
+    return r;
+  801252:	83 c4 10             	add    $0x10,%esp
+  801255:	eb e5                	jmp    80123c <open+0x6c>
+    return -E_BAD_PATH;
+  801257:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80125c:	eb de                	jmp    80123c <open+0x6c>
+
+0080125e <open_read>:
+{
+  80125e:	55                   	push   %ebp
+  80125f:	89 e5                	mov    %esp,%ebp
+  801261:	57                   	push   %edi
+  801262:	56                   	push   %esi
+  801263:	53                   	push   %ebx
+  801264:	83 ec 28             	sub    $0x28,%esp
+  801267:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  80126a:	57                   	push   %edi
+  80126b:	e8 af 14 00 00       	call   80271f <strlen>
+  801270:	83 c4 10             	add    $0x10,%esp
+  801273:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801278:	0f 87 f6 00 00 00    	ja     801374 <open_read+0x116>
+  80127e:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  801280:	83 ec 0c             	sub    $0xc,%esp
+  801283:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801286:	50                   	push   %eax
+  801287:	e8 18 f4 ff ff       	call   8006a4 <fd_alloc>
+  80128c:	89 c3                	mov    %eax,%ebx
+  80128e:	83 c4 10             	add    $0x10,%esp
+  801291:	85 c0                	test   %eax,%eax
+  801293:	0f 88 b2 00 00 00    	js     80134b <open_read+0xed>
+  strcpy(req->req_buf, path);
+  801299:	83 ec 08             	sub    $0x8,%esp
+  80129c:	57                   	push   %edi
+  80129d:	68 e4 60 80 00       	push   $0x8060e4
+  8012a2:	e8 b3 14 00 00       	call   80275a <strcpy>
+  req->req_nops = 2;
+  8012a7:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  8012ae:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  8012b1:	c7 05 04 60 80 00 01 	movl   $0x1,0x806004
+  8012b8:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  8012bb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8012be:	a3 10 60 80 00       	mov    %eax,0x806010
+  req->req_ops[0].op_buf = 0;
+  8012c3:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  8012ca:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  8012cd:	c7 05 20 60 80 00 04 	movl   $0x4,0x806020
+  8012d4:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  8012d7:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  8012de:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  8012e1:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  8012e6:	29 f0                	sub    %esi,%eax
+  8012e8:	3b 45 14             	cmp    0x14(%ebp),%eax
+  8012eb:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  8012ef:	a3 2c 60 80 00       	mov    %eax,0x80602c
+  req->req_ops[1].op_offset = 0;
+  8012f4:	c7 05 30 60 80 00 00 	movl   $0x0,0x806030
+  8012fb:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  8012fe:	83 c6 01             	add    $0x1,%esi
+  801301:	89 35 34 60 80 00    	mov    %esi,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  801307:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80130a:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80130f:	e8 2a fa ff ff       	call   800d3e <fsipc>
+  801314:	89 c3                	mov    %eax,%ebx
+  801316:	83 c4 10             	add    $0x10,%esp
+  801319:	83 f8 01             	cmp    $0x1,%eax
+  80131c:	7e 37                	jle    801355 <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  80131e:	a1 38 60 80 00       	mov    0x806038,%eax
+  801323:	8b 55 18             	mov    0x18(%ebp),%edx
+  801326:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  801328:	83 ec 04             	sub    $0x4,%esp
+  80132b:	50                   	push   %eax
+  80132c:	81 c6 e4 60 80 00    	add    $0x8060e4,%esi
+  801332:	56                   	push   %esi
+  801333:	ff 75 10             	push   0x10(%ebp)
+  801336:	e8 a5 15 00 00       	call   8028e0 <memmove>
+  return fd2num(fd);
+  80133b:	83 c4 04             	add    $0x4,%esp
+  80133e:	ff 75 e4             	push   -0x1c(%ebp)
+  801341:	e8 3a f3 ff ff       	call   800680 <fd2num>
+  801346:	89 c3                	mov    %eax,%ebx
+  801348:	83 c4 10             	add    $0x10,%esp
+}
+  80134b:	89 d8                	mov    %ebx,%eax
+  80134d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801350:	5b                   	pop    %ebx
+  801351:	5e                   	pop    %esi
+  801352:	5f                   	pop    %edi
+  801353:	5d                   	pop    %ebp
+  801354:	c3                   	ret
+    fd_close(fd, 0);
+  801355:	83 ec 08             	sub    $0x8,%esp
+  801358:	6a 00                	push   $0x0
+  80135a:	ff 75 e4             	push   -0x1c(%ebp)
+  80135d:	e8 34 f4 ff ff       	call   800796 <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  801362:	83 c4 10             	add    $0x10,%esp
+  801365:	85 db                	test   %ebx,%ebx
+  801367:	78 e2                	js     80134b <open_read+0xed>
+  801369:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  80136c:	8b 9b 1c 60 80 00    	mov    0x80601c(%ebx),%ebx
+  801372:	eb d7                	jmp    80134b <open_read+0xed>
+    return -E_BAD_PATH;
+  801374:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801379:	eb d0                	jmp    80134b <open_read+0xed>
+
+0080137b <file_stat>:
+{
+  80137b:	55                   	push   %ebp
+  80137c:	89 e5                	mov    %esp,%ebp
+  80137e:	57                   	push   %edi
+  80137f:	56                   	push   %esi
+  801380:	53                   	push   %ebx
+  801381:	83 ec 18             	sub    $0x18,%esp
+  801384:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801387:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  80138a:	57                   	push   %edi
+  80138b:	e8 8f 13 00 00       	call   80271f <strlen>
+  801390:	83 c4 10             	add    $0x10,%esp
+  801393:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801398:	0f 8f c7 00 00 00    	jg     801465 <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  80139e:	83 ec 0c             	sub    $0xc,%esp
+  8013a1:	57                   	push   %edi
+  8013a2:	e8 78 13 00 00       	call   80271f <strlen>
+  8013a7:	8d 58 04             	lea    0x4(%eax),%ebx
+  8013aa:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  8013ad:	83 c4 08             	add    $0x8,%esp
+  8013b0:	57                   	push   %edi
+  8013b1:	68 e4 60 80 00       	push   $0x8060e4
+  8013b6:	e8 9f 13 00 00       	call   80275a <strcpy>
+  req->req_nops = 2;
+  8013bb:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  8013c2:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  8013c5:	c7 05 04 60 80 00 02 	movl   $0x2,0x806004
+  8013cc:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  8013cf:	c7 05 10 60 80 00 00 	movl   $0x0,0x806010
+  8013d6:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  8013d9:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  8013e0:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  8013e3:	c7 05 20 60 80 00 03 	movl   $0x3,0x806020
+  8013ea:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  8013ed:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  8013f4:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  8013f7:	89 1d 34 60 80 00    	mov    %ebx,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  8013fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  801402:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801407:	e8 32 f9 ff ff       	call   800d3e <fsipc>
+  80140c:	83 c4 10             	add    $0x10,%esp
+  80140f:	83 f8 01             	cmp    $0x1,%eax
+  801412:	7e 42                	jle    801456 <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  801414:	81 c3 e4 60 80 00    	add    $0x8060e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  80141a:	83 ec 08             	sub    $0x8,%esp
+  80141d:	53                   	push   %ebx
+  80141e:	56                   	push   %esi
+  80141f:	e8 36 13 00 00       	call   80275a <strcpy>
+  st->st_size = ret->ret_size;
+  801424:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  80142a:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  801430:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  801436:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  80143c:	c7 86 88 00 00 00 04 	movl   $0x804004,0x88(%esi)
+  801443:	40 80 00 
+  return 0;
+  801446:	83 c4 10             	add    $0x10,%esp
+  801449:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80144e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801451:	5b                   	pop    %ebx
+  801452:	5e                   	pop    %esi
+  801453:	5f                   	pop    %edi
+  801454:	5d                   	pop    %ebp
+  801455:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  801456:	85 c0                	test   %eax,%eax
+  801458:	78 f4                	js     80144e <file_stat+0xd3>
+  80145a:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80145d:	8b 80 1c 60 80 00    	mov    0x80601c(%eax),%eax
+  801463:	eb e9                	jmp    80144e <file_stat+0xd3>
+    return -E_BAD_PATH;
+  801465:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  80146a:	eb e2                	jmp    80144e <file_stat+0xd3>
+
+0080146c <read_map>:
+{
+  80146c:	55                   	push   %ebp
+  80146d:	89 e5                	mov    %esp,%ebp
+  80146f:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801472:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801475:	50                   	push   %eax
+  801476:	ff 75 08             	push   0x8(%ebp)
+  801479:	e8 7c f2 ff ff       	call   8006fa <fd_lookup>
+  80147e:	83 c4 10             	add    $0x10,%esp
+  801481:	85 c0                	test   %eax,%eax
+  801483:	78 2a                	js     8014af <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  801485:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801488:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  80148e:	39 08                	cmp    %ecx,(%eax)
+  801490:	75 1f                	jne    8014b1 <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  801492:	8b 40 0c             	mov    0xc(%eax),%eax
+  801495:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read_map.req_offset = offset;
+  80149a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80149d:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  8014a2:	8b 55 10             	mov    0x10(%ebp),%edx
+  8014a5:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8014aa:	e8 8f f8 ff ff       	call   800d3e <fsipc>
+}
+  8014af:	c9                   	leave
+  8014b0:	c3                   	ret
+    return -E_INVAL;
+  8014b1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014b6:	eb f7                	jmp    8014af <read_map+0x43>
+
+008014b8 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8014b8:	55                   	push   %ebp
+  8014b9:	89 e5                	mov    %esp,%ebp
+  8014bb:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  8014be:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014c3:	b8 08 00 00 00       	mov    $0x8,%eax
+  8014c8:	e8 71 f8 ff ff       	call   800d3e <fsipc>
+}
+  8014cd:	c9                   	leave
+  8014ce:	c3                   	ret
+
+008014cf <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  8014cf:	55                   	push   %ebp
+  8014d0:	89 e5                	mov    %esp,%ebp
+  8014d2:	57                   	push   %edi
+  8014d3:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  8014d4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014d7:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.stats.req_bio_sched = 0;
+  8014dc:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  8014e3:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  8014e6:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  8014ed:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  8014f0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014f5:	b8 09 00 00 00       	mov    $0x9,%eax
+  8014fa:	e8 3f f8 ff ff       	call   800d3e <fsipc>
+  8014ff:	85 c0                	test   %eax,%eax
+  801501:	78 14                	js     801517 <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  801503:	be 00 60 80 00       	mov    $0x806000,%esi
+  801508:	b9 16 00 00 00       	mov    $0x16,%ecx
+  80150d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801510:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  801512:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801517:	5e                   	pop    %esi
+  801518:	5f                   	pop    %edi
+  801519:	5d                   	pop    %ebp
+  80151a:	c3                   	ret
+
+0080151b <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  80151b:	55                   	push   %ebp
+  80151c:	89 e5                	mov    %esp,%ebp
+  80151e:	53                   	push   %ebx
+  80151f:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  801522:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801525:	50                   	push   %eax
+  801526:	6a 00                	push   $0x0
+  801528:	e8 a2 ff ff ff       	call   8014cf <fs_stats>
+  80152d:	83 c4 10             	add    $0x10,%esp
+  801530:	85 c0                	test   %eax,%eax
+  801532:	78 28                	js     80155c <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  801534:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  801537:	83 ec 08             	sub    $0x8,%esp
+  80153a:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  80153d:	50                   	push   %eax
+  80153e:	6a 20                	push   $0x20
+  801540:	e8 8a ff ff ff       	call   8014cf <fs_stats>
+  801545:	83 c4 10             	add    $0x10,%esp
+  801548:	85 c0                	test   %eax,%eax
+  80154a:	78 10                	js     80155c <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  80154c:	83 ec 08             	sub    $0x8,%esp
+  80154f:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801552:	50                   	push   %eax
+  801553:	53                   	push   %ebx
+  801554:	e8 76 ff ff ff       	call   8014cf <fs_stats>
+  801559:	83 c4 10             	add    $0x10,%esp
+}
+  80155c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80155f:	c9                   	leave
+  801560:	c3                   	ret
+
+00801561 <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  801561:	55                   	push   %ebp
+  801562:	89 e5                	mov    %esp,%ebp
+  801564:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  801567:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  80156e:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  801571:	8b 45 08             	mov    0x8(%ebp),%eax
+  801574:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.stats.req_dcache = 0;
+  801579:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  801580:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  801583:	ba 00 00 00 00       	mov    $0x0,%edx
+  801588:	b8 09 00 00 00       	mov    $0x9,%eax
+  80158d:	e8 ac f7 ff ff       	call   800d3e <fsipc>
+}
+  801592:	c9                   	leave
+  801593:	c3                   	ret
+
+00801594 <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  801594:	55                   	push   %ebp
+  801595:	89 e5                	mov    %esp,%ebp
+  801597:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  80159a:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  8015a1:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  8015a4:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  8015ab:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  8015ae:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015b1:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_STATS, NULL);
+  8015b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015bb:	b8 09 00 00 00       	mov    $0x9,%eax
+  8015c0:	e8 79 f7 ff ff       	call   800d3e <fsipc>
+}
+  8015c5:	c9                   	leave
+  8015c6:	c3                   	ret
+
+008015c7 <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  8015c7:	55                   	push   %ebp
+  8015c8:	89 e5                	mov    %esp,%ebp
+  8015ca:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8015cd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015d0:	50                   	push   %eax
+  8015d1:	ff 75 08             	push   0x8(%ebp)
+  8015d4:	e8 21 f1 ff ff       	call   8006fa <fd_lookup>
+  8015d9:	83 c4 10             	add    $0x10,%esp
+  8015dc:	85 c0                	test   %eax,%eax
+  8015de:	78 34                	js     801614 <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  8015e0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015e3:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  8015e9:	39 08                	cmp    %ecx,(%eax)
+  8015eb:	75 29                	jne    801616 <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  8015ed:	8b 40 0c             	mov    0xc(%eax),%eax
+  8015f0:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.fallocate.req_offset = offset;
+  8015f5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8015f8:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.fallocate.req_len = len;
+  8015fd:	8b 45 10             	mov    0x10(%ebp),%eax
+  801600:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  801605:	ba 00 00 00 00       	mov    $0x0,%edx
+  80160a:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80160f:	e8 2a f7 ff ff       	call   800d3e <fsipc>
+}
+  801614:	c9                   	leave
+  801615:	c3                   	ret
+    return -E_INVAL;
+  801616:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80161b:	eb f7                	jmp    801614 <fallocate+0x4d>
+
+0080161d <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  80161d:	55                   	push   %ebp
+  80161e:	89 e5                	mov    %esp,%ebp
+  801620:	57                   	push   %edi
+  801621:	56                   	push   %esi
+  801622:	53                   	push   %ebx
+  801623:	83 ec 24             	sub    $0x24,%esp
+  801626:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801629:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80162c:	50                   	push   %eax
+  80162d:	ff 75 08             	push   0x8(%ebp)
+  801630:	e8 c5 f0 ff ff       	call   8006fa <fd_lookup>
+  801635:	83 c4 10             	add    $0x10,%esp
+  801638:	85 c0                	test   %eax,%eax
+  80163a:	78 66                	js     8016a2 <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  80163c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80163f:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  801645:	39 08                	cmp    %ecx,(%eax)
+  801647:	75 61                	jne    8016aa <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  801649:	85 f6                	test   %esi,%esi
+  80164b:	7e 50                	jle    80169d <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  80164d:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  801652:	39 de                	cmp    %ebx,%esi
+  801654:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  801657:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80165a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80165d:	a3 00 60 80 00       	mov    %eax,0x806000
+    fsipcbuf.prefetch.req_n = m;
+  801662:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  801668:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  80166f:	83 ec 04             	sub    $0x4,%esp
+  801672:	57                   	push   %edi
+  801673:	ff 75 0c             	push   0xc(%ebp)
+  801676:	68 08 60 80 00       	push   $0x806008
+  80167b:	e8 60 12 00 00       	call   8028e0 <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  801680:	ba 00 00 00 00       	mov    $0x0,%edx
+  801685:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80168a:	e8 af f6 ff ff       	call   800d3e <fsipc>
+  80168f:	83 c4 10             	add    $0x10,%esp
+  801692:	85 c0                	test   %eax,%eax
+  801694:	78 0c                	js     8016a2 <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  801696:	01 7d 0c             	add    %edi,0xc(%ebp)
+  801699:	29 de                	sub    %ebx,%esi
+  80169b:	eb ac                	jmp    801649 <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  80169d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8016a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016a5:	5b                   	pop    %ebx
+  8016a6:	5e                   	pop    %esi
+  8016a7:	5f                   	pop    %edi
+  8016a8:	5d                   	pop    %ebp
+  8016a9:	c3                   	ret
+    return -E_INVAL;
+  8016aa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016af:	eb f1                	jmp    8016a2 <prefetch+0x85>
+
+008016b1 <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  8016b1:	55                   	push   %ebp
+  8016b2:	89 e5                	mov    %esp,%ebp
+  8016b4:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  8016b7:	50                   	push   %eax
+  8016b8:	e8 d3 ef ff ff       	call   800690 <fd2data>
+  8016bd:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  8016c2:	c9                   	leave
+  8016c3:	c3                   	ret
+
+008016c4 <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8016c4:	55                   	push   %ebp
+  8016c5:	89 e5                	mov    %esp,%ebp
+  8016c7:	56                   	push   %esi
+  8016c8:	53                   	push   %ebx
+  8016c9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  8016cc:	83 ec 0c             	sub    $0xc,%esp
+  8016cf:	ff 75 08             	push   0x8(%ebp)
+  8016d2:	e8 b9 ef ff ff       	call   800690 <fd2data>
+  8016d7:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  8016d9:	83 c4 08             	add    $0x8,%esp
+  8016dc:	68 b0 2f 80 00       	push   $0x802fb0
+  8016e1:	53                   	push   %ebx
+  8016e2:	e8 73 10 00 00       	call   80275a <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  8016e7:	8b 46 04             	mov    0x4(%esi),%eax
+  8016ea:	2b 06                	sub    (%esi),%eax
+  8016ec:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  8016f2:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8016f9:	00 00 00 
+  stat->st_dev = &devpipe;
+  8016fc:	c7 83 88 00 00 00 20 	movl   $0x804020,0x88(%ebx)
+  801703:	40 80 00 
+  return 0;
+}
+  801706:	b8 00 00 00 00       	mov    $0x0,%eax
+  80170b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80170e:	5b                   	pop    %ebx
+  80170f:	5e                   	pop    %esi
+  801710:	5d                   	pop    %ebp
+  801711:	c3                   	ret
+
+00801712 <pipe_wakeup>:
+{
+  801712:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  801714:	b8 00 00 00 00       	mov    $0x0,%eax
+  801719:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  80171c:	85 c0                	test   %eax,%eax
+  80171e:	75 01                	jne    801721 <pipe_wakeup+0xf>
+  801720:	c3                   	ret
+{
+  801721:	55                   	push   %ebp
+  801722:	89 e5                	mov    %esp,%ebp
+  801724:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  801727:	6a 00                	push   $0x0
+  801729:	68 00 00 c0 ee       	push   $0xeec00000
+  80172e:	52                   	push   %edx
+  80172f:	e8 f9 ed ff ff       	call   80052d <sys_chan_wakeup>
+  801734:	83 c4 10             	add    $0x10,%esp
+}
+  801737:	c9                   	leave
+  801738:	c3                   	ret
+
+00801739 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801739:	55                   	push   %ebp
+  80173a:	89 e5                	mov    %esp,%ebp
+  80173c:	57                   	push   %edi
+  80173d:	56                   	push   %esi
+  80173e:	53                   	push   %ebx
+  80173f:	83 ec 18             	sub    $0x18,%esp
+  801742:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  801745:	57                   	push   %edi
+  801746:	e8 45 ef ff ff       	call   800690 <fd2data>
+  80174b:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  80174d:	83 c4 10             	add    $0x10,%esp
+  801750:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  801754:	74 2a                	je     801780 <devpipe_close+0x47>
+  801756:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  80175b:	89 f8                	mov    %edi,%eax
+  80175d:	e8 4f ff ff ff       	call   8016b1 <pipe_ring>
+  801762:	83 ec 08             	sub    $0x8,%esp
+  801765:	01 d8                	add    %ebx,%eax
+  801767:	50                   	push   %eax
+  801768:	6a 00                	push   $0x0
+  80176a:	e8 e7 ea ff ff       	call   800256 <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  80176f:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801775:	83 c4 10             	add    $0x10,%esp
+  801778:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  80177e:	75 db                	jne    80175b <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  801780:	83 ec 08             	sub    $0x8,%esp
+  801783:	57                   	push   %edi
+  801784:	6a 00                	push   $0x0
+  801786:	e8 cb ea ff ff       	call   800256 <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  80178b:	83 c4 10             	add    $0x10,%esp
+  80178e:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  801792:	75 13                	jne    8017a7 <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  801794:	83 ec 08             	sub    $0x8,%esp
+  801797:	56                   	push   %esi
+  801798:	6a 00                	push   $0x0
+  80179a:	e8 b7 ea ff ff       	call   800256 <sys_page_unmap>
+}
+  80179f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017a2:	5b                   	pop    %ebx
+  8017a3:	5e                   	pop    %esi
+  8017a4:	5f                   	pop    %edi
+  8017a5:	5d                   	pop    %ebp
+  8017a6:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  8017a7:	8d 56 04             	lea    0x4(%esi),%edx
+  8017aa:	8d 46 2c             	lea    0x2c(%esi),%eax
+  8017ad:	e8 60 ff ff ff       	call   801712 <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8017b2:	8d 46 30             	lea    0x30(%esi),%eax
+  8017b5:	89 f2                	mov    %esi,%edx
+  8017b7:	e8 56 ff ff ff       	call   801712 <pipe_wakeup>
+  8017bc:	eb d6                	jmp    801794 <devpipe_close+0x5b>
+
+008017be <_pipeisclosed>:
+{
+  8017be:	55                   	push   %ebp
+  8017bf:	89 e5                	mov    %esp,%ebp
+  8017c1:	57                   	push   %edi
+  8017c2:	56                   	push   %esi
+  8017c3:	53                   	push   %ebx
+  8017c4:	83 ec 1c             	sub    $0x1c,%esp
+  8017c7:	89 c7                	mov    %eax,%edi
+  8017c9:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  8017cb:	a1 44 57 80 00       	mov    0x805744,%eax
+  8017d0:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  8017d3:	83 ec 0c             	sub    $0xc,%esp
+  8017d6:	57                   	push   %edi
+  8017d7:	e8 11 14 00 00       	call   802bed <pageref>
+  8017dc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8017df:	89 34 24             	mov    %esi,(%esp)
+  8017e2:	e8 06 14 00 00       	call   802bed <pageref>
+    nn = thisenv->env_runs;
+  8017e7:	8b 15 44 57 80 00    	mov    0x805744,%edx
+  8017ed:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  8017f0:	83 c4 10             	add    $0x10,%esp
+  8017f3:	39 cb                	cmp    %ecx,%ebx
+  8017f5:	74 1b                	je     801812 <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  8017f7:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8017fa:	75 cf                	jne    8017cb <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8017fc:	8b 42 58             	mov    0x58(%edx),%eax
+  8017ff:	6a 01                	push   $0x1
+  801801:	50                   	push   %eax
+  801802:	53                   	push   %ebx
+  801803:	68 b7 2f 80 00       	push   $0x802fb7
+  801808:	e8 5f 09 00 00       	call   80216c <cprintf>
+  80180d:	83 c4 10             	add    $0x10,%esp
+  801810:	eb b9                	jmp    8017cb <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  801812:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  801815:	0f 94 c0             	sete   %al
+  801818:	0f b6 c0             	movzbl %al,%eax
+}
+  80181b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80181e:	5b                   	pop    %ebx
+  80181f:	5e                   	pop    %esi
+  801820:	5f                   	pop    %edi
+  801821:	5d                   	pop    %ebp
+  801822:	c3                   	ret
+
+00801823 <devpipe_write_bulk>:
+{
+  801823:	55                   	push   %ebp
+  801824:	89 e5                	mov    %esp,%ebp
+  801826:	57                   	push   %edi
+  801827:	56                   	push   %esi
+  801828:	53                   	push   %ebx
+  801829:	83 ec 1c             	sub    $0x1c,%esp
+  80182c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80182f:	89 d6                	mov    %edx,%esi
+  801831:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  801834:	e8 78 fe ff ff       	call   8016b1 <pipe_ring>
+  801839:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  80183c:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  801841:	8d 46 04             	lea    0x4(%esi),%eax
+  801844:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  801847:	eb 75                	jmp    8018be <devpipe_write_bulk+0x9b>
+  801849:	b8 01 00 00 00       	mov    $0x1,%eax
+  80184e:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  801852:	6a 64                	push   $0x64
+  801854:	68 00 00 c0 ee       	push   $0xeec00000
+  801859:	53                   	push   %ebx
+  80185a:	56                   	push   %esi
+  80185b:	e8 aa ec ff ff       	call   80050a <sys_chan_sleep>
+      continue;
+  801860:	83 c4 10             	add    $0x10,%esp
+  801863:	eb 59                	jmp    8018be <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  801865:	89 d1                	mov    %edx,%ecx
+  801867:	c1 f9 1f             	sar    $0x1f,%ecx
+  80186a:	c1 e9 11             	shr    $0x11,%ecx
+  80186d:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  801870:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  801875:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  801877:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  80187d:	29 d3                	sub    %edx,%ebx
+  80187f:	ba 00 80 00 00       	mov    $0x8000,%edx
+  801884:	29 c2                	sub    %eax,%edx
+  801886:	39 d3                	cmp    %edx,%ebx
+  801888:	0f 47 da             	cmova  %edx,%ebx
+  80188b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80188e:	29 fa                	sub    %edi,%edx
+  801890:	39 d3                	cmp    %edx,%ebx
+  801892:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  801895:	83 ec 04             	sub    $0x4,%esp
+  801898:	53                   	push   %ebx
+  801899:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80189c:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  80189f:	52                   	push   %edx
+  8018a0:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8018a3:	01 c8                	add    %ecx,%eax
+  8018a5:	50                   	push   %eax
+  8018a6:	e8 97 10 00 00       	call   802942 <memcpy>
+    i += m;
+  8018ab:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  8018ad:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  8018b0:	8d 46 2c             	lea    0x2c(%esi),%eax
+  8018b3:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8018b6:	e8 57 fe ff ff       	call   801712 <pipe_wakeup>
+  8018bb:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  8018be:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  8018c1:	73 2b                	jae    8018ee <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  8018c3:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  8018c5:	8b 56 04             	mov    0x4(%esi),%edx
+  8018c8:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  8018ce:	39 d0                	cmp    %edx,%eax
+  8018d0:	7d 93                	jge    801865 <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  8018d2:	89 f2                	mov    %esi,%edx
+  8018d4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8018d7:	e8 e2 fe ff ff       	call   8017be <_pipeisclosed>
+  8018dc:	85 c0                	test   %eax,%eax
+  8018de:	0f 84 65 ff ff ff    	je     801849 <devpipe_write_bulk+0x26>
+        return i;
+  8018e4:	89 f8                	mov    %edi,%eax
+}
+  8018e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018e9:	5b                   	pop    %ebx
+  8018ea:	5e                   	pop    %esi
+  8018eb:	5f                   	pop    %edi
+  8018ec:	5d                   	pop    %ebp
+  8018ed:	c3                   	ret
+  return i;
+  8018ee:	89 f8                	mov    %edi,%eax
+  8018f0:	eb f4                	jmp    8018e6 <devpipe_write_bulk+0xc3>
+
+008018f2 <devpipe_write>:
+{
+  8018f2:	55                   	push   %ebp
+  8018f3:	89 e5                	mov    %esp,%ebp
+  8018f5:	57                   	push   %edi
+  8018f6:	56                   	push   %esi
+  8018f7:	53                   	push   %ebx
+  8018f8:	83 ec 28             	sub    $0x28,%esp
+  8018fb:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  8018fe:	56                   	push   %esi
+  8018ff:	e8 8c ed ff ff       	call   800690 <fd2data>
+  801904:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  801906:	8b 78 28             	mov    0x28(%eax),%edi
+  801909:	83 c4 10             	add    $0x10,%esp
+  80190c:	85 ff                	test   %edi,%edi
+  80190e:	75 25                	jne    801935 <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  801910:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801913:	74 66                	je     80197b <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  801915:	8b 43 04             	mov    0x4(%ebx),%eax
+  801918:	8b 0b                	mov    (%ebx),%ecx
+  80191a:	8d 51 20             	lea    0x20(%ecx),%edx
+  80191d:	39 d0                	cmp    %edx,%eax
+  80191f:	72 2b                	jb     80194c <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  801921:	89 da                	mov    %ebx,%edx
+  801923:	89 f0                	mov    %esi,%eax
+  801925:	e8 94 fe ff ff       	call   8017be <_pipeisclosed>
+  80192a:	85 c0                	test   %eax,%eax
+  80192c:	75 51                	jne    80197f <devpipe_write+0x8d>
+      sys_yield();
+  80192e:	e8 3c e8 ff ff       	call   80016f <sys_yield>
+  801933:	eb e0                	jmp    801915 <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  801935:	83 ec 0c             	sub    $0xc,%esp
+  801938:	ff 75 10             	push   0x10(%ebp)
+  80193b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80193e:	89 c2                	mov    %eax,%edx
+  801940:	89 f0                	mov    %esi,%eax
+  801942:	e8 dc fe ff ff       	call   801823 <devpipe_write_bulk>
+  801947:	83 c4 10             	add    $0x10,%esp
+  80194a:	eb 38                	jmp    801984 <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80194c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80194f:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801953:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  801956:	89 c2                	mov    %eax,%edx
+  801958:	c1 fa 1f             	sar    $0x1f,%edx
+  80195b:	89 d1                	mov    %edx,%ecx
+  80195d:	c1 e9 1b             	shr    $0x1b,%ecx
+  801960:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801963:	83 e2 1f             	and    $0x1f,%edx
+  801966:	29 ca                	sub    %ecx,%edx
+  801968:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  80196c:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  801970:	83 c0 01             	add    $0x1,%eax
+  801973:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  801976:	83 c7 01             	add    $0x1,%edi
+  801979:	eb 95                	jmp    801910 <devpipe_write+0x1e>
+  return i;
+  80197b:	89 f8                	mov    %edi,%eax
+  80197d:	eb 05                	jmp    801984 <devpipe_write+0x92>
+        return 0;
+  80197f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801984:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801987:	5b                   	pop    %ebx
+  801988:	5e                   	pop    %esi
+  801989:	5f                   	pop    %edi
+  80198a:	5d                   	pop    %ebp
+  80198b:	c3                   	ret
+
+0080198c <devpipe_read_bulk>:
+{
+  80198c:	55                   	push   %ebp
+  80198d:	89 e5                	mov    %esp,%ebp
+  80198f:	57                   	push   %edi
+  801990:	56                   	push   %esi
+  801991:	53                   	push   %ebx
+  801992:	83 ec 2c             	sub    $0x2c,%esp
+  801995:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801998:	89 d6                	mov    %edx,%esi
+  80199a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80199d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  8019a0:	e8 0c fd ff ff       	call   8016b1 <pipe_ring>
+  8019a5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  8019a8:	85 db                	test   %ebx,%ebx
+  8019aa:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8019af:	0f 45 c3             	cmovne %ebx,%eax
+  8019b2:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8019b5:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8019ba:	8d 46 30             	lea    0x30(%esi),%eax
+  8019bd:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  8019c0:	eb 50                	jmp    801a12 <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  8019c2:	89 d1                	mov    %edx,%ecx
+  8019c4:	c1 f9 1f             	sar    $0x1f,%ecx
+  8019c7:	c1 e9 11             	shr    $0x11,%ecx
+  8019ca:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  8019cd:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8019d2:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  8019d4:	29 d3                	sub    %edx,%ebx
+  8019d6:	ba 00 80 00 00       	mov    $0x8000,%edx
+  8019db:	29 c2                	sub    %eax,%edx
+  8019dd:	39 d3                	cmp    %edx,%ebx
+  8019df:	0f 47 da             	cmova  %edx,%ebx
+  8019e2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019e5:	29 fa                	sub    %edi,%edx
+  8019e7:	39 d3                	cmp    %edx,%ebx
+  8019e9:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  8019ec:	83 ec 04             	sub    $0x4,%esp
+  8019ef:	53                   	push   %ebx
+  8019f0:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8019f3:	01 c8                	add    %ecx,%eax
+  8019f5:	50                   	push   %eax
+  8019f6:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8019f9:	01 f8                	add    %edi,%eax
+  8019fb:	50                   	push   %eax
+  8019fc:	e8 41 0f 00 00       	call   802942 <memcpy>
+    i += m;
+  801a01:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  801a03:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  801a05:	89 f2                	mov    %esi,%edx
+  801a07:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  801a0a:	e8 03 fd ff ff       	call   801712 <pipe_wakeup>
+  801a0f:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  801a12:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  801a15:	73 51                	jae    801a68 <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  801a17:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  801a1a:	8b 16                	mov    (%esi),%edx
+  801a1c:	39 da                	cmp    %ebx,%edx
+  801a1e:	75 a2                	jne    8019c2 <devpipe_read_bulk+0x36>
+      if (i > 0)
+  801a20:	85 ff                	test   %edi,%edi
+  801a22:	75 44                	jne    801a68 <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  801a24:	89 f2                	mov    %esi,%edx
+  801a26:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801a29:	e8 90 fd ff ff       	call   8017be <_pipeisclosed>
+  801a2e:	85 c0                	test   %eax,%eax
+  801a30:	75 3a                	jne    801a6c <devpipe_read_bulk+0xe0>
+  801a32:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a37:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  801a3b:	6a 64                	push   $0x64
+  801a3d:	ff 75 d4             	push   -0x2c(%ebp)
+  801a40:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  801a41:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  801a44:	50                   	push   %eax
+  801a45:	e8 c0 ea ff ff       	call   80050a <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  801a4a:	85 c0                	test   %eax,%eax
+  801a4c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a51:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  801a54:	83 c4 10             	add    $0x10,%esp
+  801a57:	a8 01                	test   $0x1,%al
+  801a59:	74 b7                	je     801a12 <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  801a5b:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  801a60:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a63:	5b                   	pop    %ebx
+  801a64:	5e                   	pop    %esi
+  801a65:	5f                   	pop    %edi
+  801a66:	5d                   	pop    %ebp
+  801a67:	c3                   	ret
+  return i;
+  801a68:	89 f8                	mov    %edi,%eax
+  801a6a:	eb f4                	jmp    801a60 <devpipe_read_bulk+0xd4>
+        return 0;
+  801a6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a71:	eb ed                	jmp    801a60 <devpipe_read_bulk+0xd4>
+
+00801a73 <devpipe_read>:
+{
+  801a73:	55                   	push   %ebp
+  801a74:	89 e5                	mov    %esp,%ebp
+  801a76:	57                   	push   %edi
+  801a77:	56                   	push   %esi
+  801a78:	53                   	push   %ebx
+  801a79:	83 ec 18             	sub    $0x18,%esp
+  801a7c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  801a7f:	57                   	push   %edi
+  801a80:	e8 0b ec ff ff       	call   800690 <fd2data>
+  801a85:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  801a87:	8b 70 28             	mov    0x28(%eax),%esi
+  801a8a:	83 c4 10             	add    $0x10,%esp
+  801a8d:	85 f6                	test   %esi,%esi
+  801a8f:	75 24                	jne    801ab5 <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  801a91:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801a94:	74 60                	je     801af6 <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  801a96:	8b 03                	mov    (%ebx),%eax
+  801a98:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801a9b:	75 3b                	jne    801ad8 <devpipe_read+0x65>
+      if (i > 0)
+  801a9d:	85 f6                	test   %esi,%esi
+  801a9f:	75 2d                	jne    801ace <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  801aa1:	89 da                	mov    %ebx,%edx
+  801aa3:	89 f8                	mov    %edi,%eax
+  801aa5:	e8 14 fd ff ff       	call   8017be <_pipeisclosed>
+  801aaa:	85 c0                	test   %eax,%eax
+  801aac:	75 4c                	jne    801afa <devpipe_read+0x87>
+      sys_yield();
+  801aae:	e8 bc e6 ff ff       	call   80016f <sys_yield>
+  801ab3:	eb e1                	jmp    801a96 <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  801ab5:	83 ec 08             	sub    $0x8,%esp
+  801ab8:	6a 00                	push   $0x0
+  801aba:	ff 75 10             	push   0x10(%ebp)
+  801abd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ac0:	89 c2                	mov    %eax,%edx
+  801ac2:	89 f8                	mov    %edi,%eax
+  801ac4:	e8 c3 fe ff ff       	call   80198c <devpipe_read_bulk>
+  801ac9:	83 c4 10             	add    $0x10,%esp
+  801acc:	eb 02                	jmp    801ad0 <devpipe_read+0x5d>
+        return i;
+  801ace:	89 f0                	mov    %esi,%eax
+}
+  801ad0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ad3:	5b                   	pop    %ebx
+  801ad4:	5e                   	pop    %esi
+  801ad5:	5f                   	pop    %edi
+  801ad6:	5d                   	pop    %ebp
+  801ad7:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801ad8:	99                   	cltd
+  801ad9:	c1 ea 1b             	shr    $0x1b,%edx
+  801adc:	01 d0                	add    %edx,%eax
+  801ade:	83 e0 1f             	and    $0x1f,%eax
+  801ae1:	29 d0                	sub    %edx,%eax
+  801ae3:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801ae8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801aeb:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  801aee:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  801af1:	83 c6 01             	add    $0x1,%esi
+  801af4:	eb 9b                	jmp    801a91 <devpipe_read+0x1e>
+  return i;
+  801af6:	89 f0                	mov    %esi,%eax
+  801af8:	eb d6                	jmp    801ad0 <devpipe_read+0x5d>
+        return 0;
+  801afa:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aff:	eb cf                	jmp    801ad0 <devpipe_read+0x5d>
+
+00801b01 <pipe2>:
+{
+  801b01:	55                   	push   %ebp
+  801b02:	89 e5                	mov    %esp,%ebp
+  801b04:	57                   	push   %edi
+  801b05:	56                   	push   %esi
+  801b06:	53                   	push   %ebx
+  801b07:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  801b0a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801b0d:	50                   	push   %eax
+  801b0e:	e8 91 eb ff ff       	call   8006a4 <fd_alloc>
+  801b13:	89 c3                	mov    %eax,%ebx
+  801b15:	83 c4 10             	add    $0x10,%esp
+  801b18:	85 c0                	test   %eax,%eax
+  801b1a:	0f 88 fb 01 00 00    	js     801d1b <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801b20:	83 ec 04             	sub    $0x4,%esp
+  801b23:	68 07 04 00 00       	push   $0x407
+  801b28:	ff 75 e4             	push   -0x1c(%ebp)
+  801b2b:	6a 00                	push   $0x0
+  801b2d:	e8 9f e6 ff ff       	call   8001d1 <sys_page_alloc>
+  801b32:	89 c3                	mov    %eax,%ebx
+  801b34:	83 c4 10             	add    $0x10,%esp
+  801b37:	85 c0                	test   %eax,%eax
+  801b39:	0f 88 dc 01 00 00    	js     801d1b <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  801b3f:	83 ec 0c             	sub    $0xc,%esp
+  801b42:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801b45:	50                   	push   %eax
+  801b46:	e8 59 eb ff ff       	call   8006a4 <fd_alloc>
+  801b4b:	89 c3                	mov    %eax,%ebx
+  801b4d:	83 c4 10             	add    $0x10,%esp
+  801b50:	85 c0                	test   %eax,%eax
+  801b52:	0f 88 b3 01 00 00    	js     801d0b <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801b58:	83 ec 04             	sub    $0x4,%esp
+  801b5b:	68 07 04 00 00       	push   $0x407
+  801b60:	ff 75 e0             	push   -0x20(%ebp)
+  801b63:	6a 00                	push   $0x0
+  801b65:	e8 67 e6 ff ff       	call   8001d1 <sys_page_alloc>
+  801b6a:	89 c3                	mov    %eax,%ebx
+  801b6c:	83 c4 10             	add    $0x10,%esp
+  801b6f:	85 c0                	test   %eax,%eax
+  801b71:	0f 88 94 01 00 00    	js     801d0b <pipe2+0x20a>
+  va = fd2data(fd0);
+  801b77:	83 ec 0c             	sub    $0xc,%esp
+  801b7a:	ff 75 e4             	push   -0x1c(%ebp)
+  801b7d:	e8 0e eb ff ff       	call   800690 <fd2data>
+  801b82:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801b84:	83 c4 0c             	add    $0xc,%esp
+  801b87:	68 07 04 00 00       	push   $0x407
+  801b8c:	50                   	push   %eax
+  801b8d:	6a 00                	push   $0x0
+  801b8f:	e8 3d e6 ff ff       	call   8001d1 <sys_page_alloc>
+  801b94:	89 c3                	mov    %eax,%ebx
+  801b96:	83 c4 10             	add    $0x10,%esp
+  801b99:	85 c0                	test   %eax,%eax
+  801b9b:	0f 88 5a 01 00 00    	js     801cfb <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801ba1:	83 ec 0c             	sub    $0xc,%esp
+  801ba4:	ff 75 e0             	push   -0x20(%ebp)
+  801ba7:	e8 e4 ea ff ff       	call   800690 <fd2data>
+  801bac:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  801bb3:	50                   	push   %eax
+  801bb4:	6a 00                	push   $0x0
+  801bb6:	57                   	push   %edi
+  801bb7:	6a 00                	push   $0x0
+  801bb9:	e8 56 e6 ff ff       	call   800214 <sys_page_map>
+  801bbe:	89 c3                	mov    %eax,%ebx
+  801bc0:	83 c4 20             	add    $0x20,%esp
+  801bc3:	85 c0                	test   %eax,%eax
+  801bc5:	0f 88 22 01 00 00    	js     801ced <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  801bcb:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  801bcf:	74 72                	je     801c43 <pipe2+0x142>
+  801bd1:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  801bd6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801bd9:	e8 d3 fa ff ff       	call   8016b1 <pipe_ring>
+  801bde:	83 ec 04             	sub    $0x4,%esp
+  801be1:	68 07 04 00 00       	push   $0x407
+  801be6:	01 f0                	add    %esi,%eax
+  801be8:	50                   	push   %eax
+  801be9:	6a 00                	push   $0x0
+  801beb:	e8 e1 e5 ff ff       	call   8001d1 <sys_page_alloc>
+  801bf0:	89 c3                	mov    %eax,%ebx
+  801bf2:	83 c4 10             	add    $0x10,%esp
+  801bf5:	85 c0                	test   %eax,%eax
+  801bf7:	0f 88 97 00 00 00    	js     801c94 <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  801bfd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801c00:	e8 ac fa ff ff       	call   8016b1 <pipe_ring>
+  801c05:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  801c08:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801c0b:	e8 a1 fa ff ff       	call   8016b1 <pipe_ring>
+  801c10:	83 ec 0c             	sub    $0xc,%esp
+  801c13:	68 07 04 00 00       	push   $0x407
+  801c18:	53                   	push   %ebx
+  801c19:	6a 00                	push   $0x0
+  801c1b:	01 f0                	add    %esi,%eax
+  801c1d:	50                   	push   %eax
+  801c1e:	6a 00                	push   $0x0
+  801c20:	e8 ef e5 ff ff       	call   800214 <sys_page_map>
+  801c25:	89 c3                	mov    %eax,%ebx
+  801c27:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801c2d:	83 c4 20             	add    $0x20,%esp
+  801c30:	85 c0                	test   %eax,%eax
+  801c32:	78 60                	js     801c94 <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  801c34:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  801c3a:	75 9a                	jne    801bd6 <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  801c3c:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  801c43:	a1 20 40 80 00       	mov    0x804020,%eax
+  801c48:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801c4b:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  801c4d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801c50:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  801c57:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801c5a:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  801c5c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801c5f:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  801c66:	83 ec 0c             	sub    $0xc,%esp
+  801c69:	ff 75 e4             	push   -0x1c(%ebp)
+  801c6c:	e8 0f ea ff ff       	call   800680 <fd2num>
+  801c71:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801c74:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  801c76:	83 c4 04             	add    $0x4,%esp
+  801c79:	ff 75 e0             	push   -0x20(%ebp)
+  801c7c:	e8 ff e9 ff ff       	call   800680 <fd2num>
+  801c81:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801c84:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  801c87:	83 c4 10             	add    $0x10,%esp
+  801c8a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c8f:	e9 87 00 00 00       	jmp    801d1b <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  801c94:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  801c99:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801c9c:	e8 10 fa ff ff       	call   8016b1 <pipe_ring>
+  801ca1:	83 ec 08             	sub    $0x8,%esp
+  801ca4:	01 f0                	add    %esi,%eax
+  801ca6:	50                   	push   %eax
+  801ca7:	6a 00                	push   $0x0
+  801ca9:	e8 a8 e5 ff ff       	call   800256 <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  801cae:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801cb1:	e8 fb f9 ff ff       	call   8016b1 <pipe_ring>
+  801cb6:	83 c4 08             	add    $0x8,%esp
+  801cb9:	01 f0                	add    %esi,%eax
+  801cbb:	50                   	push   %eax
+  801cbc:	6a 00                	push   $0x0
+  801cbe:	e8 93 e5 ff ff       	call   800256 <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  801cc3:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801cc9:	83 c4 10             	add    $0x10,%esp
+  801ccc:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  801cd2:	75 c5                	jne    801c99 <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  801cd4:	83 ec 0c             	sub    $0xc,%esp
+  801cd7:	ff 75 e0             	push   -0x20(%ebp)
+  801cda:	e8 b1 e9 ff ff       	call   800690 <fd2data>
+  801cdf:	83 c4 08             	add    $0x8,%esp
+  801ce2:	50                   	push   %eax
+  801ce3:	6a 00                	push   $0x0
+  801ce5:	e8 6c e5 ff ff       	call   800256 <sys_page_unmap>
+  801cea:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  801ced:	83 ec 08             	sub    $0x8,%esp
+  801cf0:	57                   	push   %edi
+  801cf1:	6a 00                	push   $0x0
+  801cf3:	e8 5e e5 ff ff       	call   800256 <sys_page_unmap>
+  801cf8:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  801cfb:	83 ec 08             	sub    $0x8,%esp
+  801cfe:	ff 75 e0             	push   -0x20(%ebp)
+  801d01:	6a 00                	push   $0x0
+  801d03:	e8 4e e5 ff ff       	call   800256 <sys_page_unmap>
+  801d08:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  801d0b:	83 ec 08             	sub    $0x8,%esp
+  801d0e:	ff 75 e4             	push   -0x1c(%ebp)
+  801d11:	6a 00                	push   $0x0
+  801d13:	e8 3e e5 ff ff       	call   800256 <sys_page_unmap>
+  801d18:	83 c4 10             	add    $0x10,%esp
+}
+  801d1b:	89 d8                	mov    %ebx,%eax
+  801d1d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d20:	5b                   	pop    %ebx
+  801d21:	5e                   	pop    %esi
+  801d22:	5f                   	pop    %edi
+  801d23:	5d                   	pop    %ebp
+  801d24:	c3                   	ret
+
+00801d25 <pipe>:
+{
+  801d25:	55                   	push   %ebp
+  801d26:	89 e5                	mov    %esp,%ebp
+  801d28:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  801d2b:	6a 00                	push   $0x0
+  801d2d:	ff 75 08             	push   0x8(%ebp)
+  801d30:	e8 cc fd ff ff       	call   801b01 <pipe2>
+}
+  801d35:	c9                   	leave
+  801d36:	c3                   	ret
+
+00801d37 <pipeisclosed>:
+{
+  801d37:	55                   	push   %ebp
+  801d38:	89 e5                	mov    %esp,%ebp
+  801d3a:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801d3d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d40:	50                   	push   %eax
+  801d41:	ff 75 08             	push   0x8(%ebp)
+  801d44:	e8 b1 e9 ff ff       	call   8006fa <fd_lookup>
+  801d49:	83 c4 10             	add    $0x10,%esp
+  801d4c:	85 c0                	test   %eax,%eax
+  801d4e:	78 18                	js     801d68 <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  801d50:	83 ec 0c             	sub    $0xc,%esp
+  801d53:	ff 75 f4             	push   -0xc(%ebp)
+  801d56:	e8 35 e9 ff ff       	call   800690 <fd2data>
+  801d5b:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  801d5d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d60:	e8 59 fa ff ff       	call   8017be <_pipeisclosed>
+  801d65:	83 c4 10             	add    $0x10,%esp
+}
+  801d68:	c9                   	leave
+  801d69:	c3                   	ret
+
+00801d6a <pipe_splice>:
+{
+  801d6a:	55                   	push   %ebp
+  801d6b:	89 e5                	mov    %esp,%ebp
+  801d6d:	57                   	push   %edi
+  801d6e:	56                   	push   %esi
+  801d6f:	53                   	push   %ebx
+  801d70:	83 ec 34             	sub    $0x34,%esp
+  801d73:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801d76:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801d79:	50                   	push   %eax
+  801d7a:	ff 75 08             	push   0x8(%ebp)
+  801d7d:	e8 78 e9 ff ff       	call   8006fa <fd_lookup>
+  801d82:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801d85:	83 c4 10             	add    $0x10,%esp
+  801d88:	85 c0                	test   %eax,%eax
+  801d8a:	0f 88 d7 00 00 00    	js     801e67 <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  801d90:	83 ec 0c             	sub    $0xc,%esp
+  801d93:	ff 75 e4             	push   -0x1c(%ebp)
+  801d96:	e8 f5 e8 ff ff       	call   800690 <fd2data>
+  801d9b:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  801d9d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801da0:	83 c4 10             	add    $0x10,%esp
+  801da3:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801da9:	39 10                	cmp    %edx,(%eax)
+  801dab:	0f 85 c1 00 00 00    	jne    801e72 <pipe_splice+0x108>
+  801db1:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  801db5:	0f 84 c0 00 00 00    	je     801e7b <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  801dbb:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  801dbf:	0f 84 bf 00 00 00    	je     801e84 <pipe_splice+0x11a>
+  801dc5:	89 f7                	mov    %esi,%edi
+  801dc7:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  801dcd:	0f 85 ba 00 00 00    	jne    801e8d <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  801dd3:	8d 43 04             	lea    0x4(%ebx),%eax
+  801dd6:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801dd9:	eb 38                	jmp    801e13 <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  801ddb:	83 ec 0c             	sub    $0xc,%esp
+  801dde:	68 00 10 00 00       	push   $0x1000
+  801de3:	89 f1                	mov    %esi,%ecx
+  801de5:	89 da                	mov    %ebx,%edx
+  801de7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801dea:	e8 34 fa ff ff       	call   801823 <devpipe_write_bulk>
+  801def:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801df2:	83 c4 10             	add    $0x10,%esp
+  801df5:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801dfa:	75 53                	jne    801e4f <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  801dfc:	83 ec 08             	sub    $0x8,%esp
+  801dff:	56                   	push   %esi
+  801e00:	6a 00                	push   $0x0
+  801e02:	e8 4f e4 ff ff       	call   800256 <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  801e07:	83 c7 01             	add    $0x1,%edi
+  801e0a:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801e10:	83 c4 10             	add    $0x10,%esp
+  801e13:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801e16:	74 3a                	je     801e52 <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  801e18:	8b 03                	mov    (%ebx),%eax
+  801e1a:	39 43 04             	cmp    %eax,0x4(%ebx)
+  801e1d:	75 bc                	jne    801ddb <pipe_splice+0x71>
+  801e1f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e24:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  801e28:	85 c0                	test   %eax,%eax
+  801e2a:	74 af                	je     801ddb <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  801e2c:	83 ec 04             	sub    $0x4,%esp
+  801e2f:	6a 07                	push   $0x7
+  801e31:	56                   	push   %esi
+  801e32:	ff 75 d0             	push   -0x30(%ebp)
+  801e35:	e8 f3 e6 ff ff       	call   80052d <sys_chan_wakeup>
+  801e3a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801e3d:	83 c4 10             	add    $0x10,%esp
+  801e40:	85 c0                	test   %eax,%eax
+  801e42:	79 b8                	jns    801dfc <pipe_splice+0x92>
+  801e44:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e49:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  801e4d:	eb 8c                	jmp    801ddb <pipe_splice+0x71>
+  801e4f:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  801e52:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801e56:	75 06                	jne    801e5e <pipe_splice+0xf4>
+  801e58:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  801e5c:	78 09                	js     801e67 <pipe_splice+0xfd>
+  return i * PGSIZE;
+  801e5e:	8b 45 10             	mov    0x10(%ebp),%eax
+  801e61:	c1 e0 0c             	shl    $0xc,%eax
+  801e64:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  801e67:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801e6a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e6d:	5b                   	pop    %ebx
+  801e6e:	5e                   	pop    %esi
+  801e6f:	5f                   	pop    %edi
+  801e70:	5d                   	pop    %ebp
+  801e71:	c3                   	ret
+    return -E_INVAL;
+  801e72:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  801e79:	eb ec                	jmp    801e67 <pipe_splice+0xfd>
+  801e7b:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  801e82:	eb e3                	jmp    801e67 <pipe_splice+0xfd>
+  801e84:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  801e8b:	eb da                	jmp    801e67 <pipe_splice+0xfd>
+  801e8d:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  801e94:	eb d1                	jmp    801e67 <pipe_splice+0xfd>
+
+00801e96 <pipe_splice_read>:
+{
+  801e96:	55                   	push   %ebp
+  801e97:	89 e5                	mov    %esp,%ebp
+  801e99:	53                   	push   %ebx
+  801e9a:	83 ec 1c             	sub    $0x1c,%esp
+  801e9d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801ea0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ea3:	50                   	push   %eax
+  801ea4:	ff 75 08             	push   0x8(%ebp)
+  801ea7:	e8 4e e8 ff ff       	call   8006fa <fd_lookup>
+  801eac:	83 c4 10             	add    $0x10,%esp
+  801eaf:	85 c0                	test   %eax,%eax
+  801eb1:	78 49                	js     801efc <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  801eb3:	83 ec 0c             	sub    $0xc,%esp
+  801eb6:	ff 75 f4             	push   -0xc(%ebp)
+  801eb9:	e8 d2 e7 ff ff       	call   800690 <fd2data>
+  801ebe:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  801ec0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ec3:	83 c4 10             	add    $0x10,%esp
+  801ec6:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  801ecc:	39 08                	cmp    %ecx,(%eax)
+  801ece:	75 31                	jne    801f01 <pipe_splice_read+0x6b>
+  801ed0:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  801ed4:	74 32                	je     801f08 <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  801ed6:	8b 48 08             	mov    0x8(%eax),%ecx
+  801ed9:	83 e1 03             	and    $0x3,%ecx
+  801edc:	83 f9 01             	cmp    $0x1,%ecx
+  801edf:	74 2e                	je     801f0f <pipe_splice_read+0x79>
+  801ee1:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  801ee7:	75 2d                	jne    801f16 <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  801ee9:	83 ec 08             	sub    $0x8,%esp
+  801eec:	53                   	push   %ebx
+  801eed:	68 00 10 00 00       	push   $0x1000
+  801ef2:	89 d9                	mov    %ebx,%ecx
+  801ef4:	e8 93 fa ff ff       	call   80198c <devpipe_read_bulk>
+  801ef9:	83 c4 10             	add    $0x10,%esp
+}
+  801efc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801eff:	c9                   	leave
+  801f00:	c3                   	ret
+    return -E_INVAL;
+  801f01:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f06:	eb f4                	jmp    801efc <pipe_splice_read+0x66>
+  801f08:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f0d:	eb ed                	jmp    801efc <pipe_splice_read+0x66>
+  801f0f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f14:	eb e6                	jmp    801efc <pipe_splice_read+0x66>
+  801f16:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f1b:	eb df                	jmp    801efc <pipe_splice_read+0x66>
+
+00801f1d <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  801f1d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f22:	c3                   	ret
+
+00801f23 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  801f23:	55                   	push   %ebp
+  801f24:	89 e5                	mov    %esp,%ebp
+  801f26:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  801f29:	68 cf 2f 80 00       	push   $0x802fcf
+  801f2e:	ff 75 0c             	push   0xc(%ebp)
+  801f31:	e8 24 08 00 00       	call   80275a <strcpy>
+  return 0;
+}
+  801f36:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f3b:	c9                   	leave
+  801f3c:	c3                   	ret
+
+00801f3d <devcons_write>:
+{
+  801f3d:	55                   	push   %ebp
+  801f3e:	89 e5                	mov    %esp,%ebp
+  801f40:	57                   	push   %edi
+  801f41:	56                   	push   %esi
+  801f42:	53                   	push   %ebx
+  801f43:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  801f49:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  801f4e:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  801f54:	eb 2e                	jmp    801f84 <devcons_write+0x47>
+    m = n - tot;
+  801f56:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f59:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  801f5b:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801f60:	39 c3                	cmp    %eax,%ebx
+  801f62:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  801f65:	83 ec 04             	sub    $0x4,%esp
+  801f68:	53                   	push   %ebx
+  801f69:	89 f0                	mov    %esi,%eax
+  801f6b:	03 45 0c             	add    0xc(%ebp),%eax
+  801f6e:	50                   	push   %eax
+  801f6f:	57                   	push   %edi
+  801f70:	e8 6b 09 00 00       	call   8028e0 <memmove>
+    sys_cputs(buf, m);
+  801f75:	83 c4 08             	add    $0x8,%esp
+  801f78:	53                   	push   %ebx
+  801f79:	57                   	push   %edi
+  801f7a:	e8 53 e1 ff ff       	call   8000d2 <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  801f7f:	01 de                	add    %ebx,%esi
+  801f81:	83 c4 10             	add    $0x10,%esp
+  801f84:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801f87:	72 cd                	jb     801f56 <devcons_write+0x19>
+}
+  801f89:	89 f0                	mov    %esi,%eax
+  801f8b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f8e:	5b                   	pop    %ebx
+  801f8f:	5e                   	pop    %esi
+  801f90:	5f                   	pop    %edi
+  801f91:	5d                   	pop    %ebp
+  801f92:	c3                   	ret
+
+00801f93 <devcons_read>:
+{
+  801f93:	55                   	push   %ebp
+  801f94:	89 e5                	mov    %esp,%ebp
+  801f96:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  801f99:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f9e:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801fa2:	75 07                	jne    801fab <devcons_read+0x18>
+  801fa4:	eb 1f                	jmp    801fc5 <devcons_read+0x32>
+    sys_yield();
+  801fa6:	e8 c4 e1 ff ff       	call   80016f <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  801fab:	e8 40 e1 ff ff       	call   8000f0 <sys_cgetc>
+  801fb0:	85 c0                	test   %eax,%eax
+  801fb2:	74 f2                	je     801fa6 <devcons_read+0x13>
+  if (c < 0)
+  801fb4:	78 0f                	js     801fc5 <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  801fb6:	83 f8 04             	cmp    $0x4,%eax
+  801fb9:	74 0c                	je     801fc7 <devcons_read+0x34>
+  *(char*)vbuf = c;
+  801fbb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801fbe:	88 02                	mov    %al,(%edx)
+  return 1;
+  801fc0:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  801fc5:	c9                   	leave
+  801fc6:	c3                   	ret
+    return 0;
+  801fc7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fcc:	eb f7                	jmp    801fc5 <devcons_read+0x32>
+
+00801fce <cputchar>:
+{
+  801fce:	55                   	push   %ebp
+  801fcf:	89 e5                	mov    %esp,%ebp
+  801fd1:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  801fd4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fd7:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  801fda:	6a 01                	push   $0x1
+  801fdc:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801fdf:	50                   	push   %eax
+  801fe0:	e8 ed e0 ff ff       	call   8000d2 <sys_cputs>
+}
+  801fe5:	83 c4 10             	add    $0x10,%esp
+  801fe8:	c9                   	leave
+  801fe9:	c3                   	ret
+
+00801fea <getchar>:
+{
+  801fea:	55                   	push   %ebp
+  801feb:	89 e5                	mov    %esp,%ebp
+  801fed:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  801ff0:	6a 01                	push   $0x1
+  801ff2:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801ff5:	50                   	push   %eax
+  801ff6:	6a 00                	push   $0x0
+  801ff8:	e8 a8 e9 ff ff       	call   8009a5 <read>
+  if (r < 0)
+  801ffd:	83 c4 10             	add    $0x10,%esp
+  802000:	85 c0                	test   %eax,%eax
+  802002:	78 06                	js     80200a <getchar+0x20>
+  if (r < 1)
+  802004:	74 06                	je     80200c <getchar+0x22>
+  return c;
+  802006:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80200a:	c9                   	leave
+  80200b:	c3                   	ret
+    return -E_EOF;
+  80200c:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802011:	eb f7                	jmp    80200a <getchar+0x20>
+
+00802013 <iscons>:
+{
+  802013:	55                   	push   %ebp
+  802014:	89 e5                	mov    %esp,%ebp
+  802016:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802019:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80201c:	50                   	push   %eax
+  80201d:	ff 75 08             	push   0x8(%ebp)
+  802020:	e8 d5 e6 ff ff       	call   8006fa <fd_lookup>
+  802025:	83 c4 10             	add    $0x10,%esp
+  802028:	85 c0                	test   %eax,%eax
+  80202a:	78 11                	js     80203d <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  80202c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80202f:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802035:	39 10                	cmp    %edx,(%eax)
+  802037:	0f 94 c0             	sete   %al
+  80203a:	0f b6 c0             	movzbl %al,%eax
+}
+  80203d:	c9                   	leave
+  80203e:	c3                   	ret
+
+0080203f <opencons>:
+{
+  80203f:	55                   	push   %ebp
+  802040:	89 e5                	mov    %esp,%ebp
+  802042:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  802045:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802048:	50                   	push   %eax
+  802049:	e8 56 e6 ff ff       	call   8006a4 <fd_alloc>
+  80204e:	83 c4 10             	add    $0x10,%esp
+  802051:	85 c0                	test   %eax,%eax
+  802053:	78 3a                	js     80208f <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802055:	83 ec 04             	sub    $0x4,%esp
+  802058:	68 07 04 00 00       	push   $0x407
+  80205d:	ff 75 f4             	push   -0xc(%ebp)
+  802060:	6a 00                	push   $0x0
+  802062:	e8 6a e1 ff ff       	call   8001d1 <sys_page_alloc>
+  802067:	83 c4 10             	add    $0x10,%esp
+  80206a:	85 c0                	test   %eax,%eax
+  80206c:	78 21                	js     80208f <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  80206e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802071:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802077:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  802079:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80207c:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  802083:	83 ec 0c             	sub    $0xc,%esp
+  802086:	50                   	push   %eax
+  802087:	e8 f4 e5 ff ff       	call   800680 <fd2num>
+  80208c:	83 c4 10             	add    $0x10,%esp
+}
+  80208f:	c9                   	leave
+  802090:	c3                   	ret
+
+00802091 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  802091:	55                   	push   %ebp
+  802092:	89 e5                	mov    %esp,%ebp
+  802094:	56                   	push   %esi
+  802095:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  802096:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  802099:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  80209f:	e8 ac e0 ff ff       	call   800150 <sys_getenvid>
+  8020a4:	83 ec 0c             	sub    $0xc,%esp
+  8020a7:	ff 75 0c             	push   0xc(%ebp)
+  8020aa:	ff 75 08             	push   0x8(%ebp)
+  8020ad:	56                   	push   %esi
+  8020ae:	50                   	push   %eax
+  8020af:	68 dc 2f 80 00       	push   $0x802fdc
+  8020b4:	e8 b3 00 00 00       	call   80216c <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  8020b9:	83 c4 18             	add    $0x18,%esp
+  8020bc:	53                   	push   %ebx
+  8020bd:	ff 75 10             	push   0x10(%ebp)
+  8020c0:	e8 56 00 00 00       	call   80211b <vcprintf>
+  cprintf("\n");
+  8020c5:	c7 04 24 c8 2f 80 00 	movl   $0x802fc8,(%esp)
+  8020cc:	e8 9b 00 00 00       	call   80216c <cprintf>
+  8020d1:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  8020d4:	cc                   	int3
+  while (1)
+  8020d5:	eb fd                	jmp    8020d4 <_panic+0x43>
+
+008020d7 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8020d7:	55                   	push   %ebp
+  8020d8:	89 e5                	mov    %esp,%ebp
+  8020da:	53                   	push   %ebx
+  8020db:	83 ec 04             	sub    $0x4,%esp
+  8020de:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  8020e1:	8b 13                	mov    (%ebx),%edx
+  8020e3:	8d 42 01             	lea    0x1(%edx),%eax
+  8020e6:	89 03                	mov    %eax,(%ebx)
+  8020e8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8020eb:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  8020ef:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8020f4:	74 09                	je     8020ff <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  8020f6:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8020fa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020fd:	c9                   	leave
+  8020fe:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  8020ff:	83 ec 08             	sub    $0x8,%esp
+  802102:	68 ff 00 00 00       	push   $0xff
+  802107:	8d 43 08             	lea    0x8(%ebx),%eax
+  80210a:	50                   	push   %eax
+  80210b:	e8 c2 df ff ff       	call   8000d2 <sys_cputs>
+    b->idx = 0;
+  802110:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  802116:	83 c4 10             	add    $0x10,%esp
+  802119:	eb db                	jmp    8020f6 <putch+0x1f>
+
+0080211b <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80211b:	55                   	push   %ebp
+  80211c:	89 e5                	mov    %esp,%ebp
+  80211e:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  802124:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80212b:	00 00 00 
+  b.cnt = 0;
+  80212e:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  802135:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  802138:	ff 75 0c             	push   0xc(%ebp)
+  80213b:	ff 75 08             	push   0x8(%ebp)
+  80213e:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  802144:	50                   	push   %eax
+  802145:	68 d7 20 80 00       	push   $0x8020d7
+  80214a:	e8 14 01 00 00       	call   802263 <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  80214f:	83 c4 08             	add    $0x8,%esp
+  802152:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  802158:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80215e:	50                   	push   %eax
+  80215f:	e8 6e df ff ff       	call   8000d2 <sys_cputs>
+
+  return b.cnt;
+}
+  802164:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80216a:	c9                   	leave
+  80216b:	c3                   	ret
+
+0080216c <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80216c:	55                   	push   %ebp
+  80216d:	89 e5                	mov    %esp,%ebp
+  80216f:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  802172:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  802175:	50                   	push   %eax
+  802176:	ff 75 08             	push   0x8(%ebp)
+  802179:	e8 9d ff ff ff       	call   80211b <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  80217e:	c9                   	leave
+  80217f:	c3                   	ret
+
+00802180 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  802180:	55                   	push   %ebp
+  802181:	89 e5                	mov    %esp,%ebp
+  802183:	57                   	push   %edi
+  802184:	56                   	push   %esi
+  802185:	53                   	push   %ebx
+  802186:	83 ec 1c             	sub    $0x1c,%esp
+  802189:	89 c7                	mov    %eax,%edi
+  80218b:	89 d6                	mov    %edx,%esi
+  80218d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802190:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802193:	89 d1                	mov    %edx,%ecx
+  802195:	89 c2                	mov    %eax,%edx
+  802197:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80219a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80219d:	8b 45 10             	mov    0x10(%ebp),%eax
+  8021a0:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  8021a3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8021a6:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8021ad:	39 c2                	cmp    %eax,%edx
+  8021af:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8021b2:	72 3e                	jb     8021f2 <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  8021b4:	83 ec 0c             	sub    $0xc,%esp
+  8021b7:	ff 75 18             	push   0x18(%ebp)
+  8021ba:	83 eb 01             	sub    $0x1,%ebx
+  8021bd:	53                   	push   %ebx
+  8021be:	50                   	push   %eax
+  8021bf:	83 ec 08             	sub    $0x8,%esp
+  8021c2:	ff 75 e4             	push   -0x1c(%ebp)
+  8021c5:	ff 75 e0             	push   -0x20(%ebp)
+  8021c8:	ff 75 dc             	push   -0x24(%ebp)
+  8021cb:	ff 75 d8             	push   -0x28(%ebp)
+  8021ce:	e8 1c 0b 00 00       	call   802cef <__udivdi3>
+  8021d3:	83 c4 18             	add    $0x18,%esp
+  8021d6:	52                   	push   %edx
+  8021d7:	50                   	push   %eax
+  8021d8:	89 f2                	mov    %esi,%edx
+  8021da:	89 f8                	mov    %edi,%eax
+  8021dc:	e8 9f ff ff ff       	call   802180 <printnum>
+  8021e1:	83 c4 20             	add    $0x20,%esp
+  8021e4:	eb 13                	jmp    8021f9 <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  8021e6:	83 ec 08             	sub    $0x8,%esp
+  8021e9:	56                   	push   %esi
+  8021ea:	ff 75 18             	push   0x18(%ebp)
+  8021ed:	ff d7                	call   *%edi
+  8021ef:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  8021f2:	83 eb 01             	sub    $0x1,%ebx
+  8021f5:	85 db                	test   %ebx,%ebx
+  8021f7:	7f ed                	jg     8021e6 <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  8021f9:	83 ec 08             	sub    $0x8,%esp
+  8021fc:	56                   	push   %esi
+  8021fd:	83 ec 04             	sub    $0x4,%esp
+  802200:	ff 75 e4             	push   -0x1c(%ebp)
+  802203:	ff 75 e0             	push   -0x20(%ebp)
+  802206:	ff 75 dc             	push   -0x24(%ebp)
+  802209:	ff 75 d8             	push   -0x28(%ebp)
+  80220c:	e8 ff 0a 00 00       	call   802d10 <__umoddi3>
+  802211:	83 c4 14             	add    $0x14,%esp
+  802214:	0f be 80 ff 2f 80 00 	movsbl 0x802fff(%eax),%eax
+  80221b:	50                   	push   %eax
+  80221c:	ff d7                	call   *%edi
+}
+  80221e:	83 c4 10             	add    $0x10,%esp
+  802221:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802224:	5b                   	pop    %ebx
+  802225:	5e                   	pop    %esi
+  802226:	5f                   	pop    %edi
+  802227:	5d                   	pop    %ebp
+  802228:	c3                   	ret
+
+00802229 <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  802229:	55                   	push   %ebp
+  80222a:	89 e5                	mov    %esp,%ebp
+  80222c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  80222f:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  802233:	8b 10                	mov    (%eax),%edx
+  802235:	3b 50 04             	cmp    0x4(%eax),%edx
+  802238:	73 0a                	jae    802244 <sprintputch+0x1b>
+    *b->buf++ = ch;
+  80223a:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80223d:	89 08                	mov    %ecx,(%eax)
+  80223f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802242:	88 02                	mov    %al,(%edx)
+}
+  802244:	5d                   	pop    %ebp
+  802245:	c3                   	ret
+
+00802246 <printfmt>:
+{
+  802246:	55                   	push   %ebp
+  802247:	89 e5                	mov    %esp,%ebp
+  802249:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  80224c:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  80224f:	50                   	push   %eax
+  802250:	ff 75 10             	push   0x10(%ebp)
+  802253:	ff 75 0c             	push   0xc(%ebp)
+  802256:	ff 75 08             	push   0x8(%ebp)
+  802259:	e8 05 00 00 00       	call   802263 <vprintfmt>
+}
+  80225e:	83 c4 10             	add    $0x10,%esp
+  802261:	c9                   	leave
+  802262:	c3                   	ret
+
+00802263 <vprintfmt>:
+{
+  802263:	55                   	push   %ebp
+  802264:	89 e5                	mov    %esp,%ebp
+  802266:	57                   	push   %edi
+  802267:	56                   	push   %esi
+  802268:	53                   	push   %ebx
+  802269:	83 ec 2c             	sub    $0x2c,%esp
+  80226c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80226f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802272:	8b 7d 10             	mov    0x10(%ebp),%edi
+  802275:	eb 0a                	jmp    802281 <vprintfmt+0x1e>
+      putch(ch, putdat);
+  802277:	83 ec 08             	sub    $0x8,%esp
+  80227a:	53                   	push   %ebx
+  80227b:	50                   	push   %eax
+  80227c:	ff d6                	call   *%esi
+  80227e:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  802281:	83 c7 01             	add    $0x1,%edi
+  802284:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  802288:	83 f8 25             	cmp    $0x25,%eax
+  80228b:	74 0c                	je     802299 <vprintfmt+0x36>
+      if (ch == '\0')
+  80228d:	85 c0                	test   %eax,%eax
+  80228f:	75 e6                	jne    802277 <vprintfmt+0x14>
+}
+  802291:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802294:	5b                   	pop    %ebx
+  802295:	5e                   	pop    %esi
+  802296:	5f                   	pop    %edi
+  802297:	5d                   	pop    %ebp
+  802298:	c3                   	ret
+    padc = ' ';
+  802299:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  80229d:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  8022a4:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  8022ab:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  8022b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  8022b7:	8d 47 01             	lea    0x1(%edi),%eax
+  8022ba:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8022bd:	0f b6 17             	movzbl (%edi),%edx
+  8022c0:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8022c3:	3c 55                	cmp    $0x55,%al
+  8022c5:	0f 87 cf 03 00 00    	ja     80269a <vprintfmt+0x437>
+  8022cb:	0f b6 c0             	movzbl %al,%eax
+  8022ce:	ff 24 85 40 31 80 00 	jmp    *0x803140(,%eax,4)
+  8022d5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  8022d8:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8022dc:	eb d9                	jmp    8022b7 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  8022de:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8022e1:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8022e5:	eb d0                	jmp    8022b7 <vprintfmt+0x54>
+  8022e7:	0f b6 d2             	movzbl %dl,%edx
+  8022ea:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  8022ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022f2:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  8022f5:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8022f8:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  8022fc:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  8022ff:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  802302:	83 f9 09             	cmp    $0x9,%ecx
+  802305:	77 55                	ja     80235c <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  802307:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  80230a:	eb e9                	jmp    8022f5 <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  80230c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80230f:	8b 00                	mov    (%eax),%eax
+  802311:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802314:	8b 45 14             	mov    0x14(%ebp),%eax
+  802317:	8d 40 04             	lea    0x4(%eax),%eax
+  80231a:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  80231d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  802320:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  802324:	79 91                	jns    8022b7 <vprintfmt+0x54>
+        width = precision, precision = -1;
+  802326:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802329:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80232c:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  802333:	eb 82                	jmp    8022b7 <vprintfmt+0x54>
+      if (width < 0)
+  802335:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802338:	85 d2                	test   %edx,%edx
+  80233a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80233f:	0f 49 c2             	cmovns %edx,%eax
+  802342:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  802345:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  802348:	e9 6a ff ff ff       	jmp    8022b7 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  80234d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  802350:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  802357:	e9 5b ff ff ff       	jmp    8022b7 <vprintfmt+0x54>
+  80235c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80235f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802362:	eb bc                	jmp    802320 <vprintfmt+0xbd>
+      lflag++;
+  802364:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  802367:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  80236a:	e9 48 ff ff ff       	jmp    8022b7 <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  80236f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802372:	8d 78 04             	lea    0x4(%eax),%edi
+  802375:	83 ec 08             	sub    $0x8,%esp
+  802378:	53                   	push   %ebx
+  802379:	ff 30                	push   (%eax)
+  80237b:	ff d6                	call   *%esi
+      break;
+  80237d:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  802380:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  802383:	e9 b1 02 00 00       	jmp    802639 <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  802388:	8b 45 14             	mov    0x14(%ebp),%eax
+  80238b:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  80238e:	8b 10                	mov    (%eax),%edx
+  802390:	89 d0                	mov    %edx,%eax
+  802392:	f7 d8                	neg    %eax
+  802394:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  802397:	83 f8 10             	cmp    $0x10,%eax
+  80239a:	7f 23                	jg     8023bf <vprintfmt+0x15c>
+  80239c:	8b 14 85 a0 32 80 00 	mov    0x8032a0(,%eax,4),%edx
+  8023a3:	85 d2                	test   %edx,%edx
+  8023a5:	74 18                	je     8023bf <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  8023a7:	52                   	push   %edx
+  8023a8:	68 72 2f 80 00       	push   $0x802f72
+  8023ad:	53                   	push   %ebx
+  8023ae:	56                   	push   %esi
+  8023af:	e8 92 fe ff ff       	call   802246 <printfmt>
+  8023b4:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  8023b7:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8023ba:	e9 7a 02 00 00       	jmp    802639 <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  8023bf:	50                   	push   %eax
+  8023c0:	68 17 30 80 00       	push   $0x803017
+  8023c5:	53                   	push   %ebx
+  8023c6:	56                   	push   %esi
+  8023c7:	e8 7a fe ff ff       	call   802246 <printfmt>
+  8023cc:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  8023cf:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  8023d2:	e9 62 02 00 00       	jmp    802639 <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  8023d7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8023da:	83 c0 04             	add    $0x4,%eax
+  8023dd:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8023e0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8023e3:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  8023e5:	85 c9                	test   %ecx,%ecx
+  8023e7:	b8 10 30 80 00       	mov    $0x803010,%eax
+  8023ec:	0f 45 c1             	cmovne %ecx,%eax
+  8023ef:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  8023f2:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8023f6:	7e 06                	jle    8023fe <vprintfmt+0x19b>
+  8023f8:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8023fc:	75 0b                	jne    802409 <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8023fe:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  802401:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  802404:	89 75 08             	mov    %esi,0x8(%ebp)
+  802407:	eb 5c                	jmp    802465 <vprintfmt+0x202>
+  802409:	83 ec 08             	sub    $0x8,%esp
+  80240c:	ff 75 d0             	push   -0x30(%ebp)
+  80240f:	ff 75 cc             	push   -0x34(%ebp)
+  802412:	e8 20 03 00 00       	call   802737 <strnlen>
+  802417:	89 c2                	mov    %eax,%edx
+  802419:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80241c:	29 d0                	sub    %edx,%eax
+  80241e:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  802421:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  802425:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802428:	89 75 08             	mov    %esi,0x8(%ebp)
+  80242b:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  80242d:	eb 0e                	jmp    80243d <vprintfmt+0x1da>
+          putch(padc, putdat);
+  80242f:	83 ec 08             	sub    $0x8,%esp
+  802432:	53                   	push   %ebx
+  802433:	57                   	push   %edi
+  802434:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  802437:	83 ee 01             	sub    $0x1,%esi
+  80243a:	83 c4 10             	add    $0x10,%esp
+  80243d:	85 f6                	test   %esi,%esi
+  80243f:	7f ee                	jg     80242f <vprintfmt+0x1cc>
+  802441:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802444:	8b 75 08             	mov    0x8(%ebp),%esi
+  802447:	85 c0                	test   %eax,%eax
+  802449:	ba 00 00 00 00       	mov    $0x0,%edx
+  80244e:	0f 49 d0             	cmovns %eax,%edx
+  802451:	29 d0                	sub    %edx,%eax
+  802453:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802456:	eb a6                	jmp    8023fe <vprintfmt+0x19b>
+          putch(ch, putdat);
+  802458:	83 ec 08             	sub    $0x8,%esp
+  80245b:	53                   	push   %ebx
+  80245c:	52                   	push   %edx
+  80245d:	ff 55 08             	call   *0x8(%ebp)
+  802460:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  802463:	89 f1                	mov    %esi,%ecx
+  802465:	8d 71 01             	lea    0x1(%ecx),%esi
+  802468:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80246c:	0f be d0             	movsbl %al,%edx
+  80246f:	85 d2                	test   %edx,%edx
+  802471:	74 28                	je     80249b <vprintfmt+0x238>
+  802473:	85 ff                	test   %edi,%edi
+  802475:	78 05                	js     80247c <vprintfmt+0x219>
+  802477:	83 ef 01             	sub    $0x1,%edi
+  80247a:	78 30                	js     8024ac <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  80247c:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  802480:	74 d6                	je     802458 <vprintfmt+0x1f5>
+  802482:	0f be c0             	movsbl %al,%eax
+  802485:	83 e8 20             	sub    $0x20,%eax
+  802488:	83 f8 5e             	cmp    $0x5e,%eax
+  80248b:	76 cb                	jbe    802458 <vprintfmt+0x1f5>
+          putch('?', putdat);
+  80248d:	83 ec 08             	sub    $0x8,%esp
+  802490:	53                   	push   %ebx
+  802491:	6a 3f                	push   $0x3f
+  802493:	ff 55 08             	call   *0x8(%ebp)
+  802496:	83 c4 10             	add    $0x10,%esp
+  802499:	eb c8                	jmp    802463 <vprintfmt+0x200>
+  80249b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80249e:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8024a1:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8024a4:	01 d0                	add    %edx,%eax
+  8024a6:	29 c8                	sub    %ecx,%eax
+  8024a8:	89 c7                	mov    %eax,%edi
+  8024aa:	eb 13                	jmp    8024bf <vprintfmt+0x25c>
+  8024ac:	8b 75 08             	mov    0x8(%ebp),%esi
+  8024af:	eb ed                	jmp    80249e <vprintfmt+0x23b>
+        putch(' ', putdat);
+  8024b1:	83 ec 08             	sub    $0x8,%esp
+  8024b4:	53                   	push   %ebx
+  8024b5:	6a 20                	push   $0x20
+  8024b7:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  8024b9:	83 ef 01             	sub    $0x1,%edi
+  8024bc:	83 c4 10             	add    $0x10,%esp
+  8024bf:	85 ff                	test   %edi,%edi
+  8024c1:	7f ee                	jg     8024b1 <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  8024c3:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8024c6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8024c9:	e9 6b 01 00 00       	jmp    802639 <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  8024ce:	83 f9 01             	cmp    $0x1,%ecx
+  8024d1:	7f 1f                	jg     8024f2 <vprintfmt+0x28f>
+  else if (lflag)
+  8024d3:	85 c9                	test   %ecx,%ecx
+  8024d5:	74 67                	je     80253e <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  8024d7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024da:	8b 00                	mov    (%eax),%eax
+  8024dc:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8024df:	89 c1                	mov    %eax,%ecx
+  8024e1:	c1 f9 1f             	sar    $0x1f,%ecx
+  8024e4:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8024e7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024ea:	8d 40 04             	lea    0x4(%eax),%eax
+  8024ed:	89 45 14             	mov    %eax,0x14(%ebp)
+  8024f0:	eb 17                	jmp    802509 <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  8024f2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024f5:	8b 50 04             	mov    0x4(%eax),%edx
+  8024f8:	8b 00                	mov    (%eax),%eax
+  8024fa:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8024fd:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  802500:	8b 45 14             	mov    0x14(%ebp),%eax
+  802503:	8d 40 08             	lea    0x8(%eax),%eax
+  802506:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  802509:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80250c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  80250f:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  802514:	85 c9                	test   %ecx,%ecx
+  802516:	0f 89 03 01 00 00    	jns    80261f <vprintfmt+0x3bc>
+        putch('-', putdat);
+  80251c:	83 ec 08             	sub    $0x8,%esp
+  80251f:	53                   	push   %ebx
+  802520:	6a 2d                	push   $0x2d
+  802522:	ff d6                	call   *%esi
+        num = -(long long)num;
+  802524:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802527:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80252a:	f7 da                	neg    %edx
+  80252c:	83 d1 00             	adc    $0x0,%ecx
+  80252f:	f7 d9                	neg    %ecx
+  802531:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  802534:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802539:	e9 e1 00 00 00       	jmp    80261f <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  80253e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802541:	8b 00                	mov    (%eax),%eax
+  802543:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802546:	89 c1                	mov    %eax,%ecx
+  802548:	c1 f9 1f             	sar    $0x1f,%ecx
+  80254b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80254e:	8b 45 14             	mov    0x14(%ebp),%eax
+  802551:	8d 40 04             	lea    0x4(%eax),%eax
+  802554:	89 45 14             	mov    %eax,0x14(%ebp)
+  802557:	eb b0                	jmp    802509 <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  802559:	83 f9 01             	cmp    $0x1,%ecx
+  80255c:	7f 1e                	jg     80257c <vprintfmt+0x319>
+  else if (lflag)
+  80255e:	85 c9                	test   %ecx,%ecx
+  802560:	74 32                	je     802594 <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  802562:	8b 45 14             	mov    0x14(%ebp),%eax
+  802565:	8b 10                	mov    (%eax),%edx
+  802567:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80256c:	8d 40 04             	lea    0x4(%eax),%eax
+  80256f:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  802572:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  802577:	e9 a3 00 00 00       	jmp    80261f <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  80257c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80257f:	8b 10                	mov    (%eax),%edx
+  802581:	8b 48 04             	mov    0x4(%eax),%ecx
+  802584:	8d 40 08             	lea    0x8(%eax),%eax
+  802587:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  80258a:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  80258f:	e9 8b 00 00 00       	jmp    80261f <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  802594:	8b 45 14             	mov    0x14(%ebp),%eax
+  802597:	8b 10                	mov    (%eax),%edx
+  802599:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80259e:	8d 40 04             	lea    0x4(%eax),%eax
+  8025a1:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  8025a4:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  8025a9:	eb 74                	jmp    80261f <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  8025ab:	83 f9 01             	cmp    $0x1,%ecx
+  8025ae:	7f 1b                	jg     8025cb <vprintfmt+0x368>
+  else if (lflag)
+  8025b0:	85 c9                	test   %ecx,%ecx
+  8025b2:	74 2c                	je     8025e0 <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  8025b4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8025b7:	8b 10                	mov    (%eax),%edx
+  8025b9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025be:	8d 40 04             	lea    0x4(%eax),%eax
+  8025c1:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8025c4:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  8025c9:	eb 54                	jmp    80261f <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  8025cb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8025ce:	8b 10                	mov    (%eax),%edx
+  8025d0:	8b 48 04             	mov    0x4(%eax),%ecx
+  8025d3:	8d 40 08             	lea    0x8(%eax),%eax
+  8025d6:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8025d9:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  8025de:	eb 3f                	jmp    80261f <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8025e0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8025e3:	8b 10                	mov    (%eax),%edx
+  8025e5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025ea:	8d 40 04             	lea    0x4(%eax),%eax
+  8025ed:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8025f0:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  8025f5:	eb 28                	jmp    80261f <vprintfmt+0x3bc>
+      putch('0', putdat);
+  8025f7:	83 ec 08             	sub    $0x8,%esp
+  8025fa:	53                   	push   %ebx
+  8025fb:	6a 30                	push   $0x30
+  8025fd:	ff d6                	call   *%esi
+      putch('x', putdat);
+  8025ff:	83 c4 08             	add    $0x8,%esp
+  802602:	53                   	push   %ebx
+  802603:	6a 78                	push   $0x78
+  802605:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  802607:	8b 45 14             	mov    0x14(%ebp),%eax
+  80260a:	8b 10                	mov    (%eax),%edx
+  80260c:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  802611:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  802614:	8d 40 04             	lea    0x4(%eax),%eax
+  802617:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  80261a:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  80261f:	83 ec 0c             	sub    $0xc,%esp
+  802622:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  802626:	50                   	push   %eax
+  802627:	ff 75 e0             	push   -0x20(%ebp)
+  80262a:	57                   	push   %edi
+  80262b:	51                   	push   %ecx
+  80262c:	52                   	push   %edx
+  80262d:	89 da                	mov    %ebx,%edx
+  80262f:	89 f0                	mov    %esi,%eax
+  802631:	e8 4a fb ff ff       	call   802180 <printnum>
+      break;
+  802636:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  802639:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  80263c:	e9 40 fc ff ff       	jmp    802281 <vprintfmt+0x1e>
+  if (lflag >= 2)
+  802641:	83 f9 01             	cmp    $0x1,%ecx
+  802644:	7f 1b                	jg     802661 <vprintfmt+0x3fe>
+  else if (lflag)
+  802646:	85 c9                	test   %ecx,%ecx
+  802648:	74 2c                	je     802676 <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  80264a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80264d:	8b 10                	mov    (%eax),%edx
+  80264f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802654:	8d 40 04             	lea    0x4(%eax),%eax
+  802657:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  80265a:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  80265f:	eb be                	jmp    80261f <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  802661:	8b 45 14             	mov    0x14(%ebp),%eax
+  802664:	8b 10                	mov    (%eax),%edx
+  802666:	8b 48 04             	mov    0x4(%eax),%ecx
+  802669:	8d 40 08             	lea    0x8(%eax),%eax
+  80266c:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  80266f:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  802674:	eb a9                	jmp    80261f <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  802676:	8b 45 14             	mov    0x14(%ebp),%eax
+  802679:	8b 10                	mov    (%eax),%edx
+  80267b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802680:	8d 40 04             	lea    0x4(%eax),%eax
+  802683:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  802686:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  80268b:	eb 92                	jmp    80261f <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  80268d:	83 ec 08             	sub    $0x8,%esp
+  802690:	53                   	push   %ebx
+  802691:	6a 25                	push   $0x25
+  802693:	ff d6                	call   *%esi
+      break;
+  802695:	83 c4 10             	add    $0x10,%esp
+  802698:	eb 9f                	jmp    802639 <vprintfmt+0x3d6>
+      putch('%', putdat);
+  80269a:	83 ec 08             	sub    $0x8,%esp
+  80269d:	53                   	push   %ebx
+  80269e:	6a 25                	push   $0x25
+  8026a0:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  8026a2:	83 c4 10             	add    $0x10,%esp
+  8026a5:	89 f8                	mov    %edi,%eax
+  8026a7:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8026ab:	74 05                	je     8026b2 <vprintfmt+0x44f>
+  8026ad:	83 e8 01             	sub    $0x1,%eax
+  8026b0:	eb f5                	jmp    8026a7 <vprintfmt+0x444>
+  8026b2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8026b5:	eb 82                	jmp    802639 <vprintfmt+0x3d6>
+
+008026b7 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8026b7:	55                   	push   %ebp
+  8026b8:	89 e5                	mov    %esp,%ebp
+  8026ba:	83 ec 18             	sub    $0x18,%esp
+  8026bd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026c0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  8026c3:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8026c6:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8026ca:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8026cd:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  8026d4:	85 c0                	test   %eax,%eax
+  8026d6:	74 26                	je     8026fe <vsnprintf+0x47>
+  8026d8:	85 d2                	test   %edx,%edx
+  8026da:	7e 22                	jle    8026fe <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8026dc:	ff 75 14             	push   0x14(%ebp)
+  8026df:	ff 75 10             	push   0x10(%ebp)
+  8026e2:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8026e5:	50                   	push   %eax
+  8026e6:	68 29 22 80 00       	push   $0x802229
+  8026eb:	e8 73 fb ff ff       	call   802263 <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  8026f0:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8026f3:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  8026f6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026f9:	83 c4 10             	add    $0x10,%esp
+}
+  8026fc:	c9                   	leave
+  8026fd:	c3                   	ret
+    return -E_INVAL;
+  8026fe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802703:	eb f7                	jmp    8026fc <vsnprintf+0x45>
+
+00802705 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  802705:	55                   	push   %ebp
+  802706:	89 e5                	mov    %esp,%ebp
+  802708:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  80270b:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  80270e:	50                   	push   %eax
+  80270f:	ff 75 10             	push   0x10(%ebp)
+  802712:	ff 75 0c             	push   0xc(%ebp)
+  802715:	ff 75 08             	push   0x8(%ebp)
+  802718:	e8 9a ff ff ff       	call   8026b7 <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  80271d:	c9                   	leave
+  80271e:	c3                   	ret
+
+0080271f <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80271f:	55                   	push   %ebp
+  802720:	89 e5                	mov    %esp,%ebp
+  802722:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  802725:	b8 00 00 00 00       	mov    $0x0,%eax
+  80272a:	eb 03                	jmp    80272f <strlen+0x10>
+    n++;
+  80272c:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  80272f:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  802733:	75 f7                	jne    80272c <strlen+0xd>
+  return n;
+}
+  802735:	5d                   	pop    %ebp
+  802736:	c3                   	ret
+
+00802737 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  802737:	55                   	push   %ebp
+  802738:	89 e5                	mov    %esp,%ebp
+  80273a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80273d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802740:	b8 00 00 00 00       	mov    $0x0,%eax
+  802745:	eb 03                	jmp    80274a <strnlen+0x13>
+    n++;
+  802747:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80274a:	39 d0                	cmp    %edx,%eax
+  80274c:	74 08                	je     802756 <strnlen+0x1f>
+  80274e:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  802752:	75 f3                	jne    802747 <strnlen+0x10>
+  802754:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  802756:	89 d0                	mov    %edx,%eax
+  802758:	5d                   	pop    %ebp
+  802759:	c3                   	ret
+
+0080275a <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80275a:	55                   	push   %ebp
+  80275b:	89 e5                	mov    %esp,%ebp
+  80275d:	53                   	push   %ebx
+  80275e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802761:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  802764:	b8 00 00 00 00       	mov    $0x0,%eax
+  802769:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80276d:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  802770:	83 c0 01             	add    $0x1,%eax
+  802773:	84 d2                	test   %dl,%dl
+  802775:	75 f2                	jne    802769 <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  802777:	89 c8                	mov    %ecx,%eax
+  802779:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80277c:	c9                   	leave
+  80277d:	c3                   	ret
+
+0080277e <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80277e:	55                   	push   %ebp
+  80277f:	89 e5                	mov    %esp,%ebp
+  802781:	53                   	push   %ebx
+  802782:	83 ec 10             	sub    $0x10,%esp
+  802785:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  802788:	53                   	push   %ebx
+  802789:	e8 91 ff ff ff       	call   80271f <strlen>
+  80278e:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  802791:	ff 75 0c             	push   0xc(%ebp)
+  802794:	01 d8                	add    %ebx,%eax
+  802796:	50                   	push   %eax
+  802797:	e8 be ff ff ff       	call   80275a <strcpy>
+  return dst;
+}
+  80279c:	89 d8                	mov    %ebx,%eax
+  80279e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027a1:	c9                   	leave
+  8027a2:	c3                   	ret
+
+008027a3 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  8027a3:	55                   	push   %ebp
+  8027a4:	89 e5                	mov    %esp,%ebp
+  8027a6:	56                   	push   %esi
+  8027a7:	53                   	push   %ebx
+  8027a8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8027ab:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  8027ae:	89 f3                	mov    %esi,%ebx
+  8027b0:	03 5d 10             	add    0x10(%ebp),%ebx
+  8027b3:	89 f0                	mov    %esi,%eax
+  8027b5:	eb 0f                	jmp    8027c6 <strncpy+0x23>
+    *dst++ = *src;
+  8027b7:	83 c0 01             	add    $0x1,%eax
+  8027ba:	0f b6 0a             	movzbl (%edx),%ecx
+  8027bd:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  8027c0:	80 f9 01             	cmp    $0x1,%cl
+  8027c3:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  8027c6:	39 d8                	cmp    %ebx,%eax
+  8027c8:	75 ed                	jne    8027b7 <strncpy+0x14>
+  }
+  return ret;
+}
+  8027ca:	89 f0                	mov    %esi,%eax
+  8027cc:	5b                   	pop    %ebx
+  8027cd:	5e                   	pop    %esi
+  8027ce:	5d                   	pop    %ebp
+  8027cf:	c3                   	ret
+
+008027d0 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8027d0:	55                   	push   %ebp
+  8027d1:	89 e5                	mov    %esp,%ebp
+  8027d3:	56                   	push   %esi
+  8027d4:	53                   	push   %ebx
+  8027d5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8027d8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8027db:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  8027de:	89 f0                	mov    %esi,%eax
+  8027e0:	85 d2                	test   %edx,%edx
+  8027e2:	74 21                	je     802805 <strlcpy+0x35>
+  8027e4:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8027e8:	89 f2                	mov    %esi,%edx
+  8027ea:	eb 09                	jmp    8027f5 <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  8027ec:	83 c1 01             	add    $0x1,%ecx
+  8027ef:	83 c2 01             	add    $0x1,%edx
+  8027f2:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  8027f5:	39 c2                	cmp    %eax,%edx
+  8027f7:	74 09                	je     802802 <strlcpy+0x32>
+  8027f9:	0f b6 19             	movzbl (%ecx),%ebx
+  8027fc:	84 db                	test   %bl,%bl
+  8027fe:	75 ec                	jne    8027ec <strlcpy+0x1c>
+  802800:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  802802:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  802805:	29 f0                	sub    %esi,%eax
+}
+  802807:	5b                   	pop    %ebx
+  802808:	5e                   	pop    %esi
+  802809:	5d                   	pop    %ebp
+  80280a:	c3                   	ret
+
+0080280b <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80280b:	55                   	push   %ebp
+  80280c:	89 e5                	mov    %esp,%ebp
+  80280e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802811:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  802814:	eb 06                	jmp    80281c <strcmp+0x11>
+    p++, q++;
+  802816:	83 c1 01             	add    $0x1,%ecx
+  802819:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  80281c:	0f b6 01             	movzbl (%ecx),%eax
+  80281f:	84 c0                	test   %al,%al
+  802821:	74 04                	je     802827 <strcmp+0x1c>
+  802823:	3a 02                	cmp    (%edx),%al
+  802825:	74 ef                	je     802816 <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  802827:	0f b6 c0             	movzbl %al,%eax
+  80282a:	0f b6 12             	movzbl (%edx),%edx
+  80282d:	29 d0                	sub    %edx,%eax
+}
+  80282f:	5d                   	pop    %ebp
+  802830:	c3                   	ret
+
+00802831 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  802831:	55                   	push   %ebp
+  802832:	89 e5                	mov    %esp,%ebp
+  802834:	53                   	push   %ebx
+  802835:	8b 45 08             	mov    0x8(%ebp),%eax
+  802838:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80283b:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  80283e:	eb 09                	jmp    802849 <strncmp+0x18>
+    n--, p++, q++;
+  802840:	83 ea 01             	sub    $0x1,%edx
+  802843:	83 c0 01             	add    $0x1,%eax
+  802846:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  802849:	85 d2                	test   %edx,%edx
+  80284b:	74 18                	je     802865 <strncmp+0x34>
+  80284d:	0f b6 18             	movzbl (%eax),%ebx
+  802850:	84 db                	test   %bl,%bl
+  802852:	74 04                	je     802858 <strncmp+0x27>
+  802854:	3a 19                	cmp    (%ecx),%bl
+  802856:	74 e8                	je     802840 <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802858:	0f b6 00             	movzbl (%eax),%eax
+  80285b:	0f b6 11             	movzbl (%ecx),%edx
+  80285e:	29 d0                	sub    %edx,%eax
+}
+  802860:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802863:	c9                   	leave
+  802864:	c3                   	ret
+    return 0;
+  802865:	b8 00 00 00 00       	mov    $0x0,%eax
+  80286a:	eb f4                	jmp    802860 <strncmp+0x2f>
+
+0080286c <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80286c:	55                   	push   %ebp
+  80286d:	89 e5                	mov    %esp,%ebp
+  80286f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802872:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  802876:	eb 03                	jmp    80287b <strchr+0xf>
+  802878:	83 c0 01             	add    $0x1,%eax
+  80287b:	0f b6 10             	movzbl (%eax),%edx
+  80287e:	84 d2                	test   %dl,%dl
+  802880:	74 06                	je     802888 <strchr+0x1c>
+    if (*s == c)
+  802882:	38 ca                	cmp    %cl,%dl
+  802884:	75 f2                	jne    802878 <strchr+0xc>
+  802886:	eb 05                	jmp    80288d <strchr+0x21>
+      return (char*)s;
+  return 0;
+  802888:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80288d:	5d                   	pop    %ebp
+  80288e:	c3                   	ret
+
+0080288f <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80288f:	55                   	push   %ebp
+  802890:	89 e5                	mov    %esp,%ebp
+  802892:	8b 45 08             	mov    0x8(%ebp),%eax
+  802895:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  802899:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  80289c:	38 ca                	cmp    %cl,%dl
+  80289e:	74 09                	je     8028a9 <strfind+0x1a>
+  8028a0:	84 d2                	test   %dl,%dl
+  8028a2:	74 05                	je     8028a9 <strfind+0x1a>
+  for (; *s; s++)
+  8028a4:	83 c0 01             	add    $0x1,%eax
+  8028a7:	eb f0                	jmp    802899 <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  8028a9:	5d                   	pop    %ebp
+  8028aa:	c3                   	ret
+
+008028ab <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8028ab:	55                   	push   %ebp
+  8028ac:	89 e5                	mov    %esp,%ebp
+  8028ae:	57                   	push   %edi
+  8028af:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8028b2:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  8028b5:	85 c9                	test   %ecx,%ecx
+  8028b7:	74 20                	je     8028d9 <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  8028b9:	89 f8                	mov    %edi,%eax
+  8028bb:	09 c8                	or     %ecx,%eax
+  8028bd:	a8 03                	test   $0x3,%al
+  8028bf:	75 12                	jne    8028d3 <memset+0x28>
+    c &= 0xFF;
+  8028c1:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8028c5:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  8028cb:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  8028ce:	fc                   	cld
+  8028cf:	f3 ab                	rep stos %eax,%es:(%edi)
+  8028d1:	eb 06                	jmp    8028d9 <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  8028d3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8028d6:	fc                   	cld
+  8028d7:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  8028d9:	89 f8                	mov    %edi,%eax
+  8028db:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8028de:	c9                   	leave
+  8028df:	c3                   	ret
+
+008028e0 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8028e0:	55                   	push   %ebp
+  8028e1:	89 e5                	mov    %esp,%ebp
+  8028e3:	57                   	push   %edi
+  8028e4:	56                   	push   %esi
+  8028e5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028e8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8028eb:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  8028ee:	39 c6                	cmp    %eax,%esi
+  8028f0:	73 32                	jae    802924 <memmove+0x44>
+  8028f2:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8028f5:	39 d0                	cmp    %edx,%eax
+  8028f7:	73 2b                	jae    802924 <memmove+0x44>
+    s += n;
+    d += n;
+  8028f9:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8028fc:	89 d6                	mov    %edx,%esi
+  8028fe:	09 fe                	or     %edi,%esi
+  802900:	09 ce                	or     %ecx,%esi
+  802902:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  802908:	75 0e                	jne    802918 <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  80290a:	83 ef 04             	sub    $0x4,%edi
+  80290d:	8d 72 fc             	lea    -0x4(%edx),%esi
+  802910:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  802913:	fd                   	std
+  802914:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  802916:	eb 09                	jmp    802921 <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  802918:	83 ef 01             	sub    $0x1,%edi
+  80291b:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  80291e:	fd                   	std
+  80291f:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  802921:	fc                   	cld
+  802922:	eb 1a                	jmp    80293e <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  802924:	89 f2                	mov    %esi,%edx
+  802926:	09 c2                	or     %eax,%edx
+  802928:	09 ca                	or     %ecx,%edx
+  80292a:	f6 c2 03             	test   $0x3,%dl
+  80292d:	75 0a                	jne    802939 <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  80292f:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  802932:	89 c7                	mov    %eax,%edi
+  802934:	fc                   	cld
+  802935:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  802937:	eb 05                	jmp    80293e <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  802939:	89 c7                	mov    %eax,%edi
+  80293b:	fc                   	cld
+  80293c:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  80293e:	5e                   	pop    %esi
+  80293f:	5f                   	pop    %edi
+  802940:	5d                   	pop    %ebp
+  802941:	c3                   	ret
+
+00802942 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  802942:	55                   	push   %ebp
+  802943:	89 e5                	mov    %esp,%ebp
+  802945:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  802948:	ff 75 10             	push   0x10(%ebp)
+  80294b:	ff 75 0c             	push   0xc(%ebp)
+  80294e:	ff 75 08             	push   0x8(%ebp)
+  802951:	e8 8a ff ff ff       	call   8028e0 <memmove>
+}
+  802956:	c9                   	leave
+  802957:	c3                   	ret
+
+00802958 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  802958:	55                   	push   %ebp
+  802959:	89 e5                	mov    %esp,%ebp
+  80295b:	56                   	push   %esi
+  80295c:	53                   	push   %ebx
+  80295d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802960:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  802963:	89 c6                	mov    %eax,%esi
+  802965:	03 75 10             	add    0x10(%ebp),%esi
+  802968:	eb 06                	jmp    802970 <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  80296a:	83 c0 01             	add    $0x1,%eax
+  80296d:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  802970:	39 f0                	cmp    %esi,%eax
+  802972:	74 14                	je     802988 <memcmp+0x30>
+    if (*s1 != *s2)
+  802974:	0f b6 08             	movzbl (%eax),%ecx
+  802977:	0f b6 1a             	movzbl (%edx),%ebx
+  80297a:	38 d9                	cmp    %bl,%cl
+  80297c:	74 ec                	je     80296a <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  80297e:	0f b6 c1             	movzbl %cl,%eax
+  802981:	0f b6 db             	movzbl %bl,%ebx
+  802984:	29 d8                	sub    %ebx,%eax
+  802986:	eb 05                	jmp    80298d <memcmp+0x35>
+  }
+
+  return 0;
+  802988:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80298d:	5b                   	pop    %ebx
+  80298e:	5e                   	pop    %esi
+  80298f:	5d                   	pop    %ebp
+  802990:	c3                   	ret
+
+00802991 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  802991:	55                   	push   %ebp
+  802992:	89 e5                	mov    %esp,%ebp
+  802994:	8b 45 08             	mov    0x8(%ebp),%eax
+  802997:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  80299a:	89 c2                	mov    %eax,%edx
+  80299c:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  80299f:	eb 03                	jmp    8029a4 <memfind+0x13>
+  8029a1:	83 c0 01             	add    $0x1,%eax
+  8029a4:	39 d0                	cmp    %edx,%eax
+  8029a6:	73 04                	jae    8029ac <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  8029a8:	38 08                	cmp    %cl,(%eax)
+  8029aa:	75 f5                	jne    8029a1 <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  8029ac:	5d                   	pop    %ebp
+  8029ad:	c3                   	ret
+
+008029ae <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8029ae:	55                   	push   %ebp
+  8029af:	89 e5                	mov    %esp,%ebp
+  8029b1:	57                   	push   %edi
+  8029b2:	56                   	push   %esi
+  8029b3:	53                   	push   %ebx
+  8029b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8029b7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  8029ba:	eb 03                	jmp    8029bf <strtol+0x11>
+    s++;
+  8029bc:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  8029bf:	0f b6 02             	movzbl (%edx),%eax
+  8029c2:	3c 20                	cmp    $0x20,%al
+  8029c4:	74 f6                	je     8029bc <strtol+0xe>
+  8029c6:	3c 09                	cmp    $0x9,%al
+  8029c8:	74 f2                	je     8029bc <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  8029ca:	3c 2b                	cmp    $0x2b,%al
+  8029cc:	74 2a                	je     8029f8 <strtol+0x4a>
+  int neg = 0;
+  8029ce:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  8029d3:	3c 2d                	cmp    $0x2d,%al
+  8029d5:	74 2b                	je     802a02 <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8029d7:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8029dd:	75 0f                	jne    8029ee <strtol+0x40>
+  8029df:	80 3a 30             	cmpb   $0x30,(%edx)
+  8029e2:	74 28                	je     802a0c <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  8029e4:	85 db                	test   %ebx,%ebx
+  8029e6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8029eb:	0f 44 d8             	cmove  %eax,%ebx
+  8029ee:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8029f3:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8029f6:	eb 46                	jmp    802a3e <strtol+0x90>
+    s++;
+  8029f8:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  8029fb:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a00:	eb d5                	jmp    8029d7 <strtol+0x29>
+    s++, neg = 1;
+  802a02:	83 c2 01             	add    $0x1,%edx
+  802a05:	bf 01 00 00 00       	mov    $0x1,%edi
+  802a0a:	eb cb                	jmp    8029d7 <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802a0c:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  802a10:	74 0e                	je     802a20 <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  802a12:	85 db                	test   %ebx,%ebx
+  802a14:	75 d8                	jne    8029ee <strtol+0x40>
+    s++, base = 8;
+  802a16:	83 c2 01             	add    $0x1,%edx
+  802a19:	bb 08 00 00 00       	mov    $0x8,%ebx
+  802a1e:	eb ce                	jmp    8029ee <strtol+0x40>
+    s += 2, base = 16;
+  802a20:	83 c2 02             	add    $0x2,%edx
+  802a23:	bb 10 00 00 00       	mov    $0x10,%ebx
+  802a28:	eb c4                	jmp    8029ee <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  802a2a:	0f be c0             	movsbl %al,%eax
+  802a2d:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  802a30:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802a33:	7d 3a                	jge    802a6f <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  802a35:	83 c2 01             	add    $0x1,%edx
+  802a38:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  802a3c:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  802a3e:	0f b6 02             	movzbl (%edx),%eax
+  802a41:	8d 70 d0             	lea    -0x30(%eax),%esi
+  802a44:	89 f3                	mov    %esi,%ebx
+  802a46:	80 fb 09             	cmp    $0x9,%bl
+  802a49:	76 df                	jbe    802a2a <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  802a4b:	8d 70 9f             	lea    -0x61(%eax),%esi
+  802a4e:	89 f3                	mov    %esi,%ebx
+  802a50:	80 fb 19             	cmp    $0x19,%bl
+  802a53:	77 08                	ja     802a5d <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  802a55:	0f be c0             	movsbl %al,%eax
+  802a58:	83 e8 57             	sub    $0x57,%eax
+  802a5b:	eb d3                	jmp    802a30 <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  802a5d:	8d 70 bf             	lea    -0x41(%eax),%esi
+  802a60:	89 f3                	mov    %esi,%ebx
+  802a62:	80 fb 19             	cmp    $0x19,%bl
+  802a65:	77 08                	ja     802a6f <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  802a67:	0f be c0             	movsbl %al,%eax
+  802a6a:	83 e8 37             	sub    $0x37,%eax
+  802a6d:	eb c1                	jmp    802a30 <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  802a6f:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802a73:	74 05                	je     802a7a <strtol+0xcc>
+    *endptr = (char*)s;
+  802a75:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a78:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  802a7a:	89 c8                	mov    %ecx,%eax
+  802a7c:	f7 d8                	neg    %eax
+  802a7e:	85 ff                	test   %edi,%edi
+  802a80:	0f 45 c8             	cmovne %eax,%ecx
+}
+  802a83:	89 c8                	mov    %ecx,%eax
+  802a85:	5b                   	pop    %ebx
+  802a86:	5e                   	pop    %esi
+  802a87:	5f                   	pop    %edi
+  802a88:	5d                   	pop    %ebp
+  802a89:	c3                   	ret
+
+00802a8a <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  802a8a:	55                   	push   %ebp
+  802a8b:	89 e5                	mov    %esp,%ebp
+  802a8d:	57                   	push   %edi
+  802a8e:	56                   	push   %esi
+  802a8f:	53                   	push   %ebx
+  802a90:	83 ec 14             	sub    $0x14,%esp
+  802a93:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802a96:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a99:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802a9c:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  802a9f:	85 c0                	test   %eax,%eax
+  802aa1:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802aa6:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  802aa9:	ff 33                	push   (%ebx)
+  802aab:	50                   	push   %eax
+  802aac:	e8 f8 d9 ff ff       	call   8004a9 <sys_ipc_recv>
+  802ab1:	83 c4 10             	add    $0x10,%esp
+  802ab4:	85 c0                	test   %eax,%eax
+  802ab6:	78 39                	js     802af1 <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  802ab8:	85 ff                	test   %edi,%edi
+  802aba:	74 0a                	je     802ac6 <ipc_recv_pages+0x3c>
+  802abc:	a1 44 57 80 00       	mov    0x805744,%eax
+  802ac1:	8b 40 7c             	mov    0x7c(%eax),%eax
+  802ac4:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  802ac6:	85 f6                	test   %esi,%esi
+  802ac8:	74 0d                	je     802ad7 <ipc_recv_pages+0x4d>
+  802aca:	a1 44 57 80 00       	mov    0x805744,%eax
+  802acf:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  802ad5:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  802ad7:	a1 44 57 80 00       	mov    0x805744,%eax
+  802adc:	8b 40 74             	mov    0x74(%eax),%eax
+  802adf:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  802ae1:	a1 44 57 80 00       	mov    0x805744,%eax
+  802ae6:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  802ae9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802aec:	5b                   	pop    %ebx
+  802aed:	5e                   	pop    %esi
+  802aee:	5f                   	pop    %edi
+  802aef:	5d                   	pop    %ebp
+  802af0:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  802af1:	85 ff                	test   %edi,%edi
+  802af3:	74 06                	je     802afb <ipc_recv_pages+0x71>
+  802af5:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  802afb:	85 f6                	test   %esi,%esi
+  802afd:	74 06                	je     802b05 <ipc_recv_pages+0x7b>
+  802aff:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  802b05:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  802b0b:	eb dc                	jmp    802ae9 <ipc_recv_pages+0x5f>
+
+00802b0d <ipc_recv>:
+{
+  802b0d:	55                   	push   %ebp
+  802b0e:	89 e5                	mov    %esp,%ebp
+  802b10:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  802b13:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  802b1a:	ff 75 10             	push   0x10(%ebp)
+  802b1d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b20:	50                   	push   %eax
+  802b21:	ff 75 0c             	push   0xc(%ebp)
+  802b24:	ff 75 08             	push   0x8(%ebp)
+  802b27:	e8 5e ff ff ff       	call   802a8a <ipc_recv_pages>
+}
+  802b2c:	c9                   	leave
+  802b2d:	c3                   	ret
+
+00802b2e <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  802b2e:	55                   	push   %ebp
+  802b2f:	89 e5                	mov    %esp,%ebp
+  802b31:	57                   	push   %edi
+  802b32:	56                   	push   %esi
+  802b33:	53                   	push   %ebx
+  802b34:	83 ec 0c             	sub    $0xc,%esp
+  802b37:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802b3a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802b3d:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  802b40:	89 c3                	mov    %eax,%ebx
+  802b42:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  802b48:	85 c0                	test   %eax,%eax
+  802b4a:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802b4f:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  802b52:	83 ec 0c             	sub    $0xc,%esp
+  802b55:	ff 75 14             	push   0x14(%ebp)
+  802b58:	ff 75 18             	push   0x18(%ebp)
+  802b5b:	53                   	push   %ebx
+  802b5c:	56                   	push   %esi
+  802b5d:	57                   	push   %edi
+  802b5e:	e8 25 d9 ff ff       	call   800488 <sys_ipc_try_send>
+  802b63:	83 c4 20             	add    $0x20,%esp
+  802b66:	85 c0                	test   %eax,%eax
+  802b68:	79 1e                	jns    802b88 <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  802b6a:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802b6d:	75 07                	jne    802b76 <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  802b6f:	e8 fb d5 ff ff       	call   80016f <sys_yield>
+  802b74:	eb dc                	jmp    802b52 <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  802b76:	50                   	push   %eax
+  802b77:	68 03 33 80 00       	push   $0x803303
+  802b7c:	6a 5c                	push   $0x5c
+  802b7e:	68 10 33 80 00       	push   $0x803310
+  802b83:	e8 09 f5 ff ff       	call   802091 <_panic>
+  }
+}
+  802b88:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b8b:	5b                   	pop    %ebx
+  802b8c:	5e                   	pop    %esi
+  802b8d:	5f                   	pop    %edi
+  802b8e:	5d                   	pop    %ebp
+  802b8f:	c3                   	ret
+
+00802b90 <ipc_send>:
+{
+  802b90:	55                   	push   %ebp
+  802b91:	89 e5                	mov    %esp,%ebp
+  802b93:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  802b96:	ff 75 14             	push   0x14(%ebp)
+  802b99:	6a 01                	push   $0x1
+  802b9b:	ff 75 10             	push   0x10(%ebp)
+  802b9e:	ff 75 0c             	push   0xc(%ebp)
+  802ba1:	ff 75 08             	push   0x8(%ebp)
+  802ba4:	e8 85 ff ff ff       	call   802b2e <ipc_send_pages>
+}
+  802ba9:	83 c4 20             	add    $0x20,%esp
+  802bac:	c9                   	leave
+  802bad:	c3                   	ret
+
+00802bae <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802bae:	55                   	push   %ebp
+  802baf:	89 e5                	mov    %esp,%ebp
+  802bb1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  802bb4:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  802bb9:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802bbc:	c1 e0 04             	shl    $0x4,%eax
+  802bbf:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802bc4:	8b 40 50             	mov    0x50(%eax),%eax
+  802bc7:	39 c8                	cmp    %ecx,%eax
+  802bc9:	74 12                	je     802bdd <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  802bcb:	83 c2 01             	add    $0x1,%edx
+  802bce:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802bd4:	75 e3                	jne    802bb9 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  802bd6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bdb:	eb 0e                	jmp    802beb <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  802bdd:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802be0:	c1 e0 04             	shl    $0x4,%eax
+  802be3:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802be8:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802beb:	5d                   	pop    %ebp
+  802bec:	c3                   	ret
+
+00802bed <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802bed:	55                   	push   %ebp
+  802bee:	89 e5                	mov    %esp,%ebp
+  802bf0:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802bf3:	89 c2                	mov    %eax,%edx
+  802bf5:	c1 ea 16             	shr    $0x16,%edx
+  802bf8:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  802bff:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802c04:	f6 c1 01             	test   $0x1,%cl
+  802c07:	74 1c                	je     802c25 <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  802c09:	c1 e8 0c             	shr    $0xc,%eax
+  802c0c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  802c13:	a8 01                	test   $0x1,%al
+  802c15:	74 0e                	je     802c25 <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  802c17:	c1 e8 0c             	shr    $0xc,%eax
+  802c1a:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802c21:	ef 
+  802c22:	0f b7 d2             	movzwl %dx,%edx
+}
+  802c25:	89 d0                	mov    %edx,%eax
+  802c27:	5d                   	pop    %ebp
+  802c28:	c3                   	ret
+
+00802c29 <udivmod>:
+  802c29:	55                   	push   %ebp
+  802c2a:	57                   	push   %edi
+  802c2b:	56                   	push   %esi
+  802c2c:	53                   	push   %ebx
+  802c2d:	83 ec 14             	sub    $0x14,%esp
+  802c30:	8b 74 24 28          	mov    0x28(%esp),%esi
+  802c34:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  802c38:	89 fb                	mov    %edi,%ebx
+  802c3a:	09 f3                	or     %esi,%ebx
+  802c3c:	0f 84 88 00 00 00    	je     802cca <udivmod+0xa1>
+  802c42:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802c47:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802c4e:	00 
+  802c4f:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802c56:	00 
+  802c57:	89 cd                	mov    %ecx,%ebp
+  802c59:	89 34 24             	mov    %esi,(%esp)
+  802c5c:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802c60:	eb 08                	jmp    802c6a <udivmod+0x41>
+  802c62:	83 ed 01             	sub    $0x1,%ebp
+  802c65:	83 fd ff             	cmp    $0xffffffff,%ebp
+  802c68:	74 6c                	je     802cd6 <udivmod+0xad>
+  802c6a:	89 c3                	mov    %eax,%ebx
+  802c6c:	89 d6                	mov    %edx,%esi
+  802c6e:	89 e9                	mov    %ebp,%ecx
+  802c70:	0f ad f3             	shrd   %cl,%esi,%ebx
+  802c73:	d3 ee                	shr    %cl,%esi
+  802c75:	f6 c1 20             	test   $0x20,%cl
+  802c78:	74 04                	je     802c7e <udivmod+0x55>
+  802c7a:	89 f3                	mov    %esi,%ebx
+  802c7c:	31 f6                	xor    %esi,%esi
+  802c7e:	8b 3c 24             	mov    (%esp),%edi
+  802c81:	39 fb                	cmp    %edi,%ebx
+  802c83:	89 f7                	mov    %esi,%edi
+  802c85:	8b 1c 24             	mov    (%esp),%ebx
+  802c88:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802c8c:	19 f7                	sbb    %esi,%edi
+  802c8e:	72 d2                	jb     802c62 <udivmod+0x39>
+  802c90:	89 f7                	mov    %esi,%edi
+  802c92:	89 de                	mov    %ebx,%esi
+  802c94:	89 e9                	mov    %ebp,%ecx
+  802c96:	0f a5 f7             	shld   %cl,%esi,%edi
+  802c99:	d3 e6                	shl    %cl,%esi
+  802c9b:	f6 c1 20             	test   $0x20,%cl
+  802c9e:	74 04                	je     802ca4 <udivmod+0x7b>
+  802ca0:	89 f7                	mov    %esi,%edi
+  802ca2:	31 f6                	xor    %esi,%esi
+  802ca4:	29 f0                	sub    %esi,%eax
+  802ca6:	19 fa                	sbb    %edi,%edx
+  802ca8:	be 01 00 00 00       	mov    $0x1,%esi
+  802cad:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cb2:	0f a5 f7             	shld   %cl,%esi,%edi
+  802cb5:	d3 e6                	shl    %cl,%esi
+  802cb7:	f6 c1 20             	test   $0x20,%cl
+  802cba:	74 04                	je     802cc0 <udivmod+0x97>
+  802cbc:	89 f7                	mov    %esi,%edi
+  802cbe:	31 f6                	xor    %esi,%esi
+  802cc0:	09 74 24 08          	or     %esi,0x8(%esp)
+  802cc4:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802cc8:	eb 98                	jmp    802c62 <udivmod+0x39>
+  802cca:	89 f0                	mov    %esi,%eax
+  802ccc:	89 fa                	mov    %edi,%edx
+  802cce:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802cd2:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802cd6:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802cda:	89 01                	mov    %eax,(%ecx)
+  802cdc:	89 51 04             	mov    %edx,0x4(%ecx)
+  802cdf:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802ce3:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802ce7:	83 c4 14             	add    $0x14,%esp
+  802cea:	5b                   	pop    %ebx
+  802ceb:	5e                   	pop    %esi
+  802cec:	5f                   	pop    %edi
+  802ced:	5d                   	pop    %ebp
+  802cee:	c3                   	ret
+
+00802cef <__udivdi3>:
+  802cef:	83 ec 18             	sub    $0x18,%esp
+  802cf2:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802cf6:	50                   	push   %eax
+  802cf7:	ff 74 24 2c          	push   0x2c(%esp)
+  802cfb:	ff 74 24 2c          	push   0x2c(%esp)
+  802cff:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802d03:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802d07:	e8 1d ff ff ff       	call   802c29 <udivmod>
+  802d0c:	83 c4 24             	add    $0x24,%esp
+  802d0f:	c3                   	ret
+
+00802d10 <__umoddi3>:
+  802d10:	83 ec 18             	sub    $0x18,%esp
+  802d13:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802d17:	50                   	push   %eax
+  802d18:	ff 74 24 2c          	push   0x2c(%esp)
+  802d1c:	ff 74 24 2c          	push   0x2c(%esp)
+  802d20:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802d24:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802d28:	e8 fc fe ff ff       	call   802c29 <udivmod>
+  802d2d:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802d31:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802d35:	83 c4 24             	add    $0x24,%esp
+  802d38:	c3                   	ret
+
+00802d39 <__divdi3>:
+  802d39:	56                   	push   %esi
+  802d3a:	53                   	push   %ebx
+  802d3b:	83 ec 14             	sub    $0x14,%esp
+  802d3e:	8b 44 24 20          	mov    0x20(%esp),%eax
+  802d42:	8b 54 24 24          	mov    0x24(%esp),%edx
+  802d46:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  802d4a:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  802d4e:	85 d2                	test   %edx,%edx
+  802d50:	78 18                	js     802d6a <__divdi3+0x31>
+  802d52:	85 db                	test   %ebx,%ebx
+  802d54:	78 3e                	js     802d94 <__divdi3+0x5b>
+  802d56:	83 ec 04             	sub    $0x4,%esp
+  802d59:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802d5d:	56                   	push   %esi
+  802d5e:	53                   	push   %ebx
+  802d5f:	51                   	push   %ecx
+  802d60:	e8 c4 fe ff ff       	call   802c29 <udivmod>
+  802d65:	83 c4 10             	add    $0x10,%esp
+  802d68:	eb 24                	jmp    802d8e <__divdi3+0x55>
+  802d6a:	f7 d8                	neg    %eax
+  802d6c:	83 d2 00             	adc    $0x0,%edx
+  802d6f:	f7 da                	neg    %edx
+  802d71:	85 db                	test   %ebx,%ebx
+  802d73:	78 3a                	js     802daf <__divdi3+0x76>
+  802d75:	83 ec 04             	sub    $0x4,%esp
+  802d78:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802d7c:	56                   	push   %esi
+  802d7d:	53                   	push   %ebx
+  802d7e:	51                   	push   %ecx
+  802d7f:	e8 a5 fe ff ff       	call   802c29 <udivmod>
+  802d84:	83 c4 10             	add    $0x10,%esp
+  802d87:	f7 d8                	neg    %eax
+  802d89:	83 d2 00             	adc    $0x0,%edx
+  802d8c:	f7 da                	neg    %edx
+  802d8e:	83 c4 14             	add    $0x14,%esp
+  802d91:	5b                   	pop    %ebx
+  802d92:	5e                   	pop    %esi
+  802d93:	c3                   	ret
+  802d94:	83 ec 04             	sub    $0x4,%esp
+  802d97:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802d9b:	56                   	push   %esi
+  802d9c:	f7 d9                	neg    %ecx
+  802d9e:	83 d3 00             	adc    $0x0,%ebx
+  802da1:	f7 db                	neg    %ebx
+  802da3:	53                   	push   %ebx
+  802da4:	51                   	push   %ecx
+  802da5:	e8 7f fe ff ff       	call   802c29 <udivmod>
+  802daa:	83 c4 10             	add    $0x10,%esp
+  802dad:	eb d8                	jmp    802d87 <__divdi3+0x4e>
+  802daf:	83 ec 04             	sub    $0x4,%esp
+  802db2:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802db6:	56                   	push   %esi
+  802db7:	f7 d9                	neg    %ecx
+  802db9:	83 d3 00             	adc    $0x0,%ebx
+  802dbc:	f7 db                	neg    %ebx
+  802dbe:	53                   	push   %ebx
+  802dbf:	51                   	push   %ecx
+  802dc0:	e8 64 fe ff ff       	call   802c29 <udivmod>
+  802dc5:	83 c4 10             	add    $0x10,%esp
+  802dc8:	eb c4                	jmp    802d8e <__divdi3+0x55>
+
+00802dca <__moddi3>:
+  802dca:	55                   	push   %ebp
+  802dcb:	57                   	push   %edi
+  802dcc:	56                   	push   %esi
+  802dcd:	53                   	push   %ebx
+  802dce:	83 ec 24             	sub    $0x24,%esp
+  802dd1:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802dd5:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802dd9:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  802ddd:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  802de1:	85 d2                	test   %edx,%edx
+  802de3:	78 3b                	js     802e20 <__moddi3+0x56>
+  802de5:	83 ec 04             	sub    $0x4,%esp
+  802de8:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  802dec:	56                   	push   %esi
+  802ded:	89 ce                	mov    %ecx,%esi
+  802def:	f7 de                	neg    %esi
+  802df1:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802df5:	89 de                	mov    %ebx,%esi
+  802df7:	83 d6 00             	adc    $0x0,%esi
+  802dfa:	f7 de                	neg    %esi
+  802dfc:	89 74 24 14          	mov    %esi,0x14(%esp)
+  802e00:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802e04:	0f 48 f1             	cmovs  %ecx,%esi
+  802e07:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  802e0c:	53                   	push   %ebx
+  802e0d:	56                   	push   %esi
+  802e0e:	e8 16 fe ff ff       	call   802c29 <udivmod>
+  802e13:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802e17:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802e1b:	83 c4 10             	add    $0x10,%esp
+  802e1e:	eb 47                	jmp    802e67 <__moddi3+0x9d>
+  802e20:	f7 d8                	neg    %eax
+  802e22:	83 d2 00             	adc    $0x0,%edx
+  802e25:	f7 da                	neg    %edx
+  802e27:	83 ec 04             	sub    $0x4,%esp
+  802e2a:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  802e2e:	56                   	push   %esi
+  802e2f:	89 cf                	mov    %ecx,%edi
+  802e31:	f7 df                	neg    %edi
+  802e33:	89 de                	mov    %ebx,%esi
+  802e35:	83 d6 00             	adc    $0x0,%esi
+  802e38:	f7 de                	neg    %esi
+  802e3a:	0f 49 cf             	cmovns %edi,%ecx
+  802e3d:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802e41:	0f 49 de             	cmovns %esi,%ebx
+  802e44:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  802e48:	ff 74 24 0c          	push   0xc(%esp)
+  802e4c:	ff 74 24 0c          	push   0xc(%esp)
+  802e50:	e8 d4 fd ff ff       	call   802c29 <udivmod>
+  802e55:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802e59:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802e5d:	f7 d8                	neg    %eax
+  802e5f:	83 d2 00             	adc    $0x0,%edx
+  802e62:	f7 da                	neg    %edx
+  802e64:	83 c4 10             	add    $0x10,%esp
+  802e67:	83 c4 24             	add    $0x24,%esp
+  802e6a:	5b                   	pop    %ebx
+  802e6b:	5e                   	pop    %esi
+  802e6c:	5f                   	pop    %edi
+  802e6d:	5d                   	pop    %ebp
+  802e6e:	c3                   	ret
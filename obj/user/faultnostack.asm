@@ -0,0 +1,6469 @@
+
+obj/user/faultnostack.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 23 00 00 00       	call   800054 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+void _pgfault_upcall();
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+  sys_env_set_pgfault_upcall(0, (void*)_pgfault_upcall);
+  800039:	68 6f 06 80 00       	push   $0x80066f
+  80003e:	6a 00                	push   $0x0
+  800040:	e8 f0 03 00 00       	call   800435 <sys_env_set_pgfault_upcall>
+  *(int*)0 = 0;
+  800045:	c7 05 00 00 00 00 00 	movl   $0x0,0x0
+  80004c:	00 00 00 
+}
+  80004f:	83 c4 10             	add    $0x10,%esp
+  800052:	c9                   	leave
+  800053:	c3                   	ret
+
+00800054 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800054:	55                   	push   %ebp
+  800055:	89 e5                	mov    %esp,%ebp
+  800057:	56                   	push   %esi
+  800058:	53                   	push   %ebx
+  800059:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80005c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  80005f:	c7 05 44 57 80 00 00 	movl   $0x0,0x805744
+  800066:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  800069:	e8 d1 00 00 00       	call   80013f <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  80006e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800073:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800076:	c1 e0 04             	shl    $0x4,%eax
+  800079:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80007e:	a3 44 57 80 00       	mov    %eax,0x805744
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800083:	85 db                	test   %ebx,%ebx
+  800085:	7e 07                	jle    80008e <libmain+0x3a>
+    binaryname = argv[0];
+  800087:	8b 06                	mov    (%esi),%eax
+  800089:	a3 00 40 80 00       	mov    %eax,0x804000
+
+  // call user main routine
+  umain(argc, argv);
+  80008e:	83 ec 08             	sub    $0x8,%esp
+  800091:	56                   	push   %esi
+  800092:	53                   	push   %ebx
+  800093:	e8 9b ff ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  800098:	e8 0a 00 00 00       	call   8000a7 <exit>
+}
+  80009d:	83 c4 10             	add    $0x10,%esp
+  8000a0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000a3:	5b                   	pop    %ebx
+  8000a4:	5e                   	pop    %esi
+  8000a5:	5d                   	pop    %ebp
+  8000a6:	c3                   	ret
+
+008000a7 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000a7:	55                   	push   %ebp
+  8000a8:	89 e5                	mov    %esp,%ebp
+  8000aa:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  8000ad:	e8 ad 07 00 00       	call   80085f <close_all>
+  sys_env_destroy(0);
+  8000b2:	83 ec 0c             	sub    $0xc,%esp
+  8000b5:	6a 00                	push   $0x0
+  8000b7:	e8 42 00 00 00       	call   8000fe <sys_env_destroy>
+}
+  8000bc:	83 c4 10             	add    $0x10,%esp
+  8000bf:	c9                   	leave
+  8000c0:	c3                   	ret
+
+008000c1 <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8000c1:	55                   	push   %ebp
+  8000c2:	89 e5                	mov    %esp,%ebp
+  8000c4:	57                   	push   %edi
+  8000c5:	56                   	push   %esi
+  8000c6:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8000c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000cc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000cf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000d2:	89 c3                	mov    %eax,%ebx
+  8000d4:	89 c7                	mov    %eax,%edi
+  8000d6:	89 c6                	mov    %eax,%esi
+  8000d8:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  8000da:	5b                   	pop    %ebx
+  8000db:	5e                   	pop    %esi
+  8000dc:	5f                   	pop    %edi
+  8000dd:	5d                   	pop    %ebp
+  8000de:	c3                   	ret
+
+008000df <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  8000df:	55                   	push   %ebp
+  8000e0:	89 e5                	mov    %esp,%ebp
+  8000e2:	57                   	push   %edi
+  8000e3:	56                   	push   %esi
+  8000e4:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8000e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000ea:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000ef:	89 d1                	mov    %edx,%ecx
+  8000f1:	89 d3                	mov    %edx,%ebx
+  8000f3:	89 d7                	mov    %edx,%edi
+  8000f5:	89 d6                	mov    %edx,%esi
+  8000f7:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  8000f9:	5b                   	pop    %ebx
+  8000fa:	5e                   	pop    %esi
+  8000fb:	5f                   	pop    %edi
+  8000fc:	5d                   	pop    %ebp
+  8000fd:	c3                   	ret
+
+008000fe <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8000fe:	55                   	push   %ebp
+  8000ff:	89 e5                	mov    %esp,%ebp
+  800101:	57                   	push   %edi
+  800102:	56                   	push   %esi
+  800103:	53                   	push   %ebx
+  800104:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800107:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80010c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80010f:	b8 03 00 00 00       	mov    $0x3,%eax
+  800114:	89 cb                	mov    %ecx,%ebx
+  800116:	89 cf                	mov    %ecx,%edi
+  800118:	89 ce                	mov    %ecx,%esi
+  80011a:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80011c:	85 c0                	test   %eax,%eax
+  80011e:	7f 08                	jg     800128 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800120:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800123:	5b                   	pop    %ebx
+  800124:	5e                   	pop    %esi
+  800125:	5f                   	pop    %edi
+  800126:	5d                   	pop    %ebp
+  800127:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800128:	83 ec 0c             	sub    $0xc,%esp
+  80012b:	50                   	push   %eax
+  80012c:	6a 03                	push   $0x3
+  80012e:	68 ea 2e 80 00       	push   $0x802eea
+  800133:	6a 23                	push   $0x23
+  800135:	68 07 2f 80 00       	push   $0x802f07
+  80013a:	e8 67 1f 00 00       	call   8020a6 <_panic>
+
+0080013f <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  80013f:	55                   	push   %ebp
+  800140:	89 e5                	mov    %esp,%ebp
+  800142:	57                   	push   %edi
+  800143:	56                   	push   %esi
+  800144:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800145:	ba 00 00 00 00       	mov    $0x0,%edx
+  80014a:	b8 02 00 00 00       	mov    $0x2,%eax
+  80014f:	89 d1                	mov    %edx,%ecx
+  800151:	89 d3                	mov    %edx,%ebx
+  800153:	89 d7                	mov    %edx,%edi
+  800155:	89 d6                	mov    %edx,%esi
+  800157:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800159:	5b                   	pop    %ebx
+  80015a:	5e                   	pop    %esi
+  80015b:	5f                   	pop    %edi
+  80015c:	5d                   	pop    %ebp
+  80015d:	c3                   	ret
+
+0080015e <sys_yield>:
+
+void
+sys_yield(void)
+{
+  80015e:	55                   	push   %ebp
+  80015f:	89 e5                	mov    %esp,%ebp
+  800161:	57                   	push   %edi
+  800162:	56                   	push   %esi
+  800163:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800164:	ba 00 00 00 00       	mov    $0x0,%edx
+  800169:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80016e:	89 d1                	mov    %edx,%ecx
+  800170:	89 d3                	mov    %edx,%ebx
+  800172:	89 d7                	mov    %edx,%edi
+  800174:	89 d6                	mov    %edx,%esi
+  800176:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800178:	5b                   	pop    %ebx
+  800179:	5e                   	pop    %esi
+  80017a:	5f                   	pop    %edi
+  80017b:	5d                   	pop    %ebp
+  80017c:	c3                   	ret
+
+0080017d <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  80017d:	55                   	push   %ebp
+  80017e:	89 e5                	mov    %esp,%ebp
+  800180:	57                   	push   %edi
+  800181:	56                   	push   %esi
+  800182:	53                   	push   %ebx
+  800183:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  800186:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  80018a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80018f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800192:	b8 14 00 00 00       	mov    $0x14,%eax
+  800197:	89 df                	mov    %ebx,%edi
+  800199:	89 de                	mov    %ebx,%esi
+  80019b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80019d:	85 c0                	test   %eax,%eax
+  80019f:	7f 08                	jg     8001a9 <sys_env_set_cow+0x2c>
+}
+  8001a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001a4:	5b                   	pop    %ebx
+  8001a5:	5e                   	pop    %esi
+  8001a6:	5f                   	pop    %edi
+  8001a7:	5d                   	pop    %ebp
+  8001a8:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8001a9:	83 ec 0c             	sub    $0xc,%esp
+  8001ac:	50                   	push   %eax
+  8001ad:	6a 14                	push   $0x14
+  8001af:	68 ea 2e 80 00       	push   $0x802eea
+  8001b4:	6a 23                	push   $0x23
+  8001b6:	68 07 2f 80 00       	push   $0x802f07
+  8001bb:	e8 e6 1e 00 00       	call   8020a6 <_panic>
+
+008001c0 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8001c0:	55                   	push   %ebp
+  8001c1:	89 e5                	mov    %esp,%ebp
+  8001c3:	57                   	push   %edi
+  8001c4:	56                   	push   %esi
+  8001c5:	53                   	push   %ebx
+  8001c6:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8001c9:	be 00 00 00 00       	mov    $0x0,%esi
+  8001ce:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001d1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001d4:	b8 04 00 00 00       	mov    $0x4,%eax
+  8001d9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001dc:	89 f7                	mov    %esi,%edi
+  8001de:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8001e0:	85 c0                	test   %eax,%eax
+  8001e2:	7f 08                	jg     8001ec <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  8001e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001e7:	5b                   	pop    %ebx
+  8001e8:	5e                   	pop    %esi
+  8001e9:	5f                   	pop    %edi
+  8001ea:	5d                   	pop    %ebp
+  8001eb:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8001ec:	83 ec 0c             	sub    $0xc,%esp
+  8001ef:	50                   	push   %eax
+  8001f0:	6a 04                	push   $0x4
+  8001f2:	68 ea 2e 80 00       	push   $0x802eea
+  8001f7:	6a 23                	push   $0x23
+  8001f9:	68 07 2f 80 00       	push   $0x802f07
+  8001fe:	e8 a3 1e 00 00       	call   8020a6 <_panic>
+
+00800203 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800203:	55                   	push   %ebp
+  800204:	89 e5                	mov    %esp,%ebp
+  800206:	57                   	push   %edi
+  800207:	56                   	push   %esi
+  800208:	53                   	push   %ebx
+  800209:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80020c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80020f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800212:	b8 05 00 00 00       	mov    $0x5,%eax
+  800217:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80021a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80021d:	8b 75 18             	mov    0x18(%ebp),%esi
+  800220:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800222:	85 c0                	test   %eax,%eax
+  800224:	7f 08                	jg     80022e <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  800226:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800229:	5b                   	pop    %ebx
+  80022a:	5e                   	pop    %esi
+  80022b:	5f                   	pop    %edi
+  80022c:	5d                   	pop    %ebp
+  80022d:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80022e:	83 ec 0c             	sub    $0xc,%esp
+  800231:	50                   	push   %eax
+  800232:	6a 05                	push   $0x5
+  800234:	68 ea 2e 80 00       	push   $0x802eea
+  800239:	6a 23                	push   $0x23
+  80023b:	68 07 2f 80 00       	push   $0x802f07
+  800240:	e8 61 1e 00 00       	call   8020a6 <_panic>
+
+00800245 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800245:	55                   	push   %ebp
+  800246:	89 e5                	mov    %esp,%ebp
+  800248:	57                   	push   %edi
+  800249:	56                   	push   %esi
+  80024a:	53                   	push   %ebx
+  80024b:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80024e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800253:	8b 55 08             	mov    0x8(%ebp),%edx
+  800256:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800259:	b8 06 00 00 00       	mov    $0x6,%eax
+  80025e:	89 df                	mov    %ebx,%edi
+  800260:	89 de                	mov    %ebx,%esi
+  800262:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800264:	85 c0                	test   %eax,%eax
+  800266:	7f 08                	jg     800270 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  800268:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80026b:	5b                   	pop    %ebx
+  80026c:	5e                   	pop    %esi
+  80026d:	5f                   	pop    %edi
+  80026e:	5d                   	pop    %ebp
+  80026f:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800270:	83 ec 0c             	sub    $0xc,%esp
+  800273:	50                   	push   %eax
+  800274:	6a 06                	push   $0x6
+  800276:	68 ea 2e 80 00       	push   $0x802eea
+  80027b:	6a 23                	push   $0x23
+  80027d:	68 07 2f 80 00       	push   $0x802f07
+  800282:	e8 1f 1e 00 00       	call   8020a6 <_panic>
+
+00800287 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  800287:	55                   	push   %ebp
+  800288:	89 e5                	mov    %esp,%ebp
+  80028a:	57                   	push   %edi
+  80028b:	56                   	push   %esi
+  80028c:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80028d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800290:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800293:	b8 11 00 00 00       	mov    $0x11,%eax
+  800298:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80029b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80029e:	8b 75 18             	mov    0x18(%ebp),%esi
+  8002a1:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  8002a3:	5b                   	pop    %ebx
+  8002a4:	5e                   	pop    %esi
+  8002a5:	5f                   	pop    %edi
+  8002a6:	5d                   	pop    %ebp
+  8002a7:	c3                   	ret
+
+008002a8 <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  8002a8:	55                   	push   %ebp
+  8002a9:	89 e5                	mov    %esp,%ebp
+  8002ab:	57                   	push   %edi
+  8002ac:	56                   	push   %esi
+  8002ad:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8002ae:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002b1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002b4:	b8 12 00 00 00       	mov    $0x12,%eax
+  8002b9:	be 00 00 00 00       	mov    $0x0,%esi
+  8002be:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8002c1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8002c4:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  8002c6:	5b                   	pop    %ebx
+  8002c7:	5e                   	pop    %esi
+  8002c8:	5f                   	pop    %edi
+  8002c9:	5d                   	pop    %ebp
+  8002ca:	c3                   	ret
+
+008002cb <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  8002cb:	55                   	push   %ebp
+  8002cc:	89 e5                	mov    %esp,%ebp
+  8002ce:	57                   	push   %edi
+  8002cf:	56                   	push   %esi
+  8002d0:	53                   	push   %ebx
+  8002d1:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8002d4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002d9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002dc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002df:	b8 16 00 00 00       	mov    $0x16,%eax
+  8002e4:	89 df                	mov    %ebx,%edi
+  8002e6:	89 de                	mov    %ebx,%esi
+  8002e8:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8002ea:	85 c0                	test   %eax,%eax
+  8002ec:	7f 08                	jg     8002f6 <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  8002ee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002f1:	5b                   	pop    %ebx
+  8002f2:	5e                   	pop    %esi
+  8002f3:	5f                   	pop    %edi
+  8002f4:	5d                   	pop    %ebp
+  8002f5:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8002f6:	83 ec 0c             	sub    $0xc,%esp
+  8002f9:	50                   	push   %eax
+  8002fa:	6a 16                	push   $0x16
+  8002fc:	68 ea 2e 80 00       	push   $0x802eea
+  800301:	6a 23                	push   $0x23
+  800303:	68 07 2f 80 00       	push   $0x802f07
+  800308:	e8 99 1d 00 00       	call   8020a6 <_panic>
+
+0080030d <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  80030d:	55                   	push   %ebp
+  80030e:	89 e5                	mov    %esp,%ebp
+  800310:	57                   	push   %edi
+  800311:	56                   	push   %esi
+  800312:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800313:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800318:	8b 55 08             	mov    0x8(%ebp),%edx
+  80031b:	b8 17 00 00 00       	mov    $0x17,%eax
+  800320:	89 cb                	mov    %ecx,%ebx
+  800322:	89 cf                	mov    %ecx,%edi
+  800324:	89 ce                	mov    %ecx,%esi
+  800326:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  800328:	5b                   	pop    %ebx
+  800329:	5e                   	pop    %esi
+  80032a:	5f                   	pop    %edi
+  80032b:	5d                   	pop    %ebp
+  80032c:	c3                   	ret
+
+0080032d <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  80032d:	55                   	push   %ebp
+  80032e:	89 e5                	mov    %esp,%ebp
+  800330:	57                   	push   %edi
+  800331:	56                   	push   %esi
+  800332:	53                   	push   %ebx
+  800333:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800336:	be 00 00 00 00       	mov    $0x0,%esi
+  80033b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80033e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800341:	b8 18 00 00 00       	mov    $0x18,%eax
+  800346:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800349:	89 f7                	mov    %esi,%edi
+  80034b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80034d:	85 c0                	test   %eax,%eax
+  80034f:	7f 08                	jg     800359 <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  800351:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800354:	5b                   	pop    %ebx
+  800355:	5e                   	pop    %esi
+  800356:	5f                   	pop    %edi
+  800357:	5d                   	pop    %ebp
+  800358:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800359:	83 ec 0c             	sub    $0xc,%esp
+  80035c:	50                   	push   %eax
+  80035d:	6a 18                	push   $0x18
+  80035f:	68 ea 2e 80 00       	push   $0x802eea
+  800364:	6a 23                	push   $0x23
+  800366:	68 07 2f 80 00       	push   $0x802f07
+  80036b:	e8 36 1d 00 00       	call   8020a6 <_panic>
+
+00800370 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  800370:	55                   	push   %ebp
+  800371:	89 e5                	mov    %esp,%ebp
+  800373:	57                   	push   %edi
+  800374:	56                   	push   %esi
+  800375:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800376:	be 00 00 00 00       	mov    $0x0,%esi
+  80037b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80037e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800381:	b8 19 00 00 00       	mov    $0x19,%eax
+  800386:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800389:	89 f7                	mov    %esi,%edi
+  80038b:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  80038d:	5b                   	pop    %ebx
+  80038e:	5e                   	pop    %esi
+  80038f:	5f                   	pop    %edi
+  800390:	5d                   	pop    %ebp
+  800391:	c3                   	ret
+
+00800392 <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  800392:	55                   	push   %ebp
+  800393:	89 e5                	mov    %esp,%ebp
+  800395:	57                   	push   %edi
+  800396:	56                   	push   %esi
+  800397:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800398:	ba 00 00 00 00       	mov    $0x0,%edx
+  80039d:	b8 15 00 00 00       	mov    $0x15,%eax
+  8003a2:	89 d1                	mov    %edx,%ecx
+  8003a4:	89 d3                	mov    %edx,%ebx
+  8003a6:	89 d7                	mov    %edx,%edi
+  8003a8:	89 d6                	mov    %edx,%esi
+  8003aa:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8003ac:	5b                   	pop    %ebx
+  8003ad:	5e                   	pop    %esi
+  8003ae:	5f                   	pop    %edi
+  8003af:	5d                   	pop    %ebp
+  8003b0:	c3                   	ret
+
+008003b1 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8003b1:	55                   	push   %ebp
+  8003b2:	89 e5                	mov    %esp,%ebp
+  8003b4:	57                   	push   %edi
+  8003b5:	56                   	push   %esi
+  8003b6:	53                   	push   %ebx
+  8003b7:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8003ba:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003c2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003c5:	b8 08 00 00 00       	mov    $0x8,%eax
+  8003ca:	89 df                	mov    %ebx,%edi
+  8003cc:	89 de                	mov    %ebx,%esi
+  8003ce:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8003d0:	85 c0                	test   %eax,%eax
+  8003d2:	7f 08                	jg     8003dc <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8003d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003d7:	5b                   	pop    %ebx
+  8003d8:	5e                   	pop    %esi
+  8003d9:	5f                   	pop    %edi
+  8003da:	5d                   	pop    %ebp
+  8003db:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8003dc:	83 ec 0c             	sub    $0xc,%esp
+  8003df:	50                   	push   %eax
+  8003e0:	6a 08                	push   $0x8
+  8003e2:	68 ea 2e 80 00       	push   $0x802eea
+  8003e7:	6a 23                	push   $0x23
+  8003e9:	68 07 2f 80 00       	push   $0x802f07
+  8003ee:	e8 b3 1c 00 00       	call   8020a6 <_panic>
+
+008003f3 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8003f3:	55                   	push   %ebp
+  8003f4:	89 e5                	mov    %esp,%ebp
+  8003f6:	57                   	push   %edi
+  8003f7:	56                   	push   %esi
+  8003f8:	53                   	push   %ebx
+  8003f9:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8003fc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800401:	8b 55 08             	mov    0x8(%ebp),%edx
+  800404:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800407:	b8 09 00 00 00       	mov    $0x9,%eax
+  80040c:	89 df                	mov    %ebx,%edi
+  80040e:	89 de                	mov    %ebx,%esi
+  800410:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800412:	85 c0                	test   %eax,%eax
+  800414:	7f 08                	jg     80041e <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  800416:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800419:	5b                   	pop    %ebx
+  80041a:	5e                   	pop    %esi
+  80041b:	5f                   	pop    %edi
+  80041c:	5d                   	pop    %ebp
+  80041d:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80041e:	83 ec 0c             	sub    $0xc,%esp
+  800421:	50                   	push   %eax
+  800422:	6a 09                	push   $0x9
+  800424:	68 ea 2e 80 00       	push   $0x802eea
+  800429:	6a 23                	push   $0x23
+  80042b:	68 07 2f 80 00       	push   $0x802f07
+  800430:	e8 71 1c 00 00       	call   8020a6 <_panic>
+
+00800435 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800435:	55                   	push   %ebp
+  800436:	89 e5                	mov    %esp,%ebp
+  800438:	57                   	push   %edi
+  800439:	56                   	push   %esi
+  80043a:	53                   	push   %ebx
+  80043b:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80043e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800443:	8b 55 08             	mov    0x8(%ebp),%edx
+  800446:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800449:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80044e:	89 df                	mov    %ebx,%edi
+  800450:	89 de                	mov    %ebx,%esi
+  800452:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800454:	85 c0                	test   %eax,%eax
+  800456:	7f 08                	jg     800460 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  800458:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80045b:	5b                   	pop    %ebx
+  80045c:	5e                   	pop    %esi
+  80045d:	5f                   	pop    %edi
+  80045e:	5d                   	pop    %ebp
+  80045f:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800460:	83 ec 0c             	sub    $0xc,%esp
+  800463:	50                   	push   %eax
+  800464:	6a 0a                	push   $0xa
+  800466:	68 ea 2e 80 00       	push   $0x802eea
+  80046b:	6a 23                	push   $0x23
+  80046d:	68 07 2f 80 00       	push   $0x802f07
+  800472:	e8 2f 1c 00 00       	call   8020a6 <_panic>
+
+00800477 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  800477:	55                   	push   %ebp
+  800478:	89 e5                	mov    %esp,%ebp
+  80047a:	57                   	push   %edi
+  80047b:	56                   	push   %esi
+  80047c:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80047d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800480:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800483:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800488:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80048b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80048e:	8b 75 18             	mov    0x18(%ebp),%esi
+  800491:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  800493:	5b                   	pop    %ebx
+  800494:	5e                   	pop    %esi
+  800495:	5f                   	pop    %edi
+  800496:	5d                   	pop    %ebp
+  800497:	c3                   	ret
+
+00800498 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  800498:	55                   	push   %ebp
+  800499:	89 e5                	mov    %esp,%ebp
+  80049b:	57                   	push   %edi
+  80049c:	56                   	push   %esi
+  80049d:	53                   	push   %ebx
+  80049e:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8004a1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8004a6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004a9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004ac:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8004b1:	89 df                	mov    %ebx,%edi
+  8004b3:	89 de                	mov    %ebx,%esi
+  8004b5:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8004b7:	85 c0                	test   %eax,%eax
+  8004b9:	7f 08                	jg     8004c3 <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  8004bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004be:	5b                   	pop    %ebx
+  8004bf:	5e                   	pop    %esi
+  8004c0:	5f                   	pop    %edi
+  8004c1:	5d                   	pop    %ebp
+  8004c2:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8004c3:	83 ec 0c             	sub    $0xc,%esp
+  8004c6:	50                   	push   %eax
+  8004c7:	6a 0d                	push   $0xd
+  8004c9:	68 ea 2e 80 00       	push   $0x802eea
+  8004ce:	6a 23                	push   $0x23
+  8004d0:	68 07 2f 80 00       	push   $0x802f07
+  8004d5:	e8 cc 1b 00 00       	call   8020a6 <_panic>
+
+008004da <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  8004da:	55                   	push   %ebp
+  8004db:	89 e5                	mov    %esp,%ebp
+  8004dd:	57                   	push   %edi
+  8004de:	56                   	push   %esi
+  8004df:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8004e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004e5:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8004ea:	89 d1                	mov    %edx,%ecx
+  8004ec:	89 d3                	mov    %edx,%ebx
+  8004ee:	89 d7                	mov    %edx,%edi
+  8004f0:	89 d6                	mov    %edx,%esi
+  8004f2:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8004f4:	5b                   	pop    %ebx
+  8004f5:	5e                   	pop    %esi
+  8004f6:	5f                   	pop    %edi
+  8004f7:	5d                   	pop    %ebp
+  8004f8:	c3                   	ret
+
+008004f9 <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  8004f9:	55                   	push   %ebp
+  8004fa:	89 e5                	mov    %esp,%ebp
+  8004fc:	57                   	push   %edi
+  8004fd:	56                   	push   %esi
+  8004fe:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8004ff:	8b 55 08             	mov    0x8(%ebp),%edx
+  800502:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800505:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80050a:	be 00 00 00 00       	mov    $0x0,%esi
+  80050f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800512:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800515:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  800517:	5b                   	pop    %ebx
+  800518:	5e                   	pop    %esi
+  800519:	5f                   	pop    %edi
+  80051a:	5d                   	pop    %ebp
+  80051b:	c3                   	ret
+
+0080051c <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  80051c:	55                   	push   %ebp
+  80051d:	89 e5                	mov    %esp,%ebp
+  80051f:	57                   	push   %edi
+  800520:	56                   	push   %esi
+  800521:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800522:	be 00 00 00 00       	mov    $0x0,%esi
+  800527:	8b 55 08             	mov    0x8(%ebp),%edx
+  80052a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80052d:	b8 10 00 00 00       	mov    $0x10,%eax
+  800532:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800535:	89 f7                	mov    %esi,%edi
+  800537:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  800539:	5b                   	pop    %ebx
+  80053a:	5e                   	pop    %esi
+  80053b:	5f                   	pop    %edi
+  80053c:	5d                   	pop    %ebp
+  80053d:	c3                   	ret
+
+0080053e <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  80053e:	55                   	push   %ebp
+  80053f:	89 e5                	mov    %esp,%ebp
+  800541:	57                   	push   %edi
+  800542:	56                   	push   %esi
+  800543:	53                   	push   %ebx
+  800544:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  800547:	80 3d 48 57 80 00 00 	cmpb   $0x0,0x805748
+  80054e:	74 41                	je     800591 <sys_batch+0x53>
+  800550:	8b 45 08             	mov    0x8(%ebp),%eax
+  800553:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  800556:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  80055d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800560:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  800563:	7d 45                	jge    8005aa <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  800565:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800568:	8b 06                	mov    (%esi),%eax
+  80056a:	8b 56 04             	mov    0x4(%esi),%edx
+  80056d:	8b 4e 08             	mov    0x8(%esi),%ecx
+  800570:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  800573:	8b 7e 10             	mov    0x10(%esi),%edi
+  800576:	8b 76 14             	mov    0x14(%esi),%esi
+  800579:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  80057b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80057e:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  800581:	83 c6 1c             	add    $0x1c,%esi
+  800584:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  800587:	85 c0                	test   %eax,%eax
+  800589:	78 1f                	js     8005aa <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  80058b:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  80058f:	eb cc                	jmp    80055d <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  800591:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800596:	b8 13 00 00 00       	mov    $0x13,%eax
+  80059b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80059e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8005a1:	89 df                	mov    %ebx,%edi
+  8005a3:	89 de                	mov    %ebx,%esi
+  8005a5:	cd 30                	int    $0x30
+  8005a7:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  8005aa:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8005ad:	83 c4 08             	add    $0x8,%esp
+  8005b0:	5b                   	pop    %ebx
+  8005b1:	5e                   	pop    %esi
+  8005b2:	5f                   	pop    %edi
+  8005b3:	5d                   	pop    %ebp
+  8005b4:	c3                   	ret
+
+008005b5 <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  8005b5:	55                   	push   %ebp
+  8005b6:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  8005b8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8005bb:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8005c1:	5d                   	pop    %ebp
+  8005c2:	c3                   	ret
+
+008005c3 <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  8005c3:	55                   	push   %ebp
+  8005c4:	89 e5                	mov    %esp,%ebp
+  8005c6:	56                   	push   %esi
+  8005c7:	53                   	push   %ebx
+  8005c8:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  8005cb:	8b 1e                	mov    (%esi),%ebx
+  8005cd:	85 db                	test   %ebx,%ebx
+  8005cf:	75 09                	jne    8005da <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  8005d1:	89 d8                	mov    %ebx,%eax
+  8005d3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8005d6:	5b                   	pop    %ebx
+  8005d7:	5e                   	pop    %esi
+  8005d8:	5d                   	pop    %ebp
+  8005d9:	c3                   	ret
+  b->sb_n = 0;
+  8005da:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  8005e0:	53                   	push   %ebx
+  8005e1:	8d 46 04             	lea    0x4(%esi),%eax
+  8005e4:	50                   	push   %eax
+  8005e5:	e8 54 ff ff ff       	call   80053e <sys_batch>
+  8005ea:	83 c4 08             	add    $0x8,%esp
+  8005ed:	85 c0                	test   %eax,%eax
+  8005ef:	78 1e                	js     80060f <sysbatch_flush+0x4c>
+  if (r < n)
+  8005f1:	39 c3                	cmp    %eax,%ebx
+  8005f3:	7f 07                	jg     8005fc <sysbatch_flush+0x39>
+  return 0;
+  8005f5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005fa:	eb d5                	jmp    8005d1 <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  8005fc:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8005ff:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  800603:	85 db                	test   %ebx,%ebx
+  800605:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80060a:	0f 49 d8             	cmovns %eax,%ebx
+  80060d:	eb c2                	jmp    8005d1 <sysbatch_flush+0xe>
+    return r;
+  80060f:	89 c3                	mov    %eax,%ebx
+  800611:	eb be                	jmp    8005d1 <sysbatch_flush+0xe>
+
+00800613 <sysbatch_add>:
+{
+  800613:	55                   	push   %ebp
+  800614:	89 e5                	mov    %esp,%ebp
+  800616:	53                   	push   %ebx
+  800617:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  80061a:	83 3b 40             	cmpl   $0x40,(%ebx)
+  80061d:	74 41                	je     800660 <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  80061f:	8b 03                	mov    (%ebx),%eax
+  800621:	8d 50 01             	lea    0x1(%eax),%edx
+  800624:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  800626:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  800629:	01 d8                	add    %ebx,%eax
+  80062b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80062e:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  800631:	8b 55 10             	mov    0x10(%ebp),%edx
+  800634:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  800637:	8b 55 14             	mov    0x14(%ebp),%edx
+  80063a:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  80063d:	8b 55 18             	mov    0x18(%ebp),%edx
+  800640:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  800643:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  800646:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  800649:	8b 55 20             	mov    0x20(%ebp),%edx
+  80064c:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  80064f:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  800656:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80065b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80065e:	c9                   	leave
+  80065f:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  800660:	53                   	push   %ebx
+  800661:	e8 5d ff ff ff       	call   8005c3 <sysbatch_flush>
+  800666:	83 c4 04             	add    $0x4,%esp
+  800669:	85 c0                	test   %eax,%eax
+  80066b:	79 b2                	jns    80061f <sysbatch_add+0xc>
+  80066d:	eb ec                	jmp    80065b <sysbatch_add+0x48>
+
+0080066f <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  80066f:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  800670:	a1 00 70 80 00       	mov    0x807000,%eax
+	call *%eax
+  800675:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  800677:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+  movl 48(%esp), %eax       // move trap time esp to eax
+  80067a:	8b 44 24 30          	mov    0x30(%esp),%eax
+  subl $4, %eax             // make room for eip on trap time esp
+  80067e:	83 e8 04             	sub    $0x4,%eax
+  movl %eax, 48(%esp)       // move value to esp
+  800681:	89 44 24 30          	mov    %eax,0x30(%esp)
+  movl 40(%esp), %ebx       // move trap time eip to ebx
+  800685:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+  movl %ebx, 0(%eax)
+  800689:	89 18                	mov    %ebx,(%eax)
+
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+  addl $0x08,%esp
+  80068b:	83 c4 08             	add    $0x8,%esp
+  popal
+  80068e:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+  addl $4, %esp          // skip tf->eip
+  80068f:	83 c4 04             	add    $0x4,%esp
+  popf                 // pop stack value into flags register
+  800692:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+  popl %esp
+  800693:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+  ret
+  800694:	c3                   	ret
+
+00800695 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800695:	55                   	push   %ebp
+  800696:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  800698:	8b 45 08             	mov    0x8(%ebp),%eax
+  80069b:	05 00 00 00 30       	add    $0x30000000,%eax
+  8006a0:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8006a3:	5d                   	pop    %ebp
+  8006a4:	c3                   	ret
+
+008006a5 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8006a5:	55                   	push   %ebp
+  8006a6:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8006a8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006ab:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  8006ae:	66 b8 00 00          	mov    $0x0,%ax
+  8006b2:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8006b7:	5d                   	pop    %ebp
+  8006b8:	c3                   	ret
+
+008006b9 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8006b9:	55                   	push   %ebp
+  8006ba:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  8006bc:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8006c1:	eb 02                	jmp    8006c5 <fd_alloc+0xc>
+  8006c3:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8006c5:	89 c2                	mov    %eax,%edx
+  8006c7:	c1 ea 16             	shr    $0x16,%edx
+  8006ca:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8006d1:	f6 c2 01             	test   $0x1,%dl
+  8006d4:	74 2b                	je     800701 <fd_alloc+0x48>
+  8006d6:	89 c2                	mov    %eax,%edx
+  8006d8:	c1 ea 0c             	shr    $0xc,%edx
+  8006db:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8006e2:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8006e8:	f6 c1 01             	test   $0x1,%cl
+  8006eb:	74 14                	je     800701 <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  8006ed:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8006f3:	75 ce                	jne    8006c3 <fd_alloc+0xa>
+  8006f5:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  8006fa:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8006ff:	eb 05                	jmp    800706 <fd_alloc+0x4d>
+      return 0;
+  800701:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  800706:	8b 55 08             	mov    0x8(%ebp),%edx
+  800709:	89 02                	mov    %eax,(%edx)
+}
+  80070b:	89 c8                	mov    %ecx,%eax
+  80070d:	5d                   	pop    %ebp
+  80070e:	c3                   	ret
+
+0080070f <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80070f:	55                   	push   %ebp
+  800710:	89 e5                	mov    %esp,%ebp
+  800712:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  800715:	83 f8 1f             	cmp    $0x1f,%eax
+  800718:	77 30                	ja     80074a <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  80071a:	c1 e0 0c             	shl    $0xc,%eax
+  80071d:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  800722:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  800728:	f6 c2 01             	test   $0x1,%dl
+  80072b:	74 24                	je     800751 <fd_lookup+0x42>
+  80072d:	89 c2                	mov    %eax,%edx
+  80072f:	c1 ea 0c             	shr    $0xc,%edx
+  800732:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800739:	f6 c2 01             	test   $0x1,%dl
+  80073c:	74 1a                	je     800758 <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  80073e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800741:	89 02                	mov    %eax,(%edx)
+  return 0;
+  800743:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800748:	5d                   	pop    %ebp
+  800749:	c3                   	ret
+    return -E_INVAL;
+  80074a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80074f:	eb f7                	jmp    800748 <fd_lookup+0x39>
+    return -E_INVAL;
+  800751:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800756:	eb f0                	jmp    800748 <fd_lookup+0x39>
+  800758:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80075d:	eb e9                	jmp    800748 <fd_lookup+0x39>
+
+0080075f <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80075f:	55                   	push   %ebp
+  800760:	89 e5                	mov    %esp,%ebp
+  800762:	53                   	push   %ebx
+  800763:	83 ec 04             	sub    $0x4,%esp
+  800766:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  800769:	b8 94 2f 80 00       	mov    $0x802f94,%eax
+  80076e:	8b 18                	mov    (%eax),%ebx
+  800770:	85 db                	test   %ebx,%ebx
+  800772:	74 0e                	je     800782 <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  800774:	83 c0 04             	add    $0x4,%eax
+  800777:	39 13                	cmp    %edx,(%ebx)
+  800779:	75 f3                	jne    80076e <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  80077b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800780:	eb 1f                	jmp    8007a1 <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800782:	a1 44 57 80 00       	mov    0x805744,%eax
+  800787:	8b 40 48             	mov    0x48(%eax),%eax
+  80078a:	83 ec 04             	sub    $0x4,%esp
+  80078d:	52                   	push   %edx
+  80078e:	50                   	push   %eax
+  80078f:	68 18 2f 80 00       	push   $0x802f18
+  800794:	e8 e8 19 00 00       	call   802181 <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  800799:	83 c4 10             	add    $0x10,%esp
+  80079c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  8007a1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007a4:	89 1a                	mov    %ebx,(%edx)
+}
+  8007a6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007a9:	c9                   	leave
+  8007aa:	c3                   	ret
+
+008007ab <fd_close>:
+{
+  8007ab:	55                   	push   %ebp
+  8007ac:	89 e5                	mov    %esp,%ebp
+  8007ae:	57                   	push   %edi
+  8007af:	56                   	push   %esi
+  8007b0:	53                   	push   %ebx
+  8007b1:	83 ec 24             	sub    $0x24,%esp
+  8007b4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007b7:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8007ba:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8007bd:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8007be:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8007c4:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8007c7:	50                   	push   %eax
+  8007c8:	e8 42 ff ff ff       	call   80070f <fd_lookup>
+  8007cd:	89 c3                	mov    %eax,%ebx
+  8007cf:	83 c4 10             	add    $0x10,%esp
+  8007d2:	85 c0                	test   %eax,%eax
+  8007d4:	78 05                	js     8007db <fd_close+0x30>
+      || fd != fd2)
+  8007d6:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8007d9:	74 16                	je     8007f1 <fd_close+0x46>
+    return must_exist ? r : 0;
+  8007db:	89 f8                	mov    %edi,%eax
+  8007dd:	84 c0                	test   %al,%al
+  8007df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007e4:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8007e7:	89 d8                	mov    %ebx,%eax
+  8007e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007ec:	5b                   	pop    %ebx
+  8007ed:	5e                   	pop    %esi
+  8007ee:	5f                   	pop    %edi
+  8007ef:	5d                   	pop    %ebp
+  8007f0:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8007f1:	83 ec 08             	sub    $0x8,%esp
+  8007f4:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8007f7:	50                   	push   %eax
+  8007f8:	ff 36                	push   (%esi)
+  8007fa:	e8 60 ff ff ff       	call   80075f <dev_lookup>
+  8007ff:	89 c3                	mov    %eax,%ebx
+  800801:	83 c4 10             	add    $0x10,%esp
+  800804:	85 c0                	test   %eax,%eax
+  800806:	78 1a                	js     800822 <fd_close+0x77>
+    if (dev->dev_close)
+  800808:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80080b:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  80080e:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  800813:	85 c0                	test   %eax,%eax
+  800815:	74 0b                	je     800822 <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  800817:	83 ec 0c             	sub    $0xc,%esp
+  80081a:	56                   	push   %esi
+  80081b:	ff d0                	call   *%eax
+  80081d:	89 c3                	mov    %eax,%ebx
+  80081f:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  800822:	83 ec 08             	sub    $0x8,%esp
+  800825:	56                   	push   %esi
+  800826:	6a 00                	push   $0x0
+  800828:	e8 18 fa ff ff       	call   800245 <sys_page_unmap>
+  return r;
+  80082d:	83 c4 10             	add    $0x10,%esp
+  800830:	eb b5                	jmp    8007e7 <fd_close+0x3c>
+
+00800832 <close>:
+
+int
+close(int fdnum)
+{
+  800832:	55                   	push   %ebp
+  800833:	89 e5                	mov    %esp,%ebp
+  800835:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800838:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80083b:	50                   	push   %eax
+  80083c:	ff 75 08             	push   0x8(%ebp)
+  80083f:	e8 cb fe ff ff       	call   80070f <fd_lookup>
+  800844:	83 c4 10             	add    $0x10,%esp
+  800847:	85 c0                	test   %eax,%eax
+  800849:	79 02                	jns    80084d <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  80084b:	c9                   	leave
+  80084c:	c3                   	ret
+    return fd_close(fd, 1);
+  80084d:	83 ec 08             	sub    $0x8,%esp
+  800850:	6a 01                	push   $0x1
+  800852:	ff 75 f4             	push   -0xc(%ebp)
+  800855:	e8 51 ff ff ff       	call   8007ab <fd_close>
+  80085a:	83 c4 10             	add    $0x10,%esp
+  80085d:	eb ec                	jmp    80084b <close+0x19>
+
+0080085f <close_all>:
+
+void
+close_all(void)
+{
+  80085f:	55                   	push   %ebp
+  800860:	89 e5                	mov    %esp,%ebp
+  800862:	53                   	push   %ebx
+  800863:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  800866:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  80086b:	83 ec 0c             	sub    $0xc,%esp
+  80086e:	53                   	push   %ebx
+  80086f:	e8 be ff ff ff       	call   800832 <close>
+  for (i = 0; i < MAXFD; i++)
+  800874:	83 c3 01             	add    $0x1,%ebx
+  800877:	83 c4 10             	add    $0x10,%esp
+  80087a:	83 fb 20             	cmp    $0x20,%ebx
+  80087d:	75 ec                	jne    80086b <close_all+0xc>
+}
+  80087f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800882:	c9                   	leave
+  800883:	c3                   	ret
+
+00800884 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  800884:	55                   	push   %ebp
+  800885:	89 e5                	mov    %esp,%ebp
+  800887:	57                   	push   %edi
+  800888:	56                   	push   %esi
+  800889:	53                   	push   %ebx
+  80088a:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80088d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800890:	50                   	push   %eax
+  800891:	ff 75 08             	push   0x8(%ebp)
+  800894:	e8 76 fe ff ff       	call   80070f <fd_lookup>
+  800899:	89 c6                	mov    %eax,%esi
+  80089b:	83 c4 10             	add    $0x10,%esp
+  80089e:	85 c0                	test   %eax,%eax
+  8008a0:	0f 88 0a 01 00 00    	js     8009b0 <dup+0x12c>
+    return r;
+  close(newfdnum);
+  8008a6:	83 ec 0c             	sub    $0xc,%esp
+  8008a9:	ff 75 0c             	push   0xc(%ebp)
+  8008ac:	e8 81 ff ff ff       	call   800832 <close>
+
+  newfd = INDEX2FD(newfdnum);
+  8008b1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8008b4:	c1 e0 0c             	shl    $0xc,%eax
+  8008b7:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  8008bd:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  8008c0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8008c3:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8008c6:	89 04 24             	mov    %eax,(%esp)
+  8008c9:	e8 d7 fd ff ff       	call   8006a5 <fd2data>
+  8008ce:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  8008d0:	89 3c 24             	mov    %edi,(%esp)
+  8008d3:	e8 cd fd ff ff       	call   8006a5 <fd2data>
+  8008d8:	83 c4 10             	add    $0x10,%esp
+  8008db:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8008de:	89 f3                	mov    %esi,%ebx
+  8008e0:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  8008e6:	89 c6                	mov    %eax,%esi
+  8008e8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8008eb:	89 cf                	mov    %ecx,%edi
+  8008ed:	eb 0c                	jmp    8008fb <dup+0x77>
+  8008ef:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8008f5:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8008fb:	39 fb                	cmp    %edi,%ebx
+  8008fd:	74 7b                	je     80097a <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  8008ff:	89 d8                	mov    %ebx,%eax
+  800901:	c1 e8 16             	shr    $0x16,%eax
+  800904:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80090b:	a8 01                	test   $0x1,%al
+  80090d:	74 e0                	je     8008ef <dup+0x6b>
+  80090f:	89 d8                	mov    %ebx,%eax
+  800911:	c1 e8 0c             	shr    $0xc,%eax
+  800914:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80091b:	f6 c2 01             	test   $0x1,%dl
+  80091e:	74 cf                	je     8008ef <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  800920:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  800927:	83 ec 0c             	sub    $0xc,%esp
+  80092a:	25 07 0e 00 00       	and    $0xe07,%eax
+  80092f:	50                   	push   %eax
+  800930:	56                   	push   %esi
+  800931:	6a 00                	push   $0x0
+  800933:	53                   	push   %ebx
+  800934:	6a 00                	push   $0x0
+  800936:	e8 c8 f8 ff ff       	call   800203 <sys_page_map>
+  80093b:	83 c4 20             	add    $0x20,%esp
+  80093e:	85 c0                	test   %eax,%eax
+  800940:	79 ad                	jns    8008ef <dup+0x6b>
+  800942:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800945:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  800947:	83 ec 08             	sub    $0x8,%esp
+  80094a:	ff 75 d4             	push   -0x2c(%ebp)
+  80094d:	6a 00                	push   $0x0
+  80094f:	e8 f1 f8 ff ff       	call   800245 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  800954:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  800957:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  80095d:	83 c4 10             	add    $0x10,%esp
+  800960:	39 df                	cmp    %ebx,%edi
+  800962:	74 4c                	je     8009b0 <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  800964:	83 ec 08             	sub    $0x8,%esp
+  800967:	57                   	push   %edi
+  800968:	6a 00                	push   $0x0
+  80096a:	e8 d6 f8 ff ff       	call   800245 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80096f:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  800975:	83 c4 10             	add    $0x10,%esp
+  800978:	eb e6                	jmp    800960 <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80097a:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80097d:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800980:	89 c8                	mov    %ecx,%eax
+  800982:	c1 e8 0c             	shr    $0xc,%eax
+  800985:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80098c:	83 ec 0c             	sub    $0xc,%esp
+  80098f:	25 07 0e 00 00       	and    $0xe07,%eax
+  800994:	50                   	push   %eax
+  800995:	ff 75 d4             	push   -0x2c(%ebp)
+  800998:	6a 00                	push   $0x0
+  80099a:	51                   	push   %ecx
+  80099b:	6a 00                	push   $0x0
+  80099d:	e8 61 f8 ff ff       	call   800203 <sys_page_map>
+  8009a2:	89 c6                	mov    %eax,%esi
+  8009a4:	83 c4 20             	add    $0x20,%esp
+  8009a7:	85 c0                	test   %eax,%eax
+  8009a9:	78 9c                	js     800947 <dup+0xc3>
+  return newfdnum;
+  8009ab:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8009ae:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  8009b0:	89 f0                	mov    %esi,%eax
+  8009b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8009b5:	5b                   	pop    %ebx
+  8009b6:	5e                   	pop    %esi
+  8009b7:	5f                   	pop    %edi
+  8009b8:	5d                   	pop    %ebp
+  8009b9:	c3                   	ret
+
+008009ba <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8009ba:	55                   	push   %ebp
+  8009bb:	89 e5                	mov    %esp,%ebp
+  8009bd:	56                   	push   %esi
+  8009be:	53                   	push   %ebx
+  8009bf:	83 ec 18             	sub    $0x18,%esp
+  8009c2:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  8009c5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8009c8:	50                   	push   %eax
+  8009c9:	56                   	push   %esi
+  8009ca:	e8 40 fd ff ff       	call   80070f <fd_lookup>
+  8009cf:	83 c4 10             	add    $0x10,%esp
+  8009d2:	85 c0                	test   %eax,%eax
+  8009d4:	78 3c                	js     800a12 <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8009d6:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8009d9:	83 ec 08             	sub    $0x8,%esp
+  8009dc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8009df:	50                   	push   %eax
+  8009e0:	ff 33                	push   (%ebx)
+  8009e2:	e8 78 fd ff ff       	call   80075f <dev_lookup>
+  8009e7:	83 c4 10             	add    $0x10,%esp
+  8009ea:	85 c0                	test   %eax,%eax
+  8009ec:	78 24                	js     800a12 <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8009ee:	8b 43 08             	mov    0x8(%ebx),%eax
+  8009f1:	83 e0 03             	and    $0x3,%eax
+  8009f4:	83 f8 01             	cmp    $0x1,%eax
+  8009f7:	74 20                	je     800a19 <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  8009f9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009fc:	8b 40 08             	mov    0x8(%eax),%eax
+  8009ff:	85 c0                	test   %eax,%eax
+  800a01:	74 37                	je     800a3a <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  800a03:	83 ec 04             	sub    $0x4,%esp
+  800a06:	ff 75 10             	push   0x10(%ebp)
+  800a09:	ff 75 0c             	push   0xc(%ebp)
+  800a0c:	53                   	push   %ebx
+  800a0d:	ff d0                	call   *%eax
+  800a0f:	83 c4 10             	add    $0x10,%esp
+}
+  800a12:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800a15:	5b                   	pop    %ebx
+  800a16:	5e                   	pop    %esi
+  800a17:	5d                   	pop    %ebp
+  800a18:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800a19:	a1 44 57 80 00       	mov    0x805744,%eax
+  800a1e:	8b 40 48             	mov    0x48(%eax),%eax
+  800a21:	83 ec 04             	sub    $0x4,%esp
+  800a24:	56                   	push   %esi
+  800a25:	50                   	push   %eax
+  800a26:	68 59 2f 80 00       	push   $0x802f59
+  800a2b:	e8 51 17 00 00       	call   802181 <cprintf>
+    return -E_INVAL;
+  800a30:	83 c4 10             	add    $0x10,%esp
+  800a33:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a38:	eb d8                	jmp    800a12 <read+0x58>
+    return -E_NOT_SUPP;
+  800a3a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800a3f:	eb d1                	jmp    800a12 <read+0x58>
+
+00800a41 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  800a41:	55                   	push   %ebp
+  800a42:	89 e5                	mov    %esp,%ebp
+  800a44:	57                   	push   %edi
+  800a45:	56                   	push   %esi
+  800a46:	53                   	push   %ebx
+  800a47:	83 ec 0c             	sub    $0xc,%esp
+  800a4a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a4d:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  800a50:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800a55:	eb 02                	jmp    800a59 <readn+0x18>
+  800a57:	01 c3                	add    %eax,%ebx
+  800a59:	39 f3                	cmp    %esi,%ebx
+  800a5b:	73 21                	jae    800a7e <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  800a5d:	83 ec 04             	sub    $0x4,%esp
+  800a60:	89 f0                	mov    %esi,%eax
+  800a62:	29 d8                	sub    %ebx,%eax
+  800a64:	50                   	push   %eax
+  800a65:	89 d8                	mov    %ebx,%eax
+  800a67:	03 45 0c             	add    0xc(%ebp),%eax
+  800a6a:	50                   	push   %eax
+  800a6b:	57                   	push   %edi
+  800a6c:	e8 49 ff ff ff       	call   8009ba <read>
+    if (m < 0)
+  800a71:	83 c4 10             	add    $0x10,%esp
+  800a74:	85 c0                	test   %eax,%eax
+  800a76:	78 04                	js     800a7c <readn+0x3b>
+      return m;
+    if (m == 0)
+  800a78:	75 dd                	jne    800a57 <readn+0x16>
+  800a7a:	eb 02                	jmp    800a7e <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  800a7c:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  800a7e:	89 d8                	mov    %ebx,%eax
+  800a80:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a83:	5b                   	pop    %ebx
+  800a84:	5e                   	pop    %esi
+  800a85:	5f                   	pop    %edi
+  800a86:	5d                   	pop    %ebp
+  800a87:	c3                   	ret
+
+00800a88 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  800a88:	55                   	push   %ebp
+  800a89:	89 e5                	mov    %esp,%ebp
+  800a8b:	56                   	push   %esi
+  800a8c:	53                   	push   %ebx
+  800a8d:	83 ec 18             	sub    $0x18,%esp
+  800a90:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  800a93:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800a96:	50                   	push   %eax
+  800a97:	53                   	push   %ebx
+  800a98:	e8 72 fc ff ff       	call   80070f <fd_lookup>
+  800a9d:	83 c4 10             	add    $0x10,%esp
+  800aa0:	85 c0                	test   %eax,%eax
+  800aa2:	78 37                	js     800adb <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800aa4:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800aa7:	83 ec 08             	sub    $0x8,%esp
+  800aaa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800aad:	50                   	push   %eax
+  800aae:	ff 36                	push   (%esi)
+  800ab0:	e8 aa fc ff ff       	call   80075f <dev_lookup>
+  800ab5:	83 c4 10             	add    $0x10,%esp
+  800ab8:	85 c0                	test   %eax,%eax
+  800aba:	78 1f                	js     800adb <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800abc:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800ac0:	74 20                	je     800ae2 <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  800ac2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ac5:	8b 40 0c             	mov    0xc(%eax),%eax
+  800ac8:	85 c0                	test   %eax,%eax
+  800aca:	74 37                	je     800b03 <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  800acc:	83 ec 04             	sub    $0x4,%esp
+  800acf:	ff 75 10             	push   0x10(%ebp)
+  800ad2:	ff 75 0c             	push   0xc(%ebp)
+  800ad5:	56                   	push   %esi
+  800ad6:	ff d0                	call   *%eax
+  800ad8:	83 c4 10             	add    $0x10,%esp
+}
+  800adb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ade:	5b                   	pop    %ebx
+  800adf:	5e                   	pop    %esi
+  800ae0:	5d                   	pop    %ebp
+  800ae1:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800ae2:	a1 44 57 80 00       	mov    0x805744,%eax
+  800ae7:	8b 40 48             	mov    0x48(%eax),%eax
+  800aea:	83 ec 04             	sub    $0x4,%esp
+  800aed:	53                   	push   %ebx
+  800aee:	50                   	push   %eax
+  800aef:	68 75 2f 80 00       	push   $0x802f75
+  800af4:	e8 88 16 00 00       	call   802181 <cprintf>
+    return -E_INVAL;
+  800af9:	83 c4 10             	add    $0x10,%esp
+  800afc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b01:	eb d8                	jmp    800adb <write+0x53>
+    return -E_NOT_SUPP;
+  800b03:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800b08:	eb d1                	jmp    800adb <write+0x53>
+
+00800b0a <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  800b0a:	55                   	push   %ebp
+  800b0b:	89 e5                	mov    %esp,%ebp
+  800b0d:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800b10:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b13:	50                   	push   %eax
+  800b14:	ff 75 08             	push   0x8(%ebp)
+  800b17:	e8 f3 fb ff ff       	call   80070f <fd_lookup>
+  800b1c:	83 c4 10             	add    $0x10,%esp
+  800b1f:	85 c0                	test   %eax,%eax
+  800b21:	78 0e                	js     800b31 <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  800b23:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b26:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b29:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  800b2c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b31:	c9                   	leave
+  800b32:	c3                   	ret
+
+00800b33 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800b33:	55                   	push   %ebp
+  800b34:	89 e5                	mov    %esp,%ebp
+  800b36:	56                   	push   %esi
+  800b37:	53                   	push   %ebx
+  800b38:	83 ec 18             	sub    $0x18,%esp
+  800b3b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  800b3e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800b41:	50                   	push   %eax
+  800b42:	53                   	push   %ebx
+  800b43:	e8 c7 fb ff ff       	call   80070f <fd_lookup>
+  800b48:	83 c4 10             	add    $0x10,%esp
+  800b4b:	85 c0                	test   %eax,%eax
+  800b4d:	78 34                	js     800b83 <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800b4f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800b52:	83 ec 08             	sub    $0x8,%esp
+  800b55:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b58:	50                   	push   %eax
+  800b59:	ff 36                	push   (%esi)
+  800b5b:	e8 ff fb ff ff       	call   80075f <dev_lookup>
+  800b60:	83 c4 10             	add    $0x10,%esp
+  800b63:	85 c0                	test   %eax,%eax
+  800b65:	78 1c                	js     800b83 <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800b67:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800b6b:	74 1d                	je     800b8a <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  800b6d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b70:	8b 40 18             	mov    0x18(%eax),%eax
+  800b73:	85 c0                	test   %eax,%eax
+  800b75:	74 34                	je     800bab <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  800b77:	83 ec 08             	sub    $0x8,%esp
+  800b7a:	ff 75 0c             	push   0xc(%ebp)
+  800b7d:	56                   	push   %esi
+  800b7e:	ff d0                	call   *%eax
+  800b80:	83 c4 10             	add    $0x10,%esp
+}
+  800b83:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b86:	5b                   	pop    %ebx
+  800b87:	5e                   	pop    %esi
+  800b88:	5d                   	pop    %ebp
+  800b89:	c3                   	ret
+            thisenv->env_id, fdnum);
+  800b8a:	a1 44 57 80 00       	mov    0x805744,%eax
+  800b8f:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800b92:	83 ec 04             	sub    $0x4,%esp
+  800b95:	53                   	push   %ebx
+  800b96:	50                   	push   %eax
+  800b97:	68 38 2f 80 00       	push   $0x802f38
+  800b9c:	e8 e0 15 00 00       	call   802181 <cprintf>
+    return -E_INVAL;
+  800ba1:	83 c4 10             	add    $0x10,%esp
+  800ba4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ba9:	eb d8                	jmp    800b83 <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  800bab:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800bb0:	eb d1                	jmp    800b83 <ftruncate+0x50>
+
+00800bb2 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800bb2:	55                   	push   %ebp
+  800bb3:	89 e5                	mov    %esp,%ebp
+  800bb5:	56                   	push   %esi
+  800bb6:	53                   	push   %ebx
+  800bb7:	83 ec 18             	sub    $0x18,%esp
+  800bba:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  800bbd:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800bc0:	50                   	push   %eax
+  800bc1:	ff 75 08             	push   0x8(%ebp)
+  800bc4:	e8 46 fb ff ff       	call   80070f <fd_lookup>
+  800bc9:	83 c4 10             	add    $0x10,%esp
+  800bcc:	85 c0                	test   %eax,%eax
+  800bce:	78 49                	js     800c19 <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800bd0:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800bd3:	83 ec 08             	sub    $0x8,%esp
+  800bd6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800bd9:	50                   	push   %eax
+  800bda:	ff 36                	push   (%esi)
+  800bdc:	e8 7e fb ff ff       	call   80075f <dev_lookup>
+  800be1:	83 c4 10             	add    $0x10,%esp
+  800be4:	85 c0                	test   %eax,%eax
+  800be6:	78 31                	js     800c19 <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  800be8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800beb:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800bef:	74 2f                	je     800c20 <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  800bf1:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  800bf4:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800bfb:	00 00 00 
+  stat->st_isdir = 0;
+  800bfe:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800c05:	00 00 00 
+  stat->st_dev = dev;
+  800c08:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  800c0e:	83 ec 08             	sub    $0x8,%esp
+  800c11:	53                   	push   %ebx
+  800c12:	56                   	push   %esi
+  800c13:	ff 50 14             	call   *0x14(%eax)
+  800c16:	83 c4 10             	add    $0x10,%esp
+}
+  800c19:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800c1c:	5b                   	pop    %ebx
+  800c1d:	5e                   	pop    %esi
+  800c1e:	5d                   	pop    %ebp
+  800c1f:	c3                   	ret
+    return -E_NOT_SUPP;
+  800c20:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800c25:	eb f2                	jmp    800c19 <fstat+0x67>
+
+00800c27 <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  800c27:	55                   	push   %ebp
+  800c28:	89 e5                	mov    %esp,%ebp
+  800c2a:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  800c2d:	ff 75 0c             	push   0xc(%ebp)
+  800c30:	ff 75 08             	push   0x8(%ebp)
+  800c33:	e8 58 07 00 00       	call   801390 <file_stat>
+}
+  800c38:	c9                   	leave
+  800c39:	c3                   	ret
+
+00800c3a <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  800c3a:	55                   	push   %ebp
+  800c3b:	89 e5                	mov    %esp,%ebp
+  800c3d:	57                   	push   %edi
+  800c3e:	56                   	push   %esi
+  800c3f:	53                   	push   %ebx
+  800c40:	83 ec 1c             	sub    $0x1c,%esp
+  800c43:	89 c7                	mov    %eax,%edi
+  800c45:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  800c48:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  800c4b:	e9 a2 00 00 00       	jmp    800cf2 <fsipc_send+0xb8>
+  nfsenvs = 0;
+  800c50:	c7 05 00 50 80 00 00 	movl   $0x0,0x805000
+  800c57:	00 00 00 
+  800c5a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c5f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  800c64:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  800c69:	be 01 00 00 00       	mov    $0x1,%esi
+  800c6e:	eb 0f                	jmp    800c7f <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  800c70:	83 c0 01             	add    $0x1,%eax
+  800c73:	3d 00 04 00 00       	cmp    $0x400,%eax
+  800c78:	74 49                	je     800cc3 <fsipc_send+0x89>
+  800c7a:	83 f9 07             	cmp    $0x7,%ecx
+  800c7d:	7f 50                	jg     800ccf <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  800c7f:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  800c82:	c1 e2 04             	shl    $0x4,%edx
+  800c85:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800c8b:	8b 52 50             	mov    0x50(%edx),%edx
+  800c8e:	83 fa 01             	cmp    $0x1,%edx
+  800c91:	75 dd                	jne    800c70 <fsipc_send+0x36>
+  800c93:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  800c96:	c1 e2 04             	shl    $0x4,%edx
+  800c99:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800c9f:	8b 52 54             	mov    0x54(%edx),%edx
+  800ca2:	85 d2                	test   %edx,%edx
+  800ca4:	74 ca                	je     800c70 <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  800ca6:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  800ca9:	c1 e2 04             	shl    $0x4,%edx
+  800cac:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800cb2:	8b 52 48             	mov    0x48(%edx),%edx
+  800cb5:	89 14 8d 20 50 80 00 	mov    %edx,0x805020(,%ecx,4)
+  800cbc:	8d 49 01             	lea    0x1(%ecx),%ecx
+  800cbf:	89 f3                	mov    %esi,%ebx
+  800cc1:	eb ad                	jmp    800c70 <fsipc_send+0x36>
+  800cc3:	84 db                	test   %bl,%bl
+  800cc5:	74 38                	je     800cff <fsipc_send+0xc5>
+  800cc7:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  800ccd:	eb 30                	jmp    800cff <fsipc_send+0xc5>
+  800ccf:	84 db                	test   %bl,%bl
+  800cd1:	74 2c                	je     800cff <fsipc_send+0xc5>
+  800cd3:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  800cd9:	eb 24                	jmp    800cff <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  800cdb:	50                   	push   %eax
+  800cdc:	68 a4 2f 80 00       	push   $0x802fa4
+  800ce1:	6a 34                	push   $0x34
+  800ce3:	68 ae 2f 80 00       	push   $0x802fae
+  800ce8:	e8 b9 13 00 00       	call   8020a6 <_panic>
+    }
+    sys_yield();
+  800ced:	e8 6c f4 ff ff       	call   80015e <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  800cf2:	83 3d 00 50 80 00 03 	cmpl   $0x3,0x805000
+  800cf9:	0f 8e 51 ff ff ff    	jle    800c50 <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  800cff:	a1 44 57 80 00       	mov    0x805744,%eax
+  800d04:	8b 70 48             	mov    0x48(%eax),%esi
+  800d07:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  800d0d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d12:	8b 0d 00 50 80 00    	mov    0x805000,%ecx
+  800d18:	39 d9                	cmp    %ebx,%ecx
+  800d1a:	7e d1                	jle    800ced <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  800d1c:	83 ec 0c             	sub    $0xc,%esp
+  800d1f:	ff 75 e0             	push   -0x20(%ebp)
+  800d22:	6a 07                	push   $0x7
+  800d24:	ff 75 e4             	push   -0x1c(%ebp)
+  800d27:	57                   	push   %edi
+  800d28:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  800d2b:	99                   	cltd
+  800d2c:	f7 f9                	idiv   %ecx
+  800d2e:	ff 34 95 20 50 80 00 	push   0x805020(,%edx,4)
+  800d35:	e8 3d f7 ff ff       	call   800477 <sys_ipc_try_send>
+      if (r == 0)
+  800d3a:	83 c4 20             	add    $0x20,%esp
+  800d3d:	85 c0                	test   %eax,%eax
+  800d3f:	74 0a                	je     800d4b <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  800d41:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  800d44:	75 95                	jne    800cdb <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  800d46:	83 c3 01             	add    $0x1,%ebx
+  800d49:	eb c7                	jmp    800d12 <fsipc_send+0xd8>
+  }
+}
+  800d4b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d4e:	5b                   	pop    %ebx
+  800d4f:	5e                   	pop    %esi
+  800d50:	5f                   	pop    %edi
+  800d51:	5d                   	pop    %ebp
+  800d52:	c3                   	ret
+
+00800d53 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  800d53:	55                   	push   %ebp
+  800d54:	89 e5                	mov    %esp,%ebp
+  800d56:	53                   	push   %ebx
+  800d57:	83 ec 14             	sub    $0x14,%esp
+  800d5a:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  800d5c:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  800d63:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800d68:	ba 00 60 80 00       	mov    $0x806000,%edx
+  800d6d:	e8 c8 fe ff ff       	call   800c3a <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  800d72:	6a 00                	push   $0x0
+  800d74:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800d77:	50                   	push   %eax
+  800d78:	53                   	push   %ebx
+  800d79:	6a 00                	push   $0x0
+  800d7b:	e8 66 1d 00 00       	call   802ae6 <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  800d80:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d83:	c9                   	leave
+  800d84:	c3                   	ret
+
+00800d85 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  800d85:	55                   	push   %ebp
+  800d86:	89 e5                	mov    %esp,%ebp
+  800d88:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800d8b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d8e:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d91:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.set_size.req_size = newsize;
+  800d96:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d99:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  800d9e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800da3:	b8 02 00 00 00       	mov    $0x2,%eax
+  800da8:	e8 a6 ff ff ff       	call   800d53 <fsipc>
+}
+  800dad:	c9                   	leave
+  800dae:	c3                   	ret
+
+00800daf <devfile_flush>:
+{
+  800daf:	55                   	push   %ebp
+  800db0:	89 e5                	mov    %esp,%ebp
+  800db2:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800db5:	8b 45 08             	mov    0x8(%ebp),%eax
+  800db8:	8b 40 0c             	mov    0xc(%eax),%eax
+  800dbb:	a3 00 60 80 00       	mov    %eax,0x806000
+  return fsipc(FSREQ_FLUSH, NULL);
+  800dc0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dc5:	b8 06 00 00 00       	mov    $0x6,%eax
+  800dca:	e8 84 ff ff ff       	call   800d53 <fsipc>
+}
+  800dcf:	c9                   	leave
+  800dd0:	c3                   	ret
+
+00800dd1 <devfile_stat>:
+{
+  800dd1:	55                   	push   %ebp
+  800dd2:	89 e5                	mov    %esp,%ebp
+  800dd4:	53                   	push   %ebx
+  800dd5:	83 ec 04             	sub    $0x4,%esp
+  800dd8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800ddb:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dde:	8b 40 0c             	mov    0xc(%eax),%eax
+  800de1:	a3 00 60 80 00       	mov    %eax,0x806000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  800de6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800deb:	b8 05 00 00 00       	mov    $0x5,%eax
+  800df0:	e8 5e ff ff ff       	call   800d53 <fsipc>
+  800df5:	85 c0                	test   %eax,%eax
+  800df7:	78 2c                	js     800e25 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800df9:	83 ec 08             	sub    $0x8,%esp
+  800dfc:	68 00 60 80 00       	push   $0x806000
+  800e01:	53                   	push   %ebx
+  800e02:	e8 68 19 00 00       	call   80276f <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  800e07:	a1 80 60 80 00       	mov    0x806080,%eax
+  800e0c:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800e12:	a1 84 60 80 00       	mov    0x806084,%eax
+  800e17:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  800e1d:	83 c4 10             	add    $0x10,%esp
+  800e20:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e25:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e28:	c9                   	leave
+  800e29:	c3                   	ret
+
+00800e2a <fsv_alloc>:
+{
+  800e2a:	55                   	push   %ebp
+  800e2b:	89 e5                	mov    %esp,%ebp
+  800e2d:	56                   	push   %esi
+  800e2e:	53                   	push   %ebx
+  800e2f:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  800e31:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e36:	eb 22                	jmp    800e5a <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  800e38:	83 ec 04             	sub    $0x4,%esp
+  800e3b:	6a 00                	push   $0x0
+  800e3d:	6a 00                	push   $0x0
+  800e3f:	6a 07                	push   $0x7
+  800e41:	50                   	push   %eax
+  800e42:	6a 00                	push   $0x0
+  800e44:	6a 04                	push   $0x4
+  800e46:	68 40 50 80 00       	push   $0x805040
+  800e4b:	e8 c3 f7 ff ff       	call   800613 <sysbatch_add>
+  800e50:	83 c4 20             	add    $0x20,%esp
+  800e53:	85 c0                	test   %eax,%eax
+  800e55:	78 48                	js     800e9f <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  800e57:	83 c3 01             	add    $0x1,%ebx
+  800e5a:	39 f3                	cmp    %esi,%ebx
+  800e5c:	74 31                	je     800e8f <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  800e5e:	89 d8                	mov    %ebx,%eax
+  800e60:	c1 e0 0c             	shl    $0xc,%eax
+  800e63:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  800e68:	89 c2                	mov    %eax,%edx
+  800e6a:	c1 ea 16             	shr    $0x16,%edx
+  800e6d:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800e74:	f6 c2 01             	test   $0x1,%dl
+  800e77:	74 bf                	je     800e38 <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  800e79:	89 c2                	mov    %eax,%edx
+  800e7b:	c1 ea 0c             	shr    $0xc,%edx
+  800e7e:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800e85:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  800e88:	83 fa 03             	cmp    $0x3,%edx
+  800e8b:	75 ab                	jne    800e38 <fsv_alloc+0xe>
+  800e8d:	eb c8                	jmp    800e57 <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  800e8f:	83 ec 0c             	sub    $0xc,%esp
+  800e92:	68 40 50 80 00       	push   $0x805040
+  800e97:	e8 27 f7 ff ff       	call   8005c3 <sysbatch_flush>
+  800e9c:	83 c4 10             	add    $0x10,%esp
+}
+  800e9f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ea2:	5b                   	pop    %ebx
+  800ea3:	5e                   	pop    %esi
+  800ea4:	5d                   	pop    %ebp
+  800ea5:	c3                   	ret
+
+00800ea6 <devfile_read>:
+{
+  800ea6:	55                   	push   %ebp
+  800ea7:	89 e5                	mov    %esp,%ebp
+  800ea9:	57                   	push   %edi
+  800eaa:	56                   	push   %esi
+  800eab:	53                   	push   %ebx
+  800eac:	83 ec 3c             	sub    $0x3c,%esp
+  800eaf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  800eb2:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  800eb8:	77 57                	ja     800f11 <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800eba:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ebd:	8b 40 0c             	mov    0xc(%eax),%eax
+  800ec0:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read.req_n = n;
+  800ec5:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  800ecb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ed0:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ed5:	e8 79 fe ff ff       	call   800d53 <fsipc>
+  800eda:	89 c6                	mov    %eax,%esi
+  800edc:	85 c0                	test   %eax,%eax
+  800ede:	78 27                	js     800f07 <devfile_read+0x61>
+  assert(r <= n);
+  800ee0:	39 c3                	cmp    %eax,%ebx
+  800ee2:	0f 82 0e 02 00 00    	jb     8010f6 <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  800ee8:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800eed:	0f 8f 1c 02 00 00    	jg     80110f <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  800ef3:	83 ec 04             	sub    $0x4,%esp
+  800ef6:	50                   	push   %eax
+  800ef7:	68 00 60 80 00       	push   $0x806000
+  800efc:	ff 75 0c             	push   0xc(%ebp)
+  800eff:	e8 f1 19 00 00       	call   8028f5 <memmove>
+  return r;
+  800f04:	83 c4 10             	add    $0x10,%esp
+}
+  800f07:	89 f0                	mov    %esi,%eax
+  800f09:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f0c:	5b                   	pop    %ebx
+  800f0d:	5e                   	pop    %esi
+  800f0e:	5f                   	pop    %edi
+  800f0f:	5d                   	pop    %ebp
+  800f10:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  800f11:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f16:	e8 0f ff ff ff       	call   800e2a <fsv_alloc>
+  800f1b:	89 c6                	mov    %eax,%esi
+  800f1d:	85 c0                	test   %eax,%eax
+  800f1f:	78 e6                	js     800f07 <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  800f21:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f24:	8b 40 0c             	mov    0xc(%eax),%eax
+  800f27:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  800f2c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f2f:	8b 40 04             	mov    0x4(%eax),%eax
+  800f32:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  800f37:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  800f3d:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  800f44:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800f49:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  800f4e:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f53:	e8 e2 fc ff ff       	call   800c3a <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  800f58:	6a 00                	push   $0x0
+  800f5a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800f5d:	50                   	push   %eax
+  800f5e:	68 00 10 c0 9f       	push   $0x9fc01000
+  800f63:	6a 00                	push   $0x0
+  800f65:	e8 7c 1b 00 00       	call   802ae6 <ipc_recv_pages>
+  800f6a:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  800f6c:	83 c4 10             	add    $0x10,%esp
+  800f6f:	85 c0                	test   %eax,%eax
+  800f71:	7e 94                	jle    800f07 <devfile_read+0x61>
+  assert(r <= n);
+  800f73:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800f76:	39 c3                	cmp    %eax,%ebx
+  800f78:	72 2e                	jb     800fa8 <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  800f7a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f7d:	8b 40 04             	mov    0x4(%eax),%eax
+  800f80:	25 ff 0f 00 00       	and    $0xfff,%eax
+  800f85:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  800f88:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800f8b:	c1 e2 0c             	shl    $0xc,%edx
+  800f8e:	39 ca                	cmp    %ecx,%edx
+  800f90:	72 2f                	jb     800fc1 <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  800f92:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  800f97:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  800f9a:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  800f9e:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  800fa3:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  800fa6:	eb 52                	jmp    800ffa <devfile_read+0x154>
+  assert(r <= n);
+  800fa8:	68 b9 2f 80 00       	push   $0x802fb9
+  800fad:	68 c0 2f 80 00       	push   $0x802fc0
+  800fb2:	68 49 01 00 00       	push   $0x149
+  800fb7:	68 ae 2f 80 00       	push   $0x802fae
+  800fbc:	e8 e5 10 00 00       	call   8020a6 <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  800fc1:	68 e4 2f 80 00       	push   $0x802fe4
+  800fc6:	68 c0 2f 80 00       	push   $0x802fc0
+  800fcb:	68 4a 01 00 00       	push   $0x14a
+  800fd0:	68 ae 2f 80 00       	push   $0x802fae
+  800fd5:	e8 cc 10 00 00       	call   8020a6 <_panic>
+      memmove(dst + done, src + done, m);
+  800fda:	83 ec 04             	sub    $0x4,%esp
+  800fdd:	53                   	push   %ebx
+  800fde:	56                   	push   %esi
+  800fdf:	89 f8                	mov    %edi,%eax
+  800fe1:	03 45 0c             	add    0xc(%ebp),%eax
+  800fe4:	50                   	push   %eax
+  800fe5:	e8 0b 19 00 00       	call   8028f5 <memmove>
+  800fea:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  800fed:	01 df                	add    %ebx,%edi
+  800fef:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800ff2:	39 c7                	cmp    %eax,%edi
+  800ff4:	0f 83 c0 00 00 00    	jae    8010ba <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  800ffa:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800ffd:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  801000:	89 f0                	mov    %esi,%eax
+  801002:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801007:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  80100c:	29 c3                	sub    %eax,%ebx
+  80100e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801011:	29 f8                	sub    %edi,%eax
+  801013:	39 c3                	cmp    %eax,%ebx
+  801015:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  801018:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  80101e:	75 ba                	jne    800fda <devfile_read+0x134>
+  801020:	89 f9                	mov    %edi,%ecx
+  801022:	03 4d 0c             	add    0xc(%ebp),%ecx
+  801025:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  801028:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  80102e:	75 aa                	jne    800fda <devfile_read+0x134>
+  801030:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  801036:	77 a2                	ja     800fda <devfile_read+0x134>
+  801038:	89 c8                	mov    %ecx,%eax
+  80103a:	c1 e8 16             	shr    $0x16,%eax
+  80103d:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801044:	a8 01                	test   $0x1,%al
+  801046:	74 92                	je     800fda <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  801048:	89 c8                	mov    %ecx,%eax
+  80104a:	c1 e8 0c             	shr    $0xc,%eax
+  80104d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  801054:	a8 01                	test   $0x1,%al
+  801056:	74 82                	je     800fda <devfile_read+0x134>
+  801058:	a9 02 08 00 00       	test   $0x802,%eax
+  80105d:	0f 84 77 ff ff ff    	je     800fda <devfile_read+0x134>
+  801063:	f6 c4 04             	test   $0x4,%ah
+  801066:	0f 85 6e ff ff ff    	jne    800fda <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  80106c:	a1 44 57 80 00       	mov    0x805744,%eax
+  801071:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  801075:	84 c0                	test   %al,%al
+  801077:	75 17                	jne    801090 <devfile_read+0x1ea>
+  801079:	83 ec 08             	sub    $0x8,%esp
+  80107c:	6a 01                	push   $0x1
+  80107e:	6a 00                	push   $0x0
+  801080:	e8 f8 f0 ff ff       	call   80017d <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  801085:	83 c4 10             	add    $0x10,%esp
+  801088:	85 c0                	test   %eax,%eax
+  80108a:	0f 85 4a ff ff ff    	jne    800fda <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  801090:	83 ec 04             	sub    $0x4,%esp
+  801093:	68 05 08 00 00       	push   $0x805
+  801098:	ff 75 cc             	push   -0x34(%ebp)
+  80109b:	6a 00                	push   $0x0
+  80109d:	56                   	push   %esi
+  80109e:	6a 00                	push   $0x0
+  8010a0:	6a 05                	push   $0x5
+  8010a2:	68 40 50 80 00       	push   $0x805040
+  8010a7:	e8 67 f5 ff ff       	call   800613 <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  8010ac:	c1 e8 1f             	shr    $0x1f,%eax
+  8010af:	08 45 cb             	or     %al,-0x35(%ebp)
+  8010b2:	83 c4 20             	add    $0x20,%esp
+  8010b5:	e9 33 ff ff ff       	jmp    800fed <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  8010ba:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  8010bd:	83 ec 0c             	sub    $0xc,%esp
+  8010c0:	68 40 50 80 00       	push   $0x805040
+  8010c5:	e8 f9 f4 ff ff       	call   8005c3 <sysbatch_flush>
+  8010ca:	83 c4 10             	add    $0x10,%esp
+  8010cd:	85 c0                	test   %eax,%eax
+  8010cf:	78 06                	js     8010d7 <devfile_read+0x231>
+  8010d1:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  8010d5:	74 14                	je     8010eb <devfile_read+0x245>
+    memmove(dst, src, r);
+  8010d7:	83 ec 04             	sub    $0x4,%esp
+  8010da:	ff 75 d4             	push   -0x2c(%ebp)
+  8010dd:	ff 75 d0             	push   -0x30(%ebp)
+  8010e0:	ff 75 0c             	push   0xc(%ebp)
+  8010e3:	e8 0d 18 00 00       	call   8028f5 <memmove>
+  8010e8:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  8010eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010ee:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  8010f1:	e9 11 fe ff ff       	jmp    800f07 <devfile_read+0x61>
+  assert(r <= n);
+  8010f6:	68 b9 2f 80 00       	push   $0x802fb9
+  8010fb:	68 c0 2f 80 00       	push   $0x802fc0
+  801100:	68 1c 01 00 00       	push   $0x11c
+  801105:	68 ae 2f 80 00       	push   $0x802fae
+  80110a:	e8 97 0f 00 00       	call   8020a6 <_panic>
+  assert(r <= PGSIZE);
+  80110f:	68 d5 2f 80 00       	push   $0x802fd5
+  801114:	68 c0 2f 80 00       	push   $0x802fc0
+  801119:	68 1d 01 00 00       	push   $0x11d
+  80111e:	68 ae 2f 80 00       	push   $0x802fae
+  801123:	e8 7e 0f 00 00       	call   8020a6 <_panic>
+
+00801128 <devfile_write>:
+{
+  801128:	55                   	push   %ebp
+  801129:	89 e5                	mov    %esp,%ebp
+  80112b:	57                   	push   %edi
+  80112c:	56                   	push   %esi
+  80112d:	53                   	push   %ebx
+  80112e:	83 ec 1c             	sub    $0x1c,%esp
+  801131:	8b 75 08             	mov    0x8(%ebp),%esi
+  801134:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  801137:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  80113c:	77 39                	ja     801177 <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80113e:	8b 56 0c             	mov    0xc(%esi),%edx
+  801141:	89 15 00 60 80 00    	mov    %edx,0x806000
+  fsipcbuf.write.req_n = n;
+  801147:	a3 04 60 80 00       	mov    %eax,0x806004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  80114c:	83 ec 04             	sub    $0x4,%esp
+  80114f:	50                   	push   %eax
+  801150:	ff 75 0c             	push   0xc(%ebp)
+  801153:	68 08 60 80 00       	push   $0x806008
+  801158:	e8 98 17 00 00       	call   8028f5 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  80115d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801162:	b8 04 00 00 00       	mov    $0x4,%eax
+  801167:	e8 e7 fb ff ff       	call   800d53 <fsipc>
+  80116c:	83 c4 10             	add    $0x10,%esp
+}
+  80116f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801172:	5b                   	pop    %ebx
+  801173:	5e                   	pop    %esi
+  801174:	5f                   	pop    %edi
+  801175:	5d                   	pop    %ebp
+  801176:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  801177:	ba 00 00 10 00       	mov    $0x100000,%edx
+  80117c:	39 d0                	cmp    %edx,%eax
+  80117e:	89 d3                	mov    %edx,%ebx
+  801180:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  801183:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  801189:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  80118c:	83 c7 01             	add    $0x1,%edi
+  80118f:	89 f8                	mov    %edi,%eax
+  801191:	e8 94 fc ff ff       	call   800e2a <fsv_alloc>
+  801196:	85 c0                	test   %eax,%eax
+  801198:	78 d5                	js     80116f <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  80119a:	83 ec 04             	sub    $0x4,%esp
+  80119d:	53                   	push   %ebx
+  80119e:	ff 75 0c             	push   0xc(%ebp)
+  8011a1:	68 00 10 c0 9f       	push   $0x9fc01000
+  8011a6:	e8 4a 17 00 00       	call   8028f5 <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  8011ab:	8b 46 0c             	mov    0xc(%esi),%eax
+  8011ae:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  8011b3:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  8011b9:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  8011c0:	89 f9                	mov    %edi,%ecx
+  8011c2:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  8011c7:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011cc:	e8 69 fa ff ff       	call   800c3a <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  8011d1:	6a 00                	push   $0x0
+  8011d3:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8011d6:	50                   	push   %eax
+  8011d7:	6a 00                	push   $0x0
+  8011d9:	6a 00                	push   $0x0
+  8011db:	e8 06 19 00 00       	call   802ae6 <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  8011e0:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  8011e3:	eb 8a                	jmp    80116f <devfile_write+0x47>
+
+008011e5 <open>:
+{
+  8011e5:	55                   	push   %ebp
+  8011e6:	89 e5                	mov    %esp,%ebp
+  8011e8:	56                   	push   %esi
+  8011e9:	53                   	push   %ebx
+  8011ea:	83 ec 1c             	sub    $0x1c,%esp
+  8011ed:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  8011f0:	56                   	push   %esi
+  8011f1:	e8 3e 15 00 00       	call   802734 <strlen>
+  8011f6:	83 c4 10             	add    $0x10,%esp
+  8011f9:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8011fe:	7f 6c                	jg     80126c <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  801200:	83 ec 0c             	sub    $0xc,%esp
+  801203:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801206:	50                   	push   %eax
+  801207:	e8 ad f4 ff ff       	call   8006b9 <fd_alloc>
+  80120c:	89 c3                	mov    %eax,%ebx
+  80120e:	83 c4 10             	add    $0x10,%esp
+  801211:	85 c0                	test   %eax,%eax
+  801213:	78 3c                	js     801251 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801215:	83 ec 08             	sub    $0x8,%esp
+  801218:	56                   	push   %esi
+  801219:	68 00 60 80 00       	push   $0x806000
+  80121e:	e8 4c 15 00 00       	call   80276f <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801223:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801226:	a3 00 64 80 00       	mov    %eax,0x806400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80122b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80122e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801233:	e8 1b fb ff ff       	call   800d53 <fsipc>
+  801238:	89 c3                	mov    %eax,%ebx
+  80123a:	83 c4 10             	add    $0x10,%esp
+  80123d:	85 c0                	test   %eax,%eax
+  80123f:	78 19                	js     80125a <open+0x75>
+  return fd2num(fd);
+  801241:	83 ec 0c             	sub    $0xc,%esp
+  801244:	ff 75 f4             	push   -0xc(%ebp)
+  801247:	e8 49 f4 ff ff       	call   800695 <fd2num>
+  80124c:	89 c3                	mov    %eax,%ebx
+  80124e:	83 c4 10             	add    $0x10,%esp
+}
+  801251:	89 d8                	mov    %ebx,%eax
+  801253:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801256:	5b                   	pop    %ebx
+  801257:	5e                   	pop    %esi
+  801258:	5d                   	pop    %ebp
+  801259:	c3                   	ret
+    fd_close(fd, 0);
+  80125a:	83 ec 08             	sub    $0x8,%esp
+  80125d:	6a 00                	push   $0x0
+  80125f:	ff 75 f4             	push   -0xc(%ebp)
+  801262:	e8 44 f5 ff ff       	call   8007ab <fd_close>
+    return r;
+  801267:	83 c4 10             	add    $0x10,%esp
+  80126a:	eb e5                	jmp    801251 <open+0x6c>
+    return -E_BAD_PATH;
+  80126c:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801271:	eb de                	jmp    801251 <open+0x6c>
+
+00801273 <open_read>:
+{
+  801273:	55                   	push   %ebp
+  801274:	89 e5                	mov    %esp,%ebp
+  801276:	57                   	push   %edi
+  801277:	56                   	push   %esi
+  801278:	53                   	push   %ebx
+  801279:	83 ec 28             	sub    $0x28,%esp
+  80127c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  80127f:	57                   	push   %edi
+  801280:	e8 af 14 00 00       	call   802734 <strlen>
+  801285:	83 c4 10             	add    $0x10,%esp
+  801288:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80128d:	0f 87 f6 00 00 00    	ja     801389 <open_read+0x116>
+  801293:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  801295:	83 ec 0c             	sub    $0xc,%esp
+  801298:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80129b:	50                   	push   %eax
+  80129c:	e8 18 f4 ff ff       	call   8006b9 <fd_alloc>
+  8012a1:	89 c3                	mov    %eax,%ebx
+  8012a3:	83 c4 10             	add    $0x10,%esp
+  8012a6:	85 c0                	test   %eax,%eax
+  8012a8:	0f 88 b2 00 00 00    	js     801360 <open_read+0xed>
+  strcpy(req->req_buf, path);
+  8012ae:	83 ec 08             	sub    $0x8,%esp
+  8012b1:	57                   	push   %edi
+  8012b2:	68 e4 60 80 00       	push   $0x8060e4
+  8012b7:	e8 b3 14 00 00       	call   80276f <strcpy>
+  req->req_nops = 2;
+  8012bc:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  8012c3:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  8012c6:	c7 05 04 60 80 00 01 	movl   $0x1,0x806004
+  8012cd:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  8012d0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8012d3:	a3 10 60 80 00       	mov    %eax,0x806010
+  req->req_ops[0].op_buf = 0;
+  8012d8:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  8012df:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  8012e2:	c7 05 20 60 80 00 04 	movl   $0x4,0x806020
+  8012e9:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  8012ec:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  8012f3:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  8012f6:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  8012fb:	29 f0                	sub    %esi,%eax
+  8012fd:	3b 45 14             	cmp    0x14(%ebp),%eax
+  801300:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  801304:	a3 2c 60 80 00       	mov    %eax,0x80602c
+  req->req_ops[1].op_offset = 0;
+  801309:	c7 05 30 60 80 00 00 	movl   $0x0,0x806030
+  801310:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  801313:	83 c6 01             	add    $0x1,%esi
+  801316:	89 35 34 60 80 00    	mov    %esi,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  80131c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80131f:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801324:	e8 2a fa ff ff       	call   800d53 <fsipc>
+  801329:	89 c3                	mov    %eax,%ebx
+  80132b:	83 c4 10             	add    $0x10,%esp
+  80132e:	83 f8 01             	cmp    $0x1,%eax
+  801331:	7e 37                	jle    80136a <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  801333:	a1 38 60 80 00       	mov    0x806038,%eax
+  801338:	8b 55 18             	mov    0x18(%ebp),%edx
+  80133b:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  80133d:	83 ec 04             	sub    $0x4,%esp
+  801340:	50                   	push   %eax
+  801341:	81 c6 e4 60 80 00    	add    $0x8060e4,%esi
+  801347:	56                   	push   %esi
+  801348:	ff 75 10             	push   0x10(%ebp)
+  80134b:	e8 a5 15 00 00       	call   8028f5 <memmove>
+  return fd2num(fd);
+  801350:	83 c4 04             	add    $0x4,%esp
+  801353:	ff 75 e4             	push   -0x1c(%ebp)
+  801356:	e8 3a f3 ff ff       	call   800695 <fd2num>
+  80135b:	89 c3                	mov    %eax,%ebx
+  80135d:	83 c4 10             	add    $0x10,%esp
+}
+  801360:	89 d8                	mov    %ebx,%eax
+  801362:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801365:	5b                   	pop    %ebx
+  801366:	5e                   	pop    %esi
+  801367:	5f                   	pop    %edi
+  801368:	5d                   	pop    %ebp
+  801369:	c3                   	ret
+    fd_close(fd, 0);
+  80136a:	83 ec 08             	sub    $0x8,%esp
+  80136d:	6a 00                	push   $0x0
+  80136f:	ff 75 e4             	push   -0x1c(%ebp)
+  801372:	e8 34 f4 ff ff       	call   8007ab <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  801377:	83 c4 10             	add    $0x10,%esp
+  80137a:	85 db                	test   %ebx,%ebx
+  80137c:	78 e2                	js     801360 <open_read+0xed>
+  80137e:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  801381:	8b 9b 1c 60 80 00    	mov    0x80601c(%ebx),%ebx
+  801387:	eb d7                	jmp    801360 <open_read+0xed>
+    return -E_BAD_PATH;
+  801389:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80138e:	eb d0                	jmp    801360 <open_read+0xed>
+
+00801390 <file_stat>:
+{
+  801390:	55                   	push   %ebp
+  801391:	89 e5                	mov    %esp,%ebp
+  801393:	57                   	push   %edi
+  801394:	56                   	push   %esi
+  801395:	53                   	push   %ebx
+  801396:	83 ec 18             	sub    $0x18,%esp
+  801399:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80139c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  80139f:	57                   	push   %edi
+  8013a0:	e8 8f 13 00 00       	call   802734 <strlen>
+  8013a5:	83 c4 10             	add    $0x10,%esp
+  8013a8:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8013ad:	0f 8f c7 00 00 00    	jg     80147a <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  8013b3:	83 ec 0c             	sub    $0xc,%esp
+  8013b6:	57                   	push   %edi
+  8013b7:	e8 78 13 00 00       	call   802734 <strlen>
+  8013bc:	8d 58 04             	lea    0x4(%eax),%ebx
+  8013bf:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  8013c2:	83 c4 08             	add    $0x8,%esp
+  8013c5:	57                   	push   %edi
+  8013c6:	68 e4 60 80 00       	push   $0x8060e4
+  8013cb:	e8 9f 13 00 00       	call   80276f <strcpy>
+  req->req_nops = 2;
+  8013d0:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  8013d7:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  8013da:	c7 05 04 60 80 00 02 	movl   $0x2,0x806004
+  8013e1:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  8013e4:	c7 05 10 60 80 00 00 	movl   $0x0,0x806010
+  8013eb:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  8013ee:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  8013f5:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  8013f8:	c7 05 20 60 80 00 03 	movl   $0x3,0x806020
+  8013ff:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  801402:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  801409:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  80140c:	89 1d 34 60 80 00    	mov    %ebx,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  801412:	ba 00 00 00 00       	mov    $0x0,%edx
+  801417:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80141c:	e8 32 f9 ff ff       	call   800d53 <fsipc>
+  801421:	83 c4 10             	add    $0x10,%esp
+  801424:	83 f8 01             	cmp    $0x1,%eax
+  801427:	7e 42                	jle    80146b <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  801429:	81 c3 e4 60 80 00    	add    $0x8060e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  80142f:	83 ec 08             	sub    $0x8,%esp
+  801432:	53                   	push   %ebx
+  801433:	56                   	push   %esi
+  801434:	e8 36 13 00 00       	call   80276f <strcpy>
+  st->st_size = ret->ret_size;
+  801439:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  80143f:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  801445:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  80144b:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  801451:	c7 86 88 00 00 00 04 	movl   $0x804004,0x88(%esi)
+  801458:	40 80 00 
+  return 0;
+  80145b:	83 c4 10             	add    $0x10,%esp
+  80145e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801463:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801466:	5b                   	pop    %ebx
+  801467:	5e                   	pop    %esi
+  801468:	5f                   	pop    %edi
+  801469:	5d                   	pop    %ebp
+  80146a:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  80146b:	85 c0                	test   %eax,%eax
+  80146d:	78 f4                	js     801463 <file_stat+0xd3>
+  80146f:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801472:	8b 80 1c 60 80 00    	mov    0x80601c(%eax),%eax
+  801478:	eb e9                	jmp    801463 <file_stat+0xd3>
+    return -E_BAD_PATH;
+  80147a:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  80147f:	eb e2                	jmp    801463 <file_stat+0xd3>
+
+00801481 <read_map>:
+{
+  801481:	55                   	push   %ebp
+  801482:	89 e5                	mov    %esp,%ebp
+  801484:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801487:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80148a:	50                   	push   %eax
+  80148b:	ff 75 08             	push   0x8(%ebp)
+  80148e:	e8 7c f2 ff ff       	call   80070f <fd_lookup>
+  801493:	83 c4 10             	add    $0x10,%esp
+  801496:	85 c0                	test   %eax,%eax
+  801498:	78 2a                	js     8014c4 <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  80149a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80149d:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  8014a3:	39 08                	cmp    %ecx,(%eax)
+  8014a5:	75 1f                	jne    8014c6 <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  8014a7:	8b 40 0c             	mov    0xc(%eax),%eax
+  8014aa:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read_map.req_offset = offset;
+  8014af:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8014b2:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  8014b7:	8b 55 10             	mov    0x10(%ebp),%edx
+  8014ba:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8014bf:	e8 8f f8 ff ff       	call   800d53 <fsipc>
+}
+  8014c4:	c9                   	leave
+  8014c5:	c3                   	ret
+    return -E_INVAL;
+  8014c6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014cb:	eb f7                	jmp    8014c4 <read_map+0x43>
+
+008014cd <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8014cd:	55                   	push   %ebp
+  8014ce:	89 e5                	mov    %esp,%ebp
+  8014d0:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  8014d3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014d8:	b8 08 00 00 00       	mov    $0x8,%eax
+  8014dd:	e8 71 f8 ff ff       	call   800d53 <fsipc>
+}
+  8014e2:	c9                   	leave
+  8014e3:	c3                   	ret
+
+008014e4 <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  8014e4:	55                   	push   %ebp
+  8014e5:	89 e5                	mov    %esp,%ebp
+  8014e7:	57                   	push   %edi
+  8014e8:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  8014e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014ec:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.stats.req_bio_sched = 0;
+  8014f1:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  8014f8:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  8014fb:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  801502:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  801505:	ba 00 00 00 00       	mov    $0x0,%edx
+  80150a:	b8 09 00 00 00       	mov    $0x9,%eax
+  80150f:	e8 3f f8 ff ff       	call   800d53 <fsipc>
+  801514:	85 c0                	test   %eax,%eax
+  801516:	78 14                	js     80152c <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  801518:	be 00 60 80 00       	mov    $0x806000,%esi
+  80151d:	b9 16 00 00 00       	mov    $0x16,%ecx
+  801522:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801525:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  801527:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80152c:	5e                   	pop    %esi
+  80152d:	5f                   	pop    %edi
+  80152e:	5d                   	pop    %ebp
+  80152f:	c3                   	ret
+
+00801530 <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  801530:	55                   	push   %ebp
+  801531:	89 e5                	mov    %esp,%ebp
+  801533:	53                   	push   %ebx
+  801534:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  801537:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  80153a:	50                   	push   %eax
+  80153b:	6a 00                	push   $0x0
+  80153d:	e8 a2 ff ff ff       	call   8014e4 <fs_stats>
+  801542:	83 c4 10             	add    $0x10,%esp
+  801545:	85 c0                	test   %eax,%eax
+  801547:	78 28                	js     801571 <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  801549:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  80154c:	83 ec 08             	sub    $0x8,%esp
+  80154f:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801552:	50                   	push   %eax
+  801553:	6a 20                	push   $0x20
+  801555:	e8 8a ff ff ff       	call   8014e4 <fs_stats>
+  80155a:	83 c4 10             	add    $0x10,%esp
+  80155d:	85 c0                	test   %eax,%eax
+  80155f:	78 10                	js     801571 <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  801561:	83 ec 08             	sub    $0x8,%esp
+  801564:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801567:	50                   	push   %eax
+  801568:	53                   	push   %ebx
+  801569:	e8 76 ff ff ff       	call   8014e4 <fs_stats>
+  80156e:	83 c4 10             	add    $0x10,%esp
+}
+  801571:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801574:	c9                   	leave
+  801575:	c3                   	ret
+
+00801576 <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  801576:	55                   	push   %ebp
+  801577:	89 e5                	mov    %esp,%ebp
+  801579:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  80157c:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  801583:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  801586:	8b 45 08             	mov    0x8(%ebp),%eax
+  801589:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.stats.req_dcache = 0;
+  80158e:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  801595:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  801598:	ba 00 00 00 00       	mov    $0x0,%edx
+  80159d:	b8 09 00 00 00       	mov    $0x9,%eax
+  8015a2:	e8 ac f7 ff ff       	call   800d53 <fsipc>
+}
+  8015a7:	c9                   	leave
+  8015a8:	c3                   	ret
+
+008015a9 <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  8015a9:	55                   	push   %ebp
+  8015aa:	89 e5                	mov    %esp,%ebp
+  8015ac:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  8015af:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  8015b6:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  8015b9:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  8015c0:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  8015c3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015c6:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_STATS, NULL);
+  8015cb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015d0:	b8 09 00 00 00       	mov    $0x9,%eax
+  8015d5:	e8 79 f7 ff ff       	call   800d53 <fsipc>
+}
+  8015da:	c9                   	leave
+  8015db:	c3                   	ret
+
+008015dc <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  8015dc:	55                   	push   %ebp
+  8015dd:	89 e5                	mov    %esp,%ebp
+  8015df:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8015e2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015e5:	50                   	push   %eax
+  8015e6:	ff 75 08             	push   0x8(%ebp)
+  8015e9:	e8 21 f1 ff ff       	call   80070f <fd_lookup>
+  8015ee:	83 c4 10             	add    $0x10,%esp
+  8015f1:	85 c0                	test   %eax,%eax
+  8015f3:	78 34                	js     801629 <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  8015f5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015f8:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  8015fe:	39 08                	cmp    %ecx,(%eax)
+  801600:	75 29                	jne    80162b <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  801602:	8b 40 0c             	mov    0xc(%eax),%eax
+  801605:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.fallocate.req_offset = offset;
+  80160a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80160d:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.fallocate.req_len = len;
+  801612:	8b 45 10             	mov    0x10(%ebp),%eax
+  801615:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  80161a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80161f:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801624:	e8 2a f7 ff ff       	call   800d53 <fsipc>
+}
+  801629:	c9                   	leave
+  80162a:	c3                   	ret
+    return -E_INVAL;
+  80162b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801630:	eb f7                	jmp    801629 <fallocate+0x4d>
+
+00801632 <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  801632:	55                   	push   %ebp
+  801633:	89 e5                	mov    %esp,%ebp
+  801635:	57                   	push   %edi
+  801636:	56                   	push   %esi
+  801637:	53                   	push   %ebx
+  801638:	83 ec 24             	sub    $0x24,%esp
+  80163b:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80163e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801641:	50                   	push   %eax
+  801642:	ff 75 08             	push   0x8(%ebp)
+  801645:	e8 c5 f0 ff ff       	call   80070f <fd_lookup>
+  80164a:	83 c4 10             	add    $0x10,%esp
+  80164d:	85 c0                	test   %eax,%eax
+  80164f:	78 66                	js     8016b7 <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  801651:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801654:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  80165a:	39 08                	cmp    %ecx,(%eax)
+  80165c:	75 61                	jne    8016bf <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  80165e:	85 f6                	test   %esi,%esi
+  801660:	7e 50                	jle    8016b2 <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  801662:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  801667:	39 de                	cmp    %ebx,%esi
+  801669:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  80166c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80166f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801672:	a3 00 60 80 00       	mov    %eax,0x806000
+    fsipcbuf.prefetch.req_n = m;
+  801677:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  80167d:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  801684:	83 ec 04             	sub    $0x4,%esp
+  801687:	57                   	push   %edi
+  801688:	ff 75 0c             	push   0xc(%ebp)
+  80168b:	68 08 60 80 00       	push   $0x806008
+  801690:	e8 60 12 00 00       	call   8028f5 <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  801695:	ba 00 00 00 00       	mov    $0x0,%edx
+  80169a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80169f:	e8 af f6 ff ff       	call   800d53 <fsipc>
+  8016a4:	83 c4 10             	add    $0x10,%esp
+  8016a7:	85 c0                	test   %eax,%eax
+  8016a9:	78 0c                	js     8016b7 <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  8016ab:	01 7d 0c             	add    %edi,0xc(%ebp)
+  8016ae:	29 de                	sub    %ebx,%esi
+  8016b0:	eb ac                	jmp    80165e <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  8016b2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8016b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016ba:	5b                   	pop    %ebx
+  8016bb:	5e                   	pop    %esi
+  8016bc:	5f                   	pop    %edi
+  8016bd:	5d                   	pop    %ebp
+  8016be:	c3                   	ret
+    return -E_INVAL;
+  8016bf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016c4:	eb f1                	jmp    8016b7 <prefetch+0x85>
+
+008016c6 <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  8016c6:	55                   	push   %ebp
+  8016c7:	89 e5                	mov    %esp,%ebp
+  8016c9:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  8016cc:	50                   	push   %eax
+  8016cd:	e8 d3 ef ff ff       	call   8006a5 <fd2data>
+  8016d2:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  8016d7:	c9                   	leave
+  8016d8:	c3                   	ret
+
+008016d9 <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8016d9:	55                   	push   %ebp
+  8016da:	89 e5                	mov    %esp,%ebp
+  8016dc:	56                   	push   %esi
+  8016dd:	53                   	push   %ebx
+  8016de:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  8016e1:	83 ec 0c             	sub    $0xc,%esp
+  8016e4:	ff 75 08             	push   0x8(%ebp)
+  8016e7:	e8 b9 ef ff ff       	call   8006a5 <fd2data>
+  8016ec:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  8016ee:	83 c4 08             	add    $0x8,%esp
+  8016f1:	68 10 30 80 00       	push   $0x803010
+  8016f6:	53                   	push   %ebx
+  8016f7:	e8 73 10 00 00       	call   80276f <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  8016fc:	8b 46 04             	mov    0x4(%esi),%eax
+  8016ff:	2b 06                	sub    (%esi),%eax
+  801701:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  801707:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80170e:	00 00 00 
+  stat->st_dev = &devpipe;
+  801711:	c7 83 88 00 00 00 20 	movl   $0x804020,0x88(%ebx)
+  801718:	40 80 00 
+  return 0;
+}
+  80171b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801720:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801723:	5b                   	pop    %ebx
+  801724:	5e                   	pop    %esi
+  801725:	5d                   	pop    %ebp
+  801726:	c3                   	ret
+
+00801727 <pipe_wakeup>:
+{
+  801727:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  801729:	b8 00 00 00 00       	mov    $0x0,%eax
+  80172e:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  801731:	85 c0                	test   %eax,%eax
+  801733:	75 01                	jne    801736 <pipe_wakeup+0xf>
+  801735:	c3                   	ret
+{
+  801736:	55                   	push   %ebp
+  801737:	89 e5                	mov    %esp,%ebp
+  801739:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  80173c:	6a 00                	push   $0x0
+  80173e:	68 00 00 c0 ee       	push   $0xeec00000
+  801743:	52                   	push   %edx
+  801744:	e8 d3 ed ff ff       	call   80051c <sys_chan_wakeup>
+  801749:	83 c4 10             	add    $0x10,%esp
+}
+  80174c:	c9                   	leave
+  80174d:	c3                   	ret
+
+0080174e <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80174e:	55                   	push   %ebp
+  80174f:	89 e5                	mov    %esp,%ebp
+  801751:	57                   	push   %edi
+  801752:	56                   	push   %esi
+  801753:	53                   	push   %ebx
+  801754:	83 ec 18             	sub    $0x18,%esp
+  801757:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  80175a:	57                   	push   %edi
+  80175b:	e8 45 ef ff ff       	call   8006a5 <fd2data>
+  801760:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  801762:	83 c4 10             	add    $0x10,%esp
+  801765:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  801769:	74 2a                	je     801795 <devpipe_close+0x47>
+  80176b:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  801770:	89 f8                	mov    %edi,%eax
+  801772:	e8 4f ff ff ff       	call   8016c6 <pipe_ring>
+  801777:	83 ec 08             	sub    $0x8,%esp
+  80177a:	01 d8                	add    %ebx,%eax
+  80177c:	50                   	push   %eax
+  80177d:	6a 00                	push   $0x0
+  80177f:	e8 c1 ea ff ff       	call   800245 <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  801784:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80178a:	83 c4 10             	add    $0x10,%esp
+  80178d:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  801793:	75 db                	jne    801770 <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  801795:	83 ec 08             	sub    $0x8,%esp
+  801798:	57                   	push   %edi
+  801799:	6a 00                	push   $0x0
+  80179b:	e8 a5 ea ff ff       	call   800245 <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  8017a0:	83 c4 10             	add    $0x10,%esp
+  8017a3:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  8017a7:	75 13                	jne    8017bc <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  8017a9:	83 ec 08             	sub    $0x8,%esp
+  8017ac:	56                   	push   %esi
+  8017ad:	6a 00                	push   $0x0
+  8017af:	e8 91 ea ff ff       	call   800245 <sys_page_unmap>
+}
+  8017b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017b7:	5b                   	pop    %ebx
+  8017b8:	5e                   	pop    %esi
+  8017b9:	5f                   	pop    %edi
+  8017ba:	5d                   	pop    %ebp
+  8017bb:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  8017bc:	8d 56 04             	lea    0x4(%esi),%edx
+  8017bf:	8d 46 2c             	lea    0x2c(%esi),%eax
+  8017c2:	e8 60 ff ff ff       	call   801727 <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8017c7:	8d 46 30             	lea    0x30(%esi),%eax
+  8017ca:	89 f2                	mov    %esi,%edx
+  8017cc:	e8 56 ff ff ff       	call   801727 <pipe_wakeup>
+  8017d1:	eb d6                	jmp    8017a9 <devpipe_close+0x5b>
+
+008017d3 <_pipeisclosed>:
+{
+  8017d3:	55                   	push   %ebp
+  8017d4:	89 e5                	mov    %esp,%ebp
+  8017d6:	57                   	push   %edi
+  8017d7:	56                   	push   %esi
+  8017d8:	53                   	push   %ebx
+  8017d9:	83 ec 1c             	sub    $0x1c,%esp
+  8017dc:	89 c7                	mov    %eax,%edi
+  8017de:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  8017e0:	a1 44 57 80 00       	mov    0x805744,%eax
+  8017e5:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  8017e8:	83 ec 0c             	sub    $0xc,%esp
+  8017eb:	57                   	push   %edi
+  8017ec:	e8 58 14 00 00       	call   802c49 <pageref>
+  8017f1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8017f4:	89 34 24             	mov    %esi,(%esp)
+  8017f7:	e8 4d 14 00 00       	call   802c49 <pageref>
+    nn = thisenv->env_runs;
+  8017fc:	8b 15 44 57 80 00    	mov    0x805744,%edx
+  801802:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  801805:	83 c4 10             	add    $0x10,%esp
+  801808:	39 cb                	cmp    %ecx,%ebx
+  80180a:	74 1b                	je     801827 <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  80180c:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80180f:	75 cf                	jne    8017e0 <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  801811:	8b 42 58             	mov    0x58(%edx),%eax
+  801814:	6a 01                	push   $0x1
+  801816:	50                   	push   %eax
+  801817:	53                   	push   %ebx
+  801818:	68 17 30 80 00       	push   $0x803017
+  80181d:	e8 5f 09 00 00       	call   802181 <cprintf>
+  801822:	83 c4 10             	add    $0x10,%esp
+  801825:	eb b9                	jmp    8017e0 <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  801827:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80182a:	0f 94 c0             	sete   %al
+  80182d:	0f b6 c0             	movzbl %al,%eax
+}
+  801830:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801833:	5b                   	pop    %ebx
+  801834:	5e                   	pop    %esi
+  801835:	5f                   	pop    %edi
+  801836:	5d                   	pop    %ebp
+  801837:	c3                   	ret
+
+00801838 <devpipe_write_bulk>:
+{
+  801838:	55                   	push   %ebp
+  801839:	89 e5                	mov    %esp,%ebp
+  80183b:	57                   	push   %edi
+  80183c:	56                   	push   %esi
+  80183d:	53                   	push   %ebx
+  80183e:	83 ec 1c             	sub    $0x1c,%esp
+  801841:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801844:	89 d6                	mov    %edx,%esi
+  801846:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  801849:	e8 78 fe ff ff       	call   8016c6 <pipe_ring>
+  80184e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  801851:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  801856:	8d 46 04             	lea    0x4(%esi),%eax
+  801859:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  80185c:	eb 75                	jmp    8018d3 <devpipe_write_bulk+0x9b>
+  80185e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801863:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  801867:	6a 64                	push   $0x64
+  801869:	68 00 00 c0 ee       	push   $0xeec00000
+  80186e:	53                   	push   %ebx
+  80186f:	56                   	push   %esi
+  801870:	e8 84 ec ff ff       	call   8004f9 <sys_chan_sleep>
+      continue;
+  801875:	83 c4 10             	add    $0x10,%esp
+  801878:	eb 59                	jmp    8018d3 <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  80187a:	89 d1                	mov    %edx,%ecx
+  80187c:	c1 f9 1f             	sar    $0x1f,%ecx
+  80187f:	c1 e9 11             	shr    $0x11,%ecx
+  801882:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  801885:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  80188a:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  80188c:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  801892:	29 d3                	sub    %edx,%ebx
+  801894:	ba 00 80 00 00       	mov    $0x8000,%edx
+  801899:	29 c2                	sub    %eax,%edx
+  80189b:	39 d3                	cmp    %edx,%ebx
+  80189d:	0f 47 da             	cmova  %edx,%ebx
+  8018a0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018a3:	29 fa                	sub    %edi,%edx
+  8018a5:	39 d3                	cmp    %edx,%ebx
+  8018a7:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  8018aa:	83 ec 04             	sub    $0x4,%esp
+  8018ad:	53                   	push   %ebx
+  8018ae:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8018b1:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  8018b4:	52                   	push   %edx
+  8018b5:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8018b8:	01 c8                	add    %ecx,%eax
+  8018ba:	50                   	push   %eax
+  8018bb:	e8 97 10 00 00       	call   802957 <memcpy>
+    i += m;
+  8018c0:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  8018c2:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  8018c5:	8d 46 2c             	lea    0x2c(%esi),%eax
+  8018c8:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8018cb:	e8 57 fe ff ff       	call   801727 <pipe_wakeup>
+  8018d0:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  8018d3:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  8018d6:	73 2b                	jae    801903 <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  8018d8:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  8018da:	8b 56 04             	mov    0x4(%esi),%edx
+  8018dd:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  8018e3:	39 d0                	cmp    %edx,%eax
+  8018e5:	7d 93                	jge    80187a <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  8018e7:	89 f2                	mov    %esi,%edx
+  8018e9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8018ec:	e8 e2 fe ff ff       	call   8017d3 <_pipeisclosed>
+  8018f1:	85 c0                	test   %eax,%eax
+  8018f3:	0f 84 65 ff ff ff    	je     80185e <devpipe_write_bulk+0x26>
+        return i;
+  8018f9:	89 f8                	mov    %edi,%eax
+}
+  8018fb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018fe:	5b                   	pop    %ebx
+  8018ff:	5e                   	pop    %esi
+  801900:	5f                   	pop    %edi
+  801901:	5d                   	pop    %ebp
+  801902:	c3                   	ret
+  return i;
+  801903:	89 f8                	mov    %edi,%eax
+  801905:	eb f4                	jmp    8018fb <devpipe_write_bulk+0xc3>
+
+00801907 <devpipe_write>:
+{
+  801907:	55                   	push   %ebp
+  801908:	89 e5                	mov    %esp,%ebp
+  80190a:	57                   	push   %edi
+  80190b:	56                   	push   %esi
+  80190c:	53                   	push   %ebx
+  80190d:	83 ec 28             	sub    $0x28,%esp
+  801910:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  801913:	56                   	push   %esi
+  801914:	e8 8c ed ff ff       	call   8006a5 <fd2data>
+  801919:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  80191b:	8b 78 28             	mov    0x28(%eax),%edi
+  80191e:	83 c4 10             	add    $0x10,%esp
+  801921:	85 ff                	test   %edi,%edi
+  801923:	75 25                	jne    80194a <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  801925:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801928:	74 66                	je     801990 <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  80192a:	8b 43 04             	mov    0x4(%ebx),%eax
+  80192d:	8b 0b                	mov    (%ebx),%ecx
+  80192f:	8d 51 20             	lea    0x20(%ecx),%edx
+  801932:	39 d0                	cmp    %edx,%eax
+  801934:	72 2b                	jb     801961 <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  801936:	89 da                	mov    %ebx,%edx
+  801938:	89 f0                	mov    %esi,%eax
+  80193a:	e8 94 fe ff ff       	call   8017d3 <_pipeisclosed>
+  80193f:	85 c0                	test   %eax,%eax
+  801941:	75 51                	jne    801994 <devpipe_write+0x8d>
+      sys_yield();
+  801943:	e8 16 e8 ff ff       	call   80015e <sys_yield>
+  801948:	eb e0                	jmp    80192a <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  80194a:	83 ec 0c             	sub    $0xc,%esp
+  80194d:	ff 75 10             	push   0x10(%ebp)
+  801950:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801953:	89 c2                	mov    %eax,%edx
+  801955:	89 f0                	mov    %esi,%eax
+  801957:	e8 dc fe ff ff       	call   801838 <devpipe_write_bulk>
+  80195c:	83 c4 10             	add    $0x10,%esp
+  80195f:	eb 38                	jmp    801999 <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801961:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801964:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801968:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  80196b:	89 c2                	mov    %eax,%edx
+  80196d:	c1 fa 1f             	sar    $0x1f,%edx
+  801970:	89 d1                	mov    %edx,%ecx
+  801972:	c1 e9 1b             	shr    $0x1b,%ecx
+  801975:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801978:	83 e2 1f             	and    $0x1f,%edx
+  80197b:	29 ca                	sub    %ecx,%edx
+  80197d:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  801981:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  801985:	83 c0 01             	add    $0x1,%eax
+  801988:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  80198b:	83 c7 01             	add    $0x1,%edi
+  80198e:	eb 95                	jmp    801925 <devpipe_write+0x1e>
+  return i;
+  801990:	89 f8                	mov    %edi,%eax
+  801992:	eb 05                	jmp    801999 <devpipe_write+0x92>
+        return 0;
+  801994:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801999:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80199c:	5b                   	pop    %ebx
+  80199d:	5e                   	pop    %esi
+  80199e:	5f                   	pop    %edi
+  80199f:	5d                   	pop    %ebp
+  8019a0:	c3                   	ret
+
+008019a1 <devpipe_read_bulk>:
+{
+  8019a1:	55                   	push   %ebp
+  8019a2:	89 e5                	mov    %esp,%ebp
+  8019a4:	57                   	push   %edi
+  8019a5:	56                   	push   %esi
+  8019a6:	53                   	push   %ebx
+  8019a7:	83 ec 2c             	sub    $0x2c,%esp
+  8019aa:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8019ad:	89 d6                	mov    %edx,%esi
+  8019af:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8019b2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  8019b5:	e8 0c fd ff ff       	call   8016c6 <pipe_ring>
+  8019ba:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  8019bd:	85 db                	test   %ebx,%ebx
+  8019bf:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8019c4:	0f 45 c3             	cmovne %ebx,%eax
+  8019c7:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8019ca:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8019cf:	8d 46 30             	lea    0x30(%esi),%eax
+  8019d2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  8019d5:	eb 50                	jmp    801a27 <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  8019d7:	89 d1                	mov    %edx,%ecx
+  8019d9:	c1 f9 1f             	sar    $0x1f,%ecx
+  8019dc:	c1 e9 11             	shr    $0x11,%ecx
+  8019df:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  8019e2:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8019e7:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  8019e9:	29 d3                	sub    %edx,%ebx
+  8019eb:	ba 00 80 00 00       	mov    $0x8000,%edx
+  8019f0:	29 c2                	sub    %eax,%edx
+  8019f2:	39 d3                	cmp    %edx,%ebx
+  8019f4:	0f 47 da             	cmova  %edx,%ebx
+  8019f7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019fa:	29 fa                	sub    %edi,%edx
+  8019fc:	39 d3                	cmp    %edx,%ebx
+  8019fe:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  801a01:	83 ec 04             	sub    $0x4,%esp
+  801a04:	53                   	push   %ebx
+  801a05:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  801a08:	01 c8                	add    %ecx,%eax
+  801a0a:	50                   	push   %eax
+  801a0b:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  801a0e:	01 f8                	add    %edi,%eax
+  801a10:	50                   	push   %eax
+  801a11:	e8 41 0f 00 00       	call   802957 <memcpy>
+    i += m;
+  801a16:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  801a18:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  801a1a:	89 f2                	mov    %esi,%edx
+  801a1c:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  801a1f:	e8 03 fd ff ff       	call   801727 <pipe_wakeup>
+  801a24:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  801a27:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  801a2a:	73 51                	jae    801a7d <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  801a2c:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  801a2f:	8b 16                	mov    (%esi),%edx
+  801a31:	39 da                	cmp    %ebx,%edx
+  801a33:	75 a2                	jne    8019d7 <devpipe_read_bulk+0x36>
+      if (i > 0)
+  801a35:	85 ff                	test   %edi,%edi
+  801a37:	75 44                	jne    801a7d <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  801a39:	89 f2                	mov    %esi,%edx
+  801a3b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801a3e:	e8 90 fd ff ff       	call   8017d3 <_pipeisclosed>
+  801a43:	85 c0                	test   %eax,%eax
+  801a45:	75 3a                	jne    801a81 <devpipe_read_bulk+0xe0>
+  801a47:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a4c:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  801a50:	6a 64                	push   $0x64
+  801a52:	ff 75 d4             	push   -0x2c(%ebp)
+  801a55:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  801a56:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  801a59:	50                   	push   %eax
+  801a5a:	e8 9a ea ff ff       	call   8004f9 <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  801a5f:	85 c0                	test   %eax,%eax
+  801a61:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a66:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  801a69:	83 c4 10             	add    $0x10,%esp
+  801a6c:	a8 01                	test   $0x1,%al
+  801a6e:	74 b7                	je     801a27 <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  801a70:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  801a75:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a78:	5b                   	pop    %ebx
+  801a79:	5e                   	pop    %esi
+  801a7a:	5f                   	pop    %edi
+  801a7b:	5d                   	pop    %ebp
+  801a7c:	c3                   	ret
+  return i;
+  801a7d:	89 f8                	mov    %edi,%eax
+  801a7f:	eb f4                	jmp    801a75 <devpipe_read_bulk+0xd4>
+        return 0;
+  801a81:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a86:	eb ed                	jmp    801a75 <devpipe_read_bulk+0xd4>
+
+00801a88 <devpipe_read>:
+{
+  801a88:	55                   	push   %ebp
+  801a89:	89 e5                	mov    %esp,%ebp
+  801a8b:	57                   	push   %edi
+  801a8c:	56                   	push   %esi
+  801a8d:	53                   	push   %ebx
+  801a8e:	83 ec 18             	sub    $0x18,%esp
+  801a91:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  801a94:	57                   	push   %edi
+  801a95:	e8 0b ec ff ff       	call   8006a5 <fd2data>
+  801a9a:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  801a9c:	8b 70 28             	mov    0x28(%eax),%esi
+  801a9f:	83 c4 10             	add    $0x10,%esp
+  801aa2:	85 f6                	test   %esi,%esi
+  801aa4:	75 24                	jne    801aca <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  801aa6:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801aa9:	74 60                	je     801b0b <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  801aab:	8b 03                	mov    (%ebx),%eax
+  801aad:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801ab0:	75 3b                	jne    801aed <devpipe_read+0x65>
+      if (i > 0)
+  801ab2:	85 f6                	test   %esi,%esi
+  801ab4:	75 2d                	jne    801ae3 <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  801ab6:	89 da                	mov    %ebx,%edx
+  801ab8:	89 f8                	mov    %edi,%eax
+  801aba:	e8 14 fd ff ff       	call   8017d3 <_pipeisclosed>
+  801abf:	85 c0                	test   %eax,%eax
+  801ac1:	75 4c                	jne    801b0f <devpipe_read+0x87>
+      sys_yield();
+  801ac3:	e8 96 e6 ff ff       	call   80015e <sys_yield>
+  801ac8:	eb e1                	jmp    801aab <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  801aca:	83 ec 08             	sub    $0x8,%esp
+  801acd:	6a 00                	push   $0x0
+  801acf:	ff 75 10             	push   0x10(%ebp)
+  801ad2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ad5:	89 c2                	mov    %eax,%edx
+  801ad7:	89 f8                	mov    %edi,%eax
+  801ad9:	e8 c3 fe ff ff       	call   8019a1 <devpipe_read_bulk>
+  801ade:	83 c4 10             	add    $0x10,%esp
+  801ae1:	eb 02                	jmp    801ae5 <devpipe_read+0x5d>
+        return i;
+  801ae3:	89 f0                	mov    %esi,%eax
+}
+  801ae5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ae8:	5b                   	pop    %ebx
+  801ae9:	5e                   	pop    %esi
+  801aea:	5f                   	pop    %edi
+  801aeb:	5d                   	pop    %ebp
+  801aec:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801aed:	99                   	cltd
+  801aee:	c1 ea 1b             	shr    $0x1b,%edx
+  801af1:	01 d0                	add    %edx,%eax
+  801af3:	83 e0 1f             	and    $0x1f,%eax
+  801af6:	29 d0                	sub    %edx,%eax
+  801af8:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801afd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801b00:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  801b03:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  801b06:	83 c6 01             	add    $0x1,%esi
+  801b09:	eb 9b                	jmp    801aa6 <devpipe_read+0x1e>
+  return i;
+  801b0b:	89 f0                	mov    %esi,%eax
+  801b0d:	eb d6                	jmp    801ae5 <devpipe_read+0x5d>
+        return 0;
+  801b0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b14:	eb cf                	jmp    801ae5 <devpipe_read+0x5d>
+
+00801b16 <pipe2>:
+{
+  801b16:	55                   	push   %ebp
+  801b17:	89 e5                	mov    %esp,%ebp
+  801b19:	57                   	push   %edi
+  801b1a:	56                   	push   %esi
+  801b1b:	53                   	push   %ebx
+  801b1c:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  801b1f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801b22:	50                   	push   %eax
+  801b23:	e8 91 eb ff ff       	call   8006b9 <fd_alloc>
+  801b28:	89 c3                	mov    %eax,%ebx
+  801b2a:	83 c4 10             	add    $0x10,%esp
+  801b2d:	85 c0                	test   %eax,%eax
+  801b2f:	0f 88 fb 01 00 00    	js     801d30 <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801b35:	83 ec 04             	sub    $0x4,%esp
+  801b38:	68 07 04 00 00       	push   $0x407
+  801b3d:	ff 75 e4             	push   -0x1c(%ebp)
+  801b40:	6a 00                	push   $0x0
+  801b42:	e8 79 e6 ff ff       	call   8001c0 <sys_page_alloc>
+  801b47:	89 c3                	mov    %eax,%ebx
+  801b49:	83 c4 10             	add    $0x10,%esp
+  801b4c:	85 c0                	test   %eax,%eax
+  801b4e:	0f 88 dc 01 00 00    	js     801d30 <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  801b54:	83 ec 0c             	sub    $0xc,%esp
+  801b57:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801b5a:	50                   	push   %eax
+  801b5b:	e8 59 eb ff ff       	call   8006b9 <fd_alloc>
+  801b60:	89 c3                	mov    %eax,%ebx
+  801b62:	83 c4 10             	add    $0x10,%esp
+  801b65:	85 c0                	test   %eax,%eax
+  801b67:	0f 88 b3 01 00 00    	js     801d20 <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801b6d:	83 ec 04             	sub    $0x4,%esp
+  801b70:	68 07 04 00 00       	push   $0x407
+  801b75:	ff 75 e0             	push   -0x20(%ebp)
+  801b78:	6a 00                	push   $0x0
+  801b7a:	e8 41 e6 ff ff       	call   8001c0 <sys_page_alloc>
+  801b7f:	89 c3                	mov    %eax,%ebx
+  801b81:	83 c4 10             	add    $0x10,%esp
+  801b84:	85 c0                	test   %eax,%eax
+  801b86:	0f 88 94 01 00 00    	js     801d20 <pipe2+0x20a>
+  va = fd2data(fd0);
+  801b8c:	83 ec 0c             	sub    $0xc,%esp
+  801b8f:	ff 75 e4             	push   -0x1c(%ebp)
+  801b92:	e8 0e eb ff ff       	call   8006a5 <fd2data>
+  801b97:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801b99:	83 c4 0c             	add    $0xc,%esp
+  801b9c:	68 07 04 00 00       	push   $0x407
+  801ba1:	50                   	push   %eax
+  801ba2:	6a 00                	push   $0x0
+  801ba4:	e8 17 e6 ff ff       	call   8001c0 <sys_page_alloc>
+  801ba9:	89 c3                	mov    %eax,%ebx
+  801bab:	83 c4 10             	add    $0x10,%esp
+  801bae:	85 c0                	test   %eax,%eax
+  801bb0:	0f 88 5a 01 00 00    	js     801d10 <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801bb6:	83 ec 0c             	sub    $0xc,%esp
+  801bb9:	ff 75 e0             	push   -0x20(%ebp)
+  801bbc:	e8 e4 ea ff ff       	call   8006a5 <fd2data>
+  801bc1:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  801bc8:	50                   	push   %eax
+  801bc9:	6a 00                	push   $0x0
+  801bcb:	57                   	push   %edi
+  801bcc:	6a 00                	push   $0x0
+  801bce:	e8 30 e6 ff ff       	call   800203 <sys_page_map>
+  801bd3:	89 c3                	mov    %eax,%ebx
+  801bd5:	83 c4 20             	add    $0x20,%esp
+  801bd8:	85 c0                	test   %eax,%eax
+  801bda:	0f 88 22 01 00 00    	js     801d02 <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  801be0:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  801be4:	74 72                	je     801c58 <pipe2+0x142>
+  801be6:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  801beb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801bee:	e8 d3 fa ff ff       	call   8016c6 <pipe_ring>
+  801bf3:	83 ec 04             	sub    $0x4,%esp
+  801bf6:	68 07 04 00 00       	push   $0x407
+  801bfb:	01 f0                	add    %esi,%eax
+  801bfd:	50                   	push   %eax
+  801bfe:	6a 00                	push   $0x0
+  801c00:	e8 bb e5 ff ff       	call   8001c0 <sys_page_alloc>
+  801c05:	89 c3                	mov    %eax,%ebx
+  801c07:	83 c4 10             	add    $0x10,%esp
+  801c0a:	85 c0                	test   %eax,%eax
+  801c0c:	0f 88 97 00 00 00    	js     801ca9 <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  801c12:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801c15:	e8 ac fa ff ff       	call   8016c6 <pipe_ring>
+  801c1a:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  801c1d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801c20:	e8 a1 fa ff ff       	call   8016c6 <pipe_ring>
+  801c25:	83 ec 0c             	sub    $0xc,%esp
+  801c28:	68 07 04 00 00       	push   $0x407
+  801c2d:	53                   	push   %ebx
+  801c2e:	6a 00                	push   $0x0
+  801c30:	01 f0                	add    %esi,%eax
+  801c32:	50                   	push   %eax
+  801c33:	6a 00                	push   $0x0
+  801c35:	e8 c9 e5 ff ff       	call   800203 <sys_page_map>
+  801c3a:	89 c3                	mov    %eax,%ebx
+  801c3c:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801c42:	83 c4 20             	add    $0x20,%esp
+  801c45:	85 c0                	test   %eax,%eax
+  801c47:	78 60                	js     801ca9 <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  801c49:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  801c4f:	75 9a                	jne    801beb <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  801c51:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  801c58:	a1 20 40 80 00       	mov    0x804020,%eax
+  801c5d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801c60:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  801c62:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801c65:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  801c6c:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801c6f:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  801c71:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801c74:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  801c7b:	83 ec 0c             	sub    $0xc,%esp
+  801c7e:	ff 75 e4             	push   -0x1c(%ebp)
+  801c81:	e8 0f ea ff ff       	call   800695 <fd2num>
+  801c86:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801c89:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  801c8b:	83 c4 04             	add    $0x4,%esp
+  801c8e:	ff 75 e0             	push   -0x20(%ebp)
+  801c91:	e8 ff e9 ff ff       	call   800695 <fd2num>
+  801c96:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801c99:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  801c9c:	83 c4 10             	add    $0x10,%esp
+  801c9f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ca4:	e9 87 00 00 00       	jmp    801d30 <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  801ca9:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  801cae:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801cb1:	e8 10 fa ff ff       	call   8016c6 <pipe_ring>
+  801cb6:	83 ec 08             	sub    $0x8,%esp
+  801cb9:	01 f0                	add    %esi,%eax
+  801cbb:	50                   	push   %eax
+  801cbc:	6a 00                	push   $0x0
+  801cbe:	e8 82 e5 ff ff       	call   800245 <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  801cc3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801cc6:	e8 fb f9 ff ff       	call   8016c6 <pipe_ring>
+  801ccb:	83 c4 08             	add    $0x8,%esp
+  801cce:	01 f0                	add    %esi,%eax
+  801cd0:	50                   	push   %eax
+  801cd1:	6a 00                	push   $0x0
+  801cd3:	e8 6d e5 ff ff       	call   800245 <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  801cd8:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801cde:	83 c4 10             	add    $0x10,%esp
+  801ce1:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  801ce7:	75 c5                	jne    801cae <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  801ce9:	83 ec 0c             	sub    $0xc,%esp
+  801cec:	ff 75 e0             	push   -0x20(%ebp)
+  801cef:	e8 b1 e9 ff ff       	call   8006a5 <fd2data>
+  801cf4:	83 c4 08             	add    $0x8,%esp
+  801cf7:	50                   	push   %eax
+  801cf8:	6a 00                	push   $0x0
+  801cfa:	e8 46 e5 ff ff       	call   800245 <sys_page_unmap>
+  801cff:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  801d02:	83 ec 08             	sub    $0x8,%esp
+  801d05:	57                   	push   %edi
+  801d06:	6a 00                	push   $0x0
+  801d08:	e8 38 e5 ff ff       	call   800245 <sys_page_unmap>
+  801d0d:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  801d10:	83 ec 08             	sub    $0x8,%esp
+  801d13:	ff 75 e0             	push   -0x20(%ebp)
+  801d16:	6a 00                	push   $0x0
+  801d18:	e8 28 e5 ff ff       	call   800245 <sys_page_unmap>
+  801d1d:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  801d20:	83 ec 08             	sub    $0x8,%esp
+  801d23:	ff 75 e4             	push   -0x1c(%ebp)
+  801d26:	6a 00                	push   $0x0
+  801d28:	e8 18 e5 ff ff       	call   800245 <sys_page_unmap>
+  801d2d:	83 c4 10             	add    $0x10,%esp
+}
+  801d30:	89 d8                	mov    %ebx,%eax
+  801d32:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d35:	5b                   	pop    %ebx
+  801d36:	5e                   	pop    %esi
+  801d37:	5f                   	pop    %edi
+  801d38:	5d                   	pop    %ebp
+  801d39:	c3                   	ret
+
+00801d3a <pipe>:
+{
+  801d3a:	55                   	push   %ebp
+  801d3b:	89 e5                	mov    %esp,%ebp
+  801d3d:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  801d40:	6a 00                	push   $0x0
+  801d42:	ff 75 08             	push   0x8(%ebp)
+  801d45:	e8 cc fd ff ff       	call   801b16 <pipe2>
+}
+  801d4a:	c9                   	leave
+  801d4b:	c3                   	ret
+
+00801d4c <pipeisclosed>:
+{
+  801d4c:	55                   	push   %ebp
+  801d4d:	89 e5                	mov    %esp,%ebp
+  801d4f:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801d52:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d55:	50                   	push   %eax
+  801d56:	ff 75 08             	push   0x8(%ebp)
+  801d59:	e8 b1 e9 ff ff       	call   80070f <fd_lookup>
+  801d5e:	83 c4 10             	add    $0x10,%esp
+  801d61:	85 c0                	test   %eax,%eax
+  801d63:	78 18                	js     801d7d <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  801d65:	83 ec 0c             	sub    $0xc,%esp
+  801d68:	ff 75 f4             	push   -0xc(%ebp)
+  801d6b:	e8 35 e9 ff ff       	call   8006a5 <fd2data>
+  801d70:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  801d72:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d75:	e8 59 fa ff ff       	call   8017d3 <_pipeisclosed>
+  801d7a:	83 c4 10             	add    $0x10,%esp
+}
+  801d7d:	c9                   	leave
+  801d7e:	c3                   	ret
+
+00801d7f <pipe_splice>:
+{
+  801d7f:	55                   	push   %ebp
+  801d80:	89 e5                	mov    %esp,%ebp
+  801d82:	57                   	push   %edi
+  801d83:	56                   	push   %esi
+  801d84:	53                   	push   %ebx
+  801d85:	83 ec 34             	sub    $0x34,%esp
+  801d88:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801d8b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801d8e:	50                   	push   %eax
+  801d8f:	ff 75 08             	push   0x8(%ebp)
+  801d92:	e8 78 e9 ff ff       	call   80070f <fd_lookup>
+  801d97:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801d9a:	83 c4 10             	add    $0x10,%esp
+  801d9d:	85 c0                	test   %eax,%eax
+  801d9f:	0f 88 d7 00 00 00    	js     801e7c <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  801da5:	83 ec 0c             	sub    $0xc,%esp
+  801da8:	ff 75 e4             	push   -0x1c(%ebp)
+  801dab:	e8 f5 e8 ff ff       	call   8006a5 <fd2data>
+  801db0:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  801db2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801db5:	83 c4 10             	add    $0x10,%esp
+  801db8:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801dbe:	39 10                	cmp    %edx,(%eax)
+  801dc0:	0f 85 c1 00 00 00    	jne    801e87 <pipe_splice+0x108>
+  801dc6:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  801dca:	0f 84 c0 00 00 00    	je     801e90 <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  801dd0:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  801dd4:	0f 84 bf 00 00 00    	je     801e99 <pipe_splice+0x11a>
+  801dda:	89 f7                	mov    %esi,%edi
+  801ddc:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  801de2:	0f 85 ba 00 00 00    	jne    801ea2 <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  801de8:	8d 43 04             	lea    0x4(%ebx),%eax
+  801deb:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801dee:	eb 38                	jmp    801e28 <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  801df0:	83 ec 0c             	sub    $0xc,%esp
+  801df3:	68 00 10 00 00       	push   $0x1000
+  801df8:	89 f1                	mov    %esi,%ecx
+  801dfa:	89 da                	mov    %ebx,%edx
+  801dfc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801dff:	e8 34 fa ff ff       	call   801838 <devpipe_write_bulk>
+  801e04:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801e07:	83 c4 10             	add    $0x10,%esp
+  801e0a:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801e0f:	75 53                	jne    801e64 <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  801e11:	83 ec 08             	sub    $0x8,%esp
+  801e14:	56                   	push   %esi
+  801e15:	6a 00                	push   $0x0
+  801e17:	e8 29 e4 ff ff       	call   800245 <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  801e1c:	83 c7 01             	add    $0x1,%edi
+  801e1f:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801e25:	83 c4 10             	add    $0x10,%esp
+  801e28:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801e2b:	74 3a                	je     801e67 <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  801e2d:	8b 03                	mov    (%ebx),%eax
+  801e2f:	39 43 04             	cmp    %eax,0x4(%ebx)
+  801e32:	75 bc                	jne    801df0 <pipe_splice+0x71>
+  801e34:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e39:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  801e3d:	85 c0                	test   %eax,%eax
+  801e3f:	74 af                	je     801df0 <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  801e41:	83 ec 04             	sub    $0x4,%esp
+  801e44:	6a 07                	push   $0x7
+  801e46:	56                   	push   %esi
+  801e47:	ff 75 d0             	push   -0x30(%ebp)
+  801e4a:	e8 cd e6 ff ff       	call   80051c <sys_chan_wakeup>
+  801e4f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801e52:	83 c4 10             	add    $0x10,%esp
+  801e55:	85 c0                	test   %eax,%eax
+  801e57:	79 b8                	jns    801e11 <pipe_splice+0x92>
+  801e59:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e5e:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  801e62:	eb 8c                	jmp    801df0 <pipe_splice+0x71>
+  801e64:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  801e67:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801e6b:	75 06                	jne    801e73 <pipe_splice+0xf4>
+  801e6d:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  801e71:	78 09                	js     801e7c <pipe_splice+0xfd>
+  return i * PGSIZE;
+  801e73:	8b 45 10             	mov    0x10(%ebp),%eax
+  801e76:	c1 e0 0c             	shl    $0xc,%eax
+  801e79:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  801e7c:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801e7f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e82:	5b                   	pop    %ebx
+  801e83:	5e                   	pop    %esi
+  801e84:	5f                   	pop    %edi
+  801e85:	5d                   	pop    %ebp
+  801e86:	c3                   	ret
+    return -E_INVAL;
+  801e87:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  801e8e:	eb ec                	jmp    801e7c <pipe_splice+0xfd>
+  801e90:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  801e97:	eb e3                	jmp    801e7c <pipe_splice+0xfd>
+  801e99:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  801ea0:	eb da                	jmp    801e7c <pipe_splice+0xfd>
+  801ea2:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  801ea9:	eb d1                	jmp    801e7c <pipe_splice+0xfd>
+
+00801eab <pipe_splice_read>:
+{
+  801eab:	55                   	push   %ebp
+  801eac:	89 e5                	mov    %esp,%ebp
+  801eae:	53                   	push   %ebx
+  801eaf:	83 ec 1c             	sub    $0x1c,%esp
+  801eb2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801eb5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801eb8:	50                   	push   %eax
+  801eb9:	ff 75 08             	push   0x8(%ebp)
+  801ebc:	e8 4e e8 ff ff       	call   80070f <fd_lookup>
+  801ec1:	83 c4 10             	add    $0x10,%esp
+  801ec4:	85 c0                	test   %eax,%eax
+  801ec6:	78 49                	js     801f11 <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  801ec8:	83 ec 0c             	sub    $0xc,%esp
+  801ecb:	ff 75 f4             	push   -0xc(%ebp)
+  801ece:	e8 d2 e7 ff ff       	call   8006a5 <fd2data>
+  801ed3:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  801ed5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ed8:	83 c4 10             	add    $0x10,%esp
+  801edb:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  801ee1:	39 08                	cmp    %ecx,(%eax)
+  801ee3:	75 31                	jne    801f16 <pipe_splice_read+0x6b>
+  801ee5:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  801ee9:	74 32                	je     801f1d <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  801eeb:	8b 48 08             	mov    0x8(%eax),%ecx
+  801eee:	83 e1 03             	and    $0x3,%ecx
+  801ef1:	83 f9 01             	cmp    $0x1,%ecx
+  801ef4:	74 2e                	je     801f24 <pipe_splice_read+0x79>
+  801ef6:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  801efc:	75 2d                	jne    801f2b <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  801efe:	83 ec 08             	sub    $0x8,%esp
+  801f01:	53                   	push   %ebx
+  801f02:	68 00 10 00 00       	push   $0x1000
+  801f07:	89 d9                	mov    %ebx,%ecx
+  801f09:	e8 93 fa ff ff       	call   8019a1 <devpipe_read_bulk>
+  801f0e:	83 c4 10             	add    $0x10,%esp
+}
+  801f11:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f14:	c9                   	leave
+  801f15:	c3                   	ret
+    return -E_INVAL;
+  801f16:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f1b:	eb f4                	jmp    801f11 <pipe_splice_read+0x66>
+  801f1d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f22:	eb ed                	jmp    801f11 <pipe_splice_read+0x66>
+  801f24:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f29:	eb e6                	jmp    801f11 <pipe_splice_read+0x66>
+  801f2b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f30:	eb df                	jmp    801f11 <pipe_splice_read+0x66>
+
+00801f32 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  801f32:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f37:	c3                   	ret
+
+00801f38 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  801f38:	55                   	push   %ebp
+  801f39:	89 e5                	mov    %esp,%ebp
+  801f3b:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  801f3e:	68 2f 30 80 00       	push   $0x80302f
+  801f43:	ff 75 0c             	push   0xc(%ebp)
+  801f46:	e8 24 08 00 00       	call   80276f <strcpy>
+  return 0;
+}
+  801f4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f50:	c9                   	leave
+  801f51:	c3                   	ret
+
+00801f52 <devcons_write>:
+{
+  801f52:	55                   	push   %ebp
+  801f53:	89 e5                	mov    %esp,%ebp
+  801f55:	57                   	push   %edi
+  801f56:	56                   	push   %esi
+  801f57:	53                   	push   %ebx
+  801f58:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  801f5e:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  801f63:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  801f69:	eb 2e                	jmp    801f99 <devcons_write+0x47>
+    m = n - tot;
+  801f6b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f6e:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  801f70:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801f75:	39 c3                	cmp    %eax,%ebx
+  801f77:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  801f7a:	83 ec 04             	sub    $0x4,%esp
+  801f7d:	53                   	push   %ebx
+  801f7e:	89 f0                	mov    %esi,%eax
+  801f80:	03 45 0c             	add    0xc(%ebp),%eax
+  801f83:	50                   	push   %eax
+  801f84:	57                   	push   %edi
+  801f85:	e8 6b 09 00 00       	call   8028f5 <memmove>
+    sys_cputs(buf, m);
+  801f8a:	83 c4 08             	add    $0x8,%esp
+  801f8d:	53                   	push   %ebx
+  801f8e:	57                   	push   %edi
+  801f8f:	e8 2d e1 ff ff       	call   8000c1 <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  801f94:	01 de                	add    %ebx,%esi
+  801f96:	83 c4 10             	add    $0x10,%esp
+  801f99:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801f9c:	72 cd                	jb     801f6b <devcons_write+0x19>
+}
+  801f9e:	89 f0                	mov    %esi,%eax
+  801fa0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fa3:	5b                   	pop    %ebx
+  801fa4:	5e                   	pop    %esi
+  801fa5:	5f                   	pop    %edi
+  801fa6:	5d                   	pop    %ebp
+  801fa7:	c3                   	ret
+
+00801fa8 <devcons_read>:
+{
+  801fa8:	55                   	push   %ebp
+  801fa9:	89 e5                	mov    %esp,%ebp
+  801fab:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  801fae:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fb3:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801fb7:	75 07                	jne    801fc0 <devcons_read+0x18>
+  801fb9:	eb 1f                	jmp    801fda <devcons_read+0x32>
+    sys_yield();
+  801fbb:	e8 9e e1 ff ff       	call   80015e <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  801fc0:	e8 1a e1 ff ff       	call   8000df <sys_cgetc>
+  801fc5:	85 c0                	test   %eax,%eax
+  801fc7:	74 f2                	je     801fbb <devcons_read+0x13>
+  if (c < 0)
+  801fc9:	78 0f                	js     801fda <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  801fcb:	83 f8 04             	cmp    $0x4,%eax
+  801fce:	74 0c                	je     801fdc <devcons_read+0x34>
+  *(char*)vbuf = c;
+  801fd0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801fd3:	88 02                	mov    %al,(%edx)
+  return 1;
+  801fd5:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  801fda:	c9                   	leave
+  801fdb:	c3                   	ret
+    return 0;
+  801fdc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fe1:	eb f7                	jmp    801fda <devcons_read+0x32>
+
+00801fe3 <cputchar>:
+{
+  801fe3:	55                   	push   %ebp
+  801fe4:	89 e5                	mov    %esp,%ebp
+  801fe6:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  801fe9:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fec:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  801fef:	6a 01                	push   $0x1
+  801ff1:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801ff4:	50                   	push   %eax
+  801ff5:	e8 c7 e0 ff ff       	call   8000c1 <sys_cputs>
+}
+  801ffa:	83 c4 10             	add    $0x10,%esp
+  801ffd:	c9                   	leave
+  801ffe:	c3                   	ret
+
+00801fff <getchar>:
+{
+  801fff:	55                   	push   %ebp
+  802000:	89 e5                	mov    %esp,%ebp
+  802002:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  802005:	6a 01                	push   $0x1
+  802007:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80200a:	50                   	push   %eax
+  80200b:	6a 00                	push   $0x0
+  80200d:	e8 a8 e9 ff ff       	call   8009ba <read>
+  if (r < 0)
+  802012:	83 c4 10             	add    $0x10,%esp
+  802015:	85 c0                	test   %eax,%eax
+  802017:	78 06                	js     80201f <getchar+0x20>
+  if (r < 1)
+  802019:	74 06                	je     802021 <getchar+0x22>
+  return c;
+  80201b:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80201f:	c9                   	leave
+  802020:	c3                   	ret
+    return -E_EOF;
+  802021:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802026:	eb f7                	jmp    80201f <getchar+0x20>
+
+00802028 <iscons>:
+{
+  802028:	55                   	push   %ebp
+  802029:	89 e5                	mov    %esp,%ebp
+  80202b:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80202e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802031:	50                   	push   %eax
+  802032:	ff 75 08             	push   0x8(%ebp)
+  802035:	e8 d5 e6 ff ff       	call   80070f <fd_lookup>
+  80203a:	83 c4 10             	add    $0x10,%esp
+  80203d:	85 c0                	test   %eax,%eax
+  80203f:	78 11                	js     802052 <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  802041:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802044:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  80204a:	39 10                	cmp    %edx,(%eax)
+  80204c:	0f 94 c0             	sete   %al
+  80204f:	0f b6 c0             	movzbl %al,%eax
+}
+  802052:	c9                   	leave
+  802053:	c3                   	ret
+
+00802054 <opencons>:
+{
+  802054:	55                   	push   %ebp
+  802055:	89 e5                	mov    %esp,%ebp
+  802057:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  80205a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80205d:	50                   	push   %eax
+  80205e:	e8 56 e6 ff ff       	call   8006b9 <fd_alloc>
+  802063:	83 c4 10             	add    $0x10,%esp
+  802066:	85 c0                	test   %eax,%eax
+  802068:	78 3a                	js     8020a4 <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80206a:	83 ec 04             	sub    $0x4,%esp
+  80206d:	68 07 04 00 00       	push   $0x407
+  802072:	ff 75 f4             	push   -0xc(%ebp)
+  802075:	6a 00                	push   $0x0
+  802077:	e8 44 e1 ff ff       	call   8001c0 <sys_page_alloc>
+  80207c:	83 c4 10             	add    $0x10,%esp
+  80207f:	85 c0                	test   %eax,%eax
+  802081:	78 21                	js     8020a4 <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  802083:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802086:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  80208c:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  80208e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802091:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  802098:	83 ec 0c             	sub    $0xc,%esp
+  80209b:	50                   	push   %eax
+  80209c:	e8 f4 e5 ff ff       	call   800695 <fd2num>
+  8020a1:	83 c4 10             	add    $0x10,%esp
+}
+  8020a4:	c9                   	leave
+  8020a5:	c3                   	ret
+
+008020a6 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8020a6:	55                   	push   %ebp
+  8020a7:	89 e5                	mov    %esp,%ebp
+  8020a9:	56                   	push   %esi
+  8020aa:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  8020ab:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  8020ae:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  8020b4:	e8 86 e0 ff ff       	call   80013f <sys_getenvid>
+  8020b9:	83 ec 0c             	sub    $0xc,%esp
+  8020bc:	ff 75 0c             	push   0xc(%ebp)
+  8020bf:	ff 75 08             	push   0x8(%ebp)
+  8020c2:	56                   	push   %esi
+  8020c3:	50                   	push   %eax
+  8020c4:	68 3c 30 80 00       	push   $0x80303c
+  8020c9:	e8 b3 00 00 00       	call   802181 <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  8020ce:	83 c4 18             	add    $0x18,%esp
+  8020d1:	53                   	push   %ebx
+  8020d2:	ff 75 10             	push   0x10(%ebp)
+  8020d5:	e8 56 00 00 00       	call   802130 <vcprintf>
+  cprintf("\n");
+  8020da:	c7 04 24 28 30 80 00 	movl   $0x803028,(%esp)
+  8020e1:	e8 9b 00 00 00       	call   802181 <cprintf>
+  8020e6:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  8020e9:	cc                   	int3
+  while (1)
+  8020ea:	eb fd                	jmp    8020e9 <_panic+0x43>
+
+008020ec <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8020ec:	55                   	push   %ebp
+  8020ed:	89 e5                	mov    %esp,%ebp
+  8020ef:	53                   	push   %ebx
+  8020f0:	83 ec 04             	sub    $0x4,%esp
+  8020f3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  8020f6:	8b 13                	mov    (%ebx),%edx
+  8020f8:	8d 42 01             	lea    0x1(%edx),%eax
+  8020fb:	89 03                	mov    %eax,(%ebx)
+  8020fd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802100:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  802104:	3d ff 00 00 00       	cmp    $0xff,%eax
+  802109:	74 09                	je     802114 <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  80210b:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80210f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802112:	c9                   	leave
+  802113:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  802114:	83 ec 08             	sub    $0x8,%esp
+  802117:	68 ff 00 00 00       	push   $0xff
+  80211c:	8d 43 08             	lea    0x8(%ebx),%eax
+  80211f:	50                   	push   %eax
+  802120:	e8 9c df ff ff       	call   8000c1 <sys_cputs>
+    b->idx = 0;
+  802125:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80212b:	83 c4 10             	add    $0x10,%esp
+  80212e:	eb db                	jmp    80210b <putch+0x1f>
+
+00802130 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  802130:	55                   	push   %ebp
+  802131:	89 e5                	mov    %esp,%ebp
+  802133:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  802139:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  802140:	00 00 00 
+  b.cnt = 0;
+  802143:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80214a:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  80214d:	ff 75 0c             	push   0xc(%ebp)
+  802150:	ff 75 08             	push   0x8(%ebp)
+  802153:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  802159:	50                   	push   %eax
+  80215a:	68 ec 20 80 00       	push   $0x8020ec
+  80215f:	e8 14 01 00 00       	call   802278 <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  802164:	83 c4 08             	add    $0x8,%esp
+  802167:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80216d:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  802173:	50                   	push   %eax
+  802174:	e8 48 df ff ff       	call   8000c1 <sys_cputs>
+
+  return b.cnt;
+}
+  802179:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80217f:	c9                   	leave
+  802180:	c3                   	ret
+
+00802181 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  802181:	55                   	push   %ebp
+  802182:	89 e5                	mov    %esp,%ebp
+  802184:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  802187:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  80218a:	50                   	push   %eax
+  80218b:	ff 75 08             	push   0x8(%ebp)
+  80218e:	e8 9d ff ff ff       	call   802130 <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  802193:	c9                   	leave
+  802194:	c3                   	ret
+
+00802195 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  802195:	55                   	push   %ebp
+  802196:	89 e5                	mov    %esp,%ebp
+  802198:	57                   	push   %edi
+  802199:	56                   	push   %esi
+  80219a:	53                   	push   %ebx
+  80219b:	83 ec 1c             	sub    $0x1c,%esp
+  80219e:	89 c7                	mov    %eax,%edi
+  8021a0:	89 d6                	mov    %edx,%esi
+  8021a2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021a5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8021a8:	89 d1                	mov    %edx,%ecx
+  8021aa:	89 c2                	mov    %eax,%edx
+  8021ac:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8021af:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8021b2:	8b 45 10             	mov    0x10(%ebp),%eax
+  8021b5:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  8021b8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8021bb:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8021c2:	39 c2                	cmp    %eax,%edx
+  8021c4:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8021c7:	72 3e                	jb     802207 <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  8021c9:	83 ec 0c             	sub    $0xc,%esp
+  8021cc:	ff 75 18             	push   0x18(%ebp)
+  8021cf:	83 eb 01             	sub    $0x1,%ebx
+  8021d2:	53                   	push   %ebx
+  8021d3:	50                   	push   %eax
+  8021d4:	83 ec 08             	sub    $0x8,%esp
+  8021d7:	ff 75 e4             	push   -0x1c(%ebp)
+  8021da:	ff 75 e0             	push   -0x20(%ebp)
+  8021dd:	ff 75 dc             	push   -0x24(%ebp)
+  8021e0:	ff 75 d8             	push   -0x28(%ebp)
+  8021e3:	e8 63 0b 00 00       	call   802d4b <__udivdi3>
+  8021e8:	83 c4 18             	add    $0x18,%esp
+  8021eb:	52                   	push   %edx
+  8021ec:	50                   	push   %eax
+  8021ed:	89 f2                	mov    %esi,%edx
+  8021ef:	89 f8                	mov    %edi,%eax
+  8021f1:	e8 9f ff ff ff       	call   802195 <printnum>
+  8021f6:	83 c4 20             	add    $0x20,%esp
+  8021f9:	eb 13                	jmp    80220e <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  8021fb:	83 ec 08             	sub    $0x8,%esp
+  8021fe:	56                   	push   %esi
+  8021ff:	ff 75 18             	push   0x18(%ebp)
+  802202:	ff d7                	call   *%edi
+  802204:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  802207:	83 eb 01             	sub    $0x1,%ebx
+  80220a:	85 db                	test   %ebx,%ebx
+  80220c:	7f ed                	jg     8021fb <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  80220e:	83 ec 08             	sub    $0x8,%esp
+  802211:	56                   	push   %esi
+  802212:	83 ec 04             	sub    $0x4,%esp
+  802215:	ff 75 e4             	push   -0x1c(%ebp)
+  802218:	ff 75 e0             	push   -0x20(%ebp)
+  80221b:	ff 75 dc             	push   -0x24(%ebp)
+  80221e:	ff 75 d8             	push   -0x28(%ebp)
+  802221:	e8 46 0b 00 00       	call   802d6c <__umoddi3>
+  802226:	83 c4 14             	add    $0x14,%esp
+  802229:	0f be 80 5f 30 80 00 	movsbl 0x80305f(%eax),%eax
+  802230:	50                   	push   %eax
+  802231:	ff d7                	call   *%edi
+}
+  802233:	83 c4 10             	add    $0x10,%esp
+  802236:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802239:	5b                   	pop    %ebx
+  80223a:	5e                   	pop    %esi
+  80223b:	5f                   	pop    %edi
+  80223c:	5d                   	pop    %ebp
+  80223d:	c3                   	ret
+
+0080223e <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80223e:	55                   	push   %ebp
+  80223f:	89 e5                	mov    %esp,%ebp
+  802241:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  802244:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  802248:	8b 10                	mov    (%eax),%edx
+  80224a:	3b 50 04             	cmp    0x4(%eax),%edx
+  80224d:	73 0a                	jae    802259 <sprintputch+0x1b>
+    *b->buf++ = ch;
+  80224f:	8d 4a 01             	lea    0x1(%edx),%ecx
+  802252:	89 08                	mov    %ecx,(%eax)
+  802254:	8b 45 08             	mov    0x8(%ebp),%eax
+  802257:	88 02                	mov    %al,(%edx)
+}
+  802259:	5d                   	pop    %ebp
+  80225a:	c3                   	ret
+
+0080225b <printfmt>:
+{
+  80225b:	55                   	push   %ebp
+  80225c:	89 e5                	mov    %esp,%ebp
+  80225e:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  802261:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  802264:	50                   	push   %eax
+  802265:	ff 75 10             	push   0x10(%ebp)
+  802268:	ff 75 0c             	push   0xc(%ebp)
+  80226b:	ff 75 08             	push   0x8(%ebp)
+  80226e:	e8 05 00 00 00       	call   802278 <vprintfmt>
+}
+  802273:	83 c4 10             	add    $0x10,%esp
+  802276:	c9                   	leave
+  802277:	c3                   	ret
+
+00802278 <vprintfmt>:
+{
+  802278:	55                   	push   %ebp
+  802279:	89 e5                	mov    %esp,%ebp
+  80227b:	57                   	push   %edi
+  80227c:	56                   	push   %esi
+  80227d:	53                   	push   %ebx
+  80227e:	83 ec 2c             	sub    $0x2c,%esp
+  802281:	8b 75 08             	mov    0x8(%ebp),%esi
+  802284:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802287:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80228a:	eb 0a                	jmp    802296 <vprintfmt+0x1e>
+      putch(ch, putdat);
+  80228c:	83 ec 08             	sub    $0x8,%esp
+  80228f:	53                   	push   %ebx
+  802290:	50                   	push   %eax
+  802291:	ff d6                	call   *%esi
+  802293:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  802296:	83 c7 01             	add    $0x1,%edi
+  802299:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80229d:	83 f8 25             	cmp    $0x25,%eax
+  8022a0:	74 0c                	je     8022ae <vprintfmt+0x36>
+      if (ch == '\0')
+  8022a2:	85 c0                	test   %eax,%eax
+  8022a4:	75 e6                	jne    80228c <vprintfmt+0x14>
+}
+  8022a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022a9:	5b                   	pop    %ebx
+  8022aa:	5e                   	pop    %esi
+  8022ab:	5f                   	pop    %edi
+  8022ac:	5d                   	pop    %ebp
+  8022ad:	c3                   	ret
+    padc = ' ';
+  8022ae:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  8022b2:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  8022b9:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  8022c0:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  8022c7:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  8022cc:	8d 47 01             	lea    0x1(%edi),%eax
+  8022cf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8022d2:	0f b6 17             	movzbl (%edi),%edx
+  8022d5:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8022d8:	3c 55                	cmp    $0x55,%al
+  8022da:	0f 87 cf 03 00 00    	ja     8026af <vprintfmt+0x437>
+  8022e0:	0f b6 c0             	movzbl %al,%eax
+  8022e3:	ff 24 85 a0 31 80 00 	jmp    *0x8031a0(,%eax,4)
+  8022ea:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  8022ed:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8022f1:	eb d9                	jmp    8022cc <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  8022f3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8022f6:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8022fa:	eb d0                	jmp    8022cc <vprintfmt+0x54>
+  8022fc:	0f b6 d2             	movzbl %dl,%edx
+  8022ff:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  802302:	b8 00 00 00 00       	mov    $0x0,%eax
+  802307:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  80230a:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80230d:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  802311:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  802314:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  802317:	83 f9 09             	cmp    $0x9,%ecx
+  80231a:	77 55                	ja     802371 <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  80231c:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  80231f:	eb e9                	jmp    80230a <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  802321:	8b 45 14             	mov    0x14(%ebp),%eax
+  802324:	8b 00                	mov    (%eax),%eax
+  802326:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802329:	8b 45 14             	mov    0x14(%ebp),%eax
+  80232c:	8d 40 04             	lea    0x4(%eax),%eax
+  80232f:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  802332:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  802335:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  802339:	79 91                	jns    8022cc <vprintfmt+0x54>
+        width = precision, precision = -1;
+  80233b:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80233e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802341:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  802348:	eb 82                	jmp    8022cc <vprintfmt+0x54>
+      if (width < 0)
+  80234a:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80234d:	85 d2                	test   %edx,%edx
+  80234f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802354:	0f 49 c2             	cmovns %edx,%eax
+  802357:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  80235a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  80235d:	e9 6a ff ff ff       	jmp    8022cc <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  802362:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  802365:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  80236c:	e9 5b ff ff ff       	jmp    8022cc <vprintfmt+0x54>
+  802371:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802374:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802377:	eb bc                	jmp    802335 <vprintfmt+0xbd>
+      lflag++;
+  802379:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  80237c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  80237f:	e9 48 ff ff ff       	jmp    8022cc <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  802384:	8b 45 14             	mov    0x14(%ebp),%eax
+  802387:	8d 78 04             	lea    0x4(%eax),%edi
+  80238a:	83 ec 08             	sub    $0x8,%esp
+  80238d:	53                   	push   %ebx
+  80238e:	ff 30                	push   (%eax)
+  802390:	ff d6                	call   *%esi
+      break;
+  802392:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  802395:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  802398:	e9 b1 02 00 00       	jmp    80264e <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  80239d:	8b 45 14             	mov    0x14(%ebp),%eax
+  8023a0:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  8023a3:	8b 10                	mov    (%eax),%edx
+  8023a5:	89 d0                	mov    %edx,%eax
+  8023a7:	f7 d8                	neg    %eax
+  8023a9:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8023ac:	83 f8 10             	cmp    $0x10,%eax
+  8023af:	7f 23                	jg     8023d4 <vprintfmt+0x15c>
+  8023b1:	8b 14 85 00 33 80 00 	mov    0x803300(,%eax,4),%edx
+  8023b8:	85 d2                	test   %edx,%edx
+  8023ba:	74 18                	je     8023d4 <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  8023bc:	52                   	push   %edx
+  8023bd:	68 d2 2f 80 00       	push   $0x802fd2
+  8023c2:	53                   	push   %ebx
+  8023c3:	56                   	push   %esi
+  8023c4:	e8 92 fe ff ff       	call   80225b <printfmt>
+  8023c9:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  8023cc:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8023cf:	e9 7a 02 00 00       	jmp    80264e <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  8023d4:	50                   	push   %eax
+  8023d5:	68 77 30 80 00       	push   $0x803077
+  8023da:	53                   	push   %ebx
+  8023db:	56                   	push   %esi
+  8023dc:	e8 7a fe ff ff       	call   80225b <printfmt>
+  8023e1:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  8023e4:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  8023e7:	e9 62 02 00 00       	jmp    80264e <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  8023ec:	8b 45 14             	mov    0x14(%ebp),%eax
+  8023ef:	83 c0 04             	add    $0x4,%eax
+  8023f2:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8023f5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8023f8:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  8023fa:	85 c9                	test   %ecx,%ecx
+  8023fc:	b8 70 30 80 00       	mov    $0x803070,%eax
+  802401:	0f 45 c1             	cmovne %ecx,%eax
+  802404:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  802407:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80240b:	7e 06                	jle    802413 <vprintfmt+0x19b>
+  80240d:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  802411:	75 0b                	jne    80241e <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  802413:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  802416:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  802419:	89 75 08             	mov    %esi,0x8(%ebp)
+  80241c:	eb 5c                	jmp    80247a <vprintfmt+0x202>
+  80241e:	83 ec 08             	sub    $0x8,%esp
+  802421:	ff 75 d0             	push   -0x30(%ebp)
+  802424:	ff 75 cc             	push   -0x34(%ebp)
+  802427:	e8 20 03 00 00       	call   80274c <strnlen>
+  80242c:	89 c2                	mov    %eax,%edx
+  80242e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802431:	29 d0                	sub    %edx,%eax
+  802433:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  802436:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80243a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80243d:	89 75 08             	mov    %esi,0x8(%ebp)
+  802440:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  802442:	eb 0e                	jmp    802452 <vprintfmt+0x1da>
+          putch(padc, putdat);
+  802444:	83 ec 08             	sub    $0x8,%esp
+  802447:	53                   	push   %ebx
+  802448:	57                   	push   %edi
+  802449:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  80244c:	83 ee 01             	sub    $0x1,%esi
+  80244f:	83 c4 10             	add    $0x10,%esp
+  802452:	85 f6                	test   %esi,%esi
+  802454:	7f ee                	jg     802444 <vprintfmt+0x1cc>
+  802456:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802459:	8b 75 08             	mov    0x8(%ebp),%esi
+  80245c:	85 c0                	test   %eax,%eax
+  80245e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802463:	0f 49 d0             	cmovns %eax,%edx
+  802466:	29 d0                	sub    %edx,%eax
+  802468:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80246b:	eb a6                	jmp    802413 <vprintfmt+0x19b>
+          putch(ch, putdat);
+  80246d:	83 ec 08             	sub    $0x8,%esp
+  802470:	53                   	push   %ebx
+  802471:	52                   	push   %edx
+  802472:	ff 55 08             	call   *0x8(%ebp)
+  802475:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  802478:	89 f1                	mov    %esi,%ecx
+  80247a:	8d 71 01             	lea    0x1(%ecx),%esi
+  80247d:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  802481:	0f be d0             	movsbl %al,%edx
+  802484:	85 d2                	test   %edx,%edx
+  802486:	74 28                	je     8024b0 <vprintfmt+0x238>
+  802488:	85 ff                	test   %edi,%edi
+  80248a:	78 05                	js     802491 <vprintfmt+0x219>
+  80248c:	83 ef 01             	sub    $0x1,%edi
+  80248f:	78 30                	js     8024c1 <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  802491:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  802495:	74 d6                	je     80246d <vprintfmt+0x1f5>
+  802497:	0f be c0             	movsbl %al,%eax
+  80249a:	83 e8 20             	sub    $0x20,%eax
+  80249d:	83 f8 5e             	cmp    $0x5e,%eax
+  8024a0:	76 cb                	jbe    80246d <vprintfmt+0x1f5>
+          putch('?', putdat);
+  8024a2:	83 ec 08             	sub    $0x8,%esp
+  8024a5:	53                   	push   %ebx
+  8024a6:	6a 3f                	push   $0x3f
+  8024a8:	ff 55 08             	call   *0x8(%ebp)
+  8024ab:	83 c4 10             	add    $0x10,%esp
+  8024ae:	eb c8                	jmp    802478 <vprintfmt+0x200>
+  8024b0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8024b3:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8024b6:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8024b9:	01 d0                	add    %edx,%eax
+  8024bb:	29 c8                	sub    %ecx,%eax
+  8024bd:	89 c7                	mov    %eax,%edi
+  8024bf:	eb 13                	jmp    8024d4 <vprintfmt+0x25c>
+  8024c1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8024c4:	eb ed                	jmp    8024b3 <vprintfmt+0x23b>
+        putch(' ', putdat);
+  8024c6:	83 ec 08             	sub    $0x8,%esp
+  8024c9:	53                   	push   %ebx
+  8024ca:	6a 20                	push   $0x20
+  8024cc:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  8024ce:	83 ef 01             	sub    $0x1,%edi
+  8024d1:	83 c4 10             	add    $0x10,%esp
+  8024d4:	85 ff                	test   %edi,%edi
+  8024d6:	7f ee                	jg     8024c6 <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  8024d8:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8024db:	89 45 14             	mov    %eax,0x14(%ebp)
+  8024de:	e9 6b 01 00 00       	jmp    80264e <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  8024e3:	83 f9 01             	cmp    $0x1,%ecx
+  8024e6:	7f 1f                	jg     802507 <vprintfmt+0x28f>
+  else if (lflag)
+  8024e8:	85 c9                	test   %ecx,%ecx
+  8024ea:	74 67                	je     802553 <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  8024ec:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024ef:	8b 00                	mov    (%eax),%eax
+  8024f1:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8024f4:	89 c1                	mov    %eax,%ecx
+  8024f6:	c1 f9 1f             	sar    $0x1f,%ecx
+  8024f9:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8024fc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024ff:	8d 40 04             	lea    0x4(%eax),%eax
+  802502:	89 45 14             	mov    %eax,0x14(%ebp)
+  802505:	eb 17                	jmp    80251e <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  802507:	8b 45 14             	mov    0x14(%ebp),%eax
+  80250a:	8b 50 04             	mov    0x4(%eax),%edx
+  80250d:	8b 00                	mov    (%eax),%eax
+  80250f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802512:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  802515:	8b 45 14             	mov    0x14(%ebp),%eax
+  802518:	8d 40 08             	lea    0x8(%eax),%eax
+  80251b:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  80251e:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802521:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  802524:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  802529:	85 c9                	test   %ecx,%ecx
+  80252b:	0f 89 03 01 00 00    	jns    802634 <vprintfmt+0x3bc>
+        putch('-', putdat);
+  802531:	83 ec 08             	sub    $0x8,%esp
+  802534:	53                   	push   %ebx
+  802535:	6a 2d                	push   $0x2d
+  802537:	ff d6                	call   *%esi
+        num = -(long long)num;
+  802539:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80253c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80253f:	f7 da                	neg    %edx
+  802541:	83 d1 00             	adc    $0x0,%ecx
+  802544:	f7 d9                	neg    %ecx
+  802546:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  802549:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80254e:	e9 e1 00 00 00       	jmp    802634 <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  802553:	8b 45 14             	mov    0x14(%ebp),%eax
+  802556:	8b 00                	mov    (%eax),%eax
+  802558:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80255b:	89 c1                	mov    %eax,%ecx
+  80255d:	c1 f9 1f             	sar    $0x1f,%ecx
+  802560:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802563:	8b 45 14             	mov    0x14(%ebp),%eax
+  802566:	8d 40 04             	lea    0x4(%eax),%eax
+  802569:	89 45 14             	mov    %eax,0x14(%ebp)
+  80256c:	eb b0                	jmp    80251e <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  80256e:	83 f9 01             	cmp    $0x1,%ecx
+  802571:	7f 1e                	jg     802591 <vprintfmt+0x319>
+  else if (lflag)
+  802573:	85 c9                	test   %ecx,%ecx
+  802575:	74 32                	je     8025a9 <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  802577:	8b 45 14             	mov    0x14(%ebp),%eax
+  80257a:	8b 10                	mov    (%eax),%edx
+  80257c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802581:	8d 40 04             	lea    0x4(%eax),%eax
+  802584:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  802587:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  80258c:	e9 a3 00 00 00       	jmp    802634 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  802591:	8b 45 14             	mov    0x14(%ebp),%eax
+  802594:	8b 10                	mov    (%eax),%edx
+  802596:	8b 48 04             	mov    0x4(%eax),%ecx
+  802599:	8d 40 08             	lea    0x8(%eax),%eax
+  80259c:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  80259f:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  8025a4:	e9 8b 00 00 00       	jmp    802634 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8025a9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8025ac:	8b 10                	mov    (%eax),%edx
+  8025ae:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025b3:	8d 40 04             	lea    0x4(%eax),%eax
+  8025b6:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  8025b9:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  8025be:	eb 74                	jmp    802634 <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  8025c0:	83 f9 01             	cmp    $0x1,%ecx
+  8025c3:	7f 1b                	jg     8025e0 <vprintfmt+0x368>
+  else if (lflag)
+  8025c5:	85 c9                	test   %ecx,%ecx
+  8025c7:	74 2c                	je     8025f5 <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  8025c9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8025cc:	8b 10                	mov    (%eax),%edx
+  8025ce:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025d3:	8d 40 04             	lea    0x4(%eax),%eax
+  8025d6:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8025d9:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  8025de:	eb 54                	jmp    802634 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  8025e0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8025e3:	8b 10                	mov    (%eax),%edx
+  8025e5:	8b 48 04             	mov    0x4(%eax),%ecx
+  8025e8:	8d 40 08             	lea    0x8(%eax),%eax
+  8025eb:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8025ee:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  8025f3:	eb 3f                	jmp    802634 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8025f5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8025f8:	8b 10                	mov    (%eax),%edx
+  8025fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025ff:	8d 40 04             	lea    0x4(%eax),%eax
+  802602:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  802605:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  80260a:	eb 28                	jmp    802634 <vprintfmt+0x3bc>
+      putch('0', putdat);
+  80260c:	83 ec 08             	sub    $0x8,%esp
+  80260f:	53                   	push   %ebx
+  802610:	6a 30                	push   $0x30
+  802612:	ff d6                	call   *%esi
+      putch('x', putdat);
+  802614:	83 c4 08             	add    $0x8,%esp
+  802617:	53                   	push   %ebx
+  802618:	6a 78                	push   $0x78
+  80261a:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  80261c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80261f:	8b 10                	mov    (%eax),%edx
+  802621:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  802626:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  802629:	8d 40 04             	lea    0x4(%eax),%eax
+  80262c:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  80262f:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  802634:	83 ec 0c             	sub    $0xc,%esp
+  802637:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80263b:	50                   	push   %eax
+  80263c:	ff 75 e0             	push   -0x20(%ebp)
+  80263f:	57                   	push   %edi
+  802640:	51                   	push   %ecx
+  802641:	52                   	push   %edx
+  802642:	89 da                	mov    %ebx,%edx
+  802644:	89 f0                	mov    %esi,%eax
+  802646:	e8 4a fb ff ff       	call   802195 <printnum>
+      break;
+  80264b:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  80264e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  802651:	e9 40 fc ff ff       	jmp    802296 <vprintfmt+0x1e>
+  if (lflag >= 2)
+  802656:	83 f9 01             	cmp    $0x1,%ecx
+  802659:	7f 1b                	jg     802676 <vprintfmt+0x3fe>
+  else if (lflag)
+  80265b:	85 c9                	test   %ecx,%ecx
+  80265d:	74 2c                	je     80268b <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  80265f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802662:	8b 10                	mov    (%eax),%edx
+  802664:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802669:	8d 40 04             	lea    0x4(%eax),%eax
+  80266c:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  80266f:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  802674:	eb be                	jmp    802634 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  802676:	8b 45 14             	mov    0x14(%ebp),%eax
+  802679:	8b 10                	mov    (%eax),%edx
+  80267b:	8b 48 04             	mov    0x4(%eax),%ecx
+  80267e:	8d 40 08             	lea    0x8(%eax),%eax
+  802681:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  802684:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  802689:	eb a9                	jmp    802634 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  80268b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80268e:	8b 10                	mov    (%eax),%edx
+  802690:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802695:	8d 40 04             	lea    0x4(%eax),%eax
+  802698:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  80269b:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  8026a0:	eb 92                	jmp    802634 <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  8026a2:	83 ec 08             	sub    $0x8,%esp
+  8026a5:	53                   	push   %ebx
+  8026a6:	6a 25                	push   $0x25
+  8026a8:	ff d6                	call   *%esi
+      break;
+  8026aa:	83 c4 10             	add    $0x10,%esp
+  8026ad:	eb 9f                	jmp    80264e <vprintfmt+0x3d6>
+      putch('%', putdat);
+  8026af:	83 ec 08             	sub    $0x8,%esp
+  8026b2:	53                   	push   %ebx
+  8026b3:	6a 25                	push   $0x25
+  8026b5:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  8026b7:	83 c4 10             	add    $0x10,%esp
+  8026ba:	89 f8                	mov    %edi,%eax
+  8026bc:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8026c0:	74 05                	je     8026c7 <vprintfmt+0x44f>
+  8026c2:	83 e8 01             	sub    $0x1,%eax
+  8026c5:	eb f5                	jmp    8026bc <vprintfmt+0x444>
+  8026c7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8026ca:	eb 82                	jmp    80264e <vprintfmt+0x3d6>
+
+008026cc <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8026cc:	55                   	push   %ebp
+  8026cd:	89 e5                	mov    %esp,%ebp
+  8026cf:	83 ec 18             	sub    $0x18,%esp
+  8026d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026d5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  8026d8:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8026db:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8026df:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8026e2:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  8026e9:	85 c0                	test   %eax,%eax
+  8026eb:	74 26                	je     802713 <vsnprintf+0x47>
+  8026ed:	85 d2                	test   %edx,%edx
+  8026ef:	7e 22                	jle    802713 <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8026f1:	ff 75 14             	push   0x14(%ebp)
+  8026f4:	ff 75 10             	push   0x10(%ebp)
+  8026f7:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8026fa:	50                   	push   %eax
+  8026fb:	68 3e 22 80 00       	push   $0x80223e
+  802700:	e8 73 fb ff ff       	call   802278 <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  802705:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  802708:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  80270b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80270e:	83 c4 10             	add    $0x10,%esp
+}
+  802711:	c9                   	leave
+  802712:	c3                   	ret
+    return -E_INVAL;
+  802713:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802718:	eb f7                	jmp    802711 <vsnprintf+0x45>
+
+0080271a <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80271a:	55                   	push   %ebp
+  80271b:	89 e5                	mov    %esp,%ebp
+  80271d:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  802720:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  802723:	50                   	push   %eax
+  802724:	ff 75 10             	push   0x10(%ebp)
+  802727:	ff 75 0c             	push   0xc(%ebp)
+  80272a:	ff 75 08             	push   0x8(%ebp)
+  80272d:	e8 9a ff ff ff       	call   8026cc <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  802732:	c9                   	leave
+  802733:	c3                   	ret
+
+00802734 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  802734:	55                   	push   %ebp
+  802735:	89 e5                	mov    %esp,%ebp
+  802737:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  80273a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80273f:	eb 03                	jmp    802744 <strlen+0x10>
+    n++;
+  802741:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  802744:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  802748:	75 f7                	jne    802741 <strlen+0xd>
+  return n;
+}
+  80274a:	5d                   	pop    %ebp
+  80274b:	c3                   	ret
+
+0080274c <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80274c:	55                   	push   %ebp
+  80274d:	89 e5                	mov    %esp,%ebp
+  80274f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  802752:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802755:	b8 00 00 00 00       	mov    $0x0,%eax
+  80275a:	eb 03                	jmp    80275f <strnlen+0x13>
+    n++;
+  80275c:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80275f:	39 d0                	cmp    %edx,%eax
+  802761:	74 08                	je     80276b <strnlen+0x1f>
+  802763:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  802767:	75 f3                	jne    80275c <strnlen+0x10>
+  802769:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  80276b:	89 d0                	mov    %edx,%eax
+  80276d:	5d                   	pop    %ebp
+  80276e:	c3                   	ret
+
+0080276f <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80276f:	55                   	push   %ebp
+  802770:	89 e5                	mov    %esp,%ebp
+  802772:	53                   	push   %ebx
+  802773:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802776:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  802779:	b8 00 00 00 00       	mov    $0x0,%eax
+  80277e:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  802782:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  802785:	83 c0 01             	add    $0x1,%eax
+  802788:	84 d2                	test   %dl,%dl
+  80278a:	75 f2                	jne    80277e <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  80278c:	89 c8                	mov    %ecx,%eax
+  80278e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802791:	c9                   	leave
+  802792:	c3                   	ret
+
+00802793 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  802793:	55                   	push   %ebp
+  802794:	89 e5                	mov    %esp,%ebp
+  802796:	53                   	push   %ebx
+  802797:	83 ec 10             	sub    $0x10,%esp
+  80279a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  80279d:	53                   	push   %ebx
+  80279e:	e8 91 ff ff ff       	call   802734 <strlen>
+  8027a3:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  8027a6:	ff 75 0c             	push   0xc(%ebp)
+  8027a9:	01 d8                	add    %ebx,%eax
+  8027ab:	50                   	push   %eax
+  8027ac:	e8 be ff ff ff       	call   80276f <strcpy>
+  return dst;
+}
+  8027b1:	89 d8                	mov    %ebx,%eax
+  8027b3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027b6:	c9                   	leave
+  8027b7:	c3                   	ret
+
+008027b8 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  8027b8:	55                   	push   %ebp
+  8027b9:	89 e5                	mov    %esp,%ebp
+  8027bb:	56                   	push   %esi
+  8027bc:	53                   	push   %ebx
+  8027bd:	8b 75 08             	mov    0x8(%ebp),%esi
+  8027c0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  8027c3:	89 f3                	mov    %esi,%ebx
+  8027c5:	03 5d 10             	add    0x10(%ebp),%ebx
+  8027c8:	89 f0                	mov    %esi,%eax
+  8027ca:	eb 0f                	jmp    8027db <strncpy+0x23>
+    *dst++ = *src;
+  8027cc:	83 c0 01             	add    $0x1,%eax
+  8027cf:	0f b6 0a             	movzbl (%edx),%ecx
+  8027d2:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  8027d5:	80 f9 01             	cmp    $0x1,%cl
+  8027d8:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  8027db:	39 d8                	cmp    %ebx,%eax
+  8027dd:	75 ed                	jne    8027cc <strncpy+0x14>
+  }
+  return ret;
+}
+  8027df:	89 f0                	mov    %esi,%eax
+  8027e1:	5b                   	pop    %ebx
+  8027e2:	5e                   	pop    %esi
+  8027e3:	5d                   	pop    %ebp
+  8027e4:	c3                   	ret
+
+008027e5 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8027e5:	55                   	push   %ebp
+  8027e6:	89 e5                	mov    %esp,%ebp
+  8027e8:	56                   	push   %esi
+  8027e9:	53                   	push   %ebx
+  8027ea:	8b 75 08             	mov    0x8(%ebp),%esi
+  8027ed:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8027f0:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  8027f3:	89 f0                	mov    %esi,%eax
+  8027f5:	85 d2                	test   %edx,%edx
+  8027f7:	74 21                	je     80281a <strlcpy+0x35>
+  8027f9:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8027fd:	89 f2                	mov    %esi,%edx
+  8027ff:	eb 09                	jmp    80280a <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  802801:	83 c1 01             	add    $0x1,%ecx
+  802804:	83 c2 01             	add    $0x1,%edx
+  802807:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  80280a:	39 c2                	cmp    %eax,%edx
+  80280c:	74 09                	je     802817 <strlcpy+0x32>
+  80280e:	0f b6 19             	movzbl (%ecx),%ebx
+  802811:	84 db                	test   %bl,%bl
+  802813:	75 ec                	jne    802801 <strlcpy+0x1c>
+  802815:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  802817:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  80281a:	29 f0                	sub    %esi,%eax
+}
+  80281c:	5b                   	pop    %ebx
+  80281d:	5e                   	pop    %esi
+  80281e:	5d                   	pop    %ebp
+  80281f:	c3                   	ret
+
+00802820 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  802820:	55                   	push   %ebp
+  802821:	89 e5                	mov    %esp,%ebp
+  802823:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802826:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  802829:	eb 06                	jmp    802831 <strcmp+0x11>
+    p++, q++;
+  80282b:	83 c1 01             	add    $0x1,%ecx
+  80282e:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  802831:	0f b6 01             	movzbl (%ecx),%eax
+  802834:	84 c0                	test   %al,%al
+  802836:	74 04                	je     80283c <strcmp+0x1c>
+  802838:	3a 02                	cmp    (%edx),%al
+  80283a:	74 ef                	je     80282b <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  80283c:	0f b6 c0             	movzbl %al,%eax
+  80283f:	0f b6 12             	movzbl (%edx),%edx
+  802842:	29 d0                	sub    %edx,%eax
+}
+  802844:	5d                   	pop    %ebp
+  802845:	c3                   	ret
+
+00802846 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  802846:	55                   	push   %ebp
+  802847:	89 e5                	mov    %esp,%ebp
+  802849:	53                   	push   %ebx
+  80284a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80284d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802850:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  802853:	eb 09                	jmp    80285e <strncmp+0x18>
+    n--, p++, q++;
+  802855:	83 ea 01             	sub    $0x1,%edx
+  802858:	83 c0 01             	add    $0x1,%eax
+  80285b:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  80285e:	85 d2                	test   %edx,%edx
+  802860:	74 18                	je     80287a <strncmp+0x34>
+  802862:	0f b6 18             	movzbl (%eax),%ebx
+  802865:	84 db                	test   %bl,%bl
+  802867:	74 04                	je     80286d <strncmp+0x27>
+  802869:	3a 19                	cmp    (%ecx),%bl
+  80286b:	74 e8                	je     802855 <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80286d:	0f b6 00             	movzbl (%eax),%eax
+  802870:	0f b6 11             	movzbl (%ecx),%edx
+  802873:	29 d0                	sub    %edx,%eax
+}
+  802875:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802878:	c9                   	leave
+  802879:	c3                   	ret
+    return 0;
+  80287a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80287f:	eb f4                	jmp    802875 <strncmp+0x2f>
+
+00802881 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  802881:	55                   	push   %ebp
+  802882:	89 e5                	mov    %esp,%ebp
+  802884:	8b 45 08             	mov    0x8(%ebp),%eax
+  802887:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  80288b:	eb 03                	jmp    802890 <strchr+0xf>
+  80288d:	83 c0 01             	add    $0x1,%eax
+  802890:	0f b6 10             	movzbl (%eax),%edx
+  802893:	84 d2                	test   %dl,%dl
+  802895:	74 06                	je     80289d <strchr+0x1c>
+    if (*s == c)
+  802897:	38 ca                	cmp    %cl,%dl
+  802899:	75 f2                	jne    80288d <strchr+0xc>
+  80289b:	eb 05                	jmp    8028a2 <strchr+0x21>
+      return (char*)s;
+  return 0;
+  80289d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8028a2:	5d                   	pop    %ebp
+  8028a3:	c3                   	ret
+
+008028a4 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8028a4:	55                   	push   %ebp
+  8028a5:	89 e5                	mov    %esp,%ebp
+  8028a7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028aa:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  8028ae:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  8028b1:	38 ca                	cmp    %cl,%dl
+  8028b3:	74 09                	je     8028be <strfind+0x1a>
+  8028b5:	84 d2                	test   %dl,%dl
+  8028b7:	74 05                	je     8028be <strfind+0x1a>
+  for (; *s; s++)
+  8028b9:	83 c0 01             	add    $0x1,%eax
+  8028bc:	eb f0                	jmp    8028ae <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  8028be:	5d                   	pop    %ebp
+  8028bf:	c3                   	ret
+
+008028c0 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8028c0:	55                   	push   %ebp
+  8028c1:	89 e5                	mov    %esp,%ebp
+  8028c3:	57                   	push   %edi
+  8028c4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8028c7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  8028ca:	85 c9                	test   %ecx,%ecx
+  8028cc:	74 20                	je     8028ee <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  8028ce:	89 f8                	mov    %edi,%eax
+  8028d0:	09 c8                	or     %ecx,%eax
+  8028d2:	a8 03                	test   $0x3,%al
+  8028d4:	75 12                	jne    8028e8 <memset+0x28>
+    c &= 0xFF;
+  8028d6:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8028da:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  8028e0:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  8028e3:	fc                   	cld
+  8028e4:	f3 ab                	rep stos %eax,%es:(%edi)
+  8028e6:	eb 06                	jmp    8028ee <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  8028e8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8028eb:	fc                   	cld
+  8028ec:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  8028ee:	89 f8                	mov    %edi,%eax
+  8028f0:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8028f3:	c9                   	leave
+  8028f4:	c3                   	ret
+
+008028f5 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8028f5:	55                   	push   %ebp
+  8028f6:	89 e5                	mov    %esp,%ebp
+  8028f8:	57                   	push   %edi
+  8028f9:	56                   	push   %esi
+  8028fa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028fd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802900:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  802903:	39 c6                	cmp    %eax,%esi
+  802905:	73 32                	jae    802939 <memmove+0x44>
+  802907:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80290a:	39 d0                	cmp    %edx,%eax
+  80290c:	73 2b                	jae    802939 <memmove+0x44>
+    s += n;
+    d += n;
+  80290e:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  802911:	89 d6                	mov    %edx,%esi
+  802913:	09 fe                	or     %edi,%esi
+  802915:	09 ce                	or     %ecx,%esi
+  802917:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  80291d:	75 0e                	jne    80292d <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  80291f:	83 ef 04             	sub    $0x4,%edi
+  802922:	8d 72 fc             	lea    -0x4(%edx),%esi
+  802925:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  802928:	fd                   	std
+  802929:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80292b:	eb 09                	jmp    802936 <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  80292d:	83 ef 01             	sub    $0x1,%edi
+  802930:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  802933:	fd                   	std
+  802934:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  802936:	fc                   	cld
+  802937:	eb 1a                	jmp    802953 <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  802939:	89 f2                	mov    %esi,%edx
+  80293b:	09 c2                	or     %eax,%edx
+  80293d:	09 ca                	or     %ecx,%edx
+  80293f:	f6 c2 03             	test   $0x3,%dl
+  802942:	75 0a                	jne    80294e <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  802944:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  802947:	89 c7                	mov    %eax,%edi
+  802949:	fc                   	cld
+  80294a:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80294c:	eb 05                	jmp    802953 <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  80294e:	89 c7                	mov    %eax,%edi
+  802950:	fc                   	cld
+  802951:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  802953:	5e                   	pop    %esi
+  802954:	5f                   	pop    %edi
+  802955:	5d                   	pop    %ebp
+  802956:	c3                   	ret
+
+00802957 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  802957:	55                   	push   %ebp
+  802958:	89 e5                	mov    %esp,%ebp
+  80295a:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  80295d:	ff 75 10             	push   0x10(%ebp)
+  802960:	ff 75 0c             	push   0xc(%ebp)
+  802963:	ff 75 08             	push   0x8(%ebp)
+  802966:	e8 8a ff ff ff       	call   8028f5 <memmove>
+}
+  80296b:	c9                   	leave
+  80296c:	c3                   	ret
+
+0080296d <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  80296d:	55                   	push   %ebp
+  80296e:	89 e5                	mov    %esp,%ebp
+  802970:	56                   	push   %esi
+  802971:	53                   	push   %ebx
+  802972:	8b 45 08             	mov    0x8(%ebp),%eax
+  802975:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  802978:	89 c6                	mov    %eax,%esi
+  80297a:	03 75 10             	add    0x10(%ebp),%esi
+  80297d:	eb 06                	jmp    802985 <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  80297f:	83 c0 01             	add    $0x1,%eax
+  802982:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  802985:	39 f0                	cmp    %esi,%eax
+  802987:	74 14                	je     80299d <memcmp+0x30>
+    if (*s1 != *s2)
+  802989:	0f b6 08             	movzbl (%eax),%ecx
+  80298c:	0f b6 1a             	movzbl (%edx),%ebx
+  80298f:	38 d9                	cmp    %bl,%cl
+  802991:	74 ec                	je     80297f <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  802993:	0f b6 c1             	movzbl %cl,%eax
+  802996:	0f b6 db             	movzbl %bl,%ebx
+  802999:	29 d8                	sub    %ebx,%eax
+  80299b:	eb 05                	jmp    8029a2 <memcmp+0x35>
+  }
+
+  return 0;
+  80299d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8029a2:	5b                   	pop    %ebx
+  8029a3:	5e                   	pop    %esi
+  8029a4:	5d                   	pop    %ebp
+  8029a5:	c3                   	ret
+
+008029a6 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8029a6:	55                   	push   %ebp
+  8029a7:	89 e5                	mov    %esp,%ebp
+  8029a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029ac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  8029af:	89 c2                	mov    %eax,%edx
+  8029b1:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  8029b4:	eb 03                	jmp    8029b9 <memfind+0x13>
+  8029b6:	83 c0 01             	add    $0x1,%eax
+  8029b9:	39 d0                	cmp    %edx,%eax
+  8029bb:	73 04                	jae    8029c1 <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  8029bd:	38 08                	cmp    %cl,(%eax)
+  8029bf:	75 f5                	jne    8029b6 <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  8029c1:	5d                   	pop    %ebp
+  8029c2:	c3                   	ret
+
+008029c3 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8029c3:	55                   	push   %ebp
+  8029c4:	89 e5                	mov    %esp,%ebp
+  8029c6:	57                   	push   %edi
+  8029c7:	56                   	push   %esi
+  8029c8:	53                   	push   %ebx
+  8029c9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8029cc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  8029cf:	eb 03                	jmp    8029d4 <strtol+0x11>
+    s++;
+  8029d1:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  8029d4:	0f b6 02             	movzbl (%edx),%eax
+  8029d7:	3c 20                	cmp    $0x20,%al
+  8029d9:	74 f6                	je     8029d1 <strtol+0xe>
+  8029db:	3c 09                	cmp    $0x9,%al
+  8029dd:	74 f2                	je     8029d1 <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  8029df:	3c 2b                	cmp    $0x2b,%al
+  8029e1:	74 2a                	je     802a0d <strtol+0x4a>
+  int neg = 0;
+  8029e3:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  8029e8:	3c 2d                	cmp    $0x2d,%al
+  8029ea:	74 2b                	je     802a17 <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8029ec:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8029f2:	75 0f                	jne    802a03 <strtol+0x40>
+  8029f4:	80 3a 30             	cmpb   $0x30,(%edx)
+  8029f7:	74 28                	je     802a21 <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  8029f9:	85 db                	test   %ebx,%ebx
+  8029fb:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802a00:	0f 44 d8             	cmove  %eax,%ebx
+  802a03:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a08:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  802a0b:	eb 46                	jmp    802a53 <strtol+0x90>
+    s++;
+  802a0d:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  802a10:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a15:	eb d5                	jmp    8029ec <strtol+0x29>
+    s++, neg = 1;
+  802a17:	83 c2 01             	add    $0x1,%edx
+  802a1a:	bf 01 00 00 00       	mov    $0x1,%edi
+  802a1f:	eb cb                	jmp    8029ec <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  802a21:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  802a25:	74 0e                	je     802a35 <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  802a27:	85 db                	test   %ebx,%ebx
+  802a29:	75 d8                	jne    802a03 <strtol+0x40>
+    s++, base = 8;
+  802a2b:	83 c2 01             	add    $0x1,%edx
+  802a2e:	bb 08 00 00 00       	mov    $0x8,%ebx
+  802a33:	eb ce                	jmp    802a03 <strtol+0x40>
+    s += 2, base = 16;
+  802a35:	83 c2 02             	add    $0x2,%edx
+  802a38:	bb 10 00 00 00       	mov    $0x10,%ebx
+  802a3d:	eb c4                	jmp    802a03 <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  802a3f:	0f be c0             	movsbl %al,%eax
+  802a42:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  802a45:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802a48:	7d 3a                	jge    802a84 <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  802a4a:	83 c2 01             	add    $0x1,%edx
+  802a4d:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  802a51:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  802a53:	0f b6 02             	movzbl (%edx),%eax
+  802a56:	8d 70 d0             	lea    -0x30(%eax),%esi
+  802a59:	89 f3                	mov    %esi,%ebx
+  802a5b:	80 fb 09             	cmp    $0x9,%bl
+  802a5e:	76 df                	jbe    802a3f <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  802a60:	8d 70 9f             	lea    -0x61(%eax),%esi
+  802a63:	89 f3                	mov    %esi,%ebx
+  802a65:	80 fb 19             	cmp    $0x19,%bl
+  802a68:	77 08                	ja     802a72 <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  802a6a:	0f be c0             	movsbl %al,%eax
+  802a6d:	83 e8 57             	sub    $0x57,%eax
+  802a70:	eb d3                	jmp    802a45 <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  802a72:	8d 70 bf             	lea    -0x41(%eax),%esi
+  802a75:	89 f3                	mov    %esi,%ebx
+  802a77:	80 fb 19             	cmp    $0x19,%bl
+  802a7a:	77 08                	ja     802a84 <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  802a7c:	0f be c0             	movsbl %al,%eax
+  802a7f:	83 e8 37             	sub    $0x37,%eax
+  802a82:	eb c1                	jmp    802a45 <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  802a84:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802a88:	74 05                	je     802a8f <strtol+0xcc>
+    *endptr = (char*)s;
+  802a8a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a8d:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  802a8f:	89 c8                	mov    %ecx,%eax
+  802a91:	f7 d8                	neg    %eax
+  802a93:	85 ff                	test   %edi,%edi
+  802a95:	0f 45 c8             	cmovne %eax,%ecx
+}
+  802a98:	89 c8                	mov    %ecx,%eax
+  802a9a:	5b                   	pop    %ebx
+  802a9b:	5e                   	pop    %esi
+  802a9c:	5f                   	pop    %edi
+  802a9d:	5d                   	pop    %ebp
+  802a9e:	c3                   	ret
+
+00802a9f <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  802a9f:	55                   	push   %ebp
+  802aa0:	89 e5                	mov    %esp,%ebp
+  802aa2:	53                   	push   %ebx
+  802aa3:	83 ec 04             	sub    $0x4,%esp
+  int r;
+
+  if (_pgfault_handler == 0) {
+  802aa6:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  802aad:	74 0d                	je     802abc <set_pgfault_handler+0x1d>
+
+    sys_env_set_pgfault_upcall(id, _pgfault_upcall);
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  802aaf:	8b 45 08             	mov    0x8(%ebp),%eax
+  802ab2:	a3 00 70 80 00       	mov    %eax,0x807000
+}
+  802ab7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802aba:	c9                   	leave
+  802abb:	c3                   	ret
+    envid_t id = sys_getenvid();
+  802abc:	e8 7e d6 ff ff       	call   80013f <sys_getenvid>
+  802ac1:	89 c3                	mov    %eax,%ebx
+    sys_page_alloc(id, (void *) (UXSTACKTOP - PGSIZE), (PTE_P | PTE_U | PTE_W));
+  802ac3:	83 ec 04             	sub    $0x4,%esp
+  802ac6:	6a 07                	push   $0x7
+  802ac8:	68 00 f0 bf ee       	push   $0xeebff000
+  802acd:	50                   	push   %eax
+  802ace:	e8 ed d6 ff ff       	call   8001c0 <sys_page_alloc>
+    sys_env_set_pgfault_upcall(id, _pgfault_upcall);
+  802ad3:	83 c4 08             	add    $0x8,%esp
+  802ad6:	68 6f 06 80 00       	push   $0x80066f
+  802adb:	53                   	push   %ebx
+  802adc:	e8 54 d9 ff ff       	call   800435 <sys_env_set_pgfault_upcall>
+  802ae1:	83 c4 10             	add    $0x10,%esp
+  802ae4:	eb c9                	jmp    802aaf <set_pgfault_handler+0x10>
+
+00802ae6 <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  802ae6:	55                   	push   %ebp
+  802ae7:	89 e5                	mov    %esp,%ebp
+  802ae9:	57                   	push   %edi
+  802aea:	56                   	push   %esi
+  802aeb:	53                   	push   %ebx
+  802aec:	83 ec 14             	sub    $0x14,%esp
+  802aef:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802af2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802af5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802af8:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  802afb:	85 c0                	test   %eax,%eax
+  802afd:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802b02:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  802b05:	ff 33                	push   (%ebx)
+  802b07:	50                   	push   %eax
+  802b08:	e8 8b d9 ff ff       	call   800498 <sys_ipc_recv>
+  802b0d:	83 c4 10             	add    $0x10,%esp
+  802b10:	85 c0                	test   %eax,%eax
+  802b12:	78 39                	js     802b4d <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  802b14:	85 ff                	test   %edi,%edi
+  802b16:	74 0a                	je     802b22 <ipc_recv_pages+0x3c>
+  802b18:	a1 44 57 80 00       	mov    0x805744,%eax
+  802b1d:	8b 40 7c             	mov    0x7c(%eax),%eax
+  802b20:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  802b22:	85 f6                	test   %esi,%esi
+  802b24:	74 0d                	je     802b33 <ipc_recv_pages+0x4d>
+  802b26:	a1 44 57 80 00       	mov    0x805744,%eax
+  802b2b:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  802b31:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  802b33:	a1 44 57 80 00       	mov    0x805744,%eax
+  802b38:	8b 40 74             	mov    0x74(%eax),%eax
+  802b3b:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  802b3d:	a1 44 57 80 00       	mov    0x805744,%eax
+  802b42:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  802b45:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b48:	5b                   	pop    %ebx
+  802b49:	5e                   	pop    %esi
+  802b4a:	5f                   	pop    %edi
+  802b4b:	5d                   	pop    %ebp
+  802b4c:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  802b4d:	85 ff                	test   %edi,%edi
+  802b4f:	74 06                	je     802b57 <ipc_recv_pages+0x71>
+  802b51:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  802b57:	85 f6                	test   %esi,%esi
+  802b59:	74 06                	je     802b61 <ipc_recv_pages+0x7b>
+  802b5b:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  802b61:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  802b67:	eb dc                	jmp    802b45 <ipc_recv_pages+0x5f>
+
+00802b69 <ipc_recv>:
+{
+  802b69:	55                   	push   %ebp
+  802b6a:	89 e5                	mov    %esp,%ebp
+  802b6c:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  802b6f:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  802b76:	ff 75 10             	push   0x10(%ebp)
+  802b79:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b7c:	50                   	push   %eax
+  802b7d:	ff 75 0c             	push   0xc(%ebp)
+  802b80:	ff 75 08             	push   0x8(%ebp)
+  802b83:	e8 5e ff ff ff       	call   802ae6 <ipc_recv_pages>
+}
+  802b88:	c9                   	leave
+  802b89:	c3                   	ret
+
+00802b8a <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  802b8a:	55                   	push   %ebp
+  802b8b:	89 e5                	mov    %esp,%ebp
+  802b8d:	57                   	push   %edi
+  802b8e:	56                   	push   %esi
+  802b8f:	53                   	push   %ebx
+  802b90:	83 ec 0c             	sub    $0xc,%esp
+  802b93:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802b96:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802b99:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  802b9c:	89 c3                	mov    %eax,%ebx
+  802b9e:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  802ba4:	85 c0                	test   %eax,%eax
+  802ba6:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802bab:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  802bae:	83 ec 0c             	sub    $0xc,%esp
+  802bb1:	ff 75 14             	push   0x14(%ebp)
+  802bb4:	ff 75 18             	push   0x18(%ebp)
+  802bb7:	53                   	push   %ebx
+  802bb8:	56                   	push   %esi
+  802bb9:	57                   	push   %edi
+  802bba:	e8 b8 d8 ff ff       	call   800477 <sys_ipc_try_send>
+  802bbf:	83 c4 20             	add    $0x20,%esp
+  802bc2:	85 c0                	test   %eax,%eax
+  802bc4:	79 1e                	jns    802be4 <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  802bc6:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802bc9:	75 07                	jne    802bd2 <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  802bcb:	e8 8e d5 ff ff       	call   80015e <sys_yield>
+  802bd0:	eb dc                	jmp    802bae <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  802bd2:	50                   	push   %eax
+  802bd3:	68 63 33 80 00       	push   $0x803363
+  802bd8:	6a 5c                	push   $0x5c
+  802bda:	68 70 33 80 00       	push   $0x803370
+  802bdf:	e8 c2 f4 ff ff       	call   8020a6 <_panic>
+  }
+}
+  802be4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802be7:	5b                   	pop    %ebx
+  802be8:	5e                   	pop    %esi
+  802be9:	5f                   	pop    %edi
+  802bea:	5d                   	pop    %ebp
+  802beb:	c3                   	ret
+
+00802bec <ipc_send>:
+{
+  802bec:	55                   	push   %ebp
+  802bed:	89 e5                	mov    %esp,%ebp
+  802bef:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  802bf2:	ff 75 14             	push   0x14(%ebp)
+  802bf5:	6a 01                	push   $0x1
+  802bf7:	ff 75 10             	push   0x10(%ebp)
+  802bfa:	ff 75 0c             	push   0xc(%ebp)
+  802bfd:	ff 75 08             	push   0x8(%ebp)
+  802c00:	e8 85 ff ff ff       	call   802b8a <ipc_send_pages>
+}
+  802c05:	83 c4 20             	add    $0x20,%esp
+  802c08:	c9                   	leave
+  802c09:	c3                   	ret
+
+00802c0a <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802c0a:	55                   	push   %ebp
+  802c0b:	89 e5                	mov    %esp,%ebp
+  802c0d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  802c10:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  802c15:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802c18:	c1 e0 04             	shl    $0x4,%eax
+  802c1b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802c20:	8b 40 50             	mov    0x50(%eax),%eax
+  802c23:	39 c8                	cmp    %ecx,%eax
+  802c25:	74 12                	je     802c39 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  802c27:	83 c2 01             	add    $0x1,%edx
+  802c2a:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802c30:	75 e3                	jne    802c15 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  802c32:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c37:	eb 0e                	jmp    802c47 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  802c39:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802c3c:	c1 e0 04             	shl    $0x4,%eax
+  802c3f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802c44:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802c47:	5d                   	pop    %ebp
+  802c48:	c3                   	ret
+
+00802c49 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802c49:	55                   	push   %ebp
+  802c4a:	89 e5                	mov    %esp,%ebp
+  802c4c:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802c4f:	89 c2                	mov    %eax,%edx
+  802c51:	c1 ea 16             	shr    $0x16,%edx
+  802c54:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  802c5b:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802c60:	f6 c1 01             	test   $0x1,%cl
+  802c63:	74 1c                	je     802c81 <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  802c65:	c1 e8 0c             	shr    $0xc,%eax
+  802c68:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  802c6f:	a8 01                	test   $0x1,%al
+  802c71:	74 0e                	je     802c81 <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  802c73:	c1 e8 0c             	shr    $0xc,%eax
+  802c76:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802c7d:	ef 
+  802c7e:	0f b7 d2             	movzwl %dx,%edx
+}
+  802c81:	89 d0                	mov    %edx,%eax
+  802c83:	5d                   	pop    %ebp
+  802c84:	c3                   	ret
+
+00802c85 <udivmod>:
+  802c85:	55                   	push   %ebp
+  802c86:	57                   	push   %edi
+  802c87:	56                   	push   %esi
+  802c88:	53                   	push   %ebx
+  802c89:	83 ec 14             	sub    $0x14,%esp
+  802c8c:	8b 74 24 28          	mov    0x28(%esp),%esi
+  802c90:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  802c94:	89 fb                	mov    %edi,%ebx
+  802c96:	09 f3                	or     %esi,%ebx
+  802c98:	0f 84 88 00 00 00    	je     802d26 <udivmod+0xa1>
+  802c9e:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802ca3:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802caa:	00 
+  802cab:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802cb2:	00 
+  802cb3:	89 cd                	mov    %ecx,%ebp
+  802cb5:	89 34 24             	mov    %esi,(%esp)
+  802cb8:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802cbc:	eb 08                	jmp    802cc6 <udivmod+0x41>
+  802cbe:	83 ed 01             	sub    $0x1,%ebp
+  802cc1:	83 fd ff             	cmp    $0xffffffff,%ebp
+  802cc4:	74 6c                	je     802d32 <udivmod+0xad>
+  802cc6:	89 c3                	mov    %eax,%ebx
+  802cc8:	89 d6                	mov    %edx,%esi
+  802cca:	89 e9                	mov    %ebp,%ecx
+  802ccc:	0f ad f3             	shrd   %cl,%esi,%ebx
+  802ccf:	d3 ee                	shr    %cl,%esi
+  802cd1:	f6 c1 20             	test   $0x20,%cl
+  802cd4:	74 04                	je     802cda <udivmod+0x55>
+  802cd6:	89 f3                	mov    %esi,%ebx
+  802cd8:	31 f6                	xor    %esi,%esi
+  802cda:	8b 3c 24             	mov    (%esp),%edi
+  802cdd:	39 fb                	cmp    %edi,%ebx
+  802cdf:	89 f7                	mov    %esi,%edi
+  802ce1:	8b 1c 24             	mov    (%esp),%ebx
+  802ce4:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802ce8:	19 f7                	sbb    %esi,%edi
+  802cea:	72 d2                	jb     802cbe <udivmod+0x39>
+  802cec:	89 f7                	mov    %esi,%edi
+  802cee:	89 de                	mov    %ebx,%esi
+  802cf0:	89 e9                	mov    %ebp,%ecx
+  802cf2:	0f a5 f7             	shld   %cl,%esi,%edi
+  802cf5:	d3 e6                	shl    %cl,%esi
+  802cf7:	f6 c1 20             	test   $0x20,%cl
+  802cfa:	74 04                	je     802d00 <udivmod+0x7b>
+  802cfc:	89 f7                	mov    %esi,%edi
+  802cfe:	31 f6                	xor    %esi,%esi
+  802d00:	29 f0                	sub    %esi,%eax
+  802d02:	19 fa                	sbb    %edi,%edx
+  802d04:	be 01 00 00 00       	mov    $0x1,%esi
+  802d09:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d0e:	0f a5 f7             	shld   %cl,%esi,%edi
+  802d11:	d3 e6                	shl    %cl,%esi
+  802d13:	f6 c1 20             	test   $0x20,%cl
+  802d16:	74 04                	je     802d1c <udivmod+0x97>
+  802d18:	89 f7                	mov    %esi,%edi
+  802d1a:	31 f6                	xor    %esi,%esi
+  802d1c:	09 74 24 08          	or     %esi,0x8(%esp)
+  802d20:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802d24:	eb 98                	jmp    802cbe <udivmod+0x39>
+  802d26:	89 f0                	mov    %esi,%eax
+  802d28:	89 fa                	mov    %edi,%edx
+  802d2a:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802d2e:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802d32:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802d36:	89 01                	mov    %eax,(%ecx)
+  802d38:	89 51 04             	mov    %edx,0x4(%ecx)
+  802d3b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802d3f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802d43:	83 c4 14             	add    $0x14,%esp
+  802d46:	5b                   	pop    %ebx
+  802d47:	5e                   	pop    %esi
+  802d48:	5f                   	pop    %edi
+  802d49:	5d                   	pop    %ebp
+  802d4a:	c3                   	ret
+
+00802d4b <__udivdi3>:
+  802d4b:	83 ec 18             	sub    $0x18,%esp
+  802d4e:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802d52:	50                   	push   %eax
+  802d53:	ff 74 24 2c          	push   0x2c(%esp)
+  802d57:	ff 74 24 2c          	push   0x2c(%esp)
+  802d5b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802d5f:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802d63:	e8 1d ff ff ff       	call   802c85 <udivmod>
+  802d68:	83 c4 24             	add    $0x24,%esp
+  802d6b:	c3                   	ret
+
+00802d6c <__umoddi3>:
+  802d6c:	83 ec 18             	sub    $0x18,%esp
+  802d6f:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802d73:	50                   	push   %eax
+  802d74:	ff 74 24 2c          	push   0x2c(%esp)
+  802d78:	ff 74 24 2c          	push   0x2c(%esp)
+  802d7c:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802d80:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802d84:	e8 fc fe ff ff       	call   802c85 <udivmod>
+  802d89:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802d8d:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802d91:	83 c4 24             	add    $0x24,%esp
+  802d94:	c3                   	ret
+
+00802d95 <__divdi3>:
+  802d95:	56                   	push   %esi
+  802d96:	53                   	push   %ebx
+  802d97:	83 ec 14             	sub    $0x14,%esp
+  802d9a:	8b 44 24 20          	mov    0x20(%esp),%eax
+  802d9e:	8b 54 24 24          	mov    0x24(%esp),%edx
+  802da2:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  802da6:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  802daa:	85 d2                	test   %edx,%edx
+  802dac:	78 18                	js     802dc6 <__divdi3+0x31>
+  802dae:	85 db                	test   %ebx,%ebx
+  802db0:	78 3e                	js     802df0 <__divdi3+0x5b>
+  802db2:	83 ec 04             	sub    $0x4,%esp
+  802db5:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802db9:	56                   	push   %esi
+  802dba:	53                   	push   %ebx
+  802dbb:	51                   	push   %ecx
+  802dbc:	e8 c4 fe ff ff       	call   802c85 <udivmod>
+  802dc1:	83 c4 10             	add    $0x10,%esp
+  802dc4:	eb 24                	jmp    802dea <__divdi3+0x55>
+  802dc6:	f7 d8                	neg    %eax
+  802dc8:	83 d2 00             	adc    $0x0,%edx
+  802dcb:	f7 da                	neg    %edx
+  802dcd:	85 db                	test   %ebx,%ebx
+  802dcf:	78 3a                	js     802e0b <__divdi3+0x76>
+  802dd1:	83 ec 04             	sub    $0x4,%esp
+  802dd4:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802dd8:	56                   	push   %esi
+  802dd9:	53                   	push   %ebx
+  802dda:	51                   	push   %ecx
+  802ddb:	e8 a5 fe ff ff       	call   802c85 <udivmod>
+  802de0:	83 c4 10             	add    $0x10,%esp
+  802de3:	f7 d8                	neg    %eax
+  802de5:	83 d2 00             	adc    $0x0,%edx
+  802de8:	f7 da                	neg    %edx
+  802dea:	83 c4 14             	add    $0x14,%esp
+  802ded:	5b                   	pop    %ebx
+  802dee:	5e                   	pop    %esi
+  802def:	c3                   	ret
+  802df0:	83 ec 04             	sub    $0x4,%esp
+  802df3:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802df7:	56                   	push   %esi
+  802df8:	f7 d9                	neg    %ecx
+  802dfa:	83 d3 00             	adc    $0x0,%ebx
+  802dfd:	f7 db                	neg    %ebx
+  802dff:	53                   	push   %ebx
+  802e00:	51                   	push   %ecx
+  802e01:	e8 7f fe ff ff       	call   802c85 <udivmod>
+  802e06:	83 c4 10             	add    $0x10,%esp
+  802e09:	eb d8                	jmp    802de3 <__divdi3+0x4e>
+  802e0b:	83 ec 04             	sub    $0x4,%esp
+  802e0e:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802e12:	56                   	push   %esi
+  802e13:	f7 d9                	neg    %ecx
+  802e15:	83 d3 00             	adc    $0x0,%ebx
+  802e18:	f7 db                	neg    %ebx
+  802e1a:	53                   	push   %ebx
+  802e1b:	51                   	push   %ecx
+  802e1c:	e8 64 fe ff ff       	call   802c85 <udivmod>
+  802e21:	83 c4 10             	add    $0x10,%esp
+  802e24:	eb c4                	jmp    802dea <__divdi3+0x55>
+
+00802e26 <__moddi3>:
+  802e26:	55                   	push   %ebp
+  802e27:	57                   	push   %edi
+  802e28:	56                   	push   %esi
+  802e29:	53                   	push   %ebx
+  802e2a:	83 ec 24             	sub    $0x24,%esp
+  802e2d:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802e31:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802e35:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  802e39:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  802e3d:	85 d2                	test   %edx,%edx
+  802e3f:	78 3b                	js     802e7c <__moddi3+0x56>
+  802e41:	83 ec 04             	sub    $0x4,%esp
+  802e44:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  802e48:	56                   	push   %esi
+  802e49:	89 ce                	mov    %ecx,%esi
+  802e4b:	f7 de                	neg    %esi
+  802e4d:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802e51:	89 de                	mov    %ebx,%esi
+  802e53:	83 d6 00             	adc    $0x0,%esi
+  802e56:	f7 de                	neg    %esi
+  802e58:	89 74 24 14          	mov    %esi,0x14(%esp)
+  802e5c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802e60:	0f 48 f1             	cmovs  %ecx,%esi
+  802e63:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  802e68:	53                   	push   %ebx
+  802e69:	56                   	push   %esi
+  802e6a:	e8 16 fe ff ff       	call   802c85 <udivmod>
+  802e6f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802e73:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802e77:	83 c4 10             	add    $0x10,%esp
+  802e7a:	eb 47                	jmp    802ec3 <__moddi3+0x9d>
+  802e7c:	f7 d8                	neg    %eax
+  802e7e:	83 d2 00             	adc    $0x0,%edx
+  802e81:	f7 da                	neg    %edx
+  802e83:	83 ec 04             	sub    $0x4,%esp
+  802e86:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  802e8a:	56                   	push   %esi
+  802e8b:	89 cf                	mov    %ecx,%edi
+  802e8d:	f7 df                	neg    %edi
+  802e8f:	89 de                	mov    %ebx,%esi
+  802e91:	83 d6 00             	adc    $0x0,%esi
+  802e94:	f7 de                	neg    %esi
+  802e96:	0f 49 cf             	cmovns %edi,%ecx
+  802e99:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802e9d:	0f 49 de             	cmovns %esi,%ebx
+  802ea0:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  802ea4:	ff 74 24 0c          	push   0xc(%esp)
+  802ea8:	ff 74 24 0c          	push   0xc(%esp)
+  802eac:	e8 d4 fd ff ff       	call   802c85 <udivmod>
+  802eb1:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802eb5:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802eb9:	f7 d8                	neg    %eax
+  802ebb:	83 d2 00             	adc    $0x0,%edx
+  802ebe:	f7 da                	neg    %edx
+  802ec0:	83 c4 10             	add    $0x10,%esp
+  802ec3:	83 c4 24             	add    $0x24,%esp
+  802ec6:	5b                   	pop    %ebx
+  802ec7:	5e                   	pop    %esi
+  802ec8:	5f                   	pop    %edi
+  802ec9:	5d                   	pop    %ebp
+  802eca:	c3                   	ret
@@ -0,0 +1,6363 @@
+
+obj/user/faultread.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 1d 00 00 00       	call   80004e <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+  cprintf("I read %08x from location 0!\n", *(unsigned*)0);
+  800039:	ff 35 00 00 00 00    	push   0x0
+  80003f:	68 60 2e 80 00       	push   $0x802e60
+  800044:	e8 07 01 00 00       	call   800150 <cprintf>
+}
+  800049:	83 c4 10             	add    $0x10,%esp
+  80004c:	c9                   	leave
+  80004d:	c3                   	ret
+
+0080004e <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80004e:	55                   	push   %ebp
+  80004f:	89 e5                	mov    %esp,%ebp
+  800051:	56                   	push   %esi
+  800052:	53                   	push   %ebx
+  800053:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800056:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  800059:	c7 05 44 57 80 00 00 	movl   $0x0,0x805744
+  800060:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  800063:	e8 84 0a 00 00       	call   800aec <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  800068:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80006d:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800070:	c1 e0 04             	shl    $0x4,%eax
+  800073:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800078:	a3 44 57 80 00       	mov    %eax,0x805744
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  80007d:	85 db                	test   %ebx,%ebx
+  80007f:	7e 07                	jle    800088 <libmain+0x3a>
+    binaryname = argv[0];
+  800081:	8b 06                	mov    (%esi),%eax
+  800083:	a3 00 40 80 00       	mov    %eax,0x804000
+
+  // call user main routine
+  umain(argc, argv);
+  800088:	83 ec 08             	sub    $0x8,%esp
+  80008b:	56                   	push   %esi
+  80008c:	53                   	push   %ebx
+  80008d:	e8 a1 ff ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  800092:	e8 0a 00 00 00       	call   8000a1 <exit>
+}
+  800097:	83 c4 10             	add    $0x10,%esp
+  80009a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80009d:	5b                   	pop    %ebx
+  80009e:	5e                   	pop    %esi
+  80009f:	5d                   	pop    %ebp
+  8000a0:	c3                   	ret
+
+008000a1 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000a1:	55                   	push   %ebp
+  8000a2:	89 e5                	mov    %esp,%ebp
+  8000a4:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  8000a7:	e8 3a 11 00 00       	call   8011e6 <close_all>
+  sys_env_destroy(0);
+  8000ac:	83 ec 0c             	sub    $0xc,%esp
+  8000af:	6a 00                	push   $0x0
+  8000b1:	e8 f5 09 00 00       	call   800aab <sys_env_destroy>
+}
+  8000b6:	83 c4 10             	add    $0x10,%esp
+  8000b9:	c9                   	leave
+  8000ba:	c3                   	ret
+
+008000bb <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8000bb:	55                   	push   %ebp
+  8000bc:	89 e5                	mov    %esp,%ebp
+  8000be:	53                   	push   %ebx
+  8000bf:	83 ec 04             	sub    $0x4,%esp
+  8000c2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  8000c5:	8b 13                	mov    (%ebx),%edx
+  8000c7:	8d 42 01             	lea    0x1(%edx),%eax
+  8000ca:	89 03                	mov    %eax,(%ebx)
+  8000cc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8000cf:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  8000d3:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8000d8:	74 09                	je     8000e3 <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  8000da:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8000de:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8000e1:	c9                   	leave
+  8000e2:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  8000e3:	83 ec 08             	sub    $0x8,%esp
+  8000e6:	68 ff 00 00 00       	push   $0xff
+  8000eb:	8d 43 08             	lea    0x8(%ebx),%eax
+  8000ee:	50                   	push   %eax
+  8000ef:	e8 7a 09 00 00       	call   800a6e <sys_cputs>
+    b->idx = 0;
+  8000f4:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8000fa:	83 c4 10             	add    $0x10,%esp
+  8000fd:	eb db                	jmp    8000da <putch+0x1f>
+
+008000ff <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8000ff:	55                   	push   %ebp
+  800100:	89 e5                	mov    %esp,%ebp
+  800102:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  800108:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80010f:	00 00 00 
+  b.cnt = 0;
+  800112:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800119:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  80011c:	ff 75 0c             	push   0xc(%ebp)
+  80011f:	ff 75 08             	push   0x8(%ebp)
+  800122:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800128:	50                   	push   %eax
+  800129:	68 bb 00 80 00       	push   $0x8000bb
+  80012e:	e8 14 01 00 00       	call   800247 <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  800133:	83 c4 08             	add    $0x8,%esp
+  800136:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80013c:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800142:	50                   	push   %eax
+  800143:	e8 26 09 00 00       	call   800a6e <sys_cputs>
+
+  return b.cnt;
+}
+  800148:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80014e:	c9                   	leave
+  80014f:	c3                   	ret
+
+00800150 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800150:	55                   	push   %ebp
+  800151:	89 e5                	mov    %esp,%ebp
+  800153:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  800156:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  800159:	50                   	push   %eax
+  80015a:	ff 75 08             	push   0x8(%ebp)
+  80015d:	e8 9d ff ff ff       	call   8000ff <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  800162:	c9                   	leave
+  800163:	c3                   	ret
+
+00800164 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  800164:	55                   	push   %ebp
+  800165:	89 e5                	mov    %esp,%ebp
+  800167:	57                   	push   %edi
+  800168:	56                   	push   %esi
+  800169:	53                   	push   %ebx
+  80016a:	83 ec 1c             	sub    $0x1c,%esp
+  80016d:	89 c7                	mov    %eax,%edi
+  80016f:	89 d6                	mov    %edx,%esi
+  800171:	8b 45 08             	mov    0x8(%ebp),%eax
+  800174:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800177:	89 d1                	mov    %edx,%ecx
+  800179:	89 c2                	mov    %eax,%edx
+  80017b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80017e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800181:	8b 45 10             	mov    0x10(%ebp),%eax
+  800184:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  800187:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80018a:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800191:	39 c2                	cmp    %eax,%edx
+  800193:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800196:	72 3e                	jb     8001d6 <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  800198:	83 ec 0c             	sub    $0xc,%esp
+  80019b:	ff 75 18             	push   0x18(%ebp)
+  80019e:	83 eb 01             	sub    $0x1,%ebx
+  8001a1:	53                   	push   %ebx
+  8001a2:	50                   	push   %eax
+  8001a3:	83 ec 08             	sub    $0x8,%esp
+  8001a6:	ff 75 e4             	push   -0x1c(%ebp)
+  8001a9:	ff 75 e0             	push   -0x20(%ebp)
+  8001ac:	ff 75 dc             	push   -0x24(%ebp)
+  8001af:	ff 75 d8             	push   -0x28(%ebp)
+  8001b2:	e8 21 2b 00 00       	call   802cd8 <__udivdi3>
+  8001b7:	83 c4 18             	add    $0x18,%esp
+  8001ba:	52                   	push   %edx
+  8001bb:	50                   	push   %eax
+  8001bc:	89 f2                	mov    %esi,%edx
+  8001be:	89 f8                	mov    %edi,%eax
+  8001c0:	e8 9f ff ff ff       	call   800164 <printnum>
+  8001c5:	83 c4 20             	add    $0x20,%esp
+  8001c8:	eb 13                	jmp    8001dd <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  8001ca:	83 ec 08             	sub    $0x8,%esp
+  8001cd:	56                   	push   %esi
+  8001ce:	ff 75 18             	push   0x18(%ebp)
+  8001d1:	ff d7                	call   *%edi
+  8001d3:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  8001d6:	83 eb 01             	sub    $0x1,%ebx
+  8001d9:	85 db                	test   %ebx,%ebx
+  8001db:	7f ed                	jg     8001ca <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  8001dd:	83 ec 08             	sub    $0x8,%esp
+  8001e0:	56                   	push   %esi
+  8001e1:	83 ec 04             	sub    $0x4,%esp
+  8001e4:	ff 75 e4             	push   -0x1c(%ebp)
+  8001e7:	ff 75 e0             	push   -0x20(%ebp)
+  8001ea:	ff 75 dc             	push   -0x24(%ebp)
+  8001ed:	ff 75 d8             	push   -0x28(%ebp)
+  8001f0:	e8 04 2b 00 00       	call   802cf9 <__umoddi3>
+  8001f5:	83 c4 14             	add    $0x14,%esp
+  8001f8:	0f be 80 88 2e 80 00 	movsbl 0x802e88(%eax),%eax
+  8001ff:	50                   	push   %eax
+  800200:	ff d7                	call   *%edi
+}
+  800202:	83 c4 10             	add    $0x10,%esp
+  800205:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800208:	5b                   	pop    %ebx
+  800209:	5e                   	pop    %esi
+  80020a:	5f                   	pop    %edi
+  80020b:	5d                   	pop    %ebp
+  80020c:	c3                   	ret
+
+0080020d <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80020d:	55                   	push   %ebp
+  80020e:	89 e5                	mov    %esp,%ebp
+  800210:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  800213:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  800217:	8b 10                	mov    (%eax),%edx
+  800219:	3b 50 04             	cmp    0x4(%eax),%edx
+  80021c:	73 0a                	jae    800228 <sprintputch+0x1b>
+    *b->buf++ = ch;
+  80021e:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800221:	89 08                	mov    %ecx,(%eax)
+  800223:	8b 45 08             	mov    0x8(%ebp),%eax
+  800226:	88 02                	mov    %al,(%edx)
+}
+  800228:	5d                   	pop    %ebp
+  800229:	c3                   	ret
+
+0080022a <printfmt>:
+{
+  80022a:	55                   	push   %ebp
+  80022b:	89 e5                	mov    %esp,%ebp
+  80022d:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  800230:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  800233:	50                   	push   %eax
+  800234:	ff 75 10             	push   0x10(%ebp)
+  800237:	ff 75 0c             	push   0xc(%ebp)
+  80023a:	ff 75 08             	push   0x8(%ebp)
+  80023d:	e8 05 00 00 00       	call   800247 <vprintfmt>
+}
+  800242:	83 c4 10             	add    $0x10,%esp
+  800245:	c9                   	leave
+  800246:	c3                   	ret
+
+00800247 <vprintfmt>:
+{
+  800247:	55                   	push   %ebp
+  800248:	89 e5                	mov    %esp,%ebp
+  80024a:	57                   	push   %edi
+  80024b:	56                   	push   %esi
+  80024c:	53                   	push   %ebx
+  80024d:	83 ec 2c             	sub    $0x2c,%esp
+  800250:	8b 75 08             	mov    0x8(%ebp),%esi
+  800253:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800256:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800259:	eb 0a                	jmp    800265 <vprintfmt+0x1e>
+      putch(ch, putdat);
+  80025b:	83 ec 08             	sub    $0x8,%esp
+  80025e:	53                   	push   %ebx
+  80025f:	50                   	push   %eax
+  800260:	ff d6                	call   *%esi
+  800262:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  800265:	83 c7 01             	add    $0x1,%edi
+  800268:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80026c:	83 f8 25             	cmp    $0x25,%eax
+  80026f:	74 0c                	je     80027d <vprintfmt+0x36>
+      if (ch == '\0')
+  800271:	85 c0                	test   %eax,%eax
+  800273:	75 e6                	jne    80025b <vprintfmt+0x14>
+}
+  800275:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800278:	5b                   	pop    %ebx
+  800279:	5e                   	pop    %esi
+  80027a:	5f                   	pop    %edi
+  80027b:	5d                   	pop    %ebp
+  80027c:	c3                   	ret
+    padc = ' ';
+  80027d:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  800281:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  800288:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  80028f:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  800296:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  80029b:	8d 47 01             	lea    0x1(%edi),%eax
+  80029e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8002a1:	0f b6 17             	movzbl (%edi),%edx
+  8002a4:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8002a7:	3c 55                	cmp    $0x55,%al
+  8002a9:	0f 87 cf 03 00 00    	ja     80067e <vprintfmt+0x437>
+  8002af:	0f b6 c0             	movzbl %al,%eax
+  8002b2:	ff 24 85 e0 2f 80 00 	jmp    *0x802fe0(,%eax,4)
+  8002b9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  8002bc:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8002c0:	eb d9                	jmp    80029b <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  8002c2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8002c5:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8002c9:	eb d0                	jmp    80029b <vprintfmt+0x54>
+  8002cb:	0f b6 d2             	movzbl %dl,%edx
+  8002ce:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  8002d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002d6:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  8002d9:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8002dc:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  8002e0:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  8002e3:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8002e6:	83 f9 09             	cmp    $0x9,%ecx
+  8002e9:	77 55                	ja     800340 <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  8002eb:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  8002ee:	eb e9                	jmp    8002d9 <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  8002f0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8002f3:	8b 00                	mov    (%eax),%eax
+  8002f5:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8002f8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8002fb:	8d 40 04             	lea    0x4(%eax),%eax
+  8002fe:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  800301:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  800304:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800308:	79 91                	jns    80029b <vprintfmt+0x54>
+        width = precision, precision = -1;
+  80030a:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80030d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800310:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800317:	eb 82                	jmp    80029b <vprintfmt+0x54>
+      if (width < 0)
+  800319:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80031c:	85 d2                	test   %edx,%edx
+  80031e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800323:	0f 49 c2             	cmovns %edx,%eax
+  800326:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  800329:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  80032c:	e9 6a ff ff ff       	jmp    80029b <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  800331:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  800334:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  80033b:	e9 5b ff ff ff       	jmp    80029b <vprintfmt+0x54>
+  800340:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800343:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800346:	eb bc                	jmp    800304 <vprintfmt+0xbd>
+      lflag++;
+  800348:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  80034b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  80034e:	e9 48 ff ff ff       	jmp    80029b <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  800353:	8b 45 14             	mov    0x14(%ebp),%eax
+  800356:	8d 78 04             	lea    0x4(%eax),%edi
+  800359:	83 ec 08             	sub    $0x8,%esp
+  80035c:	53                   	push   %ebx
+  80035d:	ff 30                	push   (%eax)
+  80035f:	ff d6                	call   *%esi
+      break;
+  800361:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  800364:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  800367:	e9 b1 02 00 00       	jmp    80061d <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  80036c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80036f:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  800372:	8b 10                	mov    (%eax),%edx
+  800374:	89 d0                	mov    %edx,%eax
+  800376:	f7 d8                	neg    %eax
+  800378:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80037b:	83 f8 10             	cmp    $0x10,%eax
+  80037e:	7f 23                	jg     8003a3 <vprintfmt+0x15c>
+  800380:	8b 14 85 40 31 80 00 	mov    0x803140(,%eax,4),%edx
+  800387:	85 d2                	test   %edx,%edx
+  800389:	74 18                	je     8003a3 <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  80038b:	52                   	push   %edx
+  80038c:	68 8a 32 80 00       	push   $0x80328a
+  800391:	53                   	push   %ebx
+  800392:	56                   	push   %esi
+  800393:	e8 92 fe ff ff       	call   80022a <printfmt>
+  800398:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  80039b:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80039e:	e9 7a 02 00 00       	jmp    80061d <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  8003a3:	50                   	push   %eax
+  8003a4:	68 a0 2e 80 00       	push   $0x802ea0
+  8003a9:	53                   	push   %ebx
+  8003aa:	56                   	push   %esi
+  8003ab:	e8 7a fe ff ff       	call   80022a <printfmt>
+  8003b0:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  8003b3:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  8003b6:	e9 62 02 00 00       	jmp    80061d <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  8003bb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003be:	83 c0 04             	add    $0x4,%eax
+  8003c1:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8003c4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003c7:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  8003c9:	85 c9                	test   %ecx,%ecx
+  8003cb:	b8 99 2e 80 00       	mov    $0x802e99,%eax
+  8003d0:	0f 45 c1             	cmovne %ecx,%eax
+  8003d3:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  8003d6:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003da:	7e 06                	jle    8003e2 <vprintfmt+0x19b>
+  8003dc:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8003e0:	75 0b                	jne    8003ed <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8003e2:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8003e5:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8003e8:	89 75 08             	mov    %esi,0x8(%ebp)
+  8003eb:	eb 5c                	jmp    800449 <vprintfmt+0x202>
+  8003ed:	83 ec 08             	sub    $0x8,%esp
+  8003f0:	ff 75 d0             	push   -0x30(%ebp)
+  8003f3:	ff 75 cc             	push   -0x34(%ebp)
+  8003f6:	e8 20 03 00 00       	call   80071b <strnlen>
+  8003fb:	89 c2                	mov    %eax,%edx
+  8003fd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800400:	29 d0                	sub    %edx,%eax
+  800402:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  800405:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800409:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80040c:	89 75 08             	mov    %esi,0x8(%ebp)
+  80040f:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800411:	eb 0e                	jmp    800421 <vprintfmt+0x1da>
+          putch(padc, putdat);
+  800413:	83 ec 08             	sub    $0x8,%esp
+  800416:	53                   	push   %ebx
+  800417:	57                   	push   %edi
+  800418:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  80041b:	83 ee 01             	sub    $0x1,%esi
+  80041e:	83 c4 10             	add    $0x10,%esp
+  800421:	85 f6                	test   %esi,%esi
+  800423:	7f ee                	jg     800413 <vprintfmt+0x1cc>
+  800425:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800428:	8b 75 08             	mov    0x8(%ebp),%esi
+  80042b:	85 c0                	test   %eax,%eax
+  80042d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800432:	0f 49 d0             	cmovns %eax,%edx
+  800435:	29 d0                	sub    %edx,%eax
+  800437:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80043a:	eb a6                	jmp    8003e2 <vprintfmt+0x19b>
+          putch(ch, putdat);
+  80043c:	83 ec 08             	sub    $0x8,%esp
+  80043f:	53                   	push   %ebx
+  800440:	52                   	push   %edx
+  800441:	ff 55 08             	call   *0x8(%ebp)
+  800444:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800447:	89 f1                	mov    %esi,%ecx
+  800449:	8d 71 01             	lea    0x1(%ecx),%esi
+  80044c:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800450:	0f be d0             	movsbl %al,%edx
+  800453:	85 d2                	test   %edx,%edx
+  800455:	74 28                	je     80047f <vprintfmt+0x238>
+  800457:	85 ff                	test   %edi,%edi
+  800459:	78 05                	js     800460 <vprintfmt+0x219>
+  80045b:	83 ef 01             	sub    $0x1,%edi
+  80045e:	78 30                	js     800490 <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  800460:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800464:	74 d6                	je     80043c <vprintfmt+0x1f5>
+  800466:	0f be c0             	movsbl %al,%eax
+  800469:	83 e8 20             	sub    $0x20,%eax
+  80046c:	83 f8 5e             	cmp    $0x5e,%eax
+  80046f:	76 cb                	jbe    80043c <vprintfmt+0x1f5>
+          putch('?', putdat);
+  800471:	83 ec 08             	sub    $0x8,%esp
+  800474:	53                   	push   %ebx
+  800475:	6a 3f                	push   $0x3f
+  800477:	ff 55 08             	call   *0x8(%ebp)
+  80047a:	83 c4 10             	add    $0x10,%esp
+  80047d:	eb c8                	jmp    800447 <vprintfmt+0x200>
+  80047f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800482:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800485:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800488:	01 d0                	add    %edx,%eax
+  80048a:	29 c8                	sub    %ecx,%eax
+  80048c:	89 c7                	mov    %eax,%edi
+  80048e:	eb 13                	jmp    8004a3 <vprintfmt+0x25c>
+  800490:	8b 75 08             	mov    0x8(%ebp),%esi
+  800493:	eb ed                	jmp    800482 <vprintfmt+0x23b>
+        putch(' ', putdat);
+  800495:	83 ec 08             	sub    $0x8,%esp
+  800498:	53                   	push   %ebx
+  800499:	6a 20                	push   $0x20
+  80049b:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  80049d:	83 ef 01             	sub    $0x1,%edi
+  8004a0:	83 c4 10             	add    $0x10,%esp
+  8004a3:	85 ff                	test   %edi,%edi
+  8004a5:	7f ee                	jg     800495 <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  8004a7:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8004aa:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004ad:	e9 6b 01 00 00       	jmp    80061d <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  8004b2:	83 f9 01             	cmp    $0x1,%ecx
+  8004b5:	7f 1f                	jg     8004d6 <vprintfmt+0x28f>
+  else if (lflag)
+  8004b7:	85 c9                	test   %ecx,%ecx
+  8004b9:	74 67                	je     800522 <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  8004bb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004be:	8b 00                	mov    (%eax),%eax
+  8004c0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004c3:	89 c1                	mov    %eax,%ecx
+  8004c5:	c1 f9 1f             	sar    $0x1f,%ecx
+  8004c8:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8004cb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004ce:	8d 40 04             	lea    0x4(%eax),%eax
+  8004d1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004d4:	eb 17                	jmp    8004ed <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  8004d6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004d9:	8b 50 04             	mov    0x4(%eax),%edx
+  8004dc:	8b 00                	mov    (%eax),%eax
+  8004de:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004e1:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8004e4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004e7:	8d 40 08             	lea    0x8(%eax),%eax
+  8004ea:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  8004ed:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8004f0:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  8004f3:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  8004f8:	85 c9                	test   %ecx,%ecx
+  8004fa:	0f 89 03 01 00 00    	jns    800603 <vprintfmt+0x3bc>
+        putch('-', putdat);
+  800500:	83 ec 08             	sub    $0x8,%esp
+  800503:	53                   	push   %ebx
+  800504:	6a 2d                	push   $0x2d
+  800506:	ff d6                	call   *%esi
+        num = -(long long)num;
+  800508:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80050b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80050e:	f7 da                	neg    %edx
+  800510:	83 d1 00             	adc    $0x0,%ecx
+  800513:	f7 d9                	neg    %ecx
+  800515:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  800518:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80051d:	e9 e1 00 00 00       	jmp    800603 <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  800522:	8b 45 14             	mov    0x14(%ebp),%eax
+  800525:	8b 00                	mov    (%eax),%eax
+  800527:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80052a:	89 c1                	mov    %eax,%ecx
+  80052c:	c1 f9 1f             	sar    $0x1f,%ecx
+  80052f:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800532:	8b 45 14             	mov    0x14(%ebp),%eax
+  800535:	8d 40 04             	lea    0x4(%eax),%eax
+  800538:	89 45 14             	mov    %eax,0x14(%ebp)
+  80053b:	eb b0                	jmp    8004ed <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  80053d:	83 f9 01             	cmp    $0x1,%ecx
+  800540:	7f 1e                	jg     800560 <vprintfmt+0x319>
+  else if (lflag)
+  800542:	85 c9                	test   %ecx,%ecx
+  800544:	74 32                	je     800578 <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  800546:	8b 45 14             	mov    0x14(%ebp),%eax
+  800549:	8b 10                	mov    (%eax),%edx
+  80054b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800550:	8d 40 04             	lea    0x4(%eax),%eax
+  800553:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800556:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  80055b:	e9 a3 00 00 00       	jmp    800603 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800560:	8b 45 14             	mov    0x14(%ebp),%eax
+  800563:	8b 10                	mov    (%eax),%edx
+  800565:	8b 48 04             	mov    0x4(%eax),%ecx
+  800568:	8d 40 08             	lea    0x8(%eax),%eax
+  80056b:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  80056e:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  800573:	e9 8b 00 00 00       	jmp    800603 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800578:	8b 45 14             	mov    0x14(%ebp),%eax
+  80057b:	8b 10                	mov    (%eax),%edx
+  80057d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800582:	8d 40 04             	lea    0x4(%eax),%eax
+  800585:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800588:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  80058d:	eb 74                	jmp    800603 <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  80058f:	83 f9 01             	cmp    $0x1,%ecx
+  800592:	7f 1b                	jg     8005af <vprintfmt+0x368>
+  else if (lflag)
+  800594:	85 c9                	test   %ecx,%ecx
+  800596:	74 2c                	je     8005c4 <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  800598:	8b 45 14             	mov    0x14(%ebp),%eax
+  80059b:	8b 10                	mov    (%eax),%edx
+  80059d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005a2:	8d 40 04             	lea    0x4(%eax),%eax
+  8005a5:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8005a8:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  8005ad:	eb 54                	jmp    800603 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  8005af:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b2:	8b 10                	mov    (%eax),%edx
+  8005b4:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005b7:	8d 40 08             	lea    0x8(%eax),%eax
+  8005ba:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8005bd:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  8005c2:	eb 3f                	jmp    800603 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8005c4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c7:	8b 10                	mov    (%eax),%edx
+  8005c9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005ce:	8d 40 04             	lea    0x4(%eax),%eax
+  8005d1:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8005d4:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  8005d9:	eb 28                	jmp    800603 <vprintfmt+0x3bc>
+      putch('0', putdat);
+  8005db:	83 ec 08             	sub    $0x8,%esp
+  8005de:	53                   	push   %ebx
+  8005df:	6a 30                	push   $0x30
+  8005e1:	ff d6                	call   *%esi
+      putch('x', putdat);
+  8005e3:	83 c4 08             	add    $0x8,%esp
+  8005e6:	53                   	push   %ebx
+  8005e7:	6a 78                	push   $0x78
+  8005e9:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  8005eb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ee:	8b 10                	mov    (%eax),%edx
+  8005f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  8005f5:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  8005f8:	8d 40 04             	lea    0x4(%eax),%eax
+  8005fb:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8005fe:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  800603:	83 ec 0c             	sub    $0xc,%esp
+  800606:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80060a:	50                   	push   %eax
+  80060b:	ff 75 e0             	push   -0x20(%ebp)
+  80060e:	57                   	push   %edi
+  80060f:	51                   	push   %ecx
+  800610:	52                   	push   %edx
+  800611:	89 da                	mov    %ebx,%edx
+  800613:	89 f0                	mov    %esi,%eax
+  800615:	e8 4a fb ff ff       	call   800164 <printnum>
+      break;
+  80061a:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  80061d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  800620:	e9 40 fc ff ff       	jmp    800265 <vprintfmt+0x1e>
+  if (lflag >= 2)
+  800625:	83 f9 01             	cmp    $0x1,%ecx
+  800628:	7f 1b                	jg     800645 <vprintfmt+0x3fe>
+  else if (lflag)
+  80062a:	85 c9                	test   %ecx,%ecx
+  80062c:	74 2c                	je     80065a <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  80062e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800631:	8b 10                	mov    (%eax),%edx
+  800633:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800638:	8d 40 04             	lea    0x4(%eax),%eax
+  80063b:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  80063e:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  800643:	eb be                	jmp    800603 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800645:	8b 45 14             	mov    0x14(%ebp),%eax
+  800648:	8b 10                	mov    (%eax),%edx
+  80064a:	8b 48 04             	mov    0x4(%eax),%ecx
+  80064d:	8d 40 08             	lea    0x8(%eax),%eax
+  800650:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800653:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  800658:	eb a9                	jmp    800603 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  80065a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80065d:	8b 10                	mov    (%eax),%edx
+  80065f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800664:	8d 40 04             	lea    0x4(%eax),%eax
+  800667:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  80066a:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  80066f:	eb 92                	jmp    800603 <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  800671:	83 ec 08             	sub    $0x8,%esp
+  800674:	53                   	push   %ebx
+  800675:	6a 25                	push   $0x25
+  800677:	ff d6                	call   *%esi
+      break;
+  800679:	83 c4 10             	add    $0x10,%esp
+  80067c:	eb 9f                	jmp    80061d <vprintfmt+0x3d6>
+      putch('%', putdat);
+  80067e:	83 ec 08             	sub    $0x8,%esp
+  800681:	53                   	push   %ebx
+  800682:	6a 25                	push   $0x25
+  800684:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  800686:	83 c4 10             	add    $0x10,%esp
+  800689:	89 f8                	mov    %edi,%eax
+  80068b:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80068f:	74 05                	je     800696 <vprintfmt+0x44f>
+  800691:	83 e8 01             	sub    $0x1,%eax
+  800694:	eb f5                	jmp    80068b <vprintfmt+0x444>
+  800696:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800699:	eb 82                	jmp    80061d <vprintfmt+0x3d6>
+
+0080069b <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80069b:	55                   	push   %ebp
+  80069c:	89 e5                	mov    %esp,%ebp
+  80069e:	83 ec 18             	sub    $0x18,%esp
+  8006a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006a4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  8006a7:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8006aa:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8006ae:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8006b1:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  8006b8:	85 c0                	test   %eax,%eax
+  8006ba:	74 26                	je     8006e2 <vsnprintf+0x47>
+  8006bc:	85 d2                	test   %edx,%edx
+  8006be:	7e 22                	jle    8006e2 <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8006c0:	ff 75 14             	push   0x14(%ebp)
+  8006c3:	ff 75 10             	push   0x10(%ebp)
+  8006c6:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8006c9:	50                   	push   %eax
+  8006ca:	68 0d 02 80 00       	push   $0x80020d
+  8006cf:	e8 73 fb ff ff       	call   800247 <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  8006d4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8006d7:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  8006da:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8006dd:	83 c4 10             	add    $0x10,%esp
+}
+  8006e0:	c9                   	leave
+  8006e1:	c3                   	ret
+    return -E_INVAL;
+  8006e2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006e7:	eb f7                	jmp    8006e0 <vsnprintf+0x45>
+
+008006e9 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8006e9:	55                   	push   %ebp
+  8006ea:	89 e5                	mov    %esp,%ebp
+  8006ec:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  8006ef:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  8006f2:	50                   	push   %eax
+  8006f3:	ff 75 10             	push   0x10(%ebp)
+  8006f6:	ff 75 0c             	push   0xc(%ebp)
+  8006f9:	ff 75 08             	push   0x8(%ebp)
+  8006fc:	e8 9a ff ff ff       	call   80069b <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  800701:	c9                   	leave
+  800702:	c3                   	ret
+
+00800703 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800703:	55                   	push   %ebp
+  800704:	89 e5                	mov    %esp,%ebp
+  800706:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  800709:	b8 00 00 00 00       	mov    $0x0,%eax
+  80070e:	eb 03                	jmp    800713 <strlen+0x10>
+    n++;
+  800710:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  800713:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800717:	75 f7                	jne    800710 <strlen+0xd>
+  return n;
+}
+  800719:	5d                   	pop    %ebp
+  80071a:	c3                   	ret
+
+0080071b <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80071b:	55                   	push   %ebp
+  80071c:	89 e5                	mov    %esp,%ebp
+  80071e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800721:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800724:	b8 00 00 00 00       	mov    $0x0,%eax
+  800729:	eb 03                	jmp    80072e <strnlen+0x13>
+    n++;
+  80072b:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80072e:	39 d0                	cmp    %edx,%eax
+  800730:	74 08                	je     80073a <strnlen+0x1f>
+  800732:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800736:	75 f3                	jne    80072b <strnlen+0x10>
+  800738:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  80073a:	89 d0                	mov    %edx,%eax
+  80073c:	5d                   	pop    %ebp
+  80073d:	c3                   	ret
+
+0080073e <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80073e:	55                   	push   %ebp
+  80073f:	89 e5                	mov    %esp,%ebp
+  800741:	53                   	push   %ebx
+  800742:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800745:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  800748:	b8 00 00 00 00       	mov    $0x0,%eax
+  80074d:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800751:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800754:	83 c0 01             	add    $0x1,%eax
+  800757:	84 d2                	test   %dl,%dl
+  800759:	75 f2                	jne    80074d <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  80075b:	89 c8                	mov    %ecx,%eax
+  80075d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800760:	c9                   	leave
+  800761:	c3                   	ret
+
+00800762 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800762:	55                   	push   %ebp
+  800763:	89 e5                	mov    %esp,%ebp
+  800765:	53                   	push   %ebx
+  800766:	83 ec 10             	sub    $0x10,%esp
+  800769:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  80076c:	53                   	push   %ebx
+  80076d:	e8 91 ff ff ff       	call   800703 <strlen>
+  800772:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  800775:	ff 75 0c             	push   0xc(%ebp)
+  800778:	01 d8                	add    %ebx,%eax
+  80077a:	50                   	push   %eax
+  80077b:	e8 be ff ff ff       	call   80073e <strcpy>
+  return dst;
+}
+  800780:	89 d8                	mov    %ebx,%eax
+  800782:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800785:	c9                   	leave
+  800786:	c3                   	ret
+
+00800787 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  800787:	55                   	push   %ebp
+  800788:	89 e5                	mov    %esp,%ebp
+  80078a:	56                   	push   %esi
+  80078b:	53                   	push   %ebx
+  80078c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80078f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  800792:	89 f3                	mov    %esi,%ebx
+  800794:	03 5d 10             	add    0x10(%ebp),%ebx
+  800797:	89 f0                	mov    %esi,%eax
+  800799:	eb 0f                	jmp    8007aa <strncpy+0x23>
+    *dst++ = *src;
+  80079b:	83 c0 01             	add    $0x1,%eax
+  80079e:	0f b6 0a             	movzbl (%edx),%ecx
+  8007a1:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  8007a4:	80 f9 01             	cmp    $0x1,%cl
+  8007a7:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  8007aa:	39 d8                	cmp    %ebx,%eax
+  8007ac:	75 ed                	jne    80079b <strncpy+0x14>
+  }
+  return ret;
+}
+  8007ae:	89 f0                	mov    %esi,%eax
+  8007b0:	5b                   	pop    %ebx
+  8007b1:	5e                   	pop    %esi
+  8007b2:	5d                   	pop    %ebp
+  8007b3:	c3                   	ret
+
+008007b4 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8007b4:	55                   	push   %ebp
+  8007b5:	89 e5                	mov    %esp,%ebp
+  8007b7:	56                   	push   %esi
+  8007b8:	53                   	push   %ebx
+  8007b9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007bc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007bf:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  8007c2:	89 f0                	mov    %esi,%eax
+  8007c4:	85 d2                	test   %edx,%edx
+  8007c6:	74 21                	je     8007e9 <strlcpy+0x35>
+  8007c8:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8007cc:	89 f2                	mov    %esi,%edx
+  8007ce:	eb 09                	jmp    8007d9 <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  8007d0:	83 c1 01             	add    $0x1,%ecx
+  8007d3:	83 c2 01             	add    $0x1,%edx
+  8007d6:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  8007d9:	39 c2                	cmp    %eax,%edx
+  8007db:	74 09                	je     8007e6 <strlcpy+0x32>
+  8007dd:	0f b6 19             	movzbl (%ecx),%ebx
+  8007e0:	84 db                	test   %bl,%bl
+  8007e2:	75 ec                	jne    8007d0 <strlcpy+0x1c>
+  8007e4:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  8007e6:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  8007e9:	29 f0                	sub    %esi,%eax
+}
+  8007eb:	5b                   	pop    %ebx
+  8007ec:	5e                   	pop    %esi
+  8007ed:	5d                   	pop    %ebp
+  8007ee:	c3                   	ret
+
+008007ef <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8007ef:	55                   	push   %ebp
+  8007f0:	89 e5                	mov    %esp,%ebp
+  8007f2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007f5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  8007f8:	eb 06                	jmp    800800 <strcmp+0x11>
+    p++, q++;
+  8007fa:	83 c1 01             	add    $0x1,%ecx
+  8007fd:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  800800:	0f b6 01             	movzbl (%ecx),%eax
+  800803:	84 c0                	test   %al,%al
+  800805:	74 04                	je     80080b <strcmp+0x1c>
+  800807:	3a 02                	cmp    (%edx),%al
+  800809:	74 ef                	je     8007fa <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  80080b:	0f b6 c0             	movzbl %al,%eax
+  80080e:	0f b6 12             	movzbl (%edx),%edx
+  800811:	29 d0                	sub    %edx,%eax
+}
+  800813:	5d                   	pop    %ebp
+  800814:	c3                   	ret
+
+00800815 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800815:	55                   	push   %ebp
+  800816:	89 e5                	mov    %esp,%ebp
+  800818:	53                   	push   %ebx
+  800819:	8b 45 08             	mov    0x8(%ebp),%eax
+  80081c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80081f:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  800822:	eb 09                	jmp    80082d <strncmp+0x18>
+    n--, p++, q++;
+  800824:	83 ea 01             	sub    $0x1,%edx
+  800827:	83 c0 01             	add    $0x1,%eax
+  80082a:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  80082d:	85 d2                	test   %edx,%edx
+  80082f:	74 18                	je     800849 <strncmp+0x34>
+  800831:	0f b6 18             	movzbl (%eax),%ebx
+  800834:	84 db                	test   %bl,%bl
+  800836:	74 04                	je     80083c <strncmp+0x27>
+  800838:	3a 19                	cmp    (%ecx),%bl
+  80083a:	74 e8                	je     800824 <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80083c:	0f b6 00             	movzbl (%eax),%eax
+  80083f:	0f b6 11             	movzbl (%ecx),%edx
+  800842:	29 d0                	sub    %edx,%eax
+}
+  800844:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800847:	c9                   	leave
+  800848:	c3                   	ret
+    return 0;
+  800849:	b8 00 00 00 00       	mov    $0x0,%eax
+  80084e:	eb f4                	jmp    800844 <strncmp+0x2f>
+
+00800850 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800850:	55                   	push   %ebp
+  800851:	89 e5                	mov    %esp,%ebp
+  800853:	8b 45 08             	mov    0x8(%ebp),%eax
+  800856:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  80085a:	eb 03                	jmp    80085f <strchr+0xf>
+  80085c:	83 c0 01             	add    $0x1,%eax
+  80085f:	0f b6 10             	movzbl (%eax),%edx
+  800862:	84 d2                	test   %dl,%dl
+  800864:	74 06                	je     80086c <strchr+0x1c>
+    if (*s == c)
+  800866:	38 ca                	cmp    %cl,%dl
+  800868:	75 f2                	jne    80085c <strchr+0xc>
+  80086a:	eb 05                	jmp    800871 <strchr+0x21>
+      return (char*)s;
+  return 0;
+  80086c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800871:	5d                   	pop    %ebp
+  800872:	c3                   	ret
+
+00800873 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800873:	55                   	push   %ebp
+  800874:	89 e5                	mov    %esp,%ebp
+  800876:	8b 45 08             	mov    0x8(%ebp),%eax
+  800879:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  80087d:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  800880:	38 ca                	cmp    %cl,%dl
+  800882:	74 09                	je     80088d <strfind+0x1a>
+  800884:	84 d2                	test   %dl,%dl
+  800886:	74 05                	je     80088d <strfind+0x1a>
+  for (; *s; s++)
+  800888:	83 c0 01             	add    $0x1,%eax
+  80088b:	eb f0                	jmp    80087d <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  80088d:	5d                   	pop    %ebp
+  80088e:	c3                   	ret
+
+0080088f <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  80088f:	55                   	push   %ebp
+  800890:	89 e5                	mov    %esp,%ebp
+  800892:	57                   	push   %edi
+  800893:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800896:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  800899:	85 c9                	test   %ecx,%ecx
+  80089b:	74 20                	je     8008bd <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  80089d:	89 f8                	mov    %edi,%eax
+  80089f:	09 c8                	or     %ecx,%eax
+  8008a1:	a8 03                	test   $0x3,%al
+  8008a3:	75 12                	jne    8008b7 <memset+0x28>
+    c &= 0xFF;
+  8008a5:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8008a9:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  8008af:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  8008b2:	fc                   	cld
+  8008b3:	f3 ab                	rep stos %eax,%es:(%edi)
+  8008b5:	eb 06                	jmp    8008bd <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  8008b7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8008ba:	fc                   	cld
+  8008bb:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  8008bd:	89 f8                	mov    %edi,%eax
+  8008bf:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8008c2:	c9                   	leave
+  8008c3:	c3                   	ret
+
+008008c4 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8008c4:	55                   	push   %ebp
+  8008c5:	89 e5                	mov    %esp,%ebp
+  8008c7:	57                   	push   %edi
+  8008c8:	56                   	push   %esi
+  8008c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008cc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8008cf:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  8008d2:	39 c6                	cmp    %eax,%esi
+  8008d4:	73 32                	jae    800908 <memmove+0x44>
+  8008d6:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8008d9:	39 d0                	cmp    %edx,%eax
+  8008db:	73 2b                	jae    800908 <memmove+0x44>
+    s += n;
+    d += n;
+  8008dd:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8008e0:	89 d6                	mov    %edx,%esi
+  8008e2:	09 fe                	or     %edi,%esi
+  8008e4:	09 ce                	or     %ecx,%esi
+  8008e6:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8008ec:	75 0e                	jne    8008fc <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8008ee:	83 ef 04             	sub    $0x4,%edi
+  8008f1:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8008f4:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  8008f7:	fd                   	std
+  8008f8:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8008fa:	eb 09                	jmp    800905 <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8008fc:	83 ef 01             	sub    $0x1,%edi
+  8008ff:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  800902:	fd                   	std
+  800903:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  800905:	fc                   	cld
+  800906:	eb 1a                	jmp    800922 <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800908:	89 f2                	mov    %esi,%edx
+  80090a:	09 c2                	or     %eax,%edx
+  80090c:	09 ca                	or     %ecx,%edx
+  80090e:	f6 c2 03             	test   $0x3,%dl
+  800911:	75 0a                	jne    80091d <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800913:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  800916:	89 c7                	mov    %eax,%edi
+  800918:	fc                   	cld
+  800919:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80091b:	eb 05                	jmp    800922 <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  80091d:	89 c7                	mov    %eax,%edi
+  80091f:	fc                   	cld
+  800920:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  800922:	5e                   	pop    %esi
+  800923:	5f                   	pop    %edi
+  800924:	5d                   	pop    %ebp
+  800925:	c3                   	ret
+
+00800926 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800926:	55                   	push   %ebp
+  800927:	89 e5                	mov    %esp,%ebp
+  800929:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  80092c:	ff 75 10             	push   0x10(%ebp)
+  80092f:	ff 75 0c             	push   0xc(%ebp)
+  800932:	ff 75 08             	push   0x8(%ebp)
+  800935:	e8 8a ff ff ff       	call   8008c4 <memmove>
+}
+  80093a:	c9                   	leave
+  80093b:	c3                   	ret
+
+0080093c <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  80093c:	55                   	push   %ebp
+  80093d:	89 e5                	mov    %esp,%ebp
+  80093f:	56                   	push   %esi
+  800940:	53                   	push   %ebx
+  800941:	8b 45 08             	mov    0x8(%ebp),%eax
+  800944:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  800947:	89 c6                	mov    %eax,%esi
+  800949:	03 75 10             	add    0x10(%ebp),%esi
+  80094c:	eb 06                	jmp    800954 <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  80094e:	83 c0 01             	add    $0x1,%eax
+  800951:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  800954:	39 f0                	cmp    %esi,%eax
+  800956:	74 14                	je     80096c <memcmp+0x30>
+    if (*s1 != *s2)
+  800958:	0f b6 08             	movzbl (%eax),%ecx
+  80095b:	0f b6 1a             	movzbl (%edx),%ebx
+  80095e:	38 d9                	cmp    %bl,%cl
+  800960:	74 ec                	je     80094e <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  800962:	0f b6 c1             	movzbl %cl,%eax
+  800965:	0f b6 db             	movzbl %bl,%ebx
+  800968:	29 d8                	sub    %ebx,%eax
+  80096a:	eb 05                	jmp    800971 <memcmp+0x35>
+  }
+
+  return 0;
+  80096c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800971:	5b                   	pop    %ebx
+  800972:	5e                   	pop    %esi
+  800973:	5d                   	pop    %ebp
+  800974:	c3                   	ret
+
+00800975 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800975:	55                   	push   %ebp
+  800976:	89 e5                	mov    %esp,%ebp
+  800978:	8b 45 08             	mov    0x8(%ebp),%eax
+  80097b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  80097e:	89 c2                	mov    %eax,%edx
+  800980:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  800983:	eb 03                	jmp    800988 <memfind+0x13>
+  800985:	83 c0 01             	add    $0x1,%eax
+  800988:	39 d0                	cmp    %edx,%eax
+  80098a:	73 04                	jae    800990 <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  80098c:	38 08                	cmp    %cl,(%eax)
+  80098e:	75 f5                	jne    800985 <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  800990:	5d                   	pop    %ebp
+  800991:	c3                   	ret
+
+00800992 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800992:	55                   	push   %ebp
+  800993:	89 e5                	mov    %esp,%ebp
+  800995:	57                   	push   %edi
+  800996:	56                   	push   %esi
+  800997:	53                   	push   %ebx
+  800998:	8b 55 08             	mov    0x8(%ebp),%edx
+  80099b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  80099e:	eb 03                	jmp    8009a3 <strtol+0x11>
+    s++;
+  8009a0:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  8009a3:	0f b6 02             	movzbl (%edx),%eax
+  8009a6:	3c 20                	cmp    $0x20,%al
+  8009a8:	74 f6                	je     8009a0 <strtol+0xe>
+  8009aa:	3c 09                	cmp    $0x9,%al
+  8009ac:	74 f2                	je     8009a0 <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  8009ae:	3c 2b                	cmp    $0x2b,%al
+  8009b0:	74 2a                	je     8009dc <strtol+0x4a>
+  int neg = 0;
+  8009b2:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  8009b7:	3c 2d                	cmp    $0x2d,%al
+  8009b9:	74 2b                	je     8009e6 <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8009bb:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8009c1:	75 0f                	jne    8009d2 <strtol+0x40>
+  8009c3:	80 3a 30             	cmpb   $0x30,(%edx)
+  8009c6:	74 28                	je     8009f0 <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  8009c8:	85 db                	test   %ebx,%ebx
+  8009ca:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8009cf:	0f 44 d8             	cmove  %eax,%ebx
+  8009d2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009d7:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8009da:	eb 46                	jmp    800a22 <strtol+0x90>
+    s++;
+  8009dc:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  8009df:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009e4:	eb d5                	jmp    8009bb <strtol+0x29>
+    s++, neg = 1;
+  8009e6:	83 c2 01             	add    $0x1,%edx
+  8009e9:	bf 01 00 00 00       	mov    $0x1,%edi
+  8009ee:	eb cb                	jmp    8009bb <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8009f0:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8009f4:	74 0e                	je     800a04 <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  8009f6:	85 db                	test   %ebx,%ebx
+  8009f8:	75 d8                	jne    8009d2 <strtol+0x40>
+    s++, base = 8;
+  8009fa:	83 c2 01             	add    $0x1,%edx
+  8009fd:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a02:	eb ce                	jmp    8009d2 <strtol+0x40>
+    s += 2, base = 16;
+  800a04:	83 c2 02             	add    $0x2,%edx
+  800a07:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a0c:	eb c4                	jmp    8009d2 <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  800a0e:	0f be c0             	movsbl %al,%eax
+  800a11:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  800a14:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a17:	7d 3a                	jge    800a53 <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  800a19:	83 c2 01             	add    $0x1,%edx
+  800a1c:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a20:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  800a22:	0f b6 02             	movzbl (%edx),%eax
+  800a25:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a28:	89 f3                	mov    %esi,%ebx
+  800a2a:	80 fb 09             	cmp    $0x9,%bl
+  800a2d:	76 df                	jbe    800a0e <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  800a2f:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800a32:	89 f3                	mov    %esi,%ebx
+  800a34:	80 fb 19             	cmp    $0x19,%bl
+  800a37:	77 08                	ja     800a41 <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  800a39:	0f be c0             	movsbl %al,%eax
+  800a3c:	83 e8 57             	sub    $0x57,%eax
+  800a3f:	eb d3                	jmp    800a14 <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  800a41:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800a44:	89 f3                	mov    %esi,%ebx
+  800a46:	80 fb 19             	cmp    $0x19,%bl
+  800a49:	77 08                	ja     800a53 <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  800a4b:	0f be c0             	movsbl %al,%eax
+  800a4e:	83 e8 37             	sub    $0x37,%eax
+  800a51:	eb c1                	jmp    800a14 <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  800a53:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800a57:	74 05                	je     800a5e <strtol+0xcc>
+    *endptr = (char*)s;
+  800a59:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a5c:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  800a5e:	89 c8                	mov    %ecx,%eax
+  800a60:	f7 d8                	neg    %eax
+  800a62:	85 ff                	test   %edi,%edi
+  800a64:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800a67:	89 c8                	mov    %ecx,%eax
+  800a69:	5b                   	pop    %ebx
+  800a6a:	5e                   	pop    %esi
+  800a6b:	5f                   	pop    %edi
+  800a6c:	5d                   	pop    %ebp
+  800a6d:	c3                   	ret
+
+00800a6e <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800a6e:	55                   	push   %ebp
+  800a6f:	89 e5                	mov    %esp,%ebp
+  800a71:	57                   	push   %edi
+  800a72:	56                   	push   %esi
+  800a73:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800a74:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a79:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a7c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a7f:	89 c3                	mov    %eax,%ebx
+  800a81:	89 c7                	mov    %eax,%edi
+  800a83:	89 c6                	mov    %eax,%esi
+  800a85:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800a87:	5b                   	pop    %ebx
+  800a88:	5e                   	pop    %esi
+  800a89:	5f                   	pop    %edi
+  800a8a:	5d                   	pop    %ebp
+  800a8b:	c3                   	ret
+
+00800a8c <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800a8c:	55                   	push   %ebp
+  800a8d:	89 e5                	mov    %esp,%ebp
+  800a8f:	57                   	push   %edi
+  800a90:	56                   	push   %esi
+  800a91:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800a92:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a97:	b8 01 00 00 00       	mov    $0x1,%eax
+  800a9c:	89 d1                	mov    %edx,%ecx
+  800a9e:	89 d3                	mov    %edx,%ebx
+  800aa0:	89 d7                	mov    %edx,%edi
+  800aa2:	89 d6                	mov    %edx,%esi
+  800aa4:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800aa6:	5b                   	pop    %ebx
+  800aa7:	5e                   	pop    %esi
+  800aa8:	5f                   	pop    %edi
+  800aa9:	5d                   	pop    %ebp
+  800aaa:	c3                   	ret
+
+00800aab <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800aab:	55                   	push   %ebp
+  800aac:	89 e5                	mov    %esp,%ebp
+  800aae:	57                   	push   %edi
+  800aaf:	56                   	push   %esi
+  800ab0:	53                   	push   %ebx
+  800ab1:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800ab4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ab9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800abc:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ac1:	89 cb                	mov    %ecx,%ebx
+  800ac3:	89 cf                	mov    %ecx,%edi
+  800ac5:	89 ce                	mov    %ecx,%esi
+  800ac7:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ac9:	85 c0                	test   %eax,%eax
+  800acb:	7f 08                	jg     800ad5 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800acd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ad0:	5b                   	pop    %ebx
+  800ad1:	5e                   	pop    %esi
+  800ad2:	5f                   	pop    %edi
+  800ad3:	5d                   	pop    %ebp
+  800ad4:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ad5:	83 ec 0c             	sub    $0xc,%esp
+  800ad8:	50                   	push   %eax
+  800ad9:	6a 03                	push   $0x3
+  800adb:	68 a3 31 80 00       	push   $0x8031a3
+  800ae0:	6a 23                	push   $0x23
+  800ae2:	68 c0 31 80 00       	push   $0x8031c0
+  800ae7:	e8 41 1f 00 00       	call   802a2d <_panic>
+
+00800aec <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800aec:	55                   	push   %ebp
+  800aed:	89 e5                	mov    %esp,%ebp
+  800aef:	57                   	push   %edi
+  800af0:	56                   	push   %esi
+  800af1:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800af2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800af7:	b8 02 00 00 00       	mov    $0x2,%eax
+  800afc:	89 d1                	mov    %edx,%ecx
+  800afe:	89 d3                	mov    %edx,%ebx
+  800b00:	89 d7                	mov    %edx,%edi
+  800b02:	89 d6                	mov    %edx,%esi
+  800b04:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800b06:	5b                   	pop    %ebx
+  800b07:	5e                   	pop    %esi
+  800b08:	5f                   	pop    %edi
+  800b09:	5d                   	pop    %ebp
+  800b0a:	c3                   	ret
+
+00800b0b <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800b0b:	55                   	push   %ebp
+  800b0c:	89 e5                	mov    %esp,%ebp
+  800b0e:	57                   	push   %edi
+  800b0f:	56                   	push   %esi
+  800b10:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800b11:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b16:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800b1b:	89 d1                	mov    %edx,%ecx
+  800b1d:	89 d3                	mov    %edx,%ebx
+  800b1f:	89 d7                	mov    %edx,%edi
+  800b21:	89 d6                	mov    %edx,%esi
+  800b23:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800b25:	5b                   	pop    %ebx
+  800b26:	5e                   	pop    %esi
+  800b27:	5f                   	pop    %edi
+  800b28:	5d                   	pop    %ebp
+  800b29:	c3                   	ret
+
+00800b2a <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  800b2a:	55                   	push   %ebp
+  800b2b:	89 e5                	mov    %esp,%ebp
+  800b2d:	57                   	push   %edi
+  800b2e:	56                   	push   %esi
+  800b2f:	53                   	push   %ebx
+  800b30:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  800b33:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  800b37:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b3c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b3f:	b8 14 00 00 00       	mov    $0x14,%eax
+  800b44:	89 df                	mov    %ebx,%edi
+  800b46:	89 de                	mov    %ebx,%esi
+  800b48:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800b4a:	85 c0                	test   %eax,%eax
+  800b4c:	7f 08                	jg     800b56 <sys_env_set_cow+0x2c>
+}
+  800b4e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b51:	5b                   	pop    %ebx
+  800b52:	5e                   	pop    %esi
+  800b53:	5f                   	pop    %edi
+  800b54:	5d                   	pop    %ebp
+  800b55:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800b56:	83 ec 0c             	sub    $0xc,%esp
+  800b59:	50                   	push   %eax
+  800b5a:	6a 14                	push   $0x14
+  800b5c:	68 a3 31 80 00       	push   $0x8031a3
+  800b61:	6a 23                	push   $0x23
+  800b63:	68 c0 31 80 00       	push   $0x8031c0
+  800b68:	e8 c0 1e 00 00       	call   802a2d <_panic>
+
+00800b6d <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800b6d:	55                   	push   %ebp
+  800b6e:	89 e5                	mov    %esp,%ebp
+  800b70:	57                   	push   %edi
+  800b71:	56                   	push   %esi
+  800b72:	53                   	push   %ebx
+  800b73:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800b76:	be 00 00 00 00       	mov    $0x0,%esi
+  800b7b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b7e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b81:	b8 04 00 00 00       	mov    $0x4,%eax
+  800b86:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800b89:	89 f7                	mov    %esi,%edi
+  800b8b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800b8d:	85 c0                	test   %eax,%eax
+  800b8f:	7f 08                	jg     800b99 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  800b91:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b94:	5b                   	pop    %ebx
+  800b95:	5e                   	pop    %esi
+  800b96:	5f                   	pop    %edi
+  800b97:	5d                   	pop    %ebp
+  800b98:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800b99:	83 ec 0c             	sub    $0xc,%esp
+  800b9c:	50                   	push   %eax
+  800b9d:	6a 04                	push   $0x4
+  800b9f:	68 a3 31 80 00       	push   $0x8031a3
+  800ba4:	6a 23                	push   $0x23
+  800ba6:	68 c0 31 80 00       	push   $0x8031c0
+  800bab:	e8 7d 1e 00 00       	call   802a2d <_panic>
+
+00800bb0 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800bb0:	55                   	push   %ebp
+  800bb1:	89 e5                	mov    %esp,%ebp
+  800bb3:	57                   	push   %edi
+  800bb4:	56                   	push   %esi
+  800bb5:	53                   	push   %ebx
+  800bb6:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800bb9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bbc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bbf:	b8 05 00 00 00       	mov    $0x5,%eax
+  800bc4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800bc7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800bca:	8b 75 18             	mov    0x18(%ebp),%esi
+  800bcd:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800bcf:	85 c0                	test   %eax,%eax
+  800bd1:	7f 08                	jg     800bdb <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  800bd3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bd6:	5b                   	pop    %ebx
+  800bd7:	5e                   	pop    %esi
+  800bd8:	5f                   	pop    %edi
+  800bd9:	5d                   	pop    %ebp
+  800bda:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800bdb:	83 ec 0c             	sub    $0xc,%esp
+  800bde:	50                   	push   %eax
+  800bdf:	6a 05                	push   $0x5
+  800be1:	68 a3 31 80 00       	push   $0x8031a3
+  800be6:	6a 23                	push   $0x23
+  800be8:	68 c0 31 80 00       	push   $0x8031c0
+  800bed:	e8 3b 1e 00 00       	call   802a2d <_panic>
+
+00800bf2 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800bf2:	55                   	push   %ebp
+  800bf3:	89 e5                	mov    %esp,%ebp
+  800bf5:	57                   	push   %edi
+  800bf6:	56                   	push   %esi
+  800bf7:	53                   	push   %ebx
+  800bf8:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800bfb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c00:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c03:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c06:	b8 06 00 00 00       	mov    $0x6,%eax
+  800c0b:	89 df                	mov    %ebx,%edi
+  800c0d:	89 de                	mov    %ebx,%esi
+  800c0f:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c11:	85 c0                	test   %eax,%eax
+  800c13:	7f 08                	jg     800c1d <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  800c15:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c18:	5b                   	pop    %ebx
+  800c19:	5e                   	pop    %esi
+  800c1a:	5f                   	pop    %edi
+  800c1b:	5d                   	pop    %ebp
+  800c1c:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c1d:	83 ec 0c             	sub    $0xc,%esp
+  800c20:	50                   	push   %eax
+  800c21:	6a 06                	push   $0x6
+  800c23:	68 a3 31 80 00       	push   $0x8031a3
+  800c28:	6a 23                	push   $0x23
+  800c2a:	68 c0 31 80 00       	push   $0x8031c0
+  800c2f:	e8 f9 1d 00 00       	call   802a2d <_panic>
+
+00800c34 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  800c34:	55                   	push   %ebp
+  800c35:	89 e5                	mov    %esp,%ebp
+  800c37:	57                   	push   %edi
+  800c38:	56                   	push   %esi
+  800c39:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800c3a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c3d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c40:	b8 11 00 00 00       	mov    $0x11,%eax
+  800c45:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c48:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c4b:	8b 75 18             	mov    0x18(%ebp),%esi
+  800c4e:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  800c50:	5b                   	pop    %ebx
+  800c51:	5e                   	pop    %esi
+  800c52:	5f                   	pop    %edi
+  800c53:	5d                   	pop    %ebp
+  800c54:	c3                   	ret
+
+00800c55 <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  800c55:	55                   	push   %ebp
+  800c56:	89 e5                	mov    %esp,%ebp
+  800c58:	57                   	push   %edi
+  800c59:	56                   	push   %esi
+  800c5a:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800c5b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c5e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c61:	b8 12 00 00 00       	mov    $0x12,%eax
+  800c66:	be 00 00 00 00       	mov    $0x0,%esi
+  800c6b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c6e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c71:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  800c73:	5b                   	pop    %ebx
+  800c74:	5e                   	pop    %esi
+  800c75:	5f                   	pop    %edi
+  800c76:	5d                   	pop    %ebp
+  800c77:	c3                   	ret
+
+00800c78 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  800c78:	55                   	push   %ebp
+  800c79:	89 e5                	mov    %esp,%ebp
+  800c7b:	57                   	push   %edi
+  800c7c:	56                   	push   %esi
+  800c7d:	53                   	push   %ebx
+  800c7e:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800c81:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c86:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c89:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c8c:	b8 16 00 00 00       	mov    $0x16,%eax
+  800c91:	89 df                	mov    %ebx,%edi
+  800c93:	89 de                	mov    %ebx,%esi
+  800c95:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c97:	85 c0                	test   %eax,%eax
+  800c99:	7f 08                	jg     800ca3 <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  800c9b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c9e:	5b                   	pop    %ebx
+  800c9f:	5e                   	pop    %esi
+  800ca0:	5f                   	pop    %edi
+  800ca1:	5d                   	pop    %ebp
+  800ca2:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ca3:	83 ec 0c             	sub    $0xc,%esp
+  800ca6:	50                   	push   %eax
+  800ca7:	6a 16                	push   $0x16
+  800ca9:	68 a3 31 80 00       	push   $0x8031a3
+  800cae:	6a 23                	push   $0x23
+  800cb0:	68 c0 31 80 00       	push   $0x8031c0
+  800cb5:	e8 73 1d 00 00       	call   802a2d <_panic>
+
+00800cba <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  800cba:	55                   	push   %ebp
+  800cbb:	89 e5                	mov    %esp,%ebp
+  800cbd:	57                   	push   %edi
+  800cbe:	56                   	push   %esi
+  800cbf:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800cc0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cc5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cc8:	b8 17 00 00 00       	mov    $0x17,%eax
+  800ccd:	89 cb                	mov    %ecx,%ebx
+  800ccf:	89 cf                	mov    %ecx,%edi
+  800cd1:	89 ce                	mov    %ecx,%esi
+  800cd3:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  800cd5:	5b                   	pop    %ebx
+  800cd6:	5e                   	pop    %esi
+  800cd7:	5f                   	pop    %edi
+  800cd8:	5d                   	pop    %ebp
+  800cd9:	c3                   	ret
+
+00800cda <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  800cda:	55                   	push   %ebp
+  800cdb:	89 e5                	mov    %esp,%ebp
+  800cdd:	57                   	push   %edi
+  800cde:	56                   	push   %esi
+  800cdf:	53                   	push   %ebx
+  800ce0:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800ce3:	be 00 00 00 00       	mov    $0x0,%esi
+  800ce8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ceb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cee:	b8 18 00 00 00       	mov    $0x18,%eax
+  800cf3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cf6:	89 f7                	mov    %esi,%edi
+  800cf8:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800cfa:	85 c0                	test   %eax,%eax
+  800cfc:	7f 08                	jg     800d06 <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  800cfe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d01:	5b                   	pop    %ebx
+  800d02:	5e                   	pop    %esi
+  800d03:	5f                   	pop    %edi
+  800d04:	5d                   	pop    %ebp
+  800d05:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d06:	83 ec 0c             	sub    $0xc,%esp
+  800d09:	50                   	push   %eax
+  800d0a:	6a 18                	push   $0x18
+  800d0c:	68 a3 31 80 00       	push   $0x8031a3
+  800d11:	6a 23                	push   $0x23
+  800d13:	68 c0 31 80 00       	push   $0x8031c0
+  800d18:	e8 10 1d 00 00       	call   802a2d <_panic>
+
+00800d1d <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  800d1d:	55                   	push   %ebp
+  800d1e:	89 e5                	mov    %esp,%ebp
+  800d20:	57                   	push   %edi
+  800d21:	56                   	push   %esi
+  800d22:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d23:	be 00 00 00 00       	mov    $0x0,%esi
+  800d28:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d2b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d2e:	b8 19 00 00 00       	mov    $0x19,%eax
+  800d33:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d36:	89 f7                	mov    %esi,%edi
+  800d38:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  800d3a:	5b                   	pop    %ebx
+  800d3b:	5e                   	pop    %esi
+  800d3c:	5f                   	pop    %edi
+  800d3d:	5d                   	pop    %ebp
+  800d3e:	c3                   	ret
+
+00800d3f <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  800d3f:	55                   	push   %ebp
+  800d40:	89 e5                	mov    %esp,%ebp
+  800d42:	57                   	push   %edi
+  800d43:	56                   	push   %esi
+  800d44:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d45:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d4a:	b8 15 00 00 00       	mov    $0x15,%eax
+  800d4f:	89 d1                	mov    %edx,%ecx
+  800d51:	89 d3                	mov    %edx,%ebx
+  800d53:	89 d7                	mov    %edx,%edi
+  800d55:	89 d6                	mov    %edx,%esi
+  800d57:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800d59:	5b                   	pop    %ebx
+  800d5a:	5e                   	pop    %esi
+  800d5b:	5f                   	pop    %edi
+  800d5c:	5d                   	pop    %ebp
+  800d5d:	c3                   	ret
+
+00800d5e <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800d5e:	55                   	push   %ebp
+  800d5f:	89 e5                	mov    %esp,%ebp
+  800d61:	57                   	push   %edi
+  800d62:	56                   	push   %esi
+  800d63:	53                   	push   %ebx
+  800d64:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800d67:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d6c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d6f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d72:	b8 08 00 00 00       	mov    $0x8,%eax
+  800d77:	89 df                	mov    %ebx,%edi
+  800d79:	89 de                	mov    %ebx,%esi
+  800d7b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d7d:	85 c0                	test   %eax,%eax
+  800d7f:	7f 08                	jg     800d89 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800d81:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d84:	5b                   	pop    %ebx
+  800d85:	5e                   	pop    %esi
+  800d86:	5f                   	pop    %edi
+  800d87:	5d                   	pop    %ebp
+  800d88:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d89:	83 ec 0c             	sub    $0xc,%esp
+  800d8c:	50                   	push   %eax
+  800d8d:	6a 08                	push   $0x8
+  800d8f:	68 a3 31 80 00       	push   $0x8031a3
+  800d94:	6a 23                	push   $0x23
+  800d96:	68 c0 31 80 00       	push   $0x8031c0
+  800d9b:	e8 8d 1c 00 00       	call   802a2d <_panic>
+
+00800da0 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800da0:	55                   	push   %ebp
+  800da1:	89 e5                	mov    %esp,%ebp
+  800da3:	57                   	push   %edi
+  800da4:	56                   	push   %esi
+  800da5:	53                   	push   %ebx
+  800da6:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800da9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dae:	8b 55 08             	mov    0x8(%ebp),%edx
+  800db1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800db4:	b8 09 00 00 00       	mov    $0x9,%eax
+  800db9:	89 df                	mov    %ebx,%edi
+  800dbb:	89 de                	mov    %ebx,%esi
+  800dbd:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800dbf:	85 c0                	test   %eax,%eax
+  800dc1:	7f 08                	jg     800dcb <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  800dc3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dc6:	5b                   	pop    %ebx
+  800dc7:	5e                   	pop    %esi
+  800dc8:	5f                   	pop    %edi
+  800dc9:	5d                   	pop    %ebp
+  800dca:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800dcb:	83 ec 0c             	sub    $0xc,%esp
+  800dce:	50                   	push   %eax
+  800dcf:	6a 09                	push   $0x9
+  800dd1:	68 a3 31 80 00       	push   $0x8031a3
+  800dd6:	6a 23                	push   $0x23
+  800dd8:	68 c0 31 80 00       	push   $0x8031c0
+  800ddd:	e8 4b 1c 00 00       	call   802a2d <_panic>
+
+00800de2 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800de2:	55                   	push   %ebp
+  800de3:	89 e5                	mov    %esp,%ebp
+  800de5:	57                   	push   %edi
+  800de6:	56                   	push   %esi
+  800de7:	53                   	push   %ebx
+  800de8:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800deb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800df0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800df6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800dfb:	89 df                	mov    %ebx,%edi
+  800dfd:	89 de                	mov    %ebx,%esi
+  800dff:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e01:	85 c0                	test   %eax,%eax
+  800e03:	7f 08                	jg     800e0d <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  800e05:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e08:	5b                   	pop    %ebx
+  800e09:	5e                   	pop    %esi
+  800e0a:	5f                   	pop    %edi
+  800e0b:	5d                   	pop    %ebp
+  800e0c:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e0d:	83 ec 0c             	sub    $0xc,%esp
+  800e10:	50                   	push   %eax
+  800e11:	6a 0a                	push   $0xa
+  800e13:	68 a3 31 80 00       	push   $0x8031a3
+  800e18:	6a 23                	push   $0x23
+  800e1a:	68 c0 31 80 00       	push   $0x8031c0
+  800e1f:	e8 09 1c 00 00       	call   802a2d <_panic>
+
+00800e24 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  800e24:	55                   	push   %ebp
+  800e25:	89 e5                	mov    %esp,%ebp
+  800e27:	57                   	push   %edi
+  800e28:	56                   	push   %esi
+  800e29:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e2a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e2d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e30:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800e35:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e38:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e3b:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e3e:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  800e40:	5b                   	pop    %ebx
+  800e41:	5e                   	pop    %esi
+  800e42:	5f                   	pop    %edi
+  800e43:	5d                   	pop    %ebp
+  800e44:	c3                   	ret
+
+00800e45 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  800e45:	55                   	push   %ebp
+  800e46:	89 e5                	mov    %esp,%ebp
+  800e48:	57                   	push   %edi
+  800e49:	56                   	push   %esi
+  800e4a:	53                   	push   %ebx
+  800e4b:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e4e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e53:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e56:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e59:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e5e:	89 df                	mov    %ebx,%edi
+  800e60:	89 de                	mov    %ebx,%esi
+  800e62:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e64:	85 c0                	test   %eax,%eax
+  800e66:	7f 08                	jg     800e70 <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  800e68:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e6b:	5b                   	pop    %ebx
+  800e6c:	5e                   	pop    %esi
+  800e6d:	5f                   	pop    %edi
+  800e6e:	5d                   	pop    %ebp
+  800e6f:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e70:	83 ec 0c             	sub    $0xc,%esp
+  800e73:	50                   	push   %eax
+  800e74:	6a 0d                	push   $0xd
+  800e76:	68 a3 31 80 00       	push   $0x8031a3
+  800e7b:	6a 23                	push   $0x23
+  800e7d:	68 c0 31 80 00       	push   $0x8031c0
+  800e82:	e8 a6 1b 00 00       	call   802a2d <_panic>
+
+00800e87 <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  800e87:	55                   	push   %ebp
+  800e88:	89 e5                	mov    %esp,%ebp
+  800e8a:	57                   	push   %edi
+  800e8b:	56                   	push   %esi
+  800e8c:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e8d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e92:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800e97:	89 d1                	mov    %edx,%ecx
+  800e99:	89 d3                	mov    %edx,%ebx
+  800e9b:	89 d7                	mov    %edx,%edi
+  800e9d:	89 d6                	mov    %edx,%esi
+  800e9f:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800ea1:	5b                   	pop    %ebx
+  800ea2:	5e                   	pop    %esi
+  800ea3:	5f                   	pop    %edi
+  800ea4:	5d                   	pop    %ebp
+  800ea5:	c3                   	ret
+
+00800ea6 <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  800ea6:	55                   	push   %ebp
+  800ea7:	89 e5                	mov    %esp,%ebp
+  800ea9:	57                   	push   %edi
+  800eaa:	56                   	push   %esi
+  800eab:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800eac:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eaf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eb2:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800eb7:	be 00 00 00 00       	mov    $0x0,%esi
+  800ebc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ebf:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ec2:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  800ec4:	5b                   	pop    %ebx
+  800ec5:	5e                   	pop    %esi
+  800ec6:	5f                   	pop    %edi
+  800ec7:	5d                   	pop    %ebp
+  800ec8:	c3                   	ret
+
+00800ec9 <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  800ec9:	55                   	push   %ebp
+  800eca:	89 e5                	mov    %esp,%ebp
+  800ecc:	57                   	push   %edi
+  800ecd:	56                   	push   %esi
+  800ece:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800ecf:	be 00 00 00 00       	mov    $0x0,%esi
+  800ed4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ed7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eda:	b8 10 00 00 00       	mov    $0x10,%eax
+  800edf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ee2:	89 f7                	mov    %esi,%edi
+  800ee4:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  800ee6:	5b                   	pop    %ebx
+  800ee7:	5e                   	pop    %esi
+  800ee8:	5f                   	pop    %edi
+  800ee9:	5d                   	pop    %ebp
+  800eea:	c3                   	ret
+
+00800eeb <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  800eeb:	55                   	push   %ebp
+  800eec:	89 e5                	mov    %esp,%ebp
+  800eee:	57                   	push   %edi
+  800eef:	56                   	push   %esi
+  800ef0:	53                   	push   %ebx
+  800ef1:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  800ef4:	80 3d 48 57 80 00 00 	cmpb   $0x0,0x805748
+  800efb:	74 41                	je     800f3e <sys_batch+0x53>
+  800efd:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f00:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  800f03:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  800f0a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800f0d:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  800f10:	7d 45                	jge    800f57 <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  800f12:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800f15:	8b 06                	mov    (%esi),%eax
+  800f17:	8b 56 04             	mov    0x4(%esi),%edx
+  800f1a:	8b 4e 08             	mov    0x8(%esi),%ecx
+  800f1d:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  800f20:	8b 7e 10             	mov    0x10(%esi),%edi
+  800f23:	8b 76 14             	mov    0x14(%esi),%esi
+  800f26:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  800f28:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800f2b:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  800f2e:	83 c6 1c             	add    $0x1c,%esi
+  800f31:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  800f34:	85 c0                	test   %eax,%eax
+  800f36:	78 1f                	js     800f57 <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  800f38:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  800f3c:	eb cc                	jmp    800f0a <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  800f3e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f43:	b8 13 00 00 00       	mov    $0x13,%eax
+  800f48:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f4b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f4e:	89 df                	mov    %ebx,%edi
+  800f50:	89 de                	mov    %ebx,%esi
+  800f52:	cd 30                	int    $0x30
+  800f54:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  800f57:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800f5a:	83 c4 08             	add    $0x8,%esp
+  800f5d:	5b                   	pop    %ebx
+  800f5e:	5e                   	pop    %esi
+  800f5f:	5f                   	pop    %edi
+  800f60:	5d                   	pop    %ebp
+  800f61:	c3                   	ret
+
+00800f62 <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  800f62:	55                   	push   %ebp
+  800f63:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  800f65:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f68:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  800f6e:	5d                   	pop    %ebp
+  800f6f:	c3                   	ret
+
+00800f70 <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  800f70:	55                   	push   %ebp
+  800f71:	89 e5                	mov    %esp,%ebp
+  800f73:	56                   	push   %esi
+  800f74:	53                   	push   %ebx
+  800f75:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  800f78:	8b 1e                	mov    (%esi),%ebx
+  800f7a:	85 db                	test   %ebx,%ebx
+  800f7c:	75 09                	jne    800f87 <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  800f7e:	89 d8                	mov    %ebx,%eax
+  800f80:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f83:	5b                   	pop    %ebx
+  800f84:	5e                   	pop    %esi
+  800f85:	5d                   	pop    %ebp
+  800f86:	c3                   	ret
+  b->sb_n = 0;
+  800f87:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  800f8d:	53                   	push   %ebx
+  800f8e:	8d 46 04             	lea    0x4(%esi),%eax
+  800f91:	50                   	push   %eax
+  800f92:	e8 54 ff ff ff       	call   800eeb <sys_batch>
+  800f97:	83 c4 08             	add    $0x8,%esp
+  800f9a:	85 c0                	test   %eax,%eax
+  800f9c:	78 1e                	js     800fbc <sysbatch_flush+0x4c>
+  if (r < n)
+  800f9e:	39 c3                	cmp    %eax,%ebx
+  800fa0:	7f 07                	jg     800fa9 <sysbatch_flush+0x39>
+  return 0;
+  800fa2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fa7:	eb d5                	jmp    800f7e <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  800fa9:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  800fac:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  800fb0:	85 db                	test   %ebx,%ebx
+  800fb2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800fb7:	0f 49 d8             	cmovns %eax,%ebx
+  800fba:	eb c2                	jmp    800f7e <sysbatch_flush+0xe>
+    return r;
+  800fbc:	89 c3                	mov    %eax,%ebx
+  800fbe:	eb be                	jmp    800f7e <sysbatch_flush+0xe>
+
+00800fc0 <sysbatch_add>:
+{
+  800fc0:	55                   	push   %ebp
+  800fc1:	89 e5                	mov    %esp,%ebp
+  800fc3:	53                   	push   %ebx
+  800fc4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  800fc7:	83 3b 40             	cmpl   $0x40,(%ebx)
+  800fca:	74 41                	je     80100d <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  800fcc:	8b 03                	mov    (%ebx),%eax
+  800fce:	8d 50 01             	lea    0x1(%eax),%edx
+  800fd1:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  800fd3:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  800fd6:	01 d8                	add    %ebx,%eax
+  800fd8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800fdb:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  800fde:	8b 55 10             	mov    0x10(%ebp),%edx
+  800fe1:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  800fe4:	8b 55 14             	mov    0x14(%ebp),%edx
+  800fe7:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  800fea:	8b 55 18             	mov    0x18(%ebp),%edx
+  800fed:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  800ff0:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  800ff3:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  800ff6:	8b 55 20             	mov    0x20(%ebp),%edx
+  800ff9:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  800ffc:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  801003:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801008:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80100b:	c9                   	leave
+  80100c:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  80100d:	53                   	push   %ebx
+  80100e:	e8 5d ff ff ff       	call   800f70 <sysbatch_flush>
+  801013:	83 c4 04             	add    $0x4,%esp
+  801016:	85 c0                	test   %eax,%eax
+  801018:	79 b2                	jns    800fcc <sysbatch_add+0xc>
+  80101a:	eb ec                	jmp    801008 <sysbatch_add+0x48>
+
+0080101c <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80101c:	55                   	push   %ebp
+  80101d:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80101f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801022:	05 00 00 00 30       	add    $0x30000000,%eax
+  801027:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80102a:	5d                   	pop    %ebp
+  80102b:	c3                   	ret
+
+0080102c <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80102c:	55                   	push   %ebp
+  80102d:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80102f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801032:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  801035:	66 b8 00 00          	mov    $0x0,%ax
+  801039:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80103e:	5d                   	pop    %ebp
+  80103f:	c3                   	ret
+
+00801040 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801040:	55                   	push   %ebp
+  801041:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  801043:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801048:	eb 02                	jmp    80104c <fd_alloc+0xc>
+  80104a:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80104c:	89 c2                	mov    %eax,%edx
+  80104e:	c1 ea 16             	shr    $0x16,%edx
+  801051:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801058:	f6 c2 01             	test   $0x1,%dl
+  80105b:	74 2b                	je     801088 <fd_alloc+0x48>
+  80105d:	89 c2                	mov    %eax,%edx
+  80105f:	c1 ea 0c             	shr    $0xc,%edx
+  801062:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801069:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80106f:	f6 c1 01             	test   $0x1,%cl
+  801072:	74 14                	je     801088 <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  801074:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  80107a:	75 ce                	jne    80104a <fd_alloc+0xa>
+  80107c:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  801081:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801086:	eb 05                	jmp    80108d <fd_alloc+0x4d>
+      return 0;
+  801088:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  80108d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801090:	89 02                	mov    %eax,(%edx)
+}
+  801092:	89 c8                	mov    %ecx,%eax
+  801094:	5d                   	pop    %ebp
+  801095:	c3                   	ret
+
+00801096 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801096:	55                   	push   %ebp
+  801097:	89 e5                	mov    %esp,%ebp
+  801099:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  80109c:	83 f8 1f             	cmp    $0x1f,%eax
+  80109f:	77 30                	ja     8010d1 <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  8010a1:	c1 e0 0c             	shl    $0xc,%eax
+  8010a4:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8010a9:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8010af:	f6 c2 01             	test   $0x1,%dl
+  8010b2:	74 24                	je     8010d8 <fd_lookup+0x42>
+  8010b4:	89 c2                	mov    %eax,%edx
+  8010b6:	c1 ea 0c             	shr    $0xc,%edx
+  8010b9:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8010c0:	f6 c2 01             	test   $0x1,%dl
+  8010c3:	74 1a                	je     8010df <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  8010c5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8010c8:	89 02                	mov    %eax,(%edx)
+  return 0;
+  8010ca:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8010cf:	5d                   	pop    %ebp
+  8010d0:	c3                   	ret
+    return -E_INVAL;
+  8010d1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8010d6:	eb f7                	jmp    8010cf <fd_lookup+0x39>
+    return -E_INVAL;
+  8010d8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8010dd:	eb f0                	jmp    8010cf <fd_lookup+0x39>
+  8010df:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8010e4:	eb e9                	jmp    8010cf <fd_lookup+0x39>
+
+008010e6 <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8010e6:	55                   	push   %ebp
+  8010e7:	89 e5                	mov    %esp,%ebp
+  8010e9:	53                   	push   %ebx
+  8010ea:	83 ec 04             	sub    $0x4,%esp
+  8010ed:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  8010f0:	b8 4c 32 80 00       	mov    $0x80324c,%eax
+  8010f5:	8b 18                	mov    (%eax),%ebx
+  8010f7:	85 db                	test   %ebx,%ebx
+  8010f9:	74 0e                	je     801109 <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  8010fb:	83 c0 04             	add    $0x4,%eax
+  8010fe:	39 13                	cmp    %edx,(%ebx)
+  801100:	75 f3                	jne    8010f5 <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  801102:	b8 00 00 00 00       	mov    $0x0,%eax
+  801107:	eb 1f                	jmp    801128 <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801109:	a1 44 57 80 00       	mov    0x805744,%eax
+  80110e:	8b 40 48             	mov    0x48(%eax),%eax
+  801111:	83 ec 04             	sub    $0x4,%esp
+  801114:	52                   	push   %edx
+  801115:	50                   	push   %eax
+  801116:	68 d0 31 80 00       	push   $0x8031d0
+  80111b:	e8 30 f0 ff ff       	call   800150 <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  801120:	83 c4 10             	add    $0x10,%esp
+  801123:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  801128:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80112b:	89 1a                	mov    %ebx,(%edx)
+}
+  80112d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801130:	c9                   	leave
+  801131:	c3                   	ret
+
+00801132 <fd_close>:
+{
+  801132:	55                   	push   %ebp
+  801133:	89 e5                	mov    %esp,%ebp
+  801135:	57                   	push   %edi
+  801136:	56                   	push   %esi
+  801137:	53                   	push   %ebx
+  801138:	83 ec 24             	sub    $0x24,%esp
+  80113b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80113e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801141:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801144:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801145:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80114b:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80114e:	50                   	push   %eax
+  80114f:	e8 42 ff ff ff       	call   801096 <fd_lookup>
+  801154:	89 c3                	mov    %eax,%ebx
+  801156:	83 c4 10             	add    $0x10,%esp
+  801159:	85 c0                	test   %eax,%eax
+  80115b:	78 05                	js     801162 <fd_close+0x30>
+      || fd != fd2)
+  80115d:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801160:	74 16                	je     801178 <fd_close+0x46>
+    return must_exist ? r : 0;
+  801162:	89 f8                	mov    %edi,%eax
+  801164:	84 c0                	test   %al,%al
+  801166:	b8 00 00 00 00       	mov    $0x0,%eax
+  80116b:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80116e:	89 d8                	mov    %ebx,%eax
+  801170:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801173:	5b                   	pop    %ebx
+  801174:	5e                   	pop    %esi
+  801175:	5f                   	pop    %edi
+  801176:	5d                   	pop    %ebp
+  801177:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801178:	83 ec 08             	sub    $0x8,%esp
+  80117b:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80117e:	50                   	push   %eax
+  80117f:	ff 36                	push   (%esi)
+  801181:	e8 60 ff ff ff       	call   8010e6 <dev_lookup>
+  801186:	89 c3                	mov    %eax,%ebx
+  801188:	83 c4 10             	add    $0x10,%esp
+  80118b:	85 c0                	test   %eax,%eax
+  80118d:	78 1a                	js     8011a9 <fd_close+0x77>
+    if (dev->dev_close)
+  80118f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801192:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  801195:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  80119a:	85 c0                	test   %eax,%eax
+  80119c:	74 0b                	je     8011a9 <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  80119e:	83 ec 0c             	sub    $0xc,%esp
+  8011a1:	56                   	push   %esi
+  8011a2:	ff d0                	call   *%eax
+  8011a4:	89 c3                	mov    %eax,%ebx
+  8011a6:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  8011a9:	83 ec 08             	sub    $0x8,%esp
+  8011ac:	56                   	push   %esi
+  8011ad:	6a 00                	push   $0x0
+  8011af:	e8 3e fa ff ff       	call   800bf2 <sys_page_unmap>
+  return r;
+  8011b4:	83 c4 10             	add    $0x10,%esp
+  8011b7:	eb b5                	jmp    80116e <fd_close+0x3c>
+
+008011b9 <close>:
+
+int
+close(int fdnum)
+{
+  8011b9:	55                   	push   %ebp
+  8011ba:	89 e5                	mov    %esp,%ebp
+  8011bc:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8011bf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8011c2:	50                   	push   %eax
+  8011c3:	ff 75 08             	push   0x8(%ebp)
+  8011c6:	e8 cb fe ff ff       	call   801096 <fd_lookup>
+  8011cb:	83 c4 10             	add    $0x10,%esp
+  8011ce:	85 c0                	test   %eax,%eax
+  8011d0:	79 02                	jns    8011d4 <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  8011d2:	c9                   	leave
+  8011d3:	c3                   	ret
+    return fd_close(fd, 1);
+  8011d4:	83 ec 08             	sub    $0x8,%esp
+  8011d7:	6a 01                	push   $0x1
+  8011d9:	ff 75 f4             	push   -0xc(%ebp)
+  8011dc:	e8 51 ff ff ff       	call   801132 <fd_close>
+  8011e1:	83 c4 10             	add    $0x10,%esp
+  8011e4:	eb ec                	jmp    8011d2 <close+0x19>
+
+008011e6 <close_all>:
+
+void
+close_all(void)
+{
+  8011e6:	55                   	push   %ebp
+  8011e7:	89 e5                	mov    %esp,%ebp
+  8011e9:	53                   	push   %ebx
+  8011ea:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  8011ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  8011f2:	83 ec 0c             	sub    $0xc,%esp
+  8011f5:	53                   	push   %ebx
+  8011f6:	e8 be ff ff ff       	call   8011b9 <close>
+  for (i = 0; i < MAXFD; i++)
+  8011fb:	83 c3 01             	add    $0x1,%ebx
+  8011fe:	83 c4 10             	add    $0x10,%esp
+  801201:	83 fb 20             	cmp    $0x20,%ebx
+  801204:	75 ec                	jne    8011f2 <close_all+0xc>
+}
+  801206:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801209:	c9                   	leave
+  80120a:	c3                   	ret
+
+0080120b <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80120b:	55                   	push   %ebp
+  80120c:	89 e5                	mov    %esp,%ebp
+  80120e:	57                   	push   %edi
+  80120f:	56                   	push   %esi
+  801210:	53                   	push   %ebx
+  801211:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801214:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801217:	50                   	push   %eax
+  801218:	ff 75 08             	push   0x8(%ebp)
+  80121b:	e8 76 fe ff ff       	call   801096 <fd_lookup>
+  801220:	89 c6                	mov    %eax,%esi
+  801222:	83 c4 10             	add    $0x10,%esp
+  801225:	85 c0                	test   %eax,%eax
+  801227:	0f 88 0a 01 00 00    	js     801337 <dup+0x12c>
+    return r;
+  close(newfdnum);
+  80122d:	83 ec 0c             	sub    $0xc,%esp
+  801230:	ff 75 0c             	push   0xc(%ebp)
+  801233:	e8 81 ff ff ff       	call   8011b9 <close>
+
+  newfd = INDEX2FD(newfdnum);
+  801238:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80123b:	c1 e0 0c             	shl    $0xc,%eax
+  80123e:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  801244:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  801247:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80124a:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  80124d:	89 04 24             	mov    %eax,(%esp)
+  801250:	e8 d7 fd ff ff       	call   80102c <fd2data>
+  801255:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  801257:	89 3c 24             	mov    %edi,(%esp)
+  80125a:	e8 cd fd ff ff       	call   80102c <fd2data>
+  80125f:	83 c4 10             	add    $0x10,%esp
+  801262:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801265:	89 f3                	mov    %esi,%ebx
+  801267:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  80126d:	89 c6                	mov    %eax,%esi
+  80126f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801272:	89 cf                	mov    %ecx,%edi
+  801274:	eb 0c                	jmp    801282 <dup+0x77>
+  801276:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80127c:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801282:	39 fb                	cmp    %edi,%ebx
+  801284:	74 7b                	je     801301 <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  801286:	89 d8                	mov    %ebx,%eax
+  801288:	c1 e8 16             	shr    $0x16,%eax
+  80128b:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801292:	a8 01                	test   $0x1,%al
+  801294:	74 e0                	je     801276 <dup+0x6b>
+  801296:	89 d8                	mov    %ebx,%eax
+  801298:	c1 e8 0c             	shr    $0xc,%eax
+  80129b:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8012a2:	f6 c2 01             	test   $0x1,%dl
+  8012a5:	74 cf                	je     801276 <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  8012a7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  8012ae:	83 ec 0c             	sub    $0xc,%esp
+  8012b1:	25 07 0e 00 00       	and    $0xe07,%eax
+  8012b6:	50                   	push   %eax
+  8012b7:	56                   	push   %esi
+  8012b8:	6a 00                	push   $0x0
+  8012ba:	53                   	push   %ebx
+  8012bb:	6a 00                	push   $0x0
+  8012bd:	e8 ee f8 ff ff       	call   800bb0 <sys_page_map>
+  8012c2:	83 c4 20             	add    $0x20,%esp
+  8012c5:	85 c0                	test   %eax,%eax
+  8012c7:	79 ad                	jns    801276 <dup+0x6b>
+  8012c9:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8012cc:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  8012ce:	83 ec 08             	sub    $0x8,%esp
+  8012d1:	ff 75 d4             	push   -0x2c(%ebp)
+  8012d4:	6a 00                	push   $0x0
+  8012d6:	e8 17 f9 ff ff       	call   800bf2 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8012db:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  8012de:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  8012e4:	83 c4 10             	add    $0x10,%esp
+  8012e7:	39 df                	cmp    %ebx,%edi
+  8012e9:	74 4c                	je     801337 <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  8012eb:	83 ec 08             	sub    $0x8,%esp
+  8012ee:	57                   	push   %edi
+  8012ef:	6a 00                	push   $0x0
+  8012f1:	e8 fc f8 ff ff       	call   800bf2 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8012f6:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  8012fc:	83 c4 10             	add    $0x10,%esp
+  8012ff:	eb e6                	jmp    8012e7 <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801301:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801304:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  801307:	89 c8                	mov    %ecx,%eax
+  801309:	c1 e8 0c             	shr    $0xc,%eax
+  80130c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801313:	83 ec 0c             	sub    $0xc,%esp
+  801316:	25 07 0e 00 00       	and    $0xe07,%eax
+  80131b:	50                   	push   %eax
+  80131c:	ff 75 d4             	push   -0x2c(%ebp)
+  80131f:	6a 00                	push   $0x0
+  801321:	51                   	push   %ecx
+  801322:	6a 00                	push   $0x0
+  801324:	e8 87 f8 ff ff       	call   800bb0 <sys_page_map>
+  801329:	89 c6                	mov    %eax,%esi
+  80132b:	83 c4 20             	add    $0x20,%esp
+  80132e:	85 c0                	test   %eax,%eax
+  801330:	78 9c                	js     8012ce <dup+0xc3>
+  return newfdnum;
+  801332:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801335:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  801337:	89 f0                	mov    %esi,%eax
+  801339:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80133c:	5b                   	pop    %ebx
+  80133d:	5e                   	pop    %esi
+  80133e:	5f                   	pop    %edi
+  80133f:	5d                   	pop    %ebp
+  801340:	c3                   	ret
+
+00801341 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801341:	55                   	push   %ebp
+  801342:	89 e5                	mov    %esp,%ebp
+  801344:	56                   	push   %esi
+  801345:	53                   	push   %ebx
+  801346:	83 ec 18             	sub    $0x18,%esp
+  801349:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  80134c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80134f:	50                   	push   %eax
+  801350:	56                   	push   %esi
+  801351:	e8 40 fd ff ff       	call   801096 <fd_lookup>
+  801356:	83 c4 10             	add    $0x10,%esp
+  801359:	85 c0                	test   %eax,%eax
+  80135b:	78 3c                	js     801399 <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80135d:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801360:	83 ec 08             	sub    $0x8,%esp
+  801363:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801366:	50                   	push   %eax
+  801367:	ff 33                	push   (%ebx)
+  801369:	e8 78 fd ff ff       	call   8010e6 <dev_lookup>
+  80136e:	83 c4 10             	add    $0x10,%esp
+  801371:	85 c0                	test   %eax,%eax
+  801373:	78 24                	js     801399 <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801375:	8b 43 08             	mov    0x8(%ebx),%eax
+  801378:	83 e0 03             	and    $0x3,%eax
+  80137b:	83 f8 01             	cmp    $0x1,%eax
+  80137e:	74 20                	je     8013a0 <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  801380:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801383:	8b 40 08             	mov    0x8(%eax),%eax
+  801386:	85 c0                	test   %eax,%eax
+  801388:	74 37                	je     8013c1 <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  80138a:	83 ec 04             	sub    $0x4,%esp
+  80138d:	ff 75 10             	push   0x10(%ebp)
+  801390:	ff 75 0c             	push   0xc(%ebp)
+  801393:	53                   	push   %ebx
+  801394:	ff d0                	call   *%eax
+  801396:	83 c4 10             	add    $0x10,%esp
+}
+  801399:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80139c:	5b                   	pop    %ebx
+  80139d:	5e                   	pop    %esi
+  80139e:	5d                   	pop    %ebp
+  80139f:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8013a0:	a1 44 57 80 00       	mov    0x805744,%eax
+  8013a5:	8b 40 48             	mov    0x48(%eax),%eax
+  8013a8:	83 ec 04             	sub    $0x4,%esp
+  8013ab:	56                   	push   %esi
+  8013ac:	50                   	push   %eax
+  8013ad:	68 11 32 80 00       	push   $0x803211
+  8013b2:	e8 99 ed ff ff       	call   800150 <cprintf>
+    return -E_INVAL;
+  8013b7:	83 c4 10             	add    $0x10,%esp
+  8013ba:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013bf:	eb d8                	jmp    801399 <read+0x58>
+    return -E_NOT_SUPP;
+  8013c1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8013c6:	eb d1                	jmp    801399 <read+0x58>
+
+008013c8 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8013c8:	55                   	push   %ebp
+  8013c9:	89 e5                	mov    %esp,%ebp
+  8013cb:	57                   	push   %edi
+  8013cc:	56                   	push   %esi
+  8013cd:	53                   	push   %ebx
+  8013ce:	83 ec 0c             	sub    $0xc,%esp
+  8013d1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8013d4:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  8013d7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013dc:	eb 02                	jmp    8013e0 <readn+0x18>
+  8013de:	01 c3                	add    %eax,%ebx
+  8013e0:	39 f3                	cmp    %esi,%ebx
+  8013e2:	73 21                	jae    801405 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  8013e4:	83 ec 04             	sub    $0x4,%esp
+  8013e7:	89 f0                	mov    %esi,%eax
+  8013e9:	29 d8                	sub    %ebx,%eax
+  8013eb:	50                   	push   %eax
+  8013ec:	89 d8                	mov    %ebx,%eax
+  8013ee:	03 45 0c             	add    0xc(%ebp),%eax
+  8013f1:	50                   	push   %eax
+  8013f2:	57                   	push   %edi
+  8013f3:	e8 49 ff ff ff       	call   801341 <read>
+    if (m < 0)
+  8013f8:	83 c4 10             	add    $0x10,%esp
+  8013fb:	85 c0                	test   %eax,%eax
+  8013fd:	78 04                	js     801403 <readn+0x3b>
+      return m;
+    if (m == 0)
+  8013ff:	75 dd                	jne    8013de <readn+0x16>
+  801401:	eb 02                	jmp    801405 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  801403:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  801405:	89 d8                	mov    %ebx,%eax
+  801407:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80140a:	5b                   	pop    %ebx
+  80140b:	5e                   	pop    %esi
+  80140c:	5f                   	pop    %edi
+  80140d:	5d                   	pop    %ebp
+  80140e:	c3                   	ret
+
+0080140f <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80140f:	55                   	push   %ebp
+  801410:	89 e5                	mov    %esp,%ebp
+  801412:	56                   	push   %esi
+  801413:	53                   	push   %ebx
+  801414:	83 ec 18             	sub    $0x18,%esp
+  801417:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  80141a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80141d:	50                   	push   %eax
+  80141e:	53                   	push   %ebx
+  80141f:	e8 72 fc ff ff       	call   801096 <fd_lookup>
+  801424:	83 c4 10             	add    $0x10,%esp
+  801427:	85 c0                	test   %eax,%eax
+  801429:	78 37                	js     801462 <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80142b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80142e:	83 ec 08             	sub    $0x8,%esp
+  801431:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801434:	50                   	push   %eax
+  801435:	ff 36                	push   (%esi)
+  801437:	e8 aa fc ff ff       	call   8010e6 <dev_lookup>
+  80143c:	83 c4 10             	add    $0x10,%esp
+  80143f:	85 c0                	test   %eax,%eax
+  801441:	78 1f                	js     801462 <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801443:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801447:	74 20                	je     801469 <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  801449:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80144c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80144f:	85 c0                	test   %eax,%eax
+  801451:	74 37                	je     80148a <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  801453:	83 ec 04             	sub    $0x4,%esp
+  801456:	ff 75 10             	push   0x10(%ebp)
+  801459:	ff 75 0c             	push   0xc(%ebp)
+  80145c:	56                   	push   %esi
+  80145d:	ff d0                	call   *%eax
+  80145f:	83 c4 10             	add    $0x10,%esp
+}
+  801462:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801465:	5b                   	pop    %ebx
+  801466:	5e                   	pop    %esi
+  801467:	5d                   	pop    %ebp
+  801468:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801469:	a1 44 57 80 00       	mov    0x805744,%eax
+  80146e:	8b 40 48             	mov    0x48(%eax),%eax
+  801471:	83 ec 04             	sub    $0x4,%esp
+  801474:	53                   	push   %ebx
+  801475:	50                   	push   %eax
+  801476:	68 2d 32 80 00       	push   $0x80322d
+  80147b:	e8 d0 ec ff ff       	call   800150 <cprintf>
+    return -E_INVAL;
+  801480:	83 c4 10             	add    $0x10,%esp
+  801483:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801488:	eb d8                	jmp    801462 <write+0x53>
+    return -E_NOT_SUPP;
+  80148a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80148f:	eb d1                	jmp    801462 <write+0x53>
+
+00801491 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801491:	55                   	push   %ebp
+  801492:	89 e5                	mov    %esp,%ebp
+  801494:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801497:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80149a:	50                   	push   %eax
+  80149b:	ff 75 08             	push   0x8(%ebp)
+  80149e:	e8 f3 fb ff ff       	call   801096 <fd_lookup>
+  8014a3:	83 c4 10             	add    $0x10,%esp
+  8014a6:	85 c0                	test   %eax,%eax
+  8014a8:	78 0e                	js     8014b8 <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  8014aa:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8014ad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014b0:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  8014b3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8014b8:	c9                   	leave
+  8014b9:	c3                   	ret
+
+008014ba <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8014ba:	55                   	push   %ebp
+  8014bb:	89 e5                	mov    %esp,%ebp
+  8014bd:	56                   	push   %esi
+  8014be:	53                   	push   %ebx
+  8014bf:	83 ec 18             	sub    $0x18,%esp
+  8014c2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  8014c5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8014c8:	50                   	push   %eax
+  8014c9:	53                   	push   %ebx
+  8014ca:	e8 c7 fb ff ff       	call   801096 <fd_lookup>
+  8014cf:	83 c4 10             	add    $0x10,%esp
+  8014d2:	85 c0                	test   %eax,%eax
+  8014d4:	78 34                	js     80150a <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8014d6:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8014d9:	83 ec 08             	sub    $0x8,%esp
+  8014dc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014df:	50                   	push   %eax
+  8014e0:	ff 36                	push   (%esi)
+  8014e2:	e8 ff fb ff ff       	call   8010e6 <dev_lookup>
+  8014e7:	83 c4 10             	add    $0x10,%esp
+  8014ea:	85 c0                	test   %eax,%eax
+  8014ec:	78 1c                	js     80150a <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8014ee:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8014f2:	74 1d                	je     801511 <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  8014f4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014f7:	8b 40 18             	mov    0x18(%eax),%eax
+  8014fa:	85 c0                	test   %eax,%eax
+  8014fc:	74 34                	je     801532 <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  8014fe:	83 ec 08             	sub    $0x8,%esp
+  801501:	ff 75 0c             	push   0xc(%ebp)
+  801504:	56                   	push   %esi
+  801505:	ff d0                	call   *%eax
+  801507:	83 c4 10             	add    $0x10,%esp
+}
+  80150a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80150d:	5b                   	pop    %ebx
+  80150e:	5e                   	pop    %esi
+  80150f:	5d                   	pop    %ebp
+  801510:	c3                   	ret
+            thisenv->env_id, fdnum);
+  801511:	a1 44 57 80 00       	mov    0x805744,%eax
+  801516:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801519:	83 ec 04             	sub    $0x4,%esp
+  80151c:	53                   	push   %ebx
+  80151d:	50                   	push   %eax
+  80151e:	68 f0 31 80 00       	push   $0x8031f0
+  801523:	e8 28 ec ff ff       	call   800150 <cprintf>
+    return -E_INVAL;
+  801528:	83 c4 10             	add    $0x10,%esp
+  80152b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801530:	eb d8                	jmp    80150a <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  801532:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801537:	eb d1                	jmp    80150a <ftruncate+0x50>
+
+00801539 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801539:	55                   	push   %ebp
+  80153a:	89 e5                	mov    %esp,%ebp
+  80153c:	56                   	push   %esi
+  80153d:	53                   	push   %ebx
+  80153e:	83 ec 18             	sub    $0x18,%esp
+  801541:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801544:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801547:	50                   	push   %eax
+  801548:	ff 75 08             	push   0x8(%ebp)
+  80154b:	e8 46 fb ff ff       	call   801096 <fd_lookup>
+  801550:	83 c4 10             	add    $0x10,%esp
+  801553:	85 c0                	test   %eax,%eax
+  801555:	78 49                	js     8015a0 <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801557:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80155a:	83 ec 08             	sub    $0x8,%esp
+  80155d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801560:	50                   	push   %eax
+  801561:	ff 36                	push   (%esi)
+  801563:	e8 7e fb ff ff       	call   8010e6 <dev_lookup>
+  801568:	83 c4 10             	add    $0x10,%esp
+  80156b:	85 c0                	test   %eax,%eax
+  80156d:	78 31                	js     8015a0 <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  80156f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801572:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801576:	74 2f                	je     8015a7 <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  801578:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  80157b:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801582:	00 00 00 
+  stat->st_isdir = 0;
+  801585:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80158c:	00 00 00 
+  stat->st_dev = dev;
+  80158f:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  801595:	83 ec 08             	sub    $0x8,%esp
+  801598:	53                   	push   %ebx
+  801599:	56                   	push   %esi
+  80159a:	ff 50 14             	call   *0x14(%eax)
+  80159d:	83 c4 10             	add    $0x10,%esp
+}
+  8015a0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015a3:	5b                   	pop    %ebx
+  8015a4:	5e                   	pop    %esi
+  8015a5:	5d                   	pop    %ebp
+  8015a6:	c3                   	ret
+    return -E_NOT_SUPP;
+  8015a7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015ac:	eb f2                	jmp    8015a0 <fstat+0x67>
+
+008015ae <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  8015ae:	55                   	push   %ebp
+  8015af:	89 e5                	mov    %esp,%ebp
+  8015b1:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  8015b4:	ff 75 0c             	push   0xc(%ebp)
+  8015b7:	ff 75 08             	push   0x8(%ebp)
+  8015ba:	e8 58 07 00 00       	call   801d17 <file_stat>
+}
+  8015bf:	c9                   	leave
+  8015c0:	c3                   	ret
+
+008015c1 <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  8015c1:	55                   	push   %ebp
+  8015c2:	89 e5                	mov    %esp,%ebp
+  8015c4:	57                   	push   %edi
+  8015c5:	56                   	push   %esi
+  8015c6:	53                   	push   %ebx
+  8015c7:	83 ec 1c             	sub    $0x1c,%esp
+  8015ca:	89 c7                	mov    %eax,%edi
+  8015cc:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8015cf:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8015d2:	e9 a2 00 00 00       	jmp    801679 <fsipc_send+0xb8>
+  nfsenvs = 0;
+  8015d7:	c7 05 00 50 80 00 00 	movl   $0x0,0x805000
+  8015de:	00 00 00 
+  8015e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  8015eb:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  8015f0:	be 01 00 00 00       	mov    $0x1,%esi
+  8015f5:	eb 0f                	jmp    801606 <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  8015f7:	83 c0 01             	add    $0x1,%eax
+  8015fa:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8015ff:	74 49                	je     80164a <fsipc_send+0x89>
+  801601:	83 f9 07             	cmp    $0x7,%ecx
+  801604:	7f 50                	jg     801656 <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  801606:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801609:	c1 e2 04             	shl    $0x4,%edx
+  80160c:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801612:	8b 52 50             	mov    0x50(%edx),%edx
+  801615:	83 fa 01             	cmp    $0x1,%edx
+  801618:	75 dd                	jne    8015f7 <fsipc_send+0x36>
+  80161a:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  80161d:	c1 e2 04             	shl    $0x4,%edx
+  801620:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801626:	8b 52 54             	mov    0x54(%edx),%edx
+  801629:	85 d2                	test   %edx,%edx
+  80162b:	74 ca                	je     8015f7 <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  80162d:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801630:	c1 e2 04             	shl    $0x4,%edx
+  801633:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801639:	8b 52 48             	mov    0x48(%edx),%edx
+  80163c:	89 14 8d 20 50 80 00 	mov    %edx,0x805020(,%ecx,4)
+  801643:	8d 49 01             	lea    0x1(%ecx),%ecx
+  801646:	89 f3                	mov    %esi,%ebx
+  801648:	eb ad                	jmp    8015f7 <fsipc_send+0x36>
+  80164a:	84 db                	test   %bl,%bl
+  80164c:	74 38                	je     801686 <fsipc_send+0xc5>
+  80164e:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  801654:	eb 30                	jmp    801686 <fsipc_send+0xc5>
+  801656:	84 db                	test   %bl,%bl
+  801658:	74 2c                	je     801686 <fsipc_send+0xc5>
+  80165a:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  801660:	eb 24                	jmp    801686 <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  801662:	50                   	push   %eax
+  801663:	68 5c 32 80 00       	push   $0x80325c
+  801668:	6a 34                	push   $0x34
+  80166a:	68 66 32 80 00       	push   $0x803266
+  80166f:	e8 b9 13 00 00       	call   802a2d <_panic>
+    }
+    sys_yield();
+  801674:	e8 92 f4 ff ff       	call   800b0b <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  801679:	83 3d 00 50 80 00 03 	cmpl   $0x3,0x805000
+  801680:	0f 8e 51 ff ff ff    	jle    8015d7 <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  801686:	a1 44 57 80 00       	mov    0x805744,%eax
+  80168b:	8b 70 48             	mov    0x48(%eax),%esi
+  80168e:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  801694:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801699:	8b 0d 00 50 80 00    	mov    0x805000,%ecx
+  80169f:	39 d9                	cmp    %ebx,%ecx
+  8016a1:	7e d1                	jle    801674 <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  8016a3:	83 ec 0c             	sub    $0xc,%esp
+  8016a6:	ff 75 e0             	push   -0x20(%ebp)
+  8016a9:	6a 07                	push   $0x7
+  8016ab:	ff 75 e4             	push   -0x1c(%ebp)
+  8016ae:	57                   	push   %edi
+  8016af:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  8016b2:	99                   	cltd
+  8016b3:	f7 f9                	idiv   %ecx
+  8016b5:	ff 34 95 20 50 80 00 	push   0x805020(,%edx,4)
+  8016bc:	e8 63 f7 ff ff       	call   800e24 <sys_ipc_try_send>
+      if (r == 0)
+  8016c1:	83 c4 20             	add    $0x20,%esp
+  8016c4:	85 c0                	test   %eax,%eax
+  8016c6:	74 0a                	je     8016d2 <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  8016c8:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8016cb:	75 95                	jne    801662 <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  8016cd:	83 c3 01             	add    $0x1,%ebx
+  8016d0:	eb c7                	jmp    801699 <fsipc_send+0xd8>
+  }
+}
+  8016d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016d5:	5b                   	pop    %ebx
+  8016d6:	5e                   	pop    %esi
+  8016d7:	5f                   	pop    %edi
+  8016d8:	5d                   	pop    %ebp
+  8016d9:	c3                   	ret
+
+008016da <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8016da:	55                   	push   %ebp
+  8016db:	89 e5                	mov    %esp,%ebp
+  8016dd:	53                   	push   %ebx
+  8016de:	83 ec 14             	sub    $0x14,%esp
+  8016e1:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  8016e3:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  8016ea:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8016ef:	ba 00 60 80 00       	mov    $0x806000,%edx
+  8016f4:	e8 c8 fe ff ff       	call   8015c1 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  8016f9:	6a 00                	push   $0x0
+  8016fb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016fe:	50                   	push   %eax
+  8016ff:	53                   	push   %ebx
+  801700:	6a 00                	push   $0x0
+  801702:	e8 6c 13 00 00       	call   802a73 <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  801707:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80170a:	c9                   	leave
+  80170b:	c3                   	ret
+
+0080170c <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  80170c:	55                   	push   %ebp
+  80170d:	89 e5                	mov    %esp,%ebp
+  80170f:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801712:	8b 45 08             	mov    0x8(%ebp),%eax
+  801715:	8b 40 0c             	mov    0xc(%eax),%eax
+  801718:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.set_size.req_size = newsize;
+  80171d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801720:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801725:	ba 00 00 00 00       	mov    $0x0,%edx
+  80172a:	b8 02 00 00 00       	mov    $0x2,%eax
+  80172f:	e8 a6 ff ff ff       	call   8016da <fsipc>
+}
+  801734:	c9                   	leave
+  801735:	c3                   	ret
+
+00801736 <devfile_flush>:
+{
+  801736:	55                   	push   %ebp
+  801737:	89 e5                	mov    %esp,%ebp
+  801739:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80173c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80173f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801742:	a3 00 60 80 00       	mov    %eax,0x806000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801747:	ba 00 00 00 00       	mov    $0x0,%edx
+  80174c:	b8 06 00 00 00       	mov    $0x6,%eax
+  801751:	e8 84 ff ff ff       	call   8016da <fsipc>
+}
+  801756:	c9                   	leave
+  801757:	c3                   	ret
+
+00801758 <devfile_stat>:
+{
+  801758:	55                   	push   %ebp
+  801759:	89 e5                	mov    %esp,%ebp
+  80175b:	53                   	push   %ebx
+  80175c:	83 ec 04             	sub    $0x4,%esp
+  80175f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801762:	8b 45 08             	mov    0x8(%ebp),%eax
+  801765:	8b 40 0c             	mov    0xc(%eax),%eax
+  801768:	a3 00 60 80 00       	mov    %eax,0x806000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80176d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801772:	b8 05 00 00 00       	mov    $0x5,%eax
+  801777:	e8 5e ff ff ff       	call   8016da <fsipc>
+  80177c:	85 c0                	test   %eax,%eax
+  80177e:	78 2c                	js     8017ac <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801780:	83 ec 08             	sub    $0x8,%esp
+  801783:	68 00 60 80 00       	push   $0x806000
+  801788:	53                   	push   %ebx
+  801789:	e8 b0 ef ff ff       	call   80073e <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  80178e:	a1 80 60 80 00       	mov    0x806080,%eax
+  801793:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801799:	a1 84 60 80 00       	mov    0x806084,%eax
+  80179e:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  8017a4:	83 c4 10             	add    $0x10,%esp
+  8017a7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017ac:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017af:	c9                   	leave
+  8017b0:	c3                   	ret
+
+008017b1 <fsv_alloc>:
+{
+  8017b1:	55                   	push   %ebp
+  8017b2:	89 e5                	mov    %esp,%ebp
+  8017b4:	56                   	push   %esi
+  8017b5:	53                   	push   %ebx
+  8017b6:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  8017b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017bd:	eb 22                	jmp    8017e1 <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  8017bf:	83 ec 04             	sub    $0x4,%esp
+  8017c2:	6a 00                	push   $0x0
+  8017c4:	6a 00                	push   $0x0
+  8017c6:	6a 07                	push   $0x7
+  8017c8:	50                   	push   %eax
+  8017c9:	6a 00                	push   $0x0
+  8017cb:	6a 04                	push   $0x4
+  8017cd:	68 40 50 80 00       	push   $0x805040
+  8017d2:	e8 e9 f7 ff ff       	call   800fc0 <sysbatch_add>
+  8017d7:	83 c4 20             	add    $0x20,%esp
+  8017da:	85 c0                	test   %eax,%eax
+  8017dc:	78 48                	js     801826 <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  8017de:	83 c3 01             	add    $0x1,%ebx
+  8017e1:	39 f3                	cmp    %esi,%ebx
+  8017e3:	74 31                	je     801816 <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  8017e5:	89 d8                	mov    %ebx,%eax
+  8017e7:	c1 e0 0c             	shl    $0xc,%eax
+  8017ea:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  8017ef:	89 c2                	mov    %eax,%edx
+  8017f1:	c1 ea 16             	shr    $0x16,%edx
+  8017f4:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8017fb:	f6 c2 01             	test   $0x1,%dl
+  8017fe:	74 bf                	je     8017bf <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  801800:	89 c2                	mov    %eax,%edx
+  801802:	c1 ea 0c             	shr    $0xc,%edx
+  801805:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80180c:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  80180f:	83 fa 03             	cmp    $0x3,%edx
+  801812:	75 ab                	jne    8017bf <fsv_alloc+0xe>
+  801814:	eb c8                	jmp    8017de <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  801816:	83 ec 0c             	sub    $0xc,%esp
+  801819:	68 40 50 80 00       	push   $0x805040
+  80181e:	e8 4d f7 ff ff       	call   800f70 <sysbatch_flush>
+  801823:	83 c4 10             	add    $0x10,%esp
+}
+  801826:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801829:	5b                   	pop    %ebx
+  80182a:	5e                   	pop    %esi
+  80182b:	5d                   	pop    %ebp
+  80182c:	c3                   	ret
+
+0080182d <devfile_read>:
+{
+  80182d:	55                   	push   %ebp
+  80182e:	89 e5                	mov    %esp,%ebp
+  801830:	57                   	push   %edi
+  801831:	56                   	push   %esi
+  801832:	53                   	push   %ebx
+  801833:	83 ec 3c             	sub    $0x3c,%esp
+  801836:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  801839:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  80183f:	77 57                	ja     801898 <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801841:	8b 45 08             	mov    0x8(%ebp),%eax
+  801844:	8b 40 0c             	mov    0xc(%eax),%eax
+  801847:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read.req_n = n;
+  80184c:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801852:	ba 00 00 00 00       	mov    $0x0,%edx
+  801857:	b8 03 00 00 00       	mov    $0x3,%eax
+  80185c:	e8 79 fe ff ff       	call   8016da <fsipc>
+  801861:	89 c6                	mov    %eax,%esi
+  801863:	85 c0                	test   %eax,%eax
+  801865:	78 27                	js     80188e <devfile_read+0x61>
+  assert(r <= n);
+  801867:	39 c3                	cmp    %eax,%ebx
+  801869:	0f 82 0e 02 00 00    	jb     801a7d <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  80186f:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801874:	0f 8f 1c 02 00 00    	jg     801a96 <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  80187a:	83 ec 04             	sub    $0x4,%esp
+  80187d:	50                   	push   %eax
+  80187e:	68 00 60 80 00       	push   $0x806000
+  801883:	ff 75 0c             	push   0xc(%ebp)
+  801886:	e8 39 f0 ff ff       	call   8008c4 <memmove>
+  return r;
+  80188b:	83 c4 10             	add    $0x10,%esp
+}
+  80188e:	89 f0                	mov    %esi,%eax
+  801890:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801893:	5b                   	pop    %ebx
+  801894:	5e                   	pop    %esi
+  801895:	5f                   	pop    %edi
+  801896:	5d                   	pop    %ebp
+  801897:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  801898:	b8 01 00 00 00       	mov    $0x1,%eax
+  80189d:	e8 0f ff ff ff       	call   8017b1 <fsv_alloc>
+  8018a2:	89 c6                	mov    %eax,%esi
+  8018a4:	85 c0                	test   %eax,%eax
+  8018a6:	78 e6                	js     80188e <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  8018a8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018ab:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018ae:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  8018b3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018b6:	8b 40 04             	mov    0x4(%eax),%eax
+  8018b9:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  8018be:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  8018c4:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  8018cb:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8018d0:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  8018d5:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8018da:	e8 e2 fc ff ff       	call   8015c1 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  8018df:	6a 00                	push   $0x0
+  8018e1:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8018e4:	50                   	push   %eax
+  8018e5:	68 00 10 c0 9f       	push   $0x9fc01000
+  8018ea:	6a 00                	push   $0x0
+  8018ec:	e8 82 11 00 00       	call   802a73 <ipc_recv_pages>
+  8018f1:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  8018f3:	83 c4 10             	add    $0x10,%esp
+  8018f6:	85 c0                	test   %eax,%eax
+  8018f8:	7e 94                	jle    80188e <devfile_read+0x61>
+  assert(r <= n);
+  8018fa:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8018fd:	39 c3                	cmp    %eax,%ebx
+  8018ff:	72 2e                	jb     80192f <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801901:	8b 45 08             	mov    0x8(%ebp),%eax
+  801904:	8b 40 04             	mov    0x4(%eax),%eax
+  801907:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80190c:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  80190f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801912:	c1 e2 0c             	shl    $0xc,%edx
+  801915:	39 ca                	cmp    %ecx,%edx
+  801917:	72 2f                	jb     801948 <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  801919:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  80191e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  801921:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  801925:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  80192a:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  80192d:	eb 52                	jmp    801981 <devfile_read+0x154>
+  assert(r <= n);
+  80192f:	68 71 32 80 00       	push   $0x803271
+  801934:	68 78 32 80 00       	push   $0x803278
+  801939:	68 49 01 00 00       	push   $0x149
+  80193e:	68 66 32 80 00       	push   $0x803266
+  801943:	e8 e5 10 00 00       	call   802a2d <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801948:	68 9c 32 80 00       	push   $0x80329c
+  80194d:	68 78 32 80 00       	push   $0x803278
+  801952:	68 4a 01 00 00       	push   $0x14a
+  801957:	68 66 32 80 00       	push   $0x803266
+  80195c:	e8 cc 10 00 00       	call   802a2d <_panic>
+      memmove(dst + done, src + done, m);
+  801961:	83 ec 04             	sub    $0x4,%esp
+  801964:	53                   	push   %ebx
+  801965:	56                   	push   %esi
+  801966:	89 f8                	mov    %edi,%eax
+  801968:	03 45 0c             	add    0xc(%ebp),%eax
+  80196b:	50                   	push   %eax
+  80196c:	e8 53 ef ff ff       	call   8008c4 <memmove>
+  801971:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  801974:	01 df                	add    %ebx,%edi
+  801976:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801979:	39 c7                	cmp    %eax,%edi
+  80197b:	0f 83 c0 00 00 00    	jae    801a41 <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801981:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801984:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  801987:	89 f0                	mov    %esi,%eax
+  801989:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80198e:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  801993:	29 c3                	sub    %eax,%ebx
+  801995:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801998:	29 f8                	sub    %edi,%eax
+  80199a:	39 c3                	cmp    %eax,%ebx
+  80199c:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  80199f:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  8019a5:	75 ba                	jne    801961 <devfile_read+0x134>
+  8019a7:	89 f9                	mov    %edi,%ecx
+  8019a9:	03 4d 0c             	add    0xc(%ebp),%ecx
+  8019ac:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  8019af:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  8019b5:	75 aa                	jne    801961 <devfile_read+0x134>
+  8019b7:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  8019bd:	77 a2                	ja     801961 <devfile_read+0x134>
+  8019bf:	89 c8                	mov    %ecx,%eax
+  8019c1:	c1 e8 16             	shr    $0x16,%eax
+  8019c4:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8019cb:	a8 01                	test   $0x1,%al
+  8019cd:	74 92                	je     801961 <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  8019cf:	89 c8                	mov    %ecx,%eax
+  8019d1:	c1 e8 0c             	shr    $0xc,%eax
+  8019d4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  8019db:	a8 01                	test   $0x1,%al
+  8019dd:	74 82                	je     801961 <devfile_read+0x134>
+  8019df:	a9 02 08 00 00       	test   $0x802,%eax
+  8019e4:	0f 84 77 ff ff ff    	je     801961 <devfile_read+0x134>
+  8019ea:	f6 c4 04             	test   $0x4,%ah
+  8019ed:	0f 85 6e ff ff ff    	jne    801961 <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  8019f3:	a1 44 57 80 00       	mov    0x805744,%eax
+  8019f8:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  8019fc:	84 c0                	test   %al,%al
+  8019fe:	75 17                	jne    801a17 <devfile_read+0x1ea>
+  801a00:	83 ec 08             	sub    $0x8,%esp
+  801a03:	6a 01                	push   $0x1
+  801a05:	6a 00                	push   $0x0
+  801a07:	e8 1e f1 ff ff       	call   800b2a <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  801a0c:	83 c4 10             	add    $0x10,%esp
+  801a0f:	85 c0                	test   %eax,%eax
+  801a11:	0f 85 4a ff ff ff    	jne    801961 <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  801a17:	83 ec 04             	sub    $0x4,%esp
+  801a1a:	68 05 08 00 00       	push   $0x805
+  801a1f:	ff 75 cc             	push   -0x34(%ebp)
+  801a22:	6a 00                	push   $0x0
+  801a24:	56                   	push   %esi
+  801a25:	6a 00                	push   $0x0
+  801a27:	6a 05                	push   $0x5
+  801a29:	68 40 50 80 00       	push   $0x805040
+  801a2e:	e8 8d f5 ff ff       	call   800fc0 <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  801a33:	c1 e8 1f             	shr    $0x1f,%eax
+  801a36:	08 45 cb             	or     %al,-0x35(%ebp)
+  801a39:	83 c4 20             	add    $0x20,%esp
+  801a3c:	e9 33 ff ff ff       	jmp    801974 <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  801a41:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  801a44:	83 ec 0c             	sub    $0xc,%esp
+  801a47:	68 40 50 80 00       	push   $0x805040
+  801a4c:	e8 1f f5 ff ff       	call   800f70 <sysbatch_flush>
+  801a51:	83 c4 10             	add    $0x10,%esp
+  801a54:	85 c0                	test   %eax,%eax
+  801a56:	78 06                	js     801a5e <devfile_read+0x231>
+  801a58:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  801a5c:	74 14                	je     801a72 <devfile_read+0x245>
+    memmove(dst, src, r);
+  801a5e:	83 ec 04             	sub    $0x4,%esp
+  801a61:	ff 75 d4             	push   -0x2c(%ebp)
+  801a64:	ff 75 d0             	push   -0x30(%ebp)
+  801a67:	ff 75 0c             	push   0xc(%ebp)
+  801a6a:	e8 55 ee ff ff       	call   8008c4 <memmove>
+  801a6f:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  801a72:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a75:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  801a78:	e9 11 fe ff ff       	jmp    80188e <devfile_read+0x61>
+  assert(r <= n);
+  801a7d:	68 71 32 80 00       	push   $0x803271
+  801a82:	68 78 32 80 00       	push   $0x803278
+  801a87:	68 1c 01 00 00       	push   $0x11c
+  801a8c:	68 66 32 80 00       	push   $0x803266
+  801a91:	e8 97 0f 00 00       	call   802a2d <_panic>
+  assert(r <= PGSIZE);
+  801a96:	68 8d 32 80 00       	push   $0x80328d
+  801a9b:	68 78 32 80 00       	push   $0x803278
+  801aa0:	68 1d 01 00 00       	push   $0x11d
+  801aa5:	68 66 32 80 00       	push   $0x803266
+  801aaa:	e8 7e 0f 00 00       	call   802a2d <_panic>
+
+00801aaf <devfile_write>:
+{
+  801aaf:	55                   	push   %ebp
+  801ab0:	89 e5                	mov    %esp,%ebp
+  801ab2:	57                   	push   %edi
+  801ab3:	56                   	push   %esi
+  801ab4:	53                   	push   %ebx
+  801ab5:	83 ec 1c             	sub    $0x1c,%esp
+  801ab8:	8b 75 08             	mov    0x8(%ebp),%esi
+  801abb:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  801abe:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  801ac3:	77 39                	ja     801afe <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801ac5:	8b 56 0c             	mov    0xc(%esi),%edx
+  801ac8:	89 15 00 60 80 00    	mov    %edx,0x806000
+  fsipcbuf.write.req_n = n;
+  801ace:	a3 04 60 80 00       	mov    %eax,0x806004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  801ad3:	83 ec 04             	sub    $0x4,%esp
+  801ad6:	50                   	push   %eax
+  801ad7:	ff 75 0c             	push   0xc(%ebp)
+  801ada:	68 08 60 80 00       	push   $0x806008
+  801adf:	e8 e0 ed ff ff       	call   8008c4 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801ae4:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ae9:	b8 04 00 00 00       	mov    $0x4,%eax
+  801aee:	e8 e7 fb ff ff       	call   8016da <fsipc>
+  801af3:	83 c4 10             	add    $0x10,%esp
+}
+  801af6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801af9:	5b                   	pop    %ebx
+  801afa:	5e                   	pop    %esi
+  801afb:	5f                   	pop    %edi
+  801afc:	5d                   	pop    %ebp
+  801afd:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  801afe:	ba 00 00 10 00       	mov    $0x100000,%edx
+  801b03:	39 d0                	cmp    %edx,%eax
+  801b05:	89 d3                	mov    %edx,%ebx
+  801b07:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  801b0a:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  801b10:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  801b13:	83 c7 01             	add    $0x1,%edi
+  801b16:	89 f8                	mov    %edi,%eax
+  801b18:	e8 94 fc ff ff       	call   8017b1 <fsv_alloc>
+  801b1d:	85 c0                	test   %eax,%eax
+  801b1f:	78 d5                	js     801af6 <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  801b21:	83 ec 04             	sub    $0x4,%esp
+  801b24:	53                   	push   %ebx
+  801b25:	ff 75 0c             	push   0xc(%ebp)
+  801b28:	68 00 10 c0 9f       	push   $0x9fc01000
+  801b2d:	e8 92 ed ff ff       	call   8008c4 <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  801b32:	8b 46 0c             	mov    0xc(%esi),%eax
+  801b35:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  801b3a:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  801b40:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801b47:	89 f9                	mov    %edi,%ecx
+  801b49:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801b4e:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801b53:	e8 69 fa ff ff       	call   8015c1 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801b58:	6a 00                	push   $0x0
+  801b5a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801b5d:	50                   	push   %eax
+  801b5e:	6a 00                	push   $0x0
+  801b60:	6a 00                	push   $0x0
+  801b62:	e8 0c 0f 00 00       	call   802a73 <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  801b67:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  801b6a:	eb 8a                	jmp    801af6 <devfile_write+0x47>
+
+00801b6c <open>:
+{
+  801b6c:	55                   	push   %ebp
+  801b6d:	89 e5                	mov    %esp,%ebp
+  801b6f:	56                   	push   %esi
+  801b70:	53                   	push   %ebx
+  801b71:	83 ec 1c             	sub    $0x1c,%esp
+  801b74:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801b77:	56                   	push   %esi
+  801b78:	e8 86 eb ff ff       	call   800703 <strlen>
+  801b7d:	83 c4 10             	add    $0x10,%esp
+  801b80:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801b85:	7f 6c                	jg     801bf3 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  801b87:	83 ec 0c             	sub    $0xc,%esp
+  801b8a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b8d:	50                   	push   %eax
+  801b8e:	e8 ad f4 ff ff       	call   801040 <fd_alloc>
+  801b93:	89 c3                	mov    %eax,%ebx
+  801b95:	83 c4 10             	add    $0x10,%esp
+  801b98:	85 c0                	test   %eax,%eax
+  801b9a:	78 3c                	js     801bd8 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801b9c:	83 ec 08             	sub    $0x8,%esp
+  801b9f:	56                   	push   %esi
+  801ba0:	68 00 60 80 00       	push   $0x806000
+  801ba5:	e8 94 eb ff ff       	call   80073e <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801baa:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801bad:	a3 00 64 80 00       	mov    %eax,0x806400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801bb2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801bb5:	b8 01 00 00 00       	mov    $0x1,%eax
+  801bba:	e8 1b fb ff ff       	call   8016da <fsipc>
+  801bbf:	89 c3                	mov    %eax,%ebx
+  801bc1:	83 c4 10             	add    $0x10,%esp
+  801bc4:	85 c0                	test   %eax,%eax
+  801bc6:	78 19                	js     801be1 <open+0x75>
+  return fd2num(fd);
+  801bc8:	83 ec 0c             	sub    $0xc,%esp
+  801bcb:	ff 75 f4             	push   -0xc(%ebp)
+  801bce:	e8 49 f4 ff ff       	call   80101c <fd2num>
+  801bd3:	89 c3                	mov    %eax,%ebx
+  801bd5:	83 c4 10             	add    $0x10,%esp
+}
+  801bd8:	89 d8                	mov    %ebx,%eax
+  801bda:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bdd:	5b                   	pop    %ebx
+  801bde:	5e                   	pop    %esi
+  801bdf:	5d                   	pop    %ebp
+  801be0:	c3                   	ret
+    fd_close(fd, 0);
+  801be1:	83 ec 08             	sub    $0x8,%esp
+  801be4:	6a 00                	push   $0x0
+  801be6:	ff 75 f4             	push   -0xc(%ebp)
+  801be9:	e8 44 f5 ff ff       	call   801132 <fd_close>
+    return r;
+  801bee:	83 c4 10             	add    $0x10,%esp
+  801bf1:	eb e5                	jmp    801bd8 <open+0x6c>
+    return -E_BAD_PATH;
+  801bf3:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801bf8:	eb de                	jmp    801bd8 <open+0x6c>
+
+00801bfa <open_read>:
+{
+  801bfa:	55                   	push   %ebp
+  801bfb:	89 e5                	mov    %esp,%ebp
+  801bfd:	57                   	push   %edi
+  801bfe:	56                   	push   %esi
+  801bff:	53                   	push   %ebx
+  801c00:	83 ec 28             	sub    $0x28,%esp
+  801c03:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  801c06:	57                   	push   %edi
+  801c07:	e8 f7 ea ff ff       	call   800703 <strlen>
+  801c0c:	83 c4 10             	add    $0x10,%esp
+  801c0f:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801c14:	0f 87 f6 00 00 00    	ja     801d10 <open_read+0x116>
+  801c1a:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  801c1c:	83 ec 0c             	sub    $0xc,%esp
+  801c1f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801c22:	50                   	push   %eax
+  801c23:	e8 18 f4 ff ff       	call   801040 <fd_alloc>
+  801c28:	89 c3                	mov    %eax,%ebx
+  801c2a:	83 c4 10             	add    $0x10,%esp
+  801c2d:	85 c0                	test   %eax,%eax
+  801c2f:	0f 88 b2 00 00 00    	js     801ce7 <open_read+0xed>
+  strcpy(req->req_buf, path);
+  801c35:	83 ec 08             	sub    $0x8,%esp
+  801c38:	57                   	push   %edi
+  801c39:	68 e4 60 80 00       	push   $0x8060e4
+  801c3e:	e8 fb ea ff ff       	call   80073e <strcpy>
+  req->req_nops = 2;
+  801c43:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  801c4a:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  801c4d:	c7 05 04 60 80 00 01 	movl   $0x1,0x806004
+  801c54:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  801c57:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c5a:	a3 10 60 80 00       	mov    %eax,0x806010
+  req->req_ops[0].op_buf = 0;
+  801c5f:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  801c66:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  801c69:	c7 05 20 60 80 00 04 	movl   $0x4,0x806020
+  801c70:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  801c73:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  801c7a:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  801c7d:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  801c82:	29 f0                	sub    %esi,%eax
+  801c84:	3b 45 14             	cmp    0x14(%ebp),%eax
+  801c87:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  801c8b:	a3 2c 60 80 00       	mov    %eax,0x80602c
+  req->req_ops[1].op_offset = 0;
+  801c90:	c7 05 30 60 80 00 00 	movl   $0x0,0x806030
+  801c97:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  801c9a:	83 c6 01             	add    $0x1,%esi
+  801c9d:	89 35 34 60 80 00    	mov    %esi,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  801ca3:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801ca6:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801cab:	e8 2a fa ff ff       	call   8016da <fsipc>
+  801cb0:	89 c3                	mov    %eax,%ebx
+  801cb2:	83 c4 10             	add    $0x10,%esp
+  801cb5:	83 f8 01             	cmp    $0x1,%eax
+  801cb8:	7e 37                	jle    801cf1 <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  801cba:	a1 38 60 80 00       	mov    0x806038,%eax
+  801cbf:	8b 55 18             	mov    0x18(%ebp),%edx
+  801cc2:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  801cc4:	83 ec 04             	sub    $0x4,%esp
+  801cc7:	50                   	push   %eax
+  801cc8:	81 c6 e4 60 80 00    	add    $0x8060e4,%esi
+  801cce:	56                   	push   %esi
+  801ccf:	ff 75 10             	push   0x10(%ebp)
+  801cd2:	e8 ed eb ff ff       	call   8008c4 <memmove>
+  return fd2num(fd);
+  801cd7:	83 c4 04             	add    $0x4,%esp
+  801cda:	ff 75 e4             	push   -0x1c(%ebp)
+  801cdd:	e8 3a f3 ff ff       	call   80101c <fd2num>
+  801ce2:	89 c3                	mov    %eax,%ebx
+  801ce4:	83 c4 10             	add    $0x10,%esp
+}
+  801ce7:	89 d8                	mov    %ebx,%eax
+  801ce9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cec:	5b                   	pop    %ebx
+  801ced:	5e                   	pop    %esi
+  801cee:	5f                   	pop    %edi
+  801cef:	5d                   	pop    %ebp
+  801cf0:	c3                   	ret
+    fd_close(fd, 0);
+  801cf1:	83 ec 08             	sub    $0x8,%esp
+  801cf4:	6a 00                	push   $0x0
+  801cf6:	ff 75 e4             	push   -0x1c(%ebp)
+  801cf9:	e8 34 f4 ff ff       	call   801132 <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  801cfe:	83 c4 10             	add    $0x10,%esp
+  801d01:	85 db                	test   %ebx,%ebx
+  801d03:	78 e2                	js     801ce7 <open_read+0xed>
+  801d05:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  801d08:	8b 9b 1c 60 80 00    	mov    0x80601c(%ebx),%ebx
+  801d0e:	eb d7                	jmp    801ce7 <open_read+0xed>
+    return -E_BAD_PATH;
+  801d10:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801d15:	eb d0                	jmp    801ce7 <open_read+0xed>
+
+00801d17 <file_stat>:
+{
+  801d17:	55                   	push   %ebp
+  801d18:	89 e5                	mov    %esp,%ebp
+  801d1a:	57                   	push   %edi
+  801d1b:	56                   	push   %esi
+  801d1c:	53                   	push   %ebx
+  801d1d:	83 ec 18             	sub    $0x18,%esp
+  801d20:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801d23:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801d26:	57                   	push   %edi
+  801d27:	e8 d7 e9 ff ff       	call   800703 <strlen>
+  801d2c:	83 c4 10             	add    $0x10,%esp
+  801d2f:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801d34:	0f 8f c7 00 00 00    	jg     801e01 <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  801d3a:	83 ec 0c             	sub    $0xc,%esp
+  801d3d:	57                   	push   %edi
+  801d3e:	e8 c0 e9 ff ff       	call   800703 <strlen>
+  801d43:	8d 58 04             	lea    0x4(%eax),%ebx
+  801d46:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  801d49:	83 c4 08             	add    $0x8,%esp
+  801d4c:	57                   	push   %edi
+  801d4d:	68 e4 60 80 00       	push   $0x8060e4
+  801d52:	e8 e7 e9 ff ff       	call   80073e <strcpy>
+  req->req_nops = 2;
+  801d57:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  801d5e:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  801d61:	c7 05 04 60 80 00 02 	movl   $0x2,0x806004
+  801d68:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  801d6b:	c7 05 10 60 80 00 00 	movl   $0x0,0x806010
+  801d72:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  801d75:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  801d7c:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  801d7f:	c7 05 20 60 80 00 03 	movl   $0x3,0x806020
+  801d86:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  801d89:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  801d90:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  801d93:	89 1d 34 60 80 00    	mov    %ebx,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  801d99:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d9e:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801da3:	e8 32 f9 ff ff       	call   8016da <fsipc>
+  801da8:	83 c4 10             	add    $0x10,%esp
+  801dab:	83 f8 01             	cmp    $0x1,%eax
+  801dae:	7e 42                	jle    801df2 <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  801db0:	81 c3 e4 60 80 00    	add    $0x8060e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  801db6:	83 ec 08             	sub    $0x8,%esp
+  801db9:	53                   	push   %ebx
+  801dba:	56                   	push   %esi
+  801dbb:	e8 7e e9 ff ff       	call   80073e <strcpy>
+  st->st_size = ret->ret_size;
+  801dc0:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  801dc6:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  801dcc:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  801dd2:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  801dd8:	c7 86 88 00 00 00 04 	movl   $0x804004,0x88(%esi)
+  801ddf:	40 80 00 
+  return 0;
+  801de2:	83 c4 10             	add    $0x10,%esp
+  801de5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801dea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ded:	5b                   	pop    %ebx
+  801dee:	5e                   	pop    %esi
+  801def:	5f                   	pop    %edi
+  801df0:	5d                   	pop    %ebp
+  801df1:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  801df2:	85 c0                	test   %eax,%eax
+  801df4:	78 f4                	js     801dea <file_stat+0xd3>
+  801df6:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801df9:	8b 80 1c 60 80 00    	mov    0x80601c(%eax),%eax
+  801dff:	eb e9                	jmp    801dea <file_stat+0xd3>
+    return -E_BAD_PATH;
+  801e01:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801e06:	eb e2                	jmp    801dea <file_stat+0xd3>
+
+00801e08 <read_map>:
+{
+  801e08:	55                   	push   %ebp
+  801e09:	89 e5                	mov    %esp,%ebp
+  801e0b:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801e0e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e11:	50                   	push   %eax
+  801e12:	ff 75 08             	push   0x8(%ebp)
+  801e15:	e8 7c f2 ff ff       	call   801096 <fd_lookup>
+  801e1a:	83 c4 10             	add    $0x10,%esp
+  801e1d:	85 c0                	test   %eax,%eax
+  801e1f:	78 2a                	js     801e4b <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  801e21:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e24:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  801e2a:	39 08                	cmp    %ecx,(%eax)
+  801e2c:	75 1f                	jne    801e4d <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  801e2e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e31:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read_map.req_offset = offset;
+  801e36:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e39:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  801e3e:	8b 55 10             	mov    0x10(%ebp),%edx
+  801e41:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801e46:	e8 8f f8 ff ff       	call   8016da <fsipc>
+}
+  801e4b:	c9                   	leave
+  801e4c:	c3                   	ret
+    return -E_INVAL;
+  801e4d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e52:	eb f7                	jmp    801e4b <read_map+0x43>
+
+00801e54 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801e54:	55                   	push   %ebp
+  801e55:	89 e5                	mov    %esp,%ebp
+  801e57:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  801e5a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e5f:	b8 08 00 00 00       	mov    $0x8,%eax
+  801e64:	e8 71 f8 ff ff       	call   8016da <fsipc>
+}
+  801e69:	c9                   	leave
+  801e6a:	c3                   	ret
+
+00801e6b <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  801e6b:	55                   	push   %ebp
+  801e6c:	89 e5                	mov    %esp,%ebp
+  801e6e:	57                   	push   %edi
+  801e6f:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  801e70:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e73:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.stats.req_bio_sched = 0;
+  801e78:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  801e7f:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  801e82:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  801e89:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  801e8c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e91:	b8 09 00 00 00       	mov    $0x9,%eax
+  801e96:	e8 3f f8 ff ff       	call   8016da <fsipc>
+  801e9b:	85 c0                	test   %eax,%eax
+  801e9d:	78 14                	js     801eb3 <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  801e9f:	be 00 60 80 00       	mov    $0x806000,%esi
+  801ea4:	b9 16 00 00 00       	mov    $0x16,%ecx
+  801ea9:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801eac:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  801eae:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801eb3:	5e                   	pop    %esi
+  801eb4:	5f                   	pop    %edi
+  801eb5:	5d                   	pop    %ebp
+  801eb6:	c3                   	ret
+
+00801eb7 <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  801eb7:	55                   	push   %ebp
+  801eb8:	89 e5                	mov    %esp,%ebp
+  801eba:	53                   	push   %ebx
+  801ebb:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  801ebe:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801ec1:	50                   	push   %eax
+  801ec2:	6a 00                	push   $0x0
+  801ec4:	e8 a2 ff ff ff       	call   801e6b <fs_stats>
+  801ec9:	83 c4 10             	add    $0x10,%esp
+  801ecc:	85 c0                	test   %eax,%eax
+  801ece:	78 28                	js     801ef8 <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  801ed0:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  801ed3:	83 ec 08             	sub    $0x8,%esp
+  801ed6:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801ed9:	50                   	push   %eax
+  801eda:	6a 20                	push   $0x20
+  801edc:	e8 8a ff ff ff       	call   801e6b <fs_stats>
+  801ee1:	83 c4 10             	add    $0x10,%esp
+  801ee4:	85 c0                	test   %eax,%eax
+  801ee6:	78 10                	js     801ef8 <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  801ee8:	83 ec 08             	sub    $0x8,%esp
+  801eeb:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801eee:	50                   	push   %eax
+  801eef:	53                   	push   %ebx
+  801ef0:	e8 76 ff ff ff       	call   801e6b <fs_stats>
+  801ef5:	83 c4 10             	add    $0x10,%esp
+}
+  801ef8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801efb:	c9                   	leave
+  801efc:	c3                   	ret
+
+00801efd <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  801efd:	55                   	push   %ebp
+  801efe:	89 e5                	mov    %esp,%ebp
+  801f00:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  801f03:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  801f0a:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  801f0d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f10:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.stats.req_dcache = 0;
+  801f15:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  801f1c:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  801f1f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f24:	b8 09 00 00 00       	mov    $0x9,%eax
+  801f29:	e8 ac f7 ff ff       	call   8016da <fsipc>
+}
+  801f2e:	c9                   	leave
+  801f2f:	c3                   	ret
+
+00801f30 <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  801f30:	55                   	push   %ebp
+  801f31:	89 e5                	mov    %esp,%ebp
+  801f33:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  801f36:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  801f3d:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  801f40:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  801f47:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  801f4a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f4d:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_STATS, NULL);
+  801f52:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f57:	b8 09 00 00 00       	mov    $0x9,%eax
+  801f5c:	e8 79 f7 ff ff       	call   8016da <fsipc>
+}
+  801f61:	c9                   	leave
+  801f62:	c3                   	ret
+
+00801f63 <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  801f63:	55                   	push   %ebp
+  801f64:	89 e5                	mov    %esp,%ebp
+  801f66:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801f69:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f6c:	50                   	push   %eax
+  801f6d:	ff 75 08             	push   0x8(%ebp)
+  801f70:	e8 21 f1 ff ff       	call   801096 <fd_lookup>
+  801f75:	83 c4 10             	add    $0x10,%esp
+  801f78:	85 c0                	test   %eax,%eax
+  801f7a:	78 34                	js     801fb0 <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  801f7c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f7f:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  801f85:	39 08                	cmp    %ecx,(%eax)
+  801f87:	75 29                	jne    801fb2 <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  801f89:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f8c:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.fallocate.req_offset = offset;
+  801f91:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f94:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.fallocate.req_len = len;
+  801f99:	8b 45 10             	mov    0x10(%ebp),%eax
+  801f9c:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  801fa1:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fa6:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801fab:	e8 2a f7 ff ff       	call   8016da <fsipc>
+}
+  801fb0:	c9                   	leave
+  801fb1:	c3                   	ret
+    return -E_INVAL;
+  801fb2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801fb7:	eb f7                	jmp    801fb0 <fallocate+0x4d>
+
+00801fb9 <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  801fb9:	55                   	push   %ebp
+  801fba:	89 e5                	mov    %esp,%ebp
+  801fbc:	57                   	push   %edi
+  801fbd:	56                   	push   %esi
+  801fbe:	53                   	push   %ebx
+  801fbf:	83 ec 24             	sub    $0x24,%esp
+  801fc2:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801fc5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801fc8:	50                   	push   %eax
+  801fc9:	ff 75 08             	push   0x8(%ebp)
+  801fcc:	e8 c5 f0 ff ff       	call   801096 <fd_lookup>
+  801fd1:	83 c4 10             	add    $0x10,%esp
+  801fd4:	85 c0                	test   %eax,%eax
+  801fd6:	78 66                	js     80203e <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  801fd8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801fdb:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  801fe1:	39 08                	cmp    %ecx,(%eax)
+  801fe3:	75 61                	jne    802046 <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  801fe5:	85 f6                	test   %esi,%esi
+  801fe7:	7e 50                	jle    802039 <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  801fe9:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  801fee:	39 de                	cmp    %ebx,%esi
+  801ff0:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  801ff3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801ff6:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ff9:	a3 00 60 80 00       	mov    %eax,0x806000
+    fsipcbuf.prefetch.req_n = m;
+  801ffe:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  802004:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  80200b:	83 ec 04             	sub    $0x4,%esp
+  80200e:	57                   	push   %edi
+  80200f:	ff 75 0c             	push   0xc(%ebp)
+  802012:	68 08 60 80 00       	push   $0x806008
+  802017:	e8 a8 e8 ff ff       	call   8008c4 <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  80201c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802021:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802026:	e8 af f6 ff ff       	call   8016da <fsipc>
+  80202b:	83 c4 10             	add    $0x10,%esp
+  80202e:	85 c0                	test   %eax,%eax
+  802030:	78 0c                	js     80203e <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  802032:	01 7d 0c             	add    %edi,0xc(%ebp)
+  802035:	29 de                	sub    %ebx,%esi
+  802037:	eb ac                	jmp    801fe5 <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  802039:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80203e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802041:	5b                   	pop    %ebx
+  802042:	5e                   	pop    %esi
+  802043:	5f                   	pop    %edi
+  802044:	5d                   	pop    %ebp
+  802045:	c3                   	ret
+    return -E_INVAL;
+  802046:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80204b:	eb f1                	jmp    80203e <prefetch+0x85>
+
+0080204d <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  80204d:	55                   	push   %ebp
+  80204e:	89 e5                	mov    %esp,%ebp
+  802050:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  802053:	50                   	push   %eax
+  802054:	e8 d3 ef ff ff       	call   80102c <fd2data>
+  802059:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  80205e:	c9                   	leave
+  80205f:	c3                   	ret
+
+00802060 <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802060:	55                   	push   %ebp
+  802061:	89 e5                	mov    %esp,%ebp
+  802063:	56                   	push   %esi
+  802064:	53                   	push   %ebx
+  802065:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  802068:	83 ec 0c             	sub    $0xc,%esp
+  80206b:	ff 75 08             	push   0x8(%ebp)
+  80206e:	e8 b9 ef ff ff       	call   80102c <fd2data>
+  802073:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  802075:	83 c4 08             	add    $0x8,%esp
+  802078:	68 c8 32 80 00       	push   $0x8032c8
+  80207d:	53                   	push   %ebx
+  80207e:	e8 bb e6 ff ff       	call   80073e <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  802083:	8b 46 04             	mov    0x4(%esi),%eax
+  802086:	2b 06                	sub    (%esi),%eax
+  802088:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  80208e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802095:	00 00 00 
+  stat->st_dev = &devpipe;
+  802098:	c7 83 88 00 00 00 20 	movl   $0x804020,0x88(%ebx)
+  80209f:	40 80 00 
+  return 0;
+}
+  8020a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020a7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020aa:	5b                   	pop    %ebx
+  8020ab:	5e                   	pop    %esi
+  8020ac:	5d                   	pop    %ebp
+  8020ad:	c3                   	ret
+
+008020ae <pipe_wakeup>:
+{
+  8020ae:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  8020b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020b5:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  8020b8:	85 c0                	test   %eax,%eax
+  8020ba:	75 01                	jne    8020bd <pipe_wakeup+0xf>
+  8020bc:	c3                   	ret
+{
+  8020bd:	55                   	push   %ebp
+  8020be:	89 e5                	mov    %esp,%ebp
+  8020c0:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  8020c3:	6a 00                	push   $0x0
+  8020c5:	68 00 00 c0 ee       	push   $0xeec00000
+  8020ca:	52                   	push   %edx
+  8020cb:	e8 f9 ed ff ff       	call   800ec9 <sys_chan_wakeup>
+  8020d0:	83 c4 10             	add    $0x10,%esp
+}
+  8020d3:	c9                   	leave
+  8020d4:	c3                   	ret
+
+008020d5 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8020d5:	55                   	push   %ebp
+  8020d6:	89 e5                	mov    %esp,%ebp
+  8020d8:	57                   	push   %edi
+  8020d9:	56                   	push   %esi
+  8020da:	53                   	push   %ebx
+  8020db:	83 ec 18             	sub    $0x18,%esp
+  8020de:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  8020e1:	57                   	push   %edi
+  8020e2:	e8 45 ef ff ff       	call   80102c <fd2data>
+  8020e7:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  8020e9:	83 c4 10             	add    $0x10,%esp
+  8020ec:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  8020f0:	74 2a                	je     80211c <devpipe_close+0x47>
+  8020f2:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  8020f7:	89 f8                	mov    %edi,%eax
+  8020f9:	e8 4f ff ff ff       	call   80204d <pipe_ring>
+  8020fe:	83 ec 08             	sub    $0x8,%esp
+  802101:	01 d8                	add    %ebx,%eax
+  802103:	50                   	push   %eax
+  802104:	6a 00                	push   $0x0
+  802106:	e8 e7 ea ff ff       	call   800bf2 <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  80210b:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802111:	83 c4 10             	add    $0x10,%esp
+  802114:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  80211a:	75 db                	jne    8020f7 <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  80211c:	83 ec 08             	sub    $0x8,%esp
+  80211f:	57                   	push   %edi
+  802120:	6a 00                	push   $0x0
+  802122:	e8 cb ea ff ff       	call   800bf2 <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  802127:	83 c4 10             	add    $0x10,%esp
+  80212a:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  80212e:	75 13                	jne    802143 <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  802130:	83 ec 08             	sub    $0x8,%esp
+  802133:	56                   	push   %esi
+  802134:	6a 00                	push   $0x0
+  802136:	e8 b7 ea ff ff       	call   800bf2 <sys_page_unmap>
+}
+  80213b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80213e:	5b                   	pop    %ebx
+  80213f:	5e                   	pop    %esi
+  802140:	5f                   	pop    %edi
+  802141:	5d                   	pop    %ebp
+  802142:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802143:	8d 56 04             	lea    0x4(%esi),%edx
+  802146:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802149:	e8 60 ff ff ff       	call   8020ae <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  80214e:	8d 46 30             	lea    0x30(%esi),%eax
+  802151:	89 f2                	mov    %esi,%edx
+  802153:	e8 56 ff ff ff       	call   8020ae <pipe_wakeup>
+  802158:	eb d6                	jmp    802130 <devpipe_close+0x5b>
+
+0080215a <_pipeisclosed>:
+{
+  80215a:	55                   	push   %ebp
+  80215b:	89 e5                	mov    %esp,%ebp
+  80215d:	57                   	push   %edi
+  80215e:	56                   	push   %esi
+  80215f:	53                   	push   %ebx
+  802160:	83 ec 1c             	sub    $0x1c,%esp
+  802163:	89 c7                	mov    %eax,%edi
+  802165:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  802167:	a1 44 57 80 00       	mov    0x805744,%eax
+  80216c:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  80216f:	83 ec 0c             	sub    $0xc,%esp
+  802172:	57                   	push   %edi
+  802173:	e8 5e 0a 00 00       	call   802bd6 <pageref>
+  802178:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80217b:	89 34 24             	mov    %esi,(%esp)
+  80217e:	e8 53 0a 00 00       	call   802bd6 <pageref>
+    nn = thisenv->env_runs;
+  802183:	8b 15 44 57 80 00    	mov    0x805744,%edx
+  802189:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  80218c:	83 c4 10             	add    $0x10,%esp
+  80218f:	39 cb                	cmp    %ecx,%ebx
+  802191:	74 1b                	je     8021ae <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  802193:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802196:	75 cf                	jne    802167 <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802198:	8b 42 58             	mov    0x58(%edx),%eax
+  80219b:	6a 01                	push   $0x1
+  80219d:	50                   	push   %eax
+  80219e:	53                   	push   %ebx
+  80219f:	68 cf 32 80 00       	push   $0x8032cf
+  8021a4:	e8 a7 df ff ff       	call   800150 <cprintf>
+  8021a9:	83 c4 10             	add    $0x10,%esp
+  8021ac:	eb b9                	jmp    802167 <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  8021ae:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8021b1:	0f 94 c0             	sete   %al
+  8021b4:	0f b6 c0             	movzbl %al,%eax
+}
+  8021b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021ba:	5b                   	pop    %ebx
+  8021bb:	5e                   	pop    %esi
+  8021bc:	5f                   	pop    %edi
+  8021bd:	5d                   	pop    %ebp
+  8021be:	c3                   	ret
+
+008021bf <devpipe_write_bulk>:
+{
+  8021bf:	55                   	push   %ebp
+  8021c0:	89 e5                	mov    %esp,%ebp
+  8021c2:	57                   	push   %edi
+  8021c3:	56                   	push   %esi
+  8021c4:	53                   	push   %ebx
+  8021c5:	83 ec 1c             	sub    $0x1c,%esp
+  8021c8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8021cb:	89 d6                	mov    %edx,%esi
+  8021cd:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  8021d0:	e8 78 fe ff ff       	call   80204d <pipe_ring>
+  8021d5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  8021d8:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  8021dd:	8d 46 04             	lea    0x4(%esi),%eax
+  8021e0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  8021e3:	eb 75                	jmp    80225a <devpipe_write_bulk+0x9b>
+  8021e5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8021ea:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  8021ee:	6a 64                	push   $0x64
+  8021f0:	68 00 00 c0 ee       	push   $0xeec00000
+  8021f5:	53                   	push   %ebx
+  8021f6:	56                   	push   %esi
+  8021f7:	e8 aa ec ff ff       	call   800ea6 <sys_chan_sleep>
+      continue;
+  8021fc:	83 c4 10             	add    $0x10,%esp
+  8021ff:	eb 59                	jmp    80225a <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  802201:	89 d1                	mov    %edx,%ecx
+  802203:	c1 f9 1f             	sar    $0x1f,%ecx
+  802206:	c1 e9 11             	shr    $0x11,%ecx
+  802209:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  80220c:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802211:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  802213:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  802219:	29 d3                	sub    %edx,%ebx
+  80221b:	ba 00 80 00 00       	mov    $0x8000,%edx
+  802220:	29 c2                	sub    %eax,%edx
+  802222:	39 d3                	cmp    %edx,%ebx
+  802224:	0f 47 da             	cmova  %edx,%ebx
+  802227:	8b 55 08             	mov    0x8(%ebp),%edx
+  80222a:	29 fa                	sub    %edi,%edx
+  80222c:	39 d3                	cmp    %edx,%ebx
+  80222e:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  802231:	83 ec 04             	sub    $0x4,%esp
+  802234:	53                   	push   %ebx
+  802235:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802238:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  80223b:	52                   	push   %edx
+  80223c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80223f:	01 c8                	add    %ecx,%eax
+  802241:	50                   	push   %eax
+  802242:	e8 df e6 ff ff       	call   800926 <memcpy>
+    i += m;
+  802247:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  802249:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  80224c:	8d 46 2c             	lea    0x2c(%esi),%eax
+  80224f:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802252:	e8 57 fe ff ff       	call   8020ae <pipe_wakeup>
+  802257:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  80225a:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  80225d:	73 2b                	jae    80228a <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  80225f:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  802261:	8b 56 04             	mov    0x4(%esi),%edx
+  802264:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  80226a:	39 d0                	cmp    %edx,%eax
+  80226c:	7d 93                	jge    802201 <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  80226e:	89 f2                	mov    %esi,%edx
+  802270:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802273:	e8 e2 fe ff ff       	call   80215a <_pipeisclosed>
+  802278:	85 c0                	test   %eax,%eax
+  80227a:	0f 84 65 ff ff ff    	je     8021e5 <devpipe_write_bulk+0x26>
+        return i;
+  802280:	89 f8                	mov    %edi,%eax
+}
+  802282:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802285:	5b                   	pop    %ebx
+  802286:	5e                   	pop    %esi
+  802287:	5f                   	pop    %edi
+  802288:	5d                   	pop    %ebp
+  802289:	c3                   	ret
+  return i;
+  80228a:	89 f8                	mov    %edi,%eax
+  80228c:	eb f4                	jmp    802282 <devpipe_write_bulk+0xc3>
+
+0080228e <devpipe_write>:
+{
+  80228e:	55                   	push   %ebp
+  80228f:	89 e5                	mov    %esp,%ebp
+  802291:	57                   	push   %edi
+  802292:	56                   	push   %esi
+  802293:	53                   	push   %ebx
+  802294:	83 ec 28             	sub    $0x28,%esp
+  802297:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  80229a:	56                   	push   %esi
+  80229b:	e8 8c ed ff ff       	call   80102c <fd2data>
+  8022a0:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  8022a2:	8b 78 28             	mov    0x28(%eax),%edi
+  8022a5:	83 c4 10             	add    $0x10,%esp
+  8022a8:	85 ff                	test   %edi,%edi
+  8022aa:	75 25                	jne    8022d1 <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  8022ac:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8022af:	74 66                	je     802317 <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8022b1:	8b 43 04             	mov    0x4(%ebx),%eax
+  8022b4:	8b 0b                	mov    (%ebx),%ecx
+  8022b6:	8d 51 20             	lea    0x20(%ecx),%edx
+  8022b9:	39 d0                	cmp    %edx,%eax
+  8022bb:	72 2b                	jb     8022e8 <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  8022bd:	89 da                	mov    %ebx,%edx
+  8022bf:	89 f0                	mov    %esi,%eax
+  8022c1:	e8 94 fe ff ff       	call   80215a <_pipeisclosed>
+  8022c6:	85 c0                	test   %eax,%eax
+  8022c8:	75 51                	jne    80231b <devpipe_write+0x8d>
+      sys_yield();
+  8022ca:	e8 3c e8 ff ff       	call   800b0b <sys_yield>
+  8022cf:	eb e0                	jmp    8022b1 <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  8022d1:	83 ec 0c             	sub    $0xc,%esp
+  8022d4:	ff 75 10             	push   0x10(%ebp)
+  8022d7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8022da:	89 c2                	mov    %eax,%edx
+  8022dc:	89 f0                	mov    %esi,%eax
+  8022de:	e8 dc fe ff ff       	call   8021bf <devpipe_write_bulk>
+  8022e3:	83 c4 10             	add    $0x10,%esp
+  8022e6:	eb 38                	jmp    802320 <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8022e8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8022eb:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8022ef:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8022f2:	89 c2                	mov    %eax,%edx
+  8022f4:	c1 fa 1f             	sar    $0x1f,%edx
+  8022f7:	89 d1                	mov    %edx,%ecx
+  8022f9:	c1 e9 1b             	shr    $0x1b,%ecx
+  8022fc:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8022ff:	83 e2 1f             	and    $0x1f,%edx
+  802302:	29 ca                	sub    %ecx,%edx
+  802304:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802308:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  80230c:	83 c0 01             	add    $0x1,%eax
+  80230f:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  802312:	83 c7 01             	add    $0x1,%edi
+  802315:	eb 95                	jmp    8022ac <devpipe_write+0x1e>
+  return i;
+  802317:	89 f8                	mov    %edi,%eax
+  802319:	eb 05                	jmp    802320 <devpipe_write+0x92>
+        return 0;
+  80231b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802320:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802323:	5b                   	pop    %ebx
+  802324:	5e                   	pop    %esi
+  802325:	5f                   	pop    %edi
+  802326:	5d                   	pop    %ebp
+  802327:	c3                   	ret
+
+00802328 <devpipe_read_bulk>:
+{
+  802328:	55                   	push   %ebp
+  802329:	89 e5                	mov    %esp,%ebp
+  80232b:	57                   	push   %edi
+  80232c:	56                   	push   %esi
+  80232d:	53                   	push   %ebx
+  80232e:	83 ec 2c             	sub    $0x2c,%esp
+  802331:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802334:	89 d6                	mov    %edx,%esi
+  802336:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802339:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  80233c:	e8 0c fd ff ff       	call   80204d <pipe_ring>
+  802341:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  802344:	85 db                	test   %ebx,%ebx
+  802346:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80234b:	0f 45 c3             	cmovne %ebx,%eax
+  80234e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802351:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802356:	8d 46 30             	lea    0x30(%esi),%eax
+  802359:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  80235c:	eb 50                	jmp    8023ae <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  80235e:	89 d1                	mov    %edx,%ecx
+  802360:	c1 f9 1f             	sar    $0x1f,%ecx
+  802363:	c1 e9 11             	shr    $0x11,%ecx
+  802366:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802369:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  80236e:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  802370:	29 d3                	sub    %edx,%ebx
+  802372:	ba 00 80 00 00       	mov    $0x8000,%edx
+  802377:	29 c2                	sub    %eax,%edx
+  802379:	39 d3                	cmp    %edx,%ebx
+  80237b:	0f 47 da             	cmova  %edx,%ebx
+  80237e:	8b 55 08             	mov    0x8(%ebp),%edx
+  802381:	29 fa                	sub    %edi,%edx
+  802383:	39 d3                	cmp    %edx,%ebx
+  802385:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  802388:	83 ec 04             	sub    $0x4,%esp
+  80238b:	53                   	push   %ebx
+  80238c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80238f:	01 c8                	add    %ecx,%eax
+  802391:	50                   	push   %eax
+  802392:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802395:	01 f8                	add    %edi,%eax
+  802397:	50                   	push   %eax
+  802398:	e8 89 e5 ff ff       	call   800926 <memcpy>
+    i += m;
+  80239d:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  80239f:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8023a1:	89 f2                	mov    %esi,%edx
+  8023a3:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8023a6:	e8 03 fd ff ff       	call   8020ae <pipe_wakeup>
+  8023ab:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  8023ae:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  8023b1:	73 51                	jae    802404 <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  8023b3:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  8023b6:	8b 16                	mov    (%esi),%edx
+  8023b8:	39 da                	cmp    %ebx,%edx
+  8023ba:	75 a2                	jne    80235e <devpipe_read_bulk+0x36>
+      if (i > 0)
+  8023bc:	85 ff                	test   %edi,%edi
+  8023be:	75 44                	jne    802404 <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  8023c0:	89 f2                	mov    %esi,%edx
+  8023c2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8023c5:	e8 90 fd ff ff       	call   80215a <_pipeisclosed>
+  8023ca:	85 c0                	test   %eax,%eax
+  8023cc:	75 3a                	jne    802408 <devpipe_read_bulk+0xe0>
+  8023ce:	b8 01 00 00 00       	mov    $0x1,%eax
+  8023d3:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  8023d7:	6a 64                	push   $0x64
+  8023d9:	ff 75 d4             	push   -0x2c(%ebp)
+  8023dc:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  8023dd:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  8023e0:	50                   	push   %eax
+  8023e1:	e8 c0 ea ff ff       	call   800ea6 <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  8023e6:	85 c0                	test   %eax,%eax
+  8023e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023ed:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  8023f0:	83 c4 10             	add    $0x10,%esp
+  8023f3:	a8 01                	test   $0x1,%al
+  8023f5:	74 b7                	je     8023ae <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  8023f7:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  8023fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023ff:	5b                   	pop    %ebx
+  802400:	5e                   	pop    %esi
+  802401:	5f                   	pop    %edi
+  802402:	5d                   	pop    %ebp
+  802403:	c3                   	ret
+  return i;
+  802404:	89 f8                	mov    %edi,%eax
+  802406:	eb f4                	jmp    8023fc <devpipe_read_bulk+0xd4>
+        return 0;
+  802408:	b8 00 00 00 00       	mov    $0x0,%eax
+  80240d:	eb ed                	jmp    8023fc <devpipe_read_bulk+0xd4>
+
+0080240f <devpipe_read>:
+{
+  80240f:	55                   	push   %ebp
+  802410:	89 e5                	mov    %esp,%ebp
+  802412:	57                   	push   %edi
+  802413:	56                   	push   %esi
+  802414:	53                   	push   %ebx
+  802415:	83 ec 18             	sub    $0x18,%esp
+  802418:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  80241b:	57                   	push   %edi
+  80241c:	e8 0b ec ff ff       	call   80102c <fd2data>
+  802421:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  802423:	8b 70 28             	mov    0x28(%eax),%esi
+  802426:	83 c4 10             	add    $0x10,%esp
+  802429:	85 f6                	test   %esi,%esi
+  80242b:	75 24                	jne    802451 <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  80242d:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802430:	74 60                	je     802492 <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  802432:	8b 03                	mov    (%ebx),%eax
+  802434:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802437:	75 3b                	jne    802474 <devpipe_read+0x65>
+      if (i > 0)
+  802439:	85 f6                	test   %esi,%esi
+  80243b:	75 2d                	jne    80246a <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  80243d:	89 da                	mov    %ebx,%edx
+  80243f:	89 f8                	mov    %edi,%eax
+  802441:	e8 14 fd ff ff       	call   80215a <_pipeisclosed>
+  802446:	85 c0                	test   %eax,%eax
+  802448:	75 4c                	jne    802496 <devpipe_read+0x87>
+      sys_yield();
+  80244a:	e8 bc e6 ff ff       	call   800b0b <sys_yield>
+  80244f:	eb e1                	jmp    802432 <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  802451:	83 ec 08             	sub    $0x8,%esp
+  802454:	6a 00                	push   $0x0
+  802456:	ff 75 10             	push   0x10(%ebp)
+  802459:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80245c:	89 c2                	mov    %eax,%edx
+  80245e:	89 f8                	mov    %edi,%eax
+  802460:	e8 c3 fe ff ff       	call   802328 <devpipe_read_bulk>
+  802465:	83 c4 10             	add    $0x10,%esp
+  802468:	eb 02                	jmp    80246c <devpipe_read+0x5d>
+        return i;
+  80246a:	89 f0                	mov    %esi,%eax
+}
+  80246c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80246f:	5b                   	pop    %ebx
+  802470:	5e                   	pop    %esi
+  802471:	5f                   	pop    %edi
+  802472:	5d                   	pop    %ebp
+  802473:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802474:	99                   	cltd
+  802475:	c1 ea 1b             	shr    $0x1b,%edx
+  802478:	01 d0                	add    %edx,%eax
+  80247a:	83 e0 1f             	and    $0x1f,%eax
+  80247d:	29 d0                	sub    %edx,%eax
+  80247f:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802484:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802487:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  80248a:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  80248d:	83 c6 01             	add    $0x1,%esi
+  802490:	eb 9b                	jmp    80242d <devpipe_read+0x1e>
+  return i;
+  802492:	89 f0                	mov    %esi,%eax
+  802494:	eb d6                	jmp    80246c <devpipe_read+0x5d>
+        return 0;
+  802496:	b8 00 00 00 00       	mov    $0x0,%eax
+  80249b:	eb cf                	jmp    80246c <devpipe_read+0x5d>
+
+0080249d <pipe2>:
+{
+  80249d:	55                   	push   %ebp
+  80249e:	89 e5                	mov    %esp,%ebp
+  8024a0:	57                   	push   %edi
+  8024a1:	56                   	push   %esi
+  8024a2:	53                   	push   %ebx
+  8024a3:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  8024a6:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8024a9:	50                   	push   %eax
+  8024aa:	e8 91 eb ff ff       	call   801040 <fd_alloc>
+  8024af:	89 c3                	mov    %eax,%ebx
+  8024b1:	83 c4 10             	add    $0x10,%esp
+  8024b4:	85 c0                	test   %eax,%eax
+  8024b6:	0f 88 fb 01 00 00    	js     8026b7 <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8024bc:	83 ec 04             	sub    $0x4,%esp
+  8024bf:	68 07 04 00 00       	push   $0x407
+  8024c4:	ff 75 e4             	push   -0x1c(%ebp)
+  8024c7:	6a 00                	push   $0x0
+  8024c9:	e8 9f e6 ff ff       	call   800b6d <sys_page_alloc>
+  8024ce:	89 c3                	mov    %eax,%ebx
+  8024d0:	83 c4 10             	add    $0x10,%esp
+  8024d3:	85 c0                	test   %eax,%eax
+  8024d5:	0f 88 dc 01 00 00    	js     8026b7 <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  8024db:	83 ec 0c             	sub    $0xc,%esp
+  8024de:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8024e1:	50                   	push   %eax
+  8024e2:	e8 59 eb ff ff       	call   801040 <fd_alloc>
+  8024e7:	89 c3                	mov    %eax,%ebx
+  8024e9:	83 c4 10             	add    $0x10,%esp
+  8024ec:	85 c0                	test   %eax,%eax
+  8024ee:	0f 88 b3 01 00 00    	js     8026a7 <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8024f4:	83 ec 04             	sub    $0x4,%esp
+  8024f7:	68 07 04 00 00       	push   $0x407
+  8024fc:	ff 75 e0             	push   -0x20(%ebp)
+  8024ff:	6a 00                	push   $0x0
+  802501:	e8 67 e6 ff ff       	call   800b6d <sys_page_alloc>
+  802506:	89 c3                	mov    %eax,%ebx
+  802508:	83 c4 10             	add    $0x10,%esp
+  80250b:	85 c0                	test   %eax,%eax
+  80250d:	0f 88 94 01 00 00    	js     8026a7 <pipe2+0x20a>
+  va = fd2data(fd0);
+  802513:	83 ec 0c             	sub    $0xc,%esp
+  802516:	ff 75 e4             	push   -0x1c(%ebp)
+  802519:	e8 0e eb ff ff       	call   80102c <fd2data>
+  80251e:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802520:	83 c4 0c             	add    $0xc,%esp
+  802523:	68 07 04 00 00       	push   $0x407
+  802528:	50                   	push   %eax
+  802529:	6a 00                	push   $0x0
+  80252b:	e8 3d e6 ff ff       	call   800b6d <sys_page_alloc>
+  802530:	89 c3                	mov    %eax,%ebx
+  802532:	83 c4 10             	add    $0x10,%esp
+  802535:	85 c0                	test   %eax,%eax
+  802537:	0f 88 5a 01 00 00    	js     802697 <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80253d:	83 ec 0c             	sub    $0xc,%esp
+  802540:	ff 75 e0             	push   -0x20(%ebp)
+  802543:	e8 e4 ea ff ff       	call   80102c <fd2data>
+  802548:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80254f:	50                   	push   %eax
+  802550:	6a 00                	push   $0x0
+  802552:	57                   	push   %edi
+  802553:	6a 00                	push   $0x0
+  802555:	e8 56 e6 ff ff       	call   800bb0 <sys_page_map>
+  80255a:	89 c3                	mov    %eax,%ebx
+  80255c:	83 c4 20             	add    $0x20,%esp
+  80255f:	85 c0                	test   %eax,%eax
+  802561:	0f 88 22 01 00 00    	js     802689 <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  802567:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  80256b:	74 72                	je     8025df <pipe2+0x142>
+  80256d:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  802572:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802575:	e8 d3 fa ff ff       	call   80204d <pipe_ring>
+  80257a:	83 ec 04             	sub    $0x4,%esp
+  80257d:	68 07 04 00 00       	push   $0x407
+  802582:	01 f0                	add    %esi,%eax
+  802584:	50                   	push   %eax
+  802585:	6a 00                	push   $0x0
+  802587:	e8 e1 e5 ff ff       	call   800b6d <sys_page_alloc>
+  80258c:	89 c3                	mov    %eax,%ebx
+  80258e:	83 c4 10             	add    $0x10,%esp
+  802591:	85 c0                	test   %eax,%eax
+  802593:	0f 88 97 00 00 00    	js     802630 <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  802599:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80259c:	e8 ac fa ff ff       	call   80204d <pipe_ring>
+  8025a1:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  8025a4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8025a7:	e8 a1 fa ff ff       	call   80204d <pipe_ring>
+  8025ac:	83 ec 0c             	sub    $0xc,%esp
+  8025af:	68 07 04 00 00       	push   $0x407
+  8025b4:	53                   	push   %ebx
+  8025b5:	6a 00                	push   $0x0
+  8025b7:	01 f0                	add    %esi,%eax
+  8025b9:	50                   	push   %eax
+  8025ba:	6a 00                	push   $0x0
+  8025bc:	e8 ef e5 ff ff       	call   800bb0 <sys_page_map>
+  8025c1:	89 c3                	mov    %eax,%ebx
+  8025c3:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8025c9:	83 c4 20             	add    $0x20,%esp
+  8025cc:	85 c0                	test   %eax,%eax
+  8025ce:	78 60                	js     802630 <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  8025d0:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  8025d6:	75 9a                	jne    802572 <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  8025d8:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  8025df:	a1 20 40 80 00       	mov    0x804020,%eax
+  8025e4:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8025e7:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  8025e9:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8025ec:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  8025f3:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8025f6:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  8025f8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8025fb:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  802602:	83 ec 0c             	sub    $0xc,%esp
+  802605:	ff 75 e4             	push   -0x1c(%ebp)
+  802608:	e8 0f ea ff ff       	call   80101c <fd2num>
+  80260d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802610:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  802612:	83 c4 04             	add    $0x4,%esp
+  802615:	ff 75 e0             	push   -0x20(%ebp)
+  802618:	e8 ff e9 ff ff       	call   80101c <fd2num>
+  80261d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802620:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  802623:	83 c4 10             	add    $0x10,%esp
+  802626:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80262b:	e9 87 00 00 00       	jmp    8026b7 <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802630:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  802635:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802638:	e8 10 fa ff ff       	call   80204d <pipe_ring>
+  80263d:	83 ec 08             	sub    $0x8,%esp
+  802640:	01 f0                	add    %esi,%eax
+  802642:	50                   	push   %eax
+  802643:	6a 00                	push   $0x0
+  802645:	e8 a8 e5 ff ff       	call   800bf2 <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  80264a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80264d:	e8 fb f9 ff ff       	call   80204d <pipe_ring>
+  802652:	83 c4 08             	add    $0x8,%esp
+  802655:	01 f0                	add    %esi,%eax
+  802657:	50                   	push   %eax
+  802658:	6a 00                	push   $0x0
+  80265a:	e8 93 e5 ff ff       	call   800bf2 <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  80265f:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802665:	83 c4 10             	add    $0x10,%esp
+  802668:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  80266e:	75 c5                	jne    802635 <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  802670:	83 ec 0c             	sub    $0xc,%esp
+  802673:	ff 75 e0             	push   -0x20(%ebp)
+  802676:	e8 b1 e9 ff ff       	call   80102c <fd2data>
+  80267b:	83 c4 08             	add    $0x8,%esp
+  80267e:	50                   	push   %eax
+  80267f:	6a 00                	push   $0x0
+  802681:	e8 6c e5 ff ff       	call   800bf2 <sys_page_unmap>
+  802686:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  802689:	83 ec 08             	sub    $0x8,%esp
+  80268c:	57                   	push   %edi
+  80268d:	6a 00                	push   $0x0
+  80268f:	e8 5e e5 ff ff       	call   800bf2 <sys_page_unmap>
+  802694:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  802697:	83 ec 08             	sub    $0x8,%esp
+  80269a:	ff 75 e0             	push   -0x20(%ebp)
+  80269d:	6a 00                	push   $0x0
+  80269f:	e8 4e e5 ff ff       	call   800bf2 <sys_page_unmap>
+  8026a4:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  8026a7:	83 ec 08             	sub    $0x8,%esp
+  8026aa:	ff 75 e4             	push   -0x1c(%ebp)
+  8026ad:	6a 00                	push   $0x0
+  8026af:	e8 3e e5 ff ff       	call   800bf2 <sys_page_unmap>
+  8026b4:	83 c4 10             	add    $0x10,%esp
+}
+  8026b7:	89 d8                	mov    %ebx,%eax
+  8026b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026bc:	5b                   	pop    %ebx
+  8026bd:	5e                   	pop    %esi
+  8026be:	5f                   	pop    %edi
+  8026bf:	5d                   	pop    %ebp
+  8026c0:	c3                   	ret
+
+008026c1 <pipe>:
+{
+  8026c1:	55                   	push   %ebp
+  8026c2:	89 e5                	mov    %esp,%ebp
+  8026c4:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  8026c7:	6a 00                	push   $0x0
+  8026c9:	ff 75 08             	push   0x8(%ebp)
+  8026cc:	e8 cc fd ff ff       	call   80249d <pipe2>
+}
+  8026d1:	c9                   	leave
+  8026d2:	c3                   	ret
+
+008026d3 <pipeisclosed>:
+{
+  8026d3:	55                   	push   %ebp
+  8026d4:	89 e5                	mov    %esp,%ebp
+  8026d6:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8026d9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026dc:	50                   	push   %eax
+  8026dd:	ff 75 08             	push   0x8(%ebp)
+  8026e0:	e8 b1 e9 ff ff       	call   801096 <fd_lookup>
+  8026e5:	83 c4 10             	add    $0x10,%esp
+  8026e8:	85 c0                	test   %eax,%eax
+  8026ea:	78 18                	js     802704 <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  8026ec:	83 ec 0c             	sub    $0xc,%esp
+  8026ef:	ff 75 f4             	push   -0xc(%ebp)
+  8026f2:	e8 35 e9 ff ff       	call   80102c <fd2data>
+  8026f7:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  8026f9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026fc:	e8 59 fa ff ff       	call   80215a <_pipeisclosed>
+  802701:	83 c4 10             	add    $0x10,%esp
+}
+  802704:	c9                   	leave
+  802705:	c3                   	ret
+
+00802706 <pipe_splice>:
+{
+  802706:	55                   	push   %ebp
+  802707:	89 e5                	mov    %esp,%ebp
+  802709:	57                   	push   %edi
+  80270a:	56                   	push   %esi
+  80270b:	53                   	push   %ebx
+  80270c:	83 ec 34             	sub    $0x34,%esp
+  80270f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802712:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802715:	50                   	push   %eax
+  802716:	ff 75 08             	push   0x8(%ebp)
+  802719:	e8 78 e9 ff ff       	call   801096 <fd_lookup>
+  80271e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802721:	83 c4 10             	add    $0x10,%esp
+  802724:	85 c0                	test   %eax,%eax
+  802726:	0f 88 d7 00 00 00    	js     802803 <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  80272c:	83 ec 0c             	sub    $0xc,%esp
+  80272f:	ff 75 e4             	push   -0x1c(%ebp)
+  802732:	e8 f5 e8 ff ff       	call   80102c <fd2data>
+  802737:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802739:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80273c:	83 c4 10             	add    $0x10,%esp
+  80273f:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802745:	39 10                	cmp    %edx,(%eax)
+  802747:	0f 85 c1 00 00 00    	jne    80280e <pipe_splice+0x108>
+  80274d:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  802751:	0f 84 c0 00 00 00    	je     802817 <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  802757:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  80275b:	0f 84 bf 00 00 00    	je     802820 <pipe_splice+0x11a>
+  802761:	89 f7                	mov    %esi,%edi
+  802763:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  802769:	0f 85 ba 00 00 00    	jne    802829 <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  80276f:	8d 43 04             	lea    0x4(%ebx),%eax
+  802772:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802775:	eb 38                	jmp    8027af <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802777:	83 ec 0c             	sub    $0xc,%esp
+  80277a:	68 00 10 00 00       	push   $0x1000
+  80277f:	89 f1                	mov    %esi,%ecx
+  802781:	89 da                	mov    %ebx,%edx
+  802783:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802786:	e8 34 fa ff ff       	call   8021bf <devpipe_write_bulk>
+  80278b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80278e:	83 c4 10             	add    $0x10,%esp
+  802791:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802796:	75 53                	jne    8027eb <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  802798:	83 ec 08             	sub    $0x8,%esp
+  80279b:	56                   	push   %esi
+  80279c:	6a 00                	push   $0x0
+  80279e:	e8 4f e4 ff ff       	call   800bf2 <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  8027a3:	83 c7 01             	add    $0x1,%edi
+  8027a6:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8027ac:	83 c4 10             	add    $0x10,%esp
+  8027af:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8027b2:	74 3a                	je     8027ee <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  8027b4:	8b 03                	mov    (%ebx),%eax
+  8027b6:	39 43 04             	cmp    %eax,0x4(%ebx)
+  8027b9:	75 bc                	jne    802777 <pipe_splice+0x71>
+  8027bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027c0:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  8027c4:	85 c0                	test   %eax,%eax
+  8027c6:	74 af                	je     802777 <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  8027c8:	83 ec 04             	sub    $0x4,%esp
+  8027cb:	6a 07                	push   $0x7
+  8027cd:	56                   	push   %esi
+  8027ce:	ff 75 d0             	push   -0x30(%ebp)
+  8027d1:	e8 f3 e6 ff ff       	call   800ec9 <sys_chan_wakeup>
+  8027d6:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8027d9:	83 c4 10             	add    $0x10,%esp
+  8027dc:	85 c0                	test   %eax,%eax
+  8027de:	79 b8                	jns    802798 <pipe_splice+0x92>
+  8027e0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8027e5:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  8027e9:	eb 8c                	jmp    802777 <pipe_splice+0x71>
+  8027eb:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  8027ee:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8027f2:	75 06                	jne    8027fa <pipe_splice+0xf4>
+  8027f4:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  8027f8:	78 09                	js     802803 <pipe_splice+0xfd>
+  return i * PGSIZE;
+  8027fa:	8b 45 10             	mov    0x10(%ebp),%eax
+  8027fd:	c1 e0 0c             	shl    $0xc,%eax
+  802800:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  802803:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802806:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802809:	5b                   	pop    %ebx
+  80280a:	5e                   	pop    %esi
+  80280b:	5f                   	pop    %edi
+  80280c:	5d                   	pop    %ebp
+  80280d:	c3                   	ret
+    return -E_INVAL;
+  80280e:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802815:	eb ec                	jmp    802803 <pipe_splice+0xfd>
+  802817:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  80281e:	eb e3                	jmp    802803 <pipe_splice+0xfd>
+  802820:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802827:	eb da                	jmp    802803 <pipe_splice+0xfd>
+  802829:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802830:	eb d1                	jmp    802803 <pipe_splice+0xfd>
+
+00802832 <pipe_splice_read>:
+{
+  802832:	55                   	push   %ebp
+  802833:	89 e5                	mov    %esp,%ebp
+  802835:	53                   	push   %ebx
+  802836:	83 ec 1c             	sub    $0x1c,%esp
+  802839:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80283c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80283f:	50                   	push   %eax
+  802840:	ff 75 08             	push   0x8(%ebp)
+  802843:	e8 4e e8 ff ff       	call   801096 <fd_lookup>
+  802848:	83 c4 10             	add    $0x10,%esp
+  80284b:	85 c0                	test   %eax,%eax
+  80284d:	78 49                	js     802898 <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  80284f:	83 ec 0c             	sub    $0xc,%esp
+  802852:	ff 75 f4             	push   -0xc(%ebp)
+  802855:	e8 d2 e7 ff ff       	call   80102c <fd2data>
+  80285a:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  80285c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80285f:	83 c4 10             	add    $0x10,%esp
+  802862:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  802868:	39 08                	cmp    %ecx,(%eax)
+  80286a:	75 31                	jne    80289d <pipe_splice_read+0x6b>
+  80286c:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  802870:	74 32                	je     8028a4 <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  802872:	8b 48 08             	mov    0x8(%eax),%ecx
+  802875:	83 e1 03             	and    $0x3,%ecx
+  802878:	83 f9 01             	cmp    $0x1,%ecx
+  80287b:	74 2e                	je     8028ab <pipe_splice_read+0x79>
+  80287d:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  802883:	75 2d                	jne    8028b2 <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  802885:	83 ec 08             	sub    $0x8,%esp
+  802888:	53                   	push   %ebx
+  802889:	68 00 10 00 00       	push   $0x1000
+  80288e:	89 d9                	mov    %ebx,%ecx
+  802890:	e8 93 fa ff ff       	call   802328 <devpipe_read_bulk>
+  802895:	83 c4 10             	add    $0x10,%esp
+}
+  802898:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80289b:	c9                   	leave
+  80289c:	c3                   	ret
+    return -E_INVAL;
+  80289d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028a2:	eb f4                	jmp    802898 <pipe_splice_read+0x66>
+  8028a4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028a9:	eb ed                	jmp    802898 <pipe_splice_read+0x66>
+  8028ab:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028b0:	eb e6                	jmp    802898 <pipe_splice_read+0x66>
+  8028b2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028b7:	eb df                	jmp    802898 <pipe_splice_read+0x66>
+
+008028b9 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  8028b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028be:	c3                   	ret
+
+008028bf <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8028bf:	55                   	push   %ebp
+  8028c0:	89 e5                	mov    %esp,%ebp
+  8028c2:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  8028c5:	68 e7 32 80 00       	push   $0x8032e7
+  8028ca:	ff 75 0c             	push   0xc(%ebp)
+  8028cd:	e8 6c de ff ff       	call   80073e <strcpy>
+  return 0;
+}
+  8028d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028d7:	c9                   	leave
+  8028d8:	c3                   	ret
+
+008028d9 <devcons_write>:
+{
+  8028d9:	55                   	push   %ebp
+  8028da:	89 e5                	mov    %esp,%ebp
+  8028dc:	57                   	push   %edi
+  8028dd:	56                   	push   %esi
+  8028de:	53                   	push   %ebx
+  8028df:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  8028e5:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  8028ea:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  8028f0:	eb 2e                	jmp    802920 <devcons_write+0x47>
+    m = n - tot;
+  8028f2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8028f5:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  8028f7:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8028fc:	39 c3                	cmp    %eax,%ebx
+  8028fe:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  802901:	83 ec 04             	sub    $0x4,%esp
+  802904:	53                   	push   %ebx
+  802905:	89 f0                	mov    %esi,%eax
+  802907:	03 45 0c             	add    0xc(%ebp),%eax
+  80290a:	50                   	push   %eax
+  80290b:	57                   	push   %edi
+  80290c:	e8 b3 df ff ff       	call   8008c4 <memmove>
+    sys_cputs(buf, m);
+  802911:	83 c4 08             	add    $0x8,%esp
+  802914:	53                   	push   %ebx
+  802915:	57                   	push   %edi
+  802916:	e8 53 e1 ff ff       	call   800a6e <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  80291b:	01 de                	add    %ebx,%esi
+  80291d:	83 c4 10             	add    $0x10,%esp
+  802920:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802923:	72 cd                	jb     8028f2 <devcons_write+0x19>
+}
+  802925:	89 f0                	mov    %esi,%eax
+  802927:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80292a:	5b                   	pop    %ebx
+  80292b:	5e                   	pop    %esi
+  80292c:	5f                   	pop    %edi
+  80292d:	5d                   	pop    %ebp
+  80292e:	c3                   	ret
+
+0080292f <devcons_read>:
+{
+  80292f:	55                   	push   %ebp
+  802930:	89 e5                	mov    %esp,%ebp
+  802932:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  802935:	b8 00 00 00 00       	mov    $0x0,%eax
+  80293a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80293e:	75 07                	jne    802947 <devcons_read+0x18>
+  802940:	eb 1f                	jmp    802961 <devcons_read+0x32>
+    sys_yield();
+  802942:	e8 c4 e1 ff ff       	call   800b0b <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  802947:	e8 40 e1 ff ff       	call   800a8c <sys_cgetc>
+  80294c:	85 c0                	test   %eax,%eax
+  80294e:	74 f2                	je     802942 <devcons_read+0x13>
+  if (c < 0)
+  802950:	78 0f                	js     802961 <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  802952:	83 f8 04             	cmp    $0x4,%eax
+  802955:	74 0c                	je     802963 <devcons_read+0x34>
+  *(char*)vbuf = c;
+  802957:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80295a:	88 02                	mov    %al,(%edx)
+  return 1;
+  80295c:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802961:	c9                   	leave
+  802962:	c3                   	ret
+    return 0;
+  802963:	b8 00 00 00 00       	mov    $0x0,%eax
+  802968:	eb f7                	jmp    802961 <devcons_read+0x32>
+
+0080296a <cputchar>:
+{
+  80296a:	55                   	push   %ebp
+  80296b:	89 e5                	mov    %esp,%ebp
+  80296d:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  802970:	8b 45 08             	mov    0x8(%ebp),%eax
+  802973:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  802976:	6a 01                	push   $0x1
+  802978:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80297b:	50                   	push   %eax
+  80297c:	e8 ed e0 ff ff       	call   800a6e <sys_cputs>
+}
+  802981:	83 c4 10             	add    $0x10,%esp
+  802984:	c9                   	leave
+  802985:	c3                   	ret
+
+00802986 <getchar>:
+{
+  802986:	55                   	push   %ebp
+  802987:	89 e5                	mov    %esp,%ebp
+  802989:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  80298c:	6a 01                	push   $0x1
+  80298e:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802991:	50                   	push   %eax
+  802992:	6a 00                	push   $0x0
+  802994:	e8 a8 e9 ff ff       	call   801341 <read>
+  if (r < 0)
+  802999:	83 c4 10             	add    $0x10,%esp
+  80299c:	85 c0                	test   %eax,%eax
+  80299e:	78 06                	js     8029a6 <getchar+0x20>
+  if (r < 1)
+  8029a0:	74 06                	je     8029a8 <getchar+0x22>
+  return c;
+  8029a2:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8029a6:	c9                   	leave
+  8029a7:	c3                   	ret
+    return -E_EOF;
+  8029a8:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8029ad:	eb f7                	jmp    8029a6 <getchar+0x20>
+
+008029af <iscons>:
+{
+  8029af:	55                   	push   %ebp
+  8029b0:	89 e5                	mov    %esp,%ebp
+  8029b2:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8029b5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8029b8:	50                   	push   %eax
+  8029b9:	ff 75 08             	push   0x8(%ebp)
+  8029bc:	e8 d5 e6 ff ff       	call   801096 <fd_lookup>
+  8029c1:	83 c4 10             	add    $0x10,%esp
+  8029c4:	85 c0                	test   %eax,%eax
+  8029c6:	78 11                	js     8029d9 <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  8029c8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029cb:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  8029d1:	39 10                	cmp    %edx,(%eax)
+  8029d3:	0f 94 c0             	sete   %al
+  8029d6:	0f b6 c0             	movzbl %al,%eax
+}
+  8029d9:	c9                   	leave
+  8029da:	c3                   	ret
+
+008029db <opencons>:
+{
+  8029db:	55                   	push   %ebp
+  8029dc:	89 e5                	mov    %esp,%ebp
+  8029de:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  8029e1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8029e4:	50                   	push   %eax
+  8029e5:	e8 56 e6 ff ff       	call   801040 <fd_alloc>
+  8029ea:	83 c4 10             	add    $0x10,%esp
+  8029ed:	85 c0                	test   %eax,%eax
+  8029ef:	78 3a                	js     802a2b <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8029f1:	83 ec 04             	sub    $0x4,%esp
+  8029f4:	68 07 04 00 00       	push   $0x407
+  8029f9:	ff 75 f4             	push   -0xc(%ebp)
+  8029fc:	6a 00                	push   $0x0
+  8029fe:	e8 6a e1 ff ff       	call   800b6d <sys_page_alloc>
+  802a03:	83 c4 10             	add    $0x10,%esp
+  802a06:	85 c0                	test   %eax,%eax
+  802a08:	78 21                	js     802a2b <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  802a0a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a0d:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802a13:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  802a15:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a18:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  802a1f:	83 ec 0c             	sub    $0xc,%esp
+  802a22:	50                   	push   %eax
+  802a23:	e8 f4 e5 ff ff       	call   80101c <fd2num>
+  802a28:	83 c4 10             	add    $0x10,%esp
+}
+  802a2b:	c9                   	leave
+  802a2c:	c3                   	ret
+
+00802a2d <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  802a2d:	55                   	push   %ebp
+  802a2e:	89 e5                	mov    %esp,%ebp
+  802a30:	56                   	push   %esi
+  802a31:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  802a32:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  802a35:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  802a3b:	e8 ac e0 ff ff       	call   800aec <sys_getenvid>
+  802a40:	83 ec 0c             	sub    $0xc,%esp
+  802a43:	ff 75 0c             	push   0xc(%ebp)
+  802a46:	ff 75 08             	push   0x8(%ebp)
+  802a49:	56                   	push   %esi
+  802a4a:	50                   	push   %eax
+  802a4b:	68 f4 32 80 00       	push   $0x8032f4
+  802a50:	e8 fb d6 ff ff       	call   800150 <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  802a55:	83 c4 18             	add    $0x18,%esp
+  802a58:	53                   	push   %ebx
+  802a59:	ff 75 10             	push   0x10(%ebp)
+  802a5c:	e8 9e d6 ff ff       	call   8000ff <vcprintf>
+  cprintf("\n");
+  802a61:	c7 04 24 7c 2e 80 00 	movl   $0x802e7c,(%esp)
+  802a68:	e8 e3 d6 ff ff       	call   800150 <cprintf>
+  802a6d:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  802a70:	cc                   	int3
+  while (1)
+  802a71:	eb fd                	jmp    802a70 <_panic+0x43>
+
+00802a73 <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  802a73:	55                   	push   %ebp
+  802a74:	89 e5                	mov    %esp,%ebp
+  802a76:	57                   	push   %edi
+  802a77:	56                   	push   %esi
+  802a78:	53                   	push   %ebx
+  802a79:	83 ec 14             	sub    $0x14,%esp
+  802a7c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802a7f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a82:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802a85:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  802a88:	85 c0                	test   %eax,%eax
+  802a8a:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802a8f:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  802a92:	ff 33                	push   (%ebx)
+  802a94:	50                   	push   %eax
+  802a95:	e8 ab e3 ff ff       	call   800e45 <sys_ipc_recv>
+  802a9a:	83 c4 10             	add    $0x10,%esp
+  802a9d:	85 c0                	test   %eax,%eax
+  802a9f:	78 39                	js     802ada <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  802aa1:	85 ff                	test   %edi,%edi
+  802aa3:	74 0a                	je     802aaf <ipc_recv_pages+0x3c>
+  802aa5:	a1 44 57 80 00       	mov    0x805744,%eax
+  802aaa:	8b 40 7c             	mov    0x7c(%eax),%eax
+  802aad:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  802aaf:	85 f6                	test   %esi,%esi
+  802ab1:	74 0d                	je     802ac0 <ipc_recv_pages+0x4d>
+  802ab3:	a1 44 57 80 00       	mov    0x805744,%eax
+  802ab8:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  802abe:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  802ac0:	a1 44 57 80 00       	mov    0x805744,%eax
+  802ac5:	8b 40 74             	mov    0x74(%eax),%eax
+  802ac8:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  802aca:	a1 44 57 80 00       	mov    0x805744,%eax
+  802acf:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  802ad2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ad5:	5b                   	pop    %ebx
+  802ad6:	5e                   	pop    %esi
+  802ad7:	5f                   	pop    %edi
+  802ad8:	5d                   	pop    %ebp
+  802ad9:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  802ada:	85 ff                	test   %edi,%edi
+  802adc:	74 06                	je     802ae4 <ipc_recv_pages+0x71>
+  802ade:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  802ae4:	85 f6                	test   %esi,%esi
+  802ae6:	74 06                	je     802aee <ipc_recv_pages+0x7b>
+  802ae8:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  802aee:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  802af4:	eb dc                	jmp    802ad2 <ipc_recv_pages+0x5f>
+
+00802af6 <ipc_recv>:
+{
+  802af6:	55                   	push   %ebp
+  802af7:	89 e5                	mov    %esp,%ebp
+  802af9:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  802afc:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  802b03:	ff 75 10             	push   0x10(%ebp)
+  802b06:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b09:	50                   	push   %eax
+  802b0a:	ff 75 0c             	push   0xc(%ebp)
+  802b0d:	ff 75 08             	push   0x8(%ebp)
+  802b10:	e8 5e ff ff ff       	call   802a73 <ipc_recv_pages>
+}
+  802b15:	c9                   	leave
+  802b16:	c3                   	ret
+
+00802b17 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  802b17:	55                   	push   %ebp
+  802b18:	89 e5                	mov    %esp,%ebp
+  802b1a:	57                   	push   %edi
+  802b1b:	56                   	push   %esi
+  802b1c:	53                   	push   %ebx
+  802b1d:	83 ec 0c             	sub    $0xc,%esp
+  802b20:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802b23:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802b26:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  802b29:	89 c3                	mov    %eax,%ebx
+  802b2b:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  802b31:	85 c0                	test   %eax,%eax
+  802b33:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802b38:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  802b3b:	83 ec 0c             	sub    $0xc,%esp
+  802b3e:	ff 75 14             	push   0x14(%ebp)
+  802b41:	ff 75 18             	push   0x18(%ebp)
+  802b44:	53                   	push   %ebx
+  802b45:	56                   	push   %esi
+  802b46:	57                   	push   %edi
+  802b47:	e8 d8 e2 ff ff       	call   800e24 <sys_ipc_try_send>
+  802b4c:	83 c4 20             	add    $0x20,%esp
+  802b4f:	85 c0                	test   %eax,%eax
+  802b51:	79 1e                	jns    802b71 <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  802b53:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802b56:	75 07                	jne    802b5f <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  802b58:	e8 ae df ff ff       	call   800b0b <sys_yield>
+  802b5d:	eb dc                	jmp    802b3b <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  802b5f:	50                   	push   %eax
+  802b60:	68 17 33 80 00       	push   $0x803317
+  802b65:	6a 5c                	push   $0x5c
+  802b67:	68 24 33 80 00       	push   $0x803324
+  802b6c:	e8 bc fe ff ff       	call   802a2d <_panic>
+  }
+}
+  802b71:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b74:	5b                   	pop    %ebx
+  802b75:	5e                   	pop    %esi
+  802b76:	5f                   	pop    %edi
+  802b77:	5d                   	pop    %ebp
+  802b78:	c3                   	ret
+
+00802b79 <ipc_send>:
+{
+  802b79:	55                   	push   %ebp
+  802b7a:	89 e5                	mov    %esp,%ebp
+  802b7c:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  802b7f:	ff 75 14             	push   0x14(%ebp)
+  802b82:	6a 01                	push   $0x1
+  802b84:	ff 75 10             	push   0x10(%ebp)
+  802b87:	ff 75 0c             	push   0xc(%ebp)
+  802b8a:	ff 75 08             	push   0x8(%ebp)
+  802b8d:	e8 85 ff ff ff       	call   802b17 <ipc_send_pages>
+}
+  802b92:	83 c4 20             	add    $0x20,%esp
+  802b95:	c9                   	leave
+  802b96:	c3                   	ret
+
+00802b97 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802b97:	55                   	push   %ebp
+  802b98:	89 e5                	mov    %esp,%ebp
+  802b9a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  802b9d:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  802ba2:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802ba5:	c1 e0 04             	shl    $0x4,%eax
+  802ba8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802bad:	8b 40 50             	mov    0x50(%eax),%eax
+  802bb0:	39 c8                	cmp    %ecx,%eax
+  802bb2:	74 12                	je     802bc6 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  802bb4:	83 c2 01             	add    $0x1,%edx
+  802bb7:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802bbd:	75 e3                	jne    802ba2 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  802bbf:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bc4:	eb 0e                	jmp    802bd4 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  802bc6:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802bc9:	c1 e0 04             	shl    $0x4,%eax
+  802bcc:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802bd1:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802bd4:	5d                   	pop    %ebp
+  802bd5:	c3                   	ret
+
+00802bd6 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802bd6:	55                   	push   %ebp
+  802bd7:	89 e5                	mov    %esp,%ebp
+  802bd9:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802bdc:	89 c2                	mov    %eax,%edx
+  802bde:	c1 ea 16             	shr    $0x16,%edx
+  802be1:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  802be8:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802bed:	f6 c1 01             	test   $0x1,%cl
+  802bf0:	74 1c                	je     802c0e <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  802bf2:	c1 e8 0c             	shr    $0xc,%eax
+  802bf5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  802bfc:	a8 01                	test   $0x1,%al
+  802bfe:	74 0e                	je     802c0e <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  802c00:	c1 e8 0c             	shr    $0xc,%eax
+  802c03:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802c0a:	ef 
+  802c0b:	0f b7 d2             	movzwl %dx,%edx
+}
+  802c0e:	89 d0                	mov    %edx,%eax
+  802c10:	5d                   	pop    %ebp
+  802c11:	c3                   	ret
+
+00802c12 <udivmod>:
+  802c12:	55                   	push   %ebp
+  802c13:	57                   	push   %edi
+  802c14:	56                   	push   %esi
+  802c15:	53                   	push   %ebx
+  802c16:	83 ec 14             	sub    $0x14,%esp
+  802c19:	8b 74 24 28          	mov    0x28(%esp),%esi
+  802c1d:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  802c21:	89 fb                	mov    %edi,%ebx
+  802c23:	09 f3                	or     %esi,%ebx
+  802c25:	0f 84 88 00 00 00    	je     802cb3 <udivmod+0xa1>
+  802c2b:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802c30:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802c37:	00 
+  802c38:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802c3f:	00 
+  802c40:	89 cd                	mov    %ecx,%ebp
+  802c42:	89 34 24             	mov    %esi,(%esp)
+  802c45:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802c49:	eb 08                	jmp    802c53 <udivmod+0x41>
+  802c4b:	83 ed 01             	sub    $0x1,%ebp
+  802c4e:	83 fd ff             	cmp    $0xffffffff,%ebp
+  802c51:	74 6c                	je     802cbf <udivmod+0xad>
+  802c53:	89 c3                	mov    %eax,%ebx
+  802c55:	89 d6                	mov    %edx,%esi
+  802c57:	89 e9                	mov    %ebp,%ecx
+  802c59:	0f ad f3             	shrd   %cl,%esi,%ebx
+  802c5c:	d3 ee                	shr    %cl,%esi
+  802c5e:	f6 c1 20             	test   $0x20,%cl
+  802c61:	74 04                	je     802c67 <udivmod+0x55>
+  802c63:	89 f3                	mov    %esi,%ebx
+  802c65:	31 f6                	xor    %esi,%esi
+  802c67:	8b 3c 24             	mov    (%esp),%edi
+  802c6a:	39 fb                	cmp    %edi,%ebx
+  802c6c:	89 f7                	mov    %esi,%edi
+  802c6e:	8b 1c 24             	mov    (%esp),%ebx
+  802c71:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802c75:	19 f7                	sbb    %esi,%edi
+  802c77:	72 d2                	jb     802c4b <udivmod+0x39>
+  802c79:	89 f7                	mov    %esi,%edi
+  802c7b:	89 de                	mov    %ebx,%esi
+  802c7d:	89 e9                	mov    %ebp,%ecx
+  802c7f:	0f a5 f7             	shld   %cl,%esi,%edi
+  802c82:	d3 e6                	shl    %cl,%esi
+  802c84:	f6 c1 20             	test   $0x20,%cl
+  802c87:	74 04                	je     802c8d <udivmod+0x7b>
+  802c89:	89 f7                	mov    %esi,%edi
+  802c8b:	31 f6                	xor    %esi,%esi
+  802c8d:	29 f0                	sub    %esi,%eax
+  802c8f:	19 fa                	sbb    %edi,%edx
+  802c91:	be 01 00 00 00       	mov    $0x1,%esi
+  802c96:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c9b:	0f a5 f7             	shld   %cl,%esi,%edi
+  802c9e:	d3 e6                	shl    %cl,%esi
+  802ca0:	f6 c1 20             	test   $0x20,%cl
+  802ca3:	74 04                	je     802ca9 <udivmod+0x97>
+  802ca5:	89 f7                	mov    %esi,%edi
+  802ca7:	31 f6                	xor    %esi,%esi
+  802ca9:	09 74 24 08          	or     %esi,0x8(%esp)
+  802cad:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802cb1:	eb 98                	jmp    802c4b <udivmod+0x39>
+  802cb3:	89 f0                	mov    %esi,%eax
+  802cb5:	89 fa                	mov    %edi,%edx
+  802cb7:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802cbb:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802cbf:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802cc3:	89 01                	mov    %eax,(%ecx)
+  802cc5:	89 51 04             	mov    %edx,0x4(%ecx)
+  802cc8:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802ccc:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802cd0:	83 c4 14             	add    $0x14,%esp
+  802cd3:	5b                   	pop    %ebx
+  802cd4:	5e                   	pop    %esi
+  802cd5:	5f                   	pop    %edi
+  802cd6:	5d                   	pop    %ebp
+  802cd7:	c3                   	ret
+
+00802cd8 <__udivdi3>:
+  802cd8:	83 ec 18             	sub    $0x18,%esp
+  802cdb:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802cdf:	50                   	push   %eax
+  802ce0:	ff 74 24 2c          	push   0x2c(%esp)
+  802ce4:	ff 74 24 2c          	push   0x2c(%esp)
+  802ce8:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802cec:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802cf0:	e8 1d ff ff ff       	call   802c12 <udivmod>
+  802cf5:	83 c4 24             	add    $0x24,%esp
+  802cf8:	c3                   	ret
+
+00802cf9 <__umoddi3>:
+  802cf9:	83 ec 18             	sub    $0x18,%esp
+  802cfc:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802d00:	50                   	push   %eax
+  802d01:	ff 74 24 2c          	push   0x2c(%esp)
+  802d05:	ff 74 24 2c          	push   0x2c(%esp)
+  802d09:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802d0d:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802d11:	e8 fc fe ff ff       	call   802c12 <udivmod>
+  802d16:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802d1a:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802d1e:	83 c4 24             	add    $0x24,%esp
+  802d21:	c3                   	ret
+
+00802d22 <__divdi3>:
+  802d22:	56                   	push   %esi
+  802d23:	53                   	push   %ebx
+  802d24:	83 ec 14             	sub    $0x14,%esp
+  802d27:	8b 44 24 20          	mov    0x20(%esp),%eax
+  802d2b:	8b 54 24 24          	mov    0x24(%esp),%edx
+  802d2f:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  802d33:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  802d37:	85 d2                	test   %edx,%edx
+  802d39:	78 18                	js     802d53 <__divdi3+0x31>
+  802d3b:	85 db                	test   %ebx,%ebx
+  802d3d:	78 3e                	js     802d7d <__divdi3+0x5b>
+  802d3f:	83 ec 04             	sub    $0x4,%esp
+  802d42:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802d46:	56                   	push   %esi
+  802d47:	53                   	push   %ebx
+  802d48:	51                   	push   %ecx
+  802d49:	e8 c4 fe ff ff       	call   802c12 <udivmod>
+  802d4e:	83 c4 10             	add    $0x10,%esp
+  802d51:	eb 24                	jmp    802d77 <__divdi3+0x55>
+  802d53:	f7 d8                	neg    %eax
+  802d55:	83 d2 00             	adc    $0x0,%edx
+  802d58:	f7 da                	neg    %edx
+  802d5a:	85 db                	test   %ebx,%ebx
+  802d5c:	78 3a                	js     802d98 <__divdi3+0x76>
+  802d5e:	83 ec 04             	sub    $0x4,%esp
+  802d61:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802d65:	56                   	push   %esi
+  802d66:	53                   	push   %ebx
+  802d67:	51                   	push   %ecx
+  802d68:	e8 a5 fe ff ff       	call   802c12 <udivmod>
+  802d6d:	83 c4 10             	add    $0x10,%esp
+  802d70:	f7 d8                	neg    %eax
+  802d72:	83 d2 00             	adc    $0x0,%edx
+  802d75:	f7 da                	neg    %edx
+  802d77:	83 c4 14             	add    $0x14,%esp
+  802d7a:	5b                   	pop    %ebx
+  802d7b:	5e                   	pop    %esi
+  802d7c:	c3                   	ret
+  802d7d:	83 ec 04             	sub    $0x4,%esp
+  802d80:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802d84:	56                   	push   %esi
+  802d85:	f7 d9                	neg    %ecx
+  802d87:	83 d3 00             	adc    $0x0,%ebx
+  802d8a:	f7 db                	neg    %ebx
+  802d8c:	53                   	push   %ebx
+  802d8d:	51                   	push   %ecx
+  802d8e:	e8 7f fe ff ff       	call   802c12 <udivmod>
+  802d93:	83 c4 10             	add    $0x10,%esp
+  802d96:	eb d8                	jmp    802d70 <__divdi3+0x4e>
+  802d98:	83 ec 04             	sub    $0x4,%esp
+  802d9b:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802d9f:	56                   	push   %esi
+  802da0:	f7 d9                	neg    %ecx
+  802da2:	83 d3 00             	adc    $0x0,%ebx
+  802da5:	f7 db                	neg    %ebx
+  802da7:	53                   	push   %ebx
+  802da8:	51                   	push   %ecx
+  802da9:	e8 64 fe ff ff       	call   802c12 <udivmod>
+  802dae:	83 c4 10             	add    $0x10,%esp
+  802db1:	eb c4                	jmp    802d77 <__divdi3+0x55>
+
+00802db3 <__moddi3>:
+  802db3:	55                   	push   %ebp
+  802db4:	57                   	push   %edi
+  802db5:	56                   	push   %esi
+  802db6:	53                   	push   %ebx
+  802db7:	83 ec 24             	sub    $0x24,%esp
+  802dba:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802dbe:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802dc2:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  802dc6:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  802dca:	85 d2                	test   %edx,%edx
+  802dcc:	78 3b                	js     802e09 <__moddi3+0x56>
+  802dce:	83 ec 04             	sub    $0x4,%esp
+  802dd1:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  802dd5:	56                   	push   %esi
+  802dd6:	89 ce                	mov    %ecx,%esi
+  802dd8:	f7 de                	neg    %esi
+  802dda:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802dde:	89 de                	mov    %ebx,%esi
+  802de0:	83 d6 00             	adc    $0x0,%esi
+  802de3:	f7 de                	neg    %esi
+  802de5:	89 74 24 14          	mov    %esi,0x14(%esp)
+  802de9:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802ded:	0f 48 f1             	cmovs  %ecx,%esi
+  802df0:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  802df5:	53                   	push   %ebx
+  802df6:	56                   	push   %esi
+  802df7:	e8 16 fe ff ff       	call   802c12 <udivmod>
+  802dfc:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802e00:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802e04:	83 c4 10             	add    $0x10,%esp
+  802e07:	eb 47                	jmp    802e50 <__moddi3+0x9d>
+  802e09:	f7 d8                	neg    %eax
+  802e0b:	83 d2 00             	adc    $0x0,%edx
+  802e0e:	f7 da                	neg    %edx
+  802e10:	83 ec 04             	sub    $0x4,%esp
+  802e13:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  802e17:	56                   	push   %esi
+  802e18:	89 cf                	mov    %ecx,%edi
+  802e1a:	f7 df                	neg    %edi
+  802e1c:	89 de                	mov    %ebx,%esi
+  802e1e:	83 d6 00             	adc    $0x0,%esi
+  802e21:	f7 de                	neg    %esi
+  802e23:	0f 49 cf             	cmovns %edi,%ecx
+  802e26:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802e2a:	0f 49 de             	cmovns %esi,%ebx
+  802e2d:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  802e31:	ff 74 24 0c          	push   0xc(%esp)
+  802e35:	ff 74 24 0c          	push   0xc(%esp)
+  802e39:	e8 d4 fd ff ff       	call   802c12 <udivmod>
+  802e3e:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802e42:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802e46:	f7 d8                	neg    %eax
+  802e48:	83 d2 00             	adc    $0x0,%edx
+  802e4b:	f7 da                	neg    %edx
+  802e4d:	83 c4 10             	add    $0x10,%esp
+  802e50:	83 c4 24             	add    $0x24,%esp
+  802e53:	5b                   	pop    %ebx
+  802e54:	5e                   	pop    %esi
+  802e55:	5f                   	pop    %edi
+  802e56:	5d                   	pop    %ebp
+  802e57:	c3                   	ret
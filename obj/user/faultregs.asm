@@ -0,0 +1,6910 @@
+
+obj/user/faultregs.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 aa 05 00 00       	call   8005db <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <check_regs>:
+static struct regs before, during, after;
+
+static void
+check_regs(struct regs* a, const char *an, struct regs* b, const char *bn,
+           const char *testname)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 0c             	sub    $0xc,%esp
+  80003c:	89 c6                	mov    %eax,%esi
+  80003e:	89 cb                	mov    %ecx,%ebx
+  int mismatch = 0;
+
+  cprintf("%-6s %-8s %-8s\n", "", an, bn);
+  800040:	ff 75 08             	push   0x8(%ebp)
+  800043:	52                   	push   %edx
+  800044:	68 91 34 80 00       	push   $0x803491
+  800049:	68 60 34 80 00       	push   $0x803460
+  80004e:	e8 d0 06 00 00       	call   800723 <cprintf>
+      cprintf("MISMATCH\n");                          \
+      mismatch = 1;                                   \
+    }                                                       \
+  } while (0)
+
+  CHECK(edi, regs.reg_edi);
+  800053:	ff 33                	push   (%ebx)
+  800055:	ff 36                	push   (%esi)
+  800057:	68 70 34 80 00       	push   $0x803470
+  80005c:	68 74 34 80 00       	push   $0x803474
+  800061:	e8 bd 06 00 00       	call   800723 <cprintf>
+  800066:	83 c4 20             	add    $0x20,%esp
+  800069:	8b 03                	mov    (%ebx),%eax
+  80006b:	39 06                	cmp    %eax,(%esi)
+  80006d:	0f 84 2e 02 00 00    	je     8002a1 <check_regs+0x26e>
+  800073:	83 ec 0c             	sub    $0xc,%esp
+  800076:	68 88 34 80 00       	push   $0x803488
+  80007b:	e8 a3 06 00 00       	call   800723 <cprintf>
+  800080:	83 c4 10             	add    $0x10,%esp
+  800083:	bf 01 00 00 00       	mov    $0x1,%edi
+  CHECK(esi, regs.reg_esi);
+  800088:	ff 73 04             	push   0x4(%ebx)
+  80008b:	ff 76 04             	push   0x4(%esi)
+  80008e:	68 92 34 80 00       	push   $0x803492
+  800093:	68 74 34 80 00       	push   $0x803474
+  800098:	e8 86 06 00 00       	call   800723 <cprintf>
+  80009d:	83 c4 10             	add    $0x10,%esp
+  8000a0:	8b 43 04             	mov    0x4(%ebx),%eax
+  8000a3:	39 46 04             	cmp    %eax,0x4(%esi)
+  8000a6:	0f 84 0f 02 00 00    	je     8002bb <check_regs+0x288>
+  8000ac:	83 ec 0c             	sub    $0xc,%esp
+  8000af:	68 88 34 80 00       	push   $0x803488
+  8000b4:	e8 6a 06 00 00       	call   800723 <cprintf>
+  8000b9:	83 c4 10             	add    $0x10,%esp
+  8000bc:	bf 01 00 00 00       	mov    $0x1,%edi
+  CHECK(ebp, regs.reg_ebp);
+  8000c1:	ff 73 08             	push   0x8(%ebx)
+  8000c4:	ff 76 08             	push   0x8(%esi)
+  8000c7:	68 96 34 80 00       	push   $0x803496
+  8000cc:	68 74 34 80 00       	push   $0x803474
+  8000d1:	e8 4d 06 00 00       	call   800723 <cprintf>
+  8000d6:	83 c4 10             	add    $0x10,%esp
+  8000d9:	8b 43 08             	mov    0x8(%ebx),%eax
+  8000dc:	39 46 08             	cmp    %eax,0x8(%esi)
+  8000df:	0f 84 eb 01 00 00    	je     8002d0 <check_regs+0x29d>
+  8000e5:	83 ec 0c             	sub    $0xc,%esp
+  8000e8:	68 88 34 80 00       	push   $0x803488
+  8000ed:	e8 31 06 00 00       	call   800723 <cprintf>
+  8000f2:	83 c4 10             	add    $0x10,%esp
+  8000f5:	bf 01 00 00 00       	mov    $0x1,%edi
+  CHECK(ebx, regs.reg_ebx);
+  8000fa:	ff 73 10             	push   0x10(%ebx)
+  8000fd:	ff 76 10             	push   0x10(%esi)
+  800100:	68 9a 34 80 00       	push   $0x80349a
+  800105:	68 74 34 80 00       	push   $0x803474
+  80010a:	e8 14 06 00 00       	call   800723 <cprintf>
+  80010f:	83 c4 10             	add    $0x10,%esp
+  800112:	8b 43 10             	mov    0x10(%ebx),%eax
+  800115:	39 46 10             	cmp    %eax,0x10(%esi)
+  800118:	0f 84 c7 01 00 00    	je     8002e5 <check_regs+0x2b2>
+  80011e:	83 ec 0c             	sub    $0xc,%esp
+  800121:	68 88 34 80 00       	push   $0x803488
+  800126:	e8 f8 05 00 00       	call   800723 <cprintf>
+  80012b:	83 c4 10             	add    $0x10,%esp
+  80012e:	bf 01 00 00 00       	mov    $0x1,%edi
+  CHECK(edx, regs.reg_edx);
+  800133:	ff 73 14             	push   0x14(%ebx)
+  800136:	ff 76 14             	push   0x14(%esi)
+  800139:	68 9e 34 80 00       	push   $0x80349e
+  80013e:	68 74 34 80 00       	push   $0x803474
+  800143:	e8 db 05 00 00       	call   800723 <cprintf>
+  800148:	83 c4 10             	add    $0x10,%esp
+  80014b:	8b 43 14             	mov    0x14(%ebx),%eax
+  80014e:	39 46 14             	cmp    %eax,0x14(%esi)
+  800151:	0f 84 a3 01 00 00    	je     8002fa <check_regs+0x2c7>
+  800157:	83 ec 0c             	sub    $0xc,%esp
+  80015a:	68 88 34 80 00       	push   $0x803488
+  80015f:	e8 bf 05 00 00       	call   800723 <cprintf>
+  800164:	83 c4 10             	add    $0x10,%esp
+  800167:	bf 01 00 00 00       	mov    $0x1,%edi
+  CHECK(ecx, regs.reg_ecx);
+  80016c:	ff 73 18             	push   0x18(%ebx)
+  80016f:	ff 76 18             	push   0x18(%esi)
+  800172:	68 a2 34 80 00       	push   $0x8034a2
+  800177:	68 74 34 80 00       	push   $0x803474
+  80017c:	e8 a2 05 00 00       	call   800723 <cprintf>
+  800181:	83 c4 10             	add    $0x10,%esp
+  800184:	8b 43 18             	mov    0x18(%ebx),%eax
+  800187:	39 46 18             	cmp    %eax,0x18(%esi)
+  80018a:	0f 84 7f 01 00 00    	je     80030f <check_regs+0x2dc>
+  800190:	83 ec 0c             	sub    $0xc,%esp
+  800193:	68 88 34 80 00       	push   $0x803488
+  800198:	e8 86 05 00 00       	call   800723 <cprintf>
+  80019d:	83 c4 10             	add    $0x10,%esp
+  8001a0:	bf 01 00 00 00       	mov    $0x1,%edi
+  CHECK(eax, regs.reg_eax);
+  8001a5:	ff 73 1c             	push   0x1c(%ebx)
+  8001a8:	ff 76 1c             	push   0x1c(%esi)
+  8001ab:	68 a6 34 80 00       	push   $0x8034a6
+  8001b0:	68 74 34 80 00       	push   $0x803474
+  8001b5:	e8 69 05 00 00       	call   800723 <cprintf>
+  8001ba:	83 c4 10             	add    $0x10,%esp
+  8001bd:	8b 43 1c             	mov    0x1c(%ebx),%eax
+  8001c0:	39 46 1c             	cmp    %eax,0x1c(%esi)
+  8001c3:	0f 84 5b 01 00 00    	je     800324 <check_regs+0x2f1>
+  8001c9:	83 ec 0c             	sub    $0xc,%esp
+  8001cc:	68 88 34 80 00       	push   $0x803488
+  8001d1:	e8 4d 05 00 00       	call   800723 <cprintf>
+  8001d6:	83 c4 10             	add    $0x10,%esp
+  8001d9:	bf 01 00 00 00       	mov    $0x1,%edi
+  CHECK(eip, eip);
+  8001de:	ff 73 20             	push   0x20(%ebx)
+  8001e1:	ff 76 20             	push   0x20(%esi)
+  8001e4:	68 aa 34 80 00       	push   $0x8034aa
+  8001e9:	68 74 34 80 00       	push   $0x803474
+  8001ee:	e8 30 05 00 00       	call   800723 <cprintf>
+  8001f3:	83 c4 10             	add    $0x10,%esp
+  8001f6:	8b 43 20             	mov    0x20(%ebx),%eax
+  8001f9:	39 46 20             	cmp    %eax,0x20(%esi)
+  8001fc:	0f 84 37 01 00 00    	je     800339 <check_regs+0x306>
+  800202:	83 ec 0c             	sub    $0xc,%esp
+  800205:	68 88 34 80 00       	push   $0x803488
+  80020a:	e8 14 05 00 00       	call   800723 <cprintf>
+  80020f:	83 c4 10             	add    $0x10,%esp
+  800212:	bf 01 00 00 00       	mov    $0x1,%edi
+  CHECK(eflags, eflags);
+  800217:	ff 73 24             	push   0x24(%ebx)
+  80021a:	ff 76 24             	push   0x24(%esi)
+  80021d:	68 ae 34 80 00       	push   $0x8034ae
+  800222:	68 74 34 80 00       	push   $0x803474
+  800227:	e8 f7 04 00 00       	call   800723 <cprintf>
+  80022c:	83 c4 10             	add    $0x10,%esp
+  80022f:	8b 43 24             	mov    0x24(%ebx),%eax
+  800232:	39 46 24             	cmp    %eax,0x24(%esi)
+  800235:	0f 84 13 01 00 00    	je     80034e <check_regs+0x31b>
+  80023b:	83 ec 0c             	sub    $0xc,%esp
+  80023e:	68 88 34 80 00       	push   $0x803488
+  800243:	e8 db 04 00 00       	call   800723 <cprintf>
+  CHECK(esp, esp);
+  800248:	ff 73 28             	push   0x28(%ebx)
+  80024b:	ff 76 28             	push   0x28(%esi)
+  80024e:	68 b5 34 80 00       	push   $0x8034b5
+  800253:	68 74 34 80 00       	push   $0x803474
+  800258:	e8 c6 04 00 00       	call   800723 <cprintf>
+  80025d:	83 c4 20             	add    $0x20,%esp
+  800260:	8b 43 28             	mov    0x28(%ebx),%eax
+  800263:	39 46 28             	cmp    %eax,0x28(%esi)
+  800266:	0f 84 53 01 00 00    	je     8003bf <check_regs+0x38c>
+  80026c:	83 ec 0c             	sub    $0xc,%esp
+  80026f:	68 88 34 80 00       	push   $0x803488
+  800274:	e8 aa 04 00 00       	call   800723 <cprintf>
+
+#undef CHECK
+
+  cprintf("Registers %s ", testname);
+  800279:	83 c4 08             	add    $0x8,%esp
+  80027c:	ff 75 0c             	push   0xc(%ebp)
+  80027f:	68 b9 34 80 00       	push   $0x8034b9
+  800284:	e8 9a 04 00 00       	call   800723 <cprintf>
+  800289:	83 c4 10             	add    $0x10,%esp
+  if (!mismatch)
+    cprintf("OK\n");
+  else
+    cprintf("MISMATCH\n");
+  80028c:	83 ec 0c             	sub    $0xc,%esp
+  80028f:	68 88 34 80 00       	push   $0x803488
+  800294:	e8 8a 04 00 00       	call   800723 <cprintf>
+  800299:	83 c4 10             	add    $0x10,%esp
+}
+  80029c:	e9 16 01 00 00       	jmp    8003b7 <check_regs+0x384>
+  CHECK(edi, regs.reg_edi);
+  8002a1:	83 ec 0c             	sub    $0xc,%esp
+  8002a4:	68 84 34 80 00       	push   $0x803484
+  8002a9:	e8 75 04 00 00       	call   800723 <cprintf>
+  8002ae:	83 c4 10             	add    $0x10,%esp
+  int mismatch = 0;
+  8002b1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002b6:	e9 cd fd ff ff       	jmp    800088 <check_regs+0x55>
+  CHECK(esi, regs.reg_esi);
+  8002bb:	83 ec 0c             	sub    $0xc,%esp
+  8002be:	68 84 34 80 00       	push   $0x803484
+  8002c3:	e8 5b 04 00 00       	call   800723 <cprintf>
+  8002c8:	83 c4 10             	add    $0x10,%esp
+  8002cb:	e9 f1 fd ff ff       	jmp    8000c1 <check_regs+0x8e>
+  CHECK(ebp, regs.reg_ebp);
+  8002d0:	83 ec 0c             	sub    $0xc,%esp
+  8002d3:	68 84 34 80 00       	push   $0x803484
+  8002d8:	e8 46 04 00 00       	call   800723 <cprintf>
+  8002dd:	83 c4 10             	add    $0x10,%esp
+  8002e0:	e9 15 fe ff ff       	jmp    8000fa <check_regs+0xc7>
+  CHECK(ebx, regs.reg_ebx);
+  8002e5:	83 ec 0c             	sub    $0xc,%esp
+  8002e8:	68 84 34 80 00       	push   $0x803484
+  8002ed:	e8 31 04 00 00       	call   800723 <cprintf>
+  8002f2:	83 c4 10             	add    $0x10,%esp
+  8002f5:	e9 39 fe ff ff       	jmp    800133 <check_regs+0x100>
+  CHECK(edx, regs.reg_edx);
+  8002fa:	83 ec 0c             	sub    $0xc,%esp
+  8002fd:	68 84 34 80 00       	push   $0x803484
+  800302:	e8 1c 04 00 00       	call   800723 <cprintf>
+  800307:	83 c4 10             	add    $0x10,%esp
+  80030a:	e9 5d fe ff ff       	jmp    80016c <check_regs+0x139>
+  CHECK(ecx, regs.reg_ecx);
+  80030f:	83 ec 0c             	sub    $0xc,%esp
+  800312:	68 84 34 80 00       	push   $0x803484
+  800317:	e8 07 04 00 00       	call   800723 <cprintf>
+  80031c:	83 c4 10             	add    $0x10,%esp
+  80031f:	e9 81 fe ff ff       	jmp    8001a5 <check_regs+0x172>
+  CHECK(eax, regs.reg_eax);
+  800324:	83 ec 0c             	sub    $0xc,%esp
+  800327:	68 84 34 80 00       	push   $0x803484
+  80032c:	e8 f2 03 00 00       	call   800723 <cprintf>
+  800331:	83 c4 10             	add    $0x10,%esp
+  800334:	e9 a5 fe ff ff       	jmp    8001de <check_regs+0x1ab>
+  CHECK(eip, eip);
+  800339:	83 ec 0c             	sub    $0xc,%esp
+  80033c:	68 84 34 80 00       	push   $0x803484
+  800341:	e8 dd 03 00 00       	call   800723 <cprintf>
+  800346:	83 c4 10             	add    $0x10,%esp
+  800349:	e9 c9 fe ff ff       	jmp    800217 <check_regs+0x1e4>
+  CHECK(eflags, eflags);
+  80034e:	83 ec 0c             	sub    $0xc,%esp
+  800351:	68 84 34 80 00       	push   $0x803484
+  800356:	e8 c8 03 00 00       	call   800723 <cprintf>
+  CHECK(esp, esp);
+  80035b:	ff 73 28             	push   0x28(%ebx)
+  80035e:	ff 76 28             	push   0x28(%esi)
+  800361:	68 b5 34 80 00       	push   $0x8034b5
+  800366:	68 74 34 80 00       	push   $0x803474
+  80036b:	e8 b3 03 00 00       	call   800723 <cprintf>
+  800370:	83 c4 20             	add    $0x20,%esp
+  800373:	8b 43 28             	mov    0x28(%ebx),%eax
+  800376:	39 46 28             	cmp    %eax,0x28(%esi)
+  800379:	0f 85 ed fe ff ff    	jne    80026c <check_regs+0x239>
+  80037f:	83 ec 0c             	sub    $0xc,%esp
+  800382:	68 84 34 80 00       	push   $0x803484
+  800387:	e8 97 03 00 00       	call   800723 <cprintf>
+  cprintf("Registers %s ", testname);
+  80038c:	83 c4 08             	add    $0x8,%esp
+  80038f:	ff 75 0c             	push   0xc(%ebp)
+  800392:	68 b9 34 80 00       	push   $0x8034b9
+  800397:	e8 87 03 00 00       	call   800723 <cprintf>
+  if (!mismatch)
+  80039c:	83 c4 10             	add    $0x10,%esp
+  80039f:	85 ff                	test   %edi,%edi
+  8003a1:	0f 85 e5 fe ff ff    	jne    80028c <check_regs+0x259>
+    cprintf("OK\n");
+  8003a7:	83 ec 0c             	sub    $0xc,%esp
+  8003aa:	68 84 34 80 00       	push   $0x803484
+  8003af:	e8 6f 03 00 00       	call   800723 <cprintf>
+  8003b4:	83 c4 10             	add    $0x10,%esp
+}
+  8003b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003ba:	5b                   	pop    %ebx
+  8003bb:	5e                   	pop    %esi
+  8003bc:	5f                   	pop    %edi
+  8003bd:	5d                   	pop    %ebp
+  8003be:	c3                   	ret
+  CHECK(esp, esp);
+  8003bf:	83 ec 0c             	sub    $0xc,%esp
+  8003c2:	68 84 34 80 00       	push   $0x803484
+  8003c7:	e8 57 03 00 00       	call   800723 <cprintf>
+  cprintf("Registers %s ", testname);
+  8003cc:	83 c4 08             	add    $0x8,%esp
+  8003cf:	ff 75 0c             	push   0xc(%ebp)
+  8003d2:	68 b9 34 80 00       	push   $0x8034b9
+  8003d7:	e8 47 03 00 00       	call   800723 <cprintf>
+  8003dc:	83 c4 10             	add    $0x10,%esp
+  8003df:	e9 a8 fe ff ff       	jmp    80028c <check_regs+0x259>
+
+008003e4 <pgfault>:
+
+static void
+pgfault(struct UTrapframe *utf)
+{
+  8003e4:	55                   	push   %ebp
+  8003e5:	89 e5                	mov    %esp,%ebp
+  8003e7:	83 ec 08             	sub    $0x8,%esp
+  8003ea:	8b 45 08             	mov    0x8(%ebp),%eax
+  int r;
+
+  if (utf->utf_fault_va != (uint32_t)UTEMP)
+  8003ed:	8b 10                	mov    (%eax),%edx
+  8003ef:	81 fa 00 00 40 00    	cmp    $0x400000,%edx
+  8003f5:	0f 85 9d 00 00 00    	jne    800498 <pgfault+0xb4>
+    panic("pgfault expected at UTEMP, got 0x%08x (eip %08x)",
+          utf->utf_fault_va, utf->utf_eip);
+
+  // Check registers in UTrapframe
+  during.regs = utf->utf_regs;
+  8003fb:	8b 50 08             	mov    0x8(%eax),%edx
+  8003fe:	89 15 40 50 80 00    	mov    %edx,0x805040
+  800404:	8b 50 0c             	mov    0xc(%eax),%edx
+  800407:	89 15 44 50 80 00    	mov    %edx,0x805044
+  80040d:	8b 50 10             	mov    0x10(%eax),%edx
+  800410:	89 15 48 50 80 00    	mov    %edx,0x805048
+  800416:	8b 50 14             	mov    0x14(%eax),%edx
+  800419:	89 15 4c 50 80 00    	mov    %edx,0x80504c
+  80041f:	8b 50 18             	mov    0x18(%eax),%edx
+  800422:	89 15 50 50 80 00    	mov    %edx,0x805050
+  800428:	8b 50 1c             	mov    0x1c(%eax),%edx
+  80042b:	89 15 54 50 80 00    	mov    %edx,0x805054
+  800431:	8b 50 20             	mov    0x20(%eax),%edx
+  800434:	89 15 58 50 80 00    	mov    %edx,0x805058
+  80043a:	8b 50 24             	mov    0x24(%eax),%edx
+  80043d:	89 15 5c 50 80 00    	mov    %edx,0x80505c
+  during.eip = utf->utf_eip;
+  800443:	8b 50 28             	mov    0x28(%eax),%edx
+  800446:	89 15 60 50 80 00    	mov    %edx,0x805060
+  during.eflags = utf->utf_eflags;
+  80044c:	8b 50 2c             	mov    0x2c(%eax),%edx
+  80044f:	89 15 64 50 80 00    	mov    %edx,0x805064
+  during.esp = utf->utf_esp;
+  800455:	8b 40 30             	mov    0x30(%eax),%eax
+  800458:	a3 68 50 80 00       	mov    %eax,0x805068
+  check_regs(&before, "before", &during, "during", "in UTrapframe");
+  80045d:	83 ec 08             	sub    $0x8,%esp
+  800460:	68 df 34 80 00       	push   $0x8034df
+  800465:	68 ed 34 80 00       	push   $0x8034ed
+  80046a:	b9 40 50 80 00       	mov    $0x805040,%ecx
+  80046f:	ba d8 34 80 00       	mov    $0x8034d8,%edx
+  800474:	b8 80 50 80 00       	mov    $0x805080,%eax
+  800479:	e8 b5 fb ff ff       	call   800033 <check_regs>
+
+  // Map UTEMP so the write succeeds
+  if ((r = sys_page_alloc(0, UTEMP, PTE_U|PTE_P|PTE_W)) < 0)
+  80047e:	83 c4 0c             	add    $0xc,%esp
+  800481:	6a 07                	push   $0x7
+  800483:	68 00 00 40 00       	push   $0x400000
+  800488:	6a 00                	push   $0x0
+  80048a:	e8 b1 0c 00 00       	call   801140 <sys_page_alloc>
+  80048f:	83 c4 10             	add    $0x10,%esp
+  800492:	85 c0                	test   %eax,%eax
+  800494:	78 1a                	js     8004b0 <pgfault+0xcc>
+    panic("sys_page_alloc: %e", r);
+}
+  800496:	c9                   	leave
+  800497:	c3                   	ret
+    panic("pgfault expected at UTEMP, got 0x%08x (eip %08x)",
+  800498:	83 ec 0c             	sub    $0xc,%esp
+  80049b:	ff 70 28             	push   0x28(%eax)
+  80049e:	52                   	push   %edx
+  80049f:	68 20 35 80 00       	push   $0x803520
+  8004a4:	6a 4f                	push   $0x4f
+  8004a6:	68 c7 34 80 00       	push   $0x8034c7
+  8004ab:	e8 98 01 00 00       	call   800648 <_panic>
+    panic("sys_page_alloc: %e", r);
+  8004b0:	50                   	push   %eax
+  8004b1:	68 f4 34 80 00       	push   $0x8034f4
+  8004b6:	6a 5b                	push   $0x5b
+  8004b8:	68 c7 34 80 00       	push   $0x8034c7
+  8004bd:	e8 86 01 00 00       	call   800648 <_panic>
+
+008004c2 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8004c2:	55                   	push   %ebp
+  8004c3:	89 e5                	mov    %esp,%ebp
+  8004c5:	83 ec 14             	sub    $0x14,%esp
+  set_pgfault_handler(pgfault);
+  8004c8:	68 e4 03 80 00       	push   $0x8003e4
+  8004cd:	e8 1d 11 00 00       	call   8015ef <set_pgfault_handler>
+
+  __asm __volatile(
+  8004d2:	50                   	push   %eax
+  8004d3:	9c                   	pushf
+  8004d4:	58                   	pop    %eax
+  8004d5:	0d d5 08 00 00       	or     $0x8d5,%eax
+  8004da:	50                   	push   %eax
+  8004db:	9d                   	popf
+  8004dc:	a3 a4 50 80 00       	mov    %eax,0x8050a4
+  8004e1:	8d 05 1c 05 80 00    	lea    0x80051c,%eax
+  8004e7:	a3 a0 50 80 00       	mov    %eax,0x8050a0
+  8004ec:	58                   	pop    %eax
+  8004ed:	89 3d 80 50 80 00    	mov    %edi,0x805080
+  8004f3:	89 35 84 50 80 00    	mov    %esi,0x805084
+  8004f9:	89 2d 88 50 80 00    	mov    %ebp,0x805088
+  8004ff:	89 1d 90 50 80 00    	mov    %ebx,0x805090
+  800505:	89 15 94 50 80 00    	mov    %edx,0x805094
+  80050b:	89 0d 98 50 80 00    	mov    %ecx,0x805098
+  800511:	a3 9c 50 80 00       	mov    %eax,0x80509c
+  800516:	89 25 a8 50 80 00    	mov    %esp,0x8050a8
+  80051c:	c7 05 00 00 40 00 2a 	movl   $0x2a,0x400000
+  800523:	00 00 00 
+  800526:	89 3d 00 50 80 00    	mov    %edi,0x805000
+  80052c:	89 35 04 50 80 00    	mov    %esi,0x805004
+  800532:	89 2d 08 50 80 00    	mov    %ebp,0x805008
+  800538:	89 1d 10 50 80 00    	mov    %ebx,0x805010
+  80053e:	89 15 14 50 80 00    	mov    %edx,0x805014
+  800544:	89 0d 18 50 80 00    	mov    %ecx,0x805018
+  80054a:	a3 1c 50 80 00       	mov    %eax,0x80501c
+  80054f:	89 25 28 50 80 00    	mov    %esp,0x805028
+  800555:	8b 3d 80 50 80 00    	mov    0x805080,%edi
+  80055b:	8b 35 84 50 80 00    	mov    0x805084,%esi
+  800561:	8b 2d 88 50 80 00    	mov    0x805088,%ebp
+  800567:	8b 1d 90 50 80 00    	mov    0x805090,%ebx
+  80056d:	8b 15 94 50 80 00    	mov    0x805094,%edx
+  800573:	8b 0d 98 50 80 00    	mov    0x805098,%ecx
+  800579:	a1 9c 50 80 00       	mov    0x80509c,%eax
+  80057e:	8b 25 a8 50 80 00    	mov    0x8050a8,%esp
+  800584:	50                   	push   %eax
+  800585:	9c                   	pushf
+  800586:	58                   	pop    %eax
+  800587:	a3 24 50 80 00       	mov    %eax,0x805024
+  80058c:	58                   	pop    %eax
+    : : "m" (before), "m" (after) : "memory", "cc");
+
+  // Check UTEMP to roughly determine that EIP was restored
+  // correctly (of course, we probably wouldn't get this far if
+  // it weren't)
+  if (*(int*)UTEMP != 42)
+  80058d:	83 c4 10             	add    $0x10,%esp
+  800590:	83 3d 00 00 40 00 2a 	cmpl   $0x2a,0x400000
+  800597:	75 30                	jne    8005c9 <umain+0x107>
+    cprintf("EIP after page-fault MISMATCH\n");
+  after.eip = before.eip;
+  800599:	a1 a0 50 80 00       	mov    0x8050a0,%eax
+  80059e:	a3 20 50 80 00       	mov    %eax,0x805020
+
+  check_regs(&before, "before", &after, "after", "after page-fault");
+  8005a3:	83 ec 08             	sub    $0x8,%esp
+  8005a6:	68 07 35 80 00       	push   $0x803507
+  8005ab:	68 18 35 80 00       	push   $0x803518
+  8005b0:	b9 00 50 80 00       	mov    $0x805000,%ecx
+  8005b5:	ba d8 34 80 00       	mov    $0x8034d8,%edx
+  8005ba:	b8 80 50 80 00       	mov    $0x805080,%eax
+  8005bf:	e8 6f fa ff ff       	call   800033 <check_regs>
+}
+  8005c4:	83 c4 10             	add    $0x10,%esp
+  8005c7:	c9                   	leave
+  8005c8:	c3                   	ret
+    cprintf("EIP after page-fault MISMATCH\n");
+  8005c9:	83 ec 0c             	sub    $0xc,%esp
+  8005cc:	68 54 35 80 00       	push   $0x803554
+  8005d1:	e8 4d 01 00 00       	call   800723 <cprintf>
+  8005d6:	83 c4 10             	add    $0x10,%esp
+  8005d9:	eb be                	jmp    800599 <umain+0xd7>
+
+008005db <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8005db:	55                   	push   %ebp
+  8005dc:	89 e5                	mov    %esp,%ebp
+  8005de:	56                   	push   %esi
+  8005df:	53                   	push   %ebx
+  8005e0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8005e3:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  8005e6:	c7 05 04 58 80 00 00 	movl   $0x0,0x805804
+  8005ed:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  8005f0:	e8 ca 0a 00 00       	call   8010bf <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  8005f5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8005fa:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8005fd:	c1 e0 04             	shl    $0x4,%eax
+  800600:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800605:	a3 04 58 80 00       	mov    %eax,0x805804
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  80060a:	85 db                	test   %ebx,%ebx
+  80060c:	7e 07                	jle    800615 <libmain+0x3a>
+    binaryname = argv[0];
+  80060e:	8b 06                	mov    (%esi),%eax
+  800610:	a3 00 40 80 00       	mov    %eax,0x804000
+
+  // call user main routine
+  umain(argc, argv);
+  800615:	83 ec 08             	sub    $0x8,%esp
+  800618:	56                   	push   %esi
+  800619:	53                   	push   %ebx
+  80061a:	e8 a3 fe ff ff       	call   8004c2 <umain>
+
+  // exit gracefully
+  exit();
+  80061f:	e8 0a 00 00 00       	call   80062e <exit>
+}
+  800624:	83 c4 10             	add    $0x10,%esp
+  800627:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80062a:	5b                   	pop    %ebx
+  80062b:	5e                   	pop    %esi
+  80062c:	5d                   	pop    %ebp
+  80062d:	c3                   	ret
+
+0080062e <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80062e:	55                   	push   %ebp
+  80062f:	89 e5                	mov    %esp,%ebp
+  800631:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  800634:	e8 ed 11 00 00       	call   801826 <close_all>
+  sys_env_destroy(0);
+  800639:	83 ec 0c             	sub    $0xc,%esp
+  80063c:	6a 00                	push   $0x0
+  80063e:	e8 3b 0a 00 00       	call   80107e <sys_env_destroy>
+}
+  800643:	83 c4 10             	add    $0x10,%esp
+  800646:	c9                   	leave
+  800647:	c3                   	ret
+
+00800648 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800648:	55                   	push   %ebp
+  800649:	89 e5                	mov    %esp,%ebp
+  80064b:	56                   	push   %esi
+  80064c:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  80064d:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  800650:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  800656:	e8 64 0a 00 00       	call   8010bf <sys_getenvid>
+  80065b:	83 ec 0c             	sub    $0xc,%esp
+  80065e:	ff 75 0c             	push   0xc(%ebp)
+  800661:	ff 75 08             	push   0x8(%ebp)
+  800664:	56                   	push   %esi
+  800665:	50                   	push   %eax
+  800666:	68 80 35 80 00       	push   $0x803580
+  80066b:	e8 b3 00 00 00       	call   800723 <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  800670:	83 c4 18             	add    $0x18,%esp
+  800673:	53                   	push   %ebx
+  800674:	ff 75 10             	push   0x10(%ebp)
+  800677:	e8 56 00 00 00       	call   8006d2 <vcprintf>
+  cprintf("\n");
+  80067c:	c7 04 24 90 34 80 00 	movl   $0x803490,(%esp)
+  800683:	e8 9b 00 00 00       	call   800723 <cprintf>
+  800688:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  80068b:	cc                   	int3
+  while (1)
+  80068c:	eb fd                	jmp    80068b <_panic+0x43>
+
+0080068e <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80068e:	55                   	push   %ebp
+  80068f:	89 e5                	mov    %esp,%ebp
+  800691:	53                   	push   %ebx
+  800692:	83 ec 04             	sub    $0x4,%esp
+  800695:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  800698:	8b 13                	mov    (%ebx),%edx
+  80069a:	8d 42 01             	lea    0x1(%edx),%eax
+  80069d:	89 03                	mov    %eax,(%ebx)
+  80069f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8006a2:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  8006a6:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8006ab:	74 09                	je     8006b6 <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  8006ad:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8006b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8006b4:	c9                   	leave
+  8006b5:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  8006b6:	83 ec 08             	sub    $0x8,%esp
+  8006b9:	68 ff 00 00 00       	push   $0xff
+  8006be:	8d 43 08             	lea    0x8(%ebx),%eax
+  8006c1:	50                   	push   %eax
+  8006c2:	e8 7a 09 00 00       	call   801041 <sys_cputs>
+    b->idx = 0;
+  8006c7:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8006cd:	83 c4 10             	add    $0x10,%esp
+  8006d0:	eb db                	jmp    8006ad <putch+0x1f>
+
+008006d2 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8006d2:	55                   	push   %ebp
+  8006d3:	89 e5                	mov    %esp,%ebp
+  8006d5:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  8006db:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8006e2:	00 00 00 
+  b.cnt = 0;
+  8006e5:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8006ec:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  8006ef:	ff 75 0c             	push   0xc(%ebp)
+  8006f2:	ff 75 08             	push   0x8(%ebp)
+  8006f5:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8006fb:	50                   	push   %eax
+  8006fc:	68 8e 06 80 00       	push   $0x80068e
+  800701:	e8 14 01 00 00       	call   80081a <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  800706:	83 c4 08             	add    $0x8,%esp
+  800709:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80070f:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800715:	50                   	push   %eax
+  800716:	e8 26 09 00 00       	call   801041 <sys_cputs>
+
+  return b.cnt;
+}
+  80071b:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800721:	c9                   	leave
+  800722:	c3                   	ret
+
+00800723 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800723:	55                   	push   %ebp
+  800724:	89 e5                	mov    %esp,%ebp
+  800726:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  800729:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  80072c:	50                   	push   %eax
+  80072d:	ff 75 08             	push   0x8(%ebp)
+  800730:	e8 9d ff ff ff       	call   8006d2 <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  800735:	c9                   	leave
+  800736:	c3                   	ret
+
+00800737 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  800737:	55                   	push   %ebp
+  800738:	89 e5                	mov    %esp,%ebp
+  80073a:	57                   	push   %edi
+  80073b:	56                   	push   %esi
+  80073c:	53                   	push   %ebx
+  80073d:	83 ec 1c             	sub    $0x1c,%esp
+  800740:	89 c7                	mov    %eax,%edi
+  800742:	89 d6                	mov    %edx,%esi
+  800744:	8b 45 08             	mov    0x8(%ebp),%eax
+  800747:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80074a:	89 d1                	mov    %edx,%ecx
+  80074c:	89 c2                	mov    %eax,%edx
+  80074e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800751:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800754:	8b 45 10             	mov    0x10(%ebp),%eax
+  800757:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  80075a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80075d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800764:	39 c2                	cmp    %eax,%edx
+  800766:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800769:	72 3e                	jb     8007a9 <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  80076b:	83 ec 0c             	sub    $0xc,%esp
+  80076e:	ff 75 18             	push   0x18(%ebp)
+  800771:	83 eb 01             	sub    $0x1,%ebx
+  800774:	53                   	push   %ebx
+  800775:	50                   	push   %eax
+  800776:	83 ec 08             	sub    $0x8,%esp
+  800779:	ff 75 e4             	push   -0x1c(%ebp)
+  80077c:	ff 75 e0             	push   -0x20(%ebp)
+  80077f:	ff 75 dc             	push   -0x24(%ebp)
+  800782:	ff 75 d8             	push   -0x28(%ebp)
+  800785:	e8 48 2b 00 00       	call   8032d2 <__udivdi3>
+  80078a:	83 c4 18             	add    $0x18,%esp
+  80078d:	52                   	push   %edx
+  80078e:	50                   	push   %eax
+  80078f:	89 f2                	mov    %esi,%edx
+  800791:	89 f8                	mov    %edi,%eax
+  800793:	e8 9f ff ff ff       	call   800737 <printnum>
+  800798:	83 c4 20             	add    $0x20,%esp
+  80079b:	eb 13                	jmp    8007b0 <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  80079d:	83 ec 08             	sub    $0x8,%esp
+  8007a0:	56                   	push   %esi
+  8007a1:	ff 75 18             	push   0x18(%ebp)
+  8007a4:	ff d7                	call   *%edi
+  8007a6:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  8007a9:	83 eb 01             	sub    $0x1,%ebx
+  8007ac:	85 db                	test   %ebx,%ebx
+  8007ae:	7f ed                	jg     80079d <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  8007b0:	83 ec 08             	sub    $0x8,%esp
+  8007b3:	56                   	push   %esi
+  8007b4:	83 ec 04             	sub    $0x4,%esp
+  8007b7:	ff 75 e4             	push   -0x1c(%ebp)
+  8007ba:	ff 75 e0             	push   -0x20(%ebp)
+  8007bd:	ff 75 dc             	push   -0x24(%ebp)
+  8007c0:	ff 75 d8             	push   -0x28(%ebp)
+  8007c3:	e8 2b 2b 00 00       	call   8032f3 <__umoddi3>
+  8007c8:	83 c4 14             	add    $0x14,%esp
+  8007cb:	0f be 80 a3 35 80 00 	movsbl 0x8035a3(%eax),%eax
+  8007d2:	50                   	push   %eax
+  8007d3:	ff d7                	call   *%edi
+}
+  8007d5:	83 c4 10             	add    $0x10,%esp
+  8007d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007db:	5b                   	pop    %ebx
+  8007dc:	5e                   	pop    %esi
+  8007dd:	5f                   	pop    %edi
+  8007de:	5d                   	pop    %ebp
+  8007df:	c3                   	ret
+
+008007e0 <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8007e0:	55                   	push   %ebp
+  8007e1:	89 e5                	mov    %esp,%ebp
+  8007e3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  8007e6:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  8007ea:	8b 10                	mov    (%eax),%edx
+  8007ec:	3b 50 04             	cmp    0x4(%eax),%edx
+  8007ef:	73 0a                	jae    8007fb <sprintputch+0x1b>
+    *b->buf++ = ch;
+  8007f1:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8007f4:	89 08                	mov    %ecx,(%eax)
+  8007f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007f9:	88 02                	mov    %al,(%edx)
+}
+  8007fb:	5d                   	pop    %ebp
+  8007fc:	c3                   	ret
+
+008007fd <printfmt>:
+{
+  8007fd:	55                   	push   %ebp
+  8007fe:	89 e5                	mov    %esp,%ebp
+  800800:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  800803:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  800806:	50                   	push   %eax
+  800807:	ff 75 10             	push   0x10(%ebp)
+  80080a:	ff 75 0c             	push   0xc(%ebp)
+  80080d:	ff 75 08             	push   0x8(%ebp)
+  800810:	e8 05 00 00 00       	call   80081a <vprintfmt>
+}
+  800815:	83 c4 10             	add    $0x10,%esp
+  800818:	c9                   	leave
+  800819:	c3                   	ret
+
+0080081a <vprintfmt>:
+{
+  80081a:	55                   	push   %ebp
+  80081b:	89 e5                	mov    %esp,%ebp
+  80081d:	57                   	push   %edi
+  80081e:	56                   	push   %esi
+  80081f:	53                   	push   %ebx
+  800820:	83 ec 2c             	sub    $0x2c,%esp
+  800823:	8b 75 08             	mov    0x8(%ebp),%esi
+  800826:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800829:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80082c:	eb 0a                	jmp    800838 <vprintfmt+0x1e>
+      putch(ch, putdat);
+  80082e:	83 ec 08             	sub    $0x8,%esp
+  800831:	53                   	push   %ebx
+  800832:	50                   	push   %eax
+  800833:	ff d6                	call   *%esi
+  800835:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  800838:	83 c7 01             	add    $0x1,%edi
+  80083b:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80083f:	83 f8 25             	cmp    $0x25,%eax
+  800842:	74 0c                	je     800850 <vprintfmt+0x36>
+      if (ch == '\0')
+  800844:	85 c0                	test   %eax,%eax
+  800846:	75 e6                	jne    80082e <vprintfmt+0x14>
+}
+  800848:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80084b:	5b                   	pop    %ebx
+  80084c:	5e                   	pop    %esi
+  80084d:	5f                   	pop    %edi
+  80084e:	5d                   	pop    %ebp
+  80084f:	c3                   	ret
+    padc = ' ';
+  800850:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  800854:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  80085b:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  800862:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  800869:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  80086e:	8d 47 01             	lea    0x1(%edi),%eax
+  800871:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800874:	0f b6 17             	movzbl (%edi),%edx
+  800877:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80087a:	3c 55                	cmp    $0x55,%al
+  80087c:	0f 87 cf 03 00 00    	ja     800c51 <vprintfmt+0x437>
+  800882:	0f b6 c0             	movzbl %al,%eax
+  800885:	ff 24 85 e0 36 80 00 	jmp    *0x8036e0(,%eax,4)
+  80088c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  80088f:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800893:	eb d9                	jmp    80086e <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  800895:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800898:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80089c:	eb d0                	jmp    80086e <vprintfmt+0x54>
+  80089e:	0f b6 d2             	movzbl %dl,%edx
+  8008a1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  8008a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008a9:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  8008ac:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8008af:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  8008b3:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  8008b6:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8008b9:	83 f9 09             	cmp    $0x9,%ecx
+  8008bc:	77 55                	ja     800913 <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  8008be:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  8008c1:	eb e9                	jmp    8008ac <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  8008c3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008c6:	8b 00                	mov    (%eax),%eax
+  8008c8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8008cb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008ce:	8d 40 04             	lea    0x4(%eax),%eax
+  8008d1:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  8008d4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  8008d7:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8008db:	79 91                	jns    80086e <vprintfmt+0x54>
+        width = precision, precision = -1;
+  8008dd:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8008e0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8008e3:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8008ea:	eb 82                	jmp    80086e <vprintfmt+0x54>
+      if (width < 0)
+  8008ec:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8008ef:	85 d2                	test   %edx,%edx
+  8008f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008f6:	0f 49 c2             	cmovns %edx,%eax
+  8008f9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  8008fc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  8008ff:	e9 6a ff ff ff       	jmp    80086e <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  800904:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  800907:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  80090e:	e9 5b ff ff ff       	jmp    80086e <vprintfmt+0x54>
+  800913:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800916:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800919:	eb bc                	jmp    8008d7 <vprintfmt+0xbd>
+      lflag++;
+  80091b:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  80091e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  800921:	e9 48 ff ff ff       	jmp    80086e <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  800926:	8b 45 14             	mov    0x14(%ebp),%eax
+  800929:	8d 78 04             	lea    0x4(%eax),%edi
+  80092c:	83 ec 08             	sub    $0x8,%esp
+  80092f:	53                   	push   %ebx
+  800930:	ff 30                	push   (%eax)
+  800932:	ff d6                	call   *%esi
+      break;
+  800934:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  800937:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  80093a:	e9 b1 02 00 00       	jmp    800bf0 <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  80093f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800942:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  800945:	8b 10                	mov    (%eax),%edx
+  800947:	89 d0                	mov    %edx,%eax
+  800949:	f7 d8                	neg    %eax
+  80094b:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80094e:	83 f8 10             	cmp    $0x10,%eax
+  800951:	7f 23                	jg     800976 <vprintfmt+0x15c>
+  800953:	8b 14 85 40 38 80 00 	mov    0x803840(,%eax,4),%edx
+  80095a:	85 d2                	test   %edx,%edx
+  80095c:	74 18                	je     800976 <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  80095e:	52                   	push   %edx
+  80095f:	68 8a 39 80 00       	push   $0x80398a
+  800964:	53                   	push   %ebx
+  800965:	56                   	push   %esi
+  800966:	e8 92 fe ff ff       	call   8007fd <printfmt>
+  80096b:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  80096e:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800971:	e9 7a 02 00 00       	jmp    800bf0 <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  800976:	50                   	push   %eax
+  800977:	68 bb 35 80 00       	push   $0x8035bb
+  80097c:	53                   	push   %ebx
+  80097d:	56                   	push   %esi
+  80097e:	e8 7a fe ff ff       	call   8007fd <printfmt>
+  800983:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  800986:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  800989:	e9 62 02 00 00       	jmp    800bf0 <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  80098e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800991:	83 c0 04             	add    $0x4,%eax
+  800994:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800997:	8b 45 14             	mov    0x14(%ebp),%eax
+  80099a:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  80099c:	85 c9                	test   %ecx,%ecx
+  80099e:	b8 b4 35 80 00       	mov    $0x8035b4,%eax
+  8009a3:	0f 45 c1             	cmovne %ecx,%eax
+  8009a6:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  8009a9:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8009ad:	7e 06                	jle    8009b5 <vprintfmt+0x19b>
+  8009af:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8009b3:	75 0b                	jne    8009c0 <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8009b5:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8009b8:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8009bb:	89 75 08             	mov    %esi,0x8(%ebp)
+  8009be:	eb 5c                	jmp    800a1c <vprintfmt+0x202>
+  8009c0:	83 ec 08             	sub    $0x8,%esp
+  8009c3:	ff 75 d0             	push   -0x30(%ebp)
+  8009c6:	ff 75 cc             	push   -0x34(%ebp)
+  8009c9:	e8 20 03 00 00       	call   800cee <strnlen>
+  8009ce:	89 c2                	mov    %eax,%edx
+  8009d0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8009d3:	29 d0                	sub    %edx,%eax
+  8009d5:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  8009d8:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8009dc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8009df:	89 75 08             	mov    %esi,0x8(%ebp)
+  8009e2:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8009e4:	eb 0e                	jmp    8009f4 <vprintfmt+0x1da>
+          putch(padc, putdat);
+  8009e6:	83 ec 08             	sub    $0x8,%esp
+  8009e9:	53                   	push   %ebx
+  8009ea:	57                   	push   %edi
+  8009eb:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8009ee:	83 ee 01             	sub    $0x1,%esi
+  8009f1:	83 c4 10             	add    $0x10,%esp
+  8009f4:	85 f6                	test   %esi,%esi
+  8009f6:	7f ee                	jg     8009e6 <vprintfmt+0x1cc>
+  8009f8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8009fb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009fe:	85 c0                	test   %eax,%eax
+  800a00:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a05:	0f 49 d0             	cmovns %eax,%edx
+  800a08:	29 d0                	sub    %edx,%eax
+  800a0a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800a0d:	eb a6                	jmp    8009b5 <vprintfmt+0x19b>
+          putch(ch, putdat);
+  800a0f:	83 ec 08             	sub    $0x8,%esp
+  800a12:	53                   	push   %ebx
+  800a13:	52                   	push   %edx
+  800a14:	ff 55 08             	call   *0x8(%ebp)
+  800a17:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800a1a:	89 f1                	mov    %esi,%ecx
+  800a1c:	8d 71 01             	lea    0x1(%ecx),%esi
+  800a1f:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800a23:	0f be d0             	movsbl %al,%edx
+  800a26:	85 d2                	test   %edx,%edx
+  800a28:	74 28                	je     800a52 <vprintfmt+0x238>
+  800a2a:	85 ff                	test   %edi,%edi
+  800a2c:	78 05                	js     800a33 <vprintfmt+0x219>
+  800a2e:	83 ef 01             	sub    $0x1,%edi
+  800a31:	78 30                	js     800a63 <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  800a33:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800a37:	74 d6                	je     800a0f <vprintfmt+0x1f5>
+  800a39:	0f be c0             	movsbl %al,%eax
+  800a3c:	83 e8 20             	sub    $0x20,%eax
+  800a3f:	83 f8 5e             	cmp    $0x5e,%eax
+  800a42:	76 cb                	jbe    800a0f <vprintfmt+0x1f5>
+          putch('?', putdat);
+  800a44:	83 ec 08             	sub    $0x8,%esp
+  800a47:	53                   	push   %ebx
+  800a48:	6a 3f                	push   $0x3f
+  800a4a:	ff 55 08             	call   *0x8(%ebp)
+  800a4d:	83 c4 10             	add    $0x10,%esp
+  800a50:	eb c8                	jmp    800a1a <vprintfmt+0x200>
+  800a52:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a55:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800a58:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800a5b:	01 d0                	add    %edx,%eax
+  800a5d:	29 c8                	sub    %ecx,%eax
+  800a5f:	89 c7                	mov    %eax,%edi
+  800a61:	eb 13                	jmp    800a76 <vprintfmt+0x25c>
+  800a63:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a66:	eb ed                	jmp    800a55 <vprintfmt+0x23b>
+        putch(' ', putdat);
+  800a68:	83 ec 08             	sub    $0x8,%esp
+  800a6b:	53                   	push   %ebx
+  800a6c:	6a 20                	push   $0x20
+  800a6e:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  800a70:	83 ef 01             	sub    $0x1,%edi
+  800a73:	83 c4 10             	add    $0x10,%esp
+  800a76:	85 ff                	test   %edi,%edi
+  800a78:	7f ee                	jg     800a68 <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  800a7a:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800a7d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a80:	e9 6b 01 00 00       	jmp    800bf0 <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  800a85:	83 f9 01             	cmp    $0x1,%ecx
+  800a88:	7f 1f                	jg     800aa9 <vprintfmt+0x28f>
+  else if (lflag)
+  800a8a:	85 c9                	test   %ecx,%ecx
+  800a8c:	74 67                	je     800af5 <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  800a8e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a91:	8b 00                	mov    (%eax),%eax
+  800a93:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800a96:	89 c1                	mov    %eax,%ecx
+  800a98:	c1 f9 1f             	sar    $0x1f,%ecx
+  800a9b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800a9e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800aa1:	8d 40 04             	lea    0x4(%eax),%eax
+  800aa4:	89 45 14             	mov    %eax,0x14(%ebp)
+  800aa7:	eb 17                	jmp    800ac0 <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  800aa9:	8b 45 14             	mov    0x14(%ebp),%eax
+  800aac:	8b 50 04             	mov    0x4(%eax),%edx
+  800aaf:	8b 00                	mov    (%eax),%eax
+  800ab1:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800ab4:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800ab7:	8b 45 14             	mov    0x14(%ebp),%eax
+  800aba:	8d 40 08             	lea    0x8(%eax),%eax
+  800abd:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  800ac0:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800ac3:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  800ac6:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  800acb:	85 c9                	test   %ecx,%ecx
+  800acd:	0f 89 03 01 00 00    	jns    800bd6 <vprintfmt+0x3bc>
+        putch('-', putdat);
+  800ad3:	83 ec 08             	sub    $0x8,%esp
+  800ad6:	53                   	push   %ebx
+  800ad7:	6a 2d                	push   $0x2d
+  800ad9:	ff d6                	call   *%esi
+        num = -(long long)num;
+  800adb:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800ade:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800ae1:	f7 da                	neg    %edx
+  800ae3:	83 d1 00             	adc    $0x0,%ecx
+  800ae6:	f7 d9                	neg    %ecx
+  800ae8:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  800aeb:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800af0:	e9 e1 00 00 00       	jmp    800bd6 <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  800af5:	8b 45 14             	mov    0x14(%ebp),%eax
+  800af8:	8b 00                	mov    (%eax),%eax
+  800afa:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800afd:	89 c1                	mov    %eax,%ecx
+  800aff:	c1 f9 1f             	sar    $0x1f,%ecx
+  800b02:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800b05:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b08:	8d 40 04             	lea    0x4(%eax),%eax
+  800b0b:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b0e:	eb b0                	jmp    800ac0 <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  800b10:	83 f9 01             	cmp    $0x1,%ecx
+  800b13:	7f 1e                	jg     800b33 <vprintfmt+0x319>
+  else if (lflag)
+  800b15:	85 c9                	test   %ecx,%ecx
+  800b17:	74 32                	je     800b4b <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  800b19:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b1c:	8b 10                	mov    (%eax),%edx
+  800b1e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b23:	8d 40 04             	lea    0x4(%eax),%eax
+  800b26:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800b29:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  800b2e:	e9 a3 00 00 00       	jmp    800bd6 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800b33:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b36:	8b 10                	mov    (%eax),%edx
+  800b38:	8b 48 04             	mov    0x4(%eax),%ecx
+  800b3b:	8d 40 08             	lea    0x8(%eax),%eax
+  800b3e:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800b41:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  800b46:	e9 8b 00 00 00       	jmp    800bd6 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800b4b:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b4e:	8b 10                	mov    (%eax),%edx
+  800b50:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b55:	8d 40 04             	lea    0x4(%eax),%eax
+  800b58:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800b5b:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  800b60:	eb 74                	jmp    800bd6 <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  800b62:	83 f9 01             	cmp    $0x1,%ecx
+  800b65:	7f 1b                	jg     800b82 <vprintfmt+0x368>
+  else if (lflag)
+  800b67:	85 c9                	test   %ecx,%ecx
+  800b69:	74 2c                	je     800b97 <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  800b6b:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b6e:	8b 10                	mov    (%eax),%edx
+  800b70:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b75:	8d 40 04             	lea    0x4(%eax),%eax
+  800b78:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800b7b:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  800b80:	eb 54                	jmp    800bd6 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800b82:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b85:	8b 10                	mov    (%eax),%edx
+  800b87:	8b 48 04             	mov    0x4(%eax),%ecx
+  800b8a:	8d 40 08             	lea    0x8(%eax),%eax
+  800b8d:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800b90:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  800b95:	eb 3f                	jmp    800bd6 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800b97:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b9a:	8b 10                	mov    (%eax),%edx
+  800b9c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ba1:	8d 40 04             	lea    0x4(%eax),%eax
+  800ba4:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800ba7:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  800bac:	eb 28                	jmp    800bd6 <vprintfmt+0x3bc>
+      putch('0', putdat);
+  800bae:	83 ec 08             	sub    $0x8,%esp
+  800bb1:	53                   	push   %ebx
+  800bb2:	6a 30                	push   $0x30
+  800bb4:	ff d6                	call   *%esi
+      putch('x', putdat);
+  800bb6:	83 c4 08             	add    $0x8,%esp
+  800bb9:	53                   	push   %ebx
+  800bba:	6a 78                	push   $0x78
+  800bbc:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  800bbe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bc1:	8b 10                	mov    (%eax),%edx
+  800bc3:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  800bc8:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  800bcb:	8d 40 04             	lea    0x4(%eax),%eax
+  800bce:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800bd1:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  800bd6:	83 ec 0c             	sub    $0xc,%esp
+  800bd9:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800bdd:	50                   	push   %eax
+  800bde:	ff 75 e0             	push   -0x20(%ebp)
+  800be1:	57                   	push   %edi
+  800be2:	51                   	push   %ecx
+  800be3:	52                   	push   %edx
+  800be4:	89 da                	mov    %ebx,%edx
+  800be6:	89 f0                	mov    %esi,%eax
+  800be8:	e8 4a fb ff ff       	call   800737 <printnum>
+      break;
+  800bed:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  800bf0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  800bf3:	e9 40 fc ff ff       	jmp    800838 <vprintfmt+0x1e>
+  if (lflag >= 2)
+  800bf8:	83 f9 01             	cmp    $0x1,%ecx
+  800bfb:	7f 1b                	jg     800c18 <vprintfmt+0x3fe>
+  else if (lflag)
+  800bfd:	85 c9                	test   %ecx,%ecx
+  800bff:	74 2c                	je     800c2d <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  800c01:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c04:	8b 10                	mov    (%eax),%edx
+  800c06:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c0b:	8d 40 04             	lea    0x4(%eax),%eax
+  800c0e:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800c11:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  800c16:	eb be                	jmp    800bd6 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800c18:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c1b:	8b 10                	mov    (%eax),%edx
+  800c1d:	8b 48 04             	mov    0x4(%eax),%ecx
+  800c20:	8d 40 08             	lea    0x8(%eax),%eax
+  800c23:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800c26:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  800c2b:	eb a9                	jmp    800bd6 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800c2d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c30:	8b 10                	mov    (%eax),%edx
+  800c32:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c37:	8d 40 04             	lea    0x4(%eax),%eax
+  800c3a:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800c3d:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  800c42:	eb 92                	jmp    800bd6 <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  800c44:	83 ec 08             	sub    $0x8,%esp
+  800c47:	53                   	push   %ebx
+  800c48:	6a 25                	push   $0x25
+  800c4a:	ff d6                	call   *%esi
+      break;
+  800c4c:	83 c4 10             	add    $0x10,%esp
+  800c4f:	eb 9f                	jmp    800bf0 <vprintfmt+0x3d6>
+      putch('%', putdat);
+  800c51:	83 ec 08             	sub    $0x8,%esp
+  800c54:	53                   	push   %ebx
+  800c55:	6a 25                	push   $0x25
+  800c57:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  800c59:	83 c4 10             	add    $0x10,%esp
+  800c5c:	89 f8                	mov    %edi,%eax
+  800c5e:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800c62:	74 05                	je     800c69 <vprintfmt+0x44f>
+  800c64:	83 e8 01             	sub    $0x1,%eax
+  800c67:	eb f5                	jmp    800c5e <vprintfmt+0x444>
+  800c69:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800c6c:	eb 82                	jmp    800bf0 <vprintfmt+0x3d6>
+
+00800c6e <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800c6e:	55                   	push   %ebp
+  800c6f:	89 e5                	mov    %esp,%ebp
+  800c71:	83 ec 18             	sub    $0x18,%esp
+  800c74:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c77:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  800c7a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800c7d:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800c81:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800c84:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  800c8b:	85 c0                	test   %eax,%eax
+  800c8d:	74 26                	je     800cb5 <vsnprintf+0x47>
+  800c8f:	85 d2                	test   %edx,%edx
+  800c91:	7e 22                	jle    800cb5 <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800c93:	ff 75 14             	push   0x14(%ebp)
+  800c96:	ff 75 10             	push   0x10(%ebp)
+  800c99:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800c9c:	50                   	push   %eax
+  800c9d:	68 e0 07 80 00       	push   $0x8007e0
+  800ca2:	e8 73 fb ff ff       	call   80081a <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800ca7:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800caa:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  800cad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800cb0:	83 c4 10             	add    $0x10,%esp
+}
+  800cb3:	c9                   	leave
+  800cb4:	c3                   	ret
+    return -E_INVAL;
+  800cb5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800cba:	eb f7                	jmp    800cb3 <vsnprintf+0x45>
+
+00800cbc <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800cbc:	55                   	push   %ebp
+  800cbd:	89 e5                	mov    %esp,%ebp
+  800cbf:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  800cc2:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  800cc5:	50                   	push   %eax
+  800cc6:	ff 75 10             	push   0x10(%ebp)
+  800cc9:	ff 75 0c             	push   0xc(%ebp)
+  800ccc:	ff 75 08             	push   0x8(%ebp)
+  800ccf:	e8 9a ff ff ff       	call   800c6e <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  800cd4:	c9                   	leave
+  800cd5:	c3                   	ret
+
+00800cd6 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800cd6:	55                   	push   %ebp
+  800cd7:	89 e5                	mov    %esp,%ebp
+  800cd9:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  800cdc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ce1:	eb 03                	jmp    800ce6 <strlen+0x10>
+    n++;
+  800ce3:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  800ce6:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800cea:	75 f7                	jne    800ce3 <strlen+0xd>
+  return n;
+}
+  800cec:	5d                   	pop    %ebp
+  800ced:	c3                   	ret
+
+00800cee <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800cee:	55                   	push   %ebp
+  800cef:	89 e5                	mov    %esp,%ebp
+  800cf1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800cf4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800cf7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cfc:	eb 03                	jmp    800d01 <strnlen+0x13>
+    n++;
+  800cfe:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800d01:	39 d0                	cmp    %edx,%eax
+  800d03:	74 08                	je     800d0d <strnlen+0x1f>
+  800d05:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800d09:	75 f3                	jne    800cfe <strnlen+0x10>
+  800d0b:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  800d0d:	89 d0                	mov    %edx,%eax
+  800d0f:	5d                   	pop    %ebp
+  800d10:	c3                   	ret
+
+00800d11 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800d11:	55                   	push   %ebp
+  800d12:	89 e5                	mov    %esp,%ebp
+  800d14:	53                   	push   %ebx
+  800d15:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800d18:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  800d1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d20:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800d24:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800d27:	83 c0 01             	add    $0x1,%eax
+  800d2a:	84 d2                	test   %dl,%dl
+  800d2c:	75 f2                	jne    800d20 <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  800d2e:	89 c8                	mov    %ecx,%eax
+  800d30:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d33:	c9                   	leave
+  800d34:	c3                   	ret
+
+00800d35 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800d35:	55                   	push   %ebp
+  800d36:	89 e5                	mov    %esp,%ebp
+  800d38:	53                   	push   %ebx
+  800d39:	83 ec 10             	sub    $0x10,%esp
+  800d3c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  800d3f:	53                   	push   %ebx
+  800d40:	e8 91 ff ff ff       	call   800cd6 <strlen>
+  800d45:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  800d48:	ff 75 0c             	push   0xc(%ebp)
+  800d4b:	01 d8                	add    %ebx,%eax
+  800d4d:	50                   	push   %eax
+  800d4e:	e8 be ff ff ff       	call   800d11 <strcpy>
+  return dst;
+}
+  800d53:	89 d8                	mov    %ebx,%eax
+  800d55:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d58:	c9                   	leave
+  800d59:	c3                   	ret
+
+00800d5a <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  800d5a:	55                   	push   %ebp
+  800d5b:	89 e5                	mov    %esp,%ebp
+  800d5d:	56                   	push   %esi
+  800d5e:	53                   	push   %ebx
+  800d5f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d62:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  800d65:	89 f3                	mov    %esi,%ebx
+  800d67:	03 5d 10             	add    0x10(%ebp),%ebx
+  800d6a:	89 f0                	mov    %esi,%eax
+  800d6c:	eb 0f                	jmp    800d7d <strncpy+0x23>
+    *dst++ = *src;
+  800d6e:	83 c0 01             	add    $0x1,%eax
+  800d71:	0f b6 0a             	movzbl (%edx),%ecx
+  800d74:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  800d77:	80 f9 01             	cmp    $0x1,%cl
+  800d7a:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  800d7d:	39 d8                	cmp    %ebx,%eax
+  800d7f:	75 ed                	jne    800d6e <strncpy+0x14>
+  }
+  return ret;
+}
+  800d81:	89 f0                	mov    %esi,%eax
+  800d83:	5b                   	pop    %ebx
+  800d84:	5e                   	pop    %esi
+  800d85:	5d                   	pop    %ebp
+  800d86:	c3                   	ret
+
+00800d87 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800d87:	55                   	push   %ebp
+  800d88:	89 e5                	mov    %esp,%ebp
+  800d8a:	56                   	push   %esi
+  800d8b:	53                   	push   %ebx
+  800d8c:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d8f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d92:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  800d95:	89 f0                	mov    %esi,%eax
+  800d97:	85 d2                	test   %edx,%edx
+  800d99:	74 21                	je     800dbc <strlcpy+0x35>
+  800d9b:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800d9f:	89 f2                	mov    %esi,%edx
+  800da1:	eb 09                	jmp    800dac <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  800da3:	83 c1 01             	add    $0x1,%ecx
+  800da6:	83 c2 01             	add    $0x1,%edx
+  800da9:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  800dac:	39 c2                	cmp    %eax,%edx
+  800dae:	74 09                	je     800db9 <strlcpy+0x32>
+  800db0:	0f b6 19             	movzbl (%ecx),%ebx
+  800db3:	84 db                	test   %bl,%bl
+  800db5:	75 ec                	jne    800da3 <strlcpy+0x1c>
+  800db7:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  800db9:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  800dbc:	29 f0                	sub    %esi,%eax
+}
+  800dbe:	5b                   	pop    %ebx
+  800dbf:	5e                   	pop    %esi
+  800dc0:	5d                   	pop    %ebp
+  800dc1:	c3                   	ret
+
+00800dc2 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800dc2:	55                   	push   %ebp
+  800dc3:	89 e5                	mov    %esp,%ebp
+  800dc5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800dc8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  800dcb:	eb 06                	jmp    800dd3 <strcmp+0x11>
+    p++, q++;
+  800dcd:	83 c1 01             	add    $0x1,%ecx
+  800dd0:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  800dd3:	0f b6 01             	movzbl (%ecx),%eax
+  800dd6:	84 c0                	test   %al,%al
+  800dd8:	74 04                	je     800dde <strcmp+0x1c>
+  800dda:	3a 02                	cmp    (%edx),%al
+  800ddc:	74 ef                	je     800dcd <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  800dde:	0f b6 c0             	movzbl %al,%eax
+  800de1:	0f b6 12             	movzbl (%edx),%edx
+  800de4:	29 d0                	sub    %edx,%eax
+}
+  800de6:	5d                   	pop    %ebp
+  800de7:	c3                   	ret
+
+00800de8 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800de8:	55                   	push   %ebp
+  800de9:	89 e5                	mov    %esp,%ebp
+  800deb:	53                   	push   %ebx
+  800dec:	8b 45 08             	mov    0x8(%ebp),%eax
+  800def:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800df2:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  800df5:	eb 09                	jmp    800e00 <strncmp+0x18>
+    n--, p++, q++;
+  800df7:	83 ea 01             	sub    $0x1,%edx
+  800dfa:	83 c0 01             	add    $0x1,%eax
+  800dfd:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  800e00:	85 d2                	test   %edx,%edx
+  800e02:	74 18                	je     800e1c <strncmp+0x34>
+  800e04:	0f b6 18             	movzbl (%eax),%ebx
+  800e07:	84 db                	test   %bl,%bl
+  800e09:	74 04                	je     800e0f <strncmp+0x27>
+  800e0b:	3a 19                	cmp    (%ecx),%bl
+  800e0d:	74 e8                	je     800df7 <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800e0f:	0f b6 00             	movzbl (%eax),%eax
+  800e12:	0f b6 11             	movzbl (%ecx),%edx
+  800e15:	29 d0                	sub    %edx,%eax
+}
+  800e17:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800e1a:	c9                   	leave
+  800e1b:	c3                   	ret
+    return 0;
+  800e1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e21:	eb f4                	jmp    800e17 <strncmp+0x2f>
+
+00800e23 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800e23:	55                   	push   %ebp
+  800e24:	89 e5                	mov    %esp,%ebp
+  800e26:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e29:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800e2d:	eb 03                	jmp    800e32 <strchr+0xf>
+  800e2f:	83 c0 01             	add    $0x1,%eax
+  800e32:	0f b6 10             	movzbl (%eax),%edx
+  800e35:	84 d2                	test   %dl,%dl
+  800e37:	74 06                	je     800e3f <strchr+0x1c>
+    if (*s == c)
+  800e39:	38 ca                	cmp    %cl,%dl
+  800e3b:	75 f2                	jne    800e2f <strchr+0xc>
+  800e3d:	eb 05                	jmp    800e44 <strchr+0x21>
+      return (char*)s;
+  return 0;
+  800e3f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e44:	5d                   	pop    %ebp
+  800e45:	c3                   	ret
+
+00800e46 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800e46:	55                   	push   %ebp
+  800e47:	89 e5                	mov    %esp,%ebp
+  800e49:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e4c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800e50:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  800e53:	38 ca                	cmp    %cl,%dl
+  800e55:	74 09                	je     800e60 <strfind+0x1a>
+  800e57:	84 d2                	test   %dl,%dl
+  800e59:	74 05                	je     800e60 <strfind+0x1a>
+  for (; *s; s++)
+  800e5b:	83 c0 01             	add    $0x1,%eax
+  800e5e:	eb f0                	jmp    800e50 <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  800e60:	5d                   	pop    %ebp
+  800e61:	c3                   	ret
+
+00800e62 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800e62:	55                   	push   %ebp
+  800e63:	89 e5                	mov    %esp,%ebp
+  800e65:	57                   	push   %edi
+  800e66:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800e69:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  800e6c:	85 c9                	test   %ecx,%ecx
+  800e6e:	74 20                	je     800e90 <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  800e70:	89 f8                	mov    %edi,%eax
+  800e72:	09 c8                	or     %ecx,%eax
+  800e74:	a8 03                	test   $0x3,%al
+  800e76:	75 12                	jne    800e8a <memset+0x28>
+    c &= 0xFF;
+  800e78:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800e7c:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  800e82:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  800e85:	fc                   	cld
+  800e86:	f3 ab                	rep stos %eax,%es:(%edi)
+  800e88:	eb 06                	jmp    800e90 <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  800e8a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e8d:	fc                   	cld
+  800e8e:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  800e90:	89 f8                	mov    %edi,%eax
+  800e92:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800e95:	c9                   	leave
+  800e96:	c3                   	ret
+
+00800e97 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800e97:	55                   	push   %ebp
+  800e98:	89 e5                	mov    %esp,%ebp
+  800e9a:	57                   	push   %edi
+  800e9b:	56                   	push   %esi
+  800e9c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e9f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800ea2:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  800ea5:	39 c6                	cmp    %eax,%esi
+  800ea7:	73 32                	jae    800edb <memmove+0x44>
+  800ea9:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800eac:	39 d0                	cmp    %edx,%eax
+  800eae:	73 2b                	jae    800edb <memmove+0x44>
+    s += n;
+    d += n;
+  800eb0:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800eb3:	89 d6                	mov    %edx,%esi
+  800eb5:	09 fe                	or     %edi,%esi
+  800eb7:	09 ce                	or     %ecx,%esi
+  800eb9:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800ebf:	75 0e                	jne    800ecf <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800ec1:	83 ef 04             	sub    $0x4,%edi
+  800ec4:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800ec7:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  800eca:	fd                   	std
+  800ecb:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ecd:	eb 09                	jmp    800ed8 <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800ecf:	83 ef 01             	sub    $0x1,%edi
+  800ed2:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  800ed5:	fd                   	std
+  800ed6:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  800ed8:	fc                   	cld
+  800ed9:	eb 1a                	jmp    800ef5 <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800edb:	89 f2                	mov    %esi,%edx
+  800edd:	09 c2                	or     %eax,%edx
+  800edf:	09 ca                	or     %ecx,%edx
+  800ee1:	f6 c2 03             	test   $0x3,%dl
+  800ee4:	75 0a                	jne    800ef0 <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800ee6:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  800ee9:	89 c7                	mov    %eax,%edi
+  800eeb:	fc                   	cld
+  800eec:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800eee:	eb 05                	jmp    800ef5 <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  800ef0:	89 c7                	mov    %eax,%edi
+  800ef2:	fc                   	cld
+  800ef3:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  800ef5:	5e                   	pop    %esi
+  800ef6:	5f                   	pop    %edi
+  800ef7:	5d                   	pop    %ebp
+  800ef8:	c3                   	ret
+
+00800ef9 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800ef9:	55                   	push   %ebp
+  800efa:	89 e5                	mov    %esp,%ebp
+  800efc:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  800eff:	ff 75 10             	push   0x10(%ebp)
+  800f02:	ff 75 0c             	push   0xc(%ebp)
+  800f05:	ff 75 08             	push   0x8(%ebp)
+  800f08:	e8 8a ff ff ff       	call   800e97 <memmove>
+}
+  800f0d:	c9                   	leave
+  800f0e:	c3                   	ret
+
+00800f0f <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800f0f:	55                   	push   %ebp
+  800f10:	89 e5                	mov    %esp,%ebp
+  800f12:	56                   	push   %esi
+  800f13:	53                   	push   %ebx
+  800f14:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f17:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  800f1a:	89 c6                	mov    %eax,%esi
+  800f1c:	03 75 10             	add    0x10(%ebp),%esi
+  800f1f:	eb 06                	jmp    800f27 <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  800f21:	83 c0 01             	add    $0x1,%eax
+  800f24:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  800f27:	39 f0                	cmp    %esi,%eax
+  800f29:	74 14                	je     800f3f <memcmp+0x30>
+    if (*s1 != *s2)
+  800f2b:	0f b6 08             	movzbl (%eax),%ecx
+  800f2e:	0f b6 1a             	movzbl (%edx),%ebx
+  800f31:	38 d9                	cmp    %bl,%cl
+  800f33:	74 ec                	je     800f21 <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  800f35:	0f b6 c1             	movzbl %cl,%eax
+  800f38:	0f b6 db             	movzbl %bl,%ebx
+  800f3b:	29 d8                	sub    %ebx,%eax
+  800f3d:	eb 05                	jmp    800f44 <memcmp+0x35>
+  }
+
+  return 0;
+  800f3f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f44:	5b                   	pop    %ebx
+  800f45:	5e                   	pop    %esi
+  800f46:	5d                   	pop    %ebp
+  800f47:	c3                   	ret
+
+00800f48 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800f48:	55                   	push   %ebp
+  800f49:	89 e5                	mov    %esp,%ebp
+  800f4b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f4e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  800f51:	89 c2                	mov    %eax,%edx
+  800f53:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  800f56:	eb 03                	jmp    800f5b <memfind+0x13>
+  800f58:	83 c0 01             	add    $0x1,%eax
+  800f5b:	39 d0                	cmp    %edx,%eax
+  800f5d:	73 04                	jae    800f63 <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  800f5f:	38 08                	cmp    %cl,(%eax)
+  800f61:	75 f5                	jne    800f58 <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  800f63:	5d                   	pop    %ebp
+  800f64:	c3                   	ret
+
+00800f65 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800f65:	55                   	push   %ebp
+  800f66:	89 e5                	mov    %esp,%ebp
+  800f68:	57                   	push   %edi
+  800f69:	56                   	push   %esi
+  800f6a:	53                   	push   %ebx
+  800f6b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f6e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  800f71:	eb 03                	jmp    800f76 <strtol+0x11>
+    s++;
+  800f73:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  800f76:	0f b6 02             	movzbl (%edx),%eax
+  800f79:	3c 20                	cmp    $0x20,%al
+  800f7b:	74 f6                	je     800f73 <strtol+0xe>
+  800f7d:	3c 09                	cmp    $0x9,%al
+  800f7f:	74 f2                	je     800f73 <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  800f81:	3c 2b                	cmp    $0x2b,%al
+  800f83:	74 2a                	je     800faf <strtol+0x4a>
+  int neg = 0;
+  800f85:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  800f8a:	3c 2d                	cmp    $0x2d,%al
+  800f8c:	74 2b                	je     800fb9 <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800f8e:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800f94:	75 0f                	jne    800fa5 <strtol+0x40>
+  800f96:	80 3a 30             	cmpb   $0x30,(%edx)
+  800f99:	74 28                	je     800fc3 <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  800f9b:	85 db                	test   %ebx,%ebx
+  800f9d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800fa2:	0f 44 d8             	cmove  %eax,%ebx
+  800fa5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800faa:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800fad:	eb 46                	jmp    800ff5 <strtol+0x90>
+    s++;
+  800faf:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  800fb2:	bf 00 00 00 00       	mov    $0x0,%edi
+  800fb7:	eb d5                	jmp    800f8e <strtol+0x29>
+    s++, neg = 1;
+  800fb9:	83 c2 01             	add    $0x1,%edx
+  800fbc:	bf 01 00 00 00       	mov    $0x1,%edi
+  800fc1:	eb cb                	jmp    800f8e <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800fc3:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800fc7:	74 0e                	je     800fd7 <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  800fc9:	85 db                	test   %ebx,%ebx
+  800fcb:	75 d8                	jne    800fa5 <strtol+0x40>
+    s++, base = 8;
+  800fcd:	83 c2 01             	add    $0x1,%edx
+  800fd0:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800fd5:	eb ce                	jmp    800fa5 <strtol+0x40>
+    s += 2, base = 16;
+  800fd7:	83 c2 02             	add    $0x2,%edx
+  800fda:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800fdf:	eb c4                	jmp    800fa5 <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  800fe1:	0f be c0             	movsbl %al,%eax
+  800fe4:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  800fe7:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800fea:	7d 3a                	jge    801026 <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  800fec:	83 c2 01             	add    $0x1,%edx
+  800fef:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800ff3:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  800ff5:	0f b6 02             	movzbl (%edx),%eax
+  800ff8:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800ffb:	89 f3                	mov    %esi,%ebx
+  800ffd:	80 fb 09             	cmp    $0x9,%bl
+  801000:	76 df                	jbe    800fe1 <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  801002:	8d 70 9f             	lea    -0x61(%eax),%esi
+  801005:	89 f3                	mov    %esi,%ebx
+  801007:	80 fb 19             	cmp    $0x19,%bl
+  80100a:	77 08                	ja     801014 <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  80100c:	0f be c0             	movsbl %al,%eax
+  80100f:	83 e8 57             	sub    $0x57,%eax
+  801012:	eb d3                	jmp    800fe7 <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  801014:	8d 70 bf             	lea    -0x41(%eax),%esi
+  801017:	89 f3                	mov    %esi,%ebx
+  801019:	80 fb 19             	cmp    $0x19,%bl
+  80101c:	77 08                	ja     801026 <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  80101e:	0f be c0             	movsbl %al,%eax
+  801021:	83 e8 37             	sub    $0x37,%eax
+  801024:	eb c1                	jmp    800fe7 <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  801026:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80102a:	74 05                	je     801031 <strtol+0xcc>
+    *endptr = (char*)s;
+  80102c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80102f:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  801031:	89 c8                	mov    %ecx,%eax
+  801033:	f7 d8                	neg    %eax
+  801035:	85 ff                	test   %edi,%edi
+  801037:	0f 45 c8             	cmovne %eax,%ecx
+}
+  80103a:	89 c8                	mov    %ecx,%eax
+  80103c:	5b                   	pop    %ebx
+  80103d:	5e                   	pop    %esi
+  80103e:	5f                   	pop    %edi
+  80103f:	5d                   	pop    %ebp
+  801040:	c3                   	ret
+
+00801041 <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  801041:	55                   	push   %ebp
+  801042:	89 e5                	mov    %esp,%ebp
+  801044:	57                   	push   %edi
+  801045:	56                   	push   %esi
+  801046:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801047:	b8 00 00 00 00       	mov    $0x0,%eax
+  80104c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80104f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801052:	89 c3                	mov    %eax,%ebx
+  801054:	89 c7                	mov    %eax,%edi
+  801056:	89 c6                	mov    %eax,%esi
+  801058:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  80105a:	5b                   	pop    %ebx
+  80105b:	5e                   	pop    %esi
+  80105c:	5f                   	pop    %edi
+  80105d:	5d                   	pop    %ebp
+  80105e:	c3                   	ret
+
+0080105f <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  80105f:	55                   	push   %ebp
+  801060:	89 e5                	mov    %esp,%ebp
+  801062:	57                   	push   %edi
+  801063:	56                   	push   %esi
+  801064:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801065:	ba 00 00 00 00       	mov    $0x0,%edx
+  80106a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80106f:	89 d1                	mov    %edx,%ecx
+  801071:	89 d3                	mov    %edx,%ebx
+  801073:	89 d7                	mov    %edx,%edi
+  801075:	89 d6                	mov    %edx,%esi
+  801077:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  801079:	5b                   	pop    %ebx
+  80107a:	5e                   	pop    %esi
+  80107b:	5f                   	pop    %edi
+  80107c:	5d                   	pop    %ebp
+  80107d:	c3                   	ret
+
+0080107e <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  80107e:	55                   	push   %ebp
+  80107f:	89 e5                	mov    %esp,%ebp
+  801081:	57                   	push   %edi
+  801082:	56                   	push   %esi
+  801083:	53                   	push   %ebx
+  801084:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801087:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80108c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80108f:	b8 03 00 00 00       	mov    $0x3,%eax
+  801094:	89 cb                	mov    %ecx,%ebx
+  801096:	89 cf                	mov    %ecx,%edi
+  801098:	89 ce                	mov    %ecx,%esi
+  80109a:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80109c:	85 c0                	test   %eax,%eax
+  80109e:	7f 08                	jg     8010a8 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  8010a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010a3:	5b                   	pop    %ebx
+  8010a4:	5e                   	pop    %esi
+  8010a5:	5f                   	pop    %edi
+  8010a6:	5d                   	pop    %ebp
+  8010a7:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8010a8:	83 ec 0c             	sub    $0xc,%esp
+  8010ab:	50                   	push   %eax
+  8010ac:	6a 03                	push   $0x3
+  8010ae:	68 a3 38 80 00       	push   $0x8038a3
+  8010b3:	6a 23                	push   $0x23
+  8010b5:	68 c0 38 80 00       	push   $0x8038c0
+  8010ba:	e8 89 f5 ff ff       	call   800648 <_panic>
+
+008010bf <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  8010bf:	55                   	push   %ebp
+  8010c0:	89 e5                	mov    %esp,%ebp
+  8010c2:	57                   	push   %edi
+  8010c3:	56                   	push   %esi
+  8010c4:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8010c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010ca:	b8 02 00 00 00       	mov    $0x2,%eax
+  8010cf:	89 d1                	mov    %edx,%ecx
+  8010d1:	89 d3                	mov    %edx,%ebx
+  8010d3:	89 d7                	mov    %edx,%edi
+  8010d5:	89 d6                	mov    %edx,%esi
+  8010d7:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  8010d9:	5b                   	pop    %ebx
+  8010da:	5e                   	pop    %esi
+  8010db:	5f                   	pop    %edi
+  8010dc:	5d                   	pop    %ebp
+  8010dd:	c3                   	ret
+
+008010de <sys_yield>:
+
+void
+sys_yield(void)
+{
+  8010de:	55                   	push   %ebp
+  8010df:	89 e5                	mov    %esp,%ebp
+  8010e1:	57                   	push   %edi
+  8010e2:	56                   	push   %esi
+  8010e3:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8010e4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010e9:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8010ee:	89 d1                	mov    %edx,%ecx
+  8010f0:	89 d3                	mov    %edx,%ebx
+  8010f2:	89 d7                	mov    %edx,%edi
+  8010f4:	89 d6                	mov    %edx,%esi
+  8010f6:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  8010f8:	5b                   	pop    %ebx
+  8010f9:	5e                   	pop    %esi
+  8010fa:	5f                   	pop    %edi
+  8010fb:	5d                   	pop    %ebp
+  8010fc:	c3                   	ret
+
+008010fd <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  8010fd:	55                   	push   %ebp
+  8010fe:	89 e5                	mov    %esp,%ebp
+  801100:	57                   	push   %edi
+  801101:	56                   	push   %esi
+  801102:	53                   	push   %ebx
+  801103:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  801106:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  80110a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80110f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801112:	b8 14 00 00 00       	mov    $0x14,%eax
+  801117:	89 df                	mov    %ebx,%edi
+  801119:	89 de                	mov    %ebx,%esi
+  80111b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80111d:	85 c0                	test   %eax,%eax
+  80111f:	7f 08                	jg     801129 <sys_env_set_cow+0x2c>
+}
+  801121:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801124:	5b                   	pop    %ebx
+  801125:	5e                   	pop    %esi
+  801126:	5f                   	pop    %edi
+  801127:	5d                   	pop    %ebp
+  801128:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801129:	83 ec 0c             	sub    $0xc,%esp
+  80112c:	50                   	push   %eax
+  80112d:	6a 14                	push   $0x14
+  80112f:	68 a3 38 80 00       	push   $0x8038a3
+  801134:	6a 23                	push   $0x23
+  801136:	68 c0 38 80 00       	push   $0x8038c0
+  80113b:	e8 08 f5 ff ff       	call   800648 <_panic>
+
+00801140 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  801140:	55                   	push   %ebp
+  801141:	89 e5                	mov    %esp,%ebp
+  801143:	57                   	push   %edi
+  801144:	56                   	push   %esi
+  801145:	53                   	push   %ebx
+  801146:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801149:	be 00 00 00 00       	mov    $0x0,%esi
+  80114e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801151:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801154:	b8 04 00 00 00       	mov    $0x4,%eax
+  801159:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80115c:	89 f7                	mov    %esi,%edi
+  80115e:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801160:	85 c0                	test   %eax,%eax
+  801162:	7f 08                	jg     80116c <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  801164:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801167:	5b                   	pop    %ebx
+  801168:	5e                   	pop    %esi
+  801169:	5f                   	pop    %edi
+  80116a:	5d                   	pop    %ebp
+  80116b:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80116c:	83 ec 0c             	sub    $0xc,%esp
+  80116f:	50                   	push   %eax
+  801170:	6a 04                	push   $0x4
+  801172:	68 a3 38 80 00       	push   $0x8038a3
+  801177:	6a 23                	push   $0x23
+  801179:	68 c0 38 80 00       	push   $0x8038c0
+  80117e:	e8 c5 f4 ff ff       	call   800648 <_panic>
+
+00801183 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  801183:	55                   	push   %ebp
+  801184:	89 e5                	mov    %esp,%ebp
+  801186:	57                   	push   %edi
+  801187:	56                   	push   %esi
+  801188:	53                   	push   %ebx
+  801189:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80118c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80118f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801192:	b8 05 00 00 00       	mov    $0x5,%eax
+  801197:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80119a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80119d:	8b 75 18             	mov    0x18(%ebp),%esi
+  8011a0:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8011a2:	85 c0                	test   %eax,%eax
+  8011a4:	7f 08                	jg     8011ae <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  8011a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011a9:	5b                   	pop    %ebx
+  8011aa:	5e                   	pop    %esi
+  8011ab:	5f                   	pop    %edi
+  8011ac:	5d                   	pop    %ebp
+  8011ad:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8011ae:	83 ec 0c             	sub    $0xc,%esp
+  8011b1:	50                   	push   %eax
+  8011b2:	6a 05                	push   $0x5
+  8011b4:	68 a3 38 80 00       	push   $0x8038a3
+  8011b9:	6a 23                	push   $0x23
+  8011bb:	68 c0 38 80 00       	push   $0x8038c0
+  8011c0:	e8 83 f4 ff ff       	call   800648 <_panic>
+
+008011c5 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  8011c5:	55                   	push   %ebp
+  8011c6:	89 e5                	mov    %esp,%ebp
+  8011c8:	57                   	push   %edi
+  8011c9:	56                   	push   %esi
+  8011ca:	53                   	push   %ebx
+  8011cb:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8011ce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011d3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011d9:	b8 06 00 00 00       	mov    $0x6,%eax
+  8011de:	89 df                	mov    %ebx,%edi
+  8011e0:	89 de                	mov    %ebx,%esi
+  8011e2:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8011e4:	85 c0                	test   %eax,%eax
+  8011e6:	7f 08                	jg     8011f0 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  8011e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011eb:	5b                   	pop    %ebx
+  8011ec:	5e                   	pop    %esi
+  8011ed:	5f                   	pop    %edi
+  8011ee:	5d                   	pop    %ebp
+  8011ef:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8011f0:	83 ec 0c             	sub    $0xc,%esp
+  8011f3:	50                   	push   %eax
+  8011f4:	6a 06                	push   $0x6
+  8011f6:	68 a3 38 80 00       	push   $0x8038a3
+  8011fb:	6a 23                	push   $0x23
+  8011fd:	68 c0 38 80 00       	push   $0x8038c0
+  801202:	e8 41 f4 ff ff       	call   800648 <_panic>
+
+00801207 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  801207:	55                   	push   %ebp
+  801208:	89 e5                	mov    %esp,%ebp
+  80120a:	57                   	push   %edi
+  80120b:	56                   	push   %esi
+  80120c:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80120d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801210:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801213:	b8 11 00 00 00       	mov    $0x11,%eax
+  801218:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80121b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80121e:	8b 75 18             	mov    0x18(%ebp),%esi
+  801221:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  801223:	5b                   	pop    %ebx
+  801224:	5e                   	pop    %esi
+  801225:	5f                   	pop    %edi
+  801226:	5d                   	pop    %ebp
+  801227:	c3                   	ret
+
+00801228 <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  801228:	55                   	push   %ebp
+  801229:	89 e5                	mov    %esp,%ebp
+  80122b:	57                   	push   %edi
+  80122c:	56                   	push   %esi
+  80122d:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80122e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801231:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801234:	b8 12 00 00 00       	mov    $0x12,%eax
+  801239:	be 00 00 00 00       	mov    $0x0,%esi
+  80123e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801241:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801244:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  801246:	5b                   	pop    %ebx
+  801247:	5e                   	pop    %esi
+  801248:	5f                   	pop    %edi
+  801249:	5d                   	pop    %ebp
+  80124a:	c3                   	ret
+
+0080124b <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  80124b:	55                   	push   %ebp
+  80124c:	89 e5                	mov    %esp,%ebp
+  80124e:	57                   	push   %edi
+  80124f:	56                   	push   %esi
+  801250:	53                   	push   %ebx
+  801251:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801254:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801259:	8b 55 08             	mov    0x8(%ebp),%edx
+  80125c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80125f:	b8 16 00 00 00       	mov    $0x16,%eax
+  801264:	89 df                	mov    %ebx,%edi
+  801266:	89 de                	mov    %ebx,%esi
+  801268:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80126a:	85 c0                	test   %eax,%eax
+  80126c:	7f 08                	jg     801276 <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  80126e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801271:	5b                   	pop    %ebx
+  801272:	5e                   	pop    %esi
+  801273:	5f                   	pop    %edi
+  801274:	5d                   	pop    %ebp
+  801275:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801276:	83 ec 0c             	sub    $0xc,%esp
+  801279:	50                   	push   %eax
+  80127a:	6a 16                	push   $0x16
+  80127c:	68 a3 38 80 00       	push   $0x8038a3
+  801281:	6a 23                	push   $0x23
+  801283:	68 c0 38 80 00       	push   $0x8038c0
+  801288:	e8 bb f3 ff ff       	call   800648 <_panic>
+
+0080128d <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  80128d:	55                   	push   %ebp
+  80128e:	89 e5                	mov    %esp,%ebp
+  801290:	57                   	push   %edi
+  801291:	56                   	push   %esi
+  801292:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801293:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801298:	8b 55 08             	mov    0x8(%ebp),%edx
+  80129b:	b8 17 00 00 00       	mov    $0x17,%eax
+  8012a0:	89 cb                	mov    %ecx,%ebx
+  8012a2:	89 cf                	mov    %ecx,%edi
+  8012a4:	89 ce                	mov    %ecx,%esi
+  8012a6:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  8012a8:	5b                   	pop    %ebx
+  8012a9:	5e                   	pop    %esi
+  8012aa:	5f                   	pop    %edi
+  8012ab:	5d                   	pop    %ebp
+  8012ac:	c3                   	ret
+
+008012ad <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  8012ad:	55                   	push   %ebp
+  8012ae:	89 e5                	mov    %esp,%ebp
+  8012b0:	57                   	push   %edi
+  8012b1:	56                   	push   %esi
+  8012b2:	53                   	push   %ebx
+  8012b3:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8012b6:	be 00 00 00 00       	mov    $0x0,%esi
+  8012bb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012be:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012c1:	b8 18 00 00 00       	mov    $0x18,%eax
+  8012c6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012c9:	89 f7                	mov    %esi,%edi
+  8012cb:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8012cd:	85 c0                	test   %eax,%eax
+  8012cf:	7f 08                	jg     8012d9 <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  8012d1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012d4:	5b                   	pop    %ebx
+  8012d5:	5e                   	pop    %esi
+  8012d6:	5f                   	pop    %edi
+  8012d7:	5d                   	pop    %ebp
+  8012d8:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8012d9:	83 ec 0c             	sub    $0xc,%esp
+  8012dc:	50                   	push   %eax
+  8012dd:	6a 18                	push   $0x18
+  8012df:	68 a3 38 80 00       	push   $0x8038a3
+  8012e4:	6a 23                	push   $0x23
+  8012e6:	68 c0 38 80 00       	push   $0x8038c0
+  8012eb:	e8 58 f3 ff ff       	call   800648 <_panic>
+
+008012f0 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  8012f0:	55                   	push   %ebp
+  8012f1:	89 e5                	mov    %esp,%ebp
+  8012f3:	57                   	push   %edi
+  8012f4:	56                   	push   %esi
+  8012f5:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8012f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8012fb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012fe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801301:	b8 19 00 00 00       	mov    $0x19,%eax
+  801306:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801309:	89 f7                	mov    %esi,%edi
+  80130b:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  80130d:	5b                   	pop    %ebx
+  80130e:	5e                   	pop    %esi
+  80130f:	5f                   	pop    %edi
+  801310:	5d                   	pop    %ebp
+  801311:	c3                   	ret
+
+00801312 <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  801312:	55                   	push   %ebp
+  801313:	89 e5                	mov    %esp,%ebp
+  801315:	57                   	push   %edi
+  801316:	56                   	push   %esi
+  801317:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801318:	ba 00 00 00 00       	mov    $0x0,%edx
+  80131d:	b8 15 00 00 00       	mov    $0x15,%eax
+  801322:	89 d1                	mov    %edx,%ecx
+  801324:	89 d3                	mov    %edx,%ebx
+  801326:	89 d7                	mov    %edx,%edi
+  801328:	89 d6                	mov    %edx,%esi
+  80132a:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  80132c:	5b                   	pop    %ebx
+  80132d:	5e                   	pop    %esi
+  80132e:	5f                   	pop    %edi
+  80132f:	5d                   	pop    %ebp
+  801330:	c3                   	ret
+
+00801331 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801331:	55                   	push   %ebp
+  801332:	89 e5                	mov    %esp,%ebp
+  801334:	57                   	push   %edi
+  801335:	56                   	push   %esi
+  801336:	53                   	push   %ebx
+  801337:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80133a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80133f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801342:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801345:	b8 08 00 00 00       	mov    $0x8,%eax
+  80134a:	89 df                	mov    %ebx,%edi
+  80134c:	89 de                	mov    %ebx,%esi
+  80134e:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801350:	85 c0                	test   %eax,%eax
+  801352:	7f 08                	jg     80135c <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801354:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801357:	5b                   	pop    %ebx
+  801358:	5e                   	pop    %esi
+  801359:	5f                   	pop    %edi
+  80135a:	5d                   	pop    %ebp
+  80135b:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80135c:	83 ec 0c             	sub    $0xc,%esp
+  80135f:	50                   	push   %eax
+  801360:	6a 08                	push   $0x8
+  801362:	68 a3 38 80 00       	push   $0x8038a3
+  801367:	6a 23                	push   $0x23
+  801369:	68 c0 38 80 00       	push   $0x8038c0
+  80136e:	e8 d5 f2 ff ff       	call   800648 <_panic>
+
+00801373 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801373:	55                   	push   %ebp
+  801374:	89 e5                	mov    %esp,%ebp
+  801376:	57                   	push   %edi
+  801377:	56                   	push   %esi
+  801378:	53                   	push   %ebx
+  801379:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80137c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801381:	8b 55 08             	mov    0x8(%ebp),%edx
+  801384:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801387:	b8 09 00 00 00       	mov    $0x9,%eax
+  80138c:	89 df                	mov    %ebx,%edi
+  80138e:	89 de                	mov    %ebx,%esi
+  801390:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801392:	85 c0                	test   %eax,%eax
+  801394:	7f 08                	jg     80139e <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  801396:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801399:	5b                   	pop    %ebx
+  80139a:	5e                   	pop    %esi
+  80139b:	5f                   	pop    %edi
+  80139c:	5d                   	pop    %ebp
+  80139d:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80139e:	83 ec 0c             	sub    $0xc,%esp
+  8013a1:	50                   	push   %eax
+  8013a2:	6a 09                	push   $0x9
+  8013a4:	68 a3 38 80 00       	push   $0x8038a3
+  8013a9:	6a 23                	push   $0x23
+  8013ab:	68 c0 38 80 00       	push   $0x8038c0
+  8013b0:	e8 93 f2 ff ff       	call   800648 <_panic>
+
+008013b5 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8013b5:	55                   	push   %ebp
+  8013b6:	89 e5                	mov    %esp,%ebp
+  8013b8:	57                   	push   %edi
+  8013b9:	56                   	push   %esi
+  8013ba:	53                   	push   %ebx
+  8013bb:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8013be:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013c6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013c9:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8013ce:	89 df                	mov    %ebx,%edi
+  8013d0:	89 de                	mov    %ebx,%esi
+  8013d2:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8013d4:	85 c0                	test   %eax,%eax
+  8013d6:	7f 08                	jg     8013e0 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  8013d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013db:	5b                   	pop    %ebx
+  8013dc:	5e                   	pop    %esi
+  8013dd:	5f                   	pop    %edi
+  8013de:	5d                   	pop    %ebp
+  8013df:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8013e0:	83 ec 0c             	sub    $0xc,%esp
+  8013e3:	50                   	push   %eax
+  8013e4:	6a 0a                	push   $0xa
+  8013e6:	68 a3 38 80 00       	push   $0x8038a3
+  8013eb:	6a 23                	push   $0x23
+  8013ed:	68 c0 38 80 00       	push   $0x8038c0
+  8013f2:	e8 51 f2 ff ff       	call   800648 <_panic>
+
+008013f7 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  8013f7:	55                   	push   %ebp
+  8013f8:	89 e5                	mov    %esp,%ebp
+  8013fa:	57                   	push   %edi
+  8013fb:	56                   	push   %esi
+  8013fc:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8013fd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801400:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801403:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801408:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80140b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80140e:	8b 75 18             	mov    0x18(%ebp),%esi
+  801411:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  801413:	5b                   	pop    %ebx
+  801414:	5e                   	pop    %esi
+  801415:	5f                   	pop    %edi
+  801416:	5d                   	pop    %ebp
+  801417:	c3                   	ret
+
+00801418 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  801418:	55                   	push   %ebp
+  801419:	89 e5                	mov    %esp,%ebp
+  80141b:	57                   	push   %edi
+  80141c:	56                   	push   %esi
+  80141d:	53                   	push   %ebx
+  80141e:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801421:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801426:	8b 55 08             	mov    0x8(%ebp),%edx
+  801429:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80142c:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801431:	89 df                	mov    %ebx,%edi
+  801433:	89 de                	mov    %ebx,%esi
+  801435:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801437:	85 c0                	test   %eax,%eax
+  801439:	7f 08                	jg     801443 <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  80143b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80143e:	5b                   	pop    %ebx
+  80143f:	5e                   	pop    %esi
+  801440:	5f                   	pop    %edi
+  801441:	5d                   	pop    %ebp
+  801442:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801443:	83 ec 0c             	sub    $0xc,%esp
+  801446:	50                   	push   %eax
+  801447:	6a 0d                	push   $0xd
+  801449:	68 a3 38 80 00       	push   $0x8038a3
+  80144e:	6a 23                	push   $0x23
+  801450:	68 c0 38 80 00       	push   $0x8038c0
+  801455:	e8 ee f1 ff ff       	call   800648 <_panic>
+
+0080145a <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  80145a:	55                   	push   %ebp
+  80145b:	89 e5                	mov    %esp,%ebp
+  80145d:	57                   	push   %edi
+  80145e:	56                   	push   %esi
+  80145f:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801460:	ba 00 00 00 00       	mov    $0x0,%edx
+  801465:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80146a:	89 d1                	mov    %edx,%ecx
+  80146c:	89 d3                	mov    %edx,%ebx
+  80146e:	89 d7                	mov    %edx,%edi
+  801470:	89 d6                	mov    %edx,%esi
+  801472:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801474:	5b                   	pop    %ebx
+  801475:	5e                   	pop    %esi
+  801476:	5f                   	pop    %edi
+  801477:	5d                   	pop    %ebp
+  801478:	c3                   	ret
+
+00801479 <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  801479:	55                   	push   %ebp
+  80147a:	89 e5                	mov    %esp,%ebp
+  80147c:	57                   	push   %edi
+  80147d:	56                   	push   %esi
+  80147e:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80147f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801482:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801485:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80148a:	be 00 00 00 00       	mov    $0x0,%esi
+  80148f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801492:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801495:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  801497:	5b                   	pop    %ebx
+  801498:	5e                   	pop    %esi
+  801499:	5f                   	pop    %edi
+  80149a:	5d                   	pop    %ebp
+  80149b:	c3                   	ret
+
+0080149c <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  80149c:	55                   	push   %ebp
+  80149d:	89 e5                	mov    %esp,%ebp
+  80149f:	57                   	push   %edi
+  8014a0:	56                   	push   %esi
+  8014a1:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8014a2:	be 00 00 00 00       	mov    $0x0,%esi
+  8014a7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014aa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014ad:	b8 10 00 00 00       	mov    $0x10,%eax
+  8014b2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014b5:	89 f7                	mov    %esi,%edi
+  8014b7:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  8014b9:	5b                   	pop    %ebx
+  8014ba:	5e                   	pop    %esi
+  8014bb:	5f                   	pop    %edi
+  8014bc:	5d                   	pop    %ebp
+  8014bd:	c3                   	ret
+
+008014be <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  8014be:	55                   	push   %ebp
+  8014bf:	89 e5                	mov    %esp,%ebp
+  8014c1:	57                   	push   %edi
+  8014c2:	56                   	push   %esi
+  8014c3:	53                   	push   %ebx
+  8014c4:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  8014c7:	80 3d 08 58 80 00 00 	cmpb   $0x0,0x805808
+  8014ce:	74 41                	je     801511 <sys_batch+0x53>
+  8014d0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014d3:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  8014d6:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  8014dd:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8014e0:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  8014e3:	7d 45                	jge    80152a <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  8014e5:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8014e8:	8b 06                	mov    (%esi),%eax
+  8014ea:	8b 56 04             	mov    0x4(%esi),%edx
+  8014ed:	8b 4e 08             	mov    0x8(%esi),%ecx
+  8014f0:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  8014f3:	8b 7e 10             	mov    0x10(%esi),%edi
+  8014f6:	8b 76 14             	mov    0x14(%esi),%esi
+  8014f9:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  8014fb:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8014fe:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  801501:	83 c6 1c             	add    $0x1c,%esi
+  801504:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  801507:	85 c0                	test   %eax,%eax
+  801509:	78 1f                	js     80152a <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  80150b:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  80150f:	eb cc                	jmp    8014dd <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  801511:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801516:	b8 13 00 00 00       	mov    $0x13,%eax
+  80151b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80151e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801521:	89 df                	mov    %ebx,%edi
+  801523:	89 de                	mov    %ebx,%esi
+  801525:	cd 30                	int    $0x30
+  801527:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  80152a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80152d:	83 c4 08             	add    $0x8,%esp
+  801530:	5b                   	pop    %ebx
+  801531:	5e                   	pop    %esi
+  801532:	5f                   	pop    %edi
+  801533:	5d                   	pop    %ebp
+  801534:	c3                   	ret
+
+00801535 <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  801535:	55                   	push   %ebp
+  801536:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  801538:	8b 45 08             	mov    0x8(%ebp),%eax
+  80153b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  801541:	5d                   	pop    %ebp
+  801542:	c3                   	ret
+
+00801543 <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  801543:	55                   	push   %ebp
+  801544:	89 e5                	mov    %esp,%ebp
+  801546:	56                   	push   %esi
+  801547:	53                   	push   %ebx
+  801548:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  80154b:	8b 1e                	mov    (%esi),%ebx
+  80154d:	85 db                	test   %ebx,%ebx
+  80154f:	75 09                	jne    80155a <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  801551:	89 d8                	mov    %ebx,%eax
+  801553:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801556:	5b                   	pop    %ebx
+  801557:	5e                   	pop    %esi
+  801558:	5d                   	pop    %ebp
+  801559:	c3                   	ret
+  b->sb_n = 0;
+  80155a:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  801560:	53                   	push   %ebx
+  801561:	8d 46 04             	lea    0x4(%esi),%eax
+  801564:	50                   	push   %eax
+  801565:	e8 54 ff ff ff       	call   8014be <sys_batch>
+  80156a:	83 c4 08             	add    $0x8,%esp
+  80156d:	85 c0                	test   %eax,%eax
+  80156f:	78 1e                	js     80158f <sysbatch_flush+0x4c>
+  if (r < n)
+  801571:	39 c3                	cmp    %eax,%ebx
+  801573:	7f 07                	jg     80157c <sysbatch_flush+0x39>
+  return 0;
+  801575:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80157a:	eb d5                	jmp    801551 <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  80157c:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80157f:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  801583:	85 db                	test   %ebx,%ebx
+  801585:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80158a:	0f 49 d8             	cmovns %eax,%ebx
+  80158d:	eb c2                	jmp    801551 <sysbatch_flush+0xe>
+    return r;
+  80158f:	89 c3                	mov    %eax,%ebx
+  801591:	eb be                	jmp    801551 <sysbatch_flush+0xe>
+
+00801593 <sysbatch_add>:
+{
+  801593:	55                   	push   %ebp
+  801594:	89 e5                	mov    %esp,%ebp
+  801596:	53                   	push   %ebx
+  801597:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  80159a:	83 3b 40             	cmpl   $0x40,(%ebx)
+  80159d:	74 41                	je     8015e0 <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  80159f:	8b 03                	mov    (%ebx),%eax
+  8015a1:	8d 50 01             	lea    0x1(%eax),%edx
+  8015a4:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  8015a6:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8015a9:	01 d8                	add    %ebx,%eax
+  8015ab:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8015ae:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  8015b1:	8b 55 10             	mov    0x10(%ebp),%edx
+  8015b4:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  8015b7:	8b 55 14             	mov    0x14(%ebp),%edx
+  8015ba:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  8015bd:	8b 55 18             	mov    0x18(%ebp),%edx
+  8015c0:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  8015c3:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  8015c6:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  8015c9:	8b 55 20             	mov    0x20(%ebp),%edx
+  8015cc:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  8015cf:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  8015d6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015db:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015de:	c9                   	leave
+  8015df:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  8015e0:	53                   	push   %ebx
+  8015e1:	e8 5d ff ff ff       	call   801543 <sysbatch_flush>
+  8015e6:	83 c4 04             	add    $0x4,%esp
+  8015e9:	85 c0                	test   %eax,%eax
+  8015eb:	79 b2                	jns    80159f <sysbatch_add+0xc>
+  8015ed:	eb ec                	jmp    8015db <sysbatch_add+0x48>
+
+008015ef <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8015ef:	55                   	push   %ebp
+  8015f0:	89 e5                	mov    %esp,%ebp
+  8015f2:	53                   	push   %ebx
+  8015f3:	83 ec 04             	sub    $0x4,%esp
+  int r;
+
+  if (_pgfault_handler == 0) {
+  8015f6:	83 3d 0c 58 80 00 00 	cmpl   $0x0,0x80580c
+  8015fd:	74 0d                	je     80160c <set_pgfault_handler+0x1d>
+
+    sys_env_set_pgfault_upcall(id, _pgfault_upcall);
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  8015ff:	8b 45 08             	mov    0x8(%ebp),%eax
+  801602:	a3 0c 58 80 00       	mov    %eax,0x80580c
+}
+  801607:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80160a:	c9                   	leave
+  80160b:	c3                   	ret
+    envid_t id = sys_getenvid();
+  80160c:	e8 ae fa ff ff       	call   8010bf <sys_getenvid>
+  801611:	89 c3                	mov    %eax,%ebx
+    sys_page_alloc(id, (void *) (UXSTACKTOP - PGSIZE), (PTE_P | PTE_U | PTE_W));
+  801613:	83 ec 04             	sub    $0x4,%esp
+  801616:	6a 07                	push   $0x7
+  801618:	68 00 f0 bf ee       	push   $0xeebff000
+  80161d:	50                   	push   %eax
+  80161e:	e8 1d fb ff ff       	call   801140 <sys_page_alloc>
+    sys_env_set_pgfault_upcall(id, _pgfault_upcall);
+  801623:	83 c4 08             	add    $0x8,%esp
+  801626:	68 36 16 80 00       	push   $0x801636
+  80162b:	53                   	push   %ebx
+  80162c:	e8 84 fd ff ff       	call   8013b5 <sys_env_set_pgfault_upcall>
+  801631:	83 c4 10             	add    $0x10,%esp
+  801634:	eb c9                	jmp    8015ff <set_pgfault_handler+0x10>
+
+00801636 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  801636:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  801637:	a1 0c 58 80 00       	mov    0x80580c,%eax
+	call *%eax
+  80163c:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80163e:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+  movl 48(%esp), %eax       // move trap time esp to eax
+  801641:	8b 44 24 30          	mov    0x30(%esp),%eax
+  subl $4, %eax             // make room for eip on trap time esp
+  801645:	83 e8 04             	sub    $0x4,%eax
+  movl %eax, 48(%esp)       // move value to esp
+  801648:	89 44 24 30          	mov    %eax,0x30(%esp)
+  movl 40(%esp), %ebx       // move trap time eip to ebx
+  80164c:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+  movl %ebx, 0(%eax)
+  801650:	89 18                	mov    %ebx,(%eax)
+
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+  addl $0x08,%esp
+  801652:	83 c4 08             	add    $0x8,%esp
+  popal
+  801655:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+  addl $4, %esp          // skip tf->eip
+  801656:	83 c4 04             	add    $0x4,%esp
+  popf                 // pop stack value into flags register
+  801659:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+  popl %esp
+  80165a:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+  ret
+  80165b:	c3                   	ret
+
+0080165c <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80165c:	55                   	push   %ebp
+  80165d:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80165f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801662:	05 00 00 00 30       	add    $0x30000000,%eax
+  801667:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80166a:	5d                   	pop    %ebp
+  80166b:	c3                   	ret
+
+0080166c <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80166c:	55                   	push   %ebp
+  80166d:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80166f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801672:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  801675:	66 b8 00 00          	mov    $0x0,%ax
+  801679:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80167e:	5d                   	pop    %ebp
+  80167f:	c3                   	ret
+
+00801680 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801680:	55                   	push   %ebp
+  801681:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  801683:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801688:	eb 02                	jmp    80168c <fd_alloc+0xc>
+  80168a:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80168c:	89 c2                	mov    %eax,%edx
+  80168e:	c1 ea 16             	shr    $0x16,%edx
+  801691:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801698:	f6 c2 01             	test   $0x1,%dl
+  80169b:	74 2b                	je     8016c8 <fd_alloc+0x48>
+  80169d:	89 c2                	mov    %eax,%edx
+  80169f:	c1 ea 0c             	shr    $0xc,%edx
+  8016a2:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8016a9:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8016af:	f6 c1 01             	test   $0x1,%cl
+  8016b2:	74 14                	je     8016c8 <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  8016b4:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8016ba:	75 ce                	jne    80168a <fd_alloc+0xa>
+  8016bc:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  8016c1:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8016c6:	eb 05                	jmp    8016cd <fd_alloc+0x4d>
+      return 0;
+  8016c8:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  8016cd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016d0:	89 02                	mov    %eax,(%edx)
+}
+  8016d2:	89 c8                	mov    %ecx,%eax
+  8016d4:	5d                   	pop    %ebp
+  8016d5:	c3                   	ret
+
+008016d6 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8016d6:	55                   	push   %ebp
+  8016d7:	89 e5                	mov    %esp,%ebp
+  8016d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  8016dc:	83 f8 1f             	cmp    $0x1f,%eax
+  8016df:	77 30                	ja     801711 <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  8016e1:	c1 e0 0c             	shl    $0xc,%eax
+  8016e4:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8016e9:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8016ef:	f6 c2 01             	test   $0x1,%dl
+  8016f2:	74 24                	je     801718 <fd_lookup+0x42>
+  8016f4:	89 c2                	mov    %eax,%edx
+  8016f6:	c1 ea 0c             	shr    $0xc,%edx
+  8016f9:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801700:	f6 c2 01             	test   $0x1,%dl
+  801703:	74 1a                	je     80171f <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  801705:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801708:	89 02                	mov    %eax,(%edx)
+  return 0;
+  80170a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80170f:	5d                   	pop    %ebp
+  801710:	c3                   	ret
+    return -E_INVAL;
+  801711:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801716:	eb f7                	jmp    80170f <fd_lookup+0x39>
+    return -E_INVAL;
+  801718:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80171d:	eb f0                	jmp    80170f <fd_lookup+0x39>
+  80171f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801724:	eb e9                	jmp    80170f <fd_lookup+0x39>
+
+00801726 <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801726:	55                   	push   %ebp
+  801727:	89 e5                	mov    %esp,%ebp
+  801729:	53                   	push   %ebx
+  80172a:	83 ec 04             	sub    $0x4,%esp
+  80172d:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  801730:	b8 4c 39 80 00       	mov    $0x80394c,%eax
+  801735:	8b 18                	mov    (%eax),%ebx
+  801737:	85 db                	test   %ebx,%ebx
+  801739:	74 0e                	je     801749 <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  80173b:	83 c0 04             	add    $0x4,%eax
+  80173e:	39 13                	cmp    %edx,(%ebx)
+  801740:	75 f3                	jne    801735 <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  801742:	b8 00 00 00 00       	mov    $0x0,%eax
+  801747:	eb 1f                	jmp    801768 <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801749:	a1 04 58 80 00       	mov    0x805804,%eax
+  80174e:	8b 40 48             	mov    0x48(%eax),%eax
+  801751:	83 ec 04             	sub    $0x4,%esp
+  801754:	52                   	push   %edx
+  801755:	50                   	push   %eax
+  801756:	68 d0 38 80 00       	push   $0x8038d0
+  80175b:	e8 c3 ef ff ff       	call   800723 <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  801760:	83 c4 10             	add    $0x10,%esp
+  801763:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  801768:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80176b:	89 1a                	mov    %ebx,(%edx)
+}
+  80176d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801770:	c9                   	leave
+  801771:	c3                   	ret
+
+00801772 <fd_close>:
+{
+  801772:	55                   	push   %ebp
+  801773:	89 e5                	mov    %esp,%ebp
+  801775:	57                   	push   %edi
+  801776:	56                   	push   %esi
+  801777:	53                   	push   %ebx
+  801778:	83 ec 24             	sub    $0x24,%esp
+  80177b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80177e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801781:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801784:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801785:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80178b:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80178e:	50                   	push   %eax
+  80178f:	e8 42 ff ff ff       	call   8016d6 <fd_lookup>
+  801794:	89 c3                	mov    %eax,%ebx
+  801796:	83 c4 10             	add    $0x10,%esp
+  801799:	85 c0                	test   %eax,%eax
+  80179b:	78 05                	js     8017a2 <fd_close+0x30>
+      || fd != fd2)
+  80179d:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8017a0:	74 16                	je     8017b8 <fd_close+0x46>
+    return must_exist ? r : 0;
+  8017a2:	89 f8                	mov    %edi,%eax
+  8017a4:	84 c0                	test   %al,%al
+  8017a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017ab:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8017ae:	89 d8                	mov    %ebx,%eax
+  8017b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017b3:	5b                   	pop    %ebx
+  8017b4:	5e                   	pop    %esi
+  8017b5:	5f                   	pop    %edi
+  8017b6:	5d                   	pop    %ebp
+  8017b7:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8017b8:	83 ec 08             	sub    $0x8,%esp
+  8017bb:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8017be:	50                   	push   %eax
+  8017bf:	ff 36                	push   (%esi)
+  8017c1:	e8 60 ff ff ff       	call   801726 <dev_lookup>
+  8017c6:	89 c3                	mov    %eax,%ebx
+  8017c8:	83 c4 10             	add    $0x10,%esp
+  8017cb:	85 c0                	test   %eax,%eax
+  8017cd:	78 1a                	js     8017e9 <fd_close+0x77>
+    if (dev->dev_close)
+  8017cf:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8017d2:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  8017d5:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  8017da:	85 c0                	test   %eax,%eax
+  8017dc:	74 0b                	je     8017e9 <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  8017de:	83 ec 0c             	sub    $0xc,%esp
+  8017e1:	56                   	push   %esi
+  8017e2:	ff d0                	call   *%eax
+  8017e4:	89 c3                	mov    %eax,%ebx
+  8017e6:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  8017e9:	83 ec 08             	sub    $0x8,%esp
+  8017ec:	56                   	push   %esi
+  8017ed:	6a 00                	push   $0x0
+  8017ef:	e8 d1 f9 ff ff       	call   8011c5 <sys_page_unmap>
+  return r;
+  8017f4:	83 c4 10             	add    $0x10,%esp
+  8017f7:	eb b5                	jmp    8017ae <fd_close+0x3c>
+
+008017f9 <close>:
+
+int
+close(int fdnum)
+{
+  8017f9:	55                   	push   %ebp
+  8017fa:	89 e5                	mov    %esp,%ebp
+  8017fc:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8017ff:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801802:	50                   	push   %eax
+  801803:	ff 75 08             	push   0x8(%ebp)
+  801806:	e8 cb fe ff ff       	call   8016d6 <fd_lookup>
+  80180b:	83 c4 10             	add    $0x10,%esp
+  80180e:	85 c0                	test   %eax,%eax
+  801810:	79 02                	jns    801814 <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  801812:	c9                   	leave
+  801813:	c3                   	ret
+    return fd_close(fd, 1);
+  801814:	83 ec 08             	sub    $0x8,%esp
+  801817:	6a 01                	push   $0x1
+  801819:	ff 75 f4             	push   -0xc(%ebp)
+  80181c:	e8 51 ff ff ff       	call   801772 <fd_close>
+  801821:	83 c4 10             	add    $0x10,%esp
+  801824:	eb ec                	jmp    801812 <close+0x19>
+
+00801826 <close_all>:
+
+void
+close_all(void)
+{
+  801826:	55                   	push   %ebp
+  801827:	89 e5                	mov    %esp,%ebp
+  801829:	53                   	push   %ebx
+  80182a:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  80182d:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  801832:	83 ec 0c             	sub    $0xc,%esp
+  801835:	53                   	push   %ebx
+  801836:	e8 be ff ff ff       	call   8017f9 <close>
+  for (i = 0; i < MAXFD; i++)
+  80183b:	83 c3 01             	add    $0x1,%ebx
+  80183e:	83 c4 10             	add    $0x10,%esp
+  801841:	83 fb 20             	cmp    $0x20,%ebx
+  801844:	75 ec                	jne    801832 <close_all+0xc>
+}
+  801846:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801849:	c9                   	leave
+  80184a:	c3                   	ret
+
+0080184b <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80184b:	55                   	push   %ebp
+  80184c:	89 e5                	mov    %esp,%ebp
+  80184e:	57                   	push   %edi
+  80184f:	56                   	push   %esi
+  801850:	53                   	push   %ebx
+  801851:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801854:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801857:	50                   	push   %eax
+  801858:	ff 75 08             	push   0x8(%ebp)
+  80185b:	e8 76 fe ff ff       	call   8016d6 <fd_lookup>
+  801860:	89 c6                	mov    %eax,%esi
+  801862:	83 c4 10             	add    $0x10,%esp
+  801865:	85 c0                	test   %eax,%eax
+  801867:	0f 88 0a 01 00 00    	js     801977 <dup+0x12c>
+    return r;
+  close(newfdnum);
+  80186d:	83 ec 0c             	sub    $0xc,%esp
+  801870:	ff 75 0c             	push   0xc(%ebp)
+  801873:	e8 81 ff ff ff       	call   8017f9 <close>
+
+  newfd = INDEX2FD(newfdnum);
+  801878:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80187b:	c1 e0 0c             	shl    $0xc,%eax
+  80187e:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  801884:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  801887:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80188a:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  80188d:	89 04 24             	mov    %eax,(%esp)
+  801890:	e8 d7 fd ff ff       	call   80166c <fd2data>
+  801895:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  801897:	89 3c 24             	mov    %edi,(%esp)
+  80189a:	e8 cd fd ff ff       	call   80166c <fd2data>
+  80189f:	83 c4 10             	add    $0x10,%esp
+  8018a2:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8018a5:	89 f3                	mov    %esi,%ebx
+  8018a7:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  8018ad:	89 c6                	mov    %eax,%esi
+  8018af:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8018b2:	89 cf                	mov    %ecx,%edi
+  8018b4:	eb 0c                	jmp    8018c2 <dup+0x77>
+  8018b6:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8018bc:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8018c2:	39 fb                	cmp    %edi,%ebx
+  8018c4:	74 7b                	je     801941 <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  8018c6:	89 d8                	mov    %ebx,%eax
+  8018c8:	c1 e8 16             	shr    $0x16,%eax
+  8018cb:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8018d2:	a8 01                	test   $0x1,%al
+  8018d4:	74 e0                	je     8018b6 <dup+0x6b>
+  8018d6:	89 d8                	mov    %ebx,%eax
+  8018d8:	c1 e8 0c             	shr    $0xc,%eax
+  8018db:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8018e2:	f6 c2 01             	test   $0x1,%dl
+  8018e5:	74 cf                	je     8018b6 <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  8018e7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  8018ee:	83 ec 0c             	sub    $0xc,%esp
+  8018f1:	25 07 0e 00 00       	and    $0xe07,%eax
+  8018f6:	50                   	push   %eax
+  8018f7:	56                   	push   %esi
+  8018f8:	6a 00                	push   $0x0
+  8018fa:	53                   	push   %ebx
+  8018fb:	6a 00                	push   $0x0
+  8018fd:	e8 81 f8 ff ff       	call   801183 <sys_page_map>
+  801902:	83 c4 20             	add    $0x20,%esp
+  801905:	85 c0                	test   %eax,%eax
+  801907:	79 ad                	jns    8018b6 <dup+0x6b>
+  801909:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80190c:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  80190e:	83 ec 08             	sub    $0x8,%esp
+  801911:	ff 75 d4             	push   -0x2c(%ebp)
+  801914:	6a 00                	push   $0x0
+  801916:	e8 aa f8 ff ff       	call   8011c5 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80191b:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  80191e:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  801924:	83 c4 10             	add    $0x10,%esp
+  801927:	39 df                	cmp    %ebx,%edi
+  801929:	74 4c                	je     801977 <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  80192b:	83 ec 08             	sub    $0x8,%esp
+  80192e:	57                   	push   %edi
+  80192f:	6a 00                	push   $0x0
+  801931:	e8 8f f8 ff ff       	call   8011c5 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801936:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  80193c:	83 c4 10             	add    $0x10,%esp
+  80193f:	eb e6                	jmp    801927 <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801941:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801944:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  801947:	89 c8                	mov    %ecx,%eax
+  801949:	c1 e8 0c             	shr    $0xc,%eax
+  80194c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801953:	83 ec 0c             	sub    $0xc,%esp
+  801956:	25 07 0e 00 00       	and    $0xe07,%eax
+  80195b:	50                   	push   %eax
+  80195c:	ff 75 d4             	push   -0x2c(%ebp)
+  80195f:	6a 00                	push   $0x0
+  801961:	51                   	push   %ecx
+  801962:	6a 00                	push   $0x0
+  801964:	e8 1a f8 ff ff       	call   801183 <sys_page_map>
+  801969:	89 c6                	mov    %eax,%esi
+  80196b:	83 c4 20             	add    $0x20,%esp
+  80196e:	85 c0                	test   %eax,%eax
+  801970:	78 9c                	js     80190e <dup+0xc3>
+  return newfdnum;
+  801972:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801975:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  801977:	89 f0                	mov    %esi,%eax
+  801979:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80197c:	5b                   	pop    %ebx
+  80197d:	5e                   	pop    %esi
+  80197e:	5f                   	pop    %edi
+  80197f:	5d                   	pop    %ebp
+  801980:	c3                   	ret
+
+00801981 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801981:	55                   	push   %ebp
+  801982:	89 e5                	mov    %esp,%ebp
+  801984:	56                   	push   %esi
+  801985:	53                   	push   %ebx
+  801986:	83 ec 18             	sub    $0x18,%esp
+  801989:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  80198c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80198f:	50                   	push   %eax
+  801990:	56                   	push   %esi
+  801991:	e8 40 fd ff ff       	call   8016d6 <fd_lookup>
+  801996:	83 c4 10             	add    $0x10,%esp
+  801999:	85 c0                	test   %eax,%eax
+  80199b:	78 3c                	js     8019d9 <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80199d:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8019a0:	83 ec 08             	sub    $0x8,%esp
+  8019a3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019a6:	50                   	push   %eax
+  8019a7:	ff 33                	push   (%ebx)
+  8019a9:	e8 78 fd ff ff       	call   801726 <dev_lookup>
+  8019ae:	83 c4 10             	add    $0x10,%esp
+  8019b1:	85 c0                	test   %eax,%eax
+  8019b3:	78 24                	js     8019d9 <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8019b5:	8b 43 08             	mov    0x8(%ebx),%eax
+  8019b8:	83 e0 03             	and    $0x3,%eax
+  8019bb:	83 f8 01             	cmp    $0x1,%eax
+  8019be:	74 20                	je     8019e0 <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  8019c0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019c3:	8b 40 08             	mov    0x8(%eax),%eax
+  8019c6:	85 c0                	test   %eax,%eax
+  8019c8:	74 37                	je     801a01 <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  8019ca:	83 ec 04             	sub    $0x4,%esp
+  8019cd:	ff 75 10             	push   0x10(%ebp)
+  8019d0:	ff 75 0c             	push   0xc(%ebp)
+  8019d3:	53                   	push   %ebx
+  8019d4:	ff d0                	call   *%eax
+  8019d6:	83 c4 10             	add    $0x10,%esp
+}
+  8019d9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019dc:	5b                   	pop    %ebx
+  8019dd:	5e                   	pop    %esi
+  8019de:	5d                   	pop    %ebp
+  8019df:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8019e0:	a1 04 58 80 00       	mov    0x805804,%eax
+  8019e5:	8b 40 48             	mov    0x48(%eax),%eax
+  8019e8:	83 ec 04             	sub    $0x4,%esp
+  8019eb:	56                   	push   %esi
+  8019ec:	50                   	push   %eax
+  8019ed:	68 11 39 80 00       	push   $0x803911
+  8019f2:	e8 2c ed ff ff       	call   800723 <cprintf>
+    return -E_INVAL;
+  8019f7:	83 c4 10             	add    $0x10,%esp
+  8019fa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019ff:	eb d8                	jmp    8019d9 <read+0x58>
+    return -E_NOT_SUPP;
+  801a01:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a06:	eb d1                	jmp    8019d9 <read+0x58>
+
+00801a08 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801a08:	55                   	push   %ebp
+  801a09:	89 e5                	mov    %esp,%ebp
+  801a0b:	57                   	push   %edi
+  801a0c:	56                   	push   %esi
+  801a0d:	53                   	push   %ebx
+  801a0e:	83 ec 0c             	sub    $0xc,%esp
+  801a11:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801a14:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  801a17:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a1c:	eb 02                	jmp    801a20 <readn+0x18>
+  801a1e:	01 c3                	add    %eax,%ebx
+  801a20:	39 f3                	cmp    %esi,%ebx
+  801a22:	73 21                	jae    801a45 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  801a24:	83 ec 04             	sub    $0x4,%esp
+  801a27:	89 f0                	mov    %esi,%eax
+  801a29:	29 d8                	sub    %ebx,%eax
+  801a2b:	50                   	push   %eax
+  801a2c:	89 d8                	mov    %ebx,%eax
+  801a2e:	03 45 0c             	add    0xc(%ebp),%eax
+  801a31:	50                   	push   %eax
+  801a32:	57                   	push   %edi
+  801a33:	e8 49 ff ff ff       	call   801981 <read>
+    if (m < 0)
+  801a38:	83 c4 10             	add    $0x10,%esp
+  801a3b:	85 c0                	test   %eax,%eax
+  801a3d:	78 04                	js     801a43 <readn+0x3b>
+      return m;
+    if (m == 0)
+  801a3f:	75 dd                	jne    801a1e <readn+0x16>
+  801a41:	eb 02                	jmp    801a45 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  801a43:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  801a45:	89 d8                	mov    %ebx,%eax
+  801a47:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a4a:	5b                   	pop    %ebx
+  801a4b:	5e                   	pop    %esi
+  801a4c:	5f                   	pop    %edi
+  801a4d:	5d                   	pop    %ebp
+  801a4e:	c3                   	ret
+
+00801a4f <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801a4f:	55                   	push   %ebp
+  801a50:	89 e5                	mov    %esp,%ebp
+  801a52:	56                   	push   %esi
+  801a53:	53                   	push   %ebx
+  801a54:	83 ec 18             	sub    $0x18,%esp
+  801a57:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a5a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a5d:	50                   	push   %eax
+  801a5e:	53                   	push   %ebx
+  801a5f:	e8 72 fc ff ff       	call   8016d6 <fd_lookup>
+  801a64:	83 c4 10             	add    $0x10,%esp
+  801a67:	85 c0                	test   %eax,%eax
+  801a69:	78 37                	js     801aa2 <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801a6b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801a6e:	83 ec 08             	sub    $0x8,%esp
+  801a71:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a74:	50                   	push   %eax
+  801a75:	ff 36                	push   (%esi)
+  801a77:	e8 aa fc ff ff       	call   801726 <dev_lookup>
+  801a7c:	83 c4 10             	add    $0x10,%esp
+  801a7f:	85 c0                	test   %eax,%eax
+  801a81:	78 1f                	js     801aa2 <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801a83:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801a87:	74 20                	je     801aa9 <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  801a89:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a8c:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a8f:	85 c0                	test   %eax,%eax
+  801a91:	74 37                	je     801aca <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  801a93:	83 ec 04             	sub    $0x4,%esp
+  801a96:	ff 75 10             	push   0x10(%ebp)
+  801a99:	ff 75 0c             	push   0xc(%ebp)
+  801a9c:	56                   	push   %esi
+  801a9d:	ff d0                	call   *%eax
+  801a9f:	83 c4 10             	add    $0x10,%esp
+}
+  801aa2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801aa5:	5b                   	pop    %ebx
+  801aa6:	5e                   	pop    %esi
+  801aa7:	5d                   	pop    %ebp
+  801aa8:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801aa9:	a1 04 58 80 00       	mov    0x805804,%eax
+  801aae:	8b 40 48             	mov    0x48(%eax),%eax
+  801ab1:	83 ec 04             	sub    $0x4,%esp
+  801ab4:	53                   	push   %ebx
+  801ab5:	50                   	push   %eax
+  801ab6:	68 2d 39 80 00       	push   $0x80392d
+  801abb:	e8 63 ec ff ff       	call   800723 <cprintf>
+    return -E_INVAL;
+  801ac0:	83 c4 10             	add    $0x10,%esp
+  801ac3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ac8:	eb d8                	jmp    801aa2 <write+0x53>
+    return -E_NOT_SUPP;
+  801aca:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801acf:	eb d1                	jmp    801aa2 <write+0x53>
+
+00801ad1 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801ad1:	55                   	push   %ebp
+  801ad2:	89 e5                	mov    %esp,%ebp
+  801ad4:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801ad7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ada:	50                   	push   %eax
+  801adb:	ff 75 08             	push   0x8(%ebp)
+  801ade:	e8 f3 fb ff ff       	call   8016d6 <fd_lookup>
+  801ae3:	83 c4 10             	add    $0x10,%esp
+  801ae6:	85 c0                	test   %eax,%eax
+  801ae8:	78 0e                	js     801af8 <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  801aea:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801aed:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801af0:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  801af3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801af8:	c9                   	leave
+  801af9:	c3                   	ret
+
+00801afa <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801afa:	55                   	push   %ebp
+  801afb:	89 e5                	mov    %esp,%ebp
+  801afd:	56                   	push   %esi
+  801afe:	53                   	push   %ebx
+  801aff:	83 ec 18             	sub    $0x18,%esp
+  801b02:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801b05:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b08:	50                   	push   %eax
+  801b09:	53                   	push   %ebx
+  801b0a:	e8 c7 fb ff ff       	call   8016d6 <fd_lookup>
+  801b0f:	83 c4 10             	add    $0x10,%esp
+  801b12:	85 c0                	test   %eax,%eax
+  801b14:	78 34                	js     801b4a <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801b16:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b19:	83 ec 08             	sub    $0x8,%esp
+  801b1c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b1f:	50                   	push   %eax
+  801b20:	ff 36                	push   (%esi)
+  801b22:	e8 ff fb ff ff       	call   801726 <dev_lookup>
+  801b27:	83 c4 10             	add    $0x10,%esp
+  801b2a:	85 c0                	test   %eax,%eax
+  801b2c:	78 1c                	js     801b4a <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801b2e:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801b32:	74 1d                	je     801b51 <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  801b34:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b37:	8b 40 18             	mov    0x18(%eax),%eax
+  801b3a:	85 c0                	test   %eax,%eax
+  801b3c:	74 34                	je     801b72 <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  801b3e:	83 ec 08             	sub    $0x8,%esp
+  801b41:	ff 75 0c             	push   0xc(%ebp)
+  801b44:	56                   	push   %esi
+  801b45:	ff d0                	call   *%eax
+  801b47:	83 c4 10             	add    $0x10,%esp
+}
+  801b4a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b4d:	5b                   	pop    %ebx
+  801b4e:	5e                   	pop    %esi
+  801b4f:	5d                   	pop    %ebp
+  801b50:	c3                   	ret
+            thisenv->env_id, fdnum);
+  801b51:	a1 04 58 80 00       	mov    0x805804,%eax
+  801b56:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801b59:	83 ec 04             	sub    $0x4,%esp
+  801b5c:	53                   	push   %ebx
+  801b5d:	50                   	push   %eax
+  801b5e:	68 f0 38 80 00       	push   $0x8038f0
+  801b63:	e8 bb eb ff ff       	call   800723 <cprintf>
+    return -E_INVAL;
+  801b68:	83 c4 10             	add    $0x10,%esp
+  801b6b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b70:	eb d8                	jmp    801b4a <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  801b72:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b77:	eb d1                	jmp    801b4a <ftruncate+0x50>
+
+00801b79 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801b79:	55                   	push   %ebp
+  801b7a:	89 e5                	mov    %esp,%ebp
+  801b7c:	56                   	push   %esi
+  801b7d:	53                   	push   %ebx
+  801b7e:	83 ec 18             	sub    $0x18,%esp
+  801b81:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801b84:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b87:	50                   	push   %eax
+  801b88:	ff 75 08             	push   0x8(%ebp)
+  801b8b:	e8 46 fb ff ff       	call   8016d6 <fd_lookup>
+  801b90:	83 c4 10             	add    $0x10,%esp
+  801b93:	85 c0                	test   %eax,%eax
+  801b95:	78 49                	js     801be0 <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801b97:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b9a:	83 ec 08             	sub    $0x8,%esp
+  801b9d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ba0:	50                   	push   %eax
+  801ba1:	ff 36                	push   (%esi)
+  801ba3:	e8 7e fb ff ff       	call   801726 <dev_lookup>
+  801ba8:	83 c4 10             	add    $0x10,%esp
+  801bab:	85 c0                	test   %eax,%eax
+  801bad:	78 31                	js     801be0 <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  801baf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bb2:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801bb6:	74 2f                	je     801be7 <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  801bb8:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  801bbb:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801bc2:	00 00 00 
+  stat->st_isdir = 0;
+  801bc5:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801bcc:	00 00 00 
+  stat->st_dev = dev;
+  801bcf:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  801bd5:	83 ec 08             	sub    $0x8,%esp
+  801bd8:	53                   	push   %ebx
+  801bd9:	56                   	push   %esi
+  801bda:	ff 50 14             	call   *0x14(%eax)
+  801bdd:	83 c4 10             	add    $0x10,%esp
+}
+  801be0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801be3:	5b                   	pop    %ebx
+  801be4:	5e                   	pop    %esi
+  801be5:	5d                   	pop    %ebp
+  801be6:	c3                   	ret
+    return -E_NOT_SUPP;
+  801be7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801bec:	eb f2                	jmp    801be0 <fstat+0x67>
+
+00801bee <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  801bee:	55                   	push   %ebp
+  801bef:	89 e5                	mov    %esp,%ebp
+  801bf1:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  801bf4:	ff 75 0c             	push   0xc(%ebp)
+  801bf7:	ff 75 08             	push   0x8(%ebp)
+  801bfa:	e8 58 07 00 00       	call   802357 <file_stat>
+}
+  801bff:	c9                   	leave
+  801c00:	c3                   	ret
+
+00801c01 <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  801c01:	55                   	push   %ebp
+  801c02:	89 e5                	mov    %esp,%ebp
+  801c04:	57                   	push   %edi
+  801c05:	56                   	push   %esi
+  801c06:	53                   	push   %ebx
+  801c07:	83 ec 1c             	sub    $0x1c,%esp
+  801c0a:	89 c7                	mov    %eax,%edi
+  801c0c:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801c0f:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801c12:	e9 a2 00 00 00       	jmp    801cb9 <fsipc_send+0xb8>
+  nfsenvs = 0;
+  801c17:	c7 05 c0 50 80 00 00 	movl   $0x0,0x8050c0
+  801c1e:	00 00 00 
+  801c21:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c26:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801c2b:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801c30:	be 01 00 00 00       	mov    $0x1,%esi
+  801c35:	eb 0f                	jmp    801c46 <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801c37:	83 c0 01             	add    $0x1,%eax
+  801c3a:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801c3f:	74 49                	je     801c8a <fsipc_send+0x89>
+  801c41:	83 f9 07             	cmp    $0x7,%ecx
+  801c44:	7f 50                	jg     801c96 <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  801c46:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801c49:	c1 e2 04             	shl    $0x4,%edx
+  801c4c:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801c52:	8b 52 50             	mov    0x50(%edx),%edx
+  801c55:	83 fa 01             	cmp    $0x1,%edx
+  801c58:	75 dd                	jne    801c37 <fsipc_send+0x36>
+  801c5a:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801c5d:	c1 e2 04             	shl    $0x4,%edx
+  801c60:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801c66:	8b 52 54             	mov    0x54(%edx),%edx
+  801c69:	85 d2                	test   %edx,%edx
+  801c6b:	74 ca                	je     801c37 <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801c6d:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801c70:	c1 e2 04             	shl    $0x4,%edx
+  801c73:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801c79:	8b 52 48             	mov    0x48(%edx),%edx
+  801c7c:	89 14 8d e0 50 80 00 	mov    %edx,0x8050e0(,%ecx,4)
+  801c83:	8d 49 01             	lea    0x1(%ecx),%ecx
+  801c86:	89 f3                	mov    %esi,%ebx
+  801c88:	eb ad                	jmp    801c37 <fsipc_send+0x36>
+  801c8a:	84 db                	test   %bl,%bl
+  801c8c:	74 38                	je     801cc6 <fsipc_send+0xc5>
+  801c8e:	89 0d c0 50 80 00    	mov    %ecx,0x8050c0
+  801c94:	eb 30                	jmp    801cc6 <fsipc_send+0xc5>
+  801c96:	84 db                	test   %bl,%bl
+  801c98:	74 2c                	je     801cc6 <fsipc_send+0xc5>
+  801c9a:	89 0d c0 50 80 00    	mov    %ecx,0x8050c0
+  801ca0:	eb 24                	jmp    801cc6 <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  801ca2:	50                   	push   %eax
+  801ca3:	68 5c 39 80 00       	push   $0x80395c
+  801ca8:	6a 34                	push   $0x34
+  801caa:	68 66 39 80 00       	push   $0x803966
+  801caf:	e8 94 e9 ff ff       	call   800648 <_panic>
+    }
+    sys_yield();
+  801cb4:	e8 25 f4 ff ff       	call   8010de <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  801cb9:	83 3d c0 50 80 00 03 	cmpl   $0x3,0x8050c0
+  801cc0:	0f 8e 51 ff ff ff    	jle    801c17 <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  801cc6:	a1 04 58 80 00       	mov    0x805804,%eax
+  801ccb:	8b 70 48             	mov    0x48(%eax),%esi
+  801cce:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  801cd4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cd9:	8b 0d c0 50 80 00    	mov    0x8050c0,%ecx
+  801cdf:	39 d9                	cmp    %ebx,%ecx
+  801ce1:	7e d1                	jle    801cb4 <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  801ce3:	83 ec 0c             	sub    $0xc,%esp
+  801ce6:	ff 75 e0             	push   -0x20(%ebp)
+  801ce9:	6a 07                	push   $0x7
+  801ceb:	ff 75 e4             	push   -0x1c(%ebp)
+  801cee:	57                   	push   %edi
+  801cef:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  801cf2:	99                   	cltd
+  801cf3:	f7 f9                	idiv   %ecx
+  801cf5:	ff 34 95 e0 50 80 00 	push   0x8050e0(,%edx,4)
+  801cfc:	e8 f6 f6 ff ff       	call   8013f7 <sys_ipc_try_send>
+      if (r == 0)
+  801d01:	83 c4 20             	add    $0x20,%esp
+  801d04:	85 c0                	test   %eax,%eax
+  801d06:	74 0a                	je     801d12 <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  801d08:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801d0b:	75 95                	jne    801ca2 <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  801d0d:	83 c3 01             	add    $0x1,%ebx
+  801d10:	eb c7                	jmp    801cd9 <fsipc_send+0xd8>
+  }
+}
+  801d12:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d15:	5b                   	pop    %ebx
+  801d16:	5e                   	pop    %esi
+  801d17:	5f                   	pop    %edi
+  801d18:	5d                   	pop    %ebp
+  801d19:	c3                   	ret
+
+00801d1a <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801d1a:	55                   	push   %ebp
+  801d1b:	89 e5                	mov    %esp,%ebp
+  801d1d:	53                   	push   %ebx
+  801d1e:	83 ec 14             	sub    $0x14,%esp
+  801d21:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  801d23:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  801d2a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801d2f:	ba 00 60 80 00       	mov    $0x806000,%edx
+  801d34:	e8 c8 fe ff ff       	call   801c01 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801d39:	6a 00                	push   $0x0
+  801d3b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d3e:	50                   	push   %eax
+  801d3f:	53                   	push   %ebx
+  801d40:	6a 00                	push   $0x0
+  801d42:	e8 26 13 00 00       	call   80306d <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  801d47:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d4a:	c9                   	leave
+  801d4b:	c3                   	ret
+
+00801d4c <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801d4c:	55                   	push   %ebp
+  801d4d:	89 e5                	mov    %esp,%ebp
+  801d4f:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801d52:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d55:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d58:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.set_size.req_size = newsize;
+  801d5d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d60:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801d65:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d6a:	b8 02 00 00 00       	mov    $0x2,%eax
+  801d6f:	e8 a6 ff ff ff       	call   801d1a <fsipc>
+}
+  801d74:	c9                   	leave
+  801d75:	c3                   	ret
+
+00801d76 <devfile_flush>:
+{
+  801d76:	55                   	push   %ebp
+  801d77:	89 e5                	mov    %esp,%ebp
+  801d79:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801d7c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d7f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d82:	a3 00 60 80 00       	mov    %eax,0x806000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801d87:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d8c:	b8 06 00 00 00       	mov    $0x6,%eax
+  801d91:	e8 84 ff ff ff       	call   801d1a <fsipc>
+}
+  801d96:	c9                   	leave
+  801d97:	c3                   	ret
+
+00801d98 <devfile_stat>:
+{
+  801d98:	55                   	push   %ebp
+  801d99:	89 e5                	mov    %esp,%ebp
+  801d9b:	53                   	push   %ebx
+  801d9c:	83 ec 04             	sub    $0x4,%esp
+  801d9f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801da2:	8b 45 08             	mov    0x8(%ebp),%eax
+  801da5:	8b 40 0c             	mov    0xc(%eax),%eax
+  801da8:	a3 00 60 80 00       	mov    %eax,0x806000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801dad:	ba 00 00 00 00       	mov    $0x0,%edx
+  801db2:	b8 05 00 00 00       	mov    $0x5,%eax
+  801db7:	e8 5e ff ff ff       	call   801d1a <fsipc>
+  801dbc:	85 c0                	test   %eax,%eax
+  801dbe:	78 2c                	js     801dec <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801dc0:	83 ec 08             	sub    $0x8,%esp
+  801dc3:	68 00 60 80 00       	push   $0x806000
+  801dc8:	53                   	push   %ebx
+  801dc9:	e8 43 ef ff ff       	call   800d11 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  801dce:	a1 80 60 80 00       	mov    0x806080,%eax
+  801dd3:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801dd9:	a1 84 60 80 00       	mov    0x806084,%eax
+  801dde:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801de4:	83 c4 10             	add    $0x10,%esp
+  801de7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801dec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801def:	c9                   	leave
+  801df0:	c3                   	ret
+
+00801df1 <fsv_alloc>:
+{
+  801df1:	55                   	push   %ebp
+  801df2:	89 e5                	mov    %esp,%ebp
+  801df4:	56                   	push   %esi
+  801df5:	53                   	push   %ebx
+  801df6:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  801df8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801dfd:	eb 22                	jmp    801e21 <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  801dff:	83 ec 04             	sub    $0x4,%esp
+  801e02:	6a 00                	push   $0x0
+  801e04:	6a 00                	push   $0x0
+  801e06:	6a 07                	push   $0x7
+  801e08:	50                   	push   %eax
+  801e09:	6a 00                	push   $0x0
+  801e0b:	6a 04                	push   $0x4
+  801e0d:	68 00 51 80 00       	push   $0x805100
+  801e12:	e8 7c f7 ff ff       	call   801593 <sysbatch_add>
+  801e17:	83 c4 20             	add    $0x20,%esp
+  801e1a:	85 c0                	test   %eax,%eax
+  801e1c:	78 48                	js     801e66 <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  801e1e:	83 c3 01             	add    $0x1,%ebx
+  801e21:	39 f3                	cmp    %esi,%ebx
+  801e23:	74 31                	je     801e56 <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  801e25:	89 d8                	mov    %ebx,%eax
+  801e27:	c1 e0 0c             	shl    $0xc,%eax
+  801e2a:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801e2f:	89 c2                	mov    %eax,%edx
+  801e31:	c1 ea 16             	shr    $0x16,%edx
+  801e34:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801e3b:	f6 c2 01             	test   $0x1,%dl
+  801e3e:	74 bf                	je     801dff <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  801e40:	89 c2                	mov    %eax,%edx
+  801e42:	c1 ea 0c             	shr    $0xc,%edx
+  801e45:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801e4c:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801e4f:	83 fa 03             	cmp    $0x3,%edx
+  801e52:	75 ab                	jne    801dff <fsv_alloc+0xe>
+  801e54:	eb c8                	jmp    801e1e <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  801e56:	83 ec 0c             	sub    $0xc,%esp
+  801e59:	68 00 51 80 00       	push   $0x805100
+  801e5e:	e8 e0 f6 ff ff       	call   801543 <sysbatch_flush>
+  801e63:	83 c4 10             	add    $0x10,%esp
+}
+  801e66:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e69:	5b                   	pop    %ebx
+  801e6a:	5e                   	pop    %esi
+  801e6b:	5d                   	pop    %ebp
+  801e6c:	c3                   	ret
+
+00801e6d <devfile_read>:
+{
+  801e6d:	55                   	push   %ebp
+  801e6e:	89 e5                	mov    %esp,%ebp
+  801e70:	57                   	push   %edi
+  801e71:	56                   	push   %esi
+  801e72:	53                   	push   %ebx
+  801e73:	83 ec 3c             	sub    $0x3c,%esp
+  801e76:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  801e79:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  801e7f:	77 57                	ja     801ed8 <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801e81:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e84:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e87:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read.req_n = n;
+  801e8c:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801e92:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e97:	b8 03 00 00 00       	mov    $0x3,%eax
+  801e9c:	e8 79 fe ff ff       	call   801d1a <fsipc>
+  801ea1:	89 c6                	mov    %eax,%esi
+  801ea3:	85 c0                	test   %eax,%eax
+  801ea5:	78 27                	js     801ece <devfile_read+0x61>
+  assert(r <= n);
+  801ea7:	39 c3                	cmp    %eax,%ebx
+  801ea9:	0f 82 0e 02 00 00    	jb     8020bd <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  801eaf:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801eb4:	0f 8f 1c 02 00 00    	jg     8020d6 <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801eba:	83 ec 04             	sub    $0x4,%esp
+  801ebd:	50                   	push   %eax
+  801ebe:	68 00 60 80 00       	push   $0x806000
+  801ec3:	ff 75 0c             	push   0xc(%ebp)
+  801ec6:	e8 cc ef ff ff       	call   800e97 <memmove>
+  return r;
+  801ecb:	83 c4 10             	add    $0x10,%esp
+}
+  801ece:	89 f0                	mov    %esi,%eax
+  801ed0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ed3:	5b                   	pop    %ebx
+  801ed4:	5e                   	pop    %esi
+  801ed5:	5f                   	pop    %edi
+  801ed6:	5d                   	pop    %ebp
+  801ed7:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  801ed8:	b8 01 00 00 00       	mov    $0x1,%eax
+  801edd:	e8 0f ff ff ff       	call   801df1 <fsv_alloc>
+  801ee2:	89 c6                	mov    %eax,%esi
+  801ee4:	85 c0                	test   %eax,%eax
+  801ee6:	78 e6                	js     801ece <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  801ee8:	8b 45 08             	mov    0x8(%ebp),%eax
+  801eeb:	8b 40 0c             	mov    0xc(%eax),%eax
+  801eee:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  801ef3:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ef6:	8b 40 04             	mov    0x4(%eax),%eax
+  801ef9:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  801efe:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  801f04:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801f0b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801f10:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801f15:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801f1a:	e8 e2 fc ff ff       	call   801c01 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801f1f:	6a 00                	push   $0x0
+  801f21:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801f24:	50                   	push   %eax
+  801f25:	68 00 10 c0 9f       	push   $0x9fc01000
+  801f2a:	6a 00                	push   $0x0
+  801f2c:	e8 3c 11 00 00       	call   80306d <ipc_recv_pages>
+  801f31:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  801f33:	83 c4 10             	add    $0x10,%esp
+  801f36:	85 c0                	test   %eax,%eax
+  801f38:	7e 94                	jle    801ece <devfile_read+0x61>
+  assert(r <= n);
+  801f3a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801f3d:	39 c3                	cmp    %eax,%ebx
+  801f3f:	72 2e                	jb     801f6f <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801f41:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f44:	8b 40 04             	mov    0x4(%eax),%eax
+  801f47:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801f4c:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  801f4f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801f52:	c1 e2 0c             	shl    $0xc,%edx
+  801f55:	39 ca                	cmp    %ecx,%edx
+  801f57:	72 2f                	jb     801f88 <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  801f59:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  801f5e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  801f61:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  801f65:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801f6a:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  801f6d:	eb 52                	jmp    801fc1 <devfile_read+0x154>
+  assert(r <= n);
+  801f6f:	68 71 39 80 00       	push   $0x803971
+  801f74:	68 78 39 80 00       	push   $0x803978
+  801f79:	68 49 01 00 00       	push   $0x149
+  801f7e:	68 66 39 80 00       	push   $0x803966
+  801f83:	e8 c0 e6 ff ff       	call   800648 <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801f88:	68 9c 39 80 00       	push   $0x80399c
+  801f8d:	68 78 39 80 00       	push   $0x803978
+  801f92:	68 4a 01 00 00       	push   $0x14a
+  801f97:	68 66 39 80 00       	push   $0x803966
+  801f9c:	e8 a7 e6 ff ff       	call   800648 <_panic>
+      memmove(dst + done, src + done, m);
+  801fa1:	83 ec 04             	sub    $0x4,%esp
+  801fa4:	53                   	push   %ebx
+  801fa5:	56                   	push   %esi
+  801fa6:	89 f8                	mov    %edi,%eax
+  801fa8:	03 45 0c             	add    0xc(%ebp),%eax
+  801fab:	50                   	push   %eax
+  801fac:	e8 e6 ee ff ff       	call   800e97 <memmove>
+  801fb1:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  801fb4:	01 df                	add    %ebx,%edi
+  801fb6:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801fb9:	39 c7                	cmp    %eax,%edi
+  801fbb:	0f 83 c0 00 00 00    	jae    802081 <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801fc1:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801fc4:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  801fc7:	89 f0                	mov    %esi,%eax
+  801fc9:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801fce:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  801fd3:	29 c3                	sub    %eax,%ebx
+  801fd5:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801fd8:	29 f8                	sub    %edi,%eax
+  801fda:	39 c3                	cmp    %eax,%ebx
+  801fdc:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  801fdf:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801fe5:	75 ba                	jne    801fa1 <devfile_read+0x134>
+  801fe7:	89 f9                	mov    %edi,%ecx
+  801fe9:	03 4d 0c             	add    0xc(%ebp),%ecx
+  801fec:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  801fef:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  801ff5:	75 aa                	jne    801fa1 <devfile_read+0x134>
+  801ff7:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  801ffd:	77 a2                	ja     801fa1 <devfile_read+0x134>
+  801fff:	89 c8                	mov    %ecx,%eax
+  802001:	c1 e8 16             	shr    $0x16,%eax
+  802004:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80200b:	a8 01                	test   $0x1,%al
+  80200d:	74 92                	je     801fa1 <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  80200f:	89 c8                	mov    %ecx,%eax
+  802011:	c1 e8 0c             	shr    $0xc,%eax
+  802014:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  80201b:	a8 01                	test   $0x1,%al
+  80201d:	74 82                	je     801fa1 <devfile_read+0x134>
+  80201f:	a9 02 08 00 00       	test   $0x802,%eax
+  802024:	0f 84 77 ff ff ff    	je     801fa1 <devfile_read+0x134>
+  80202a:	f6 c4 04             	test   $0x4,%ah
+  80202d:	0f 85 6e ff ff ff    	jne    801fa1 <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  802033:	a1 04 58 80 00       	mov    0x805804,%eax
+  802038:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  80203c:	84 c0                	test   %al,%al
+  80203e:	75 17                	jne    802057 <devfile_read+0x1ea>
+  802040:	83 ec 08             	sub    $0x8,%esp
+  802043:	6a 01                	push   $0x1
+  802045:	6a 00                	push   $0x0
+  802047:	e8 b1 f0 ff ff       	call   8010fd <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  80204c:	83 c4 10             	add    $0x10,%esp
+  80204f:	85 c0                	test   %eax,%eax
+  802051:	0f 85 4a ff ff ff    	jne    801fa1 <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  802057:	83 ec 04             	sub    $0x4,%esp
+  80205a:	68 05 08 00 00       	push   $0x805
+  80205f:	ff 75 cc             	push   -0x34(%ebp)
+  802062:	6a 00                	push   $0x0
+  802064:	56                   	push   %esi
+  802065:	6a 00                	push   $0x0
+  802067:	6a 05                	push   $0x5
+  802069:	68 00 51 80 00       	push   $0x805100
+  80206e:	e8 20 f5 ff ff       	call   801593 <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  802073:	c1 e8 1f             	shr    $0x1f,%eax
+  802076:	08 45 cb             	or     %al,-0x35(%ebp)
+  802079:	83 c4 20             	add    $0x20,%esp
+  80207c:	e9 33 ff ff ff       	jmp    801fb4 <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  802081:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  802084:	83 ec 0c             	sub    $0xc,%esp
+  802087:	68 00 51 80 00       	push   $0x805100
+  80208c:	e8 b2 f4 ff ff       	call   801543 <sysbatch_flush>
+  802091:	83 c4 10             	add    $0x10,%esp
+  802094:	85 c0                	test   %eax,%eax
+  802096:	78 06                	js     80209e <devfile_read+0x231>
+  802098:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  80209c:	74 14                	je     8020b2 <devfile_read+0x245>
+    memmove(dst, src, r);
+  80209e:	83 ec 04             	sub    $0x4,%esp
+  8020a1:	ff 75 d4             	push   -0x2c(%ebp)
+  8020a4:	ff 75 d0             	push   -0x30(%ebp)
+  8020a7:	ff 75 0c             	push   0xc(%ebp)
+  8020aa:	e8 e8 ed ff ff       	call   800e97 <memmove>
+  8020af:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  8020b2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020b5:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  8020b8:	e9 11 fe ff ff       	jmp    801ece <devfile_read+0x61>
+  assert(r <= n);
+  8020bd:	68 71 39 80 00       	push   $0x803971
+  8020c2:	68 78 39 80 00       	push   $0x803978
+  8020c7:	68 1c 01 00 00       	push   $0x11c
+  8020cc:	68 66 39 80 00       	push   $0x803966
+  8020d1:	e8 72 e5 ff ff       	call   800648 <_panic>
+  assert(r <= PGSIZE);
+  8020d6:	68 8d 39 80 00       	push   $0x80398d
+  8020db:	68 78 39 80 00       	push   $0x803978
+  8020e0:	68 1d 01 00 00       	push   $0x11d
+  8020e5:	68 66 39 80 00       	push   $0x803966
+  8020ea:	e8 59 e5 ff ff       	call   800648 <_panic>
+
+008020ef <devfile_write>:
+{
+  8020ef:	55                   	push   %ebp
+  8020f0:	89 e5                	mov    %esp,%ebp
+  8020f2:	57                   	push   %edi
+  8020f3:	56                   	push   %esi
+  8020f4:	53                   	push   %ebx
+  8020f5:	83 ec 1c             	sub    $0x1c,%esp
+  8020f8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8020fb:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  8020fe:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  802103:	77 39                	ja     80213e <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802105:	8b 56 0c             	mov    0xc(%esi),%edx
+  802108:	89 15 00 60 80 00    	mov    %edx,0x806000
+  fsipcbuf.write.req_n = n;
+  80210e:	a3 04 60 80 00       	mov    %eax,0x806004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  802113:	83 ec 04             	sub    $0x4,%esp
+  802116:	50                   	push   %eax
+  802117:	ff 75 0c             	push   0xc(%ebp)
+  80211a:	68 08 60 80 00       	push   $0x806008
+  80211f:	e8 73 ed ff ff       	call   800e97 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  802124:	ba 00 00 00 00       	mov    $0x0,%edx
+  802129:	b8 04 00 00 00       	mov    $0x4,%eax
+  80212e:	e8 e7 fb ff ff       	call   801d1a <fsipc>
+  802133:	83 c4 10             	add    $0x10,%esp
+}
+  802136:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802139:	5b                   	pop    %ebx
+  80213a:	5e                   	pop    %esi
+  80213b:	5f                   	pop    %edi
+  80213c:	5d                   	pop    %ebp
+  80213d:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  80213e:	ba 00 00 10 00       	mov    $0x100000,%edx
+  802143:	39 d0                	cmp    %edx,%eax
+  802145:	89 d3                	mov    %edx,%ebx
+  802147:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  80214a:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  802150:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  802153:	83 c7 01             	add    $0x1,%edi
+  802156:	89 f8                	mov    %edi,%eax
+  802158:	e8 94 fc ff ff       	call   801df1 <fsv_alloc>
+  80215d:	85 c0                	test   %eax,%eax
+  80215f:	78 d5                	js     802136 <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  802161:	83 ec 04             	sub    $0x4,%esp
+  802164:	53                   	push   %ebx
+  802165:	ff 75 0c             	push   0xc(%ebp)
+  802168:	68 00 10 c0 9f       	push   $0x9fc01000
+  80216d:	e8 25 ed ff ff       	call   800e97 <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  802172:	8b 46 0c             	mov    0xc(%esi),%eax
+  802175:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  80217a:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  802180:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  802187:	89 f9                	mov    %edi,%ecx
+  802189:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  80218e:	b8 0d 00 00 00       	mov    $0xd,%eax
+  802193:	e8 69 fa ff ff       	call   801c01 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  802198:	6a 00                	push   $0x0
+  80219a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80219d:	50                   	push   %eax
+  80219e:	6a 00                	push   $0x0
+  8021a0:	6a 00                	push   $0x0
+  8021a2:	e8 c6 0e 00 00       	call   80306d <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  8021a7:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  8021aa:	eb 8a                	jmp    802136 <devfile_write+0x47>
+
+008021ac <open>:
+{
+  8021ac:	55                   	push   %ebp
+  8021ad:	89 e5                	mov    %esp,%ebp
+  8021af:	56                   	push   %esi
+  8021b0:	53                   	push   %ebx
+  8021b1:	83 ec 1c             	sub    $0x1c,%esp
+  8021b4:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  8021b7:	56                   	push   %esi
+  8021b8:	e8 19 eb ff ff       	call   800cd6 <strlen>
+  8021bd:	83 c4 10             	add    $0x10,%esp
+  8021c0:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8021c5:	7f 6c                	jg     802233 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  8021c7:	83 ec 0c             	sub    $0xc,%esp
+  8021ca:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021cd:	50                   	push   %eax
+  8021ce:	e8 ad f4 ff ff       	call   801680 <fd_alloc>
+  8021d3:	89 c3                	mov    %eax,%ebx
+  8021d5:	83 c4 10             	add    $0x10,%esp
+  8021d8:	85 c0                	test   %eax,%eax
+  8021da:	78 3c                	js     802218 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  8021dc:	83 ec 08             	sub    $0x8,%esp
+  8021df:	56                   	push   %esi
+  8021e0:	68 00 60 80 00       	push   $0x806000
+  8021e5:	e8 27 eb ff ff       	call   800d11 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  8021ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021ed:	a3 00 64 80 00       	mov    %eax,0x806400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8021f2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8021f5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8021fa:	e8 1b fb ff ff       	call   801d1a <fsipc>
+  8021ff:	89 c3                	mov    %eax,%ebx
+  802201:	83 c4 10             	add    $0x10,%esp
+  802204:	85 c0                	test   %eax,%eax
+  802206:	78 19                	js     802221 <open+0x75>
+  return fd2num(fd);
+  802208:	83 ec 0c             	sub    $0xc,%esp
+  80220b:	ff 75 f4             	push   -0xc(%ebp)
+  80220e:	e8 49 f4 ff ff       	call   80165c <fd2num>
+  802213:	89 c3                	mov    %eax,%ebx
+  802215:	83 c4 10             	add    $0x10,%esp
+}
+  802218:	89 d8                	mov    %ebx,%eax
+  80221a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80221d:	5b                   	pop    %ebx
+  80221e:	5e                   	pop    %esi
+  80221f:	5d                   	pop    %ebp
+  802220:	c3                   	ret
+    fd_close(fd, 0);
+  802221:	83 ec 08             	sub    $0x8,%esp
+  802224:	6a 00                	push   $0x0
+  802226:	ff 75 f4             	push   -0xc(%ebp)
+  802229:	e8 44 f5 ff ff       	call   801772 <fd_close>
+    return r;
+  80222e:	83 c4 10             	add    $0x10,%esp
+  802231:	eb e5                	jmp    802218 <open+0x6c>
+    return -E_BAD_PATH;
+  802233:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802238:	eb de                	jmp    802218 <open+0x6c>
+
+0080223a <open_read>:
+{
+  80223a:	55                   	push   %ebp
+  80223b:	89 e5                	mov    %esp,%ebp
+  80223d:	57                   	push   %edi
+  80223e:	56                   	push   %esi
+  80223f:	53                   	push   %ebx
+  802240:	83 ec 28             	sub    $0x28,%esp
+  802243:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  802246:	57                   	push   %edi
+  802247:	e8 8a ea ff ff       	call   800cd6 <strlen>
+  80224c:	83 c4 10             	add    $0x10,%esp
+  80224f:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802254:	0f 87 f6 00 00 00    	ja     802350 <open_read+0x116>
+  80225a:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  80225c:	83 ec 0c             	sub    $0xc,%esp
+  80225f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802262:	50                   	push   %eax
+  802263:	e8 18 f4 ff ff       	call   801680 <fd_alloc>
+  802268:	89 c3                	mov    %eax,%ebx
+  80226a:	83 c4 10             	add    $0x10,%esp
+  80226d:	85 c0                	test   %eax,%eax
+  80226f:	0f 88 b2 00 00 00    	js     802327 <open_read+0xed>
+  strcpy(req->req_buf, path);
+  802275:	83 ec 08             	sub    $0x8,%esp
+  802278:	57                   	push   %edi
+  802279:	68 e4 60 80 00       	push   $0x8060e4
+  80227e:	e8 8e ea ff ff       	call   800d11 <strcpy>
+  req->req_nops = 2;
+  802283:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  80228a:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  80228d:	c7 05 04 60 80 00 01 	movl   $0x1,0x806004
+  802294:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  802297:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80229a:	a3 10 60 80 00       	mov    %eax,0x806010
+  req->req_ops[0].op_buf = 0;
+  80229f:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  8022a6:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  8022a9:	c7 05 20 60 80 00 04 	movl   $0x4,0x806020
+  8022b0:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  8022b3:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  8022ba:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  8022bd:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  8022c2:	29 f0                	sub    %esi,%eax
+  8022c4:	3b 45 14             	cmp    0x14(%ebp),%eax
+  8022c7:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  8022cb:	a3 2c 60 80 00       	mov    %eax,0x80602c
+  req->req_ops[1].op_offset = 0;
+  8022d0:	c7 05 30 60 80 00 00 	movl   $0x0,0x806030
+  8022d7:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  8022da:	83 c6 01             	add    $0x1,%esi
+  8022dd:	89 35 34 60 80 00    	mov    %esi,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  8022e3:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8022e6:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8022eb:	e8 2a fa ff ff       	call   801d1a <fsipc>
+  8022f0:	89 c3                	mov    %eax,%ebx
+  8022f2:	83 c4 10             	add    $0x10,%esp
+  8022f5:	83 f8 01             	cmp    $0x1,%eax
+  8022f8:	7e 37                	jle    802331 <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  8022fa:	a1 38 60 80 00       	mov    0x806038,%eax
+  8022ff:	8b 55 18             	mov    0x18(%ebp),%edx
+  802302:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  802304:	83 ec 04             	sub    $0x4,%esp
+  802307:	50                   	push   %eax
+  802308:	81 c6 e4 60 80 00    	add    $0x8060e4,%esi
+  80230e:	56                   	push   %esi
+  80230f:	ff 75 10             	push   0x10(%ebp)
+  802312:	e8 80 eb ff ff       	call   800e97 <memmove>
+  return fd2num(fd);
+  802317:	83 c4 04             	add    $0x4,%esp
+  80231a:	ff 75 e4             	push   -0x1c(%ebp)
+  80231d:	e8 3a f3 ff ff       	call   80165c <fd2num>
+  802322:	89 c3                	mov    %eax,%ebx
+  802324:	83 c4 10             	add    $0x10,%esp
+}
+  802327:	89 d8                	mov    %ebx,%eax
+  802329:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80232c:	5b                   	pop    %ebx
+  80232d:	5e                   	pop    %esi
+  80232e:	5f                   	pop    %edi
+  80232f:	5d                   	pop    %ebp
+  802330:	c3                   	ret
+    fd_close(fd, 0);
+  802331:	83 ec 08             	sub    $0x8,%esp
+  802334:	6a 00                	push   $0x0
+  802336:	ff 75 e4             	push   -0x1c(%ebp)
+  802339:	e8 34 f4 ff ff       	call   801772 <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  80233e:	83 c4 10             	add    $0x10,%esp
+  802341:	85 db                	test   %ebx,%ebx
+  802343:	78 e2                	js     802327 <open_read+0xed>
+  802345:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  802348:	8b 9b 1c 60 80 00    	mov    0x80601c(%ebx),%ebx
+  80234e:	eb d7                	jmp    802327 <open_read+0xed>
+    return -E_BAD_PATH;
+  802350:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802355:	eb d0                	jmp    802327 <open_read+0xed>
+
+00802357 <file_stat>:
+{
+  802357:	55                   	push   %ebp
+  802358:	89 e5                	mov    %esp,%ebp
+  80235a:	57                   	push   %edi
+  80235b:	56                   	push   %esi
+  80235c:	53                   	push   %ebx
+  80235d:	83 ec 18             	sub    $0x18,%esp
+  802360:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802363:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  802366:	57                   	push   %edi
+  802367:	e8 6a e9 ff ff       	call   800cd6 <strlen>
+  80236c:	83 c4 10             	add    $0x10,%esp
+  80236f:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802374:	0f 8f c7 00 00 00    	jg     802441 <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  80237a:	83 ec 0c             	sub    $0xc,%esp
+  80237d:	57                   	push   %edi
+  80237e:	e8 53 e9 ff ff       	call   800cd6 <strlen>
+  802383:	8d 58 04             	lea    0x4(%eax),%ebx
+  802386:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  802389:	83 c4 08             	add    $0x8,%esp
+  80238c:	57                   	push   %edi
+  80238d:	68 e4 60 80 00       	push   $0x8060e4
+  802392:	e8 7a e9 ff ff       	call   800d11 <strcpy>
+  req->req_nops = 2;
+  802397:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  80239e:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  8023a1:	c7 05 04 60 80 00 02 	movl   $0x2,0x806004
+  8023a8:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  8023ab:	c7 05 10 60 80 00 00 	movl   $0x0,0x806010
+  8023b2:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  8023b5:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  8023bc:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  8023bf:	c7 05 20 60 80 00 03 	movl   $0x3,0x806020
+  8023c6:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  8023c9:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  8023d0:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  8023d3:	89 1d 34 60 80 00    	mov    %ebx,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  8023d9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023de:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8023e3:	e8 32 f9 ff ff       	call   801d1a <fsipc>
+  8023e8:	83 c4 10             	add    $0x10,%esp
+  8023eb:	83 f8 01             	cmp    $0x1,%eax
+  8023ee:	7e 42                	jle    802432 <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  8023f0:	81 c3 e4 60 80 00    	add    $0x8060e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  8023f6:	83 ec 08             	sub    $0x8,%esp
+  8023f9:	53                   	push   %ebx
+  8023fa:	56                   	push   %esi
+  8023fb:	e8 11 e9 ff ff       	call   800d11 <strcpy>
+  st->st_size = ret->ret_size;
+  802400:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  802406:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  80240c:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  802412:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  802418:	c7 86 88 00 00 00 04 	movl   $0x804004,0x88(%esi)
+  80241f:	40 80 00 
+  return 0;
+  802422:	83 c4 10             	add    $0x10,%esp
+  802425:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80242a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80242d:	5b                   	pop    %ebx
+  80242e:	5e                   	pop    %esi
+  80242f:	5f                   	pop    %edi
+  802430:	5d                   	pop    %ebp
+  802431:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  802432:	85 c0                	test   %eax,%eax
+  802434:	78 f4                	js     80242a <file_stat+0xd3>
+  802436:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802439:	8b 80 1c 60 80 00    	mov    0x80601c(%eax),%eax
+  80243f:	eb e9                	jmp    80242a <file_stat+0xd3>
+    return -E_BAD_PATH;
+  802441:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802446:	eb e2                	jmp    80242a <file_stat+0xd3>
+
+00802448 <read_map>:
+{
+  802448:	55                   	push   %ebp
+  802449:	89 e5                	mov    %esp,%ebp
+  80244b:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80244e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802451:	50                   	push   %eax
+  802452:	ff 75 08             	push   0x8(%ebp)
+  802455:	e8 7c f2 ff ff       	call   8016d6 <fd_lookup>
+  80245a:	83 c4 10             	add    $0x10,%esp
+  80245d:	85 c0                	test   %eax,%eax
+  80245f:	78 2a                	js     80248b <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  802461:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802464:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  80246a:	39 08                	cmp    %ecx,(%eax)
+  80246c:	75 1f                	jne    80248d <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  80246e:	8b 40 0c             	mov    0xc(%eax),%eax
+  802471:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read_map.req_offset = offset;
+  802476:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802479:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  80247e:	8b 55 10             	mov    0x10(%ebp),%edx
+  802481:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802486:	e8 8f f8 ff ff       	call   801d1a <fsipc>
+}
+  80248b:	c9                   	leave
+  80248c:	c3                   	ret
+    return -E_INVAL;
+  80248d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802492:	eb f7                	jmp    80248b <read_map+0x43>
+
+00802494 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802494:	55                   	push   %ebp
+  802495:	89 e5                	mov    %esp,%ebp
+  802497:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  80249a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80249f:	b8 08 00 00 00       	mov    $0x8,%eax
+  8024a4:	e8 71 f8 ff ff       	call   801d1a <fsipc>
+}
+  8024a9:	c9                   	leave
+  8024aa:	c3                   	ret
+
+008024ab <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  8024ab:	55                   	push   %ebp
+  8024ac:	89 e5                	mov    %esp,%ebp
+  8024ae:	57                   	push   %edi
+  8024af:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  8024b0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024b3:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.stats.req_bio_sched = 0;
+  8024b8:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  8024bf:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  8024c2:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  8024c9:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  8024cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024d1:	b8 09 00 00 00       	mov    $0x9,%eax
+  8024d6:	e8 3f f8 ff ff       	call   801d1a <fsipc>
+  8024db:	85 c0                	test   %eax,%eax
+  8024dd:	78 14                	js     8024f3 <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  8024df:	be 00 60 80 00       	mov    $0x806000,%esi
+  8024e4:	b9 16 00 00 00       	mov    $0x16,%ecx
+  8024e9:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8024ec:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  8024ee:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024f3:	5e                   	pop    %esi
+  8024f4:	5f                   	pop    %edi
+  8024f5:	5d                   	pop    %ebp
+  8024f6:	c3                   	ret
+
+008024f7 <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  8024f7:	55                   	push   %ebp
+  8024f8:	89 e5                	mov    %esp,%ebp
+  8024fa:	53                   	push   %ebx
+  8024fb:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  8024fe:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802501:	50                   	push   %eax
+  802502:	6a 00                	push   $0x0
+  802504:	e8 a2 ff ff ff       	call   8024ab <fs_stats>
+  802509:	83 c4 10             	add    $0x10,%esp
+  80250c:	85 c0                	test   %eax,%eax
+  80250e:	78 28                	js     802538 <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  802510:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  802513:	83 ec 08             	sub    $0x8,%esp
+  802516:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802519:	50                   	push   %eax
+  80251a:	6a 20                	push   $0x20
+  80251c:	e8 8a ff ff ff       	call   8024ab <fs_stats>
+  802521:	83 c4 10             	add    $0x10,%esp
+  802524:	85 c0                	test   %eax,%eax
+  802526:	78 10                	js     802538 <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  802528:	83 ec 08             	sub    $0x8,%esp
+  80252b:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  80252e:	50                   	push   %eax
+  80252f:	53                   	push   %ebx
+  802530:	e8 76 ff ff ff       	call   8024ab <fs_stats>
+  802535:	83 c4 10             	add    $0x10,%esp
+}
+  802538:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80253b:	c9                   	leave
+  80253c:	c3                   	ret
+
+0080253d <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  80253d:	55                   	push   %ebp
+  80253e:	89 e5                	mov    %esp,%ebp
+  802540:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  802543:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  80254a:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  80254d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802550:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.stats.req_dcache = 0;
+  802555:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  80255c:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  80255f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802564:	b8 09 00 00 00       	mov    $0x9,%eax
+  802569:	e8 ac f7 ff ff       	call   801d1a <fsipc>
+}
+  80256e:	c9                   	leave
+  80256f:	c3                   	ret
+
+00802570 <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  802570:	55                   	push   %ebp
+  802571:	89 e5                	mov    %esp,%ebp
+  802573:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  802576:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  80257d:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  802580:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  802587:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  80258a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80258d:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_STATS, NULL);
+  802592:	ba 00 00 00 00       	mov    $0x0,%edx
+  802597:	b8 09 00 00 00       	mov    $0x9,%eax
+  80259c:	e8 79 f7 ff ff       	call   801d1a <fsipc>
+}
+  8025a1:	c9                   	leave
+  8025a2:	c3                   	ret
+
+008025a3 <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  8025a3:	55                   	push   %ebp
+  8025a4:	89 e5                	mov    %esp,%ebp
+  8025a6:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8025a9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8025ac:	50                   	push   %eax
+  8025ad:	ff 75 08             	push   0x8(%ebp)
+  8025b0:	e8 21 f1 ff ff       	call   8016d6 <fd_lookup>
+  8025b5:	83 c4 10             	add    $0x10,%esp
+  8025b8:	85 c0                	test   %eax,%eax
+  8025ba:	78 34                	js     8025f0 <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  8025bc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025bf:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  8025c5:	39 08                	cmp    %ecx,(%eax)
+  8025c7:	75 29                	jne    8025f2 <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  8025c9:	8b 40 0c             	mov    0xc(%eax),%eax
+  8025cc:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.fallocate.req_offset = offset;
+  8025d1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8025d4:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.fallocate.req_len = len;
+  8025d9:	8b 45 10             	mov    0x10(%ebp),%eax
+  8025dc:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  8025e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025e6:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8025eb:	e8 2a f7 ff ff       	call   801d1a <fsipc>
+}
+  8025f0:	c9                   	leave
+  8025f1:	c3                   	ret
+    return -E_INVAL;
+  8025f2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8025f7:	eb f7                	jmp    8025f0 <fallocate+0x4d>
+
+008025f9 <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  8025f9:	55                   	push   %ebp
+  8025fa:	89 e5                	mov    %esp,%ebp
+  8025fc:	57                   	push   %edi
+  8025fd:	56                   	push   %esi
+  8025fe:	53                   	push   %ebx
+  8025ff:	83 ec 24             	sub    $0x24,%esp
+  802602:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802605:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802608:	50                   	push   %eax
+  802609:	ff 75 08             	push   0x8(%ebp)
+  80260c:	e8 c5 f0 ff ff       	call   8016d6 <fd_lookup>
+  802611:	83 c4 10             	add    $0x10,%esp
+  802614:	85 c0                	test   %eax,%eax
+  802616:	78 66                	js     80267e <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  802618:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80261b:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  802621:	39 08                	cmp    %ecx,(%eax)
+  802623:	75 61                	jne    802686 <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  802625:	85 f6                	test   %esi,%esi
+  802627:	7e 50                	jle    802679 <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  802629:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  80262e:	39 de                	cmp    %ebx,%esi
+  802630:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  802633:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802636:	8b 40 0c             	mov    0xc(%eax),%eax
+  802639:	a3 00 60 80 00       	mov    %eax,0x806000
+    fsipcbuf.prefetch.req_n = m;
+  80263e:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  802644:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  80264b:	83 ec 04             	sub    $0x4,%esp
+  80264e:	57                   	push   %edi
+  80264f:	ff 75 0c             	push   0xc(%ebp)
+  802652:	68 08 60 80 00       	push   $0x806008
+  802657:	e8 3b e8 ff ff       	call   800e97 <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  80265c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802661:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802666:	e8 af f6 ff ff       	call   801d1a <fsipc>
+  80266b:	83 c4 10             	add    $0x10,%esp
+  80266e:	85 c0                	test   %eax,%eax
+  802670:	78 0c                	js     80267e <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  802672:	01 7d 0c             	add    %edi,0xc(%ebp)
+  802675:	29 de                	sub    %ebx,%esi
+  802677:	eb ac                	jmp    802625 <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  802679:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80267e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802681:	5b                   	pop    %ebx
+  802682:	5e                   	pop    %esi
+  802683:	5f                   	pop    %edi
+  802684:	5d                   	pop    %ebp
+  802685:	c3                   	ret
+    return -E_INVAL;
+  802686:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80268b:	eb f1                	jmp    80267e <prefetch+0x85>
+
+0080268d <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  80268d:	55                   	push   %ebp
+  80268e:	89 e5                	mov    %esp,%ebp
+  802690:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  802693:	50                   	push   %eax
+  802694:	e8 d3 ef ff ff       	call   80166c <fd2data>
+  802699:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  80269e:	c9                   	leave
+  80269f:	c3                   	ret
+
+008026a0 <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8026a0:	55                   	push   %ebp
+  8026a1:	89 e5                	mov    %esp,%ebp
+  8026a3:	56                   	push   %esi
+  8026a4:	53                   	push   %ebx
+  8026a5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  8026a8:	83 ec 0c             	sub    $0xc,%esp
+  8026ab:	ff 75 08             	push   0x8(%ebp)
+  8026ae:	e8 b9 ef ff ff       	call   80166c <fd2data>
+  8026b3:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  8026b5:	83 c4 08             	add    $0x8,%esp
+  8026b8:	68 c8 39 80 00       	push   $0x8039c8
+  8026bd:	53                   	push   %ebx
+  8026be:	e8 4e e6 ff ff       	call   800d11 <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  8026c3:	8b 46 04             	mov    0x4(%esi),%eax
+  8026c6:	2b 06                	sub    (%esi),%eax
+  8026c8:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  8026ce:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8026d5:	00 00 00 
+  stat->st_dev = &devpipe;
+  8026d8:	c7 83 88 00 00 00 20 	movl   $0x804020,0x88(%ebx)
+  8026df:	40 80 00 
+  return 0;
+}
+  8026e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026e7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026ea:	5b                   	pop    %ebx
+  8026eb:	5e                   	pop    %esi
+  8026ec:	5d                   	pop    %ebp
+  8026ed:	c3                   	ret
+
+008026ee <pipe_wakeup>:
+{
+  8026ee:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  8026f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026f5:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  8026f8:	85 c0                	test   %eax,%eax
+  8026fa:	75 01                	jne    8026fd <pipe_wakeup+0xf>
+  8026fc:	c3                   	ret
+{
+  8026fd:	55                   	push   %ebp
+  8026fe:	89 e5                	mov    %esp,%ebp
+  802700:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  802703:	6a 00                	push   $0x0
+  802705:	68 00 00 c0 ee       	push   $0xeec00000
+  80270a:	52                   	push   %edx
+  80270b:	e8 8c ed ff ff       	call   80149c <sys_chan_wakeup>
+  802710:	83 c4 10             	add    $0x10,%esp
+}
+  802713:	c9                   	leave
+  802714:	c3                   	ret
+
+00802715 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802715:	55                   	push   %ebp
+  802716:	89 e5                	mov    %esp,%ebp
+  802718:	57                   	push   %edi
+  802719:	56                   	push   %esi
+  80271a:	53                   	push   %ebx
+  80271b:	83 ec 18             	sub    $0x18,%esp
+  80271e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  802721:	57                   	push   %edi
+  802722:	e8 45 ef ff ff       	call   80166c <fd2data>
+  802727:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  802729:	83 c4 10             	add    $0x10,%esp
+  80272c:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  802730:	74 2a                	je     80275c <devpipe_close+0x47>
+  802732:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  802737:	89 f8                	mov    %edi,%eax
+  802739:	e8 4f ff ff ff       	call   80268d <pipe_ring>
+  80273e:	83 ec 08             	sub    $0x8,%esp
+  802741:	01 d8                	add    %ebx,%eax
+  802743:	50                   	push   %eax
+  802744:	6a 00                	push   $0x0
+  802746:	e8 7a ea ff ff       	call   8011c5 <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  80274b:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802751:	83 c4 10             	add    $0x10,%esp
+  802754:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  80275a:	75 db                	jne    802737 <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  80275c:	83 ec 08             	sub    $0x8,%esp
+  80275f:	57                   	push   %edi
+  802760:	6a 00                	push   $0x0
+  802762:	e8 5e ea ff ff       	call   8011c5 <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  802767:	83 c4 10             	add    $0x10,%esp
+  80276a:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  80276e:	75 13                	jne    802783 <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  802770:	83 ec 08             	sub    $0x8,%esp
+  802773:	56                   	push   %esi
+  802774:	6a 00                	push   $0x0
+  802776:	e8 4a ea ff ff       	call   8011c5 <sys_page_unmap>
+}
+  80277b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80277e:	5b                   	pop    %ebx
+  80277f:	5e                   	pop    %esi
+  802780:	5f                   	pop    %edi
+  802781:	5d                   	pop    %ebp
+  802782:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802783:	8d 56 04             	lea    0x4(%esi),%edx
+  802786:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802789:	e8 60 ff ff ff       	call   8026ee <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  80278e:	8d 46 30             	lea    0x30(%esi),%eax
+  802791:	89 f2                	mov    %esi,%edx
+  802793:	e8 56 ff ff ff       	call   8026ee <pipe_wakeup>
+  802798:	eb d6                	jmp    802770 <devpipe_close+0x5b>
+
+0080279a <_pipeisclosed>:
+{
+  80279a:	55                   	push   %ebp
+  80279b:	89 e5                	mov    %esp,%ebp
+  80279d:	57                   	push   %edi
+  80279e:	56                   	push   %esi
+  80279f:	53                   	push   %ebx
+  8027a0:	83 ec 1c             	sub    $0x1c,%esp
+  8027a3:	89 c7                	mov    %eax,%edi
+  8027a5:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  8027a7:	a1 04 58 80 00       	mov    0x805804,%eax
+  8027ac:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  8027af:	83 ec 0c             	sub    $0xc,%esp
+  8027b2:	57                   	push   %edi
+  8027b3:	e8 18 0a 00 00       	call   8031d0 <pageref>
+  8027b8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8027bb:	89 34 24             	mov    %esi,(%esp)
+  8027be:	e8 0d 0a 00 00       	call   8031d0 <pageref>
+    nn = thisenv->env_runs;
+  8027c3:	8b 15 04 58 80 00    	mov    0x805804,%edx
+  8027c9:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  8027cc:	83 c4 10             	add    $0x10,%esp
+  8027cf:	39 cb                	cmp    %ecx,%ebx
+  8027d1:	74 1b                	je     8027ee <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  8027d3:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8027d6:	75 cf                	jne    8027a7 <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8027d8:	8b 42 58             	mov    0x58(%edx),%eax
+  8027db:	6a 01                	push   $0x1
+  8027dd:	50                   	push   %eax
+  8027de:	53                   	push   %ebx
+  8027df:	68 cf 39 80 00       	push   $0x8039cf
+  8027e4:	e8 3a df ff ff       	call   800723 <cprintf>
+  8027e9:	83 c4 10             	add    $0x10,%esp
+  8027ec:	eb b9                	jmp    8027a7 <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  8027ee:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8027f1:	0f 94 c0             	sete   %al
+  8027f4:	0f b6 c0             	movzbl %al,%eax
+}
+  8027f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027fa:	5b                   	pop    %ebx
+  8027fb:	5e                   	pop    %esi
+  8027fc:	5f                   	pop    %edi
+  8027fd:	5d                   	pop    %ebp
+  8027fe:	c3                   	ret
+
+008027ff <devpipe_write_bulk>:
+{
+  8027ff:	55                   	push   %ebp
+  802800:	89 e5                	mov    %esp,%ebp
+  802802:	57                   	push   %edi
+  802803:	56                   	push   %esi
+  802804:	53                   	push   %ebx
+  802805:	83 ec 1c             	sub    $0x1c,%esp
+  802808:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80280b:	89 d6                	mov    %edx,%esi
+  80280d:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  802810:	e8 78 fe ff ff       	call   80268d <pipe_ring>
+  802815:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  802818:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  80281d:	8d 46 04             	lea    0x4(%esi),%eax
+  802820:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  802823:	eb 75                	jmp    80289a <devpipe_write_bulk+0x9b>
+  802825:	b8 01 00 00 00       	mov    $0x1,%eax
+  80282a:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  80282e:	6a 64                	push   $0x64
+  802830:	68 00 00 c0 ee       	push   $0xeec00000
+  802835:	53                   	push   %ebx
+  802836:	56                   	push   %esi
+  802837:	e8 3d ec ff ff       	call   801479 <sys_chan_sleep>
+      continue;
+  80283c:	83 c4 10             	add    $0x10,%esp
+  80283f:	eb 59                	jmp    80289a <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  802841:	89 d1                	mov    %edx,%ecx
+  802843:	c1 f9 1f             	sar    $0x1f,%ecx
+  802846:	c1 e9 11             	shr    $0x11,%ecx
+  802849:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  80284c:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802851:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  802853:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  802859:	29 d3                	sub    %edx,%ebx
+  80285b:	ba 00 80 00 00       	mov    $0x8000,%edx
+  802860:	29 c2                	sub    %eax,%edx
+  802862:	39 d3                	cmp    %edx,%ebx
+  802864:	0f 47 da             	cmova  %edx,%ebx
+  802867:	8b 55 08             	mov    0x8(%ebp),%edx
+  80286a:	29 fa                	sub    %edi,%edx
+  80286c:	39 d3                	cmp    %edx,%ebx
+  80286e:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  802871:	83 ec 04             	sub    $0x4,%esp
+  802874:	53                   	push   %ebx
+  802875:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802878:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  80287b:	52                   	push   %edx
+  80287c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80287f:	01 c8                	add    %ecx,%eax
+  802881:	50                   	push   %eax
+  802882:	e8 72 e6 ff ff       	call   800ef9 <memcpy>
+    i += m;
+  802887:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  802889:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  80288c:	8d 46 2c             	lea    0x2c(%esi),%eax
+  80288f:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802892:	e8 57 fe ff ff       	call   8026ee <pipe_wakeup>
+  802897:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  80289a:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  80289d:	73 2b                	jae    8028ca <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  80289f:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  8028a1:	8b 56 04             	mov    0x4(%esi),%edx
+  8028a4:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  8028aa:	39 d0                	cmp    %edx,%eax
+  8028ac:	7d 93                	jge    802841 <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  8028ae:	89 f2                	mov    %esi,%edx
+  8028b0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8028b3:	e8 e2 fe ff ff       	call   80279a <_pipeisclosed>
+  8028b8:	85 c0                	test   %eax,%eax
+  8028ba:	0f 84 65 ff ff ff    	je     802825 <devpipe_write_bulk+0x26>
+        return i;
+  8028c0:	89 f8                	mov    %edi,%eax
+}
+  8028c2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028c5:	5b                   	pop    %ebx
+  8028c6:	5e                   	pop    %esi
+  8028c7:	5f                   	pop    %edi
+  8028c8:	5d                   	pop    %ebp
+  8028c9:	c3                   	ret
+  return i;
+  8028ca:	89 f8                	mov    %edi,%eax
+  8028cc:	eb f4                	jmp    8028c2 <devpipe_write_bulk+0xc3>
+
+008028ce <devpipe_write>:
+{
+  8028ce:	55                   	push   %ebp
+  8028cf:	89 e5                	mov    %esp,%ebp
+  8028d1:	57                   	push   %edi
+  8028d2:	56                   	push   %esi
+  8028d3:	53                   	push   %ebx
+  8028d4:	83 ec 28             	sub    $0x28,%esp
+  8028d7:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  8028da:	56                   	push   %esi
+  8028db:	e8 8c ed ff ff       	call   80166c <fd2data>
+  8028e0:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  8028e2:	8b 78 28             	mov    0x28(%eax),%edi
+  8028e5:	83 c4 10             	add    $0x10,%esp
+  8028e8:	85 ff                	test   %edi,%edi
+  8028ea:	75 25                	jne    802911 <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  8028ec:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8028ef:	74 66                	je     802957 <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8028f1:	8b 43 04             	mov    0x4(%ebx),%eax
+  8028f4:	8b 0b                	mov    (%ebx),%ecx
+  8028f6:	8d 51 20             	lea    0x20(%ecx),%edx
+  8028f9:	39 d0                	cmp    %edx,%eax
+  8028fb:	72 2b                	jb     802928 <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  8028fd:	89 da                	mov    %ebx,%edx
+  8028ff:	89 f0                	mov    %esi,%eax
+  802901:	e8 94 fe ff ff       	call   80279a <_pipeisclosed>
+  802906:	85 c0                	test   %eax,%eax
+  802908:	75 51                	jne    80295b <devpipe_write+0x8d>
+      sys_yield();
+  80290a:	e8 cf e7 ff ff       	call   8010de <sys_yield>
+  80290f:	eb e0                	jmp    8028f1 <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  802911:	83 ec 0c             	sub    $0xc,%esp
+  802914:	ff 75 10             	push   0x10(%ebp)
+  802917:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80291a:	89 c2                	mov    %eax,%edx
+  80291c:	89 f0                	mov    %esi,%eax
+  80291e:	e8 dc fe ff ff       	call   8027ff <devpipe_write_bulk>
+  802923:	83 c4 10             	add    $0x10,%esp
+  802926:	eb 38                	jmp    802960 <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802928:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80292b:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  80292f:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802932:	89 c2                	mov    %eax,%edx
+  802934:	c1 fa 1f             	sar    $0x1f,%edx
+  802937:	89 d1                	mov    %edx,%ecx
+  802939:	c1 e9 1b             	shr    $0x1b,%ecx
+  80293c:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80293f:	83 e2 1f             	and    $0x1f,%edx
+  802942:	29 ca                	sub    %ecx,%edx
+  802944:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802948:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  80294c:	83 c0 01             	add    $0x1,%eax
+  80294f:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  802952:	83 c7 01             	add    $0x1,%edi
+  802955:	eb 95                	jmp    8028ec <devpipe_write+0x1e>
+  return i;
+  802957:	89 f8                	mov    %edi,%eax
+  802959:	eb 05                	jmp    802960 <devpipe_write+0x92>
+        return 0;
+  80295b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802960:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802963:	5b                   	pop    %ebx
+  802964:	5e                   	pop    %esi
+  802965:	5f                   	pop    %edi
+  802966:	5d                   	pop    %ebp
+  802967:	c3                   	ret
+
+00802968 <devpipe_read_bulk>:
+{
+  802968:	55                   	push   %ebp
+  802969:	89 e5                	mov    %esp,%ebp
+  80296b:	57                   	push   %edi
+  80296c:	56                   	push   %esi
+  80296d:	53                   	push   %ebx
+  80296e:	83 ec 2c             	sub    $0x2c,%esp
+  802971:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802974:	89 d6                	mov    %edx,%esi
+  802976:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802979:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  80297c:	e8 0c fd ff ff       	call   80268d <pipe_ring>
+  802981:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  802984:	85 db                	test   %ebx,%ebx
+  802986:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80298b:	0f 45 c3             	cmovne %ebx,%eax
+  80298e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802991:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802996:	8d 46 30             	lea    0x30(%esi),%eax
+  802999:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  80299c:	eb 50                	jmp    8029ee <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  80299e:	89 d1                	mov    %edx,%ecx
+  8029a0:	c1 f9 1f             	sar    $0x1f,%ecx
+  8029a3:	c1 e9 11             	shr    $0x11,%ecx
+  8029a6:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  8029a9:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8029ae:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  8029b0:	29 d3                	sub    %edx,%ebx
+  8029b2:	ba 00 80 00 00       	mov    $0x8000,%edx
+  8029b7:	29 c2                	sub    %eax,%edx
+  8029b9:	39 d3                	cmp    %edx,%ebx
+  8029bb:	0f 47 da             	cmova  %edx,%ebx
+  8029be:	8b 55 08             	mov    0x8(%ebp),%edx
+  8029c1:	29 fa                	sub    %edi,%edx
+  8029c3:	39 d3                	cmp    %edx,%ebx
+  8029c5:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  8029c8:	83 ec 04             	sub    $0x4,%esp
+  8029cb:	53                   	push   %ebx
+  8029cc:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8029cf:	01 c8                	add    %ecx,%eax
+  8029d1:	50                   	push   %eax
+  8029d2:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8029d5:	01 f8                	add    %edi,%eax
+  8029d7:	50                   	push   %eax
+  8029d8:	e8 1c e5 ff ff       	call   800ef9 <memcpy>
+    i += m;
+  8029dd:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  8029df:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8029e1:	89 f2                	mov    %esi,%edx
+  8029e3:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8029e6:	e8 03 fd ff ff       	call   8026ee <pipe_wakeup>
+  8029eb:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  8029ee:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  8029f1:	73 51                	jae    802a44 <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  8029f3:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  8029f6:	8b 16                	mov    (%esi),%edx
+  8029f8:	39 da                	cmp    %ebx,%edx
+  8029fa:	75 a2                	jne    80299e <devpipe_read_bulk+0x36>
+      if (i > 0)
+  8029fc:	85 ff                	test   %edi,%edi
+  8029fe:	75 44                	jne    802a44 <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  802a00:	89 f2                	mov    %esi,%edx
+  802a02:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802a05:	e8 90 fd ff ff       	call   80279a <_pipeisclosed>
+  802a0a:	85 c0                	test   %eax,%eax
+  802a0c:	75 3a                	jne    802a48 <devpipe_read_bulk+0xe0>
+  802a0e:	b8 01 00 00 00       	mov    $0x1,%eax
+  802a13:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802a17:	6a 64                	push   $0x64
+  802a19:	ff 75 d4             	push   -0x2c(%ebp)
+  802a1c:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  802a1d:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802a20:	50                   	push   %eax
+  802a21:	e8 53 ea ff ff       	call   801479 <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  802a26:	85 c0                	test   %eax,%eax
+  802a28:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a2d:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  802a30:	83 c4 10             	add    $0x10,%esp
+  802a33:	a8 01                	test   $0x1,%al
+  802a35:	74 b7                	je     8029ee <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  802a37:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  802a3c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a3f:	5b                   	pop    %ebx
+  802a40:	5e                   	pop    %esi
+  802a41:	5f                   	pop    %edi
+  802a42:	5d                   	pop    %ebp
+  802a43:	c3                   	ret
+  return i;
+  802a44:	89 f8                	mov    %edi,%eax
+  802a46:	eb f4                	jmp    802a3c <devpipe_read_bulk+0xd4>
+        return 0;
+  802a48:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a4d:	eb ed                	jmp    802a3c <devpipe_read_bulk+0xd4>
+
+00802a4f <devpipe_read>:
+{
+  802a4f:	55                   	push   %ebp
+  802a50:	89 e5                	mov    %esp,%ebp
+  802a52:	57                   	push   %edi
+  802a53:	56                   	push   %esi
+  802a54:	53                   	push   %ebx
+  802a55:	83 ec 18             	sub    $0x18,%esp
+  802a58:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  802a5b:	57                   	push   %edi
+  802a5c:	e8 0b ec ff ff       	call   80166c <fd2data>
+  802a61:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  802a63:	8b 70 28             	mov    0x28(%eax),%esi
+  802a66:	83 c4 10             	add    $0x10,%esp
+  802a69:	85 f6                	test   %esi,%esi
+  802a6b:	75 24                	jne    802a91 <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  802a6d:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802a70:	74 60                	je     802ad2 <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  802a72:	8b 03                	mov    (%ebx),%eax
+  802a74:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802a77:	75 3b                	jne    802ab4 <devpipe_read+0x65>
+      if (i > 0)
+  802a79:	85 f6                	test   %esi,%esi
+  802a7b:	75 2d                	jne    802aaa <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  802a7d:	89 da                	mov    %ebx,%edx
+  802a7f:	89 f8                	mov    %edi,%eax
+  802a81:	e8 14 fd ff ff       	call   80279a <_pipeisclosed>
+  802a86:	85 c0                	test   %eax,%eax
+  802a88:	75 4c                	jne    802ad6 <devpipe_read+0x87>
+      sys_yield();
+  802a8a:	e8 4f e6 ff ff       	call   8010de <sys_yield>
+  802a8f:	eb e1                	jmp    802a72 <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  802a91:	83 ec 08             	sub    $0x8,%esp
+  802a94:	6a 00                	push   $0x0
+  802a96:	ff 75 10             	push   0x10(%ebp)
+  802a99:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802a9c:	89 c2                	mov    %eax,%edx
+  802a9e:	89 f8                	mov    %edi,%eax
+  802aa0:	e8 c3 fe ff ff       	call   802968 <devpipe_read_bulk>
+  802aa5:	83 c4 10             	add    $0x10,%esp
+  802aa8:	eb 02                	jmp    802aac <devpipe_read+0x5d>
+        return i;
+  802aaa:	89 f0                	mov    %esi,%eax
+}
+  802aac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802aaf:	5b                   	pop    %ebx
+  802ab0:	5e                   	pop    %esi
+  802ab1:	5f                   	pop    %edi
+  802ab2:	5d                   	pop    %ebp
+  802ab3:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802ab4:	99                   	cltd
+  802ab5:	c1 ea 1b             	shr    $0x1b,%edx
+  802ab8:	01 d0                	add    %edx,%eax
+  802aba:	83 e0 1f             	and    $0x1f,%eax
+  802abd:	29 d0                	sub    %edx,%eax
+  802abf:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802ac4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802ac7:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  802aca:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  802acd:	83 c6 01             	add    $0x1,%esi
+  802ad0:	eb 9b                	jmp    802a6d <devpipe_read+0x1e>
+  return i;
+  802ad2:	89 f0                	mov    %esi,%eax
+  802ad4:	eb d6                	jmp    802aac <devpipe_read+0x5d>
+        return 0;
+  802ad6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802adb:	eb cf                	jmp    802aac <devpipe_read+0x5d>
+
+00802add <pipe2>:
+{
+  802add:	55                   	push   %ebp
+  802ade:	89 e5                	mov    %esp,%ebp
+  802ae0:	57                   	push   %edi
+  802ae1:	56                   	push   %esi
+  802ae2:	53                   	push   %ebx
+  802ae3:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  802ae6:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802ae9:	50                   	push   %eax
+  802aea:	e8 91 eb ff ff       	call   801680 <fd_alloc>
+  802aef:	89 c3                	mov    %eax,%ebx
+  802af1:	83 c4 10             	add    $0x10,%esp
+  802af4:	85 c0                	test   %eax,%eax
+  802af6:	0f 88 fb 01 00 00    	js     802cf7 <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802afc:	83 ec 04             	sub    $0x4,%esp
+  802aff:	68 07 04 00 00       	push   $0x407
+  802b04:	ff 75 e4             	push   -0x1c(%ebp)
+  802b07:	6a 00                	push   $0x0
+  802b09:	e8 32 e6 ff ff       	call   801140 <sys_page_alloc>
+  802b0e:	89 c3                	mov    %eax,%ebx
+  802b10:	83 c4 10             	add    $0x10,%esp
+  802b13:	85 c0                	test   %eax,%eax
+  802b15:	0f 88 dc 01 00 00    	js     802cf7 <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  802b1b:	83 ec 0c             	sub    $0xc,%esp
+  802b1e:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  802b21:	50                   	push   %eax
+  802b22:	e8 59 eb ff ff       	call   801680 <fd_alloc>
+  802b27:	89 c3                	mov    %eax,%ebx
+  802b29:	83 c4 10             	add    $0x10,%esp
+  802b2c:	85 c0                	test   %eax,%eax
+  802b2e:	0f 88 b3 01 00 00    	js     802ce7 <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802b34:	83 ec 04             	sub    $0x4,%esp
+  802b37:	68 07 04 00 00       	push   $0x407
+  802b3c:	ff 75 e0             	push   -0x20(%ebp)
+  802b3f:	6a 00                	push   $0x0
+  802b41:	e8 fa e5 ff ff       	call   801140 <sys_page_alloc>
+  802b46:	89 c3                	mov    %eax,%ebx
+  802b48:	83 c4 10             	add    $0x10,%esp
+  802b4b:	85 c0                	test   %eax,%eax
+  802b4d:	0f 88 94 01 00 00    	js     802ce7 <pipe2+0x20a>
+  va = fd2data(fd0);
+  802b53:	83 ec 0c             	sub    $0xc,%esp
+  802b56:	ff 75 e4             	push   -0x1c(%ebp)
+  802b59:	e8 0e eb ff ff       	call   80166c <fd2data>
+  802b5e:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802b60:	83 c4 0c             	add    $0xc,%esp
+  802b63:	68 07 04 00 00       	push   $0x407
+  802b68:	50                   	push   %eax
+  802b69:	6a 00                	push   $0x0
+  802b6b:	e8 d0 e5 ff ff       	call   801140 <sys_page_alloc>
+  802b70:	89 c3                	mov    %eax,%ebx
+  802b72:	83 c4 10             	add    $0x10,%esp
+  802b75:	85 c0                	test   %eax,%eax
+  802b77:	0f 88 5a 01 00 00    	js     802cd7 <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802b7d:	83 ec 0c             	sub    $0xc,%esp
+  802b80:	ff 75 e0             	push   -0x20(%ebp)
+  802b83:	e8 e4 ea ff ff       	call   80166c <fd2data>
+  802b88:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802b8f:	50                   	push   %eax
+  802b90:	6a 00                	push   $0x0
+  802b92:	57                   	push   %edi
+  802b93:	6a 00                	push   $0x0
+  802b95:	e8 e9 e5 ff ff       	call   801183 <sys_page_map>
+  802b9a:	89 c3                	mov    %eax,%ebx
+  802b9c:	83 c4 20             	add    $0x20,%esp
+  802b9f:	85 c0                	test   %eax,%eax
+  802ba1:	0f 88 22 01 00 00    	js     802cc9 <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  802ba7:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  802bab:	74 72                	je     802c1f <pipe2+0x142>
+  802bad:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  802bb2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802bb5:	e8 d3 fa ff ff       	call   80268d <pipe_ring>
+  802bba:	83 ec 04             	sub    $0x4,%esp
+  802bbd:	68 07 04 00 00       	push   $0x407
+  802bc2:	01 f0                	add    %esi,%eax
+  802bc4:	50                   	push   %eax
+  802bc5:	6a 00                	push   $0x0
+  802bc7:	e8 74 e5 ff ff       	call   801140 <sys_page_alloc>
+  802bcc:	89 c3                	mov    %eax,%ebx
+  802bce:	83 c4 10             	add    $0x10,%esp
+  802bd1:	85 c0                	test   %eax,%eax
+  802bd3:	0f 88 97 00 00 00    	js     802c70 <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  802bd9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802bdc:	e8 ac fa ff ff       	call   80268d <pipe_ring>
+  802be1:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  802be4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802be7:	e8 a1 fa ff ff       	call   80268d <pipe_ring>
+  802bec:	83 ec 0c             	sub    $0xc,%esp
+  802bef:	68 07 04 00 00       	push   $0x407
+  802bf4:	53                   	push   %ebx
+  802bf5:	6a 00                	push   $0x0
+  802bf7:	01 f0                	add    %esi,%eax
+  802bf9:	50                   	push   %eax
+  802bfa:	6a 00                	push   $0x0
+  802bfc:	e8 82 e5 ff ff       	call   801183 <sys_page_map>
+  802c01:	89 c3                	mov    %eax,%ebx
+  802c03:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802c09:	83 c4 20             	add    $0x20,%esp
+  802c0c:	85 c0                	test   %eax,%eax
+  802c0e:	78 60                	js     802c70 <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  802c10:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802c16:	75 9a                	jne    802bb2 <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  802c18:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  802c1f:	a1 20 40 80 00       	mov    0x804020,%eax
+  802c24:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802c27:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  802c29:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802c2c:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  802c33:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802c36:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  802c38:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802c3b:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  802c42:	83 ec 0c             	sub    $0xc,%esp
+  802c45:	ff 75 e4             	push   -0x1c(%ebp)
+  802c48:	e8 0f ea ff ff       	call   80165c <fd2num>
+  802c4d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802c50:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  802c52:	83 c4 04             	add    $0x4,%esp
+  802c55:	ff 75 e0             	push   -0x20(%ebp)
+  802c58:	e8 ff e9 ff ff       	call   80165c <fd2num>
+  802c5d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802c60:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  802c63:	83 c4 10             	add    $0x10,%esp
+  802c66:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c6b:	e9 87 00 00 00       	jmp    802cf7 <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802c70:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  802c75:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802c78:	e8 10 fa ff ff       	call   80268d <pipe_ring>
+  802c7d:	83 ec 08             	sub    $0x8,%esp
+  802c80:	01 f0                	add    %esi,%eax
+  802c82:	50                   	push   %eax
+  802c83:	6a 00                	push   $0x0
+  802c85:	e8 3b e5 ff ff       	call   8011c5 <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  802c8a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802c8d:	e8 fb f9 ff ff       	call   80268d <pipe_ring>
+  802c92:	83 c4 08             	add    $0x8,%esp
+  802c95:	01 f0                	add    %esi,%eax
+  802c97:	50                   	push   %eax
+  802c98:	6a 00                	push   $0x0
+  802c9a:	e8 26 e5 ff ff       	call   8011c5 <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802c9f:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802ca5:	83 c4 10             	add    $0x10,%esp
+  802ca8:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802cae:	75 c5                	jne    802c75 <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  802cb0:	83 ec 0c             	sub    $0xc,%esp
+  802cb3:	ff 75 e0             	push   -0x20(%ebp)
+  802cb6:	e8 b1 e9 ff ff       	call   80166c <fd2data>
+  802cbb:	83 c4 08             	add    $0x8,%esp
+  802cbe:	50                   	push   %eax
+  802cbf:	6a 00                	push   $0x0
+  802cc1:	e8 ff e4 ff ff       	call   8011c5 <sys_page_unmap>
+  802cc6:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  802cc9:	83 ec 08             	sub    $0x8,%esp
+  802ccc:	57                   	push   %edi
+  802ccd:	6a 00                	push   $0x0
+  802ccf:	e8 f1 e4 ff ff       	call   8011c5 <sys_page_unmap>
+  802cd4:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  802cd7:	83 ec 08             	sub    $0x8,%esp
+  802cda:	ff 75 e0             	push   -0x20(%ebp)
+  802cdd:	6a 00                	push   $0x0
+  802cdf:	e8 e1 e4 ff ff       	call   8011c5 <sys_page_unmap>
+  802ce4:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  802ce7:	83 ec 08             	sub    $0x8,%esp
+  802cea:	ff 75 e4             	push   -0x1c(%ebp)
+  802ced:	6a 00                	push   $0x0
+  802cef:	e8 d1 e4 ff ff       	call   8011c5 <sys_page_unmap>
+  802cf4:	83 c4 10             	add    $0x10,%esp
+}
+  802cf7:	89 d8                	mov    %ebx,%eax
+  802cf9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802cfc:	5b                   	pop    %ebx
+  802cfd:	5e                   	pop    %esi
+  802cfe:	5f                   	pop    %edi
+  802cff:	5d                   	pop    %ebp
+  802d00:	c3                   	ret
+
+00802d01 <pipe>:
+{
+  802d01:	55                   	push   %ebp
+  802d02:	89 e5                	mov    %esp,%ebp
+  802d04:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  802d07:	6a 00                	push   $0x0
+  802d09:	ff 75 08             	push   0x8(%ebp)
+  802d0c:	e8 cc fd ff ff       	call   802add <pipe2>
+}
+  802d11:	c9                   	leave
+  802d12:	c3                   	ret
+
+00802d13 <pipeisclosed>:
+{
+  802d13:	55                   	push   %ebp
+  802d14:	89 e5                	mov    %esp,%ebp
+  802d16:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802d19:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802d1c:	50                   	push   %eax
+  802d1d:	ff 75 08             	push   0x8(%ebp)
+  802d20:	e8 b1 e9 ff ff       	call   8016d6 <fd_lookup>
+  802d25:	83 c4 10             	add    $0x10,%esp
+  802d28:	85 c0                	test   %eax,%eax
+  802d2a:	78 18                	js     802d44 <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  802d2c:	83 ec 0c             	sub    $0xc,%esp
+  802d2f:	ff 75 f4             	push   -0xc(%ebp)
+  802d32:	e8 35 e9 ff ff       	call   80166c <fd2data>
+  802d37:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  802d39:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802d3c:	e8 59 fa ff ff       	call   80279a <_pipeisclosed>
+  802d41:	83 c4 10             	add    $0x10,%esp
+}
+  802d44:	c9                   	leave
+  802d45:	c3                   	ret
+
+00802d46 <pipe_splice>:
+{
+  802d46:	55                   	push   %ebp
+  802d47:	89 e5                	mov    %esp,%ebp
+  802d49:	57                   	push   %edi
+  802d4a:	56                   	push   %esi
+  802d4b:	53                   	push   %ebx
+  802d4c:	83 ec 34             	sub    $0x34,%esp
+  802d4f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802d52:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802d55:	50                   	push   %eax
+  802d56:	ff 75 08             	push   0x8(%ebp)
+  802d59:	e8 78 e9 ff ff       	call   8016d6 <fd_lookup>
+  802d5e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802d61:	83 c4 10             	add    $0x10,%esp
+  802d64:	85 c0                	test   %eax,%eax
+  802d66:	0f 88 d7 00 00 00    	js     802e43 <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  802d6c:	83 ec 0c             	sub    $0xc,%esp
+  802d6f:	ff 75 e4             	push   -0x1c(%ebp)
+  802d72:	e8 f5 e8 ff ff       	call   80166c <fd2data>
+  802d77:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802d79:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802d7c:	83 c4 10             	add    $0x10,%esp
+  802d7f:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802d85:	39 10                	cmp    %edx,(%eax)
+  802d87:	0f 85 c1 00 00 00    	jne    802e4e <pipe_splice+0x108>
+  802d8d:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  802d91:	0f 84 c0 00 00 00    	je     802e57 <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  802d97:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802d9b:	0f 84 bf 00 00 00    	je     802e60 <pipe_splice+0x11a>
+  802da1:	89 f7                	mov    %esi,%edi
+  802da3:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  802da9:	0f 85 ba 00 00 00    	jne    802e69 <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802daf:	8d 43 04             	lea    0x4(%ebx),%eax
+  802db2:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802db5:	eb 38                	jmp    802def <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802db7:	83 ec 0c             	sub    $0xc,%esp
+  802dba:	68 00 10 00 00       	push   $0x1000
+  802dbf:	89 f1                	mov    %esi,%ecx
+  802dc1:	89 da                	mov    %ebx,%edx
+  802dc3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802dc6:	e8 34 fa ff ff       	call   8027ff <devpipe_write_bulk>
+  802dcb:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802dce:	83 c4 10             	add    $0x10,%esp
+  802dd1:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802dd6:	75 53                	jne    802e2b <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  802dd8:	83 ec 08             	sub    $0x8,%esp
+  802ddb:	56                   	push   %esi
+  802ddc:	6a 00                	push   $0x0
+  802dde:	e8 e2 e3 ff ff       	call   8011c5 <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  802de3:	83 c7 01             	add    $0x1,%edi
+  802de6:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802dec:	83 c4 10             	add    $0x10,%esp
+  802def:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802df2:	74 3a                	je     802e2e <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  802df4:	8b 03                	mov    (%ebx),%eax
+  802df6:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802df9:	75 bc                	jne    802db7 <pipe_splice+0x71>
+  802dfb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e00:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  802e04:	85 c0                	test   %eax,%eax
+  802e06:	74 af                	je     802db7 <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802e08:	83 ec 04             	sub    $0x4,%esp
+  802e0b:	6a 07                	push   $0x7
+  802e0d:	56                   	push   %esi
+  802e0e:	ff 75 d0             	push   -0x30(%ebp)
+  802e11:	e8 86 e6 ff ff       	call   80149c <sys_chan_wakeup>
+  802e16:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802e19:	83 c4 10             	add    $0x10,%esp
+  802e1c:	85 c0                	test   %eax,%eax
+  802e1e:	79 b8                	jns    802dd8 <pipe_splice+0x92>
+  802e20:	b8 01 00 00 00       	mov    $0x1,%eax
+  802e25:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802e29:	eb 8c                	jmp    802db7 <pipe_splice+0x71>
+  802e2b:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  802e2e:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802e32:	75 06                	jne    802e3a <pipe_splice+0xf4>
+  802e34:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802e38:	78 09                	js     802e43 <pipe_splice+0xfd>
+  return i * PGSIZE;
+  802e3a:	8b 45 10             	mov    0x10(%ebp),%eax
+  802e3d:	c1 e0 0c             	shl    $0xc,%eax
+  802e40:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  802e43:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802e46:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e49:	5b                   	pop    %ebx
+  802e4a:	5e                   	pop    %esi
+  802e4b:	5f                   	pop    %edi
+  802e4c:	5d                   	pop    %ebp
+  802e4d:	c3                   	ret
+    return -E_INVAL;
+  802e4e:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802e55:	eb ec                	jmp    802e43 <pipe_splice+0xfd>
+  802e57:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802e5e:	eb e3                	jmp    802e43 <pipe_splice+0xfd>
+  802e60:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802e67:	eb da                	jmp    802e43 <pipe_splice+0xfd>
+  802e69:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802e70:	eb d1                	jmp    802e43 <pipe_splice+0xfd>
+
+00802e72 <pipe_splice_read>:
+{
+  802e72:	55                   	push   %ebp
+  802e73:	89 e5                	mov    %esp,%ebp
+  802e75:	53                   	push   %ebx
+  802e76:	83 ec 1c             	sub    $0x1c,%esp
+  802e79:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802e7c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802e7f:	50                   	push   %eax
+  802e80:	ff 75 08             	push   0x8(%ebp)
+  802e83:	e8 4e e8 ff ff       	call   8016d6 <fd_lookup>
+  802e88:	83 c4 10             	add    $0x10,%esp
+  802e8b:	85 c0                	test   %eax,%eax
+  802e8d:	78 49                	js     802ed8 <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  802e8f:	83 ec 0c             	sub    $0xc,%esp
+  802e92:	ff 75 f4             	push   -0xc(%ebp)
+  802e95:	e8 d2 e7 ff ff       	call   80166c <fd2data>
+  802e9a:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802e9c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802e9f:	83 c4 10             	add    $0x10,%esp
+  802ea2:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  802ea8:	39 08                	cmp    %ecx,(%eax)
+  802eaa:	75 31                	jne    802edd <pipe_splice_read+0x6b>
+  802eac:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  802eb0:	74 32                	je     802ee4 <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  802eb2:	8b 48 08             	mov    0x8(%eax),%ecx
+  802eb5:	83 e1 03             	and    $0x3,%ecx
+  802eb8:	83 f9 01             	cmp    $0x1,%ecx
+  802ebb:	74 2e                	je     802eeb <pipe_splice_read+0x79>
+  802ebd:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  802ec3:	75 2d                	jne    802ef2 <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  802ec5:	83 ec 08             	sub    $0x8,%esp
+  802ec8:	53                   	push   %ebx
+  802ec9:	68 00 10 00 00       	push   $0x1000
+  802ece:	89 d9                	mov    %ebx,%ecx
+  802ed0:	e8 93 fa ff ff       	call   802968 <devpipe_read_bulk>
+  802ed5:	83 c4 10             	add    $0x10,%esp
+}
+  802ed8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802edb:	c9                   	leave
+  802edc:	c3                   	ret
+    return -E_INVAL;
+  802edd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ee2:	eb f4                	jmp    802ed8 <pipe_splice_read+0x66>
+  802ee4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ee9:	eb ed                	jmp    802ed8 <pipe_splice_read+0x66>
+  802eeb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ef0:	eb e6                	jmp    802ed8 <pipe_splice_read+0x66>
+  802ef2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ef7:	eb df                	jmp    802ed8 <pipe_splice_read+0x66>
+
+00802ef9 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  802ef9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802efe:	c3                   	ret
+
+00802eff <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802eff:	55                   	push   %ebp
+  802f00:	89 e5                	mov    %esp,%ebp
+  802f02:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  802f05:	68 e7 39 80 00       	push   $0x8039e7
+  802f0a:	ff 75 0c             	push   0xc(%ebp)
+  802f0d:	e8 ff dd ff ff       	call   800d11 <strcpy>
+  return 0;
+}
+  802f12:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f17:	c9                   	leave
+  802f18:	c3                   	ret
+
+00802f19 <devcons_write>:
+{
+  802f19:	55                   	push   %ebp
+  802f1a:	89 e5                	mov    %esp,%ebp
+  802f1c:	57                   	push   %edi
+  802f1d:	56                   	push   %esi
+  802f1e:	53                   	push   %ebx
+  802f1f:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  802f25:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  802f2a:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  802f30:	eb 2e                	jmp    802f60 <devcons_write+0x47>
+    m = n - tot;
+  802f32:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802f35:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  802f37:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802f3c:	39 c3                	cmp    %eax,%ebx
+  802f3e:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  802f41:	83 ec 04             	sub    $0x4,%esp
+  802f44:	53                   	push   %ebx
+  802f45:	89 f0                	mov    %esi,%eax
+  802f47:	03 45 0c             	add    0xc(%ebp),%eax
+  802f4a:	50                   	push   %eax
+  802f4b:	57                   	push   %edi
+  802f4c:	e8 46 df ff ff       	call   800e97 <memmove>
+    sys_cputs(buf, m);
+  802f51:	83 c4 08             	add    $0x8,%esp
+  802f54:	53                   	push   %ebx
+  802f55:	57                   	push   %edi
+  802f56:	e8 e6 e0 ff ff       	call   801041 <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  802f5b:	01 de                	add    %ebx,%esi
+  802f5d:	83 c4 10             	add    $0x10,%esp
+  802f60:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802f63:	72 cd                	jb     802f32 <devcons_write+0x19>
+}
+  802f65:	89 f0                	mov    %esi,%eax
+  802f67:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f6a:	5b                   	pop    %ebx
+  802f6b:	5e                   	pop    %esi
+  802f6c:	5f                   	pop    %edi
+  802f6d:	5d                   	pop    %ebp
+  802f6e:	c3                   	ret
+
+00802f6f <devcons_read>:
+{
+  802f6f:	55                   	push   %ebp
+  802f70:	89 e5                	mov    %esp,%ebp
+  802f72:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  802f75:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f7a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802f7e:	75 07                	jne    802f87 <devcons_read+0x18>
+  802f80:	eb 1f                	jmp    802fa1 <devcons_read+0x32>
+    sys_yield();
+  802f82:	e8 57 e1 ff ff       	call   8010de <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  802f87:	e8 d3 e0 ff ff       	call   80105f <sys_cgetc>
+  802f8c:	85 c0                	test   %eax,%eax
+  802f8e:	74 f2                	je     802f82 <devcons_read+0x13>
+  if (c < 0)
+  802f90:	78 0f                	js     802fa1 <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  802f92:	83 f8 04             	cmp    $0x4,%eax
+  802f95:	74 0c                	je     802fa3 <devcons_read+0x34>
+  *(char*)vbuf = c;
+  802f97:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802f9a:	88 02                	mov    %al,(%edx)
+  return 1;
+  802f9c:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802fa1:	c9                   	leave
+  802fa2:	c3                   	ret
+    return 0;
+  802fa3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fa8:	eb f7                	jmp    802fa1 <devcons_read+0x32>
+
+00802faa <cputchar>:
+{
+  802faa:	55                   	push   %ebp
+  802fab:	89 e5                	mov    %esp,%ebp
+  802fad:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  802fb0:	8b 45 08             	mov    0x8(%ebp),%eax
+  802fb3:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  802fb6:	6a 01                	push   $0x1
+  802fb8:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802fbb:	50                   	push   %eax
+  802fbc:	e8 80 e0 ff ff       	call   801041 <sys_cputs>
+}
+  802fc1:	83 c4 10             	add    $0x10,%esp
+  802fc4:	c9                   	leave
+  802fc5:	c3                   	ret
+
+00802fc6 <getchar>:
+{
+  802fc6:	55                   	push   %ebp
+  802fc7:	89 e5                	mov    %esp,%ebp
+  802fc9:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  802fcc:	6a 01                	push   $0x1
+  802fce:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802fd1:	50                   	push   %eax
+  802fd2:	6a 00                	push   $0x0
+  802fd4:	e8 a8 e9 ff ff       	call   801981 <read>
+  if (r < 0)
+  802fd9:	83 c4 10             	add    $0x10,%esp
+  802fdc:	85 c0                	test   %eax,%eax
+  802fde:	78 06                	js     802fe6 <getchar+0x20>
+  if (r < 1)
+  802fe0:	74 06                	je     802fe8 <getchar+0x22>
+  return c;
+  802fe2:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802fe6:	c9                   	leave
+  802fe7:	c3                   	ret
+    return -E_EOF;
+  802fe8:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802fed:	eb f7                	jmp    802fe6 <getchar+0x20>
+
+00802fef <iscons>:
+{
+  802fef:	55                   	push   %ebp
+  802ff0:	89 e5                	mov    %esp,%ebp
+  802ff2:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802ff5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802ff8:	50                   	push   %eax
+  802ff9:	ff 75 08             	push   0x8(%ebp)
+  802ffc:	e8 d5 e6 ff ff       	call   8016d6 <fd_lookup>
+  803001:	83 c4 10             	add    $0x10,%esp
+  803004:	85 c0                	test   %eax,%eax
+  803006:	78 11                	js     803019 <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  803008:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80300b:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  803011:	39 10                	cmp    %edx,(%eax)
+  803013:	0f 94 c0             	sete   %al
+  803016:	0f b6 c0             	movzbl %al,%eax
+}
+  803019:	c9                   	leave
+  80301a:	c3                   	ret
+
+0080301b <opencons>:
+{
+  80301b:	55                   	push   %ebp
+  80301c:	89 e5                	mov    %esp,%ebp
+  80301e:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  803021:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803024:	50                   	push   %eax
+  803025:	e8 56 e6 ff ff       	call   801680 <fd_alloc>
+  80302a:	83 c4 10             	add    $0x10,%esp
+  80302d:	85 c0                	test   %eax,%eax
+  80302f:	78 3a                	js     80306b <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803031:	83 ec 04             	sub    $0x4,%esp
+  803034:	68 07 04 00 00       	push   $0x407
+  803039:	ff 75 f4             	push   -0xc(%ebp)
+  80303c:	6a 00                	push   $0x0
+  80303e:	e8 fd e0 ff ff       	call   801140 <sys_page_alloc>
+  803043:	83 c4 10             	add    $0x10,%esp
+  803046:	85 c0                	test   %eax,%eax
+  803048:	78 21                	js     80306b <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  80304a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80304d:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  803053:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  803055:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803058:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  80305f:	83 ec 0c             	sub    $0xc,%esp
+  803062:	50                   	push   %eax
+  803063:	e8 f4 e5 ff ff       	call   80165c <fd2num>
+  803068:	83 c4 10             	add    $0x10,%esp
+}
+  80306b:	c9                   	leave
+  80306c:	c3                   	ret
+
+0080306d <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  80306d:	55                   	push   %ebp
+  80306e:	89 e5                	mov    %esp,%ebp
+  803070:	57                   	push   %edi
+  803071:	56                   	push   %esi
+  803072:	53                   	push   %ebx
+  803073:	83 ec 14             	sub    $0x14,%esp
+  803076:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803079:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80307c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80307f:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  803082:	85 c0                	test   %eax,%eax
+  803084:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803089:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  80308c:	ff 33                	push   (%ebx)
+  80308e:	50                   	push   %eax
+  80308f:	e8 84 e3 ff ff       	call   801418 <sys_ipc_recv>
+  803094:	83 c4 10             	add    $0x10,%esp
+  803097:	85 c0                	test   %eax,%eax
+  803099:	78 39                	js     8030d4 <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  80309b:	85 ff                	test   %edi,%edi
+  80309d:	74 0a                	je     8030a9 <ipc_recv_pages+0x3c>
+  80309f:	a1 04 58 80 00       	mov    0x805804,%eax
+  8030a4:	8b 40 7c             	mov    0x7c(%eax),%eax
+  8030a7:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  8030a9:	85 f6                	test   %esi,%esi
+  8030ab:	74 0d                	je     8030ba <ipc_recv_pages+0x4d>
+  8030ad:	a1 04 58 80 00       	mov    0x805804,%eax
+  8030b2:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  8030b8:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  8030ba:	a1 04 58 80 00       	mov    0x805804,%eax
+  8030bf:	8b 40 74             	mov    0x74(%eax),%eax
+  8030c2:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  8030c4:	a1 04 58 80 00       	mov    0x805804,%eax
+  8030c9:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  8030cc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030cf:	5b                   	pop    %ebx
+  8030d0:	5e                   	pop    %esi
+  8030d1:	5f                   	pop    %edi
+  8030d2:	5d                   	pop    %ebp
+  8030d3:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  8030d4:	85 ff                	test   %edi,%edi
+  8030d6:	74 06                	je     8030de <ipc_recv_pages+0x71>
+  8030d8:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  8030de:	85 f6                	test   %esi,%esi
+  8030e0:	74 06                	je     8030e8 <ipc_recv_pages+0x7b>
+  8030e2:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  8030e8:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  8030ee:	eb dc                	jmp    8030cc <ipc_recv_pages+0x5f>
+
+008030f0 <ipc_recv>:
+{
+  8030f0:	55                   	push   %ebp
+  8030f1:	89 e5                	mov    %esp,%ebp
+  8030f3:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  8030f6:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  8030fd:	ff 75 10             	push   0x10(%ebp)
+  803100:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803103:	50                   	push   %eax
+  803104:	ff 75 0c             	push   0xc(%ebp)
+  803107:	ff 75 08             	push   0x8(%ebp)
+  80310a:	e8 5e ff ff ff       	call   80306d <ipc_recv_pages>
+}
+  80310f:	c9                   	leave
+  803110:	c3                   	ret
+
+00803111 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  803111:	55                   	push   %ebp
+  803112:	89 e5                	mov    %esp,%ebp
+  803114:	57                   	push   %edi
+  803115:	56                   	push   %esi
+  803116:	53                   	push   %ebx
+  803117:	83 ec 0c             	sub    $0xc,%esp
+  80311a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80311d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803120:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  803123:	89 c3                	mov    %eax,%ebx
+  803125:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  80312b:	85 c0                	test   %eax,%eax
+  80312d:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  803132:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  803135:	83 ec 0c             	sub    $0xc,%esp
+  803138:	ff 75 14             	push   0x14(%ebp)
+  80313b:	ff 75 18             	push   0x18(%ebp)
+  80313e:	53                   	push   %ebx
+  80313f:	56                   	push   %esi
+  803140:	57                   	push   %edi
+  803141:	e8 b1 e2 ff ff       	call   8013f7 <sys_ipc_try_send>
+  803146:	83 c4 20             	add    $0x20,%esp
+  803149:	85 c0                	test   %eax,%eax
+  80314b:	79 1e                	jns    80316b <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  80314d:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803150:	75 07                	jne    803159 <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  803152:	e8 87 df ff ff       	call   8010de <sys_yield>
+  803157:	eb dc                	jmp    803135 <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  803159:	50                   	push   %eax
+  80315a:	68 f3 39 80 00       	push   $0x8039f3
+  80315f:	6a 5c                	push   $0x5c
+  803161:	68 00 3a 80 00       	push   $0x803a00
+  803166:	e8 dd d4 ff ff       	call   800648 <_panic>
+  }
+}
+  80316b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80316e:	5b                   	pop    %ebx
+  80316f:	5e                   	pop    %esi
+  803170:	5f                   	pop    %edi
+  803171:	5d                   	pop    %ebp
+  803172:	c3                   	ret
+
+00803173 <ipc_send>:
+{
+  803173:	55                   	push   %ebp
+  803174:	89 e5                	mov    %esp,%ebp
+  803176:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  803179:	ff 75 14             	push   0x14(%ebp)
+  80317c:	6a 01                	push   $0x1
+  80317e:	ff 75 10             	push   0x10(%ebp)
+  803181:	ff 75 0c             	push   0xc(%ebp)
+  803184:	ff 75 08             	push   0x8(%ebp)
+  803187:	e8 85 ff ff ff       	call   803111 <ipc_send_pages>
+}
+  80318c:	83 c4 20             	add    $0x20,%esp
+  80318f:	c9                   	leave
+  803190:	c3                   	ret
+
+00803191 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803191:	55                   	push   %ebp
+  803192:	89 e5                	mov    %esp,%ebp
+  803194:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  803197:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  80319c:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80319f:	c1 e0 04             	shl    $0x4,%eax
+  8031a2:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8031a7:	8b 40 50             	mov    0x50(%eax),%eax
+  8031aa:	39 c8                	cmp    %ecx,%eax
+  8031ac:	74 12                	je     8031c0 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  8031ae:	83 c2 01             	add    $0x1,%edx
+  8031b1:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  8031b7:	75 e3                	jne    80319c <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  8031b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031be:	eb 0e                	jmp    8031ce <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  8031c0:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8031c3:	c1 e0 04             	shl    $0x4,%eax
+  8031c6:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8031cb:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8031ce:	5d                   	pop    %ebp
+  8031cf:	c3                   	ret
+
+008031d0 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8031d0:	55                   	push   %ebp
+  8031d1:	89 e5                	mov    %esp,%ebp
+  8031d3:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  8031d6:	89 c2                	mov    %eax,%edx
+  8031d8:	c1 ea 16             	shr    $0x16,%edx
+  8031db:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  8031e2:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  8031e7:	f6 c1 01             	test   $0x1,%cl
+  8031ea:	74 1c                	je     803208 <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  8031ec:	c1 e8 0c             	shr    $0xc,%eax
+  8031ef:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  8031f6:	a8 01                	test   $0x1,%al
+  8031f8:	74 0e                	je     803208 <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  8031fa:	c1 e8 0c             	shr    $0xc,%eax
+  8031fd:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  803204:	ef 
+  803205:	0f b7 d2             	movzwl %dx,%edx
+}
+  803208:	89 d0                	mov    %edx,%eax
+  80320a:	5d                   	pop    %ebp
+  80320b:	c3                   	ret
+
+0080320c <udivmod>:
+  80320c:	55                   	push   %ebp
+  80320d:	57                   	push   %edi
+  80320e:	56                   	push   %esi
+  80320f:	53                   	push   %ebx
+  803210:	83 ec 14             	sub    $0x14,%esp
+  803213:	8b 74 24 28          	mov    0x28(%esp),%esi
+  803217:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  80321b:	89 fb                	mov    %edi,%ebx
+  80321d:	09 f3                	or     %esi,%ebx
+  80321f:	0f 84 88 00 00 00    	je     8032ad <udivmod+0xa1>
+  803225:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80322a:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  803231:	00 
+  803232:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  803239:	00 
+  80323a:	89 cd                	mov    %ecx,%ebp
+  80323c:	89 34 24             	mov    %esi,(%esp)
+  80323f:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  803243:	eb 08                	jmp    80324d <udivmod+0x41>
+  803245:	83 ed 01             	sub    $0x1,%ebp
+  803248:	83 fd ff             	cmp    $0xffffffff,%ebp
+  80324b:	74 6c                	je     8032b9 <udivmod+0xad>
+  80324d:	89 c3                	mov    %eax,%ebx
+  80324f:	89 d6                	mov    %edx,%esi
+  803251:	89 e9                	mov    %ebp,%ecx
+  803253:	0f ad f3             	shrd   %cl,%esi,%ebx
+  803256:	d3 ee                	shr    %cl,%esi
+  803258:	f6 c1 20             	test   $0x20,%cl
+  80325b:	74 04                	je     803261 <udivmod+0x55>
+  80325d:	89 f3                	mov    %esi,%ebx
+  80325f:	31 f6                	xor    %esi,%esi
+  803261:	8b 3c 24             	mov    (%esp),%edi
+  803264:	39 fb                	cmp    %edi,%ebx
+  803266:	89 f7                	mov    %esi,%edi
+  803268:	8b 1c 24             	mov    (%esp),%ebx
+  80326b:	8b 74 24 04          	mov    0x4(%esp),%esi
+  80326f:	19 f7                	sbb    %esi,%edi
+  803271:	72 d2                	jb     803245 <udivmod+0x39>
+  803273:	89 f7                	mov    %esi,%edi
+  803275:	89 de                	mov    %ebx,%esi
+  803277:	89 e9                	mov    %ebp,%ecx
+  803279:	0f a5 f7             	shld   %cl,%esi,%edi
+  80327c:	d3 e6                	shl    %cl,%esi
+  80327e:	f6 c1 20             	test   $0x20,%cl
+  803281:	74 04                	je     803287 <udivmod+0x7b>
+  803283:	89 f7                	mov    %esi,%edi
+  803285:	31 f6                	xor    %esi,%esi
+  803287:	29 f0                	sub    %esi,%eax
+  803289:	19 fa                	sbb    %edi,%edx
+  80328b:	be 01 00 00 00       	mov    $0x1,%esi
+  803290:	bf 00 00 00 00       	mov    $0x0,%edi
+  803295:	0f a5 f7             	shld   %cl,%esi,%edi
+  803298:	d3 e6                	shl    %cl,%esi
+  80329a:	f6 c1 20             	test   $0x20,%cl
+  80329d:	74 04                	je     8032a3 <udivmod+0x97>
+  80329f:	89 f7                	mov    %esi,%edi
+  8032a1:	31 f6                	xor    %esi,%esi
+  8032a3:	09 74 24 08          	or     %esi,0x8(%esp)
+  8032a7:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8032ab:	eb 98                	jmp    803245 <udivmod+0x39>
+  8032ad:	89 f0                	mov    %esi,%eax
+  8032af:	89 fa                	mov    %edi,%edx
+  8032b1:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8032b5:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  8032b9:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  8032bd:	89 01                	mov    %eax,(%ecx)
+  8032bf:	89 51 04             	mov    %edx,0x4(%ecx)
+  8032c2:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8032c6:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8032ca:	83 c4 14             	add    $0x14,%esp
+  8032cd:	5b                   	pop    %ebx
+  8032ce:	5e                   	pop    %esi
+  8032cf:	5f                   	pop    %edi
+  8032d0:	5d                   	pop    %ebp
+  8032d1:	c3                   	ret
+
+008032d2 <__udivdi3>:
+  8032d2:	83 ec 18             	sub    $0x18,%esp
+  8032d5:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8032d9:	50                   	push   %eax
+  8032da:	ff 74 24 2c          	push   0x2c(%esp)
+  8032de:	ff 74 24 2c          	push   0x2c(%esp)
+  8032e2:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8032e6:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8032ea:	e8 1d ff ff ff       	call   80320c <udivmod>
+  8032ef:	83 c4 24             	add    $0x24,%esp
+  8032f2:	c3                   	ret
+
+008032f3 <__umoddi3>:
+  8032f3:	83 ec 18             	sub    $0x18,%esp
+  8032f6:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8032fa:	50                   	push   %eax
+  8032fb:	ff 74 24 2c          	push   0x2c(%esp)
+  8032ff:	ff 74 24 2c          	push   0x2c(%esp)
+  803303:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803307:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80330b:	e8 fc fe ff ff       	call   80320c <udivmod>
+  803310:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803314:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803318:	83 c4 24             	add    $0x24,%esp
+  80331b:	c3                   	ret
+
+0080331c <__divdi3>:
+  80331c:	56                   	push   %esi
+  80331d:	53                   	push   %ebx
+  80331e:	83 ec 14             	sub    $0x14,%esp
+  803321:	8b 44 24 20          	mov    0x20(%esp),%eax
+  803325:	8b 54 24 24          	mov    0x24(%esp),%edx
+  803329:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  80332d:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  803331:	85 d2                	test   %edx,%edx
+  803333:	78 18                	js     80334d <__divdi3+0x31>
+  803335:	85 db                	test   %ebx,%ebx
+  803337:	78 3e                	js     803377 <__divdi3+0x5b>
+  803339:	83 ec 04             	sub    $0x4,%esp
+  80333c:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803340:	56                   	push   %esi
+  803341:	53                   	push   %ebx
+  803342:	51                   	push   %ecx
+  803343:	e8 c4 fe ff ff       	call   80320c <udivmod>
+  803348:	83 c4 10             	add    $0x10,%esp
+  80334b:	eb 24                	jmp    803371 <__divdi3+0x55>
+  80334d:	f7 d8                	neg    %eax
+  80334f:	83 d2 00             	adc    $0x0,%edx
+  803352:	f7 da                	neg    %edx
+  803354:	85 db                	test   %ebx,%ebx
+  803356:	78 3a                	js     803392 <__divdi3+0x76>
+  803358:	83 ec 04             	sub    $0x4,%esp
+  80335b:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80335f:	56                   	push   %esi
+  803360:	53                   	push   %ebx
+  803361:	51                   	push   %ecx
+  803362:	e8 a5 fe ff ff       	call   80320c <udivmod>
+  803367:	83 c4 10             	add    $0x10,%esp
+  80336a:	f7 d8                	neg    %eax
+  80336c:	83 d2 00             	adc    $0x0,%edx
+  80336f:	f7 da                	neg    %edx
+  803371:	83 c4 14             	add    $0x14,%esp
+  803374:	5b                   	pop    %ebx
+  803375:	5e                   	pop    %esi
+  803376:	c3                   	ret
+  803377:	83 ec 04             	sub    $0x4,%esp
+  80337a:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80337e:	56                   	push   %esi
+  80337f:	f7 d9                	neg    %ecx
+  803381:	83 d3 00             	adc    $0x0,%ebx
+  803384:	f7 db                	neg    %ebx
+  803386:	53                   	push   %ebx
+  803387:	51                   	push   %ecx
+  803388:	e8 7f fe ff ff       	call   80320c <udivmod>
+  80338d:	83 c4 10             	add    $0x10,%esp
+  803390:	eb d8                	jmp    80336a <__divdi3+0x4e>
+  803392:	83 ec 04             	sub    $0x4,%esp
+  803395:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803399:	56                   	push   %esi
+  80339a:	f7 d9                	neg    %ecx
+  80339c:	83 d3 00             	adc    $0x0,%ebx
+  80339f:	f7 db                	neg    %ebx
+  8033a1:	53                   	push   %ebx
+  8033a2:	51                   	push   %ecx
+  8033a3:	e8 64 fe ff ff       	call   80320c <udivmod>
+  8033a8:	83 c4 10             	add    $0x10,%esp
+  8033ab:	eb c4                	jmp    803371 <__divdi3+0x55>
+
+008033ad <__moddi3>:
+  8033ad:	55                   	push   %ebp
+  8033ae:	57                   	push   %edi
+  8033af:	56                   	push   %esi
+  8033b0:	53                   	push   %ebx
+  8033b1:	83 ec 24             	sub    $0x24,%esp
+  8033b4:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8033b8:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8033bc:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  8033c0:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  8033c4:	85 d2                	test   %edx,%edx
+  8033c6:	78 3b                	js     803403 <__moddi3+0x56>
+  8033c8:	83 ec 04             	sub    $0x4,%esp
+  8033cb:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8033cf:	56                   	push   %esi
+  8033d0:	89 ce                	mov    %ecx,%esi
+  8033d2:	f7 de                	neg    %esi
+  8033d4:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8033d8:	89 de                	mov    %ebx,%esi
+  8033da:	83 d6 00             	adc    $0x0,%esi
+  8033dd:	f7 de                	neg    %esi
+  8033df:	89 74 24 14          	mov    %esi,0x14(%esp)
+  8033e3:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8033e7:	0f 48 f1             	cmovs  %ecx,%esi
+  8033ea:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  8033ef:	53                   	push   %ebx
+  8033f0:	56                   	push   %esi
+  8033f1:	e8 16 fe ff ff       	call   80320c <udivmod>
+  8033f6:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8033fa:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8033fe:	83 c4 10             	add    $0x10,%esp
+  803401:	eb 47                	jmp    80344a <__moddi3+0x9d>
+  803403:	f7 d8                	neg    %eax
+  803405:	83 d2 00             	adc    $0x0,%edx
+  803408:	f7 da                	neg    %edx
+  80340a:	83 ec 04             	sub    $0x4,%esp
+  80340d:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803411:	56                   	push   %esi
+  803412:	89 cf                	mov    %ecx,%edi
+  803414:	f7 df                	neg    %edi
+  803416:	89 de                	mov    %ebx,%esi
+  803418:	83 d6 00             	adc    $0x0,%esi
+  80341b:	f7 de                	neg    %esi
+  80341d:	0f 49 cf             	cmovns %edi,%ecx
+  803420:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  803424:	0f 49 de             	cmovns %esi,%ebx
+  803427:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  80342b:	ff 74 24 0c          	push   0xc(%esp)
+  80342f:	ff 74 24 0c          	push   0xc(%esp)
+  803433:	e8 d4 fd ff ff       	call   80320c <udivmod>
+  803438:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80343c:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803440:	f7 d8                	neg    %eax
+  803442:	83 d2 00             	adc    $0x0,%edx
+  803445:	f7 da                	neg    %edx
+  803447:	83 c4 10             	add    $0x10,%esp
+  80344a:	83 c4 24             	add    $0x24,%esp
+  80344d:	5b                   	pop    %ebx
+  80344e:	5e                   	pop    %esi
+  80344f:	5f                   	pop    %edi
+  803450:	5d                   	pop    %ebp
+  803451:	c3                   	ret
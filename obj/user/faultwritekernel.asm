@@ -0,0 +1,6356 @@
+
+obj/user/faultwritekernel.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 0d 00 00 00       	call   80003e <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  *(unsigned*)0xf0100000 = 0;
+  800033:	c7 05 00 00 10 f0 00 	movl   $0x0,0xf0100000
+  80003a:	00 00 00 
+}
+  80003d:	c3                   	ret
+
+0080003e <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80003e:	55                   	push   %ebp
+  80003f:	89 e5                	mov    %esp,%ebp
+  800041:	56                   	push   %esi
+  800042:	53                   	push   %ebx
+  800043:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800046:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  800049:	c7 05 44 57 80 00 00 	movl   $0x0,0x805744
+  800050:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  800053:	e8 d1 00 00 00       	call   800129 <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  800058:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80005d:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800060:	c1 e0 04             	shl    $0x4,%eax
+  800063:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800068:	a3 44 57 80 00       	mov    %eax,0x805744
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  80006d:	85 db                	test   %ebx,%ebx
+  80006f:	7e 07                	jle    800078 <libmain+0x3a>
+    binaryname = argv[0];
+  800071:	8b 06                	mov    (%esi),%eax
+  800073:	a3 00 40 80 00       	mov    %eax,0x804000
+
+  // call user main routine
+  umain(argc, argv);
+  800078:	83 ec 08             	sub    $0x8,%esp
+  80007b:	56                   	push   %esi
+  80007c:	53                   	push   %ebx
+  80007d:	e8 b1 ff ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  800082:	e8 0a 00 00 00       	call   800091 <exit>
+}
+  800087:	83 c4 10             	add    $0x10,%esp
+  80008a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80008d:	5b                   	pop    %ebx
+  80008e:	5e                   	pop    %esi
+  80008f:	5d                   	pop    %ebp
+  800090:	c3                   	ret
+
+00800091 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800091:	55                   	push   %ebp
+  800092:	89 e5                	mov    %esp,%ebp
+  800094:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  800097:	e8 87 07 00 00       	call   800823 <close_all>
+  sys_env_destroy(0);
+  80009c:	83 ec 0c             	sub    $0xc,%esp
+  80009f:	6a 00                	push   $0x0
+  8000a1:	e8 42 00 00 00       	call   8000e8 <sys_env_destroy>
+}
+  8000a6:	83 c4 10             	add    $0x10,%esp
+  8000a9:	c9                   	leave
+  8000aa:	c3                   	ret
+
+008000ab <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8000ab:	55                   	push   %ebp
+  8000ac:	89 e5                	mov    %esp,%ebp
+  8000ae:	57                   	push   %edi
+  8000af:	56                   	push   %esi
+  8000b0:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8000b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000b6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000b9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000bc:	89 c3                	mov    %eax,%ebx
+  8000be:	89 c7                	mov    %eax,%edi
+  8000c0:	89 c6                	mov    %eax,%esi
+  8000c2:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  8000c4:	5b                   	pop    %ebx
+  8000c5:	5e                   	pop    %esi
+  8000c6:	5f                   	pop    %edi
+  8000c7:	5d                   	pop    %ebp
+  8000c8:	c3                   	ret
+
+008000c9 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  8000c9:	55                   	push   %ebp
+  8000ca:	89 e5                	mov    %esp,%ebp
+  8000cc:	57                   	push   %edi
+  8000cd:	56                   	push   %esi
+  8000ce:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8000cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000d4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000d9:	89 d1                	mov    %edx,%ecx
+  8000db:	89 d3                	mov    %edx,%ebx
+  8000dd:	89 d7                	mov    %edx,%edi
+  8000df:	89 d6                	mov    %edx,%esi
+  8000e1:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  8000e3:	5b                   	pop    %ebx
+  8000e4:	5e                   	pop    %esi
+  8000e5:	5f                   	pop    %edi
+  8000e6:	5d                   	pop    %ebp
+  8000e7:	c3                   	ret
+
+008000e8 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8000e8:	55                   	push   %ebp
+  8000e9:	89 e5                	mov    %esp,%ebp
+  8000eb:	57                   	push   %edi
+  8000ec:	56                   	push   %esi
+  8000ed:	53                   	push   %ebx
+  8000ee:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8000f1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000f9:	b8 03 00 00 00       	mov    $0x3,%eax
+  8000fe:	89 cb                	mov    %ecx,%ebx
+  800100:	89 cf                	mov    %ecx,%edi
+  800102:	89 ce                	mov    %ecx,%esi
+  800104:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800106:	85 c0                	test   %eax,%eax
+  800108:	7f 08                	jg     800112 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  80010a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80010d:	5b                   	pop    %ebx
+  80010e:	5e                   	pop    %esi
+  80010f:	5f                   	pop    %edi
+  800110:	5d                   	pop    %ebp
+  800111:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800112:	83 ec 0c             	sub    $0xc,%esp
+  800115:	50                   	push   %eax
+  800116:	6a 03                	push   $0x3
+  800118:	68 6a 2e 80 00       	push   $0x802e6a
+  80011d:	6a 23                	push   $0x23
+  80011f:	68 87 2e 80 00       	push   $0x802e87
+  800124:	e8 41 1f 00 00       	call   80206a <_panic>
+
+00800129 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800129:	55                   	push   %ebp
+  80012a:	89 e5                	mov    %esp,%ebp
+  80012c:	57                   	push   %edi
+  80012d:	56                   	push   %esi
+  80012e:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80012f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800134:	b8 02 00 00 00       	mov    $0x2,%eax
+  800139:	89 d1                	mov    %edx,%ecx
+  80013b:	89 d3                	mov    %edx,%ebx
+  80013d:	89 d7                	mov    %edx,%edi
+  80013f:	89 d6                	mov    %edx,%esi
+  800141:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800143:	5b                   	pop    %ebx
+  800144:	5e                   	pop    %esi
+  800145:	5f                   	pop    %edi
+  800146:	5d                   	pop    %ebp
+  800147:	c3                   	ret
+
+00800148 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800148:	55                   	push   %ebp
+  800149:	89 e5                	mov    %esp,%ebp
+  80014b:	57                   	push   %edi
+  80014c:	56                   	push   %esi
+  80014d:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80014e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800153:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800158:	89 d1                	mov    %edx,%ecx
+  80015a:	89 d3                	mov    %edx,%ebx
+  80015c:	89 d7                	mov    %edx,%edi
+  80015e:	89 d6                	mov    %edx,%esi
+  800160:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800162:	5b                   	pop    %ebx
+  800163:	5e                   	pop    %esi
+  800164:	5f                   	pop    %edi
+  800165:	5d                   	pop    %ebp
+  800166:	c3                   	ret
+
+00800167 <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  800167:	55                   	push   %ebp
+  800168:	89 e5                	mov    %esp,%ebp
+  80016a:	57                   	push   %edi
+  80016b:	56                   	push   %esi
+  80016c:	53                   	push   %ebx
+  80016d:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  800170:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  800174:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800179:	8b 55 08             	mov    0x8(%ebp),%edx
+  80017c:	b8 14 00 00 00       	mov    $0x14,%eax
+  800181:	89 df                	mov    %ebx,%edi
+  800183:	89 de                	mov    %ebx,%esi
+  800185:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800187:	85 c0                	test   %eax,%eax
+  800189:	7f 08                	jg     800193 <sys_env_set_cow+0x2c>
+}
+  80018b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80018e:	5b                   	pop    %ebx
+  80018f:	5e                   	pop    %esi
+  800190:	5f                   	pop    %edi
+  800191:	5d                   	pop    %ebp
+  800192:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800193:	83 ec 0c             	sub    $0xc,%esp
+  800196:	50                   	push   %eax
+  800197:	6a 14                	push   $0x14
+  800199:	68 6a 2e 80 00       	push   $0x802e6a
+  80019e:	6a 23                	push   $0x23
+  8001a0:	68 87 2e 80 00       	push   $0x802e87
+  8001a5:	e8 c0 1e 00 00       	call   80206a <_panic>
+
+008001aa <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8001aa:	55                   	push   %ebp
+  8001ab:	89 e5                	mov    %esp,%ebp
+  8001ad:	57                   	push   %edi
+  8001ae:	56                   	push   %esi
+  8001af:	53                   	push   %ebx
+  8001b0:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8001b3:	be 00 00 00 00       	mov    $0x0,%esi
+  8001b8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001bb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001be:	b8 04 00 00 00       	mov    $0x4,%eax
+  8001c3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001c6:	89 f7                	mov    %esi,%edi
+  8001c8:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8001ca:	85 c0                	test   %eax,%eax
+  8001cc:	7f 08                	jg     8001d6 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  8001ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001d1:	5b                   	pop    %ebx
+  8001d2:	5e                   	pop    %esi
+  8001d3:	5f                   	pop    %edi
+  8001d4:	5d                   	pop    %ebp
+  8001d5:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8001d6:	83 ec 0c             	sub    $0xc,%esp
+  8001d9:	50                   	push   %eax
+  8001da:	6a 04                	push   $0x4
+  8001dc:	68 6a 2e 80 00       	push   $0x802e6a
+  8001e1:	6a 23                	push   $0x23
+  8001e3:	68 87 2e 80 00       	push   $0x802e87
+  8001e8:	e8 7d 1e 00 00       	call   80206a <_panic>
+
+008001ed <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8001ed:	55                   	push   %ebp
+  8001ee:	89 e5                	mov    %esp,%ebp
+  8001f0:	57                   	push   %edi
+  8001f1:	56                   	push   %esi
+  8001f2:	53                   	push   %ebx
+  8001f3:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8001f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001f9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001fc:	b8 05 00 00 00       	mov    $0x5,%eax
+  800201:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800204:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800207:	8b 75 18             	mov    0x18(%ebp),%esi
+  80020a:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80020c:	85 c0                	test   %eax,%eax
+  80020e:	7f 08                	jg     800218 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  800210:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800213:	5b                   	pop    %ebx
+  800214:	5e                   	pop    %esi
+  800215:	5f                   	pop    %edi
+  800216:	5d                   	pop    %ebp
+  800217:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800218:	83 ec 0c             	sub    $0xc,%esp
+  80021b:	50                   	push   %eax
+  80021c:	6a 05                	push   $0x5
+  80021e:	68 6a 2e 80 00       	push   $0x802e6a
+  800223:	6a 23                	push   $0x23
+  800225:	68 87 2e 80 00       	push   $0x802e87
+  80022a:	e8 3b 1e 00 00       	call   80206a <_panic>
+
+0080022f <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  80022f:	55                   	push   %ebp
+  800230:	89 e5                	mov    %esp,%ebp
+  800232:	57                   	push   %edi
+  800233:	56                   	push   %esi
+  800234:	53                   	push   %ebx
+  800235:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800238:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80023d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800240:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800243:	b8 06 00 00 00       	mov    $0x6,%eax
+  800248:	89 df                	mov    %ebx,%edi
+  80024a:	89 de                	mov    %ebx,%esi
+  80024c:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80024e:	85 c0                	test   %eax,%eax
+  800250:	7f 08                	jg     80025a <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  800252:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800255:	5b                   	pop    %ebx
+  800256:	5e                   	pop    %esi
+  800257:	5f                   	pop    %edi
+  800258:	5d                   	pop    %ebp
+  800259:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80025a:	83 ec 0c             	sub    $0xc,%esp
+  80025d:	50                   	push   %eax
+  80025e:	6a 06                	push   $0x6
+  800260:	68 6a 2e 80 00       	push   $0x802e6a
+  800265:	6a 23                	push   $0x23
+  800267:	68 87 2e 80 00       	push   $0x802e87
+  80026c:	e8 f9 1d 00 00       	call   80206a <_panic>
+
+00800271 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  800271:	55                   	push   %ebp
+  800272:	89 e5                	mov    %esp,%ebp
+  800274:	57                   	push   %edi
+  800275:	56                   	push   %esi
+  800276:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800277:	8b 55 08             	mov    0x8(%ebp),%edx
+  80027a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80027d:	b8 11 00 00 00       	mov    $0x11,%eax
+  800282:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800285:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800288:	8b 75 18             	mov    0x18(%ebp),%esi
+  80028b:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  80028d:	5b                   	pop    %ebx
+  80028e:	5e                   	pop    %esi
+  80028f:	5f                   	pop    %edi
+  800290:	5d                   	pop    %ebp
+  800291:	c3                   	ret
+
+00800292 <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  800292:	55                   	push   %ebp
+  800293:	89 e5                	mov    %esp,%ebp
+  800295:	57                   	push   %edi
+  800296:	56                   	push   %esi
+  800297:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800298:	8b 55 08             	mov    0x8(%ebp),%edx
+  80029b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80029e:	b8 12 00 00 00       	mov    $0x12,%eax
+  8002a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8002a8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8002ab:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8002ae:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  8002b0:	5b                   	pop    %ebx
+  8002b1:	5e                   	pop    %esi
+  8002b2:	5f                   	pop    %edi
+  8002b3:	5d                   	pop    %ebp
+  8002b4:	c3                   	ret
+
+008002b5 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  8002b5:	55                   	push   %ebp
+  8002b6:	89 e5                	mov    %esp,%ebp
+  8002b8:	57                   	push   %edi
+  8002b9:	56                   	push   %esi
+  8002ba:	53                   	push   %ebx
+  8002bb:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8002be:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002c6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002c9:	b8 16 00 00 00       	mov    $0x16,%eax
+  8002ce:	89 df                	mov    %ebx,%edi
+  8002d0:	89 de                	mov    %ebx,%esi
+  8002d2:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8002d4:	85 c0                	test   %eax,%eax
+  8002d6:	7f 08                	jg     8002e0 <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  8002d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002db:	5b                   	pop    %ebx
+  8002dc:	5e                   	pop    %esi
+  8002dd:	5f                   	pop    %edi
+  8002de:	5d                   	pop    %ebp
+  8002df:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8002e0:	83 ec 0c             	sub    $0xc,%esp
+  8002e3:	50                   	push   %eax
+  8002e4:	6a 16                	push   $0x16
+  8002e6:	68 6a 2e 80 00       	push   $0x802e6a
+  8002eb:	6a 23                	push   $0x23
+  8002ed:	68 87 2e 80 00       	push   $0x802e87
+  8002f2:	e8 73 1d 00 00       	call   80206a <_panic>
+
+008002f7 <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  8002f7:	55                   	push   %ebp
+  8002f8:	89 e5                	mov    %esp,%ebp
+  8002fa:	57                   	push   %edi
+  8002fb:	56                   	push   %esi
+  8002fc:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8002fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800302:	8b 55 08             	mov    0x8(%ebp),%edx
+  800305:	b8 17 00 00 00       	mov    $0x17,%eax
+  80030a:	89 cb                	mov    %ecx,%ebx
+  80030c:	89 cf                	mov    %ecx,%edi
+  80030e:	89 ce                	mov    %ecx,%esi
+  800310:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  800312:	5b                   	pop    %ebx
+  800313:	5e                   	pop    %esi
+  800314:	5f                   	pop    %edi
+  800315:	5d                   	pop    %ebp
+  800316:	c3                   	ret
+
+00800317 <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  800317:	55                   	push   %ebp
+  800318:	89 e5                	mov    %esp,%ebp
+  80031a:	57                   	push   %edi
+  80031b:	56                   	push   %esi
+  80031c:	53                   	push   %ebx
+  80031d:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800320:	be 00 00 00 00       	mov    $0x0,%esi
+  800325:	8b 55 08             	mov    0x8(%ebp),%edx
+  800328:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80032b:	b8 18 00 00 00       	mov    $0x18,%eax
+  800330:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800333:	89 f7                	mov    %esi,%edi
+  800335:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800337:	85 c0                	test   %eax,%eax
+  800339:	7f 08                	jg     800343 <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  80033b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80033e:	5b                   	pop    %ebx
+  80033f:	5e                   	pop    %esi
+  800340:	5f                   	pop    %edi
+  800341:	5d                   	pop    %ebp
+  800342:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800343:	83 ec 0c             	sub    $0xc,%esp
+  800346:	50                   	push   %eax
+  800347:	6a 18                	push   $0x18
+  800349:	68 6a 2e 80 00       	push   $0x802e6a
+  80034e:	6a 23                	push   $0x23
+  800350:	68 87 2e 80 00       	push   $0x802e87
+  800355:	e8 10 1d 00 00       	call   80206a <_panic>
+
+0080035a <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  80035a:	55                   	push   %ebp
+  80035b:	89 e5                	mov    %esp,%ebp
+  80035d:	57                   	push   %edi
+  80035e:	56                   	push   %esi
+  80035f:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800360:	be 00 00 00 00       	mov    $0x0,%esi
+  800365:	8b 55 08             	mov    0x8(%ebp),%edx
+  800368:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80036b:	b8 19 00 00 00       	mov    $0x19,%eax
+  800370:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800373:	89 f7                	mov    %esi,%edi
+  800375:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  800377:	5b                   	pop    %ebx
+  800378:	5e                   	pop    %esi
+  800379:	5f                   	pop    %edi
+  80037a:	5d                   	pop    %ebp
+  80037b:	c3                   	ret
+
+0080037c <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  80037c:	55                   	push   %ebp
+  80037d:	89 e5                	mov    %esp,%ebp
+  80037f:	57                   	push   %edi
+  800380:	56                   	push   %esi
+  800381:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800382:	ba 00 00 00 00       	mov    $0x0,%edx
+  800387:	b8 15 00 00 00       	mov    $0x15,%eax
+  80038c:	89 d1                	mov    %edx,%ecx
+  80038e:	89 d3                	mov    %edx,%ebx
+  800390:	89 d7                	mov    %edx,%edi
+  800392:	89 d6                	mov    %edx,%esi
+  800394:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800396:	5b                   	pop    %ebx
+  800397:	5e                   	pop    %esi
+  800398:	5f                   	pop    %edi
+  800399:	5d                   	pop    %ebp
+  80039a:	c3                   	ret
+
+0080039b <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  80039b:	55                   	push   %ebp
+  80039c:	89 e5                	mov    %esp,%ebp
+  80039e:	57                   	push   %edi
+  80039f:	56                   	push   %esi
+  8003a0:	53                   	push   %ebx
+  8003a1:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8003a4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003a9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003ac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003af:	b8 08 00 00 00       	mov    $0x8,%eax
+  8003b4:	89 df                	mov    %ebx,%edi
+  8003b6:	89 de                	mov    %ebx,%esi
+  8003b8:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8003ba:	85 c0                	test   %eax,%eax
+  8003bc:	7f 08                	jg     8003c6 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8003be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003c1:	5b                   	pop    %ebx
+  8003c2:	5e                   	pop    %esi
+  8003c3:	5f                   	pop    %edi
+  8003c4:	5d                   	pop    %ebp
+  8003c5:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8003c6:	83 ec 0c             	sub    $0xc,%esp
+  8003c9:	50                   	push   %eax
+  8003ca:	6a 08                	push   $0x8
+  8003cc:	68 6a 2e 80 00       	push   $0x802e6a
+  8003d1:	6a 23                	push   $0x23
+  8003d3:	68 87 2e 80 00       	push   $0x802e87
+  8003d8:	e8 8d 1c 00 00       	call   80206a <_panic>
+
+008003dd <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8003dd:	55                   	push   %ebp
+  8003de:	89 e5                	mov    %esp,%ebp
+  8003e0:	57                   	push   %edi
+  8003e1:	56                   	push   %esi
+  8003e2:	53                   	push   %ebx
+  8003e3:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8003e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003eb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003ee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003f1:	b8 09 00 00 00       	mov    $0x9,%eax
+  8003f6:	89 df                	mov    %ebx,%edi
+  8003f8:	89 de                	mov    %ebx,%esi
+  8003fa:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8003fc:	85 c0                	test   %eax,%eax
+  8003fe:	7f 08                	jg     800408 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  800400:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800403:	5b                   	pop    %ebx
+  800404:	5e                   	pop    %esi
+  800405:	5f                   	pop    %edi
+  800406:	5d                   	pop    %ebp
+  800407:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800408:	83 ec 0c             	sub    $0xc,%esp
+  80040b:	50                   	push   %eax
+  80040c:	6a 09                	push   $0x9
+  80040e:	68 6a 2e 80 00       	push   $0x802e6a
+  800413:	6a 23                	push   $0x23
+  800415:	68 87 2e 80 00       	push   $0x802e87
+  80041a:	e8 4b 1c 00 00       	call   80206a <_panic>
+
+0080041f <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80041f:	55                   	push   %ebp
+  800420:	89 e5                	mov    %esp,%ebp
+  800422:	57                   	push   %edi
+  800423:	56                   	push   %esi
+  800424:	53                   	push   %ebx
+  800425:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800428:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80042d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800430:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800433:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800438:	89 df                	mov    %ebx,%edi
+  80043a:	89 de                	mov    %ebx,%esi
+  80043c:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80043e:	85 c0                	test   %eax,%eax
+  800440:	7f 08                	jg     80044a <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  800442:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800445:	5b                   	pop    %ebx
+  800446:	5e                   	pop    %esi
+  800447:	5f                   	pop    %edi
+  800448:	5d                   	pop    %ebp
+  800449:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80044a:	83 ec 0c             	sub    $0xc,%esp
+  80044d:	50                   	push   %eax
+  80044e:	6a 0a                	push   $0xa
+  800450:	68 6a 2e 80 00       	push   $0x802e6a
+  800455:	6a 23                	push   $0x23
+  800457:	68 87 2e 80 00       	push   $0x802e87
+  80045c:	e8 09 1c 00 00       	call   80206a <_panic>
+
+00800461 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  800461:	55                   	push   %ebp
+  800462:	89 e5                	mov    %esp,%ebp
+  800464:	57                   	push   %edi
+  800465:	56                   	push   %esi
+  800466:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800467:	8b 55 08             	mov    0x8(%ebp),%edx
+  80046a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80046d:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800472:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800475:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800478:	8b 75 18             	mov    0x18(%ebp),%esi
+  80047b:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  80047d:	5b                   	pop    %ebx
+  80047e:	5e                   	pop    %esi
+  80047f:	5f                   	pop    %edi
+  800480:	5d                   	pop    %ebp
+  800481:	c3                   	ret
+
+00800482 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  800482:	55                   	push   %ebp
+  800483:	89 e5                	mov    %esp,%ebp
+  800485:	57                   	push   %edi
+  800486:	56                   	push   %esi
+  800487:	53                   	push   %ebx
+  800488:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80048b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800490:	8b 55 08             	mov    0x8(%ebp),%edx
+  800493:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800496:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80049b:	89 df                	mov    %ebx,%edi
+  80049d:	89 de                	mov    %ebx,%esi
+  80049f:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8004a1:	85 c0                	test   %eax,%eax
+  8004a3:	7f 08                	jg     8004ad <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  8004a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004a8:	5b                   	pop    %ebx
+  8004a9:	5e                   	pop    %esi
+  8004aa:	5f                   	pop    %edi
+  8004ab:	5d                   	pop    %ebp
+  8004ac:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8004ad:	83 ec 0c             	sub    $0xc,%esp
+  8004b0:	50                   	push   %eax
+  8004b1:	6a 0d                	push   $0xd
+  8004b3:	68 6a 2e 80 00       	push   $0x802e6a
+  8004b8:	6a 23                	push   $0x23
+  8004ba:	68 87 2e 80 00       	push   $0x802e87
+  8004bf:	e8 a6 1b 00 00       	call   80206a <_panic>
+
+008004c4 <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  8004c4:	55                   	push   %ebp
+  8004c5:	89 e5                	mov    %esp,%ebp
+  8004c7:	57                   	push   %edi
+  8004c8:	56                   	push   %esi
+  8004c9:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8004ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004cf:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8004d4:	89 d1                	mov    %edx,%ecx
+  8004d6:	89 d3                	mov    %edx,%ebx
+  8004d8:	89 d7                	mov    %edx,%edi
+  8004da:	89 d6                	mov    %edx,%esi
+  8004dc:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8004de:	5b                   	pop    %ebx
+  8004df:	5e                   	pop    %esi
+  8004e0:	5f                   	pop    %edi
+  8004e1:	5d                   	pop    %ebp
+  8004e2:	c3                   	ret
+
+008004e3 <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  8004e3:	55                   	push   %ebp
+  8004e4:	89 e5                	mov    %esp,%ebp
+  8004e6:	57                   	push   %edi
+  8004e7:	56                   	push   %esi
+  8004e8:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8004e9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004ec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004ef:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8004f4:	be 00 00 00 00       	mov    $0x0,%esi
+  8004f9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8004fc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8004ff:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  800501:	5b                   	pop    %ebx
+  800502:	5e                   	pop    %esi
+  800503:	5f                   	pop    %edi
+  800504:	5d                   	pop    %ebp
+  800505:	c3                   	ret
+
+00800506 <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  800506:	55                   	push   %ebp
+  800507:	89 e5                	mov    %esp,%ebp
+  800509:	57                   	push   %edi
+  80050a:	56                   	push   %esi
+  80050b:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80050c:	be 00 00 00 00       	mov    $0x0,%esi
+  800511:	8b 55 08             	mov    0x8(%ebp),%edx
+  800514:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800517:	b8 10 00 00 00       	mov    $0x10,%eax
+  80051c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80051f:	89 f7                	mov    %esi,%edi
+  800521:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  800523:	5b                   	pop    %ebx
+  800524:	5e                   	pop    %esi
+  800525:	5f                   	pop    %edi
+  800526:	5d                   	pop    %ebp
+  800527:	c3                   	ret
+
+00800528 <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  800528:	55                   	push   %ebp
+  800529:	89 e5                	mov    %esp,%ebp
+  80052b:	57                   	push   %edi
+  80052c:	56                   	push   %esi
+  80052d:	53                   	push   %ebx
+  80052e:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  800531:	80 3d 48 57 80 00 00 	cmpb   $0x0,0x805748
+  800538:	74 41                	je     80057b <sys_batch+0x53>
+  80053a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80053d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  800540:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  800547:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80054a:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  80054d:	7d 45                	jge    800594 <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  80054f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800552:	8b 06                	mov    (%esi),%eax
+  800554:	8b 56 04             	mov    0x4(%esi),%edx
+  800557:	8b 4e 08             	mov    0x8(%esi),%ecx
+  80055a:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  80055d:	8b 7e 10             	mov    0x10(%esi),%edi
+  800560:	8b 76 14             	mov    0x14(%esi),%esi
+  800563:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  800565:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800568:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  80056b:	83 c6 1c             	add    $0x1c,%esi
+  80056e:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  800571:	85 c0                	test   %eax,%eax
+  800573:	78 1f                	js     800594 <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  800575:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  800579:	eb cc                	jmp    800547 <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  80057b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800580:	b8 13 00 00 00       	mov    $0x13,%eax
+  800585:	8b 55 08             	mov    0x8(%ebp),%edx
+  800588:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80058b:	89 df                	mov    %ebx,%edi
+  80058d:	89 de                	mov    %ebx,%esi
+  80058f:	cd 30                	int    $0x30
+  800591:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  800594:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800597:	83 c4 08             	add    $0x8,%esp
+  80059a:	5b                   	pop    %ebx
+  80059b:	5e                   	pop    %esi
+  80059c:	5f                   	pop    %edi
+  80059d:	5d                   	pop    %ebp
+  80059e:	c3                   	ret
+
+0080059f <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  80059f:	55                   	push   %ebp
+  8005a0:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  8005a2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8005a5:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8005ab:	5d                   	pop    %ebp
+  8005ac:	c3                   	ret
+
+008005ad <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  8005ad:	55                   	push   %ebp
+  8005ae:	89 e5                	mov    %esp,%ebp
+  8005b0:	56                   	push   %esi
+  8005b1:	53                   	push   %ebx
+  8005b2:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  8005b5:	8b 1e                	mov    (%esi),%ebx
+  8005b7:	85 db                	test   %ebx,%ebx
+  8005b9:	75 09                	jne    8005c4 <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  8005bb:	89 d8                	mov    %ebx,%eax
+  8005bd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8005c0:	5b                   	pop    %ebx
+  8005c1:	5e                   	pop    %esi
+  8005c2:	5d                   	pop    %ebp
+  8005c3:	c3                   	ret
+  b->sb_n = 0;
+  8005c4:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  8005ca:	53                   	push   %ebx
+  8005cb:	8d 46 04             	lea    0x4(%esi),%eax
+  8005ce:	50                   	push   %eax
+  8005cf:	e8 54 ff ff ff       	call   800528 <sys_batch>
+  8005d4:	83 c4 08             	add    $0x8,%esp
+  8005d7:	85 c0                	test   %eax,%eax
+  8005d9:	78 1e                	js     8005f9 <sysbatch_flush+0x4c>
+  if (r < n)
+  8005db:	39 c3                	cmp    %eax,%ebx
+  8005dd:	7f 07                	jg     8005e6 <sysbatch_flush+0x39>
+  return 0;
+  8005df:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005e4:	eb d5                	jmp    8005bb <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  8005e6:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8005e9:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  8005ed:	85 db                	test   %ebx,%ebx
+  8005ef:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8005f4:	0f 49 d8             	cmovns %eax,%ebx
+  8005f7:	eb c2                	jmp    8005bb <sysbatch_flush+0xe>
+    return r;
+  8005f9:	89 c3                	mov    %eax,%ebx
+  8005fb:	eb be                	jmp    8005bb <sysbatch_flush+0xe>
+
+008005fd <sysbatch_add>:
+{
+  8005fd:	55                   	push   %ebp
+  8005fe:	89 e5                	mov    %esp,%ebp
+  800600:	53                   	push   %ebx
+  800601:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  800604:	83 3b 40             	cmpl   $0x40,(%ebx)
+  800607:	74 41                	je     80064a <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  800609:	8b 03                	mov    (%ebx),%eax
+  80060b:	8d 50 01             	lea    0x1(%eax),%edx
+  80060e:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  800610:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  800613:	01 d8                	add    %ebx,%eax
+  800615:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800618:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  80061b:	8b 55 10             	mov    0x10(%ebp),%edx
+  80061e:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  800621:	8b 55 14             	mov    0x14(%ebp),%edx
+  800624:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  800627:	8b 55 18             	mov    0x18(%ebp),%edx
+  80062a:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  80062d:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  800630:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  800633:	8b 55 20             	mov    0x20(%ebp),%edx
+  800636:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  800639:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  800640:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800645:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800648:	c9                   	leave
+  800649:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  80064a:	53                   	push   %ebx
+  80064b:	e8 5d ff ff ff       	call   8005ad <sysbatch_flush>
+  800650:	83 c4 04             	add    $0x4,%esp
+  800653:	85 c0                	test   %eax,%eax
+  800655:	79 b2                	jns    800609 <sysbatch_add+0xc>
+  800657:	eb ec                	jmp    800645 <sysbatch_add+0x48>
+
+00800659 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800659:	55                   	push   %ebp
+  80065a:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80065c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80065f:	05 00 00 00 30       	add    $0x30000000,%eax
+  800664:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800667:	5d                   	pop    %ebp
+  800668:	c3                   	ret
+
+00800669 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800669:	55                   	push   %ebp
+  80066a:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80066c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80066f:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  800672:	66 b8 00 00          	mov    $0x0,%ax
+  800676:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80067b:	5d                   	pop    %ebp
+  80067c:	c3                   	ret
+
+0080067d <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80067d:	55                   	push   %ebp
+  80067e:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  800680:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  800685:	eb 02                	jmp    800689 <fd_alloc+0xc>
+  800687:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800689:	89 c2                	mov    %eax,%edx
+  80068b:	c1 ea 16             	shr    $0x16,%edx
+  80068e:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800695:	f6 c2 01             	test   $0x1,%dl
+  800698:	74 2b                	je     8006c5 <fd_alloc+0x48>
+  80069a:	89 c2                	mov    %eax,%edx
+  80069c:	c1 ea 0c             	shr    $0xc,%edx
+  80069f:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8006a6:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8006ac:	f6 c1 01             	test   $0x1,%cl
+  8006af:	74 14                	je     8006c5 <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  8006b1:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8006b7:	75 ce                	jne    800687 <fd_alloc+0xa>
+  8006b9:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  8006be:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8006c3:	eb 05                	jmp    8006ca <fd_alloc+0x4d>
+      return 0;
+  8006c5:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  8006ca:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006cd:	89 02                	mov    %eax,(%edx)
+}
+  8006cf:	89 c8                	mov    %ecx,%eax
+  8006d1:	5d                   	pop    %ebp
+  8006d2:	c3                   	ret
+
+008006d3 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8006d3:	55                   	push   %ebp
+  8006d4:	89 e5                	mov    %esp,%ebp
+  8006d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  8006d9:	83 f8 1f             	cmp    $0x1f,%eax
+  8006dc:	77 30                	ja     80070e <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  8006de:	c1 e0 0c             	shl    $0xc,%eax
+  8006e1:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8006e6:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8006ec:	f6 c2 01             	test   $0x1,%dl
+  8006ef:	74 24                	je     800715 <fd_lookup+0x42>
+  8006f1:	89 c2                	mov    %eax,%edx
+  8006f3:	c1 ea 0c             	shr    $0xc,%edx
+  8006f6:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8006fd:	f6 c2 01             	test   $0x1,%dl
+  800700:	74 1a                	je     80071c <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  800702:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800705:	89 02                	mov    %eax,(%edx)
+  return 0;
+  800707:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80070c:	5d                   	pop    %ebp
+  80070d:	c3                   	ret
+    return -E_INVAL;
+  80070e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800713:	eb f7                	jmp    80070c <fd_lookup+0x39>
+    return -E_INVAL;
+  800715:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80071a:	eb f0                	jmp    80070c <fd_lookup+0x39>
+  80071c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800721:	eb e9                	jmp    80070c <fd_lookup+0x39>
+
+00800723 <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  800723:	55                   	push   %ebp
+  800724:	89 e5                	mov    %esp,%ebp
+  800726:	53                   	push   %ebx
+  800727:	83 ec 04             	sub    $0x4,%esp
+  80072a:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  80072d:	b8 14 2f 80 00       	mov    $0x802f14,%eax
+  800732:	8b 18                	mov    (%eax),%ebx
+  800734:	85 db                	test   %ebx,%ebx
+  800736:	74 0e                	je     800746 <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  800738:	83 c0 04             	add    $0x4,%eax
+  80073b:	39 13                	cmp    %edx,(%ebx)
+  80073d:	75 f3                	jne    800732 <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  80073f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800744:	eb 1f                	jmp    800765 <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800746:	a1 44 57 80 00       	mov    0x805744,%eax
+  80074b:	8b 40 48             	mov    0x48(%eax),%eax
+  80074e:	83 ec 04             	sub    $0x4,%esp
+  800751:	52                   	push   %edx
+  800752:	50                   	push   %eax
+  800753:	68 98 2e 80 00       	push   $0x802e98
+  800758:	e8 e8 19 00 00       	call   802145 <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  80075d:	83 c4 10             	add    $0x10,%esp
+  800760:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  800765:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800768:	89 1a                	mov    %ebx,(%edx)
+}
+  80076a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80076d:	c9                   	leave
+  80076e:	c3                   	ret
+
+0080076f <fd_close>:
+{
+  80076f:	55                   	push   %ebp
+  800770:	89 e5                	mov    %esp,%ebp
+  800772:	57                   	push   %edi
+  800773:	56                   	push   %esi
+  800774:	53                   	push   %ebx
+  800775:	83 ec 24             	sub    $0x24,%esp
+  800778:	8b 75 08             	mov    0x8(%ebp),%esi
+  80077b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80077e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800781:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  800782:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800788:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80078b:	50                   	push   %eax
+  80078c:	e8 42 ff ff ff       	call   8006d3 <fd_lookup>
+  800791:	89 c3                	mov    %eax,%ebx
+  800793:	83 c4 10             	add    $0x10,%esp
+  800796:	85 c0                	test   %eax,%eax
+  800798:	78 05                	js     80079f <fd_close+0x30>
+      || fd != fd2)
+  80079a:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80079d:	74 16                	je     8007b5 <fd_close+0x46>
+    return must_exist ? r : 0;
+  80079f:	89 f8                	mov    %edi,%eax
+  8007a1:	84 c0                	test   %al,%al
+  8007a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007a8:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8007ab:	89 d8                	mov    %ebx,%eax
+  8007ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007b0:	5b                   	pop    %ebx
+  8007b1:	5e                   	pop    %esi
+  8007b2:	5f                   	pop    %edi
+  8007b3:	5d                   	pop    %ebp
+  8007b4:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8007b5:	83 ec 08             	sub    $0x8,%esp
+  8007b8:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8007bb:	50                   	push   %eax
+  8007bc:	ff 36                	push   (%esi)
+  8007be:	e8 60 ff ff ff       	call   800723 <dev_lookup>
+  8007c3:	89 c3                	mov    %eax,%ebx
+  8007c5:	83 c4 10             	add    $0x10,%esp
+  8007c8:	85 c0                	test   %eax,%eax
+  8007ca:	78 1a                	js     8007e6 <fd_close+0x77>
+    if (dev->dev_close)
+  8007cc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8007cf:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  8007d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  8007d7:	85 c0                	test   %eax,%eax
+  8007d9:	74 0b                	je     8007e6 <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  8007db:	83 ec 0c             	sub    $0xc,%esp
+  8007de:	56                   	push   %esi
+  8007df:	ff d0                	call   *%eax
+  8007e1:	89 c3                	mov    %eax,%ebx
+  8007e3:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  8007e6:	83 ec 08             	sub    $0x8,%esp
+  8007e9:	56                   	push   %esi
+  8007ea:	6a 00                	push   $0x0
+  8007ec:	e8 3e fa ff ff       	call   80022f <sys_page_unmap>
+  return r;
+  8007f1:	83 c4 10             	add    $0x10,%esp
+  8007f4:	eb b5                	jmp    8007ab <fd_close+0x3c>
+
+008007f6 <close>:
+
+int
+close(int fdnum)
+{
+  8007f6:	55                   	push   %ebp
+  8007f7:	89 e5                	mov    %esp,%ebp
+  8007f9:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8007fc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8007ff:	50                   	push   %eax
+  800800:	ff 75 08             	push   0x8(%ebp)
+  800803:	e8 cb fe ff ff       	call   8006d3 <fd_lookup>
+  800808:	83 c4 10             	add    $0x10,%esp
+  80080b:	85 c0                	test   %eax,%eax
+  80080d:	79 02                	jns    800811 <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  80080f:	c9                   	leave
+  800810:	c3                   	ret
+    return fd_close(fd, 1);
+  800811:	83 ec 08             	sub    $0x8,%esp
+  800814:	6a 01                	push   $0x1
+  800816:	ff 75 f4             	push   -0xc(%ebp)
+  800819:	e8 51 ff ff ff       	call   80076f <fd_close>
+  80081e:	83 c4 10             	add    $0x10,%esp
+  800821:	eb ec                	jmp    80080f <close+0x19>
+
+00800823 <close_all>:
+
+void
+close_all(void)
+{
+  800823:	55                   	push   %ebp
+  800824:	89 e5                	mov    %esp,%ebp
+  800826:	53                   	push   %ebx
+  800827:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  80082a:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  80082f:	83 ec 0c             	sub    $0xc,%esp
+  800832:	53                   	push   %ebx
+  800833:	e8 be ff ff ff       	call   8007f6 <close>
+  for (i = 0; i < MAXFD; i++)
+  800838:	83 c3 01             	add    $0x1,%ebx
+  80083b:	83 c4 10             	add    $0x10,%esp
+  80083e:	83 fb 20             	cmp    $0x20,%ebx
+  800841:	75 ec                	jne    80082f <close_all+0xc>
+}
+  800843:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800846:	c9                   	leave
+  800847:	c3                   	ret
+
+00800848 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  800848:	55                   	push   %ebp
+  800849:	89 e5                	mov    %esp,%ebp
+  80084b:	57                   	push   %edi
+  80084c:	56                   	push   %esi
+  80084d:	53                   	push   %ebx
+  80084e:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  800851:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800854:	50                   	push   %eax
+  800855:	ff 75 08             	push   0x8(%ebp)
+  800858:	e8 76 fe ff ff       	call   8006d3 <fd_lookup>
+  80085d:	89 c6                	mov    %eax,%esi
+  80085f:	83 c4 10             	add    $0x10,%esp
+  800862:	85 c0                	test   %eax,%eax
+  800864:	0f 88 0a 01 00 00    	js     800974 <dup+0x12c>
+    return r;
+  close(newfdnum);
+  80086a:	83 ec 0c             	sub    $0xc,%esp
+  80086d:	ff 75 0c             	push   0xc(%ebp)
+  800870:	e8 81 ff ff ff       	call   8007f6 <close>
+
+  newfd = INDEX2FD(newfdnum);
+  800875:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800878:	c1 e0 0c             	shl    $0xc,%eax
+  80087b:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  800881:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  800884:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800887:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  80088a:	89 04 24             	mov    %eax,(%esp)
+  80088d:	e8 d7 fd ff ff       	call   800669 <fd2data>
+  800892:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  800894:	89 3c 24             	mov    %edi,(%esp)
+  800897:	e8 cd fd ff ff       	call   800669 <fd2data>
+  80089c:	83 c4 10             	add    $0x10,%esp
+  80089f:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8008a2:	89 f3                	mov    %esi,%ebx
+  8008a4:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  8008aa:	89 c6                	mov    %eax,%esi
+  8008ac:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8008af:	89 cf                	mov    %ecx,%edi
+  8008b1:	eb 0c                	jmp    8008bf <dup+0x77>
+  8008b3:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8008b9:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8008bf:	39 fb                	cmp    %edi,%ebx
+  8008c1:	74 7b                	je     80093e <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  8008c3:	89 d8                	mov    %ebx,%eax
+  8008c5:	c1 e8 16             	shr    $0x16,%eax
+  8008c8:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8008cf:	a8 01                	test   $0x1,%al
+  8008d1:	74 e0                	je     8008b3 <dup+0x6b>
+  8008d3:	89 d8                	mov    %ebx,%eax
+  8008d5:	c1 e8 0c             	shr    $0xc,%eax
+  8008d8:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8008df:	f6 c2 01             	test   $0x1,%dl
+  8008e2:	74 cf                	je     8008b3 <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  8008e4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  8008eb:	83 ec 0c             	sub    $0xc,%esp
+  8008ee:	25 07 0e 00 00       	and    $0xe07,%eax
+  8008f3:	50                   	push   %eax
+  8008f4:	56                   	push   %esi
+  8008f5:	6a 00                	push   $0x0
+  8008f7:	53                   	push   %ebx
+  8008f8:	6a 00                	push   $0x0
+  8008fa:	e8 ee f8 ff ff       	call   8001ed <sys_page_map>
+  8008ff:	83 c4 20             	add    $0x20,%esp
+  800902:	85 c0                	test   %eax,%eax
+  800904:	79 ad                	jns    8008b3 <dup+0x6b>
+  800906:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800909:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  80090b:	83 ec 08             	sub    $0x8,%esp
+  80090e:	ff 75 d4             	push   -0x2c(%ebp)
+  800911:	6a 00                	push   $0x0
+  800913:	e8 17 f9 ff ff       	call   80022f <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  800918:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  80091b:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  800921:	83 c4 10             	add    $0x10,%esp
+  800924:	39 df                	cmp    %ebx,%edi
+  800926:	74 4c                	je     800974 <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  800928:	83 ec 08             	sub    $0x8,%esp
+  80092b:	57                   	push   %edi
+  80092c:	6a 00                	push   $0x0
+  80092e:	e8 fc f8 ff ff       	call   80022f <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  800933:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  800939:	83 c4 10             	add    $0x10,%esp
+  80093c:	eb e6                	jmp    800924 <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80093e:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800941:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800944:	89 c8                	mov    %ecx,%eax
+  800946:	c1 e8 0c             	shr    $0xc,%eax
+  800949:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800950:	83 ec 0c             	sub    $0xc,%esp
+  800953:	25 07 0e 00 00       	and    $0xe07,%eax
+  800958:	50                   	push   %eax
+  800959:	ff 75 d4             	push   -0x2c(%ebp)
+  80095c:	6a 00                	push   $0x0
+  80095e:	51                   	push   %ecx
+  80095f:	6a 00                	push   $0x0
+  800961:	e8 87 f8 ff ff       	call   8001ed <sys_page_map>
+  800966:	89 c6                	mov    %eax,%esi
+  800968:	83 c4 20             	add    $0x20,%esp
+  80096b:	85 c0                	test   %eax,%eax
+  80096d:	78 9c                	js     80090b <dup+0xc3>
+  return newfdnum;
+  80096f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800972:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  800974:	89 f0                	mov    %esi,%eax
+  800976:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800979:	5b                   	pop    %ebx
+  80097a:	5e                   	pop    %esi
+  80097b:	5f                   	pop    %edi
+  80097c:	5d                   	pop    %ebp
+  80097d:	c3                   	ret
+
+0080097e <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80097e:	55                   	push   %ebp
+  80097f:	89 e5                	mov    %esp,%ebp
+  800981:	56                   	push   %esi
+  800982:	53                   	push   %ebx
+  800983:	83 ec 18             	sub    $0x18,%esp
+  800986:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  800989:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80098c:	50                   	push   %eax
+  80098d:	56                   	push   %esi
+  80098e:	e8 40 fd ff ff       	call   8006d3 <fd_lookup>
+  800993:	83 c4 10             	add    $0x10,%esp
+  800996:	85 c0                	test   %eax,%eax
+  800998:	78 3c                	js     8009d6 <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80099a:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80099d:	83 ec 08             	sub    $0x8,%esp
+  8009a0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8009a3:	50                   	push   %eax
+  8009a4:	ff 33                	push   (%ebx)
+  8009a6:	e8 78 fd ff ff       	call   800723 <dev_lookup>
+  8009ab:	83 c4 10             	add    $0x10,%esp
+  8009ae:	85 c0                	test   %eax,%eax
+  8009b0:	78 24                	js     8009d6 <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8009b2:	8b 43 08             	mov    0x8(%ebx),%eax
+  8009b5:	83 e0 03             	and    $0x3,%eax
+  8009b8:	83 f8 01             	cmp    $0x1,%eax
+  8009bb:	74 20                	je     8009dd <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  8009bd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009c0:	8b 40 08             	mov    0x8(%eax),%eax
+  8009c3:	85 c0                	test   %eax,%eax
+  8009c5:	74 37                	je     8009fe <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  8009c7:	83 ec 04             	sub    $0x4,%esp
+  8009ca:	ff 75 10             	push   0x10(%ebp)
+  8009cd:	ff 75 0c             	push   0xc(%ebp)
+  8009d0:	53                   	push   %ebx
+  8009d1:	ff d0                	call   *%eax
+  8009d3:	83 c4 10             	add    $0x10,%esp
+}
+  8009d6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8009d9:	5b                   	pop    %ebx
+  8009da:	5e                   	pop    %esi
+  8009db:	5d                   	pop    %ebp
+  8009dc:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8009dd:	a1 44 57 80 00       	mov    0x805744,%eax
+  8009e2:	8b 40 48             	mov    0x48(%eax),%eax
+  8009e5:	83 ec 04             	sub    $0x4,%esp
+  8009e8:	56                   	push   %esi
+  8009e9:	50                   	push   %eax
+  8009ea:	68 d9 2e 80 00       	push   $0x802ed9
+  8009ef:	e8 51 17 00 00       	call   802145 <cprintf>
+    return -E_INVAL;
+  8009f4:	83 c4 10             	add    $0x10,%esp
+  8009f7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8009fc:	eb d8                	jmp    8009d6 <read+0x58>
+    return -E_NOT_SUPP;
+  8009fe:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800a03:	eb d1                	jmp    8009d6 <read+0x58>
+
+00800a05 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  800a05:	55                   	push   %ebp
+  800a06:	89 e5                	mov    %esp,%ebp
+  800a08:	57                   	push   %edi
+  800a09:	56                   	push   %esi
+  800a0a:	53                   	push   %ebx
+  800a0b:	83 ec 0c             	sub    $0xc,%esp
+  800a0e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a11:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  800a14:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800a19:	eb 02                	jmp    800a1d <readn+0x18>
+  800a1b:	01 c3                	add    %eax,%ebx
+  800a1d:	39 f3                	cmp    %esi,%ebx
+  800a1f:	73 21                	jae    800a42 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  800a21:	83 ec 04             	sub    $0x4,%esp
+  800a24:	89 f0                	mov    %esi,%eax
+  800a26:	29 d8                	sub    %ebx,%eax
+  800a28:	50                   	push   %eax
+  800a29:	89 d8                	mov    %ebx,%eax
+  800a2b:	03 45 0c             	add    0xc(%ebp),%eax
+  800a2e:	50                   	push   %eax
+  800a2f:	57                   	push   %edi
+  800a30:	e8 49 ff ff ff       	call   80097e <read>
+    if (m < 0)
+  800a35:	83 c4 10             	add    $0x10,%esp
+  800a38:	85 c0                	test   %eax,%eax
+  800a3a:	78 04                	js     800a40 <readn+0x3b>
+      return m;
+    if (m == 0)
+  800a3c:	75 dd                	jne    800a1b <readn+0x16>
+  800a3e:	eb 02                	jmp    800a42 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  800a40:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  800a42:	89 d8                	mov    %ebx,%eax
+  800a44:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a47:	5b                   	pop    %ebx
+  800a48:	5e                   	pop    %esi
+  800a49:	5f                   	pop    %edi
+  800a4a:	5d                   	pop    %ebp
+  800a4b:	c3                   	ret
+
+00800a4c <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  800a4c:	55                   	push   %ebp
+  800a4d:	89 e5                	mov    %esp,%ebp
+  800a4f:	56                   	push   %esi
+  800a50:	53                   	push   %ebx
+  800a51:	83 ec 18             	sub    $0x18,%esp
+  800a54:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  800a57:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800a5a:	50                   	push   %eax
+  800a5b:	53                   	push   %ebx
+  800a5c:	e8 72 fc ff ff       	call   8006d3 <fd_lookup>
+  800a61:	83 c4 10             	add    $0x10,%esp
+  800a64:	85 c0                	test   %eax,%eax
+  800a66:	78 37                	js     800a9f <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800a68:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800a6b:	83 ec 08             	sub    $0x8,%esp
+  800a6e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a71:	50                   	push   %eax
+  800a72:	ff 36                	push   (%esi)
+  800a74:	e8 aa fc ff ff       	call   800723 <dev_lookup>
+  800a79:	83 c4 10             	add    $0x10,%esp
+  800a7c:	85 c0                	test   %eax,%eax
+  800a7e:	78 1f                	js     800a9f <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800a80:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800a84:	74 20                	je     800aa6 <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  800a86:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a89:	8b 40 0c             	mov    0xc(%eax),%eax
+  800a8c:	85 c0                	test   %eax,%eax
+  800a8e:	74 37                	je     800ac7 <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  800a90:	83 ec 04             	sub    $0x4,%esp
+  800a93:	ff 75 10             	push   0x10(%ebp)
+  800a96:	ff 75 0c             	push   0xc(%ebp)
+  800a99:	56                   	push   %esi
+  800a9a:	ff d0                	call   *%eax
+  800a9c:	83 c4 10             	add    $0x10,%esp
+}
+  800a9f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800aa2:	5b                   	pop    %ebx
+  800aa3:	5e                   	pop    %esi
+  800aa4:	5d                   	pop    %ebp
+  800aa5:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800aa6:	a1 44 57 80 00       	mov    0x805744,%eax
+  800aab:	8b 40 48             	mov    0x48(%eax),%eax
+  800aae:	83 ec 04             	sub    $0x4,%esp
+  800ab1:	53                   	push   %ebx
+  800ab2:	50                   	push   %eax
+  800ab3:	68 f5 2e 80 00       	push   $0x802ef5
+  800ab8:	e8 88 16 00 00       	call   802145 <cprintf>
+    return -E_INVAL;
+  800abd:	83 c4 10             	add    $0x10,%esp
+  800ac0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ac5:	eb d8                	jmp    800a9f <write+0x53>
+    return -E_NOT_SUPP;
+  800ac7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800acc:	eb d1                	jmp    800a9f <write+0x53>
+
+00800ace <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  800ace:	55                   	push   %ebp
+  800acf:	89 e5                	mov    %esp,%ebp
+  800ad1:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800ad4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800ad7:	50                   	push   %eax
+  800ad8:	ff 75 08             	push   0x8(%ebp)
+  800adb:	e8 f3 fb ff ff       	call   8006d3 <fd_lookup>
+  800ae0:	83 c4 10             	add    $0x10,%esp
+  800ae3:	85 c0                	test   %eax,%eax
+  800ae5:	78 0e                	js     800af5 <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  800ae7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800aea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800aed:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  800af0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800af5:	c9                   	leave
+  800af6:	c3                   	ret
+
+00800af7 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800af7:	55                   	push   %ebp
+  800af8:	89 e5                	mov    %esp,%ebp
+  800afa:	56                   	push   %esi
+  800afb:	53                   	push   %ebx
+  800afc:	83 ec 18             	sub    $0x18,%esp
+  800aff:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  800b02:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800b05:	50                   	push   %eax
+  800b06:	53                   	push   %ebx
+  800b07:	e8 c7 fb ff ff       	call   8006d3 <fd_lookup>
+  800b0c:	83 c4 10             	add    $0x10,%esp
+  800b0f:	85 c0                	test   %eax,%eax
+  800b11:	78 34                	js     800b47 <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800b13:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800b16:	83 ec 08             	sub    $0x8,%esp
+  800b19:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b1c:	50                   	push   %eax
+  800b1d:	ff 36                	push   (%esi)
+  800b1f:	e8 ff fb ff ff       	call   800723 <dev_lookup>
+  800b24:	83 c4 10             	add    $0x10,%esp
+  800b27:	85 c0                	test   %eax,%eax
+  800b29:	78 1c                	js     800b47 <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800b2b:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800b2f:	74 1d                	je     800b4e <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  800b31:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b34:	8b 40 18             	mov    0x18(%eax),%eax
+  800b37:	85 c0                	test   %eax,%eax
+  800b39:	74 34                	je     800b6f <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  800b3b:	83 ec 08             	sub    $0x8,%esp
+  800b3e:	ff 75 0c             	push   0xc(%ebp)
+  800b41:	56                   	push   %esi
+  800b42:	ff d0                	call   *%eax
+  800b44:	83 c4 10             	add    $0x10,%esp
+}
+  800b47:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b4a:	5b                   	pop    %ebx
+  800b4b:	5e                   	pop    %esi
+  800b4c:	5d                   	pop    %ebp
+  800b4d:	c3                   	ret
+            thisenv->env_id, fdnum);
+  800b4e:	a1 44 57 80 00       	mov    0x805744,%eax
+  800b53:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800b56:	83 ec 04             	sub    $0x4,%esp
+  800b59:	53                   	push   %ebx
+  800b5a:	50                   	push   %eax
+  800b5b:	68 b8 2e 80 00       	push   $0x802eb8
+  800b60:	e8 e0 15 00 00       	call   802145 <cprintf>
+    return -E_INVAL;
+  800b65:	83 c4 10             	add    $0x10,%esp
+  800b68:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b6d:	eb d8                	jmp    800b47 <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  800b6f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800b74:	eb d1                	jmp    800b47 <ftruncate+0x50>
+
+00800b76 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800b76:	55                   	push   %ebp
+  800b77:	89 e5                	mov    %esp,%ebp
+  800b79:	56                   	push   %esi
+  800b7a:	53                   	push   %ebx
+  800b7b:	83 ec 18             	sub    $0x18,%esp
+  800b7e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  800b81:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800b84:	50                   	push   %eax
+  800b85:	ff 75 08             	push   0x8(%ebp)
+  800b88:	e8 46 fb ff ff       	call   8006d3 <fd_lookup>
+  800b8d:	83 c4 10             	add    $0x10,%esp
+  800b90:	85 c0                	test   %eax,%eax
+  800b92:	78 49                	js     800bdd <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800b94:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800b97:	83 ec 08             	sub    $0x8,%esp
+  800b9a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b9d:	50                   	push   %eax
+  800b9e:	ff 36                	push   (%esi)
+  800ba0:	e8 7e fb ff ff       	call   800723 <dev_lookup>
+  800ba5:	83 c4 10             	add    $0x10,%esp
+  800ba8:	85 c0                	test   %eax,%eax
+  800baa:	78 31                	js     800bdd <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  800bac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800baf:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800bb3:	74 2f                	je     800be4 <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  800bb5:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  800bb8:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800bbf:	00 00 00 
+  stat->st_isdir = 0;
+  800bc2:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800bc9:	00 00 00 
+  stat->st_dev = dev;
+  800bcc:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  800bd2:	83 ec 08             	sub    $0x8,%esp
+  800bd5:	53                   	push   %ebx
+  800bd6:	56                   	push   %esi
+  800bd7:	ff 50 14             	call   *0x14(%eax)
+  800bda:	83 c4 10             	add    $0x10,%esp
+}
+  800bdd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800be0:	5b                   	pop    %ebx
+  800be1:	5e                   	pop    %esi
+  800be2:	5d                   	pop    %ebp
+  800be3:	c3                   	ret
+    return -E_NOT_SUPP;
+  800be4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800be9:	eb f2                	jmp    800bdd <fstat+0x67>
+
+00800beb <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  800beb:	55                   	push   %ebp
+  800bec:	89 e5                	mov    %esp,%ebp
+  800bee:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  800bf1:	ff 75 0c             	push   0xc(%ebp)
+  800bf4:	ff 75 08             	push   0x8(%ebp)
+  800bf7:	e8 58 07 00 00       	call   801354 <file_stat>
+}
+  800bfc:	c9                   	leave
+  800bfd:	c3                   	ret
+
+00800bfe <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  800bfe:	55                   	push   %ebp
+  800bff:	89 e5                	mov    %esp,%ebp
+  800c01:	57                   	push   %edi
+  800c02:	56                   	push   %esi
+  800c03:	53                   	push   %ebx
+  800c04:	83 ec 1c             	sub    $0x1c,%esp
+  800c07:	89 c7                	mov    %eax,%edi
+  800c09:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  800c0c:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  800c0f:	e9 a2 00 00 00       	jmp    800cb6 <fsipc_send+0xb8>
+  nfsenvs = 0;
+  800c14:	c7 05 00 50 80 00 00 	movl   $0x0,0x805000
+  800c1b:	00 00 00 
+  800c1e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c23:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  800c28:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  800c2d:	be 01 00 00 00       	mov    $0x1,%esi
+  800c32:	eb 0f                	jmp    800c43 <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  800c34:	83 c0 01             	add    $0x1,%eax
+  800c37:	3d 00 04 00 00       	cmp    $0x400,%eax
+  800c3c:	74 49                	je     800c87 <fsipc_send+0x89>
+  800c3e:	83 f9 07             	cmp    $0x7,%ecx
+  800c41:	7f 50                	jg     800c93 <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  800c43:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  800c46:	c1 e2 04             	shl    $0x4,%edx
+  800c49:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800c4f:	8b 52 50             	mov    0x50(%edx),%edx
+  800c52:	83 fa 01             	cmp    $0x1,%edx
+  800c55:	75 dd                	jne    800c34 <fsipc_send+0x36>
+  800c57:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  800c5a:	c1 e2 04             	shl    $0x4,%edx
+  800c5d:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800c63:	8b 52 54             	mov    0x54(%edx),%edx
+  800c66:	85 d2                	test   %edx,%edx
+  800c68:	74 ca                	je     800c34 <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  800c6a:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  800c6d:	c1 e2 04             	shl    $0x4,%edx
+  800c70:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800c76:	8b 52 48             	mov    0x48(%edx),%edx
+  800c79:	89 14 8d 20 50 80 00 	mov    %edx,0x805020(,%ecx,4)
+  800c80:	8d 49 01             	lea    0x1(%ecx),%ecx
+  800c83:	89 f3                	mov    %esi,%ebx
+  800c85:	eb ad                	jmp    800c34 <fsipc_send+0x36>
+  800c87:	84 db                	test   %bl,%bl
+  800c89:	74 38                	je     800cc3 <fsipc_send+0xc5>
+  800c8b:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  800c91:	eb 30                	jmp    800cc3 <fsipc_send+0xc5>
+  800c93:	84 db                	test   %bl,%bl
+  800c95:	74 2c                	je     800cc3 <fsipc_send+0xc5>
+  800c97:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  800c9d:	eb 24                	jmp    800cc3 <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  800c9f:	50                   	push   %eax
+  800ca0:	68 24 2f 80 00       	push   $0x802f24
+  800ca5:	6a 34                	push   $0x34
+  800ca7:	68 2e 2f 80 00       	push   $0x802f2e
+  800cac:	e8 b9 13 00 00       	call   80206a <_panic>
+    }
+    sys_yield();
+  800cb1:	e8 92 f4 ff ff       	call   800148 <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  800cb6:	83 3d 00 50 80 00 03 	cmpl   $0x3,0x805000
+  800cbd:	0f 8e 51 ff ff ff    	jle    800c14 <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  800cc3:	a1 44 57 80 00       	mov    0x805744,%eax
+  800cc8:	8b 70 48             	mov    0x48(%eax),%esi
+  800ccb:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  800cd1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cd6:	8b 0d 00 50 80 00    	mov    0x805000,%ecx
+  800cdc:	39 d9                	cmp    %ebx,%ecx
+  800cde:	7e d1                	jle    800cb1 <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  800ce0:	83 ec 0c             	sub    $0xc,%esp
+  800ce3:	ff 75 e0             	push   -0x20(%ebp)
+  800ce6:	6a 07                	push   $0x7
+  800ce8:	ff 75 e4             	push   -0x1c(%ebp)
+  800ceb:	57                   	push   %edi
+  800cec:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  800cef:	99                   	cltd
+  800cf0:	f7 f9                	idiv   %ecx
+  800cf2:	ff 34 95 20 50 80 00 	push   0x805020(,%edx,4)
+  800cf9:	e8 63 f7 ff ff       	call   800461 <sys_ipc_try_send>
+      if (r == 0)
+  800cfe:	83 c4 20             	add    $0x20,%esp
+  800d01:	85 c0                	test   %eax,%eax
+  800d03:	74 0a                	je     800d0f <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  800d05:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  800d08:	75 95                	jne    800c9f <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  800d0a:	83 c3 01             	add    $0x1,%ebx
+  800d0d:	eb c7                	jmp    800cd6 <fsipc_send+0xd8>
+  }
+}
+  800d0f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d12:	5b                   	pop    %ebx
+  800d13:	5e                   	pop    %esi
+  800d14:	5f                   	pop    %edi
+  800d15:	5d                   	pop    %ebp
+  800d16:	c3                   	ret
+
+00800d17 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  800d17:	55                   	push   %ebp
+  800d18:	89 e5                	mov    %esp,%ebp
+  800d1a:	53                   	push   %ebx
+  800d1b:	83 ec 14             	sub    $0x14,%esp
+  800d1e:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  800d20:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  800d27:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800d2c:	ba 00 60 80 00       	mov    $0x806000,%edx
+  800d31:	e8 c8 fe ff ff       	call   800bfe <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  800d36:	6a 00                	push   $0x0
+  800d38:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800d3b:	50                   	push   %eax
+  800d3c:	53                   	push   %ebx
+  800d3d:	6a 00                	push   $0x0
+  800d3f:	e8 1f 1d 00 00       	call   802a63 <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  800d44:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d47:	c9                   	leave
+  800d48:	c3                   	ret
+
+00800d49 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  800d49:	55                   	push   %ebp
+  800d4a:	89 e5                	mov    %esp,%ebp
+  800d4c:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800d4f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d52:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d55:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.set_size.req_size = newsize;
+  800d5a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d5d:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  800d62:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d67:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d6c:	e8 a6 ff ff ff       	call   800d17 <fsipc>
+}
+  800d71:	c9                   	leave
+  800d72:	c3                   	ret
+
+00800d73 <devfile_flush>:
+{
+  800d73:	55                   	push   %ebp
+  800d74:	89 e5                	mov    %esp,%ebp
+  800d76:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800d79:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d7c:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d7f:	a3 00 60 80 00       	mov    %eax,0x806000
+  return fsipc(FSREQ_FLUSH, NULL);
+  800d84:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d89:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d8e:	e8 84 ff ff ff       	call   800d17 <fsipc>
+}
+  800d93:	c9                   	leave
+  800d94:	c3                   	ret
+
+00800d95 <devfile_stat>:
+{
+  800d95:	55                   	push   %ebp
+  800d96:	89 e5                	mov    %esp,%ebp
+  800d98:	53                   	push   %ebx
+  800d99:	83 ec 04             	sub    $0x4,%esp
+  800d9c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800d9f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800da2:	8b 40 0c             	mov    0xc(%eax),%eax
+  800da5:	a3 00 60 80 00       	mov    %eax,0x806000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  800daa:	ba 00 00 00 00       	mov    $0x0,%edx
+  800daf:	b8 05 00 00 00       	mov    $0x5,%eax
+  800db4:	e8 5e ff ff ff       	call   800d17 <fsipc>
+  800db9:	85 c0                	test   %eax,%eax
+  800dbb:	78 2c                	js     800de9 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800dbd:	83 ec 08             	sub    $0x8,%esp
+  800dc0:	68 00 60 80 00       	push   $0x806000
+  800dc5:	53                   	push   %ebx
+  800dc6:	e8 68 19 00 00       	call   802733 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  800dcb:	a1 80 60 80 00       	mov    0x806080,%eax
+  800dd0:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800dd6:	a1 84 60 80 00       	mov    0x806084,%eax
+  800ddb:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  800de1:	83 c4 10             	add    $0x10,%esp
+  800de4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800de9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800dec:	c9                   	leave
+  800ded:	c3                   	ret
+
+00800dee <fsv_alloc>:
+{
+  800dee:	55                   	push   %ebp
+  800def:	89 e5                	mov    %esp,%ebp
+  800df1:	56                   	push   %esi
+  800df2:	53                   	push   %ebx
+  800df3:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  800df5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dfa:	eb 22                	jmp    800e1e <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  800dfc:	83 ec 04             	sub    $0x4,%esp
+  800dff:	6a 00                	push   $0x0
+  800e01:	6a 00                	push   $0x0
+  800e03:	6a 07                	push   $0x7
+  800e05:	50                   	push   %eax
+  800e06:	6a 00                	push   $0x0
+  800e08:	6a 04                	push   $0x4
+  800e0a:	68 40 50 80 00       	push   $0x805040
+  800e0f:	e8 e9 f7 ff ff       	call   8005fd <sysbatch_add>
+  800e14:	83 c4 20             	add    $0x20,%esp
+  800e17:	85 c0                	test   %eax,%eax
+  800e19:	78 48                	js     800e63 <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  800e1b:	83 c3 01             	add    $0x1,%ebx
+  800e1e:	39 f3                	cmp    %esi,%ebx
+  800e20:	74 31                	je     800e53 <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  800e22:	89 d8                	mov    %ebx,%eax
+  800e24:	c1 e0 0c             	shl    $0xc,%eax
+  800e27:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  800e2c:	89 c2                	mov    %eax,%edx
+  800e2e:	c1 ea 16             	shr    $0x16,%edx
+  800e31:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800e38:	f6 c2 01             	test   $0x1,%dl
+  800e3b:	74 bf                	je     800dfc <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  800e3d:	89 c2                	mov    %eax,%edx
+  800e3f:	c1 ea 0c             	shr    $0xc,%edx
+  800e42:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800e49:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  800e4c:	83 fa 03             	cmp    $0x3,%edx
+  800e4f:	75 ab                	jne    800dfc <fsv_alloc+0xe>
+  800e51:	eb c8                	jmp    800e1b <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  800e53:	83 ec 0c             	sub    $0xc,%esp
+  800e56:	68 40 50 80 00       	push   $0x805040
+  800e5b:	e8 4d f7 ff ff       	call   8005ad <sysbatch_flush>
+  800e60:	83 c4 10             	add    $0x10,%esp
+}
+  800e63:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e66:	5b                   	pop    %ebx
+  800e67:	5e                   	pop    %esi
+  800e68:	5d                   	pop    %ebp
+  800e69:	c3                   	ret
+
+00800e6a <devfile_read>:
+{
+  800e6a:	55                   	push   %ebp
+  800e6b:	89 e5                	mov    %esp,%ebp
+  800e6d:	57                   	push   %edi
+  800e6e:	56                   	push   %esi
+  800e6f:	53                   	push   %ebx
+  800e70:	83 ec 3c             	sub    $0x3c,%esp
+  800e73:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  800e76:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  800e7c:	77 57                	ja     800ed5 <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800e7e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e81:	8b 40 0c             	mov    0xc(%eax),%eax
+  800e84:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read.req_n = n;
+  800e89:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  800e8f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e94:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e99:	e8 79 fe ff ff       	call   800d17 <fsipc>
+  800e9e:	89 c6                	mov    %eax,%esi
+  800ea0:	85 c0                	test   %eax,%eax
+  800ea2:	78 27                	js     800ecb <devfile_read+0x61>
+  assert(r <= n);
+  800ea4:	39 c3                	cmp    %eax,%ebx
+  800ea6:	0f 82 0e 02 00 00    	jb     8010ba <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  800eac:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800eb1:	0f 8f 1c 02 00 00    	jg     8010d3 <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  800eb7:	83 ec 04             	sub    $0x4,%esp
+  800eba:	50                   	push   %eax
+  800ebb:	68 00 60 80 00       	push   $0x806000
+  800ec0:	ff 75 0c             	push   0xc(%ebp)
+  800ec3:	e8 f1 19 00 00       	call   8028b9 <memmove>
+  return r;
+  800ec8:	83 c4 10             	add    $0x10,%esp
+}
+  800ecb:	89 f0                	mov    %esi,%eax
+  800ecd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ed0:	5b                   	pop    %ebx
+  800ed1:	5e                   	pop    %esi
+  800ed2:	5f                   	pop    %edi
+  800ed3:	5d                   	pop    %ebp
+  800ed4:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  800ed5:	b8 01 00 00 00       	mov    $0x1,%eax
+  800eda:	e8 0f ff ff ff       	call   800dee <fsv_alloc>
+  800edf:	89 c6                	mov    %eax,%esi
+  800ee1:	85 c0                	test   %eax,%eax
+  800ee3:	78 e6                	js     800ecb <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  800ee5:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ee8:	8b 40 0c             	mov    0xc(%eax),%eax
+  800eeb:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  800ef0:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ef3:	8b 40 04             	mov    0x4(%eax),%eax
+  800ef6:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  800efb:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  800f01:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  800f08:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800f0d:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  800f12:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f17:	e8 e2 fc ff ff       	call   800bfe <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  800f1c:	6a 00                	push   $0x0
+  800f1e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800f21:	50                   	push   %eax
+  800f22:	68 00 10 c0 9f       	push   $0x9fc01000
+  800f27:	6a 00                	push   $0x0
+  800f29:	e8 35 1b 00 00       	call   802a63 <ipc_recv_pages>
+  800f2e:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  800f30:	83 c4 10             	add    $0x10,%esp
+  800f33:	85 c0                	test   %eax,%eax
+  800f35:	7e 94                	jle    800ecb <devfile_read+0x61>
+  assert(r <= n);
+  800f37:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800f3a:	39 c3                	cmp    %eax,%ebx
+  800f3c:	72 2e                	jb     800f6c <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  800f3e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f41:	8b 40 04             	mov    0x4(%eax),%eax
+  800f44:	25 ff 0f 00 00       	and    $0xfff,%eax
+  800f49:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  800f4c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800f4f:	c1 e2 0c             	shl    $0xc,%edx
+  800f52:	39 ca                	cmp    %ecx,%edx
+  800f54:	72 2f                	jb     800f85 <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  800f56:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  800f5b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  800f5e:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  800f62:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  800f67:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  800f6a:	eb 52                	jmp    800fbe <devfile_read+0x154>
+  assert(r <= n);
+  800f6c:	68 39 2f 80 00       	push   $0x802f39
+  800f71:	68 40 2f 80 00       	push   $0x802f40
+  800f76:	68 49 01 00 00       	push   $0x149
+  800f7b:	68 2e 2f 80 00       	push   $0x802f2e
+  800f80:	e8 e5 10 00 00       	call   80206a <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  800f85:	68 64 2f 80 00       	push   $0x802f64
+  800f8a:	68 40 2f 80 00       	push   $0x802f40
+  800f8f:	68 4a 01 00 00       	push   $0x14a
+  800f94:	68 2e 2f 80 00       	push   $0x802f2e
+  800f99:	e8 cc 10 00 00       	call   80206a <_panic>
+      memmove(dst + done, src + done, m);
+  800f9e:	83 ec 04             	sub    $0x4,%esp
+  800fa1:	53                   	push   %ebx
+  800fa2:	56                   	push   %esi
+  800fa3:	89 f8                	mov    %edi,%eax
+  800fa5:	03 45 0c             	add    0xc(%ebp),%eax
+  800fa8:	50                   	push   %eax
+  800fa9:	e8 0b 19 00 00       	call   8028b9 <memmove>
+  800fae:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  800fb1:	01 df                	add    %ebx,%edi
+  800fb3:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800fb6:	39 c7                	cmp    %eax,%edi
+  800fb8:	0f 83 c0 00 00 00    	jae    80107e <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  800fbe:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800fc1:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  800fc4:	89 f0                	mov    %esi,%eax
+  800fc6:	25 ff 0f 00 00       	and    $0xfff,%eax
+  800fcb:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  800fd0:	29 c3                	sub    %eax,%ebx
+  800fd2:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800fd5:	29 f8                	sub    %edi,%eax
+  800fd7:	39 c3                	cmp    %eax,%ebx
+  800fd9:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  800fdc:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  800fe2:	75 ba                	jne    800f9e <devfile_read+0x134>
+  800fe4:	89 f9                	mov    %edi,%ecx
+  800fe6:	03 4d 0c             	add    0xc(%ebp),%ecx
+  800fe9:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  800fec:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  800ff2:	75 aa                	jne    800f9e <devfile_read+0x134>
+  800ff4:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  800ffa:	77 a2                	ja     800f9e <devfile_read+0x134>
+  800ffc:	89 c8                	mov    %ecx,%eax
+  800ffe:	c1 e8 16             	shr    $0x16,%eax
+  801001:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801008:	a8 01                	test   $0x1,%al
+  80100a:	74 92                	je     800f9e <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  80100c:	89 c8                	mov    %ecx,%eax
+  80100e:	c1 e8 0c             	shr    $0xc,%eax
+  801011:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  801018:	a8 01                	test   $0x1,%al
+  80101a:	74 82                	je     800f9e <devfile_read+0x134>
+  80101c:	a9 02 08 00 00       	test   $0x802,%eax
+  801021:	0f 84 77 ff ff ff    	je     800f9e <devfile_read+0x134>
+  801027:	f6 c4 04             	test   $0x4,%ah
+  80102a:	0f 85 6e ff ff ff    	jne    800f9e <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  801030:	a1 44 57 80 00       	mov    0x805744,%eax
+  801035:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  801039:	84 c0                	test   %al,%al
+  80103b:	75 17                	jne    801054 <devfile_read+0x1ea>
+  80103d:	83 ec 08             	sub    $0x8,%esp
+  801040:	6a 01                	push   $0x1
+  801042:	6a 00                	push   $0x0
+  801044:	e8 1e f1 ff ff       	call   800167 <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  801049:	83 c4 10             	add    $0x10,%esp
+  80104c:	85 c0                	test   %eax,%eax
+  80104e:	0f 85 4a ff ff ff    	jne    800f9e <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  801054:	83 ec 04             	sub    $0x4,%esp
+  801057:	68 05 08 00 00       	push   $0x805
+  80105c:	ff 75 cc             	push   -0x34(%ebp)
+  80105f:	6a 00                	push   $0x0
+  801061:	56                   	push   %esi
+  801062:	6a 00                	push   $0x0
+  801064:	6a 05                	push   $0x5
+  801066:	68 40 50 80 00       	push   $0x805040
+  80106b:	e8 8d f5 ff ff       	call   8005fd <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  801070:	c1 e8 1f             	shr    $0x1f,%eax
+  801073:	08 45 cb             	or     %al,-0x35(%ebp)
+  801076:	83 c4 20             	add    $0x20,%esp
+  801079:	e9 33 ff ff ff       	jmp    800fb1 <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  80107e:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  801081:	83 ec 0c             	sub    $0xc,%esp
+  801084:	68 40 50 80 00       	push   $0x805040
+  801089:	e8 1f f5 ff ff       	call   8005ad <sysbatch_flush>
+  80108e:	83 c4 10             	add    $0x10,%esp
+  801091:	85 c0                	test   %eax,%eax
+  801093:	78 06                	js     80109b <devfile_read+0x231>
+  801095:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  801099:	74 14                	je     8010af <devfile_read+0x245>
+    memmove(dst, src, r);
+  80109b:	83 ec 04             	sub    $0x4,%esp
+  80109e:	ff 75 d4             	push   -0x2c(%ebp)
+  8010a1:	ff 75 d0             	push   -0x30(%ebp)
+  8010a4:	ff 75 0c             	push   0xc(%ebp)
+  8010a7:	e8 0d 18 00 00       	call   8028b9 <memmove>
+  8010ac:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  8010af:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010b2:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  8010b5:	e9 11 fe ff ff       	jmp    800ecb <devfile_read+0x61>
+  assert(r <= n);
+  8010ba:	68 39 2f 80 00       	push   $0x802f39
+  8010bf:	68 40 2f 80 00       	push   $0x802f40
+  8010c4:	68 1c 01 00 00       	push   $0x11c
+  8010c9:	68 2e 2f 80 00       	push   $0x802f2e
+  8010ce:	e8 97 0f 00 00       	call   80206a <_panic>
+  assert(r <= PGSIZE);
+  8010d3:	68 55 2f 80 00       	push   $0x802f55
+  8010d8:	68 40 2f 80 00       	push   $0x802f40
+  8010dd:	68 1d 01 00 00       	push   $0x11d
+  8010e2:	68 2e 2f 80 00       	push   $0x802f2e
+  8010e7:	e8 7e 0f 00 00       	call   80206a <_panic>
+
+008010ec <devfile_write>:
+{
+  8010ec:	55                   	push   %ebp
+  8010ed:	89 e5                	mov    %esp,%ebp
+  8010ef:	57                   	push   %edi
+  8010f0:	56                   	push   %esi
+  8010f1:	53                   	push   %ebx
+  8010f2:	83 ec 1c             	sub    $0x1c,%esp
+  8010f5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8010f8:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  8010fb:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  801100:	77 39                	ja     80113b <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801102:	8b 56 0c             	mov    0xc(%esi),%edx
+  801105:	89 15 00 60 80 00    	mov    %edx,0x806000
+  fsipcbuf.write.req_n = n;
+  80110b:	a3 04 60 80 00       	mov    %eax,0x806004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  801110:	83 ec 04             	sub    $0x4,%esp
+  801113:	50                   	push   %eax
+  801114:	ff 75 0c             	push   0xc(%ebp)
+  801117:	68 08 60 80 00       	push   $0x806008
+  80111c:	e8 98 17 00 00       	call   8028b9 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801121:	ba 00 00 00 00       	mov    $0x0,%edx
+  801126:	b8 04 00 00 00       	mov    $0x4,%eax
+  80112b:	e8 e7 fb ff ff       	call   800d17 <fsipc>
+  801130:	83 c4 10             	add    $0x10,%esp
+}
+  801133:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801136:	5b                   	pop    %ebx
+  801137:	5e                   	pop    %esi
+  801138:	5f                   	pop    %edi
+  801139:	5d                   	pop    %ebp
+  80113a:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  80113b:	ba 00 00 10 00       	mov    $0x100000,%edx
+  801140:	39 d0                	cmp    %edx,%eax
+  801142:	89 d3                	mov    %edx,%ebx
+  801144:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  801147:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  80114d:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  801150:	83 c7 01             	add    $0x1,%edi
+  801153:	89 f8                	mov    %edi,%eax
+  801155:	e8 94 fc ff ff       	call   800dee <fsv_alloc>
+  80115a:	85 c0                	test   %eax,%eax
+  80115c:	78 d5                	js     801133 <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  80115e:	83 ec 04             	sub    $0x4,%esp
+  801161:	53                   	push   %ebx
+  801162:	ff 75 0c             	push   0xc(%ebp)
+  801165:	68 00 10 c0 9f       	push   $0x9fc01000
+  80116a:	e8 4a 17 00 00       	call   8028b9 <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  80116f:	8b 46 0c             	mov    0xc(%esi),%eax
+  801172:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  801177:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  80117d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801184:	89 f9                	mov    %edi,%ecx
+  801186:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  80118b:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801190:	e8 69 fa ff ff       	call   800bfe <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801195:	6a 00                	push   $0x0
+  801197:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80119a:	50                   	push   %eax
+  80119b:	6a 00                	push   $0x0
+  80119d:	6a 00                	push   $0x0
+  80119f:	e8 bf 18 00 00       	call   802a63 <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  8011a4:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  8011a7:	eb 8a                	jmp    801133 <devfile_write+0x47>
+
+008011a9 <open>:
+{
+  8011a9:	55                   	push   %ebp
+  8011aa:	89 e5                	mov    %esp,%ebp
+  8011ac:	56                   	push   %esi
+  8011ad:	53                   	push   %ebx
+  8011ae:	83 ec 1c             	sub    $0x1c,%esp
+  8011b1:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  8011b4:	56                   	push   %esi
+  8011b5:	e8 3e 15 00 00       	call   8026f8 <strlen>
+  8011ba:	83 c4 10             	add    $0x10,%esp
+  8011bd:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8011c2:	7f 6c                	jg     801230 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  8011c4:	83 ec 0c             	sub    $0xc,%esp
+  8011c7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8011ca:	50                   	push   %eax
+  8011cb:	e8 ad f4 ff ff       	call   80067d <fd_alloc>
+  8011d0:	89 c3                	mov    %eax,%ebx
+  8011d2:	83 c4 10             	add    $0x10,%esp
+  8011d5:	85 c0                	test   %eax,%eax
+  8011d7:	78 3c                	js     801215 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  8011d9:	83 ec 08             	sub    $0x8,%esp
+  8011dc:	56                   	push   %esi
+  8011dd:	68 00 60 80 00       	push   $0x806000
+  8011e2:	e8 4c 15 00 00       	call   802733 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  8011e7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8011ea:	a3 00 64 80 00       	mov    %eax,0x806400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8011ef:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8011f2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8011f7:	e8 1b fb ff ff       	call   800d17 <fsipc>
+  8011fc:	89 c3                	mov    %eax,%ebx
+  8011fe:	83 c4 10             	add    $0x10,%esp
+  801201:	85 c0                	test   %eax,%eax
+  801203:	78 19                	js     80121e <open+0x75>
+  return fd2num(fd);
+  801205:	83 ec 0c             	sub    $0xc,%esp
+  801208:	ff 75 f4             	push   -0xc(%ebp)
+  80120b:	e8 49 f4 ff ff       	call   800659 <fd2num>
+  801210:	89 c3                	mov    %eax,%ebx
+  801212:	83 c4 10             	add    $0x10,%esp
+}
+  801215:	89 d8                	mov    %ebx,%eax
+  801217:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80121a:	5b                   	pop    %ebx
+  80121b:	5e                   	pop    %esi
+  80121c:	5d                   	pop    %ebp
+  80121d:	c3                   	ret
+    fd_close(fd, 0);
+  80121e:	83 ec 08             	sub    $0x8,%esp
+  801221:	6a 00                	push   $0x0
+  801223:	ff 75 f4             	push   -0xc(%ebp)
+  801226:	e8 44 f5 ff ff       	call   80076f <fd_close>
+    return r;
+  80122b:	83 c4 10             	add    $0x10,%esp
+  80122e:	eb e5                	jmp    801215 <open+0x6c>
+    return -E_BAD_PATH;
+  801230:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801235:	eb de                	jmp    801215 <open+0x6c>
+
+00801237 <open_read>:
+{
+  801237:	55                   	push   %ebp
+  801238:	89 e5                	mov    %esp,%ebp
+  80123a:	57                   	push   %edi
+  80123b:	56                   	push   %esi
+  80123c:	53                   	push   %ebx
+  80123d:	83 ec 28             	sub    $0x28,%esp
+  801240:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  801243:	57                   	push   %edi
+  801244:	e8 af 14 00 00       	call   8026f8 <strlen>
+  801249:	83 c4 10             	add    $0x10,%esp
+  80124c:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801251:	0f 87 f6 00 00 00    	ja     80134d <open_read+0x116>
+  801257:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  801259:	83 ec 0c             	sub    $0xc,%esp
+  80125c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80125f:	50                   	push   %eax
+  801260:	e8 18 f4 ff ff       	call   80067d <fd_alloc>
+  801265:	89 c3                	mov    %eax,%ebx
+  801267:	83 c4 10             	add    $0x10,%esp
+  80126a:	85 c0                	test   %eax,%eax
+  80126c:	0f 88 b2 00 00 00    	js     801324 <open_read+0xed>
+  strcpy(req->req_buf, path);
+  801272:	83 ec 08             	sub    $0x8,%esp
+  801275:	57                   	push   %edi
+  801276:	68 e4 60 80 00       	push   $0x8060e4
+  80127b:	e8 b3 14 00 00       	call   802733 <strcpy>
+  req->req_nops = 2;
+  801280:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  801287:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  80128a:	c7 05 04 60 80 00 01 	movl   $0x1,0x806004
+  801291:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  801294:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801297:	a3 10 60 80 00       	mov    %eax,0x806010
+  req->req_ops[0].op_buf = 0;
+  80129c:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  8012a3:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  8012a6:	c7 05 20 60 80 00 04 	movl   $0x4,0x806020
+  8012ad:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  8012b0:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  8012b7:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  8012ba:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  8012bf:	29 f0                	sub    %esi,%eax
+  8012c1:	3b 45 14             	cmp    0x14(%ebp),%eax
+  8012c4:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  8012c8:	a3 2c 60 80 00       	mov    %eax,0x80602c
+  req->req_ops[1].op_offset = 0;
+  8012cd:	c7 05 30 60 80 00 00 	movl   $0x0,0x806030
+  8012d4:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  8012d7:	83 c6 01             	add    $0x1,%esi
+  8012da:	89 35 34 60 80 00    	mov    %esi,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  8012e0:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8012e3:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8012e8:	e8 2a fa ff ff       	call   800d17 <fsipc>
+  8012ed:	89 c3                	mov    %eax,%ebx
+  8012ef:	83 c4 10             	add    $0x10,%esp
+  8012f2:	83 f8 01             	cmp    $0x1,%eax
+  8012f5:	7e 37                	jle    80132e <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  8012f7:	a1 38 60 80 00       	mov    0x806038,%eax
+  8012fc:	8b 55 18             	mov    0x18(%ebp),%edx
+  8012ff:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  801301:	83 ec 04             	sub    $0x4,%esp
+  801304:	50                   	push   %eax
+  801305:	81 c6 e4 60 80 00    	add    $0x8060e4,%esi
+  80130b:	56                   	push   %esi
+  80130c:	ff 75 10             	push   0x10(%ebp)
+  80130f:	e8 a5 15 00 00       	call   8028b9 <memmove>
+  return fd2num(fd);
+  801314:	83 c4 04             	add    $0x4,%esp
+  801317:	ff 75 e4             	push   -0x1c(%ebp)
+  80131a:	e8 3a f3 ff ff       	call   800659 <fd2num>
+  80131f:	89 c3                	mov    %eax,%ebx
+  801321:	83 c4 10             	add    $0x10,%esp
+}
+  801324:	89 d8                	mov    %ebx,%eax
+  801326:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801329:	5b                   	pop    %ebx
+  80132a:	5e                   	pop    %esi
+  80132b:	5f                   	pop    %edi
+  80132c:	5d                   	pop    %ebp
+  80132d:	c3                   	ret
+    fd_close(fd, 0);
+  80132e:	83 ec 08             	sub    $0x8,%esp
+  801331:	6a 00                	push   $0x0
+  801333:	ff 75 e4             	push   -0x1c(%ebp)
+  801336:	e8 34 f4 ff ff       	call   80076f <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  80133b:	83 c4 10             	add    $0x10,%esp
+  80133e:	85 db                	test   %ebx,%ebx
+  801340:	78 e2                	js     801324 <open_read+0xed>
+  801342:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  801345:	8b 9b 1c 60 80 00    	mov    0x80601c(%ebx),%ebx
+  80134b:	eb d7                	jmp    801324 <open_read+0xed>
+    return -E_BAD_PATH;
+  80134d:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801352:	eb d0                	jmp    801324 <open_read+0xed>
+
+00801354 <file_stat>:
+{
+  801354:	55                   	push   %ebp
+  801355:	89 e5                	mov    %esp,%ebp
+  801357:	57                   	push   %edi
+  801358:	56                   	push   %esi
+  801359:	53                   	push   %ebx
+  80135a:	83 ec 18             	sub    $0x18,%esp
+  80135d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801360:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801363:	57                   	push   %edi
+  801364:	e8 8f 13 00 00       	call   8026f8 <strlen>
+  801369:	83 c4 10             	add    $0x10,%esp
+  80136c:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801371:	0f 8f c7 00 00 00    	jg     80143e <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  801377:	83 ec 0c             	sub    $0xc,%esp
+  80137a:	57                   	push   %edi
+  80137b:	e8 78 13 00 00       	call   8026f8 <strlen>
+  801380:	8d 58 04             	lea    0x4(%eax),%ebx
+  801383:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  801386:	83 c4 08             	add    $0x8,%esp
+  801389:	57                   	push   %edi
+  80138a:	68 e4 60 80 00       	push   $0x8060e4
+  80138f:	e8 9f 13 00 00       	call   802733 <strcpy>
+  req->req_nops = 2;
+  801394:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  80139b:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  80139e:	c7 05 04 60 80 00 02 	movl   $0x2,0x806004
+  8013a5:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  8013a8:	c7 05 10 60 80 00 00 	movl   $0x0,0x806010
+  8013af:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  8013b2:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  8013b9:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  8013bc:	c7 05 20 60 80 00 03 	movl   $0x3,0x806020
+  8013c3:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  8013c6:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  8013cd:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  8013d0:	89 1d 34 60 80 00    	mov    %ebx,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  8013d6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013db:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8013e0:	e8 32 f9 ff ff       	call   800d17 <fsipc>
+  8013e5:	83 c4 10             	add    $0x10,%esp
+  8013e8:	83 f8 01             	cmp    $0x1,%eax
+  8013eb:	7e 42                	jle    80142f <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  8013ed:	81 c3 e4 60 80 00    	add    $0x8060e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  8013f3:	83 ec 08             	sub    $0x8,%esp
+  8013f6:	53                   	push   %ebx
+  8013f7:	56                   	push   %esi
+  8013f8:	e8 36 13 00 00       	call   802733 <strcpy>
+  st->st_size = ret->ret_size;
+  8013fd:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  801403:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  801409:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  80140f:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  801415:	c7 86 88 00 00 00 04 	movl   $0x804004,0x88(%esi)
+  80141c:	40 80 00 
+  return 0;
+  80141f:	83 c4 10             	add    $0x10,%esp
+  801422:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801427:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80142a:	5b                   	pop    %ebx
+  80142b:	5e                   	pop    %esi
+  80142c:	5f                   	pop    %edi
+  80142d:	5d                   	pop    %ebp
+  80142e:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  80142f:	85 c0                	test   %eax,%eax
+  801431:	78 f4                	js     801427 <file_stat+0xd3>
+  801433:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801436:	8b 80 1c 60 80 00    	mov    0x80601c(%eax),%eax
+  80143c:	eb e9                	jmp    801427 <file_stat+0xd3>
+    return -E_BAD_PATH;
+  80143e:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801443:	eb e2                	jmp    801427 <file_stat+0xd3>
+
+00801445 <read_map>:
+{
+  801445:	55                   	push   %ebp
+  801446:	89 e5                	mov    %esp,%ebp
+  801448:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80144b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80144e:	50                   	push   %eax
+  80144f:	ff 75 08             	push   0x8(%ebp)
+  801452:	e8 7c f2 ff ff       	call   8006d3 <fd_lookup>
+  801457:	83 c4 10             	add    $0x10,%esp
+  80145a:	85 c0                	test   %eax,%eax
+  80145c:	78 2a                	js     801488 <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  80145e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801461:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  801467:	39 08                	cmp    %ecx,(%eax)
+  801469:	75 1f                	jne    80148a <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  80146b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80146e:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read_map.req_offset = offset;
+  801473:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801476:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  80147b:	8b 55 10             	mov    0x10(%ebp),%edx
+  80147e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801483:	e8 8f f8 ff ff       	call   800d17 <fsipc>
+}
+  801488:	c9                   	leave
+  801489:	c3                   	ret
+    return -E_INVAL;
+  80148a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80148f:	eb f7                	jmp    801488 <read_map+0x43>
+
+00801491 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801491:	55                   	push   %ebp
+  801492:	89 e5                	mov    %esp,%ebp
+  801494:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  801497:	ba 00 00 00 00       	mov    $0x0,%edx
+  80149c:	b8 08 00 00 00       	mov    $0x8,%eax
+  8014a1:	e8 71 f8 ff ff       	call   800d17 <fsipc>
+}
+  8014a6:	c9                   	leave
+  8014a7:	c3                   	ret
+
+008014a8 <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  8014a8:	55                   	push   %ebp
+  8014a9:	89 e5                	mov    %esp,%ebp
+  8014ab:	57                   	push   %edi
+  8014ac:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  8014ad:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014b0:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.stats.req_bio_sched = 0;
+  8014b5:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  8014bc:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  8014bf:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  8014c6:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  8014c9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014ce:	b8 09 00 00 00       	mov    $0x9,%eax
+  8014d3:	e8 3f f8 ff ff       	call   800d17 <fsipc>
+  8014d8:	85 c0                	test   %eax,%eax
+  8014da:	78 14                	js     8014f0 <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  8014dc:	be 00 60 80 00       	mov    $0x806000,%esi
+  8014e1:	b9 16 00 00 00       	mov    $0x16,%ecx
+  8014e6:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8014e9:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  8014eb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8014f0:	5e                   	pop    %esi
+  8014f1:	5f                   	pop    %edi
+  8014f2:	5d                   	pop    %ebp
+  8014f3:	c3                   	ret
+
+008014f4 <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  8014f4:	55                   	push   %ebp
+  8014f5:	89 e5                	mov    %esp,%ebp
+  8014f7:	53                   	push   %ebx
+  8014f8:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  8014fb:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8014fe:	50                   	push   %eax
+  8014ff:	6a 00                	push   $0x0
+  801501:	e8 a2 ff ff ff       	call   8014a8 <fs_stats>
+  801506:	83 c4 10             	add    $0x10,%esp
+  801509:	85 c0                	test   %eax,%eax
+  80150b:	78 28                	js     801535 <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  80150d:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  801510:	83 ec 08             	sub    $0x8,%esp
+  801513:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801516:	50                   	push   %eax
+  801517:	6a 20                	push   $0x20
+  801519:	e8 8a ff ff ff       	call   8014a8 <fs_stats>
+  80151e:	83 c4 10             	add    $0x10,%esp
+  801521:	85 c0                	test   %eax,%eax
+  801523:	78 10                	js     801535 <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  801525:	83 ec 08             	sub    $0x8,%esp
+  801528:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  80152b:	50                   	push   %eax
+  80152c:	53                   	push   %ebx
+  80152d:	e8 76 ff ff ff       	call   8014a8 <fs_stats>
+  801532:	83 c4 10             	add    $0x10,%esp
+}
+  801535:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801538:	c9                   	leave
+  801539:	c3                   	ret
+
+0080153a <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  80153a:	55                   	push   %ebp
+  80153b:	89 e5                	mov    %esp,%ebp
+  80153d:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  801540:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  801547:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  80154a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80154d:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.stats.req_dcache = 0;
+  801552:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  801559:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  80155c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801561:	b8 09 00 00 00       	mov    $0x9,%eax
+  801566:	e8 ac f7 ff ff       	call   800d17 <fsipc>
+}
+  80156b:	c9                   	leave
+  80156c:	c3                   	ret
+
+0080156d <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  80156d:	55                   	push   %ebp
+  80156e:	89 e5                	mov    %esp,%ebp
+  801570:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  801573:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  80157a:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  80157d:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  801584:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  801587:	8b 45 08             	mov    0x8(%ebp),%eax
+  80158a:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_STATS, NULL);
+  80158f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801594:	b8 09 00 00 00       	mov    $0x9,%eax
+  801599:	e8 79 f7 ff ff       	call   800d17 <fsipc>
+}
+  80159e:	c9                   	leave
+  80159f:	c3                   	ret
+
+008015a0 <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  8015a0:	55                   	push   %ebp
+  8015a1:	89 e5                	mov    %esp,%ebp
+  8015a3:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8015a6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015a9:	50                   	push   %eax
+  8015aa:	ff 75 08             	push   0x8(%ebp)
+  8015ad:	e8 21 f1 ff ff       	call   8006d3 <fd_lookup>
+  8015b2:	83 c4 10             	add    $0x10,%esp
+  8015b5:	85 c0                	test   %eax,%eax
+  8015b7:	78 34                	js     8015ed <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  8015b9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015bc:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  8015c2:	39 08                	cmp    %ecx,(%eax)
+  8015c4:	75 29                	jne    8015ef <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  8015c6:	8b 40 0c             	mov    0xc(%eax),%eax
+  8015c9:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.fallocate.req_offset = offset;
+  8015ce:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8015d1:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.fallocate.req_len = len;
+  8015d6:	8b 45 10             	mov    0x10(%ebp),%eax
+  8015d9:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  8015de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015e3:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8015e8:	e8 2a f7 ff ff       	call   800d17 <fsipc>
+}
+  8015ed:	c9                   	leave
+  8015ee:	c3                   	ret
+    return -E_INVAL;
+  8015ef:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015f4:	eb f7                	jmp    8015ed <fallocate+0x4d>
+
+008015f6 <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  8015f6:	55                   	push   %ebp
+  8015f7:	89 e5                	mov    %esp,%ebp
+  8015f9:	57                   	push   %edi
+  8015fa:	56                   	push   %esi
+  8015fb:	53                   	push   %ebx
+  8015fc:	83 ec 24             	sub    $0x24,%esp
+  8015ff:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801602:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801605:	50                   	push   %eax
+  801606:	ff 75 08             	push   0x8(%ebp)
+  801609:	e8 c5 f0 ff ff       	call   8006d3 <fd_lookup>
+  80160e:	83 c4 10             	add    $0x10,%esp
+  801611:	85 c0                	test   %eax,%eax
+  801613:	78 66                	js     80167b <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  801615:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801618:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  80161e:	39 08                	cmp    %ecx,(%eax)
+  801620:	75 61                	jne    801683 <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  801622:	85 f6                	test   %esi,%esi
+  801624:	7e 50                	jle    801676 <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  801626:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  80162b:	39 de                	cmp    %ebx,%esi
+  80162d:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  801630:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801633:	8b 40 0c             	mov    0xc(%eax),%eax
+  801636:	a3 00 60 80 00       	mov    %eax,0x806000
+    fsipcbuf.prefetch.req_n = m;
+  80163b:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  801641:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  801648:	83 ec 04             	sub    $0x4,%esp
+  80164b:	57                   	push   %edi
+  80164c:	ff 75 0c             	push   0xc(%ebp)
+  80164f:	68 08 60 80 00       	push   $0x806008
+  801654:	e8 60 12 00 00       	call   8028b9 <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  801659:	ba 00 00 00 00       	mov    $0x0,%edx
+  80165e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801663:	e8 af f6 ff ff       	call   800d17 <fsipc>
+  801668:	83 c4 10             	add    $0x10,%esp
+  80166b:	85 c0                	test   %eax,%eax
+  80166d:	78 0c                	js     80167b <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  80166f:	01 7d 0c             	add    %edi,0xc(%ebp)
+  801672:	29 de                	sub    %ebx,%esi
+  801674:	eb ac                	jmp    801622 <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  801676:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80167b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80167e:	5b                   	pop    %ebx
+  80167f:	5e                   	pop    %esi
+  801680:	5f                   	pop    %edi
+  801681:	5d                   	pop    %ebp
+  801682:	c3                   	ret
+    return -E_INVAL;
+  801683:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801688:	eb f1                	jmp    80167b <prefetch+0x85>
+
+0080168a <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  80168a:	55                   	push   %ebp
+  80168b:	89 e5                	mov    %esp,%ebp
+  80168d:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  801690:	50                   	push   %eax
+  801691:	e8 d3 ef ff ff       	call   800669 <fd2data>
+  801696:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  80169b:	c9                   	leave
+  80169c:	c3                   	ret
+
+0080169d <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80169d:	55                   	push   %ebp
+  80169e:	89 e5                	mov    %esp,%ebp
+  8016a0:	56                   	push   %esi
+  8016a1:	53                   	push   %ebx
+  8016a2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  8016a5:	83 ec 0c             	sub    $0xc,%esp
+  8016a8:	ff 75 08             	push   0x8(%ebp)
+  8016ab:	e8 b9 ef ff ff       	call   800669 <fd2data>
+  8016b0:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  8016b2:	83 c4 08             	add    $0x8,%esp
+  8016b5:	68 90 2f 80 00       	push   $0x802f90
+  8016ba:	53                   	push   %ebx
+  8016bb:	e8 73 10 00 00       	call   802733 <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  8016c0:	8b 46 04             	mov    0x4(%esi),%eax
+  8016c3:	2b 06                	sub    (%esi),%eax
+  8016c5:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  8016cb:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8016d2:	00 00 00 
+  stat->st_dev = &devpipe;
+  8016d5:	c7 83 88 00 00 00 20 	movl   $0x804020,0x88(%ebx)
+  8016dc:	40 80 00 
+  return 0;
+}
+  8016df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016e4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016e7:	5b                   	pop    %ebx
+  8016e8:	5e                   	pop    %esi
+  8016e9:	5d                   	pop    %ebp
+  8016ea:	c3                   	ret
+
+008016eb <pipe_wakeup>:
+{
+  8016eb:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  8016ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016f2:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  8016f5:	85 c0                	test   %eax,%eax
+  8016f7:	75 01                	jne    8016fa <pipe_wakeup+0xf>
+  8016f9:	c3                   	ret
+{
+  8016fa:	55                   	push   %ebp
+  8016fb:	89 e5                	mov    %esp,%ebp
+  8016fd:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  801700:	6a 00                	push   $0x0
+  801702:	68 00 00 c0 ee       	push   $0xeec00000
+  801707:	52                   	push   %edx
+  801708:	e8 f9 ed ff ff       	call   800506 <sys_chan_wakeup>
+  80170d:	83 c4 10             	add    $0x10,%esp
+}
+  801710:	c9                   	leave
+  801711:	c3                   	ret
+
+00801712 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  801712:	55                   	push   %ebp
+  801713:	89 e5                	mov    %esp,%ebp
+  801715:	57                   	push   %edi
+  801716:	56                   	push   %esi
+  801717:	53                   	push   %ebx
+  801718:	83 ec 18             	sub    $0x18,%esp
+  80171b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  80171e:	57                   	push   %edi
+  80171f:	e8 45 ef ff ff       	call   800669 <fd2data>
+  801724:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  801726:	83 c4 10             	add    $0x10,%esp
+  801729:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  80172d:	74 2a                	je     801759 <devpipe_close+0x47>
+  80172f:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  801734:	89 f8                	mov    %edi,%eax
+  801736:	e8 4f ff ff ff       	call   80168a <pipe_ring>
+  80173b:	83 ec 08             	sub    $0x8,%esp
+  80173e:	01 d8                	add    %ebx,%eax
+  801740:	50                   	push   %eax
+  801741:	6a 00                	push   $0x0
+  801743:	e8 e7 ea ff ff       	call   80022f <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  801748:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80174e:	83 c4 10             	add    $0x10,%esp
+  801751:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  801757:	75 db                	jne    801734 <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  801759:	83 ec 08             	sub    $0x8,%esp
+  80175c:	57                   	push   %edi
+  80175d:	6a 00                	push   $0x0
+  80175f:	e8 cb ea ff ff       	call   80022f <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  801764:	83 c4 10             	add    $0x10,%esp
+  801767:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  80176b:	75 13                	jne    801780 <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  80176d:	83 ec 08             	sub    $0x8,%esp
+  801770:	56                   	push   %esi
+  801771:	6a 00                	push   $0x0
+  801773:	e8 b7 ea ff ff       	call   80022f <sys_page_unmap>
+}
+  801778:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80177b:	5b                   	pop    %ebx
+  80177c:	5e                   	pop    %esi
+  80177d:	5f                   	pop    %edi
+  80177e:	5d                   	pop    %ebp
+  80177f:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  801780:	8d 56 04             	lea    0x4(%esi),%edx
+  801783:	8d 46 2c             	lea    0x2c(%esi),%eax
+  801786:	e8 60 ff ff ff       	call   8016eb <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  80178b:	8d 46 30             	lea    0x30(%esi),%eax
+  80178e:	89 f2                	mov    %esi,%edx
+  801790:	e8 56 ff ff ff       	call   8016eb <pipe_wakeup>
+  801795:	eb d6                	jmp    80176d <devpipe_close+0x5b>
+
+00801797 <_pipeisclosed>:
+{
+  801797:	55                   	push   %ebp
+  801798:	89 e5                	mov    %esp,%ebp
+  80179a:	57                   	push   %edi
+  80179b:	56                   	push   %esi
+  80179c:	53                   	push   %ebx
+  80179d:	83 ec 1c             	sub    $0x1c,%esp
+  8017a0:	89 c7                	mov    %eax,%edi
+  8017a2:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  8017a4:	a1 44 57 80 00       	mov    0x805744,%eax
+  8017a9:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  8017ac:	83 ec 0c             	sub    $0xc,%esp
+  8017af:	57                   	push   %edi
+  8017b0:	e8 11 14 00 00       	call   802bc6 <pageref>
+  8017b5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8017b8:	89 34 24             	mov    %esi,(%esp)
+  8017bb:	e8 06 14 00 00       	call   802bc6 <pageref>
+    nn = thisenv->env_runs;
+  8017c0:	8b 15 44 57 80 00    	mov    0x805744,%edx
+  8017c6:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  8017c9:	83 c4 10             	add    $0x10,%esp
+  8017cc:	39 cb                	cmp    %ecx,%ebx
+  8017ce:	74 1b                	je     8017eb <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  8017d0:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8017d3:	75 cf                	jne    8017a4 <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8017d5:	8b 42 58             	mov    0x58(%edx),%eax
+  8017d8:	6a 01                	push   $0x1
+  8017da:	50                   	push   %eax
+  8017db:	53                   	push   %ebx
+  8017dc:	68 97 2f 80 00       	push   $0x802f97
+  8017e1:	e8 5f 09 00 00       	call   802145 <cprintf>
+  8017e6:	83 c4 10             	add    $0x10,%esp
+  8017e9:	eb b9                	jmp    8017a4 <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  8017eb:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8017ee:	0f 94 c0             	sete   %al
+  8017f1:	0f b6 c0             	movzbl %al,%eax
+}
+  8017f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017f7:	5b                   	pop    %ebx
+  8017f8:	5e                   	pop    %esi
+  8017f9:	5f                   	pop    %edi
+  8017fa:	5d                   	pop    %ebp
+  8017fb:	c3                   	ret
+
+008017fc <devpipe_write_bulk>:
+{
+  8017fc:	55                   	push   %ebp
+  8017fd:	89 e5                	mov    %esp,%ebp
+  8017ff:	57                   	push   %edi
+  801800:	56                   	push   %esi
+  801801:	53                   	push   %ebx
+  801802:	83 ec 1c             	sub    $0x1c,%esp
+  801805:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801808:	89 d6                	mov    %edx,%esi
+  80180a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  80180d:	e8 78 fe ff ff       	call   80168a <pipe_ring>
+  801812:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  801815:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  80181a:	8d 46 04             	lea    0x4(%esi),%eax
+  80181d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  801820:	eb 75                	jmp    801897 <devpipe_write_bulk+0x9b>
+  801822:	b8 01 00 00 00       	mov    $0x1,%eax
+  801827:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  80182b:	6a 64                	push   $0x64
+  80182d:	68 00 00 c0 ee       	push   $0xeec00000
+  801832:	53                   	push   %ebx
+  801833:	56                   	push   %esi
+  801834:	e8 aa ec ff ff       	call   8004e3 <sys_chan_sleep>
+      continue;
+  801839:	83 c4 10             	add    $0x10,%esp
+  80183c:	eb 59                	jmp    801897 <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  80183e:	89 d1                	mov    %edx,%ecx
+  801840:	c1 f9 1f             	sar    $0x1f,%ecx
+  801843:	c1 e9 11             	shr    $0x11,%ecx
+  801846:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  801849:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  80184e:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  801850:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  801856:	29 d3                	sub    %edx,%ebx
+  801858:	ba 00 80 00 00       	mov    $0x8000,%edx
+  80185d:	29 c2                	sub    %eax,%edx
+  80185f:	39 d3                	cmp    %edx,%ebx
+  801861:	0f 47 da             	cmova  %edx,%ebx
+  801864:	8b 55 08             	mov    0x8(%ebp),%edx
+  801867:	29 fa                	sub    %edi,%edx
+  801869:	39 d3                	cmp    %edx,%ebx
+  80186b:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  80186e:	83 ec 04             	sub    $0x4,%esp
+  801871:	53                   	push   %ebx
+  801872:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801875:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  801878:	52                   	push   %edx
+  801879:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80187c:	01 c8                	add    %ecx,%eax
+  80187e:	50                   	push   %eax
+  80187f:	e8 97 10 00 00       	call   80291b <memcpy>
+    i += m;
+  801884:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  801886:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  801889:	8d 46 2c             	lea    0x2c(%esi),%eax
+  80188c:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80188f:	e8 57 fe ff ff       	call   8016eb <pipe_wakeup>
+  801894:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  801897:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  80189a:	73 2b                	jae    8018c7 <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  80189c:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  80189e:	8b 56 04             	mov    0x4(%esi),%edx
+  8018a1:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  8018a7:	39 d0                	cmp    %edx,%eax
+  8018a9:	7d 93                	jge    80183e <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  8018ab:	89 f2                	mov    %esi,%edx
+  8018ad:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8018b0:	e8 e2 fe ff ff       	call   801797 <_pipeisclosed>
+  8018b5:	85 c0                	test   %eax,%eax
+  8018b7:	0f 84 65 ff ff ff    	je     801822 <devpipe_write_bulk+0x26>
+        return i;
+  8018bd:	89 f8                	mov    %edi,%eax
+}
+  8018bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018c2:	5b                   	pop    %ebx
+  8018c3:	5e                   	pop    %esi
+  8018c4:	5f                   	pop    %edi
+  8018c5:	5d                   	pop    %ebp
+  8018c6:	c3                   	ret
+  return i;
+  8018c7:	89 f8                	mov    %edi,%eax
+  8018c9:	eb f4                	jmp    8018bf <devpipe_write_bulk+0xc3>
+
+008018cb <devpipe_write>:
+{
+  8018cb:	55                   	push   %ebp
+  8018cc:	89 e5                	mov    %esp,%ebp
+  8018ce:	57                   	push   %edi
+  8018cf:	56                   	push   %esi
+  8018d0:	53                   	push   %ebx
+  8018d1:	83 ec 28             	sub    $0x28,%esp
+  8018d4:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  8018d7:	56                   	push   %esi
+  8018d8:	e8 8c ed ff ff       	call   800669 <fd2data>
+  8018dd:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  8018df:	8b 78 28             	mov    0x28(%eax),%edi
+  8018e2:	83 c4 10             	add    $0x10,%esp
+  8018e5:	85 ff                	test   %edi,%edi
+  8018e7:	75 25                	jne    80190e <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  8018e9:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8018ec:	74 66                	je     801954 <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8018ee:	8b 43 04             	mov    0x4(%ebx),%eax
+  8018f1:	8b 0b                	mov    (%ebx),%ecx
+  8018f3:	8d 51 20             	lea    0x20(%ecx),%edx
+  8018f6:	39 d0                	cmp    %edx,%eax
+  8018f8:	72 2b                	jb     801925 <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  8018fa:	89 da                	mov    %ebx,%edx
+  8018fc:	89 f0                	mov    %esi,%eax
+  8018fe:	e8 94 fe ff ff       	call   801797 <_pipeisclosed>
+  801903:	85 c0                	test   %eax,%eax
+  801905:	75 51                	jne    801958 <devpipe_write+0x8d>
+      sys_yield();
+  801907:	e8 3c e8 ff ff       	call   800148 <sys_yield>
+  80190c:	eb e0                	jmp    8018ee <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  80190e:	83 ec 0c             	sub    $0xc,%esp
+  801911:	ff 75 10             	push   0x10(%ebp)
+  801914:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801917:	89 c2                	mov    %eax,%edx
+  801919:	89 f0                	mov    %esi,%eax
+  80191b:	e8 dc fe ff ff       	call   8017fc <devpipe_write_bulk>
+  801920:	83 c4 10             	add    $0x10,%esp
+  801923:	eb 38                	jmp    80195d <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801925:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801928:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  80192c:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  80192f:	89 c2                	mov    %eax,%edx
+  801931:	c1 fa 1f             	sar    $0x1f,%edx
+  801934:	89 d1                	mov    %edx,%ecx
+  801936:	c1 e9 1b             	shr    $0x1b,%ecx
+  801939:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80193c:	83 e2 1f             	and    $0x1f,%edx
+  80193f:	29 ca                	sub    %ecx,%edx
+  801941:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  801945:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  801949:	83 c0 01             	add    $0x1,%eax
+  80194c:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  80194f:	83 c7 01             	add    $0x1,%edi
+  801952:	eb 95                	jmp    8018e9 <devpipe_write+0x1e>
+  return i;
+  801954:	89 f8                	mov    %edi,%eax
+  801956:	eb 05                	jmp    80195d <devpipe_write+0x92>
+        return 0;
+  801958:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80195d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801960:	5b                   	pop    %ebx
+  801961:	5e                   	pop    %esi
+  801962:	5f                   	pop    %edi
+  801963:	5d                   	pop    %ebp
+  801964:	c3                   	ret
+
+00801965 <devpipe_read_bulk>:
+{
+  801965:	55                   	push   %ebp
+  801966:	89 e5                	mov    %esp,%ebp
+  801968:	57                   	push   %edi
+  801969:	56                   	push   %esi
+  80196a:	53                   	push   %ebx
+  80196b:	83 ec 2c             	sub    $0x2c,%esp
+  80196e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801971:	89 d6                	mov    %edx,%esi
+  801973:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801976:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  801979:	e8 0c fd ff ff       	call   80168a <pipe_ring>
+  80197e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  801981:	85 db                	test   %ebx,%ebx
+  801983:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801988:	0f 45 c3             	cmovne %ebx,%eax
+  80198b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80198e:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  801993:	8d 46 30             	lea    0x30(%esi),%eax
+  801996:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  801999:	eb 50                	jmp    8019eb <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  80199b:	89 d1                	mov    %edx,%ecx
+  80199d:	c1 f9 1f             	sar    $0x1f,%ecx
+  8019a0:	c1 e9 11             	shr    $0x11,%ecx
+  8019a3:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  8019a6:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8019ab:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  8019ad:	29 d3                	sub    %edx,%ebx
+  8019af:	ba 00 80 00 00       	mov    $0x8000,%edx
+  8019b4:	29 c2                	sub    %eax,%edx
+  8019b6:	39 d3                	cmp    %edx,%ebx
+  8019b8:	0f 47 da             	cmova  %edx,%ebx
+  8019bb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019be:	29 fa                	sub    %edi,%edx
+  8019c0:	39 d3                	cmp    %edx,%ebx
+  8019c2:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  8019c5:	83 ec 04             	sub    $0x4,%esp
+  8019c8:	53                   	push   %ebx
+  8019c9:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8019cc:	01 c8                	add    %ecx,%eax
+  8019ce:	50                   	push   %eax
+  8019cf:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8019d2:	01 f8                	add    %edi,%eax
+  8019d4:	50                   	push   %eax
+  8019d5:	e8 41 0f 00 00       	call   80291b <memcpy>
+    i += m;
+  8019da:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  8019dc:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8019de:	89 f2                	mov    %esi,%edx
+  8019e0:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8019e3:	e8 03 fd ff ff       	call   8016eb <pipe_wakeup>
+  8019e8:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  8019eb:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  8019ee:	73 51                	jae    801a41 <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  8019f0:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  8019f3:	8b 16                	mov    (%esi),%edx
+  8019f5:	39 da                	cmp    %ebx,%edx
+  8019f7:	75 a2                	jne    80199b <devpipe_read_bulk+0x36>
+      if (i > 0)
+  8019f9:	85 ff                	test   %edi,%edi
+  8019fb:	75 44                	jne    801a41 <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  8019fd:	89 f2                	mov    %esi,%edx
+  8019ff:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801a02:	e8 90 fd ff ff       	call   801797 <_pipeisclosed>
+  801a07:	85 c0                	test   %eax,%eax
+  801a09:	75 3a                	jne    801a45 <devpipe_read_bulk+0xe0>
+  801a0b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a10:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  801a14:	6a 64                	push   $0x64
+  801a16:	ff 75 d4             	push   -0x2c(%ebp)
+  801a19:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  801a1a:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  801a1d:	50                   	push   %eax
+  801a1e:	e8 c0 ea ff ff       	call   8004e3 <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  801a23:	85 c0                	test   %eax,%eax
+  801a25:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a2a:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  801a2d:	83 c4 10             	add    $0x10,%esp
+  801a30:	a8 01                	test   $0x1,%al
+  801a32:	74 b7                	je     8019eb <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  801a34:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  801a39:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a3c:	5b                   	pop    %ebx
+  801a3d:	5e                   	pop    %esi
+  801a3e:	5f                   	pop    %edi
+  801a3f:	5d                   	pop    %ebp
+  801a40:	c3                   	ret
+  return i;
+  801a41:	89 f8                	mov    %edi,%eax
+  801a43:	eb f4                	jmp    801a39 <devpipe_read_bulk+0xd4>
+        return 0;
+  801a45:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a4a:	eb ed                	jmp    801a39 <devpipe_read_bulk+0xd4>
+
+00801a4c <devpipe_read>:
+{
+  801a4c:	55                   	push   %ebp
+  801a4d:	89 e5                	mov    %esp,%ebp
+  801a4f:	57                   	push   %edi
+  801a50:	56                   	push   %esi
+  801a51:	53                   	push   %ebx
+  801a52:	83 ec 18             	sub    $0x18,%esp
+  801a55:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  801a58:	57                   	push   %edi
+  801a59:	e8 0b ec ff ff       	call   800669 <fd2data>
+  801a5e:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  801a60:	8b 70 28             	mov    0x28(%eax),%esi
+  801a63:	83 c4 10             	add    $0x10,%esp
+  801a66:	85 f6                	test   %esi,%esi
+  801a68:	75 24                	jne    801a8e <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  801a6a:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801a6d:	74 60                	je     801acf <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  801a6f:	8b 03                	mov    (%ebx),%eax
+  801a71:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801a74:	75 3b                	jne    801ab1 <devpipe_read+0x65>
+      if (i > 0)
+  801a76:	85 f6                	test   %esi,%esi
+  801a78:	75 2d                	jne    801aa7 <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  801a7a:	89 da                	mov    %ebx,%edx
+  801a7c:	89 f8                	mov    %edi,%eax
+  801a7e:	e8 14 fd ff ff       	call   801797 <_pipeisclosed>
+  801a83:	85 c0                	test   %eax,%eax
+  801a85:	75 4c                	jne    801ad3 <devpipe_read+0x87>
+      sys_yield();
+  801a87:	e8 bc e6 ff ff       	call   800148 <sys_yield>
+  801a8c:	eb e1                	jmp    801a6f <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  801a8e:	83 ec 08             	sub    $0x8,%esp
+  801a91:	6a 00                	push   $0x0
+  801a93:	ff 75 10             	push   0x10(%ebp)
+  801a96:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a99:	89 c2                	mov    %eax,%edx
+  801a9b:	89 f8                	mov    %edi,%eax
+  801a9d:	e8 c3 fe ff ff       	call   801965 <devpipe_read_bulk>
+  801aa2:	83 c4 10             	add    $0x10,%esp
+  801aa5:	eb 02                	jmp    801aa9 <devpipe_read+0x5d>
+        return i;
+  801aa7:	89 f0                	mov    %esi,%eax
+}
+  801aa9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801aac:	5b                   	pop    %ebx
+  801aad:	5e                   	pop    %esi
+  801aae:	5f                   	pop    %edi
+  801aaf:	5d                   	pop    %ebp
+  801ab0:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801ab1:	99                   	cltd
+  801ab2:	c1 ea 1b             	shr    $0x1b,%edx
+  801ab5:	01 d0                	add    %edx,%eax
+  801ab7:	83 e0 1f             	and    $0x1f,%eax
+  801aba:	29 d0                	sub    %edx,%eax
+  801abc:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801ac1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ac4:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  801ac7:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  801aca:	83 c6 01             	add    $0x1,%esi
+  801acd:	eb 9b                	jmp    801a6a <devpipe_read+0x1e>
+  return i;
+  801acf:	89 f0                	mov    %esi,%eax
+  801ad1:	eb d6                	jmp    801aa9 <devpipe_read+0x5d>
+        return 0;
+  801ad3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ad8:	eb cf                	jmp    801aa9 <devpipe_read+0x5d>
+
+00801ada <pipe2>:
+{
+  801ada:	55                   	push   %ebp
+  801adb:	89 e5                	mov    %esp,%ebp
+  801add:	57                   	push   %edi
+  801ade:	56                   	push   %esi
+  801adf:	53                   	push   %ebx
+  801ae0:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  801ae3:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801ae6:	50                   	push   %eax
+  801ae7:	e8 91 eb ff ff       	call   80067d <fd_alloc>
+  801aec:	89 c3                	mov    %eax,%ebx
+  801aee:	83 c4 10             	add    $0x10,%esp
+  801af1:	85 c0                	test   %eax,%eax
+  801af3:	0f 88 fb 01 00 00    	js     801cf4 <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801af9:	83 ec 04             	sub    $0x4,%esp
+  801afc:	68 07 04 00 00       	push   $0x407
+  801b01:	ff 75 e4             	push   -0x1c(%ebp)
+  801b04:	6a 00                	push   $0x0
+  801b06:	e8 9f e6 ff ff       	call   8001aa <sys_page_alloc>
+  801b0b:	89 c3                	mov    %eax,%ebx
+  801b0d:	83 c4 10             	add    $0x10,%esp
+  801b10:	85 c0                	test   %eax,%eax
+  801b12:	0f 88 dc 01 00 00    	js     801cf4 <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  801b18:	83 ec 0c             	sub    $0xc,%esp
+  801b1b:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801b1e:	50                   	push   %eax
+  801b1f:	e8 59 eb ff ff       	call   80067d <fd_alloc>
+  801b24:	89 c3                	mov    %eax,%ebx
+  801b26:	83 c4 10             	add    $0x10,%esp
+  801b29:	85 c0                	test   %eax,%eax
+  801b2b:	0f 88 b3 01 00 00    	js     801ce4 <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801b31:	83 ec 04             	sub    $0x4,%esp
+  801b34:	68 07 04 00 00       	push   $0x407
+  801b39:	ff 75 e0             	push   -0x20(%ebp)
+  801b3c:	6a 00                	push   $0x0
+  801b3e:	e8 67 e6 ff ff       	call   8001aa <sys_page_alloc>
+  801b43:	89 c3                	mov    %eax,%ebx
+  801b45:	83 c4 10             	add    $0x10,%esp
+  801b48:	85 c0                	test   %eax,%eax
+  801b4a:	0f 88 94 01 00 00    	js     801ce4 <pipe2+0x20a>
+  va = fd2data(fd0);
+  801b50:	83 ec 0c             	sub    $0xc,%esp
+  801b53:	ff 75 e4             	push   -0x1c(%ebp)
+  801b56:	e8 0e eb ff ff       	call   800669 <fd2data>
+  801b5b:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801b5d:	83 c4 0c             	add    $0xc,%esp
+  801b60:	68 07 04 00 00       	push   $0x407
+  801b65:	50                   	push   %eax
+  801b66:	6a 00                	push   $0x0
+  801b68:	e8 3d e6 ff ff       	call   8001aa <sys_page_alloc>
+  801b6d:	89 c3                	mov    %eax,%ebx
+  801b6f:	83 c4 10             	add    $0x10,%esp
+  801b72:	85 c0                	test   %eax,%eax
+  801b74:	0f 88 5a 01 00 00    	js     801cd4 <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801b7a:	83 ec 0c             	sub    $0xc,%esp
+  801b7d:	ff 75 e0             	push   -0x20(%ebp)
+  801b80:	e8 e4 ea ff ff       	call   800669 <fd2data>
+  801b85:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  801b8c:	50                   	push   %eax
+  801b8d:	6a 00                	push   $0x0
+  801b8f:	57                   	push   %edi
+  801b90:	6a 00                	push   $0x0
+  801b92:	e8 56 e6 ff ff       	call   8001ed <sys_page_map>
+  801b97:	89 c3                	mov    %eax,%ebx
+  801b99:	83 c4 20             	add    $0x20,%esp
+  801b9c:	85 c0                	test   %eax,%eax
+  801b9e:	0f 88 22 01 00 00    	js     801cc6 <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  801ba4:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  801ba8:	74 72                	je     801c1c <pipe2+0x142>
+  801baa:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  801baf:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801bb2:	e8 d3 fa ff ff       	call   80168a <pipe_ring>
+  801bb7:	83 ec 04             	sub    $0x4,%esp
+  801bba:	68 07 04 00 00       	push   $0x407
+  801bbf:	01 f0                	add    %esi,%eax
+  801bc1:	50                   	push   %eax
+  801bc2:	6a 00                	push   $0x0
+  801bc4:	e8 e1 e5 ff ff       	call   8001aa <sys_page_alloc>
+  801bc9:	89 c3                	mov    %eax,%ebx
+  801bcb:	83 c4 10             	add    $0x10,%esp
+  801bce:	85 c0                	test   %eax,%eax
+  801bd0:	0f 88 97 00 00 00    	js     801c6d <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  801bd6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801bd9:	e8 ac fa ff ff       	call   80168a <pipe_ring>
+  801bde:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  801be1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801be4:	e8 a1 fa ff ff       	call   80168a <pipe_ring>
+  801be9:	83 ec 0c             	sub    $0xc,%esp
+  801bec:	68 07 04 00 00       	push   $0x407
+  801bf1:	53                   	push   %ebx
+  801bf2:	6a 00                	push   $0x0
+  801bf4:	01 f0                	add    %esi,%eax
+  801bf6:	50                   	push   %eax
+  801bf7:	6a 00                	push   $0x0
+  801bf9:	e8 ef e5 ff ff       	call   8001ed <sys_page_map>
+  801bfe:	89 c3                	mov    %eax,%ebx
+  801c00:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801c06:	83 c4 20             	add    $0x20,%esp
+  801c09:	85 c0                	test   %eax,%eax
+  801c0b:	78 60                	js     801c6d <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  801c0d:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  801c13:	75 9a                	jne    801baf <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  801c15:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  801c1c:	a1 20 40 80 00       	mov    0x804020,%eax
+  801c21:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801c24:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  801c26:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801c29:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  801c30:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801c33:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  801c35:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801c38:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  801c3f:	83 ec 0c             	sub    $0xc,%esp
+  801c42:	ff 75 e4             	push   -0x1c(%ebp)
+  801c45:	e8 0f ea ff ff       	call   800659 <fd2num>
+  801c4a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801c4d:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  801c4f:	83 c4 04             	add    $0x4,%esp
+  801c52:	ff 75 e0             	push   -0x20(%ebp)
+  801c55:	e8 ff e9 ff ff       	call   800659 <fd2num>
+  801c5a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801c5d:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  801c60:	83 c4 10             	add    $0x10,%esp
+  801c63:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c68:	e9 87 00 00 00       	jmp    801cf4 <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  801c6d:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  801c72:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801c75:	e8 10 fa ff ff       	call   80168a <pipe_ring>
+  801c7a:	83 ec 08             	sub    $0x8,%esp
+  801c7d:	01 f0                	add    %esi,%eax
+  801c7f:	50                   	push   %eax
+  801c80:	6a 00                	push   $0x0
+  801c82:	e8 a8 e5 ff ff       	call   80022f <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  801c87:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801c8a:	e8 fb f9 ff ff       	call   80168a <pipe_ring>
+  801c8f:	83 c4 08             	add    $0x8,%esp
+  801c92:	01 f0                	add    %esi,%eax
+  801c94:	50                   	push   %eax
+  801c95:	6a 00                	push   $0x0
+  801c97:	e8 93 e5 ff ff       	call   80022f <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  801c9c:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801ca2:	83 c4 10             	add    $0x10,%esp
+  801ca5:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  801cab:	75 c5                	jne    801c72 <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  801cad:	83 ec 0c             	sub    $0xc,%esp
+  801cb0:	ff 75 e0             	push   -0x20(%ebp)
+  801cb3:	e8 b1 e9 ff ff       	call   800669 <fd2data>
+  801cb8:	83 c4 08             	add    $0x8,%esp
+  801cbb:	50                   	push   %eax
+  801cbc:	6a 00                	push   $0x0
+  801cbe:	e8 6c e5 ff ff       	call   80022f <sys_page_unmap>
+  801cc3:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  801cc6:	83 ec 08             	sub    $0x8,%esp
+  801cc9:	57                   	push   %edi
+  801cca:	6a 00                	push   $0x0
+  801ccc:	e8 5e e5 ff ff       	call   80022f <sys_page_unmap>
+  801cd1:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  801cd4:	83 ec 08             	sub    $0x8,%esp
+  801cd7:	ff 75 e0             	push   -0x20(%ebp)
+  801cda:	6a 00                	push   $0x0
+  801cdc:	e8 4e e5 ff ff       	call   80022f <sys_page_unmap>
+  801ce1:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  801ce4:	83 ec 08             	sub    $0x8,%esp
+  801ce7:	ff 75 e4             	push   -0x1c(%ebp)
+  801cea:	6a 00                	push   $0x0
+  801cec:	e8 3e e5 ff ff       	call   80022f <sys_page_unmap>
+  801cf1:	83 c4 10             	add    $0x10,%esp
+}
+  801cf4:	89 d8                	mov    %ebx,%eax
+  801cf6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cf9:	5b                   	pop    %ebx
+  801cfa:	5e                   	pop    %esi
+  801cfb:	5f                   	pop    %edi
+  801cfc:	5d                   	pop    %ebp
+  801cfd:	c3                   	ret
+
+00801cfe <pipe>:
+{
+  801cfe:	55                   	push   %ebp
+  801cff:	89 e5                	mov    %esp,%ebp
+  801d01:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  801d04:	6a 00                	push   $0x0
+  801d06:	ff 75 08             	push   0x8(%ebp)
+  801d09:	e8 cc fd ff ff       	call   801ada <pipe2>
+}
+  801d0e:	c9                   	leave
+  801d0f:	c3                   	ret
+
+00801d10 <pipeisclosed>:
+{
+  801d10:	55                   	push   %ebp
+  801d11:	89 e5                	mov    %esp,%ebp
+  801d13:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801d16:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d19:	50                   	push   %eax
+  801d1a:	ff 75 08             	push   0x8(%ebp)
+  801d1d:	e8 b1 e9 ff ff       	call   8006d3 <fd_lookup>
+  801d22:	83 c4 10             	add    $0x10,%esp
+  801d25:	85 c0                	test   %eax,%eax
+  801d27:	78 18                	js     801d41 <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  801d29:	83 ec 0c             	sub    $0xc,%esp
+  801d2c:	ff 75 f4             	push   -0xc(%ebp)
+  801d2f:	e8 35 e9 ff ff       	call   800669 <fd2data>
+  801d34:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  801d36:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d39:	e8 59 fa ff ff       	call   801797 <_pipeisclosed>
+  801d3e:	83 c4 10             	add    $0x10,%esp
+}
+  801d41:	c9                   	leave
+  801d42:	c3                   	ret
+
+00801d43 <pipe_splice>:
+{
+  801d43:	55                   	push   %ebp
+  801d44:	89 e5                	mov    %esp,%ebp
+  801d46:	57                   	push   %edi
+  801d47:	56                   	push   %esi
+  801d48:	53                   	push   %ebx
+  801d49:	83 ec 34             	sub    $0x34,%esp
+  801d4c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801d4f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801d52:	50                   	push   %eax
+  801d53:	ff 75 08             	push   0x8(%ebp)
+  801d56:	e8 78 e9 ff ff       	call   8006d3 <fd_lookup>
+  801d5b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801d5e:	83 c4 10             	add    $0x10,%esp
+  801d61:	85 c0                	test   %eax,%eax
+  801d63:	0f 88 d7 00 00 00    	js     801e40 <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  801d69:	83 ec 0c             	sub    $0xc,%esp
+  801d6c:	ff 75 e4             	push   -0x1c(%ebp)
+  801d6f:	e8 f5 e8 ff ff       	call   800669 <fd2data>
+  801d74:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  801d76:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801d79:	83 c4 10             	add    $0x10,%esp
+  801d7c:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801d82:	39 10                	cmp    %edx,(%eax)
+  801d84:	0f 85 c1 00 00 00    	jne    801e4b <pipe_splice+0x108>
+  801d8a:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  801d8e:	0f 84 c0 00 00 00    	je     801e54 <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  801d94:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  801d98:	0f 84 bf 00 00 00    	je     801e5d <pipe_splice+0x11a>
+  801d9e:	89 f7                	mov    %esi,%edi
+  801da0:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  801da6:	0f 85 ba 00 00 00    	jne    801e66 <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  801dac:	8d 43 04             	lea    0x4(%ebx),%eax
+  801daf:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801db2:	eb 38                	jmp    801dec <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  801db4:	83 ec 0c             	sub    $0xc,%esp
+  801db7:	68 00 10 00 00       	push   $0x1000
+  801dbc:	89 f1                	mov    %esi,%ecx
+  801dbe:	89 da                	mov    %ebx,%edx
+  801dc0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801dc3:	e8 34 fa ff ff       	call   8017fc <devpipe_write_bulk>
+  801dc8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801dcb:	83 c4 10             	add    $0x10,%esp
+  801dce:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801dd3:	75 53                	jne    801e28 <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  801dd5:	83 ec 08             	sub    $0x8,%esp
+  801dd8:	56                   	push   %esi
+  801dd9:	6a 00                	push   $0x0
+  801ddb:	e8 4f e4 ff ff       	call   80022f <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  801de0:	83 c7 01             	add    $0x1,%edi
+  801de3:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801de9:	83 c4 10             	add    $0x10,%esp
+  801dec:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801def:	74 3a                	je     801e2b <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  801df1:	8b 03                	mov    (%ebx),%eax
+  801df3:	39 43 04             	cmp    %eax,0x4(%ebx)
+  801df6:	75 bc                	jne    801db4 <pipe_splice+0x71>
+  801df8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dfd:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  801e01:	85 c0                	test   %eax,%eax
+  801e03:	74 af                	je     801db4 <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  801e05:	83 ec 04             	sub    $0x4,%esp
+  801e08:	6a 07                	push   $0x7
+  801e0a:	56                   	push   %esi
+  801e0b:	ff 75 d0             	push   -0x30(%ebp)
+  801e0e:	e8 f3 e6 ff ff       	call   800506 <sys_chan_wakeup>
+  801e13:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801e16:	83 c4 10             	add    $0x10,%esp
+  801e19:	85 c0                	test   %eax,%eax
+  801e1b:	79 b8                	jns    801dd5 <pipe_splice+0x92>
+  801e1d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e22:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  801e26:	eb 8c                	jmp    801db4 <pipe_splice+0x71>
+  801e28:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  801e2b:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801e2f:	75 06                	jne    801e37 <pipe_splice+0xf4>
+  801e31:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  801e35:	78 09                	js     801e40 <pipe_splice+0xfd>
+  return i * PGSIZE;
+  801e37:	8b 45 10             	mov    0x10(%ebp),%eax
+  801e3a:	c1 e0 0c             	shl    $0xc,%eax
+  801e3d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  801e40:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801e43:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e46:	5b                   	pop    %ebx
+  801e47:	5e                   	pop    %esi
+  801e48:	5f                   	pop    %edi
+  801e49:	5d                   	pop    %ebp
+  801e4a:	c3                   	ret
+    return -E_INVAL;
+  801e4b:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  801e52:	eb ec                	jmp    801e40 <pipe_splice+0xfd>
+  801e54:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  801e5b:	eb e3                	jmp    801e40 <pipe_splice+0xfd>
+  801e5d:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  801e64:	eb da                	jmp    801e40 <pipe_splice+0xfd>
+  801e66:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  801e6d:	eb d1                	jmp    801e40 <pipe_splice+0xfd>
+
+00801e6f <pipe_splice_read>:
+{
+  801e6f:	55                   	push   %ebp
+  801e70:	89 e5                	mov    %esp,%ebp
+  801e72:	53                   	push   %ebx
+  801e73:	83 ec 1c             	sub    $0x1c,%esp
+  801e76:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801e79:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e7c:	50                   	push   %eax
+  801e7d:	ff 75 08             	push   0x8(%ebp)
+  801e80:	e8 4e e8 ff ff       	call   8006d3 <fd_lookup>
+  801e85:	83 c4 10             	add    $0x10,%esp
+  801e88:	85 c0                	test   %eax,%eax
+  801e8a:	78 49                	js     801ed5 <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  801e8c:	83 ec 0c             	sub    $0xc,%esp
+  801e8f:	ff 75 f4             	push   -0xc(%ebp)
+  801e92:	e8 d2 e7 ff ff       	call   800669 <fd2data>
+  801e97:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  801e99:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e9c:	83 c4 10             	add    $0x10,%esp
+  801e9f:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  801ea5:	39 08                	cmp    %ecx,(%eax)
+  801ea7:	75 31                	jne    801eda <pipe_splice_read+0x6b>
+  801ea9:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  801ead:	74 32                	je     801ee1 <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  801eaf:	8b 48 08             	mov    0x8(%eax),%ecx
+  801eb2:	83 e1 03             	and    $0x3,%ecx
+  801eb5:	83 f9 01             	cmp    $0x1,%ecx
+  801eb8:	74 2e                	je     801ee8 <pipe_splice_read+0x79>
+  801eba:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  801ec0:	75 2d                	jne    801eef <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  801ec2:	83 ec 08             	sub    $0x8,%esp
+  801ec5:	53                   	push   %ebx
+  801ec6:	68 00 10 00 00       	push   $0x1000
+  801ecb:	89 d9                	mov    %ebx,%ecx
+  801ecd:	e8 93 fa ff ff       	call   801965 <devpipe_read_bulk>
+  801ed2:	83 c4 10             	add    $0x10,%esp
+}
+  801ed5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ed8:	c9                   	leave
+  801ed9:	c3                   	ret
+    return -E_INVAL;
+  801eda:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801edf:	eb f4                	jmp    801ed5 <pipe_splice_read+0x66>
+  801ee1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ee6:	eb ed                	jmp    801ed5 <pipe_splice_read+0x66>
+  801ee8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801eed:	eb e6                	jmp    801ed5 <pipe_splice_read+0x66>
+  801eef:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ef4:	eb df                	jmp    801ed5 <pipe_splice_read+0x66>
+
+00801ef6 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  801ef6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801efb:	c3                   	ret
+
+00801efc <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  801efc:	55                   	push   %ebp
+  801efd:	89 e5                	mov    %esp,%ebp
+  801eff:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  801f02:	68 af 2f 80 00       	push   $0x802faf
+  801f07:	ff 75 0c             	push   0xc(%ebp)
+  801f0a:	e8 24 08 00 00       	call   802733 <strcpy>
+  return 0;
+}
+  801f0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f14:	c9                   	leave
+  801f15:	c3                   	ret
+
+00801f16 <devcons_write>:
+{
+  801f16:	55                   	push   %ebp
+  801f17:	89 e5                	mov    %esp,%ebp
+  801f19:	57                   	push   %edi
+  801f1a:	56                   	push   %esi
+  801f1b:	53                   	push   %ebx
+  801f1c:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  801f22:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  801f27:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  801f2d:	eb 2e                	jmp    801f5d <devcons_write+0x47>
+    m = n - tot;
+  801f2f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f32:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  801f34:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801f39:	39 c3                	cmp    %eax,%ebx
+  801f3b:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  801f3e:	83 ec 04             	sub    $0x4,%esp
+  801f41:	53                   	push   %ebx
+  801f42:	89 f0                	mov    %esi,%eax
+  801f44:	03 45 0c             	add    0xc(%ebp),%eax
+  801f47:	50                   	push   %eax
+  801f48:	57                   	push   %edi
+  801f49:	e8 6b 09 00 00       	call   8028b9 <memmove>
+    sys_cputs(buf, m);
+  801f4e:	83 c4 08             	add    $0x8,%esp
+  801f51:	53                   	push   %ebx
+  801f52:	57                   	push   %edi
+  801f53:	e8 53 e1 ff ff       	call   8000ab <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  801f58:	01 de                	add    %ebx,%esi
+  801f5a:	83 c4 10             	add    $0x10,%esp
+  801f5d:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801f60:	72 cd                	jb     801f2f <devcons_write+0x19>
+}
+  801f62:	89 f0                	mov    %esi,%eax
+  801f64:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f67:	5b                   	pop    %ebx
+  801f68:	5e                   	pop    %esi
+  801f69:	5f                   	pop    %edi
+  801f6a:	5d                   	pop    %ebp
+  801f6b:	c3                   	ret
+
+00801f6c <devcons_read>:
+{
+  801f6c:	55                   	push   %ebp
+  801f6d:	89 e5                	mov    %esp,%ebp
+  801f6f:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  801f72:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f77:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801f7b:	75 07                	jne    801f84 <devcons_read+0x18>
+  801f7d:	eb 1f                	jmp    801f9e <devcons_read+0x32>
+    sys_yield();
+  801f7f:	e8 c4 e1 ff ff       	call   800148 <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  801f84:	e8 40 e1 ff ff       	call   8000c9 <sys_cgetc>
+  801f89:	85 c0                	test   %eax,%eax
+  801f8b:	74 f2                	je     801f7f <devcons_read+0x13>
+  if (c < 0)
+  801f8d:	78 0f                	js     801f9e <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  801f8f:	83 f8 04             	cmp    $0x4,%eax
+  801f92:	74 0c                	je     801fa0 <devcons_read+0x34>
+  *(char*)vbuf = c;
+  801f94:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801f97:	88 02                	mov    %al,(%edx)
+  return 1;
+  801f99:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  801f9e:	c9                   	leave
+  801f9f:	c3                   	ret
+    return 0;
+  801fa0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fa5:	eb f7                	jmp    801f9e <devcons_read+0x32>
+
+00801fa7 <cputchar>:
+{
+  801fa7:	55                   	push   %ebp
+  801fa8:	89 e5                	mov    %esp,%ebp
+  801faa:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  801fad:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fb0:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  801fb3:	6a 01                	push   $0x1
+  801fb5:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801fb8:	50                   	push   %eax
+  801fb9:	e8 ed e0 ff ff       	call   8000ab <sys_cputs>
+}
+  801fbe:	83 c4 10             	add    $0x10,%esp
+  801fc1:	c9                   	leave
+  801fc2:	c3                   	ret
+
+00801fc3 <getchar>:
+{
+  801fc3:	55                   	push   %ebp
+  801fc4:	89 e5                	mov    %esp,%ebp
+  801fc6:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  801fc9:	6a 01                	push   $0x1
+  801fcb:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801fce:	50                   	push   %eax
+  801fcf:	6a 00                	push   $0x0
+  801fd1:	e8 a8 e9 ff ff       	call   80097e <read>
+  if (r < 0)
+  801fd6:	83 c4 10             	add    $0x10,%esp
+  801fd9:	85 c0                	test   %eax,%eax
+  801fdb:	78 06                	js     801fe3 <getchar+0x20>
+  if (r < 1)
+  801fdd:	74 06                	je     801fe5 <getchar+0x22>
+  return c;
+  801fdf:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  801fe3:	c9                   	leave
+  801fe4:	c3                   	ret
+    return -E_EOF;
+  801fe5:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  801fea:	eb f7                	jmp    801fe3 <getchar+0x20>
+
+00801fec <iscons>:
+{
+  801fec:	55                   	push   %ebp
+  801fed:	89 e5                	mov    %esp,%ebp
+  801fef:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801ff2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ff5:	50                   	push   %eax
+  801ff6:	ff 75 08             	push   0x8(%ebp)
+  801ff9:	e8 d5 e6 ff ff       	call   8006d3 <fd_lookup>
+  801ffe:	83 c4 10             	add    $0x10,%esp
+  802001:	85 c0                	test   %eax,%eax
+  802003:	78 11                	js     802016 <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  802005:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802008:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  80200e:	39 10                	cmp    %edx,(%eax)
+  802010:	0f 94 c0             	sete   %al
+  802013:	0f b6 c0             	movzbl %al,%eax
+}
+  802016:	c9                   	leave
+  802017:	c3                   	ret
+
+00802018 <opencons>:
+{
+  802018:	55                   	push   %ebp
+  802019:	89 e5                	mov    %esp,%ebp
+  80201b:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  80201e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802021:	50                   	push   %eax
+  802022:	e8 56 e6 ff ff       	call   80067d <fd_alloc>
+  802027:	83 c4 10             	add    $0x10,%esp
+  80202a:	85 c0                	test   %eax,%eax
+  80202c:	78 3a                	js     802068 <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80202e:	83 ec 04             	sub    $0x4,%esp
+  802031:	68 07 04 00 00       	push   $0x407
+  802036:	ff 75 f4             	push   -0xc(%ebp)
+  802039:	6a 00                	push   $0x0
+  80203b:	e8 6a e1 ff ff       	call   8001aa <sys_page_alloc>
+  802040:	83 c4 10             	add    $0x10,%esp
+  802043:	85 c0                	test   %eax,%eax
+  802045:	78 21                	js     802068 <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  802047:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80204a:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802050:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  802052:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802055:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  80205c:	83 ec 0c             	sub    $0xc,%esp
+  80205f:	50                   	push   %eax
+  802060:	e8 f4 e5 ff ff       	call   800659 <fd2num>
+  802065:	83 c4 10             	add    $0x10,%esp
+}
+  802068:	c9                   	leave
+  802069:	c3                   	ret
+
+0080206a <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80206a:	55                   	push   %ebp
+  80206b:	89 e5                	mov    %esp,%ebp
+  80206d:	56                   	push   %esi
+  80206e:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  80206f:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  802072:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  802078:	e8 ac e0 ff ff       	call   800129 <sys_getenvid>
+  80207d:	83 ec 0c             	sub    $0xc,%esp
+  802080:	ff 75 0c             	push   0xc(%ebp)
+  802083:	ff 75 08             	push   0x8(%ebp)
+  802086:	56                   	push   %esi
+  802087:	50                   	push   %eax
+  802088:	68 bc 2f 80 00       	push   $0x802fbc
+  80208d:	e8 b3 00 00 00       	call   802145 <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  802092:	83 c4 18             	add    $0x18,%esp
+  802095:	53                   	push   %ebx
+  802096:	ff 75 10             	push   0x10(%ebp)
+  802099:	e8 56 00 00 00       	call   8020f4 <vcprintf>
+  cprintf("\n");
+  80209e:	c7 04 24 a8 2f 80 00 	movl   $0x802fa8,(%esp)
+  8020a5:	e8 9b 00 00 00       	call   802145 <cprintf>
+  8020aa:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  8020ad:	cc                   	int3
+  while (1)
+  8020ae:	eb fd                	jmp    8020ad <_panic+0x43>
+
+008020b0 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8020b0:	55                   	push   %ebp
+  8020b1:	89 e5                	mov    %esp,%ebp
+  8020b3:	53                   	push   %ebx
+  8020b4:	83 ec 04             	sub    $0x4,%esp
+  8020b7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  8020ba:	8b 13                	mov    (%ebx),%edx
+  8020bc:	8d 42 01             	lea    0x1(%edx),%eax
+  8020bf:	89 03                	mov    %eax,(%ebx)
+  8020c1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8020c4:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  8020c8:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8020cd:	74 09                	je     8020d8 <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  8020cf:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8020d3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020d6:	c9                   	leave
+  8020d7:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  8020d8:	83 ec 08             	sub    $0x8,%esp
+  8020db:	68 ff 00 00 00       	push   $0xff
+  8020e0:	8d 43 08             	lea    0x8(%ebx),%eax
+  8020e3:	50                   	push   %eax
+  8020e4:	e8 c2 df ff ff       	call   8000ab <sys_cputs>
+    b->idx = 0;
+  8020e9:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8020ef:	83 c4 10             	add    $0x10,%esp
+  8020f2:	eb db                	jmp    8020cf <putch+0x1f>
+
+008020f4 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8020f4:	55                   	push   %ebp
+  8020f5:	89 e5                	mov    %esp,%ebp
+  8020f7:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  8020fd:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  802104:	00 00 00 
+  b.cnt = 0;
+  802107:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80210e:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  802111:	ff 75 0c             	push   0xc(%ebp)
+  802114:	ff 75 08             	push   0x8(%ebp)
+  802117:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80211d:	50                   	push   %eax
+  80211e:	68 b0 20 80 00       	push   $0x8020b0
+  802123:	e8 14 01 00 00       	call   80223c <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  802128:	83 c4 08             	add    $0x8,%esp
+  80212b:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  802131:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  802137:	50                   	push   %eax
+  802138:	e8 6e df ff ff       	call   8000ab <sys_cputs>
+
+  return b.cnt;
+}
+  80213d:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  802143:	c9                   	leave
+  802144:	c3                   	ret
+
+00802145 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  802145:	55                   	push   %ebp
+  802146:	89 e5                	mov    %esp,%ebp
+  802148:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  80214b:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  80214e:	50                   	push   %eax
+  80214f:	ff 75 08             	push   0x8(%ebp)
+  802152:	e8 9d ff ff ff       	call   8020f4 <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  802157:	c9                   	leave
+  802158:	c3                   	ret
+
+00802159 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  802159:	55                   	push   %ebp
+  80215a:	89 e5                	mov    %esp,%ebp
+  80215c:	57                   	push   %edi
+  80215d:	56                   	push   %esi
+  80215e:	53                   	push   %ebx
+  80215f:	83 ec 1c             	sub    $0x1c,%esp
+  802162:	89 c7                	mov    %eax,%edi
+  802164:	89 d6                	mov    %edx,%esi
+  802166:	8b 45 08             	mov    0x8(%ebp),%eax
+  802169:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80216c:	89 d1                	mov    %edx,%ecx
+  80216e:	89 c2                	mov    %eax,%edx
+  802170:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802173:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802176:	8b 45 10             	mov    0x10(%ebp),%eax
+  802179:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  80217c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80217f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802186:	39 c2                	cmp    %eax,%edx
+  802188:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80218b:	72 3e                	jb     8021cb <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  80218d:	83 ec 0c             	sub    $0xc,%esp
+  802190:	ff 75 18             	push   0x18(%ebp)
+  802193:	83 eb 01             	sub    $0x1,%ebx
+  802196:	53                   	push   %ebx
+  802197:	50                   	push   %eax
+  802198:	83 ec 08             	sub    $0x8,%esp
+  80219b:	ff 75 e4             	push   -0x1c(%ebp)
+  80219e:	ff 75 e0             	push   -0x20(%ebp)
+  8021a1:	ff 75 dc             	push   -0x24(%ebp)
+  8021a4:	ff 75 d8             	push   -0x28(%ebp)
+  8021a7:	e8 1c 0b 00 00       	call   802cc8 <__udivdi3>
+  8021ac:	83 c4 18             	add    $0x18,%esp
+  8021af:	52                   	push   %edx
+  8021b0:	50                   	push   %eax
+  8021b1:	89 f2                	mov    %esi,%edx
+  8021b3:	89 f8                	mov    %edi,%eax
+  8021b5:	e8 9f ff ff ff       	call   802159 <printnum>
+  8021ba:	83 c4 20             	add    $0x20,%esp
+  8021bd:	eb 13                	jmp    8021d2 <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  8021bf:	83 ec 08             	sub    $0x8,%esp
+  8021c2:	56                   	push   %esi
+  8021c3:	ff 75 18             	push   0x18(%ebp)
+  8021c6:	ff d7                	call   *%edi
+  8021c8:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  8021cb:	83 eb 01             	sub    $0x1,%ebx
+  8021ce:	85 db                	test   %ebx,%ebx
+  8021d0:	7f ed                	jg     8021bf <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  8021d2:	83 ec 08             	sub    $0x8,%esp
+  8021d5:	56                   	push   %esi
+  8021d6:	83 ec 04             	sub    $0x4,%esp
+  8021d9:	ff 75 e4             	push   -0x1c(%ebp)
+  8021dc:	ff 75 e0             	push   -0x20(%ebp)
+  8021df:	ff 75 dc             	push   -0x24(%ebp)
+  8021e2:	ff 75 d8             	push   -0x28(%ebp)
+  8021e5:	e8 ff 0a 00 00       	call   802ce9 <__umoddi3>
+  8021ea:	83 c4 14             	add    $0x14,%esp
+  8021ed:	0f be 80 df 2f 80 00 	movsbl 0x802fdf(%eax),%eax
+  8021f4:	50                   	push   %eax
+  8021f5:	ff d7                	call   *%edi
+}
+  8021f7:	83 c4 10             	add    $0x10,%esp
+  8021fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021fd:	5b                   	pop    %ebx
+  8021fe:	5e                   	pop    %esi
+  8021ff:	5f                   	pop    %edi
+  802200:	5d                   	pop    %ebp
+  802201:	c3                   	ret
+
+00802202 <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  802202:	55                   	push   %ebp
+  802203:	89 e5                	mov    %esp,%ebp
+  802205:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  802208:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  80220c:	8b 10                	mov    (%eax),%edx
+  80220e:	3b 50 04             	cmp    0x4(%eax),%edx
+  802211:	73 0a                	jae    80221d <sprintputch+0x1b>
+    *b->buf++ = ch;
+  802213:	8d 4a 01             	lea    0x1(%edx),%ecx
+  802216:	89 08                	mov    %ecx,(%eax)
+  802218:	8b 45 08             	mov    0x8(%ebp),%eax
+  80221b:	88 02                	mov    %al,(%edx)
+}
+  80221d:	5d                   	pop    %ebp
+  80221e:	c3                   	ret
+
+0080221f <printfmt>:
+{
+  80221f:	55                   	push   %ebp
+  802220:	89 e5                	mov    %esp,%ebp
+  802222:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  802225:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  802228:	50                   	push   %eax
+  802229:	ff 75 10             	push   0x10(%ebp)
+  80222c:	ff 75 0c             	push   0xc(%ebp)
+  80222f:	ff 75 08             	push   0x8(%ebp)
+  802232:	e8 05 00 00 00       	call   80223c <vprintfmt>
+}
+  802237:	83 c4 10             	add    $0x10,%esp
+  80223a:	c9                   	leave
+  80223b:	c3                   	ret
+
+0080223c <vprintfmt>:
+{
+  80223c:	55                   	push   %ebp
+  80223d:	89 e5                	mov    %esp,%ebp
+  80223f:	57                   	push   %edi
+  802240:	56                   	push   %esi
+  802241:	53                   	push   %ebx
+  802242:	83 ec 2c             	sub    $0x2c,%esp
+  802245:	8b 75 08             	mov    0x8(%ebp),%esi
+  802248:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80224b:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80224e:	eb 0a                	jmp    80225a <vprintfmt+0x1e>
+      putch(ch, putdat);
+  802250:	83 ec 08             	sub    $0x8,%esp
+  802253:	53                   	push   %ebx
+  802254:	50                   	push   %eax
+  802255:	ff d6                	call   *%esi
+  802257:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  80225a:	83 c7 01             	add    $0x1,%edi
+  80225d:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  802261:	83 f8 25             	cmp    $0x25,%eax
+  802264:	74 0c                	je     802272 <vprintfmt+0x36>
+      if (ch == '\0')
+  802266:	85 c0                	test   %eax,%eax
+  802268:	75 e6                	jne    802250 <vprintfmt+0x14>
+}
+  80226a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80226d:	5b                   	pop    %ebx
+  80226e:	5e                   	pop    %esi
+  80226f:	5f                   	pop    %edi
+  802270:	5d                   	pop    %ebp
+  802271:	c3                   	ret
+    padc = ' ';
+  802272:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  802276:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  80227d:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  802284:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  80228b:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  802290:	8d 47 01             	lea    0x1(%edi),%eax
+  802293:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802296:	0f b6 17             	movzbl (%edi),%edx
+  802299:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80229c:	3c 55                	cmp    $0x55,%al
+  80229e:	0f 87 cf 03 00 00    	ja     802673 <vprintfmt+0x437>
+  8022a4:	0f b6 c0             	movzbl %al,%eax
+  8022a7:	ff 24 85 20 31 80 00 	jmp    *0x803120(,%eax,4)
+  8022ae:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  8022b1:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8022b5:	eb d9                	jmp    802290 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  8022b7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8022ba:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8022be:	eb d0                	jmp    802290 <vprintfmt+0x54>
+  8022c0:	0f b6 d2             	movzbl %dl,%edx
+  8022c3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  8022c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022cb:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  8022ce:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8022d1:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  8022d5:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  8022d8:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8022db:	83 f9 09             	cmp    $0x9,%ecx
+  8022de:	77 55                	ja     802335 <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  8022e0:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  8022e3:	eb e9                	jmp    8022ce <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  8022e5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8022e8:	8b 00                	mov    (%eax),%eax
+  8022ea:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8022ed:	8b 45 14             	mov    0x14(%ebp),%eax
+  8022f0:	8d 40 04             	lea    0x4(%eax),%eax
+  8022f3:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  8022f6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  8022f9:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8022fd:	79 91                	jns    802290 <vprintfmt+0x54>
+        width = precision, precision = -1;
+  8022ff:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802302:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802305:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80230c:	eb 82                	jmp    802290 <vprintfmt+0x54>
+      if (width < 0)
+  80230e:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802311:	85 d2                	test   %edx,%edx
+  802313:	b8 00 00 00 00       	mov    $0x0,%eax
+  802318:	0f 49 c2             	cmovns %edx,%eax
+  80231b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  80231e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  802321:	e9 6a ff ff ff       	jmp    802290 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  802326:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  802329:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  802330:	e9 5b ff ff ff       	jmp    802290 <vprintfmt+0x54>
+  802335:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802338:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80233b:	eb bc                	jmp    8022f9 <vprintfmt+0xbd>
+      lflag++;
+  80233d:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  802340:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  802343:	e9 48 ff ff ff       	jmp    802290 <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  802348:	8b 45 14             	mov    0x14(%ebp),%eax
+  80234b:	8d 78 04             	lea    0x4(%eax),%edi
+  80234e:	83 ec 08             	sub    $0x8,%esp
+  802351:	53                   	push   %ebx
+  802352:	ff 30                	push   (%eax)
+  802354:	ff d6                	call   *%esi
+      break;
+  802356:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  802359:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  80235c:	e9 b1 02 00 00       	jmp    802612 <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  802361:	8b 45 14             	mov    0x14(%ebp),%eax
+  802364:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  802367:	8b 10                	mov    (%eax),%edx
+  802369:	89 d0                	mov    %edx,%eax
+  80236b:	f7 d8                	neg    %eax
+  80236d:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  802370:	83 f8 10             	cmp    $0x10,%eax
+  802373:	7f 23                	jg     802398 <vprintfmt+0x15c>
+  802375:	8b 14 85 80 32 80 00 	mov    0x803280(,%eax,4),%edx
+  80237c:	85 d2                	test   %edx,%edx
+  80237e:	74 18                	je     802398 <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  802380:	52                   	push   %edx
+  802381:	68 52 2f 80 00       	push   $0x802f52
+  802386:	53                   	push   %ebx
+  802387:	56                   	push   %esi
+  802388:	e8 92 fe ff ff       	call   80221f <printfmt>
+  80238d:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  802390:	89 7d 14             	mov    %edi,0x14(%ebp)
+  802393:	e9 7a 02 00 00       	jmp    802612 <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  802398:	50                   	push   %eax
+  802399:	68 f7 2f 80 00       	push   $0x802ff7
+  80239e:	53                   	push   %ebx
+  80239f:	56                   	push   %esi
+  8023a0:	e8 7a fe ff ff       	call   80221f <printfmt>
+  8023a5:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  8023a8:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  8023ab:	e9 62 02 00 00       	jmp    802612 <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  8023b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8023b3:	83 c0 04             	add    $0x4,%eax
+  8023b6:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8023b9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8023bc:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  8023be:	85 c9                	test   %ecx,%ecx
+  8023c0:	b8 f0 2f 80 00       	mov    $0x802ff0,%eax
+  8023c5:	0f 45 c1             	cmovne %ecx,%eax
+  8023c8:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  8023cb:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8023cf:	7e 06                	jle    8023d7 <vprintfmt+0x19b>
+  8023d1:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8023d5:	75 0b                	jne    8023e2 <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8023d7:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8023da:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8023dd:	89 75 08             	mov    %esi,0x8(%ebp)
+  8023e0:	eb 5c                	jmp    80243e <vprintfmt+0x202>
+  8023e2:	83 ec 08             	sub    $0x8,%esp
+  8023e5:	ff 75 d0             	push   -0x30(%ebp)
+  8023e8:	ff 75 cc             	push   -0x34(%ebp)
+  8023eb:	e8 20 03 00 00       	call   802710 <strnlen>
+  8023f0:	89 c2                	mov    %eax,%edx
+  8023f2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8023f5:	29 d0                	sub    %edx,%eax
+  8023f7:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  8023fa:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8023fe:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802401:	89 75 08             	mov    %esi,0x8(%ebp)
+  802404:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  802406:	eb 0e                	jmp    802416 <vprintfmt+0x1da>
+          putch(padc, putdat);
+  802408:	83 ec 08             	sub    $0x8,%esp
+  80240b:	53                   	push   %ebx
+  80240c:	57                   	push   %edi
+  80240d:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  802410:	83 ee 01             	sub    $0x1,%esi
+  802413:	83 c4 10             	add    $0x10,%esp
+  802416:	85 f6                	test   %esi,%esi
+  802418:	7f ee                	jg     802408 <vprintfmt+0x1cc>
+  80241a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80241d:	8b 75 08             	mov    0x8(%ebp),%esi
+  802420:	85 c0                	test   %eax,%eax
+  802422:	ba 00 00 00 00       	mov    $0x0,%edx
+  802427:	0f 49 d0             	cmovns %eax,%edx
+  80242a:	29 d0                	sub    %edx,%eax
+  80242c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80242f:	eb a6                	jmp    8023d7 <vprintfmt+0x19b>
+          putch(ch, putdat);
+  802431:	83 ec 08             	sub    $0x8,%esp
+  802434:	53                   	push   %ebx
+  802435:	52                   	push   %edx
+  802436:	ff 55 08             	call   *0x8(%ebp)
+  802439:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80243c:	89 f1                	mov    %esi,%ecx
+  80243e:	8d 71 01             	lea    0x1(%ecx),%esi
+  802441:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  802445:	0f be d0             	movsbl %al,%edx
+  802448:	85 d2                	test   %edx,%edx
+  80244a:	74 28                	je     802474 <vprintfmt+0x238>
+  80244c:	85 ff                	test   %edi,%edi
+  80244e:	78 05                	js     802455 <vprintfmt+0x219>
+  802450:	83 ef 01             	sub    $0x1,%edi
+  802453:	78 30                	js     802485 <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  802455:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  802459:	74 d6                	je     802431 <vprintfmt+0x1f5>
+  80245b:	0f be c0             	movsbl %al,%eax
+  80245e:	83 e8 20             	sub    $0x20,%eax
+  802461:	83 f8 5e             	cmp    $0x5e,%eax
+  802464:	76 cb                	jbe    802431 <vprintfmt+0x1f5>
+          putch('?', putdat);
+  802466:	83 ec 08             	sub    $0x8,%esp
+  802469:	53                   	push   %ebx
+  80246a:	6a 3f                	push   $0x3f
+  80246c:	ff 55 08             	call   *0x8(%ebp)
+  80246f:	83 c4 10             	add    $0x10,%esp
+  802472:	eb c8                	jmp    80243c <vprintfmt+0x200>
+  802474:	8b 75 08             	mov    0x8(%ebp),%esi
+  802477:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80247a:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80247d:	01 d0                	add    %edx,%eax
+  80247f:	29 c8                	sub    %ecx,%eax
+  802481:	89 c7                	mov    %eax,%edi
+  802483:	eb 13                	jmp    802498 <vprintfmt+0x25c>
+  802485:	8b 75 08             	mov    0x8(%ebp),%esi
+  802488:	eb ed                	jmp    802477 <vprintfmt+0x23b>
+        putch(' ', putdat);
+  80248a:	83 ec 08             	sub    $0x8,%esp
+  80248d:	53                   	push   %ebx
+  80248e:	6a 20                	push   $0x20
+  802490:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  802492:	83 ef 01             	sub    $0x1,%edi
+  802495:	83 c4 10             	add    $0x10,%esp
+  802498:	85 ff                	test   %edi,%edi
+  80249a:	7f ee                	jg     80248a <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  80249c:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80249f:	89 45 14             	mov    %eax,0x14(%ebp)
+  8024a2:	e9 6b 01 00 00       	jmp    802612 <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  8024a7:	83 f9 01             	cmp    $0x1,%ecx
+  8024aa:	7f 1f                	jg     8024cb <vprintfmt+0x28f>
+  else if (lflag)
+  8024ac:	85 c9                	test   %ecx,%ecx
+  8024ae:	74 67                	je     802517 <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  8024b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024b3:	8b 00                	mov    (%eax),%eax
+  8024b5:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8024b8:	89 c1                	mov    %eax,%ecx
+  8024ba:	c1 f9 1f             	sar    $0x1f,%ecx
+  8024bd:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8024c0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024c3:	8d 40 04             	lea    0x4(%eax),%eax
+  8024c6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8024c9:	eb 17                	jmp    8024e2 <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  8024cb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024ce:	8b 50 04             	mov    0x4(%eax),%edx
+  8024d1:	8b 00                	mov    (%eax),%eax
+  8024d3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8024d6:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8024d9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024dc:	8d 40 08             	lea    0x8(%eax),%eax
+  8024df:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  8024e2:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8024e5:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  8024e8:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  8024ed:	85 c9                	test   %ecx,%ecx
+  8024ef:	0f 89 03 01 00 00    	jns    8025f8 <vprintfmt+0x3bc>
+        putch('-', putdat);
+  8024f5:	83 ec 08             	sub    $0x8,%esp
+  8024f8:	53                   	push   %ebx
+  8024f9:	6a 2d                	push   $0x2d
+  8024fb:	ff d6                	call   *%esi
+        num = -(long long)num;
+  8024fd:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802500:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802503:	f7 da                	neg    %edx
+  802505:	83 d1 00             	adc    $0x0,%ecx
+  802508:	f7 d9                	neg    %ecx
+  80250a:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  80250d:	bf 0a 00 00 00       	mov    $0xa,%edi
+  802512:	e9 e1 00 00 00       	jmp    8025f8 <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  802517:	8b 45 14             	mov    0x14(%ebp),%eax
+  80251a:	8b 00                	mov    (%eax),%eax
+  80251c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80251f:	89 c1                	mov    %eax,%ecx
+  802521:	c1 f9 1f             	sar    $0x1f,%ecx
+  802524:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802527:	8b 45 14             	mov    0x14(%ebp),%eax
+  80252a:	8d 40 04             	lea    0x4(%eax),%eax
+  80252d:	89 45 14             	mov    %eax,0x14(%ebp)
+  802530:	eb b0                	jmp    8024e2 <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  802532:	83 f9 01             	cmp    $0x1,%ecx
+  802535:	7f 1e                	jg     802555 <vprintfmt+0x319>
+  else if (lflag)
+  802537:	85 c9                	test   %ecx,%ecx
+  802539:	74 32                	je     80256d <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  80253b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80253e:	8b 10                	mov    (%eax),%edx
+  802540:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802545:	8d 40 04             	lea    0x4(%eax),%eax
+  802548:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  80254b:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  802550:	e9 a3 00 00 00       	jmp    8025f8 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  802555:	8b 45 14             	mov    0x14(%ebp),%eax
+  802558:	8b 10                	mov    (%eax),%edx
+  80255a:	8b 48 04             	mov    0x4(%eax),%ecx
+  80255d:	8d 40 08             	lea    0x8(%eax),%eax
+  802560:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  802563:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  802568:	e9 8b 00 00 00       	jmp    8025f8 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  80256d:	8b 45 14             	mov    0x14(%ebp),%eax
+  802570:	8b 10                	mov    (%eax),%edx
+  802572:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802577:	8d 40 04             	lea    0x4(%eax),%eax
+  80257a:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  80257d:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  802582:	eb 74                	jmp    8025f8 <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  802584:	83 f9 01             	cmp    $0x1,%ecx
+  802587:	7f 1b                	jg     8025a4 <vprintfmt+0x368>
+  else if (lflag)
+  802589:	85 c9                	test   %ecx,%ecx
+  80258b:	74 2c                	je     8025b9 <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  80258d:	8b 45 14             	mov    0x14(%ebp),%eax
+  802590:	8b 10                	mov    (%eax),%edx
+  802592:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802597:	8d 40 04             	lea    0x4(%eax),%eax
+  80259a:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  80259d:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  8025a2:	eb 54                	jmp    8025f8 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  8025a4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8025a7:	8b 10                	mov    (%eax),%edx
+  8025a9:	8b 48 04             	mov    0x4(%eax),%ecx
+  8025ac:	8d 40 08             	lea    0x8(%eax),%eax
+  8025af:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8025b2:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  8025b7:	eb 3f                	jmp    8025f8 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8025b9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8025bc:	8b 10                	mov    (%eax),%edx
+  8025be:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025c3:	8d 40 04             	lea    0x4(%eax),%eax
+  8025c6:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8025c9:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  8025ce:	eb 28                	jmp    8025f8 <vprintfmt+0x3bc>
+      putch('0', putdat);
+  8025d0:	83 ec 08             	sub    $0x8,%esp
+  8025d3:	53                   	push   %ebx
+  8025d4:	6a 30                	push   $0x30
+  8025d6:	ff d6                	call   *%esi
+      putch('x', putdat);
+  8025d8:	83 c4 08             	add    $0x8,%esp
+  8025db:	53                   	push   %ebx
+  8025dc:	6a 78                	push   $0x78
+  8025de:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  8025e0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8025e3:	8b 10                	mov    (%eax),%edx
+  8025e5:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  8025ea:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  8025ed:	8d 40 04             	lea    0x4(%eax),%eax
+  8025f0:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8025f3:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  8025f8:	83 ec 0c             	sub    $0xc,%esp
+  8025fb:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8025ff:	50                   	push   %eax
+  802600:	ff 75 e0             	push   -0x20(%ebp)
+  802603:	57                   	push   %edi
+  802604:	51                   	push   %ecx
+  802605:	52                   	push   %edx
+  802606:	89 da                	mov    %ebx,%edx
+  802608:	89 f0                	mov    %esi,%eax
+  80260a:	e8 4a fb ff ff       	call   802159 <printnum>
+      break;
+  80260f:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  802612:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  802615:	e9 40 fc ff ff       	jmp    80225a <vprintfmt+0x1e>
+  if (lflag >= 2)
+  80261a:	83 f9 01             	cmp    $0x1,%ecx
+  80261d:	7f 1b                	jg     80263a <vprintfmt+0x3fe>
+  else if (lflag)
+  80261f:	85 c9                	test   %ecx,%ecx
+  802621:	74 2c                	je     80264f <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  802623:	8b 45 14             	mov    0x14(%ebp),%eax
+  802626:	8b 10                	mov    (%eax),%edx
+  802628:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80262d:	8d 40 04             	lea    0x4(%eax),%eax
+  802630:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  802633:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  802638:	eb be                	jmp    8025f8 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  80263a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80263d:	8b 10                	mov    (%eax),%edx
+  80263f:	8b 48 04             	mov    0x4(%eax),%ecx
+  802642:	8d 40 08             	lea    0x8(%eax),%eax
+  802645:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  802648:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  80264d:	eb a9                	jmp    8025f8 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  80264f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802652:	8b 10                	mov    (%eax),%edx
+  802654:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802659:	8d 40 04             	lea    0x4(%eax),%eax
+  80265c:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  80265f:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  802664:	eb 92                	jmp    8025f8 <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  802666:	83 ec 08             	sub    $0x8,%esp
+  802669:	53                   	push   %ebx
+  80266a:	6a 25                	push   $0x25
+  80266c:	ff d6                	call   *%esi
+      break;
+  80266e:	83 c4 10             	add    $0x10,%esp
+  802671:	eb 9f                	jmp    802612 <vprintfmt+0x3d6>
+      putch('%', putdat);
+  802673:	83 ec 08             	sub    $0x8,%esp
+  802676:	53                   	push   %ebx
+  802677:	6a 25                	push   $0x25
+  802679:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  80267b:	83 c4 10             	add    $0x10,%esp
+  80267e:	89 f8                	mov    %edi,%eax
+  802680:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  802684:	74 05                	je     80268b <vprintfmt+0x44f>
+  802686:	83 e8 01             	sub    $0x1,%eax
+  802689:	eb f5                	jmp    802680 <vprintfmt+0x444>
+  80268b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80268e:	eb 82                	jmp    802612 <vprintfmt+0x3d6>
+
+00802690 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  802690:	55                   	push   %ebp
+  802691:	89 e5                	mov    %esp,%ebp
+  802693:	83 ec 18             	sub    $0x18,%esp
+  802696:	8b 45 08             	mov    0x8(%ebp),%eax
+  802699:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  80269c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80269f:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8026a3:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8026a6:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  8026ad:	85 c0                	test   %eax,%eax
+  8026af:	74 26                	je     8026d7 <vsnprintf+0x47>
+  8026b1:	85 d2                	test   %edx,%edx
+  8026b3:	7e 22                	jle    8026d7 <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8026b5:	ff 75 14             	push   0x14(%ebp)
+  8026b8:	ff 75 10             	push   0x10(%ebp)
+  8026bb:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8026be:	50                   	push   %eax
+  8026bf:	68 02 22 80 00       	push   $0x802202
+  8026c4:	e8 73 fb ff ff       	call   80223c <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  8026c9:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8026cc:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  8026cf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026d2:	83 c4 10             	add    $0x10,%esp
+}
+  8026d5:	c9                   	leave
+  8026d6:	c3                   	ret
+    return -E_INVAL;
+  8026d7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026dc:	eb f7                	jmp    8026d5 <vsnprintf+0x45>
+
+008026de <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8026de:	55                   	push   %ebp
+  8026df:	89 e5                	mov    %esp,%ebp
+  8026e1:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  8026e4:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  8026e7:	50                   	push   %eax
+  8026e8:	ff 75 10             	push   0x10(%ebp)
+  8026eb:	ff 75 0c             	push   0xc(%ebp)
+  8026ee:	ff 75 08             	push   0x8(%ebp)
+  8026f1:	e8 9a ff ff ff       	call   802690 <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  8026f6:	c9                   	leave
+  8026f7:	c3                   	ret
+
+008026f8 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8026f8:	55                   	push   %ebp
+  8026f9:	89 e5                	mov    %esp,%ebp
+  8026fb:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  8026fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  802703:	eb 03                	jmp    802708 <strlen+0x10>
+    n++;
+  802705:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  802708:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80270c:	75 f7                	jne    802705 <strlen+0xd>
+  return n;
+}
+  80270e:	5d                   	pop    %ebp
+  80270f:	c3                   	ret
+
+00802710 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  802710:	55                   	push   %ebp
+  802711:	89 e5                	mov    %esp,%ebp
+  802713:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  802716:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802719:	b8 00 00 00 00       	mov    $0x0,%eax
+  80271e:	eb 03                	jmp    802723 <strnlen+0x13>
+    n++;
+  802720:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  802723:	39 d0                	cmp    %edx,%eax
+  802725:	74 08                	je     80272f <strnlen+0x1f>
+  802727:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80272b:	75 f3                	jne    802720 <strnlen+0x10>
+  80272d:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  80272f:	89 d0                	mov    %edx,%eax
+  802731:	5d                   	pop    %ebp
+  802732:	c3                   	ret
+
+00802733 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  802733:	55                   	push   %ebp
+  802734:	89 e5                	mov    %esp,%ebp
+  802736:	53                   	push   %ebx
+  802737:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80273a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  80273d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802742:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  802746:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  802749:	83 c0 01             	add    $0x1,%eax
+  80274c:	84 d2                	test   %dl,%dl
+  80274e:	75 f2                	jne    802742 <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  802750:	89 c8                	mov    %ecx,%eax
+  802752:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802755:	c9                   	leave
+  802756:	c3                   	ret
+
+00802757 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  802757:	55                   	push   %ebp
+  802758:	89 e5                	mov    %esp,%ebp
+  80275a:	53                   	push   %ebx
+  80275b:	83 ec 10             	sub    $0x10,%esp
+  80275e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  802761:	53                   	push   %ebx
+  802762:	e8 91 ff ff ff       	call   8026f8 <strlen>
+  802767:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  80276a:	ff 75 0c             	push   0xc(%ebp)
+  80276d:	01 d8                	add    %ebx,%eax
+  80276f:	50                   	push   %eax
+  802770:	e8 be ff ff ff       	call   802733 <strcpy>
+  return dst;
+}
+  802775:	89 d8                	mov    %ebx,%eax
+  802777:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80277a:	c9                   	leave
+  80277b:	c3                   	ret
+
+0080277c <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  80277c:	55                   	push   %ebp
+  80277d:	89 e5                	mov    %esp,%ebp
+  80277f:	56                   	push   %esi
+  802780:	53                   	push   %ebx
+  802781:	8b 75 08             	mov    0x8(%ebp),%esi
+  802784:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  802787:	89 f3                	mov    %esi,%ebx
+  802789:	03 5d 10             	add    0x10(%ebp),%ebx
+  80278c:	89 f0                	mov    %esi,%eax
+  80278e:	eb 0f                	jmp    80279f <strncpy+0x23>
+    *dst++ = *src;
+  802790:	83 c0 01             	add    $0x1,%eax
+  802793:	0f b6 0a             	movzbl (%edx),%ecx
+  802796:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  802799:	80 f9 01             	cmp    $0x1,%cl
+  80279c:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  80279f:	39 d8                	cmp    %ebx,%eax
+  8027a1:	75 ed                	jne    802790 <strncpy+0x14>
+  }
+  return ret;
+}
+  8027a3:	89 f0                	mov    %esi,%eax
+  8027a5:	5b                   	pop    %ebx
+  8027a6:	5e                   	pop    %esi
+  8027a7:	5d                   	pop    %ebp
+  8027a8:	c3                   	ret
+
+008027a9 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8027a9:	55                   	push   %ebp
+  8027aa:	89 e5                	mov    %esp,%ebp
+  8027ac:	56                   	push   %esi
+  8027ad:	53                   	push   %ebx
+  8027ae:	8b 75 08             	mov    0x8(%ebp),%esi
+  8027b1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8027b4:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  8027b7:	89 f0                	mov    %esi,%eax
+  8027b9:	85 d2                	test   %edx,%edx
+  8027bb:	74 21                	je     8027de <strlcpy+0x35>
+  8027bd:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8027c1:	89 f2                	mov    %esi,%edx
+  8027c3:	eb 09                	jmp    8027ce <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  8027c5:	83 c1 01             	add    $0x1,%ecx
+  8027c8:	83 c2 01             	add    $0x1,%edx
+  8027cb:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  8027ce:	39 c2                	cmp    %eax,%edx
+  8027d0:	74 09                	je     8027db <strlcpy+0x32>
+  8027d2:	0f b6 19             	movzbl (%ecx),%ebx
+  8027d5:	84 db                	test   %bl,%bl
+  8027d7:	75 ec                	jne    8027c5 <strlcpy+0x1c>
+  8027d9:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  8027db:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  8027de:	29 f0                	sub    %esi,%eax
+}
+  8027e0:	5b                   	pop    %ebx
+  8027e1:	5e                   	pop    %esi
+  8027e2:	5d                   	pop    %ebp
+  8027e3:	c3                   	ret
+
+008027e4 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8027e4:	55                   	push   %ebp
+  8027e5:	89 e5                	mov    %esp,%ebp
+  8027e7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8027ea:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  8027ed:	eb 06                	jmp    8027f5 <strcmp+0x11>
+    p++, q++;
+  8027ef:	83 c1 01             	add    $0x1,%ecx
+  8027f2:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  8027f5:	0f b6 01             	movzbl (%ecx),%eax
+  8027f8:	84 c0                	test   %al,%al
+  8027fa:	74 04                	je     802800 <strcmp+0x1c>
+  8027fc:	3a 02                	cmp    (%edx),%al
+  8027fe:	74 ef                	je     8027ef <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  802800:	0f b6 c0             	movzbl %al,%eax
+  802803:	0f b6 12             	movzbl (%edx),%edx
+  802806:	29 d0                	sub    %edx,%eax
+}
+  802808:	5d                   	pop    %ebp
+  802809:	c3                   	ret
+
+0080280a <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80280a:	55                   	push   %ebp
+  80280b:	89 e5                	mov    %esp,%ebp
+  80280d:	53                   	push   %ebx
+  80280e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802811:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802814:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  802817:	eb 09                	jmp    802822 <strncmp+0x18>
+    n--, p++, q++;
+  802819:	83 ea 01             	sub    $0x1,%edx
+  80281c:	83 c0 01             	add    $0x1,%eax
+  80281f:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  802822:	85 d2                	test   %edx,%edx
+  802824:	74 18                	je     80283e <strncmp+0x34>
+  802826:	0f b6 18             	movzbl (%eax),%ebx
+  802829:	84 db                	test   %bl,%bl
+  80282b:	74 04                	je     802831 <strncmp+0x27>
+  80282d:	3a 19                	cmp    (%ecx),%bl
+  80282f:	74 e8                	je     802819 <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802831:	0f b6 00             	movzbl (%eax),%eax
+  802834:	0f b6 11             	movzbl (%ecx),%edx
+  802837:	29 d0                	sub    %edx,%eax
+}
+  802839:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80283c:	c9                   	leave
+  80283d:	c3                   	ret
+    return 0;
+  80283e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802843:	eb f4                	jmp    802839 <strncmp+0x2f>
+
+00802845 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  802845:	55                   	push   %ebp
+  802846:	89 e5                	mov    %esp,%ebp
+  802848:	8b 45 08             	mov    0x8(%ebp),%eax
+  80284b:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  80284f:	eb 03                	jmp    802854 <strchr+0xf>
+  802851:	83 c0 01             	add    $0x1,%eax
+  802854:	0f b6 10             	movzbl (%eax),%edx
+  802857:	84 d2                	test   %dl,%dl
+  802859:	74 06                	je     802861 <strchr+0x1c>
+    if (*s == c)
+  80285b:	38 ca                	cmp    %cl,%dl
+  80285d:	75 f2                	jne    802851 <strchr+0xc>
+  80285f:	eb 05                	jmp    802866 <strchr+0x21>
+      return (char*)s;
+  return 0;
+  802861:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802866:	5d                   	pop    %ebp
+  802867:	c3                   	ret
+
+00802868 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  802868:	55                   	push   %ebp
+  802869:	89 e5                	mov    %esp,%ebp
+  80286b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80286e:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  802872:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  802875:	38 ca                	cmp    %cl,%dl
+  802877:	74 09                	je     802882 <strfind+0x1a>
+  802879:	84 d2                	test   %dl,%dl
+  80287b:	74 05                	je     802882 <strfind+0x1a>
+  for (; *s; s++)
+  80287d:	83 c0 01             	add    $0x1,%eax
+  802880:	eb f0                	jmp    802872 <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  802882:	5d                   	pop    %ebp
+  802883:	c3                   	ret
+
+00802884 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  802884:	55                   	push   %ebp
+  802885:	89 e5                	mov    %esp,%ebp
+  802887:	57                   	push   %edi
+  802888:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80288b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  80288e:	85 c9                	test   %ecx,%ecx
+  802890:	74 20                	je     8028b2 <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  802892:	89 f8                	mov    %edi,%eax
+  802894:	09 c8                	or     %ecx,%eax
+  802896:	a8 03                	test   $0x3,%al
+  802898:	75 12                	jne    8028ac <memset+0x28>
+    c &= 0xFF;
+  80289a:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80289e:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  8028a4:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  8028a7:	fc                   	cld
+  8028a8:	f3 ab                	rep stos %eax,%es:(%edi)
+  8028aa:	eb 06                	jmp    8028b2 <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  8028ac:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8028af:	fc                   	cld
+  8028b0:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  8028b2:	89 f8                	mov    %edi,%eax
+  8028b4:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8028b7:	c9                   	leave
+  8028b8:	c3                   	ret
+
+008028b9 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8028b9:	55                   	push   %ebp
+  8028ba:	89 e5                	mov    %esp,%ebp
+  8028bc:	57                   	push   %edi
+  8028bd:	56                   	push   %esi
+  8028be:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028c1:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8028c4:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  8028c7:	39 c6                	cmp    %eax,%esi
+  8028c9:	73 32                	jae    8028fd <memmove+0x44>
+  8028cb:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8028ce:	39 d0                	cmp    %edx,%eax
+  8028d0:	73 2b                	jae    8028fd <memmove+0x44>
+    s += n;
+    d += n;
+  8028d2:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8028d5:	89 d6                	mov    %edx,%esi
+  8028d7:	09 fe                	or     %edi,%esi
+  8028d9:	09 ce                	or     %ecx,%esi
+  8028db:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8028e1:	75 0e                	jne    8028f1 <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8028e3:	83 ef 04             	sub    $0x4,%edi
+  8028e6:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8028e9:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  8028ec:	fd                   	std
+  8028ed:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8028ef:	eb 09                	jmp    8028fa <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8028f1:	83 ef 01             	sub    $0x1,%edi
+  8028f4:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  8028f7:	fd                   	std
+  8028f8:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  8028fa:	fc                   	cld
+  8028fb:	eb 1a                	jmp    802917 <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8028fd:	89 f2                	mov    %esi,%edx
+  8028ff:	09 c2                	or     %eax,%edx
+  802901:	09 ca                	or     %ecx,%edx
+  802903:	f6 c2 03             	test   $0x3,%dl
+  802906:	75 0a                	jne    802912 <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  802908:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  80290b:	89 c7                	mov    %eax,%edi
+  80290d:	fc                   	cld
+  80290e:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  802910:	eb 05                	jmp    802917 <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  802912:	89 c7                	mov    %eax,%edi
+  802914:	fc                   	cld
+  802915:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  802917:	5e                   	pop    %esi
+  802918:	5f                   	pop    %edi
+  802919:	5d                   	pop    %ebp
+  80291a:	c3                   	ret
+
+0080291b <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  80291b:	55                   	push   %ebp
+  80291c:	89 e5                	mov    %esp,%ebp
+  80291e:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  802921:	ff 75 10             	push   0x10(%ebp)
+  802924:	ff 75 0c             	push   0xc(%ebp)
+  802927:	ff 75 08             	push   0x8(%ebp)
+  80292a:	e8 8a ff ff ff       	call   8028b9 <memmove>
+}
+  80292f:	c9                   	leave
+  802930:	c3                   	ret
+
+00802931 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  802931:	55                   	push   %ebp
+  802932:	89 e5                	mov    %esp,%ebp
+  802934:	56                   	push   %esi
+  802935:	53                   	push   %ebx
+  802936:	8b 45 08             	mov    0x8(%ebp),%eax
+  802939:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  80293c:	89 c6                	mov    %eax,%esi
+  80293e:	03 75 10             	add    0x10(%ebp),%esi
+  802941:	eb 06                	jmp    802949 <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  802943:	83 c0 01             	add    $0x1,%eax
+  802946:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  802949:	39 f0                	cmp    %esi,%eax
+  80294b:	74 14                	je     802961 <memcmp+0x30>
+    if (*s1 != *s2)
+  80294d:	0f b6 08             	movzbl (%eax),%ecx
+  802950:	0f b6 1a             	movzbl (%edx),%ebx
+  802953:	38 d9                	cmp    %bl,%cl
+  802955:	74 ec                	je     802943 <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  802957:	0f b6 c1             	movzbl %cl,%eax
+  80295a:	0f b6 db             	movzbl %bl,%ebx
+  80295d:	29 d8                	sub    %ebx,%eax
+  80295f:	eb 05                	jmp    802966 <memcmp+0x35>
+  }
+
+  return 0;
+  802961:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802966:	5b                   	pop    %ebx
+  802967:	5e                   	pop    %esi
+  802968:	5d                   	pop    %ebp
+  802969:	c3                   	ret
+
+0080296a <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  80296a:	55                   	push   %ebp
+  80296b:	89 e5                	mov    %esp,%ebp
+  80296d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802970:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  802973:	89 c2                	mov    %eax,%edx
+  802975:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  802978:	eb 03                	jmp    80297d <memfind+0x13>
+  80297a:	83 c0 01             	add    $0x1,%eax
+  80297d:	39 d0                	cmp    %edx,%eax
+  80297f:	73 04                	jae    802985 <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  802981:	38 08                	cmp    %cl,(%eax)
+  802983:	75 f5                	jne    80297a <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  802985:	5d                   	pop    %ebp
+  802986:	c3                   	ret
+
+00802987 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  802987:	55                   	push   %ebp
+  802988:	89 e5                	mov    %esp,%ebp
+  80298a:	57                   	push   %edi
+  80298b:	56                   	push   %esi
+  80298c:	53                   	push   %ebx
+  80298d:	8b 55 08             	mov    0x8(%ebp),%edx
+  802990:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  802993:	eb 03                	jmp    802998 <strtol+0x11>
+    s++;
+  802995:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  802998:	0f b6 02             	movzbl (%edx),%eax
+  80299b:	3c 20                	cmp    $0x20,%al
+  80299d:	74 f6                	je     802995 <strtol+0xe>
+  80299f:	3c 09                	cmp    $0x9,%al
+  8029a1:	74 f2                	je     802995 <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  8029a3:	3c 2b                	cmp    $0x2b,%al
+  8029a5:	74 2a                	je     8029d1 <strtol+0x4a>
+  int neg = 0;
+  8029a7:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  8029ac:	3c 2d                	cmp    $0x2d,%al
+  8029ae:	74 2b                	je     8029db <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8029b0:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8029b6:	75 0f                	jne    8029c7 <strtol+0x40>
+  8029b8:	80 3a 30             	cmpb   $0x30,(%edx)
+  8029bb:	74 28                	je     8029e5 <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  8029bd:	85 db                	test   %ebx,%ebx
+  8029bf:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8029c4:	0f 44 d8             	cmove  %eax,%ebx
+  8029c7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8029cc:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8029cf:	eb 46                	jmp    802a17 <strtol+0x90>
+    s++;
+  8029d1:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  8029d4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029d9:	eb d5                	jmp    8029b0 <strtol+0x29>
+    s++, neg = 1;
+  8029db:	83 c2 01             	add    $0x1,%edx
+  8029de:	bf 01 00 00 00       	mov    $0x1,%edi
+  8029e3:	eb cb                	jmp    8029b0 <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8029e5:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8029e9:	74 0e                	je     8029f9 <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  8029eb:	85 db                	test   %ebx,%ebx
+  8029ed:	75 d8                	jne    8029c7 <strtol+0x40>
+    s++, base = 8;
+  8029ef:	83 c2 01             	add    $0x1,%edx
+  8029f2:	bb 08 00 00 00       	mov    $0x8,%ebx
+  8029f7:	eb ce                	jmp    8029c7 <strtol+0x40>
+    s += 2, base = 16;
+  8029f9:	83 c2 02             	add    $0x2,%edx
+  8029fc:	bb 10 00 00 00       	mov    $0x10,%ebx
+  802a01:	eb c4                	jmp    8029c7 <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  802a03:	0f be c0             	movsbl %al,%eax
+  802a06:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  802a09:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802a0c:	7d 3a                	jge    802a48 <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  802a0e:	83 c2 01             	add    $0x1,%edx
+  802a11:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  802a15:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  802a17:	0f b6 02             	movzbl (%edx),%eax
+  802a1a:	8d 70 d0             	lea    -0x30(%eax),%esi
+  802a1d:	89 f3                	mov    %esi,%ebx
+  802a1f:	80 fb 09             	cmp    $0x9,%bl
+  802a22:	76 df                	jbe    802a03 <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  802a24:	8d 70 9f             	lea    -0x61(%eax),%esi
+  802a27:	89 f3                	mov    %esi,%ebx
+  802a29:	80 fb 19             	cmp    $0x19,%bl
+  802a2c:	77 08                	ja     802a36 <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  802a2e:	0f be c0             	movsbl %al,%eax
+  802a31:	83 e8 57             	sub    $0x57,%eax
+  802a34:	eb d3                	jmp    802a09 <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  802a36:	8d 70 bf             	lea    -0x41(%eax),%esi
+  802a39:	89 f3                	mov    %esi,%ebx
+  802a3b:	80 fb 19             	cmp    $0x19,%bl
+  802a3e:	77 08                	ja     802a48 <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  802a40:	0f be c0             	movsbl %al,%eax
+  802a43:	83 e8 37             	sub    $0x37,%eax
+  802a46:	eb c1                	jmp    802a09 <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  802a48:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802a4c:	74 05                	je     802a53 <strtol+0xcc>
+    *endptr = (char*)s;
+  802a4e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a51:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  802a53:	89 c8                	mov    %ecx,%eax
+  802a55:	f7 d8                	neg    %eax
+  802a57:	85 ff                	test   %edi,%edi
+  802a59:	0f 45 c8             	cmovne %eax,%ecx
+}
+  802a5c:	89 c8                	mov    %ecx,%eax
+  802a5e:	5b                   	pop    %ebx
+  802a5f:	5e                   	pop    %esi
+  802a60:	5f                   	pop    %edi
+  802a61:	5d                   	pop    %ebp
+  802a62:	c3                   	ret
+
+00802a63 <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  802a63:	55                   	push   %ebp
+  802a64:	89 e5                	mov    %esp,%ebp
+  802a66:	57                   	push   %edi
+  802a67:	56                   	push   %esi
+  802a68:	53                   	push   %ebx
+  802a69:	83 ec 14             	sub    $0x14,%esp
+  802a6c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802a6f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a72:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802a75:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  802a78:	85 c0                	test   %eax,%eax
+  802a7a:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802a7f:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  802a82:	ff 33                	push   (%ebx)
+  802a84:	50                   	push   %eax
+  802a85:	e8 f8 d9 ff ff       	call   800482 <sys_ipc_recv>
+  802a8a:	83 c4 10             	add    $0x10,%esp
+  802a8d:	85 c0                	test   %eax,%eax
+  802a8f:	78 39                	js     802aca <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  802a91:	85 ff                	test   %edi,%edi
+  802a93:	74 0a                	je     802a9f <ipc_recv_pages+0x3c>
+  802a95:	a1 44 57 80 00       	mov    0x805744,%eax
+  802a9a:	8b 40 7c             	mov    0x7c(%eax),%eax
+  802a9d:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  802a9f:	85 f6                	test   %esi,%esi
+  802aa1:	74 0d                	je     802ab0 <ipc_recv_pages+0x4d>
+  802aa3:	a1 44 57 80 00       	mov    0x805744,%eax
+  802aa8:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  802aae:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  802ab0:	a1 44 57 80 00       	mov    0x805744,%eax
+  802ab5:	8b 40 74             	mov    0x74(%eax),%eax
+  802ab8:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  802aba:	a1 44 57 80 00       	mov    0x805744,%eax
+  802abf:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  802ac2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ac5:	5b                   	pop    %ebx
+  802ac6:	5e                   	pop    %esi
+  802ac7:	5f                   	pop    %edi
+  802ac8:	5d                   	pop    %ebp
+  802ac9:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  802aca:	85 ff                	test   %edi,%edi
+  802acc:	74 06                	je     802ad4 <ipc_recv_pages+0x71>
+  802ace:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  802ad4:	85 f6                	test   %esi,%esi
+  802ad6:	74 06                	je     802ade <ipc_recv_pages+0x7b>
+  802ad8:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  802ade:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  802ae4:	eb dc                	jmp    802ac2 <ipc_recv_pages+0x5f>
+
+00802ae6 <ipc_recv>:
+{
+  802ae6:	55                   	push   %ebp
+  802ae7:	89 e5                	mov    %esp,%ebp
+  802ae9:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  802aec:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  802af3:	ff 75 10             	push   0x10(%ebp)
+  802af6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802af9:	50                   	push   %eax
+  802afa:	ff 75 0c             	push   0xc(%ebp)
+  802afd:	ff 75 08             	push   0x8(%ebp)
+  802b00:	e8 5e ff ff ff       	call   802a63 <ipc_recv_pages>
+}
+  802b05:	c9                   	leave
+  802b06:	c3                   	ret
+
+00802b07 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  802b07:	55                   	push   %ebp
+  802b08:	89 e5                	mov    %esp,%ebp
+  802b0a:	57                   	push   %edi
+  802b0b:	56                   	push   %esi
+  802b0c:	53                   	push   %ebx
+  802b0d:	83 ec 0c             	sub    $0xc,%esp
+  802b10:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802b13:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802b16:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  802b19:	89 c3                	mov    %eax,%ebx
+  802b1b:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  802b21:	85 c0                	test   %eax,%eax
+  802b23:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802b28:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  802b2b:	83 ec 0c             	sub    $0xc,%esp
+  802b2e:	ff 75 14             	push   0x14(%ebp)
+  802b31:	ff 75 18             	push   0x18(%ebp)
+  802b34:	53                   	push   %ebx
+  802b35:	56                   	push   %esi
+  802b36:	57                   	push   %edi
+  802b37:	e8 25 d9 ff ff       	call   800461 <sys_ipc_try_send>
+  802b3c:	83 c4 20             	add    $0x20,%esp
+  802b3f:	85 c0                	test   %eax,%eax
+  802b41:	79 1e                	jns    802b61 <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  802b43:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802b46:	75 07                	jne    802b4f <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  802b48:	e8 fb d5 ff ff       	call   800148 <sys_yield>
+  802b4d:	eb dc                	jmp    802b2b <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  802b4f:	50                   	push   %eax
+  802b50:	68 e3 32 80 00       	push   $0x8032e3
+  802b55:	6a 5c                	push   $0x5c
+  802b57:	68 f0 32 80 00       	push   $0x8032f0
+  802b5c:	e8 09 f5 ff ff       	call   80206a <_panic>
+  }
+}
+  802b61:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b64:	5b                   	pop    %ebx
+  802b65:	5e                   	pop    %esi
+  802b66:	5f                   	pop    %edi
+  802b67:	5d                   	pop    %ebp
+  802b68:	c3                   	ret
+
+00802b69 <ipc_send>:
+{
+  802b69:	55                   	push   %ebp
+  802b6a:	89 e5                	mov    %esp,%ebp
+  802b6c:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  802b6f:	ff 75 14             	push   0x14(%ebp)
+  802b72:	6a 01                	push   $0x1
+  802b74:	ff 75 10             	push   0x10(%ebp)
+  802b77:	ff 75 0c             	push   0xc(%ebp)
+  802b7a:	ff 75 08             	push   0x8(%ebp)
+  802b7d:	e8 85 ff ff ff       	call   802b07 <ipc_send_pages>
+}
+  802b82:	83 c4 20             	add    $0x20,%esp
+  802b85:	c9                   	leave
+  802b86:	c3                   	ret
+
+00802b87 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802b87:	55                   	push   %ebp
+  802b88:	89 e5                	mov    %esp,%ebp
+  802b8a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  802b8d:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  802b92:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802b95:	c1 e0 04             	shl    $0x4,%eax
+  802b98:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802b9d:	8b 40 50             	mov    0x50(%eax),%eax
+  802ba0:	39 c8                	cmp    %ecx,%eax
+  802ba2:	74 12                	je     802bb6 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  802ba4:	83 c2 01             	add    $0x1,%edx
+  802ba7:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802bad:	75 e3                	jne    802b92 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  802baf:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bb4:	eb 0e                	jmp    802bc4 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  802bb6:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802bb9:	c1 e0 04             	shl    $0x4,%eax
+  802bbc:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802bc1:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802bc4:	5d                   	pop    %ebp
+  802bc5:	c3                   	ret
+
+00802bc6 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802bc6:	55                   	push   %ebp
+  802bc7:	89 e5                	mov    %esp,%ebp
+  802bc9:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802bcc:	89 c2                	mov    %eax,%edx
+  802bce:	c1 ea 16             	shr    $0x16,%edx
+  802bd1:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  802bd8:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802bdd:	f6 c1 01             	test   $0x1,%cl
+  802be0:	74 1c                	je     802bfe <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  802be2:	c1 e8 0c             	shr    $0xc,%eax
+  802be5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  802bec:	a8 01                	test   $0x1,%al
+  802bee:	74 0e                	je     802bfe <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  802bf0:	c1 e8 0c             	shr    $0xc,%eax
+  802bf3:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802bfa:	ef 
+  802bfb:	0f b7 d2             	movzwl %dx,%edx
+}
+  802bfe:	89 d0                	mov    %edx,%eax
+  802c00:	5d                   	pop    %ebp
+  802c01:	c3                   	ret
+
+00802c02 <udivmod>:
+  802c02:	55                   	push   %ebp
+  802c03:	57                   	push   %edi
+  802c04:	56                   	push   %esi
+  802c05:	53                   	push   %ebx
+  802c06:	83 ec 14             	sub    $0x14,%esp
+  802c09:	8b 74 24 28          	mov    0x28(%esp),%esi
+  802c0d:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  802c11:	89 fb                	mov    %edi,%ebx
+  802c13:	09 f3                	or     %esi,%ebx
+  802c15:	0f 84 88 00 00 00    	je     802ca3 <udivmod+0xa1>
+  802c1b:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802c20:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802c27:	00 
+  802c28:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802c2f:	00 
+  802c30:	89 cd                	mov    %ecx,%ebp
+  802c32:	89 34 24             	mov    %esi,(%esp)
+  802c35:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802c39:	eb 08                	jmp    802c43 <udivmod+0x41>
+  802c3b:	83 ed 01             	sub    $0x1,%ebp
+  802c3e:	83 fd ff             	cmp    $0xffffffff,%ebp
+  802c41:	74 6c                	je     802caf <udivmod+0xad>
+  802c43:	89 c3                	mov    %eax,%ebx
+  802c45:	89 d6                	mov    %edx,%esi
+  802c47:	89 e9                	mov    %ebp,%ecx
+  802c49:	0f ad f3             	shrd   %cl,%esi,%ebx
+  802c4c:	d3 ee                	shr    %cl,%esi
+  802c4e:	f6 c1 20             	test   $0x20,%cl
+  802c51:	74 04                	je     802c57 <udivmod+0x55>
+  802c53:	89 f3                	mov    %esi,%ebx
+  802c55:	31 f6                	xor    %esi,%esi
+  802c57:	8b 3c 24             	mov    (%esp),%edi
+  802c5a:	39 fb                	cmp    %edi,%ebx
+  802c5c:	89 f7                	mov    %esi,%edi
+  802c5e:	8b 1c 24             	mov    (%esp),%ebx
+  802c61:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802c65:	19 f7                	sbb    %esi,%edi
+  802c67:	72 d2                	jb     802c3b <udivmod+0x39>
+  802c69:	89 f7                	mov    %esi,%edi
+  802c6b:	89 de                	mov    %ebx,%esi
+  802c6d:	89 e9                	mov    %ebp,%ecx
+  802c6f:	0f a5 f7             	shld   %cl,%esi,%edi
+  802c72:	d3 e6                	shl    %cl,%esi
+  802c74:	f6 c1 20             	test   $0x20,%cl
+  802c77:	74 04                	je     802c7d <udivmod+0x7b>
+  802c79:	89 f7                	mov    %esi,%edi
+  802c7b:	31 f6                	xor    %esi,%esi
+  802c7d:	29 f0                	sub    %esi,%eax
+  802c7f:	19 fa                	sbb    %edi,%edx
+  802c81:	be 01 00 00 00       	mov    $0x1,%esi
+  802c86:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c8b:	0f a5 f7             	shld   %cl,%esi,%edi
+  802c8e:	d3 e6                	shl    %cl,%esi
+  802c90:	f6 c1 20             	test   $0x20,%cl
+  802c93:	74 04                	je     802c99 <udivmod+0x97>
+  802c95:	89 f7                	mov    %esi,%edi
+  802c97:	31 f6                	xor    %esi,%esi
+  802c99:	09 74 24 08          	or     %esi,0x8(%esp)
+  802c9d:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802ca1:	eb 98                	jmp    802c3b <udivmod+0x39>
+  802ca3:	89 f0                	mov    %esi,%eax
+  802ca5:	89 fa                	mov    %edi,%edx
+  802ca7:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802cab:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802caf:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802cb3:	89 01                	mov    %eax,(%ecx)
+  802cb5:	89 51 04             	mov    %edx,0x4(%ecx)
+  802cb8:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802cbc:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802cc0:	83 c4 14             	add    $0x14,%esp
+  802cc3:	5b                   	pop    %ebx
+  802cc4:	5e                   	pop    %esi
+  802cc5:	5f                   	pop    %edi
+  802cc6:	5d                   	pop    %ebp
+  802cc7:	c3                   	ret
+
+00802cc8 <__udivdi3>:
+  802cc8:	83 ec 18             	sub    $0x18,%esp
+  802ccb:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802ccf:	50                   	push   %eax
+  802cd0:	ff 74 24 2c          	push   0x2c(%esp)
+  802cd4:	ff 74 24 2c          	push   0x2c(%esp)
+  802cd8:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802cdc:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802ce0:	e8 1d ff ff ff       	call   802c02 <udivmod>
+  802ce5:	83 c4 24             	add    $0x24,%esp
+  802ce8:	c3                   	ret
+
+00802ce9 <__umoddi3>:
+  802ce9:	83 ec 18             	sub    $0x18,%esp
+  802cec:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802cf0:	50                   	push   %eax
+  802cf1:	ff 74 24 2c          	push   0x2c(%esp)
+  802cf5:	ff 74 24 2c          	push   0x2c(%esp)
+  802cf9:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802cfd:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802d01:	e8 fc fe ff ff       	call   802c02 <udivmod>
+  802d06:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802d0a:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802d0e:	83 c4 24             	add    $0x24,%esp
+  802d11:	c3                   	ret
+
+00802d12 <__divdi3>:
+  802d12:	56                   	push   %esi
+  802d13:	53                   	push   %ebx
+  802d14:	83 ec 14             	sub    $0x14,%esp
+  802d17:	8b 44 24 20          	mov    0x20(%esp),%eax
+  802d1b:	8b 54 24 24          	mov    0x24(%esp),%edx
+  802d1f:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  802d23:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  802d27:	85 d2                	test   %edx,%edx
+  802d29:	78 18                	js     802d43 <__divdi3+0x31>
+  802d2b:	85 db                	test   %ebx,%ebx
+  802d2d:	78 3e                	js     802d6d <__divdi3+0x5b>
+  802d2f:	83 ec 04             	sub    $0x4,%esp
+  802d32:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802d36:	56                   	push   %esi
+  802d37:	53                   	push   %ebx
+  802d38:	51                   	push   %ecx
+  802d39:	e8 c4 fe ff ff       	call   802c02 <udivmod>
+  802d3e:	83 c4 10             	add    $0x10,%esp
+  802d41:	eb 24                	jmp    802d67 <__divdi3+0x55>
+  802d43:	f7 d8                	neg    %eax
+  802d45:	83 d2 00             	adc    $0x0,%edx
+  802d48:	f7 da                	neg    %edx
+  802d4a:	85 db                	test   %ebx,%ebx
+  802d4c:	78 3a                	js     802d88 <__divdi3+0x76>
+  802d4e:	83 ec 04             	sub    $0x4,%esp
+  802d51:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802d55:	56                   	push   %esi
+  802d56:	53                   	push   %ebx
+  802d57:	51                   	push   %ecx
+  802d58:	e8 a5 fe ff ff       	call   802c02 <udivmod>
+  802d5d:	83 c4 10             	add    $0x10,%esp
+  802d60:	f7 d8                	neg    %eax
+  802d62:	83 d2 00             	adc    $0x0,%edx
+  802d65:	f7 da                	neg    %edx
+  802d67:	83 c4 14             	add    $0x14,%esp
+  802d6a:	5b                   	pop    %ebx
+  802d6b:	5e                   	pop    %esi
+  802d6c:	c3                   	ret
+  802d6d:	83 ec 04             	sub    $0x4,%esp
+  802d70:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802d74:	56                   	push   %esi
+  802d75:	f7 d9                	neg    %ecx
+  802d77:	83 d3 00             	adc    $0x0,%ebx
+  802d7a:	f7 db                	neg    %ebx
+  802d7c:	53                   	push   %ebx
+  802d7d:	51                   	push   %ecx
+  802d7e:	e8 7f fe ff ff       	call   802c02 <udivmod>
+  802d83:	83 c4 10             	add    $0x10,%esp
+  802d86:	eb d8                	jmp    802d60 <__divdi3+0x4e>
+  802d88:	83 ec 04             	sub    $0x4,%esp
+  802d8b:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802d8f:	56                   	push   %esi
+  802d90:	f7 d9                	neg    %ecx
+  802d92:	83 d3 00             	adc    $0x0,%ebx
+  802d95:	f7 db                	neg    %ebx
+  802d97:	53                   	push   %ebx
+  802d98:	51                   	push   %ecx
+  802d99:	e8 64 fe ff ff       	call   802c02 <udivmod>
+  802d9e:	83 c4 10             	add    $0x10,%esp
+  802da1:	eb c4                	jmp    802d67 <__divdi3+0x55>
+
+00802da3 <__moddi3>:
+  802da3:	55                   	push   %ebp
+  802da4:	57                   	push   %edi
+  802da5:	56                   	push   %esi
+  802da6:	53                   	push   %ebx
+  802da7:	83 ec 24             	sub    $0x24,%esp
+  802daa:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802dae:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802db2:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  802db6:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  802dba:	85 d2                	test   %edx,%edx
+  802dbc:	78 3b                	js     802df9 <__moddi3+0x56>
+  802dbe:	83 ec 04             	sub    $0x4,%esp
+  802dc1:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  802dc5:	56                   	push   %esi
+  802dc6:	89 ce                	mov    %ecx,%esi
+  802dc8:	f7 de                	neg    %esi
+  802dca:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802dce:	89 de                	mov    %ebx,%esi
+  802dd0:	83 d6 00             	adc    $0x0,%esi
+  802dd3:	f7 de                	neg    %esi
+  802dd5:	89 74 24 14          	mov    %esi,0x14(%esp)
+  802dd9:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802ddd:	0f 48 f1             	cmovs  %ecx,%esi
+  802de0:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  802de5:	53                   	push   %ebx
+  802de6:	56                   	push   %esi
+  802de7:	e8 16 fe ff ff       	call   802c02 <udivmod>
+  802dec:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802df0:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802df4:	83 c4 10             	add    $0x10,%esp
+  802df7:	eb 47                	jmp    802e40 <__moddi3+0x9d>
+  802df9:	f7 d8                	neg    %eax
+  802dfb:	83 d2 00             	adc    $0x0,%edx
+  802dfe:	f7 da                	neg    %edx
+  802e00:	83 ec 04             	sub    $0x4,%esp
+  802e03:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  802e07:	56                   	push   %esi
+  802e08:	89 cf                	mov    %ecx,%edi
+  802e0a:	f7 df                	neg    %edi
+  802e0c:	89 de                	mov    %ebx,%esi
+  802e0e:	83 d6 00             	adc    $0x0,%esi
+  802e11:	f7 de                	neg    %esi
+  802e13:	0f 49 cf             	cmovns %edi,%ecx
+  802e16:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802e1a:	0f 49 de             	cmovns %esi,%ebx
+  802e1d:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  802e21:	ff 74 24 0c          	push   0xc(%esp)
+  802e25:	ff 74 24 0c          	push   0xc(%esp)
+  802e29:	e8 d4 fd ff ff       	call   802c02 <udivmod>
+  802e2e:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802e32:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802e36:	f7 d8                	neg    %eax
+  802e38:	83 d2 00             	adc    $0x0,%edx
+  802e3b:	f7 da                	neg    %edx
+  802e3d:	83 c4 10             	add    $0x10,%esp
+  802e40:	83 c4 24             	add    $0x24,%esp
+  802e43:	5b                   	pop    %ebx
+  802e44:	5e                   	pop    %esi
+  802e45:	5f                   	pop    %edi
+  802e46:	5d                   	pop    %ebp
+  802e47:	c3                   	ret
@@ -0,0 +1,8342 @@
+
+obj/user/forkbench.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 3a 05 00 00       	call   80056b <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <pagefork>:
+static const int heap_pages[] = { 0, 64, 256, 1024, 2048, 4096 };
+
+// The old duppage loop: up to two sys_page_map calls per page.
+static envid_t
+pagefork(void)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 0c             	sub    $0xc,%esp
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+  envid_t ret;
+  __asm __volatile("int %2"
+  80003c:	b8 07 00 00 00       	mov    $0x7,%eax
+  800041:	cd 30                	int    $0x30
+  800043:	89 c7                	mov    %eax,%edi
+  uint32_t pn;
+  void *addr;
+  pte_t pte;
+  int r;
+
+  if ((envid = sys_exofork()) < 0)
+  800045:	85 c0                	test   %eax,%eax
+  800047:	78 26                	js     80006f <pagefork+0x3c>
+  if (envid == 0) {
+    thisenv = &envs[ENVX(sys_getenvid())];
+    return 0;
+  }
+
+  for (pn = 0; pn < PGNUM(UXSTACKTOP - PGSIZE); pn++) {
+  800049:	bb 00 00 00 00       	mov    $0x0,%ebx
+  if (envid == 0) {
+  80004e:	75 46                	jne    800096 <pagefork+0x63>
+    thisenv = &envs[ENVX(sys_getenvid())];
+  800050:	e8 fa 0f 00 00       	call   80104f <sys_getenvid>
+  800055:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80005a:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80005d:	c1 e0 04             	shl    $0x4,%eax
+  800060:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800065:	a3 a0 68 80 00       	mov    %eax,0x8068a0
+    return 0;
+  80006a:	e9 22 01 00 00       	jmp    800191 <pagefork+0x15e>
+    panic("sys_exofork: %e", envid);
+  80006f:	50                   	push   %eax
+  800070:	68 80 3e 80 00       	push   $0x803e80
+  800075:	6a 1e                	push   $0x1e
+  800077:	68 90 3e 80 00       	push   $0x803e90
+  80007c:	e8 57 05 00 00       	call   8005d8 <_panic>
+    if (!(uvpd[pn >> (PDXSHIFT - PTXSHIFT)] & PTE_P)) {
+      pn += NPTENTRIES - 1;
+  800081:	81 c3 ff 03 00 00    	add    $0x3ff,%ebx
+  for (pn = 0; pn < PGNUM(UXSTACKTOP - PGSIZE); pn++) {
+  800087:	83 c3 01             	add    $0x1,%ebx
+  80008a:	81 fb fe eb 0e 00    	cmp    $0xeebfe,%ebx
+  800090:	0f 87 b9 00 00 00    	ja     80014f <pagefork+0x11c>
+    if (!(uvpd[pn >> (PDXSHIFT - PTXSHIFT)] & PTE_P)) {
+  800096:	89 d8                	mov    %ebx,%eax
+  800098:	c1 e8 0a             	shr    $0xa,%eax
+  80009b:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8000a2:	a8 01                	test   $0x1,%al
+  8000a4:	74 db                	je     800081 <pagefork+0x4e>
+      continue;
+    }
+    pte = uvpt[pn];
+  8000a6:	8b 04 9d 00 00 40 ef 	mov    -0x10c00000(,%ebx,4),%eax
+    if ((pte & (PTE_P | PTE_U)) != (PTE_P | PTE_U))
+  8000ad:	89 c2                	mov    %eax,%edx
+  8000af:	83 e2 05             	and    $0x5,%edx
+  8000b2:	83 fa 05             	cmp    $0x5,%edx
+  8000b5:	75 d0                	jne    800087 <pagefork+0x54>
+      continue;
+
+    addr = (void *) (pn << PGSHIFT);
+  8000b7:	89 de                	mov    %ebx,%esi
+  8000b9:	c1 e6 0c             	shl    $0xc,%esi
+    if (!(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE)) {
+  8000bc:	a9 02 08 00 00       	test   $0x802,%eax
+  8000c1:	74 05                	je     8000c8 <pagefork+0x95>
+  8000c3:	f6 c4 04             	test   $0x4,%ah
+  8000c6:	74 2c                	je     8000f4 <pagefork+0xc1>
+      if ((r = sys_page_map(0, addr, envid, addr, pte & PTE_SYSCALL)) < 0)
+  8000c8:	83 ec 0c             	sub    $0xc,%esp
+  8000cb:	25 07 0e 00 00       	and    $0xe07,%eax
+  8000d0:	50                   	push   %eax
+  8000d1:	56                   	push   %esi
+  8000d2:	57                   	push   %edi
+  8000d3:	56                   	push   %esi
+  8000d4:	6a 00                	push   $0x0
+  8000d6:	e8 38 10 00 00       	call   801113 <sys_page_map>
+  8000db:	83 c4 20             	add    $0x20,%esp
+  8000de:	85 c0                	test   %eax,%eax
+  8000e0:	79 a5                	jns    800087 <pagefork+0x54>
+        panic("sys_page_map: %e", r);
+  8000e2:	50                   	push   %eax
+  8000e3:	68 a1 3e 80 00       	push   $0x803ea1
+  8000e8:	6a 30                	push   $0x30
+  8000ea:	68 90 3e 80 00       	push   $0x803e90
+  8000ef:	e8 e4 04 00 00       	call   8005d8 <_panic>
+      continue;
+    }
+    if ((r = sys_page_map(0, addr, envid, addr, PTE_COW | PTE_U | PTE_P)) < 0)
+  8000f4:	83 ec 0c             	sub    $0xc,%esp
+  8000f7:	68 05 08 00 00       	push   $0x805
+  8000fc:	56                   	push   %esi
+  8000fd:	57                   	push   %edi
+  8000fe:	56                   	push   %esi
+  8000ff:	6a 00                	push   $0x0
+  800101:	e8 0d 10 00 00       	call   801113 <sys_page_map>
+  800106:	83 c4 20             	add    $0x20,%esp
+  800109:	85 c0                	test   %eax,%eax
+  80010b:	78 30                	js     80013d <pagefork+0x10a>
+      panic("sys_page_map: %e", r);
+    if ((r = sys_page_map(0, addr, 0, addr, PTE_COW | PTE_U | PTE_P)) < 0)
+  80010d:	83 ec 0c             	sub    $0xc,%esp
+  800110:	68 05 08 00 00       	push   $0x805
+  800115:	56                   	push   %esi
+  800116:	6a 00                	push   $0x0
+  800118:	56                   	push   %esi
+  800119:	6a 00                	push   $0x0
+  80011b:	e8 f3 0f 00 00       	call   801113 <sys_page_map>
+  800120:	83 c4 20             	add    $0x20,%esp
+  800123:	85 c0                	test   %eax,%eax
+  800125:	0f 89 5c ff ff ff    	jns    800087 <pagefork+0x54>
+      panic("sys_page_map: %e", r);
+  80012b:	50                   	push   %eax
+  80012c:	68 a1 3e 80 00       	push   $0x803ea1
+  800131:	6a 36                	push   $0x36
+  800133:	68 90 3e 80 00       	push   $0x803e90
+  800138:	e8 9b 04 00 00       	call   8005d8 <_panic>
+      panic("sys_page_map: %e", r);
+  80013d:	50                   	push   %eax
+  80013e:	68 a1 3e 80 00       	push   $0x803ea1
+  800143:	6a 34                	push   $0x34
+  800145:	68 90 3e 80 00       	push   $0x803e90
+  80014a:	e8 89 04 00 00       	call   8005d8 <_panic>
+  }
+
+  if ((r = sys_page_alloc(envid, (void *) (UXSTACKTOP - PGSIZE),
+  80014f:	83 ec 04             	sub    $0x4,%esp
+  800152:	6a 07                	push   $0x7
+  800154:	68 00 f0 bf ee       	push   $0xeebff000
+  800159:	57                   	push   %edi
+  80015a:	e8 71 0f 00 00       	call   8010d0 <sys_page_alloc>
+  80015f:	83 c4 10             	add    $0x10,%esp
+  800162:	85 c0                	test   %eax,%eax
+  800164:	78 35                	js     80019b <pagefork+0x168>
+                          PTE_P | PTE_U | PTE_W)) < 0)
+    panic("sys_page_alloc: %e", r);
+  if ((r = sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall)) < 0)
+  800166:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  80016b:	8b 40 64             	mov    0x64(%eax),%eax
+  80016e:	83 ec 08             	sub    $0x8,%esp
+  800171:	50                   	push   %eax
+  800172:	57                   	push   %edi
+  800173:	e8 cd 11 00 00       	call   801345 <sys_env_set_pgfault_upcall>
+  800178:	83 c4 10             	add    $0x10,%esp
+  80017b:	85 c0                	test   %eax,%eax
+  80017d:	78 2e                	js     8001ad <pagefork+0x17a>
+    panic("sys_env_set_pgfault_upcall: %e", r);
+  if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  80017f:	83 ec 08             	sub    $0x8,%esp
+  800182:	6a 02                	push   $0x2
+  800184:	57                   	push   %edi
+  800185:	e8 37 11 00 00       	call   8012c1 <sys_env_set_status>
+  80018a:	83 c4 10             	add    $0x10,%esp
+  80018d:	85 c0                	test   %eax,%eax
+  80018f:	78 2e                	js     8001bf <pagefork+0x18c>
+    panic("sys_env_set_status: %e", r);
+  return envid;
+}
+  800191:	89 f8                	mov    %edi,%eax
+  800193:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800196:	5b                   	pop    %ebx
+  800197:	5e                   	pop    %esi
+  800198:	5f                   	pop    %edi
+  800199:	5d                   	pop    %ebp
+  80019a:	c3                   	ret
+    panic("sys_page_alloc: %e", r);
+  80019b:	50                   	push   %eax
+  80019c:	68 b2 3e 80 00       	push   $0x803eb2
+  8001a1:	6a 3b                	push   $0x3b
+  8001a3:	68 90 3e 80 00       	push   $0x803e90
+  8001a8:	e8 2b 04 00 00       	call   8005d8 <_panic>
+    panic("sys_env_set_pgfault_upcall: %e", r);
+  8001ad:	50                   	push   %eax
+  8001ae:	68 20 3f 80 00       	push   $0x803f20
+  8001b3:	6a 3d                	push   $0x3d
+  8001b5:	68 90 3e 80 00       	push   $0x803e90
+  8001ba:	e8 19 04 00 00       	call   8005d8 <_panic>
+    panic("sys_env_set_status: %e", r);
+  8001bf:	50                   	push   %eax
+  8001c0:	68 c5 3e 80 00       	push   $0x803ec5
+  8001c5:	6a 3f                	push   $0x3f
+  8001c7:	68 90 3e 80 00       	push   $0x803e90
+  8001cc:	e8 07 04 00 00       	call   8005d8 <_panic>
+
+008001d1 <tree>:
+}
+
+// Each node forks two children and waits for them, as in forktree.
+static void
+tree(envid_t (*forkfn)(void), int depth)
+{
+  8001d1:	55                   	push   %ebp
+  8001d2:	89 e5                	mov    %esp,%ebp
+  8001d4:	57                   	push   %edi
+  8001d5:	56                   	push   %esi
+  8001d6:	53                   	push   %ebx
+  8001d7:	83 ec 1c             	sub    $0x1c,%esp
+  8001da:	89 c3                	mov    %eax,%ebx
+  8001dc:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  envid_t child[2];
+  int i;
+
+  if (depth == TREEDEPTH)
+  8001df:	83 fa 03             	cmp    $0x3,%edx
+  8001e2:	74 28                	je     80020c <tree+0x3b>
+    return;
+  for (i = 0; i < 2; i++) {
+    if ((child[i] = forkfn()) < 0)
+  8001e4:	ff d0                	call   *%eax
+  8001e6:	89 c7                	mov    %eax,%edi
+  8001e8:	85 c0                	test   %eax,%eax
+  8001ea:	78 50                	js     80023c <tree+0x6b>
+      panic("fork: %e", child[i]);
+    if (child[i] == 0) {
+  8001ec:	74 26                	je     800214 <tree+0x43>
+    if ((child[i] = forkfn()) < 0)
+  8001ee:	ff d3                	call   *%ebx
+  8001f0:	89 c6                	mov    %eax,%esi
+  8001f2:	85 c0                	test   %eax,%eax
+  8001f4:	78 48                	js     80023e <tree+0x6d>
+    if (child[i] == 0) {
+  8001f6:	74 30                	je     800228 <tree+0x57>
+      tree(forkfn, depth + 1);
+      exit();
+    }
+  }
+  for (i = 0; i < 2; i++)
+    wait(child[i]);
+  8001f8:	83 ec 0c             	sub    $0xc,%esp
+  8001fb:	57                   	push   %edi
+  8001fc:	e8 4f 30 00 00       	call   803250 <wait>
+  800201:	89 34 24             	mov    %esi,(%esp)
+  800204:	e8 47 30 00 00       	call   803250 <wait>
+  for (i = 0; i < 2; i++)
+  800209:	83 c4 10             	add    $0x10,%esp
+}
+  80020c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80020f:	5b                   	pop    %ebx
+  800210:	5e                   	pop    %esi
+  800211:	5f                   	pop    %edi
+  800212:	5d                   	pop    %ebp
+  800213:	c3                   	ret
+      tree(forkfn, depth + 1);
+  800214:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800217:	8d 50 01             	lea    0x1(%eax),%edx
+  80021a:	89 d8                	mov    %ebx,%eax
+  80021c:	e8 b0 ff ff ff       	call   8001d1 <tree>
+      exit();
+  800221:	e8 98 03 00 00       	call   8005be <exit>
+  800226:	eb c6                	jmp    8001ee <tree+0x1d>
+      tree(forkfn, depth + 1);
+  800228:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80022b:	83 c2 01             	add    $0x1,%edx
+  80022e:	89 d8                	mov    %ebx,%eax
+  800230:	e8 9c ff ff ff       	call   8001d1 <tree>
+      exit();
+  800235:	e8 84 03 00 00       	call   8005be <exit>
+  80023a:	eb bc                	jmp    8001f8 <tree+0x27>
+    if ((child[i] = forkfn()) < 0)
+  80023c:	89 c6                	mov    %eax,%esi
+      panic("fork: %e", child[i]);
+  80023e:	56                   	push   %esi
+  80023f:	68 fa 3e 80 00       	push   $0x803efa
+  800244:	6a 7e                	push   $0x7e
+  800246:	68 90 3e 80 00       	push   $0x803e90
+  80024b:	e8 88 03 00 00       	call   8005d8 <_panic>
+
+00800250 <run>:
+{
+  800250:	55                   	push   %ebp
+  800251:	89 e5                	mov    %esp,%ebp
+  800253:	57                   	push   %edi
+  800254:	56                   	push   %esi
+  800255:	53                   	push   %ebx
+  800256:	83 ec 1c             	sub    $0x1c,%esp
+  800259:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80025c:	89 d7                	mov    %edx,%edi
+  start = sys_time_msec();
+  80025e:	e8 87 11 00 00       	call   8013ea <sys_time_msec>
+  800263:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; i++) {
+  800266:	be 00 00 00 00       	mov    $0x0,%esi
+  80026b:	eb 21                	jmp    80028e <run+0x3e>
+      panic("fork: %e", child);
+  80026d:	50                   	push   %eax
+  80026e:	68 fa 3e 80 00       	push   $0x803efa
+  800273:	6a 6b                	push   $0x6b
+  800275:	68 90 3e 80 00       	push   $0x803e90
+  80027a:	e8 59 03 00 00       	call   8005d8 <_panic>
+    wait(child);
+  80027f:	83 ec 0c             	sub    $0xc,%esp
+  800282:	53                   	push   %ebx
+  800283:	e8 c8 2f 00 00       	call   803250 <wait>
+  for (i = 0; i < n; i++) {
+  800288:	83 c6 01             	add    $0x1,%esi
+  80028b:	83 c4 10             	add    $0x10,%esp
+  80028e:	39 fe                	cmp    %edi,%esi
+  800290:	7d 14                	jge    8002a6 <run+0x56>
+    if ((child = forkfn()) < 0)
+  800292:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800295:	ff d0                	call   *%eax
+  800297:	89 c3                	mov    %eax,%ebx
+  800299:	85 c0                	test   %eax,%eax
+  80029b:	78 d0                	js     80026d <run+0x1d>
+    if (child == 0)
+  80029d:	75 e0                	jne    80027f <run+0x2f>
+      exit();
+  80029f:	e8 1a 03 00 00       	call   8005be <exit>
+  8002a4:	eb d9                	jmp    80027f <run+0x2f>
+  return sys_time_msec() - start;
+  8002a6:	e8 3f 11 00 00       	call   8013ea <sys_time_msec>
+  8002ab:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8002ae:	29 c8                	sub    %ecx,%eax
+}
+  8002b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002b3:	5b                   	pop    %ebx
+  8002b4:	5e                   	pop    %esi
+  8002b5:	5f                   	pop    %edi
+  8002b6:	5d                   	pop    %ebp
+  8002b7:	c3                   	ret
+
+008002b8 <runtree>:
+
+static unsigned
+runtree(envid_t (*forkfn)(void), int n)
+{
+  8002b8:	55                   	push   %ebp
+  8002b9:	89 e5                	mov    %esp,%ebp
+  8002bb:	57                   	push   %edi
+  8002bc:	56                   	push   %esi
+  8002bd:	53                   	push   %ebx
+  8002be:	83 ec 1c             	sub    $0x1c,%esp
+  8002c1:	89 c7                	mov    %eax,%edi
+  8002c3:	89 d6                	mov    %edx,%esi
+  unsigned start;
+  int i;
+
+  start = sys_time_msec();
+  8002c5:	e8 20 11 00 00       	call   8013ea <sys_time_msec>
+  8002ca:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; i++)
+  8002cd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002d2:	eb 0f                	jmp    8002e3 <runtree+0x2b>
+    tree(forkfn, 0);
+  8002d4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002d9:	89 f8                	mov    %edi,%eax
+  8002db:	e8 f1 fe ff ff       	call   8001d1 <tree>
+  for (i = 0; i < n; i++)
+  8002e0:	83 c3 01             	add    $0x1,%ebx
+  8002e3:	39 f3                	cmp    %esi,%ebx
+  8002e5:	7c ed                	jl     8002d4 <runtree+0x1c>
+  return sys_time_msec() - start;
+  8002e7:	e8 fe 10 00 00       	call   8013ea <sys_time_msec>
+  8002ec:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8002ef:	29 c8                	sub    %ecx,%eax
+}
+  8002f1:	83 c4 1c             	add    $0x1c,%esp
+  8002f4:	5b                   	pop    %ebx
+  8002f5:	5e                   	pop    %esi
+  8002f6:	5f                   	pop    %edi
+  8002f7:	5d                   	pop    %ebp
+  8002f8:	c3                   	ret
+
+008002f9 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8002f9:	55                   	push   %ebp
+  8002fa:	89 e5                	mov    %esp,%ebp
+  8002fc:	57                   	push   %edi
+  8002fd:	56                   	push   %esi
+  8002fe:	53                   	push   %ebx
+  8002ff:	83 ec 2c             	sub    $0x2c,%esp
+  int i, n, mapped, r;
+  unsigned kernel_ms, range_ms, page_ms;
+
+  binaryname = "forkbench";
+  800302:	c7 05 00 50 80 00 dc 	movl   $0x803edc,0x805000
+  800309:	3e 80 00 
+  n = 20;
+  80030c:	bf 14 00 00 00       	mov    $0x14,%edi
+  if (argc > 1)
+  800311:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+  800315:	0f 8f d4 00 00 00    	jg     8003ef <umain+0xf6>
+    n = strtol(argv[1], 0, 0);
+
+  // Installs the COW fault handler pagefork's children rely on.
+  run(fork, 1);
+  80031b:	ba 01 00 00 00       	mov    $0x1,%edx
+  800320:	b8 3d 17 80 00       	mov    $0x80173d,%eax
+  800325:	e8 26 ff ff ff       	call   800250 <run>
+  if ((r = pipe(p)) < 0)
+  80032a:	83 ec 0c             	sub    $0xc,%esp
+  80032d:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800330:	50                   	push   %eax
+  800331:	e8 22 2d 00 00       	call   803058 <pipe>
+  800336:	83 c4 10             	add    $0x10,%esp
+  800339:	85 c0                	test   %eax,%eax
+  80033b:	0f 88 ca 00 00 00    	js     80040b <umain+0x112>
+  if ((child = kfork()) < 0)
+  800341:	e8 fc 14 00 00       	call   801842 <kfork>
+  800346:	89 c3                	mov    %eax,%ebx
+  800348:	85 c0                	test   %eax,%eax
+  80034a:	0f 88 cd 00 00 00    	js     80041d <umain+0x124>
+  if (child == 0) {
+  800350:	75 3a                	jne    80038c <umain+0x93>
+    if ((r = dup(p[1], DUPFD)) < 0)
+  800352:	83 ec 08             	sub    $0x8,%esp
+  800355:	6a 14                	push   $0x14
+  800357:	ff 75 e4             	push   -0x1c(%ebp)
+  80035a:	e8 43 18 00 00       	call   801ba2 <dup>
+  80035f:	83 c4 10             	add    $0x10,%esp
+  800362:	85 c0                	test   %eax,%eax
+  800364:	0f 88 c5 00 00 00    	js     80042f <umain+0x136>
+    if ((r = write(DUPFD, "d", 1)) != 1)
+  80036a:	83 ec 04             	sub    $0x4,%esp
+  80036d:	6a 01                	push   $0x1
+  80036f:	68 62 40 80 00       	push   $0x804062
+  800374:	6a 14                	push   $0x14
+  800376:	e8 2b 1a 00 00       	call   801da6 <write>
+  80037b:	83 c4 10             	add    $0x10,%esp
+  80037e:	83 f8 01             	cmp    $0x1,%eax
+  800381:	0f 85 ba 00 00 00    	jne    800441 <umain+0x148>
+    exit();
+  800387:	e8 32 02 00 00       	call   8005be <exit>
+  close(p[1]);
+  80038c:	83 ec 0c             	sub    $0xc,%esp
+  80038f:	ff 75 e4             	push   -0x1c(%ebp)
+  800392:	e8 b9 17 00 00       	call   801b50 <close>
+  if ((r = readn(p[0], &c, 1)) != 1 || c != 'd')
+  800397:	83 c4 0c             	add    $0xc,%esp
+  80039a:	6a 01                	push   $0x1
+  80039c:	8d 45 df             	lea    -0x21(%ebp),%eax
+  80039f:	50                   	push   %eax
+  8003a0:	ff 75 e0             	push   -0x20(%ebp)
+  8003a3:	e8 b7 19 00 00       	call   801d5f <readn>
+  8003a8:	83 c4 10             	add    $0x10,%esp
+  8003ab:	83 f8 01             	cmp    $0x1,%eax
+  8003ae:	0f 85 9f 00 00 00    	jne    800453 <umain+0x15a>
+  8003b4:	80 7d df 64          	cmpb   $0x64,-0x21(%ebp)
+  8003b8:	0f 85 95 00 00 00    	jne    800453 <umain+0x15a>
+  close(p[0]);
+  8003be:	83 ec 0c             	sub    $0xc,%esp
+  8003c1:	ff 75 e0             	push   -0x20(%ebp)
+  8003c4:	e8 87 17 00 00       	call   801b50 <close>
+  wait(child);
+  8003c9:	89 1c 24             	mov    %ebx,(%esp)
+  8003cc:	e8 7f 2e 00 00       	call   803250 <wait>
+  cprintf("forkbench: dup after kfork is good\n");
+  8003d1:	c7 04 24 40 3f 80 00 	movl   $0x803f40,(%esp)
+  8003d8:	e8 d6 02 00 00       	call   8006b3 <cprintf>
+  checkdup();
+
+  mapped = 0;
+  for (i = 0; i < sizeof(heap_pages) / sizeof(heap_pages[0]); i++) {
+  8003dd:	83 c4 10             	add    $0x10,%esp
+  8003e0:	be 00 00 00 00       	mov    $0x0,%esi
+  mapped = 0;
+  8003e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003ea:	e9 01 01 00 00       	jmp    8004f0 <umain+0x1f7>
+    n = strtol(argv[1], 0, 0);
+  8003ef:	83 ec 04             	sub    $0x4,%esp
+  8003f2:	6a 00                	push   $0x0
+  8003f4:	6a 00                	push   $0x0
+  8003f6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8003f9:	ff 70 04             	push   0x4(%eax)
+  8003fc:	e8 f4 0a 00 00       	call   800ef5 <strtol>
+  800401:	89 c7                	mov    %eax,%edi
+  800403:	83 c4 10             	add    $0x10,%esp
+  800406:	e9 10 ff ff ff       	jmp    80031b <umain+0x22>
+    panic("pipe: %e", r);
+  80040b:	50                   	push   %eax
+  80040c:	68 e6 3e 80 00       	push   $0x803ee6
+  800411:	6a 4e                	push   $0x4e
+  800413:	68 90 3e 80 00       	push   $0x803e90
+  800418:	e8 bb 01 00 00       	call   8005d8 <_panic>
+    panic("kfork: %e", child);
+  80041d:	50                   	push   %eax
+  80041e:	68 f9 3e 80 00       	push   $0x803ef9
+  800423:	6a 50                	push   $0x50
+  800425:	68 90 3e 80 00       	push   $0x803e90
+  80042a:	e8 a9 01 00 00       	call   8005d8 <_panic>
+      panic("dup after kfork: %e", r);
+  80042f:	50                   	push   %eax
+  800430:	68 ef 3e 80 00       	push   $0x803eef
+  800435:	6a 53                	push   $0x53
+  800437:	68 90 3e 80 00       	push   $0x803e90
+  80043c:	e8 97 01 00 00       	call   8005d8 <_panic>
+      panic("write: %e", r);
+  800441:	50                   	push   %eax
+  800442:	68 03 3f 80 00       	push   $0x803f03
+  800447:	6a 55                	push   $0x55
+  800449:	68 90 3e 80 00       	push   $0x803e90
+  80044e:	e8 85 01 00 00       	call   8005d8 <_panic>
+    panic("read from dup: %e", r);
+  800453:	50                   	push   %eax
+  800454:	68 0d 3f 80 00       	push   $0x803f0d
+  800459:	6a 5a                	push   $0x5a
+  80045b:	68 90 3e 80 00       	push   $0x803e90
+  800460:	e8 73 01 00 00       	call   8005d8 <_panic>
+    for (; mapped < heap_pages[i]; mapped++) {
+      if ((r = sys_page_alloc(0, (void *) (HEAPVA + mapped * PGSIZE),
+                              PTE_P | PTE_U | PTE_W)) < 0)
+        panic("sys_page_alloc: %e", r);
+  800465:	50                   	push   %eax
+  800466:	68 b2 3e 80 00       	push   $0x803eb2
+  80046b:	68 a8 00 00 00       	push   $0xa8
+  800470:	68 90 3e 80 00       	push   $0x803e90
+  800475:	e8 5e 01 00 00       	call   8005d8 <_panic>
+    }
+
+    kernel_ms = run(kfork, n);
+  80047a:	89 fa                	mov    %edi,%edx
+  80047c:	b8 42 18 80 00       	mov    $0x801842,%eax
+  800481:	e8 ca fd ff ff       	call   800250 <run>
+  800486:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    range_ms = run(fork, n);
+  800489:	89 fa                	mov    %edi,%edx
+  80048b:	b8 3d 17 80 00       	mov    $0x80173d,%eax
+  800490:	e8 bb fd ff ff       	call   800250 <run>
+  800495:	89 45 d0             	mov    %eax,-0x30(%ebp)
+    page_ms = run(pagefork, n);
+  800498:	89 fa                	mov    %edi,%edx
+  80049a:	b8 33 00 80 00       	mov    $0x800033,%eax
+  80049f:	e8 ac fd ff ff       	call   800250 <run>
+    cprintf("forkbench: %5d KB heap  sys_fork %6d  range %6d  "
+  8004a4:	83 ec 0c             	sub    $0xc,%esp
+            "per-page %6d us/fork\n", mapped * PGSIZE / 1024,
+            kernel_ms * 1000 / n, range_ms * 1000 / n, page_ms * 1000 / n);
+  8004a7:	69 c0 e8 03 00 00    	imul   $0x3e8,%eax,%eax
+    cprintf("forkbench: %5d KB heap  sys_fork %6d  range %6d  "
+  8004ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004b2:	f7 f7                	div    %edi
+  8004b4:	50                   	push   %eax
+            kernel_ms * 1000 / n, range_ms * 1000 / n, page_ms * 1000 / n);
+  8004b5:	69 45 d0 e8 03 00 00 	imul   $0x3e8,-0x30(%ebp),%eax
+    cprintf("forkbench: %5d KB heap  sys_fork %6d  range %6d  "
+  8004bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004c1:	f7 f7                	div    %edi
+  8004c3:	50                   	push   %eax
+            kernel_ms * 1000 / n, range_ms * 1000 / n, page_ms * 1000 / n);
+  8004c4:	69 45 d4 e8 03 00 00 	imul   $0x3e8,-0x2c(%ebp),%eax
+    cprintf("forkbench: %5d KB heap  sys_fork %6d  range %6d  "
+  8004cb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004d0:	f7 f7                	div    %edi
+  8004d2:	50                   	push   %eax
+  8004d3:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  8004da:	50                   	push   %eax
+  8004db:	68 64 3f 80 00       	push   $0x803f64
+  8004e0:	e8 ce 01 00 00       	call   8006b3 <cprintf>
+  for (i = 0; i < sizeof(heap_pages) / sizeof(heap_pages[0]); i++) {
+  8004e5:	83 c6 01             	add    $0x1,%esi
+  8004e8:	83 c4 20             	add    $0x20,%esp
+  8004eb:	83 fe 06             	cmp    $0x6,%esi
+  8004ee:	74 30                	je     800520 <umain+0x227>
+    for (; mapped < heap_pages[i]; mapped++) {
+  8004f0:	39 1c b5 fc 3f 80 00 	cmp    %ebx,0x803ffc(,%esi,4)
+  8004f7:	7e 81                	jle    80047a <umain+0x181>
+      if ((r = sys_page_alloc(0, (void *) (HEAPVA + mapped * PGSIZE),
+  8004f9:	83 ec 04             	sub    $0x4,%esp
+  8004fc:	6a 07                	push   $0x7
+  8004fe:	89 d8                	mov    %ebx,%eax
+  800500:	c1 e0 0c             	shl    $0xc,%eax
+  800503:	05 00 00 00 20       	add    $0x20000000,%eax
+  800508:	50                   	push   %eax
+  800509:	6a 00                	push   $0x0
+  80050b:	e8 c0 0b 00 00       	call   8010d0 <sys_page_alloc>
+  800510:	83 c4 10             	add    $0x10,%esp
+  800513:	85 c0                	test   %eax,%eax
+  800515:	0f 88 4a ff ff ff    	js     800465 <umain+0x16c>
+    for (; mapped < heap_pages[i]; mapped++) {
+  80051b:	83 c3 01             	add    $0x1,%ebx
+  80051e:	eb d0                	jmp    8004f0 <umain+0x1f7>
+  }
+
+  kernel_ms = runtree(kfork, n);
+  800520:	89 fa                	mov    %edi,%edx
+  800522:	b8 42 18 80 00       	mov    $0x801842,%eax
+  800527:	e8 8c fd ff ff       	call   8002b8 <runtree>
+  80052c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  range_ms = runtree(fork, n);
+  80052f:	89 fa                	mov    %edi,%edx
+  800531:	b8 3d 17 80 00       	mov    $0x80173d,%eax
+  800536:	e8 7d fd ff ff       	call   8002b8 <runtree>
+  80053b:	89 c6                	mov    %eax,%esi
+  page_ms = runtree(pagefork, n);
+  80053d:	89 fa                	mov    %edi,%edx
+  80053f:	b8 33 00 80 00       	mov    $0x800033,%eax
+  800544:	e8 6f fd ff ff       	call   8002b8 <runtree>
+  cprintf("forkbench: forktree x%d, %5d KB heap  sys_fork %6d  range %6d  "
+  800549:	83 ec 08             	sub    $0x8,%esp
+  80054c:	50                   	push   %eax
+  80054d:	56                   	push   %esi
+  80054e:	ff 75 d4             	push   -0x2c(%ebp)
+  800551:	c1 e3 02             	shl    $0x2,%ebx
+  800554:	53                   	push   %ebx
+  800555:	57                   	push   %edi
+  800556:	68 ac 3f 80 00       	push   $0x803fac
+  80055b:	e8 53 01 00 00       	call   8006b3 <cprintf>
+          "per-page %6d ms\n", n, mapped * PGSIZE / 1024,
+          kernel_ms, range_ms, page_ms);
+}
+  800560:	83 c4 20             	add    $0x20,%esp
+  800563:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800566:	5b                   	pop    %ebx
+  800567:	5e                   	pop    %esi
+  800568:	5f                   	pop    %edi
+  800569:	5d                   	pop    %ebp
+  80056a:	c3                   	ret
+
+0080056b <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80056b:	55                   	push   %ebp
+  80056c:	89 e5                	mov    %esp,%ebp
+  80056e:	56                   	push   %esi
+  80056f:	53                   	push   %ebx
+  800570:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800573:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  800576:	c7 05 a0 68 80 00 00 	movl   $0x0,0x8068a0
+  80057d:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  800580:	e8 ca 0a 00 00       	call   80104f <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  800585:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80058a:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80058d:	c1 e0 04             	shl    $0x4,%eax
+  800590:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800595:	a3 a0 68 80 00       	mov    %eax,0x8068a0
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  80059a:	85 db                	test   %ebx,%ebx
+  80059c:	7e 07                	jle    8005a5 <libmain+0x3a>
+    binaryname = argv[0];
+  80059e:	8b 06                	mov    (%esi),%eax
+  8005a0:	a3 00 50 80 00       	mov    %eax,0x805000
+
+  // call user main routine
+  umain(argc, argv);
+  8005a5:	83 ec 08             	sub    $0x8,%esp
+  8005a8:	56                   	push   %esi
+  8005a9:	53                   	push   %ebx
+  8005aa:	e8 4a fd ff ff       	call   8002f9 <umain>
+
+  // exit gracefully
+  exit();
+  8005af:	e8 0a 00 00 00       	call   8005be <exit>
+}
+  8005b4:	83 c4 10             	add    $0x10,%esp
+  8005b7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8005ba:	5b                   	pop    %ebx
+  8005bb:	5e                   	pop    %esi
+  8005bc:	5d                   	pop    %ebp
+  8005bd:	c3                   	ret
+
+008005be <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8005be:	55                   	push   %ebp
+  8005bf:	89 e5                	mov    %esp,%ebp
+  8005c1:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  8005c4:	e8 b4 15 00 00       	call   801b7d <close_all>
+  sys_env_destroy(0);
+  8005c9:	83 ec 0c             	sub    $0xc,%esp
+  8005cc:	6a 00                	push   $0x0
+  8005ce:	e8 3b 0a 00 00       	call   80100e <sys_env_destroy>
+}
+  8005d3:	83 c4 10             	add    $0x10,%esp
+  8005d6:	c9                   	leave
+  8005d7:	c3                   	ret
+
+008005d8 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8005d8:	55                   	push   %ebp
+  8005d9:	89 e5                	mov    %esp,%ebp
+  8005db:	56                   	push   %esi
+  8005dc:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  8005dd:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  8005e0:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  8005e6:	e8 64 0a 00 00       	call   80104f <sys_getenvid>
+  8005eb:	83 ec 0c             	sub    $0xc,%esp
+  8005ee:	ff 75 0c             	push   0xc(%ebp)
+  8005f1:	ff 75 08             	push   0x8(%ebp)
+  8005f4:	56                   	push   %esi
+  8005f5:	50                   	push   %eax
+  8005f6:	68 20 40 80 00       	push   $0x804020
+  8005fb:	e8 b3 00 00 00       	call   8006b3 <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  800600:	83 c4 18             	add    $0x18,%esp
+  800603:	53                   	push   %ebx
+  800604:	ff 75 10             	push   0x10(%ebp)
+  800607:	e8 56 00 00 00       	call   800662 <vcprintf>
+  cprintf("\n");
+  80060c:	c7 04 24 e0 44 80 00 	movl   $0x8044e0,(%esp)
+  800613:	e8 9b 00 00 00       	call   8006b3 <cprintf>
+  800618:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  80061b:	cc                   	int3
+  while (1)
+  80061c:	eb fd                	jmp    80061b <_panic+0x43>
+
+0080061e <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80061e:	55                   	push   %ebp
+  80061f:	89 e5                	mov    %esp,%ebp
+  800621:	53                   	push   %ebx
+  800622:	83 ec 04             	sub    $0x4,%esp
+  800625:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  800628:	8b 13                	mov    (%ebx),%edx
+  80062a:	8d 42 01             	lea    0x1(%edx),%eax
+  80062d:	89 03                	mov    %eax,(%ebx)
+  80062f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800632:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  800636:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80063b:	74 09                	je     800646 <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  80063d:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800641:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800644:	c9                   	leave
+  800645:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  800646:	83 ec 08             	sub    $0x8,%esp
+  800649:	68 ff 00 00 00       	push   $0xff
+  80064e:	8d 43 08             	lea    0x8(%ebx),%eax
+  800651:	50                   	push   %eax
+  800652:	e8 7a 09 00 00       	call   800fd1 <sys_cputs>
+    b->idx = 0;
+  800657:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80065d:	83 c4 10             	add    $0x10,%esp
+  800660:	eb db                	jmp    80063d <putch+0x1f>
+
+00800662 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800662:	55                   	push   %ebp
+  800663:	89 e5                	mov    %esp,%ebp
+  800665:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  80066b:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800672:	00 00 00 
+  b.cnt = 0;
+  800675:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80067c:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  80067f:	ff 75 0c             	push   0xc(%ebp)
+  800682:	ff 75 08             	push   0x8(%ebp)
+  800685:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80068b:	50                   	push   %eax
+  80068c:	68 1e 06 80 00       	push   $0x80061e
+  800691:	e8 14 01 00 00       	call   8007aa <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  800696:	83 c4 08             	add    $0x8,%esp
+  800699:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80069f:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8006a5:	50                   	push   %eax
+  8006a6:	e8 26 09 00 00       	call   800fd1 <sys_cputs>
+
+  return b.cnt;
+}
+  8006ab:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8006b1:	c9                   	leave
+  8006b2:	c3                   	ret
+
+008006b3 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8006b3:	55                   	push   %ebp
+  8006b4:	89 e5                	mov    %esp,%ebp
+  8006b6:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  8006b9:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  8006bc:	50                   	push   %eax
+  8006bd:	ff 75 08             	push   0x8(%ebp)
+  8006c0:	e8 9d ff ff ff       	call   800662 <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  8006c5:	c9                   	leave
+  8006c6:	c3                   	ret
+
+008006c7 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  8006c7:	55                   	push   %ebp
+  8006c8:	89 e5                	mov    %esp,%ebp
+  8006ca:	57                   	push   %edi
+  8006cb:	56                   	push   %esi
+  8006cc:	53                   	push   %ebx
+  8006cd:	83 ec 1c             	sub    $0x1c,%esp
+  8006d0:	89 c7                	mov    %eax,%edi
+  8006d2:	89 d6                	mov    %edx,%esi
+  8006d4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006d7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8006da:	89 d1                	mov    %edx,%ecx
+  8006dc:	89 c2                	mov    %eax,%edx
+  8006de:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006e1:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006e4:	8b 45 10             	mov    0x10(%ebp),%eax
+  8006e7:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  8006ea:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006ed:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8006f4:	39 c2                	cmp    %eax,%edx
+  8006f6:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8006f9:	72 3e                	jb     800739 <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  8006fb:	83 ec 0c             	sub    $0xc,%esp
+  8006fe:	ff 75 18             	push   0x18(%ebp)
+  800701:	83 eb 01             	sub    $0x1,%ebx
+  800704:	53                   	push   %ebx
+  800705:	50                   	push   %eax
+  800706:	83 ec 08             	sub    $0x8,%esp
+  800709:	ff 75 e4             	push   -0x1c(%ebp)
+  80070c:	ff 75 e0             	push   -0x20(%ebp)
+  80070f:	ff 75 dc             	push   -0x24(%ebp)
+  800712:	ff 75 d8             	push   -0x28(%ebp)
+  800715:	e8 e1 35 00 00       	call   803cfb <__udivdi3>
+  80071a:	83 c4 18             	add    $0x18,%esp
+  80071d:	52                   	push   %edx
+  80071e:	50                   	push   %eax
+  80071f:	89 f2                	mov    %esi,%edx
+  800721:	89 f8                	mov    %edi,%eax
+  800723:	e8 9f ff ff ff       	call   8006c7 <printnum>
+  800728:	83 c4 20             	add    $0x20,%esp
+  80072b:	eb 13                	jmp    800740 <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  80072d:	83 ec 08             	sub    $0x8,%esp
+  800730:	56                   	push   %esi
+  800731:	ff 75 18             	push   0x18(%ebp)
+  800734:	ff d7                	call   *%edi
+  800736:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  800739:	83 eb 01             	sub    $0x1,%ebx
+  80073c:	85 db                	test   %ebx,%ebx
+  80073e:	7f ed                	jg     80072d <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  800740:	83 ec 08             	sub    $0x8,%esp
+  800743:	56                   	push   %esi
+  800744:	83 ec 04             	sub    $0x4,%esp
+  800747:	ff 75 e4             	push   -0x1c(%ebp)
+  80074a:	ff 75 e0             	push   -0x20(%ebp)
+  80074d:	ff 75 dc             	push   -0x24(%ebp)
+  800750:	ff 75 d8             	push   -0x28(%ebp)
+  800753:	e8 c4 35 00 00       	call   803d1c <__umoddi3>
+  800758:	83 c4 14             	add    $0x14,%esp
+  80075b:	0f be 80 43 40 80 00 	movsbl 0x804043(%eax),%eax
+  800762:	50                   	push   %eax
+  800763:	ff d7                	call   *%edi
+}
+  800765:	83 c4 10             	add    $0x10,%esp
+  800768:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80076b:	5b                   	pop    %ebx
+  80076c:	5e                   	pop    %esi
+  80076d:	5f                   	pop    %edi
+  80076e:	5d                   	pop    %ebp
+  80076f:	c3                   	ret
+
+00800770 <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800770:	55                   	push   %ebp
+  800771:	89 e5                	mov    %esp,%ebp
+  800773:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  800776:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  80077a:	8b 10                	mov    (%eax),%edx
+  80077c:	3b 50 04             	cmp    0x4(%eax),%edx
+  80077f:	73 0a                	jae    80078b <sprintputch+0x1b>
+    *b->buf++ = ch;
+  800781:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800784:	89 08                	mov    %ecx,(%eax)
+  800786:	8b 45 08             	mov    0x8(%ebp),%eax
+  800789:	88 02                	mov    %al,(%edx)
+}
+  80078b:	5d                   	pop    %ebp
+  80078c:	c3                   	ret
+
+0080078d <printfmt>:
+{
+  80078d:	55                   	push   %ebp
+  80078e:	89 e5                	mov    %esp,%ebp
+  800790:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  800793:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  800796:	50                   	push   %eax
+  800797:	ff 75 10             	push   0x10(%ebp)
+  80079a:	ff 75 0c             	push   0xc(%ebp)
+  80079d:	ff 75 08             	push   0x8(%ebp)
+  8007a0:	e8 05 00 00 00       	call   8007aa <vprintfmt>
+}
+  8007a5:	83 c4 10             	add    $0x10,%esp
+  8007a8:	c9                   	leave
+  8007a9:	c3                   	ret
+
+008007aa <vprintfmt>:
+{
+  8007aa:	55                   	push   %ebp
+  8007ab:	89 e5                	mov    %esp,%ebp
+  8007ad:	57                   	push   %edi
+  8007ae:	56                   	push   %esi
+  8007af:	53                   	push   %ebx
+  8007b0:	83 ec 2c             	sub    $0x2c,%esp
+  8007b3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007b6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8007b9:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8007bc:	eb 0a                	jmp    8007c8 <vprintfmt+0x1e>
+      putch(ch, putdat);
+  8007be:	83 ec 08             	sub    $0x8,%esp
+  8007c1:	53                   	push   %ebx
+  8007c2:	50                   	push   %eax
+  8007c3:	ff d6                	call   *%esi
+  8007c5:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  8007c8:	83 c7 01             	add    $0x1,%edi
+  8007cb:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8007cf:	83 f8 25             	cmp    $0x25,%eax
+  8007d2:	74 0c                	je     8007e0 <vprintfmt+0x36>
+      if (ch == '\0')
+  8007d4:	85 c0                	test   %eax,%eax
+  8007d6:	75 e6                	jne    8007be <vprintfmt+0x14>
+}
+  8007d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007db:	5b                   	pop    %ebx
+  8007dc:	5e                   	pop    %esi
+  8007dd:	5f                   	pop    %edi
+  8007de:	5d                   	pop    %ebp
+  8007df:	c3                   	ret
+    padc = ' ';
+  8007e0:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  8007e4:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  8007eb:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  8007f2:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  8007f9:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  8007fe:	8d 47 01             	lea    0x1(%edi),%eax
+  800801:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800804:	0f b6 17             	movzbl (%edi),%edx
+  800807:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80080a:	3c 55                	cmp    $0x55,%al
+  80080c:	0f 87 cf 03 00 00    	ja     800be1 <vprintfmt+0x437>
+  800812:	0f b6 c0             	movzbl %al,%eax
+  800815:	ff 24 85 80 41 80 00 	jmp    *0x804180(,%eax,4)
+  80081c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  80081f:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800823:	eb d9                	jmp    8007fe <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  800825:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800828:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80082c:	eb d0                	jmp    8007fe <vprintfmt+0x54>
+  80082e:	0f b6 d2             	movzbl %dl,%edx
+  800831:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  800834:	b8 00 00 00 00       	mov    $0x0,%eax
+  800839:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  80083c:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80083f:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  800843:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  800846:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800849:	83 f9 09             	cmp    $0x9,%ecx
+  80084c:	77 55                	ja     8008a3 <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  80084e:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  800851:	eb e9                	jmp    80083c <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  800853:	8b 45 14             	mov    0x14(%ebp),%eax
+  800856:	8b 00                	mov    (%eax),%eax
+  800858:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80085b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80085e:	8d 40 04             	lea    0x4(%eax),%eax
+  800861:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  800864:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  800867:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80086b:	79 91                	jns    8007fe <vprintfmt+0x54>
+        width = precision, precision = -1;
+  80086d:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800870:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800873:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80087a:	eb 82                	jmp    8007fe <vprintfmt+0x54>
+      if (width < 0)
+  80087c:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80087f:	85 d2                	test   %edx,%edx
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+  800886:	0f 49 c2             	cmovns %edx,%eax
+  800889:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  80088c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  80088f:	e9 6a ff ff ff       	jmp    8007fe <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  800894:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  800897:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  80089e:	e9 5b ff ff ff       	jmp    8007fe <vprintfmt+0x54>
+  8008a3:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8008a6:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8008a9:	eb bc                	jmp    800867 <vprintfmt+0xbd>
+      lflag++;
+  8008ab:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  8008ae:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  8008b1:	e9 48 ff ff ff       	jmp    8007fe <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  8008b6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008b9:	8d 78 04             	lea    0x4(%eax),%edi
+  8008bc:	83 ec 08             	sub    $0x8,%esp
+  8008bf:	53                   	push   %ebx
+  8008c0:	ff 30                	push   (%eax)
+  8008c2:	ff d6                	call   *%esi
+      break;
+  8008c4:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  8008c7:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  8008ca:	e9 b1 02 00 00       	jmp    800b80 <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  8008cf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008d2:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  8008d5:	8b 10                	mov    (%eax),%edx
+  8008d7:	89 d0                	mov    %edx,%eax
+  8008d9:	f7 d8                	neg    %eax
+  8008db:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8008de:	83 f8 10             	cmp    $0x10,%eax
+  8008e1:	7f 23                	jg     800906 <vprintfmt+0x15c>
+  8008e3:	8b 14 85 e0 42 80 00 	mov    0x8042e0(,%eax,4),%edx
+  8008ea:	85 d2                	test   %edx,%edx
+  8008ec:	74 18                	je     800906 <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  8008ee:	52                   	push   %edx
+  8008ef:	68 8a 44 80 00       	push   $0x80448a
+  8008f4:	53                   	push   %ebx
+  8008f5:	56                   	push   %esi
+  8008f6:	e8 92 fe ff ff       	call   80078d <printfmt>
+  8008fb:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  8008fe:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800901:	e9 7a 02 00 00       	jmp    800b80 <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  800906:	50                   	push   %eax
+  800907:	68 5b 40 80 00       	push   $0x80405b
+  80090c:	53                   	push   %ebx
+  80090d:	56                   	push   %esi
+  80090e:	e8 7a fe ff ff       	call   80078d <printfmt>
+  800913:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  800916:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  800919:	e9 62 02 00 00       	jmp    800b80 <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  80091e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800921:	83 c0 04             	add    $0x4,%eax
+  800924:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800927:	8b 45 14             	mov    0x14(%ebp),%eax
+  80092a:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  80092c:	85 c9                	test   %ecx,%ecx
+  80092e:	b8 54 40 80 00       	mov    $0x804054,%eax
+  800933:	0f 45 c1             	cmovne %ecx,%eax
+  800936:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  800939:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80093d:	7e 06                	jle    800945 <vprintfmt+0x19b>
+  80093f:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800943:	75 0b                	jne    800950 <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800945:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800948:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80094b:	89 75 08             	mov    %esi,0x8(%ebp)
+  80094e:	eb 5c                	jmp    8009ac <vprintfmt+0x202>
+  800950:	83 ec 08             	sub    $0x8,%esp
+  800953:	ff 75 d0             	push   -0x30(%ebp)
+  800956:	ff 75 cc             	push   -0x34(%ebp)
+  800959:	e8 20 03 00 00       	call   800c7e <strnlen>
+  80095e:	89 c2                	mov    %eax,%edx
+  800960:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800963:	29 d0                	sub    %edx,%eax
+  800965:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  800968:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80096c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80096f:	89 75 08             	mov    %esi,0x8(%ebp)
+  800972:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800974:	eb 0e                	jmp    800984 <vprintfmt+0x1da>
+          putch(padc, putdat);
+  800976:	83 ec 08             	sub    $0x8,%esp
+  800979:	53                   	push   %ebx
+  80097a:	57                   	push   %edi
+  80097b:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  80097e:	83 ee 01             	sub    $0x1,%esi
+  800981:	83 c4 10             	add    $0x10,%esp
+  800984:	85 f6                	test   %esi,%esi
+  800986:	7f ee                	jg     800976 <vprintfmt+0x1cc>
+  800988:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80098b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80098e:	85 c0                	test   %eax,%eax
+  800990:	ba 00 00 00 00       	mov    $0x0,%edx
+  800995:	0f 49 d0             	cmovns %eax,%edx
+  800998:	29 d0                	sub    %edx,%eax
+  80099a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80099d:	eb a6                	jmp    800945 <vprintfmt+0x19b>
+          putch(ch, putdat);
+  80099f:	83 ec 08             	sub    $0x8,%esp
+  8009a2:	53                   	push   %ebx
+  8009a3:	52                   	push   %edx
+  8009a4:	ff 55 08             	call   *0x8(%ebp)
+  8009a7:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8009aa:	89 f1                	mov    %esi,%ecx
+  8009ac:	8d 71 01             	lea    0x1(%ecx),%esi
+  8009af:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8009b3:	0f be d0             	movsbl %al,%edx
+  8009b6:	85 d2                	test   %edx,%edx
+  8009b8:	74 28                	je     8009e2 <vprintfmt+0x238>
+  8009ba:	85 ff                	test   %edi,%edi
+  8009bc:	78 05                	js     8009c3 <vprintfmt+0x219>
+  8009be:	83 ef 01             	sub    $0x1,%edi
+  8009c1:	78 30                	js     8009f3 <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  8009c3:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8009c7:	74 d6                	je     80099f <vprintfmt+0x1f5>
+  8009c9:	0f be c0             	movsbl %al,%eax
+  8009cc:	83 e8 20             	sub    $0x20,%eax
+  8009cf:	83 f8 5e             	cmp    $0x5e,%eax
+  8009d2:	76 cb                	jbe    80099f <vprintfmt+0x1f5>
+          putch('?', putdat);
+  8009d4:	83 ec 08             	sub    $0x8,%esp
+  8009d7:	53                   	push   %ebx
+  8009d8:	6a 3f                	push   $0x3f
+  8009da:	ff 55 08             	call   *0x8(%ebp)
+  8009dd:	83 c4 10             	add    $0x10,%esp
+  8009e0:	eb c8                	jmp    8009aa <vprintfmt+0x200>
+  8009e2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009e5:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8009e8:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8009eb:	01 d0                	add    %edx,%eax
+  8009ed:	29 c8                	sub    %ecx,%eax
+  8009ef:	89 c7                	mov    %eax,%edi
+  8009f1:	eb 13                	jmp    800a06 <vprintfmt+0x25c>
+  8009f3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009f6:	eb ed                	jmp    8009e5 <vprintfmt+0x23b>
+        putch(' ', putdat);
+  8009f8:	83 ec 08             	sub    $0x8,%esp
+  8009fb:	53                   	push   %ebx
+  8009fc:	6a 20                	push   $0x20
+  8009fe:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  800a00:	83 ef 01             	sub    $0x1,%edi
+  800a03:	83 c4 10             	add    $0x10,%esp
+  800a06:	85 ff                	test   %edi,%edi
+  800a08:	7f ee                	jg     8009f8 <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  800a0a:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800a0d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a10:	e9 6b 01 00 00       	jmp    800b80 <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  800a15:	83 f9 01             	cmp    $0x1,%ecx
+  800a18:	7f 1f                	jg     800a39 <vprintfmt+0x28f>
+  else if (lflag)
+  800a1a:	85 c9                	test   %ecx,%ecx
+  800a1c:	74 67                	je     800a85 <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  800a1e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a21:	8b 00                	mov    (%eax),%eax
+  800a23:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800a26:	89 c1                	mov    %eax,%ecx
+  800a28:	c1 f9 1f             	sar    $0x1f,%ecx
+  800a2b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800a2e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a31:	8d 40 04             	lea    0x4(%eax),%eax
+  800a34:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a37:	eb 17                	jmp    800a50 <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  800a39:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a3c:	8b 50 04             	mov    0x4(%eax),%edx
+  800a3f:	8b 00                	mov    (%eax),%eax
+  800a41:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800a44:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800a47:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a4a:	8d 40 08             	lea    0x8(%eax),%eax
+  800a4d:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  800a50:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800a53:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  800a56:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  800a5b:	85 c9                	test   %ecx,%ecx
+  800a5d:	0f 89 03 01 00 00    	jns    800b66 <vprintfmt+0x3bc>
+        putch('-', putdat);
+  800a63:	83 ec 08             	sub    $0x8,%esp
+  800a66:	53                   	push   %ebx
+  800a67:	6a 2d                	push   $0x2d
+  800a69:	ff d6                	call   *%esi
+        num = -(long long)num;
+  800a6b:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800a6e:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800a71:	f7 da                	neg    %edx
+  800a73:	83 d1 00             	adc    $0x0,%ecx
+  800a76:	f7 d9                	neg    %ecx
+  800a78:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  800a7b:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800a80:	e9 e1 00 00 00       	jmp    800b66 <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  800a85:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a88:	8b 00                	mov    (%eax),%eax
+  800a8a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800a8d:	89 c1                	mov    %eax,%ecx
+  800a8f:	c1 f9 1f             	sar    $0x1f,%ecx
+  800a92:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800a95:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a98:	8d 40 04             	lea    0x4(%eax),%eax
+  800a9b:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a9e:	eb b0                	jmp    800a50 <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  800aa0:	83 f9 01             	cmp    $0x1,%ecx
+  800aa3:	7f 1e                	jg     800ac3 <vprintfmt+0x319>
+  else if (lflag)
+  800aa5:	85 c9                	test   %ecx,%ecx
+  800aa7:	74 32                	je     800adb <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  800aa9:	8b 45 14             	mov    0x14(%ebp),%eax
+  800aac:	8b 10                	mov    (%eax),%edx
+  800aae:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ab3:	8d 40 04             	lea    0x4(%eax),%eax
+  800ab6:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800ab9:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  800abe:	e9 a3 00 00 00       	jmp    800b66 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800ac3:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ac6:	8b 10                	mov    (%eax),%edx
+  800ac8:	8b 48 04             	mov    0x4(%eax),%ecx
+  800acb:	8d 40 08             	lea    0x8(%eax),%eax
+  800ace:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800ad1:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  800ad6:	e9 8b 00 00 00       	jmp    800b66 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800adb:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ade:	8b 10                	mov    (%eax),%edx
+  800ae0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ae5:	8d 40 04             	lea    0x4(%eax),%eax
+  800ae8:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800aeb:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  800af0:	eb 74                	jmp    800b66 <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  800af2:	83 f9 01             	cmp    $0x1,%ecx
+  800af5:	7f 1b                	jg     800b12 <vprintfmt+0x368>
+  else if (lflag)
+  800af7:	85 c9                	test   %ecx,%ecx
+  800af9:	74 2c                	je     800b27 <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  800afb:	8b 45 14             	mov    0x14(%ebp),%eax
+  800afe:	8b 10                	mov    (%eax),%edx
+  800b00:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b05:	8d 40 04             	lea    0x4(%eax),%eax
+  800b08:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800b0b:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  800b10:	eb 54                	jmp    800b66 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800b12:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b15:	8b 10                	mov    (%eax),%edx
+  800b17:	8b 48 04             	mov    0x4(%eax),%ecx
+  800b1a:	8d 40 08             	lea    0x8(%eax),%eax
+  800b1d:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800b20:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  800b25:	eb 3f                	jmp    800b66 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800b27:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b2a:	8b 10                	mov    (%eax),%edx
+  800b2c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b31:	8d 40 04             	lea    0x4(%eax),%eax
+  800b34:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800b37:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  800b3c:	eb 28                	jmp    800b66 <vprintfmt+0x3bc>
+      putch('0', putdat);
+  800b3e:	83 ec 08             	sub    $0x8,%esp
+  800b41:	53                   	push   %ebx
+  800b42:	6a 30                	push   $0x30
+  800b44:	ff d6                	call   *%esi
+      putch('x', putdat);
+  800b46:	83 c4 08             	add    $0x8,%esp
+  800b49:	53                   	push   %ebx
+  800b4a:	6a 78                	push   $0x78
+  800b4c:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  800b4e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b51:	8b 10                	mov    (%eax),%edx
+  800b53:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  800b58:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  800b5b:	8d 40 04             	lea    0x4(%eax),%eax
+  800b5e:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800b61:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  800b66:	83 ec 0c             	sub    $0xc,%esp
+  800b69:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800b6d:	50                   	push   %eax
+  800b6e:	ff 75 e0             	push   -0x20(%ebp)
+  800b71:	57                   	push   %edi
+  800b72:	51                   	push   %ecx
+  800b73:	52                   	push   %edx
+  800b74:	89 da                	mov    %ebx,%edx
+  800b76:	89 f0                	mov    %esi,%eax
+  800b78:	e8 4a fb ff ff       	call   8006c7 <printnum>
+      break;
+  800b7d:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  800b80:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  800b83:	e9 40 fc ff ff       	jmp    8007c8 <vprintfmt+0x1e>
+  if (lflag >= 2)
+  800b88:	83 f9 01             	cmp    $0x1,%ecx
+  800b8b:	7f 1b                	jg     800ba8 <vprintfmt+0x3fe>
+  else if (lflag)
+  800b8d:	85 c9                	test   %ecx,%ecx
+  800b8f:	74 2c                	je     800bbd <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  800b91:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b94:	8b 10                	mov    (%eax),%edx
+  800b96:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b9b:	8d 40 04             	lea    0x4(%eax),%eax
+  800b9e:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800ba1:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  800ba6:	eb be                	jmp    800b66 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800ba8:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bab:	8b 10                	mov    (%eax),%edx
+  800bad:	8b 48 04             	mov    0x4(%eax),%ecx
+  800bb0:	8d 40 08             	lea    0x8(%eax),%eax
+  800bb3:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800bb6:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  800bbb:	eb a9                	jmp    800b66 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800bbd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bc0:	8b 10                	mov    (%eax),%edx
+  800bc2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bc7:	8d 40 04             	lea    0x4(%eax),%eax
+  800bca:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800bcd:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  800bd2:	eb 92                	jmp    800b66 <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  800bd4:	83 ec 08             	sub    $0x8,%esp
+  800bd7:	53                   	push   %ebx
+  800bd8:	6a 25                	push   $0x25
+  800bda:	ff d6                	call   *%esi
+      break;
+  800bdc:	83 c4 10             	add    $0x10,%esp
+  800bdf:	eb 9f                	jmp    800b80 <vprintfmt+0x3d6>
+      putch('%', putdat);
+  800be1:	83 ec 08             	sub    $0x8,%esp
+  800be4:	53                   	push   %ebx
+  800be5:	6a 25                	push   $0x25
+  800be7:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  800be9:	83 c4 10             	add    $0x10,%esp
+  800bec:	89 f8                	mov    %edi,%eax
+  800bee:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800bf2:	74 05                	je     800bf9 <vprintfmt+0x44f>
+  800bf4:	83 e8 01             	sub    $0x1,%eax
+  800bf7:	eb f5                	jmp    800bee <vprintfmt+0x444>
+  800bf9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800bfc:	eb 82                	jmp    800b80 <vprintfmt+0x3d6>
+
+00800bfe <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800bfe:	55                   	push   %ebp
+  800bff:	89 e5                	mov    %esp,%ebp
+  800c01:	83 ec 18             	sub    $0x18,%esp
+  800c04:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c07:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  800c0a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800c0d:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800c11:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800c14:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  800c1b:	85 c0                	test   %eax,%eax
+  800c1d:	74 26                	je     800c45 <vsnprintf+0x47>
+  800c1f:	85 d2                	test   %edx,%edx
+  800c21:	7e 22                	jle    800c45 <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800c23:	ff 75 14             	push   0x14(%ebp)
+  800c26:	ff 75 10             	push   0x10(%ebp)
+  800c29:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800c2c:	50                   	push   %eax
+  800c2d:	68 70 07 80 00       	push   $0x800770
+  800c32:	e8 73 fb ff ff       	call   8007aa <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800c37:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800c3a:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  800c3d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800c40:	83 c4 10             	add    $0x10,%esp
+}
+  800c43:	c9                   	leave
+  800c44:	c3                   	ret
+    return -E_INVAL;
+  800c45:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c4a:	eb f7                	jmp    800c43 <vsnprintf+0x45>
+
+00800c4c <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800c4c:	55                   	push   %ebp
+  800c4d:	89 e5                	mov    %esp,%ebp
+  800c4f:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  800c52:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  800c55:	50                   	push   %eax
+  800c56:	ff 75 10             	push   0x10(%ebp)
+  800c59:	ff 75 0c             	push   0xc(%ebp)
+  800c5c:	ff 75 08             	push   0x8(%ebp)
+  800c5f:	e8 9a ff ff ff       	call   800bfe <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  800c64:	c9                   	leave
+  800c65:	c3                   	ret
+
+00800c66 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800c66:	55                   	push   %ebp
+  800c67:	89 e5                	mov    %esp,%ebp
+  800c69:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  800c6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c71:	eb 03                	jmp    800c76 <strlen+0x10>
+    n++;
+  800c73:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  800c76:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800c7a:	75 f7                	jne    800c73 <strlen+0xd>
+  return n;
+}
+  800c7c:	5d                   	pop    %ebp
+  800c7d:	c3                   	ret
+
+00800c7e <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800c7e:	55                   	push   %ebp
+  800c7f:	89 e5                	mov    %esp,%ebp
+  800c81:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800c84:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800c87:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c8c:	eb 03                	jmp    800c91 <strnlen+0x13>
+    n++;
+  800c8e:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800c91:	39 d0                	cmp    %edx,%eax
+  800c93:	74 08                	je     800c9d <strnlen+0x1f>
+  800c95:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800c99:	75 f3                	jne    800c8e <strnlen+0x10>
+  800c9b:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  800c9d:	89 d0                	mov    %edx,%eax
+  800c9f:	5d                   	pop    %ebp
+  800ca0:	c3                   	ret
+
+00800ca1 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800ca1:	55                   	push   %ebp
+  800ca2:	89 e5                	mov    %esp,%ebp
+  800ca4:	53                   	push   %ebx
+  800ca5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ca8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  800cab:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cb0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800cb4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800cb7:	83 c0 01             	add    $0x1,%eax
+  800cba:	84 d2                	test   %dl,%dl
+  800cbc:	75 f2                	jne    800cb0 <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  800cbe:	89 c8                	mov    %ecx,%eax
+  800cc0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800cc3:	c9                   	leave
+  800cc4:	c3                   	ret
+
+00800cc5 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800cc5:	55                   	push   %ebp
+  800cc6:	89 e5                	mov    %esp,%ebp
+  800cc8:	53                   	push   %ebx
+  800cc9:	83 ec 10             	sub    $0x10,%esp
+  800ccc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  800ccf:	53                   	push   %ebx
+  800cd0:	e8 91 ff ff ff       	call   800c66 <strlen>
+  800cd5:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  800cd8:	ff 75 0c             	push   0xc(%ebp)
+  800cdb:	01 d8                	add    %ebx,%eax
+  800cdd:	50                   	push   %eax
+  800cde:	e8 be ff ff ff       	call   800ca1 <strcpy>
+  return dst;
+}
+  800ce3:	89 d8                	mov    %ebx,%eax
+  800ce5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ce8:	c9                   	leave
+  800ce9:	c3                   	ret
+
+00800cea <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  800cea:	55                   	push   %ebp
+  800ceb:	89 e5                	mov    %esp,%ebp
+  800ced:	56                   	push   %esi
+  800cee:	53                   	push   %ebx
+  800cef:	8b 75 08             	mov    0x8(%ebp),%esi
+  800cf2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  800cf5:	89 f3                	mov    %esi,%ebx
+  800cf7:	03 5d 10             	add    0x10(%ebp),%ebx
+  800cfa:	89 f0                	mov    %esi,%eax
+  800cfc:	eb 0f                	jmp    800d0d <strncpy+0x23>
+    *dst++ = *src;
+  800cfe:	83 c0 01             	add    $0x1,%eax
+  800d01:	0f b6 0a             	movzbl (%edx),%ecx
+  800d04:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  800d07:	80 f9 01             	cmp    $0x1,%cl
+  800d0a:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  800d0d:	39 d8                	cmp    %ebx,%eax
+  800d0f:	75 ed                	jne    800cfe <strncpy+0x14>
+  }
+  return ret;
+}
+  800d11:	89 f0                	mov    %esi,%eax
+  800d13:	5b                   	pop    %ebx
+  800d14:	5e                   	pop    %esi
+  800d15:	5d                   	pop    %ebp
+  800d16:	c3                   	ret
+
+00800d17 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800d17:	55                   	push   %ebp
+  800d18:	89 e5                	mov    %esp,%ebp
+  800d1a:	56                   	push   %esi
+  800d1b:	53                   	push   %ebx
+  800d1c:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d1f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d22:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  800d25:	89 f0                	mov    %esi,%eax
+  800d27:	85 d2                	test   %edx,%edx
+  800d29:	74 21                	je     800d4c <strlcpy+0x35>
+  800d2b:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800d2f:	89 f2                	mov    %esi,%edx
+  800d31:	eb 09                	jmp    800d3c <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  800d33:	83 c1 01             	add    $0x1,%ecx
+  800d36:	83 c2 01             	add    $0x1,%edx
+  800d39:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  800d3c:	39 c2                	cmp    %eax,%edx
+  800d3e:	74 09                	je     800d49 <strlcpy+0x32>
+  800d40:	0f b6 19             	movzbl (%ecx),%ebx
+  800d43:	84 db                	test   %bl,%bl
+  800d45:	75 ec                	jne    800d33 <strlcpy+0x1c>
+  800d47:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  800d49:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  800d4c:	29 f0                	sub    %esi,%eax
+}
+  800d4e:	5b                   	pop    %ebx
+  800d4f:	5e                   	pop    %esi
+  800d50:	5d                   	pop    %ebp
+  800d51:	c3                   	ret
+
+00800d52 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800d52:	55                   	push   %ebp
+  800d53:	89 e5                	mov    %esp,%ebp
+  800d55:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800d58:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  800d5b:	eb 06                	jmp    800d63 <strcmp+0x11>
+    p++, q++;
+  800d5d:	83 c1 01             	add    $0x1,%ecx
+  800d60:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  800d63:	0f b6 01             	movzbl (%ecx),%eax
+  800d66:	84 c0                	test   %al,%al
+  800d68:	74 04                	je     800d6e <strcmp+0x1c>
+  800d6a:	3a 02                	cmp    (%edx),%al
+  800d6c:	74 ef                	je     800d5d <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  800d6e:	0f b6 c0             	movzbl %al,%eax
+  800d71:	0f b6 12             	movzbl (%edx),%edx
+  800d74:	29 d0                	sub    %edx,%eax
+}
+  800d76:	5d                   	pop    %ebp
+  800d77:	c3                   	ret
+
+00800d78 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800d78:	55                   	push   %ebp
+  800d79:	89 e5                	mov    %esp,%ebp
+  800d7b:	53                   	push   %ebx
+  800d7c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d7f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d82:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  800d85:	eb 09                	jmp    800d90 <strncmp+0x18>
+    n--, p++, q++;
+  800d87:	83 ea 01             	sub    $0x1,%edx
+  800d8a:	83 c0 01             	add    $0x1,%eax
+  800d8d:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  800d90:	85 d2                	test   %edx,%edx
+  800d92:	74 18                	je     800dac <strncmp+0x34>
+  800d94:	0f b6 18             	movzbl (%eax),%ebx
+  800d97:	84 db                	test   %bl,%bl
+  800d99:	74 04                	je     800d9f <strncmp+0x27>
+  800d9b:	3a 19                	cmp    (%ecx),%bl
+  800d9d:	74 e8                	je     800d87 <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d9f:	0f b6 00             	movzbl (%eax),%eax
+  800da2:	0f b6 11             	movzbl (%ecx),%edx
+  800da5:	29 d0                	sub    %edx,%eax
+}
+  800da7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800daa:	c9                   	leave
+  800dab:	c3                   	ret
+    return 0;
+  800dac:	b8 00 00 00 00       	mov    $0x0,%eax
+  800db1:	eb f4                	jmp    800da7 <strncmp+0x2f>
+
+00800db3 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800db3:	55                   	push   %ebp
+  800db4:	89 e5                	mov    %esp,%ebp
+  800db6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800db9:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800dbd:	eb 03                	jmp    800dc2 <strchr+0xf>
+  800dbf:	83 c0 01             	add    $0x1,%eax
+  800dc2:	0f b6 10             	movzbl (%eax),%edx
+  800dc5:	84 d2                	test   %dl,%dl
+  800dc7:	74 06                	je     800dcf <strchr+0x1c>
+    if (*s == c)
+  800dc9:	38 ca                	cmp    %cl,%dl
+  800dcb:	75 f2                	jne    800dbf <strchr+0xc>
+  800dcd:	eb 05                	jmp    800dd4 <strchr+0x21>
+      return (char*)s;
+  return 0;
+  800dcf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800dd4:	5d                   	pop    %ebp
+  800dd5:	c3                   	ret
+
+00800dd6 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800dd6:	55                   	push   %ebp
+  800dd7:	89 e5                	mov    %esp,%ebp
+  800dd9:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ddc:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800de0:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  800de3:	38 ca                	cmp    %cl,%dl
+  800de5:	74 09                	je     800df0 <strfind+0x1a>
+  800de7:	84 d2                	test   %dl,%dl
+  800de9:	74 05                	je     800df0 <strfind+0x1a>
+  for (; *s; s++)
+  800deb:	83 c0 01             	add    $0x1,%eax
+  800dee:	eb f0                	jmp    800de0 <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  800df0:	5d                   	pop    %ebp
+  800df1:	c3                   	ret
+
+00800df2 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800df2:	55                   	push   %ebp
+  800df3:	89 e5                	mov    %esp,%ebp
+  800df5:	57                   	push   %edi
+  800df6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800df9:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  800dfc:	85 c9                	test   %ecx,%ecx
+  800dfe:	74 20                	je     800e20 <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  800e00:	89 f8                	mov    %edi,%eax
+  800e02:	09 c8                	or     %ecx,%eax
+  800e04:	a8 03                	test   $0x3,%al
+  800e06:	75 12                	jne    800e1a <memset+0x28>
+    c &= 0xFF;
+  800e08:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800e0c:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  800e12:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  800e15:	fc                   	cld
+  800e16:	f3 ab                	rep stos %eax,%es:(%edi)
+  800e18:	eb 06                	jmp    800e20 <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  800e1a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e1d:	fc                   	cld
+  800e1e:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  800e20:	89 f8                	mov    %edi,%eax
+  800e22:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800e25:	c9                   	leave
+  800e26:	c3                   	ret
+
+00800e27 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800e27:	55                   	push   %ebp
+  800e28:	89 e5                	mov    %esp,%ebp
+  800e2a:	57                   	push   %edi
+  800e2b:	56                   	push   %esi
+  800e2c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e2f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800e32:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  800e35:	39 c6                	cmp    %eax,%esi
+  800e37:	73 32                	jae    800e6b <memmove+0x44>
+  800e39:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800e3c:	39 d0                	cmp    %edx,%eax
+  800e3e:	73 2b                	jae    800e6b <memmove+0x44>
+    s += n;
+    d += n;
+  800e40:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800e43:	89 d6                	mov    %edx,%esi
+  800e45:	09 fe                	or     %edi,%esi
+  800e47:	09 ce                	or     %ecx,%esi
+  800e49:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800e4f:	75 0e                	jne    800e5f <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800e51:	83 ef 04             	sub    $0x4,%edi
+  800e54:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800e57:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  800e5a:	fd                   	std
+  800e5b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800e5d:	eb 09                	jmp    800e68 <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800e5f:	83 ef 01             	sub    $0x1,%edi
+  800e62:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  800e65:	fd                   	std
+  800e66:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  800e68:	fc                   	cld
+  800e69:	eb 1a                	jmp    800e85 <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800e6b:	89 f2                	mov    %esi,%edx
+  800e6d:	09 c2                	or     %eax,%edx
+  800e6f:	09 ca                	or     %ecx,%edx
+  800e71:	f6 c2 03             	test   $0x3,%dl
+  800e74:	75 0a                	jne    800e80 <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800e76:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  800e79:	89 c7                	mov    %eax,%edi
+  800e7b:	fc                   	cld
+  800e7c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800e7e:	eb 05                	jmp    800e85 <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  800e80:	89 c7                	mov    %eax,%edi
+  800e82:	fc                   	cld
+  800e83:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  800e85:	5e                   	pop    %esi
+  800e86:	5f                   	pop    %edi
+  800e87:	5d                   	pop    %ebp
+  800e88:	c3                   	ret
+
+00800e89 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800e89:	55                   	push   %ebp
+  800e8a:	89 e5                	mov    %esp,%ebp
+  800e8c:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  800e8f:	ff 75 10             	push   0x10(%ebp)
+  800e92:	ff 75 0c             	push   0xc(%ebp)
+  800e95:	ff 75 08             	push   0x8(%ebp)
+  800e98:	e8 8a ff ff ff       	call   800e27 <memmove>
+}
+  800e9d:	c9                   	leave
+  800e9e:	c3                   	ret
+
+00800e9f <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800e9f:	55                   	push   %ebp
+  800ea0:	89 e5                	mov    %esp,%ebp
+  800ea2:	56                   	push   %esi
+  800ea3:	53                   	push   %ebx
+  800ea4:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ea7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  800eaa:	89 c6                	mov    %eax,%esi
+  800eac:	03 75 10             	add    0x10(%ebp),%esi
+  800eaf:	eb 06                	jmp    800eb7 <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  800eb1:	83 c0 01             	add    $0x1,%eax
+  800eb4:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  800eb7:	39 f0                	cmp    %esi,%eax
+  800eb9:	74 14                	je     800ecf <memcmp+0x30>
+    if (*s1 != *s2)
+  800ebb:	0f b6 08             	movzbl (%eax),%ecx
+  800ebe:	0f b6 1a             	movzbl (%edx),%ebx
+  800ec1:	38 d9                	cmp    %bl,%cl
+  800ec3:	74 ec                	je     800eb1 <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  800ec5:	0f b6 c1             	movzbl %cl,%eax
+  800ec8:	0f b6 db             	movzbl %bl,%ebx
+  800ecb:	29 d8                	sub    %ebx,%eax
+  800ecd:	eb 05                	jmp    800ed4 <memcmp+0x35>
+  }
+
+  return 0;
+  800ecf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ed4:	5b                   	pop    %ebx
+  800ed5:	5e                   	pop    %esi
+  800ed6:	5d                   	pop    %ebp
+  800ed7:	c3                   	ret
+
+00800ed8 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800ed8:	55                   	push   %ebp
+  800ed9:	89 e5                	mov    %esp,%ebp
+  800edb:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ede:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  800ee1:	89 c2                	mov    %eax,%edx
+  800ee3:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  800ee6:	eb 03                	jmp    800eeb <memfind+0x13>
+  800ee8:	83 c0 01             	add    $0x1,%eax
+  800eeb:	39 d0                	cmp    %edx,%eax
+  800eed:	73 04                	jae    800ef3 <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  800eef:	38 08                	cmp    %cl,(%eax)
+  800ef1:	75 f5                	jne    800ee8 <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  800ef3:	5d                   	pop    %ebp
+  800ef4:	c3                   	ret
+
+00800ef5 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800ef5:	55                   	push   %ebp
+  800ef6:	89 e5                	mov    %esp,%ebp
+  800ef8:	57                   	push   %edi
+  800ef9:	56                   	push   %esi
+  800efa:	53                   	push   %ebx
+  800efb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800efe:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  800f01:	eb 03                	jmp    800f06 <strtol+0x11>
+    s++;
+  800f03:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  800f06:	0f b6 02             	movzbl (%edx),%eax
+  800f09:	3c 20                	cmp    $0x20,%al
+  800f0b:	74 f6                	je     800f03 <strtol+0xe>
+  800f0d:	3c 09                	cmp    $0x9,%al
+  800f0f:	74 f2                	je     800f03 <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  800f11:	3c 2b                	cmp    $0x2b,%al
+  800f13:	74 2a                	je     800f3f <strtol+0x4a>
+  int neg = 0;
+  800f15:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  800f1a:	3c 2d                	cmp    $0x2d,%al
+  800f1c:	74 2b                	je     800f49 <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800f1e:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800f24:	75 0f                	jne    800f35 <strtol+0x40>
+  800f26:	80 3a 30             	cmpb   $0x30,(%edx)
+  800f29:	74 28                	je     800f53 <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  800f2b:	85 db                	test   %ebx,%ebx
+  800f2d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f32:	0f 44 d8             	cmove  %eax,%ebx
+  800f35:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f3a:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800f3d:	eb 46                	jmp    800f85 <strtol+0x90>
+    s++;
+  800f3f:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  800f42:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f47:	eb d5                	jmp    800f1e <strtol+0x29>
+    s++, neg = 1;
+  800f49:	83 c2 01             	add    $0x1,%edx
+  800f4c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800f51:	eb cb                	jmp    800f1e <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800f53:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800f57:	74 0e                	je     800f67 <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  800f59:	85 db                	test   %ebx,%ebx
+  800f5b:	75 d8                	jne    800f35 <strtol+0x40>
+    s++, base = 8;
+  800f5d:	83 c2 01             	add    $0x1,%edx
+  800f60:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800f65:	eb ce                	jmp    800f35 <strtol+0x40>
+    s += 2, base = 16;
+  800f67:	83 c2 02             	add    $0x2,%edx
+  800f6a:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800f6f:	eb c4                	jmp    800f35 <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  800f71:	0f be c0             	movsbl %al,%eax
+  800f74:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  800f77:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800f7a:	7d 3a                	jge    800fb6 <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  800f7c:	83 c2 01             	add    $0x1,%edx
+  800f7f:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800f83:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  800f85:	0f b6 02             	movzbl (%edx),%eax
+  800f88:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800f8b:	89 f3                	mov    %esi,%ebx
+  800f8d:	80 fb 09             	cmp    $0x9,%bl
+  800f90:	76 df                	jbe    800f71 <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  800f92:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800f95:	89 f3                	mov    %esi,%ebx
+  800f97:	80 fb 19             	cmp    $0x19,%bl
+  800f9a:	77 08                	ja     800fa4 <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  800f9c:	0f be c0             	movsbl %al,%eax
+  800f9f:	83 e8 57             	sub    $0x57,%eax
+  800fa2:	eb d3                	jmp    800f77 <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  800fa4:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800fa7:	89 f3                	mov    %esi,%ebx
+  800fa9:	80 fb 19             	cmp    $0x19,%bl
+  800fac:	77 08                	ja     800fb6 <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  800fae:	0f be c0             	movsbl %al,%eax
+  800fb1:	83 e8 37             	sub    $0x37,%eax
+  800fb4:	eb c1                	jmp    800f77 <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  800fb6:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800fba:	74 05                	je     800fc1 <strtol+0xcc>
+    *endptr = (char*)s;
+  800fbc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800fbf:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  800fc1:	89 c8                	mov    %ecx,%eax
+  800fc3:	f7 d8                	neg    %eax
+  800fc5:	85 ff                	test   %edi,%edi
+  800fc7:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800fca:	89 c8                	mov    %ecx,%eax
+  800fcc:	5b                   	pop    %ebx
+  800fcd:	5e                   	pop    %esi
+  800fce:	5f                   	pop    %edi
+  800fcf:	5d                   	pop    %ebp
+  800fd0:	c3                   	ret
+
+00800fd1 <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800fd1:	55                   	push   %ebp
+  800fd2:	89 e5                	mov    %esp,%ebp
+  800fd4:	57                   	push   %edi
+  800fd5:	56                   	push   %esi
+  800fd6:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800fd7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fdc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fdf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fe2:	89 c3                	mov    %eax,%ebx
+  800fe4:	89 c7                	mov    %eax,%edi
+  800fe6:	89 c6                	mov    %eax,%esi
+  800fe8:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800fea:	5b                   	pop    %ebx
+  800feb:	5e                   	pop    %esi
+  800fec:	5f                   	pop    %edi
+  800fed:	5d                   	pop    %ebp
+  800fee:	c3                   	ret
+
+00800fef <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800fef:	55                   	push   %ebp
+  800ff0:	89 e5                	mov    %esp,%ebp
+  800ff2:	57                   	push   %edi
+  800ff3:	56                   	push   %esi
+  800ff4:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800ff5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ffa:	b8 01 00 00 00       	mov    $0x1,%eax
+  800fff:	89 d1                	mov    %edx,%ecx
+  801001:	89 d3                	mov    %edx,%ebx
+  801003:	89 d7                	mov    %edx,%edi
+  801005:	89 d6                	mov    %edx,%esi
+  801007:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  801009:	5b                   	pop    %ebx
+  80100a:	5e                   	pop    %esi
+  80100b:	5f                   	pop    %edi
+  80100c:	5d                   	pop    %ebp
+  80100d:	c3                   	ret
+
+0080100e <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  80100e:	55                   	push   %ebp
+  80100f:	89 e5                	mov    %esp,%ebp
+  801011:	57                   	push   %edi
+  801012:	56                   	push   %esi
+  801013:	53                   	push   %ebx
+  801014:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801017:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80101c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80101f:	b8 03 00 00 00       	mov    $0x3,%eax
+  801024:	89 cb                	mov    %ecx,%ebx
+  801026:	89 cf                	mov    %ecx,%edi
+  801028:	89 ce                	mov    %ecx,%esi
+  80102a:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80102c:	85 c0                	test   %eax,%eax
+  80102e:	7f 08                	jg     801038 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  801030:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801033:	5b                   	pop    %ebx
+  801034:	5e                   	pop    %esi
+  801035:	5f                   	pop    %edi
+  801036:	5d                   	pop    %ebp
+  801037:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801038:	83 ec 0c             	sub    $0xc,%esp
+  80103b:	50                   	push   %eax
+  80103c:	6a 03                	push   $0x3
+  80103e:	68 43 43 80 00       	push   $0x804343
+  801043:	6a 23                	push   $0x23
+  801045:	68 60 43 80 00       	push   $0x804360
+  80104a:	e8 89 f5 ff ff       	call   8005d8 <_panic>
+
+0080104f <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  80104f:	55                   	push   %ebp
+  801050:	89 e5                	mov    %esp,%ebp
+  801052:	57                   	push   %edi
+  801053:	56                   	push   %esi
+  801054:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801055:	ba 00 00 00 00       	mov    $0x0,%edx
+  80105a:	b8 02 00 00 00       	mov    $0x2,%eax
+  80105f:	89 d1                	mov    %edx,%ecx
+  801061:	89 d3                	mov    %edx,%ebx
+  801063:	89 d7                	mov    %edx,%edi
+  801065:	89 d6                	mov    %edx,%esi
+  801067:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  801069:	5b                   	pop    %ebx
+  80106a:	5e                   	pop    %esi
+  80106b:	5f                   	pop    %edi
+  80106c:	5d                   	pop    %ebp
+  80106d:	c3                   	ret
+
+0080106e <sys_yield>:
+
+void
+sys_yield(void)
+{
+  80106e:	55                   	push   %ebp
+  80106f:	89 e5                	mov    %esp,%ebp
+  801071:	57                   	push   %edi
+  801072:	56                   	push   %esi
+  801073:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801074:	ba 00 00 00 00       	mov    $0x0,%edx
+  801079:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80107e:	89 d1                	mov    %edx,%ecx
+  801080:	89 d3                	mov    %edx,%ebx
+  801082:	89 d7                	mov    %edx,%edi
+  801084:	89 d6                	mov    %edx,%esi
+  801086:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  801088:	5b                   	pop    %ebx
+  801089:	5e                   	pop    %esi
+  80108a:	5f                   	pop    %edi
+  80108b:	5d                   	pop    %ebp
+  80108c:	c3                   	ret
+
+0080108d <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  80108d:	55                   	push   %ebp
+  80108e:	89 e5                	mov    %esp,%ebp
+  801090:	57                   	push   %edi
+  801091:	56                   	push   %esi
+  801092:	53                   	push   %ebx
+  801093:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  801096:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  80109a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80109f:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a2:	b8 14 00 00 00       	mov    $0x14,%eax
+  8010a7:	89 df                	mov    %ebx,%edi
+  8010a9:	89 de                	mov    %ebx,%esi
+  8010ab:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8010ad:	85 c0                	test   %eax,%eax
+  8010af:	7f 08                	jg     8010b9 <sys_env_set_cow+0x2c>
+}
+  8010b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010b4:	5b                   	pop    %ebx
+  8010b5:	5e                   	pop    %esi
+  8010b6:	5f                   	pop    %edi
+  8010b7:	5d                   	pop    %ebp
+  8010b8:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8010b9:	83 ec 0c             	sub    $0xc,%esp
+  8010bc:	50                   	push   %eax
+  8010bd:	6a 14                	push   $0x14
+  8010bf:	68 43 43 80 00       	push   $0x804343
+  8010c4:	6a 23                	push   $0x23
+  8010c6:	68 60 43 80 00       	push   $0x804360
+  8010cb:	e8 08 f5 ff ff       	call   8005d8 <_panic>
+
+008010d0 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8010d0:	55                   	push   %ebp
+  8010d1:	89 e5                	mov    %esp,%ebp
+  8010d3:	57                   	push   %edi
+  8010d4:	56                   	push   %esi
+  8010d5:	53                   	push   %ebx
+  8010d6:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8010d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8010de:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010e4:	b8 04 00 00 00       	mov    $0x4,%eax
+  8010e9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010ec:	89 f7                	mov    %esi,%edi
+  8010ee:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8010f0:	85 c0                	test   %eax,%eax
+  8010f2:	7f 08                	jg     8010fc <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  8010f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010f7:	5b                   	pop    %ebx
+  8010f8:	5e                   	pop    %esi
+  8010f9:	5f                   	pop    %edi
+  8010fa:	5d                   	pop    %ebp
+  8010fb:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8010fc:	83 ec 0c             	sub    $0xc,%esp
+  8010ff:	50                   	push   %eax
+  801100:	6a 04                	push   $0x4
+  801102:	68 43 43 80 00       	push   $0x804343
+  801107:	6a 23                	push   $0x23
+  801109:	68 60 43 80 00       	push   $0x804360
+  80110e:	e8 c5 f4 ff ff       	call   8005d8 <_panic>
+
+00801113 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  801113:	55                   	push   %ebp
+  801114:	89 e5                	mov    %esp,%ebp
+  801116:	57                   	push   %edi
+  801117:	56                   	push   %esi
+  801118:	53                   	push   %ebx
+  801119:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80111c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80111f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801122:	b8 05 00 00 00       	mov    $0x5,%eax
+  801127:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80112a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80112d:	8b 75 18             	mov    0x18(%ebp),%esi
+  801130:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801132:	85 c0                	test   %eax,%eax
+  801134:	7f 08                	jg     80113e <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  801136:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801139:	5b                   	pop    %ebx
+  80113a:	5e                   	pop    %esi
+  80113b:	5f                   	pop    %edi
+  80113c:	5d                   	pop    %ebp
+  80113d:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80113e:	83 ec 0c             	sub    $0xc,%esp
+  801141:	50                   	push   %eax
+  801142:	6a 05                	push   $0x5
+  801144:	68 43 43 80 00       	push   $0x804343
+  801149:	6a 23                	push   $0x23
+  80114b:	68 60 43 80 00       	push   $0x804360
+  801150:	e8 83 f4 ff ff       	call   8005d8 <_panic>
+
+00801155 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  801155:	55                   	push   %ebp
+  801156:	89 e5                	mov    %esp,%ebp
+  801158:	57                   	push   %edi
+  801159:	56                   	push   %esi
+  80115a:	53                   	push   %ebx
+  80115b:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80115e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801163:	8b 55 08             	mov    0x8(%ebp),%edx
+  801166:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801169:	b8 06 00 00 00       	mov    $0x6,%eax
+  80116e:	89 df                	mov    %ebx,%edi
+  801170:	89 de                	mov    %ebx,%esi
+  801172:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801174:	85 c0                	test   %eax,%eax
+  801176:	7f 08                	jg     801180 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  801178:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80117b:	5b                   	pop    %ebx
+  80117c:	5e                   	pop    %esi
+  80117d:	5f                   	pop    %edi
+  80117e:	5d                   	pop    %ebp
+  80117f:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801180:	83 ec 0c             	sub    $0xc,%esp
+  801183:	50                   	push   %eax
+  801184:	6a 06                	push   $0x6
+  801186:	68 43 43 80 00       	push   $0x804343
+  80118b:	6a 23                	push   $0x23
+  80118d:	68 60 43 80 00       	push   $0x804360
+  801192:	e8 41 f4 ff ff       	call   8005d8 <_panic>
+
+00801197 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  801197:	55                   	push   %ebp
+  801198:	89 e5                	mov    %esp,%ebp
+  80119a:	57                   	push   %edi
+  80119b:	56                   	push   %esi
+  80119c:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80119d:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011a0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011a3:	b8 11 00 00 00       	mov    $0x11,%eax
+  8011a8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011ab:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011ae:	8b 75 18             	mov    0x18(%ebp),%esi
+  8011b1:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  8011b3:	5b                   	pop    %ebx
+  8011b4:	5e                   	pop    %esi
+  8011b5:	5f                   	pop    %edi
+  8011b6:	5d                   	pop    %ebp
+  8011b7:	c3                   	ret
+
+008011b8 <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  8011b8:	55                   	push   %ebp
+  8011b9:	89 e5                	mov    %esp,%ebp
+  8011bb:	57                   	push   %edi
+  8011bc:	56                   	push   %esi
+  8011bd:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8011be:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011c1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011c4:	b8 12 00 00 00       	mov    $0x12,%eax
+  8011c9:	be 00 00 00 00       	mov    $0x0,%esi
+  8011ce:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011d1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011d4:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  8011d6:	5b                   	pop    %ebx
+  8011d7:	5e                   	pop    %esi
+  8011d8:	5f                   	pop    %edi
+  8011d9:	5d                   	pop    %ebp
+  8011da:	c3                   	ret
+
+008011db <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  8011db:	55                   	push   %ebp
+  8011dc:	89 e5                	mov    %esp,%ebp
+  8011de:	57                   	push   %edi
+  8011df:	56                   	push   %esi
+  8011e0:	53                   	push   %ebx
+  8011e1:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8011e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011e9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ef:	b8 16 00 00 00       	mov    $0x16,%eax
+  8011f4:	89 df                	mov    %ebx,%edi
+  8011f6:	89 de                	mov    %ebx,%esi
+  8011f8:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8011fa:	85 c0                	test   %eax,%eax
+  8011fc:	7f 08                	jg     801206 <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  8011fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801201:	5b                   	pop    %ebx
+  801202:	5e                   	pop    %esi
+  801203:	5f                   	pop    %edi
+  801204:	5d                   	pop    %ebp
+  801205:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801206:	83 ec 0c             	sub    $0xc,%esp
+  801209:	50                   	push   %eax
+  80120a:	6a 16                	push   $0x16
+  80120c:	68 43 43 80 00       	push   $0x804343
+  801211:	6a 23                	push   $0x23
+  801213:	68 60 43 80 00       	push   $0x804360
+  801218:	e8 bb f3 ff ff       	call   8005d8 <_panic>
+
+0080121d <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  80121d:	55                   	push   %ebp
+  80121e:	89 e5                	mov    %esp,%ebp
+  801220:	57                   	push   %edi
+  801221:	56                   	push   %esi
+  801222:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801223:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801228:	8b 55 08             	mov    0x8(%ebp),%edx
+  80122b:	b8 17 00 00 00       	mov    $0x17,%eax
+  801230:	89 cb                	mov    %ecx,%ebx
+  801232:	89 cf                	mov    %ecx,%edi
+  801234:	89 ce                	mov    %ecx,%esi
+  801236:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  801238:	5b                   	pop    %ebx
+  801239:	5e                   	pop    %esi
+  80123a:	5f                   	pop    %edi
+  80123b:	5d                   	pop    %ebp
+  80123c:	c3                   	ret
+
+0080123d <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  80123d:	55                   	push   %ebp
+  80123e:	89 e5                	mov    %esp,%ebp
+  801240:	57                   	push   %edi
+  801241:	56                   	push   %esi
+  801242:	53                   	push   %ebx
+  801243:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801246:	be 00 00 00 00       	mov    $0x0,%esi
+  80124b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80124e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801251:	b8 18 00 00 00       	mov    $0x18,%eax
+  801256:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801259:	89 f7                	mov    %esi,%edi
+  80125b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80125d:	85 c0                	test   %eax,%eax
+  80125f:	7f 08                	jg     801269 <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  801261:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801264:	5b                   	pop    %ebx
+  801265:	5e                   	pop    %esi
+  801266:	5f                   	pop    %edi
+  801267:	5d                   	pop    %ebp
+  801268:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801269:	83 ec 0c             	sub    $0xc,%esp
+  80126c:	50                   	push   %eax
+  80126d:	6a 18                	push   $0x18
+  80126f:	68 43 43 80 00       	push   $0x804343
+  801274:	6a 23                	push   $0x23
+  801276:	68 60 43 80 00       	push   $0x804360
+  80127b:	e8 58 f3 ff ff       	call   8005d8 <_panic>
+
+00801280 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  801280:	55                   	push   %ebp
+  801281:	89 e5                	mov    %esp,%ebp
+  801283:	57                   	push   %edi
+  801284:	56                   	push   %esi
+  801285:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801286:	be 00 00 00 00       	mov    $0x0,%esi
+  80128b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80128e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801291:	b8 19 00 00 00       	mov    $0x19,%eax
+  801296:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801299:	89 f7                	mov    %esi,%edi
+  80129b:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  80129d:	5b                   	pop    %ebx
+  80129e:	5e                   	pop    %esi
+  80129f:	5f                   	pop    %edi
+  8012a0:	5d                   	pop    %ebp
+  8012a1:	c3                   	ret
+
+008012a2 <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  8012a2:	55                   	push   %ebp
+  8012a3:	89 e5                	mov    %esp,%ebp
+  8012a5:	57                   	push   %edi
+  8012a6:	56                   	push   %esi
+  8012a7:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8012a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012ad:	b8 15 00 00 00       	mov    $0x15,%eax
+  8012b2:	89 d1                	mov    %edx,%ecx
+  8012b4:	89 d3                	mov    %edx,%ebx
+  8012b6:	89 d7                	mov    %edx,%edi
+  8012b8:	89 d6                	mov    %edx,%esi
+  8012ba:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8012bc:	5b                   	pop    %ebx
+  8012bd:	5e                   	pop    %esi
+  8012be:	5f                   	pop    %edi
+  8012bf:	5d                   	pop    %ebp
+  8012c0:	c3                   	ret
+
+008012c1 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8012c1:	55                   	push   %ebp
+  8012c2:	89 e5                	mov    %esp,%ebp
+  8012c4:	57                   	push   %edi
+  8012c5:	56                   	push   %esi
+  8012c6:	53                   	push   %ebx
+  8012c7:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8012ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012cf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012d2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012d5:	b8 08 00 00 00       	mov    $0x8,%eax
+  8012da:	89 df                	mov    %ebx,%edi
+  8012dc:	89 de                	mov    %ebx,%esi
+  8012de:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8012e0:	85 c0                	test   %eax,%eax
+  8012e2:	7f 08                	jg     8012ec <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8012e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012e7:	5b                   	pop    %ebx
+  8012e8:	5e                   	pop    %esi
+  8012e9:	5f                   	pop    %edi
+  8012ea:	5d                   	pop    %ebp
+  8012eb:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8012ec:	83 ec 0c             	sub    $0xc,%esp
+  8012ef:	50                   	push   %eax
+  8012f0:	6a 08                	push   $0x8
+  8012f2:	68 43 43 80 00       	push   $0x804343
+  8012f7:	6a 23                	push   $0x23
+  8012f9:	68 60 43 80 00       	push   $0x804360
+  8012fe:	e8 d5 f2 ff ff       	call   8005d8 <_panic>
+
+00801303 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801303:	55                   	push   %ebp
+  801304:	89 e5                	mov    %esp,%ebp
+  801306:	57                   	push   %edi
+  801307:	56                   	push   %esi
+  801308:	53                   	push   %ebx
+  801309:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80130c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801311:	8b 55 08             	mov    0x8(%ebp),%edx
+  801314:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801317:	b8 09 00 00 00       	mov    $0x9,%eax
+  80131c:	89 df                	mov    %ebx,%edi
+  80131e:	89 de                	mov    %ebx,%esi
+  801320:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801322:	85 c0                	test   %eax,%eax
+  801324:	7f 08                	jg     80132e <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  801326:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801329:	5b                   	pop    %ebx
+  80132a:	5e                   	pop    %esi
+  80132b:	5f                   	pop    %edi
+  80132c:	5d                   	pop    %ebp
+  80132d:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80132e:	83 ec 0c             	sub    $0xc,%esp
+  801331:	50                   	push   %eax
+  801332:	6a 09                	push   $0x9
+  801334:	68 43 43 80 00       	push   $0x804343
+  801339:	6a 23                	push   $0x23
+  80133b:	68 60 43 80 00       	push   $0x804360
+  801340:	e8 93 f2 ff ff       	call   8005d8 <_panic>
+
+00801345 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801345:	55                   	push   %ebp
+  801346:	89 e5                	mov    %esp,%ebp
+  801348:	57                   	push   %edi
+  801349:	56                   	push   %esi
+  80134a:	53                   	push   %ebx
+  80134b:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80134e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801353:	8b 55 08             	mov    0x8(%ebp),%edx
+  801356:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801359:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80135e:	89 df                	mov    %ebx,%edi
+  801360:	89 de                	mov    %ebx,%esi
+  801362:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801364:	85 c0                	test   %eax,%eax
+  801366:	7f 08                	jg     801370 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  801368:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80136b:	5b                   	pop    %ebx
+  80136c:	5e                   	pop    %esi
+  80136d:	5f                   	pop    %edi
+  80136e:	5d                   	pop    %ebp
+  80136f:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801370:	83 ec 0c             	sub    $0xc,%esp
+  801373:	50                   	push   %eax
+  801374:	6a 0a                	push   $0xa
+  801376:	68 43 43 80 00       	push   $0x804343
+  80137b:	6a 23                	push   $0x23
+  80137d:	68 60 43 80 00       	push   $0x804360
+  801382:	e8 51 f2 ff ff       	call   8005d8 <_panic>
+
+00801387 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  801387:	55                   	push   %ebp
+  801388:	89 e5                	mov    %esp,%ebp
+  80138a:	57                   	push   %edi
+  80138b:	56                   	push   %esi
+  80138c:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80138d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801390:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801393:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801398:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80139b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80139e:	8b 75 18             	mov    0x18(%ebp),%esi
+  8013a1:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  8013a3:	5b                   	pop    %ebx
+  8013a4:	5e                   	pop    %esi
+  8013a5:	5f                   	pop    %edi
+  8013a6:	5d                   	pop    %ebp
+  8013a7:	c3                   	ret
+
+008013a8 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  8013a8:	55                   	push   %ebp
+  8013a9:	89 e5                	mov    %esp,%ebp
+  8013ab:	57                   	push   %edi
+  8013ac:	56                   	push   %esi
+  8013ad:	53                   	push   %ebx
+  8013ae:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8013b1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013b6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013b9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013bc:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8013c1:	89 df                	mov    %ebx,%edi
+  8013c3:	89 de                	mov    %ebx,%esi
+  8013c5:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8013c7:	85 c0                	test   %eax,%eax
+  8013c9:	7f 08                	jg     8013d3 <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  8013cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013ce:	5b                   	pop    %ebx
+  8013cf:	5e                   	pop    %esi
+  8013d0:	5f                   	pop    %edi
+  8013d1:	5d                   	pop    %ebp
+  8013d2:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8013d3:	83 ec 0c             	sub    $0xc,%esp
+  8013d6:	50                   	push   %eax
+  8013d7:	6a 0d                	push   $0xd
+  8013d9:	68 43 43 80 00       	push   $0x804343
+  8013de:	6a 23                	push   $0x23
+  8013e0:	68 60 43 80 00       	push   $0x804360
+  8013e5:	e8 ee f1 ff ff       	call   8005d8 <_panic>
+
+008013ea <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  8013ea:	55                   	push   %ebp
+  8013eb:	89 e5                	mov    %esp,%ebp
+  8013ed:	57                   	push   %edi
+  8013ee:	56                   	push   %esi
+  8013ef:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8013f0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013f5:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8013fa:	89 d1                	mov    %edx,%ecx
+  8013fc:	89 d3                	mov    %edx,%ebx
+  8013fe:	89 d7                	mov    %edx,%edi
+  801400:	89 d6                	mov    %edx,%esi
+  801402:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801404:	5b                   	pop    %ebx
+  801405:	5e                   	pop    %esi
+  801406:	5f                   	pop    %edi
+  801407:	5d                   	pop    %ebp
+  801408:	c3                   	ret
+
+00801409 <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  801409:	55                   	push   %ebp
+  80140a:	89 e5                	mov    %esp,%ebp
+  80140c:	57                   	push   %edi
+  80140d:	56                   	push   %esi
+  80140e:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80140f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801412:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801415:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80141a:	be 00 00 00 00       	mov    $0x0,%esi
+  80141f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801422:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801425:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  801427:	5b                   	pop    %ebx
+  801428:	5e                   	pop    %esi
+  801429:	5f                   	pop    %edi
+  80142a:	5d                   	pop    %ebp
+  80142b:	c3                   	ret
+
+0080142c <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  80142c:	55                   	push   %ebp
+  80142d:	89 e5                	mov    %esp,%ebp
+  80142f:	57                   	push   %edi
+  801430:	56                   	push   %esi
+  801431:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801432:	be 00 00 00 00       	mov    $0x0,%esi
+  801437:	8b 55 08             	mov    0x8(%ebp),%edx
+  80143a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80143d:	b8 10 00 00 00       	mov    $0x10,%eax
+  801442:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801445:	89 f7                	mov    %esi,%edi
+  801447:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  801449:	5b                   	pop    %ebx
+  80144a:	5e                   	pop    %esi
+  80144b:	5f                   	pop    %edi
+  80144c:	5d                   	pop    %ebp
+  80144d:	c3                   	ret
+
+0080144e <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  80144e:	55                   	push   %ebp
+  80144f:	89 e5                	mov    %esp,%ebp
+  801451:	57                   	push   %edi
+  801452:	56                   	push   %esi
+  801453:	53                   	push   %ebx
+  801454:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  801457:	80 3d a4 68 80 00 00 	cmpb   $0x0,0x8068a4
+  80145e:	74 41                	je     8014a1 <sys_batch+0x53>
+  801460:	8b 45 08             	mov    0x8(%ebp),%eax
+  801463:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  801466:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  80146d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801470:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  801473:	7d 45                	jge    8014ba <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  801475:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801478:	8b 06                	mov    (%esi),%eax
+  80147a:	8b 56 04             	mov    0x4(%esi),%edx
+  80147d:	8b 4e 08             	mov    0x8(%esi),%ecx
+  801480:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  801483:	8b 7e 10             	mov    0x10(%esi),%edi
+  801486:	8b 76 14             	mov    0x14(%esi),%esi
+  801489:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  80148b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80148e:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  801491:	83 c6 1c             	add    $0x1c,%esi
+  801494:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  801497:	85 c0                	test   %eax,%eax
+  801499:	78 1f                	js     8014ba <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  80149b:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  80149f:	eb cc                	jmp    80146d <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  8014a1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014a6:	b8 13 00 00 00       	mov    $0x13,%eax
+  8014ab:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014ae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014b1:	89 df                	mov    %ebx,%edi
+  8014b3:	89 de                	mov    %ebx,%esi
+  8014b5:	cd 30                	int    $0x30
+  8014b7:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  8014ba:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8014bd:	83 c4 08             	add    $0x8,%esp
+  8014c0:	5b                   	pop    %ebx
+  8014c1:	5e                   	pop    %esi
+  8014c2:	5f                   	pop    %edi
+  8014c3:	5d                   	pop    %ebp
+  8014c4:	c3                   	ret
+
+008014c5 <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  8014c5:	55                   	push   %ebp
+  8014c6:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  8014c8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014cb:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8014d1:	5d                   	pop    %ebp
+  8014d2:	c3                   	ret
+
+008014d3 <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  8014d3:	55                   	push   %ebp
+  8014d4:	89 e5                	mov    %esp,%ebp
+  8014d6:	56                   	push   %esi
+  8014d7:	53                   	push   %ebx
+  8014d8:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  8014db:	8b 1e                	mov    (%esi),%ebx
+  8014dd:	85 db                	test   %ebx,%ebx
+  8014df:	75 09                	jne    8014ea <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  8014e1:	89 d8                	mov    %ebx,%eax
+  8014e3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014e6:	5b                   	pop    %ebx
+  8014e7:	5e                   	pop    %esi
+  8014e8:	5d                   	pop    %ebp
+  8014e9:	c3                   	ret
+  b->sb_n = 0;
+  8014ea:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  8014f0:	53                   	push   %ebx
+  8014f1:	8d 46 04             	lea    0x4(%esi),%eax
+  8014f4:	50                   	push   %eax
+  8014f5:	e8 54 ff ff ff       	call   80144e <sys_batch>
+  8014fa:	83 c4 08             	add    $0x8,%esp
+  8014fd:	85 c0                	test   %eax,%eax
+  8014ff:	78 1e                	js     80151f <sysbatch_flush+0x4c>
+  if (r < n)
+  801501:	39 c3                	cmp    %eax,%ebx
+  801503:	7f 07                	jg     80150c <sysbatch_flush+0x39>
+  return 0;
+  801505:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80150a:	eb d5                	jmp    8014e1 <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  80150c:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80150f:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  801513:	85 db                	test   %ebx,%ebx
+  801515:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80151a:	0f 49 d8             	cmovns %eax,%ebx
+  80151d:	eb c2                	jmp    8014e1 <sysbatch_flush+0xe>
+    return r;
+  80151f:	89 c3                	mov    %eax,%ebx
+  801521:	eb be                	jmp    8014e1 <sysbatch_flush+0xe>
+
+00801523 <sysbatch_add>:
+{
+  801523:	55                   	push   %ebp
+  801524:	89 e5                	mov    %esp,%ebp
+  801526:	53                   	push   %ebx
+  801527:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  80152a:	83 3b 40             	cmpl   $0x40,(%ebx)
+  80152d:	74 41                	je     801570 <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  80152f:	8b 03                	mov    (%ebx),%eax
+  801531:	8d 50 01             	lea    0x1(%eax),%edx
+  801534:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  801536:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801539:	01 d8                	add    %ebx,%eax
+  80153b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80153e:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  801541:	8b 55 10             	mov    0x10(%ebp),%edx
+  801544:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  801547:	8b 55 14             	mov    0x14(%ebp),%edx
+  80154a:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  80154d:	8b 55 18             	mov    0x18(%ebp),%edx
+  801550:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  801553:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  801556:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  801559:	8b 55 20             	mov    0x20(%ebp),%edx
+  80155c:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  80155f:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  801566:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80156b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80156e:	c9                   	leave
+  80156f:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  801570:	53                   	push   %ebx
+  801571:	e8 5d ff ff ff       	call   8014d3 <sysbatch_flush>
+  801576:	83 c4 04             	add    $0x4,%esp
+  801579:	85 c0                	test   %eax,%eax
+  80157b:	79 b2                	jns    80152f <sysbatch_add+0xc>
+  80157d:	eb ec                	jmp    80156b <sysbatch_add+0x48>
+
+0080157f <pgfault>:
+// Custom page fault handler - if faulting page is copy-on-write,
+// map in our own private writable copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  80157f:	55                   	push   %ebp
+  801580:	89 e5                	mov    %esp,%ebp
+  801582:	56                   	push   %esi
+  801583:	53                   	push   %ebx
+  801584:	8b 45 08             	mov    0x8(%ebp),%eax
+  void *addr = (void*)utf->utf_fault_va;
+  801587:	8b 18                	mov    (%eax),%ebx
+  uint32_t err = utf->utf_err;
+  801589:	8b 70 04             	mov    0x4(%eax),%esi
+  // Hint:
+  //   Use the read-only page table mappings at uvpt
+  //   (see <inc/memlayout.h>).
+
+  // Faults in file mappings are mmap's to handle.
+  if (mmap_fault(utf))
+  80158c:	83 ec 0c             	sub    $0xc,%esp
+  80158f:	50                   	push   %eax
+  801590:	e8 05 1e 00 00       	call   80339a <mmap_fault>
+  801595:	83 c4 10             	add    $0x10,%esp
+  801598:	84 c0                	test   %al,%al
+  80159a:	75 7d                	jne    801619 <pgfault+0x9a>
+    return;
+
+  // LAB 4: Your code here.
+  if ( !(err & FEC_WR) ) {
+  80159c:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  8015a2:	74 7c                	je     801620 <pgfault+0xa1>
+    panic("user_pgfault: %e", err);
+  }
+
+  if ( !(uvpt[PGNUM(addr)] & PTE_COW) ) {
+  8015a4:	89 d8                	mov    %ebx,%eax
+  8015a6:	c1 e8 0c             	shr    $0xc,%eax
+  8015a9:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8015b0:	f6 c4 08             	test   $0x8,%ah
+  8015b3:	74 7d                	je     801632 <pgfault+0xb3>
+  // page to the old page's address.
+  // Hint:
+  //   You should make three system calls.
+
+  // LAB 4: Your code here.
+  addr = ROUNDDOWN(addr, PGSIZE);
+  8015b5:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+
+  // map page to temporary location
+  if ( (r = sys_page_alloc(0, PFTEMP, (PTE_P | PTE_U | PTE_W))) < 0) {
+  8015bb:	83 ec 04             	sub    $0x4,%esp
+  8015be:	6a 07                	push   $0x7
+  8015c0:	68 00 f0 7f 00       	push   $0x7ff000
+  8015c5:	6a 00                	push   $0x0
+  8015c7:	e8 04 fb ff ff       	call   8010d0 <sys_page_alloc>
+  8015cc:	83 c4 10             	add    $0x10,%esp
+  8015cf:	85 c0                	test   %eax,%eax
+  8015d1:	78 73                	js     801646 <pgfault+0xc7>
+    panic("sys_page_alloc: %e", r);
+  }
+
+  // copy data from old page to new page
+  memmove(PFTEMP, addr, PGSIZE);
+  8015d3:	83 ec 04             	sub    $0x4,%esp
+  8015d6:	68 00 10 00 00       	push   $0x1000
+  8015db:	53                   	push   %ebx
+  8015dc:	68 00 f0 7f 00       	push   $0x7ff000
+  8015e1:	e8 41 f8 ff ff       	call   800e27 <memmove>
+
+  // move new page to old page address
+  if ( (r = sys_page_map(0, PFTEMP, 0, addr, (PTE_P | PTE_U | PTE_W))) < 0) {
+  8015e6:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8015ed:	53                   	push   %ebx
+  8015ee:	6a 00                	push   $0x0
+  8015f0:	68 00 f0 7f 00       	push   $0x7ff000
+  8015f5:	6a 00                	push   $0x0
+  8015f7:	e8 17 fb ff ff       	call   801113 <sys_page_map>
+  8015fc:	83 c4 20             	add    $0x20,%esp
+  8015ff:	85 c0                	test   %eax,%eax
+  801601:	78 55                	js     801658 <pgfault+0xd9>
+    panic("sys_page_map: %e", r);
+  }
+
+  if ( (r = sys_page_unmap(0, PFTEMP)) < 0) {
+  801603:	83 ec 08             	sub    $0x8,%esp
+  801606:	68 00 f0 7f 00       	push   $0x7ff000
+  80160b:	6a 00                	push   $0x0
+  80160d:	e8 43 fb ff ff       	call   801155 <sys_page_unmap>
+  801612:	83 c4 10             	add    $0x10,%esp
+  801615:	85 c0                	test   %eax,%eax
+  801617:	78 51                	js     80166a <pgfault+0xeb>
+    panic("sys_page_unmap: %e", r);
+  }
+}
+  801619:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80161c:	5b                   	pop    %ebx
+  80161d:	5e                   	pop    %esi
+  80161e:	5d                   	pop    %ebp
+  80161f:	c3                   	ret
+    panic("user_pgfault: %e", err);
+  801620:	56                   	push   %esi
+  801621:	68 6e 43 80 00       	push   $0x80436e
+  801626:	6a 1d                	push   $0x1d
+  801628:	68 7f 43 80 00       	push   $0x80437f
+  80162d:	e8 a6 ef ff ff       	call   8005d8 <_panic>
+    panic("user_pgfault: page not COW");
+  801632:	83 ec 04             	sub    $0x4,%esp
+  801635:	68 8a 43 80 00       	push   $0x80438a
+  80163a:	6a 21                	push   $0x21
+  80163c:	68 7f 43 80 00       	push   $0x80437f
+  801641:	e8 92 ef ff ff       	call   8005d8 <_panic>
+    panic("sys_page_alloc: %e", r);
+  801646:	50                   	push   %eax
+  801647:	68 b2 3e 80 00       	push   $0x803eb2
+  80164c:	6a 2f                	push   $0x2f
+  80164e:	68 7f 43 80 00       	push   $0x80437f
+  801653:	e8 80 ef ff ff       	call   8005d8 <_panic>
+    panic("sys_page_map: %e", r);
+  801658:	50                   	push   %eax
+  801659:	68 a1 3e 80 00       	push   $0x803ea1
+  80165e:	6a 37                	push   $0x37
+  801660:	68 7f 43 80 00       	push   $0x80437f
+  801665:	e8 6e ef ff ff       	call   8005d8 <_panic>
+    panic("sys_page_unmap: %e", r);
+  80166a:	50                   	push   %eax
+  80166b:	68 a5 43 80 00       	push   $0x8043a5
+  801670:	6a 3b                	push   $0x3b
+  801672:	68 7f 43 80 00       	push   $0x80437f
+  801677:	e8 5c ef ff ff       	call   8005d8 <_panic>
+
+0080167c <shared_pgfault>:
+
+// Challenge!
+//
+static void
+shared_pgfault(struct UTrapframe *utf)
+{
+  80167c:	55                   	push   %ebp
+  80167d:	89 e5                	mov    %esp,%ebp
+  80167f:	53                   	push   %ebx
+  801680:	83 ec 10             	sub    $0x10,%esp
+  801683:	8b 45 08             	mov    0x8(%ebp),%eax
+  // just has fewer error checks
+  
+  void *addr = (void*)utf->utf_fault_va;
+  801686:	8b 18                	mov    (%eax),%ebx
+  uint32_t err = utf->utf_err;
+  int r;
+
+  if (mmap_fault(utf))
+  801688:	50                   	push   %eax
+  801689:	e8 0c 1d 00 00       	call   80339a <mmap_fault>
+  80168e:	83 c4 10             	add    $0x10,%esp
+  801691:	84 c0                	test   %al,%al
+  801693:	74 05                	je     80169a <shared_pgfault+0x1e>
+  }
+
+  if ( (r = sys_page_unmap(0, PFTEMP)) < 0) {
+    panic("sys_page_unmap: %e", r);
+  }
+}
+  801695:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801698:	c9                   	leave
+  801699:	c3                   	ret
+  addr = ROUNDDOWN(addr, PGSIZE);
+  80169a:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if ( (r = sys_page_alloc(0, PFTEMP, (PTE_P | PTE_U | PTE_W))) < 0) {
+  8016a0:	83 ec 04             	sub    $0x4,%esp
+  8016a3:	6a 07                	push   $0x7
+  8016a5:	68 00 f0 7f 00       	push   $0x7ff000
+  8016aa:	6a 00                	push   $0x0
+  8016ac:	e8 1f fa ff ff       	call   8010d0 <sys_page_alloc>
+  8016b1:	83 c4 10             	add    $0x10,%esp
+  8016b4:	85 c0                	test   %eax,%eax
+  8016b6:	78 5b                	js     801713 <shared_pgfault+0x97>
+  memmove(PFTEMP, addr, PGSIZE);
+  8016b8:	83 ec 04             	sub    $0x4,%esp
+  8016bb:	68 00 10 00 00       	push   $0x1000
+  8016c0:	53                   	push   %ebx
+  8016c1:	68 00 f0 7f 00       	push   $0x7ff000
+  8016c6:	e8 5c f7 ff ff       	call   800e27 <memmove>
+  if ( (r = sys_page_map(0, PFTEMP, 0, addr, (PTE_P | PTE_U | PTE_W))) < 0) {
+  8016cb:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8016d2:	53                   	push   %ebx
+  8016d3:	6a 00                	push   $0x0
+  8016d5:	68 00 f0 7f 00       	push   $0x7ff000
+  8016da:	6a 00                	push   $0x0
+  8016dc:	e8 32 fa ff ff       	call   801113 <sys_page_map>
+  8016e1:	83 c4 20             	add    $0x20,%esp
+  8016e4:	85 c0                	test   %eax,%eax
+  8016e6:	78 40                	js     801728 <shared_pgfault+0xac>
+  if ( (r = sys_page_unmap(0, PFTEMP)) < 0) {
+  8016e8:	83 ec 08             	sub    $0x8,%esp
+  8016eb:	68 00 f0 7f 00       	push   $0x7ff000
+  8016f0:	6a 00                	push   $0x0
+  8016f2:	e8 5e fa ff ff       	call   801155 <sys_page_unmap>
+  8016f7:	83 c4 10             	add    $0x10,%esp
+  8016fa:	85 c0                	test   %eax,%eax
+  8016fc:	79 97                	jns    801695 <shared_pgfault+0x19>
+    panic("sys_page_unmap: %e", r);
+  8016fe:	50                   	push   %eax
+  8016ff:	68 a5 43 80 00       	push   $0x8043a5
+  801704:	68 b0 00 00 00       	push   $0xb0
+  801709:	68 7f 43 80 00       	push   $0x80437f
+  80170e:	e8 c5 ee ff ff       	call   8005d8 <_panic>
+    panic("sys_page_alloc: %e", r);
+  801713:	50                   	push   %eax
+  801714:	68 b2 3e 80 00       	push   $0x803eb2
+  801719:	68 a4 00 00 00       	push   $0xa4
+  80171e:	68 7f 43 80 00       	push   $0x80437f
+  801723:	e8 b0 ee ff ff       	call   8005d8 <_panic>
+    panic("sys_page_map: %e", r);
+  801728:	50                   	push   %eax
+  801729:	68 a1 3e 80 00       	push   $0x803ea1
+  80172e:	68 ac 00 00 00       	push   $0xac
+  801733:	68 7f 43 80 00       	push   $0x80437f
+  801738:	e8 9b ee ff ff       	call   8005d8 <_panic>
+
+0080173d <fork>:
+{
+  80173d:	55                   	push   %ebp
+  80173e:	89 e5                	mov    %esp,%ebp
+  801740:	53                   	push   %ebx
+  801741:	83 ec 04             	sub    $0x4,%esp
+  parent_id = sys_getenvid();
+  801744:	e8 06 f9 ff ff       	call   80104f <sys_getenvid>
+  set_pgfault_handler(pgfault);
+  801749:	83 ec 0c             	sub    $0xc,%esp
+  80174c:	68 7f 15 80 00       	push   $0x80157f
+  801751:	e8 d3 22 00 00       	call   803a29 <set_pgfault_handler>
+  801756:	b8 07 00 00 00       	mov    $0x7,%eax
+  80175b:	cd 30                	int    $0x30
+  80175d:	89 c3                	mov    %eax,%ebx
+  if (envid < 0) {
+  80175f:	83 c4 10             	add    $0x10,%esp
+  801762:	85 c0                	test   %eax,%eax
+  801764:	78 66                	js     8017cc <fork+0x8f>
+  } else if (envid == 0) {
+  801766:	74 76                	je     8017de <fork+0xa1>
+  if ( (error = sys_page_map_range(0, 0, UXSTACKTOP - PGSIZE,
+  801768:	83 ec 0c             	sub    $0xc,%esp
+  80176b:	6a 01                	push   $0x1
+  80176d:	50                   	push   %eax
+  80176e:	68 00 f0 bf ee       	push   $0xeebff000
+  801773:	6a 00                	push   $0x0
+  801775:	6a 00                	push   $0x0
+  801777:	e8 1b fa ff ff       	call   801197 <sys_page_map_range>
+  80177c:	83 c4 20             	add    $0x20,%esp
+  80177f:	85 c0                	test   %eax,%eax
+  801781:	78 77                	js     8017fa <fork+0xbd>
+  if ( (error = sys_page_alloc(envid,
+  801783:	83 ec 04             	sub    $0x4,%esp
+  801786:	6a 07                	push   $0x7
+  801788:	68 00 f0 bf ee       	push   $0xeebff000
+  80178d:	53                   	push   %ebx
+  80178e:	e8 3d f9 ff ff       	call   8010d0 <sys_page_alloc>
+  801793:	83 c4 10             	add    $0x10,%esp
+  801796:	85 c0                	test   %eax,%eax
+  801798:	78 72                	js     80180c <fork+0xcf>
+          thisenv->env_pgfault_upcall)) < 0) {
+  80179a:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  80179f:	8b 40 64             	mov    0x64(%eax),%eax
+  if ( (error = sys_env_set_pgfault_upcall(envid,
+  8017a2:	83 ec 08             	sub    $0x8,%esp
+  8017a5:	50                   	push   %eax
+  8017a6:	53                   	push   %ebx
+  8017a7:	e8 99 fb ff ff       	call   801345 <sys_env_set_pgfault_upcall>
+  8017ac:	83 c4 10             	add    $0x10,%esp
+  8017af:	85 c0                	test   %eax,%eax
+  8017b1:	78 6b                	js     80181e <fork+0xe1>
+  if ( (error = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+  8017b3:	83 ec 08             	sub    $0x8,%esp
+  8017b6:	6a 02                	push   $0x2
+  8017b8:	53                   	push   %ebx
+  8017b9:	e8 03 fb ff ff       	call   8012c1 <sys_env_set_status>
+  8017be:	83 c4 10             	add    $0x10,%esp
+  8017c1:	85 c0                	test   %eax,%eax
+  8017c3:	78 6b                	js     801830 <fork+0xf3>
+}
+  8017c5:	89 d8                	mov    %ebx,%eax
+  8017c7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017ca:	c9                   	leave
+  8017cb:	c3                   	ret
+    panic("sys_exofork: %e", envid);
+  8017cc:	50                   	push   %eax
+  8017cd:	68 80 3e 80 00       	push   $0x803e80
+  8017d2:	6a 5e                	push   $0x5e
+  8017d4:	68 7f 43 80 00       	push   $0x80437f
+  8017d9:	e8 fa ed ff ff       	call   8005d8 <_panic>
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8017de:	e8 6c f8 ff ff       	call   80104f <sys_getenvid>
+  8017e3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8017e8:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8017eb:	c1 e0 04             	shl    $0x4,%eax
+  8017ee:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8017f3:	a3 a0 68 80 00       	mov    %eax,0x8068a0
+    return 0;
+  8017f8:	eb cb                	jmp    8017c5 <fork+0x88>
+    panic("sys_page_map_range: %e", error);
+  8017fa:	50                   	push   %eax
+  8017fb:	68 b8 43 80 00       	push   $0x8043b8
+  801800:	6a 69                	push   $0x69
+  801802:	68 7f 43 80 00       	push   $0x80437f
+  801807:	e8 cc ed ff ff       	call   8005d8 <_panic>
+    panic("sys_page_alloc: %e", error);
+  80180c:	50                   	push   %eax
+  80180d:	68 b2 3e 80 00       	push   $0x803eb2
+  801812:	6a 70                	push   $0x70
+  801814:	68 7f 43 80 00       	push   $0x80437f
+  801819:	e8 ba ed ff ff       	call   8005d8 <_panic>
+    panic("sys_env_set_pgfault_upcall: %e", error);
+  80181e:	50                   	push   %eax
+  80181f:	68 20 3f 80 00       	push   $0x803f20
+  801824:	6a 76                	push   $0x76
+  801826:	68 7f 43 80 00       	push   $0x80437f
+  80182b:	e8 a8 ed ff ff       	call   8005d8 <_panic>
+    panic("sys_env_set_status: %e", error);
+  801830:	50                   	push   %eax
+  801831:	68 c5 3e 80 00       	push   $0x803ec5
+  801836:	6a 7a                	push   $0x7a
+  801838:	68 7f 43 80 00       	push   $0x80437f
+  80183d:	e8 96 ed ff ff       	call   8005d8 <_panic>
+
+00801842 <kfork>:
+{
+  801842:	55                   	push   %ebp
+  801843:	89 e5                	mov    %esp,%ebp
+  801845:	53                   	push   %ebx
+  801846:	83 ec 10             	sub    $0x10,%esp
+  set_pgfault_handler(pgfault);
+  801849:	68 7f 15 80 00       	push   $0x80157f
+  80184e:	e8 d6 21 00 00       	call   803a29 <set_pgfault_handler>
+  if ((envid = sys_fork()) == 0)
+  801853:	e8 4a fa ff ff       	call   8012a2 <sys_fork>
+  801858:	89 c3                	mov    %eax,%ebx
+  80185a:	83 c4 10             	add    $0x10,%esp
+  80185d:	85 c0                	test   %eax,%eax
+  80185f:	74 07                	je     801868 <kfork+0x26>
+}
+  801861:	89 d8                	mov    %ebx,%eax
+  801863:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801866:	c9                   	leave
+  801867:	c3                   	ret
+    thisenv = &envs[ENVX(sys_getenvid())];
+  801868:	e8 e2 f7 ff ff       	call   80104f <sys_getenvid>
+  80186d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801872:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  801875:	c1 e0 04             	shl    $0x4,%eax
+  801878:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80187d:	a3 a0 68 80 00       	mov    %eax,0x8068a0
+  return envid;
+  801882:	eb dd                	jmp    801861 <kfork+0x1f>
+
+00801884 <sfork>:
+
+int
+sfork(void)
+{
+  801884:	55                   	push   %ebp
+  801885:	89 e5                	mov    %esp,%ebp
+  801887:	53                   	push   %ebx
+  801888:	83 ec 04             	sub    $0x4,%esp
+  envid_t envid, parent_id;
+  int error;
+
+  parent_id = sys_getenvid();
+  80188b:	e8 bf f7 ff ff       	call   80104f <sys_getenvid>
+
+  // set up page fault handler
+  set_pgfault_handler(shared_pgfault);
+  801890:	83 ec 0c             	sub    $0xc,%esp
+  801893:	68 7c 16 80 00       	push   $0x80167c
+  801898:	e8 8c 21 00 00       	call   803a29 <set_pgfault_handler>
+  80189d:	b8 07 00 00 00       	mov    $0x7,%eax
+  8018a2:	cd 30                	int    $0x30
+  8018a4:	89 c3                	mov    %eax,%ebx
+
+  // create a child with sys_exofork
+  envid = sys_exofork();
+  
+  if (envid < 0) {
+  8018a6:	83 c4 10             	add    $0x10,%esp
+  8018a9:	85 c0                	test   %eax,%eax
+  8018ab:	78 09                	js     8018b6 <sfork+0x32>
+    panic("sys_exofork: %e", envid);
+  } else if (envid == 0) {
+  8018ad:	75 1c                	jne    8018cb <sfork+0x47>
+  if ( (error = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+    panic("sys_env_set_status: %e", error);
+  }
+
+  return envid;
+}
+  8018af:	89 d8                	mov    %ebx,%eax
+  8018b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018b4:	c9                   	leave
+  8018b5:	c3                   	ret
+    panic("sys_exofork: %e", envid);
+  8018b6:	50                   	push   %eax
+  8018b7:	68 80 3e 80 00       	push   $0x803e80
+  8018bc:	68 c3 00 00 00       	push   $0xc3
+  8018c1:	68 7f 43 80 00       	push   $0x80437f
+  8018c6:	e8 0d ed ff ff       	call   8005d8 <_panic>
+  if ( (error = sys_page_map_range(0, 0, USTACKTOP - PGSIZE,
+  8018cb:	83 ec 0c             	sub    $0xc,%esp
+  8018ce:	6a 00                	push   $0x0
+  8018d0:	50                   	push   %eax
+  8018d1:	68 00 d0 bf ee       	push   $0xeebfd000
+  8018d6:	6a 00                	push   $0x0
+  8018d8:	6a 00                	push   $0x0
+  8018da:	e8 b8 f8 ff ff       	call   801197 <sys_page_map_range>
+  8018df:	83 c4 20             	add    $0x20,%esp
+  8018e2:	85 c0                	test   %eax,%eax
+  8018e4:	78 79                	js     80195f <sfork+0xdb>
+  if ( (error = sys_page_map_range(0, (void *) (USTACKTOP - PGSIZE), PGSIZE,
+  8018e6:	83 ec 0c             	sub    $0xc,%esp
+  8018e9:	6a 01                	push   $0x1
+  8018eb:	53                   	push   %ebx
+  8018ec:	68 00 10 00 00       	push   $0x1000
+  8018f1:	68 00 d0 bf ee       	push   $0xeebfd000
+  8018f6:	6a 00                	push   $0x0
+  8018f8:	e8 9a f8 ff ff       	call   801197 <sys_page_map_range>
+  8018fd:	83 c4 20             	add    $0x20,%esp
+  801900:	85 c0                	test   %eax,%eax
+  801902:	78 70                	js     801974 <sfork+0xf0>
+  if ( (error = sys_page_alloc(envid,
+  801904:	83 ec 04             	sub    $0x4,%esp
+  801907:	6a 07                	push   $0x7
+  801909:	68 00 f0 bf ee       	push   $0xeebff000
+  80190e:	53                   	push   %ebx
+  80190f:	e8 bc f7 ff ff       	call   8010d0 <sys_page_alloc>
+  801914:	83 c4 10             	add    $0x10,%esp
+  801917:	85 c0                	test   %eax,%eax
+  801919:	78 6e                	js     801989 <sfork+0x105>
+          thisenv->env_pgfault_upcall)) < 0) {
+  80191b:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  801920:	8b 40 64             	mov    0x64(%eax),%eax
+  if ( (error = sys_env_set_pgfault_upcall(envid,
+  801923:	83 ec 08             	sub    $0x8,%esp
+  801926:	50                   	push   %eax
+  801927:	53                   	push   %ebx
+  801928:	e8 18 fa ff ff       	call   801345 <sys_env_set_pgfault_upcall>
+  80192d:	83 c4 10             	add    $0x10,%esp
+  801930:	85 c0                	test   %eax,%eax
+  801932:	78 6a                	js     80199e <sfork+0x11a>
+  if ( (error = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+  801934:	83 ec 08             	sub    $0x8,%esp
+  801937:	6a 02                	push   $0x2
+  801939:	53                   	push   %ebx
+  80193a:	e8 82 f9 ff ff       	call   8012c1 <sys_env_set_status>
+  80193f:	83 c4 10             	add    $0x10,%esp
+  801942:	85 c0                	test   %eax,%eax
+  801944:	0f 89 65 ff ff ff    	jns    8018af <sfork+0x2b>
+    panic("sys_env_set_status: %e", error);
+  80194a:	50                   	push   %eax
+  80194b:	68 c5 3e 80 00       	push   $0x803ec5
+  801950:	68 e4 00 00 00       	push   $0xe4
+  801955:	68 7f 43 80 00       	push   $0x80437f
+  80195a:	e8 79 ec ff ff       	call   8005d8 <_panic>
+    panic("sys_page_map_range: %e", error);
+  80195f:	50                   	push   %eax
+  801960:	68 b8 43 80 00       	push   $0x8043b8
+  801965:	68 ce 00 00 00       	push   $0xce
+  80196a:	68 7f 43 80 00       	push   $0x80437f
+  80196f:	e8 64 ec ff ff       	call   8005d8 <_panic>
+    panic("sys_page_map_range: %e", error);
+  801974:	50                   	push   %eax
+  801975:	68 b8 43 80 00       	push   $0x8043b8
+  80197a:	68 d3 00 00 00       	push   $0xd3
+  80197f:	68 7f 43 80 00       	push   $0x80437f
+  801984:	e8 4f ec ff ff       	call   8005d8 <_panic>
+    panic("sys_page_alloc: %e", error);
+  801989:	50                   	push   %eax
+  80198a:	68 b2 3e 80 00       	push   $0x803eb2
+  80198f:	68 da 00 00 00       	push   $0xda
+  801994:	68 7f 43 80 00       	push   $0x80437f
+  801999:	e8 3a ec ff ff       	call   8005d8 <_panic>
+    panic("sys_env_set_pgfault_upcall: %e", error);
+  80199e:	50                   	push   %eax
+  80199f:	68 20 3f 80 00       	push   $0x803f20
+  8019a4:	68 e0 00 00 00       	push   $0xe0
+  8019a9:	68 7f 43 80 00       	push   $0x80437f
+  8019ae:	e8 25 ec ff ff       	call   8005d8 <_panic>
+
+008019b3 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8019b3:	55                   	push   %ebp
+  8019b4:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8019b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019b9:	05 00 00 00 30       	add    $0x30000000,%eax
+  8019be:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8019c1:	5d                   	pop    %ebp
+  8019c2:	c3                   	ret
+
+008019c3 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8019c3:	55                   	push   %ebp
+  8019c4:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8019c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019c9:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  8019cc:	66 b8 00 00          	mov    $0x0,%ax
+  8019d0:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8019d5:	5d                   	pop    %ebp
+  8019d6:	c3                   	ret
+
+008019d7 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8019d7:	55                   	push   %ebp
+  8019d8:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  8019da:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8019df:	eb 02                	jmp    8019e3 <fd_alloc+0xc>
+  8019e1:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8019e3:	89 c2                	mov    %eax,%edx
+  8019e5:	c1 ea 16             	shr    $0x16,%edx
+  8019e8:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8019ef:	f6 c2 01             	test   $0x1,%dl
+  8019f2:	74 2b                	je     801a1f <fd_alloc+0x48>
+  8019f4:	89 c2                	mov    %eax,%edx
+  8019f6:	c1 ea 0c             	shr    $0xc,%edx
+  8019f9:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801a00:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801a06:	f6 c1 01             	test   $0x1,%cl
+  801a09:	74 14                	je     801a1f <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  801a0b:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801a11:	75 ce                	jne    8019e1 <fd_alloc+0xa>
+  801a13:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  801a18:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801a1d:	eb 05                	jmp    801a24 <fd_alloc+0x4d>
+      return 0;
+  801a1f:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  801a24:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a27:	89 02                	mov    %eax,(%edx)
+}
+  801a29:	89 c8                	mov    %ecx,%eax
+  801a2b:	5d                   	pop    %ebp
+  801a2c:	c3                   	ret
+
+00801a2d <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801a2d:	55                   	push   %ebp
+  801a2e:	89 e5                	mov    %esp,%ebp
+  801a30:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  801a33:	83 f8 1f             	cmp    $0x1f,%eax
+  801a36:	77 30                	ja     801a68 <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  801a38:	c1 e0 0c             	shl    $0xc,%eax
+  801a3b:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801a40:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801a46:	f6 c2 01             	test   $0x1,%dl
+  801a49:	74 24                	je     801a6f <fd_lookup+0x42>
+  801a4b:	89 c2                	mov    %eax,%edx
+  801a4d:	c1 ea 0c             	shr    $0xc,%edx
+  801a50:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801a57:	f6 c2 01             	test   $0x1,%dl
+  801a5a:	74 1a                	je     801a76 <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  801a5c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a5f:	89 02                	mov    %eax,(%edx)
+  return 0;
+  801a61:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a66:	5d                   	pop    %ebp
+  801a67:	c3                   	ret
+    return -E_INVAL;
+  801a68:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a6d:	eb f7                	jmp    801a66 <fd_lookup+0x39>
+    return -E_INVAL;
+  801a6f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a74:	eb f0                	jmp    801a66 <fd_lookup+0x39>
+  801a76:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a7b:	eb e9                	jmp    801a66 <fd_lookup+0x39>
+
+00801a7d <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801a7d:	55                   	push   %ebp
+  801a7e:	89 e5                	mov    %esp,%ebp
+  801a80:	53                   	push   %ebx
+  801a81:	83 ec 04             	sub    $0x4,%esp
+  801a84:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  801a87:	b8 4c 44 80 00       	mov    $0x80444c,%eax
+  801a8c:	8b 18                	mov    (%eax),%ebx
+  801a8e:	85 db                	test   %ebx,%ebx
+  801a90:	74 0e                	je     801aa0 <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  801a92:	83 c0 04             	add    $0x4,%eax
+  801a95:	39 13                	cmp    %edx,(%ebx)
+  801a97:	75 f3                	jne    801a8c <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  801a99:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a9e:	eb 1f                	jmp    801abf <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801aa0:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  801aa5:	8b 40 48             	mov    0x48(%eax),%eax
+  801aa8:	83 ec 04             	sub    $0x4,%esp
+  801aab:	52                   	push   %edx
+  801aac:	50                   	push   %eax
+  801aad:	68 d0 43 80 00       	push   $0x8043d0
+  801ab2:	e8 fc eb ff ff       	call   8006b3 <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  801ab7:	83 c4 10             	add    $0x10,%esp
+  801aba:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  801abf:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801ac2:	89 1a                	mov    %ebx,(%edx)
+}
+  801ac4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ac7:	c9                   	leave
+  801ac8:	c3                   	ret
+
+00801ac9 <fd_close>:
+{
+  801ac9:	55                   	push   %ebp
+  801aca:	89 e5                	mov    %esp,%ebp
+  801acc:	57                   	push   %edi
+  801acd:	56                   	push   %esi
+  801ace:	53                   	push   %ebx
+  801acf:	83 ec 24             	sub    $0x24,%esp
+  801ad2:	8b 75 08             	mov    0x8(%ebp),%esi
+  801ad5:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801ad8:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801adb:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801adc:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801ae2:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801ae5:	50                   	push   %eax
+  801ae6:	e8 42 ff ff ff       	call   801a2d <fd_lookup>
+  801aeb:	89 c3                	mov    %eax,%ebx
+  801aed:	83 c4 10             	add    $0x10,%esp
+  801af0:	85 c0                	test   %eax,%eax
+  801af2:	78 05                	js     801af9 <fd_close+0x30>
+      || fd != fd2)
+  801af4:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801af7:	74 16                	je     801b0f <fd_close+0x46>
+    return must_exist ? r : 0;
+  801af9:	89 f8                	mov    %edi,%eax
+  801afb:	84 c0                	test   %al,%al
+  801afd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b02:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801b05:	89 d8                	mov    %ebx,%eax
+  801b07:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b0a:	5b                   	pop    %ebx
+  801b0b:	5e                   	pop    %esi
+  801b0c:	5f                   	pop    %edi
+  801b0d:	5d                   	pop    %ebp
+  801b0e:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801b0f:	83 ec 08             	sub    $0x8,%esp
+  801b12:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801b15:	50                   	push   %eax
+  801b16:	ff 36                	push   (%esi)
+  801b18:	e8 60 ff ff ff       	call   801a7d <dev_lookup>
+  801b1d:	89 c3                	mov    %eax,%ebx
+  801b1f:	83 c4 10             	add    $0x10,%esp
+  801b22:	85 c0                	test   %eax,%eax
+  801b24:	78 1a                	js     801b40 <fd_close+0x77>
+    if (dev->dev_close)
+  801b26:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801b29:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  801b2c:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  801b31:	85 c0                	test   %eax,%eax
+  801b33:	74 0b                	je     801b40 <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  801b35:	83 ec 0c             	sub    $0xc,%esp
+  801b38:	56                   	push   %esi
+  801b39:	ff d0                	call   *%eax
+  801b3b:	89 c3                	mov    %eax,%ebx
+  801b3d:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  801b40:	83 ec 08             	sub    $0x8,%esp
+  801b43:	56                   	push   %esi
+  801b44:	6a 00                	push   $0x0
+  801b46:	e8 0a f6 ff ff       	call   801155 <sys_page_unmap>
+  return r;
+  801b4b:	83 c4 10             	add    $0x10,%esp
+  801b4e:	eb b5                	jmp    801b05 <fd_close+0x3c>
+
+00801b50 <close>:
+
+int
+close(int fdnum)
+{
+  801b50:	55                   	push   %ebp
+  801b51:	89 e5                	mov    %esp,%ebp
+  801b53:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801b56:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b59:	50                   	push   %eax
+  801b5a:	ff 75 08             	push   0x8(%ebp)
+  801b5d:	e8 cb fe ff ff       	call   801a2d <fd_lookup>
+  801b62:	83 c4 10             	add    $0x10,%esp
+  801b65:	85 c0                	test   %eax,%eax
+  801b67:	79 02                	jns    801b6b <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  801b69:	c9                   	leave
+  801b6a:	c3                   	ret
+    return fd_close(fd, 1);
+  801b6b:	83 ec 08             	sub    $0x8,%esp
+  801b6e:	6a 01                	push   $0x1
+  801b70:	ff 75 f4             	push   -0xc(%ebp)
+  801b73:	e8 51 ff ff ff       	call   801ac9 <fd_close>
+  801b78:	83 c4 10             	add    $0x10,%esp
+  801b7b:	eb ec                	jmp    801b69 <close+0x19>
+
+00801b7d <close_all>:
+
+void
+close_all(void)
+{
+  801b7d:	55                   	push   %ebp
+  801b7e:	89 e5                	mov    %esp,%ebp
+  801b80:	53                   	push   %ebx
+  801b81:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  801b84:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  801b89:	83 ec 0c             	sub    $0xc,%esp
+  801b8c:	53                   	push   %ebx
+  801b8d:	e8 be ff ff ff       	call   801b50 <close>
+  for (i = 0; i < MAXFD; i++)
+  801b92:	83 c3 01             	add    $0x1,%ebx
+  801b95:	83 c4 10             	add    $0x10,%esp
+  801b98:	83 fb 20             	cmp    $0x20,%ebx
+  801b9b:	75 ec                	jne    801b89 <close_all+0xc>
+}
+  801b9d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ba0:	c9                   	leave
+  801ba1:	c3                   	ret
+
+00801ba2 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801ba2:	55                   	push   %ebp
+  801ba3:	89 e5                	mov    %esp,%ebp
+  801ba5:	57                   	push   %edi
+  801ba6:	56                   	push   %esi
+  801ba7:	53                   	push   %ebx
+  801ba8:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801bab:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801bae:	50                   	push   %eax
+  801baf:	ff 75 08             	push   0x8(%ebp)
+  801bb2:	e8 76 fe ff ff       	call   801a2d <fd_lookup>
+  801bb7:	89 c6                	mov    %eax,%esi
+  801bb9:	83 c4 10             	add    $0x10,%esp
+  801bbc:	85 c0                	test   %eax,%eax
+  801bbe:	0f 88 0a 01 00 00    	js     801cce <dup+0x12c>
+    return r;
+  close(newfdnum);
+  801bc4:	83 ec 0c             	sub    $0xc,%esp
+  801bc7:	ff 75 0c             	push   0xc(%ebp)
+  801bca:	e8 81 ff ff ff       	call   801b50 <close>
+
+  newfd = INDEX2FD(newfdnum);
+  801bcf:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801bd2:	c1 e0 0c             	shl    $0xc,%eax
+  801bd5:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  801bdb:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  801bde:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801be1:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  801be4:	89 04 24             	mov    %eax,(%esp)
+  801be7:	e8 d7 fd ff ff       	call   8019c3 <fd2data>
+  801bec:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  801bee:	89 3c 24             	mov    %edi,(%esp)
+  801bf1:	e8 cd fd ff ff       	call   8019c3 <fd2data>
+  801bf6:	83 c4 10             	add    $0x10,%esp
+  801bf9:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801bfc:	89 f3                	mov    %esi,%ebx
+  801bfe:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  801c04:	89 c6                	mov    %eax,%esi
+  801c06:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801c09:	89 cf                	mov    %ecx,%edi
+  801c0b:	eb 0c                	jmp    801c19 <dup+0x77>
+  801c0d:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801c13:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801c19:	39 fb                	cmp    %edi,%ebx
+  801c1b:	74 7b                	je     801c98 <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  801c1d:	89 d8                	mov    %ebx,%eax
+  801c1f:	c1 e8 16             	shr    $0x16,%eax
+  801c22:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801c29:	a8 01                	test   $0x1,%al
+  801c2b:	74 e0                	je     801c0d <dup+0x6b>
+  801c2d:	89 d8                	mov    %ebx,%eax
+  801c2f:	c1 e8 0c             	shr    $0xc,%eax
+  801c32:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801c39:	f6 c2 01             	test   $0x1,%dl
+  801c3c:	74 cf                	je     801c0d <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  801c3e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  801c45:	83 ec 0c             	sub    $0xc,%esp
+  801c48:	25 07 0e 00 00       	and    $0xe07,%eax
+  801c4d:	50                   	push   %eax
+  801c4e:	56                   	push   %esi
+  801c4f:	6a 00                	push   $0x0
+  801c51:	53                   	push   %ebx
+  801c52:	6a 00                	push   $0x0
+  801c54:	e8 ba f4 ff ff       	call   801113 <sys_page_map>
+  801c59:	83 c4 20             	add    $0x20,%esp
+  801c5c:	85 c0                	test   %eax,%eax
+  801c5e:	79 ad                	jns    801c0d <dup+0x6b>
+  801c60:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801c63:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  801c65:	83 ec 08             	sub    $0x8,%esp
+  801c68:	ff 75 d4             	push   -0x2c(%ebp)
+  801c6b:	6a 00                	push   $0x0
+  801c6d:	e8 e3 f4 ff ff       	call   801155 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801c72:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  801c75:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  801c7b:	83 c4 10             	add    $0x10,%esp
+  801c7e:	39 df                	cmp    %ebx,%edi
+  801c80:	74 4c                	je     801cce <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  801c82:	83 ec 08             	sub    $0x8,%esp
+  801c85:	57                   	push   %edi
+  801c86:	6a 00                	push   $0x0
+  801c88:	e8 c8 f4 ff ff       	call   801155 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801c8d:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  801c93:	83 c4 10             	add    $0x10,%esp
+  801c96:	eb e6                	jmp    801c7e <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801c98:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801c9b:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  801c9e:	89 c8                	mov    %ecx,%eax
+  801ca0:	c1 e8 0c             	shr    $0xc,%eax
+  801ca3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801caa:	83 ec 0c             	sub    $0xc,%esp
+  801cad:	25 07 0e 00 00       	and    $0xe07,%eax
+  801cb2:	50                   	push   %eax
+  801cb3:	ff 75 d4             	push   -0x2c(%ebp)
+  801cb6:	6a 00                	push   $0x0
+  801cb8:	51                   	push   %ecx
+  801cb9:	6a 00                	push   $0x0
+  801cbb:	e8 53 f4 ff ff       	call   801113 <sys_page_map>
+  801cc0:	89 c6                	mov    %eax,%esi
+  801cc2:	83 c4 20             	add    $0x20,%esp
+  801cc5:	85 c0                	test   %eax,%eax
+  801cc7:	78 9c                	js     801c65 <dup+0xc3>
+  return newfdnum;
+  801cc9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ccc:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  801cce:	89 f0                	mov    %esi,%eax
+  801cd0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cd3:	5b                   	pop    %ebx
+  801cd4:	5e                   	pop    %esi
+  801cd5:	5f                   	pop    %edi
+  801cd6:	5d                   	pop    %ebp
+  801cd7:	c3                   	ret
+
+00801cd8 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801cd8:	55                   	push   %ebp
+  801cd9:	89 e5                	mov    %esp,%ebp
+  801cdb:	56                   	push   %esi
+  801cdc:	53                   	push   %ebx
+  801cdd:	83 ec 18             	sub    $0x18,%esp
+  801ce0:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801ce3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ce6:	50                   	push   %eax
+  801ce7:	56                   	push   %esi
+  801ce8:	e8 40 fd ff ff       	call   801a2d <fd_lookup>
+  801ced:	83 c4 10             	add    $0x10,%esp
+  801cf0:	85 c0                	test   %eax,%eax
+  801cf2:	78 3c                	js     801d30 <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801cf4:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801cf7:	83 ec 08             	sub    $0x8,%esp
+  801cfa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cfd:	50                   	push   %eax
+  801cfe:	ff 33                	push   (%ebx)
+  801d00:	e8 78 fd ff ff       	call   801a7d <dev_lookup>
+  801d05:	83 c4 10             	add    $0x10,%esp
+  801d08:	85 c0                	test   %eax,%eax
+  801d0a:	78 24                	js     801d30 <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801d0c:	8b 43 08             	mov    0x8(%ebx),%eax
+  801d0f:	83 e0 03             	and    $0x3,%eax
+  801d12:	83 f8 01             	cmp    $0x1,%eax
+  801d15:	74 20                	je     801d37 <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  801d17:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d1a:	8b 40 08             	mov    0x8(%eax),%eax
+  801d1d:	85 c0                	test   %eax,%eax
+  801d1f:	74 37                	je     801d58 <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  801d21:	83 ec 04             	sub    $0x4,%esp
+  801d24:	ff 75 10             	push   0x10(%ebp)
+  801d27:	ff 75 0c             	push   0xc(%ebp)
+  801d2a:	53                   	push   %ebx
+  801d2b:	ff d0                	call   *%eax
+  801d2d:	83 c4 10             	add    $0x10,%esp
+}
+  801d30:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d33:	5b                   	pop    %ebx
+  801d34:	5e                   	pop    %esi
+  801d35:	5d                   	pop    %ebp
+  801d36:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d37:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  801d3c:	8b 40 48             	mov    0x48(%eax),%eax
+  801d3f:	83 ec 04             	sub    $0x4,%esp
+  801d42:	56                   	push   %esi
+  801d43:	50                   	push   %eax
+  801d44:	68 11 44 80 00       	push   $0x804411
+  801d49:	e8 65 e9 ff ff       	call   8006b3 <cprintf>
+    return -E_INVAL;
+  801d4e:	83 c4 10             	add    $0x10,%esp
+  801d51:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d56:	eb d8                	jmp    801d30 <read+0x58>
+    return -E_NOT_SUPP;
+  801d58:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d5d:	eb d1                	jmp    801d30 <read+0x58>
+
+00801d5f <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801d5f:	55                   	push   %ebp
+  801d60:	89 e5                	mov    %esp,%ebp
+  801d62:	57                   	push   %edi
+  801d63:	56                   	push   %esi
+  801d64:	53                   	push   %ebx
+  801d65:	83 ec 0c             	sub    $0xc,%esp
+  801d68:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801d6b:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  801d6e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d73:	eb 02                	jmp    801d77 <readn+0x18>
+  801d75:	01 c3                	add    %eax,%ebx
+  801d77:	39 f3                	cmp    %esi,%ebx
+  801d79:	73 21                	jae    801d9c <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  801d7b:	83 ec 04             	sub    $0x4,%esp
+  801d7e:	89 f0                	mov    %esi,%eax
+  801d80:	29 d8                	sub    %ebx,%eax
+  801d82:	50                   	push   %eax
+  801d83:	89 d8                	mov    %ebx,%eax
+  801d85:	03 45 0c             	add    0xc(%ebp),%eax
+  801d88:	50                   	push   %eax
+  801d89:	57                   	push   %edi
+  801d8a:	e8 49 ff ff ff       	call   801cd8 <read>
+    if (m < 0)
+  801d8f:	83 c4 10             	add    $0x10,%esp
+  801d92:	85 c0                	test   %eax,%eax
+  801d94:	78 04                	js     801d9a <readn+0x3b>
+      return m;
+    if (m == 0)
+  801d96:	75 dd                	jne    801d75 <readn+0x16>
+  801d98:	eb 02                	jmp    801d9c <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  801d9a:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  801d9c:	89 d8                	mov    %ebx,%eax
+  801d9e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801da1:	5b                   	pop    %ebx
+  801da2:	5e                   	pop    %esi
+  801da3:	5f                   	pop    %edi
+  801da4:	5d                   	pop    %ebp
+  801da5:	c3                   	ret
+
+00801da6 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801da6:	55                   	push   %ebp
+  801da7:	89 e5                	mov    %esp,%ebp
+  801da9:	56                   	push   %esi
+  801daa:	53                   	push   %ebx
+  801dab:	83 ec 18             	sub    $0x18,%esp
+  801dae:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801db1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801db4:	50                   	push   %eax
+  801db5:	53                   	push   %ebx
+  801db6:	e8 72 fc ff ff       	call   801a2d <fd_lookup>
+  801dbb:	83 c4 10             	add    $0x10,%esp
+  801dbe:	85 c0                	test   %eax,%eax
+  801dc0:	78 37                	js     801df9 <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801dc2:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801dc5:	83 ec 08             	sub    $0x8,%esp
+  801dc8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801dcb:	50                   	push   %eax
+  801dcc:	ff 36                	push   (%esi)
+  801dce:	e8 aa fc ff ff       	call   801a7d <dev_lookup>
+  801dd3:	83 c4 10             	add    $0x10,%esp
+  801dd6:	85 c0                	test   %eax,%eax
+  801dd8:	78 1f                	js     801df9 <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801dda:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801dde:	74 20                	je     801e00 <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  801de0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801de3:	8b 40 0c             	mov    0xc(%eax),%eax
+  801de6:	85 c0                	test   %eax,%eax
+  801de8:	74 37                	je     801e21 <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  801dea:	83 ec 04             	sub    $0x4,%esp
+  801ded:	ff 75 10             	push   0x10(%ebp)
+  801df0:	ff 75 0c             	push   0xc(%ebp)
+  801df3:	56                   	push   %esi
+  801df4:	ff d0                	call   *%eax
+  801df6:	83 c4 10             	add    $0x10,%esp
+}
+  801df9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801dfc:	5b                   	pop    %ebx
+  801dfd:	5e                   	pop    %esi
+  801dfe:	5d                   	pop    %ebp
+  801dff:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e00:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  801e05:	8b 40 48             	mov    0x48(%eax),%eax
+  801e08:	83 ec 04             	sub    $0x4,%esp
+  801e0b:	53                   	push   %ebx
+  801e0c:	50                   	push   %eax
+  801e0d:	68 2d 44 80 00       	push   $0x80442d
+  801e12:	e8 9c e8 ff ff       	call   8006b3 <cprintf>
+    return -E_INVAL;
+  801e17:	83 c4 10             	add    $0x10,%esp
+  801e1a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e1f:	eb d8                	jmp    801df9 <write+0x53>
+    return -E_NOT_SUPP;
+  801e21:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e26:	eb d1                	jmp    801df9 <write+0x53>
+
+00801e28 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801e28:	55                   	push   %ebp
+  801e29:	89 e5                	mov    %esp,%ebp
+  801e2b:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801e2e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e31:	50                   	push   %eax
+  801e32:	ff 75 08             	push   0x8(%ebp)
+  801e35:	e8 f3 fb ff ff       	call   801a2d <fd_lookup>
+  801e3a:	83 c4 10             	add    $0x10,%esp
+  801e3d:	85 c0                	test   %eax,%eax
+  801e3f:	78 0e                	js     801e4f <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  801e41:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801e44:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e47:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  801e4a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e4f:	c9                   	leave
+  801e50:	c3                   	ret
+
+00801e51 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801e51:	55                   	push   %ebp
+  801e52:	89 e5                	mov    %esp,%ebp
+  801e54:	56                   	push   %esi
+  801e55:	53                   	push   %ebx
+  801e56:	83 ec 18             	sub    $0x18,%esp
+  801e59:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801e5c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e5f:	50                   	push   %eax
+  801e60:	53                   	push   %ebx
+  801e61:	e8 c7 fb ff ff       	call   801a2d <fd_lookup>
+  801e66:	83 c4 10             	add    $0x10,%esp
+  801e69:	85 c0                	test   %eax,%eax
+  801e6b:	78 34                	js     801ea1 <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801e6d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801e70:	83 ec 08             	sub    $0x8,%esp
+  801e73:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e76:	50                   	push   %eax
+  801e77:	ff 36                	push   (%esi)
+  801e79:	e8 ff fb ff ff       	call   801a7d <dev_lookup>
+  801e7e:	83 c4 10             	add    $0x10,%esp
+  801e81:	85 c0                	test   %eax,%eax
+  801e83:	78 1c                	js     801ea1 <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e85:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801e89:	74 1d                	je     801ea8 <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  801e8b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e8e:	8b 40 18             	mov    0x18(%eax),%eax
+  801e91:	85 c0                	test   %eax,%eax
+  801e93:	74 34                	je     801ec9 <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  801e95:	83 ec 08             	sub    $0x8,%esp
+  801e98:	ff 75 0c             	push   0xc(%ebp)
+  801e9b:	56                   	push   %esi
+  801e9c:	ff d0                	call   *%eax
+  801e9e:	83 c4 10             	add    $0x10,%esp
+}
+  801ea1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ea4:	5b                   	pop    %ebx
+  801ea5:	5e                   	pop    %esi
+  801ea6:	5d                   	pop    %ebp
+  801ea7:	c3                   	ret
+            thisenv->env_id, fdnum);
+  801ea8:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  801ead:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801eb0:	83 ec 04             	sub    $0x4,%esp
+  801eb3:	53                   	push   %ebx
+  801eb4:	50                   	push   %eax
+  801eb5:	68 f0 43 80 00       	push   $0x8043f0
+  801eba:	e8 f4 e7 ff ff       	call   8006b3 <cprintf>
+    return -E_INVAL;
+  801ebf:	83 c4 10             	add    $0x10,%esp
+  801ec2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ec7:	eb d8                	jmp    801ea1 <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  801ec9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ece:	eb d1                	jmp    801ea1 <ftruncate+0x50>
+
+00801ed0 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801ed0:	55                   	push   %ebp
+  801ed1:	89 e5                	mov    %esp,%ebp
+  801ed3:	56                   	push   %esi
+  801ed4:	53                   	push   %ebx
+  801ed5:	83 ec 18             	sub    $0x18,%esp
+  801ed8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801edb:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ede:	50                   	push   %eax
+  801edf:	ff 75 08             	push   0x8(%ebp)
+  801ee2:	e8 46 fb ff ff       	call   801a2d <fd_lookup>
+  801ee7:	83 c4 10             	add    $0x10,%esp
+  801eea:	85 c0                	test   %eax,%eax
+  801eec:	78 49                	js     801f37 <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801eee:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801ef1:	83 ec 08             	sub    $0x8,%esp
+  801ef4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ef7:	50                   	push   %eax
+  801ef8:	ff 36                	push   (%esi)
+  801efa:	e8 7e fb ff ff       	call   801a7d <dev_lookup>
+  801eff:	83 c4 10             	add    $0x10,%esp
+  801f02:	85 c0                	test   %eax,%eax
+  801f04:	78 31                	js     801f37 <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  801f06:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f09:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801f0d:	74 2f                	je     801f3e <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  801f0f:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  801f12:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801f19:	00 00 00 
+  stat->st_isdir = 0;
+  801f1c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801f23:	00 00 00 
+  stat->st_dev = dev;
+  801f26:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  801f2c:	83 ec 08             	sub    $0x8,%esp
+  801f2f:	53                   	push   %ebx
+  801f30:	56                   	push   %esi
+  801f31:	ff 50 14             	call   *0x14(%eax)
+  801f34:	83 c4 10             	add    $0x10,%esp
+}
+  801f37:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f3a:	5b                   	pop    %ebx
+  801f3b:	5e                   	pop    %esi
+  801f3c:	5d                   	pop    %ebp
+  801f3d:	c3                   	ret
+    return -E_NOT_SUPP;
+  801f3e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801f43:	eb f2                	jmp    801f37 <fstat+0x67>
+
+00801f45 <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  801f45:	55                   	push   %ebp
+  801f46:	89 e5                	mov    %esp,%ebp
+  801f48:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  801f4b:	ff 75 0c             	push   0xc(%ebp)
+  801f4e:	ff 75 08             	push   0x8(%ebp)
+  801f51:	e8 58 07 00 00       	call   8026ae <file_stat>
+}
+  801f56:	c9                   	leave
+  801f57:	c3                   	ret
+
+00801f58 <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  801f58:	55                   	push   %ebp
+  801f59:	89 e5                	mov    %esp,%ebp
+  801f5b:	57                   	push   %edi
+  801f5c:	56                   	push   %esi
+  801f5d:	53                   	push   %ebx
+  801f5e:	83 ec 1c             	sub    $0x1c,%esp
+  801f61:	89 c7                	mov    %eax,%edi
+  801f63:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801f66:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801f69:	e9 a2 00 00 00       	jmp    802010 <fsipc_send+0xb8>
+  nfsenvs = 0;
+  801f6e:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  801f75:	00 00 00 
+  801f78:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f7d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801f82:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801f87:	be 01 00 00 00       	mov    $0x1,%esi
+  801f8c:	eb 0f                	jmp    801f9d <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801f8e:	83 c0 01             	add    $0x1,%eax
+  801f91:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801f96:	74 49                	je     801fe1 <fsipc_send+0x89>
+  801f98:	83 f9 07             	cmp    $0x7,%ecx
+  801f9b:	7f 50                	jg     801fed <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  801f9d:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801fa0:	c1 e2 04             	shl    $0x4,%edx
+  801fa3:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801fa9:	8b 52 50             	mov    0x50(%edx),%edx
+  801fac:	83 fa 01             	cmp    $0x1,%edx
+  801faf:	75 dd                	jne    801f8e <fsipc_send+0x36>
+  801fb1:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801fb4:	c1 e2 04             	shl    $0x4,%edx
+  801fb7:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801fbd:	8b 52 54             	mov    0x54(%edx),%edx
+  801fc0:	85 d2                	test   %edx,%edx
+  801fc2:	74 ca                	je     801f8e <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801fc4:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801fc7:	c1 e2 04             	shl    $0x4,%edx
+  801fca:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801fd0:	8b 52 48             	mov    0x48(%edx),%edx
+  801fd3:	89 14 8d 20 60 80 00 	mov    %edx,0x806020(,%ecx,4)
+  801fda:	8d 49 01             	lea    0x1(%ecx),%ecx
+  801fdd:	89 f3                	mov    %esi,%ebx
+  801fdf:	eb ad                	jmp    801f8e <fsipc_send+0x36>
+  801fe1:	84 db                	test   %bl,%bl
+  801fe3:	74 38                	je     80201d <fsipc_send+0xc5>
+  801fe5:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+  801feb:	eb 30                	jmp    80201d <fsipc_send+0xc5>
+  801fed:	84 db                	test   %bl,%bl
+  801fef:	74 2c                	je     80201d <fsipc_send+0xc5>
+  801ff1:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+  801ff7:	eb 24                	jmp    80201d <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  801ff9:	50                   	push   %eax
+  801ffa:	68 5c 44 80 00       	push   $0x80445c
+  801fff:	6a 34                	push   $0x34
+  802001:	68 66 44 80 00       	push   $0x804466
+  802006:	e8 cd e5 ff ff       	call   8005d8 <_panic>
+    }
+    sys_yield();
+  80200b:	e8 5e f0 ff ff       	call   80106e <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  802010:	83 3d 00 60 80 00 03 	cmpl   $0x3,0x806000
+  802017:	0f 8e 51 ff ff ff    	jle    801f6e <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  80201d:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  802022:	8b 70 48             	mov    0x48(%eax),%esi
+  802025:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  80202b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802030:	8b 0d 00 60 80 00    	mov    0x806000,%ecx
+  802036:	39 d9                	cmp    %ebx,%ecx
+  802038:	7e d1                	jle    80200b <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  80203a:	83 ec 0c             	sub    $0xc,%esp
+  80203d:	ff 75 e0             	push   -0x20(%ebp)
+  802040:	6a 07                	push   $0x7
+  802042:	ff 75 e4             	push   -0x1c(%ebp)
+  802045:	57                   	push   %edi
+  802046:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  802049:	99                   	cltd
+  80204a:	f7 f9                	idiv   %ecx
+  80204c:	ff 34 95 20 60 80 00 	push   0x806020(,%edx,4)
+  802053:	e8 2f f3 ff ff       	call   801387 <sys_ipc_try_send>
+      if (r == 0)
+  802058:	83 c4 20             	add    $0x20,%esp
+  80205b:	85 c0                	test   %eax,%eax
+  80205d:	74 0a                	je     802069 <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  80205f:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802062:	75 95                	jne    801ff9 <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  802064:	83 c3 01             	add    $0x1,%ebx
+  802067:	eb c7                	jmp    802030 <fsipc_send+0xd8>
+  }
+}
+  802069:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80206c:	5b                   	pop    %ebx
+  80206d:	5e                   	pop    %esi
+  80206e:	5f                   	pop    %edi
+  80206f:	5d                   	pop    %ebp
+  802070:	c3                   	ret
+
+00802071 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  802071:	55                   	push   %ebp
+  802072:	89 e5                	mov    %esp,%ebp
+  802074:	53                   	push   %ebx
+  802075:	83 ec 14             	sub    $0x14,%esp
+  802078:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  80207a:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  802081:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802086:	ba 00 70 80 00       	mov    $0x807000,%edx
+  80208b:	e8 c8 fe ff ff       	call   801f58 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  802090:	6a 00                	push   $0x0
+  802092:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802095:	50                   	push   %eax
+  802096:	53                   	push   %ebx
+  802097:	6a 00                	push   $0x0
+  802099:	e8 f8 19 00 00       	call   803a96 <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  80209e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020a1:	c9                   	leave
+  8020a2:	c3                   	ret
+
+008020a3 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8020a3:	55                   	push   %ebp
+  8020a4:	89 e5                	mov    %esp,%ebp
+  8020a6:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8020a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020ac:	8b 40 0c             	mov    0xc(%eax),%eax
+  8020af:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.set_size.req_size = newsize;
+  8020b4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020b7:	a3 04 70 80 00       	mov    %eax,0x807004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  8020bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020c1:	b8 02 00 00 00       	mov    $0x2,%eax
+  8020c6:	e8 a6 ff ff ff       	call   802071 <fsipc>
+}
+  8020cb:	c9                   	leave
+  8020cc:	c3                   	ret
+
+008020cd <devfile_flush>:
+{
+  8020cd:	55                   	push   %ebp
+  8020ce:	89 e5                	mov    %esp,%ebp
+  8020d0:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8020d3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020d6:	8b 40 0c             	mov    0xc(%eax),%eax
+  8020d9:	a3 00 70 80 00       	mov    %eax,0x807000
+  return fsipc(FSREQ_FLUSH, NULL);
+  8020de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020e3:	b8 06 00 00 00       	mov    $0x6,%eax
+  8020e8:	e8 84 ff ff ff       	call   802071 <fsipc>
+}
+  8020ed:	c9                   	leave
+  8020ee:	c3                   	ret
+
+008020ef <devfile_stat>:
+{
+  8020ef:	55                   	push   %ebp
+  8020f0:	89 e5                	mov    %esp,%ebp
+  8020f2:	53                   	push   %ebx
+  8020f3:	83 ec 04             	sub    $0x4,%esp
+  8020f6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8020f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020fc:	8b 40 0c             	mov    0xc(%eax),%eax
+  8020ff:	a3 00 70 80 00       	mov    %eax,0x807000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  802104:	ba 00 00 00 00       	mov    $0x0,%edx
+  802109:	b8 05 00 00 00       	mov    $0x5,%eax
+  80210e:	e8 5e ff ff ff       	call   802071 <fsipc>
+  802113:	85 c0                	test   %eax,%eax
+  802115:	78 2c                	js     802143 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802117:	83 ec 08             	sub    $0x8,%esp
+  80211a:	68 00 70 80 00       	push   $0x807000
+  80211f:	53                   	push   %ebx
+  802120:	e8 7c eb ff ff       	call   800ca1 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  802125:	a1 80 70 80 00       	mov    0x807080,%eax
+  80212a:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802130:	a1 84 70 80 00       	mov    0x807084,%eax
+  802135:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  80213b:	83 c4 10             	add    $0x10,%esp
+  80213e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802143:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802146:	c9                   	leave
+  802147:	c3                   	ret
+
+00802148 <fsv_alloc>:
+{
+  802148:	55                   	push   %ebp
+  802149:	89 e5                	mov    %esp,%ebp
+  80214b:	56                   	push   %esi
+  80214c:	53                   	push   %ebx
+  80214d:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  80214f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802154:	eb 22                	jmp    802178 <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  802156:	83 ec 04             	sub    $0x4,%esp
+  802159:	6a 00                	push   $0x0
+  80215b:	6a 00                	push   $0x0
+  80215d:	6a 07                	push   $0x7
+  80215f:	50                   	push   %eax
+  802160:	6a 00                	push   $0x0
+  802162:	6a 04                	push   $0x4
+  802164:	68 40 60 80 00       	push   $0x806040
+  802169:	e8 b5 f3 ff ff       	call   801523 <sysbatch_add>
+  80216e:	83 c4 20             	add    $0x20,%esp
+  802171:	85 c0                	test   %eax,%eax
+  802173:	78 48                	js     8021bd <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  802175:	83 c3 01             	add    $0x1,%ebx
+  802178:	39 f3                	cmp    %esi,%ebx
+  80217a:	74 31                	je     8021ad <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  80217c:	89 d8                	mov    %ebx,%eax
+  80217e:	c1 e0 0c             	shl    $0xc,%eax
+  802181:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  802186:	89 c2                	mov    %eax,%edx
+  802188:	c1 ea 16             	shr    $0x16,%edx
+  80218b:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802192:	f6 c2 01             	test   $0x1,%dl
+  802195:	74 bf                	je     802156 <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  802197:	89 c2                	mov    %eax,%edx
+  802199:	c1 ea 0c             	shr    $0xc,%edx
+  80219c:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8021a3:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  8021a6:	83 fa 03             	cmp    $0x3,%edx
+  8021a9:	75 ab                	jne    802156 <fsv_alloc+0xe>
+  8021ab:	eb c8                	jmp    802175 <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  8021ad:	83 ec 0c             	sub    $0xc,%esp
+  8021b0:	68 40 60 80 00       	push   $0x806040
+  8021b5:	e8 19 f3 ff ff       	call   8014d3 <sysbatch_flush>
+  8021ba:	83 c4 10             	add    $0x10,%esp
+}
+  8021bd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021c0:	5b                   	pop    %ebx
+  8021c1:	5e                   	pop    %esi
+  8021c2:	5d                   	pop    %ebp
+  8021c3:	c3                   	ret
+
+008021c4 <devfile_read>:
+{
+  8021c4:	55                   	push   %ebp
+  8021c5:	89 e5                	mov    %esp,%ebp
+  8021c7:	57                   	push   %edi
+  8021c8:	56                   	push   %esi
+  8021c9:	53                   	push   %ebx
+  8021ca:	83 ec 3c             	sub    $0x3c,%esp
+  8021cd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  8021d0:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  8021d6:	77 57                	ja     80222f <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8021d8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021db:	8b 40 0c             	mov    0xc(%eax),%eax
+  8021de:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.read.req_n = n;
+  8021e3:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8021e9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021ee:	b8 03 00 00 00       	mov    $0x3,%eax
+  8021f3:	e8 79 fe ff ff       	call   802071 <fsipc>
+  8021f8:	89 c6                	mov    %eax,%esi
+  8021fa:	85 c0                	test   %eax,%eax
+  8021fc:	78 27                	js     802225 <devfile_read+0x61>
+  assert(r <= n);
+  8021fe:	39 c3                	cmp    %eax,%ebx
+  802200:	0f 82 0e 02 00 00    	jb     802414 <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  802206:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80220b:	0f 8f 1c 02 00 00    	jg     80242d <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  802211:	83 ec 04             	sub    $0x4,%esp
+  802214:	50                   	push   %eax
+  802215:	68 00 70 80 00       	push   $0x807000
+  80221a:	ff 75 0c             	push   0xc(%ebp)
+  80221d:	e8 05 ec ff ff       	call   800e27 <memmove>
+  return r;
+  802222:	83 c4 10             	add    $0x10,%esp
+}
+  802225:	89 f0                	mov    %esi,%eax
+  802227:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80222a:	5b                   	pop    %ebx
+  80222b:	5e                   	pop    %esi
+  80222c:	5f                   	pop    %edi
+  80222d:	5d                   	pop    %ebp
+  80222e:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  80222f:	b8 01 00 00 00       	mov    $0x1,%eax
+  802234:	e8 0f ff ff ff       	call   802148 <fsv_alloc>
+  802239:	89 c6                	mov    %eax,%esi
+  80223b:	85 c0                	test   %eax,%eax
+  80223d:	78 e6                	js     802225 <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  80223f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802242:	8b 40 0c             	mov    0xc(%eax),%eax
+  802245:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  80224a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80224d:	8b 40 04             	mov    0x4(%eax),%eax
+  802250:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  802255:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  80225b:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  802262:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802267:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  80226c:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802271:	e8 e2 fc ff ff       	call   801f58 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  802276:	6a 00                	push   $0x0
+  802278:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80227b:	50                   	push   %eax
+  80227c:	68 00 10 c0 9f       	push   $0x9fc01000
+  802281:	6a 00                	push   $0x0
+  802283:	e8 0e 18 00 00       	call   803a96 <ipc_recv_pages>
+  802288:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  80228a:	83 c4 10             	add    $0x10,%esp
+  80228d:	85 c0                	test   %eax,%eax
+  80228f:	7e 94                	jle    802225 <devfile_read+0x61>
+  assert(r <= n);
+  802291:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802294:	39 c3                	cmp    %eax,%ebx
+  802296:	72 2e                	jb     8022c6 <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  802298:	8b 45 08             	mov    0x8(%ebp),%eax
+  80229b:	8b 40 04             	mov    0x4(%eax),%eax
+  80229e:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8022a3:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  8022a6:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8022a9:	c1 e2 0c             	shl    $0xc,%edx
+  8022ac:	39 ca                	cmp    %ecx,%edx
+  8022ae:	72 2f                	jb     8022df <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  8022b0:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  8022b5:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  8022b8:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  8022bc:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  8022c1:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  8022c4:	eb 52                	jmp    802318 <devfile_read+0x154>
+  assert(r <= n);
+  8022c6:	68 71 44 80 00       	push   $0x804471
+  8022cb:	68 78 44 80 00       	push   $0x804478
+  8022d0:	68 49 01 00 00       	push   $0x149
+  8022d5:	68 66 44 80 00       	push   $0x804466
+  8022da:	e8 f9 e2 ff ff       	call   8005d8 <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  8022df:	68 9c 44 80 00       	push   $0x80449c
+  8022e4:	68 78 44 80 00       	push   $0x804478
+  8022e9:	68 4a 01 00 00       	push   $0x14a
+  8022ee:	68 66 44 80 00       	push   $0x804466
+  8022f3:	e8 e0 e2 ff ff       	call   8005d8 <_panic>
+      memmove(dst + done, src + done, m);
+  8022f8:	83 ec 04             	sub    $0x4,%esp
+  8022fb:	53                   	push   %ebx
+  8022fc:	56                   	push   %esi
+  8022fd:	89 f8                	mov    %edi,%eax
+  8022ff:	03 45 0c             	add    0xc(%ebp),%eax
+  802302:	50                   	push   %eax
+  802303:	e8 1f eb ff ff       	call   800e27 <memmove>
+  802308:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  80230b:	01 df                	add    %ebx,%edi
+  80230d:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802310:	39 c7                	cmp    %eax,%edi
+  802312:	0f 83 c0 00 00 00    	jae    8023d8 <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  802318:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80231b:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  80231e:	89 f0                	mov    %esi,%eax
+  802320:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802325:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  80232a:	29 c3                	sub    %eax,%ebx
+  80232c:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80232f:	29 f8                	sub    %edi,%eax
+  802331:	39 c3                	cmp    %eax,%ebx
+  802333:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  802336:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  80233c:	75 ba                	jne    8022f8 <devfile_read+0x134>
+  80233e:	89 f9                	mov    %edi,%ecx
+  802340:	03 4d 0c             	add    0xc(%ebp),%ecx
+  802343:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  802346:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  80234c:	75 aa                	jne    8022f8 <devfile_read+0x134>
+  80234e:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  802354:	77 a2                	ja     8022f8 <devfile_read+0x134>
+  802356:	89 c8                	mov    %ecx,%eax
+  802358:	c1 e8 16             	shr    $0x16,%eax
+  80235b:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802362:	a8 01                	test   $0x1,%al
+  802364:	74 92                	je     8022f8 <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  802366:	89 c8                	mov    %ecx,%eax
+  802368:	c1 e8 0c             	shr    $0xc,%eax
+  80236b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  802372:	a8 01                	test   $0x1,%al
+  802374:	74 82                	je     8022f8 <devfile_read+0x134>
+  802376:	a9 02 08 00 00       	test   $0x802,%eax
+  80237b:	0f 84 77 ff ff ff    	je     8022f8 <devfile_read+0x134>
+  802381:	f6 c4 04             	test   $0x4,%ah
+  802384:	0f 85 6e ff ff ff    	jne    8022f8 <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  80238a:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  80238f:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  802393:	84 c0                	test   %al,%al
+  802395:	75 17                	jne    8023ae <devfile_read+0x1ea>
+  802397:	83 ec 08             	sub    $0x8,%esp
+  80239a:	6a 01                	push   $0x1
+  80239c:	6a 00                	push   $0x0
+  80239e:	e8 ea ec ff ff       	call   80108d <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  8023a3:	83 c4 10             	add    $0x10,%esp
+  8023a6:	85 c0                	test   %eax,%eax
+  8023a8:	0f 85 4a ff ff ff    	jne    8022f8 <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  8023ae:	83 ec 04             	sub    $0x4,%esp
+  8023b1:	68 05 08 00 00       	push   $0x805
+  8023b6:	ff 75 cc             	push   -0x34(%ebp)
+  8023b9:	6a 00                	push   $0x0
+  8023bb:	56                   	push   %esi
+  8023bc:	6a 00                	push   $0x0
+  8023be:	6a 05                	push   $0x5
+  8023c0:	68 40 60 80 00       	push   $0x806040
+  8023c5:	e8 59 f1 ff ff       	call   801523 <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  8023ca:	c1 e8 1f             	shr    $0x1f,%eax
+  8023cd:	08 45 cb             	or     %al,-0x35(%ebp)
+  8023d0:	83 c4 20             	add    $0x20,%esp
+  8023d3:	e9 33 ff ff ff       	jmp    80230b <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  8023d8:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  8023db:	83 ec 0c             	sub    $0xc,%esp
+  8023de:	68 40 60 80 00       	push   $0x806040
+  8023e3:	e8 eb f0 ff ff       	call   8014d3 <sysbatch_flush>
+  8023e8:	83 c4 10             	add    $0x10,%esp
+  8023eb:	85 c0                	test   %eax,%eax
+  8023ed:	78 06                	js     8023f5 <devfile_read+0x231>
+  8023ef:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  8023f3:	74 14                	je     802409 <devfile_read+0x245>
+    memmove(dst, src, r);
+  8023f5:	83 ec 04             	sub    $0x4,%esp
+  8023f8:	ff 75 d4             	push   -0x2c(%ebp)
+  8023fb:	ff 75 d0             	push   -0x30(%ebp)
+  8023fe:	ff 75 0c             	push   0xc(%ebp)
+  802401:	e8 21 ea ff ff       	call   800e27 <memmove>
+  802406:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  802409:	8b 45 08             	mov    0x8(%ebp),%eax
+  80240c:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  80240f:	e9 11 fe ff ff       	jmp    802225 <devfile_read+0x61>
+  assert(r <= n);
+  802414:	68 71 44 80 00       	push   $0x804471
+  802419:	68 78 44 80 00       	push   $0x804478
+  80241e:	68 1c 01 00 00       	push   $0x11c
+  802423:	68 66 44 80 00       	push   $0x804466
+  802428:	e8 ab e1 ff ff       	call   8005d8 <_panic>
+  assert(r <= PGSIZE);
+  80242d:	68 8d 44 80 00       	push   $0x80448d
+  802432:	68 78 44 80 00       	push   $0x804478
+  802437:	68 1d 01 00 00       	push   $0x11d
+  80243c:	68 66 44 80 00       	push   $0x804466
+  802441:	e8 92 e1 ff ff       	call   8005d8 <_panic>
+
+00802446 <devfile_write>:
+{
+  802446:	55                   	push   %ebp
+  802447:	89 e5                	mov    %esp,%ebp
+  802449:	57                   	push   %edi
+  80244a:	56                   	push   %esi
+  80244b:	53                   	push   %ebx
+  80244c:	83 ec 1c             	sub    $0x1c,%esp
+  80244f:	8b 75 08             	mov    0x8(%ebp),%esi
+  802452:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  802455:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  80245a:	77 39                	ja     802495 <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80245c:	8b 56 0c             	mov    0xc(%esi),%edx
+  80245f:	89 15 00 70 80 00    	mov    %edx,0x807000
+  fsipcbuf.write.req_n = n;
+  802465:	a3 04 70 80 00       	mov    %eax,0x807004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  80246a:	83 ec 04             	sub    $0x4,%esp
+  80246d:	50                   	push   %eax
+  80246e:	ff 75 0c             	push   0xc(%ebp)
+  802471:	68 08 70 80 00       	push   $0x807008
+  802476:	e8 ac e9 ff ff       	call   800e27 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  80247b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802480:	b8 04 00 00 00       	mov    $0x4,%eax
+  802485:	e8 e7 fb ff ff       	call   802071 <fsipc>
+  80248a:	83 c4 10             	add    $0x10,%esp
+}
+  80248d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802490:	5b                   	pop    %ebx
+  802491:	5e                   	pop    %esi
+  802492:	5f                   	pop    %edi
+  802493:	5d                   	pop    %ebp
+  802494:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  802495:	ba 00 00 10 00       	mov    $0x100000,%edx
+  80249a:	39 d0                	cmp    %edx,%eax
+  80249c:	89 d3                	mov    %edx,%ebx
+  80249e:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  8024a1:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  8024a7:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  8024aa:	83 c7 01             	add    $0x1,%edi
+  8024ad:	89 f8                	mov    %edi,%eax
+  8024af:	e8 94 fc ff ff       	call   802148 <fsv_alloc>
+  8024b4:	85 c0                	test   %eax,%eax
+  8024b6:	78 d5                	js     80248d <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  8024b8:	83 ec 04             	sub    $0x4,%esp
+  8024bb:	53                   	push   %ebx
+  8024bc:	ff 75 0c             	push   0xc(%ebp)
+  8024bf:	68 00 10 c0 9f       	push   $0x9fc01000
+  8024c4:	e8 5e e9 ff ff       	call   800e27 <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  8024c9:	8b 46 0c             	mov    0xc(%esi),%eax
+  8024cc:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  8024d1:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  8024d7:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  8024de:	89 f9                	mov    %edi,%ecx
+  8024e0:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  8024e5:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8024ea:	e8 69 fa ff ff       	call   801f58 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  8024ef:	6a 00                	push   $0x0
+  8024f1:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8024f4:	50                   	push   %eax
+  8024f5:	6a 00                	push   $0x0
+  8024f7:	6a 00                	push   $0x0
+  8024f9:	e8 98 15 00 00       	call   803a96 <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  8024fe:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  802501:	eb 8a                	jmp    80248d <devfile_write+0x47>
+
+00802503 <open>:
+{
+  802503:	55                   	push   %ebp
+  802504:	89 e5                	mov    %esp,%ebp
+  802506:	56                   	push   %esi
+  802507:	53                   	push   %ebx
+  802508:	83 ec 1c             	sub    $0x1c,%esp
+  80250b:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  80250e:	56                   	push   %esi
+  80250f:	e8 52 e7 ff ff       	call   800c66 <strlen>
+  802514:	83 c4 10             	add    $0x10,%esp
+  802517:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80251c:	7f 6c                	jg     80258a <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  80251e:	83 ec 0c             	sub    $0xc,%esp
+  802521:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802524:	50                   	push   %eax
+  802525:	e8 ad f4 ff ff       	call   8019d7 <fd_alloc>
+  80252a:	89 c3                	mov    %eax,%ebx
+  80252c:	83 c4 10             	add    $0x10,%esp
+  80252f:	85 c0                	test   %eax,%eax
+  802531:	78 3c                	js     80256f <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  802533:	83 ec 08             	sub    $0x8,%esp
+  802536:	56                   	push   %esi
+  802537:	68 00 70 80 00       	push   $0x807000
+  80253c:	e8 60 e7 ff ff       	call   800ca1 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  802541:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802544:	a3 00 74 80 00       	mov    %eax,0x807400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802549:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80254c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802551:	e8 1b fb ff ff       	call   802071 <fsipc>
+  802556:	89 c3                	mov    %eax,%ebx
+  802558:	83 c4 10             	add    $0x10,%esp
+  80255b:	85 c0                	test   %eax,%eax
+  80255d:	78 19                	js     802578 <open+0x75>
+  return fd2num(fd);
+  80255f:	83 ec 0c             	sub    $0xc,%esp
+  802562:	ff 75 f4             	push   -0xc(%ebp)
+  802565:	e8 49 f4 ff ff       	call   8019b3 <fd2num>
+  80256a:	89 c3                	mov    %eax,%ebx
+  80256c:	83 c4 10             	add    $0x10,%esp
+}
+  80256f:	89 d8                	mov    %ebx,%eax
+  802571:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802574:	5b                   	pop    %ebx
+  802575:	5e                   	pop    %esi
+  802576:	5d                   	pop    %ebp
+  802577:	c3                   	ret
+    fd_close(fd, 0);
+  802578:	83 ec 08             	sub    $0x8,%esp
+  80257b:	6a 00                	push   $0x0
+  80257d:	ff 75 f4             	push   -0xc(%ebp)
+  802580:	e8 44 f5 ff ff       	call   801ac9 <fd_close>
+    return r;
+  802585:	83 c4 10             	add    $0x10,%esp
+  802588:	eb e5                	jmp    80256f <open+0x6c>
+    return -E_BAD_PATH;
+  80258a:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80258f:	eb de                	jmp    80256f <open+0x6c>
+
+00802591 <open_read>:
+{
+  802591:	55                   	push   %ebp
+  802592:	89 e5                	mov    %esp,%ebp
+  802594:	57                   	push   %edi
+  802595:	56                   	push   %esi
+  802596:	53                   	push   %ebx
+  802597:	83 ec 28             	sub    $0x28,%esp
+  80259a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  80259d:	57                   	push   %edi
+  80259e:	e8 c3 e6 ff ff       	call   800c66 <strlen>
+  8025a3:	83 c4 10             	add    $0x10,%esp
+  8025a6:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8025ab:	0f 87 f6 00 00 00    	ja     8026a7 <open_read+0x116>
+  8025b1:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  8025b3:	83 ec 0c             	sub    $0xc,%esp
+  8025b6:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8025b9:	50                   	push   %eax
+  8025ba:	e8 18 f4 ff ff       	call   8019d7 <fd_alloc>
+  8025bf:	89 c3                	mov    %eax,%ebx
+  8025c1:	83 c4 10             	add    $0x10,%esp
+  8025c4:	85 c0                	test   %eax,%eax
+  8025c6:	0f 88 b2 00 00 00    	js     80267e <open_read+0xed>
+  strcpy(req->req_buf, path);
+  8025cc:	83 ec 08             	sub    $0x8,%esp
+  8025cf:	57                   	push   %edi
+  8025d0:	68 e4 70 80 00       	push   $0x8070e4
+  8025d5:	e8 c7 e6 ff ff       	call   800ca1 <strcpy>
+  req->req_nops = 2;
+  8025da:	c7 05 00 70 80 00 02 	movl   $0x2,0x807000
+  8025e1:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  8025e4:	c7 05 04 70 80 00 01 	movl   $0x1,0x807004
+  8025eb:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  8025ee:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8025f1:	a3 10 70 80 00       	mov    %eax,0x807010
+  req->req_ops[0].op_buf = 0;
+  8025f6:	c7 05 18 70 80 00 00 	movl   $0x0,0x807018
+  8025fd:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  802600:	c7 05 20 70 80 00 04 	movl   $0x4,0x807020
+  802607:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  80260a:	c7 05 24 70 80 00 01 	movl   $0x1,0x807024
+  802611:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  802614:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  802619:	29 f0                	sub    %esi,%eax
+  80261b:	3b 45 14             	cmp    0x14(%ebp),%eax
+  80261e:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  802622:	a3 2c 70 80 00       	mov    %eax,0x80702c
+  req->req_ops[1].op_offset = 0;
+  802627:	c7 05 30 70 80 00 00 	movl   $0x0,0x807030
+  80262e:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  802631:	83 c6 01             	add    $0x1,%esi
+  802634:	89 35 34 70 80 00    	mov    %esi,0x807034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  80263a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80263d:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802642:	e8 2a fa ff ff       	call   802071 <fsipc>
+  802647:	89 c3                	mov    %eax,%ebx
+  802649:	83 c4 10             	add    $0x10,%esp
+  80264c:	83 f8 01             	cmp    $0x1,%eax
+  80264f:	7e 37                	jle    802688 <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  802651:	a1 38 70 80 00       	mov    0x807038,%eax
+  802656:	8b 55 18             	mov    0x18(%ebp),%edx
+  802659:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  80265b:	83 ec 04             	sub    $0x4,%esp
+  80265e:	50                   	push   %eax
+  80265f:	81 c6 e4 70 80 00    	add    $0x8070e4,%esi
+  802665:	56                   	push   %esi
+  802666:	ff 75 10             	push   0x10(%ebp)
+  802669:	e8 b9 e7 ff ff       	call   800e27 <memmove>
+  return fd2num(fd);
+  80266e:	83 c4 04             	add    $0x4,%esp
+  802671:	ff 75 e4             	push   -0x1c(%ebp)
+  802674:	e8 3a f3 ff ff       	call   8019b3 <fd2num>
+  802679:	89 c3                	mov    %eax,%ebx
+  80267b:	83 c4 10             	add    $0x10,%esp
+}
+  80267e:	89 d8                	mov    %ebx,%eax
+  802680:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802683:	5b                   	pop    %ebx
+  802684:	5e                   	pop    %esi
+  802685:	5f                   	pop    %edi
+  802686:	5d                   	pop    %ebp
+  802687:	c3                   	ret
+    fd_close(fd, 0);
+  802688:	83 ec 08             	sub    $0x8,%esp
+  80268b:	6a 00                	push   $0x0
+  80268d:	ff 75 e4             	push   -0x1c(%ebp)
+  802690:	e8 34 f4 ff ff       	call   801ac9 <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  802695:	83 c4 10             	add    $0x10,%esp
+  802698:	85 db                	test   %ebx,%ebx
+  80269a:	78 e2                	js     80267e <open_read+0xed>
+  80269c:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  80269f:	8b 9b 1c 70 80 00    	mov    0x80701c(%ebx),%ebx
+  8026a5:	eb d7                	jmp    80267e <open_read+0xed>
+    return -E_BAD_PATH;
+  8026a7:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8026ac:	eb d0                	jmp    80267e <open_read+0xed>
+
+008026ae <file_stat>:
+{
+  8026ae:	55                   	push   %ebp
+  8026af:	89 e5                	mov    %esp,%ebp
+  8026b1:	57                   	push   %edi
+  8026b2:	56                   	push   %esi
+  8026b3:	53                   	push   %ebx
+  8026b4:	83 ec 18             	sub    $0x18,%esp
+  8026b7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8026ba:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  8026bd:	57                   	push   %edi
+  8026be:	e8 a3 e5 ff ff       	call   800c66 <strlen>
+  8026c3:	83 c4 10             	add    $0x10,%esp
+  8026c6:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8026cb:	0f 8f c7 00 00 00    	jg     802798 <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  8026d1:	83 ec 0c             	sub    $0xc,%esp
+  8026d4:	57                   	push   %edi
+  8026d5:	e8 8c e5 ff ff       	call   800c66 <strlen>
+  8026da:	8d 58 04             	lea    0x4(%eax),%ebx
+  8026dd:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  8026e0:	83 c4 08             	add    $0x8,%esp
+  8026e3:	57                   	push   %edi
+  8026e4:	68 e4 70 80 00       	push   $0x8070e4
+  8026e9:	e8 b3 e5 ff ff       	call   800ca1 <strcpy>
+  req->req_nops = 2;
+  8026ee:	c7 05 00 70 80 00 02 	movl   $0x2,0x807000
+  8026f5:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  8026f8:	c7 05 04 70 80 00 02 	movl   $0x2,0x807004
+  8026ff:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  802702:	c7 05 10 70 80 00 00 	movl   $0x0,0x807010
+  802709:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  80270c:	c7 05 18 70 80 00 00 	movl   $0x0,0x807018
+  802713:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  802716:	c7 05 20 70 80 00 03 	movl   $0x3,0x807020
+  80271d:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  802720:	c7 05 24 70 80 00 01 	movl   $0x1,0x807024
+  802727:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  80272a:	89 1d 34 70 80 00    	mov    %ebx,0x807034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  802730:	ba 00 00 00 00       	mov    $0x0,%edx
+  802735:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80273a:	e8 32 f9 ff ff       	call   802071 <fsipc>
+  80273f:	83 c4 10             	add    $0x10,%esp
+  802742:	83 f8 01             	cmp    $0x1,%eax
+  802745:	7e 42                	jle    802789 <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  802747:	81 c3 e4 70 80 00    	add    $0x8070e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  80274d:	83 ec 08             	sub    $0x8,%esp
+  802750:	53                   	push   %ebx
+  802751:	56                   	push   %esi
+  802752:	e8 4a e5 ff ff       	call   800ca1 <strcpy>
+  st->st_size = ret->ret_size;
+  802757:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  80275d:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  802763:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  802769:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  80276f:	c7 86 88 00 00 00 04 	movl   $0x805004,0x88(%esi)
+  802776:	50 80 00 
+  return 0;
+  802779:	83 c4 10             	add    $0x10,%esp
+  80277c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802781:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802784:	5b                   	pop    %ebx
+  802785:	5e                   	pop    %esi
+  802786:	5f                   	pop    %edi
+  802787:	5d                   	pop    %ebp
+  802788:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  802789:	85 c0                	test   %eax,%eax
+  80278b:	78 f4                	js     802781 <file_stat+0xd3>
+  80278d:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802790:	8b 80 1c 70 80 00    	mov    0x80701c(%eax),%eax
+  802796:	eb e9                	jmp    802781 <file_stat+0xd3>
+    return -E_BAD_PATH;
+  802798:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  80279d:	eb e2                	jmp    802781 <file_stat+0xd3>
+
+0080279f <read_map>:
+{
+  80279f:	55                   	push   %ebp
+  8027a0:	89 e5                	mov    %esp,%ebp
+  8027a2:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8027a5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8027a8:	50                   	push   %eax
+  8027a9:	ff 75 08             	push   0x8(%ebp)
+  8027ac:	e8 7c f2 ff ff       	call   801a2d <fd_lookup>
+  8027b1:	83 c4 10             	add    $0x10,%esp
+  8027b4:	85 c0                	test   %eax,%eax
+  8027b6:	78 2a                	js     8027e2 <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  8027b8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027bb:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  8027c1:	39 08                	cmp    %ecx,(%eax)
+  8027c3:	75 1f                	jne    8027e4 <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  8027c5:	8b 40 0c             	mov    0xc(%eax),%eax
+  8027c8:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.read_map.req_offset = offset;
+  8027cd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8027d0:	a3 04 70 80 00       	mov    %eax,0x807004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  8027d5:	8b 55 10             	mov    0x10(%ebp),%edx
+  8027d8:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8027dd:	e8 8f f8 ff ff       	call   802071 <fsipc>
+}
+  8027e2:	c9                   	leave
+  8027e3:	c3                   	ret
+    return -E_INVAL;
+  8027e4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8027e9:	eb f7                	jmp    8027e2 <read_map+0x43>
+
+008027eb <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8027eb:	55                   	push   %ebp
+  8027ec:	89 e5                	mov    %esp,%ebp
+  8027ee:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  8027f1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027f6:	b8 08 00 00 00       	mov    $0x8,%eax
+  8027fb:	e8 71 f8 ff ff       	call   802071 <fsipc>
+}
+  802800:	c9                   	leave
+  802801:	c3                   	ret
+
+00802802 <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  802802:	55                   	push   %ebp
+  802803:	89 e5                	mov    %esp,%ebp
+  802805:	57                   	push   %edi
+  802806:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  802807:	8b 45 08             	mov    0x8(%ebp),%eax
+  80280a:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.stats.req_bio_sched = 0;
+  80280f:	c7 05 04 70 80 00 00 	movl   $0x0,0x807004
+  802816:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  802819:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  802820:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  802823:	ba 00 00 00 00       	mov    $0x0,%edx
+  802828:	b8 09 00 00 00       	mov    $0x9,%eax
+  80282d:	e8 3f f8 ff ff       	call   802071 <fsipc>
+  802832:	85 c0                	test   %eax,%eax
+  802834:	78 14                	js     80284a <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  802836:	be 00 70 80 00       	mov    $0x807000,%esi
+  80283b:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802840:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802843:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  802845:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80284a:	5e                   	pop    %esi
+  80284b:	5f                   	pop    %edi
+  80284c:	5d                   	pop    %ebp
+  80284d:	c3                   	ret
+
+0080284e <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  80284e:	55                   	push   %ebp
+  80284f:	89 e5                	mov    %esp,%ebp
+  802851:	53                   	push   %ebx
+  802852:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  802855:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802858:	50                   	push   %eax
+  802859:	6a 00                	push   $0x0
+  80285b:	e8 a2 ff ff ff       	call   802802 <fs_stats>
+  802860:	83 c4 10             	add    $0x10,%esp
+  802863:	85 c0                	test   %eax,%eax
+  802865:	78 28                	js     80288f <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  802867:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  80286a:	83 ec 08             	sub    $0x8,%esp
+  80286d:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802870:	50                   	push   %eax
+  802871:	6a 20                	push   $0x20
+  802873:	e8 8a ff ff ff       	call   802802 <fs_stats>
+  802878:	83 c4 10             	add    $0x10,%esp
+  80287b:	85 c0                	test   %eax,%eax
+  80287d:	78 10                	js     80288f <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  80287f:	83 ec 08             	sub    $0x8,%esp
+  802882:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802885:	50                   	push   %eax
+  802886:	53                   	push   %ebx
+  802887:	e8 76 ff ff ff       	call   802802 <fs_stats>
+  80288c:	83 c4 10             	add    $0x10,%esp
+}
+  80288f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802892:	c9                   	leave
+  802893:	c3                   	ret
+
+00802894 <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  802894:	55                   	push   %ebp
+  802895:	89 e5                	mov    %esp,%ebp
+  802897:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  80289a:	c7 05 00 70 80 00 00 	movl   $0x0,0x807000
+  8028a1:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  8028a4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028a7:	a3 04 70 80 00       	mov    %eax,0x807004
+  fsipcbuf.stats.req_dcache = 0;
+  8028ac:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  8028b3:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  8028b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028bb:	b8 09 00 00 00       	mov    $0x9,%eax
+  8028c0:	e8 ac f7 ff ff       	call   802071 <fsipc>
+}
+  8028c5:	c9                   	leave
+  8028c6:	c3                   	ret
+
+008028c7 <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  8028c7:	55                   	push   %ebp
+  8028c8:	89 e5                	mov    %esp,%ebp
+  8028ca:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  8028cd:	c7 05 00 70 80 00 00 	movl   $0x0,0x807000
+  8028d4:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  8028d7:	c7 05 04 70 80 00 00 	movl   $0x0,0x807004
+  8028de:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  8028e1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028e4:	a3 08 70 80 00       	mov    %eax,0x807008
+  return fsipc(FSREQ_STATS, NULL);
+  8028e9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028ee:	b8 09 00 00 00       	mov    $0x9,%eax
+  8028f3:	e8 79 f7 ff ff       	call   802071 <fsipc>
+}
+  8028f8:	c9                   	leave
+  8028f9:	c3                   	ret
+
+008028fa <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  8028fa:	55                   	push   %ebp
+  8028fb:	89 e5                	mov    %esp,%ebp
+  8028fd:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802900:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802903:	50                   	push   %eax
+  802904:	ff 75 08             	push   0x8(%ebp)
+  802907:	e8 21 f1 ff ff       	call   801a2d <fd_lookup>
+  80290c:	83 c4 10             	add    $0x10,%esp
+  80290f:	85 c0                	test   %eax,%eax
+  802911:	78 34                	js     802947 <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  802913:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802916:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  80291c:	39 08                	cmp    %ecx,(%eax)
+  80291e:	75 29                	jne    802949 <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  802920:	8b 40 0c             	mov    0xc(%eax),%eax
+  802923:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.fallocate.req_offset = offset;
+  802928:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80292b:	a3 04 70 80 00       	mov    %eax,0x807004
+  fsipcbuf.fallocate.req_len = len;
+  802930:	8b 45 10             	mov    0x10(%ebp),%eax
+  802933:	a3 08 70 80 00       	mov    %eax,0x807008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  802938:	ba 00 00 00 00       	mov    $0x0,%edx
+  80293d:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802942:	e8 2a f7 ff ff       	call   802071 <fsipc>
+}
+  802947:	c9                   	leave
+  802948:	c3                   	ret
+    return -E_INVAL;
+  802949:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80294e:	eb f7                	jmp    802947 <fallocate+0x4d>
+
+00802950 <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  802950:	55                   	push   %ebp
+  802951:	89 e5                	mov    %esp,%ebp
+  802953:	57                   	push   %edi
+  802954:	56                   	push   %esi
+  802955:	53                   	push   %ebx
+  802956:	83 ec 24             	sub    $0x24,%esp
+  802959:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80295c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80295f:	50                   	push   %eax
+  802960:	ff 75 08             	push   0x8(%ebp)
+  802963:	e8 c5 f0 ff ff       	call   801a2d <fd_lookup>
+  802968:	83 c4 10             	add    $0x10,%esp
+  80296b:	85 c0                	test   %eax,%eax
+  80296d:	78 66                	js     8029d5 <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  80296f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802972:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  802978:	39 08                	cmp    %ecx,(%eax)
+  80297a:	75 61                	jne    8029dd <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  80297c:	85 f6                	test   %esi,%esi
+  80297e:	7e 50                	jle    8029d0 <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  802980:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  802985:	39 de                	cmp    %ebx,%esi
+  802987:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  80298a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80298d:	8b 40 0c             	mov    0xc(%eax),%eax
+  802990:	a3 00 70 80 00       	mov    %eax,0x807000
+    fsipcbuf.prefetch.req_n = m;
+  802995:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  80299b:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  8029a2:	83 ec 04             	sub    $0x4,%esp
+  8029a5:	57                   	push   %edi
+  8029a6:	ff 75 0c             	push   0xc(%ebp)
+  8029a9:	68 08 70 80 00       	push   $0x807008
+  8029ae:	e8 74 e4 ff ff       	call   800e27 <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  8029b3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029b8:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8029bd:	e8 af f6 ff ff       	call   802071 <fsipc>
+  8029c2:	83 c4 10             	add    $0x10,%esp
+  8029c5:	85 c0                	test   %eax,%eax
+  8029c7:	78 0c                	js     8029d5 <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  8029c9:	01 7d 0c             	add    %edi,0xc(%ebp)
+  8029cc:	29 de                	sub    %ebx,%esi
+  8029ce:	eb ac                	jmp    80297c <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  8029d0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8029d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029d8:	5b                   	pop    %ebx
+  8029d9:	5e                   	pop    %esi
+  8029da:	5f                   	pop    %edi
+  8029db:	5d                   	pop    %ebp
+  8029dc:	c3                   	ret
+    return -E_INVAL;
+  8029dd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8029e2:	eb f1                	jmp    8029d5 <prefetch+0x85>
+
+008029e4 <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  8029e4:	55                   	push   %ebp
+  8029e5:	89 e5                	mov    %esp,%ebp
+  8029e7:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  8029ea:	50                   	push   %eax
+  8029eb:	e8 d3 ef ff ff       	call   8019c3 <fd2data>
+  8029f0:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  8029f5:	c9                   	leave
+  8029f6:	c3                   	ret
+
+008029f7 <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8029f7:	55                   	push   %ebp
+  8029f8:	89 e5                	mov    %esp,%ebp
+  8029fa:	56                   	push   %esi
+  8029fb:	53                   	push   %ebx
+  8029fc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  8029ff:	83 ec 0c             	sub    $0xc,%esp
+  802a02:	ff 75 08             	push   0x8(%ebp)
+  802a05:	e8 b9 ef ff ff       	call   8019c3 <fd2data>
+  802a0a:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  802a0c:	83 c4 08             	add    $0x8,%esp
+  802a0f:	68 c8 44 80 00       	push   $0x8044c8
+  802a14:	53                   	push   %ebx
+  802a15:	e8 87 e2 ff ff       	call   800ca1 <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  802a1a:	8b 46 04             	mov    0x4(%esi),%eax
+  802a1d:	2b 06                	sub    (%esi),%eax
+  802a1f:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  802a25:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802a2c:	00 00 00 
+  stat->st_dev = &devpipe;
+  802a2f:	c7 83 88 00 00 00 20 	movl   $0x805020,0x88(%ebx)
+  802a36:	50 80 00 
+  return 0;
+}
+  802a39:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a3e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802a41:	5b                   	pop    %ebx
+  802a42:	5e                   	pop    %esi
+  802a43:	5d                   	pop    %ebp
+  802a44:	c3                   	ret
+
+00802a45 <pipe_wakeup>:
+{
+  802a45:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  802a47:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a4c:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  802a4f:	85 c0                	test   %eax,%eax
+  802a51:	75 01                	jne    802a54 <pipe_wakeup+0xf>
+  802a53:	c3                   	ret
+{
+  802a54:	55                   	push   %ebp
+  802a55:	89 e5                	mov    %esp,%ebp
+  802a57:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  802a5a:	6a 00                	push   $0x0
+  802a5c:	68 00 00 c0 ee       	push   $0xeec00000
+  802a61:	52                   	push   %edx
+  802a62:	e8 c5 e9 ff ff       	call   80142c <sys_chan_wakeup>
+  802a67:	83 c4 10             	add    $0x10,%esp
+}
+  802a6a:	c9                   	leave
+  802a6b:	c3                   	ret
+
+00802a6c <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802a6c:	55                   	push   %ebp
+  802a6d:	89 e5                	mov    %esp,%ebp
+  802a6f:	57                   	push   %edi
+  802a70:	56                   	push   %esi
+  802a71:	53                   	push   %ebx
+  802a72:	83 ec 18             	sub    $0x18,%esp
+  802a75:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  802a78:	57                   	push   %edi
+  802a79:	e8 45 ef ff ff       	call   8019c3 <fd2data>
+  802a7e:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  802a80:	83 c4 10             	add    $0x10,%esp
+  802a83:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  802a87:	74 2a                	je     802ab3 <devpipe_close+0x47>
+  802a89:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  802a8e:	89 f8                	mov    %edi,%eax
+  802a90:	e8 4f ff ff ff       	call   8029e4 <pipe_ring>
+  802a95:	83 ec 08             	sub    $0x8,%esp
+  802a98:	01 d8                	add    %ebx,%eax
+  802a9a:	50                   	push   %eax
+  802a9b:	6a 00                	push   $0x0
+  802a9d:	e8 b3 e6 ff ff       	call   801155 <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  802aa2:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802aa8:	83 c4 10             	add    $0x10,%esp
+  802aab:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  802ab1:	75 db                	jne    802a8e <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  802ab3:	83 ec 08             	sub    $0x8,%esp
+  802ab6:	57                   	push   %edi
+  802ab7:	6a 00                	push   $0x0
+  802ab9:	e8 97 e6 ff ff       	call   801155 <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  802abe:	83 c4 10             	add    $0x10,%esp
+  802ac1:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  802ac5:	75 13                	jne    802ada <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  802ac7:	83 ec 08             	sub    $0x8,%esp
+  802aca:	56                   	push   %esi
+  802acb:	6a 00                	push   $0x0
+  802acd:	e8 83 e6 ff ff       	call   801155 <sys_page_unmap>
+}
+  802ad2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ad5:	5b                   	pop    %ebx
+  802ad6:	5e                   	pop    %esi
+  802ad7:	5f                   	pop    %edi
+  802ad8:	5d                   	pop    %ebp
+  802ad9:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802ada:	8d 56 04             	lea    0x4(%esi),%edx
+  802add:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802ae0:	e8 60 ff ff ff       	call   802a45 <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802ae5:	8d 46 30             	lea    0x30(%esi),%eax
+  802ae8:	89 f2                	mov    %esi,%edx
+  802aea:	e8 56 ff ff ff       	call   802a45 <pipe_wakeup>
+  802aef:	eb d6                	jmp    802ac7 <devpipe_close+0x5b>
+
+00802af1 <_pipeisclosed>:
+{
+  802af1:	55                   	push   %ebp
+  802af2:	89 e5                	mov    %esp,%ebp
+  802af4:	57                   	push   %edi
+  802af5:	56                   	push   %esi
+  802af6:	53                   	push   %ebx
+  802af7:	83 ec 1c             	sub    $0x1c,%esp
+  802afa:	89 c7                	mov    %eax,%edi
+  802afc:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  802afe:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  802b03:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  802b06:	83 ec 0c             	sub    $0xc,%esp
+  802b09:	57                   	push   %edi
+  802b0a:	e8 ea 10 00 00       	call   803bf9 <pageref>
+  802b0f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802b12:	89 34 24             	mov    %esi,(%esp)
+  802b15:	e8 df 10 00 00       	call   803bf9 <pageref>
+    nn = thisenv->env_runs;
+  802b1a:	8b 15 a0 68 80 00    	mov    0x8068a0,%edx
+  802b20:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  802b23:	83 c4 10             	add    $0x10,%esp
+  802b26:	39 cb                	cmp    %ecx,%ebx
+  802b28:	74 1b                	je     802b45 <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  802b2a:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802b2d:	75 cf                	jne    802afe <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802b2f:	8b 42 58             	mov    0x58(%edx),%eax
+  802b32:	6a 01                	push   $0x1
+  802b34:	50                   	push   %eax
+  802b35:	53                   	push   %ebx
+  802b36:	68 cf 44 80 00       	push   $0x8044cf
+  802b3b:	e8 73 db ff ff       	call   8006b3 <cprintf>
+  802b40:	83 c4 10             	add    $0x10,%esp
+  802b43:	eb b9                	jmp    802afe <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  802b45:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802b48:	0f 94 c0             	sete   %al
+  802b4b:	0f b6 c0             	movzbl %al,%eax
+}
+  802b4e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b51:	5b                   	pop    %ebx
+  802b52:	5e                   	pop    %esi
+  802b53:	5f                   	pop    %edi
+  802b54:	5d                   	pop    %ebp
+  802b55:	c3                   	ret
+
+00802b56 <devpipe_write_bulk>:
+{
+  802b56:	55                   	push   %ebp
+  802b57:	89 e5                	mov    %esp,%ebp
+  802b59:	57                   	push   %edi
+  802b5a:	56                   	push   %esi
+  802b5b:	53                   	push   %ebx
+  802b5c:	83 ec 1c             	sub    $0x1c,%esp
+  802b5f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802b62:	89 d6                	mov    %edx,%esi
+  802b64:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  802b67:	e8 78 fe ff ff       	call   8029e4 <pipe_ring>
+  802b6c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  802b6f:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802b74:	8d 46 04             	lea    0x4(%esi),%eax
+  802b77:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  802b7a:	eb 75                	jmp    802bf1 <devpipe_write_bulk+0x9b>
+  802b7c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802b81:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802b85:	6a 64                	push   $0x64
+  802b87:	68 00 00 c0 ee       	push   $0xeec00000
+  802b8c:	53                   	push   %ebx
+  802b8d:	56                   	push   %esi
+  802b8e:	e8 76 e8 ff ff       	call   801409 <sys_chan_sleep>
+      continue;
+  802b93:	83 c4 10             	add    $0x10,%esp
+  802b96:	eb 59                	jmp    802bf1 <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  802b98:	89 d1                	mov    %edx,%ecx
+  802b9a:	c1 f9 1f             	sar    $0x1f,%ecx
+  802b9d:	c1 e9 11             	shr    $0x11,%ecx
+  802ba0:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802ba3:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802ba8:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  802baa:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  802bb0:	29 d3                	sub    %edx,%ebx
+  802bb2:	ba 00 80 00 00       	mov    $0x8000,%edx
+  802bb7:	29 c2                	sub    %eax,%edx
+  802bb9:	39 d3                	cmp    %edx,%ebx
+  802bbb:	0f 47 da             	cmova  %edx,%ebx
+  802bbe:	8b 55 08             	mov    0x8(%ebp),%edx
+  802bc1:	29 fa                	sub    %edi,%edx
+  802bc3:	39 d3                	cmp    %edx,%ebx
+  802bc5:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  802bc8:	83 ec 04             	sub    $0x4,%esp
+  802bcb:	53                   	push   %ebx
+  802bcc:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802bcf:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  802bd2:	52                   	push   %edx
+  802bd3:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802bd6:	01 c8                	add    %ecx,%eax
+  802bd8:	50                   	push   %eax
+  802bd9:	e8 ab e2 ff ff       	call   800e89 <memcpy>
+    i += m;
+  802bde:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  802be0:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802be3:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802be6:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802be9:	e8 57 fe ff ff       	call   802a45 <pipe_wakeup>
+  802bee:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802bf1:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802bf4:	73 2b                	jae    802c21 <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  802bf6:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  802bf8:	8b 56 04             	mov    0x4(%esi),%edx
+  802bfb:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  802c01:	39 d0                	cmp    %edx,%eax
+  802c03:	7d 93                	jge    802b98 <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  802c05:	89 f2                	mov    %esi,%edx
+  802c07:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802c0a:	e8 e2 fe ff ff       	call   802af1 <_pipeisclosed>
+  802c0f:	85 c0                	test   %eax,%eax
+  802c11:	0f 84 65 ff ff ff    	je     802b7c <devpipe_write_bulk+0x26>
+        return i;
+  802c17:	89 f8                	mov    %edi,%eax
+}
+  802c19:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c1c:	5b                   	pop    %ebx
+  802c1d:	5e                   	pop    %esi
+  802c1e:	5f                   	pop    %edi
+  802c1f:	5d                   	pop    %ebp
+  802c20:	c3                   	ret
+  return i;
+  802c21:	89 f8                	mov    %edi,%eax
+  802c23:	eb f4                	jmp    802c19 <devpipe_write_bulk+0xc3>
+
+00802c25 <devpipe_write>:
+{
+  802c25:	55                   	push   %ebp
+  802c26:	89 e5                	mov    %esp,%ebp
+  802c28:	57                   	push   %edi
+  802c29:	56                   	push   %esi
+  802c2a:	53                   	push   %ebx
+  802c2b:	83 ec 28             	sub    $0x28,%esp
+  802c2e:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  802c31:	56                   	push   %esi
+  802c32:	e8 8c ed ff ff       	call   8019c3 <fd2data>
+  802c37:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  802c39:	8b 78 28             	mov    0x28(%eax),%edi
+  802c3c:	83 c4 10             	add    $0x10,%esp
+  802c3f:	85 ff                	test   %edi,%edi
+  802c41:	75 25                	jne    802c68 <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  802c43:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802c46:	74 66                	je     802cae <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802c48:	8b 43 04             	mov    0x4(%ebx),%eax
+  802c4b:	8b 0b                	mov    (%ebx),%ecx
+  802c4d:	8d 51 20             	lea    0x20(%ecx),%edx
+  802c50:	39 d0                	cmp    %edx,%eax
+  802c52:	72 2b                	jb     802c7f <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  802c54:	89 da                	mov    %ebx,%edx
+  802c56:	89 f0                	mov    %esi,%eax
+  802c58:	e8 94 fe ff ff       	call   802af1 <_pipeisclosed>
+  802c5d:	85 c0                	test   %eax,%eax
+  802c5f:	75 51                	jne    802cb2 <devpipe_write+0x8d>
+      sys_yield();
+  802c61:	e8 08 e4 ff ff       	call   80106e <sys_yield>
+  802c66:	eb e0                	jmp    802c48 <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  802c68:	83 ec 0c             	sub    $0xc,%esp
+  802c6b:	ff 75 10             	push   0x10(%ebp)
+  802c6e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802c71:	89 c2                	mov    %eax,%edx
+  802c73:	89 f0                	mov    %esi,%eax
+  802c75:	e8 dc fe ff ff       	call   802b56 <devpipe_write_bulk>
+  802c7a:	83 c4 10             	add    $0x10,%esp
+  802c7d:	eb 38                	jmp    802cb7 <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802c7f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802c82:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802c86:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802c89:	89 c2                	mov    %eax,%edx
+  802c8b:	c1 fa 1f             	sar    $0x1f,%edx
+  802c8e:	89 d1                	mov    %edx,%ecx
+  802c90:	c1 e9 1b             	shr    $0x1b,%ecx
+  802c93:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802c96:	83 e2 1f             	and    $0x1f,%edx
+  802c99:	29 ca                	sub    %ecx,%edx
+  802c9b:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802c9f:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  802ca3:	83 c0 01             	add    $0x1,%eax
+  802ca6:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  802ca9:	83 c7 01             	add    $0x1,%edi
+  802cac:	eb 95                	jmp    802c43 <devpipe_write+0x1e>
+  return i;
+  802cae:	89 f8                	mov    %edi,%eax
+  802cb0:	eb 05                	jmp    802cb7 <devpipe_write+0x92>
+        return 0;
+  802cb2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802cb7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802cba:	5b                   	pop    %ebx
+  802cbb:	5e                   	pop    %esi
+  802cbc:	5f                   	pop    %edi
+  802cbd:	5d                   	pop    %ebp
+  802cbe:	c3                   	ret
+
+00802cbf <devpipe_read_bulk>:
+{
+  802cbf:	55                   	push   %ebp
+  802cc0:	89 e5                	mov    %esp,%ebp
+  802cc2:	57                   	push   %edi
+  802cc3:	56                   	push   %esi
+  802cc4:	53                   	push   %ebx
+  802cc5:	83 ec 2c             	sub    $0x2c,%esp
+  802cc8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802ccb:	89 d6                	mov    %edx,%esi
+  802ccd:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802cd0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  802cd3:	e8 0c fd ff ff       	call   8029e4 <pipe_ring>
+  802cd8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  802cdb:	85 db                	test   %ebx,%ebx
+  802cdd:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802ce2:	0f 45 c3             	cmovne %ebx,%eax
+  802ce5:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802ce8:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802ced:	8d 46 30             	lea    0x30(%esi),%eax
+  802cf0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  802cf3:	eb 50                	jmp    802d45 <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  802cf5:	89 d1                	mov    %edx,%ecx
+  802cf7:	c1 f9 1f             	sar    $0x1f,%ecx
+  802cfa:	c1 e9 11             	shr    $0x11,%ecx
+  802cfd:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802d00:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802d05:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  802d07:	29 d3                	sub    %edx,%ebx
+  802d09:	ba 00 80 00 00       	mov    $0x8000,%edx
+  802d0e:	29 c2                	sub    %eax,%edx
+  802d10:	39 d3                	cmp    %edx,%ebx
+  802d12:	0f 47 da             	cmova  %edx,%ebx
+  802d15:	8b 55 08             	mov    0x8(%ebp),%edx
+  802d18:	29 fa                	sub    %edi,%edx
+  802d1a:	39 d3                	cmp    %edx,%ebx
+  802d1c:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  802d1f:	83 ec 04             	sub    $0x4,%esp
+  802d22:	53                   	push   %ebx
+  802d23:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802d26:	01 c8                	add    %ecx,%eax
+  802d28:	50                   	push   %eax
+  802d29:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802d2c:	01 f8                	add    %edi,%eax
+  802d2e:	50                   	push   %eax
+  802d2f:	e8 55 e1 ff ff       	call   800e89 <memcpy>
+    i += m;
+  802d34:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  802d36:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802d38:	89 f2                	mov    %esi,%edx
+  802d3a:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802d3d:	e8 03 fd ff ff       	call   802a45 <pipe_wakeup>
+  802d42:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802d45:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802d48:	73 51                	jae    802d9b <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  802d4a:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  802d4d:	8b 16                	mov    (%esi),%edx
+  802d4f:	39 da                	cmp    %ebx,%edx
+  802d51:	75 a2                	jne    802cf5 <devpipe_read_bulk+0x36>
+      if (i > 0)
+  802d53:	85 ff                	test   %edi,%edi
+  802d55:	75 44                	jne    802d9b <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  802d57:	89 f2                	mov    %esi,%edx
+  802d59:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802d5c:	e8 90 fd ff ff       	call   802af1 <_pipeisclosed>
+  802d61:	85 c0                	test   %eax,%eax
+  802d63:	75 3a                	jne    802d9f <devpipe_read_bulk+0xe0>
+  802d65:	b8 01 00 00 00       	mov    $0x1,%eax
+  802d6a:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802d6e:	6a 64                	push   $0x64
+  802d70:	ff 75 d4             	push   -0x2c(%ebp)
+  802d73:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  802d74:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802d77:	50                   	push   %eax
+  802d78:	e8 8c e6 ff ff       	call   801409 <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  802d7d:	85 c0                	test   %eax,%eax
+  802d7f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d84:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  802d87:	83 c4 10             	add    $0x10,%esp
+  802d8a:	a8 01                	test   $0x1,%al
+  802d8c:	74 b7                	je     802d45 <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  802d8e:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  802d93:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d96:	5b                   	pop    %ebx
+  802d97:	5e                   	pop    %esi
+  802d98:	5f                   	pop    %edi
+  802d99:	5d                   	pop    %ebp
+  802d9a:	c3                   	ret
+  return i;
+  802d9b:	89 f8                	mov    %edi,%eax
+  802d9d:	eb f4                	jmp    802d93 <devpipe_read_bulk+0xd4>
+        return 0;
+  802d9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802da4:	eb ed                	jmp    802d93 <devpipe_read_bulk+0xd4>
+
+00802da6 <devpipe_read>:
+{
+  802da6:	55                   	push   %ebp
+  802da7:	89 e5                	mov    %esp,%ebp
+  802da9:	57                   	push   %edi
+  802daa:	56                   	push   %esi
+  802dab:	53                   	push   %ebx
+  802dac:	83 ec 18             	sub    $0x18,%esp
+  802daf:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  802db2:	57                   	push   %edi
+  802db3:	e8 0b ec ff ff       	call   8019c3 <fd2data>
+  802db8:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  802dba:	8b 70 28             	mov    0x28(%eax),%esi
+  802dbd:	83 c4 10             	add    $0x10,%esp
+  802dc0:	85 f6                	test   %esi,%esi
+  802dc2:	75 24                	jne    802de8 <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  802dc4:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802dc7:	74 60                	je     802e29 <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  802dc9:	8b 03                	mov    (%ebx),%eax
+  802dcb:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802dce:	75 3b                	jne    802e0b <devpipe_read+0x65>
+      if (i > 0)
+  802dd0:	85 f6                	test   %esi,%esi
+  802dd2:	75 2d                	jne    802e01 <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  802dd4:	89 da                	mov    %ebx,%edx
+  802dd6:	89 f8                	mov    %edi,%eax
+  802dd8:	e8 14 fd ff ff       	call   802af1 <_pipeisclosed>
+  802ddd:	85 c0                	test   %eax,%eax
+  802ddf:	75 4c                	jne    802e2d <devpipe_read+0x87>
+      sys_yield();
+  802de1:	e8 88 e2 ff ff       	call   80106e <sys_yield>
+  802de6:	eb e1                	jmp    802dc9 <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  802de8:	83 ec 08             	sub    $0x8,%esp
+  802deb:	6a 00                	push   $0x0
+  802ded:	ff 75 10             	push   0x10(%ebp)
+  802df0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802df3:	89 c2                	mov    %eax,%edx
+  802df5:	89 f8                	mov    %edi,%eax
+  802df7:	e8 c3 fe ff ff       	call   802cbf <devpipe_read_bulk>
+  802dfc:	83 c4 10             	add    $0x10,%esp
+  802dff:	eb 02                	jmp    802e03 <devpipe_read+0x5d>
+        return i;
+  802e01:	89 f0                	mov    %esi,%eax
+}
+  802e03:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e06:	5b                   	pop    %ebx
+  802e07:	5e                   	pop    %esi
+  802e08:	5f                   	pop    %edi
+  802e09:	5d                   	pop    %ebp
+  802e0a:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802e0b:	99                   	cltd
+  802e0c:	c1 ea 1b             	shr    $0x1b,%edx
+  802e0f:	01 d0                	add    %edx,%eax
+  802e11:	83 e0 1f             	and    $0x1f,%eax
+  802e14:	29 d0                	sub    %edx,%eax
+  802e16:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802e1b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802e1e:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  802e21:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  802e24:	83 c6 01             	add    $0x1,%esi
+  802e27:	eb 9b                	jmp    802dc4 <devpipe_read+0x1e>
+  return i;
+  802e29:	89 f0                	mov    %esi,%eax
+  802e2b:	eb d6                	jmp    802e03 <devpipe_read+0x5d>
+        return 0;
+  802e2d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e32:	eb cf                	jmp    802e03 <devpipe_read+0x5d>
+
+00802e34 <pipe2>:
+{
+  802e34:	55                   	push   %ebp
+  802e35:	89 e5                	mov    %esp,%ebp
+  802e37:	57                   	push   %edi
+  802e38:	56                   	push   %esi
+  802e39:	53                   	push   %ebx
+  802e3a:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  802e3d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802e40:	50                   	push   %eax
+  802e41:	e8 91 eb ff ff       	call   8019d7 <fd_alloc>
+  802e46:	89 c3                	mov    %eax,%ebx
+  802e48:	83 c4 10             	add    $0x10,%esp
+  802e4b:	85 c0                	test   %eax,%eax
+  802e4d:	0f 88 fb 01 00 00    	js     80304e <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802e53:	83 ec 04             	sub    $0x4,%esp
+  802e56:	68 07 04 00 00       	push   $0x407
+  802e5b:	ff 75 e4             	push   -0x1c(%ebp)
+  802e5e:	6a 00                	push   $0x0
+  802e60:	e8 6b e2 ff ff       	call   8010d0 <sys_page_alloc>
+  802e65:	89 c3                	mov    %eax,%ebx
+  802e67:	83 c4 10             	add    $0x10,%esp
+  802e6a:	85 c0                	test   %eax,%eax
+  802e6c:	0f 88 dc 01 00 00    	js     80304e <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  802e72:	83 ec 0c             	sub    $0xc,%esp
+  802e75:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  802e78:	50                   	push   %eax
+  802e79:	e8 59 eb ff ff       	call   8019d7 <fd_alloc>
+  802e7e:	89 c3                	mov    %eax,%ebx
+  802e80:	83 c4 10             	add    $0x10,%esp
+  802e83:	85 c0                	test   %eax,%eax
+  802e85:	0f 88 b3 01 00 00    	js     80303e <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802e8b:	83 ec 04             	sub    $0x4,%esp
+  802e8e:	68 07 04 00 00       	push   $0x407
+  802e93:	ff 75 e0             	push   -0x20(%ebp)
+  802e96:	6a 00                	push   $0x0
+  802e98:	e8 33 e2 ff ff       	call   8010d0 <sys_page_alloc>
+  802e9d:	89 c3                	mov    %eax,%ebx
+  802e9f:	83 c4 10             	add    $0x10,%esp
+  802ea2:	85 c0                	test   %eax,%eax
+  802ea4:	0f 88 94 01 00 00    	js     80303e <pipe2+0x20a>
+  va = fd2data(fd0);
+  802eaa:	83 ec 0c             	sub    $0xc,%esp
+  802ead:	ff 75 e4             	push   -0x1c(%ebp)
+  802eb0:	e8 0e eb ff ff       	call   8019c3 <fd2data>
+  802eb5:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802eb7:	83 c4 0c             	add    $0xc,%esp
+  802eba:	68 07 04 00 00       	push   $0x407
+  802ebf:	50                   	push   %eax
+  802ec0:	6a 00                	push   $0x0
+  802ec2:	e8 09 e2 ff ff       	call   8010d0 <sys_page_alloc>
+  802ec7:	89 c3                	mov    %eax,%ebx
+  802ec9:	83 c4 10             	add    $0x10,%esp
+  802ecc:	85 c0                	test   %eax,%eax
+  802ece:	0f 88 5a 01 00 00    	js     80302e <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802ed4:	83 ec 0c             	sub    $0xc,%esp
+  802ed7:	ff 75 e0             	push   -0x20(%ebp)
+  802eda:	e8 e4 ea ff ff       	call   8019c3 <fd2data>
+  802edf:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802ee6:	50                   	push   %eax
+  802ee7:	6a 00                	push   $0x0
+  802ee9:	57                   	push   %edi
+  802eea:	6a 00                	push   $0x0
+  802eec:	e8 22 e2 ff ff       	call   801113 <sys_page_map>
+  802ef1:	89 c3                	mov    %eax,%ebx
+  802ef3:	83 c4 20             	add    $0x20,%esp
+  802ef6:	85 c0                	test   %eax,%eax
+  802ef8:	0f 88 22 01 00 00    	js     803020 <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  802efe:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  802f02:	74 72                	je     802f76 <pipe2+0x142>
+  802f04:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  802f09:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802f0c:	e8 d3 fa ff ff       	call   8029e4 <pipe_ring>
+  802f11:	83 ec 04             	sub    $0x4,%esp
+  802f14:	68 07 04 00 00       	push   $0x407
+  802f19:	01 f0                	add    %esi,%eax
+  802f1b:	50                   	push   %eax
+  802f1c:	6a 00                	push   $0x0
+  802f1e:	e8 ad e1 ff ff       	call   8010d0 <sys_page_alloc>
+  802f23:	89 c3                	mov    %eax,%ebx
+  802f25:	83 c4 10             	add    $0x10,%esp
+  802f28:	85 c0                	test   %eax,%eax
+  802f2a:	0f 88 97 00 00 00    	js     802fc7 <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  802f30:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802f33:	e8 ac fa ff ff       	call   8029e4 <pipe_ring>
+  802f38:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  802f3b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802f3e:	e8 a1 fa ff ff       	call   8029e4 <pipe_ring>
+  802f43:	83 ec 0c             	sub    $0xc,%esp
+  802f46:	68 07 04 00 00       	push   $0x407
+  802f4b:	53                   	push   %ebx
+  802f4c:	6a 00                	push   $0x0
+  802f4e:	01 f0                	add    %esi,%eax
+  802f50:	50                   	push   %eax
+  802f51:	6a 00                	push   $0x0
+  802f53:	e8 bb e1 ff ff       	call   801113 <sys_page_map>
+  802f58:	89 c3                	mov    %eax,%ebx
+  802f5a:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802f60:	83 c4 20             	add    $0x20,%esp
+  802f63:	85 c0                	test   %eax,%eax
+  802f65:	78 60                	js     802fc7 <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  802f67:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802f6d:	75 9a                	jne    802f09 <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  802f6f:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  802f76:	a1 20 50 80 00       	mov    0x805020,%eax
+  802f7b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802f7e:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  802f80:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802f83:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  802f8a:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802f8d:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  802f8f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802f92:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  802f99:	83 ec 0c             	sub    $0xc,%esp
+  802f9c:	ff 75 e4             	push   -0x1c(%ebp)
+  802f9f:	e8 0f ea ff ff       	call   8019b3 <fd2num>
+  802fa4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802fa7:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  802fa9:	83 c4 04             	add    $0x4,%esp
+  802fac:	ff 75 e0             	push   -0x20(%ebp)
+  802faf:	e8 ff e9 ff ff       	call   8019b3 <fd2num>
+  802fb4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802fb7:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  802fba:	83 c4 10             	add    $0x10,%esp
+  802fbd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802fc2:	e9 87 00 00 00       	jmp    80304e <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802fc7:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  802fcc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802fcf:	e8 10 fa ff ff       	call   8029e4 <pipe_ring>
+  802fd4:	83 ec 08             	sub    $0x8,%esp
+  802fd7:	01 f0                	add    %esi,%eax
+  802fd9:	50                   	push   %eax
+  802fda:	6a 00                	push   $0x0
+  802fdc:	e8 74 e1 ff ff       	call   801155 <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  802fe1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802fe4:	e8 fb f9 ff ff       	call   8029e4 <pipe_ring>
+  802fe9:	83 c4 08             	add    $0x8,%esp
+  802fec:	01 f0                	add    %esi,%eax
+  802fee:	50                   	push   %eax
+  802fef:	6a 00                	push   $0x0
+  802ff1:	e8 5f e1 ff ff       	call   801155 <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802ff6:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802ffc:	83 c4 10             	add    $0x10,%esp
+  802fff:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  803005:	75 c5                	jne    802fcc <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  803007:	83 ec 0c             	sub    $0xc,%esp
+  80300a:	ff 75 e0             	push   -0x20(%ebp)
+  80300d:	e8 b1 e9 ff ff       	call   8019c3 <fd2data>
+  803012:	83 c4 08             	add    $0x8,%esp
+  803015:	50                   	push   %eax
+  803016:	6a 00                	push   $0x0
+  803018:	e8 38 e1 ff ff       	call   801155 <sys_page_unmap>
+  80301d:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  803020:	83 ec 08             	sub    $0x8,%esp
+  803023:	57                   	push   %edi
+  803024:	6a 00                	push   $0x0
+  803026:	e8 2a e1 ff ff       	call   801155 <sys_page_unmap>
+  80302b:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  80302e:	83 ec 08             	sub    $0x8,%esp
+  803031:	ff 75 e0             	push   -0x20(%ebp)
+  803034:	6a 00                	push   $0x0
+  803036:	e8 1a e1 ff ff       	call   801155 <sys_page_unmap>
+  80303b:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  80303e:	83 ec 08             	sub    $0x8,%esp
+  803041:	ff 75 e4             	push   -0x1c(%ebp)
+  803044:	6a 00                	push   $0x0
+  803046:	e8 0a e1 ff ff       	call   801155 <sys_page_unmap>
+  80304b:	83 c4 10             	add    $0x10,%esp
+}
+  80304e:	89 d8                	mov    %ebx,%eax
+  803050:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803053:	5b                   	pop    %ebx
+  803054:	5e                   	pop    %esi
+  803055:	5f                   	pop    %edi
+  803056:	5d                   	pop    %ebp
+  803057:	c3                   	ret
+
+00803058 <pipe>:
+{
+  803058:	55                   	push   %ebp
+  803059:	89 e5                	mov    %esp,%ebp
+  80305b:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  80305e:	6a 00                	push   $0x0
+  803060:	ff 75 08             	push   0x8(%ebp)
+  803063:	e8 cc fd ff ff       	call   802e34 <pipe2>
+}
+  803068:	c9                   	leave
+  803069:	c3                   	ret
+
+0080306a <pipeisclosed>:
+{
+  80306a:	55                   	push   %ebp
+  80306b:	89 e5                	mov    %esp,%ebp
+  80306d:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803070:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803073:	50                   	push   %eax
+  803074:	ff 75 08             	push   0x8(%ebp)
+  803077:	e8 b1 e9 ff ff       	call   801a2d <fd_lookup>
+  80307c:	83 c4 10             	add    $0x10,%esp
+  80307f:	85 c0                	test   %eax,%eax
+  803081:	78 18                	js     80309b <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  803083:	83 ec 0c             	sub    $0xc,%esp
+  803086:	ff 75 f4             	push   -0xc(%ebp)
+  803089:	e8 35 e9 ff ff       	call   8019c3 <fd2data>
+  80308e:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  803090:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803093:	e8 59 fa ff ff       	call   802af1 <_pipeisclosed>
+  803098:	83 c4 10             	add    $0x10,%esp
+}
+  80309b:	c9                   	leave
+  80309c:	c3                   	ret
+
+0080309d <pipe_splice>:
+{
+  80309d:	55                   	push   %ebp
+  80309e:	89 e5                	mov    %esp,%ebp
+  8030a0:	57                   	push   %edi
+  8030a1:	56                   	push   %esi
+  8030a2:	53                   	push   %ebx
+  8030a3:	83 ec 34             	sub    $0x34,%esp
+  8030a6:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8030a9:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8030ac:	50                   	push   %eax
+  8030ad:	ff 75 08             	push   0x8(%ebp)
+  8030b0:	e8 78 e9 ff ff       	call   801a2d <fd_lookup>
+  8030b5:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8030b8:	83 c4 10             	add    $0x10,%esp
+  8030bb:	85 c0                	test   %eax,%eax
+  8030bd:	0f 88 d7 00 00 00    	js     80319a <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  8030c3:	83 ec 0c             	sub    $0xc,%esp
+  8030c6:	ff 75 e4             	push   -0x1c(%ebp)
+  8030c9:	e8 f5 e8 ff ff       	call   8019c3 <fd2data>
+  8030ce:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  8030d0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8030d3:	83 c4 10             	add    $0x10,%esp
+  8030d6:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  8030dc:	39 10                	cmp    %edx,(%eax)
+  8030de:	0f 85 c1 00 00 00    	jne    8031a5 <pipe_splice+0x108>
+  8030e4:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  8030e8:	0f 84 c0 00 00 00    	je     8031ae <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  8030ee:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  8030f2:	0f 84 bf 00 00 00    	je     8031b7 <pipe_splice+0x11a>
+  8030f8:	89 f7                	mov    %esi,%edi
+  8030fa:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  803100:	0f 85 ba 00 00 00    	jne    8031c0 <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  803106:	8d 43 04             	lea    0x4(%ebx),%eax
+  803109:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80310c:	eb 38                	jmp    803146 <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  80310e:	83 ec 0c             	sub    $0xc,%esp
+  803111:	68 00 10 00 00       	push   $0x1000
+  803116:	89 f1                	mov    %esi,%ecx
+  803118:	89 da                	mov    %ebx,%edx
+  80311a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80311d:	e8 34 fa ff ff       	call   802b56 <devpipe_write_bulk>
+  803122:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  803125:	83 c4 10             	add    $0x10,%esp
+  803128:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80312d:	75 53                	jne    803182 <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  80312f:	83 ec 08             	sub    $0x8,%esp
+  803132:	56                   	push   %esi
+  803133:	6a 00                	push   $0x0
+  803135:	e8 1b e0 ff ff       	call   801155 <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  80313a:	83 c7 01             	add    $0x1,%edi
+  80313d:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803143:	83 c4 10             	add    $0x10,%esp
+  803146:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  803149:	74 3a                	je     803185 <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  80314b:	8b 03                	mov    (%ebx),%eax
+  80314d:	39 43 04             	cmp    %eax,0x4(%ebx)
+  803150:	75 bc                	jne    80310e <pipe_splice+0x71>
+  803152:	b8 00 00 00 00       	mov    $0x0,%eax
+  803157:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  80315b:	85 c0                	test   %eax,%eax
+  80315d:	74 af                	je     80310e <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  80315f:	83 ec 04             	sub    $0x4,%esp
+  803162:	6a 07                	push   $0x7
+  803164:	56                   	push   %esi
+  803165:	ff 75 d0             	push   -0x30(%ebp)
+  803168:	e8 bf e2 ff ff       	call   80142c <sys_chan_wakeup>
+  80316d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  803170:	83 c4 10             	add    $0x10,%esp
+  803173:	85 c0                	test   %eax,%eax
+  803175:	79 b8                	jns    80312f <pipe_splice+0x92>
+  803177:	b8 01 00 00 00       	mov    $0x1,%eax
+  80317c:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  803180:	eb 8c                	jmp    80310e <pipe_splice+0x71>
+  803182:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  803185:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803189:	75 06                	jne    803191 <pipe_splice+0xf4>
+  80318b:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  80318f:	78 09                	js     80319a <pipe_splice+0xfd>
+  return i * PGSIZE;
+  803191:	8b 45 10             	mov    0x10(%ebp),%eax
+  803194:	c1 e0 0c             	shl    $0xc,%eax
+  803197:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  80319a:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80319d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8031a0:	5b                   	pop    %ebx
+  8031a1:	5e                   	pop    %esi
+  8031a2:	5f                   	pop    %edi
+  8031a3:	5d                   	pop    %ebp
+  8031a4:	c3                   	ret
+    return -E_INVAL;
+  8031a5:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  8031ac:	eb ec                	jmp    80319a <pipe_splice+0xfd>
+  8031ae:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  8031b5:	eb e3                	jmp    80319a <pipe_splice+0xfd>
+  8031b7:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  8031be:	eb da                	jmp    80319a <pipe_splice+0xfd>
+  8031c0:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  8031c7:	eb d1                	jmp    80319a <pipe_splice+0xfd>
+
+008031c9 <pipe_splice_read>:
+{
+  8031c9:	55                   	push   %ebp
+  8031ca:	89 e5                	mov    %esp,%ebp
+  8031cc:	53                   	push   %ebx
+  8031cd:	83 ec 1c             	sub    $0x1c,%esp
+  8031d0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8031d3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8031d6:	50                   	push   %eax
+  8031d7:	ff 75 08             	push   0x8(%ebp)
+  8031da:	e8 4e e8 ff ff       	call   801a2d <fd_lookup>
+  8031df:	83 c4 10             	add    $0x10,%esp
+  8031e2:	85 c0                	test   %eax,%eax
+  8031e4:	78 49                	js     80322f <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  8031e6:	83 ec 0c             	sub    $0xc,%esp
+  8031e9:	ff 75 f4             	push   -0xc(%ebp)
+  8031ec:	e8 d2 e7 ff ff       	call   8019c3 <fd2data>
+  8031f1:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  8031f3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8031f6:	83 c4 10             	add    $0x10,%esp
+  8031f9:	8b 0d 20 50 80 00    	mov    0x805020,%ecx
+  8031ff:	39 08                	cmp    %ecx,(%eax)
+  803201:	75 31                	jne    803234 <pipe_splice_read+0x6b>
+  803203:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  803207:	74 32                	je     80323b <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  803209:	8b 48 08             	mov    0x8(%eax),%ecx
+  80320c:	83 e1 03             	and    $0x3,%ecx
+  80320f:	83 f9 01             	cmp    $0x1,%ecx
+  803212:	74 2e                	je     803242 <pipe_splice_read+0x79>
+  803214:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  80321a:	75 2d                	jne    803249 <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  80321c:	83 ec 08             	sub    $0x8,%esp
+  80321f:	53                   	push   %ebx
+  803220:	68 00 10 00 00       	push   $0x1000
+  803225:	89 d9                	mov    %ebx,%ecx
+  803227:	e8 93 fa ff ff       	call   802cbf <devpipe_read_bulk>
+  80322c:	83 c4 10             	add    $0x10,%esp
+}
+  80322f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803232:	c9                   	leave
+  803233:	c3                   	ret
+    return -E_INVAL;
+  803234:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803239:	eb f4                	jmp    80322f <pipe_splice_read+0x66>
+  80323b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803240:	eb ed                	jmp    80322f <pipe_splice_read+0x66>
+  803242:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803247:	eb e6                	jmp    80322f <pipe_splice_read+0x66>
+  803249:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80324e:	eb df                	jmp    80322f <pipe_splice_read+0x66>
+
+00803250 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  803250:	55                   	push   %ebp
+  803251:	89 e5                	mov    %esp,%ebp
+  803253:	56                   	push   %esi
+  803254:	53                   	push   %ebx
+  803255:	8b 75 08             	mov    0x8(%ebp),%esi
+  const volatile struct Env *e;
+
+  assert(envid != 0);
+  803258:	85 f6                	test   %esi,%esi
+  80325a:	74 15                	je     803271 <wait+0x21>
+  e = &envs[ENVX(envid)];
+  80325c:	89 f0                	mov    %esi,%eax
+  80325e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  while (e->env_id == envid && e->env_status != ENV_FREE)
+  803263:	8d 1c c0             	lea    (%eax,%eax,8),%ebx
+  803266:	c1 e3 04             	shl    $0x4,%ebx
+  803269:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  80326f:	eb 1b                	jmp    80328c <wait+0x3c>
+  assert(envid != 0);
+  803271:	68 e7 44 80 00       	push   $0x8044e7
+  803276:	68 78 44 80 00       	push   $0x804478
+  80327b:	6a 09                	push   $0x9
+  80327d:	68 f2 44 80 00       	push   $0x8044f2
+  803282:	e8 51 d3 ff ff       	call   8005d8 <_panic>
+    sys_yield();
+  803287:	e8 e2 dd ff ff       	call   80106e <sys_yield>
+  while (e->env_id == envid && e->env_status != ENV_FREE)
+  80328c:	8b 43 48             	mov    0x48(%ebx),%eax
+  80328f:	39 f0                	cmp    %esi,%eax
+  803291:	75 07                	jne    80329a <wait+0x4a>
+  803293:	8b 43 54             	mov    0x54(%ebx),%eax
+  803296:	85 c0                	test   %eax,%eax
+  803298:	75 ed                	jne    803287 <wait+0x37>
+}
+  80329a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80329d:	5b                   	pop    %ebx
+  80329e:	5e                   	pop    %esi
+  80329f:	5d                   	pop    %ebp
+  8032a0:	c3                   	ret
+
+008032a1 <mmap_find>:
+          utf->utf_eip, utf->utf_err);
+}
+
+static struct Mmap *
+mmap_find(uintptr_t va)
+{
+  8032a1:	55                   	push   %ebp
+  8032a2:	89 e5                	mov    %esp,%ebp
+  8032a4:	56                   	push   %esi
+  8032a5:	53                   	push   %ebx
+  int i;
+
+  for (i = 0; i < NMMAP; i++)
+  8032a6:	ba 60 67 80 00       	mov    $0x806760,%edx
+  8032ab:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8032b0:	eb 0b                	jmp    8032bd <mmap_find+0x1c>
+  8032b2:	83 c3 01             	add    $0x1,%ebx
+  8032b5:	83 c2 14             	add    $0x14,%edx
+  8032b8:	83 fb 10             	cmp    $0x10,%ebx
+  8032bb:	74 1d                	je     8032da <mmap_find+0x39>
+    if (mmaps[i].mm_va && va >= mmaps[i].mm_va &&
+  8032bd:	8b 0a                	mov    (%edx),%ecx
+  8032bf:	39 c8                	cmp    %ecx,%eax
+  8032c1:	72 ef                	jb     8032b2 <mmap_find+0x11>
+  8032c3:	85 c9                	test   %ecx,%ecx
+  8032c5:	74 eb                	je     8032b2 <mmap_find+0x11>
+        va < mmaps[i].mm_va + mmaps[i].mm_len)
+  8032c7:	03 4a 04             	add    0x4(%edx),%ecx
+    if (mmaps[i].mm_va && va >= mmaps[i].mm_va &&
+  8032ca:	39 c8                	cmp    %ecx,%eax
+  8032cc:	73 e4                	jae    8032b2 <mmap_find+0x11>
+      return &mmaps[i];
+  8032ce:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  8032d1:	8d 04 85 60 67 80 00 	lea    0x806760(,%eax,4),%eax
+  8032d8:	eb 05                	jmp    8032df <mmap_find+0x3e>
+  return NULL;
+  8032da:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032df:	5b                   	pop    %ebx
+  8032e0:	5e                   	pop    %esi
+  8032e1:	5d                   	pop    %ebp
+  8032e2:	c3                   	ret
+
+008032e3 <va_mapped>:
+
+static bool
+va_mapped(uintptr_t va)
+{
+  return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+  8032e3:	89 c2                	mov    %eax,%edx
+  8032e5:	c1 ea 16             	shr    $0x16,%edx
+  8032e8:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8032ef:	f6 c2 01             	test   $0x1,%dl
+  8032f2:	74 11                	je     803305 <va_mapped+0x22>
+  8032f4:	c1 e8 0c             	shr    $0xc,%eax
+  8032f7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8032fe:	83 e0 01             	and    $0x1,%eax
+  803301:	83 e0 01             	and    $0x1,%eax
+}
+  803304:	c3                   	ret
+  return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+  803305:	b8 00 00 00 00       	mov    $0x0,%eax
+  80330a:	eb f5                	jmp    803301 <va_mapped+0x1e>
+
+0080330c <mmap_copy>:
+
+// Replace the page at 'va' with a copy of its first 'n' bytes, the rest
+// zeroed, mapped with 'perm'.
+static void
+mmap_copy(uintptr_t va, size_t n, int perm)
+{
+  80330c:	55                   	push   %ebp
+  80330d:	89 e5                	mov    %esp,%ebp
+  80330f:	57                   	push   %edi
+  803310:	56                   	push   %esi
+  803311:	53                   	push   %ebx
+  803312:	83 ec 10             	sub    $0x10,%esp
+  803315:	89 c3                	mov    %eax,%ebx
+  803317:	89 d7                	mov    %edx,%edi
+  803319:	89 ce                	mov    %ecx,%esi
+  int r;
+
+  if ((r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  80331b:	6a 07                	push   $0x7
+  80331d:	68 00 f0 7f 00       	push   $0x7ff000
+  803322:	6a 00                	push   $0x0
+  803324:	e8 a7 dd ff ff       	call   8010d0 <sys_page_alloc>
+  803329:	83 c4 10             	add    $0x10,%esp
+  80332c:	85 c0                	test   %eax,%eax
+  80332e:	78 46                	js     803376 <mmap_copy+0x6a>
+    panic("mmap: %e", r);
+  memmove(PFTEMP, (void *) va, n);
+  803330:	83 ec 04             	sub    $0x4,%esp
+  803333:	57                   	push   %edi
+  803334:	53                   	push   %ebx
+  803335:	68 00 f0 7f 00       	push   $0x7ff000
+  80333a:	e8 e8 da ff ff       	call   800e27 <memmove>
+  if ((r = sys_page_map(0, PFTEMP, 0, (void *) va, perm)) < 0 ||
+  80333f:	89 34 24             	mov    %esi,(%esp)
+  803342:	53                   	push   %ebx
+  803343:	6a 00                	push   $0x0
+  803345:	68 00 f0 7f 00       	push   $0x7ff000
+  80334a:	6a 00                	push   $0x0
+  80334c:	e8 c2 dd ff ff       	call   801113 <sys_page_map>
+  803351:	83 c4 20             	add    $0x20,%esp
+  803354:	85 c0                	test   %eax,%eax
+  803356:	78 30                	js     803388 <mmap_copy+0x7c>
+      (r = sys_page_unmap(0, PFTEMP)) < 0)
+  803358:	83 ec 08             	sub    $0x8,%esp
+  80335b:	68 00 f0 7f 00       	push   $0x7ff000
+  803360:	6a 00                	push   $0x0
+  803362:	e8 ee dd ff ff       	call   801155 <sys_page_unmap>
+  if ((r = sys_page_map(0, PFTEMP, 0, (void *) va, perm)) < 0 ||
+  803367:	83 c4 10             	add    $0x10,%esp
+  80336a:	85 c0                	test   %eax,%eax
+  80336c:	78 1a                	js     803388 <mmap_copy+0x7c>
+    panic("mmap: %e", r);
+}
+  80336e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803371:	5b                   	pop    %ebx
+  803372:	5e                   	pop    %esi
+  803373:	5f                   	pop    %edi
+  803374:	5d                   	pop    %ebp
+  803375:	c3                   	ret
+    panic("mmap: %e", r);
+  803376:	50                   	push   %eax
+  803377:	68 fd 44 80 00       	push   $0x8044fd
+  80337c:	6a 3e                	push   $0x3e
+  80337e:	68 06 45 80 00       	push   $0x804506
+  803383:	e8 50 d2 ff ff       	call   8005d8 <_panic>
+    panic("mmap: %e", r);
+  803388:	50                   	push   %eax
+  803389:	68 fd 44 80 00       	push   $0x8044fd
+  80338e:	6a 42                	push   $0x42
+  803390:	68 06 45 80 00       	push   $0x804506
+  803395:	e8 3e d2 ff ff       	call   8005d8 <_panic>
+
+0080339a <mmap_fault>:
+// Handle a page fault in a mapping, if it is one.  Returns 1 if it was.
+// The fork page fault handlers call this first, so that mappings keep
+// working after a fork.
+bool
+mmap_fault(struct UTrapframe *utf)
+{
+  80339a:	55                   	push   %ebp
+  80339b:	89 e5                	mov    %esp,%ebp
+  80339d:	57                   	push   %edi
+  80339e:	56                   	push   %esi
+  80339f:	53                   	push   %ebx
+  8033a0:	83 ec 1c             	sub    $0x1c,%esp
+  8033a3:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Fsreq_read_map saved;
+  struct Mmap *m;
+  uintptr_t va;
+  int perm, r;
+
+  va = ROUNDDOWN(utf->utf_fault_va, PGSIZE);
+  8033a6:	8b 1f                	mov    (%edi),%ebx
+  8033a8:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if (va < MMAPBASE || va >= MMAPTOP || (m = mmap_find(va)) == NULL)
+  8033ae:	8d 83 00 00 00 60    	lea    0x60000000(%ebx),%eax
+  8033b4:	3d ff ff ff 2f       	cmp    $0x2fffffff,%eax
+  8033b9:	0f 87 24 01 00 00    	ja     8034e3 <mmap_fault+0x149>
+  8033bf:	89 d8                	mov    %ebx,%eax
+  8033c1:	e8 db fe ff ff       	call   8032a1 <mmap_find>
+  8033c6:	89 c6                	mov    %eax,%esi
+  8033c8:	85 c0                	test   %eax,%eax
+  8033ca:	0f 84 20 01 00 00    	je     8034f0 <mmap_fault+0x156>
+    return 0;
+  if ((utf->utf_err & FEC_WR) && m->mm_perm == MAP_RDONLY)
+  8033d0:	f6 47 04 02          	testb  $0x2,0x4(%edi)
+  8033d4:	74 13                	je     8033e9 <mmap_fault+0x4f>
+  8033d6:	83 78 10 00          	cmpl   $0x0,0x10(%eax)
+  8033da:	0f 84 17 01 00 00    	je     8034f7 <mmap_fault+0x15d>
+    return 0;
+  perm = PTE_P | PTE_U | (m->mm_perm == MAP_RDONLY ? 0 : PTE_W);
+  8033e0:	c7 45 e4 07 00 00 00 	movl   $0x7,-0x1c(%ebp)
+  8033e7:	eb 0f                	jmp    8033f8 <mmap_fault+0x5e>
+  8033e9:	83 78 10 01          	cmpl   $0x1,0x10(%eax)
+  8033ed:	19 c0                	sbb    %eax,%eax
+  8033ef:	83 e0 fe             	and    $0xfffffffe,%eax
+  8033f2:	83 c0 07             	add    $0x7,%eax
+  8033f5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+
+  if (!va_mapped(va)) {
+  8033f8:	89 d8                	mov    %ebx,%eax
+  8033fa:	e8 e4 fe ff ff       	call   8032e3 <va_mapped>
+  8033ff:	84 c0                	test   %al,%al
+  803401:	74 42                	je     803445 <mmap_fault+0xab>
+    }
+  }
+
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+    mmap_copy(va, PGSIZE, perm);
+  return 1;
+  803403:	b8 01 00 00 00       	mov    $0x1,%eax
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+  803408:	f6 47 04 02          	testb  $0x2,0x4(%edi)
+  80340c:	0f 84 d6 00 00 00    	je     8034e8 <mmap_fault+0x14e>
+  803412:	89 d8                	mov    %ebx,%eax
+  803414:	c1 e8 0c             	shr    $0xc,%eax
+  803417:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  return 1;
+  80341e:	b8 01 00 00 00       	mov    $0x1,%eax
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+  803423:	f6 c2 02             	test   $0x2,%dl
+  803426:	0f 85 bc 00 00 00    	jne    8034e8 <mmap_fault+0x14e>
+    mmap_copy(va, PGSIZE, perm);
+  80342c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80342f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803434:	89 d8                	mov    %ebx,%eax
+  803436:	e8 d1 fe ff ff       	call   80330c <mmap_copy>
+  return 1;
+  80343b:	b8 01 00 00 00       	mov    $0x1,%eax
+  803440:	e9 a3 00 00 00       	jmp    8034e8 <mmap_fault+0x14e>
+    saved = fsipcbuf.read_map;
+  803445:	a1 00 70 80 00       	mov    0x807000,%eax
+  80344a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80344d:	8b 15 04 70 80 00    	mov    0x807004,%edx
+  803453:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    r = read_map(m->mm_fd, m->mm_offset + (va - m->mm_va), (void *) va);
+  803456:	83 ec 04             	sub    $0x4,%esp
+  803459:	53                   	push   %ebx
+  80345a:	89 d8                	mov    %ebx,%eax
+  80345c:	03 46 0c             	add    0xc(%esi),%eax
+  80345f:	2b 06                	sub    (%esi),%eax
+  803461:	50                   	push   %eax
+  803462:	ff 76 08             	push   0x8(%esi)
+  803465:	e8 35 f3 ff ff       	call   80279f <read_map>
+    fsipcbuf.read_map = saved;
+  80346a:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80346d:	89 0d 00 70 80 00    	mov    %ecx,0x807000
+  803473:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  803476:	89 15 04 70 80 00    	mov    %edx,0x807004
+    if (r < 0)
+  80347c:	83 c4 10             	add    $0x10,%esp
+  80347f:	85 c0                	test   %eax,%eax
+  803481:	78 20                	js     8034a3 <mmap_fault+0x109>
+    if (r == 0) {
+  803483:	74 30                	je     8034b5 <mmap_fault+0x11b>
+    if (r < PGSIZE) {
+  803485:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  80348a:	0f 8f 73 ff ff ff    	jg     803403 <mmap_fault+0x69>
+      mmap_copy(va, r, perm);
+  803490:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803493:	89 c2                	mov    %eax,%edx
+  803495:	89 d8                	mov    %ebx,%eax
+  803497:	e8 70 fe ff ff       	call   80330c <mmap_copy>
+      return 1;
+  80349c:	b8 01 00 00 00       	mov    $0x1,%eax
+  8034a1:	eb 45                	jmp    8034e8 <mmap_fault+0x14e>
+      panic("mmap: read_map: %e", r);
+  8034a3:	50                   	push   %eax
+  8034a4:	68 11 45 80 00       	push   $0x804511
+  8034a9:	6a 5f                	push   $0x5f
+  8034ab:	68 06 45 80 00       	push   $0x804506
+  8034b0:	e8 23 d1 ff ff       	call   8005d8 <_panic>
+      if ((r = sys_page_alloc(0, (void *) va, perm)) < 0)
+  8034b5:	83 ec 04             	sub    $0x4,%esp
+  8034b8:	ff 75 e4             	push   -0x1c(%ebp)
+  8034bb:	53                   	push   %ebx
+  8034bc:	6a 00                	push   $0x0
+  8034be:	e8 0d dc ff ff       	call   8010d0 <sys_page_alloc>
+  8034c3:	83 c4 10             	add    $0x10,%esp
+  8034c6:	85 c0                	test   %eax,%eax
+  8034c8:	78 07                	js     8034d1 <mmap_fault+0x137>
+      return 1;
+  8034ca:	b8 01 00 00 00       	mov    $0x1,%eax
+  8034cf:	eb 17                	jmp    8034e8 <mmap_fault+0x14e>
+        panic("mmap: %e", r);
+  8034d1:	50                   	push   %eax
+  8034d2:	68 fd 44 80 00       	push   $0x8044fd
+  8034d7:	6a 64                	push   $0x64
+  8034d9:	68 06 45 80 00       	push   $0x804506
+  8034de:	e8 f5 d0 ff ff       	call   8005d8 <_panic>
+    return 0;
+  8034e3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8034e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8034eb:	5b                   	pop    %ebx
+  8034ec:	5e                   	pop    %esi
+  8034ed:	5f                   	pop    %edi
+  8034ee:	5d                   	pop    %ebp
+  8034ef:	c3                   	ret
+    return 0;
+  8034f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034f5:	eb f1                	jmp    8034e8 <mmap_fault+0x14e>
+    return 0;
+  8034f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034fc:	eb ea                	jmp    8034e8 <mmap_fault+0x14e>
+
+008034fe <mmap_pgfault>:
+{
+  8034fe:	55                   	push   %ebp
+  8034ff:	89 e5                	mov    %esp,%ebp
+  803501:	53                   	push   %ebx
+  803502:	83 ec 10             	sub    $0x10,%esp
+  803505:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (!mmap_fault(utf))
+  803508:	53                   	push   %ebx
+  803509:	e8 8c fe ff ff       	call   80339a <mmap_fault>
+  80350e:	83 c4 10             	add    $0x10,%esp
+  803511:	84 c0                	test   %al,%al
+  803513:	74 05                	je     80351a <mmap_pgfault+0x1c>
+}
+  803515:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803518:	c9                   	leave
+  803519:	c3                   	ret
+    panic("page fault at %08x, eip %08x, err %04x", utf->utf_fault_va,
+  80351a:	83 ec 08             	sub    $0x8,%esp
+  80351d:	ff 73 04             	push   0x4(%ebx)
+  803520:	ff 73 28             	push   0x28(%ebx)
+  803523:	ff 33                	push   (%ebx)
+  803525:	68 24 45 80 00       	push   $0x804524
+  80352a:	6a 20                	push   $0x20
+  80352c:	68 06 45 80 00       	push   $0x804506
+  803531:	e8 a2 d0 ff ff       	call   8005d8 <_panic>
+
+00803536 <mmap>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_INVAL if offset isn't aligned, len is 0, or perm is unknown
+//	-E_NO_MEM if there's no free slot or address space for it
+int
+mmap(int fdnum, off_t offset, size_t len, int perm, void **addr)
+{
+  803536:	55                   	push   %ebp
+  803537:	89 e5                	mov    %esp,%ebp
+  803539:	57                   	push   %edi
+  80353a:	56                   	push   %esi
+  80353b:	53                   	push   %ebx
+  80353c:	83 ec 44             	sub    $0x44,%esp
+  80353f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  struct Fd *fd;
+  uintptr_t va;
+  int i, j, r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803542:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  803545:	50                   	push   %eax
+  803546:	ff 75 08             	push   0x8(%ebp)
+  803549:	e8 df e4 ff ff       	call   801a2d <fd_lookup>
+  80354e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  803551:	83 c4 10             	add    $0x10,%esp
+  803554:	85 c0                	test   %eax,%eax
+  803556:	0f 88 3e 01 00 00    	js     80369a <mmap+0x164>
+    return r;
+  if (offset < 0 || PGOFF(offset) || len == 0 ||
+  80355c:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803560:	0f 88 d1 00 00 00    	js     803637 <mmap+0x101>
+  803566:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803569:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80356e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  803571:	0f 85 c9 00 00 00    	jne    803640 <mmap+0x10a>
+  803577:	85 db                	test   %ebx,%ebx
+  803579:	0f 84 ca 00 00 00    	je     803649 <mmap+0x113>
+  80357f:	83 7d 14 02          	cmpl   $0x2,0x14(%ebp)
+  803583:	0f 87 c0 00 00 00    	ja     803649 <mmap+0x113>
+      (perm != MAP_RDONLY && perm != MAP_PRIVATE && perm != MAP_SHARED))
+    return -E_INVAL;
+  len = ROUNDUP(len, PGSIZE);
+  803589:	81 c3 ff 0f 00 00    	add    $0xfff,%ebx
+  80358f:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  803595:	89 d9                	mov    %ebx,%ecx
+  803597:	89 5d c4             	mov    %ebx,-0x3c(%ebp)
+
+  // First fit: try the start of the region and the end of each
+  // mapping.
+  for (i = -1; i < NMMAP; i++) {
+  80359a:	bb 4c 67 80 00       	mov    $0x80674c,%ebx
+  80359f:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+    if (i >= 0 && !mmaps[i].mm_va)
+      continue;
+    va = i < 0 ? MMAPBASE : mmaps[i].mm_va + mmaps[i].mm_len;
+  8035a4:	bf 00 00 00 a0       	mov    $0xa0000000,%edi
+  8035a9:	eb 53                	jmp    8035fe <mmap+0xc8>
+  8035ab:	bf 00 00 00 a0       	mov    $0xa0000000,%edi
+  8035b0:	eb 4c                	jmp    8035fe <mmap+0xc8>
+    if (len > MMAPTOP - va)
+      continue;
+    for (j = 0; j < NMMAP; j++)
+  8035b2:	83 c0 01             	add    $0x1,%eax
+  8035b5:	83 f8 10             	cmp    $0x10,%eax
+  8035b8:	0f 84 e7 00 00 00    	je     8036a5 <mmap+0x16f>
+      if (mmaps[j].mm_va && va < mmaps[j].mm_va + mmaps[j].mm_len &&
+  8035be:	8d 34 80             	lea    (%eax,%eax,4),%esi
+  8035c1:	8b 14 b5 60 67 80 00 	mov    0x806760(,%esi,4),%edx
+  8035c8:	85 d2                	test   %edx,%edx
+  8035ca:	74 e6                	je     8035b2 <mmap+0x7c>
+  8035cc:	89 d1                	mov    %edx,%ecx
+  8035ce:	03 0c b5 64 67 80 00 	add    0x806764(,%esi,4),%ecx
+  8035d5:	39 cf                	cmp    %ecx,%edi
+  8035d7:	73 d9                	jae    8035b2 <mmap+0x7c>
+  8035d9:	39 da                	cmp    %ebx,%edx
+  8035db:	73 d5                	jae    8035b2 <mmap+0x7c>
+  8035dd:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8035e0:	8b 55 cc             	mov    -0x34(%ebp),%edx
+  8035e3:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  for (i = -1; i < NMMAP; i++) {
+  8035e6:	83 c2 01             	add    $0x1,%edx
+  8035e9:	83 c3 14             	add    $0x14,%ebx
+  8035ec:	83 fa 10             	cmp    $0x10,%edx
+  8035ef:	74 2b                	je     80361c <mmap+0xe6>
+    if (i >= 0 && !mmaps[i].mm_va)
+  8035f1:	85 d2                	test   %edx,%edx
+  8035f3:	78 b6                	js     8035ab <mmap+0x75>
+  8035f5:	8b 3b                	mov    (%ebx),%edi
+  8035f7:	85 ff                	test   %edi,%edi
+  8035f9:	74 eb                	je     8035e6 <mmap+0xb0>
+    va = i < 0 ? MMAPBASE : mmaps[i].mm_va + mmaps[i].mm_len;
+  8035fb:	03 7b 04             	add    0x4(%ebx),%edi
+    if (len > MMAPTOP - va)
+  8035fe:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  803603:	29 f8                	sub    %edi,%eax
+  803605:	39 c8                	cmp    %ecx,%eax
+  803607:	72 dd                	jb     8035e6 <mmap+0xb0>
+    for (j = 0; j < NMMAP; j++)
+  803609:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+          mmaps[j].mm_va < va + len)
+  80360c:	8d 34 0f             	lea    (%edi,%ecx,1),%esi
+  80360f:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  803612:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  803615:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+  803618:	89 f3                	mov    %esi,%ebx
+  80361a:	eb a2                	jmp    8035be <mmap+0x88>
+        break;
+    if (j == NMMAP)
+      break;
+  }
+  if (i == NMMAP)
+    return -E_NO_MEM;
+  80361c:	c7 45 d4 fc ff ff ff 	movl   $0xfffffffc,-0x2c(%ebp)
+  803623:	eb 75                	jmp    80369a <mmap+0x164>
+    ;
+  if (j == NMMAP)
+    return -E_NO_MEM;
+
+  if (_pgfault_handler == 0)
+    set_pgfault_handler(mmap_pgfault);
+  803625:	83 ec 0c             	sub    $0xc,%esp
+  803628:	68 fe 34 80 00       	push   $0x8034fe
+  80362d:	e8 f7 03 00 00       	call   803a29 <set_pgfault_handler>
+  803632:	83 c4 10             	add    $0x10,%esp
+  803635:	eb 24                	jmp    80365b <mmap+0x125>
+    return -E_INVAL;
+  803637:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  80363e:	eb 5a                	jmp    80369a <mmap+0x164>
+  803640:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  803647:	eb 51                	jmp    80369a <mmap+0x164>
+  803649:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  803650:	eb 48                	jmp    80369a <mmap+0x164>
+  if (_pgfault_handler == 0)
+  803652:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  803659:	74 ca                	je     803625 <mmap+0xef>
+
+  mmaps[j].mm_va = va;
+  80365b:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803662:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803665:	c1 e2 02             	shl    $0x2,%edx
+  803668:	89 ba 60 67 80 00    	mov    %edi,0x806760(%edx)
+  mmaps[j].mm_len = len;
+  80366e:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  803671:	89 b2 64 67 80 00    	mov    %esi,0x806764(%edx)
+  mmaps[j].mm_fd = fdnum;
+  803677:	8b 75 08             	mov    0x8(%ebp),%esi
+  80367a:	89 b2 68 67 80 00    	mov    %esi,0x806768(%edx)
+  mmaps[j].mm_offset = offset;
+  803680:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803683:	89 b2 6c 67 80 00    	mov    %esi,0x80676c(%edx)
+  mmaps[j].mm_perm = perm;
+  803689:	01 d8                	add    %ebx,%eax
+  80368b:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  80368e:	89 1c 85 70 67 80 00 	mov    %ebx,0x806770(,%eax,4)
+  *addr = (void *) va;
+  803695:	8b 45 18             	mov    0x18(%ebp),%eax
+  803698:	89 38                	mov    %edi,(%eax)
+  return 0;
+}
+  80369a:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80369d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8036a0:	5b                   	pop    %ebx
+  8036a1:	5e                   	pop    %esi
+  8036a2:	5f                   	pop    %edi
+  8036a3:	5d                   	pop    %ebp
+  8036a4:	c3                   	ret
+  if (i == NMMAP)
+  8036a5:	b8 60 67 80 00       	mov    $0x806760,%eax
+  for (j = 0; j < NMMAP && mmaps[j].mm_va; j++)
+  8036aa:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+  8036ad:	83 c0 14             	add    $0x14,%eax
+  8036b0:	83 78 ec 00          	cmpl   $0x0,-0x14(%eax)
+  8036b4:	74 9c                	je     803652 <mmap+0x11c>
+  8036b6:	83 c3 01             	add    $0x1,%ebx
+  8036b9:	83 fb 10             	cmp    $0x10,%ebx
+  8036bc:	75 ef                	jne    8036ad <mmap+0x177>
+    return -E_NO_MEM;
+  8036be:	c7 45 d4 fc ff ff ff 	movl   $0xfffffffc,-0x2c(%ebp)
+  8036c5:	eb d3                	jmp    80369a <mmap+0x164>
+
+008036c7 <msync>:
+// nothing for other kinds of mapping.
+//
+// Returns 0 on success, < 0 on error.
+int
+msync(void *addr)
+{
+  8036c7:	55                   	push   %ebp
+  8036c8:	89 e5                	mov    %esp,%ebp
+  8036ca:	57                   	push   %edi
+  8036cb:	56                   	push   %esi
+  8036cc:	53                   	push   %ebx
+  8036cd:	81 ec ac 00 00 00    	sub    $0xac,%esp
+  struct Stat st;
+  off_t saved, off;
+  uintptr_t va;
+  int n, r;
+
+  if ((m = mmap_find((uintptr_t) addr)) == NULL)
+  8036d3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8036d6:	e8 c6 fb ff ff       	call   8032a1 <mmap_find>
+  8036db:	85 c0                	test   %eax,%eax
+  8036dd:	0f 84 58 01 00 00    	je     80383b <msync+0x174>
+  8036e3:	89 c7                	mov    %eax,%edi
+    return -E_INVAL;
+  if (m->mm_perm != MAP_SHARED)
+    return 0;
+  8036e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  if (m->mm_perm != MAP_SHARED)
+  8036ea:	83 78 10 02          	cmpl   $0x2,0x10(%eax)
+  8036ee:	74 0a                	je     8036fa <msync+0x33>
+                          PTE_P | PTE_U | PTE_W)) < 0)
+      break;
+  }
+  fd->fd_offset = saved;
+  return r < 0 ? r : 0;
+}
+  8036f0:	89 d8                	mov    %ebx,%eax
+  8036f2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8036f5:	5b                   	pop    %ebx
+  8036f6:	5e                   	pop    %esi
+  8036f7:	5f                   	pop    %edi
+  8036f8:	5d                   	pop    %ebp
+  8036f9:	c3                   	ret
+  if ((r = fd_lookup(m->mm_fd, &fd)) < 0 || (r = fstat(m->mm_fd, &st)) < 0)
+  8036fa:	83 ec 08             	sub    $0x8,%esp
+  8036fd:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  803700:	50                   	push   %eax
+  803701:	ff 77 08             	push   0x8(%edi)
+  803704:	e8 24 e3 ff ff       	call   801a2d <fd_lookup>
+  803709:	89 c3                	mov    %eax,%ebx
+  80370b:	83 c4 10             	add    $0x10,%esp
+  80370e:	85 c0                	test   %eax,%eax
+  803710:	78 de                	js     8036f0 <msync+0x29>
+  803712:	83 ec 08             	sub    $0x8,%esp
+  803715:	8d 85 58 ff ff ff    	lea    -0xa8(%ebp),%eax
+  80371b:	50                   	push   %eax
+  80371c:	ff 77 08             	push   0x8(%edi)
+  80371f:	e8 ac e7 ff ff       	call   801ed0 <fstat>
+  803724:	89 c3                	mov    %eax,%ebx
+  803726:	83 c4 10             	add    $0x10,%esp
+  803729:	85 c0                	test   %eax,%eax
+  80372b:	78 c3                	js     8036f0 <msync+0x29>
+  saved = fd->fd_offset;
+  80372d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803730:	8b 40 04             	mov    0x4(%eax),%eax
+  803733:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%ebp)
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE) {
+  803739:	8b 37                	mov    (%edi),%esi
+  80373b:	eb 29                	jmp    803766 <msync+0x9f>
+    if ((r = sys_page_map(0, (void *) va, 0, (void *) va,
+  80373d:	83 ec 0c             	sub    $0xc,%esp
+  803740:	6a 07                	push   $0x7
+  803742:	8b 85 50 ff ff ff    	mov    -0xb0(%ebp),%eax
+  803748:	50                   	push   %eax
+  803749:	6a 00                	push   $0x0
+  80374b:	50                   	push   %eax
+  80374c:	6a 00                	push   $0x0
+  80374e:	e8 c0 d9 ff ff       	call   801113 <sys_page_map>
+  803753:	89 c3                	mov    %eax,%ebx
+  803755:	83 c4 20             	add    $0x20,%esp
+  803758:	85 c0                	test   %eax,%eax
+  80375a:	0f 88 c0 00 00 00    	js     803820 <msync+0x159>
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE) {
+  803760:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803766:	8b 07                	mov    (%edi),%eax
+  803768:	89 85 54 ff ff ff    	mov    %eax,-0xac(%ebp)
+  80376e:	03 47 04             	add    0x4(%edi),%eax
+  803771:	39 c6                	cmp    %eax,%esi
+  803773:	0f 83 a7 00 00 00    	jae    803820 <msync+0x159>
+    if (!va_mapped(va) || !(uvpt[PGNUM(va)] & PTE_D))
+  803779:	89 f0                	mov    %esi,%eax
+  80377b:	e8 63 fb ff ff       	call   8032e3 <va_mapped>
+  803780:	84 c0                	test   %al,%al
+  803782:	74 dc                	je     803760 <msync+0x99>
+  803784:	89 f0                	mov    %esi,%eax
+  803786:	c1 e8 0c             	shr    $0xc,%eax
+  803789:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803790:	a8 40                	test   $0x40,%al
+  803792:	74 cc                	je     803760 <msync+0x99>
+    off = m->mm_offset + (va - m->mm_va);
+  803794:	8b 47 0c             	mov    0xc(%edi),%eax
+  803797:	8b 8d 54 ff ff ff    	mov    -0xac(%ebp),%ecx
+  80379d:	29 c8                	sub    %ecx,%eax
+  80379f:	01 f0                	add    %esi,%eax
+    if (off >= st.st_size)
+  8037a1:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8037a4:	39 c2                	cmp    %eax,%edx
+  8037a6:	7e 78                	jle    803820 <msync+0x159>
+    n = MIN(PGSIZE, st.st_size - off);
+  8037a8:	29 c2                	sub    %eax,%edx
+  8037aa:	89 d1                	mov    %edx,%ecx
+  8037ac:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8037b1:	39 d1                	cmp    %edx,%ecx
+  8037b3:	0f 4e d1             	cmovle %ecx,%edx
+  8037b6:	89 95 54 ff ff ff    	mov    %edx,-0xac(%ebp)
+    if ((r = seek(m->mm_fd, off)) < 0 ||
+  8037bc:	83 ec 08             	sub    $0x8,%esp
+  8037bf:	50                   	push   %eax
+  8037c0:	ff 77 08             	push   0x8(%edi)
+  8037c3:	e8 60 e6 ff ff       	call   801e28 <seek>
+  8037c8:	89 c3                	mov    %eax,%ebx
+  8037ca:	83 c4 10             	add    $0x10,%esp
+  8037cd:	85 c0                	test   %eax,%eax
+  8037cf:	78 4f                	js     803820 <msync+0x159>
+        (r = write(m->mm_fd, (void *) va, n)) < 0)
+  8037d1:	89 b5 50 ff ff ff    	mov    %esi,-0xb0(%ebp)
+  8037d7:	83 ec 04             	sub    $0x4,%esp
+  8037da:	ff b5 54 ff ff ff    	push   -0xac(%ebp)
+  8037e0:	56                   	push   %esi
+  8037e1:	ff 77 08             	push   0x8(%edi)
+  8037e4:	e8 bd e5 ff ff       	call   801da6 <write>
+  8037e9:	89 c3                	mov    %eax,%ebx
+    if ((r = seek(m->mm_fd, off)) < 0 ||
+  8037eb:	83 c4 10             	add    $0x10,%esp
+  8037ee:	85 c0                	test   %eax,%eax
+  8037f0:	78 2e                	js     803820 <msync+0x159>
+    if (r < n && (r = write(m->mm_fd, (char *) va + r, n - r)) < 0)
+  8037f2:	8b 95 54 ff ff ff    	mov    -0xac(%ebp),%edx
+  8037f8:	39 c2                	cmp    %eax,%edx
+  8037fa:	0f 8e 3d ff ff ff    	jle    80373d <msync+0x76>
+  803800:	89 d0                	mov    %edx,%eax
+  803802:	29 d8                	sub    %ebx,%eax
+  803804:	01 f3                	add    %esi,%ebx
+  803806:	83 ec 04             	sub    $0x4,%esp
+  803809:	50                   	push   %eax
+  80380a:	53                   	push   %ebx
+  80380b:	ff 77 08             	push   0x8(%edi)
+  80380e:	e8 93 e5 ff ff       	call   801da6 <write>
+  803813:	89 c3                	mov    %eax,%ebx
+  803815:	83 c4 10             	add    $0x10,%esp
+  803818:	85 c0                	test   %eax,%eax
+  80381a:	0f 89 1d ff ff ff    	jns    80373d <msync+0x76>
+  fd->fd_offset = saved;
+  803820:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803823:	8b 8d 4c ff ff ff    	mov    -0xb4(%ebp),%ecx
+  803829:	89 48 04             	mov    %ecx,0x4(%eax)
+  return r < 0 ? r : 0;
+  80382c:	85 db                	test   %ebx,%ebx
+  80382e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803833:	0f 4f d8             	cmovg  %eax,%ebx
+  803836:	e9 b5 fe ff ff       	jmp    8036f0 <msync+0x29>
+    return -E_INVAL;
+  80383b:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  803840:	e9 ab fe ff ff       	jmp    8036f0 <msync+0x29>
+
+00803845 <munmap>:
+// Remove the mapping at 'addr', writing a MAP_SHARED one back first.
+//
+// Returns 0 on success, < 0 on error.
+int
+munmap(void *addr)
+{
+  803845:	55                   	push   %ebp
+  803846:	89 e5                	mov    %esp,%ebp
+  803848:	56                   	push   %esi
+  803849:	53                   	push   %ebx
+  80384a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct Mmap *m;
+  uintptr_t va;
+  int r;
+
+  if ((m = mmap_find((uintptr_t) addr)) == NULL)
+  80384d:	89 d8                	mov    %ebx,%eax
+  80384f:	e8 4d fa ff ff       	call   8032a1 <mmap_find>
+  803854:	85 c0                	test   %eax,%eax
+  803856:	74 56                	je     8038ae <munmap+0x69>
+  803858:	89 c6                	mov    %eax,%esi
+    return -E_INVAL;
+  if ((r = msync(addr)) < 0)
+  80385a:	83 ec 0c             	sub    $0xc,%esp
+  80385d:	53                   	push   %ebx
+  80385e:	e8 64 fe ff ff       	call   8036c7 <msync>
+  803863:	83 c4 10             	add    $0x10,%esp
+  803866:	85 c0                	test   %eax,%eax
+  803868:	78 3d                	js     8038a7 <munmap+0x62>
+    return r;
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE)
+  80386a:	8b 1e                	mov    (%esi),%ebx
+  80386c:	eb 06                	jmp    803874 <munmap+0x2f>
+  80386e:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803874:	8b 46 04             	mov    0x4(%esi),%eax
+  803877:	03 06                	add    (%esi),%eax
+  803879:	39 c3                	cmp    %eax,%ebx
+  80387b:	73 1f                	jae    80389c <munmap+0x57>
+    if (va_mapped(va) && (r = sys_page_unmap(0, (void *) va)) < 0)
+  80387d:	89 d8                	mov    %ebx,%eax
+  80387f:	e8 5f fa ff ff       	call   8032e3 <va_mapped>
+  803884:	84 c0                	test   %al,%al
+  803886:	74 e6                	je     80386e <munmap+0x29>
+  803888:	83 ec 08             	sub    $0x8,%esp
+  80388b:	53                   	push   %ebx
+  80388c:	6a 00                	push   $0x0
+  80388e:	e8 c2 d8 ff ff       	call   801155 <sys_page_unmap>
+  803893:	83 c4 10             	add    $0x10,%esp
+  803896:	85 c0                	test   %eax,%eax
+  803898:	79 d4                	jns    80386e <munmap+0x29>
+  80389a:	eb 0b                	jmp    8038a7 <munmap+0x62>
+      return r;
+  m->mm_va = 0;
+  80389c:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  return 0;
+  8038a2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8038a7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8038aa:	5b                   	pop    %ebx
+  8038ab:	5e                   	pop    %esi
+  8038ac:	5d                   	pop    %ebp
+  8038ad:	c3                   	ret
+    return -E_INVAL;
+  8038ae:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8038b3:	eb f2                	jmp    8038a7 <munmap+0x62>
+
+008038b5 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  8038b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038ba:	c3                   	ret
+
+008038bb <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8038bb:	55                   	push   %ebp
+  8038bc:	89 e5                	mov    %esp,%ebp
+  8038be:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  8038c1:	68 4b 45 80 00       	push   $0x80454b
+  8038c6:	ff 75 0c             	push   0xc(%ebp)
+  8038c9:	e8 d3 d3 ff ff       	call   800ca1 <strcpy>
+  return 0;
+}
+  8038ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038d3:	c9                   	leave
+  8038d4:	c3                   	ret
+
+008038d5 <devcons_write>:
+{
+  8038d5:	55                   	push   %ebp
+  8038d6:	89 e5                	mov    %esp,%ebp
+  8038d8:	57                   	push   %edi
+  8038d9:	56                   	push   %esi
+  8038da:	53                   	push   %ebx
+  8038db:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  8038e1:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  8038e6:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  8038ec:	eb 2e                	jmp    80391c <devcons_write+0x47>
+    m = n - tot;
+  8038ee:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8038f1:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  8038f3:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8038f8:	39 c3                	cmp    %eax,%ebx
+  8038fa:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  8038fd:	83 ec 04             	sub    $0x4,%esp
+  803900:	53                   	push   %ebx
+  803901:	89 f0                	mov    %esi,%eax
+  803903:	03 45 0c             	add    0xc(%ebp),%eax
+  803906:	50                   	push   %eax
+  803907:	57                   	push   %edi
+  803908:	e8 1a d5 ff ff       	call   800e27 <memmove>
+    sys_cputs(buf, m);
+  80390d:	83 c4 08             	add    $0x8,%esp
+  803910:	53                   	push   %ebx
+  803911:	57                   	push   %edi
+  803912:	e8 ba d6 ff ff       	call   800fd1 <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  803917:	01 de                	add    %ebx,%esi
+  803919:	83 c4 10             	add    $0x10,%esp
+  80391c:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80391f:	72 cd                	jb     8038ee <devcons_write+0x19>
+}
+  803921:	89 f0                	mov    %esi,%eax
+  803923:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803926:	5b                   	pop    %ebx
+  803927:	5e                   	pop    %esi
+  803928:	5f                   	pop    %edi
+  803929:	5d                   	pop    %ebp
+  80392a:	c3                   	ret
+
+0080392b <devcons_read>:
+{
+  80392b:	55                   	push   %ebp
+  80392c:	89 e5                	mov    %esp,%ebp
+  80392e:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  803931:	b8 00 00 00 00       	mov    $0x0,%eax
+  803936:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80393a:	75 07                	jne    803943 <devcons_read+0x18>
+  80393c:	eb 1f                	jmp    80395d <devcons_read+0x32>
+    sys_yield();
+  80393e:	e8 2b d7 ff ff       	call   80106e <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  803943:	e8 a7 d6 ff ff       	call   800fef <sys_cgetc>
+  803948:	85 c0                	test   %eax,%eax
+  80394a:	74 f2                	je     80393e <devcons_read+0x13>
+  if (c < 0)
+  80394c:	78 0f                	js     80395d <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  80394e:	83 f8 04             	cmp    $0x4,%eax
+  803951:	74 0c                	je     80395f <devcons_read+0x34>
+  *(char*)vbuf = c;
+  803953:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803956:	88 02                	mov    %al,(%edx)
+  return 1;
+  803958:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80395d:	c9                   	leave
+  80395e:	c3                   	ret
+    return 0;
+  80395f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803964:	eb f7                	jmp    80395d <devcons_read+0x32>
+
+00803966 <cputchar>:
+{
+  803966:	55                   	push   %ebp
+  803967:	89 e5                	mov    %esp,%ebp
+  803969:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  80396c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80396f:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  803972:	6a 01                	push   $0x1
+  803974:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803977:	50                   	push   %eax
+  803978:	e8 54 d6 ff ff       	call   800fd1 <sys_cputs>
+}
+  80397d:	83 c4 10             	add    $0x10,%esp
+  803980:	c9                   	leave
+  803981:	c3                   	ret
+
+00803982 <getchar>:
+{
+  803982:	55                   	push   %ebp
+  803983:	89 e5                	mov    %esp,%ebp
+  803985:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  803988:	6a 01                	push   $0x1
+  80398a:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80398d:	50                   	push   %eax
+  80398e:	6a 00                	push   $0x0
+  803990:	e8 43 e3 ff ff       	call   801cd8 <read>
+  if (r < 0)
+  803995:	83 c4 10             	add    $0x10,%esp
+  803998:	85 c0                	test   %eax,%eax
+  80399a:	78 06                	js     8039a2 <getchar+0x20>
+  if (r < 1)
+  80399c:	74 06                	je     8039a4 <getchar+0x22>
+  return c;
+  80399e:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8039a2:	c9                   	leave
+  8039a3:	c3                   	ret
+    return -E_EOF;
+  8039a4:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8039a9:	eb f7                	jmp    8039a2 <getchar+0x20>
+
+008039ab <iscons>:
+{
+  8039ab:	55                   	push   %ebp
+  8039ac:	89 e5                	mov    %esp,%ebp
+  8039ae:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8039b1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8039b4:	50                   	push   %eax
+  8039b5:	ff 75 08             	push   0x8(%ebp)
+  8039b8:	e8 70 e0 ff ff       	call   801a2d <fd_lookup>
+  8039bd:	83 c4 10             	add    $0x10,%esp
+  8039c0:	85 c0                	test   %eax,%eax
+  8039c2:	78 11                	js     8039d5 <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  8039c4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8039c7:	8b 15 3c 50 80 00    	mov    0x80503c,%edx
+  8039cd:	39 10                	cmp    %edx,(%eax)
+  8039cf:	0f 94 c0             	sete   %al
+  8039d2:	0f b6 c0             	movzbl %al,%eax
+}
+  8039d5:	c9                   	leave
+  8039d6:	c3                   	ret
+
+008039d7 <opencons>:
+{
+  8039d7:	55                   	push   %ebp
+  8039d8:	89 e5                	mov    %esp,%ebp
+  8039da:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  8039dd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8039e0:	50                   	push   %eax
+  8039e1:	e8 f1 df ff ff       	call   8019d7 <fd_alloc>
+  8039e6:	83 c4 10             	add    $0x10,%esp
+  8039e9:	85 c0                	test   %eax,%eax
+  8039eb:	78 3a                	js     803a27 <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8039ed:	83 ec 04             	sub    $0x4,%esp
+  8039f0:	68 07 04 00 00       	push   $0x407
+  8039f5:	ff 75 f4             	push   -0xc(%ebp)
+  8039f8:	6a 00                	push   $0x0
+  8039fa:	e8 d1 d6 ff ff       	call   8010d0 <sys_page_alloc>
+  8039ff:	83 c4 10             	add    $0x10,%esp
+  803a02:	85 c0                	test   %eax,%eax
+  803a04:	78 21                	js     803a27 <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  803a06:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803a09:	8b 15 3c 50 80 00    	mov    0x80503c,%edx
+  803a0f:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  803a11:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803a14:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  803a1b:	83 ec 0c             	sub    $0xc,%esp
+  803a1e:	50                   	push   %eax
+  803a1f:	e8 8f df ff ff       	call   8019b3 <fd2num>
+  803a24:	83 c4 10             	add    $0x10,%esp
+}
+  803a27:	c9                   	leave
+  803a28:	c3                   	ret
+
+00803a29 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  803a29:	55                   	push   %ebp
+  803a2a:	89 e5                	mov    %esp,%ebp
+  803a2c:	53                   	push   %ebx
+  803a2d:	83 ec 04             	sub    $0x4,%esp
+  int r;
+
+  if (_pgfault_handler == 0) {
+  803a30:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  803a37:	74 0d                	je     803a46 <set_pgfault_handler+0x1d>
+
+    sys_env_set_pgfault_upcall(id, _pgfault_upcall);
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  803a39:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a3c:	a3 00 80 80 00       	mov    %eax,0x808000
+}
+  803a41:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803a44:	c9                   	leave
+  803a45:	c3                   	ret
+    envid_t id = sys_getenvid();
+  803a46:	e8 04 d6 ff ff       	call   80104f <sys_getenvid>
+  803a4b:	89 c3                	mov    %eax,%ebx
+    sys_page_alloc(id, (void *) (UXSTACKTOP - PGSIZE), (PTE_P | PTE_U | PTE_W));
+  803a4d:	83 ec 04             	sub    $0x4,%esp
+  803a50:	6a 07                	push   $0x7
+  803a52:	68 00 f0 bf ee       	push   $0xeebff000
+  803a57:	50                   	push   %eax
+  803a58:	e8 73 d6 ff ff       	call   8010d0 <sys_page_alloc>
+    sys_env_set_pgfault_upcall(id, _pgfault_upcall);
+  803a5d:	83 c4 08             	add    $0x8,%esp
+  803a60:	68 70 3a 80 00       	push   $0x803a70
+  803a65:	53                   	push   %ebx
+  803a66:	e8 da d8 ff ff       	call   801345 <sys_env_set_pgfault_upcall>
+  803a6b:	83 c4 10             	add    $0x10,%esp
+  803a6e:	eb c9                	jmp    803a39 <set_pgfault_handler+0x10>
+
+00803a70 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  803a70:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  803a71:	a1 00 80 80 00       	mov    0x808000,%eax
+	call *%eax
+  803a76:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  803a78:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+  movl 48(%esp), %eax       // move trap time esp to eax
+  803a7b:	8b 44 24 30          	mov    0x30(%esp),%eax
+  subl $4, %eax             // make room for eip on trap time esp
+  803a7f:	83 e8 04             	sub    $0x4,%eax
+  movl %eax, 48(%esp)       // move value to esp
+  803a82:	89 44 24 30          	mov    %eax,0x30(%esp)
+  movl 40(%esp), %ebx       // move trap time eip to ebx
+  803a86:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+  movl %ebx, 0(%eax)
+  803a8a:	89 18                	mov    %ebx,(%eax)
+
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+  addl $0x08,%esp
+  803a8c:	83 c4 08             	add    $0x8,%esp
+  popal
+  803a8f:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+  addl $4, %esp          // skip tf->eip
+  803a90:	83 c4 04             	add    $0x4,%esp
+  popf                 // pop stack value into flags register
+  803a93:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+  popl %esp
+  803a94:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+  ret
+  803a95:	c3                   	ret
+
+00803a96 <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  803a96:	55                   	push   %ebp
+  803a97:	89 e5                	mov    %esp,%ebp
+  803a99:	57                   	push   %edi
+  803a9a:	56                   	push   %esi
+  803a9b:	53                   	push   %ebx
+  803a9c:	83 ec 14             	sub    $0x14,%esp
+  803a9f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803aa2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803aa5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803aa8:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  803aab:	85 c0                	test   %eax,%eax
+  803aad:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803ab2:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  803ab5:	ff 33                	push   (%ebx)
+  803ab7:	50                   	push   %eax
+  803ab8:	e8 eb d8 ff ff       	call   8013a8 <sys_ipc_recv>
+  803abd:	83 c4 10             	add    $0x10,%esp
+  803ac0:	85 c0                	test   %eax,%eax
+  803ac2:	78 39                	js     803afd <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  803ac4:	85 ff                	test   %edi,%edi
+  803ac6:	74 0a                	je     803ad2 <ipc_recv_pages+0x3c>
+  803ac8:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  803acd:	8b 40 7c             	mov    0x7c(%eax),%eax
+  803ad0:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803ad2:	85 f6                	test   %esi,%esi
+  803ad4:	74 0d                	je     803ae3 <ipc_recv_pages+0x4d>
+  803ad6:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  803adb:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  803ae1:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  803ae3:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  803ae8:	8b 40 74             	mov    0x74(%eax),%eax
+  803aeb:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  803aed:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  803af2:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  803af5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803af8:	5b                   	pop    %ebx
+  803af9:	5e                   	pop    %esi
+  803afa:	5f                   	pop    %edi
+  803afb:	5d                   	pop    %ebp
+  803afc:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  803afd:	85 ff                	test   %edi,%edi
+  803aff:	74 06                	je     803b07 <ipc_recv_pages+0x71>
+  803b01:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  803b07:	85 f6                	test   %esi,%esi
+  803b09:	74 06                	je     803b11 <ipc_recv_pages+0x7b>
+  803b0b:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  803b11:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  803b17:	eb dc                	jmp    803af5 <ipc_recv_pages+0x5f>
+
+00803b19 <ipc_recv>:
+{
+  803b19:	55                   	push   %ebp
+  803b1a:	89 e5                	mov    %esp,%ebp
+  803b1c:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  803b1f:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  803b26:	ff 75 10             	push   0x10(%ebp)
+  803b29:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803b2c:	50                   	push   %eax
+  803b2d:	ff 75 0c             	push   0xc(%ebp)
+  803b30:	ff 75 08             	push   0x8(%ebp)
+  803b33:	e8 5e ff ff ff       	call   803a96 <ipc_recv_pages>
+}
+  803b38:	c9                   	leave
+  803b39:	c3                   	ret
+
+00803b3a <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  803b3a:	55                   	push   %ebp
+  803b3b:	89 e5                	mov    %esp,%ebp
+  803b3d:	57                   	push   %edi
+  803b3e:	56                   	push   %esi
+  803b3f:	53                   	push   %ebx
+  803b40:	83 ec 0c             	sub    $0xc,%esp
+  803b43:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803b46:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803b49:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  803b4c:	89 c3                	mov    %eax,%ebx
+  803b4e:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  803b54:	85 c0                	test   %eax,%eax
+  803b56:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  803b5b:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  803b5e:	83 ec 0c             	sub    $0xc,%esp
+  803b61:	ff 75 14             	push   0x14(%ebp)
+  803b64:	ff 75 18             	push   0x18(%ebp)
+  803b67:	53                   	push   %ebx
+  803b68:	56                   	push   %esi
+  803b69:	57                   	push   %edi
+  803b6a:	e8 18 d8 ff ff       	call   801387 <sys_ipc_try_send>
+  803b6f:	83 c4 20             	add    $0x20,%esp
+  803b72:	85 c0                	test   %eax,%eax
+  803b74:	79 1e                	jns    803b94 <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  803b76:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803b79:	75 07                	jne    803b82 <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  803b7b:	e8 ee d4 ff ff       	call   80106e <sys_yield>
+  803b80:	eb dc                	jmp    803b5e <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  803b82:	50                   	push   %eax
+  803b83:	68 57 45 80 00       	push   $0x804557
+  803b88:	6a 5c                	push   $0x5c
+  803b8a:	68 64 45 80 00       	push   $0x804564
+  803b8f:	e8 44 ca ff ff       	call   8005d8 <_panic>
+  }
+}
+  803b94:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803b97:	5b                   	pop    %ebx
+  803b98:	5e                   	pop    %esi
+  803b99:	5f                   	pop    %edi
+  803b9a:	5d                   	pop    %ebp
+  803b9b:	c3                   	ret
+
+00803b9c <ipc_send>:
+{
+  803b9c:	55                   	push   %ebp
+  803b9d:	89 e5                	mov    %esp,%ebp
+  803b9f:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  803ba2:	ff 75 14             	push   0x14(%ebp)
+  803ba5:	6a 01                	push   $0x1
+  803ba7:	ff 75 10             	push   0x10(%ebp)
+  803baa:	ff 75 0c             	push   0xc(%ebp)
+  803bad:	ff 75 08             	push   0x8(%ebp)
+  803bb0:	e8 85 ff ff ff       	call   803b3a <ipc_send_pages>
+}
+  803bb5:	83 c4 20             	add    $0x20,%esp
+  803bb8:	c9                   	leave
+  803bb9:	c3                   	ret
+
+00803bba <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803bba:	55                   	push   %ebp
+  803bbb:	89 e5                	mov    %esp,%ebp
+  803bbd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  803bc0:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  803bc5:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803bc8:	c1 e0 04             	shl    $0x4,%eax
+  803bcb:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803bd0:	8b 40 50             	mov    0x50(%eax),%eax
+  803bd3:	39 c8                	cmp    %ecx,%eax
+  803bd5:	74 12                	je     803be9 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  803bd7:	83 c2 01             	add    $0x1,%edx
+  803bda:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  803be0:	75 e3                	jne    803bc5 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  803be2:	b8 00 00 00 00       	mov    $0x0,%eax
+  803be7:	eb 0e                	jmp    803bf7 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  803be9:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803bec:	c1 e0 04             	shl    $0x4,%eax
+  803bef:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803bf4:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803bf7:	5d                   	pop    %ebp
+  803bf8:	c3                   	ret
+
+00803bf9 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803bf9:	55                   	push   %ebp
+  803bfa:	89 e5                	mov    %esp,%ebp
+  803bfc:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  803bff:	89 c2                	mov    %eax,%edx
+  803c01:	c1 ea 16             	shr    $0x16,%edx
+  803c04:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  803c0b:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  803c10:	f6 c1 01             	test   $0x1,%cl
+  803c13:	74 1c                	je     803c31 <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  803c15:	c1 e8 0c             	shr    $0xc,%eax
+  803c18:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  803c1f:	a8 01                	test   $0x1,%al
+  803c21:	74 0e                	je     803c31 <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  803c23:	c1 e8 0c             	shr    $0xc,%eax
+  803c26:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  803c2d:	ef 
+  803c2e:	0f b7 d2             	movzwl %dx,%edx
+}
+  803c31:	89 d0                	mov    %edx,%eax
+  803c33:	5d                   	pop    %ebp
+  803c34:	c3                   	ret
+
+00803c35 <udivmod>:
+  803c35:	55                   	push   %ebp
+  803c36:	57                   	push   %edi
+  803c37:	56                   	push   %esi
+  803c38:	53                   	push   %ebx
+  803c39:	83 ec 14             	sub    $0x14,%esp
+  803c3c:	8b 74 24 28          	mov    0x28(%esp),%esi
+  803c40:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  803c44:	89 fb                	mov    %edi,%ebx
+  803c46:	09 f3                	or     %esi,%ebx
+  803c48:	0f 84 88 00 00 00    	je     803cd6 <udivmod+0xa1>
+  803c4e:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803c53:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  803c5a:	00 
+  803c5b:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  803c62:	00 
+  803c63:	89 cd                	mov    %ecx,%ebp
+  803c65:	89 34 24             	mov    %esi,(%esp)
+  803c68:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  803c6c:	eb 08                	jmp    803c76 <udivmod+0x41>
+  803c6e:	83 ed 01             	sub    $0x1,%ebp
+  803c71:	83 fd ff             	cmp    $0xffffffff,%ebp
+  803c74:	74 6c                	je     803ce2 <udivmod+0xad>
+  803c76:	89 c3                	mov    %eax,%ebx
+  803c78:	89 d6                	mov    %edx,%esi
+  803c7a:	89 e9                	mov    %ebp,%ecx
+  803c7c:	0f ad f3             	shrd   %cl,%esi,%ebx
+  803c7f:	d3 ee                	shr    %cl,%esi
+  803c81:	f6 c1 20             	test   $0x20,%cl
+  803c84:	74 04                	je     803c8a <udivmod+0x55>
+  803c86:	89 f3                	mov    %esi,%ebx
+  803c88:	31 f6                	xor    %esi,%esi
+  803c8a:	8b 3c 24             	mov    (%esp),%edi
+  803c8d:	39 fb                	cmp    %edi,%ebx
+  803c8f:	89 f7                	mov    %esi,%edi
+  803c91:	8b 1c 24             	mov    (%esp),%ebx
+  803c94:	8b 74 24 04          	mov    0x4(%esp),%esi
+  803c98:	19 f7                	sbb    %esi,%edi
+  803c9a:	72 d2                	jb     803c6e <udivmod+0x39>
+  803c9c:	89 f7                	mov    %esi,%edi
+  803c9e:	89 de                	mov    %ebx,%esi
+  803ca0:	89 e9                	mov    %ebp,%ecx
+  803ca2:	0f a5 f7             	shld   %cl,%esi,%edi
+  803ca5:	d3 e6                	shl    %cl,%esi
+  803ca7:	f6 c1 20             	test   $0x20,%cl
+  803caa:	74 04                	je     803cb0 <udivmod+0x7b>
+  803cac:	89 f7                	mov    %esi,%edi
+  803cae:	31 f6                	xor    %esi,%esi
+  803cb0:	29 f0                	sub    %esi,%eax
+  803cb2:	19 fa                	sbb    %edi,%edx
+  803cb4:	be 01 00 00 00       	mov    $0x1,%esi
+  803cb9:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cbe:	0f a5 f7             	shld   %cl,%esi,%edi
+  803cc1:	d3 e6                	shl    %cl,%esi
+  803cc3:	f6 c1 20             	test   $0x20,%cl
+  803cc6:	74 04                	je     803ccc <udivmod+0x97>
+  803cc8:	89 f7                	mov    %esi,%edi
+  803cca:	31 f6                	xor    %esi,%esi
+  803ccc:	09 74 24 08          	or     %esi,0x8(%esp)
+  803cd0:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  803cd4:	eb 98                	jmp    803c6e <udivmod+0x39>
+  803cd6:	89 f0                	mov    %esi,%eax
+  803cd8:	89 fa                	mov    %edi,%edx
+  803cda:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803cde:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  803ce2:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  803ce6:	89 01                	mov    %eax,(%ecx)
+  803ce8:	89 51 04             	mov    %edx,0x4(%ecx)
+  803ceb:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803cef:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803cf3:	83 c4 14             	add    $0x14,%esp
+  803cf6:	5b                   	pop    %ebx
+  803cf7:	5e                   	pop    %esi
+  803cf8:	5f                   	pop    %edi
+  803cf9:	5d                   	pop    %ebp
+  803cfa:	c3                   	ret
+
+00803cfb <__udivdi3>:
+  803cfb:	83 ec 18             	sub    $0x18,%esp
+  803cfe:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803d02:	50                   	push   %eax
+  803d03:	ff 74 24 2c          	push   0x2c(%esp)
+  803d07:	ff 74 24 2c          	push   0x2c(%esp)
+  803d0b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803d0f:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803d13:	e8 1d ff ff ff       	call   803c35 <udivmod>
+  803d18:	83 c4 24             	add    $0x24,%esp
+  803d1b:	c3                   	ret
+
+00803d1c <__umoddi3>:
+  803d1c:	83 ec 18             	sub    $0x18,%esp
+  803d1f:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803d23:	50                   	push   %eax
+  803d24:	ff 74 24 2c          	push   0x2c(%esp)
+  803d28:	ff 74 24 2c          	push   0x2c(%esp)
+  803d2c:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803d30:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803d34:	e8 fc fe ff ff       	call   803c35 <udivmod>
+  803d39:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803d3d:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803d41:	83 c4 24             	add    $0x24,%esp
+  803d44:	c3                   	ret
+
+00803d45 <__divdi3>:
+  803d45:	56                   	push   %esi
+  803d46:	53                   	push   %ebx
+  803d47:	83 ec 14             	sub    $0x14,%esp
+  803d4a:	8b 44 24 20          	mov    0x20(%esp),%eax
+  803d4e:	8b 54 24 24          	mov    0x24(%esp),%edx
+  803d52:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  803d56:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  803d5a:	85 d2                	test   %edx,%edx
+  803d5c:	78 18                	js     803d76 <__divdi3+0x31>
+  803d5e:	85 db                	test   %ebx,%ebx
+  803d60:	78 3e                	js     803da0 <__divdi3+0x5b>
+  803d62:	83 ec 04             	sub    $0x4,%esp
+  803d65:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803d69:	56                   	push   %esi
+  803d6a:	53                   	push   %ebx
+  803d6b:	51                   	push   %ecx
+  803d6c:	e8 c4 fe ff ff       	call   803c35 <udivmod>
+  803d71:	83 c4 10             	add    $0x10,%esp
+  803d74:	eb 24                	jmp    803d9a <__divdi3+0x55>
+  803d76:	f7 d8                	neg    %eax
+  803d78:	83 d2 00             	adc    $0x0,%edx
+  803d7b:	f7 da                	neg    %edx
+  803d7d:	85 db                	test   %ebx,%ebx
+  803d7f:	78 3a                	js     803dbb <__divdi3+0x76>
+  803d81:	83 ec 04             	sub    $0x4,%esp
+  803d84:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803d88:	56                   	push   %esi
+  803d89:	53                   	push   %ebx
+  803d8a:	51                   	push   %ecx
+  803d8b:	e8 a5 fe ff ff       	call   803c35 <udivmod>
+  803d90:	83 c4 10             	add    $0x10,%esp
+  803d93:	f7 d8                	neg    %eax
+  803d95:	83 d2 00             	adc    $0x0,%edx
+  803d98:	f7 da                	neg    %edx
+  803d9a:	83 c4 14             	add    $0x14,%esp
+  803d9d:	5b                   	pop    %ebx
+  803d9e:	5e                   	pop    %esi
+  803d9f:	c3                   	ret
+  803da0:	83 ec 04             	sub    $0x4,%esp
+  803da3:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803da7:	56                   	push   %esi
+  803da8:	f7 d9                	neg    %ecx
+  803daa:	83 d3 00             	adc    $0x0,%ebx
+  803dad:	f7 db                	neg    %ebx
+  803daf:	53                   	push   %ebx
+  803db0:	51                   	push   %ecx
+  803db1:	e8 7f fe ff ff       	call   803c35 <udivmod>
+  803db6:	83 c4 10             	add    $0x10,%esp
+  803db9:	eb d8                	jmp    803d93 <__divdi3+0x4e>
+  803dbb:	83 ec 04             	sub    $0x4,%esp
+  803dbe:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803dc2:	56                   	push   %esi
+  803dc3:	f7 d9                	neg    %ecx
+  803dc5:	83 d3 00             	adc    $0x0,%ebx
+  803dc8:	f7 db                	neg    %ebx
+  803dca:	53                   	push   %ebx
+  803dcb:	51                   	push   %ecx
+  803dcc:	e8 64 fe ff ff       	call   803c35 <udivmod>
+  803dd1:	83 c4 10             	add    $0x10,%esp
+  803dd4:	eb c4                	jmp    803d9a <__divdi3+0x55>
+
+00803dd6 <__moddi3>:
+  803dd6:	55                   	push   %ebp
+  803dd7:	57                   	push   %edi
+  803dd8:	56                   	push   %esi
+  803dd9:	53                   	push   %ebx
+  803dda:	83 ec 24             	sub    $0x24,%esp
+  803ddd:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803de1:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803de5:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  803de9:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  803ded:	85 d2                	test   %edx,%edx
+  803def:	78 3b                	js     803e2c <__moddi3+0x56>
+  803df1:	83 ec 04             	sub    $0x4,%esp
+  803df4:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803df8:	56                   	push   %esi
+  803df9:	89 ce                	mov    %ecx,%esi
+  803dfb:	f7 de                	neg    %esi
+  803dfd:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803e01:	89 de                	mov    %ebx,%esi
+  803e03:	83 d6 00             	adc    $0x0,%esi
+  803e06:	f7 de                	neg    %esi
+  803e08:	89 74 24 14          	mov    %esi,0x14(%esp)
+  803e0c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  803e10:	0f 48 f1             	cmovs  %ecx,%esi
+  803e13:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  803e18:	53                   	push   %ebx
+  803e19:	56                   	push   %esi
+  803e1a:	e8 16 fe ff ff       	call   803c35 <udivmod>
+  803e1f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803e23:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803e27:	83 c4 10             	add    $0x10,%esp
+  803e2a:	eb 47                	jmp    803e73 <__moddi3+0x9d>
+  803e2c:	f7 d8                	neg    %eax
+  803e2e:	83 d2 00             	adc    $0x0,%edx
+  803e31:	f7 da                	neg    %edx
+  803e33:	83 ec 04             	sub    $0x4,%esp
+  803e36:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803e3a:	56                   	push   %esi
+  803e3b:	89 cf                	mov    %ecx,%edi
+  803e3d:	f7 df                	neg    %edi
+  803e3f:	89 de                	mov    %ebx,%esi
+  803e41:	83 d6 00             	adc    $0x0,%esi
+  803e44:	f7 de                	neg    %esi
+  803e46:	0f 49 cf             	cmovns %edi,%ecx
+  803e49:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  803e4d:	0f 49 de             	cmovns %esi,%ebx
+  803e50:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  803e54:	ff 74 24 0c          	push   0xc(%esp)
+  803e58:	ff 74 24 0c          	push   0xc(%esp)
+  803e5c:	e8 d4 fd ff ff       	call   803c35 <udivmod>
+  803e61:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803e65:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803e69:	f7 d8                	neg    %eax
+  803e6b:	83 d2 00             	adc    $0x0,%edx
+  803e6e:	f7 da                	neg    %edx
+  803e70:	83 c4 10             	add    $0x10,%esp
+  803e73:	83 c4 24             	add    $0x24,%esp
+  803e76:	5b                   	pop    %ebx
+  803e77:	5e                   	pop    %esi
+  803e78:	5f                   	pop    %edi
+  803e79:	5d                   	pop    %ebp
+  803e7a:	c3                   	ret
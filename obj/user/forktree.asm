@@ -0,0 +1,7771 @@
+
+obj/user/forktree.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 b2 00 00 00       	call   8000e3 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <forktree>:
+  }
+}
+
+void
+forktree(const char *cur)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 04             	sub    $0x4,%esp
+  80003a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  cprintf("%04x: I am '%s'\n", sys_getenvid(), cur);
+  80003d:	e8 3f 0b 00 00       	call   800b81 <sys_getenvid>
+  800042:	83 ec 04             	sub    $0x4,%esp
+  800045:	53                   	push   %ebx
+  800046:	50                   	push   %eax
+  800047:	68 c0 39 80 00       	push   $0x8039c0
+  80004c:	e8 94 01 00 00       	call   8001e5 <cprintf>
+
+  forkchild(cur, '0');
+  800051:	83 c4 08             	add    $0x8,%esp
+  800054:	6a 30                	push   $0x30
+  800056:	53                   	push   %ebx
+  800057:	e8 13 00 00 00       	call   80006f <forkchild>
+  forkchild(cur, '1');
+  80005c:	83 c4 08             	add    $0x8,%esp
+  80005f:	6a 31                	push   $0x31
+  800061:	53                   	push   %ebx
+  800062:	e8 08 00 00 00       	call   80006f <forkchild>
+}
+  800067:	83 c4 10             	add    $0x10,%esp
+  80006a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80006d:	c9                   	leave
+  80006e:	c3                   	ret
+
+0080006f <forkchild>:
+{
+  80006f:	55                   	push   %ebp
+  800070:	89 e5                	mov    %esp,%ebp
+  800072:	56                   	push   %esi
+  800073:	53                   	push   %ebx
+  800074:	83 ec 1c             	sub    $0x1c,%esp
+  800077:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80007a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(cur) >= DEPTH)
+  80007d:	53                   	push   %ebx
+  80007e:	e8 15 07 00 00       	call   800798 <strlen>
+  800083:	83 c4 10             	add    $0x10,%esp
+  800086:	83 f8 02             	cmp    $0x2,%eax
+  800089:	7e 07                	jle    800092 <forkchild+0x23>
+}
+  80008b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80008e:	5b                   	pop    %ebx
+  80008f:	5e                   	pop    %esi
+  800090:	5d                   	pop    %ebp
+  800091:	c3                   	ret
+  snprintf(nxt, DEPTH+1, "%s%c", cur, branch);
+  800092:	83 ec 0c             	sub    $0xc,%esp
+  800095:	89 f0                	mov    %esi,%eax
+  800097:	0f be f0             	movsbl %al,%esi
+  80009a:	56                   	push   %esi
+  80009b:	53                   	push   %ebx
+  80009c:	68 d1 39 80 00       	push   $0x8039d1
+  8000a1:	6a 04                	push   $0x4
+  8000a3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8000a6:	50                   	push   %eax
+  8000a7:	e8 d2 06 00 00       	call   80077e <snprintf>
+  if (sfork() == 0) {
+  8000ac:	83 c4 20             	add    $0x20,%esp
+  8000af:	e8 02 13 00 00       	call   8013b6 <sfork>
+  8000b4:	85 c0                	test   %eax,%eax
+  8000b6:	75 d3                	jne    80008b <forkchild+0x1c>
+    forktree(nxt);
+  8000b8:	83 ec 0c             	sub    $0xc,%esp
+  8000bb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8000be:	50                   	push   %eax
+  8000bf:	e8 6f ff ff ff       	call   800033 <forktree>
+    exit();
+  8000c4:	e8 6d 00 00 00       	call   800136 <exit>
+  8000c9:	83 c4 10             	add    $0x10,%esp
+  8000cc:	eb bd                	jmp    80008b <forkchild+0x1c>
+
+008000ce <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8000ce:	55                   	push   %ebp
+  8000cf:	89 e5                	mov    %esp,%ebp
+  8000d1:	83 ec 14             	sub    $0x14,%esp
+  forktree("");
+  8000d4:	68 d0 39 80 00       	push   $0x8039d0
+  8000d9:	e8 55 ff ff ff       	call   800033 <forktree>
+}
+  8000de:	83 c4 10             	add    $0x10,%esp
+  8000e1:	c9                   	leave
+  8000e2:	c3                   	ret
+
+008000e3 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000e3:	55                   	push   %ebp
+  8000e4:	89 e5                	mov    %esp,%ebp
+  8000e6:	56                   	push   %esi
+  8000e7:	53                   	push   %ebx
+  8000e8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000eb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  8000ee:	c7 05 a0 58 80 00 00 	movl   $0x0,0x8058a0
+  8000f5:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  8000f8:	e8 84 0a 00 00       	call   800b81 <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  8000fd:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800102:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800105:	c1 e0 04             	shl    $0x4,%eax
+  800108:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80010d:	a3 a0 58 80 00       	mov    %eax,0x8058a0
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800112:	85 db                	test   %ebx,%ebx
+  800114:	7e 07                	jle    80011d <libmain+0x3a>
+    binaryname = argv[0];
+  800116:	8b 06                	mov    (%esi),%eax
+  800118:	a3 00 40 80 00       	mov    %eax,0x804000
+
+  // call user main routine
+  umain(argc, argv);
+  80011d:	83 ec 08             	sub    $0x8,%esp
+  800120:	56                   	push   %esi
+  800121:	53                   	push   %ebx
+  800122:	e8 a7 ff ff ff       	call   8000ce <umain>
+
+  // exit gracefully
+  exit();
+  800127:	e8 0a 00 00 00       	call   800136 <exit>
+}
+  80012c:	83 c4 10             	add    $0x10,%esp
+  80012f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800132:	5b                   	pop    %ebx
+  800133:	5e                   	pop    %esi
+  800134:	5d                   	pop    %ebp
+  800135:	c3                   	ret
+
+00800136 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800136:	55                   	push   %ebp
+  800137:	89 e5                	mov    %esp,%ebp
+  800139:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  80013c:	e8 6e 15 00 00       	call   8016af <close_all>
+  sys_env_destroy(0);
+  800141:	83 ec 0c             	sub    $0xc,%esp
+  800144:	6a 00                	push   $0x0
+  800146:	e8 f5 09 00 00       	call   800b40 <sys_env_destroy>
+}
+  80014b:	83 c4 10             	add    $0x10,%esp
+  80014e:	c9                   	leave
+  80014f:	c3                   	ret
+
+00800150 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800150:	55                   	push   %ebp
+  800151:	89 e5                	mov    %esp,%ebp
+  800153:	53                   	push   %ebx
+  800154:	83 ec 04             	sub    $0x4,%esp
+  800157:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  80015a:	8b 13                	mov    (%ebx),%edx
+  80015c:	8d 42 01             	lea    0x1(%edx),%eax
+  80015f:	89 03                	mov    %eax,(%ebx)
+  800161:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800164:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  800168:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80016d:	74 09                	je     800178 <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  80016f:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800173:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800176:	c9                   	leave
+  800177:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  800178:	83 ec 08             	sub    $0x8,%esp
+  80017b:	68 ff 00 00 00       	push   $0xff
+  800180:	8d 43 08             	lea    0x8(%ebx),%eax
+  800183:	50                   	push   %eax
+  800184:	e8 7a 09 00 00       	call   800b03 <sys_cputs>
+    b->idx = 0;
+  800189:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80018f:	83 c4 10             	add    $0x10,%esp
+  800192:	eb db                	jmp    80016f <putch+0x1f>
+
+00800194 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800194:	55                   	push   %ebp
+  800195:	89 e5                	mov    %esp,%ebp
+  800197:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  80019d:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001a4:	00 00 00 
+  b.cnt = 0;
+  8001a7:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001ae:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  8001b1:	ff 75 0c             	push   0xc(%ebp)
+  8001b4:	ff 75 08             	push   0x8(%ebp)
+  8001b7:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001bd:	50                   	push   %eax
+  8001be:	68 50 01 80 00       	push   $0x800150
+  8001c3:	e8 14 01 00 00       	call   8002dc <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  8001c8:	83 c4 08             	add    $0x8,%esp
+  8001cb:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001d1:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001d7:	50                   	push   %eax
+  8001d8:	e8 26 09 00 00       	call   800b03 <sys_cputs>
+
+  return b.cnt;
+}
+  8001dd:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001e3:	c9                   	leave
+  8001e4:	c3                   	ret
+
+008001e5 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8001e5:	55                   	push   %ebp
+  8001e6:	89 e5                	mov    %esp,%ebp
+  8001e8:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  8001eb:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  8001ee:	50                   	push   %eax
+  8001ef:	ff 75 08             	push   0x8(%ebp)
+  8001f2:	e8 9d ff ff ff       	call   800194 <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  8001f7:	c9                   	leave
+  8001f8:	c3                   	ret
+
+008001f9 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  8001f9:	55                   	push   %ebp
+  8001fa:	89 e5                	mov    %esp,%ebp
+  8001fc:	57                   	push   %edi
+  8001fd:	56                   	push   %esi
+  8001fe:	53                   	push   %ebx
+  8001ff:	83 ec 1c             	sub    $0x1c,%esp
+  800202:	89 c7                	mov    %eax,%edi
+  800204:	89 d6                	mov    %edx,%esi
+  800206:	8b 45 08             	mov    0x8(%ebp),%eax
+  800209:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80020c:	89 d1                	mov    %edx,%ecx
+  80020e:	89 c2                	mov    %eax,%edx
+  800210:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800213:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800216:	8b 45 10             	mov    0x10(%ebp),%eax
+  800219:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  80021c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80021f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800226:	39 c2                	cmp    %eax,%edx
+  800228:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80022b:	72 3e                	jb     80026b <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  80022d:	83 ec 0c             	sub    $0xc,%esp
+  800230:	ff 75 18             	push   0x18(%ebp)
+  800233:	83 eb 01             	sub    $0x1,%ebx
+  800236:	53                   	push   %ebx
+  800237:	50                   	push   %eax
+  800238:	83 ec 08             	sub    $0x8,%esp
+  80023b:	ff 75 e4             	push   -0x1c(%ebp)
+  80023e:	ff 75 e0             	push   -0x20(%ebp)
+  800241:	ff 75 dc             	push   -0x24(%ebp)
+  800244:	ff 75 d8             	push   -0x28(%ebp)
+  800247:	e8 d6 35 00 00       	call   803822 <__udivdi3>
+  80024c:	83 c4 18             	add    $0x18,%esp
+  80024f:	52                   	push   %edx
+  800250:	50                   	push   %eax
+  800251:	89 f2                	mov    %esi,%edx
+  800253:	89 f8                	mov    %edi,%eax
+  800255:	e8 9f ff ff ff       	call   8001f9 <printnum>
+  80025a:	83 c4 20             	add    $0x20,%esp
+  80025d:	eb 13                	jmp    800272 <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  80025f:	83 ec 08             	sub    $0x8,%esp
+  800262:	56                   	push   %esi
+  800263:	ff 75 18             	push   0x18(%ebp)
+  800266:	ff d7                	call   *%edi
+  800268:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  80026b:	83 eb 01             	sub    $0x1,%ebx
+  80026e:	85 db                	test   %ebx,%ebx
+  800270:	7f ed                	jg     80025f <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  800272:	83 ec 08             	sub    $0x8,%esp
+  800275:	56                   	push   %esi
+  800276:	83 ec 04             	sub    $0x4,%esp
+  800279:	ff 75 e4             	push   -0x1c(%ebp)
+  80027c:	ff 75 e0             	push   -0x20(%ebp)
+  80027f:	ff 75 dc             	push   -0x24(%ebp)
+  800282:	ff 75 d8             	push   -0x28(%ebp)
+  800285:	e8 b9 35 00 00       	call   803843 <__umoddi3>
+  80028a:	83 c4 14             	add    $0x14,%esp
+  80028d:	0f be 80 e0 39 80 00 	movsbl 0x8039e0(%eax),%eax
+  800294:	50                   	push   %eax
+  800295:	ff d7                	call   *%edi
+}
+  800297:	83 c4 10             	add    $0x10,%esp
+  80029a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80029d:	5b                   	pop    %ebx
+  80029e:	5e                   	pop    %esi
+  80029f:	5f                   	pop    %edi
+  8002a0:	5d                   	pop    %ebp
+  8002a1:	c3                   	ret
+
+008002a2 <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002a2:	55                   	push   %ebp
+  8002a3:	89 e5                	mov    %esp,%ebp
+  8002a5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  8002a8:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  8002ac:	8b 10                	mov    (%eax),%edx
+  8002ae:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002b1:	73 0a                	jae    8002bd <sprintputch+0x1b>
+    *b->buf++ = ch;
+  8002b3:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002b6:	89 08                	mov    %ecx,(%eax)
+  8002b8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002bb:	88 02                	mov    %al,(%edx)
+}
+  8002bd:	5d                   	pop    %ebp
+  8002be:	c3                   	ret
+
+008002bf <printfmt>:
+{
+  8002bf:	55                   	push   %ebp
+  8002c0:	89 e5                	mov    %esp,%ebp
+  8002c2:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  8002c5:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  8002c8:	50                   	push   %eax
+  8002c9:	ff 75 10             	push   0x10(%ebp)
+  8002cc:	ff 75 0c             	push   0xc(%ebp)
+  8002cf:	ff 75 08             	push   0x8(%ebp)
+  8002d2:	e8 05 00 00 00       	call   8002dc <vprintfmt>
+}
+  8002d7:	83 c4 10             	add    $0x10,%esp
+  8002da:	c9                   	leave
+  8002db:	c3                   	ret
+
+008002dc <vprintfmt>:
+{
+  8002dc:	55                   	push   %ebp
+  8002dd:	89 e5                	mov    %esp,%ebp
+  8002df:	57                   	push   %edi
+  8002e0:	56                   	push   %esi
+  8002e1:	53                   	push   %ebx
+  8002e2:	83 ec 2c             	sub    $0x2c,%esp
+  8002e5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8002e8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8002eb:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8002ee:	eb 0a                	jmp    8002fa <vprintfmt+0x1e>
+      putch(ch, putdat);
+  8002f0:	83 ec 08             	sub    $0x8,%esp
+  8002f3:	53                   	push   %ebx
+  8002f4:	50                   	push   %eax
+  8002f5:	ff d6                	call   *%esi
+  8002f7:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  8002fa:	83 c7 01             	add    $0x1,%edi
+  8002fd:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800301:	83 f8 25             	cmp    $0x25,%eax
+  800304:	74 0c                	je     800312 <vprintfmt+0x36>
+      if (ch == '\0')
+  800306:	85 c0                	test   %eax,%eax
+  800308:	75 e6                	jne    8002f0 <vprintfmt+0x14>
+}
+  80030a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80030d:	5b                   	pop    %ebx
+  80030e:	5e                   	pop    %esi
+  80030f:	5f                   	pop    %edi
+  800310:	5d                   	pop    %ebp
+  800311:	c3                   	ret
+    padc = ' ';
+  800312:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  800316:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  80031d:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  800324:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  80032b:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  800330:	8d 47 01             	lea    0x1(%edi),%eax
+  800333:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800336:	0f b6 17             	movzbl (%edi),%edx
+  800339:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80033c:	3c 55                	cmp    $0x55,%al
+  80033e:	0f 87 cf 03 00 00    	ja     800713 <vprintfmt+0x437>
+  800344:	0f b6 c0             	movzbl %al,%eax
+  800347:	ff 24 85 20 3b 80 00 	jmp    *0x803b20(,%eax,4)
+  80034e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  800351:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800355:	eb d9                	jmp    800330 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  800357:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80035a:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80035e:	eb d0                	jmp    800330 <vprintfmt+0x54>
+  800360:	0f b6 d2             	movzbl %dl,%edx
+  800363:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  800366:	b8 00 00 00 00       	mov    $0x0,%eax
+  80036b:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  80036e:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800371:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  800375:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  800378:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80037b:	83 f9 09             	cmp    $0x9,%ecx
+  80037e:	77 55                	ja     8003d5 <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  800380:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  800383:	eb e9                	jmp    80036e <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  800385:	8b 45 14             	mov    0x14(%ebp),%eax
+  800388:	8b 00                	mov    (%eax),%eax
+  80038a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80038d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800390:	8d 40 04             	lea    0x4(%eax),%eax
+  800393:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  800396:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  800399:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80039d:	79 91                	jns    800330 <vprintfmt+0x54>
+        width = precision, precision = -1;
+  80039f:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003a2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003a5:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003ac:	eb 82                	jmp    800330 <vprintfmt+0x54>
+      if (width < 0)
+  8003ae:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8003b1:	85 d2                	test   %edx,%edx
+  8003b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003b8:	0f 49 c2             	cmovns %edx,%eax
+  8003bb:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  8003be:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  8003c1:	e9 6a ff ff ff       	jmp    800330 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  8003c6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  8003c9:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  8003d0:	e9 5b ff ff ff       	jmp    800330 <vprintfmt+0x54>
+  8003d5:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003d8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003db:	eb bc                	jmp    800399 <vprintfmt+0xbd>
+      lflag++;
+  8003dd:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  8003e0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  8003e3:	e9 48 ff ff ff       	jmp    800330 <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  8003e8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003eb:	8d 78 04             	lea    0x4(%eax),%edi
+  8003ee:	83 ec 08             	sub    $0x8,%esp
+  8003f1:	53                   	push   %ebx
+  8003f2:	ff 30                	push   (%eax)
+  8003f4:	ff d6                	call   *%esi
+      break;
+  8003f6:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  8003f9:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  8003fc:	e9 b1 02 00 00       	jmp    8006b2 <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  800401:	8b 45 14             	mov    0x14(%ebp),%eax
+  800404:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  800407:	8b 10                	mov    (%eax),%edx
+  800409:	89 d0                	mov    %edx,%eax
+  80040b:	f7 d8                	neg    %eax
+  80040d:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800410:	83 f8 10             	cmp    $0x10,%eax
+  800413:	7f 23                	jg     800438 <vprintfmt+0x15c>
+  800415:	8b 14 85 80 3c 80 00 	mov    0x803c80(,%eax,4),%edx
+  80041c:	85 d2                	test   %edx,%edx
+  80041e:	74 18                	je     800438 <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  800420:	52                   	push   %edx
+  800421:	68 96 3e 80 00       	push   $0x803e96
+  800426:	53                   	push   %ebx
+  800427:	56                   	push   %esi
+  800428:	e8 92 fe ff ff       	call   8002bf <printfmt>
+  80042d:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  800430:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800433:	e9 7a 02 00 00       	jmp    8006b2 <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  800438:	50                   	push   %eax
+  800439:	68 f8 39 80 00       	push   $0x8039f8
+  80043e:	53                   	push   %ebx
+  80043f:	56                   	push   %esi
+  800440:	e8 7a fe ff ff       	call   8002bf <printfmt>
+  800445:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  800448:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  80044b:	e9 62 02 00 00       	jmp    8006b2 <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  800450:	8b 45 14             	mov    0x14(%ebp),%eax
+  800453:	83 c0 04             	add    $0x4,%eax
+  800456:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800459:	8b 45 14             	mov    0x14(%ebp),%eax
+  80045c:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  80045e:	85 c9                	test   %ecx,%ecx
+  800460:	b8 f1 39 80 00       	mov    $0x8039f1,%eax
+  800465:	0f 45 c1             	cmovne %ecx,%eax
+  800468:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  80046b:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80046f:	7e 06                	jle    800477 <vprintfmt+0x19b>
+  800471:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800475:	75 0b                	jne    800482 <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800477:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80047a:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80047d:	89 75 08             	mov    %esi,0x8(%ebp)
+  800480:	eb 5c                	jmp    8004de <vprintfmt+0x202>
+  800482:	83 ec 08             	sub    $0x8,%esp
+  800485:	ff 75 d0             	push   -0x30(%ebp)
+  800488:	ff 75 cc             	push   -0x34(%ebp)
+  80048b:	e8 20 03 00 00       	call   8007b0 <strnlen>
+  800490:	89 c2                	mov    %eax,%edx
+  800492:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800495:	29 d0                	sub    %edx,%eax
+  800497:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  80049a:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80049e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004a1:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004a4:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8004a6:	eb 0e                	jmp    8004b6 <vprintfmt+0x1da>
+          putch(padc, putdat);
+  8004a8:	83 ec 08             	sub    $0x8,%esp
+  8004ab:	53                   	push   %ebx
+  8004ac:	57                   	push   %edi
+  8004ad:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8004b0:	83 ee 01             	sub    $0x1,%esi
+  8004b3:	83 c4 10             	add    $0x10,%esp
+  8004b6:	85 f6                	test   %esi,%esi
+  8004b8:	7f ee                	jg     8004a8 <vprintfmt+0x1cc>
+  8004ba:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004bd:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004c0:	85 c0                	test   %eax,%eax
+  8004c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004c7:	0f 49 d0             	cmovns %eax,%edx
+  8004ca:	29 d0                	sub    %edx,%eax
+  8004cc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004cf:	eb a6                	jmp    800477 <vprintfmt+0x19b>
+          putch(ch, putdat);
+  8004d1:	83 ec 08             	sub    $0x8,%esp
+  8004d4:	53                   	push   %ebx
+  8004d5:	52                   	push   %edx
+  8004d6:	ff 55 08             	call   *0x8(%ebp)
+  8004d9:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8004dc:	89 f1                	mov    %esi,%ecx
+  8004de:	8d 71 01             	lea    0x1(%ecx),%esi
+  8004e1:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004e5:	0f be d0             	movsbl %al,%edx
+  8004e8:	85 d2                	test   %edx,%edx
+  8004ea:	74 28                	je     800514 <vprintfmt+0x238>
+  8004ec:	85 ff                	test   %edi,%edi
+  8004ee:	78 05                	js     8004f5 <vprintfmt+0x219>
+  8004f0:	83 ef 01             	sub    $0x1,%edi
+  8004f3:	78 30                	js     800525 <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  8004f5:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8004f9:	74 d6                	je     8004d1 <vprintfmt+0x1f5>
+  8004fb:	0f be c0             	movsbl %al,%eax
+  8004fe:	83 e8 20             	sub    $0x20,%eax
+  800501:	83 f8 5e             	cmp    $0x5e,%eax
+  800504:	76 cb                	jbe    8004d1 <vprintfmt+0x1f5>
+          putch('?', putdat);
+  800506:	83 ec 08             	sub    $0x8,%esp
+  800509:	53                   	push   %ebx
+  80050a:	6a 3f                	push   $0x3f
+  80050c:	ff 55 08             	call   *0x8(%ebp)
+  80050f:	83 c4 10             	add    $0x10,%esp
+  800512:	eb c8                	jmp    8004dc <vprintfmt+0x200>
+  800514:	8b 75 08             	mov    0x8(%ebp),%esi
+  800517:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80051a:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80051d:	01 d0                	add    %edx,%eax
+  80051f:	29 c8                	sub    %ecx,%eax
+  800521:	89 c7                	mov    %eax,%edi
+  800523:	eb 13                	jmp    800538 <vprintfmt+0x25c>
+  800525:	8b 75 08             	mov    0x8(%ebp),%esi
+  800528:	eb ed                	jmp    800517 <vprintfmt+0x23b>
+        putch(' ', putdat);
+  80052a:	83 ec 08             	sub    $0x8,%esp
+  80052d:	53                   	push   %ebx
+  80052e:	6a 20                	push   $0x20
+  800530:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  800532:	83 ef 01             	sub    $0x1,%edi
+  800535:	83 c4 10             	add    $0x10,%esp
+  800538:	85 ff                	test   %edi,%edi
+  80053a:	7f ee                	jg     80052a <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  80053c:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80053f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800542:	e9 6b 01 00 00       	jmp    8006b2 <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  800547:	83 f9 01             	cmp    $0x1,%ecx
+  80054a:	7f 1f                	jg     80056b <vprintfmt+0x28f>
+  else if (lflag)
+  80054c:	85 c9                	test   %ecx,%ecx
+  80054e:	74 67                	je     8005b7 <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  800550:	8b 45 14             	mov    0x14(%ebp),%eax
+  800553:	8b 00                	mov    (%eax),%eax
+  800555:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800558:	89 c1                	mov    %eax,%ecx
+  80055a:	c1 f9 1f             	sar    $0x1f,%ecx
+  80055d:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800560:	8b 45 14             	mov    0x14(%ebp),%eax
+  800563:	8d 40 04             	lea    0x4(%eax),%eax
+  800566:	89 45 14             	mov    %eax,0x14(%ebp)
+  800569:	eb 17                	jmp    800582 <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  80056b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80056e:	8b 50 04             	mov    0x4(%eax),%edx
+  800571:	8b 00                	mov    (%eax),%eax
+  800573:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800576:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800579:	8b 45 14             	mov    0x14(%ebp),%eax
+  80057c:	8d 40 08             	lea    0x8(%eax),%eax
+  80057f:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  800582:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800585:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  800588:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  80058d:	85 c9                	test   %ecx,%ecx
+  80058f:	0f 89 03 01 00 00    	jns    800698 <vprintfmt+0x3bc>
+        putch('-', putdat);
+  800595:	83 ec 08             	sub    $0x8,%esp
+  800598:	53                   	push   %ebx
+  800599:	6a 2d                	push   $0x2d
+  80059b:	ff d6                	call   *%esi
+        num = -(long long)num;
+  80059d:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005a0:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005a3:	f7 da                	neg    %edx
+  8005a5:	83 d1 00             	adc    $0x0,%ecx
+  8005a8:	f7 d9                	neg    %ecx
+  8005aa:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  8005ad:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005b2:	e9 e1 00 00 00       	jmp    800698 <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  8005b7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ba:	8b 00                	mov    (%eax),%eax
+  8005bc:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005bf:	89 c1                	mov    %eax,%ecx
+  8005c1:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005c4:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005c7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ca:	8d 40 04             	lea    0x4(%eax),%eax
+  8005cd:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005d0:	eb b0                	jmp    800582 <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  8005d2:	83 f9 01             	cmp    $0x1,%ecx
+  8005d5:	7f 1e                	jg     8005f5 <vprintfmt+0x319>
+  else if (lflag)
+  8005d7:	85 c9                	test   %ecx,%ecx
+  8005d9:	74 32                	je     80060d <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  8005db:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005de:	8b 10                	mov    (%eax),%edx
+  8005e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005e5:	8d 40 04             	lea    0x4(%eax),%eax
+  8005e8:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  8005eb:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  8005f0:	e9 a3 00 00 00       	jmp    800698 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  8005f5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f8:	8b 10                	mov    (%eax),%edx
+  8005fa:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005fd:	8d 40 08             	lea    0x8(%eax),%eax
+  800600:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800603:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  800608:	e9 8b 00 00 00       	jmp    800698 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  80060d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800610:	8b 10                	mov    (%eax),%edx
+  800612:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800617:	8d 40 04             	lea    0x4(%eax),%eax
+  80061a:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  80061d:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  800622:	eb 74                	jmp    800698 <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  800624:	83 f9 01             	cmp    $0x1,%ecx
+  800627:	7f 1b                	jg     800644 <vprintfmt+0x368>
+  else if (lflag)
+  800629:	85 c9                	test   %ecx,%ecx
+  80062b:	74 2c                	je     800659 <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  80062d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800630:	8b 10                	mov    (%eax),%edx
+  800632:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800637:	8d 40 04             	lea    0x4(%eax),%eax
+  80063a:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  80063d:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  800642:	eb 54                	jmp    800698 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800644:	8b 45 14             	mov    0x14(%ebp),%eax
+  800647:	8b 10                	mov    (%eax),%edx
+  800649:	8b 48 04             	mov    0x4(%eax),%ecx
+  80064c:	8d 40 08             	lea    0x8(%eax),%eax
+  80064f:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800652:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  800657:	eb 3f                	jmp    800698 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800659:	8b 45 14             	mov    0x14(%ebp),%eax
+  80065c:	8b 10                	mov    (%eax),%edx
+  80065e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800663:	8d 40 04             	lea    0x4(%eax),%eax
+  800666:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800669:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  80066e:	eb 28                	jmp    800698 <vprintfmt+0x3bc>
+      putch('0', putdat);
+  800670:	83 ec 08             	sub    $0x8,%esp
+  800673:	53                   	push   %ebx
+  800674:	6a 30                	push   $0x30
+  800676:	ff d6                	call   *%esi
+      putch('x', putdat);
+  800678:	83 c4 08             	add    $0x8,%esp
+  80067b:	53                   	push   %ebx
+  80067c:	6a 78                	push   $0x78
+  80067e:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  800680:	8b 45 14             	mov    0x14(%ebp),%eax
+  800683:	8b 10                	mov    (%eax),%edx
+  800685:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  80068a:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  80068d:	8d 40 04             	lea    0x4(%eax),%eax
+  800690:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800693:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  800698:	83 ec 0c             	sub    $0xc,%esp
+  80069b:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80069f:	50                   	push   %eax
+  8006a0:	ff 75 e0             	push   -0x20(%ebp)
+  8006a3:	57                   	push   %edi
+  8006a4:	51                   	push   %ecx
+  8006a5:	52                   	push   %edx
+  8006a6:	89 da                	mov    %ebx,%edx
+  8006a8:	89 f0                	mov    %esi,%eax
+  8006aa:	e8 4a fb ff ff       	call   8001f9 <printnum>
+      break;
+  8006af:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  8006b2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  8006b5:	e9 40 fc ff ff       	jmp    8002fa <vprintfmt+0x1e>
+  if (lflag >= 2)
+  8006ba:	83 f9 01             	cmp    $0x1,%ecx
+  8006bd:	7f 1b                	jg     8006da <vprintfmt+0x3fe>
+  else if (lflag)
+  8006bf:	85 c9                	test   %ecx,%ecx
+  8006c1:	74 2c                	je     8006ef <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  8006c3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c6:	8b 10                	mov    (%eax),%edx
+  8006c8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006cd:	8d 40 04             	lea    0x4(%eax),%eax
+  8006d0:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8006d3:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  8006d8:	eb be                	jmp    800698 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  8006da:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006dd:	8b 10                	mov    (%eax),%edx
+  8006df:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006e2:	8d 40 08             	lea    0x8(%eax),%eax
+  8006e5:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8006e8:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  8006ed:	eb a9                	jmp    800698 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8006ef:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f2:	8b 10                	mov    (%eax),%edx
+  8006f4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006f9:	8d 40 04             	lea    0x4(%eax),%eax
+  8006fc:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8006ff:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  800704:	eb 92                	jmp    800698 <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  800706:	83 ec 08             	sub    $0x8,%esp
+  800709:	53                   	push   %ebx
+  80070a:	6a 25                	push   $0x25
+  80070c:	ff d6                	call   *%esi
+      break;
+  80070e:	83 c4 10             	add    $0x10,%esp
+  800711:	eb 9f                	jmp    8006b2 <vprintfmt+0x3d6>
+      putch('%', putdat);
+  800713:	83 ec 08             	sub    $0x8,%esp
+  800716:	53                   	push   %ebx
+  800717:	6a 25                	push   $0x25
+  800719:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  80071b:	83 c4 10             	add    $0x10,%esp
+  80071e:	89 f8                	mov    %edi,%eax
+  800720:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800724:	74 05                	je     80072b <vprintfmt+0x44f>
+  800726:	83 e8 01             	sub    $0x1,%eax
+  800729:	eb f5                	jmp    800720 <vprintfmt+0x444>
+  80072b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80072e:	eb 82                	jmp    8006b2 <vprintfmt+0x3d6>
+
+00800730 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800730:	55                   	push   %ebp
+  800731:	89 e5                	mov    %esp,%ebp
+  800733:	83 ec 18             	sub    $0x18,%esp
+  800736:	8b 45 08             	mov    0x8(%ebp),%eax
+  800739:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  80073c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80073f:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800743:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800746:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  80074d:	85 c0                	test   %eax,%eax
+  80074f:	74 26                	je     800777 <vsnprintf+0x47>
+  800751:	85 d2                	test   %edx,%edx
+  800753:	7e 22                	jle    800777 <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800755:	ff 75 14             	push   0x14(%ebp)
+  800758:	ff 75 10             	push   0x10(%ebp)
+  80075b:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80075e:	50                   	push   %eax
+  80075f:	68 a2 02 80 00       	push   $0x8002a2
+  800764:	e8 73 fb ff ff       	call   8002dc <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800769:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80076c:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  80076f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800772:	83 c4 10             	add    $0x10,%esp
+}
+  800775:	c9                   	leave
+  800776:	c3                   	ret
+    return -E_INVAL;
+  800777:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80077c:	eb f7                	jmp    800775 <vsnprintf+0x45>
+
+0080077e <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80077e:	55                   	push   %ebp
+  80077f:	89 e5                	mov    %esp,%ebp
+  800781:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  800784:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  800787:	50                   	push   %eax
+  800788:	ff 75 10             	push   0x10(%ebp)
+  80078b:	ff 75 0c             	push   0xc(%ebp)
+  80078e:	ff 75 08             	push   0x8(%ebp)
+  800791:	e8 9a ff ff ff       	call   800730 <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  800796:	c9                   	leave
+  800797:	c3                   	ret
+
+00800798 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800798:	55                   	push   %ebp
+  800799:	89 e5                	mov    %esp,%ebp
+  80079b:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  80079e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007a3:	eb 03                	jmp    8007a8 <strlen+0x10>
+    n++;
+  8007a5:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  8007a8:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8007ac:	75 f7                	jne    8007a5 <strlen+0xd>
+  return n;
+}
+  8007ae:	5d                   	pop    %ebp
+  8007af:	c3                   	ret
+
+008007b0 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8007b0:	55                   	push   %ebp
+  8007b1:	89 e5                	mov    %esp,%ebp
+  8007b3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007b6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007be:	eb 03                	jmp    8007c3 <strnlen+0x13>
+    n++;
+  8007c0:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007c3:	39 d0                	cmp    %edx,%eax
+  8007c5:	74 08                	je     8007cf <strnlen+0x1f>
+  8007c7:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8007cb:	75 f3                	jne    8007c0 <strnlen+0x10>
+  8007cd:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  8007cf:	89 d0                	mov    %edx,%eax
+  8007d1:	5d                   	pop    %ebp
+  8007d2:	c3                   	ret
+
+008007d3 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8007d3:	55                   	push   %ebp
+  8007d4:	89 e5                	mov    %esp,%ebp
+  8007d6:	53                   	push   %ebx
+  8007d7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007da:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  8007dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007e2:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8007e6:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8007e9:	83 c0 01             	add    $0x1,%eax
+  8007ec:	84 d2                	test   %dl,%dl
+  8007ee:	75 f2                	jne    8007e2 <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  8007f0:	89 c8                	mov    %ecx,%eax
+  8007f2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007f5:	c9                   	leave
+  8007f6:	c3                   	ret
+
+008007f7 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8007f7:	55                   	push   %ebp
+  8007f8:	89 e5                	mov    %esp,%ebp
+  8007fa:	53                   	push   %ebx
+  8007fb:	83 ec 10             	sub    $0x10,%esp
+  8007fe:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  800801:	53                   	push   %ebx
+  800802:	e8 91 ff ff ff       	call   800798 <strlen>
+  800807:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  80080a:	ff 75 0c             	push   0xc(%ebp)
+  80080d:	01 d8                	add    %ebx,%eax
+  80080f:	50                   	push   %eax
+  800810:	e8 be ff ff ff       	call   8007d3 <strcpy>
+  return dst;
+}
+  800815:	89 d8                	mov    %ebx,%eax
+  800817:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80081a:	c9                   	leave
+  80081b:	c3                   	ret
+
+0080081c <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  80081c:	55                   	push   %ebp
+  80081d:	89 e5                	mov    %esp,%ebp
+  80081f:	56                   	push   %esi
+  800820:	53                   	push   %ebx
+  800821:	8b 75 08             	mov    0x8(%ebp),%esi
+  800824:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  800827:	89 f3                	mov    %esi,%ebx
+  800829:	03 5d 10             	add    0x10(%ebp),%ebx
+  80082c:	89 f0                	mov    %esi,%eax
+  80082e:	eb 0f                	jmp    80083f <strncpy+0x23>
+    *dst++ = *src;
+  800830:	83 c0 01             	add    $0x1,%eax
+  800833:	0f b6 0a             	movzbl (%edx),%ecx
+  800836:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  800839:	80 f9 01             	cmp    $0x1,%cl
+  80083c:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  80083f:	39 d8                	cmp    %ebx,%eax
+  800841:	75 ed                	jne    800830 <strncpy+0x14>
+  }
+  return ret;
+}
+  800843:	89 f0                	mov    %esi,%eax
+  800845:	5b                   	pop    %ebx
+  800846:	5e                   	pop    %esi
+  800847:	5d                   	pop    %ebp
+  800848:	c3                   	ret
+
+00800849 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800849:	55                   	push   %ebp
+  80084a:	89 e5                	mov    %esp,%ebp
+  80084c:	56                   	push   %esi
+  80084d:	53                   	push   %ebx
+  80084e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800851:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800854:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  800857:	89 f0                	mov    %esi,%eax
+  800859:	85 d2                	test   %edx,%edx
+  80085b:	74 21                	je     80087e <strlcpy+0x35>
+  80085d:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800861:	89 f2                	mov    %esi,%edx
+  800863:	eb 09                	jmp    80086e <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  800865:	83 c1 01             	add    $0x1,%ecx
+  800868:	83 c2 01             	add    $0x1,%edx
+  80086b:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  80086e:	39 c2                	cmp    %eax,%edx
+  800870:	74 09                	je     80087b <strlcpy+0x32>
+  800872:	0f b6 19             	movzbl (%ecx),%ebx
+  800875:	84 db                	test   %bl,%bl
+  800877:	75 ec                	jne    800865 <strlcpy+0x1c>
+  800879:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  80087b:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  80087e:	29 f0                	sub    %esi,%eax
+}
+  800880:	5b                   	pop    %ebx
+  800881:	5e                   	pop    %esi
+  800882:	5d                   	pop    %ebp
+  800883:	c3                   	ret
+
+00800884 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800884:	55                   	push   %ebp
+  800885:	89 e5                	mov    %esp,%ebp
+  800887:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80088a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  80088d:	eb 06                	jmp    800895 <strcmp+0x11>
+    p++, q++;
+  80088f:	83 c1 01             	add    $0x1,%ecx
+  800892:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  800895:	0f b6 01             	movzbl (%ecx),%eax
+  800898:	84 c0                	test   %al,%al
+  80089a:	74 04                	je     8008a0 <strcmp+0x1c>
+  80089c:	3a 02                	cmp    (%edx),%al
+  80089e:	74 ef                	je     80088f <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  8008a0:	0f b6 c0             	movzbl %al,%eax
+  8008a3:	0f b6 12             	movzbl (%edx),%edx
+  8008a6:	29 d0                	sub    %edx,%eax
+}
+  8008a8:	5d                   	pop    %ebp
+  8008a9:	c3                   	ret
+
+008008aa <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8008aa:	55                   	push   %ebp
+  8008ab:	89 e5                	mov    %esp,%ebp
+  8008ad:	53                   	push   %ebx
+  8008ae:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008b1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008b4:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  8008b7:	eb 09                	jmp    8008c2 <strncmp+0x18>
+    n--, p++, q++;
+  8008b9:	83 ea 01             	sub    $0x1,%edx
+  8008bc:	83 c0 01             	add    $0x1,%eax
+  8008bf:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  8008c2:	85 d2                	test   %edx,%edx
+  8008c4:	74 18                	je     8008de <strncmp+0x34>
+  8008c6:	0f b6 18             	movzbl (%eax),%ebx
+  8008c9:	84 db                	test   %bl,%bl
+  8008cb:	74 04                	je     8008d1 <strncmp+0x27>
+  8008cd:	3a 19                	cmp    (%ecx),%bl
+  8008cf:	74 e8                	je     8008b9 <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8008d1:	0f b6 00             	movzbl (%eax),%eax
+  8008d4:	0f b6 11             	movzbl (%ecx),%edx
+  8008d7:	29 d0                	sub    %edx,%eax
+}
+  8008d9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008dc:	c9                   	leave
+  8008dd:	c3                   	ret
+    return 0;
+  8008de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008e3:	eb f4                	jmp    8008d9 <strncmp+0x2f>
+
+008008e5 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8008e5:	55                   	push   %ebp
+  8008e6:	89 e5                	mov    %esp,%ebp
+  8008e8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008eb:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  8008ef:	eb 03                	jmp    8008f4 <strchr+0xf>
+  8008f1:	83 c0 01             	add    $0x1,%eax
+  8008f4:	0f b6 10             	movzbl (%eax),%edx
+  8008f7:	84 d2                	test   %dl,%dl
+  8008f9:	74 06                	je     800901 <strchr+0x1c>
+    if (*s == c)
+  8008fb:	38 ca                	cmp    %cl,%dl
+  8008fd:	75 f2                	jne    8008f1 <strchr+0xc>
+  8008ff:	eb 05                	jmp    800906 <strchr+0x21>
+      return (char*)s;
+  return 0;
+  800901:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800906:	5d                   	pop    %ebp
+  800907:	c3                   	ret
+
+00800908 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800908:	55                   	push   %ebp
+  800909:	89 e5                	mov    %esp,%ebp
+  80090b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80090e:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800912:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  800915:	38 ca                	cmp    %cl,%dl
+  800917:	74 09                	je     800922 <strfind+0x1a>
+  800919:	84 d2                	test   %dl,%dl
+  80091b:	74 05                	je     800922 <strfind+0x1a>
+  for (; *s; s++)
+  80091d:	83 c0 01             	add    $0x1,%eax
+  800920:	eb f0                	jmp    800912 <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  800922:	5d                   	pop    %ebp
+  800923:	c3                   	ret
+
+00800924 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800924:	55                   	push   %ebp
+  800925:	89 e5                	mov    %esp,%ebp
+  800927:	57                   	push   %edi
+  800928:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80092b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  80092e:	85 c9                	test   %ecx,%ecx
+  800930:	74 20                	je     800952 <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  800932:	89 f8                	mov    %edi,%eax
+  800934:	09 c8                	or     %ecx,%eax
+  800936:	a8 03                	test   $0x3,%al
+  800938:	75 12                	jne    80094c <memset+0x28>
+    c &= 0xFF;
+  80093a:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80093e:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  800944:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  800947:	fc                   	cld
+  800948:	f3 ab                	rep stos %eax,%es:(%edi)
+  80094a:	eb 06                	jmp    800952 <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  80094c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80094f:	fc                   	cld
+  800950:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  800952:	89 f8                	mov    %edi,%eax
+  800954:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800957:	c9                   	leave
+  800958:	c3                   	ret
+
+00800959 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800959:	55                   	push   %ebp
+  80095a:	89 e5                	mov    %esp,%ebp
+  80095c:	57                   	push   %edi
+  80095d:	56                   	push   %esi
+  80095e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800961:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800964:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  800967:	39 c6                	cmp    %eax,%esi
+  800969:	73 32                	jae    80099d <memmove+0x44>
+  80096b:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80096e:	39 d0                	cmp    %edx,%eax
+  800970:	73 2b                	jae    80099d <memmove+0x44>
+    s += n;
+    d += n;
+  800972:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800975:	89 d6                	mov    %edx,%esi
+  800977:	09 fe                	or     %edi,%esi
+  800979:	09 ce                	or     %ecx,%esi
+  80097b:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800981:	75 0e                	jne    800991 <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800983:	83 ef 04             	sub    $0x4,%edi
+  800986:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800989:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  80098c:	fd                   	std
+  80098d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80098f:	eb 09                	jmp    80099a <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800991:	83 ef 01             	sub    $0x1,%edi
+  800994:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  800997:	fd                   	std
+  800998:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  80099a:	fc                   	cld
+  80099b:	eb 1a                	jmp    8009b7 <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80099d:	89 f2                	mov    %esi,%edx
+  80099f:	09 c2                	or     %eax,%edx
+  8009a1:	09 ca                	or     %ecx,%edx
+  8009a3:	f6 c2 03             	test   $0x3,%dl
+  8009a6:	75 0a                	jne    8009b2 <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8009a8:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  8009ab:	89 c7                	mov    %eax,%edi
+  8009ad:	fc                   	cld
+  8009ae:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009b0:	eb 05                	jmp    8009b7 <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  8009b2:	89 c7                	mov    %eax,%edi
+  8009b4:	fc                   	cld
+  8009b5:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  8009b7:	5e                   	pop    %esi
+  8009b8:	5f                   	pop    %edi
+  8009b9:	5d                   	pop    %ebp
+  8009ba:	c3                   	ret
+
+008009bb <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8009bb:	55                   	push   %ebp
+  8009bc:	89 e5                	mov    %esp,%ebp
+  8009be:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  8009c1:	ff 75 10             	push   0x10(%ebp)
+  8009c4:	ff 75 0c             	push   0xc(%ebp)
+  8009c7:	ff 75 08             	push   0x8(%ebp)
+  8009ca:	e8 8a ff ff ff       	call   800959 <memmove>
+}
+  8009cf:	c9                   	leave
+  8009d0:	c3                   	ret
+
+008009d1 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8009d1:	55                   	push   %ebp
+  8009d2:	89 e5                	mov    %esp,%ebp
+  8009d4:	56                   	push   %esi
+  8009d5:	53                   	push   %ebx
+  8009d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009d9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  8009dc:	89 c6                	mov    %eax,%esi
+  8009de:	03 75 10             	add    0x10(%ebp),%esi
+  8009e1:	eb 06                	jmp    8009e9 <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  8009e3:	83 c0 01             	add    $0x1,%eax
+  8009e6:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  8009e9:	39 f0                	cmp    %esi,%eax
+  8009eb:	74 14                	je     800a01 <memcmp+0x30>
+    if (*s1 != *s2)
+  8009ed:	0f b6 08             	movzbl (%eax),%ecx
+  8009f0:	0f b6 1a             	movzbl (%edx),%ebx
+  8009f3:	38 d9                	cmp    %bl,%cl
+  8009f5:	74 ec                	je     8009e3 <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  8009f7:	0f b6 c1             	movzbl %cl,%eax
+  8009fa:	0f b6 db             	movzbl %bl,%ebx
+  8009fd:	29 d8                	sub    %ebx,%eax
+  8009ff:	eb 05                	jmp    800a06 <memcmp+0x35>
+  }
+
+  return 0;
+  800a01:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a06:	5b                   	pop    %ebx
+  800a07:	5e                   	pop    %esi
+  800a08:	5d                   	pop    %ebp
+  800a09:	c3                   	ret
+
+00800a0a <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a0a:	55                   	push   %ebp
+  800a0b:	89 e5                	mov    %esp,%ebp
+  800a0d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a10:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  800a13:	89 c2                	mov    %eax,%edx
+  800a15:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  800a18:	eb 03                	jmp    800a1d <memfind+0x13>
+  800a1a:	83 c0 01             	add    $0x1,%eax
+  800a1d:	39 d0                	cmp    %edx,%eax
+  800a1f:	73 04                	jae    800a25 <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  800a21:	38 08                	cmp    %cl,(%eax)
+  800a23:	75 f5                	jne    800a1a <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  800a25:	5d                   	pop    %ebp
+  800a26:	c3                   	ret
+
+00800a27 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a27:	55                   	push   %ebp
+  800a28:	89 e5                	mov    %esp,%ebp
+  800a2a:	57                   	push   %edi
+  800a2b:	56                   	push   %esi
+  800a2c:	53                   	push   %ebx
+  800a2d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a30:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  800a33:	eb 03                	jmp    800a38 <strtol+0x11>
+    s++;
+  800a35:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  800a38:	0f b6 02             	movzbl (%edx),%eax
+  800a3b:	3c 20                	cmp    $0x20,%al
+  800a3d:	74 f6                	je     800a35 <strtol+0xe>
+  800a3f:	3c 09                	cmp    $0x9,%al
+  800a41:	74 f2                	je     800a35 <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  800a43:	3c 2b                	cmp    $0x2b,%al
+  800a45:	74 2a                	je     800a71 <strtol+0x4a>
+  int neg = 0;
+  800a47:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  800a4c:	3c 2d                	cmp    $0x2d,%al
+  800a4e:	74 2b                	je     800a7b <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a50:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a56:	75 0f                	jne    800a67 <strtol+0x40>
+  800a58:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a5b:	74 28                	je     800a85 <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  800a5d:	85 db                	test   %ebx,%ebx
+  800a5f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a64:	0f 44 d8             	cmove  %eax,%ebx
+  800a67:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a6c:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a6f:	eb 46                	jmp    800ab7 <strtol+0x90>
+    s++;
+  800a71:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  800a74:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a79:	eb d5                	jmp    800a50 <strtol+0x29>
+    s++, neg = 1;
+  800a7b:	83 c2 01             	add    $0x1,%edx
+  800a7e:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a83:	eb cb                	jmp    800a50 <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a85:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a89:	74 0e                	je     800a99 <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  800a8b:	85 db                	test   %ebx,%ebx
+  800a8d:	75 d8                	jne    800a67 <strtol+0x40>
+    s++, base = 8;
+  800a8f:	83 c2 01             	add    $0x1,%edx
+  800a92:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a97:	eb ce                	jmp    800a67 <strtol+0x40>
+    s += 2, base = 16;
+  800a99:	83 c2 02             	add    $0x2,%edx
+  800a9c:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800aa1:	eb c4                	jmp    800a67 <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  800aa3:	0f be c0             	movsbl %al,%eax
+  800aa6:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  800aa9:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800aac:	7d 3a                	jge    800ae8 <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  800aae:	83 c2 01             	add    $0x1,%edx
+  800ab1:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800ab5:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  800ab7:	0f b6 02             	movzbl (%edx),%eax
+  800aba:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800abd:	89 f3                	mov    %esi,%ebx
+  800abf:	80 fb 09             	cmp    $0x9,%bl
+  800ac2:	76 df                	jbe    800aa3 <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  800ac4:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800ac7:	89 f3                	mov    %esi,%ebx
+  800ac9:	80 fb 19             	cmp    $0x19,%bl
+  800acc:	77 08                	ja     800ad6 <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  800ace:	0f be c0             	movsbl %al,%eax
+  800ad1:	83 e8 57             	sub    $0x57,%eax
+  800ad4:	eb d3                	jmp    800aa9 <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  800ad6:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800ad9:	89 f3                	mov    %esi,%ebx
+  800adb:	80 fb 19             	cmp    $0x19,%bl
+  800ade:	77 08                	ja     800ae8 <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  800ae0:	0f be c0             	movsbl %al,%eax
+  800ae3:	83 e8 37             	sub    $0x37,%eax
+  800ae6:	eb c1                	jmp    800aa9 <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  800ae8:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800aec:	74 05                	je     800af3 <strtol+0xcc>
+    *endptr = (char*)s;
+  800aee:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800af1:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  800af3:	89 c8                	mov    %ecx,%eax
+  800af5:	f7 d8                	neg    %eax
+  800af7:	85 ff                	test   %edi,%edi
+  800af9:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800afc:	89 c8                	mov    %ecx,%eax
+  800afe:	5b                   	pop    %ebx
+  800aff:	5e                   	pop    %esi
+  800b00:	5f                   	pop    %edi
+  800b01:	5d                   	pop    %ebp
+  800b02:	c3                   	ret
+
+00800b03 <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800b03:	55                   	push   %ebp
+  800b04:	89 e5                	mov    %esp,%ebp
+  800b06:	57                   	push   %edi
+  800b07:	56                   	push   %esi
+  800b08:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800b09:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b0e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b11:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b14:	89 c3                	mov    %eax,%ebx
+  800b16:	89 c7                	mov    %eax,%edi
+  800b18:	89 c6                	mov    %eax,%esi
+  800b1a:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800b1c:	5b                   	pop    %ebx
+  800b1d:	5e                   	pop    %esi
+  800b1e:	5f                   	pop    %edi
+  800b1f:	5d                   	pop    %ebp
+  800b20:	c3                   	ret
+
+00800b21 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800b21:	55                   	push   %ebp
+  800b22:	89 e5                	mov    %esp,%ebp
+  800b24:	57                   	push   %edi
+  800b25:	56                   	push   %esi
+  800b26:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800b27:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b2c:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b31:	89 d1                	mov    %edx,%ecx
+  800b33:	89 d3                	mov    %edx,%ebx
+  800b35:	89 d7                	mov    %edx,%edi
+  800b37:	89 d6                	mov    %edx,%esi
+  800b39:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800b3b:	5b                   	pop    %ebx
+  800b3c:	5e                   	pop    %esi
+  800b3d:	5f                   	pop    %edi
+  800b3e:	5d                   	pop    %ebp
+  800b3f:	c3                   	ret
+
+00800b40 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800b40:	55                   	push   %ebp
+  800b41:	89 e5                	mov    %esp,%ebp
+  800b43:	57                   	push   %edi
+  800b44:	56                   	push   %esi
+  800b45:	53                   	push   %ebx
+  800b46:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800b49:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b4e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b51:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b56:	89 cb                	mov    %ecx,%ebx
+  800b58:	89 cf                	mov    %ecx,%edi
+  800b5a:	89 ce                	mov    %ecx,%esi
+  800b5c:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800b5e:	85 c0                	test   %eax,%eax
+  800b60:	7f 08                	jg     800b6a <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800b62:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b65:	5b                   	pop    %ebx
+  800b66:	5e                   	pop    %esi
+  800b67:	5f                   	pop    %edi
+  800b68:	5d                   	pop    %ebp
+  800b69:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800b6a:	83 ec 0c             	sub    $0xc,%esp
+  800b6d:	50                   	push   %eax
+  800b6e:	6a 03                	push   $0x3
+  800b70:	68 e3 3c 80 00       	push   $0x803ce3
+  800b75:	6a 23                	push   $0x23
+  800b77:	68 00 3d 80 00       	push   $0x803d00
+  800b7c:	e8 89 29 00 00       	call   80350a <_panic>
+
+00800b81 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800b81:	55                   	push   %ebp
+  800b82:	89 e5                	mov    %esp,%ebp
+  800b84:	57                   	push   %edi
+  800b85:	56                   	push   %esi
+  800b86:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800b87:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b8c:	b8 02 00 00 00       	mov    $0x2,%eax
+  800b91:	89 d1                	mov    %edx,%ecx
+  800b93:	89 d3                	mov    %edx,%ebx
+  800b95:	89 d7                	mov    %edx,%edi
+  800b97:	89 d6                	mov    %edx,%esi
+  800b99:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800b9b:	5b                   	pop    %ebx
+  800b9c:	5e                   	pop    %esi
+  800b9d:	5f                   	pop    %edi
+  800b9e:	5d                   	pop    %ebp
+  800b9f:	c3                   	ret
+
+00800ba0 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800ba0:	55                   	push   %ebp
+  800ba1:	89 e5                	mov    %esp,%ebp
+  800ba3:	57                   	push   %edi
+  800ba4:	56                   	push   %esi
+  800ba5:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800ba6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bab:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800bb0:	89 d1                	mov    %edx,%ecx
+  800bb2:	89 d3                	mov    %edx,%ebx
+  800bb4:	89 d7                	mov    %edx,%edi
+  800bb6:	89 d6                	mov    %edx,%esi
+  800bb8:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800bba:	5b                   	pop    %ebx
+  800bbb:	5e                   	pop    %esi
+  800bbc:	5f                   	pop    %edi
+  800bbd:	5d                   	pop    %ebp
+  800bbe:	c3                   	ret
+
+00800bbf <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  800bbf:	55                   	push   %ebp
+  800bc0:	89 e5                	mov    %esp,%ebp
+  800bc2:	57                   	push   %edi
+  800bc3:	56                   	push   %esi
+  800bc4:	53                   	push   %ebx
+  800bc5:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  800bc8:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  800bcc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800bd1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bd4:	b8 14 00 00 00       	mov    $0x14,%eax
+  800bd9:	89 df                	mov    %ebx,%edi
+  800bdb:	89 de                	mov    %ebx,%esi
+  800bdd:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800bdf:	85 c0                	test   %eax,%eax
+  800be1:	7f 08                	jg     800beb <sys_env_set_cow+0x2c>
+}
+  800be3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800be6:	5b                   	pop    %ebx
+  800be7:	5e                   	pop    %esi
+  800be8:	5f                   	pop    %edi
+  800be9:	5d                   	pop    %ebp
+  800bea:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800beb:	83 ec 0c             	sub    $0xc,%esp
+  800bee:	50                   	push   %eax
+  800bef:	6a 14                	push   $0x14
+  800bf1:	68 e3 3c 80 00       	push   $0x803ce3
+  800bf6:	6a 23                	push   $0x23
+  800bf8:	68 00 3d 80 00       	push   $0x803d00
+  800bfd:	e8 08 29 00 00       	call   80350a <_panic>
+
+00800c02 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800c02:	55                   	push   %ebp
+  800c03:	89 e5                	mov    %esp,%ebp
+  800c05:	57                   	push   %edi
+  800c06:	56                   	push   %esi
+  800c07:	53                   	push   %ebx
+  800c08:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800c0b:	be 00 00 00 00       	mov    $0x0,%esi
+  800c10:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c13:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c16:	b8 04 00 00 00       	mov    $0x4,%eax
+  800c1b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c1e:	89 f7                	mov    %esi,%edi
+  800c20:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c22:	85 c0                	test   %eax,%eax
+  800c24:	7f 08                	jg     800c2e <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  800c26:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c29:	5b                   	pop    %ebx
+  800c2a:	5e                   	pop    %esi
+  800c2b:	5f                   	pop    %edi
+  800c2c:	5d                   	pop    %ebp
+  800c2d:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c2e:	83 ec 0c             	sub    $0xc,%esp
+  800c31:	50                   	push   %eax
+  800c32:	6a 04                	push   $0x4
+  800c34:	68 e3 3c 80 00       	push   $0x803ce3
+  800c39:	6a 23                	push   $0x23
+  800c3b:	68 00 3d 80 00       	push   $0x803d00
+  800c40:	e8 c5 28 00 00       	call   80350a <_panic>
+
+00800c45 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800c45:	55                   	push   %ebp
+  800c46:	89 e5                	mov    %esp,%ebp
+  800c48:	57                   	push   %edi
+  800c49:	56                   	push   %esi
+  800c4a:	53                   	push   %ebx
+  800c4b:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800c4e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c51:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c54:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c59:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c5c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c5f:	8b 75 18             	mov    0x18(%ebp),%esi
+  800c62:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c64:	85 c0                	test   %eax,%eax
+  800c66:	7f 08                	jg     800c70 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  800c68:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c6b:	5b                   	pop    %ebx
+  800c6c:	5e                   	pop    %esi
+  800c6d:	5f                   	pop    %edi
+  800c6e:	5d                   	pop    %ebp
+  800c6f:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c70:	83 ec 0c             	sub    $0xc,%esp
+  800c73:	50                   	push   %eax
+  800c74:	6a 05                	push   $0x5
+  800c76:	68 e3 3c 80 00       	push   $0x803ce3
+  800c7b:	6a 23                	push   $0x23
+  800c7d:	68 00 3d 80 00       	push   $0x803d00
+  800c82:	e8 83 28 00 00       	call   80350a <_panic>
+
+00800c87 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800c87:	55                   	push   %ebp
+  800c88:	89 e5                	mov    %esp,%ebp
+  800c8a:	57                   	push   %edi
+  800c8b:	56                   	push   %esi
+  800c8c:	53                   	push   %ebx
+  800c8d:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800c90:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c95:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c98:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c9b:	b8 06 00 00 00       	mov    $0x6,%eax
+  800ca0:	89 df                	mov    %ebx,%edi
+  800ca2:	89 de                	mov    %ebx,%esi
+  800ca4:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ca6:	85 c0                	test   %eax,%eax
+  800ca8:	7f 08                	jg     800cb2 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  800caa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cad:	5b                   	pop    %ebx
+  800cae:	5e                   	pop    %esi
+  800caf:	5f                   	pop    %edi
+  800cb0:	5d                   	pop    %ebp
+  800cb1:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800cb2:	83 ec 0c             	sub    $0xc,%esp
+  800cb5:	50                   	push   %eax
+  800cb6:	6a 06                	push   $0x6
+  800cb8:	68 e3 3c 80 00       	push   $0x803ce3
+  800cbd:	6a 23                	push   $0x23
+  800cbf:	68 00 3d 80 00       	push   $0x803d00
+  800cc4:	e8 41 28 00 00       	call   80350a <_panic>
+
+00800cc9 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  800cc9:	55                   	push   %ebp
+  800cca:	89 e5                	mov    %esp,%ebp
+  800ccc:	57                   	push   %edi
+  800ccd:	56                   	push   %esi
+  800cce:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800ccf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cd2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cd5:	b8 11 00 00 00       	mov    $0x11,%eax
+  800cda:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cdd:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ce0:	8b 75 18             	mov    0x18(%ebp),%esi
+  800ce3:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  800ce5:	5b                   	pop    %ebx
+  800ce6:	5e                   	pop    %esi
+  800ce7:	5f                   	pop    %edi
+  800ce8:	5d                   	pop    %ebp
+  800ce9:	c3                   	ret
+
+00800cea <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  800cea:	55                   	push   %ebp
+  800ceb:	89 e5                	mov    %esp,%ebp
+  800ced:	57                   	push   %edi
+  800cee:	56                   	push   %esi
+  800cef:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800cf0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cf3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cf6:	b8 12 00 00 00       	mov    $0x12,%eax
+  800cfb:	be 00 00 00 00       	mov    $0x0,%esi
+  800d00:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d03:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d06:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  800d08:	5b                   	pop    %ebx
+  800d09:	5e                   	pop    %esi
+  800d0a:	5f                   	pop    %edi
+  800d0b:	5d                   	pop    %ebp
+  800d0c:	c3                   	ret
+
+00800d0d <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  800d0d:	55                   	push   %ebp
+  800d0e:	89 e5                	mov    %esp,%ebp
+  800d10:	57                   	push   %edi
+  800d11:	56                   	push   %esi
+  800d12:	53                   	push   %ebx
+  800d13:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800d16:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d1b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d1e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d21:	b8 16 00 00 00       	mov    $0x16,%eax
+  800d26:	89 df                	mov    %ebx,%edi
+  800d28:	89 de                	mov    %ebx,%esi
+  800d2a:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d2c:	85 c0                	test   %eax,%eax
+  800d2e:	7f 08                	jg     800d38 <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  800d30:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d33:	5b                   	pop    %ebx
+  800d34:	5e                   	pop    %esi
+  800d35:	5f                   	pop    %edi
+  800d36:	5d                   	pop    %ebp
+  800d37:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d38:	83 ec 0c             	sub    $0xc,%esp
+  800d3b:	50                   	push   %eax
+  800d3c:	6a 16                	push   $0x16
+  800d3e:	68 e3 3c 80 00       	push   $0x803ce3
+  800d43:	6a 23                	push   $0x23
+  800d45:	68 00 3d 80 00       	push   $0x803d00
+  800d4a:	e8 bb 27 00 00       	call   80350a <_panic>
+
+00800d4f <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  800d4f:	55                   	push   %ebp
+  800d50:	89 e5                	mov    %esp,%ebp
+  800d52:	57                   	push   %edi
+  800d53:	56                   	push   %esi
+  800d54:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d55:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d5a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d5d:	b8 17 00 00 00       	mov    $0x17,%eax
+  800d62:	89 cb                	mov    %ecx,%ebx
+  800d64:	89 cf                	mov    %ecx,%edi
+  800d66:	89 ce                	mov    %ecx,%esi
+  800d68:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  800d6a:	5b                   	pop    %ebx
+  800d6b:	5e                   	pop    %esi
+  800d6c:	5f                   	pop    %edi
+  800d6d:	5d                   	pop    %ebp
+  800d6e:	c3                   	ret
+
+00800d6f <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  800d6f:	55                   	push   %ebp
+  800d70:	89 e5                	mov    %esp,%ebp
+  800d72:	57                   	push   %edi
+  800d73:	56                   	push   %esi
+  800d74:	53                   	push   %ebx
+  800d75:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800d78:	be 00 00 00 00       	mov    $0x0,%esi
+  800d7d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d80:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d83:	b8 18 00 00 00       	mov    $0x18,%eax
+  800d88:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d8b:	89 f7                	mov    %esi,%edi
+  800d8d:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d8f:	85 c0                	test   %eax,%eax
+  800d91:	7f 08                	jg     800d9b <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  800d93:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d96:	5b                   	pop    %ebx
+  800d97:	5e                   	pop    %esi
+  800d98:	5f                   	pop    %edi
+  800d99:	5d                   	pop    %ebp
+  800d9a:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d9b:	83 ec 0c             	sub    $0xc,%esp
+  800d9e:	50                   	push   %eax
+  800d9f:	6a 18                	push   $0x18
+  800da1:	68 e3 3c 80 00       	push   $0x803ce3
+  800da6:	6a 23                	push   $0x23
+  800da8:	68 00 3d 80 00       	push   $0x803d00
+  800dad:	e8 58 27 00 00       	call   80350a <_panic>
+
+00800db2 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  800db2:	55                   	push   %ebp
+  800db3:	89 e5                	mov    %esp,%ebp
+  800db5:	57                   	push   %edi
+  800db6:	56                   	push   %esi
+  800db7:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800db8:	be 00 00 00 00       	mov    $0x0,%esi
+  800dbd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dc0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dc3:	b8 19 00 00 00       	mov    $0x19,%eax
+  800dc8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dcb:	89 f7                	mov    %esi,%edi
+  800dcd:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  800dcf:	5b                   	pop    %ebx
+  800dd0:	5e                   	pop    %esi
+  800dd1:	5f                   	pop    %edi
+  800dd2:	5d                   	pop    %ebp
+  800dd3:	c3                   	ret
+
+00800dd4 <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  800dd4:	55                   	push   %ebp
+  800dd5:	89 e5                	mov    %esp,%ebp
+  800dd7:	57                   	push   %edi
+  800dd8:	56                   	push   %esi
+  800dd9:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800dda:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ddf:	b8 15 00 00 00       	mov    $0x15,%eax
+  800de4:	89 d1                	mov    %edx,%ecx
+  800de6:	89 d3                	mov    %edx,%ebx
+  800de8:	89 d7                	mov    %edx,%edi
+  800dea:	89 d6                	mov    %edx,%esi
+  800dec:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800dee:	5b                   	pop    %ebx
+  800def:	5e                   	pop    %esi
+  800df0:	5f                   	pop    %edi
+  800df1:	5d                   	pop    %ebp
+  800df2:	c3                   	ret
+
+00800df3 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800df3:	55                   	push   %ebp
+  800df4:	89 e5                	mov    %esp,%ebp
+  800df6:	57                   	push   %edi
+  800df7:	56                   	push   %esi
+  800df8:	53                   	push   %ebx
+  800df9:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800dfc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e01:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e04:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e07:	b8 08 00 00 00       	mov    $0x8,%eax
+  800e0c:	89 df                	mov    %ebx,%edi
+  800e0e:	89 de                	mov    %ebx,%esi
+  800e10:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e12:	85 c0                	test   %eax,%eax
+  800e14:	7f 08                	jg     800e1e <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800e16:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e19:	5b                   	pop    %ebx
+  800e1a:	5e                   	pop    %esi
+  800e1b:	5f                   	pop    %edi
+  800e1c:	5d                   	pop    %ebp
+  800e1d:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e1e:	83 ec 0c             	sub    $0xc,%esp
+  800e21:	50                   	push   %eax
+  800e22:	6a 08                	push   $0x8
+  800e24:	68 e3 3c 80 00       	push   $0x803ce3
+  800e29:	6a 23                	push   $0x23
+  800e2b:	68 00 3d 80 00       	push   $0x803d00
+  800e30:	e8 d5 26 00 00       	call   80350a <_panic>
+
+00800e35 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800e35:	55                   	push   %ebp
+  800e36:	89 e5                	mov    %esp,%ebp
+  800e38:	57                   	push   %edi
+  800e39:	56                   	push   %esi
+  800e3a:	53                   	push   %ebx
+  800e3b:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e3e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e43:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e46:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e49:	b8 09 00 00 00       	mov    $0x9,%eax
+  800e4e:	89 df                	mov    %ebx,%edi
+  800e50:	89 de                	mov    %ebx,%esi
+  800e52:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e54:	85 c0                	test   %eax,%eax
+  800e56:	7f 08                	jg     800e60 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  800e58:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e5b:	5b                   	pop    %ebx
+  800e5c:	5e                   	pop    %esi
+  800e5d:	5f                   	pop    %edi
+  800e5e:	5d                   	pop    %ebp
+  800e5f:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e60:	83 ec 0c             	sub    $0xc,%esp
+  800e63:	50                   	push   %eax
+  800e64:	6a 09                	push   $0x9
+  800e66:	68 e3 3c 80 00       	push   $0x803ce3
+  800e6b:	6a 23                	push   $0x23
+  800e6d:	68 00 3d 80 00       	push   $0x803d00
+  800e72:	e8 93 26 00 00       	call   80350a <_panic>
+
+00800e77 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800e77:	55                   	push   %ebp
+  800e78:	89 e5                	mov    %esp,%ebp
+  800e7a:	57                   	push   %edi
+  800e7b:	56                   	push   %esi
+  800e7c:	53                   	push   %ebx
+  800e7d:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e80:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e85:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e88:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e8b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e90:	89 df                	mov    %ebx,%edi
+  800e92:	89 de                	mov    %ebx,%esi
+  800e94:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e96:	85 c0                	test   %eax,%eax
+  800e98:	7f 08                	jg     800ea2 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  800e9a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e9d:	5b                   	pop    %ebx
+  800e9e:	5e                   	pop    %esi
+  800e9f:	5f                   	pop    %edi
+  800ea0:	5d                   	pop    %ebp
+  800ea1:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ea2:	83 ec 0c             	sub    $0xc,%esp
+  800ea5:	50                   	push   %eax
+  800ea6:	6a 0a                	push   $0xa
+  800ea8:	68 e3 3c 80 00       	push   $0x803ce3
+  800ead:	6a 23                	push   $0x23
+  800eaf:	68 00 3d 80 00       	push   $0x803d00
+  800eb4:	e8 51 26 00 00       	call   80350a <_panic>
+
+00800eb9 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  800eb9:	55                   	push   %ebp
+  800eba:	89 e5                	mov    %esp,%ebp
+  800ebc:	57                   	push   %edi
+  800ebd:	56                   	push   %esi
+  800ebe:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800ebf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ec5:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800eca:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ecd:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ed0:	8b 75 18             	mov    0x18(%ebp),%esi
+  800ed3:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  800ed5:	5b                   	pop    %ebx
+  800ed6:	5e                   	pop    %esi
+  800ed7:	5f                   	pop    %edi
+  800ed8:	5d                   	pop    %ebp
+  800ed9:	c3                   	ret
+
+00800eda <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  800eda:	55                   	push   %ebp
+  800edb:	89 e5                	mov    %esp,%ebp
+  800edd:	57                   	push   %edi
+  800ede:	56                   	push   %esi
+  800edf:	53                   	push   %ebx
+  800ee0:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800ee3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ee8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eeb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eee:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800ef3:	89 df                	mov    %ebx,%edi
+  800ef5:	89 de                	mov    %ebx,%esi
+  800ef7:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ef9:	85 c0                	test   %eax,%eax
+  800efb:	7f 08                	jg     800f05 <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  800efd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f00:	5b                   	pop    %ebx
+  800f01:	5e                   	pop    %esi
+  800f02:	5f                   	pop    %edi
+  800f03:	5d                   	pop    %ebp
+  800f04:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f05:	83 ec 0c             	sub    $0xc,%esp
+  800f08:	50                   	push   %eax
+  800f09:	6a 0d                	push   $0xd
+  800f0b:	68 e3 3c 80 00       	push   $0x803ce3
+  800f10:	6a 23                	push   $0x23
+  800f12:	68 00 3d 80 00       	push   $0x803d00
+  800f17:	e8 ee 25 00 00       	call   80350a <_panic>
+
+00800f1c <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  800f1c:	55                   	push   %ebp
+  800f1d:	89 e5                	mov    %esp,%ebp
+  800f1f:	57                   	push   %edi
+  800f20:	56                   	push   %esi
+  800f21:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f22:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f27:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800f2c:	89 d1                	mov    %edx,%ecx
+  800f2e:	89 d3                	mov    %edx,%ebx
+  800f30:	89 d7                	mov    %edx,%edi
+  800f32:	89 d6                	mov    %edx,%esi
+  800f34:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800f36:	5b                   	pop    %ebx
+  800f37:	5e                   	pop    %esi
+  800f38:	5f                   	pop    %edi
+  800f39:	5d                   	pop    %ebp
+  800f3a:	c3                   	ret
+
+00800f3b <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  800f3b:	55                   	push   %ebp
+  800f3c:	89 e5                	mov    %esp,%ebp
+  800f3e:	57                   	push   %edi
+  800f3f:	56                   	push   %esi
+  800f40:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f41:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f44:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f47:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f4c:	be 00 00 00 00       	mov    $0x0,%esi
+  800f51:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f54:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f57:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  800f59:	5b                   	pop    %ebx
+  800f5a:	5e                   	pop    %esi
+  800f5b:	5f                   	pop    %edi
+  800f5c:	5d                   	pop    %ebp
+  800f5d:	c3                   	ret
+
+00800f5e <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  800f5e:	55                   	push   %ebp
+  800f5f:	89 e5                	mov    %esp,%ebp
+  800f61:	57                   	push   %edi
+  800f62:	56                   	push   %esi
+  800f63:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f64:	be 00 00 00 00       	mov    $0x0,%esi
+  800f69:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f6c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f6f:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f74:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f77:	89 f7                	mov    %esi,%edi
+  800f79:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  800f7b:	5b                   	pop    %ebx
+  800f7c:	5e                   	pop    %esi
+  800f7d:	5f                   	pop    %edi
+  800f7e:	5d                   	pop    %ebp
+  800f7f:	c3                   	ret
+
+00800f80 <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  800f80:	55                   	push   %ebp
+  800f81:	89 e5                	mov    %esp,%ebp
+  800f83:	57                   	push   %edi
+  800f84:	56                   	push   %esi
+  800f85:	53                   	push   %ebx
+  800f86:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  800f89:	80 3d a4 58 80 00 00 	cmpb   $0x0,0x8058a4
+  800f90:	74 41                	je     800fd3 <sys_batch+0x53>
+  800f92:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f95:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  800f98:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  800f9f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800fa2:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  800fa5:	7d 45                	jge    800fec <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  800fa7:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800faa:	8b 06                	mov    (%esi),%eax
+  800fac:	8b 56 04             	mov    0x4(%esi),%edx
+  800faf:	8b 4e 08             	mov    0x8(%esi),%ecx
+  800fb2:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  800fb5:	8b 7e 10             	mov    0x10(%esi),%edi
+  800fb8:	8b 76 14             	mov    0x14(%esi),%esi
+  800fbb:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  800fbd:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800fc0:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  800fc3:	83 c6 1c             	add    $0x1c,%esi
+  800fc6:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  800fc9:	85 c0                	test   %eax,%eax
+  800fcb:	78 1f                	js     800fec <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  800fcd:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  800fd1:	eb cc                	jmp    800f9f <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  800fd3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fd8:	b8 13 00 00 00       	mov    $0x13,%eax
+  800fdd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fe3:	89 df                	mov    %ebx,%edi
+  800fe5:	89 de                	mov    %ebx,%esi
+  800fe7:	cd 30                	int    $0x30
+  800fe9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  800fec:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800fef:	83 c4 08             	add    $0x8,%esp
+  800ff2:	5b                   	pop    %ebx
+  800ff3:	5e                   	pop    %esi
+  800ff4:	5f                   	pop    %edi
+  800ff5:	5d                   	pop    %ebp
+  800ff6:	c3                   	ret
+
+00800ff7 <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  800ff7:	55                   	push   %ebp
+  800ff8:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  800ffa:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ffd:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  801003:	5d                   	pop    %ebp
+  801004:	c3                   	ret
+
+00801005 <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  801005:	55                   	push   %ebp
+  801006:	89 e5                	mov    %esp,%ebp
+  801008:	56                   	push   %esi
+  801009:	53                   	push   %ebx
+  80100a:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  80100d:	8b 1e                	mov    (%esi),%ebx
+  80100f:	85 db                	test   %ebx,%ebx
+  801011:	75 09                	jne    80101c <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  801013:	89 d8                	mov    %ebx,%eax
+  801015:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801018:	5b                   	pop    %ebx
+  801019:	5e                   	pop    %esi
+  80101a:	5d                   	pop    %ebp
+  80101b:	c3                   	ret
+  b->sb_n = 0;
+  80101c:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  801022:	53                   	push   %ebx
+  801023:	8d 46 04             	lea    0x4(%esi),%eax
+  801026:	50                   	push   %eax
+  801027:	e8 54 ff ff ff       	call   800f80 <sys_batch>
+  80102c:	83 c4 08             	add    $0x8,%esp
+  80102f:	85 c0                	test   %eax,%eax
+  801031:	78 1e                	js     801051 <sysbatch_flush+0x4c>
+  if (r < n)
+  801033:	39 c3                	cmp    %eax,%ebx
+  801035:	7f 07                	jg     80103e <sysbatch_flush+0x39>
+  return 0;
+  801037:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80103c:	eb d5                	jmp    801013 <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  80103e:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801041:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  801045:	85 db                	test   %ebx,%ebx
+  801047:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80104c:	0f 49 d8             	cmovns %eax,%ebx
+  80104f:	eb c2                	jmp    801013 <sysbatch_flush+0xe>
+    return r;
+  801051:	89 c3                	mov    %eax,%ebx
+  801053:	eb be                	jmp    801013 <sysbatch_flush+0xe>
+
+00801055 <sysbatch_add>:
+{
+  801055:	55                   	push   %ebp
+  801056:	89 e5                	mov    %esp,%ebp
+  801058:	53                   	push   %ebx
+  801059:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  80105c:	83 3b 40             	cmpl   $0x40,(%ebx)
+  80105f:	74 41                	je     8010a2 <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  801061:	8b 03                	mov    (%ebx),%eax
+  801063:	8d 50 01             	lea    0x1(%eax),%edx
+  801066:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  801068:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80106b:	01 d8                	add    %ebx,%eax
+  80106d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801070:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  801073:	8b 55 10             	mov    0x10(%ebp),%edx
+  801076:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  801079:	8b 55 14             	mov    0x14(%ebp),%edx
+  80107c:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  80107f:	8b 55 18             	mov    0x18(%ebp),%edx
+  801082:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  801085:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  801088:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  80108b:	8b 55 20             	mov    0x20(%ebp),%edx
+  80108e:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  801091:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  801098:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80109d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8010a0:	c9                   	leave
+  8010a1:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  8010a2:	53                   	push   %ebx
+  8010a3:	e8 5d ff ff ff       	call   801005 <sysbatch_flush>
+  8010a8:	83 c4 04             	add    $0x4,%esp
+  8010ab:	85 c0                	test   %eax,%eax
+  8010ad:	79 b2                	jns    801061 <sysbatch_add+0xc>
+  8010af:	eb ec                	jmp    80109d <sysbatch_add+0x48>
+
+008010b1 <pgfault>:
+// Custom page fault handler - if faulting page is copy-on-write,
+// map in our own private writable copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  8010b1:	55                   	push   %ebp
+  8010b2:	89 e5                	mov    %esp,%ebp
+  8010b4:	56                   	push   %esi
+  8010b5:	53                   	push   %ebx
+  8010b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  void *addr = (void*)utf->utf_fault_va;
+  8010b9:	8b 18                	mov    (%eax),%ebx
+  uint32_t err = utf->utf_err;
+  8010bb:	8b 70 04             	mov    0x4(%eax),%esi
+  // Hint:
+  //   Use the read-only page table mappings at uvpt
+  //   (see <inc/memlayout.h>).
+
+  // Faults in file mappings are mmap's to handle.
+  if (mmap_fault(utf))
+  8010be:	83 ec 0c             	sub    $0xc,%esp
+  8010c1:	50                   	push   %eax
+  8010c2:	e8 b4 1d 00 00       	call   802e7b <mmap_fault>
+  8010c7:	83 c4 10             	add    $0x10,%esp
+  8010ca:	84 c0                	test   %al,%al
+  8010cc:	75 7d                	jne    80114b <pgfault+0x9a>
+    return;
+
+  // LAB 4: Your code here.
+  if ( !(err & FEC_WR) ) {
+  8010ce:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  8010d4:	74 7c                	je     801152 <pgfault+0xa1>
+    panic("user_pgfault: %e", err);
+  }
+
+  if ( !(uvpt[PGNUM(addr)] & PTE_COW) ) {
+  8010d6:	89 d8                	mov    %ebx,%eax
+  8010d8:	c1 e8 0c             	shr    $0xc,%eax
+  8010db:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8010e2:	f6 c4 08             	test   $0x8,%ah
+  8010e5:	74 7d                	je     801164 <pgfault+0xb3>
+  // page to the old page's address.
+  // Hint:
+  //   You should make three system calls.
+
+  // LAB 4: Your code here.
+  addr = ROUNDDOWN(addr, PGSIZE);
+  8010e7:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+
+  // map page to temporary location
+  if ( (r = sys_page_alloc(0, PFTEMP, (PTE_P | PTE_U | PTE_W))) < 0) {
+  8010ed:	83 ec 04             	sub    $0x4,%esp
+  8010f0:	6a 07                	push   $0x7
+  8010f2:	68 00 f0 7f 00       	push   $0x7ff000
+  8010f7:	6a 00                	push   $0x0
+  8010f9:	e8 04 fb ff ff       	call   800c02 <sys_page_alloc>
+  8010fe:	83 c4 10             	add    $0x10,%esp
+  801101:	85 c0                	test   %eax,%eax
+  801103:	78 73                	js     801178 <pgfault+0xc7>
+    panic("sys_page_alloc: %e", r);
+  }
+
+  // copy data from old page to new page
+  memmove(PFTEMP, addr, PGSIZE);
+  801105:	83 ec 04             	sub    $0x4,%esp
+  801108:	68 00 10 00 00       	push   $0x1000
+  80110d:	53                   	push   %ebx
+  80110e:	68 00 f0 7f 00       	push   $0x7ff000
+  801113:	e8 41 f8 ff ff       	call   800959 <memmove>
+
+  // move new page to old page address
+  if ( (r = sys_page_map(0, PFTEMP, 0, addr, (PTE_P | PTE_U | PTE_W))) < 0) {
+  801118:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  80111f:	53                   	push   %ebx
+  801120:	6a 00                	push   $0x0
+  801122:	68 00 f0 7f 00       	push   $0x7ff000
+  801127:	6a 00                	push   $0x0
+  801129:	e8 17 fb ff ff       	call   800c45 <sys_page_map>
+  80112e:	83 c4 20             	add    $0x20,%esp
+  801131:	85 c0                	test   %eax,%eax
+  801133:	78 55                	js     80118a <pgfault+0xd9>
+    panic("sys_page_map: %e", r);
+  }
+
+  if ( (r = sys_page_unmap(0, PFTEMP)) < 0) {
+  801135:	83 ec 08             	sub    $0x8,%esp
+  801138:	68 00 f0 7f 00       	push   $0x7ff000
+  80113d:	6a 00                	push   $0x0
+  80113f:	e8 43 fb ff ff       	call   800c87 <sys_page_unmap>
+  801144:	83 c4 10             	add    $0x10,%esp
+  801147:	85 c0                	test   %eax,%eax
+  801149:	78 51                	js     80119c <pgfault+0xeb>
+    panic("sys_page_unmap: %e", r);
+  }
+}
+  80114b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80114e:	5b                   	pop    %ebx
+  80114f:	5e                   	pop    %esi
+  801150:	5d                   	pop    %ebp
+  801151:	c3                   	ret
+    panic("user_pgfault: %e", err);
+  801152:	56                   	push   %esi
+  801153:	68 0e 3d 80 00       	push   $0x803d0e
+  801158:	6a 1d                	push   $0x1d
+  80115a:	68 1f 3d 80 00       	push   $0x803d1f
+  80115f:	e8 a6 23 00 00       	call   80350a <_panic>
+    panic("user_pgfault: page not COW");
+  801164:	83 ec 04             	sub    $0x4,%esp
+  801167:	68 2a 3d 80 00       	push   $0x803d2a
+  80116c:	6a 21                	push   $0x21
+  80116e:	68 1f 3d 80 00       	push   $0x803d1f
+  801173:	e8 92 23 00 00       	call   80350a <_panic>
+    panic("sys_page_alloc: %e", r);
+  801178:	50                   	push   %eax
+  801179:	68 45 3d 80 00       	push   $0x803d45
+  80117e:	6a 2f                	push   $0x2f
+  801180:	68 1f 3d 80 00       	push   $0x803d1f
+  801185:	e8 80 23 00 00       	call   80350a <_panic>
+    panic("sys_page_map: %e", r);
+  80118a:	50                   	push   %eax
+  80118b:	68 58 3d 80 00       	push   $0x803d58
+  801190:	6a 37                	push   $0x37
+  801192:	68 1f 3d 80 00       	push   $0x803d1f
+  801197:	e8 6e 23 00 00       	call   80350a <_panic>
+    panic("sys_page_unmap: %e", r);
+  80119c:	50                   	push   %eax
+  80119d:	68 69 3d 80 00       	push   $0x803d69
+  8011a2:	6a 3b                	push   $0x3b
+  8011a4:	68 1f 3d 80 00       	push   $0x803d1f
+  8011a9:	e8 5c 23 00 00       	call   80350a <_panic>
+
+008011ae <shared_pgfault>:
+
+// Challenge!
+//
+static void
+shared_pgfault(struct UTrapframe *utf)
+{
+  8011ae:	55                   	push   %ebp
+  8011af:	89 e5                	mov    %esp,%ebp
+  8011b1:	53                   	push   %ebx
+  8011b2:	83 ec 10             	sub    $0x10,%esp
+  8011b5:	8b 45 08             	mov    0x8(%ebp),%eax
+  // just has fewer error checks
+  
+  void *addr = (void*)utf->utf_fault_va;
+  8011b8:	8b 18                	mov    (%eax),%ebx
+  uint32_t err = utf->utf_err;
+  int r;
+
+  if (mmap_fault(utf))
+  8011ba:	50                   	push   %eax
+  8011bb:	e8 bb 1c 00 00       	call   802e7b <mmap_fault>
+  8011c0:	83 c4 10             	add    $0x10,%esp
+  8011c3:	84 c0                	test   %al,%al
+  8011c5:	74 05                	je     8011cc <shared_pgfault+0x1e>
+  }
+
+  if ( (r = sys_page_unmap(0, PFTEMP)) < 0) {
+    panic("sys_page_unmap: %e", r);
+  }
+}
+  8011c7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8011ca:	c9                   	leave
+  8011cb:	c3                   	ret
+  addr = ROUNDDOWN(addr, PGSIZE);
+  8011cc:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if ( (r = sys_page_alloc(0, PFTEMP, (PTE_P | PTE_U | PTE_W))) < 0) {
+  8011d2:	83 ec 04             	sub    $0x4,%esp
+  8011d5:	6a 07                	push   $0x7
+  8011d7:	68 00 f0 7f 00       	push   $0x7ff000
+  8011dc:	6a 00                	push   $0x0
+  8011de:	e8 1f fa ff ff       	call   800c02 <sys_page_alloc>
+  8011e3:	83 c4 10             	add    $0x10,%esp
+  8011e6:	85 c0                	test   %eax,%eax
+  8011e8:	78 5b                	js     801245 <shared_pgfault+0x97>
+  memmove(PFTEMP, addr, PGSIZE);
+  8011ea:	83 ec 04             	sub    $0x4,%esp
+  8011ed:	68 00 10 00 00       	push   $0x1000
+  8011f2:	53                   	push   %ebx
+  8011f3:	68 00 f0 7f 00       	push   $0x7ff000
+  8011f8:	e8 5c f7 ff ff       	call   800959 <memmove>
+  if ( (r = sys_page_map(0, PFTEMP, 0, addr, (PTE_P | PTE_U | PTE_W))) < 0) {
+  8011fd:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801204:	53                   	push   %ebx
+  801205:	6a 00                	push   $0x0
+  801207:	68 00 f0 7f 00       	push   $0x7ff000
+  80120c:	6a 00                	push   $0x0
+  80120e:	e8 32 fa ff ff       	call   800c45 <sys_page_map>
+  801213:	83 c4 20             	add    $0x20,%esp
+  801216:	85 c0                	test   %eax,%eax
+  801218:	78 40                	js     80125a <shared_pgfault+0xac>
+  if ( (r = sys_page_unmap(0, PFTEMP)) < 0) {
+  80121a:	83 ec 08             	sub    $0x8,%esp
+  80121d:	68 00 f0 7f 00       	push   $0x7ff000
+  801222:	6a 00                	push   $0x0
+  801224:	e8 5e fa ff ff       	call   800c87 <sys_page_unmap>
+  801229:	83 c4 10             	add    $0x10,%esp
+  80122c:	85 c0                	test   %eax,%eax
+  80122e:	79 97                	jns    8011c7 <shared_pgfault+0x19>
+    panic("sys_page_unmap: %e", r);
+  801230:	50                   	push   %eax
+  801231:	68 69 3d 80 00       	push   $0x803d69
+  801236:	68 b0 00 00 00       	push   $0xb0
+  80123b:	68 1f 3d 80 00       	push   $0x803d1f
+  801240:	e8 c5 22 00 00       	call   80350a <_panic>
+    panic("sys_page_alloc: %e", r);
+  801245:	50                   	push   %eax
+  801246:	68 45 3d 80 00       	push   $0x803d45
+  80124b:	68 a4 00 00 00       	push   $0xa4
+  801250:	68 1f 3d 80 00       	push   $0x803d1f
+  801255:	e8 b0 22 00 00       	call   80350a <_panic>
+    panic("sys_page_map: %e", r);
+  80125a:	50                   	push   %eax
+  80125b:	68 58 3d 80 00       	push   $0x803d58
+  801260:	68 ac 00 00 00       	push   $0xac
+  801265:	68 1f 3d 80 00       	push   $0x803d1f
+  80126a:	e8 9b 22 00 00       	call   80350a <_panic>
+
+0080126f <fork>:
+{
+  80126f:	55                   	push   %ebp
+  801270:	89 e5                	mov    %esp,%ebp
+  801272:	53                   	push   %ebx
+  801273:	83 ec 04             	sub    $0x4,%esp
+  parent_id = sys_getenvid();
+  801276:	e8 06 f9 ff ff       	call   800b81 <sys_getenvid>
+  set_pgfault_handler(pgfault);
+  80127b:	83 ec 0c             	sub    $0xc,%esp
+  80127e:	68 b1 10 80 00       	push   $0x8010b1
+  801283:	e8 c8 22 00 00       	call   803550 <set_pgfault_handler>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+  envid_t ret;
+  __asm __volatile("int %2"
+  801288:	b8 07 00 00 00       	mov    $0x7,%eax
+  80128d:	cd 30                	int    $0x30
+  80128f:	89 c3                	mov    %eax,%ebx
+  if (envid < 0) {
+  801291:	83 c4 10             	add    $0x10,%esp
+  801294:	85 c0                	test   %eax,%eax
+  801296:	78 66                	js     8012fe <fork+0x8f>
+  } else if (envid == 0) {
+  801298:	74 76                	je     801310 <fork+0xa1>
+  if ( (error = sys_page_map_range(0, 0, UXSTACKTOP - PGSIZE,
+  80129a:	83 ec 0c             	sub    $0xc,%esp
+  80129d:	6a 01                	push   $0x1
+  80129f:	50                   	push   %eax
+  8012a0:	68 00 f0 bf ee       	push   $0xeebff000
+  8012a5:	6a 00                	push   $0x0
+  8012a7:	6a 00                	push   $0x0
+  8012a9:	e8 1b fa ff ff       	call   800cc9 <sys_page_map_range>
+  8012ae:	83 c4 20             	add    $0x20,%esp
+  8012b1:	85 c0                	test   %eax,%eax
+  8012b3:	78 77                	js     80132c <fork+0xbd>
+  if ( (error = sys_page_alloc(envid,
+  8012b5:	83 ec 04             	sub    $0x4,%esp
+  8012b8:	6a 07                	push   $0x7
+  8012ba:	68 00 f0 bf ee       	push   $0xeebff000
+  8012bf:	53                   	push   %ebx
+  8012c0:	e8 3d f9 ff ff       	call   800c02 <sys_page_alloc>
+  8012c5:	83 c4 10             	add    $0x10,%esp
+  8012c8:	85 c0                	test   %eax,%eax
+  8012ca:	78 72                	js     80133e <fork+0xcf>
+          thisenv->env_pgfault_upcall)) < 0) {
+  8012cc:	a1 a0 58 80 00       	mov    0x8058a0,%eax
+  8012d1:	8b 40 64             	mov    0x64(%eax),%eax
+  if ( (error = sys_env_set_pgfault_upcall(envid,
+  8012d4:	83 ec 08             	sub    $0x8,%esp
+  8012d7:	50                   	push   %eax
+  8012d8:	53                   	push   %ebx
+  8012d9:	e8 99 fb ff ff       	call   800e77 <sys_env_set_pgfault_upcall>
+  8012de:	83 c4 10             	add    $0x10,%esp
+  8012e1:	85 c0                	test   %eax,%eax
+  8012e3:	78 6b                	js     801350 <fork+0xe1>
+  if ( (error = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+  8012e5:	83 ec 08             	sub    $0x8,%esp
+  8012e8:	6a 02                	push   $0x2
+  8012ea:	53                   	push   %ebx
+  8012eb:	e8 03 fb ff ff       	call   800df3 <sys_env_set_status>
+  8012f0:	83 c4 10             	add    $0x10,%esp
+  8012f3:	85 c0                	test   %eax,%eax
+  8012f5:	78 6b                	js     801362 <fork+0xf3>
+}
+  8012f7:	89 d8                	mov    %ebx,%eax
+  8012f9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012fc:	c9                   	leave
+  8012fd:	c3                   	ret
+    panic("sys_exofork: %e", envid);
+  8012fe:	50                   	push   %eax
+  8012ff:	68 7c 3d 80 00       	push   $0x803d7c
+  801304:	6a 5e                	push   $0x5e
+  801306:	68 1f 3d 80 00       	push   $0x803d1f
+  80130b:	e8 fa 21 00 00       	call   80350a <_panic>
+    thisenv = &envs[ENVX(sys_getenvid())];
+  801310:	e8 6c f8 ff ff       	call   800b81 <sys_getenvid>
+  801315:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80131a:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80131d:	c1 e0 04             	shl    $0x4,%eax
+  801320:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801325:	a3 a0 58 80 00       	mov    %eax,0x8058a0
+    return 0;
+  80132a:	eb cb                	jmp    8012f7 <fork+0x88>
+    panic("sys_page_map_range: %e", error);
+  80132c:	50                   	push   %eax
+  80132d:	68 8c 3d 80 00       	push   $0x803d8c
+  801332:	6a 69                	push   $0x69
+  801334:	68 1f 3d 80 00       	push   $0x803d1f
+  801339:	e8 cc 21 00 00       	call   80350a <_panic>
+    panic("sys_page_alloc: %e", error);
+  80133e:	50                   	push   %eax
+  80133f:	68 45 3d 80 00       	push   $0x803d45
+  801344:	6a 70                	push   $0x70
+  801346:	68 1f 3d 80 00       	push   $0x803d1f
+  80134b:	e8 ba 21 00 00       	call   80350a <_panic>
+    panic("sys_env_set_pgfault_upcall: %e", error);
+  801350:	50                   	push   %eax
+  801351:	68 bc 3d 80 00       	push   $0x803dbc
+  801356:	6a 76                	push   $0x76
+  801358:	68 1f 3d 80 00       	push   $0x803d1f
+  80135d:	e8 a8 21 00 00       	call   80350a <_panic>
+    panic("sys_env_set_status: %e", error);
+  801362:	50                   	push   %eax
+  801363:	68 a3 3d 80 00       	push   $0x803da3
+  801368:	6a 7a                	push   $0x7a
+  80136a:	68 1f 3d 80 00       	push   $0x803d1f
+  80136f:	e8 96 21 00 00       	call   80350a <_panic>
+
+00801374 <kfork>:
+{
+  801374:	55                   	push   %ebp
+  801375:	89 e5                	mov    %esp,%ebp
+  801377:	53                   	push   %ebx
+  801378:	83 ec 10             	sub    $0x10,%esp
+  set_pgfault_handler(pgfault);
+  80137b:	68 b1 10 80 00       	push   $0x8010b1
+  801380:	e8 cb 21 00 00       	call   803550 <set_pgfault_handler>
+  if ((envid = sys_fork()) == 0)
+  801385:	e8 4a fa ff ff       	call   800dd4 <sys_fork>
+  80138a:	89 c3                	mov    %eax,%ebx
+  80138c:	83 c4 10             	add    $0x10,%esp
+  80138f:	85 c0                	test   %eax,%eax
+  801391:	74 07                	je     80139a <kfork+0x26>
+}
+  801393:	89 d8                	mov    %ebx,%eax
+  801395:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801398:	c9                   	leave
+  801399:	c3                   	ret
+    thisenv = &envs[ENVX(sys_getenvid())];
+  80139a:	e8 e2 f7 ff ff       	call   800b81 <sys_getenvid>
+  80139f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8013a4:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8013a7:	c1 e0 04             	shl    $0x4,%eax
+  8013aa:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8013af:	a3 a0 58 80 00       	mov    %eax,0x8058a0
+  return envid;
+  8013b4:	eb dd                	jmp    801393 <kfork+0x1f>
+
+008013b6 <sfork>:
+
+int
+sfork(void)
+{
+  8013b6:	55                   	push   %ebp
+  8013b7:	89 e5                	mov    %esp,%ebp
+  8013b9:	53                   	push   %ebx
+  8013ba:	83 ec 04             	sub    $0x4,%esp
+  envid_t envid, parent_id;
+  int error;
+
+  parent_id = sys_getenvid();
+  8013bd:	e8 bf f7 ff ff       	call   800b81 <sys_getenvid>
+
+  // set up page fault handler
+  set_pgfault_handler(shared_pgfault);
+  8013c2:	83 ec 0c             	sub    $0xc,%esp
+  8013c5:	68 ae 11 80 00       	push   $0x8011ae
+  8013ca:	e8 81 21 00 00       	call   803550 <set_pgfault_handler>
+  8013cf:	b8 07 00 00 00       	mov    $0x7,%eax
+  8013d4:	cd 30                	int    $0x30
+  8013d6:	89 c3                	mov    %eax,%ebx
+
+  // create a child with sys_exofork
+  envid = sys_exofork();
+  
+  if (envid < 0) {
+  8013d8:	83 c4 10             	add    $0x10,%esp
+  8013db:	85 c0                	test   %eax,%eax
+  8013dd:	78 09                	js     8013e8 <sfork+0x32>
+    panic("sys_exofork: %e", envid);
+  } else if (envid == 0) {
+  8013df:	75 1c                	jne    8013fd <sfork+0x47>
+  if ( (error = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+    panic("sys_env_set_status: %e", error);
+  }
+
+  return envid;
+}
+  8013e1:	89 d8                	mov    %ebx,%eax
+  8013e3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013e6:	c9                   	leave
+  8013e7:	c3                   	ret
+    panic("sys_exofork: %e", envid);
+  8013e8:	50                   	push   %eax
+  8013e9:	68 7c 3d 80 00       	push   $0x803d7c
+  8013ee:	68 c3 00 00 00       	push   $0xc3
+  8013f3:	68 1f 3d 80 00       	push   $0x803d1f
+  8013f8:	e8 0d 21 00 00       	call   80350a <_panic>
+  if ( (error = sys_page_map_range(0, 0, USTACKTOP - PGSIZE,
+  8013fd:	83 ec 0c             	sub    $0xc,%esp
+  801400:	6a 00                	push   $0x0
+  801402:	50                   	push   %eax
+  801403:	68 00 d0 bf ee       	push   $0xeebfd000
+  801408:	6a 00                	push   $0x0
+  80140a:	6a 00                	push   $0x0
+  80140c:	e8 b8 f8 ff ff       	call   800cc9 <sys_page_map_range>
+  801411:	83 c4 20             	add    $0x20,%esp
+  801414:	85 c0                	test   %eax,%eax
+  801416:	78 79                	js     801491 <sfork+0xdb>
+  if ( (error = sys_page_map_range(0, (void *) (USTACKTOP - PGSIZE), PGSIZE,
+  801418:	83 ec 0c             	sub    $0xc,%esp
+  80141b:	6a 01                	push   $0x1
+  80141d:	53                   	push   %ebx
+  80141e:	68 00 10 00 00       	push   $0x1000
+  801423:	68 00 d0 bf ee       	push   $0xeebfd000
+  801428:	6a 00                	push   $0x0
+  80142a:	e8 9a f8 ff ff       	call   800cc9 <sys_page_map_range>
+  80142f:	83 c4 20             	add    $0x20,%esp
+  801432:	85 c0                	test   %eax,%eax
+  801434:	78 70                	js     8014a6 <sfork+0xf0>
+  if ( (error = sys_page_alloc(envid,
+  801436:	83 ec 04             	sub    $0x4,%esp
+  801439:	6a 07                	push   $0x7
+  80143b:	68 00 f0 bf ee       	push   $0xeebff000
+  801440:	53                   	push   %ebx
+  801441:	e8 bc f7 ff ff       	call   800c02 <sys_page_alloc>
+  801446:	83 c4 10             	add    $0x10,%esp
+  801449:	85 c0                	test   %eax,%eax
+  80144b:	78 6e                	js     8014bb <sfork+0x105>
+          thisenv->env_pgfault_upcall)) < 0) {
+  80144d:	a1 a0 58 80 00       	mov    0x8058a0,%eax
+  801452:	8b 40 64             	mov    0x64(%eax),%eax
+  if ( (error = sys_env_set_pgfault_upcall(envid,
+  801455:	83 ec 08             	sub    $0x8,%esp
+  801458:	50                   	push   %eax
+  801459:	53                   	push   %ebx
+  80145a:	e8 18 fa ff ff       	call   800e77 <sys_env_set_pgfault_upcall>
+  80145f:	83 c4 10             	add    $0x10,%esp
+  801462:	85 c0                	test   %eax,%eax
+  801464:	78 6a                	js     8014d0 <sfork+0x11a>
+  if ( (error = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+  801466:	83 ec 08             	sub    $0x8,%esp
+  801469:	6a 02                	push   $0x2
+  80146b:	53                   	push   %ebx
+  80146c:	e8 82 f9 ff ff       	call   800df3 <sys_env_set_status>
+  801471:	83 c4 10             	add    $0x10,%esp
+  801474:	85 c0                	test   %eax,%eax
+  801476:	0f 89 65 ff ff ff    	jns    8013e1 <sfork+0x2b>
+    panic("sys_env_set_status: %e", error);
+  80147c:	50                   	push   %eax
+  80147d:	68 a3 3d 80 00       	push   $0x803da3
+  801482:	68 e4 00 00 00       	push   $0xe4
+  801487:	68 1f 3d 80 00       	push   $0x803d1f
+  80148c:	e8 79 20 00 00       	call   80350a <_panic>
+    panic("sys_page_map_range: %e", error);
+  801491:	50                   	push   %eax
+  801492:	68 8c 3d 80 00       	push   $0x803d8c
+  801497:	68 ce 00 00 00       	push   $0xce
+  80149c:	68 1f 3d 80 00       	push   $0x803d1f
+  8014a1:	e8 64 20 00 00       	call   80350a <_panic>
+    panic("sys_page_map_range: %e", error);
+  8014a6:	50                   	push   %eax
+  8014a7:	68 8c 3d 80 00       	push   $0x803d8c
+  8014ac:	68 d3 00 00 00       	push   $0xd3
+  8014b1:	68 1f 3d 80 00       	push   $0x803d1f
+  8014b6:	e8 4f 20 00 00       	call   80350a <_panic>
+    panic("sys_page_alloc: %e", error);
+  8014bb:	50                   	push   %eax
+  8014bc:	68 45 3d 80 00       	push   $0x803d45
+  8014c1:	68 da 00 00 00       	push   $0xda
+  8014c6:	68 1f 3d 80 00       	push   $0x803d1f
+  8014cb:	e8 3a 20 00 00       	call   80350a <_panic>
+    panic("sys_env_set_pgfault_upcall: %e", error);
+  8014d0:	50                   	push   %eax
+  8014d1:	68 bc 3d 80 00       	push   $0x803dbc
+  8014d6:	68 e0 00 00 00       	push   $0xe0
+  8014db:	68 1f 3d 80 00       	push   $0x803d1f
+  8014e0:	e8 25 20 00 00       	call   80350a <_panic>
+
+008014e5 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8014e5:	55                   	push   %ebp
+  8014e6:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8014e8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014eb:	05 00 00 00 30       	add    $0x30000000,%eax
+  8014f0:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8014f3:	5d                   	pop    %ebp
+  8014f4:	c3                   	ret
+
+008014f5 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8014f5:	55                   	push   %ebp
+  8014f6:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8014f8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014fb:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  8014fe:	66 b8 00 00          	mov    $0x0,%ax
+  801502:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801507:	5d                   	pop    %ebp
+  801508:	c3                   	ret
+
+00801509 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801509:	55                   	push   %ebp
+  80150a:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  80150c:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801511:	eb 02                	jmp    801515 <fd_alloc+0xc>
+  801513:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801515:	89 c2                	mov    %eax,%edx
+  801517:	c1 ea 16             	shr    $0x16,%edx
+  80151a:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801521:	f6 c2 01             	test   $0x1,%dl
+  801524:	74 2b                	je     801551 <fd_alloc+0x48>
+  801526:	89 c2                	mov    %eax,%edx
+  801528:	c1 ea 0c             	shr    $0xc,%edx
+  80152b:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801532:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801538:	f6 c1 01             	test   $0x1,%cl
+  80153b:	74 14                	je     801551 <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  80153d:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801543:	75 ce                	jne    801513 <fd_alloc+0xa>
+  801545:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  80154a:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80154f:	eb 05                	jmp    801556 <fd_alloc+0x4d>
+      return 0;
+  801551:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  801556:	8b 55 08             	mov    0x8(%ebp),%edx
+  801559:	89 02                	mov    %eax,(%edx)
+}
+  80155b:	89 c8                	mov    %ecx,%eax
+  80155d:	5d                   	pop    %ebp
+  80155e:	c3                   	ret
+
+0080155f <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80155f:	55                   	push   %ebp
+  801560:	89 e5                	mov    %esp,%ebp
+  801562:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  801565:	83 f8 1f             	cmp    $0x1f,%eax
+  801568:	77 30                	ja     80159a <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  80156a:	c1 e0 0c             	shl    $0xc,%eax
+  80156d:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801572:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801578:	f6 c2 01             	test   $0x1,%dl
+  80157b:	74 24                	je     8015a1 <fd_lookup+0x42>
+  80157d:	89 c2                	mov    %eax,%edx
+  80157f:	c1 ea 0c             	shr    $0xc,%edx
+  801582:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801589:	f6 c2 01             	test   $0x1,%dl
+  80158c:	74 1a                	je     8015a8 <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  80158e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801591:	89 02                	mov    %eax,(%edx)
+  return 0;
+  801593:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801598:	5d                   	pop    %ebp
+  801599:	c3                   	ret
+    return -E_INVAL;
+  80159a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80159f:	eb f7                	jmp    801598 <fd_lookup+0x39>
+    return -E_INVAL;
+  8015a1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015a6:	eb f0                	jmp    801598 <fd_lookup+0x39>
+  8015a8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015ad:	eb e9                	jmp    801598 <fd_lookup+0x39>
+
+008015af <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8015af:	55                   	push   %ebp
+  8015b0:	89 e5                	mov    %esp,%ebp
+  8015b2:	53                   	push   %ebx
+  8015b3:	83 ec 04             	sub    $0x4,%esp
+  8015b6:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  8015b9:	b8 58 3e 80 00       	mov    $0x803e58,%eax
+  8015be:	8b 18                	mov    (%eax),%ebx
+  8015c0:	85 db                	test   %ebx,%ebx
+  8015c2:	74 0e                	je     8015d2 <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  8015c4:	83 c0 04             	add    $0x4,%eax
+  8015c7:	39 13                	cmp    %edx,(%ebx)
+  8015c9:	75 f3                	jne    8015be <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  8015cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015d0:	eb 1f                	jmp    8015f1 <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8015d2:	a1 a0 58 80 00       	mov    0x8058a0,%eax
+  8015d7:	8b 40 48             	mov    0x48(%eax),%eax
+  8015da:	83 ec 04             	sub    $0x4,%esp
+  8015dd:	52                   	push   %edx
+  8015de:	50                   	push   %eax
+  8015df:	68 dc 3d 80 00       	push   $0x803ddc
+  8015e4:	e8 fc eb ff ff       	call   8001e5 <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  8015e9:	83 c4 10             	add    $0x10,%esp
+  8015ec:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  8015f1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8015f4:	89 1a                	mov    %ebx,(%edx)
+}
+  8015f6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015f9:	c9                   	leave
+  8015fa:	c3                   	ret
+
+008015fb <fd_close>:
+{
+  8015fb:	55                   	push   %ebp
+  8015fc:	89 e5                	mov    %esp,%ebp
+  8015fe:	57                   	push   %edi
+  8015ff:	56                   	push   %esi
+  801600:	53                   	push   %ebx
+  801601:	83 ec 24             	sub    $0x24,%esp
+  801604:	8b 75 08             	mov    0x8(%ebp),%esi
+  801607:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80160a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80160d:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80160e:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801614:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801617:	50                   	push   %eax
+  801618:	e8 42 ff ff ff       	call   80155f <fd_lookup>
+  80161d:	89 c3                	mov    %eax,%ebx
+  80161f:	83 c4 10             	add    $0x10,%esp
+  801622:	85 c0                	test   %eax,%eax
+  801624:	78 05                	js     80162b <fd_close+0x30>
+      || fd != fd2)
+  801626:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801629:	74 16                	je     801641 <fd_close+0x46>
+    return must_exist ? r : 0;
+  80162b:	89 f8                	mov    %edi,%eax
+  80162d:	84 c0                	test   %al,%al
+  80162f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801634:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801637:	89 d8                	mov    %ebx,%eax
+  801639:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80163c:	5b                   	pop    %ebx
+  80163d:	5e                   	pop    %esi
+  80163e:	5f                   	pop    %edi
+  80163f:	5d                   	pop    %ebp
+  801640:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801641:	83 ec 08             	sub    $0x8,%esp
+  801644:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801647:	50                   	push   %eax
+  801648:	ff 36                	push   (%esi)
+  80164a:	e8 60 ff ff ff       	call   8015af <dev_lookup>
+  80164f:	89 c3                	mov    %eax,%ebx
+  801651:	83 c4 10             	add    $0x10,%esp
+  801654:	85 c0                	test   %eax,%eax
+  801656:	78 1a                	js     801672 <fd_close+0x77>
+    if (dev->dev_close)
+  801658:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80165b:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  80165e:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  801663:	85 c0                	test   %eax,%eax
+  801665:	74 0b                	je     801672 <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  801667:	83 ec 0c             	sub    $0xc,%esp
+  80166a:	56                   	push   %esi
+  80166b:	ff d0                	call   *%eax
+  80166d:	89 c3                	mov    %eax,%ebx
+  80166f:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  801672:	83 ec 08             	sub    $0x8,%esp
+  801675:	56                   	push   %esi
+  801676:	6a 00                	push   $0x0
+  801678:	e8 0a f6 ff ff       	call   800c87 <sys_page_unmap>
+  return r;
+  80167d:	83 c4 10             	add    $0x10,%esp
+  801680:	eb b5                	jmp    801637 <fd_close+0x3c>
+
+00801682 <close>:
+
+int
+close(int fdnum)
+{
+  801682:	55                   	push   %ebp
+  801683:	89 e5                	mov    %esp,%ebp
+  801685:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801688:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80168b:	50                   	push   %eax
+  80168c:	ff 75 08             	push   0x8(%ebp)
+  80168f:	e8 cb fe ff ff       	call   80155f <fd_lookup>
+  801694:	83 c4 10             	add    $0x10,%esp
+  801697:	85 c0                	test   %eax,%eax
+  801699:	79 02                	jns    80169d <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  80169b:	c9                   	leave
+  80169c:	c3                   	ret
+    return fd_close(fd, 1);
+  80169d:	83 ec 08             	sub    $0x8,%esp
+  8016a0:	6a 01                	push   $0x1
+  8016a2:	ff 75 f4             	push   -0xc(%ebp)
+  8016a5:	e8 51 ff ff ff       	call   8015fb <fd_close>
+  8016aa:	83 c4 10             	add    $0x10,%esp
+  8016ad:	eb ec                	jmp    80169b <close+0x19>
+
+008016af <close_all>:
+
+void
+close_all(void)
+{
+  8016af:	55                   	push   %ebp
+  8016b0:	89 e5                	mov    %esp,%ebp
+  8016b2:	53                   	push   %ebx
+  8016b3:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  8016b6:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  8016bb:	83 ec 0c             	sub    $0xc,%esp
+  8016be:	53                   	push   %ebx
+  8016bf:	e8 be ff ff ff       	call   801682 <close>
+  for (i = 0; i < MAXFD; i++)
+  8016c4:	83 c3 01             	add    $0x1,%ebx
+  8016c7:	83 c4 10             	add    $0x10,%esp
+  8016ca:	83 fb 20             	cmp    $0x20,%ebx
+  8016cd:	75 ec                	jne    8016bb <close_all+0xc>
+}
+  8016cf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8016d2:	c9                   	leave
+  8016d3:	c3                   	ret
+
+008016d4 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8016d4:	55                   	push   %ebp
+  8016d5:	89 e5                	mov    %esp,%ebp
+  8016d7:	57                   	push   %edi
+  8016d8:	56                   	push   %esi
+  8016d9:	53                   	push   %ebx
+  8016da:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8016dd:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8016e0:	50                   	push   %eax
+  8016e1:	ff 75 08             	push   0x8(%ebp)
+  8016e4:	e8 76 fe ff ff       	call   80155f <fd_lookup>
+  8016e9:	89 c6                	mov    %eax,%esi
+  8016eb:	83 c4 10             	add    $0x10,%esp
+  8016ee:	85 c0                	test   %eax,%eax
+  8016f0:	0f 88 0a 01 00 00    	js     801800 <dup+0x12c>
+    return r;
+  close(newfdnum);
+  8016f6:	83 ec 0c             	sub    $0xc,%esp
+  8016f9:	ff 75 0c             	push   0xc(%ebp)
+  8016fc:	e8 81 ff ff ff       	call   801682 <close>
+
+  newfd = INDEX2FD(newfdnum);
+  801701:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801704:	c1 e0 0c             	shl    $0xc,%eax
+  801707:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  80170d:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  801710:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801713:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  801716:	89 04 24             	mov    %eax,(%esp)
+  801719:	e8 d7 fd ff ff       	call   8014f5 <fd2data>
+  80171e:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  801720:	89 3c 24             	mov    %edi,(%esp)
+  801723:	e8 cd fd ff ff       	call   8014f5 <fd2data>
+  801728:	83 c4 10             	add    $0x10,%esp
+  80172b:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80172e:	89 f3                	mov    %esi,%ebx
+  801730:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  801736:	89 c6                	mov    %eax,%esi
+  801738:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80173b:	89 cf                	mov    %ecx,%edi
+  80173d:	eb 0c                	jmp    80174b <dup+0x77>
+  80173f:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801745:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80174b:	39 fb                	cmp    %edi,%ebx
+  80174d:	74 7b                	je     8017ca <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  80174f:	89 d8                	mov    %ebx,%eax
+  801751:	c1 e8 16             	shr    $0x16,%eax
+  801754:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80175b:	a8 01                	test   $0x1,%al
+  80175d:	74 e0                	je     80173f <dup+0x6b>
+  80175f:	89 d8                	mov    %ebx,%eax
+  801761:	c1 e8 0c             	shr    $0xc,%eax
+  801764:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80176b:	f6 c2 01             	test   $0x1,%dl
+  80176e:	74 cf                	je     80173f <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  801770:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  801777:	83 ec 0c             	sub    $0xc,%esp
+  80177a:	25 07 0e 00 00       	and    $0xe07,%eax
+  80177f:	50                   	push   %eax
+  801780:	56                   	push   %esi
+  801781:	6a 00                	push   $0x0
+  801783:	53                   	push   %ebx
+  801784:	6a 00                	push   $0x0
+  801786:	e8 ba f4 ff ff       	call   800c45 <sys_page_map>
+  80178b:	83 c4 20             	add    $0x20,%esp
+  80178e:	85 c0                	test   %eax,%eax
+  801790:	79 ad                	jns    80173f <dup+0x6b>
+  801792:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801795:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  801797:	83 ec 08             	sub    $0x8,%esp
+  80179a:	ff 75 d4             	push   -0x2c(%ebp)
+  80179d:	6a 00                	push   $0x0
+  80179f:	e8 e3 f4 ff ff       	call   800c87 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8017a4:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  8017a7:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  8017ad:	83 c4 10             	add    $0x10,%esp
+  8017b0:	39 df                	cmp    %ebx,%edi
+  8017b2:	74 4c                	je     801800 <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  8017b4:	83 ec 08             	sub    $0x8,%esp
+  8017b7:	57                   	push   %edi
+  8017b8:	6a 00                	push   $0x0
+  8017ba:	e8 c8 f4 ff ff       	call   800c87 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8017bf:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  8017c5:	83 c4 10             	add    $0x10,%esp
+  8017c8:	eb e6                	jmp    8017b0 <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8017ca:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8017cd:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8017d0:	89 c8                	mov    %ecx,%eax
+  8017d2:	c1 e8 0c             	shr    $0xc,%eax
+  8017d5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8017dc:	83 ec 0c             	sub    $0xc,%esp
+  8017df:	25 07 0e 00 00       	and    $0xe07,%eax
+  8017e4:	50                   	push   %eax
+  8017e5:	ff 75 d4             	push   -0x2c(%ebp)
+  8017e8:	6a 00                	push   $0x0
+  8017ea:	51                   	push   %ecx
+  8017eb:	6a 00                	push   $0x0
+  8017ed:	e8 53 f4 ff ff       	call   800c45 <sys_page_map>
+  8017f2:	89 c6                	mov    %eax,%esi
+  8017f4:	83 c4 20             	add    $0x20,%esp
+  8017f7:	85 c0                	test   %eax,%eax
+  8017f9:	78 9c                	js     801797 <dup+0xc3>
+  return newfdnum;
+  8017fb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8017fe:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  801800:	89 f0                	mov    %esi,%eax
+  801802:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801805:	5b                   	pop    %ebx
+  801806:	5e                   	pop    %esi
+  801807:	5f                   	pop    %edi
+  801808:	5d                   	pop    %ebp
+  801809:	c3                   	ret
+
+0080180a <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80180a:	55                   	push   %ebp
+  80180b:	89 e5                	mov    %esp,%ebp
+  80180d:	56                   	push   %esi
+  80180e:	53                   	push   %ebx
+  80180f:	83 ec 18             	sub    $0x18,%esp
+  801812:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801815:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801818:	50                   	push   %eax
+  801819:	56                   	push   %esi
+  80181a:	e8 40 fd ff ff       	call   80155f <fd_lookup>
+  80181f:	83 c4 10             	add    $0x10,%esp
+  801822:	85 c0                	test   %eax,%eax
+  801824:	78 3c                	js     801862 <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801826:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801829:	83 ec 08             	sub    $0x8,%esp
+  80182c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80182f:	50                   	push   %eax
+  801830:	ff 33                	push   (%ebx)
+  801832:	e8 78 fd ff ff       	call   8015af <dev_lookup>
+  801837:	83 c4 10             	add    $0x10,%esp
+  80183a:	85 c0                	test   %eax,%eax
+  80183c:	78 24                	js     801862 <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80183e:	8b 43 08             	mov    0x8(%ebx),%eax
+  801841:	83 e0 03             	and    $0x3,%eax
+  801844:	83 f8 01             	cmp    $0x1,%eax
+  801847:	74 20                	je     801869 <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  801849:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80184c:	8b 40 08             	mov    0x8(%eax),%eax
+  80184f:	85 c0                	test   %eax,%eax
+  801851:	74 37                	je     80188a <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  801853:	83 ec 04             	sub    $0x4,%esp
+  801856:	ff 75 10             	push   0x10(%ebp)
+  801859:	ff 75 0c             	push   0xc(%ebp)
+  80185c:	53                   	push   %ebx
+  80185d:	ff d0                	call   *%eax
+  80185f:	83 c4 10             	add    $0x10,%esp
+}
+  801862:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801865:	5b                   	pop    %ebx
+  801866:	5e                   	pop    %esi
+  801867:	5d                   	pop    %ebp
+  801868:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801869:	a1 a0 58 80 00       	mov    0x8058a0,%eax
+  80186e:	8b 40 48             	mov    0x48(%eax),%eax
+  801871:	83 ec 04             	sub    $0x4,%esp
+  801874:	56                   	push   %esi
+  801875:	50                   	push   %eax
+  801876:	68 1d 3e 80 00       	push   $0x803e1d
+  80187b:	e8 65 e9 ff ff       	call   8001e5 <cprintf>
+    return -E_INVAL;
+  801880:	83 c4 10             	add    $0x10,%esp
+  801883:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801888:	eb d8                	jmp    801862 <read+0x58>
+    return -E_NOT_SUPP;
+  80188a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80188f:	eb d1                	jmp    801862 <read+0x58>
+
+00801891 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801891:	55                   	push   %ebp
+  801892:	89 e5                	mov    %esp,%ebp
+  801894:	57                   	push   %edi
+  801895:	56                   	push   %esi
+  801896:	53                   	push   %ebx
+  801897:	83 ec 0c             	sub    $0xc,%esp
+  80189a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80189d:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  8018a0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018a5:	eb 02                	jmp    8018a9 <readn+0x18>
+  8018a7:	01 c3                	add    %eax,%ebx
+  8018a9:	39 f3                	cmp    %esi,%ebx
+  8018ab:	73 21                	jae    8018ce <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  8018ad:	83 ec 04             	sub    $0x4,%esp
+  8018b0:	89 f0                	mov    %esi,%eax
+  8018b2:	29 d8                	sub    %ebx,%eax
+  8018b4:	50                   	push   %eax
+  8018b5:	89 d8                	mov    %ebx,%eax
+  8018b7:	03 45 0c             	add    0xc(%ebp),%eax
+  8018ba:	50                   	push   %eax
+  8018bb:	57                   	push   %edi
+  8018bc:	e8 49 ff ff ff       	call   80180a <read>
+    if (m < 0)
+  8018c1:	83 c4 10             	add    $0x10,%esp
+  8018c4:	85 c0                	test   %eax,%eax
+  8018c6:	78 04                	js     8018cc <readn+0x3b>
+      return m;
+    if (m == 0)
+  8018c8:	75 dd                	jne    8018a7 <readn+0x16>
+  8018ca:	eb 02                	jmp    8018ce <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  8018cc:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  8018ce:	89 d8                	mov    %ebx,%eax
+  8018d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018d3:	5b                   	pop    %ebx
+  8018d4:	5e                   	pop    %esi
+  8018d5:	5f                   	pop    %edi
+  8018d6:	5d                   	pop    %ebp
+  8018d7:	c3                   	ret
+
+008018d8 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8018d8:	55                   	push   %ebp
+  8018d9:	89 e5                	mov    %esp,%ebp
+  8018db:	56                   	push   %esi
+  8018dc:	53                   	push   %ebx
+  8018dd:	83 ec 18             	sub    $0x18,%esp
+  8018e0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  8018e3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018e6:	50                   	push   %eax
+  8018e7:	53                   	push   %ebx
+  8018e8:	e8 72 fc ff ff       	call   80155f <fd_lookup>
+  8018ed:	83 c4 10             	add    $0x10,%esp
+  8018f0:	85 c0                	test   %eax,%eax
+  8018f2:	78 37                	js     80192b <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8018f4:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8018f7:	83 ec 08             	sub    $0x8,%esp
+  8018fa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018fd:	50                   	push   %eax
+  8018fe:	ff 36                	push   (%esi)
+  801900:	e8 aa fc ff ff       	call   8015af <dev_lookup>
+  801905:	83 c4 10             	add    $0x10,%esp
+  801908:	85 c0                	test   %eax,%eax
+  80190a:	78 1f                	js     80192b <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80190c:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801910:	74 20                	je     801932 <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  801912:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801915:	8b 40 0c             	mov    0xc(%eax),%eax
+  801918:	85 c0                	test   %eax,%eax
+  80191a:	74 37                	je     801953 <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  80191c:	83 ec 04             	sub    $0x4,%esp
+  80191f:	ff 75 10             	push   0x10(%ebp)
+  801922:	ff 75 0c             	push   0xc(%ebp)
+  801925:	56                   	push   %esi
+  801926:	ff d0                	call   *%eax
+  801928:	83 c4 10             	add    $0x10,%esp
+}
+  80192b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80192e:	5b                   	pop    %ebx
+  80192f:	5e                   	pop    %esi
+  801930:	5d                   	pop    %ebp
+  801931:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801932:	a1 a0 58 80 00       	mov    0x8058a0,%eax
+  801937:	8b 40 48             	mov    0x48(%eax),%eax
+  80193a:	83 ec 04             	sub    $0x4,%esp
+  80193d:	53                   	push   %ebx
+  80193e:	50                   	push   %eax
+  80193f:	68 39 3e 80 00       	push   $0x803e39
+  801944:	e8 9c e8 ff ff       	call   8001e5 <cprintf>
+    return -E_INVAL;
+  801949:	83 c4 10             	add    $0x10,%esp
+  80194c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801951:	eb d8                	jmp    80192b <write+0x53>
+    return -E_NOT_SUPP;
+  801953:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801958:	eb d1                	jmp    80192b <write+0x53>
+
+0080195a <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80195a:	55                   	push   %ebp
+  80195b:	89 e5                	mov    %esp,%ebp
+  80195d:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801960:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801963:	50                   	push   %eax
+  801964:	ff 75 08             	push   0x8(%ebp)
+  801967:	e8 f3 fb ff ff       	call   80155f <fd_lookup>
+  80196c:	83 c4 10             	add    $0x10,%esp
+  80196f:	85 c0                	test   %eax,%eax
+  801971:	78 0e                	js     801981 <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  801973:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801976:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801979:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  80197c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801981:	c9                   	leave
+  801982:	c3                   	ret
+
+00801983 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801983:	55                   	push   %ebp
+  801984:	89 e5                	mov    %esp,%ebp
+  801986:	56                   	push   %esi
+  801987:	53                   	push   %ebx
+  801988:	83 ec 18             	sub    $0x18,%esp
+  80198b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  80198e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801991:	50                   	push   %eax
+  801992:	53                   	push   %ebx
+  801993:	e8 c7 fb ff ff       	call   80155f <fd_lookup>
+  801998:	83 c4 10             	add    $0x10,%esp
+  80199b:	85 c0                	test   %eax,%eax
+  80199d:	78 34                	js     8019d3 <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80199f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8019a2:	83 ec 08             	sub    $0x8,%esp
+  8019a5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019a8:	50                   	push   %eax
+  8019a9:	ff 36                	push   (%esi)
+  8019ab:	e8 ff fb ff ff       	call   8015af <dev_lookup>
+  8019b0:	83 c4 10             	add    $0x10,%esp
+  8019b3:	85 c0                	test   %eax,%eax
+  8019b5:	78 1c                	js     8019d3 <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8019b7:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8019bb:	74 1d                	je     8019da <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  8019bd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019c0:	8b 40 18             	mov    0x18(%eax),%eax
+  8019c3:	85 c0                	test   %eax,%eax
+  8019c5:	74 34                	je     8019fb <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  8019c7:	83 ec 08             	sub    $0x8,%esp
+  8019ca:	ff 75 0c             	push   0xc(%ebp)
+  8019cd:	56                   	push   %esi
+  8019ce:	ff d0                	call   *%eax
+  8019d0:	83 c4 10             	add    $0x10,%esp
+}
+  8019d3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019d6:	5b                   	pop    %ebx
+  8019d7:	5e                   	pop    %esi
+  8019d8:	5d                   	pop    %ebp
+  8019d9:	c3                   	ret
+            thisenv->env_id, fdnum);
+  8019da:	a1 a0 58 80 00       	mov    0x8058a0,%eax
+  8019df:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8019e2:	83 ec 04             	sub    $0x4,%esp
+  8019e5:	53                   	push   %ebx
+  8019e6:	50                   	push   %eax
+  8019e7:	68 fc 3d 80 00       	push   $0x803dfc
+  8019ec:	e8 f4 e7 ff ff       	call   8001e5 <cprintf>
+    return -E_INVAL;
+  8019f1:	83 c4 10             	add    $0x10,%esp
+  8019f4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019f9:	eb d8                	jmp    8019d3 <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  8019fb:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a00:	eb d1                	jmp    8019d3 <ftruncate+0x50>
+
+00801a02 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801a02:	55                   	push   %ebp
+  801a03:	89 e5                	mov    %esp,%ebp
+  801a05:	56                   	push   %esi
+  801a06:	53                   	push   %ebx
+  801a07:	83 ec 18             	sub    $0x18,%esp
+  801a0a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a0d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a10:	50                   	push   %eax
+  801a11:	ff 75 08             	push   0x8(%ebp)
+  801a14:	e8 46 fb ff ff       	call   80155f <fd_lookup>
+  801a19:	83 c4 10             	add    $0x10,%esp
+  801a1c:	85 c0                	test   %eax,%eax
+  801a1e:	78 49                	js     801a69 <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801a20:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801a23:	83 ec 08             	sub    $0x8,%esp
+  801a26:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a29:	50                   	push   %eax
+  801a2a:	ff 36                	push   (%esi)
+  801a2c:	e8 7e fb ff ff       	call   8015af <dev_lookup>
+  801a31:	83 c4 10             	add    $0x10,%esp
+  801a34:	85 c0                	test   %eax,%eax
+  801a36:	78 31                	js     801a69 <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  801a38:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a3b:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801a3f:	74 2f                	je     801a70 <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  801a41:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  801a44:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801a4b:	00 00 00 
+  stat->st_isdir = 0;
+  801a4e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801a55:	00 00 00 
+  stat->st_dev = dev;
+  801a58:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  801a5e:	83 ec 08             	sub    $0x8,%esp
+  801a61:	53                   	push   %ebx
+  801a62:	56                   	push   %esi
+  801a63:	ff 50 14             	call   *0x14(%eax)
+  801a66:	83 c4 10             	add    $0x10,%esp
+}
+  801a69:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a6c:	5b                   	pop    %ebx
+  801a6d:	5e                   	pop    %esi
+  801a6e:	5d                   	pop    %ebp
+  801a6f:	c3                   	ret
+    return -E_NOT_SUPP;
+  801a70:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a75:	eb f2                	jmp    801a69 <fstat+0x67>
+
+00801a77 <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  801a77:	55                   	push   %ebp
+  801a78:	89 e5                	mov    %esp,%ebp
+  801a7a:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  801a7d:	ff 75 0c             	push   0xc(%ebp)
+  801a80:	ff 75 08             	push   0x8(%ebp)
+  801a83:	e8 58 07 00 00       	call   8021e0 <file_stat>
+}
+  801a88:	c9                   	leave
+  801a89:	c3                   	ret
+
+00801a8a <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  801a8a:	55                   	push   %ebp
+  801a8b:	89 e5                	mov    %esp,%ebp
+  801a8d:	57                   	push   %edi
+  801a8e:	56                   	push   %esi
+  801a8f:	53                   	push   %ebx
+  801a90:	83 ec 1c             	sub    $0x1c,%esp
+  801a93:	89 c7                	mov    %eax,%edi
+  801a95:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801a98:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801a9b:	e9 a2 00 00 00       	jmp    801b42 <fsipc_send+0xb8>
+  nfsenvs = 0;
+  801aa0:	c7 05 00 50 80 00 00 	movl   $0x0,0x805000
+  801aa7:	00 00 00 
+  801aaa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801aaf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801ab4:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801ab9:	be 01 00 00 00       	mov    $0x1,%esi
+  801abe:	eb 0f                	jmp    801acf <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801ac0:	83 c0 01             	add    $0x1,%eax
+  801ac3:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801ac8:	74 49                	je     801b13 <fsipc_send+0x89>
+  801aca:	83 f9 07             	cmp    $0x7,%ecx
+  801acd:	7f 50                	jg     801b1f <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  801acf:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801ad2:	c1 e2 04             	shl    $0x4,%edx
+  801ad5:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801adb:	8b 52 50             	mov    0x50(%edx),%edx
+  801ade:	83 fa 01             	cmp    $0x1,%edx
+  801ae1:	75 dd                	jne    801ac0 <fsipc_send+0x36>
+  801ae3:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801ae6:	c1 e2 04             	shl    $0x4,%edx
+  801ae9:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801aef:	8b 52 54             	mov    0x54(%edx),%edx
+  801af2:	85 d2                	test   %edx,%edx
+  801af4:	74 ca                	je     801ac0 <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801af6:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801af9:	c1 e2 04             	shl    $0x4,%edx
+  801afc:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801b02:	8b 52 48             	mov    0x48(%edx),%edx
+  801b05:	89 14 8d 20 50 80 00 	mov    %edx,0x805020(,%ecx,4)
+  801b0c:	8d 49 01             	lea    0x1(%ecx),%ecx
+  801b0f:	89 f3                	mov    %esi,%ebx
+  801b11:	eb ad                	jmp    801ac0 <fsipc_send+0x36>
+  801b13:	84 db                	test   %bl,%bl
+  801b15:	74 38                	je     801b4f <fsipc_send+0xc5>
+  801b17:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  801b1d:	eb 30                	jmp    801b4f <fsipc_send+0xc5>
+  801b1f:	84 db                	test   %bl,%bl
+  801b21:	74 2c                	je     801b4f <fsipc_send+0xc5>
+  801b23:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  801b29:	eb 24                	jmp    801b4f <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  801b2b:	50                   	push   %eax
+  801b2c:	68 68 3e 80 00       	push   $0x803e68
+  801b31:	6a 34                	push   $0x34
+  801b33:	68 72 3e 80 00       	push   $0x803e72
+  801b38:	e8 cd 19 00 00       	call   80350a <_panic>
+    }
+    sys_yield();
+  801b3d:	e8 5e f0 ff ff       	call   800ba0 <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  801b42:	83 3d 00 50 80 00 03 	cmpl   $0x3,0x805000
+  801b49:	0f 8e 51 ff ff ff    	jle    801aa0 <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  801b4f:	a1 a0 58 80 00       	mov    0x8058a0,%eax
+  801b54:	8b 70 48             	mov    0x48(%eax),%esi
+  801b57:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  801b5d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b62:	8b 0d 00 50 80 00    	mov    0x805000,%ecx
+  801b68:	39 d9                	cmp    %ebx,%ecx
+  801b6a:	7e d1                	jle    801b3d <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  801b6c:	83 ec 0c             	sub    $0xc,%esp
+  801b6f:	ff 75 e0             	push   -0x20(%ebp)
+  801b72:	6a 07                	push   $0x7
+  801b74:	ff 75 e4             	push   -0x1c(%ebp)
+  801b77:	57                   	push   %edi
+  801b78:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  801b7b:	99                   	cltd
+  801b7c:	f7 f9                	idiv   %ecx
+  801b7e:	ff 34 95 20 50 80 00 	push   0x805020(,%edx,4)
+  801b85:	e8 2f f3 ff ff       	call   800eb9 <sys_ipc_try_send>
+      if (r == 0)
+  801b8a:	83 c4 20             	add    $0x20,%esp
+  801b8d:	85 c0                	test   %eax,%eax
+  801b8f:	74 0a                	je     801b9b <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  801b91:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801b94:	75 95                	jne    801b2b <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  801b96:	83 c3 01             	add    $0x1,%ebx
+  801b99:	eb c7                	jmp    801b62 <fsipc_send+0xd8>
+  }
+}
+  801b9b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b9e:	5b                   	pop    %ebx
+  801b9f:	5e                   	pop    %esi
+  801ba0:	5f                   	pop    %edi
+  801ba1:	5d                   	pop    %ebp
+  801ba2:	c3                   	ret
+
+00801ba3 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801ba3:	55                   	push   %ebp
+  801ba4:	89 e5                	mov    %esp,%ebp
+  801ba6:	53                   	push   %ebx
+  801ba7:	83 ec 14             	sub    $0x14,%esp
+  801baa:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  801bac:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  801bb3:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801bb8:	ba 00 60 80 00       	mov    $0x806000,%edx
+  801bbd:	e8 c8 fe ff ff       	call   801a8a <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801bc2:	6a 00                	push   $0x0
+  801bc4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bc7:	50                   	push   %eax
+  801bc8:	53                   	push   %ebx
+  801bc9:	6a 00                	push   $0x0
+  801bcb:	e8 ed 19 00 00       	call   8035bd <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  801bd0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bd3:	c9                   	leave
+  801bd4:	c3                   	ret
+
+00801bd5 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801bd5:	55                   	push   %ebp
+  801bd6:	89 e5                	mov    %esp,%ebp
+  801bd8:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801bdb:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bde:	8b 40 0c             	mov    0xc(%eax),%eax
+  801be1:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.set_size.req_size = newsize;
+  801be6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801be9:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801bee:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bf3:	b8 02 00 00 00       	mov    $0x2,%eax
+  801bf8:	e8 a6 ff ff ff       	call   801ba3 <fsipc>
+}
+  801bfd:	c9                   	leave
+  801bfe:	c3                   	ret
+
+00801bff <devfile_flush>:
+{
+  801bff:	55                   	push   %ebp
+  801c00:	89 e5                	mov    %esp,%ebp
+  801c02:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801c05:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c08:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c0b:	a3 00 60 80 00       	mov    %eax,0x806000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801c10:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c15:	b8 06 00 00 00       	mov    $0x6,%eax
+  801c1a:	e8 84 ff ff ff       	call   801ba3 <fsipc>
+}
+  801c1f:	c9                   	leave
+  801c20:	c3                   	ret
+
+00801c21 <devfile_stat>:
+{
+  801c21:	55                   	push   %ebp
+  801c22:	89 e5                	mov    %esp,%ebp
+  801c24:	53                   	push   %ebx
+  801c25:	83 ec 04             	sub    $0x4,%esp
+  801c28:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801c2b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c2e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c31:	a3 00 60 80 00       	mov    %eax,0x806000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801c36:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c3b:	b8 05 00 00 00       	mov    $0x5,%eax
+  801c40:	e8 5e ff ff ff       	call   801ba3 <fsipc>
+  801c45:	85 c0                	test   %eax,%eax
+  801c47:	78 2c                	js     801c75 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801c49:	83 ec 08             	sub    $0x8,%esp
+  801c4c:	68 00 60 80 00       	push   $0x806000
+  801c51:	53                   	push   %ebx
+  801c52:	e8 7c eb ff ff       	call   8007d3 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  801c57:	a1 80 60 80 00       	mov    0x806080,%eax
+  801c5c:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801c62:	a1 84 60 80 00       	mov    0x806084,%eax
+  801c67:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801c6d:	83 c4 10             	add    $0x10,%esp
+  801c70:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c75:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c78:	c9                   	leave
+  801c79:	c3                   	ret
+
+00801c7a <fsv_alloc>:
+{
+  801c7a:	55                   	push   %ebp
+  801c7b:	89 e5                	mov    %esp,%ebp
+  801c7d:	56                   	push   %esi
+  801c7e:	53                   	push   %ebx
+  801c7f:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  801c81:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c86:	eb 22                	jmp    801caa <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  801c88:	83 ec 04             	sub    $0x4,%esp
+  801c8b:	6a 00                	push   $0x0
+  801c8d:	6a 00                	push   $0x0
+  801c8f:	6a 07                	push   $0x7
+  801c91:	50                   	push   %eax
+  801c92:	6a 00                	push   $0x0
+  801c94:	6a 04                	push   $0x4
+  801c96:	68 40 50 80 00       	push   $0x805040
+  801c9b:	e8 b5 f3 ff ff       	call   801055 <sysbatch_add>
+  801ca0:	83 c4 20             	add    $0x20,%esp
+  801ca3:	85 c0                	test   %eax,%eax
+  801ca5:	78 48                	js     801cef <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  801ca7:	83 c3 01             	add    $0x1,%ebx
+  801caa:	39 f3                	cmp    %esi,%ebx
+  801cac:	74 31                	je     801cdf <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  801cae:	89 d8                	mov    %ebx,%eax
+  801cb0:	c1 e0 0c             	shl    $0xc,%eax
+  801cb3:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801cb8:	89 c2                	mov    %eax,%edx
+  801cba:	c1 ea 16             	shr    $0x16,%edx
+  801cbd:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801cc4:	f6 c2 01             	test   $0x1,%dl
+  801cc7:	74 bf                	je     801c88 <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  801cc9:	89 c2                	mov    %eax,%edx
+  801ccb:	c1 ea 0c             	shr    $0xc,%edx
+  801cce:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801cd5:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801cd8:	83 fa 03             	cmp    $0x3,%edx
+  801cdb:	75 ab                	jne    801c88 <fsv_alloc+0xe>
+  801cdd:	eb c8                	jmp    801ca7 <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  801cdf:	83 ec 0c             	sub    $0xc,%esp
+  801ce2:	68 40 50 80 00       	push   $0x805040
+  801ce7:	e8 19 f3 ff ff       	call   801005 <sysbatch_flush>
+  801cec:	83 c4 10             	add    $0x10,%esp
+}
+  801cef:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cf2:	5b                   	pop    %ebx
+  801cf3:	5e                   	pop    %esi
+  801cf4:	5d                   	pop    %ebp
+  801cf5:	c3                   	ret
+
+00801cf6 <devfile_read>:
+{
+  801cf6:	55                   	push   %ebp
+  801cf7:	89 e5                	mov    %esp,%ebp
+  801cf9:	57                   	push   %edi
+  801cfa:	56                   	push   %esi
+  801cfb:	53                   	push   %ebx
+  801cfc:	83 ec 3c             	sub    $0x3c,%esp
+  801cff:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  801d02:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  801d08:	77 57                	ja     801d61 <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801d0a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d0d:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d10:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read.req_n = n;
+  801d15:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801d1b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d20:	b8 03 00 00 00       	mov    $0x3,%eax
+  801d25:	e8 79 fe ff ff       	call   801ba3 <fsipc>
+  801d2a:	89 c6                	mov    %eax,%esi
+  801d2c:	85 c0                	test   %eax,%eax
+  801d2e:	78 27                	js     801d57 <devfile_read+0x61>
+  assert(r <= n);
+  801d30:	39 c3                	cmp    %eax,%ebx
+  801d32:	0f 82 0e 02 00 00    	jb     801f46 <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  801d38:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801d3d:	0f 8f 1c 02 00 00    	jg     801f5f <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801d43:	83 ec 04             	sub    $0x4,%esp
+  801d46:	50                   	push   %eax
+  801d47:	68 00 60 80 00       	push   $0x806000
+  801d4c:	ff 75 0c             	push   0xc(%ebp)
+  801d4f:	e8 05 ec ff ff       	call   800959 <memmove>
+  return r;
+  801d54:	83 c4 10             	add    $0x10,%esp
+}
+  801d57:	89 f0                	mov    %esi,%eax
+  801d59:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d5c:	5b                   	pop    %ebx
+  801d5d:	5e                   	pop    %esi
+  801d5e:	5f                   	pop    %edi
+  801d5f:	5d                   	pop    %ebp
+  801d60:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  801d61:	b8 01 00 00 00       	mov    $0x1,%eax
+  801d66:	e8 0f ff ff ff       	call   801c7a <fsv_alloc>
+  801d6b:	89 c6                	mov    %eax,%esi
+  801d6d:	85 c0                	test   %eax,%eax
+  801d6f:	78 e6                	js     801d57 <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  801d71:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d74:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d77:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  801d7c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d7f:	8b 40 04             	mov    0x4(%eax),%eax
+  801d82:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  801d87:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  801d8d:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801d94:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801d99:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801d9e:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801da3:	e8 e2 fc ff ff       	call   801a8a <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801da8:	6a 00                	push   $0x0
+  801daa:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801dad:	50                   	push   %eax
+  801dae:	68 00 10 c0 9f       	push   $0x9fc01000
+  801db3:	6a 00                	push   $0x0
+  801db5:	e8 03 18 00 00       	call   8035bd <ipc_recv_pages>
+  801dba:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  801dbc:	83 c4 10             	add    $0x10,%esp
+  801dbf:	85 c0                	test   %eax,%eax
+  801dc1:	7e 94                	jle    801d57 <devfile_read+0x61>
+  assert(r <= n);
+  801dc3:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801dc6:	39 c3                	cmp    %eax,%ebx
+  801dc8:	72 2e                	jb     801df8 <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801dca:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dcd:	8b 40 04             	mov    0x4(%eax),%eax
+  801dd0:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801dd5:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  801dd8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801ddb:	c1 e2 0c             	shl    $0xc,%edx
+  801dde:	39 ca                	cmp    %ecx,%edx
+  801de0:	72 2f                	jb     801e11 <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  801de2:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  801de7:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  801dea:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  801dee:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801df3:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  801df6:	eb 52                	jmp    801e4a <devfile_read+0x154>
+  assert(r <= n);
+  801df8:	68 7d 3e 80 00       	push   $0x803e7d
+  801dfd:	68 84 3e 80 00       	push   $0x803e84
+  801e02:	68 49 01 00 00       	push   $0x149
+  801e07:	68 72 3e 80 00       	push   $0x803e72
+  801e0c:	e8 f9 16 00 00       	call   80350a <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801e11:	68 a8 3e 80 00       	push   $0x803ea8
+  801e16:	68 84 3e 80 00       	push   $0x803e84
+  801e1b:	68 4a 01 00 00       	push   $0x14a
+  801e20:	68 72 3e 80 00       	push   $0x803e72
+  801e25:	e8 e0 16 00 00       	call   80350a <_panic>
+      memmove(dst + done, src + done, m);
+  801e2a:	83 ec 04             	sub    $0x4,%esp
+  801e2d:	53                   	push   %ebx
+  801e2e:	56                   	push   %esi
+  801e2f:	89 f8                	mov    %edi,%eax
+  801e31:	03 45 0c             	add    0xc(%ebp),%eax
+  801e34:	50                   	push   %eax
+  801e35:	e8 1f eb ff ff       	call   800959 <memmove>
+  801e3a:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  801e3d:	01 df                	add    %ebx,%edi
+  801e3f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801e42:	39 c7                	cmp    %eax,%edi
+  801e44:	0f 83 c0 00 00 00    	jae    801f0a <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801e4a:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801e4d:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  801e50:	89 f0                	mov    %esi,%eax
+  801e52:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801e57:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  801e5c:	29 c3                	sub    %eax,%ebx
+  801e5e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801e61:	29 f8                	sub    %edi,%eax
+  801e63:	39 c3                	cmp    %eax,%ebx
+  801e65:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  801e68:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801e6e:	75 ba                	jne    801e2a <devfile_read+0x134>
+  801e70:	89 f9                	mov    %edi,%ecx
+  801e72:	03 4d 0c             	add    0xc(%ebp),%ecx
+  801e75:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  801e78:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  801e7e:	75 aa                	jne    801e2a <devfile_read+0x134>
+  801e80:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  801e86:	77 a2                	ja     801e2a <devfile_read+0x134>
+  801e88:	89 c8                	mov    %ecx,%eax
+  801e8a:	c1 e8 16             	shr    $0x16,%eax
+  801e8d:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801e94:	a8 01                	test   $0x1,%al
+  801e96:	74 92                	je     801e2a <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  801e98:	89 c8                	mov    %ecx,%eax
+  801e9a:	c1 e8 0c             	shr    $0xc,%eax
+  801e9d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  801ea4:	a8 01                	test   $0x1,%al
+  801ea6:	74 82                	je     801e2a <devfile_read+0x134>
+  801ea8:	a9 02 08 00 00       	test   $0x802,%eax
+  801ead:	0f 84 77 ff ff ff    	je     801e2a <devfile_read+0x134>
+  801eb3:	f6 c4 04             	test   $0x4,%ah
+  801eb6:	0f 85 6e ff ff ff    	jne    801e2a <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  801ebc:	a1 a0 58 80 00       	mov    0x8058a0,%eax
+  801ec1:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  801ec5:	84 c0                	test   %al,%al
+  801ec7:	75 17                	jne    801ee0 <devfile_read+0x1ea>
+  801ec9:	83 ec 08             	sub    $0x8,%esp
+  801ecc:	6a 01                	push   $0x1
+  801ece:	6a 00                	push   $0x0
+  801ed0:	e8 ea ec ff ff       	call   800bbf <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  801ed5:	83 c4 10             	add    $0x10,%esp
+  801ed8:	85 c0                	test   %eax,%eax
+  801eda:	0f 85 4a ff ff ff    	jne    801e2a <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  801ee0:	83 ec 04             	sub    $0x4,%esp
+  801ee3:	68 05 08 00 00       	push   $0x805
+  801ee8:	ff 75 cc             	push   -0x34(%ebp)
+  801eeb:	6a 00                	push   $0x0
+  801eed:	56                   	push   %esi
+  801eee:	6a 00                	push   $0x0
+  801ef0:	6a 05                	push   $0x5
+  801ef2:	68 40 50 80 00       	push   $0x805040
+  801ef7:	e8 59 f1 ff ff       	call   801055 <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  801efc:	c1 e8 1f             	shr    $0x1f,%eax
+  801eff:	08 45 cb             	or     %al,-0x35(%ebp)
+  801f02:	83 c4 20             	add    $0x20,%esp
+  801f05:	e9 33 ff ff ff       	jmp    801e3d <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  801f0a:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  801f0d:	83 ec 0c             	sub    $0xc,%esp
+  801f10:	68 40 50 80 00       	push   $0x805040
+  801f15:	e8 eb f0 ff ff       	call   801005 <sysbatch_flush>
+  801f1a:	83 c4 10             	add    $0x10,%esp
+  801f1d:	85 c0                	test   %eax,%eax
+  801f1f:	78 06                	js     801f27 <devfile_read+0x231>
+  801f21:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  801f25:	74 14                	je     801f3b <devfile_read+0x245>
+    memmove(dst, src, r);
+  801f27:	83 ec 04             	sub    $0x4,%esp
+  801f2a:	ff 75 d4             	push   -0x2c(%ebp)
+  801f2d:	ff 75 d0             	push   -0x30(%ebp)
+  801f30:	ff 75 0c             	push   0xc(%ebp)
+  801f33:	e8 21 ea ff ff       	call   800959 <memmove>
+  801f38:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  801f3b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f3e:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  801f41:	e9 11 fe ff ff       	jmp    801d57 <devfile_read+0x61>
+  assert(r <= n);
+  801f46:	68 7d 3e 80 00       	push   $0x803e7d
+  801f4b:	68 84 3e 80 00       	push   $0x803e84
+  801f50:	68 1c 01 00 00       	push   $0x11c
+  801f55:	68 72 3e 80 00       	push   $0x803e72
+  801f5a:	e8 ab 15 00 00       	call   80350a <_panic>
+  assert(r <= PGSIZE);
+  801f5f:	68 99 3e 80 00       	push   $0x803e99
+  801f64:	68 84 3e 80 00       	push   $0x803e84
+  801f69:	68 1d 01 00 00       	push   $0x11d
+  801f6e:	68 72 3e 80 00       	push   $0x803e72
+  801f73:	e8 92 15 00 00       	call   80350a <_panic>
+
+00801f78 <devfile_write>:
+{
+  801f78:	55                   	push   %ebp
+  801f79:	89 e5                	mov    %esp,%ebp
+  801f7b:	57                   	push   %edi
+  801f7c:	56                   	push   %esi
+  801f7d:	53                   	push   %ebx
+  801f7e:	83 ec 1c             	sub    $0x1c,%esp
+  801f81:	8b 75 08             	mov    0x8(%ebp),%esi
+  801f84:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  801f87:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  801f8c:	77 39                	ja     801fc7 <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801f8e:	8b 56 0c             	mov    0xc(%esi),%edx
+  801f91:	89 15 00 60 80 00    	mov    %edx,0x806000
+  fsipcbuf.write.req_n = n;
+  801f97:	a3 04 60 80 00       	mov    %eax,0x806004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  801f9c:	83 ec 04             	sub    $0x4,%esp
+  801f9f:	50                   	push   %eax
+  801fa0:	ff 75 0c             	push   0xc(%ebp)
+  801fa3:	68 08 60 80 00       	push   $0x806008
+  801fa8:	e8 ac e9 ff ff       	call   800959 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801fad:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fb2:	b8 04 00 00 00       	mov    $0x4,%eax
+  801fb7:	e8 e7 fb ff ff       	call   801ba3 <fsipc>
+  801fbc:	83 c4 10             	add    $0x10,%esp
+}
+  801fbf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fc2:	5b                   	pop    %ebx
+  801fc3:	5e                   	pop    %esi
+  801fc4:	5f                   	pop    %edi
+  801fc5:	5d                   	pop    %ebp
+  801fc6:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  801fc7:	ba 00 00 10 00       	mov    $0x100000,%edx
+  801fcc:	39 d0                	cmp    %edx,%eax
+  801fce:	89 d3                	mov    %edx,%ebx
+  801fd0:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  801fd3:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  801fd9:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  801fdc:	83 c7 01             	add    $0x1,%edi
+  801fdf:	89 f8                	mov    %edi,%eax
+  801fe1:	e8 94 fc ff ff       	call   801c7a <fsv_alloc>
+  801fe6:	85 c0                	test   %eax,%eax
+  801fe8:	78 d5                	js     801fbf <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  801fea:	83 ec 04             	sub    $0x4,%esp
+  801fed:	53                   	push   %ebx
+  801fee:	ff 75 0c             	push   0xc(%ebp)
+  801ff1:	68 00 10 c0 9f       	push   $0x9fc01000
+  801ff6:	e8 5e e9 ff ff       	call   800959 <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  801ffb:	8b 46 0c             	mov    0xc(%esi),%eax
+  801ffe:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  802003:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  802009:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  802010:	89 f9                	mov    %edi,%ecx
+  802012:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  802017:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80201c:	e8 69 fa ff ff       	call   801a8a <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  802021:	6a 00                	push   $0x0
+  802023:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802026:	50                   	push   %eax
+  802027:	6a 00                	push   $0x0
+  802029:	6a 00                	push   $0x0
+  80202b:	e8 8d 15 00 00       	call   8035bd <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  802030:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  802033:	eb 8a                	jmp    801fbf <devfile_write+0x47>
+
+00802035 <open>:
+{
+  802035:	55                   	push   %ebp
+  802036:	89 e5                	mov    %esp,%ebp
+  802038:	56                   	push   %esi
+  802039:	53                   	push   %ebx
+  80203a:	83 ec 1c             	sub    $0x1c,%esp
+  80203d:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  802040:	56                   	push   %esi
+  802041:	e8 52 e7 ff ff       	call   800798 <strlen>
+  802046:	83 c4 10             	add    $0x10,%esp
+  802049:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80204e:	7f 6c                	jg     8020bc <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  802050:	83 ec 0c             	sub    $0xc,%esp
+  802053:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802056:	50                   	push   %eax
+  802057:	e8 ad f4 ff ff       	call   801509 <fd_alloc>
+  80205c:	89 c3                	mov    %eax,%ebx
+  80205e:	83 c4 10             	add    $0x10,%esp
+  802061:	85 c0                	test   %eax,%eax
+  802063:	78 3c                	js     8020a1 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  802065:	83 ec 08             	sub    $0x8,%esp
+  802068:	56                   	push   %esi
+  802069:	68 00 60 80 00       	push   $0x806000
+  80206e:	e8 60 e7 ff ff       	call   8007d3 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  802073:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802076:	a3 00 64 80 00       	mov    %eax,0x806400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80207b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80207e:	b8 01 00 00 00       	mov    $0x1,%eax
+  802083:	e8 1b fb ff ff       	call   801ba3 <fsipc>
+  802088:	89 c3                	mov    %eax,%ebx
+  80208a:	83 c4 10             	add    $0x10,%esp
+  80208d:	85 c0                	test   %eax,%eax
+  80208f:	78 19                	js     8020aa <open+0x75>
+  return fd2num(fd);
+  802091:	83 ec 0c             	sub    $0xc,%esp
+  802094:	ff 75 f4             	push   -0xc(%ebp)
+  802097:	e8 49 f4 ff ff       	call   8014e5 <fd2num>
+  80209c:	89 c3                	mov    %eax,%ebx
+  80209e:	83 c4 10             	add    $0x10,%esp
+}
+  8020a1:	89 d8                	mov    %ebx,%eax
+  8020a3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020a6:	5b                   	pop    %ebx
+  8020a7:	5e                   	pop    %esi
+  8020a8:	5d                   	pop    %ebp
+  8020a9:	c3                   	ret
+    fd_close(fd, 0);
+  8020aa:	83 ec 08             	sub    $0x8,%esp
+  8020ad:	6a 00                	push   $0x0
+  8020af:	ff 75 f4             	push   -0xc(%ebp)
+  8020b2:	e8 44 f5 ff ff       	call   8015fb <fd_close>
+    return r;
+  8020b7:	83 c4 10             	add    $0x10,%esp
+  8020ba:	eb e5                	jmp    8020a1 <open+0x6c>
+    return -E_BAD_PATH;
+  8020bc:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8020c1:	eb de                	jmp    8020a1 <open+0x6c>
+
+008020c3 <open_read>:
+{
+  8020c3:	55                   	push   %ebp
+  8020c4:	89 e5                	mov    %esp,%ebp
+  8020c6:	57                   	push   %edi
+  8020c7:	56                   	push   %esi
+  8020c8:	53                   	push   %ebx
+  8020c9:	83 ec 28             	sub    $0x28,%esp
+  8020cc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  8020cf:	57                   	push   %edi
+  8020d0:	e8 c3 e6 ff ff       	call   800798 <strlen>
+  8020d5:	83 c4 10             	add    $0x10,%esp
+  8020d8:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8020dd:	0f 87 f6 00 00 00    	ja     8021d9 <open_read+0x116>
+  8020e3:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  8020e5:	83 ec 0c             	sub    $0xc,%esp
+  8020e8:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8020eb:	50                   	push   %eax
+  8020ec:	e8 18 f4 ff ff       	call   801509 <fd_alloc>
+  8020f1:	89 c3                	mov    %eax,%ebx
+  8020f3:	83 c4 10             	add    $0x10,%esp
+  8020f6:	85 c0                	test   %eax,%eax
+  8020f8:	0f 88 b2 00 00 00    	js     8021b0 <open_read+0xed>
+  strcpy(req->req_buf, path);
+  8020fe:	83 ec 08             	sub    $0x8,%esp
+  802101:	57                   	push   %edi
+  802102:	68 e4 60 80 00       	push   $0x8060e4
+  802107:	e8 c7 e6 ff ff       	call   8007d3 <strcpy>
+  req->req_nops = 2;
+  80210c:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  802113:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  802116:	c7 05 04 60 80 00 01 	movl   $0x1,0x806004
+  80211d:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  802120:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802123:	a3 10 60 80 00       	mov    %eax,0x806010
+  req->req_ops[0].op_buf = 0;
+  802128:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  80212f:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  802132:	c7 05 20 60 80 00 04 	movl   $0x4,0x806020
+  802139:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  80213c:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  802143:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  802146:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  80214b:	29 f0                	sub    %esi,%eax
+  80214d:	3b 45 14             	cmp    0x14(%ebp),%eax
+  802150:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  802154:	a3 2c 60 80 00       	mov    %eax,0x80602c
+  req->req_ops[1].op_offset = 0;
+  802159:	c7 05 30 60 80 00 00 	movl   $0x0,0x806030
+  802160:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  802163:	83 c6 01             	add    $0x1,%esi
+  802166:	89 35 34 60 80 00    	mov    %esi,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  80216c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80216f:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802174:	e8 2a fa ff ff       	call   801ba3 <fsipc>
+  802179:	89 c3                	mov    %eax,%ebx
+  80217b:	83 c4 10             	add    $0x10,%esp
+  80217e:	83 f8 01             	cmp    $0x1,%eax
+  802181:	7e 37                	jle    8021ba <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  802183:	a1 38 60 80 00       	mov    0x806038,%eax
+  802188:	8b 55 18             	mov    0x18(%ebp),%edx
+  80218b:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  80218d:	83 ec 04             	sub    $0x4,%esp
+  802190:	50                   	push   %eax
+  802191:	81 c6 e4 60 80 00    	add    $0x8060e4,%esi
+  802197:	56                   	push   %esi
+  802198:	ff 75 10             	push   0x10(%ebp)
+  80219b:	e8 b9 e7 ff ff       	call   800959 <memmove>
+  return fd2num(fd);
+  8021a0:	83 c4 04             	add    $0x4,%esp
+  8021a3:	ff 75 e4             	push   -0x1c(%ebp)
+  8021a6:	e8 3a f3 ff ff       	call   8014e5 <fd2num>
+  8021ab:	89 c3                	mov    %eax,%ebx
+  8021ad:	83 c4 10             	add    $0x10,%esp
+}
+  8021b0:	89 d8                	mov    %ebx,%eax
+  8021b2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021b5:	5b                   	pop    %ebx
+  8021b6:	5e                   	pop    %esi
+  8021b7:	5f                   	pop    %edi
+  8021b8:	5d                   	pop    %ebp
+  8021b9:	c3                   	ret
+    fd_close(fd, 0);
+  8021ba:	83 ec 08             	sub    $0x8,%esp
+  8021bd:	6a 00                	push   $0x0
+  8021bf:	ff 75 e4             	push   -0x1c(%ebp)
+  8021c2:	e8 34 f4 ff ff       	call   8015fb <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  8021c7:	83 c4 10             	add    $0x10,%esp
+  8021ca:	85 db                	test   %ebx,%ebx
+  8021cc:	78 e2                	js     8021b0 <open_read+0xed>
+  8021ce:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  8021d1:	8b 9b 1c 60 80 00    	mov    0x80601c(%ebx),%ebx
+  8021d7:	eb d7                	jmp    8021b0 <open_read+0xed>
+    return -E_BAD_PATH;
+  8021d9:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8021de:	eb d0                	jmp    8021b0 <open_read+0xed>
+
+008021e0 <file_stat>:
+{
+  8021e0:	55                   	push   %ebp
+  8021e1:	89 e5                	mov    %esp,%ebp
+  8021e3:	57                   	push   %edi
+  8021e4:	56                   	push   %esi
+  8021e5:	53                   	push   %ebx
+  8021e6:	83 ec 18             	sub    $0x18,%esp
+  8021e9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8021ec:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  8021ef:	57                   	push   %edi
+  8021f0:	e8 a3 e5 ff ff       	call   800798 <strlen>
+  8021f5:	83 c4 10             	add    $0x10,%esp
+  8021f8:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8021fd:	0f 8f c7 00 00 00    	jg     8022ca <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  802203:	83 ec 0c             	sub    $0xc,%esp
+  802206:	57                   	push   %edi
+  802207:	e8 8c e5 ff ff       	call   800798 <strlen>
+  80220c:	8d 58 04             	lea    0x4(%eax),%ebx
+  80220f:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  802212:	83 c4 08             	add    $0x8,%esp
+  802215:	57                   	push   %edi
+  802216:	68 e4 60 80 00       	push   $0x8060e4
+  80221b:	e8 b3 e5 ff ff       	call   8007d3 <strcpy>
+  req->req_nops = 2;
+  802220:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  802227:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  80222a:	c7 05 04 60 80 00 02 	movl   $0x2,0x806004
+  802231:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  802234:	c7 05 10 60 80 00 00 	movl   $0x0,0x806010
+  80223b:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  80223e:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  802245:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  802248:	c7 05 20 60 80 00 03 	movl   $0x3,0x806020
+  80224f:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  802252:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  802259:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  80225c:	89 1d 34 60 80 00    	mov    %ebx,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  802262:	ba 00 00 00 00       	mov    $0x0,%edx
+  802267:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80226c:	e8 32 f9 ff ff       	call   801ba3 <fsipc>
+  802271:	83 c4 10             	add    $0x10,%esp
+  802274:	83 f8 01             	cmp    $0x1,%eax
+  802277:	7e 42                	jle    8022bb <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  802279:	81 c3 e4 60 80 00    	add    $0x8060e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  80227f:	83 ec 08             	sub    $0x8,%esp
+  802282:	53                   	push   %ebx
+  802283:	56                   	push   %esi
+  802284:	e8 4a e5 ff ff       	call   8007d3 <strcpy>
+  st->st_size = ret->ret_size;
+  802289:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  80228f:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  802295:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  80229b:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  8022a1:	c7 86 88 00 00 00 04 	movl   $0x804004,0x88(%esi)
+  8022a8:	40 80 00 
+  return 0;
+  8022ab:	83 c4 10             	add    $0x10,%esp
+  8022ae:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022b6:	5b                   	pop    %ebx
+  8022b7:	5e                   	pop    %esi
+  8022b8:	5f                   	pop    %edi
+  8022b9:	5d                   	pop    %ebp
+  8022ba:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  8022bb:	85 c0                	test   %eax,%eax
+  8022bd:	78 f4                	js     8022b3 <file_stat+0xd3>
+  8022bf:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8022c2:	8b 80 1c 60 80 00    	mov    0x80601c(%eax),%eax
+  8022c8:	eb e9                	jmp    8022b3 <file_stat+0xd3>
+    return -E_BAD_PATH;
+  8022ca:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8022cf:	eb e2                	jmp    8022b3 <file_stat+0xd3>
+
+008022d1 <read_map>:
+{
+  8022d1:	55                   	push   %ebp
+  8022d2:	89 e5                	mov    %esp,%ebp
+  8022d4:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8022d7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022da:	50                   	push   %eax
+  8022db:	ff 75 08             	push   0x8(%ebp)
+  8022de:	e8 7c f2 ff ff       	call   80155f <fd_lookup>
+  8022e3:	83 c4 10             	add    $0x10,%esp
+  8022e6:	85 c0                	test   %eax,%eax
+  8022e8:	78 2a                	js     802314 <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  8022ea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022ed:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  8022f3:	39 08                	cmp    %ecx,(%eax)
+  8022f5:	75 1f                	jne    802316 <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  8022f7:	8b 40 0c             	mov    0xc(%eax),%eax
+  8022fa:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read_map.req_offset = offset;
+  8022ff:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802302:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  802307:	8b 55 10             	mov    0x10(%ebp),%edx
+  80230a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80230f:	e8 8f f8 ff ff       	call   801ba3 <fsipc>
+}
+  802314:	c9                   	leave
+  802315:	c3                   	ret
+    return -E_INVAL;
+  802316:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80231b:	eb f7                	jmp    802314 <read_map+0x43>
+
+0080231d <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80231d:	55                   	push   %ebp
+  80231e:	89 e5                	mov    %esp,%ebp
+  802320:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  802323:	ba 00 00 00 00       	mov    $0x0,%edx
+  802328:	b8 08 00 00 00       	mov    $0x8,%eax
+  80232d:	e8 71 f8 ff ff       	call   801ba3 <fsipc>
+}
+  802332:	c9                   	leave
+  802333:	c3                   	ret
+
+00802334 <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  802334:	55                   	push   %ebp
+  802335:	89 e5                	mov    %esp,%ebp
+  802337:	57                   	push   %edi
+  802338:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  802339:	8b 45 08             	mov    0x8(%ebp),%eax
+  80233c:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.stats.req_bio_sched = 0;
+  802341:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  802348:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  80234b:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  802352:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  802355:	ba 00 00 00 00       	mov    $0x0,%edx
+  80235a:	b8 09 00 00 00       	mov    $0x9,%eax
+  80235f:	e8 3f f8 ff ff       	call   801ba3 <fsipc>
+  802364:	85 c0                	test   %eax,%eax
+  802366:	78 14                	js     80237c <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  802368:	be 00 60 80 00       	mov    $0x806000,%esi
+  80236d:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802372:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802375:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  802377:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80237c:	5e                   	pop    %esi
+  80237d:	5f                   	pop    %edi
+  80237e:	5d                   	pop    %ebp
+  80237f:	c3                   	ret
+
+00802380 <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  802380:	55                   	push   %ebp
+  802381:	89 e5                	mov    %esp,%ebp
+  802383:	53                   	push   %ebx
+  802384:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  802387:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  80238a:	50                   	push   %eax
+  80238b:	6a 00                	push   $0x0
+  80238d:	e8 a2 ff ff ff       	call   802334 <fs_stats>
+  802392:	83 c4 10             	add    $0x10,%esp
+  802395:	85 c0                	test   %eax,%eax
+  802397:	78 28                	js     8023c1 <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  802399:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  80239c:	83 ec 08             	sub    $0x8,%esp
+  80239f:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8023a2:	50                   	push   %eax
+  8023a3:	6a 20                	push   $0x20
+  8023a5:	e8 8a ff ff ff       	call   802334 <fs_stats>
+  8023aa:	83 c4 10             	add    $0x10,%esp
+  8023ad:	85 c0                	test   %eax,%eax
+  8023af:	78 10                	js     8023c1 <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  8023b1:	83 ec 08             	sub    $0x8,%esp
+  8023b4:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8023b7:	50                   	push   %eax
+  8023b8:	53                   	push   %ebx
+  8023b9:	e8 76 ff ff ff       	call   802334 <fs_stats>
+  8023be:	83 c4 10             	add    $0x10,%esp
+}
+  8023c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023c4:	c9                   	leave
+  8023c5:	c3                   	ret
+
+008023c6 <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  8023c6:	55                   	push   %ebp
+  8023c7:	89 e5                	mov    %esp,%ebp
+  8023c9:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  8023cc:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  8023d3:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  8023d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023d9:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.stats.req_dcache = 0;
+  8023de:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  8023e5:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  8023e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023ed:	b8 09 00 00 00       	mov    $0x9,%eax
+  8023f2:	e8 ac f7 ff ff       	call   801ba3 <fsipc>
+}
+  8023f7:	c9                   	leave
+  8023f8:	c3                   	ret
+
+008023f9 <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  8023f9:	55                   	push   %ebp
+  8023fa:	89 e5                	mov    %esp,%ebp
+  8023fc:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  8023ff:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  802406:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  802409:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  802410:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  802413:	8b 45 08             	mov    0x8(%ebp),%eax
+  802416:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_STATS, NULL);
+  80241b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802420:	b8 09 00 00 00       	mov    $0x9,%eax
+  802425:	e8 79 f7 ff ff       	call   801ba3 <fsipc>
+}
+  80242a:	c9                   	leave
+  80242b:	c3                   	ret
+
+0080242c <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  80242c:	55                   	push   %ebp
+  80242d:	89 e5                	mov    %esp,%ebp
+  80242f:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802432:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802435:	50                   	push   %eax
+  802436:	ff 75 08             	push   0x8(%ebp)
+  802439:	e8 21 f1 ff ff       	call   80155f <fd_lookup>
+  80243e:	83 c4 10             	add    $0x10,%esp
+  802441:	85 c0                	test   %eax,%eax
+  802443:	78 34                	js     802479 <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  802445:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802448:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  80244e:	39 08                	cmp    %ecx,(%eax)
+  802450:	75 29                	jne    80247b <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  802452:	8b 40 0c             	mov    0xc(%eax),%eax
+  802455:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.fallocate.req_offset = offset;
+  80245a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80245d:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.fallocate.req_len = len;
+  802462:	8b 45 10             	mov    0x10(%ebp),%eax
+  802465:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  80246a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80246f:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802474:	e8 2a f7 ff ff       	call   801ba3 <fsipc>
+}
+  802479:	c9                   	leave
+  80247a:	c3                   	ret
+    return -E_INVAL;
+  80247b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802480:	eb f7                	jmp    802479 <fallocate+0x4d>
+
+00802482 <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  802482:	55                   	push   %ebp
+  802483:	89 e5                	mov    %esp,%ebp
+  802485:	57                   	push   %edi
+  802486:	56                   	push   %esi
+  802487:	53                   	push   %ebx
+  802488:	83 ec 24             	sub    $0x24,%esp
+  80248b:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80248e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802491:	50                   	push   %eax
+  802492:	ff 75 08             	push   0x8(%ebp)
+  802495:	e8 c5 f0 ff ff       	call   80155f <fd_lookup>
+  80249a:	83 c4 10             	add    $0x10,%esp
+  80249d:	85 c0                	test   %eax,%eax
+  80249f:	78 66                	js     802507 <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  8024a1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8024a4:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  8024aa:	39 08                	cmp    %ecx,(%eax)
+  8024ac:	75 61                	jne    80250f <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  8024ae:	85 f6                	test   %esi,%esi
+  8024b0:	7e 50                	jle    802502 <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  8024b2:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  8024b7:	39 de                	cmp    %ebx,%esi
+  8024b9:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  8024bc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8024bf:	8b 40 0c             	mov    0xc(%eax),%eax
+  8024c2:	a3 00 60 80 00       	mov    %eax,0x806000
+    fsipcbuf.prefetch.req_n = m;
+  8024c7:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  8024cd:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  8024d4:	83 ec 04             	sub    $0x4,%esp
+  8024d7:	57                   	push   %edi
+  8024d8:	ff 75 0c             	push   0xc(%ebp)
+  8024db:	68 08 60 80 00       	push   $0x806008
+  8024e0:	e8 74 e4 ff ff       	call   800959 <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  8024e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024ea:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8024ef:	e8 af f6 ff ff       	call   801ba3 <fsipc>
+  8024f4:	83 c4 10             	add    $0x10,%esp
+  8024f7:	85 c0                	test   %eax,%eax
+  8024f9:	78 0c                	js     802507 <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  8024fb:	01 7d 0c             	add    %edi,0xc(%ebp)
+  8024fe:	29 de                	sub    %ebx,%esi
+  802500:	eb ac                	jmp    8024ae <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  802502:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802507:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80250a:	5b                   	pop    %ebx
+  80250b:	5e                   	pop    %esi
+  80250c:	5f                   	pop    %edi
+  80250d:	5d                   	pop    %ebp
+  80250e:	c3                   	ret
+    return -E_INVAL;
+  80250f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802514:	eb f1                	jmp    802507 <prefetch+0x85>
+
+00802516 <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  802516:	55                   	push   %ebp
+  802517:	89 e5                	mov    %esp,%ebp
+  802519:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  80251c:	50                   	push   %eax
+  80251d:	e8 d3 ef ff ff       	call   8014f5 <fd2data>
+  802522:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  802527:	c9                   	leave
+  802528:	c3                   	ret
+
+00802529 <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802529:	55                   	push   %ebp
+  80252a:	89 e5                	mov    %esp,%ebp
+  80252c:	56                   	push   %esi
+  80252d:	53                   	push   %ebx
+  80252e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  802531:	83 ec 0c             	sub    $0xc,%esp
+  802534:	ff 75 08             	push   0x8(%ebp)
+  802537:	e8 b9 ef ff ff       	call   8014f5 <fd2data>
+  80253c:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  80253e:	83 c4 08             	add    $0x8,%esp
+  802541:	68 d4 3e 80 00       	push   $0x803ed4
+  802546:	53                   	push   %ebx
+  802547:	e8 87 e2 ff ff       	call   8007d3 <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  80254c:	8b 46 04             	mov    0x4(%esi),%eax
+  80254f:	2b 06                	sub    (%esi),%eax
+  802551:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  802557:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80255e:	00 00 00 
+  stat->st_dev = &devpipe;
+  802561:	c7 83 88 00 00 00 20 	movl   $0x804020,0x88(%ebx)
+  802568:	40 80 00 
+  return 0;
+}
+  80256b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802570:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802573:	5b                   	pop    %ebx
+  802574:	5e                   	pop    %esi
+  802575:	5d                   	pop    %ebp
+  802576:	c3                   	ret
+
+00802577 <pipe_wakeup>:
+{
+  802577:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  802579:	b8 00 00 00 00       	mov    $0x0,%eax
+  80257e:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  802581:	85 c0                	test   %eax,%eax
+  802583:	75 01                	jne    802586 <pipe_wakeup+0xf>
+  802585:	c3                   	ret
+{
+  802586:	55                   	push   %ebp
+  802587:	89 e5                	mov    %esp,%ebp
+  802589:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  80258c:	6a 00                	push   $0x0
+  80258e:	68 00 00 c0 ee       	push   $0xeec00000
+  802593:	52                   	push   %edx
+  802594:	e8 c5 e9 ff ff       	call   800f5e <sys_chan_wakeup>
+  802599:	83 c4 10             	add    $0x10,%esp
+}
+  80259c:	c9                   	leave
+  80259d:	c3                   	ret
+
+0080259e <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80259e:	55                   	push   %ebp
+  80259f:	89 e5                	mov    %esp,%ebp
+  8025a1:	57                   	push   %edi
+  8025a2:	56                   	push   %esi
+  8025a3:	53                   	push   %ebx
+  8025a4:	83 ec 18             	sub    $0x18,%esp
+  8025a7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  8025aa:	57                   	push   %edi
+  8025ab:	e8 45 ef ff ff       	call   8014f5 <fd2data>
+  8025b0:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  8025b2:	83 c4 10             	add    $0x10,%esp
+  8025b5:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  8025b9:	74 2a                	je     8025e5 <devpipe_close+0x47>
+  8025bb:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  8025c0:	89 f8                	mov    %edi,%eax
+  8025c2:	e8 4f ff ff ff       	call   802516 <pipe_ring>
+  8025c7:	83 ec 08             	sub    $0x8,%esp
+  8025ca:	01 d8                	add    %ebx,%eax
+  8025cc:	50                   	push   %eax
+  8025cd:	6a 00                	push   $0x0
+  8025cf:	e8 b3 e6 ff ff       	call   800c87 <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  8025d4:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8025da:	83 c4 10             	add    $0x10,%esp
+  8025dd:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  8025e3:	75 db                	jne    8025c0 <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  8025e5:	83 ec 08             	sub    $0x8,%esp
+  8025e8:	57                   	push   %edi
+  8025e9:	6a 00                	push   $0x0
+  8025eb:	e8 97 e6 ff ff       	call   800c87 <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  8025f0:	83 c4 10             	add    $0x10,%esp
+  8025f3:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  8025f7:	75 13                	jne    80260c <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  8025f9:	83 ec 08             	sub    $0x8,%esp
+  8025fc:	56                   	push   %esi
+  8025fd:	6a 00                	push   $0x0
+  8025ff:	e8 83 e6 ff ff       	call   800c87 <sys_page_unmap>
+}
+  802604:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802607:	5b                   	pop    %ebx
+  802608:	5e                   	pop    %esi
+  802609:	5f                   	pop    %edi
+  80260a:	5d                   	pop    %ebp
+  80260b:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  80260c:	8d 56 04             	lea    0x4(%esi),%edx
+  80260f:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802612:	e8 60 ff ff ff       	call   802577 <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802617:	8d 46 30             	lea    0x30(%esi),%eax
+  80261a:	89 f2                	mov    %esi,%edx
+  80261c:	e8 56 ff ff ff       	call   802577 <pipe_wakeup>
+  802621:	eb d6                	jmp    8025f9 <devpipe_close+0x5b>
+
+00802623 <_pipeisclosed>:
+{
+  802623:	55                   	push   %ebp
+  802624:	89 e5                	mov    %esp,%ebp
+  802626:	57                   	push   %edi
+  802627:	56                   	push   %esi
+  802628:	53                   	push   %ebx
+  802629:	83 ec 1c             	sub    $0x1c,%esp
+  80262c:	89 c7                	mov    %eax,%edi
+  80262e:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  802630:	a1 a0 58 80 00       	mov    0x8058a0,%eax
+  802635:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  802638:	83 ec 0c             	sub    $0xc,%esp
+  80263b:	57                   	push   %edi
+  80263c:	e8 df 10 00 00       	call   803720 <pageref>
+  802641:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802644:	89 34 24             	mov    %esi,(%esp)
+  802647:	e8 d4 10 00 00       	call   803720 <pageref>
+    nn = thisenv->env_runs;
+  80264c:	8b 15 a0 58 80 00    	mov    0x8058a0,%edx
+  802652:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  802655:	83 c4 10             	add    $0x10,%esp
+  802658:	39 cb                	cmp    %ecx,%ebx
+  80265a:	74 1b                	je     802677 <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  80265c:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80265f:	75 cf                	jne    802630 <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802661:	8b 42 58             	mov    0x58(%edx),%eax
+  802664:	6a 01                	push   $0x1
+  802666:	50                   	push   %eax
+  802667:	53                   	push   %ebx
+  802668:	68 db 3e 80 00       	push   $0x803edb
+  80266d:	e8 73 db ff ff       	call   8001e5 <cprintf>
+  802672:	83 c4 10             	add    $0x10,%esp
+  802675:	eb b9                	jmp    802630 <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  802677:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80267a:	0f 94 c0             	sete   %al
+  80267d:	0f b6 c0             	movzbl %al,%eax
+}
+  802680:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802683:	5b                   	pop    %ebx
+  802684:	5e                   	pop    %esi
+  802685:	5f                   	pop    %edi
+  802686:	5d                   	pop    %ebp
+  802687:	c3                   	ret
+
+00802688 <devpipe_write_bulk>:
+{
+  802688:	55                   	push   %ebp
+  802689:	89 e5                	mov    %esp,%ebp
+  80268b:	57                   	push   %edi
+  80268c:	56                   	push   %esi
+  80268d:	53                   	push   %ebx
+  80268e:	83 ec 1c             	sub    $0x1c,%esp
+  802691:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802694:	89 d6                	mov    %edx,%esi
+  802696:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  802699:	e8 78 fe ff ff       	call   802516 <pipe_ring>
+  80269e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  8026a1:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  8026a6:	8d 46 04             	lea    0x4(%esi),%eax
+  8026a9:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  8026ac:	eb 75                	jmp    802723 <devpipe_write_bulk+0x9b>
+  8026ae:	b8 01 00 00 00       	mov    $0x1,%eax
+  8026b3:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  8026b7:	6a 64                	push   $0x64
+  8026b9:	68 00 00 c0 ee       	push   $0xeec00000
+  8026be:	53                   	push   %ebx
+  8026bf:	56                   	push   %esi
+  8026c0:	e8 76 e8 ff ff       	call   800f3b <sys_chan_sleep>
+      continue;
+  8026c5:	83 c4 10             	add    $0x10,%esp
+  8026c8:	eb 59                	jmp    802723 <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  8026ca:	89 d1                	mov    %edx,%ecx
+  8026cc:	c1 f9 1f             	sar    $0x1f,%ecx
+  8026cf:	c1 e9 11             	shr    $0x11,%ecx
+  8026d2:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  8026d5:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8026da:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  8026dc:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  8026e2:	29 d3                	sub    %edx,%ebx
+  8026e4:	ba 00 80 00 00       	mov    $0x8000,%edx
+  8026e9:	29 c2                	sub    %eax,%edx
+  8026eb:	39 d3                	cmp    %edx,%ebx
+  8026ed:	0f 47 da             	cmova  %edx,%ebx
+  8026f0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8026f3:	29 fa                	sub    %edi,%edx
+  8026f5:	39 d3                	cmp    %edx,%ebx
+  8026f7:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  8026fa:	83 ec 04             	sub    $0x4,%esp
+  8026fd:	53                   	push   %ebx
+  8026fe:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802701:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  802704:	52                   	push   %edx
+  802705:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802708:	01 c8                	add    %ecx,%eax
+  80270a:	50                   	push   %eax
+  80270b:	e8 ab e2 ff ff       	call   8009bb <memcpy>
+    i += m;
+  802710:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  802712:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802715:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802718:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80271b:	e8 57 fe ff ff       	call   802577 <pipe_wakeup>
+  802720:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802723:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802726:	73 2b                	jae    802753 <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  802728:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  80272a:	8b 56 04             	mov    0x4(%esi),%edx
+  80272d:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  802733:	39 d0                	cmp    %edx,%eax
+  802735:	7d 93                	jge    8026ca <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  802737:	89 f2                	mov    %esi,%edx
+  802739:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80273c:	e8 e2 fe ff ff       	call   802623 <_pipeisclosed>
+  802741:	85 c0                	test   %eax,%eax
+  802743:	0f 84 65 ff ff ff    	je     8026ae <devpipe_write_bulk+0x26>
+        return i;
+  802749:	89 f8                	mov    %edi,%eax
+}
+  80274b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80274e:	5b                   	pop    %ebx
+  80274f:	5e                   	pop    %esi
+  802750:	5f                   	pop    %edi
+  802751:	5d                   	pop    %ebp
+  802752:	c3                   	ret
+  return i;
+  802753:	89 f8                	mov    %edi,%eax
+  802755:	eb f4                	jmp    80274b <devpipe_write_bulk+0xc3>
+
+00802757 <devpipe_write>:
+{
+  802757:	55                   	push   %ebp
+  802758:	89 e5                	mov    %esp,%ebp
+  80275a:	57                   	push   %edi
+  80275b:	56                   	push   %esi
+  80275c:	53                   	push   %ebx
+  80275d:	83 ec 28             	sub    $0x28,%esp
+  802760:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  802763:	56                   	push   %esi
+  802764:	e8 8c ed ff ff       	call   8014f5 <fd2data>
+  802769:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  80276b:	8b 78 28             	mov    0x28(%eax),%edi
+  80276e:	83 c4 10             	add    $0x10,%esp
+  802771:	85 ff                	test   %edi,%edi
+  802773:	75 25                	jne    80279a <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  802775:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802778:	74 66                	je     8027e0 <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  80277a:	8b 43 04             	mov    0x4(%ebx),%eax
+  80277d:	8b 0b                	mov    (%ebx),%ecx
+  80277f:	8d 51 20             	lea    0x20(%ecx),%edx
+  802782:	39 d0                	cmp    %edx,%eax
+  802784:	72 2b                	jb     8027b1 <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  802786:	89 da                	mov    %ebx,%edx
+  802788:	89 f0                	mov    %esi,%eax
+  80278a:	e8 94 fe ff ff       	call   802623 <_pipeisclosed>
+  80278f:	85 c0                	test   %eax,%eax
+  802791:	75 51                	jne    8027e4 <devpipe_write+0x8d>
+      sys_yield();
+  802793:	e8 08 e4 ff ff       	call   800ba0 <sys_yield>
+  802798:	eb e0                	jmp    80277a <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  80279a:	83 ec 0c             	sub    $0xc,%esp
+  80279d:	ff 75 10             	push   0x10(%ebp)
+  8027a0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8027a3:	89 c2                	mov    %eax,%edx
+  8027a5:	89 f0                	mov    %esi,%eax
+  8027a7:	e8 dc fe ff ff       	call   802688 <devpipe_write_bulk>
+  8027ac:	83 c4 10             	add    $0x10,%esp
+  8027af:	eb 38                	jmp    8027e9 <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8027b1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8027b4:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8027b8:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8027bb:	89 c2                	mov    %eax,%edx
+  8027bd:	c1 fa 1f             	sar    $0x1f,%edx
+  8027c0:	89 d1                	mov    %edx,%ecx
+  8027c2:	c1 e9 1b             	shr    $0x1b,%ecx
+  8027c5:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8027c8:	83 e2 1f             	and    $0x1f,%edx
+  8027cb:	29 ca                	sub    %ecx,%edx
+  8027cd:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8027d1:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  8027d5:	83 c0 01             	add    $0x1,%eax
+  8027d8:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  8027db:	83 c7 01             	add    $0x1,%edi
+  8027de:	eb 95                	jmp    802775 <devpipe_write+0x1e>
+  return i;
+  8027e0:	89 f8                	mov    %edi,%eax
+  8027e2:	eb 05                	jmp    8027e9 <devpipe_write+0x92>
+        return 0;
+  8027e4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8027e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027ec:	5b                   	pop    %ebx
+  8027ed:	5e                   	pop    %esi
+  8027ee:	5f                   	pop    %edi
+  8027ef:	5d                   	pop    %ebp
+  8027f0:	c3                   	ret
+
+008027f1 <devpipe_read_bulk>:
+{
+  8027f1:	55                   	push   %ebp
+  8027f2:	89 e5                	mov    %esp,%ebp
+  8027f4:	57                   	push   %edi
+  8027f5:	56                   	push   %esi
+  8027f6:	53                   	push   %ebx
+  8027f7:	83 ec 2c             	sub    $0x2c,%esp
+  8027fa:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8027fd:	89 d6                	mov    %edx,%esi
+  8027ff:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802802:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  802805:	e8 0c fd ff ff       	call   802516 <pipe_ring>
+  80280a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  80280d:	85 db                	test   %ebx,%ebx
+  80280f:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802814:	0f 45 c3             	cmovne %ebx,%eax
+  802817:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80281a:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  80281f:	8d 46 30             	lea    0x30(%esi),%eax
+  802822:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  802825:	eb 50                	jmp    802877 <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  802827:	89 d1                	mov    %edx,%ecx
+  802829:	c1 f9 1f             	sar    $0x1f,%ecx
+  80282c:	c1 e9 11             	shr    $0x11,%ecx
+  80282f:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802832:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802837:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  802839:	29 d3                	sub    %edx,%ebx
+  80283b:	ba 00 80 00 00       	mov    $0x8000,%edx
+  802840:	29 c2                	sub    %eax,%edx
+  802842:	39 d3                	cmp    %edx,%ebx
+  802844:	0f 47 da             	cmova  %edx,%ebx
+  802847:	8b 55 08             	mov    0x8(%ebp),%edx
+  80284a:	29 fa                	sub    %edi,%edx
+  80284c:	39 d3                	cmp    %edx,%ebx
+  80284e:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  802851:	83 ec 04             	sub    $0x4,%esp
+  802854:	53                   	push   %ebx
+  802855:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802858:	01 c8                	add    %ecx,%eax
+  80285a:	50                   	push   %eax
+  80285b:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80285e:	01 f8                	add    %edi,%eax
+  802860:	50                   	push   %eax
+  802861:	e8 55 e1 ff ff       	call   8009bb <memcpy>
+    i += m;
+  802866:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  802868:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  80286a:	89 f2                	mov    %esi,%edx
+  80286c:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80286f:	e8 03 fd ff ff       	call   802577 <pipe_wakeup>
+  802874:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802877:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  80287a:	73 51                	jae    8028cd <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  80287c:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  80287f:	8b 16                	mov    (%esi),%edx
+  802881:	39 da                	cmp    %ebx,%edx
+  802883:	75 a2                	jne    802827 <devpipe_read_bulk+0x36>
+      if (i > 0)
+  802885:	85 ff                	test   %edi,%edi
+  802887:	75 44                	jne    8028cd <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  802889:	89 f2                	mov    %esi,%edx
+  80288b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80288e:	e8 90 fd ff ff       	call   802623 <_pipeisclosed>
+  802893:	85 c0                	test   %eax,%eax
+  802895:	75 3a                	jne    8028d1 <devpipe_read_bulk+0xe0>
+  802897:	b8 01 00 00 00       	mov    $0x1,%eax
+  80289c:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  8028a0:	6a 64                	push   $0x64
+  8028a2:	ff 75 d4             	push   -0x2c(%ebp)
+  8028a5:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  8028a6:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  8028a9:	50                   	push   %eax
+  8028aa:	e8 8c e6 ff ff       	call   800f3b <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  8028af:	85 c0                	test   %eax,%eax
+  8028b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028b6:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  8028b9:	83 c4 10             	add    $0x10,%esp
+  8028bc:	a8 01                	test   $0x1,%al
+  8028be:	74 b7                	je     802877 <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  8028c0:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  8028c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028c8:	5b                   	pop    %ebx
+  8028c9:	5e                   	pop    %esi
+  8028ca:	5f                   	pop    %edi
+  8028cb:	5d                   	pop    %ebp
+  8028cc:	c3                   	ret
+  return i;
+  8028cd:	89 f8                	mov    %edi,%eax
+  8028cf:	eb f4                	jmp    8028c5 <devpipe_read_bulk+0xd4>
+        return 0;
+  8028d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028d6:	eb ed                	jmp    8028c5 <devpipe_read_bulk+0xd4>
+
+008028d8 <devpipe_read>:
+{
+  8028d8:	55                   	push   %ebp
+  8028d9:	89 e5                	mov    %esp,%ebp
+  8028db:	57                   	push   %edi
+  8028dc:	56                   	push   %esi
+  8028dd:	53                   	push   %ebx
+  8028de:	83 ec 18             	sub    $0x18,%esp
+  8028e1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  8028e4:	57                   	push   %edi
+  8028e5:	e8 0b ec ff ff       	call   8014f5 <fd2data>
+  8028ea:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  8028ec:	8b 70 28             	mov    0x28(%eax),%esi
+  8028ef:	83 c4 10             	add    $0x10,%esp
+  8028f2:	85 f6                	test   %esi,%esi
+  8028f4:	75 24                	jne    80291a <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  8028f6:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8028f9:	74 60                	je     80295b <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  8028fb:	8b 03                	mov    (%ebx),%eax
+  8028fd:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802900:	75 3b                	jne    80293d <devpipe_read+0x65>
+      if (i > 0)
+  802902:	85 f6                	test   %esi,%esi
+  802904:	75 2d                	jne    802933 <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  802906:	89 da                	mov    %ebx,%edx
+  802908:	89 f8                	mov    %edi,%eax
+  80290a:	e8 14 fd ff ff       	call   802623 <_pipeisclosed>
+  80290f:	85 c0                	test   %eax,%eax
+  802911:	75 4c                	jne    80295f <devpipe_read+0x87>
+      sys_yield();
+  802913:	e8 88 e2 ff ff       	call   800ba0 <sys_yield>
+  802918:	eb e1                	jmp    8028fb <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  80291a:	83 ec 08             	sub    $0x8,%esp
+  80291d:	6a 00                	push   $0x0
+  80291f:	ff 75 10             	push   0x10(%ebp)
+  802922:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802925:	89 c2                	mov    %eax,%edx
+  802927:	89 f8                	mov    %edi,%eax
+  802929:	e8 c3 fe ff ff       	call   8027f1 <devpipe_read_bulk>
+  80292e:	83 c4 10             	add    $0x10,%esp
+  802931:	eb 02                	jmp    802935 <devpipe_read+0x5d>
+        return i;
+  802933:	89 f0                	mov    %esi,%eax
+}
+  802935:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802938:	5b                   	pop    %ebx
+  802939:	5e                   	pop    %esi
+  80293a:	5f                   	pop    %edi
+  80293b:	5d                   	pop    %ebp
+  80293c:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80293d:	99                   	cltd
+  80293e:	c1 ea 1b             	shr    $0x1b,%edx
+  802941:	01 d0                	add    %edx,%eax
+  802943:	83 e0 1f             	and    $0x1f,%eax
+  802946:	29 d0                	sub    %edx,%eax
+  802948:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  80294d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802950:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  802953:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  802956:	83 c6 01             	add    $0x1,%esi
+  802959:	eb 9b                	jmp    8028f6 <devpipe_read+0x1e>
+  return i;
+  80295b:	89 f0                	mov    %esi,%eax
+  80295d:	eb d6                	jmp    802935 <devpipe_read+0x5d>
+        return 0;
+  80295f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802964:	eb cf                	jmp    802935 <devpipe_read+0x5d>
+
+00802966 <pipe2>:
+{
+  802966:	55                   	push   %ebp
+  802967:	89 e5                	mov    %esp,%ebp
+  802969:	57                   	push   %edi
+  80296a:	56                   	push   %esi
+  80296b:	53                   	push   %ebx
+  80296c:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  80296f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802972:	50                   	push   %eax
+  802973:	e8 91 eb ff ff       	call   801509 <fd_alloc>
+  802978:	89 c3                	mov    %eax,%ebx
+  80297a:	83 c4 10             	add    $0x10,%esp
+  80297d:	85 c0                	test   %eax,%eax
+  80297f:	0f 88 fb 01 00 00    	js     802b80 <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802985:	83 ec 04             	sub    $0x4,%esp
+  802988:	68 07 04 00 00       	push   $0x407
+  80298d:	ff 75 e4             	push   -0x1c(%ebp)
+  802990:	6a 00                	push   $0x0
+  802992:	e8 6b e2 ff ff       	call   800c02 <sys_page_alloc>
+  802997:	89 c3                	mov    %eax,%ebx
+  802999:	83 c4 10             	add    $0x10,%esp
+  80299c:	85 c0                	test   %eax,%eax
+  80299e:	0f 88 dc 01 00 00    	js     802b80 <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  8029a4:	83 ec 0c             	sub    $0xc,%esp
+  8029a7:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8029aa:	50                   	push   %eax
+  8029ab:	e8 59 eb ff ff       	call   801509 <fd_alloc>
+  8029b0:	89 c3                	mov    %eax,%ebx
+  8029b2:	83 c4 10             	add    $0x10,%esp
+  8029b5:	85 c0                	test   %eax,%eax
+  8029b7:	0f 88 b3 01 00 00    	js     802b70 <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8029bd:	83 ec 04             	sub    $0x4,%esp
+  8029c0:	68 07 04 00 00       	push   $0x407
+  8029c5:	ff 75 e0             	push   -0x20(%ebp)
+  8029c8:	6a 00                	push   $0x0
+  8029ca:	e8 33 e2 ff ff       	call   800c02 <sys_page_alloc>
+  8029cf:	89 c3                	mov    %eax,%ebx
+  8029d1:	83 c4 10             	add    $0x10,%esp
+  8029d4:	85 c0                	test   %eax,%eax
+  8029d6:	0f 88 94 01 00 00    	js     802b70 <pipe2+0x20a>
+  va = fd2data(fd0);
+  8029dc:	83 ec 0c             	sub    $0xc,%esp
+  8029df:	ff 75 e4             	push   -0x1c(%ebp)
+  8029e2:	e8 0e eb ff ff       	call   8014f5 <fd2data>
+  8029e7:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8029e9:	83 c4 0c             	add    $0xc,%esp
+  8029ec:	68 07 04 00 00       	push   $0x407
+  8029f1:	50                   	push   %eax
+  8029f2:	6a 00                	push   $0x0
+  8029f4:	e8 09 e2 ff ff       	call   800c02 <sys_page_alloc>
+  8029f9:	89 c3                	mov    %eax,%ebx
+  8029fb:	83 c4 10             	add    $0x10,%esp
+  8029fe:	85 c0                	test   %eax,%eax
+  802a00:	0f 88 5a 01 00 00    	js     802b60 <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802a06:	83 ec 0c             	sub    $0xc,%esp
+  802a09:	ff 75 e0             	push   -0x20(%ebp)
+  802a0c:	e8 e4 ea ff ff       	call   8014f5 <fd2data>
+  802a11:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802a18:	50                   	push   %eax
+  802a19:	6a 00                	push   $0x0
+  802a1b:	57                   	push   %edi
+  802a1c:	6a 00                	push   $0x0
+  802a1e:	e8 22 e2 ff ff       	call   800c45 <sys_page_map>
+  802a23:	89 c3                	mov    %eax,%ebx
+  802a25:	83 c4 20             	add    $0x20,%esp
+  802a28:	85 c0                	test   %eax,%eax
+  802a2a:	0f 88 22 01 00 00    	js     802b52 <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  802a30:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  802a34:	74 72                	je     802aa8 <pipe2+0x142>
+  802a36:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  802a3b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802a3e:	e8 d3 fa ff ff       	call   802516 <pipe_ring>
+  802a43:	83 ec 04             	sub    $0x4,%esp
+  802a46:	68 07 04 00 00       	push   $0x407
+  802a4b:	01 f0                	add    %esi,%eax
+  802a4d:	50                   	push   %eax
+  802a4e:	6a 00                	push   $0x0
+  802a50:	e8 ad e1 ff ff       	call   800c02 <sys_page_alloc>
+  802a55:	89 c3                	mov    %eax,%ebx
+  802a57:	83 c4 10             	add    $0x10,%esp
+  802a5a:	85 c0                	test   %eax,%eax
+  802a5c:	0f 88 97 00 00 00    	js     802af9 <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  802a62:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802a65:	e8 ac fa ff ff       	call   802516 <pipe_ring>
+  802a6a:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  802a6d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802a70:	e8 a1 fa ff ff       	call   802516 <pipe_ring>
+  802a75:	83 ec 0c             	sub    $0xc,%esp
+  802a78:	68 07 04 00 00       	push   $0x407
+  802a7d:	53                   	push   %ebx
+  802a7e:	6a 00                	push   $0x0
+  802a80:	01 f0                	add    %esi,%eax
+  802a82:	50                   	push   %eax
+  802a83:	6a 00                	push   $0x0
+  802a85:	e8 bb e1 ff ff       	call   800c45 <sys_page_map>
+  802a8a:	89 c3                	mov    %eax,%ebx
+  802a8c:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802a92:	83 c4 20             	add    $0x20,%esp
+  802a95:	85 c0                	test   %eax,%eax
+  802a97:	78 60                	js     802af9 <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  802a99:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802a9f:	75 9a                	jne    802a3b <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  802aa1:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  802aa8:	a1 20 40 80 00       	mov    0x804020,%eax
+  802aad:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802ab0:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  802ab2:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802ab5:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  802abc:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802abf:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  802ac1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802ac4:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  802acb:	83 ec 0c             	sub    $0xc,%esp
+  802ace:	ff 75 e4             	push   -0x1c(%ebp)
+  802ad1:	e8 0f ea ff ff       	call   8014e5 <fd2num>
+  802ad6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802ad9:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  802adb:	83 c4 04             	add    $0x4,%esp
+  802ade:	ff 75 e0             	push   -0x20(%ebp)
+  802ae1:	e8 ff e9 ff ff       	call   8014e5 <fd2num>
+  802ae6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802ae9:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  802aec:	83 c4 10             	add    $0x10,%esp
+  802aef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802af4:	e9 87 00 00 00       	jmp    802b80 <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802af9:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  802afe:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802b01:	e8 10 fa ff ff       	call   802516 <pipe_ring>
+  802b06:	83 ec 08             	sub    $0x8,%esp
+  802b09:	01 f0                	add    %esi,%eax
+  802b0b:	50                   	push   %eax
+  802b0c:	6a 00                	push   $0x0
+  802b0e:	e8 74 e1 ff ff       	call   800c87 <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  802b13:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802b16:	e8 fb f9 ff ff       	call   802516 <pipe_ring>
+  802b1b:	83 c4 08             	add    $0x8,%esp
+  802b1e:	01 f0                	add    %esi,%eax
+  802b20:	50                   	push   %eax
+  802b21:	6a 00                	push   $0x0
+  802b23:	e8 5f e1 ff ff       	call   800c87 <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802b28:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802b2e:	83 c4 10             	add    $0x10,%esp
+  802b31:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802b37:	75 c5                	jne    802afe <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  802b39:	83 ec 0c             	sub    $0xc,%esp
+  802b3c:	ff 75 e0             	push   -0x20(%ebp)
+  802b3f:	e8 b1 e9 ff ff       	call   8014f5 <fd2data>
+  802b44:	83 c4 08             	add    $0x8,%esp
+  802b47:	50                   	push   %eax
+  802b48:	6a 00                	push   $0x0
+  802b4a:	e8 38 e1 ff ff       	call   800c87 <sys_page_unmap>
+  802b4f:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  802b52:	83 ec 08             	sub    $0x8,%esp
+  802b55:	57                   	push   %edi
+  802b56:	6a 00                	push   $0x0
+  802b58:	e8 2a e1 ff ff       	call   800c87 <sys_page_unmap>
+  802b5d:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  802b60:	83 ec 08             	sub    $0x8,%esp
+  802b63:	ff 75 e0             	push   -0x20(%ebp)
+  802b66:	6a 00                	push   $0x0
+  802b68:	e8 1a e1 ff ff       	call   800c87 <sys_page_unmap>
+  802b6d:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  802b70:	83 ec 08             	sub    $0x8,%esp
+  802b73:	ff 75 e4             	push   -0x1c(%ebp)
+  802b76:	6a 00                	push   $0x0
+  802b78:	e8 0a e1 ff ff       	call   800c87 <sys_page_unmap>
+  802b7d:	83 c4 10             	add    $0x10,%esp
+}
+  802b80:	89 d8                	mov    %ebx,%eax
+  802b82:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b85:	5b                   	pop    %ebx
+  802b86:	5e                   	pop    %esi
+  802b87:	5f                   	pop    %edi
+  802b88:	5d                   	pop    %ebp
+  802b89:	c3                   	ret
+
+00802b8a <pipe>:
+{
+  802b8a:	55                   	push   %ebp
+  802b8b:	89 e5                	mov    %esp,%ebp
+  802b8d:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  802b90:	6a 00                	push   $0x0
+  802b92:	ff 75 08             	push   0x8(%ebp)
+  802b95:	e8 cc fd ff ff       	call   802966 <pipe2>
+}
+  802b9a:	c9                   	leave
+  802b9b:	c3                   	ret
+
+00802b9c <pipeisclosed>:
+{
+  802b9c:	55                   	push   %ebp
+  802b9d:	89 e5                	mov    %esp,%ebp
+  802b9f:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802ba2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802ba5:	50                   	push   %eax
+  802ba6:	ff 75 08             	push   0x8(%ebp)
+  802ba9:	e8 b1 e9 ff ff       	call   80155f <fd_lookup>
+  802bae:	83 c4 10             	add    $0x10,%esp
+  802bb1:	85 c0                	test   %eax,%eax
+  802bb3:	78 18                	js     802bcd <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  802bb5:	83 ec 0c             	sub    $0xc,%esp
+  802bb8:	ff 75 f4             	push   -0xc(%ebp)
+  802bbb:	e8 35 e9 ff ff       	call   8014f5 <fd2data>
+  802bc0:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  802bc2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802bc5:	e8 59 fa ff ff       	call   802623 <_pipeisclosed>
+  802bca:	83 c4 10             	add    $0x10,%esp
+}
+  802bcd:	c9                   	leave
+  802bce:	c3                   	ret
+
+00802bcf <pipe_splice>:
+{
+  802bcf:	55                   	push   %ebp
+  802bd0:	89 e5                	mov    %esp,%ebp
+  802bd2:	57                   	push   %edi
+  802bd3:	56                   	push   %esi
+  802bd4:	53                   	push   %ebx
+  802bd5:	83 ec 34             	sub    $0x34,%esp
+  802bd8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802bdb:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802bde:	50                   	push   %eax
+  802bdf:	ff 75 08             	push   0x8(%ebp)
+  802be2:	e8 78 e9 ff ff       	call   80155f <fd_lookup>
+  802be7:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802bea:	83 c4 10             	add    $0x10,%esp
+  802bed:	85 c0                	test   %eax,%eax
+  802bef:	0f 88 d7 00 00 00    	js     802ccc <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  802bf5:	83 ec 0c             	sub    $0xc,%esp
+  802bf8:	ff 75 e4             	push   -0x1c(%ebp)
+  802bfb:	e8 f5 e8 ff ff       	call   8014f5 <fd2data>
+  802c00:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802c02:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802c05:	83 c4 10             	add    $0x10,%esp
+  802c08:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802c0e:	39 10                	cmp    %edx,(%eax)
+  802c10:	0f 85 c1 00 00 00    	jne    802cd7 <pipe_splice+0x108>
+  802c16:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  802c1a:	0f 84 c0 00 00 00    	je     802ce0 <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  802c20:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802c24:	0f 84 bf 00 00 00    	je     802ce9 <pipe_splice+0x11a>
+  802c2a:	89 f7                	mov    %esi,%edi
+  802c2c:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  802c32:	0f 85 ba 00 00 00    	jne    802cf2 <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802c38:	8d 43 04             	lea    0x4(%ebx),%eax
+  802c3b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802c3e:	eb 38                	jmp    802c78 <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802c40:	83 ec 0c             	sub    $0xc,%esp
+  802c43:	68 00 10 00 00       	push   $0x1000
+  802c48:	89 f1                	mov    %esi,%ecx
+  802c4a:	89 da                	mov    %ebx,%edx
+  802c4c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802c4f:	e8 34 fa ff ff       	call   802688 <devpipe_write_bulk>
+  802c54:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802c57:	83 c4 10             	add    $0x10,%esp
+  802c5a:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802c5f:	75 53                	jne    802cb4 <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  802c61:	83 ec 08             	sub    $0x8,%esp
+  802c64:	56                   	push   %esi
+  802c65:	6a 00                	push   $0x0
+  802c67:	e8 1b e0 ff ff       	call   800c87 <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  802c6c:	83 c7 01             	add    $0x1,%edi
+  802c6f:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802c75:	83 c4 10             	add    $0x10,%esp
+  802c78:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802c7b:	74 3a                	je     802cb7 <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  802c7d:	8b 03                	mov    (%ebx),%eax
+  802c7f:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802c82:	75 bc                	jne    802c40 <pipe_splice+0x71>
+  802c84:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c89:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  802c8d:	85 c0                	test   %eax,%eax
+  802c8f:	74 af                	je     802c40 <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802c91:	83 ec 04             	sub    $0x4,%esp
+  802c94:	6a 07                	push   $0x7
+  802c96:	56                   	push   %esi
+  802c97:	ff 75 d0             	push   -0x30(%ebp)
+  802c9a:	e8 bf e2 ff ff       	call   800f5e <sys_chan_wakeup>
+  802c9f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802ca2:	83 c4 10             	add    $0x10,%esp
+  802ca5:	85 c0                	test   %eax,%eax
+  802ca7:	79 b8                	jns    802c61 <pipe_splice+0x92>
+  802ca9:	b8 01 00 00 00       	mov    $0x1,%eax
+  802cae:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802cb2:	eb 8c                	jmp    802c40 <pipe_splice+0x71>
+  802cb4:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  802cb7:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802cbb:	75 06                	jne    802cc3 <pipe_splice+0xf4>
+  802cbd:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802cc1:	78 09                	js     802ccc <pipe_splice+0xfd>
+  return i * PGSIZE;
+  802cc3:	8b 45 10             	mov    0x10(%ebp),%eax
+  802cc6:	c1 e0 0c             	shl    $0xc,%eax
+  802cc9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  802ccc:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802ccf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802cd2:	5b                   	pop    %ebx
+  802cd3:	5e                   	pop    %esi
+  802cd4:	5f                   	pop    %edi
+  802cd5:	5d                   	pop    %ebp
+  802cd6:	c3                   	ret
+    return -E_INVAL;
+  802cd7:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802cde:	eb ec                	jmp    802ccc <pipe_splice+0xfd>
+  802ce0:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802ce7:	eb e3                	jmp    802ccc <pipe_splice+0xfd>
+  802ce9:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802cf0:	eb da                	jmp    802ccc <pipe_splice+0xfd>
+  802cf2:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802cf9:	eb d1                	jmp    802ccc <pipe_splice+0xfd>
+
+00802cfb <pipe_splice_read>:
+{
+  802cfb:	55                   	push   %ebp
+  802cfc:	89 e5                	mov    %esp,%ebp
+  802cfe:	53                   	push   %ebx
+  802cff:	83 ec 1c             	sub    $0x1c,%esp
+  802d02:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802d05:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802d08:	50                   	push   %eax
+  802d09:	ff 75 08             	push   0x8(%ebp)
+  802d0c:	e8 4e e8 ff ff       	call   80155f <fd_lookup>
+  802d11:	83 c4 10             	add    $0x10,%esp
+  802d14:	85 c0                	test   %eax,%eax
+  802d16:	78 49                	js     802d61 <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  802d18:	83 ec 0c             	sub    $0xc,%esp
+  802d1b:	ff 75 f4             	push   -0xc(%ebp)
+  802d1e:	e8 d2 e7 ff ff       	call   8014f5 <fd2data>
+  802d23:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802d25:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802d28:	83 c4 10             	add    $0x10,%esp
+  802d2b:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  802d31:	39 08                	cmp    %ecx,(%eax)
+  802d33:	75 31                	jne    802d66 <pipe_splice_read+0x6b>
+  802d35:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  802d39:	74 32                	je     802d6d <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  802d3b:	8b 48 08             	mov    0x8(%eax),%ecx
+  802d3e:	83 e1 03             	and    $0x3,%ecx
+  802d41:	83 f9 01             	cmp    $0x1,%ecx
+  802d44:	74 2e                	je     802d74 <pipe_splice_read+0x79>
+  802d46:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  802d4c:	75 2d                	jne    802d7b <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  802d4e:	83 ec 08             	sub    $0x8,%esp
+  802d51:	53                   	push   %ebx
+  802d52:	68 00 10 00 00       	push   $0x1000
+  802d57:	89 d9                	mov    %ebx,%ecx
+  802d59:	e8 93 fa ff ff       	call   8027f1 <devpipe_read_bulk>
+  802d5e:	83 c4 10             	add    $0x10,%esp
+}
+  802d61:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d64:	c9                   	leave
+  802d65:	c3                   	ret
+    return -E_INVAL;
+  802d66:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d6b:	eb f4                	jmp    802d61 <pipe_splice_read+0x66>
+  802d6d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d72:	eb ed                	jmp    802d61 <pipe_splice_read+0x66>
+  802d74:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d79:	eb e6                	jmp    802d61 <pipe_splice_read+0x66>
+  802d7b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d80:	eb df                	jmp    802d61 <pipe_splice_read+0x66>
+
+00802d82 <mmap_find>:
+          utf->utf_eip, utf->utf_err);
+}
+
+static struct Mmap *
+mmap_find(uintptr_t va)
+{
+  802d82:	55                   	push   %ebp
+  802d83:	89 e5                	mov    %esp,%ebp
+  802d85:	56                   	push   %esi
+  802d86:	53                   	push   %ebx
+  int i;
+
+  for (i = 0; i < NMMAP; i++)
+  802d87:	ba 60 57 80 00       	mov    $0x805760,%edx
+  802d8c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d91:	eb 0b                	jmp    802d9e <mmap_find+0x1c>
+  802d93:	83 c3 01             	add    $0x1,%ebx
+  802d96:	83 c2 14             	add    $0x14,%edx
+  802d99:	83 fb 10             	cmp    $0x10,%ebx
+  802d9c:	74 1d                	je     802dbb <mmap_find+0x39>
+    if (mmaps[i].mm_va && va >= mmaps[i].mm_va &&
+  802d9e:	8b 0a                	mov    (%edx),%ecx
+  802da0:	39 c8                	cmp    %ecx,%eax
+  802da2:	72 ef                	jb     802d93 <mmap_find+0x11>
+  802da4:	85 c9                	test   %ecx,%ecx
+  802da6:	74 eb                	je     802d93 <mmap_find+0x11>
+        va < mmaps[i].mm_va + mmaps[i].mm_len)
+  802da8:	03 4a 04             	add    0x4(%edx),%ecx
+    if (mmaps[i].mm_va && va >= mmaps[i].mm_va &&
+  802dab:	39 c8                	cmp    %ecx,%eax
+  802dad:	73 e4                	jae    802d93 <mmap_find+0x11>
+      return &mmaps[i];
+  802daf:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802db2:	8d 04 85 60 57 80 00 	lea    0x805760(,%eax,4),%eax
+  802db9:	eb 05                	jmp    802dc0 <mmap_find+0x3e>
+  return NULL;
+  802dbb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802dc0:	5b                   	pop    %ebx
+  802dc1:	5e                   	pop    %esi
+  802dc2:	5d                   	pop    %ebp
+  802dc3:	c3                   	ret
+
+00802dc4 <va_mapped>:
+
+static bool
+va_mapped(uintptr_t va)
+{
+  return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+  802dc4:	89 c2                	mov    %eax,%edx
+  802dc6:	c1 ea 16             	shr    $0x16,%edx
+  802dc9:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802dd0:	f6 c2 01             	test   $0x1,%dl
+  802dd3:	74 11                	je     802de6 <va_mapped+0x22>
+  802dd5:	c1 e8 0c             	shr    $0xc,%eax
+  802dd8:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802ddf:	83 e0 01             	and    $0x1,%eax
+  802de2:	83 e0 01             	and    $0x1,%eax
+}
+  802de5:	c3                   	ret
+  return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+  802de6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802deb:	eb f5                	jmp    802de2 <va_mapped+0x1e>
+
+00802ded <mmap_copy>:
+
+// Replace the page at 'va' with a copy of its first 'n' bytes, the rest
+// zeroed, mapped with 'perm'.
+static void
+mmap_copy(uintptr_t va, size_t n, int perm)
+{
+  802ded:	55                   	push   %ebp
+  802dee:	89 e5                	mov    %esp,%ebp
+  802df0:	57                   	push   %edi
+  802df1:	56                   	push   %esi
+  802df2:	53                   	push   %ebx
+  802df3:	83 ec 10             	sub    $0x10,%esp
+  802df6:	89 c3                	mov    %eax,%ebx
+  802df8:	89 d7                	mov    %edx,%edi
+  802dfa:	89 ce                	mov    %ecx,%esi
+  int r;
+
+  if ((r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  802dfc:	6a 07                	push   $0x7
+  802dfe:	68 00 f0 7f 00       	push   $0x7ff000
+  802e03:	6a 00                	push   $0x0
+  802e05:	e8 f8 dd ff ff       	call   800c02 <sys_page_alloc>
+  802e0a:	83 c4 10             	add    $0x10,%esp
+  802e0d:	85 c0                	test   %eax,%eax
+  802e0f:	78 46                	js     802e57 <mmap_copy+0x6a>
+    panic("mmap: %e", r);
+  memmove(PFTEMP, (void *) va, n);
+  802e11:	83 ec 04             	sub    $0x4,%esp
+  802e14:	57                   	push   %edi
+  802e15:	53                   	push   %ebx
+  802e16:	68 00 f0 7f 00       	push   $0x7ff000
+  802e1b:	e8 39 db ff ff       	call   800959 <memmove>
+  if ((r = sys_page_map(0, PFTEMP, 0, (void *) va, perm)) < 0 ||
+  802e20:	89 34 24             	mov    %esi,(%esp)
+  802e23:	53                   	push   %ebx
+  802e24:	6a 00                	push   $0x0
+  802e26:	68 00 f0 7f 00       	push   $0x7ff000
+  802e2b:	6a 00                	push   $0x0
+  802e2d:	e8 13 de ff ff       	call   800c45 <sys_page_map>
+  802e32:	83 c4 20             	add    $0x20,%esp
+  802e35:	85 c0                	test   %eax,%eax
+  802e37:	78 30                	js     802e69 <mmap_copy+0x7c>
+      (r = sys_page_unmap(0, PFTEMP)) < 0)
+  802e39:	83 ec 08             	sub    $0x8,%esp
+  802e3c:	68 00 f0 7f 00       	push   $0x7ff000
+  802e41:	6a 00                	push   $0x0
+  802e43:	e8 3f de ff ff       	call   800c87 <sys_page_unmap>
+  if ((r = sys_page_map(0, PFTEMP, 0, (void *) va, perm)) < 0 ||
+  802e48:	83 c4 10             	add    $0x10,%esp
+  802e4b:	85 c0                	test   %eax,%eax
+  802e4d:	78 1a                	js     802e69 <mmap_copy+0x7c>
+    panic("mmap: %e", r);
+}
+  802e4f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e52:	5b                   	pop    %ebx
+  802e53:	5e                   	pop    %esi
+  802e54:	5f                   	pop    %edi
+  802e55:	5d                   	pop    %ebp
+  802e56:	c3                   	ret
+    panic("mmap: %e", r);
+  802e57:	50                   	push   %eax
+  802e58:	68 f3 3e 80 00       	push   $0x803ef3
+  802e5d:	6a 3e                	push   $0x3e
+  802e5f:	68 fc 3e 80 00       	push   $0x803efc
+  802e64:	e8 a1 06 00 00       	call   80350a <_panic>
+    panic("mmap: %e", r);
+  802e69:	50                   	push   %eax
+  802e6a:	68 f3 3e 80 00       	push   $0x803ef3
+  802e6f:	6a 42                	push   $0x42
+  802e71:	68 fc 3e 80 00       	push   $0x803efc
+  802e76:	e8 8f 06 00 00       	call   80350a <_panic>
+
+00802e7b <mmap_fault>:
+// Handle a page fault in a mapping, if it is one.  Returns 1 if it was.
+// The fork page fault handlers call this first, so that mappings keep
+// working after a fork.
+bool
+mmap_fault(struct UTrapframe *utf)
+{
+  802e7b:	55                   	push   %ebp
+  802e7c:	89 e5                	mov    %esp,%ebp
+  802e7e:	57                   	push   %edi
+  802e7f:	56                   	push   %esi
+  802e80:	53                   	push   %ebx
+  802e81:	83 ec 1c             	sub    $0x1c,%esp
+  802e84:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Fsreq_read_map saved;
+  struct Mmap *m;
+  uintptr_t va;
+  int perm, r;
+
+  va = ROUNDDOWN(utf->utf_fault_va, PGSIZE);
+  802e87:	8b 1f                	mov    (%edi),%ebx
+  802e89:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if (va < MMAPBASE || va >= MMAPTOP || (m = mmap_find(va)) == NULL)
+  802e8f:	8d 83 00 00 00 60    	lea    0x60000000(%ebx),%eax
+  802e95:	3d ff ff ff 2f       	cmp    $0x2fffffff,%eax
+  802e9a:	0f 87 24 01 00 00    	ja     802fc4 <mmap_fault+0x149>
+  802ea0:	89 d8                	mov    %ebx,%eax
+  802ea2:	e8 db fe ff ff       	call   802d82 <mmap_find>
+  802ea7:	89 c6                	mov    %eax,%esi
+  802ea9:	85 c0                	test   %eax,%eax
+  802eab:	0f 84 20 01 00 00    	je     802fd1 <mmap_fault+0x156>
+    return 0;
+  if ((utf->utf_err & FEC_WR) && m->mm_perm == MAP_RDONLY)
+  802eb1:	f6 47 04 02          	testb  $0x2,0x4(%edi)
+  802eb5:	74 13                	je     802eca <mmap_fault+0x4f>
+  802eb7:	83 78 10 00          	cmpl   $0x0,0x10(%eax)
+  802ebb:	0f 84 17 01 00 00    	je     802fd8 <mmap_fault+0x15d>
+    return 0;
+  perm = PTE_P | PTE_U | (m->mm_perm == MAP_RDONLY ? 0 : PTE_W);
+  802ec1:	c7 45 e4 07 00 00 00 	movl   $0x7,-0x1c(%ebp)
+  802ec8:	eb 0f                	jmp    802ed9 <mmap_fault+0x5e>
+  802eca:	83 78 10 01          	cmpl   $0x1,0x10(%eax)
+  802ece:	19 c0                	sbb    %eax,%eax
+  802ed0:	83 e0 fe             	and    $0xfffffffe,%eax
+  802ed3:	83 c0 07             	add    $0x7,%eax
+  802ed6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+
+  if (!va_mapped(va)) {
+  802ed9:	89 d8                	mov    %ebx,%eax
+  802edb:	e8 e4 fe ff ff       	call   802dc4 <va_mapped>
+  802ee0:	84 c0                	test   %al,%al
+  802ee2:	74 42                	je     802f26 <mmap_fault+0xab>
+    }
+  }
+
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+    mmap_copy(va, PGSIZE, perm);
+  return 1;
+  802ee4:	b8 01 00 00 00       	mov    $0x1,%eax
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+  802ee9:	f6 47 04 02          	testb  $0x2,0x4(%edi)
+  802eed:	0f 84 d6 00 00 00    	je     802fc9 <mmap_fault+0x14e>
+  802ef3:	89 d8                	mov    %ebx,%eax
+  802ef5:	c1 e8 0c             	shr    $0xc,%eax
+  802ef8:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  return 1;
+  802eff:	b8 01 00 00 00       	mov    $0x1,%eax
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+  802f04:	f6 c2 02             	test   $0x2,%dl
+  802f07:	0f 85 bc 00 00 00    	jne    802fc9 <mmap_fault+0x14e>
+    mmap_copy(va, PGSIZE, perm);
+  802f0d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802f10:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f15:	89 d8                	mov    %ebx,%eax
+  802f17:	e8 d1 fe ff ff       	call   802ded <mmap_copy>
+  return 1;
+  802f1c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802f21:	e9 a3 00 00 00       	jmp    802fc9 <mmap_fault+0x14e>
+    saved = fsipcbuf.read_map;
+  802f26:	a1 00 60 80 00       	mov    0x806000,%eax
+  802f2b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802f2e:	8b 15 04 60 80 00    	mov    0x806004,%edx
+  802f34:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    r = read_map(m->mm_fd, m->mm_offset + (va - m->mm_va), (void *) va);
+  802f37:	83 ec 04             	sub    $0x4,%esp
+  802f3a:	53                   	push   %ebx
+  802f3b:	89 d8                	mov    %ebx,%eax
+  802f3d:	03 46 0c             	add    0xc(%esi),%eax
+  802f40:	2b 06                	sub    (%esi),%eax
+  802f42:	50                   	push   %eax
+  802f43:	ff 76 08             	push   0x8(%esi)
+  802f46:	e8 86 f3 ff ff       	call   8022d1 <read_map>
+    fsipcbuf.read_map = saved;
+  802f4b:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802f4e:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+  802f54:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  802f57:	89 15 04 60 80 00    	mov    %edx,0x806004
+    if (r < 0)
+  802f5d:	83 c4 10             	add    $0x10,%esp
+  802f60:	85 c0                	test   %eax,%eax
+  802f62:	78 20                	js     802f84 <mmap_fault+0x109>
+    if (r == 0) {
+  802f64:	74 30                	je     802f96 <mmap_fault+0x11b>
+    if (r < PGSIZE) {
+  802f66:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  802f6b:	0f 8f 73 ff ff ff    	jg     802ee4 <mmap_fault+0x69>
+      mmap_copy(va, r, perm);
+  802f71:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802f74:	89 c2                	mov    %eax,%edx
+  802f76:	89 d8                	mov    %ebx,%eax
+  802f78:	e8 70 fe ff ff       	call   802ded <mmap_copy>
+      return 1;
+  802f7d:	b8 01 00 00 00       	mov    $0x1,%eax
+  802f82:	eb 45                	jmp    802fc9 <mmap_fault+0x14e>
+      panic("mmap: read_map: %e", r);
+  802f84:	50                   	push   %eax
+  802f85:	68 07 3f 80 00       	push   $0x803f07
+  802f8a:	6a 5f                	push   $0x5f
+  802f8c:	68 fc 3e 80 00       	push   $0x803efc
+  802f91:	e8 74 05 00 00       	call   80350a <_panic>
+      if ((r = sys_page_alloc(0, (void *) va, perm)) < 0)
+  802f96:	83 ec 04             	sub    $0x4,%esp
+  802f99:	ff 75 e4             	push   -0x1c(%ebp)
+  802f9c:	53                   	push   %ebx
+  802f9d:	6a 00                	push   $0x0
+  802f9f:	e8 5e dc ff ff       	call   800c02 <sys_page_alloc>
+  802fa4:	83 c4 10             	add    $0x10,%esp
+  802fa7:	85 c0                	test   %eax,%eax
+  802fa9:	78 07                	js     802fb2 <mmap_fault+0x137>
+      return 1;
+  802fab:	b8 01 00 00 00       	mov    $0x1,%eax
+  802fb0:	eb 17                	jmp    802fc9 <mmap_fault+0x14e>
+        panic("mmap: %e", r);
+  802fb2:	50                   	push   %eax
+  802fb3:	68 f3 3e 80 00       	push   $0x803ef3
+  802fb8:	6a 64                	push   $0x64
+  802fba:	68 fc 3e 80 00       	push   $0x803efc
+  802fbf:	e8 46 05 00 00       	call   80350a <_panic>
+    return 0;
+  802fc4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802fc9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fcc:	5b                   	pop    %ebx
+  802fcd:	5e                   	pop    %esi
+  802fce:	5f                   	pop    %edi
+  802fcf:	5d                   	pop    %ebp
+  802fd0:	c3                   	ret
+    return 0;
+  802fd1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fd6:	eb f1                	jmp    802fc9 <mmap_fault+0x14e>
+    return 0;
+  802fd8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fdd:	eb ea                	jmp    802fc9 <mmap_fault+0x14e>
+
+00802fdf <mmap_pgfault>:
+{
+  802fdf:	55                   	push   %ebp
+  802fe0:	89 e5                	mov    %esp,%ebp
+  802fe2:	53                   	push   %ebx
+  802fe3:	83 ec 10             	sub    $0x10,%esp
+  802fe6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (!mmap_fault(utf))
+  802fe9:	53                   	push   %ebx
+  802fea:	e8 8c fe ff ff       	call   802e7b <mmap_fault>
+  802fef:	83 c4 10             	add    $0x10,%esp
+  802ff2:	84 c0                	test   %al,%al
+  802ff4:	74 05                	je     802ffb <mmap_pgfault+0x1c>
+}
+  802ff6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ff9:	c9                   	leave
+  802ffa:	c3                   	ret
+    panic("page fault at %08x, eip %08x, err %04x", utf->utf_fault_va,
+  802ffb:	83 ec 08             	sub    $0x8,%esp
+  802ffe:	ff 73 04             	push   0x4(%ebx)
+  803001:	ff 73 28             	push   0x28(%ebx)
+  803004:	ff 33                	push   (%ebx)
+  803006:	68 1c 3f 80 00       	push   $0x803f1c
+  80300b:	6a 20                	push   $0x20
+  80300d:	68 fc 3e 80 00       	push   $0x803efc
+  803012:	e8 f3 04 00 00       	call   80350a <_panic>
+
+00803017 <mmap>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_INVAL if offset isn't aligned, len is 0, or perm is unknown
+//	-E_NO_MEM if there's no free slot or address space for it
+int
+mmap(int fdnum, off_t offset, size_t len, int perm, void **addr)
+{
+  803017:	55                   	push   %ebp
+  803018:	89 e5                	mov    %esp,%ebp
+  80301a:	57                   	push   %edi
+  80301b:	56                   	push   %esi
+  80301c:	53                   	push   %ebx
+  80301d:	83 ec 44             	sub    $0x44,%esp
+  803020:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  struct Fd *fd;
+  uintptr_t va;
+  int i, j, r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803023:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  803026:	50                   	push   %eax
+  803027:	ff 75 08             	push   0x8(%ebp)
+  80302a:	e8 30 e5 ff ff       	call   80155f <fd_lookup>
+  80302f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  803032:	83 c4 10             	add    $0x10,%esp
+  803035:	85 c0                	test   %eax,%eax
+  803037:	0f 88 3e 01 00 00    	js     80317b <mmap+0x164>
+    return r;
+  if (offset < 0 || PGOFF(offset) || len == 0 ||
+  80303d:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803041:	0f 88 d1 00 00 00    	js     803118 <mmap+0x101>
+  803047:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80304a:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80304f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  803052:	0f 85 c9 00 00 00    	jne    803121 <mmap+0x10a>
+  803058:	85 db                	test   %ebx,%ebx
+  80305a:	0f 84 ca 00 00 00    	je     80312a <mmap+0x113>
+  803060:	83 7d 14 02          	cmpl   $0x2,0x14(%ebp)
+  803064:	0f 87 c0 00 00 00    	ja     80312a <mmap+0x113>
+      (perm != MAP_RDONLY && perm != MAP_PRIVATE && perm != MAP_SHARED))
+    return -E_INVAL;
+  len = ROUNDUP(len, PGSIZE);
+  80306a:	81 c3 ff 0f 00 00    	add    $0xfff,%ebx
+  803070:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  803076:	89 d9                	mov    %ebx,%ecx
+  803078:	89 5d c4             	mov    %ebx,-0x3c(%ebp)
+
+  // First fit: try the start of the region and the end of each
+  // mapping.
+  for (i = -1; i < NMMAP; i++) {
+  80307b:	bb 4c 57 80 00       	mov    $0x80574c,%ebx
+  803080:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+    if (i >= 0 && !mmaps[i].mm_va)
+      continue;
+    va = i < 0 ? MMAPBASE : mmaps[i].mm_va + mmaps[i].mm_len;
+  803085:	bf 00 00 00 a0       	mov    $0xa0000000,%edi
+  80308a:	eb 53                	jmp    8030df <mmap+0xc8>
+  80308c:	bf 00 00 00 a0       	mov    $0xa0000000,%edi
+  803091:	eb 4c                	jmp    8030df <mmap+0xc8>
+    if (len > MMAPTOP - va)
+      continue;
+    for (j = 0; j < NMMAP; j++)
+  803093:	83 c0 01             	add    $0x1,%eax
+  803096:	83 f8 10             	cmp    $0x10,%eax
+  803099:	0f 84 e7 00 00 00    	je     803186 <mmap+0x16f>
+      if (mmaps[j].mm_va && va < mmaps[j].mm_va + mmaps[j].mm_len &&
+  80309f:	8d 34 80             	lea    (%eax,%eax,4),%esi
+  8030a2:	8b 14 b5 60 57 80 00 	mov    0x805760(,%esi,4),%edx
+  8030a9:	85 d2                	test   %edx,%edx
+  8030ab:	74 e6                	je     803093 <mmap+0x7c>
+  8030ad:	89 d1                	mov    %edx,%ecx
+  8030af:	03 0c b5 64 57 80 00 	add    0x805764(,%esi,4),%ecx
+  8030b6:	39 cf                	cmp    %ecx,%edi
+  8030b8:	73 d9                	jae    803093 <mmap+0x7c>
+  8030ba:	39 da                	cmp    %ebx,%edx
+  8030bc:	73 d5                	jae    803093 <mmap+0x7c>
+  8030be:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8030c1:	8b 55 cc             	mov    -0x34(%ebp),%edx
+  8030c4:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  for (i = -1; i < NMMAP; i++) {
+  8030c7:	83 c2 01             	add    $0x1,%edx
+  8030ca:	83 c3 14             	add    $0x14,%ebx
+  8030cd:	83 fa 10             	cmp    $0x10,%edx
+  8030d0:	74 2b                	je     8030fd <mmap+0xe6>
+    if (i >= 0 && !mmaps[i].mm_va)
+  8030d2:	85 d2                	test   %edx,%edx
+  8030d4:	78 b6                	js     80308c <mmap+0x75>
+  8030d6:	8b 3b                	mov    (%ebx),%edi
+  8030d8:	85 ff                	test   %edi,%edi
+  8030da:	74 eb                	je     8030c7 <mmap+0xb0>
+    va = i < 0 ? MMAPBASE : mmaps[i].mm_va + mmaps[i].mm_len;
+  8030dc:	03 7b 04             	add    0x4(%ebx),%edi
+    if (len > MMAPTOP - va)
+  8030df:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8030e4:	29 f8                	sub    %edi,%eax
+  8030e6:	39 c8                	cmp    %ecx,%eax
+  8030e8:	72 dd                	jb     8030c7 <mmap+0xb0>
+    for (j = 0; j < NMMAP; j++)
+  8030ea:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+          mmaps[j].mm_va < va + len)
+  8030ed:	8d 34 0f             	lea    (%edi,%ecx,1),%esi
+  8030f0:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  8030f3:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  8030f6:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+  8030f9:	89 f3                	mov    %esi,%ebx
+  8030fb:	eb a2                	jmp    80309f <mmap+0x88>
+        break;
+    if (j == NMMAP)
+      break;
+  }
+  if (i == NMMAP)
+    return -E_NO_MEM;
+  8030fd:	c7 45 d4 fc ff ff ff 	movl   $0xfffffffc,-0x2c(%ebp)
+  803104:	eb 75                	jmp    80317b <mmap+0x164>
+    ;
+  if (j == NMMAP)
+    return -E_NO_MEM;
+
+  if (_pgfault_handler == 0)
+    set_pgfault_handler(mmap_pgfault);
+  803106:	83 ec 0c             	sub    $0xc,%esp
+  803109:	68 df 2f 80 00       	push   $0x802fdf
+  80310e:	e8 3d 04 00 00       	call   803550 <set_pgfault_handler>
+  803113:	83 c4 10             	add    $0x10,%esp
+  803116:	eb 24                	jmp    80313c <mmap+0x125>
+    return -E_INVAL;
+  803118:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  80311f:	eb 5a                	jmp    80317b <mmap+0x164>
+  803121:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  803128:	eb 51                	jmp    80317b <mmap+0x164>
+  80312a:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  803131:	eb 48                	jmp    80317b <mmap+0x164>
+  if (_pgfault_handler == 0)
+  803133:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  80313a:	74 ca                	je     803106 <mmap+0xef>
+
+  mmaps[j].mm_va = va;
+  80313c:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803143:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803146:	c1 e2 02             	shl    $0x2,%edx
+  803149:	89 ba 60 57 80 00    	mov    %edi,0x805760(%edx)
+  mmaps[j].mm_len = len;
+  80314f:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  803152:	89 b2 64 57 80 00    	mov    %esi,0x805764(%edx)
+  mmaps[j].mm_fd = fdnum;
+  803158:	8b 75 08             	mov    0x8(%ebp),%esi
+  80315b:	89 b2 68 57 80 00    	mov    %esi,0x805768(%edx)
+  mmaps[j].mm_offset = offset;
+  803161:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803164:	89 b2 6c 57 80 00    	mov    %esi,0x80576c(%edx)
+  mmaps[j].mm_perm = perm;
+  80316a:	01 d8                	add    %ebx,%eax
+  80316c:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  80316f:	89 1c 85 70 57 80 00 	mov    %ebx,0x805770(,%eax,4)
+  *addr = (void *) va;
+  803176:	8b 45 18             	mov    0x18(%ebp),%eax
+  803179:	89 38                	mov    %edi,(%eax)
+  return 0;
+}
+  80317b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80317e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803181:	5b                   	pop    %ebx
+  803182:	5e                   	pop    %esi
+  803183:	5f                   	pop    %edi
+  803184:	5d                   	pop    %ebp
+  803185:	c3                   	ret
+  if (i == NMMAP)
+  803186:	b8 60 57 80 00       	mov    $0x805760,%eax
+  for (j = 0; j < NMMAP && mmaps[j].mm_va; j++)
+  80318b:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+  80318e:	83 c0 14             	add    $0x14,%eax
+  803191:	83 78 ec 00          	cmpl   $0x0,-0x14(%eax)
+  803195:	74 9c                	je     803133 <mmap+0x11c>
+  803197:	83 c3 01             	add    $0x1,%ebx
+  80319a:	83 fb 10             	cmp    $0x10,%ebx
+  80319d:	75 ef                	jne    80318e <mmap+0x177>
+    return -E_NO_MEM;
+  80319f:	c7 45 d4 fc ff ff ff 	movl   $0xfffffffc,-0x2c(%ebp)
+  8031a6:	eb d3                	jmp    80317b <mmap+0x164>
+
+008031a8 <msync>:
+// nothing for other kinds of mapping.
+//
+// Returns 0 on success, < 0 on error.
+int
+msync(void *addr)
+{
+  8031a8:	55                   	push   %ebp
+  8031a9:	89 e5                	mov    %esp,%ebp
+  8031ab:	57                   	push   %edi
+  8031ac:	56                   	push   %esi
+  8031ad:	53                   	push   %ebx
+  8031ae:	81 ec ac 00 00 00    	sub    $0xac,%esp
+  struct Stat st;
+  off_t saved, off;
+  uintptr_t va;
+  int n, r;
+
+  if ((m = mmap_find((uintptr_t) addr)) == NULL)
+  8031b4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8031b7:	e8 c6 fb ff ff       	call   802d82 <mmap_find>
+  8031bc:	85 c0                	test   %eax,%eax
+  8031be:	0f 84 58 01 00 00    	je     80331c <msync+0x174>
+  8031c4:	89 c7                	mov    %eax,%edi
+    return -E_INVAL;
+  if (m->mm_perm != MAP_SHARED)
+    return 0;
+  8031c6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  if (m->mm_perm != MAP_SHARED)
+  8031cb:	83 78 10 02          	cmpl   $0x2,0x10(%eax)
+  8031cf:	74 0a                	je     8031db <msync+0x33>
+                          PTE_P | PTE_U | PTE_W)) < 0)
+      break;
+  }
+  fd->fd_offset = saved;
+  return r < 0 ? r : 0;
+}
+  8031d1:	89 d8                	mov    %ebx,%eax
+  8031d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8031d6:	5b                   	pop    %ebx
+  8031d7:	5e                   	pop    %esi
+  8031d8:	5f                   	pop    %edi
+  8031d9:	5d                   	pop    %ebp
+  8031da:	c3                   	ret
+  if ((r = fd_lookup(m->mm_fd, &fd)) < 0 || (r = fstat(m->mm_fd, &st)) < 0)
+  8031db:	83 ec 08             	sub    $0x8,%esp
+  8031de:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8031e1:	50                   	push   %eax
+  8031e2:	ff 77 08             	push   0x8(%edi)
+  8031e5:	e8 75 e3 ff ff       	call   80155f <fd_lookup>
+  8031ea:	89 c3                	mov    %eax,%ebx
+  8031ec:	83 c4 10             	add    $0x10,%esp
+  8031ef:	85 c0                	test   %eax,%eax
+  8031f1:	78 de                	js     8031d1 <msync+0x29>
+  8031f3:	83 ec 08             	sub    $0x8,%esp
+  8031f6:	8d 85 58 ff ff ff    	lea    -0xa8(%ebp),%eax
+  8031fc:	50                   	push   %eax
+  8031fd:	ff 77 08             	push   0x8(%edi)
+  803200:	e8 fd e7 ff ff       	call   801a02 <fstat>
+  803205:	89 c3                	mov    %eax,%ebx
+  803207:	83 c4 10             	add    $0x10,%esp
+  80320a:	85 c0                	test   %eax,%eax
+  80320c:	78 c3                	js     8031d1 <msync+0x29>
+  saved = fd->fd_offset;
+  80320e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803211:	8b 40 04             	mov    0x4(%eax),%eax
+  803214:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%ebp)
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE) {
+  80321a:	8b 37                	mov    (%edi),%esi
+  80321c:	eb 29                	jmp    803247 <msync+0x9f>
+    if ((r = sys_page_map(0, (void *) va, 0, (void *) va,
+  80321e:	83 ec 0c             	sub    $0xc,%esp
+  803221:	6a 07                	push   $0x7
+  803223:	8b 85 50 ff ff ff    	mov    -0xb0(%ebp),%eax
+  803229:	50                   	push   %eax
+  80322a:	6a 00                	push   $0x0
+  80322c:	50                   	push   %eax
+  80322d:	6a 00                	push   $0x0
+  80322f:	e8 11 da ff ff       	call   800c45 <sys_page_map>
+  803234:	89 c3                	mov    %eax,%ebx
+  803236:	83 c4 20             	add    $0x20,%esp
+  803239:	85 c0                	test   %eax,%eax
+  80323b:	0f 88 c0 00 00 00    	js     803301 <msync+0x159>
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE) {
+  803241:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803247:	8b 07                	mov    (%edi),%eax
+  803249:	89 85 54 ff ff ff    	mov    %eax,-0xac(%ebp)
+  80324f:	03 47 04             	add    0x4(%edi),%eax
+  803252:	39 c6                	cmp    %eax,%esi
+  803254:	0f 83 a7 00 00 00    	jae    803301 <msync+0x159>
+    if (!va_mapped(va) || !(uvpt[PGNUM(va)] & PTE_D))
+  80325a:	89 f0                	mov    %esi,%eax
+  80325c:	e8 63 fb ff ff       	call   802dc4 <va_mapped>
+  803261:	84 c0                	test   %al,%al
+  803263:	74 dc                	je     803241 <msync+0x99>
+  803265:	89 f0                	mov    %esi,%eax
+  803267:	c1 e8 0c             	shr    $0xc,%eax
+  80326a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803271:	a8 40                	test   $0x40,%al
+  803273:	74 cc                	je     803241 <msync+0x99>
+    off = m->mm_offset + (va - m->mm_va);
+  803275:	8b 47 0c             	mov    0xc(%edi),%eax
+  803278:	8b 8d 54 ff ff ff    	mov    -0xac(%ebp),%ecx
+  80327e:	29 c8                	sub    %ecx,%eax
+  803280:	01 f0                	add    %esi,%eax
+    if (off >= st.st_size)
+  803282:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  803285:	39 c2                	cmp    %eax,%edx
+  803287:	7e 78                	jle    803301 <msync+0x159>
+    n = MIN(PGSIZE, st.st_size - off);
+  803289:	29 c2                	sub    %eax,%edx
+  80328b:	89 d1                	mov    %edx,%ecx
+  80328d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803292:	39 d1                	cmp    %edx,%ecx
+  803294:	0f 4e d1             	cmovle %ecx,%edx
+  803297:	89 95 54 ff ff ff    	mov    %edx,-0xac(%ebp)
+    if ((r = seek(m->mm_fd, off)) < 0 ||
+  80329d:	83 ec 08             	sub    $0x8,%esp
+  8032a0:	50                   	push   %eax
+  8032a1:	ff 77 08             	push   0x8(%edi)
+  8032a4:	e8 b1 e6 ff ff       	call   80195a <seek>
+  8032a9:	89 c3                	mov    %eax,%ebx
+  8032ab:	83 c4 10             	add    $0x10,%esp
+  8032ae:	85 c0                	test   %eax,%eax
+  8032b0:	78 4f                	js     803301 <msync+0x159>
+        (r = write(m->mm_fd, (void *) va, n)) < 0)
+  8032b2:	89 b5 50 ff ff ff    	mov    %esi,-0xb0(%ebp)
+  8032b8:	83 ec 04             	sub    $0x4,%esp
+  8032bb:	ff b5 54 ff ff ff    	push   -0xac(%ebp)
+  8032c1:	56                   	push   %esi
+  8032c2:	ff 77 08             	push   0x8(%edi)
+  8032c5:	e8 0e e6 ff ff       	call   8018d8 <write>
+  8032ca:	89 c3                	mov    %eax,%ebx
+    if ((r = seek(m->mm_fd, off)) < 0 ||
+  8032cc:	83 c4 10             	add    $0x10,%esp
+  8032cf:	85 c0                	test   %eax,%eax
+  8032d1:	78 2e                	js     803301 <msync+0x159>
+    if (r < n && (r = write(m->mm_fd, (char *) va + r, n - r)) < 0)
+  8032d3:	8b 95 54 ff ff ff    	mov    -0xac(%ebp),%edx
+  8032d9:	39 c2                	cmp    %eax,%edx
+  8032db:	0f 8e 3d ff ff ff    	jle    80321e <msync+0x76>
+  8032e1:	89 d0                	mov    %edx,%eax
+  8032e3:	29 d8                	sub    %ebx,%eax
+  8032e5:	01 f3                	add    %esi,%ebx
+  8032e7:	83 ec 04             	sub    $0x4,%esp
+  8032ea:	50                   	push   %eax
+  8032eb:	53                   	push   %ebx
+  8032ec:	ff 77 08             	push   0x8(%edi)
+  8032ef:	e8 e4 e5 ff ff       	call   8018d8 <write>
+  8032f4:	89 c3                	mov    %eax,%ebx
+  8032f6:	83 c4 10             	add    $0x10,%esp
+  8032f9:	85 c0                	test   %eax,%eax
+  8032fb:	0f 89 1d ff ff ff    	jns    80321e <msync+0x76>
+  fd->fd_offset = saved;
+  803301:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803304:	8b 8d 4c ff ff ff    	mov    -0xb4(%ebp),%ecx
+  80330a:	89 48 04             	mov    %ecx,0x4(%eax)
+  return r < 0 ? r : 0;
+  80330d:	85 db                	test   %ebx,%ebx
+  80330f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803314:	0f 4f d8             	cmovg  %eax,%ebx
+  803317:	e9 b5 fe ff ff       	jmp    8031d1 <msync+0x29>
+    return -E_INVAL;
+  80331c:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  803321:	e9 ab fe ff ff       	jmp    8031d1 <msync+0x29>
+
+00803326 <munmap>:
+// Remove the mapping at 'addr', writing a MAP_SHARED one back first.
+//
+// Returns 0 on success, < 0 on error.
+int
+munmap(void *addr)
+{
+  803326:	55                   	push   %ebp
+  803327:	89 e5                	mov    %esp,%ebp
+  803329:	56                   	push   %esi
+  80332a:	53                   	push   %ebx
+  80332b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct Mmap *m;
+  uintptr_t va;
+  int r;
+
+  if ((m = mmap_find((uintptr_t) addr)) == NULL)
+  80332e:	89 d8                	mov    %ebx,%eax
+  803330:	e8 4d fa ff ff       	call   802d82 <mmap_find>
+  803335:	85 c0                	test   %eax,%eax
+  803337:	74 56                	je     80338f <munmap+0x69>
+  803339:	89 c6                	mov    %eax,%esi
+    return -E_INVAL;
+  if ((r = msync(addr)) < 0)
+  80333b:	83 ec 0c             	sub    $0xc,%esp
+  80333e:	53                   	push   %ebx
+  80333f:	e8 64 fe ff ff       	call   8031a8 <msync>
+  803344:	83 c4 10             	add    $0x10,%esp
+  803347:	85 c0                	test   %eax,%eax
+  803349:	78 3d                	js     803388 <munmap+0x62>
+    return r;
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE)
+  80334b:	8b 1e                	mov    (%esi),%ebx
+  80334d:	eb 06                	jmp    803355 <munmap+0x2f>
+  80334f:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803355:	8b 46 04             	mov    0x4(%esi),%eax
+  803358:	03 06                	add    (%esi),%eax
+  80335a:	39 c3                	cmp    %eax,%ebx
+  80335c:	73 1f                	jae    80337d <munmap+0x57>
+    if (va_mapped(va) && (r = sys_page_unmap(0, (void *) va)) < 0)
+  80335e:	89 d8                	mov    %ebx,%eax
+  803360:	e8 5f fa ff ff       	call   802dc4 <va_mapped>
+  803365:	84 c0                	test   %al,%al
+  803367:	74 e6                	je     80334f <munmap+0x29>
+  803369:	83 ec 08             	sub    $0x8,%esp
+  80336c:	53                   	push   %ebx
+  80336d:	6a 00                	push   $0x0
+  80336f:	e8 13 d9 ff ff       	call   800c87 <sys_page_unmap>
+  803374:	83 c4 10             	add    $0x10,%esp
+  803377:	85 c0                	test   %eax,%eax
+  803379:	79 d4                	jns    80334f <munmap+0x29>
+  80337b:	eb 0b                	jmp    803388 <munmap+0x62>
+      return r;
+  m->mm_va = 0;
+  80337d:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  return 0;
+  803383:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803388:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80338b:	5b                   	pop    %ebx
+  80338c:	5e                   	pop    %esi
+  80338d:	5d                   	pop    %ebp
+  80338e:	c3                   	ret
+    return -E_INVAL;
+  80338f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803394:	eb f2                	jmp    803388 <munmap+0x62>
+
+00803396 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  803396:	b8 00 00 00 00       	mov    $0x0,%eax
+  80339b:	c3                   	ret
+
+0080339c <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80339c:	55                   	push   %ebp
+  80339d:	89 e5                	mov    %esp,%ebp
+  80339f:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  8033a2:	68 43 3f 80 00       	push   $0x803f43
+  8033a7:	ff 75 0c             	push   0xc(%ebp)
+  8033aa:	e8 24 d4 ff ff       	call   8007d3 <strcpy>
+  return 0;
+}
+  8033af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033b4:	c9                   	leave
+  8033b5:	c3                   	ret
+
+008033b6 <devcons_write>:
+{
+  8033b6:	55                   	push   %ebp
+  8033b7:	89 e5                	mov    %esp,%ebp
+  8033b9:	57                   	push   %edi
+  8033ba:	56                   	push   %esi
+  8033bb:	53                   	push   %ebx
+  8033bc:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  8033c2:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  8033c7:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  8033cd:	eb 2e                	jmp    8033fd <devcons_write+0x47>
+    m = n - tot;
+  8033cf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8033d2:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  8033d4:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8033d9:	39 c3                	cmp    %eax,%ebx
+  8033db:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  8033de:	83 ec 04             	sub    $0x4,%esp
+  8033e1:	53                   	push   %ebx
+  8033e2:	89 f0                	mov    %esi,%eax
+  8033e4:	03 45 0c             	add    0xc(%ebp),%eax
+  8033e7:	50                   	push   %eax
+  8033e8:	57                   	push   %edi
+  8033e9:	e8 6b d5 ff ff       	call   800959 <memmove>
+    sys_cputs(buf, m);
+  8033ee:	83 c4 08             	add    $0x8,%esp
+  8033f1:	53                   	push   %ebx
+  8033f2:	57                   	push   %edi
+  8033f3:	e8 0b d7 ff ff       	call   800b03 <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  8033f8:	01 de                	add    %ebx,%esi
+  8033fa:	83 c4 10             	add    $0x10,%esp
+  8033fd:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803400:	72 cd                	jb     8033cf <devcons_write+0x19>
+}
+  803402:	89 f0                	mov    %esi,%eax
+  803404:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803407:	5b                   	pop    %ebx
+  803408:	5e                   	pop    %esi
+  803409:	5f                   	pop    %edi
+  80340a:	5d                   	pop    %ebp
+  80340b:	c3                   	ret
+
+0080340c <devcons_read>:
+{
+  80340c:	55                   	push   %ebp
+  80340d:	89 e5                	mov    %esp,%ebp
+  80340f:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  803412:	b8 00 00 00 00       	mov    $0x0,%eax
+  803417:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80341b:	75 07                	jne    803424 <devcons_read+0x18>
+  80341d:	eb 1f                	jmp    80343e <devcons_read+0x32>
+    sys_yield();
+  80341f:	e8 7c d7 ff ff       	call   800ba0 <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  803424:	e8 f8 d6 ff ff       	call   800b21 <sys_cgetc>
+  803429:	85 c0                	test   %eax,%eax
+  80342b:	74 f2                	je     80341f <devcons_read+0x13>
+  if (c < 0)
+  80342d:	78 0f                	js     80343e <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  80342f:	83 f8 04             	cmp    $0x4,%eax
+  803432:	74 0c                	je     803440 <devcons_read+0x34>
+  *(char*)vbuf = c;
+  803434:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803437:	88 02                	mov    %al,(%edx)
+  return 1;
+  803439:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80343e:	c9                   	leave
+  80343f:	c3                   	ret
+    return 0;
+  803440:	b8 00 00 00 00       	mov    $0x0,%eax
+  803445:	eb f7                	jmp    80343e <devcons_read+0x32>
+
+00803447 <cputchar>:
+{
+  803447:	55                   	push   %ebp
+  803448:	89 e5                	mov    %esp,%ebp
+  80344a:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  80344d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803450:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  803453:	6a 01                	push   $0x1
+  803455:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803458:	50                   	push   %eax
+  803459:	e8 a5 d6 ff ff       	call   800b03 <sys_cputs>
+}
+  80345e:	83 c4 10             	add    $0x10,%esp
+  803461:	c9                   	leave
+  803462:	c3                   	ret
+
+00803463 <getchar>:
+{
+  803463:	55                   	push   %ebp
+  803464:	89 e5                	mov    %esp,%ebp
+  803466:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  803469:	6a 01                	push   $0x1
+  80346b:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80346e:	50                   	push   %eax
+  80346f:	6a 00                	push   $0x0
+  803471:	e8 94 e3 ff ff       	call   80180a <read>
+  if (r < 0)
+  803476:	83 c4 10             	add    $0x10,%esp
+  803479:	85 c0                	test   %eax,%eax
+  80347b:	78 06                	js     803483 <getchar+0x20>
+  if (r < 1)
+  80347d:	74 06                	je     803485 <getchar+0x22>
+  return c;
+  80347f:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803483:	c9                   	leave
+  803484:	c3                   	ret
+    return -E_EOF;
+  803485:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80348a:	eb f7                	jmp    803483 <getchar+0x20>
+
+0080348c <iscons>:
+{
+  80348c:	55                   	push   %ebp
+  80348d:	89 e5                	mov    %esp,%ebp
+  80348f:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803492:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803495:	50                   	push   %eax
+  803496:	ff 75 08             	push   0x8(%ebp)
+  803499:	e8 c1 e0 ff ff       	call   80155f <fd_lookup>
+  80349e:	83 c4 10             	add    $0x10,%esp
+  8034a1:	85 c0                	test   %eax,%eax
+  8034a3:	78 11                	js     8034b6 <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  8034a5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8034a8:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  8034ae:	39 10                	cmp    %edx,(%eax)
+  8034b0:	0f 94 c0             	sete   %al
+  8034b3:	0f b6 c0             	movzbl %al,%eax
+}
+  8034b6:	c9                   	leave
+  8034b7:	c3                   	ret
+
+008034b8 <opencons>:
+{
+  8034b8:	55                   	push   %ebp
+  8034b9:	89 e5                	mov    %esp,%ebp
+  8034bb:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  8034be:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8034c1:	50                   	push   %eax
+  8034c2:	e8 42 e0 ff ff       	call   801509 <fd_alloc>
+  8034c7:	83 c4 10             	add    $0x10,%esp
+  8034ca:	85 c0                	test   %eax,%eax
+  8034cc:	78 3a                	js     803508 <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8034ce:	83 ec 04             	sub    $0x4,%esp
+  8034d1:	68 07 04 00 00       	push   $0x407
+  8034d6:	ff 75 f4             	push   -0xc(%ebp)
+  8034d9:	6a 00                	push   $0x0
+  8034db:	e8 22 d7 ff ff       	call   800c02 <sys_page_alloc>
+  8034e0:	83 c4 10             	add    $0x10,%esp
+  8034e3:	85 c0                	test   %eax,%eax
+  8034e5:	78 21                	js     803508 <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  8034e7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8034ea:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  8034f0:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  8034f2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8034f5:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  8034fc:	83 ec 0c             	sub    $0xc,%esp
+  8034ff:	50                   	push   %eax
+  803500:	e8 e0 df ff ff       	call   8014e5 <fd2num>
+  803505:	83 c4 10             	add    $0x10,%esp
+}
+  803508:	c9                   	leave
+  803509:	c3                   	ret
+
+0080350a <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80350a:	55                   	push   %ebp
+  80350b:	89 e5                	mov    %esp,%ebp
+  80350d:	56                   	push   %esi
+  80350e:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  80350f:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  803512:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  803518:	e8 64 d6 ff ff       	call   800b81 <sys_getenvid>
+  80351d:	83 ec 0c             	sub    $0xc,%esp
+  803520:	ff 75 0c             	push   0xc(%ebp)
+  803523:	ff 75 08             	push   0x8(%ebp)
+  803526:	56                   	push   %esi
+  803527:	50                   	push   %eax
+  803528:	68 50 3f 80 00       	push   $0x803f50
+  80352d:	e8 b3 cc ff ff       	call   8001e5 <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  803532:	83 c4 18             	add    $0x18,%esp
+  803535:	53                   	push   %ebx
+  803536:	ff 75 10             	push   0x10(%ebp)
+  803539:	e8 56 cc ff ff       	call   800194 <vcprintf>
+  cprintf("\n");
+  80353e:	c7 04 24 cf 39 80 00 	movl   $0x8039cf,(%esp)
+  803545:	e8 9b cc ff ff       	call   8001e5 <cprintf>
+  80354a:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  80354d:	cc                   	int3
+  while (1)
+  80354e:	eb fd                	jmp    80354d <_panic+0x43>
+
+00803550 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  803550:	55                   	push   %ebp
+  803551:	89 e5                	mov    %esp,%ebp
+  803553:	53                   	push   %ebx
+  803554:	83 ec 04             	sub    $0x4,%esp
+  int r;
+
+  if (_pgfault_handler == 0) {
+  803557:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  80355e:	74 0d                	je     80356d <set_pgfault_handler+0x1d>
+
+    sys_env_set_pgfault_upcall(id, _pgfault_upcall);
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  803560:	8b 45 08             	mov    0x8(%ebp),%eax
+  803563:	a3 00 70 80 00       	mov    %eax,0x807000
+}
+  803568:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80356b:	c9                   	leave
+  80356c:	c3                   	ret
+    envid_t id = sys_getenvid();
+  80356d:	e8 0f d6 ff ff       	call   800b81 <sys_getenvid>
+  803572:	89 c3                	mov    %eax,%ebx
+    sys_page_alloc(id, (void *) (UXSTACKTOP - PGSIZE), (PTE_P | PTE_U | PTE_W));
+  803574:	83 ec 04             	sub    $0x4,%esp
+  803577:	6a 07                	push   $0x7
+  803579:	68 00 f0 bf ee       	push   $0xeebff000
+  80357e:	50                   	push   %eax
+  80357f:	e8 7e d6 ff ff       	call   800c02 <sys_page_alloc>
+    sys_env_set_pgfault_upcall(id, _pgfault_upcall);
+  803584:	83 c4 08             	add    $0x8,%esp
+  803587:	68 97 35 80 00       	push   $0x803597
+  80358c:	53                   	push   %ebx
+  80358d:	e8 e5 d8 ff ff       	call   800e77 <sys_env_set_pgfault_upcall>
+  803592:	83 c4 10             	add    $0x10,%esp
+  803595:	eb c9                	jmp    803560 <set_pgfault_handler+0x10>
+
+00803597 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  803597:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  803598:	a1 00 70 80 00       	mov    0x807000,%eax
+	call *%eax
+  80359d:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80359f:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+  movl 48(%esp), %eax       // move trap time esp to eax
+  8035a2:	8b 44 24 30          	mov    0x30(%esp),%eax
+  subl $4, %eax             // make room for eip on trap time esp
+  8035a6:	83 e8 04             	sub    $0x4,%eax
+  movl %eax, 48(%esp)       // move value to esp
+  8035a9:	89 44 24 30          	mov    %eax,0x30(%esp)
+  movl 40(%esp), %ebx       // move trap time eip to ebx
+  8035ad:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+  movl %ebx, 0(%eax)
+  8035b1:	89 18                	mov    %ebx,(%eax)
+
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+  addl $0x08,%esp
+  8035b3:	83 c4 08             	add    $0x8,%esp
+  popal
+  8035b6:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+  addl $4, %esp          // skip tf->eip
+  8035b7:	83 c4 04             	add    $0x4,%esp
+  popf                 // pop stack value into flags register
+  8035ba:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+  popl %esp
+  8035bb:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+  ret
+  8035bc:	c3                   	ret
+
+008035bd <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  8035bd:	55                   	push   %ebp
+  8035be:	89 e5                	mov    %esp,%ebp
+  8035c0:	57                   	push   %edi
+  8035c1:	56                   	push   %esi
+  8035c2:	53                   	push   %ebx
+  8035c3:	83 ec 14             	sub    $0x14,%esp
+  8035c6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8035c9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8035cc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8035cf:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  8035d2:	85 c0                	test   %eax,%eax
+  8035d4:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8035d9:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  8035dc:	ff 33                	push   (%ebx)
+  8035de:	50                   	push   %eax
+  8035df:	e8 f6 d8 ff ff       	call   800eda <sys_ipc_recv>
+  8035e4:	83 c4 10             	add    $0x10,%esp
+  8035e7:	85 c0                	test   %eax,%eax
+  8035e9:	78 39                	js     803624 <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  8035eb:	85 ff                	test   %edi,%edi
+  8035ed:	74 0a                	je     8035f9 <ipc_recv_pages+0x3c>
+  8035ef:	a1 a0 58 80 00       	mov    0x8058a0,%eax
+  8035f4:	8b 40 7c             	mov    0x7c(%eax),%eax
+  8035f7:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  8035f9:	85 f6                	test   %esi,%esi
+  8035fb:	74 0d                	je     80360a <ipc_recv_pages+0x4d>
+  8035fd:	a1 a0 58 80 00       	mov    0x8058a0,%eax
+  803602:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  803608:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  80360a:	a1 a0 58 80 00       	mov    0x8058a0,%eax
+  80360f:	8b 40 74             	mov    0x74(%eax),%eax
+  803612:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  803614:	a1 a0 58 80 00       	mov    0x8058a0,%eax
+  803619:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  80361c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80361f:	5b                   	pop    %ebx
+  803620:	5e                   	pop    %esi
+  803621:	5f                   	pop    %edi
+  803622:	5d                   	pop    %ebp
+  803623:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  803624:	85 ff                	test   %edi,%edi
+  803626:	74 06                	je     80362e <ipc_recv_pages+0x71>
+  803628:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  80362e:	85 f6                	test   %esi,%esi
+  803630:	74 06                	je     803638 <ipc_recv_pages+0x7b>
+  803632:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  803638:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  80363e:	eb dc                	jmp    80361c <ipc_recv_pages+0x5f>
+
+00803640 <ipc_recv>:
+{
+  803640:	55                   	push   %ebp
+  803641:	89 e5                	mov    %esp,%ebp
+  803643:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  803646:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  80364d:	ff 75 10             	push   0x10(%ebp)
+  803650:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803653:	50                   	push   %eax
+  803654:	ff 75 0c             	push   0xc(%ebp)
+  803657:	ff 75 08             	push   0x8(%ebp)
+  80365a:	e8 5e ff ff ff       	call   8035bd <ipc_recv_pages>
+}
+  80365f:	c9                   	leave
+  803660:	c3                   	ret
+
+00803661 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  803661:	55                   	push   %ebp
+  803662:	89 e5                	mov    %esp,%ebp
+  803664:	57                   	push   %edi
+  803665:	56                   	push   %esi
+  803666:	53                   	push   %ebx
+  803667:	83 ec 0c             	sub    $0xc,%esp
+  80366a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80366d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803670:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  803673:	89 c3                	mov    %eax,%ebx
+  803675:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  80367b:	85 c0                	test   %eax,%eax
+  80367d:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  803682:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  803685:	83 ec 0c             	sub    $0xc,%esp
+  803688:	ff 75 14             	push   0x14(%ebp)
+  80368b:	ff 75 18             	push   0x18(%ebp)
+  80368e:	53                   	push   %ebx
+  80368f:	56                   	push   %esi
+  803690:	57                   	push   %edi
+  803691:	e8 23 d8 ff ff       	call   800eb9 <sys_ipc_try_send>
+  803696:	83 c4 20             	add    $0x20,%esp
+  803699:	85 c0                	test   %eax,%eax
+  80369b:	79 1e                	jns    8036bb <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  80369d:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8036a0:	75 07                	jne    8036a9 <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  8036a2:	e8 f9 d4 ff ff       	call   800ba0 <sys_yield>
+  8036a7:	eb dc                	jmp    803685 <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  8036a9:	50                   	push   %eax
+  8036aa:	68 73 3f 80 00       	push   $0x803f73
+  8036af:	6a 5c                	push   $0x5c
+  8036b1:	68 80 3f 80 00       	push   $0x803f80
+  8036b6:	e8 4f fe ff ff       	call   80350a <_panic>
+  }
+}
+  8036bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8036be:	5b                   	pop    %ebx
+  8036bf:	5e                   	pop    %esi
+  8036c0:	5f                   	pop    %edi
+  8036c1:	5d                   	pop    %ebp
+  8036c2:	c3                   	ret
+
+008036c3 <ipc_send>:
+{
+  8036c3:	55                   	push   %ebp
+  8036c4:	89 e5                	mov    %esp,%ebp
+  8036c6:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  8036c9:	ff 75 14             	push   0x14(%ebp)
+  8036cc:	6a 01                	push   $0x1
+  8036ce:	ff 75 10             	push   0x10(%ebp)
+  8036d1:	ff 75 0c             	push   0xc(%ebp)
+  8036d4:	ff 75 08             	push   0x8(%ebp)
+  8036d7:	e8 85 ff ff ff       	call   803661 <ipc_send_pages>
+}
+  8036dc:	83 c4 20             	add    $0x20,%esp
+  8036df:	c9                   	leave
+  8036e0:	c3                   	ret
+
+008036e1 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8036e1:	55                   	push   %ebp
+  8036e2:	89 e5                	mov    %esp,%ebp
+  8036e4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  8036e7:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  8036ec:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8036ef:	c1 e0 04             	shl    $0x4,%eax
+  8036f2:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8036f7:	8b 40 50             	mov    0x50(%eax),%eax
+  8036fa:	39 c8                	cmp    %ecx,%eax
+  8036fc:	74 12                	je     803710 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  8036fe:	83 c2 01             	add    $0x1,%edx
+  803701:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  803707:	75 e3                	jne    8036ec <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  803709:	b8 00 00 00 00       	mov    $0x0,%eax
+  80370e:	eb 0e                	jmp    80371e <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  803710:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803713:	c1 e0 04             	shl    $0x4,%eax
+  803716:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80371b:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  80371e:	5d                   	pop    %ebp
+  80371f:	c3                   	ret
+
+00803720 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803720:	55                   	push   %ebp
+  803721:	89 e5                	mov    %esp,%ebp
+  803723:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  803726:	89 c2                	mov    %eax,%edx
+  803728:	c1 ea 16             	shr    $0x16,%edx
+  80372b:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  803732:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  803737:	f6 c1 01             	test   $0x1,%cl
+  80373a:	74 1c                	je     803758 <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  80373c:	c1 e8 0c             	shr    $0xc,%eax
+  80373f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  803746:	a8 01                	test   $0x1,%al
+  803748:	74 0e                	je     803758 <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  80374a:	c1 e8 0c             	shr    $0xc,%eax
+  80374d:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  803754:	ef 
+  803755:	0f b7 d2             	movzwl %dx,%edx
+}
+  803758:	89 d0                	mov    %edx,%eax
+  80375a:	5d                   	pop    %ebp
+  80375b:	c3                   	ret
+
+0080375c <udivmod>:
+  80375c:	55                   	push   %ebp
+  80375d:	57                   	push   %edi
+  80375e:	56                   	push   %esi
+  80375f:	53                   	push   %ebx
+  803760:	83 ec 14             	sub    $0x14,%esp
+  803763:	8b 74 24 28          	mov    0x28(%esp),%esi
+  803767:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  80376b:	89 fb                	mov    %edi,%ebx
+  80376d:	09 f3                	or     %esi,%ebx
+  80376f:	0f 84 88 00 00 00    	je     8037fd <udivmod+0xa1>
+  803775:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80377a:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  803781:	00 
+  803782:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  803789:	00 
+  80378a:	89 cd                	mov    %ecx,%ebp
+  80378c:	89 34 24             	mov    %esi,(%esp)
+  80378f:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  803793:	eb 08                	jmp    80379d <udivmod+0x41>
+  803795:	83 ed 01             	sub    $0x1,%ebp
+  803798:	83 fd ff             	cmp    $0xffffffff,%ebp
+  80379b:	74 6c                	je     803809 <udivmod+0xad>
+  80379d:	89 c3                	mov    %eax,%ebx
+  80379f:	89 d6                	mov    %edx,%esi
+  8037a1:	89 e9                	mov    %ebp,%ecx
+  8037a3:	0f ad f3             	shrd   %cl,%esi,%ebx
+  8037a6:	d3 ee                	shr    %cl,%esi
+  8037a8:	f6 c1 20             	test   $0x20,%cl
+  8037ab:	74 04                	je     8037b1 <udivmod+0x55>
+  8037ad:	89 f3                	mov    %esi,%ebx
+  8037af:	31 f6                	xor    %esi,%esi
+  8037b1:	8b 3c 24             	mov    (%esp),%edi
+  8037b4:	39 fb                	cmp    %edi,%ebx
+  8037b6:	89 f7                	mov    %esi,%edi
+  8037b8:	8b 1c 24             	mov    (%esp),%ebx
+  8037bb:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8037bf:	19 f7                	sbb    %esi,%edi
+  8037c1:	72 d2                	jb     803795 <udivmod+0x39>
+  8037c3:	89 f7                	mov    %esi,%edi
+  8037c5:	89 de                	mov    %ebx,%esi
+  8037c7:	89 e9                	mov    %ebp,%ecx
+  8037c9:	0f a5 f7             	shld   %cl,%esi,%edi
+  8037cc:	d3 e6                	shl    %cl,%esi
+  8037ce:	f6 c1 20             	test   $0x20,%cl
+  8037d1:	74 04                	je     8037d7 <udivmod+0x7b>
+  8037d3:	89 f7                	mov    %esi,%edi
+  8037d5:	31 f6                	xor    %esi,%esi
+  8037d7:	29 f0                	sub    %esi,%eax
+  8037d9:	19 fa                	sbb    %edi,%edx
+  8037db:	be 01 00 00 00       	mov    $0x1,%esi
+  8037e0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037e5:	0f a5 f7             	shld   %cl,%esi,%edi
+  8037e8:	d3 e6                	shl    %cl,%esi
+  8037ea:	f6 c1 20             	test   $0x20,%cl
+  8037ed:	74 04                	je     8037f3 <udivmod+0x97>
+  8037ef:	89 f7                	mov    %esi,%edi
+  8037f1:	31 f6                	xor    %esi,%esi
+  8037f3:	09 74 24 08          	or     %esi,0x8(%esp)
+  8037f7:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8037fb:	eb 98                	jmp    803795 <udivmod+0x39>
+  8037fd:	89 f0                	mov    %esi,%eax
+  8037ff:	89 fa                	mov    %edi,%edx
+  803801:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803805:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  803809:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  80380d:	89 01                	mov    %eax,(%ecx)
+  80380f:	89 51 04             	mov    %edx,0x4(%ecx)
+  803812:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803816:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80381a:	83 c4 14             	add    $0x14,%esp
+  80381d:	5b                   	pop    %ebx
+  80381e:	5e                   	pop    %esi
+  80381f:	5f                   	pop    %edi
+  803820:	5d                   	pop    %ebp
+  803821:	c3                   	ret
+
+00803822 <__udivdi3>:
+  803822:	83 ec 18             	sub    $0x18,%esp
+  803825:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803829:	50                   	push   %eax
+  80382a:	ff 74 24 2c          	push   0x2c(%esp)
+  80382e:	ff 74 24 2c          	push   0x2c(%esp)
+  803832:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803836:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80383a:	e8 1d ff ff ff       	call   80375c <udivmod>
+  80383f:	83 c4 24             	add    $0x24,%esp
+  803842:	c3                   	ret
+
+00803843 <__umoddi3>:
+  803843:	83 ec 18             	sub    $0x18,%esp
+  803846:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80384a:	50                   	push   %eax
+  80384b:	ff 74 24 2c          	push   0x2c(%esp)
+  80384f:	ff 74 24 2c          	push   0x2c(%esp)
+  803853:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803857:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80385b:	e8 fc fe ff ff       	call   80375c <udivmod>
+  803860:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803864:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803868:	83 c4 24             	add    $0x24,%esp
+  80386b:	c3                   	ret
+
+0080386c <__divdi3>:
+  80386c:	56                   	push   %esi
+  80386d:	53                   	push   %ebx
+  80386e:	83 ec 14             	sub    $0x14,%esp
+  803871:	8b 44 24 20          	mov    0x20(%esp),%eax
+  803875:	8b 54 24 24          	mov    0x24(%esp),%edx
+  803879:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  80387d:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  803881:	85 d2                	test   %edx,%edx
+  803883:	78 18                	js     80389d <__divdi3+0x31>
+  803885:	85 db                	test   %ebx,%ebx
+  803887:	78 3e                	js     8038c7 <__divdi3+0x5b>
+  803889:	83 ec 04             	sub    $0x4,%esp
+  80388c:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803890:	56                   	push   %esi
+  803891:	53                   	push   %ebx
+  803892:	51                   	push   %ecx
+  803893:	e8 c4 fe ff ff       	call   80375c <udivmod>
+  803898:	83 c4 10             	add    $0x10,%esp
+  80389b:	eb 24                	jmp    8038c1 <__divdi3+0x55>
+  80389d:	f7 d8                	neg    %eax
+  80389f:	83 d2 00             	adc    $0x0,%edx
+  8038a2:	f7 da                	neg    %edx
+  8038a4:	85 db                	test   %ebx,%ebx
+  8038a6:	78 3a                	js     8038e2 <__divdi3+0x76>
+  8038a8:	83 ec 04             	sub    $0x4,%esp
+  8038ab:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8038af:	56                   	push   %esi
+  8038b0:	53                   	push   %ebx
+  8038b1:	51                   	push   %ecx
+  8038b2:	e8 a5 fe ff ff       	call   80375c <udivmod>
+  8038b7:	83 c4 10             	add    $0x10,%esp
+  8038ba:	f7 d8                	neg    %eax
+  8038bc:	83 d2 00             	adc    $0x0,%edx
+  8038bf:	f7 da                	neg    %edx
+  8038c1:	83 c4 14             	add    $0x14,%esp
+  8038c4:	5b                   	pop    %ebx
+  8038c5:	5e                   	pop    %esi
+  8038c6:	c3                   	ret
+  8038c7:	83 ec 04             	sub    $0x4,%esp
+  8038ca:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8038ce:	56                   	push   %esi
+  8038cf:	f7 d9                	neg    %ecx
+  8038d1:	83 d3 00             	adc    $0x0,%ebx
+  8038d4:	f7 db                	neg    %ebx
+  8038d6:	53                   	push   %ebx
+  8038d7:	51                   	push   %ecx
+  8038d8:	e8 7f fe ff ff       	call   80375c <udivmod>
+  8038dd:	83 c4 10             	add    $0x10,%esp
+  8038e0:	eb d8                	jmp    8038ba <__divdi3+0x4e>
+  8038e2:	83 ec 04             	sub    $0x4,%esp
+  8038e5:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8038e9:	56                   	push   %esi
+  8038ea:	f7 d9                	neg    %ecx
+  8038ec:	83 d3 00             	adc    $0x0,%ebx
+  8038ef:	f7 db                	neg    %ebx
+  8038f1:	53                   	push   %ebx
+  8038f2:	51                   	push   %ecx
+  8038f3:	e8 64 fe ff ff       	call   80375c <udivmod>
+  8038f8:	83 c4 10             	add    $0x10,%esp
+  8038fb:	eb c4                	jmp    8038c1 <__divdi3+0x55>
+
+008038fd <__moddi3>:
+  8038fd:	55                   	push   %ebp
+  8038fe:	57                   	push   %edi
+  8038ff:	56                   	push   %esi
+  803900:	53                   	push   %ebx
+  803901:	83 ec 24             	sub    $0x24,%esp
+  803904:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803908:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80390c:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  803910:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  803914:	85 d2                	test   %edx,%edx
+  803916:	78 3b                	js     803953 <__moddi3+0x56>
+  803918:	83 ec 04             	sub    $0x4,%esp
+  80391b:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  80391f:	56                   	push   %esi
+  803920:	89 ce                	mov    %ecx,%esi
+  803922:	f7 de                	neg    %esi
+  803924:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803928:	89 de                	mov    %ebx,%esi
+  80392a:	83 d6 00             	adc    $0x0,%esi
+  80392d:	f7 de                	neg    %esi
+  80392f:	89 74 24 14          	mov    %esi,0x14(%esp)
+  803933:	8b 74 24 08          	mov    0x8(%esp),%esi
+  803937:	0f 48 f1             	cmovs  %ecx,%esi
+  80393a:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  80393f:	53                   	push   %ebx
+  803940:	56                   	push   %esi
+  803941:	e8 16 fe ff ff       	call   80375c <udivmod>
+  803946:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80394a:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80394e:	83 c4 10             	add    $0x10,%esp
+  803951:	eb 47                	jmp    80399a <__moddi3+0x9d>
+  803953:	f7 d8                	neg    %eax
+  803955:	83 d2 00             	adc    $0x0,%edx
+  803958:	f7 da                	neg    %edx
+  80395a:	83 ec 04             	sub    $0x4,%esp
+  80395d:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803961:	56                   	push   %esi
+  803962:	89 cf                	mov    %ecx,%edi
+  803964:	f7 df                	neg    %edi
+  803966:	89 de                	mov    %ebx,%esi
+  803968:	83 d6 00             	adc    $0x0,%esi
+  80396b:	f7 de                	neg    %esi
+  80396d:	0f 49 cf             	cmovns %edi,%ecx
+  803970:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  803974:	0f 49 de             	cmovns %esi,%ebx
+  803977:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  80397b:	ff 74 24 0c          	push   0xc(%esp)
+  80397f:	ff 74 24 0c          	push   0xc(%esp)
+  803983:	e8 d4 fd ff ff       	call   80375c <udivmod>
+  803988:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80398c:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803990:	f7 d8                	neg    %eax
+  803992:	83 d2 00             	adc    $0x0,%edx
+  803995:	f7 da                	neg    %edx
+  803997:	83 c4 10             	add    $0x10,%esp
+  80399a:	83 c4 24             	add    $0x24,%esp
+  80399d:	5b                   	pop    %ebx
+  80399e:	5e                   	pop    %esi
+  80399f:	5f                   	pop    %edi
+  8039a0:	5d                   	pop    %ebp
+  8039a1:	c3                   	ret
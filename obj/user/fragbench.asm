@@ -0,0 +1,6698 @@
+
+obj/user/fragbench.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 7b 03 00 00       	call   8003ac <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <writefiles>:
+
+// Write NFILES files named 'prefix'N of 'size' bytes, a block of each
+// in turn if 'interleave', else one file after another.
+static void
+writefiles(const char *prefix, off_t size, bool interleave)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	81 ec ac 00 00 00    	sub    $0xac,%esp
+  80003f:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%ebp)
+  800045:	88 8d 57 ff ff ff    	mov    %cl,-0xa9(%ebp)
+  char path[MAXNAMELEN];
+  int fds[NFILES], n, i, r;
+
+  for (i = 0; i < NFILES; i++) {
+  80004b:	bb 00 00 00 00       	mov    $0x0,%ebx
+    snprintf(path, sizeof(path), "%s%d", prefix, i);
+  800050:	8d b5 68 ff ff ff    	lea    -0x98(%ebp),%esi
+  800056:	89 c7                	mov    %eax,%edi
+  800058:	89 95 50 ff ff ff    	mov    %edx,-0xb0(%ebp)
+  80005e:	83 ec 0c             	sub    $0xc,%esp
+  800061:	53                   	push   %ebx
+  800062:	57                   	push   %edi
+  800063:	68 c0 31 80 00       	push   $0x8031c0
+  800068:	68 80 00 00 00       	push   $0x80
+  80006d:	56                   	push   %esi
+  80006e:	e8 1a 0a 00 00       	call   800a8d <snprintf>
+    if ((fds[i] = open(path, O_RDWR | O_CREAT | O_TRUNC)) < 0)
+  800073:	83 c4 18             	add    $0x18,%esp
+  800076:	68 02 03 00 00       	push   $0x302
+  80007b:	56                   	push   %esi
+  80007c:	e8 8f 1e 00 00       	call   801f10 <open>
+  800081:	89 84 9d 58 ff ff ff 	mov    %eax,-0xa8(%ebp,%ebx,4)
+  800088:	83 c4 10             	add    $0x10,%esp
+  80008b:	85 c0                	test   %eax,%eax
+  80008d:	78 39                	js     8000c8 <writefiles+0x95>
+  for (i = 0; i < NFILES; i++) {
+  80008f:	83 c3 01             	add    $0x1,%ebx
+  800092:	83 fb 04             	cmp    $0x4,%ebx
+  800095:	75 c7                	jne    80005e <writefiles+0x2b>
+      panic("open %s: %e", path, fds[i]);
+  }
+  for (n = 0; n < NFILES * size / BLKSIZE; n++) {
+  800097:	8b 95 50 ff ff ff    	mov    -0xb0(%ebp),%edx
+  80009d:	8d 82 ff 03 00 00    	lea    0x3ff(%edx),%eax
+  8000a3:	85 d2                	test   %edx,%edx
+  8000a5:	0f 49 c2             	cmovns %edx,%eax
+  8000a8:	c1 f8 0a             	sar    $0xa,%eax
+  8000ab:	89 c7                	mov    %eax,%edi
+    i = interleave ? n % NFILES : n / (size / BLKSIZE);
+  8000ad:	8d 82 ff 0f 00 00    	lea    0xfff(%edx),%eax
+  8000b3:	85 d2                	test   %edx,%edx
+  8000b5:	0f 49 c2             	cmovns %edx,%eax
+  8000b8:	c1 f8 0c             	sar    $0xc,%eax
+  8000bb:	89 85 50 ff ff ff    	mov    %eax,-0xb0(%ebp)
+  for (n = 0; n < NFILES * size / BLKSIZE; n++) {
+  8000c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8000c6:	eb 4d                	jmp    800115 <writefiles+0xe2>
+      panic("open %s: %e", path, fds[i]);
+  8000c8:	83 ec 0c             	sub    $0xc,%esp
+  8000cb:	50                   	push   %eax
+  8000cc:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8000d2:	50                   	push   %eax
+  8000d3:	68 c5 31 80 00       	push   $0x8031c5
+  8000d8:	6a 1b                	push   $0x1b
+  8000da:	68 d1 31 80 00       	push   $0x8031d1
+  8000df:	e8 35 03 00 00       	call   800419 <_panic>
+    i = interleave ? n % NFILES : n / (size / BLKSIZE);
+  8000e4:	89 d8                	mov    %ebx,%eax
+  8000e6:	99                   	cltd
+  8000e7:	f7 bd 50 ff ff ff    	idivl  -0xb0(%ebp)
+  8000ed:	89 c6                	mov    %eax,%esi
+    if ((r = write(fds[i], buf, BLKSIZE)) != BLKSIZE)
+  8000ef:	83 ec 04             	sub    $0x4,%esp
+  8000f2:	68 00 10 00 00       	push   $0x1000
+  8000f7:	68 00 50 80 00       	push   $0x805000
+  8000fc:	ff b4 b5 58 ff ff ff 	push   -0xa8(%ebp,%esi,4)
+  800103:	e8 ab 16 00 00       	call   8017b3 <write>
+  800108:	83 c4 10             	add    $0x10,%esp
+  80010b:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800110:	75 22                	jne    800134 <writefiles+0x101>
+  for (n = 0; n < NFILES * size / BLKSIZE; n++) {
+  800112:	83 c3 01             	add    $0x1,%ebx
+  800115:	39 df                	cmp    %ebx,%edi
+  800117:	7e 37                	jle    800150 <writefiles+0x11d>
+    i = interleave ? n % NFILES : n / (size / BLKSIZE);
+  800119:	80 bd 57 ff ff ff 00 	cmpb   $0x0,-0xa9(%ebp)
+  800120:	74 c2                	je     8000e4 <writefiles+0xb1>
+  800122:	89 d8                	mov    %ebx,%eax
+  800124:	c1 f8 1f             	sar    $0x1f,%eax
+  800127:	c1 e8 1e             	shr    $0x1e,%eax
+  80012a:	8d 34 03             	lea    (%ebx,%eax,1),%esi
+  80012d:	83 e6 03             	and    $0x3,%esi
+  800130:	29 c6                	sub    %eax,%esi
+  800132:	eb bb                	jmp    8000ef <writefiles+0xbc>
+      panic("write %s%d: %e", prefix, i, r);
+  800134:	83 ec 08             	sub    $0x8,%esp
+  800137:	50                   	push   %eax
+  800138:	56                   	push   %esi
+  800139:	ff b5 4c ff ff ff    	push   -0xb4(%ebp)
+  80013f:	68 e2 31 80 00       	push   $0x8031e2
+  800144:	6a 20                	push   $0x20
+  800146:	68 d1 31 80 00       	push   $0x8031d1
+  80014b:	e8 c9 02 00 00       	call   800419 <_panic>
+  800150:	8d 9d 58 ff ff ff    	lea    -0xa8(%ebp),%ebx
+  800156:	8d b5 68 ff ff ff    	lea    -0x98(%ebp),%esi
+  80015c:	eb 10                	jmp    80016e <writefiles+0x13b>
+  }
+  for (i = 0; i < NFILES; i++)
+    close(fds[i]);
+  80015e:	83 ec 0c             	sub    $0xc,%esp
+  800161:	ff 33                	push   (%ebx)
+  800163:	e8 f5 13 00 00       	call   80155d <close>
+  for (i = 0; i < NFILES; i++)
+  800168:	83 c3 04             	add    $0x4,%ebx
+  80016b:	83 c4 10             	add    $0x10,%esp
+  80016e:	39 f3                	cmp    %esi,%ebx
+  800170:	75 ec                	jne    80015e <writefiles+0x12b>
+  if ((r = sync()) < 0)
+  800172:	e8 81 20 00 00       	call   8021f8 <sync>
+  800177:	85 c0                	test   %eax,%eax
+  800179:	78 08                	js     800183 <writefiles+0x150>
+    panic("sync: %e", r);
+}
+  80017b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80017e:	5b                   	pop    %ebx
+  80017f:	5e                   	pop    %esi
+  800180:	5f                   	pop    %edi
+  800181:	5d                   	pop    %ebp
+  800182:	c3                   	ret
+    panic("sync: %e", r);
+  800183:	50                   	push   %eax
+  800184:	68 f1 31 80 00       	push   $0x8031f1
+  800189:	6a 25                	push   $0x25
+  80018b:	68 d1 31 80 00       	push   $0x8031d1
+  800190:	e8 84 02 00 00       	call   800419 <_panic>
+
+00800195 <readfiles>:
+
+// Read the files back one after another; returns KB/s.
+static unsigned
+readfiles(const char *prefix, off_t size)
+{
+  800195:	55                   	push   %ebp
+  800196:	89 e5                	mov    %esp,%ebp
+  800198:	57                   	push   %edi
+  800199:	56                   	push   %esi
+  80019a:	53                   	push   %ebx
+  80019b:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  8001a1:	89 85 60 ff ff ff    	mov    %eax,-0xa0(%ebp)
+  8001a7:	89 d6                	mov    %edx,%esi
+  char path[MAXNAMELEN];
+  unsigned start, ms;
+  int fd, i, r;
+  off_t off;
+
+  if ((r = fs_dropcache()) < 0)
+  8001a9:	e8 ad 20 00 00       	call   80225b <fs_dropcache>
+  8001ae:	85 c0                	test   %eax,%eax
+  8001b0:	78 17                	js     8001c9 <readfiles+0x34>
+    panic("fs_dropcache: %e", r);
+  start = sys_time_msec();
+  8001b2:	e8 74 10 00 00       	call   80122b <sys_time_msec>
+  8001b7:	89 85 5c ff ff ff    	mov    %eax,-0xa4(%ebp)
+  for (i = 0; i < NFILES; i++) {
+  8001bd:	c7 85 64 ff ff ff 00 	movl   $0x0,-0x9c(%ebp)
+  8001c4:	00 00 00 
+  8001c7:	eb 68                	jmp    800231 <readfiles+0x9c>
+    panic("fs_dropcache: %e", r);
+  8001c9:	50                   	push   %eax
+  8001ca:	68 fa 31 80 00       	push   $0x8031fa
+  8001cf:	6a 32                	push   $0x32
+  8001d1:	68 d1 31 80 00       	push   $0x8031d1
+  8001d6:	e8 3e 02 00 00       	call   800419 <_panic>
+    snprintf(path, sizeof(path), "%s%d", prefix, i);
+    if ((fd = open(path, O_RDONLY)) < 0)
+      panic("open %s: %e", path, fd);
+  8001db:	83 ec 0c             	sub    $0xc,%esp
+  8001de:	50                   	push   %eax
+  8001df:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  8001e5:	50                   	push   %eax
+  8001e6:	68 c5 31 80 00       	push   $0x8031c5
+  8001eb:	6a 37                	push   $0x37
+  8001ed:	68 d1 31 80 00       	push   $0x8031d1
+  8001f2:	e8 22 02 00 00       	call   800419 <_panic>
+    for (off = 0; off < size; off += BLKSIZE)
+      if ((r = readn(fd, buf, BLKSIZE)) != BLKSIZE)
+        panic("read %s: %e", path, r);
+  8001f7:	83 ec 0c             	sub    $0xc,%esp
+  8001fa:	50                   	push   %eax
+  8001fb:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  800201:	50                   	push   %eax
+  800202:	68 0b 32 80 00       	push   $0x80320b
+  800207:	6a 3a                	push   $0x3a
+  800209:	68 d1 31 80 00       	push   $0x8031d1
+  80020e:	e8 06 02 00 00       	call   800419 <_panic>
+    close(fd);
+  800213:	83 ec 0c             	sub    $0xc,%esp
+  800216:	57                   	push   %edi
+  800217:	e8 41 13 00 00       	call   80155d <close>
+  for (i = 0; i < NFILES; i++) {
+  80021c:	83 85 64 ff ff ff 01 	addl   $0x1,-0x9c(%ebp)
+  800223:	8b 85 64 ff ff ff    	mov    -0x9c(%ebp),%eax
+  800229:	83 c4 10             	add    $0x10,%esp
+  80022c:	83 f8 04             	cmp    $0x4,%eax
+  80022f:	74 75                	je     8002a6 <readfiles+0x111>
+    snprintf(path, sizeof(path), "%s%d", prefix, i);
+  800231:	83 ec 0c             	sub    $0xc,%esp
+  800234:	ff b5 64 ff ff ff    	push   -0x9c(%ebp)
+  80023a:	ff b5 60 ff ff ff    	push   -0xa0(%ebp)
+  800240:	68 c0 31 80 00       	push   $0x8031c0
+  800245:	68 80 00 00 00       	push   $0x80
+  80024a:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  800250:	50                   	push   %eax
+  800251:	e8 37 08 00 00       	call   800a8d <snprintf>
+    if ((fd = open(path, O_RDONLY)) < 0)
+  800256:	83 c4 18             	add    $0x18,%esp
+  800259:	6a 00                	push   $0x0
+  80025b:	8d 85 68 ff ff ff    	lea    -0x98(%ebp),%eax
+  800261:	50                   	push   %eax
+  800262:	e8 a9 1c 00 00       	call   801f10 <open>
+  800267:	89 c7                	mov    %eax,%edi
+  800269:	83 c4 10             	add    $0x10,%esp
+  80026c:	85 c0                	test   %eax,%eax
+  80026e:	0f 88 67 ff ff ff    	js     8001db <readfiles+0x46>
+    for (off = 0; off < size; off += BLKSIZE)
+  800274:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800279:	39 f3                	cmp    %esi,%ebx
+  80027b:	7d 96                	jge    800213 <readfiles+0x7e>
+      if ((r = readn(fd, buf, BLKSIZE)) != BLKSIZE)
+  80027d:	83 ec 04             	sub    $0x4,%esp
+  800280:	68 00 10 00 00       	push   $0x1000
+  800285:	68 00 50 80 00       	push   $0x805000
+  80028a:	57                   	push   %edi
+  80028b:	e8 dc 14 00 00       	call   80176c <readn>
+  800290:	83 c4 10             	add    $0x10,%esp
+  800293:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800298:	0f 85 59 ff ff ff    	jne    8001f7 <readfiles+0x62>
+    for (off = 0; off < size; off += BLKSIZE)
+  80029e:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8002a4:	eb d3                	jmp    800279 <readfiles+0xe4>
+  }
+  ms = sys_time_msec() - start;
+  8002a6:	e8 80 0f 00 00       	call   80122b <sys_time_msec>
+  8002ab:	89 c1                	mov    %eax,%ecx
+  return size / 1024 * NFILES * 1000 / MAX(ms, 1);
+  8002ad:	8d 86 ff 03 00 00    	lea    0x3ff(%esi),%eax
+  8002b3:	85 f6                	test   %esi,%esi
+  8002b5:	0f 49 c6             	cmovns %esi,%eax
+  8002b8:	c1 f8 0a             	sar    $0xa,%eax
+  8002bb:	69 c0 a0 0f 00 00    	imul   $0xfa0,%eax,%eax
+  ms = sys_time_msec() - start;
+  8002c1:	8b 95 5c ff ff ff    	mov    -0xa4(%ebp),%edx
+  8002c7:	29 d1                	sub    %edx,%ecx
+  return size / 1024 * NFILES * 1000 / MAX(ms, 1);
+  8002c9:	ba 01 00 00 00       	mov    $0x1,%edx
+  8002ce:	0f 44 ca             	cmove  %edx,%ecx
+  8002d1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002d6:	f7 f1                	div    %ecx
+}
+  8002d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002db:	5b                   	pop    %ebx
+  8002dc:	5e                   	pop    %esi
+  8002dd:	5f                   	pop    %edi
+  8002de:	5d                   	pop    %ebp
+  8002df:	c3                   	ret
+
+008002e0 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8002e0:	55                   	push   %ebp
+  8002e1:	89 e5                	mov    %esp,%ebp
+  8002e3:	56                   	push   %esi
+  8002e4:	53                   	push   %ebx
+  off_t size;
+
+  binaryname = "fragbench";
+  8002e5:	c7 05 00 40 80 00 17 	movl   $0x803217,0x804000
+  8002ec:	32 80 00 
+  size = 256 * 1024;
+  8002ef:	b8 00 00 04 00       	mov    $0x40000,%eax
+  if (argc > 1)
+  8002f4:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+  8002f8:	0f 8f 91 00 00 00    	jg     80038f <umain+0xaf>
+    size = strtol(argv[1], 0, 0) * 1024;
+  size = ROUNDUP(size, BLKSIZE);
+  8002fe:	8d 98 ff 0f 00 00    	lea    0xfff(%eax),%ebx
+  800304:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  memset(buf, 'f', sizeof(buf));
+  80030a:	83 ec 04             	sub    $0x4,%esp
+  80030d:	68 00 10 00 00       	push   $0x1000
+  800312:	6a 66                	push   $0x66
+  800314:	68 00 50 80 00       	push   $0x805000
+  800319:	e8 15 09 00 00       	call   800c33 <memset>
+
+  writefiles("/fragbench.i", size, 1);
+  80031e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800323:	89 da                	mov    %ebx,%edx
+  800325:	b8 21 32 80 00       	mov    $0x803221,%eax
+  80032a:	e8 04 fd ff ff       	call   800033 <writefiles>
+  writefiles("/fragbench.s", size, 0);
+  80032f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800334:	89 da                	mov    %ebx,%edx
+  800336:	b8 2e 32 80 00       	mov    $0x80322e,%eax
+  80033b:	e8 f3 fc ff ff       	call   800033 <writefiles>
+  cprintf("fragbench: %d files of %d KB, written side by side:  %5d KB/s\n",
+  800340:	89 da                	mov    %ebx,%edx
+  800342:	b8 21 32 80 00       	mov    $0x803221,%eax
+  800347:	e8 49 fe ff ff       	call   800195 <readfiles>
+  80034c:	8d b3 ff 03 00 00    	lea    0x3ff(%ebx),%esi
+  800352:	83 c4 10             	add    $0x10,%esp
+  800355:	85 db                	test   %ebx,%ebx
+  800357:	0f 49 f3             	cmovns %ebx,%esi
+  80035a:	c1 fe 0a             	sar    $0xa,%esi
+  80035d:	50                   	push   %eax
+  80035e:	56                   	push   %esi
+  80035f:	6a 04                	push   $0x4
+  800361:	68 3c 32 80 00       	push   $0x80323c
+  800366:	e8 89 01 00 00       	call   8004f4 <cprintf>
+          NFILES, size / 1024, readfiles("/fragbench.i", size));
+  cprintf("fragbench: %d files of %d KB, written one by one:    %5d KB/s\n",
+  80036b:	89 da                	mov    %ebx,%edx
+  80036d:	b8 2e 32 80 00       	mov    $0x80322e,%eax
+  800372:	e8 1e fe ff ff       	call   800195 <readfiles>
+  800377:	50                   	push   %eax
+  800378:	56                   	push   %esi
+  800379:	6a 04                	push   $0x4
+  80037b:	68 7c 32 80 00       	push   $0x80327c
+  800380:	e8 6f 01 00 00       	call   8004f4 <cprintf>
+          NFILES, size / 1024, readfiles("/fragbench.s", size));
+}
+  800385:	83 c4 20             	add    $0x20,%esp
+  800388:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80038b:	5b                   	pop    %ebx
+  80038c:	5e                   	pop    %esi
+  80038d:	5d                   	pop    %ebp
+  80038e:	c3                   	ret
+    size = strtol(argv[1], 0, 0) * 1024;
+  80038f:	83 ec 04             	sub    $0x4,%esp
+  800392:	6a 00                	push   $0x0
+  800394:	6a 00                	push   $0x0
+  800396:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800399:	ff 70 04             	push   0x4(%eax)
+  80039c:	e8 95 09 00 00       	call   800d36 <strtol>
+  8003a1:	c1 e0 0a             	shl    $0xa,%eax
+  8003a4:	83 c4 10             	add    $0x10,%esp
+  8003a7:	e9 52 ff ff ff       	jmp    8002fe <umain+0x1e>
+
+008003ac <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8003ac:	55                   	push   %ebp
+  8003ad:	89 e5                	mov    %esp,%ebp
+  8003af:	56                   	push   %esi
+  8003b0:	53                   	push   %ebx
+  8003b1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8003b4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  8003b7:	c7 05 44 67 80 00 00 	movl   $0x0,0x806744
+  8003be:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  8003c1:	e8 ca 0a 00 00       	call   800e90 <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  8003c6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8003cb:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8003ce:	c1 e0 04             	shl    $0x4,%eax
+  8003d1:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8003d6:	a3 44 67 80 00       	mov    %eax,0x806744
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8003db:	85 db                	test   %ebx,%ebx
+  8003dd:	7e 07                	jle    8003e6 <libmain+0x3a>
+    binaryname = argv[0];
+  8003df:	8b 06                	mov    (%esi),%eax
+  8003e1:	a3 00 40 80 00       	mov    %eax,0x804000
+
+  // call user main routine
+  umain(argc, argv);
+  8003e6:	83 ec 08             	sub    $0x8,%esp
+  8003e9:	56                   	push   %esi
+  8003ea:	53                   	push   %ebx
+  8003eb:	e8 f0 fe ff ff       	call   8002e0 <umain>
+
+  // exit gracefully
+  exit();
+  8003f0:	e8 0a 00 00 00       	call   8003ff <exit>
+}
+  8003f5:	83 c4 10             	add    $0x10,%esp
+  8003f8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8003fb:	5b                   	pop    %ebx
+  8003fc:	5e                   	pop    %esi
+  8003fd:	5d                   	pop    %ebp
+  8003fe:	c3                   	ret
+
+008003ff <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8003ff:	55                   	push   %ebp
+  800400:	89 e5                	mov    %esp,%ebp
+  800402:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  800405:	e8 80 11 00 00       	call   80158a <close_all>
+  sys_env_destroy(0);
+  80040a:	83 ec 0c             	sub    $0xc,%esp
+  80040d:	6a 00                	push   $0x0
+  80040f:	e8 3b 0a 00 00       	call   800e4f <sys_env_destroy>
+}
+  800414:	83 c4 10             	add    $0x10,%esp
+  800417:	c9                   	leave
+  800418:	c3                   	ret
+
+00800419 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800419:	55                   	push   %ebp
+  80041a:	89 e5                	mov    %esp,%ebp
+  80041c:	56                   	push   %esi
+  80041d:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  80041e:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  800421:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  800427:	e8 64 0a 00 00       	call   800e90 <sys_getenvid>
+  80042c:	83 ec 0c             	sub    $0xc,%esp
+  80042f:	ff 75 0c             	push   0xc(%ebp)
+  800432:	ff 75 08             	push   0x8(%ebp)
+  800435:	56                   	push   %esi
+  800436:	50                   	push   %eax
+  800437:	68 c8 32 80 00       	push   $0x8032c8
+  80043c:	e8 b3 00 00 00       	call   8004f4 <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  800441:	83 c4 18             	add    $0x18,%esp
+  800444:	53                   	push   %ebx
+  800445:	ff 75 10             	push   0x10(%ebp)
+  800448:	e8 56 00 00 00       	call   8004a3 <vcprintf>
+  cprintf("\n");
+  80044d:	c7 04 24 40 37 80 00 	movl   $0x803740,(%esp)
+  800454:	e8 9b 00 00 00       	call   8004f4 <cprintf>
+  800459:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  80045c:	cc                   	int3
+  while (1)
+  80045d:	eb fd                	jmp    80045c <_panic+0x43>
+
+0080045f <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80045f:	55                   	push   %ebp
+  800460:	89 e5                	mov    %esp,%ebp
+  800462:	53                   	push   %ebx
+  800463:	83 ec 04             	sub    $0x4,%esp
+  800466:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  800469:	8b 13                	mov    (%ebx),%edx
+  80046b:	8d 42 01             	lea    0x1(%edx),%eax
+  80046e:	89 03                	mov    %eax,(%ebx)
+  800470:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800473:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  800477:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80047c:	74 09                	je     800487 <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  80047e:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800482:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800485:	c9                   	leave
+  800486:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  800487:	83 ec 08             	sub    $0x8,%esp
+  80048a:	68 ff 00 00 00       	push   $0xff
+  80048f:	8d 43 08             	lea    0x8(%ebx),%eax
+  800492:	50                   	push   %eax
+  800493:	e8 7a 09 00 00       	call   800e12 <sys_cputs>
+    b->idx = 0;
+  800498:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80049e:	83 c4 10             	add    $0x10,%esp
+  8004a1:	eb db                	jmp    80047e <putch+0x1f>
+
+008004a3 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8004a3:	55                   	push   %ebp
+  8004a4:	89 e5                	mov    %esp,%ebp
+  8004a6:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  8004ac:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8004b3:	00 00 00 
+  b.cnt = 0;
+  8004b6:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8004bd:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  8004c0:	ff 75 0c             	push   0xc(%ebp)
+  8004c3:	ff 75 08             	push   0x8(%ebp)
+  8004c6:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8004cc:	50                   	push   %eax
+  8004cd:	68 5f 04 80 00       	push   $0x80045f
+  8004d2:	e8 14 01 00 00       	call   8005eb <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  8004d7:	83 c4 08             	add    $0x8,%esp
+  8004da:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8004e0:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8004e6:	50                   	push   %eax
+  8004e7:	e8 26 09 00 00       	call   800e12 <sys_cputs>
+
+  return b.cnt;
+}
+  8004ec:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8004f2:	c9                   	leave
+  8004f3:	c3                   	ret
+
+008004f4 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8004f4:	55                   	push   %ebp
+  8004f5:	89 e5                	mov    %esp,%ebp
+  8004f7:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  8004fa:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  8004fd:	50                   	push   %eax
+  8004fe:	ff 75 08             	push   0x8(%ebp)
+  800501:	e8 9d ff ff ff       	call   8004a3 <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  800506:	c9                   	leave
+  800507:	c3                   	ret
+
+00800508 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  800508:	55                   	push   %ebp
+  800509:	89 e5                	mov    %esp,%ebp
+  80050b:	57                   	push   %edi
+  80050c:	56                   	push   %esi
+  80050d:	53                   	push   %ebx
+  80050e:	83 ec 1c             	sub    $0x1c,%esp
+  800511:	89 c7                	mov    %eax,%edi
+  800513:	89 d6                	mov    %edx,%esi
+  800515:	8b 45 08             	mov    0x8(%ebp),%eax
+  800518:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80051b:	89 d1                	mov    %edx,%ecx
+  80051d:	89 c2                	mov    %eax,%edx
+  80051f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800522:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800525:	8b 45 10             	mov    0x10(%ebp),%eax
+  800528:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  80052b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80052e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800535:	39 c2                	cmp    %eax,%edx
+  800537:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80053a:	72 3e                	jb     80057a <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  80053c:	83 ec 0c             	sub    $0xc,%esp
+  80053f:	ff 75 18             	push   0x18(%ebp)
+  800542:	83 eb 01             	sub    $0x1,%ebx
+  800545:	53                   	push   %ebx
+  800546:	50                   	push   %eax
+  800547:	83 ec 08             	sub    $0x8,%esp
+  80054a:	ff 75 e4             	push   -0x1c(%ebp)
+  80054d:	ff 75 e0             	push   -0x20(%ebp)
+  800550:	ff 75 dc             	push   -0x24(%ebp)
+  800553:	ff 75 d8             	push   -0x28(%ebp)
+  800556:	e8 db 2a 00 00       	call   803036 <__udivdi3>
+  80055b:	83 c4 18             	add    $0x18,%esp
+  80055e:	52                   	push   %edx
+  80055f:	50                   	push   %eax
+  800560:	89 f2                	mov    %esi,%edx
+  800562:	89 f8                	mov    %edi,%eax
+  800564:	e8 9f ff ff ff       	call   800508 <printnum>
+  800569:	83 c4 20             	add    $0x20,%esp
+  80056c:	eb 13                	jmp    800581 <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  80056e:	83 ec 08             	sub    $0x8,%esp
+  800571:	56                   	push   %esi
+  800572:	ff 75 18             	push   0x18(%ebp)
+  800575:	ff d7                	call   *%edi
+  800577:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  80057a:	83 eb 01             	sub    $0x1,%ebx
+  80057d:	85 db                	test   %ebx,%ebx
+  80057f:	7f ed                	jg     80056e <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  800581:	83 ec 08             	sub    $0x8,%esp
+  800584:	56                   	push   %esi
+  800585:	83 ec 04             	sub    $0x4,%esp
+  800588:	ff 75 e4             	push   -0x1c(%ebp)
+  80058b:	ff 75 e0             	push   -0x20(%ebp)
+  80058e:	ff 75 dc             	push   -0x24(%ebp)
+  800591:	ff 75 d8             	push   -0x28(%ebp)
+  800594:	e8 be 2a 00 00       	call   803057 <__umoddi3>
+  800599:	83 c4 14             	add    $0x14,%esp
+  80059c:	0f be 80 eb 32 80 00 	movsbl 0x8032eb(%eax),%eax
+  8005a3:	50                   	push   %eax
+  8005a4:	ff d7                	call   *%edi
+}
+  8005a6:	83 c4 10             	add    $0x10,%esp
+  8005a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005ac:	5b                   	pop    %ebx
+  8005ad:	5e                   	pop    %esi
+  8005ae:	5f                   	pop    %edi
+  8005af:	5d                   	pop    %ebp
+  8005b0:	c3                   	ret
+
+008005b1 <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8005b1:	55                   	push   %ebp
+  8005b2:	89 e5                	mov    %esp,%ebp
+  8005b4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  8005b7:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  8005bb:	8b 10                	mov    (%eax),%edx
+  8005bd:	3b 50 04             	cmp    0x4(%eax),%edx
+  8005c0:	73 0a                	jae    8005cc <sprintputch+0x1b>
+    *b->buf++ = ch;
+  8005c2:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8005c5:	89 08                	mov    %ecx,(%eax)
+  8005c7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8005ca:	88 02                	mov    %al,(%edx)
+}
+  8005cc:	5d                   	pop    %ebp
+  8005cd:	c3                   	ret
+
+008005ce <printfmt>:
+{
+  8005ce:	55                   	push   %ebp
+  8005cf:	89 e5                	mov    %esp,%ebp
+  8005d1:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  8005d4:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  8005d7:	50                   	push   %eax
+  8005d8:	ff 75 10             	push   0x10(%ebp)
+  8005db:	ff 75 0c             	push   0xc(%ebp)
+  8005de:	ff 75 08             	push   0x8(%ebp)
+  8005e1:	e8 05 00 00 00       	call   8005eb <vprintfmt>
+}
+  8005e6:	83 c4 10             	add    $0x10,%esp
+  8005e9:	c9                   	leave
+  8005ea:	c3                   	ret
+
+008005eb <vprintfmt>:
+{
+  8005eb:	55                   	push   %ebp
+  8005ec:	89 e5                	mov    %esp,%ebp
+  8005ee:	57                   	push   %edi
+  8005ef:	56                   	push   %esi
+  8005f0:	53                   	push   %ebx
+  8005f1:	83 ec 2c             	sub    $0x2c,%esp
+  8005f4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005f7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8005fa:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8005fd:	eb 0a                	jmp    800609 <vprintfmt+0x1e>
+      putch(ch, putdat);
+  8005ff:	83 ec 08             	sub    $0x8,%esp
+  800602:	53                   	push   %ebx
+  800603:	50                   	push   %eax
+  800604:	ff d6                	call   *%esi
+  800606:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  800609:	83 c7 01             	add    $0x1,%edi
+  80060c:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800610:	83 f8 25             	cmp    $0x25,%eax
+  800613:	74 0c                	je     800621 <vprintfmt+0x36>
+      if (ch == '\0')
+  800615:	85 c0                	test   %eax,%eax
+  800617:	75 e6                	jne    8005ff <vprintfmt+0x14>
+}
+  800619:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80061c:	5b                   	pop    %ebx
+  80061d:	5e                   	pop    %esi
+  80061e:	5f                   	pop    %edi
+  80061f:	5d                   	pop    %ebp
+  800620:	c3                   	ret
+    padc = ' ';
+  800621:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  800625:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  80062c:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  800633:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  80063a:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  80063f:	8d 47 01             	lea    0x1(%edi),%eax
+  800642:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800645:	0f b6 17             	movzbl (%edi),%edx
+  800648:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80064b:	3c 55                	cmp    $0x55,%al
+  80064d:	0f 87 cf 03 00 00    	ja     800a22 <vprintfmt+0x437>
+  800653:	0f b6 c0             	movzbl %al,%eax
+  800656:	ff 24 85 40 34 80 00 	jmp    *0x803440(,%eax,4)
+  80065d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  800660:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800664:	eb d9                	jmp    80063f <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  800666:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800669:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80066d:	eb d0                	jmp    80063f <vprintfmt+0x54>
+  80066f:	0f b6 d2             	movzbl %dl,%edx
+  800672:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  800675:	b8 00 00 00 00       	mov    $0x0,%eax
+  80067a:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  80067d:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800680:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  800684:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  800687:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80068a:	83 f9 09             	cmp    $0x9,%ecx
+  80068d:	77 55                	ja     8006e4 <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  80068f:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  800692:	eb e9                	jmp    80067d <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  800694:	8b 45 14             	mov    0x14(%ebp),%eax
+  800697:	8b 00                	mov    (%eax),%eax
+  800699:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80069c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069f:	8d 40 04             	lea    0x4(%eax),%eax
+  8006a2:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  8006a5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  8006a8:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8006ac:	79 91                	jns    80063f <vprintfmt+0x54>
+        width = precision, precision = -1;
+  8006ae:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8006b1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006b4:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8006bb:	eb 82                	jmp    80063f <vprintfmt+0x54>
+      if (width < 0)
+  8006bd:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8006c0:	85 d2                	test   %edx,%edx
+  8006c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006c7:	0f 49 c2             	cmovns %edx,%eax
+  8006ca:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  8006cd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  8006d0:	e9 6a ff ff ff       	jmp    80063f <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  8006d5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  8006d8:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  8006df:	e9 5b ff ff ff       	jmp    80063f <vprintfmt+0x54>
+  8006e4:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8006e7:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8006ea:	eb bc                	jmp    8006a8 <vprintfmt+0xbd>
+      lflag++;
+  8006ec:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  8006ef:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  8006f2:	e9 48 ff ff ff       	jmp    80063f <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  8006f7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006fa:	8d 78 04             	lea    0x4(%eax),%edi
+  8006fd:	83 ec 08             	sub    $0x8,%esp
+  800700:	53                   	push   %ebx
+  800701:	ff 30                	push   (%eax)
+  800703:	ff d6                	call   *%esi
+      break;
+  800705:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  800708:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  80070b:	e9 b1 02 00 00       	jmp    8009c1 <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  800710:	8b 45 14             	mov    0x14(%ebp),%eax
+  800713:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  800716:	8b 10                	mov    (%eax),%edx
+  800718:	89 d0                	mov    %edx,%eax
+  80071a:	f7 d8                	neg    %eax
+  80071c:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80071f:	83 f8 10             	cmp    $0x10,%eax
+  800722:	7f 23                	jg     800747 <vprintfmt+0x15c>
+  800724:	8b 14 85 a0 35 80 00 	mov    0x8035a0(,%eax,4),%edx
+  80072b:	85 d2                	test   %edx,%edx
+  80072d:	74 18                	je     800747 <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  80072f:	52                   	push   %edx
+  800730:	68 ea 36 80 00       	push   $0x8036ea
+  800735:	53                   	push   %ebx
+  800736:	56                   	push   %esi
+  800737:	e8 92 fe ff ff       	call   8005ce <printfmt>
+  80073c:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  80073f:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800742:	e9 7a 02 00 00       	jmp    8009c1 <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  800747:	50                   	push   %eax
+  800748:	68 03 33 80 00       	push   $0x803303
+  80074d:	53                   	push   %ebx
+  80074e:	56                   	push   %esi
+  80074f:	e8 7a fe ff ff       	call   8005ce <printfmt>
+  800754:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  800757:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  80075a:	e9 62 02 00 00       	jmp    8009c1 <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  80075f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800762:	83 c0 04             	add    $0x4,%eax
+  800765:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800768:	8b 45 14             	mov    0x14(%ebp),%eax
+  80076b:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  80076d:	85 c9                	test   %ecx,%ecx
+  80076f:	b8 fc 32 80 00       	mov    $0x8032fc,%eax
+  800774:	0f 45 c1             	cmovne %ecx,%eax
+  800777:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  80077a:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80077e:	7e 06                	jle    800786 <vprintfmt+0x19b>
+  800780:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800784:	75 0b                	jne    800791 <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800786:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800789:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80078c:	89 75 08             	mov    %esi,0x8(%ebp)
+  80078f:	eb 5c                	jmp    8007ed <vprintfmt+0x202>
+  800791:	83 ec 08             	sub    $0x8,%esp
+  800794:	ff 75 d0             	push   -0x30(%ebp)
+  800797:	ff 75 cc             	push   -0x34(%ebp)
+  80079a:	e8 20 03 00 00       	call   800abf <strnlen>
+  80079f:	89 c2                	mov    %eax,%edx
+  8007a1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8007a4:	29 d0                	sub    %edx,%eax
+  8007a6:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  8007a9:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8007ad:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8007b0:	89 75 08             	mov    %esi,0x8(%ebp)
+  8007b3:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8007b5:	eb 0e                	jmp    8007c5 <vprintfmt+0x1da>
+          putch(padc, putdat);
+  8007b7:	83 ec 08             	sub    $0x8,%esp
+  8007ba:	53                   	push   %ebx
+  8007bb:	57                   	push   %edi
+  8007bc:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8007bf:	83 ee 01             	sub    $0x1,%esi
+  8007c2:	83 c4 10             	add    $0x10,%esp
+  8007c5:	85 f6                	test   %esi,%esi
+  8007c7:	7f ee                	jg     8007b7 <vprintfmt+0x1cc>
+  8007c9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8007cc:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007cf:	85 c0                	test   %eax,%eax
+  8007d1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8007d6:	0f 49 d0             	cmovns %eax,%edx
+  8007d9:	29 d0                	sub    %edx,%eax
+  8007db:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8007de:	eb a6                	jmp    800786 <vprintfmt+0x19b>
+          putch(ch, putdat);
+  8007e0:	83 ec 08             	sub    $0x8,%esp
+  8007e3:	53                   	push   %ebx
+  8007e4:	52                   	push   %edx
+  8007e5:	ff 55 08             	call   *0x8(%ebp)
+  8007e8:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8007eb:	89 f1                	mov    %esi,%ecx
+  8007ed:	8d 71 01             	lea    0x1(%ecx),%esi
+  8007f0:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8007f4:	0f be d0             	movsbl %al,%edx
+  8007f7:	85 d2                	test   %edx,%edx
+  8007f9:	74 28                	je     800823 <vprintfmt+0x238>
+  8007fb:	85 ff                	test   %edi,%edi
+  8007fd:	78 05                	js     800804 <vprintfmt+0x219>
+  8007ff:	83 ef 01             	sub    $0x1,%edi
+  800802:	78 30                	js     800834 <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  800804:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800808:	74 d6                	je     8007e0 <vprintfmt+0x1f5>
+  80080a:	0f be c0             	movsbl %al,%eax
+  80080d:	83 e8 20             	sub    $0x20,%eax
+  800810:	83 f8 5e             	cmp    $0x5e,%eax
+  800813:	76 cb                	jbe    8007e0 <vprintfmt+0x1f5>
+          putch('?', putdat);
+  800815:	83 ec 08             	sub    $0x8,%esp
+  800818:	53                   	push   %ebx
+  800819:	6a 3f                	push   $0x3f
+  80081b:	ff 55 08             	call   *0x8(%ebp)
+  80081e:	83 c4 10             	add    $0x10,%esp
+  800821:	eb c8                	jmp    8007eb <vprintfmt+0x200>
+  800823:	8b 75 08             	mov    0x8(%ebp),%esi
+  800826:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800829:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80082c:	01 d0                	add    %edx,%eax
+  80082e:	29 c8                	sub    %ecx,%eax
+  800830:	89 c7                	mov    %eax,%edi
+  800832:	eb 13                	jmp    800847 <vprintfmt+0x25c>
+  800834:	8b 75 08             	mov    0x8(%ebp),%esi
+  800837:	eb ed                	jmp    800826 <vprintfmt+0x23b>
+        putch(' ', putdat);
+  800839:	83 ec 08             	sub    $0x8,%esp
+  80083c:	53                   	push   %ebx
+  80083d:	6a 20                	push   $0x20
+  80083f:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  800841:	83 ef 01             	sub    $0x1,%edi
+  800844:	83 c4 10             	add    $0x10,%esp
+  800847:	85 ff                	test   %edi,%edi
+  800849:	7f ee                	jg     800839 <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  80084b:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80084e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800851:	e9 6b 01 00 00       	jmp    8009c1 <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  800856:	83 f9 01             	cmp    $0x1,%ecx
+  800859:	7f 1f                	jg     80087a <vprintfmt+0x28f>
+  else if (lflag)
+  80085b:	85 c9                	test   %ecx,%ecx
+  80085d:	74 67                	je     8008c6 <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  80085f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800862:	8b 00                	mov    (%eax),%eax
+  800864:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800867:	89 c1                	mov    %eax,%ecx
+  800869:	c1 f9 1f             	sar    $0x1f,%ecx
+  80086c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80086f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800872:	8d 40 04             	lea    0x4(%eax),%eax
+  800875:	89 45 14             	mov    %eax,0x14(%ebp)
+  800878:	eb 17                	jmp    800891 <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  80087a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80087d:	8b 50 04             	mov    0x4(%eax),%edx
+  800880:	8b 00                	mov    (%eax),%eax
+  800882:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800885:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800888:	8b 45 14             	mov    0x14(%ebp),%eax
+  80088b:	8d 40 08             	lea    0x8(%eax),%eax
+  80088e:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  800891:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800894:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  800897:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  80089c:	85 c9                	test   %ecx,%ecx
+  80089e:	0f 89 03 01 00 00    	jns    8009a7 <vprintfmt+0x3bc>
+        putch('-', putdat);
+  8008a4:	83 ec 08             	sub    $0x8,%esp
+  8008a7:	53                   	push   %ebx
+  8008a8:	6a 2d                	push   $0x2d
+  8008aa:	ff d6                	call   *%esi
+        num = -(long long)num;
+  8008ac:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8008af:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8008b2:	f7 da                	neg    %edx
+  8008b4:	83 d1 00             	adc    $0x0,%ecx
+  8008b7:	f7 d9                	neg    %ecx
+  8008b9:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  8008bc:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8008c1:	e9 e1 00 00 00       	jmp    8009a7 <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  8008c6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008c9:	8b 00                	mov    (%eax),%eax
+  8008cb:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8008ce:	89 c1                	mov    %eax,%ecx
+  8008d0:	c1 f9 1f             	sar    $0x1f,%ecx
+  8008d3:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8008d6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008d9:	8d 40 04             	lea    0x4(%eax),%eax
+  8008dc:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008df:	eb b0                	jmp    800891 <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  8008e1:	83 f9 01             	cmp    $0x1,%ecx
+  8008e4:	7f 1e                	jg     800904 <vprintfmt+0x319>
+  else if (lflag)
+  8008e6:	85 c9                	test   %ecx,%ecx
+  8008e8:	74 32                	je     80091c <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  8008ea:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008ed:	8b 10                	mov    (%eax),%edx
+  8008ef:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008f4:	8d 40 04             	lea    0x4(%eax),%eax
+  8008f7:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  8008fa:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  8008ff:	e9 a3 00 00 00       	jmp    8009a7 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800904:	8b 45 14             	mov    0x14(%ebp),%eax
+  800907:	8b 10                	mov    (%eax),%edx
+  800909:	8b 48 04             	mov    0x4(%eax),%ecx
+  80090c:	8d 40 08             	lea    0x8(%eax),%eax
+  80090f:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800912:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  800917:	e9 8b 00 00 00       	jmp    8009a7 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  80091c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80091f:	8b 10                	mov    (%eax),%edx
+  800921:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800926:	8d 40 04             	lea    0x4(%eax),%eax
+  800929:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  80092c:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  800931:	eb 74                	jmp    8009a7 <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  800933:	83 f9 01             	cmp    $0x1,%ecx
+  800936:	7f 1b                	jg     800953 <vprintfmt+0x368>
+  else if (lflag)
+  800938:	85 c9                	test   %ecx,%ecx
+  80093a:	74 2c                	je     800968 <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  80093c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80093f:	8b 10                	mov    (%eax),%edx
+  800941:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800946:	8d 40 04             	lea    0x4(%eax),%eax
+  800949:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  80094c:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  800951:	eb 54                	jmp    8009a7 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800953:	8b 45 14             	mov    0x14(%ebp),%eax
+  800956:	8b 10                	mov    (%eax),%edx
+  800958:	8b 48 04             	mov    0x4(%eax),%ecx
+  80095b:	8d 40 08             	lea    0x8(%eax),%eax
+  80095e:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800961:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  800966:	eb 3f                	jmp    8009a7 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800968:	8b 45 14             	mov    0x14(%ebp),%eax
+  80096b:	8b 10                	mov    (%eax),%edx
+  80096d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800972:	8d 40 04             	lea    0x4(%eax),%eax
+  800975:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800978:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  80097d:	eb 28                	jmp    8009a7 <vprintfmt+0x3bc>
+      putch('0', putdat);
+  80097f:	83 ec 08             	sub    $0x8,%esp
+  800982:	53                   	push   %ebx
+  800983:	6a 30                	push   $0x30
+  800985:	ff d6                	call   *%esi
+      putch('x', putdat);
+  800987:	83 c4 08             	add    $0x8,%esp
+  80098a:	53                   	push   %ebx
+  80098b:	6a 78                	push   $0x78
+  80098d:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  80098f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800992:	8b 10                	mov    (%eax),%edx
+  800994:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  800999:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  80099c:	8d 40 04             	lea    0x4(%eax),%eax
+  80099f:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8009a2:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  8009a7:	83 ec 0c             	sub    $0xc,%esp
+  8009aa:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8009ae:	50                   	push   %eax
+  8009af:	ff 75 e0             	push   -0x20(%ebp)
+  8009b2:	57                   	push   %edi
+  8009b3:	51                   	push   %ecx
+  8009b4:	52                   	push   %edx
+  8009b5:	89 da                	mov    %ebx,%edx
+  8009b7:	89 f0                	mov    %esi,%eax
+  8009b9:	e8 4a fb ff ff       	call   800508 <printnum>
+      break;
+  8009be:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  8009c1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  8009c4:	e9 40 fc ff ff       	jmp    800609 <vprintfmt+0x1e>
+  if (lflag >= 2)
+  8009c9:	83 f9 01             	cmp    $0x1,%ecx
+  8009cc:	7f 1b                	jg     8009e9 <vprintfmt+0x3fe>
+  else if (lflag)
+  8009ce:	85 c9                	test   %ecx,%ecx
+  8009d0:	74 2c                	je     8009fe <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  8009d2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009d5:	8b 10                	mov    (%eax),%edx
+  8009d7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009dc:	8d 40 04             	lea    0x4(%eax),%eax
+  8009df:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8009e2:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  8009e7:	eb be                	jmp    8009a7 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  8009e9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009ec:	8b 10                	mov    (%eax),%edx
+  8009ee:	8b 48 04             	mov    0x4(%eax),%ecx
+  8009f1:	8d 40 08             	lea    0x8(%eax),%eax
+  8009f4:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8009f7:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  8009fc:	eb a9                	jmp    8009a7 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8009fe:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a01:	8b 10                	mov    (%eax),%edx
+  800a03:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a08:	8d 40 04             	lea    0x4(%eax),%eax
+  800a0b:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800a0e:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  800a13:	eb 92                	jmp    8009a7 <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  800a15:	83 ec 08             	sub    $0x8,%esp
+  800a18:	53                   	push   %ebx
+  800a19:	6a 25                	push   $0x25
+  800a1b:	ff d6                	call   *%esi
+      break;
+  800a1d:	83 c4 10             	add    $0x10,%esp
+  800a20:	eb 9f                	jmp    8009c1 <vprintfmt+0x3d6>
+      putch('%', putdat);
+  800a22:	83 ec 08             	sub    $0x8,%esp
+  800a25:	53                   	push   %ebx
+  800a26:	6a 25                	push   $0x25
+  800a28:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  800a2a:	83 c4 10             	add    $0x10,%esp
+  800a2d:	89 f8                	mov    %edi,%eax
+  800a2f:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800a33:	74 05                	je     800a3a <vprintfmt+0x44f>
+  800a35:	83 e8 01             	sub    $0x1,%eax
+  800a38:	eb f5                	jmp    800a2f <vprintfmt+0x444>
+  800a3a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800a3d:	eb 82                	jmp    8009c1 <vprintfmt+0x3d6>
+
+00800a3f <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800a3f:	55                   	push   %ebp
+  800a40:	89 e5                	mov    %esp,%ebp
+  800a42:	83 ec 18             	sub    $0x18,%esp
+  800a45:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a48:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  800a4b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800a4e:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800a52:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800a55:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  800a5c:	85 c0                	test   %eax,%eax
+  800a5e:	74 26                	je     800a86 <vsnprintf+0x47>
+  800a60:	85 d2                	test   %edx,%edx
+  800a62:	7e 22                	jle    800a86 <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800a64:	ff 75 14             	push   0x14(%ebp)
+  800a67:	ff 75 10             	push   0x10(%ebp)
+  800a6a:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800a6d:	50                   	push   %eax
+  800a6e:	68 b1 05 80 00       	push   $0x8005b1
+  800a73:	e8 73 fb ff ff       	call   8005eb <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800a78:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800a7b:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  800a7e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a81:	83 c4 10             	add    $0x10,%esp
+}
+  800a84:	c9                   	leave
+  800a85:	c3                   	ret
+    return -E_INVAL;
+  800a86:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a8b:	eb f7                	jmp    800a84 <vsnprintf+0x45>
+
+00800a8d <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800a8d:	55                   	push   %ebp
+  800a8e:	89 e5                	mov    %esp,%ebp
+  800a90:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  800a93:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  800a96:	50                   	push   %eax
+  800a97:	ff 75 10             	push   0x10(%ebp)
+  800a9a:	ff 75 0c             	push   0xc(%ebp)
+  800a9d:	ff 75 08             	push   0x8(%ebp)
+  800aa0:	e8 9a ff ff ff       	call   800a3f <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  800aa5:	c9                   	leave
+  800aa6:	c3                   	ret
+
+00800aa7 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800aa7:	55                   	push   %ebp
+  800aa8:	89 e5                	mov    %esp,%ebp
+  800aaa:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  800aad:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ab2:	eb 03                	jmp    800ab7 <strlen+0x10>
+    n++;
+  800ab4:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  800ab7:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800abb:	75 f7                	jne    800ab4 <strlen+0xd>
+  return n;
+}
+  800abd:	5d                   	pop    %ebp
+  800abe:	c3                   	ret
+
+00800abf <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800abf:	55                   	push   %ebp
+  800ac0:	89 e5                	mov    %esp,%ebp
+  800ac2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800ac5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ac8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800acd:	eb 03                	jmp    800ad2 <strnlen+0x13>
+    n++;
+  800acf:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800ad2:	39 d0                	cmp    %edx,%eax
+  800ad4:	74 08                	je     800ade <strnlen+0x1f>
+  800ad6:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800ada:	75 f3                	jne    800acf <strnlen+0x10>
+  800adc:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  800ade:	89 d0                	mov    %edx,%eax
+  800ae0:	5d                   	pop    %ebp
+  800ae1:	c3                   	ret
+
+00800ae2 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800ae2:	55                   	push   %ebp
+  800ae3:	89 e5                	mov    %esp,%ebp
+  800ae5:	53                   	push   %ebx
+  800ae6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ae9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  800aec:	b8 00 00 00 00       	mov    $0x0,%eax
+  800af1:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800af5:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800af8:	83 c0 01             	add    $0x1,%eax
+  800afb:	84 d2                	test   %dl,%dl
+  800afd:	75 f2                	jne    800af1 <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  800aff:	89 c8                	mov    %ecx,%eax
+  800b01:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b04:	c9                   	leave
+  800b05:	c3                   	ret
+
+00800b06 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800b06:	55                   	push   %ebp
+  800b07:	89 e5                	mov    %esp,%ebp
+  800b09:	53                   	push   %ebx
+  800b0a:	83 ec 10             	sub    $0x10,%esp
+  800b0d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  800b10:	53                   	push   %ebx
+  800b11:	e8 91 ff ff ff       	call   800aa7 <strlen>
+  800b16:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  800b19:	ff 75 0c             	push   0xc(%ebp)
+  800b1c:	01 d8                	add    %ebx,%eax
+  800b1e:	50                   	push   %eax
+  800b1f:	e8 be ff ff ff       	call   800ae2 <strcpy>
+  return dst;
+}
+  800b24:	89 d8                	mov    %ebx,%eax
+  800b26:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b29:	c9                   	leave
+  800b2a:	c3                   	ret
+
+00800b2b <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  800b2b:	55                   	push   %ebp
+  800b2c:	89 e5                	mov    %esp,%ebp
+  800b2e:	56                   	push   %esi
+  800b2f:	53                   	push   %ebx
+  800b30:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b33:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  800b36:	89 f3                	mov    %esi,%ebx
+  800b38:	03 5d 10             	add    0x10(%ebp),%ebx
+  800b3b:	89 f0                	mov    %esi,%eax
+  800b3d:	eb 0f                	jmp    800b4e <strncpy+0x23>
+    *dst++ = *src;
+  800b3f:	83 c0 01             	add    $0x1,%eax
+  800b42:	0f b6 0a             	movzbl (%edx),%ecx
+  800b45:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  800b48:	80 f9 01             	cmp    $0x1,%cl
+  800b4b:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  800b4e:	39 d8                	cmp    %ebx,%eax
+  800b50:	75 ed                	jne    800b3f <strncpy+0x14>
+  }
+  return ret;
+}
+  800b52:	89 f0                	mov    %esi,%eax
+  800b54:	5b                   	pop    %ebx
+  800b55:	5e                   	pop    %esi
+  800b56:	5d                   	pop    %ebp
+  800b57:	c3                   	ret
+
+00800b58 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800b58:	55                   	push   %ebp
+  800b59:	89 e5                	mov    %esp,%ebp
+  800b5b:	56                   	push   %esi
+  800b5c:	53                   	push   %ebx
+  800b5d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b60:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b63:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  800b66:	89 f0                	mov    %esi,%eax
+  800b68:	85 d2                	test   %edx,%edx
+  800b6a:	74 21                	je     800b8d <strlcpy+0x35>
+  800b6c:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800b70:	89 f2                	mov    %esi,%edx
+  800b72:	eb 09                	jmp    800b7d <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  800b74:	83 c1 01             	add    $0x1,%ecx
+  800b77:	83 c2 01             	add    $0x1,%edx
+  800b7a:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  800b7d:	39 c2                	cmp    %eax,%edx
+  800b7f:	74 09                	je     800b8a <strlcpy+0x32>
+  800b81:	0f b6 19             	movzbl (%ecx),%ebx
+  800b84:	84 db                	test   %bl,%bl
+  800b86:	75 ec                	jne    800b74 <strlcpy+0x1c>
+  800b88:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  800b8a:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  800b8d:	29 f0                	sub    %esi,%eax
+}
+  800b8f:	5b                   	pop    %ebx
+  800b90:	5e                   	pop    %esi
+  800b91:	5d                   	pop    %ebp
+  800b92:	c3                   	ret
+
+00800b93 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800b93:	55                   	push   %ebp
+  800b94:	89 e5                	mov    %esp,%ebp
+  800b96:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b99:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  800b9c:	eb 06                	jmp    800ba4 <strcmp+0x11>
+    p++, q++;
+  800b9e:	83 c1 01             	add    $0x1,%ecx
+  800ba1:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  800ba4:	0f b6 01             	movzbl (%ecx),%eax
+  800ba7:	84 c0                	test   %al,%al
+  800ba9:	74 04                	je     800baf <strcmp+0x1c>
+  800bab:	3a 02                	cmp    (%edx),%al
+  800bad:	74 ef                	je     800b9e <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  800baf:	0f b6 c0             	movzbl %al,%eax
+  800bb2:	0f b6 12             	movzbl (%edx),%edx
+  800bb5:	29 d0                	sub    %edx,%eax
+}
+  800bb7:	5d                   	pop    %ebp
+  800bb8:	c3                   	ret
+
+00800bb9 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800bb9:	55                   	push   %ebp
+  800bba:	89 e5                	mov    %esp,%ebp
+  800bbc:	53                   	push   %ebx
+  800bbd:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bc0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bc3:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  800bc6:	eb 09                	jmp    800bd1 <strncmp+0x18>
+    n--, p++, q++;
+  800bc8:	83 ea 01             	sub    $0x1,%edx
+  800bcb:	83 c0 01             	add    $0x1,%eax
+  800bce:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  800bd1:	85 d2                	test   %edx,%edx
+  800bd3:	74 18                	je     800bed <strncmp+0x34>
+  800bd5:	0f b6 18             	movzbl (%eax),%ebx
+  800bd8:	84 db                	test   %bl,%bl
+  800bda:	74 04                	je     800be0 <strncmp+0x27>
+  800bdc:	3a 19                	cmp    (%ecx),%bl
+  800bde:	74 e8                	je     800bc8 <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800be0:	0f b6 00             	movzbl (%eax),%eax
+  800be3:	0f b6 11             	movzbl (%ecx),%edx
+  800be6:	29 d0                	sub    %edx,%eax
+}
+  800be8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800beb:	c9                   	leave
+  800bec:	c3                   	ret
+    return 0;
+  800bed:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bf2:	eb f4                	jmp    800be8 <strncmp+0x2f>
+
+00800bf4 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800bf4:	55                   	push   %ebp
+  800bf5:	89 e5                	mov    %esp,%ebp
+  800bf7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bfa:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800bfe:	eb 03                	jmp    800c03 <strchr+0xf>
+  800c00:	83 c0 01             	add    $0x1,%eax
+  800c03:	0f b6 10             	movzbl (%eax),%edx
+  800c06:	84 d2                	test   %dl,%dl
+  800c08:	74 06                	je     800c10 <strchr+0x1c>
+    if (*s == c)
+  800c0a:	38 ca                	cmp    %cl,%dl
+  800c0c:	75 f2                	jne    800c00 <strchr+0xc>
+  800c0e:	eb 05                	jmp    800c15 <strchr+0x21>
+      return (char*)s;
+  return 0;
+  800c10:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c15:	5d                   	pop    %ebp
+  800c16:	c3                   	ret
+
+00800c17 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800c17:	55                   	push   %ebp
+  800c18:	89 e5                	mov    %esp,%ebp
+  800c1a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c1d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800c21:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  800c24:	38 ca                	cmp    %cl,%dl
+  800c26:	74 09                	je     800c31 <strfind+0x1a>
+  800c28:	84 d2                	test   %dl,%dl
+  800c2a:	74 05                	je     800c31 <strfind+0x1a>
+  for (; *s; s++)
+  800c2c:	83 c0 01             	add    $0x1,%eax
+  800c2f:	eb f0                	jmp    800c21 <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  800c31:	5d                   	pop    %ebp
+  800c32:	c3                   	ret
+
+00800c33 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800c33:	55                   	push   %ebp
+  800c34:	89 e5                	mov    %esp,%ebp
+  800c36:	57                   	push   %edi
+  800c37:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800c3a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  800c3d:	85 c9                	test   %ecx,%ecx
+  800c3f:	74 20                	je     800c61 <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  800c41:	89 f8                	mov    %edi,%eax
+  800c43:	09 c8                	or     %ecx,%eax
+  800c45:	a8 03                	test   $0x3,%al
+  800c47:	75 12                	jne    800c5b <memset+0x28>
+    c &= 0xFF;
+  800c49:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800c4d:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  800c53:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  800c56:	fc                   	cld
+  800c57:	f3 ab                	rep stos %eax,%es:(%edi)
+  800c59:	eb 06                	jmp    800c61 <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  800c5b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c5e:	fc                   	cld
+  800c5f:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  800c61:	89 f8                	mov    %edi,%eax
+  800c63:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800c66:	c9                   	leave
+  800c67:	c3                   	ret
+
+00800c68 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800c68:	55                   	push   %ebp
+  800c69:	89 e5                	mov    %esp,%ebp
+  800c6b:	57                   	push   %edi
+  800c6c:	56                   	push   %esi
+  800c6d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c70:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800c73:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  800c76:	39 c6                	cmp    %eax,%esi
+  800c78:	73 32                	jae    800cac <memmove+0x44>
+  800c7a:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800c7d:	39 d0                	cmp    %edx,%eax
+  800c7f:	73 2b                	jae    800cac <memmove+0x44>
+    s += n;
+    d += n;
+  800c81:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c84:	89 d6                	mov    %edx,%esi
+  800c86:	09 fe                	or     %edi,%esi
+  800c88:	09 ce                	or     %ecx,%esi
+  800c8a:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800c90:	75 0e                	jne    800ca0 <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800c92:	83 ef 04             	sub    $0x4,%edi
+  800c95:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800c98:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  800c9b:	fd                   	std
+  800c9c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c9e:	eb 09                	jmp    800ca9 <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800ca0:	83 ef 01             	sub    $0x1,%edi
+  800ca3:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  800ca6:	fd                   	std
+  800ca7:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  800ca9:	fc                   	cld
+  800caa:	eb 1a                	jmp    800cc6 <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800cac:	89 f2                	mov    %esi,%edx
+  800cae:	09 c2                	or     %eax,%edx
+  800cb0:	09 ca                	or     %ecx,%edx
+  800cb2:	f6 c2 03             	test   $0x3,%dl
+  800cb5:	75 0a                	jne    800cc1 <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800cb7:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  800cba:	89 c7                	mov    %eax,%edi
+  800cbc:	fc                   	cld
+  800cbd:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800cbf:	eb 05                	jmp    800cc6 <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  800cc1:	89 c7                	mov    %eax,%edi
+  800cc3:	fc                   	cld
+  800cc4:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  800cc6:	5e                   	pop    %esi
+  800cc7:	5f                   	pop    %edi
+  800cc8:	5d                   	pop    %ebp
+  800cc9:	c3                   	ret
+
+00800cca <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800cca:	55                   	push   %ebp
+  800ccb:	89 e5                	mov    %esp,%ebp
+  800ccd:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  800cd0:	ff 75 10             	push   0x10(%ebp)
+  800cd3:	ff 75 0c             	push   0xc(%ebp)
+  800cd6:	ff 75 08             	push   0x8(%ebp)
+  800cd9:	e8 8a ff ff ff       	call   800c68 <memmove>
+}
+  800cde:	c9                   	leave
+  800cdf:	c3                   	ret
+
+00800ce0 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800ce0:	55                   	push   %ebp
+  800ce1:	89 e5                	mov    %esp,%ebp
+  800ce3:	56                   	push   %esi
+  800ce4:	53                   	push   %ebx
+  800ce5:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ce8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  800ceb:	89 c6                	mov    %eax,%esi
+  800ced:	03 75 10             	add    0x10(%ebp),%esi
+  800cf0:	eb 06                	jmp    800cf8 <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  800cf2:	83 c0 01             	add    $0x1,%eax
+  800cf5:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  800cf8:	39 f0                	cmp    %esi,%eax
+  800cfa:	74 14                	je     800d10 <memcmp+0x30>
+    if (*s1 != *s2)
+  800cfc:	0f b6 08             	movzbl (%eax),%ecx
+  800cff:	0f b6 1a             	movzbl (%edx),%ebx
+  800d02:	38 d9                	cmp    %bl,%cl
+  800d04:	74 ec                	je     800cf2 <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  800d06:	0f b6 c1             	movzbl %cl,%eax
+  800d09:	0f b6 db             	movzbl %bl,%ebx
+  800d0c:	29 d8                	sub    %ebx,%eax
+  800d0e:	eb 05                	jmp    800d15 <memcmp+0x35>
+  }
+
+  return 0;
+  800d10:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d15:	5b                   	pop    %ebx
+  800d16:	5e                   	pop    %esi
+  800d17:	5d                   	pop    %ebp
+  800d18:	c3                   	ret
+
+00800d19 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800d19:	55                   	push   %ebp
+  800d1a:	89 e5                	mov    %esp,%ebp
+  800d1c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d1f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  800d22:	89 c2                	mov    %eax,%edx
+  800d24:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  800d27:	eb 03                	jmp    800d2c <memfind+0x13>
+  800d29:	83 c0 01             	add    $0x1,%eax
+  800d2c:	39 d0                	cmp    %edx,%eax
+  800d2e:	73 04                	jae    800d34 <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  800d30:	38 08                	cmp    %cl,(%eax)
+  800d32:	75 f5                	jne    800d29 <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  800d34:	5d                   	pop    %ebp
+  800d35:	c3                   	ret
+
+00800d36 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800d36:	55                   	push   %ebp
+  800d37:	89 e5                	mov    %esp,%ebp
+  800d39:	57                   	push   %edi
+  800d3a:	56                   	push   %esi
+  800d3b:	53                   	push   %ebx
+  800d3c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d3f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  800d42:	eb 03                	jmp    800d47 <strtol+0x11>
+    s++;
+  800d44:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  800d47:	0f b6 02             	movzbl (%edx),%eax
+  800d4a:	3c 20                	cmp    $0x20,%al
+  800d4c:	74 f6                	je     800d44 <strtol+0xe>
+  800d4e:	3c 09                	cmp    $0x9,%al
+  800d50:	74 f2                	je     800d44 <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  800d52:	3c 2b                	cmp    $0x2b,%al
+  800d54:	74 2a                	je     800d80 <strtol+0x4a>
+  int neg = 0;
+  800d56:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  800d5b:	3c 2d                	cmp    $0x2d,%al
+  800d5d:	74 2b                	je     800d8a <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d5f:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800d65:	75 0f                	jne    800d76 <strtol+0x40>
+  800d67:	80 3a 30             	cmpb   $0x30,(%edx)
+  800d6a:	74 28                	je     800d94 <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  800d6c:	85 db                	test   %ebx,%ebx
+  800d6e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d73:	0f 44 d8             	cmove  %eax,%ebx
+  800d76:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d7b:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800d7e:	eb 46                	jmp    800dc6 <strtol+0x90>
+    s++;
+  800d80:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  800d83:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d88:	eb d5                	jmp    800d5f <strtol+0x29>
+    s++, neg = 1;
+  800d8a:	83 c2 01             	add    $0x1,%edx
+  800d8d:	bf 01 00 00 00       	mov    $0x1,%edi
+  800d92:	eb cb                	jmp    800d5f <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d94:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800d98:	74 0e                	je     800da8 <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  800d9a:	85 db                	test   %ebx,%ebx
+  800d9c:	75 d8                	jne    800d76 <strtol+0x40>
+    s++, base = 8;
+  800d9e:	83 c2 01             	add    $0x1,%edx
+  800da1:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800da6:	eb ce                	jmp    800d76 <strtol+0x40>
+    s += 2, base = 16;
+  800da8:	83 c2 02             	add    $0x2,%edx
+  800dab:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800db0:	eb c4                	jmp    800d76 <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  800db2:	0f be c0             	movsbl %al,%eax
+  800db5:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  800db8:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800dbb:	7d 3a                	jge    800df7 <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  800dbd:	83 c2 01             	add    $0x1,%edx
+  800dc0:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800dc4:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  800dc6:	0f b6 02             	movzbl (%edx),%eax
+  800dc9:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800dcc:	89 f3                	mov    %esi,%ebx
+  800dce:	80 fb 09             	cmp    $0x9,%bl
+  800dd1:	76 df                	jbe    800db2 <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  800dd3:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800dd6:	89 f3                	mov    %esi,%ebx
+  800dd8:	80 fb 19             	cmp    $0x19,%bl
+  800ddb:	77 08                	ja     800de5 <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  800ddd:	0f be c0             	movsbl %al,%eax
+  800de0:	83 e8 57             	sub    $0x57,%eax
+  800de3:	eb d3                	jmp    800db8 <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  800de5:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800de8:	89 f3                	mov    %esi,%ebx
+  800dea:	80 fb 19             	cmp    $0x19,%bl
+  800ded:	77 08                	ja     800df7 <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  800def:	0f be c0             	movsbl %al,%eax
+  800df2:	83 e8 37             	sub    $0x37,%eax
+  800df5:	eb c1                	jmp    800db8 <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  800df7:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800dfb:	74 05                	je     800e02 <strtol+0xcc>
+    *endptr = (char*)s;
+  800dfd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e00:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  800e02:	89 c8                	mov    %ecx,%eax
+  800e04:	f7 d8                	neg    %eax
+  800e06:	85 ff                	test   %edi,%edi
+  800e08:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800e0b:	89 c8                	mov    %ecx,%eax
+  800e0d:	5b                   	pop    %ebx
+  800e0e:	5e                   	pop    %esi
+  800e0f:	5f                   	pop    %edi
+  800e10:	5d                   	pop    %ebp
+  800e11:	c3                   	ret
+
+00800e12 <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800e12:	55                   	push   %ebp
+  800e13:	89 e5                	mov    %esp,%ebp
+  800e15:	57                   	push   %edi
+  800e16:	56                   	push   %esi
+  800e17:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e18:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e1d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e20:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e23:	89 c3                	mov    %eax,%ebx
+  800e25:	89 c7                	mov    %eax,%edi
+  800e27:	89 c6                	mov    %eax,%esi
+  800e29:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800e2b:	5b                   	pop    %ebx
+  800e2c:	5e                   	pop    %esi
+  800e2d:	5f                   	pop    %edi
+  800e2e:	5d                   	pop    %ebp
+  800e2f:	c3                   	ret
+
+00800e30 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800e30:	55                   	push   %ebp
+  800e31:	89 e5                	mov    %esp,%ebp
+  800e33:	57                   	push   %edi
+  800e34:	56                   	push   %esi
+  800e35:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e36:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e3b:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e40:	89 d1                	mov    %edx,%ecx
+  800e42:	89 d3                	mov    %edx,%ebx
+  800e44:	89 d7                	mov    %edx,%edi
+  800e46:	89 d6                	mov    %edx,%esi
+  800e48:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800e4a:	5b                   	pop    %ebx
+  800e4b:	5e                   	pop    %esi
+  800e4c:	5f                   	pop    %edi
+  800e4d:	5d                   	pop    %ebp
+  800e4e:	c3                   	ret
+
+00800e4f <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800e4f:	55                   	push   %ebp
+  800e50:	89 e5                	mov    %esp,%ebp
+  800e52:	57                   	push   %edi
+  800e53:	56                   	push   %esi
+  800e54:	53                   	push   %ebx
+  800e55:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e58:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e5d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e60:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e65:	89 cb                	mov    %ecx,%ebx
+  800e67:	89 cf                	mov    %ecx,%edi
+  800e69:	89 ce                	mov    %ecx,%esi
+  800e6b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e6d:	85 c0                	test   %eax,%eax
+  800e6f:	7f 08                	jg     800e79 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800e71:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e74:	5b                   	pop    %ebx
+  800e75:	5e                   	pop    %esi
+  800e76:	5f                   	pop    %edi
+  800e77:	5d                   	pop    %ebp
+  800e78:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e79:	83 ec 0c             	sub    $0xc,%esp
+  800e7c:	50                   	push   %eax
+  800e7d:	6a 03                	push   $0x3
+  800e7f:	68 03 36 80 00       	push   $0x803603
+  800e84:	6a 23                	push   $0x23
+  800e86:	68 20 36 80 00       	push   $0x803620
+  800e8b:	e8 89 f5 ff ff       	call   800419 <_panic>
+
+00800e90 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800e90:	55                   	push   %ebp
+  800e91:	89 e5                	mov    %esp,%ebp
+  800e93:	57                   	push   %edi
+  800e94:	56                   	push   %esi
+  800e95:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e96:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e9b:	b8 02 00 00 00       	mov    $0x2,%eax
+  800ea0:	89 d1                	mov    %edx,%ecx
+  800ea2:	89 d3                	mov    %edx,%ebx
+  800ea4:	89 d7                	mov    %edx,%edi
+  800ea6:	89 d6                	mov    %edx,%esi
+  800ea8:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800eaa:	5b                   	pop    %ebx
+  800eab:	5e                   	pop    %esi
+  800eac:	5f                   	pop    %edi
+  800ead:	5d                   	pop    %ebp
+  800eae:	c3                   	ret
+
+00800eaf <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800eaf:	55                   	push   %ebp
+  800eb0:	89 e5                	mov    %esp,%ebp
+  800eb2:	57                   	push   %edi
+  800eb3:	56                   	push   %esi
+  800eb4:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800eb5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eba:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800ebf:	89 d1                	mov    %edx,%ecx
+  800ec1:	89 d3                	mov    %edx,%ebx
+  800ec3:	89 d7                	mov    %edx,%edi
+  800ec5:	89 d6                	mov    %edx,%esi
+  800ec7:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800ec9:	5b                   	pop    %ebx
+  800eca:	5e                   	pop    %esi
+  800ecb:	5f                   	pop    %edi
+  800ecc:	5d                   	pop    %ebp
+  800ecd:	c3                   	ret
+
+00800ece <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  800ece:	55                   	push   %ebp
+  800ecf:	89 e5                	mov    %esp,%ebp
+  800ed1:	57                   	push   %edi
+  800ed2:	56                   	push   %esi
+  800ed3:	53                   	push   %ebx
+  800ed4:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  800ed7:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  800edb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ee0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee3:	b8 14 00 00 00       	mov    $0x14,%eax
+  800ee8:	89 df                	mov    %ebx,%edi
+  800eea:	89 de                	mov    %ebx,%esi
+  800eec:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800eee:	85 c0                	test   %eax,%eax
+  800ef0:	7f 08                	jg     800efa <sys_env_set_cow+0x2c>
+}
+  800ef2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ef5:	5b                   	pop    %ebx
+  800ef6:	5e                   	pop    %esi
+  800ef7:	5f                   	pop    %edi
+  800ef8:	5d                   	pop    %ebp
+  800ef9:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800efa:	83 ec 0c             	sub    $0xc,%esp
+  800efd:	50                   	push   %eax
+  800efe:	6a 14                	push   $0x14
+  800f00:	68 03 36 80 00       	push   $0x803603
+  800f05:	6a 23                	push   $0x23
+  800f07:	68 20 36 80 00       	push   $0x803620
+  800f0c:	e8 08 f5 ff ff       	call   800419 <_panic>
+
+00800f11 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800f11:	55                   	push   %ebp
+  800f12:	89 e5                	mov    %esp,%ebp
+  800f14:	57                   	push   %edi
+  800f15:	56                   	push   %esi
+  800f16:	53                   	push   %ebx
+  800f17:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f1a:	be 00 00 00 00       	mov    $0x0,%esi
+  800f1f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f22:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f25:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f2a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f2d:	89 f7                	mov    %esi,%edi
+  800f2f:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f31:	85 c0                	test   %eax,%eax
+  800f33:	7f 08                	jg     800f3d <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  800f35:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f38:	5b                   	pop    %ebx
+  800f39:	5e                   	pop    %esi
+  800f3a:	5f                   	pop    %edi
+  800f3b:	5d                   	pop    %ebp
+  800f3c:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f3d:	83 ec 0c             	sub    $0xc,%esp
+  800f40:	50                   	push   %eax
+  800f41:	6a 04                	push   $0x4
+  800f43:	68 03 36 80 00       	push   $0x803603
+  800f48:	6a 23                	push   $0x23
+  800f4a:	68 20 36 80 00       	push   $0x803620
+  800f4f:	e8 c5 f4 ff ff       	call   800419 <_panic>
+
+00800f54 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800f54:	55                   	push   %ebp
+  800f55:	89 e5                	mov    %esp,%ebp
+  800f57:	57                   	push   %edi
+  800f58:	56                   	push   %esi
+  800f59:	53                   	push   %ebx
+  800f5a:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f5d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f60:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f63:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f68:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f6b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f6e:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f71:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f73:	85 c0                	test   %eax,%eax
+  800f75:	7f 08                	jg     800f7f <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  800f77:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f7a:	5b                   	pop    %ebx
+  800f7b:	5e                   	pop    %esi
+  800f7c:	5f                   	pop    %edi
+  800f7d:	5d                   	pop    %ebp
+  800f7e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f7f:	83 ec 0c             	sub    $0xc,%esp
+  800f82:	50                   	push   %eax
+  800f83:	6a 05                	push   $0x5
+  800f85:	68 03 36 80 00       	push   $0x803603
+  800f8a:	6a 23                	push   $0x23
+  800f8c:	68 20 36 80 00       	push   $0x803620
+  800f91:	e8 83 f4 ff ff       	call   800419 <_panic>
+
+00800f96 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800f96:	55                   	push   %ebp
+  800f97:	89 e5                	mov    %esp,%ebp
+  800f99:	57                   	push   %edi
+  800f9a:	56                   	push   %esi
+  800f9b:	53                   	push   %ebx
+  800f9c:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f9f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fa4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800faa:	b8 06 00 00 00       	mov    $0x6,%eax
+  800faf:	89 df                	mov    %ebx,%edi
+  800fb1:	89 de                	mov    %ebx,%esi
+  800fb3:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800fb5:	85 c0                	test   %eax,%eax
+  800fb7:	7f 08                	jg     800fc1 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  800fb9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fbc:	5b                   	pop    %ebx
+  800fbd:	5e                   	pop    %esi
+  800fbe:	5f                   	pop    %edi
+  800fbf:	5d                   	pop    %ebp
+  800fc0:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800fc1:	83 ec 0c             	sub    $0xc,%esp
+  800fc4:	50                   	push   %eax
+  800fc5:	6a 06                	push   $0x6
+  800fc7:	68 03 36 80 00       	push   $0x803603
+  800fcc:	6a 23                	push   $0x23
+  800fce:	68 20 36 80 00       	push   $0x803620
+  800fd3:	e8 41 f4 ff ff       	call   800419 <_panic>
+
+00800fd8 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  800fd8:	55                   	push   %ebp
+  800fd9:	89 e5                	mov    %esp,%ebp
+  800fdb:	57                   	push   %edi
+  800fdc:	56                   	push   %esi
+  800fdd:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800fde:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fe4:	b8 11 00 00 00       	mov    $0x11,%eax
+  800fe9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fec:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fef:	8b 75 18             	mov    0x18(%ebp),%esi
+  800ff2:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  800ff4:	5b                   	pop    %ebx
+  800ff5:	5e                   	pop    %esi
+  800ff6:	5f                   	pop    %edi
+  800ff7:	5d                   	pop    %ebp
+  800ff8:	c3                   	ret
+
+00800ff9 <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  800ff9:	55                   	push   %ebp
+  800ffa:	89 e5                	mov    %esp,%ebp
+  800ffc:	57                   	push   %edi
+  800ffd:	56                   	push   %esi
+  800ffe:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800fff:	8b 55 08             	mov    0x8(%ebp),%edx
+  801002:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801005:	b8 12 00 00 00       	mov    $0x12,%eax
+  80100a:	be 00 00 00 00       	mov    $0x0,%esi
+  80100f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801012:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801015:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  801017:	5b                   	pop    %ebx
+  801018:	5e                   	pop    %esi
+  801019:	5f                   	pop    %edi
+  80101a:	5d                   	pop    %ebp
+  80101b:	c3                   	ret
+
+0080101c <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  80101c:	55                   	push   %ebp
+  80101d:	89 e5                	mov    %esp,%ebp
+  80101f:	57                   	push   %edi
+  801020:	56                   	push   %esi
+  801021:	53                   	push   %ebx
+  801022:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801025:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80102a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80102d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801030:	b8 16 00 00 00       	mov    $0x16,%eax
+  801035:	89 df                	mov    %ebx,%edi
+  801037:	89 de                	mov    %ebx,%esi
+  801039:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80103b:	85 c0                	test   %eax,%eax
+  80103d:	7f 08                	jg     801047 <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  80103f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801042:	5b                   	pop    %ebx
+  801043:	5e                   	pop    %esi
+  801044:	5f                   	pop    %edi
+  801045:	5d                   	pop    %ebp
+  801046:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801047:	83 ec 0c             	sub    $0xc,%esp
+  80104a:	50                   	push   %eax
+  80104b:	6a 16                	push   $0x16
+  80104d:	68 03 36 80 00       	push   $0x803603
+  801052:	6a 23                	push   $0x23
+  801054:	68 20 36 80 00       	push   $0x803620
+  801059:	e8 bb f3 ff ff       	call   800419 <_panic>
+
+0080105e <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  80105e:	55                   	push   %ebp
+  80105f:	89 e5                	mov    %esp,%ebp
+  801061:	57                   	push   %edi
+  801062:	56                   	push   %esi
+  801063:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801064:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801069:	8b 55 08             	mov    0x8(%ebp),%edx
+  80106c:	b8 17 00 00 00       	mov    $0x17,%eax
+  801071:	89 cb                	mov    %ecx,%ebx
+  801073:	89 cf                	mov    %ecx,%edi
+  801075:	89 ce                	mov    %ecx,%esi
+  801077:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  801079:	5b                   	pop    %ebx
+  80107a:	5e                   	pop    %esi
+  80107b:	5f                   	pop    %edi
+  80107c:	5d                   	pop    %ebp
+  80107d:	c3                   	ret
+
+0080107e <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  80107e:	55                   	push   %ebp
+  80107f:	89 e5                	mov    %esp,%ebp
+  801081:	57                   	push   %edi
+  801082:	56                   	push   %esi
+  801083:	53                   	push   %ebx
+  801084:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801087:	be 00 00 00 00       	mov    $0x0,%esi
+  80108c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80108f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801092:	b8 18 00 00 00       	mov    $0x18,%eax
+  801097:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80109a:	89 f7                	mov    %esi,%edi
+  80109c:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80109e:	85 c0                	test   %eax,%eax
+  8010a0:	7f 08                	jg     8010aa <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  8010a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010a5:	5b                   	pop    %ebx
+  8010a6:	5e                   	pop    %esi
+  8010a7:	5f                   	pop    %edi
+  8010a8:	5d                   	pop    %ebp
+  8010a9:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8010aa:	83 ec 0c             	sub    $0xc,%esp
+  8010ad:	50                   	push   %eax
+  8010ae:	6a 18                	push   $0x18
+  8010b0:	68 03 36 80 00       	push   $0x803603
+  8010b5:	6a 23                	push   $0x23
+  8010b7:	68 20 36 80 00       	push   $0x803620
+  8010bc:	e8 58 f3 ff ff       	call   800419 <_panic>
+
+008010c1 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  8010c1:	55                   	push   %ebp
+  8010c2:	89 e5                	mov    %esp,%ebp
+  8010c4:	57                   	push   %edi
+  8010c5:	56                   	push   %esi
+  8010c6:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8010c7:	be 00 00 00 00       	mov    $0x0,%esi
+  8010cc:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010cf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010d2:	b8 19 00 00 00       	mov    $0x19,%eax
+  8010d7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010da:	89 f7                	mov    %esi,%edi
+  8010dc:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  8010de:	5b                   	pop    %ebx
+  8010df:	5e                   	pop    %esi
+  8010e0:	5f                   	pop    %edi
+  8010e1:	5d                   	pop    %ebp
+  8010e2:	c3                   	ret
+
+008010e3 <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  8010e3:	55                   	push   %ebp
+  8010e4:	89 e5                	mov    %esp,%ebp
+  8010e6:	57                   	push   %edi
+  8010e7:	56                   	push   %esi
+  8010e8:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8010e9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010ee:	b8 15 00 00 00       	mov    $0x15,%eax
+  8010f3:	89 d1                	mov    %edx,%ecx
+  8010f5:	89 d3                	mov    %edx,%ebx
+  8010f7:	89 d7                	mov    %edx,%edi
+  8010f9:	89 d6                	mov    %edx,%esi
+  8010fb:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8010fd:	5b                   	pop    %ebx
+  8010fe:	5e                   	pop    %esi
+  8010ff:	5f                   	pop    %edi
+  801100:	5d                   	pop    %ebp
+  801101:	c3                   	ret
+
+00801102 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801102:	55                   	push   %ebp
+  801103:	89 e5                	mov    %esp,%ebp
+  801105:	57                   	push   %edi
+  801106:	56                   	push   %esi
+  801107:	53                   	push   %ebx
+  801108:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80110b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801110:	8b 55 08             	mov    0x8(%ebp),%edx
+  801113:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801116:	b8 08 00 00 00       	mov    $0x8,%eax
+  80111b:	89 df                	mov    %ebx,%edi
+  80111d:	89 de                	mov    %ebx,%esi
+  80111f:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801121:	85 c0                	test   %eax,%eax
+  801123:	7f 08                	jg     80112d <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801125:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801128:	5b                   	pop    %ebx
+  801129:	5e                   	pop    %esi
+  80112a:	5f                   	pop    %edi
+  80112b:	5d                   	pop    %ebp
+  80112c:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80112d:	83 ec 0c             	sub    $0xc,%esp
+  801130:	50                   	push   %eax
+  801131:	6a 08                	push   $0x8
+  801133:	68 03 36 80 00       	push   $0x803603
+  801138:	6a 23                	push   $0x23
+  80113a:	68 20 36 80 00       	push   $0x803620
+  80113f:	e8 d5 f2 ff ff       	call   800419 <_panic>
+
+00801144 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801144:	55                   	push   %ebp
+  801145:	89 e5                	mov    %esp,%ebp
+  801147:	57                   	push   %edi
+  801148:	56                   	push   %esi
+  801149:	53                   	push   %ebx
+  80114a:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80114d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801152:	8b 55 08             	mov    0x8(%ebp),%edx
+  801155:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801158:	b8 09 00 00 00       	mov    $0x9,%eax
+  80115d:	89 df                	mov    %ebx,%edi
+  80115f:	89 de                	mov    %ebx,%esi
+  801161:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801163:	85 c0                	test   %eax,%eax
+  801165:	7f 08                	jg     80116f <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  801167:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80116a:	5b                   	pop    %ebx
+  80116b:	5e                   	pop    %esi
+  80116c:	5f                   	pop    %edi
+  80116d:	5d                   	pop    %ebp
+  80116e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80116f:	83 ec 0c             	sub    $0xc,%esp
+  801172:	50                   	push   %eax
+  801173:	6a 09                	push   $0x9
+  801175:	68 03 36 80 00       	push   $0x803603
+  80117a:	6a 23                	push   $0x23
+  80117c:	68 20 36 80 00       	push   $0x803620
+  801181:	e8 93 f2 ff ff       	call   800419 <_panic>
+
+00801186 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801186:	55                   	push   %ebp
+  801187:	89 e5                	mov    %esp,%ebp
+  801189:	57                   	push   %edi
+  80118a:	56                   	push   %esi
+  80118b:	53                   	push   %ebx
+  80118c:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80118f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801194:	8b 55 08             	mov    0x8(%ebp),%edx
+  801197:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80119a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80119f:	89 df                	mov    %ebx,%edi
+  8011a1:	89 de                	mov    %ebx,%esi
+  8011a3:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8011a5:	85 c0                	test   %eax,%eax
+  8011a7:	7f 08                	jg     8011b1 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  8011a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011ac:	5b                   	pop    %ebx
+  8011ad:	5e                   	pop    %esi
+  8011ae:	5f                   	pop    %edi
+  8011af:	5d                   	pop    %ebp
+  8011b0:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8011b1:	83 ec 0c             	sub    $0xc,%esp
+  8011b4:	50                   	push   %eax
+  8011b5:	6a 0a                	push   $0xa
+  8011b7:	68 03 36 80 00       	push   $0x803603
+  8011bc:	6a 23                	push   $0x23
+  8011be:	68 20 36 80 00       	push   $0x803620
+  8011c3:	e8 51 f2 ff ff       	call   800419 <_panic>
+
+008011c8 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  8011c8:	55                   	push   %ebp
+  8011c9:	89 e5                	mov    %esp,%ebp
+  8011cb:	57                   	push   %edi
+  8011cc:	56                   	push   %esi
+  8011cd:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8011ce:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011d4:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8011d9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011dc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011df:	8b 75 18             	mov    0x18(%ebp),%esi
+  8011e2:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  8011e4:	5b                   	pop    %ebx
+  8011e5:	5e                   	pop    %esi
+  8011e6:	5f                   	pop    %edi
+  8011e7:	5d                   	pop    %ebp
+  8011e8:	c3                   	ret
+
+008011e9 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  8011e9:	55                   	push   %ebp
+  8011ea:	89 e5                	mov    %esp,%ebp
+  8011ec:	57                   	push   %edi
+  8011ed:	56                   	push   %esi
+  8011ee:	53                   	push   %ebx
+  8011ef:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8011f2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011f7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011fa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011fd:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801202:	89 df                	mov    %ebx,%edi
+  801204:	89 de                	mov    %ebx,%esi
+  801206:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801208:	85 c0                	test   %eax,%eax
+  80120a:	7f 08                	jg     801214 <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  80120c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80120f:	5b                   	pop    %ebx
+  801210:	5e                   	pop    %esi
+  801211:	5f                   	pop    %edi
+  801212:	5d                   	pop    %ebp
+  801213:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801214:	83 ec 0c             	sub    $0xc,%esp
+  801217:	50                   	push   %eax
+  801218:	6a 0d                	push   $0xd
+  80121a:	68 03 36 80 00       	push   $0x803603
+  80121f:	6a 23                	push   $0x23
+  801221:	68 20 36 80 00       	push   $0x803620
+  801226:	e8 ee f1 ff ff       	call   800419 <_panic>
+
+0080122b <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  80122b:	55                   	push   %ebp
+  80122c:	89 e5                	mov    %esp,%ebp
+  80122e:	57                   	push   %edi
+  80122f:	56                   	push   %esi
+  801230:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801231:	ba 00 00 00 00       	mov    $0x0,%edx
+  801236:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80123b:	89 d1                	mov    %edx,%ecx
+  80123d:	89 d3                	mov    %edx,%ebx
+  80123f:	89 d7                	mov    %edx,%edi
+  801241:	89 d6                	mov    %edx,%esi
+  801243:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801245:	5b                   	pop    %ebx
+  801246:	5e                   	pop    %esi
+  801247:	5f                   	pop    %edi
+  801248:	5d                   	pop    %ebp
+  801249:	c3                   	ret
+
+0080124a <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  80124a:	55                   	push   %ebp
+  80124b:	89 e5                	mov    %esp,%ebp
+  80124d:	57                   	push   %edi
+  80124e:	56                   	push   %esi
+  80124f:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801250:	8b 55 08             	mov    0x8(%ebp),%edx
+  801253:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801256:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80125b:	be 00 00 00 00       	mov    $0x0,%esi
+  801260:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801263:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801266:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  801268:	5b                   	pop    %ebx
+  801269:	5e                   	pop    %esi
+  80126a:	5f                   	pop    %edi
+  80126b:	5d                   	pop    %ebp
+  80126c:	c3                   	ret
+
+0080126d <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  80126d:	55                   	push   %ebp
+  80126e:	89 e5                	mov    %esp,%ebp
+  801270:	57                   	push   %edi
+  801271:	56                   	push   %esi
+  801272:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801273:	be 00 00 00 00       	mov    $0x0,%esi
+  801278:	8b 55 08             	mov    0x8(%ebp),%edx
+  80127b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80127e:	b8 10 00 00 00       	mov    $0x10,%eax
+  801283:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801286:	89 f7                	mov    %esi,%edi
+  801288:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  80128a:	5b                   	pop    %ebx
+  80128b:	5e                   	pop    %esi
+  80128c:	5f                   	pop    %edi
+  80128d:	5d                   	pop    %ebp
+  80128e:	c3                   	ret
+
+0080128f <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  80128f:	55                   	push   %ebp
+  801290:	89 e5                	mov    %esp,%ebp
+  801292:	57                   	push   %edi
+  801293:	56                   	push   %esi
+  801294:	53                   	push   %ebx
+  801295:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  801298:	80 3d 48 67 80 00 00 	cmpb   $0x0,0x806748
+  80129f:	74 41                	je     8012e2 <sys_batch+0x53>
+  8012a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8012a4:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  8012a7:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  8012ae:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8012b1:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  8012b4:	7d 45                	jge    8012fb <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  8012b6:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8012b9:	8b 06                	mov    (%esi),%eax
+  8012bb:	8b 56 04             	mov    0x4(%esi),%edx
+  8012be:	8b 4e 08             	mov    0x8(%esi),%ecx
+  8012c1:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  8012c4:	8b 7e 10             	mov    0x10(%esi),%edi
+  8012c7:	8b 76 14             	mov    0x14(%esi),%esi
+  8012ca:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  8012cc:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8012cf:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  8012d2:	83 c6 1c             	add    $0x1c,%esi
+  8012d5:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  8012d8:	85 c0                	test   %eax,%eax
+  8012da:	78 1f                	js     8012fb <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  8012dc:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  8012e0:	eb cc                	jmp    8012ae <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  8012e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012e7:	b8 13 00 00 00       	mov    $0x13,%eax
+  8012ec:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012ef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012f2:	89 df                	mov    %ebx,%edi
+  8012f4:	89 de                	mov    %ebx,%esi
+  8012f6:	cd 30                	int    $0x30
+  8012f8:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  8012fb:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8012fe:	83 c4 08             	add    $0x8,%esp
+  801301:	5b                   	pop    %ebx
+  801302:	5e                   	pop    %esi
+  801303:	5f                   	pop    %edi
+  801304:	5d                   	pop    %ebp
+  801305:	c3                   	ret
+
+00801306 <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  801306:	55                   	push   %ebp
+  801307:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  801309:	8b 45 08             	mov    0x8(%ebp),%eax
+  80130c:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  801312:	5d                   	pop    %ebp
+  801313:	c3                   	ret
+
+00801314 <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  801314:	55                   	push   %ebp
+  801315:	89 e5                	mov    %esp,%ebp
+  801317:	56                   	push   %esi
+  801318:	53                   	push   %ebx
+  801319:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  80131c:	8b 1e                	mov    (%esi),%ebx
+  80131e:	85 db                	test   %ebx,%ebx
+  801320:	75 09                	jne    80132b <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  801322:	89 d8                	mov    %ebx,%eax
+  801324:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801327:	5b                   	pop    %ebx
+  801328:	5e                   	pop    %esi
+  801329:	5d                   	pop    %ebp
+  80132a:	c3                   	ret
+  b->sb_n = 0;
+  80132b:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  801331:	53                   	push   %ebx
+  801332:	8d 46 04             	lea    0x4(%esi),%eax
+  801335:	50                   	push   %eax
+  801336:	e8 54 ff ff ff       	call   80128f <sys_batch>
+  80133b:	83 c4 08             	add    $0x8,%esp
+  80133e:	85 c0                	test   %eax,%eax
+  801340:	78 1e                	js     801360 <sysbatch_flush+0x4c>
+  if (r < n)
+  801342:	39 c3                	cmp    %eax,%ebx
+  801344:	7f 07                	jg     80134d <sysbatch_flush+0x39>
+  return 0;
+  801346:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80134b:	eb d5                	jmp    801322 <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  80134d:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801350:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  801354:	85 db                	test   %ebx,%ebx
+  801356:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80135b:	0f 49 d8             	cmovns %eax,%ebx
+  80135e:	eb c2                	jmp    801322 <sysbatch_flush+0xe>
+    return r;
+  801360:	89 c3                	mov    %eax,%ebx
+  801362:	eb be                	jmp    801322 <sysbatch_flush+0xe>
+
+00801364 <sysbatch_add>:
+{
+  801364:	55                   	push   %ebp
+  801365:	89 e5                	mov    %esp,%ebp
+  801367:	53                   	push   %ebx
+  801368:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  80136b:	83 3b 40             	cmpl   $0x40,(%ebx)
+  80136e:	74 41                	je     8013b1 <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  801370:	8b 03                	mov    (%ebx),%eax
+  801372:	8d 50 01             	lea    0x1(%eax),%edx
+  801375:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  801377:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80137a:	01 d8                	add    %ebx,%eax
+  80137c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80137f:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  801382:	8b 55 10             	mov    0x10(%ebp),%edx
+  801385:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  801388:	8b 55 14             	mov    0x14(%ebp),%edx
+  80138b:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  80138e:	8b 55 18             	mov    0x18(%ebp),%edx
+  801391:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  801394:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  801397:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  80139a:	8b 55 20             	mov    0x20(%ebp),%edx
+  80139d:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  8013a0:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  8013a7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013ac:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013af:	c9                   	leave
+  8013b0:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  8013b1:	53                   	push   %ebx
+  8013b2:	e8 5d ff ff ff       	call   801314 <sysbatch_flush>
+  8013b7:	83 c4 04             	add    $0x4,%esp
+  8013ba:	85 c0                	test   %eax,%eax
+  8013bc:	79 b2                	jns    801370 <sysbatch_add+0xc>
+  8013be:	eb ec                	jmp    8013ac <sysbatch_add+0x48>
+
+008013c0 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8013c0:	55                   	push   %ebp
+  8013c1:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8013c3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013c6:	05 00 00 00 30       	add    $0x30000000,%eax
+  8013cb:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8013ce:	5d                   	pop    %ebp
+  8013cf:	c3                   	ret
+
+008013d0 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8013d0:	55                   	push   %ebp
+  8013d1:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8013d3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013d6:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  8013d9:	66 b8 00 00          	mov    $0x0,%ax
+  8013dd:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8013e2:	5d                   	pop    %ebp
+  8013e3:	c3                   	ret
+
+008013e4 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8013e4:	55                   	push   %ebp
+  8013e5:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  8013e7:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8013ec:	eb 02                	jmp    8013f0 <fd_alloc+0xc>
+  8013ee:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8013f0:	89 c2                	mov    %eax,%edx
+  8013f2:	c1 ea 16             	shr    $0x16,%edx
+  8013f5:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8013fc:	f6 c2 01             	test   $0x1,%dl
+  8013ff:	74 2b                	je     80142c <fd_alloc+0x48>
+  801401:	89 c2                	mov    %eax,%edx
+  801403:	c1 ea 0c             	shr    $0xc,%edx
+  801406:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80140d:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801413:	f6 c1 01             	test   $0x1,%cl
+  801416:	74 14                	je     80142c <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  801418:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  80141e:	75 ce                	jne    8013ee <fd_alloc+0xa>
+  801420:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  801425:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80142a:	eb 05                	jmp    801431 <fd_alloc+0x4d>
+      return 0;
+  80142c:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  801431:	8b 55 08             	mov    0x8(%ebp),%edx
+  801434:	89 02                	mov    %eax,(%edx)
+}
+  801436:	89 c8                	mov    %ecx,%eax
+  801438:	5d                   	pop    %ebp
+  801439:	c3                   	ret
+
+0080143a <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80143a:	55                   	push   %ebp
+  80143b:	89 e5                	mov    %esp,%ebp
+  80143d:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  801440:	83 f8 1f             	cmp    $0x1f,%eax
+  801443:	77 30                	ja     801475 <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  801445:	c1 e0 0c             	shl    $0xc,%eax
+  801448:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80144d:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801453:	f6 c2 01             	test   $0x1,%dl
+  801456:	74 24                	je     80147c <fd_lookup+0x42>
+  801458:	89 c2                	mov    %eax,%edx
+  80145a:	c1 ea 0c             	shr    $0xc,%edx
+  80145d:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801464:	f6 c2 01             	test   $0x1,%dl
+  801467:	74 1a                	je     801483 <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  801469:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80146c:	89 02                	mov    %eax,(%edx)
+  return 0;
+  80146e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801473:	5d                   	pop    %ebp
+  801474:	c3                   	ret
+    return -E_INVAL;
+  801475:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80147a:	eb f7                	jmp    801473 <fd_lookup+0x39>
+    return -E_INVAL;
+  80147c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801481:	eb f0                	jmp    801473 <fd_lookup+0x39>
+  801483:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801488:	eb e9                	jmp    801473 <fd_lookup+0x39>
+
+0080148a <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80148a:	55                   	push   %ebp
+  80148b:	89 e5                	mov    %esp,%ebp
+  80148d:	53                   	push   %ebx
+  80148e:	83 ec 04             	sub    $0x4,%esp
+  801491:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  801494:	b8 ac 36 80 00       	mov    $0x8036ac,%eax
+  801499:	8b 18                	mov    (%eax),%ebx
+  80149b:	85 db                	test   %ebx,%ebx
+  80149d:	74 0e                	je     8014ad <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  80149f:	83 c0 04             	add    $0x4,%eax
+  8014a2:	39 13                	cmp    %edx,(%ebx)
+  8014a4:	75 f3                	jne    801499 <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  8014a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014ab:	eb 1f                	jmp    8014cc <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8014ad:	a1 44 67 80 00       	mov    0x806744,%eax
+  8014b2:	8b 40 48             	mov    0x48(%eax),%eax
+  8014b5:	83 ec 04             	sub    $0x4,%esp
+  8014b8:	52                   	push   %edx
+  8014b9:	50                   	push   %eax
+  8014ba:	68 30 36 80 00       	push   $0x803630
+  8014bf:	e8 30 f0 ff ff       	call   8004f4 <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  8014c4:	83 c4 10             	add    $0x10,%esp
+  8014c7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  8014cc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8014cf:	89 1a                	mov    %ebx,(%edx)
+}
+  8014d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014d4:	c9                   	leave
+  8014d5:	c3                   	ret
+
+008014d6 <fd_close>:
+{
+  8014d6:	55                   	push   %ebp
+  8014d7:	89 e5                	mov    %esp,%ebp
+  8014d9:	57                   	push   %edi
+  8014da:	56                   	push   %esi
+  8014db:	53                   	push   %ebx
+  8014dc:	83 ec 24             	sub    $0x24,%esp
+  8014df:	8b 75 08             	mov    0x8(%ebp),%esi
+  8014e2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8014e5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8014e8:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8014e9:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8014ef:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8014f2:	50                   	push   %eax
+  8014f3:	e8 42 ff ff ff       	call   80143a <fd_lookup>
+  8014f8:	89 c3                	mov    %eax,%ebx
+  8014fa:	83 c4 10             	add    $0x10,%esp
+  8014fd:	85 c0                	test   %eax,%eax
+  8014ff:	78 05                	js     801506 <fd_close+0x30>
+      || fd != fd2)
+  801501:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801504:	74 16                	je     80151c <fd_close+0x46>
+    return must_exist ? r : 0;
+  801506:	89 f8                	mov    %edi,%eax
+  801508:	84 c0                	test   %al,%al
+  80150a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80150f:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801512:	89 d8                	mov    %ebx,%eax
+  801514:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801517:	5b                   	pop    %ebx
+  801518:	5e                   	pop    %esi
+  801519:	5f                   	pop    %edi
+  80151a:	5d                   	pop    %ebp
+  80151b:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80151c:	83 ec 08             	sub    $0x8,%esp
+  80151f:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801522:	50                   	push   %eax
+  801523:	ff 36                	push   (%esi)
+  801525:	e8 60 ff ff ff       	call   80148a <dev_lookup>
+  80152a:	89 c3                	mov    %eax,%ebx
+  80152c:	83 c4 10             	add    $0x10,%esp
+  80152f:	85 c0                	test   %eax,%eax
+  801531:	78 1a                	js     80154d <fd_close+0x77>
+    if (dev->dev_close)
+  801533:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801536:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  801539:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  80153e:	85 c0                	test   %eax,%eax
+  801540:	74 0b                	je     80154d <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  801542:	83 ec 0c             	sub    $0xc,%esp
+  801545:	56                   	push   %esi
+  801546:	ff d0                	call   *%eax
+  801548:	89 c3                	mov    %eax,%ebx
+  80154a:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  80154d:	83 ec 08             	sub    $0x8,%esp
+  801550:	56                   	push   %esi
+  801551:	6a 00                	push   $0x0
+  801553:	e8 3e fa ff ff       	call   800f96 <sys_page_unmap>
+  return r;
+  801558:	83 c4 10             	add    $0x10,%esp
+  80155b:	eb b5                	jmp    801512 <fd_close+0x3c>
+
+0080155d <close>:
+
+int
+close(int fdnum)
+{
+  80155d:	55                   	push   %ebp
+  80155e:	89 e5                	mov    %esp,%ebp
+  801560:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801563:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801566:	50                   	push   %eax
+  801567:	ff 75 08             	push   0x8(%ebp)
+  80156a:	e8 cb fe ff ff       	call   80143a <fd_lookup>
+  80156f:	83 c4 10             	add    $0x10,%esp
+  801572:	85 c0                	test   %eax,%eax
+  801574:	79 02                	jns    801578 <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  801576:	c9                   	leave
+  801577:	c3                   	ret
+    return fd_close(fd, 1);
+  801578:	83 ec 08             	sub    $0x8,%esp
+  80157b:	6a 01                	push   $0x1
+  80157d:	ff 75 f4             	push   -0xc(%ebp)
+  801580:	e8 51 ff ff ff       	call   8014d6 <fd_close>
+  801585:	83 c4 10             	add    $0x10,%esp
+  801588:	eb ec                	jmp    801576 <close+0x19>
+
+0080158a <close_all>:
+
+void
+close_all(void)
+{
+  80158a:	55                   	push   %ebp
+  80158b:	89 e5                	mov    %esp,%ebp
+  80158d:	53                   	push   %ebx
+  80158e:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  801591:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  801596:	83 ec 0c             	sub    $0xc,%esp
+  801599:	53                   	push   %ebx
+  80159a:	e8 be ff ff ff       	call   80155d <close>
+  for (i = 0; i < MAXFD; i++)
+  80159f:	83 c3 01             	add    $0x1,%ebx
+  8015a2:	83 c4 10             	add    $0x10,%esp
+  8015a5:	83 fb 20             	cmp    $0x20,%ebx
+  8015a8:	75 ec                	jne    801596 <close_all+0xc>
+}
+  8015aa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015ad:	c9                   	leave
+  8015ae:	c3                   	ret
+
+008015af <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8015af:	55                   	push   %ebp
+  8015b0:	89 e5                	mov    %esp,%ebp
+  8015b2:	57                   	push   %edi
+  8015b3:	56                   	push   %esi
+  8015b4:	53                   	push   %ebx
+  8015b5:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8015b8:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8015bb:	50                   	push   %eax
+  8015bc:	ff 75 08             	push   0x8(%ebp)
+  8015bf:	e8 76 fe ff ff       	call   80143a <fd_lookup>
+  8015c4:	89 c6                	mov    %eax,%esi
+  8015c6:	83 c4 10             	add    $0x10,%esp
+  8015c9:	85 c0                	test   %eax,%eax
+  8015cb:	0f 88 0a 01 00 00    	js     8016db <dup+0x12c>
+    return r;
+  close(newfdnum);
+  8015d1:	83 ec 0c             	sub    $0xc,%esp
+  8015d4:	ff 75 0c             	push   0xc(%ebp)
+  8015d7:	e8 81 ff ff ff       	call   80155d <close>
+
+  newfd = INDEX2FD(newfdnum);
+  8015dc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8015df:	c1 e0 0c             	shl    $0xc,%eax
+  8015e2:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  8015e8:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  8015eb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8015ee:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8015f1:	89 04 24             	mov    %eax,(%esp)
+  8015f4:	e8 d7 fd ff ff       	call   8013d0 <fd2data>
+  8015f9:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  8015fb:	89 3c 24             	mov    %edi,(%esp)
+  8015fe:	e8 cd fd ff ff       	call   8013d0 <fd2data>
+  801603:	83 c4 10             	add    $0x10,%esp
+  801606:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801609:	89 f3                	mov    %esi,%ebx
+  80160b:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  801611:	89 c6                	mov    %eax,%esi
+  801613:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801616:	89 cf                	mov    %ecx,%edi
+  801618:	eb 0c                	jmp    801626 <dup+0x77>
+  80161a:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801620:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801626:	39 fb                	cmp    %edi,%ebx
+  801628:	74 7b                	je     8016a5 <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  80162a:	89 d8                	mov    %ebx,%eax
+  80162c:	c1 e8 16             	shr    $0x16,%eax
+  80162f:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801636:	a8 01                	test   $0x1,%al
+  801638:	74 e0                	je     80161a <dup+0x6b>
+  80163a:	89 d8                	mov    %ebx,%eax
+  80163c:	c1 e8 0c             	shr    $0xc,%eax
+  80163f:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801646:	f6 c2 01             	test   $0x1,%dl
+  801649:	74 cf                	je     80161a <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  80164b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  801652:	83 ec 0c             	sub    $0xc,%esp
+  801655:	25 07 0e 00 00       	and    $0xe07,%eax
+  80165a:	50                   	push   %eax
+  80165b:	56                   	push   %esi
+  80165c:	6a 00                	push   $0x0
+  80165e:	53                   	push   %ebx
+  80165f:	6a 00                	push   $0x0
+  801661:	e8 ee f8 ff ff       	call   800f54 <sys_page_map>
+  801666:	83 c4 20             	add    $0x20,%esp
+  801669:	85 c0                	test   %eax,%eax
+  80166b:	79 ad                	jns    80161a <dup+0x6b>
+  80166d:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801670:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  801672:	83 ec 08             	sub    $0x8,%esp
+  801675:	ff 75 d4             	push   -0x2c(%ebp)
+  801678:	6a 00                	push   $0x0
+  80167a:	e8 17 f9 ff ff       	call   800f96 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80167f:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  801682:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  801688:	83 c4 10             	add    $0x10,%esp
+  80168b:	39 df                	cmp    %ebx,%edi
+  80168d:	74 4c                	je     8016db <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  80168f:	83 ec 08             	sub    $0x8,%esp
+  801692:	57                   	push   %edi
+  801693:	6a 00                	push   $0x0
+  801695:	e8 fc f8 ff ff       	call   800f96 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80169a:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  8016a0:	83 c4 10             	add    $0x10,%esp
+  8016a3:	eb e6                	jmp    80168b <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8016a5:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8016a8:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8016ab:	89 c8                	mov    %ecx,%eax
+  8016ad:	c1 e8 0c             	shr    $0xc,%eax
+  8016b0:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8016b7:	83 ec 0c             	sub    $0xc,%esp
+  8016ba:	25 07 0e 00 00       	and    $0xe07,%eax
+  8016bf:	50                   	push   %eax
+  8016c0:	ff 75 d4             	push   -0x2c(%ebp)
+  8016c3:	6a 00                	push   $0x0
+  8016c5:	51                   	push   %ecx
+  8016c6:	6a 00                	push   $0x0
+  8016c8:	e8 87 f8 ff ff       	call   800f54 <sys_page_map>
+  8016cd:	89 c6                	mov    %eax,%esi
+  8016cf:	83 c4 20             	add    $0x20,%esp
+  8016d2:	85 c0                	test   %eax,%eax
+  8016d4:	78 9c                	js     801672 <dup+0xc3>
+  return newfdnum;
+  8016d6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8016d9:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  8016db:	89 f0                	mov    %esi,%eax
+  8016dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016e0:	5b                   	pop    %ebx
+  8016e1:	5e                   	pop    %esi
+  8016e2:	5f                   	pop    %edi
+  8016e3:	5d                   	pop    %ebp
+  8016e4:	c3                   	ret
+
+008016e5 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8016e5:	55                   	push   %ebp
+  8016e6:	89 e5                	mov    %esp,%ebp
+  8016e8:	56                   	push   %esi
+  8016e9:	53                   	push   %ebx
+  8016ea:	83 ec 18             	sub    $0x18,%esp
+  8016ed:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016f0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016f3:	50                   	push   %eax
+  8016f4:	56                   	push   %esi
+  8016f5:	e8 40 fd ff ff       	call   80143a <fd_lookup>
+  8016fa:	83 c4 10             	add    $0x10,%esp
+  8016fd:	85 c0                	test   %eax,%eax
+  8016ff:	78 3c                	js     80173d <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801701:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801704:	83 ec 08             	sub    $0x8,%esp
+  801707:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80170a:	50                   	push   %eax
+  80170b:	ff 33                	push   (%ebx)
+  80170d:	e8 78 fd ff ff       	call   80148a <dev_lookup>
+  801712:	83 c4 10             	add    $0x10,%esp
+  801715:	85 c0                	test   %eax,%eax
+  801717:	78 24                	js     80173d <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801719:	8b 43 08             	mov    0x8(%ebx),%eax
+  80171c:	83 e0 03             	and    $0x3,%eax
+  80171f:	83 f8 01             	cmp    $0x1,%eax
+  801722:	74 20                	je     801744 <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  801724:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801727:	8b 40 08             	mov    0x8(%eax),%eax
+  80172a:	85 c0                	test   %eax,%eax
+  80172c:	74 37                	je     801765 <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  80172e:	83 ec 04             	sub    $0x4,%esp
+  801731:	ff 75 10             	push   0x10(%ebp)
+  801734:	ff 75 0c             	push   0xc(%ebp)
+  801737:	53                   	push   %ebx
+  801738:	ff d0                	call   *%eax
+  80173a:	83 c4 10             	add    $0x10,%esp
+}
+  80173d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801740:	5b                   	pop    %ebx
+  801741:	5e                   	pop    %esi
+  801742:	5d                   	pop    %ebp
+  801743:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801744:	a1 44 67 80 00       	mov    0x806744,%eax
+  801749:	8b 40 48             	mov    0x48(%eax),%eax
+  80174c:	83 ec 04             	sub    $0x4,%esp
+  80174f:	56                   	push   %esi
+  801750:	50                   	push   %eax
+  801751:	68 71 36 80 00       	push   $0x803671
+  801756:	e8 99 ed ff ff       	call   8004f4 <cprintf>
+    return -E_INVAL;
+  80175b:	83 c4 10             	add    $0x10,%esp
+  80175e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801763:	eb d8                	jmp    80173d <read+0x58>
+    return -E_NOT_SUPP;
+  801765:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80176a:	eb d1                	jmp    80173d <read+0x58>
+
+0080176c <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80176c:	55                   	push   %ebp
+  80176d:	89 e5                	mov    %esp,%ebp
+  80176f:	57                   	push   %edi
+  801770:	56                   	push   %esi
+  801771:	53                   	push   %ebx
+  801772:	83 ec 0c             	sub    $0xc,%esp
+  801775:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801778:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  80177b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801780:	eb 02                	jmp    801784 <readn+0x18>
+  801782:	01 c3                	add    %eax,%ebx
+  801784:	39 f3                	cmp    %esi,%ebx
+  801786:	73 21                	jae    8017a9 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  801788:	83 ec 04             	sub    $0x4,%esp
+  80178b:	89 f0                	mov    %esi,%eax
+  80178d:	29 d8                	sub    %ebx,%eax
+  80178f:	50                   	push   %eax
+  801790:	89 d8                	mov    %ebx,%eax
+  801792:	03 45 0c             	add    0xc(%ebp),%eax
+  801795:	50                   	push   %eax
+  801796:	57                   	push   %edi
+  801797:	e8 49 ff ff ff       	call   8016e5 <read>
+    if (m < 0)
+  80179c:	83 c4 10             	add    $0x10,%esp
+  80179f:	85 c0                	test   %eax,%eax
+  8017a1:	78 04                	js     8017a7 <readn+0x3b>
+      return m;
+    if (m == 0)
+  8017a3:	75 dd                	jne    801782 <readn+0x16>
+  8017a5:	eb 02                	jmp    8017a9 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  8017a7:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  8017a9:	89 d8                	mov    %ebx,%eax
+  8017ab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017ae:	5b                   	pop    %ebx
+  8017af:	5e                   	pop    %esi
+  8017b0:	5f                   	pop    %edi
+  8017b1:	5d                   	pop    %ebp
+  8017b2:	c3                   	ret
+
+008017b3 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8017b3:	55                   	push   %ebp
+  8017b4:	89 e5                	mov    %esp,%ebp
+  8017b6:	56                   	push   %esi
+  8017b7:	53                   	push   %ebx
+  8017b8:	83 ec 18             	sub    $0x18,%esp
+  8017bb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017be:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017c1:	50                   	push   %eax
+  8017c2:	53                   	push   %ebx
+  8017c3:	e8 72 fc ff ff       	call   80143a <fd_lookup>
+  8017c8:	83 c4 10             	add    $0x10,%esp
+  8017cb:	85 c0                	test   %eax,%eax
+  8017cd:	78 37                	js     801806 <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017cf:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8017d2:	83 ec 08             	sub    $0x8,%esp
+  8017d5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017d8:	50                   	push   %eax
+  8017d9:	ff 36                	push   (%esi)
+  8017db:	e8 aa fc ff ff       	call   80148a <dev_lookup>
+  8017e0:	83 c4 10             	add    $0x10,%esp
+  8017e3:	85 c0                	test   %eax,%eax
+  8017e5:	78 1f                	js     801806 <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8017e7:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8017eb:	74 20                	je     80180d <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  8017ed:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017f0:	8b 40 0c             	mov    0xc(%eax),%eax
+  8017f3:	85 c0                	test   %eax,%eax
+  8017f5:	74 37                	je     80182e <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  8017f7:	83 ec 04             	sub    $0x4,%esp
+  8017fa:	ff 75 10             	push   0x10(%ebp)
+  8017fd:	ff 75 0c             	push   0xc(%ebp)
+  801800:	56                   	push   %esi
+  801801:	ff d0                	call   *%eax
+  801803:	83 c4 10             	add    $0x10,%esp
+}
+  801806:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801809:	5b                   	pop    %ebx
+  80180a:	5e                   	pop    %esi
+  80180b:	5d                   	pop    %ebp
+  80180c:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80180d:	a1 44 67 80 00       	mov    0x806744,%eax
+  801812:	8b 40 48             	mov    0x48(%eax),%eax
+  801815:	83 ec 04             	sub    $0x4,%esp
+  801818:	53                   	push   %ebx
+  801819:	50                   	push   %eax
+  80181a:	68 8d 36 80 00       	push   $0x80368d
+  80181f:	e8 d0 ec ff ff       	call   8004f4 <cprintf>
+    return -E_INVAL;
+  801824:	83 c4 10             	add    $0x10,%esp
+  801827:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80182c:	eb d8                	jmp    801806 <write+0x53>
+    return -E_NOT_SUPP;
+  80182e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801833:	eb d1                	jmp    801806 <write+0x53>
+
+00801835 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801835:	55                   	push   %ebp
+  801836:	89 e5                	mov    %esp,%ebp
+  801838:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80183b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80183e:	50                   	push   %eax
+  80183f:	ff 75 08             	push   0x8(%ebp)
+  801842:	e8 f3 fb ff ff       	call   80143a <fd_lookup>
+  801847:	83 c4 10             	add    $0x10,%esp
+  80184a:	85 c0                	test   %eax,%eax
+  80184c:	78 0e                	js     80185c <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  80184e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801851:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801854:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  801857:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80185c:	c9                   	leave
+  80185d:	c3                   	ret
+
+0080185e <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80185e:	55                   	push   %ebp
+  80185f:	89 e5                	mov    %esp,%ebp
+  801861:	56                   	push   %esi
+  801862:	53                   	push   %ebx
+  801863:	83 ec 18             	sub    $0x18,%esp
+  801866:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801869:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80186c:	50                   	push   %eax
+  80186d:	53                   	push   %ebx
+  80186e:	e8 c7 fb ff ff       	call   80143a <fd_lookup>
+  801873:	83 c4 10             	add    $0x10,%esp
+  801876:	85 c0                	test   %eax,%eax
+  801878:	78 34                	js     8018ae <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80187a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80187d:	83 ec 08             	sub    $0x8,%esp
+  801880:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801883:	50                   	push   %eax
+  801884:	ff 36                	push   (%esi)
+  801886:	e8 ff fb ff ff       	call   80148a <dev_lookup>
+  80188b:	83 c4 10             	add    $0x10,%esp
+  80188e:	85 c0                	test   %eax,%eax
+  801890:	78 1c                	js     8018ae <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801892:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801896:	74 1d                	je     8018b5 <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  801898:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80189b:	8b 40 18             	mov    0x18(%eax),%eax
+  80189e:	85 c0                	test   %eax,%eax
+  8018a0:	74 34                	je     8018d6 <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  8018a2:	83 ec 08             	sub    $0x8,%esp
+  8018a5:	ff 75 0c             	push   0xc(%ebp)
+  8018a8:	56                   	push   %esi
+  8018a9:	ff d0                	call   *%eax
+  8018ab:	83 c4 10             	add    $0x10,%esp
+}
+  8018ae:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018b1:	5b                   	pop    %ebx
+  8018b2:	5e                   	pop    %esi
+  8018b3:	5d                   	pop    %ebp
+  8018b4:	c3                   	ret
+            thisenv->env_id, fdnum);
+  8018b5:	a1 44 67 80 00       	mov    0x806744,%eax
+  8018ba:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8018bd:	83 ec 04             	sub    $0x4,%esp
+  8018c0:	53                   	push   %ebx
+  8018c1:	50                   	push   %eax
+  8018c2:	68 50 36 80 00       	push   $0x803650
+  8018c7:	e8 28 ec ff ff       	call   8004f4 <cprintf>
+    return -E_INVAL;
+  8018cc:	83 c4 10             	add    $0x10,%esp
+  8018cf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018d4:	eb d8                	jmp    8018ae <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  8018d6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8018db:	eb d1                	jmp    8018ae <ftruncate+0x50>
+
+008018dd <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8018dd:	55                   	push   %ebp
+  8018de:	89 e5                	mov    %esp,%ebp
+  8018e0:	56                   	push   %esi
+  8018e1:	53                   	push   %ebx
+  8018e2:	83 ec 18             	sub    $0x18,%esp
+  8018e5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  8018e8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018eb:	50                   	push   %eax
+  8018ec:	ff 75 08             	push   0x8(%ebp)
+  8018ef:	e8 46 fb ff ff       	call   80143a <fd_lookup>
+  8018f4:	83 c4 10             	add    $0x10,%esp
+  8018f7:	85 c0                	test   %eax,%eax
+  8018f9:	78 49                	js     801944 <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8018fb:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8018fe:	83 ec 08             	sub    $0x8,%esp
+  801901:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801904:	50                   	push   %eax
+  801905:	ff 36                	push   (%esi)
+  801907:	e8 7e fb ff ff       	call   80148a <dev_lookup>
+  80190c:	83 c4 10             	add    $0x10,%esp
+  80190f:	85 c0                	test   %eax,%eax
+  801911:	78 31                	js     801944 <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  801913:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801916:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80191a:	74 2f                	je     80194b <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  80191c:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  80191f:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801926:	00 00 00 
+  stat->st_isdir = 0;
+  801929:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801930:	00 00 00 
+  stat->st_dev = dev;
+  801933:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  801939:	83 ec 08             	sub    $0x8,%esp
+  80193c:	53                   	push   %ebx
+  80193d:	56                   	push   %esi
+  80193e:	ff 50 14             	call   *0x14(%eax)
+  801941:	83 c4 10             	add    $0x10,%esp
+}
+  801944:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801947:	5b                   	pop    %ebx
+  801948:	5e                   	pop    %esi
+  801949:	5d                   	pop    %ebp
+  80194a:	c3                   	ret
+    return -E_NOT_SUPP;
+  80194b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801950:	eb f2                	jmp    801944 <fstat+0x67>
+
+00801952 <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  801952:	55                   	push   %ebp
+  801953:	89 e5                	mov    %esp,%ebp
+  801955:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  801958:	ff 75 0c             	push   0xc(%ebp)
+  80195b:	ff 75 08             	push   0x8(%ebp)
+  80195e:	e8 58 07 00 00       	call   8020bb <file_stat>
+}
+  801963:	c9                   	leave
+  801964:	c3                   	ret
+
+00801965 <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  801965:	55                   	push   %ebp
+  801966:	89 e5                	mov    %esp,%ebp
+  801968:	57                   	push   %edi
+  801969:	56                   	push   %esi
+  80196a:	53                   	push   %ebx
+  80196b:	83 ec 1c             	sub    $0x1c,%esp
+  80196e:	89 c7                	mov    %eax,%edi
+  801970:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801973:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801976:	e9 a2 00 00 00       	jmp    801a1d <fsipc_send+0xb8>
+  nfsenvs = 0;
+  80197b:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  801982:	00 00 00 
+  801985:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80198a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  80198f:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801994:	be 01 00 00 00       	mov    $0x1,%esi
+  801999:	eb 0f                	jmp    8019aa <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  80199b:	83 c0 01             	add    $0x1,%eax
+  80199e:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8019a3:	74 49                	je     8019ee <fsipc_send+0x89>
+  8019a5:	83 f9 07             	cmp    $0x7,%ecx
+  8019a8:	7f 50                	jg     8019fa <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  8019aa:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  8019ad:	c1 e2 04             	shl    $0x4,%edx
+  8019b0:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8019b6:	8b 52 50             	mov    0x50(%edx),%edx
+  8019b9:	83 fa 01             	cmp    $0x1,%edx
+  8019bc:	75 dd                	jne    80199b <fsipc_send+0x36>
+  8019be:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  8019c1:	c1 e2 04             	shl    $0x4,%edx
+  8019c4:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8019ca:	8b 52 54             	mov    0x54(%edx),%edx
+  8019cd:	85 d2                	test   %edx,%edx
+  8019cf:	74 ca                	je     80199b <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  8019d1:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  8019d4:	c1 e2 04             	shl    $0x4,%edx
+  8019d7:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8019dd:	8b 52 48             	mov    0x48(%edx),%edx
+  8019e0:	89 14 8d 20 60 80 00 	mov    %edx,0x806020(,%ecx,4)
+  8019e7:	8d 49 01             	lea    0x1(%ecx),%ecx
+  8019ea:	89 f3                	mov    %esi,%ebx
+  8019ec:	eb ad                	jmp    80199b <fsipc_send+0x36>
+  8019ee:	84 db                	test   %bl,%bl
+  8019f0:	74 38                	je     801a2a <fsipc_send+0xc5>
+  8019f2:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+  8019f8:	eb 30                	jmp    801a2a <fsipc_send+0xc5>
+  8019fa:	84 db                	test   %bl,%bl
+  8019fc:	74 2c                	je     801a2a <fsipc_send+0xc5>
+  8019fe:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+  801a04:	eb 24                	jmp    801a2a <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  801a06:	50                   	push   %eax
+  801a07:	68 bc 36 80 00       	push   $0x8036bc
+  801a0c:	6a 34                	push   $0x34
+  801a0e:	68 c6 36 80 00       	push   $0x8036c6
+  801a13:	e8 01 ea ff ff       	call   800419 <_panic>
+    }
+    sys_yield();
+  801a18:	e8 92 f4 ff ff       	call   800eaf <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  801a1d:	83 3d 00 60 80 00 03 	cmpl   $0x3,0x806000
+  801a24:	0f 8e 51 ff ff ff    	jle    80197b <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  801a2a:	a1 44 67 80 00       	mov    0x806744,%eax
+  801a2f:	8b 70 48             	mov    0x48(%eax),%esi
+  801a32:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  801a38:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a3d:	8b 0d 00 60 80 00    	mov    0x806000,%ecx
+  801a43:	39 d9                	cmp    %ebx,%ecx
+  801a45:	7e d1                	jle    801a18 <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  801a47:	83 ec 0c             	sub    $0xc,%esp
+  801a4a:	ff 75 e0             	push   -0x20(%ebp)
+  801a4d:	6a 07                	push   $0x7
+  801a4f:	ff 75 e4             	push   -0x1c(%ebp)
+  801a52:	57                   	push   %edi
+  801a53:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  801a56:	99                   	cltd
+  801a57:	f7 f9                	idiv   %ecx
+  801a59:	ff 34 95 20 60 80 00 	push   0x806020(,%edx,4)
+  801a60:	e8 63 f7 ff ff       	call   8011c8 <sys_ipc_try_send>
+      if (r == 0)
+  801a65:	83 c4 20             	add    $0x20,%esp
+  801a68:	85 c0                	test   %eax,%eax
+  801a6a:	74 0a                	je     801a76 <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  801a6c:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801a6f:	75 95                	jne    801a06 <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  801a71:	83 c3 01             	add    $0x1,%ebx
+  801a74:	eb c7                	jmp    801a3d <fsipc_send+0xd8>
+  }
+}
+  801a76:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a79:	5b                   	pop    %ebx
+  801a7a:	5e                   	pop    %esi
+  801a7b:	5f                   	pop    %edi
+  801a7c:	5d                   	pop    %ebp
+  801a7d:	c3                   	ret
+
+00801a7e <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801a7e:	55                   	push   %ebp
+  801a7f:	89 e5                	mov    %esp,%ebp
+  801a81:	53                   	push   %ebx
+  801a82:	83 ec 14             	sub    $0x14,%esp
+  801a85:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  801a87:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  801a8e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801a93:	ba 00 70 80 00       	mov    $0x807000,%edx
+  801a98:	e8 c8 fe ff ff       	call   801965 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801a9d:	6a 00                	push   $0x0
+  801a9f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801aa2:	50                   	push   %eax
+  801aa3:	53                   	push   %ebx
+  801aa4:	6a 00                	push   $0x0
+  801aa6:	e8 26 13 00 00       	call   802dd1 <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  801aab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801aae:	c9                   	leave
+  801aaf:	c3                   	ret
+
+00801ab0 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801ab0:	55                   	push   %ebp
+  801ab1:	89 e5                	mov    %esp,%ebp
+  801ab3:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801ab6:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ab9:	8b 40 0c             	mov    0xc(%eax),%eax
+  801abc:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.set_size.req_size = newsize;
+  801ac1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ac4:	a3 04 70 80 00       	mov    %eax,0x807004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801ac9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ace:	b8 02 00 00 00       	mov    $0x2,%eax
+  801ad3:	e8 a6 ff ff ff       	call   801a7e <fsipc>
+}
+  801ad8:	c9                   	leave
+  801ad9:	c3                   	ret
+
+00801ada <devfile_flush>:
+{
+  801ada:	55                   	push   %ebp
+  801adb:	89 e5                	mov    %esp,%ebp
+  801add:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801ae0:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ae3:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ae6:	a3 00 70 80 00       	mov    %eax,0x807000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801aeb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801af0:	b8 06 00 00 00       	mov    $0x6,%eax
+  801af5:	e8 84 ff ff ff       	call   801a7e <fsipc>
+}
+  801afa:	c9                   	leave
+  801afb:	c3                   	ret
+
+00801afc <devfile_stat>:
+{
+  801afc:	55                   	push   %ebp
+  801afd:	89 e5                	mov    %esp,%ebp
+  801aff:	53                   	push   %ebx
+  801b00:	83 ec 04             	sub    $0x4,%esp
+  801b03:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801b06:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b09:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b0c:	a3 00 70 80 00       	mov    %eax,0x807000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801b11:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b16:	b8 05 00 00 00       	mov    $0x5,%eax
+  801b1b:	e8 5e ff ff ff       	call   801a7e <fsipc>
+  801b20:	85 c0                	test   %eax,%eax
+  801b22:	78 2c                	js     801b50 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801b24:	83 ec 08             	sub    $0x8,%esp
+  801b27:	68 00 70 80 00       	push   $0x807000
+  801b2c:	53                   	push   %ebx
+  801b2d:	e8 b0 ef ff ff       	call   800ae2 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  801b32:	a1 80 70 80 00       	mov    0x807080,%eax
+  801b37:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801b3d:	a1 84 70 80 00       	mov    0x807084,%eax
+  801b42:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801b48:	83 c4 10             	add    $0x10,%esp
+  801b4b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b50:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b53:	c9                   	leave
+  801b54:	c3                   	ret
+
+00801b55 <fsv_alloc>:
+{
+  801b55:	55                   	push   %ebp
+  801b56:	89 e5                	mov    %esp,%ebp
+  801b58:	56                   	push   %esi
+  801b59:	53                   	push   %ebx
+  801b5a:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  801b5c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b61:	eb 22                	jmp    801b85 <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  801b63:	83 ec 04             	sub    $0x4,%esp
+  801b66:	6a 00                	push   $0x0
+  801b68:	6a 00                	push   $0x0
+  801b6a:	6a 07                	push   $0x7
+  801b6c:	50                   	push   %eax
+  801b6d:	6a 00                	push   $0x0
+  801b6f:	6a 04                	push   $0x4
+  801b71:	68 40 60 80 00       	push   $0x806040
+  801b76:	e8 e9 f7 ff ff       	call   801364 <sysbatch_add>
+  801b7b:	83 c4 20             	add    $0x20,%esp
+  801b7e:	85 c0                	test   %eax,%eax
+  801b80:	78 48                	js     801bca <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  801b82:	83 c3 01             	add    $0x1,%ebx
+  801b85:	39 f3                	cmp    %esi,%ebx
+  801b87:	74 31                	je     801bba <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  801b89:	89 d8                	mov    %ebx,%eax
+  801b8b:	c1 e0 0c             	shl    $0xc,%eax
+  801b8e:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801b93:	89 c2                	mov    %eax,%edx
+  801b95:	c1 ea 16             	shr    $0x16,%edx
+  801b98:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801b9f:	f6 c2 01             	test   $0x1,%dl
+  801ba2:	74 bf                	je     801b63 <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  801ba4:	89 c2                	mov    %eax,%edx
+  801ba6:	c1 ea 0c             	shr    $0xc,%edx
+  801ba9:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801bb0:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801bb3:	83 fa 03             	cmp    $0x3,%edx
+  801bb6:	75 ab                	jne    801b63 <fsv_alloc+0xe>
+  801bb8:	eb c8                	jmp    801b82 <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  801bba:	83 ec 0c             	sub    $0xc,%esp
+  801bbd:	68 40 60 80 00       	push   $0x806040
+  801bc2:	e8 4d f7 ff ff       	call   801314 <sysbatch_flush>
+  801bc7:	83 c4 10             	add    $0x10,%esp
+}
+  801bca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bcd:	5b                   	pop    %ebx
+  801bce:	5e                   	pop    %esi
+  801bcf:	5d                   	pop    %ebp
+  801bd0:	c3                   	ret
+
+00801bd1 <devfile_read>:
+{
+  801bd1:	55                   	push   %ebp
+  801bd2:	89 e5                	mov    %esp,%ebp
+  801bd4:	57                   	push   %edi
+  801bd5:	56                   	push   %esi
+  801bd6:	53                   	push   %ebx
+  801bd7:	83 ec 3c             	sub    $0x3c,%esp
+  801bda:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  801bdd:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  801be3:	77 57                	ja     801c3c <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801be5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801be8:	8b 40 0c             	mov    0xc(%eax),%eax
+  801beb:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.read.req_n = n;
+  801bf0:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801bf6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bfb:	b8 03 00 00 00       	mov    $0x3,%eax
+  801c00:	e8 79 fe ff ff       	call   801a7e <fsipc>
+  801c05:	89 c6                	mov    %eax,%esi
+  801c07:	85 c0                	test   %eax,%eax
+  801c09:	78 27                	js     801c32 <devfile_read+0x61>
+  assert(r <= n);
+  801c0b:	39 c3                	cmp    %eax,%ebx
+  801c0d:	0f 82 0e 02 00 00    	jb     801e21 <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  801c13:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801c18:	0f 8f 1c 02 00 00    	jg     801e3a <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801c1e:	83 ec 04             	sub    $0x4,%esp
+  801c21:	50                   	push   %eax
+  801c22:	68 00 70 80 00       	push   $0x807000
+  801c27:	ff 75 0c             	push   0xc(%ebp)
+  801c2a:	e8 39 f0 ff ff       	call   800c68 <memmove>
+  return r;
+  801c2f:	83 c4 10             	add    $0x10,%esp
+}
+  801c32:	89 f0                	mov    %esi,%eax
+  801c34:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c37:	5b                   	pop    %ebx
+  801c38:	5e                   	pop    %esi
+  801c39:	5f                   	pop    %edi
+  801c3a:	5d                   	pop    %ebp
+  801c3b:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  801c3c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801c41:	e8 0f ff ff ff       	call   801b55 <fsv_alloc>
+  801c46:	89 c6                	mov    %eax,%esi
+  801c48:	85 c0                	test   %eax,%eax
+  801c4a:	78 e6                	js     801c32 <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  801c4c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c4f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c52:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  801c57:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c5a:	8b 40 04             	mov    0x4(%eax),%eax
+  801c5d:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  801c62:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  801c68:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801c6f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801c74:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801c79:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801c7e:	e8 e2 fc ff ff       	call   801965 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801c83:	6a 00                	push   $0x0
+  801c85:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801c88:	50                   	push   %eax
+  801c89:	68 00 10 c0 9f       	push   $0x9fc01000
+  801c8e:	6a 00                	push   $0x0
+  801c90:	e8 3c 11 00 00       	call   802dd1 <ipc_recv_pages>
+  801c95:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  801c97:	83 c4 10             	add    $0x10,%esp
+  801c9a:	85 c0                	test   %eax,%eax
+  801c9c:	7e 94                	jle    801c32 <devfile_read+0x61>
+  assert(r <= n);
+  801c9e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801ca1:	39 c3                	cmp    %eax,%ebx
+  801ca3:	72 2e                	jb     801cd3 <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801ca5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ca8:	8b 40 04             	mov    0x4(%eax),%eax
+  801cab:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801cb0:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  801cb3:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801cb6:	c1 e2 0c             	shl    $0xc,%edx
+  801cb9:	39 ca                	cmp    %ecx,%edx
+  801cbb:	72 2f                	jb     801cec <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  801cbd:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  801cc2:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  801cc5:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  801cc9:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801cce:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  801cd1:	eb 52                	jmp    801d25 <devfile_read+0x154>
+  assert(r <= n);
+  801cd3:	68 d1 36 80 00       	push   $0x8036d1
+  801cd8:	68 d8 36 80 00       	push   $0x8036d8
+  801cdd:	68 49 01 00 00       	push   $0x149
+  801ce2:	68 c6 36 80 00       	push   $0x8036c6
+  801ce7:	e8 2d e7 ff ff       	call   800419 <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801cec:	68 fc 36 80 00       	push   $0x8036fc
+  801cf1:	68 d8 36 80 00       	push   $0x8036d8
+  801cf6:	68 4a 01 00 00       	push   $0x14a
+  801cfb:	68 c6 36 80 00       	push   $0x8036c6
+  801d00:	e8 14 e7 ff ff       	call   800419 <_panic>
+      memmove(dst + done, src + done, m);
+  801d05:	83 ec 04             	sub    $0x4,%esp
+  801d08:	53                   	push   %ebx
+  801d09:	56                   	push   %esi
+  801d0a:	89 f8                	mov    %edi,%eax
+  801d0c:	03 45 0c             	add    0xc(%ebp),%eax
+  801d0f:	50                   	push   %eax
+  801d10:	e8 53 ef ff ff       	call   800c68 <memmove>
+  801d15:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  801d18:	01 df                	add    %ebx,%edi
+  801d1a:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801d1d:	39 c7                	cmp    %eax,%edi
+  801d1f:	0f 83 c0 00 00 00    	jae    801de5 <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801d25:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801d28:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  801d2b:	89 f0                	mov    %esi,%eax
+  801d2d:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801d32:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  801d37:	29 c3                	sub    %eax,%ebx
+  801d39:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801d3c:	29 f8                	sub    %edi,%eax
+  801d3e:	39 c3                	cmp    %eax,%ebx
+  801d40:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  801d43:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801d49:	75 ba                	jne    801d05 <devfile_read+0x134>
+  801d4b:	89 f9                	mov    %edi,%ecx
+  801d4d:	03 4d 0c             	add    0xc(%ebp),%ecx
+  801d50:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  801d53:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  801d59:	75 aa                	jne    801d05 <devfile_read+0x134>
+  801d5b:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  801d61:	77 a2                	ja     801d05 <devfile_read+0x134>
+  801d63:	89 c8                	mov    %ecx,%eax
+  801d65:	c1 e8 16             	shr    $0x16,%eax
+  801d68:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801d6f:	a8 01                	test   $0x1,%al
+  801d71:	74 92                	je     801d05 <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  801d73:	89 c8                	mov    %ecx,%eax
+  801d75:	c1 e8 0c             	shr    $0xc,%eax
+  801d78:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  801d7f:	a8 01                	test   $0x1,%al
+  801d81:	74 82                	je     801d05 <devfile_read+0x134>
+  801d83:	a9 02 08 00 00       	test   $0x802,%eax
+  801d88:	0f 84 77 ff ff ff    	je     801d05 <devfile_read+0x134>
+  801d8e:	f6 c4 04             	test   $0x4,%ah
+  801d91:	0f 85 6e ff ff ff    	jne    801d05 <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  801d97:	a1 44 67 80 00       	mov    0x806744,%eax
+  801d9c:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  801da0:	84 c0                	test   %al,%al
+  801da2:	75 17                	jne    801dbb <devfile_read+0x1ea>
+  801da4:	83 ec 08             	sub    $0x8,%esp
+  801da7:	6a 01                	push   $0x1
+  801da9:	6a 00                	push   $0x0
+  801dab:	e8 1e f1 ff ff       	call   800ece <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  801db0:	83 c4 10             	add    $0x10,%esp
+  801db3:	85 c0                	test   %eax,%eax
+  801db5:	0f 85 4a ff ff ff    	jne    801d05 <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  801dbb:	83 ec 04             	sub    $0x4,%esp
+  801dbe:	68 05 08 00 00       	push   $0x805
+  801dc3:	ff 75 cc             	push   -0x34(%ebp)
+  801dc6:	6a 00                	push   $0x0
+  801dc8:	56                   	push   %esi
+  801dc9:	6a 00                	push   $0x0
+  801dcb:	6a 05                	push   $0x5
+  801dcd:	68 40 60 80 00       	push   $0x806040
+  801dd2:	e8 8d f5 ff ff       	call   801364 <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  801dd7:	c1 e8 1f             	shr    $0x1f,%eax
+  801dda:	08 45 cb             	or     %al,-0x35(%ebp)
+  801ddd:	83 c4 20             	add    $0x20,%esp
+  801de0:	e9 33 ff ff ff       	jmp    801d18 <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  801de5:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  801de8:	83 ec 0c             	sub    $0xc,%esp
+  801deb:	68 40 60 80 00       	push   $0x806040
+  801df0:	e8 1f f5 ff ff       	call   801314 <sysbatch_flush>
+  801df5:	83 c4 10             	add    $0x10,%esp
+  801df8:	85 c0                	test   %eax,%eax
+  801dfa:	78 06                	js     801e02 <devfile_read+0x231>
+  801dfc:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  801e00:	74 14                	je     801e16 <devfile_read+0x245>
+    memmove(dst, src, r);
+  801e02:	83 ec 04             	sub    $0x4,%esp
+  801e05:	ff 75 d4             	push   -0x2c(%ebp)
+  801e08:	ff 75 d0             	push   -0x30(%ebp)
+  801e0b:	ff 75 0c             	push   0xc(%ebp)
+  801e0e:	e8 55 ee ff ff       	call   800c68 <memmove>
+  801e13:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  801e16:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e19:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  801e1c:	e9 11 fe ff ff       	jmp    801c32 <devfile_read+0x61>
+  assert(r <= n);
+  801e21:	68 d1 36 80 00       	push   $0x8036d1
+  801e26:	68 d8 36 80 00       	push   $0x8036d8
+  801e2b:	68 1c 01 00 00       	push   $0x11c
+  801e30:	68 c6 36 80 00       	push   $0x8036c6
+  801e35:	e8 df e5 ff ff       	call   800419 <_panic>
+  assert(r <= PGSIZE);
+  801e3a:	68 ed 36 80 00       	push   $0x8036ed
+  801e3f:	68 d8 36 80 00       	push   $0x8036d8
+  801e44:	68 1d 01 00 00       	push   $0x11d
+  801e49:	68 c6 36 80 00       	push   $0x8036c6
+  801e4e:	e8 c6 e5 ff ff       	call   800419 <_panic>
+
+00801e53 <devfile_write>:
+{
+  801e53:	55                   	push   %ebp
+  801e54:	89 e5                	mov    %esp,%ebp
+  801e56:	57                   	push   %edi
+  801e57:	56                   	push   %esi
+  801e58:	53                   	push   %ebx
+  801e59:	83 ec 1c             	sub    $0x1c,%esp
+  801e5c:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e5f:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  801e62:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  801e67:	77 39                	ja     801ea2 <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801e69:	8b 56 0c             	mov    0xc(%esi),%edx
+  801e6c:	89 15 00 70 80 00    	mov    %edx,0x807000
+  fsipcbuf.write.req_n = n;
+  801e72:	a3 04 70 80 00       	mov    %eax,0x807004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  801e77:	83 ec 04             	sub    $0x4,%esp
+  801e7a:	50                   	push   %eax
+  801e7b:	ff 75 0c             	push   0xc(%ebp)
+  801e7e:	68 08 70 80 00       	push   $0x807008
+  801e83:	e8 e0 ed ff ff       	call   800c68 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801e88:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e8d:	b8 04 00 00 00       	mov    $0x4,%eax
+  801e92:	e8 e7 fb ff ff       	call   801a7e <fsipc>
+  801e97:	83 c4 10             	add    $0x10,%esp
+}
+  801e9a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e9d:	5b                   	pop    %ebx
+  801e9e:	5e                   	pop    %esi
+  801e9f:	5f                   	pop    %edi
+  801ea0:	5d                   	pop    %ebp
+  801ea1:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  801ea2:	ba 00 00 10 00       	mov    $0x100000,%edx
+  801ea7:	39 d0                	cmp    %edx,%eax
+  801ea9:	89 d3                	mov    %edx,%ebx
+  801eab:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  801eae:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  801eb4:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  801eb7:	83 c7 01             	add    $0x1,%edi
+  801eba:	89 f8                	mov    %edi,%eax
+  801ebc:	e8 94 fc ff ff       	call   801b55 <fsv_alloc>
+  801ec1:	85 c0                	test   %eax,%eax
+  801ec3:	78 d5                	js     801e9a <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  801ec5:	83 ec 04             	sub    $0x4,%esp
+  801ec8:	53                   	push   %ebx
+  801ec9:	ff 75 0c             	push   0xc(%ebp)
+  801ecc:	68 00 10 c0 9f       	push   $0x9fc01000
+  801ed1:	e8 92 ed ff ff       	call   800c68 <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  801ed6:	8b 46 0c             	mov    0xc(%esi),%eax
+  801ed9:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  801ede:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  801ee4:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801eeb:	89 f9                	mov    %edi,%ecx
+  801eed:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801ef2:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801ef7:	e8 69 fa ff ff       	call   801965 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801efc:	6a 00                	push   $0x0
+  801efe:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801f01:	50                   	push   %eax
+  801f02:	6a 00                	push   $0x0
+  801f04:	6a 00                	push   $0x0
+  801f06:	e8 c6 0e 00 00       	call   802dd1 <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  801f0b:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  801f0e:	eb 8a                	jmp    801e9a <devfile_write+0x47>
+
+00801f10 <open>:
+{
+  801f10:	55                   	push   %ebp
+  801f11:	89 e5                	mov    %esp,%ebp
+  801f13:	56                   	push   %esi
+  801f14:	53                   	push   %ebx
+  801f15:	83 ec 1c             	sub    $0x1c,%esp
+  801f18:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801f1b:	56                   	push   %esi
+  801f1c:	e8 86 eb ff ff       	call   800aa7 <strlen>
+  801f21:	83 c4 10             	add    $0x10,%esp
+  801f24:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801f29:	7f 6c                	jg     801f97 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  801f2b:	83 ec 0c             	sub    $0xc,%esp
+  801f2e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f31:	50                   	push   %eax
+  801f32:	e8 ad f4 ff ff       	call   8013e4 <fd_alloc>
+  801f37:	89 c3                	mov    %eax,%ebx
+  801f39:	83 c4 10             	add    $0x10,%esp
+  801f3c:	85 c0                	test   %eax,%eax
+  801f3e:	78 3c                	js     801f7c <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801f40:	83 ec 08             	sub    $0x8,%esp
+  801f43:	56                   	push   %esi
+  801f44:	68 00 70 80 00       	push   $0x807000
+  801f49:	e8 94 eb ff ff       	call   800ae2 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801f4e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f51:	a3 00 74 80 00       	mov    %eax,0x807400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801f56:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801f59:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f5e:	e8 1b fb ff ff       	call   801a7e <fsipc>
+  801f63:	89 c3                	mov    %eax,%ebx
+  801f65:	83 c4 10             	add    $0x10,%esp
+  801f68:	85 c0                	test   %eax,%eax
+  801f6a:	78 19                	js     801f85 <open+0x75>
+  return fd2num(fd);
+  801f6c:	83 ec 0c             	sub    $0xc,%esp
+  801f6f:	ff 75 f4             	push   -0xc(%ebp)
+  801f72:	e8 49 f4 ff ff       	call   8013c0 <fd2num>
+  801f77:	89 c3                	mov    %eax,%ebx
+  801f79:	83 c4 10             	add    $0x10,%esp
+}
+  801f7c:	89 d8                	mov    %ebx,%eax
+  801f7e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f81:	5b                   	pop    %ebx
+  801f82:	5e                   	pop    %esi
+  801f83:	5d                   	pop    %ebp
+  801f84:	c3                   	ret
+    fd_close(fd, 0);
+  801f85:	83 ec 08             	sub    $0x8,%esp
+  801f88:	6a 00                	push   $0x0
+  801f8a:	ff 75 f4             	push   -0xc(%ebp)
+  801f8d:	e8 44 f5 ff ff       	call   8014d6 <fd_close>
+    return r;
+  801f92:	83 c4 10             	add    $0x10,%esp
+  801f95:	eb e5                	jmp    801f7c <open+0x6c>
+    return -E_BAD_PATH;
+  801f97:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801f9c:	eb de                	jmp    801f7c <open+0x6c>
+
+00801f9e <open_read>:
+{
+  801f9e:	55                   	push   %ebp
+  801f9f:	89 e5                	mov    %esp,%ebp
+  801fa1:	57                   	push   %edi
+  801fa2:	56                   	push   %esi
+  801fa3:	53                   	push   %ebx
+  801fa4:	83 ec 28             	sub    $0x28,%esp
+  801fa7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  801faa:	57                   	push   %edi
+  801fab:	e8 f7 ea ff ff       	call   800aa7 <strlen>
+  801fb0:	83 c4 10             	add    $0x10,%esp
+  801fb3:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801fb8:	0f 87 f6 00 00 00    	ja     8020b4 <open_read+0x116>
+  801fbe:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  801fc0:	83 ec 0c             	sub    $0xc,%esp
+  801fc3:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801fc6:	50                   	push   %eax
+  801fc7:	e8 18 f4 ff ff       	call   8013e4 <fd_alloc>
+  801fcc:	89 c3                	mov    %eax,%ebx
+  801fce:	83 c4 10             	add    $0x10,%esp
+  801fd1:	85 c0                	test   %eax,%eax
+  801fd3:	0f 88 b2 00 00 00    	js     80208b <open_read+0xed>
+  strcpy(req->req_buf, path);
+  801fd9:	83 ec 08             	sub    $0x8,%esp
+  801fdc:	57                   	push   %edi
+  801fdd:	68 e4 70 80 00       	push   $0x8070e4
+  801fe2:	e8 fb ea ff ff       	call   800ae2 <strcpy>
+  req->req_nops = 2;
+  801fe7:	c7 05 00 70 80 00 02 	movl   $0x2,0x807000
+  801fee:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  801ff1:	c7 05 04 70 80 00 01 	movl   $0x1,0x807004
+  801ff8:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  801ffb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ffe:	a3 10 70 80 00       	mov    %eax,0x807010
+  req->req_ops[0].op_buf = 0;
+  802003:	c7 05 18 70 80 00 00 	movl   $0x0,0x807018
+  80200a:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  80200d:	c7 05 20 70 80 00 04 	movl   $0x4,0x807020
+  802014:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  802017:	c7 05 24 70 80 00 01 	movl   $0x1,0x807024
+  80201e:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  802021:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  802026:	29 f0                	sub    %esi,%eax
+  802028:	3b 45 14             	cmp    0x14(%ebp),%eax
+  80202b:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  80202f:	a3 2c 70 80 00       	mov    %eax,0x80702c
+  req->req_ops[1].op_offset = 0;
+  802034:	c7 05 30 70 80 00 00 	movl   $0x0,0x807030
+  80203b:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  80203e:	83 c6 01             	add    $0x1,%esi
+  802041:	89 35 34 70 80 00    	mov    %esi,0x807034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  802047:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80204a:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80204f:	e8 2a fa ff ff       	call   801a7e <fsipc>
+  802054:	89 c3                	mov    %eax,%ebx
+  802056:	83 c4 10             	add    $0x10,%esp
+  802059:	83 f8 01             	cmp    $0x1,%eax
+  80205c:	7e 37                	jle    802095 <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  80205e:	a1 38 70 80 00       	mov    0x807038,%eax
+  802063:	8b 55 18             	mov    0x18(%ebp),%edx
+  802066:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  802068:	83 ec 04             	sub    $0x4,%esp
+  80206b:	50                   	push   %eax
+  80206c:	81 c6 e4 70 80 00    	add    $0x8070e4,%esi
+  802072:	56                   	push   %esi
+  802073:	ff 75 10             	push   0x10(%ebp)
+  802076:	e8 ed eb ff ff       	call   800c68 <memmove>
+  return fd2num(fd);
+  80207b:	83 c4 04             	add    $0x4,%esp
+  80207e:	ff 75 e4             	push   -0x1c(%ebp)
+  802081:	e8 3a f3 ff ff       	call   8013c0 <fd2num>
+  802086:	89 c3                	mov    %eax,%ebx
+  802088:	83 c4 10             	add    $0x10,%esp
+}
+  80208b:	89 d8                	mov    %ebx,%eax
+  80208d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802090:	5b                   	pop    %ebx
+  802091:	5e                   	pop    %esi
+  802092:	5f                   	pop    %edi
+  802093:	5d                   	pop    %ebp
+  802094:	c3                   	ret
+    fd_close(fd, 0);
+  802095:	83 ec 08             	sub    $0x8,%esp
+  802098:	6a 00                	push   $0x0
+  80209a:	ff 75 e4             	push   -0x1c(%ebp)
+  80209d:	e8 34 f4 ff ff       	call   8014d6 <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  8020a2:	83 c4 10             	add    $0x10,%esp
+  8020a5:	85 db                	test   %ebx,%ebx
+  8020a7:	78 e2                	js     80208b <open_read+0xed>
+  8020a9:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  8020ac:	8b 9b 1c 70 80 00    	mov    0x80701c(%ebx),%ebx
+  8020b2:	eb d7                	jmp    80208b <open_read+0xed>
+    return -E_BAD_PATH;
+  8020b4:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8020b9:	eb d0                	jmp    80208b <open_read+0xed>
+
+008020bb <file_stat>:
+{
+  8020bb:	55                   	push   %ebp
+  8020bc:	89 e5                	mov    %esp,%ebp
+  8020be:	57                   	push   %edi
+  8020bf:	56                   	push   %esi
+  8020c0:	53                   	push   %ebx
+  8020c1:	83 ec 18             	sub    $0x18,%esp
+  8020c4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8020c7:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  8020ca:	57                   	push   %edi
+  8020cb:	e8 d7 e9 ff ff       	call   800aa7 <strlen>
+  8020d0:	83 c4 10             	add    $0x10,%esp
+  8020d3:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8020d8:	0f 8f c7 00 00 00    	jg     8021a5 <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  8020de:	83 ec 0c             	sub    $0xc,%esp
+  8020e1:	57                   	push   %edi
+  8020e2:	e8 c0 e9 ff ff       	call   800aa7 <strlen>
+  8020e7:	8d 58 04             	lea    0x4(%eax),%ebx
+  8020ea:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  8020ed:	83 c4 08             	add    $0x8,%esp
+  8020f0:	57                   	push   %edi
+  8020f1:	68 e4 70 80 00       	push   $0x8070e4
+  8020f6:	e8 e7 e9 ff ff       	call   800ae2 <strcpy>
+  req->req_nops = 2;
+  8020fb:	c7 05 00 70 80 00 02 	movl   $0x2,0x807000
+  802102:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  802105:	c7 05 04 70 80 00 02 	movl   $0x2,0x807004
+  80210c:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  80210f:	c7 05 10 70 80 00 00 	movl   $0x0,0x807010
+  802116:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  802119:	c7 05 18 70 80 00 00 	movl   $0x0,0x807018
+  802120:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  802123:	c7 05 20 70 80 00 03 	movl   $0x3,0x807020
+  80212a:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  80212d:	c7 05 24 70 80 00 01 	movl   $0x1,0x807024
+  802134:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  802137:	89 1d 34 70 80 00    	mov    %ebx,0x807034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  80213d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802142:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802147:	e8 32 f9 ff ff       	call   801a7e <fsipc>
+  80214c:	83 c4 10             	add    $0x10,%esp
+  80214f:	83 f8 01             	cmp    $0x1,%eax
+  802152:	7e 42                	jle    802196 <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  802154:	81 c3 e4 70 80 00    	add    $0x8070e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  80215a:	83 ec 08             	sub    $0x8,%esp
+  80215d:	53                   	push   %ebx
+  80215e:	56                   	push   %esi
+  80215f:	e8 7e e9 ff ff       	call   800ae2 <strcpy>
+  st->st_size = ret->ret_size;
+  802164:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  80216a:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  802170:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  802176:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  80217c:	c7 86 88 00 00 00 04 	movl   $0x804004,0x88(%esi)
+  802183:	40 80 00 
+  return 0;
+  802186:	83 c4 10             	add    $0x10,%esp
+  802189:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80218e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802191:	5b                   	pop    %ebx
+  802192:	5e                   	pop    %esi
+  802193:	5f                   	pop    %edi
+  802194:	5d                   	pop    %ebp
+  802195:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  802196:	85 c0                	test   %eax,%eax
+  802198:	78 f4                	js     80218e <file_stat+0xd3>
+  80219a:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80219d:	8b 80 1c 70 80 00    	mov    0x80701c(%eax),%eax
+  8021a3:	eb e9                	jmp    80218e <file_stat+0xd3>
+    return -E_BAD_PATH;
+  8021a5:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8021aa:	eb e2                	jmp    80218e <file_stat+0xd3>
+
+008021ac <read_map>:
+{
+  8021ac:	55                   	push   %ebp
+  8021ad:	89 e5                	mov    %esp,%ebp
+  8021af:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8021b2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021b5:	50                   	push   %eax
+  8021b6:	ff 75 08             	push   0x8(%ebp)
+  8021b9:	e8 7c f2 ff ff       	call   80143a <fd_lookup>
+  8021be:	83 c4 10             	add    $0x10,%esp
+  8021c1:	85 c0                	test   %eax,%eax
+  8021c3:	78 2a                	js     8021ef <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  8021c5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021c8:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  8021ce:	39 08                	cmp    %ecx,(%eax)
+  8021d0:	75 1f                	jne    8021f1 <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  8021d2:	8b 40 0c             	mov    0xc(%eax),%eax
+  8021d5:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.read_map.req_offset = offset;
+  8021da:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021dd:	a3 04 70 80 00       	mov    %eax,0x807004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  8021e2:	8b 55 10             	mov    0x10(%ebp),%edx
+  8021e5:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8021ea:	e8 8f f8 ff ff       	call   801a7e <fsipc>
+}
+  8021ef:	c9                   	leave
+  8021f0:	c3                   	ret
+    return -E_INVAL;
+  8021f1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021f6:	eb f7                	jmp    8021ef <read_map+0x43>
+
+008021f8 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8021f8:	55                   	push   %ebp
+  8021f9:	89 e5                	mov    %esp,%ebp
+  8021fb:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  8021fe:	ba 00 00 00 00       	mov    $0x0,%edx
+  802203:	b8 08 00 00 00       	mov    $0x8,%eax
+  802208:	e8 71 f8 ff ff       	call   801a7e <fsipc>
+}
+  80220d:	c9                   	leave
+  80220e:	c3                   	ret
+
+0080220f <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  80220f:	55                   	push   %ebp
+  802210:	89 e5                	mov    %esp,%ebp
+  802212:	57                   	push   %edi
+  802213:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  802214:	8b 45 08             	mov    0x8(%ebp),%eax
+  802217:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.stats.req_bio_sched = 0;
+  80221c:	c7 05 04 70 80 00 00 	movl   $0x0,0x807004
+  802223:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  802226:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  80222d:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  802230:	ba 00 00 00 00       	mov    $0x0,%edx
+  802235:	b8 09 00 00 00       	mov    $0x9,%eax
+  80223a:	e8 3f f8 ff ff       	call   801a7e <fsipc>
+  80223f:	85 c0                	test   %eax,%eax
+  802241:	78 14                	js     802257 <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  802243:	be 00 70 80 00       	mov    $0x807000,%esi
+  802248:	b9 16 00 00 00       	mov    $0x16,%ecx
+  80224d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802250:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  802252:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802257:	5e                   	pop    %esi
+  802258:	5f                   	pop    %edi
+  802259:	5d                   	pop    %ebp
+  80225a:	c3                   	ret
+
+0080225b <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  80225b:	55                   	push   %ebp
+  80225c:	89 e5                	mov    %esp,%ebp
+  80225e:	53                   	push   %ebx
+  80225f:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  802262:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802265:	50                   	push   %eax
+  802266:	6a 00                	push   $0x0
+  802268:	e8 a2 ff ff ff       	call   80220f <fs_stats>
+  80226d:	83 c4 10             	add    $0x10,%esp
+  802270:	85 c0                	test   %eax,%eax
+  802272:	78 28                	js     80229c <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  802274:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  802277:	83 ec 08             	sub    $0x8,%esp
+  80227a:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  80227d:	50                   	push   %eax
+  80227e:	6a 20                	push   $0x20
+  802280:	e8 8a ff ff ff       	call   80220f <fs_stats>
+  802285:	83 c4 10             	add    $0x10,%esp
+  802288:	85 c0                	test   %eax,%eax
+  80228a:	78 10                	js     80229c <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  80228c:	83 ec 08             	sub    $0x8,%esp
+  80228f:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802292:	50                   	push   %eax
+  802293:	53                   	push   %ebx
+  802294:	e8 76 ff ff ff       	call   80220f <fs_stats>
+  802299:	83 c4 10             	add    $0x10,%esp
+}
+  80229c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80229f:	c9                   	leave
+  8022a0:	c3                   	ret
+
+008022a1 <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  8022a1:	55                   	push   %ebp
+  8022a2:	89 e5                	mov    %esp,%ebp
+  8022a4:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  8022a7:	c7 05 00 70 80 00 00 	movl   $0x0,0x807000
+  8022ae:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  8022b1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022b4:	a3 04 70 80 00       	mov    %eax,0x807004
+  fsipcbuf.stats.req_dcache = 0;
+  8022b9:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  8022c0:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  8022c3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022c8:	b8 09 00 00 00       	mov    $0x9,%eax
+  8022cd:	e8 ac f7 ff ff       	call   801a7e <fsipc>
+}
+  8022d2:	c9                   	leave
+  8022d3:	c3                   	ret
+
+008022d4 <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  8022d4:	55                   	push   %ebp
+  8022d5:	89 e5                	mov    %esp,%ebp
+  8022d7:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  8022da:	c7 05 00 70 80 00 00 	movl   $0x0,0x807000
+  8022e1:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  8022e4:	c7 05 04 70 80 00 00 	movl   $0x0,0x807004
+  8022eb:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  8022ee:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022f1:	a3 08 70 80 00       	mov    %eax,0x807008
+  return fsipc(FSREQ_STATS, NULL);
+  8022f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022fb:	b8 09 00 00 00       	mov    $0x9,%eax
+  802300:	e8 79 f7 ff ff       	call   801a7e <fsipc>
+}
+  802305:	c9                   	leave
+  802306:	c3                   	ret
+
+00802307 <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  802307:	55                   	push   %ebp
+  802308:	89 e5                	mov    %esp,%ebp
+  80230a:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80230d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802310:	50                   	push   %eax
+  802311:	ff 75 08             	push   0x8(%ebp)
+  802314:	e8 21 f1 ff ff       	call   80143a <fd_lookup>
+  802319:	83 c4 10             	add    $0x10,%esp
+  80231c:	85 c0                	test   %eax,%eax
+  80231e:	78 34                	js     802354 <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  802320:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802323:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  802329:	39 08                	cmp    %ecx,(%eax)
+  80232b:	75 29                	jne    802356 <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  80232d:	8b 40 0c             	mov    0xc(%eax),%eax
+  802330:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.fallocate.req_offset = offset;
+  802335:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802338:	a3 04 70 80 00       	mov    %eax,0x807004
+  fsipcbuf.fallocate.req_len = len;
+  80233d:	8b 45 10             	mov    0x10(%ebp),%eax
+  802340:	a3 08 70 80 00       	mov    %eax,0x807008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  802345:	ba 00 00 00 00       	mov    $0x0,%edx
+  80234a:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80234f:	e8 2a f7 ff ff       	call   801a7e <fsipc>
+}
+  802354:	c9                   	leave
+  802355:	c3                   	ret
+    return -E_INVAL;
+  802356:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80235b:	eb f7                	jmp    802354 <fallocate+0x4d>
+
+0080235d <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  80235d:	55                   	push   %ebp
+  80235e:	89 e5                	mov    %esp,%ebp
+  802360:	57                   	push   %edi
+  802361:	56                   	push   %esi
+  802362:	53                   	push   %ebx
+  802363:	83 ec 24             	sub    $0x24,%esp
+  802366:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802369:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80236c:	50                   	push   %eax
+  80236d:	ff 75 08             	push   0x8(%ebp)
+  802370:	e8 c5 f0 ff ff       	call   80143a <fd_lookup>
+  802375:	83 c4 10             	add    $0x10,%esp
+  802378:	85 c0                	test   %eax,%eax
+  80237a:	78 66                	js     8023e2 <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  80237c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80237f:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  802385:	39 08                	cmp    %ecx,(%eax)
+  802387:	75 61                	jne    8023ea <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  802389:	85 f6                	test   %esi,%esi
+  80238b:	7e 50                	jle    8023dd <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  80238d:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  802392:	39 de                	cmp    %ebx,%esi
+  802394:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  802397:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80239a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80239d:	a3 00 70 80 00       	mov    %eax,0x807000
+    fsipcbuf.prefetch.req_n = m;
+  8023a2:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  8023a8:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  8023af:	83 ec 04             	sub    $0x4,%esp
+  8023b2:	57                   	push   %edi
+  8023b3:	ff 75 0c             	push   0xc(%ebp)
+  8023b6:	68 08 70 80 00       	push   $0x807008
+  8023bb:	e8 a8 e8 ff ff       	call   800c68 <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  8023c0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023c5:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8023ca:	e8 af f6 ff ff       	call   801a7e <fsipc>
+  8023cf:	83 c4 10             	add    $0x10,%esp
+  8023d2:	85 c0                	test   %eax,%eax
+  8023d4:	78 0c                	js     8023e2 <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  8023d6:	01 7d 0c             	add    %edi,0xc(%ebp)
+  8023d9:	29 de                	sub    %ebx,%esi
+  8023db:	eb ac                	jmp    802389 <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  8023dd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023e2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023e5:	5b                   	pop    %ebx
+  8023e6:	5e                   	pop    %esi
+  8023e7:	5f                   	pop    %edi
+  8023e8:	5d                   	pop    %ebp
+  8023e9:	c3                   	ret
+    return -E_INVAL;
+  8023ea:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8023ef:	eb f1                	jmp    8023e2 <prefetch+0x85>
+
+008023f1 <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  8023f1:	55                   	push   %ebp
+  8023f2:	89 e5                	mov    %esp,%ebp
+  8023f4:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  8023f7:	50                   	push   %eax
+  8023f8:	e8 d3 ef ff ff       	call   8013d0 <fd2data>
+  8023fd:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  802402:	c9                   	leave
+  802403:	c3                   	ret
+
+00802404 <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802404:	55                   	push   %ebp
+  802405:	89 e5                	mov    %esp,%ebp
+  802407:	56                   	push   %esi
+  802408:	53                   	push   %ebx
+  802409:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  80240c:	83 ec 0c             	sub    $0xc,%esp
+  80240f:	ff 75 08             	push   0x8(%ebp)
+  802412:	e8 b9 ef ff ff       	call   8013d0 <fd2data>
+  802417:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  802419:	83 c4 08             	add    $0x8,%esp
+  80241c:	68 28 37 80 00       	push   $0x803728
+  802421:	53                   	push   %ebx
+  802422:	e8 bb e6 ff ff       	call   800ae2 <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  802427:	8b 46 04             	mov    0x4(%esi),%eax
+  80242a:	2b 06                	sub    (%esi),%eax
+  80242c:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  802432:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802439:	00 00 00 
+  stat->st_dev = &devpipe;
+  80243c:	c7 83 88 00 00 00 20 	movl   $0x804020,0x88(%ebx)
+  802443:	40 80 00 
+  return 0;
+}
+  802446:	b8 00 00 00 00       	mov    $0x0,%eax
+  80244b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80244e:	5b                   	pop    %ebx
+  80244f:	5e                   	pop    %esi
+  802450:	5d                   	pop    %ebp
+  802451:	c3                   	ret
+
+00802452 <pipe_wakeup>:
+{
+  802452:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  802454:	b8 00 00 00 00       	mov    $0x0,%eax
+  802459:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  80245c:	85 c0                	test   %eax,%eax
+  80245e:	75 01                	jne    802461 <pipe_wakeup+0xf>
+  802460:	c3                   	ret
+{
+  802461:	55                   	push   %ebp
+  802462:	89 e5                	mov    %esp,%ebp
+  802464:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  802467:	6a 00                	push   $0x0
+  802469:	68 00 00 c0 ee       	push   $0xeec00000
+  80246e:	52                   	push   %edx
+  80246f:	e8 f9 ed ff ff       	call   80126d <sys_chan_wakeup>
+  802474:	83 c4 10             	add    $0x10,%esp
+}
+  802477:	c9                   	leave
+  802478:	c3                   	ret
+
+00802479 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802479:	55                   	push   %ebp
+  80247a:	89 e5                	mov    %esp,%ebp
+  80247c:	57                   	push   %edi
+  80247d:	56                   	push   %esi
+  80247e:	53                   	push   %ebx
+  80247f:	83 ec 18             	sub    $0x18,%esp
+  802482:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  802485:	57                   	push   %edi
+  802486:	e8 45 ef ff ff       	call   8013d0 <fd2data>
+  80248b:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  80248d:	83 c4 10             	add    $0x10,%esp
+  802490:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  802494:	74 2a                	je     8024c0 <devpipe_close+0x47>
+  802496:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  80249b:	89 f8                	mov    %edi,%eax
+  80249d:	e8 4f ff ff ff       	call   8023f1 <pipe_ring>
+  8024a2:	83 ec 08             	sub    $0x8,%esp
+  8024a5:	01 d8                	add    %ebx,%eax
+  8024a7:	50                   	push   %eax
+  8024a8:	6a 00                	push   $0x0
+  8024aa:	e8 e7 ea ff ff       	call   800f96 <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  8024af:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8024b5:	83 c4 10             	add    $0x10,%esp
+  8024b8:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  8024be:	75 db                	jne    80249b <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  8024c0:	83 ec 08             	sub    $0x8,%esp
+  8024c3:	57                   	push   %edi
+  8024c4:	6a 00                	push   $0x0
+  8024c6:	e8 cb ea ff ff       	call   800f96 <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  8024cb:	83 c4 10             	add    $0x10,%esp
+  8024ce:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  8024d2:	75 13                	jne    8024e7 <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  8024d4:	83 ec 08             	sub    $0x8,%esp
+  8024d7:	56                   	push   %esi
+  8024d8:	6a 00                	push   $0x0
+  8024da:	e8 b7 ea ff ff       	call   800f96 <sys_page_unmap>
+}
+  8024df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024e2:	5b                   	pop    %ebx
+  8024e3:	5e                   	pop    %esi
+  8024e4:	5f                   	pop    %edi
+  8024e5:	5d                   	pop    %ebp
+  8024e6:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  8024e7:	8d 56 04             	lea    0x4(%esi),%edx
+  8024ea:	8d 46 2c             	lea    0x2c(%esi),%eax
+  8024ed:	e8 60 ff ff ff       	call   802452 <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8024f2:	8d 46 30             	lea    0x30(%esi),%eax
+  8024f5:	89 f2                	mov    %esi,%edx
+  8024f7:	e8 56 ff ff ff       	call   802452 <pipe_wakeup>
+  8024fc:	eb d6                	jmp    8024d4 <devpipe_close+0x5b>
+
+008024fe <_pipeisclosed>:
+{
+  8024fe:	55                   	push   %ebp
+  8024ff:	89 e5                	mov    %esp,%ebp
+  802501:	57                   	push   %edi
+  802502:	56                   	push   %esi
+  802503:	53                   	push   %ebx
+  802504:	83 ec 1c             	sub    $0x1c,%esp
+  802507:	89 c7                	mov    %eax,%edi
+  802509:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  80250b:	a1 44 67 80 00       	mov    0x806744,%eax
+  802510:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  802513:	83 ec 0c             	sub    $0xc,%esp
+  802516:	57                   	push   %edi
+  802517:	e8 18 0a 00 00       	call   802f34 <pageref>
+  80251c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80251f:	89 34 24             	mov    %esi,(%esp)
+  802522:	e8 0d 0a 00 00       	call   802f34 <pageref>
+    nn = thisenv->env_runs;
+  802527:	8b 15 44 67 80 00    	mov    0x806744,%edx
+  80252d:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  802530:	83 c4 10             	add    $0x10,%esp
+  802533:	39 cb                	cmp    %ecx,%ebx
+  802535:	74 1b                	je     802552 <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  802537:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80253a:	75 cf                	jne    80250b <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80253c:	8b 42 58             	mov    0x58(%edx),%eax
+  80253f:	6a 01                	push   $0x1
+  802541:	50                   	push   %eax
+  802542:	53                   	push   %ebx
+  802543:	68 2f 37 80 00       	push   $0x80372f
+  802548:	e8 a7 df ff ff       	call   8004f4 <cprintf>
+  80254d:	83 c4 10             	add    $0x10,%esp
+  802550:	eb b9                	jmp    80250b <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  802552:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802555:	0f 94 c0             	sete   %al
+  802558:	0f b6 c0             	movzbl %al,%eax
+}
+  80255b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80255e:	5b                   	pop    %ebx
+  80255f:	5e                   	pop    %esi
+  802560:	5f                   	pop    %edi
+  802561:	5d                   	pop    %ebp
+  802562:	c3                   	ret
+
+00802563 <devpipe_write_bulk>:
+{
+  802563:	55                   	push   %ebp
+  802564:	89 e5                	mov    %esp,%ebp
+  802566:	57                   	push   %edi
+  802567:	56                   	push   %esi
+  802568:	53                   	push   %ebx
+  802569:	83 ec 1c             	sub    $0x1c,%esp
+  80256c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80256f:	89 d6                	mov    %edx,%esi
+  802571:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  802574:	e8 78 fe ff ff       	call   8023f1 <pipe_ring>
+  802579:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  80257c:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802581:	8d 46 04             	lea    0x4(%esi),%eax
+  802584:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  802587:	eb 75                	jmp    8025fe <devpipe_write_bulk+0x9b>
+  802589:	b8 01 00 00 00       	mov    $0x1,%eax
+  80258e:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802592:	6a 64                	push   $0x64
+  802594:	68 00 00 c0 ee       	push   $0xeec00000
+  802599:	53                   	push   %ebx
+  80259a:	56                   	push   %esi
+  80259b:	e8 aa ec ff ff       	call   80124a <sys_chan_sleep>
+      continue;
+  8025a0:	83 c4 10             	add    $0x10,%esp
+  8025a3:	eb 59                	jmp    8025fe <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  8025a5:	89 d1                	mov    %edx,%ecx
+  8025a7:	c1 f9 1f             	sar    $0x1f,%ecx
+  8025aa:	c1 e9 11             	shr    $0x11,%ecx
+  8025ad:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  8025b0:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8025b5:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  8025b7:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  8025bd:	29 d3                	sub    %edx,%ebx
+  8025bf:	ba 00 80 00 00       	mov    $0x8000,%edx
+  8025c4:	29 c2                	sub    %eax,%edx
+  8025c6:	39 d3                	cmp    %edx,%ebx
+  8025c8:	0f 47 da             	cmova  %edx,%ebx
+  8025cb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8025ce:	29 fa                	sub    %edi,%edx
+  8025d0:	39 d3                	cmp    %edx,%ebx
+  8025d2:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  8025d5:	83 ec 04             	sub    $0x4,%esp
+  8025d8:	53                   	push   %ebx
+  8025d9:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8025dc:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  8025df:	52                   	push   %edx
+  8025e0:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8025e3:	01 c8                	add    %ecx,%eax
+  8025e5:	50                   	push   %eax
+  8025e6:	e8 df e6 ff ff       	call   800cca <memcpy>
+    i += m;
+  8025eb:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  8025ed:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  8025f0:	8d 46 2c             	lea    0x2c(%esi),%eax
+  8025f3:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8025f6:	e8 57 fe ff ff       	call   802452 <pipe_wakeup>
+  8025fb:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  8025fe:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802601:	73 2b                	jae    80262e <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  802603:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  802605:	8b 56 04             	mov    0x4(%esi),%edx
+  802608:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  80260e:	39 d0                	cmp    %edx,%eax
+  802610:	7d 93                	jge    8025a5 <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  802612:	89 f2                	mov    %esi,%edx
+  802614:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802617:	e8 e2 fe ff ff       	call   8024fe <_pipeisclosed>
+  80261c:	85 c0                	test   %eax,%eax
+  80261e:	0f 84 65 ff ff ff    	je     802589 <devpipe_write_bulk+0x26>
+        return i;
+  802624:	89 f8                	mov    %edi,%eax
+}
+  802626:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802629:	5b                   	pop    %ebx
+  80262a:	5e                   	pop    %esi
+  80262b:	5f                   	pop    %edi
+  80262c:	5d                   	pop    %ebp
+  80262d:	c3                   	ret
+  return i;
+  80262e:	89 f8                	mov    %edi,%eax
+  802630:	eb f4                	jmp    802626 <devpipe_write_bulk+0xc3>
+
+00802632 <devpipe_write>:
+{
+  802632:	55                   	push   %ebp
+  802633:	89 e5                	mov    %esp,%ebp
+  802635:	57                   	push   %edi
+  802636:	56                   	push   %esi
+  802637:	53                   	push   %ebx
+  802638:	83 ec 28             	sub    $0x28,%esp
+  80263b:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  80263e:	56                   	push   %esi
+  80263f:	e8 8c ed ff ff       	call   8013d0 <fd2data>
+  802644:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  802646:	8b 78 28             	mov    0x28(%eax),%edi
+  802649:	83 c4 10             	add    $0x10,%esp
+  80264c:	85 ff                	test   %edi,%edi
+  80264e:	75 25                	jne    802675 <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  802650:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802653:	74 66                	je     8026bb <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802655:	8b 43 04             	mov    0x4(%ebx),%eax
+  802658:	8b 0b                	mov    (%ebx),%ecx
+  80265a:	8d 51 20             	lea    0x20(%ecx),%edx
+  80265d:	39 d0                	cmp    %edx,%eax
+  80265f:	72 2b                	jb     80268c <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  802661:	89 da                	mov    %ebx,%edx
+  802663:	89 f0                	mov    %esi,%eax
+  802665:	e8 94 fe ff ff       	call   8024fe <_pipeisclosed>
+  80266a:	85 c0                	test   %eax,%eax
+  80266c:	75 51                	jne    8026bf <devpipe_write+0x8d>
+      sys_yield();
+  80266e:	e8 3c e8 ff ff       	call   800eaf <sys_yield>
+  802673:	eb e0                	jmp    802655 <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  802675:	83 ec 0c             	sub    $0xc,%esp
+  802678:	ff 75 10             	push   0x10(%ebp)
+  80267b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80267e:	89 c2                	mov    %eax,%edx
+  802680:	89 f0                	mov    %esi,%eax
+  802682:	e8 dc fe ff ff       	call   802563 <devpipe_write_bulk>
+  802687:	83 c4 10             	add    $0x10,%esp
+  80268a:	eb 38                	jmp    8026c4 <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80268c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80268f:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802693:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802696:	89 c2                	mov    %eax,%edx
+  802698:	c1 fa 1f             	sar    $0x1f,%edx
+  80269b:	89 d1                	mov    %edx,%ecx
+  80269d:	c1 e9 1b             	shr    $0x1b,%ecx
+  8026a0:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8026a3:	83 e2 1f             	and    $0x1f,%edx
+  8026a6:	29 ca                	sub    %ecx,%edx
+  8026a8:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8026ac:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  8026b0:	83 c0 01             	add    $0x1,%eax
+  8026b3:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  8026b6:	83 c7 01             	add    $0x1,%edi
+  8026b9:	eb 95                	jmp    802650 <devpipe_write+0x1e>
+  return i;
+  8026bb:	89 f8                	mov    %edi,%eax
+  8026bd:	eb 05                	jmp    8026c4 <devpipe_write+0x92>
+        return 0;
+  8026bf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8026c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026c7:	5b                   	pop    %ebx
+  8026c8:	5e                   	pop    %esi
+  8026c9:	5f                   	pop    %edi
+  8026ca:	5d                   	pop    %ebp
+  8026cb:	c3                   	ret
+
+008026cc <devpipe_read_bulk>:
+{
+  8026cc:	55                   	push   %ebp
+  8026cd:	89 e5                	mov    %esp,%ebp
+  8026cf:	57                   	push   %edi
+  8026d0:	56                   	push   %esi
+  8026d1:	53                   	push   %ebx
+  8026d2:	83 ec 2c             	sub    $0x2c,%esp
+  8026d5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8026d8:	89 d6                	mov    %edx,%esi
+  8026da:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8026dd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  8026e0:	e8 0c fd ff ff       	call   8023f1 <pipe_ring>
+  8026e5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  8026e8:	85 db                	test   %ebx,%ebx
+  8026ea:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8026ef:	0f 45 c3             	cmovne %ebx,%eax
+  8026f2:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8026f5:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8026fa:	8d 46 30             	lea    0x30(%esi),%eax
+  8026fd:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  802700:	eb 50                	jmp    802752 <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  802702:	89 d1                	mov    %edx,%ecx
+  802704:	c1 f9 1f             	sar    $0x1f,%ecx
+  802707:	c1 e9 11             	shr    $0x11,%ecx
+  80270a:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  80270d:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802712:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  802714:	29 d3                	sub    %edx,%ebx
+  802716:	ba 00 80 00 00       	mov    $0x8000,%edx
+  80271b:	29 c2                	sub    %eax,%edx
+  80271d:	39 d3                	cmp    %edx,%ebx
+  80271f:	0f 47 da             	cmova  %edx,%ebx
+  802722:	8b 55 08             	mov    0x8(%ebp),%edx
+  802725:	29 fa                	sub    %edi,%edx
+  802727:	39 d3                	cmp    %edx,%ebx
+  802729:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  80272c:	83 ec 04             	sub    $0x4,%esp
+  80272f:	53                   	push   %ebx
+  802730:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802733:	01 c8                	add    %ecx,%eax
+  802735:	50                   	push   %eax
+  802736:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802739:	01 f8                	add    %edi,%eax
+  80273b:	50                   	push   %eax
+  80273c:	e8 89 e5 ff ff       	call   800cca <memcpy>
+    i += m;
+  802741:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  802743:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802745:	89 f2                	mov    %esi,%edx
+  802747:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80274a:	e8 03 fd ff ff       	call   802452 <pipe_wakeup>
+  80274f:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802752:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802755:	73 51                	jae    8027a8 <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  802757:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  80275a:	8b 16                	mov    (%esi),%edx
+  80275c:	39 da                	cmp    %ebx,%edx
+  80275e:	75 a2                	jne    802702 <devpipe_read_bulk+0x36>
+      if (i > 0)
+  802760:	85 ff                	test   %edi,%edi
+  802762:	75 44                	jne    8027a8 <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  802764:	89 f2                	mov    %esi,%edx
+  802766:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802769:	e8 90 fd ff ff       	call   8024fe <_pipeisclosed>
+  80276e:	85 c0                	test   %eax,%eax
+  802770:	75 3a                	jne    8027ac <devpipe_read_bulk+0xe0>
+  802772:	b8 01 00 00 00       	mov    $0x1,%eax
+  802777:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  80277b:	6a 64                	push   $0x64
+  80277d:	ff 75 d4             	push   -0x2c(%ebp)
+  802780:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  802781:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802784:	50                   	push   %eax
+  802785:	e8 c0 ea ff ff       	call   80124a <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  80278a:	85 c0                	test   %eax,%eax
+  80278c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802791:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  802794:	83 c4 10             	add    $0x10,%esp
+  802797:	a8 01                	test   $0x1,%al
+  802799:	74 b7                	je     802752 <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  80279b:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  8027a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027a3:	5b                   	pop    %ebx
+  8027a4:	5e                   	pop    %esi
+  8027a5:	5f                   	pop    %edi
+  8027a6:	5d                   	pop    %ebp
+  8027a7:	c3                   	ret
+  return i;
+  8027a8:	89 f8                	mov    %edi,%eax
+  8027aa:	eb f4                	jmp    8027a0 <devpipe_read_bulk+0xd4>
+        return 0;
+  8027ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027b1:	eb ed                	jmp    8027a0 <devpipe_read_bulk+0xd4>
+
+008027b3 <devpipe_read>:
+{
+  8027b3:	55                   	push   %ebp
+  8027b4:	89 e5                	mov    %esp,%ebp
+  8027b6:	57                   	push   %edi
+  8027b7:	56                   	push   %esi
+  8027b8:	53                   	push   %ebx
+  8027b9:	83 ec 18             	sub    $0x18,%esp
+  8027bc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  8027bf:	57                   	push   %edi
+  8027c0:	e8 0b ec ff ff       	call   8013d0 <fd2data>
+  8027c5:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  8027c7:	8b 70 28             	mov    0x28(%eax),%esi
+  8027ca:	83 c4 10             	add    $0x10,%esp
+  8027cd:	85 f6                	test   %esi,%esi
+  8027cf:	75 24                	jne    8027f5 <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  8027d1:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8027d4:	74 60                	je     802836 <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  8027d6:	8b 03                	mov    (%ebx),%eax
+  8027d8:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8027db:	75 3b                	jne    802818 <devpipe_read+0x65>
+      if (i > 0)
+  8027dd:	85 f6                	test   %esi,%esi
+  8027df:	75 2d                	jne    80280e <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  8027e1:	89 da                	mov    %ebx,%edx
+  8027e3:	89 f8                	mov    %edi,%eax
+  8027e5:	e8 14 fd ff ff       	call   8024fe <_pipeisclosed>
+  8027ea:	85 c0                	test   %eax,%eax
+  8027ec:	75 4c                	jne    80283a <devpipe_read+0x87>
+      sys_yield();
+  8027ee:	e8 bc e6 ff ff       	call   800eaf <sys_yield>
+  8027f3:	eb e1                	jmp    8027d6 <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  8027f5:	83 ec 08             	sub    $0x8,%esp
+  8027f8:	6a 00                	push   $0x0
+  8027fa:	ff 75 10             	push   0x10(%ebp)
+  8027fd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802800:	89 c2                	mov    %eax,%edx
+  802802:	89 f8                	mov    %edi,%eax
+  802804:	e8 c3 fe ff ff       	call   8026cc <devpipe_read_bulk>
+  802809:	83 c4 10             	add    $0x10,%esp
+  80280c:	eb 02                	jmp    802810 <devpipe_read+0x5d>
+        return i;
+  80280e:	89 f0                	mov    %esi,%eax
+}
+  802810:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802813:	5b                   	pop    %ebx
+  802814:	5e                   	pop    %esi
+  802815:	5f                   	pop    %edi
+  802816:	5d                   	pop    %ebp
+  802817:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802818:	99                   	cltd
+  802819:	c1 ea 1b             	shr    $0x1b,%edx
+  80281c:	01 d0                	add    %edx,%eax
+  80281e:	83 e0 1f             	and    $0x1f,%eax
+  802821:	29 d0                	sub    %edx,%eax
+  802823:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802828:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80282b:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  80282e:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  802831:	83 c6 01             	add    $0x1,%esi
+  802834:	eb 9b                	jmp    8027d1 <devpipe_read+0x1e>
+  return i;
+  802836:	89 f0                	mov    %esi,%eax
+  802838:	eb d6                	jmp    802810 <devpipe_read+0x5d>
+        return 0;
+  80283a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80283f:	eb cf                	jmp    802810 <devpipe_read+0x5d>
+
+00802841 <pipe2>:
+{
+  802841:	55                   	push   %ebp
+  802842:	89 e5                	mov    %esp,%ebp
+  802844:	57                   	push   %edi
+  802845:	56                   	push   %esi
+  802846:	53                   	push   %ebx
+  802847:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  80284a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80284d:	50                   	push   %eax
+  80284e:	e8 91 eb ff ff       	call   8013e4 <fd_alloc>
+  802853:	89 c3                	mov    %eax,%ebx
+  802855:	83 c4 10             	add    $0x10,%esp
+  802858:	85 c0                	test   %eax,%eax
+  80285a:	0f 88 fb 01 00 00    	js     802a5b <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802860:	83 ec 04             	sub    $0x4,%esp
+  802863:	68 07 04 00 00       	push   $0x407
+  802868:	ff 75 e4             	push   -0x1c(%ebp)
+  80286b:	6a 00                	push   $0x0
+  80286d:	e8 9f e6 ff ff       	call   800f11 <sys_page_alloc>
+  802872:	89 c3                	mov    %eax,%ebx
+  802874:	83 c4 10             	add    $0x10,%esp
+  802877:	85 c0                	test   %eax,%eax
+  802879:	0f 88 dc 01 00 00    	js     802a5b <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  80287f:	83 ec 0c             	sub    $0xc,%esp
+  802882:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  802885:	50                   	push   %eax
+  802886:	e8 59 eb ff ff       	call   8013e4 <fd_alloc>
+  80288b:	89 c3                	mov    %eax,%ebx
+  80288d:	83 c4 10             	add    $0x10,%esp
+  802890:	85 c0                	test   %eax,%eax
+  802892:	0f 88 b3 01 00 00    	js     802a4b <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802898:	83 ec 04             	sub    $0x4,%esp
+  80289b:	68 07 04 00 00       	push   $0x407
+  8028a0:	ff 75 e0             	push   -0x20(%ebp)
+  8028a3:	6a 00                	push   $0x0
+  8028a5:	e8 67 e6 ff ff       	call   800f11 <sys_page_alloc>
+  8028aa:	89 c3                	mov    %eax,%ebx
+  8028ac:	83 c4 10             	add    $0x10,%esp
+  8028af:	85 c0                	test   %eax,%eax
+  8028b1:	0f 88 94 01 00 00    	js     802a4b <pipe2+0x20a>
+  va = fd2data(fd0);
+  8028b7:	83 ec 0c             	sub    $0xc,%esp
+  8028ba:	ff 75 e4             	push   -0x1c(%ebp)
+  8028bd:	e8 0e eb ff ff       	call   8013d0 <fd2data>
+  8028c2:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8028c4:	83 c4 0c             	add    $0xc,%esp
+  8028c7:	68 07 04 00 00       	push   $0x407
+  8028cc:	50                   	push   %eax
+  8028cd:	6a 00                	push   $0x0
+  8028cf:	e8 3d e6 ff ff       	call   800f11 <sys_page_alloc>
+  8028d4:	89 c3                	mov    %eax,%ebx
+  8028d6:	83 c4 10             	add    $0x10,%esp
+  8028d9:	85 c0                	test   %eax,%eax
+  8028db:	0f 88 5a 01 00 00    	js     802a3b <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8028e1:	83 ec 0c             	sub    $0xc,%esp
+  8028e4:	ff 75 e0             	push   -0x20(%ebp)
+  8028e7:	e8 e4 ea ff ff       	call   8013d0 <fd2data>
+  8028ec:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8028f3:	50                   	push   %eax
+  8028f4:	6a 00                	push   $0x0
+  8028f6:	57                   	push   %edi
+  8028f7:	6a 00                	push   $0x0
+  8028f9:	e8 56 e6 ff ff       	call   800f54 <sys_page_map>
+  8028fe:	89 c3                	mov    %eax,%ebx
+  802900:	83 c4 20             	add    $0x20,%esp
+  802903:	85 c0                	test   %eax,%eax
+  802905:	0f 88 22 01 00 00    	js     802a2d <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  80290b:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  80290f:	74 72                	je     802983 <pipe2+0x142>
+  802911:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  802916:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802919:	e8 d3 fa ff ff       	call   8023f1 <pipe_ring>
+  80291e:	83 ec 04             	sub    $0x4,%esp
+  802921:	68 07 04 00 00       	push   $0x407
+  802926:	01 f0                	add    %esi,%eax
+  802928:	50                   	push   %eax
+  802929:	6a 00                	push   $0x0
+  80292b:	e8 e1 e5 ff ff       	call   800f11 <sys_page_alloc>
+  802930:	89 c3                	mov    %eax,%ebx
+  802932:	83 c4 10             	add    $0x10,%esp
+  802935:	85 c0                	test   %eax,%eax
+  802937:	0f 88 97 00 00 00    	js     8029d4 <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  80293d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802940:	e8 ac fa ff ff       	call   8023f1 <pipe_ring>
+  802945:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  802948:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80294b:	e8 a1 fa ff ff       	call   8023f1 <pipe_ring>
+  802950:	83 ec 0c             	sub    $0xc,%esp
+  802953:	68 07 04 00 00       	push   $0x407
+  802958:	53                   	push   %ebx
+  802959:	6a 00                	push   $0x0
+  80295b:	01 f0                	add    %esi,%eax
+  80295d:	50                   	push   %eax
+  80295e:	6a 00                	push   $0x0
+  802960:	e8 ef e5 ff ff       	call   800f54 <sys_page_map>
+  802965:	89 c3                	mov    %eax,%ebx
+  802967:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80296d:	83 c4 20             	add    $0x20,%esp
+  802970:	85 c0                	test   %eax,%eax
+  802972:	78 60                	js     8029d4 <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  802974:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  80297a:	75 9a                	jne    802916 <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  80297c:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  802983:	a1 20 40 80 00       	mov    0x804020,%eax
+  802988:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80298b:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  80298d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802990:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  802997:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80299a:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  80299c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80299f:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  8029a6:	83 ec 0c             	sub    $0xc,%esp
+  8029a9:	ff 75 e4             	push   -0x1c(%ebp)
+  8029ac:	e8 0f ea ff ff       	call   8013c0 <fd2num>
+  8029b1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8029b4:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  8029b6:	83 c4 04             	add    $0x4,%esp
+  8029b9:	ff 75 e0             	push   -0x20(%ebp)
+  8029bc:	e8 ff e9 ff ff       	call   8013c0 <fd2num>
+  8029c1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8029c4:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  8029c7:	83 c4 10             	add    $0x10,%esp
+  8029ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8029cf:	e9 87 00 00 00       	jmp    802a5b <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  8029d4:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  8029d9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8029dc:	e8 10 fa ff ff       	call   8023f1 <pipe_ring>
+  8029e1:	83 ec 08             	sub    $0x8,%esp
+  8029e4:	01 f0                	add    %esi,%eax
+  8029e6:	50                   	push   %eax
+  8029e7:	6a 00                	push   $0x0
+  8029e9:	e8 a8 e5 ff ff       	call   800f96 <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  8029ee:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8029f1:	e8 fb f9 ff ff       	call   8023f1 <pipe_ring>
+  8029f6:	83 c4 08             	add    $0x8,%esp
+  8029f9:	01 f0                	add    %esi,%eax
+  8029fb:	50                   	push   %eax
+  8029fc:	6a 00                	push   $0x0
+  8029fe:	e8 93 e5 ff ff       	call   800f96 <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802a03:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802a09:	83 c4 10             	add    $0x10,%esp
+  802a0c:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802a12:	75 c5                	jne    8029d9 <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  802a14:	83 ec 0c             	sub    $0xc,%esp
+  802a17:	ff 75 e0             	push   -0x20(%ebp)
+  802a1a:	e8 b1 e9 ff ff       	call   8013d0 <fd2data>
+  802a1f:	83 c4 08             	add    $0x8,%esp
+  802a22:	50                   	push   %eax
+  802a23:	6a 00                	push   $0x0
+  802a25:	e8 6c e5 ff ff       	call   800f96 <sys_page_unmap>
+  802a2a:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  802a2d:	83 ec 08             	sub    $0x8,%esp
+  802a30:	57                   	push   %edi
+  802a31:	6a 00                	push   $0x0
+  802a33:	e8 5e e5 ff ff       	call   800f96 <sys_page_unmap>
+  802a38:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  802a3b:	83 ec 08             	sub    $0x8,%esp
+  802a3e:	ff 75 e0             	push   -0x20(%ebp)
+  802a41:	6a 00                	push   $0x0
+  802a43:	e8 4e e5 ff ff       	call   800f96 <sys_page_unmap>
+  802a48:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  802a4b:	83 ec 08             	sub    $0x8,%esp
+  802a4e:	ff 75 e4             	push   -0x1c(%ebp)
+  802a51:	6a 00                	push   $0x0
+  802a53:	e8 3e e5 ff ff       	call   800f96 <sys_page_unmap>
+  802a58:	83 c4 10             	add    $0x10,%esp
+}
+  802a5b:	89 d8                	mov    %ebx,%eax
+  802a5d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a60:	5b                   	pop    %ebx
+  802a61:	5e                   	pop    %esi
+  802a62:	5f                   	pop    %edi
+  802a63:	5d                   	pop    %ebp
+  802a64:	c3                   	ret
+
+00802a65 <pipe>:
+{
+  802a65:	55                   	push   %ebp
+  802a66:	89 e5                	mov    %esp,%ebp
+  802a68:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  802a6b:	6a 00                	push   $0x0
+  802a6d:	ff 75 08             	push   0x8(%ebp)
+  802a70:	e8 cc fd ff ff       	call   802841 <pipe2>
+}
+  802a75:	c9                   	leave
+  802a76:	c3                   	ret
+
+00802a77 <pipeisclosed>:
+{
+  802a77:	55                   	push   %ebp
+  802a78:	89 e5                	mov    %esp,%ebp
+  802a7a:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802a7d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a80:	50                   	push   %eax
+  802a81:	ff 75 08             	push   0x8(%ebp)
+  802a84:	e8 b1 e9 ff ff       	call   80143a <fd_lookup>
+  802a89:	83 c4 10             	add    $0x10,%esp
+  802a8c:	85 c0                	test   %eax,%eax
+  802a8e:	78 18                	js     802aa8 <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  802a90:	83 ec 0c             	sub    $0xc,%esp
+  802a93:	ff 75 f4             	push   -0xc(%ebp)
+  802a96:	e8 35 e9 ff ff       	call   8013d0 <fd2data>
+  802a9b:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  802a9d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802aa0:	e8 59 fa ff ff       	call   8024fe <_pipeisclosed>
+  802aa5:	83 c4 10             	add    $0x10,%esp
+}
+  802aa8:	c9                   	leave
+  802aa9:	c3                   	ret
+
+00802aaa <pipe_splice>:
+{
+  802aaa:	55                   	push   %ebp
+  802aab:	89 e5                	mov    %esp,%ebp
+  802aad:	57                   	push   %edi
+  802aae:	56                   	push   %esi
+  802aaf:	53                   	push   %ebx
+  802ab0:	83 ec 34             	sub    $0x34,%esp
+  802ab3:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802ab6:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802ab9:	50                   	push   %eax
+  802aba:	ff 75 08             	push   0x8(%ebp)
+  802abd:	e8 78 e9 ff ff       	call   80143a <fd_lookup>
+  802ac2:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802ac5:	83 c4 10             	add    $0x10,%esp
+  802ac8:	85 c0                	test   %eax,%eax
+  802aca:	0f 88 d7 00 00 00    	js     802ba7 <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  802ad0:	83 ec 0c             	sub    $0xc,%esp
+  802ad3:	ff 75 e4             	push   -0x1c(%ebp)
+  802ad6:	e8 f5 e8 ff ff       	call   8013d0 <fd2data>
+  802adb:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802add:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802ae0:	83 c4 10             	add    $0x10,%esp
+  802ae3:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802ae9:	39 10                	cmp    %edx,(%eax)
+  802aeb:	0f 85 c1 00 00 00    	jne    802bb2 <pipe_splice+0x108>
+  802af1:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  802af5:	0f 84 c0 00 00 00    	je     802bbb <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  802afb:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802aff:	0f 84 bf 00 00 00    	je     802bc4 <pipe_splice+0x11a>
+  802b05:	89 f7                	mov    %esi,%edi
+  802b07:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  802b0d:	0f 85 ba 00 00 00    	jne    802bcd <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802b13:	8d 43 04             	lea    0x4(%ebx),%eax
+  802b16:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802b19:	eb 38                	jmp    802b53 <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802b1b:	83 ec 0c             	sub    $0xc,%esp
+  802b1e:	68 00 10 00 00       	push   $0x1000
+  802b23:	89 f1                	mov    %esi,%ecx
+  802b25:	89 da                	mov    %ebx,%edx
+  802b27:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802b2a:	e8 34 fa ff ff       	call   802563 <devpipe_write_bulk>
+  802b2f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802b32:	83 c4 10             	add    $0x10,%esp
+  802b35:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802b3a:	75 53                	jne    802b8f <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  802b3c:	83 ec 08             	sub    $0x8,%esp
+  802b3f:	56                   	push   %esi
+  802b40:	6a 00                	push   $0x0
+  802b42:	e8 4f e4 ff ff       	call   800f96 <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  802b47:	83 c7 01             	add    $0x1,%edi
+  802b4a:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802b50:	83 c4 10             	add    $0x10,%esp
+  802b53:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802b56:	74 3a                	je     802b92 <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  802b58:	8b 03                	mov    (%ebx),%eax
+  802b5a:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802b5d:	75 bc                	jne    802b1b <pipe_splice+0x71>
+  802b5f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b64:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  802b68:	85 c0                	test   %eax,%eax
+  802b6a:	74 af                	je     802b1b <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802b6c:	83 ec 04             	sub    $0x4,%esp
+  802b6f:	6a 07                	push   $0x7
+  802b71:	56                   	push   %esi
+  802b72:	ff 75 d0             	push   -0x30(%ebp)
+  802b75:	e8 f3 e6 ff ff       	call   80126d <sys_chan_wakeup>
+  802b7a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802b7d:	83 c4 10             	add    $0x10,%esp
+  802b80:	85 c0                	test   %eax,%eax
+  802b82:	79 b8                	jns    802b3c <pipe_splice+0x92>
+  802b84:	b8 01 00 00 00       	mov    $0x1,%eax
+  802b89:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802b8d:	eb 8c                	jmp    802b1b <pipe_splice+0x71>
+  802b8f:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  802b92:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802b96:	75 06                	jne    802b9e <pipe_splice+0xf4>
+  802b98:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802b9c:	78 09                	js     802ba7 <pipe_splice+0xfd>
+  return i * PGSIZE;
+  802b9e:	8b 45 10             	mov    0x10(%ebp),%eax
+  802ba1:	c1 e0 0c             	shl    $0xc,%eax
+  802ba4:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  802ba7:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802baa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802bad:	5b                   	pop    %ebx
+  802bae:	5e                   	pop    %esi
+  802baf:	5f                   	pop    %edi
+  802bb0:	5d                   	pop    %ebp
+  802bb1:	c3                   	ret
+    return -E_INVAL;
+  802bb2:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802bb9:	eb ec                	jmp    802ba7 <pipe_splice+0xfd>
+  802bbb:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802bc2:	eb e3                	jmp    802ba7 <pipe_splice+0xfd>
+  802bc4:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802bcb:	eb da                	jmp    802ba7 <pipe_splice+0xfd>
+  802bcd:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802bd4:	eb d1                	jmp    802ba7 <pipe_splice+0xfd>
+
+00802bd6 <pipe_splice_read>:
+{
+  802bd6:	55                   	push   %ebp
+  802bd7:	89 e5                	mov    %esp,%ebp
+  802bd9:	53                   	push   %ebx
+  802bda:	83 ec 1c             	sub    $0x1c,%esp
+  802bdd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802be0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802be3:	50                   	push   %eax
+  802be4:	ff 75 08             	push   0x8(%ebp)
+  802be7:	e8 4e e8 ff ff       	call   80143a <fd_lookup>
+  802bec:	83 c4 10             	add    $0x10,%esp
+  802bef:	85 c0                	test   %eax,%eax
+  802bf1:	78 49                	js     802c3c <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  802bf3:	83 ec 0c             	sub    $0xc,%esp
+  802bf6:	ff 75 f4             	push   -0xc(%ebp)
+  802bf9:	e8 d2 e7 ff ff       	call   8013d0 <fd2data>
+  802bfe:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802c00:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c03:	83 c4 10             	add    $0x10,%esp
+  802c06:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  802c0c:	39 08                	cmp    %ecx,(%eax)
+  802c0e:	75 31                	jne    802c41 <pipe_splice_read+0x6b>
+  802c10:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  802c14:	74 32                	je     802c48 <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  802c16:	8b 48 08             	mov    0x8(%eax),%ecx
+  802c19:	83 e1 03             	and    $0x3,%ecx
+  802c1c:	83 f9 01             	cmp    $0x1,%ecx
+  802c1f:	74 2e                	je     802c4f <pipe_splice_read+0x79>
+  802c21:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  802c27:	75 2d                	jne    802c56 <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  802c29:	83 ec 08             	sub    $0x8,%esp
+  802c2c:	53                   	push   %ebx
+  802c2d:	68 00 10 00 00       	push   $0x1000
+  802c32:	89 d9                	mov    %ebx,%ecx
+  802c34:	e8 93 fa ff ff       	call   8026cc <devpipe_read_bulk>
+  802c39:	83 c4 10             	add    $0x10,%esp
+}
+  802c3c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802c3f:	c9                   	leave
+  802c40:	c3                   	ret
+    return -E_INVAL;
+  802c41:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c46:	eb f4                	jmp    802c3c <pipe_splice_read+0x66>
+  802c48:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c4d:	eb ed                	jmp    802c3c <pipe_splice_read+0x66>
+  802c4f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c54:	eb e6                	jmp    802c3c <pipe_splice_read+0x66>
+  802c56:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802c5b:	eb df                	jmp    802c3c <pipe_splice_read+0x66>
+
+00802c5d <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  802c5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c62:	c3                   	ret
+
+00802c63 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802c63:	55                   	push   %ebp
+  802c64:	89 e5                	mov    %esp,%ebp
+  802c66:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  802c69:	68 47 37 80 00       	push   $0x803747
+  802c6e:	ff 75 0c             	push   0xc(%ebp)
+  802c71:	e8 6c de ff ff       	call   800ae2 <strcpy>
+  return 0;
+}
+  802c76:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c7b:	c9                   	leave
+  802c7c:	c3                   	ret
+
+00802c7d <devcons_write>:
+{
+  802c7d:	55                   	push   %ebp
+  802c7e:	89 e5                	mov    %esp,%ebp
+  802c80:	57                   	push   %edi
+  802c81:	56                   	push   %esi
+  802c82:	53                   	push   %ebx
+  802c83:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  802c89:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  802c8e:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  802c94:	eb 2e                	jmp    802cc4 <devcons_write+0x47>
+    m = n - tot;
+  802c96:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802c99:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  802c9b:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802ca0:	39 c3                	cmp    %eax,%ebx
+  802ca2:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  802ca5:	83 ec 04             	sub    $0x4,%esp
+  802ca8:	53                   	push   %ebx
+  802ca9:	89 f0                	mov    %esi,%eax
+  802cab:	03 45 0c             	add    0xc(%ebp),%eax
+  802cae:	50                   	push   %eax
+  802caf:	57                   	push   %edi
+  802cb0:	e8 b3 df ff ff       	call   800c68 <memmove>
+    sys_cputs(buf, m);
+  802cb5:	83 c4 08             	add    $0x8,%esp
+  802cb8:	53                   	push   %ebx
+  802cb9:	57                   	push   %edi
+  802cba:	e8 53 e1 ff ff       	call   800e12 <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  802cbf:	01 de                	add    %ebx,%esi
+  802cc1:	83 c4 10             	add    $0x10,%esp
+  802cc4:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802cc7:	72 cd                	jb     802c96 <devcons_write+0x19>
+}
+  802cc9:	89 f0                	mov    %esi,%eax
+  802ccb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802cce:	5b                   	pop    %ebx
+  802ccf:	5e                   	pop    %esi
+  802cd0:	5f                   	pop    %edi
+  802cd1:	5d                   	pop    %ebp
+  802cd2:	c3                   	ret
+
+00802cd3 <devcons_read>:
+{
+  802cd3:	55                   	push   %ebp
+  802cd4:	89 e5                	mov    %esp,%ebp
+  802cd6:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  802cd9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cde:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802ce2:	75 07                	jne    802ceb <devcons_read+0x18>
+  802ce4:	eb 1f                	jmp    802d05 <devcons_read+0x32>
+    sys_yield();
+  802ce6:	e8 c4 e1 ff ff       	call   800eaf <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  802ceb:	e8 40 e1 ff ff       	call   800e30 <sys_cgetc>
+  802cf0:	85 c0                	test   %eax,%eax
+  802cf2:	74 f2                	je     802ce6 <devcons_read+0x13>
+  if (c < 0)
+  802cf4:	78 0f                	js     802d05 <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  802cf6:	83 f8 04             	cmp    $0x4,%eax
+  802cf9:	74 0c                	je     802d07 <devcons_read+0x34>
+  *(char*)vbuf = c;
+  802cfb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802cfe:	88 02                	mov    %al,(%edx)
+  return 1;
+  802d00:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802d05:	c9                   	leave
+  802d06:	c3                   	ret
+    return 0;
+  802d07:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d0c:	eb f7                	jmp    802d05 <devcons_read+0x32>
+
+00802d0e <cputchar>:
+{
+  802d0e:	55                   	push   %ebp
+  802d0f:	89 e5                	mov    %esp,%ebp
+  802d11:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  802d14:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d17:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  802d1a:	6a 01                	push   $0x1
+  802d1c:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802d1f:	50                   	push   %eax
+  802d20:	e8 ed e0 ff ff       	call   800e12 <sys_cputs>
+}
+  802d25:	83 c4 10             	add    $0x10,%esp
+  802d28:	c9                   	leave
+  802d29:	c3                   	ret
+
+00802d2a <getchar>:
+{
+  802d2a:	55                   	push   %ebp
+  802d2b:	89 e5                	mov    %esp,%ebp
+  802d2d:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  802d30:	6a 01                	push   $0x1
+  802d32:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802d35:	50                   	push   %eax
+  802d36:	6a 00                	push   $0x0
+  802d38:	e8 a8 e9 ff ff       	call   8016e5 <read>
+  if (r < 0)
+  802d3d:	83 c4 10             	add    $0x10,%esp
+  802d40:	85 c0                	test   %eax,%eax
+  802d42:	78 06                	js     802d4a <getchar+0x20>
+  if (r < 1)
+  802d44:	74 06                	je     802d4c <getchar+0x22>
+  return c;
+  802d46:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802d4a:	c9                   	leave
+  802d4b:	c3                   	ret
+    return -E_EOF;
+  802d4c:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802d51:	eb f7                	jmp    802d4a <getchar+0x20>
+
+00802d53 <iscons>:
+{
+  802d53:	55                   	push   %ebp
+  802d54:	89 e5                	mov    %esp,%ebp
+  802d56:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802d59:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802d5c:	50                   	push   %eax
+  802d5d:	ff 75 08             	push   0x8(%ebp)
+  802d60:	e8 d5 e6 ff ff       	call   80143a <fd_lookup>
+  802d65:	83 c4 10             	add    $0x10,%esp
+  802d68:	85 c0                	test   %eax,%eax
+  802d6a:	78 11                	js     802d7d <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  802d6c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802d6f:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802d75:	39 10                	cmp    %edx,(%eax)
+  802d77:	0f 94 c0             	sete   %al
+  802d7a:	0f b6 c0             	movzbl %al,%eax
+}
+  802d7d:	c9                   	leave
+  802d7e:	c3                   	ret
+
+00802d7f <opencons>:
+{
+  802d7f:	55                   	push   %ebp
+  802d80:	89 e5                	mov    %esp,%ebp
+  802d82:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  802d85:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802d88:	50                   	push   %eax
+  802d89:	e8 56 e6 ff ff       	call   8013e4 <fd_alloc>
+  802d8e:	83 c4 10             	add    $0x10,%esp
+  802d91:	85 c0                	test   %eax,%eax
+  802d93:	78 3a                	js     802dcf <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802d95:	83 ec 04             	sub    $0x4,%esp
+  802d98:	68 07 04 00 00       	push   $0x407
+  802d9d:	ff 75 f4             	push   -0xc(%ebp)
+  802da0:	6a 00                	push   $0x0
+  802da2:	e8 6a e1 ff ff       	call   800f11 <sys_page_alloc>
+  802da7:	83 c4 10             	add    $0x10,%esp
+  802daa:	85 c0                	test   %eax,%eax
+  802dac:	78 21                	js     802dcf <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  802dae:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802db1:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802db7:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  802db9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802dbc:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  802dc3:	83 ec 0c             	sub    $0xc,%esp
+  802dc6:	50                   	push   %eax
+  802dc7:	e8 f4 e5 ff ff       	call   8013c0 <fd2num>
+  802dcc:	83 c4 10             	add    $0x10,%esp
+}
+  802dcf:	c9                   	leave
+  802dd0:	c3                   	ret
+
+00802dd1 <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  802dd1:	55                   	push   %ebp
+  802dd2:	89 e5                	mov    %esp,%ebp
+  802dd4:	57                   	push   %edi
+  802dd5:	56                   	push   %esi
+  802dd6:	53                   	push   %ebx
+  802dd7:	83 ec 14             	sub    $0x14,%esp
+  802dda:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802ddd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802de0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802de3:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  802de6:	85 c0                	test   %eax,%eax
+  802de8:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802ded:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  802df0:	ff 33                	push   (%ebx)
+  802df2:	50                   	push   %eax
+  802df3:	e8 f1 e3 ff ff       	call   8011e9 <sys_ipc_recv>
+  802df8:	83 c4 10             	add    $0x10,%esp
+  802dfb:	85 c0                	test   %eax,%eax
+  802dfd:	78 39                	js     802e38 <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  802dff:	85 ff                	test   %edi,%edi
+  802e01:	74 0a                	je     802e0d <ipc_recv_pages+0x3c>
+  802e03:	a1 44 67 80 00       	mov    0x806744,%eax
+  802e08:	8b 40 7c             	mov    0x7c(%eax),%eax
+  802e0b:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  802e0d:	85 f6                	test   %esi,%esi
+  802e0f:	74 0d                	je     802e1e <ipc_recv_pages+0x4d>
+  802e11:	a1 44 67 80 00       	mov    0x806744,%eax
+  802e16:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  802e1c:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  802e1e:	a1 44 67 80 00       	mov    0x806744,%eax
+  802e23:	8b 40 74             	mov    0x74(%eax),%eax
+  802e26:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  802e28:	a1 44 67 80 00       	mov    0x806744,%eax
+  802e2d:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  802e30:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e33:	5b                   	pop    %ebx
+  802e34:	5e                   	pop    %esi
+  802e35:	5f                   	pop    %edi
+  802e36:	5d                   	pop    %ebp
+  802e37:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  802e38:	85 ff                	test   %edi,%edi
+  802e3a:	74 06                	je     802e42 <ipc_recv_pages+0x71>
+  802e3c:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  802e42:	85 f6                	test   %esi,%esi
+  802e44:	74 06                	je     802e4c <ipc_recv_pages+0x7b>
+  802e46:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  802e4c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  802e52:	eb dc                	jmp    802e30 <ipc_recv_pages+0x5f>
+
+00802e54 <ipc_recv>:
+{
+  802e54:	55                   	push   %ebp
+  802e55:	89 e5                	mov    %esp,%ebp
+  802e57:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  802e5a:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  802e61:	ff 75 10             	push   0x10(%ebp)
+  802e64:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802e67:	50                   	push   %eax
+  802e68:	ff 75 0c             	push   0xc(%ebp)
+  802e6b:	ff 75 08             	push   0x8(%ebp)
+  802e6e:	e8 5e ff ff ff       	call   802dd1 <ipc_recv_pages>
+}
+  802e73:	c9                   	leave
+  802e74:	c3                   	ret
+
+00802e75 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  802e75:	55                   	push   %ebp
+  802e76:	89 e5                	mov    %esp,%ebp
+  802e78:	57                   	push   %edi
+  802e79:	56                   	push   %esi
+  802e7a:	53                   	push   %ebx
+  802e7b:	83 ec 0c             	sub    $0xc,%esp
+  802e7e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802e81:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802e84:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  802e87:	89 c3                	mov    %eax,%ebx
+  802e89:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  802e8f:	85 c0                	test   %eax,%eax
+  802e91:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802e96:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  802e99:	83 ec 0c             	sub    $0xc,%esp
+  802e9c:	ff 75 14             	push   0x14(%ebp)
+  802e9f:	ff 75 18             	push   0x18(%ebp)
+  802ea2:	53                   	push   %ebx
+  802ea3:	56                   	push   %esi
+  802ea4:	57                   	push   %edi
+  802ea5:	e8 1e e3 ff ff       	call   8011c8 <sys_ipc_try_send>
+  802eaa:	83 c4 20             	add    $0x20,%esp
+  802ead:	85 c0                	test   %eax,%eax
+  802eaf:	79 1e                	jns    802ecf <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  802eb1:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802eb4:	75 07                	jne    802ebd <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  802eb6:	e8 f4 df ff ff       	call   800eaf <sys_yield>
+  802ebb:	eb dc                	jmp    802e99 <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  802ebd:	50                   	push   %eax
+  802ebe:	68 53 37 80 00       	push   $0x803753
+  802ec3:	6a 5c                	push   $0x5c
+  802ec5:	68 60 37 80 00       	push   $0x803760
+  802eca:	e8 4a d5 ff ff       	call   800419 <_panic>
+  }
+}
+  802ecf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ed2:	5b                   	pop    %ebx
+  802ed3:	5e                   	pop    %esi
+  802ed4:	5f                   	pop    %edi
+  802ed5:	5d                   	pop    %ebp
+  802ed6:	c3                   	ret
+
+00802ed7 <ipc_send>:
+{
+  802ed7:	55                   	push   %ebp
+  802ed8:	89 e5                	mov    %esp,%ebp
+  802eda:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  802edd:	ff 75 14             	push   0x14(%ebp)
+  802ee0:	6a 01                	push   $0x1
+  802ee2:	ff 75 10             	push   0x10(%ebp)
+  802ee5:	ff 75 0c             	push   0xc(%ebp)
+  802ee8:	ff 75 08             	push   0x8(%ebp)
+  802eeb:	e8 85 ff ff ff       	call   802e75 <ipc_send_pages>
+}
+  802ef0:	83 c4 20             	add    $0x20,%esp
+  802ef3:	c9                   	leave
+  802ef4:	c3                   	ret
+
+00802ef5 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802ef5:	55                   	push   %ebp
+  802ef6:	89 e5                	mov    %esp,%ebp
+  802ef8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  802efb:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  802f00:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802f03:	c1 e0 04             	shl    $0x4,%eax
+  802f06:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802f0b:	8b 40 50             	mov    0x50(%eax),%eax
+  802f0e:	39 c8                	cmp    %ecx,%eax
+  802f10:	74 12                	je     802f24 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  802f12:	83 c2 01             	add    $0x1,%edx
+  802f15:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802f1b:	75 e3                	jne    802f00 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  802f1d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f22:	eb 0e                	jmp    802f32 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  802f24:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802f27:	c1 e0 04             	shl    $0x4,%eax
+  802f2a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802f2f:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802f32:	5d                   	pop    %ebp
+  802f33:	c3                   	ret
+
+00802f34 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802f34:	55                   	push   %ebp
+  802f35:	89 e5                	mov    %esp,%ebp
+  802f37:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802f3a:	89 c2                	mov    %eax,%edx
+  802f3c:	c1 ea 16             	shr    $0x16,%edx
+  802f3f:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  802f46:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802f4b:	f6 c1 01             	test   $0x1,%cl
+  802f4e:	74 1c                	je     802f6c <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  802f50:	c1 e8 0c             	shr    $0xc,%eax
+  802f53:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  802f5a:	a8 01                	test   $0x1,%al
+  802f5c:	74 0e                	je     802f6c <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  802f5e:	c1 e8 0c             	shr    $0xc,%eax
+  802f61:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802f68:	ef 
+  802f69:	0f b7 d2             	movzwl %dx,%edx
+}
+  802f6c:	89 d0                	mov    %edx,%eax
+  802f6e:	5d                   	pop    %ebp
+  802f6f:	c3                   	ret
+
+00802f70 <udivmod>:
+  802f70:	55                   	push   %ebp
+  802f71:	57                   	push   %edi
+  802f72:	56                   	push   %esi
+  802f73:	53                   	push   %ebx
+  802f74:	83 ec 14             	sub    $0x14,%esp
+  802f77:	8b 74 24 28          	mov    0x28(%esp),%esi
+  802f7b:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  802f7f:	89 fb                	mov    %edi,%ebx
+  802f81:	09 f3                	or     %esi,%ebx
+  802f83:	0f 84 88 00 00 00    	je     803011 <udivmod+0xa1>
+  802f89:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802f8e:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802f95:	00 
+  802f96:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802f9d:	00 
+  802f9e:	89 cd                	mov    %ecx,%ebp
+  802fa0:	89 34 24             	mov    %esi,(%esp)
+  802fa3:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802fa7:	eb 08                	jmp    802fb1 <udivmod+0x41>
+  802fa9:	83 ed 01             	sub    $0x1,%ebp
+  802fac:	83 fd ff             	cmp    $0xffffffff,%ebp
+  802faf:	74 6c                	je     80301d <udivmod+0xad>
+  802fb1:	89 c3                	mov    %eax,%ebx
+  802fb3:	89 d6                	mov    %edx,%esi
+  802fb5:	89 e9                	mov    %ebp,%ecx
+  802fb7:	0f ad f3             	shrd   %cl,%esi,%ebx
+  802fba:	d3 ee                	shr    %cl,%esi
+  802fbc:	f6 c1 20             	test   $0x20,%cl
+  802fbf:	74 04                	je     802fc5 <udivmod+0x55>
+  802fc1:	89 f3                	mov    %esi,%ebx
+  802fc3:	31 f6                	xor    %esi,%esi
+  802fc5:	8b 3c 24             	mov    (%esp),%edi
+  802fc8:	39 fb                	cmp    %edi,%ebx
+  802fca:	89 f7                	mov    %esi,%edi
+  802fcc:	8b 1c 24             	mov    (%esp),%ebx
+  802fcf:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802fd3:	19 f7                	sbb    %esi,%edi
+  802fd5:	72 d2                	jb     802fa9 <udivmod+0x39>
+  802fd7:	89 f7                	mov    %esi,%edi
+  802fd9:	89 de                	mov    %ebx,%esi
+  802fdb:	89 e9                	mov    %ebp,%ecx
+  802fdd:	0f a5 f7             	shld   %cl,%esi,%edi
+  802fe0:	d3 e6                	shl    %cl,%esi
+  802fe2:	f6 c1 20             	test   $0x20,%cl
+  802fe5:	74 04                	je     802feb <udivmod+0x7b>
+  802fe7:	89 f7                	mov    %esi,%edi
+  802fe9:	31 f6                	xor    %esi,%esi
+  802feb:	29 f0                	sub    %esi,%eax
+  802fed:	19 fa                	sbb    %edi,%edx
+  802fef:	be 01 00 00 00       	mov    $0x1,%esi
+  802ff4:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ff9:	0f a5 f7             	shld   %cl,%esi,%edi
+  802ffc:	d3 e6                	shl    %cl,%esi
+  802ffe:	f6 c1 20             	test   $0x20,%cl
+  803001:	74 04                	je     803007 <udivmod+0x97>
+  803003:	89 f7                	mov    %esi,%edi
+  803005:	31 f6                	xor    %esi,%esi
+  803007:	09 74 24 08          	or     %esi,0x8(%esp)
+  80300b:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  80300f:	eb 98                	jmp    802fa9 <udivmod+0x39>
+  803011:	89 f0                	mov    %esi,%eax
+  803013:	89 fa                	mov    %edi,%edx
+  803015:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803019:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  80301d:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  803021:	89 01                	mov    %eax,(%ecx)
+  803023:	89 51 04             	mov    %edx,0x4(%ecx)
+  803026:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80302a:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80302e:	83 c4 14             	add    $0x14,%esp
+  803031:	5b                   	pop    %ebx
+  803032:	5e                   	pop    %esi
+  803033:	5f                   	pop    %edi
+  803034:	5d                   	pop    %ebp
+  803035:	c3                   	ret
+
+00803036 <__udivdi3>:
+  803036:	83 ec 18             	sub    $0x18,%esp
+  803039:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80303d:	50                   	push   %eax
+  80303e:	ff 74 24 2c          	push   0x2c(%esp)
+  803042:	ff 74 24 2c          	push   0x2c(%esp)
+  803046:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80304a:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80304e:	e8 1d ff ff ff       	call   802f70 <udivmod>
+  803053:	83 c4 24             	add    $0x24,%esp
+  803056:	c3                   	ret
+
+00803057 <__umoddi3>:
+  803057:	83 ec 18             	sub    $0x18,%esp
+  80305a:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80305e:	50                   	push   %eax
+  80305f:	ff 74 24 2c          	push   0x2c(%esp)
+  803063:	ff 74 24 2c          	push   0x2c(%esp)
+  803067:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80306b:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80306f:	e8 fc fe ff ff       	call   802f70 <udivmod>
+  803074:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803078:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80307c:	83 c4 24             	add    $0x24,%esp
+  80307f:	c3                   	ret
+
+00803080 <__divdi3>:
+  803080:	56                   	push   %esi
+  803081:	53                   	push   %ebx
+  803082:	83 ec 14             	sub    $0x14,%esp
+  803085:	8b 44 24 20          	mov    0x20(%esp),%eax
+  803089:	8b 54 24 24          	mov    0x24(%esp),%edx
+  80308d:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  803091:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  803095:	85 d2                	test   %edx,%edx
+  803097:	78 18                	js     8030b1 <__divdi3+0x31>
+  803099:	85 db                	test   %ebx,%ebx
+  80309b:	78 3e                	js     8030db <__divdi3+0x5b>
+  80309d:	83 ec 04             	sub    $0x4,%esp
+  8030a0:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8030a4:	56                   	push   %esi
+  8030a5:	53                   	push   %ebx
+  8030a6:	51                   	push   %ecx
+  8030a7:	e8 c4 fe ff ff       	call   802f70 <udivmod>
+  8030ac:	83 c4 10             	add    $0x10,%esp
+  8030af:	eb 24                	jmp    8030d5 <__divdi3+0x55>
+  8030b1:	f7 d8                	neg    %eax
+  8030b3:	83 d2 00             	adc    $0x0,%edx
+  8030b6:	f7 da                	neg    %edx
+  8030b8:	85 db                	test   %ebx,%ebx
+  8030ba:	78 3a                	js     8030f6 <__divdi3+0x76>
+  8030bc:	83 ec 04             	sub    $0x4,%esp
+  8030bf:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8030c3:	56                   	push   %esi
+  8030c4:	53                   	push   %ebx
+  8030c5:	51                   	push   %ecx
+  8030c6:	e8 a5 fe ff ff       	call   802f70 <udivmod>
+  8030cb:	83 c4 10             	add    $0x10,%esp
+  8030ce:	f7 d8                	neg    %eax
+  8030d0:	83 d2 00             	adc    $0x0,%edx
+  8030d3:	f7 da                	neg    %edx
+  8030d5:	83 c4 14             	add    $0x14,%esp
+  8030d8:	5b                   	pop    %ebx
+  8030d9:	5e                   	pop    %esi
+  8030da:	c3                   	ret
+  8030db:	83 ec 04             	sub    $0x4,%esp
+  8030de:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8030e2:	56                   	push   %esi
+  8030e3:	f7 d9                	neg    %ecx
+  8030e5:	83 d3 00             	adc    $0x0,%ebx
+  8030e8:	f7 db                	neg    %ebx
+  8030ea:	53                   	push   %ebx
+  8030eb:	51                   	push   %ecx
+  8030ec:	e8 7f fe ff ff       	call   802f70 <udivmod>
+  8030f1:	83 c4 10             	add    $0x10,%esp
+  8030f4:	eb d8                	jmp    8030ce <__divdi3+0x4e>
+  8030f6:	83 ec 04             	sub    $0x4,%esp
+  8030f9:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8030fd:	56                   	push   %esi
+  8030fe:	f7 d9                	neg    %ecx
+  803100:	83 d3 00             	adc    $0x0,%ebx
+  803103:	f7 db                	neg    %ebx
+  803105:	53                   	push   %ebx
+  803106:	51                   	push   %ecx
+  803107:	e8 64 fe ff ff       	call   802f70 <udivmod>
+  80310c:	83 c4 10             	add    $0x10,%esp
+  80310f:	eb c4                	jmp    8030d5 <__divdi3+0x55>
+
+00803111 <__moddi3>:
+  803111:	55                   	push   %ebp
+  803112:	57                   	push   %edi
+  803113:	56                   	push   %esi
+  803114:	53                   	push   %ebx
+  803115:	83 ec 24             	sub    $0x24,%esp
+  803118:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80311c:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803120:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  803124:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  803128:	85 d2                	test   %edx,%edx
+  80312a:	78 3b                	js     803167 <__moddi3+0x56>
+  80312c:	83 ec 04             	sub    $0x4,%esp
+  80312f:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803133:	56                   	push   %esi
+  803134:	89 ce                	mov    %ecx,%esi
+  803136:	f7 de                	neg    %esi
+  803138:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80313c:	89 de                	mov    %ebx,%esi
+  80313e:	83 d6 00             	adc    $0x0,%esi
+  803141:	f7 de                	neg    %esi
+  803143:	89 74 24 14          	mov    %esi,0x14(%esp)
+  803147:	8b 74 24 08          	mov    0x8(%esp),%esi
+  80314b:	0f 48 f1             	cmovs  %ecx,%esi
+  80314e:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  803153:	53                   	push   %ebx
+  803154:	56                   	push   %esi
+  803155:	e8 16 fe ff ff       	call   802f70 <udivmod>
+  80315a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80315e:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803162:	83 c4 10             	add    $0x10,%esp
+  803165:	eb 47                	jmp    8031ae <__moddi3+0x9d>
+  803167:	f7 d8                	neg    %eax
+  803169:	83 d2 00             	adc    $0x0,%edx
+  80316c:	f7 da                	neg    %edx
+  80316e:	83 ec 04             	sub    $0x4,%esp
+  803171:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803175:	56                   	push   %esi
+  803176:	89 cf                	mov    %ecx,%edi
+  803178:	f7 df                	neg    %edi
+  80317a:	89 de                	mov    %ebx,%esi
+  80317c:	83 d6 00             	adc    $0x0,%esi
+  80317f:	f7 de                	neg    %esi
+  803181:	0f 49 cf             	cmovns %edi,%ecx
+  803184:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  803188:	0f 49 de             	cmovns %esi,%ebx
+  80318b:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  80318f:	ff 74 24 0c          	push   0xc(%esp)
+  803193:	ff 74 24 0c          	push   0xc(%esp)
+  803197:	e8 d4 fd ff ff       	call   802f70 <udivmod>
+  80319c:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8031a0:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8031a4:	f7 d8                	neg    %eax
+  8031a6:	83 d2 00             	adc    $0x0,%edx
+  8031a9:	f7 da                	neg    %edx
+  8031ab:	83 c4 10             	add    $0x10,%esp
+  8031ae:	83 c4 24             	add    $0x24,%esp
+  8031b1:	5b                   	pop    %ebx
+  8031b2:	5e                   	pop    %esi
+  8031b3:	5f                   	pop    %edi
+  8031b4:	5d                   	pop    %ebp
+  8031b5:	c3                   	ret
@@ -0,0 +1,6656 @@
+
+obj/user/fsstats.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 17 01 00 00       	call   800148 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 7c             	sub    $0x7c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity, lookups;
+  int r;
+
+  binaryname = "fsstats";
+  80003c:	c7 05 00 40 80 00 8c 	movl   $0x80308c,0x804000
+  800043:	30 80 00 
+  capacity = 0;
+  800046:	b8 00 00 00 00       	mov    $0x0,%eax
+  if (argc > 1)
+  80004b:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+  80004f:	0f 8f c7 00 00 00    	jg     80011c <umain+0xe9>
+    capacity = strtol(argv[1], 0, 0);
+
+  if ((r = fs_stats(capacity, &st)) < 0)
+  800055:	83 ec 08             	sub    $0x8,%esp
+  800058:	8d 55 90             	lea    -0x70(%ebp),%edx
+  80005b:	52                   	push   %edx
+  80005c:	50                   	push   %eax
+  80005d:	e8 49 1f 00 00       	call   801fab <fs_stats>
+  800062:	83 c4 10             	add    $0x10,%esp
+  800065:	85 c0                	test   %eax,%eax
+  800067:	0f 88 c9 00 00 00    	js     800136 <umain+0x103>
+    panic("fs_stats: %e", r);
+
+  lookups = st.ret_bc_hits + st.ret_bc_misses;
+  80006d:	8b 4d 98             	mov    -0x68(%ebp),%ecx
+  800070:	8b 5d 9c             	mov    -0x64(%ebp),%ebx
+  printf("block cache: %d/%d blocks, %d hits, %d misses (%d%% hits), "
+  800073:	8b 7d a4             	mov    -0x5c(%ebp),%edi
+  800076:	8b 45 a0             	mov    -0x60(%ebp),%eax
+  800079:	89 45 84             	mov    %eax,-0x7c(%ebp)
+  80007c:	89 ce                	mov    %ecx,%esi
+  80007e:	01 de                	add    %ebx,%esi
+  800080:	74 0c                	je     80008e <umain+0x5b>
+         "%d evictions, %d read ahead\n", st.ret_bc_resident,
+         st.ret_bc_capacity, st.ret_bc_hits, st.ret_bc_misses,
+         lookups ? st.ret_bc_hits * 100 / lookups : 0, st.ret_bc_evictions,
+  800082:	6b c1 64             	imul   $0x64,%ecx,%eax
+  printf("block cache: %d/%d blocks, %d hits, %d misses (%d%% hits), "
+  800085:	ba 00 00 00 00       	mov    $0x0,%edx
+  80008a:	f7 f6                	div    %esi
+  80008c:	89 c6                	mov    %eax,%esi
+  80008e:	57                   	push   %edi
+  80008f:	ff 75 84             	push   -0x7c(%ebp)
+  800092:	56                   	push   %esi
+  800093:	53                   	push   %ebx
+  800094:	51                   	push   %ecx
+  800095:	ff 75 90             	push   -0x70(%ebp)
+  800098:	ff 75 94             	push   -0x6c(%ebp)
+  80009b:	68 b0 30 80 00       	push   $0x8030b0
+  8000a0:	e8 e6 21 00 00       	call   80228b <printf>
+         st.ret_bc_readahead);
+  printf("writes: %d blocks in %d disk writes\n", st.ret_bc_written,
+  8000a5:	83 c4 1c             	add    $0x1c,%esp
+  8000a8:	ff 75 a8             	push   -0x58(%ebp)
+  8000ab:	ff 75 ac             	push   -0x54(%ebp)
+  8000ae:	68 08 31 80 00       	push   $0x803108
+  8000b3:	e8 d3 21 00 00       	call   80228b <printf>
+         st.ret_bc_writes);
+  printf("disk queue: %s, %d requests, %d merged, %d reads, "
+  8000b8:	83 c4 08             	add    $0x8,%esp
+  8000bb:	83 7d b0 02          	cmpl   $0x2,-0x50(%ebp)
+  8000bf:	b8 85 30 80 00       	mov    $0x803085,%eax
+  8000c4:	ba 80 30 80 00       	mov    $0x803080,%edx
+  8000c9:	0f 44 c2             	cmove  %edx,%eax
+  8000cc:	ff 75 c0             	push   -0x40(%ebp)
+  8000cf:	ff 75 bc             	push   -0x44(%ebp)
+  8000d2:	ff 75 b8             	push   -0x48(%ebp)
+  8000d5:	ff 75 b4             	push   -0x4c(%ebp)
+  8000d8:	50                   	push   %eax
+  8000d9:	68 30 31 80 00       	push   $0x803130
+  8000de:	e8 a8 21 00 00       	call   80228b <printf>
+         "%d blocks of seeking\n",
+         st.ret_bio_sched == BIO_SCHED_FIFO ? "fifo" : "c-look",
+         st.ret_bio_reqs, st.ret_bio_merged, st.ret_bio_reads,
+         st.ret_bio_seek);
+  lookups = st.ret_dc_hits + st.ret_dc_misses;
+  8000e3:	8b 4d c4             	mov    -0x3c(%ebp),%ecx
+  8000e6:	8b 5d cc             	mov    -0x34(%ebp),%ebx
+  printf("path cache: %d hits (%d negative), %d misses (%d%% hits)\n",
+  8000e9:	83 c4 20             	add    $0x20,%esp
+  8000ec:	89 ce                	mov    %ecx,%esi
+  8000ee:	01 de                	add    %ebx,%esi
+  8000f0:	74 0c                	je     8000fe <umain+0xcb>
+         st.ret_dc_hits, st.ret_dc_negative, st.ret_dc_misses,
+         lookups ? st.ret_dc_hits * 100 / lookups : 0);
+  8000f2:	6b c1 64             	imul   $0x64,%ecx,%eax
+  printf("path cache: %d hits (%d negative), %d misses (%d%% hits)\n",
+  8000f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000fa:	f7 f6                	div    %esi
+  8000fc:	89 c6                	mov    %eax,%esi
+  8000fe:	83 ec 0c             	sub    $0xc,%esp
+  800101:	56                   	push   %esi
+  800102:	53                   	push   %ebx
+  800103:	ff 75 c8             	push   -0x38(%ebp)
+  800106:	51                   	push   %ecx
+  800107:	68 78 31 80 00       	push   $0x803178
+  80010c:	e8 7a 21 00 00       	call   80228b <printf>
+}
+  800111:	83 c4 20             	add    $0x20,%esp
+  800114:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800117:	5b                   	pop    %ebx
+  800118:	5e                   	pop    %esi
+  800119:	5f                   	pop    %edi
+  80011a:	5d                   	pop    %ebp
+  80011b:	c3                   	ret
+    capacity = strtol(argv[1], 0, 0);
+  80011c:	83 ec 04             	sub    $0x4,%esp
+  80011f:	6a 00                	push   $0x0
+  800121:	6a 00                	push   $0x0
+  800123:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800126:	ff 70 04             	push   0x4(%eax)
+  800129:	e8 a4 09 00 00       	call   800ad2 <strtol>
+  80012e:	83 c4 10             	add    $0x10,%esp
+  800131:	e9 1f ff ff ff       	jmp    800055 <umain+0x22>
+    panic("fs_stats: %e", r);
+  800136:	50                   	push   %eax
+  800137:	68 94 30 80 00       	push   $0x803094
+  80013c:	6a 16                	push   $0x16
+  80013e:	68 a1 30 80 00       	push   $0x8030a1
+  800143:	e8 6d 00 00 00       	call   8001b5 <_panic>
+
+00800148 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800148:	55                   	push   %ebp
+  800149:	89 e5                	mov    %esp,%ebp
+  80014b:	56                   	push   %esi
+  80014c:	53                   	push   %ebx
+  80014d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800150:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  800153:	c7 05 44 57 80 00 00 	movl   $0x0,0x805744
+  80015a:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  80015d:	e8 ca 0a 00 00       	call   800c2c <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  800162:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800167:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80016a:	c1 e0 04             	shl    $0x4,%eax
+  80016d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800172:	a3 44 57 80 00       	mov    %eax,0x805744
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800177:	85 db                	test   %ebx,%ebx
+  800179:	7e 07                	jle    800182 <libmain+0x3a>
+    binaryname = argv[0];
+  80017b:	8b 06                	mov    (%esi),%eax
+  80017d:	a3 00 40 80 00       	mov    %eax,0x804000
+
+  // call user main routine
+  umain(argc, argv);
+  800182:	83 ec 08             	sub    $0x8,%esp
+  800185:	56                   	push   %esi
+  800186:	53                   	push   %ebx
+  800187:	e8 a7 fe ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  80018c:	e8 0a 00 00 00       	call   80019b <exit>
+}
+  800191:	83 c4 10             	add    $0x10,%esp
+  800194:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800197:	5b                   	pop    %ebx
+  800198:	5e                   	pop    %esi
+  800199:	5d                   	pop    %ebp
+  80019a:	c3                   	ret
+
+0080019b <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80019b:	55                   	push   %ebp
+  80019c:	89 e5                	mov    %esp,%ebp
+  80019e:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  8001a1:	e8 80 11 00 00       	call   801326 <close_all>
+  sys_env_destroy(0);
+  8001a6:	83 ec 0c             	sub    $0xc,%esp
+  8001a9:	6a 00                	push   $0x0
+  8001ab:	e8 3b 0a 00 00       	call   800beb <sys_env_destroy>
+}
+  8001b0:	83 c4 10             	add    $0x10,%esp
+  8001b3:	c9                   	leave
+  8001b4:	c3                   	ret
+
+008001b5 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8001b5:	55                   	push   %ebp
+  8001b6:	89 e5                	mov    %esp,%ebp
+  8001b8:	56                   	push   %esi
+  8001b9:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  8001ba:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  8001bd:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  8001c3:	e8 64 0a 00 00       	call   800c2c <sys_getenvid>
+  8001c8:	83 ec 0c             	sub    $0xc,%esp
+  8001cb:	ff 75 0c             	push   0xc(%ebp)
+  8001ce:	ff 75 08             	push   0x8(%ebp)
+  8001d1:	56                   	push   %esi
+  8001d2:	50                   	push   %eax
+  8001d3:	68 bc 31 80 00       	push   $0x8031bc
+  8001d8:	e8 b3 00 00 00       	call   800290 <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  8001dd:	83 c4 18             	add    $0x18,%esp
+  8001e0:	53                   	push   %ebx
+  8001e1:	ff 75 10             	push   0x10(%ebp)
+  8001e4:	e8 56 00 00 00       	call   80023f <vcprintf>
+  cprintf("\n");
+  8001e9:	c7 04 24 20 36 80 00 	movl   $0x803620,(%esp)
+  8001f0:	e8 9b 00 00 00       	call   800290 <cprintf>
+  8001f5:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  8001f8:	cc                   	int3
+  while (1)
+  8001f9:	eb fd                	jmp    8001f8 <_panic+0x43>
+
+008001fb <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8001fb:	55                   	push   %ebp
+  8001fc:	89 e5                	mov    %esp,%ebp
+  8001fe:	53                   	push   %ebx
+  8001ff:	83 ec 04             	sub    $0x4,%esp
+  800202:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  800205:	8b 13                	mov    (%ebx),%edx
+  800207:	8d 42 01             	lea    0x1(%edx),%eax
+  80020a:	89 03                	mov    %eax,(%ebx)
+  80020c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80020f:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  800213:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800218:	74 09                	je     800223 <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  80021a:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80021e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800221:	c9                   	leave
+  800222:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  800223:	83 ec 08             	sub    $0x8,%esp
+  800226:	68 ff 00 00 00       	push   $0xff
+  80022b:	8d 43 08             	lea    0x8(%ebx),%eax
+  80022e:	50                   	push   %eax
+  80022f:	e8 7a 09 00 00       	call   800bae <sys_cputs>
+    b->idx = 0;
+  800234:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80023a:	83 c4 10             	add    $0x10,%esp
+  80023d:	eb db                	jmp    80021a <putch+0x1f>
+
+0080023f <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80023f:	55                   	push   %ebp
+  800240:	89 e5                	mov    %esp,%ebp
+  800242:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  800248:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80024f:	00 00 00 
+  b.cnt = 0;
+  800252:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800259:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  80025c:	ff 75 0c             	push   0xc(%ebp)
+  80025f:	ff 75 08             	push   0x8(%ebp)
+  800262:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800268:	50                   	push   %eax
+  800269:	68 fb 01 80 00       	push   $0x8001fb
+  80026e:	e8 14 01 00 00       	call   800387 <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  800273:	83 c4 08             	add    $0x8,%esp
+  800276:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80027c:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800282:	50                   	push   %eax
+  800283:	e8 26 09 00 00       	call   800bae <sys_cputs>
+
+  return b.cnt;
+}
+  800288:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80028e:	c9                   	leave
+  80028f:	c3                   	ret
+
+00800290 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800290:	55                   	push   %ebp
+  800291:	89 e5                	mov    %esp,%ebp
+  800293:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  800296:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  800299:	50                   	push   %eax
+  80029a:	ff 75 08             	push   0x8(%ebp)
+  80029d:	e8 9d ff ff ff       	call   80023f <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  8002a2:	c9                   	leave
+  8002a3:	c3                   	ret
+
+008002a4 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  8002a4:	55                   	push   %ebp
+  8002a5:	89 e5                	mov    %esp,%ebp
+  8002a7:	57                   	push   %edi
+  8002a8:	56                   	push   %esi
+  8002a9:	53                   	push   %ebx
+  8002aa:	83 ec 1c             	sub    $0x1c,%esp
+  8002ad:	89 c7                	mov    %eax,%edi
+  8002af:	89 d6                	mov    %edx,%esi
+  8002b1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002b4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8002b7:	89 d1                	mov    %edx,%ecx
+  8002b9:	89 c2                	mov    %eax,%edx
+  8002bb:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8002be:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8002c1:	8b 45 10             	mov    0x10(%ebp),%eax
+  8002c4:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  8002c7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8002ca:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8002d1:	39 c2                	cmp    %eax,%edx
+  8002d3:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8002d6:	72 3e                	jb     800316 <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  8002d8:	83 ec 0c             	sub    $0xc,%esp
+  8002db:	ff 75 18             	push   0x18(%ebp)
+  8002de:	83 eb 01             	sub    $0x1,%ebx
+  8002e1:	53                   	push   %ebx
+  8002e2:	50                   	push   %eax
+  8002e3:	83 ec 08             	sub    $0x8,%esp
+  8002e6:	ff 75 e4             	push   -0x1c(%ebp)
+  8002e9:	ff 75 e0             	push   -0x20(%ebp)
+  8002ec:	ff 75 dc             	push   -0x24(%ebp)
+  8002ef:	ff 75 d8             	push   -0x28(%ebp)
+  8002f2:	e8 ef 2b 00 00       	call   802ee6 <__udivdi3>
+  8002f7:	83 c4 18             	add    $0x18,%esp
+  8002fa:	52                   	push   %edx
+  8002fb:	50                   	push   %eax
+  8002fc:	89 f2                	mov    %esi,%edx
+  8002fe:	89 f8                	mov    %edi,%eax
+  800300:	e8 9f ff ff ff       	call   8002a4 <printnum>
+  800305:	83 c4 20             	add    $0x20,%esp
+  800308:	eb 13                	jmp    80031d <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  80030a:	83 ec 08             	sub    $0x8,%esp
+  80030d:	56                   	push   %esi
+  80030e:	ff 75 18             	push   0x18(%ebp)
+  800311:	ff d7                	call   *%edi
+  800313:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  800316:	83 eb 01             	sub    $0x1,%ebx
+  800319:	85 db                	test   %ebx,%ebx
+  80031b:	7f ed                	jg     80030a <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  80031d:	83 ec 08             	sub    $0x8,%esp
+  800320:	56                   	push   %esi
+  800321:	83 ec 04             	sub    $0x4,%esp
+  800324:	ff 75 e4             	push   -0x1c(%ebp)
+  800327:	ff 75 e0             	push   -0x20(%ebp)
+  80032a:	ff 75 dc             	push   -0x24(%ebp)
+  80032d:	ff 75 d8             	push   -0x28(%ebp)
+  800330:	e8 d2 2b 00 00       	call   802f07 <__umoddi3>
+  800335:	83 c4 14             	add    $0x14,%esp
+  800338:	0f be 80 df 31 80 00 	movsbl 0x8031df(%eax),%eax
+  80033f:	50                   	push   %eax
+  800340:	ff d7                	call   *%edi
+}
+  800342:	83 c4 10             	add    $0x10,%esp
+  800345:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800348:	5b                   	pop    %ebx
+  800349:	5e                   	pop    %esi
+  80034a:	5f                   	pop    %edi
+  80034b:	5d                   	pop    %ebp
+  80034c:	c3                   	ret
+
+0080034d <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80034d:	55                   	push   %ebp
+  80034e:	89 e5                	mov    %esp,%ebp
+  800350:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  800353:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  800357:	8b 10                	mov    (%eax),%edx
+  800359:	3b 50 04             	cmp    0x4(%eax),%edx
+  80035c:	73 0a                	jae    800368 <sprintputch+0x1b>
+    *b->buf++ = ch;
+  80035e:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800361:	89 08                	mov    %ecx,(%eax)
+  800363:	8b 45 08             	mov    0x8(%ebp),%eax
+  800366:	88 02                	mov    %al,(%edx)
+}
+  800368:	5d                   	pop    %ebp
+  800369:	c3                   	ret
+
+0080036a <printfmt>:
+{
+  80036a:	55                   	push   %ebp
+  80036b:	89 e5                	mov    %esp,%ebp
+  80036d:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  800370:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  800373:	50                   	push   %eax
+  800374:	ff 75 10             	push   0x10(%ebp)
+  800377:	ff 75 0c             	push   0xc(%ebp)
+  80037a:	ff 75 08             	push   0x8(%ebp)
+  80037d:	e8 05 00 00 00       	call   800387 <vprintfmt>
+}
+  800382:	83 c4 10             	add    $0x10,%esp
+  800385:	c9                   	leave
+  800386:	c3                   	ret
+
+00800387 <vprintfmt>:
+{
+  800387:	55                   	push   %ebp
+  800388:	89 e5                	mov    %esp,%ebp
+  80038a:	57                   	push   %edi
+  80038b:	56                   	push   %esi
+  80038c:	53                   	push   %ebx
+  80038d:	83 ec 2c             	sub    $0x2c,%esp
+  800390:	8b 75 08             	mov    0x8(%ebp),%esi
+  800393:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800396:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800399:	eb 0a                	jmp    8003a5 <vprintfmt+0x1e>
+      putch(ch, putdat);
+  80039b:	83 ec 08             	sub    $0x8,%esp
+  80039e:	53                   	push   %ebx
+  80039f:	50                   	push   %eax
+  8003a0:	ff d6                	call   *%esi
+  8003a2:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  8003a5:	83 c7 01             	add    $0x1,%edi
+  8003a8:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8003ac:	83 f8 25             	cmp    $0x25,%eax
+  8003af:	74 0c                	je     8003bd <vprintfmt+0x36>
+      if (ch == '\0')
+  8003b1:	85 c0                	test   %eax,%eax
+  8003b3:	75 e6                	jne    80039b <vprintfmt+0x14>
+}
+  8003b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003b8:	5b                   	pop    %ebx
+  8003b9:	5e                   	pop    %esi
+  8003ba:	5f                   	pop    %edi
+  8003bb:	5d                   	pop    %ebp
+  8003bc:	c3                   	ret
+    padc = ' ';
+  8003bd:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  8003c1:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  8003c8:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  8003cf:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  8003d6:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  8003db:	8d 47 01             	lea    0x1(%edi),%eax
+  8003de:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8003e1:	0f b6 17             	movzbl (%edi),%edx
+  8003e4:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8003e7:	3c 55                	cmp    $0x55,%al
+  8003e9:	0f 87 cf 03 00 00    	ja     8007be <vprintfmt+0x437>
+  8003ef:	0f b6 c0             	movzbl %al,%eax
+  8003f2:	ff 24 85 20 33 80 00 	jmp    *0x803320(,%eax,4)
+  8003f9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  8003fc:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800400:	eb d9                	jmp    8003db <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  800402:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800405:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800409:	eb d0                	jmp    8003db <vprintfmt+0x54>
+  80040b:	0f b6 d2             	movzbl %dl,%edx
+  80040e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  800411:	b8 00 00 00 00       	mov    $0x0,%eax
+  800416:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  800419:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80041c:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  800420:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  800423:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800426:	83 f9 09             	cmp    $0x9,%ecx
+  800429:	77 55                	ja     800480 <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  80042b:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  80042e:	eb e9                	jmp    800419 <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  800430:	8b 45 14             	mov    0x14(%ebp),%eax
+  800433:	8b 00                	mov    (%eax),%eax
+  800435:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800438:	8b 45 14             	mov    0x14(%ebp),%eax
+  80043b:	8d 40 04             	lea    0x4(%eax),%eax
+  80043e:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  800441:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  800444:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800448:	79 91                	jns    8003db <vprintfmt+0x54>
+        width = precision, precision = -1;
+  80044a:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80044d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800450:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800457:	eb 82                	jmp    8003db <vprintfmt+0x54>
+      if (width < 0)
+  800459:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80045c:	85 d2                	test   %edx,%edx
+  80045e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800463:	0f 49 c2             	cmovns %edx,%eax
+  800466:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  800469:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  80046c:	e9 6a ff ff ff       	jmp    8003db <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  800471:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  800474:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  80047b:	e9 5b ff ff ff       	jmp    8003db <vprintfmt+0x54>
+  800480:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800483:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800486:	eb bc                	jmp    800444 <vprintfmt+0xbd>
+      lflag++;
+  800488:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  80048b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  80048e:	e9 48 ff ff ff       	jmp    8003db <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  800493:	8b 45 14             	mov    0x14(%ebp),%eax
+  800496:	8d 78 04             	lea    0x4(%eax),%edi
+  800499:	83 ec 08             	sub    $0x8,%esp
+  80049c:	53                   	push   %ebx
+  80049d:	ff 30                	push   (%eax)
+  80049f:	ff d6                	call   *%esi
+      break;
+  8004a1:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  8004a4:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  8004a7:	e9 b1 02 00 00       	jmp    80075d <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  8004ac:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004af:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  8004b2:	8b 10                	mov    (%eax),%edx
+  8004b4:	89 d0                	mov    %edx,%eax
+  8004b6:	f7 d8                	neg    %eax
+  8004b8:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8004bb:	83 f8 10             	cmp    $0x10,%eax
+  8004be:	7f 23                	jg     8004e3 <vprintfmt+0x15c>
+  8004c0:	8b 14 85 80 34 80 00 	mov    0x803480(,%eax,4),%edx
+  8004c7:	85 d2                	test   %edx,%edx
+  8004c9:	74 18                	je     8004e3 <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  8004cb:	52                   	push   %edx
+  8004cc:	68 ca 35 80 00       	push   $0x8035ca
+  8004d1:	53                   	push   %ebx
+  8004d2:	56                   	push   %esi
+  8004d3:	e8 92 fe ff ff       	call   80036a <printfmt>
+  8004d8:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  8004db:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8004de:	e9 7a 02 00 00       	jmp    80075d <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  8004e3:	50                   	push   %eax
+  8004e4:	68 f7 31 80 00       	push   $0x8031f7
+  8004e9:	53                   	push   %ebx
+  8004ea:	56                   	push   %esi
+  8004eb:	e8 7a fe ff ff       	call   80036a <printfmt>
+  8004f0:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  8004f3:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  8004f6:	e9 62 02 00 00       	jmp    80075d <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  8004fb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004fe:	83 c0 04             	add    $0x4,%eax
+  800501:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800504:	8b 45 14             	mov    0x14(%ebp),%eax
+  800507:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  800509:	85 c9                	test   %ecx,%ecx
+  80050b:	b8 f0 31 80 00       	mov    $0x8031f0,%eax
+  800510:	0f 45 c1             	cmovne %ecx,%eax
+  800513:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  800516:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80051a:	7e 06                	jle    800522 <vprintfmt+0x19b>
+  80051c:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800520:	75 0b                	jne    80052d <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800522:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800525:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800528:	89 75 08             	mov    %esi,0x8(%ebp)
+  80052b:	eb 5c                	jmp    800589 <vprintfmt+0x202>
+  80052d:	83 ec 08             	sub    $0x8,%esp
+  800530:	ff 75 d0             	push   -0x30(%ebp)
+  800533:	ff 75 cc             	push   -0x34(%ebp)
+  800536:	e8 20 03 00 00       	call   80085b <strnlen>
+  80053b:	89 c2                	mov    %eax,%edx
+  80053d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800540:	29 d0                	sub    %edx,%eax
+  800542:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  800545:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800549:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80054c:	89 75 08             	mov    %esi,0x8(%ebp)
+  80054f:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800551:	eb 0e                	jmp    800561 <vprintfmt+0x1da>
+          putch(padc, putdat);
+  800553:	83 ec 08             	sub    $0x8,%esp
+  800556:	53                   	push   %ebx
+  800557:	57                   	push   %edi
+  800558:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  80055b:	83 ee 01             	sub    $0x1,%esi
+  80055e:	83 c4 10             	add    $0x10,%esp
+  800561:	85 f6                	test   %esi,%esi
+  800563:	7f ee                	jg     800553 <vprintfmt+0x1cc>
+  800565:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800568:	8b 75 08             	mov    0x8(%ebp),%esi
+  80056b:	85 c0                	test   %eax,%eax
+  80056d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800572:	0f 49 d0             	cmovns %eax,%edx
+  800575:	29 d0                	sub    %edx,%eax
+  800577:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80057a:	eb a6                	jmp    800522 <vprintfmt+0x19b>
+          putch(ch, putdat);
+  80057c:	83 ec 08             	sub    $0x8,%esp
+  80057f:	53                   	push   %ebx
+  800580:	52                   	push   %edx
+  800581:	ff 55 08             	call   *0x8(%ebp)
+  800584:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800587:	89 f1                	mov    %esi,%ecx
+  800589:	8d 71 01             	lea    0x1(%ecx),%esi
+  80058c:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800590:	0f be d0             	movsbl %al,%edx
+  800593:	85 d2                	test   %edx,%edx
+  800595:	74 28                	je     8005bf <vprintfmt+0x238>
+  800597:	85 ff                	test   %edi,%edi
+  800599:	78 05                	js     8005a0 <vprintfmt+0x219>
+  80059b:	83 ef 01             	sub    $0x1,%edi
+  80059e:	78 30                	js     8005d0 <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  8005a0:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8005a4:	74 d6                	je     80057c <vprintfmt+0x1f5>
+  8005a6:	0f be c0             	movsbl %al,%eax
+  8005a9:	83 e8 20             	sub    $0x20,%eax
+  8005ac:	83 f8 5e             	cmp    $0x5e,%eax
+  8005af:	76 cb                	jbe    80057c <vprintfmt+0x1f5>
+          putch('?', putdat);
+  8005b1:	83 ec 08             	sub    $0x8,%esp
+  8005b4:	53                   	push   %ebx
+  8005b5:	6a 3f                	push   $0x3f
+  8005b7:	ff 55 08             	call   *0x8(%ebp)
+  8005ba:	83 c4 10             	add    $0x10,%esp
+  8005bd:	eb c8                	jmp    800587 <vprintfmt+0x200>
+  8005bf:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005c2:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8005c5:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8005c8:	01 d0                	add    %edx,%eax
+  8005ca:	29 c8                	sub    %ecx,%eax
+  8005cc:	89 c7                	mov    %eax,%edi
+  8005ce:	eb 13                	jmp    8005e3 <vprintfmt+0x25c>
+  8005d0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005d3:	eb ed                	jmp    8005c2 <vprintfmt+0x23b>
+        putch(' ', putdat);
+  8005d5:	83 ec 08             	sub    $0x8,%esp
+  8005d8:	53                   	push   %ebx
+  8005d9:	6a 20                	push   $0x20
+  8005db:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  8005dd:	83 ef 01             	sub    $0x1,%edi
+  8005e0:	83 c4 10             	add    $0x10,%esp
+  8005e3:	85 ff                	test   %edi,%edi
+  8005e5:	7f ee                	jg     8005d5 <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  8005e7:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8005ea:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005ed:	e9 6b 01 00 00       	jmp    80075d <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  8005f2:	83 f9 01             	cmp    $0x1,%ecx
+  8005f5:	7f 1f                	jg     800616 <vprintfmt+0x28f>
+  else if (lflag)
+  8005f7:	85 c9                	test   %ecx,%ecx
+  8005f9:	74 67                	je     800662 <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  8005fb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005fe:	8b 00                	mov    (%eax),%eax
+  800600:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800603:	89 c1                	mov    %eax,%ecx
+  800605:	c1 f9 1f             	sar    $0x1f,%ecx
+  800608:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80060b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060e:	8d 40 04             	lea    0x4(%eax),%eax
+  800611:	89 45 14             	mov    %eax,0x14(%ebp)
+  800614:	eb 17                	jmp    80062d <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  800616:	8b 45 14             	mov    0x14(%ebp),%eax
+  800619:	8b 50 04             	mov    0x4(%eax),%edx
+  80061c:	8b 00                	mov    (%eax),%eax
+  80061e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800621:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800624:	8b 45 14             	mov    0x14(%ebp),%eax
+  800627:	8d 40 08             	lea    0x8(%eax),%eax
+  80062a:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  80062d:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800630:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  800633:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  800638:	85 c9                	test   %ecx,%ecx
+  80063a:	0f 89 03 01 00 00    	jns    800743 <vprintfmt+0x3bc>
+        putch('-', putdat);
+  800640:	83 ec 08             	sub    $0x8,%esp
+  800643:	53                   	push   %ebx
+  800644:	6a 2d                	push   $0x2d
+  800646:	ff d6                	call   *%esi
+        num = -(long long)num;
+  800648:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80064b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80064e:	f7 da                	neg    %edx
+  800650:	83 d1 00             	adc    $0x0,%ecx
+  800653:	f7 d9                	neg    %ecx
+  800655:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  800658:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80065d:	e9 e1 00 00 00       	jmp    800743 <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  800662:	8b 45 14             	mov    0x14(%ebp),%eax
+  800665:	8b 00                	mov    (%eax),%eax
+  800667:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80066a:	89 c1                	mov    %eax,%ecx
+  80066c:	c1 f9 1f             	sar    $0x1f,%ecx
+  80066f:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800672:	8b 45 14             	mov    0x14(%ebp),%eax
+  800675:	8d 40 04             	lea    0x4(%eax),%eax
+  800678:	89 45 14             	mov    %eax,0x14(%ebp)
+  80067b:	eb b0                	jmp    80062d <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  80067d:	83 f9 01             	cmp    $0x1,%ecx
+  800680:	7f 1e                	jg     8006a0 <vprintfmt+0x319>
+  else if (lflag)
+  800682:	85 c9                	test   %ecx,%ecx
+  800684:	74 32                	je     8006b8 <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  800686:	8b 45 14             	mov    0x14(%ebp),%eax
+  800689:	8b 10                	mov    (%eax),%edx
+  80068b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800690:	8d 40 04             	lea    0x4(%eax),%eax
+  800693:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800696:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  80069b:	e9 a3 00 00 00       	jmp    800743 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  8006a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a3:	8b 10                	mov    (%eax),%edx
+  8006a5:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006a8:	8d 40 08             	lea    0x8(%eax),%eax
+  8006ab:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  8006ae:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  8006b3:	e9 8b 00 00 00       	jmp    800743 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8006b8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006bb:	8b 10                	mov    (%eax),%edx
+  8006bd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006c2:	8d 40 04             	lea    0x4(%eax),%eax
+  8006c5:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  8006c8:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  8006cd:	eb 74                	jmp    800743 <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  8006cf:	83 f9 01             	cmp    $0x1,%ecx
+  8006d2:	7f 1b                	jg     8006ef <vprintfmt+0x368>
+  else if (lflag)
+  8006d4:	85 c9                	test   %ecx,%ecx
+  8006d6:	74 2c                	je     800704 <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  8006d8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006db:	8b 10                	mov    (%eax),%edx
+  8006dd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006e2:	8d 40 04             	lea    0x4(%eax),%eax
+  8006e5:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8006e8:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  8006ed:	eb 54                	jmp    800743 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  8006ef:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f2:	8b 10                	mov    (%eax),%edx
+  8006f4:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006f7:	8d 40 08             	lea    0x8(%eax),%eax
+  8006fa:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8006fd:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  800702:	eb 3f                	jmp    800743 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800704:	8b 45 14             	mov    0x14(%ebp),%eax
+  800707:	8b 10                	mov    (%eax),%edx
+  800709:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80070e:	8d 40 04             	lea    0x4(%eax),%eax
+  800711:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800714:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  800719:	eb 28                	jmp    800743 <vprintfmt+0x3bc>
+      putch('0', putdat);
+  80071b:	83 ec 08             	sub    $0x8,%esp
+  80071e:	53                   	push   %ebx
+  80071f:	6a 30                	push   $0x30
+  800721:	ff d6                	call   *%esi
+      putch('x', putdat);
+  800723:	83 c4 08             	add    $0x8,%esp
+  800726:	53                   	push   %ebx
+  800727:	6a 78                	push   $0x78
+  800729:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  80072b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80072e:	8b 10                	mov    (%eax),%edx
+  800730:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  800735:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  800738:	8d 40 04             	lea    0x4(%eax),%eax
+  80073b:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  80073e:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  800743:	83 ec 0c             	sub    $0xc,%esp
+  800746:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80074a:	50                   	push   %eax
+  80074b:	ff 75 e0             	push   -0x20(%ebp)
+  80074e:	57                   	push   %edi
+  80074f:	51                   	push   %ecx
+  800750:	52                   	push   %edx
+  800751:	89 da                	mov    %ebx,%edx
+  800753:	89 f0                	mov    %esi,%eax
+  800755:	e8 4a fb ff ff       	call   8002a4 <printnum>
+      break;
+  80075a:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  80075d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  800760:	e9 40 fc ff ff       	jmp    8003a5 <vprintfmt+0x1e>
+  if (lflag >= 2)
+  800765:	83 f9 01             	cmp    $0x1,%ecx
+  800768:	7f 1b                	jg     800785 <vprintfmt+0x3fe>
+  else if (lflag)
+  80076a:	85 c9                	test   %ecx,%ecx
+  80076c:	74 2c                	je     80079a <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  80076e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800771:	8b 10                	mov    (%eax),%edx
+  800773:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800778:	8d 40 04             	lea    0x4(%eax),%eax
+  80077b:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  80077e:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  800783:	eb be                	jmp    800743 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800785:	8b 45 14             	mov    0x14(%ebp),%eax
+  800788:	8b 10                	mov    (%eax),%edx
+  80078a:	8b 48 04             	mov    0x4(%eax),%ecx
+  80078d:	8d 40 08             	lea    0x8(%eax),%eax
+  800790:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800793:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  800798:	eb a9                	jmp    800743 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  80079a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80079d:	8b 10                	mov    (%eax),%edx
+  80079f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007a4:	8d 40 04             	lea    0x4(%eax),%eax
+  8007a7:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8007aa:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  8007af:	eb 92                	jmp    800743 <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  8007b1:	83 ec 08             	sub    $0x8,%esp
+  8007b4:	53                   	push   %ebx
+  8007b5:	6a 25                	push   $0x25
+  8007b7:	ff d6                	call   *%esi
+      break;
+  8007b9:	83 c4 10             	add    $0x10,%esp
+  8007bc:	eb 9f                	jmp    80075d <vprintfmt+0x3d6>
+      putch('%', putdat);
+  8007be:	83 ec 08             	sub    $0x8,%esp
+  8007c1:	53                   	push   %ebx
+  8007c2:	6a 25                	push   $0x25
+  8007c4:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  8007c6:	83 c4 10             	add    $0x10,%esp
+  8007c9:	89 f8                	mov    %edi,%eax
+  8007cb:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8007cf:	74 05                	je     8007d6 <vprintfmt+0x44f>
+  8007d1:	83 e8 01             	sub    $0x1,%eax
+  8007d4:	eb f5                	jmp    8007cb <vprintfmt+0x444>
+  8007d6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8007d9:	eb 82                	jmp    80075d <vprintfmt+0x3d6>
+
+008007db <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8007db:	55                   	push   %ebp
+  8007dc:	89 e5                	mov    %esp,%ebp
+  8007de:	83 ec 18             	sub    $0x18,%esp
+  8007e1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007e4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  8007e7:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8007ea:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8007ee:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8007f1:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  8007f8:	85 c0                	test   %eax,%eax
+  8007fa:	74 26                	je     800822 <vsnprintf+0x47>
+  8007fc:	85 d2                	test   %edx,%edx
+  8007fe:	7e 22                	jle    800822 <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800800:	ff 75 14             	push   0x14(%ebp)
+  800803:	ff 75 10             	push   0x10(%ebp)
+  800806:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800809:	50                   	push   %eax
+  80080a:	68 4d 03 80 00       	push   $0x80034d
+  80080f:	e8 73 fb ff ff       	call   800387 <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800814:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800817:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  80081a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80081d:	83 c4 10             	add    $0x10,%esp
+}
+  800820:	c9                   	leave
+  800821:	c3                   	ret
+    return -E_INVAL;
+  800822:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800827:	eb f7                	jmp    800820 <vsnprintf+0x45>
+
+00800829 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800829:	55                   	push   %ebp
+  80082a:	89 e5                	mov    %esp,%ebp
+  80082c:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  80082f:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  800832:	50                   	push   %eax
+  800833:	ff 75 10             	push   0x10(%ebp)
+  800836:	ff 75 0c             	push   0xc(%ebp)
+  800839:	ff 75 08             	push   0x8(%ebp)
+  80083c:	e8 9a ff ff ff       	call   8007db <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  800841:	c9                   	leave
+  800842:	c3                   	ret
+
+00800843 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800843:	55                   	push   %ebp
+  800844:	89 e5                	mov    %esp,%ebp
+  800846:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  800849:	b8 00 00 00 00       	mov    $0x0,%eax
+  80084e:	eb 03                	jmp    800853 <strlen+0x10>
+    n++;
+  800850:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  800853:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800857:	75 f7                	jne    800850 <strlen+0xd>
+  return n;
+}
+  800859:	5d                   	pop    %ebp
+  80085a:	c3                   	ret
+
+0080085b <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80085b:	55                   	push   %ebp
+  80085c:	89 e5                	mov    %esp,%ebp
+  80085e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800861:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800864:	b8 00 00 00 00       	mov    $0x0,%eax
+  800869:	eb 03                	jmp    80086e <strnlen+0x13>
+    n++;
+  80086b:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80086e:	39 d0                	cmp    %edx,%eax
+  800870:	74 08                	je     80087a <strnlen+0x1f>
+  800872:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800876:	75 f3                	jne    80086b <strnlen+0x10>
+  800878:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  80087a:	89 d0                	mov    %edx,%eax
+  80087c:	5d                   	pop    %ebp
+  80087d:	c3                   	ret
+
+0080087e <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80087e:	55                   	push   %ebp
+  80087f:	89 e5                	mov    %esp,%ebp
+  800881:	53                   	push   %ebx
+  800882:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800885:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  800888:	b8 00 00 00 00       	mov    $0x0,%eax
+  80088d:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800891:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800894:	83 c0 01             	add    $0x1,%eax
+  800897:	84 d2                	test   %dl,%dl
+  800899:	75 f2                	jne    80088d <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  80089b:	89 c8                	mov    %ecx,%eax
+  80089d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008a0:	c9                   	leave
+  8008a1:	c3                   	ret
+
+008008a2 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8008a2:	55                   	push   %ebp
+  8008a3:	89 e5                	mov    %esp,%ebp
+  8008a5:	53                   	push   %ebx
+  8008a6:	83 ec 10             	sub    $0x10,%esp
+  8008a9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  8008ac:	53                   	push   %ebx
+  8008ad:	e8 91 ff ff ff       	call   800843 <strlen>
+  8008b2:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  8008b5:	ff 75 0c             	push   0xc(%ebp)
+  8008b8:	01 d8                	add    %ebx,%eax
+  8008ba:	50                   	push   %eax
+  8008bb:	e8 be ff ff ff       	call   80087e <strcpy>
+  return dst;
+}
+  8008c0:	89 d8                	mov    %ebx,%eax
+  8008c2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008c5:	c9                   	leave
+  8008c6:	c3                   	ret
+
+008008c7 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  8008c7:	55                   	push   %ebp
+  8008c8:	89 e5                	mov    %esp,%ebp
+  8008ca:	56                   	push   %esi
+  8008cb:	53                   	push   %ebx
+  8008cc:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008cf:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  8008d2:	89 f3                	mov    %esi,%ebx
+  8008d4:	03 5d 10             	add    0x10(%ebp),%ebx
+  8008d7:	89 f0                	mov    %esi,%eax
+  8008d9:	eb 0f                	jmp    8008ea <strncpy+0x23>
+    *dst++ = *src;
+  8008db:	83 c0 01             	add    $0x1,%eax
+  8008de:	0f b6 0a             	movzbl (%edx),%ecx
+  8008e1:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  8008e4:	80 f9 01             	cmp    $0x1,%cl
+  8008e7:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  8008ea:	39 d8                	cmp    %ebx,%eax
+  8008ec:	75 ed                	jne    8008db <strncpy+0x14>
+  }
+  return ret;
+}
+  8008ee:	89 f0                	mov    %esi,%eax
+  8008f0:	5b                   	pop    %ebx
+  8008f1:	5e                   	pop    %esi
+  8008f2:	5d                   	pop    %ebp
+  8008f3:	c3                   	ret
+
+008008f4 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8008f4:	55                   	push   %ebp
+  8008f5:	89 e5                	mov    %esp,%ebp
+  8008f7:	56                   	push   %esi
+  8008f8:	53                   	push   %ebx
+  8008f9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008fc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008ff:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  800902:	89 f0                	mov    %esi,%eax
+  800904:	85 d2                	test   %edx,%edx
+  800906:	74 21                	je     800929 <strlcpy+0x35>
+  800908:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80090c:	89 f2                	mov    %esi,%edx
+  80090e:	eb 09                	jmp    800919 <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  800910:	83 c1 01             	add    $0x1,%ecx
+  800913:	83 c2 01             	add    $0x1,%edx
+  800916:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  800919:	39 c2                	cmp    %eax,%edx
+  80091b:	74 09                	je     800926 <strlcpy+0x32>
+  80091d:	0f b6 19             	movzbl (%ecx),%ebx
+  800920:	84 db                	test   %bl,%bl
+  800922:	75 ec                	jne    800910 <strlcpy+0x1c>
+  800924:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  800926:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  800929:	29 f0                	sub    %esi,%eax
+}
+  80092b:	5b                   	pop    %ebx
+  80092c:	5e                   	pop    %esi
+  80092d:	5d                   	pop    %ebp
+  80092e:	c3                   	ret
+
+0080092f <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80092f:	55                   	push   %ebp
+  800930:	89 e5                	mov    %esp,%ebp
+  800932:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800935:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  800938:	eb 06                	jmp    800940 <strcmp+0x11>
+    p++, q++;
+  80093a:	83 c1 01             	add    $0x1,%ecx
+  80093d:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  800940:	0f b6 01             	movzbl (%ecx),%eax
+  800943:	84 c0                	test   %al,%al
+  800945:	74 04                	je     80094b <strcmp+0x1c>
+  800947:	3a 02                	cmp    (%edx),%al
+  800949:	74 ef                	je     80093a <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  80094b:	0f b6 c0             	movzbl %al,%eax
+  80094e:	0f b6 12             	movzbl (%edx),%edx
+  800951:	29 d0                	sub    %edx,%eax
+}
+  800953:	5d                   	pop    %ebp
+  800954:	c3                   	ret
+
+00800955 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800955:	55                   	push   %ebp
+  800956:	89 e5                	mov    %esp,%ebp
+  800958:	53                   	push   %ebx
+  800959:	8b 45 08             	mov    0x8(%ebp),%eax
+  80095c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80095f:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  800962:	eb 09                	jmp    80096d <strncmp+0x18>
+    n--, p++, q++;
+  800964:	83 ea 01             	sub    $0x1,%edx
+  800967:	83 c0 01             	add    $0x1,%eax
+  80096a:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  80096d:	85 d2                	test   %edx,%edx
+  80096f:	74 18                	je     800989 <strncmp+0x34>
+  800971:	0f b6 18             	movzbl (%eax),%ebx
+  800974:	84 db                	test   %bl,%bl
+  800976:	74 04                	je     80097c <strncmp+0x27>
+  800978:	3a 19                	cmp    (%ecx),%bl
+  80097a:	74 e8                	je     800964 <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80097c:	0f b6 00             	movzbl (%eax),%eax
+  80097f:	0f b6 11             	movzbl (%ecx),%edx
+  800982:	29 d0                	sub    %edx,%eax
+}
+  800984:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800987:	c9                   	leave
+  800988:	c3                   	ret
+    return 0;
+  800989:	b8 00 00 00 00       	mov    $0x0,%eax
+  80098e:	eb f4                	jmp    800984 <strncmp+0x2f>
+
+00800990 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800990:	55                   	push   %ebp
+  800991:	89 e5                	mov    %esp,%ebp
+  800993:	8b 45 08             	mov    0x8(%ebp),%eax
+  800996:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  80099a:	eb 03                	jmp    80099f <strchr+0xf>
+  80099c:	83 c0 01             	add    $0x1,%eax
+  80099f:	0f b6 10             	movzbl (%eax),%edx
+  8009a2:	84 d2                	test   %dl,%dl
+  8009a4:	74 06                	je     8009ac <strchr+0x1c>
+    if (*s == c)
+  8009a6:	38 ca                	cmp    %cl,%dl
+  8009a8:	75 f2                	jne    80099c <strchr+0xc>
+  8009aa:	eb 05                	jmp    8009b1 <strchr+0x21>
+      return (char*)s;
+  return 0;
+  8009ac:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009b1:	5d                   	pop    %ebp
+  8009b2:	c3                   	ret
+
+008009b3 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8009b3:	55                   	push   %ebp
+  8009b4:	89 e5                	mov    %esp,%ebp
+  8009b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009b9:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  8009bd:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  8009c0:	38 ca                	cmp    %cl,%dl
+  8009c2:	74 09                	je     8009cd <strfind+0x1a>
+  8009c4:	84 d2                	test   %dl,%dl
+  8009c6:	74 05                	je     8009cd <strfind+0x1a>
+  for (; *s; s++)
+  8009c8:	83 c0 01             	add    $0x1,%eax
+  8009cb:	eb f0                	jmp    8009bd <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  8009cd:	5d                   	pop    %ebp
+  8009ce:	c3                   	ret
+
+008009cf <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8009cf:	55                   	push   %ebp
+  8009d0:	89 e5                	mov    %esp,%ebp
+  8009d2:	57                   	push   %edi
+  8009d3:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8009d6:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  8009d9:	85 c9                	test   %ecx,%ecx
+  8009db:	74 20                	je     8009fd <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  8009dd:	89 f8                	mov    %edi,%eax
+  8009df:	09 c8                	or     %ecx,%eax
+  8009e1:	a8 03                	test   $0x3,%al
+  8009e3:	75 12                	jne    8009f7 <memset+0x28>
+    c &= 0xFF;
+  8009e5:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8009e9:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  8009ef:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  8009f2:	fc                   	cld
+  8009f3:	f3 ab                	rep stos %eax,%es:(%edi)
+  8009f5:	eb 06                	jmp    8009fd <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  8009f7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8009fa:	fc                   	cld
+  8009fb:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  8009fd:	89 f8                	mov    %edi,%eax
+  8009ff:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a02:	c9                   	leave
+  800a03:	c3                   	ret
+
+00800a04 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a04:	55                   	push   %ebp
+  800a05:	89 e5                	mov    %esp,%ebp
+  800a07:	57                   	push   %edi
+  800a08:	56                   	push   %esi
+  800a09:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a0c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a0f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  800a12:	39 c6                	cmp    %eax,%esi
+  800a14:	73 32                	jae    800a48 <memmove+0x44>
+  800a16:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a19:	39 d0                	cmp    %edx,%eax
+  800a1b:	73 2b                	jae    800a48 <memmove+0x44>
+    s += n;
+    d += n;
+  800a1d:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a20:	89 d6                	mov    %edx,%esi
+  800a22:	09 fe                	or     %edi,%esi
+  800a24:	09 ce                	or     %ecx,%esi
+  800a26:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a2c:	75 0e                	jne    800a3c <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a2e:	83 ef 04             	sub    $0x4,%edi
+  800a31:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a34:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  800a37:	fd                   	std
+  800a38:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a3a:	eb 09                	jmp    800a45 <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a3c:	83 ef 01             	sub    $0x1,%edi
+  800a3f:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  800a42:	fd                   	std
+  800a43:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  800a45:	fc                   	cld
+  800a46:	eb 1a                	jmp    800a62 <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a48:	89 f2                	mov    %esi,%edx
+  800a4a:	09 c2                	or     %eax,%edx
+  800a4c:	09 ca                	or     %ecx,%edx
+  800a4e:	f6 c2 03             	test   $0x3,%dl
+  800a51:	75 0a                	jne    800a5d <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a53:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  800a56:	89 c7                	mov    %eax,%edi
+  800a58:	fc                   	cld
+  800a59:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a5b:	eb 05                	jmp    800a62 <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  800a5d:	89 c7                	mov    %eax,%edi
+  800a5f:	fc                   	cld
+  800a60:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  800a62:	5e                   	pop    %esi
+  800a63:	5f                   	pop    %edi
+  800a64:	5d                   	pop    %ebp
+  800a65:	c3                   	ret
+
+00800a66 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a66:	55                   	push   %ebp
+  800a67:	89 e5                	mov    %esp,%ebp
+  800a69:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  800a6c:	ff 75 10             	push   0x10(%ebp)
+  800a6f:	ff 75 0c             	push   0xc(%ebp)
+  800a72:	ff 75 08             	push   0x8(%ebp)
+  800a75:	e8 8a ff ff ff       	call   800a04 <memmove>
+}
+  800a7a:	c9                   	leave
+  800a7b:	c3                   	ret
+
+00800a7c <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a7c:	55                   	push   %ebp
+  800a7d:	89 e5                	mov    %esp,%ebp
+  800a7f:	56                   	push   %esi
+  800a80:	53                   	push   %ebx
+  800a81:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a84:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  800a87:	89 c6                	mov    %eax,%esi
+  800a89:	03 75 10             	add    0x10(%ebp),%esi
+  800a8c:	eb 06                	jmp    800a94 <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  800a8e:	83 c0 01             	add    $0x1,%eax
+  800a91:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  800a94:	39 f0                	cmp    %esi,%eax
+  800a96:	74 14                	je     800aac <memcmp+0x30>
+    if (*s1 != *s2)
+  800a98:	0f b6 08             	movzbl (%eax),%ecx
+  800a9b:	0f b6 1a             	movzbl (%edx),%ebx
+  800a9e:	38 d9                	cmp    %bl,%cl
+  800aa0:	74 ec                	je     800a8e <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  800aa2:	0f b6 c1             	movzbl %cl,%eax
+  800aa5:	0f b6 db             	movzbl %bl,%ebx
+  800aa8:	29 d8                	sub    %ebx,%eax
+  800aaa:	eb 05                	jmp    800ab1 <memcmp+0x35>
+  }
+
+  return 0;
+  800aac:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ab1:	5b                   	pop    %ebx
+  800ab2:	5e                   	pop    %esi
+  800ab3:	5d                   	pop    %ebp
+  800ab4:	c3                   	ret
+
+00800ab5 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800ab5:	55                   	push   %ebp
+  800ab6:	89 e5                	mov    %esp,%ebp
+  800ab8:	8b 45 08             	mov    0x8(%ebp),%eax
+  800abb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  800abe:	89 c2                	mov    %eax,%edx
+  800ac0:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  800ac3:	eb 03                	jmp    800ac8 <memfind+0x13>
+  800ac5:	83 c0 01             	add    $0x1,%eax
+  800ac8:	39 d0                	cmp    %edx,%eax
+  800aca:	73 04                	jae    800ad0 <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  800acc:	38 08                	cmp    %cl,(%eax)
+  800ace:	75 f5                	jne    800ac5 <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  800ad0:	5d                   	pop    %ebp
+  800ad1:	c3                   	ret
+
+00800ad2 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800ad2:	55                   	push   %ebp
+  800ad3:	89 e5                	mov    %esp,%ebp
+  800ad5:	57                   	push   %edi
+  800ad6:	56                   	push   %esi
+  800ad7:	53                   	push   %ebx
+  800ad8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800adb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  800ade:	eb 03                	jmp    800ae3 <strtol+0x11>
+    s++;
+  800ae0:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  800ae3:	0f b6 02             	movzbl (%edx),%eax
+  800ae6:	3c 20                	cmp    $0x20,%al
+  800ae8:	74 f6                	je     800ae0 <strtol+0xe>
+  800aea:	3c 09                	cmp    $0x9,%al
+  800aec:	74 f2                	je     800ae0 <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  800aee:	3c 2b                	cmp    $0x2b,%al
+  800af0:	74 2a                	je     800b1c <strtol+0x4a>
+  int neg = 0;
+  800af2:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  800af7:	3c 2d                	cmp    $0x2d,%al
+  800af9:	74 2b                	je     800b26 <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800afb:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b01:	75 0f                	jne    800b12 <strtol+0x40>
+  800b03:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b06:	74 28                	je     800b30 <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  800b08:	85 db                	test   %ebx,%ebx
+  800b0a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b0f:	0f 44 d8             	cmove  %eax,%ebx
+  800b12:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b17:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b1a:	eb 46                	jmp    800b62 <strtol+0x90>
+    s++;
+  800b1c:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  800b1f:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b24:	eb d5                	jmp    800afb <strtol+0x29>
+    s++, neg = 1;
+  800b26:	83 c2 01             	add    $0x1,%edx
+  800b29:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b2e:	eb cb                	jmp    800afb <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b30:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800b34:	74 0e                	je     800b44 <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  800b36:	85 db                	test   %ebx,%ebx
+  800b38:	75 d8                	jne    800b12 <strtol+0x40>
+    s++, base = 8;
+  800b3a:	83 c2 01             	add    $0x1,%edx
+  800b3d:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800b42:	eb ce                	jmp    800b12 <strtol+0x40>
+    s += 2, base = 16;
+  800b44:	83 c2 02             	add    $0x2,%edx
+  800b47:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800b4c:	eb c4                	jmp    800b12 <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  800b4e:	0f be c0             	movsbl %al,%eax
+  800b51:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  800b54:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800b57:	7d 3a                	jge    800b93 <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  800b59:	83 c2 01             	add    $0x1,%edx
+  800b5c:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800b60:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  800b62:	0f b6 02             	movzbl (%edx),%eax
+  800b65:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800b68:	89 f3                	mov    %esi,%ebx
+  800b6a:	80 fb 09             	cmp    $0x9,%bl
+  800b6d:	76 df                	jbe    800b4e <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  800b6f:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800b72:	89 f3                	mov    %esi,%ebx
+  800b74:	80 fb 19             	cmp    $0x19,%bl
+  800b77:	77 08                	ja     800b81 <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  800b79:	0f be c0             	movsbl %al,%eax
+  800b7c:	83 e8 57             	sub    $0x57,%eax
+  800b7f:	eb d3                	jmp    800b54 <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  800b81:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800b84:	89 f3                	mov    %esi,%ebx
+  800b86:	80 fb 19             	cmp    $0x19,%bl
+  800b89:	77 08                	ja     800b93 <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  800b8b:	0f be c0             	movsbl %al,%eax
+  800b8e:	83 e8 37             	sub    $0x37,%eax
+  800b91:	eb c1                	jmp    800b54 <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  800b93:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b97:	74 05                	je     800b9e <strtol+0xcc>
+    *endptr = (char*)s;
+  800b99:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b9c:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  800b9e:	89 c8                	mov    %ecx,%eax
+  800ba0:	f7 d8                	neg    %eax
+  800ba2:	85 ff                	test   %edi,%edi
+  800ba4:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800ba7:	89 c8                	mov    %ecx,%eax
+  800ba9:	5b                   	pop    %ebx
+  800baa:	5e                   	pop    %esi
+  800bab:	5f                   	pop    %edi
+  800bac:	5d                   	pop    %ebp
+  800bad:	c3                   	ret
+
+00800bae <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800bae:	55                   	push   %ebp
+  800baf:	89 e5                	mov    %esp,%ebp
+  800bb1:	57                   	push   %edi
+  800bb2:	56                   	push   %esi
+  800bb3:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800bb4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bb9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bbc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bbf:	89 c3                	mov    %eax,%ebx
+  800bc1:	89 c7                	mov    %eax,%edi
+  800bc3:	89 c6                	mov    %eax,%esi
+  800bc5:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800bc7:	5b                   	pop    %ebx
+  800bc8:	5e                   	pop    %esi
+  800bc9:	5f                   	pop    %edi
+  800bca:	5d                   	pop    %ebp
+  800bcb:	c3                   	ret
+
+00800bcc <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800bcc:	55                   	push   %ebp
+  800bcd:	89 e5                	mov    %esp,%ebp
+  800bcf:	57                   	push   %edi
+  800bd0:	56                   	push   %esi
+  800bd1:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800bd2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bd7:	b8 01 00 00 00       	mov    $0x1,%eax
+  800bdc:	89 d1                	mov    %edx,%ecx
+  800bde:	89 d3                	mov    %edx,%ebx
+  800be0:	89 d7                	mov    %edx,%edi
+  800be2:	89 d6                	mov    %edx,%esi
+  800be4:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800be6:	5b                   	pop    %ebx
+  800be7:	5e                   	pop    %esi
+  800be8:	5f                   	pop    %edi
+  800be9:	5d                   	pop    %ebp
+  800bea:	c3                   	ret
+
+00800beb <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800beb:	55                   	push   %ebp
+  800bec:	89 e5                	mov    %esp,%ebp
+  800bee:	57                   	push   %edi
+  800bef:	56                   	push   %esi
+  800bf0:	53                   	push   %ebx
+  800bf1:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800bf4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bf9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bfc:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c01:	89 cb                	mov    %ecx,%ebx
+  800c03:	89 cf                	mov    %ecx,%edi
+  800c05:	89 ce                	mov    %ecx,%esi
+  800c07:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c09:	85 c0                	test   %eax,%eax
+  800c0b:	7f 08                	jg     800c15 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800c0d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c10:	5b                   	pop    %ebx
+  800c11:	5e                   	pop    %esi
+  800c12:	5f                   	pop    %edi
+  800c13:	5d                   	pop    %ebp
+  800c14:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c15:	83 ec 0c             	sub    $0xc,%esp
+  800c18:	50                   	push   %eax
+  800c19:	6a 03                	push   $0x3
+  800c1b:	68 e3 34 80 00       	push   $0x8034e3
+  800c20:	6a 23                	push   $0x23
+  800c22:	68 00 35 80 00       	push   $0x803500
+  800c27:	e8 89 f5 ff ff       	call   8001b5 <_panic>
+
+00800c2c <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800c2c:	55                   	push   %ebp
+  800c2d:	89 e5                	mov    %esp,%ebp
+  800c2f:	57                   	push   %edi
+  800c30:	56                   	push   %esi
+  800c31:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800c32:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c37:	b8 02 00 00 00       	mov    $0x2,%eax
+  800c3c:	89 d1                	mov    %edx,%ecx
+  800c3e:	89 d3                	mov    %edx,%ebx
+  800c40:	89 d7                	mov    %edx,%edi
+  800c42:	89 d6                	mov    %edx,%esi
+  800c44:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800c46:	5b                   	pop    %ebx
+  800c47:	5e                   	pop    %esi
+  800c48:	5f                   	pop    %edi
+  800c49:	5d                   	pop    %ebp
+  800c4a:	c3                   	ret
+
+00800c4b <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800c4b:	55                   	push   %ebp
+  800c4c:	89 e5                	mov    %esp,%ebp
+  800c4e:	57                   	push   %edi
+  800c4f:	56                   	push   %esi
+  800c50:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800c51:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c56:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800c5b:	89 d1                	mov    %edx,%ecx
+  800c5d:	89 d3                	mov    %edx,%ebx
+  800c5f:	89 d7                	mov    %edx,%edi
+  800c61:	89 d6                	mov    %edx,%esi
+  800c63:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800c65:	5b                   	pop    %ebx
+  800c66:	5e                   	pop    %esi
+  800c67:	5f                   	pop    %edi
+  800c68:	5d                   	pop    %ebp
+  800c69:	c3                   	ret
+
+00800c6a <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  800c6a:	55                   	push   %ebp
+  800c6b:	89 e5                	mov    %esp,%ebp
+  800c6d:	57                   	push   %edi
+  800c6e:	56                   	push   %esi
+  800c6f:	53                   	push   %ebx
+  800c70:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  800c73:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  800c77:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c7c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c7f:	b8 14 00 00 00       	mov    $0x14,%eax
+  800c84:	89 df                	mov    %ebx,%edi
+  800c86:	89 de                	mov    %ebx,%esi
+  800c88:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c8a:	85 c0                	test   %eax,%eax
+  800c8c:	7f 08                	jg     800c96 <sys_env_set_cow+0x2c>
+}
+  800c8e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c91:	5b                   	pop    %ebx
+  800c92:	5e                   	pop    %esi
+  800c93:	5f                   	pop    %edi
+  800c94:	5d                   	pop    %ebp
+  800c95:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c96:	83 ec 0c             	sub    $0xc,%esp
+  800c99:	50                   	push   %eax
+  800c9a:	6a 14                	push   $0x14
+  800c9c:	68 e3 34 80 00       	push   $0x8034e3
+  800ca1:	6a 23                	push   $0x23
+  800ca3:	68 00 35 80 00       	push   $0x803500
+  800ca8:	e8 08 f5 ff ff       	call   8001b5 <_panic>
+
+00800cad <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800cad:	55                   	push   %ebp
+  800cae:	89 e5                	mov    %esp,%ebp
+  800cb0:	57                   	push   %edi
+  800cb1:	56                   	push   %esi
+  800cb2:	53                   	push   %ebx
+  800cb3:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800cb6:	be 00 00 00 00       	mov    $0x0,%esi
+  800cbb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cbe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cc1:	b8 04 00 00 00       	mov    $0x4,%eax
+  800cc6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cc9:	89 f7                	mov    %esi,%edi
+  800ccb:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ccd:	85 c0                	test   %eax,%eax
+  800ccf:	7f 08                	jg     800cd9 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  800cd1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cd4:	5b                   	pop    %ebx
+  800cd5:	5e                   	pop    %esi
+  800cd6:	5f                   	pop    %edi
+  800cd7:	5d                   	pop    %ebp
+  800cd8:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800cd9:	83 ec 0c             	sub    $0xc,%esp
+  800cdc:	50                   	push   %eax
+  800cdd:	6a 04                	push   $0x4
+  800cdf:	68 e3 34 80 00       	push   $0x8034e3
+  800ce4:	6a 23                	push   $0x23
+  800ce6:	68 00 35 80 00       	push   $0x803500
+  800ceb:	e8 c5 f4 ff ff       	call   8001b5 <_panic>
+
+00800cf0 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800cf0:	55                   	push   %ebp
+  800cf1:	89 e5                	mov    %esp,%ebp
+  800cf3:	57                   	push   %edi
+  800cf4:	56                   	push   %esi
+  800cf5:	53                   	push   %ebx
+  800cf6:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800cf9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cfc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cff:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d04:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d07:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d0a:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d0d:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d0f:	85 c0                	test   %eax,%eax
+  800d11:	7f 08                	jg     800d1b <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  800d13:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d16:	5b                   	pop    %ebx
+  800d17:	5e                   	pop    %esi
+  800d18:	5f                   	pop    %edi
+  800d19:	5d                   	pop    %ebp
+  800d1a:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d1b:	83 ec 0c             	sub    $0xc,%esp
+  800d1e:	50                   	push   %eax
+  800d1f:	6a 05                	push   $0x5
+  800d21:	68 e3 34 80 00       	push   $0x8034e3
+  800d26:	6a 23                	push   $0x23
+  800d28:	68 00 35 80 00       	push   $0x803500
+  800d2d:	e8 83 f4 ff ff       	call   8001b5 <_panic>
+
+00800d32 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800d32:	55                   	push   %ebp
+  800d33:	89 e5                	mov    %esp,%ebp
+  800d35:	57                   	push   %edi
+  800d36:	56                   	push   %esi
+  800d37:	53                   	push   %ebx
+  800d38:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800d3b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d40:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d43:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d46:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d4b:	89 df                	mov    %ebx,%edi
+  800d4d:	89 de                	mov    %ebx,%esi
+  800d4f:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d51:	85 c0                	test   %eax,%eax
+  800d53:	7f 08                	jg     800d5d <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  800d55:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d58:	5b                   	pop    %ebx
+  800d59:	5e                   	pop    %esi
+  800d5a:	5f                   	pop    %edi
+  800d5b:	5d                   	pop    %ebp
+  800d5c:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d5d:	83 ec 0c             	sub    $0xc,%esp
+  800d60:	50                   	push   %eax
+  800d61:	6a 06                	push   $0x6
+  800d63:	68 e3 34 80 00       	push   $0x8034e3
+  800d68:	6a 23                	push   $0x23
+  800d6a:	68 00 35 80 00       	push   $0x803500
+  800d6f:	e8 41 f4 ff ff       	call   8001b5 <_panic>
+
+00800d74 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  800d74:	55                   	push   %ebp
+  800d75:	89 e5                	mov    %esp,%ebp
+  800d77:	57                   	push   %edi
+  800d78:	56                   	push   %esi
+  800d79:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d7a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d7d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d80:	b8 11 00 00 00       	mov    $0x11,%eax
+  800d85:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d88:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d8b:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d8e:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  800d90:	5b                   	pop    %ebx
+  800d91:	5e                   	pop    %esi
+  800d92:	5f                   	pop    %edi
+  800d93:	5d                   	pop    %ebp
+  800d94:	c3                   	ret
+
+00800d95 <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  800d95:	55                   	push   %ebp
+  800d96:	89 e5                	mov    %esp,%ebp
+  800d98:	57                   	push   %edi
+  800d99:	56                   	push   %esi
+  800d9a:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d9b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d9e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800da1:	b8 12 00 00 00       	mov    $0x12,%eax
+  800da6:	be 00 00 00 00       	mov    $0x0,%esi
+  800dab:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dae:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800db1:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  800db3:	5b                   	pop    %ebx
+  800db4:	5e                   	pop    %esi
+  800db5:	5f                   	pop    %edi
+  800db6:	5d                   	pop    %ebp
+  800db7:	c3                   	ret
+
+00800db8 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  800db8:	55                   	push   %ebp
+  800db9:	89 e5                	mov    %esp,%ebp
+  800dbb:	57                   	push   %edi
+  800dbc:	56                   	push   %esi
+  800dbd:	53                   	push   %ebx
+  800dbe:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800dc1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dc6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dc9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dcc:	b8 16 00 00 00       	mov    $0x16,%eax
+  800dd1:	89 df                	mov    %ebx,%edi
+  800dd3:	89 de                	mov    %ebx,%esi
+  800dd5:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800dd7:	85 c0                	test   %eax,%eax
+  800dd9:	7f 08                	jg     800de3 <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  800ddb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dde:	5b                   	pop    %ebx
+  800ddf:	5e                   	pop    %esi
+  800de0:	5f                   	pop    %edi
+  800de1:	5d                   	pop    %ebp
+  800de2:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800de3:	83 ec 0c             	sub    $0xc,%esp
+  800de6:	50                   	push   %eax
+  800de7:	6a 16                	push   $0x16
+  800de9:	68 e3 34 80 00       	push   $0x8034e3
+  800dee:	6a 23                	push   $0x23
+  800df0:	68 00 35 80 00       	push   $0x803500
+  800df5:	e8 bb f3 ff ff       	call   8001b5 <_panic>
+
+00800dfa <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  800dfa:	55                   	push   %ebp
+  800dfb:	89 e5                	mov    %esp,%ebp
+  800dfd:	57                   	push   %edi
+  800dfe:	56                   	push   %esi
+  800dff:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e00:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e05:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e08:	b8 17 00 00 00       	mov    $0x17,%eax
+  800e0d:	89 cb                	mov    %ecx,%ebx
+  800e0f:	89 cf                	mov    %ecx,%edi
+  800e11:	89 ce                	mov    %ecx,%esi
+  800e13:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  800e15:	5b                   	pop    %ebx
+  800e16:	5e                   	pop    %esi
+  800e17:	5f                   	pop    %edi
+  800e18:	5d                   	pop    %ebp
+  800e19:	c3                   	ret
+
+00800e1a <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  800e1a:	55                   	push   %ebp
+  800e1b:	89 e5                	mov    %esp,%ebp
+  800e1d:	57                   	push   %edi
+  800e1e:	56                   	push   %esi
+  800e1f:	53                   	push   %ebx
+  800e20:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e23:	be 00 00 00 00       	mov    $0x0,%esi
+  800e28:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e2b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e2e:	b8 18 00 00 00       	mov    $0x18,%eax
+  800e33:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e36:	89 f7                	mov    %esi,%edi
+  800e38:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e3a:	85 c0                	test   %eax,%eax
+  800e3c:	7f 08                	jg     800e46 <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  800e3e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e41:	5b                   	pop    %ebx
+  800e42:	5e                   	pop    %esi
+  800e43:	5f                   	pop    %edi
+  800e44:	5d                   	pop    %ebp
+  800e45:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e46:	83 ec 0c             	sub    $0xc,%esp
+  800e49:	50                   	push   %eax
+  800e4a:	6a 18                	push   $0x18
+  800e4c:	68 e3 34 80 00       	push   $0x8034e3
+  800e51:	6a 23                	push   $0x23
+  800e53:	68 00 35 80 00       	push   $0x803500
+  800e58:	e8 58 f3 ff ff       	call   8001b5 <_panic>
+
+00800e5d <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  800e5d:	55                   	push   %ebp
+  800e5e:	89 e5                	mov    %esp,%ebp
+  800e60:	57                   	push   %edi
+  800e61:	56                   	push   %esi
+  800e62:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e63:	be 00 00 00 00       	mov    $0x0,%esi
+  800e68:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e6b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e6e:	b8 19 00 00 00       	mov    $0x19,%eax
+  800e73:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e76:	89 f7                	mov    %esi,%edi
+  800e78:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  800e7a:	5b                   	pop    %ebx
+  800e7b:	5e                   	pop    %esi
+  800e7c:	5f                   	pop    %edi
+  800e7d:	5d                   	pop    %ebp
+  800e7e:	c3                   	ret
+
+00800e7f <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  800e7f:	55                   	push   %ebp
+  800e80:	89 e5                	mov    %esp,%ebp
+  800e82:	57                   	push   %edi
+  800e83:	56                   	push   %esi
+  800e84:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e85:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e8a:	b8 15 00 00 00       	mov    $0x15,%eax
+  800e8f:	89 d1                	mov    %edx,%ecx
+  800e91:	89 d3                	mov    %edx,%ebx
+  800e93:	89 d7                	mov    %edx,%edi
+  800e95:	89 d6                	mov    %edx,%esi
+  800e97:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800e99:	5b                   	pop    %ebx
+  800e9a:	5e                   	pop    %esi
+  800e9b:	5f                   	pop    %edi
+  800e9c:	5d                   	pop    %ebp
+  800e9d:	c3                   	ret
+
+00800e9e <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800e9e:	55                   	push   %ebp
+  800e9f:	89 e5                	mov    %esp,%ebp
+  800ea1:	57                   	push   %edi
+  800ea2:	56                   	push   %esi
+  800ea3:	53                   	push   %ebx
+  800ea4:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800ea7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eac:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eaf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eb2:	b8 08 00 00 00       	mov    $0x8,%eax
+  800eb7:	89 df                	mov    %ebx,%edi
+  800eb9:	89 de                	mov    %ebx,%esi
+  800ebb:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ebd:	85 c0                	test   %eax,%eax
+  800ebf:	7f 08                	jg     800ec9 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800ec1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ec4:	5b                   	pop    %ebx
+  800ec5:	5e                   	pop    %esi
+  800ec6:	5f                   	pop    %edi
+  800ec7:	5d                   	pop    %ebp
+  800ec8:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ec9:	83 ec 0c             	sub    $0xc,%esp
+  800ecc:	50                   	push   %eax
+  800ecd:	6a 08                	push   $0x8
+  800ecf:	68 e3 34 80 00       	push   $0x8034e3
+  800ed4:	6a 23                	push   $0x23
+  800ed6:	68 00 35 80 00       	push   $0x803500
+  800edb:	e8 d5 f2 ff ff       	call   8001b5 <_panic>
+
+00800ee0 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800ee0:	55                   	push   %ebp
+  800ee1:	89 e5                	mov    %esp,%ebp
+  800ee3:	57                   	push   %edi
+  800ee4:	56                   	push   %esi
+  800ee5:	53                   	push   %ebx
+  800ee6:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800ee9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eee:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ef4:	b8 09 00 00 00       	mov    $0x9,%eax
+  800ef9:	89 df                	mov    %ebx,%edi
+  800efb:	89 de                	mov    %ebx,%esi
+  800efd:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800eff:	85 c0                	test   %eax,%eax
+  800f01:	7f 08                	jg     800f0b <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  800f03:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f06:	5b                   	pop    %ebx
+  800f07:	5e                   	pop    %esi
+  800f08:	5f                   	pop    %edi
+  800f09:	5d                   	pop    %ebp
+  800f0a:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f0b:	83 ec 0c             	sub    $0xc,%esp
+  800f0e:	50                   	push   %eax
+  800f0f:	6a 09                	push   $0x9
+  800f11:	68 e3 34 80 00       	push   $0x8034e3
+  800f16:	6a 23                	push   $0x23
+  800f18:	68 00 35 80 00       	push   $0x803500
+  800f1d:	e8 93 f2 ff ff       	call   8001b5 <_panic>
+
+00800f22 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800f22:	55                   	push   %ebp
+  800f23:	89 e5                	mov    %esp,%ebp
+  800f25:	57                   	push   %edi
+  800f26:	56                   	push   %esi
+  800f27:	53                   	push   %ebx
+  800f28:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f2b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f30:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f33:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f36:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f3b:	89 df                	mov    %ebx,%edi
+  800f3d:	89 de                	mov    %ebx,%esi
+  800f3f:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f41:	85 c0                	test   %eax,%eax
+  800f43:	7f 08                	jg     800f4d <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  800f45:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f48:	5b                   	pop    %ebx
+  800f49:	5e                   	pop    %esi
+  800f4a:	5f                   	pop    %edi
+  800f4b:	5d                   	pop    %ebp
+  800f4c:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f4d:	83 ec 0c             	sub    $0xc,%esp
+  800f50:	50                   	push   %eax
+  800f51:	6a 0a                	push   $0xa
+  800f53:	68 e3 34 80 00       	push   $0x8034e3
+  800f58:	6a 23                	push   $0x23
+  800f5a:	68 00 35 80 00       	push   $0x803500
+  800f5f:	e8 51 f2 ff ff       	call   8001b5 <_panic>
+
+00800f64 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  800f64:	55                   	push   %ebp
+  800f65:	89 e5                	mov    %esp,%ebp
+  800f67:	57                   	push   %edi
+  800f68:	56                   	push   %esi
+  800f69:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f6a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f6d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f70:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f75:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f78:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f7b:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f7e:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  800f80:	5b                   	pop    %ebx
+  800f81:	5e                   	pop    %esi
+  800f82:	5f                   	pop    %edi
+  800f83:	5d                   	pop    %ebp
+  800f84:	c3                   	ret
+
+00800f85 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  800f85:	55                   	push   %ebp
+  800f86:	89 e5                	mov    %esp,%ebp
+  800f88:	57                   	push   %edi
+  800f89:	56                   	push   %esi
+  800f8a:	53                   	push   %ebx
+  800f8b:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f8e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f93:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f96:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f99:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f9e:	89 df                	mov    %ebx,%edi
+  800fa0:	89 de                	mov    %ebx,%esi
+  800fa2:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800fa4:	85 c0                	test   %eax,%eax
+  800fa6:	7f 08                	jg     800fb0 <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  800fa8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fab:	5b                   	pop    %ebx
+  800fac:	5e                   	pop    %esi
+  800fad:	5f                   	pop    %edi
+  800fae:	5d                   	pop    %ebp
+  800faf:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800fb0:	83 ec 0c             	sub    $0xc,%esp
+  800fb3:	50                   	push   %eax
+  800fb4:	6a 0d                	push   $0xd
+  800fb6:	68 e3 34 80 00       	push   $0x8034e3
+  800fbb:	6a 23                	push   $0x23
+  800fbd:	68 00 35 80 00       	push   $0x803500
+  800fc2:	e8 ee f1 ff ff       	call   8001b5 <_panic>
+
+00800fc7 <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  800fc7:	55                   	push   %ebp
+  800fc8:	89 e5                	mov    %esp,%ebp
+  800fca:	57                   	push   %edi
+  800fcb:	56                   	push   %esi
+  800fcc:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800fcd:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fd2:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800fd7:	89 d1                	mov    %edx,%ecx
+  800fd9:	89 d3                	mov    %edx,%ebx
+  800fdb:	89 d7                	mov    %edx,%edi
+  800fdd:	89 d6                	mov    %edx,%esi
+  800fdf:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800fe1:	5b                   	pop    %ebx
+  800fe2:	5e                   	pop    %esi
+  800fe3:	5f                   	pop    %edi
+  800fe4:	5d                   	pop    %ebp
+  800fe5:	c3                   	ret
+
+00800fe6 <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  800fe6:	55                   	push   %ebp
+  800fe7:	89 e5                	mov    %esp,%ebp
+  800fe9:	57                   	push   %edi
+  800fea:	56                   	push   %esi
+  800feb:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800fec:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ff2:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800ff7:	be 00 00 00 00       	mov    $0x0,%esi
+  800ffc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fff:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801002:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  801004:	5b                   	pop    %ebx
+  801005:	5e                   	pop    %esi
+  801006:	5f                   	pop    %edi
+  801007:	5d                   	pop    %ebp
+  801008:	c3                   	ret
+
+00801009 <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  801009:	55                   	push   %ebp
+  80100a:	89 e5                	mov    %esp,%ebp
+  80100c:	57                   	push   %edi
+  80100d:	56                   	push   %esi
+  80100e:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80100f:	be 00 00 00 00       	mov    $0x0,%esi
+  801014:	8b 55 08             	mov    0x8(%ebp),%edx
+  801017:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80101a:	b8 10 00 00 00       	mov    $0x10,%eax
+  80101f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801022:	89 f7                	mov    %esi,%edi
+  801024:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  801026:	5b                   	pop    %ebx
+  801027:	5e                   	pop    %esi
+  801028:	5f                   	pop    %edi
+  801029:	5d                   	pop    %ebp
+  80102a:	c3                   	ret
+
+0080102b <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  80102b:	55                   	push   %ebp
+  80102c:	89 e5                	mov    %esp,%ebp
+  80102e:	57                   	push   %edi
+  80102f:	56                   	push   %esi
+  801030:	53                   	push   %ebx
+  801031:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  801034:	80 3d 48 57 80 00 00 	cmpb   $0x0,0x805748
+  80103b:	74 41                	je     80107e <sys_batch+0x53>
+  80103d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801040:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  801043:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  80104a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80104d:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  801050:	7d 45                	jge    801097 <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  801052:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801055:	8b 06                	mov    (%esi),%eax
+  801057:	8b 56 04             	mov    0x4(%esi),%edx
+  80105a:	8b 4e 08             	mov    0x8(%esi),%ecx
+  80105d:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  801060:	8b 7e 10             	mov    0x10(%esi),%edi
+  801063:	8b 76 14             	mov    0x14(%esi),%esi
+  801066:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  801068:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80106b:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  80106e:	83 c6 1c             	add    $0x1c,%esi
+  801071:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  801074:	85 c0                	test   %eax,%eax
+  801076:	78 1f                	js     801097 <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  801078:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  80107c:	eb cc                	jmp    80104a <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  80107e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801083:	b8 13 00 00 00       	mov    $0x13,%eax
+  801088:	8b 55 08             	mov    0x8(%ebp),%edx
+  80108b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80108e:	89 df                	mov    %ebx,%edi
+  801090:	89 de                	mov    %ebx,%esi
+  801092:	cd 30                	int    $0x30
+  801094:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  801097:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80109a:	83 c4 08             	add    $0x8,%esp
+  80109d:	5b                   	pop    %ebx
+  80109e:	5e                   	pop    %esi
+  80109f:	5f                   	pop    %edi
+  8010a0:	5d                   	pop    %ebp
+  8010a1:	c3                   	ret
+
+008010a2 <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  8010a2:	55                   	push   %ebp
+  8010a3:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  8010a5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010a8:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8010ae:	5d                   	pop    %ebp
+  8010af:	c3                   	ret
+
+008010b0 <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  8010b0:	55                   	push   %ebp
+  8010b1:	89 e5                	mov    %esp,%ebp
+  8010b3:	56                   	push   %esi
+  8010b4:	53                   	push   %ebx
+  8010b5:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  8010b8:	8b 1e                	mov    (%esi),%ebx
+  8010ba:	85 db                	test   %ebx,%ebx
+  8010bc:	75 09                	jne    8010c7 <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  8010be:	89 d8                	mov    %ebx,%eax
+  8010c0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8010c3:	5b                   	pop    %ebx
+  8010c4:	5e                   	pop    %esi
+  8010c5:	5d                   	pop    %ebp
+  8010c6:	c3                   	ret
+  b->sb_n = 0;
+  8010c7:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  8010cd:	53                   	push   %ebx
+  8010ce:	8d 46 04             	lea    0x4(%esi),%eax
+  8010d1:	50                   	push   %eax
+  8010d2:	e8 54 ff ff ff       	call   80102b <sys_batch>
+  8010d7:	83 c4 08             	add    $0x8,%esp
+  8010da:	85 c0                	test   %eax,%eax
+  8010dc:	78 1e                	js     8010fc <sysbatch_flush+0x4c>
+  if (r < n)
+  8010de:	39 c3                	cmp    %eax,%ebx
+  8010e0:	7f 07                	jg     8010e9 <sysbatch_flush+0x39>
+  return 0;
+  8010e2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010e7:	eb d5                	jmp    8010be <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  8010e9:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8010ec:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  8010f0:	85 db                	test   %ebx,%ebx
+  8010f2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8010f7:	0f 49 d8             	cmovns %eax,%ebx
+  8010fa:	eb c2                	jmp    8010be <sysbatch_flush+0xe>
+    return r;
+  8010fc:	89 c3                	mov    %eax,%ebx
+  8010fe:	eb be                	jmp    8010be <sysbatch_flush+0xe>
+
+00801100 <sysbatch_add>:
+{
+  801100:	55                   	push   %ebp
+  801101:	89 e5                	mov    %esp,%ebp
+  801103:	53                   	push   %ebx
+  801104:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  801107:	83 3b 40             	cmpl   $0x40,(%ebx)
+  80110a:	74 41                	je     80114d <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  80110c:	8b 03                	mov    (%ebx),%eax
+  80110e:	8d 50 01             	lea    0x1(%eax),%edx
+  801111:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  801113:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801116:	01 d8                	add    %ebx,%eax
+  801118:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80111b:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  80111e:	8b 55 10             	mov    0x10(%ebp),%edx
+  801121:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  801124:	8b 55 14             	mov    0x14(%ebp),%edx
+  801127:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  80112a:	8b 55 18             	mov    0x18(%ebp),%edx
+  80112d:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  801130:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  801133:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  801136:	8b 55 20             	mov    0x20(%ebp),%edx
+  801139:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  80113c:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  801143:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801148:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80114b:	c9                   	leave
+  80114c:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  80114d:	53                   	push   %ebx
+  80114e:	e8 5d ff ff ff       	call   8010b0 <sysbatch_flush>
+  801153:	83 c4 04             	add    $0x4,%esp
+  801156:	85 c0                	test   %eax,%eax
+  801158:	79 b2                	jns    80110c <sysbatch_add+0xc>
+  80115a:	eb ec                	jmp    801148 <sysbatch_add+0x48>
+
+0080115c <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80115c:	55                   	push   %ebp
+  80115d:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80115f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801162:	05 00 00 00 30       	add    $0x30000000,%eax
+  801167:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80116a:	5d                   	pop    %ebp
+  80116b:	c3                   	ret
+
+0080116c <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80116c:	55                   	push   %ebp
+  80116d:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80116f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801172:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  801175:	66 b8 00 00          	mov    $0x0,%ax
+  801179:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80117e:	5d                   	pop    %ebp
+  80117f:	c3                   	ret
+
+00801180 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801180:	55                   	push   %ebp
+  801181:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  801183:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801188:	eb 02                	jmp    80118c <fd_alloc+0xc>
+  80118a:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80118c:	89 c2                	mov    %eax,%edx
+  80118e:	c1 ea 16             	shr    $0x16,%edx
+  801191:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801198:	f6 c2 01             	test   $0x1,%dl
+  80119b:	74 2b                	je     8011c8 <fd_alloc+0x48>
+  80119d:	89 c2                	mov    %eax,%edx
+  80119f:	c1 ea 0c             	shr    $0xc,%edx
+  8011a2:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8011a9:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8011af:	f6 c1 01             	test   $0x1,%cl
+  8011b2:	74 14                	je     8011c8 <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  8011b4:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8011ba:	75 ce                	jne    80118a <fd_alloc+0xa>
+  8011bc:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  8011c1:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8011c6:	eb 05                	jmp    8011cd <fd_alloc+0x4d>
+      return 0;
+  8011c8:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  8011cd:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d0:	89 02                	mov    %eax,(%edx)
+}
+  8011d2:	89 c8                	mov    %ecx,%eax
+  8011d4:	5d                   	pop    %ebp
+  8011d5:	c3                   	ret
+
+008011d6 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8011d6:	55                   	push   %ebp
+  8011d7:	89 e5                	mov    %esp,%ebp
+  8011d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  8011dc:	83 f8 1f             	cmp    $0x1f,%eax
+  8011df:	77 30                	ja     801211 <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  8011e1:	c1 e0 0c             	shl    $0xc,%eax
+  8011e4:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8011e9:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8011ef:	f6 c2 01             	test   $0x1,%dl
+  8011f2:	74 24                	je     801218 <fd_lookup+0x42>
+  8011f4:	89 c2                	mov    %eax,%edx
+  8011f6:	c1 ea 0c             	shr    $0xc,%edx
+  8011f9:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801200:	f6 c2 01             	test   $0x1,%dl
+  801203:	74 1a                	je     80121f <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  801205:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801208:	89 02                	mov    %eax,(%edx)
+  return 0;
+  80120a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80120f:	5d                   	pop    %ebp
+  801210:	c3                   	ret
+    return -E_INVAL;
+  801211:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801216:	eb f7                	jmp    80120f <fd_lookup+0x39>
+    return -E_INVAL;
+  801218:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80121d:	eb f0                	jmp    80120f <fd_lookup+0x39>
+  80121f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801224:	eb e9                	jmp    80120f <fd_lookup+0x39>
+
+00801226 <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801226:	55                   	push   %ebp
+  801227:	89 e5                	mov    %esp,%ebp
+  801229:	53                   	push   %ebx
+  80122a:	83 ec 04             	sub    $0x4,%esp
+  80122d:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  801230:	b8 8c 35 80 00       	mov    $0x80358c,%eax
+  801235:	8b 18                	mov    (%eax),%ebx
+  801237:	85 db                	test   %ebx,%ebx
+  801239:	74 0e                	je     801249 <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  80123b:	83 c0 04             	add    $0x4,%eax
+  80123e:	39 13                	cmp    %edx,(%ebx)
+  801240:	75 f3                	jne    801235 <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  801242:	b8 00 00 00 00       	mov    $0x0,%eax
+  801247:	eb 1f                	jmp    801268 <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801249:	a1 44 57 80 00       	mov    0x805744,%eax
+  80124e:	8b 40 48             	mov    0x48(%eax),%eax
+  801251:	83 ec 04             	sub    $0x4,%esp
+  801254:	52                   	push   %edx
+  801255:	50                   	push   %eax
+  801256:	68 10 35 80 00       	push   $0x803510
+  80125b:	e8 30 f0 ff ff       	call   800290 <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  801260:	83 c4 10             	add    $0x10,%esp
+  801263:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  801268:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80126b:	89 1a                	mov    %ebx,(%edx)
+}
+  80126d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801270:	c9                   	leave
+  801271:	c3                   	ret
+
+00801272 <fd_close>:
+{
+  801272:	55                   	push   %ebp
+  801273:	89 e5                	mov    %esp,%ebp
+  801275:	57                   	push   %edi
+  801276:	56                   	push   %esi
+  801277:	53                   	push   %ebx
+  801278:	83 ec 24             	sub    $0x24,%esp
+  80127b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80127e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801281:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801284:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801285:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80128b:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80128e:	50                   	push   %eax
+  80128f:	e8 42 ff ff ff       	call   8011d6 <fd_lookup>
+  801294:	89 c3                	mov    %eax,%ebx
+  801296:	83 c4 10             	add    $0x10,%esp
+  801299:	85 c0                	test   %eax,%eax
+  80129b:	78 05                	js     8012a2 <fd_close+0x30>
+      || fd != fd2)
+  80129d:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8012a0:	74 16                	je     8012b8 <fd_close+0x46>
+    return must_exist ? r : 0;
+  8012a2:	89 f8                	mov    %edi,%eax
+  8012a4:	84 c0                	test   %al,%al
+  8012a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012ab:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8012ae:	89 d8                	mov    %ebx,%eax
+  8012b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012b3:	5b                   	pop    %ebx
+  8012b4:	5e                   	pop    %esi
+  8012b5:	5f                   	pop    %edi
+  8012b6:	5d                   	pop    %ebp
+  8012b7:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8012b8:	83 ec 08             	sub    $0x8,%esp
+  8012bb:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8012be:	50                   	push   %eax
+  8012bf:	ff 36                	push   (%esi)
+  8012c1:	e8 60 ff ff ff       	call   801226 <dev_lookup>
+  8012c6:	89 c3                	mov    %eax,%ebx
+  8012c8:	83 c4 10             	add    $0x10,%esp
+  8012cb:	85 c0                	test   %eax,%eax
+  8012cd:	78 1a                	js     8012e9 <fd_close+0x77>
+    if (dev->dev_close)
+  8012cf:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8012d2:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  8012d5:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  8012da:	85 c0                	test   %eax,%eax
+  8012dc:	74 0b                	je     8012e9 <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  8012de:	83 ec 0c             	sub    $0xc,%esp
+  8012e1:	56                   	push   %esi
+  8012e2:	ff d0                	call   *%eax
+  8012e4:	89 c3                	mov    %eax,%ebx
+  8012e6:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  8012e9:	83 ec 08             	sub    $0x8,%esp
+  8012ec:	56                   	push   %esi
+  8012ed:	6a 00                	push   $0x0
+  8012ef:	e8 3e fa ff ff       	call   800d32 <sys_page_unmap>
+  return r;
+  8012f4:	83 c4 10             	add    $0x10,%esp
+  8012f7:	eb b5                	jmp    8012ae <fd_close+0x3c>
+
+008012f9 <close>:
+
+int
+close(int fdnum)
+{
+  8012f9:	55                   	push   %ebp
+  8012fa:	89 e5                	mov    %esp,%ebp
+  8012fc:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8012ff:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801302:	50                   	push   %eax
+  801303:	ff 75 08             	push   0x8(%ebp)
+  801306:	e8 cb fe ff ff       	call   8011d6 <fd_lookup>
+  80130b:	83 c4 10             	add    $0x10,%esp
+  80130e:	85 c0                	test   %eax,%eax
+  801310:	79 02                	jns    801314 <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  801312:	c9                   	leave
+  801313:	c3                   	ret
+    return fd_close(fd, 1);
+  801314:	83 ec 08             	sub    $0x8,%esp
+  801317:	6a 01                	push   $0x1
+  801319:	ff 75 f4             	push   -0xc(%ebp)
+  80131c:	e8 51 ff ff ff       	call   801272 <fd_close>
+  801321:	83 c4 10             	add    $0x10,%esp
+  801324:	eb ec                	jmp    801312 <close+0x19>
+
+00801326 <close_all>:
+
+void
+close_all(void)
+{
+  801326:	55                   	push   %ebp
+  801327:	89 e5                	mov    %esp,%ebp
+  801329:	53                   	push   %ebx
+  80132a:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  80132d:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  801332:	83 ec 0c             	sub    $0xc,%esp
+  801335:	53                   	push   %ebx
+  801336:	e8 be ff ff ff       	call   8012f9 <close>
+  for (i = 0; i < MAXFD; i++)
+  80133b:	83 c3 01             	add    $0x1,%ebx
+  80133e:	83 c4 10             	add    $0x10,%esp
+  801341:	83 fb 20             	cmp    $0x20,%ebx
+  801344:	75 ec                	jne    801332 <close_all+0xc>
+}
+  801346:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801349:	c9                   	leave
+  80134a:	c3                   	ret
+
+0080134b <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80134b:	55                   	push   %ebp
+  80134c:	89 e5                	mov    %esp,%ebp
+  80134e:	57                   	push   %edi
+  80134f:	56                   	push   %esi
+  801350:	53                   	push   %ebx
+  801351:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801354:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801357:	50                   	push   %eax
+  801358:	ff 75 08             	push   0x8(%ebp)
+  80135b:	e8 76 fe ff ff       	call   8011d6 <fd_lookup>
+  801360:	89 c6                	mov    %eax,%esi
+  801362:	83 c4 10             	add    $0x10,%esp
+  801365:	85 c0                	test   %eax,%eax
+  801367:	0f 88 0a 01 00 00    	js     801477 <dup+0x12c>
+    return r;
+  close(newfdnum);
+  80136d:	83 ec 0c             	sub    $0xc,%esp
+  801370:	ff 75 0c             	push   0xc(%ebp)
+  801373:	e8 81 ff ff ff       	call   8012f9 <close>
+
+  newfd = INDEX2FD(newfdnum);
+  801378:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80137b:	c1 e0 0c             	shl    $0xc,%eax
+  80137e:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  801384:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  801387:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80138a:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  80138d:	89 04 24             	mov    %eax,(%esp)
+  801390:	e8 d7 fd ff ff       	call   80116c <fd2data>
+  801395:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  801397:	89 3c 24             	mov    %edi,(%esp)
+  80139a:	e8 cd fd ff ff       	call   80116c <fd2data>
+  80139f:	83 c4 10             	add    $0x10,%esp
+  8013a2:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8013a5:	89 f3                	mov    %esi,%ebx
+  8013a7:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  8013ad:	89 c6                	mov    %eax,%esi
+  8013af:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8013b2:	89 cf                	mov    %ecx,%edi
+  8013b4:	eb 0c                	jmp    8013c2 <dup+0x77>
+  8013b6:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8013bc:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8013c2:	39 fb                	cmp    %edi,%ebx
+  8013c4:	74 7b                	je     801441 <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  8013c6:	89 d8                	mov    %ebx,%eax
+  8013c8:	c1 e8 16             	shr    $0x16,%eax
+  8013cb:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8013d2:	a8 01                	test   $0x1,%al
+  8013d4:	74 e0                	je     8013b6 <dup+0x6b>
+  8013d6:	89 d8                	mov    %ebx,%eax
+  8013d8:	c1 e8 0c             	shr    $0xc,%eax
+  8013db:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8013e2:	f6 c2 01             	test   $0x1,%dl
+  8013e5:	74 cf                	je     8013b6 <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  8013e7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  8013ee:	83 ec 0c             	sub    $0xc,%esp
+  8013f1:	25 07 0e 00 00       	and    $0xe07,%eax
+  8013f6:	50                   	push   %eax
+  8013f7:	56                   	push   %esi
+  8013f8:	6a 00                	push   $0x0
+  8013fa:	53                   	push   %ebx
+  8013fb:	6a 00                	push   $0x0
+  8013fd:	e8 ee f8 ff ff       	call   800cf0 <sys_page_map>
+  801402:	83 c4 20             	add    $0x20,%esp
+  801405:	85 c0                	test   %eax,%eax
+  801407:	79 ad                	jns    8013b6 <dup+0x6b>
+  801409:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80140c:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  80140e:	83 ec 08             	sub    $0x8,%esp
+  801411:	ff 75 d4             	push   -0x2c(%ebp)
+  801414:	6a 00                	push   $0x0
+  801416:	e8 17 f9 ff ff       	call   800d32 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80141b:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  80141e:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  801424:	83 c4 10             	add    $0x10,%esp
+  801427:	39 df                	cmp    %ebx,%edi
+  801429:	74 4c                	je     801477 <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  80142b:	83 ec 08             	sub    $0x8,%esp
+  80142e:	57                   	push   %edi
+  80142f:	6a 00                	push   $0x0
+  801431:	e8 fc f8 ff ff       	call   800d32 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801436:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  80143c:	83 c4 10             	add    $0x10,%esp
+  80143f:	eb e6                	jmp    801427 <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801441:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801444:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  801447:	89 c8                	mov    %ecx,%eax
+  801449:	c1 e8 0c             	shr    $0xc,%eax
+  80144c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801453:	83 ec 0c             	sub    $0xc,%esp
+  801456:	25 07 0e 00 00       	and    $0xe07,%eax
+  80145b:	50                   	push   %eax
+  80145c:	ff 75 d4             	push   -0x2c(%ebp)
+  80145f:	6a 00                	push   $0x0
+  801461:	51                   	push   %ecx
+  801462:	6a 00                	push   $0x0
+  801464:	e8 87 f8 ff ff       	call   800cf0 <sys_page_map>
+  801469:	89 c6                	mov    %eax,%esi
+  80146b:	83 c4 20             	add    $0x20,%esp
+  80146e:	85 c0                	test   %eax,%eax
+  801470:	78 9c                	js     80140e <dup+0xc3>
+  return newfdnum;
+  801472:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801475:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  801477:	89 f0                	mov    %esi,%eax
+  801479:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80147c:	5b                   	pop    %ebx
+  80147d:	5e                   	pop    %esi
+  80147e:	5f                   	pop    %edi
+  80147f:	5d                   	pop    %ebp
+  801480:	c3                   	ret
+
+00801481 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801481:	55                   	push   %ebp
+  801482:	89 e5                	mov    %esp,%ebp
+  801484:	56                   	push   %esi
+  801485:	53                   	push   %ebx
+  801486:	83 ec 18             	sub    $0x18,%esp
+  801489:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  80148c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80148f:	50                   	push   %eax
+  801490:	56                   	push   %esi
+  801491:	e8 40 fd ff ff       	call   8011d6 <fd_lookup>
+  801496:	83 c4 10             	add    $0x10,%esp
+  801499:	85 c0                	test   %eax,%eax
+  80149b:	78 3c                	js     8014d9 <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80149d:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8014a0:	83 ec 08             	sub    $0x8,%esp
+  8014a3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014a6:	50                   	push   %eax
+  8014a7:	ff 33                	push   (%ebx)
+  8014a9:	e8 78 fd ff ff       	call   801226 <dev_lookup>
+  8014ae:	83 c4 10             	add    $0x10,%esp
+  8014b1:	85 c0                	test   %eax,%eax
+  8014b3:	78 24                	js     8014d9 <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8014b5:	8b 43 08             	mov    0x8(%ebx),%eax
+  8014b8:	83 e0 03             	and    $0x3,%eax
+  8014bb:	83 f8 01             	cmp    $0x1,%eax
+  8014be:	74 20                	je     8014e0 <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  8014c0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014c3:	8b 40 08             	mov    0x8(%eax),%eax
+  8014c6:	85 c0                	test   %eax,%eax
+  8014c8:	74 37                	je     801501 <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  8014ca:	83 ec 04             	sub    $0x4,%esp
+  8014cd:	ff 75 10             	push   0x10(%ebp)
+  8014d0:	ff 75 0c             	push   0xc(%ebp)
+  8014d3:	53                   	push   %ebx
+  8014d4:	ff d0                	call   *%eax
+  8014d6:	83 c4 10             	add    $0x10,%esp
+}
+  8014d9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014dc:	5b                   	pop    %ebx
+  8014dd:	5e                   	pop    %esi
+  8014de:	5d                   	pop    %ebp
+  8014df:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8014e0:	a1 44 57 80 00       	mov    0x805744,%eax
+  8014e5:	8b 40 48             	mov    0x48(%eax),%eax
+  8014e8:	83 ec 04             	sub    $0x4,%esp
+  8014eb:	56                   	push   %esi
+  8014ec:	50                   	push   %eax
+  8014ed:	68 51 35 80 00       	push   $0x803551
+  8014f2:	e8 99 ed ff ff       	call   800290 <cprintf>
+    return -E_INVAL;
+  8014f7:	83 c4 10             	add    $0x10,%esp
+  8014fa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014ff:	eb d8                	jmp    8014d9 <read+0x58>
+    return -E_NOT_SUPP;
+  801501:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801506:	eb d1                	jmp    8014d9 <read+0x58>
+
+00801508 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801508:	55                   	push   %ebp
+  801509:	89 e5                	mov    %esp,%ebp
+  80150b:	57                   	push   %edi
+  80150c:	56                   	push   %esi
+  80150d:	53                   	push   %ebx
+  80150e:	83 ec 0c             	sub    $0xc,%esp
+  801511:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801514:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  801517:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80151c:	eb 02                	jmp    801520 <readn+0x18>
+  80151e:	01 c3                	add    %eax,%ebx
+  801520:	39 f3                	cmp    %esi,%ebx
+  801522:	73 21                	jae    801545 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  801524:	83 ec 04             	sub    $0x4,%esp
+  801527:	89 f0                	mov    %esi,%eax
+  801529:	29 d8                	sub    %ebx,%eax
+  80152b:	50                   	push   %eax
+  80152c:	89 d8                	mov    %ebx,%eax
+  80152e:	03 45 0c             	add    0xc(%ebp),%eax
+  801531:	50                   	push   %eax
+  801532:	57                   	push   %edi
+  801533:	e8 49 ff ff ff       	call   801481 <read>
+    if (m < 0)
+  801538:	83 c4 10             	add    $0x10,%esp
+  80153b:	85 c0                	test   %eax,%eax
+  80153d:	78 04                	js     801543 <readn+0x3b>
+      return m;
+    if (m == 0)
+  80153f:	75 dd                	jne    80151e <readn+0x16>
+  801541:	eb 02                	jmp    801545 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  801543:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  801545:	89 d8                	mov    %ebx,%eax
+  801547:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80154a:	5b                   	pop    %ebx
+  80154b:	5e                   	pop    %esi
+  80154c:	5f                   	pop    %edi
+  80154d:	5d                   	pop    %ebp
+  80154e:	c3                   	ret
+
+0080154f <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80154f:	55                   	push   %ebp
+  801550:	89 e5                	mov    %esp,%ebp
+  801552:	56                   	push   %esi
+  801553:	53                   	push   %ebx
+  801554:	83 ec 18             	sub    $0x18,%esp
+  801557:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  80155a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80155d:	50                   	push   %eax
+  80155e:	53                   	push   %ebx
+  80155f:	e8 72 fc ff ff       	call   8011d6 <fd_lookup>
+  801564:	83 c4 10             	add    $0x10,%esp
+  801567:	85 c0                	test   %eax,%eax
+  801569:	78 37                	js     8015a2 <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80156b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80156e:	83 ec 08             	sub    $0x8,%esp
+  801571:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801574:	50                   	push   %eax
+  801575:	ff 36                	push   (%esi)
+  801577:	e8 aa fc ff ff       	call   801226 <dev_lookup>
+  80157c:	83 c4 10             	add    $0x10,%esp
+  80157f:	85 c0                	test   %eax,%eax
+  801581:	78 1f                	js     8015a2 <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801583:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801587:	74 20                	je     8015a9 <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  801589:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80158c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80158f:	85 c0                	test   %eax,%eax
+  801591:	74 37                	je     8015ca <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  801593:	83 ec 04             	sub    $0x4,%esp
+  801596:	ff 75 10             	push   0x10(%ebp)
+  801599:	ff 75 0c             	push   0xc(%ebp)
+  80159c:	56                   	push   %esi
+  80159d:	ff d0                	call   *%eax
+  80159f:	83 c4 10             	add    $0x10,%esp
+}
+  8015a2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015a5:	5b                   	pop    %ebx
+  8015a6:	5e                   	pop    %esi
+  8015a7:	5d                   	pop    %ebp
+  8015a8:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8015a9:	a1 44 57 80 00       	mov    0x805744,%eax
+  8015ae:	8b 40 48             	mov    0x48(%eax),%eax
+  8015b1:	83 ec 04             	sub    $0x4,%esp
+  8015b4:	53                   	push   %ebx
+  8015b5:	50                   	push   %eax
+  8015b6:	68 6d 35 80 00       	push   $0x80356d
+  8015bb:	e8 d0 ec ff ff       	call   800290 <cprintf>
+    return -E_INVAL;
+  8015c0:	83 c4 10             	add    $0x10,%esp
+  8015c3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015c8:	eb d8                	jmp    8015a2 <write+0x53>
+    return -E_NOT_SUPP;
+  8015ca:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015cf:	eb d1                	jmp    8015a2 <write+0x53>
+
+008015d1 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8015d1:	55                   	push   %ebp
+  8015d2:	89 e5                	mov    %esp,%ebp
+  8015d4:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8015d7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015da:	50                   	push   %eax
+  8015db:	ff 75 08             	push   0x8(%ebp)
+  8015de:	e8 f3 fb ff ff       	call   8011d6 <fd_lookup>
+  8015e3:	83 c4 10             	add    $0x10,%esp
+  8015e6:	85 c0                	test   %eax,%eax
+  8015e8:	78 0e                	js     8015f8 <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  8015ea:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8015ed:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015f0:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  8015f3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015f8:	c9                   	leave
+  8015f9:	c3                   	ret
+
+008015fa <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8015fa:	55                   	push   %ebp
+  8015fb:	89 e5                	mov    %esp,%ebp
+  8015fd:	56                   	push   %esi
+  8015fe:	53                   	push   %ebx
+  8015ff:	83 ec 18             	sub    $0x18,%esp
+  801602:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801605:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801608:	50                   	push   %eax
+  801609:	53                   	push   %ebx
+  80160a:	e8 c7 fb ff ff       	call   8011d6 <fd_lookup>
+  80160f:	83 c4 10             	add    $0x10,%esp
+  801612:	85 c0                	test   %eax,%eax
+  801614:	78 34                	js     80164a <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801616:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801619:	83 ec 08             	sub    $0x8,%esp
+  80161c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80161f:	50                   	push   %eax
+  801620:	ff 36                	push   (%esi)
+  801622:	e8 ff fb ff ff       	call   801226 <dev_lookup>
+  801627:	83 c4 10             	add    $0x10,%esp
+  80162a:	85 c0                	test   %eax,%eax
+  80162c:	78 1c                	js     80164a <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80162e:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801632:	74 1d                	je     801651 <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  801634:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801637:	8b 40 18             	mov    0x18(%eax),%eax
+  80163a:	85 c0                	test   %eax,%eax
+  80163c:	74 34                	je     801672 <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  80163e:	83 ec 08             	sub    $0x8,%esp
+  801641:	ff 75 0c             	push   0xc(%ebp)
+  801644:	56                   	push   %esi
+  801645:	ff d0                	call   *%eax
+  801647:	83 c4 10             	add    $0x10,%esp
+}
+  80164a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80164d:	5b                   	pop    %ebx
+  80164e:	5e                   	pop    %esi
+  80164f:	5d                   	pop    %ebp
+  801650:	c3                   	ret
+            thisenv->env_id, fdnum);
+  801651:	a1 44 57 80 00       	mov    0x805744,%eax
+  801656:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801659:	83 ec 04             	sub    $0x4,%esp
+  80165c:	53                   	push   %ebx
+  80165d:	50                   	push   %eax
+  80165e:	68 30 35 80 00       	push   $0x803530
+  801663:	e8 28 ec ff ff       	call   800290 <cprintf>
+    return -E_INVAL;
+  801668:	83 c4 10             	add    $0x10,%esp
+  80166b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801670:	eb d8                	jmp    80164a <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  801672:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801677:	eb d1                	jmp    80164a <ftruncate+0x50>
+
+00801679 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801679:	55                   	push   %ebp
+  80167a:	89 e5                	mov    %esp,%ebp
+  80167c:	56                   	push   %esi
+  80167d:	53                   	push   %ebx
+  80167e:	83 ec 18             	sub    $0x18,%esp
+  801681:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801684:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801687:	50                   	push   %eax
+  801688:	ff 75 08             	push   0x8(%ebp)
+  80168b:	e8 46 fb ff ff       	call   8011d6 <fd_lookup>
+  801690:	83 c4 10             	add    $0x10,%esp
+  801693:	85 c0                	test   %eax,%eax
+  801695:	78 49                	js     8016e0 <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801697:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80169a:	83 ec 08             	sub    $0x8,%esp
+  80169d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016a0:	50                   	push   %eax
+  8016a1:	ff 36                	push   (%esi)
+  8016a3:	e8 7e fb ff ff       	call   801226 <dev_lookup>
+  8016a8:	83 c4 10             	add    $0x10,%esp
+  8016ab:	85 c0                	test   %eax,%eax
+  8016ad:	78 31                	js     8016e0 <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  8016af:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016b2:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8016b6:	74 2f                	je     8016e7 <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  8016b8:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  8016bb:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8016c2:	00 00 00 
+  stat->st_isdir = 0;
+  8016c5:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8016cc:	00 00 00 
+  stat->st_dev = dev;
+  8016cf:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  8016d5:	83 ec 08             	sub    $0x8,%esp
+  8016d8:	53                   	push   %ebx
+  8016d9:	56                   	push   %esi
+  8016da:	ff 50 14             	call   *0x14(%eax)
+  8016dd:	83 c4 10             	add    $0x10,%esp
+}
+  8016e0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016e3:	5b                   	pop    %ebx
+  8016e4:	5e                   	pop    %esi
+  8016e5:	5d                   	pop    %ebp
+  8016e6:	c3                   	ret
+    return -E_NOT_SUPP;
+  8016e7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016ec:	eb f2                	jmp    8016e0 <fstat+0x67>
+
+008016ee <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  8016ee:	55                   	push   %ebp
+  8016ef:	89 e5                	mov    %esp,%ebp
+  8016f1:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  8016f4:	ff 75 0c             	push   0xc(%ebp)
+  8016f7:	ff 75 08             	push   0x8(%ebp)
+  8016fa:	e8 58 07 00 00       	call   801e57 <file_stat>
+}
+  8016ff:	c9                   	leave
+  801700:	c3                   	ret
+
+00801701 <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  801701:	55                   	push   %ebp
+  801702:	89 e5                	mov    %esp,%ebp
+  801704:	57                   	push   %edi
+  801705:	56                   	push   %esi
+  801706:	53                   	push   %ebx
+  801707:	83 ec 1c             	sub    $0x1c,%esp
+  80170a:	89 c7                	mov    %eax,%edi
+  80170c:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  80170f:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801712:	e9 a2 00 00 00       	jmp    8017b9 <fsipc_send+0xb8>
+  nfsenvs = 0;
+  801717:	c7 05 00 50 80 00 00 	movl   $0x0,0x805000
+  80171e:	00 00 00 
+  801721:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801726:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  80172b:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801730:	be 01 00 00 00       	mov    $0x1,%esi
+  801735:	eb 0f                	jmp    801746 <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801737:	83 c0 01             	add    $0x1,%eax
+  80173a:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80173f:	74 49                	je     80178a <fsipc_send+0x89>
+  801741:	83 f9 07             	cmp    $0x7,%ecx
+  801744:	7f 50                	jg     801796 <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  801746:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801749:	c1 e2 04             	shl    $0x4,%edx
+  80174c:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801752:	8b 52 50             	mov    0x50(%edx),%edx
+  801755:	83 fa 01             	cmp    $0x1,%edx
+  801758:	75 dd                	jne    801737 <fsipc_send+0x36>
+  80175a:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  80175d:	c1 e2 04             	shl    $0x4,%edx
+  801760:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801766:	8b 52 54             	mov    0x54(%edx),%edx
+  801769:	85 d2                	test   %edx,%edx
+  80176b:	74 ca                	je     801737 <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  80176d:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801770:	c1 e2 04             	shl    $0x4,%edx
+  801773:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801779:	8b 52 48             	mov    0x48(%edx),%edx
+  80177c:	89 14 8d 20 50 80 00 	mov    %edx,0x805020(,%ecx,4)
+  801783:	8d 49 01             	lea    0x1(%ecx),%ecx
+  801786:	89 f3                	mov    %esi,%ebx
+  801788:	eb ad                	jmp    801737 <fsipc_send+0x36>
+  80178a:	84 db                	test   %bl,%bl
+  80178c:	74 38                	je     8017c6 <fsipc_send+0xc5>
+  80178e:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  801794:	eb 30                	jmp    8017c6 <fsipc_send+0xc5>
+  801796:	84 db                	test   %bl,%bl
+  801798:	74 2c                	je     8017c6 <fsipc_send+0xc5>
+  80179a:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  8017a0:	eb 24                	jmp    8017c6 <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  8017a2:	50                   	push   %eax
+  8017a3:	68 9c 35 80 00       	push   $0x80359c
+  8017a8:	6a 34                	push   $0x34
+  8017aa:	68 a6 35 80 00       	push   $0x8035a6
+  8017af:	e8 01 ea ff ff       	call   8001b5 <_panic>
+    }
+    sys_yield();
+  8017b4:	e8 92 f4 ff ff       	call   800c4b <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  8017b9:	83 3d 00 50 80 00 03 	cmpl   $0x3,0x805000
+  8017c0:	0f 8e 51 ff ff ff    	jle    801717 <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  8017c6:	a1 44 57 80 00       	mov    0x805744,%eax
+  8017cb:	8b 70 48             	mov    0x48(%eax),%esi
+  8017ce:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  8017d4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017d9:	8b 0d 00 50 80 00    	mov    0x805000,%ecx
+  8017df:	39 d9                	cmp    %ebx,%ecx
+  8017e1:	7e d1                	jle    8017b4 <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  8017e3:	83 ec 0c             	sub    $0xc,%esp
+  8017e6:	ff 75 e0             	push   -0x20(%ebp)
+  8017e9:	6a 07                	push   $0x7
+  8017eb:	ff 75 e4             	push   -0x1c(%ebp)
+  8017ee:	57                   	push   %edi
+  8017ef:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  8017f2:	99                   	cltd
+  8017f3:	f7 f9                	idiv   %ecx
+  8017f5:	ff 34 95 20 50 80 00 	push   0x805020(,%edx,4)
+  8017fc:	e8 63 f7 ff ff       	call   800f64 <sys_ipc_try_send>
+      if (r == 0)
+  801801:	83 c4 20             	add    $0x20,%esp
+  801804:	85 c0                	test   %eax,%eax
+  801806:	74 0a                	je     801812 <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  801808:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80180b:	75 95                	jne    8017a2 <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  80180d:	83 c3 01             	add    $0x1,%ebx
+  801810:	eb c7                	jmp    8017d9 <fsipc_send+0xd8>
+  }
+}
+  801812:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801815:	5b                   	pop    %ebx
+  801816:	5e                   	pop    %esi
+  801817:	5f                   	pop    %edi
+  801818:	5d                   	pop    %ebp
+  801819:	c3                   	ret
+
+0080181a <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  80181a:	55                   	push   %ebp
+  80181b:	89 e5                	mov    %esp,%ebp
+  80181d:	53                   	push   %ebx
+  80181e:	83 ec 14             	sub    $0x14,%esp
+  801821:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  801823:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  80182a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80182f:	ba 00 60 80 00       	mov    $0x806000,%edx
+  801834:	e8 c8 fe ff ff       	call   801701 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801839:	6a 00                	push   $0x0
+  80183b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80183e:	50                   	push   %eax
+  80183f:	53                   	push   %ebx
+  801840:	6a 00                	push   $0x0
+  801842:	e8 3a 14 00 00       	call   802c81 <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  801847:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80184a:	c9                   	leave
+  80184b:	c3                   	ret
+
+0080184c <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  80184c:	55                   	push   %ebp
+  80184d:	89 e5                	mov    %esp,%ebp
+  80184f:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801852:	8b 45 08             	mov    0x8(%ebp),%eax
+  801855:	8b 40 0c             	mov    0xc(%eax),%eax
+  801858:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.set_size.req_size = newsize;
+  80185d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801860:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801865:	ba 00 00 00 00       	mov    $0x0,%edx
+  80186a:	b8 02 00 00 00       	mov    $0x2,%eax
+  80186f:	e8 a6 ff ff ff       	call   80181a <fsipc>
+}
+  801874:	c9                   	leave
+  801875:	c3                   	ret
+
+00801876 <devfile_flush>:
+{
+  801876:	55                   	push   %ebp
+  801877:	89 e5                	mov    %esp,%ebp
+  801879:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80187c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80187f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801882:	a3 00 60 80 00       	mov    %eax,0x806000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801887:	ba 00 00 00 00       	mov    $0x0,%edx
+  80188c:	b8 06 00 00 00       	mov    $0x6,%eax
+  801891:	e8 84 ff ff ff       	call   80181a <fsipc>
+}
+  801896:	c9                   	leave
+  801897:	c3                   	ret
+
+00801898 <devfile_stat>:
+{
+  801898:	55                   	push   %ebp
+  801899:	89 e5                	mov    %esp,%ebp
+  80189b:	53                   	push   %ebx
+  80189c:	83 ec 04             	sub    $0x4,%esp
+  80189f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8018a2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018a5:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018a8:	a3 00 60 80 00       	mov    %eax,0x806000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8018ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018b2:	b8 05 00 00 00       	mov    $0x5,%eax
+  8018b7:	e8 5e ff ff ff       	call   80181a <fsipc>
+  8018bc:	85 c0                	test   %eax,%eax
+  8018be:	78 2c                	js     8018ec <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8018c0:	83 ec 08             	sub    $0x8,%esp
+  8018c3:	68 00 60 80 00       	push   $0x806000
+  8018c8:	53                   	push   %ebx
+  8018c9:	e8 b0 ef ff ff       	call   80087e <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  8018ce:	a1 80 60 80 00       	mov    0x806080,%eax
+  8018d3:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8018d9:	a1 84 60 80 00       	mov    0x806084,%eax
+  8018de:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  8018e4:	83 c4 10             	add    $0x10,%esp
+  8018e7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018ec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018ef:	c9                   	leave
+  8018f0:	c3                   	ret
+
+008018f1 <fsv_alloc>:
+{
+  8018f1:	55                   	push   %ebp
+  8018f2:	89 e5                	mov    %esp,%ebp
+  8018f4:	56                   	push   %esi
+  8018f5:	53                   	push   %ebx
+  8018f6:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  8018f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018fd:	eb 22                	jmp    801921 <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  8018ff:	83 ec 04             	sub    $0x4,%esp
+  801902:	6a 00                	push   $0x0
+  801904:	6a 00                	push   $0x0
+  801906:	6a 07                	push   $0x7
+  801908:	50                   	push   %eax
+  801909:	6a 00                	push   $0x0
+  80190b:	6a 04                	push   $0x4
+  80190d:	68 40 50 80 00       	push   $0x805040
+  801912:	e8 e9 f7 ff ff       	call   801100 <sysbatch_add>
+  801917:	83 c4 20             	add    $0x20,%esp
+  80191a:	85 c0                	test   %eax,%eax
+  80191c:	78 48                	js     801966 <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  80191e:	83 c3 01             	add    $0x1,%ebx
+  801921:	39 f3                	cmp    %esi,%ebx
+  801923:	74 31                	je     801956 <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  801925:	89 d8                	mov    %ebx,%eax
+  801927:	c1 e0 0c             	shl    $0xc,%eax
+  80192a:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  80192f:	89 c2                	mov    %eax,%edx
+  801931:	c1 ea 16             	shr    $0x16,%edx
+  801934:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80193b:	f6 c2 01             	test   $0x1,%dl
+  80193e:	74 bf                	je     8018ff <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  801940:	89 c2                	mov    %eax,%edx
+  801942:	c1 ea 0c             	shr    $0xc,%edx
+  801945:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80194c:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  80194f:	83 fa 03             	cmp    $0x3,%edx
+  801952:	75 ab                	jne    8018ff <fsv_alloc+0xe>
+  801954:	eb c8                	jmp    80191e <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  801956:	83 ec 0c             	sub    $0xc,%esp
+  801959:	68 40 50 80 00       	push   $0x805040
+  80195e:	e8 4d f7 ff ff       	call   8010b0 <sysbatch_flush>
+  801963:	83 c4 10             	add    $0x10,%esp
+}
+  801966:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801969:	5b                   	pop    %ebx
+  80196a:	5e                   	pop    %esi
+  80196b:	5d                   	pop    %ebp
+  80196c:	c3                   	ret
+
+0080196d <devfile_read>:
+{
+  80196d:	55                   	push   %ebp
+  80196e:	89 e5                	mov    %esp,%ebp
+  801970:	57                   	push   %edi
+  801971:	56                   	push   %esi
+  801972:	53                   	push   %ebx
+  801973:	83 ec 3c             	sub    $0x3c,%esp
+  801976:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  801979:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  80197f:	77 57                	ja     8019d8 <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801981:	8b 45 08             	mov    0x8(%ebp),%eax
+  801984:	8b 40 0c             	mov    0xc(%eax),%eax
+  801987:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read.req_n = n;
+  80198c:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801992:	ba 00 00 00 00       	mov    $0x0,%edx
+  801997:	b8 03 00 00 00       	mov    $0x3,%eax
+  80199c:	e8 79 fe ff ff       	call   80181a <fsipc>
+  8019a1:	89 c6                	mov    %eax,%esi
+  8019a3:	85 c0                	test   %eax,%eax
+  8019a5:	78 27                	js     8019ce <devfile_read+0x61>
+  assert(r <= n);
+  8019a7:	39 c3                	cmp    %eax,%ebx
+  8019a9:	0f 82 0e 02 00 00    	jb     801bbd <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  8019af:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8019b4:	0f 8f 1c 02 00 00    	jg     801bd6 <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8019ba:	83 ec 04             	sub    $0x4,%esp
+  8019bd:	50                   	push   %eax
+  8019be:	68 00 60 80 00       	push   $0x806000
+  8019c3:	ff 75 0c             	push   0xc(%ebp)
+  8019c6:	e8 39 f0 ff ff       	call   800a04 <memmove>
+  return r;
+  8019cb:	83 c4 10             	add    $0x10,%esp
+}
+  8019ce:	89 f0                	mov    %esi,%eax
+  8019d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019d3:	5b                   	pop    %ebx
+  8019d4:	5e                   	pop    %esi
+  8019d5:	5f                   	pop    %edi
+  8019d6:	5d                   	pop    %ebp
+  8019d7:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  8019d8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8019dd:	e8 0f ff ff ff       	call   8018f1 <fsv_alloc>
+  8019e2:	89 c6                	mov    %eax,%esi
+  8019e4:	85 c0                	test   %eax,%eax
+  8019e6:	78 e6                	js     8019ce <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  8019e8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019eb:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019ee:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  8019f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019f6:	8b 40 04             	mov    0x4(%eax),%eax
+  8019f9:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  8019fe:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  801a04:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801a0b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801a10:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801a15:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801a1a:	e8 e2 fc ff ff       	call   801701 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801a1f:	6a 00                	push   $0x0
+  801a21:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801a24:	50                   	push   %eax
+  801a25:	68 00 10 c0 9f       	push   $0x9fc01000
+  801a2a:	6a 00                	push   $0x0
+  801a2c:	e8 50 12 00 00       	call   802c81 <ipc_recv_pages>
+  801a31:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  801a33:	83 c4 10             	add    $0x10,%esp
+  801a36:	85 c0                	test   %eax,%eax
+  801a38:	7e 94                	jle    8019ce <devfile_read+0x61>
+  assert(r <= n);
+  801a3a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801a3d:	39 c3                	cmp    %eax,%ebx
+  801a3f:	72 2e                	jb     801a6f <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801a41:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a44:	8b 40 04             	mov    0x4(%eax),%eax
+  801a47:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801a4c:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  801a4f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801a52:	c1 e2 0c             	shl    $0xc,%edx
+  801a55:	39 ca                	cmp    %ecx,%edx
+  801a57:	72 2f                	jb     801a88 <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  801a59:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  801a5e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  801a61:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  801a65:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801a6a:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  801a6d:	eb 52                	jmp    801ac1 <devfile_read+0x154>
+  assert(r <= n);
+  801a6f:	68 b1 35 80 00       	push   $0x8035b1
+  801a74:	68 b8 35 80 00       	push   $0x8035b8
+  801a79:	68 49 01 00 00       	push   $0x149
+  801a7e:	68 a6 35 80 00       	push   $0x8035a6
+  801a83:	e8 2d e7 ff ff       	call   8001b5 <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801a88:	68 dc 35 80 00       	push   $0x8035dc
+  801a8d:	68 b8 35 80 00       	push   $0x8035b8
+  801a92:	68 4a 01 00 00       	push   $0x14a
+  801a97:	68 a6 35 80 00       	push   $0x8035a6
+  801a9c:	e8 14 e7 ff ff       	call   8001b5 <_panic>
+      memmove(dst + done, src + done, m);
+  801aa1:	83 ec 04             	sub    $0x4,%esp
+  801aa4:	53                   	push   %ebx
+  801aa5:	56                   	push   %esi
+  801aa6:	89 f8                	mov    %edi,%eax
+  801aa8:	03 45 0c             	add    0xc(%ebp),%eax
+  801aab:	50                   	push   %eax
+  801aac:	e8 53 ef ff ff       	call   800a04 <memmove>
+  801ab1:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  801ab4:	01 df                	add    %ebx,%edi
+  801ab6:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801ab9:	39 c7                	cmp    %eax,%edi
+  801abb:	0f 83 c0 00 00 00    	jae    801b81 <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801ac1:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801ac4:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  801ac7:	89 f0                	mov    %esi,%eax
+  801ac9:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801ace:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  801ad3:	29 c3                	sub    %eax,%ebx
+  801ad5:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801ad8:	29 f8                	sub    %edi,%eax
+  801ada:	39 c3                	cmp    %eax,%ebx
+  801adc:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  801adf:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801ae5:	75 ba                	jne    801aa1 <devfile_read+0x134>
+  801ae7:	89 f9                	mov    %edi,%ecx
+  801ae9:	03 4d 0c             	add    0xc(%ebp),%ecx
+  801aec:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  801aef:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  801af5:	75 aa                	jne    801aa1 <devfile_read+0x134>
+  801af7:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  801afd:	77 a2                	ja     801aa1 <devfile_read+0x134>
+  801aff:	89 c8                	mov    %ecx,%eax
+  801b01:	c1 e8 16             	shr    $0x16,%eax
+  801b04:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801b0b:	a8 01                	test   $0x1,%al
+  801b0d:	74 92                	je     801aa1 <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  801b0f:	89 c8                	mov    %ecx,%eax
+  801b11:	c1 e8 0c             	shr    $0xc,%eax
+  801b14:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  801b1b:	a8 01                	test   $0x1,%al
+  801b1d:	74 82                	je     801aa1 <devfile_read+0x134>
+  801b1f:	a9 02 08 00 00       	test   $0x802,%eax
+  801b24:	0f 84 77 ff ff ff    	je     801aa1 <devfile_read+0x134>
+  801b2a:	f6 c4 04             	test   $0x4,%ah
+  801b2d:	0f 85 6e ff ff ff    	jne    801aa1 <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  801b33:	a1 44 57 80 00       	mov    0x805744,%eax
+  801b38:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  801b3c:	84 c0                	test   %al,%al
+  801b3e:	75 17                	jne    801b57 <devfile_read+0x1ea>
+  801b40:	83 ec 08             	sub    $0x8,%esp
+  801b43:	6a 01                	push   $0x1
+  801b45:	6a 00                	push   $0x0
+  801b47:	e8 1e f1 ff ff       	call   800c6a <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  801b4c:	83 c4 10             	add    $0x10,%esp
+  801b4f:	85 c0                	test   %eax,%eax
+  801b51:	0f 85 4a ff ff ff    	jne    801aa1 <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  801b57:	83 ec 04             	sub    $0x4,%esp
+  801b5a:	68 05 08 00 00       	push   $0x805
+  801b5f:	ff 75 cc             	push   -0x34(%ebp)
+  801b62:	6a 00                	push   $0x0
+  801b64:	56                   	push   %esi
+  801b65:	6a 00                	push   $0x0
+  801b67:	6a 05                	push   $0x5
+  801b69:	68 40 50 80 00       	push   $0x805040
+  801b6e:	e8 8d f5 ff ff       	call   801100 <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  801b73:	c1 e8 1f             	shr    $0x1f,%eax
+  801b76:	08 45 cb             	or     %al,-0x35(%ebp)
+  801b79:	83 c4 20             	add    $0x20,%esp
+  801b7c:	e9 33 ff ff ff       	jmp    801ab4 <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  801b81:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  801b84:	83 ec 0c             	sub    $0xc,%esp
+  801b87:	68 40 50 80 00       	push   $0x805040
+  801b8c:	e8 1f f5 ff ff       	call   8010b0 <sysbatch_flush>
+  801b91:	83 c4 10             	add    $0x10,%esp
+  801b94:	85 c0                	test   %eax,%eax
+  801b96:	78 06                	js     801b9e <devfile_read+0x231>
+  801b98:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  801b9c:	74 14                	je     801bb2 <devfile_read+0x245>
+    memmove(dst, src, r);
+  801b9e:	83 ec 04             	sub    $0x4,%esp
+  801ba1:	ff 75 d4             	push   -0x2c(%ebp)
+  801ba4:	ff 75 d0             	push   -0x30(%ebp)
+  801ba7:	ff 75 0c             	push   0xc(%ebp)
+  801baa:	e8 55 ee ff ff       	call   800a04 <memmove>
+  801baf:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  801bb2:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bb5:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  801bb8:	e9 11 fe ff ff       	jmp    8019ce <devfile_read+0x61>
+  assert(r <= n);
+  801bbd:	68 b1 35 80 00       	push   $0x8035b1
+  801bc2:	68 b8 35 80 00       	push   $0x8035b8
+  801bc7:	68 1c 01 00 00       	push   $0x11c
+  801bcc:	68 a6 35 80 00       	push   $0x8035a6
+  801bd1:	e8 df e5 ff ff       	call   8001b5 <_panic>
+  assert(r <= PGSIZE);
+  801bd6:	68 cd 35 80 00       	push   $0x8035cd
+  801bdb:	68 b8 35 80 00       	push   $0x8035b8
+  801be0:	68 1d 01 00 00       	push   $0x11d
+  801be5:	68 a6 35 80 00       	push   $0x8035a6
+  801bea:	e8 c6 e5 ff ff       	call   8001b5 <_panic>
+
+00801bef <devfile_write>:
+{
+  801bef:	55                   	push   %ebp
+  801bf0:	89 e5                	mov    %esp,%ebp
+  801bf2:	57                   	push   %edi
+  801bf3:	56                   	push   %esi
+  801bf4:	53                   	push   %ebx
+  801bf5:	83 ec 1c             	sub    $0x1c,%esp
+  801bf8:	8b 75 08             	mov    0x8(%ebp),%esi
+  801bfb:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  801bfe:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  801c03:	77 39                	ja     801c3e <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801c05:	8b 56 0c             	mov    0xc(%esi),%edx
+  801c08:	89 15 00 60 80 00    	mov    %edx,0x806000
+  fsipcbuf.write.req_n = n;
+  801c0e:	a3 04 60 80 00       	mov    %eax,0x806004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  801c13:	83 ec 04             	sub    $0x4,%esp
+  801c16:	50                   	push   %eax
+  801c17:	ff 75 0c             	push   0xc(%ebp)
+  801c1a:	68 08 60 80 00       	push   $0x806008
+  801c1f:	e8 e0 ed ff ff       	call   800a04 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801c24:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c29:	b8 04 00 00 00       	mov    $0x4,%eax
+  801c2e:	e8 e7 fb ff ff       	call   80181a <fsipc>
+  801c33:	83 c4 10             	add    $0x10,%esp
+}
+  801c36:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c39:	5b                   	pop    %ebx
+  801c3a:	5e                   	pop    %esi
+  801c3b:	5f                   	pop    %edi
+  801c3c:	5d                   	pop    %ebp
+  801c3d:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  801c3e:	ba 00 00 10 00       	mov    $0x100000,%edx
+  801c43:	39 d0                	cmp    %edx,%eax
+  801c45:	89 d3                	mov    %edx,%ebx
+  801c47:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  801c4a:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  801c50:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  801c53:	83 c7 01             	add    $0x1,%edi
+  801c56:	89 f8                	mov    %edi,%eax
+  801c58:	e8 94 fc ff ff       	call   8018f1 <fsv_alloc>
+  801c5d:	85 c0                	test   %eax,%eax
+  801c5f:	78 d5                	js     801c36 <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  801c61:	83 ec 04             	sub    $0x4,%esp
+  801c64:	53                   	push   %ebx
+  801c65:	ff 75 0c             	push   0xc(%ebp)
+  801c68:	68 00 10 c0 9f       	push   $0x9fc01000
+  801c6d:	e8 92 ed ff ff       	call   800a04 <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  801c72:	8b 46 0c             	mov    0xc(%esi),%eax
+  801c75:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  801c7a:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  801c80:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801c87:	89 f9                	mov    %edi,%ecx
+  801c89:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801c8e:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801c93:	e8 69 fa ff ff       	call   801701 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801c98:	6a 00                	push   $0x0
+  801c9a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801c9d:	50                   	push   %eax
+  801c9e:	6a 00                	push   $0x0
+  801ca0:	6a 00                	push   $0x0
+  801ca2:	e8 da 0f 00 00       	call   802c81 <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  801ca7:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  801caa:	eb 8a                	jmp    801c36 <devfile_write+0x47>
+
+00801cac <open>:
+{
+  801cac:	55                   	push   %ebp
+  801cad:	89 e5                	mov    %esp,%ebp
+  801caf:	56                   	push   %esi
+  801cb0:	53                   	push   %ebx
+  801cb1:	83 ec 1c             	sub    $0x1c,%esp
+  801cb4:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801cb7:	56                   	push   %esi
+  801cb8:	e8 86 eb ff ff       	call   800843 <strlen>
+  801cbd:	83 c4 10             	add    $0x10,%esp
+  801cc0:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801cc5:	7f 6c                	jg     801d33 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  801cc7:	83 ec 0c             	sub    $0xc,%esp
+  801cca:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ccd:	50                   	push   %eax
+  801cce:	e8 ad f4 ff ff       	call   801180 <fd_alloc>
+  801cd3:	89 c3                	mov    %eax,%ebx
+  801cd5:	83 c4 10             	add    $0x10,%esp
+  801cd8:	85 c0                	test   %eax,%eax
+  801cda:	78 3c                	js     801d18 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801cdc:	83 ec 08             	sub    $0x8,%esp
+  801cdf:	56                   	push   %esi
+  801ce0:	68 00 60 80 00       	push   $0x806000
+  801ce5:	e8 94 eb ff ff       	call   80087e <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801cea:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ced:	a3 00 64 80 00       	mov    %eax,0x806400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801cf2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801cf5:	b8 01 00 00 00       	mov    $0x1,%eax
+  801cfa:	e8 1b fb ff ff       	call   80181a <fsipc>
+  801cff:	89 c3                	mov    %eax,%ebx
+  801d01:	83 c4 10             	add    $0x10,%esp
+  801d04:	85 c0                	test   %eax,%eax
+  801d06:	78 19                	js     801d21 <open+0x75>
+  return fd2num(fd);
+  801d08:	83 ec 0c             	sub    $0xc,%esp
+  801d0b:	ff 75 f4             	push   -0xc(%ebp)
+  801d0e:	e8 49 f4 ff ff       	call   80115c <fd2num>
+  801d13:	89 c3                	mov    %eax,%ebx
+  801d15:	83 c4 10             	add    $0x10,%esp
+}
+  801d18:	89 d8                	mov    %ebx,%eax
+  801d1a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d1d:	5b                   	pop    %ebx
+  801d1e:	5e                   	pop    %esi
+  801d1f:	5d                   	pop    %ebp
+  801d20:	c3                   	ret
+    fd_close(fd, 0);
+  801d21:	83 ec 08             	sub    $0x8,%esp
+  801d24:	6a 00                	push   $0x0
+  801d26:	ff 75 f4             	push   -0xc(%ebp)
+  801d29:	e8 44 f5 ff ff       	call   801272 <fd_close>
+    return r;
+  801d2e:	83 c4 10             	add    $0x10,%esp
+  801d31:	eb e5                	jmp    801d18 <open+0x6c>
+    return -E_BAD_PATH;
+  801d33:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801d38:	eb de                	jmp    801d18 <open+0x6c>
+
+00801d3a <open_read>:
+{
+  801d3a:	55                   	push   %ebp
+  801d3b:	89 e5                	mov    %esp,%ebp
+  801d3d:	57                   	push   %edi
+  801d3e:	56                   	push   %esi
+  801d3f:	53                   	push   %ebx
+  801d40:	83 ec 28             	sub    $0x28,%esp
+  801d43:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  801d46:	57                   	push   %edi
+  801d47:	e8 f7 ea ff ff       	call   800843 <strlen>
+  801d4c:	83 c4 10             	add    $0x10,%esp
+  801d4f:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801d54:	0f 87 f6 00 00 00    	ja     801e50 <open_read+0x116>
+  801d5a:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  801d5c:	83 ec 0c             	sub    $0xc,%esp
+  801d5f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801d62:	50                   	push   %eax
+  801d63:	e8 18 f4 ff ff       	call   801180 <fd_alloc>
+  801d68:	89 c3                	mov    %eax,%ebx
+  801d6a:	83 c4 10             	add    $0x10,%esp
+  801d6d:	85 c0                	test   %eax,%eax
+  801d6f:	0f 88 b2 00 00 00    	js     801e27 <open_read+0xed>
+  strcpy(req->req_buf, path);
+  801d75:	83 ec 08             	sub    $0x8,%esp
+  801d78:	57                   	push   %edi
+  801d79:	68 e4 60 80 00       	push   $0x8060e4
+  801d7e:	e8 fb ea ff ff       	call   80087e <strcpy>
+  req->req_nops = 2;
+  801d83:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  801d8a:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  801d8d:	c7 05 04 60 80 00 01 	movl   $0x1,0x806004
+  801d94:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  801d97:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d9a:	a3 10 60 80 00       	mov    %eax,0x806010
+  req->req_ops[0].op_buf = 0;
+  801d9f:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  801da6:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  801da9:	c7 05 20 60 80 00 04 	movl   $0x4,0x806020
+  801db0:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  801db3:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  801dba:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  801dbd:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  801dc2:	29 f0                	sub    %esi,%eax
+  801dc4:	3b 45 14             	cmp    0x14(%ebp),%eax
+  801dc7:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  801dcb:	a3 2c 60 80 00       	mov    %eax,0x80602c
+  req->req_ops[1].op_offset = 0;
+  801dd0:	c7 05 30 60 80 00 00 	movl   $0x0,0x806030
+  801dd7:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  801dda:	83 c6 01             	add    $0x1,%esi
+  801ddd:	89 35 34 60 80 00    	mov    %esi,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  801de3:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801de6:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801deb:	e8 2a fa ff ff       	call   80181a <fsipc>
+  801df0:	89 c3                	mov    %eax,%ebx
+  801df2:	83 c4 10             	add    $0x10,%esp
+  801df5:	83 f8 01             	cmp    $0x1,%eax
+  801df8:	7e 37                	jle    801e31 <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  801dfa:	a1 38 60 80 00       	mov    0x806038,%eax
+  801dff:	8b 55 18             	mov    0x18(%ebp),%edx
+  801e02:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  801e04:	83 ec 04             	sub    $0x4,%esp
+  801e07:	50                   	push   %eax
+  801e08:	81 c6 e4 60 80 00    	add    $0x8060e4,%esi
+  801e0e:	56                   	push   %esi
+  801e0f:	ff 75 10             	push   0x10(%ebp)
+  801e12:	e8 ed eb ff ff       	call   800a04 <memmove>
+  return fd2num(fd);
+  801e17:	83 c4 04             	add    $0x4,%esp
+  801e1a:	ff 75 e4             	push   -0x1c(%ebp)
+  801e1d:	e8 3a f3 ff ff       	call   80115c <fd2num>
+  801e22:	89 c3                	mov    %eax,%ebx
+  801e24:	83 c4 10             	add    $0x10,%esp
+}
+  801e27:	89 d8                	mov    %ebx,%eax
+  801e29:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e2c:	5b                   	pop    %ebx
+  801e2d:	5e                   	pop    %esi
+  801e2e:	5f                   	pop    %edi
+  801e2f:	5d                   	pop    %ebp
+  801e30:	c3                   	ret
+    fd_close(fd, 0);
+  801e31:	83 ec 08             	sub    $0x8,%esp
+  801e34:	6a 00                	push   $0x0
+  801e36:	ff 75 e4             	push   -0x1c(%ebp)
+  801e39:	e8 34 f4 ff ff       	call   801272 <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  801e3e:	83 c4 10             	add    $0x10,%esp
+  801e41:	85 db                	test   %ebx,%ebx
+  801e43:	78 e2                	js     801e27 <open_read+0xed>
+  801e45:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  801e48:	8b 9b 1c 60 80 00    	mov    0x80601c(%ebx),%ebx
+  801e4e:	eb d7                	jmp    801e27 <open_read+0xed>
+    return -E_BAD_PATH;
+  801e50:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801e55:	eb d0                	jmp    801e27 <open_read+0xed>
+
+00801e57 <file_stat>:
+{
+  801e57:	55                   	push   %ebp
+  801e58:	89 e5                	mov    %esp,%ebp
+  801e5a:	57                   	push   %edi
+  801e5b:	56                   	push   %esi
+  801e5c:	53                   	push   %ebx
+  801e5d:	83 ec 18             	sub    $0x18,%esp
+  801e60:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801e63:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801e66:	57                   	push   %edi
+  801e67:	e8 d7 e9 ff ff       	call   800843 <strlen>
+  801e6c:	83 c4 10             	add    $0x10,%esp
+  801e6f:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801e74:	0f 8f c7 00 00 00    	jg     801f41 <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  801e7a:	83 ec 0c             	sub    $0xc,%esp
+  801e7d:	57                   	push   %edi
+  801e7e:	e8 c0 e9 ff ff       	call   800843 <strlen>
+  801e83:	8d 58 04             	lea    0x4(%eax),%ebx
+  801e86:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  801e89:	83 c4 08             	add    $0x8,%esp
+  801e8c:	57                   	push   %edi
+  801e8d:	68 e4 60 80 00       	push   $0x8060e4
+  801e92:	e8 e7 e9 ff ff       	call   80087e <strcpy>
+  req->req_nops = 2;
+  801e97:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  801e9e:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  801ea1:	c7 05 04 60 80 00 02 	movl   $0x2,0x806004
+  801ea8:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  801eab:	c7 05 10 60 80 00 00 	movl   $0x0,0x806010
+  801eb2:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  801eb5:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  801ebc:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  801ebf:	c7 05 20 60 80 00 03 	movl   $0x3,0x806020
+  801ec6:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  801ec9:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  801ed0:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  801ed3:	89 1d 34 60 80 00    	mov    %ebx,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  801ed9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ede:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801ee3:	e8 32 f9 ff ff       	call   80181a <fsipc>
+  801ee8:	83 c4 10             	add    $0x10,%esp
+  801eeb:	83 f8 01             	cmp    $0x1,%eax
+  801eee:	7e 42                	jle    801f32 <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  801ef0:	81 c3 e4 60 80 00    	add    $0x8060e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  801ef6:	83 ec 08             	sub    $0x8,%esp
+  801ef9:	53                   	push   %ebx
+  801efa:	56                   	push   %esi
+  801efb:	e8 7e e9 ff ff       	call   80087e <strcpy>
+  st->st_size = ret->ret_size;
+  801f00:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  801f06:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  801f0c:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  801f12:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  801f18:	c7 86 88 00 00 00 04 	movl   $0x804004,0x88(%esi)
+  801f1f:	40 80 00 
+  return 0;
+  801f22:	83 c4 10             	add    $0x10,%esp
+  801f25:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f2a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f2d:	5b                   	pop    %ebx
+  801f2e:	5e                   	pop    %esi
+  801f2f:	5f                   	pop    %edi
+  801f30:	5d                   	pop    %ebp
+  801f31:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  801f32:	85 c0                	test   %eax,%eax
+  801f34:	78 f4                	js     801f2a <file_stat+0xd3>
+  801f36:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801f39:	8b 80 1c 60 80 00    	mov    0x80601c(%eax),%eax
+  801f3f:	eb e9                	jmp    801f2a <file_stat+0xd3>
+    return -E_BAD_PATH;
+  801f41:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801f46:	eb e2                	jmp    801f2a <file_stat+0xd3>
+
+00801f48 <read_map>:
+{
+  801f48:	55                   	push   %ebp
+  801f49:	89 e5                	mov    %esp,%ebp
+  801f4b:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801f4e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f51:	50                   	push   %eax
+  801f52:	ff 75 08             	push   0x8(%ebp)
+  801f55:	e8 7c f2 ff ff       	call   8011d6 <fd_lookup>
+  801f5a:	83 c4 10             	add    $0x10,%esp
+  801f5d:	85 c0                	test   %eax,%eax
+  801f5f:	78 2a                	js     801f8b <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  801f61:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f64:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  801f6a:	39 08                	cmp    %ecx,(%eax)
+  801f6c:	75 1f                	jne    801f8d <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  801f6e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f71:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read_map.req_offset = offset;
+  801f76:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f79:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  801f7e:	8b 55 10             	mov    0x10(%ebp),%edx
+  801f81:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801f86:	e8 8f f8 ff ff       	call   80181a <fsipc>
+}
+  801f8b:	c9                   	leave
+  801f8c:	c3                   	ret
+    return -E_INVAL;
+  801f8d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f92:	eb f7                	jmp    801f8b <read_map+0x43>
+
+00801f94 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801f94:	55                   	push   %ebp
+  801f95:	89 e5                	mov    %esp,%ebp
+  801f97:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  801f9a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f9f:	b8 08 00 00 00       	mov    $0x8,%eax
+  801fa4:	e8 71 f8 ff ff       	call   80181a <fsipc>
+}
+  801fa9:	c9                   	leave
+  801faa:	c3                   	ret
+
+00801fab <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  801fab:	55                   	push   %ebp
+  801fac:	89 e5                	mov    %esp,%ebp
+  801fae:	57                   	push   %edi
+  801faf:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  801fb0:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fb3:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.stats.req_bio_sched = 0;
+  801fb8:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  801fbf:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  801fc2:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  801fc9:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  801fcc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fd1:	b8 09 00 00 00       	mov    $0x9,%eax
+  801fd6:	e8 3f f8 ff ff       	call   80181a <fsipc>
+  801fdb:	85 c0                	test   %eax,%eax
+  801fdd:	78 14                	js     801ff3 <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  801fdf:	be 00 60 80 00       	mov    $0x806000,%esi
+  801fe4:	b9 16 00 00 00       	mov    $0x16,%ecx
+  801fe9:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801fec:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  801fee:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ff3:	5e                   	pop    %esi
+  801ff4:	5f                   	pop    %edi
+  801ff5:	5d                   	pop    %ebp
+  801ff6:	c3                   	ret
+
+00801ff7 <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  801ff7:	55                   	push   %ebp
+  801ff8:	89 e5                	mov    %esp,%ebp
+  801ffa:	53                   	push   %ebx
+  801ffb:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  801ffe:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802001:	50                   	push   %eax
+  802002:	6a 00                	push   $0x0
+  802004:	e8 a2 ff ff ff       	call   801fab <fs_stats>
+  802009:	83 c4 10             	add    $0x10,%esp
+  80200c:	85 c0                	test   %eax,%eax
+  80200e:	78 28                	js     802038 <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  802010:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  802013:	83 ec 08             	sub    $0x8,%esp
+  802016:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802019:	50                   	push   %eax
+  80201a:	6a 20                	push   $0x20
+  80201c:	e8 8a ff ff ff       	call   801fab <fs_stats>
+  802021:	83 c4 10             	add    $0x10,%esp
+  802024:	85 c0                	test   %eax,%eax
+  802026:	78 10                	js     802038 <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  802028:	83 ec 08             	sub    $0x8,%esp
+  80202b:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  80202e:	50                   	push   %eax
+  80202f:	53                   	push   %ebx
+  802030:	e8 76 ff ff ff       	call   801fab <fs_stats>
+  802035:	83 c4 10             	add    $0x10,%esp
+}
+  802038:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80203b:	c9                   	leave
+  80203c:	c3                   	ret
+
+0080203d <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  80203d:	55                   	push   %ebp
+  80203e:	89 e5                	mov    %esp,%ebp
+  802040:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  802043:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  80204a:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  80204d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802050:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.stats.req_dcache = 0;
+  802055:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  80205c:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  80205f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802064:	b8 09 00 00 00       	mov    $0x9,%eax
+  802069:	e8 ac f7 ff ff       	call   80181a <fsipc>
+}
+  80206e:	c9                   	leave
+  80206f:	c3                   	ret
+
+00802070 <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  802070:	55                   	push   %ebp
+  802071:	89 e5                	mov    %esp,%ebp
+  802073:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  802076:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  80207d:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  802080:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  802087:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  80208a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80208d:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_STATS, NULL);
+  802092:	ba 00 00 00 00       	mov    $0x0,%edx
+  802097:	b8 09 00 00 00       	mov    $0x9,%eax
+  80209c:	e8 79 f7 ff ff       	call   80181a <fsipc>
+}
+  8020a1:	c9                   	leave
+  8020a2:	c3                   	ret
+
+008020a3 <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  8020a3:	55                   	push   %ebp
+  8020a4:	89 e5                	mov    %esp,%ebp
+  8020a6:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8020a9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020ac:	50                   	push   %eax
+  8020ad:	ff 75 08             	push   0x8(%ebp)
+  8020b0:	e8 21 f1 ff ff       	call   8011d6 <fd_lookup>
+  8020b5:	83 c4 10             	add    $0x10,%esp
+  8020b8:	85 c0                	test   %eax,%eax
+  8020ba:	78 34                	js     8020f0 <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  8020bc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020bf:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  8020c5:	39 08                	cmp    %ecx,(%eax)
+  8020c7:	75 29                	jne    8020f2 <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  8020c9:	8b 40 0c             	mov    0xc(%eax),%eax
+  8020cc:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.fallocate.req_offset = offset;
+  8020d1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020d4:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.fallocate.req_len = len;
+  8020d9:	8b 45 10             	mov    0x10(%ebp),%eax
+  8020dc:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  8020e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020e6:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8020eb:	e8 2a f7 ff ff       	call   80181a <fsipc>
+}
+  8020f0:	c9                   	leave
+  8020f1:	c3                   	ret
+    return -E_INVAL;
+  8020f2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020f7:	eb f7                	jmp    8020f0 <fallocate+0x4d>
+
+008020f9 <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  8020f9:	55                   	push   %ebp
+  8020fa:	89 e5                	mov    %esp,%ebp
+  8020fc:	57                   	push   %edi
+  8020fd:	56                   	push   %esi
+  8020fe:	53                   	push   %ebx
+  8020ff:	83 ec 24             	sub    $0x24,%esp
+  802102:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802105:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802108:	50                   	push   %eax
+  802109:	ff 75 08             	push   0x8(%ebp)
+  80210c:	e8 c5 f0 ff ff       	call   8011d6 <fd_lookup>
+  802111:	83 c4 10             	add    $0x10,%esp
+  802114:	85 c0                	test   %eax,%eax
+  802116:	78 66                	js     80217e <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  802118:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80211b:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  802121:	39 08                	cmp    %ecx,(%eax)
+  802123:	75 61                	jne    802186 <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  802125:	85 f6                	test   %esi,%esi
+  802127:	7e 50                	jle    802179 <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  802129:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  80212e:	39 de                	cmp    %ebx,%esi
+  802130:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  802133:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802136:	8b 40 0c             	mov    0xc(%eax),%eax
+  802139:	a3 00 60 80 00       	mov    %eax,0x806000
+    fsipcbuf.prefetch.req_n = m;
+  80213e:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  802144:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  80214b:	83 ec 04             	sub    $0x4,%esp
+  80214e:	57                   	push   %edi
+  80214f:	ff 75 0c             	push   0xc(%ebp)
+  802152:	68 08 60 80 00       	push   $0x806008
+  802157:	e8 a8 e8 ff ff       	call   800a04 <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  80215c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802161:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802166:	e8 af f6 ff ff       	call   80181a <fsipc>
+  80216b:	83 c4 10             	add    $0x10,%esp
+  80216e:	85 c0                	test   %eax,%eax
+  802170:	78 0c                	js     80217e <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  802172:	01 7d 0c             	add    %edi,0xc(%ebp)
+  802175:	29 de                	sub    %ebx,%esi
+  802177:	eb ac                	jmp    802125 <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  802179:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80217e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802181:	5b                   	pop    %ebx
+  802182:	5e                   	pop    %esi
+  802183:	5f                   	pop    %edi
+  802184:	5d                   	pop    %ebp
+  802185:	c3                   	ret
+    return -E_INVAL;
+  802186:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80218b:	eb f1                	jmp    80217e <prefetch+0x85>
+
+0080218d <writebuf>:
+
+
+static void
+writebuf(struct printbuf *b)
+{
+  if (b->error > 0) {
+  80218d:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802191:	7f 01                	jg     802194 <writebuf+0x7>
+  802193:	c3                   	ret
+{
+  802194:	55                   	push   %ebp
+  802195:	89 e5                	mov    %esp,%ebp
+  802197:	53                   	push   %ebx
+  802198:	83 ec 08             	sub    $0x8,%esp
+  80219b:	89 c3                	mov    %eax,%ebx
+    ssize_t result = write(b->fd, b->buf, b->idx);
+  80219d:	ff 70 04             	push   0x4(%eax)
+  8021a0:	8d 40 10             	lea    0x10(%eax),%eax
+  8021a3:	50                   	push   %eax
+  8021a4:	ff 33                	push   (%ebx)
+  8021a6:	e8 a4 f3 ff ff       	call   80154f <write>
+    if (result > 0)
+  8021ab:	83 c4 10             	add    $0x10,%esp
+  8021ae:	85 c0                	test   %eax,%eax
+  8021b0:	7e 03                	jle    8021b5 <writebuf+0x28>
+      b->result += result;
+  8021b2:	01 43 08             	add    %eax,0x8(%ebx)
+    if (result != b->idx)             // error, or wrote less than supplied
+  8021b5:	39 43 04             	cmp    %eax,0x4(%ebx)
+  8021b8:	74 0d                	je     8021c7 <writebuf+0x3a>
+      b->error = (result < 0 ? result : 0);
+  8021ba:	85 c0                	test   %eax,%eax
+  8021bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021c1:	0f 4f c2             	cmovg  %edx,%eax
+  8021c4:	89 43 0c             	mov    %eax,0xc(%ebx)
+  }
+}
+  8021c7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021ca:	c9                   	leave
+  8021cb:	c3                   	ret
+
+008021cc <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  8021cc:	55                   	push   %ebp
+  8021cd:	89 e5                	mov    %esp,%ebp
+  8021cf:	53                   	push   %ebx
+  8021d0:	83 ec 04             	sub    $0x4,%esp
+  8021d3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct printbuf *b = (struct printbuf *)thunk;
+
+  b->buf[b->idx++] = ch;
+  8021d6:	8b 53 04             	mov    0x4(%ebx),%edx
+  8021d9:	8d 42 01             	lea    0x1(%edx),%eax
+  8021dc:	89 43 04             	mov    %eax,0x4(%ebx)
+  8021df:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8021e2:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+  if (b->idx == 256) {
+  8021e6:	3d 00 01 00 00       	cmp    $0x100,%eax
+  8021eb:	74 05                	je     8021f2 <putch+0x26>
+    writebuf(b);
+    b->idx = 0;
+  }
+}
+  8021ed:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021f0:	c9                   	leave
+  8021f1:	c3                   	ret
+    writebuf(b);
+  8021f2:	89 d8                	mov    %ebx,%eax
+  8021f4:	e8 94 ff ff ff       	call   80218d <writebuf>
+    b->idx = 0;
+  8021f9:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+  802200:	eb eb                	jmp    8021ed <putch+0x21>
+
+00802202 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap)
+{
+  802202:	55                   	push   %ebp
+  802203:	89 e5                	mov    %esp,%ebp
+  802205:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.fd = fd;
+  80220b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80220e:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+  b.idx = 0;
+  802214:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  80221b:	00 00 00 
+  b.result = 0;
+  80221e:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  802225:	00 00 00 
+  b.error = 1;
+  802228:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  80222f:	00 00 00 
+  vprintfmt(putch, &b, fmt, ap);
+  802232:	ff 75 10             	push   0x10(%ebp)
+  802235:	ff 75 0c             	push   0xc(%ebp)
+  802238:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  80223e:	50                   	push   %eax
+  80223f:	68 cc 21 80 00       	push   $0x8021cc
+  802244:	e8 3e e1 ff ff       	call   800387 <vprintfmt>
+  if (b.idx > 0)
+  802249:	83 c4 10             	add    $0x10,%esp
+  80224c:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  802253:	7f 12                	jg     802267 <vfprintf+0x65>
+    writebuf(&b);
+
+  return b.result ? b.result : b.error;
+  802255:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  80225b:	85 c0                	test   %eax,%eax
+  80225d:	75 06                	jne    802265 <vfprintf+0x63>
+  80225f:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+}
+  802265:	c9                   	leave
+  802266:	c3                   	ret
+    writebuf(&b);
+  802267:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  80226d:	e8 1b ff ff ff       	call   80218d <writebuf>
+  802272:	eb e1                	jmp    802255 <vfprintf+0x53>
+
+00802274 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...)
+{
+  802274:	55                   	push   %ebp
+  802275:	89 e5                	mov    %esp,%ebp
+  802277:	83 ec 0c             	sub    $0xc,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  80227a:	8d 45 10             	lea    0x10(%ebp),%eax
+  cnt = vfprintf(fd, fmt, ap);
+  80227d:	50                   	push   %eax
+  80227e:	ff 75 0c             	push   0xc(%ebp)
+  802281:	ff 75 08             	push   0x8(%ebp)
+  802284:	e8 79 ff ff ff       	call   802202 <vfprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  802289:	c9                   	leave
+  80228a:	c3                   	ret
+
+0080228b <printf>:
+
+int
+printf(const char *fmt, ...)
+{
+  80228b:	55                   	push   %ebp
+  80228c:	89 e5                	mov    %esp,%ebp
+  80228e:	83 ec 0c             	sub    $0xc,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  802291:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vfprintf(1, fmt, ap);
+  802294:	50                   	push   %eax
+  802295:	ff 75 08             	push   0x8(%ebp)
+  802298:	6a 01                	push   $0x1
+  80229a:	e8 63 ff ff ff       	call   802202 <vfprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  80229f:	c9                   	leave
+  8022a0:	c3                   	ret
+
+008022a1 <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  8022a1:	55                   	push   %ebp
+  8022a2:	89 e5                	mov    %esp,%ebp
+  8022a4:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  8022a7:	50                   	push   %eax
+  8022a8:	e8 bf ee ff ff       	call   80116c <fd2data>
+  8022ad:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  8022b2:	c9                   	leave
+  8022b3:	c3                   	ret
+
+008022b4 <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8022b4:	55                   	push   %ebp
+  8022b5:	89 e5                	mov    %esp,%ebp
+  8022b7:	56                   	push   %esi
+  8022b8:	53                   	push   %ebx
+  8022b9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  8022bc:	83 ec 0c             	sub    $0xc,%esp
+  8022bf:	ff 75 08             	push   0x8(%ebp)
+  8022c2:	e8 a5 ee ff ff       	call   80116c <fd2data>
+  8022c7:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  8022c9:	83 c4 08             	add    $0x8,%esp
+  8022cc:	68 08 36 80 00       	push   $0x803608
+  8022d1:	53                   	push   %ebx
+  8022d2:	e8 a7 e5 ff ff       	call   80087e <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  8022d7:	8b 46 04             	mov    0x4(%esi),%eax
+  8022da:	2b 06                	sub    (%esi),%eax
+  8022dc:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  8022e2:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8022e9:	00 00 00 
+  stat->st_dev = &devpipe;
+  8022ec:	c7 83 88 00 00 00 20 	movl   $0x804020,0x88(%ebx)
+  8022f3:	40 80 00 
+  return 0;
+}
+  8022f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022fb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022fe:	5b                   	pop    %ebx
+  8022ff:	5e                   	pop    %esi
+  802300:	5d                   	pop    %ebp
+  802301:	c3                   	ret
+
+00802302 <pipe_wakeup>:
+{
+  802302:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  802304:	b8 00 00 00 00       	mov    $0x0,%eax
+  802309:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  80230c:	85 c0                	test   %eax,%eax
+  80230e:	75 01                	jne    802311 <pipe_wakeup+0xf>
+  802310:	c3                   	ret
+{
+  802311:	55                   	push   %ebp
+  802312:	89 e5                	mov    %esp,%ebp
+  802314:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  802317:	6a 00                	push   $0x0
+  802319:	68 00 00 c0 ee       	push   $0xeec00000
+  80231e:	52                   	push   %edx
+  80231f:	e8 e5 ec ff ff       	call   801009 <sys_chan_wakeup>
+  802324:	83 c4 10             	add    $0x10,%esp
+}
+  802327:	c9                   	leave
+  802328:	c3                   	ret
+
+00802329 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802329:	55                   	push   %ebp
+  80232a:	89 e5                	mov    %esp,%ebp
+  80232c:	57                   	push   %edi
+  80232d:	56                   	push   %esi
+  80232e:	53                   	push   %ebx
+  80232f:	83 ec 18             	sub    $0x18,%esp
+  802332:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  802335:	57                   	push   %edi
+  802336:	e8 31 ee ff ff       	call   80116c <fd2data>
+  80233b:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  80233d:	83 c4 10             	add    $0x10,%esp
+  802340:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  802344:	74 2a                	je     802370 <devpipe_close+0x47>
+  802346:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  80234b:	89 f8                	mov    %edi,%eax
+  80234d:	e8 4f ff ff ff       	call   8022a1 <pipe_ring>
+  802352:	83 ec 08             	sub    $0x8,%esp
+  802355:	01 d8                	add    %ebx,%eax
+  802357:	50                   	push   %eax
+  802358:	6a 00                	push   $0x0
+  80235a:	e8 d3 e9 ff ff       	call   800d32 <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  80235f:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802365:	83 c4 10             	add    $0x10,%esp
+  802368:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  80236e:	75 db                	jne    80234b <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  802370:	83 ec 08             	sub    $0x8,%esp
+  802373:	57                   	push   %edi
+  802374:	6a 00                	push   $0x0
+  802376:	e8 b7 e9 ff ff       	call   800d32 <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  80237b:	83 c4 10             	add    $0x10,%esp
+  80237e:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  802382:	75 13                	jne    802397 <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  802384:	83 ec 08             	sub    $0x8,%esp
+  802387:	56                   	push   %esi
+  802388:	6a 00                	push   $0x0
+  80238a:	e8 a3 e9 ff ff       	call   800d32 <sys_page_unmap>
+}
+  80238f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802392:	5b                   	pop    %ebx
+  802393:	5e                   	pop    %esi
+  802394:	5f                   	pop    %edi
+  802395:	5d                   	pop    %ebp
+  802396:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802397:	8d 56 04             	lea    0x4(%esi),%edx
+  80239a:	8d 46 2c             	lea    0x2c(%esi),%eax
+  80239d:	e8 60 ff ff ff       	call   802302 <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8023a2:	8d 46 30             	lea    0x30(%esi),%eax
+  8023a5:	89 f2                	mov    %esi,%edx
+  8023a7:	e8 56 ff ff ff       	call   802302 <pipe_wakeup>
+  8023ac:	eb d6                	jmp    802384 <devpipe_close+0x5b>
+
+008023ae <_pipeisclosed>:
+{
+  8023ae:	55                   	push   %ebp
+  8023af:	89 e5                	mov    %esp,%ebp
+  8023b1:	57                   	push   %edi
+  8023b2:	56                   	push   %esi
+  8023b3:	53                   	push   %ebx
+  8023b4:	83 ec 1c             	sub    $0x1c,%esp
+  8023b7:	89 c7                	mov    %eax,%edi
+  8023b9:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  8023bb:	a1 44 57 80 00       	mov    0x805744,%eax
+  8023c0:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  8023c3:	83 ec 0c             	sub    $0xc,%esp
+  8023c6:	57                   	push   %edi
+  8023c7:	e8 18 0a 00 00       	call   802de4 <pageref>
+  8023cc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8023cf:	89 34 24             	mov    %esi,(%esp)
+  8023d2:	e8 0d 0a 00 00       	call   802de4 <pageref>
+    nn = thisenv->env_runs;
+  8023d7:	8b 15 44 57 80 00    	mov    0x805744,%edx
+  8023dd:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  8023e0:	83 c4 10             	add    $0x10,%esp
+  8023e3:	39 cb                	cmp    %ecx,%ebx
+  8023e5:	74 1b                	je     802402 <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  8023e7:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8023ea:	75 cf                	jne    8023bb <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8023ec:	8b 42 58             	mov    0x58(%edx),%eax
+  8023ef:	6a 01                	push   $0x1
+  8023f1:	50                   	push   %eax
+  8023f2:	53                   	push   %ebx
+  8023f3:	68 0f 36 80 00       	push   $0x80360f
+  8023f8:	e8 93 de ff ff       	call   800290 <cprintf>
+  8023fd:	83 c4 10             	add    $0x10,%esp
+  802400:	eb b9                	jmp    8023bb <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  802402:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802405:	0f 94 c0             	sete   %al
+  802408:	0f b6 c0             	movzbl %al,%eax
+}
+  80240b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80240e:	5b                   	pop    %ebx
+  80240f:	5e                   	pop    %esi
+  802410:	5f                   	pop    %edi
+  802411:	5d                   	pop    %ebp
+  802412:	c3                   	ret
+
+00802413 <devpipe_write_bulk>:
+{
+  802413:	55                   	push   %ebp
+  802414:	89 e5                	mov    %esp,%ebp
+  802416:	57                   	push   %edi
+  802417:	56                   	push   %esi
+  802418:	53                   	push   %ebx
+  802419:	83 ec 1c             	sub    $0x1c,%esp
+  80241c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80241f:	89 d6                	mov    %edx,%esi
+  802421:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  802424:	e8 78 fe ff ff       	call   8022a1 <pipe_ring>
+  802429:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  80242c:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802431:	8d 46 04             	lea    0x4(%esi),%eax
+  802434:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  802437:	eb 75                	jmp    8024ae <devpipe_write_bulk+0x9b>
+  802439:	b8 01 00 00 00       	mov    $0x1,%eax
+  80243e:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802442:	6a 64                	push   $0x64
+  802444:	68 00 00 c0 ee       	push   $0xeec00000
+  802449:	53                   	push   %ebx
+  80244a:	56                   	push   %esi
+  80244b:	e8 96 eb ff ff       	call   800fe6 <sys_chan_sleep>
+      continue;
+  802450:	83 c4 10             	add    $0x10,%esp
+  802453:	eb 59                	jmp    8024ae <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  802455:	89 d1                	mov    %edx,%ecx
+  802457:	c1 f9 1f             	sar    $0x1f,%ecx
+  80245a:	c1 e9 11             	shr    $0x11,%ecx
+  80245d:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802460:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802465:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  802467:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  80246d:	29 d3                	sub    %edx,%ebx
+  80246f:	ba 00 80 00 00       	mov    $0x8000,%edx
+  802474:	29 c2                	sub    %eax,%edx
+  802476:	39 d3                	cmp    %edx,%ebx
+  802478:	0f 47 da             	cmova  %edx,%ebx
+  80247b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80247e:	29 fa                	sub    %edi,%edx
+  802480:	39 d3                	cmp    %edx,%ebx
+  802482:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  802485:	83 ec 04             	sub    $0x4,%esp
+  802488:	53                   	push   %ebx
+  802489:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80248c:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  80248f:	52                   	push   %edx
+  802490:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802493:	01 c8                	add    %ecx,%eax
+  802495:	50                   	push   %eax
+  802496:	e8 cb e5 ff ff       	call   800a66 <memcpy>
+    i += m;
+  80249b:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  80249d:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  8024a0:	8d 46 2c             	lea    0x2c(%esi),%eax
+  8024a3:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8024a6:	e8 57 fe ff ff       	call   802302 <pipe_wakeup>
+  8024ab:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  8024ae:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  8024b1:	73 2b                	jae    8024de <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  8024b3:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  8024b5:	8b 56 04             	mov    0x4(%esi),%edx
+  8024b8:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  8024be:	39 d0                	cmp    %edx,%eax
+  8024c0:	7d 93                	jge    802455 <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  8024c2:	89 f2                	mov    %esi,%edx
+  8024c4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8024c7:	e8 e2 fe ff ff       	call   8023ae <_pipeisclosed>
+  8024cc:	85 c0                	test   %eax,%eax
+  8024ce:	0f 84 65 ff ff ff    	je     802439 <devpipe_write_bulk+0x26>
+        return i;
+  8024d4:	89 f8                	mov    %edi,%eax
+}
+  8024d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024d9:	5b                   	pop    %ebx
+  8024da:	5e                   	pop    %esi
+  8024db:	5f                   	pop    %edi
+  8024dc:	5d                   	pop    %ebp
+  8024dd:	c3                   	ret
+  return i;
+  8024de:	89 f8                	mov    %edi,%eax
+  8024e0:	eb f4                	jmp    8024d6 <devpipe_write_bulk+0xc3>
+
+008024e2 <devpipe_write>:
+{
+  8024e2:	55                   	push   %ebp
+  8024e3:	89 e5                	mov    %esp,%ebp
+  8024e5:	57                   	push   %edi
+  8024e6:	56                   	push   %esi
+  8024e7:	53                   	push   %ebx
+  8024e8:	83 ec 28             	sub    $0x28,%esp
+  8024eb:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  8024ee:	56                   	push   %esi
+  8024ef:	e8 78 ec ff ff       	call   80116c <fd2data>
+  8024f4:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  8024f6:	8b 78 28             	mov    0x28(%eax),%edi
+  8024f9:	83 c4 10             	add    $0x10,%esp
+  8024fc:	85 ff                	test   %edi,%edi
+  8024fe:	75 25                	jne    802525 <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  802500:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802503:	74 66                	je     80256b <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802505:	8b 43 04             	mov    0x4(%ebx),%eax
+  802508:	8b 0b                	mov    (%ebx),%ecx
+  80250a:	8d 51 20             	lea    0x20(%ecx),%edx
+  80250d:	39 d0                	cmp    %edx,%eax
+  80250f:	72 2b                	jb     80253c <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  802511:	89 da                	mov    %ebx,%edx
+  802513:	89 f0                	mov    %esi,%eax
+  802515:	e8 94 fe ff ff       	call   8023ae <_pipeisclosed>
+  80251a:	85 c0                	test   %eax,%eax
+  80251c:	75 51                	jne    80256f <devpipe_write+0x8d>
+      sys_yield();
+  80251e:	e8 28 e7 ff ff       	call   800c4b <sys_yield>
+  802523:	eb e0                	jmp    802505 <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  802525:	83 ec 0c             	sub    $0xc,%esp
+  802528:	ff 75 10             	push   0x10(%ebp)
+  80252b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80252e:	89 c2                	mov    %eax,%edx
+  802530:	89 f0                	mov    %esi,%eax
+  802532:	e8 dc fe ff ff       	call   802413 <devpipe_write_bulk>
+  802537:	83 c4 10             	add    $0x10,%esp
+  80253a:	eb 38                	jmp    802574 <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80253c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80253f:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802543:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802546:	89 c2                	mov    %eax,%edx
+  802548:	c1 fa 1f             	sar    $0x1f,%edx
+  80254b:	89 d1                	mov    %edx,%ecx
+  80254d:	c1 e9 1b             	shr    $0x1b,%ecx
+  802550:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802553:	83 e2 1f             	and    $0x1f,%edx
+  802556:	29 ca                	sub    %ecx,%edx
+  802558:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  80255c:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  802560:	83 c0 01             	add    $0x1,%eax
+  802563:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  802566:	83 c7 01             	add    $0x1,%edi
+  802569:	eb 95                	jmp    802500 <devpipe_write+0x1e>
+  return i;
+  80256b:	89 f8                	mov    %edi,%eax
+  80256d:	eb 05                	jmp    802574 <devpipe_write+0x92>
+        return 0;
+  80256f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802574:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802577:	5b                   	pop    %ebx
+  802578:	5e                   	pop    %esi
+  802579:	5f                   	pop    %edi
+  80257a:	5d                   	pop    %ebp
+  80257b:	c3                   	ret
+
+0080257c <devpipe_read_bulk>:
+{
+  80257c:	55                   	push   %ebp
+  80257d:	89 e5                	mov    %esp,%ebp
+  80257f:	57                   	push   %edi
+  802580:	56                   	push   %esi
+  802581:	53                   	push   %ebx
+  802582:	83 ec 2c             	sub    $0x2c,%esp
+  802585:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802588:	89 d6                	mov    %edx,%esi
+  80258a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80258d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  802590:	e8 0c fd ff ff       	call   8022a1 <pipe_ring>
+  802595:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  802598:	85 db                	test   %ebx,%ebx
+  80259a:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80259f:	0f 45 c3             	cmovne %ebx,%eax
+  8025a2:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8025a5:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8025aa:	8d 46 30             	lea    0x30(%esi),%eax
+  8025ad:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  8025b0:	eb 50                	jmp    802602 <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  8025b2:	89 d1                	mov    %edx,%ecx
+  8025b4:	c1 f9 1f             	sar    $0x1f,%ecx
+  8025b7:	c1 e9 11             	shr    $0x11,%ecx
+  8025ba:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  8025bd:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8025c2:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  8025c4:	29 d3                	sub    %edx,%ebx
+  8025c6:	ba 00 80 00 00       	mov    $0x8000,%edx
+  8025cb:	29 c2                	sub    %eax,%edx
+  8025cd:	39 d3                	cmp    %edx,%ebx
+  8025cf:	0f 47 da             	cmova  %edx,%ebx
+  8025d2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8025d5:	29 fa                	sub    %edi,%edx
+  8025d7:	39 d3                	cmp    %edx,%ebx
+  8025d9:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  8025dc:	83 ec 04             	sub    $0x4,%esp
+  8025df:	53                   	push   %ebx
+  8025e0:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8025e3:	01 c8                	add    %ecx,%eax
+  8025e5:	50                   	push   %eax
+  8025e6:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8025e9:	01 f8                	add    %edi,%eax
+  8025eb:	50                   	push   %eax
+  8025ec:	e8 75 e4 ff ff       	call   800a66 <memcpy>
+    i += m;
+  8025f1:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  8025f3:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8025f5:	89 f2                	mov    %esi,%edx
+  8025f7:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8025fa:	e8 03 fd ff ff       	call   802302 <pipe_wakeup>
+  8025ff:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802602:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802605:	73 51                	jae    802658 <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  802607:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  80260a:	8b 16                	mov    (%esi),%edx
+  80260c:	39 da                	cmp    %ebx,%edx
+  80260e:	75 a2                	jne    8025b2 <devpipe_read_bulk+0x36>
+      if (i > 0)
+  802610:	85 ff                	test   %edi,%edi
+  802612:	75 44                	jne    802658 <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  802614:	89 f2                	mov    %esi,%edx
+  802616:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802619:	e8 90 fd ff ff       	call   8023ae <_pipeisclosed>
+  80261e:	85 c0                	test   %eax,%eax
+  802620:	75 3a                	jne    80265c <devpipe_read_bulk+0xe0>
+  802622:	b8 01 00 00 00       	mov    $0x1,%eax
+  802627:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  80262b:	6a 64                	push   $0x64
+  80262d:	ff 75 d4             	push   -0x2c(%ebp)
+  802630:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  802631:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802634:	50                   	push   %eax
+  802635:	e8 ac e9 ff ff       	call   800fe6 <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  80263a:	85 c0                	test   %eax,%eax
+  80263c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802641:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  802644:	83 c4 10             	add    $0x10,%esp
+  802647:	a8 01                	test   $0x1,%al
+  802649:	74 b7                	je     802602 <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  80264b:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  802650:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802653:	5b                   	pop    %ebx
+  802654:	5e                   	pop    %esi
+  802655:	5f                   	pop    %edi
+  802656:	5d                   	pop    %ebp
+  802657:	c3                   	ret
+  return i;
+  802658:	89 f8                	mov    %edi,%eax
+  80265a:	eb f4                	jmp    802650 <devpipe_read_bulk+0xd4>
+        return 0;
+  80265c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802661:	eb ed                	jmp    802650 <devpipe_read_bulk+0xd4>
+
+00802663 <devpipe_read>:
+{
+  802663:	55                   	push   %ebp
+  802664:	89 e5                	mov    %esp,%ebp
+  802666:	57                   	push   %edi
+  802667:	56                   	push   %esi
+  802668:	53                   	push   %ebx
+  802669:	83 ec 18             	sub    $0x18,%esp
+  80266c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  80266f:	57                   	push   %edi
+  802670:	e8 f7 ea ff ff       	call   80116c <fd2data>
+  802675:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  802677:	8b 70 28             	mov    0x28(%eax),%esi
+  80267a:	83 c4 10             	add    $0x10,%esp
+  80267d:	85 f6                	test   %esi,%esi
+  80267f:	75 24                	jne    8026a5 <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  802681:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802684:	74 60                	je     8026e6 <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  802686:	8b 03                	mov    (%ebx),%eax
+  802688:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80268b:	75 3b                	jne    8026c8 <devpipe_read+0x65>
+      if (i > 0)
+  80268d:	85 f6                	test   %esi,%esi
+  80268f:	75 2d                	jne    8026be <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  802691:	89 da                	mov    %ebx,%edx
+  802693:	89 f8                	mov    %edi,%eax
+  802695:	e8 14 fd ff ff       	call   8023ae <_pipeisclosed>
+  80269a:	85 c0                	test   %eax,%eax
+  80269c:	75 4c                	jne    8026ea <devpipe_read+0x87>
+      sys_yield();
+  80269e:	e8 a8 e5 ff ff       	call   800c4b <sys_yield>
+  8026a3:	eb e1                	jmp    802686 <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  8026a5:	83 ec 08             	sub    $0x8,%esp
+  8026a8:	6a 00                	push   $0x0
+  8026aa:	ff 75 10             	push   0x10(%ebp)
+  8026ad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8026b0:	89 c2                	mov    %eax,%edx
+  8026b2:	89 f8                	mov    %edi,%eax
+  8026b4:	e8 c3 fe ff ff       	call   80257c <devpipe_read_bulk>
+  8026b9:	83 c4 10             	add    $0x10,%esp
+  8026bc:	eb 02                	jmp    8026c0 <devpipe_read+0x5d>
+        return i;
+  8026be:	89 f0                	mov    %esi,%eax
+}
+  8026c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026c3:	5b                   	pop    %ebx
+  8026c4:	5e                   	pop    %esi
+  8026c5:	5f                   	pop    %edi
+  8026c6:	5d                   	pop    %ebp
+  8026c7:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8026c8:	99                   	cltd
+  8026c9:	c1 ea 1b             	shr    $0x1b,%edx
+  8026cc:	01 d0                	add    %edx,%eax
+  8026ce:	83 e0 1f             	and    $0x1f,%eax
+  8026d1:	29 d0                	sub    %edx,%eax
+  8026d3:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8026d8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8026db:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  8026de:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  8026e1:	83 c6 01             	add    $0x1,%esi
+  8026e4:	eb 9b                	jmp    802681 <devpipe_read+0x1e>
+  return i;
+  8026e6:	89 f0                	mov    %esi,%eax
+  8026e8:	eb d6                	jmp    8026c0 <devpipe_read+0x5d>
+        return 0;
+  8026ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026ef:	eb cf                	jmp    8026c0 <devpipe_read+0x5d>
+
+008026f1 <pipe2>:
+{
+  8026f1:	55                   	push   %ebp
+  8026f2:	89 e5                	mov    %esp,%ebp
+  8026f4:	57                   	push   %edi
+  8026f5:	56                   	push   %esi
+  8026f6:	53                   	push   %ebx
+  8026f7:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  8026fa:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8026fd:	50                   	push   %eax
+  8026fe:	e8 7d ea ff ff       	call   801180 <fd_alloc>
+  802703:	89 c3                	mov    %eax,%ebx
+  802705:	83 c4 10             	add    $0x10,%esp
+  802708:	85 c0                	test   %eax,%eax
+  80270a:	0f 88 fb 01 00 00    	js     80290b <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802710:	83 ec 04             	sub    $0x4,%esp
+  802713:	68 07 04 00 00       	push   $0x407
+  802718:	ff 75 e4             	push   -0x1c(%ebp)
+  80271b:	6a 00                	push   $0x0
+  80271d:	e8 8b e5 ff ff       	call   800cad <sys_page_alloc>
+  802722:	89 c3                	mov    %eax,%ebx
+  802724:	83 c4 10             	add    $0x10,%esp
+  802727:	85 c0                	test   %eax,%eax
+  802729:	0f 88 dc 01 00 00    	js     80290b <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  80272f:	83 ec 0c             	sub    $0xc,%esp
+  802732:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  802735:	50                   	push   %eax
+  802736:	e8 45 ea ff ff       	call   801180 <fd_alloc>
+  80273b:	89 c3                	mov    %eax,%ebx
+  80273d:	83 c4 10             	add    $0x10,%esp
+  802740:	85 c0                	test   %eax,%eax
+  802742:	0f 88 b3 01 00 00    	js     8028fb <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802748:	83 ec 04             	sub    $0x4,%esp
+  80274b:	68 07 04 00 00       	push   $0x407
+  802750:	ff 75 e0             	push   -0x20(%ebp)
+  802753:	6a 00                	push   $0x0
+  802755:	e8 53 e5 ff ff       	call   800cad <sys_page_alloc>
+  80275a:	89 c3                	mov    %eax,%ebx
+  80275c:	83 c4 10             	add    $0x10,%esp
+  80275f:	85 c0                	test   %eax,%eax
+  802761:	0f 88 94 01 00 00    	js     8028fb <pipe2+0x20a>
+  va = fd2data(fd0);
+  802767:	83 ec 0c             	sub    $0xc,%esp
+  80276a:	ff 75 e4             	push   -0x1c(%ebp)
+  80276d:	e8 fa e9 ff ff       	call   80116c <fd2data>
+  802772:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802774:	83 c4 0c             	add    $0xc,%esp
+  802777:	68 07 04 00 00       	push   $0x407
+  80277c:	50                   	push   %eax
+  80277d:	6a 00                	push   $0x0
+  80277f:	e8 29 e5 ff ff       	call   800cad <sys_page_alloc>
+  802784:	89 c3                	mov    %eax,%ebx
+  802786:	83 c4 10             	add    $0x10,%esp
+  802789:	85 c0                	test   %eax,%eax
+  80278b:	0f 88 5a 01 00 00    	js     8028eb <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802791:	83 ec 0c             	sub    $0xc,%esp
+  802794:	ff 75 e0             	push   -0x20(%ebp)
+  802797:	e8 d0 e9 ff ff       	call   80116c <fd2data>
+  80279c:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8027a3:	50                   	push   %eax
+  8027a4:	6a 00                	push   $0x0
+  8027a6:	57                   	push   %edi
+  8027a7:	6a 00                	push   $0x0
+  8027a9:	e8 42 e5 ff ff       	call   800cf0 <sys_page_map>
+  8027ae:	89 c3                	mov    %eax,%ebx
+  8027b0:	83 c4 20             	add    $0x20,%esp
+  8027b3:	85 c0                	test   %eax,%eax
+  8027b5:	0f 88 22 01 00 00    	js     8028dd <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  8027bb:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  8027bf:	74 72                	je     802833 <pipe2+0x142>
+  8027c1:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  8027c6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8027c9:	e8 d3 fa ff ff       	call   8022a1 <pipe_ring>
+  8027ce:	83 ec 04             	sub    $0x4,%esp
+  8027d1:	68 07 04 00 00       	push   $0x407
+  8027d6:	01 f0                	add    %esi,%eax
+  8027d8:	50                   	push   %eax
+  8027d9:	6a 00                	push   $0x0
+  8027db:	e8 cd e4 ff ff       	call   800cad <sys_page_alloc>
+  8027e0:	89 c3                	mov    %eax,%ebx
+  8027e2:	83 c4 10             	add    $0x10,%esp
+  8027e5:	85 c0                	test   %eax,%eax
+  8027e7:	0f 88 97 00 00 00    	js     802884 <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  8027ed:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8027f0:	e8 ac fa ff ff       	call   8022a1 <pipe_ring>
+  8027f5:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  8027f8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8027fb:	e8 a1 fa ff ff       	call   8022a1 <pipe_ring>
+  802800:	83 ec 0c             	sub    $0xc,%esp
+  802803:	68 07 04 00 00       	push   $0x407
+  802808:	53                   	push   %ebx
+  802809:	6a 00                	push   $0x0
+  80280b:	01 f0                	add    %esi,%eax
+  80280d:	50                   	push   %eax
+  80280e:	6a 00                	push   $0x0
+  802810:	e8 db e4 ff ff       	call   800cf0 <sys_page_map>
+  802815:	89 c3                	mov    %eax,%ebx
+  802817:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80281d:	83 c4 20             	add    $0x20,%esp
+  802820:	85 c0                	test   %eax,%eax
+  802822:	78 60                	js     802884 <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  802824:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  80282a:	75 9a                	jne    8027c6 <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  80282c:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  802833:	a1 20 40 80 00       	mov    0x804020,%eax
+  802838:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80283b:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  80283d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802840:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  802847:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80284a:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  80284c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80284f:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  802856:	83 ec 0c             	sub    $0xc,%esp
+  802859:	ff 75 e4             	push   -0x1c(%ebp)
+  80285c:	e8 fb e8 ff ff       	call   80115c <fd2num>
+  802861:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802864:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  802866:	83 c4 04             	add    $0x4,%esp
+  802869:	ff 75 e0             	push   -0x20(%ebp)
+  80286c:	e8 eb e8 ff ff       	call   80115c <fd2num>
+  802871:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802874:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  802877:	83 c4 10             	add    $0x10,%esp
+  80287a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80287f:	e9 87 00 00 00       	jmp    80290b <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802884:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  802889:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80288c:	e8 10 fa ff ff       	call   8022a1 <pipe_ring>
+  802891:	83 ec 08             	sub    $0x8,%esp
+  802894:	01 f0                	add    %esi,%eax
+  802896:	50                   	push   %eax
+  802897:	6a 00                	push   $0x0
+  802899:	e8 94 e4 ff ff       	call   800d32 <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  80289e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8028a1:	e8 fb f9 ff ff       	call   8022a1 <pipe_ring>
+  8028a6:	83 c4 08             	add    $0x8,%esp
+  8028a9:	01 f0                	add    %esi,%eax
+  8028ab:	50                   	push   %eax
+  8028ac:	6a 00                	push   $0x0
+  8028ae:	e8 7f e4 ff ff       	call   800d32 <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  8028b3:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8028b9:	83 c4 10             	add    $0x10,%esp
+  8028bc:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  8028c2:	75 c5                	jne    802889 <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  8028c4:	83 ec 0c             	sub    $0xc,%esp
+  8028c7:	ff 75 e0             	push   -0x20(%ebp)
+  8028ca:	e8 9d e8 ff ff       	call   80116c <fd2data>
+  8028cf:	83 c4 08             	add    $0x8,%esp
+  8028d2:	50                   	push   %eax
+  8028d3:	6a 00                	push   $0x0
+  8028d5:	e8 58 e4 ff ff       	call   800d32 <sys_page_unmap>
+  8028da:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  8028dd:	83 ec 08             	sub    $0x8,%esp
+  8028e0:	57                   	push   %edi
+  8028e1:	6a 00                	push   $0x0
+  8028e3:	e8 4a e4 ff ff       	call   800d32 <sys_page_unmap>
+  8028e8:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  8028eb:	83 ec 08             	sub    $0x8,%esp
+  8028ee:	ff 75 e0             	push   -0x20(%ebp)
+  8028f1:	6a 00                	push   $0x0
+  8028f3:	e8 3a e4 ff ff       	call   800d32 <sys_page_unmap>
+  8028f8:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  8028fb:	83 ec 08             	sub    $0x8,%esp
+  8028fe:	ff 75 e4             	push   -0x1c(%ebp)
+  802901:	6a 00                	push   $0x0
+  802903:	e8 2a e4 ff ff       	call   800d32 <sys_page_unmap>
+  802908:	83 c4 10             	add    $0x10,%esp
+}
+  80290b:	89 d8                	mov    %ebx,%eax
+  80290d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802910:	5b                   	pop    %ebx
+  802911:	5e                   	pop    %esi
+  802912:	5f                   	pop    %edi
+  802913:	5d                   	pop    %ebp
+  802914:	c3                   	ret
+
+00802915 <pipe>:
+{
+  802915:	55                   	push   %ebp
+  802916:	89 e5                	mov    %esp,%ebp
+  802918:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  80291b:	6a 00                	push   $0x0
+  80291d:	ff 75 08             	push   0x8(%ebp)
+  802920:	e8 cc fd ff ff       	call   8026f1 <pipe2>
+}
+  802925:	c9                   	leave
+  802926:	c3                   	ret
+
+00802927 <pipeisclosed>:
+{
+  802927:	55                   	push   %ebp
+  802928:	89 e5                	mov    %esp,%ebp
+  80292a:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80292d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802930:	50                   	push   %eax
+  802931:	ff 75 08             	push   0x8(%ebp)
+  802934:	e8 9d e8 ff ff       	call   8011d6 <fd_lookup>
+  802939:	83 c4 10             	add    $0x10,%esp
+  80293c:	85 c0                	test   %eax,%eax
+  80293e:	78 18                	js     802958 <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  802940:	83 ec 0c             	sub    $0xc,%esp
+  802943:	ff 75 f4             	push   -0xc(%ebp)
+  802946:	e8 21 e8 ff ff       	call   80116c <fd2data>
+  80294b:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  80294d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802950:	e8 59 fa ff ff       	call   8023ae <_pipeisclosed>
+  802955:	83 c4 10             	add    $0x10,%esp
+}
+  802958:	c9                   	leave
+  802959:	c3                   	ret
+
+0080295a <pipe_splice>:
+{
+  80295a:	55                   	push   %ebp
+  80295b:	89 e5                	mov    %esp,%ebp
+  80295d:	57                   	push   %edi
+  80295e:	56                   	push   %esi
+  80295f:	53                   	push   %ebx
+  802960:	83 ec 34             	sub    $0x34,%esp
+  802963:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802966:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802969:	50                   	push   %eax
+  80296a:	ff 75 08             	push   0x8(%ebp)
+  80296d:	e8 64 e8 ff ff       	call   8011d6 <fd_lookup>
+  802972:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802975:	83 c4 10             	add    $0x10,%esp
+  802978:	85 c0                	test   %eax,%eax
+  80297a:	0f 88 d7 00 00 00    	js     802a57 <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  802980:	83 ec 0c             	sub    $0xc,%esp
+  802983:	ff 75 e4             	push   -0x1c(%ebp)
+  802986:	e8 e1 e7 ff ff       	call   80116c <fd2data>
+  80298b:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  80298d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802990:	83 c4 10             	add    $0x10,%esp
+  802993:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802999:	39 10                	cmp    %edx,(%eax)
+  80299b:	0f 85 c1 00 00 00    	jne    802a62 <pipe_splice+0x108>
+  8029a1:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  8029a5:	0f 84 c0 00 00 00    	je     802a6b <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  8029ab:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  8029af:	0f 84 bf 00 00 00    	je     802a74 <pipe_splice+0x11a>
+  8029b5:	89 f7                	mov    %esi,%edi
+  8029b7:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  8029bd:	0f 85 ba 00 00 00    	jne    802a7d <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  8029c3:	8d 43 04             	lea    0x4(%ebx),%eax
+  8029c6:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8029c9:	eb 38                	jmp    802a03 <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  8029cb:	83 ec 0c             	sub    $0xc,%esp
+  8029ce:	68 00 10 00 00       	push   $0x1000
+  8029d3:	89 f1                	mov    %esi,%ecx
+  8029d5:	89 da                	mov    %ebx,%edx
+  8029d7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8029da:	e8 34 fa ff ff       	call   802413 <devpipe_write_bulk>
+  8029df:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8029e2:	83 c4 10             	add    $0x10,%esp
+  8029e5:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8029ea:	75 53                	jne    802a3f <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  8029ec:	83 ec 08             	sub    $0x8,%esp
+  8029ef:	56                   	push   %esi
+  8029f0:	6a 00                	push   $0x0
+  8029f2:	e8 3b e3 ff ff       	call   800d32 <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  8029f7:	83 c7 01             	add    $0x1,%edi
+  8029fa:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802a00:	83 c4 10             	add    $0x10,%esp
+  802a03:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802a06:	74 3a                	je     802a42 <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  802a08:	8b 03                	mov    (%ebx),%eax
+  802a0a:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802a0d:	75 bc                	jne    8029cb <pipe_splice+0x71>
+  802a0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a14:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  802a18:	85 c0                	test   %eax,%eax
+  802a1a:	74 af                	je     8029cb <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802a1c:	83 ec 04             	sub    $0x4,%esp
+  802a1f:	6a 07                	push   $0x7
+  802a21:	56                   	push   %esi
+  802a22:	ff 75 d0             	push   -0x30(%ebp)
+  802a25:	e8 df e5 ff ff       	call   801009 <sys_chan_wakeup>
+  802a2a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802a2d:	83 c4 10             	add    $0x10,%esp
+  802a30:	85 c0                	test   %eax,%eax
+  802a32:	79 b8                	jns    8029ec <pipe_splice+0x92>
+  802a34:	b8 01 00 00 00       	mov    $0x1,%eax
+  802a39:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802a3d:	eb 8c                	jmp    8029cb <pipe_splice+0x71>
+  802a3f:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  802a42:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802a46:	75 06                	jne    802a4e <pipe_splice+0xf4>
+  802a48:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802a4c:	78 09                	js     802a57 <pipe_splice+0xfd>
+  return i * PGSIZE;
+  802a4e:	8b 45 10             	mov    0x10(%ebp),%eax
+  802a51:	c1 e0 0c             	shl    $0xc,%eax
+  802a54:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  802a57:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802a5a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a5d:	5b                   	pop    %ebx
+  802a5e:	5e                   	pop    %esi
+  802a5f:	5f                   	pop    %edi
+  802a60:	5d                   	pop    %ebp
+  802a61:	c3                   	ret
+    return -E_INVAL;
+  802a62:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802a69:	eb ec                	jmp    802a57 <pipe_splice+0xfd>
+  802a6b:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802a72:	eb e3                	jmp    802a57 <pipe_splice+0xfd>
+  802a74:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802a7b:	eb da                	jmp    802a57 <pipe_splice+0xfd>
+  802a7d:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802a84:	eb d1                	jmp    802a57 <pipe_splice+0xfd>
+
+00802a86 <pipe_splice_read>:
+{
+  802a86:	55                   	push   %ebp
+  802a87:	89 e5                	mov    %esp,%ebp
+  802a89:	53                   	push   %ebx
+  802a8a:	83 ec 1c             	sub    $0x1c,%esp
+  802a8d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802a90:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a93:	50                   	push   %eax
+  802a94:	ff 75 08             	push   0x8(%ebp)
+  802a97:	e8 3a e7 ff ff       	call   8011d6 <fd_lookup>
+  802a9c:	83 c4 10             	add    $0x10,%esp
+  802a9f:	85 c0                	test   %eax,%eax
+  802aa1:	78 49                	js     802aec <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  802aa3:	83 ec 0c             	sub    $0xc,%esp
+  802aa6:	ff 75 f4             	push   -0xc(%ebp)
+  802aa9:	e8 be e6 ff ff       	call   80116c <fd2data>
+  802aae:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802ab0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ab3:	83 c4 10             	add    $0x10,%esp
+  802ab6:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  802abc:	39 08                	cmp    %ecx,(%eax)
+  802abe:	75 31                	jne    802af1 <pipe_splice_read+0x6b>
+  802ac0:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  802ac4:	74 32                	je     802af8 <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  802ac6:	8b 48 08             	mov    0x8(%eax),%ecx
+  802ac9:	83 e1 03             	and    $0x3,%ecx
+  802acc:	83 f9 01             	cmp    $0x1,%ecx
+  802acf:	74 2e                	je     802aff <pipe_splice_read+0x79>
+  802ad1:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  802ad7:	75 2d                	jne    802b06 <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  802ad9:	83 ec 08             	sub    $0x8,%esp
+  802adc:	53                   	push   %ebx
+  802add:	68 00 10 00 00       	push   $0x1000
+  802ae2:	89 d9                	mov    %ebx,%ecx
+  802ae4:	e8 93 fa ff ff       	call   80257c <devpipe_read_bulk>
+  802ae9:	83 c4 10             	add    $0x10,%esp
+}
+  802aec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802aef:	c9                   	leave
+  802af0:	c3                   	ret
+    return -E_INVAL;
+  802af1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802af6:	eb f4                	jmp    802aec <pipe_splice_read+0x66>
+  802af8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802afd:	eb ed                	jmp    802aec <pipe_splice_read+0x66>
+  802aff:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b04:	eb e6                	jmp    802aec <pipe_splice_read+0x66>
+  802b06:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b0b:	eb df                	jmp    802aec <pipe_splice_read+0x66>
+
+00802b0d <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  802b0d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b12:	c3                   	ret
+
+00802b13 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802b13:	55                   	push   %ebp
+  802b14:	89 e5                	mov    %esp,%ebp
+  802b16:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  802b19:	68 27 36 80 00       	push   $0x803627
+  802b1e:	ff 75 0c             	push   0xc(%ebp)
+  802b21:	e8 58 dd ff ff       	call   80087e <strcpy>
+  return 0;
+}
+  802b26:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b2b:	c9                   	leave
+  802b2c:	c3                   	ret
+
+00802b2d <devcons_write>:
+{
+  802b2d:	55                   	push   %ebp
+  802b2e:	89 e5                	mov    %esp,%ebp
+  802b30:	57                   	push   %edi
+  802b31:	56                   	push   %esi
+  802b32:	53                   	push   %ebx
+  802b33:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  802b39:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  802b3e:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  802b44:	eb 2e                	jmp    802b74 <devcons_write+0x47>
+    m = n - tot;
+  802b46:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802b49:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  802b4b:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802b50:	39 c3                	cmp    %eax,%ebx
+  802b52:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  802b55:	83 ec 04             	sub    $0x4,%esp
+  802b58:	53                   	push   %ebx
+  802b59:	89 f0                	mov    %esi,%eax
+  802b5b:	03 45 0c             	add    0xc(%ebp),%eax
+  802b5e:	50                   	push   %eax
+  802b5f:	57                   	push   %edi
+  802b60:	e8 9f de ff ff       	call   800a04 <memmove>
+    sys_cputs(buf, m);
+  802b65:	83 c4 08             	add    $0x8,%esp
+  802b68:	53                   	push   %ebx
+  802b69:	57                   	push   %edi
+  802b6a:	e8 3f e0 ff ff       	call   800bae <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  802b6f:	01 de                	add    %ebx,%esi
+  802b71:	83 c4 10             	add    $0x10,%esp
+  802b74:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802b77:	72 cd                	jb     802b46 <devcons_write+0x19>
+}
+  802b79:	89 f0                	mov    %esi,%eax
+  802b7b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b7e:	5b                   	pop    %ebx
+  802b7f:	5e                   	pop    %esi
+  802b80:	5f                   	pop    %edi
+  802b81:	5d                   	pop    %ebp
+  802b82:	c3                   	ret
+
+00802b83 <devcons_read>:
+{
+  802b83:	55                   	push   %ebp
+  802b84:	89 e5                	mov    %esp,%ebp
+  802b86:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  802b89:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b8e:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802b92:	75 07                	jne    802b9b <devcons_read+0x18>
+  802b94:	eb 1f                	jmp    802bb5 <devcons_read+0x32>
+    sys_yield();
+  802b96:	e8 b0 e0 ff ff       	call   800c4b <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  802b9b:	e8 2c e0 ff ff       	call   800bcc <sys_cgetc>
+  802ba0:	85 c0                	test   %eax,%eax
+  802ba2:	74 f2                	je     802b96 <devcons_read+0x13>
+  if (c < 0)
+  802ba4:	78 0f                	js     802bb5 <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  802ba6:	83 f8 04             	cmp    $0x4,%eax
+  802ba9:	74 0c                	je     802bb7 <devcons_read+0x34>
+  *(char*)vbuf = c;
+  802bab:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802bae:	88 02                	mov    %al,(%edx)
+  return 1;
+  802bb0:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802bb5:	c9                   	leave
+  802bb6:	c3                   	ret
+    return 0;
+  802bb7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bbc:	eb f7                	jmp    802bb5 <devcons_read+0x32>
+
+00802bbe <cputchar>:
+{
+  802bbe:	55                   	push   %ebp
+  802bbf:	89 e5                	mov    %esp,%ebp
+  802bc1:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  802bc4:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bc7:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  802bca:	6a 01                	push   $0x1
+  802bcc:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802bcf:	50                   	push   %eax
+  802bd0:	e8 d9 df ff ff       	call   800bae <sys_cputs>
+}
+  802bd5:	83 c4 10             	add    $0x10,%esp
+  802bd8:	c9                   	leave
+  802bd9:	c3                   	ret
+
+00802bda <getchar>:
+{
+  802bda:	55                   	push   %ebp
+  802bdb:	89 e5                	mov    %esp,%ebp
+  802bdd:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  802be0:	6a 01                	push   $0x1
+  802be2:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802be5:	50                   	push   %eax
+  802be6:	6a 00                	push   $0x0
+  802be8:	e8 94 e8 ff ff       	call   801481 <read>
+  if (r < 0)
+  802bed:	83 c4 10             	add    $0x10,%esp
+  802bf0:	85 c0                	test   %eax,%eax
+  802bf2:	78 06                	js     802bfa <getchar+0x20>
+  if (r < 1)
+  802bf4:	74 06                	je     802bfc <getchar+0x22>
+  return c;
+  802bf6:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802bfa:	c9                   	leave
+  802bfb:	c3                   	ret
+    return -E_EOF;
+  802bfc:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802c01:	eb f7                	jmp    802bfa <getchar+0x20>
+
+00802c03 <iscons>:
+{
+  802c03:	55                   	push   %ebp
+  802c04:	89 e5                	mov    %esp,%ebp
+  802c06:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802c09:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802c0c:	50                   	push   %eax
+  802c0d:	ff 75 08             	push   0x8(%ebp)
+  802c10:	e8 c1 e5 ff ff       	call   8011d6 <fd_lookup>
+  802c15:	83 c4 10             	add    $0x10,%esp
+  802c18:	85 c0                	test   %eax,%eax
+  802c1a:	78 11                	js     802c2d <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  802c1c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c1f:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802c25:	39 10                	cmp    %edx,(%eax)
+  802c27:	0f 94 c0             	sete   %al
+  802c2a:	0f b6 c0             	movzbl %al,%eax
+}
+  802c2d:	c9                   	leave
+  802c2e:	c3                   	ret
+
+00802c2f <opencons>:
+{
+  802c2f:	55                   	push   %ebp
+  802c30:	89 e5                	mov    %esp,%ebp
+  802c32:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  802c35:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802c38:	50                   	push   %eax
+  802c39:	e8 42 e5 ff ff       	call   801180 <fd_alloc>
+  802c3e:	83 c4 10             	add    $0x10,%esp
+  802c41:	85 c0                	test   %eax,%eax
+  802c43:	78 3a                	js     802c7f <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802c45:	83 ec 04             	sub    $0x4,%esp
+  802c48:	68 07 04 00 00       	push   $0x407
+  802c4d:	ff 75 f4             	push   -0xc(%ebp)
+  802c50:	6a 00                	push   $0x0
+  802c52:	e8 56 e0 ff ff       	call   800cad <sys_page_alloc>
+  802c57:	83 c4 10             	add    $0x10,%esp
+  802c5a:	85 c0                	test   %eax,%eax
+  802c5c:	78 21                	js     802c7f <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  802c5e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c61:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802c67:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  802c69:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c6c:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  802c73:	83 ec 0c             	sub    $0xc,%esp
+  802c76:	50                   	push   %eax
+  802c77:	e8 e0 e4 ff ff       	call   80115c <fd2num>
+  802c7c:	83 c4 10             	add    $0x10,%esp
+}
+  802c7f:	c9                   	leave
+  802c80:	c3                   	ret
+
+00802c81 <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  802c81:	55                   	push   %ebp
+  802c82:	89 e5                	mov    %esp,%ebp
+  802c84:	57                   	push   %edi
+  802c85:	56                   	push   %esi
+  802c86:	53                   	push   %ebx
+  802c87:	83 ec 14             	sub    $0x14,%esp
+  802c8a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802c8d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802c90:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802c93:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  802c96:	85 c0                	test   %eax,%eax
+  802c98:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802c9d:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  802ca0:	ff 33                	push   (%ebx)
+  802ca2:	50                   	push   %eax
+  802ca3:	e8 dd e2 ff ff       	call   800f85 <sys_ipc_recv>
+  802ca8:	83 c4 10             	add    $0x10,%esp
+  802cab:	85 c0                	test   %eax,%eax
+  802cad:	78 39                	js     802ce8 <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  802caf:	85 ff                	test   %edi,%edi
+  802cb1:	74 0a                	je     802cbd <ipc_recv_pages+0x3c>
+  802cb3:	a1 44 57 80 00       	mov    0x805744,%eax
+  802cb8:	8b 40 7c             	mov    0x7c(%eax),%eax
+  802cbb:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  802cbd:	85 f6                	test   %esi,%esi
+  802cbf:	74 0d                	je     802cce <ipc_recv_pages+0x4d>
+  802cc1:	a1 44 57 80 00       	mov    0x805744,%eax
+  802cc6:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  802ccc:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  802cce:	a1 44 57 80 00       	mov    0x805744,%eax
+  802cd3:	8b 40 74             	mov    0x74(%eax),%eax
+  802cd6:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  802cd8:	a1 44 57 80 00       	mov    0x805744,%eax
+  802cdd:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  802ce0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ce3:	5b                   	pop    %ebx
+  802ce4:	5e                   	pop    %esi
+  802ce5:	5f                   	pop    %edi
+  802ce6:	5d                   	pop    %ebp
+  802ce7:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  802ce8:	85 ff                	test   %edi,%edi
+  802cea:	74 06                	je     802cf2 <ipc_recv_pages+0x71>
+  802cec:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  802cf2:	85 f6                	test   %esi,%esi
+  802cf4:	74 06                	je     802cfc <ipc_recv_pages+0x7b>
+  802cf6:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  802cfc:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  802d02:	eb dc                	jmp    802ce0 <ipc_recv_pages+0x5f>
+
+00802d04 <ipc_recv>:
+{
+  802d04:	55                   	push   %ebp
+  802d05:	89 e5                	mov    %esp,%ebp
+  802d07:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  802d0a:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  802d11:	ff 75 10             	push   0x10(%ebp)
+  802d14:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802d17:	50                   	push   %eax
+  802d18:	ff 75 0c             	push   0xc(%ebp)
+  802d1b:	ff 75 08             	push   0x8(%ebp)
+  802d1e:	e8 5e ff ff ff       	call   802c81 <ipc_recv_pages>
+}
+  802d23:	c9                   	leave
+  802d24:	c3                   	ret
+
+00802d25 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  802d25:	55                   	push   %ebp
+  802d26:	89 e5                	mov    %esp,%ebp
+  802d28:	57                   	push   %edi
+  802d29:	56                   	push   %esi
+  802d2a:	53                   	push   %ebx
+  802d2b:	83 ec 0c             	sub    $0xc,%esp
+  802d2e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802d31:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802d34:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  802d37:	89 c3                	mov    %eax,%ebx
+  802d39:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  802d3f:	85 c0                	test   %eax,%eax
+  802d41:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802d46:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  802d49:	83 ec 0c             	sub    $0xc,%esp
+  802d4c:	ff 75 14             	push   0x14(%ebp)
+  802d4f:	ff 75 18             	push   0x18(%ebp)
+  802d52:	53                   	push   %ebx
+  802d53:	56                   	push   %esi
+  802d54:	57                   	push   %edi
+  802d55:	e8 0a e2 ff ff       	call   800f64 <sys_ipc_try_send>
+  802d5a:	83 c4 20             	add    $0x20,%esp
+  802d5d:	85 c0                	test   %eax,%eax
+  802d5f:	79 1e                	jns    802d7f <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  802d61:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802d64:	75 07                	jne    802d6d <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  802d66:	e8 e0 de ff ff       	call   800c4b <sys_yield>
+  802d6b:	eb dc                	jmp    802d49 <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  802d6d:	50                   	push   %eax
+  802d6e:	68 33 36 80 00       	push   $0x803633
+  802d73:	6a 5c                	push   $0x5c
+  802d75:	68 40 36 80 00       	push   $0x803640
+  802d7a:	e8 36 d4 ff ff       	call   8001b5 <_panic>
+  }
+}
+  802d7f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d82:	5b                   	pop    %ebx
+  802d83:	5e                   	pop    %esi
+  802d84:	5f                   	pop    %edi
+  802d85:	5d                   	pop    %ebp
+  802d86:	c3                   	ret
+
+00802d87 <ipc_send>:
+{
+  802d87:	55                   	push   %ebp
+  802d88:	89 e5                	mov    %esp,%ebp
+  802d8a:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  802d8d:	ff 75 14             	push   0x14(%ebp)
+  802d90:	6a 01                	push   $0x1
+  802d92:	ff 75 10             	push   0x10(%ebp)
+  802d95:	ff 75 0c             	push   0xc(%ebp)
+  802d98:	ff 75 08             	push   0x8(%ebp)
+  802d9b:	e8 85 ff ff ff       	call   802d25 <ipc_send_pages>
+}
+  802da0:	83 c4 20             	add    $0x20,%esp
+  802da3:	c9                   	leave
+  802da4:	c3                   	ret
+
+00802da5 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802da5:	55                   	push   %ebp
+  802da6:	89 e5                	mov    %esp,%ebp
+  802da8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  802dab:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  802db0:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802db3:	c1 e0 04             	shl    $0x4,%eax
+  802db6:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802dbb:	8b 40 50             	mov    0x50(%eax),%eax
+  802dbe:	39 c8                	cmp    %ecx,%eax
+  802dc0:	74 12                	je     802dd4 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  802dc2:	83 c2 01             	add    $0x1,%edx
+  802dc5:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802dcb:	75 e3                	jne    802db0 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  802dcd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dd2:	eb 0e                	jmp    802de2 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  802dd4:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802dd7:	c1 e0 04             	shl    $0x4,%eax
+  802dda:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802ddf:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802de2:	5d                   	pop    %ebp
+  802de3:	c3                   	ret
+
+00802de4 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802de4:	55                   	push   %ebp
+  802de5:	89 e5                	mov    %esp,%ebp
+  802de7:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802dea:	89 c2                	mov    %eax,%edx
+  802dec:	c1 ea 16             	shr    $0x16,%edx
+  802def:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  802df6:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802dfb:	f6 c1 01             	test   $0x1,%cl
+  802dfe:	74 1c                	je     802e1c <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  802e00:	c1 e8 0c             	shr    $0xc,%eax
+  802e03:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  802e0a:	a8 01                	test   $0x1,%al
+  802e0c:	74 0e                	je     802e1c <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  802e0e:	c1 e8 0c             	shr    $0xc,%eax
+  802e11:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802e18:	ef 
+  802e19:	0f b7 d2             	movzwl %dx,%edx
+}
+  802e1c:	89 d0                	mov    %edx,%eax
+  802e1e:	5d                   	pop    %ebp
+  802e1f:	c3                   	ret
+
+00802e20 <udivmod>:
+  802e20:	55                   	push   %ebp
+  802e21:	57                   	push   %edi
+  802e22:	56                   	push   %esi
+  802e23:	53                   	push   %ebx
+  802e24:	83 ec 14             	sub    $0x14,%esp
+  802e27:	8b 74 24 28          	mov    0x28(%esp),%esi
+  802e2b:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  802e2f:	89 fb                	mov    %edi,%ebx
+  802e31:	09 f3                	or     %esi,%ebx
+  802e33:	0f 84 88 00 00 00    	je     802ec1 <udivmod+0xa1>
+  802e39:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802e3e:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802e45:	00 
+  802e46:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802e4d:	00 
+  802e4e:	89 cd                	mov    %ecx,%ebp
+  802e50:	89 34 24             	mov    %esi,(%esp)
+  802e53:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802e57:	eb 08                	jmp    802e61 <udivmod+0x41>
+  802e59:	83 ed 01             	sub    $0x1,%ebp
+  802e5c:	83 fd ff             	cmp    $0xffffffff,%ebp
+  802e5f:	74 6c                	je     802ecd <udivmod+0xad>
+  802e61:	89 c3                	mov    %eax,%ebx
+  802e63:	89 d6                	mov    %edx,%esi
+  802e65:	89 e9                	mov    %ebp,%ecx
+  802e67:	0f ad f3             	shrd   %cl,%esi,%ebx
+  802e6a:	d3 ee                	shr    %cl,%esi
+  802e6c:	f6 c1 20             	test   $0x20,%cl
+  802e6f:	74 04                	je     802e75 <udivmod+0x55>
+  802e71:	89 f3                	mov    %esi,%ebx
+  802e73:	31 f6                	xor    %esi,%esi
+  802e75:	8b 3c 24             	mov    (%esp),%edi
+  802e78:	39 fb                	cmp    %edi,%ebx
+  802e7a:	89 f7                	mov    %esi,%edi
+  802e7c:	8b 1c 24             	mov    (%esp),%ebx
+  802e7f:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802e83:	19 f7                	sbb    %esi,%edi
+  802e85:	72 d2                	jb     802e59 <udivmod+0x39>
+  802e87:	89 f7                	mov    %esi,%edi
+  802e89:	89 de                	mov    %ebx,%esi
+  802e8b:	89 e9                	mov    %ebp,%ecx
+  802e8d:	0f a5 f7             	shld   %cl,%esi,%edi
+  802e90:	d3 e6                	shl    %cl,%esi
+  802e92:	f6 c1 20             	test   $0x20,%cl
+  802e95:	74 04                	je     802e9b <udivmod+0x7b>
+  802e97:	89 f7                	mov    %esi,%edi
+  802e99:	31 f6                	xor    %esi,%esi
+  802e9b:	29 f0                	sub    %esi,%eax
+  802e9d:	19 fa                	sbb    %edi,%edx
+  802e9f:	be 01 00 00 00       	mov    $0x1,%esi
+  802ea4:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ea9:	0f a5 f7             	shld   %cl,%esi,%edi
+  802eac:	d3 e6                	shl    %cl,%esi
+  802eae:	f6 c1 20             	test   $0x20,%cl
+  802eb1:	74 04                	je     802eb7 <udivmod+0x97>
+  802eb3:	89 f7                	mov    %esi,%edi
+  802eb5:	31 f6                	xor    %esi,%esi
+  802eb7:	09 74 24 08          	or     %esi,0x8(%esp)
+  802ebb:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802ebf:	eb 98                	jmp    802e59 <udivmod+0x39>
+  802ec1:	89 f0                	mov    %esi,%eax
+  802ec3:	89 fa                	mov    %edi,%edx
+  802ec5:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802ec9:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802ecd:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802ed1:	89 01                	mov    %eax,(%ecx)
+  802ed3:	89 51 04             	mov    %edx,0x4(%ecx)
+  802ed6:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802eda:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802ede:	83 c4 14             	add    $0x14,%esp
+  802ee1:	5b                   	pop    %ebx
+  802ee2:	5e                   	pop    %esi
+  802ee3:	5f                   	pop    %edi
+  802ee4:	5d                   	pop    %ebp
+  802ee5:	c3                   	ret
+
+00802ee6 <__udivdi3>:
+  802ee6:	83 ec 18             	sub    $0x18,%esp
+  802ee9:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802eed:	50                   	push   %eax
+  802eee:	ff 74 24 2c          	push   0x2c(%esp)
+  802ef2:	ff 74 24 2c          	push   0x2c(%esp)
+  802ef6:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802efa:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802efe:	e8 1d ff ff ff       	call   802e20 <udivmod>
+  802f03:	83 c4 24             	add    $0x24,%esp
+  802f06:	c3                   	ret
+
+00802f07 <__umoddi3>:
+  802f07:	83 ec 18             	sub    $0x18,%esp
+  802f0a:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802f0e:	50                   	push   %eax
+  802f0f:	ff 74 24 2c          	push   0x2c(%esp)
+  802f13:	ff 74 24 2c          	push   0x2c(%esp)
+  802f17:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802f1b:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802f1f:	e8 fc fe ff ff       	call   802e20 <udivmod>
+  802f24:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802f28:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802f2c:	83 c4 24             	add    $0x24,%esp
+  802f2f:	c3                   	ret
+
+00802f30 <__divdi3>:
+  802f30:	56                   	push   %esi
+  802f31:	53                   	push   %ebx
+  802f32:	83 ec 14             	sub    $0x14,%esp
+  802f35:	8b 44 24 20          	mov    0x20(%esp),%eax
+  802f39:	8b 54 24 24          	mov    0x24(%esp),%edx
+  802f3d:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  802f41:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  802f45:	85 d2                	test   %edx,%edx
+  802f47:	78 18                	js     802f61 <__divdi3+0x31>
+  802f49:	85 db                	test   %ebx,%ebx
+  802f4b:	78 3e                	js     802f8b <__divdi3+0x5b>
+  802f4d:	83 ec 04             	sub    $0x4,%esp
+  802f50:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802f54:	56                   	push   %esi
+  802f55:	53                   	push   %ebx
+  802f56:	51                   	push   %ecx
+  802f57:	e8 c4 fe ff ff       	call   802e20 <udivmod>
+  802f5c:	83 c4 10             	add    $0x10,%esp
+  802f5f:	eb 24                	jmp    802f85 <__divdi3+0x55>
+  802f61:	f7 d8                	neg    %eax
+  802f63:	83 d2 00             	adc    $0x0,%edx
+  802f66:	f7 da                	neg    %edx
+  802f68:	85 db                	test   %ebx,%ebx
+  802f6a:	78 3a                	js     802fa6 <__divdi3+0x76>
+  802f6c:	83 ec 04             	sub    $0x4,%esp
+  802f6f:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802f73:	56                   	push   %esi
+  802f74:	53                   	push   %ebx
+  802f75:	51                   	push   %ecx
+  802f76:	e8 a5 fe ff ff       	call   802e20 <udivmod>
+  802f7b:	83 c4 10             	add    $0x10,%esp
+  802f7e:	f7 d8                	neg    %eax
+  802f80:	83 d2 00             	adc    $0x0,%edx
+  802f83:	f7 da                	neg    %edx
+  802f85:	83 c4 14             	add    $0x14,%esp
+  802f88:	5b                   	pop    %ebx
+  802f89:	5e                   	pop    %esi
+  802f8a:	c3                   	ret
+  802f8b:	83 ec 04             	sub    $0x4,%esp
+  802f8e:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802f92:	56                   	push   %esi
+  802f93:	f7 d9                	neg    %ecx
+  802f95:	83 d3 00             	adc    $0x0,%ebx
+  802f98:	f7 db                	neg    %ebx
+  802f9a:	53                   	push   %ebx
+  802f9b:	51                   	push   %ecx
+  802f9c:	e8 7f fe ff ff       	call   802e20 <udivmod>
+  802fa1:	83 c4 10             	add    $0x10,%esp
+  802fa4:	eb d8                	jmp    802f7e <__divdi3+0x4e>
+  802fa6:	83 ec 04             	sub    $0x4,%esp
+  802fa9:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802fad:	56                   	push   %esi
+  802fae:	f7 d9                	neg    %ecx
+  802fb0:	83 d3 00             	adc    $0x0,%ebx
+  802fb3:	f7 db                	neg    %ebx
+  802fb5:	53                   	push   %ebx
+  802fb6:	51                   	push   %ecx
+  802fb7:	e8 64 fe ff ff       	call   802e20 <udivmod>
+  802fbc:	83 c4 10             	add    $0x10,%esp
+  802fbf:	eb c4                	jmp    802f85 <__divdi3+0x55>
+
+00802fc1 <__moddi3>:
+  802fc1:	55                   	push   %ebp
+  802fc2:	57                   	push   %edi
+  802fc3:	56                   	push   %esi
+  802fc4:	53                   	push   %ebx
+  802fc5:	83 ec 24             	sub    $0x24,%esp
+  802fc8:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802fcc:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802fd0:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  802fd4:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  802fd8:	85 d2                	test   %edx,%edx
+  802fda:	78 3b                	js     803017 <__moddi3+0x56>
+  802fdc:	83 ec 04             	sub    $0x4,%esp
+  802fdf:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  802fe3:	56                   	push   %esi
+  802fe4:	89 ce                	mov    %ecx,%esi
+  802fe6:	f7 de                	neg    %esi
+  802fe8:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802fec:	89 de                	mov    %ebx,%esi
+  802fee:	83 d6 00             	adc    $0x0,%esi
+  802ff1:	f7 de                	neg    %esi
+  802ff3:	89 74 24 14          	mov    %esi,0x14(%esp)
+  802ff7:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802ffb:	0f 48 f1             	cmovs  %ecx,%esi
+  802ffe:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  803003:	53                   	push   %ebx
+  803004:	56                   	push   %esi
+  803005:	e8 16 fe ff ff       	call   802e20 <udivmod>
+  80300a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80300e:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803012:	83 c4 10             	add    $0x10,%esp
+  803015:	eb 47                	jmp    80305e <__moddi3+0x9d>
+  803017:	f7 d8                	neg    %eax
+  803019:	83 d2 00             	adc    $0x0,%edx
+  80301c:	f7 da                	neg    %edx
+  80301e:	83 ec 04             	sub    $0x4,%esp
+  803021:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803025:	56                   	push   %esi
+  803026:	89 cf                	mov    %ecx,%edi
+  803028:	f7 df                	neg    %edi
+  80302a:	89 de                	mov    %ebx,%esi
+  80302c:	83 d6 00             	adc    $0x0,%esi
+  80302f:	f7 de                	neg    %esi
+  803031:	0f 49 cf             	cmovns %edi,%ecx
+  803034:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  803038:	0f 49 de             	cmovns %esi,%ebx
+  80303b:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  80303f:	ff 74 24 0c          	push   0xc(%esp)
+  803043:	ff 74 24 0c          	push   0xc(%esp)
+  803047:	e8 d4 fd ff ff       	call   802e20 <udivmod>
+  80304c:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803050:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803054:	f7 d8                	neg    %eax
+  803056:	83 d2 00             	adc    $0x0,%edx
+  803059:	f7 da                	neg    %edx
+  80305b:	83 c4 10             	add    $0x10,%esp
+  80305e:	83 c4 24             	add    $0x24,%esp
+  803061:	5b                   	pop    %ebx
+  803062:	5e                   	pop    %esi
+  803063:	5f                   	pop    %edi
+  803064:	5d                   	pop    %ebp
+  803065:	c3                   	ret
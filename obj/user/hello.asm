@@ -0,0 +1,6369 @@
+
+obj/user/hello.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 2d 00 00 00       	call   80005e <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+// hello, world
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 14             	sub    $0x14,%esp
+  cprintf("hello, world\n");
+  800039:	68 80 2e 80 00       	push   $0x802e80
+  80003e:	e8 1d 01 00 00       	call   800160 <cprintf>
+  cprintf("i am environment %08x\n", thisenv->env_id);
+  800043:	a1 44 57 80 00       	mov    0x805744,%eax
+  800048:	8b 40 48             	mov    0x48(%eax),%eax
+  80004b:	83 c4 08             	add    $0x8,%esp
+  80004e:	50                   	push   %eax
+  80004f:	68 8e 2e 80 00       	push   $0x802e8e
+  800054:	e8 07 01 00 00       	call   800160 <cprintf>
+}
+  800059:	83 c4 10             	add    $0x10,%esp
+  80005c:	c9                   	leave
+  80005d:	c3                   	ret
+
+0080005e <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80005e:	55                   	push   %ebp
+  80005f:	89 e5                	mov    %esp,%ebp
+  800061:	56                   	push   %esi
+  800062:	53                   	push   %ebx
+  800063:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800066:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  800069:	c7 05 44 57 80 00 00 	movl   $0x0,0x805744
+  800070:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  800073:	e8 84 0a 00 00       	call   800afc <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  800078:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80007d:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800080:	c1 e0 04             	shl    $0x4,%eax
+  800083:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800088:	a3 44 57 80 00       	mov    %eax,0x805744
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  80008d:	85 db                	test   %ebx,%ebx
+  80008f:	7e 07                	jle    800098 <libmain+0x3a>
+    binaryname = argv[0];
+  800091:	8b 06                	mov    (%esi),%eax
+  800093:	a3 00 40 80 00       	mov    %eax,0x804000
+
+  // call user main routine
+  umain(argc, argv);
+  800098:	83 ec 08             	sub    $0x8,%esp
+  80009b:	56                   	push   %esi
+  80009c:	53                   	push   %ebx
+  80009d:	e8 91 ff ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  8000a2:	e8 0a 00 00 00       	call   8000b1 <exit>
+}
+  8000a7:	83 c4 10             	add    $0x10,%esp
+  8000aa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000ad:	5b                   	pop    %ebx
+  8000ae:	5e                   	pop    %esi
+  8000af:	5d                   	pop    %ebp
+  8000b0:	c3                   	ret
+
+008000b1 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000b1:	55                   	push   %ebp
+  8000b2:	89 e5                	mov    %esp,%ebp
+  8000b4:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  8000b7:	e8 3a 11 00 00       	call   8011f6 <close_all>
+  sys_env_destroy(0);
+  8000bc:	83 ec 0c             	sub    $0xc,%esp
+  8000bf:	6a 00                	push   $0x0
+  8000c1:	e8 f5 09 00 00       	call   800abb <sys_env_destroy>
+}
+  8000c6:	83 c4 10             	add    $0x10,%esp
+  8000c9:	c9                   	leave
+  8000ca:	c3                   	ret
+
+008000cb <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8000cb:	55                   	push   %ebp
+  8000cc:	89 e5                	mov    %esp,%ebp
+  8000ce:	53                   	push   %ebx
+  8000cf:	83 ec 04             	sub    $0x4,%esp
+  8000d2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  8000d5:	8b 13                	mov    (%ebx),%edx
+  8000d7:	8d 42 01             	lea    0x1(%edx),%eax
+  8000da:	89 03                	mov    %eax,(%ebx)
+  8000dc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8000df:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  8000e3:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8000e8:	74 09                	je     8000f3 <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  8000ea:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8000ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8000f1:	c9                   	leave
+  8000f2:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  8000f3:	83 ec 08             	sub    $0x8,%esp
+  8000f6:	68 ff 00 00 00       	push   $0xff
+  8000fb:	8d 43 08             	lea    0x8(%ebx),%eax
+  8000fe:	50                   	push   %eax
+  8000ff:	e8 7a 09 00 00       	call   800a7e <sys_cputs>
+    b->idx = 0;
+  800104:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80010a:	83 c4 10             	add    $0x10,%esp
+  80010d:	eb db                	jmp    8000ea <putch+0x1f>
+
+0080010f <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80010f:	55                   	push   %ebp
+  800110:	89 e5                	mov    %esp,%ebp
+  800112:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  800118:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80011f:	00 00 00 
+  b.cnt = 0;
+  800122:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800129:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  80012c:	ff 75 0c             	push   0xc(%ebp)
+  80012f:	ff 75 08             	push   0x8(%ebp)
+  800132:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800138:	50                   	push   %eax
+  800139:	68 cb 00 80 00       	push   $0x8000cb
+  80013e:	e8 14 01 00 00       	call   800257 <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  800143:	83 c4 08             	add    $0x8,%esp
+  800146:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80014c:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800152:	50                   	push   %eax
+  800153:	e8 26 09 00 00       	call   800a7e <sys_cputs>
+
+  return b.cnt;
+}
+  800158:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80015e:	c9                   	leave
+  80015f:	c3                   	ret
+
+00800160 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800160:	55                   	push   %ebp
+  800161:	89 e5                	mov    %esp,%ebp
+  800163:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  800166:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  800169:	50                   	push   %eax
+  80016a:	ff 75 08             	push   0x8(%ebp)
+  80016d:	e8 9d ff ff ff       	call   80010f <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  800172:	c9                   	leave
+  800173:	c3                   	ret
+
+00800174 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  800174:	55                   	push   %ebp
+  800175:	89 e5                	mov    %esp,%ebp
+  800177:	57                   	push   %edi
+  800178:	56                   	push   %esi
+  800179:	53                   	push   %ebx
+  80017a:	83 ec 1c             	sub    $0x1c,%esp
+  80017d:	89 c7                	mov    %eax,%edi
+  80017f:	89 d6                	mov    %edx,%esi
+  800181:	8b 45 08             	mov    0x8(%ebp),%eax
+  800184:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800187:	89 d1                	mov    %edx,%ecx
+  800189:	89 c2                	mov    %eax,%edx
+  80018b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80018e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800191:	8b 45 10             	mov    0x10(%ebp),%eax
+  800194:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  800197:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80019a:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8001a1:	39 c2                	cmp    %eax,%edx
+  8001a3:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8001a6:	72 3e                	jb     8001e6 <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  8001a8:	83 ec 0c             	sub    $0xc,%esp
+  8001ab:	ff 75 18             	push   0x18(%ebp)
+  8001ae:	83 eb 01             	sub    $0x1,%ebx
+  8001b1:	53                   	push   %ebx
+  8001b2:	50                   	push   %eax
+  8001b3:	83 ec 08             	sub    $0x8,%esp
+  8001b6:	ff 75 e4             	push   -0x1c(%ebp)
+  8001b9:	ff 75 e0             	push   -0x20(%ebp)
+  8001bc:	ff 75 dc             	push   -0x24(%ebp)
+  8001bf:	ff 75 d8             	push   -0x28(%ebp)
+  8001c2:	e8 21 2b 00 00       	call   802ce8 <__udivdi3>
+  8001c7:	83 c4 18             	add    $0x18,%esp
+  8001ca:	52                   	push   %edx
+  8001cb:	50                   	push   %eax
+  8001cc:	89 f2                	mov    %esi,%edx
+  8001ce:	89 f8                	mov    %edi,%eax
+  8001d0:	e8 9f ff ff ff       	call   800174 <printnum>
+  8001d5:	83 c4 20             	add    $0x20,%esp
+  8001d8:	eb 13                	jmp    8001ed <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  8001da:	83 ec 08             	sub    $0x8,%esp
+  8001dd:	56                   	push   %esi
+  8001de:	ff 75 18             	push   0x18(%ebp)
+  8001e1:	ff d7                	call   *%edi
+  8001e3:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  8001e6:	83 eb 01             	sub    $0x1,%ebx
+  8001e9:	85 db                	test   %ebx,%ebx
+  8001eb:	7f ed                	jg     8001da <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  8001ed:	83 ec 08             	sub    $0x8,%esp
+  8001f0:	56                   	push   %esi
+  8001f1:	83 ec 04             	sub    $0x4,%esp
+  8001f4:	ff 75 e4             	push   -0x1c(%ebp)
+  8001f7:	ff 75 e0             	push   -0x20(%ebp)
+  8001fa:	ff 75 dc             	push   -0x24(%ebp)
+  8001fd:	ff 75 d8             	push   -0x28(%ebp)
+  800200:	e8 04 2b 00 00       	call   802d09 <__umoddi3>
+  800205:	83 c4 14             	add    $0x14,%esp
+  800208:	0f be 80 af 2e 80 00 	movsbl 0x802eaf(%eax),%eax
+  80020f:	50                   	push   %eax
+  800210:	ff d7                	call   *%edi
+}
+  800212:	83 c4 10             	add    $0x10,%esp
+  800215:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800218:	5b                   	pop    %ebx
+  800219:	5e                   	pop    %esi
+  80021a:	5f                   	pop    %edi
+  80021b:	5d                   	pop    %ebp
+  80021c:	c3                   	ret
+
+0080021d <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80021d:	55                   	push   %ebp
+  80021e:	89 e5                	mov    %esp,%ebp
+  800220:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  800223:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  800227:	8b 10                	mov    (%eax),%edx
+  800229:	3b 50 04             	cmp    0x4(%eax),%edx
+  80022c:	73 0a                	jae    800238 <sprintputch+0x1b>
+    *b->buf++ = ch;
+  80022e:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800231:	89 08                	mov    %ecx,(%eax)
+  800233:	8b 45 08             	mov    0x8(%ebp),%eax
+  800236:	88 02                	mov    %al,(%edx)
+}
+  800238:	5d                   	pop    %ebp
+  800239:	c3                   	ret
+
+0080023a <printfmt>:
+{
+  80023a:	55                   	push   %ebp
+  80023b:	89 e5                	mov    %esp,%ebp
+  80023d:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  800240:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  800243:	50                   	push   %eax
+  800244:	ff 75 10             	push   0x10(%ebp)
+  800247:	ff 75 0c             	push   0xc(%ebp)
+  80024a:	ff 75 08             	push   0x8(%ebp)
+  80024d:	e8 05 00 00 00       	call   800257 <vprintfmt>
+}
+  800252:	83 c4 10             	add    $0x10,%esp
+  800255:	c9                   	leave
+  800256:	c3                   	ret
+
+00800257 <vprintfmt>:
+{
+  800257:	55                   	push   %ebp
+  800258:	89 e5                	mov    %esp,%ebp
+  80025a:	57                   	push   %edi
+  80025b:	56                   	push   %esi
+  80025c:	53                   	push   %ebx
+  80025d:	83 ec 2c             	sub    $0x2c,%esp
+  800260:	8b 75 08             	mov    0x8(%ebp),%esi
+  800263:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800266:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800269:	eb 0a                	jmp    800275 <vprintfmt+0x1e>
+      putch(ch, putdat);
+  80026b:	83 ec 08             	sub    $0x8,%esp
+  80026e:	53                   	push   %ebx
+  80026f:	50                   	push   %eax
+  800270:	ff d6                	call   *%esi
+  800272:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  800275:	83 c7 01             	add    $0x1,%edi
+  800278:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80027c:	83 f8 25             	cmp    $0x25,%eax
+  80027f:	74 0c                	je     80028d <vprintfmt+0x36>
+      if (ch == '\0')
+  800281:	85 c0                	test   %eax,%eax
+  800283:	75 e6                	jne    80026b <vprintfmt+0x14>
+}
+  800285:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800288:	5b                   	pop    %ebx
+  800289:	5e                   	pop    %esi
+  80028a:	5f                   	pop    %edi
+  80028b:	5d                   	pop    %ebp
+  80028c:	c3                   	ret
+    padc = ' ';
+  80028d:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  800291:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  800298:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  80029f:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  8002a6:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  8002ab:	8d 47 01             	lea    0x1(%edi),%eax
+  8002ae:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8002b1:	0f b6 17             	movzbl (%edi),%edx
+  8002b4:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8002b7:	3c 55                	cmp    $0x55,%al
+  8002b9:	0f 87 cf 03 00 00    	ja     80068e <vprintfmt+0x437>
+  8002bf:	0f b6 c0             	movzbl %al,%eax
+  8002c2:	ff 24 85 00 30 80 00 	jmp    *0x803000(,%eax,4)
+  8002c9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  8002cc:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8002d0:	eb d9                	jmp    8002ab <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  8002d2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8002d5:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8002d9:	eb d0                	jmp    8002ab <vprintfmt+0x54>
+  8002db:	0f b6 d2             	movzbl %dl,%edx
+  8002de:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  8002e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002e6:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  8002e9:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8002ec:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  8002f0:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  8002f3:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8002f6:	83 f9 09             	cmp    $0x9,%ecx
+  8002f9:	77 55                	ja     800350 <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  8002fb:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  8002fe:	eb e9                	jmp    8002e9 <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  800300:	8b 45 14             	mov    0x14(%ebp),%eax
+  800303:	8b 00                	mov    (%eax),%eax
+  800305:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800308:	8b 45 14             	mov    0x14(%ebp),%eax
+  80030b:	8d 40 04             	lea    0x4(%eax),%eax
+  80030e:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  800311:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  800314:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800318:	79 91                	jns    8002ab <vprintfmt+0x54>
+        width = precision, precision = -1;
+  80031a:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80031d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800320:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800327:	eb 82                	jmp    8002ab <vprintfmt+0x54>
+      if (width < 0)
+  800329:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80032c:	85 d2                	test   %edx,%edx
+  80032e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800333:	0f 49 c2             	cmovns %edx,%eax
+  800336:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  800339:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  80033c:	e9 6a ff ff ff       	jmp    8002ab <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  800341:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  800344:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  80034b:	e9 5b ff ff ff       	jmp    8002ab <vprintfmt+0x54>
+  800350:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800353:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800356:	eb bc                	jmp    800314 <vprintfmt+0xbd>
+      lflag++;
+  800358:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  80035b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  80035e:	e9 48 ff ff ff       	jmp    8002ab <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  800363:	8b 45 14             	mov    0x14(%ebp),%eax
+  800366:	8d 78 04             	lea    0x4(%eax),%edi
+  800369:	83 ec 08             	sub    $0x8,%esp
+  80036c:	53                   	push   %ebx
+  80036d:	ff 30                	push   (%eax)
+  80036f:	ff d6                	call   *%esi
+      break;
+  800371:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  800374:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  800377:	e9 b1 02 00 00       	jmp    80062d <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  80037c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80037f:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  800382:	8b 10                	mov    (%eax),%edx
+  800384:	89 d0                	mov    %edx,%eax
+  800386:	f7 d8                	neg    %eax
+  800388:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80038b:	83 f8 10             	cmp    $0x10,%eax
+  80038e:	7f 23                	jg     8003b3 <vprintfmt+0x15c>
+  800390:	8b 14 85 60 31 80 00 	mov    0x803160(,%eax,4),%edx
+  800397:	85 d2                	test   %edx,%edx
+  800399:	74 18                	je     8003b3 <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  80039b:	52                   	push   %edx
+  80039c:	68 aa 32 80 00       	push   $0x8032aa
+  8003a1:	53                   	push   %ebx
+  8003a2:	56                   	push   %esi
+  8003a3:	e8 92 fe ff ff       	call   80023a <printfmt>
+  8003a8:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  8003ab:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8003ae:	e9 7a 02 00 00       	jmp    80062d <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  8003b3:	50                   	push   %eax
+  8003b4:	68 c7 2e 80 00       	push   $0x802ec7
+  8003b9:	53                   	push   %ebx
+  8003ba:	56                   	push   %esi
+  8003bb:	e8 7a fe ff ff       	call   80023a <printfmt>
+  8003c0:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  8003c3:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  8003c6:	e9 62 02 00 00       	jmp    80062d <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  8003cb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003ce:	83 c0 04             	add    $0x4,%eax
+  8003d1:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8003d4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003d7:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  8003d9:	85 c9                	test   %ecx,%ecx
+  8003db:	b8 c0 2e 80 00       	mov    $0x802ec0,%eax
+  8003e0:	0f 45 c1             	cmovne %ecx,%eax
+  8003e3:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  8003e6:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003ea:	7e 06                	jle    8003f2 <vprintfmt+0x19b>
+  8003ec:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8003f0:	75 0b                	jne    8003fd <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8003f2:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8003f5:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8003f8:	89 75 08             	mov    %esi,0x8(%ebp)
+  8003fb:	eb 5c                	jmp    800459 <vprintfmt+0x202>
+  8003fd:	83 ec 08             	sub    $0x8,%esp
+  800400:	ff 75 d0             	push   -0x30(%ebp)
+  800403:	ff 75 cc             	push   -0x34(%ebp)
+  800406:	e8 20 03 00 00       	call   80072b <strnlen>
+  80040b:	89 c2                	mov    %eax,%edx
+  80040d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800410:	29 d0                	sub    %edx,%eax
+  800412:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  800415:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800419:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80041c:	89 75 08             	mov    %esi,0x8(%ebp)
+  80041f:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800421:	eb 0e                	jmp    800431 <vprintfmt+0x1da>
+          putch(padc, putdat);
+  800423:	83 ec 08             	sub    $0x8,%esp
+  800426:	53                   	push   %ebx
+  800427:	57                   	push   %edi
+  800428:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  80042b:	83 ee 01             	sub    $0x1,%esi
+  80042e:	83 c4 10             	add    $0x10,%esp
+  800431:	85 f6                	test   %esi,%esi
+  800433:	7f ee                	jg     800423 <vprintfmt+0x1cc>
+  800435:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800438:	8b 75 08             	mov    0x8(%ebp),%esi
+  80043b:	85 c0                	test   %eax,%eax
+  80043d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800442:	0f 49 d0             	cmovns %eax,%edx
+  800445:	29 d0                	sub    %edx,%eax
+  800447:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80044a:	eb a6                	jmp    8003f2 <vprintfmt+0x19b>
+          putch(ch, putdat);
+  80044c:	83 ec 08             	sub    $0x8,%esp
+  80044f:	53                   	push   %ebx
+  800450:	52                   	push   %edx
+  800451:	ff 55 08             	call   *0x8(%ebp)
+  800454:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800457:	89 f1                	mov    %esi,%ecx
+  800459:	8d 71 01             	lea    0x1(%ecx),%esi
+  80045c:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800460:	0f be d0             	movsbl %al,%edx
+  800463:	85 d2                	test   %edx,%edx
+  800465:	74 28                	je     80048f <vprintfmt+0x238>
+  800467:	85 ff                	test   %edi,%edi
+  800469:	78 05                	js     800470 <vprintfmt+0x219>
+  80046b:	83 ef 01             	sub    $0x1,%edi
+  80046e:	78 30                	js     8004a0 <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  800470:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800474:	74 d6                	je     80044c <vprintfmt+0x1f5>
+  800476:	0f be c0             	movsbl %al,%eax
+  800479:	83 e8 20             	sub    $0x20,%eax
+  80047c:	83 f8 5e             	cmp    $0x5e,%eax
+  80047f:	76 cb                	jbe    80044c <vprintfmt+0x1f5>
+          putch('?', putdat);
+  800481:	83 ec 08             	sub    $0x8,%esp
+  800484:	53                   	push   %ebx
+  800485:	6a 3f                	push   $0x3f
+  800487:	ff 55 08             	call   *0x8(%ebp)
+  80048a:	83 c4 10             	add    $0x10,%esp
+  80048d:	eb c8                	jmp    800457 <vprintfmt+0x200>
+  80048f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800492:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800495:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800498:	01 d0                	add    %edx,%eax
+  80049a:	29 c8                	sub    %ecx,%eax
+  80049c:	89 c7                	mov    %eax,%edi
+  80049e:	eb 13                	jmp    8004b3 <vprintfmt+0x25c>
+  8004a0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004a3:	eb ed                	jmp    800492 <vprintfmt+0x23b>
+        putch(' ', putdat);
+  8004a5:	83 ec 08             	sub    $0x8,%esp
+  8004a8:	53                   	push   %ebx
+  8004a9:	6a 20                	push   $0x20
+  8004ab:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  8004ad:	83 ef 01             	sub    $0x1,%edi
+  8004b0:	83 c4 10             	add    $0x10,%esp
+  8004b3:	85 ff                	test   %edi,%edi
+  8004b5:	7f ee                	jg     8004a5 <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  8004b7:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8004ba:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004bd:	e9 6b 01 00 00       	jmp    80062d <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  8004c2:	83 f9 01             	cmp    $0x1,%ecx
+  8004c5:	7f 1f                	jg     8004e6 <vprintfmt+0x28f>
+  else if (lflag)
+  8004c7:	85 c9                	test   %ecx,%ecx
+  8004c9:	74 67                	je     800532 <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  8004cb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004ce:	8b 00                	mov    (%eax),%eax
+  8004d0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004d3:	89 c1                	mov    %eax,%ecx
+  8004d5:	c1 f9 1f             	sar    $0x1f,%ecx
+  8004d8:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8004db:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004de:	8d 40 04             	lea    0x4(%eax),%eax
+  8004e1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8004e4:	eb 17                	jmp    8004fd <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  8004e6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004e9:	8b 50 04             	mov    0x4(%eax),%edx
+  8004ec:	8b 00                	mov    (%eax),%eax
+  8004ee:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004f1:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8004f4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004f7:	8d 40 08             	lea    0x8(%eax),%eax
+  8004fa:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  8004fd:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800500:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  800503:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  800508:	85 c9                	test   %ecx,%ecx
+  80050a:	0f 89 03 01 00 00    	jns    800613 <vprintfmt+0x3bc>
+        putch('-', putdat);
+  800510:	83 ec 08             	sub    $0x8,%esp
+  800513:	53                   	push   %ebx
+  800514:	6a 2d                	push   $0x2d
+  800516:	ff d6                	call   *%esi
+        num = -(long long)num;
+  800518:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80051b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80051e:	f7 da                	neg    %edx
+  800520:	83 d1 00             	adc    $0x0,%ecx
+  800523:	f7 d9                	neg    %ecx
+  800525:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  800528:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80052d:	e9 e1 00 00 00       	jmp    800613 <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  800532:	8b 45 14             	mov    0x14(%ebp),%eax
+  800535:	8b 00                	mov    (%eax),%eax
+  800537:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80053a:	89 c1                	mov    %eax,%ecx
+  80053c:	c1 f9 1f             	sar    $0x1f,%ecx
+  80053f:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800542:	8b 45 14             	mov    0x14(%ebp),%eax
+  800545:	8d 40 04             	lea    0x4(%eax),%eax
+  800548:	89 45 14             	mov    %eax,0x14(%ebp)
+  80054b:	eb b0                	jmp    8004fd <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  80054d:	83 f9 01             	cmp    $0x1,%ecx
+  800550:	7f 1e                	jg     800570 <vprintfmt+0x319>
+  else if (lflag)
+  800552:	85 c9                	test   %ecx,%ecx
+  800554:	74 32                	je     800588 <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  800556:	8b 45 14             	mov    0x14(%ebp),%eax
+  800559:	8b 10                	mov    (%eax),%edx
+  80055b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800560:	8d 40 04             	lea    0x4(%eax),%eax
+  800563:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800566:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  80056b:	e9 a3 00 00 00       	jmp    800613 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800570:	8b 45 14             	mov    0x14(%ebp),%eax
+  800573:	8b 10                	mov    (%eax),%edx
+  800575:	8b 48 04             	mov    0x4(%eax),%ecx
+  800578:	8d 40 08             	lea    0x8(%eax),%eax
+  80057b:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  80057e:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  800583:	e9 8b 00 00 00       	jmp    800613 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800588:	8b 45 14             	mov    0x14(%ebp),%eax
+  80058b:	8b 10                	mov    (%eax),%edx
+  80058d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800592:	8d 40 04             	lea    0x4(%eax),%eax
+  800595:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800598:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  80059d:	eb 74                	jmp    800613 <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  80059f:	83 f9 01             	cmp    $0x1,%ecx
+  8005a2:	7f 1b                	jg     8005bf <vprintfmt+0x368>
+  else if (lflag)
+  8005a4:	85 c9                	test   %ecx,%ecx
+  8005a6:	74 2c                	je     8005d4 <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  8005a8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ab:	8b 10                	mov    (%eax),%edx
+  8005ad:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005b2:	8d 40 04             	lea    0x4(%eax),%eax
+  8005b5:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8005b8:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  8005bd:	eb 54                	jmp    800613 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  8005bf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c2:	8b 10                	mov    (%eax),%edx
+  8005c4:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005c7:	8d 40 08             	lea    0x8(%eax),%eax
+  8005ca:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8005cd:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  8005d2:	eb 3f                	jmp    800613 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8005d4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d7:	8b 10                	mov    (%eax),%edx
+  8005d9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005de:	8d 40 04             	lea    0x4(%eax),%eax
+  8005e1:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8005e4:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  8005e9:	eb 28                	jmp    800613 <vprintfmt+0x3bc>
+      putch('0', putdat);
+  8005eb:	83 ec 08             	sub    $0x8,%esp
+  8005ee:	53                   	push   %ebx
+  8005ef:	6a 30                	push   $0x30
+  8005f1:	ff d6                	call   *%esi
+      putch('x', putdat);
+  8005f3:	83 c4 08             	add    $0x8,%esp
+  8005f6:	53                   	push   %ebx
+  8005f7:	6a 78                	push   $0x78
+  8005f9:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  8005fb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005fe:	8b 10                	mov    (%eax),%edx
+  800600:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  800605:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  800608:	8d 40 04             	lea    0x4(%eax),%eax
+  80060b:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  80060e:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  800613:	83 ec 0c             	sub    $0xc,%esp
+  800616:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80061a:	50                   	push   %eax
+  80061b:	ff 75 e0             	push   -0x20(%ebp)
+  80061e:	57                   	push   %edi
+  80061f:	51                   	push   %ecx
+  800620:	52                   	push   %edx
+  800621:	89 da                	mov    %ebx,%edx
+  800623:	89 f0                	mov    %esi,%eax
+  800625:	e8 4a fb ff ff       	call   800174 <printnum>
+      break;
+  80062a:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  80062d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  800630:	e9 40 fc ff ff       	jmp    800275 <vprintfmt+0x1e>
+  if (lflag >= 2)
+  800635:	83 f9 01             	cmp    $0x1,%ecx
+  800638:	7f 1b                	jg     800655 <vprintfmt+0x3fe>
+  else if (lflag)
+  80063a:	85 c9                	test   %ecx,%ecx
+  80063c:	74 2c                	je     80066a <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  80063e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800641:	8b 10                	mov    (%eax),%edx
+  800643:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800648:	8d 40 04             	lea    0x4(%eax),%eax
+  80064b:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  80064e:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  800653:	eb be                	jmp    800613 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800655:	8b 45 14             	mov    0x14(%ebp),%eax
+  800658:	8b 10                	mov    (%eax),%edx
+  80065a:	8b 48 04             	mov    0x4(%eax),%ecx
+  80065d:	8d 40 08             	lea    0x8(%eax),%eax
+  800660:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800663:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  800668:	eb a9                	jmp    800613 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  80066a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80066d:	8b 10                	mov    (%eax),%edx
+  80066f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800674:	8d 40 04             	lea    0x4(%eax),%eax
+  800677:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  80067a:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  80067f:	eb 92                	jmp    800613 <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  800681:	83 ec 08             	sub    $0x8,%esp
+  800684:	53                   	push   %ebx
+  800685:	6a 25                	push   $0x25
+  800687:	ff d6                	call   *%esi
+      break;
+  800689:	83 c4 10             	add    $0x10,%esp
+  80068c:	eb 9f                	jmp    80062d <vprintfmt+0x3d6>
+      putch('%', putdat);
+  80068e:	83 ec 08             	sub    $0x8,%esp
+  800691:	53                   	push   %ebx
+  800692:	6a 25                	push   $0x25
+  800694:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  800696:	83 c4 10             	add    $0x10,%esp
+  800699:	89 f8                	mov    %edi,%eax
+  80069b:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80069f:	74 05                	je     8006a6 <vprintfmt+0x44f>
+  8006a1:	83 e8 01             	sub    $0x1,%eax
+  8006a4:	eb f5                	jmp    80069b <vprintfmt+0x444>
+  8006a6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8006a9:	eb 82                	jmp    80062d <vprintfmt+0x3d6>
+
+008006ab <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8006ab:	55                   	push   %ebp
+  8006ac:	89 e5                	mov    %esp,%ebp
+  8006ae:	83 ec 18             	sub    $0x18,%esp
+  8006b1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006b4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  8006b7:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8006ba:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8006be:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8006c1:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  8006c8:	85 c0                	test   %eax,%eax
+  8006ca:	74 26                	je     8006f2 <vsnprintf+0x47>
+  8006cc:	85 d2                	test   %edx,%edx
+  8006ce:	7e 22                	jle    8006f2 <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8006d0:	ff 75 14             	push   0x14(%ebp)
+  8006d3:	ff 75 10             	push   0x10(%ebp)
+  8006d6:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8006d9:	50                   	push   %eax
+  8006da:	68 1d 02 80 00       	push   $0x80021d
+  8006df:	e8 73 fb ff ff       	call   800257 <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  8006e4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8006e7:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  8006ea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8006ed:	83 c4 10             	add    $0x10,%esp
+}
+  8006f0:	c9                   	leave
+  8006f1:	c3                   	ret
+    return -E_INVAL;
+  8006f2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8006f7:	eb f7                	jmp    8006f0 <vsnprintf+0x45>
+
+008006f9 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8006f9:	55                   	push   %ebp
+  8006fa:	89 e5                	mov    %esp,%ebp
+  8006fc:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  8006ff:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  800702:	50                   	push   %eax
+  800703:	ff 75 10             	push   0x10(%ebp)
+  800706:	ff 75 0c             	push   0xc(%ebp)
+  800709:	ff 75 08             	push   0x8(%ebp)
+  80070c:	e8 9a ff ff ff       	call   8006ab <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  800711:	c9                   	leave
+  800712:	c3                   	ret
+
+00800713 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800713:	55                   	push   %ebp
+  800714:	89 e5                	mov    %esp,%ebp
+  800716:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  800719:	b8 00 00 00 00       	mov    $0x0,%eax
+  80071e:	eb 03                	jmp    800723 <strlen+0x10>
+    n++;
+  800720:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  800723:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800727:	75 f7                	jne    800720 <strlen+0xd>
+  return n;
+}
+  800729:	5d                   	pop    %ebp
+  80072a:	c3                   	ret
+
+0080072b <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80072b:	55                   	push   %ebp
+  80072c:	89 e5                	mov    %esp,%ebp
+  80072e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800731:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800734:	b8 00 00 00 00       	mov    $0x0,%eax
+  800739:	eb 03                	jmp    80073e <strnlen+0x13>
+    n++;
+  80073b:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80073e:	39 d0                	cmp    %edx,%eax
+  800740:	74 08                	je     80074a <strnlen+0x1f>
+  800742:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800746:	75 f3                	jne    80073b <strnlen+0x10>
+  800748:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  80074a:	89 d0                	mov    %edx,%eax
+  80074c:	5d                   	pop    %ebp
+  80074d:	c3                   	ret
+
+0080074e <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80074e:	55                   	push   %ebp
+  80074f:	89 e5                	mov    %esp,%ebp
+  800751:	53                   	push   %ebx
+  800752:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800755:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  800758:	b8 00 00 00 00       	mov    $0x0,%eax
+  80075d:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800761:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800764:	83 c0 01             	add    $0x1,%eax
+  800767:	84 d2                	test   %dl,%dl
+  800769:	75 f2                	jne    80075d <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  80076b:	89 c8                	mov    %ecx,%eax
+  80076d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800770:	c9                   	leave
+  800771:	c3                   	ret
+
+00800772 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800772:	55                   	push   %ebp
+  800773:	89 e5                	mov    %esp,%ebp
+  800775:	53                   	push   %ebx
+  800776:	83 ec 10             	sub    $0x10,%esp
+  800779:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  80077c:	53                   	push   %ebx
+  80077d:	e8 91 ff ff ff       	call   800713 <strlen>
+  800782:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  800785:	ff 75 0c             	push   0xc(%ebp)
+  800788:	01 d8                	add    %ebx,%eax
+  80078a:	50                   	push   %eax
+  80078b:	e8 be ff ff ff       	call   80074e <strcpy>
+  return dst;
+}
+  800790:	89 d8                	mov    %ebx,%eax
+  800792:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800795:	c9                   	leave
+  800796:	c3                   	ret
+
+00800797 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  800797:	55                   	push   %ebp
+  800798:	89 e5                	mov    %esp,%ebp
+  80079a:	56                   	push   %esi
+  80079b:	53                   	push   %ebx
+  80079c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80079f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  8007a2:	89 f3                	mov    %esi,%ebx
+  8007a4:	03 5d 10             	add    0x10(%ebp),%ebx
+  8007a7:	89 f0                	mov    %esi,%eax
+  8007a9:	eb 0f                	jmp    8007ba <strncpy+0x23>
+    *dst++ = *src;
+  8007ab:	83 c0 01             	add    $0x1,%eax
+  8007ae:	0f b6 0a             	movzbl (%edx),%ecx
+  8007b1:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  8007b4:	80 f9 01             	cmp    $0x1,%cl
+  8007b7:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  8007ba:	39 d8                	cmp    %ebx,%eax
+  8007bc:	75 ed                	jne    8007ab <strncpy+0x14>
+  }
+  return ret;
+}
+  8007be:	89 f0                	mov    %esi,%eax
+  8007c0:	5b                   	pop    %ebx
+  8007c1:	5e                   	pop    %esi
+  8007c2:	5d                   	pop    %ebp
+  8007c3:	c3                   	ret
+
+008007c4 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8007c4:	55                   	push   %ebp
+  8007c5:	89 e5                	mov    %esp,%ebp
+  8007c7:	56                   	push   %esi
+  8007c8:	53                   	push   %ebx
+  8007c9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007cc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8007cf:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  8007d2:	89 f0                	mov    %esi,%eax
+  8007d4:	85 d2                	test   %edx,%edx
+  8007d6:	74 21                	je     8007f9 <strlcpy+0x35>
+  8007d8:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8007dc:	89 f2                	mov    %esi,%edx
+  8007de:	eb 09                	jmp    8007e9 <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  8007e0:	83 c1 01             	add    $0x1,%ecx
+  8007e3:	83 c2 01             	add    $0x1,%edx
+  8007e6:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  8007e9:	39 c2                	cmp    %eax,%edx
+  8007eb:	74 09                	je     8007f6 <strlcpy+0x32>
+  8007ed:	0f b6 19             	movzbl (%ecx),%ebx
+  8007f0:	84 db                	test   %bl,%bl
+  8007f2:	75 ec                	jne    8007e0 <strlcpy+0x1c>
+  8007f4:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  8007f6:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  8007f9:	29 f0                	sub    %esi,%eax
+}
+  8007fb:	5b                   	pop    %ebx
+  8007fc:	5e                   	pop    %esi
+  8007fd:	5d                   	pop    %ebp
+  8007fe:	c3                   	ret
+
+008007ff <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8007ff:	55                   	push   %ebp
+  800800:	89 e5                	mov    %esp,%ebp
+  800802:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800805:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  800808:	eb 06                	jmp    800810 <strcmp+0x11>
+    p++, q++;
+  80080a:	83 c1 01             	add    $0x1,%ecx
+  80080d:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  800810:	0f b6 01             	movzbl (%ecx),%eax
+  800813:	84 c0                	test   %al,%al
+  800815:	74 04                	je     80081b <strcmp+0x1c>
+  800817:	3a 02                	cmp    (%edx),%al
+  800819:	74 ef                	je     80080a <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  80081b:	0f b6 c0             	movzbl %al,%eax
+  80081e:	0f b6 12             	movzbl (%edx),%edx
+  800821:	29 d0                	sub    %edx,%eax
+}
+  800823:	5d                   	pop    %ebp
+  800824:	c3                   	ret
+
+00800825 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800825:	55                   	push   %ebp
+  800826:	89 e5                	mov    %esp,%ebp
+  800828:	53                   	push   %ebx
+  800829:	8b 45 08             	mov    0x8(%ebp),%eax
+  80082c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80082f:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  800832:	eb 09                	jmp    80083d <strncmp+0x18>
+    n--, p++, q++;
+  800834:	83 ea 01             	sub    $0x1,%edx
+  800837:	83 c0 01             	add    $0x1,%eax
+  80083a:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  80083d:	85 d2                	test   %edx,%edx
+  80083f:	74 18                	je     800859 <strncmp+0x34>
+  800841:	0f b6 18             	movzbl (%eax),%ebx
+  800844:	84 db                	test   %bl,%bl
+  800846:	74 04                	je     80084c <strncmp+0x27>
+  800848:	3a 19                	cmp    (%ecx),%bl
+  80084a:	74 e8                	je     800834 <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80084c:	0f b6 00             	movzbl (%eax),%eax
+  80084f:	0f b6 11             	movzbl (%ecx),%edx
+  800852:	29 d0                	sub    %edx,%eax
+}
+  800854:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800857:	c9                   	leave
+  800858:	c3                   	ret
+    return 0;
+  800859:	b8 00 00 00 00       	mov    $0x0,%eax
+  80085e:	eb f4                	jmp    800854 <strncmp+0x2f>
+
+00800860 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800860:	55                   	push   %ebp
+  800861:	89 e5                	mov    %esp,%ebp
+  800863:	8b 45 08             	mov    0x8(%ebp),%eax
+  800866:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  80086a:	eb 03                	jmp    80086f <strchr+0xf>
+  80086c:	83 c0 01             	add    $0x1,%eax
+  80086f:	0f b6 10             	movzbl (%eax),%edx
+  800872:	84 d2                	test   %dl,%dl
+  800874:	74 06                	je     80087c <strchr+0x1c>
+    if (*s == c)
+  800876:	38 ca                	cmp    %cl,%dl
+  800878:	75 f2                	jne    80086c <strchr+0xc>
+  80087a:	eb 05                	jmp    800881 <strchr+0x21>
+      return (char*)s;
+  return 0;
+  80087c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800881:	5d                   	pop    %ebp
+  800882:	c3                   	ret
+
+00800883 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800883:	55                   	push   %ebp
+  800884:	89 e5                	mov    %esp,%ebp
+  800886:	8b 45 08             	mov    0x8(%ebp),%eax
+  800889:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  80088d:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  800890:	38 ca                	cmp    %cl,%dl
+  800892:	74 09                	je     80089d <strfind+0x1a>
+  800894:	84 d2                	test   %dl,%dl
+  800896:	74 05                	je     80089d <strfind+0x1a>
+  for (; *s; s++)
+  800898:	83 c0 01             	add    $0x1,%eax
+  80089b:	eb f0                	jmp    80088d <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  80089d:	5d                   	pop    %ebp
+  80089e:	c3                   	ret
+
+0080089f <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  80089f:	55                   	push   %ebp
+  8008a0:	89 e5                	mov    %esp,%ebp
+  8008a2:	57                   	push   %edi
+  8008a3:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8008a6:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  8008a9:	85 c9                	test   %ecx,%ecx
+  8008ab:	74 20                	je     8008cd <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  8008ad:	89 f8                	mov    %edi,%eax
+  8008af:	09 c8                	or     %ecx,%eax
+  8008b1:	a8 03                	test   $0x3,%al
+  8008b3:	75 12                	jne    8008c7 <memset+0x28>
+    c &= 0xFF;
+  8008b5:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8008b9:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  8008bf:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  8008c2:	fc                   	cld
+  8008c3:	f3 ab                	rep stos %eax,%es:(%edi)
+  8008c5:	eb 06                	jmp    8008cd <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  8008c7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8008ca:	fc                   	cld
+  8008cb:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  8008cd:	89 f8                	mov    %edi,%eax
+  8008cf:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8008d2:	c9                   	leave
+  8008d3:	c3                   	ret
+
+008008d4 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8008d4:	55                   	push   %ebp
+  8008d5:	89 e5                	mov    %esp,%ebp
+  8008d7:	57                   	push   %edi
+  8008d8:	56                   	push   %esi
+  8008d9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008dc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8008df:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  8008e2:	39 c6                	cmp    %eax,%esi
+  8008e4:	73 32                	jae    800918 <memmove+0x44>
+  8008e6:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8008e9:	39 d0                	cmp    %edx,%eax
+  8008eb:	73 2b                	jae    800918 <memmove+0x44>
+    s += n;
+    d += n;
+  8008ed:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8008f0:	89 d6                	mov    %edx,%esi
+  8008f2:	09 fe                	or     %edi,%esi
+  8008f4:	09 ce                	or     %ecx,%esi
+  8008f6:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8008fc:	75 0e                	jne    80090c <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8008fe:	83 ef 04             	sub    $0x4,%edi
+  800901:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800904:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  800907:	fd                   	std
+  800908:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80090a:	eb 09                	jmp    800915 <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  80090c:	83 ef 01             	sub    $0x1,%edi
+  80090f:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  800912:	fd                   	std
+  800913:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  800915:	fc                   	cld
+  800916:	eb 1a                	jmp    800932 <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800918:	89 f2                	mov    %esi,%edx
+  80091a:	09 c2                	or     %eax,%edx
+  80091c:	09 ca                	or     %ecx,%edx
+  80091e:	f6 c2 03             	test   $0x3,%dl
+  800921:	75 0a                	jne    80092d <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800923:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  800926:	89 c7                	mov    %eax,%edi
+  800928:	fc                   	cld
+  800929:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80092b:	eb 05                	jmp    800932 <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  80092d:	89 c7                	mov    %eax,%edi
+  80092f:	fc                   	cld
+  800930:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  800932:	5e                   	pop    %esi
+  800933:	5f                   	pop    %edi
+  800934:	5d                   	pop    %ebp
+  800935:	c3                   	ret
+
+00800936 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800936:	55                   	push   %ebp
+  800937:	89 e5                	mov    %esp,%ebp
+  800939:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  80093c:	ff 75 10             	push   0x10(%ebp)
+  80093f:	ff 75 0c             	push   0xc(%ebp)
+  800942:	ff 75 08             	push   0x8(%ebp)
+  800945:	e8 8a ff ff ff       	call   8008d4 <memmove>
+}
+  80094a:	c9                   	leave
+  80094b:	c3                   	ret
+
+0080094c <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  80094c:	55                   	push   %ebp
+  80094d:	89 e5                	mov    %esp,%ebp
+  80094f:	56                   	push   %esi
+  800950:	53                   	push   %ebx
+  800951:	8b 45 08             	mov    0x8(%ebp),%eax
+  800954:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  800957:	89 c6                	mov    %eax,%esi
+  800959:	03 75 10             	add    0x10(%ebp),%esi
+  80095c:	eb 06                	jmp    800964 <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  80095e:	83 c0 01             	add    $0x1,%eax
+  800961:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  800964:	39 f0                	cmp    %esi,%eax
+  800966:	74 14                	je     80097c <memcmp+0x30>
+    if (*s1 != *s2)
+  800968:	0f b6 08             	movzbl (%eax),%ecx
+  80096b:	0f b6 1a             	movzbl (%edx),%ebx
+  80096e:	38 d9                	cmp    %bl,%cl
+  800970:	74 ec                	je     80095e <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  800972:	0f b6 c1             	movzbl %cl,%eax
+  800975:	0f b6 db             	movzbl %bl,%ebx
+  800978:	29 d8                	sub    %ebx,%eax
+  80097a:	eb 05                	jmp    800981 <memcmp+0x35>
+  }
+
+  return 0;
+  80097c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800981:	5b                   	pop    %ebx
+  800982:	5e                   	pop    %esi
+  800983:	5d                   	pop    %ebp
+  800984:	c3                   	ret
+
+00800985 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800985:	55                   	push   %ebp
+  800986:	89 e5                	mov    %esp,%ebp
+  800988:	8b 45 08             	mov    0x8(%ebp),%eax
+  80098b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  80098e:	89 c2                	mov    %eax,%edx
+  800990:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  800993:	eb 03                	jmp    800998 <memfind+0x13>
+  800995:	83 c0 01             	add    $0x1,%eax
+  800998:	39 d0                	cmp    %edx,%eax
+  80099a:	73 04                	jae    8009a0 <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  80099c:	38 08                	cmp    %cl,(%eax)
+  80099e:	75 f5                	jne    800995 <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  8009a0:	5d                   	pop    %ebp
+  8009a1:	c3                   	ret
+
+008009a2 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8009a2:	55                   	push   %ebp
+  8009a3:	89 e5                	mov    %esp,%ebp
+  8009a5:	57                   	push   %edi
+  8009a6:	56                   	push   %esi
+  8009a7:	53                   	push   %ebx
+  8009a8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8009ab:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  8009ae:	eb 03                	jmp    8009b3 <strtol+0x11>
+    s++;
+  8009b0:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  8009b3:	0f b6 02             	movzbl (%edx),%eax
+  8009b6:	3c 20                	cmp    $0x20,%al
+  8009b8:	74 f6                	je     8009b0 <strtol+0xe>
+  8009ba:	3c 09                	cmp    $0x9,%al
+  8009bc:	74 f2                	je     8009b0 <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  8009be:	3c 2b                	cmp    $0x2b,%al
+  8009c0:	74 2a                	je     8009ec <strtol+0x4a>
+  int neg = 0;
+  8009c2:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  8009c7:	3c 2d                	cmp    $0x2d,%al
+  8009c9:	74 2b                	je     8009f6 <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8009cb:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8009d1:	75 0f                	jne    8009e2 <strtol+0x40>
+  8009d3:	80 3a 30             	cmpb   $0x30,(%edx)
+  8009d6:	74 28                	je     800a00 <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  8009d8:	85 db                	test   %ebx,%ebx
+  8009da:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8009df:	0f 44 d8             	cmove  %eax,%ebx
+  8009e2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009e7:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8009ea:	eb 46                	jmp    800a32 <strtol+0x90>
+    s++;
+  8009ec:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  8009ef:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009f4:	eb d5                	jmp    8009cb <strtol+0x29>
+    s++, neg = 1;
+  8009f6:	83 c2 01             	add    $0x1,%edx
+  8009f9:	bf 01 00 00 00       	mov    $0x1,%edi
+  8009fe:	eb cb                	jmp    8009cb <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a00:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a04:	74 0e                	je     800a14 <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  800a06:	85 db                	test   %ebx,%ebx
+  800a08:	75 d8                	jne    8009e2 <strtol+0x40>
+    s++, base = 8;
+  800a0a:	83 c2 01             	add    $0x1,%edx
+  800a0d:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a12:	eb ce                	jmp    8009e2 <strtol+0x40>
+    s += 2, base = 16;
+  800a14:	83 c2 02             	add    $0x2,%edx
+  800a17:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a1c:	eb c4                	jmp    8009e2 <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  800a1e:	0f be c0             	movsbl %al,%eax
+  800a21:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  800a24:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a27:	7d 3a                	jge    800a63 <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  800a29:	83 c2 01             	add    $0x1,%edx
+  800a2c:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a30:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  800a32:	0f b6 02             	movzbl (%edx),%eax
+  800a35:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a38:	89 f3                	mov    %esi,%ebx
+  800a3a:	80 fb 09             	cmp    $0x9,%bl
+  800a3d:	76 df                	jbe    800a1e <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  800a3f:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800a42:	89 f3                	mov    %esi,%ebx
+  800a44:	80 fb 19             	cmp    $0x19,%bl
+  800a47:	77 08                	ja     800a51 <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  800a49:	0f be c0             	movsbl %al,%eax
+  800a4c:	83 e8 57             	sub    $0x57,%eax
+  800a4f:	eb d3                	jmp    800a24 <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  800a51:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800a54:	89 f3                	mov    %esi,%ebx
+  800a56:	80 fb 19             	cmp    $0x19,%bl
+  800a59:	77 08                	ja     800a63 <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  800a5b:	0f be c0             	movsbl %al,%eax
+  800a5e:	83 e8 37             	sub    $0x37,%eax
+  800a61:	eb c1                	jmp    800a24 <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  800a63:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800a67:	74 05                	je     800a6e <strtol+0xcc>
+    *endptr = (char*)s;
+  800a69:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a6c:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  800a6e:	89 c8                	mov    %ecx,%eax
+  800a70:	f7 d8                	neg    %eax
+  800a72:	85 ff                	test   %edi,%edi
+  800a74:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800a77:	89 c8                	mov    %ecx,%eax
+  800a79:	5b                   	pop    %ebx
+  800a7a:	5e                   	pop    %esi
+  800a7b:	5f                   	pop    %edi
+  800a7c:	5d                   	pop    %ebp
+  800a7d:	c3                   	ret
+
+00800a7e <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800a7e:	55                   	push   %ebp
+  800a7f:	89 e5                	mov    %esp,%ebp
+  800a81:	57                   	push   %edi
+  800a82:	56                   	push   %esi
+  800a83:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800a84:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a89:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a8c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a8f:	89 c3                	mov    %eax,%ebx
+  800a91:	89 c7                	mov    %eax,%edi
+  800a93:	89 c6                	mov    %eax,%esi
+  800a95:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800a97:	5b                   	pop    %ebx
+  800a98:	5e                   	pop    %esi
+  800a99:	5f                   	pop    %edi
+  800a9a:	5d                   	pop    %ebp
+  800a9b:	c3                   	ret
+
+00800a9c <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800a9c:	55                   	push   %ebp
+  800a9d:	89 e5                	mov    %esp,%ebp
+  800a9f:	57                   	push   %edi
+  800aa0:	56                   	push   %esi
+  800aa1:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800aa2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800aa7:	b8 01 00 00 00       	mov    $0x1,%eax
+  800aac:	89 d1                	mov    %edx,%ecx
+  800aae:	89 d3                	mov    %edx,%ebx
+  800ab0:	89 d7                	mov    %edx,%edi
+  800ab2:	89 d6                	mov    %edx,%esi
+  800ab4:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800ab6:	5b                   	pop    %ebx
+  800ab7:	5e                   	pop    %esi
+  800ab8:	5f                   	pop    %edi
+  800ab9:	5d                   	pop    %ebp
+  800aba:	c3                   	ret
+
+00800abb <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800abb:	55                   	push   %ebp
+  800abc:	89 e5                	mov    %esp,%ebp
+  800abe:	57                   	push   %edi
+  800abf:	56                   	push   %esi
+  800ac0:	53                   	push   %ebx
+  800ac1:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800ac4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ac9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800acc:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ad1:	89 cb                	mov    %ecx,%ebx
+  800ad3:	89 cf                	mov    %ecx,%edi
+  800ad5:	89 ce                	mov    %ecx,%esi
+  800ad7:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ad9:	85 c0                	test   %eax,%eax
+  800adb:	7f 08                	jg     800ae5 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800add:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ae0:	5b                   	pop    %ebx
+  800ae1:	5e                   	pop    %esi
+  800ae2:	5f                   	pop    %edi
+  800ae3:	5d                   	pop    %ebp
+  800ae4:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ae5:	83 ec 0c             	sub    $0xc,%esp
+  800ae8:	50                   	push   %eax
+  800ae9:	6a 03                	push   $0x3
+  800aeb:	68 c3 31 80 00       	push   $0x8031c3
+  800af0:	6a 23                	push   $0x23
+  800af2:	68 e0 31 80 00       	push   $0x8031e0
+  800af7:	e8 41 1f 00 00       	call   802a3d <_panic>
+
+00800afc <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800afc:	55                   	push   %ebp
+  800afd:	89 e5                	mov    %esp,%ebp
+  800aff:	57                   	push   %edi
+  800b00:	56                   	push   %esi
+  800b01:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800b02:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b07:	b8 02 00 00 00       	mov    $0x2,%eax
+  800b0c:	89 d1                	mov    %edx,%ecx
+  800b0e:	89 d3                	mov    %edx,%ebx
+  800b10:	89 d7                	mov    %edx,%edi
+  800b12:	89 d6                	mov    %edx,%esi
+  800b14:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800b16:	5b                   	pop    %ebx
+  800b17:	5e                   	pop    %esi
+  800b18:	5f                   	pop    %edi
+  800b19:	5d                   	pop    %ebp
+  800b1a:	c3                   	ret
+
+00800b1b <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800b1b:	55                   	push   %ebp
+  800b1c:	89 e5                	mov    %esp,%ebp
+  800b1e:	57                   	push   %edi
+  800b1f:	56                   	push   %esi
+  800b20:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800b21:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b26:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800b2b:	89 d1                	mov    %edx,%ecx
+  800b2d:	89 d3                	mov    %edx,%ebx
+  800b2f:	89 d7                	mov    %edx,%edi
+  800b31:	89 d6                	mov    %edx,%esi
+  800b33:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800b35:	5b                   	pop    %ebx
+  800b36:	5e                   	pop    %esi
+  800b37:	5f                   	pop    %edi
+  800b38:	5d                   	pop    %ebp
+  800b39:	c3                   	ret
+
+00800b3a <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  800b3a:	55                   	push   %ebp
+  800b3b:	89 e5                	mov    %esp,%ebp
+  800b3d:	57                   	push   %edi
+  800b3e:	56                   	push   %esi
+  800b3f:	53                   	push   %ebx
+  800b40:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  800b43:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  800b47:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b4c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b4f:	b8 14 00 00 00       	mov    $0x14,%eax
+  800b54:	89 df                	mov    %ebx,%edi
+  800b56:	89 de                	mov    %ebx,%esi
+  800b58:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800b5a:	85 c0                	test   %eax,%eax
+  800b5c:	7f 08                	jg     800b66 <sys_env_set_cow+0x2c>
+}
+  800b5e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b61:	5b                   	pop    %ebx
+  800b62:	5e                   	pop    %esi
+  800b63:	5f                   	pop    %edi
+  800b64:	5d                   	pop    %ebp
+  800b65:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800b66:	83 ec 0c             	sub    $0xc,%esp
+  800b69:	50                   	push   %eax
+  800b6a:	6a 14                	push   $0x14
+  800b6c:	68 c3 31 80 00       	push   $0x8031c3
+  800b71:	6a 23                	push   $0x23
+  800b73:	68 e0 31 80 00       	push   $0x8031e0
+  800b78:	e8 c0 1e 00 00       	call   802a3d <_panic>
+
+00800b7d <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800b7d:	55                   	push   %ebp
+  800b7e:	89 e5                	mov    %esp,%ebp
+  800b80:	57                   	push   %edi
+  800b81:	56                   	push   %esi
+  800b82:	53                   	push   %ebx
+  800b83:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800b86:	be 00 00 00 00       	mov    $0x0,%esi
+  800b8b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b8e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b91:	b8 04 00 00 00       	mov    $0x4,%eax
+  800b96:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800b99:	89 f7                	mov    %esi,%edi
+  800b9b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800b9d:	85 c0                	test   %eax,%eax
+  800b9f:	7f 08                	jg     800ba9 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  800ba1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ba4:	5b                   	pop    %ebx
+  800ba5:	5e                   	pop    %esi
+  800ba6:	5f                   	pop    %edi
+  800ba7:	5d                   	pop    %ebp
+  800ba8:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ba9:	83 ec 0c             	sub    $0xc,%esp
+  800bac:	50                   	push   %eax
+  800bad:	6a 04                	push   $0x4
+  800baf:	68 c3 31 80 00       	push   $0x8031c3
+  800bb4:	6a 23                	push   $0x23
+  800bb6:	68 e0 31 80 00       	push   $0x8031e0
+  800bbb:	e8 7d 1e 00 00       	call   802a3d <_panic>
+
+00800bc0 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800bc0:	55                   	push   %ebp
+  800bc1:	89 e5                	mov    %esp,%ebp
+  800bc3:	57                   	push   %edi
+  800bc4:	56                   	push   %esi
+  800bc5:	53                   	push   %ebx
+  800bc6:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800bc9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bcc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bcf:	b8 05 00 00 00       	mov    $0x5,%eax
+  800bd4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800bd7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800bda:	8b 75 18             	mov    0x18(%ebp),%esi
+  800bdd:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800bdf:	85 c0                	test   %eax,%eax
+  800be1:	7f 08                	jg     800beb <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  800be3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800be6:	5b                   	pop    %ebx
+  800be7:	5e                   	pop    %esi
+  800be8:	5f                   	pop    %edi
+  800be9:	5d                   	pop    %ebp
+  800bea:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800beb:	83 ec 0c             	sub    $0xc,%esp
+  800bee:	50                   	push   %eax
+  800bef:	6a 05                	push   $0x5
+  800bf1:	68 c3 31 80 00       	push   $0x8031c3
+  800bf6:	6a 23                	push   $0x23
+  800bf8:	68 e0 31 80 00       	push   $0x8031e0
+  800bfd:	e8 3b 1e 00 00       	call   802a3d <_panic>
+
+00800c02 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800c02:	55                   	push   %ebp
+  800c03:	89 e5                	mov    %esp,%ebp
+  800c05:	57                   	push   %edi
+  800c06:	56                   	push   %esi
+  800c07:	53                   	push   %ebx
+  800c08:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800c0b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c10:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c13:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c16:	b8 06 00 00 00       	mov    $0x6,%eax
+  800c1b:	89 df                	mov    %ebx,%edi
+  800c1d:	89 de                	mov    %ebx,%esi
+  800c1f:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c21:	85 c0                	test   %eax,%eax
+  800c23:	7f 08                	jg     800c2d <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  800c25:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c28:	5b                   	pop    %ebx
+  800c29:	5e                   	pop    %esi
+  800c2a:	5f                   	pop    %edi
+  800c2b:	5d                   	pop    %ebp
+  800c2c:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c2d:	83 ec 0c             	sub    $0xc,%esp
+  800c30:	50                   	push   %eax
+  800c31:	6a 06                	push   $0x6
+  800c33:	68 c3 31 80 00       	push   $0x8031c3
+  800c38:	6a 23                	push   $0x23
+  800c3a:	68 e0 31 80 00       	push   $0x8031e0
+  800c3f:	e8 f9 1d 00 00       	call   802a3d <_panic>
+
+00800c44 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  800c44:	55                   	push   %ebp
+  800c45:	89 e5                	mov    %esp,%ebp
+  800c47:	57                   	push   %edi
+  800c48:	56                   	push   %esi
+  800c49:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800c4a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c4d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c50:	b8 11 00 00 00       	mov    $0x11,%eax
+  800c55:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c58:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c5b:	8b 75 18             	mov    0x18(%ebp),%esi
+  800c5e:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  800c60:	5b                   	pop    %ebx
+  800c61:	5e                   	pop    %esi
+  800c62:	5f                   	pop    %edi
+  800c63:	5d                   	pop    %ebp
+  800c64:	c3                   	ret
+
+00800c65 <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  800c65:	55                   	push   %ebp
+  800c66:	89 e5                	mov    %esp,%ebp
+  800c68:	57                   	push   %edi
+  800c69:	56                   	push   %esi
+  800c6a:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800c6b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c6e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c71:	b8 12 00 00 00       	mov    $0x12,%eax
+  800c76:	be 00 00 00 00       	mov    $0x0,%esi
+  800c7b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c7e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c81:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  800c83:	5b                   	pop    %ebx
+  800c84:	5e                   	pop    %esi
+  800c85:	5f                   	pop    %edi
+  800c86:	5d                   	pop    %ebp
+  800c87:	c3                   	ret
+
+00800c88 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  800c88:	55                   	push   %ebp
+  800c89:	89 e5                	mov    %esp,%ebp
+  800c8b:	57                   	push   %edi
+  800c8c:	56                   	push   %esi
+  800c8d:	53                   	push   %ebx
+  800c8e:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800c91:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c96:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c99:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c9c:	b8 16 00 00 00       	mov    $0x16,%eax
+  800ca1:	89 df                	mov    %ebx,%edi
+  800ca3:	89 de                	mov    %ebx,%esi
+  800ca5:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ca7:	85 c0                	test   %eax,%eax
+  800ca9:	7f 08                	jg     800cb3 <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  800cab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cae:	5b                   	pop    %ebx
+  800caf:	5e                   	pop    %esi
+  800cb0:	5f                   	pop    %edi
+  800cb1:	5d                   	pop    %ebp
+  800cb2:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800cb3:	83 ec 0c             	sub    $0xc,%esp
+  800cb6:	50                   	push   %eax
+  800cb7:	6a 16                	push   $0x16
+  800cb9:	68 c3 31 80 00       	push   $0x8031c3
+  800cbe:	6a 23                	push   $0x23
+  800cc0:	68 e0 31 80 00       	push   $0x8031e0
+  800cc5:	e8 73 1d 00 00       	call   802a3d <_panic>
+
+00800cca <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  800cca:	55                   	push   %ebp
+  800ccb:	89 e5                	mov    %esp,%ebp
+  800ccd:	57                   	push   %edi
+  800cce:	56                   	push   %esi
+  800ccf:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800cd0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cd5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cd8:	b8 17 00 00 00       	mov    $0x17,%eax
+  800cdd:	89 cb                	mov    %ecx,%ebx
+  800cdf:	89 cf                	mov    %ecx,%edi
+  800ce1:	89 ce                	mov    %ecx,%esi
+  800ce3:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  800ce5:	5b                   	pop    %ebx
+  800ce6:	5e                   	pop    %esi
+  800ce7:	5f                   	pop    %edi
+  800ce8:	5d                   	pop    %ebp
+  800ce9:	c3                   	ret
+
+00800cea <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  800cea:	55                   	push   %ebp
+  800ceb:	89 e5                	mov    %esp,%ebp
+  800ced:	57                   	push   %edi
+  800cee:	56                   	push   %esi
+  800cef:	53                   	push   %ebx
+  800cf0:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800cf3:	be 00 00 00 00       	mov    $0x0,%esi
+  800cf8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cfb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cfe:	b8 18 00 00 00       	mov    $0x18,%eax
+  800d03:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d06:	89 f7                	mov    %esi,%edi
+  800d08:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d0a:	85 c0                	test   %eax,%eax
+  800d0c:	7f 08                	jg     800d16 <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  800d0e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d11:	5b                   	pop    %ebx
+  800d12:	5e                   	pop    %esi
+  800d13:	5f                   	pop    %edi
+  800d14:	5d                   	pop    %ebp
+  800d15:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d16:	83 ec 0c             	sub    $0xc,%esp
+  800d19:	50                   	push   %eax
+  800d1a:	6a 18                	push   $0x18
+  800d1c:	68 c3 31 80 00       	push   $0x8031c3
+  800d21:	6a 23                	push   $0x23
+  800d23:	68 e0 31 80 00       	push   $0x8031e0
+  800d28:	e8 10 1d 00 00       	call   802a3d <_panic>
+
+00800d2d <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  800d2d:	55                   	push   %ebp
+  800d2e:	89 e5                	mov    %esp,%ebp
+  800d30:	57                   	push   %edi
+  800d31:	56                   	push   %esi
+  800d32:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d33:	be 00 00 00 00       	mov    $0x0,%esi
+  800d38:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d3b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d3e:	b8 19 00 00 00       	mov    $0x19,%eax
+  800d43:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d46:	89 f7                	mov    %esi,%edi
+  800d48:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  800d4a:	5b                   	pop    %ebx
+  800d4b:	5e                   	pop    %esi
+  800d4c:	5f                   	pop    %edi
+  800d4d:	5d                   	pop    %ebp
+  800d4e:	c3                   	ret
+
+00800d4f <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  800d4f:	55                   	push   %ebp
+  800d50:	89 e5                	mov    %esp,%ebp
+  800d52:	57                   	push   %edi
+  800d53:	56                   	push   %esi
+  800d54:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d55:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d5a:	b8 15 00 00 00       	mov    $0x15,%eax
+  800d5f:	89 d1                	mov    %edx,%ecx
+  800d61:	89 d3                	mov    %edx,%ebx
+  800d63:	89 d7                	mov    %edx,%edi
+  800d65:	89 d6                	mov    %edx,%esi
+  800d67:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800d69:	5b                   	pop    %ebx
+  800d6a:	5e                   	pop    %esi
+  800d6b:	5f                   	pop    %edi
+  800d6c:	5d                   	pop    %ebp
+  800d6d:	c3                   	ret
+
+00800d6e <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800d6e:	55                   	push   %ebp
+  800d6f:	89 e5                	mov    %esp,%ebp
+  800d71:	57                   	push   %edi
+  800d72:	56                   	push   %esi
+  800d73:	53                   	push   %ebx
+  800d74:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800d77:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d7c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d7f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d82:	b8 08 00 00 00       	mov    $0x8,%eax
+  800d87:	89 df                	mov    %ebx,%edi
+  800d89:	89 de                	mov    %ebx,%esi
+  800d8b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d8d:	85 c0                	test   %eax,%eax
+  800d8f:	7f 08                	jg     800d99 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800d91:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d94:	5b                   	pop    %ebx
+  800d95:	5e                   	pop    %esi
+  800d96:	5f                   	pop    %edi
+  800d97:	5d                   	pop    %ebp
+  800d98:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d99:	83 ec 0c             	sub    $0xc,%esp
+  800d9c:	50                   	push   %eax
+  800d9d:	6a 08                	push   $0x8
+  800d9f:	68 c3 31 80 00       	push   $0x8031c3
+  800da4:	6a 23                	push   $0x23
+  800da6:	68 e0 31 80 00       	push   $0x8031e0
+  800dab:	e8 8d 1c 00 00       	call   802a3d <_panic>
+
+00800db0 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800db0:	55                   	push   %ebp
+  800db1:	89 e5                	mov    %esp,%ebp
+  800db3:	57                   	push   %edi
+  800db4:	56                   	push   %esi
+  800db5:	53                   	push   %ebx
+  800db6:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800db9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dbe:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dc1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dc4:	b8 09 00 00 00       	mov    $0x9,%eax
+  800dc9:	89 df                	mov    %ebx,%edi
+  800dcb:	89 de                	mov    %ebx,%esi
+  800dcd:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800dcf:	85 c0                	test   %eax,%eax
+  800dd1:	7f 08                	jg     800ddb <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  800dd3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dd6:	5b                   	pop    %ebx
+  800dd7:	5e                   	pop    %esi
+  800dd8:	5f                   	pop    %edi
+  800dd9:	5d                   	pop    %ebp
+  800dda:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ddb:	83 ec 0c             	sub    $0xc,%esp
+  800dde:	50                   	push   %eax
+  800ddf:	6a 09                	push   $0x9
+  800de1:	68 c3 31 80 00       	push   $0x8031c3
+  800de6:	6a 23                	push   $0x23
+  800de8:	68 e0 31 80 00       	push   $0x8031e0
+  800ded:	e8 4b 1c 00 00       	call   802a3d <_panic>
+
+00800df2 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800df2:	55                   	push   %ebp
+  800df3:	89 e5                	mov    %esp,%ebp
+  800df5:	57                   	push   %edi
+  800df6:	56                   	push   %esi
+  800df7:	53                   	push   %ebx
+  800df8:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800dfb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e00:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e03:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e06:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e0b:	89 df                	mov    %ebx,%edi
+  800e0d:	89 de                	mov    %ebx,%esi
+  800e0f:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e11:	85 c0                	test   %eax,%eax
+  800e13:	7f 08                	jg     800e1d <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  800e15:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e18:	5b                   	pop    %ebx
+  800e19:	5e                   	pop    %esi
+  800e1a:	5f                   	pop    %edi
+  800e1b:	5d                   	pop    %ebp
+  800e1c:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e1d:	83 ec 0c             	sub    $0xc,%esp
+  800e20:	50                   	push   %eax
+  800e21:	6a 0a                	push   $0xa
+  800e23:	68 c3 31 80 00       	push   $0x8031c3
+  800e28:	6a 23                	push   $0x23
+  800e2a:	68 e0 31 80 00       	push   $0x8031e0
+  800e2f:	e8 09 1c 00 00       	call   802a3d <_panic>
+
+00800e34 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  800e34:	55                   	push   %ebp
+  800e35:	89 e5                	mov    %esp,%ebp
+  800e37:	57                   	push   %edi
+  800e38:	56                   	push   %esi
+  800e39:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e3a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e3d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e40:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800e45:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e48:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e4b:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e4e:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  800e50:	5b                   	pop    %ebx
+  800e51:	5e                   	pop    %esi
+  800e52:	5f                   	pop    %edi
+  800e53:	5d                   	pop    %ebp
+  800e54:	c3                   	ret
+
+00800e55 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  800e55:	55                   	push   %ebp
+  800e56:	89 e5                	mov    %esp,%ebp
+  800e58:	57                   	push   %edi
+  800e59:	56                   	push   %esi
+  800e5a:	53                   	push   %ebx
+  800e5b:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e5e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e63:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e66:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e69:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800e6e:	89 df                	mov    %ebx,%edi
+  800e70:	89 de                	mov    %ebx,%esi
+  800e72:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e74:	85 c0                	test   %eax,%eax
+  800e76:	7f 08                	jg     800e80 <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  800e78:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e7b:	5b                   	pop    %ebx
+  800e7c:	5e                   	pop    %esi
+  800e7d:	5f                   	pop    %edi
+  800e7e:	5d                   	pop    %ebp
+  800e7f:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e80:	83 ec 0c             	sub    $0xc,%esp
+  800e83:	50                   	push   %eax
+  800e84:	6a 0d                	push   $0xd
+  800e86:	68 c3 31 80 00       	push   $0x8031c3
+  800e8b:	6a 23                	push   $0x23
+  800e8d:	68 e0 31 80 00       	push   $0x8031e0
+  800e92:	e8 a6 1b 00 00       	call   802a3d <_panic>
+
+00800e97 <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  800e97:	55                   	push   %ebp
+  800e98:	89 e5                	mov    %esp,%ebp
+  800e9a:	57                   	push   %edi
+  800e9b:	56                   	push   %esi
+  800e9c:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e9d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ea2:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800ea7:	89 d1                	mov    %edx,%ecx
+  800ea9:	89 d3                	mov    %edx,%ebx
+  800eab:	89 d7                	mov    %edx,%edi
+  800ead:	89 d6                	mov    %edx,%esi
+  800eaf:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800eb1:	5b                   	pop    %ebx
+  800eb2:	5e                   	pop    %esi
+  800eb3:	5f                   	pop    %edi
+  800eb4:	5d                   	pop    %ebp
+  800eb5:	c3                   	ret
+
+00800eb6 <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  800eb6:	55                   	push   %ebp
+  800eb7:	89 e5                	mov    %esp,%ebp
+  800eb9:	57                   	push   %edi
+  800eba:	56                   	push   %esi
+  800ebb:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800ebc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ebf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ec2:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800ec7:	be 00 00 00 00       	mov    $0x0,%esi
+  800ecc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ecf:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ed2:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  800ed4:	5b                   	pop    %ebx
+  800ed5:	5e                   	pop    %esi
+  800ed6:	5f                   	pop    %edi
+  800ed7:	5d                   	pop    %ebp
+  800ed8:	c3                   	ret
+
+00800ed9 <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  800ed9:	55                   	push   %ebp
+  800eda:	89 e5                	mov    %esp,%ebp
+  800edc:	57                   	push   %edi
+  800edd:	56                   	push   %esi
+  800ede:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800edf:	be 00 00 00 00       	mov    $0x0,%esi
+  800ee4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eea:	b8 10 00 00 00       	mov    $0x10,%eax
+  800eef:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ef2:	89 f7                	mov    %esi,%edi
+  800ef4:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  800ef6:	5b                   	pop    %ebx
+  800ef7:	5e                   	pop    %esi
+  800ef8:	5f                   	pop    %edi
+  800ef9:	5d                   	pop    %ebp
+  800efa:	c3                   	ret
+
+00800efb <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  800efb:	55                   	push   %ebp
+  800efc:	89 e5                	mov    %esp,%ebp
+  800efe:	57                   	push   %edi
+  800eff:	56                   	push   %esi
+  800f00:	53                   	push   %ebx
+  800f01:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  800f04:	80 3d 48 57 80 00 00 	cmpb   $0x0,0x805748
+  800f0b:	74 41                	je     800f4e <sys_batch+0x53>
+  800f0d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f10:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  800f13:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  800f1a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800f1d:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  800f20:	7d 45                	jge    800f67 <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  800f22:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800f25:	8b 06                	mov    (%esi),%eax
+  800f27:	8b 56 04             	mov    0x4(%esi),%edx
+  800f2a:	8b 4e 08             	mov    0x8(%esi),%ecx
+  800f2d:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  800f30:	8b 7e 10             	mov    0x10(%esi),%edi
+  800f33:	8b 76 14             	mov    0x14(%esi),%esi
+  800f36:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  800f38:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800f3b:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  800f3e:	83 c6 1c             	add    $0x1c,%esi
+  800f41:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  800f44:	85 c0                	test   %eax,%eax
+  800f46:	78 1f                	js     800f67 <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  800f48:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  800f4c:	eb cc                	jmp    800f1a <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  800f4e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f53:	b8 13 00 00 00       	mov    $0x13,%eax
+  800f58:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f5b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f5e:	89 df                	mov    %ebx,%edi
+  800f60:	89 de                	mov    %ebx,%esi
+  800f62:	cd 30                	int    $0x30
+  800f64:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  800f67:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800f6a:	83 c4 08             	add    $0x8,%esp
+  800f6d:	5b                   	pop    %ebx
+  800f6e:	5e                   	pop    %esi
+  800f6f:	5f                   	pop    %edi
+  800f70:	5d                   	pop    %ebp
+  800f71:	c3                   	ret
+
+00800f72 <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  800f72:	55                   	push   %ebp
+  800f73:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  800f75:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f78:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  800f7e:	5d                   	pop    %ebp
+  800f7f:	c3                   	ret
+
+00800f80 <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  800f80:	55                   	push   %ebp
+  800f81:	89 e5                	mov    %esp,%ebp
+  800f83:	56                   	push   %esi
+  800f84:	53                   	push   %ebx
+  800f85:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  800f88:	8b 1e                	mov    (%esi),%ebx
+  800f8a:	85 db                	test   %ebx,%ebx
+  800f8c:	75 09                	jne    800f97 <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  800f8e:	89 d8                	mov    %ebx,%eax
+  800f90:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800f93:	5b                   	pop    %ebx
+  800f94:	5e                   	pop    %esi
+  800f95:	5d                   	pop    %ebp
+  800f96:	c3                   	ret
+  b->sb_n = 0;
+  800f97:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  800f9d:	53                   	push   %ebx
+  800f9e:	8d 46 04             	lea    0x4(%esi),%eax
+  800fa1:	50                   	push   %eax
+  800fa2:	e8 54 ff ff ff       	call   800efb <sys_batch>
+  800fa7:	83 c4 08             	add    $0x8,%esp
+  800faa:	85 c0                	test   %eax,%eax
+  800fac:	78 1e                	js     800fcc <sysbatch_flush+0x4c>
+  if (r < n)
+  800fae:	39 c3                	cmp    %eax,%ebx
+  800fb0:	7f 07                	jg     800fb9 <sysbatch_flush+0x39>
+  return 0;
+  800fb2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fb7:	eb d5                	jmp    800f8e <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  800fb9:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  800fbc:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  800fc0:	85 db                	test   %ebx,%ebx
+  800fc2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800fc7:	0f 49 d8             	cmovns %eax,%ebx
+  800fca:	eb c2                	jmp    800f8e <sysbatch_flush+0xe>
+    return r;
+  800fcc:	89 c3                	mov    %eax,%ebx
+  800fce:	eb be                	jmp    800f8e <sysbatch_flush+0xe>
+
+00800fd0 <sysbatch_add>:
+{
+  800fd0:	55                   	push   %ebp
+  800fd1:	89 e5                	mov    %esp,%ebp
+  800fd3:	53                   	push   %ebx
+  800fd4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  800fd7:	83 3b 40             	cmpl   $0x40,(%ebx)
+  800fda:	74 41                	je     80101d <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  800fdc:	8b 03                	mov    (%ebx),%eax
+  800fde:	8d 50 01             	lea    0x1(%eax),%edx
+  800fe1:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  800fe3:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  800fe6:	01 d8                	add    %ebx,%eax
+  800fe8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800feb:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  800fee:	8b 55 10             	mov    0x10(%ebp),%edx
+  800ff1:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  800ff4:	8b 55 14             	mov    0x14(%ebp),%edx
+  800ff7:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  800ffa:	8b 55 18             	mov    0x18(%ebp),%edx
+  800ffd:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  801000:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  801003:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  801006:	8b 55 20             	mov    0x20(%ebp),%edx
+  801009:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  80100c:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  801013:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801018:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80101b:	c9                   	leave
+  80101c:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  80101d:	53                   	push   %ebx
+  80101e:	e8 5d ff ff ff       	call   800f80 <sysbatch_flush>
+  801023:	83 c4 04             	add    $0x4,%esp
+  801026:	85 c0                	test   %eax,%eax
+  801028:	79 b2                	jns    800fdc <sysbatch_add+0xc>
+  80102a:	eb ec                	jmp    801018 <sysbatch_add+0x48>
+
+0080102c <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80102c:	55                   	push   %ebp
+  80102d:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80102f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801032:	05 00 00 00 30       	add    $0x30000000,%eax
+  801037:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80103a:	5d                   	pop    %ebp
+  80103b:	c3                   	ret
+
+0080103c <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80103c:	55                   	push   %ebp
+  80103d:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80103f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801042:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  801045:	66 b8 00 00          	mov    $0x0,%ax
+  801049:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80104e:	5d                   	pop    %ebp
+  80104f:	c3                   	ret
+
+00801050 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801050:	55                   	push   %ebp
+  801051:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  801053:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801058:	eb 02                	jmp    80105c <fd_alloc+0xc>
+  80105a:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80105c:	89 c2                	mov    %eax,%edx
+  80105e:	c1 ea 16             	shr    $0x16,%edx
+  801061:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801068:	f6 c2 01             	test   $0x1,%dl
+  80106b:	74 2b                	je     801098 <fd_alloc+0x48>
+  80106d:	89 c2                	mov    %eax,%edx
+  80106f:	c1 ea 0c             	shr    $0xc,%edx
+  801072:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801079:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80107f:	f6 c1 01             	test   $0x1,%cl
+  801082:	74 14                	je     801098 <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  801084:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  80108a:	75 ce                	jne    80105a <fd_alloc+0xa>
+  80108c:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  801091:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801096:	eb 05                	jmp    80109d <fd_alloc+0x4d>
+      return 0;
+  801098:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  80109d:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a0:	89 02                	mov    %eax,(%edx)
+}
+  8010a2:	89 c8                	mov    %ecx,%eax
+  8010a4:	5d                   	pop    %ebp
+  8010a5:	c3                   	ret
+
+008010a6 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8010a6:	55                   	push   %ebp
+  8010a7:	89 e5                	mov    %esp,%ebp
+  8010a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  8010ac:	83 f8 1f             	cmp    $0x1f,%eax
+  8010af:	77 30                	ja     8010e1 <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  8010b1:	c1 e0 0c             	shl    $0xc,%eax
+  8010b4:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8010b9:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8010bf:	f6 c2 01             	test   $0x1,%dl
+  8010c2:	74 24                	je     8010e8 <fd_lookup+0x42>
+  8010c4:	89 c2                	mov    %eax,%edx
+  8010c6:	c1 ea 0c             	shr    $0xc,%edx
+  8010c9:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8010d0:	f6 c2 01             	test   $0x1,%dl
+  8010d3:	74 1a                	je     8010ef <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  8010d5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8010d8:	89 02                	mov    %eax,(%edx)
+  return 0;
+  8010da:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8010df:	5d                   	pop    %ebp
+  8010e0:	c3                   	ret
+    return -E_INVAL;
+  8010e1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8010e6:	eb f7                	jmp    8010df <fd_lookup+0x39>
+    return -E_INVAL;
+  8010e8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8010ed:	eb f0                	jmp    8010df <fd_lookup+0x39>
+  8010ef:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8010f4:	eb e9                	jmp    8010df <fd_lookup+0x39>
+
+008010f6 <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8010f6:	55                   	push   %ebp
+  8010f7:	89 e5                	mov    %esp,%ebp
+  8010f9:	53                   	push   %ebx
+  8010fa:	83 ec 04             	sub    $0x4,%esp
+  8010fd:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  801100:	b8 6c 32 80 00       	mov    $0x80326c,%eax
+  801105:	8b 18                	mov    (%eax),%ebx
+  801107:	85 db                	test   %ebx,%ebx
+  801109:	74 0e                	je     801119 <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  80110b:	83 c0 04             	add    $0x4,%eax
+  80110e:	39 13                	cmp    %edx,(%ebx)
+  801110:	75 f3                	jne    801105 <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  801112:	b8 00 00 00 00       	mov    $0x0,%eax
+  801117:	eb 1f                	jmp    801138 <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801119:	a1 44 57 80 00       	mov    0x805744,%eax
+  80111e:	8b 40 48             	mov    0x48(%eax),%eax
+  801121:	83 ec 04             	sub    $0x4,%esp
+  801124:	52                   	push   %edx
+  801125:	50                   	push   %eax
+  801126:	68 f0 31 80 00       	push   $0x8031f0
+  80112b:	e8 30 f0 ff ff       	call   800160 <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  801130:	83 c4 10             	add    $0x10,%esp
+  801133:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  801138:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80113b:	89 1a                	mov    %ebx,(%edx)
+}
+  80113d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801140:	c9                   	leave
+  801141:	c3                   	ret
+
+00801142 <fd_close>:
+{
+  801142:	55                   	push   %ebp
+  801143:	89 e5                	mov    %esp,%ebp
+  801145:	57                   	push   %edi
+  801146:	56                   	push   %esi
+  801147:	53                   	push   %ebx
+  801148:	83 ec 24             	sub    $0x24,%esp
+  80114b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80114e:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801151:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801154:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801155:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80115b:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80115e:	50                   	push   %eax
+  80115f:	e8 42 ff ff ff       	call   8010a6 <fd_lookup>
+  801164:	89 c3                	mov    %eax,%ebx
+  801166:	83 c4 10             	add    $0x10,%esp
+  801169:	85 c0                	test   %eax,%eax
+  80116b:	78 05                	js     801172 <fd_close+0x30>
+      || fd != fd2)
+  80116d:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801170:	74 16                	je     801188 <fd_close+0x46>
+    return must_exist ? r : 0;
+  801172:	89 f8                	mov    %edi,%eax
+  801174:	84 c0                	test   %al,%al
+  801176:	b8 00 00 00 00       	mov    $0x0,%eax
+  80117b:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80117e:	89 d8                	mov    %ebx,%eax
+  801180:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801183:	5b                   	pop    %ebx
+  801184:	5e                   	pop    %esi
+  801185:	5f                   	pop    %edi
+  801186:	5d                   	pop    %ebp
+  801187:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801188:	83 ec 08             	sub    $0x8,%esp
+  80118b:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80118e:	50                   	push   %eax
+  80118f:	ff 36                	push   (%esi)
+  801191:	e8 60 ff ff ff       	call   8010f6 <dev_lookup>
+  801196:	89 c3                	mov    %eax,%ebx
+  801198:	83 c4 10             	add    $0x10,%esp
+  80119b:	85 c0                	test   %eax,%eax
+  80119d:	78 1a                	js     8011b9 <fd_close+0x77>
+    if (dev->dev_close)
+  80119f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8011a2:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  8011a5:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  8011aa:	85 c0                	test   %eax,%eax
+  8011ac:	74 0b                	je     8011b9 <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  8011ae:	83 ec 0c             	sub    $0xc,%esp
+  8011b1:	56                   	push   %esi
+  8011b2:	ff d0                	call   *%eax
+  8011b4:	89 c3                	mov    %eax,%ebx
+  8011b6:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  8011b9:	83 ec 08             	sub    $0x8,%esp
+  8011bc:	56                   	push   %esi
+  8011bd:	6a 00                	push   $0x0
+  8011bf:	e8 3e fa ff ff       	call   800c02 <sys_page_unmap>
+  return r;
+  8011c4:	83 c4 10             	add    $0x10,%esp
+  8011c7:	eb b5                	jmp    80117e <fd_close+0x3c>
+
+008011c9 <close>:
+
+int
+close(int fdnum)
+{
+  8011c9:	55                   	push   %ebp
+  8011ca:	89 e5                	mov    %esp,%ebp
+  8011cc:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8011cf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8011d2:	50                   	push   %eax
+  8011d3:	ff 75 08             	push   0x8(%ebp)
+  8011d6:	e8 cb fe ff ff       	call   8010a6 <fd_lookup>
+  8011db:	83 c4 10             	add    $0x10,%esp
+  8011de:	85 c0                	test   %eax,%eax
+  8011e0:	79 02                	jns    8011e4 <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  8011e2:	c9                   	leave
+  8011e3:	c3                   	ret
+    return fd_close(fd, 1);
+  8011e4:	83 ec 08             	sub    $0x8,%esp
+  8011e7:	6a 01                	push   $0x1
+  8011e9:	ff 75 f4             	push   -0xc(%ebp)
+  8011ec:	e8 51 ff ff ff       	call   801142 <fd_close>
+  8011f1:	83 c4 10             	add    $0x10,%esp
+  8011f4:	eb ec                	jmp    8011e2 <close+0x19>
+
+008011f6 <close_all>:
+
+void
+close_all(void)
+{
+  8011f6:	55                   	push   %ebp
+  8011f7:	89 e5                	mov    %esp,%ebp
+  8011f9:	53                   	push   %ebx
+  8011fa:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  8011fd:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  801202:	83 ec 0c             	sub    $0xc,%esp
+  801205:	53                   	push   %ebx
+  801206:	e8 be ff ff ff       	call   8011c9 <close>
+  for (i = 0; i < MAXFD; i++)
+  80120b:	83 c3 01             	add    $0x1,%ebx
+  80120e:	83 c4 10             	add    $0x10,%esp
+  801211:	83 fb 20             	cmp    $0x20,%ebx
+  801214:	75 ec                	jne    801202 <close_all+0xc>
+}
+  801216:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801219:	c9                   	leave
+  80121a:	c3                   	ret
+
+0080121b <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80121b:	55                   	push   %ebp
+  80121c:	89 e5                	mov    %esp,%ebp
+  80121e:	57                   	push   %edi
+  80121f:	56                   	push   %esi
+  801220:	53                   	push   %ebx
+  801221:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801224:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801227:	50                   	push   %eax
+  801228:	ff 75 08             	push   0x8(%ebp)
+  80122b:	e8 76 fe ff ff       	call   8010a6 <fd_lookup>
+  801230:	89 c6                	mov    %eax,%esi
+  801232:	83 c4 10             	add    $0x10,%esp
+  801235:	85 c0                	test   %eax,%eax
+  801237:	0f 88 0a 01 00 00    	js     801347 <dup+0x12c>
+    return r;
+  close(newfdnum);
+  80123d:	83 ec 0c             	sub    $0xc,%esp
+  801240:	ff 75 0c             	push   0xc(%ebp)
+  801243:	e8 81 ff ff ff       	call   8011c9 <close>
+
+  newfd = INDEX2FD(newfdnum);
+  801248:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80124b:	c1 e0 0c             	shl    $0xc,%eax
+  80124e:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  801254:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  801257:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80125a:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  80125d:	89 04 24             	mov    %eax,(%esp)
+  801260:	e8 d7 fd ff ff       	call   80103c <fd2data>
+  801265:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  801267:	89 3c 24             	mov    %edi,(%esp)
+  80126a:	e8 cd fd ff ff       	call   80103c <fd2data>
+  80126f:	83 c4 10             	add    $0x10,%esp
+  801272:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801275:	89 f3                	mov    %esi,%ebx
+  801277:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  80127d:	89 c6                	mov    %eax,%esi
+  80127f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801282:	89 cf                	mov    %ecx,%edi
+  801284:	eb 0c                	jmp    801292 <dup+0x77>
+  801286:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80128c:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801292:	39 fb                	cmp    %edi,%ebx
+  801294:	74 7b                	je     801311 <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  801296:	89 d8                	mov    %ebx,%eax
+  801298:	c1 e8 16             	shr    $0x16,%eax
+  80129b:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8012a2:	a8 01                	test   $0x1,%al
+  8012a4:	74 e0                	je     801286 <dup+0x6b>
+  8012a6:	89 d8                	mov    %ebx,%eax
+  8012a8:	c1 e8 0c             	shr    $0xc,%eax
+  8012ab:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8012b2:	f6 c2 01             	test   $0x1,%dl
+  8012b5:	74 cf                	je     801286 <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  8012b7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  8012be:	83 ec 0c             	sub    $0xc,%esp
+  8012c1:	25 07 0e 00 00       	and    $0xe07,%eax
+  8012c6:	50                   	push   %eax
+  8012c7:	56                   	push   %esi
+  8012c8:	6a 00                	push   $0x0
+  8012ca:	53                   	push   %ebx
+  8012cb:	6a 00                	push   $0x0
+  8012cd:	e8 ee f8 ff ff       	call   800bc0 <sys_page_map>
+  8012d2:	83 c4 20             	add    $0x20,%esp
+  8012d5:	85 c0                	test   %eax,%eax
+  8012d7:	79 ad                	jns    801286 <dup+0x6b>
+  8012d9:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8012dc:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  8012de:	83 ec 08             	sub    $0x8,%esp
+  8012e1:	ff 75 d4             	push   -0x2c(%ebp)
+  8012e4:	6a 00                	push   $0x0
+  8012e6:	e8 17 f9 ff ff       	call   800c02 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8012eb:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  8012ee:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  8012f4:	83 c4 10             	add    $0x10,%esp
+  8012f7:	39 df                	cmp    %ebx,%edi
+  8012f9:	74 4c                	je     801347 <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  8012fb:	83 ec 08             	sub    $0x8,%esp
+  8012fe:	57                   	push   %edi
+  8012ff:	6a 00                	push   $0x0
+  801301:	e8 fc f8 ff ff       	call   800c02 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801306:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  80130c:	83 c4 10             	add    $0x10,%esp
+  80130f:	eb e6                	jmp    8012f7 <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801311:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801314:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  801317:	89 c8                	mov    %ecx,%eax
+  801319:	c1 e8 0c             	shr    $0xc,%eax
+  80131c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801323:	83 ec 0c             	sub    $0xc,%esp
+  801326:	25 07 0e 00 00       	and    $0xe07,%eax
+  80132b:	50                   	push   %eax
+  80132c:	ff 75 d4             	push   -0x2c(%ebp)
+  80132f:	6a 00                	push   $0x0
+  801331:	51                   	push   %ecx
+  801332:	6a 00                	push   $0x0
+  801334:	e8 87 f8 ff ff       	call   800bc0 <sys_page_map>
+  801339:	89 c6                	mov    %eax,%esi
+  80133b:	83 c4 20             	add    $0x20,%esp
+  80133e:	85 c0                	test   %eax,%eax
+  801340:	78 9c                	js     8012de <dup+0xc3>
+  return newfdnum;
+  801342:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801345:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  801347:	89 f0                	mov    %esi,%eax
+  801349:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80134c:	5b                   	pop    %ebx
+  80134d:	5e                   	pop    %esi
+  80134e:	5f                   	pop    %edi
+  80134f:	5d                   	pop    %ebp
+  801350:	c3                   	ret
+
+00801351 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801351:	55                   	push   %ebp
+  801352:	89 e5                	mov    %esp,%ebp
+  801354:	56                   	push   %esi
+  801355:	53                   	push   %ebx
+  801356:	83 ec 18             	sub    $0x18,%esp
+  801359:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  80135c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80135f:	50                   	push   %eax
+  801360:	56                   	push   %esi
+  801361:	e8 40 fd ff ff       	call   8010a6 <fd_lookup>
+  801366:	83 c4 10             	add    $0x10,%esp
+  801369:	85 c0                	test   %eax,%eax
+  80136b:	78 3c                	js     8013a9 <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80136d:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801370:	83 ec 08             	sub    $0x8,%esp
+  801373:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801376:	50                   	push   %eax
+  801377:	ff 33                	push   (%ebx)
+  801379:	e8 78 fd ff ff       	call   8010f6 <dev_lookup>
+  80137e:	83 c4 10             	add    $0x10,%esp
+  801381:	85 c0                	test   %eax,%eax
+  801383:	78 24                	js     8013a9 <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801385:	8b 43 08             	mov    0x8(%ebx),%eax
+  801388:	83 e0 03             	and    $0x3,%eax
+  80138b:	83 f8 01             	cmp    $0x1,%eax
+  80138e:	74 20                	je     8013b0 <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  801390:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801393:	8b 40 08             	mov    0x8(%eax),%eax
+  801396:	85 c0                	test   %eax,%eax
+  801398:	74 37                	je     8013d1 <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  80139a:	83 ec 04             	sub    $0x4,%esp
+  80139d:	ff 75 10             	push   0x10(%ebp)
+  8013a0:	ff 75 0c             	push   0xc(%ebp)
+  8013a3:	53                   	push   %ebx
+  8013a4:	ff d0                	call   *%eax
+  8013a6:	83 c4 10             	add    $0x10,%esp
+}
+  8013a9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013ac:	5b                   	pop    %ebx
+  8013ad:	5e                   	pop    %esi
+  8013ae:	5d                   	pop    %ebp
+  8013af:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8013b0:	a1 44 57 80 00       	mov    0x805744,%eax
+  8013b5:	8b 40 48             	mov    0x48(%eax),%eax
+  8013b8:	83 ec 04             	sub    $0x4,%esp
+  8013bb:	56                   	push   %esi
+  8013bc:	50                   	push   %eax
+  8013bd:	68 31 32 80 00       	push   $0x803231
+  8013c2:	e8 99 ed ff ff       	call   800160 <cprintf>
+    return -E_INVAL;
+  8013c7:	83 c4 10             	add    $0x10,%esp
+  8013ca:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013cf:	eb d8                	jmp    8013a9 <read+0x58>
+    return -E_NOT_SUPP;
+  8013d1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8013d6:	eb d1                	jmp    8013a9 <read+0x58>
+
+008013d8 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8013d8:	55                   	push   %ebp
+  8013d9:	89 e5                	mov    %esp,%ebp
+  8013db:	57                   	push   %edi
+  8013dc:	56                   	push   %esi
+  8013dd:	53                   	push   %ebx
+  8013de:	83 ec 0c             	sub    $0xc,%esp
+  8013e1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8013e4:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  8013e7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013ec:	eb 02                	jmp    8013f0 <readn+0x18>
+  8013ee:	01 c3                	add    %eax,%ebx
+  8013f0:	39 f3                	cmp    %esi,%ebx
+  8013f2:	73 21                	jae    801415 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  8013f4:	83 ec 04             	sub    $0x4,%esp
+  8013f7:	89 f0                	mov    %esi,%eax
+  8013f9:	29 d8                	sub    %ebx,%eax
+  8013fb:	50                   	push   %eax
+  8013fc:	89 d8                	mov    %ebx,%eax
+  8013fe:	03 45 0c             	add    0xc(%ebp),%eax
+  801401:	50                   	push   %eax
+  801402:	57                   	push   %edi
+  801403:	e8 49 ff ff ff       	call   801351 <read>
+    if (m < 0)
+  801408:	83 c4 10             	add    $0x10,%esp
+  80140b:	85 c0                	test   %eax,%eax
+  80140d:	78 04                	js     801413 <readn+0x3b>
+      return m;
+    if (m == 0)
+  80140f:	75 dd                	jne    8013ee <readn+0x16>
+  801411:	eb 02                	jmp    801415 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  801413:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  801415:	89 d8                	mov    %ebx,%eax
+  801417:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80141a:	5b                   	pop    %ebx
+  80141b:	5e                   	pop    %esi
+  80141c:	5f                   	pop    %edi
+  80141d:	5d                   	pop    %ebp
+  80141e:	c3                   	ret
+
+0080141f <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80141f:	55                   	push   %ebp
+  801420:	89 e5                	mov    %esp,%ebp
+  801422:	56                   	push   %esi
+  801423:	53                   	push   %ebx
+  801424:	83 ec 18             	sub    $0x18,%esp
+  801427:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  80142a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80142d:	50                   	push   %eax
+  80142e:	53                   	push   %ebx
+  80142f:	e8 72 fc ff ff       	call   8010a6 <fd_lookup>
+  801434:	83 c4 10             	add    $0x10,%esp
+  801437:	85 c0                	test   %eax,%eax
+  801439:	78 37                	js     801472 <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80143b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80143e:	83 ec 08             	sub    $0x8,%esp
+  801441:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801444:	50                   	push   %eax
+  801445:	ff 36                	push   (%esi)
+  801447:	e8 aa fc ff ff       	call   8010f6 <dev_lookup>
+  80144c:	83 c4 10             	add    $0x10,%esp
+  80144f:	85 c0                	test   %eax,%eax
+  801451:	78 1f                	js     801472 <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801453:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801457:	74 20                	je     801479 <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  801459:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80145c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80145f:	85 c0                	test   %eax,%eax
+  801461:	74 37                	je     80149a <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  801463:	83 ec 04             	sub    $0x4,%esp
+  801466:	ff 75 10             	push   0x10(%ebp)
+  801469:	ff 75 0c             	push   0xc(%ebp)
+  80146c:	56                   	push   %esi
+  80146d:	ff d0                	call   *%eax
+  80146f:	83 c4 10             	add    $0x10,%esp
+}
+  801472:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801475:	5b                   	pop    %ebx
+  801476:	5e                   	pop    %esi
+  801477:	5d                   	pop    %ebp
+  801478:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801479:	a1 44 57 80 00       	mov    0x805744,%eax
+  80147e:	8b 40 48             	mov    0x48(%eax),%eax
+  801481:	83 ec 04             	sub    $0x4,%esp
+  801484:	53                   	push   %ebx
+  801485:	50                   	push   %eax
+  801486:	68 4d 32 80 00       	push   $0x80324d
+  80148b:	e8 d0 ec ff ff       	call   800160 <cprintf>
+    return -E_INVAL;
+  801490:	83 c4 10             	add    $0x10,%esp
+  801493:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801498:	eb d8                	jmp    801472 <write+0x53>
+    return -E_NOT_SUPP;
+  80149a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80149f:	eb d1                	jmp    801472 <write+0x53>
+
+008014a1 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8014a1:	55                   	push   %ebp
+  8014a2:	89 e5                	mov    %esp,%ebp
+  8014a4:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8014a7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014aa:	50                   	push   %eax
+  8014ab:	ff 75 08             	push   0x8(%ebp)
+  8014ae:	e8 f3 fb ff ff       	call   8010a6 <fd_lookup>
+  8014b3:	83 c4 10             	add    $0x10,%esp
+  8014b6:	85 c0                	test   %eax,%eax
+  8014b8:	78 0e                	js     8014c8 <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  8014ba:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8014bd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014c0:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  8014c3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8014c8:	c9                   	leave
+  8014c9:	c3                   	ret
+
+008014ca <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8014ca:	55                   	push   %ebp
+  8014cb:	89 e5                	mov    %esp,%ebp
+  8014cd:	56                   	push   %esi
+  8014ce:	53                   	push   %ebx
+  8014cf:	83 ec 18             	sub    $0x18,%esp
+  8014d2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  8014d5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8014d8:	50                   	push   %eax
+  8014d9:	53                   	push   %ebx
+  8014da:	e8 c7 fb ff ff       	call   8010a6 <fd_lookup>
+  8014df:	83 c4 10             	add    $0x10,%esp
+  8014e2:	85 c0                	test   %eax,%eax
+  8014e4:	78 34                	js     80151a <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8014e6:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8014e9:	83 ec 08             	sub    $0x8,%esp
+  8014ec:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014ef:	50                   	push   %eax
+  8014f0:	ff 36                	push   (%esi)
+  8014f2:	e8 ff fb ff ff       	call   8010f6 <dev_lookup>
+  8014f7:	83 c4 10             	add    $0x10,%esp
+  8014fa:	85 c0                	test   %eax,%eax
+  8014fc:	78 1c                	js     80151a <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8014fe:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801502:	74 1d                	je     801521 <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  801504:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801507:	8b 40 18             	mov    0x18(%eax),%eax
+  80150a:	85 c0                	test   %eax,%eax
+  80150c:	74 34                	je     801542 <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  80150e:	83 ec 08             	sub    $0x8,%esp
+  801511:	ff 75 0c             	push   0xc(%ebp)
+  801514:	56                   	push   %esi
+  801515:	ff d0                	call   *%eax
+  801517:	83 c4 10             	add    $0x10,%esp
+}
+  80151a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80151d:	5b                   	pop    %ebx
+  80151e:	5e                   	pop    %esi
+  80151f:	5d                   	pop    %ebp
+  801520:	c3                   	ret
+            thisenv->env_id, fdnum);
+  801521:	a1 44 57 80 00       	mov    0x805744,%eax
+  801526:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801529:	83 ec 04             	sub    $0x4,%esp
+  80152c:	53                   	push   %ebx
+  80152d:	50                   	push   %eax
+  80152e:	68 10 32 80 00       	push   $0x803210
+  801533:	e8 28 ec ff ff       	call   800160 <cprintf>
+    return -E_INVAL;
+  801538:	83 c4 10             	add    $0x10,%esp
+  80153b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801540:	eb d8                	jmp    80151a <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  801542:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801547:	eb d1                	jmp    80151a <ftruncate+0x50>
+
+00801549 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801549:	55                   	push   %ebp
+  80154a:	89 e5                	mov    %esp,%ebp
+  80154c:	56                   	push   %esi
+  80154d:	53                   	push   %ebx
+  80154e:	83 ec 18             	sub    $0x18,%esp
+  801551:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801554:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801557:	50                   	push   %eax
+  801558:	ff 75 08             	push   0x8(%ebp)
+  80155b:	e8 46 fb ff ff       	call   8010a6 <fd_lookup>
+  801560:	83 c4 10             	add    $0x10,%esp
+  801563:	85 c0                	test   %eax,%eax
+  801565:	78 49                	js     8015b0 <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801567:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80156a:	83 ec 08             	sub    $0x8,%esp
+  80156d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801570:	50                   	push   %eax
+  801571:	ff 36                	push   (%esi)
+  801573:	e8 7e fb ff ff       	call   8010f6 <dev_lookup>
+  801578:	83 c4 10             	add    $0x10,%esp
+  80157b:	85 c0                	test   %eax,%eax
+  80157d:	78 31                	js     8015b0 <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  80157f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801582:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801586:	74 2f                	je     8015b7 <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  801588:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  80158b:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801592:	00 00 00 
+  stat->st_isdir = 0;
+  801595:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80159c:	00 00 00 
+  stat->st_dev = dev;
+  80159f:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  8015a5:	83 ec 08             	sub    $0x8,%esp
+  8015a8:	53                   	push   %ebx
+  8015a9:	56                   	push   %esi
+  8015aa:	ff 50 14             	call   *0x14(%eax)
+  8015ad:	83 c4 10             	add    $0x10,%esp
+}
+  8015b0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015b3:	5b                   	pop    %ebx
+  8015b4:	5e                   	pop    %esi
+  8015b5:	5d                   	pop    %ebp
+  8015b6:	c3                   	ret
+    return -E_NOT_SUPP;
+  8015b7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015bc:	eb f2                	jmp    8015b0 <fstat+0x67>
+
+008015be <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  8015be:	55                   	push   %ebp
+  8015bf:	89 e5                	mov    %esp,%ebp
+  8015c1:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  8015c4:	ff 75 0c             	push   0xc(%ebp)
+  8015c7:	ff 75 08             	push   0x8(%ebp)
+  8015ca:	e8 58 07 00 00       	call   801d27 <file_stat>
+}
+  8015cf:	c9                   	leave
+  8015d0:	c3                   	ret
+
+008015d1 <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  8015d1:	55                   	push   %ebp
+  8015d2:	89 e5                	mov    %esp,%ebp
+  8015d4:	57                   	push   %edi
+  8015d5:	56                   	push   %esi
+  8015d6:	53                   	push   %ebx
+  8015d7:	83 ec 1c             	sub    $0x1c,%esp
+  8015da:	89 c7                	mov    %eax,%edi
+  8015dc:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8015df:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8015e2:	e9 a2 00 00 00       	jmp    801689 <fsipc_send+0xb8>
+  nfsenvs = 0;
+  8015e7:	c7 05 00 50 80 00 00 	movl   $0x0,0x805000
+  8015ee:	00 00 00 
+  8015f1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015f6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  8015fb:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801600:	be 01 00 00 00       	mov    $0x1,%esi
+  801605:	eb 0f                	jmp    801616 <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801607:	83 c0 01             	add    $0x1,%eax
+  80160a:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80160f:	74 49                	je     80165a <fsipc_send+0x89>
+  801611:	83 f9 07             	cmp    $0x7,%ecx
+  801614:	7f 50                	jg     801666 <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  801616:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801619:	c1 e2 04             	shl    $0x4,%edx
+  80161c:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801622:	8b 52 50             	mov    0x50(%edx),%edx
+  801625:	83 fa 01             	cmp    $0x1,%edx
+  801628:	75 dd                	jne    801607 <fsipc_send+0x36>
+  80162a:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  80162d:	c1 e2 04             	shl    $0x4,%edx
+  801630:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801636:	8b 52 54             	mov    0x54(%edx),%edx
+  801639:	85 d2                	test   %edx,%edx
+  80163b:	74 ca                	je     801607 <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  80163d:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801640:	c1 e2 04             	shl    $0x4,%edx
+  801643:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801649:	8b 52 48             	mov    0x48(%edx),%edx
+  80164c:	89 14 8d 20 50 80 00 	mov    %edx,0x805020(,%ecx,4)
+  801653:	8d 49 01             	lea    0x1(%ecx),%ecx
+  801656:	89 f3                	mov    %esi,%ebx
+  801658:	eb ad                	jmp    801607 <fsipc_send+0x36>
+  80165a:	84 db                	test   %bl,%bl
+  80165c:	74 38                	je     801696 <fsipc_send+0xc5>
+  80165e:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  801664:	eb 30                	jmp    801696 <fsipc_send+0xc5>
+  801666:	84 db                	test   %bl,%bl
+  801668:	74 2c                	je     801696 <fsipc_send+0xc5>
+  80166a:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  801670:	eb 24                	jmp    801696 <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  801672:	50                   	push   %eax
+  801673:	68 7c 32 80 00       	push   $0x80327c
+  801678:	6a 34                	push   $0x34
+  80167a:	68 86 32 80 00       	push   $0x803286
+  80167f:	e8 b9 13 00 00       	call   802a3d <_panic>
+    }
+    sys_yield();
+  801684:	e8 92 f4 ff ff       	call   800b1b <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  801689:	83 3d 00 50 80 00 03 	cmpl   $0x3,0x805000
+  801690:	0f 8e 51 ff ff ff    	jle    8015e7 <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  801696:	a1 44 57 80 00       	mov    0x805744,%eax
+  80169b:	8b 70 48             	mov    0x48(%eax),%esi
+  80169e:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  8016a4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016a9:	8b 0d 00 50 80 00    	mov    0x805000,%ecx
+  8016af:	39 d9                	cmp    %ebx,%ecx
+  8016b1:	7e d1                	jle    801684 <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  8016b3:	83 ec 0c             	sub    $0xc,%esp
+  8016b6:	ff 75 e0             	push   -0x20(%ebp)
+  8016b9:	6a 07                	push   $0x7
+  8016bb:	ff 75 e4             	push   -0x1c(%ebp)
+  8016be:	57                   	push   %edi
+  8016bf:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  8016c2:	99                   	cltd
+  8016c3:	f7 f9                	idiv   %ecx
+  8016c5:	ff 34 95 20 50 80 00 	push   0x805020(,%edx,4)
+  8016cc:	e8 63 f7 ff ff       	call   800e34 <sys_ipc_try_send>
+      if (r == 0)
+  8016d1:	83 c4 20             	add    $0x20,%esp
+  8016d4:	85 c0                	test   %eax,%eax
+  8016d6:	74 0a                	je     8016e2 <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  8016d8:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8016db:	75 95                	jne    801672 <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  8016dd:	83 c3 01             	add    $0x1,%ebx
+  8016e0:	eb c7                	jmp    8016a9 <fsipc_send+0xd8>
+  }
+}
+  8016e2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016e5:	5b                   	pop    %ebx
+  8016e6:	5e                   	pop    %esi
+  8016e7:	5f                   	pop    %edi
+  8016e8:	5d                   	pop    %ebp
+  8016e9:	c3                   	ret
+
+008016ea <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8016ea:	55                   	push   %ebp
+  8016eb:	89 e5                	mov    %esp,%ebp
+  8016ed:	53                   	push   %ebx
+  8016ee:	83 ec 14             	sub    $0x14,%esp
+  8016f1:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  8016f3:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  8016fa:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8016ff:	ba 00 60 80 00       	mov    $0x806000,%edx
+  801704:	e8 c8 fe ff ff       	call   8015d1 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801709:	6a 00                	push   $0x0
+  80170b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80170e:	50                   	push   %eax
+  80170f:	53                   	push   %ebx
+  801710:	6a 00                	push   $0x0
+  801712:	e8 6c 13 00 00       	call   802a83 <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  801717:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80171a:	c9                   	leave
+  80171b:	c3                   	ret
+
+0080171c <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  80171c:	55                   	push   %ebp
+  80171d:	89 e5                	mov    %esp,%ebp
+  80171f:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801722:	8b 45 08             	mov    0x8(%ebp),%eax
+  801725:	8b 40 0c             	mov    0xc(%eax),%eax
+  801728:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.set_size.req_size = newsize;
+  80172d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801730:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801735:	ba 00 00 00 00       	mov    $0x0,%edx
+  80173a:	b8 02 00 00 00       	mov    $0x2,%eax
+  80173f:	e8 a6 ff ff ff       	call   8016ea <fsipc>
+}
+  801744:	c9                   	leave
+  801745:	c3                   	ret
+
+00801746 <devfile_flush>:
+{
+  801746:	55                   	push   %ebp
+  801747:	89 e5                	mov    %esp,%ebp
+  801749:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80174c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80174f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801752:	a3 00 60 80 00       	mov    %eax,0x806000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801757:	ba 00 00 00 00       	mov    $0x0,%edx
+  80175c:	b8 06 00 00 00       	mov    $0x6,%eax
+  801761:	e8 84 ff ff ff       	call   8016ea <fsipc>
+}
+  801766:	c9                   	leave
+  801767:	c3                   	ret
+
+00801768 <devfile_stat>:
+{
+  801768:	55                   	push   %ebp
+  801769:	89 e5                	mov    %esp,%ebp
+  80176b:	53                   	push   %ebx
+  80176c:	83 ec 04             	sub    $0x4,%esp
+  80176f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801772:	8b 45 08             	mov    0x8(%ebp),%eax
+  801775:	8b 40 0c             	mov    0xc(%eax),%eax
+  801778:	a3 00 60 80 00       	mov    %eax,0x806000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80177d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801782:	b8 05 00 00 00       	mov    $0x5,%eax
+  801787:	e8 5e ff ff ff       	call   8016ea <fsipc>
+  80178c:	85 c0                	test   %eax,%eax
+  80178e:	78 2c                	js     8017bc <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801790:	83 ec 08             	sub    $0x8,%esp
+  801793:	68 00 60 80 00       	push   $0x806000
+  801798:	53                   	push   %ebx
+  801799:	e8 b0 ef ff ff       	call   80074e <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  80179e:	a1 80 60 80 00       	mov    0x806080,%eax
+  8017a3:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8017a9:	a1 84 60 80 00       	mov    0x806084,%eax
+  8017ae:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  8017b4:	83 c4 10             	add    $0x10,%esp
+  8017b7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017bc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017bf:	c9                   	leave
+  8017c0:	c3                   	ret
+
+008017c1 <fsv_alloc>:
+{
+  8017c1:	55                   	push   %ebp
+  8017c2:	89 e5                	mov    %esp,%ebp
+  8017c4:	56                   	push   %esi
+  8017c5:	53                   	push   %ebx
+  8017c6:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  8017c8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017cd:	eb 22                	jmp    8017f1 <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  8017cf:	83 ec 04             	sub    $0x4,%esp
+  8017d2:	6a 00                	push   $0x0
+  8017d4:	6a 00                	push   $0x0
+  8017d6:	6a 07                	push   $0x7
+  8017d8:	50                   	push   %eax
+  8017d9:	6a 00                	push   $0x0
+  8017db:	6a 04                	push   $0x4
+  8017dd:	68 40 50 80 00       	push   $0x805040
+  8017e2:	e8 e9 f7 ff ff       	call   800fd0 <sysbatch_add>
+  8017e7:	83 c4 20             	add    $0x20,%esp
+  8017ea:	85 c0                	test   %eax,%eax
+  8017ec:	78 48                	js     801836 <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  8017ee:	83 c3 01             	add    $0x1,%ebx
+  8017f1:	39 f3                	cmp    %esi,%ebx
+  8017f3:	74 31                	je     801826 <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  8017f5:	89 d8                	mov    %ebx,%eax
+  8017f7:	c1 e0 0c             	shl    $0xc,%eax
+  8017fa:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  8017ff:	89 c2                	mov    %eax,%edx
+  801801:	c1 ea 16             	shr    $0x16,%edx
+  801804:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80180b:	f6 c2 01             	test   $0x1,%dl
+  80180e:	74 bf                	je     8017cf <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  801810:	89 c2                	mov    %eax,%edx
+  801812:	c1 ea 0c             	shr    $0xc,%edx
+  801815:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80181c:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  80181f:	83 fa 03             	cmp    $0x3,%edx
+  801822:	75 ab                	jne    8017cf <fsv_alloc+0xe>
+  801824:	eb c8                	jmp    8017ee <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  801826:	83 ec 0c             	sub    $0xc,%esp
+  801829:	68 40 50 80 00       	push   $0x805040
+  80182e:	e8 4d f7 ff ff       	call   800f80 <sysbatch_flush>
+  801833:	83 c4 10             	add    $0x10,%esp
+}
+  801836:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801839:	5b                   	pop    %ebx
+  80183a:	5e                   	pop    %esi
+  80183b:	5d                   	pop    %ebp
+  80183c:	c3                   	ret
+
+0080183d <devfile_read>:
+{
+  80183d:	55                   	push   %ebp
+  80183e:	89 e5                	mov    %esp,%ebp
+  801840:	57                   	push   %edi
+  801841:	56                   	push   %esi
+  801842:	53                   	push   %ebx
+  801843:	83 ec 3c             	sub    $0x3c,%esp
+  801846:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  801849:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  80184f:	77 57                	ja     8018a8 <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801851:	8b 45 08             	mov    0x8(%ebp),%eax
+  801854:	8b 40 0c             	mov    0xc(%eax),%eax
+  801857:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read.req_n = n;
+  80185c:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801862:	ba 00 00 00 00       	mov    $0x0,%edx
+  801867:	b8 03 00 00 00       	mov    $0x3,%eax
+  80186c:	e8 79 fe ff ff       	call   8016ea <fsipc>
+  801871:	89 c6                	mov    %eax,%esi
+  801873:	85 c0                	test   %eax,%eax
+  801875:	78 27                	js     80189e <devfile_read+0x61>
+  assert(r <= n);
+  801877:	39 c3                	cmp    %eax,%ebx
+  801879:	0f 82 0e 02 00 00    	jb     801a8d <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  80187f:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801884:	0f 8f 1c 02 00 00    	jg     801aa6 <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  80188a:	83 ec 04             	sub    $0x4,%esp
+  80188d:	50                   	push   %eax
+  80188e:	68 00 60 80 00       	push   $0x806000
+  801893:	ff 75 0c             	push   0xc(%ebp)
+  801896:	e8 39 f0 ff ff       	call   8008d4 <memmove>
+  return r;
+  80189b:	83 c4 10             	add    $0x10,%esp
+}
+  80189e:	89 f0                	mov    %esi,%eax
+  8018a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018a3:	5b                   	pop    %ebx
+  8018a4:	5e                   	pop    %esi
+  8018a5:	5f                   	pop    %edi
+  8018a6:	5d                   	pop    %ebp
+  8018a7:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  8018a8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8018ad:	e8 0f ff ff ff       	call   8017c1 <fsv_alloc>
+  8018b2:	89 c6                	mov    %eax,%esi
+  8018b4:	85 c0                	test   %eax,%eax
+  8018b6:	78 e6                	js     80189e <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  8018b8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018bb:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018be:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  8018c3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018c6:	8b 40 04             	mov    0x4(%eax),%eax
+  8018c9:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  8018ce:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  8018d4:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  8018db:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8018e0:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  8018e5:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8018ea:	e8 e2 fc ff ff       	call   8015d1 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  8018ef:	6a 00                	push   $0x0
+  8018f1:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8018f4:	50                   	push   %eax
+  8018f5:	68 00 10 c0 9f       	push   $0x9fc01000
+  8018fa:	6a 00                	push   $0x0
+  8018fc:	e8 82 11 00 00       	call   802a83 <ipc_recv_pages>
+  801901:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  801903:	83 c4 10             	add    $0x10,%esp
+  801906:	85 c0                	test   %eax,%eax
+  801908:	7e 94                	jle    80189e <devfile_read+0x61>
+  assert(r <= n);
+  80190a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80190d:	39 c3                	cmp    %eax,%ebx
+  80190f:	72 2e                	jb     80193f <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801911:	8b 45 08             	mov    0x8(%ebp),%eax
+  801914:	8b 40 04             	mov    0x4(%eax),%eax
+  801917:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80191c:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  80191f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801922:	c1 e2 0c             	shl    $0xc,%edx
+  801925:	39 ca                	cmp    %ecx,%edx
+  801927:	72 2f                	jb     801958 <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  801929:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  80192e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  801931:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  801935:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  80193a:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  80193d:	eb 52                	jmp    801991 <devfile_read+0x154>
+  assert(r <= n);
+  80193f:	68 91 32 80 00       	push   $0x803291
+  801944:	68 98 32 80 00       	push   $0x803298
+  801949:	68 49 01 00 00       	push   $0x149
+  80194e:	68 86 32 80 00       	push   $0x803286
+  801953:	e8 e5 10 00 00       	call   802a3d <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801958:	68 bc 32 80 00       	push   $0x8032bc
+  80195d:	68 98 32 80 00       	push   $0x803298
+  801962:	68 4a 01 00 00       	push   $0x14a
+  801967:	68 86 32 80 00       	push   $0x803286
+  80196c:	e8 cc 10 00 00       	call   802a3d <_panic>
+      memmove(dst + done, src + done, m);
+  801971:	83 ec 04             	sub    $0x4,%esp
+  801974:	53                   	push   %ebx
+  801975:	56                   	push   %esi
+  801976:	89 f8                	mov    %edi,%eax
+  801978:	03 45 0c             	add    0xc(%ebp),%eax
+  80197b:	50                   	push   %eax
+  80197c:	e8 53 ef ff ff       	call   8008d4 <memmove>
+  801981:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  801984:	01 df                	add    %ebx,%edi
+  801986:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801989:	39 c7                	cmp    %eax,%edi
+  80198b:	0f 83 c0 00 00 00    	jae    801a51 <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801991:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801994:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  801997:	89 f0                	mov    %esi,%eax
+  801999:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80199e:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  8019a3:	29 c3                	sub    %eax,%ebx
+  8019a5:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8019a8:	29 f8                	sub    %edi,%eax
+  8019aa:	39 c3                	cmp    %eax,%ebx
+  8019ac:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  8019af:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  8019b5:	75 ba                	jne    801971 <devfile_read+0x134>
+  8019b7:	89 f9                	mov    %edi,%ecx
+  8019b9:	03 4d 0c             	add    0xc(%ebp),%ecx
+  8019bc:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  8019bf:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  8019c5:	75 aa                	jne    801971 <devfile_read+0x134>
+  8019c7:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  8019cd:	77 a2                	ja     801971 <devfile_read+0x134>
+  8019cf:	89 c8                	mov    %ecx,%eax
+  8019d1:	c1 e8 16             	shr    $0x16,%eax
+  8019d4:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8019db:	a8 01                	test   $0x1,%al
+  8019dd:	74 92                	je     801971 <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  8019df:	89 c8                	mov    %ecx,%eax
+  8019e1:	c1 e8 0c             	shr    $0xc,%eax
+  8019e4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  8019eb:	a8 01                	test   $0x1,%al
+  8019ed:	74 82                	je     801971 <devfile_read+0x134>
+  8019ef:	a9 02 08 00 00       	test   $0x802,%eax
+  8019f4:	0f 84 77 ff ff ff    	je     801971 <devfile_read+0x134>
+  8019fa:	f6 c4 04             	test   $0x4,%ah
+  8019fd:	0f 85 6e ff ff ff    	jne    801971 <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  801a03:	a1 44 57 80 00       	mov    0x805744,%eax
+  801a08:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  801a0c:	84 c0                	test   %al,%al
+  801a0e:	75 17                	jne    801a27 <devfile_read+0x1ea>
+  801a10:	83 ec 08             	sub    $0x8,%esp
+  801a13:	6a 01                	push   $0x1
+  801a15:	6a 00                	push   $0x0
+  801a17:	e8 1e f1 ff ff       	call   800b3a <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  801a1c:	83 c4 10             	add    $0x10,%esp
+  801a1f:	85 c0                	test   %eax,%eax
+  801a21:	0f 85 4a ff ff ff    	jne    801971 <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  801a27:	83 ec 04             	sub    $0x4,%esp
+  801a2a:	68 05 08 00 00       	push   $0x805
+  801a2f:	ff 75 cc             	push   -0x34(%ebp)
+  801a32:	6a 00                	push   $0x0
+  801a34:	56                   	push   %esi
+  801a35:	6a 00                	push   $0x0
+  801a37:	6a 05                	push   $0x5
+  801a39:	68 40 50 80 00       	push   $0x805040
+  801a3e:	e8 8d f5 ff ff       	call   800fd0 <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  801a43:	c1 e8 1f             	shr    $0x1f,%eax
+  801a46:	08 45 cb             	or     %al,-0x35(%ebp)
+  801a49:	83 c4 20             	add    $0x20,%esp
+  801a4c:	e9 33 ff ff ff       	jmp    801984 <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  801a51:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  801a54:	83 ec 0c             	sub    $0xc,%esp
+  801a57:	68 40 50 80 00       	push   $0x805040
+  801a5c:	e8 1f f5 ff ff       	call   800f80 <sysbatch_flush>
+  801a61:	83 c4 10             	add    $0x10,%esp
+  801a64:	85 c0                	test   %eax,%eax
+  801a66:	78 06                	js     801a6e <devfile_read+0x231>
+  801a68:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  801a6c:	74 14                	je     801a82 <devfile_read+0x245>
+    memmove(dst, src, r);
+  801a6e:	83 ec 04             	sub    $0x4,%esp
+  801a71:	ff 75 d4             	push   -0x2c(%ebp)
+  801a74:	ff 75 d0             	push   -0x30(%ebp)
+  801a77:	ff 75 0c             	push   0xc(%ebp)
+  801a7a:	e8 55 ee ff ff       	call   8008d4 <memmove>
+  801a7f:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  801a82:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a85:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  801a88:	e9 11 fe ff ff       	jmp    80189e <devfile_read+0x61>
+  assert(r <= n);
+  801a8d:	68 91 32 80 00       	push   $0x803291
+  801a92:	68 98 32 80 00       	push   $0x803298
+  801a97:	68 1c 01 00 00       	push   $0x11c
+  801a9c:	68 86 32 80 00       	push   $0x803286
+  801aa1:	e8 97 0f 00 00       	call   802a3d <_panic>
+  assert(r <= PGSIZE);
+  801aa6:	68 ad 32 80 00       	push   $0x8032ad
+  801aab:	68 98 32 80 00       	push   $0x803298
+  801ab0:	68 1d 01 00 00       	push   $0x11d
+  801ab5:	68 86 32 80 00       	push   $0x803286
+  801aba:	e8 7e 0f 00 00       	call   802a3d <_panic>
+
+00801abf <devfile_write>:
+{
+  801abf:	55                   	push   %ebp
+  801ac0:	89 e5                	mov    %esp,%ebp
+  801ac2:	57                   	push   %edi
+  801ac3:	56                   	push   %esi
+  801ac4:	53                   	push   %ebx
+  801ac5:	83 ec 1c             	sub    $0x1c,%esp
+  801ac8:	8b 75 08             	mov    0x8(%ebp),%esi
+  801acb:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  801ace:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  801ad3:	77 39                	ja     801b0e <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801ad5:	8b 56 0c             	mov    0xc(%esi),%edx
+  801ad8:	89 15 00 60 80 00    	mov    %edx,0x806000
+  fsipcbuf.write.req_n = n;
+  801ade:	a3 04 60 80 00       	mov    %eax,0x806004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  801ae3:	83 ec 04             	sub    $0x4,%esp
+  801ae6:	50                   	push   %eax
+  801ae7:	ff 75 0c             	push   0xc(%ebp)
+  801aea:	68 08 60 80 00       	push   $0x806008
+  801aef:	e8 e0 ed ff ff       	call   8008d4 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801af4:	ba 00 00 00 00       	mov    $0x0,%edx
+  801af9:	b8 04 00 00 00       	mov    $0x4,%eax
+  801afe:	e8 e7 fb ff ff       	call   8016ea <fsipc>
+  801b03:	83 c4 10             	add    $0x10,%esp
+}
+  801b06:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b09:	5b                   	pop    %ebx
+  801b0a:	5e                   	pop    %esi
+  801b0b:	5f                   	pop    %edi
+  801b0c:	5d                   	pop    %ebp
+  801b0d:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  801b0e:	ba 00 00 10 00       	mov    $0x100000,%edx
+  801b13:	39 d0                	cmp    %edx,%eax
+  801b15:	89 d3                	mov    %edx,%ebx
+  801b17:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  801b1a:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  801b20:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  801b23:	83 c7 01             	add    $0x1,%edi
+  801b26:	89 f8                	mov    %edi,%eax
+  801b28:	e8 94 fc ff ff       	call   8017c1 <fsv_alloc>
+  801b2d:	85 c0                	test   %eax,%eax
+  801b2f:	78 d5                	js     801b06 <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  801b31:	83 ec 04             	sub    $0x4,%esp
+  801b34:	53                   	push   %ebx
+  801b35:	ff 75 0c             	push   0xc(%ebp)
+  801b38:	68 00 10 c0 9f       	push   $0x9fc01000
+  801b3d:	e8 92 ed ff ff       	call   8008d4 <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  801b42:	8b 46 0c             	mov    0xc(%esi),%eax
+  801b45:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  801b4a:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  801b50:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801b57:	89 f9                	mov    %edi,%ecx
+  801b59:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801b5e:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801b63:	e8 69 fa ff ff       	call   8015d1 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801b68:	6a 00                	push   $0x0
+  801b6a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801b6d:	50                   	push   %eax
+  801b6e:	6a 00                	push   $0x0
+  801b70:	6a 00                	push   $0x0
+  801b72:	e8 0c 0f 00 00       	call   802a83 <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  801b77:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  801b7a:	eb 8a                	jmp    801b06 <devfile_write+0x47>
+
+00801b7c <open>:
+{
+  801b7c:	55                   	push   %ebp
+  801b7d:	89 e5                	mov    %esp,%ebp
+  801b7f:	56                   	push   %esi
+  801b80:	53                   	push   %ebx
+  801b81:	83 ec 1c             	sub    $0x1c,%esp
+  801b84:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801b87:	56                   	push   %esi
+  801b88:	e8 86 eb ff ff       	call   800713 <strlen>
+  801b8d:	83 c4 10             	add    $0x10,%esp
+  801b90:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801b95:	7f 6c                	jg     801c03 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  801b97:	83 ec 0c             	sub    $0xc,%esp
+  801b9a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b9d:	50                   	push   %eax
+  801b9e:	e8 ad f4 ff ff       	call   801050 <fd_alloc>
+  801ba3:	89 c3                	mov    %eax,%ebx
+  801ba5:	83 c4 10             	add    $0x10,%esp
+  801ba8:	85 c0                	test   %eax,%eax
+  801baa:	78 3c                	js     801be8 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801bac:	83 ec 08             	sub    $0x8,%esp
+  801baf:	56                   	push   %esi
+  801bb0:	68 00 60 80 00       	push   $0x806000
+  801bb5:	e8 94 eb ff ff       	call   80074e <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801bba:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801bbd:	a3 00 64 80 00       	mov    %eax,0x806400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801bc2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801bc5:	b8 01 00 00 00       	mov    $0x1,%eax
+  801bca:	e8 1b fb ff ff       	call   8016ea <fsipc>
+  801bcf:	89 c3                	mov    %eax,%ebx
+  801bd1:	83 c4 10             	add    $0x10,%esp
+  801bd4:	85 c0                	test   %eax,%eax
+  801bd6:	78 19                	js     801bf1 <open+0x75>
+  return fd2num(fd);
+  801bd8:	83 ec 0c             	sub    $0xc,%esp
+  801bdb:	ff 75 f4             	push   -0xc(%ebp)
+  801bde:	e8 49 f4 ff ff       	call   80102c <fd2num>
+  801be3:	89 c3                	mov    %eax,%ebx
+  801be5:	83 c4 10             	add    $0x10,%esp
+}
+  801be8:	89 d8                	mov    %ebx,%eax
+  801bea:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bed:	5b                   	pop    %ebx
+  801bee:	5e                   	pop    %esi
+  801bef:	5d                   	pop    %ebp
+  801bf0:	c3                   	ret
+    fd_close(fd, 0);
+  801bf1:	83 ec 08             	sub    $0x8,%esp
+  801bf4:	6a 00                	push   $0x0
+  801bf6:	ff 75 f4             	push   -0xc(%ebp)
+  801bf9:	e8 44 f5 ff ff       	call   801142 <fd_close>
+    return r;
+  801bfe:	83 c4 10             	add    $0x10,%esp
+  801c01:	eb e5                	jmp    801be8 <open+0x6c>
+    return -E_BAD_PATH;
+  801c03:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801c08:	eb de                	jmp    801be8 <open+0x6c>
+
+00801c0a <open_read>:
+{
+  801c0a:	55                   	push   %ebp
+  801c0b:	89 e5                	mov    %esp,%ebp
+  801c0d:	57                   	push   %edi
+  801c0e:	56                   	push   %esi
+  801c0f:	53                   	push   %ebx
+  801c10:	83 ec 28             	sub    $0x28,%esp
+  801c13:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  801c16:	57                   	push   %edi
+  801c17:	e8 f7 ea ff ff       	call   800713 <strlen>
+  801c1c:	83 c4 10             	add    $0x10,%esp
+  801c1f:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801c24:	0f 87 f6 00 00 00    	ja     801d20 <open_read+0x116>
+  801c2a:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  801c2c:	83 ec 0c             	sub    $0xc,%esp
+  801c2f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801c32:	50                   	push   %eax
+  801c33:	e8 18 f4 ff ff       	call   801050 <fd_alloc>
+  801c38:	89 c3                	mov    %eax,%ebx
+  801c3a:	83 c4 10             	add    $0x10,%esp
+  801c3d:	85 c0                	test   %eax,%eax
+  801c3f:	0f 88 b2 00 00 00    	js     801cf7 <open_read+0xed>
+  strcpy(req->req_buf, path);
+  801c45:	83 ec 08             	sub    $0x8,%esp
+  801c48:	57                   	push   %edi
+  801c49:	68 e4 60 80 00       	push   $0x8060e4
+  801c4e:	e8 fb ea ff ff       	call   80074e <strcpy>
+  req->req_nops = 2;
+  801c53:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  801c5a:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  801c5d:	c7 05 04 60 80 00 01 	movl   $0x1,0x806004
+  801c64:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  801c67:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c6a:	a3 10 60 80 00       	mov    %eax,0x806010
+  req->req_ops[0].op_buf = 0;
+  801c6f:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  801c76:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  801c79:	c7 05 20 60 80 00 04 	movl   $0x4,0x806020
+  801c80:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  801c83:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  801c8a:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  801c8d:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  801c92:	29 f0                	sub    %esi,%eax
+  801c94:	3b 45 14             	cmp    0x14(%ebp),%eax
+  801c97:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  801c9b:	a3 2c 60 80 00       	mov    %eax,0x80602c
+  req->req_ops[1].op_offset = 0;
+  801ca0:	c7 05 30 60 80 00 00 	movl   $0x0,0x806030
+  801ca7:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  801caa:	83 c6 01             	add    $0x1,%esi
+  801cad:	89 35 34 60 80 00    	mov    %esi,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  801cb3:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801cb6:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801cbb:	e8 2a fa ff ff       	call   8016ea <fsipc>
+  801cc0:	89 c3                	mov    %eax,%ebx
+  801cc2:	83 c4 10             	add    $0x10,%esp
+  801cc5:	83 f8 01             	cmp    $0x1,%eax
+  801cc8:	7e 37                	jle    801d01 <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  801cca:	a1 38 60 80 00       	mov    0x806038,%eax
+  801ccf:	8b 55 18             	mov    0x18(%ebp),%edx
+  801cd2:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  801cd4:	83 ec 04             	sub    $0x4,%esp
+  801cd7:	50                   	push   %eax
+  801cd8:	81 c6 e4 60 80 00    	add    $0x8060e4,%esi
+  801cde:	56                   	push   %esi
+  801cdf:	ff 75 10             	push   0x10(%ebp)
+  801ce2:	e8 ed eb ff ff       	call   8008d4 <memmove>
+  return fd2num(fd);
+  801ce7:	83 c4 04             	add    $0x4,%esp
+  801cea:	ff 75 e4             	push   -0x1c(%ebp)
+  801ced:	e8 3a f3 ff ff       	call   80102c <fd2num>
+  801cf2:	89 c3                	mov    %eax,%ebx
+  801cf4:	83 c4 10             	add    $0x10,%esp
+}
+  801cf7:	89 d8                	mov    %ebx,%eax
+  801cf9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cfc:	5b                   	pop    %ebx
+  801cfd:	5e                   	pop    %esi
+  801cfe:	5f                   	pop    %edi
+  801cff:	5d                   	pop    %ebp
+  801d00:	c3                   	ret
+    fd_close(fd, 0);
+  801d01:	83 ec 08             	sub    $0x8,%esp
+  801d04:	6a 00                	push   $0x0
+  801d06:	ff 75 e4             	push   -0x1c(%ebp)
+  801d09:	e8 34 f4 ff ff       	call   801142 <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  801d0e:	83 c4 10             	add    $0x10,%esp
+  801d11:	85 db                	test   %ebx,%ebx
+  801d13:	78 e2                	js     801cf7 <open_read+0xed>
+  801d15:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  801d18:	8b 9b 1c 60 80 00    	mov    0x80601c(%ebx),%ebx
+  801d1e:	eb d7                	jmp    801cf7 <open_read+0xed>
+    return -E_BAD_PATH;
+  801d20:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801d25:	eb d0                	jmp    801cf7 <open_read+0xed>
+
+00801d27 <file_stat>:
+{
+  801d27:	55                   	push   %ebp
+  801d28:	89 e5                	mov    %esp,%ebp
+  801d2a:	57                   	push   %edi
+  801d2b:	56                   	push   %esi
+  801d2c:	53                   	push   %ebx
+  801d2d:	83 ec 18             	sub    $0x18,%esp
+  801d30:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801d33:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801d36:	57                   	push   %edi
+  801d37:	e8 d7 e9 ff ff       	call   800713 <strlen>
+  801d3c:	83 c4 10             	add    $0x10,%esp
+  801d3f:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801d44:	0f 8f c7 00 00 00    	jg     801e11 <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  801d4a:	83 ec 0c             	sub    $0xc,%esp
+  801d4d:	57                   	push   %edi
+  801d4e:	e8 c0 e9 ff ff       	call   800713 <strlen>
+  801d53:	8d 58 04             	lea    0x4(%eax),%ebx
+  801d56:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  801d59:	83 c4 08             	add    $0x8,%esp
+  801d5c:	57                   	push   %edi
+  801d5d:	68 e4 60 80 00       	push   $0x8060e4
+  801d62:	e8 e7 e9 ff ff       	call   80074e <strcpy>
+  req->req_nops = 2;
+  801d67:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  801d6e:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  801d71:	c7 05 04 60 80 00 02 	movl   $0x2,0x806004
+  801d78:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  801d7b:	c7 05 10 60 80 00 00 	movl   $0x0,0x806010
+  801d82:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  801d85:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  801d8c:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  801d8f:	c7 05 20 60 80 00 03 	movl   $0x3,0x806020
+  801d96:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  801d99:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  801da0:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  801da3:	89 1d 34 60 80 00    	mov    %ebx,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  801da9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dae:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801db3:	e8 32 f9 ff ff       	call   8016ea <fsipc>
+  801db8:	83 c4 10             	add    $0x10,%esp
+  801dbb:	83 f8 01             	cmp    $0x1,%eax
+  801dbe:	7e 42                	jle    801e02 <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  801dc0:	81 c3 e4 60 80 00    	add    $0x8060e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  801dc6:	83 ec 08             	sub    $0x8,%esp
+  801dc9:	53                   	push   %ebx
+  801dca:	56                   	push   %esi
+  801dcb:	e8 7e e9 ff ff       	call   80074e <strcpy>
+  st->st_size = ret->ret_size;
+  801dd0:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  801dd6:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  801ddc:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  801de2:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  801de8:	c7 86 88 00 00 00 04 	movl   $0x804004,0x88(%esi)
+  801def:	40 80 00 
+  return 0;
+  801df2:	83 c4 10             	add    $0x10,%esp
+  801df5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801dfa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801dfd:	5b                   	pop    %ebx
+  801dfe:	5e                   	pop    %esi
+  801dff:	5f                   	pop    %edi
+  801e00:	5d                   	pop    %ebp
+  801e01:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  801e02:	85 c0                	test   %eax,%eax
+  801e04:	78 f4                	js     801dfa <file_stat+0xd3>
+  801e06:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801e09:	8b 80 1c 60 80 00    	mov    0x80601c(%eax),%eax
+  801e0f:	eb e9                	jmp    801dfa <file_stat+0xd3>
+    return -E_BAD_PATH;
+  801e11:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801e16:	eb e2                	jmp    801dfa <file_stat+0xd3>
+
+00801e18 <read_map>:
+{
+  801e18:	55                   	push   %ebp
+  801e19:	89 e5                	mov    %esp,%ebp
+  801e1b:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801e1e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e21:	50                   	push   %eax
+  801e22:	ff 75 08             	push   0x8(%ebp)
+  801e25:	e8 7c f2 ff ff       	call   8010a6 <fd_lookup>
+  801e2a:	83 c4 10             	add    $0x10,%esp
+  801e2d:	85 c0                	test   %eax,%eax
+  801e2f:	78 2a                	js     801e5b <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  801e31:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e34:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  801e3a:	39 08                	cmp    %ecx,(%eax)
+  801e3c:	75 1f                	jne    801e5d <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  801e3e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e41:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read_map.req_offset = offset;
+  801e46:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e49:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  801e4e:	8b 55 10             	mov    0x10(%ebp),%edx
+  801e51:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801e56:	e8 8f f8 ff ff       	call   8016ea <fsipc>
+}
+  801e5b:	c9                   	leave
+  801e5c:	c3                   	ret
+    return -E_INVAL;
+  801e5d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e62:	eb f7                	jmp    801e5b <read_map+0x43>
+
+00801e64 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801e64:	55                   	push   %ebp
+  801e65:	89 e5                	mov    %esp,%ebp
+  801e67:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  801e6a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e6f:	b8 08 00 00 00       	mov    $0x8,%eax
+  801e74:	e8 71 f8 ff ff       	call   8016ea <fsipc>
+}
+  801e79:	c9                   	leave
+  801e7a:	c3                   	ret
+
+00801e7b <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  801e7b:	55                   	push   %ebp
+  801e7c:	89 e5                	mov    %esp,%ebp
+  801e7e:	57                   	push   %edi
+  801e7f:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  801e80:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e83:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.stats.req_bio_sched = 0;
+  801e88:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  801e8f:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  801e92:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  801e99:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  801e9c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ea1:	b8 09 00 00 00       	mov    $0x9,%eax
+  801ea6:	e8 3f f8 ff ff       	call   8016ea <fsipc>
+  801eab:	85 c0                	test   %eax,%eax
+  801ead:	78 14                	js     801ec3 <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  801eaf:	be 00 60 80 00       	mov    $0x806000,%esi
+  801eb4:	b9 16 00 00 00       	mov    $0x16,%ecx
+  801eb9:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801ebc:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  801ebe:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ec3:	5e                   	pop    %esi
+  801ec4:	5f                   	pop    %edi
+  801ec5:	5d                   	pop    %ebp
+  801ec6:	c3                   	ret
+
+00801ec7 <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  801ec7:	55                   	push   %ebp
+  801ec8:	89 e5                	mov    %esp,%ebp
+  801eca:	53                   	push   %ebx
+  801ecb:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  801ece:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801ed1:	50                   	push   %eax
+  801ed2:	6a 00                	push   $0x0
+  801ed4:	e8 a2 ff ff ff       	call   801e7b <fs_stats>
+  801ed9:	83 c4 10             	add    $0x10,%esp
+  801edc:	85 c0                	test   %eax,%eax
+  801ede:	78 28                	js     801f08 <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  801ee0:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  801ee3:	83 ec 08             	sub    $0x8,%esp
+  801ee6:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801ee9:	50                   	push   %eax
+  801eea:	6a 20                	push   $0x20
+  801eec:	e8 8a ff ff ff       	call   801e7b <fs_stats>
+  801ef1:	83 c4 10             	add    $0x10,%esp
+  801ef4:	85 c0                	test   %eax,%eax
+  801ef6:	78 10                	js     801f08 <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  801ef8:	83 ec 08             	sub    $0x8,%esp
+  801efb:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801efe:	50                   	push   %eax
+  801eff:	53                   	push   %ebx
+  801f00:	e8 76 ff ff ff       	call   801e7b <fs_stats>
+  801f05:	83 c4 10             	add    $0x10,%esp
+}
+  801f08:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f0b:	c9                   	leave
+  801f0c:	c3                   	ret
+
+00801f0d <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  801f0d:	55                   	push   %ebp
+  801f0e:	89 e5                	mov    %esp,%ebp
+  801f10:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  801f13:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  801f1a:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  801f1d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f20:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.stats.req_dcache = 0;
+  801f25:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  801f2c:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  801f2f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f34:	b8 09 00 00 00       	mov    $0x9,%eax
+  801f39:	e8 ac f7 ff ff       	call   8016ea <fsipc>
+}
+  801f3e:	c9                   	leave
+  801f3f:	c3                   	ret
+
+00801f40 <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  801f40:	55                   	push   %ebp
+  801f41:	89 e5                	mov    %esp,%ebp
+  801f43:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  801f46:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  801f4d:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  801f50:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  801f57:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  801f5a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f5d:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_STATS, NULL);
+  801f62:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f67:	b8 09 00 00 00       	mov    $0x9,%eax
+  801f6c:	e8 79 f7 ff ff       	call   8016ea <fsipc>
+}
+  801f71:	c9                   	leave
+  801f72:	c3                   	ret
+
+00801f73 <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  801f73:	55                   	push   %ebp
+  801f74:	89 e5                	mov    %esp,%ebp
+  801f76:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801f79:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f7c:	50                   	push   %eax
+  801f7d:	ff 75 08             	push   0x8(%ebp)
+  801f80:	e8 21 f1 ff ff       	call   8010a6 <fd_lookup>
+  801f85:	83 c4 10             	add    $0x10,%esp
+  801f88:	85 c0                	test   %eax,%eax
+  801f8a:	78 34                	js     801fc0 <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  801f8c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f8f:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  801f95:	39 08                	cmp    %ecx,(%eax)
+  801f97:	75 29                	jne    801fc2 <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  801f99:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f9c:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.fallocate.req_offset = offset;
+  801fa1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801fa4:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.fallocate.req_len = len;
+  801fa9:	8b 45 10             	mov    0x10(%ebp),%eax
+  801fac:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  801fb1:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fb6:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801fbb:	e8 2a f7 ff ff       	call   8016ea <fsipc>
+}
+  801fc0:	c9                   	leave
+  801fc1:	c3                   	ret
+    return -E_INVAL;
+  801fc2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801fc7:	eb f7                	jmp    801fc0 <fallocate+0x4d>
+
+00801fc9 <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  801fc9:	55                   	push   %ebp
+  801fca:	89 e5                	mov    %esp,%ebp
+  801fcc:	57                   	push   %edi
+  801fcd:	56                   	push   %esi
+  801fce:	53                   	push   %ebx
+  801fcf:	83 ec 24             	sub    $0x24,%esp
+  801fd2:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801fd5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801fd8:	50                   	push   %eax
+  801fd9:	ff 75 08             	push   0x8(%ebp)
+  801fdc:	e8 c5 f0 ff ff       	call   8010a6 <fd_lookup>
+  801fe1:	83 c4 10             	add    $0x10,%esp
+  801fe4:	85 c0                	test   %eax,%eax
+  801fe6:	78 66                	js     80204e <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  801fe8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801feb:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  801ff1:	39 08                	cmp    %ecx,(%eax)
+  801ff3:	75 61                	jne    802056 <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  801ff5:	85 f6                	test   %esi,%esi
+  801ff7:	7e 50                	jle    802049 <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  801ff9:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  801ffe:	39 de                	cmp    %ebx,%esi
+  802000:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  802003:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802006:	8b 40 0c             	mov    0xc(%eax),%eax
+  802009:	a3 00 60 80 00       	mov    %eax,0x806000
+    fsipcbuf.prefetch.req_n = m;
+  80200e:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  802014:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  80201b:	83 ec 04             	sub    $0x4,%esp
+  80201e:	57                   	push   %edi
+  80201f:	ff 75 0c             	push   0xc(%ebp)
+  802022:	68 08 60 80 00       	push   $0x806008
+  802027:	e8 a8 e8 ff ff       	call   8008d4 <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  80202c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802031:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802036:	e8 af f6 ff ff       	call   8016ea <fsipc>
+  80203b:	83 c4 10             	add    $0x10,%esp
+  80203e:	85 c0                	test   %eax,%eax
+  802040:	78 0c                	js     80204e <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  802042:	01 7d 0c             	add    %edi,0xc(%ebp)
+  802045:	29 de                	sub    %ebx,%esi
+  802047:	eb ac                	jmp    801ff5 <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  802049:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80204e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802051:	5b                   	pop    %ebx
+  802052:	5e                   	pop    %esi
+  802053:	5f                   	pop    %edi
+  802054:	5d                   	pop    %ebp
+  802055:	c3                   	ret
+    return -E_INVAL;
+  802056:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80205b:	eb f1                	jmp    80204e <prefetch+0x85>
+
+0080205d <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  80205d:	55                   	push   %ebp
+  80205e:	89 e5                	mov    %esp,%ebp
+  802060:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  802063:	50                   	push   %eax
+  802064:	e8 d3 ef ff ff       	call   80103c <fd2data>
+  802069:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  80206e:	c9                   	leave
+  80206f:	c3                   	ret
+
+00802070 <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802070:	55                   	push   %ebp
+  802071:	89 e5                	mov    %esp,%ebp
+  802073:	56                   	push   %esi
+  802074:	53                   	push   %ebx
+  802075:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  802078:	83 ec 0c             	sub    $0xc,%esp
+  80207b:	ff 75 08             	push   0x8(%ebp)
+  80207e:	e8 b9 ef ff ff       	call   80103c <fd2data>
+  802083:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  802085:	83 c4 08             	add    $0x8,%esp
+  802088:	68 e8 32 80 00       	push   $0x8032e8
+  80208d:	53                   	push   %ebx
+  80208e:	e8 bb e6 ff ff       	call   80074e <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  802093:	8b 46 04             	mov    0x4(%esi),%eax
+  802096:	2b 06                	sub    (%esi),%eax
+  802098:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  80209e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8020a5:	00 00 00 
+  stat->st_dev = &devpipe;
+  8020a8:	c7 83 88 00 00 00 20 	movl   $0x804020,0x88(%ebx)
+  8020af:	40 80 00 
+  return 0;
+}
+  8020b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020b7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020ba:	5b                   	pop    %ebx
+  8020bb:	5e                   	pop    %esi
+  8020bc:	5d                   	pop    %ebp
+  8020bd:	c3                   	ret
+
+008020be <pipe_wakeup>:
+{
+  8020be:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  8020c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020c5:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  8020c8:	85 c0                	test   %eax,%eax
+  8020ca:	75 01                	jne    8020cd <pipe_wakeup+0xf>
+  8020cc:	c3                   	ret
+{
+  8020cd:	55                   	push   %ebp
+  8020ce:	89 e5                	mov    %esp,%ebp
+  8020d0:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  8020d3:	6a 00                	push   $0x0
+  8020d5:	68 00 00 c0 ee       	push   $0xeec00000
+  8020da:	52                   	push   %edx
+  8020db:	e8 f9 ed ff ff       	call   800ed9 <sys_chan_wakeup>
+  8020e0:	83 c4 10             	add    $0x10,%esp
+}
+  8020e3:	c9                   	leave
+  8020e4:	c3                   	ret
+
+008020e5 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8020e5:	55                   	push   %ebp
+  8020e6:	89 e5                	mov    %esp,%ebp
+  8020e8:	57                   	push   %edi
+  8020e9:	56                   	push   %esi
+  8020ea:	53                   	push   %ebx
+  8020eb:	83 ec 18             	sub    $0x18,%esp
+  8020ee:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  8020f1:	57                   	push   %edi
+  8020f2:	e8 45 ef ff ff       	call   80103c <fd2data>
+  8020f7:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  8020f9:	83 c4 10             	add    $0x10,%esp
+  8020fc:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  802100:	74 2a                	je     80212c <devpipe_close+0x47>
+  802102:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  802107:	89 f8                	mov    %edi,%eax
+  802109:	e8 4f ff ff ff       	call   80205d <pipe_ring>
+  80210e:	83 ec 08             	sub    $0x8,%esp
+  802111:	01 d8                	add    %ebx,%eax
+  802113:	50                   	push   %eax
+  802114:	6a 00                	push   $0x0
+  802116:	e8 e7 ea ff ff       	call   800c02 <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  80211b:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802121:	83 c4 10             	add    $0x10,%esp
+  802124:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  80212a:	75 db                	jne    802107 <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  80212c:	83 ec 08             	sub    $0x8,%esp
+  80212f:	57                   	push   %edi
+  802130:	6a 00                	push   $0x0
+  802132:	e8 cb ea ff ff       	call   800c02 <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  802137:	83 c4 10             	add    $0x10,%esp
+  80213a:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  80213e:	75 13                	jne    802153 <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  802140:	83 ec 08             	sub    $0x8,%esp
+  802143:	56                   	push   %esi
+  802144:	6a 00                	push   $0x0
+  802146:	e8 b7 ea ff ff       	call   800c02 <sys_page_unmap>
+}
+  80214b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80214e:	5b                   	pop    %ebx
+  80214f:	5e                   	pop    %esi
+  802150:	5f                   	pop    %edi
+  802151:	5d                   	pop    %ebp
+  802152:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802153:	8d 56 04             	lea    0x4(%esi),%edx
+  802156:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802159:	e8 60 ff ff ff       	call   8020be <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  80215e:	8d 46 30             	lea    0x30(%esi),%eax
+  802161:	89 f2                	mov    %esi,%edx
+  802163:	e8 56 ff ff ff       	call   8020be <pipe_wakeup>
+  802168:	eb d6                	jmp    802140 <devpipe_close+0x5b>
+
+0080216a <_pipeisclosed>:
+{
+  80216a:	55                   	push   %ebp
+  80216b:	89 e5                	mov    %esp,%ebp
+  80216d:	57                   	push   %edi
+  80216e:	56                   	push   %esi
+  80216f:	53                   	push   %ebx
+  802170:	83 ec 1c             	sub    $0x1c,%esp
+  802173:	89 c7                	mov    %eax,%edi
+  802175:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  802177:	a1 44 57 80 00       	mov    0x805744,%eax
+  80217c:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  80217f:	83 ec 0c             	sub    $0xc,%esp
+  802182:	57                   	push   %edi
+  802183:	e8 5e 0a 00 00       	call   802be6 <pageref>
+  802188:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80218b:	89 34 24             	mov    %esi,(%esp)
+  80218e:	e8 53 0a 00 00       	call   802be6 <pageref>
+    nn = thisenv->env_runs;
+  802193:	8b 15 44 57 80 00    	mov    0x805744,%edx
+  802199:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  80219c:	83 c4 10             	add    $0x10,%esp
+  80219f:	39 cb                	cmp    %ecx,%ebx
+  8021a1:	74 1b                	je     8021be <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  8021a3:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8021a6:	75 cf                	jne    802177 <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8021a8:	8b 42 58             	mov    0x58(%edx),%eax
+  8021ab:	6a 01                	push   $0x1
+  8021ad:	50                   	push   %eax
+  8021ae:	53                   	push   %ebx
+  8021af:	68 ef 32 80 00       	push   $0x8032ef
+  8021b4:	e8 a7 df ff ff       	call   800160 <cprintf>
+  8021b9:	83 c4 10             	add    $0x10,%esp
+  8021bc:	eb b9                	jmp    802177 <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  8021be:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8021c1:	0f 94 c0             	sete   %al
+  8021c4:	0f b6 c0             	movzbl %al,%eax
+}
+  8021c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021ca:	5b                   	pop    %ebx
+  8021cb:	5e                   	pop    %esi
+  8021cc:	5f                   	pop    %edi
+  8021cd:	5d                   	pop    %ebp
+  8021ce:	c3                   	ret
+
+008021cf <devpipe_write_bulk>:
+{
+  8021cf:	55                   	push   %ebp
+  8021d0:	89 e5                	mov    %esp,%ebp
+  8021d2:	57                   	push   %edi
+  8021d3:	56                   	push   %esi
+  8021d4:	53                   	push   %ebx
+  8021d5:	83 ec 1c             	sub    $0x1c,%esp
+  8021d8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8021db:	89 d6                	mov    %edx,%esi
+  8021dd:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  8021e0:	e8 78 fe ff ff       	call   80205d <pipe_ring>
+  8021e5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  8021e8:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  8021ed:	8d 46 04             	lea    0x4(%esi),%eax
+  8021f0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  8021f3:	eb 75                	jmp    80226a <devpipe_write_bulk+0x9b>
+  8021f5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8021fa:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  8021fe:	6a 64                	push   $0x64
+  802200:	68 00 00 c0 ee       	push   $0xeec00000
+  802205:	53                   	push   %ebx
+  802206:	56                   	push   %esi
+  802207:	e8 aa ec ff ff       	call   800eb6 <sys_chan_sleep>
+      continue;
+  80220c:	83 c4 10             	add    $0x10,%esp
+  80220f:	eb 59                	jmp    80226a <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  802211:	89 d1                	mov    %edx,%ecx
+  802213:	c1 f9 1f             	sar    $0x1f,%ecx
+  802216:	c1 e9 11             	shr    $0x11,%ecx
+  802219:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  80221c:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802221:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  802223:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  802229:	29 d3                	sub    %edx,%ebx
+  80222b:	ba 00 80 00 00       	mov    $0x8000,%edx
+  802230:	29 c2                	sub    %eax,%edx
+  802232:	39 d3                	cmp    %edx,%ebx
+  802234:	0f 47 da             	cmova  %edx,%ebx
+  802237:	8b 55 08             	mov    0x8(%ebp),%edx
+  80223a:	29 fa                	sub    %edi,%edx
+  80223c:	39 d3                	cmp    %edx,%ebx
+  80223e:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  802241:	83 ec 04             	sub    $0x4,%esp
+  802244:	53                   	push   %ebx
+  802245:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802248:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  80224b:	52                   	push   %edx
+  80224c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80224f:	01 c8                	add    %ecx,%eax
+  802251:	50                   	push   %eax
+  802252:	e8 df e6 ff ff       	call   800936 <memcpy>
+    i += m;
+  802257:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  802259:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  80225c:	8d 46 2c             	lea    0x2c(%esi),%eax
+  80225f:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802262:	e8 57 fe ff ff       	call   8020be <pipe_wakeup>
+  802267:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  80226a:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  80226d:	73 2b                	jae    80229a <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  80226f:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  802271:	8b 56 04             	mov    0x4(%esi),%edx
+  802274:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  80227a:	39 d0                	cmp    %edx,%eax
+  80227c:	7d 93                	jge    802211 <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  80227e:	89 f2                	mov    %esi,%edx
+  802280:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802283:	e8 e2 fe ff ff       	call   80216a <_pipeisclosed>
+  802288:	85 c0                	test   %eax,%eax
+  80228a:	0f 84 65 ff ff ff    	je     8021f5 <devpipe_write_bulk+0x26>
+        return i;
+  802290:	89 f8                	mov    %edi,%eax
+}
+  802292:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802295:	5b                   	pop    %ebx
+  802296:	5e                   	pop    %esi
+  802297:	5f                   	pop    %edi
+  802298:	5d                   	pop    %ebp
+  802299:	c3                   	ret
+  return i;
+  80229a:	89 f8                	mov    %edi,%eax
+  80229c:	eb f4                	jmp    802292 <devpipe_write_bulk+0xc3>
+
+0080229e <devpipe_write>:
+{
+  80229e:	55                   	push   %ebp
+  80229f:	89 e5                	mov    %esp,%ebp
+  8022a1:	57                   	push   %edi
+  8022a2:	56                   	push   %esi
+  8022a3:	53                   	push   %ebx
+  8022a4:	83 ec 28             	sub    $0x28,%esp
+  8022a7:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  8022aa:	56                   	push   %esi
+  8022ab:	e8 8c ed ff ff       	call   80103c <fd2data>
+  8022b0:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  8022b2:	8b 78 28             	mov    0x28(%eax),%edi
+  8022b5:	83 c4 10             	add    $0x10,%esp
+  8022b8:	85 ff                	test   %edi,%edi
+  8022ba:	75 25                	jne    8022e1 <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  8022bc:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8022bf:	74 66                	je     802327 <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8022c1:	8b 43 04             	mov    0x4(%ebx),%eax
+  8022c4:	8b 0b                	mov    (%ebx),%ecx
+  8022c6:	8d 51 20             	lea    0x20(%ecx),%edx
+  8022c9:	39 d0                	cmp    %edx,%eax
+  8022cb:	72 2b                	jb     8022f8 <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  8022cd:	89 da                	mov    %ebx,%edx
+  8022cf:	89 f0                	mov    %esi,%eax
+  8022d1:	e8 94 fe ff ff       	call   80216a <_pipeisclosed>
+  8022d6:	85 c0                	test   %eax,%eax
+  8022d8:	75 51                	jne    80232b <devpipe_write+0x8d>
+      sys_yield();
+  8022da:	e8 3c e8 ff ff       	call   800b1b <sys_yield>
+  8022df:	eb e0                	jmp    8022c1 <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  8022e1:	83 ec 0c             	sub    $0xc,%esp
+  8022e4:	ff 75 10             	push   0x10(%ebp)
+  8022e7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8022ea:	89 c2                	mov    %eax,%edx
+  8022ec:	89 f0                	mov    %esi,%eax
+  8022ee:	e8 dc fe ff ff       	call   8021cf <devpipe_write_bulk>
+  8022f3:	83 c4 10             	add    $0x10,%esp
+  8022f6:	eb 38                	jmp    802330 <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8022f8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8022fb:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8022ff:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802302:	89 c2                	mov    %eax,%edx
+  802304:	c1 fa 1f             	sar    $0x1f,%edx
+  802307:	89 d1                	mov    %edx,%ecx
+  802309:	c1 e9 1b             	shr    $0x1b,%ecx
+  80230c:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80230f:	83 e2 1f             	and    $0x1f,%edx
+  802312:	29 ca                	sub    %ecx,%edx
+  802314:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802318:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  80231c:	83 c0 01             	add    $0x1,%eax
+  80231f:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  802322:	83 c7 01             	add    $0x1,%edi
+  802325:	eb 95                	jmp    8022bc <devpipe_write+0x1e>
+  return i;
+  802327:	89 f8                	mov    %edi,%eax
+  802329:	eb 05                	jmp    802330 <devpipe_write+0x92>
+        return 0;
+  80232b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802330:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802333:	5b                   	pop    %ebx
+  802334:	5e                   	pop    %esi
+  802335:	5f                   	pop    %edi
+  802336:	5d                   	pop    %ebp
+  802337:	c3                   	ret
+
+00802338 <devpipe_read_bulk>:
+{
+  802338:	55                   	push   %ebp
+  802339:	89 e5                	mov    %esp,%ebp
+  80233b:	57                   	push   %edi
+  80233c:	56                   	push   %esi
+  80233d:	53                   	push   %ebx
+  80233e:	83 ec 2c             	sub    $0x2c,%esp
+  802341:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802344:	89 d6                	mov    %edx,%esi
+  802346:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802349:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  80234c:	e8 0c fd ff ff       	call   80205d <pipe_ring>
+  802351:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  802354:	85 db                	test   %ebx,%ebx
+  802356:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80235b:	0f 45 c3             	cmovne %ebx,%eax
+  80235e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802361:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802366:	8d 46 30             	lea    0x30(%esi),%eax
+  802369:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  80236c:	eb 50                	jmp    8023be <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  80236e:	89 d1                	mov    %edx,%ecx
+  802370:	c1 f9 1f             	sar    $0x1f,%ecx
+  802373:	c1 e9 11             	shr    $0x11,%ecx
+  802376:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802379:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  80237e:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  802380:	29 d3                	sub    %edx,%ebx
+  802382:	ba 00 80 00 00       	mov    $0x8000,%edx
+  802387:	29 c2                	sub    %eax,%edx
+  802389:	39 d3                	cmp    %edx,%ebx
+  80238b:	0f 47 da             	cmova  %edx,%ebx
+  80238e:	8b 55 08             	mov    0x8(%ebp),%edx
+  802391:	29 fa                	sub    %edi,%edx
+  802393:	39 d3                	cmp    %edx,%ebx
+  802395:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  802398:	83 ec 04             	sub    $0x4,%esp
+  80239b:	53                   	push   %ebx
+  80239c:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80239f:	01 c8                	add    %ecx,%eax
+  8023a1:	50                   	push   %eax
+  8023a2:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8023a5:	01 f8                	add    %edi,%eax
+  8023a7:	50                   	push   %eax
+  8023a8:	e8 89 e5 ff ff       	call   800936 <memcpy>
+    i += m;
+  8023ad:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  8023af:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8023b1:	89 f2                	mov    %esi,%edx
+  8023b3:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8023b6:	e8 03 fd ff ff       	call   8020be <pipe_wakeup>
+  8023bb:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  8023be:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  8023c1:	73 51                	jae    802414 <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  8023c3:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  8023c6:	8b 16                	mov    (%esi),%edx
+  8023c8:	39 da                	cmp    %ebx,%edx
+  8023ca:	75 a2                	jne    80236e <devpipe_read_bulk+0x36>
+      if (i > 0)
+  8023cc:	85 ff                	test   %edi,%edi
+  8023ce:	75 44                	jne    802414 <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  8023d0:	89 f2                	mov    %esi,%edx
+  8023d2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8023d5:	e8 90 fd ff ff       	call   80216a <_pipeisclosed>
+  8023da:	85 c0                	test   %eax,%eax
+  8023dc:	75 3a                	jne    802418 <devpipe_read_bulk+0xe0>
+  8023de:	b8 01 00 00 00       	mov    $0x1,%eax
+  8023e3:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  8023e7:	6a 64                	push   $0x64
+  8023e9:	ff 75 d4             	push   -0x2c(%ebp)
+  8023ec:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  8023ed:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  8023f0:	50                   	push   %eax
+  8023f1:	e8 c0 ea ff ff       	call   800eb6 <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  8023f6:	85 c0                	test   %eax,%eax
+  8023f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023fd:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  802400:	83 c4 10             	add    $0x10,%esp
+  802403:	a8 01                	test   $0x1,%al
+  802405:	74 b7                	je     8023be <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  802407:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  80240c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80240f:	5b                   	pop    %ebx
+  802410:	5e                   	pop    %esi
+  802411:	5f                   	pop    %edi
+  802412:	5d                   	pop    %ebp
+  802413:	c3                   	ret
+  return i;
+  802414:	89 f8                	mov    %edi,%eax
+  802416:	eb f4                	jmp    80240c <devpipe_read_bulk+0xd4>
+        return 0;
+  802418:	b8 00 00 00 00       	mov    $0x0,%eax
+  80241d:	eb ed                	jmp    80240c <devpipe_read_bulk+0xd4>
+
+0080241f <devpipe_read>:
+{
+  80241f:	55                   	push   %ebp
+  802420:	89 e5                	mov    %esp,%ebp
+  802422:	57                   	push   %edi
+  802423:	56                   	push   %esi
+  802424:	53                   	push   %ebx
+  802425:	83 ec 18             	sub    $0x18,%esp
+  802428:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  80242b:	57                   	push   %edi
+  80242c:	e8 0b ec ff ff       	call   80103c <fd2data>
+  802431:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  802433:	8b 70 28             	mov    0x28(%eax),%esi
+  802436:	83 c4 10             	add    $0x10,%esp
+  802439:	85 f6                	test   %esi,%esi
+  80243b:	75 24                	jne    802461 <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  80243d:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802440:	74 60                	je     8024a2 <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  802442:	8b 03                	mov    (%ebx),%eax
+  802444:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802447:	75 3b                	jne    802484 <devpipe_read+0x65>
+      if (i > 0)
+  802449:	85 f6                	test   %esi,%esi
+  80244b:	75 2d                	jne    80247a <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  80244d:	89 da                	mov    %ebx,%edx
+  80244f:	89 f8                	mov    %edi,%eax
+  802451:	e8 14 fd ff ff       	call   80216a <_pipeisclosed>
+  802456:	85 c0                	test   %eax,%eax
+  802458:	75 4c                	jne    8024a6 <devpipe_read+0x87>
+      sys_yield();
+  80245a:	e8 bc e6 ff ff       	call   800b1b <sys_yield>
+  80245f:	eb e1                	jmp    802442 <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  802461:	83 ec 08             	sub    $0x8,%esp
+  802464:	6a 00                	push   $0x0
+  802466:	ff 75 10             	push   0x10(%ebp)
+  802469:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80246c:	89 c2                	mov    %eax,%edx
+  80246e:	89 f8                	mov    %edi,%eax
+  802470:	e8 c3 fe ff ff       	call   802338 <devpipe_read_bulk>
+  802475:	83 c4 10             	add    $0x10,%esp
+  802478:	eb 02                	jmp    80247c <devpipe_read+0x5d>
+        return i;
+  80247a:	89 f0                	mov    %esi,%eax
+}
+  80247c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80247f:	5b                   	pop    %ebx
+  802480:	5e                   	pop    %esi
+  802481:	5f                   	pop    %edi
+  802482:	5d                   	pop    %ebp
+  802483:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802484:	99                   	cltd
+  802485:	c1 ea 1b             	shr    $0x1b,%edx
+  802488:	01 d0                	add    %edx,%eax
+  80248a:	83 e0 1f             	and    $0x1f,%eax
+  80248d:	29 d0                	sub    %edx,%eax
+  80248f:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802494:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802497:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  80249a:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  80249d:	83 c6 01             	add    $0x1,%esi
+  8024a0:	eb 9b                	jmp    80243d <devpipe_read+0x1e>
+  return i;
+  8024a2:	89 f0                	mov    %esi,%eax
+  8024a4:	eb d6                	jmp    80247c <devpipe_read+0x5d>
+        return 0;
+  8024a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024ab:	eb cf                	jmp    80247c <devpipe_read+0x5d>
+
+008024ad <pipe2>:
+{
+  8024ad:	55                   	push   %ebp
+  8024ae:	89 e5                	mov    %esp,%ebp
+  8024b0:	57                   	push   %edi
+  8024b1:	56                   	push   %esi
+  8024b2:	53                   	push   %ebx
+  8024b3:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  8024b6:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8024b9:	50                   	push   %eax
+  8024ba:	e8 91 eb ff ff       	call   801050 <fd_alloc>
+  8024bf:	89 c3                	mov    %eax,%ebx
+  8024c1:	83 c4 10             	add    $0x10,%esp
+  8024c4:	85 c0                	test   %eax,%eax
+  8024c6:	0f 88 fb 01 00 00    	js     8026c7 <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8024cc:	83 ec 04             	sub    $0x4,%esp
+  8024cf:	68 07 04 00 00       	push   $0x407
+  8024d4:	ff 75 e4             	push   -0x1c(%ebp)
+  8024d7:	6a 00                	push   $0x0
+  8024d9:	e8 9f e6 ff ff       	call   800b7d <sys_page_alloc>
+  8024de:	89 c3                	mov    %eax,%ebx
+  8024e0:	83 c4 10             	add    $0x10,%esp
+  8024e3:	85 c0                	test   %eax,%eax
+  8024e5:	0f 88 dc 01 00 00    	js     8026c7 <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  8024eb:	83 ec 0c             	sub    $0xc,%esp
+  8024ee:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8024f1:	50                   	push   %eax
+  8024f2:	e8 59 eb ff ff       	call   801050 <fd_alloc>
+  8024f7:	89 c3                	mov    %eax,%ebx
+  8024f9:	83 c4 10             	add    $0x10,%esp
+  8024fc:	85 c0                	test   %eax,%eax
+  8024fe:	0f 88 b3 01 00 00    	js     8026b7 <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802504:	83 ec 04             	sub    $0x4,%esp
+  802507:	68 07 04 00 00       	push   $0x407
+  80250c:	ff 75 e0             	push   -0x20(%ebp)
+  80250f:	6a 00                	push   $0x0
+  802511:	e8 67 e6 ff ff       	call   800b7d <sys_page_alloc>
+  802516:	89 c3                	mov    %eax,%ebx
+  802518:	83 c4 10             	add    $0x10,%esp
+  80251b:	85 c0                	test   %eax,%eax
+  80251d:	0f 88 94 01 00 00    	js     8026b7 <pipe2+0x20a>
+  va = fd2data(fd0);
+  802523:	83 ec 0c             	sub    $0xc,%esp
+  802526:	ff 75 e4             	push   -0x1c(%ebp)
+  802529:	e8 0e eb ff ff       	call   80103c <fd2data>
+  80252e:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802530:	83 c4 0c             	add    $0xc,%esp
+  802533:	68 07 04 00 00       	push   $0x407
+  802538:	50                   	push   %eax
+  802539:	6a 00                	push   $0x0
+  80253b:	e8 3d e6 ff ff       	call   800b7d <sys_page_alloc>
+  802540:	89 c3                	mov    %eax,%ebx
+  802542:	83 c4 10             	add    $0x10,%esp
+  802545:	85 c0                	test   %eax,%eax
+  802547:	0f 88 5a 01 00 00    	js     8026a7 <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80254d:	83 ec 0c             	sub    $0xc,%esp
+  802550:	ff 75 e0             	push   -0x20(%ebp)
+  802553:	e8 e4 ea ff ff       	call   80103c <fd2data>
+  802558:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80255f:	50                   	push   %eax
+  802560:	6a 00                	push   $0x0
+  802562:	57                   	push   %edi
+  802563:	6a 00                	push   $0x0
+  802565:	e8 56 e6 ff ff       	call   800bc0 <sys_page_map>
+  80256a:	89 c3                	mov    %eax,%ebx
+  80256c:	83 c4 20             	add    $0x20,%esp
+  80256f:	85 c0                	test   %eax,%eax
+  802571:	0f 88 22 01 00 00    	js     802699 <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  802577:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  80257b:	74 72                	je     8025ef <pipe2+0x142>
+  80257d:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  802582:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802585:	e8 d3 fa ff ff       	call   80205d <pipe_ring>
+  80258a:	83 ec 04             	sub    $0x4,%esp
+  80258d:	68 07 04 00 00       	push   $0x407
+  802592:	01 f0                	add    %esi,%eax
+  802594:	50                   	push   %eax
+  802595:	6a 00                	push   $0x0
+  802597:	e8 e1 e5 ff ff       	call   800b7d <sys_page_alloc>
+  80259c:	89 c3                	mov    %eax,%ebx
+  80259e:	83 c4 10             	add    $0x10,%esp
+  8025a1:	85 c0                	test   %eax,%eax
+  8025a3:	0f 88 97 00 00 00    	js     802640 <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  8025a9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8025ac:	e8 ac fa ff ff       	call   80205d <pipe_ring>
+  8025b1:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  8025b4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8025b7:	e8 a1 fa ff ff       	call   80205d <pipe_ring>
+  8025bc:	83 ec 0c             	sub    $0xc,%esp
+  8025bf:	68 07 04 00 00       	push   $0x407
+  8025c4:	53                   	push   %ebx
+  8025c5:	6a 00                	push   $0x0
+  8025c7:	01 f0                	add    %esi,%eax
+  8025c9:	50                   	push   %eax
+  8025ca:	6a 00                	push   $0x0
+  8025cc:	e8 ef e5 ff ff       	call   800bc0 <sys_page_map>
+  8025d1:	89 c3                	mov    %eax,%ebx
+  8025d3:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8025d9:	83 c4 20             	add    $0x20,%esp
+  8025dc:	85 c0                	test   %eax,%eax
+  8025de:	78 60                	js     802640 <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  8025e0:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  8025e6:	75 9a                	jne    802582 <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  8025e8:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  8025ef:	a1 20 40 80 00       	mov    0x804020,%eax
+  8025f4:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8025f7:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  8025f9:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8025fc:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  802603:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802606:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  802608:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80260b:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  802612:	83 ec 0c             	sub    $0xc,%esp
+  802615:	ff 75 e4             	push   -0x1c(%ebp)
+  802618:	e8 0f ea ff ff       	call   80102c <fd2num>
+  80261d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802620:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  802622:	83 c4 04             	add    $0x4,%esp
+  802625:	ff 75 e0             	push   -0x20(%ebp)
+  802628:	e8 ff e9 ff ff       	call   80102c <fd2num>
+  80262d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802630:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  802633:	83 c4 10             	add    $0x10,%esp
+  802636:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80263b:	e9 87 00 00 00       	jmp    8026c7 <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802640:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  802645:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802648:	e8 10 fa ff ff       	call   80205d <pipe_ring>
+  80264d:	83 ec 08             	sub    $0x8,%esp
+  802650:	01 f0                	add    %esi,%eax
+  802652:	50                   	push   %eax
+  802653:	6a 00                	push   $0x0
+  802655:	e8 a8 e5 ff ff       	call   800c02 <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  80265a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80265d:	e8 fb f9 ff ff       	call   80205d <pipe_ring>
+  802662:	83 c4 08             	add    $0x8,%esp
+  802665:	01 f0                	add    %esi,%eax
+  802667:	50                   	push   %eax
+  802668:	6a 00                	push   $0x0
+  80266a:	e8 93 e5 ff ff       	call   800c02 <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  80266f:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802675:	83 c4 10             	add    $0x10,%esp
+  802678:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  80267e:	75 c5                	jne    802645 <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  802680:	83 ec 0c             	sub    $0xc,%esp
+  802683:	ff 75 e0             	push   -0x20(%ebp)
+  802686:	e8 b1 e9 ff ff       	call   80103c <fd2data>
+  80268b:	83 c4 08             	add    $0x8,%esp
+  80268e:	50                   	push   %eax
+  80268f:	6a 00                	push   $0x0
+  802691:	e8 6c e5 ff ff       	call   800c02 <sys_page_unmap>
+  802696:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  802699:	83 ec 08             	sub    $0x8,%esp
+  80269c:	57                   	push   %edi
+  80269d:	6a 00                	push   $0x0
+  80269f:	e8 5e e5 ff ff       	call   800c02 <sys_page_unmap>
+  8026a4:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  8026a7:	83 ec 08             	sub    $0x8,%esp
+  8026aa:	ff 75 e0             	push   -0x20(%ebp)
+  8026ad:	6a 00                	push   $0x0
+  8026af:	e8 4e e5 ff ff       	call   800c02 <sys_page_unmap>
+  8026b4:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  8026b7:	83 ec 08             	sub    $0x8,%esp
+  8026ba:	ff 75 e4             	push   -0x1c(%ebp)
+  8026bd:	6a 00                	push   $0x0
+  8026bf:	e8 3e e5 ff ff       	call   800c02 <sys_page_unmap>
+  8026c4:	83 c4 10             	add    $0x10,%esp
+}
+  8026c7:	89 d8                	mov    %ebx,%eax
+  8026c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026cc:	5b                   	pop    %ebx
+  8026cd:	5e                   	pop    %esi
+  8026ce:	5f                   	pop    %edi
+  8026cf:	5d                   	pop    %ebp
+  8026d0:	c3                   	ret
+
+008026d1 <pipe>:
+{
+  8026d1:	55                   	push   %ebp
+  8026d2:	89 e5                	mov    %esp,%ebp
+  8026d4:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  8026d7:	6a 00                	push   $0x0
+  8026d9:	ff 75 08             	push   0x8(%ebp)
+  8026dc:	e8 cc fd ff ff       	call   8024ad <pipe2>
+}
+  8026e1:	c9                   	leave
+  8026e2:	c3                   	ret
+
+008026e3 <pipeisclosed>:
+{
+  8026e3:	55                   	push   %ebp
+  8026e4:	89 e5                	mov    %esp,%ebp
+  8026e6:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8026e9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8026ec:	50                   	push   %eax
+  8026ed:	ff 75 08             	push   0x8(%ebp)
+  8026f0:	e8 b1 e9 ff ff       	call   8010a6 <fd_lookup>
+  8026f5:	83 c4 10             	add    $0x10,%esp
+  8026f8:	85 c0                	test   %eax,%eax
+  8026fa:	78 18                	js     802714 <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  8026fc:	83 ec 0c             	sub    $0xc,%esp
+  8026ff:	ff 75 f4             	push   -0xc(%ebp)
+  802702:	e8 35 e9 ff ff       	call   80103c <fd2data>
+  802707:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  802709:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80270c:	e8 59 fa ff ff       	call   80216a <_pipeisclosed>
+  802711:	83 c4 10             	add    $0x10,%esp
+}
+  802714:	c9                   	leave
+  802715:	c3                   	ret
+
+00802716 <pipe_splice>:
+{
+  802716:	55                   	push   %ebp
+  802717:	89 e5                	mov    %esp,%ebp
+  802719:	57                   	push   %edi
+  80271a:	56                   	push   %esi
+  80271b:	53                   	push   %ebx
+  80271c:	83 ec 34             	sub    $0x34,%esp
+  80271f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802722:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802725:	50                   	push   %eax
+  802726:	ff 75 08             	push   0x8(%ebp)
+  802729:	e8 78 e9 ff ff       	call   8010a6 <fd_lookup>
+  80272e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802731:	83 c4 10             	add    $0x10,%esp
+  802734:	85 c0                	test   %eax,%eax
+  802736:	0f 88 d7 00 00 00    	js     802813 <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  80273c:	83 ec 0c             	sub    $0xc,%esp
+  80273f:	ff 75 e4             	push   -0x1c(%ebp)
+  802742:	e8 f5 e8 ff ff       	call   80103c <fd2data>
+  802747:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802749:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80274c:	83 c4 10             	add    $0x10,%esp
+  80274f:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802755:	39 10                	cmp    %edx,(%eax)
+  802757:	0f 85 c1 00 00 00    	jne    80281e <pipe_splice+0x108>
+  80275d:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  802761:	0f 84 c0 00 00 00    	je     802827 <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  802767:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  80276b:	0f 84 bf 00 00 00    	je     802830 <pipe_splice+0x11a>
+  802771:	89 f7                	mov    %esi,%edi
+  802773:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  802779:	0f 85 ba 00 00 00    	jne    802839 <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  80277f:	8d 43 04             	lea    0x4(%ebx),%eax
+  802782:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802785:	eb 38                	jmp    8027bf <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802787:	83 ec 0c             	sub    $0xc,%esp
+  80278a:	68 00 10 00 00       	push   $0x1000
+  80278f:	89 f1                	mov    %esi,%ecx
+  802791:	89 da                	mov    %ebx,%edx
+  802793:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802796:	e8 34 fa ff ff       	call   8021cf <devpipe_write_bulk>
+  80279b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80279e:	83 c4 10             	add    $0x10,%esp
+  8027a1:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8027a6:	75 53                	jne    8027fb <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  8027a8:	83 ec 08             	sub    $0x8,%esp
+  8027ab:	56                   	push   %esi
+  8027ac:	6a 00                	push   $0x0
+  8027ae:	e8 4f e4 ff ff       	call   800c02 <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  8027b3:	83 c7 01             	add    $0x1,%edi
+  8027b6:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8027bc:	83 c4 10             	add    $0x10,%esp
+  8027bf:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8027c2:	74 3a                	je     8027fe <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  8027c4:	8b 03                	mov    (%ebx),%eax
+  8027c6:	39 43 04             	cmp    %eax,0x4(%ebx)
+  8027c9:	75 bc                	jne    802787 <pipe_splice+0x71>
+  8027cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027d0:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  8027d4:	85 c0                	test   %eax,%eax
+  8027d6:	74 af                	je     802787 <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  8027d8:	83 ec 04             	sub    $0x4,%esp
+  8027db:	6a 07                	push   $0x7
+  8027dd:	56                   	push   %esi
+  8027de:	ff 75 d0             	push   -0x30(%ebp)
+  8027e1:	e8 f3 e6 ff ff       	call   800ed9 <sys_chan_wakeup>
+  8027e6:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8027e9:	83 c4 10             	add    $0x10,%esp
+  8027ec:	85 c0                	test   %eax,%eax
+  8027ee:	79 b8                	jns    8027a8 <pipe_splice+0x92>
+  8027f0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8027f5:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  8027f9:	eb 8c                	jmp    802787 <pipe_splice+0x71>
+  8027fb:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  8027fe:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802802:	75 06                	jne    80280a <pipe_splice+0xf4>
+  802804:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802808:	78 09                	js     802813 <pipe_splice+0xfd>
+  return i * PGSIZE;
+  80280a:	8b 45 10             	mov    0x10(%ebp),%eax
+  80280d:	c1 e0 0c             	shl    $0xc,%eax
+  802810:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  802813:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802816:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802819:	5b                   	pop    %ebx
+  80281a:	5e                   	pop    %esi
+  80281b:	5f                   	pop    %edi
+  80281c:	5d                   	pop    %ebp
+  80281d:	c3                   	ret
+    return -E_INVAL;
+  80281e:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802825:	eb ec                	jmp    802813 <pipe_splice+0xfd>
+  802827:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  80282e:	eb e3                	jmp    802813 <pipe_splice+0xfd>
+  802830:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802837:	eb da                	jmp    802813 <pipe_splice+0xfd>
+  802839:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802840:	eb d1                	jmp    802813 <pipe_splice+0xfd>
+
+00802842 <pipe_splice_read>:
+{
+  802842:	55                   	push   %ebp
+  802843:	89 e5                	mov    %esp,%ebp
+  802845:	53                   	push   %ebx
+  802846:	83 ec 1c             	sub    $0x1c,%esp
+  802849:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80284c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80284f:	50                   	push   %eax
+  802850:	ff 75 08             	push   0x8(%ebp)
+  802853:	e8 4e e8 ff ff       	call   8010a6 <fd_lookup>
+  802858:	83 c4 10             	add    $0x10,%esp
+  80285b:	85 c0                	test   %eax,%eax
+  80285d:	78 49                	js     8028a8 <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  80285f:	83 ec 0c             	sub    $0xc,%esp
+  802862:	ff 75 f4             	push   -0xc(%ebp)
+  802865:	e8 d2 e7 ff ff       	call   80103c <fd2data>
+  80286a:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  80286c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80286f:	83 c4 10             	add    $0x10,%esp
+  802872:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  802878:	39 08                	cmp    %ecx,(%eax)
+  80287a:	75 31                	jne    8028ad <pipe_splice_read+0x6b>
+  80287c:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  802880:	74 32                	je     8028b4 <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  802882:	8b 48 08             	mov    0x8(%eax),%ecx
+  802885:	83 e1 03             	and    $0x3,%ecx
+  802888:	83 f9 01             	cmp    $0x1,%ecx
+  80288b:	74 2e                	je     8028bb <pipe_splice_read+0x79>
+  80288d:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  802893:	75 2d                	jne    8028c2 <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  802895:	83 ec 08             	sub    $0x8,%esp
+  802898:	53                   	push   %ebx
+  802899:	68 00 10 00 00       	push   $0x1000
+  80289e:	89 d9                	mov    %ebx,%ecx
+  8028a0:	e8 93 fa ff ff       	call   802338 <devpipe_read_bulk>
+  8028a5:	83 c4 10             	add    $0x10,%esp
+}
+  8028a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8028ab:	c9                   	leave
+  8028ac:	c3                   	ret
+    return -E_INVAL;
+  8028ad:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028b2:	eb f4                	jmp    8028a8 <pipe_splice_read+0x66>
+  8028b4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028b9:	eb ed                	jmp    8028a8 <pipe_splice_read+0x66>
+  8028bb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028c0:	eb e6                	jmp    8028a8 <pipe_splice_read+0x66>
+  8028c2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028c7:	eb df                	jmp    8028a8 <pipe_splice_read+0x66>
+
+008028c9 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  8028c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028ce:	c3                   	ret
+
+008028cf <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8028cf:	55                   	push   %ebp
+  8028d0:	89 e5                	mov    %esp,%ebp
+  8028d2:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  8028d5:	68 07 33 80 00       	push   $0x803307
+  8028da:	ff 75 0c             	push   0xc(%ebp)
+  8028dd:	e8 6c de ff ff       	call   80074e <strcpy>
+  return 0;
+}
+  8028e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028e7:	c9                   	leave
+  8028e8:	c3                   	ret
+
+008028e9 <devcons_write>:
+{
+  8028e9:	55                   	push   %ebp
+  8028ea:	89 e5                	mov    %esp,%ebp
+  8028ec:	57                   	push   %edi
+  8028ed:	56                   	push   %esi
+  8028ee:	53                   	push   %ebx
+  8028ef:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  8028f5:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  8028fa:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  802900:	eb 2e                	jmp    802930 <devcons_write+0x47>
+    m = n - tot;
+  802902:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802905:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  802907:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80290c:	39 c3                	cmp    %eax,%ebx
+  80290e:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  802911:	83 ec 04             	sub    $0x4,%esp
+  802914:	53                   	push   %ebx
+  802915:	89 f0                	mov    %esi,%eax
+  802917:	03 45 0c             	add    0xc(%ebp),%eax
+  80291a:	50                   	push   %eax
+  80291b:	57                   	push   %edi
+  80291c:	e8 b3 df ff ff       	call   8008d4 <memmove>
+    sys_cputs(buf, m);
+  802921:	83 c4 08             	add    $0x8,%esp
+  802924:	53                   	push   %ebx
+  802925:	57                   	push   %edi
+  802926:	e8 53 e1 ff ff       	call   800a7e <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  80292b:	01 de                	add    %ebx,%esi
+  80292d:	83 c4 10             	add    $0x10,%esp
+  802930:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802933:	72 cd                	jb     802902 <devcons_write+0x19>
+}
+  802935:	89 f0                	mov    %esi,%eax
+  802937:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80293a:	5b                   	pop    %ebx
+  80293b:	5e                   	pop    %esi
+  80293c:	5f                   	pop    %edi
+  80293d:	5d                   	pop    %ebp
+  80293e:	c3                   	ret
+
+0080293f <devcons_read>:
+{
+  80293f:	55                   	push   %ebp
+  802940:	89 e5                	mov    %esp,%ebp
+  802942:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  802945:	b8 00 00 00 00       	mov    $0x0,%eax
+  80294a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80294e:	75 07                	jne    802957 <devcons_read+0x18>
+  802950:	eb 1f                	jmp    802971 <devcons_read+0x32>
+    sys_yield();
+  802952:	e8 c4 e1 ff ff       	call   800b1b <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  802957:	e8 40 e1 ff ff       	call   800a9c <sys_cgetc>
+  80295c:	85 c0                	test   %eax,%eax
+  80295e:	74 f2                	je     802952 <devcons_read+0x13>
+  if (c < 0)
+  802960:	78 0f                	js     802971 <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  802962:	83 f8 04             	cmp    $0x4,%eax
+  802965:	74 0c                	je     802973 <devcons_read+0x34>
+  *(char*)vbuf = c;
+  802967:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80296a:	88 02                	mov    %al,(%edx)
+  return 1;
+  80296c:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802971:	c9                   	leave
+  802972:	c3                   	ret
+    return 0;
+  802973:	b8 00 00 00 00       	mov    $0x0,%eax
+  802978:	eb f7                	jmp    802971 <devcons_read+0x32>
+
+0080297a <cputchar>:
+{
+  80297a:	55                   	push   %ebp
+  80297b:	89 e5                	mov    %esp,%ebp
+  80297d:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  802980:	8b 45 08             	mov    0x8(%ebp),%eax
+  802983:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  802986:	6a 01                	push   $0x1
+  802988:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80298b:	50                   	push   %eax
+  80298c:	e8 ed e0 ff ff       	call   800a7e <sys_cputs>
+}
+  802991:	83 c4 10             	add    $0x10,%esp
+  802994:	c9                   	leave
+  802995:	c3                   	ret
+
+00802996 <getchar>:
+{
+  802996:	55                   	push   %ebp
+  802997:	89 e5                	mov    %esp,%ebp
+  802999:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  80299c:	6a 01                	push   $0x1
+  80299e:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8029a1:	50                   	push   %eax
+  8029a2:	6a 00                	push   $0x0
+  8029a4:	e8 a8 e9 ff ff       	call   801351 <read>
+  if (r < 0)
+  8029a9:	83 c4 10             	add    $0x10,%esp
+  8029ac:	85 c0                	test   %eax,%eax
+  8029ae:	78 06                	js     8029b6 <getchar+0x20>
+  if (r < 1)
+  8029b0:	74 06                	je     8029b8 <getchar+0x22>
+  return c;
+  8029b2:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8029b6:	c9                   	leave
+  8029b7:	c3                   	ret
+    return -E_EOF;
+  8029b8:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8029bd:	eb f7                	jmp    8029b6 <getchar+0x20>
+
+008029bf <iscons>:
+{
+  8029bf:	55                   	push   %ebp
+  8029c0:	89 e5                	mov    %esp,%ebp
+  8029c2:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8029c5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8029c8:	50                   	push   %eax
+  8029c9:	ff 75 08             	push   0x8(%ebp)
+  8029cc:	e8 d5 e6 ff ff       	call   8010a6 <fd_lookup>
+  8029d1:	83 c4 10             	add    $0x10,%esp
+  8029d4:	85 c0                	test   %eax,%eax
+  8029d6:	78 11                	js     8029e9 <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  8029d8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029db:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  8029e1:	39 10                	cmp    %edx,(%eax)
+  8029e3:	0f 94 c0             	sete   %al
+  8029e6:	0f b6 c0             	movzbl %al,%eax
+}
+  8029e9:	c9                   	leave
+  8029ea:	c3                   	ret
+
+008029eb <opencons>:
+{
+  8029eb:	55                   	push   %ebp
+  8029ec:	89 e5                	mov    %esp,%ebp
+  8029ee:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  8029f1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8029f4:	50                   	push   %eax
+  8029f5:	e8 56 e6 ff ff       	call   801050 <fd_alloc>
+  8029fa:	83 c4 10             	add    $0x10,%esp
+  8029fd:	85 c0                	test   %eax,%eax
+  8029ff:	78 3a                	js     802a3b <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802a01:	83 ec 04             	sub    $0x4,%esp
+  802a04:	68 07 04 00 00       	push   $0x407
+  802a09:	ff 75 f4             	push   -0xc(%ebp)
+  802a0c:	6a 00                	push   $0x0
+  802a0e:	e8 6a e1 ff ff       	call   800b7d <sys_page_alloc>
+  802a13:	83 c4 10             	add    $0x10,%esp
+  802a16:	85 c0                	test   %eax,%eax
+  802a18:	78 21                	js     802a3b <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  802a1a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a1d:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802a23:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  802a25:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a28:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  802a2f:	83 ec 0c             	sub    $0xc,%esp
+  802a32:	50                   	push   %eax
+  802a33:	e8 f4 e5 ff ff       	call   80102c <fd2num>
+  802a38:	83 c4 10             	add    $0x10,%esp
+}
+  802a3b:	c9                   	leave
+  802a3c:	c3                   	ret
+
+00802a3d <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  802a3d:	55                   	push   %ebp
+  802a3e:	89 e5                	mov    %esp,%ebp
+  802a40:	56                   	push   %esi
+  802a41:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  802a42:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  802a45:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  802a4b:	e8 ac e0 ff ff       	call   800afc <sys_getenvid>
+  802a50:	83 ec 0c             	sub    $0xc,%esp
+  802a53:	ff 75 0c             	push   0xc(%ebp)
+  802a56:	ff 75 08             	push   0x8(%ebp)
+  802a59:	56                   	push   %esi
+  802a5a:	50                   	push   %eax
+  802a5b:	68 14 33 80 00       	push   $0x803314
+  802a60:	e8 fb d6 ff ff       	call   800160 <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  802a65:	83 c4 18             	add    $0x18,%esp
+  802a68:	53                   	push   %ebx
+  802a69:	ff 75 10             	push   0x10(%ebp)
+  802a6c:	e8 9e d6 ff ff       	call   80010f <vcprintf>
+  cprintf("\n");
+  802a71:	c7 04 24 00 33 80 00 	movl   $0x803300,(%esp)
+  802a78:	e8 e3 d6 ff ff       	call   800160 <cprintf>
+  802a7d:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  802a80:	cc                   	int3
+  while (1)
+  802a81:	eb fd                	jmp    802a80 <_panic+0x43>
+
+00802a83 <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  802a83:	55                   	push   %ebp
+  802a84:	89 e5                	mov    %esp,%ebp
+  802a86:	57                   	push   %edi
+  802a87:	56                   	push   %esi
+  802a88:	53                   	push   %ebx
+  802a89:	83 ec 14             	sub    $0x14,%esp
+  802a8c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802a8f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a92:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802a95:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  802a98:	85 c0                	test   %eax,%eax
+  802a9a:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802a9f:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  802aa2:	ff 33                	push   (%ebx)
+  802aa4:	50                   	push   %eax
+  802aa5:	e8 ab e3 ff ff       	call   800e55 <sys_ipc_recv>
+  802aaa:	83 c4 10             	add    $0x10,%esp
+  802aad:	85 c0                	test   %eax,%eax
+  802aaf:	78 39                	js     802aea <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  802ab1:	85 ff                	test   %edi,%edi
+  802ab3:	74 0a                	je     802abf <ipc_recv_pages+0x3c>
+  802ab5:	a1 44 57 80 00       	mov    0x805744,%eax
+  802aba:	8b 40 7c             	mov    0x7c(%eax),%eax
+  802abd:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  802abf:	85 f6                	test   %esi,%esi
+  802ac1:	74 0d                	je     802ad0 <ipc_recv_pages+0x4d>
+  802ac3:	a1 44 57 80 00       	mov    0x805744,%eax
+  802ac8:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  802ace:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  802ad0:	a1 44 57 80 00       	mov    0x805744,%eax
+  802ad5:	8b 40 74             	mov    0x74(%eax),%eax
+  802ad8:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  802ada:	a1 44 57 80 00       	mov    0x805744,%eax
+  802adf:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  802ae2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ae5:	5b                   	pop    %ebx
+  802ae6:	5e                   	pop    %esi
+  802ae7:	5f                   	pop    %edi
+  802ae8:	5d                   	pop    %ebp
+  802ae9:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  802aea:	85 ff                	test   %edi,%edi
+  802aec:	74 06                	je     802af4 <ipc_recv_pages+0x71>
+  802aee:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  802af4:	85 f6                	test   %esi,%esi
+  802af6:	74 06                	je     802afe <ipc_recv_pages+0x7b>
+  802af8:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  802afe:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  802b04:	eb dc                	jmp    802ae2 <ipc_recv_pages+0x5f>
+
+00802b06 <ipc_recv>:
+{
+  802b06:	55                   	push   %ebp
+  802b07:	89 e5                	mov    %esp,%ebp
+  802b09:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  802b0c:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  802b13:	ff 75 10             	push   0x10(%ebp)
+  802b16:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b19:	50                   	push   %eax
+  802b1a:	ff 75 0c             	push   0xc(%ebp)
+  802b1d:	ff 75 08             	push   0x8(%ebp)
+  802b20:	e8 5e ff ff ff       	call   802a83 <ipc_recv_pages>
+}
+  802b25:	c9                   	leave
+  802b26:	c3                   	ret
+
+00802b27 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  802b27:	55                   	push   %ebp
+  802b28:	89 e5                	mov    %esp,%ebp
+  802b2a:	57                   	push   %edi
+  802b2b:	56                   	push   %esi
+  802b2c:	53                   	push   %ebx
+  802b2d:	83 ec 0c             	sub    $0xc,%esp
+  802b30:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802b33:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802b36:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  802b39:	89 c3                	mov    %eax,%ebx
+  802b3b:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  802b41:	85 c0                	test   %eax,%eax
+  802b43:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802b48:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  802b4b:	83 ec 0c             	sub    $0xc,%esp
+  802b4e:	ff 75 14             	push   0x14(%ebp)
+  802b51:	ff 75 18             	push   0x18(%ebp)
+  802b54:	53                   	push   %ebx
+  802b55:	56                   	push   %esi
+  802b56:	57                   	push   %edi
+  802b57:	e8 d8 e2 ff ff       	call   800e34 <sys_ipc_try_send>
+  802b5c:	83 c4 20             	add    $0x20,%esp
+  802b5f:	85 c0                	test   %eax,%eax
+  802b61:	79 1e                	jns    802b81 <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  802b63:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802b66:	75 07                	jne    802b6f <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  802b68:	e8 ae df ff ff       	call   800b1b <sys_yield>
+  802b6d:	eb dc                	jmp    802b4b <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  802b6f:	50                   	push   %eax
+  802b70:	68 37 33 80 00       	push   $0x803337
+  802b75:	6a 5c                	push   $0x5c
+  802b77:	68 44 33 80 00       	push   $0x803344
+  802b7c:	e8 bc fe ff ff       	call   802a3d <_panic>
+  }
+}
+  802b81:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b84:	5b                   	pop    %ebx
+  802b85:	5e                   	pop    %esi
+  802b86:	5f                   	pop    %edi
+  802b87:	5d                   	pop    %ebp
+  802b88:	c3                   	ret
+
+00802b89 <ipc_send>:
+{
+  802b89:	55                   	push   %ebp
+  802b8a:	89 e5                	mov    %esp,%ebp
+  802b8c:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  802b8f:	ff 75 14             	push   0x14(%ebp)
+  802b92:	6a 01                	push   $0x1
+  802b94:	ff 75 10             	push   0x10(%ebp)
+  802b97:	ff 75 0c             	push   0xc(%ebp)
+  802b9a:	ff 75 08             	push   0x8(%ebp)
+  802b9d:	e8 85 ff ff ff       	call   802b27 <ipc_send_pages>
+}
+  802ba2:	83 c4 20             	add    $0x20,%esp
+  802ba5:	c9                   	leave
+  802ba6:	c3                   	ret
+
+00802ba7 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802ba7:	55                   	push   %ebp
+  802ba8:	89 e5                	mov    %esp,%ebp
+  802baa:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  802bad:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  802bb2:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802bb5:	c1 e0 04             	shl    $0x4,%eax
+  802bb8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802bbd:	8b 40 50             	mov    0x50(%eax),%eax
+  802bc0:	39 c8                	cmp    %ecx,%eax
+  802bc2:	74 12                	je     802bd6 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  802bc4:	83 c2 01             	add    $0x1,%edx
+  802bc7:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802bcd:	75 e3                	jne    802bb2 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  802bcf:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bd4:	eb 0e                	jmp    802be4 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  802bd6:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802bd9:	c1 e0 04             	shl    $0x4,%eax
+  802bdc:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802be1:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802be4:	5d                   	pop    %ebp
+  802be5:	c3                   	ret
+
+00802be6 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802be6:	55                   	push   %ebp
+  802be7:	89 e5                	mov    %esp,%ebp
+  802be9:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802bec:	89 c2                	mov    %eax,%edx
+  802bee:	c1 ea 16             	shr    $0x16,%edx
+  802bf1:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  802bf8:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802bfd:	f6 c1 01             	test   $0x1,%cl
+  802c00:	74 1c                	je     802c1e <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  802c02:	c1 e8 0c             	shr    $0xc,%eax
+  802c05:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  802c0c:	a8 01                	test   $0x1,%al
+  802c0e:	74 0e                	je     802c1e <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  802c10:	c1 e8 0c             	shr    $0xc,%eax
+  802c13:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802c1a:	ef 
+  802c1b:	0f b7 d2             	movzwl %dx,%edx
+}
+  802c1e:	89 d0                	mov    %edx,%eax
+  802c20:	5d                   	pop    %ebp
+  802c21:	c3                   	ret
+
+00802c22 <udivmod>:
+  802c22:	55                   	push   %ebp
+  802c23:	57                   	push   %edi
+  802c24:	56                   	push   %esi
+  802c25:	53                   	push   %ebx
+  802c26:	83 ec 14             	sub    $0x14,%esp
+  802c29:	8b 74 24 28          	mov    0x28(%esp),%esi
+  802c2d:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  802c31:	89 fb                	mov    %edi,%ebx
+  802c33:	09 f3                	or     %esi,%ebx
+  802c35:	0f 84 88 00 00 00    	je     802cc3 <udivmod+0xa1>
+  802c3b:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802c40:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802c47:	00 
+  802c48:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802c4f:	00 
+  802c50:	89 cd                	mov    %ecx,%ebp
+  802c52:	89 34 24             	mov    %esi,(%esp)
+  802c55:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802c59:	eb 08                	jmp    802c63 <udivmod+0x41>
+  802c5b:	83 ed 01             	sub    $0x1,%ebp
+  802c5e:	83 fd ff             	cmp    $0xffffffff,%ebp
+  802c61:	74 6c                	je     802ccf <udivmod+0xad>
+  802c63:	89 c3                	mov    %eax,%ebx
+  802c65:	89 d6                	mov    %edx,%esi
+  802c67:	89 e9                	mov    %ebp,%ecx
+  802c69:	0f ad f3             	shrd   %cl,%esi,%ebx
+  802c6c:	d3 ee                	shr    %cl,%esi
+  802c6e:	f6 c1 20             	test   $0x20,%cl
+  802c71:	74 04                	je     802c77 <udivmod+0x55>
+  802c73:	89 f3                	mov    %esi,%ebx
+  802c75:	31 f6                	xor    %esi,%esi
+  802c77:	8b 3c 24             	mov    (%esp),%edi
+  802c7a:	39 fb                	cmp    %edi,%ebx
+  802c7c:	89 f7                	mov    %esi,%edi
+  802c7e:	8b 1c 24             	mov    (%esp),%ebx
+  802c81:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802c85:	19 f7                	sbb    %esi,%edi
+  802c87:	72 d2                	jb     802c5b <udivmod+0x39>
+  802c89:	89 f7                	mov    %esi,%edi
+  802c8b:	89 de                	mov    %ebx,%esi
+  802c8d:	89 e9                	mov    %ebp,%ecx
+  802c8f:	0f a5 f7             	shld   %cl,%esi,%edi
+  802c92:	d3 e6                	shl    %cl,%esi
+  802c94:	f6 c1 20             	test   $0x20,%cl
+  802c97:	74 04                	je     802c9d <udivmod+0x7b>
+  802c99:	89 f7                	mov    %esi,%edi
+  802c9b:	31 f6                	xor    %esi,%esi
+  802c9d:	29 f0                	sub    %esi,%eax
+  802c9f:	19 fa                	sbb    %edi,%edx
+  802ca1:	be 01 00 00 00       	mov    $0x1,%esi
+  802ca6:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cab:	0f a5 f7             	shld   %cl,%esi,%edi
+  802cae:	d3 e6                	shl    %cl,%esi
+  802cb0:	f6 c1 20             	test   $0x20,%cl
+  802cb3:	74 04                	je     802cb9 <udivmod+0x97>
+  802cb5:	89 f7                	mov    %esi,%edi
+  802cb7:	31 f6                	xor    %esi,%esi
+  802cb9:	09 74 24 08          	or     %esi,0x8(%esp)
+  802cbd:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802cc1:	eb 98                	jmp    802c5b <udivmod+0x39>
+  802cc3:	89 f0                	mov    %esi,%eax
+  802cc5:	89 fa                	mov    %edi,%edx
+  802cc7:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802ccb:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802ccf:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802cd3:	89 01                	mov    %eax,(%ecx)
+  802cd5:	89 51 04             	mov    %edx,0x4(%ecx)
+  802cd8:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802cdc:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802ce0:	83 c4 14             	add    $0x14,%esp
+  802ce3:	5b                   	pop    %ebx
+  802ce4:	5e                   	pop    %esi
+  802ce5:	5f                   	pop    %edi
+  802ce6:	5d                   	pop    %ebp
+  802ce7:	c3                   	ret
+
+00802ce8 <__udivdi3>:
+  802ce8:	83 ec 18             	sub    $0x18,%esp
+  802ceb:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802cef:	50                   	push   %eax
+  802cf0:	ff 74 24 2c          	push   0x2c(%esp)
+  802cf4:	ff 74 24 2c          	push   0x2c(%esp)
+  802cf8:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802cfc:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802d00:	e8 1d ff ff ff       	call   802c22 <udivmod>
+  802d05:	83 c4 24             	add    $0x24,%esp
+  802d08:	c3                   	ret
+
+00802d09 <__umoddi3>:
+  802d09:	83 ec 18             	sub    $0x18,%esp
+  802d0c:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802d10:	50                   	push   %eax
+  802d11:	ff 74 24 2c          	push   0x2c(%esp)
+  802d15:	ff 74 24 2c          	push   0x2c(%esp)
+  802d19:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802d1d:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802d21:	e8 fc fe ff ff       	call   802c22 <udivmod>
+  802d26:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802d2a:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802d2e:	83 c4 24             	add    $0x24,%esp
+  802d31:	c3                   	ret
+
+00802d32 <__divdi3>:
+  802d32:	56                   	push   %esi
+  802d33:	53                   	push   %ebx
+  802d34:	83 ec 14             	sub    $0x14,%esp
+  802d37:	8b 44 24 20          	mov    0x20(%esp),%eax
+  802d3b:	8b 54 24 24          	mov    0x24(%esp),%edx
+  802d3f:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  802d43:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  802d47:	85 d2                	test   %edx,%edx
+  802d49:	78 18                	js     802d63 <__divdi3+0x31>
+  802d4b:	85 db                	test   %ebx,%ebx
+  802d4d:	78 3e                	js     802d8d <__divdi3+0x5b>
+  802d4f:	83 ec 04             	sub    $0x4,%esp
+  802d52:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802d56:	56                   	push   %esi
+  802d57:	53                   	push   %ebx
+  802d58:	51                   	push   %ecx
+  802d59:	e8 c4 fe ff ff       	call   802c22 <udivmod>
+  802d5e:	83 c4 10             	add    $0x10,%esp
+  802d61:	eb 24                	jmp    802d87 <__divdi3+0x55>
+  802d63:	f7 d8                	neg    %eax
+  802d65:	83 d2 00             	adc    $0x0,%edx
+  802d68:	f7 da                	neg    %edx
+  802d6a:	85 db                	test   %ebx,%ebx
+  802d6c:	78 3a                	js     802da8 <__divdi3+0x76>
+  802d6e:	83 ec 04             	sub    $0x4,%esp
+  802d71:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802d75:	56                   	push   %esi
+  802d76:	53                   	push   %ebx
+  802d77:	51                   	push   %ecx
+  802d78:	e8 a5 fe ff ff       	call   802c22 <udivmod>
+  802d7d:	83 c4 10             	add    $0x10,%esp
+  802d80:	f7 d8                	neg    %eax
+  802d82:	83 d2 00             	adc    $0x0,%edx
+  802d85:	f7 da                	neg    %edx
+  802d87:	83 c4 14             	add    $0x14,%esp
+  802d8a:	5b                   	pop    %ebx
+  802d8b:	5e                   	pop    %esi
+  802d8c:	c3                   	ret
+  802d8d:	83 ec 04             	sub    $0x4,%esp
+  802d90:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802d94:	56                   	push   %esi
+  802d95:	f7 d9                	neg    %ecx
+  802d97:	83 d3 00             	adc    $0x0,%ebx
+  802d9a:	f7 db                	neg    %ebx
+  802d9c:	53                   	push   %ebx
+  802d9d:	51                   	push   %ecx
+  802d9e:	e8 7f fe ff ff       	call   802c22 <udivmod>
+  802da3:	83 c4 10             	add    $0x10,%esp
+  802da6:	eb d8                	jmp    802d80 <__divdi3+0x4e>
+  802da8:	83 ec 04             	sub    $0x4,%esp
+  802dab:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802daf:	56                   	push   %esi
+  802db0:	f7 d9                	neg    %ecx
+  802db2:	83 d3 00             	adc    $0x0,%ebx
+  802db5:	f7 db                	neg    %ebx
+  802db7:	53                   	push   %ebx
+  802db8:	51                   	push   %ecx
+  802db9:	e8 64 fe ff ff       	call   802c22 <udivmod>
+  802dbe:	83 c4 10             	add    $0x10,%esp
+  802dc1:	eb c4                	jmp    802d87 <__divdi3+0x55>
+
+00802dc3 <__moddi3>:
+  802dc3:	55                   	push   %ebp
+  802dc4:	57                   	push   %edi
+  802dc5:	56                   	push   %esi
+  802dc6:	53                   	push   %ebx
+  802dc7:	83 ec 24             	sub    $0x24,%esp
+  802dca:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802dce:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802dd2:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  802dd6:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  802dda:	85 d2                	test   %edx,%edx
+  802ddc:	78 3b                	js     802e19 <__moddi3+0x56>
+  802dde:	83 ec 04             	sub    $0x4,%esp
+  802de1:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  802de5:	56                   	push   %esi
+  802de6:	89 ce                	mov    %ecx,%esi
+  802de8:	f7 de                	neg    %esi
+  802dea:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802dee:	89 de                	mov    %ebx,%esi
+  802df0:	83 d6 00             	adc    $0x0,%esi
+  802df3:	f7 de                	neg    %esi
+  802df5:	89 74 24 14          	mov    %esi,0x14(%esp)
+  802df9:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802dfd:	0f 48 f1             	cmovs  %ecx,%esi
+  802e00:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  802e05:	53                   	push   %ebx
+  802e06:	56                   	push   %esi
+  802e07:	e8 16 fe ff ff       	call   802c22 <udivmod>
+  802e0c:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802e10:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802e14:	83 c4 10             	add    $0x10,%esp
+  802e17:	eb 47                	jmp    802e60 <__moddi3+0x9d>
+  802e19:	f7 d8                	neg    %eax
+  802e1b:	83 d2 00             	adc    $0x0,%edx
+  802e1e:	f7 da                	neg    %edx
+  802e20:	83 ec 04             	sub    $0x4,%esp
+  802e23:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  802e27:	56                   	push   %esi
+  802e28:	89 cf                	mov    %ecx,%edi
+  802e2a:	f7 df                	neg    %edi
+  802e2c:	89 de                	mov    %ebx,%esi
+  802e2e:	83 d6 00             	adc    $0x0,%esi
+  802e31:	f7 de                	neg    %esi
+  802e33:	0f 49 cf             	cmovns %edi,%ecx
+  802e36:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802e3a:	0f 49 de             	cmovns %esi,%ebx
+  802e3d:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  802e41:	ff 74 24 0c          	push   0xc(%esp)
+  802e45:	ff 74 24 0c          	push   0xc(%esp)
+  802e49:	e8 d4 fd ff ff       	call   802c22 <udivmod>
+  802e4e:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802e52:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802e56:	f7 d8                	neg    %eax
+  802e58:	83 d2 00             	adc    $0x0,%edx
+  802e5b:	f7 da                	neg    %edx
+  802e5d:	83 c4 10             	add    $0x10,%esp
+  802e60:	83 c4 24             	add    $0x24,%esp
+  802e63:	5b                   	pop    %ebx
+  802e64:	5e                   	pop    %esi
+  802e65:	5f                   	pop    %edi
+  802e66:	5d                   	pop    %ebp
+  802e67:	c3                   	ret
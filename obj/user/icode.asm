@@ -0,0 +1,7174 @@
+
+obj/user/icode.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 03 01 00 00       	call   800134 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	81 ec 1c 02 00 00    	sub    $0x21c,%esp
+  int fd, n, r;
+  char buf[512+1];
+
+  binaryname = "icode";
+  80003e:	c7 05 00 40 80 00 00 	movl   $0x803700,0x804000
+  800045:	37 80 00 
+
+  cprintf("icode startup\n");
+  800048:	68 06 37 80 00       	push   $0x803706
+  80004d:	e8 2a 02 00 00       	call   80027c <cprintf>
+
+  cprintf("icode: open /motd\n");
+  800052:	c7 04 24 15 37 80 00 	movl   $0x803715,(%esp)
+  800059:	e8 1e 02 00 00       	call   80027c <cprintf>
+  if ((fd = open("/motd", O_RDONLY)) < 0)
+  80005e:	83 c4 08             	add    $0x8,%esp
+  800061:	6a 00                	push   $0x0
+  800063:	68 28 37 80 00       	push   $0x803728
+  800068:	e8 2b 1c 00 00       	call   801c98 <open>
+  80006d:	89 c6                	mov    %eax,%esi
+  80006f:	83 c4 10             	add    $0x10,%esp
+  800072:	85 c0                	test   %eax,%eax
+  800074:	78 18                	js     80008e <umain+0x5b>
+    panic("icode: open /motd: %e", fd);
+
+  cprintf("icode: read /motd\n");
+  800076:	83 ec 0c             	sub    $0xc,%esp
+  800079:	68 51 37 80 00       	push   $0x803751
+  80007e:	e8 f9 01 00 00       	call   80027c <cprintf>
+  while ((n = read(fd, buf, sizeof buf-1)) > 0)
+  800083:	83 c4 10             	add    $0x10,%esp
+  800086:	8d 9d f7 fd ff ff    	lea    -0x209(%ebp),%ebx
+  80008c:	eb 1f                	jmp    8000ad <umain+0x7a>
+    panic("icode: open /motd: %e", fd);
+  80008e:	50                   	push   %eax
+  80008f:	68 2e 37 80 00       	push   $0x80372e
+  800094:	6a 0f                	push   $0xf
+  800096:	68 44 37 80 00       	push   $0x803744
+  80009b:	e8 01 01 00 00       	call   8001a1 <_panic>
+    sys_cputs(buf, n);
+  8000a0:	83 ec 08             	sub    $0x8,%esp
+  8000a3:	50                   	push   %eax
+  8000a4:	53                   	push   %ebx
+  8000a5:	e8 f0 0a 00 00       	call   800b9a <sys_cputs>
+  8000aa:	83 c4 10             	add    $0x10,%esp
+  while ((n = read(fd, buf, sizeof buf-1)) > 0)
+  8000ad:	83 ec 04             	sub    $0x4,%esp
+  8000b0:	68 00 02 00 00       	push   $0x200
+  8000b5:	53                   	push   %ebx
+  8000b6:	56                   	push   %esi
+  8000b7:	e8 b1 13 00 00       	call   80146d <read>
+  8000bc:	83 c4 10             	add    $0x10,%esp
+  8000bf:	85 c0                	test   %eax,%eax
+  8000c1:	7f dd                	jg     8000a0 <umain+0x6d>
+
+  cprintf("icode: close /motd\n");
+  8000c3:	83 ec 0c             	sub    $0xc,%esp
+  8000c6:	68 64 37 80 00       	push   $0x803764
+  8000cb:	e8 ac 01 00 00       	call   80027c <cprintf>
+  close(fd);
+  8000d0:	89 34 24             	mov    %esi,(%esp)
+  8000d3:	e8 0d 12 00 00       	call   8012e5 <close>
+
+  cprintf("icode: spawn /init\n");
+  8000d8:	c7 04 24 78 37 80 00 	movl   $0x803778,(%esp)
+  8000df:	e8 98 01 00 00       	call   80027c <cprintf>
+  if ((r = spawnl("/init", "init", "initarg1", "initarg2", (char*)0)) < 0)
+  8000e4:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  8000eb:	68 8c 37 80 00       	push   $0x80378c
+  8000f0:	68 95 37 80 00       	push   $0x803795
+  8000f5:	68 9f 37 80 00       	push   $0x80379f
+  8000fa:	68 9e 37 80 00       	push   $0x80379e
+  8000ff:	e8 87 27 00 00       	call   80288b <spawnl>
+  800104:	83 c4 20             	add    $0x20,%esp
+  800107:	85 c0                	test   %eax,%eax
+  800109:	78 17                	js     800122 <umain+0xef>
+    panic("icode: spawn /init: %e", r);
+
+  cprintf("icode: exiting\n");
+  80010b:	83 ec 0c             	sub    $0xc,%esp
+  80010e:	68 bb 37 80 00       	push   $0x8037bb
+  800113:	e8 64 01 00 00       	call   80027c <cprintf>
+}
+  800118:	83 c4 10             	add    $0x10,%esp
+  80011b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80011e:	5b                   	pop    %ebx
+  80011f:	5e                   	pop    %esi
+  800120:	5d                   	pop    %ebp
+  800121:	c3                   	ret
+    panic("icode: spawn /init: %e", r);
+  800122:	50                   	push   %eax
+  800123:	68 a4 37 80 00       	push   $0x8037a4
+  800128:	6a 1a                	push   $0x1a
+  80012a:	68 44 37 80 00       	push   $0x803744
+  80012f:	e8 6d 00 00 00       	call   8001a1 <_panic>
+
+00800134 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800134:	55                   	push   %ebp
+  800135:	89 e5                	mov    %esp,%ebp
+  800137:	56                   	push   %esi
+  800138:	53                   	push   %ebx
+  800139:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80013c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  80013f:	c7 05 64 5e 80 00 00 	movl   $0x0,0x805e64
+  800146:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  800149:	e8 ca 0a 00 00       	call   800c18 <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  80014e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800153:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800156:	c1 e0 04             	shl    $0x4,%eax
+  800159:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80015e:	a3 64 5e 80 00       	mov    %eax,0x805e64
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800163:	85 db                	test   %ebx,%ebx
+  800165:	7e 07                	jle    80016e <libmain+0x3a>
+    binaryname = argv[0];
+  800167:	8b 06                	mov    (%esi),%eax
+  800169:	a3 00 40 80 00       	mov    %eax,0x804000
+
+  // call user main routine
+  umain(argc, argv);
+  80016e:	83 ec 08             	sub    $0x8,%esp
+  800171:	56                   	push   %esi
+  800172:	53                   	push   %ebx
+  800173:	e8 bb fe ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  800178:	e8 0a 00 00 00       	call   800187 <exit>
+}
+  80017d:	83 c4 10             	add    $0x10,%esp
+  800180:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800183:	5b                   	pop    %ebx
+  800184:	5e                   	pop    %esi
+  800185:	5d                   	pop    %ebp
+  800186:	c3                   	ret
+
+00800187 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800187:	55                   	push   %ebp
+  800188:	89 e5                	mov    %esp,%ebp
+  80018a:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  80018d:	e8 80 11 00 00       	call   801312 <close_all>
+  sys_env_destroy(0);
+  800192:	83 ec 0c             	sub    $0xc,%esp
+  800195:	6a 00                	push   $0x0
+  800197:	e8 3b 0a 00 00       	call   800bd7 <sys_env_destroy>
+}
+  80019c:	83 c4 10             	add    $0x10,%esp
+  80019f:	c9                   	leave
+  8001a0:	c3                   	ret
+
+008001a1 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8001a1:	55                   	push   %ebp
+  8001a2:	89 e5                	mov    %esp,%ebp
+  8001a4:	56                   	push   %esi
+  8001a5:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  8001a6:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  8001a9:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  8001af:	e8 64 0a 00 00       	call   800c18 <sys_getenvid>
+  8001b4:	83 ec 0c             	sub    $0xc,%esp
+  8001b7:	ff 75 0c             	push   0xc(%ebp)
+  8001ba:	ff 75 08             	push   0x8(%ebp)
+  8001bd:	56                   	push   %esi
+  8001be:	50                   	push   %eax
+  8001bf:	68 d8 37 80 00       	push   $0x8037d8
+  8001c4:	e8 b3 00 00 00       	call   80027c <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  8001c9:	83 c4 18             	add    $0x18,%esp
+  8001cc:	53                   	push   %ebx
+  8001cd:	ff 75 10             	push   0x10(%ebp)
+  8001d0:	e8 56 00 00 00       	call   80022b <vcprintf>
+  cprintf("\n");
+  8001d5:	c7 04 24 9d 3c 80 00 	movl   $0x803c9d,(%esp)
+  8001dc:	e8 9b 00 00 00       	call   80027c <cprintf>
+  8001e1:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  8001e4:	cc                   	int3
+  while (1)
+  8001e5:	eb fd                	jmp    8001e4 <_panic+0x43>
+
+008001e7 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8001e7:	55                   	push   %ebp
+  8001e8:	89 e5                	mov    %esp,%ebp
+  8001ea:	53                   	push   %ebx
+  8001eb:	83 ec 04             	sub    $0x4,%esp
+  8001ee:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  8001f1:	8b 13                	mov    (%ebx),%edx
+  8001f3:	8d 42 01             	lea    0x1(%edx),%eax
+  8001f6:	89 03                	mov    %eax,(%ebx)
+  8001f8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001fb:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  8001ff:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800204:	74 09                	je     80020f <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  800206:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80020a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80020d:	c9                   	leave
+  80020e:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  80020f:	83 ec 08             	sub    $0x8,%esp
+  800212:	68 ff 00 00 00       	push   $0xff
+  800217:	8d 43 08             	lea    0x8(%ebx),%eax
+  80021a:	50                   	push   %eax
+  80021b:	e8 7a 09 00 00       	call   800b9a <sys_cputs>
+    b->idx = 0;
+  800220:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800226:	83 c4 10             	add    $0x10,%esp
+  800229:	eb db                	jmp    800206 <putch+0x1f>
+
+0080022b <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80022b:	55                   	push   %ebp
+  80022c:	89 e5                	mov    %esp,%ebp
+  80022e:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  800234:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80023b:	00 00 00 
+  b.cnt = 0;
+  80023e:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800245:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  800248:	ff 75 0c             	push   0xc(%ebp)
+  80024b:	ff 75 08             	push   0x8(%ebp)
+  80024e:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800254:	50                   	push   %eax
+  800255:	68 e7 01 80 00       	push   $0x8001e7
+  80025a:	e8 14 01 00 00       	call   800373 <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  80025f:	83 c4 08             	add    $0x8,%esp
+  800262:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800268:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80026e:	50                   	push   %eax
+  80026f:	e8 26 09 00 00       	call   800b9a <sys_cputs>
+
+  return b.cnt;
+}
+  800274:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80027a:	c9                   	leave
+  80027b:	c3                   	ret
+
+0080027c <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80027c:	55                   	push   %ebp
+  80027d:	89 e5                	mov    %esp,%ebp
+  80027f:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  800282:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  800285:	50                   	push   %eax
+  800286:	ff 75 08             	push   0x8(%ebp)
+  800289:	e8 9d ff ff ff       	call   80022b <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  80028e:	c9                   	leave
+  80028f:	c3                   	ret
+
+00800290 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  800290:	55                   	push   %ebp
+  800291:	89 e5                	mov    %esp,%ebp
+  800293:	57                   	push   %edi
+  800294:	56                   	push   %esi
+  800295:	53                   	push   %ebx
+  800296:	83 ec 1c             	sub    $0x1c,%esp
+  800299:	89 c7                	mov    %eax,%edi
+  80029b:	89 d6                	mov    %edx,%esi
+  80029d:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002a0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8002a3:	89 d1                	mov    %edx,%ecx
+  8002a5:	89 c2                	mov    %eax,%edx
+  8002a7:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8002aa:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8002ad:	8b 45 10             	mov    0x10(%ebp),%eax
+  8002b0:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  8002b3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8002b6:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8002bd:	39 c2                	cmp    %eax,%edx
+  8002bf:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8002c2:	72 3e                	jb     800302 <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  8002c4:	83 ec 0c             	sub    $0xc,%esp
+  8002c7:	ff 75 18             	push   0x18(%ebp)
+  8002ca:	83 eb 01             	sub    $0x1,%ebx
+  8002cd:	53                   	push   %ebx
+  8002ce:	50                   	push   %eax
+  8002cf:	83 ec 08             	sub    $0x8,%esp
+  8002d2:	ff 75 e4             	push   -0x1c(%ebp)
+  8002d5:	ff 75 e0             	push   -0x20(%ebp)
+  8002d8:	ff 75 dc             	push   -0x24(%ebp)
+  8002db:	ff 75 d8             	push   -0x28(%ebp)
+  8002de:	e8 82 32 00 00       	call   803565 <__udivdi3>
+  8002e3:	83 c4 18             	add    $0x18,%esp
+  8002e6:	52                   	push   %edx
+  8002e7:	50                   	push   %eax
+  8002e8:	89 f2                	mov    %esi,%edx
+  8002ea:	89 f8                	mov    %edi,%eax
+  8002ec:	e8 9f ff ff ff       	call   800290 <printnum>
+  8002f1:	83 c4 20             	add    $0x20,%esp
+  8002f4:	eb 13                	jmp    800309 <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  8002f6:	83 ec 08             	sub    $0x8,%esp
+  8002f9:	56                   	push   %esi
+  8002fa:	ff 75 18             	push   0x18(%ebp)
+  8002fd:	ff d7                	call   *%edi
+  8002ff:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  800302:	83 eb 01             	sub    $0x1,%ebx
+  800305:	85 db                	test   %ebx,%ebx
+  800307:	7f ed                	jg     8002f6 <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  800309:	83 ec 08             	sub    $0x8,%esp
+  80030c:	56                   	push   %esi
+  80030d:	83 ec 04             	sub    $0x4,%esp
+  800310:	ff 75 e4             	push   -0x1c(%ebp)
+  800313:	ff 75 e0             	push   -0x20(%ebp)
+  800316:	ff 75 dc             	push   -0x24(%ebp)
+  800319:	ff 75 d8             	push   -0x28(%ebp)
+  80031c:	e8 65 32 00 00       	call   803586 <__umoddi3>
+  800321:	83 c4 14             	add    $0x14,%esp
+  800324:	0f be 80 fb 37 80 00 	movsbl 0x8037fb(%eax),%eax
+  80032b:	50                   	push   %eax
+  80032c:	ff d7                	call   *%edi
+}
+  80032e:	83 c4 10             	add    $0x10,%esp
+  800331:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800334:	5b                   	pop    %ebx
+  800335:	5e                   	pop    %esi
+  800336:	5f                   	pop    %edi
+  800337:	5d                   	pop    %ebp
+  800338:	c3                   	ret
+
+00800339 <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800339:	55                   	push   %ebp
+  80033a:	89 e5                	mov    %esp,%ebp
+  80033c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  80033f:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  800343:	8b 10                	mov    (%eax),%edx
+  800345:	3b 50 04             	cmp    0x4(%eax),%edx
+  800348:	73 0a                	jae    800354 <sprintputch+0x1b>
+    *b->buf++ = ch;
+  80034a:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80034d:	89 08                	mov    %ecx,(%eax)
+  80034f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800352:	88 02                	mov    %al,(%edx)
+}
+  800354:	5d                   	pop    %ebp
+  800355:	c3                   	ret
+
+00800356 <printfmt>:
+{
+  800356:	55                   	push   %ebp
+  800357:	89 e5                	mov    %esp,%ebp
+  800359:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  80035c:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  80035f:	50                   	push   %eax
+  800360:	ff 75 10             	push   0x10(%ebp)
+  800363:	ff 75 0c             	push   0xc(%ebp)
+  800366:	ff 75 08             	push   0x8(%ebp)
+  800369:	e8 05 00 00 00       	call   800373 <vprintfmt>
+}
+  80036e:	83 c4 10             	add    $0x10,%esp
+  800371:	c9                   	leave
+  800372:	c3                   	ret
+
+00800373 <vprintfmt>:
+{
+  800373:	55                   	push   %ebp
+  800374:	89 e5                	mov    %esp,%ebp
+  800376:	57                   	push   %edi
+  800377:	56                   	push   %esi
+  800378:	53                   	push   %ebx
+  800379:	83 ec 2c             	sub    $0x2c,%esp
+  80037c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80037f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800382:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800385:	eb 0a                	jmp    800391 <vprintfmt+0x1e>
+      putch(ch, putdat);
+  800387:	83 ec 08             	sub    $0x8,%esp
+  80038a:	53                   	push   %ebx
+  80038b:	50                   	push   %eax
+  80038c:	ff d6                	call   *%esi
+  80038e:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  800391:	83 c7 01             	add    $0x1,%edi
+  800394:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800398:	83 f8 25             	cmp    $0x25,%eax
+  80039b:	74 0c                	je     8003a9 <vprintfmt+0x36>
+      if (ch == '\0')
+  80039d:	85 c0                	test   %eax,%eax
+  80039f:	75 e6                	jne    800387 <vprintfmt+0x14>
+}
+  8003a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003a4:	5b                   	pop    %ebx
+  8003a5:	5e                   	pop    %esi
+  8003a6:	5f                   	pop    %edi
+  8003a7:	5d                   	pop    %ebp
+  8003a8:	c3                   	ret
+    padc = ' ';
+  8003a9:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  8003ad:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  8003b4:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  8003bb:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  8003c2:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  8003c7:	8d 47 01             	lea    0x1(%edi),%eax
+  8003ca:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8003cd:	0f b6 17             	movzbl (%edi),%edx
+  8003d0:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8003d3:	3c 55                	cmp    $0x55,%al
+  8003d5:	0f 87 cf 03 00 00    	ja     8007aa <vprintfmt+0x437>
+  8003db:	0f b6 c0             	movzbl %al,%eax
+  8003de:	ff 24 85 40 39 80 00 	jmp    *0x803940(,%eax,4)
+  8003e5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  8003e8:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8003ec:	eb d9                	jmp    8003c7 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  8003ee:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8003f1:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8003f5:	eb d0                	jmp    8003c7 <vprintfmt+0x54>
+  8003f7:	0f b6 d2             	movzbl %dl,%edx
+  8003fa:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  8003fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800402:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  800405:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800408:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  80040c:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  80040f:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800412:	83 f9 09             	cmp    $0x9,%ecx
+  800415:	77 55                	ja     80046c <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  800417:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  80041a:	eb e9                	jmp    800405 <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  80041c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80041f:	8b 00                	mov    (%eax),%eax
+  800421:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800424:	8b 45 14             	mov    0x14(%ebp),%eax
+  800427:	8d 40 04             	lea    0x4(%eax),%eax
+  80042a:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  80042d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  800430:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800434:	79 91                	jns    8003c7 <vprintfmt+0x54>
+        width = precision, precision = -1;
+  800436:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800439:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80043c:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800443:	eb 82                	jmp    8003c7 <vprintfmt+0x54>
+      if (width < 0)
+  800445:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800448:	85 d2                	test   %edx,%edx
+  80044a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80044f:	0f 49 c2             	cmovns %edx,%eax
+  800452:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  800455:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  800458:	e9 6a ff ff ff       	jmp    8003c7 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  80045d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  800460:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  800467:	e9 5b ff ff ff       	jmp    8003c7 <vprintfmt+0x54>
+  80046c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80046f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800472:	eb bc                	jmp    800430 <vprintfmt+0xbd>
+      lflag++;
+  800474:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  800477:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  80047a:	e9 48 ff ff ff       	jmp    8003c7 <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  80047f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800482:	8d 78 04             	lea    0x4(%eax),%edi
+  800485:	83 ec 08             	sub    $0x8,%esp
+  800488:	53                   	push   %ebx
+  800489:	ff 30                	push   (%eax)
+  80048b:	ff d6                	call   *%esi
+      break;
+  80048d:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  800490:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  800493:	e9 b1 02 00 00       	jmp    800749 <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  800498:	8b 45 14             	mov    0x14(%ebp),%eax
+  80049b:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  80049e:	8b 10                	mov    (%eax),%edx
+  8004a0:	89 d0                	mov    %edx,%eax
+  8004a2:	f7 d8                	neg    %eax
+  8004a4:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8004a7:	83 f8 10             	cmp    $0x10,%eax
+  8004aa:	7f 23                	jg     8004cf <vprintfmt+0x15c>
+  8004ac:	8b 14 85 a0 3a 80 00 	mov    0x803aa0(,%eax,4),%edx
+  8004b3:	85 d2                	test   %edx,%edx
+  8004b5:	74 18                	je     8004cf <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  8004b7:	52                   	push   %edx
+  8004b8:	68 ea 3b 80 00       	push   $0x803bea
+  8004bd:	53                   	push   %ebx
+  8004be:	56                   	push   %esi
+  8004bf:	e8 92 fe ff ff       	call   800356 <printfmt>
+  8004c4:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  8004c7:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8004ca:	e9 7a 02 00 00       	jmp    800749 <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  8004cf:	50                   	push   %eax
+  8004d0:	68 13 38 80 00       	push   $0x803813
+  8004d5:	53                   	push   %ebx
+  8004d6:	56                   	push   %esi
+  8004d7:	e8 7a fe ff ff       	call   800356 <printfmt>
+  8004dc:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  8004df:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  8004e2:	e9 62 02 00 00       	jmp    800749 <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  8004e7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004ea:	83 c0 04             	add    $0x4,%eax
+  8004ed:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8004f0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004f3:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  8004f5:	85 c9                	test   %ecx,%ecx
+  8004f7:	b8 0c 38 80 00       	mov    $0x80380c,%eax
+  8004fc:	0f 45 c1             	cmovne %ecx,%eax
+  8004ff:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  800502:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800506:	7e 06                	jle    80050e <vprintfmt+0x19b>
+  800508:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80050c:	75 0b                	jne    800519 <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  80050e:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800511:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800514:	89 75 08             	mov    %esi,0x8(%ebp)
+  800517:	eb 5c                	jmp    800575 <vprintfmt+0x202>
+  800519:	83 ec 08             	sub    $0x8,%esp
+  80051c:	ff 75 d0             	push   -0x30(%ebp)
+  80051f:	ff 75 cc             	push   -0x34(%ebp)
+  800522:	e8 20 03 00 00       	call   800847 <strnlen>
+  800527:	89 c2                	mov    %eax,%edx
+  800529:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80052c:	29 d0                	sub    %edx,%eax
+  80052e:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  800531:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800535:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800538:	89 75 08             	mov    %esi,0x8(%ebp)
+  80053b:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  80053d:	eb 0e                	jmp    80054d <vprintfmt+0x1da>
+          putch(padc, putdat);
+  80053f:	83 ec 08             	sub    $0x8,%esp
+  800542:	53                   	push   %ebx
+  800543:	57                   	push   %edi
+  800544:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800547:	83 ee 01             	sub    $0x1,%esi
+  80054a:	83 c4 10             	add    $0x10,%esp
+  80054d:	85 f6                	test   %esi,%esi
+  80054f:	7f ee                	jg     80053f <vprintfmt+0x1cc>
+  800551:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800554:	8b 75 08             	mov    0x8(%ebp),%esi
+  800557:	85 c0                	test   %eax,%eax
+  800559:	ba 00 00 00 00       	mov    $0x0,%edx
+  80055e:	0f 49 d0             	cmovns %eax,%edx
+  800561:	29 d0                	sub    %edx,%eax
+  800563:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800566:	eb a6                	jmp    80050e <vprintfmt+0x19b>
+          putch(ch, putdat);
+  800568:	83 ec 08             	sub    $0x8,%esp
+  80056b:	53                   	push   %ebx
+  80056c:	52                   	push   %edx
+  80056d:	ff 55 08             	call   *0x8(%ebp)
+  800570:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800573:	89 f1                	mov    %esi,%ecx
+  800575:	8d 71 01             	lea    0x1(%ecx),%esi
+  800578:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80057c:	0f be d0             	movsbl %al,%edx
+  80057f:	85 d2                	test   %edx,%edx
+  800581:	74 28                	je     8005ab <vprintfmt+0x238>
+  800583:	85 ff                	test   %edi,%edi
+  800585:	78 05                	js     80058c <vprintfmt+0x219>
+  800587:	83 ef 01             	sub    $0x1,%edi
+  80058a:	78 30                	js     8005bc <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  80058c:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800590:	74 d6                	je     800568 <vprintfmt+0x1f5>
+  800592:	0f be c0             	movsbl %al,%eax
+  800595:	83 e8 20             	sub    $0x20,%eax
+  800598:	83 f8 5e             	cmp    $0x5e,%eax
+  80059b:	76 cb                	jbe    800568 <vprintfmt+0x1f5>
+          putch('?', putdat);
+  80059d:	83 ec 08             	sub    $0x8,%esp
+  8005a0:	53                   	push   %ebx
+  8005a1:	6a 3f                	push   $0x3f
+  8005a3:	ff 55 08             	call   *0x8(%ebp)
+  8005a6:	83 c4 10             	add    $0x10,%esp
+  8005a9:	eb c8                	jmp    800573 <vprintfmt+0x200>
+  8005ab:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005ae:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8005b1:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8005b4:	01 d0                	add    %edx,%eax
+  8005b6:	29 c8                	sub    %ecx,%eax
+  8005b8:	89 c7                	mov    %eax,%edi
+  8005ba:	eb 13                	jmp    8005cf <vprintfmt+0x25c>
+  8005bc:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005bf:	eb ed                	jmp    8005ae <vprintfmt+0x23b>
+        putch(' ', putdat);
+  8005c1:	83 ec 08             	sub    $0x8,%esp
+  8005c4:	53                   	push   %ebx
+  8005c5:	6a 20                	push   $0x20
+  8005c7:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  8005c9:	83 ef 01             	sub    $0x1,%edi
+  8005cc:	83 c4 10             	add    $0x10,%esp
+  8005cf:	85 ff                	test   %edi,%edi
+  8005d1:	7f ee                	jg     8005c1 <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  8005d3:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8005d6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005d9:	e9 6b 01 00 00       	jmp    800749 <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  8005de:	83 f9 01             	cmp    $0x1,%ecx
+  8005e1:	7f 1f                	jg     800602 <vprintfmt+0x28f>
+  else if (lflag)
+  8005e3:	85 c9                	test   %ecx,%ecx
+  8005e5:	74 67                	je     80064e <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  8005e7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ea:	8b 00                	mov    (%eax),%eax
+  8005ec:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005ef:	89 c1                	mov    %eax,%ecx
+  8005f1:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005f4:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005f7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005fa:	8d 40 04             	lea    0x4(%eax),%eax
+  8005fd:	89 45 14             	mov    %eax,0x14(%ebp)
+  800600:	eb 17                	jmp    800619 <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  800602:	8b 45 14             	mov    0x14(%ebp),%eax
+  800605:	8b 50 04             	mov    0x4(%eax),%edx
+  800608:	8b 00                	mov    (%eax),%eax
+  80060a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80060d:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800610:	8b 45 14             	mov    0x14(%ebp),%eax
+  800613:	8d 40 08             	lea    0x8(%eax),%eax
+  800616:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  800619:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80061c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  80061f:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  800624:	85 c9                	test   %ecx,%ecx
+  800626:	0f 89 03 01 00 00    	jns    80072f <vprintfmt+0x3bc>
+        putch('-', putdat);
+  80062c:	83 ec 08             	sub    $0x8,%esp
+  80062f:	53                   	push   %ebx
+  800630:	6a 2d                	push   $0x2d
+  800632:	ff d6                	call   *%esi
+        num = -(long long)num;
+  800634:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800637:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80063a:	f7 da                	neg    %edx
+  80063c:	83 d1 00             	adc    $0x0,%ecx
+  80063f:	f7 d9                	neg    %ecx
+  800641:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  800644:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800649:	e9 e1 00 00 00       	jmp    80072f <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  80064e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800651:	8b 00                	mov    (%eax),%eax
+  800653:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800656:	89 c1                	mov    %eax,%ecx
+  800658:	c1 f9 1f             	sar    $0x1f,%ecx
+  80065b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80065e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800661:	8d 40 04             	lea    0x4(%eax),%eax
+  800664:	89 45 14             	mov    %eax,0x14(%ebp)
+  800667:	eb b0                	jmp    800619 <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  800669:	83 f9 01             	cmp    $0x1,%ecx
+  80066c:	7f 1e                	jg     80068c <vprintfmt+0x319>
+  else if (lflag)
+  80066e:	85 c9                	test   %ecx,%ecx
+  800670:	74 32                	je     8006a4 <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  800672:	8b 45 14             	mov    0x14(%ebp),%eax
+  800675:	8b 10                	mov    (%eax),%edx
+  800677:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80067c:	8d 40 04             	lea    0x4(%eax),%eax
+  80067f:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800682:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  800687:	e9 a3 00 00 00       	jmp    80072f <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  80068c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068f:	8b 10                	mov    (%eax),%edx
+  800691:	8b 48 04             	mov    0x4(%eax),%ecx
+  800694:	8d 40 08             	lea    0x8(%eax),%eax
+  800697:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  80069a:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  80069f:	e9 8b 00 00 00       	jmp    80072f <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8006a4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a7:	8b 10                	mov    (%eax),%edx
+  8006a9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006ae:	8d 40 04             	lea    0x4(%eax),%eax
+  8006b1:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  8006b4:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  8006b9:	eb 74                	jmp    80072f <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  8006bb:	83 f9 01             	cmp    $0x1,%ecx
+  8006be:	7f 1b                	jg     8006db <vprintfmt+0x368>
+  else if (lflag)
+  8006c0:	85 c9                	test   %ecx,%ecx
+  8006c2:	74 2c                	je     8006f0 <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  8006c4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c7:	8b 10                	mov    (%eax),%edx
+  8006c9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006ce:	8d 40 04             	lea    0x4(%eax),%eax
+  8006d1:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8006d4:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  8006d9:	eb 54                	jmp    80072f <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  8006db:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006de:	8b 10                	mov    (%eax),%edx
+  8006e0:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006e3:	8d 40 08             	lea    0x8(%eax),%eax
+  8006e6:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8006e9:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  8006ee:	eb 3f                	jmp    80072f <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8006f0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f3:	8b 10                	mov    (%eax),%edx
+  8006f5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006fa:	8d 40 04             	lea    0x4(%eax),%eax
+  8006fd:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800700:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  800705:	eb 28                	jmp    80072f <vprintfmt+0x3bc>
+      putch('0', putdat);
+  800707:	83 ec 08             	sub    $0x8,%esp
+  80070a:	53                   	push   %ebx
+  80070b:	6a 30                	push   $0x30
+  80070d:	ff d6                	call   *%esi
+      putch('x', putdat);
+  80070f:	83 c4 08             	add    $0x8,%esp
+  800712:	53                   	push   %ebx
+  800713:	6a 78                	push   $0x78
+  800715:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  800717:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071a:	8b 10                	mov    (%eax),%edx
+  80071c:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  800721:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  800724:	8d 40 04             	lea    0x4(%eax),%eax
+  800727:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  80072a:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  80072f:	83 ec 0c             	sub    $0xc,%esp
+  800732:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800736:	50                   	push   %eax
+  800737:	ff 75 e0             	push   -0x20(%ebp)
+  80073a:	57                   	push   %edi
+  80073b:	51                   	push   %ecx
+  80073c:	52                   	push   %edx
+  80073d:	89 da                	mov    %ebx,%edx
+  80073f:	89 f0                	mov    %esi,%eax
+  800741:	e8 4a fb ff ff       	call   800290 <printnum>
+      break;
+  800746:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  800749:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  80074c:	e9 40 fc ff ff       	jmp    800391 <vprintfmt+0x1e>
+  if (lflag >= 2)
+  800751:	83 f9 01             	cmp    $0x1,%ecx
+  800754:	7f 1b                	jg     800771 <vprintfmt+0x3fe>
+  else if (lflag)
+  800756:	85 c9                	test   %ecx,%ecx
+  800758:	74 2c                	je     800786 <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  80075a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80075d:	8b 10                	mov    (%eax),%edx
+  80075f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800764:	8d 40 04             	lea    0x4(%eax),%eax
+  800767:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  80076a:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  80076f:	eb be                	jmp    80072f <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800771:	8b 45 14             	mov    0x14(%ebp),%eax
+  800774:	8b 10                	mov    (%eax),%edx
+  800776:	8b 48 04             	mov    0x4(%eax),%ecx
+  800779:	8d 40 08             	lea    0x8(%eax),%eax
+  80077c:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  80077f:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  800784:	eb a9                	jmp    80072f <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800786:	8b 45 14             	mov    0x14(%ebp),%eax
+  800789:	8b 10                	mov    (%eax),%edx
+  80078b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800790:	8d 40 04             	lea    0x4(%eax),%eax
+  800793:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800796:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  80079b:	eb 92                	jmp    80072f <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  80079d:	83 ec 08             	sub    $0x8,%esp
+  8007a0:	53                   	push   %ebx
+  8007a1:	6a 25                	push   $0x25
+  8007a3:	ff d6                	call   *%esi
+      break;
+  8007a5:	83 c4 10             	add    $0x10,%esp
+  8007a8:	eb 9f                	jmp    800749 <vprintfmt+0x3d6>
+      putch('%', putdat);
+  8007aa:	83 ec 08             	sub    $0x8,%esp
+  8007ad:	53                   	push   %ebx
+  8007ae:	6a 25                	push   $0x25
+  8007b0:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  8007b2:	83 c4 10             	add    $0x10,%esp
+  8007b5:	89 f8                	mov    %edi,%eax
+  8007b7:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8007bb:	74 05                	je     8007c2 <vprintfmt+0x44f>
+  8007bd:	83 e8 01             	sub    $0x1,%eax
+  8007c0:	eb f5                	jmp    8007b7 <vprintfmt+0x444>
+  8007c2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8007c5:	eb 82                	jmp    800749 <vprintfmt+0x3d6>
+
+008007c7 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8007c7:	55                   	push   %ebp
+  8007c8:	89 e5                	mov    %esp,%ebp
+  8007ca:	83 ec 18             	sub    $0x18,%esp
+  8007cd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007d0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  8007d3:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8007d6:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8007da:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8007dd:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  8007e4:	85 c0                	test   %eax,%eax
+  8007e6:	74 26                	je     80080e <vsnprintf+0x47>
+  8007e8:	85 d2                	test   %edx,%edx
+  8007ea:	7e 22                	jle    80080e <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8007ec:	ff 75 14             	push   0x14(%ebp)
+  8007ef:	ff 75 10             	push   0x10(%ebp)
+  8007f2:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8007f5:	50                   	push   %eax
+  8007f6:	68 39 03 80 00       	push   $0x800339
+  8007fb:	e8 73 fb ff ff       	call   800373 <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800800:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800803:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  800806:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800809:	83 c4 10             	add    $0x10,%esp
+}
+  80080c:	c9                   	leave
+  80080d:	c3                   	ret
+    return -E_INVAL;
+  80080e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800813:	eb f7                	jmp    80080c <vsnprintf+0x45>
+
+00800815 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800815:	55                   	push   %ebp
+  800816:	89 e5                	mov    %esp,%ebp
+  800818:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  80081b:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  80081e:	50                   	push   %eax
+  80081f:	ff 75 10             	push   0x10(%ebp)
+  800822:	ff 75 0c             	push   0xc(%ebp)
+  800825:	ff 75 08             	push   0x8(%ebp)
+  800828:	e8 9a ff ff ff       	call   8007c7 <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  80082d:	c9                   	leave
+  80082e:	c3                   	ret
+
+0080082f <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80082f:	55                   	push   %ebp
+  800830:	89 e5                	mov    %esp,%ebp
+  800832:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  800835:	b8 00 00 00 00       	mov    $0x0,%eax
+  80083a:	eb 03                	jmp    80083f <strlen+0x10>
+    n++;
+  80083c:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  80083f:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800843:	75 f7                	jne    80083c <strlen+0xd>
+  return n;
+}
+  800845:	5d                   	pop    %ebp
+  800846:	c3                   	ret
+
+00800847 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800847:	55                   	push   %ebp
+  800848:	89 e5                	mov    %esp,%ebp
+  80084a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80084d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800850:	b8 00 00 00 00       	mov    $0x0,%eax
+  800855:	eb 03                	jmp    80085a <strnlen+0x13>
+    n++;
+  800857:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80085a:	39 d0                	cmp    %edx,%eax
+  80085c:	74 08                	je     800866 <strnlen+0x1f>
+  80085e:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800862:	75 f3                	jne    800857 <strnlen+0x10>
+  800864:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  800866:	89 d0                	mov    %edx,%eax
+  800868:	5d                   	pop    %ebp
+  800869:	c3                   	ret
+
+0080086a <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80086a:	55                   	push   %ebp
+  80086b:	89 e5                	mov    %esp,%ebp
+  80086d:	53                   	push   %ebx
+  80086e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800871:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  800874:	b8 00 00 00 00       	mov    $0x0,%eax
+  800879:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80087d:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800880:	83 c0 01             	add    $0x1,%eax
+  800883:	84 d2                	test   %dl,%dl
+  800885:	75 f2                	jne    800879 <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  800887:	89 c8                	mov    %ecx,%eax
+  800889:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80088c:	c9                   	leave
+  80088d:	c3                   	ret
+
+0080088e <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80088e:	55                   	push   %ebp
+  80088f:	89 e5                	mov    %esp,%ebp
+  800891:	53                   	push   %ebx
+  800892:	83 ec 10             	sub    $0x10,%esp
+  800895:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  800898:	53                   	push   %ebx
+  800899:	e8 91 ff ff ff       	call   80082f <strlen>
+  80089e:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  8008a1:	ff 75 0c             	push   0xc(%ebp)
+  8008a4:	01 d8                	add    %ebx,%eax
+  8008a6:	50                   	push   %eax
+  8008a7:	e8 be ff ff ff       	call   80086a <strcpy>
+  return dst;
+}
+  8008ac:	89 d8                	mov    %ebx,%eax
+  8008ae:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008b1:	c9                   	leave
+  8008b2:	c3                   	ret
+
+008008b3 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  8008b3:	55                   	push   %ebp
+  8008b4:	89 e5                	mov    %esp,%ebp
+  8008b6:	56                   	push   %esi
+  8008b7:	53                   	push   %ebx
+  8008b8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008bb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  8008be:	89 f3                	mov    %esi,%ebx
+  8008c0:	03 5d 10             	add    0x10(%ebp),%ebx
+  8008c3:	89 f0                	mov    %esi,%eax
+  8008c5:	eb 0f                	jmp    8008d6 <strncpy+0x23>
+    *dst++ = *src;
+  8008c7:	83 c0 01             	add    $0x1,%eax
+  8008ca:	0f b6 0a             	movzbl (%edx),%ecx
+  8008cd:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  8008d0:	80 f9 01             	cmp    $0x1,%cl
+  8008d3:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  8008d6:	39 d8                	cmp    %ebx,%eax
+  8008d8:	75 ed                	jne    8008c7 <strncpy+0x14>
+  }
+  return ret;
+}
+  8008da:	89 f0                	mov    %esi,%eax
+  8008dc:	5b                   	pop    %ebx
+  8008dd:	5e                   	pop    %esi
+  8008de:	5d                   	pop    %ebp
+  8008df:	c3                   	ret
+
+008008e0 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8008e0:	55                   	push   %ebp
+  8008e1:	89 e5                	mov    %esp,%ebp
+  8008e3:	56                   	push   %esi
+  8008e4:	53                   	push   %ebx
+  8008e5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008e8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008eb:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  8008ee:	89 f0                	mov    %esi,%eax
+  8008f0:	85 d2                	test   %edx,%edx
+  8008f2:	74 21                	je     800915 <strlcpy+0x35>
+  8008f4:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8008f8:	89 f2                	mov    %esi,%edx
+  8008fa:	eb 09                	jmp    800905 <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  8008fc:	83 c1 01             	add    $0x1,%ecx
+  8008ff:	83 c2 01             	add    $0x1,%edx
+  800902:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  800905:	39 c2                	cmp    %eax,%edx
+  800907:	74 09                	je     800912 <strlcpy+0x32>
+  800909:	0f b6 19             	movzbl (%ecx),%ebx
+  80090c:	84 db                	test   %bl,%bl
+  80090e:	75 ec                	jne    8008fc <strlcpy+0x1c>
+  800910:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  800912:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  800915:	29 f0                	sub    %esi,%eax
+}
+  800917:	5b                   	pop    %ebx
+  800918:	5e                   	pop    %esi
+  800919:	5d                   	pop    %ebp
+  80091a:	c3                   	ret
+
+0080091b <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80091b:	55                   	push   %ebp
+  80091c:	89 e5                	mov    %esp,%ebp
+  80091e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800921:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  800924:	eb 06                	jmp    80092c <strcmp+0x11>
+    p++, q++;
+  800926:	83 c1 01             	add    $0x1,%ecx
+  800929:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  80092c:	0f b6 01             	movzbl (%ecx),%eax
+  80092f:	84 c0                	test   %al,%al
+  800931:	74 04                	je     800937 <strcmp+0x1c>
+  800933:	3a 02                	cmp    (%edx),%al
+  800935:	74 ef                	je     800926 <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  800937:	0f b6 c0             	movzbl %al,%eax
+  80093a:	0f b6 12             	movzbl (%edx),%edx
+  80093d:	29 d0                	sub    %edx,%eax
+}
+  80093f:	5d                   	pop    %ebp
+  800940:	c3                   	ret
+
+00800941 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800941:	55                   	push   %ebp
+  800942:	89 e5                	mov    %esp,%ebp
+  800944:	53                   	push   %ebx
+  800945:	8b 45 08             	mov    0x8(%ebp),%eax
+  800948:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80094b:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  80094e:	eb 09                	jmp    800959 <strncmp+0x18>
+    n--, p++, q++;
+  800950:	83 ea 01             	sub    $0x1,%edx
+  800953:	83 c0 01             	add    $0x1,%eax
+  800956:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  800959:	85 d2                	test   %edx,%edx
+  80095b:	74 18                	je     800975 <strncmp+0x34>
+  80095d:	0f b6 18             	movzbl (%eax),%ebx
+  800960:	84 db                	test   %bl,%bl
+  800962:	74 04                	je     800968 <strncmp+0x27>
+  800964:	3a 19                	cmp    (%ecx),%bl
+  800966:	74 e8                	je     800950 <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800968:	0f b6 00             	movzbl (%eax),%eax
+  80096b:	0f b6 11             	movzbl (%ecx),%edx
+  80096e:	29 d0                	sub    %edx,%eax
+}
+  800970:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800973:	c9                   	leave
+  800974:	c3                   	ret
+    return 0;
+  800975:	b8 00 00 00 00       	mov    $0x0,%eax
+  80097a:	eb f4                	jmp    800970 <strncmp+0x2f>
+
+0080097c <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80097c:	55                   	push   %ebp
+  80097d:	89 e5                	mov    %esp,%ebp
+  80097f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800982:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800986:	eb 03                	jmp    80098b <strchr+0xf>
+  800988:	83 c0 01             	add    $0x1,%eax
+  80098b:	0f b6 10             	movzbl (%eax),%edx
+  80098e:	84 d2                	test   %dl,%dl
+  800990:	74 06                	je     800998 <strchr+0x1c>
+    if (*s == c)
+  800992:	38 ca                	cmp    %cl,%dl
+  800994:	75 f2                	jne    800988 <strchr+0xc>
+  800996:	eb 05                	jmp    80099d <strchr+0x21>
+      return (char*)s;
+  return 0;
+  800998:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80099d:	5d                   	pop    %ebp
+  80099e:	c3                   	ret
+
+0080099f <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80099f:	55                   	push   %ebp
+  8009a0:	89 e5                	mov    %esp,%ebp
+  8009a2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009a5:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  8009a9:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  8009ac:	38 ca                	cmp    %cl,%dl
+  8009ae:	74 09                	je     8009b9 <strfind+0x1a>
+  8009b0:	84 d2                	test   %dl,%dl
+  8009b2:	74 05                	je     8009b9 <strfind+0x1a>
+  for (; *s; s++)
+  8009b4:	83 c0 01             	add    $0x1,%eax
+  8009b7:	eb f0                	jmp    8009a9 <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  8009b9:	5d                   	pop    %ebp
+  8009ba:	c3                   	ret
+
+008009bb <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8009bb:	55                   	push   %ebp
+  8009bc:	89 e5                	mov    %esp,%ebp
+  8009be:	57                   	push   %edi
+  8009bf:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8009c2:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  8009c5:	85 c9                	test   %ecx,%ecx
+  8009c7:	74 20                	je     8009e9 <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  8009c9:	89 f8                	mov    %edi,%eax
+  8009cb:	09 c8                	or     %ecx,%eax
+  8009cd:	a8 03                	test   $0x3,%al
+  8009cf:	75 12                	jne    8009e3 <memset+0x28>
+    c &= 0xFF;
+  8009d1:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8009d5:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  8009db:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  8009de:	fc                   	cld
+  8009df:	f3 ab                	rep stos %eax,%es:(%edi)
+  8009e1:	eb 06                	jmp    8009e9 <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  8009e3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8009e6:	fc                   	cld
+  8009e7:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  8009e9:	89 f8                	mov    %edi,%eax
+  8009eb:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8009ee:	c9                   	leave
+  8009ef:	c3                   	ret
+
+008009f0 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8009f0:	55                   	push   %ebp
+  8009f1:	89 e5                	mov    %esp,%ebp
+  8009f3:	57                   	push   %edi
+  8009f4:	56                   	push   %esi
+  8009f5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009f8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8009fb:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  8009fe:	39 c6                	cmp    %eax,%esi
+  800a00:	73 32                	jae    800a34 <memmove+0x44>
+  800a02:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a05:	39 d0                	cmp    %edx,%eax
+  800a07:	73 2b                	jae    800a34 <memmove+0x44>
+    s += n;
+    d += n;
+  800a09:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a0c:	89 d6                	mov    %edx,%esi
+  800a0e:	09 fe                	or     %edi,%esi
+  800a10:	09 ce                	or     %ecx,%esi
+  800a12:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a18:	75 0e                	jne    800a28 <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a1a:	83 ef 04             	sub    $0x4,%edi
+  800a1d:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a20:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  800a23:	fd                   	std
+  800a24:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a26:	eb 09                	jmp    800a31 <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a28:	83 ef 01             	sub    $0x1,%edi
+  800a2b:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  800a2e:	fd                   	std
+  800a2f:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  800a31:	fc                   	cld
+  800a32:	eb 1a                	jmp    800a4e <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a34:	89 f2                	mov    %esi,%edx
+  800a36:	09 c2                	or     %eax,%edx
+  800a38:	09 ca                	or     %ecx,%edx
+  800a3a:	f6 c2 03             	test   $0x3,%dl
+  800a3d:	75 0a                	jne    800a49 <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a3f:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  800a42:	89 c7                	mov    %eax,%edi
+  800a44:	fc                   	cld
+  800a45:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a47:	eb 05                	jmp    800a4e <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  800a49:	89 c7                	mov    %eax,%edi
+  800a4b:	fc                   	cld
+  800a4c:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  800a4e:	5e                   	pop    %esi
+  800a4f:	5f                   	pop    %edi
+  800a50:	5d                   	pop    %ebp
+  800a51:	c3                   	ret
+
+00800a52 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a52:	55                   	push   %ebp
+  800a53:	89 e5                	mov    %esp,%ebp
+  800a55:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  800a58:	ff 75 10             	push   0x10(%ebp)
+  800a5b:	ff 75 0c             	push   0xc(%ebp)
+  800a5e:	ff 75 08             	push   0x8(%ebp)
+  800a61:	e8 8a ff ff ff       	call   8009f0 <memmove>
+}
+  800a66:	c9                   	leave
+  800a67:	c3                   	ret
+
+00800a68 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a68:	55                   	push   %ebp
+  800a69:	89 e5                	mov    %esp,%ebp
+  800a6b:	56                   	push   %esi
+  800a6c:	53                   	push   %ebx
+  800a6d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a70:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  800a73:	89 c6                	mov    %eax,%esi
+  800a75:	03 75 10             	add    0x10(%ebp),%esi
+  800a78:	eb 06                	jmp    800a80 <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  800a7a:	83 c0 01             	add    $0x1,%eax
+  800a7d:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  800a80:	39 f0                	cmp    %esi,%eax
+  800a82:	74 14                	je     800a98 <memcmp+0x30>
+    if (*s1 != *s2)
+  800a84:	0f b6 08             	movzbl (%eax),%ecx
+  800a87:	0f b6 1a             	movzbl (%edx),%ebx
+  800a8a:	38 d9                	cmp    %bl,%cl
+  800a8c:	74 ec                	je     800a7a <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  800a8e:	0f b6 c1             	movzbl %cl,%eax
+  800a91:	0f b6 db             	movzbl %bl,%ebx
+  800a94:	29 d8                	sub    %ebx,%eax
+  800a96:	eb 05                	jmp    800a9d <memcmp+0x35>
+  }
+
+  return 0;
+  800a98:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a9d:	5b                   	pop    %ebx
+  800a9e:	5e                   	pop    %esi
+  800a9f:	5d                   	pop    %ebp
+  800aa0:	c3                   	ret
+
+00800aa1 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800aa1:	55                   	push   %ebp
+  800aa2:	89 e5                	mov    %esp,%ebp
+  800aa4:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aa7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  800aaa:	89 c2                	mov    %eax,%edx
+  800aac:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  800aaf:	eb 03                	jmp    800ab4 <memfind+0x13>
+  800ab1:	83 c0 01             	add    $0x1,%eax
+  800ab4:	39 d0                	cmp    %edx,%eax
+  800ab6:	73 04                	jae    800abc <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  800ab8:	38 08                	cmp    %cl,(%eax)
+  800aba:	75 f5                	jne    800ab1 <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  800abc:	5d                   	pop    %ebp
+  800abd:	c3                   	ret
+
+00800abe <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800abe:	55                   	push   %ebp
+  800abf:	89 e5                	mov    %esp,%ebp
+  800ac1:	57                   	push   %edi
+  800ac2:	56                   	push   %esi
+  800ac3:	53                   	push   %ebx
+  800ac4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ac7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  800aca:	eb 03                	jmp    800acf <strtol+0x11>
+    s++;
+  800acc:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  800acf:	0f b6 02             	movzbl (%edx),%eax
+  800ad2:	3c 20                	cmp    $0x20,%al
+  800ad4:	74 f6                	je     800acc <strtol+0xe>
+  800ad6:	3c 09                	cmp    $0x9,%al
+  800ad8:	74 f2                	je     800acc <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  800ada:	3c 2b                	cmp    $0x2b,%al
+  800adc:	74 2a                	je     800b08 <strtol+0x4a>
+  int neg = 0;
+  800ade:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  800ae3:	3c 2d                	cmp    $0x2d,%al
+  800ae5:	74 2b                	je     800b12 <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ae7:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800aed:	75 0f                	jne    800afe <strtol+0x40>
+  800aef:	80 3a 30             	cmpb   $0x30,(%edx)
+  800af2:	74 28                	je     800b1c <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  800af4:	85 db                	test   %ebx,%ebx
+  800af6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800afb:	0f 44 d8             	cmove  %eax,%ebx
+  800afe:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b03:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b06:	eb 46                	jmp    800b4e <strtol+0x90>
+    s++;
+  800b08:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  800b0b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b10:	eb d5                	jmp    800ae7 <strtol+0x29>
+    s++, neg = 1;
+  800b12:	83 c2 01             	add    $0x1,%edx
+  800b15:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b1a:	eb cb                	jmp    800ae7 <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b1c:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800b20:	74 0e                	je     800b30 <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  800b22:	85 db                	test   %ebx,%ebx
+  800b24:	75 d8                	jne    800afe <strtol+0x40>
+    s++, base = 8;
+  800b26:	83 c2 01             	add    $0x1,%edx
+  800b29:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800b2e:	eb ce                	jmp    800afe <strtol+0x40>
+    s += 2, base = 16;
+  800b30:	83 c2 02             	add    $0x2,%edx
+  800b33:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800b38:	eb c4                	jmp    800afe <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  800b3a:	0f be c0             	movsbl %al,%eax
+  800b3d:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  800b40:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800b43:	7d 3a                	jge    800b7f <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  800b45:	83 c2 01             	add    $0x1,%edx
+  800b48:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800b4c:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  800b4e:	0f b6 02             	movzbl (%edx),%eax
+  800b51:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800b54:	89 f3                	mov    %esi,%ebx
+  800b56:	80 fb 09             	cmp    $0x9,%bl
+  800b59:	76 df                	jbe    800b3a <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  800b5b:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800b5e:	89 f3                	mov    %esi,%ebx
+  800b60:	80 fb 19             	cmp    $0x19,%bl
+  800b63:	77 08                	ja     800b6d <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  800b65:	0f be c0             	movsbl %al,%eax
+  800b68:	83 e8 57             	sub    $0x57,%eax
+  800b6b:	eb d3                	jmp    800b40 <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  800b6d:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800b70:	89 f3                	mov    %esi,%ebx
+  800b72:	80 fb 19             	cmp    $0x19,%bl
+  800b75:	77 08                	ja     800b7f <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  800b77:	0f be c0             	movsbl %al,%eax
+  800b7a:	83 e8 37             	sub    $0x37,%eax
+  800b7d:	eb c1                	jmp    800b40 <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  800b7f:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b83:	74 05                	je     800b8a <strtol+0xcc>
+    *endptr = (char*)s;
+  800b85:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b88:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  800b8a:	89 c8                	mov    %ecx,%eax
+  800b8c:	f7 d8                	neg    %eax
+  800b8e:	85 ff                	test   %edi,%edi
+  800b90:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b93:	89 c8                	mov    %ecx,%eax
+  800b95:	5b                   	pop    %ebx
+  800b96:	5e                   	pop    %esi
+  800b97:	5f                   	pop    %edi
+  800b98:	5d                   	pop    %ebp
+  800b99:	c3                   	ret
+
+00800b9a <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800b9a:	55                   	push   %ebp
+  800b9b:	89 e5                	mov    %esp,%ebp
+  800b9d:	57                   	push   %edi
+  800b9e:	56                   	push   %esi
+  800b9f:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800ba0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ba5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ba8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bab:	89 c3                	mov    %eax,%ebx
+  800bad:	89 c7                	mov    %eax,%edi
+  800baf:	89 c6                	mov    %eax,%esi
+  800bb1:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800bb3:	5b                   	pop    %ebx
+  800bb4:	5e                   	pop    %esi
+  800bb5:	5f                   	pop    %edi
+  800bb6:	5d                   	pop    %ebp
+  800bb7:	c3                   	ret
+
+00800bb8 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800bb8:	55                   	push   %ebp
+  800bb9:	89 e5                	mov    %esp,%ebp
+  800bbb:	57                   	push   %edi
+  800bbc:	56                   	push   %esi
+  800bbd:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800bbe:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bc3:	b8 01 00 00 00       	mov    $0x1,%eax
+  800bc8:	89 d1                	mov    %edx,%ecx
+  800bca:	89 d3                	mov    %edx,%ebx
+  800bcc:	89 d7                	mov    %edx,%edi
+  800bce:	89 d6                	mov    %edx,%esi
+  800bd0:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800bd2:	5b                   	pop    %ebx
+  800bd3:	5e                   	pop    %esi
+  800bd4:	5f                   	pop    %edi
+  800bd5:	5d                   	pop    %ebp
+  800bd6:	c3                   	ret
+
+00800bd7 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800bd7:	55                   	push   %ebp
+  800bd8:	89 e5                	mov    %esp,%ebp
+  800bda:	57                   	push   %edi
+  800bdb:	56                   	push   %esi
+  800bdc:	53                   	push   %ebx
+  800bdd:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800be0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800be5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800be8:	b8 03 00 00 00       	mov    $0x3,%eax
+  800bed:	89 cb                	mov    %ecx,%ebx
+  800bef:	89 cf                	mov    %ecx,%edi
+  800bf1:	89 ce                	mov    %ecx,%esi
+  800bf3:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800bf5:	85 c0                	test   %eax,%eax
+  800bf7:	7f 08                	jg     800c01 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800bf9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bfc:	5b                   	pop    %ebx
+  800bfd:	5e                   	pop    %esi
+  800bfe:	5f                   	pop    %edi
+  800bff:	5d                   	pop    %ebp
+  800c00:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c01:	83 ec 0c             	sub    $0xc,%esp
+  800c04:	50                   	push   %eax
+  800c05:	6a 03                	push   $0x3
+  800c07:	68 03 3b 80 00       	push   $0x803b03
+  800c0c:	6a 23                	push   $0x23
+  800c0e:	68 20 3b 80 00       	push   $0x803b20
+  800c13:	e8 89 f5 ff ff       	call   8001a1 <_panic>
+
+00800c18 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800c18:	55                   	push   %ebp
+  800c19:	89 e5                	mov    %esp,%ebp
+  800c1b:	57                   	push   %edi
+  800c1c:	56                   	push   %esi
+  800c1d:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800c1e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c23:	b8 02 00 00 00       	mov    $0x2,%eax
+  800c28:	89 d1                	mov    %edx,%ecx
+  800c2a:	89 d3                	mov    %edx,%ebx
+  800c2c:	89 d7                	mov    %edx,%edi
+  800c2e:	89 d6                	mov    %edx,%esi
+  800c30:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800c32:	5b                   	pop    %ebx
+  800c33:	5e                   	pop    %esi
+  800c34:	5f                   	pop    %edi
+  800c35:	5d                   	pop    %ebp
+  800c36:	c3                   	ret
+
+00800c37 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800c37:	55                   	push   %ebp
+  800c38:	89 e5                	mov    %esp,%ebp
+  800c3a:	57                   	push   %edi
+  800c3b:	56                   	push   %esi
+  800c3c:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800c3d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c42:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800c47:	89 d1                	mov    %edx,%ecx
+  800c49:	89 d3                	mov    %edx,%ebx
+  800c4b:	89 d7                	mov    %edx,%edi
+  800c4d:	89 d6                	mov    %edx,%esi
+  800c4f:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800c51:	5b                   	pop    %ebx
+  800c52:	5e                   	pop    %esi
+  800c53:	5f                   	pop    %edi
+  800c54:	5d                   	pop    %ebp
+  800c55:	c3                   	ret
+
+00800c56 <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  800c56:	55                   	push   %ebp
+  800c57:	89 e5                	mov    %esp,%ebp
+  800c59:	57                   	push   %edi
+  800c5a:	56                   	push   %esi
+  800c5b:	53                   	push   %ebx
+  800c5c:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  800c5f:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  800c63:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c68:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c6b:	b8 14 00 00 00       	mov    $0x14,%eax
+  800c70:	89 df                	mov    %ebx,%edi
+  800c72:	89 de                	mov    %ebx,%esi
+  800c74:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c76:	85 c0                	test   %eax,%eax
+  800c78:	7f 08                	jg     800c82 <sys_env_set_cow+0x2c>
+}
+  800c7a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c7d:	5b                   	pop    %ebx
+  800c7e:	5e                   	pop    %esi
+  800c7f:	5f                   	pop    %edi
+  800c80:	5d                   	pop    %ebp
+  800c81:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c82:	83 ec 0c             	sub    $0xc,%esp
+  800c85:	50                   	push   %eax
+  800c86:	6a 14                	push   $0x14
+  800c88:	68 03 3b 80 00       	push   $0x803b03
+  800c8d:	6a 23                	push   $0x23
+  800c8f:	68 20 3b 80 00       	push   $0x803b20
+  800c94:	e8 08 f5 ff ff       	call   8001a1 <_panic>
+
+00800c99 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800c99:	55                   	push   %ebp
+  800c9a:	89 e5                	mov    %esp,%ebp
+  800c9c:	57                   	push   %edi
+  800c9d:	56                   	push   %esi
+  800c9e:	53                   	push   %ebx
+  800c9f:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800ca2:	be 00 00 00 00       	mov    $0x0,%esi
+  800ca7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800caa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cad:	b8 04 00 00 00       	mov    $0x4,%eax
+  800cb2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cb5:	89 f7                	mov    %esi,%edi
+  800cb7:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800cb9:	85 c0                	test   %eax,%eax
+  800cbb:	7f 08                	jg     800cc5 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  800cbd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cc0:	5b                   	pop    %ebx
+  800cc1:	5e                   	pop    %esi
+  800cc2:	5f                   	pop    %edi
+  800cc3:	5d                   	pop    %ebp
+  800cc4:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800cc5:	83 ec 0c             	sub    $0xc,%esp
+  800cc8:	50                   	push   %eax
+  800cc9:	6a 04                	push   $0x4
+  800ccb:	68 03 3b 80 00       	push   $0x803b03
+  800cd0:	6a 23                	push   $0x23
+  800cd2:	68 20 3b 80 00       	push   $0x803b20
+  800cd7:	e8 c5 f4 ff ff       	call   8001a1 <_panic>
+
+00800cdc <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800cdc:	55                   	push   %ebp
+  800cdd:	89 e5                	mov    %esp,%ebp
+  800cdf:	57                   	push   %edi
+  800ce0:	56                   	push   %esi
+  800ce1:	53                   	push   %ebx
+  800ce2:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800ce5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ce8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ceb:	b8 05 00 00 00       	mov    $0x5,%eax
+  800cf0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cf3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800cf6:	8b 75 18             	mov    0x18(%ebp),%esi
+  800cf9:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800cfb:	85 c0                	test   %eax,%eax
+  800cfd:	7f 08                	jg     800d07 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  800cff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d02:	5b                   	pop    %ebx
+  800d03:	5e                   	pop    %esi
+  800d04:	5f                   	pop    %edi
+  800d05:	5d                   	pop    %ebp
+  800d06:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d07:	83 ec 0c             	sub    $0xc,%esp
+  800d0a:	50                   	push   %eax
+  800d0b:	6a 05                	push   $0x5
+  800d0d:	68 03 3b 80 00       	push   $0x803b03
+  800d12:	6a 23                	push   $0x23
+  800d14:	68 20 3b 80 00       	push   $0x803b20
+  800d19:	e8 83 f4 ff ff       	call   8001a1 <_panic>
+
+00800d1e <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800d1e:	55                   	push   %ebp
+  800d1f:	89 e5                	mov    %esp,%ebp
+  800d21:	57                   	push   %edi
+  800d22:	56                   	push   %esi
+  800d23:	53                   	push   %ebx
+  800d24:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800d27:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d2c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d2f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d32:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d37:	89 df                	mov    %ebx,%edi
+  800d39:	89 de                	mov    %ebx,%esi
+  800d3b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d3d:	85 c0                	test   %eax,%eax
+  800d3f:	7f 08                	jg     800d49 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  800d41:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d44:	5b                   	pop    %ebx
+  800d45:	5e                   	pop    %esi
+  800d46:	5f                   	pop    %edi
+  800d47:	5d                   	pop    %ebp
+  800d48:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d49:	83 ec 0c             	sub    $0xc,%esp
+  800d4c:	50                   	push   %eax
+  800d4d:	6a 06                	push   $0x6
+  800d4f:	68 03 3b 80 00       	push   $0x803b03
+  800d54:	6a 23                	push   $0x23
+  800d56:	68 20 3b 80 00       	push   $0x803b20
+  800d5b:	e8 41 f4 ff ff       	call   8001a1 <_panic>
+
+00800d60 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  800d60:	55                   	push   %ebp
+  800d61:	89 e5                	mov    %esp,%ebp
+  800d63:	57                   	push   %edi
+  800d64:	56                   	push   %esi
+  800d65:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d66:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d69:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d6c:	b8 11 00 00 00       	mov    $0x11,%eax
+  800d71:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d74:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d77:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d7a:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  800d7c:	5b                   	pop    %ebx
+  800d7d:	5e                   	pop    %esi
+  800d7e:	5f                   	pop    %edi
+  800d7f:	5d                   	pop    %ebp
+  800d80:	c3                   	ret
+
+00800d81 <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  800d81:	55                   	push   %ebp
+  800d82:	89 e5                	mov    %esp,%ebp
+  800d84:	57                   	push   %edi
+  800d85:	56                   	push   %esi
+  800d86:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d87:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d8a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d8d:	b8 12 00 00 00       	mov    $0x12,%eax
+  800d92:	be 00 00 00 00       	mov    $0x0,%esi
+  800d97:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d9a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d9d:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  800d9f:	5b                   	pop    %ebx
+  800da0:	5e                   	pop    %esi
+  800da1:	5f                   	pop    %edi
+  800da2:	5d                   	pop    %ebp
+  800da3:	c3                   	ret
+
+00800da4 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  800da4:	55                   	push   %ebp
+  800da5:	89 e5                	mov    %esp,%ebp
+  800da7:	57                   	push   %edi
+  800da8:	56                   	push   %esi
+  800da9:	53                   	push   %ebx
+  800daa:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800dad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800db2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800db5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800db8:	b8 16 00 00 00       	mov    $0x16,%eax
+  800dbd:	89 df                	mov    %ebx,%edi
+  800dbf:	89 de                	mov    %ebx,%esi
+  800dc1:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800dc3:	85 c0                	test   %eax,%eax
+  800dc5:	7f 08                	jg     800dcf <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  800dc7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dca:	5b                   	pop    %ebx
+  800dcb:	5e                   	pop    %esi
+  800dcc:	5f                   	pop    %edi
+  800dcd:	5d                   	pop    %ebp
+  800dce:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800dcf:	83 ec 0c             	sub    $0xc,%esp
+  800dd2:	50                   	push   %eax
+  800dd3:	6a 16                	push   $0x16
+  800dd5:	68 03 3b 80 00       	push   $0x803b03
+  800dda:	6a 23                	push   $0x23
+  800ddc:	68 20 3b 80 00       	push   $0x803b20
+  800de1:	e8 bb f3 ff ff       	call   8001a1 <_panic>
+
+00800de6 <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  800de6:	55                   	push   %ebp
+  800de7:	89 e5                	mov    %esp,%ebp
+  800de9:	57                   	push   %edi
+  800dea:	56                   	push   %esi
+  800deb:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800dec:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800df1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800df4:	b8 17 00 00 00       	mov    $0x17,%eax
+  800df9:	89 cb                	mov    %ecx,%ebx
+  800dfb:	89 cf                	mov    %ecx,%edi
+  800dfd:	89 ce                	mov    %ecx,%esi
+  800dff:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  800e01:	5b                   	pop    %ebx
+  800e02:	5e                   	pop    %esi
+  800e03:	5f                   	pop    %edi
+  800e04:	5d                   	pop    %ebp
+  800e05:	c3                   	ret
+
+00800e06 <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  800e06:	55                   	push   %ebp
+  800e07:	89 e5                	mov    %esp,%ebp
+  800e09:	57                   	push   %edi
+  800e0a:	56                   	push   %esi
+  800e0b:	53                   	push   %ebx
+  800e0c:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e0f:	be 00 00 00 00       	mov    $0x0,%esi
+  800e14:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e17:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e1a:	b8 18 00 00 00       	mov    $0x18,%eax
+  800e1f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e22:	89 f7                	mov    %esi,%edi
+  800e24:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e26:	85 c0                	test   %eax,%eax
+  800e28:	7f 08                	jg     800e32 <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  800e2a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e2d:	5b                   	pop    %ebx
+  800e2e:	5e                   	pop    %esi
+  800e2f:	5f                   	pop    %edi
+  800e30:	5d                   	pop    %ebp
+  800e31:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e32:	83 ec 0c             	sub    $0xc,%esp
+  800e35:	50                   	push   %eax
+  800e36:	6a 18                	push   $0x18
+  800e38:	68 03 3b 80 00       	push   $0x803b03
+  800e3d:	6a 23                	push   $0x23
+  800e3f:	68 20 3b 80 00       	push   $0x803b20
+  800e44:	e8 58 f3 ff ff       	call   8001a1 <_panic>
+
+00800e49 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  800e49:	55                   	push   %ebp
+  800e4a:	89 e5                	mov    %esp,%ebp
+  800e4c:	57                   	push   %edi
+  800e4d:	56                   	push   %esi
+  800e4e:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e4f:	be 00 00 00 00       	mov    $0x0,%esi
+  800e54:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e57:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e5a:	b8 19 00 00 00       	mov    $0x19,%eax
+  800e5f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e62:	89 f7                	mov    %esi,%edi
+  800e64:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  800e66:	5b                   	pop    %ebx
+  800e67:	5e                   	pop    %esi
+  800e68:	5f                   	pop    %edi
+  800e69:	5d                   	pop    %ebp
+  800e6a:	c3                   	ret
+
+00800e6b <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  800e6b:	55                   	push   %ebp
+  800e6c:	89 e5                	mov    %esp,%ebp
+  800e6e:	57                   	push   %edi
+  800e6f:	56                   	push   %esi
+  800e70:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e71:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e76:	b8 15 00 00 00       	mov    $0x15,%eax
+  800e7b:	89 d1                	mov    %edx,%ecx
+  800e7d:	89 d3                	mov    %edx,%ebx
+  800e7f:	89 d7                	mov    %edx,%edi
+  800e81:	89 d6                	mov    %edx,%esi
+  800e83:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800e85:	5b                   	pop    %ebx
+  800e86:	5e                   	pop    %esi
+  800e87:	5f                   	pop    %edi
+  800e88:	5d                   	pop    %ebp
+  800e89:	c3                   	ret
+
+00800e8a <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800e8a:	55                   	push   %ebp
+  800e8b:	89 e5                	mov    %esp,%ebp
+  800e8d:	57                   	push   %edi
+  800e8e:	56                   	push   %esi
+  800e8f:	53                   	push   %ebx
+  800e90:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e93:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e98:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e9b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e9e:	b8 08 00 00 00       	mov    $0x8,%eax
+  800ea3:	89 df                	mov    %ebx,%edi
+  800ea5:	89 de                	mov    %ebx,%esi
+  800ea7:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ea9:	85 c0                	test   %eax,%eax
+  800eab:	7f 08                	jg     800eb5 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800ead:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eb0:	5b                   	pop    %ebx
+  800eb1:	5e                   	pop    %esi
+  800eb2:	5f                   	pop    %edi
+  800eb3:	5d                   	pop    %ebp
+  800eb4:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800eb5:	83 ec 0c             	sub    $0xc,%esp
+  800eb8:	50                   	push   %eax
+  800eb9:	6a 08                	push   $0x8
+  800ebb:	68 03 3b 80 00       	push   $0x803b03
+  800ec0:	6a 23                	push   $0x23
+  800ec2:	68 20 3b 80 00       	push   $0x803b20
+  800ec7:	e8 d5 f2 ff ff       	call   8001a1 <_panic>
+
+00800ecc <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800ecc:	55                   	push   %ebp
+  800ecd:	89 e5                	mov    %esp,%ebp
+  800ecf:	57                   	push   %edi
+  800ed0:	56                   	push   %esi
+  800ed1:	53                   	push   %ebx
+  800ed2:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800ed5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eda:	8b 55 08             	mov    0x8(%ebp),%edx
+  800edd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ee0:	b8 09 00 00 00       	mov    $0x9,%eax
+  800ee5:	89 df                	mov    %ebx,%edi
+  800ee7:	89 de                	mov    %ebx,%esi
+  800ee9:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800eeb:	85 c0                	test   %eax,%eax
+  800eed:	7f 08                	jg     800ef7 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  800eef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ef2:	5b                   	pop    %ebx
+  800ef3:	5e                   	pop    %esi
+  800ef4:	5f                   	pop    %edi
+  800ef5:	5d                   	pop    %ebp
+  800ef6:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ef7:	83 ec 0c             	sub    $0xc,%esp
+  800efa:	50                   	push   %eax
+  800efb:	6a 09                	push   $0x9
+  800efd:	68 03 3b 80 00       	push   $0x803b03
+  800f02:	6a 23                	push   $0x23
+  800f04:	68 20 3b 80 00       	push   $0x803b20
+  800f09:	e8 93 f2 ff ff       	call   8001a1 <_panic>
+
+00800f0e <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800f0e:	55                   	push   %ebp
+  800f0f:	89 e5                	mov    %esp,%ebp
+  800f11:	57                   	push   %edi
+  800f12:	56                   	push   %esi
+  800f13:	53                   	push   %ebx
+  800f14:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f17:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f1c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f1f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f22:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f27:	89 df                	mov    %ebx,%edi
+  800f29:	89 de                	mov    %ebx,%esi
+  800f2b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f2d:	85 c0                	test   %eax,%eax
+  800f2f:	7f 08                	jg     800f39 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  800f31:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f34:	5b                   	pop    %ebx
+  800f35:	5e                   	pop    %esi
+  800f36:	5f                   	pop    %edi
+  800f37:	5d                   	pop    %ebp
+  800f38:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f39:	83 ec 0c             	sub    $0xc,%esp
+  800f3c:	50                   	push   %eax
+  800f3d:	6a 0a                	push   $0xa
+  800f3f:	68 03 3b 80 00       	push   $0x803b03
+  800f44:	6a 23                	push   $0x23
+  800f46:	68 20 3b 80 00       	push   $0x803b20
+  800f4b:	e8 51 f2 ff ff       	call   8001a1 <_panic>
+
+00800f50 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  800f50:	55                   	push   %ebp
+  800f51:	89 e5                	mov    %esp,%ebp
+  800f53:	57                   	push   %edi
+  800f54:	56                   	push   %esi
+  800f55:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f56:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f59:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f5c:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f61:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f64:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f67:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f6a:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  800f6c:	5b                   	pop    %ebx
+  800f6d:	5e                   	pop    %esi
+  800f6e:	5f                   	pop    %edi
+  800f6f:	5d                   	pop    %ebp
+  800f70:	c3                   	ret
+
+00800f71 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  800f71:	55                   	push   %ebp
+  800f72:	89 e5                	mov    %esp,%ebp
+  800f74:	57                   	push   %edi
+  800f75:	56                   	push   %esi
+  800f76:	53                   	push   %ebx
+  800f77:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f7a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f7f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f82:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f85:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f8a:	89 df                	mov    %ebx,%edi
+  800f8c:	89 de                	mov    %ebx,%esi
+  800f8e:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f90:	85 c0                	test   %eax,%eax
+  800f92:	7f 08                	jg     800f9c <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  800f94:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f97:	5b                   	pop    %ebx
+  800f98:	5e                   	pop    %esi
+  800f99:	5f                   	pop    %edi
+  800f9a:	5d                   	pop    %ebp
+  800f9b:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f9c:	83 ec 0c             	sub    $0xc,%esp
+  800f9f:	50                   	push   %eax
+  800fa0:	6a 0d                	push   $0xd
+  800fa2:	68 03 3b 80 00       	push   $0x803b03
+  800fa7:	6a 23                	push   $0x23
+  800fa9:	68 20 3b 80 00       	push   $0x803b20
+  800fae:	e8 ee f1 ff ff       	call   8001a1 <_panic>
+
+00800fb3 <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  800fb3:	55                   	push   %ebp
+  800fb4:	89 e5                	mov    %esp,%ebp
+  800fb6:	57                   	push   %edi
+  800fb7:	56                   	push   %esi
+  800fb8:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800fb9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fbe:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800fc3:	89 d1                	mov    %edx,%ecx
+  800fc5:	89 d3                	mov    %edx,%ebx
+  800fc7:	89 d7                	mov    %edx,%edi
+  800fc9:	89 d6                	mov    %edx,%esi
+  800fcb:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800fcd:	5b                   	pop    %ebx
+  800fce:	5e                   	pop    %esi
+  800fcf:	5f                   	pop    %edi
+  800fd0:	5d                   	pop    %ebp
+  800fd1:	c3                   	ret
+
+00800fd2 <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  800fd2:	55                   	push   %ebp
+  800fd3:	89 e5                	mov    %esp,%ebp
+  800fd5:	57                   	push   %edi
+  800fd6:	56                   	push   %esi
+  800fd7:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800fd8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fdb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fde:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800fe3:	be 00 00 00 00       	mov    $0x0,%esi
+  800fe8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800feb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fee:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  800ff0:	5b                   	pop    %ebx
+  800ff1:	5e                   	pop    %esi
+  800ff2:	5f                   	pop    %edi
+  800ff3:	5d                   	pop    %ebp
+  800ff4:	c3                   	ret
+
+00800ff5 <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  800ff5:	55                   	push   %ebp
+  800ff6:	89 e5                	mov    %esp,%ebp
+  800ff8:	57                   	push   %edi
+  800ff9:	56                   	push   %esi
+  800ffa:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800ffb:	be 00 00 00 00       	mov    $0x0,%esi
+  801000:	8b 55 08             	mov    0x8(%ebp),%edx
+  801003:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801006:	b8 10 00 00 00       	mov    $0x10,%eax
+  80100b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80100e:	89 f7                	mov    %esi,%edi
+  801010:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  801012:	5b                   	pop    %ebx
+  801013:	5e                   	pop    %esi
+  801014:	5f                   	pop    %edi
+  801015:	5d                   	pop    %ebp
+  801016:	c3                   	ret
+
+00801017 <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  801017:	55                   	push   %ebp
+  801018:	89 e5                	mov    %esp,%ebp
+  80101a:	57                   	push   %edi
+  80101b:	56                   	push   %esi
+  80101c:	53                   	push   %ebx
+  80101d:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  801020:	80 3d 68 5e 80 00 00 	cmpb   $0x0,0x805e68
+  801027:	74 41                	je     80106a <sys_batch+0x53>
+  801029:	8b 45 08             	mov    0x8(%ebp),%eax
+  80102c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  80102f:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  801036:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801039:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  80103c:	7d 45                	jge    801083 <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  80103e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801041:	8b 06                	mov    (%esi),%eax
+  801043:	8b 56 04             	mov    0x4(%esi),%edx
+  801046:	8b 4e 08             	mov    0x8(%esi),%ecx
+  801049:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  80104c:	8b 7e 10             	mov    0x10(%esi),%edi
+  80104f:	8b 76 14             	mov    0x14(%esi),%esi
+  801052:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  801054:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801057:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  80105a:	83 c6 1c             	add    $0x1c,%esi
+  80105d:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  801060:	85 c0                	test   %eax,%eax
+  801062:	78 1f                	js     801083 <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  801064:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  801068:	eb cc                	jmp    801036 <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  80106a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80106f:	b8 13 00 00 00       	mov    $0x13,%eax
+  801074:	8b 55 08             	mov    0x8(%ebp),%edx
+  801077:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80107a:	89 df                	mov    %ebx,%edi
+  80107c:	89 de                	mov    %ebx,%esi
+  80107e:	cd 30                	int    $0x30
+  801080:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  801083:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801086:	83 c4 08             	add    $0x8,%esp
+  801089:	5b                   	pop    %ebx
+  80108a:	5e                   	pop    %esi
+  80108b:	5f                   	pop    %edi
+  80108c:	5d                   	pop    %ebp
+  80108d:	c3                   	ret
+
+0080108e <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  80108e:	55                   	push   %ebp
+  80108f:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  801091:	8b 45 08             	mov    0x8(%ebp),%eax
+  801094:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  80109a:	5d                   	pop    %ebp
+  80109b:	c3                   	ret
+
+0080109c <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  80109c:	55                   	push   %ebp
+  80109d:	89 e5                	mov    %esp,%ebp
+  80109f:	56                   	push   %esi
+  8010a0:	53                   	push   %ebx
+  8010a1:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  8010a4:	8b 1e                	mov    (%esi),%ebx
+  8010a6:	85 db                	test   %ebx,%ebx
+  8010a8:	75 09                	jne    8010b3 <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  8010aa:	89 d8                	mov    %ebx,%eax
+  8010ac:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8010af:	5b                   	pop    %ebx
+  8010b0:	5e                   	pop    %esi
+  8010b1:	5d                   	pop    %ebp
+  8010b2:	c3                   	ret
+  b->sb_n = 0;
+  8010b3:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  8010b9:	53                   	push   %ebx
+  8010ba:	8d 46 04             	lea    0x4(%esi),%eax
+  8010bd:	50                   	push   %eax
+  8010be:	e8 54 ff ff ff       	call   801017 <sys_batch>
+  8010c3:	83 c4 08             	add    $0x8,%esp
+  8010c6:	85 c0                	test   %eax,%eax
+  8010c8:	78 1e                	js     8010e8 <sysbatch_flush+0x4c>
+  if (r < n)
+  8010ca:	39 c3                	cmp    %eax,%ebx
+  8010cc:	7f 07                	jg     8010d5 <sysbatch_flush+0x39>
+  return 0;
+  8010ce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010d3:	eb d5                	jmp    8010aa <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  8010d5:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8010d8:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  8010dc:	85 db                	test   %ebx,%ebx
+  8010de:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8010e3:	0f 49 d8             	cmovns %eax,%ebx
+  8010e6:	eb c2                	jmp    8010aa <sysbatch_flush+0xe>
+    return r;
+  8010e8:	89 c3                	mov    %eax,%ebx
+  8010ea:	eb be                	jmp    8010aa <sysbatch_flush+0xe>
+
+008010ec <sysbatch_add>:
+{
+  8010ec:	55                   	push   %ebp
+  8010ed:	89 e5                	mov    %esp,%ebp
+  8010ef:	53                   	push   %ebx
+  8010f0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  8010f3:	83 3b 40             	cmpl   $0x40,(%ebx)
+  8010f6:	74 41                	je     801139 <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  8010f8:	8b 03                	mov    (%ebx),%eax
+  8010fa:	8d 50 01             	lea    0x1(%eax),%edx
+  8010fd:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  8010ff:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801102:	01 d8                	add    %ebx,%eax
+  801104:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801107:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  80110a:	8b 55 10             	mov    0x10(%ebp),%edx
+  80110d:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  801110:	8b 55 14             	mov    0x14(%ebp),%edx
+  801113:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  801116:	8b 55 18             	mov    0x18(%ebp),%edx
+  801119:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  80111c:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  80111f:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  801122:	8b 55 20             	mov    0x20(%ebp),%edx
+  801125:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  801128:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  80112f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801134:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801137:	c9                   	leave
+  801138:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  801139:	53                   	push   %ebx
+  80113a:	e8 5d ff ff ff       	call   80109c <sysbatch_flush>
+  80113f:	83 c4 04             	add    $0x4,%esp
+  801142:	85 c0                	test   %eax,%eax
+  801144:	79 b2                	jns    8010f8 <sysbatch_add+0xc>
+  801146:	eb ec                	jmp    801134 <sysbatch_add+0x48>
+
+00801148 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801148:	55                   	push   %ebp
+  801149:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80114b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80114e:	05 00 00 00 30       	add    $0x30000000,%eax
+  801153:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801156:	5d                   	pop    %ebp
+  801157:	c3                   	ret
+
+00801158 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801158:	55                   	push   %ebp
+  801159:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80115b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80115e:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  801161:	66 b8 00 00          	mov    $0x0,%ax
+  801165:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80116a:	5d                   	pop    %ebp
+  80116b:	c3                   	ret
+
+0080116c <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80116c:	55                   	push   %ebp
+  80116d:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  80116f:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801174:	eb 02                	jmp    801178 <fd_alloc+0xc>
+  801176:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801178:	89 c2                	mov    %eax,%edx
+  80117a:	c1 ea 16             	shr    $0x16,%edx
+  80117d:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801184:	f6 c2 01             	test   $0x1,%dl
+  801187:	74 2b                	je     8011b4 <fd_alloc+0x48>
+  801189:	89 c2                	mov    %eax,%edx
+  80118b:	c1 ea 0c             	shr    $0xc,%edx
+  80118e:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801195:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80119b:	f6 c1 01             	test   $0x1,%cl
+  80119e:	74 14                	je     8011b4 <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  8011a0:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8011a6:	75 ce                	jne    801176 <fd_alloc+0xa>
+  8011a8:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  8011ad:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8011b2:	eb 05                	jmp    8011b9 <fd_alloc+0x4d>
+      return 0;
+  8011b4:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  8011b9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011bc:	89 02                	mov    %eax,(%edx)
+}
+  8011be:	89 c8                	mov    %ecx,%eax
+  8011c0:	5d                   	pop    %ebp
+  8011c1:	c3                   	ret
+
+008011c2 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8011c2:	55                   	push   %ebp
+  8011c3:	89 e5                	mov    %esp,%ebp
+  8011c5:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  8011c8:	83 f8 1f             	cmp    $0x1f,%eax
+  8011cb:	77 30                	ja     8011fd <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  8011cd:	c1 e0 0c             	shl    $0xc,%eax
+  8011d0:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8011d5:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8011db:	f6 c2 01             	test   $0x1,%dl
+  8011de:	74 24                	je     801204 <fd_lookup+0x42>
+  8011e0:	89 c2                	mov    %eax,%edx
+  8011e2:	c1 ea 0c             	shr    $0xc,%edx
+  8011e5:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8011ec:	f6 c2 01             	test   $0x1,%dl
+  8011ef:	74 1a                	je     80120b <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  8011f1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8011f4:	89 02                	mov    %eax,(%edx)
+  return 0;
+  8011f6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011fb:	5d                   	pop    %ebp
+  8011fc:	c3                   	ret
+    return -E_INVAL;
+  8011fd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801202:	eb f7                	jmp    8011fb <fd_lookup+0x39>
+    return -E_INVAL;
+  801204:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801209:	eb f0                	jmp    8011fb <fd_lookup+0x39>
+  80120b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801210:	eb e9                	jmp    8011fb <fd_lookup+0x39>
+
+00801212 <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801212:	55                   	push   %ebp
+  801213:	89 e5                	mov    %esp,%ebp
+  801215:	53                   	push   %ebx
+  801216:	83 ec 04             	sub    $0x4,%esp
+  801219:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  80121c:	b8 ac 3b 80 00       	mov    $0x803bac,%eax
+  801221:	8b 18                	mov    (%eax),%ebx
+  801223:	85 db                	test   %ebx,%ebx
+  801225:	74 0e                	je     801235 <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  801227:	83 c0 04             	add    $0x4,%eax
+  80122a:	39 13                	cmp    %edx,(%ebx)
+  80122c:	75 f3                	jne    801221 <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  80122e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801233:	eb 1f                	jmp    801254 <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801235:	a1 64 5e 80 00       	mov    0x805e64,%eax
+  80123a:	8b 40 48             	mov    0x48(%eax),%eax
+  80123d:	83 ec 04             	sub    $0x4,%esp
+  801240:	52                   	push   %edx
+  801241:	50                   	push   %eax
+  801242:	68 30 3b 80 00       	push   $0x803b30
+  801247:	e8 30 f0 ff ff       	call   80027c <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  80124c:	83 c4 10             	add    $0x10,%esp
+  80124f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  801254:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801257:	89 1a                	mov    %ebx,(%edx)
+}
+  801259:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80125c:	c9                   	leave
+  80125d:	c3                   	ret
+
+0080125e <fd_close>:
+{
+  80125e:	55                   	push   %ebp
+  80125f:	89 e5                	mov    %esp,%ebp
+  801261:	57                   	push   %edi
+  801262:	56                   	push   %esi
+  801263:	53                   	push   %ebx
+  801264:	83 ec 24             	sub    $0x24,%esp
+  801267:	8b 75 08             	mov    0x8(%ebp),%esi
+  80126a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80126d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801270:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801271:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801277:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80127a:	50                   	push   %eax
+  80127b:	e8 42 ff ff ff       	call   8011c2 <fd_lookup>
+  801280:	89 c3                	mov    %eax,%ebx
+  801282:	83 c4 10             	add    $0x10,%esp
+  801285:	85 c0                	test   %eax,%eax
+  801287:	78 05                	js     80128e <fd_close+0x30>
+      || fd != fd2)
+  801289:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80128c:	74 16                	je     8012a4 <fd_close+0x46>
+    return must_exist ? r : 0;
+  80128e:	89 f8                	mov    %edi,%eax
+  801290:	84 c0                	test   %al,%al
+  801292:	b8 00 00 00 00       	mov    $0x0,%eax
+  801297:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80129a:	89 d8                	mov    %ebx,%eax
+  80129c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80129f:	5b                   	pop    %ebx
+  8012a0:	5e                   	pop    %esi
+  8012a1:	5f                   	pop    %edi
+  8012a2:	5d                   	pop    %ebp
+  8012a3:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8012a4:	83 ec 08             	sub    $0x8,%esp
+  8012a7:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8012aa:	50                   	push   %eax
+  8012ab:	ff 36                	push   (%esi)
+  8012ad:	e8 60 ff ff ff       	call   801212 <dev_lookup>
+  8012b2:	89 c3                	mov    %eax,%ebx
+  8012b4:	83 c4 10             	add    $0x10,%esp
+  8012b7:	85 c0                	test   %eax,%eax
+  8012b9:	78 1a                	js     8012d5 <fd_close+0x77>
+    if (dev->dev_close)
+  8012bb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8012be:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  8012c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  8012c6:	85 c0                	test   %eax,%eax
+  8012c8:	74 0b                	je     8012d5 <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  8012ca:	83 ec 0c             	sub    $0xc,%esp
+  8012cd:	56                   	push   %esi
+  8012ce:	ff d0                	call   *%eax
+  8012d0:	89 c3                	mov    %eax,%ebx
+  8012d2:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  8012d5:	83 ec 08             	sub    $0x8,%esp
+  8012d8:	56                   	push   %esi
+  8012d9:	6a 00                	push   $0x0
+  8012db:	e8 3e fa ff ff       	call   800d1e <sys_page_unmap>
+  return r;
+  8012e0:	83 c4 10             	add    $0x10,%esp
+  8012e3:	eb b5                	jmp    80129a <fd_close+0x3c>
+
+008012e5 <close>:
+
+int
+close(int fdnum)
+{
+  8012e5:	55                   	push   %ebp
+  8012e6:	89 e5                	mov    %esp,%ebp
+  8012e8:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8012eb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8012ee:	50                   	push   %eax
+  8012ef:	ff 75 08             	push   0x8(%ebp)
+  8012f2:	e8 cb fe ff ff       	call   8011c2 <fd_lookup>
+  8012f7:	83 c4 10             	add    $0x10,%esp
+  8012fa:	85 c0                	test   %eax,%eax
+  8012fc:	79 02                	jns    801300 <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  8012fe:	c9                   	leave
+  8012ff:	c3                   	ret
+    return fd_close(fd, 1);
+  801300:	83 ec 08             	sub    $0x8,%esp
+  801303:	6a 01                	push   $0x1
+  801305:	ff 75 f4             	push   -0xc(%ebp)
+  801308:	e8 51 ff ff ff       	call   80125e <fd_close>
+  80130d:	83 c4 10             	add    $0x10,%esp
+  801310:	eb ec                	jmp    8012fe <close+0x19>
+
+00801312 <close_all>:
+
+void
+close_all(void)
+{
+  801312:	55                   	push   %ebp
+  801313:	89 e5                	mov    %esp,%ebp
+  801315:	53                   	push   %ebx
+  801316:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  801319:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  80131e:	83 ec 0c             	sub    $0xc,%esp
+  801321:	53                   	push   %ebx
+  801322:	e8 be ff ff ff       	call   8012e5 <close>
+  for (i = 0; i < MAXFD; i++)
+  801327:	83 c3 01             	add    $0x1,%ebx
+  80132a:	83 c4 10             	add    $0x10,%esp
+  80132d:	83 fb 20             	cmp    $0x20,%ebx
+  801330:	75 ec                	jne    80131e <close_all+0xc>
+}
+  801332:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801335:	c9                   	leave
+  801336:	c3                   	ret
+
+00801337 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801337:	55                   	push   %ebp
+  801338:	89 e5                	mov    %esp,%ebp
+  80133a:	57                   	push   %edi
+  80133b:	56                   	push   %esi
+  80133c:	53                   	push   %ebx
+  80133d:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801340:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801343:	50                   	push   %eax
+  801344:	ff 75 08             	push   0x8(%ebp)
+  801347:	e8 76 fe ff ff       	call   8011c2 <fd_lookup>
+  80134c:	89 c6                	mov    %eax,%esi
+  80134e:	83 c4 10             	add    $0x10,%esp
+  801351:	85 c0                	test   %eax,%eax
+  801353:	0f 88 0a 01 00 00    	js     801463 <dup+0x12c>
+    return r;
+  close(newfdnum);
+  801359:	83 ec 0c             	sub    $0xc,%esp
+  80135c:	ff 75 0c             	push   0xc(%ebp)
+  80135f:	e8 81 ff ff ff       	call   8012e5 <close>
+
+  newfd = INDEX2FD(newfdnum);
+  801364:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801367:	c1 e0 0c             	shl    $0xc,%eax
+  80136a:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  801370:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  801373:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801376:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  801379:	89 04 24             	mov    %eax,(%esp)
+  80137c:	e8 d7 fd ff ff       	call   801158 <fd2data>
+  801381:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  801383:	89 3c 24             	mov    %edi,(%esp)
+  801386:	e8 cd fd ff ff       	call   801158 <fd2data>
+  80138b:	83 c4 10             	add    $0x10,%esp
+  80138e:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801391:	89 f3                	mov    %esi,%ebx
+  801393:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  801399:	89 c6                	mov    %eax,%esi
+  80139b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80139e:	89 cf                	mov    %ecx,%edi
+  8013a0:	eb 0c                	jmp    8013ae <dup+0x77>
+  8013a2:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8013a8:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8013ae:	39 fb                	cmp    %edi,%ebx
+  8013b0:	74 7b                	je     80142d <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  8013b2:	89 d8                	mov    %ebx,%eax
+  8013b4:	c1 e8 16             	shr    $0x16,%eax
+  8013b7:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8013be:	a8 01                	test   $0x1,%al
+  8013c0:	74 e0                	je     8013a2 <dup+0x6b>
+  8013c2:	89 d8                	mov    %ebx,%eax
+  8013c4:	c1 e8 0c             	shr    $0xc,%eax
+  8013c7:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8013ce:	f6 c2 01             	test   $0x1,%dl
+  8013d1:	74 cf                	je     8013a2 <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  8013d3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  8013da:	83 ec 0c             	sub    $0xc,%esp
+  8013dd:	25 07 0e 00 00       	and    $0xe07,%eax
+  8013e2:	50                   	push   %eax
+  8013e3:	56                   	push   %esi
+  8013e4:	6a 00                	push   $0x0
+  8013e6:	53                   	push   %ebx
+  8013e7:	6a 00                	push   $0x0
+  8013e9:	e8 ee f8 ff ff       	call   800cdc <sys_page_map>
+  8013ee:	83 c4 20             	add    $0x20,%esp
+  8013f1:	85 c0                	test   %eax,%eax
+  8013f3:	79 ad                	jns    8013a2 <dup+0x6b>
+  8013f5:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8013f8:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  8013fa:	83 ec 08             	sub    $0x8,%esp
+  8013fd:	ff 75 d4             	push   -0x2c(%ebp)
+  801400:	6a 00                	push   $0x0
+  801402:	e8 17 f9 ff ff       	call   800d1e <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801407:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  80140a:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  801410:	83 c4 10             	add    $0x10,%esp
+  801413:	39 df                	cmp    %ebx,%edi
+  801415:	74 4c                	je     801463 <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  801417:	83 ec 08             	sub    $0x8,%esp
+  80141a:	57                   	push   %edi
+  80141b:	6a 00                	push   $0x0
+  80141d:	e8 fc f8 ff ff       	call   800d1e <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801422:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  801428:	83 c4 10             	add    $0x10,%esp
+  80142b:	eb e6                	jmp    801413 <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80142d:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801430:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  801433:	89 c8                	mov    %ecx,%eax
+  801435:	c1 e8 0c             	shr    $0xc,%eax
+  801438:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80143f:	83 ec 0c             	sub    $0xc,%esp
+  801442:	25 07 0e 00 00       	and    $0xe07,%eax
+  801447:	50                   	push   %eax
+  801448:	ff 75 d4             	push   -0x2c(%ebp)
+  80144b:	6a 00                	push   $0x0
+  80144d:	51                   	push   %ecx
+  80144e:	6a 00                	push   $0x0
+  801450:	e8 87 f8 ff ff       	call   800cdc <sys_page_map>
+  801455:	89 c6                	mov    %eax,%esi
+  801457:	83 c4 20             	add    $0x20,%esp
+  80145a:	85 c0                	test   %eax,%eax
+  80145c:	78 9c                	js     8013fa <dup+0xc3>
+  return newfdnum;
+  80145e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801461:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  801463:	89 f0                	mov    %esi,%eax
+  801465:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801468:	5b                   	pop    %ebx
+  801469:	5e                   	pop    %esi
+  80146a:	5f                   	pop    %edi
+  80146b:	5d                   	pop    %ebp
+  80146c:	c3                   	ret
+
+0080146d <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80146d:	55                   	push   %ebp
+  80146e:	89 e5                	mov    %esp,%ebp
+  801470:	56                   	push   %esi
+  801471:	53                   	push   %ebx
+  801472:	83 ec 18             	sub    $0x18,%esp
+  801475:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801478:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80147b:	50                   	push   %eax
+  80147c:	56                   	push   %esi
+  80147d:	e8 40 fd ff ff       	call   8011c2 <fd_lookup>
+  801482:	83 c4 10             	add    $0x10,%esp
+  801485:	85 c0                	test   %eax,%eax
+  801487:	78 3c                	js     8014c5 <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801489:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80148c:	83 ec 08             	sub    $0x8,%esp
+  80148f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801492:	50                   	push   %eax
+  801493:	ff 33                	push   (%ebx)
+  801495:	e8 78 fd ff ff       	call   801212 <dev_lookup>
+  80149a:	83 c4 10             	add    $0x10,%esp
+  80149d:	85 c0                	test   %eax,%eax
+  80149f:	78 24                	js     8014c5 <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8014a1:	8b 43 08             	mov    0x8(%ebx),%eax
+  8014a4:	83 e0 03             	and    $0x3,%eax
+  8014a7:	83 f8 01             	cmp    $0x1,%eax
+  8014aa:	74 20                	je     8014cc <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  8014ac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014af:	8b 40 08             	mov    0x8(%eax),%eax
+  8014b2:	85 c0                	test   %eax,%eax
+  8014b4:	74 37                	je     8014ed <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  8014b6:	83 ec 04             	sub    $0x4,%esp
+  8014b9:	ff 75 10             	push   0x10(%ebp)
+  8014bc:	ff 75 0c             	push   0xc(%ebp)
+  8014bf:	53                   	push   %ebx
+  8014c0:	ff d0                	call   *%eax
+  8014c2:	83 c4 10             	add    $0x10,%esp
+}
+  8014c5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014c8:	5b                   	pop    %ebx
+  8014c9:	5e                   	pop    %esi
+  8014ca:	5d                   	pop    %ebp
+  8014cb:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8014cc:	a1 64 5e 80 00       	mov    0x805e64,%eax
+  8014d1:	8b 40 48             	mov    0x48(%eax),%eax
+  8014d4:	83 ec 04             	sub    $0x4,%esp
+  8014d7:	56                   	push   %esi
+  8014d8:	50                   	push   %eax
+  8014d9:	68 71 3b 80 00       	push   $0x803b71
+  8014de:	e8 99 ed ff ff       	call   80027c <cprintf>
+    return -E_INVAL;
+  8014e3:	83 c4 10             	add    $0x10,%esp
+  8014e6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014eb:	eb d8                	jmp    8014c5 <read+0x58>
+    return -E_NOT_SUPP;
+  8014ed:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8014f2:	eb d1                	jmp    8014c5 <read+0x58>
+
+008014f4 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8014f4:	55                   	push   %ebp
+  8014f5:	89 e5                	mov    %esp,%ebp
+  8014f7:	57                   	push   %edi
+  8014f8:	56                   	push   %esi
+  8014f9:	53                   	push   %ebx
+  8014fa:	83 ec 0c             	sub    $0xc,%esp
+  8014fd:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801500:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  801503:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801508:	eb 02                	jmp    80150c <readn+0x18>
+  80150a:	01 c3                	add    %eax,%ebx
+  80150c:	39 f3                	cmp    %esi,%ebx
+  80150e:	73 21                	jae    801531 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  801510:	83 ec 04             	sub    $0x4,%esp
+  801513:	89 f0                	mov    %esi,%eax
+  801515:	29 d8                	sub    %ebx,%eax
+  801517:	50                   	push   %eax
+  801518:	89 d8                	mov    %ebx,%eax
+  80151a:	03 45 0c             	add    0xc(%ebp),%eax
+  80151d:	50                   	push   %eax
+  80151e:	57                   	push   %edi
+  80151f:	e8 49 ff ff ff       	call   80146d <read>
+    if (m < 0)
+  801524:	83 c4 10             	add    $0x10,%esp
+  801527:	85 c0                	test   %eax,%eax
+  801529:	78 04                	js     80152f <readn+0x3b>
+      return m;
+    if (m == 0)
+  80152b:	75 dd                	jne    80150a <readn+0x16>
+  80152d:	eb 02                	jmp    801531 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  80152f:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  801531:	89 d8                	mov    %ebx,%eax
+  801533:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801536:	5b                   	pop    %ebx
+  801537:	5e                   	pop    %esi
+  801538:	5f                   	pop    %edi
+  801539:	5d                   	pop    %ebp
+  80153a:	c3                   	ret
+
+0080153b <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80153b:	55                   	push   %ebp
+  80153c:	89 e5                	mov    %esp,%ebp
+  80153e:	56                   	push   %esi
+  80153f:	53                   	push   %ebx
+  801540:	83 ec 18             	sub    $0x18,%esp
+  801543:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801546:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801549:	50                   	push   %eax
+  80154a:	53                   	push   %ebx
+  80154b:	e8 72 fc ff ff       	call   8011c2 <fd_lookup>
+  801550:	83 c4 10             	add    $0x10,%esp
+  801553:	85 c0                	test   %eax,%eax
+  801555:	78 37                	js     80158e <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801557:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80155a:	83 ec 08             	sub    $0x8,%esp
+  80155d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801560:	50                   	push   %eax
+  801561:	ff 36                	push   (%esi)
+  801563:	e8 aa fc ff ff       	call   801212 <dev_lookup>
+  801568:	83 c4 10             	add    $0x10,%esp
+  80156b:	85 c0                	test   %eax,%eax
+  80156d:	78 1f                	js     80158e <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80156f:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801573:	74 20                	je     801595 <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  801575:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801578:	8b 40 0c             	mov    0xc(%eax),%eax
+  80157b:	85 c0                	test   %eax,%eax
+  80157d:	74 37                	je     8015b6 <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  80157f:	83 ec 04             	sub    $0x4,%esp
+  801582:	ff 75 10             	push   0x10(%ebp)
+  801585:	ff 75 0c             	push   0xc(%ebp)
+  801588:	56                   	push   %esi
+  801589:	ff d0                	call   *%eax
+  80158b:	83 c4 10             	add    $0x10,%esp
+}
+  80158e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801591:	5b                   	pop    %ebx
+  801592:	5e                   	pop    %esi
+  801593:	5d                   	pop    %ebp
+  801594:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801595:	a1 64 5e 80 00       	mov    0x805e64,%eax
+  80159a:	8b 40 48             	mov    0x48(%eax),%eax
+  80159d:	83 ec 04             	sub    $0x4,%esp
+  8015a0:	53                   	push   %ebx
+  8015a1:	50                   	push   %eax
+  8015a2:	68 8d 3b 80 00       	push   $0x803b8d
+  8015a7:	e8 d0 ec ff ff       	call   80027c <cprintf>
+    return -E_INVAL;
+  8015ac:	83 c4 10             	add    $0x10,%esp
+  8015af:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015b4:	eb d8                	jmp    80158e <write+0x53>
+    return -E_NOT_SUPP;
+  8015b6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015bb:	eb d1                	jmp    80158e <write+0x53>
+
+008015bd <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8015bd:	55                   	push   %ebp
+  8015be:	89 e5                	mov    %esp,%ebp
+  8015c0:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8015c3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015c6:	50                   	push   %eax
+  8015c7:	ff 75 08             	push   0x8(%ebp)
+  8015ca:	e8 f3 fb ff ff       	call   8011c2 <fd_lookup>
+  8015cf:	83 c4 10             	add    $0x10,%esp
+  8015d2:	85 c0                	test   %eax,%eax
+  8015d4:	78 0e                	js     8015e4 <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  8015d6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8015d9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015dc:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  8015df:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015e4:	c9                   	leave
+  8015e5:	c3                   	ret
+
+008015e6 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8015e6:	55                   	push   %ebp
+  8015e7:	89 e5                	mov    %esp,%ebp
+  8015e9:	56                   	push   %esi
+  8015ea:	53                   	push   %ebx
+  8015eb:	83 ec 18             	sub    $0x18,%esp
+  8015ee:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  8015f1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8015f4:	50                   	push   %eax
+  8015f5:	53                   	push   %ebx
+  8015f6:	e8 c7 fb ff ff       	call   8011c2 <fd_lookup>
+  8015fb:	83 c4 10             	add    $0x10,%esp
+  8015fe:	85 c0                	test   %eax,%eax
+  801600:	78 34                	js     801636 <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801602:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801605:	83 ec 08             	sub    $0x8,%esp
+  801608:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80160b:	50                   	push   %eax
+  80160c:	ff 36                	push   (%esi)
+  80160e:	e8 ff fb ff ff       	call   801212 <dev_lookup>
+  801613:	83 c4 10             	add    $0x10,%esp
+  801616:	85 c0                	test   %eax,%eax
+  801618:	78 1c                	js     801636 <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80161a:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80161e:	74 1d                	je     80163d <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  801620:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801623:	8b 40 18             	mov    0x18(%eax),%eax
+  801626:	85 c0                	test   %eax,%eax
+  801628:	74 34                	je     80165e <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  80162a:	83 ec 08             	sub    $0x8,%esp
+  80162d:	ff 75 0c             	push   0xc(%ebp)
+  801630:	56                   	push   %esi
+  801631:	ff d0                	call   *%eax
+  801633:	83 c4 10             	add    $0x10,%esp
+}
+  801636:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801639:	5b                   	pop    %ebx
+  80163a:	5e                   	pop    %esi
+  80163b:	5d                   	pop    %ebp
+  80163c:	c3                   	ret
+            thisenv->env_id, fdnum);
+  80163d:	a1 64 5e 80 00       	mov    0x805e64,%eax
+  801642:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801645:	83 ec 04             	sub    $0x4,%esp
+  801648:	53                   	push   %ebx
+  801649:	50                   	push   %eax
+  80164a:	68 50 3b 80 00       	push   $0x803b50
+  80164f:	e8 28 ec ff ff       	call   80027c <cprintf>
+    return -E_INVAL;
+  801654:	83 c4 10             	add    $0x10,%esp
+  801657:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80165c:	eb d8                	jmp    801636 <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  80165e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801663:	eb d1                	jmp    801636 <ftruncate+0x50>
+
+00801665 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801665:	55                   	push   %ebp
+  801666:	89 e5                	mov    %esp,%ebp
+  801668:	56                   	push   %esi
+  801669:	53                   	push   %ebx
+  80166a:	83 ec 18             	sub    $0x18,%esp
+  80166d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801670:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801673:	50                   	push   %eax
+  801674:	ff 75 08             	push   0x8(%ebp)
+  801677:	e8 46 fb ff ff       	call   8011c2 <fd_lookup>
+  80167c:	83 c4 10             	add    $0x10,%esp
+  80167f:	85 c0                	test   %eax,%eax
+  801681:	78 49                	js     8016cc <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801683:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801686:	83 ec 08             	sub    $0x8,%esp
+  801689:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80168c:	50                   	push   %eax
+  80168d:	ff 36                	push   (%esi)
+  80168f:	e8 7e fb ff ff       	call   801212 <dev_lookup>
+  801694:	83 c4 10             	add    $0x10,%esp
+  801697:	85 c0                	test   %eax,%eax
+  801699:	78 31                	js     8016cc <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  80169b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80169e:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8016a2:	74 2f                	je     8016d3 <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  8016a4:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  8016a7:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8016ae:	00 00 00 
+  stat->st_isdir = 0;
+  8016b1:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8016b8:	00 00 00 
+  stat->st_dev = dev;
+  8016bb:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  8016c1:	83 ec 08             	sub    $0x8,%esp
+  8016c4:	53                   	push   %ebx
+  8016c5:	56                   	push   %esi
+  8016c6:	ff 50 14             	call   *0x14(%eax)
+  8016c9:	83 c4 10             	add    $0x10,%esp
+}
+  8016cc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016cf:	5b                   	pop    %ebx
+  8016d0:	5e                   	pop    %esi
+  8016d1:	5d                   	pop    %ebp
+  8016d2:	c3                   	ret
+    return -E_NOT_SUPP;
+  8016d3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016d8:	eb f2                	jmp    8016cc <fstat+0x67>
+
+008016da <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  8016da:	55                   	push   %ebp
+  8016db:	89 e5                	mov    %esp,%ebp
+  8016dd:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  8016e0:	ff 75 0c             	push   0xc(%ebp)
+  8016e3:	ff 75 08             	push   0x8(%ebp)
+  8016e6:	e8 58 07 00 00       	call   801e43 <file_stat>
+}
+  8016eb:	c9                   	leave
+  8016ec:	c3                   	ret
+
+008016ed <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  8016ed:	55                   	push   %ebp
+  8016ee:	89 e5                	mov    %esp,%ebp
+  8016f0:	57                   	push   %edi
+  8016f1:	56                   	push   %esi
+  8016f2:	53                   	push   %ebx
+  8016f3:	83 ec 1c             	sub    $0x1c,%esp
+  8016f6:	89 c7                	mov    %eax,%edi
+  8016f8:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8016fb:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8016fe:	e9 a2 00 00 00       	jmp    8017a5 <fsipc_send+0xb8>
+  nfsenvs = 0;
+  801703:	c7 05 00 50 80 00 00 	movl   $0x0,0x805000
+  80170a:	00 00 00 
+  80170d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801712:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801717:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  80171c:	be 01 00 00 00       	mov    $0x1,%esi
+  801721:	eb 0f                	jmp    801732 <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801723:	83 c0 01             	add    $0x1,%eax
+  801726:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80172b:	74 49                	je     801776 <fsipc_send+0x89>
+  80172d:	83 f9 07             	cmp    $0x7,%ecx
+  801730:	7f 50                	jg     801782 <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  801732:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801735:	c1 e2 04             	shl    $0x4,%edx
+  801738:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80173e:	8b 52 50             	mov    0x50(%edx),%edx
+  801741:	83 fa 01             	cmp    $0x1,%edx
+  801744:	75 dd                	jne    801723 <fsipc_send+0x36>
+  801746:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801749:	c1 e2 04             	shl    $0x4,%edx
+  80174c:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801752:	8b 52 54             	mov    0x54(%edx),%edx
+  801755:	85 d2                	test   %edx,%edx
+  801757:	74 ca                	je     801723 <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801759:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  80175c:	c1 e2 04             	shl    $0x4,%edx
+  80175f:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801765:	8b 52 48             	mov    0x48(%edx),%edx
+  801768:	89 14 8d 20 50 80 00 	mov    %edx,0x805020(,%ecx,4)
+  80176f:	8d 49 01             	lea    0x1(%ecx),%ecx
+  801772:	89 f3                	mov    %esi,%ebx
+  801774:	eb ad                	jmp    801723 <fsipc_send+0x36>
+  801776:	84 db                	test   %bl,%bl
+  801778:	74 38                	je     8017b2 <fsipc_send+0xc5>
+  80177a:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  801780:	eb 30                	jmp    8017b2 <fsipc_send+0xc5>
+  801782:	84 db                	test   %bl,%bl
+  801784:	74 2c                	je     8017b2 <fsipc_send+0xc5>
+  801786:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  80178c:	eb 24                	jmp    8017b2 <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  80178e:	50                   	push   %eax
+  80178f:	68 bc 3b 80 00       	push   $0x803bbc
+  801794:	6a 34                	push   $0x34
+  801796:	68 c6 3b 80 00       	push   $0x803bc6
+  80179b:	e8 01 ea ff ff       	call   8001a1 <_panic>
+    }
+    sys_yield();
+  8017a0:	e8 92 f4 ff ff       	call   800c37 <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  8017a5:	83 3d 00 50 80 00 03 	cmpl   $0x3,0x805000
+  8017ac:	0f 8e 51 ff ff ff    	jle    801703 <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  8017b2:	a1 64 5e 80 00       	mov    0x805e64,%eax
+  8017b7:	8b 70 48             	mov    0x48(%eax),%esi
+  8017ba:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  8017c0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017c5:	8b 0d 00 50 80 00    	mov    0x805000,%ecx
+  8017cb:	39 d9                	cmp    %ebx,%ecx
+  8017cd:	7e d1                	jle    8017a0 <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  8017cf:	83 ec 0c             	sub    $0xc,%esp
+  8017d2:	ff 75 e0             	push   -0x20(%ebp)
+  8017d5:	6a 07                	push   $0x7
+  8017d7:	ff 75 e4             	push   -0x1c(%ebp)
+  8017da:	57                   	push   %edi
+  8017db:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  8017de:	99                   	cltd
+  8017df:	f7 f9                	idiv   %ecx
+  8017e1:	ff 34 95 20 50 80 00 	push   0x805020(,%edx,4)
+  8017e8:	e8 63 f7 ff ff       	call   800f50 <sys_ipc_try_send>
+      if (r == 0)
+  8017ed:	83 c4 20             	add    $0x20,%esp
+  8017f0:	85 c0                	test   %eax,%eax
+  8017f2:	74 0a                	je     8017fe <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  8017f4:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8017f7:	75 95                	jne    80178e <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  8017f9:	83 c3 01             	add    $0x1,%ebx
+  8017fc:	eb c7                	jmp    8017c5 <fsipc_send+0xd8>
+  }
+}
+  8017fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801801:	5b                   	pop    %ebx
+  801802:	5e                   	pop    %esi
+  801803:	5f                   	pop    %edi
+  801804:	5d                   	pop    %ebp
+  801805:	c3                   	ret
+
+00801806 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801806:	55                   	push   %ebp
+  801807:	89 e5                	mov    %esp,%ebp
+  801809:	53                   	push   %ebx
+  80180a:	83 ec 14             	sub    $0x14,%esp
+  80180d:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  80180f:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  801816:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80181b:	ba 00 60 80 00       	mov    $0x806000,%edx
+  801820:	e8 c8 fe ff ff       	call   8016ed <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801825:	6a 00                	push   $0x0
+  801827:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80182a:	50                   	push   %eax
+  80182b:	53                   	push   %ebx
+  80182c:	6a 00                	push   $0x0
+  80182e:	e8 cd 1a 00 00       	call   803300 <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  801833:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801836:	c9                   	leave
+  801837:	c3                   	ret
+
+00801838 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801838:	55                   	push   %ebp
+  801839:	89 e5                	mov    %esp,%ebp
+  80183b:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80183e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801841:	8b 40 0c             	mov    0xc(%eax),%eax
+  801844:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.set_size.req_size = newsize;
+  801849:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80184c:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801851:	ba 00 00 00 00       	mov    $0x0,%edx
+  801856:	b8 02 00 00 00       	mov    $0x2,%eax
+  80185b:	e8 a6 ff ff ff       	call   801806 <fsipc>
+}
+  801860:	c9                   	leave
+  801861:	c3                   	ret
+
+00801862 <devfile_flush>:
+{
+  801862:	55                   	push   %ebp
+  801863:	89 e5                	mov    %esp,%ebp
+  801865:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801868:	8b 45 08             	mov    0x8(%ebp),%eax
+  80186b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80186e:	a3 00 60 80 00       	mov    %eax,0x806000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801873:	ba 00 00 00 00       	mov    $0x0,%edx
+  801878:	b8 06 00 00 00       	mov    $0x6,%eax
+  80187d:	e8 84 ff ff ff       	call   801806 <fsipc>
+}
+  801882:	c9                   	leave
+  801883:	c3                   	ret
+
+00801884 <devfile_stat>:
+{
+  801884:	55                   	push   %ebp
+  801885:	89 e5                	mov    %esp,%ebp
+  801887:	53                   	push   %ebx
+  801888:	83 ec 04             	sub    $0x4,%esp
+  80188b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80188e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801891:	8b 40 0c             	mov    0xc(%eax),%eax
+  801894:	a3 00 60 80 00       	mov    %eax,0x806000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801899:	ba 00 00 00 00       	mov    $0x0,%edx
+  80189e:	b8 05 00 00 00       	mov    $0x5,%eax
+  8018a3:	e8 5e ff ff ff       	call   801806 <fsipc>
+  8018a8:	85 c0                	test   %eax,%eax
+  8018aa:	78 2c                	js     8018d8 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8018ac:	83 ec 08             	sub    $0x8,%esp
+  8018af:	68 00 60 80 00       	push   $0x806000
+  8018b4:	53                   	push   %ebx
+  8018b5:	e8 b0 ef ff ff       	call   80086a <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  8018ba:	a1 80 60 80 00       	mov    0x806080,%eax
+  8018bf:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8018c5:	a1 84 60 80 00       	mov    0x806084,%eax
+  8018ca:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  8018d0:	83 c4 10             	add    $0x10,%esp
+  8018d3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018db:	c9                   	leave
+  8018dc:	c3                   	ret
+
+008018dd <fsv_alloc>:
+{
+  8018dd:	55                   	push   %ebp
+  8018de:	89 e5                	mov    %esp,%ebp
+  8018e0:	56                   	push   %esi
+  8018e1:	53                   	push   %ebx
+  8018e2:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  8018e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018e9:	eb 22                	jmp    80190d <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  8018eb:	83 ec 04             	sub    $0x4,%esp
+  8018ee:	6a 00                	push   $0x0
+  8018f0:	6a 00                	push   $0x0
+  8018f2:	6a 07                	push   $0x7
+  8018f4:	50                   	push   %eax
+  8018f5:	6a 00                	push   $0x0
+  8018f7:	6a 04                	push   $0x4
+  8018f9:	68 40 50 80 00       	push   $0x805040
+  8018fe:	e8 e9 f7 ff ff       	call   8010ec <sysbatch_add>
+  801903:	83 c4 20             	add    $0x20,%esp
+  801906:	85 c0                	test   %eax,%eax
+  801908:	78 48                	js     801952 <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  80190a:	83 c3 01             	add    $0x1,%ebx
+  80190d:	39 f3                	cmp    %esi,%ebx
+  80190f:	74 31                	je     801942 <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  801911:	89 d8                	mov    %ebx,%eax
+  801913:	c1 e0 0c             	shl    $0xc,%eax
+  801916:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  80191b:	89 c2                	mov    %eax,%edx
+  80191d:	c1 ea 16             	shr    $0x16,%edx
+  801920:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801927:	f6 c2 01             	test   $0x1,%dl
+  80192a:	74 bf                	je     8018eb <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  80192c:	89 c2                	mov    %eax,%edx
+  80192e:	c1 ea 0c             	shr    $0xc,%edx
+  801931:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801938:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  80193b:	83 fa 03             	cmp    $0x3,%edx
+  80193e:	75 ab                	jne    8018eb <fsv_alloc+0xe>
+  801940:	eb c8                	jmp    80190a <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  801942:	83 ec 0c             	sub    $0xc,%esp
+  801945:	68 40 50 80 00       	push   $0x805040
+  80194a:	e8 4d f7 ff ff       	call   80109c <sysbatch_flush>
+  80194f:	83 c4 10             	add    $0x10,%esp
+}
+  801952:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801955:	5b                   	pop    %ebx
+  801956:	5e                   	pop    %esi
+  801957:	5d                   	pop    %ebp
+  801958:	c3                   	ret
+
+00801959 <devfile_read>:
+{
+  801959:	55                   	push   %ebp
+  80195a:	89 e5                	mov    %esp,%ebp
+  80195c:	57                   	push   %edi
+  80195d:	56                   	push   %esi
+  80195e:	53                   	push   %ebx
+  80195f:	83 ec 3c             	sub    $0x3c,%esp
+  801962:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  801965:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  80196b:	77 57                	ja     8019c4 <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80196d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801970:	8b 40 0c             	mov    0xc(%eax),%eax
+  801973:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read.req_n = n;
+  801978:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  80197e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801983:	b8 03 00 00 00       	mov    $0x3,%eax
+  801988:	e8 79 fe ff ff       	call   801806 <fsipc>
+  80198d:	89 c6                	mov    %eax,%esi
+  80198f:	85 c0                	test   %eax,%eax
+  801991:	78 27                	js     8019ba <devfile_read+0x61>
+  assert(r <= n);
+  801993:	39 c3                	cmp    %eax,%ebx
+  801995:	0f 82 0e 02 00 00    	jb     801ba9 <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  80199b:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8019a0:	0f 8f 1c 02 00 00    	jg     801bc2 <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8019a6:	83 ec 04             	sub    $0x4,%esp
+  8019a9:	50                   	push   %eax
+  8019aa:	68 00 60 80 00       	push   $0x806000
+  8019af:	ff 75 0c             	push   0xc(%ebp)
+  8019b2:	e8 39 f0 ff ff       	call   8009f0 <memmove>
+  return r;
+  8019b7:	83 c4 10             	add    $0x10,%esp
+}
+  8019ba:	89 f0                	mov    %esi,%eax
+  8019bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019bf:	5b                   	pop    %ebx
+  8019c0:	5e                   	pop    %esi
+  8019c1:	5f                   	pop    %edi
+  8019c2:	5d                   	pop    %ebp
+  8019c3:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  8019c4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8019c9:	e8 0f ff ff ff       	call   8018dd <fsv_alloc>
+  8019ce:	89 c6                	mov    %eax,%esi
+  8019d0:	85 c0                	test   %eax,%eax
+  8019d2:	78 e6                	js     8019ba <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  8019d4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019d7:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019da:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  8019df:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019e2:	8b 40 04             	mov    0x4(%eax),%eax
+  8019e5:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  8019ea:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  8019f0:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  8019f7:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8019fc:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801a01:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801a06:	e8 e2 fc ff ff       	call   8016ed <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801a0b:	6a 00                	push   $0x0
+  801a0d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801a10:	50                   	push   %eax
+  801a11:	68 00 10 c0 9f       	push   $0x9fc01000
+  801a16:	6a 00                	push   $0x0
+  801a18:	e8 e3 18 00 00       	call   803300 <ipc_recv_pages>
+  801a1d:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  801a1f:	83 c4 10             	add    $0x10,%esp
+  801a22:	85 c0                	test   %eax,%eax
+  801a24:	7e 94                	jle    8019ba <devfile_read+0x61>
+  assert(r <= n);
+  801a26:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801a29:	39 c3                	cmp    %eax,%ebx
+  801a2b:	72 2e                	jb     801a5b <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801a2d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a30:	8b 40 04             	mov    0x4(%eax),%eax
+  801a33:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801a38:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  801a3b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801a3e:	c1 e2 0c             	shl    $0xc,%edx
+  801a41:	39 ca                	cmp    %ecx,%edx
+  801a43:	72 2f                	jb     801a74 <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  801a45:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  801a4a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  801a4d:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  801a51:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801a56:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  801a59:	eb 52                	jmp    801aad <devfile_read+0x154>
+  assert(r <= n);
+  801a5b:	68 d1 3b 80 00       	push   $0x803bd1
+  801a60:	68 d8 3b 80 00       	push   $0x803bd8
+  801a65:	68 49 01 00 00       	push   $0x149
+  801a6a:	68 c6 3b 80 00       	push   $0x803bc6
+  801a6f:	e8 2d e7 ff ff       	call   8001a1 <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801a74:	68 fc 3b 80 00       	push   $0x803bfc
+  801a79:	68 d8 3b 80 00       	push   $0x803bd8
+  801a7e:	68 4a 01 00 00       	push   $0x14a
+  801a83:	68 c6 3b 80 00       	push   $0x803bc6
+  801a88:	e8 14 e7 ff ff       	call   8001a1 <_panic>
+      memmove(dst + done, src + done, m);
+  801a8d:	83 ec 04             	sub    $0x4,%esp
+  801a90:	53                   	push   %ebx
+  801a91:	56                   	push   %esi
+  801a92:	89 f8                	mov    %edi,%eax
+  801a94:	03 45 0c             	add    0xc(%ebp),%eax
+  801a97:	50                   	push   %eax
+  801a98:	e8 53 ef ff ff       	call   8009f0 <memmove>
+  801a9d:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  801aa0:	01 df                	add    %ebx,%edi
+  801aa2:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801aa5:	39 c7                	cmp    %eax,%edi
+  801aa7:	0f 83 c0 00 00 00    	jae    801b6d <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801aad:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801ab0:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  801ab3:	89 f0                	mov    %esi,%eax
+  801ab5:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801aba:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  801abf:	29 c3                	sub    %eax,%ebx
+  801ac1:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801ac4:	29 f8                	sub    %edi,%eax
+  801ac6:	39 c3                	cmp    %eax,%ebx
+  801ac8:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  801acb:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801ad1:	75 ba                	jne    801a8d <devfile_read+0x134>
+  801ad3:	89 f9                	mov    %edi,%ecx
+  801ad5:	03 4d 0c             	add    0xc(%ebp),%ecx
+  801ad8:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  801adb:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  801ae1:	75 aa                	jne    801a8d <devfile_read+0x134>
+  801ae3:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  801ae9:	77 a2                	ja     801a8d <devfile_read+0x134>
+  801aeb:	89 c8                	mov    %ecx,%eax
+  801aed:	c1 e8 16             	shr    $0x16,%eax
+  801af0:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801af7:	a8 01                	test   $0x1,%al
+  801af9:	74 92                	je     801a8d <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  801afb:	89 c8                	mov    %ecx,%eax
+  801afd:	c1 e8 0c             	shr    $0xc,%eax
+  801b00:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  801b07:	a8 01                	test   $0x1,%al
+  801b09:	74 82                	je     801a8d <devfile_read+0x134>
+  801b0b:	a9 02 08 00 00       	test   $0x802,%eax
+  801b10:	0f 84 77 ff ff ff    	je     801a8d <devfile_read+0x134>
+  801b16:	f6 c4 04             	test   $0x4,%ah
+  801b19:	0f 85 6e ff ff ff    	jne    801a8d <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  801b1f:	a1 64 5e 80 00       	mov    0x805e64,%eax
+  801b24:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  801b28:	84 c0                	test   %al,%al
+  801b2a:	75 17                	jne    801b43 <devfile_read+0x1ea>
+  801b2c:	83 ec 08             	sub    $0x8,%esp
+  801b2f:	6a 01                	push   $0x1
+  801b31:	6a 00                	push   $0x0
+  801b33:	e8 1e f1 ff ff       	call   800c56 <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  801b38:	83 c4 10             	add    $0x10,%esp
+  801b3b:	85 c0                	test   %eax,%eax
+  801b3d:	0f 85 4a ff ff ff    	jne    801a8d <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  801b43:	83 ec 04             	sub    $0x4,%esp
+  801b46:	68 05 08 00 00       	push   $0x805
+  801b4b:	ff 75 cc             	push   -0x34(%ebp)
+  801b4e:	6a 00                	push   $0x0
+  801b50:	56                   	push   %esi
+  801b51:	6a 00                	push   $0x0
+  801b53:	6a 05                	push   $0x5
+  801b55:	68 40 50 80 00       	push   $0x805040
+  801b5a:	e8 8d f5 ff ff       	call   8010ec <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  801b5f:	c1 e8 1f             	shr    $0x1f,%eax
+  801b62:	08 45 cb             	or     %al,-0x35(%ebp)
+  801b65:	83 c4 20             	add    $0x20,%esp
+  801b68:	e9 33 ff ff ff       	jmp    801aa0 <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  801b6d:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  801b70:	83 ec 0c             	sub    $0xc,%esp
+  801b73:	68 40 50 80 00       	push   $0x805040
+  801b78:	e8 1f f5 ff ff       	call   80109c <sysbatch_flush>
+  801b7d:	83 c4 10             	add    $0x10,%esp
+  801b80:	85 c0                	test   %eax,%eax
+  801b82:	78 06                	js     801b8a <devfile_read+0x231>
+  801b84:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  801b88:	74 14                	je     801b9e <devfile_read+0x245>
+    memmove(dst, src, r);
+  801b8a:	83 ec 04             	sub    $0x4,%esp
+  801b8d:	ff 75 d4             	push   -0x2c(%ebp)
+  801b90:	ff 75 d0             	push   -0x30(%ebp)
+  801b93:	ff 75 0c             	push   0xc(%ebp)
+  801b96:	e8 55 ee ff ff       	call   8009f0 <memmove>
+  801b9b:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  801b9e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ba1:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  801ba4:	e9 11 fe ff ff       	jmp    8019ba <devfile_read+0x61>
+  assert(r <= n);
+  801ba9:	68 d1 3b 80 00       	push   $0x803bd1
+  801bae:	68 d8 3b 80 00       	push   $0x803bd8
+  801bb3:	68 1c 01 00 00       	push   $0x11c
+  801bb8:	68 c6 3b 80 00       	push   $0x803bc6
+  801bbd:	e8 df e5 ff ff       	call   8001a1 <_panic>
+  assert(r <= PGSIZE);
+  801bc2:	68 ed 3b 80 00       	push   $0x803bed
+  801bc7:	68 d8 3b 80 00       	push   $0x803bd8
+  801bcc:	68 1d 01 00 00       	push   $0x11d
+  801bd1:	68 c6 3b 80 00       	push   $0x803bc6
+  801bd6:	e8 c6 e5 ff ff       	call   8001a1 <_panic>
+
+00801bdb <devfile_write>:
+{
+  801bdb:	55                   	push   %ebp
+  801bdc:	89 e5                	mov    %esp,%ebp
+  801bde:	57                   	push   %edi
+  801bdf:	56                   	push   %esi
+  801be0:	53                   	push   %ebx
+  801be1:	83 ec 1c             	sub    $0x1c,%esp
+  801be4:	8b 75 08             	mov    0x8(%ebp),%esi
+  801be7:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  801bea:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  801bef:	77 39                	ja     801c2a <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801bf1:	8b 56 0c             	mov    0xc(%esi),%edx
+  801bf4:	89 15 00 60 80 00    	mov    %edx,0x806000
+  fsipcbuf.write.req_n = n;
+  801bfa:	a3 04 60 80 00       	mov    %eax,0x806004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  801bff:	83 ec 04             	sub    $0x4,%esp
+  801c02:	50                   	push   %eax
+  801c03:	ff 75 0c             	push   0xc(%ebp)
+  801c06:	68 08 60 80 00       	push   $0x806008
+  801c0b:	e8 e0 ed ff ff       	call   8009f0 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801c10:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c15:	b8 04 00 00 00       	mov    $0x4,%eax
+  801c1a:	e8 e7 fb ff ff       	call   801806 <fsipc>
+  801c1f:	83 c4 10             	add    $0x10,%esp
+}
+  801c22:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c25:	5b                   	pop    %ebx
+  801c26:	5e                   	pop    %esi
+  801c27:	5f                   	pop    %edi
+  801c28:	5d                   	pop    %ebp
+  801c29:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  801c2a:	ba 00 00 10 00       	mov    $0x100000,%edx
+  801c2f:	39 d0                	cmp    %edx,%eax
+  801c31:	89 d3                	mov    %edx,%ebx
+  801c33:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  801c36:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  801c3c:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  801c3f:	83 c7 01             	add    $0x1,%edi
+  801c42:	89 f8                	mov    %edi,%eax
+  801c44:	e8 94 fc ff ff       	call   8018dd <fsv_alloc>
+  801c49:	85 c0                	test   %eax,%eax
+  801c4b:	78 d5                	js     801c22 <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  801c4d:	83 ec 04             	sub    $0x4,%esp
+  801c50:	53                   	push   %ebx
+  801c51:	ff 75 0c             	push   0xc(%ebp)
+  801c54:	68 00 10 c0 9f       	push   $0x9fc01000
+  801c59:	e8 92 ed ff ff       	call   8009f0 <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  801c5e:	8b 46 0c             	mov    0xc(%esi),%eax
+  801c61:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  801c66:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  801c6c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801c73:	89 f9                	mov    %edi,%ecx
+  801c75:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801c7a:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801c7f:	e8 69 fa ff ff       	call   8016ed <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801c84:	6a 00                	push   $0x0
+  801c86:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801c89:	50                   	push   %eax
+  801c8a:	6a 00                	push   $0x0
+  801c8c:	6a 00                	push   $0x0
+  801c8e:	e8 6d 16 00 00       	call   803300 <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  801c93:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  801c96:	eb 8a                	jmp    801c22 <devfile_write+0x47>
+
+00801c98 <open>:
+{
+  801c98:	55                   	push   %ebp
+  801c99:	89 e5                	mov    %esp,%ebp
+  801c9b:	56                   	push   %esi
+  801c9c:	53                   	push   %ebx
+  801c9d:	83 ec 1c             	sub    $0x1c,%esp
+  801ca0:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801ca3:	56                   	push   %esi
+  801ca4:	e8 86 eb ff ff       	call   80082f <strlen>
+  801ca9:	83 c4 10             	add    $0x10,%esp
+  801cac:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801cb1:	7f 6c                	jg     801d1f <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  801cb3:	83 ec 0c             	sub    $0xc,%esp
+  801cb6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cb9:	50                   	push   %eax
+  801cba:	e8 ad f4 ff ff       	call   80116c <fd_alloc>
+  801cbf:	89 c3                	mov    %eax,%ebx
+  801cc1:	83 c4 10             	add    $0x10,%esp
+  801cc4:	85 c0                	test   %eax,%eax
+  801cc6:	78 3c                	js     801d04 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801cc8:	83 ec 08             	sub    $0x8,%esp
+  801ccb:	56                   	push   %esi
+  801ccc:	68 00 60 80 00       	push   $0x806000
+  801cd1:	e8 94 eb ff ff       	call   80086a <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801cd6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801cd9:	a3 00 64 80 00       	mov    %eax,0x806400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801cde:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801ce1:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ce6:	e8 1b fb ff ff       	call   801806 <fsipc>
+  801ceb:	89 c3                	mov    %eax,%ebx
+  801ced:	83 c4 10             	add    $0x10,%esp
+  801cf0:	85 c0                	test   %eax,%eax
+  801cf2:	78 19                	js     801d0d <open+0x75>
+  return fd2num(fd);
+  801cf4:	83 ec 0c             	sub    $0xc,%esp
+  801cf7:	ff 75 f4             	push   -0xc(%ebp)
+  801cfa:	e8 49 f4 ff ff       	call   801148 <fd2num>
+  801cff:	89 c3                	mov    %eax,%ebx
+  801d01:	83 c4 10             	add    $0x10,%esp
+}
+  801d04:	89 d8                	mov    %ebx,%eax
+  801d06:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d09:	5b                   	pop    %ebx
+  801d0a:	5e                   	pop    %esi
+  801d0b:	5d                   	pop    %ebp
+  801d0c:	c3                   	ret
+    fd_close(fd, 0);
+  801d0d:	83 ec 08             	sub    $0x8,%esp
+  801d10:	6a 00                	push   $0x0
+  801d12:	ff 75 f4             	push   -0xc(%ebp)
+  801d15:	e8 44 f5 ff ff       	call   80125e <fd_close>
+    return r;
+  801d1a:	83 c4 10             	add    $0x10,%esp
+  801d1d:	eb e5                	jmp    801d04 <open+0x6c>
+    return -E_BAD_PATH;
+  801d1f:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801d24:	eb de                	jmp    801d04 <open+0x6c>
+
+00801d26 <open_read>:
+{
+  801d26:	55                   	push   %ebp
+  801d27:	89 e5                	mov    %esp,%ebp
+  801d29:	57                   	push   %edi
+  801d2a:	56                   	push   %esi
+  801d2b:	53                   	push   %ebx
+  801d2c:	83 ec 28             	sub    $0x28,%esp
+  801d2f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  801d32:	57                   	push   %edi
+  801d33:	e8 f7 ea ff ff       	call   80082f <strlen>
+  801d38:	83 c4 10             	add    $0x10,%esp
+  801d3b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801d40:	0f 87 f6 00 00 00    	ja     801e3c <open_read+0x116>
+  801d46:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  801d48:	83 ec 0c             	sub    $0xc,%esp
+  801d4b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801d4e:	50                   	push   %eax
+  801d4f:	e8 18 f4 ff ff       	call   80116c <fd_alloc>
+  801d54:	89 c3                	mov    %eax,%ebx
+  801d56:	83 c4 10             	add    $0x10,%esp
+  801d59:	85 c0                	test   %eax,%eax
+  801d5b:	0f 88 b2 00 00 00    	js     801e13 <open_read+0xed>
+  strcpy(req->req_buf, path);
+  801d61:	83 ec 08             	sub    $0x8,%esp
+  801d64:	57                   	push   %edi
+  801d65:	68 e4 60 80 00       	push   $0x8060e4
+  801d6a:	e8 fb ea ff ff       	call   80086a <strcpy>
+  req->req_nops = 2;
+  801d6f:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  801d76:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  801d79:	c7 05 04 60 80 00 01 	movl   $0x1,0x806004
+  801d80:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  801d83:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d86:	a3 10 60 80 00       	mov    %eax,0x806010
+  req->req_ops[0].op_buf = 0;
+  801d8b:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  801d92:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  801d95:	c7 05 20 60 80 00 04 	movl   $0x4,0x806020
+  801d9c:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  801d9f:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  801da6:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  801da9:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  801dae:	29 f0                	sub    %esi,%eax
+  801db0:	3b 45 14             	cmp    0x14(%ebp),%eax
+  801db3:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  801db7:	a3 2c 60 80 00       	mov    %eax,0x80602c
+  req->req_ops[1].op_offset = 0;
+  801dbc:	c7 05 30 60 80 00 00 	movl   $0x0,0x806030
+  801dc3:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  801dc6:	83 c6 01             	add    $0x1,%esi
+  801dc9:	89 35 34 60 80 00    	mov    %esi,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  801dcf:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801dd2:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801dd7:	e8 2a fa ff ff       	call   801806 <fsipc>
+  801ddc:	89 c3                	mov    %eax,%ebx
+  801dde:	83 c4 10             	add    $0x10,%esp
+  801de1:	83 f8 01             	cmp    $0x1,%eax
+  801de4:	7e 37                	jle    801e1d <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  801de6:	a1 38 60 80 00       	mov    0x806038,%eax
+  801deb:	8b 55 18             	mov    0x18(%ebp),%edx
+  801dee:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  801df0:	83 ec 04             	sub    $0x4,%esp
+  801df3:	50                   	push   %eax
+  801df4:	81 c6 e4 60 80 00    	add    $0x8060e4,%esi
+  801dfa:	56                   	push   %esi
+  801dfb:	ff 75 10             	push   0x10(%ebp)
+  801dfe:	e8 ed eb ff ff       	call   8009f0 <memmove>
+  return fd2num(fd);
+  801e03:	83 c4 04             	add    $0x4,%esp
+  801e06:	ff 75 e4             	push   -0x1c(%ebp)
+  801e09:	e8 3a f3 ff ff       	call   801148 <fd2num>
+  801e0e:	89 c3                	mov    %eax,%ebx
+  801e10:	83 c4 10             	add    $0x10,%esp
+}
+  801e13:	89 d8                	mov    %ebx,%eax
+  801e15:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e18:	5b                   	pop    %ebx
+  801e19:	5e                   	pop    %esi
+  801e1a:	5f                   	pop    %edi
+  801e1b:	5d                   	pop    %ebp
+  801e1c:	c3                   	ret
+    fd_close(fd, 0);
+  801e1d:	83 ec 08             	sub    $0x8,%esp
+  801e20:	6a 00                	push   $0x0
+  801e22:	ff 75 e4             	push   -0x1c(%ebp)
+  801e25:	e8 34 f4 ff ff       	call   80125e <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  801e2a:	83 c4 10             	add    $0x10,%esp
+  801e2d:	85 db                	test   %ebx,%ebx
+  801e2f:	78 e2                	js     801e13 <open_read+0xed>
+  801e31:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  801e34:	8b 9b 1c 60 80 00    	mov    0x80601c(%ebx),%ebx
+  801e3a:	eb d7                	jmp    801e13 <open_read+0xed>
+    return -E_BAD_PATH;
+  801e3c:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801e41:	eb d0                	jmp    801e13 <open_read+0xed>
+
+00801e43 <file_stat>:
+{
+  801e43:	55                   	push   %ebp
+  801e44:	89 e5                	mov    %esp,%ebp
+  801e46:	57                   	push   %edi
+  801e47:	56                   	push   %esi
+  801e48:	53                   	push   %ebx
+  801e49:	83 ec 18             	sub    $0x18,%esp
+  801e4c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801e4f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801e52:	57                   	push   %edi
+  801e53:	e8 d7 e9 ff ff       	call   80082f <strlen>
+  801e58:	83 c4 10             	add    $0x10,%esp
+  801e5b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801e60:	0f 8f c7 00 00 00    	jg     801f2d <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  801e66:	83 ec 0c             	sub    $0xc,%esp
+  801e69:	57                   	push   %edi
+  801e6a:	e8 c0 e9 ff ff       	call   80082f <strlen>
+  801e6f:	8d 58 04             	lea    0x4(%eax),%ebx
+  801e72:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  801e75:	83 c4 08             	add    $0x8,%esp
+  801e78:	57                   	push   %edi
+  801e79:	68 e4 60 80 00       	push   $0x8060e4
+  801e7e:	e8 e7 e9 ff ff       	call   80086a <strcpy>
+  req->req_nops = 2;
+  801e83:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  801e8a:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  801e8d:	c7 05 04 60 80 00 02 	movl   $0x2,0x806004
+  801e94:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  801e97:	c7 05 10 60 80 00 00 	movl   $0x0,0x806010
+  801e9e:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  801ea1:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  801ea8:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  801eab:	c7 05 20 60 80 00 03 	movl   $0x3,0x806020
+  801eb2:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  801eb5:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  801ebc:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  801ebf:	89 1d 34 60 80 00    	mov    %ebx,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  801ec5:	ba 00 00 00 00       	mov    $0x0,%edx
+  801eca:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801ecf:	e8 32 f9 ff ff       	call   801806 <fsipc>
+  801ed4:	83 c4 10             	add    $0x10,%esp
+  801ed7:	83 f8 01             	cmp    $0x1,%eax
+  801eda:	7e 42                	jle    801f1e <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  801edc:	81 c3 e4 60 80 00    	add    $0x8060e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  801ee2:	83 ec 08             	sub    $0x8,%esp
+  801ee5:	53                   	push   %ebx
+  801ee6:	56                   	push   %esi
+  801ee7:	e8 7e e9 ff ff       	call   80086a <strcpy>
+  st->st_size = ret->ret_size;
+  801eec:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  801ef2:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  801ef8:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  801efe:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  801f04:	c7 86 88 00 00 00 04 	movl   $0x804004,0x88(%esi)
+  801f0b:	40 80 00 
+  return 0;
+  801f0e:	83 c4 10             	add    $0x10,%esp
+  801f11:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f16:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f19:	5b                   	pop    %ebx
+  801f1a:	5e                   	pop    %esi
+  801f1b:	5f                   	pop    %edi
+  801f1c:	5d                   	pop    %ebp
+  801f1d:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  801f1e:	85 c0                	test   %eax,%eax
+  801f20:	78 f4                	js     801f16 <file_stat+0xd3>
+  801f22:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801f25:	8b 80 1c 60 80 00    	mov    0x80601c(%eax),%eax
+  801f2b:	eb e9                	jmp    801f16 <file_stat+0xd3>
+    return -E_BAD_PATH;
+  801f2d:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801f32:	eb e2                	jmp    801f16 <file_stat+0xd3>
+
+00801f34 <read_map>:
+{
+  801f34:	55                   	push   %ebp
+  801f35:	89 e5                	mov    %esp,%ebp
+  801f37:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801f3a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f3d:	50                   	push   %eax
+  801f3e:	ff 75 08             	push   0x8(%ebp)
+  801f41:	e8 7c f2 ff ff       	call   8011c2 <fd_lookup>
+  801f46:	83 c4 10             	add    $0x10,%esp
+  801f49:	85 c0                	test   %eax,%eax
+  801f4b:	78 2a                	js     801f77 <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  801f4d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f50:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  801f56:	39 08                	cmp    %ecx,(%eax)
+  801f58:	75 1f                	jne    801f79 <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  801f5a:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f5d:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read_map.req_offset = offset;
+  801f62:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f65:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  801f6a:	8b 55 10             	mov    0x10(%ebp),%edx
+  801f6d:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801f72:	e8 8f f8 ff ff       	call   801806 <fsipc>
+}
+  801f77:	c9                   	leave
+  801f78:	c3                   	ret
+    return -E_INVAL;
+  801f79:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f7e:	eb f7                	jmp    801f77 <read_map+0x43>
+
+00801f80 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801f80:	55                   	push   %ebp
+  801f81:	89 e5                	mov    %esp,%ebp
+  801f83:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  801f86:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f8b:	b8 08 00 00 00       	mov    $0x8,%eax
+  801f90:	e8 71 f8 ff ff       	call   801806 <fsipc>
+}
+  801f95:	c9                   	leave
+  801f96:	c3                   	ret
+
+00801f97 <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  801f97:	55                   	push   %ebp
+  801f98:	89 e5                	mov    %esp,%ebp
+  801f9a:	57                   	push   %edi
+  801f9b:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  801f9c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f9f:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.stats.req_bio_sched = 0;
+  801fa4:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  801fab:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  801fae:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  801fb5:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  801fb8:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fbd:	b8 09 00 00 00       	mov    $0x9,%eax
+  801fc2:	e8 3f f8 ff ff       	call   801806 <fsipc>
+  801fc7:	85 c0                	test   %eax,%eax
+  801fc9:	78 14                	js     801fdf <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  801fcb:	be 00 60 80 00       	mov    $0x806000,%esi
+  801fd0:	b9 16 00 00 00       	mov    $0x16,%ecx
+  801fd5:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801fd8:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  801fda:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801fdf:	5e                   	pop    %esi
+  801fe0:	5f                   	pop    %edi
+  801fe1:	5d                   	pop    %ebp
+  801fe2:	c3                   	ret
+
+00801fe3 <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  801fe3:	55                   	push   %ebp
+  801fe4:	89 e5                	mov    %esp,%ebp
+  801fe6:	53                   	push   %ebx
+  801fe7:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  801fea:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801fed:	50                   	push   %eax
+  801fee:	6a 00                	push   $0x0
+  801ff0:	e8 a2 ff ff ff       	call   801f97 <fs_stats>
+  801ff5:	83 c4 10             	add    $0x10,%esp
+  801ff8:	85 c0                	test   %eax,%eax
+  801ffa:	78 28                	js     802024 <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  801ffc:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  801fff:	83 ec 08             	sub    $0x8,%esp
+  802002:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802005:	50                   	push   %eax
+  802006:	6a 20                	push   $0x20
+  802008:	e8 8a ff ff ff       	call   801f97 <fs_stats>
+  80200d:	83 c4 10             	add    $0x10,%esp
+  802010:	85 c0                	test   %eax,%eax
+  802012:	78 10                	js     802024 <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  802014:	83 ec 08             	sub    $0x8,%esp
+  802017:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  80201a:	50                   	push   %eax
+  80201b:	53                   	push   %ebx
+  80201c:	e8 76 ff ff ff       	call   801f97 <fs_stats>
+  802021:	83 c4 10             	add    $0x10,%esp
+}
+  802024:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802027:	c9                   	leave
+  802028:	c3                   	ret
+
+00802029 <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  802029:	55                   	push   %ebp
+  80202a:	89 e5                	mov    %esp,%ebp
+  80202c:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  80202f:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  802036:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  802039:	8b 45 08             	mov    0x8(%ebp),%eax
+  80203c:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.stats.req_dcache = 0;
+  802041:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  802048:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  80204b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802050:	b8 09 00 00 00       	mov    $0x9,%eax
+  802055:	e8 ac f7 ff ff       	call   801806 <fsipc>
+}
+  80205a:	c9                   	leave
+  80205b:	c3                   	ret
+
+0080205c <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  80205c:	55                   	push   %ebp
+  80205d:	89 e5                	mov    %esp,%ebp
+  80205f:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  802062:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  802069:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  80206c:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  802073:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  802076:	8b 45 08             	mov    0x8(%ebp),%eax
+  802079:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_STATS, NULL);
+  80207e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802083:	b8 09 00 00 00       	mov    $0x9,%eax
+  802088:	e8 79 f7 ff ff       	call   801806 <fsipc>
+}
+  80208d:	c9                   	leave
+  80208e:	c3                   	ret
+
+0080208f <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  80208f:	55                   	push   %ebp
+  802090:	89 e5                	mov    %esp,%ebp
+  802092:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802095:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802098:	50                   	push   %eax
+  802099:	ff 75 08             	push   0x8(%ebp)
+  80209c:	e8 21 f1 ff ff       	call   8011c2 <fd_lookup>
+  8020a1:	83 c4 10             	add    $0x10,%esp
+  8020a4:	85 c0                	test   %eax,%eax
+  8020a6:	78 34                	js     8020dc <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  8020a8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020ab:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  8020b1:	39 08                	cmp    %ecx,(%eax)
+  8020b3:	75 29                	jne    8020de <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  8020b5:	8b 40 0c             	mov    0xc(%eax),%eax
+  8020b8:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.fallocate.req_offset = offset;
+  8020bd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020c0:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.fallocate.req_len = len;
+  8020c5:	8b 45 10             	mov    0x10(%ebp),%eax
+  8020c8:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  8020cd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020d2:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8020d7:	e8 2a f7 ff ff       	call   801806 <fsipc>
+}
+  8020dc:	c9                   	leave
+  8020dd:	c3                   	ret
+    return -E_INVAL;
+  8020de:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020e3:	eb f7                	jmp    8020dc <fallocate+0x4d>
+
+008020e5 <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  8020e5:	55                   	push   %ebp
+  8020e6:	89 e5                	mov    %esp,%ebp
+  8020e8:	57                   	push   %edi
+  8020e9:	56                   	push   %esi
+  8020ea:	53                   	push   %ebx
+  8020eb:	83 ec 24             	sub    $0x24,%esp
+  8020ee:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8020f1:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8020f4:	50                   	push   %eax
+  8020f5:	ff 75 08             	push   0x8(%ebp)
+  8020f8:	e8 c5 f0 ff ff       	call   8011c2 <fd_lookup>
+  8020fd:	83 c4 10             	add    $0x10,%esp
+  802100:	85 c0                	test   %eax,%eax
+  802102:	78 66                	js     80216a <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  802104:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802107:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  80210d:	39 08                	cmp    %ecx,(%eax)
+  80210f:	75 61                	jne    802172 <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  802111:	85 f6                	test   %esi,%esi
+  802113:	7e 50                	jle    802165 <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  802115:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  80211a:	39 de                	cmp    %ebx,%esi
+  80211c:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  80211f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802122:	8b 40 0c             	mov    0xc(%eax),%eax
+  802125:	a3 00 60 80 00       	mov    %eax,0x806000
+    fsipcbuf.prefetch.req_n = m;
+  80212a:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  802130:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  802137:	83 ec 04             	sub    $0x4,%esp
+  80213a:	57                   	push   %edi
+  80213b:	ff 75 0c             	push   0xc(%ebp)
+  80213e:	68 08 60 80 00       	push   $0x806008
+  802143:	e8 a8 e8 ff ff       	call   8009f0 <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  802148:	ba 00 00 00 00       	mov    $0x0,%edx
+  80214d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802152:	e8 af f6 ff ff       	call   801806 <fsipc>
+  802157:	83 c4 10             	add    $0x10,%esp
+  80215a:	85 c0                	test   %eax,%eax
+  80215c:	78 0c                	js     80216a <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  80215e:	01 7d 0c             	add    %edi,0xc(%ebp)
+  802161:	29 de                	sub    %ebx,%esi
+  802163:	eb ac                	jmp    802111 <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  802165:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80216a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80216d:	5b                   	pop    %ebx
+  80216e:	5e                   	pop    %esi
+  80216f:	5f                   	pop    %edi
+  802170:	5d                   	pop    %ebp
+  802171:	c3                   	ret
+    return -E_INVAL;
+  802172:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802177:	eb f1                	jmp    80216a <prefetch+0x85>
+
+00802179 <spawn>:
+// argv: pointer to null-terminated array of pointers to strings,
+//   which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv)
+{
+  802179:	55                   	push   %ebp
+  80217a:	89 e5                	mov    %esp,%ebp
+  80217c:	57                   	push   %edi
+  80217d:	56                   	push   %esi
+  80217e:	53                   	push   %ebx
+  80217f:	81 ec a8 02 00 00    	sub    $0x2a8,%esp
+  //     correct initial eip and esp values in the child.
+  //
+  //   - Start the child process running with sys_env_set_status().
+
+  // Open the program and read its ELF header in one round trip.
+  if ((r = open_read(prog, O_RDONLY, elf_buf, sizeof(elf_buf), &n)) < 0)
+  802185:	8d 85 a0 fd ff ff    	lea    -0x260(%ebp),%eax
+  80218b:	50                   	push   %eax
+  80218c:	68 00 02 00 00       	push   $0x200
+  802191:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  802197:	50                   	push   %eax
+  802198:	6a 00                	push   $0x0
+  80219a:	ff 75 08             	push   0x8(%ebp)
+  80219d:	e8 84 fb ff ff       	call   801d26 <open_read>
+  8021a2:	89 85 88 fd ff ff    	mov    %eax,-0x278(%ebp)
+  8021a8:	83 c4 20             	add    $0x20,%esp
+  8021ab:	85 c0                	test   %eax,%eax
+  8021ad:	0f 88 66 06 00 00    	js     802819 <spawn+0x6a0>
+    return r;
+  fd = r;
+
+  elf = (struct Elf*)elf_buf;
+  if (n != sizeof(elf_buf) || elf->e_magic != ELF_MAGIC) {
+  8021b3:	81 bd a0 fd ff ff 00 	cmpl   $0x200,-0x260(%ebp)
+  8021ba:	02 00 00 
+  8021bd:	0f 85 92 00 00 00    	jne    802255 <spawn+0xdc>
+  8021c3:	81 bd e8 fd ff ff 7f 	cmpl   $0x464c457f,-0x218(%ebp)
+  8021ca:	45 4c 46 
+  8021cd:	0f 85 82 00 00 00    	jne    802255 <spawn+0xdc>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+  envid_t ret;
+  __asm __volatile("int %2"
+  8021d3:	b8 07 00 00 00       	mov    $0x7,%eax
+  8021d8:	cd 30                	int    $0x30
+  8021da:	89 85 90 fd ff ff    	mov    %eax,-0x270(%ebp)
+  8021e0:	89 c6                	mov    %eax,%esi
+  8021e2:	89 85 6c fd ff ff    	mov    %eax,-0x294(%ebp)
+    cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+    return -E_NOT_EXEC;
+  }
+
+  // Create new child environment
+  if ((r = sys_exofork()) < 0)
+  8021e8:	85 c0                	test   %eax,%eax
+  8021ea:	0f 88 35 06 00 00    	js     802825 <spawn+0x6ac>
+    return r;
+  child = r;
+  sysbatch_init(&batch);
+  8021f0:	83 ec 0c             	sub    $0xc,%esp
+  8021f3:	68 60 57 80 00       	push   $0x805760
+  8021f8:	e8 91 ee ff ff       	call   80108e <sysbatch_init>
+
+  // Set up trap frame, including initial stack.
+  child_tf = envs[ENVX(child)].env_tf;
+  8021fd:	89 f0                	mov    %esi,%eax
+  8021ff:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802204:	8d 34 c0             	lea    (%eax,%eax,8),%esi
+  802207:	c1 e6 04             	shl    $0x4,%esi
+  80220a:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  802210:	8d bd a4 fd ff ff    	lea    -0x25c(%ebp),%edi
+  802216:	b9 11 00 00 00       	mov    $0x11,%ecx
+  80221b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  child_tf.tf_eip = elf->e_entry;
+  80221d:	8b 85 00 fe ff ff    	mov    -0x200(%ebp),%eax
+  802223:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  uintptr_t *argv_store;
+
+  // Count the number of arguments (argc)
+  // and the total amount of space needed for strings (string_size).
+  string_size = 0;
+  for (argc = 0; argv[argc] != 0; argc++)
+  802229:	83 c4 10             	add    $0x10,%esp
+  80222c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  string_size = 0;
+  802231:	be 00 00 00 00       	mov    $0x0,%esi
+  802236:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  for (argc = 0; argv[argc] != 0; argc++)
+  802239:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+  80223c:	85 c0                	test   %eax,%eax
+  80223e:	74 4d                	je     80228d <spawn+0x114>
+    string_size += strlen(argv[argc]) + 1;
+  802240:	83 ec 0c             	sub    $0xc,%esp
+  802243:	50                   	push   %eax
+  802244:	e8 e6 e5 ff ff       	call   80082f <strlen>
+  802249:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+  for (argc = 0; argv[argc] != 0; argc++)
+  80224d:	83 c3 01             	add    $0x1,%ebx
+  802250:	83 c4 10             	add    $0x10,%esp
+  802253:	eb e4                	jmp    802239 <spawn+0xc0>
+    close(fd);
+  802255:	83 ec 0c             	sub    $0xc,%esp
+  802258:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  80225e:	e8 82 f0 ff ff       	call   8012e5 <close>
+    cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  802263:	83 c4 0c             	add    $0xc,%esp
+  802266:	68 7f 45 4c 46       	push   $0x464c457f
+  80226b:	ff b5 e8 fd ff ff    	push   -0x218(%ebp)
+  802271:	68 28 3c 80 00       	push   $0x803c28
+  802276:	e8 01 e0 ff ff       	call   80027c <cprintf>
+    return -E_NOT_EXEC;
+  80227b:	83 c4 10             	add    $0x10,%esp
+  80227e:	c7 85 6c fd ff ff f2 	movl   $0xfffffff2,-0x294(%ebp)
+  802285:	ff ff ff 
+  802288:	e9 98 05 00 00       	jmp    802825 <spawn+0x6ac>
+  // Determine where to place the strings and the argv array.
+  // Set up pointers into the temporary page 'UTEMP'; we'll map a page
+  // there later, then remap that page into the child environment
+  // at (USTACKTOP - PGSIZE).
+  // strings is the topmost thing on the stack.
+  string_store = (char*)UTEMP + PGSIZE - string_size;
+  80228d:	89 9d 84 fd ff ff    	mov    %ebx,-0x27c(%ebp)
+  802293:	bf 00 10 40 00       	mov    $0x401000,%edi
+  802298:	29 f7                	sub    %esi,%edi
+  // argv is below that.  There's one argument pointer per argument, plus
+  // a null pointer.
+  argv_store = (uintptr_t*)(ROUNDDOWN(string_store, 4) - 4 * (argc + 1));
+  80229a:	89 fa                	mov    %edi,%edx
+  80229c:	83 e2 fc             	and    $0xfffffffc,%edx
+  80229f:	8d 04 9d 04 00 00 00 	lea    0x4(,%ebx,4),%eax
+  8022a6:	29 c2                	sub    %eax,%edx
+  8022a8:	89 95 94 fd ff ff    	mov    %edx,-0x26c(%ebp)
+
+  // Make sure that argv, strings, and the 2 words that hold 'argc'
+  // and 'argv' themselves will all fit in a single stack page.
+  if ((void*)(argv_store - 2) < (void*)UTEMP)
+  8022ae:	8d 42 f8             	lea    -0x8(%edx),%eax
+  8022b1:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  8022b6:	0f 86 a8 05 00 00    	jbe    802864 <spawn+0x6eb>
+    return -E_NO_MEM;
+
+  // Allocate the single stack page at UTEMP.
+  if ((r = sys_page_alloc(0, (void*)UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  8022bc:	83 ec 04             	sub    $0x4,%esp
+  8022bf:	6a 07                	push   $0x7
+  8022c1:	68 00 00 40 00       	push   $0x400000
+  8022c6:	6a 00                	push   $0x0
+  8022c8:	e8 cc e9 ff ff       	call   800c99 <sys_page_alloc>
+  8022cd:	83 c4 10             	add    $0x10,%esp
+  8022d0:	85 c0                	test   %eax,%eax
+  8022d2:	0f 88 91 05 00 00    	js     802869 <spawn+0x6f0>
+  //	  (Again, argv should use an address valid in the child's
+  //	  environment.)
+  //
+  //	* Set *init_esp to the initial stack pointer for the child,
+  //	  (Again, use an address valid in the child's environment.)
+  for (i = 0; i < argc; i++) {
+  8022d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8022dd:	89 9d 8c fd ff ff    	mov    %ebx,-0x274(%ebp)
+  8022e3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8022e6:	eb 30                	jmp    802318 <spawn+0x19f>
+    argv_store[i] = UTEMP2USTACK(string_store);
+  8022e8:	8d 87 00 d0 7f ee    	lea    -0x11803000(%edi),%eax
+  8022ee:	8b 8d 94 fd ff ff    	mov    -0x26c(%ebp),%ecx
+  8022f4:	89 04 b1             	mov    %eax,(%ecx,%esi,4)
+    strcpy(string_store, argv[i]);
+  8022f7:	83 ec 08             	sub    $0x8,%esp
+  8022fa:	ff 34 b3             	push   (%ebx,%esi,4)
+  8022fd:	57                   	push   %edi
+  8022fe:	e8 67 e5 ff ff       	call   80086a <strcpy>
+    string_store += strlen(argv[i]) + 1;
+  802303:	83 c4 04             	add    $0x4,%esp
+  802306:	ff 34 b3             	push   (%ebx,%esi,4)
+  802309:	e8 21 e5 ff ff       	call   80082f <strlen>
+  80230e:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+  for (i = 0; i < argc; i++) {
+  802312:	83 c6 01             	add    $0x1,%esi
+  802315:	83 c4 10             	add    $0x10,%esp
+  802318:	39 b5 8c fd ff ff    	cmp    %esi,-0x274(%ebp)
+  80231e:	7f c8                	jg     8022e8 <spawn+0x16f>
+  }
+  argv_store[argc] = 0;
+  802320:	8b 85 94 fd ff ff    	mov    -0x26c(%ebp),%eax
+  802326:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  80232c:	c7 04 88 00 00 00 00 	movl   $0x0,(%eax,%ecx,4)
+  assert(string_store == (char*)UTEMP + PGSIZE);
+  802333:	81 ff 00 10 40 00    	cmp    $0x401000,%edi
+  802339:	0f 85 97 00 00 00    	jne    8023d6 <spawn+0x25d>
+
+  argv_store[-1] = UTEMP2USTACK(argv_store);
+  80233f:	8b 8d 94 fd ff ff    	mov    -0x26c(%ebp),%ecx
+  802345:	8d 81 00 d0 7f ee    	lea    -0x11803000(%ecx),%eax
+  80234b:	89 41 fc             	mov    %eax,-0x4(%ecx)
+  argv_store[-2] = argc;
+  80234e:	89 c8                	mov    %ecx,%eax
+  802350:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  802356:	89 48 f8             	mov    %ecx,-0x8(%eax)
+
+  *init_esp = UTEMP2USTACK(&argv_store[-2]);
+  802359:	2d 08 30 80 11       	sub    $0x11803008,%eax
+  80235e:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+
+  // After completing the stack, map it into the child's address space
+  // and unmap it from ours!  Both calls ride along with the first batch
+  // of segment mappings.
+  if ((r = sysbatch_add(&batch, SYS_page_map, 0, (uint32_t) UTEMP, child,
+  802364:	83 ec 04             	sub    $0x4,%esp
+  802367:	6a 07                	push   $0x7
+  802369:	68 00 d0 bf ee       	push   $0xeebfd000
+  80236e:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  802374:	68 00 00 40 00       	push   $0x400000
+  802379:	6a 00                	push   $0x0
+  80237b:	6a 05                	push   $0x5
+  80237d:	68 60 57 80 00       	push   $0x805760
+  802382:	e8 65 ed ff ff       	call   8010ec <sysbatch_add>
+  802387:	89 c3                	mov    %eax,%ebx
+  802389:	83 c4 20             	add    $0x20,%esp
+  80238c:	85 c0                	test   %eax,%eax
+  80238e:	0f 88 dd 04 00 00    	js     802871 <spawn+0x6f8>
+                        USTACKTOP - PGSIZE, PTE_P | PTE_U | PTE_W)) < 0)
+    goto error;
+  if ((r = sysbatch_add(&batch, SYS_page_unmap, 0, (uint32_t) UTEMP,
+  802394:	83 ec 04             	sub    $0x4,%esp
+  802397:	6a 00                	push   $0x0
+  802399:	6a 00                	push   $0x0
+  80239b:	6a 00                	push   $0x0
+  80239d:	68 00 00 40 00       	push   $0x400000
+  8023a2:	6a 00                	push   $0x0
+  8023a4:	6a 06                	push   $0x6
+  8023a6:	68 60 57 80 00       	push   $0x805760
+  8023ab:	e8 3c ed ff ff       	call   8010ec <sysbatch_add>
+  8023b0:	89 c3                	mov    %eax,%ebx
+  8023b2:	83 c4 20             	add    $0x20,%esp
+  8023b5:	85 c0                	test   %eax,%eax
+  8023b7:	0f 88 b4 04 00 00    	js     802871 <spawn+0x6f8>
+  ph = (struct Proghdr*)(elf_buf + elf->e_phoff);
+  8023bd:	8b 85 04 fe ff ff    	mov    -0x1fc(%ebp),%eax
+  8023c3:	8d bc 05 e8 fd ff ff 	lea    -0x218(%ebp,%eax,1),%edi
+  for (i = 0; i < elf->e_phnum; i++, ph++) {
+  8023ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023cf:	89 d6                	mov    %edx,%esi
+  8023d1:	e9 dd 01 00 00       	jmp    8025b3 <spawn+0x43a>
+  assert(string_store == (char*)UTEMP + PGSIZE);
+  8023d6:	68 a0 3c 80 00       	push   $0x803ca0
+  8023db:	68 d8 3b 80 00       	push   $0x803bd8
+  8023e0:	68 01 01 00 00       	push   $0x101
+  8023e5:	68 42 3c 80 00       	push   $0x803c42
+  8023ea:	e8 b2 dd ff ff       	call   8001a1 <_panic>
+
+  for (i = 0; i < memsz; i += n * PGSIZE) {
+    if (i >= filesz) {
+      // allocate a blank page
+      n = 1;
+      if ((r = sysbatch_add(&batch, SYS_page_alloc, child, va + i,
+  8023ef:	83 ec 04             	sub    $0x4,%esp
+  8023f2:	6a 00                	push   $0x0
+  8023f4:	6a 00                	push   $0x0
+  8023f6:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  8023fc:	8b 85 78 fd ff ff    	mov    -0x288(%ebp),%eax
+  802402:	8b 8d 70 fd ff ff    	mov    -0x290(%ebp),%ecx
+  802408:	01 c8                	add    %ecx,%eax
+  80240a:	50                   	push   %eax
+  80240b:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  802411:	6a 04                	push   $0x4
+  802413:	68 60 57 80 00       	push   $0x805760
+  802418:	e8 cf ec ff ff       	call   8010ec <sysbatch_add>
+  80241d:	83 c4 20             	add    $0x20,%esp
+  802420:	85 c0                	test   %eax,%eax
+  802422:	0f 88 0b 04 00 00    	js     802833 <spawn+0x6ba>
+      n = 1;
+  802428:	bf 01 00 00 00       	mov    $0x1,%edi
+  for (i = 0; i < memsz; i += n * PGSIZE) {
+  80242d:	89 f8                	mov    %edi,%eax
+  80242f:	c1 e0 0c             	shl    $0xc,%eax
+  802432:	01 85 84 fd ff ff    	add    %eax,-0x27c(%ebp)
+  802438:	e9 fc 01 00 00       	jmp    802639 <spawn+0x4c0>
+  80243d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802442:	eb 0e                	jmp    802452 <spawn+0x2d9>
+  802444:	8b bd 60 fd ff ff    	mov    -0x2a0(%ebp),%edi
+  80244a:	e9 c1 00 00 00       	jmp    802510 <spawn+0x397>
+          return r;
+        if (r < MIN(PGSIZE, filesz - i - j * PGSIZE))
+          return -E_INVAL;
+      }
+    } else {
+      for (j = 0; j < n; j++)
+  80244f:	83 c3 01             	add    $0x1,%ebx
+  802452:	39 df                	cmp    %ebx,%edi
+  802454:	7e 55                	jle    8024ab <spawn+0x332>
+        if ((r = sysbatch_add(&batch, SYS_page_alloc, 0,
+  802456:	83 ec 04             	sub    $0x4,%esp
+  802459:	6a 00                	push   $0x0
+  80245b:	6a 00                	push   $0x0
+  80245d:	6a 07                	push   $0x7
+  80245f:	89 d8                	mov    %ebx,%eax
+  802461:	c1 e0 0c             	shl    $0xc,%eax
+  802464:	05 00 10 40 00       	add    $0x401000,%eax
+  802469:	50                   	push   %eax
+  80246a:	6a 00                	push   $0x0
+  80246c:	6a 04                	push   $0x4
+  80246e:	68 60 57 80 00       	push   $0x805760
+  802473:	e8 74 ec ff ff       	call   8010ec <sysbatch_add>
+  802478:	83 c4 20             	add    $0x20,%esp
+  80247b:	85 c0                	test   %eax,%eax
+  80247d:	79 d0                	jns    80244f <spawn+0x2d6>
+  80247f:	89 c6                	mov    %eax,%esi
+  sys_env_destroy(child);
+  802481:	83 ec 0c             	sub    $0xc,%esp
+  802484:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  80248a:	e8 48 e7 ff ff       	call   800bd7 <sys_env_destroy>
+  close(fd);
+  80248f:	83 c4 04             	add    $0x4,%esp
+  802492:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  802498:	e8 48 ee ff ff       	call   8012e5 <close>
+  return r;
+  80249d:	83 c4 10             	add    $0x10,%esp
+  8024a0:	89 b5 6c fd ff ff    	mov    %esi,-0x294(%ebp)
+  8024a6:	e9 7a 03 00 00       	jmp    802825 <spawn+0x6ac>
+                              (uint32_t) UTEMP2 + j * PGSIZE,
+                              PTE_P|PTE_U|PTE_W, 0, 0)) < 0)
+          return r;
+      if ((r = sysbatch_flush(&batch)) < 0)
+  8024ab:	83 ec 0c             	sub    $0xc,%esp
+  8024ae:	68 60 57 80 00       	push   $0x805760
+  8024b3:	e8 e4 eb ff ff       	call   80109c <sysbatch_flush>
+  8024b8:	83 c4 10             	add    $0x10,%esp
+  8024bb:	85 c0                	test   %eax,%eax
+  8024bd:	0f 88 85 03 00 00    	js     802848 <spawn+0x6cf>
+        return r;
+      if ((r = seek(fd, fileoffset + i)) < 0)
+  8024c3:	83 ec 08             	sub    $0x8,%esp
+  8024c6:	8b 85 74 fd ff ff    	mov    -0x28c(%ebp),%eax
+  8024cc:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  8024d2:	01 c8                	add    %ecx,%eax
+  8024d4:	50                   	push   %eax
+  8024d5:	8b 9d 88 fd ff ff    	mov    -0x278(%ebp),%ebx
+  8024db:	53                   	push   %ebx
+  8024dc:	e8 dc f0 ff ff       	call   8015bd <seek>
+  8024e1:	83 c4 10             	add    $0x10,%esp
+  8024e4:	85 c0                	test   %eax,%eax
+  8024e6:	0f 88 63 03 00 00    	js     80284f <spawn+0x6d6>
+        return r;
+      if ((r = readn(fd, UTEMP2, MIN(n * PGSIZE, filesz - i))) < 0)
+  8024ec:	83 ec 04             	sub    $0x4,%esp
+  8024ef:	89 f8                	mov    %edi,%eax
+  8024f1:	c1 e0 0c             	shl    $0xc,%eax
+  8024f4:	39 f0                	cmp    %esi,%eax
+  8024f6:	0f 47 c6             	cmova  %esi,%eax
+  8024f9:	50                   	push   %eax
+  8024fa:	68 00 10 40 00       	push   $0x401000
+  8024ff:	53                   	push   %ebx
+  802500:	e8 ef ef ff ff       	call   8014f4 <readn>
+  802505:	83 c4 10             	add    $0x10,%esp
+  802508:	85 c0                	test   %eax,%eax
+  80250a:	0f 88 46 03 00 00    	js     802856 <spawn+0x6dd>
+        return r;
+    }
+    for (j = 0; j < n; j++) {
+  802510:	8d b7 01 04 00 00    	lea    0x401(%edi),%esi
+  802516:	c1 e6 0c             	shl    $0xc,%esi
+  802519:	bb 00 10 40 00       	mov    $0x401000,%ebx
+      if ((r = sysbatch_add(&batch, SYS_page_map, 0,
+  80251e:	8b 85 70 fd ff ff    	mov    -0x290(%ebp),%eax
+  802524:	8b 8d 78 fd ff ff    	mov    -0x288(%ebp),%ecx
+  80252a:	8d 84 08 00 f0 bf ff 	lea    -0x401000(%eax,%ecx,1),%eax
+  802531:	89 bd 80 fd ff ff    	mov    %edi,-0x280(%ebp)
+  802537:	89 c7                	mov    %eax,%edi
+    for (j = 0; j < n; j++) {
+  802539:	39 f3                	cmp    %esi,%ebx
+  80253b:	74 59                	je     802596 <spawn+0x41d>
+      if ((r = sysbatch_add(&batch, SYS_page_map, 0,
+  80253d:	83 ec 04             	sub    $0x4,%esp
+  802540:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  802546:	8d 04 1f             	lea    (%edi,%ebx,1),%eax
+  802549:	50                   	push   %eax
+  80254a:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  802550:	53                   	push   %ebx
+  802551:	6a 00                	push   $0x0
+  802553:	6a 05                	push   $0x5
+  802555:	68 60 57 80 00       	push   $0x805760
+  80255a:	e8 8d eb ff ff       	call   8010ec <sysbatch_add>
+  80255f:	83 c4 20             	add    $0x20,%esp
+  802562:	85 c0                	test   %eax,%eax
+  802564:	0f 88 f3 02 00 00    	js     80285d <spawn+0x6e4>
+                            (uint32_t) UTEMP2 + j * PGSIZE, child,
+                            va + i + j * PGSIZE, perm)) < 0)
+        return r;
+      if ((r = sysbatch_add(&batch, SYS_page_unmap, 0,
+  80256a:	83 ec 04             	sub    $0x4,%esp
+  80256d:	6a 00                	push   $0x0
+  80256f:	6a 00                	push   $0x0
+  802571:	6a 00                	push   $0x0
+  802573:	53                   	push   %ebx
+  802574:	6a 00                	push   $0x0
+  802576:	6a 06                	push   $0x6
+  802578:	68 60 57 80 00       	push   $0x805760
+  80257d:	e8 6a eb ff ff       	call   8010ec <sysbatch_add>
+  802582:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802588:	83 c4 20             	add    $0x20,%esp
+  80258b:	85 c0                	test   %eax,%eax
+  80258d:	79 aa                	jns    802539 <spawn+0x3c0>
+  80258f:	89 c6                	mov    %eax,%esi
+  802591:	e9 eb fe ff ff       	jmp    802481 <spawn+0x308>
+  802596:	8b bd 80 fd ff ff    	mov    -0x280(%ebp),%edi
+  80259c:	e9 8c fe ff ff       	jmp    80242d <spawn+0x2b4>
+  8025a1:	8b b5 68 fd ff ff    	mov    -0x298(%ebp),%esi
+  8025a7:	8b bd 64 fd ff ff    	mov    -0x29c(%ebp),%edi
+  for (i = 0; i < elf->e_phnum; i++, ph++) {
+  8025ad:	83 c6 01             	add    $0x1,%esi
+  8025b0:	83 c7 20             	add    $0x20,%edi
+  8025b3:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  8025ba:	39 f0                	cmp    %esi,%eax
+  8025bc:	0f 8e 9b 01 00 00    	jle    80275d <spawn+0x5e4>
+    if (ph->p_type != ELF_PROG_LOAD)
+  8025c2:	83 3f 01             	cmpl   $0x1,(%edi)
+  8025c5:	75 e6                	jne    8025ad <spawn+0x434>
+    if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  8025c7:	8b 47 18             	mov    0x18(%edi),%eax
+  8025ca:	83 e0 02             	and    $0x2,%eax
+    perm = PTE_P | PTE_U;
+  8025cd:	83 f8 01             	cmp    $0x1,%eax
+  8025d0:	19 c0                	sbb    %eax,%eax
+  8025d2:	83 e0 fe             	and    $0xfffffffe,%eax
+  8025d5:	83 c0 07             	add    $0x7,%eax
+  8025d8:	89 85 94 fd ff ff    	mov    %eax,-0x26c(%ebp)
+    if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  8025de:	8b 57 04             	mov    0x4(%edi),%edx
+  8025e1:	89 95 74 fd ff ff    	mov    %edx,-0x28c(%ebp)
+  8025e7:	8b 5f 10             	mov    0x10(%edi),%ebx
+  8025ea:	89 9d 8c fd ff ff    	mov    %ebx,-0x274(%ebp)
+  8025f0:	8b 47 14             	mov    0x14(%edi),%eax
+  8025f3:	89 85 7c fd ff ff    	mov    %eax,-0x284(%ebp)
+  8025f9:	8b 4f 08             	mov    0x8(%edi),%ecx
+  if ((i = PGOFF(va))) {
+  8025fc:	89 c8                	mov    %ecx,%eax
+  8025fe:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802603:	74 18                	je     80261d <spawn+0x4a4>
+    va -= i;
+  802605:	29 c1                	sub    %eax,%ecx
+    memsz += i;
+  802607:	01 85 7c fd ff ff    	add    %eax,-0x284(%ebp)
+    filesz += i;
+  80260d:	01 c3                	add    %eax,%ebx
+  80260f:	89 9d 8c fd ff ff    	mov    %ebx,-0x274(%ebp)
+    fileoffset -= i;
+  802615:	29 c2                	sub    %eax,%edx
+  802617:	89 95 74 fd ff ff    	mov    %edx,-0x28c(%ebp)
+  for (i = 0; i < memsz; i += n * PGSIZE) {
+  80261d:	c7 85 84 fd ff ff 00 	movl   $0x0,-0x27c(%ebp)
+  802624:	00 00 00 
+  802627:	89 8d 70 fd ff ff    	mov    %ecx,-0x290(%ebp)
+  80262d:	89 b5 68 fd ff ff    	mov    %esi,-0x298(%ebp)
+  802633:	89 bd 64 fd ff ff    	mov    %edi,-0x29c(%ebp)
+  802639:	8b 85 84 fd ff ff    	mov    -0x27c(%ebp),%eax
+  80263f:	89 85 78 fd ff ff    	mov    %eax,-0x288(%ebp)
+  802645:	8b 8d 7c fd ff ff    	mov    -0x284(%ebp),%ecx
+  80264b:	39 c8                	cmp    %ecx,%eax
+  80264d:	0f 83 4e ff ff ff    	jae    8025a1 <spawn+0x428>
+    if (i >= filesz) {
+  802653:	8b 8d 8c fd ff ff    	mov    -0x274(%ebp),%ecx
+  802659:	39 8d 84 fd ff ff    	cmp    %ecx,-0x27c(%ebp)
+  80265f:	0f 83 8a fd ff ff    	jae    8023ef <spawn+0x276>
+    n = MIN(SEGCHUNK, ROUNDUP(filesz - i, PGSIZE) / PGSIZE);
+  802665:	8b b5 8c fd ff ff    	mov    -0x274(%ebp),%esi
+  80266b:	8b 85 78 fd ff ff    	mov    -0x288(%ebp),%eax
+  802671:	29 c6                	sub    %eax,%esi
+  802673:	8d 86 ff 0f 00 00    	lea    0xfff(%esi),%eax
+  802679:	c1 e8 0c             	shr    $0xc,%eax
+  80267c:	ba 10 00 00 00       	mov    $0x10,%edx
+  802681:	39 d0                	cmp    %edx,%eax
+  802683:	0f 47 c2             	cmova  %edx,%eax
+  802686:	89 c7                	mov    %eax,%edi
+  if ((perm & PTE_W) || PGOFF(fileoffset))
+  802688:	8b 9d 94 fd ff ff    	mov    -0x26c(%ebp),%ebx
+  80268e:	83 e3 02             	and    $0x2,%ebx
+  802691:	8b 95 74 fd ff ff    	mov    -0x28c(%ebp),%edx
+  802697:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  80269d:	09 d3                	or     %edx,%ebx
+  80269f:	0f 85 98 fd ff ff    	jne    80243d <spawn+0x2c4>
+    n = MIN(n, (filesz - i) / PGSIZE);
+  8026a5:	89 f2                	mov    %esi,%edx
+  8026a7:	c1 ea 0c             	shr    $0xc,%edx
+  8026aa:	39 c2                	cmp    %eax,%edx
+  8026ac:	0f 47 d0             	cmova  %eax,%edx
+  8026af:	8b 8d 7c fd ff ff    	mov    -0x284(%ebp),%ecx
+  8026b5:	39 8d 8c fd ff ff    	cmp    %ecx,-0x274(%ebp)
+  8026bb:	0f 43 d0             	cmovae %eax,%edx
+    if ((m = shared_pages(perm, memsz, filesz, fileoffset, i, n)) > 0) {
+  8026be:	89 95 60 fd ff ff    	mov    %edx,-0x2a0(%ebp)
+  8026c4:	85 d2                	test   %edx,%edx
+  8026c6:	0f 8e 86 fd ff ff    	jle    802452 <spawn+0x2d9>
+      if ((r = sysbatch_flush(&batch)) < 0)
+  8026cc:	83 ec 0c             	sub    $0xc,%esp
+  8026cf:	68 60 57 80 00       	push   $0x805760
+  8026d4:	e8 c3 e9 ff ff       	call   80109c <sysbatch_flush>
+  8026d9:	83 c4 10             	add    $0x10,%esp
+  8026dc:	85 c0                	test   %eax,%eax
+  8026de:	0f 88 56 01 00 00    	js     80283a <spawn+0x6c1>
+  8026e4:	8b 85 60 fd ff ff    	mov    -0x2a0(%ebp),%eax
+  8026ea:	c1 e0 0c             	shl    $0xc,%eax
+  8026ed:	89 f1                	mov    %esi,%ecx
+  8026ef:	29 c1                	sub    %eax,%ecx
+  8026f1:	89 8d 80 fd ff ff    	mov    %ecx,-0x280(%ebp)
+  8026f7:	89 f3                	mov    %esi,%ebx
+        if ((r = read_map(fd, fileoffset + i + j * PGSIZE,
+  8026f9:	8d be 00 10 40 00    	lea    0x401000(%esi),%edi
+  8026ff:	8b 8d 74 fd ff ff    	mov    -0x28c(%ebp),%ecx
+  802705:	8b 85 8c fd ff ff    	mov    -0x274(%ebp),%eax
+  80270b:	8d 34 01             	lea    (%ecx,%eax,1),%esi
+      for (j = 0; j < n; j++) {
+  80270e:	8b 85 80 fd ff ff    	mov    -0x280(%ebp),%eax
+  802714:	39 c3                	cmp    %eax,%ebx
+  802716:	0f 84 28 fd ff ff    	je     802444 <spawn+0x2cb>
+        if ((r = read_map(fd, fileoffset + i + j * PGSIZE,
+  80271c:	83 ec 04             	sub    $0x4,%esp
+  80271f:	89 f8                	mov    %edi,%eax
+  802721:	29 d8                	sub    %ebx,%eax
+  802723:	50                   	push   %eax
+  802724:	89 f0                	mov    %esi,%eax
+  802726:	29 d8                	sub    %ebx,%eax
+  802728:	50                   	push   %eax
+  802729:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  80272f:	e8 00 f8 ff ff       	call   801f34 <read_map>
+  802734:	83 c4 10             	add    $0x10,%esp
+  802737:	85 c0                	test   %eax,%eax
+  802739:	0f 88 02 01 00 00    	js     802841 <spawn+0x6c8>
+        if (r < MIN(PGSIZE, filesz - i - j * PGSIZE))
+  80273f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802744:	39 d3                	cmp    %edx,%ebx
+  802746:	0f 46 d3             	cmovbe %ebx,%edx
+  802749:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  80274f:	39 d0                	cmp    %edx,%eax
+  802751:	73 bb                	jae    80270e <spawn+0x595>
+          return -E_INVAL;
+  802753:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+  802758:	e9 24 fd ff ff       	jmp    802481 <spawn+0x308>
+  close(fd);
+  80275d:	83 ec 0c             	sub    $0xc,%esp
+  802760:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  802766:	e8 7a eb ff ff       	call   8012e5 <close>
+// Copy the mappings for shared pages into the child address space.
+static int
+copy_shared_pages(envid_t child)
+{
+  // LAB 5: Your code here.
+  return sysbatch_add(&batch, SYS_page_map_range, 0, 0, UTOP,
+  80276b:	83 c4 0c             	add    $0xc,%esp
+  80276e:	6a 02                	push   $0x2
+  802770:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  802776:	68 00 00 c0 ee       	push   $0xeec00000
+  80277b:	6a 00                	push   $0x0
+  80277d:	6a 00                	push   $0x0
+  80277f:	6a 11                	push   $0x11
+  802781:	68 60 57 80 00       	push   $0x805760
+  802786:	e8 61 e9 ff ff       	call   8010ec <sysbatch_add>
+  if ((r = copy_shared_pages(child)) < 0)
+  80278b:	83 c4 20             	add    $0x20,%esp
+  80278e:	85 c0                	test   %eax,%eax
+  802790:	78 72                	js     802804 <spawn+0x68b>
+  if ((r = sysbatch_add(&batch, SYS_env_set_trapframe, child,
+  802792:	83 ec 04             	sub    $0x4,%esp
+  802795:	6a 00                	push   $0x0
+  802797:	6a 00                	push   $0x0
+  802799:	6a 00                	push   $0x0
+  80279b:	8d 85 a4 fd ff ff    	lea    -0x25c(%ebp),%eax
+  8027a1:	50                   	push   %eax
+  8027a2:	8b bd 90 fd ff ff    	mov    -0x270(%ebp),%edi
+  8027a8:	57                   	push   %edi
+  8027a9:	6a 09                	push   $0x9
+  8027ab:	68 60 57 80 00       	push   $0x805760
+  8027b0:	e8 37 e9 ff ff       	call   8010ec <sysbatch_add>
+  8027b5:	83 c4 20             	add    $0x20,%esp
+  8027b8:	85 c0                	test   %eax,%eax
+  8027ba:	78 33                	js     8027ef <spawn+0x676>
+      (r = sysbatch_add(&batch, SYS_env_set_status, child,
+  8027bc:	83 ec 04             	sub    $0x4,%esp
+  8027bf:	6a 00                	push   $0x0
+  8027c1:	6a 00                	push   $0x0
+  8027c3:	6a 00                	push   $0x0
+  8027c5:	6a 02                	push   $0x2
+  8027c7:	57                   	push   %edi
+  8027c8:	6a 08                	push   $0x8
+  8027ca:	68 60 57 80 00       	push   $0x805760
+  8027cf:	e8 18 e9 ff ff       	call   8010ec <sysbatch_add>
+                        (uint32_t) &child_tf, 0, 0, 0)) < 0 ||
+  8027d4:	83 c4 20             	add    $0x20,%esp
+  8027d7:	85 c0                	test   %eax,%eax
+  8027d9:	78 14                	js     8027ef <spawn+0x676>
+      (r = sysbatch_flush(&batch)) < 0)
+  8027db:	83 ec 0c             	sub    $0xc,%esp
+  8027de:	68 60 57 80 00       	push   $0x805760
+  8027e3:	e8 b4 e8 ff ff       	call   80109c <sysbatch_flush>
+                        ENV_RUNNABLE, 0, 0, 0)) < 0 ||
+  8027e8:	83 c4 10             	add    $0x10,%esp
+  8027eb:	85 c0                	test   %eax,%eax
+  8027ed:	79 36                	jns    802825 <spawn+0x6ac>
+    panic("spawn: starting child: %e", r);
+  8027ef:	50                   	push   %eax
+  8027f0:	68 64 3c 80 00       	push   $0x803c64
+  8027f5:	68 93 00 00 00       	push   $0x93
+  8027fa:	68 42 3c 80 00       	push   $0x803c42
+  8027ff:	e8 9d d9 ff ff       	call   8001a1 <_panic>
+    panic("copy_shared_pages: %e", r);
+  802804:	50                   	push   %eax
+  802805:	68 4e 3c 80 00       	push   $0x803c4e
+  80280a:	68 8c 00 00 00       	push   $0x8c
+  80280f:	68 42 3c 80 00       	push   $0x803c42
+  802814:	e8 88 d9 ff ff       	call   8001a1 <_panic>
+    return r;
+  802819:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  80281f:	89 85 6c fd ff ff    	mov    %eax,-0x294(%ebp)
+}
+  802825:	8b 85 6c fd ff ff    	mov    -0x294(%ebp),%eax
+  80282b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80282e:	5b                   	pop    %ebx
+  80282f:	5e                   	pop    %esi
+  802830:	5f                   	pop    %edi
+  802831:	5d                   	pop    %ebp
+  802832:	c3                   	ret
+  802833:	89 c6                	mov    %eax,%esi
+  802835:	e9 47 fc ff ff       	jmp    802481 <spawn+0x308>
+  80283a:	89 c6                	mov    %eax,%esi
+  80283c:	e9 40 fc ff ff       	jmp    802481 <spawn+0x308>
+  802841:	89 c6                	mov    %eax,%esi
+  802843:	e9 39 fc ff ff       	jmp    802481 <spawn+0x308>
+  802848:	89 c6                	mov    %eax,%esi
+  80284a:	e9 32 fc ff ff       	jmp    802481 <spawn+0x308>
+  80284f:	89 c6                	mov    %eax,%esi
+  802851:	e9 2b fc ff ff       	jmp    802481 <spawn+0x308>
+  802856:	89 c6                	mov    %eax,%esi
+  802858:	e9 24 fc ff ff       	jmp    802481 <spawn+0x308>
+  80285d:	89 c6                	mov    %eax,%esi
+  80285f:	e9 1d fc ff ff       	jmp    802481 <spawn+0x308>
+    return -E_NO_MEM;
+  802864:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  return r;
+  802869:	89 85 6c fd ff ff    	mov    %eax,-0x294(%ebp)
+  80286f:	eb b4                	jmp    802825 <spawn+0x6ac>
+  sys_page_unmap(0, UTEMP);
+  802871:	83 ec 08             	sub    $0x8,%esp
+  802874:	68 00 00 40 00       	push   $0x400000
+  802879:	6a 00                	push   $0x0
+  80287b:	e8 9e e4 ff ff       	call   800d1e <sys_page_unmap>
+  802880:	83 c4 10             	add    $0x10,%esp
+  802883:	89 9d 6c fd ff ff    	mov    %ebx,-0x294(%ebp)
+  802889:	eb 9a                	jmp    802825 <spawn+0x6ac>
+
+0080288b <spawnl>:
+{
+  80288b:	55                   	push   %ebp
+  80288c:	89 e5                	mov    %esp,%ebp
+  80288e:	56                   	push   %esi
+  80288f:	53                   	push   %ebx
+  va_start(vl, arg0);
+  802890:	8d 45 10             	lea    0x10(%ebp),%eax
+  int argc = 0;
+  802893:	be 00 00 00 00       	mov    $0x0,%esi
+  while (va_arg(vl, void *) != NULL) {
+  802898:	eb 17                	jmp    8028b1 <spawnl+0x26>
+      cprintf("vl: %p saying %s\n", vl, vl);
+  80289a:	83 ec 04             	sub    $0x4,%esp
+  80289d:	53                   	push   %ebx
+  80289e:	53                   	push   %ebx
+  80289f:	68 7e 3c 80 00       	push   $0x803c7e
+  8028a4:	e8 d3 d9 ff ff       	call   80027c <cprintf>
+    argc++;
+  8028a9:	83 c6 01             	add    $0x1,%esi
+  8028ac:	83 c4 10             	add    $0x10,%esp
+  while (va_arg(vl, void *) != NULL) {
+  8028af:	89 d8                	mov    %ebx,%eax
+  8028b1:	8d 58 04             	lea    0x4(%eax),%ebx
+  8028b4:	83 38 00             	cmpl   $0x0,(%eax)
+  8028b7:	75 e1                	jne    80289a <spawnl+0xf>
+  cprintf("argc found %d\n", argc);
+  8028b9:	83 ec 08             	sub    $0x8,%esp
+  8028bc:	56                   	push   %esi
+  8028bd:	68 90 3c 80 00       	push   $0x803c90
+  8028c2:	e8 b5 d9 ff ff       	call   80027c <cprintf>
+  const char *argv[argc+2];
+  8028c7:	8d 04 b5 17 00 00 00 	lea    0x17(,%esi,4),%eax
+  8028ce:	83 e0 f0             	and    $0xfffffff0,%eax
+  8028d1:	83 c4 10             	add    $0x10,%esp
+  8028d4:	29 c4                	sub    %eax,%esp
+  8028d6:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  8028da:	89 d8                	mov    %ebx,%eax
+  8028dc:	c1 e8 02             	shr    $0x2,%eax
+  8028df:	83 e3 fc             	and    $0xfffffffc,%ebx
+  argv[0] = arg0;
+  8028e2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8028e5:	89 14 85 00 00 00 00 	mov    %edx,0x0(,%eax,4)
+  argv[argc+1] = NULL;
+  8028ec:	c7 44 b3 04 00 00 00 	movl   $0x0,0x4(%ebx,%esi,4)
+  8028f3:	00 
+  va_start(vl, arg0);
+  8028f4:	8d 55 10             	lea    0x10(%ebp),%edx
+  for (i = 0; i < argc; i++)
+  8028f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028fc:	eb 0b                	jmp    802909 <spawnl+0x7e>
+    argv[i+1] = va_arg(vl, const char *);
+  8028fe:	83 c0 01             	add    $0x1,%eax
+  802901:	8b 0a                	mov    (%edx),%ecx
+  802903:	89 0c 83             	mov    %ecx,(%ebx,%eax,4)
+  802906:	8d 52 04             	lea    0x4(%edx),%edx
+  for (i = 0; i < argc; i++)
+  802909:	39 f0                	cmp    %esi,%eax
+  80290b:	75 f1                	jne    8028fe <spawnl+0x73>
+  return spawn(prog, argv);
+  80290d:	83 ec 08             	sub    $0x8,%esp
+  802910:	53                   	push   %ebx
+  802911:	ff 75 08             	push   0x8(%ebp)
+  802914:	e8 60 f8 ff ff       	call   802179 <spawn>
+}
+  802919:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80291c:	5b                   	pop    %ebx
+  80291d:	5e                   	pop    %esi
+  80291e:	5d                   	pop    %ebp
+  80291f:	c3                   	ret
+
+00802920 <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  802920:	55                   	push   %ebp
+  802921:	89 e5                	mov    %esp,%ebp
+  802923:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  802926:	50                   	push   %eax
+  802927:	e8 2c e8 ff ff       	call   801158 <fd2data>
+  80292c:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  802931:	c9                   	leave
+  802932:	c3                   	ret
+
+00802933 <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802933:	55                   	push   %ebp
+  802934:	89 e5                	mov    %esp,%ebp
+  802936:	56                   	push   %esi
+  802937:	53                   	push   %ebx
+  802938:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  80293b:	83 ec 0c             	sub    $0xc,%esp
+  80293e:	ff 75 08             	push   0x8(%ebp)
+  802941:	e8 12 e8 ff ff       	call   801158 <fd2data>
+  802946:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  802948:	83 c4 08             	add    $0x8,%esp
+  80294b:	68 c6 3c 80 00       	push   $0x803cc6
+  802950:	53                   	push   %ebx
+  802951:	e8 14 df ff ff       	call   80086a <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  802956:	8b 46 04             	mov    0x4(%esi),%eax
+  802959:	2b 06                	sub    (%esi),%eax
+  80295b:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  802961:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802968:	00 00 00 
+  stat->st_dev = &devpipe;
+  80296b:	c7 83 88 00 00 00 20 	movl   $0x804020,0x88(%ebx)
+  802972:	40 80 00 
+  return 0;
+}
+  802975:	b8 00 00 00 00       	mov    $0x0,%eax
+  80297a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80297d:	5b                   	pop    %ebx
+  80297e:	5e                   	pop    %esi
+  80297f:	5d                   	pop    %ebp
+  802980:	c3                   	ret
+
+00802981 <pipe_wakeup>:
+{
+  802981:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  802983:	b8 00 00 00 00       	mov    $0x0,%eax
+  802988:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  80298b:	85 c0                	test   %eax,%eax
+  80298d:	75 01                	jne    802990 <pipe_wakeup+0xf>
+  80298f:	c3                   	ret
+{
+  802990:	55                   	push   %ebp
+  802991:	89 e5                	mov    %esp,%ebp
+  802993:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  802996:	6a 00                	push   $0x0
+  802998:	68 00 00 c0 ee       	push   $0xeec00000
+  80299d:	52                   	push   %edx
+  80299e:	e8 52 e6 ff ff       	call   800ff5 <sys_chan_wakeup>
+  8029a3:	83 c4 10             	add    $0x10,%esp
+}
+  8029a6:	c9                   	leave
+  8029a7:	c3                   	ret
+
+008029a8 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8029a8:	55                   	push   %ebp
+  8029a9:	89 e5                	mov    %esp,%ebp
+  8029ab:	57                   	push   %edi
+  8029ac:	56                   	push   %esi
+  8029ad:	53                   	push   %ebx
+  8029ae:	83 ec 18             	sub    $0x18,%esp
+  8029b1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  8029b4:	57                   	push   %edi
+  8029b5:	e8 9e e7 ff ff       	call   801158 <fd2data>
+  8029ba:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  8029bc:	83 c4 10             	add    $0x10,%esp
+  8029bf:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  8029c3:	74 2a                	je     8029ef <devpipe_close+0x47>
+  8029c5:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  8029ca:	89 f8                	mov    %edi,%eax
+  8029cc:	e8 4f ff ff ff       	call   802920 <pipe_ring>
+  8029d1:	83 ec 08             	sub    $0x8,%esp
+  8029d4:	01 d8                	add    %ebx,%eax
+  8029d6:	50                   	push   %eax
+  8029d7:	6a 00                	push   $0x0
+  8029d9:	e8 40 e3 ff ff       	call   800d1e <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  8029de:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8029e4:	83 c4 10             	add    $0x10,%esp
+  8029e7:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  8029ed:	75 db                	jne    8029ca <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  8029ef:	83 ec 08             	sub    $0x8,%esp
+  8029f2:	57                   	push   %edi
+  8029f3:	6a 00                	push   $0x0
+  8029f5:	e8 24 e3 ff ff       	call   800d1e <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  8029fa:	83 c4 10             	add    $0x10,%esp
+  8029fd:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  802a01:	75 13                	jne    802a16 <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  802a03:	83 ec 08             	sub    $0x8,%esp
+  802a06:	56                   	push   %esi
+  802a07:	6a 00                	push   $0x0
+  802a09:	e8 10 e3 ff ff       	call   800d1e <sys_page_unmap>
+}
+  802a0e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a11:	5b                   	pop    %ebx
+  802a12:	5e                   	pop    %esi
+  802a13:	5f                   	pop    %edi
+  802a14:	5d                   	pop    %ebp
+  802a15:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802a16:	8d 56 04             	lea    0x4(%esi),%edx
+  802a19:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802a1c:	e8 60 ff ff ff       	call   802981 <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802a21:	8d 46 30             	lea    0x30(%esi),%eax
+  802a24:	89 f2                	mov    %esi,%edx
+  802a26:	e8 56 ff ff ff       	call   802981 <pipe_wakeup>
+  802a2b:	eb d6                	jmp    802a03 <devpipe_close+0x5b>
+
+00802a2d <_pipeisclosed>:
+{
+  802a2d:	55                   	push   %ebp
+  802a2e:	89 e5                	mov    %esp,%ebp
+  802a30:	57                   	push   %edi
+  802a31:	56                   	push   %esi
+  802a32:	53                   	push   %ebx
+  802a33:	83 ec 1c             	sub    $0x1c,%esp
+  802a36:	89 c7                	mov    %eax,%edi
+  802a38:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  802a3a:	a1 64 5e 80 00       	mov    0x805e64,%eax
+  802a3f:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  802a42:	83 ec 0c             	sub    $0xc,%esp
+  802a45:	57                   	push   %edi
+  802a46:	e8 18 0a 00 00       	call   803463 <pageref>
+  802a4b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802a4e:	89 34 24             	mov    %esi,(%esp)
+  802a51:	e8 0d 0a 00 00       	call   803463 <pageref>
+    nn = thisenv->env_runs;
+  802a56:	8b 15 64 5e 80 00    	mov    0x805e64,%edx
+  802a5c:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  802a5f:	83 c4 10             	add    $0x10,%esp
+  802a62:	39 cb                	cmp    %ecx,%ebx
+  802a64:	74 1b                	je     802a81 <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  802a66:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802a69:	75 cf                	jne    802a3a <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802a6b:	8b 42 58             	mov    0x58(%edx),%eax
+  802a6e:	6a 01                	push   $0x1
+  802a70:	50                   	push   %eax
+  802a71:	53                   	push   %ebx
+  802a72:	68 cd 3c 80 00       	push   $0x803ccd
+  802a77:	e8 00 d8 ff ff       	call   80027c <cprintf>
+  802a7c:	83 c4 10             	add    $0x10,%esp
+  802a7f:	eb b9                	jmp    802a3a <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  802a81:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802a84:	0f 94 c0             	sete   %al
+  802a87:	0f b6 c0             	movzbl %al,%eax
+}
+  802a8a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a8d:	5b                   	pop    %ebx
+  802a8e:	5e                   	pop    %esi
+  802a8f:	5f                   	pop    %edi
+  802a90:	5d                   	pop    %ebp
+  802a91:	c3                   	ret
+
+00802a92 <devpipe_write_bulk>:
+{
+  802a92:	55                   	push   %ebp
+  802a93:	89 e5                	mov    %esp,%ebp
+  802a95:	57                   	push   %edi
+  802a96:	56                   	push   %esi
+  802a97:	53                   	push   %ebx
+  802a98:	83 ec 1c             	sub    $0x1c,%esp
+  802a9b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802a9e:	89 d6                	mov    %edx,%esi
+  802aa0:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  802aa3:	e8 78 fe ff ff       	call   802920 <pipe_ring>
+  802aa8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  802aab:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802ab0:	8d 46 04             	lea    0x4(%esi),%eax
+  802ab3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  802ab6:	eb 75                	jmp    802b2d <devpipe_write_bulk+0x9b>
+  802ab8:	b8 01 00 00 00       	mov    $0x1,%eax
+  802abd:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802ac1:	6a 64                	push   $0x64
+  802ac3:	68 00 00 c0 ee       	push   $0xeec00000
+  802ac8:	53                   	push   %ebx
+  802ac9:	56                   	push   %esi
+  802aca:	e8 03 e5 ff ff       	call   800fd2 <sys_chan_sleep>
+      continue;
+  802acf:	83 c4 10             	add    $0x10,%esp
+  802ad2:	eb 59                	jmp    802b2d <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  802ad4:	89 d1                	mov    %edx,%ecx
+  802ad6:	c1 f9 1f             	sar    $0x1f,%ecx
+  802ad9:	c1 e9 11             	shr    $0x11,%ecx
+  802adc:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802adf:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802ae4:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  802ae6:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  802aec:	29 d3                	sub    %edx,%ebx
+  802aee:	ba 00 80 00 00       	mov    $0x8000,%edx
+  802af3:	29 c2                	sub    %eax,%edx
+  802af5:	39 d3                	cmp    %edx,%ebx
+  802af7:	0f 47 da             	cmova  %edx,%ebx
+  802afa:	8b 55 08             	mov    0x8(%ebp),%edx
+  802afd:	29 fa                	sub    %edi,%edx
+  802aff:	39 d3                	cmp    %edx,%ebx
+  802b01:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  802b04:	83 ec 04             	sub    $0x4,%esp
+  802b07:	53                   	push   %ebx
+  802b08:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802b0b:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  802b0e:	52                   	push   %edx
+  802b0f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802b12:	01 c8                	add    %ecx,%eax
+  802b14:	50                   	push   %eax
+  802b15:	e8 38 df ff ff       	call   800a52 <memcpy>
+    i += m;
+  802b1a:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  802b1c:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802b1f:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802b22:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802b25:	e8 57 fe ff ff       	call   802981 <pipe_wakeup>
+  802b2a:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802b2d:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802b30:	73 2b                	jae    802b5d <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  802b32:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  802b34:	8b 56 04             	mov    0x4(%esi),%edx
+  802b37:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  802b3d:	39 d0                	cmp    %edx,%eax
+  802b3f:	7d 93                	jge    802ad4 <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  802b41:	89 f2                	mov    %esi,%edx
+  802b43:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802b46:	e8 e2 fe ff ff       	call   802a2d <_pipeisclosed>
+  802b4b:	85 c0                	test   %eax,%eax
+  802b4d:	0f 84 65 ff ff ff    	je     802ab8 <devpipe_write_bulk+0x26>
+        return i;
+  802b53:	89 f8                	mov    %edi,%eax
+}
+  802b55:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b58:	5b                   	pop    %ebx
+  802b59:	5e                   	pop    %esi
+  802b5a:	5f                   	pop    %edi
+  802b5b:	5d                   	pop    %ebp
+  802b5c:	c3                   	ret
+  return i;
+  802b5d:	89 f8                	mov    %edi,%eax
+  802b5f:	eb f4                	jmp    802b55 <devpipe_write_bulk+0xc3>
+
+00802b61 <devpipe_write>:
+{
+  802b61:	55                   	push   %ebp
+  802b62:	89 e5                	mov    %esp,%ebp
+  802b64:	57                   	push   %edi
+  802b65:	56                   	push   %esi
+  802b66:	53                   	push   %ebx
+  802b67:	83 ec 28             	sub    $0x28,%esp
+  802b6a:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  802b6d:	56                   	push   %esi
+  802b6e:	e8 e5 e5 ff ff       	call   801158 <fd2data>
+  802b73:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  802b75:	8b 78 28             	mov    0x28(%eax),%edi
+  802b78:	83 c4 10             	add    $0x10,%esp
+  802b7b:	85 ff                	test   %edi,%edi
+  802b7d:	75 25                	jne    802ba4 <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  802b7f:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802b82:	74 66                	je     802bea <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802b84:	8b 43 04             	mov    0x4(%ebx),%eax
+  802b87:	8b 0b                	mov    (%ebx),%ecx
+  802b89:	8d 51 20             	lea    0x20(%ecx),%edx
+  802b8c:	39 d0                	cmp    %edx,%eax
+  802b8e:	72 2b                	jb     802bbb <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  802b90:	89 da                	mov    %ebx,%edx
+  802b92:	89 f0                	mov    %esi,%eax
+  802b94:	e8 94 fe ff ff       	call   802a2d <_pipeisclosed>
+  802b99:	85 c0                	test   %eax,%eax
+  802b9b:	75 51                	jne    802bee <devpipe_write+0x8d>
+      sys_yield();
+  802b9d:	e8 95 e0 ff ff       	call   800c37 <sys_yield>
+  802ba2:	eb e0                	jmp    802b84 <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  802ba4:	83 ec 0c             	sub    $0xc,%esp
+  802ba7:	ff 75 10             	push   0x10(%ebp)
+  802baa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802bad:	89 c2                	mov    %eax,%edx
+  802baf:	89 f0                	mov    %esi,%eax
+  802bb1:	e8 dc fe ff ff       	call   802a92 <devpipe_write_bulk>
+  802bb6:	83 c4 10             	add    $0x10,%esp
+  802bb9:	eb 38                	jmp    802bf3 <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802bbb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802bbe:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802bc2:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802bc5:	89 c2                	mov    %eax,%edx
+  802bc7:	c1 fa 1f             	sar    $0x1f,%edx
+  802bca:	89 d1                	mov    %edx,%ecx
+  802bcc:	c1 e9 1b             	shr    $0x1b,%ecx
+  802bcf:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802bd2:	83 e2 1f             	and    $0x1f,%edx
+  802bd5:	29 ca                	sub    %ecx,%edx
+  802bd7:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802bdb:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  802bdf:	83 c0 01             	add    $0x1,%eax
+  802be2:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  802be5:	83 c7 01             	add    $0x1,%edi
+  802be8:	eb 95                	jmp    802b7f <devpipe_write+0x1e>
+  return i;
+  802bea:	89 f8                	mov    %edi,%eax
+  802bec:	eb 05                	jmp    802bf3 <devpipe_write+0x92>
+        return 0;
+  802bee:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802bf3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802bf6:	5b                   	pop    %ebx
+  802bf7:	5e                   	pop    %esi
+  802bf8:	5f                   	pop    %edi
+  802bf9:	5d                   	pop    %ebp
+  802bfa:	c3                   	ret
+
+00802bfb <devpipe_read_bulk>:
+{
+  802bfb:	55                   	push   %ebp
+  802bfc:	89 e5                	mov    %esp,%ebp
+  802bfe:	57                   	push   %edi
+  802bff:	56                   	push   %esi
+  802c00:	53                   	push   %ebx
+  802c01:	83 ec 2c             	sub    $0x2c,%esp
+  802c04:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802c07:	89 d6                	mov    %edx,%esi
+  802c09:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802c0c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  802c0f:	e8 0c fd ff ff       	call   802920 <pipe_ring>
+  802c14:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  802c17:	85 db                	test   %ebx,%ebx
+  802c19:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802c1e:	0f 45 c3             	cmovne %ebx,%eax
+  802c21:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802c24:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802c29:	8d 46 30             	lea    0x30(%esi),%eax
+  802c2c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  802c2f:	eb 50                	jmp    802c81 <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  802c31:	89 d1                	mov    %edx,%ecx
+  802c33:	c1 f9 1f             	sar    $0x1f,%ecx
+  802c36:	c1 e9 11             	shr    $0x11,%ecx
+  802c39:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802c3c:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802c41:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  802c43:	29 d3                	sub    %edx,%ebx
+  802c45:	ba 00 80 00 00       	mov    $0x8000,%edx
+  802c4a:	29 c2                	sub    %eax,%edx
+  802c4c:	39 d3                	cmp    %edx,%ebx
+  802c4e:	0f 47 da             	cmova  %edx,%ebx
+  802c51:	8b 55 08             	mov    0x8(%ebp),%edx
+  802c54:	29 fa                	sub    %edi,%edx
+  802c56:	39 d3                	cmp    %edx,%ebx
+  802c58:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  802c5b:	83 ec 04             	sub    $0x4,%esp
+  802c5e:	53                   	push   %ebx
+  802c5f:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802c62:	01 c8                	add    %ecx,%eax
+  802c64:	50                   	push   %eax
+  802c65:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802c68:	01 f8                	add    %edi,%eax
+  802c6a:	50                   	push   %eax
+  802c6b:	e8 e2 dd ff ff       	call   800a52 <memcpy>
+    i += m;
+  802c70:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  802c72:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802c74:	89 f2                	mov    %esi,%edx
+  802c76:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802c79:	e8 03 fd ff ff       	call   802981 <pipe_wakeup>
+  802c7e:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802c81:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802c84:	73 51                	jae    802cd7 <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  802c86:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  802c89:	8b 16                	mov    (%esi),%edx
+  802c8b:	39 da                	cmp    %ebx,%edx
+  802c8d:	75 a2                	jne    802c31 <devpipe_read_bulk+0x36>
+      if (i > 0)
+  802c8f:	85 ff                	test   %edi,%edi
+  802c91:	75 44                	jne    802cd7 <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  802c93:	89 f2                	mov    %esi,%edx
+  802c95:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802c98:	e8 90 fd ff ff       	call   802a2d <_pipeisclosed>
+  802c9d:	85 c0                	test   %eax,%eax
+  802c9f:	75 3a                	jne    802cdb <devpipe_read_bulk+0xe0>
+  802ca1:	b8 01 00 00 00       	mov    $0x1,%eax
+  802ca6:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802caa:	6a 64                	push   $0x64
+  802cac:	ff 75 d4             	push   -0x2c(%ebp)
+  802caf:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  802cb0:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802cb3:	50                   	push   %eax
+  802cb4:	e8 19 e3 ff ff       	call   800fd2 <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  802cb9:	85 c0                	test   %eax,%eax
+  802cbb:	ba 00 00 00 00       	mov    $0x0,%edx
+  802cc0:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  802cc3:	83 c4 10             	add    $0x10,%esp
+  802cc6:	a8 01                	test   $0x1,%al
+  802cc8:	74 b7                	je     802c81 <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  802cca:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  802ccf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802cd2:	5b                   	pop    %ebx
+  802cd3:	5e                   	pop    %esi
+  802cd4:	5f                   	pop    %edi
+  802cd5:	5d                   	pop    %ebp
+  802cd6:	c3                   	ret
+  return i;
+  802cd7:	89 f8                	mov    %edi,%eax
+  802cd9:	eb f4                	jmp    802ccf <devpipe_read_bulk+0xd4>
+        return 0;
+  802cdb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ce0:	eb ed                	jmp    802ccf <devpipe_read_bulk+0xd4>
+
+00802ce2 <devpipe_read>:
+{
+  802ce2:	55                   	push   %ebp
+  802ce3:	89 e5                	mov    %esp,%ebp
+  802ce5:	57                   	push   %edi
+  802ce6:	56                   	push   %esi
+  802ce7:	53                   	push   %ebx
+  802ce8:	83 ec 18             	sub    $0x18,%esp
+  802ceb:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  802cee:	57                   	push   %edi
+  802cef:	e8 64 e4 ff ff       	call   801158 <fd2data>
+  802cf4:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  802cf6:	8b 70 28             	mov    0x28(%eax),%esi
+  802cf9:	83 c4 10             	add    $0x10,%esp
+  802cfc:	85 f6                	test   %esi,%esi
+  802cfe:	75 24                	jne    802d24 <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  802d00:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802d03:	74 60                	je     802d65 <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  802d05:	8b 03                	mov    (%ebx),%eax
+  802d07:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802d0a:	75 3b                	jne    802d47 <devpipe_read+0x65>
+      if (i > 0)
+  802d0c:	85 f6                	test   %esi,%esi
+  802d0e:	75 2d                	jne    802d3d <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  802d10:	89 da                	mov    %ebx,%edx
+  802d12:	89 f8                	mov    %edi,%eax
+  802d14:	e8 14 fd ff ff       	call   802a2d <_pipeisclosed>
+  802d19:	85 c0                	test   %eax,%eax
+  802d1b:	75 4c                	jne    802d69 <devpipe_read+0x87>
+      sys_yield();
+  802d1d:	e8 15 df ff ff       	call   800c37 <sys_yield>
+  802d22:	eb e1                	jmp    802d05 <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  802d24:	83 ec 08             	sub    $0x8,%esp
+  802d27:	6a 00                	push   $0x0
+  802d29:	ff 75 10             	push   0x10(%ebp)
+  802d2c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802d2f:	89 c2                	mov    %eax,%edx
+  802d31:	89 f8                	mov    %edi,%eax
+  802d33:	e8 c3 fe ff ff       	call   802bfb <devpipe_read_bulk>
+  802d38:	83 c4 10             	add    $0x10,%esp
+  802d3b:	eb 02                	jmp    802d3f <devpipe_read+0x5d>
+        return i;
+  802d3d:	89 f0                	mov    %esi,%eax
+}
+  802d3f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d42:	5b                   	pop    %ebx
+  802d43:	5e                   	pop    %esi
+  802d44:	5f                   	pop    %edi
+  802d45:	5d                   	pop    %ebp
+  802d46:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802d47:	99                   	cltd
+  802d48:	c1 ea 1b             	shr    $0x1b,%edx
+  802d4b:	01 d0                	add    %edx,%eax
+  802d4d:	83 e0 1f             	and    $0x1f,%eax
+  802d50:	29 d0                	sub    %edx,%eax
+  802d52:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802d57:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802d5a:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  802d5d:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  802d60:	83 c6 01             	add    $0x1,%esi
+  802d63:	eb 9b                	jmp    802d00 <devpipe_read+0x1e>
+  return i;
+  802d65:	89 f0                	mov    %esi,%eax
+  802d67:	eb d6                	jmp    802d3f <devpipe_read+0x5d>
+        return 0;
+  802d69:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d6e:	eb cf                	jmp    802d3f <devpipe_read+0x5d>
+
+00802d70 <pipe2>:
+{
+  802d70:	55                   	push   %ebp
+  802d71:	89 e5                	mov    %esp,%ebp
+  802d73:	57                   	push   %edi
+  802d74:	56                   	push   %esi
+  802d75:	53                   	push   %ebx
+  802d76:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  802d79:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802d7c:	50                   	push   %eax
+  802d7d:	e8 ea e3 ff ff       	call   80116c <fd_alloc>
+  802d82:	89 c3                	mov    %eax,%ebx
+  802d84:	83 c4 10             	add    $0x10,%esp
+  802d87:	85 c0                	test   %eax,%eax
+  802d89:	0f 88 fb 01 00 00    	js     802f8a <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802d8f:	83 ec 04             	sub    $0x4,%esp
+  802d92:	68 07 04 00 00       	push   $0x407
+  802d97:	ff 75 e4             	push   -0x1c(%ebp)
+  802d9a:	6a 00                	push   $0x0
+  802d9c:	e8 f8 de ff ff       	call   800c99 <sys_page_alloc>
+  802da1:	89 c3                	mov    %eax,%ebx
+  802da3:	83 c4 10             	add    $0x10,%esp
+  802da6:	85 c0                	test   %eax,%eax
+  802da8:	0f 88 dc 01 00 00    	js     802f8a <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  802dae:	83 ec 0c             	sub    $0xc,%esp
+  802db1:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  802db4:	50                   	push   %eax
+  802db5:	e8 b2 e3 ff ff       	call   80116c <fd_alloc>
+  802dba:	89 c3                	mov    %eax,%ebx
+  802dbc:	83 c4 10             	add    $0x10,%esp
+  802dbf:	85 c0                	test   %eax,%eax
+  802dc1:	0f 88 b3 01 00 00    	js     802f7a <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802dc7:	83 ec 04             	sub    $0x4,%esp
+  802dca:	68 07 04 00 00       	push   $0x407
+  802dcf:	ff 75 e0             	push   -0x20(%ebp)
+  802dd2:	6a 00                	push   $0x0
+  802dd4:	e8 c0 de ff ff       	call   800c99 <sys_page_alloc>
+  802dd9:	89 c3                	mov    %eax,%ebx
+  802ddb:	83 c4 10             	add    $0x10,%esp
+  802dde:	85 c0                	test   %eax,%eax
+  802de0:	0f 88 94 01 00 00    	js     802f7a <pipe2+0x20a>
+  va = fd2data(fd0);
+  802de6:	83 ec 0c             	sub    $0xc,%esp
+  802de9:	ff 75 e4             	push   -0x1c(%ebp)
+  802dec:	e8 67 e3 ff ff       	call   801158 <fd2data>
+  802df1:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802df3:	83 c4 0c             	add    $0xc,%esp
+  802df6:	68 07 04 00 00       	push   $0x407
+  802dfb:	50                   	push   %eax
+  802dfc:	6a 00                	push   $0x0
+  802dfe:	e8 96 de ff ff       	call   800c99 <sys_page_alloc>
+  802e03:	89 c3                	mov    %eax,%ebx
+  802e05:	83 c4 10             	add    $0x10,%esp
+  802e08:	85 c0                	test   %eax,%eax
+  802e0a:	0f 88 5a 01 00 00    	js     802f6a <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802e10:	83 ec 0c             	sub    $0xc,%esp
+  802e13:	ff 75 e0             	push   -0x20(%ebp)
+  802e16:	e8 3d e3 ff ff       	call   801158 <fd2data>
+  802e1b:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802e22:	50                   	push   %eax
+  802e23:	6a 00                	push   $0x0
+  802e25:	57                   	push   %edi
+  802e26:	6a 00                	push   $0x0
+  802e28:	e8 af de ff ff       	call   800cdc <sys_page_map>
+  802e2d:	89 c3                	mov    %eax,%ebx
+  802e2f:	83 c4 20             	add    $0x20,%esp
+  802e32:	85 c0                	test   %eax,%eax
+  802e34:	0f 88 22 01 00 00    	js     802f5c <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  802e3a:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  802e3e:	74 72                	je     802eb2 <pipe2+0x142>
+  802e40:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  802e45:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802e48:	e8 d3 fa ff ff       	call   802920 <pipe_ring>
+  802e4d:	83 ec 04             	sub    $0x4,%esp
+  802e50:	68 07 04 00 00       	push   $0x407
+  802e55:	01 f0                	add    %esi,%eax
+  802e57:	50                   	push   %eax
+  802e58:	6a 00                	push   $0x0
+  802e5a:	e8 3a de ff ff       	call   800c99 <sys_page_alloc>
+  802e5f:	89 c3                	mov    %eax,%ebx
+  802e61:	83 c4 10             	add    $0x10,%esp
+  802e64:	85 c0                	test   %eax,%eax
+  802e66:	0f 88 97 00 00 00    	js     802f03 <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  802e6c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802e6f:	e8 ac fa ff ff       	call   802920 <pipe_ring>
+  802e74:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  802e77:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802e7a:	e8 a1 fa ff ff       	call   802920 <pipe_ring>
+  802e7f:	83 ec 0c             	sub    $0xc,%esp
+  802e82:	68 07 04 00 00       	push   $0x407
+  802e87:	53                   	push   %ebx
+  802e88:	6a 00                	push   $0x0
+  802e8a:	01 f0                	add    %esi,%eax
+  802e8c:	50                   	push   %eax
+  802e8d:	6a 00                	push   $0x0
+  802e8f:	e8 48 de ff ff       	call   800cdc <sys_page_map>
+  802e94:	89 c3                	mov    %eax,%ebx
+  802e96:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802e9c:	83 c4 20             	add    $0x20,%esp
+  802e9f:	85 c0                	test   %eax,%eax
+  802ea1:	78 60                	js     802f03 <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  802ea3:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802ea9:	75 9a                	jne    802e45 <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  802eab:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  802eb2:	a1 20 40 80 00       	mov    0x804020,%eax
+  802eb7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802eba:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  802ebc:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802ebf:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  802ec6:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802ec9:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  802ecb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802ece:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  802ed5:	83 ec 0c             	sub    $0xc,%esp
+  802ed8:	ff 75 e4             	push   -0x1c(%ebp)
+  802edb:	e8 68 e2 ff ff       	call   801148 <fd2num>
+  802ee0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802ee3:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  802ee5:	83 c4 04             	add    $0x4,%esp
+  802ee8:	ff 75 e0             	push   -0x20(%ebp)
+  802eeb:	e8 58 e2 ff ff       	call   801148 <fd2num>
+  802ef0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802ef3:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  802ef6:	83 c4 10             	add    $0x10,%esp
+  802ef9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802efe:	e9 87 00 00 00       	jmp    802f8a <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802f03:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  802f08:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802f0b:	e8 10 fa ff ff       	call   802920 <pipe_ring>
+  802f10:	83 ec 08             	sub    $0x8,%esp
+  802f13:	01 f0                	add    %esi,%eax
+  802f15:	50                   	push   %eax
+  802f16:	6a 00                	push   $0x0
+  802f18:	e8 01 de ff ff       	call   800d1e <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  802f1d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802f20:	e8 fb f9 ff ff       	call   802920 <pipe_ring>
+  802f25:	83 c4 08             	add    $0x8,%esp
+  802f28:	01 f0                	add    %esi,%eax
+  802f2a:	50                   	push   %eax
+  802f2b:	6a 00                	push   $0x0
+  802f2d:	e8 ec dd ff ff       	call   800d1e <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802f32:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802f38:	83 c4 10             	add    $0x10,%esp
+  802f3b:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802f41:	75 c5                	jne    802f08 <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  802f43:	83 ec 0c             	sub    $0xc,%esp
+  802f46:	ff 75 e0             	push   -0x20(%ebp)
+  802f49:	e8 0a e2 ff ff       	call   801158 <fd2data>
+  802f4e:	83 c4 08             	add    $0x8,%esp
+  802f51:	50                   	push   %eax
+  802f52:	6a 00                	push   $0x0
+  802f54:	e8 c5 dd ff ff       	call   800d1e <sys_page_unmap>
+  802f59:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  802f5c:	83 ec 08             	sub    $0x8,%esp
+  802f5f:	57                   	push   %edi
+  802f60:	6a 00                	push   $0x0
+  802f62:	e8 b7 dd ff ff       	call   800d1e <sys_page_unmap>
+  802f67:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  802f6a:	83 ec 08             	sub    $0x8,%esp
+  802f6d:	ff 75 e0             	push   -0x20(%ebp)
+  802f70:	6a 00                	push   $0x0
+  802f72:	e8 a7 dd ff ff       	call   800d1e <sys_page_unmap>
+  802f77:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  802f7a:	83 ec 08             	sub    $0x8,%esp
+  802f7d:	ff 75 e4             	push   -0x1c(%ebp)
+  802f80:	6a 00                	push   $0x0
+  802f82:	e8 97 dd ff ff       	call   800d1e <sys_page_unmap>
+  802f87:	83 c4 10             	add    $0x10,%esp
+}
+  802f8a:	89 d8                	mov    %ebx,%eax
+  802f8c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f8f:	5b                   	pop    %ebx
+  802f90:	5e                   	pop    %esi
+  802f91:	5f                   	pop    %edi
+  802f92:	5d                   	pop    %ebp
+  802f93:	c3                   	ret
+
+00802f94 <pipe>:
+{
+  802f94:	55                   	push   %ebp
+  802f95:	89 e5                	mov    %esp,%ebp
+  802f97:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  802f9a:	6a 00                	push   $0x0
+  802f9c:	ff 75 08             	push   0x8(%ebp)
+  802f9f:	e8 cc fd ff ff       	call   802d70 <pipe2>
+}
+  802fa4:	c9                   	leave
+  802fa5:	c3                   	ret
+
+00802fa6 <pipeisclosed>:
+{
+  802fa6:	55                   	push   %ebp
+  802fa7:	89 e5                	mov    %esp,%ebp
+  802fa9:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802fac:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802faf:	50                   	push   %eax
+  802fb0:	ff 75 08             	push   0x8(%ebp)
+  802fb3:	e8 0a e2 ff ff       	call   8011c2 <fd_lookup>
+  802fb8:	83 c4 10             	add    $0x10,%esp
+  802fbb:	85 c0                	test   %eax,%eax
+  802fbd:	78 18                	js     802fd7 <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  802fbf:	83 ec 0c             	sub    $0xc,%esp
+  802fc2:	ff 75 f4             	push   -0xc(%ebp)
+  802fc5:	e8 8e e1 ff ff       	call   801158 <fd2data>
+  802fca:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  802fcc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802fcf:	e8 59 fa ff ff       	call   802a2d <_pipeisclosed>
+  802fd4:	83 c4 10             	add    $0x10,%esp
+}
+  802fd7:	c9                   	leave
+  802fd8:	c3                   	ret
+
+00802fd9 <pipe_splice>:
+{
+  802fd9:	55                   	push   %ebp
+  802fda:	89 e5                	mov    %esp,%ebp
+  802fdc:	57                   	push   %edi
+  802fdd:	56                   	push   %esi
+  802fde:	53                   	push   %ebx
+  802fdf:	83 ec 34             	sub    $0x34,%esp
+  802fe2:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802fe5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802fe8:	50                   	push   %eax
+  802fe9:	ff 75 08             	push   0x8(%ebp)
+  802fec:	e8 d1 e1 ff ff       	call   8011c2 <fd_lookup>
+  802ff1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802ff4:	83 c4 10             	add    $0x10,%esp
+  802ff7:	85 c0                	test   %eax,%eax
+  802ff9:	0f 88 d7 00 00 00    	js     8030d6 <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  802fff:	83 ec 0c             	sub    $0xc,%esp
+  803002:	ff 75 e4             	push   -0x1c(%ebp)
+  803005:	e8 4e e1 ff ff       	call   801158 <fd2data>
+  80300a:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  80300c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80300f:	83 c4 10             	add    $0x10,%esp
+  803012:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  803018:	39 10                	cmp    %edx,(%eax)
+  80301a:	0f 85 c1 00 00 00    	jne    8030e1 <pipe_splice+0x108>
+  803020:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  803024:	0f 84 c0 00 00 00    	je     8030ea <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  80302a:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  80302e:	0f 84 bf 00 00 00    	je     8030f3 <pipe_splice+0x11a>
+  803034:	89 f7                	mov    %esi,%edi
+  803036:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  80303c:	0f 85 ba 00 00 00    	jne    8030fc <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  803042:	8d 43 04             	lea    0x4(%ebx),%eax
+  803045:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  803048:	eb 38                	jmp    803082 <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  80304a:	83 ec 0c             	sub    $0xc,%esp
+  80304d:	68 00 10 00 00       	push   $0x1000
+  803052:	89 f1                	mov    %esi,%ecx
+  803054:	89 da                	mov    %ebx,%edx
+  803056:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803059:	e8 34 fa ff ff       	call   802a92 <devpipe_write_bulk>
+  80305e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  803061:	83 c4 10             	add    $0x10,%esp
+  803064:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  803069:	75 53                	jne    8030be <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  80306b:	83 ec 08             	sub    $0x8,%esp
+  80306e:	56                   	push   %esi
+  80306f:	6a 00                	push   $0x0
+  803071:	e8 a8 dc ff ff       	call   800d1e <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  803076:	83 c7 01             	add    $0x1,%edi
+  803079:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80307f:	83 c4 10             	add    $0x10,%esp
+  803082:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  803085:	74 3a                	je     8030c1 <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  803087:	8b 03                	mov    (%ebx),%eax
+  803089:	39 43 04             	cmp    %eax,0x4(%ebx)
+  80308c:	75 bc                	jne    80304a <pipe_splice+0x71>
+  80308e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803093:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  803097:	85 c0                	test   %eax,%eax
+  803099:	74 af                	je     80304a <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  80309b:	83 ec 04             	sub    $0x4,%esp
+  80309e:	6a 07                	push   $0x7
+  8030a0:	56                   	push   %esi
+  8030a1:	ff 75 d0             	push   -0x30(%ebp)
+  8030a4:	e8 4c df ff ff       	call   800ff5 <sys_chan_wakeup>
+  8030a9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8030ac:	83 c4 10             	add    $0x10,%esp
+  8030af:	85 c0                	test   %eax,%eax
+  8030b1:	79 b8                	jns    80306b <pipe_splice+0x92>
+  8030b3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8030b8:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  8030bc:	eb 8c                	jmp    80304a <pipe_splice+0x71>
+  8030be:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  8030c1:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8030c5:	75 06                	jne    8030cd <pipe_splice+0xf4>
+  8030c7:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  8030cb:	78 09                	js     8030d6 <pipe_splice+0xfd>
+  return i * PGSIZE;
+  8030cd:	8b 45 10             	mov    0x10(%ebp),%eax
+  8030d0:	c1 e0 0c             	shl    $0xc,%eax
+  8030d3:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  8030d6:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8030d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030dc:	5b                   	pop    %ebx
+  8030dd:	5e                   	pop    %esi
+  8030de:	5f                   	pop    %edi
+  8030df:	5d                   	pop    %ebp
+  8030e0:	c3                   	ret
+    return -E_INVAL;
+  8030e1:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  8030e8:	eb ec                	jmp    8030d6 <pipe_splice+0xfd>
+  8030ea:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  8030f1:	eb e3                	jmp    8030d6 <pipe_splice+0xfd>
+  8030f3:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  8030fa:	eb da                	jmp    8030d6 <pipe_splice+0xfd>
+  8030fc:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  803103:	eb d1                	jmp    8030d6 <pipe_splice+0xfd>
+
+00803105 <pipe_splice_read>:
+{
+  803105:	55                   	push   %ebp
+  803106:	89 e5                	mov    %esp,%ebp
+  803108:	53                   	push   %ebx
+  803109:	83 ec 1c             	sub    $0x1c,%esp
+  80310c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80310f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803112:	50                   	push   %eax
+  803113:	ff 75 08             	push   0x8(%ebp)
+  803116:	e8 a7 e0 ff ff       	call   8011c2 <fd_lookup>
+  80311b:	83 c4 10             	add    $0x10,%esp
+  80311e:	85 c0                	test   %eax,%eax
+  803120:	78 49                	js     80316b <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  803122:	83 ec 0c             	sub    $0xc,%esp
+  803125:	ff 75 f4             	push   -0xc(%ebp)
+  803128:	e8 2b e0 ff ff       	call   801158 <fd2data>
+  80312d:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  80312f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803132:	83 c4 10             	add    $0x10,%esp
+  803135:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  80313b:	39 08                	cmp    %ecx,(%eax)
+  80313d:	75 31                	jne    803170 <pipe_splice_read+0x6b>
+  80313f:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  803143:	74 32                	je     803177 <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  803145:	8b 48 08             	mov    0x8(%eax),%ecx
+  803148:	83 e1 03             	and    $0x3,%ecx
+  80314b:	83 f9 01             	cmp    $0x1,%ecx
+  80314e:	74 2e                	je     80317e <pipe_splice_read+0x79>
+  803150:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  803156:	75 2d                	jne    803185 <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  803158:	83 ec 08             	sub    $0x8,%esp
+  80315b:	53                   	push   %ebx
+  80315c:	68 00 10 00 00       	push   $0x1000
+  803161:	89 d9                	mov    %ebx,%ecx
+  803163:	e8 93 fa ff ff       	call   802bfb <devpipe_read_bulk>
+  803168:	83 c4 10             	add    $0x10,%esp
+}
+  80316b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80316e:	c9                   	leave
+  80316f:	c3                   	ret
+    return -E_INVAL;
+  803170:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803175:	eb f4                	jmp    80316b <pipe_splice_read+0x66>
+  803177:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80317c:	eb ed                	jmp    80316b <pipe_splice_read+0x66>
+  80317e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803183:	eb e6                	jmp    80316b <pipe_splice_read+0x66>
+  803185:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80318a:	eb df                	jmp    80316b <pipe_splice_read+0x66>
+
+0080318c <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  80318c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803191:	c3                   	ret
+
+00803192 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803192:	55                   	push   %ebp
+  803193:	89 e5                	mov    %esp,%ebp
+  803195:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  803198:	68 e5 3c 80 00       	push   $0x803ce5
+  80319d:	ff 75 0c             	push   0xc(%ebp)
+  8031a0:	e8 c5 d6 ff ff       	call   80086a <strcpy>
+  return 0;
+}
+  8031a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031aa:	c9                   	leave
+  8031ab:	c3                   	ret
+
+008031ac <devcons_write>:
+{
+  8031ac:	55                   	push   %ebp
+  8031ad:	89 e5                	mov    %esp,%ebp
+  8031af:	57                   	push   %edi
+  8031b0:	56                   	push   %esi
+  8031b1:	53                   	push   %ebx
+  8031b2:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  8031b8:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  8031bd:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  8031c3:	eb 2e                	jmp    8031f3 <devcons_write+0x47>
+    m = n - tot;
+  8031c5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8031c8:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  8031ca:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8031cf:	39 c3                	cmp    %eax,%ebx
+  8031d1:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  8031d4:	83 ec 04             	sub    $0x4,%esp
+  8031d7:	53                   	push   %ebx
+  8031d8:	89 f0                	mov    %esi,%eax
+  8031da:	03 45 0c             	add    0xc(%ebp),%eax
+  8031dd:	50                   	push   %eax
+  8031de:	57                   	push   %edi
+  8031df:	e8 0c d8 ff ff       	call   8009f0 <memmove>
+    sys_cputs(buf, m);
+  8031e4:	83 c4 08             	add    $0x8,%esp
+  8031e7:	53                   	push   %ebx
+  8031e8:	57                   	push   %edi
+  8031e9:	e8 ac d9 ff ff       	call   800b9a <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  8031ee:	01 de                	add    %ebx,%esi
+  8031f0:	83 c4 10             	add    $0x10,%esp
+  8031f3:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8031f6:	72 cd                	jb     8031c5 <devcons_write+0x19>
+}
+  8031f8:	89 f0                	mov    %esi,%eax
+  8031fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8031fd:	5b                   	pop    %ebx
+  8031fe:	5e                   	pop    %esi
+  8031ff:	5f                   	pop    %edi
+  803200:	5d                   	pop    %ebp
+  803201:	c3                   	ret
+
+00803202 <devcons_read>:
+{
+  803202:	55                   	push   %ebp
+  803203:	89 e5                	mov    %esp,%ebp
+  803205:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  803208:	b8 00 00 00 00       	mov    $0x0,%eax
+  80320d:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803211:	75 07                	jne    80321a <devcons_read+0x18>
+  803213:	eb 1f                	jmp    803234 <devcons_read+0x32>
+    sys_yield();
+  803215:	e8 1d da ff ff       	call   800c37 <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  80321a:	e8 99 d9 ff ff       	call   800bb8 <sys_cgetc>
+  80321f:	85 c0                	test   %eax,%eax
+  803221:	74 f2                	je     803215 <devcons_read+0x13>
+  if (c < 0)
+  803223:	78 0f                	js     803234 <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  803225:	83 f8 04             	cmp    $0x4,%eax
+  803228:	74 0c                	je     803236 <devcons_read+0x34>
+  *(char*)vbuf = c;
+  80322a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80322d:	88 02                	mov    %al,(%edx)
+  return 1;
+  80322f:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803234:	c9                   	leave
+  803235:	c3                   	ret
+    return 0;
+  803236:	b8 00 00 00 00       	mov    $0x0,%eax
+  80323b:	eb f7                	jmp    803234 <devcons_read+0x32>
+
+0080323d <cputchar>:
+{
+  80323d:	55                   	push   %ebp
+  80323e:	89 e5                	mov    %esp,%ebp
+  803240:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  803243:	8b 45 08             	mov    0x8(%ebp),%eax
+  803246:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  803249:	6a 01                	push   $0x1
+  80324b:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80324e:	50                   	push   %eax
+  80324f:	e8 46 d9 ff ff       	call   800b9a <sys_cputs>
+}
+  803254:	83 c4 10             	add    $0x10,%esp
+  803257:	c9                   	leave
+  803258:	c3                   	ret
+
+00803259 <getchar>:
+{
+  803259:	55                   	push   %ebp
+  80325a:	89 e5                	mov    %esp,%ebp
+  80325c:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  80325f:	6a 01                	push   $0x1
+  803261:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803264:	50                   	push   %eax
+  803265:	6a 00                	push   $0x0
+  803267:	e8 01 e2 ff ff       	call   80146d <read>
+  if (r < 0)
+  80326c:	83 c4 10             	add    $0x10,%esp
+  80326f:	85 c0                	test   %eax,%eax
+  803271:	78 06                	js     803279 <getchar+0x20>
+  if (r < 1)
+  803273:	74 06                	je     80327b <getchar+0x22>
+  return c;
+  803275:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803279:	c9                   	leave
+  80327a:	c3                   	ret
+    return -E_EOF;
+  80327b:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803280:	eb f7                	jmp    803279 <getchar+0x20>
+
+00803282 <iscons>:
+{
+  803282:	55                   	push   %ebp
+  803283:	89 e5                	mov    %esp,%ebp
+  803285:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803288:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80328b:	50                   	push   %eax
+  80328c:	ff 75 08             	push   0x8(%ebp)
+  80328f:	e8 2e df ff ff       	call   8011c2 <fd_lookup>
+  803294:	83 c4 10             	add    $0x10,%esp
+  803297:	85 c0                	test   %eax,%eax
+  803299:	78 11                	js     8032ac <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  80329b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80329e:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  8032a4:	39 10                	cmp    %edx,(%eax)
+  8032a6:	0f 94 c0             	sete   %al
+  8032a9:	0f b6 c0             	movzbl %al,%eax
+}
+  8032ac:	c9                   	leave
+  8032ad:	c3                   	ret
+
+008032ae <opencons>:
+{
+  8032ae:	55                   	push   %ebp
+  8032af:	89 e5                	mov    %esp,%ebp
+  8032b1:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  8032b4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8032b7:	50                   	push   %eax
+  8032b8:	e8 af de ff ff       	call   80116c <fd_alloc>
+  8032bd:	83 c4 10             	add    $0x10,%esp
+  8032c0:	85 c0                	test   %eax,%eax
+  8032c2:	78 3a                	js     8032fe <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8032c4:	83 ec 04             	sub    $0x4,%esp
+  8032c7:	68 07 04 00 00       	push   $0x407
+  8032cc:	ff 75 f4             	push   -0xc(%ebp)
+  8032cf:	6a 00                	push   $0x0
+  8032d1:	e8 c3 d9 ff ff       	call   800c99 <sys_page_alloc>
+  8032d6:	83 c4 10             	add    $0x10,%esp
+  8032d9:	85 c0                	test   %eax,%eax
+  8032db:	78 21                	js     8032fe <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  8032dd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8032e0:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  8032e6:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  8032e8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8032eb:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  8032f2:	83 ec 0c             	sub    $0xc,%esp
+  8032f5:	50                   	push   %eax
+  8032f6:	e8 4d de ff ff       	call   801148 <fd2num>
+  8032fb:	83 c4 10             	add    $0x10,%esp
+}
+  8032fe:	c9                   	leave
+  8032ff:	c3                   	ret
+
+00803300 <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  803300:	55                   	push   %ebp
+  803301:	89 e5                	mov    %esp,%ebp
+  803303:	57                   	push   %edi
+  803304:	56                   	push   %esi
+  803305:	53                   	push   %ebx
+  803306:	83 ec 14             	sub    $0x14,%esp
+  803309:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80330c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80330f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803312:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  803315:	85 c0                	test   %eax,%eax
+  803317:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80331c:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  80331f:	ff 33                	push   (%ebx)
+  803321:	50                   	push   %eax
+  803322:	e8 4a dc ff ff       	call   800f71 <sys_ipc_recv>
+  803327:	83 c4 10             	add    $0x10,%esp
+  80332a:	85 c0                	test   %eax,%eax
+  80332c:	78 39                	js     803367 <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  80332e:	85 ff                	test   %edi,%edi
+  803330:	74 0a                	je     80333c <ipc_recv_pages+0x3c>
+  803332:	a1 64 5e 80 00       	mov    0x805e64,%eax
+  803337:	8b 40 7c             	mov    0x7c(%eax),%eax
+  80333a:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  80333c:	85 f6                	test   %esi,%esi
+  80333e:	74 0d                	je     80334d <ipc_recv_pages+0x4d>
+  803340:	a1 64 5e 80 00       	mov    0x805e64,%eax
+  803345:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  80334b:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  80334d:	a1 64 5e 80 00       	mov    0x805e64,%eax
+  803352:	8b 40 74             	mov    0x74(%eax),%eax
+  803355:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  803357:	a1 64 5e 80 00       	mov    0x805e64,%eax
+  80335c:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  80335f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803362:	5b                   	pop    %ebx
+  803363:	5e                   	pop    %esi
+  803364:	5f                   	pop    %edi
+  803365:	5d                   	pop    %ebp
+  803366:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  803367:	85 ff                	test   %edi,%edi
+  803369:	74 06                	je     803371 <ipc_recv_pages+0x71>
+  80336b:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  803371:	85 f6                	test   %esi,%esi
+  803373:	74 06                	je     80337b <ipc_recv_pages+0x7b>
+  803375:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  80337b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  803381:	eb dc                	jmp    80335f <ipc_recv_pages+0x5f>
+
+00803383 <ipc_recv>:
+{
+  803383:	55                   	push   %ebp
+  803384:	89 e5                	mov    %esp,%ebp
+  803386:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  803389:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  803390:	ff 75 10             	push   0x10(%ebp)
+  803393:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803396:	50                   	push   %eax
+  803397:	ff 75 0c             	push   0xc(%ebp)
+  80339a:	ff 75 08             	push   0x8(%ebp)
+  80339d:	e8 5e ff ff ff       	call   803300 <ipc_recv_pages>
+}
+  8033a2:	c9                   	leave
+  8033a3:	c3                   	ret
+
+008033a4 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  8033a4:	55                   	push   %ebp
+  8033a5:	89 e5                	mov    %esp,%ebp
+  8033a7:	57                   	push   %edi
+  8033a8:	56                   	push   %esi
+  8033a9:	53                   	push   %ebx
+  8033aa:	83 ec 0c             	sub    $0xc,%esp
+  8033ad:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8033b0:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8033b3:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  8033b6:	89 c3                	mov    %eax,%ebx
+  8033b8:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  8033be:	85 c0                	test   %eax,%eax
+  8033c0:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8033c5:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  8033c8:	83 ec 0c             	sub    $0xc,%esp
+  8033cb:	ff 75 14             	push   0x14(%ebp)
+  8033ce:	ff 75 18             	push   0x18(%ebp)
+  8033d1:	53                   	push   %ebx
+  8033d2:	56                   	push   %esi
+  8033d3:	57                   	push   %edi
+  8033d4:	e8 77 db ff ff       	call   800f50 <sys_ipc_try_send>
+  8033d9:	83 c4 20             	add    $0x20,%esp
+  8033dc:	85 c0                	test   %eax,%eax
+  8033de:	79 1e                	jns    8033fe <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  8033e0:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8033e3:	75 07                	jne    8033ec <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  8033e5:	e8 4d d8 ff ff       	call   800c37 <sys_yield>
+  8033ea:	eb dc                	jmp    8033c8 <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  8033ec:	50                   	push   %eax
+  8033ed:	68 f1 3c 80 00       	push   $0x803cf1
+  8033f2:	6a 5c                	push   $0x5c
+  8033f4:	68 fe 3c 80 00       	push   $0x803cfe
+  8033f9:	e8 a3 cd ff ff       	call   8001a1 <_panic>
+  }
+}
+  8033fe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803401:	5b                   	pop    %ebx
+  803402:	5e                   	pop    %esi
+  803403:	5f                   	pop    %edi
+  803404:	5d                   	pop    %ebp
+  803405:	c3                   	ret
+
+00803406 <ipc_send>:
+{
+  803406:	55                   	push   %ebp
+  803407:	89 e5                	mov    %esp,%ebp
+  803409:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  80340c:	ff 75 14             	push   0x14(%ebp)
+  80340f:	6a 01                	push   $0x1
+  803411:	ff 75 10             	push   0x10(%ebp)
+  803414:	ff 75 0c             	push   0xc(%ebp)
+  803417:	ff 75 08             	push   0x8(%ebp)
+  80341a:	e8 85 ff ff ff       	call   8033a4 <ipc_send_pages>
+}
+  80341f:	83 c4 20             	add    $0x20,%esp
+  803422:	c9                   	leave
+  803423:	c3                   	ret
+
+00803424 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803424:	55                   	push   %ebp
+  803425:	89 e5                	mov    %esp,%ebp
+  803427:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  80342a:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  80342f:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803432:	c1 e0 04             	shl    $0x4,%eax
+  803435:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80343a:	8b 40 50             	mov    0x50(%eax),%eax
+  80343d:	39 c8                	cmp    %ecx,%eax
+  80343f:	74 12                	je     803453 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  803441:	83 c2 01             	add    $0x1,%edx
+  803444:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  80344a:	75 e3                	jne    80342f <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  80344c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803451:	eb 0e                	jmp    803461 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  803453:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803456:	c1 e0 04             	shl    $0x4,%eax
+  803459:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80345e:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803461:	5d                   	pop    %ebp
+  803462:	c3                   	ret
+
+00803463 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803463:	55                   	push   %ebp
+  803464:	89 e5                	mov    %esp,%ebp
+  803466:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  803469:	89 c2                	mov    %eax,%edx
+  80346b:	c1 ea 16             	shr    $0x16,%edx
+  80346e:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  803475:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  80347a:	f6 c1 01             	test   $0x1,%cl
+  80347d:	74 1c                	je     80349b <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  80347f:	c1 e8 0c             	shr    $0xc,%eax
+  803482:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  803489:	a8 01                	test   $0x1,%al
+  80348b:	74 0e                	je     80349b <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  80348d:	c1 e8 0c             	shr    $0xc,%eax
+  803490:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  803497:	ef 
+  803498:	0f b7 d2             	movzwl %dx,%edx
+}
+  80349b:	89 d0                	mov    %edx,%eax
+  80349d:	5d                   	pop    %ebp
+  80349e:	c3                   	ret
+
+0080349f <udivmod>:
+  80349f:	55                   	push   %ebp
+  8034a0:	57                   	push   %edi
+  8034a1:	56                   	push   %esi
+  8034a2:	53                   	push   %ebx
+  8034a3:	83 ec 14             	sub    $0x14,%esp
+  8034a6:	8b 74 24 28          	mov    0x28(%esp),%esi
+  8034aa:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  8034ae:	89 fb                	mov    %edi,%ebx
+  8034b0:	09 f3                	or     %esi,%ebx
+  8034b2:	0f 84 88 00 00 00    	je     803540 <udivmod+0xa1>
+  8034b8:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8034bd:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8034c4:	00 
+  8034c5:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8034cc:	00 
+  8034cd:	89 cd                	mov    %ecx,%ebp
+  8034cf:	89 34 24             	mov    %esi,(%esp)
+  8034d2:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  8034d6:	eb 08                	jmp    8034e0 <udivmod+0x41>
+  8034d8:	83 ed 01             	sub    $0x1,%ebp
+  8034db:	83 fd ff             	cmp    $0xffffffff,%ebp
+  8034de:	74 6c                	je     80354c <udivmod+0xad>
+  8034e0:	89 c3                	mov    %eax,%ebx
+  8034e2:	89 d6                	mov    %edx,%esi
+  8034e4:	89 e9                	mov    %ebp,%ecx
+  8034e6:	0f ad f3             	shrd   %cl,%esi,%ebx
+  8034e9:	d3 ee                	shr    %cl,%esi
+  8034eb:	f6 c1 20             	test   $0x20,%cl
+  8034ee:	74 04                	je     8034f4 <udivmod+0x55>
+  8034f0:	89 f3                	mov    %esi,%ebx
+  8034f2:	31 f6                	xor    %esi,%esi
+  8034f4:	8b 3c 24             	mov    (%esp),%edi
+  8034f7:	39 fb                	cmp    %edi,%ebx
+  8034f9:	89 f7                	mov    %esi,%edi
+  8034fb:	8b 1c 24             	mov    (%esp),%ebx
+  8034fe:	8b 74 24 04          	mov    0x4(%esp),%esi
+  803502:	19 f7                	sbb    %esi,%edi
+  803504:	72 d2                	jb     8034d8 <udivmod+0x39>
+  803506:	89 f7                	mov    %esi,%edi
+  803508:	89 de                	mov    %ebx,%esi
+  80350a:	89 e9                	mov    %ebp,%ecx
+  80350c:	0f a5 f7             	shld   %cl,%esi,%edi
+  80350f:	d3 e6                	shl    %cl,%esi
+  803511:	f6 c1 20             	test   $0x20,%cl
+  803514:	74 04                	je     80351a <udivmod+0x7b>
+  803516:	89 f7                	mov    %esi,%edi
+  803518:	31 f6                	xor    %esi,%esi
+  80351a:	29 f0                	sub    %esi,%eax
+  80351c:	19 fa                	sbb    %edi,%edx
+  80351e:	be 01 00 00 00       	mov    $0x1,%esi
+  803523:	bf 00 00 00 00       	mov    $0x0,%edi
+  803528:	0f a5 f7             	shld   %cl,%esi,%edi
+  80352b:	d3 e6                	shl    %cl,%esi
+  80352d:	f6 c1 20             	test   $0x20,%cl
+  803530:	74 04                	je     803536 <udivmod+0x97>
+  803532:	89 f7                	mov    %esi,%edi
+  803534:	31 f6                	xor    %esi,%esi
+  803536:	09 74 24 08          	or     %esi,0x8(%esp)
+  80353a:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  80353e:	eb 98                	jmp    8034d8 <udivmod+0x39>
+  803540:	89 f0                	mov    %esi,%eax
+  803542:	89 fa                	mov    %edi,%edx
+  803544:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803548:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  80354c:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  803550:	89 01                	mov    %eax,(%ecx)
+  803552:	89 51 04             	mov    %edx,0x4(%ecx)
+  803555:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803559:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80355d:	83 c4 14             	add    $0x14,%esp
+  803560:	5b                   	pop    %ebx
+  803561:	5e                   	pop    %esi
+  803562:	5f                   	pop    %edi
+  803563:	5d                   	pop    %ebp
+  803564:	c3                   	ret
+
+00803565 <__udivdi3>:
+  803565:	83 ec 18             	sub    $0x18,%esp
+  803568:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80356c:	50                   	push   %eax
+  80356d:	ff 74 24 2c          	push   0x2c(%esp)
+  803571:	ff 74 24 2c          	push   0x2c(%esp)
+  803575:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803579:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80357d:	e8 1d ff ff ff       	call   80349f <udivmod>
+  803582:	83 c4 24             	add    $0x24,%esp
+  803585:	c3                   	ret
+
+00803586 <__umoddi3>:
+  803586:	83 ec 18             	sub    $0x18,%esp
+  803589:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80358d:	50                   	push   %eax
+  80358e:	ff 74 24 2c          	push   0x2c(%esp)
+  803592:	ff 74 24 2c          	push   0x2c(%esp)
+  803596:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80359a:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80359e:	e8 fc fe ff ff       	call   80349f <udivmod>
+  8035a3:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8035a7:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8035ab:	83 c4 24             	add    $0x24,%esp
+  8035ae:	c3                   	ret
+
+008035af <__divdi3>:
+  8035af:	56                   	push   %esi
+  8035b0:	53                   	push   %ebx
+  8035b1:	83 ec 14             	sub    $0x14,%esp
+  8035b4:	8b 44 24 20          	mov    0x20(%esp),%eax
+  8035b8:	8b 54 24 24          	mov    0x24(%esp),%edx
+  8035bc:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  8035c0:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  8035c4:	85 d2                	test   %edx,%edx
+  8035c6:	78 18                	js     8035e0 <__divdi3+0x31>
+  8035c8:	85 db                	test   %ebx,%ebx
+  8035ca:	78 3e                	js     80360a <__divdi3+0x5b>
+  8035cc:	83 ec 04             	sub    $0x4,%esp
+  8035cf:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8035d3:	56                   	push   %esi
+  8035d4:	53                   	push   %ebx
+  8035d5:	51                   	push   %ecx
+  8035d6:	e8 c4 fe ff ff       	call   80349f <udivmod>
+  8035db:	83 c4 10             	add    $0x10,%esp
+  8035de:	eb 24                	jmp    803604 <__divdi3+0x55>
+  8035e0:	f7 d8                	neg    %eax
+  8035e2:	83 d2 00             	adc    $0x0,%edx
+  8035e5:	f7 da                	neg    %edx
+  8035e7:	85 db                	test   %ebx,%ebx
+  8035e9:	78 3a                	js     803625 <__divdi3+0x76>
+  8035eb:	83 ec 04             	sub    $0x4,%esp
+  8035ee:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8035f2:	56                   	push   %esi
+  8035f3:	53                   	push   %ebx
+  8035f4:	51                   	push   %ecx
+  8035f5:	e8 a5 fe ff ff       	call   80349f <udivmod>
+  8035fa:	83 c4 10             	add    $0x10,%esp
+  8035fd:	f7 d8                	neg    %eax
+  8035ff:	83 d2 00             	adc    $0x0,%edx
+  803602:	f7 da                	neg    %edx
+  803604:	83 c4 14             	add    $0x14,%esp
+  803607:	5b                   	pop    %ebx
+  803608:	5e                   	pop    %esi
+  803609:	c3                   	ret
+  80360a:	83 ec 04             	sub    $0x4,%esp
+  80360d:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803611:	56                   	push   %esi
+  803612:	f7 d9                	neg    %ecx
+  803614:	83 d3 00             	adc    $0x0,%ebx
+  803617:	f7 db                	neg    %ebx
+  803619:	53                   	push   %ebx
+  80361a:	51                   	push   %ecx
+  80361b:	e8 7f fe ff ff       	call   80349f <udivmod>
+  803620:	83 c4 10             	add    $0x10,%esp
+  803623:	eb d8                	jmp    8035fd <__divdi3+0x4e>
+  803625:	83 ec 04             	sub    $0x4,%esp
+  803628:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80362c:	56                   	push   %esi
+  80362d:	f7 d9                	neg    %ecx
+  80362f:	83 d3 00             	adc    $0x0,%ebx
+  803632:	f7 db                	neg    %ebx
+  803634:	53                   	push   %ebx
+  803635:	51                   	push   %ecx
+  803636:	e8 64 fe ff ff       	call   80349f <udivmod>
+  80363b:	83 c4 10             	add    $0x10,%esp
+  80363e:	eb c4                	jmp    803604 <__divdi3+0x55>
+
+00803640 <__moddi3>:
+  803640:	55                   	push   %ebp
+  803641:	57                   	push   %edi
+  803642:	56                   	push   %esi
+  803643:	53                   	push   %ebx
+  803644:	83 ec 24             	sub    $0x24,%esp
+  803647:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80364b:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80364f:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  803653:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  803657:	85 d2                	test   %edx,%edx
+  803659:	78 3b                	js     803696 <__moddi3+0x56>
+  80365b:	83 ec 04             	sub    $0x4,%esp
+  80365e:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803662:	56                   	push   %esi
+  803663:	89 ce                	mov    %ecx,%esi
+  803665:	f7 de                	neg    %esi
+  803667:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80366b:	89 de                	mov    %ebx,%esi
+  80366d:	83 d6 00             	adc    $0x0,%esi
+  803670:	f7 de                	neg    %esi
+  803672:	89 74 24 14          	mov    %esi,0x14(%esp)
+  803676:	8b 74 24 08          	mov    0x8(%esp),%esi
+  80367a:	0f 48 f1             	cmovs  %ecx,%esi
+  80367d:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  803682:	53                   	push   %ebx
+  803683:	56                   	push   %esi
+  803684:	e8 16 fe ff ff       	call   80349f <udivmod>
+  803689:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80368d:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803691:	83 c4 10             	add    $0x10,%esp
+  803694:	eb 47                	jmp    8036dd <__moddi3+0x9d>
+  803696:	f7 d8                	neg    %eax
+  803698:	83 d2 00             	adc    $0x0,%edx
+  80369b:	f7 da                	neg    %edx
+  80369d:	83 ec 04             	sub    $0x4,%esp
+  8036a0:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8036a4:	56                   	push   %esi
+  8036a5:	89 cf                	mov    %ecx,%edi
+  8036a7:	f7 df                	neg    %edi
+  8036a9:	89 de                	mov    %ebx,%esi
+  8036ab:	83 d6 00             	adc    $0x0,%esi
+  8036ae:	f7 de                	neg    %esi
+  8036b0:	0f 49 cf             	cmovns %edi,%ecx
+  8036b3:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  8036b7:	0f 49 de             	cmovns %esi,%ebx
+  8036ba:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  8036be:	ff 74 24 0c          	push   0xc(%esp)
+  8036c2:	ff 74 24 0c          	push   0xc(%esp)
+  8036c6:	e8 d4 fd ff ff       	call   80349f <udivmod>
+  8036cb:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8036cf:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8036d3:	f7 d8                	neg    %eax
+  8036d5:	83 d2 00             	adc    $0x0,%edx
+  8036d8:	f7 da                	neg    %edx
+  8036da:	83 c4 10             	add    $0x10,%esp
+  8036dd:	83 c4 24             	add    $0x24,%esp
+  8036e0:	5b                   	pop    %ebx
+  8036e1:	5e                   	pop    %esi
+  8036e2:	5f                   	pop    %edi
+  8036e3:	5d                   	pop    %ebp
+  8036e4:	c3                   	ret
@@ -0,0 +1,6367 @@
+
+obj/user/idle.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 19 00 00 00       	call   80004a <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#include <inc/x86.h>
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 08             	sub    $0x8,%esp
+  binaryname = "idle";
+  800039:	c7 05 00 40 80 00 60 	movl   $0x802e60,0x804000
+  800040:	2e 80 00 
+  // Instead of busy-waiting like this,
+  // a better way would be to use the processor's HLT instruction
+  // to cause the processor to stop executing until the next interrupt -
+  // doing so allows the processor to conserve power more effectively.
+  while (1)
+    sys_yield();
+  800043:	e8 0c 01 00 00       	call   800154 <sys_yield>
+  while (1)
+  800048:	eb f9                	jmp    800043 <umain+0x10>
+
+0080004a <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80004a:	55                   	push   %ebp
+  80004b:	89 e5                	mov    %esp,%ebp
+  80004d:	56                   	push   %esi
+  80004e:	53                   	push   %ebx
+  80004f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800052:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  800055:	c7 05 44 57 80 00 00 	movl   $0x0,0x805744
+  80005c:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  80005f:	e8 d1 00 00 00       	call   800135 <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  800064:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800069:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80006c:	c1 e0 04             	shl    $0x4,%eax
+  80006f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800074:	a3 44 57 80 00       	mov    %eax,0x805744
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800079:	85 db                	test   %ebx,%ebx
+  80007b:	7e 07                	jle    800084 <libmain+0x3a>
+    binaryname = argv[0];
+  80007d:	8b 06                	mov    (%esi),%eax
+  80007f:	a3 00 40 80 00       	mov    %eax,0x804000
+
+  // call user main routine
+  umain(argc, argv);
+  800084:	83 ec 08             	sub    $0x8,%esp
+  800087:	56                   	push   %esi
+  800088:	53                   	push   %ebx
+  800089:	e8 a5 ff ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  80008e:	e8 0a 00 00 00       	call   80009d <exit>
+}
+  800093:	83 c4 10             	add    $0x10,%esp
+  800096:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800099:	5b                   	pop    %ebx
+  80009a:	5e                   	pop    %esi
+  80009b:	5d                   	pop    %ebp
+  80009c:	c3                   	ret
+
+0080009d <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80009d:	55                   	push   %ebp
+  80009e:	89 e5                	mov    %esp,%ebp
+  8000a0:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  8000a3:	e8 87 07 00 00       	call   80082f <close_all>
+  sys_env_destroy(0);
+  8000a8:	83 ec 0c             	sub    $0xc,%esp
+  8000ab:	6a 00                	push   $0x0
+  8000ad:	e8 42 00 00 00       	call   8000f4 <sys_env_destroy>
+}
+  8000b2:	83 c4 10             	add    $0x10,%esp
+  8000b5:	c9                   	leave
+  8000b6:	c3                   	ret
+
+008000b7 <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8000b7:	55                   	push   %ebp
+  8000b8:	89 e5                	mov    %esp,%ebp
+  8000ba:	57                   	push   %edi
+  8000bb:	56                   	push   %esi
+  8000bc:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8000bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000c5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000c8:	89 c3                	mov    %eax,%ebx
+  8000ca:	89 c7                	mov    %eax,%edi
+  8000cc:	89 c6                	mov    %eax,%esi
+  8000ce:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  8000d0:	5b                   	pop    %ebx
+  8000d1:	5e                   	pop    %esi
+  8000d2:	5f                   	pop    %edi
+  8000d3:	5d                   	pop    %ebp
+  8000d4:	c3                   	ret
+
+008000d5 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  8000d5:	55                   	push   %ebp
+  8000d6:	89 e5                	mov    %esp,%ebp
+  8000d8:	57                   	push   %edi
+  8000d9:	56                   	push   %esi
+  8000da:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8000db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000e0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000e5:	89 d1                	mov    %edx,%ecx
+  8000e7:	89 d3                	mov    %edx,%ebx
+  8000e9:	89 d7                	mov    %edx,%edi
+  8000eb:	89 d6                	mov    %edx,%esi
+  8000ed:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  8000ef:	5b                   	pop    %ebx
+  8000f0:	5e                   	pop    %esi
+  8000f1:	5f                   	pop    %edi
+  8000f2:	5d                   	pop    %ebp
+  8000f3:	c3                   	ret
+
+008000f4 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8000f4:	55                   	push   %ebp
+  8000f5:	89 e5                	mov    %esp,%ebp
+  8000f7:	57                   	push   %edi
+  8000f8:	56                   	push   %esi
+  8000f9:	53                   	push   %ebx
+  8000fa:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8000fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800102:	8b 55 08             	mov    0x8(%ebp),%edx
+  800105:	b8 03 00 00 00       	mov    $0x3,%eax
+  80010a:	89 cb                	mov    %ecx,%ebx
+  80010c:	89 cf                	mov    %ecx,%edi
+  80010e:	89 ce                	mov    %ecx,%esi
+  800110:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800112:	85 c0                	test   %eax,%eax
+  800114:	7f 08                	jg     80011e <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800116:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800119:	5b                   	pop    %ebx
+  80011a:	5e                   	pop    %esi
+  80011b:	5f                   	pop    %edi
+  80011c:	5d                   	pop    %ebp
+  80011d:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80011e:	83 ec 0c             	sub    $0xc,%esp
+  800121:	50                   	push   %eax
+  800122:	6a 03                	push   $0x3
+  800124:	68 6f 2e 80 00       	push   $0x802e6f
+  800129:	6a 23                	push   $0x23
+  80012b:	68 8c 2e 80 00       	push   $0x802e8c
+  800130:	e8 41 1f 00 00       	call   802076 <_panic>
+
+00800135 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800135:	55                   	push   %ebp
+  800136:	89 e5                	mov    %esp,%ebp
+  800138:	57                   	push   %edi
+  800139:	56                   	push   %esi
+  80013a:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80013b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800140:	b8 02 00 00 00       	mov    $0x2,%eax
+  800145:	89 d1                	mov    %edx,%ecx
+  800147:	89 d3                	mov    %edx,%ebx
+  800149:	89 d7                	mov    %edx,%edi
+  80014b:	89 d6                	mov    %edx,%esi
+  80014d:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  80014f:	5b                   	pop    %ebx
+  800150:	5e                   	pop    %esi
+  800151:	5f                   	pop    %edi
+  800152:	5d                   	pop    %ebp
+  800153:	c3                   	ret
+
+00800154 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800154:	55                   	push   %ebp
+  800155:	89 e5                	mov    %esp,%ebp
+  800157:	57                   	push   %edi
+  800158:	56                   	push   %esi
+  800159:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80015a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80015f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800164:	89 d1                	mov    %edx,%ecx
+  800166:	89 d3                	mov    %edx,%ebx
+  800168:	89 d7                	mov    %edx,%edi
+  80016a:	89 d6                	mov    %edx,%esi
+  80016c:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  80016e:	5b                   	pop    %ebx
+  80016f:	5e                   	pop    %esi
+  800170:	5f                   	pop    %edi
+  800171:	5d                   	pop    %ebp
+  800172:	c3                   	ret
+
+00800173 <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  800173:	55                   	push   %ebp
+  800174:	89 e5                	mov    %esp,%ebp
+  800176:	57                   	push   %edi
+  800177:	56                   	push   %esi
+  800178:	53                   	push   %ebx
+  800179:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  80017c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  800180:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800185:	8b 55 08             	mov    0x8(%ebp),%edx
+  800188:	b8 14 00 00 00       	mov    $0x14,%eax
+  80018d:	89 df                	mov    %ebx,%edi
+  80018f:	89 de                	mov    %ebx,%esi
+  800191:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800193:	85 c0                	test   %eax,%eax
+  800195:	7f 08                	jg     80019f <sys_env_set_cow+0x2c>
+}
+  800197:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80019a:	5b                   	pop    %ebx
+  80019b:	5e                   	pop    %esi
+  80019c:	5f                   	pop    %edi
+  80019d:	5d                   	pop    %ebp
+  80019e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80019f:	83 ec 0c             	sub    $0xc,%esp
+  8001a2:	50                   	push   %eax
+  8001a3:	6a 14                	push   $0x14
+  8001a5:	68 6f 2e 80 00       	push   $0x802e6f
+  8001aa:	6a 23                	push   $0x23
+  8001ac:	68 8c 2e 80 00       	push   $0x802e8c
+  8001b1:	e8 c0 1e 00 00       	call   802076 <_panic>
+
+008001b6 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8001b6:	55                   	push   %ebp
+  8001b7:	89 e5                	mov    %esp,%ebp
+  8001b9:	57                   	push   %edi
+  8001ba:	56                   	push   %esi
+  8001bb:	53                   	push   %ebx
+  8001bc:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8001bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8001c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001ca:	b8 04 00 00 00       	mov    $0x4,%eax
+  8001cf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001d2:	89 f7                	mov    %esi,%edi
+  8001d4:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8001d6:	85 c0                	test   %eax,%eax
+  8001d8:	7f 08                	jg     8001e2 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  8001da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001dd:	5b                   	pop    %ebx
+  8001de:	5e                   	pop    %esi
+  8001df:	5f                   	pop    %edi
+  8001e0:	5d                   	pop    %ebp
+  8001e1:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8001e2:	83 ec 0c             	sub    $0xc,%esp
+  8001e5:	50                   	push   %eax
+  8001e6:	6a 04                	push   $0x4
+  8001e8:	68 6f 2e 80 00       	push   $0x802e6f
+  8001ed:	6a 23                	push   $0x23
+  8001ef:	68 8c 2e 80 00       	push   $0x802e8c
+  8001f4:	e8 7d 1e 00 00       	call   802076 <_panic>
+
+008001f9 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8001f9:	55                   	push   %ebp
+  8001fa:	89 e5                	mov    %esp,%ebp
+  8001fc:	57                   	push   %edi
+  8001fd:	56                   	push   %esi
+  8001fe:	53                   	push   %ebx
+  8001ff:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800202:	8b 55 08             	mov    0x8(%ebp),%edx
+  800205:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800208:	b8 05 00 00 00       	mov    $0x5,%eax
+  80020d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800210:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800213:	8b 75 18             	mov    0x18(%ebp),%esi
+  800216:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800218:	85 c0                	test   %eax,%eax
+  80021a:	7f 08                	jg     800224 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  80021c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80021f:	5b                   	pop    %ebx
+  800220:	5e                   	pop    %esi
+  800221:	5f                   	pop    %edi
+  800222:	5d                   	pop    %ebp
+  800223:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800224:	83 ec 0c             	sub    $0xc,%esp
+  800227:	50                   	push   %eax
+  800228:	6a 05                	push   $0x5
+  80022a:	68 6f 2e 80 00       	push   $0x802e6f
+  80022f:	6a 23                	push   $0x23
+  800231:	68 8c 2e 80 00       	push   $0x802e8c
+  800236:	e8 3b 1e 00 00       	call   802076 <_panic>
+
+0080023b <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  80023b:	55                   	push   %ebp
+  80023c:	89 e5                	mov    %esp,%ebp
+  80023e:	57                   	push   %edi
+  80023f:	56                   	push   %esi
+  800240:	53                   	push   %ebx
+  800241:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800244:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800249:	8b 55 08             	mov    0x8(%ebp),%edx
+  80024c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80024f:	b8 06 00 00 00       	mov    $0x6,%eax
+  800254:	89 df                	mov    %ebx,%edi
+  800256:	89 de                	mov    %ebx,%esi
+  800258:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80025a:	85 c0                	test   %eax,%eax
+  80025c:	7f 08                	jg     800266 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  80025e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800261:	5b                   	pop    %ebx
+  800262:	5e                   	pop    %esi
+  800263:	5f                   	pop    %edi
+  800264:	5d                   	pop    %ebp
+  800265:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800266:	83 ec 0c             	sub    $0xc,%esp
+  800269:	50                   	push   %eax
+  80026a:	6a 06                	push   $0x6
+  80026c:	68 6f 2e 80 00       	push   $0x802e6f
+  800271:	6a 23                	push   $0x23
+  800273:	68 8c 2e 80 00       	push   $0x802e8c
+  800278:	e8 f9 1d 00 00       	call   802076 <_panic>
+
+0080027d <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  80027d:	55                   	push   %ebp
+  80027e:	89 e5                	mov    %esp,%ebp
+  800280:	57                   	push   %edi
+  800281:	56                   	push   %esi
+  800282:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800283:	8b 55 08             	mov    0x8(%ebp),%edx
+  800286:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800289:	b8 11 00 00 00       	mov    $0x11,%eax
+  80028e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800291:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800294:	8b 75 18             	mov    0x18(%ebp),%esi
+  800297:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  800299:	5b                   	pop    %ebx
+  80029a:	5e                   	pop    %esi
+  80029b:	5f                   	pop    %edi
+  80029c:	5d                   	pop    %ebp
+  80029d:	c3                   	ret
+
+0080029e <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  80029e:	55                   	push   %ebp
+  80029f:	89 e5                	mov    %esp,%ebp
+  8002a1:	57                   	push   %edi
+  8002a2:	56                   	push   %esi
+  8002a3:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8002a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002a7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002aa:	b8 12 00 00 00       	mov    $0x12,%eax
+  8002af:	be 00 00 00 00       	mov    $0x0,%esi
+  8002b4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8002b7:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8002ba:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  8002bc:	5b                   	pop    %ebx
+  8002bd:	5e                   	pop    %esi
+  8002be:	5f                   	pop    %edi
+  8002bf:	5d                   	pop    %ebp
+  8002c0:	c3                   	ret
+
+008002c1 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  8002c1:	55                   	push   %ebp
+  8002c2:	89 e5                	mov    %esp,%ebp
+  8002c4:	57                   	push   %edi
+  8002c5:	56                   	push   %esi
+  8002c6:	53                   	push   %ebx
+  8002c7:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8002ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002cf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002d2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002d5:	b8 16 00 00 00       	mov    $0x16,%eax
+  8002da:	89 df                	mov    %ebx,%edi
+  8002dc:	89 de                	mov    %ebx,%esi
+  8002de:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8002e0:	85 c0                	test   %eax,%eax
+  8002e2:	7f 08                	jg     8002ec <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  8002e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002e7:	5b                   	pop    %ebx
+  8002e8:	5e                   	pop    %esi
+  8002e9:	5f                   	pop    %edi
+  8002ea:	5d                   	pop    %ebp
+  8002eb:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8002ec:	83 ec 0c             	sub    $0xc,%esp
+  8002ef:	50                   	push   %eax
+  8002f0:	6a 16                	push   $0x16
+  8002f2:	68 6f 2e 80 00       	push   $0x802e6f
+  8002f7:	6a 23                	push   $0x23
+  8002f9:	68 8c 2e 80 00       	push   $0x802e8c
+  8002fe:	e8 73 1d 00 00       	call   802076 <_panic>
+
+00800303 <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  800303:	55                   	push   %ebp
+  800304:	89 e5                	mov    %esp,%ebp
+  800306:	57                   	push   %edi
+  800307:	56                   	push   %esi
+  800308:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800309:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80030e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800311:	b8 17 00 00 00       	mov    $0x17,%eax
+  800316:	89 cb                	mov    %ecx,%ebx
+  800318:	89 cf                	mov    %ecx,%edi
+  80031a:	89 ce                	mov    %ecx,%esi
+  80031c:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  80031e:	5b                   	pop    %ebx
+  80031f:	5e                   	pop    %esi
+  800320:	5f                   	pop    %edi
+  800321:	5d                   	pop    %ebp
+  800322:	c3                   	ret
+
+00800323 <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  800323:	55                   	push   %ebp
+  800324:	89 e5                	mov    %esp,%ebp
+  800326:	57                   	push   %edi
+  800327:	56                   	push   %esi
+  800328:	53                   	push   %ebx
+  800329:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80032c:	be 00 00 00 00       	mov    $0x0,%esi
+  800331:	8b 55 08             	mov    0x8(%ebp),%edx
+  800334:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800337:	b8 18 00 00 00       	mov    $0x18,%eax
+  80033c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80033f:	89 f7                	mov    %esi,%edi
+  800341:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800343:	85 c0                	test   %eax,%eax
+  800345:	7f 08                	jg     80034f <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  800347:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80034a:	5b                   	pop    %ebx
+  80034b:	5e                   	pop    %esi
+  80034c:	5f                   	pop    %edi
+  80034d:	5d                   	pop    %ebp
+  80034e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80034f:	83 ec 0c             	sub    $0xc,%esp
+  800352:	50                   	push   %eax
+  800353:	6a 18                	push   $0x18
+  800355:	68 6f 2e 80 00       	push   $0x802e6f
+  80035a:	6a 23                	push   $0x23
+  80035c:	68 8c 2e 80 00       	push   $0x802e8c
+  800361:	e8 10 1d 00 00       	call   802076 <_panic>
+
+00800366 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  800366:	55                   	push   %ebp
+  800367:	89 e5                	mov    %esp,%ebp
+  800369:	57                   	push   %edi
+  80036a:	56                   	push   %esi
+  80036b:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80036c:	be 00 00 00 00       	mov    $0x0,%esi
+  800371:	8b 55 08             	mov    0x8(%ebp),%edx
+  800374:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800377:	b8 19 00 00 00       	mov    $0x19,%eax
+  80037c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80037f:	89 f7                	mov    %esi,%edi
+  800381:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  800383:	5b                   	pop    %ebx
+  800384:	5e                   	pop    %esi
+  800385:	5f                   	pop    %edi
+  800386:	5d                   	pop    %ebp
+  800387:	c3                   	ret
+
+00800388 <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  800388:	55                   	push   %ebp
+  800389:	89 e5                	mov    %esp,%ebp
+  80038b:	57                   	push   %edi
+  80038c:	56                   	push   %esi
+  80038d:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80038e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800393:	b8 15 00 00 00       	mov    $0x15,%eax
+  800398:	89 d1                	mov    %edx,%ecx
+  80039a:	89 d3                	mov    %edx,%ebx
+  80039c:	89 d7                	mov    %edx,%edi
+  80039e:	89 d6                	mov    %edx,%esi
+  8003a0:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8003a2:	5b                   	pop    %ebx
+  8003a3:	5e                   	pop    %esi
+  8003a4:	5f                   	pop    %edi
+  8003a5:	5d                   	pop    %ebp
+  8003a6:	c3                   	ret
+
+008003a7 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8003a7:	55                   	push   %ebp
+  8003a8:	89 e5                	mov    %esp,%ebp
+  8003aa:	57                   	push   %edi
+  8003ab:	56                   	push   %esi
+  8003ac:	53                   	push   %ebx
+  8003ad:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8003b0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003b5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003b8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003bb:	b8 08 00 00 00       	mov    $0x8,%eax
+  8003c0:	89 df                	mov    %ebx,%edi
+  8003c2:	89 de                	mov    %ebx,%esi
+  8003c4:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8003c6:	85 c0                	test   %eax,%eax
+  8003c8:	7f 08                	jg     8003d2 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8003ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003cd:	5b                   	pop    %ebx
+  8003ce:	5e                   	pop    %esi
+  8003cf:	5f                   	pop    %edi
+  8003d0:	5d                   	pop    %ebp
+  8003d1:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8003d2:	83 ec 0c             	sub    $0xc,%esp
+  8003d5:	50                   	push   %eax
+  8003d6:	6a 08                	push   $0x8
+  8003d8:	68 6f 2e 80 00       	push   $0x802e6f
+  8003dd:	6a 23                	push   $0x23
+  8003df:	68 8c 2e 80 00       	push   $0x802e8c
+  8003e4:	e8 8d 1c 00 00       	call   802076 <_panic>
+
+008003e9 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8003e9:	55                   	push   %ebp
+  8003ea:	89 e5                	mov    %esp,%ebp
+  8003ec:	57                   	push   %edi
+  8003ed:	56                   	push   %esi
+  8003ee:	53                   	push   %ebx
+  8003ef:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8003f2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003f7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003fa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003fd:	b8 09 00 00 00       	mov    $0x9,%eax
+  800402:	89 df                	mov    %ebx,%edi
+  800404:	89 de                	mov    %ebx,%esi
+  800406:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800408:	85 c0                	test   %eax,%eax
+  80040a:	7f 08                	jg     800414 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  80040c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80040f:	5b                   	pop    %ebx
+  800410:	5e                   	pop    %esi
+  800411:	5f                   	pop    %edi
+  800412:	5d                   	pop    %ebp
+  800413:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800414:	83 ec 0c             	sub    $0xc,%esp
+  800417:	50                   	push   %eax
+  800418:	6a 09                	push   $0x9
+  80041a:	68 6f 2e 80 00       	push   $0x802e6f
+  80041f:	6a 23                	push   $0x23
+  800421:	68 8c 2e 80 00       	push   $0x802e8c
+  800426:	e8 4b 1c 00 00       	call   802076 <_panic>
+
+0080042b <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80042b:	55                   	push   %ebp
+  80042c:	89 e5                	mov    %esp,%ebp
+  80042e:	57                   	push   %edi
+  80042f:	56                   	push   %esi
+  800430:	53                   	push   %ebx
+  800431:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800434:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800439:	8b 55 08             	mov    0x8(%ebp),%edx
+  80043c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80043f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800444:	89 df                	mov    %ebx,%edi
+  800446:	89 de                	mov    %ebx,%esi
+  800448:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80044a:	85 c0                	test   %eax,%eax
+  80044c:	7f 08                	jg     800456 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  80044e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800451:	5b                   	pop    %ebx
+  800452:	5e                   	pop    %esi
+  800453:	5f                   	pop    %edi
+  800454:	5d                   	pop    %ebp
+  800455:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800456:	83 ec 0c             	sub    $0xc,%esp
+  800459:	50                   	push   %eax
+  80045a:	6a 0a                	push   $0xa
+  80045c:	68 6f 2e 80 00       	push   $0x802e6f
+  800461:	6a 23                	push   $0x23
+  800463:	68 8c 2e 80 00       	push   $0x802e8c
+  800468:	e8 09 1c 00 00       	call   802076 <_panic>
+
+0080046d <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  80046d:	55                   	push   %ebp
+  80046e:	89 e5                	mov    %esp,%ebp
+  800470:	57                   	push   %edi
+  800471:	56                   	push   %esi
+  800472:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800473:	8b 55 08             	mov    0x8(%ebp),%edx
+  800476:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800479:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80047e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800481:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800484:	8b 75 18             	mov    0x18(%ebp),%esi
+  800487:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  800489:	5b                   	pop    %ebx
+  80048a:	5e                   	pop    %esi
+  80048b:	5f                   	pop    %edi
+  80048c:	5d                   	pop    %ebp
+  80048d:	c3                   	ret
+
+0080048e <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  80048e:	55                   	push   %ebp
+  80048f:	89 e5                	mov    %esp,%ebp
+  800491:	57                   	push   %edi
+  800492:	56                   	push   %esi
+  800493:	53                   	push   %ebx
+  800494:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800497:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80049c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80049f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004a2:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8004a7:	89 df                	mov    %ebx,%edi
+  8004a9:	89 de                	mov    %ebx,%esi
+  8004ab:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8004ad:	85 c0                	test   %eax,%eax
+  8004af:	7f 08                	jg     8004b9 <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  8004b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004b4:	5b                   	pop    %ebx
+  8004b5:	5e                   	pop    %esi
+  8004b6:	5f                   	pop    %edi
+  8004b7:	5d                   	pop    %ebp
+  8004b8:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8004b9:	83 ec 0c             	sub    $0xc,%esp
+  8004bc:	50                   	push   %eax
+  8004bd:	6a 0d                	push   $0xd
+  8004bf:	68 6f 2e 80 00       	push   $0x802e6f
+  8004c4:	6a 23                	push   $0x23
+  8004c6:	68 8c 2e 80 00       	push   $0x802e8c
+  8004cb:	e8 a6 1b 00 00       	call   802076 <_panic>
+
+008004d0 <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  8004d0:	55                   	push   %ebp
+  8004d1:	89 e5                	mov    %esp,%ebp
+  8004d3:	57                   	push   %edi
+  8004d4:	56                   	push   %esi
+  8004d5:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8004d6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004db:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8004e0:	89 d1                	mov    %edx,%ecx
+  8004e2:	89 d3                	mov    %edx,%ebx
+  8004e4:	89 d7                	mov    %edx,%edi
+  8004e6:	89 d6                	mov    %edx,%esi
+  8004e8:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8004ea:	5b                   	pop    %ebx
+  8004eb:	5e                   	pop    %esi
+  8004ec:	5f                   	pop    %edi
+  8004ed:	5d                   	pop    %ebp
+  8004ee:	c3                   	ret
+
+008004ef <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  8004ef:	55                   	push   %ebp
+  8004f0:	89 e5                	mov    %esp,%ebp
+  8004f2:	57                   	push   %edi
+  8004f3:	56                   	push   %esi
+  8004f4:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8004f5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004f8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004fb:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800500:	be 00 00 00 00       	mov    $0x0,%esi
+  800505:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800508:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80050b:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  80050d:	5b                   	pop    %ebx
+  80050e:	5e                   	pop    %esi
+  80050f:	5f                   	pop    %edi
+  800510:	5d                   	pop    %ebp
+  800511:	c3                   	ret
+
+00800512 <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  800512:	55                   	push   %ebp
+  800513:	89 e5                	mov    %esp,%ebp
+  800515:	57                   	push   %edi
+  800516:	56                   	push   %esi
+  800517:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800518:	be 00 00 00 00       	mov    $0x0,%esi
+  80051d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800520:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800523:	b8 10 00 00 00       	mov    $0x10,%eax
+  800528:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80052b:	89 f7                	mov    %esi,%edi
+  80052d:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  80052f:	5b                   	pop    %ebx
+  800530:	5e                   	pop    %esi
+  800531:	5f                   	pop    %edi
+  800532:	5d                   	pop    %ebp
+  800533:	c3                   	ret
+
+00800534 <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  800534:	55                   	push   %ebp
+  800535:	89 e5                	mov    %esp,%ebp
+  800537:	57                   	push   %edi
+  800538:	56                   	push   %esi
+  800539:	53                   	push   %ebx
+  80053a:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  80053d:	80 3d 48 57 80 00 00 	cmpb   $0x0,0x805748
+  800544:	74 41                	je     800587 <sys_batch+0x53>
+  800546:	8b 45 08             	mov    0x8(%ebp),%eax
+  800549:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  80054c:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  800553:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800556:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  800559:	7d 45                	jge    8005a0 <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  80055b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80055e:	8b 06                	mov    (%esi),%eax
+  800560:	8b 56 04             	mov    0x4(%esi),%edx
+  800563:	8b 4e 08             	mov    0x8(%esi),%ecx
+  800566:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  800569:	8b 7e 10             	mov    0x10(%esi),%edi
+  80056c:	8b 76 14             	mov    0x14(%esi),%esi
+  80056f:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  800571:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800574:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  800577:	83 c6 1c             	add    $0x1c,%esi
+  80057a:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  80057d:	85 c0                	test   %eax,%eax
+  80057f:	78 1f                	js     8005a0 <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  800581:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  800585:	eb cc                	jmp    800553 <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  800587:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80058c:	b8 13 00 00 00       	mov    $0x13,%eax
+  800591:	8b 55 08             	mov    0x8(%ebp),%edx
+  800594:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800597:	89 df                	mov    %ebx,%edi
+  800599:	89 de                	mov    %ebx,%esi
+  80059b:	cd 30                	int    $0x30
+  80059d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  8005a0:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8005a3:	83 c4 08             	add    $0x8,%esp
+  8005a6:	5b                   	pop    %ebx
+  8005a7:	5e                   	pop    %esi
+  8005a8:	5f                   	pop    %edi
+  8005a9:	5d                   	pop    %ebp
+  8005aa:	c3                   	ret
+
+008005ab <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  8005ab:	55                   	push   %ebp
+  8005ac:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  8005ae:	8b 45 08             	mov    0x8(%ebp),%eax
+  8005b1:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8005b7:	5d                   	pop    %ebp
+  8005b8:	c3                   	ret
+
+008005b9 <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  8005b9:	55                   	push   %ebp
+  8005ba:	89 e5                	mov    %esp,%ebp
+  8005bc:	56                   	push   %esi
+  8005bd:	53                   	push   %ebx
+  8005be:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  8005c1:	8b 1e                	mov    (%esi),%ebx
+  8005c3:	85 db                	test   %ebx,%ebx
+  8005c5:	75 09                	jne    8005d0 <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  8005c7:	89 d8                	mov    %ebx,%eax
+  8005c9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8005cc:	5b                   	pop    %ebx
+  8005cd:	5e                   	pop    %esi
+  8005ce:	5d                   	pop    %ebp
+  8005cf:	c3                   	ret
+  b->sb_n = 0;
+  8005d0:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  8005d6:	53                   	push   %ebx
+  8005d7:	8d 46 04             	lea    0x4(%esi),%eax
+  8005da:	50                   	push   %eax
+  8005db:	e8 54 ff ff ff       	call   800534 <sys_batch>
+  8005e0:	83 c4 08             	add    $0x8,%esp
+  8005e3:	85 c0                	test   %eax,%eax
+  8005e5:	78 1e                	js     800605 <sysbatch_flush+0x4c>
+  if (r < n)
+  8005e7:	39 c3                	cmp    %eax,%ebx
+  8005e9:	7f 07                	jg     8005f2 <sysbatch_flush+0x39>
+  return 0;
+  8005eb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005f0:	eb d5                	jmp    8005c7 <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  8005f2:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8005f5:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  8005f9:	85 db                	test   %ebx,%ebx
+  8005fb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800600:	0f 49 d8             	cmovns %eax,%ebx
+  800603:	eb c2                	jmp    8005c7 <sysbatch_flush+0xe>
+    return r;
+  800605:	89 c3                	mov    %eax,%ebx
+  800607:	eb be                	jmp    8005c7 <sysbatch_flush+0xe>
+
+00800609 <sysbatch_add>:
+{
+  800609:	55                   	push   %ebp
+  80060a:	89 e5                	mov    %esp,%ebp
+  80060c:	53                   	push   %ebx
+  80060d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  800610:	83 3b 40             	cmpl   $0x40,(%ebx)
+  800613:	74 41                	je     800656 <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  800615:	8b 03                	mov    (%ebx),%eax
+  800617:	8d 50 01             	lea    0x1(%eax),%edx
+  80061a:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  80061c:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80061f:	01 d8                	add    %ebx,%eax
+  800621:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800624:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  800627:	8b 55 10             	mov    0x10(%ebp),%edx
+  80062a:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  80062d:	8b 55 14             	mov    0x14(%ebp),%edx
+  800630:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  800633:	8b 55 18             	mov    0x18(%ebp),%edx
+  800636:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  800639:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  80063c:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  80063f:	8b 55 20             	mov    0x20(%ebp),%edx
+  800642:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  800645:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  80064c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800651:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800654:	c9                   	leave
+  800655:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  800656:	53                   	push   %ebx
+  800657:	e8 5d ff ff ff       	call   8005b9 <sysbatch_flush>
+  80065c:	83 c4 04             	add    $0x4,%esp
+  80065f:	85 c0                	test   %eax,%eax
+  800661:	79 b2                	jns    800615 <sysbatch_add+0xc>
+  800663:	eb ec                	jmp    800651 <sysbatch_add+0x48>
+
+00800665 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800665:	55                   	push   %ebp
+  800666:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  800668:	8b 45 08             	mov    0x8(%ebp),%eax
+  80066b:	05 00 00 00 30       	add    $0x30000000,%eax
+  800670:	c1 e8 0c             	shr    $0xc,%eax
+}
+  800673:	5d                   	pop    %ebp
+  800674:	c3                   	ret
+
+00800675 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800675:	55                   	push   %ebp
+  800676:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  800678:	8b 45 08             	mov    0x8(%ebp),%eax
+  80067b:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  80067e:	66 b8 00 00          	mov    $0x0,%ax
+  800682:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  800687:	5d                   	pop    %ebp
+  800688:	c3                   	ret
+
+00800689 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800689:	55                   	push   %ebp
+  80068a:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  80068c:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  800691:	eb 02                	jmp    800695 <fd_alloc+0xc>
+  800693:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800695:	89 c2                	mov    %eax,%edx
+  800697:	c1 ea 16             	shr    $0x16,%edx
+  80069a:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8006a1:	f6 c2 01             	test   $0x1,%dl
+  8006a4:	74 2b                	je     8006d1 <fd_alloc+0x48>
+  8006a6:	89 c2                	mov    %eax,%edx
+  8006a8:	c1 ea 0c             	shr    $0xc,%edx
+  8006ab:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8006b2:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8006b8:	f6 c1 01             	test   $0x1,%cl
+  8006bb:	74 14                	je     8006d1 <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  8006bd:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8006c3:	75 ce                	jne    800693 <fd_alloc+0xa>
+  8006c5:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  8006ca:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8006cf:	eb 05                	jmp    8006d6 <fd_alloc+0x4d>
+      return 0;
+  8006d1:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  8006d6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006d9:	89 02                	mov    %eax,(%edx)
+}
+  8006db:	89 c8                	mov    %ecx,%eax
+  8006dd:	5d                   	pop    %ebp
+  8006de:	c3                   	ret
+
+008006df <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8006df:	55                   	push   %ebp
+  8006e0:	89 e5                	mov    %esp,%ebp
+  8006e2:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  8006e5:	83 f8 1f             	cmp    $0x1f,%eax
+  8006e8:	77 30                	ja     80071a <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  8006ea:	c1 e0 0c             	shl    $0xc,%eax
+  8006ed:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8006f2:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8006f8:	f6 c2 01             	test   $0x1,%dl
+  8006fb:	74 24                	je     800721 <fd_lookup+0x42>
+  8006fd:	89 c2                	mov    %eax,%edx
+  8006ff:	c1 ea 0c             	shr    $0xc,%edx
+  800702:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800709:	f6 c2 01             	test   $0x1,%dl
+  80070c:	74 1a                	je     800728 <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  80070e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800711:	89 02                	mov    %eax,(%edx)
+  return 0;
+  800713:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800718:	5d                   	pop    %ebp
+  800719:	c3                   	ret
+    return -E_INVAL;
+  80071a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80071f:	eb f7                	jmp    800718 <fd_lookup+0x39>
+    return -E_INVAL;
+  800721:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800726:	eb f0                	jmp    800718 <fd_lookup+0x39>
+  800728:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80072d:	eb e9                	jmp    800718 <fd_lookup+0x39>
+
+0080072f <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80072f:	55                   	push   %ebp
+  800730:	89 e5                	mov    %esp,%ebp
+  800732:	53                   	push   %ebx
+  800733:	83 ec 04             	sub    $0x4,%esp
+  800736:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  800739:	b8 18 2f 80 00       	mov    $0x802f18,%eax
+  80073e:	8b 18                	mov    (%eax),%ebx
+  800740:	85 db                	test   %ebx,%ebx
+  800742:	74 0e                	je     800752 <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  800744:	83 c0 04             	add    $0x4,%eax
+  800747:	39 13                	cmp    %edx,(%ebx)
+  800749:	75 f3                	jne    80073e <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  80074b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800750:	eb 1f                	jmp    800771 <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800752:	a1 44 57 80 00       	mov    0x805744,%eax
+  800757:	8b 40 48             	mov    0x48(%eax),%eax
+  80075a:	83 ec 04             	sub    $0x4,%esp
+  80075d:	52                   	push   %edx
+  80075e:	50                   	push   %eax
+  80075f:	68 9c 2e 80 00       	push   $0x802e9c
+  800764:	e8 e8 19 00 00       	call   802151 <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  800769:	83 c4 10             	add    $0x10,%esp
+  80076c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  800771:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800774:	89 1a                	mov    %ebx,(%edx)
+}
+  800776:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800779:	c9                   	leave
+  80077a:	c3                   	ret
+
+0080077b <fd_close>:
+{
+  80077b:	55                   	push   %ebp
+  80077c:	89 e5                	mov    %esp,%ebp
+  80077e:	57                   	push   %edi
+  80077f:	56                   	push   %esi
+  800780:	53                   	push   %ebx
+  800781:	83 ec 24             	sub    $0x24,%esp
+  800784:	8b 75 08             	mov    0x8(%ebp),%esi
+  800787:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80078a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80078d:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80078e:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800794:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800797:	50                   	push   %eax
+  800798:	e8 42 ff ff ff       	call   8006df <fd_lookup>
+  80079d:	89 c3                	mov    %eax,%ebx
+  80079f:	83 c4 10             	add    $0x10,%esp
+  8007a2:	85 c0                	test   %eax,%eax
+  8007a4:	78 05                	js     8007ab <fd_close+0x30>
+      || fd != fd2)
+  8007a6:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8007a9:	74 16                	je     8007c1 <fd_close+0x46>
+    return must_exist ? r : 0;
+  8007ab:	89 f8                	mov    %edi,%eax
+  8007ad:	84 c0                	test   %al,%al
+  8007af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007b4:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8007b7:	89 d8                	mov    %ebx,%eax
+  8007b9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007bc:	5b                   	pop    %ebx
+  8007bd:	5e                   	pop    %esi
+  8007be:	5f                   	pop    %edi
+  8007bf:	5d                   	pop    %ebp
+  8007c0:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8007c1:	83 ec 08             	sub    $0x8,%esp
+  8007c4:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8007c7:	50                   	push   %eax
+  8007c8:	ff 36                	push   (%esi)
+  8007ca:	e8 60 ff ff ff       	call   80072f <dev_lookup>
+  8007cf:	89 c3                	mov    %eax,%ebx
+  8007d1:	83 c4 10             	add    $0x10,%esp
+  8007d4:	85 c0                	test   %eax,%eax
+  8007d6:	78 1a                	js     8007f2 <fd_close+0x77>
+    if (dev->dev_close)
+  8007d8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8007db:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  8007de:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  8007e3:	85 c0                	test   %eax,%eax
+  8007e5:	74 0b                	je     8007f2 <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  8007e7:	83 ec 0c             	sub    $0xc,%esp
+  8007ea:	56                   	push   %esi
+  8007eb:	ff d0                	call   *%eax
+  8007ed:	89 c3                	mov    %eax,%ebx
+  8007ef:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  8007f2:	83 ec 08             	sub    $0x8,%esp
+  8007f5:	56                   	push   %esi
+  8007f6:	6a 00                	push   $0x0
+  8007f8:	e8 3e fa ff ff       	call   80023b <sys_page_unmap>
+  return r;
+  8007fd:	83 c4 10             	add    $0x10,%esp
+  800800:	eb b5                	jmp    8007b7 <fd_close+0x3c>
+
+00800802 <close>:
+
+int
+close(int fdnum)
+{
+  800802:	55                   	push   %ebp
+  800803:	89 e5                	mov    %esp,%ebp
+  800805:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800808:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80080b:	50                   	push   %eax
+  80080c:	ff 75 08             	push   0x8(%ebp)
+  80080f:	e8 cb fe ff ff       	call   8006df <fd_lookup>
+  800814:	83 c4 10             	add    $0x10,%esp
+  800817:	85 c0                	test   %eax,%eax
+  800819:	79 02                	jns    80081d <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  80081b:	c9                   	leave
+  80081c:	c3                   	ret
+    return fd_close(fd, 1);
+  80081d:	83 ec 08             	sub    $0x8,%esp
+  800820:	6a 01                	push   $0x1
+  800822:	ff 75 f4             	push   -0xc(%ebp)
+  800825:	e8 51 ff ff ff       	call   80077b <fd_close>
+  80082a:	83 c4 10             	add    $0x10,%esp
+  80082d:	eb ec                	jmp    80081b <close+0x19>
+
+0080082f <close_all>:
+
+void
+close_all(void)
+{
+  80082f:	55                   	push   %ebp
+  800830:	89 e5                	mov    %esp,%ebp
+  800832:	53                   	push   %ebx
+  800833:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  800836:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  80083b:	83 ec 0c             	sub    $0xc,%esp
+  80083e:	53                   	push   %ebx
+  80083f:	e8 be ff ff ff       	call   800802 <close>
+  for (i = 0; i < MAXFD; i++)
+  800844:	83 c3 01             	add    $0x1,%ebx
+  800847:	83 c4 10             	add    $0x10,%esp
+  80084a:	83 fb 20             	cmp    $0x20,%ebx
+  80084d:	75 ec                	jne    80083b <close_all+0xc>
+}
+  80084f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800852:	c9                   	leave
+  800853:	c3                   	ret
+
+00800854 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  800854:	55                   	push   %ebp
+  800855:	89 e5                	mov    %esp,%ebp
+  800857:	57                   	push   %edi
+  800858:	56                   	push   %esi
+  800859:	53                   	push   %ebx
+  80085a:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80085d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800860:	50                   	push   %eax
+  800861:	ff 75 08             	push   0x8(%ebp)
+  800864:	e8 76 fe ff ff       	call   8006df <fd_lookup>
+  800869:	89 c6                	mov    %eax,%esi
+  80086b:	83 c4 10             	add    $0x10,%esp
+  80086e:	85 c0                	test   %eax,%eax
+  800870:	0f 88 0a 01 00 00    	js     800980 <dup+0x12c>
+    return r;
+  close(newfdnum);
+  800876:	83 ec 0c             	sub    $0xc,%esp
+  800879:	ff 75 0c             	push   0xc(%ebp)
+  80087c:	e8 81 ff ff ff       	call   800802 <close>
+
+  newfd = INDEX2FD(newfdnum);
+  800881:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800884:	c1 e0 0c             	shl    $0xc,%eax
+  800887:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  80088d:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  800890:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800893:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800896:	89 04 24             	mov    %eax,(%esp)
+  800899:	e8 d7 fd ff ff       	call   800675 <fd2data>
+  80089e:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  8008a0:	89 3c 24             	mov    %edi,(%esp)
+  8008a3:	e8 cd fd ff ff       	call   800675 <fd2data>
+  8008a8:	83 c4 10             	add    $0x10,%esp
+  8008ab:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8008ae:	89 f3                	mov    %esi,%ebx
+  8008b0:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  8008b6:	89 c6                	mov    %eax,%esi
+  8008b8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8008bb:	89 cf                	mov    %ecx,%edi
+  8008bd:	eb 0c                	jmp    8008cb <dup+0x77>
+  8008bf:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8008c5:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8008cb:	39 fb                	cmp    %edi,%ebx
+  8008cd:	74 7b                	je     80094a <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  8008cf:	89 d8                	mov    %ebx,%eax
+  8008d1:	c1 e8 16             	shr    $0x16,%eax
+  8008d4:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8008db:	a8 01                	test   $0x1,%al
+  8008dd:	74 e0                	je     8008bf <dup+0x6b>
+  8008df:	89 d8                	mov    %ebx,%eax
+  8008e1:	c1 e8 0c             	shr    $0xc,%eax
+  8008e4:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8008eb:	f6 c2 01             	test   $0x1,%dl
+  8008ee:	74 cf                	je     8008bf <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  8008f0:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  8008f7:	83 ec 0c             	sub    $0xc,%esp
+  8008fa:	25 07 0e 00 00       	and    $0xe07,%eax
+  8008ff:	50                   	push   %eax
+  800900:	56                   	push   %esi
+  800901:	6a 00                	push   $0x0
+  800903:	53                   	push   %ebx
+  800904:	6a 00                	push   $0x0
+  800906:	e8 ee f8 ff ff       	call   8001f9 <sys_page_map>
+  80090b:	83 c4 20             	add    $0x20,%esp
+  80090e:	85 c0                	test   %eax,%eax
+  800910:	79 ad                	jns    8008bf <dup+0x6b>
+  800912:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800915:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  800917:	83 ec 08             	sub    $0x8,%esp
+  80091a:	ff 75 d4             	push   -0x2c(%ebp)
+  80091d:	6a 00                	push   $0x0
+  80091f:	e8 17 f9 ff ff       	call   80023b <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  800924:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  800927:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  80092d:	83 c4 10             	add    $0x10,%esp
+  800930:	39 df                	cmp    %ebx,%edi
+  800932:	74 4c                	je     800980 <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  800934:	83 ec 08             	sub    $0x8,%esp
+  800937:	57                   	push   %edi
+  800938:	6a 00                	push   $0x0
+  80093a:	e8 fc f8 ff ff       	call   80023b <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80093f:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  800945:	83 c4 10             	add    $0x10,%esp
+  800948:	eb e6                	jmp    800930 <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80094a:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80094d:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800950:	89 c8                	mov    %ecx,%eax
+  800952:	c1 e8 0c             	shr    $0xc,%eax
+  800955:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80095c:	83 ec 0c             	sub    $0xc,%esp
+  80095f:	25 07 0e 00 00       	and    $0xe07,%eax
+  800964:	50                   	push   %eax
+  800965:	ff 75 d4             	push   -0x2c(%ebp)
+  800968:	6a 00                	push   $0x0
+  80096a:	51                   	push   %ecx
+  80096b:	6a 00                	push   $0x0
+  80096d:	e8 87 f8 ff ff       	call   8001f9 <sys_page_map>
+  800972:	89 c6                	mov    %eax,%esi
+  800974:	83 c4 20             	add    $0x20,%esp
+  800977:	85 c0                	test   %eax,%eax
+  800979:	78 9c                	js     800917 <dup+0xc3>
+  return newfdnum;
+  80097b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80097e:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  800980:	89 f0                	mov    %esi,%eax
+  800982:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800985:	5b                   	pop    %ebx
+  800986:	5e                   	pop    %esi
+  800987:	5f                   	pop    %edi
+  800988:	5d                   	pop    %ebp
+  800989:	c3                   	ret
+
+0080098a <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80098a:	55                   	push   %ebp
+  80098b:	89 e5                	mov    %esp,%ebp
+  80098d:	56                   	push   %esi
+  80098e:	53                   	push   %ebx
+  80098f:	83 ec 18             	sub    $0x18,%esp
+  800992:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  800995:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800998:	50                   	push   %eax
+  800999:	56                   	push   %esi
+  80099a:	e8 40 fd ff ff       	call   8006df <fd_lookup>
+  80099f:	83 c4 10             	add    $0x10,%esp
+  8009a2:	85 c0                	test   %eax,%eax
+  8009a4:	78 3c                	js     8009e2 <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8009a6:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8009a9:	83 ec 08             	sub    $0x8,%esp
+  8009ac:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8009af:	50                   	push   %eax
+  8009b0:	ff 33                	push   (%ebx)
+  8009b2:	e8 78 fd ff ff       	call   80072f <dev_lookup>
+  8009b7:	83 c4 10             	add    $0x10,%esp
+  8009ba:	85 c0                	test   %eax,%eax
+  8009bc:	78 24                	js     8009e2 <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8009be:	8b 43 08             	mov    0x8(%ebx),%eax
+  8009c1:	83 e0 03             	and    $0x3,%eax
+  8009c4:	83 f8 01             	cmp    $0x1,%eax
+  8009c7:	74 20                	je     8009e9 <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  8009c9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009cc:	8b 40 08             	mov    0x8(%eax),%eax
+  8009cf:	85 c0                	test   %eax,%eax
+  8009d1:	74 37                	je     800a0a <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  8009d3:	83 ec 04             	sub    $0x4,%esp
+  8009d6:	ff 75 10             	push   0x10(%ebp)
+  8009d9:	ff 75 0c             	push   0xc(%ebp)
+  8009dc:	53                   	push   %ebx
+  8009dd:	ff d0                	call   *%eax
+  8009df:	83 c4 10             	add    $0x10,%esp
+}
+  8009e2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8009e5:	5b                   	pop    %ebx
+  8009e6:	5e                   	pop    %esi
+  8009e7:	5d                   	pop    %ebp
+  8009e8:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8009e9:	a1 44 57 80 00       	mov    0x805744,%eax
+  8009ee:	8b 40 48             	mov    0x48(%eax),%eax
+  8009f1:	83 ec 04             	sub    $0x4,%esp
+  8009f4:	56                   	push   %esi
+  8009f5:	50                   	push   %eax
+  8009f6:	68 dd 2e 80 00       	push   $0x802edd
+  8009fb:	e8 51 17 00 00       	call   802151 <cprintf>
+    return -E_INVAL;
+  800a00:	83 c4 10             	add    $0x10,%esp
+  800a03:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a08:	eb d8                	jmp    8009e2 <read+0x58>
+    return -E_NOT_SUPP;
+  800a0a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800a0f:	eb d1                	jmp    8009e2 <read+0x58>
+
+00800a11 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  800a11:	55                   	push   %ebp
+  800a12:	89 e5                	mov    %esp,%ebp
+  800a14:	57                   	push   %edi
+  800a15:	56                   	push   %esi
+  800a16:	53                   	push   %ebx
+  800a17:	83 ec 0c             	sub    $0xc,%esp
+  800a1a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a1d:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  800a20:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800a25:	eb 02                	jmp    800a29 <readn+0x18>
+  800a27:	01 c3                	add    %eax,%ebx
+  800a29:	39 f3                	cmp    %esi,%ebx
+  800a2b:	73 21                	jae    800a4e <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  800a2d:	83 ec 04             	sub    $0x4,%esp
+  800a30:	89 f0                	mov    %esi,%eax
+  800a32:	29 d8                	sub    %ebx,%eax
+  800a34:	50                   	push   %eax
+  800a35:	89 d8                	mov    %ebx,%eax
+  800a37:	03 45 0c             	add    0xc(%ebp),%eax
+  800a3a:	50                   	push   %eax
+  800a3b:	57                   	push   %edi
+  800a3c:	e8 49 ff ff ff       	call   80098a <read>
+    if (m < 0)
+  800a41:	83 c4 10             	add    $0x10,%esp
+  800a44:	85 c0                	test   %eax,%eax
+  800a46:	78 04                	js     800a4c <readn+0x3b>
+      return m;
+    if (m == 0)
+  800a48:	75 dd                	jne    800a27 <readn+0x16>
+  800a4a:	eb 02                	jmp    800a4e <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  800a4c:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  800a4e:	89 d8                	mov    %ebx,%eax
+  800a50:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a53:	5b                   	pop    %ebx
+  800a54:	5e                   	pop    %esi
+  800a55:	5f                   	pop    %edi
+  800a56:	5d                   	pop    %ebp
+  800a57:	c3                   	ret
+
+00800a58 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  800a58:	55                   	push   %ebp
+  800a59:	89 e5                	mov    %esp,%ebp
+  800a5b:	56                   	push   %esi
+  800a5c:	53                   	push   %ebx
+  800a5d:	83 ec 18             	sub    $0x18,%esp
+  800a60:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  800a63:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800a66:	50                   	push   %eax
+  800a67:	53                   	push   %ebx
+  800a68:	e8 72 fc ff ff       	call   8006df <fd_lookup>
+  800a6d:	83 c4 10             	add    $0x10,%esp
+  800a70:	85 c0                	test   %eax,%eax
+  800a72:	78 37                	js     800aab <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800a74:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800a77:	83 ec 08             	sub    $0x8,%esp
+  800a7a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a7d:	50                   	push   %eax
+  800a7e:	ff 36                	push   (%esi)
+  800a80:	e8 aa fc ff ff       	call   80072f <dev_lookup>
+  800a85:	83 c4 10             	add    $0x10,%esp
+  800a88:	85 c0                	test   %eax,%eax
+  800a8a:	78 1f                	js     800aab <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800a8c:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800a90:	74 20                	je     800ab2 <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  800a92:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a95:	8b 40 0c             	mov    0xc(%eax),%eax
+  800a98:	85 c0                	test   %eax,%eax
+  800a9a:	74 37                	je     800ad3 <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  800a9c:	83 ec 04             	sub    $0x4,%esp
+  800a9f:	ff 75 10             	push   0x10(%ebp)
+  800aa2:	ff 75 0c             	push   0xc(%ebp)
+  800aa5:	56                   	push   %esi
+  800aa6:	ff d0                	call   *%eax
+  800aa8:	83 c4 10             	add    $0x10,%esp
+}
+  800aab:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800aae:	5b                   	pop    %ebx
+  800aaf:	5e                   	pop    %esi
+  800ab0:	5d                   	pop    %ebp
+  800ab1:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800ab2:	a1 44 57 80 00       	mov    0x805744,%eax
+  800ab7:	8b 40 48             	mov    0x48(%eax),%eax
+  800aba:	83 ec 04             	sub    $0x4,%esp
+  800abd:	53                   	push   %ebx
+  800abe:	50                   	push   %eax
+  800abf:	68 f9 2e 80 00       	push   $0x802ef9
+  800ac4:	e8 88 16 00 00       	call   802151 <cprintf>
+    return -E_INVAL;
+  800ac9:	83 c4 10             	add    $0x10,%esp
+  800acc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ad1:	eb d8                	jmp    800aab <write+0x53>
+    return -E_NOT_SUPP;
+  800ad3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800ad8:	eb d1                	jmp    800aab <write+0x53>
+
+00800ada <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  800ada:	55                   	push   %ebp
+  800adb:	89 e5                	mov    %esp,%ebp
+  800add:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800ae0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800ae3:	50                   	push   %eax
+  800ae4:	ff 75 08             	push   0x8(%ebp)
+  800ae7:	e8 f3 fb ff ff       	call   8006df <fd_lookup>
+  800aec:	83 c4 10             	add    $0x10,%esp
+  800aef:	85 c0                	test   %eax,%eax
+  800af1:	78 0e                	js     800b01 <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  800af3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800af6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800af9:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  800afc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b01:	c9                   	leave
+  800b02:	c3                   	ret
+
+00800b03 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800b03:	55                   	push   %ebp
+  800b04:	89 e5                	mov    %esp,%ebp
+  800b06:	56                   	push   %esi
+  800b07:	53                   	push   %ebx
+  800b08:	83 ec 18             	sub    $0x18,%esp
+  800b0b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  800b0e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800b11:	50                   	push   %eax
+  800b12:	53                   	push   %ebx
+  800b13:	e8 c7 fb ff ff       	call   8006df <fd_lookup>
+  800b18:	83 c4 10             	add    $0x10,%esp
+  800b1b:	85 c0                	test   %eax,%eax
+  800b1d:	78 34                	js     800b53 <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800b1f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800b22:	83 ec 08             	sub    $0x8,%esp
+  800b25:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b28:	50                   	push   %eax
+  800b29:	ff 36                	push   (%esi)
+  800b2b:	e8 ff fb ff ff       	call   80072f <dev_lookup>
+  800b30:	83 c4 10             	add    $0x10,%esp
+  800b33:	85 c0                	test   %eax,%eax
+  800b35:	78 1c                	js     800b53 <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800b37:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800b3b:	74 1d                	je     800b5a <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  800b3d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b40:	8b 40 18             	mov    0x18(%eax),%eax
+  800b43:	85 c0                	test   %eax,%eax
+  800b45:	74 34                	je     800b7b <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  800b47:	83 ec 08             	sub    $0x8,%esp
+  800b4a:	ff 75 0c             	push   0xc(%ebp)
+  800b4d:	56                   	push   %esi
+  800b4e:	ff d0                	call   *%eax
+  800b50:	83 c4 10             	add    $0x10,%esp
+}
+  800b53:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b56:	5b                   	pop    %ebx
+  800b57:	5e                   	pop    %esi
+  800b58:	5d                   	pop    %ebp
+  800b59:	c3                   	ret
+            thisenv->env_id, fdnum);
+  800b5a:	a1 44 57 80 00       	mov    0x805744,%eax
+  800b5f:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800b62:	83 ec 04             	sub    $0x4,%esp
+  800b65:	53                   	push   %ebx
+  800b66:	50                   	push   %eax
+  800b67:	68 bc 2e 80 00       	push   $0x802ebc
+  800b6c:	e8 e0 15 00 00       	call   802151 <cprintf>
+    return -E_INVAL;
+  800b71:	83 c4 10             	add    $0x10,%esp
+  800b74:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b79:	eb d8                	jmp    800b53 <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  800b7b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800b80:	eb d1                	jmp    800b53 <ftruncate+0x50>
+
+00800b82 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800b82:	55                   	push   %ebp
+  800b83:	89 e5                	mov    %esp,%ebp
+  800b85:	56                   	push   %esi
+  800b86:	53                   	push   %ebx
+  800b87:	83 ec 18             	sub    $0x18,%esp
+  800b8a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  800b8d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800b90:	50                   	push   %eax
+  800b91:	ff 75 08             	push   0x8(%ebp)
+  800b94:	e8 46 fb ff ff       	call   8006df <fd_lookup>
+  800b99:	83 c4 10             	add    $0x10,%esp
+  800b9c:	85 c0                	test   %eax,%eax
+  800b9e:	78 49                	js     800be9 <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800ba0:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800ba3:	83 ec 08             	sub    $0x8,%esp
+  800ba6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800ba9:	50                   	push   %eax
+  800baa:	ff 36                	push   (%esi)
+  800bac:	e8 7e fb ff ff       	call   80072f <dev_lookup>
+  800bb1:	83 c4 10             	add    $0x10,%esp
+  800bb4:	85 c0                	test   %eax,%eax
+  800bb6:	78 31                	js     800be9 <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  800bb8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800bbb:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800bbf:	74 2f                	je     800bf0 <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  800bc1:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  800bc4:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800bcb:	00 00 00 
+  stat->st_isdir = 0;
+  800bce:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800bd5:	00 00 00 
+  stat->st_dev = dev;
+  800bd8:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  800bde:	83 ec 08             	sub    $0x8,%esp
+  800be1:	53                   	push   %ebx
+  800be2:	56                   	push   %esi
+  800be3:	ff 50 14             	call   *0x14(%eax)
+  800be6:	83 c4 10             	add    $0x10,%esp
+}
+  800be9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800bec:	5b                   	pop    %ebx
+  800bed:	5e                   	pop    %esi
+  800bee:	5d                   	pop    %ebp
+  800bef:	c3                   	ret
+    return -E_NOT_SUPP;
+  800bf0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800bf5:	eb f2                	jmp    800be9 <fstat+0x67>
+
+00800bf7 <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  800bf7:	55                   	push   %ebp
+  800bf8:	89 e5                	mov    %esp,%ebp
+  800bfa:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  800bfd:	ff 75 0c             	push   0xc(%ebp)
+  800c00:	ff 75 08             	push   0x8(%ebp)
+  800c03:	e8 58 07 00 00       	call   801360 <file_stat>
+}
+  800c08:	c9                   	leave
+  800c09:	c3                   	ret
+
+00800c0a <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  800c0a:	55                   	push   %ebp
+  800c0b:	89 e5                	mov    %esp,%ebp
+  800c0d:	57                   	push   %edi
+  800c0e:	56                   	push   %esi
+  800c0f:	53                   	push   %ebx
+  800c10:	83 ec 1c             	sub    $0x1c,%esp
+  800c13:	89 c7                	mov    %eax,%edi
+  800c15:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  800c18:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  800c1b:	e9 a2 00 00 00       	jmp    800cc2 <fsipc_send+0xb8>
+  nfsenvs = 0;
+  800c20:	c7 05 00 50 80 00 00 	movl   $0x0,0x805000
+  800c27:	00 00 00 
+  800c2a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c2f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  800c34:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  800c39:	be 01 00 00 00       	mov    $0x1,%esi
+  800c3e:	eb 0f                	jmp    800c4f <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  800c40:	83 c0 01             	add    $0x1,%eax
+  800c43:	3d 00 04 00 00       	cmp    $0x400,%eax
+  800c48:	74 49                	je     800c93 <fsipc_send+0x89>
+  800c4a:	83 f9 07             	cmp    $0x7,%ecx
+  800c4d:	7f 50                	jg     800c9f <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  800c4f:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  800c52:	c1 e2 04             	shl    $0x4,%edx
+  800c55:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800c5b:	8b 52 50             	mov    0x50(%edx),%edx
+  800c5e:	83 fa 01             	cmp    $0x1,%edx
+  800c61:	75 dd                	jne    800c40 <fsipc_send+0x36>
+  800c63:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  800c66:	c1 e2 04             	shl    $0x4,%edx
+  800c69:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800c6f:	8b 52 54             	mov    0x54(%edx),%edx
+  800c72:	85 d2                	test   %edx,%edx
+  800c74:	74 ca                	je     800c40 <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  800c76:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  800c79:	c1 e2 04             	shl    $0x4,%edx
+  800c7c:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800c82:	8b 52 48             	mov    0x48(%edx),%edx
+  800c85:	89 14 8d 20 50 80 00 	mov    %edx,0x805020(,%ecx,4)
+  800c8c:	8d 49 01             	lea    0x1(%ecx),%ecx
+  800c8f:	89 f3                	mov    %esi,%ebx
+  800c91:	eb ad                	jmp    800c40 <fsipc_send+0x36>
+  800c93:	84 db                	test   %bl,%bl
+  800c95:	74 38                	je     800ccf <fsipc_send+0xc5>
+  800c97:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  800c9d:	eb 30                	jmp    800ccf <fsipc_send+0xc5>
+  800c9f:	84 db                	test   %bl,%bl
+  800ca1:	74 2c                	je     800ccf <fsipc_send+0xc5>
+  800ca3:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  800ca9:	eb 24                	jmp    800ccf <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  800cab:	50                   	push   %eax
+  800cac:	68 28 2f 80 00       	push   $0x802f28
+  800cb1:	6a 34                	push   $0x34
+  800cb3:	68 32 2f 80 00       	push   $0x802f32
+  800cb8:	e8 b9 13 00 00       	call   802076 <_panic>
+    }
+    sys_yield();
+  800cbd:	e8 92 f4 ff ff       	call   800154 <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  800cc2:	83 3d 00 50 80 00 03 	cmpl   $0x3,0x805000
+  800cc9:	0f 8e 51 ff ff ff    	jle    800c20 <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  800ccf:	a1 44 57 80 00       	mov    0x805744,%eax
+  800cd4:	8b 70 48             	mov    0x48(%eax),%esi
+  800cd7:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  800cdd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ce2:	8b 0d 00 50 80 00    	mov    0x805000,%ecx
+  800ce8:	39 d9                	cmp    %ebx,%ecx
+  800cea:	7e d1                	jle    800cbd <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  800cec:	83 ec 0c             	sub    $0xc,%esp
+  800cef:	ff 75 e0             	push   -0x20(%ebp)
+  800cf2:	6a 07                	push   $0x7
+  800cf4:	ff 75 e4             	push   -0x1c(%ebp)
+  800cf7:	57                   	push   %edi
+  800cf8:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  800cfb:	99                   	cltd
+  800cfc:	f7 f9                	idiv   %ecx
+  800cfe:	ff 34 95 20 50 80 00 	push   0x805020(,%edx,4)
+  800d05:	e8 63 f7 ff ff       	call   80046d <sys_ipc_try_send>
+      if (r == 0)
+  800d0a:	83 c4 20             	add    $0x20,%esp
+  800d0d:	85 c0                	test   %eax,%eax
+  800d0f:	74 0a                	je     800d1b <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  800d11:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  800d14:	75 95                	jne    800cab <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  800d16:	83 c3 01             	add    $0x1,%ebx
+  800d19:	eb c7                	jmp    800ce2 <fsipc_send+0xd8>
+  }
+}
+  800d1b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d1e:	5b                   	pop    %ebx
+  800d1f:	5e                   	pop    %esi
+  800d20:	5f                   	pop    %edi
+  800d21:	5d                   	pop    %ebp
+  800d22:	c3                   	ret
+
+00800d23 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  800d23:	55                   	push   %ebp
+  800d24:	89 e5                	mov    %esp,%ebp
+  800d26:	53                   	push   %ebx
+  800d27:	83 ec 14             	sub    $0x14,%esp
+  800d2a:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  800d2c:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  800d33:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800d38:	ba 00 60 80 00       	mov    $0x806000,%edx
+  800d3d:	e8 c8 fe ff ff       	call   800c0a <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  800d42:	6a 00                	push   $0x0
+  800d44:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800d47:	50                   	push   %eax
+  800d48:	53                   	push   %ebx
+  800d49:	6a 00                	push   $0x0
+  800d4b:	e8 1f 1d 00 00       	call   802a6f <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  800d50:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d53:	c9                   	leave
+  800d54:	c3                   	ret
+
+00800d55 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  800d55:	55                   	push   %ebp
+  800d56:	89 e5                	mov    %esp,%ebp
+  800d58:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800d5b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d5e:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d61:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.set_size.req_size = newsize;
+  800d66:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d69:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  800d6e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d73:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d78:	e8 a6 ff ff ff       	call   800d23 <fsipc>
+}
+  800d7d:	c9                   	leave
+  800d7e:	c3                   	ret
+
+00800d7f <devfile_flush>:
+{
+  800d7f:	55                   	push   %ebp
+  800d80:	89 e5                	mov    %esp,%ebp
+  800d82:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800d85:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d88:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d8b:	a3 00 60 80 00       	mov    %eax,0x806000
+  return fsipc(FSREQ_FLUSH, NULL);
+  800d90:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d95:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d9a:	e8 84 ff ff ff       	call   800d23 <fsipc>
+}
+  800d9f:	c9                   	leave
+  800da0:	c3                   	ret
+
+00800da1 <devfile_stat>:
+{
+  800da1:	55                   	push   %ebp
+  800da2:	89 e5                	mov    %esp,%ebp
+  800da4:	53                   	push   %ebx
+  800da5:	83 ec 04             	sub    $0x4,%esp
+  800da8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800dab:	8b 45 08             	mov    0x8(%ebp),%eax
+  800dae:	8b 40 0c             	mov    0xc(%eax),%eax
+  800db1:	a3 00 60 80 00       	mov    %eax,0x806000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  800db6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dbb:	b8 05 00 00 00       	mov    $0x5,%eax
+  800dc0:	e8 5e ff ff ff       	call   800d23 <fsipc>
+  800dc5:	85 c0                	test   %eax,%eax
+  800dc7:	78 2c                	js     800df5 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800dc9:	83 ec 08             	sub    $0x8,%esp
+  800dcc:	68 00 60 80 00       	push   $0x806000
+  800dd1:	53                   	push   %ebx
+  800dd2:	e8 68 19 00 00       	call   80273f <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  800dd7:	a1 80 60 80 00       	mov    0x806080,%eax
+  800ddc:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800de2:	a1 84 60 80 00       	mov    0x806084,%eax
+  800de7:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  800ded:	83 c4 10             	add    $0x10,%esp
+  800df0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800df5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800df8:	c9                   	leave
+  800df9:	c3                   	ret
+
+00800dfa <fsv_alloc>:
+{
+  800dfa:	55                   	push   %ebp
+  800dfb:	89 e5                	mov    %esp,%ebp
+  800dfd:	56                   	push   %esi
+  800dfe:	53                   	push   %ebx
+  800dff:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  800e01:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e06:	eb 22                	jmp    800e2a <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  800e08:	83 ec 04             	sub    $0x4,%esp
+  800e0b:	6a 00                	push   $0x0
+  800e0d:	6a 00                	push   $0x0
+  800e0f:	6a 07                	push   $0x7
+  800e11:	50                   	push   %eax
+  800e12:	6a 00                	push   $0x0
+  800e14:	6a 04                	push   $0x4
+  800e16:	68 40 50 80 00       	push   $0x805040
+  800e1b:	e8 e9 f7 ff ff       	call   800609 <sysbatch_add>
+  800e20:	83 c4 20             	add    $0x20,%esp
+  800e23:	85 c0                	test   %eax,%eax
+  800e25:	78 48                	js     800e6f <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  800e27:	83 c3 01             	add    $0x1,%ebx
+  800e2a:	39 f3                	cmp    %esi,%ebx
+  800e2c:	74 31                	je     800e5f <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  800e2e:	89 d8                	mov    %ebx,%eax
+  800e30:	c1 e0 0c             	shl    $0xc,%eax
+  800e33:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  800e38:	89 c2                	mov    %eax,%edx
+  800e3a:	c1 ea 16             	shr    $0x16,%edx
+  800e3d:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800e44:	f6 c2 01             	test   $0x1,%dl
+  800e47:	74 bf                	je     800e08 <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  800e49:	89 c2                	mov    %eax,%edx
+  800e4b:	c1 ea 0c             	shr    $0xc,%edx
+  800e4e:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800e55:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  800e58:	83 fa 03             	cmp    $0x3,%edx
+  800e5b:	75 ab                	jne    800e08 <fsv_alloc+0xe>
+  800e5d:	eb c8                	jmp    800e27 <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  800e5f:	83 ec 0c             	sub    $0xc,%esp
+  800e62:	68 40 50 80 00       	push   $0x805040
+  800e67:	e8 4d f7 ff ff       	call   8005b9 <sysbatch_flush>
+  800e6c:	83 c4 10             	add    $0x10,%esp
+}
+  800e6f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e72:	5b                   	pop    %ebx
+  800e73:	5e                   	pop    %esi
+  800e74:	5d                   	pop    %ebp
+  800e75:	c3                   	ret
+
+00800e76 <devfile_read>:
+{
+  800e76:	55                   	push   %ebp
+  800e77:	89 e5                	mov    %esp,%ebp
+  800e79:	57                   	push   %edi
+  800e7a:	56                   	push   %esi
+  800e7b:	53                   	push   %ebx
+  800e7c:	83 ec 3c             	sub    $0x3c,%esp
+  800e7f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  800e82:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  800e88:	77 57                	ja     800ee1 <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800e8a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e8d:	8b 40 0c             	mov    0xc(%eax),%eax
+  800e90:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read.req_n = n;
+  800e95:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  800e9b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ea0:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ea5:	e8 79 fe ff ff       	call   800d23 <fsipc>
+  800eaa:	89 c6                	mov    %eax,%esi
+  800eac:	85 c0                	test   %eax,%eax
+  800eae:	78 27                	js     800ed7 <devfile_read+0x61>
+  assert(r <= n);
+  800eb0:	39 c3                	cmp    %eax,%ebx
+  800eb2:	0f 82 0e 02 00 00    	jb     8010c6 <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  800eb8:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800ebd:	0f 8f 1c 02 00 00    	jg     8010df <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  800ec3:	83 ec 04             	sub    $0x4,%esp
+  800ec6:	50                   	push   %eax
+  800ec7:	68 00 60 80 00       	push   $0x806000
+  800ecc:	ff 75 0c             	push   0xc(%ebp)
+  800ecf:	e8 f1 19 00 00       	call   8028c5 <memmove>
+  return r;
+  800ed4:	83 c4 10             	add    $0x10,%esp
+}
+  800ed7:	89 f0                	mov    %esi,%eax
+  800ed9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800edc:	5b                   	pop    %ebx
+  800edd:	5e                   	pop    %esi
+  800ede:	5f                   	pop    %edi
+  800edf:	5d                   	pop    %ebp
+  800ee0:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  800ee1:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ee6:	e8 0f ff ff ff       	call   800dfa <fsv_alloc>
+  800eeb:	89 c6                	mov    %eax,%esi
+  800eed:	85 c0                	test   %eax,%eax
+  800eef:	78 e6                	js     800ed7 <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  800ef1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ef4:	8b 40 0c             	mov    0xc(%eax),%eax
+  800ef7:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  800efc:	8b 45 08             	mov    0x8(%ebp),%eax
+  800eff:	8b 40 04             	mov    0x4(%eax),%eax
+  800f02:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  800f07:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  800f0d:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  800f14:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800f19:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  800f1e:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f23:	e8 e2 fc ff ff       	call   800c0a <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  800f28:	6a 00                	push   $0x0
+  800f2a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800f2d:	50                   	push   %eax
+  800f2e:	68 00 10 c0 9f       	push   $0x9fc01000
+  800f33:	6a 00                	push   $0x0
+  800f35:	e8 35 1b 00 00       	call   802a6f <ipc_recv_pages>
+  800f3a:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  800f3c:	83 c4 10             	add    $0x10,%esp
+  800f3f:	85 c0                	test   %eax,%eax
+  800f41:	7e 94                	jle    800ed7 <devfile_read+0x61>
+  assert(r <= n);
+  800f43:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800f46:	39 c3                	cmp    %eax,%ebx
+  800f48:	72 2e                	jb     800f78 <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  800f4a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f4d:	8b 40 04             	mov    0x4(%eax),%eax
+  800f50:	25 ff 0f 00 00       	and    $0xfff,%eax
+  800f55:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  800f58:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800f5b:	c1 e2 0c             	shl    $0xc,%edx
+  800f5e:	39 ca                	cmp    %ecx,%edx
+  800f60:	72 2f                	jb     800f91 <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  800f62:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  800f67:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  800f6a:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  800f6e:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  800f73:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  800f76:	eb 52                	jmp    800fca <devfile_read+0x154>
+  assert(r <= n);
+  800f78:	68 3d 2f 80 00       	push   $0x802f3d
+  800f7d:	68 44 2f 80 00       	push   $0x802f44
+  800f82:	68 49 01 00 00       	push   $0x149
+  800f87:	68 32 2f 80 00       	push   $0x802f32
+  800f8c:	e8 e5 10 00 00       	call   802076 <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  800f91:	68 68 2f 80 00       	push   $0x802f68
+  800f96:	68 44 2f 80 00       	push   $0x802f44
+  800f9b:	68 4a 01 00 00       	push   $0x14a
+  800fa0:	68 32 2f 80 00       	push   $0x802f32
+  800fa5:	e8 cc 10 00 00       	call   802076 <_panic>
+      memmove(dst + done, src + done, m);
+  800faa:	83 ec 04             	sub    $0x4,%esp
+  800fad:	53                   	push   %ebx
+  800fae:	56                   	push   %esi
+  800faf:	89 f8                	mov    %edi,%eax
+  800fb1:	03 45 0c             	add    0xc(%ebp),%eax
+  800fb4:	50                   	push   %eax
+  800fb5:	e8 0b 19 00 00       	call   8028c5 <memmove>
+  800fba:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  800fbd:	01 df                	add    %ebx,%edi
+  800fbf:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800fc2:	39 c7                	cmp    %eax,%edi
+  800fc4:	0f 83 c0 00 00 00    	jae    80108a <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  800fca:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800fcd:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  800fd0:	89 f0                	mov    %esi,%eax
+  800fd2:	25 ff 0f 00 00       	and    $0xfff,%eax
+  800fd7:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  800fdc:	29 c3                	sub    %eax,%ebx
+  800fde:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800fe1:	29 f8                	sub    %edi,%eax
+  800fe3:	39 c3                	cmp    %eax,%ebx
+  800fe5:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  800fe8:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  800fee:	75 ba                	jne    800faa <devfile_read+0x134>
+  800ff0:	89 f9                	mov    %edi,%ecx
+  800ff2:	03 4d 0c             	add    0xc(%ebp),%ecx
+  800ff5:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  800ff8:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  800ffe:	75 aa                	jne    800faa <devfile_read+0x134>
+  801000:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  801006:	77 a2                	ja     800faa <devfile_read+0x134>
+  801008:	89 c8                	mov    %ecx,%eax
+  80100a:	c1 e8 16             	shr    $0x16,%eax
+  80100d:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801014:	a8 01                	test   $0x1,%al
+  801016:	74 92                	je     800faa <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  801018:	89 c8                	mov    %ecx,%eax
+  80101a:	c1 e8 0c             	shr    $0xc,%eax
+  80101d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  801024:	a8 01                	test   $0x1,%al
+  801026:	74 82                	je     800faa <devfile_read+0x134>
+  801028:	a9 02 08 00 00       	test   $0x802,%eax
+  80102d:	0f 84 77 ff ff ff    	je     800faa <devfile_read+0x134>
+  801033:	f6 c4 04             	test   $0x4,%ah
+  801036:	0f 85 6e ff ff ff    	jne    800faa <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  80103c:	a1 44 57 80 00       	mov    0x805744,%eax
+  801041:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  801045:	84 c0                	test   %al,%al
+  801047:	75 17                	jne    801060 <devfile_read+0x1ea>
+  801049:	83 ec 08             	sub    $0x8,%esp
+  80104c:	6a 01                	push   $0x1
+  80104e:	6a 00                	push   $0x0
+  801050:	e8 1e f1 ff ff       	call   800173 <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  801055:	83 c4 10             	add    $0x10,%esp
+  801058:	85 c0                	test   %eax,%eax
+  80105a:	0f 85 4a ff ff ff    	jne    800faa <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  801060:	83 ec 04             	sub    $0x4,%esp
+  801063:	68 05 08 00 00       	push   $0x805
+  801068:	ff 75 cc             	push   -0x34(%ebp)
+  80106b:	6a 00                	push   $0x0
+  80106d:	56                   	push   %esi
+  80106e:	6a 00                	push   $0x0
+  801070:	6a 05                	push   $0x5
+  801072:	68 40 50 80 00       	push   $0x805040
+  801077:	e8 8d f5 ff ff       	call   800609 <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  80107c:	c1 e8 1f             	shr    $0x1f,%eax
+  80107f:	08 45 cb             	or     %al,-0x35(%ebp)
+  801082:	83 c4 20             	add    $0x20,%esp
+  801085:	e9 33 ff ff ff       	jmp    800fbd <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  80108a:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  80108d:	83 ec 0c             	sub    $0xc,%esp
+  801090:	68 40 50 80 00       	push   $0x805040
+  801095:	e8 1f f5 ff ff       	call   8005b9 <sysbatch_flush>
+  80109a:	83 c4 10             	add    $0x10,%esp
+  80109d:	85 c0                	test   %eax,%eax
+  80109f:	78 06                	js     8010a7 <devfile_read+0x231>
+  8010a1:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  8010a5:	74 14                	je     8010bb <devfile_read+0x245>
+    memmove(dst, src, r);
+  8010a7:	83 ec 04             	sub    $0x4,%esp
+  8010aa:	ff 75 d4             	push   -0x2c(%ebp)
+  8010ad:	ff 75 d0             	push   -0x30(%ebp)
+  8010b0:	ff 75 0c             	push   0xc(%ebp)
+  8010b3:	e8 0d 18 00 00       	call   8028c5 <memmove>
+  8010b8:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  8010bb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010be:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  8010c1:	e9 11 fe ff ff       	jmp    800ed7 <devfile_read+0x61>
+  assert(r <= n);
+  8010c6:	68 3d 2f 80 00       	push   $0x802f3d
+  8010cb:	68 44 2f 80 00       	push   $0x802f44
+  8010d0:	68 1c 01 00 00       	push   $0x11c
+  8010d5:	68 32 2f 80 00       	push   $0x802f32
+  8010da:	e8 97 0f 00 00       	call   802076 <_panic>
+  assert(r <= PGSIZE);
+  8010df:	68 59 2f 80 00       	push   $0x802f59
+  8010e4:	68 44 2f 80 00       	push   $0x802f44
+  8010e9:	68 1d 01 00 00       	push   $0x11d
+  8010ee:	68 32 2f 80 00       	push   $0x802f32
+  8010f3:	e8 7e 0f 00 00       	call   802076 <_panic>
+
+008010f8 <devfile_write>:
+{
+  8010f8:	55                   	push   %ebp
+  8010f9:	89 e5                	mov    %esp,%ebp
+  8010fb:	57                   	push   %edi
+  8010fc:	56                   	push   %esi
+  8010fd:	53                   	push   %ebx
+  8010fe:	83 ec 1c             	sub    $0x1c,%esp
+  801101:	8b 75 08             	mov    0x8(%ebp),%esi
+  801104:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  801107:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  80110c:	77 39                	ja     801147 <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80110e:	8b 56 0c             	mov    0xc(%esi),%edx
+  801111:	89 15 00 60 80 00    	mov    %edx,0x806000
+  fsipcbuf.write.req_n = n;
+  801117:	a3 04 60 80 00       	mov    %eax,0x806004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  80111c:	83 ec 04             	sub    $0x4,%esp
+  80111f:	50                   	push   %eax
+  801120:	ff 75 0c             	push   0xc(%ebp)
+  801123:	68 08 60 80 00       	push   $0x806008
+  801128:	e8 98 17 00 00       	call   8028c5 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  80112d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801132:	b8 04 00 00 00       	mov    $0x4,%eax
+  801137:	e8 e7 fb ff ff       	call   800d23 <fsipc>
+  80113c:	83 c4 10             	add    $0x10,%esp
+}
+  80113f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801142:	5b                   	pop    %ebx
+  801143:	5e                   	pop    %esi
+  801144:	5f                   	pop    %edi
+  801145:	5d                   	pop    %ebp
+  801146:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  801147:	ba 00 00 10 00       	mov    $0x100000,%edx
+  80114c:	39 d0                	cmp    %edx,%eax
+  80114e:	89 d3                	mov    %edx,%ebx
+  801150:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  801153:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  801159:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  80115c:	83 c7 01             	add    $0x1,%edi
+  80115f:	89 f8                	mov    %edi,%eax
+  801161:	e8 94 fc ff ff       	call   800dfa <fsv_alloc>
+  801166:	85 c0                	test   %eax,%eax
+  801168:	78 d5                	js     80113f <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  80116a:	83 ec 04             	sub    $0x4,%esp
+  80116d:	53                   	push   %ebx
+  80116e:	ff 75 0c             	push   0xc(%ebp)
+  801171:	68 00 10 c0 9f       	push   $0x9fc01000
+  801176:	e8 4a 17 00 00       	call   8028c5 <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  80117b:	8b 46 0c             	mov    0xc(%esi),%eax
+  80117e:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  801183:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  801189:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801190:	89 f9                	mov    %edi,%ecx
+  801192:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801197:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80119c:	e8 69 fa ff ff       	call   800c0a <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  8011a1:	6a 00                	push   $0x0
+  8011a3:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8011a6:	50                   	push   %eax
+  8011a7:	6a 00                	push   $0x0
+  8011a9:	6a 00                	push   $0x0
+  8011ab:	e8 bf 18 00 00       	call   802a6f <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  8011b0:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  8011b3:	eb 8a                	jmp    80113f <devfile_write+0x47>
+
+008011b5 <open>:
+{
+  8011b5:	55                   	push   %ebp
+  8011b6:	89 e5                	mov    %esp,%ebp
+  8011b8:	56                   	push   %esi
+  8011b9:	53                   	push   %ebx
+  8011ba:	83 ec 1c             	sub    $0x1c,%esp
+  8011bd:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  8011c0:	56                   	push   %esi
+  8011c1:	e8 3e 15 00 00       	call   802704 <strlen>
+  8011c6:	83 c4 10             	add    $0x10,%esp
+  8011c9:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8011ce:	7f 6c                	jg     80123c <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  8011d0:	83 ec 0c             	sub    $0xc,%esp
+  8011d3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8011d6:	50                   	push   %eax
+  8011d7:	e8 ad f4 ff ff       	call   800689 <fd_alloc>
+  8011dc:	89 c3                	mov    %eax,%ebx
+  8011de:	83 c4 10             	add    $0x10,%esp
+  8011e1:	85 c0                	test   %eax,%eax
+  8011e3:	78 3c                	js     801221 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  8011e5:	83 ec 08             	sub    $0x8,%esp
+  8011e8:	56                   	push   %esi
+  8011e9:	68 00 60 80 00       	push   $0x806000
+  8011ee:	e8 4c 15 00 00       	call   80273f <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  8011f3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8011f6:	a3 00 64 80 00       	mov    %eax,0x806400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8011fb:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8011fe:	b8 01 00 00 00       	mov    $0x1,%eax
+  801203:	e8 1b fb ff ff       	call   800d23 <fsipc>
+  801208:	89 c3                	mov    %eax,%ebx
+  80120a:	83 c4 10             	add    $0x10,%esp
+  80120d:	85 c0                	test   %eax,%eax
+  80120f:	78 19                	js     80122a <open+0x75>
+  return fd2num(fd);
+  801211:	83 ec 0c             	sub    $0xc,%esp
+  801214:	ff 75 f4             	push   -0xc(%ebp)
+  801217:	e8 49 f4 ff ff       	call   800665 <fd2num>
+  80121c:	89 c3                	mov    %eax,%ebx
+  80121e:	83 c4 10             	add    $0x10,%esp
+}
+  801221:	89 d8                	mov    %ebx,%eax
+  801223:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801226:	5b                   	pop    %ebx
+  801227:	5e                   	pop    %esi
+  801228:	5d                   	pop    %ebp
+  801229:	c3                   	ret
+    fd_close(fd, 0);
+  80122a:	83 ec 08             	sub    $0x8,%esp
+  80122d:	6a 00                	push   $0x0
+  80122f:	ff 75 f4             	push   -0xc(%ebp)
+  801232:	e8 44 f5 ff ff       	call   80077b <fd_close>
+    return r;
+  801237:	83 c4 10             	add    $0x10,%esp
+  80123a:	eb e5                	jmp    801221 <open+0x6c>
+    return -E_BAD_PATH;
+  80123c:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801241:	eb de                	jmp    801221 <open+0x6c>
+
+00801243 <open_read>:
+{
+  801243:	55                   	push   %ebp
+  801244:	89 e5                	mov    %esp,%ebp
+  801246:	57                   	push   %edi
+  801247:	56                   	push   %esi
+  801248:	53                   	push   %ebx
+  801249:	83 ec 28             	sub    $0x28,%esp
+  80124c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  80124f:	57                   	push   %edi
+  801250:	e8 af 14 00 00       	call   802704 <strlen>
+  801255:	83 c4 10             	add    $0x10,%esp
+  801258:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80125d:	0f 87 f6 00 00 00    	ja     801359 <open_read+0x116>
+  801263:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  801265:	83 ec 0c             	sub    $0xc,%esp
+  801268:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80126b:	50                   	push   %eax
+  80126c:	e8 18 f4 ff ff       	call   800689 <fd_alloc>
+  801271:	89 c3                	mov    %eax,%ebx
+  801273:	83 c4 10             	add    $0x10,%esp
+  801276:	85 c0                	test   %eax,%eax
+  801278:	0f 88 b2 00 00 00    	js     801330 <open_read+0xed>
+  strcpy(req->req_buf, path);
+  80127e:	83 ec 08             	sub    $0x8,%esp
+  801281:	57                   	push   %edi
+  801282:	68 e4 60 80 00       	push   $0x8060e4
+  801287:	e8 b3 14 00 00       	call   80273f <strcpy>
+  req->req_nops = 2;
+  80128c:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  801293:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  801296:	c7 05 04 60 80 00 01 	movl   $0x1,0x806004
+  80129d:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  8012a0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8012a3:	a3 10 60 80 00       	mov    %eax,0x806010
+  req->req_ops[0].op_buf = 0;
+  8012a8:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  8012af:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  8012b2:	c7 05 20 60 80 00 04 	movl   $0x4,0x806020
+  8012b9:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  8012bc:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  8012c3:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  8012c6:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  8012cb:	29 f0                	sub    %esi,%eax
+  8012cd:	3b 45 14             	cmp    0x14(%ebp),%eax
+  8012d0:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  8012d4:	a3 2c 60 80 00       	mov    %eax,0x80602c
+  req->req_ops[1].op_offset = 0;
+  8012d9:	c7 05 30 60 80 00 00 	movl   $0x0,0x806030
+  8012e0:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  8012e3:	83 c6 01             	add    $0x1,%esi
+  8012e6:	89 35 34 60 80 00    	mov    %esi,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  8012ec:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8012ef:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8012f4:	e8 2a fa ff ff       	call   800d23 <fsipc>
+  8012f9:	89 c3                	mov    %eax,%ebx
+  8012fb:	83 c4 10             	add    $0x10,%esp
+  8012fe:	83 f8 01             	cmp    $0x1,%eax
+  801301:	7e 37                	jle    80133a <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  801303:	a1 38 60 80 00       	mov    0x806038,%eax
+  801308:	8b 55 18             	mov    0x18(%ebp),%edx
+  80130b:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  80130d:	83 ec 04             	sub    $0x4,%esp
+  801310:	50                   	push   %eax
+  801311:	81 c6 e4 60 80 00    	add    $0x8060e4,%esi
+  801317:	56                   	push   %esi
+  801318:	ff 75 10             	push   0x10(%ebp)
+  80131b:	e8 a5 15 00 00       	call   8028c5 <memmove>
+  return fd2num(fd);
+  801320:	83 c4 04             	add    $0x4,%esp
+  801323:	ff 75 e4             	push   -0x1c(%ebp)
+  801326:	e8 3a f3 ff ff       	call   800665 <fd2num>
+  80132b:	89 c3                	mov    %eax,%ebx
+  80132d:	83 c4 10             	add    $0x10,%esp
+}
+  801330:	89 d8                	mov    %ebx,%eax
+  801332:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801335:	5b                   	pop    %ebx
+  801336:	5e                   	pop    %esi
+  801337:	5f                   	pop    %edi
+  801338:	5d                   	pop    %ebp
+  801339:	c3                   	ret
+    fd_close(fd, 0);
+  80133a:	83 ec 08             	sub    $0x8,%esp
+  80133d:	6a 00                	push   $0x0
+  80133f:	ff 75 e4             	push   -0x1c(%ebp)
+  801342:	e8 34 f4 ff ff       	call   80077b <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  801347:	83 c4 10             	add    $0x10,%esp
+  80134a:	85 db                	test   %ebx,%ebx
+  80134c:	78 e2                	js     801330 <open_read+0xed>
+  80134e:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  801351:	8b 9b 1c 60 80 00    	mov    0x80601c(%ebx),%ebx
+  801357:	eb d7                	jmp    801330 <open_read+0xed>
+    return -E_BAD_PATH;
+  801359:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80135e:	eb d0                	jmp    801330 <open_read+0xed>
+
+00801360 <file_stat>:
+{
+  801360:	55                   	push   %ebp
+  801361:	89 e5                	mov    %esp,%ebp
+  801363:	57                   	push   %edi
+  801364:	56                   	push   %esi
+  801365:	53                   	push   %ebx
+  801366:	83 ec 18             	sub    $0x18,%esp
+  801369:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80136c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  80136f:	57                   	push   %edi
+  801370:	e8 8f 13 00 00       	call   802704 <strlen>
+  801375:	83 c4 10             	add    $0x10,%esp
+  801378:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80137d:	0f 8f c7 00 00 00    	jg     80144a <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  801383:	83 ec 0c             	sub    $0xc,%esp
+  801386:	57                   	push   %edi
+  801387:	e8 78 13 00 00       	call   802704 <strlen>
+  80138c:	8d 58 04             	lea    0x4(%eax),%ebx
+  80138f:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  801392:	83 c4 08             	add    $0x8,%esp
+  801395:	57                   	push   %edi
+  801396:	68 e4 60 80 00       	push   $0x8060e4
+  80139b:	e8 9f 13 00 00       	call   80273f <strcpy>
+  req->req_nops = 2;
+  8013a0:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  8013a7:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  8013aa:	c7 05 04 60 80 00 02 	movl   $0x2,0x806004
+  8013b1:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  8013b4:	c7 05 10 60 80 00 00 	movl   $0x0,0x806010
+  8013bb:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  8013be:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  8013c5:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  8013c8:	c7 05 20 60 80 00 03 	movl   $0x3,0x806020
+  8013cf:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  8013d2:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  8013d9:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  8013dc:	89 1d 34 60 80 00    	mov    %ebx,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  8013e2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013e7:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8013ec:	e8 32 f9 ff ff       	call   800d23 <fsipc>
+  8013f1:	83 c4 10             	add    $0x10,%esp
+  8013f4:	83 f8 01             	cmp    $0x1,%eax
+  8013f7:	7e 42                	jle    80143b <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  8013f9:	81 c3 e4 60 80 00    	add    $0x8060e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  8013ff:	83 ec 08             	sub    $0x8,%esp
+  801402:	53                   	push   %ebx
+  801403:	56                   	push   %esi
+  801404:	e8 36 13 00 00       	call   80273f <strcpy>
+  st->st_size = ret->ret_size;
+  801409:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  80140f:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  801415:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  80141b:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  801421:	c7 86 88 00 00 00 04 	movl   $0x804004,0x88(%esi)
+  801428:	40 80 00 
+  return 0;
+  80142b:	83 c4 10             	add    $0x10,%esp
+  80142e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801433:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801436:	5b                   	pop    %ebx
+  801437:	5e                   	pop    %esi
+  801438:	5f                   	pop    %edi
+  801439:	5d                   	pop    %ebp
+  80143a:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  80143b:	85 c0                	test   %eax,%eax
+  80143d:	78 f4                	js     801433 <file_stat+0xd3>
+  80143f:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801442:	8b 80 1c 60 80 00    	mov    0x80601c(%eax),%eax
+  801448:	eb e9                	jmp    801433 <file_stat+0xd3>
+    return -E_BAD_PATH;
+  80144a:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  80144f:	eb e2                	jmp    801433 <file_stat+0xd3>
+
+00801451 <read_map>:
+{
+  801451:	55                   	push   %ebp
+  801452:	89 e5                	mov    %esp,%ebp
+  801454:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801457:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80145a:	50                   	push   %eax
+  80145b:	ff 75 08             	push   0x8(%ebp)
+  80145e:	e8 7c f2 ff ff       	call   8006df <fd_lookup>
+  801463:	83 c4 10             	add    $0x10,%esp
+  801466:	85 c0                	test   %eax,%eax
+  801468:	78 2a                	js     801494 <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  80146a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80146d:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  801473:	39 08                	cmp    %ecx,(%eax)
+  801475:	75 1f                	jne    801496 <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  801477:	8b 40 0c             	mov    0xc(%eax),%eax
+  80147a:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read_map.req_offset = offset;
+  80147f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801482:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  801487:	8b 55 10             	mov    0x10(%ebp),%edx
+  80148a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80148f:	e8 8f f8 ff ff       	call   800d23 <fsipc>
+}
+  801494:	c9                   	leave
+  801495:	c3                   	ret
+    return -E_INVAL;
+  801496:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80149b:	eb f7                	jmp    801494 <read_map+0x43>
+
+0080149d <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80149d:	55                   	push   %ebp
+  80149e:	89 e5                	mov    %esp,%ebp
+  8014a0:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  8014a3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014a8:	b8 08 00 00 00       	mov    $0x8,%eax
+  8014ad:	e8 71 f8 ff ff       	call   800d23 <fsipc>
+}
+  8014b2:	c9                   	leave
+  8014b3:	c3                   	ret
+
+008014b4 <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  8014b4:	55                   	push   %ebp
+  8014b5:	89 e5                	mov    %esp,%ebp
+  8014b7:	57                   	push   %edi
+  8014b8:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  8014b9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014bc:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.stats.req_bio_sched = 0;
+  8014c1:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  8014c8:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  8014cb:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  8014d2:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  8014d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014da:	b8 09 00 00 00       	mov    $0x9,%eax
+  8014df:	e8 3f f8 ff ff       	call   800d23 <fsipc>
+  8014e4:	85 c0                	test   %eax,%eax
+  8014e6:	78 14                	js     8014fc <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  8014e8:	be 00 60 80 00       	mov    $0x806000,%esi
+  8014ed:	b9 16 00 00 00       	mov    $0x16,%ecx
+  8014f2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8014f5:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  8014f7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8014fc:	5e                   	pop    %esi
+  8014fd:	5f                   	pop    %edi
+  8014fe:	5d                   	pop    %ebp
+  8014ff:	c3                   	ret
+
+00801500 <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  801500:	55                   	push   %ebp
+  801501:	89 e5                	mov    %esp,%ebp
+  801503:	53                   	push   %ebx
+  801504:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  801507:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  80150a:	50                   	push   %eax
+  80150b:	6a 00                	push   $0x0
+  80150d:	e8 a2 ff ff ff       	call   8014b4 <fs_stats>
+  801512:	83 c4 10             	add    $0x10,%esp
+  801515:	85 c0                	test   %eax,%eax
+  801517:	78 28                	js     801541 <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  801519:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  80151c:	83 ec 08             	sub    $0x8,%esp
+  80151f:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801522:	50                   	push   %eax
+  801523:	6a 20                	push   $0x20
+  801525:	e8 8a ff ff ff       	call   8014b4 <fs_stats>
+  80152a:	83 c4 10             	add    $0x10,%esp
+  80152d:	85 c0                	test   %eax,%eax
+  80152f:	78 10                	js     801541 <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  801531:	83 ec 08             	sub    $0x8,%esp
+  801534:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801537:	50                   	push   %eax
+  801538:	53                   	push   %ebx
+  801539:	e8 76 ff ff ff       	call   8014b4 <fs_stats>
+  80153e:	83 c4 10             	add    $0x10,%esp
+}
+  801541:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801544:	c9                   	leave
+  801545:	c3                   	ret
+
+00801546 <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  801546:	55                   	push   %ebp
+  801547:	89 e5                	mov    %esp,%ebp
+  801549:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  80154c:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  801553:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  801556:	8b 45 08             	mov    0x8(%ebp),%eax
+  801559:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.stats.req_dcache = 0;
+  80155e:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  801565:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  801568:	ba 00 00 00 00       	mov    $0x0,%edx
+  80156d:	b8 09 00 00 00       	mov    $0x9,%eax
+  801572:	e8 ac f7 ff ff       	call   800d23 <fsipc>
+}
+  801577:	c9                   	leave
+  801578:	c3                   	ret
+
+00801579 <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  801579:	55                   	push   %ebp
+  80157a:	89 e5                	mov    %esp,%ebp
+  80157c:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  80157f:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  801586:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  801589:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  801590:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  801593:	8b 45 08             	mov    0x8(%ebp),%eax
+  801596:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_STATS, NULL);
+  80159b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015a0:	b8 09 00 00 00       	mov    $0x9,%eax
+  8015a5:	e8 79 f7 ff ff       	call   800d23 <fsipc>
+}
+  8015aa:	c9                   	leave
+  8015ab:	c3                   	ret
+
+008015ac <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  8015ac:	55                   	push   %ebp
+  8015ad:	89 e5                	mov    %esp,%ebp
+  8015af:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8015b2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015b5:	50                   	push   %eax
+  8015b6:	ff 75 08             	push   0x8(%ebp)
+  8015b9:	e8 21 f1 ff ff       	call   8006df <fd_lookup>
+  8015be:	83 c4 10             	add    $0x10,%esp
+  8015c1:	85 c0                	test   %eax,%eax
+  8015c3:	78 34                	js     8015f9 <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  8015c5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015c8:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  8015ce:	39 08                	cmp    %ecx,(%eax)
+  8015d0:	75 29                	jne    8015fb <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  8015d2:	8b 40 0c             	mov    0xc(%eax),%eax
+  8015d5:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.fallocate.req_offset = offset;
+  8015da:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8015dd:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.fallocate.req_len = len;
+  8015e2:	8b 45 10             	mov    0x10(%ebp),%eax
+  8015e5:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  8015ea:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015ef:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8015f4:	e8 2a f7 ff ff       	call   800d23 <fsipc>
+}
+  8015f9:	c9                   	leave
+  8015fa:	c3                   	ret
+    return -E_INVAL;
+  8015fb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801600:	eb f7                	jmp    8015f9 <fallocate+0x4d>
+
+00801602 <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  801602:	55                   	push   %ebp
+  801603:	89 e5                	mov    %esp,%ebp
+  801605:	57                   	push   %edi
+  801606:	56                   	push   %esi
+  801607:	53                   	push   %ebx
+  801608:	83 ec 24             	sub    $0x24,%esp
+  80160b:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80160e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801611:	50                   	push   %eax
+  801612:	ff 75 08             	push   0x8(%ebp)
+  801615:	e8 c5 f0 ff ff       	call   8006df <fd_lookup>
+  80161a:	83 c4 10             	add    $0x10,%esp
+  80161d:	85 c0                	test   %eax,%eax
+  80161f:	78 66                	js     801687 <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  801621:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801624:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  80162a:	39 08                	cmp    %ecx,(%eax)
+  80162c:	75 61                	jne    80168f <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  80162e:	85 f6                	test   %esi,%esi
+  801630:	7e 50                	jle    801682 <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  801632:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  801637:	39 de                	cmp    %ebx,%esi
+  801639:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  80163c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80163f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801642:	a3 00 60 80 00       	mov    %eax,0x806000
+    fsipcbuf.prefetch.req_n = m;
+  801647:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  80164d:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  801654:	83 ec 04             	sub    $0x4,%esp
+  801657:	57                   	push   %edi
+  801658:	ff 75 0c             	push   0xc(%ebp)
+  80165b:	68 08 60 80 00       	push   $0x806008
+  801660:	e8 60 12 00 00       	call   8028c5 <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  801665:	ba 00 00 00 00       	mov    $0x0,%edx
+  80166a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80166f:	e8 af f6 ff ff       	call   800d23 <fsipc>
+  801674:	83 c4 10             	add    $0x10,%esp
+  801677:	85 c0                	test   %eax,%eax
+  801679:	78 0c                	js     801687 <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  80167b:	01 7d 0c             	add    %edi,0xc(%ebp)
+  80167e:	29 de                	sub    %ebx,%esi
+  801680:	eb ac                	jmp    80162e <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  801682:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801687:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80168a:	5b                   	pop    %ebx
+  80168b:	5e                   	pop    %esi
+  80168c:	5f                   	pop    %edi
+  80168d:	5d                   	pop    %ebp
+  80168e:	c3                   	ret
+    return -E_INVAL;
+  80168f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801694:	eb f1                	jmp    801687 <prefetch+0x85>
+
+00801696 <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  801696:	55                   	push   %ebp
+  801697:	89 e5                	mov    %esp,%ebp
+  801699:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  80169c:	50                   	push   %eax
+  80169d:	e8 d3 ef ff ff       	call   800675 <fd2data>
+  8016a2:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  8016a7:	c9                   	leave
+  8016a8:	c3                   	ret
+
+008016a9 <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8016a9:	55                   	push   %ebp
+  8016aa:	89 e5                	mov    %esp,%ebp
+  8016ac:	56                   	push   %esi
+  8016ad:	53                   	push   %ebx
+  8016ae:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  8016b1:	83 ec 0c             	sub    $0xc,%esp
+  8016b4:	ff 75 08             	push   0x8(%ebp)
+  8016b7:	e8 b9 ef ff ff       	call   800675 <fd2data>
+  8016bc:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  8016be:	83 c4 08             	add    $0x8,%esp
+  8016c1:	68 94 2f 80 00       	push   $0x802f94
+  8016c6:	53                   	push   %ebx
+  8016c7:	e8 73 10 00 00       	call   80273f <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  8016cc:	8b 46 04             	mov    0x4(%esi),%eax
+  8016cf:	2b 06                	sub    (%esi),%eax
+  8016d1:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  8016d7:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8016de:	00 00 00 
+  stat->st_dev = &devpipe;
+  8016e1:	c7 83 88 00 00 00 20 	movl   $0x804020,0x88(%ebx)
+  8016e8:	40 80 00 
+  return 0;
+}
+  8016eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016f0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016f3:	5b                   	pop    %ebx
+  8016f4:	5e                   	pop    %esi
+  8016f5:	5d                   	pop    %ebp
+  8016f6:	c3                   	ret
+
+008016f7 <pipe_wakeup>:
+{
+  8016f7:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  8016f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016fe:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  801701:	85 c0                	test   %eax,%eax
+  801703:	75 01                	jne    801706 <pipe_wakeup+0xf>
+  801705:	c3                   	ret
+{
+  801706:	55                   	push   %ebp
+  801707:	89 e5                	mov    %esp,%ebp
+  801709:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  80170c:	6a 00                	push   $0x0
+  80170e:	68 00 00 c0 ee       	push   $0xeec00000
+  801713:	52                   	push   %edx
+  801714:	e8 f9 ed ff ff       	call   800512 <sys_chan_wakeup>
+  801719:	83 c4 10             	add    $0x10,%esp
+}
+  80171c:	c9                   	leave
+  80171d:	c3                   	ret
+
+0080171e <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80171e:	55                   	push   %ebp
+  80171f:	89 e5                	mov    %esp,%ebp
+  801721:	57                   	push   %edi
+  801722:	56                   	push   %esi
+  801723:	53                   	push   %ebx
+  801724:	83 ec 18             	sub    $0x18,%esp
+  801727:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  80172a:	57                   	push   %edi
+  80172b:	e8 45 ef ff ff       	call   800675 <fd2data>
+  801730:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  801732:	83 c4 10             	add    $0x10,%esp
+  801735:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  801739:	74 2a                	je     801765 <devpipe_close+0x47>
+  80173b:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  801740:	89 f8                	mov    %edi,%eax
+  801742:	e8 4f ff ff ff       	call   801696 <pipe_ring>
+  801747:	83 ec 08             	sub    $0x8,%esp
+  80174a:	01 d8                	add    %ebx,%eax
+  80174c:	50                   	push   %eax
+  80174d:	6a 00                	push   $0x0
+  80174f:	e8 e7 ea ff ff       	call   80023b <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  801754:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80175a:	83 c4 10             	add    $0x10,%esp
+  80175d:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  801763:	75 db                	jne    801740 <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  801765:	83 ec 08             	sub    $0x8,%esp
+  801768:	57                   	push   %edi
+  801769:	6a 00                	push   $0x0
+  80176b:	e8 cb ea ff ff       	call   80023b <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  801770:	83 c4 10             	add    $0x10,%esp
+  801773:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  801777:	75 13                	jne    80178c <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  801779:	83 ec 08             	sub    $0x8,%esp
+  80177c:	56                   	push   %esi
+  80177d:	6a 00                	push   $0x0
+  80177f:	e8 b7 ea ff ff       	call   80023b <sys_page_unmap>
+}
+  801784:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801787:	5b                   	pop    %ebx
+  801788:	5e                   	pop    %esi
+  801789:	5f                   	pop    %edi
+  80178a:	5d                   	pop    %ebp
+  80178b:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  80178c:	8d 56 04             	lea    0x4(%esi),%edx
+  80178f:	8d 46 2c             	lea    0x2c(%esi),%eax
+  801792:	e8 60 ff ff ff       	call   8016f7 <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  801797:	8d 46 30             	lea    0x30(%esi),%eax
+  80179a:	89 f2                	mov    %esi,%edx
+  80179c:	e8 56 ff ff ff       	call   8016f7 <pipe_wakeup>
+  8017a1:	eb d6                	jmp    801779 <devpipe_close+0x5b>
+
+008017a3 <_pipeisclosed>:
+{
+  8017a3:	55                   	push   %ebp
+  8017a4:	89 e5                	mov    %esp,%ebp
+  8017a6:	57                   	push   %edi
+  8017a7:	56                   	push   %esi
+  8017a8:	53                   	push   %ebx
+  8017a9:	83 ec 1c             	sub    $0x1c,%esp
+  8017ac:	89 c7                	mov    %eax,%edi
+  8017ae:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  8017b0:	a1 44 57 80 00       	mov    0x805744,%eax
+  8017b5:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  8017b8:	83 ec 0c             	sub    $0xc,%esp
+  8017bb:	57                   	push   %edi
+  8017bc:	e8 11 14 00 00       	call   802bd2 <pageref>
+  8017c1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8017c4:	89 34 24             	mov    %esi,(%esp)
+  8017c7:	e8 06 14 00 00       	call   802bd2 <pageref>
+    nn = thisenv->env_runs;
+  8017cc:	8b 15 44 57 80 00    	mov    0x805744,%edx
+  8017d2:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  8017d5:	83 c4 10             	add    $0x10,%esp
+  8017d8:	39 cb                	cmp    %ecx,%ebx
+  8017da:	74 1b                	je     8017f7 <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  8017dc:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8017df:	75 cf                	jne    8017b0 <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8017e1:	8b 42 58             	mov    0x58(%edx),%eax
+  8017e4:	6a 01                	push   $0x1
+  8017e6:	50                   	push   %eax
+  8017e7:	53                   	push   %ebx
+  8017e8:	68 9b 2f 80 00       	push   $0x802f9b
+  8017ed:	e8 5f 09 00 00       	call   802151 <cprintf>
+  8017f2:	83 c4 10             	add    $0x10,%esp
+  8017f5:	eb b9                	jmp    8017b0 <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  8017f7:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8017fa:	0f 94 c0             	sete   %al
+  8017fd:	0f b6 c0             	movzbl %al,%eax
+}
+  801800:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801803:	5b                   	pop    %ebx
+  801804:	5e                   	pop    %esi
+  801805:	5f                   	pop    %edi
+  801806:	5d                   	pop    %ebp
+  801807:	c3                   	ret
+
+00801808 <devpipe_write_bulk>:
+{
+  801808:	55                   	push   %ebp
+  801809:	89 e5                	mov    %esp,%ebp
+  80180b:	57                   	push   %edi
+  80180c:	56                   	push   %esi
+  80180d:	53                   	push   %ebx
+  80180e:	83 ec 1c             	sub    $0x1c,%esp
+  801811:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801814:	89 d6                	mov    %edx,%esi
+  801816:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  801819:	e8 78 fe ff ff       	call   801696 <pipe_ring>
+  80181e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  801821:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  801826:	8d 46 04             	lea    0x4(%esi),%eax
+  801829:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  80182c:	eb 75                	jmp    8018a3 <devpipe_write_bulk+0x9b>
+  80182e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801833:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  801837:	6a 64                	push   $0x64
+  801839:	68 00 00 c0 ee       	push   $0xeec00000
+  80183e:	53                   	push   %ebx
+  80183f:	56                   	push   %esi
+  801840:	e8 aa ec ff ff       	call   8004ef <sys_chan_sleep>
+      continue;
+  801845:	83 c4 10             	add    $0x10,%esp
+  801848:	eb 59                	jmp    8018a3 <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  80184a:	89 d1                	mov    %edx,%ecx
+  80184c:	c1 f9 1f             	sar    $0x1f,%ecx
+  80184f:	c1 e9 11             	shr    $0x11,%ecx
+  801852:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  801855:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  80185a:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  80185c:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  801862:	29 d3                	sub    %edx,%ebx
+  801864:	ba 00 80 00 00       	mov    $0x8000,%edx
+  801869:	29 c2                	sub    %eax,%edx
+  80186b:	39 d3                	cmp    %edx,%ebx
+  80186d:	0f 47 da             	cmova  %edx,%ebx
+  801870:	8b 55 08             	mov    0x8(%ebp),%edx
+  801873:	29 fa                	sub    %edi,%edx
+  801875:	39 d3                	cmp    %edx,%ebx
+  801877:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  80187a:	83 ec 04             	sub    $0x4,%esp
+  80187d:	53                   	push   %ebx
+  80187e:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  801881:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  801884:	52                   	push   %edx
+  801885:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801888:	01 c8                	add    %ecx,%eax
+  80188a:	50                   	push   %eax
+  80188b:	e8 97 10 00 00       	call   802927 <memcpy>
+    i += m;
+  801890:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  801892:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  801895:	8d 46 2c             	lea    0x2c(%esi),%eax
+  801898:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80189b:	e8 57 fe ff ff       	call   8016f7 <pipe_wakeup>
+  8018a0:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  8018a3:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  8018a6:	73 2b                	jae    8018d3 <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  8018a8:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  8018aa:	8b 56 04             	mov    0x4(%esi),%edx
+  8018ad:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  8018b3:	39 d0                	cmp    %edx,%eax
+  8018b5:	7d 93                	jge    80184a <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  8018b7:	89 f2                	mov    %esi,%edx
+  8018b9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8018bc:	e8 e2 fe ff ff       	call   8017a3 <_pipeisclosed>
+  8018c1:	85 c0                	test   %eax,%eax
+  8018c3:	0f 84 65 ff ff ff    	je     80182e <devpipe_write_bulk+0x26>
+        return i;
+  8018c9:	89 f8                	mov    %edi,%eax
+}
+  8018cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018ce:	5b                   	pop    %ebx
+  8018cf:	5e                   	pop    %esi
+  8018d0:	5f                   	pop    %edi
+  8018d1:	5d                   	pop    %ebp
+  8018d2:	c3                   	ret
+  return i;
+  8018d3:	89 f8                	mov    %edi,%eax
+  8018d5:	eb f4                	jmp    8018cb <devpipe_write_bulk+0xc3>
+
+008018d7 <devpipe_write>:
+{
+  8018d7:	55                   	push   %ebp
+  8018d8:	89 e5                	mov    %esp,%ebp
+  8018da:	57                   	push   %edi
+  8018db:	56                   	push   %esi
+  8018dc:	53                   	push   %ebx
+  8018dd:	83 ec 28             	sub    $0x28,%esp
+  8018e0:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  8018e3:	56                   	push   %esi
+  8018e4:	e8 8c ed ff ff       	call   800675 <fd2data>
+  8018e9:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  8018eb:	8b 78 28             	mov    0x28(%eax),%edi
+  8018ee:	83 c4 10             	add    $0x10,%esp
+  8018f1:	85 ff                	test   %edi,%edi
+  8018f3:	75 25                	jne    80191a <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  8018f5:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8018f8:	74 66                	je     801960 <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8018fa:	8b 43 04             	mov    0x4(%ebx),%eax
+  8018fd:	8b 0b                	mov    (%ebx),%ecx
+  8018ff:	8d 51 20             	lea    0x20(%ecx),%edx
+  801902:	39 d0                	cmp    %edx,%eax
+  801904:	72 2b                	jb     801931 <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  801906:	89 da                	mov    %ebx,%edx
+  801908:	89 f0                	mov    %esi,%eax
+  80190a:	e8 94 fe ff ff       	call   8017a3 <_pipeisclosed>
+  80190f:	85 c0                	test   %eax,%eax
+  801911:	75 51                	jne    801964 <devpipe_write+0x8d>
+      sys_yield();
+  801913:	e8 3c e8 ff ff       	call   800154 <sys_yield>
+  801918:	eb e0                	jmp    8018fa <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  80191a:	83 ec 0c             	sub    $0xc,%esp
+  80191d:	ff 75 10             	push   0x10(%ebp)
+  801920:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801923:	89 c2                	mov    %eax,%edx
+  801925:	89 f0                	mov    %esi,%eax
+  801927:	e8 dc fe ff ff       	call   801808 <devpipe_write_bulk>
+  80192c:	83 c4 10             	add    $0x10,%esp
+  80192f:	eb 38                	jmp    801969 <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  801931:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801934:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801938:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  80193b:	89 c2                	mov    %eax,%edx
+  80193d:	c1 fa 1f             	sar    $0x1f,%edx
+  801940:	89 d1                	mov    %edx,%ecx
+  801942:	c1 e9 1b             	shr    $0x1b,%ecx
+  801945:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801948:	83 e2 1f             	and    $0x1f,%edx
+  80194b:	29 ca                	sub    %ecx,%edx
+  80194d:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  801951:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  801955:	83 c0 01             	add    $0x1,%eax
+  801958:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  80195b:	83 c7 01             	add    $0x1,%edi
+  80195e:	eb 95                	jmp    8018f5 <devpipe_write+0x1e>
+  return i;
+  801960:	89 f8                	mov    %edi,%eax
+  801962:	eb 05                	jmp    801969 <devpipe_write+0x92>
+        return 0;
+  801964:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801969:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80196c:	5b                   	pop    %ebx
+  80196d:	5e                   	pop    %esi
+  80196e:	5f                   	pop    %edi
+  80196f:	5d                   	pop    %ebp
+  801970:	c3                   	ret
+
+00801971 <devpipe_read_bulk>:
+{
+  801971:	55                   	push   %ebp
+  801972:	89 e5                	mov    %esp,%ebp
+  801974:	57                   	push   %edi
+  801975:	56                   	push   %esi
+  801976:	53                   	push   %ebx
+  801977:	83 ec 2c             	sub    $0x2c,%esp
+  80197a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80197d:	89 d6                	mov    %edx,%esi
+  80197f:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  801982:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  801985:	e8 0c fd ff ff       	call   801696 <pipe_ring>
+  80198a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  80198d:	85 db                	test   %ebx,%ebx
+  80198f:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801994:	0f 45 c3             	cmovne %ebx,%eax
+  801997:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80199a:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  80199f:	8d 46 30             	lea    0x30(%esi),%eax
+  8019a2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  8019a5:	eb 50                	jmp    8019f7 <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  8019a7:	89 d1                	mov    %edx,%ecx
+  8019a9:	c1 f9 1f             	sar    $0x1f,%ecx
+  8019ac:	c1 e9 11             	shr    $0x11,%ecx
+  8019af:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  8019b2:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8019b7:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  8019b9:	29 d3                	sub    %edx,%ebx
+  8019bb:	ba 00 80 00 00       	mov    $0x8000,%edx
+  8019c0:	29 c2                	sub    %eax,%edx
+  8019c2:	39 d3                	cmp    %edx,%ebx
+  8019c4:	0f 47 da             	cmova  %edx,%ebx
+  8019c7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019ca:	29 fa                	sub    %edi,%edx
+  8019cc:	39 d3                	cmp    %edx,%ebx
+  8019ce:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  8019d1:	83 ec 04             	sub    $0x4,%esp
+  8019d4:	53                   	push   %ebx
+  8019d5:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8019d8:	01 c8                	add    %ecx,%eax
+  8019da:	50                   	push   %eax
+  8019db:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8019de:	01 f8                	add    %edi,%eax
+  8019e0:	50                   	push   %eax
+  8019e1:	e8 41 0f 00 00       	call   802927 <memcpy>
+    i += m;
+  8019e6:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  8019e8:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8019ea:	89 f2                	mov    %esi,%edx
+  8019ec:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8019ef:	e8 03 fd ff ff       	call   8016f7 <pipe_wakeup>
+  8019f4:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  8019f7:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  8019fa:	73 51                	jae    801a4d <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  8019fc:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  8019ff:	8b 16                	mov    (%esi),%edx
+  801a01:	39 da                	cmp    %ebx,%edx
+  801a03:	75 a2                	jne    8019a7 <devpipe_read_bulk+0x36>
+      if (i > 0)
+  801a05:	85 ff                	test   %edi,%edi
+  801a07:	75 44                	jne    801a4d <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  801a09:	89 f2                	mov    %esi,%edx
+  801a0b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801a0e:	e8 90 fd ff ff       	call   8017a3 <_pipeisclosed>
+  801a13:	85 c0                	test   %eax,%eax
+  801a15:	75 3a                	jne    801a51 <devpipe_read_bulk+0xe0>
+  801a17:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a1c:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  801a20:	6a 64                	push   $0x64
+  801a22:	ff 75 d4             	push   -0x2c(%ebp)
+  801a25:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  801a26:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  801a29:	50                   	push   %eax
+  801a2a:	e8 c0 ea ff ff       	call   8004ef <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  801a2f:	85 c0                	test   %eax,%eax
+  801a31:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a36:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  801a39:	83 c4 10             	add    $0x10,%esp
+  801a3c:	a8 01                	test   $0x1,%al
+  801a3e:	74 b7                	je     8019f7 <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  801a40:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  801a45:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a48:	5b                   	pop    %ebx
+  801a49:	5e                   	pop    %esi
+  801a4a:	5f                   	pop    %edi
+  801a4b:	5d                   	pop    %ebp
+  801a4c:	c3                   	ret
+  return i;
+  801a4d:	89 f8                	mov    %edi,%eax
+  801a4f:	eb f4                	jmp    801a45 <devpipe_read_bulk+0xd4>
+        return 0;
+  801a51:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a56:	eb ed                	jmp    801a45 <devpipe_read_bulk+0xd4>
+
+00801a58 <devpipe_read>:
+{
+  801a58:	55                   	push   %ebp
+  801a59:	89 e5                	mov    %esp,%ebp
+  801a5b:	57                   	push   %edi
+  801a5c:	56                   	push   %esi
+  801a5d:	53                   	push   %ebx
+  801a5e:	83 ec 18             	sub    $0x18,%esp
+  801a61:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  801a64:	57                   	push   %edi
+  801a65:	e8 0b ec ff ff       	call   800675 <fd2data>
+  801a6a:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  801a6c:	8b 70 28             	mov    0x28(%eax),%esi
+  801a6f:	83 c4 10             	add    $0x10,%esp
+  801a72:	85 f6                	test   %esi,%esi
+  801a74:	75 24                	jne    801a9a <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  801a76:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801a79:	74 60                	je     801adb <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  801a7b:	8b 03                	mov    (%ebx),%eax
+  801a7d:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801a80:	75 3b                	jne    801abd <devpipe_read+0x65>
+      if (i > 0)
+  801a82:	85 f6                	test   %esi,%esi
+  801a84:	75 2d                	jne    801ab3 <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  801a86:	89 da                	mov    %ebx,%edx
+  801a88:	89 f8                	mov    %edi,%eax
+  801a8a:	e8 14 fd ff ff       	call   8017a3 <_pipeisclosed>
+  801a8f:	85 c0                	test   %eax,%eax
+  801a91:	75 4c                	jne    801adf <devpipe_read+0x87>
+      sys_yield();
+  801a93:	e8 bc e6 ff ff       	call   800154 <sys_yield>
+  801a98:	eb e1                	jmp    801a7b <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  801a9a:	83 ec 08             	sub    $0x8,%esp
+  801a9d:	6a 00                	push   $0x0
+  801a9f:	ff 75 10             	push   0x10(%ebp)
+  801aa2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801aa5:	89 c2                	mov    %eax,%edx
+  801aa7:	89 f8                	mov    %edi,%eax
+  801aa9:	e8 c3 fe ff ff       	call   801971 <devpipe_read_bulk>
+  801aae:	83 c4 10             	add    $0x10,%esp
+  801ab1:	eb 02                	jmp    801ab5 <devpipe_read+0x5d>
+        return i;
+  801ab3:	89 f0                	mov    %esi,%eax
+}
+  801ab5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ab8:	5b                   	pop    %ebx
+  801ab9:	5e                   	pop    %esi
+  801aba:	5f                   	pop    %edi
+  801abb:	5d                   	pop    %ebp
+  801abc:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801abd:	99                   	cltd
+  801abe:	c1 ea 1b             	shr    $0x1b,%edx
+  801ac1:	01 d0                	add    %edx,%eax
+  801ac3:	83 e0 1f             	and    $0x1f,%eax
+  801ac6:	29 d0                	sub    %edx,%eax
+  801ac8:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801acd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801ad0:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  801ad3:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  801ad6:	83 c6 01             	add    $0x1,%esi
+  801ad9:	eb 9b                	jmp    801a76 <devpipe_read+0x1e>
+  return i;
+  801adb:	89 f0                	mov    %esi,%eax
+  801add:	eb d6                	jmp    801ab5 <devpipe_read+0x5d>
+        return 0;
+  801adf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ae4:	eb cf                	jmp    801ab5 <devpipe_read+0x5d>
+
+00801ae6 <pipe2>:
+{
+  801ae6:	55                   	push   %ebp
+  801ae7:	89 e5                	mov    %esp,%ebp
+  801ae9:	57                   	push   %edi
+  801aea:	56                   	push   %esi
+  801aeb:	53                   	push   %ebx
+  801aec:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  801aef:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801af2:	50                   	push   %eax
+  801af3:	e8 91 eb ff ff       	call   800689 <fd_alloc>
+  801af8:	89 c3                	mov    %eax,%ebx
+  801afa:	83 c4 10             	add    $0x10,%esp
+  801afd:	85 c0                	test   %eax,%eax
+  801aff:	0f 88 fb 01 00 00    	js     801d00 <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801b05:	83 ec 04             	sub    $0x4,%esp
+  801b08:	68 07 04 00 00       	push   $0x407
+  801b0d:	ff 75 e4             	push   -0x1c(%ebp)
+  801b10:	6a 00                	push   $0x0
+  801b12:	e8 9f e6 ff ff       	call   8001b6 <sys_page_alloc>
+  801b17:	89 c3                	mov    %eax,%ebx
+  801b19:	83 c4 10             	add    $0x10,%esp
+  801b1c:	85 c0                	test   %eax,%eax
+  801b1e:	0f 88 dc 01 00 00    	js     801d00 <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  801b24:	83 ec 0c             	sub    $0xc,%esp
+  801b27:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801b2a:	50                   	push   %eax
+  801b2b:	e8 59 eb ff ff       	call   800689 <fd_alloc>
+  801b30:	89 c3                	mov    %eax,%ebx
+  801b32:	83 c4 10             	add    $0x10,%esp
+  801b35:	85 c0                	test   %eax,%eax
+  801b37:	0f 88 b3 01 00 00    	js     801cf0 <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801b3d:	83 ec 04             	sub    $0x4,%esp
+  801b40:	68 07 04 00 00       	push   $0x407
+  801b45:	ff 75 e0             	push   -0x20(%ebp)
+  801b48:	6a 00                	push   $0x0
+  801b4a:	e8 67 e6 ff ff       	call   8001b6 <sys_page_alloc>
+  801b4f:	89 c3                	mov    %eax,%ebx
+  801b51:	83 c4 10             	add    $0x10,%esp
+  801b54:	85 c0                	test   %eax,%eax
+  801b56:	0f 88 94 01 00 00    	js     801cf0 <pipe2+0x20a>
+  va = fd2data(fd0);
+  801b5c:	83 ec 0c             	sub    $0xc,%esp
+  801b5f:	ff 75 e4             	push   -0x1c(%ebp)
+  801b62:	e8 0e eb ff ff       	call   800675 <fd2data>
+  801b67:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801b69:	83 c4 0c             	add    $0xc,%esp
+  801b6c:	68 07 04 00 00       	push   $0x407
+  801b71:	50                   	push   %eax
+  801b72:	6a 00                	push   $0x0
+  801b74:	e8 3d e6 ff ff       	call   8001b6 <sys_page_alloc>
+  801b79:	89 c3                	mov    %eax,%ebx
+  801b7b:	83 c4 10             	add    $0x10,%esp
+  801b7e:	85 c0                	test   %eax,%eax
+  801b80:	0f 88 5a 01 00 00    	js     801ce0 <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801b86:	83 ec 0c             	sub    $0xc,%esp
+  801b89:	ff 75 e0             	push   -0x20(%ebp)
+  801b8c:	e8 e4 ea ff ff       	call   800675 <fd2data>
+  801b91:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  801b98:	50                   	push   %eax
+  801b99:	6a 00                	push   $0x0
+  801b9b:	57                   	push   %edi
+  801b9c:	6a 00                	push   $0x0
+  801b9e:	e8 56 e6 ff ff       	call   8001f9 <sys_page_map>
+  801ba3:	89 c3                	mov    %eax,%ebx
+  801ba5:	83 c4 20             	add    $0x20,%esp
+  801ba8:	85 c0                	test   %eax,%eax
+  801baa:	0f 88 22 01 00 00    	js     801cd2 <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  801bb0:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  801bb4:	74 72                	je     801c28 <pipe2+0x142>
+  801bb6:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  801bbb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801bbe:	e8 d3 fa ff ff       	call   801696 <pipe_ring>
+  801bc3:	83 ec 04             	sub    $0x4,%esp
+  801bc6:	68 07 04 00 00       	push   $0x407
+  801bcb:	01 f0                	add    %esi,%eax
+  801bcd:	50                   	push   %eax
+  801bce:	6a 00                	push   $0x0
+  801bd0:	e8 e1 e5 ff ff       	call   8001b6 <sys_page_alloc>
+  801bd5:	89 c3                	mov    %eax,%ebx
+  801bd7:	83 c4 10             	add    $0x10,%esp
+  801bda:	85 c0                	test   %eax,%eax
+  801bdc:	0f 88 97 00 00 00    	js     801c79 <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  801be2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801be5:	e8 ac fa ff ff       	call   801696 <pipe_ring>
+  801bea:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  801bed:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801bf0:	e8 a1 fa ff ff       	call   801696 <pipe_ring>
+  801bf5:	83 ec 0c             	sub    $0xc,%esp
+  801bf8:	68 07 04 00 00       	push   $0x407
+  801bfd:	53                   	push   %ebx
+  801bfe:	6a 00                	push   $0x0
+  801c00:	01 f0                	add    %esi,%eax
+  801c02:	50                   	push   %eax
+  801c03:	6a 00                	push   $0x0
+  801c05:	e8 ef e5 ff ff       	call   8001f9 <sys_page_map>
+  801c0a:	89 c3                	mov    %eax,%ebx
+  801c0c:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801c12:	83 c4 20             	add    $0x20,%esp
+  801c15:	85 c0                	test   %eax,%eax
+  801c17:	78 60                	js     801c79 <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  801c19:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  801c1f:	75 9a                	jne    801bbb <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  801c21:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  801c28:	a1 20 40 80 00       	mov    0x804020,%eax
+  801c2d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801c30:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  801c32:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801c35:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  801c3c:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801c3f:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  801c41:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801c44:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  801c4b:	83 ec 0c             	sub    $0xc,%esp
+  801c4e:	ff 75 e4             	push   -0x1c(%ebp)
+  801c51:	e8 0f ea ff ff       	call   800665 <fd2num>
+  801c56:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801c59:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  801c5b:	83 c4 04             	add    $0x4,%esp
+  801c5e:	ff 75 e0             	push   -0x20(%ebp)
+  801c61:	e8 ff e9 ff ff       	call   800665 <fd2num>
+  801c66:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801c69:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  801c6c:	83 c4 10             	add    $0x10,%esp
+  801c6f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c74:	e9 87 00 00 00       	jmp    801d00 <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  801c79:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  801c7e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801c81:	e8 10 fa ff ff       	call   801696 <pipe_ring>
+  801c86:	83 ec 08             	sub    $0x8,%esp
+  801c89:	01 f0                	add    %esi,%eax
+  801c8b:	50                   	push   %eax
+  801c8c:	6a 00                	push   $0x0
+  801c8e:	e8 a8 e5 ff ff       	call   80023b <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  801c93:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801c96:	e8 fb f9 ff ff       	call   801696 <pipe_ring>
+  801c9b:	83 c4 08             	add    $0x8,%esp
+  801c9e:	01 f0                	add    %esi,%eax
+  801ca0:	50                   	push   %eax
+  801ca1:	6a 00                	push   $0x0
+  801ca3:	e8 93 e5 ff ff       	call   80023b <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  801ca8:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801cae:	83 c4 10             	add    $0x10,%esp
+  801cb1:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  801cb7:	75 c5                	jne    801c7e <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  801cb9:	83 ec 0c             	sub    $0xc,%esp
+  801cbc:	ff 75 e0             	push   -0x20(%ebp)
+  801cbf:	e8 b1 e9 ff ff       	call   800675 <fd2data>
+  801cc4:	83 c4 08             	add    $0x8,%esp
+  801cc7:	50                   	push   %eax
+  801cc8:	6a 00                	push   $0x0
+  801cca:	e8 6c e5 ff ff       	call   80023b <sys_page_unmap>
+  801ccf:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  801cd2:	83 ec 08             	sub    $0x8,%esp
+  801cd5:	57                   	push   %edi
+  801cd6:	6a 00                	push   $0x0
+  801cd8:	e8 5e e5 ff ff       	call   80023b <sys_page_unmap>
+  801cdd:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  801ce0:	83 ec 08             	sub    $0x8,%esp
+  801ce3:	ff 75 e0             	push   -0x20(%ebp)
+  801ce6:	6a 00                	push   $0x0
+  801ce8:	e8 4e e5 ff ff       	call   80023b <sys_page_unmap>
+  801ced:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  801cf0:	83 ec 08             	sub    $0x8,%esp
+  801cf3:	ff 75 e4             	push   -0x1c(%ebp)
+  801cf6:	6a 00                	push   $0x0
+  801cf8:	e8 3e e5 ff ff       	call   80023b <sys_page_unmap>
+  801cfd:	83 c4 10             	add    $0x10,%esp
+}
+  801d00:	89 d8                	mov    %ebx,%eax
+  801d02:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d05:	5b                   	pop    %ebx
+  801d06:	5e                   	pop    %esi
+  801d07:	5f                   	pop    %edi
+  801d08:	5d                   	pop    %ebp
+  801d09:	c3                   	ret
+
+00801d0a <pipe>:
+{
+  801d0a:	55                   	push   %ebp
+  801d0b:	89 e5                	mov    %esp,%ebp
+  801d0d:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  801d10:	6a 00                	push   $0x0
+  801d12:	ff 75 08             	push   0x8(%ebp)
+  801d15:	e8 cc fd ff ff       	call   801ae6 <pipe2>
+}
+  801d1a:	c9                   	leave
+  801d1b:	c3                   	ret
+
+00801d1c <pipeisclosed>:
+{
+  801d1c:	55                   	push   %ebp
+  801d1d:	89 e5                	mov    %esp,%ebp
+  801d1f:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801d22:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d25:	50                   	push   %eax
+  801d26:	ff 75 08             	push   0x8(%ebp)
+  801d29:	e8 b1 e9 ff ff       	call   8006df <fd_lookup>
+  801d2e:	83 c4 10             	add    $0x10,%esp
+  801d31:	85 c0                	test   %eax,%eax
+  801d33:	78 18                	js     801d4d <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  801d35:	83 ec 0c             	sub    $0xc,%esp
+  801d38:	ff 75 f4             	push   -0xc(%ebp)
+  801d3b:	e8 35 e9 ff ff       	call   800675 <fd2data>
+  801d40:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  801d42:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d45:	e8 59 fa ff ff       	call   8017a3 <_pipeisclosed>
+  801d4a:	83 c4 10             	add    $0x10,%esp
+}
+  801d4d:	c9                   	leave
+  801d4e:	c3                   	ret
+
+00801d4f <pipe_splice>:
+{
+  801d4f:	55                   	push   %ebp
+  801d50:	89 e5                	mov    %esp,%ebp
+  801d52:	57                   	push   %edi
+  801d53:	56                   	push   %esi
+  801d54:	53                   	push   %ebx
+  801d55:	83 ec 34             	sub    $0x34,%esp
+  801d58:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801d5b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801d5e:	50                   	push   %eax
+  801d5f:	ff 75 08             	push   0x8(%ebp)
+  801d62:	e8 78 e9 ff ff       	call   8006df <fd_lookup>
+  801d67:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801d6a:	83 c4 10             	add    $0x10,%esp
+  801d6d:	85 c0                	test   %eax,%eax
+  801d6f:	0f 88 d7 00 00 00    	js     801e4c <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  801d75:	83 ec 0c             	sub    $0xc,%esp
+  801d78:	ff 75 e4             	push   -0x1c(%ebp)
+  801d7b:	e8 f5 e8 ff ff       	call   800675 <fd2data>
+  801d80:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  801d82:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801d85:	83 c4 10             	add    $0x10,%esp
+  801d88:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801d8e:	39 10                	cmp    %edx,(%eax)
+  801d90:	0f 85 c1 00 00 00    	jne    801e57 <pipe_splice+0x108>
+  801d96:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  801d9a:	0f 84 c0 00 00 00    	je     801e60 <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  801da0:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  801da4:	0f 84 bf 00 00 00    	je     801e69 <pipe_splice+0x11a>
+  801daa:	89 f7                	mov    %esi,%edi
+  801dac:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  801db2:	0f 85 ba 00 00 00    	jne    801e72 <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  801db8:	8d 43 04             	lea    0x4(%ebx),%eax
+  801dbb:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801dbe:	eb 38                	jmp    801df8 <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  801dc0:	83 ec 0c             	sub    $0xc,%esp
+  801dc3:	68 00 10 00 00       	push   $0x1000
+  801dc8:	89 f1                	mov    %esi,%ecx
+  801dca:	89 da                	mov    %ebx,%edx
+  801dcc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801dcf:	e8 34 fa ff ff       	call   801808 <devpipe_write_bulk>
+  801dd4:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801dd7:	83 c4 10             	add    $0x10,%esp
+  801dda:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801ddf:	75 53                	jne    801e34 <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  801de1:	83 ec 08             	sub    $0x8,%esp
+  801de4:	56                   	push   %esi
+  801de5:	6a 00                	push   $0x0
+  801de7:	e8 4f e4 ff ff       	call   80023b <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  801dec:	83 c7 01             	add    $0x1,%edi
+  801def:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801df5:	83 c4 10             	add    $0x10,%esp
+  801df8:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801dfb:	74 3a                	je     801e37 <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  801dfd:	8b 03                	mov    (%ebx),%eax
+  801dff:	39 43 04             	cmp    %eax,0x4(%ebx)
+  801e02:	75 bc                	jne    801dc0 <pipe_splice+0x71>
+  801e04:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e09:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  801e0d:	85 c0                	test   %eax,%eax
+  801e0f:	74 af                	je     801dc0 <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  801e11:	83 ec 04             	sub    $0x4,%esp
+  801e14:	6a 07                	push   $0x7
+  801e16:	56                   	push   %esi
+  801e17:	ff 75 d0             	push   -0x30(%ebp)
+  801e1a:	e8 f3 e6 ff ff       	call   800512 <sys_chan_wakeup>
+  801e1f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801e22:	83 c4 10             	add    $0x10,%esp
+  801e25:	85 c0                	test   %eax,%eax
+  801e27:	79 b8                	jns    801de1 <pipe_splice+0x92>
+  801e29:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e2e:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  801e32:	eb 8c                	jmp    801dc0 <pipe_splice+0x71>
+  801e34:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  801e37:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801e3b:	75 06                	jne    801e43 <pipe_splice+0xf4>
+  801e3d:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  801e41:	78 09                	js     801e4c <pipe_splice+0xfd>
+  return i * PGSIZE;
+  801e43:	8b 45 10             	mov    0x10(%ebp),%eax
+  801e46:	c1 e0 0c             	shl    $0xc,%eax
+  801e49:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  801e4c:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801e4f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e52:	5b                   	pop    %ebx
+  801e53:	5e                   	pop    %esi
+  801e54:	5f                   	pop    %edi
+  801e55:	5d                   	pop    %ebp
+  801e56:	c3                   	ret
+    return -E_INVAL;
+  801e57:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  801e5e:	eb ec                	jmp    801e4c <pipe_splice+0xfd>
+  801e60:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  801e67:	eb e3                	jmp    801e4c <pipe_splice+0xfd>
+  801e69:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  801e70:	eb da                	jmp    801e4c <pipe_splice+0xfd>
+  801e72:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  801e79:	eb d1                	jmp    801e4c <pipe_splice+0xfd>
+
+00801e7b <pipe_splice_read>:
+{
+  801e7b:	55                   	push   %ebp
+  801e7c:	89 e5                	mov    %esp,%ebp
+  801e7e:	53                   	push   %ebx
+  801e7f:	83 ec 1c             	sub    $0x1c,%esp
+  801e82:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801e85:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e88:	50                   	push   %eax
+  801e89:	ff 75 08             	push   0x8(%ebp)
+  801e8c:	e8 4e e8 ff ff       	call   8006df <fd_lookup>
+  801e91:	83 c4 10             	add    $0x10,%esp
+  801e94:	85 c0                	test   %eax,%eax
+  801e96:	78 49                	js     801ee1 <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  801e98:	83 ec 0c             	sub    $0xc,%esp
+  801e9b:	ff 75 f4             	push   -0xc(%ebp)
+  801e9e:	e8 d2 e7 ff ff       	call   800675 <fd2data>
+  801ea3:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  801ea5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ea8:	83 c4 10             	add    $0x10,%esp
+  801eab:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  801eb1:	39 08                	cmp    %ecx,(%eax)
+  801eb3:	75 31                	jne    801ee6 <pipe_splice_read+0x6b>
+  801eb5:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  801eb9:	74 32                	je     801eed <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  801ebb:	8b 48 08             	mov    0x8(%eax),%ecx
+  801ebe:	83 e1 03             	and    $0x3,%ecx
+  801ec1:	83 f9 01             	cmp    $0x1,%ecx
+  801ec4:	74 2e                	je     801ef4 <pipe_splice_read+0x79>
+  801ec6:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  801ecc:	75 2d                	jne    801efb <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  801ece:	83 ec 08             	sub    $0x8,%esp
+  801ed1:	53                   	push   %ebx
+  801ed2:	68 00 10 00 00       	push   $0x1000
+  801ed7:	89 d9                	mov    %ebx,%ecx
+  801ed9:	e8 93 fa ff ff       	call   801971 <devpipe_read_bulk>
+  801ede:	83 c4 10             	add    $0x10,%esp
+}
+  801ee1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ee4:	c9                   	leave
+  801ee5:	c3                   	ret
+    return -E_INVAL;
+  801ee6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801eeb:	eb f4                	jmp    801ee1 <pipe_splice_read+0x66>
+  801eed:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ef2:	eb ed                	jmp    801ee1 <pipe_splice_read+0x66>
+  801ef4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ef9:	eb e6                	jmp    801ee1 <pipe_splice_read+0x66>
+  801efb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f00:	eb df                	jmp    801ee1 <pipe_splice_read+0x66>
+
+00801f02 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  801f02:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f07:	c3                   	ret
+
+00801f08 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  801f08:	55                   	push   %ebp
+  801f09:	89 e5                	mov    %esp,%ebp
+  801f0b:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  801f0e:	68 b3 2f 80 00       	push   $0x802fb3
+  801f13:	ff 75 0c             	push   0xc(%ebp)
+  801f16:	e8 24 08 00 00       	call   80273f <strcpy>
+  return 0;
+}
+  801f1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f20:	c9                   	leave
+  801f21:	c3                   	ret
+
+00801f22 <devcons_write>:
+{
+  801f22:	55                   	push   %ebp
+  801f23:	89 e5                	mov    %esp,%ebp
+  801f25:	57                   	push   %edi
+  801f26:	56                   	push   %esi
+  801f27:	53                   	push   %ebx
+  801f28:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  801f2e:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  801f33:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  801f39:	eb 2e                	jmp    801f69 <devcons_write+0x47>
+    m = n - tot;
+  801f3b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f3e:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  801f40:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801f45:	39 c3                	cmp    %eax,%ebx
+  801f47:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  801f4a:	83 ec 04             	sub    $0x4,%esp
+  801f4d:	53                   	push   %ebx
+  801f4e:	89 f0                	mov    %esi,%eax
+  801f50:	03 45 0c             	add    0xc(%ebp),%eax
+  801f53:	50                   	push   %eax
+  801f54:	57                   	push   %edi
+  801f55:	e8 6b 09 00 00       	call   8028c5 <memmove>
+    sys_cputs(buf, m);
+  801f5a:	83 c4 08             	add    $0x8,%esp
+  801f5d:	53                   	push   %ebx
+  801f5e:	57                   	push   %edi
+  801f5f:	e8 53 e1 ff ff       	call   8000b7 <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  801f64:	01 de                	add    %ebx,%esi
+  801f66:	83 c4 10             	add    $0x10,%esp
+  801f69:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801f6c:	72 cd                	jb     801f3b <devcons_write+0x19>
+}
+  801f6e:	89 f0                	mov    %esi,%eax
+  801f70:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f73:	5b                   	pop    %ebx
+  801f74:	5e                   	pop    %esi
+  801f75:	5f                   	pop    %edi
+  801f76:	5d                   	pop    %ebp
+  801f77:	c3                   	ret
+
+00801f78 <devcons_read>:
+{
+  801f78:	55                   	push   %ebp
+  801f79:	89 e5                	mov    %esp,%ebp
+  801f7b:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  801f7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f83:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801f87:	75 07                	jne    801f90 <devcons_read+0x18>
+  801f89:	eb 1f                	jmp    801faa <devcons_read+0x32>
+    sys_yield();
+  801f8b:	e8 c4 e1 ff ff       	call   800154 <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  801f90:	e8 40 e1 ff ff       	call   8000d5 <sys_cgetc>
+  801f95:	85 c0                	test   %eax,%eax
+  801f97:	74 f2                	je     801f8b <devcons_read+0x13>
+  if (c < 0)
+  801f99:	78 0f                	js     801faa <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  801f9b:	83 f8 04             	cmp    $0x4,%eax
+  801f9e:	74 0c                	je     801fac <devcons_read+0x34>
+  *(char*)vbuf = c;
+  801fa0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801fa3:	88 02                	mov    %al,(%edx)
+  return 1;
+  801fa5:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  801faa:	c9                   	leave
+  801fab:	c3                   	ret
+    return 0;
+  801fac:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fb1:	eb f7                	jmp    801faa <devcons_read+0x32>
+
+00801fb3 <cputchar>:
+{
+  801fb3:	55                   	push   %ebp
+  801fb4:	89 e5                	mov    %esp,%ebp
+  801fb6:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  801fb9:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fbc:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  801fbf:	6a 01                	push   $0x1
+  801fc1:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801fc4:	50                   	push   %eax
+  801fc5:	e8 ed e0 ff ff       	call   8000b7 <sys_cputs>
+}
+  801fca:	83 c4 10             	add    $0x10,%esp
+  801fcd:	c9                   	leave
+  801fce:	c3                   	ret
+
+00801fcf <getchar>:
+{
+  801fcf:	55                   	push   %ebp
+  801fd0:	89 e5                	mov    %esp,%ebp
+  801fd2:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  801fd5:	6a 01                	push   $0x1
+  801fd7:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801fda:	50                   	push   %eax
+  801fdb:	6a 00                	push   $0x0
+  801fdd:	e8 a8 e9 ff ff       	call   80098a <read>
+  if (r < 0)
+  801fe2:	83 c4 10             	add    $0x10,%esp
+  801fe5:	85 c0                	test   %eax,%eax
+  801fe7:	78 06                	js     801fef <getchar+0x20>
+  if (r < 1)
+  801fe9:	74 06                	je     801ff1 <getchar+0x22>
+  return c;
+  801feb:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  801fef:	c9                   	leave
+  801ff0:	c3                   	ret
+    return -E_EOF;
+  801ff1:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  801ff6:	eb f7                	jmp    801fef <getchar+0x20>
+
+00801ff8 <iscons>:
+{
+  801ff8:	55                   	push   %ebp
+  801ff9:	89 e5                	mov    %esp,%ebp
+  801ffb:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801ffe:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802001:	50                   	push   %eax
+  802002:	ff 75 08             	push   0x8(%ebp)
+  802005:	e8 d5 e6 ff ff       	call   8006df <fd_lookup>
+  80200a:	83 c4 10             	add    $0x10,%esp
+  80200d:	85 c0                	test   %eax,%eax
+  80200f:	78 11                	js     802022 <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  802011:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802014:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  80201a:	39 10                	cmp    %edx,(%eax)
+  80201c:	0f 94 c0             	sete   %al
+  80201f:	0f b6 c0             	movzbl %al,%eax
+}
+  802022:	c9                   	leave
+  802023:	c3                   	ret
+
+00802024 <opencons>:
+{
+  802024:	55                   	push   %ebp
+  802025:	89 e5                	mov    %esp,%ebp
+  802027:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  80202a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80202d:	50                   	push   %eax
+  80202e:	e8 56 e6 ff ff       	call   800689 <fd_alloc>
+  802033:	83 c4 10             	add    $0x10,%esp
+  802036:	85 c0                	test   %eax,%eax
+  802038:	78 3a                	js     802074 <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80203a:	83 ec 04             	sub    $0x4,%esp
+  80203d:	68 07 04 00 00       	push   $0x407
+  802042:	ff 75 f4             	push   -0xc(%ebp)
+  802045:	6a 00                	push   $0x0
+  802047:	e8 6a e1 ff ff       	call   8001b6 <sys_page_alloc>
+  80204c:	83 c4 10             	add    $0x10,%esp
+  80204f:	85 c0                	test   %eax,%eax
+  802051:	78 21                	js     802074 <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  802053:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802056:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  80205c:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  80205e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802061:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  802068:	83 ec 0c             	sub    $0xc,%esp
+  80206b:	50                   	push   %eax
+  80206c:	e8 f4 e5 ff ff       	call   800665 <fd2num>
+  802071:	83 c4 10             	add    $0x10,%esp
+}
+  802074:	c9                   	leave
+  802075:	c3                   	ret
+
+00802076 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  802076:	55                   	push   %ebp
+  802077:	89 e5                	mov    %esp,%ebp
+  802079:	56                   	push   %esi
+  80207a:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  80207b:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  80207e:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  802084:	e8 ac e0 ff ff       	call   800135 <sys_getenvid>
+  802089:	83 ec 0c             	sub    $0xc,%esp
+  80208c:	ff 75 0c             	push   0xc(%ebp)
+  80208f:	ff 75 08             	push   0x8(%ebp)
+  802092:	56                   	push   %esi
+  802093:	50                   	push   %eax
+  802094:	68 c0 2f 80 00       	push   $0x802fc0
+  802099:	e8 b3 00 00 00       	call   802151 <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  80209e:	83 c4 18             	add    $0x18,%esp
+  8020a1:	53                   	push   %ebx
+  8020a2:	ff 75 10             	push   0x10(%ebp)
+  8020a5:	e8 56 00 00 00       	call   802100 <vcprintf>
+  cprintf("\n");
+  8020aa:	c7 04 24 ac 2f 80 00 	movl   $0x802fac,(%esp)
+  8020b1:	e8 9b 00 00 00       	call   802151 <cprintf>
+  8020b6:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  8020b9:	cc                   	int3
+  while (1)
+  8020ba:	eb fd                	jmp    8020b9 <_panic+0x43>
+
+008020bc <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8020bc:	55                   	push   %ebp
+  8020bd:	89 e5                	mov    %esp,%ebp
+  8020bf:	53                   	push   %ebx
+  8020c0:	83 ec 04             	sub    $0x4,%esp
+  8020c3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  8020c6:	8b 13                	mov    (%ebx),%edx
+  8020c8:	8d 42 01             	lea    0x1(%edx),%eax
+  8020cb:	89 03                	mov    %eax,(%ebx)
+  8020cd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8020d0:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  8020d4:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8020d9:	74 09                	je     8020e4 <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  8020db:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8020df:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020e2:	c9                   	leave
+  8020e3:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  8020e4:	83 ec 08             	sub    $0x8,%esp
+  8020e7:	68 ff 00 00 00       	push   $0xff
+  8020ec:	8d 43 08             	lea    0x8(%ebx),%eax
+  8020ef:	50                   	push   %eax
+  8020f0:	e8 c2 df ff ff       	call   8000b7 <sys_cputs>
+    b->idx = 0;
+  8020f5:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8020fb:	83 c4 10             	add    $0x10,%esp
+  8020fe:	eb db                	jmp    8020db <putch+0x1f>
+
+00802100 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  802100:	55                   	push   %ebp
+  802101:	89 e5                	mov    %esp,%ebp
+  802103:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  802109:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  802110:	00 00 00 
+  b.cnt = 0;
+  802113:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80211a:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  80211d:	ff 75 0c             	push   0xc(%ebp)
+  802120:	ff 75 08             	push   0x8(%ebp)
+  802123:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  802129:	50                   	push   %eax
+  80212a:	68 bc 20 80 00       	push   $0x8020bc
+  80212f:	e8 14 01 00 00       	call   802248 <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  802134:	83 c4 08             	add    $0x8,%esp
+  802137:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80213d:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  802143:	50                   	push   %eax
+  802144:	e8 6e df ff ff       	call   8000b7 <sys_cputs>
+
+  return b.cnt;
+}
+  802149:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80214f:	c9                   	leave
+  802150:	c3                   	ret
+
+00802151 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  802151:	55                   	push   %ebp
+  802152:	89 e5                	mov    %esp,%ebp
+  802154:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  802157:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  80215a:	50                   	push   %eax
+  80215b:	ff 75 08             	push   0x8(%ebp)
+  80215e:	e8 9d ff ff ff       	call   802100 <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  802163:	c9                   	leave
+  802164:	c3                   	ret
+
+00802165 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  802165:	55                   	push   %ebp
+  802166:	89 e5                	mov    %esp,%ebp
+  802168:	57                   	push   %edi
+  802169:	56                   	push   %esi
+  80216a:	53                   	push   %ebx
+  80216b:	83 ec 1c             	sub    $0x1c,%esp
+  80216e:	89 c7                	mov    %eax,%edi
+  802170:	89 d6                	mov    %edx,%esi
+  802172:	8b 45 08             	mov    0x8(%ebp),%eax
+  802175:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802178:	89 d1                	mov    %edx,%ecx
+  80217a:	89 c2                	mov    %eax,%edx
+  80217c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80217f:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802182:	8b 45 10             	mov    0x10(%ebp),%eax
+  802185:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  802188:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80218b:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  802192:	39 c2                	cmp    %eax,%edx
+  802194:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  802197:	72 3e                	jb     8021d7 <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  802199:	83 ec 0c             	sub    $0xc,%esp
+  80219c:	ff 75 18             	push   0x18(%ebp)
+  80219f:	83 eb 01             	sub    $0x1,%ebx
+  8021a2:	53                   	push   %ebx
+  8021a3:	50                   	push   %eax
+  8021a4:	83 ec 08             	sub    $0x8,%esp
+  8021a7:	ff 75 e4             	push   -0x1c(%ebp)
+  8021aa:	ff 75 e0             	push   -0x20(%ebp)
+  8021ad:	ff 75 dc             	push   -0x24(%ebp)
+  8021b0:	ff 75 d8             	push   -0x28(%ebp)
+  8021b3:	e8 1c 0b 00 00       	call   802cd4 <__udivdi3>
+  8021b8:	83 c4 18             	add    $0x18,%esp
+  8021bb:	52                   	push   %edx
+  8021bc:	50                   	push   %eax
+  8021bd:	89 f2                	mov    %esi,%edx
+  8021bf:	89 f8                	mov    %edi,%eax
+  8021c1:	e8 9f ff ff ff       	call   802165 <printnum>
+  8021c6:	83 c4 20             	add    $0x20,%esp
+  8021c9:	eb 13                	jmp    8021de <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  8021cb:	83 ec 08             	sub    $0x8,%esp
+  8021ce:	56                   	push   %esi
+  8021cf:	ff 75 18             	push   0x18(%ebp)
+  8021d2:	ff d7                	call   *%edi
+  8021d4:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  8021d7:	83 eb 01             	sub    $0x1,%ebx
+  8021da:	85 db                	test   %ebx,%ebx
+  8021dc:	7f ed                	jg     8021cb <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  8021de:	83 ec 08             	sub    $0x8,%esp
+  8021e1:	56                   	push   %esi
+  8021e2:	83 ec 04             	sub    $0x4,%esp
+  8021e5:	ff 75 e4             	push   -0x1c(%ebp)
+  8021e8:	ff 75 e0             	push   -0x20(%ebp)
+  8021eb:	ff 75 dc             	push   -0x24(%ebp)
+  8021ee:	ff 75 d8             	push   -0x28(%ebp)
+  8021f1:	e8 ff 0a 00 00       	call   802cf5 <__umoddi3>
+  8021f6:	83 c4 14             	add    $0x14,%esp
+  8021f9:	0f be 80 e3 2f 80 00 	movsbl 0x802fe3(%eax),%eax
+  802200:	50                   	push   %eax
+  802201:	ff d7                	call   *%edi
+}
+  802203:	83 c4 10             	add    $0x10,%esp
+  802206:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802209:	5b                   	pop    %ebx
+  80220a:	5e                   	pop    %esi
+  80220b:	5f                   	pop    %edi
+  80220c:	5d                   	pop    %ebp
+  80220d:	c3                   	ret
+
+0080220e <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80220e:	55                   	push   %ebp
+  80220f:	89 e5                	mov    %esp,%ebp
+  802211:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  802214:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  802218:	8b 10                	mov    (%eax),%edx
+  80221a:	3b 50 04             	cmp    0x4(%eax),%edx
+  80221d:	73 0a                	jae    802229 <sprintputch+0x1b>
+    *b->buf++ = ch;
+  80221f:	8d 4a 01             	lea    0x1(%edx),%ecx
+  802222:	89 08                	mov    %ecx,(%eax)
+  802224:	8b 45 08             	mov    0x8(%ebp),%eax
+  802227:	88 02                	mov    %al,(%edx)
+}
+  802229:	5d                   	pop    %ebp
+  80222a:	c3                   	ret
+
+0080222b <printfmt>:
+{
+  80222b:	55                   	push   %ebp
+  80222c:	89 e5                	mov    %esp,%ebp
+  80222e:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  802231:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  802234:	50                   	push   %eax
+  802235:	ff 75 10             	push   0x10(%ebp)
+  802238:	ff 75 0c             	push   0xc(%ebp)
+  80223b:	ff 75 08             	push   0x8(%ebp)
+  80223e:	e8 05 00 00 00       	call   802248 <vprintfmt>
+}
+  802243:	83 c4 10             	add    $0x10,%esp
+  802246:	c9                   	leave
+  802247:	c3                   	ret
+
+00802248 <vprintfmt>:
+{
+  802248:	55                   	push   %ebp
+  802249:	89 e5                	mov    %esp,%ebp
+  80224b:	57                   	push   %edi
+  80224c:	56                   	push   %esi
+  80224d:	53                   	push   %ebx
+  80224e:	83 ec 2c             	sub    $0x2c,%esp
+  802251:	8b 75 08             	mov    0x8(%ebp),%esi
+  802254:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802257:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80225a:	eb 0a                	jmp    802266 <vprintfmt+0x1e>
+      putch(ch, putdat);
+  80225c:	83 ec 08             	sub    $0x8,%esp
+  80225f:	53                   	push   %ebx
+  802260:	50                   	push   %eax
+  802261:	ff d6                	call   *%esi
+  802263:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  802266:	83 c7 01             	add    $0x1,%edi
+  802269:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80226d:	83 f8 25             	cmp    $0x25,%eax
+  802270:	74 0c                	je     80227e <vprintfmt+0x36>
+      if (ch == '\0')
+  802272:	85 c0                	test   %eax,%eax
+  802274:	75 e6                	jne    80225c <vprintfmt+0x14>
+}
+  802276:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802279:	5b                   	pop    %ebx
+  80227a:	5e                   	pop    %esi
+  80227b:	5f                   	pop    %edi
+  80227c:	5d                   	pop    %ebp
+  80227d:	c3                   	ret
+    padc = ' ';
+  80227e:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  802282:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  802289:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  802290:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  802297:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  80229c:	8d 47 01             	lea    0x1(%edi),%eax
+  80229f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8022a2:	0f b6 17             	movzbl (%edi),%edx
+  8022a5:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8022a8:	3c 55                	cmp    $0x55,%al
+  8022aa:	0f 87 cf 03 00 00    	ja     80267f <vprintfmt+0x437>
+  8022b0:	0f b6 c0             	movzbl %al,%eax
+  8022b3:	ff 24 85 20 31 80 00 	jmp    *0x803120(,%eax,4)
+  8022ba:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  8022bd:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8022c1:	eb d9                	jmp    80229c <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  8022c3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8022c6:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8022ca:	eb d0                	jmp    80229c <vprintfmt+0x54>
+  8022cc:	0f b6 d2             	movzbl %dl,%edx
+  8022cf:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  8022d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022d7:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  8022da:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8022dd:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  8022e1:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  8022e4:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8022e7:	83 f9 09             	cmp    $0x9,%ecx
+  8022ea:	77 55                	ja     802341 <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  8022ec:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  8022ef:	eb e9                	jmp    8022da <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  8022f1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8022f4:	8b 00                	mov    (%eax),%eax
+  8022f6:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8022f9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8022fc:	8d 40 04             	lea    0x4(%eax),%eax
+  8022ff:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  802302:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  802305:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  802309:	79 91                	jns    80229c <vprintfmt+0x54>
+        width = precision, precision = -1;
+  80230b:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80230e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802311:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  802318:	eb 82                	jmp    80229c <vprintfmt+0x54>
+      if (width < 0)
+  80231a:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80231d:	85 d2                	test   %edx,%edx
+  80231f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802324:	0f 49 c2             	cmovns %edx,%eax
+  802327:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  80232a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  80232d:	e9 6a ff ff ff       	jmp    80229c <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  802332:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  802335:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  80233c:	e9 5b ff ff ff       	jmp    80229c <vprintfmt+0x54>
+  802341:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802344:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802347:	eb bc                	jmp    802305 <vprintfmt+0xbd>
+      lflag++;
+  802349:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  80234c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  80234f:	e9 48 ff ff ff       	jmp    80229c <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  802354:	8b 45 14             	mov    0x14(%ebp),%eax
+  802357:	8d 78 04             	lea    0x4(%eax),%edi
+  80235a:	83 ec 08             	sub    $0x8,%esp
+  80235d:	53                   	push   %ebx
+  80235e:	ff 30                	push   (%eax)
+  802360:	ff d6                	call   *%esi
+      break;
+  802362:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  802365:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  802368:	e9 b1 02 00 00       	jmp    80261e <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  80236d:	8b 45 14             	mov    0x14(%ebp),%eax
+  802370:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  802373:	8b 10                	mov    (%eax),%edx
+  802375:	89 d0                	mov    %edx,%eax
+  802377:	f7 d8                	neg    %eax
+  802379:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80237c:	83 f8 10             	cmp    $0x10,%eax
+  80237f:	7f 23                	jg     8023a4 <vprintfmt+0x15c>
+  802381:	8b 14 85 80 32 80 00 	mov    0x803280(,%eax,4),%edx
+  802388:	85 d2                	test   %edx,%edx
+  80238a:	74 18                	je     8023a4 <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  80238c:	52                   	push   %edx
+  80238d:	68 56 2f 80 00       	push   $0x802f56
+  802392:	53                   	push   %ebx
+  802393:	56                   	push   %esi
+  802394:	e8 92 fe ff ff       	call   80222b <printfmt>
+  802399:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  80239c:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80239f:	e9 7a 02 00 00       	jmp    80261e <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  8023a4:	50                   	push   %eax
+  8023a5:	68 fb 2f 80 00       	push   $0x802ffb
+  8023aa:	53                   	push   %ebx
+  8023ab:	56                   	push   %esi
+  8023ac:	e8 7a fe ff ff       	call   80222b <printfmt>
+  8023b1:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  8023b4:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  8023b7:	e9 62 02 00 00       	jmp    80261e <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  8023bc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8023bf:	83 c0 04             	add    $0x4,%eax
+  8023c2:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8023c5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8023c8:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  8023ca:	85 c9                	test   %ecx,%ecx
+  8023cc:	b8 f4 2f 80 00       	mov    $0x802ff4,%eax
+  8023d1:	0f 45 c1             	cmovne %ecx,%eax
+  8023d4:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  8023d7:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8023db:	7e 06                	jle    8023e3 <vprintfmt+0x19b>
+  8023dd:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8023e1:	75 0b                	jne    8023ee <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8023e3:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8023e6:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8023e9:	89 75 08             	mov    %esi,0x8(%ebp)
+  8023ec:	eb 5c                	jmp    80244a <vprintfmt+0x202>
+  8023ee:	83 ec 08             	sub    $0x8,%esp
+  8023f1:	ff 75 d0             	push   -0x30(%ebp)
+  8023f4:	ff 75 cc             	push   -0x34(%ebp)
+  8023f7:	e8 20 03 00 00       	call   80271c <strnlen>
+  8023fc:	89 c2                	mov    %eax,%edx
+  8023fe:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802401:	29 d0                	sub    %edx,%eax
+  802403:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  802406:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80240a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80240d:	89 75 08             	mov    %esi,0x8(%ebp)
+  802410:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  802412:	eb 0e                	jmp    802422 <vprintfmt+0x1da>
+          putch(padc, putdat);
+  802414:	83 ec 08             	sub    $0x8,%esp
+  802417:	53                   	push   %ebx
+  802418:	57                   	push   %edi
+  802419:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  80241c:	83 ee 01             	sub    $0x1,%esi
+  80241f:	83 c4 10             	add    $0x10,%esp
+  802422:	85 f6                	test   %esi,%esi
+  802424:	7f ee                	jg     802414 <vprintfmt+0x1cc>
+  802426:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802429:	8b 75 08             	mov    0x8(%ebp),%esi
+  80242c:	85 c0                	test   %eax,%eax
+  80242e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802433:	0f 49 d0             	cmovns %eax,%edx
+  802436:	29 d0                	sub    %edx,%eax
+  802438:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80243b:	eb a6                	jmp    8023e3 <vprintfmt+0x19b>
+          putch(ch, putdat);
+  80243d:	83 ec 08             	sub    $0x8,%esp
+  802440:	53                   	push   %ebx
+  802441:	52                   	push   %edx
+  802442:	ff 55 08             	call   *0x8(%ebp)
+  802445:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  802448:	89 f1                	mov    %esi,%ecx
+  80244a:	8d 71 01             	lea    0x1(%ecx),%esi
+  80244d:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  802451:	0f be d0             	movsbl %al,%edx
+  802454:	85 d2                	test   %edx,%edx
+  802456:	74 28                	je     802480 <vprintfmt+0x238>
+  802458:	85 ff                	test   %edi,%edi
+  80245a:	78 05                	js     802461 <vprintfmt+0x219>
+  80245c:	83 ef 01             	sub    $0x1,%edi
+  80245f:	78 30                	js     802491 <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  802461:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  802465:	74 d6                	je     80243d <vprintfmt+0x1f5>
+  802467:	0f be c0             	movsbl %al,%eax
+  80246a:	83 e8 20             	sub    $0x20,%eax
+  80246d:	83 f8 5e             	cmp    $0x5e,%eax
+  802470:	76 cb                	jbe    80243d <vprintfmt+0x1f5>
+          putch('?', putdat);
+  802472:	83 ec 08             	sub    $0x8,%esp
+  802475:	53                   	push   %ebx
+  802476:	6a 3f                	push   $0x3f
+  802478:	ff 55 08             	call   *0x8(%ebp)
+  80247b:	83 c4 10             	add    $0x10,%esp
+  80247e:	eb c8                	jmp    802448 <vprintfmt+0x200>
+  802480:	8b 75 08             	mov    0x8(%ebp),%esi
+  802483:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802486:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802489:	01 d0                	add    %edx,%eax
+  80248b:	29 c8                	sub    %ecx,%eax
+  80248d:	89 c7                	mov    %eax,%edi
+  80248f:	eb 13                	jmp    8024a4 <vprintfmt+0x25c>
+  802491:	8b 75 08             	mov    0x8(%ebp),%esi
+  802494:	eb ed                	jmp    802483 <vprintfmt+0x23b>
+        putch(' ', putdat);
+  802496:	83 ec 08             	sub    $0x8,%esp
+  802499:	53                   	push   %ebx
+  80249a:	6a 20                	push   $0x20
+  80249c:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  80249e:	83 ef 01             	sub    $0x1,%edi
+  8024a1:	83 c4 10             	add    $0x10,%esp
+  8024a4:	85 ff                	test   %edi,%edi
+  8024a6:	7f ee                	jg     802496 <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  8024a8:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8024ab:	89 45 14             	mov    %eax,0x14(%ebp)
+  8024ae:	e9 6b 01 00 00       	jmp    80261e <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  8024b3:	83 f9 01             	cmp    $0x1,%ecx
+  8024b6:	7f 1f                	jg     8024d7 <vprintfmt+0x28f>
+  else if (lflag)
+  8024b8:	85 c9                	test   %ecx,%ecx
+  8024ba:	74 67                	je     802523 <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  8024bc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024bf:	8b 00                	mov    (%eax),%eax
+  8024c1:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8024c4:	89 c1                	mov    %eax,%ecx
+  8024c6:	c1 f9 1f             	sar    $0x1f,%ecx
+  8024c9:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8024cc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024cf:	8d 40 04             	lea    0x4(%eax),%eax
+  8024d2:	89 45 14             	mov    %eax,0x14(%ebp)
+  8024d5:	eb 17                	jmp    8024ee <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  8024d7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024da:	8b 50 04             	mov    0x4(%eax),%edx
+  8024dd:	8b 00                	mov    (%eax),%eax
+  8024df:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8024e2:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8024e5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024e8:	8d 40 08             	lea    0x8(%eax),%eax
+  8024eb:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  8024ee:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8024f1:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  8024f4:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  8024f9:	85 c9                	test   %ecx,%ecx
+  8024fb:	0f 89 03 01 00 00    	jns    802604 <vprintfmt+0x3bc>
+        putch('-', putdat);
+  802501:	83 ec 08             	sub    $0x8,%esp
+  802504:	53                   	push   %ebx
+  802505:	6a 2d                	push   $0x2d
+  802507:	ff d6                	call   *%esi
+        num = -(long long)num;
+  802509:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80250c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80250f:	f7 da                	neg    %edx
+  802511:	83 d1 00             	adc    $0x0,%ecx
+  802514:	f7 d9                	neg    %ecx
+  802516:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  802519:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80251e:	e9 e1 00 00 00       	jmp    802604 <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  802523:	8b 45 14             	mov    0x14(%ebp),%eax
+  802526:	8b 00                	mov    (%eax),%eax
+  802528:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80252b:	89 c1                	mov    %eax,%ecx
+  80252d:	c1 f9 1f             	sar    $0x1f,%ecx
+  802530:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802533:	8b 45 14             	mov    0x14(%ebp),%eax
+  802536:	8d 40 04             	lea    0x4(%eax),%eax
+  802539:	89 45 14             	mov    %eax,0x14(%ebp)
+  80253c:	eb b0                	jmp    8024ee <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  80253e:	83 f9 01             	cmp    $0x1,%ecx
+  802541:	7f 1e                	jg     802561 <vprintfmt+0x319>
+  else if (lflag)
+  802543:	85 c9                	test   %ecx,%ecx
+  802545:	74 32                	je     802579 <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  802547:	8b 45 14             	mov    0x14(%ebp),%eax
+  80254a:	8b 10                	mov    (%eax),%edx
+  80254c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802551:	8d 40 04             	lea    0x4(%eax),%eax
+  802554:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  802557:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  80255c:	e9 a3 00 00 00       	jmp    802604 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  802561:	8b 45 14             	mov    0x14(%ebp),%eax
+  802564:	8b 10                	mov    (%eax),%edx
+  802566:	8b 48 04             	mov    0x4(%eax),%ecx
+  802569:	8d 40 08             	lea    0x8(%eax),%eax
+  80256c:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  80256f:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  802574:	e9 8b 00 00 00       	jmp    802604 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  802579:	8b 45 14             	mov    0x14(%ebp),%eax
+  80257c:	8b 10                	mov    (%eax),%edx
+  80257e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802583:	8d 40 04             	lea    0x4(%eax),%eax
+  802586:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  802589:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  80258e:	eb 74                	jmp    802604 <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  802590:	83 f9 01             	cmp    $0x1,%ecx
+  802593:	7f 1b                	jg     8025b0 <vprintfmt+0x368>
+  else if (lflag)
+  802595:	85 c9                	test   %ecx,%ecx
+  802597:	74 2c                	je     8025c5 <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  802599:	8b 45 14             	mov    0x14(%ebp),%eax
+  80259c:	8b 10                	mov    (%eax),%edx
+  80259e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025a3:	8d 40 04             	lea    0x4(%eax),%eax
+  8025a6:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8025a9:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  8025ae:	eb 54                	jmp    802604 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  8025b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8025b3:	8b 10                	mov    (%eax),%edx
+  8025b5:	8b 48 04             	mov    0x4(%eax),%ecx
+  8025b8:	8d 40 08             	lea    0x8(%eax),%eax
+  8025bb:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8025be:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  8025c3:	eb 3f                	jmp    802604 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8025c5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8025c8:	8b 10                	mov    (%eax),%edx
+  8025ca:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025cf:	8d 40 04             	lea    0x4(%eax),%eax
+  8025d2:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8025d5:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  8025da:	eb 28                	jmp    802604 <vprintfmt+0x3bc>
+      putch('0', putdat);
+  8025dc:	83 ec 08             	sub    $0x8,%esp
+  8025df:	53                   	push   %ebx
+  8025e0:	6a 30                	push   $0x30
+  8025e2:	ff d6                	call   *%esi
+      putch('x', putdat);
+  8025e4:	83 c4 08             	add    $0x8,%esp
+  8025e7:	53                   	push   %ebx
+  8025e8:	6a 78                	push   $0x78
+  8025ea:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  8025ec:	8b 45 14             	mov    0x14(%ebp),%eax
+  8025ef:	8b 10                	mov    (%eax),%edx
+  8025f1:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  8025f6:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  8025f9:	8d 40 04             	lea    0x4(%eax),%eax
+  8025fc:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8025ff:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  802604:	83 ec 0c             	sub    $0xc,%esp
+  802607:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80260b:	50                   	push   %eax
+  80260c:	ff 75 e0             	push   -0x20(%ebp)
+  80260f:	57                   	push   %edi
+  802610:	51                   	push   %ecx
+  802611:	52                   	push   %edx
+  802612:	89 da                	mov    %ebx,%edx
+  802614:	89 f0                	mov    %esi,%eax
+  802616:	e8 4a fb ff ff       	call   802165 <printnum>
+      break;
+  80261b:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  80261e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  802621:	e9 40 fc ff ff       	jmp    802266 <vprintfmt+0x1e>
+  if (lflag >= 2)
+  802626:	83 f9 01             	cmp    $0x1,%ecx
+  802629:	7f 1b                	jg     802646 <vprintfmt+0x3fe>
+  else if (lflag)
+  80262b:	85 c9                	test   %ecx,%ecx
+  80262d:	74 2c                	je     80265b <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  80262f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802632:	8b 10                	mov    (%eax),%edx
+  802634:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802639:	8d 40 04             	lea    0x4(%eax),%eax
+  80263c:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  80263f:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  802644:	eb be                	jmp    802604 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  802646:	8b 45 14             	mov    0x14(%ebp),%eax
+  802649:	8b 10                	mov    (%eax),%edx
+  80264b:	8b 48 04             	mov    0x4(%eax),%ecx
+  80264e:	8d 40 08             	lea    0x8(%eax),%eax
+  802651:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  802654:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  802659:	eb a9                	jmp    802604 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  80265b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80265e:	8b 10                	mov    (%eax),%edx
+  802660:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802665:	8d 40 04             	lea    0x4(%eax),%eax
+  802668:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  80266b:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  802670:	eb 92                	jmp    802604 <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  802672:	83 ec 08             	sub    $0x8,%esp
+  802675:	53                   	push   %ebx
+  802676:	6a 25                	push   $0x25
+  802678:	ff d6                	call   *%esi
+      break;
+  80267a:	83 c4 10             	add    $0x10,%esp
+  80267d:	eb 9f                	jmp    80261e <vprintfmt+0x3d6>
+      putch('%', putdat);
+  80267f:	83 ec 08             	sub    $0x8,%esp
+  802682:	53                   	push   %ebx
+  802683:	6a 25                	push   $0x25
+  802685:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  802687:	83 c4 10             	add    $0x10,%esp
+  80268a:	89 f8                	mov    %edi,%eax
+  80268c:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  802690:	74 05                	je     802697 <vprintfmt+0x44f>
+  802692:	83 e8 01             	sub    $0x1,%eax
+  802695:	eb f5                	jmp    80268c <vprintfmt+0x444>
+  802697:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80269a:	eb 82                	jmp    80261e <vprintfmt+0x3d6>
+
+0080269c <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80269c:	55                   	push   %ebp
+  80269d:	89 e5                	mov    %esp,%ebp
+  80269f:	83 ec 18             	sub    $0x18,%esp
+  8026a2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026a5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  8026a8:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8026ab:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8026af:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8026b2:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  8026b9:	85 c0                	test   %eax,%eax
+  8026bb:	74 26                	je     8026e3 <vsnprintf+0x47>
+  8026bd:	85 d2                	test   %edx,%edx
+  8026bf:	7e 22                	jle    8026e3 <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8026c1:	ff 75 14             	push   0x14(%ebp)
+  8026c4:	ff 75 10             	push   0x10(%ebp)
+  8026c7:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8026ca:	50                   	push   %eax
+  8026cb:	68 0e 22 80 00       	push   $0x80220e
+  8026d0:	e8 73 fb ff ff       	call   802248 <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  8026d5:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8026d8:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  8026db:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026de:	83 c4 10             	add    $0x10,%esp
+}
+  8026e1:	c9                   	leave
+  8026e2:	c3                   	ret
+    return -E_INVAL;
+  8026e3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026e8:	eb f7                	jmp    8026e1 <vsnprintf+0x45>
+
+008026ea <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8026ea:	55                   	push   %ebp
+  8026eb:	89 e5                	mov    %esp,%ebp
+  8026ed:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  8026f0:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  8026f3:	50                   	push   %eax
+  8026f4:	ff 75 10             	push   0x10(%ebp)
+  8026f7:	ff 75 0c             	push   0xc(%ebp)
+  8026fa:	ff 75 08             	push   0x8(%ebp)
+  8026fd:	e8 9a ff ff ff       	call   80269c <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  802702:	c9                   	leave
+  802703:	c3                   	ret
+
+00802704 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  802704:	55                   	push   %ebp
+  802705:	89 e5                	mov    %esp,%ebp
+  802707:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  80270a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80270f:	eb 03                	jmp    802714 <strlen+0x10>
+    n++;
+  802711:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  802714:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  802718:	75 f7                	jne    802711 <strlen+0xd>
+  return n;
+}
+  80271a:	5d                   	pop    %ebp
+  80271b:	c3                   	ret
+
+0080271c <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80271c:	55                   	push   %ebp
+  80271d:	89 e5                	mov    %esp,%ebp
+  80271f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  802722:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802725:	b8 00 00 00 00       	mov    $0x0,%eax
+  80272a:	eb 03                	jmp    80272f <strnlen+0x13>
+    n++;
+  80272c:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80272f:	39 d0                	cmp    %edx,%eax
+  802731:	74 08                	je     80273b <strnlen+0x1f>
+  802733:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  802737:	75 f3                	jne    80272c <strnlen+0x10>
+  802739:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  80273b:	89 d0                	mov    %edx,%eax
+  80273d:	5d                   	pop    %ebp
+  80273e:	c3                   	ret
+
+0080273f <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80273f:	55                   	push   %ebp
+  802740:	89 e5                	mov    %esp,%ebp
+  802742:	53                   	push   %ebx
+  802743:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802746:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  802749:	b8 00 00 00 00       	mov    $0x0,%eax
+  80274e:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  802752:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  802755:	83 c0 01             	add    $0x1,%eax
+  802758:	84 d2                	test   %dl,%dl
+  80275a:	75 f2                	jne    80274e <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  80275c:	89 c8                	mov    %ecx,%eax
+  80275e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802761:	c9                   	leave
+  802762:	c3                   	ret
+
+00802763 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  802763:	55                   	push   %ebp
+  802764:	89 e5                	mov    %esp,%ebp
+  802766:	53                   	push   %ebx
+  802767:	83 ec 10             	sub    $0x10,%esp
+  80276a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  80276d:	53                   	push   %ebx
+  80276e:	e8 91 ff ff ff       	call   802704 <strlen>
+  802773:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  802776:	ff 75 0c             	push   0xc(%ebp)
+  802779:	01 d8                	add    %ebx,%eax
+  80277b:	50                   	push   %eax
+  80277c:	e8 be ff ff ff       	call   80273f <strcpy>
+  return dst;
+}
+  802781:	89 d8                	mov    %ebx,%eax
+  802783:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802786:	c9                   	leave
+  802787:	c3                   	ret
+
+00802788 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  802788:	55                   	push   %ebp
+  802789:	89 e5                	mov    %esp,%ebp
+  80278b:	56                   	push   %esi
+  80278c:	53                   	push   %ebx
+  80278d:	8b 75 08             	mov    0x8(%ebp),%esi
+  802790:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  802793:	89 f3                	mov    %esi,%ebx
+  802795:	03 5d 10             	add    0x10(%ebp),%ebx
+  802798:	89 f0                	mov    %esi,%eax
+  80279a:	eb 0f                	jmp    8027ab <strncpy+0x23>
+    *dst++ = *src;
+  80279c:	83 c0 01             	add    $0x1,%eax
+  80279f:	0f b6 0a             	movzbl (%edx),%ecx
+  8027a2:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  8027a5:	80 f9 01             	cmp    $0x1,%cl
+  8027a8:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  8027ab:	39 d8                	cmp    %ebx,%eax
+  8027ad:	75 ed                	jne    80279c <strncpy+0x14>
+  }
+  return ret;
+}
+  8027af:	89 f0                	mov    %esi,%eax
+  8027b1:	5b                   	pop    %ebx
+  8027b2:	5e                   	pop    %esi
+  8027b3:	5d                   	pop    %ebp
+  8027b4:	c3                   	ret
+
+008027b5 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8027b5:	55                   	push   %ebp
+  8027b6:	89 e5                	mov    %esp,%ebp
+  8027b8:	56                   	push   %esi
+  8027b9:	53                   	push   %ebx
+  8027ba:	8b 75 08             	mov    0x8(%ebp),%esi
+  8027bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8027c0:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  8027c3:	89 f0                	mov    %esi,%eax
+  8027c5:	85 d2                	test   %edx,%edx
+  8027c7:	74 21                	je     8027ea <strlcpy+0x35>
+  8027c9:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8027cd:	89 f2                	mov    %esi,%edx
+  8027cf:	eb 09                	jmp    8027da <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  8027d1:	83 c1 01             	add    $0x1,%ecx
+  8027d4:	83 c2 01             	add    $0x1,%edx
+  8027d7:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  8027da:	39 c2                	cmp    %eax,%edx
+  8027dc:	74 09                	je     8027e7 <strlcpy+0x32>
+  8027de:	0f b6 19             	movzbl (%ecx),%ebx
+  8027e1:	84 db                	test   %bl,%bl
+  8027e3:	75 ec                	jne    8027d1 <strlcpy+0x1c>
+  8027e5:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  8027e7:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  8027ea:	29 f0                	sub    %esi,%eax
+}
+  8027ec:	5b                   	pop    %ebx
+  8027ed:	5e                   	pop    %esi
+  8027ee:	5d                   	pop    %ebp
+  8027ef:	c3                   	ret
+
+008027f0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8027f0:	55                   	push   %ebp
+  8027f1:	89 e5                	mov    %esp,%ebp
+  8027f3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8027f6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  8027f9:	eb 06                	jmp    802801 <strcmp+0x11>
+    p++, q++;
+  8027fb:	83 c1 01             	add    $0x1,%ecx
+  8027fe:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  802801:	0f b6 01             	movzbl (%ecx),%eax
+  802804:	84 c0                	test   %al,%al
+  802806:	74 04                	je     80280c <strcmp+0x1c>
+  802808:	3a 02                	cmp    (%edx),%al
+  80280a:	74 ef                	je     8027fb <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  80280c:	0f b6 c0             	movzbl %al,%eax
+  80280f:	0f b6 12             	movzbl (%edx),%edx
+  802812:	29 d0                	sub    %edx,%eax
+}
+  802814:	5d                   	pop    %ebp
+  802815:	c3                   	ret
+
+00802816 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  802816:	55                   	push   %ebp
+  802817:	89 e5                	mov    %esp,%ebp
+  802819:	53                   	push   %ebx
+  80281a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80281d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802820:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  802823:	eb 09                	jmp    80282e <strncmp+0x18>
+    n--, p++, q++;
+  802825:	83 ea 01             	sub    $0x1,%edx
+  802828:	83 c0 01             	add    $0x1,%eax
+  80282b:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  80282e:	85 d2                	test   %edx,%edx
+  802830:	74 18                	je     80284a <strncmp+0x34>
+  802832:	0f b6 18             	movzbl (%eax),%ebx
+  802835:	84 db                	test   %bl,%bl
+  802837:	74 04                	je     80283d <strncmp+0x27>
+  802839:	3a 19                	cmp    (%ecx),%bl
+  80283b:	74 e8                	je     802825 <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80283d:	0f b6 00             	movzbl (%eax),%eax
+  802840:	0f b6 11             	movzbl (%ecx),%edx
+  802843:	29 d0                	sub    %edx,%eax
+}
+  802845:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802848:	c9                   	leave
+  802849:	c3                   	ret
+    return 0;
+  80284a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80284f:	eb f4                	jmp    802845 <strncmp+0x2f>
+
+00802851 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  802851:	55                   	push   %ebp
+  802852:	89 e5                	mov    %esp,%ebp
+  802854:	8b 45 08             	mov    0x8(%ebp),%eax
+  802857:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  80285b:	eb 03                	jmp    802860 <strchr+0xf>
+  80285d:	83 c0 01             	add    $0x1,%eax
+  802860:	0f b6 10             	movzbl (%eax),%edx
+  802863:	84 d2                	test   %dl,%dl
+  802865:	74 06                	je     80286d <strchr+0x1c>
+    if (*s == c)
+  802867:	38 ca                	cmp    %cl,%dl
+  802869:	75 f2                	jne    80285d <strchr+0xc>
+  80286b:	eb 05                	jmp    802872 <strchr+0x21>
+      return (char*)s;
+  return 0;
+  80286d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802872:	5d                   	pop    %ebp
+  802873:	c3                   	ret
+
+00802874 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  802874:	55                   	push   %ebp
+  802875:	89 e5                	mov    %esp,%ebp
+  802877:	8b 45 08             	mov    0x8(%ebp),%eax
+  80287a:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  80287e:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  802881:	38 ca                	cmp    %cl,%dl
+  802883:	74 09                	je     80288e <strfind+0x1a>
+  802885:	84 d2                	test   %dl,%dl
+  802887:	74 05                	je     80288e <strfind+0x1a>
+  for (; *s; s++)
+  802889:	83 c0 01             	add    $0x1,%eax
+  80288c:	eb f0                	jmp    80287e <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  80288e:	5d                   	pop    %ebp
+  80288f:	c3                   	ret
+
+00802890 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  802890:	55                   	push   %ebp
+  802891:	89 e5                	mov    %esp,%ebp
+  802893:	57                   	push   %edi
+  802894:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802897:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  80289a:	85 c9                	test   %ecx,%ecx
+  80289c:	74 20                	je     8028be <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  80289e:	89 f8                	mov    %edi,%eax
+  8028a0:	09 c8                	or     %ecx,%eax
+  8028a2:	a8 03                	test   $0x3,%al
+  8028a4:	75 12                	jne    8028b8 <memset+0x28>
+    c &= 0xFF;
+  8028a6:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8028aa:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  8028b0:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  8028b3:	fc                   	cld
+  8028b4:	f3 ab                	rep stos %eax,%es:(%edi)
+  8028b6:	eb 06                	jmp    8028be <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  8028b8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8028bb:	fc                   	cld
+  8028bc:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  8028be:	89 f8                	mov    %edi,%eax
+  8028c0:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8028c3:	c9                   	leave
+  8028c4:	c3                   	ret
+
+008028c5 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8028c5:	55                   	push   %ebp
+  8028c6:	89 e5                	mov    %esp,%ebp
+  8028c8:	57                   	push   %edi
+  8028c9:	56                   	push   %esi
+  8028ca:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028cd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8028d0:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  8028d3:	39 c6                	cmp    %eax,%esi
+  8028d5:	73 32                	jae    802909 <memmove+0x44>
+  8028d7:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8028da:	39 d0                	cmp    %edx,%eax
+  8028dc:	73 2b                	jae    802909 <memmove+0x44>
+    s += n;
+    d += n;
+  8028de:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8028e1:	89 d6                	mov    %edx,%esi
+  8028e3:	09 fe                	or     %edi,%esi
+  8028e5:	09 ce                	or     %ecx,%esi
+  8028e7:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8028ed:	75 0e                	jne    8028fd <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8028ef:	83 ef 04             	sub    $0x4,%edi
+  8028f2:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8028f5:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  8028f8:	fd                   	std
+  8028f9:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8028fb:	eb 09                	jmp    802906 <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8028fd:	83 ef 01             	sub    $0x1,%edi
+  802900:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  802903:	fd                   	std
+  802904:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  802906:	fc                   	cld
+  802907:	eb 1a                	jmp    802923 <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  802909:	89 f2                	mov    %esi,%edx
+  80290b:	09 c2                	or     %eax,%edx
+  80290d:	09 ca                	or     %ecx,%edx
+  80290f:	f6 c2 03             	test   $0x3,%dl
+  802912:	75 0a                	jne    80291e <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  802914:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  802917:	89 c7                	mov    %eax,%edi
+  802919:	fc                   	cld
+  80291a:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80291c:	eb 05                	jmp    802923 <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  80291e:	89 c7                	mov    %eax,%edi
+  802920:	fc                   	cld
+  802921:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  802923:	5e                   	pop    %esi
+  802924:	5f                   	pop    %edi
+  802925:	5d                   	pop    %ebp
+  802926:	c3                   	ret
+
+00802927 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  802927:	55                   	push   %ebp
+  802928:	89 e5                	mov    %esp,%ebp
+  80292a:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  80292d:	ff 75 10             	push   0x10(%ebp)
+  802930:	ff 75 0c             	push   0xc(%ebp)
+  802933:	ff 75 08             	push   0x8(%ebp)
+  802936:	e8 8a ff ff ff       	call   8028c5 <memmove>
+}
+  80293b:	c9                   	leave
+  80293c:	c3                   	ret
+
+0080293d <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  80293d:	55                   	push   %ebp
+  80293e:	89 e5                	mov    %esp,%ebp
+  802940:	56                   	push   %esi
+  802941:	53                   	push   %ebx
+  802942:	8b 45 08             	mov    0x8(%ebp),%eax
+  802945:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  802948:	89 c6                	mov    %eax,%esi
+  80294a:	03 75 10             	add    0x10(%ebp),%esi
+  80294d:	eb 06                	jmp    802955 <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  80294f:	83 c0 01             	add    $0x1,%eax
+  802952:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  802955:	39 f0                	cmp    %esi,%eax
+  802957:	74 14                	je     80296d <memcmp+0x30>
+    if (*s1 != *s2)
+  802959:	0f b6 08             	movzbl (%eax),%ecx
+  80295c:	0f b6 1a             	movzbl (%edx),%ebx
+  80295f:	38 d9                	cmp    %bl,%cl
+  802961:	74 ec                	je     80294f <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  802963:	0f b6 c1             	movzbl %cl,%eax
+  802966:	0f b6 db             	movzbl %bl,%ebx
+  802969:	29 d8                	sub    %ebx,%eax
+  80296b:	eb 05                	jmp    802972 <memcmp+0x35>
+  }
+
+  return 0;
+  80296d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802972:	5b                   	pop    %ebx
+  802973:	5e                   	pop    %esi
+  802974:	5d                   	pop    %ebp
+  802975:	c3                   	ret
+
+00802976 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  802976:	55                   	push   %ebp
+  802977:	89 e5                	mov    %esp,%ebp
+  802979:	8b 45 08             	mov    0x8(%ebp),%eax
+  80297c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  80297f:	89 c2                	mov    %eax,%edx
+  802981:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  802984:	eb 03                	jmp    802989 <memfind+0x13>
+  802986:	83 c0 01             	add    $0x1,%eax
+  802989:	39 d0                	cmp    %edx,%eax
+  80298b:	73 04                	jae    802991 <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  80298d:	38 08                	cmp    %cl,(%eax)
+  80298f:	75 f5                	jne    802986 <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  802991:	5d                   	pop    %ebp
+  802992:	c3                   	ret
+
+00802993 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  802993:	55                   	push   %ebp
+  802994:	89 e5                	mov    %esp,%ebp
+  802996:	57                   	push   %edi
+  802997:	56                   	push   %esi
+  802998:	53                   	push   %ebx
+  802999:	8b 55 08             	mov    0x8(%ebp),%edx
+  80299c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  80299f:	eb 03                	jmp    8029a4 <strtol+0x11>
+    s++;
+  8029a1:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  8029a4:	0f b6 02             	movzbl (%edx),%eax
+  8029a7:	3c 20                	cmp    $0x20,%al
+  8029a9:	74 f6                	je     8029a1 <strtol+0xe>
+  8029ab:	3c 09                	cmp    $0x9,%al
+  8029ad:	74 f2                	je     8029a1 <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  8029af:	3c 2b                	cmp    $0x2b,%al
+  8029b1:	74 2a                	je     8029dd <strtol+0x4a>
+  int neg = 0;
+  8029b3:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  8029b8:	3c 2d                	cmp    $0x2d,%al
+  8029ba:	74 2b                	je     8029e7 <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8029bc:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8029c2:	75 0f                	jne    8029d3 <strtol+0x40>
+  8029c4:	80 3a 30             	cmpb   $0x30,(%edx)
+  8029c7:	74 28                	je     8029f1 <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  8029c9:	85 db                	test   %ebx,%ebx
+  8029cb:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8029d0:	0f 44 d8             	cmove  %eax,%ebx
+  8029d3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8029d8:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8029db:	eb 46                	jmp    802a23 <strtol+0x90>
+    s++;
+  8029dd:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  8029e0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029e5:	eb d5                	jmp    8029bc <strtol+0x29>
+    s++, neg = 1;
+  8029e7:	83 c2 01             	add    $0x1,%edx
+  8029ea:	bf 01 00 00 00       	mov    $0x1,%edi
+  8029ef:	eb cb                	jmp    8029bc <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8029f1:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8029f5:	74 0e                	je     802a05 <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  8029f7:	85 db                	test   %ebx,%ebx
+  8029f9:	75 d8                	jne    8029d3 <strtol+0x40>
+    s++, base = 8;
+  8029fb:	83 c2 01             	add    $0x1,%edx
+  8029fe:	bb 08 00 00 00       	mov    $0x8,%ebx
+  802a03:	eb ce                	jmp    8029d3 <strtol+0x40>
+    s += 2, base = 16;
+  802a05:	83 c2 02             	add    $0x2,%edx
+  802a08:	bb 10 00 00 00       	mov    $0x10,%ebx
+  802a0d:	eb c4                	jmp    8029d3 <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  802a0f:	0f be c0             	movsbl %al,%eax
+  802a12:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  802a15:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802a18:	7d 3a                	jge    802a54 <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  802a1a:	83 c2 01             	add    $0x1,%edx
+  802a1d:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  802a21:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  802a23:	0f b6 02             	movzbl (%edx),%eax
+  802a26:	8d 70 d0             	lea    -0x30(%eax),%esi
+  802a29:	89 f3                	mov    %esi,%ebx
+  802a2b:	80 fb 09             	cmp    $0x9,%bl
+  802a2e:	76 df                	jbe    802a0f <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  802a30:	8d 70 9f             	lea    -0x61(%eax),%esi
+  802a33:	89 f3                	mov    %esi,%ebx
+  802a35:	80 fb 19             	cmp    $0x19,%bl
+  802a38:	77 08                	ja     802a42 <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  802a3a:	0f be c0             	movsbl %al,%eax
+  802a3d:	83 e8 57             	sub    $0x57,%eax
+  802a40:	eb d3                	jmp    802a15 <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  802a42:	8d 70 bf             	lea    -0x41(%eax),%esi
+  802a45:	89 f3                	mov    %esi,%ebx
+  802a47:	80 fb 19             	cmp    $0x19,%bl
+  802a4a:	77 08                	ja     802a54 <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  802a4c:	0f be c0             	movsbl %al,%eax
+  802a4f:	83 e8 37             	sub    $0x37,%eax
+  802a52:	eb c1                	jmp    802a15 <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  802a54:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802a58:	74 05                	je     802a5f <strtol+0xcc>
+    *endptr = (char*)s;
+  802a5a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a5d:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  802a5f:	89 c8                	mov    %ecx,%eax
+  802a61:	f7 d8                	neg    %eax
+  802a63:	85 ff                	test   %edi,%edi
+  802a65:	0f 45 c8             	cmovne %eax,%ecx
+}
+  802a68:	89 c8                	mov    %ecx,%eax
+  802a6a:	5b                   	pop    %ebx
+  802a6b:	5e                   	pop    %esi
+  802a6c:	5f                   	pop    %edi
+  802a6d:	5d                   	pop    %ebp
+  802a6e:	c3                   	ret
+
+00802a6f <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  802a6f:	55                   	push   %ebp
+  802a70:	89 e5                	mov    %esp,%ebp
+  802a72:	57                   	push   %edi
+  802a73:	56                   	push   %esi
+  802a74:	53                   	push   %ebx
+  802a75:	83 ec 14             	sub    $0x14,%esp
+  802a78:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802a7b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a7e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802a81:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  802a84:	85 c0                	test   %eax,%eax
+  802a86:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802a8b:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  802a8e:	ff 33                	push   (%ebx)
+  802a90:	50                   	push   %eax
+  802a91:	e8 f8 d9 ff ff       	call   80048e <sys_ipc_recv>
+  802a96:	83 c4 10             	add    $0x10,%esp
+  802a99:	85 c0                	test   %eax,%eax
+  802a9b:	78 39                	js     802ad6 <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  802a9d:	85 ff                	test   %edi,%edi
+  802a9f:	74 0a                	je     802aab <ipc_recv_pages+0x3c>
+  802aa1:	a1 44 57 80 00       	mov    0x805744,%eax
+  802aa6:	8b 40 7c             	mov    0x7c(%eax),%eax
+  802aa9:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  802aab:	85 f6                	test   %esi,%esi
+  802aad:	74 0d                	je     802abc <ipc_recv_pages+0x4d>
+  802aaf:	a1 44 57 80 00       	mov    0x805744,%eax
+  802ab4:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  802aba:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  802abc:	a1 44 57 80 00       	mov    0x805744,%eax
+  802ac1:	8b 40 74             	mov    0x74(%eax),%eax
+  802ac4:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  802ac6:	a1 44 57 80 00       	mov    0x805744,%eax
+  802acb:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  802ace:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ad1:	5b                   	pop    %ebx
+  802ad2:	5e                   	pop    %esi
+  802ad3:	5f                   	pop    %edi
+  802ad4:	5d                   	pop    %ebp
+  802ad5:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  802ad6:	85 ff                	test   %edi,%edi
+  802ad8:	74 06                	je     802ae0 <ipc_recv_pages+0x71>
+  802ada:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  802ae0:	85 f6                	test   %esi,%esi
+  802ae2:	74 06                	je     802aea <ipc_recv_pages+0x7b>
+  802ae4:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  802aea:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  802af0:	eb dc                	jmp    802ace <ipc_recv_pages+0x5f>
+
+00802af2 <ipc_recv>:
+{
+  802af2:	55                   	push   %ebp
+  802af3:	89 e5                	mov    %esp,%ebp
+  802af5:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  802af8:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  802aff:	ff 75 10             	push   0x10(%ebp)
+  802b02:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b05:	50                   	push   %eax
+  802b06:	ff 75 0c             	push   0xc(%ebp)
+  802b09:	ff 75 08             	push   0x8(%ebp)
+  802b0c:	e8 5e ff ff ff       	call   802a6f <ipc_recv_pages>
+}
+  802b11:	c9                   	leave
+  802b12:	c3                   	ret
+
+00802b13 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  802b13:	55                   	push   %ebp
+  802b14:	89 e5                	mov    %esp,%ebp
+  802b16:	57                   	push   %edi
+  802b17:	56                   	push   %esi
+  802b18:	53                   	push   %ebx
+  802b19:	83 ec 0c             	sub    $0xc,%esp
+  802b1c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802b1f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802b22:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  802b25:	89 c3                	mov    %eax,%ebx
+  802b27:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  802b2d:	85 c0                	test   %eax,%eax
+  802b2f:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802b34:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  802b37:	83 ec 0c             	sub    $0xc,%esp
+  802b3a:	ff 75 14             	push   0x14(%ebp)
+  802b3d:	ff 75 18             	push   0x18(%ebp)
+  802b40:	53                   	push   %ebx
+  802b41:	56                   	push   %esi
+  802b42:	57                   	push   %edi
+  802b43:	e8 25 d9 ff ff       	call   80046d <sys_ipc_try_send>
+  802b48:	83 c4 20             	add    $0x20,%esp
+  802b4b:	85 c0                	test   %eax,%eax
+  802b4d:	79 1e                	jns    802b6d <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  802b4f:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802b52:	75 07                	jne    802b5b <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  802b54:	e8 fb d5 ff ff       	call   800154 <sys_yield>
+  802b59:	eb dc                	jmp    802b37 <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  802b5b:	50                   	push   %eax
+  802b5c:	68 e3 32 80 00       	push   $0x8032e3
+  802b61:	6a 5c                	push   $0x5c
+  802b63:	68 f0 32 80 00       	push   $0x8032f0
+  802b68:	e8 09 f5 ff ff       	call   802076 <_panic>
+  }
+}
+  802b6d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b70:	5b                   	pop    %ebx
+  802b71:	5e                   	pop    %esi
+  802b72:	5f                   	pop    %edi
+  802b73:	5d                   	pop    %ebp
+  802b74:	c3                   	ret
+
+00802b75 <ipc_send>:
+{
+  802b75:	55                   	push   %ebp
+  802b76:	89 e5                	mov    %esp,%ebp
+  802b78:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  802b7b:	ff 75 14             	push   0x14(%ebp)
+  802b7e:	6a 01                	push   $0x1
+  802b80:	ff 75 10             	push   0x10(%ebp)
+  802b83:	ff 75 0c             	push   0xc(%ebp)
+  802b86:	ff 75 08             	push   0x8(%ebp)
+  802b89:	e8 85 ff ff ff       	call   802b13 <ipc_send_pages>
+}
+  802b8e:	83 c4 20             	add    $0x20,%esp
+  802b91:	c9                   	leave
+  802b92:	c3                   	ret
+
+00802b93 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802b93:	55                   	push   %ebp
+  802b94:	89 e5                	mov    %esp,%ebp
+  802b96:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  802b99:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  802b9e:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802ba1:	c1 e0 04             	shl    $0x4,%eax
+  802ba4:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802ba9:	8b 40 50             	mov    0x50(%eax),%eax
+  802bac:	39 c8                	cmp    %ecx,%eax
+  802bae:	74 12                	je     802bc2 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  802bb0:	83 c2 01             	add    $0x1,%edx
+  802bb3:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802bb9:	75 e3                	jne    802b9e <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  802bbb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bc0:	eb 0e                	jmp    802bd0 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  802bc2:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802bc5:	c1 e0 04             	shl    $0x4,%eax
+  802bc8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802bcd:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802bd0:	5d                   	pop    %ebp
+  802bd1:	c3                   	ret
+
+00802bd2 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802bd2:	55                   	push   %ebp
+  802bd3:	89 e5                	mov    %esp,%ebp
+  802bd5:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802bd8:	89 c2                	mov    %eax,%edx
+  802bda:	c1 ea 16             	shr    $0x16,%edx
+  802bdd:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  802be4:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802be9:	f6 c1 01             	test   $0x1,%cl
+  802bec:	74 1c                	je     802c0a <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  802bee:	c1 e8 0c             	shr    $0xc,%eax
+  802bf1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  802bf8:	a8 01                	test   $0x1,%al
+  802bfa:	74 0e                	je     802c0a <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  802bfc:	c1 e8 0c             	shr    $0xc,%eax
+  802bff:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802c06:	ef 
+  802c07:	0f b7 d2             	movzwl %dx,%edx
+}
+  802c0a:	89 d0                	mov    %edx,%eax
+  802c0c:	5d                   	pop    %ebp
+  802c0d:	c3                   	ret
+
+00802c0e <udivmod>:
+  802c0e:	55                   	push   %ebp
+  802c0f:	57                   	push   %edi
+  802c10:	56                   	push   %esi
+  802c11:	53                   	push   %ebx
+  802c12:	83 ec 14             	sub    $0x14,%esp
+  802c15:	8b 74 24 28          	mov    0x28(%esp),%esi
+  802c19:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  802c1d:	89 fb                	mov    %edi,%ebx
+  802c1f:	09 f3                	or     %esi,%ebx
+  802c21:	0f 84 88 00 00 00    	je     802caf <udivmod+0xa1>
+  802c27:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802c2c:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802c33:	00 
+  802c34:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802c3b:	00 
+  802c3c:	89 cd                	mov    %ecx,%ebp
+  802c3e:	89 34 24             	mov    %esi,(%esp)
+  802c41:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802c45:	eb 08                	jmp    802c4f <udivmod+0x41>
+  802c47:	83 ed 01             	sub    $0x1,%ebp
+  802c4a:	83 fd ff             	cmp    $0xffffffff,%ebp
+  802c4d:	74 6c                	je     802cbb <udivmod+0xad>
+  802c4f:	89 c3                	mov    %eax,%ebx
+  802c51:	89 d6                	mov    %edx,%esi
+  802c53:	89 e9                	mov    %ebp,%ecx
+  802c55:	0f ad f3             	shrd   %cl,%esi,%ebx
+  802c58:	d3 ee                	shr    %cl,%esi
+  802c5a:	f6 c1 20             	test   $0x20,%cl
+  802c5d:	74 04                	je     802c63 <udivmod+0x55>
+  802c5f:	89 f3                	mov    %esi,%ebx
+  802c61:	31 f6                	xor    %esi,%esi
+  802c63:	8b 3c 24             	mov    (%esp),%edi
+  802c66:	39 fb                	cmp    %edi,%ebx
+  802c68:	89 f7                	mov    %esi,%edi
+  802c6a:	8b 1c 24             	mov    (%esp),%ebx
+  802c6d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802c71:	19 f7                	sbb    %esi,%edi
+  802c73:	72 d2                	jb     802c47 <udivmod+0x39>
+  802c75:	89 f7                	mov    %esi,%edi
+  802c77:	89 de                	mov    %ebx,%esi
+  802c79:	89 e9                	mov    %ebp,%ecx
+  802c7b:	0f a5 f7             	shld   %cl,%esi,%edi
+  802c7e:	d3 e6                	shl    %cl,%esi
+  802c80:	f6 c1 20             	test   $0x20,%cl
+  802c83:	74 04                	je     802c89 <udivmod+0x7b>
+  802c85:	89 f7                	mov    %esi,%edi
+  802c87:	31 f6                	xor    %esi,%esi
+  802c89:	29 f0                	sub    %esi,%eax
+  802c8b:	19 fa                	sbb    %edi,%edx
+  802c8d:	be 01 00 00 00       	mov    $0x1,%esi
+  802c92:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c97:	0f a5 f7             	shld   %cl,%esi,%edi
+  802c9a:	d3 e6                	shl    %cl,%esi
+  802c9c:	f6 c1 20             	test   $0x20,%cl
+  802c9f:	74 04                	je     802ca5 <udivmod+0x97>
+  802ca1:	89 f7                	mov    %esi,%edi
+  802ca3:	31 f6                	xor    %esi,%esi
+  802ca5:	09 74 24 08          	or     %esi,0x8(%esp)
+  802ca9:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802cad:	eb 98                	jmp    802c47 <udivmod+0x39>
+  802caf:	89 f0                	mov    %esi,%eax
+  802cb1:	89 fa                	mov    %edi,%edx
+  802cb3:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802cb7:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802cbb:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802cbf:	89 01                	mov    %eax,(%ecx)
+  802cc1:	89 51 04             	mov    %edx,0x4(%ecx)
+  802cc4:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802cc8:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802ccc:	83 c4 14             	add    $0x14,%esp
+  802ccf:	5b                   	pop    %ebx
+  802cd0:	5e                   	pop    %esi
+  802cd1:	5f                   	pop    %edi
+  802cd2:	5d                   	pop    %ebp
+  802cd3:	c3                   	ret
+
+00802cd4 <__udivdi3>:
+  802cd4:	83 ec 18             	sub    $0x18,%esp
+  802cd7:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802cdb:	50                   	push   %eax
+  802cdc:	ff 74 24 2c          	push   0x2c(%esp)
+  802ce0:	ff 74 24 2c          	push   0x2c(%esp)
+  802ce4:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802ce8:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802cec:	e8 1d ff ff ff       	call   802c0e <udivmod>
+  802cf1:	83 c4 24             	add    $0x24,%esp
+  802cf4:	c3                   	ret
+
+00802cf5 <__umoddi3>:
+  802cf5:	83 ec 18             	sub    $0x18,%esp
+  802cf8:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802cfc:	50                   	push   %eax
+  802cfd:	ff 74 24 2c          	push   0x2c(%esp)
+  802d01:	ff 74 24 2c          	push   0x2c(%esp)
+  802d05:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802d09:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802d0d:	e8 fc fe ff ff       	call   802c0e <udivmod>
+  802d12:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802d16:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802d1a:	83 c4 24             	add    $0x24,%esp
+  802d1d:	c3                   	ret
+
+00802d1e <__divdi3>:
+  802d1e:	56                   	push   %esi
+  802d1f:	53                   	push   %ebx
+  802d20:	83 ec 14             	sub    $0x14,%esp
+  802d23:	8b 44 24 20          	mov    0x20(%esp),%eax
+  802d27:	8b 54 24 24          	mov    0x24(%esp),%edx
+  802d2b:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  802d2f:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  802d33:	85 d2                	test   %edx,%edx
+  802d35:	78 18                	js     802d4f <__divdi3+0x31>
+  802d37:	85 db                	test   %ebx,%ebx
+  802d39:	78 3e                	js     802d79 <__divdi3+0x5b>
+  802d3b:	83 ec 04             	sub    $0x4,%esp
+  802d3e:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802d42:	56                   	push   %esi
+  802d43:	53                   	push   %ebx
+  802d44:	51                   	push   %ecx
+  802d45:	e8 c4 fe ff ff       	call   802c0e <udivmod>
+  802d4a:	83 c4 10             	add    $0x10,%esp
+  802d4d:	eb 24                	jmp    802d73 <__divdi3+0x55>
+  802d4f:	f7 d8                	neg    %eax
+  802d51:	83 d2 00             	adc    $0x0,%edx
+  802d54:	f7 da                	neg    %edx
+  802d56:	85 db                	test   %ebx,%ebx
+  802d58:	78 3a                	js     802d94 <__divdi3+0x76>
+  802d5a:	83 ec 04             	sub    $0x4,%esp
+  802d5d:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802d61:	56                   	push   %esi
+  802d62:	53                   	push   %ebx
+  802d63:	51                   	push   %ecx
+  802d64:	e8 a5 fe ff ff       	call   802c0e <udivmod>
+  802d69:	83 c4 10             	add    $0x10,%esp
+  802d6c:	f7 d8                	neg    %eax
+  802d6e:	83 d2 00             	adc    $0x0,%edx
+  802d71:	f7 da                	neg    %edx
+  802d73:	83 c4 14             	add    $0x14,%esp
+  802d76:	5b                   	pop    %ebx
+  802d77:	5e                   	pop    %esi
+  802d78:	c3                   	ret
+  802d79:	83 ec 04             	sub    $0x4,%esp
+  802d7c:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802d80:	56                   	push   %esi
+  802d81:	f7 d9                	neg    %ecx
+  802d83:	83 d3 00             	adc    $0x0,%ebx
+  802d86:	f7 db                	neg    %ebx
+  802d88:	53                   	push   %ebx
+  802d89:	51                   	push   %ecx
+  802d8a:	e8 7f fe ff ff       	call   802c0e <udivmod>
+  802d8f:	83 c4 10             	add    $0x10,%esp
+  802d92:	eb d8                	jmp    802d6c <__divdi3+0x4e>
+  802d94:	83 ec 04             	sub    $0x4,%esp
+  802d97:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802d9b:	56                   	push   %esi
+  802d9c:	f7 d9                	neg    %ecx
+  802d9e:	83 d3 00             	adc    $0x0,%ebx
+  802da1:	f7 db                	neg    %ebx
+  802da3:	53                   	push   %ebx
+  802da4:	51                   	push   %ecx
+  802da5:	e8 64 fe ff ff       	call   802c0e <udivmod>
+  802daa:	83 c4 10             	add    $0x10,%esp
+  802dad:	eb c4                	jmp    802d73 <__divdi3+0x55>
+
+00802daf <__moddi3>:
+  802daf:	55                   	push   %ebp
+  802db0:	57                   	push   %edi
+  802db1:	56                   	push   %esi
+  802db2:	53                   	push   %ebx
+  802db3:	83 ec 24             	sub    $0x24,%esp
+  802db6:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802dba:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802dbe:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  802dc2:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  802dc6:	85 d2                	test   %edx,%edx
+  802dc8:	78 3b                	js     802e05 <__moddi3+0x56>
+  802dca:	83 ec 04             	sub    $0x4,%esp
+  802dcd:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  802dd1:	56                   	push   %esi
+  802dd2:	89 ce                	mov    %ecx,%esi
+  802dd4:	f7 de                	neg    %esi
+  802dd6:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802dda:	89 de                	mov    %ebx,%esi
+  802ddc:	83 d6 00             	adc    $0x0,%esi
+  802ddf:	f7 de                	neg    %esi
+  802de1:	89 74 24 14          	mov    %esi,0x14(%esp)
+  802de5:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802de9:	0f 48 f1             	cmovs  %ecx,%esi
+  802dec:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  802df1:	53                   	push   %ebx
+  802df2:	56                   	push   %esi
+  802df3:	e8 16 fe ff ff       	call   802c0e <udivmod>
+  802df8:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802dfc:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802e00:	83 c4 10             	add    $0x10,%esp
+  802e03:	eb 47                	jmp    802e4c <__moddi3+0x9d>
+  802e05:	f7 d8                	neg    %eax
+  802e07:	83 d2 00             	adc    $0x0,%edx
+  802e0a:	f7 da                	neg    %edx
+  802e0c:	83 ec 04             	sub    $0x4,%esp
+  802e0f:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  802e13:	56                   	push   %esi
+  802e14:	89 cf                	mov    %ecx,%edi
+  802e16:	f7 df                	neg    %edi
+  802e18:	89 de                	mov    %ebx,%esi
+  802e1a:	83 d6 00             	adc    $0x0,%esi
+  802e1d:	f7 de                	neg    %esi
+  802e1f:	0f 49 cf             	cmovns %edi,%ecx
+  802e22:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802e26:	0f 49 de             	cmovns %esi,%ebx
+  802e29:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  802e2d:	ff 74 24 0c          	push   0xc(%esp)
+  802e31:	ff 74 24 0c          	push   0xc(%esp)
+  802e35:	e8 d4 fd ff ff       	call   802c0e <udivmod>
+  802e3a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802e3e:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802e42:	f7 d8                	neg    %eax
+  802e44:	83 d2 00             	adc    $0x0,%edx
+  802e47:	f7 da                	neg    %edx
+  802e49:	83 c4 10             	add    $0x10,%esp
+  802e4c:	83 c4 24             	add    $0x24,%esp
+  802e4f:	5b                   	pop    %ebx
+  802e50:	5e                   	pop    %esi
+  802e51:	5f                   	pop    %edi
+  802e52:	5d                   	pop    %ebp
+  802e53:	c3                   	ret
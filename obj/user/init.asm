@@ -0,0 +1,7334 @@
+
+obj/user/init.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 5f 03 00 00       	call   800390 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <sum>:
+
+char bss[6000];
+
+int
+sum(const char *s, int n)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	8b 75 08             	mov    0x8(%ebp),%esi
+  80003b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int i, tot = 0;
+  80003e:	b9 00 00 00 00       	mov    $0x0,%ecx
+
+  for (i = 0; i < n; i++)
+  800043:	b8 00 00 00 00       	mov    $0x0,%eax
+  800048:	eb 0c                	jmp    800056 <sum+0x23>
+    tot ^= i * s[i];
+  80004a:	0f be 14 06          	movsbl (%esi,%eax,1),%edx
+  80004e:	0f af d0             	imul   %eax,%edx
+  800051:	31 d1                	xor    %edx,%ecx
+  for (i = 0; i < n; i++)
+  800053:	83 c0 01             	add    $0x1,%eax
+  800056:	39 d8                	cmp    %ebx,%eax
+  800058:	7c f0                	jl     80004a <sum+0x17>
+  return tot;
+}
+  80005a:	89 c8                	mov    %ecx,%eax
+  80005c:	5b                   	pop    %ebx
+  80005d:	5e                   	pop    %esi
+  80005e:	5d                   	pop    %ebp
+  80005f:	c3                   	ret
+
+00800060 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800060:	55                   	push   %ebp
+  800061:	89 e5                	mov    %esp,%ebp
+  800063:	57                   	push   %edi
+  800064:	56                   	push   %esi
+  800065:	53                   	push   %ebx
+  800066:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  80006c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  int i, r, x, want;
+  char args[256];
+
+  cprintf("init: running\n");
+  80006f:	68 20 38 80 00       	push   $0x803820
+  800074:	e8 5f 04 00 00       	call   8004d8 <cprintf>
+
+  want = 0xf989e;
+  if ((x = sum((char*)&data, sizeof data)) != want)
+  800079:	83 c4 08             	add    $0x8,%esp
+  80007c:	68 70 17 00 00       	push   $0x1770
+  800081:	68 00 40 80 00       	push   $0x804000
+  800086:	e8 a8 ff ff ff       	call   800033 <sum>
+  80008b:	83 c4 10             	add    $0x10,%esp
+  80008e:	3d 9e 98 0f 00       	cmp    $0xf989e,%eax
+  800093:	74 64                	je     8000f9 <umain+0x99>
+    cprintf("init: data is not initialized: got sum %08x wanted %08x\n",
+  800095:	83 ec 04             	sub    $0x4,%esp
+  800098:	68 9e 98 0f 00       	push   $0xf989e
+  80009d:	50                   	push   %eax
+  80009e:	68 e4 38 80 00       	push   $0x8038e4
+  8000a3:	e8 30 04 00 00       	call   8004d8 <cprintf>
+  8000a8:	83 c4 10             	add    $0x10,%esp
+            x, want);
+  else
+    cprintf("init: data seems okay\n");
+  if ((x = sum(bss, sizeof bss)) != 0)
+  8000ab:	83 ec 08             	sub    $0x8,%esp
+  8000ae:	68 70 17 00 00       	push   $0x1770
+  8000b3:	68 80 6e 80 00       	push   $0x806e80
+  8000b8:	e8 76 ff ff ff       	call   800033 <sum>
+  8000bd:	83 c4 10             	add    $0x10,%esp
+  8000c0:	85 c0                	test   %eax,%eax
+  8000c2:	74 47                	je     80010b <umain+0xab>
+    cprintf("bss is not initialized: wanted sum 0 got %08x\n", x);
+  8000c4:	83 ec 08             	sub    $0x8,%esp
+  8000c7:	50                   	push   %eax
+  8000c8:	68 20 39 80 00       	push   $0x803920
+  8000cd:	e8 06 04 00 00       	call   8004d8 <cprintf>
+  8000d2:	83 c4 10             	add    $0x10,%esp
+  else
+    cprintf("init: bss seems okay\n");
+
+  // output in one syscall per line to avoid output interleaving
+  strcat(args, "init: args:");
+  8000d5:	83 ec 08             	sub    $0x8,%esp
+  8000d8:	68 5c 38 80 00       	push   $0x80385c
+  8000dd:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  8000e3:	50                   	push   %eax
+  8000e4:	e8 01 0a 00 00       	call   800aea <strcat>
+  for (i = 0; i < argc; i++) {
+  8000e9:	83 c4 10             	add    $0x10,%esp
+  8000ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+    strcat(args, " '");
+  8000f1:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+  for (i = 0; i < argc; i++) {
+  8000f7:	eb 55                	jmp    80014e <umain+0xee>
+    cprintf("init: data seems okay\n");
+  8000f9:	83 ec 0c             	sub    $0xc,%esp
+  8000fc:	68 2f 38 80 00       	push   $0x80382f
+  800101:	e8 d2 03 00 00       	call   8004d8 <cprintf>
+  800106:	83 c4 10             	add    $0x10,%esp
+  800109:	eb a0                	jmp    8000ab <umain+0x4b>
+    cprintf("init: bss seems okay\n");
+  80010b:	83 ec 0c             	sub    $0xc,%esp
+  80010e:	68 46 38 80 00       	push   $0x803846
+  800113:	e8 c0 03 00 00       	call   8004d8 <cprintf>
+  800118:	83 c4 10             	add    $0x10,%esp
+  80011b:	eb b8                	jmp    8000d5 <umain+0x75>
+    strcat(args, " '");
+  80011d:	83 ec 08             	sub    $0x8,%esp
+  800120:	68 68 38 80 00       	push   $0x803868
+  800125:	56                   	push   %esi
+  800126:	e8 bf 09 00 00       	call   800aea <strcat>
+    strcat(args, argv[i]);
+  80012b:	83 c4 08             	add    $0x8,%esp
+  80012e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800131:	ff 34 98             	push   (%eax,%ebx,4)
+  800134:	56                   	push   %esi
+  800135:	e8 b0 09 00 00       	call   800aea <strcat>
+    strcat(args, "'");
+  80013a:	83 c4 08             	add    $0x8,%esp
+  80013d:	68 69 38 80 00       	push   $0x803869
+  800142:	56                   	push   %esi
+  800143:	e8 a2 09 00 00       	call   800aea <strcat>
+  for (i = 0; i < argc; i++) {
+  800148:	83 c3 01             	add    $0x1,%ebx
+  80014b:	83 c4 10             	add    $0x10,%esp
+  80014e:	39 fb                	cmp    %edi,%ebx
+  800150:	7c cb                	jl     80011d <umain+0xbd>
+  }
+  cprintf("%s\n", args);
+  800152:	83 ec 08             	sub    $0x8,%esp
+  800155:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  80015b:	50                   	push   %eax
+  80015c:	68 2c 3e 80 00       	push   $0x803e2c
+  800161:	e8 72 03 00 00       	call   8004d8 <cprintf>
+
+  cprintf("init: running sh\n");
+  800166:	c7 04 24 6b 38 80 00 	movl   $0x80386b,(%esp)
+  80016d:	e8 66 03 00 00       	call   8004d8 <cprintf>
+
+  // being run directly from kernel, so no file descriptors open yet
+  close(0);
+  800172:	c7 04 24 00 00 00 00 	movl   $0x0,(%esp)
+  800179:	e8 c3 13 00 00       	call   801541 <close>
+  if ((r = opencons()) < 0)
+  80017e:	e8 bb 01 00 00       	call   80033e <opencons>
+  800183:	83 c4 10             	add    $0x10,%esp
+  800186:	85 c0                	test   %eax,%eax
+  800188:	78 14                	js     80019e <umain+0x13e>
+    panic("opencons: %e", r);
+  if (r != 0)
+  80018a:	74 24                	je     8001b0 <umain+0x150>
+    panic("first opencons used fd %d", r);
+  80018c:	50                   	push   %eax
+  80018d:	68 96 38 80 00       	push   $0x803896
+  800192:	6a 3a                	push   $0x3a
+  800194:	68 8a 38 80 00       	push   $0x80388a
+  800199:	e8 5f 02 00 00       	call   8003fd <_panic>
+    panic("opencons: %e", r);
+  80019e:	50                   	push   %eax
+  80019f:	68 7d 38 80 00       	push   $0x80387d
+  8001a4:	6a 38                	push   $0x38
+  8001a6:	68 8a 38 80 00       	push   $0x80388a
+  8001ab:	e8 4d 02 00 00       	call   8003fd <_panic>
+  if ((r = dup(0, 1)) < 0)
+  8001b0:	83 ec 08             	sub    $0x8,%esp
+  8001b3:	6a 01                	push   $0x1
+  8001b5:	6a 00                	push   $0x0
+  8001b7:	e8 d7 13 00 00       	call   801593 <dup>
+  8001bc:	83 c4 10             	add    $0x10,%esp
+  8001bf:	85 c0                	test   %eax,%eax
+  8001c1:	79 23                	jns    8001e6 <umain+0x186>
+    panic("dup: %e", r);
+  8001c3:	50                   	push   %eax
+  8001c4:	68 b0 38 80 00       	push   $0x8038b0
+  8001c9:	6a 3c                	push   $0x3c
+  8001cb:	68 8a 38 80 00       	push   $0x80388a
+  8001d0:	e8 28 02 00 00       	call   8003fd <_panic>
+  while (1) {
+    cprintf("init: starting sh\n");
+    r = spawnl("/sh", "sh", (char*)0);
+    if (r < 0) {
+      cprintf("init: spawn sh: %e\n", r);
+  8001d5:	83 ec 08             	sub    $0x8,%esp
+  8001d8:	50                   	push   %eax
+  8001d9:	68 cf 38 80 00       	push   $0x8038cf
+  8001de:	e8 f5 02 00 00       	call   8004d8 <cprintf>
+      continue;
+  8001e3:	83 c4 10             	add    $0x10,%esp
+    cprintf("init: starting sh\n");
+  8001e6:	83 ec 0c             	sub    $0xc,%esp
+  8001e9:	68 b8 38 80 00       	push   $0x8038b8
+  8001ee:	e8 e5 02 00 00       	call   8004d8 <cprintf>
+    r = spawnl("/sh", "sh", (char*)0);
+  8001f3:	83 c4 0c             	add    $0xc,%esp
+  8001f6:	6a 00                	push   $0x0
+  8001f8:	68 cc 38 80 00       	push   $0x8038cc
+  8001fd:	68 cb 38 80 00       	push   $0x8038cb
+  800202:	e8 e0 28 00 00       	call   802ae7 <spawnl>
+    if (r < 0) {
+  800207:	83 c4 10             	add    $0x10,%esp
+  80020a:	85 c0                	test   %eax,%eax
+  80020c:	78 c7                	js     8001d5 <umain+0x175>
+    }
+    wait(r);
+  80020e:	83 ec 0c             	sub    $0xc,%esp
+  800211:	50                   	push   %eax
+  800212:	e8 d1 31 00 00       	call   8033e8 <wait>
+  800217:	83 c4 10             	add    $0x10,%esp
+  80021a:	eb ca                	jmp    8001e6 <umain+0x186>
+
+0080021c <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  80021c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800221:	c3                   	ret
+
+00800222 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  800222:	55                   	push   %ebp
+  800223:	89 e5                	mov    %esp,%ebp
+  800225:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  800228:	68 4f 39 80 00       	push   $0x80394f
+  80022d:	ff 75 0c             	push   0xc(%ebp)
+  800230:	e8 91 08 00 00       	call   800ac6 <strcpy>
+  return 0;
+}
+  800235:	b8 00 00 00 00       	mov    $0x0,%eax
+  80023a:	c9                   	leave
+  80023b:	c3                   	ret
+
+0080023c <devcons_write>:
+{
+  80023c:	55                   	push   %ebp
+  80023d:	89 e5                	mov    %esp,%ebp
+  80023f:	57                   	push   %edi
+  800240:	56                   	push   %esi
+  800241:	53                   	push   %ebx
+  800242:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  800248:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  80024d:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  800253:	eb 2e                	jmp    800283 <devcons_write+0x47>
+    m = n - tot;
+  800255:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800258:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  80025a:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80025f:	39 c3                	cmp    %eax,%ebx
+  800261:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  800264:	83 ec 04             	sub    $0x4,%esp
+  800267:	53                   	push   %ebx
+  800268:	89 f0                	mov    %esi,%eax
+  80026a:	03 45 0c             	add    0xc(%ebp),%eax
+  80026d:	50                   	push   %eax
+  80026e:	57                   	push   %edi
+  80026f:	e8 d8 09 00 00       	call   800c4c <memmove>
+    sys_cputs(buf, m);
+  800274:	83 c4 08             	add    $0x8,%esp
+  800277:	53                   	push   %ebx
+  800278:	57                   	push   %edi
+  800279:	e8 78 0b 00 00       	call   800df6 <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  80027e:	01 de                	add    %ebx,%esi
+  800280:	83 c4 10             	add    $0x10,%esp
+  800283:	3b 75 10             	cmp    0x10(%ebp),%esi
+  800286:	72 cd                	jb     800255 <devcons_write+0x19>
+}
+  800288:	89 f0                	mov    %esi,%eax
+  80028a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80028d:	5b                   	pop    %ebx
+  80028e:	5e                   	pop    %esi
+  80028f:	5f                   	pop    %edi
+  800290:	5d                   	pop    %ebp
+  800291:	c3                   	ret
+
+00800292 <devcons_read>:
+{
+  800292:	55                   	push   %ebp
+  800293:	89 e5                	mov    %esp,%ebp
+  800295:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  800298:	b8 00 00 00 00       	mov    $0x0,%eax
+  80029d:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8002a1:	75 07                	jne    8002aa <devcons_read+0x18>
+  8002a3:	eb 1f                	jmp    8002c4 <devcons_read+0x32>
+    sys_yield();
+  8002a5:	e8 e9 0b 00 00       	call   800e93 <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  8002aa:	e8 65 0b 00 00       	call   800e14 <sys_cgetc>
+  8002af:	85 c0                	test   %eax,%eax
+  8002b1:	74 f2                	je     8002a5 <devcons_read+0x13>
+  if (c < 0)
+  8002b3:	78 0f                	js     8002c4 <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  8002b5:	83 f8 04             	cmp    $0x4,%eax
+  8002b8:	74 0c                	je     8002c6 <devcons_read+0x34>
+  *(char*)vbuf = c;
+  8002ba:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8002bd:	88 02                	mov    %al,(%edx)
+  return 1;
+  8002bf:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8002c4:	c9                   	leave
+  8002c5:	c3                   	ret
+    return 0;
+  8002c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002cb:	eb f7                	jmp    8002c4 <devcons_read+0x32>
+
+008002cd <cputchar>:
+{
+  8002cd:	55                   	push   %ebp
+  8002ce:	89 e5                	mov    %esp,%ebp
+  8002d0:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  8002d3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002d6:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  8002d9:	6a 01                	push   $0x1
+  8002db:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8002de:	50                   	push   %eax
+  8002df:	e8 12 0b 00 00       	call   800df6 <sys_cputs>
+}
+  8002e4:	83 c4 10             	add    $0x10,%esp
+  8002e7:	c9                   	leave
+  8002e8:	c3                   	ret
+
+008002e9 <getchar>:
+{
+  8002e9:	55                   	push   %ebp
+  8002ea:	89 e5                	mov    %esp,%ebp
+  8002ec:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  8002ef:	6a 01                	push   $0x1
+  8002f1:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8002f4:	50                   	push   %eax
+  8002f5:	6a 00                	push   $0x0
+  8002f7:	e8 cd 13 00 00       	call   8016c9 <read>
+  if (r < 0)
+  8002fc:	83 c4 10             	add    $0x10,%esp
+  8002ff:	85 c0                	test   %eax,%eax
+  800301:	78 06                	js     800309 <getchar+0x20>
+  if (r < 1)
+  800303:	74 06                	je     80030b <getchar+0x22>
+  return c;
+  800305:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  800309:	c9                   	leave
+  80030a:	c3                   	ret
+    return -E_EOF;
+  80030b:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  800310:	eb f7                	jmp    800309 <getchar+0x20>
+
+00800312 <iscons>:
+{
+  800312:	55                   	push   %ebp
+  800313:	89 e5                	mov    %esp,%ebp
+  800315:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800318:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80031b:	50                   	push   %eax
+  80031c:	ff 75 08             	push   0x8(%ebp)
+  80031f:	e8 fa 10 00 00       	call   80141e <fd_lookup>
+  800324:	83 c4 10             	add    $0x10,%esp
+  800327:	85 c0                	test   %eax,%eax
+  800329:	78 11                	js     80033c <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  80032b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80032e:	8b 15 70 57 80 00    	mov    0x805770,%edx
+  800334:	39 10                	cmp    %edx,(%eax)
+  800336:	0f 94 c0             	sete   %al
+  800339:	0f b6 c0             	movzbl %al,%eax
+}
+  80033c:	c9                   	leave
+  80033d:	c3                   	ret
+
+0080033e <opencons>:
+{
+  80033e:	55                   	push   %ebp
+  80033f:	89 e5                	mov    %esp,%ebp
+  800341:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  800344:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800347:	50                   	push   %eax
+  800348:	e8 7b 10 00 00       	call   8013c8 <fd_alloc>
+  80034d:	83 c4 10             	add    $0x10,%esp
+  800350:	85 c0                	test   %eax,%eax
+  800352:	78 3a                	js     80038e <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  800354:	83 ec 04             	sub    $0x4,%esp
+  800357:	68 07 04 00 00       	push   $0x407
+  80035c:	ff 75 f4             	push   -0xc(%ebp)
+  80035f:	6a 00                	push   $0x0
+  800361:	e8 8f 0b 00 00       	call   800ef5 <sys_page_alloc>
+  800366:	83 c4 10             	add    $0x10,%esp
+  800369:	85 c0                	test   %eax,%eax
+  80036b:	78 21                	js     80038e <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  80036d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800370:	8b 15 70 57 80 00    	mov    0x805770,%edx
+  800376:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  800378:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80037b:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  800382:	83 ec 0c             	sub    $0xc,%esp
+  800385:	50                   	push   %eax
+  800386:	e8 19 10 00 00       	call   8013a4 <fd2num>
+  80038b:	83 c4 10             	add    $0x10,%esp
+}
+  80038e:	c9                   	leave
+  80038f:	c3                   	ret
+
+00800390 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800390:	55                   	push   %ebp
+  800391:	89 e5                	mov    %esp,%ebp
+  800393:	56                   	push   %esi
+  800394:	53                   	push   %ebx
+  800395:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800398:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  80039b:	c7 05 f0 85 80 00 00 	movl   $0x0,0x8085f0
+  8003a2:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  8003a5:	e8 ca 0a 00 00       	call   800e74 <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  8003aa:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8003af:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8003b2:	c1 e0 04             	shl    $0x4,%eax
+  8003b5:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8003ba:	a3 f0 85 80 00       	mov    %eax,0x8085f0
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8003bf:	85 db                	test   %ebx,%ebx
+  8003c1:	7e 07                	jle    8003ca <libmain+0x3a>
+    binaryname = argv[0];
+  8003c3:	8b 06                	mov    (%esi),%eax
+  8003c5:	a3 8c 57 80 00       	mov    %eax,0x80578c
+
+  // call user main routine
+  umain(argc, argv);
+  8003ca:	83 ec 08             	sub    $0x8,%esp
+  8003cd:	56                   	push   %esi
+  8003ce:	53                   	push   %ebx
+  8003cf:	e8 8c fc ff ff       	call   800060 <umain>
+
+  // exit gracefully
+  exit();
+  8003d4:	e8 0a 00 00 00       	call   8003e3 <exit>
+}
+  8003d9:	83 c4 10             	add    $0x10,%esp
+  8003dc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8003df:	5b                   	pop    %ebx
+  8003e0:	5e                   	pop    %esi
+  8003e1:	5d                   	pop    %ebp
+  8003e2:	c3                   	ret
+
+008003e3 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8003e3:	55                   	push   %ebp
+  8003e4:	89 e5                	mov    %esp,%ebp
+  8003e6:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  8003e9:	e8 80 11 00 00       	call   80156e <close_all>
+  sys_env_destroy(0);
+  8003ee:	83 ec 0c             	sub    $0xc,%esp
+  8003f1:	6a 00                	push   $0x0
+  8003f3:	e8 3b 0a 00 00       	call   800e33 <sys_env_destroy>
+}
+  8003f8:	83 c4 10             	add    $0x10,%esp
+  8003fb:	c9                   	leave
+  8003fc:	c3                   	ret
+
+008003fd <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8003fd:	55                   	push   %ebp
+  8003fe:	89 e5                	mov    %esp,%ebp
+  800400:	56                   	push   %esi
+  800401:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  800402:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  800405:	8b 35 8c 57 80 00    	mov    0x80578c,%esi
+  80040b:	e8 64 0a 00 00       	call   800e74 <sys_getenvid>
+  800410:	83 ec 0c             	sub    $0xc,%esp
+  800413:	ff 75 0c             	push   0xc(%ebp)
+  800416:	ff 75 08             	push   0x8(%ebp)
+  800419:	56                   	push   %esi
+  80041a:	50                   	push   %eax
+  80041b:	68 68 39 80 00       	push   $0x803968
+  800420:	e8 b3 00 00 00       	call   8004d8 <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  800425:	83 c4 18             	add    $0x18,%esp
+  800428:	53                   	push   %ebx
+  800429:	ff 75 10             	push   0x10(%ebp)
+  80042c:	e8 56 00 00 00       	call   800487 <vcprintf>
+  cprintf("\n");
+  800431:	c7 04 24 3d 3e 80 00 	movl   $0x803e3d,(%esp)
+  800438:	e8 9b 00 00 00       	call   8004d8 <cprintf>
+  80043d:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  800440:	cc                   	int3
+  while (1)
+  800441:	eb fd                	jmp    800440 <_panic+0x43>
+
+00800443 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800443:	55                   	push   %ebp
+  800444:	89 e5                	mov    %esp,%ebp
+  800446:	53                   	push   %ebx
+  800447:	83 ec 04             	sub    $0x4,%esp
+  80044a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  80044d:	8b 13                	mov    (%ebx),%edx
+  80044f:	8d 42 01             	lea    0x1(%edx),%eax
+  800452:	89 03                	mov    %eax,(%ebx)
+  800454:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800457:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  80045b:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800460:	74 09                	je     80046b <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  800462:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800466:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800469:	c9                   	leave
+  80046a:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  80046b:	83 ec 08             	sub    $0x8,%esp
+  80046e:	68 ff 00 00 00       	push   $0xff
+  800473:	8d 43 08             	lea    0x8(%ebx),%eax
+  800476:	50                   	push   %eax
+  800477:	e8 7a 09 00 00       	call   800df6 <sys_cputs>
+    b->idx = 0;
+  80047c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800482:	83 c4 10             	add    $0x10,%esp
+  800485:	eb db                	jmp    800462 <putch+0x1f>
+
+00800487 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800487:	55                   	push   %ebp
+  800488:	89 e5                	mov    %esp,%ebp
+  80048a:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  800490:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800497:	00 00 00 
+  b.cnt = 0;
+  80049a:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8004a1:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  8004a4:	ff 75 0c             	push   0xc(%ebp)
+  8004a7:	ff 75 08             	push   0x8(%ebp)
+  8004aa:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8004b0:	50                   	push   %eax
+  8004b1:	68 43 04 80 00       	push   $0x800443
+  8004b6:	e8 14 01 00 00       	call   8005cf <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  8004bb:	83 c4 08             	add    $0x8,%esp
+  8004be:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8004c4:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8004ca:	50                   	push   %eax
+  8004cb:	e8 26 09 00 00       	call   800df6 <sys_cputs>
+
+  return b.cnt;
+}
+  8004d0:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8004d6:	c9                   	leave
+  8004d7:	c3                   	ret
+
+008004d8 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8004d8:	55                   	push   %ebp
+  8004d9:	89 e5                	mov    %esp,%ebp
+  8004db:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  8004de:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  8004e1:	50                   	push   %eax
+  8004e2:	ff 75 08             	push   0x8(%ebp)
+  8004e5:	e8 9d ff ff ff       	call   800487 <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  8004ea:	c9                   	leave
+  8004eb:	c3                   	ret
+
+008004ec <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  8004ec:	55                   	push   %ebp
+  8004ed:	89 e5                	mov    %esp,%ebp
+  8004ef:	57                   	push   %edi
+  8004f0:	56                   	push   %esi
+  8004f1:	53                   	push   %ebx
+  8004f2:	83 ec 1c             	sub    $0x1c,%esp
+  8004f5:	89 c7                	mov    %eax,%edi
+  8004f7:	89 d6                	mov    %edx,%esi
+  8004f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8004fc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8004ff:	89 d1                	mov    %edx,%ecx
+  800501:	89 c2                	mov    %eax,%edx
+  800503:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800506:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800509:	8b 45 10             	mov    0x10(%ebp),%eax
+  80050c:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  80050f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800512:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800519:	39 c2                	cmp    %eax,%edx
+  80051b:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80051e:	72 3e                	jb     80055e <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  800520:	83 ec 0c             	sub    $0xc,%esp
+  800523:	ff 75 18             	push   0x18(%ebp)
+  800526:	83 eb 01             	sub    $0x1,%ebx
+  800529:	53                   	push   %ebx
+  80052a:	50                   	push   %eax
+  80052b:	83 ec 08             	sub    $0x8,%esp
+  80052e:	ff 75 e4             	push   -0x1c(%ebp)
+  800531:	ff 75 e0             	push   -0x20(%ebp)
+  800534:	ff 75 dc             	push   -0x24(%ebp)
+  800537:	ff 75 d8             	push   -0x28(%ebp)
+  80053a:	e8 5f 31 00 00       	call   80369e <__udivdi3>
+  80053f:	83 c4 18             	add    $0x18,%esp
+  800542:	52                   	push   %edx
+  800543:	50                   	push   %eax
+  800544:	89 f2                	mov    %esi,%edx
+  800546:	89 f8                	mov    %edi,%eax
+  800548:	e8 9f ff ff ff       	call   8004ec <printnum>
+  80054d:	83 c4 20             	add    $0x20,%esp
+  800550:	eb 13                	jmp    800565 <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  800552:	83 ec 08             	sub    $0x8,%esp
+  800555:	56                   	push   %esi
+  800556:	ff 75 18             	push   0x18(%ebp)
+  800559:	ff d7                	call   *%edi
+  80055b:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  80055e:	83 eb 01             	sub    $0x1,%ebx
+  800561:	85 db                	test   %ebx,%ebx
+  800563:	7f ed                	jg     800552 <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  800565:	83 ec 08             	sub    $0x8,%esp
+  800568:	56                   	push   %esi
+  800569:	83 ec 04             	sub    $0x4,%esp
+  80056c:	ff 75 e4             	push   -0x1c(%ebp)
+  80056f:	ff 75 e0             	push   -0x20(%ebp)
+  800572:	ff 75 dc             	push   -0x24(%ebp)
+  800575:	ff 75 d8             	push   -0x28(%ebp)
+  800578:	e8 42 31 00 00       	call   8036bf <__umoddi3>
+  80057d:	83 c4 14             	add    $0x14,%esp
+  800580:	0f be 80 8b 39 80 00 	movsbl 0x80398b(%eax),%eax
+  800587:	50                   	push   %eax
+  800588:	ff d7                	call   *%edi
+}
+  80058a:	83 c4 10             	add    $0x10,%esp
+  80058d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800590:	5b                   	pop    %ebx
+  800591:	5e                   	pop    %esi
+  800592:	5f                   	pop    %edi
+  800593:	5d                   	pop    %ebp
+  800594:	c3                   	ret
+
+00800595 <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800595:	55                   	push   %ebp
+  800596:	89 e5                	mov    %esp,%ebp
+  800598:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  80059b:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  80059f:	8b 10                	mov    (%eax),%edx
+  8005a1:	3b 50 04             	cmp    0x4(%eax),%edx
+  8005a4:	73 0a                	jae    8005b0 <sprintputch+0x1b>
+    *b->buf++ = ch;
+  8005a6:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8005a9:	89 08                	mov    %ecx,(%eax)
+  8005ab:	8b 45 08             	mov    0x8(%ebp),%eax
+  8005ae:	88 02                	mov    %al,(%edx)
+}
+  8005b0:	5d                   	pop    %ebp
+  8005b1:	c3                   	ret
+
+008005b2 <printfmt>:
+{
+  8005b2:	55                   	push   %ebp
+  8005b3:	89 e5                	mov    %esp,%ebp
+  8005b5:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  8005b8:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  8005bb:	50                   	push   %eax
+  8005bc:	ff 75 10             	push   0x10(%ebp)
+  8005bf:	ff 75 0c             	push   0xc(%ebp)
+  8005c2:	ff 75 08             	push   0x8(%ebp)
+  8005c5:	e8 05 00 00 00       	call   8005cf <vprintfmt>
+}
+  8005ca:	83 c4 10             	add    $0x10,%esp
+  8005cd:	c9                   	leave
+  8005ce:	c3                   	ret
+
+008005cf <vprintfmt>:
+{
+  8005cf:	55                   	push   %ebp
+  8005d0:	89 e5                	mov    %esp,%ebp
+  8005d2:	57                   	push   %edi
+  8005d3:	56                   	push   %esi
+  8005d4:	53                   	push   %ebx
+  8005d5:	83 ec 2c             	sub    $0x2c,%esp
+  8005d8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005db:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8005de:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8005e1:	eb 0a                	jmp    8005ed <vprintfmt+0x1e>
+      putch(ch, putdat);
+  8005e3:	83 ec 08             	sub    $0x8,%esp
+  8005e6:	53                   	push   %ebx
+  8005e7:	50                   	push   %eax
+  8005e8:	ff d6                	call   *%esi
+  8005ea:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  8005ed:	83 c7 01             	add    $0x1,%edi
+  8005f0:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8005f4:	83 f8 25             	cmp    $0x25,%eax
+  8005f7:	74 0c                	je     800605 <vprintfmt+0x36>
+      if (ch == '\0')
+  8005f9:	85 c0                	test   %eax,%eax
+  8005fb:	75 e6                	jne    8005e3 <vprintfmt+0x14>
+}
+  8005fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800600:	5b                   	pop    %ebx
+  800601:	5e                   	pop    %esi
+  800602:	5f                   	pop    %edi
+  800603:	5d                   	pop    %ebp
+  800604:	c3                   	ret
+    padc = ' ';
+  800605:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  800609:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  800610:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  800617:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  80061e:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  800623:	8d 47 01             	lea    0x1(%edi),%eax
+  800626:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800629:	0f b6 17             	movzbl (%edi),%edx
+  80062c:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80062f:	3c 55                	cmp    $0x55,%al
+  800631:	0f 87 cf 03 00 00    	ja     800a06 <vprintfmt+0x437>
+  800637:	0f b6 c0             	movzbl %al,%eax
+  80063a:	ff 24 85 e0 3a 80 00 	jmp    *0x803ae0(,%eax,4)
+  800641:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  800644:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800648:	eb d9                	jmp    800623 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  80064a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80064d:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800651:	eb d0                	jmp    800623 <vprintfmt+0x54>
+  800653:	0f b6 d2             	movzbl %dl,%edx
+  800656:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  800659:	b8 00 00 00 00       	mov    $0x0,%eax
+  80065e:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  800661:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800664:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  800668:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  80066b:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80066e:	83 f9 09             	cmp    $0x9,%ecx
+  800671:	77 55                	ja     8006c8 <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  800673:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  800676:	eb e9                	jmp    800661 <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  800678:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067b:	8b 00                	mov    (%eax),%eax
+  80067d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800680:	8b 45 14             	mov    0x14(%ebp),%eax
+  800683:	8d 40 04             	lea    0x4(%eax),%eax
+  800686:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  800689:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  80068c:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800690:	79 91                	jns    800623 <vprintfmt+0x54>
+        width = precision, precision = -1;
+  800692:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800695:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800698:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80069f:	eb 82                	jmp    800623 <vprintfmt+0x54>
+      if (width < 0)
+  8006a1:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8006a4:	85 d2                	test   %edx,%edx
+  8006a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006ab:	0f 49 c2             	cmovns %edx,%eax
+  8006ae:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  8006b1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  8006b4:	e9 6a ff ff ff       	jmp    800623 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  8006b9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  8006bc:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  8006c3:	e9 5b ff ff ff       	jmp    800623 <vprintfmt+0x54>
+  8006c8:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8006cb:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8006ce:	eb bc                	jmp    80068c <vprintfmt+0xbd>
+      lflag++;
+  8006d0:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  8006d3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  8006d6:	e9 48 ff ff ff       	jmp    800623 <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  8006db:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006de:	8d 78 04             	lea    0x4(%eax),%edi
+  8006e1:	83 ec 08             	sub    $0x8,%esp
+  8006e4:	53                   	push   %ebx
+  8006e5:	ff 30                	push   (%eax)
+  8006e7:	ff d6                	call   *%esi
+      break;
+  8006e9:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  8006ec:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  8006ef:	e9 b1 02 00 00       	jmp    8009a5 <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  8006f4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f7:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  8006fa:	8b 10                	mov    (%eax),%edx
+  8006fc:	89 d0                	mov    %edx,%eax
+  8006fe:	f7 d8                	neg    %eax
+  800700:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800703:	83 f8 10             	cmp    $0x10,%eax
+  800706:	7f 23                	jg     80072b <vprintfmt+0x15c>
+  800708:	8b 14 85 40 3c 80 00 	mov    0x803c40(,%eax,4),%edx
+  80070f:	85 d2                	test   %edx,%edx
+  800711:	74 18                	je     80072b <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  800713:	52                   	push   %edx
+  800714:	68 8a 3d 80 00       	push   $0x803d8a
+  800719:	53                   	push   %ebx
+  80071a:	56                   	push   %esi
+  80071b:	e8 92 fe ff ff       	call   8005b2 <printfmt>
+  800720:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  800723:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800726:	e9 7a 02 00 00       	jmp    8009a5 <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  80072b:	50                   	push   %eax
+  80072c:	68 a3 39 80 00       	push   $0x8039a3
+  800731:	53                   	push   %ebx
+  800732:	56                   	push   %esi
+  800733:	e8 7a fe ff ff       	call   8005b2 <printfmt>
+  800738:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  80073b:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  80073e:	e9 62 02 00 00       	jmp    8009a5 <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  800743:	8b 45 14             	mov    0x14(%ebp),%eax
+  800746:	83 c0 04             	add    $0x4,%eax
+  800749:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80074c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80074f:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  800751:	85 c9                	test   %ecx,%ecx
+  800753:	b8 9c 39 80 00       	mov    $0x80399c,%eax
+  800758:	0f 45 c1             	cmovne %ecx,%eax
+  80075b:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  80075e:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800762:	7e 06                	jle    80076a <vprintfmt+0x19b>
+  800764:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800768:	75 0b                	jne    800775 <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  80076a:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80076d:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800770:	89 75 08             	mov    %esi,0x8(%ebp)
+  800773:	eb 5c                	jmp    8007d1 <vprintfmt+0x202>
+  800775:	83 ec 08             	sub    $0x8,%esp
+  800778:	ff 75 d0             	push   -0x30(%ebp)
+  80077b:	ff 75 cc             	push   -0x34(%ebp)
+  80077e:	e8 20 03 00 00       	call   800aa3 <strnlen>
+  800783:	89 c2                	mov    %eax,%edx
+  800785:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800788:	29 d0                	sub    %edx,%eax
+  80078a:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  80078d:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800791:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800794:	89 75 08             	mov    %esi,0x8(%ebp)
+  800797:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800799:	eb 0e                	jmp    8007a9 <vprintfmt+0x1da>
+          putch(padc, putdat);
+  80079b:	83 ec 08             	sub    $0x8,%esp
+  80079e:	53                   	push   %ebx
+  80079f:	57                   	push   %edi
+  8007a0:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8007a3:	83 ee 01             	sub    $0x1,%esi
+  8007a6:	83 c4 10             	add    $0x10,%esp
+  8007a9:	85 f6                	test   %esi,%esi
+  8007ab:	7f ee                	jg     80079b <vprintfmt+0x1cc>
+  8007ad:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8007b0:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007b3:	85 c0                	test   %eax,%eax
+  8007b5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8007ba:	0f 49 d0             	cmovns %eax,%edx
+  8007bd:	29 d0                	sub    %edx,%eax
+  8007bf:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8007c2:	eb a6                	jmp    80076a <vprintfmt+0x19b>
+          putch(ch, putdat);
+  8007c4:	83 ec 08             	sub    $0x8,%esp
+  8007c7:	53                   	push   %ebx
+  8007c8:	52                   	push   %edx
+  8007c9:	ff 55 08             	call   *0x8(%ebp)
+  8007cc:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8007cf:	89 f1                	mov    %esi,%ecx
+  8007d1:	8d 71 01             	lea    0x1(%ecx),%esi
+  8007d4:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8007d8:	0f be d0             	movsbl %al,%edx
+  8007db:	85 d2                	test   %edx,%edx
+  8007dd:	74 28                	je     800807 <vprintfmt+0x238>
+  8007df:	85 ff                	test   %edi,%edi
+  8007e1:	78 05                	js     8007e8 <vprintfmt+0x219>
+  8007e3:	83 ef 01             	sub    $0x1,%edi
+  8007e6:	78 30                	js     800818 <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  8007e8:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8007ec:	74 d6                	je     8007c4 <vprintfmt+0x1f5>
+  8007ee:	0f be c0             	movsbl %al,%eax
+  8007f1:	83 e8 20             	sub    $0x20,%eax
+  8007f4:	83 f8 5e             	cmp    $0x5e,%eax
+  8007f7:	76 cb                	jbe    8007c4 <vprintfmt+0x1f5>
+          putch('?', putdat);
+  8007f9:	83 ec 08             	sub    $0x8,%esp
+  8007fc:	53                   	push   %ebx
+  8007fd:	6a 3f                	push   $0x3f
+  8007ff:	ff 55 08             	call   *0x8(%ebp)
+  800802:	83 c4 10             	add    $0x10,%esp
+  800805:	eb c8                	jmp    8007cf <vprintfmt+0x200>
+  800807:	8b 75 08             	mov    0x8(%ebp),%esi
+  80080a:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80080d:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800810:	01 d0                	add    %edx,%eax
+  800812:	29 c8                	sub    %ecx,%eax
+  800814:	89 c7                	mov    %eax,%edi
+  800816:	eb 13                	jmp    80082b <vprintfmt+0x25c>
+  800818:	8b 75 08             	mov    0x8(%ebp),%esi
+  80081b:	eb ed                	jmp    80080a <vprintfmt+0x23b>
+        putch(' ', putdat);
+  80081d:	83 ec 08             	sub    $0x8,%esp
+  800820:	53                   	push   %ebx
+  800821:	6a 20                	push   $0x20
+  800823:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  800825:	83 ef 01             	sub    $0x1,%edi
+  800828:	83 c4 10             	add    $0x10,%esp
+  80082b:	85 ff                	test   %edi,%edi
+  80082d:	7f ee                	jg     80081d <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  80082f:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800832:	89 45 14             	mov    %eax,0x14(%ebp)
+  800835:	e9 6b 01 00 00       	jmp    8009a5 <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  80083a:	83 f9 01             	cmp    $0x1,%ecx
+  80083d:	7f 1f                	jg     80085e <vprintfmt+0x28f>
+  else if (lflag)
+  80083f:	85 c9                	test   %ecx,%ecx
+  800841:	74 67                	je     8008aa <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  800843:	8b 45 14             	mov    0x14(%ebp),%eax
+  800846:	8b 00                	mov    (%eax),%eax
+  800848:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80084b:	89 c1                	mov    %eax,%ecx
+  80084d:	c1 f9 1f             	sar    $0x1f,%ecx
+  800850:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800853:	8b 45 14             	mov    0x14(%ebp),%eax
+  800856:	8d 40 04             	lea    0x4(%eax),%eax
+  800859:	89 45 14             	mov    %eax,0x14(%ebp)
+  80085c:	eb 17                	jmp    800875 <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  80085e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800861:	8b 50 04             	mov    0x4(%eax),%edx
+  800864:	8b 00                	mov    (%eax),%eax
+  800866:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800869:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80086c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80086f:	8d 40 08             	lea    0x8(%eax),%eax
+  800872:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  800875:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800878:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  80087b:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  800880:	85 c9                	test   %ecx,%ecx
+  800882:	0f 89 03 01 00 00    	jns    80098b <vprintfmt+0x3bc>
+        putch('-', putdat);
+  800888:	83 ec 08             	sub    $0x8,%esp
+  80088b:	53                   	push   %ebx
+  80088c:	6a 2d                	push   $0x2d
+  80088e:	ff d6                	call   *%esi
+        num = -(long long)num;
+  800890:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800893:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800896:	f7 da                	neg    %edx
+  800898:	83 d1 00             	adc    $0x0,%ecx
+  80089b:	f7 d9                	neg    %ecx
+  80089d:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  8008a0:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8008a5:	e9 e1 00 00 00       	jmp    80098b <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  8008aa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008ad:	8b 00                	mov    (%eax),%eax
+  8008af:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8008b2:	89 c1                	mov    %eax,%ecx
+  8008b4:	c1 f9 1f             	sar    $0x1f,%ecx
+  8008b7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8008ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008bd:	8d 40 04             	lea    0x4(%eax),%eax
+  8008c0:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008c3:	eb b0                	jmp    800875 <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  8008c5:	83 f9 01             	cmp    $0x1,%ecx
+  8008c8:	7f 1e                	jg     8008e8 <vprintfmt+0x319>
+  else if (lflag)
+  8008ca:	85 c9                	test   %ecx,%ecx
+  8008cc:	74 32                	je     800900 <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  8008ce:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008d1:	8b 10                	mov    (%eax),%edx
+  8008d3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008d8:	8d 40 04             	lea    0x4(%eax),%eax
+  8008db:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  8008de:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  8008e3:	e9 a3 00 00 00       	jmp    80098b <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  8008e8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008eb:	8b 10                	mov    (%eax),%edx
+  8008ed:	8b 48 04             	mov    0x4(%eax),%ecx
+  8008f0:	8d 40 08             	lea    0x8(%eax),%eax
+  8008f3:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  8008f6:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  8008fb:	e9 8b 00 00 00       	jmp    80098b <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800900:	8b 45 14             	mov    0x14(%ebp),%eax
+  800903:	8b 10                	mov    (%eax),%edx
+  800905:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80090a:	8d 40 04             	lea    0x4(%eax),%eax
+  80090d:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800910:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  800915:	eb 74                	jmp    80098b <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  800917:	83 f9 01             	cmp    $0x1,%ecx
+  80091a:	7f 1b                	jg     800937 <vprintfmt+0x368>
+  else if (lflag)
+  80091c:	85 c9                	test   %ecx,%ecx
+  80091e:	74 2c                	je     80094c <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  800920:	8b 45 14             	mov    0x14(%ebp),%eax
+  800923:	8b 10                	mov    (%eax),%edx
+  800925:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80092a:	8d 40 04             	lea    0x4(%eax),%eax
+  80092d:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800930:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  800935:	eb 54                	jmp    80098b <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800937:	8b 45 14             	mov    0x14(%ebp),%eax
+  80093a:	8b 10                	mov    (%eax),%edx
+  80093c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80093f:	8d 40 08             	lea    0x8(%eax),%eax
+  800942:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800945:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  80094a:	eb 3f                	jmp    80098b <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  80094c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80094f:	8b 10                	mov    (%eax),%edx
+  800951:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800956:	8d 40 04             	lea    0x4(%eax),%eax
+  800959:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  80095c:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  800961:	eb 28                	jmp    80098b <vprintfmt+0x3bc>
+      putch('0', putdat);
+  800963:	83 ec 08             	sub    $0x8,%esp
+  800966:	53                   	push   %ebx
+  800967:	6a 30                	push   $0x30
+  800969:	ff d6                	call   *%esi
+      putch('x', putdat);
+  80096b:	83 c4 08             	add    $0x8,%esp
+  80096e:	53                   	push   %ebx
+  80096f:	6a 78                	push   $0x78
+  800971:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  800973:	8b 45 14             	mov    0x14(%ebp),%eax
+  800976:	8b 10                	mov    (%eax),%edx
+  800978:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  80097d:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  800980:	8d 40 04             	lea    0x4(%eax),%eax
+  800983:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800986:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  80098b:	83 ec 0c             	sub    $0xc,%esp
+  80098e:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800992:	50                   	push   %eax
+  800993:	ff 75 e0             	push   -0x20(%ebp)
+  800996:	57                   	push   %edi
+  800997:	51                   	push   %ecx
+  800998:	52                   	push   %edx
+  800999:	89 da                	mov    %ebx,%edx
+  80099b:	89 f0                	mov    %esi,%eax
+  80099d:	e8 4a fb ff ff       	call   8004ec <printnum>
+      break;
+  8009a2:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  8009a5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  8009a8:	e9 40 fc ff ff       	jmp    8005ed <vprintfmt+0x1e>
+  if (lflag >= 2)
+  8009ad:	83 f9 01             	cmp    $0x1,%ecx
+  8009b0:	7f 1b                	jg     8009cd <vprintfmt+0x3fe>
+  else if (lflag)
+  8009b2:	85 c9                	test   %ecx,%ecx
+  8009b4:	74 2c                	je     8009e2 <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  8009b6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009b9:	8b 10                	mov    (%eax),%edx
+  8009bb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009c0:	8d 40 04             	lea    0x4(%eax),%eax
+  8009c3:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8009c6:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  8009cb:	eb be                	jmp    80098b <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  8009cd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009d0:	8b 10                	mov    (%eax),%edx
+  8009d2:	8b 48 04             	mov    0x4(%eax),%ecx
+  8009d5:	8d 40 08             	lea    0x8(%eax),%eax
+  8009d8:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8009db:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  8009e0:	eb a9                	jmp    80098b <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8009e2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009e5:	8b 10                	mov    (%eax),%edx
+  8009e7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009ec:	8d 40 04             	lea    0x4(%eax),%eax
+  8009ef:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8009f2:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  8009f7:	eb 92                	jmp    80098b <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  8009f9:	83 ec 08             	sub    $0x8,%esp
+  8009fc:	53                   	push   %ebx
+  8009fd:	6a 25                	push   $0x25
+  8009ff:	ff d6                	call   *%esi
+      break;
+  800a01:	83 c4 10             	add    $0x10,%esp
+  800a04:	eb 9f                	jmp    8009a5 <vprintfmt+0x3d6>
+      putch('%', putdat);
+  800a06:	83 ec 08             	sub    $0x8,%esp
+  800a09:	53                   	push   %ebx
+  800a0a:	6a 25                	push   $0x25
+  800a0c:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  800a0e:	83 c4 10             	add    $0x10,%esp
+  800a11:	89 f8                	mov    %edi,%eax
+  800a13:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800a17:	74 05                	je     800a1e <vprintfmt+0x44f>
+  800a19:	83 e8 01             	sub    $0x1,%eax
+  800a1c:	eb f5                	jmp    800a13 <vprintfmt+0x444>
+  800a1e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800a21:	eb 82                	jmp    8009a5 <vprintfmt+0x3d6>
+
+00800a23 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800a23:	55                   	push   %ebp
+  800a24:	89 e5                	mov    %esp,%ebp
+  800a26:	83 ec 18             	sub    $0x18,%esp
+  800a29:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a2c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  800a2f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800a32:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800a36:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800a39:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  800a40:	85 c0                	test   %eax,%eax
+  800a42:	74 26                	je     800a6a <vsnprintf+0x47>
+  800a44:	85 d2                	test   %edx,%edx
+  800a46:	7e 22                	jle    800a6a <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800a48:	ff 75 14             	push   0x14(%ebp)
+  800a4b:	ff 75 10             	push   0x10(%ebp)
+  800a4e:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800a51:	50                   	push   %eax
+  800a52:	68 95 05 80 00       	push   $0x800595
+  800a57:	e8 73 fb ff ff       	call   8005cf <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800a5c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800a5f:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  800a62:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a65:	83 c4 10             	add    $0x10,%esp
+}
+  800a68:	c9                   	leave
+  800a69:	c3                   	ret
+    return -E_INVAL;
+  800a6a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a6f:	eb f7                	jmp    800a68 <vsnprintf+0x45>
+
+00800a71 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800a71:	55                   	push   %ebp
+  800a72:	89 e5                	mov    %esp,%ebp
+  800a74:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  800a77:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  800a7a:	50                   	push   %eax
+  800a7b:	ff 75 10             	push   0x10(%ebp)
+  800a7e:	ff 75 0c             	push   0xc(%ebp)
+  800a81:	ff 75 08             	push   0x8(%ebp)
+  800a84:	e8 9a ff ff ff       	call   800a23 <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  800a89:	c9                   	leave
+  800a8a:	c3                   	ret
+
+00800a8b <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800a8b:	55                   	push   %ebp
+  800a8c:	89 e5                	mov    %esp,%ebp
+  800a8e:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  800a91:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a96:	eb 03                	jmp    800a9b <strlen+0x10>
+    n++;
+  800a98:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  800a9b:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800a9f:	75 f7                	jne    800a98 <strlen+0xd>
+  return n;
+}
+  800aa1:	5d                   	pop    %ebp
+  800aa2:	c3                   	ret
+
+00800aa3 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800aa3:	55                   	push   %ebp
+  800aa4:	89 e5                	mov    %esp,%ebp
+  800aa6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800aa9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800aac:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ab1:	eb 03                	jmp    800ab6 <strnlen+0x13>
+    n++;
+  800ab3:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800ab6:	39 d0                	cmp    %edx,%eax
+  800ab8:	74 08                	je     800ac2 <strnlen+0x1f>
+  800aba:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800abe:	75 f3                	jne    800ab3 <strnlen+0x10>
+  800ac0:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  800ac2:	89 d0                	mov    %edx,%eax
+  800ac4:	5d                   	pop    %ebp
+  800ac5:	c3                   	ret
+
+00800ac6 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800ac6:	55                   	push   %ebp
+  800ac7:	89 e5                	mov    %esp,%ebp
+  800ac9:	53                   	push   %ebx
+  800aca:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800acd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  800ad0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ad5:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800ad9:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800adc:	83 c0 01             	add    $0x1,%eax
+  800adf:	84 d2                	test   %dl,%dl
+  800ae1:	75 f2                	jne    800ad5 <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  800ae3:	89 c8                	mov    %ecx,%eax
+  800ae5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ae8:	c9                   	leave
+  800ae9:	c3                   	ret
+
+00800aea <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800aea:	55                   	push   %ebp
+  800aeb:	89 e5                	mov    %esp,%ebp
+  800aed:	53                   	push   %ebx
+  800aee:	83 ec 10             	sub    $0x10,%esp
+  800af1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  800af4:	53                   	push   %ebx
+  800af5:	e8 91 ff ff ff       	call   800a8b <strlen>
+  800afa:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  800afd:	ff 75 0c             	push   0xc(%ebp)
+  800b00:	01 d8                	add    %ebx,%eax
+  800b02:	50                   	push   %eax
+  800b03:	e8 be ff ff ff       	call   800ac6 <strcpy>
+  return dst;
+}
+  800b08:	89 d8                	mov    %ebx,%eax
+  800b0a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b0d:	c9                   	leave
+  800b0e:	c3                   	ret
+
+00800b0f <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  800b0f:	55                   	push   %ebp
+  800b10:	89 e5                	mov    %esp,%ebp
+  800b12:	56                   	push   %esi
+  800b13:	53                   	push   %ebx
+  800b14:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b17:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  800b1a:	89 f3                	mov    %esi,%ebx
+  800b1c:	03 5d 10             	add    0x10(%ebp),%ebx
+  800b1f:	89 f0                	mov    %esi,%eax
+  800b21:	eb 0f                	jmp    800b32 <strncpy+0x23>
+    *dst++ = *src;
+  800b23:	83 c0 01             	add    $0x1,%eax
+  800b26:	0f b6 0a             	movzbl (%edx),%ecx
+  800b29:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  800b2c:	80 f9 01             	cmp    $0x1,%cl
+  800b2f:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  800b32:	39 d8                	cmp    %ebx,%eax
+  800b34:	75 ed                	jne    800b23 <strncpy+0x14>
+  }
+  return ret;
+}
+  800b36:	89 f0                	mov    %esi,%eax
+  800b38:	5b                   	pop    %ebx
+  800b39:	5e                   	pop    %esi
+  800b3a:	5d                   	pop    %ebp
+  800b3b:	c3                   	ret
+
+00800b3c <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800b3c:	55                   	push   %ebp
+  800b3d:	89 e5                	mov    %esp,%ebp
+  800b3f:	56                   	push   %esi
+  800b40:	53                   	push   %ebx
+  800b41:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b44:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b47:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  800b4a:	89 f0                	mov    %esi,%eax
+  800b4c:	85 d2                	test   %edx,%edx
+  800b4e:	74 21                	je     800b71 <strlcpy+0x35>
+  800b50:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800b54:	89 f2                	mov    %esi,%edx
+  800b56:	eb 09                	jmp    800b61 <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  800b58:	83 c1 01             	add    $0x1,%ecx
+  800b5b:	83 c2 01             	add    $0x1,%edx
+  800b5e:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  800b61:	39 c2                	cmp    %eax,%edx
+  800b63:	74 09                	je     800b6e <strlcpy+0x32>
+  800b65:	0f b6 19             	movzbl (%ecx),%ebx
+  800b68:	84 db                	test   %bl,%bl
+  800b6a:	75 ec                	jne    800b58 <strlcpy+0x1c>
+  800b6c:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  800b6e:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  800b71:	29 f0                	sub    %esi,%eax
+}
+  800b73:	5b                   	pop    %ebx
+  800b74:	5e                   	pop    %esi
+  800b75:	5d                   	pop    %ebp
+  800b76:	c3                   	ret
+
+00800b77 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800b77:	55                   	push   %ebp
+  800b78:	89 e5                	mov    %esp,%ebp
+  800b7a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b7d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  800b80:	eb 06                	jmp    800b88 <strcmp+0x11>
+    p++, q++;
+  800b82:	83 c1 01             	add    $0x1,%ecx
+  800b85:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  800b88:	0f b6 01             	movzbl (%ecx),%eax
+  800b8b:	84 c0                	test   %al,%al
+  800b8d:	74 04                	je     800b93 <strcmp+0x1c>
+  800b8f:	3a 02                	cmp    (%edx),%al
+  800b91:	74 ef                	je     800b82 <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  800b93:	0f b6 c0             	movzbl %al,%eax
+  800b96:	0f b6 12             	movzbl (%edx),%edx
+  800b99:	29 d0                	sub    %edx,%eax
+}
+  800b9b:	5d                   	pop    %ebp
+  800b9c:	c3                   	ret
+
+00800b9d <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800b9d:	55                   	push   %ebp
+  800b9e:	89 e5                	mov    %esp,%ebp
+  800ba0:	53                   	push   %ebx
+  800ba1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ba4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ba7:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  800baa:	eb 09                	jmp    800bb5 <strncmp+0x18>
+    n--, p++, q++;
+  800bac:	83 ea 01             	sub    $0x1,%edx
+  800baf:	83 c0 01             	add    $0x1,%eax
+  800bb2:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  800bb5:	85 d2                	test   %edx,%edx
+  800bb7:	74 18                	je     800bd1 <strncmp+0x34>
+  800bb9:	0f b6 18             	movzbl (%eax),%ebx
+  800bbc:	84 db                	test   %bl,%bl
+  800bbe:	74 04                	je     800bc4 <strncmp+0x27>
+  800bc0:	3a 19                	cmp    (%ecx),%bl
+  800bc2:	74 e8                	je     800bac <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800bc4:	0f b6 00             	movzbl (%eax),%eax
+  800bc7:	0f b6 11             	movzbl (%ecx),%edx
+  800bca:	29 d0                	sub    %edx,%eax
+}
+  800bcc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800bcf:	c9                   	leave
+  800bd0:	c3                   	ret
+    return 0;
+  800bd1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bd6:	eb f4                	jmp    800bcc <strncmp+0x2f>
+
+00800bd8 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800bd8:	55                   	push   %ebp
+  800bd9:	89 e5                	mov    %esp,%ebp
+  800bdb:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bde:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800be2:	eb 03                	jmp    800be7 <strchr+0xf>
+  800be4:	83 c0 01             	add    $0x1,%eax
+  800be7:	0f b6 10             	movzbl (%eax),%edx
+  800bea:	84 d2                	test   %dl,%dl
+  800bec:	74 06                	je     800bf4 <strchr+0x1c>
+    if (*s == c)
+  800bee:	38 ca                	cmp    %cl,%dl
+  800bf0:	75 f2                	jne    800be4 <strchr+0xc>
+  800bf2:	eb 05                	jmp    800bf9 <strchr+0x21>
+      return (char*)s;
+  return 0;
+  800bf4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800bf9:	5d                   	pop    %ebp
+  800bfa:	c3                   	ret
+
+00800bfb <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800bfb:	55                   	push   %ebp
+  800bfc:	89 e5                	mov    %esp,%ebp
+  800bfe:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c01:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800c05:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  800c08:	38 ca                	cmp    %cl,%dl
+  800c0a:	74 09                	je     800c15 <strfind+0x1a>
+  800c0c:	84 d2                	test   %dl,%dl
+  800c0e:	74 05                	je     800c15 <strfind+0x1a>
+  for (; *s; s++)
+  800c10:	83 c0 01             	add    $0x1,%eax
+  800c13:	eb f0                	jmp    800c05 <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  800c15:	5d                   	pop    %ebp
+  800c16:	c3                   	ret
+
+00800c17 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800c17:	55                   	push   %ebp
+  800c18:	89 e5                	mov    %esp,%ebp
+  800c1a:	57                   	push   %edi
+  800c1b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800c1e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  800c21:	85 c9                	test   %ecx,%ecx
+  800c23:	74 20                	je     800c45 <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  800c25:	89 f8                	mov    %edi,%eax
+  800c27:	09 c8                	or     %ecx,%eax
+  800c29:	a8 03                	test   $0x3,%al
+  800c2b:	75 12                	jne    800c3f <memset+0x28>
+    c &= 0xFF;
+  800c2d:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800c31:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  800c37:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  800c3a:	fc                   	cld
+  800c3b:	f3 ab                	rep stos %eax,%es:(%edi)
+  800c3d:	eb 06                	jmp    800c45 <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  800c3f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c42:	fc                   	cld
+  800c43:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  800c45:	89 f8                	mov    %edi,%eax
+  800c47:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800c4a:	c9                   	leave
+  800c4b:	c3                   	ret
+
+00800c4c <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800c4c:	55                   	push   %ebp
+  800c4d:	89 e5                	mov    %esp,%ebp
+  800c4f:	57                   	push   %edi
+  800c50:	56                   	push   %esi
+  800c51:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c54:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800c57:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  800c5a:	39 c6                	cmp    %eax,%esi
+  800c5c:	73 32                	jae    800c90 <memmove+0x44>
+  800c5e:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800c61:	39 d0                	cmp    %edx,%eax
+  800c63:	73 2b                	jae    800c90 <memmove+0x44>
+    s += n;
+    d += n;
+  800c65:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c68:	89 d6                	mov    %edx,%esi
+  800c6a:	09 fe                	or     %edi,%esi
+  800c6c:	09 ce                	or     %ecx,%esi
+  800c6e:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800c74:	75 0e                	jne    800c84 <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800c76:	83 ef 04             	sub    $0x4,%edi
+  800c79:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800c7c:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  800c7f:	fd                   	std
+  800c80:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c82:	eb 09                	jmp    800c8d <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800c84:	83 ef 01             	sub    $0x1,%edi
+  800c87:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  800c8a:	fd                   	std
+  800c8b:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  800c8d:	fc                   	cld
+  800c8e:	eb 1a                	jmp    800caa <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c90:	89 f2                	mov    %esi,%edx
+  800c92:	09 c2                	or     %eax,%edx
+  800c94:	09 ca                	or     %ecx,%edx
+  800c96:	f6 c2 03             	test   $0x3,%dl
+  800c99:	75 0a                	jne    800ca5 <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800c9b:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  800c9e:	89 c7                	mov    %eax,%edi
+  800ca0:	fc                   	cld
+  800ca1:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800ca3:	eb 05                	jmp    800caa <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  800ca5:	89 c7                	mov    %eax,%edi
+  800ca7:	fc                   	cld
+  800ca8:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  800caa:	5e                   	pop    %esi
+  800cab:	5f                   	pop    %edi
+  800cac:	5d                   	pop    %ebp
+  800cad:	c3                   	ret
+
+00800cae <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800cae:	55                   	push   %ebp
+  800caf:	89 e5                	mov    %esp,%ebp
+  800cb1:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  800cb4:	ff 75 10             	push   0x10(%ebp)
+  800cb7:	ff 75 0c             	push   0xc(%ebp)
+  800cba:	ff 75 08             	push   0x8(%ebp)
+  800cbd:	e8 8a ff ff ff       	call   800c4c <memmove>
+}
+  800cc2:	c9                   	leave
+  800cc3:	c3                   	ret
+
+00800cc4 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800cc4:	55                   	push   %ebp
+  800cc5:	89 e5                	mov    %esp,%ebp
+  800cc7:	56                   	push   %esi
+  800cc8:	53                   	push   %ebx
+  800cc9:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ccc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  800ccf:	89 c6                	mov    %eax,%esi
+  800cd1:	03 75 10             	add    0x10(%ebp),%esi
+  800cd4:	eb 06                	jmp    800cdc <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  800cd6:	83 c0 01             	add    $0x1,%eax
+  800cd9:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  800cdc:	39 f0                	cmp    %esi,%eax
+  800cde:	74 14                	je     800cf4 <memcmp+0x30>
+    if (*s1 != *s2)
+  800ce0:	0f b6 08             	movzbl (%eax),%ecx
+  800ce3:	0f b6 1a             	movzbl (%edx),%ebx
+  800ce6:	38 d9                	cmp    %bl,%cl
+  800ce8:	74 ec                	je     800cd6 <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  800cea:	0f b6 c1             	movzbl %cl,%eax
+  800ced:	0f b6 db             	movzbl %bl,%ebx
+  800cf0:	29 d8                	sub    %ebx,%eax
+  800cf2:	eb 05                	jmp    800cf9 <memcmp+0x35>
+  }
+
+  return 0;
+  800cf4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800cf9:	5b                   	pop    %ebx
+  800cfa:	5e                   	pop    %esi
+  800cfb:	5d                   	pop    %ebp
+  800cfc:	c3                   	ret
+
+00800cfd <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800cfd:	55                   	push   %ebp
+  800cfe:	89 e5                	mov    %esp,%ebp
+  800d00:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d03:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  800d06:	89 c2                	mov    %eax,%edx
+  800d08:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  800d0b:	eb 03                	jmp    800d10 <memfind+0x13>
+  800d0d:	83 c0 01             	add    $0x1,%eax
+  800d10:	39 d0                	cmp    %edx,%eax
+  800d12:	73 04                	jae    800d18 <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  800d14:	38 08                	cmp    %cl,(%eax)
+  800d16:	75 f5                	jne    800d0d <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  800d18:	5d                   	pop    %ebp
+  800d19:	c3                   	ret
+
+00800d1a <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800d1a:	55                   	push   %ebp
+  800d1b:	89 e5                	mov    %esp,%ebp
+  800d1d:	57                   	push   %edi
+  800d1e:	56                   	push   %esi
+  800d1f:	53                   	push   %ebx
+  800d20:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d23:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  800d26:	eb 03                	jmp    800d2b <strtol+0x11>
+    s++;
+  800d28:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  800d2b:	0f b6 02             	movzbl (%edx),%eax
+  800d2e:	3c 20                	cmp    $0x20,%al
+  800d30:	74 f6                	je     800d28 <strtol+0xe>
+  800d32:	3c 09                	cmp    $0x9,%al
+  800d34:	74 f2                	je     800d28 <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  800d36:	3c 2b                	cmp    $0x2b,%al
+  800d38:	74 2a                	je     800d64 <strtol+0x4a>
+  int neg = 0;
+  800d3a:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  800d3f:	3c 2d                	cmp    $0x2d,%al
+  800d41:	74 2b                	je     800d6e <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d43:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800d49:	75 0f                	jne    800d5a <strtol+0x40>
+  800d4b:	80 3a 30             	cmpb   $0x30,(%edx)
+  800d4e:	74 28                	je     800d78 <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  800d50:	85 db                	test   %ebx,%ebx
+  800d52:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d57:	0f 44 d8             	cmove  %eax,%ebx
+  800d5a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d5f:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800d62:	eb 46                	jmp    800daa <strtol+0x90>
+    s++;
+  800d64:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  800d67:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d6c:	eb d5                	jmp    800d43 <strtol+0x29>
+    s++, neg = 1;
+  800d6e:	83 c2 01             	add    $0x1,%edx
+  800d71:	bf 01 00 00 00       	mov    $0x1,%edi
+  800d76:	eb cb                	jmp    800d43 <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d78:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800d7c:	74 0e                	je     800d8c <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  800d7e:	85 db                	test   %ebx,%ebx
+  800d80:	75 d8                	jne    800d5a <strtol+0x40>
+    s++, base = 8;
+  800d82:	83 c2 01             	add    $0x1,%edx
+  800d85:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800d8a:	eb ce                	jmp    800d5a <strtol+0x40>
+    s += 2, base = 16;
+  800d8c:	83 c2 02             	add    $0x2,%edx
+  800d8f:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800d94:	eb c4                	jmp    800d5a <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  800d96:	0f be c0             	movsbl %al,%eax
+  800d99:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  800d9c:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800d9f:	7d 3a                	jge    800ddb <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  800da1:	83 c2 01             	add    $0x1,%edx
+  800da4:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800da8:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  800daa:	0f b6 02             	movzbl (%edx),%eax
+  800dad:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800db0:	89 f3                	mov    %esi,%ebx
+  800db2:	80 fb 09             	cmp    $0x9,%bl
+  800db5:	76 df                	jbe    800d96 <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  800db7:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800dba:	89 f3                	mov    %esi,%ebx
+  800dbc:	80 fb 19             	cmp    $0x19,%bl
+  800dbf:	77 08                	ja     800dc9 <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  800dc1:	0f be c0             	movsbl %al,%eax
+  800dc4:	83 e8 57             	sub    $0x57,%eax
+  800dc7:	eb d3                	jmp    800d9c <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  800dc9:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800dcc:	89 f3                	mov    %esi,%ebx
+  800dce:	80 fb 19             	cmp    $0x19,%bl
+  800dd1:	77 08                	ja     800ddb <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  800dd3:	0f be c0             	movsbl %al,%eax
+  800dd6:	83 e8 37             	sub    $0x37,%eax
+  800dd9:	eb c1                	jmp    800d9c <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  800ddb:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800ddf:	74 05                	je     800de6 <strtol+0xcc>
+    *endptr = (char*)s;
+  800de1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800de4:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  800de6:	89 c8                	mov    %ecx,%eax
+  800de8:	f7 d8                	neg    %eax
+  800dea:	85 ff                	test   %edi,%edi
+  800dec:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800def:	89 c8                	mov    %ecx,%eax
+  800df1:	5b                   	pop    %ebx
+  800df2:	5e                   	pop    %esi
+  800df3:	5f                   	pop    %edi
+  800df4:	5d                   	pop    %ebp
+  800df5:	c3                   	ret
+
+00800df6 <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800df6:	55                   	push   %ebp
+  800df7:	89 e5                	mov    %esp,%ebp
+  800df9:	57                   	push   %edi
+  800dfa:	56                   	push   %esi
+  800dfb:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800dfc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e01:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e04:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e07:	89 c3                	mov    %eax,%ebx
+  800e09:	89 c7                	mov    %eax,%edi
+  800e0b:	89 c6                	mov    %eax,%esi
+  800e0d:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800e0f:	5b                   	pop    %ebx
+  800e10:	5e                   	pop    %esi
+  800e11:	5f                   	pop    %edi
+  800e12:	5d                   	pop    %ebp
+  800e13:	c3                   	ret
+
+00800e14 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800e14:	55                   	push   %ebp
+  800e15:	89 e5                	mov    %esp,%ebp
+  800e17:	57                   	push   %edi
+  800e18:	56                   	push   %esi
+  800e19:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e1a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e1f:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e24:	89 d1                	mov    %edx,%ecx
+  800e26:	89 d3                	mov    %edx,%ebx
+  800e28:	89 d7                	mov    %edx,%edi
+  800e2a:	89 d6                	mov    %edx,%esi
+  800e2c:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800e2e:	5b                   	pop    %ebx
+  800e2f:	5e                   	pop    %esi
+  800e30:	5f                   	pop    %edi
+  800e31:	5d                   	pop    %ebp
+  800e32:	c3                   	ret
+
+00800e33 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800e33:	55                   	push   %ebp
+  800e34:	89 e5                	mov    %esp,%ebp
+  800e36:	57                   	push   %edi
+  800e37:	56                   	push   %esi
+  800e38:	53                   	push   %ebx
+  800e39:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e3c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e41:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e44:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e49:	89 cb                	mov    %ecx,%ebx
+  800e4b:	89 cf                	mov    %ecx,%edi
+  800e4d:	89 ce                	mov    %ecx,%esi
+  800e4f:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e51:	85 c0                	test   %eax,%eax
+  800e53:	7f 08                	jg     800e5d <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800e55:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e58:	5b                   	pop    %ebx
+  800e59:	5e                   	pop    %esi
+  800e5a:	5f                   	pop    %edi
+  800e5b:	5d                   	pop    %ebp
+  800e5c:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e5d:	83 ec 0c             	sub    $0xc,%esp
+  800e60:	50                   	push   %eax
+  800e61:	6a 03                	push   $0x3
+  800e63:	68 a3 3c 80 00       	push   $0x803ca3
+  800e68:	6a 23                	push   $0x23
+  800e6a:	68 c0 3c 80 00       	push   $0x803cc0
+  800e6f:	e8 89 f5 ff ff       	call   8003fd <_panic>
+
+00800e74 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800e74:	55                   	push   %ebp
+  800e75:	89 e5                	mov    %esp,%ebp
+  800e77:	57                   	push   %edi
+  800e78:	56                   	push   %esi
+  800e79:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e7a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e7f:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e84:	89 d1                	mov    %edx,%ecx
+  800e86:	89 d3                	mov    %edx,%ebx
+  800e88:	89 d7                	mov    %edx,%edi
+  800e8a:	89 d6                	mov    %edx,%esi
+  800e8c:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800e8e:	5b                   	pop    %ebx
+  800e8f:	5e                   	pop    %esi
+  800e90:	5f                   	pop    %edi
+  800e91:	5d                   	pop    %ebp
+  800e92:	c3                   	ret
+
+00800e93 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800e93:	55                   	push   %ebp
+  800e94:	89 e5                	mov    %esp,%ebp
+  800e96:	57                   	push   %edi
+  800e97:	56                   	push   %esi
+  800e98:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e99:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e9e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800ea3:	89 d1                	mov    %edx,%ecx
+  800ea5:	89 d3                	mov    %edx,%ebx
+  800ea7:	89 d7                	mov    %edx,%edi
+  800ea9:	89 d6                	mov    %edx,%esi
+  800eab:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800ead:	5b                   	pop    %ebx
+  800eae:	5e                   	pop    %esi
+  800eaf:	5f                   	pop    %edi
+  800eb0:	5d                   	pop    %ebp
+  800eb1:	c3                   	ret
+
+00800eb2 <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  800eb2:	55                   	push   %ebp
+  800eb3:	89 e5                	mov    %esp,%ebp
+  800eb5:	57                   	push   %edi
+  800eb6:	56                   	push   %esi
+  800eb7:	53                   	push   %ebx
+  800eb8:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  800ebb:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  800ebf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ec4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec7:	b8 14 00 00 00       	mov    $0x14,%eax
+  800ecc:	89 df                	mov    %ebx,%edi
+  800ece:	89 de                	mov    %ebx,%esi
+  800ed0:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ed2:	85 c0                	test   %eax,%eax
+  800ed4:	7f 08                	jg     800ede <sys_env_set_cow+0x2c>
+}
+  800ed6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ed9:	5b                   	pop    %ebx
+  800eda:	5e                   	pop    %esi
+  800edb:	5f                   	pop    %edi
+  800edc:	5d                   	pop    %ebp
+  800edd:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ede:	83 ec 0c             	sub    $0xc,%esp
+  800ee1:	50                   	push   %eax
+  800ee2:	6a 14                	push   $0x14
+  800ee4:	68 a3 3c 80 00       	push   $0x803ca3
+  800ee9:	6a 23                	push   $0x23
+  800eeb:	68 c0 3c 80 00       	push   $0x803cc0
+  800ef0:	e8 08 f5 ff ff       	call   8003fd <_panic>
+
+00800ef5 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800ef5:	55                   	push   %ebp
+  800ef6:	89 e5                	mov    %esp,%ebp
+  800ef8:	57                   	push   %edi
+  800ef9:	56                   	push   %esi
+  800efa:	53                   	push   %ebx
+  800efb:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800efe:	be 00 00 00 00       	mov    $0x0,%esi
+  800f03:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f06:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f09:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f0e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f11:	89 f7                	mov    %esi,%edi
+  800f13:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f15:	85 c0                	test   %eax,%eax
+  800f17:	7f 08                	jg     800f21 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  800f19:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f1c:	5b                   	pop    %ebx
+  800f1d:	5e                   	pop    %esi
+  800f1e:	5f                   	pop    %edi
+  800f1f:	5d                   	pop    %ebp
+  800f20:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f21:	83 ec 0c             	sub    $0xc,%esp
+  800f24:	50                   	push   %eax
+  800f25:	6a 04                	push   $0x4
+  800f27:	68 a3 3c 80 00       	push   $0x803ca3
+  800f2c:	6a 23                	push   $0x23
+  800f2e:	68 c0 3c 80 00       	push   $0x803cc0
+  800f33:	e8 c5 f4 ff ff       	call   8003fd <_panic>
+
+00800f38 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800f38:	55                   	push   %ebp
+  800f39:	89 e5                	mov    %esp,%ebp
+  800f3b:	57                   	push   %edi
+  800f3c:	56                   	push   %esi
+  800f3d:	53                   	push   %ebx
+  800f3e:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f41:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f44:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f47:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f4c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f4f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f52:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f55:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f57:	85 c0                	test   %eax,%eax
+  800f59:	7f 08                	jg     800f63 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  800f5b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f5e:	5b                   	pop    %ebx
+  800f5f:	5e                   	pop    %esi
+  800f60:	5f                   	pop    %edi
+  800f61:	5d                   	pop    %ebp
+  800f62:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f63:	83 ec 0c             	sub    $0xc,%esp
+  800f66:	50                   	push   %eax
+  800f67:	6a 05                	push   $0x5
+  800f69:	68 a3 3c 80 00       	push   $0x803ca3
+  800f6e:	6a 23                	push   $0x23
+  800f70:	68 c0 3c 80 00       	push   $0x803cc0
+  800f75:	e8 83 f4 ff ff       	call   8003fd <_panic>
+
+00800f7a <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800f7a:	55                   	push   %ebp
+  800f7b:	89 e5                	mov    %esp,%ebp
+  800f7d:	57                   	push   %edi
+  800f7e:	56                   	push   %esi
+  800f7f:	53                   	push   %ebx
+  800f80:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f83:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f88:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f8b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f8e:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f93:	89 df                	mov    %ebx,%edi
+  800f95:	89 de                	mov    %ebx,%esi
+  800f97:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f99:	85 c0                	test   %eax,%eax
+  800f9b:	7f 08                	jg     800fa5 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  800f9d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fa0:	5b                   	pop    %ebx
+  800fa1:	5e                   	pop    %esi
+  800fa2:	5f                   	pop    %edi
+  800fa3:	5d                   	pop    %ebp
+  800fa4:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800fa5:	83 ec 0c             	sub    $0xc,%esp
+  800fa8:	50                   	push   %eax
+  800fa9:	6a 06                	push   $0x6
+  800fab:	68 a3 3c 80 00       	push   $0x803ca3
+  800fb0:	6a 23                	push   $0x23
+  800fb2:	68 c0 3c 80 00       	push   $0x803cc0
+  800fb7:	e8 41 f4 ff ff       	call   8003fd <_panic>
+
+00800fbc <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  800fbc:	55                   	push   %ebp
+  800fbd:	89 e5                	mov    %esp,%ebp
+  800fbf:	57                   	push   %edi
+  800fc0:	56                   	push   %esi
+  800fc1:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800fc2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fc8:	b8 11 00 00 00       	mov    $0x11,%eax
+  800fcd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fd0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fd3:	8b 75 18             	mov    0x18(%ebp),%esi
+  800fd6:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  800fd8:	5b                   	pop    %ebx
+  800fd9:	5e                   	pop    %esi
+  800fda:	5f                   	pop    %edi
+  800fdb:	5d                   	pop    %ebp
+  800fdc:	c3                   	ret
+
+00800fdd <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  800fdd:	55                   	push   %ebp
+  800fde:	89 e5                	mov    %esp,%ebp
+  800fe0:	57                   	push   %edi
+  800fe1:	56                   	push   %esi
+  800fe2:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800fe3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fe9:	b8 12 00 00 00       	mov    $0x12,%eax
+  800fee:	be 00 00 00 00       	mov    $0x0,%esi
+  800ff3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ff6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ff9:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  800ffb:	5b                   	pop    %ebx
+  800ffc:	5e                   	pop    %esi
+  800ffd:	5f                   	pop    %edi
+  800ffe:	5d                   	pop    %ebp
+  800fff:	c3                   	ret
+
+00801000 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  801000:	55                   	push   %ebp
+  801001:	89 e5                	mov    %esp,%ebp
+  801003:	57                   	push   %edi
+  801004:	56                   	push   %esi
+  801005:	53                   	push   %ebx
+  801006:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801009:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80100e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801011:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801014:	b8 16 00 00 00       	mov    $0x16,%eax
+  801019:	89 df                	mov    %ebx,%edi
+  80101b:	89 de                	mov    %ebx,%esi
+  80101d:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80101f:	85 c0                	test   %eax,%eax
+  801021:	7f 08                	jg     80102b <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  801023:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801026:	5b                   	pop    %ebx
+  801027:	5e                   	pop    %esi
+  801028:	5f                   	pop    %edi
+  801029:	5d                   	pop    %ebp
+  80102a:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80102b:	83 ec 0c             	sub    $0xc,%esp
+  80102e:	50                   	push   %eax
+  80102f:	6a 16                	push   $0x16
+  801031:	68 a3 3c 80 00       	push   $0x803ca3
+  801036:	6a 23                	push   $0x23
+  801038:	68 c0 3c 80 00       	push   $0x803cc0
+  80103d:	e8 bb f3 ff ff       	call   8003fd <_panic>
+
+00801042 <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  801042:	55                   	push   %ebp
+  801043:	89 e5                	mov    %esp,%ebp
+  801045:	57                   	push   %edi
+  801046:	56                   	push   %esi
+  801047:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801048:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80104d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801050:	b8 17 00 00 00       	mov    $0x17,%eax
+  801055:	89 cb                	mov    %ecx,%ebx
+  801057:	89 cf                	mov    %ecx,%edi
+  801059:	89 ce                	mov    %ecx,%esi
+  80105b:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  80105d:	5b                   	pop    %ebx
+  80105e:	5e                   	pop    %esi
+  80105f:	5f                   	pop    %edi
+  801060:	5d                   	pop    %ebp
+  801061:	c3                   	ret
+
+00801062 <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  801062:	55                   	push   %ebp
+  801063:	89 e5                	mov    %esp,%ebp
+  801065:	57                   	push   %edi
+  801066:	56                   	push   %esi
+  801067:	53                   	push   %ebx
+  801068:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80106b:	be 00 00 00 00       	mov    $0x0,%esi
+  801070:	8b 55 08             	mov    0x8(%ebp),%edx
+  801073:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801076:	b8 18 00 00 00       	mov    $0x18,%eax
+  80107b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80107e:	89 f7                	mov    %esi,%edi
+  801080:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801082:	85 c0                	test   %eax,%eax
+  801084:	7f 08                	jg     80108e <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  801086:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801089:	5b                   	pop    %ebx
+  80108a:	5e                   	pop    %esi
+  80108b:	5f                   	pop    %edi
+  80108c:	5d                   	pop    %ebp
+  80108d:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80108e:	83 ec 0c             	sub    $0xc,%esp
+  801091:	50                   	push   %eax
+  801092:	6a 18                	push   $0x18
+  801094:	68 a3 3c 80 00       	push   $0x803ca3
+  801099:	6a 23                	push   $0x23
+  80109b:	68 c0 3c 80 00       	push   $0x803cc0
+  8010a0:	e8 58 f3 ff ff       	call   8003fd <_panic>
+
+008010a5 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  8010a5:	55                   	push   %ebp
+  8010a6:	89 e5                	mov    %esp,%ebp
+  8010a8:	57                   	push   %edi
+  8010a9:	56                   	push   %esi
+  8010aa:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8010ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8010b0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010b6:	b8 19 00 00 00       	mov    $0x19,%eax
+  8010bb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010be:	89 f7                	mov    %esi,%edi
+  8010c0:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  8010c2:	5b                   	pop    %ebx
+  8010c3:	5e                   	pop    %esi
+  8010c4:	5f                   	pop    %edi
+  8010c5:	5d                   	pop    %ebp
+  8010c6:	c3                   	ret
+
+008010c7 <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  8010c7:	55                   	push   %ebp
+  8010c8:	89 e5                	mov    %esp,%ebp
+  8010ca:	57                   	push   %edi
+  8010cb:	56                   	push   %esi
+  8010cc:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8010cd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010d2:	b8 15 00 00 00       	mov    $0x15,%eax
+  8010d7:	89 d1                	mov    %edx,%ecx
+  8010d9:	89 d3                	mov    %edx,%ebx
+  8010db:	89 d7                	mov    %edx,%edi
+  8010dd:	89 d6                	mov    %edx,%esi
+  8010df:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8010e1:	5b                   	pop    %ebx
+  8010e2:	5e                   	pop    %esi
+  8010e3:	5f                   	pop    %edi
+  8010e4:	5d                   	pop    %ebp
+  8010e5:	c3                   	ret
+
+008010e6 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8010e6:	55                   	push   %ebp
+  8010e7:	89 e5                	mov    %esp,%ebp
+  8010e9:	57                   	push   %edi
+  8010ea:	56                   	push   %esi
+  8010eb:	53                   	push   %ebx
+  8010ec:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8010ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010fa:	b8 08 00 00 00       	mov    $0x8,%eax
+  8010ff:	89 df                	mov    %ebx,%edi
+  801101:	89 de                	mov    %ebx,%esi
+  801103:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801105:	85 c0                	test   %eax,%eax
+  801107:	7f 08                	jg     801111 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801109:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80110c:	5b                   	pop    %ebx
+  80110d:	5e                   	pop    %esi
+  80110e:	5f                   	pop    %edi
+  80110f:	5d                   	pop    %ebp
+  801110:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801111:	83 ec 0c             	sub    $0xc,%esp
+  801114:	50                   	push   %eax
+  801115:	6a 08                	push   $0x8
+  801117:	68 a3 3c 80 00       	push   $0x803ca3
+  80111c:	6a 23                	push   $0x23
+  80111e:	68 c0 3c 80 00       	push   $0x803cc0
+  801123:	e8 d5 f2 ff ff       	call   8003fd <_panic>
+
+00801128 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801128:	55                   	push   %ebp
+  801129:	89 e5                	mov    %esp,%ebp
+  80112b:	57                   	push   %edi
+  80112c:	56                   	push   %esi
+  80112d:	53                   	push   %ebx
+  80112e:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801131:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801136:	8b 55 08             	mov    0x8(%ebp),%edx
+  801139:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80113c:	b8 09 00 00 00       	mov    $0x9,%eax
+  801141:	89 df                	mov    %ebx,%edi
+  801143:	89 de                	mov    %ebx,%esi
+  801145:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801147:	85 c0                	test   %eax,%eax
+  801149:	7f 08                	jg     801153 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  80114b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80114e:	5b                   	pop    %ebx
+  80114f:	5e                   	pop    %esi
+  801150:	5f                   	pop    %edi
+  801151:	5d                   	pop    %ebp
+  801152:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801153:	83 ec 0c             	sub    $0xc,%esp
+  801156:	50                   	push   %eax
+  801157:	6a 09                	push   $0x9
+  801159:	68 a3 3c 80 00       	push   $0x803ca3
+  80115e:	6a 23                	push   $0x23
+  801160:	68 c0 3c 80 00       	push   $0x803cc0
+  801165:	e8 93 f2 ff ff       	call   8003fd <_panic>
+
+0080116a <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80116a:	55                   	push   %ebp
+  80116b:	89 e5                	mov    %esp,%ebp
+  80116d:	57                   	push   %edi
+  80116e:	56                   	push   %esi
+  80116f:	53                   	push   %ebx
+  801170:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801173:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801178:	8b 55 08             	mov    0x8(%ebp),%edx
+  80117b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80117e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801183:	89 df                	mov    %ebx,%edi
+  801185:	89 de                	mov    %ebx,%esi
+  801187:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801189:	85 c0                	test   %eax,%eax
+  80118b:	7f 08                	jg     801195 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  80118d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801190:	5b                   	pop    %ebx
+  801191:	5e                   	pop    %esi
+  801192:	5f                   	pop    %edi
+  801193:	5d                   	pop    %ebp
+  801194:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801195:	83 ec 0c             	sub    $0xc,%esp
+  801198:	50                   	push   %eax
+  801199:	6a 0a                	push   $0xa
+  80119b:	68 a3 3c 80 00       	push   $0x803ca3
+  8011a0:	6a 23                	push   $0x23
+  8011a2:	68 c0 3c 80 00       	push   $0x803cc0
+  8011a7:	e8 51 f2 ff ff       	call   8003fd <_panic>
+
+008011ac <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  8011ac:	55                   	push   %ebp
+  8011ad:	89 e5                	mov    %esp,%ebp
+  8011af:	57                   	push   %edi
+  8011b0:	56                   	push   %esi
+  8011b1:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8011b2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011b5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011b8:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8011bd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011c0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011c3:	8b 75 18             	mov    0x18(%ebp),%esi
+  8011c6:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  8011c8:	5b                   	pop    %ebx
+  8011c9:	5e                   	pop    %esi
+  8011ca:	5f                   	pop    %edi
+  8011cb:	5d                   	pop    %ebp
+  8011cc:	c3                   	ret
+
+008011cd <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  8011cd:	55                   	push   %ebp
+  8011ce:	89 e5                	mov    %esp,%ebp
+  8011d0:	57                   	push   %edi
+  8011d1:	56                   	push   %esi
+  8011d2:	53                   	push   %ebx
+  8011d3:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8011d6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011db:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011de:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011e1:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011e6:	89 df                	mov    %ebx,%edi
+  8011e8:	89 de                	mov    %ebx,%esi
+  8011ea:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8011ec:	85 c0                	test   %eax,%eax
+  8011ee:	7f 08                	jg     8011f8 <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  8011f0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011f3:	5b                   	pop    %ebx
+  8011f4:	5e                   	pop    %esi
+  8011f5:	5f                   	pop    %edi
+  8011f6:	5d                   	pop    %ebp
+  8011f7:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8011f8:	83 ec 0c             	sub    $0xc,%esp
+  8011fb:	50                   	push   %eax
+  8011fc:	6a 0d                	push   $0xd
+  8011fe:	68 a3 3c 80 00       	push   $0x803ca3
+  801203:	6a 23                	push   $0x23
+  801205:	68 c0 3c 80 00       	push   $0x803cc0
+  80120a:	e8 ee f1 ff ff       	call   8003fd <_panic>
+
+0080120f <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  80120f:	55                   	push   %ebp
+  801210:	89 e5                	mov    %esp,%ebp
+  801212:	57                   	push   %edi
+  801213:	56                   	push   %esi
+  801214:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801215:	ba 00 00 00 00       	mov    $0x0,%edx
+  80121a:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80121f:	89 d1                	mov    %edx,%ecx
+  801221:	89 d3                	mov    %edx,%ebx
+  801223:	89 d7                	mov    %edx,%edi
+  801225:	89 d6                	mov    %edx,%esi
+  801227:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801229:	5b                   	pop    %ebx
+  80122a:	5e                   	pop    %esi
+  80122b:	5f                   	pop    %edi
+  80122c:	5d                   	pop    %ebp
+  80122d:	c3                   	ret
+
+0080122e <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  80122e:	55                   	push   %ebp
+  80122f:	89 e5                	mov    %esp,%ebp
+  801231:	57                   	push   %edi
+  801232:	56                   	push   %esi
+  801233:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801234:	8b 55 08             	mov    0x8(%ebp),%edx
+  801237:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80123a:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80123f:	be 00 00 00 00       	mov    $0x0,%esi
+  801244:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801247:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80124a:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  80124c:	5b                   	pop    %ebx
+  80124d:	5e                   	pop    %esi
+  80124e:	5f                   	pop    %edi
+  80124f:	5d                   	pop    %ebp
+  801250:	c3                   	ret
+
+00801251 <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  801251:	55                   	push   %ebp
+  801252:	89 e5                	mov    %esp,%ebp
+  801254:	57                   	push   %edi
+  801255:	56                   	push   %esi
+  801256:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801257:	be 00 00 00 00       	mov    $0x0,%esi
+  80125c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80125f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801262:	b8 10 00 00 00       	mov    $0x10,%eax
+  801267:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80126a:	89 f7                	mov    %esi,%edi
+  80126c:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  80126e:	5b                   	pop    %ebx
+  80126f:	5e                   	pop    %esi
+  801270:	5f                   	pop    %edi
+  801271:	5d                   	pop    %ebp
+  801272:	c3                   	ret
+
+00801273 <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  801273:	55                   	push   %ebp
+  801274:	89 e5                	mov    %esp,%ebp
+  801276:	57                   	push   %edi
+  801277:	56                   	push   %esi
+  801278:	53                   	push   %ebx
+  801279:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  80127c:	80 3d f4 85 80 00 00 	cmpb   $0x0,0x8085f4
+  801283:	74 41                	je     8012c6 <sys_batch+0x53>
+  801285:	8b 45 08             	mov    0x8(%ebp),%eax
+  801288:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  80128b:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  801292:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801295:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  801298:	7d 45                	jge    8012df <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  80129a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80129d:	8b 06                	mov    (%esi),%eax
+  80129f:	8b 56 04             	mov    0x4(%esi),%edx
+  8012a2:	8b 4e 08             	mov    0x8(%esi),%ecx
+  8012a5:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  8012a8:	8b 7e 10             	mov    0x10(%esi),%edi
+  8012ab:	8b 76 14             	mov    0x14(%esi),%esi
+  8012ae:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  8012b0:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8012b3:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  8012b6:	83 c6 1c             	add    $0x1c,%esi
+  8012b9:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  8012bc:	85 c0                	test   %eax,%eax
+  8012be:	78 1f                	js     8012df <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  8012c0:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  8012c4:	eb cc                	jmp    801292 <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  8012c6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012cb:	b8 13 00 00 00       	mov    $0x13,%eax
+  8012d0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012d3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012d6:	89 df                	mov    %ebx,%edi
+  8012d8:	89 de                	mov    %ebx,%esi
+  8012da:	cd 30                	int    $0x30
+  8012dc:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  8012df:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8012e2:	83 c4 08             	add    $0x8,%esp
+  8012e5:	5b                   	pop    %ebx
+  8012e6:	5e                   	pop    %esi
+  8012e7:	5f                   	pop    %edi
+  8012e8:	5d                   	pop    %ebp
+  8012e9:	c3                   	ret
+
+008012ea <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  8012ea:	55                   	push   %ebp
+  8012eb:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  8012ed:	8b 45 08             	mov    0x8(%ebp),%eax
+  8012f0:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8012f6:	5d                   	pop    %ebp
+  8012f7:	c3                   	ret
+
+008012f8 <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  8012f8:	55                   	push   %ebp
+  8012f9:	89 e5                	mov    %esp,%ebp
+  8012fb:	56                   	push   %esi
+  8012fc:	53                   	push   %ebx
+  8012fd:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  801300:	8b 1e                	mov    (%esi),%ebx
+  801302:	85 db                	test   %ebx,%ebx
+  801304:	75 09                	jne    80130f <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  801306:	89 d8                	mov    %ebx,%eax
+  801308:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80130b:	5b                   	pop    %ebx
+  80130c:	5e                   	pop    %esi
+  80130d:	5d                   	pop    %ebp
+  80130e:	c3                   	ret
+  b->sb_n = 0;
+  80130f:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  801315:	53                   	push   %ebx
+  801316:	8d 46 04             	lea    0x4(%esi),%eax
+  801319:	50                   	push   %eax
+  80131a:	e8 54 ff ff ff       	call   801273 <sys_batch>
+  80131f:	83 c4 08             	add    $0x8,%esp
+  801322:	85 c0                	test   %eax,%eax
+  801324:	78 1e                	js     801344 <sysbatch_flush+0x4c>
+  if (r < n)
+  801326:	39 c3                	cmp    %eax,%ebx
+  801328:	7f 07                	jg     801331 <sysbatch_flush+0x39>
+  return 0;
+  80132a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80132f:	eb d5                	jmp    801306 <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  801331:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801334:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  801338:	85 db                	test   %ebx,%ebx
+  80133a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80133f:	0f 49 d8             	cmovns %eax,%ebx
+  801342:	eb c2                	jmp    801306 <sysbatch_flush+0xe>
+    return r;
+  801344:	89 c3                	mov    %eax,%ebx
+  801346:	eb be                	jmp    801306 <sysbatch_flush+0xe>
+
+00801348 <sysbatch_add>:
+{
+  801348:	55                   	push   %ebp
+  801349:	89 e5                	mov    %esp,%ebp
+  80134b:	53                   	push   %ebx
+  80134c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  80134f:	83 3b 40             	cmpl   $0x40,(%ebx)
+  801352:	74 41                	je     801395 <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  801354:	8b 03                	mov    (%ebx),%eax
+  801356:	8d 50 01             	lea    0x1(%eax),%edx
+  801359:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  80135b:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80135e:	01 d8                	add    %ebx,%eax
+  801360:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801363:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  801366:	8b 55 10             	mov    0x10(%ebp),%edx
+  801369:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  80136c:	8b 55 14             	mov    0x14(%ebp),%edx
+  80136f:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  801372:	8b 55 18             	mov    0x18(%ebp),%edx
+  801375:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  801378:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  80137b:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  80137e:	8b 55 20             	mov    0x20(%ebp),%edx
+  801381:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  801384:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  80138b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801390:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801393:	c9                   	leave
+  801394:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  801395:	53                   	push   %ebx
+  801396:	e8 5d ff ff ff       	call   8012f8 <sysbatch_flush>
+  80139b:	83 c4 04             	add    $0x4,%esp
+  80139e:	85 c0                	test   %eax,%eax
+  8013a0:	79 b2                	jns    801354 <sysbatch_add+0xc>
+  8013a2:	eb ec                	jmp    801390 <sysbatch_add+0x48>
+
+008013a4 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8013a4:	55                   	push   %ebp
+  8013a5:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8013a7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013aa:	05 00 00 00 30       	add    $0x30000000,%eax
+  8013af:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8013b2:	5d                   	pop    %ebp
+  8013b3:	c3                   	ret
+
+008013b4 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8013b4:	55                   	push   %ebp
+  8013b5:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8013b7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013ba:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  8013bd:	66 b8 00 00          	mov    $0x0,%ax
+  8013c1:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8013c6:	5d                   	pop    %ebp
+  8013c7:	c3                   	ret
+
+008013c8 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8013c8:	55                   	push   %ebp
+  8013c9:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  8013cb:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8013d0:	eb 02                	jmp    8013d4 <fd_alloc+0xc>
+  8013d2:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8013d4:	89 c2                	mov    %eax,%edx
+  8013d6:	c1 ea 16             	shr    $0x16,%edx
+  8013d9:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8013e0:	f6 c2 01             	test   $0x1,%dl
+  8013e3:	74 2b                	je     801410 <fd_alloc+0x48>
+  8013e5:	89 c2                	mov    %eax,%edx
+  8013e7:	c1 ea 0c             	shr    $0xc,%edx
+  8013ea:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8013f1:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8013f7:	f6 c1 01             	test   $0x1,%cl
+  8013fa:	74 14                	je     801410 <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  8013fc:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801402:	75 ce                	jne    8013d2 <fd_alloc+0xa>
+  801404:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  801409:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80140e:	eb 05                	jmp    801415 <fd_alloc+0x4d>
+      return 0;
+  801410:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  801415:	8b 55 08             	mov    0x8(%ebp),%edx
+  801418:	89 02                	mov    %eax,(%edx)
+}
+  80141a:	89 c8                	mov    %ecx,%eax
+  80141c:	5d                   	pop    %ebp
+  80141d:	c3                   	ret
+
+0080141e <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80141e:	55                   	push   %ebp
+  80141f:	89 e5                	mov    %esp,%ebp
+  801421:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  801424:	83 f8 1f             	cmp    $0x1f,%eax
+  801427:	77 30                	ja     801459 <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  801429:	c1 e0 0c             	shl    $0xc,%eax
+  80142c:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801431:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801437:	f6 c2 01             	test   $0x1,%dl
+  80143a:	74 24                	je     801460 <fd_lookup+0x42>
+  80143c:	89 c2                	mov    %eax,%edx
+  80143e:	c1 ea 0c             	shr    $0xc,%edx
+  801441:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801448:	f6 c2 01             	test   $0x1,%dl
+  80144b:	74 1a                	je     801467 <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  80144d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801450:	89 02                	mov    %eax,(%edx)
+  return 0;
+  801452:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801457:	5d                   	pop    %ebp
+  801458:	c3                   	ret
+    return -E_INVAL;
+  801459:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80145e:	eb f7                	jmp    801457 <fd_lookup+0x39>
+    return -E_INVAL;
+  801460:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801465:	eb f0                	jmp    801457 <fd_lookup+0x39>
+  801467:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80146c:	eb e9                	jmp    801457 <fd_lookup+0x39>
+
+0080146e <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80146e:	55                   	push   %ebp
+  80146f:	89 e5                	mov    %esp,%ebp
+  801471:	53                   	push   %ebx
+  801472:	83 ec 04             	sub    $0x4,%esp
+  801475:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  801478:	b8 4c 3d 80 00       	mov    $0x803d4c,%eax
+  80147d:	8b 18                	mov    (%eax),%ebx
+  80147f:	85 db                	test   %ebx,%ebx
+  801481:	74 0e                	je     801491 <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  801483:	83 c0 04             	add    $0x4,%eax
+  801486:	39 13                	cmp    %edx,(%ebx)
+  801488:	75 f3                	jne    80147d <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  80148a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80148f:	eb 1f                	jmp    8014b0 <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801491:	a1 f0 85 80 00       	mov    0x8085f0,%eax
+  801496:	8b 40 48             	mov    0x48(%eax),%eax
+  801499:	83 ec 04             	sub    $0x4,%esp
+  80149c:	52                   	push   %edx
+  80149d:	50                   	push   %eax
+  80149e:	68 d0 3c 80 00       	push   $0x803cd0
+  8014a3:	e8 30 f0 ff ff       	call   8004d8 <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  8014a8:	83 c4 10             	add    $0x10,%esp
+  8014ab:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  8014b0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8014b3:	89 1a                	mov    %ebx,(%edx)
+}
+  8014b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014b8:	c9                   	leave
+  8014b9:	c3                   	ret
+
+008014ba <fd_close>:
+{
+  8014ba:	55                   	push   %ebp
+  8014bb:	89 e5                	mov    %esp,%ebp
+  8014bd:	57                   	push   %edi
+  8014be:	56                   	push   %esi
+  8014bf:	53                   	push   %ebx
+  8014c0:	83 ec 24             	sub    $0x24,%esp
+  8014c3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8014c6:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8014c9:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8014cc:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8014cd:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8014d3:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8014d6:	50                   	push   %eax
+  8014d7:	e8 42 ff ff ff       	call   80141e <fd_lookup>
+  8014dc:	89 c3                	mov    %eax,%ebx
+  8014de:	83 c4 10             	add    $0x10,%esp
+  8014e1:	85 c0                	test   %eax,%eax
+  8014e3:	78 05                	js     8014ea <fd_close+0x30>
+      || fd != fd2)
+  8014e5:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8014e8:	74 16                	je     801500 <fd_close+0x46>
+    return must_exist ? r : 0;
+  8014ea:	89 f8                	mov    %edi,%eax
+  8014ec:	84 c0                	test   %al,%al
+  8014ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014f3:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8014f6:	89 d8                	mov    %ebx,%eax
+  8014f8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014fb:	5b                   	pop    %ebx
+  8014fc:	5e                   	pop    %esi
+  8014fd:	5f                   	pop    %edi
+  8014fe:	5d                   	pop    %ebp
+  8014ff:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801500:	83 ec 08             	sub    $0x8,%esp
+  801503:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801506:	50                   	push   %eax
+  801507:	ff 36                	push   (%esi)
+  801509:	e8 60 ff ff ff       	call   80146e <dev_lookup>
+  80150e:	89 c3                	mov    %eax,%ebx
+  801510:	83 c4 10             	add    $0x10,%esp
+  801513:	85 c0                	test   %eax,%eax
+  801515:	78 1a                	js     801531 <fd_close+0x77>
+    if (dev->dev_close)
+  801517:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80151a:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  80151d:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  801522:	85 c0                	test   %eax,%eax
+  801524:	74 0b                	je     801531 <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  801526:	83 ec 0c             	sub    $0xc,%esp
+  801529:	56                   	push   %esi
+  80152a:	ff d0                	call   *%eax
+  80152c:	89 c3                	mov    %eax,%ebx
+  80152e:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  801531:	83 ec 08             	sub    $0x8,%esp
+  801534:	56                   	push   %esi
+  801535:	6a 00                	push   $0x0
+  801537:	e8 3e fa ff ff       	call   800f7a <sys_page_unmap>
+  return r;
+  80153c:	83 c4 10             	add    $0x10,%esp
+  80153f:	eb b5                	jmp    8014f6 <fd_close+0x3c>
+
+00801541 <close>:
+
+int
+close(int fdnum)
+{
+  801541:	55                   	push   %ebp
+  801542:	89 e5                	mov    %esp,%ebp
+  801544:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801547:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80154a:	50                   	push   %eax
+  80154b:	ff 75 08             	push   0x8(%ebp)
+  80154e:	e8 cb fe ff ff       	call   80141e <fd_lookup>
+  801553:	83 c4 10             	add    $0x10,%esp
+  801556:	85 c0                	test   %eax,%eax
+  801558:	79 02                	jns    80155c <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  80155a:	c9                   	leave
+  80155b:	c3                   	ret
+    return fd_close(fd, 1);
+  80155c:	83 ec 08             	sub    $0x8,%esp
+  80155f:	6a 01                	push   $0x1
+  801561:	ff 75 f4             	push   -0xc(%ebp)
+  801564:	e8 51 ff ff ff       	call   8014ba <fd_close>
+  801569:	83 c4 10             	add    $0x10,%esp
+  80156c:	eb ec                	jmp    80155a <close+0x19>
+
+0080156e <close_all>:
+
+void
+close_all(void)
+{
+  80156e:	55                   	push   %ebp
+  80156f:	89 e5                	mov    %esp,%ebp
+  801571:	53                   	push   %ebx
+  801572:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  801575:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  80157a:	83 ec 0c             	sub    $0xc,%esp
+  80157d:	53                   	push   %ebx
+  80157e:	e8 be ff ff ff       	call   801541 <close>
+  for (i = 0; i < MAXFD; i++)
+  801583:	83 c3 01             	add    $0x1,%ebx
+  801586:	83 c4 10             	add    $0x10,%esp
+  801589:	83 fb 20             	cmp    $0x20,%ebx
+  80158c:	75 ec                	jne    80157a <close_all+0xc>
+}
+  80158e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801591:	c9                   	leave
+  801592:	c3                   	ret
+
+00801593 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801593:	55                   	push   %ebp
+  801594:	89 e5                	mov    %esp,%ebp
+  801596:	57                   	push   %edi
+  801597:	56                   	push   %esi
+  801598:	53                   	push   %ebx
+  801599:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80159c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80159f:	50                   	push   %eax
+  8015a0:	ff 75 08             	push   0x8(%ebp)
+  8015a3:	e8 76 fe ff ff       	call   80141e <fd_lookup>
+  8015a8:	89 c6                	mov    %eax,%esi
+  8015aa:	83 c4 10             	add    $0x10,%esp
+  8015ad:	85 c0                	test   %eax,%eax
+  8015af:	0f 88 0a 01 00 00    	js     8016bf <dup+0x12c>
+    return r;
+  close(newfdnum);
+  8015b5:	83 ec 0c             	sub    $0xc,%esp
+  8015b8:	ff 75 0c             	push   0xc(%ebp)
+  8015bb:	e8 81 ff ff ff       	call   801541 <close>
+
+  newfd = INDEX2FD(newfdnum);
+  8015c0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8015c3:	c1 e0 0c             	shl    $0xc,%eax
+  8015c6:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  8015cc:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  8015cf:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8015d2:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8015d5:	89 04 24             	mov    %eax,(%esp)
+  8015d8:	e8 d7 fd ff ff       	call   8013b4 <fd2data>
+  8015dd:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  8015df:	89 3c 24             	mov    %edi,(%esp)
+  8015e2:	e8 cd fd ff ff       	call   8013b4 <fd2data>
+  8015e7:	83 c4 10             	add    $0x10,%esp
+  8015ea:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8015ed:	89 f3                	mov    %esi,%ebx
+  8015ef:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  8015f5:	89 c6                	mov    %eax,%esi
+  8015f7:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8015fa:	89 cf                	mov    %ecx,%edi
+  8015fc:	eb 0c                	jmp    80160a <dup+0x77>
+  8015fe:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801604:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80160a:	39 fb                	cmp    %edi,%ebx
+  80160c:	74 7b                	je     801689 <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  80160e:	89 d8                	mov    %ebx,%eax
+  801610:	c1 e8 16             	shr    $0x16,%eax
+  801613:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80161a:	a8 01                	test   $0x1,%al
+  80161c:	74 e0                	je     8015fe <dup+0x6b>
+  80161e:	89 d8                	mov    %ebx,%eax
+  801620:	c1 e8 0c             	shr    $0xc,%eax
+  801623:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80162a:	f6 c2 01             	test   $0x1,%dl
+  80162d:	74 cf                	je     8015fe <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  80162f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  801636:	83 ec 0c             	sub    $0xc,%esp
+  801639:	25 07 0e 00 00       	and    $0xe07,%eax
+  80163e:	50                   	push   %eax
+  80163f:	56                   	push   %esi
+  801640:	6a 00                	push   $0x0
+  801642:	53                   	push   %ebx
+  801643:	6a 00                	push   $0x0
+  801645:	e8 ee f8 ff ff       	call   800f38 <sys_page_map>
+  80164a:	83 c4 20             	add    $0x20,%esp
+  80164d:	85 c0                	test   %eax,%eax
+  80164f:	79 ad                	jns    8015fe <dup+0x6b>
+  801651:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801654:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  801656:	83 ec 08             	sub    $0x8,%esp
+  801659:	ff 75 d4             	push   -0x2c(%ebp)
+  80165c:	6a 00                	push   $0x0
+  80165e:	e8 17 f9 ff ff       	call   800f7a <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801663:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  801666:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  80166c:	83 c4 10             	add    $0x10,%esp
+  80166f:	39 df                	cmp    %ebx,%edi
+  801671:	74 4c                	je     8016bf <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  801673:	83 ec 08             	sub    $0x8,%esp
+  801676:	57                   	push   %edi
+  801677:	6a 00                	push   $0x0
+  801679:	e8 fc f8 ff ff       	call   800f7a <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80167e:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  801684:	83 c4 10             	add    $0x10,%esp
+  801687:	eb e6                	jmp    80166f <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801689:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80168c:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80168f:	89 c8                	mov    %ecx,%eax
+  801691:	c1 e8 0c             	shr    $0xc,%eax
+  801694:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80169b:	83 ec 0c             	sub    $0xc,%esp
+  80169e:	25 07 0e 00 00       	and    $0xe07,%eax
+  8016a3:	50                   	push   %eax
+  8016a4:	ff 75 d4             	push   -0x2c(%ebp)
+  8016a7:	6a 00                	push   $0x0
+  8016a9:	51                   	push   %ecx
+  8016aa:	6a 00                	push   $0x0
+  8016ac:	e8 87 f8 ff ff       	call   800f38 <sys_page_map>
+  8016b1:	89 c6                	mov    %eax,%esi
+  8016b3:	83 c4 20             	add    $0x20,%esp
+  8016b6:	85 c0                	test   %eax,%eax
+  8016b8:	78 9c                	js     801656 <dup+0xc3>
+  return newfdnum;
+  8016ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8016bd:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  8016bf:	89 f0                	mov    %esi,%eax
+  8016c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016c4:	5b                   	pop    %ebx
+  8016c5:	5e                   	pop    %esi
+  8016c6:	5f                   	pop    %edi
+  8016c7:	5d                   	pop    %ebp
+  8016c8:	c3                   	ret
+
+008016c9 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8016c9:	55                   	push   %ebp
+  8016ca:	89 e5                	mov    %esp,%ebp
+  8016cc:	56                   	push   %esi
+  8016cd:	53                   	push   %ebx
+  8016ce:	83 ec 18             	sub    $0x18,%esp
+  8016d1:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016d4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016d7:	50                   	push   %eax
+  8016d8:	56                   	push   %esi
+  8016d9:	e8 40 fd ff ff       	call   80141e <fd_lookup>
+  8016de:	83 c4 10             	add    $0x10,%esp
+  8016e1:	85 c0                	test   %eax,%eax
+  8016e3:	78 3c                	js     801721 <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8016e5:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8016e8:	83 ec 08             	sub    $0x8,%esp
+  8016eb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016ee:	50                   	push   %eax
+  8016ef:	ff 33                	push   (%ebx)
+  8016f1:	e8 78 fd ff ff       	call   80146e <dev_lookup>
+  8016f6:	83 c4 10             	add    $0x10,%esp
+  8016f9:	85 c0                	test   %eax,%eax
+  8016fb:	78 24                	js     801721 <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8016fd:	8b 43 08             	mov    0x8(%ebx),%eax
+  801700:	83 e0 03             	and    $0x3,%eax
+  801703:	83 f8 01             	cmp    $0x1,%eax
+  801706:	74 20                	je     801728 <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  801708:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80170b:	8b 40 08             	mov    0x8(%eax),%eax
+  80170e:	85 c0                	test   %eax,%eax
+  801710:	74 37                	je     801749 <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  801712:	83 ec 04             	sub    $0x4,%esp
+  801715:	ff 75 10             	push   0x10(%ebp)
+  801718:	ff 75 0c             	push   0xc(%ebp)
+  80171b:	53                   	push   %ebx
+  80171c:	ff d0                	call   *%eax
+  80171e:	83 c4 10             	add    $0x10,%esp
+}
+  801721:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801724:	5b                   	pop    %ebx
+  801725:	5e                   	pop    %esi
+  801726:	5d                   	pop    %ebp
+  801727:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801728:	a1 f0 85 80 00       	mov    0x8085f0,%eax
+  80172d:	8b 40 48             	mov    0x48(%eax),%eax
+  801730:	83 ec 04             	sub    $0x4,%esp
+  801733:	56                   	push   %esi
+  801734:	50                   	push   %eax
+  801735:	68 11 3d 80 00       	push   $0x803d11
+  80173a:	e8 99 ed ff ff       	call   8004d8 <cprintf>
+    return -E_INVAL;
+  80173f:	83 c4 10             	add    $0x10,%esp
+  801742:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801747:	eb d8                	jmp    801721 <read+0x58>
+    return -E_NOT_SUPP;
+  801749:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80174e:	eb d1                	jmp    801721 <read+0x58>
+
+00801750 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801750:	55                   	push   %ebp
+  801751:	89 e5                	mov    %esp,%ebp
+  801753:	57                   	push   %edi
+  801754:	56                   	push   %esi
+  801755:	53                   	push   %ebx
+  801756:	83 ec 0c             	sub    $0xc,%esp
+  801759:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80175c:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  80175f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801764:	eb 02                	jmp    801768 <readn+0x18>
+  801766:	01 c3                	add    %eax,%ebx
+  801768:	39 f3                	cmp    %esi,%ebx
+  80176a:	73 21                	jae    80178d <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  80176c:	83 ec 04             	sub    $0x4,%esp
+  80176f:	89 f0                	mov    %esi,%eax
+  801771:	29 d8                	sub    %ebx,%eax
+  801773:	50                   	push   %eax
+  801774:	89 d8                	mov    %ebx,%eax
+  801776:	03 45 0c             	add    0xc(%ebp),%eax
+  801779:	50                   	push   %eax
+  80177a:	57                   	push   %edi
+  80177b:	e8 49 ff ff ff       	call   8016c9 <read>
+    if (m < 0)
+  801780:	83 c4 10             	add    $0x10,%esp
+  801783:	85 c0                	test   %eax,%eax
+  801785:	78 04                	js     80178b <readn+0x3b>
+      return m;
+    if (m == 0)
+  801787:	75 dd                	jne    801766 <readn+0x16>
+  801789:	eb 02                	jmp    80178d <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  80178b:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  80178d:	89 d8                	mov    %ebx,%eax
+  80178f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801792:	5b                   	pop    %ebx
+  801793:	5e                   	pop    %esi
+  801794:	5f                   	pop    %edi
+  801795:	5d                   	pop    %ebp
+  801796:	c3                   	ret
+
+00801797 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801797:	55                   	push   %ebp
+  801798:	89 e5                	mov    %esp,%ebp
+  80179a:	56                   	push   %esi
+  80179b:	53                   	push   %ebx
+  80179c:	83 ec 18             	sub    $0x18,%esp
+  80179f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017a2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017a5:	50                   	push   %eax
+  8017a6:	53                   	push   %ebx
+  8017a7:	e8 72 fc ff ff       	call   80141e <fd_lookup>
+  8017ac:	83 c4 10             	add    $0x10,%esp
+  8017af:	85 c0                	test   %eax,%eax
+  8017b1:	78 37                	js     8017ea <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017b3:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8017b6:	83 ec 08             	sub    $0x8,%esp
+  8017b9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017bc:	50                   	push   %eax
+  8017bd:	ff 36                	push   (%esi)
+  8017bf:	e8 aa fc ff ff       	call   80146e <dev_lookup>
+  8017c4:	83 c4 10             	add    $0x10,%esp
+  8017c7:	85 c0                	test   %eax,%eax
+  8017c9:	78 1f                	js     8017ea <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8017cb:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8017cf:	74 20                	je     8017f1 <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  8017d1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017d4:	8b 40 0c             	mov    0xc(%eax),%eax
+  8017d7:	85 c0                	test   %eax,%eax
+  8017d9:	74 37                	je     801812 <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  8017db:	83 ec 04             	sub    $0x4,%esp
+  8017de:	ff 75 10             	push   0x10(%ebp)
+  8017e1:	ff 75 0c             	push   0xc(%ebp)
+  8017e4:	56                   	push   %esi
+  8017e5:	ff d0                	call   *%eax
+  8017e7:	83 c4 10             	add    $0x10,%esp
+}
+  8017ea:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017ed:	5b                   	pop    %ebx
+  8017ee:	5e                   	pop    %esi
+  8017ef:	5d                   	pop    %ebp
+  8017f0:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8017f1:	a1 f0 85 80 00       	mov    0x8085f0,%eax
+  8017f6:	8b 40 48             	mov    0x48(%eax),%eax
+  8017f9:	83 ec 04             	sub    $0x4,%esp
+  8017fc:	53                   	push   %ebx
+  8017fd:	50                   	push   %eax
+  8017fe:	68 2d 3d 80 00       	push   $0x803d2d
+  801803:	e8 d0 ec ff ff       	call   8004d8 <cprintf>
+    return -E_INVAL;
+  801808:	83 c4 10             	add    $0x10,%esp
+  80180b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801810:	eb d8                	jmp    8017ea <write+0x53>
+    return -E_NOT_SUPP;
+  801812:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801817:	eb d1                	jmp    8017ea <write+0x53>
+
+00801819 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801819:	55                   	push   %ebp
+  80181a:	89 e5                	mov    %esp,%ebp
+  80181c:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80181f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801822:	50                   	push   %eax
+  801823:	ff 75 08             	push   0x8(%ebp)
+  801826:	e8 f3 fb ff ff       	call   80141e <fd_lookup>
+  80182b:	83 c4 10             	add    $0x10,%esp
+  80182e:	85 c0                	test   %eax,%eax
+  801830:	78 0e                	js     801840 <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  801832:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801835:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801838:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  80183b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801840:	c9                   	leave
+  801841:	c3                   	ret
+
+00801842 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801842:	55                   	push   %ebp
+  801843:	89 e5                	mov    %esp,%ebp
+  801845:	56                   	push   %esi
+  801846:	53                   	push   %ebx
+  801847:	83 ec 18             	sub    $0x18,%esp
+  80184a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  80184d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801850:	50                   	push   %eax
+  801851:	53                   	push   %ebx
+  801852:	e8 c7 fb ff ff       	call   80141e <fd_lookup>
+  801857:	83 c4 10             	add    $0x10,%esp
+  80185a:	85 c0                	test   %eax,%eax
+  80185c:	78 34                	js     801892 <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80185e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801861:	83 ec 08             	sub    $0x8,%esp
+  801864:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801867:	50                   	push   %eax
+  801868:	ff 36                	push   (%esi)
+  80186a:	e8 ff fb ff ff       	call   80146e <dev_lookup>
+  80186f:	83 c4 10             	add    $0x10,%esp
+  801872:	85 c0                	test   %eax,%eax
+  801874:	78 1c                	js     801892 <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801876:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80187a:	74 1d                	je     801899 <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  80187c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80187f:	8b 40 18             	mov    0x18(%eax),%eax
+  801882:	85 c0                	test   %eax,%eax
+  801884:	74 34                	je     8018ba <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  801886:	83 ec 08             	sub    $0x8,%esp
+  801889:	ff 75 0c             	push   0xc(%ebp)
+  80188c:	56                   	push   %esi
+  80188d:	ff d0                	call   *%eax
+  80188f:	83 c4 10             	add    $0x10,%esp
+}
+  801892:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801895:	5b                   	pop    %ebx
+  801896:	5e                   	pop    %esi
+  801897:	5d                   	pop    %ebp
+  801898:	c3                   	ret
+            thisenv->env_id, fdnum);
+  801899:	a1 f0 85 80 00       	mov    0x8085f0,%eax
+  80189e:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8018a1:	83 ec 04             	sub    $0x4,%esp
+  8018a4:	53                   	push   %ebx
+  8018a5:	50                   	push   %eax
+  8018a6:	68 f0 3c 80 00       	push   $0x803cf0
+  8018ab:	e8 28 ec ff ff       	call   8004d8 <cprintf>
+    return -E_INVAL;
+  8018b0:	83 c4 10             	add    $0x10,%esp
+  8018b3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018b8:	eb d8                	jmp    801892 <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  8018ba:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8018bf:	eb d1                	jmp    801892 <ftruncate+0x50>
+
+008018c1 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8018c1:	55                   	push   %ebp
+  8018c2:	89 e5                	mov    %esp,%ebp
+  8018c4:	56                   	push   %esi
+  8018c5:	53                   	push   %ebx
+  8018c6:	83 ec 18             	sub    $0x18,%esp
+  8018c9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  8018cc:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018cf:	50                   	push   %eax
+  8018d0:	ff 75 08             	push   0x8(%ebp)
+  8018d3:	e8 46 fb ff ff       	call   80141e <fd_lookup>
+  8018d8:	83 c4 10             	add    $0x10,%esp
+  8018db:	85 c0                	test   %eax,%eax
+  8018dd:	78 49                	js     801928 <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8018df:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8018e2:	83 ec 08             	sub    $0x8,%esp
+  8018e5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018e8:	50                   	push   %eax
+  8018e9:	ff 36                	push   (%esi)
+  8018eb:	e8 7e fb ff ff       	call   80146e <dev_lookup>
+  8018f0:	83 c4 10             	add    $0x10,%esp
+  8018f3:	85 c0                	test   %eax,%eax
+  8018f5:	78 31                	js     801928 <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  8018f7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018fa:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8018fe:	74 2f                	je     80192f <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  801900:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  801903:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  80190a:	00 00 00 
+  stat->st_isdir = 0;
+  80190d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801914:	00 00 00 
+  stat->st_dev = dev;
+  801917:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  80191d:	83 ec 08             	sub    $0x8,%esp
+  801920:	53                   	push   %ebx
+  801921:	56                   	push   %esi
+  801922:	ff 50 14             	call   *0x14(%eax)
+  801925:	83 c4 10             	add    $0x10,%esp
+}
+  801928:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80192b:	5b                   	pop    %ebx
+  80192c:	5e                   	pop    %esi
+  80192d:	5d                   	pop    %ebp
+  80192e:	c3                   	ret
+    return -E_NOT_SUPP;
+  80192f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801934:	eb f2                	jmp    801928 <fstat+0x67>
+
+00801936 <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  801936:	55                   	push   %ebp
+  801937:	89 e5                	mov    %esp,%ebp
+  801939:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  80193c:	ff 75 0c             	push   0xc(%ebp)
+  80193f:	ff 75 08             	push   0x8(%ebp)
+  801942:	e8 58 07 00 00       	call   80209f <file_stat>
+}
+  801947:	c9                   	leave
+  801948:	c3                   	ret
+
+00801949 <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  801949:	55                   	push   %ebp
+  80194a:	89 e5                	mov    %esp,%ebp
+  80194c:	57                   	push   %edi
+  80194d:	56                   	push   %esi
+  80194e:	53                   	push   %ebx
+  80194f:	83 ec 1c             	sub    $0x1c,%esp
+  801952:	89 c7                	mov    %eax,%edi
+  801954:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801957:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80195a:	e9 a2 00 00 00       	jmp    801a01 <fsipc_send+0xb8>
+  nfsenvs = 0;
+  80195f:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  801966:	00 00 00 
+  801969:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80196e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801973:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801978:	be 01 00 00 00       	mov    $0x1,%esi
+  80197d:	eb 0f                	jmp    80198e <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  80197f:	83 c0 01             	add    $0x1,%eax
+  801982:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801987:	74 49                	je     8019d2 <fsipc_send+0x89>
+  801989:	83 f9 07             	cmp    $0x7,%ecx
+  80198c:	7f 50                	jg     8019de <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  80198e:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801991:	c1 e2 04             	shl    $0x4,%edx
+  801994:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80199a:	8b 52 50             	mov    0x50(%edx),%edx
+  80199d:	83 fa 01             	cmp    $0x1,%edx
+  8019a0:	75 dd                	jne    80197f <fsipc_send+0x36>
+  8019a2:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  8019a5:	c1 e2 04             	shl    $0x4,%edx
+  8019a8:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8019ae:	8b 52 54             	mov    0x54(%edx),%edx
+  8019b1:	85 d2                	test   %edx,%edx
+  8019b3:	74 ca                	je     80197f <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  8019b5:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  8019b8:	c1 e2 04             	shl    $0x4,%edx
+  8019bb:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8019c1:	8b 52 48             	mov    0x48(%edx),%edx
+  8019c4:	89 14 8d 20 60 80 00 	mov    %edx,0x806020(,%ecx,4)
+  8019cb:	8d 49 01             	lea    0x1(%ecx),%ecx
+  8019ce:	89 f3                	mov    %esi,%ebx
+  8019d0:	eb ad                	jmp    80197f <fsipc_send+0x36>
+  8019d2:	84 db                	test   %bl,%bl
+  8019d4:	74 38                	je     801a0e <fsipc_send+0xc5>
+  8019d6:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+  8019dc:	eb 30                	jmp    801a0e <fsipc_send+0xc5>
+  8019de:	84 db                	test   %bl,%bl
+  8019e0:	74 2c                	je     801a0e <fsipc_send+0xc5>
+  8019e2:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+  8019e8:	eb 24                	jmp    801a0e <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  8019ea:	50                   	push   %eax
+  8019eb:	68 5c 3d 80 00       	push   $0x803d5c
+  8019f0:	6a 34                	push   $0x34
+  8019f2:	68 66 3d 80 00       	push   $0x803d66
+  8019f7:	e8 01 ea ff ff       	call   8003fd <_panic>
+    }
+    sys_yield();
+  8019fc:	e8 92 f4 ff ff       	call   800e93 <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  801a01:	83 3d 00 60 80 00 03 	cmpl   $0x3,0x806000
+  801a08:	0f 8e 51 ff ff ff    	jle    80195f <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  801a0e:	a1 f0 85 80 00       	mov    0x8085f0,%eax
+  801a13:	8b 70 48             	mov    0x48(%eax),%esi
+  801a16:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  801a1c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a21:	8b 0d 00 60 80 00    	mov    0x806000,%ecx
+  801a27:	39 d9                	cmp    %ebx,%ecx
+  801a29:	7e d1                	jle    8019fc <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  801a2b:	83 ec 0c             	sub    $0xc,%esp
+  801a2e:	ff 75 e0             	push   -0x20(%ebp)
+  801a31:	6a 07                	push   $0x7
+  801a33:	ff 75 e4             	push   -0x1c(%ebp)
+  801a36:	57                   	push   %edi
+  801a37:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  801a3a:	99                   	cltd
+  801a3b:	f7 f9                	idiv   %ecx
+  801a3d:	ff 34 95 20 60 80 00 	push   0x806020(,%edx,4)
+  801a44:	e8 63 f7 ff ff       	call   8011ac <sys_ipc_try_send>
+      if (r == 0)
+  801a49:	83 c4 20             	add    $0x20,%esp
+  801a4c:	85 c0                	test   %eax,%eax
+  801a4e:	74 0a                	je     801a5a <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  801a50:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801a53:	75 95                	jne    8019ea <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  801a55:	83 c3 01             	add    $0x1,%ebx
+  801a58:	eb c7                	jmp    801a21 <fsipc_send+0xd8>
+  }
+}
+  801a5a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a5d:	5b                   	pop    %ebx
+  801a5e:	5e                   	pop    %esi
+  801a5f:	5f                   	pop    %edi
+  801a60:	5d                   	pop    %ebp
+  801a61:	c3                   	ret
+
+00801a62 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801a62:	55                   	push   %ebp
+  801a63:	89 e5                	mov    %esp,%ebp
+  801a65:	53                   	push   %ebx
+  801a66:	83 ec 14             	sub    $0x14,%esp
+  801a69:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  801a6b:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  801a72:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801a77:	ba 00 90 80 00       	mov    $0x809000,%edx
+  801a7c:	e8 c8 fe ff ff       	call   801949 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801a81:	6a 00                	push   $0x0
+  801a83:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a86:	50                   	push   %eax
+  801a87:	53                   	push   %ebx
+  801a88:	6a 00                	push   $0x0
+  801a8a:	e8 aa 19 00 00       	call   803439 <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  801a8f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a92:	c9                   	leave
+  801a93:	c3                   	ret
+
+00801a94 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801a94:	55                   	push   %ebp
+  801a95:	89 e5                	mov    %esp,%ebp
+  801a97:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801a9a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a9d:	8b 40 0c             	mov    0xc(%eax),%eax
+  801aa0:	a3 00 90 80 00       	mov    %eax,0x809000
+  fsipcbuf.set_size.req_size = newsize;
+  801aa5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801aa8:	a3 04 90 80 00       	mov    %eax,0x809004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801aad:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ab2:	b8 02 00 00 00       	mov    $0x2,%eax
+  801ab7:	e8 a6 ff ff ff       	call   801a62 <fsipc>
+}
+  801abc:	c9                   	leave
+  801abd:	c3                   	ret
+
+00801abe <devfile_flush>:
+{
+  801abe:	55                   	push   %ebp
+  801abf:	89 e5                	mov    %esp,%ebp
+  801ac1:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801ac4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ac7:	8b 40 0c             	mov    0xc(%eax),%eax
+  801aca:	a3 00 90 80 00       	mov    %eax,0x809000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801acf:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ad4:	b8 06 00 00 00       	mov    $0x6,%eax
+  801ad9:	e8 84 ff ff ff       	call   801a62 <fsipc>
+}
+  801ade:	c9                   	leave
+  801adf:	c3                   	ret
+
+00801ae0 <devfile_stat>:
+{
+  801ae0:	55                   	push   %ebp
+  801ae1:	89 e5                	mov    %esp,%ebp
+  801ae3:	53                   	push   %ebx
+  801ae4:	83 ec 04             	sub    $0x4,%esp
+  801ae7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801aea:	8b 45 08             	mov    0x8(%ebp),%eax
+  801aed:	8b 40 0c             	mov    0xc(%eax),%eax
+  801af0:	a3 00 90 80 00       	mov    %eax,0x809000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801af5:	ba 00 00 00 00       	mov    $0x0,%edx
+  801afa:	b8 05 00 00 00       	mov    $0x5,%eax
+  801aff:	e8 5e ff ff ff       	call   801a62 <fsipc>
+  801b04:	85 c0                	test   %eax,%eax
+  801b06:	78 2c                	js     801b34 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801b08:	83 ec 08             	sub    $0x8,%esp
+  801b0b:	68 00 90 80 00       	push   $0x809000
+  801b10:	53                   	push   %ebx
+  801b11:	e8 b0 ef ff ff       	call   800ac6 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  801b16:	a1 80 90 80 00       	mov    0x809080,%eax
+  801b1b:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801b21:	a1 84 90 80 00       	mov    0x809084,%eax
+  801b26:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801b2c:	83 c4 10             	add    $0x10,%esp
+  801b2f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b34:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b37:	c9                   	leave
+  801b38:	c3                   	ret
+
+00801b39 <fsv_alloc>:
+{
+  801b39:	55                   	push   %ebp
+  801b3a:	89 e5                	mov    %esp,%ebp
+  801b3c:	56                   	push   %esi
+  801b3d:	53                   	push   %ebx
+  801b3e:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  801b40:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b45:	eb 22                	jmp    801b69 <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  801b47:	83 ec 04             	sub    $0x4,%esp
+  801b4a:	6a 00                	push   $0x0
+  801b4c:	6a 00                	push   $0x0
+  801b4e:	6a 07                	push   $0x7
+  801b50:	50                   	push   %eax
+  801b51:	6a 00                	push   $0x0
+  801b53:	6a 04                	push   $0x4
+  801b55:	68 40 60 80 00       	push   $0x806040
+  801b5a:	e8 e9 f7 ff ff       	call   801348 <sysbatch_add>
+  801b5f:	83 c4 20             	add    $0x20,%esp
+  801b62:	85 c0                	test   %eax,%eax
+  801b64:	78 48                	js     801bae <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  801b66:	83 c3 01             	add    $0x1,%ebx
+  801b69:	39 f3                	cmp    %esi,%ebx
+  801b6b:	74 31                	je     801b9e <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  801b6d:	89 d8                	mov    %ebx,%eax
+  801b6f:	c1 e0 0c             	shl    $0xc,%eax
+  801b72:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801b77:	89 c2                	mov    %eax,%edx
+  801b79:	c1 ea 16             	shr    $0x16,%edx
+  801b7c:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801b83:	f6 c2 01             	test   $0x1,%dl
+  801b86:	74 bf                	je     801b47 <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  801b88:	89 c2                	mov    %eax,%edx
+  801b8a:	c1 ea 0c             	shr    $0xc,%edx
+  801b8d:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801b94:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801b97:	83 fa 03             	cmp    $0x3,%edx
+  801b9a:	75 ab                	jne    801b47 <fsv_alloc+0xe>
+  801b9c:	eb c8                	jmp    801b66 <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  801b9e:	83 ec 0c             	sub    $0xc,%esp
+  801ba1:	68 40 60 80 00       	push   $0x806040
+  801ba6:	e8 4d f7 ff ff       	call   8012f8 <sysbatch_flush>
+  801bab:	83 c4 10             	add    $0x10,%esp
+}
+  801bae:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bb1:	5b                   	pop    %ebx
+  801bb2:	5e                   	pop    %esi
+  801bb3:	5d                   	pop    %ebp
+  801bb4:	c3                   	ret
+
+00801bb5 <devfile_read>:
+{
+  801bb5:	55                   	push   %ebp
+  801bb6:	89 e5                	mov    %esp,%ebp
+  801bb8:	57                   	push   %edi
+  801bb9:	56                   	push   %esi
+  801bba:	53                   	push   %ebx
+  801bbb:	83 ec 3c             	sub    $0x3c,%esp
+  801bbe:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  801bc1:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  801bc7:	77 57                	ja     801c20 <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801bc9:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bcc:	8b 40 0c             	mov    0xc(%eax),%eax
+  801bcf:	a3 00 90 80 00       	mov    %eax,0x809000
+  fsipcbuf.read.req_n = n;
+  801bd4:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801bda:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bdf:	b8 03 00 00 00       	mov    $0x3,%eax
+  801be4:	e8 79 fe ff ff       	call   801a62 <fsipc>
+  801be9:	89 c6                	mov    %eax,%esi
+  801beb:	85 c0                	test   %eax,%eax
+  801bed:	78 27                	js     801c16 <devfile_read+0x61>
+  assert(r <= n);
+  801bef:	39 c3                	cmp    %eax,%ebx
+  801bf1:	0f 82 0e 02 00 00    	jb     801e05 <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  801bf7:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801bfc:	0f 8f 1c 02 00 00    	jg     801e1e <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801c02:	83 ec 04             	sub    $0x4,%esp
+  801c05:	50                   	push   %eax
+  801c06:	68 00 90 80 00       	push   $0x809000
+  801c0b:	ff 75 0c             	push   0xc(%ebp)
+  801c0e:	e8 39 f0 ff ff       	call   800c4c <memmove>
+  return r;
+  801c13:	83 c4 10             	add    $0x10,%esp
+}
+  801c16:	89 f0                	mov    %esi,%eax
+  801c18:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c1b:	5b                   	pop    %ebx
+  801c1c:	5e                   	pop    %esi
+  801c1d:	5f                   	pop    %edi
+  801c1e:	5d                   	pop    %ebp
+  801c1f:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  801c20:	b8 01 00 00 00       	mov    $0x1,%eax
+  801c25:	e8 0f ff ff ff       	call   801b39 <fsv_alloc>
+  801c2a:	89 c6                	mov    %eax,%esi
+  801c2c:	85 c0                	test   %eax,%eax
+  801c2e:	78 e6                	js     801c16 <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  801c30:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c33:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c36:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  801c3b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c3e:	8b 40 04             	mov    0x4(%eax),%eax
+  801c41:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  801c46:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  801c4c:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801c53:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801c58:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801c5d:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801c62:	e8 e2 fc ff ff       	call   801949 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801c67:	6a 00                	push   $0x0
+  801c69:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801c6c:	50                   	push   %eax
+  801c6d:	68 00 10 c0 9f       	push   $0x9fc01000
+  801c72:	6a 00                	push   $0x0
+  801c74:	e8 c0 17 00 00       	call   803439 <ipc_recv_pages>
+  801c79:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  801c7b:	83 c4 10             	add    $0x10,%esp
+  801c7e:	85 c0                	test   %eax,%eax
+  801c80:	7e 94                	jle    801c16 <devfile_read+0x61>
+  assert(r <= n);
+  801c82:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801c85:	39 c3                	cmp    %eax,%ebx
+  801c87:	72 2e                	jb     801cb7 <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801c89:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c8c:	8b 40 04             	mov    0x4(%eax),%eax
+  801c8f:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801c94:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  801c97:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801c9a:	c1 e2 0c             	shl    $0xc,%edx
+  801c9d:	39 ca                	cmp    %ecx,%edx
+  801c9f:	72 2f                	jb     801cd0 <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  801ca1:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  801ca6:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  801ca9:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  801cad:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801cb2:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  801cb5:	eb 52                	jmp    801d09 <devfile_read+0x154>
+  assert(r <= n);
+  801cb7:	68 71 3d 80 00       	push   $0x803d71
+  801cbc:	68 78 3d 80 00       	push   $0x803d78
+  801cc1:	68 49 01 00 00       	push   $0x149
+  801cc6:	68 66 3d 80 00       	push   $0x803d66
+  801ccb:	e8 2d e7 ff ff       	call   8003fd <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801cd0:	68 9c 3d 80 00       	push   $0x803d9c
+  801cd5:	68 78 3d 80 00       	push   $0x803d78
+  801cda:	68 4a 01 00 00       	push   $0x14a
+  801cdf:	68 66 3d 80 00       	push   $0x803d66
+  801ce4:	e8 14 e7 ff ff       	call   8003fd <_panic>
+      memmove(dst + done, src + done, m);
+  801ce9:	83 ec 04             	sub    $0x4,%esp
+  801cec:	53                   	push   %ebx
+  801ced:	56                   	push   %esi
+  801cee:	89 f8                	mov    %edi,%eax
+  801cf0:	03 45 0c             	add    0xc(%ebp),%eax
+  801cf3:	50                   	push   %eax
+  801cf4:	e8 53 ef ff ff       	call   800c4c <memmove>
+  801cf9:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  801cfc:	01 df                	add    %ebx,%edi
+  801cfe:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801d01:	39 c7                	cmp    %eax,%edi
+  801d03:	0f 83 c0 00 00 00    	jae    801dc9 <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801d09:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801d0c:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  801d0f:	89 f0                	mov    %esi,%eax
+  801d11:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801d16:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  801d1b:	29 c3                	sub    %eax,%ebx
+  801d1d:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801d20:	29 f8                	sub    %edi,%eax
+  801d22:	39 c3                	cmp    %eax,%ebx
+  801d24:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  801d27:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801d2d:	75 ba                	jne    801ce9 <devfile_read+0x134>
+  801d2f:	89 f9                	mov    %edi,%ecx
+  801d31:	03 4d 0c             	add    0xc(%ebp),%ecx
+  801d34:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  801d37:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  801d3d:	75 aa                	jne    801ce9 <devfile_read+0x134>
+  801d3f:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  801d45:	77 a2                	ja     801ce9 <devfile_read+0x134>
+  801d47:	89 c8                	mov    %ecx,%eax
+  801d49:	c1 e8 16             	shr    $0x16,%eax
+  801d4c:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801d53:	a8 01                	test   $0x1,%al
+  801d55:	74 92                	je     801ce9 <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  801d57:	89 c8                	mov    %ecx,%eax
+  801d59:	c1 e8 0c             	shr    $0xc,%eax
+  801d5c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  801d63:	a8 01                	test   $0x1,%al
+  801d65:	74 82                	je     801ce9 <devfile_read+0x134>
+  801d67:	a9 02 08 00 00       	test   $0x802,%eax
+  801d6c:	0f 84 77 ff ff ff    	je     801ce9 <devfile_read+0x134>
+  801d72:	f6 c4 04             	test   $0x4,%ah
+  801d75:	0f 85 6e ff ff ff    	jne    801ce9 <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  801d7b:	a1 f0 85 80 00       	mov    0x8085f0,%eax
+  801d80:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  801d84:	84 c0                	test   %al,%al
+  801d86:	75 17                	jne    801d9f <devfile_read+0x1ea>
+  801d88:	83 ec 08             	sub    $0x8,%esp
+  801d8b:	6a 01                	push   $0x1
+  801d8d:	6a 00                	push   $0x0
+  801d8f:	e8 1e f1 ff ff       	call   800eb2 <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  801d94:	83 c4 10             	add    $0x10,%esp
+  801d97:	85 c0                	test   %eax,%eax
+  801d99:	0f 85 4a ff ff ff    	jne    801ce9 <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  801d9f:	83 ec 04             	sub    $0x4,%esp
+  801da2:	68 05 08 00 00       	push   $0x805
+  801da7:	ff 75 cc             	push   -0x34(%ebp)
+  801daa:	6a 00                	push   $0x0
+  801dac:	56                   	push   %esi
+  801dad:	6a 00                	push   $0x0
+  801daf:	6a 05                	push   $0x5
+  801db1:	68 40 60 80 00       	push   $0x806040
+  801db6:	e8 8d f5 ff ff       	call   801348 <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  801dbb:	c1 e8 1f             	shr    $0x1f,%eax
+  801dbe:	08 45 cb             	or     %al,-0x35(%ebp)
+  801dc1:	83 c4 20             	add    $0x20,%esp
+  801dc4:	e9 33 ff ff ff       	jmp    801cfc <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  801dc9:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  801dcc:	83 ec 0c             	sub    $0xc,%esp
+  801dcf:	68 40 60 80 00       	push   $0x806040
+  801dd4:	e8 1f f5 ff ff       	call   8012f8 <sysbatch_flush>
+  801dd9:	83 c4 10             	add    $0x10,%esp
+  801ddc:	85 c0                	test   %eax,%eax
+  801dde:	78 06                	js     801de6 <devfile_read+0x231>
+  801de0:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  801de4:	74 14                	je     801dfa <devfile_read+0x245>
+    memmove(dst, src, r);
+  801de6:	83 ec 04             	sub    $0x4,%esp
+  801de9:	ff 75 d4             	push   -0x2c(%ebp)
+  801dec:	ff 75 d0             	push   -0x30(%ebp)
+  801def:	ff 75 0c             	push   0xc(%ebp)
+  801df2:	e8 55 ee ff ff       	call   800c4c <memmove>
+  801df7:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  801dfa:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dfd:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  801e00:	e9 11 fe ff ff       	jmp    801c16 <devfile_read+0x61>
+  assert(r <= n);
+  801e05:	68 71 3d 80 00       	push   $0x803d71
+  801e0a:	68 78 3d 80 00       	push   $0x803d78
+  801e0f:	68 1c 01 00 00       	push   $0x11c
+  801e14:	68 66 3d 80 00       	push   $0x803d66
+  801e19:	e8 df e5 ff ff       	call   8003fd <_panic>
+  assert(r <= PGSIZE);
+  801e1e:	68 8d 3d 80 00       	push   $0x803d8d
+  801e23:	68 78 3d 80 00       	push   $0x803d78
+  801e28:	68 1d 01 00 00       	push   $0x11d
+  801e2d:	68 66 3d 80 00       	push   $0x803d66
+  801e32:	e8 c6 e5 ff ff       	call   8003fd <_panic>
+
+00801e37 <devfile_write>:
+{
+  801e37:	55                   	push   %ebp
+  801e38:	89 e5                	mov    %esp,%ebp
+  801e3a:	57                   	push   %edi
+  801e3b:	56                   	push   %esi
+  801e3c:	53                   	push   %ebx
+  801e3d:	83 ec 1c             	sub    $0x1c,%esp
+  801e40:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e43:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  801e46:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  801e4b:	77 39                	ja     801e86 <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801e4d:	8b 56 0c             	mov    0xc(%esi),%edx
+  801e50:	89 15 00 90 80 00    	mov    %edx,0x809000
+  fsipcbuf.write.req_n = n;
+  801e56:	a3 04 90 80 00       	mov    %eax,0x809004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  801e5b:	83 ec 04             	sub    $0x4,%esp
+  801e5e:	50                   	push   %eax
+  801e5f:	ff 75 0c             	push   0xc(%ebp)
+  801e62:	68 08 90 80 00       	push   $0x809008
+  801e67:	e8 e0 ed ff ff       	call   800c4c <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801e6c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e71:	b8 04 00 00 00       	mov    $0x4,%eax
+  801e76:	e8 e7 fb ff ff       	call   801a62 <fsipc>
+  801e7b:	83 c4 10             	add    $0x10,%esp
+}
+  801e7e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e81:	5b                   	pop    %ebx
+  801e82:	5e                   	pop    %esi
+  801e83:	5f                   	pop    %edi
+  801e84:	5d                   	pop    %ebp
+  801e85:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  801e86:	ba 00 00 10 00       	mov    $0x100000,%edx
+  801e8b:	39 d0                	cmp    %edx,%eax
+  801e8d:	89 d3                	mov    %edx,%ebx
+  801e8f:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  801e92:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  801e98:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  801e9b:	83 c7 01             	add    $0x1,%edi
+  801e9e:	89 f8                	mov    %edi,%eax
+  801ea0:	e8 94 fc ff ff       	call   801b39 <fsv_alloc>
+  801ea5:	85 c0                	test   %eax,%eax
+  801ea7:	78 d5                	js     801e7e <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  801ea9:	83 ec 04             	sub    $0x4,%esp
+  801eac:	53                   	push   %ebx
+  801ead:	ff 75 0c             	push   0xc(%ebp)
+  801eb0:	68 00 10 c0 9f       	push   $0x9fc01000
+  801eb5:	e8 92 ed ff ff       	call   800c4c <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  801eba:	8b 46 0c             	mov    0xc(%esi),%eax
+  801ebd:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  801ec2:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  801ec8:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801ecf:	89 f9                	mov    %edi,%ecx
+  801ed1:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801ed6:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801edb:	e8 69 fa ff ff       	call   801949 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801ee0:	6a 00                	push   $0x0
+  801ee2:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801ee5:	50                   	push   %eax
+  801ee6:	6a 00                	push   $0x0
+  801ee8:	6a 00                	push   $0x0
+  801eea:	e8 4a 15 00 00       	call   803439 <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  801eef:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  801ef2:	eb 8a                	jmp    801e7e <devfile_write+0x47>
+
+00801ef4 <open>:
+{
+  801ef4:	55                   	push   %ebp
+  801ef5:	89 e5                	mov    %esp,%ebp
+  801ef7:	56                   	push   %esi
+  801ef8:	53                   	push   %ebx
+  801ef9:	83 ec 1c             	sub    $0x1c,%esp
+  801efc:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801eff:	56                   	push   %esi
+  801f00:	e8 86 eb ff ff       	call   800a8b <strlen>
+  801f05:	83 c4 10             	add    $0x10,%esp
+  801f08:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801f0d:	7f 6c                	jg     801f7b <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  801f0f:	83 ec 0c             	sub    $0xc,%esp
+  801f12:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f15:	50                   	push   %eax
+  801f16:	e8 ad f4 ff ff       	call   8013c8 <fd_alloc>
+  801f1b:	89 c3                	mov    %eax,%ebx
+  801f1d:	83 c4 10             	add    $0x10,%esp
+  801f20:	85 c0                	test   %eax,%eax
+  801f22:	78 3c                	js     801f60 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801f24:	83 ec 08             	sub    $0x8,%esp
+  801f27:	56                   	push   %esi
+  801f28:	68 00 90 80 00       	push   $0x809000
+  801f2d:	e8 94 eb ff ff       	call   800ac6 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801f32:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f35:	a3 00 94 80 00       	mov    %eax,0x809400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801f3a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801f3d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f42:	e8 1b fb ff ff       	call   801a62 <fsipc>
+  801f47:	89 c3                	mov    %eax,%ebx
+  801f49:	83 c4 10             	add    $0x10,%esp
+  801f4c:	85 c0                	test   %eax,%eax
+  801f4e:	78 19                	js     801f69 <open+0x75>
+  return fd2num(fd);
+  801f50:	83 ec 0c             	sub    $0xc,%esp
+  801f53:	ff 75 f4             	push   -0xc(%ebp)
+  801f56:	e8 49 f4 ff ff       	call   8013a4 <fd2num>
+  801f5b:	89 c3                	mov    %eax,%ebx
+  801f5d:	83 c4 10             	add    $0x10,%esp
+}
+  801f60:	89 d8                	mov    %ebx,%eax
+  801f62:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f65:	5b                   	pop    %ebx
+  801f66:	5e                   	pop    %esi
+  801f67:	5d                   	pop    %ebp
+  801f68:	c3                   	ret
+    fd_close(fd, 0);
+  801f69:	83 ec 08             	sub    $0x8,%esp
+  801f6c:	6a 00                	push   $0x0
+  801f6e:	ff 75 f4             	push   -0xc(%ebp)
+  801f71:	e8 44 f5 ff ff       	call   8014ba <fd_close>
+    return r;
+  801f76:	83 c4 10             	add    $0x10,%esp
+  801f79:	eb e5                	jmp    801f60 <open+0x6c>
+    return -E_BAD_PATH;
+  801f7b:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801f80:	eb de                	jmp    801f60 <open+0x6c>
+
+00801f82 <open_read>:
+{
+  801f82:	55                   	push   %ebp
+  801f83:	89 e5                	mov    %esp,%ebp
+  801f85:	57                   	push   %edi
+  801f86:	56                   	push   %esi
+  801f87:	53                   	push   %ebx
+  801f88:	83 ec 28             	sub    $0x28,%esp
+  801f8b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  801f8e:	57                   	push   %edi
+  801f8f:	e8 f7 ea ff ff       	call   800a8b <strlen>
+  801f94:	83 c4 10             	add    $0x10,%esp
+  801f97:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801f9c:	0f 87 f6 00 00 00    	ja     802098 <open_read+0x116>
+  801fa2:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  801fa4:	83 ec 0c             	sub    $0xc,%esp
+  801fa7:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801faa:	50                   	push   %eax
+  801fab:	e8 18 f4 ff ff       	call   8013c8 <fd_alloc>
+  801fb0:	89 c3                	mov    %eax,%ebx
+  801fb2:	83 c4 10             	add    $0x10,%esp
+  801fb5:	85 c0                	test   %eax,%eax
+  801fb7:	0f 88 b2 00 00 00    	js     80206f <open_read+0xed>
+  strcpy(req->req_buf, path);
+  801fbd:	83 ec 08             	sub    $0x8,%esp
+  801fc0:	57                   	push   %edi
+  801fc1:	68 e4 90 80 00       	push   $0x8090e4
+  801fc6:	e8 fb ea ff ff       	call   800ac6 <strcpy>
+  req->req_nops = 2;
+  801fcb:	c7 05 00 90 80 00 02 	movl   $0x2,0x809000
+  801fd2:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  801fd5:	c7 05 04 90 80 00 01 	movl   $0x1,0x809004
+  801fdc:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  801fdf:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801fe2:	a3 10 90 80 00       	mov    %eax,0x809010
+  req->req_ops[0].op_buf = 0;
+  801fe7:	c7 05 18 90 80 00 00 	movl   $0x0,0x809018
+  801fee:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  801ff1:	c7 05 20 90 80 00 04 	movl   $0x4,0x809020
+  801ff8:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  801ffb:	c7 05 24 90 80 00 01 	movl   $0x1,0x809024
+  802002:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  802005:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  80200a:	29 f0                	sub    %esi,%eax
+  80200c:	3b 45 14             	cmp    0x14(%ebp),%eax
+  80200f:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  802013:	a3 2c 90 80 00       	mov    %eax,0x80902c
+  req->req_ops[1].op_offset = 0;
+  802018:	c7 05 30 90 80 00 00 	movl   $0x0,0x809030
+  80201f:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  802022:	83 c6 01             	add    $0x1,%esi
+  802025:	89 35 34 90 80 00    	mov    %esi,0x809034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  80202b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80202e:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802033:	e8 2a fa ff ff       	call   801a62 <fsipc>
+  802038:	89 c3                	mov    %eax,%ebx
+  80203a:	83 c4 10             	add    $0x10,%esp
+  80203d:	83 f8 01             	cmp    $0x1,%eax
+  802040:	7e 37                	jle    802079 <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  802042:	a1 38 90 80 00       	mov    0x809038,%eax
+  802047:	8b 55 18             	mov    0x18(%ebp),%edx
+  80204a:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  80204c:	83 ec 04             	sub    $0x4,%esp
+  80204f:	50                   	push   %eax
+  802050:	81 c6 e4 90 80 00    	add    $0x8090e4,%esi
+  802056:	56                   	push   %esi
+  802057:	ff 75 10             	push   0x10(%ebp)
+  80205a:	e8 ed eb ff ff       	call   800c4c <memmove>
+  return fd2num(fd);
+  80205f:	83 c4 04             	add    $0x4,%esp
+  802062:	ff 75 e4             	push   -0x1c(%ebp)
+  802065:	e8 3a f3 ff ff       	call   8013a4 <fd2num>
+  80206a:	89 c3                	mov    %eax,%ebx
+  80206c:	83 c4 10             	add    $0x10,%esp
+}
+  80206f:	89 d8                	mov    %ebx,%eax
+  802071:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802074:	5b                   	pop    %ebx
+  802075:	5e                   	pop    %esi
+  802076:	5f                   	pop    %edi
+  802077:	5d                   	pop    %ebp
+  802078:	c3                   	ret
+    fd_close(fd, 0);
+  802079:	83 ec 08             	sub    $0x8,%esp
+  80207c:	6a 00                	push   $0x0
+  80207e:	ff 75 e4             	push   -0x1c(%ebp)
+  802081:	e8 34 f4 ff ff       	call   8014ba <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  802086:	83 c4 10             	add    $0x10,%esp
+  802089:	85 db                	test   %ebx,%ebx
+  80208b:	78 e2                	js     80206f <open_read+0xed>
+  80208d:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  802090:	8b 9b 1c 90 80 00    	mov    0x80901c(%ebx),%ebx
+  802096:	eb d7                	jmp    80206f <open_read+0xed>
+    return -E_BAD_PATH;
+  802098:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80209d:	eb d0                	jmp    80206f <open_read+0xed>
+
+0080209f <file_stat>:
+{
+  80209f:	55                   	push   %ebp
+  8020a0:	89 e5                	mov    %esp,%ebp
+  8020a2:	57                   	push   %edi
+  8020a3:	56                   	push   %esi
+  8020a4:	53                   	push   %ebx
+  8020a5:	83 ec 18             	sub    $0x18,%esp
+  8020a8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8020ab:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  8020ae:	57                   	push   %edi
+  8020af:	e8 d7 e9 ff ff       	call   800a8b <strlen>
+  8020b4:	83 c4 10             	add    $0x10,%esp
+  8020b7:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8020bc:	0f 8f c7 00 00 00    	jg     802189 <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  8020c2:	83 ec 0c             	sub    $0xc,%esp
+  8020c5:	57                   	push   %edi
+  8020c6:	e8 c0 e9 ff ff       	call   800a8b <strlen>
+  8020cb:	8d 58 04             	lea    0x4(%eax),%ebx
+  8020ce:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  8020d1:	83 c4 08             	add    $0x8,%esp
+  8020d4:	57                   	push   %edi
+  8020d5:	68 e4 90 80 00       	push   $0x8090e4
+  8020da:	e8 e7 e9 ff ff       	call   800ac6 <strcpy>
+  req->req_nops = 2;
+  8020df:	c7 05 00 90 80 00 02 	movl   $0x2,0x809000
+  8020e6:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  8020e9:	c7 05 04 90 80 00 02 	movl   $0x2,0x809004
+  8020f0:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  8020f3:	c7 05 10 90 80 00 00 	movl   $0x0,0x809010
+  8020fa:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  8020fd:	c7 05 18 90 80 00 00 	movl   $0x0,0x809018
+  802104:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  802107:	c7 05 20 90 80 00 03 	movl   $0x3,0x809020
+  80210e:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  802111:	c7 05 24 90 80 00 01 	movl   $0x1,0x809024
+  802118:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  80211b:	89 1d 34 90 80 00    	mov    %ebx,0x809034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  802121:	ba 00 00 00 00       	mov    $0x0,%edx
+  802126:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80212b:	e8 32 f9 ff ff       	call   801a62 <fsipc>
+  802130:	83 c4 10             	add    $0x10,%esp
+  802133:	83 f8 01             	cmp    $0x1,%eax
+  802136:	7e 42                	jle    80217a <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  802138:	81 c3 e4 90 80 00    	add    $0x8090e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  80213e:	83 ec 08             	sub    $0x8,%esp
+  802141:	53                   	push   %ebx
+  802142:	56                   	push   %esi
+  802143:	e8 7e e9 ff ff       	call   800ac6 <strcpy>
+  st->st_size = ret->ret_size;
+  802148:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  80214e:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  802154:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  80215a:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  802160:	c7 86 88 00 00 00 90 	movl   $0x805790,0x88(%esi)
+  802167:	57 80 00 
+  return 0;
+  80216a:	83 c4 10             	add    $0x10,%esp
+  80216d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802172:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802175:	5b                   	pop    %ebx
+  802176:	5e                   	pop    %esi
+  802177:	5f                   	pop    %edi
+  802178:	5d                   	pop    %ebp
+  802179:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  80217a:	85 c0                	test   %eax,%eax
+  80217c:	78 f4                	js     802172 <file_stat+0xd3>
+  80217e:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802181:	8b 80 1c 90 80 00    	mov    0x80901c(%eax),%eax
+  802187:	eb e9                	jmp    802172 <file_stat+0xd3>
+    return -E_BAD_PATH;
+  802189:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  80218e:	eb e2                	jmp    802172 <file_stat+0xd3>
+
+00802190 <read_map>:
+{
+  802190:	55                   	push   %ebp
+  802191:	89 e5                	mov    %esp,%ebp
+  802193:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802196:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802199:	50                   	push   %eax
+  80219a:	ff 75 08             	push   0x8(%ebp)
+  80219d:	e8 7c f2 ff ff       	call   80141e <fd_lookup>
+  8021a2:	83 c4 10             	add    $0x10,%esp
+  8021a5:	85 c0                	test   %eax,%eax
+  8021a7:	78 2a                	js     8021d3 <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  8021a9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021ac:	8b 0d 90 57 80 00    	mov    0x805790,%ecx
+  8021b2:	39 08                	cmp    %ecx,(%eax)
+  8021b4:	75 1f                	jne    8021d5 <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  8021b6:	8b 40 0c             	mov    0xc(%eax),%eax
+  8021b9:	a3 00 90 80 00       	mov    %eax,0x809000
+  fsipcbuf.read_map.req_offset = offset;
+  8021be:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021c1:	a3 04 90 80 00       	mov    %eax,0x809004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  8021c6:	8b 55 10             	mov    0x10(%ebp),%edx
+  8021c9:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8021ce:	e8 8f f8 ff ff       	call   801a62 <fsipc>
+}
+  8021d3:	c9                   	leave
+  8021d4:	c3                   	ret
+    return -E_INVAL;
+  8021d5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021da:	eb f7                	jmp    8021d3 <read_map+0x43>
+
+008021dc <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8021dc:	55                   	push   %ebp
+  8021dd:	89 e5                	mov    %esp,%ebp
+  8021df:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  8021e2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021e7:	b8 08 00 00 00       	mov    $0x8,%eax
+  8021ec:	e8 71 f8 ff ff       	call   801a62 <fsipc>
+}
+  8021f1:	c9                   	leave
+  8021f2:	c3                   	ret
+
+008021f3 <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  8021f3:	55                   	push   %ebp
+  8021f4:	89 e5                	mov    %esp,%ebp
+  8021f6:	57                   	push   %edi
+  8021f7:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  8021f8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021fb:	a3 00 90 80 00       	mov    %eax,0x809000
+  fsipcbuf.stats.req_bio_sched = 0;
+  802200:	c7 05 04 90 80 00 00 	movl   $0x0,0x809004
+  802207:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  80220a:	c7 05 08 90 80 00 00 	movl   $0x0,0x809008
+  802211:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  802214:	ba 00 00 00 00       	mov    $0x0,%edx
+  802219:	b8 09 00 00 00       	mov    $0x9,%eax
+  80221e:	e8 3f f8 ff ff       	call   801a62 <fsipc>
+  802223:	85 c0                	test   %eax,%eax
+  802225:	78 14                	js     80223b <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  802227:	be 00 90 80 00       	mov    $0x809000,%esi
+  80222c:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802231:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802234:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  802236:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80223b:	5e                   	pop    %esi
+  80223c:	5f                   	pop    %edi
+  80223d:	5d                   	pop    %ebp
+  80223e:	c3                   	ret
+
+0080223f <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  80223f:	55                   	push   %ebp
+  802240:	89 e5                	mov    %esp,%ebp
+  802242:	53                   	push   %ebx
+  802243:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  802246:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802249:	50                   	push   %eax
+  80224a:	6a 00                	push   $0x0
+  80224c:	e8 a2 ff ff ff       	call   8021f3 <fs_stats>
+  802251:	83 c4 10             	add    $0x10,%esp
+  802254:	85 c0                	test   %eax,%eax
+  802256:	78 28                	js     802280 <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  802258:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  80225b:	83 ec 08             	sub    $0x8,%esp
+  80225e:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802261:	50                   	push   %eax
+  802262:	6a 20                	push   $0x20
+  802264:	e8 8a ff ff ff       	call   8021f3 <fs_stats>
+  802269:	83 c4 10             	add    $0x10,%esp
+  80226c:	85 c0                	test   %eax,%eax
+  80226e:	78 10                	js     802280 <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  802270:	83 ec 08             	sub    $0x8,%esp
+  802273:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802276:	50                   	push   %eax
+  802277:	53                   	push   %ebx
+  802278:	e8 76 ff ff ff       	call   8021f3 <fs_stats>
+  80227d:	83 c4 10             	add    $0x10,%esp
+}
+  802280:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802283:	c9                   	leave
+  802284:	c3                   	ret
+
+00802285 <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  802285:	55                   	push   %ebp
+  802286:	89 e5                	mov    %esp,%ebp
+  802288:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  80228b:	c7 05 00 90 80 00 00 	movl   $0x0,0x809000
+  802292:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  802295:	8b 45 08             	mov    0x8(%ebp),%eax
+  802298:	a3 04 90 80 00       	mov    %eax,0x809004
+  fsipcbuf.stats.req_dcache = 0;
+  80229d:	c7 05 08 90 80 00 00 	movl   $0x0,0x809008
+  8022a4:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  8022a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022ac:	b8 09 00 00 00       	mov    $0x9,%eax
+  8022b1:	e8 ac f7 ff ff       	call   801a62 <fsipc>
+}
+  8022b6:	c9                   	leave
+  8022b7:	c3                   	ret
+
+008022b8 <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  8022b8:	55                   	push   %ebp
+  8022b9:	89 e5                	mov    %esp,%ebp
+  8022bb:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  8022be:	c7 05 00 90 80 00 00 	movl   $0x0,0x809000
+  8022c5:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  8022c8:	c7 05 04 90 80 00 00 	movl   $0x0,0x809004
+  8022cf:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  8022d2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022d5:	a3 08 90 80 00       	mov    %eax,0x809008
+  return fsipc(FSREQ_STATS, NULL);
+  8022da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022df:	b8 09 00 00 00       	mov    $0x9,%eax
+  8022e4:	e8 79 f7 ff ff       	call   801a62 <fsipc>
+}
+  8022e9:	c9                   	leave
+  8022ea:	c3                   	ret
+
+008022eb <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  8022eb:	55                   	push   %ebp
+  8022ec:	89 e5                	mov    %esp,%ebp
+  8022ee:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8022f1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022f4:	50                   	push   %eax
+  8022f5:	ff 75 08             	push   0x8(%ebp)
+  8022f8:	e8 21 f1 ff ff       	call   80141e <fd_lookup>
+  8022fd:	83 c4 10             	add    $0x10,%esp
+  802300:	85 c0                	test   %eax,%eax
+  802302:	78 34                	js     802338 <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  802304:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802307:	8b 0d 90 57 80 00    	mov    0x805790,%ecx
+  80230d:	39 08                	cmp    %ecx,(%eax)
+  80230f:	75 29                	jne    80233a <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  802311:	8b 40 0c             	mov    0xc(%eax),%eax
+  802314:	a3 00 90 80 00       	mov    %eax,0x809000
+  fsipcbuf.fallocate.req_offset = offset;
+  802319:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80231c:	a3 04 90 80 00       	mov    %eax,0x809004
+  fsipcbuf.fallocate.req_len = len;
+  802321:	8b 45 10             	mov    0x10(%ebp),%eax
+  802324:	a3 08 90 80 00       	mov    %eax,0x809008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  802329:	ba 00 00 00 00       	mov    $0x0,%edx
+  80232e:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802333:	e8 2a f7 ff ff       	call   801a62 <fsipc>
+}
+  802338:	c9                   	leave
+  802339:	c3                   	ret
+    return -E_INVAL;
+  80233a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80233f:	eb f7                	jmp    802338 <fallocate+0x4d>
+
+00802341 <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  802341:	55                   	push   %ebp
+  802342:	89 e5                	mov    %esp,%ebp
+  802344:	57                   	push   %edi
+  802345:	56                   	push   %esi
+  802346:	53                   	push   %ebx
+  802347:	83 ec 24             	sub    $0x24,%esp
+  80234a:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80234d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802350:	50                   	push   %eax
+  802351:	ff 75 08             	push   0x8(%ebp)
+  802354:	e8 c5 f0 ff ff       	call   80141e <fd_lookup>
+  802359:	83 c4 10             	add    $0x10,%esp
+  80235c:	85 c0                	test   %eax,%eax
+  80235e:	78 66                	js     8023c6 <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  802360:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802363:	8b 0d 90 57 80 00    	mov    0x805790,%ecx
+  802369:	39 08                	cmp    %ecx,(%eax)
+  80236b:	75 61                	jne    8023ce <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  80236d:	85 f6                	test   %esi,%esi
+  80236f:	7e 50                	jle    8023c1 <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  802371:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  802376:	39 de                	cmp    %ebx,%esi
+  802378:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  80237b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80237e:	8b 40 0c             	mov    0xc(%eax),%eax
+  802381:	a3 00 90 80 00       	mov    %eax,0x809000
+    fsipcbuf.prefetch.req_n = m;
+  802386:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  80238c:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  802393:	83 ec 04             	sub    $0x4,%esp
+  802396:	57                   	push   %edi
+  802397:	ff 75 0c             	push   0xc(%ebp)
+  80239a:	68 08 90 80 00       	push   $0x809008
+  80239f:	e8 a8 e8 ff ff       	call   800c4c <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  8023a4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023a9:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8023ae:	e8 af f6 ff ff       	call   801a62 <fsipc>
+  8023b3:	83 c4 10             	add    $0x10,%esp
+  8023b6:	85 c0                	test   %eax,%eax
+  8023b8:	78 0c                	js     8023c6 <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  8023ba:	01 7d 0c             	add    %edi,0xc(%ebp)
+  8023bd:	29 de                	sub    %ebx,%esi
+  8023bf:	eb ac                	jmp    80236d <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  8023c1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023c9:	5b                   	pop    %ebx
+  8023ca:	5e                   	pop    %esi
+  8023cb:	5f                   	pop    %edi
+  8023cc:	5d                   	pop    %ebp
+  8023cd:	c3                   	ret
+    return -E_INVAL;
+  8023ce:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8023d3:	eb f1                	jmp    8023c6 <prefetch+0x85>
+
+008023d5 <spawn>:
+// argv: pointer to null-terminated array of pointers to strings,
+//   which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv)
+{
+  8023d5:	55                   	push   %ebp
+  8023d6:	89 e5                	mov    %esp,%ebp
+  8023d8:	57                   	push   %edi
+  8023d9:	56                   	push   %esi
+  8023da:	53                   	push   %ebx
+  8023db:	81 ec a8 02 00 00    	sub    $0x2a8,%esp
+  //     correct initial eip and esp values in the child.
+  //
+  //   - Start the child process running with sys_env_set_status().
+
+  // Open the program and read its ELF header in one round trip.
+  if ((r = open_read(prog, O_RDONLY, elf_buf, sizeof(elf_buf), &n)) < 0)
+  8023e1:	8d 85 a0 fd ff ff    	lea    -0x260(%ebp),%eax
+  8023e7:	50                   	push   %eax
+  8023e8:	68 00 02 00 00       	push   $0x200
+  8023ed:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  8023f3:	50                   	push   %eax
+  8023f4:	6a 00                	push   $0x0
+  8023f6:	ff 75 08             	push   0x8(%ebp)
+  8023f9:	e8 84 fb ff ff       	call   801f82 <open_read>
+  8023fe:	89 85 88 fd ff ff    	mov    %eax,-0x278(%ebp)
+  802404:	83 c4 20             	add    $0x20,%esp
+  802407:	85 c0                	test   %eax,%eax
+  802409:	0f 88 66 06 00 00    	js     802a75 <spawn+0x6a0>
+    return r;
+  fd = r;
+
+  elf = (struct Elf*)elf_buf;
+  if (n != sizeof(elf_buf) || elf->e_magic != ELF_MAGIC) {
+  80240f:	81 bd a0 fd ff ff 00 	cmpl   $0x200,-0x260(%ebp)
+  802416:	02 00 00 
+  802419:	0f 85 92 00 00 00    	jne    8024b1 <spawn+0xdc>
+  80241f:	81 bd e8 fd ff ff 7f 	cmpl   $0x464c457f,-0x218(%ebp)
+  802426:	45 4c 46 
+  802429:	0f 85 82 00 00 00    	jne    8024b1 <spawn+0xdc>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+  envid_t ret;
+  __asm __volatile("int %2"
+  80242f:	b8 07 00 00 00       	mov    $0x7,%eax
+  802434:	cd 30                	int    $0x30
+  802436:	89 85 90 fd ff ff    	mov    %eax,-0x270(%ebp)
+  80243c:	89 c6                	mov    %eax,%esi
+  80243e:	89 85 6c fd ff ff    	mov    %eax,-0x294(%ebp)
+    cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+    return -E_NOT_EXEC;
+  }
+
+  // Create new child environment
+  if ((r = sys_exofork()) < 0)
+  802444:	85 c0                	test   %eax,%eax
+  802446:	0f 88 35 06 00 00    	js     802a81 <spawn+0x6ac>
+    return r;
+  child = r;
+  sysbatch_init(&batch);
+  80244c:	83 ec 0c             	sub    $0xc,%esp
+  80244f:	68 60 67 80 00       	push   $0x806760
+  802454:	e8 91 ee ff ff       	call   8012ea <sysbatch_init>
+
+  // Set up trap frame, including initial stack.
+  child_tf = envs[ENVX(child)].env_tf;
+  802459:	89 f0                	mov    %esi,%eax
+  80245b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802460:	8d 34 c0             	lea    (%eax,%eax,8),%esi
+  802463:	c1 e6 04             	shl    $0x4,%esi
+  802466:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  80246c:	8d bd a4 fd ff ff    	lea    -0x25c(%ebp),%edi
+  802472:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802477:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  child_tf.tf_eip = elf->e_entry;
+  802479:	8b 85 00 fe ff ff    	mov    -0x200(%ebp),%eax
+  80247f:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  uintptr_t *argv_store;
+
+  // Count the number of arguments (argc)
+  // and the total amount of space needed for strings (string_size).
+  string_size = 0;
+  for (argc = 0; argv[argc] != 0; argc++)
+  802485:	83 c4 10             	add    $0x10,%esp
+  802488:	bb 00 00 00 00       	mov    $0x0,%ebx
+  string_size = 0;
+  80248d:	be 00 00 00 00       	mov    $0x0,%esi
+  802492:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  for (argc = 0; argv[argc] != 0; argc++)
+  802495:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+  802498:	85 c0                	test   %eax,%eax
+  80249a:	74 4d                	je     8024e9 <spawn+0x114>
+    string_size += strlen(argv[argc]) + 1;
+  80249c:	83 ec 0c             	sub    $0xc,%esp
+  80249f:	50                   	push   %eax
+  8024a0:	e8 e6 e5 ff ff       	call   800a8b <strlen>
+  8024a5:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+  for (argc = 0; argv[argc] != 0; argc++)
+  8024a9:	83 c3 01             	add    $0x1,%ebx
+  8024ac:	83 c4 10             	add    $0x10,%esp
+  8024af:	eb e4                	jmp    802495 <spawn+0xc0>
+    close(fd);
+  8024b1:	83 ec 0c             	sub    $0xc,%esp
+  8024b4:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  8024ba:	e8 82 f0 ff ff       	call   801541 <close>
+    cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  8024bf:	83 c4 0c             	add    $0xc,%esp
+  8024c2:	68 7f 45 4c 46       	push   $0x464c457f
+  8024c7:	ff b5 e8 fd ff ff    	push   -0x218(%ebp)
+  8024cd:	68 c8 3d 80 00       	push   $0x803dc8
+  8024d2:	e8 01 e0 ff ff       	call   8004d8 <cprintf>
+    return -E_NOT_EXEC;
+  8024d7:	83 c4 10             	add    $0x10,%esp
+  8024da:	c7 85 6c fd ff ff f2 	movl   $0xfffffff2,-0x294(%ebp)
+  8024e1:	ff ff ff 
+  8024e4:	e9 98 05 00 00       	jmp    802a81 <spawn+0x6ac>
+  // Determine where to place the strings and the argv array.
+  // Set up pointers into the temporary page 'UTEMP'; we'll map a page
+  // there later, then remap that page into the child environment
+  // at (USTACKTOP - PGSIZE).
+  // strings is the topmost thing on the stack.
+  string_store = (char*)UTEMP + PGSIZE - string_size;
+  8024e9:	89 9d 84 fd ff ff    	mov    %ebx,-0x27c(%ebp)
+  8024ef:	bf 00 10 40 00       	mov    $0x401000,%edi
+  8024f4:	29 f7                	sub    %esi,%edi
+  // argv is below that.  There's one argument pointer per argument, plus
+  // a null pointer.
+  argv_store = (uintptr_t*)(ROUNDDOWN(string_store, 4) - 4 * (argc + 1));
+  8024f6:	89 fa                	mov    %edi,%edx
+  8024f8:	83 e2 fc             	and    $0xfffffffc,%edx
+  8024fb:	8d 04 9d 04 00 00 00 	lea    0x4(,%ebx,4),%eax
+  802502:	29 c2                	sub    %eax,%edx
+  802504:	89 95 94 fd ff ff    	mov    %edx,-0x26c(%ebp)
+
+  // Make sure that argv, strings, and the 2 words that hold 'argc'
+  // and 'argv' themselves will all fit in a single stack page.
+  if ((void*)(argv_store - 2) < (void*)UTEMP)
+  80250a:	8d 42 f8             	lea    -0x8(%edx),%eax
+  80250d:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  802512:	0f 86 a8 05 00 00    	jbe    802ac0 <spawn+0x6eb>
+    return -E_NO_MEM;
+
+  // Allocate the single stack page at UTEMP.
+  if ((r = sys_page_alloc(0, (void*)UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  802518:	83 ec 04             	sub    $0x4,%esp
+  80251b:	6a 07                	push   $0x7
+  80251d:	68 00 00 40 00       	push   $0x400000
+  802522:	6a 00                	push   $0x0
+  802524:	e8 cc e9 ff ff       	call   800ef5 <sys_page_alloc>
+  802529:	83 c4 10             	add    $0x10,%esp
+  80252c:	85 c0                	test   %eax,%eax
+  80252e:	0f 88 91 05 00 00    	js     802ac5 <spawn+0x6f0>
+  //	  (Again, argv should use an address valid in the child's
+  //	  environment.)
+  //
+  //	* Set *init_esp to the initial stack pointer for the child,
+  //	  (Again, use an address valid in the child's environment.)
+  for (i = 0; i < argc; i++) {
+  802534:	be 00 00 00 00       	mov    $0x0,%esi
+  802539:	89 9d 8c fd ff ff    	mov    %ebx,-0x274(%ebp)
+  80253f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802542:	eb 30                	jmp    802574 <spawn+0x19f>
+    argv_store[i] = UTEMP2USTACK(string_store);
+  802544:	8d 87 00 d0 7f ee    	lea    -0x11803000(%edi),%eax
+  80254a:	8b 8d 94 fd ff ff    	mov    -0x26c(%ebp),%ecx
+  802550:	89 04 b1             	mov    %eax,(%ecx,%esi,4)
+    strcpy(string_store, argv[i]);
+  802553:	83 ec 08             	sub    $0x8,%esp
+  802556:	ff 34 b3             	push   (%ebx,%esi,4)
+  802559:	57                   	push   %edi
+  80255a:	e8 67 e5 ff ff       	call   800ac6 <strcpy>
+    string_store += strlen(argv[i]) + 1;
+  80255f:	83 c4 04             	add    $0x4,%esp
+  802562:	ff 34 b3             	push   (%ebx,%esi,4)
+  802565:	e8 21 e5 ff ff       	call   800a8b <strlen>
+  80256a:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+  for (i = 0; i < argc; i++) {
+  80256e:	83 c6 01             	add    $0x1,%esi
+  802571:	83 c4 10             	add    $0x10,%esp
+  802574:	39 b5 8c fd ff ff    	cmp    %esi,-0x274(%ebp)
+  80257a:	7f c8                	jg     802544 <spawn+0x16f>
+  }
+  argv_store[argc] = 0;
+  80257c:	8b 85 94 fd ff ff    	mov    -0x26c(%ebp),%eax
+  802582:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  802588:	c7 04 88 00 00 00 00 	movl   $0x0,(%eax,%ecx,4)
+  assert(string_store == (char*)UTEMP + PGSIZE);
+  80258f:	81 ff 00 10 40 00    	cmp    $0x401000,%edi
+  802595:	0f 85 97 00 00 00    	jne    802632 <spawn+0x25d>
+
+  argv_store[-1] = UTEMP2USTACK(argv_store);
+  80259b:	8b 8d 94 fd ff ff    	mov    -0x26c(%ebp),%ecx
+  8025a1:	8d 81 00 d0 7f ee    	lea    -0x11803000(%ecx),%eax
+  8025a7:	89 41 fc             	mov    %eax,-0x4(%ecx)
+  argv_store[-2] = argc;
+  8025aa:	89 c8                	mov    %ecx,%eax
+  8025ac:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  8025b2:	89 48 f8             	mov    %ecx,-0x8(%eax)
+
+  *init_esp = UTEMP2USTACK(&argv_store[-2]);
+  8025b5:	2d 08 30 80 11       	sub    $0x11803008,%eax
+  8025ba:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+
+  // After completing the stack, map it into the child's address space
+  // and unmap it from ours!  Both calls ride along with the first batch
+  // of segment mappings.
+  if ((r = sysbatch_add(&batch, SYS_page_map, 0, (uint32_t) UTEMP, child,
+  8025c0:	83 ec 04             	sub    $0x4,%esp
+  8025c3:	6a 07                	push   $0x7
+  8025c5:	68 00 d0 bf ee       	push   $0xeebfd000
+  8025ca:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  8025d0:	68 00 00 40 00       	push   $0x400000
+  8025d5:	6a 00                	push   $0x0
+  8025d7:	6a 05                	push   $0x5
+  8025d9:	68 60 67 80 00       	push   $0x806760
+  8025de:	e8 65 ed ff ff       	call   801348 <sysbatch_add>
+  8025e3:	89 c3                	mov    %eax,%ebx
+  8025e5:	83 c4 20             	add    $0x20,%esp
+  8025e8:	85 c0                	test   %eax,%eax
+  8025ea:	0f 88 dd 04 00 00    	js     802acd <spawn+0x6f8>
+                        USTACKTOP - PGSIZE, PTE_P | PTE_U | PTE_W)) < 0)
+    goto error;
+  if ((r = sysbatch_add(&batch, SYS_page_unmap, 0, (uint32_t) UTEMP,
+  8025f0:	83 ec 04             	sub    $0x4,%esp
+  8025f3:	6a 00                	push   $0x0
+  8025f5:	6a 00                	push   $0x0
+  8025f7:	6a 00                	push   $0x0
+  8025f9:	68 00 00 40 00       	push   $0x400000
+  8025fe:	6a 00                	push   $0x0
+  802600:	6a 06                	push   $0x6
+  802602:	68 60 67 80 00       	push   $0x806760
+  802607:	e8 3c ed ff ff       	call   801348 <sysbatch_add>
+  80260c:	89 c3                	mov    %eax,%ebx
+  80260e:	83 c4 20             	add    $0x20,%esp
+  802611:	85 c0                	test   %eax,%eax
+  802613:	0f 88 b4 04 00 00    	js     802acd <spawn+0x6f8>
+  ph = (struct Proghdr*)(elf_buf + elf->e_phoff);
+  802619:	8b 85 04 fe ff ff    	mov    -0x1fc(%ebp),%eax
+  80261f:	8d bc 05 e8 fd ff ff 	lea    -0x218(%ebp,%eax,1),%edi
+  for (i = 0; i < elf->e_phnum; i++, ph++) {
+  802626:	ba 00 00 00 00       	mov    $0x0,%edx
+  80262b:	89 d6                	mov    %edx,%esi
+  80262d:	e9 dd 01 00 00       	jmp    80280f <spawn+0x43a>
+  assert(string_store == (char*)UTEMP + PGSIZE);
+  802632:	68 40 3e 80 00       	push   $0x803e40
+  802637:	68 78 3d 80 00       	push   $0x803d78
+  80263c:	68 01 01 00 00       	push   $0x101
+  802641:	68 e2 3d 80 00       	push   $0x803de2
+  802646:	e8 b2 dd ff ff       	call   8003fd <_panic>
+
+  for (i = 0; i < memsz; i += n * PGSIZE) {
+    if (i >= filesz) {
+      // allocate a blank page
+      n = 1;
+      if ((r = sysbatch_add(&batch, SYS_page_alloc, child, va + i,
+  80264b:	83 ec 04             	sub    $0x4,%esp
+  80264e:	6a 00                	push   $0x0
+  802650:	6a 00                	push   $0x0
+  802652:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  802658:	8b 85 78 fd ff ff    	mov    -0x288(%ebp),%eax
+  80265e:	8b 8d 70 fd ff ff    	mov    -0x290(%ebp),%ecx
+  802664:	01 c8                	add    %ecx,%eax
+  802666:	50                   	push   %eax
+  802667:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  80266d:	6a 04                	push   $0x4
+  80266f:	68 60 67 80 00       	push   $0x806760
+  802674:	e8 cf ec ff ff       	call   801348 <sysbatch_add>
+  802679:	83 c4 20             	add    $0x20,%esp
+  80267c:	85 c0                	test   %eax,%eax
+  80267e:	0f 88 0b 04 00 00    	js     802a8f <spawn+0x6ba>
+      n = 1;
+  802684:	bf 01 00 00 00       	mov    $0x1,%edi
+  for (i = 0; i < memsz; i += n * PGSIZE) {
+  802689:	89 f8                	mov    %edi,%eax
+  80268b:	c1 e0 0c             	shl    $0xc,%eax
+  80268e:	01 85 84 fd ff ff    	add    %eax,-0x27c(%ebp)
+  802694:	e9 fc 01 00 00       	jmp    802895 <spawn+0x4c0>
+  802699:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80269e:	eb 0e                	jmp    8026ae <spawn+0x2d9>
+  8026a0:	8b bd 60 fd ff ff    	mov    -0x2a0(%ebp),%edi
+  8026a6:	e9 c1 00 00 00       	jmp    80276c <spawn+0x397>
+          return r;
+        if (r < MIN(PGSIZE, filesz - i - j * PGSIZE))
+          return -E_INVAL;
+      }
+    } else {
+      for (j = 0; j < n; j++)
+  8026ab:	83 c3 01             	add    $0x1,%ebx
+  8026ae:	39 df                	cmp    %ebx,%edi
+  8026b0:	7e 55                	jle    802707 <spawn+0x332>
+        if ((r = sysbatch_add(&batch, SYS_page_alloc, 0,
+  8026b2:	83 ec 04             	sub    $0x4,%esp
+  8026b5:	6a 00                	push   $0x0
+  8026b7:	6a 00                	push   $0x0
+  8026b9:	6a 07                	push   $0x7
+  8026bb:	89 d8                	mov    %ebx,%eax
+  8026bd:	c1 e0 0c             	shl    $0xc,%eax
+  8026c0:	05 00 10 40 00       	add    $0x401000,%eax
+  8026c5:	50                   	push   %eax
+  8026c6:	6a 00                	push   $0x0
+  8026c8:	6a 04                	push   $0x4
+  8026ca:	68 60 67 80 00       	push   $0x806760
+  8026cf:	e8 74 ec ff ff       	call   801348 <sysbatch_add>
+  8026d4:	83 c4 20             	add    $0x20,%esp
+  8026d7:	85 c0                	test   %eax,%eax
+  8026d9:	79 d0                	jns    8026ab <spawn+0x2d6>
+  8026db:	89 c6                	mov    %eax,%esi
+  sys_env_destroy(child);
+  8026dd:	83 ec 0c             	sub    $0xc,%esp
+  8026e0:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  8026e6:	e8 48 e7 ff ff       	call   800e33 <sys_env_destroy>
+  close(fd);
+  8026eb:	83 c4 04             	add    $0x4,%esp
+  8026ee:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  8026f4:	e8 48 ee ff ff       	call   801541 <close>
+  return r;
+  8026f9:	83 c4 10             	add    $0x10,%esp
+  8026fc:	89 b5 6c fd ff ff    	mov    %esi,-0x294(%ebp)
+  802702:	e9 7a 03 00 00       	jmp    802a81 <spawn+0x6ac>
+                              (uint32_t) UTEMP2 + j * PGSIZE,
+                              PTE_P|PTE_U|PTE_W, 0, 0)) < 0)
+          return r;
+      if ((r = sysbatch_flush(&batch)) < 0)
+  802707:	83 ec 0c             	sub    $0xc,%esp
+  80270a:	68 60 67 80 00       	push   $0x806760
+  80270f:	e8 e4 eb ff ff       	call   8012f8 <sysbatch_flush>
+  802714:	83 c4 10             	add    $0x10,%esp
+  802717:	85 c0                	test   %eax,%eax
+  802719:	0f 88 85 03 00 00    	js     802aa4 <spawn+0x6cf>
+        return r;
+      if ((r = seek(fd, fileoffset + i)) < 0)
+  80271f:	83 ec 08             	sub    $0x8,%esp
+  802722:	8b 85 74 fd ff ff    	mov    -0x28c(%ebp),%eax
+  802728:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  80272e:	01 c8                	add    %ecx,%eax
+  802730:	50                   	push   %eax
+  802731:	8b 9d 88 fd ff ff    	mov    -0x278(%ebp),%ebx
+  802737:	53                   	push   %ebx
+  802738:	e8 dc f0 ff ff       	call   801819 <seek>
+  80273d:	83 c4 10             	add    $0x10,%esp
+  802740:	85 c0                	test   %eax,%eax
+  802742:	0f 88 63 03 00 00    	js     802aab <spawn+0x6d6>
+        return r;
+      if ((r = readn(fd, UTEMP2, MIN(n * PGSIZE, filesz - i))) < 0)
+  802748:	83 ec 04             	sub    $0x4,%esp
+  80274b:	89 f8                	mov    %edi,%eax
+  80274d:	c1 e0 0c             	shl    $0xc,%eax
+  802750:	39 f0                	cmp    %esi,%eax
+  802752:	0f 47 c6             	cmova  %esi,%eax
+  802755:	50                   	push   %eax
+  802756:	68 00 10 40 00       	push   $0x401000
+  80275b:	53                   	push   %ebx
+  80275c:	e8 ef ef ff ff       	call   801750 <readn>
+  802761:	83 c4 10             	add    $0x10,%esp
+  802764:	85 c0                	test   %eax,%eax
+  802766:	0f 88 46 03 00 00    	js     802ab2 <spawn+0x6dd>
+        return r;
+    }
+    for (j = 0; j < n; j++) {
+  80276c:	8d b7 01 04 00 00    	lea    0x401(%edi),%esi
+  802772:	c1 e6 0c             	shl    $0xc,%esi
+  802775:	bb 00 10 40 00       	mov    $0x401000,%ebx
+      if ((r = sysbatch_add(&batch, SYS_page_map, 0,
+  80277a:	8b 85 70 fd ff ff    	mov    -0x290(%ebp),%eax
+  802780:	8b 8d 78 fd ff ff    	mov    -0x288(%ebp),%ecx
+  802786:	8d 84 08 00 f0 bf ff 	lea    -0x401000(%eax,%ecx,1),%eax
+  80278d:	89 bd 80 fd ff ff    	mov    %edi,-0x280(%ebp)
+  802793:	89 c7                	mov    %eax,%edi
+    for (j = 0; j < n; j++) {
+  802795:	39 f3                	cmp    %esi,%ebx
+  802797:	74 59                	je     8027f2 <spawn+0x41d>
+      if ((r = sysbatch_add(&batch, SYS_page_map, 0,
+  802799:	83 ec 04             	sub    $0x4,%esp
+  80279c:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  8027a2:	8d 04 1f             	lea    (%edi,%ebx,1),%eax
+  8027a5:	50                   	push   %eax
+  8027a6:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  8027ac:	53                   	push   %ebx
+  8027ad:	6a 00                	push   $0x0
+  8027af:	6a 05                	push   $0x5
+  8027b1:	68 60 67 80 00       	push   $0x806760
+  8027b6:	e8 8d eb ff ff       	call   801348 <sysbatch_add>
+  8027bb:	83 c4 20             	add    $0x20,%esp
+  8027be:	85 c0                	test   %eax,%eax
+  8027c0:	0f 88 f3 02 00 00    	js     802ab9 <spawn+0x6e4>
+                            (uint32_t) UTEMP2 + j * PGSIZE, child,
+                            va + i + j * PGSIZE, perm)) < 0)
+        return r;
+      if ((r = sysbatch_add(&batch, SYS_page_unmap, 0,
+  8027c6:	83 ec 04             	sub    $0x4,%esp
+  8027c9:	6a 00                	push   $0x0
+  8027cb:	6a 00                	push   $0x0
+  8027cd:	6a 00                	push   $0x0
+  8027cf:	53                   	push   %ebx
+  8027d0:	6a 00                	push   $0x0
+  8027d2:	6a 06                	push   $0x6
+  8027d4:	68 60 67 80 00       	push   $0x806760
+  8027d9:	e8 6a eb ff ff       	call   801348 <sysbatch_add>
+  8027de:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8027e4:	83 c4 20             	add    $0x20,%esp
+  8027e7:	85 c0                	test   %eax,%eax
+  8027e9:	79 aa                	jns    802795 <spawn+0x3c0>
+  8027eb:	89 c6                	mov    %eax,%esi
+  8027ed:	e9 eb fe ff ff       	jmp    8026dd <spawn+0x308>
+  8027f2:	8b bd 80 fd ff ff    	mov    -0x280(%ebp),%edi
+  8027f8:	e9 8c fe ff ff       	jmp    802689 <spawn+0x2b4>
+  8027fd:	8b b5 68 fd ff ff    	mov    -0x298(%ebp),%esi
+  802803:	8b bd 64 fd ff ff    	mov    -0x29c(%ebp),%edi
+  for (i = 0; i < elf->e_phnum; i++, ph++) {
+  802809:	83 c6 01             	add    $0x1,%esi
+  80280c:	83 c7 20             	add    $0x20,%edi
+  80280f:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  802816:	39 f0                	cmp    %esi,%eax
+  802818:	0f 8e 9b 01 00 00    	jle    8029b9 <spawn+0x5e4>
+    if (ph->p_type != ELF_PROG_LOAD)
+  80281e:	83 3f 01             	cmpl   $0x1,(%edi)
+  802821:	75 e6                	jne    802809 <spawn+0x434>
+    if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  802823:	8b 47 18             	mov    0x18(%edi),%eax
+  802826:	83 e0 02             	and    $0x2,%eax
+    perm = PTE_P | PTE_U;
+  802829:	83 f8 01             	cmp    $0x1,%eax
+  80282c:	19 c0                	sbb    %eax,%eax
+  80282e:	83 e0 fe             	and    $0xfffffffe,%eax
+  802831:	83 c0 07             	add    $0x7,%eax
+  802834:	89 85 94 fd ff ff    	mov    %eax,-0x26c(%ebp)
+    if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  80283a:	8b 57 04             	mov    0x4(%edi),%edx
+  80283d:	89 95 74 fd ff ff    	mov    %edx,-0x28c(%ebp)
+  802843:	8b 5f 10             	mov    0x10(%edi),%ebx
+  802846:	89 9d 8c fd ff ff    	mov    %ebx,-0x274(%ebp)
+  80284c:	8b 47 14             	mov    0x14(%edi),%eax
+  80284f:	89 85 7c fd ff ff    	mov    %eax,-0x284(%ebp)
+  802855:	8b 4f 08             	mov    0x8(%edi),%ecx
+  if ((i = PGOFF(va))) {
+  802858:	89 c8                	mov    %ecx,%eax
+  80285a:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80285f:	74 18                	je     802879 <spawn+0x4a4>
+    va -= i;
+  802861:	29 c1                	sub    %eax,%ecx
+    memsz += i;
+  802863:	01 85 7c fd ff ff    	add    %eax,-0x284(%ebp)
+    filesz += i;
+  802869:	01 c3                	add    %eax,%ebx
+  80286b:	89 9d 8c fd ff ff    	mov    %ebx,-0x274(%ebp)
+    fileoffset -= i;
+  802871:	29 c2                	sub    %eax,%edx
+  802873:	89 95 74 fd ff ff    	mov    %edx,-0x28c(%ebp)
+  for (i = 0; i < memsz; i += n * PGSIZE) {
+  802879:	c7 85 84 fd ff ff 00 	movl   $0x0,-0x27c(%ebp)
+  802880:	00 00 00 
+  802883:	89 8d 70 fd ff ff    	mov    %ecx,-0x290(%ebp)
+  802889:	89 b5 68 fd ff ff    	mov    %esi,-0x298(%ebp)
+  80288f:	89 bd 64 fd ff ff    	mov    %edi,-0x29c(%ebp)
+  802895:	8b 85 84 fd ff ff    	mov    -0x27c(%ebp),%eax
+  80289b:	89 85 78 fd ff ff    	mov    %eax,-0x288(%ebp)
+  8028a1:	8b 8d 7c fd ff ff    	mov    -0x284(%ebp),%ecx
+  8028a7:	39 c8                	cmp    %ecx,%eax
+  8028a9:	0f 83 4e ff ff ff    	jae    8027fd <spawn+0x428>
+    if (i >= filesz) {
+  8028af:	8b 8d 8c fd ff ff    	mov    -0x274(%ebp),%ecx
+  8028b5:	39 8d 84 fd ff ff    	cmp    %ecx,-0x27c(%ebp)
+  8028bb:	0f 83 8a fd ff ff    	jae    80264b <spawn+0x276>
+    n = MIN(SEGCHUNK, ROUNDUP(filesz - i, PGSIZE) / PGSIZE);
+  8028c1:	8b b5 8c fd ff ff    	mov    -0x274(%ebp),%esi
+  8028c7:	8b 85 78 fd ff ff    	mov    -0x288(%ebp),%eax
+  8028cd:	29 c6                	sub    %eax,%esi
+  8028cf:	8d 86 ff 0f 00 00    	lea    0xfff(%esi),%eax
+  8028d5:	c1 e8 0c             	shr    $0xc,%eax
+  8028d8:	ba 10 00 00 00       	mov    $0x10,%edx
+  8028dd:	39 d0                	cmp    %edx,%eax
+  8028df:	0f 47 c2             	cmova  %edx,%eax
+  8028e2:	89 c7                	mov    %eax,%edi
+  if ((perm & PTE_W) || PGOFF(fileoffset))
+  8028e4:	8b 9d 94 fd ff ff    	mov    -0x26c(%ebp),%ebx
+  8028ea:	83 e3 02             	and    $0x2,%ebx
+  8028ed:	8b 95 74 fd ff ff    	mov    -0x28c(%ebp),%edx
+  8028f3:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8028f9:	09 d3                	or     %edx,%ebx
+  8028fb:	0f 85 98 fd ff ff    	jne    802699 <spawn+0x2c4>
+    n = MIN(n, (filesz - i) / PGSIZE);
+  802901:	89 f2                	mov    %esi,%edx
+  802903:	c1 ea 0c             	shr    $0xc,%edx
+  802906:	39 c2                	cmp    %eax,%edx
+  802908:	0f 47 d0             	cmova  %eax,%edx
+  80290b:	8b 8d 7c fd ff ff    	mov    -0x284(%ebp),%ecx
+  802911:	39 8d 8c fd ff ff    	cmp    %ecx,-0x274(%ebp)
+  802917:	0f 43 d0             	cmovae %eax,%edx
+    if ((m = shared_pages(perm, memsz, filesz, fileoffset, i, n)) > 0) {
+  80291a:	89 95 60 fd ff ff    	mov    %edx,-0x2a0(%ebp)
+  802920:	85 d2                	test   %edx,%edx
+  802922:	0f 8e 86 fd ff ff    	jle    8026ae <spawn+0x2d9>
+      if ((r = sysbatch_flush(&batch)) < 0)
+  802928:	83 ec 0c             	sub    $0xc,%esp
+  80292b:	68 60 67 80 00       	push   $0x806760
+  802930:	e8 c3 e9 ff ff       	call   8012f8 <sysbatch_flush>
+  802935:	83 c4 10             	add    $0x10,%esp
+  802938:	85 c0                	test   %eax,%eax
+  80293a:	0f 88 56 01 00 00    	js     802a96 <spawn+0x6c1>
+  802940:	8b 85 60 fd ff ff    	mov    -0x2a0(%ebp),%eax
+  802946:	c1 e0 0c             	shl    $0xc,%eax
+  802949:	89 f1                	mov    %esi,%ecx
+  80294b:	29 c1                	sub    %eax,%ecx
+  80294d:	89 8d 80 fd ff ff    	mov    %ecx,-0x280(%ebp)
+  802953:	89 f3                	mov    %esi,%ebx
+        if ((r = read_map(fd, fileoffset + i + j * PGSIZE,
+  802955:	8d be 00 10 40 00    	lea    0x401000(%esi),%edi
+  80295b:	8b 8d 74 fd ff ff    	mov    -0x28c(%ebp),%ecx
+  802961:	8b 85 8c fd ff ff    	mov    -0x274(%ebp),%eax
+  802967:	8d 34 01             	lea    (%ecx,%eax,1),%esi
+      for (j = 0; j < n; j++) {
+  80296a:	8b 85 80 fd ff ff    	mov    -0x280(%ebp),%eax
+  802970:	39 c3                	cmp    %eax,%ebx
+  802972:	0f 84 28 fd ff ff    	je     8026a0 <spawn+0x2cb>
+        if ((r = read_map(fd, fileoffset + i + j * PGSIZE,
+  802978:	83 ec 04             	sub    $0x4,%esp
+  80297b:	89 f8                	mov    %edi,%eax
+  80297d:	29 d8                	sub    %ebx,%eax
+  80297f:	50                   	push   %eax
+  802980:	89 f0                	mov    %esi,%eax
+  802982:	29 d8                	sub    %ebx,%eax
+  802984:	50                   	push   %eax
+  802985:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  80298b:	e8 00 f8 ff ff       	call   802190 <read_map>
+  802990:	83 c4 10             	add    $0x10,%esp
+  802993:	85 c0                	test   %eax,%eax
+  802995:	0f 88 02 01 00 00    	js     802a9d <spawn+0x6c8>
+        if (r < MIN(PGSIZE, filesz - i - j * PGSIZE))
+  80299b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8029a0:	39 d3                	cmp    %edx,%ebx
+  8029a2:	0f 46 d3             	cmovbe %ebx,%edx
+  8029a5:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  8029ab:	39 d0                	cmp    %edx,%eax
+  8029ad:	73 bb                	jae    80296a <spawn+0x595>
+          return -E_INVAL;
+  8029af:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+  8029b4:	e9 24 fd ff ff       	jmp    8026dd <spawn+0x308>
+  close(fd);
+  8029b9:	83 ec 0c             	sub    $0xc,%esp
+  8029bc:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  8029c2:	e8 7a eb ff ff       	call   801541 <close>
+// Copy the mappings for shared pages into the child address space.
+static int
+copy_shared_pages(envid_t child)
+{
+  // LAB 5: Your code here.
+  return sysbatch_add(&batch, SYS_page_map_range, 0, 0, UTOP,
+  8029c7:	83 c4 0c             	add    $0xc,%esp
+  8029ca:	6a 02                	push   $0x2
+  8029cc:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  8029d2:	68 00 00 c0 ee       	push   $0xeec00000
+  8029d7:	6a 00                	push   $0x0
+  8029d9:	6a 00                	push   $0x0
+  8029db:	6a 11                	push   $0x11
+  8029dd:	68 60 67 80 00       	push   $0x806760
+  8029e2:	e8 61 e9 ff ff       	call   801348 <sysbatch_add>
+  if ((r = copy_shared_pages(child)) < 0)
+  8029e7:	83 c4 20             	add    $0x20,%esp
+  8029ea:	85 c0                	test   %eax,%eax
+  8029ec:	78 72                	js     802a60 <spawn+0x68b>
+  if ((r = sysbatch_add(&batch, SYS_env_set_trapframe, child,
+  8029ee:	83 ec 04             	sub    $0x4,%esp
+  8029f1:	6a 00                	push   $0x0
+  8029f3:	6a 00                	push   $0x0
+  8029f5:	6a 00                	push   $0x0
+  8029f7:	8d 85 a4 fd ff ff    	lea    -0x25c(%ebp),%eax
+  8029fd:	50                   	push   %eax
+  8029fe:	8b bd 90 fd ff ff    	mov    -0x270(%ebp),%edi
+  802a04:	57                   	push   %edi
+  802a05:	6a 09                	push   $0x9
+  802a07:	68 60 67 80 00       	push   $0x806760
+  802a0c:	e8 37 e9 ff ff       	call   801348 <sysbatch_add>
+  802a11:	83 c4 20             	add    $0x20,%esp
+  802a14:	85 c0                	test   %eax,%eax
+  802a16:	78 33                	js     802a4b <spawn+0x676>
+      (r = sysbatch_add(&batch, SYS_env_set_status, child,
+  802a18:	83 ec 04             	sub    $0x4,%esp
+  802a1b:	6a 00                	push   $0x0
+  802a1d:	6a 00                	push   $0x0
+  802a1f:	6a 00                	push   $0x0
+  802a21:	6a 02                	push   $0x2
+  802a23:	57                   	push   %edi
+  802a24:	6a 08                	push   $0x8
+  802a26:	68 60 67 80 00       	push   $0x806760
+  802a2b:	e8 18 e9 ff ff       	call   801348 <sysbatch_add>
+                        (uint32_t) &child_tf, 0, 0, 0)) < 0 ||
+  802a30:	83 c4 20             	add    $0x20,%esp
+  802a33:	85 c0                	test   %eax,%eax
+  802a35:	78 14                	js     802a4b <spawn+0x676>
+      (r = sysbatch_flush(&batch)) < 0)
+  802a37:	83 ec 0c             	sub    $0xc,%esp
+  802a3a:	68 60 67 80 00       	push   $0x806760
+  802a3f:	e8 b4 e8 ff ff       	call   8012f8 <sysbatch_flush>
+                        ENV_RUNNABLE, 0, 0, 0)) < 0 ||
+  802a44:	83 c4 10             	add    $0x10,%esp
+  802a47:	85 c0                	test   %eax,%eax
+  802a49:	79 36                	jns    802a81 <spawn+0x6ac>
+    panic("spawn: starting child: %e", r);
+  802a4b:	50                   	push   %eax
+  802a4c:	68 04 3e 80 00       	push   $0x803e04
+  802a51:	68 93 00 00 00       	push   $0x93
+  802a56:	68 e2 3d 80 00       	push   $0x803de2
+  802a5b:	e8 9d d9 ff ff       	call   8003fd <_panic>
+    panic("copy_shared_pages: %e", r);
+  802a60:	50                   	push   %eax
+  802a61:	68 ee 3d 80 00       	push   $0x803dee
+  802a66:	68 8c 00 00 00       	push   $0x8c
+  802a6b:	68 e2 3d 80 00       	push   $0x803de2
+  802a70:	e8 88 d9 ff ff       	call   8003fd <_panic>
+    return r;
+  802a75:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  802a7b:	89 85 6c fd ff ff    	mov    %eax,-0x294(%ebp)
+}
+  802a81:	8b 85 6c fd ff ff    	mov    -0x294(%ebp),%eax
+  802a87:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a8a:	5b                   	pop    %ebx
+  802a8b:	5e                   	pop    %esi
+  802a8c:	5f                   	pop    %edi
+  802a8d:	5d                   	pop    %ebp
+  802a8e:	c3                   	ret
+  802a8f:	89 c6                	mov    %eax,%esi
+  802a91:	e9 47 fc ff ff       	jmp    8026dd <spawn+0x308>
+  802a96:	89 c6                	mov    %eax,%esi
+  802a98:	e9 40 fc ff ff       	jmp    8026dd <spawn+0x308>
+  802a9d:	89 c6                	mov    %eax,%esi
+  802a9f:	e9 39 fc ff ff       	jmp    8026dd <spawn+0x308>
+  802aa4:	89 c6                	mov    %eax,%esi
+  802aa6:	e9 32 fc ff ff       	jmp    8026dd <spawn+0x308>
+  802aab:	89 c6                	mov    %eax,%esi
+  802aad:	e9 2b fc ff ff       	jmp    8026dd <spawn+0x308>
+  802ab2:	89 c6                	mov    %eax,%esi
+  802ab4:	e9 24 fc ff ff       	jmp    8026dd <spawn+0x308>
+  802ab9:	89 c6                	mov    %eax,%esi
+  802abb:	e9 1d fc ff ff       	jmp    8026dd <spawn+0x308>
+    return -E_NO_MEM;
+  802ac0:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  return r;
+  802ac5:	89 85 6c fd ff ff    	mov    %eax,-0x294(%ebp)
+  802acb:	eb b4                	jmp    802a81 <spawn+0x6ac>
+  sys_page_unmap(0, UTEMP);
+  802acd:	83 ec 08             	sub    $0x8,%esp
+  802ad0:	68 00 00 40 00       	push   $0x400000
+  802ad5:	6a 00                	push   $0x0
+  802ad7:	e8 9e e4 ff ff       	call   800f7a <sys_page_unmap>
+  802adc:	83 c4 10             	add    $0x10,%esp
+  802adf:	89 9d 6c fd ff ff    	mov    %ebx,-0x294(%ebp)
+  802ae5:	eb 9a                	jmp    802a81 <spawn+0x6ac>
+
+00802ae7 <spawnl>:
+{
+  802ae7:	55                   	push   %ebp
+  802ae8:	89 e5                	mov    %esp,%ebp
+  802aea:	56                   	push   %esi
+  802aeb:	53                   	push   %ebx
+  va_start(vl, arg0);
+  802aec:	8d 45 10             	lea    0x10(%ebp),%eax
+  int argc = 0;
+  802aef:	be 00 00 00 00       	mov    $0x0,%esi
+  while (va_arg(vl, void *) != NULL) {
+  802af4:	eb 17                	jmp    802b0d <spawnl+0x26>
+      cprintf("vl: %p saying %s\n", vl, vl);
+  802af6:	83 ec 04             	sub    $0x4,%esp
+  802af9:	53                   	push   %ebx
+  802afa:	53                   	push   %ebx
+  802afb:	68 1e 3e 80 00       	push   $0x803e1e
+  802b00:	e8 d3 d9 ff ff       	call   8004d8 <cprintf>
+    argc++;
+  802b05:	83 c6 01             	add    $0x1,%esi
+  802b08:	83 c4 10             	add    $0x10,%esp
+  while (va_arg(vl, void *) != NULL) {
+  802b0b:	89 d8                	mov    %ebx,%eax
+  802b0d:	8d 58 04             	lea    0x4(%eax),%ebx
+  802b10:	83 38 00             	cmpl   $0x0,(%eax)
+  802b13:	75 e1                	jne    802af6 <spawnl+0xf>
+  cprintf("argc found %d\n", argc);
+  802b15:	83 ec 08             	sub    $0x8,%esp
+  802b18:	56                   	push   %esi
+  802b19:	68 30 3e 80 00       	push   $0x803e30
+  802b1e:	e8 b5 d9 ff ff       	call   8004d8 <cprintf>
+  const char *argv[argc+2];
+  802b23:	8d 04 b5 17 00 00 00 	lea    0x17(,%esi,4),%eax
+  802b2a:	83 e0 f0             	and    $0xfffffff0,%eax
+  802b2d:	83 c4 10             	add    $0x10,%esp
+  802b30:	29 c4                	sub    %eax,%esp
+  802b32:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  802b36:	89 d8                	mov    %ebx,%eax
+  802b38:	c1 e8 02             	shr    $0x2,%eax
+  802b3b:	83 e3 fc             	and    $0xfffffffc,%ebx
+  argv[0] = arg0;
+  802b3e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802b41:	89 14 85 00 00 00 00 	mov    %edx,0x0(,%eax,4)
+  argv[argc+1] = NULL;
+  802b48:	c7 44 b3 04 00 00 00 	movl   $0x0,0x4(%ebx,%esi,4)
+  802b4f:	00 
+  va_start(vl, arg0);
+  802b50:	8d 55 10             	lea    0x10(%ebp),%edx
+  for (i = 0; i < argc; i++)
+  802b53:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b58:	eb 0b                	jmp    802b65 <spawnl+0x7e>
+    argv[i+1] = va_arg(vl, const char *);
+  802b5a:	83 c0 01             	add    $0x1,%eax
+  802b5d:	8b 0a                	mov    (%edx),%ecx
+  802b5f:	89 0c 83             	mov    %ecx,(%ebx,%eax,4)
+  802b62:	8d 52 04             	lea    0x4(%edx),%edx
+  for (i = 0; i < argc; i++)
+  802b65:	39 f0                	cmp    %esi,%eax
+  802b67:	75 f1                	jne    802b5a <spawnl+0x73>
+  return spawn(prog, argv);
+  802b69:	83 ec 08             	sub    $0x8,%esp
+  802b6c:	53                   	push   %ebx
+  802b6d:	ff 75 08             	push   0x8(%ebp)
+  802b70:	e8 60 f8 ff ff       	call   8023d5 <spawn>
+}
+  802b75:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b78:	5b                   	pop    %ebx
+  802b79:	5e                   	pop    %esi
+  802b7a:	5d                   	pop    %ebp
+  802b7b:	c3                   	ret
+
+00802b7c <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  802b7c:	55                   	push   %ebp
+  802b7d:	89 e5                	mov    %esp,%ebp
+  802b7f:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  802b82:	50                   	push   %eax
+  802b83:	e8 2c e8 ff ff       	call   8013b4 <fd2data>
+  802b88:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  802b8d:	c9                   	leave
+  802b8e:	c3                   	ret
+
+00802b8f <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802b8f:	55                   	push   %ebp
+  802b90:	89 e5                	mov    %esp,%ebp
+  802b92:	56                   	push   %esi
+  802b93:	53                   	push   %ebx
+  802b94:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  802b97:	83 ec 0c             	sub    $0xc,%esp
+  802b9a:	ff 75 08             	push   0x8(%ebp)
+  802b9d:	e8 12 e8 ff ff       	call   8013b4 <fd2data>
+  802ba2:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  802ba4:	83 c4 08             	add    $0x8,%esp
+  802ba7:	68 66 3e 80 00       	push   $0x803e66
+  802bac:	53                   	push   %ebx
+  802bad:	e8 14 df ff ff       	call   800ac6 <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  802bb2:	8b 46 04             	mov    0x4(%esi),%eax
+  802bb5:	2b 06                	sub    (%esi),%eax
+  802bb7:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  802bbd:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802bc4:	00 00 00 
+  stat->st_dev = &devpipe;
+  802bc7:	c7 83 88 00 00 00 ac 	movl   $0x8057ac,0x88(%ebx)
+  802bce:	57 80 00 
+  return 0;
+}
+  802bd1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bd6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802bd9:	5b                   	pop    %ebx
+  802bda:	5e                   	pop    %esi
+  802bdb:	5d                   	pop    %ebp
+  802bdc:	c3                   	ret
+
+00802bdd <pipe_wakeup>:
+{
+  802bdd:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  802bdf:	b8 00 00 00 00       	mov    $0x0,%eax
+  802be4:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  802be7:	85 c0                	test   %eax,%eax
+  802be9:	75 01                	jne    802bec <pipe_wakeup+0xf>
+  802beb:	c3                   	ret
+{
+  802bec:	55                   	push   %ebp
+  802bed:	89 e5                	mov    %esp,%ebp
+  802bef:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  802bf2:	6a 00                	push   $0x0
+  802bf4:	68 00 00 c0 ee       	push   $0xeec00000
+  802bf9:	52                   	push   %edx
+  802bfa:	e8 52 e6 ff ff       	call   801251 <sys_chan_wakeup>
+  802bff:	83 c4 10             	add    $0x10,%esp
+}
+  802c02:	c9                   	leave
+  802c03:	c3                   	ret
+
+00802c04 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802c04:	55                   	push   %ebp
+  802c05:	89 e5                	mov    %esp,%ebp
+  802c07:	57                   	push   %edi
+  802c08:	56                   	push   %esi
+  802c09:	53                   	push   %ebx
+  802c0a:	83 ec 18             	sub    $0x18,%esp
+  802c0d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  802c10:	57                   	push   %edi
+  802c11:	e8 9e e7 ff ff       	call   8013b4 <fd2data>
+  802c16:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  802c18:	83 c4 10             	add    $0x10,%esp
+  802c1b:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  802c1f:	74 2a                	je     802c4b <devpipe_close+0x47>
+  802c21:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  802c26:	89 f8                	mov    %edi,%eax
+  802c28:	e8 4f ff ff ff       	call   802b7c <pipe_ring>
+  802c2d:	83 ec 08             	sub    $0x8,%esp
+  802c30:	01 d8                	add    %ebx,%eax
+  802c32:	50                   	push   %eax
+  802c33:	6a 00                	push   $0x0
+  802c35:	e8 40 e3 ff ff       	call   800f7a <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  802c3a:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802c40:	83 c4 10             	add    $0x10,%esp
+  802c43:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  802c49:	75 db                	jne    802c26 <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  802c4b:	83 ec 08             	sub    $0x8,%esp
+  802c4e:	57                   	push   %edi
+  802c4f:	6a 00                	push   $0x0
+  802c51:	e8 24 e3 ff ff       	call   800f7a <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  802c56:	83 c4 10             	add    $0x10,%esp
+  802c59:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  802c5d:	75 13                	jne    802c72 <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  802c5f:	83 ec 08             	sub    $0x8,%esp
+  802c62:	56                   	push   %esi
+  802c63:	6a 00                	push   $0x0
+  802c65:	e8 10 e3 ff ff       	call   800f7a <sys_page_unmap>
+}
+  802c6a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c6d:	5b                   	pop    %ebx
+  802c6e:	5e                   	pop    %esi
+  802c6f:	5f                   	pop    %edi
+  802c70:	5d                   	pop    %ebp
+  802c71:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802c72:	8d 56 04             	lea    0x4(%esi),%edx
+  802c75:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802c78:	e8 60 ff ff ff       	call   802bdd <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802c7d:	8d 46 30             	lea    0x30(%esi),%eax
+  802c80:	89 f2                	mov    %esi,%edx
+  802c82:	e8 56 ff ff ff       	call   802bdd <pipe_wakeup>
+  802c87:	eb d6                	jmp    802c5f <devpipe_close+0x5b>
+
+00802c89 <_pipeisclosed>:
+{
+  802c89:	55                   	push   %ebp
+  802c8a:	89 e5                	mov    %esp,%ebp
+  802c8c:	57                   	push   %edi
+  802c8d:	56                   	push   %esi
+  802c8e:	53                   	push   %ebx
+  802c8f:	83 ec 1c             	sub    $0x1c,%esp
+  802c92:	89 c7                	mov    %eax,%edi
+  802c94:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  802c96:	a1 f0 85 80 00       	mov    0x8085f0,%eax
+  802c9b:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  802c9e:	83 ec 0c             	sub    $0xc,%esp
+  802ca1:	57                   	push   %edi
+  802ca2:	e8 f5 08 00 00       	call   80359c <pageref>
+  802ca7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802caa:	89 34 24             	mov    %esi,(%esp)
+  802cad:	e8 ea 08 00 00       	call   80359c <pageref>
+    nn = thisenv->env_runs;
+  802cb2:	8b 15 f0 85 80 00    	mov    0x8085f0,%edx
+  802cb8:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  802cbb:	83 c4 10             	add    $0x10,%esp
+  802cbe:	39 cb                	cmp    %ecx,%ebx
+  802cc0:	74 1b                	je     802cdd <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  802cc2:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802cc5:	75 cf                	jne    802c96 <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802cc7:	8b 42 58             	mov    0x58(%edx),%eax
+  802cca:	6a 01                	push   $0x1
+  802ccc:	50                   	push   %eax
+  802ccd:	53                   	push   %ebx
+  802cce:	68 6d 3e 80 00       	push   $0x803e6d
+  802cd3:	e8 00 d8 ff ff       	call   8004d8 <cprintf>
+  802cd8:	83 c4 10             	add    $0x10,%esp
+  802cdb:	eb b9                	jmp    802c96 <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  802cdd:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802ce0:	0f 94 c0             	sete   %al
+  802ce3:	0f b6 c0             	movzbl %al,%eax
+}
+  802ce6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ce9:	5b                   	pop    %ebx
+  802cea:	5e                   	pop    %esi
+  802ceb:	5f                   	pop    %edi
+  802cec:	5d                   	pop    %ebp
+  802ced:	c3                   	ret
+
+00802cee <devpipe_write_bulk>:
+{
+  802cee:	55                   	push   %ebp
+  802cef:	89 e5                	mov    %esp,%ebp
+  802cf1:	57                   	push   %edi
+  802cf2:	56                   	push   %esi
+  802cf3:	53                   	push   %ebx
+  802cf4:	83 ec 1c             	sub    $0x1c,%esp
+  802cf7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802cfa:	89 d6                	mov    %edx,%esi
+  802cfc:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  802cff:	e8 78 fe ff ff       	call   802b7c <pipe_ring>
+  802d04:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  802d07:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802d0c:	8d 46 04             	lea    0x4(%esi),%eax
+  802d0f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  802d12:	eb 75                	jmp    802d89 <devpipe_write_bulk+0x9b>
+  802d14:	b8 01 00 00 00       	mov    $0x1,%eax
+  802d19:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802d1d:	6a 64                	push   $0x64
+  802d1f:	68 00 00 c0 ee       	push   $0xeec00000
+  802d24:	53                   	push   %ebx
+  802d25:	56                   	push   %esi
+  802d26:	e8 03 e5 ff ff       	call   80122e <sys_chan_sleep>
+      continue;
+  802d2b:	83 c4 10             	add    $0x10,%esp
+  802d2e:	eb 59                	jmp    802d89 <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  802d30:	89 d1                	mov    %edx,%ecx
+  802d32:	c1 f9 1f             	sar    $0x1f,%ecx
+  802d35:	c1 e9 11             	shr    $0x11,%ecx
+  802d38:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802d3b:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802d40:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  802d42:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  802d48:	29 d3                	sub    %edx,%ebx
+  802d4a:	ba 00 80 00 00       	mov    $0x8000,%edx
+  802d4f:	29 c2                	sub    %eax,%edx
+  802d51:	39 d3                	cmp    %edx,%ebx
+  802d53:	0f 47 da             	cmova  %edx,%ebx
+  802d56:	8b 55 08             	mov    0x8(%ebp),%edx
+  802d59:	29 fa                	sub    %edi,%edx
+  802d5b:	39 d3                	cmp    %edx,%ebx
+  802d5d:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  802d60:	83 ec 04             	sub    $0x4,%esp
+  802d63:	53                   	push   %ebx
+  802d64:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802d67:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  802d6a:	52                   	push   %edx
+  802d6b:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802d6e:	01 c8                	add    %ecx,%eax
+  802d70:	50                   	push   %eax
+  802d71:	e8 38 df ff ff       	call   800cae <memcpy>
+    i += m;
+  802d76:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  802d78:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802d7b:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802d7e:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802d81:	e8 57 fe ff ff       	call   802bdd <pipe_wakeup>
+  802d86:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802d89:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802d8c:	73 2b                	jae    802db9 <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  802d8e:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  802d90:	8b 56 04             	mov    0x4(%esi),%edx
+  802d93:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  802d99:	39 d0                	cmp    %edx,%eax
+  802d9b:	7d 93                	jge    802d30 <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  802d9d:	89 f2                	mov    %esi,%edx
+  802d9f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802da2:	e8 e2 fe ff ff       	call   802c89 <_pipeisclosed>
+  802da7:	85 c0                	test   %eax,%eax
+  802da9:	0f 84 65 ff ff ff    	je     802d14 <devpipe_write_bulk+0x26>
+        return i;
+  802daf:	89 f8                	mov    %edi,%eax
+}
+  802db1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802db4:	5b                   	pop    %ebx
+  802db5:	5e                   	pop    %esi
+  802db6:	5f                   	pop    %edi
+  802db7:	5d                   	pop    %ebp
+  802db8:	c3                   	ret
+  return i;
+  802db9:	89 f8                	mov    %edi,%eax
+  802dbb:	eb f4                	jmp    802db1 <devpipe_write_bulk+0xc3>
+
+00802dbd <devpipe_write>:
+{
+  802dbd:	55                   	push   %ebp
+  802dbe:	89 e5                	mov    %esp,%ebp
+  802dc0:	57                   	push   %edi
+  802dc1:	56                   	push   %esi
+  802dc2:	53                   	push   %ebx
+  802dc3:	83 ec 28             	sub    $0x28,%esp
+  802dc6:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  802dc9:	56                   	push   %esi
+  802dca:	e8 e5 e5 ff ff       	call   8013b4 <fd2data>
+  802dcf:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  802dd1:	8b 78 28             	mov    0x28(%eax),%edi
+  802dd4:	83 c4 10             	add    $0x10,%esp
+  802dd7:	85 ff                	test   %edi,%edi
+  802dd9:	75 25                	jne    802e00 <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  802ddb:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802dde:	74 66                	je     802e46 <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802de0:	8b 43 04             	mov    0x4(%ebx),%eax
+  802de3:	8b 0b                	mov    (%ebx),%ecx
+  802de5:	8d 51 20             	lea    0x20(%ecx),%edx
+  802de8:	39 d0                	cmp    %edx,%eax
+  802dea:	72 2b                	jb     802e17 <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  802dec:	89 da                	mov    %ebx,%edx
+  802dee:	89 f0                	mov    %esi,%eax
+  802df0:	e8 94 fe ff ff       	call   802c89 <_pipeisclosed>
+  802df5:	85 c0                	test   %eax,%eax
+  802df7:	75 51                	jne    802e4a <devpipe_write+0x8d>
+      sys_yield();
+  802df9:	e8 95 e0 ff ff       	call   800e93 <sys_yield>
+  802dfe:	eb e0                	jmp    802de0 <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  802e00:	83 ec 0c             	sub    $0xc,%esp
+  802e03:	ff 75 10             	push   0x10(%ebp)
+  802e06:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802e09:	89 c2                	mov    %eax,%edx
+  802e0b:	89 f0                	mov    %esi,%eax
+  802e0d:	e8 dc fe ff ff       	call   802cee <devpipe_write_bulk>
+  802e12:	83 c4 10             	add    $0x10,%esp
+  802e15:	eb 38                	jmp    802e4f <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802e17:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802e1a:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802e1e:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802e21:	89 c2                	mov    %eax,%edx
+  802e23:	c1 fa 1f             	sar    $0x1f,%edx
+  802e26:	89 d1                	mov    %edx,%ecx
+  802e28:	c1 e9 1b             	shr    $0x1b,%ecx
+  802e2b:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802e2e:	83 e2 1f             	and    $0x1f,%edx
+  802e31:	29 ca                	sub    %ecx,%edx
+  802e33:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802e37:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  802e3b:	83 c0 01             	add    $0x1,%eax
+  802e3e:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  802e41:	83 c7 01             	add    $0x1,%edi
+  802e44:	eb 95                	jmp    802ddb <devpipe_write+0x1e>
+  return i;
+  802e46:	89 f8                	mov    %edi,%eax
+  802e48:	eb 05                	jmp    802e4f <devpipe_write+0x92>
+        return 0;
+  802e4a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e4f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e52:	5b                   	pop    %ebx
+  802e53:	5e                   	pop    %esi
+  802e54:	5f                   	pop    %edi
+  802e55:	5d                   	pop    %ebp
+  802e56:	c3                   	ret
+
+00802e57 <devpipe_read_bulk>:
+{
+  802e57:	55                   	push   %ebp
+  802e58:	89 e5                	mov    %esp,%ebp
+  802e5a:	57                   	push   %edi
+  802e5b:	56                   	push   %esi
+  802e5c:	53                   	push   %ebx
+  802e5d:	83 ec 2c             	sub    $0x2c,%esp
+  802e60:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802e63:	89 d6                	mov    %edx,%esi
+  802e65:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802e68:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  802e6b:	e8 0c fd ff ff       	call   802b7c <pipe_ring>
+  802e70:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  802e73:	85 db                	test   %ebx,%ebx
+  802e75:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802e7a:	0f 45 c3             	cmovne %ebx,%eax
+  802e7d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802e80:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802e85:	8d 46 30             	lea    0x30(%esi),%eax
+  802e88:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  802e8b:	eb 50                	jmp    802edd <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  802e8d:	89 d1                	mov    %edx,%ecx
+  802e8f:	c1 f9 1f             	sar    $0x1f,%ecx
+  802e92:	c1 e9 11             	shr    $0x11,%ecx
+  802e95:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802e98:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802e9d:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  802e9f:	29 d3                	sub    %edx,%ebx
+  802ea1:	ba 00 80 00 00       	mov    $0x8000,%edx
+  802ea6:	29 c2                	sub    %eax,%edx
+  802ea8:	39 d3                	cmp    %edx,%ebx
+  802eaa:	0f 47 da             	cmova  %edx,%ebx
+  802ead:	8b 55 08             	mov    0x8(%ebp),%edx
+  802eb0:	29 fa                	sub    %edi,%edx
+  802eb2:	39 d3                	cmp    %edx,%ebx
+  802eb4:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  802eb7:	83 ec 04             	sub    $0x4,%esp
+  802eba:	53                   	push   %ebx
+  802ebb:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802ebe:	01 c8                	add    %ecx,%eax
+  802ec0:	50                   	push   %eax
+  802ec1:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802ec4:	01 f8                	add    %edi,%eax
+  802ec6:	50                   	push   %eax
+  802ec7:	e8 e2 dd ff ff       	call   800cae <memcpy>
+    i += m;
+  802ecc:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  802ece:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802ed0:	89 f2                	mov    %esi,%edx
+  802ed2:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802ed5:	e8 03 fd ff ff       	call   802bdd <pipe_wakeup>
+  802eda:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802edd:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802ee0:	73 51                	jae    802f33 <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  802ee2:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  802ee5:	8b 16                	mov    (%esi),%edx
+  802ee7:	39 da                	cmp    %ebx,%edx
+  802ee9:	75 a2                	jne    802e8d <devpipe_read_bulk+0x36>
+      if (i > 0)
+  802eeb:	85 ff                	test   %edi,%edi
+  802eed:	75 44                	jne    802f33 <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  802eef:	89 f2                	mov    %esi,%edx
+  802ef1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802ef4:	e8 90 fd ff ff       	call   802c89 <_pipeisclosed>
+  802ef9:	85 c0                	test   %eax,%eax
+  802efb:	75 3a                	jne    802f37 <devpipe_read_bulk+0xe0>
+  802efd:	b8 01 00 00 00       	mov    $0x1,%eax
+  802f02:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802f06:	6a 64                	push   $0x64
+  802f08:	ff 75 d4             	push   -0x2c(%ebp)
+  802f0b:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  802f0c:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802f0f:	50                   	push   %eax
+  802f10:	e8 19 e3 ff ff       	call   80122e <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  802f15:	85 c0                	test   %eax,%eax
+  802f17:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f1c:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  802f1f:	83 c4 10             	add    $0x10,%esp
+  802f22:	a8 01                	test   $0x1,%al
+  802f24:	74 b7                	je     802edd <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  802f26:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  802f2b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f2e:	5b                   	pop    %ebx
+  802f2f:	5e                   	pop    %esi
+  802f30:	5f                   	pop    %edi
+  802f31:	5d                   	pop    %ebp
+  802f32:	c3                   	ret
+  return i;
+  802f33:	89 f8                	mov    %edi,%eax
+  802f35:	eb f4                	jmp    802f2b <devpipe_read_bulk+0xd4>
+        return 0;
+  802f37:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f3c:	eb ed                	jmp    802f2b <devpipe_read_bulk+0xd4>
+
+00802f3e <devpipe_read>:
+{
+  802f3e:	55                   	push   %ebp
+  802f3f:	89 e5                	mov    %esp,%ebp
+  802f41:	57                   	push   %edi
+  802f42:	56                   	push   %esi
+  802f43:	53                   	push   %ebx
+  802f44:	83 ec 18             	sub    $0x18,%esp
+  802f47:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  802f4a:	57                   	push   %edi
+  802f4b:	e8 64 e4 ff ff       	call   8013b4 <fd2data>
+  802f50:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  802f52:	8b 70 28             	mov    0x28(%eax),%esi
+  802f55:	83 c4 10             	add    $0x10,%esp
+  802f58:	85 f6                	test   %esi,%esi
+  802f5a:	75 24                	jne    802f80 <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  802f5c:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802f5f:	74 60                	je     802fc1 <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  802f61:	8b 03                	mov    (%ebx),%eax
+  802f63:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802f66:	75 3b                	jne    802fa3 <devpipe_read+0x65>
+      if (i > 0)
+  802f68:	85 f6                	test   %esi,%esi
+  802f6a:	75 2d                	jne    802f99 <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  802f6c:	89 da                	mov    %ebx,%edx
+  802f6e:	89 f8                	mov    %edi,%eax
+  802f70:	e8 14 fd ff ff       	call   802c89 <_pipeisclosed>
+  802f75:	85 c0                	test   %eax,%eax
+  802f77:	75 4c                	jne    802fc5 <devpipe_read+0x87>
+      sys_yield();
+  802f79:	e8 15 df ff ff       	call   800e93 <sys_yield>
+  802f7e:	eb e1                	jmp    802f61 <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  802f80:	83 ec 08             	sub    $0x8,%esp
+  802f83:	6a 00                	push   $0x0
+  802f85:	ff 75 10             	push   0x10(%ebp)
+  802f88:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802f8b:	89 c2                	mov    %eax,%edx
+  802f8d:	89 f8                	mov    %edi,%eax
+  802f8f:	e8 c3 fe ff ff       	call   802e57 <devpipe_read_bulk>
+  802f94:	83 c4 10             	add    $0x10,%esp
+  802f97:	eb 02                	jmp    802f9b <devpipe_read+0x5d>
+        return i;
+  802f99:	89 f0                	mov    %esi,%eax
+}
+  802f9b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f9e:	5b                   	pop    %ebx
+  802f9f:	5e                   	pop    %esi
+  802fa0:	5f                   	pop    %edi
+  802fa1:	5d                   	pop    %ebp
+  802fa2:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802fa3:	99                   	cltd
+  802fa4:	c1 ea 1b             	shr    $0x1b,%edx
+  802fa7:	01 d0                	add    %edx,%eax
+  802fa9:	83 e0 1f             	and    $0x1f,%eax
+  802fac:	29 d0                	sub    %edx,%eax
+  802fae:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802fb3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802fb6:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  802fb9:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  802fbc:	83 c6 01             	add    $0x1,%esi
+  802fbf:	eb 9b                	jmp    802f5c <devpipe_read+0x1e>
+  return i;
+  802fc1:	89 f0                	mov    %esi,%eax
+  802fc3:	eb d6                	jmp    802f9b <devpipe_read+0x5d>
+        return 0;
+  802fc5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fca:	eb cf                	jmp    802f9b <devpipe_read+0x5d>
+
+00802fcc <pipe2>:
+{
+  802fcc:	55                   	push   %ebp
+  802fcd:	89 e5                	mov    %esp,%ebp
+  802fcf:	57                   	push   %edi
+  802fd0:	56                   	push   %esi
+  802fd1:	53                   	push   %ebx
+  802fd2:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  802fd5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802fd8:	50                   	push   %eax
+  802fd9:	e8 ea e3 ff ff       	call   8013c8 <fd_alloc>
+  802fde:	89 c3                	mov    %eax,%ebx
+  802fe0:	83 c4 10             	add    $0x10,%esp
+  802fe3:	85 c0                	test   %eax,%eax
+  802fe5:	0f 88 fb 01 00 00    	js     8031e6 <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802feb:	83 ec 04             	sub    $0x4,%esp
+  802fee:	68 07 04 00 00       	push   $0x407
+  802ff3:	ff 75 e4             	push   -0x1c(%ebp)
+  802ff6:	6a 00                	push   $0x0
+  802ff8:	e8 f8 de ff ff       	call   800ef5 <sys_page_alloc>
+  802ffd:	89 c3                	mov    %eax,%ebx
+  802fff:	83 c4 10             	add    $0x10,%esp
+  803002:	85 c0                	test   %eax,%eax
+  803004:	0f 88 dc 01 00 00    	js     8031e6 <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  80300a:	83 ec 0c             	sub    $0xc,%esp
+  80300d:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  803010:	50                   	push   %eax
+  803011:	e8 b2 e3 ff ff       	call   8013c8 <fd_alloc>
+  803016:	89 c3                	mov    %eax,%ebx
+  803018:	83 c4 10             	add    $0x10,%esp
+  80301b:	85 c0                	test   %eax,%eax
+  80301d:	0f 88 b3 01 00 00    	js     8031d6 <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803023:	83 ec 04             	sub    $0x4,%esp
+  803026:	68 07 04 00 00       	push   $0x407
+  80302b:	ff 75 e0             	push   -0x20(%ebp)
+  80302e:	6a 00                	push   $0x0
+  803030:	e8 c0 de ff ff       	call   800ef5 <sys_page_alloc>
+  803035:	89 c3                	mov    %eax,%ebx
+  803037:	83 c4 10             	add    $0x10,%esp
+  80303a:	85 c0                	test   %eax,%eax
+  80303c:	0f 88 94 01 00 00    	js     8031d6 <pipe2+0x20a>
+  va = fd2data(fd0);
+  803042:	83 ec 0c             	sub    $0xc,%esp
+  803045:	ff 75 e4             	push   -0x1c(%ebp)
+  803048:	e8 67 e3 ff ff       	call   8013b4 <fd2data>
+  80304d:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80304f:	83 c4 0c             	add    $0xc,%esp
+  803052:	68 07 04 00 00       	push   $0x407
+  803057:	50                   	push   %eax
+  803058:	6a 00                	push   $0x0
+  80305a:	e8 96 de ff ff       	call   800ef5 <sys_page_alloc>
+  80305f:	89 c3                	mov    %eax,%ebx
+  803061:	83 c4 10             	add    $0x10,%esp
+  803064:	85 c0                	test   %eax,%eax
+  803066:	0f 88 5a 01 00 00    	js     8031c6 <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80306c:	83 ec 0c             	sub    $0xc,%esp
+  80306f:	ff 75 e0             	push   -0x20(%ebp)
+  803072:	e8 3d e3 ff ff       	call   8013b4 <fd2data>
+  803077:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  80307e:	50                   	push   %eax
+  80307f:	6a 00                	push   $0x0
+  803081:	57                   	push   %edi
+  803082:	6a 00                	push   $0x0
+  803084:	e8 af de ff ff       	call   800f38 <sys_page_map>
+  803089:	89 c3                	mov    %eax,%ebx
+  80308b:	83 c4 20             	add    $0x20,%esp
+  80308e:	85 c0                	test   %eax,%eax
+  803090:	0f 88 22 01 00 00    	js     8031b8 <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  803096:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  80309a:	74 72                	je     80310e <pipe2+0x142>
+  80309c:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  8030a1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8030a4:	e8 d3 fa ff ff       	call   802b7c <pipe_ring>
+  8030a9:	83 ec 04             	sub    $0x4,%esp
+  8030ac:	68 07 04 00 00       	push   $0x407
+  8030b1:	01 f0                	add    %esi,%eax
+  8030b3:	50                   	push   %eax
+  8030b4:	6a 00                	push   $0x0
+  8030b6:	e8 3a de ff ff       	call   800ef5 <sys_page_alloc>
+  8030bb:	89 c3                	mov    %eax,%ebx
+  8030bd:	83 c4 10             	add    $0x10,%esp
+  8030c0:	85 c0                	test   %eax,%eax
+  8030c2:	0f 88 97 00 00 00    	js     80315f <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  8030c8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8030cb:	e8 ac fa ff ff       	call   802b7c <pipe_ring>
+  8030d0:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  8030d3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8030d6:	e8 a1 fa ff ff       	call   802b7c <pipe_ring>
+  8030db:	83 ec 0c             	sub    $0xc,%esp
+  8030de:	68 07 04 00 00       	push   $0x407
+  8030e3:	53                   	push   %ebx
+  8030e4:	6a 00                	push   $0x0
+  8030e6:	01 f0                	add    %esi,%eax
+  8030e8:	50                   	push   %eax
+  8030e9:	6a 00                	push   $0x0
+  8030eb:	e8 48 de ff ff       	call   800f38 <sys_page_map>
+  8030f0:	89 c3                	mov    %eax,%ebx
+  8030f2:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8030f8:	83 c4 20             	add    $0x20,%esp
+  8030fb:	85 c0                	test   %eax,%eax
+  8030fd:	78 60                	js     80315f <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  8030ff:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  803105:	75 9a                	jne    8030a1 <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  803107:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  80310e:	a1 ac 57 80 00       	mov    0x8057ac,%eax
+  803113:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  803116:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  803118:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80311b:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  803122:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  803125:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  803127:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80312a:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  803131:	83 ec 0c             	sub    $0xc,%esp
+  803134:	ff 75 e4             	push   -0x1c(%ebp)
+  803137:	e8 68 e2 ff ff       	call   8013a4 <fd2num>
+  80313c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80313f:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  803141:	83 c4 04             	add    $0x4,%esp
+  803144:	ff 75 e0             	push   -0x20(%ebp)
+  803147:	e8 58 e2 ff ff       	call   8013a4 <fd2num>
+  80314c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80314f:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  803152:	83 c4 10             	add    $0x10,%esp
+  803155:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80315a:	e9 87 00 00 00       	jmp    8031e6 <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  80315f:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  803164:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803167:	e8 10 fa ff ff       	call   802b7c <pipe_ring>
+  80316c:	83 ec 08             	sub    $0x8,%esp
+  80316f:	01 f0                	add    %esi,%eax
+  803171:	50                   	push   %eax
+  803172:	6a 00                	push   $0x0
+  803174:	e8 01 de ff ff       	call   800f7a <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  803179:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80317c:	e8 fb f9 ff ff       	call   802b7c <pipe_ring>
+  803181:	83 c4 08             	add    $0x8,%esp
+  803184:	01 f0                	add    %esi,%eax
+  803186:	50                   	push   %eax
+  803187:	6a 00                	push   $0x0
+  803189:	e8 ec dd ff ff       	call   800f7a <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  80318e:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803194:	83 c4 10             	add    $0x10,%esp
+  803197:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  80319d:	75 c5                	jne    803164 <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  80319f:	83 ec 0c             	sub    $0xc,%esp
+  8031a2:	ff 75 e0             	push   -0x20(%ebp)
+  8031a5:	e8 0a e2 ff ff       	call   8013b4 <fd2data>
+  8031aa:	83 c4 08             	add    $0x8,%esp
+  8031ad:	50                   	push   %eax
+  8031ae:	6a 00                	push   $0x0
+  8031b0:	e8 c5 dd ff ff       	call   800f7a <sys_page_unmap>
+  8031b5:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  8031b8:	83 ec 08             	sub    $0x8,%esp
+  8031bb:	57                   	push   %edi
+  8031bc:	6a 00                	push   $0x0
+  8031be:	e8 b7 dd ff ff       	call   800f7a <sys_page_unmap>
+  8031c3:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  8031c6:	83 ec 08             	sub    $0x8,%esp
+  8031c9:	ff 75 e0             	push   -0x20(%ebp)
+  8031cc:	6a 00                	push   $0x0
+  8031ce:	e8 a7 dd ff ff       	call   800f7a <sys_page_unmap>
+  8031d3:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  8031d6:	83 ec 08             	sub    $0x8,%esp
+  8031d9:	ff 75 e4             	push   -0x1c(%ebp)
+  8031dc:	6a 00                	push   $0x0
+  8031de:	e8 97 dd ff ff       	call   800f7a <sys_page_unmap>
+  8031e3:	83 c4 10             	add    $0x10,%esp
+}
+  8031e6:	89 d8                	mov    %ebx,%eax
+  8031e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8031eb:	5b                   	pop    %ebx
+  8031ec:	5e                   	pop    %esi
+  8031ed:	5f                   	pop    %edi
+  8031ee:	5d                   	pop    %ebp
+  8031ef:	c3                   	ret
+
+008031f0 <pipe>:
+{
+  8031f0:	55                   	push   %ebp
+  8031f1:	89 e5                	mov    %esp,%ebp
+  8031f3:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  8031f6:	6a 00                	push   $0x0
+  8031f8:	ff 75 08             	push   0x8(%ebp)
+  8031fb:	e8 cc fd ff ff       	call   802fcc <pipe2>
+}
+  803200:	c9                   	leave
+  803201:	c3                   	ret
+
+00803202 <pipeisclosed>:
+{
+  803202:	55                   	push   %ebp
+  803203:	89 e5                	mov    %esp,%ebp
+  803205:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803208:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80320b:	50                   	push   %eax
+  80320c:	ff 75 08             	push   0x8(%ebp)
+  80320f:	e8 0a e2 ff ff       	call   80141e <fd_lookup>
+  803214:	83 c4 10             	add    $0x10,%esp
+  803217:	85 c0                	test   %eax,%eax
+  803219:	78 18                	js     803233 <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  80321b:	83 ec 0c             	sub    $0xc,%esp
+  80321e:	ff 75 f4             	push   -0xc(%ebp)
+  803221:	e8 8e e1 ff ff       	call   8013b4 <fd2data>
+  803226:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  803228:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80322b:	e8 59 fa ff ff       	call   802c89 <_pipeisclosed>
+  803230:	83 c4 10             	add    $0x10,%esp
+}
+  803233:	c9                   	leave
+  803234:	c3                   	ret
+
+00803235 <pipe_splice>:
+{
+  803235:	55                   	push   %ebp
+  803236:	89 e5                	mov    %esp,%ebp
+  803238:	57                   	push   %edi
+  803239:	56                   	push   %esi
+  80323a:	53                   	push   %ebx
+  80323b:	83 ec 34             	sub    $0x34,%esp
+  80323e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803241:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  803244:	50                   	push   %eax
+  803245:	ff 75 08             	push   0x8(%ebp)
+  803248:	e8 d1 e1 ff ff       	call   80141e <fd_lookup>
+  80324d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  803250:	83 c4 10             	add    $0x10,%esp
+  803253:	85 c0                	test   %eax,%eax
+  803255:	0f 88 d7 00 00 00    	js     803332 <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  80325b:	83 ec 0c             	sub    $0xc,%esp
+  80325e:	ff 75 e4             	push   -0x1c(%ebp)
+  803261:	e8 4e e1 ff ff       	call   8013b4 <fd2data>
+  803266:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  803268:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80326b:	83 c4 10             	add    $0x10,%esp
+  80326e:	8b 15 ac 57 80 00    	mov    0x8057ac,%edx
+  803274:	39 10                	cmp    %edx,(%eax)
+  803276:	0f 85 c1 00 00 00    	jne    80333d <pipe_splice+0x108>
+  80327c:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  803280:	0f 84 c0 00 00 00    	je     803346 <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  803286:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  80328a:	0f 84 bf 00 00 00    	je     80334f <pipe_splice+0x11a>
+  803290:	89 f7                	mov    %esi,%edi
+  803292:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  803298:	0f 85 ba 00 00 00    	jne    803358 <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  80329e:	8d 43 04             	lea    0x4(%ebx),%eax
+  8032a1:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8032a4:	eb 38                	jmp    8032de <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  8032a6:	83 ec 0c             	sub    $0xc,%esp
+  8032a9:	68 00 10 00 00       	push   $0x1000
+  8032ae:	89 f1                	mov    %esi,%ecx
+  8032b0:	89 da                	mov    %ebx,%edx
+  8032b2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8032b5:	e8 34 fa ff ff       	call   802cee <devpipe_write_bulk>
+  8032ba:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8032bd:	83 c4 10             	add    $0x10,%esp
+  8032c0:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8032c5:	75 53                	jne    80331a <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  8032c7:	83 ec 08             	sub    $0x8,%esp
+  8032ca:	56                   	push   %esi
+  8032cb:	6a 00                	push   $0x0
+  8032cd:	e8 a8 dc ff ff       	call   800f7a <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  8032d2:	83 c7 01             	add    $0x1,%edi
+  8032d5:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8032db:	83 c4 10             	add    $0x10,%esp
+  8032de:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8032e1:	74 3a                	je     80331d <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  8032e3:	8b 03                	mov    (%ebx),%eax
+  8032e5:	39 43 04             	cmp    %eax,0x4(%ebx)
+  8032e8:	75 bc                	jne    8032a6 <pipe_splice+0x71>
+  8032ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032ef:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  8032f3:	85 c0                	test   %eax,%eax
+  8032f5:	74 af                	je     8032a6 <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  8032f7:	83 ec 04             	sub    $0x4,%esp
+  8032fa:	6a 07                	push   $0x7
+  8032fc:	56                   	push   %esi
+  8032fd:	ff 75 d0             	push   -0x30(%ebp)
+  803300:	e8 4c df ff ff       	call   801251 <sys_chan_wakeup>
+  803305:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  803308:	83 c4 10             	add    $0x10,%esp
+  80330b:	85 c0                	test   %eax,%eax
+  80330d:	79 b8                	jns    8032c7 <pipe_splice+0x92>
+  80330f:	b8 01 00 00 00       	mov    $0x1,%eax
+  803314:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  803318:	eb 8c                	jmp    8032a6 <pipe_splice+0x71>
+  80331a:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  80331d:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803321:	75 06                	jne    803329 <pipe_splice+0xf4>
+  803323:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  803327:	78 09                	js     803332 <pipe_splice+0xfd>
+  return i * PGSIZE;
+  803329:	8b 45 10             	mov    0x10(%ebp),%eax
+  80332c:	c1 e0 0c             	shl    $0xc,%eax
+  80332f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  803332:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  803335:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803338:	5b                   	pop    %ebx
+  803339:	5e                   	pop    %esi
+  80333a:	5f                   	pop    %edi
+  80333b:	5d                   	pop    %ebp
+  80333c:	c3                   	ret
+    return -E_INVAL;
+  80333d:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  803344:	eb ec                	jmp    803332 <pipe_splice+0xfd>
+  803346:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  80334d:	eb e3                	jmp    803332 <pipe_splice+0xfd>
+  80334f:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  803356:	eb da                	jmp    803332 <pipe_splice+0xfd>
+  803358:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  80335f:	eb d1                	jmp    803332 <pipe_splice+0xfd>
+
+00803361 <pipe_splice_read>:
+{
+  803361:	55                   	push   %ebp
+  803362:	89 e5                	mov    %esp,%ebp
+  803364:	53                   	push   %ebx
+  803365:	83 ec 1c             	sub    $0x1c,%esp
+  803368:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80336b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80336e:	50                   	push   %eax
+  80336f:	ff 75 08             	push   0x8(%ebp)
+  803372:	e8 a7 e0 ff ff       	call   80141e <fd_lookup>
+  803377:	83 c4 10             	add    $0x10,%esp
+  80337a:	85 c0                	test   %eax,%eax
+  80337c:	78 49                	js     8033c7 <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  80337e:	83 ec 0c             	sub    $0xc,%esp
+  803381:	ff 75 f4             	push   -0xc(%ebp)
+  803384:	e8 2b e0 ff ff       	call   8013b4 <fd2data>
+  803389:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  80338b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80338e:	83 c4 10             	add    $0x10,%esp
+  803391:	8b 0d ac 57 80 00    	mov    0x8057ac,%ecx
+  803397:	39 08                	cmp    %ecx,(%eax)
+  803399:	75 31                	jne    8033cc <pipe_splice_read+0x6b>
+  80339b:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  80339f:	74 32                	je     8033d3 <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  8033a1:	8b 48 08             	mov    0x8(%eax),%ecx
+  8033a4:	83 e1 03             	and    $0x3,%ecx
+  8033a7:	83 f9 01             	cmp    $0x1,%ecx
+  8033aa:	74 2e                	je     8033da <pipe_splice_read+0x79>
+  8033ac:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  8033b2:	75 2d                	jne    8033e1 <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  8033b4:	83 ec 08             	sub    $0x8,%esp
+  8033b7:	53                   	push   %ebx
+  8033b8:	68 00 10 00 00       	push   $0x1000
+  8033bd:	89 d9                	mov    %ebx,%ecx
+  8033bf:	e8 93 fa ff ff       	call   802e57 <devpipe_read_bulk>
+  8033c4:	83 c4 10             	add    $0x10,%esp
+}
+  8033c7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8033ca:	c9                   	leave
+  8033cb:	c3                   	ret
+    return -E_INVAL;
+  8033cc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8033d1:	eb f4                	jmp    8033c7 <pipe_splice_read+0x66>
+  8033d3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8033d8:	eb ed                	jmp    8033c7 <pipe_splice_read+0x66>
+  8033da:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8033df:	eb e6                	jmp    8033c7 <pipe_splice_read+0x66>
+  8033e1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8033e6:	eb df                	jmp    8033c7 <pipe_splice_read+0x66>
+
+008033e8 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  8033e8:	55                   	push   %ebp
+  8033e9:	89 e5                	mov    %esp,%ebp
+  8033eb:	56                   	push   %esi
+  8033ec:	53                   	push   %ebx
+  8033ed:	8b 75 08             	mov    0x8(%ebp),%esi
+  const volatile struct Env *e;
+
+  assert(envid != 0);
+  8033f0:	85 f6                	test   %esi,%esi
+  8033f2:	74 15                	je     803409 <wait+0x21>
+  e = &envs[ENVX(envid)];
+  8033f4:	89 f0                	mov    %esi,%eax
+  8033f6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  while (e->env_id == envid && e->env_status != ENV_FREE)
+  8033fb:	8d 1c c0             	lea    (%eax,%eax,8),%ebx
+  8033fe:	c1 e3 04             	shl    $0x4,%ebx
+  803401:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  803407:	eb 1b                	jmp    803424 <wait+0x3c>
+  assert(envid != 0);
+  803409:	68 85 3e 80 00       	push   $0x803e85
+  80340e:	68 78 3d 80 00       	push   $0x803d78
+  803413:	6a 09                	push   $0x9
+  803415:	68 90 3e 80 00       	push   $0x803e90
+  80341a:	e8 de cf ff ff       	call   8003fd <_panic>
+    sys_yield();
+  80341f:	e8 6f da ff ff       	call   800e93 <sys_yield>
+  while (e->env_id == envid && e->env_status != ENV_FREE)
+  803424:	8b 43 48             	mov    0x48(%ebx),%eax
+  803427:	39 f0                	cmp    %esi,%eax
+  803429:	75 07                	jne    803432 <wait+0x4a>
+  80342b:	8b 43 54             	mov    0x54(%ebx),%eax
+  80342e:	85 c0                	test   %eax,%eax
+  803430:	75 ed                	jne    80341f <wait+0x37>
+}
+  803432:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803435:	5b                   	pop    %ebx
+  803436:	5e                   	pop    %esi
+  803437:	5d                   	pop    %ebp
+  803438:	c3                   	ret
+
+00803439 <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  803439:	55                   	push   %ebp
+  80343a:	89 e5                	mov    %esp,%ebp
+  80343c:	57                   	push   %edi
+  80343d:	56                   	push   %esi
+  80343e:	53                   	push   %ebx
+  80343f:	83 ec 14             	sub    $0x14,%esp
+  803442:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803445:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803448:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80344b:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  80344e:	85 c0                	test   %eax,%eax
+  803450:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803455:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  803458:	ff 33                	push   (%ebx)
+  80345a:	50                   	push   %eax
+  80345b:	e8 6d dd ff ff       	call   8011cd <sys_ipc_recv>
+  803460:	83 c4 10             	add    $0x10,%esp
+  803463:	85 c0                	test   %eax,%eax
+  803465:	78 39                	js     8034a0 <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  803467:	85 ff                	test   %edi,%edi
+  803469:	74 0a                	je     803475 <ipc_recv_pages+0x3c>
+  80346b:	a1 f0 85 80 00       	mov    0x8085f0,%eax
+  803470:	8b 40 7c             	mov    0x7c(%eax),%eax
+  803473:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803475:	85 f6                	test   %esi,%esi
+  803477:	74 0d                	je     803486 <ipc_recv_pages+0x4d>
+  803479:	a1 f0 85 80 00       	mov    0x8085f0,%eax
+  80347e:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  803484:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  803486:	a1 f0 85 80 00       	mov    0x8085f0,%eax
+  80348b:	8b 40 74             	mov    0x74(%eax),%eax
+  80348e:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  803490:	a1 f0 85 80 00       	mov    0x8085f0,%eax
+  803495:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  803498:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80349b:	5b                   	pop    %ebx
+  80349c:	5e                   	pop    %esi
+  80349d:	5f                   	pop    %edi
+  80349e:	5d                   	pop    %ebp
+  80349f:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  8034a0:	85 ff                	test   %edi,%edi
+  8034a2:	74 06                	je     8034aa <ipc_recv_pages+0x71>
+  8034a4:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  8034aa:	85 f6                	test   %esi,%esi
+  8034ac:	74 06                	je     8034b4 <ipc_recv_pages+0x7b>
+  8034ae:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  8034b4:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  8034ba:	eb dc                	jmp    803498 <ipc_recv_pages+0x5f>
+
+008034bc <ipc_recv>:
+{
+  8034bc:	55                   	push   %ebp
+  8034bd:	89 e5                	mov    %esp,%ebp
+  8034bf:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  8034c2:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  8034c9:	ff 75 10             	push   0x10(%ebp)
+  8034cc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8034cf:	50                   	push   %eax
+  8034d0:	ff 75 0c             	push   0xc(%ebp)
+  8034d3:	ff 75 08             	push   0x8(%ebp)
+  8034d6:	e8 5e ff ff ff       	call   803439 <ipc_recv_pages>
+}
+  8034db:	c9                   	leave
+  8034dc:	c3                   	ret
+
+008034dd <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  8034dd:	55                   	push   %ebp
+  8034de:	89 e5                	mov    %esp,%ebp
+  8034e0:	57                   	push   %edi
+  8034e1:	56                   	push   %esi
+  8034e2:	53                   	push   %ebx
+  8034e3:	83 ec 0c             	sub    $0xc,%esp
+  8034e6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8034e9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8034ec:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  8034ef:	89 c3                	mov    %eax,%ebx
+  8034f1:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  8034f7:	85 c0                	test   %eax,%eax
+  8034f9:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8034fe:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  803501:	83 ec 0c             	sub    $0xc,%esp
+  803504:	ff 75 14             	push   0x14(%ebp)
+  803507:	ff 75 18             	push   0x18(%ebp)
+  80350a:	53                   	push   %ebx
+  80350b:	56                   	push   %esi
+  80350c:	57                   	push   %edi
+  80350d:	e8 9a dc ff ff       	call   8011ac <sys_ipc_try_send>
+  803512:	83 c4 20             	add    $0x20,%esp
+  803515:	85 c0                	test   %eax,%eax
+  803517:	79 1e                	jns    803537 <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  803519:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80351c:	75 07                	jne    803525 <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  80351e:	e8 70 d9 ff ff       	call   800e93 <sys_yield>
+  803523:	eb dc                	jmp    803501 <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  803525:	50                   	push   %eax
+  803526:	68 9b 3e 80 00       	push   $0x803e9b
+  80352b:	6a 5c                	push   $0x5c
+  80352d:	68 a8 3e 80 00       	push   $0x803ea8
+  803532:	e8 c6 ce ff ff       	call   8003fd <_panic>
+  }
+}
+  803537:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80353a:	5b                   	pop    %ebx
+  80353b:	5e                   	pop    %esi
+  80353c:	5f                   	pop    %edi
+  80353d:	5d                   	pop    %ebp
+  80353e:	c3                   	ret
+
+0080353f <ipc_send>:
+{
+  80353f:	55                   	push   %ebp
+  803540:	89 e5                	mov    %esp,%ebp
+  803542:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  803545:	ff 75 14             	push   0x14(%ebp)
+  803548:	6a 01                	push   $0x1
+  80354a:	ff 75 10             	push   0x10(%ebp)
+  80354d:	ff 75 0c             	push   0xc(%ebp)
+  803550:	ff 75 08             	push   0x8(%ebp)
+  803553:	e8 85 ff ff ff       	call   8034dd <ipc_send_pages>
+}
+  803558:	83 c4 20             	add    $0x20,%esp
+  80355b:	c9                   	leave
+  80355c:	c3                   	ret
+
+0080355d <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80355d:	55                   	push   %ebp
+  80355e:	89 e5                	mov    %esp,%ebp
+  803560:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  803563:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  803568:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80356b:	c1 e0 04             	shl    $0x4,%eax
+  80356e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803573:	8b 40 50             	mov    0x50(%eax),%eax
+  803576:	39 c8                	cmp    %ecx,%eax
+  803578:	74 12                	je     80358c <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  80357a:	83 c2 01             	add    $0x1,%edx
+  80357d:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  803583:	75 e3                	jne    803568 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  803585:	b8 00 00 00 00       	mov    $0x0,%eax
+  80358a:	eb 0e                	jmp    80359a <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  80358c:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80358f:	c1 e0 04             	shl    $0x4,%eax
+  803592:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803597:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  80359a:	5d                   	pop    %ebp
+  80359b:	c3                   	ret
+
+0080359c <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  80359c:	55                   	push   %ebp
+  80359d:	89 e5                	mov    %esp,%ebp
+  80359f:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  8035a2:	89 c2                	mov    %eax,%edx
+  8035a4:	c1 ea 16             	shr    $0x16,%edx
+  8035a7:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  8035ae:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  8035b3:	f6 c1 01             	test   $0x1,%cl
+  8035b6:	74 1c                	je     8035d4 <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  8035b8:	c1 e8 0c             	shr    $0xc,%eax
+  8035bb:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  8035c2:	a8 01                	test   $0x1,%al
+  8035c4:	74 0e                	je     8035d4 <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  8035c6:	c1 e8 0c             	shr    $0xc,%eax
+  8035c9:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  8035d0:	ef 
+  8035d1:	0f b7 d2             	movzwl %dx,%edx
+}
+  8035d4:	89 d0                	mov    %edx,%eax
+  8035d6:	5d                   	pop    %ebp
+  8035d7:	c3                   	ret
+
+008035d8 <udivmod>:
+  8035d8:	55                   	push   %ebp
+  8035d9:	57                   	push   %edi
+  8035da:	56                   	push   %esi
+  8035db:	53                   	push   %ebx
+  8035dc:	83 ec 14             	sub    $0x14,%esp
+  8035df:	8b 74 24 28          	mov    0x28(%esp),%esi
+  8035e3:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  8035e7:	89 fb                	mov    %edi,%ebx
+  8035e9:	09 f3                	or     %esi,%ebx
+  8035eb:	0f 84 88 00 00 00    	je     803679 <udivmod+0xa1>
+  8035f1:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8035f6:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8035fd:	00 
+  8035fe:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  803605:	00 
+  803606:	89 cd                	mov    %ecx,%ebp
+  803608:	89 34 24             	mov    %esi,(%esp)
+  80360b:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  80360f:	eb 08                	jmp    803619 <udivmod+0x41>
+  803611:	83 ed 01             	sub    $0x1,%ebp
+  803614:	83 fd ff             	cmp    $0xffffffff,%ebp
+  803617:	74 6c                	je     803685 <udivmod+0xad>
+  803619:	89 c3                	mov    %eax,%ebx
+  80361b:	89 d6                	mov    %edx,%esi
+  80361d:	89 e9                	mov    %ebp,%ecx
+  80361f:	0f ad f3             	shrd   %cl,%esi,%ebx
+  803622:	d3 ee                	shr    %cl,%esi
+  803624:	f6 c1 20             	test   $0x20,%cl
+  803627:	74 04                	je     80362d <udivmod+0x55>
+  803629:	89 f3                	mov    %esi,%ebx
+  80362b:	31 f6                	xor    %esi,%esi
+  80362d:	8b 3c 24             	mov    (%esp),%edi
+  803630:	39 fb                	cmp    %edi,%ebx
+  803632:	89 f7                	mov    %esi,%edi
+  803634:	8b 1c 24             	mov    (%esp),%ebx
+  803637:	8b 74 24 04          	mov    0x4(%esp),%esi
+  80363b:	19 f7                	sbb    %esi,%edi
+  80363d:	72 d2                	jb     803611 <udivmod+0x39>
+  80363f:	89 f7                	mov    %esi,%edi
+  803641:	89 de                	mov    %ebx,%esi
+  803643:	89 e9                	mov    %ebp,%ecx
+  803645:	0f a5 f7             	shld   %cl,%esi,%edi
+  803648:	d3 e6                	shl    %cl,%esi
+  80364a:	f6 c1 20             	test   $0x20,%cl
+  80364d:	74 04                	je     803653 <udivmod+0x7b>
+  80364f:	89 f7                	mov    %esi,%edi
+  803651:	31 f6                	xor    %esi,%esi
+  803653:	29 f0                	sub    %esi,%eax
+  803655:	19 fa                	sbb    %edi,%edx
+  803657:	be 01 00 00 00       	mov    $0x1,%esi
+  80365c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803661:	0f a5 f7             	shld   %cl,%esi,%edi
+  803664:	d3 e6                	shl    %cl,%esi
+  803666:	f6 c1 20             	test   $0x20,%cl
+  803669:	74 04                	je     80366f <udivmod+0x97>
+  80366b:	89 f7                	mov    %esi,%edi
+  80366d:	31 f6                	xor    %esi,%esi
+  80366f:	09 74 24 08          	or     %esi,0x8(%esp)
+  803673:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  803677:	eb 98                	jmp    803611 <udivmod+0x39>
+  803679:	89 f0                	mov    %esi,%eax
+  80367b:	89 fa                	mov    %edi,%edx
+  80367d:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803681:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  803685:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  803689:	89 01                	mov    %eax,(%ecx)
+  80368b:	89 51 04             	mov    %edx,0x4(%ecx)
+  80368e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803692:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803696:	83 c4 14             	add    $0x14,%esp
+  803699:	5b                   	pop    %ebx
+  80369a:	5e                   	pop    %esi
+  80369b:	5f                   	pop    %edi
+  80369c:	5d                   	pop    %ebp
+  80369d:	c3                   	ret
+
+0080369e <__udivdi3>:
+  80369e:	83 ec 18             	sub    $0x18,%esp
+  8036a1:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8036a5:	50                   	push   %eax
+  8036a6:	ff 74 24 2c          	push   0x2c(%esp)
+  8036aa:	ff 74 24 2c          	push   0x2c(%esp)
+  8036ae:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8036b2:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8036b6:	e8 1d ff ff ff       	call   8035d8 <udivmod>
+  8036bb:	83 c4 24             	add    $0x24,%esp
+  8036be:	c3                   	ret
+
+008036bf <__umoddi3>:
+  8036bf:	83 ec 18             	sub    $0x18,%esp
+  8036c2:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8036c6:	50                   	push   %eax
+  8036c7:	ff 74 24 2c          	push   0x2c(%esp)
+  8036cb:	ff 74 24 2c          	push   0x2c(%esp)
+  8036cf:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8036d3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8036d7:	e8 fc fe ff ff       	call   8035d8 <udivmod>
+  8036dc:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8036e0:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8036e4:	83 c4 24             	add    $0x24,%esp
+  8036e7:	c3                   	ret
+
+008036e8 <__divdi3>:
+  8036e8:	56                   	push   %esi
+  8036e9:	53                   	push   %ebx
+  8036ea:	83 ec 14             	sub    $0x14,%esp
+  8036ed:	8b 44 24 20          	mov    0x20(%esp),%eax
+  8036f1:	8b 54 24 24          	mov    0x24(%esp),%edx
+  8036f5:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  8036f9:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  8036fd:	85 d2                	test   %edx,%edx
+  8036ff:	78 18                	js     803719 <__divdi3+0x31>
+  803701:	85 db                	test   %ebx,%ebx
+  803703:	78 3e                	js     803743 <__divdi3+0x5b>
+  803705:	83 ec 04             	sub    $0x4,%esp
+  803708:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80370c:	56                   	push   %esi
+  80370d:	53                   	push   %ebx
+  80370e:	51                   	push   %ecx
+  80370f:	e8 c4 fe ff ff       	call   8035d8 <udivmod>
+  803714:	83 c4 10             	add    $0x10,%esp
+  803717:	eb 24                	jmp    80373d <__divdi3+0x55>
+  803719:	f7 d8                	neg    %eax
+  80371b:	83 d2 00             	adc    $0x0,%edx
+  80371e:	f7 da                	neg    %edx
+  803720:	85 db                	test   %ebx,%ebx
+  803722:	78 3a                	js     80375e <__divdi3+0x76>
+  803724:	83 ec 04             	sub    $0x4,%esp
+  803727:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80372b:	56                   	push   %esi
+  80372c:	53                   	push   %ebx
+  80372d:	51                   	push   %ecx
+  80372e:	e8 a5 fe ff ff       	call   8035d8 <udivmod>
+  803733:	83 c4 10             	add    $0x10,%esp
+  803736:	f7 d8                	neg    %eax
+  803738:	83 d2 00             	adc    $0x0,%edx
+  80373b:	f7 da                	neg    %edx
+  80373d:	83 c4 14             	add    $0x14,%esp
+  803740:	5b                   	pop    %ebx
+  803741:	5e                   	pop    %esi
+  803742:	c3                   	ret
+  803743:	83 ec 04             	sub    $0x4,%esp
+  803746:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80374a:	56                   	push   %esi
+  80374b:	f7 d9                	neg    %ecx
+  80374d:	83 d3 00             	adc    $0x0,%ebx
+  803750:	f7 db                	neg    %ebx
+  803752:	53                   	push   %ebx
+  803753:	51                   	push   %ecx
+  803754:	e8 7f fe ff ff       	call   8035d8 <udivmod>
+  803759:	83 c4 10             	add    $0x10,%esp
+  80375c:	eb d8                	jmp    803736 <__divdi3+0x4e>
+  80375e:	83 ec 04             	sub    $0x4,%esp
+  803761:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803765:	56                   	push   %esi
+  803766:	f7 d9                	neg    %ecx
+  803768:	83 d3 00             	adc    $0x0,%ebx
+  80376b:	f7 db                	neg    %ebx
+  80376d:	53                   	push   %ebx
+  80376e:	51                   	push   %ecx
+  80376f:	e8 64 fe ff ff       	call   8035d8 <udivmod>
+  803774:	83 c4 10             	add    $0x10,%esp
+  803777:	eb c4                	jmp    80373d <__divdi3+0x55>
+
+00803779 <__moddi3>:
+  803779:	55                   	push   %ebp
+  80377a:	57                   	push   %edi
+  80377b:	56                   	push   %esi
+  80377c:	53                   	push   %ebx
+  80377d:	83 ec 24             	sub    $0x24,%esp
+  803780:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803784:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803788:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  80378c:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  803790:	85 d2                	test   %edx,%edx
+  803792:	78 3b                	js     8037cf <__moddi3+0x56>
+  803794:	83 ec 04             	sub    $0x4,%esp
+  803797:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  80379b:	56                   	push   %esi
+  80379c:	89 ce                	mov    %ecx,%esi
+  80379e:	f7 de                	neg    %esi
+  8037a0:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8037a4:	89 de                	mov    %ebx,%esi
+  8037a6:	83 d6 00             	adc    $0x0,%esi
+  8037a9:	f7 de                	neg    %esi
+  8037ab:	89 74 24 14          	mov    %esi,0x14(%esp)
+  8037af:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8037b3:	0f 48 f1             	cmovs  %ecx,%esi
+  8037b6:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  8037bb:	53                   	push   %ebx
+  8037bc:	56                   	push   %esi
+  8037bd:	e8 16 fe ff ff       	call   8035d8 <udivmod>
+  8037c2:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8037c6:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8037ca:	83 c4 10             	add    $0x10,%esp
+  8037cd:	eb 47                	jmp    803816 <__moddi3+0x9d>
+  8037cf:	f7 d8                	neg    %eax
+  8037d1:	83 d2 00             	adc    $0x0,%edx
+  8037d4:	f7 da                	neg    %edx
+  8037d6:	83 ec 04             	sub    $0x4,%esp
+  8037d9:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8037dd:	56                   	push   %esi
+  8037de:	89 cf                	mov    %ecx,%edi
+  8037e0:	f7 df                	neg    %edi
+  8037e2:	89 de                	mov    %ebx,%esi
+  8037e4:	83 d6 00             	adc    $0x0,%esi
+  8037e7:	f7 de                	neg    %esi
+  8037e9:	0f 49 cf             	cmovns %edi,%ecx
+  8037ec:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  8037f0:	0f 49 de             	cmovns %esi,%ebx
+  8037f3:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  8037f7:	ff 74 24 0c          	push   0xc(%esp)
+  8037fb:	ff 74 24 0c          	push   0xc(%esp)
+  8037ff:	e8 d4 fd ff ff       	call   8035d8 <udivmod>
+  803804:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803808:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80380c:	f7 d8                	neg    %eax
+  80380e:	83 d2 00             	adc    $0x0,%edx
+  803811:	f7 da                	neg    %edx
+  803813:	83 c4 10             	add    $0x10,%esp
+  803816:	83 c4 24             	add    $0x24,%esp
+  803819:	5b                   	pop    %ebx
+  80381a:	5e                   	pop    %esi
+  80381b:	5f                   	pop    %edi
+  80381c:	5d                   	pop    %ebp
+  80381d:	c3                   	ret
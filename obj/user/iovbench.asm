@@ -0,0 +1,6659 @@
+
+obj/user/iovbench.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 de 02 00 00       	call   80030f <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <pass>:
+
+// Write or read 'size' bytes of BIGNAME NPASS times, 'xfer' bytes per
+// call.  Returns the elapsed ms.
+static unsigned
+pass(bool wr, off_t size, size_t xfer)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 2c             	sub    $0x2c,%esp
+  80003c:	89 c3                	mov    %eax,%ebx
+  80003e:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  800041:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  800044:	88 45 db             	mov    %al,-0x25(%ebp)
+  unsigned ms;
+  off_t off;
+  int fd, n, p, i;
+
+  ms = sys_time_msec();
+  800047:	e8 42 11 00 00       	call   80118e <sys_time_msec>
+  80004c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  for (p = 0; p < NPASS; p++) {
+  80004f:	89 d8                	mov    %ebx,%eax
+  800051:	f6 d8                	neg    %al
+  800053:	19 c0                	sbb    %eax,%eax
+  800055:	25 02 01 00 00       	and    $0x102,%eax
+  80005a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80005d:	c7 45 d4 05 00 00 00 	movl   $0x5,-0x2c(%ebp)
+  800064:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+  800067:	e9 27 01 00 00       	jmp    800193 <pass+0x160>
+    if ((fd = open(BIGNAME, wr ? O_RDWR | O_CREAT : O_RDONLY)) < 0)
+      panic("open %s: %e", BIGNAME, fd);
+  80006c:	83 ec 0c             	sub    $0xc,%esp
+  80006f:	50                   	push   %eax
+  800070:	68 2b 31 80 00       	push   $0x80312b
+  800075:	68 39 31 80 00       	push   $0x803139
+  80007a:	6a 1d                	push   $0x1d
+  80007c:	68 45 31 80 00       	push   $0x803145
+  800081:	e8 f6 02 00 00       	call   80037c <_panic>
+    for (off = 0; off < size; off += n) {
+      if (wr) {
+        for (i = 0; i < xfer; i += PGSIZE)
+          *(int*) (buf + i) = (off + i) / PGSIZE;
+  800086:	8d 34 13             	lea    (%ebx,%edx,1),%esi
+  800089:	8d 86 ff 0f 00 00    	lea    0xfff(%esi),%eax
+  80008f:	85 f6                	test   %esi,%esi
+  800091:	0f 49 c6             	cmovns %esi,%eax
+  800094:	c1 f8 0c             	sar    $0xc,%eax
+  800097:	89 82 00 50 80 00    	mov    %eax,0x805000(%edx)
+        for (i = 0; i < xfer; i += PGSIZE)
+  80009d:	81 c2 00 10 00 00    	add    $0x1000,%edx
+  8000a3:	39 ca                	cmp    %ecx,%edx
+  8000a5:	72 df                	jb     800086 <pass+0x53>
+        n = write(fd, buf, MIN(xfer, size - off));
+  8000a7:	83 ec 04             	sub    $0x4,%esp
+  8000aa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8000ad:	29 d8                	sub    %ebx,%eax
+  8000af:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8000b2:	39 f8                	cmp    %edi,%eax
+  8000b4:	0f 47 c7             	cmova  %edi,%eax
+  8000b7:	50                   	push   %eax
+  8000b8:	68 00 50 80 00       	push   $0x805000
+  8000bd:	ff 75 dc             	push   -0x24(%ebp)
+  8000c0:	e8 51 16 00 00       	call   801716 <write>
+  8000c5:	89 c7                	mov    %eax,%edi
+  8000c7:	83 c4 10             	add    $0x10,%esp
+        for (i = 0; i < n; i += PGSIZE)
+          if (*(int*) (buf + i) != (off + i) / PGSIZE)
+            panic("%s: page %d holds %d", BIGNAME, (off + i) / PGSIZE,
+                  *(int*) (buf + i));
+      }
+      if (n <= 0)
+  8000ca:	85 ff                	test   %edi,%edi
+  8000cc:	0f 8e 85 00 00 00    	jle    800157 <pass+0x124>
+    for (off = 0; off < size; off += n) {
+  8000d2:	01 fb                	add    %edi,%ebx
+  8000d4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8000d7:	39 c3                	cmp    %eax,%ebx
+  8000d9:	0f 8d a5 00 00 00    	jge    800184 <pass+0x151>
+        for (i = 0; i < xfer; i += PGSIZE)
+  8000df:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000e4:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+      if (wr) {
+  8000e7:	80 7d db 00          	cmpb   $0x0,-0x25(%ebp)
+  8000eb:	75 b6                	jne    8000a3 <pass+0x70>
+        n = readn(fd, buf, MIN(xfer, size - off));
+  8000ed:	83 ec 04             	sub    $0x4,%esp
+  8000f0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8000f3:	29 d8                	sub    %ebx,%eax
+  8000f5:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  8000f8:	39 f8                	cmp    %edi,%eax
+  8000fa:	0f 47 c7             	cmova  %edi,%eax
+  8000fd:	50                   	push   %eax
+  8000fe:	68 00 50 80 00       	push   $0x805000
+  800103:	ff 75 dc             	push   -0x24(%ebp)
+  800106:	e8 c4 15 00 00       	call   8016cf <readn>
+  80010b:	89 c7                	mov    %eax,%edi
+        for (i = 0; i < n; i += PGSIZE)
+  80010d:	83 c4 10             	add    $0x10,%esp
+  800110:	ba 00 00 00 00       	mov    $0x0,%edx
+  800115:	39 fa                	cmp    %edi,%edx
+  800117:	7d b1                	jge    8000ca <pass+0x97>
+          if (*(int*) (buf + i) != (off + i) / PGSIZE)
+  800119:	8b b2 00 50 80 00    	mov    0x805000(%edx),%esi
+  80011f:	8d 0c 13             	lea    (%ebx,%edx,1),%ecx
+  800122:	8d 81 ff 0f 00 00    	lea    0xfff(%ecx),%eax
+  800128:	85 c9                	test   %ecx,%ecx
+  80012a:	0f 49 c1             	cmovns %ecx,%eax
+  80012d:	c1 f8 0c             	sar    $0xc,%eax
+  800130:	39 c6                	cmp    %eax,%esi
+  800132:	75 08                	jne    80013c <pass+0x109>
+        for (i = 0; i < n; i += PGSIZE)
+  800134:	81 c2 00 10 00 00    	add    $0x1000,%edx
+  80013a:	eb d9                	jmp    800115 <pass+0xe2>
+            panic("%s: page %d holds %d", BIGNAME, (off + i) / PGSIZE,
+  80013c:	83 ec 08             	sub    $0x8,%esp
+  80013f:	56                   	push   %esi
+  800140:	50                   	push   %eax
+  800141:	68 2b 31 80 00       	push   $0x80312b
+  800146:	68 55 31 80 00       	push   $0x803155
+  80014b:	6a 27                	push   $0x27
+  80014d:	68 45 31 80 00       	push   $0x803145
+  800152:	e8 25 02 00 00       	call   80037c <_panic>
+        panic("%s %s: %e", wr ? "write" : "read", BIGNAME, n);
+  800157:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  80015a:	84 db                	test   %bl,%bl
+  80015c:	b8 26 31 80 00       	mov    $0x803126,%eax
+  800161:	ba 20 31 80 00       	mov    $0x803120,%edx
+  800166:	0f 45 c2             	cmovne %edx,%eax
+  800169:	83 ec 08             	sub    $0x8,%esp
+  80016c:	57                   	push   %edi
+  80016d:	68 2b 31 80 00       	push   $0x80312b
+  800172:	50                   	push   %eax
+  800173:	68 6a 31 80 00       	push   $0x80316a
+  800178:	6a 2b                	push   $0x2b
+  80017a:	68 45 31 80 00       	push   $0x803145
+  80017f:	e8 f8 01 00 00       	call   80037c <_panic>
+    }
+    close(fd);
+  800184:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800187:	83 ec 0c             	sub    $0xc,%esp
+  80018a:	51                   	push   %ecx
+  80018b:	e8 30 13 00 00       	call   8014c0 <close>
+  800190:	83 c4 10             	add    $0x10,%esp
+  for (p = 0; p < NPASS; p++) {
+  800193:	83 6d d4 01          	subl   $0x1,-0x2c(%ebp)
+  800197:	74 28                	je     8001c1 <pass+0x18e>
+    if ((fd = open(BIGNAME, wr ? O_RDWR | O_CREAT : O_RDONLY)) < 0)
+  800199:	83 ec 08             	sub    $0x8,%esp
+  80019c:	ff 75 d0             	push   -0x30(%ebp)
+  80019f:	68 2b 31 80 00       	push   $0x80312b
+  8001a4:	e8 ca 1c 00 00       	call   801e73 <open>
+  8001a9:	83 c4 10             	add    $0x10,%esp
+  8001ac:	85 c0                	test   %eax,%eax
+  8001ae:	0f 88 b8 fe ff ff    	js     80006c <pass+0x39>
+    for (off = 0; off < size; off += n) {
+  8001b4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001b9:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8001bc:	e9 13 ff ff ff       	jmp    8000d4 <pass+0xa1>
+  }
+  return sys_time_msec() - ms;
+  8001c1:	e8 c8 0f 00 00       	call   80118e <sys_time_msec>
+  8001c6:	8b 7d cc             	mov    -0x34(%ebp),%edi
+  8001c9:	29 f8                	sub    %edi,%eax
+}
+  8001cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001ce:	5b                   	pop    %ebx
+  8001cf:	5e                   	pop    %esi
+  8001d0:	5f                   	pop    %edi
+  8001d1:	5d                   	pop    %ebp
+  8001d2:	c3                   	ret
+
+008001d3 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8001d3:	55                   	push   %ebp
+  8001d4:	89 e5                	mov    %esp,%ebp
+  8001d6:	57                   	push   %edi
+  8001d7:	56                   	push   %esi
+  8001d8:	53                   	push   %ebx
+  8001d9:	83 ec 1c             	sub    $0x1c,%esp
+  unsigned wms, rms;
+  off_t size;
+  int fd, i;
+
+  binaryname = "iovbench";
+  8001dc:	c7 05 00 40 80 00 74 	movl   $0x803174,0x804000
+  8001e3:	31 80 00 
+  size = 1024 * 1024;
+  8001e6:	b8 00 00 10 00       	mov    $0x100000,%eax
+  if (argc > 1)
+  8001eb:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+  8001ef:	0f 8f ef 00 00 00    	jg     8002e4 <umain+0x111>
+    size = strtol(argv[1], 0, 0) * 1024;
+  size = ROUNDUP(size, sizeof(buf));
+  8001f5:	8d b8 ff ff 0f 00    	lea    0xfffff(%eax),%edi
+  8001fb:	81 e7 00 00 f0 ff    	and    $0xfff00000,%edi
+
+  // Allocate the file's blocks and warm the cache.
+  pass(1, size, sizeof(buf));
+  800201:	b9 00 00 10 00       	mov    $0x100000,%ecx
+  800206:	89 fa                	mov    %edi,%edx
+  800208:	b8 01 00 00 00       	mov    $0x1,%eax
+  80020d:	e8 21 fe ff ff       	call   800033 <pass>
+  pass(0, size, sizeof(buf));
+  800212:	b9 00 00 10 00       	mov    $0x100000,%ecx
+  800217:	89 fa                	mov    %edi,%edx
+  800219:	b8 00 00 00 00       	mov    $0x0,%eax
+  80021e:	e8 10 fe ff ff       	call   800033 <pass>
+
+  cprintf("iovbench: %d KB file, %d passes\n", size / 1024, NPASS);
+  800223:	8d 9f ff 03 00 00    	lea    0x3ff(%edi),%ebx
+  800229:	85 ff                	test   %edi,%edi
+  80022b:	0f 49 df             	cmovns %edi,%ebx
+  80022e:	c1 fb 0a             	sar    $0xa,%ebx
+  800231:	83 ec 04             	sub    $0x4,%esp
+  800234:	6a 04                	push   $0x4
+  800236:	53                   	push   %ebx
+  800237:	68 80 31 80 00       	push   $0x803180
+  80023c:	e8 16 02 00 00       	call   800457 <cprintf>
+  for (i = 0; i < sizeof(xfers) / sizeof(xfers[0]); i++) {
+    wms = pass(1, size, xfers[i]);
+    rms = pass(0, size, xfers[i]);
+    cprintf("iovbench: %4d KB transfers  write %5d KB/s  read %5d KB/s\n",
+            xfers[i] / 1024, size / 1024 * NPASS * 1000 / MAX(wms, 1),
+            size / 1024 * NPASS * 1000 / MAX(rms, 1));
+  800241:	69 c3 a0 0f 00 00    	imul   $0xfa0,%ebx,%eax
+  800247:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80024a:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < sizeof(xfers) / sizeof(xfers[0]); i++) {
+  80024d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800252:	89 7d e0             	mov    %edi,-0x20(%ebp)
+  800255:	89 c7                	mov    %eax,%edi
+    wms = pass(1, size, xfers[i]);
+  800257:	8b 34 bd e0 31 80 00 	mov    0x8031e0(,%edi,4),%esi
+  80025e:	89 f1                	mov    %esi,%ecx
+  800260:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800263:	b8 01 00 00 00       	mov    $0x1,%eax
+  800268:	e8 c6 fd ff ff       	call   800033 <pass>
+  80026d:	89 c3                	mov    %eax,%ebx
+    rms = pass(0, size, xfers[i]);
+  80026f:	89 f1                	mov    %esi,%ecx
+  800271:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800274:	b8 00 00 00 00       	mov    $0x0,%eax
+  800279:	e8 b5 fd ff ff       	call   800033 <pass>
+            size / 1024 * NPASS * 1000 / MAX(rms, 1));
+  80027e:	85 c0                	test   %eax,%eax
+  800280:	ba 01 00 00 00       	mov    $0x1,%edx
+  800285:	89 d1                	mov    %edx,%ecx
+  800287:	0f 45 c8             	cmovne %eax,%ecx
+    cprintf("iovbench: %4d KB transfers  write %5d KB/s  read %5d KB/s\n",
+  80028a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80028d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800292:	f7 f1                	div    %ecx
+  800294:	50                   	push   %eax
+            xfers[i] / 1024, size / 1024 * NPASS * 1000 / MAX(wms, 1),
+  800295:	85 db                	test   %ebx,%ebx
+  800297:	b8 01 00 00 00       	mov    $0x1,%eax
+  80029c:	0f 44 d8             	cmove  %eax,%ebx
+    cprintf("iovbench: %4d KB transfers  write %5d KB/s  read %5d KB/s\n",
+  80029f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8002a2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002a7:	f7 f3                	div    %ebx
+  8002a9:	50                   	push   %eax
+  8002aa:	c1 ee 0a             	shr    $0xa,%esi
+  8002ad:	56                   	push   %esi
+  8002ae:	68 a4 31 80 00       	push   $0x8031a4
+  8002b3:	e8 9f 01 00 00       	call   800457 <cprintf>
+  for (i = 0; i < sizeof(xfers) / sizeof(xfers[0]); i++) {
+  8002b8:	83 c7 01             	add    $0x1,%edi
+  8002bb:	83 c4 10             	add    $0x10,%esp
+  8002be:	83 ff 03             	cmp    $0x3,%edi
+  8002c1:	75 94                	jne    800257 <umain+0x84>
+  }
+
+  // Give the space back (there is no remove).
+  if ((fd = open(BIGNAME, O_RDWR | O_TRUNC)) >= 0)
+  8002c3:	83 ec 08             	sub    $0x8,%esp
+  8002c6:	68 02 02 00 00       	push   $0x202
+  8002cb:	68 2b 31 80 00       	push   $0x80312b
+  8002d0:	e8 9e 1b 00 00       	call   801e73 <open>
+  8002d5:	83 c4 10             	add    $0x10,%esp
+  8002d8:	85 c0                	test   %eax,%eax
+  8002da:	79 25                	jns    800301 <umain+0x12e>
+    close(fd);
+}
+  8002dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002df:	5b                   	pop    %ebx
+  8002e0:	5e                   	pop    %esi
+  8002e1:	5f                   	pop    %edi
+  8002e2:	5d                   	pop    %ebp
+  8002e3:	c3                   	ret
+    size = strtol(argv[1], 0, 0) * 1024;
+  8002e4:	83 ec 04             	sub    $0x4,%esp
+  8002e7:	6a 00                	push   $0x0
+  8002e9:	6a 00                	push   $0x0
+  8002eb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8002ee:	ff 70 04             	push   0x4(%eax)
+  8002f1:	e8 a3 09 00 00       	call   800c99 <strtol>
+  8002f6:	c1 e0 0a             	shl    $0xa,%eax
+  8002f9:	83 c4 10             	add    $0x10,%esp
+  8002fc:	e9 f4 fe ff ff       	jmp    8001f5 <umain+0x22>
+    close(fd);
+  800301:	83 ec 0c             	sub    $0xc,%esp
+  800304:	50                   	push   %eax
+  800305:	e8 b6 11 00 00       	call   8014c0 <close>
+  80030a:	83 c4 10             	add    $0x10,%esp
+}
+  80030d:	eb cd                	jmp    8002dc <umain+0x109>
+
+0080030f <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80030f:	55                   	push   %ebp
+  800310:	89 e5                	mov    %esp,%ebp
+  800312:	56                   	push   %esi
+  800313:	53                   	push   %ebx
+  800314:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800317:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  80031a:	c7 05 44 57 90 00 00 	movl   $0x0,0x905744
+  800321:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  800324:	e8 ca 0a 00 00       	call   800df3 <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  800329:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80032e:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800331:	c1 e0 04             	shl    $0x4,%eax
+  800334:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800339:	a3 44 57 90 00       	mov    %eax,0x905744
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  80033e:	85 db                	test   %ebx,%ebx
+  800340:	7e 07                	jle    800349 <libmain+0x3a>
+    binaryname = argv[0];
+  800342:	8b 06                	mov    (%esi),%eax
+  800344:	a3 00 40 80 00       	mov    %eax,0x804000
+
+  // call user main routine
+  umain(argc, argv);
+  800349:	83 ec 08             	sub    $0x8,%esp
+  80034c:	56                   	push   %esi
+  80034d:	53                   	push   %ebx
+  80034e:	e8 80 fe ff ff       	call   8001d3 <umain>
+
+  // exit gracefully
+  exit();
+  800353:	e8 0a 00 00 00       	call   800362 <exit>
+}
+  800358:	83 c4 10             	add    $0x10,%esp
+  80035b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80035e:	5b                   	pop    %ebx
+  80035f:	5e                   	pop    %esi
+  800360:	5d                   	pop    %ebp
+  800361:	c3                   	ret
+
+00800362 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800362:	55                   	push   %ebp
+  800363:	89 e5                	mov    %esp,%ebp
+  800365:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  800368:	e8 80 11 00 00       	call   8014ed <close_all>
+  sys_env_destroy(0);
+  80036d:	83 ec 0c             	sub    $0xc,%esp
+  800370:	6a 00                	push   $0x0
+  800372:	e8 3b 0a 00 00       	call   800db2 <sys_env_destroy>
+}
+  800377:	83 c4 10             	add    $0x10,%esp
+  80037a:	c9                   	leave
+  80037b:	c3                   	ret
+
+0080037c <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80037c:	55                   	push   %ebp
+  80037d:	89 e5                	mov    %esp,%ebp
+  80037f:	56                   	push   %esi
+  800380:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  800381:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  800384:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  80038a:	e8 64 0a 00 00       	call   800df3 <sys_getenvid>
+  80038f:	83 ec 0c             	sub    $0xc,%esp
+  800392:	ff 75 0c             	push   0xc(%ebp)
+  800395:	ff 75 08             	push   0x8(%ebp)
+  800398:	56                   	push   %esi
+  800399:	50                   	push   %eax
+  80039a:	68 f8 31 80 00       	push   $0x8031f8
+  80039f:	e8 b3 00 00 00       	call   800457 <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  8003a4:	83 c4 18             	add    $0x18,%esp
+  8003a7:	53                   	push   %ebx
+  8003a8:	ff 75 10             	push   0x10(%ebp)
+  8003ab:	e8 56 00 00 00       	call   800406 <vcprintf>
+  cprintf("\n");
+  8003b0:	c7 04 24 60 36 80 00 	movl   $0x803660,(%esp)
+  8003b7:	e8 9b 00 00 00       	call   800457 <cprintf>
+  8003bc:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  8003bf:	cc                   	int3
+  while (1)
+  8003c0:	eb fd                	jmp    8003bf <_panic+0x43>
+
+008003c2 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8003c2:	55                   	push   %ebp
+  8003c3:	89 e5                	mov    %esp,%ebp
+  8003c5:	53                   	push   %ebx
+  8003c6:	83 ec 04             	sub    $0x4,%esp
+  8003c9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  8003cc:	8b 13                	mov    (%ebx),%edx
+  8003ce:	8d 42 01             	lea    0x1(%edx),%eax
+  8003d1:	89 03                	mov    %eax,(%ebx)
+  8003d3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8003d6:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  8003da:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8003df:	74 09                	je     8003ea <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  8003e1:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8003e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8003e8:	c9                   	leave
+  8003e9:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  8003ea:	83 ec 08             	sub    $0x8,%esp
+  8003ed:	68 ff 00 00 00       	push   $0xff
+  8003f2:	8d 43 08             	lea    0x8(%ebx),%eax
+  8003f5:	50                   	push   %eax
+  8003f6:	e8 7a 09 00 00       	call   800d75 <sys_cputs>
+    b->idx = 0;
+  8003fb:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800401:	83 c4 10             	add    $0x10,%esp
+  800404:	eb db                	jmp    8003e1 <putch+0x1f>
+
+00800406 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800406:	55                   	push   %ebp
+  800407:	89 e5                	mov    %esp,%ebp
+  800409:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  80040f:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800416:	00 00 00 
+  b.cnt = 0;
+  800419:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800420:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  800423:	ff 75 0c             	push   0xc(%ebp)
+  800426:	ff 75 08             	push   0x8(%ebp)
+  800429:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80042f:	50                   	push   %eax
+  800430:	68 c2 03 80 00       	push   $0x8003c2
+  800435:	e8 14 01 00 00       	call   80054e <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  80043a:	83 c4 08             	add    $0x8,%esp
+  80043d:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800443:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800449:	50                   	push   %eax
+  80044a:	e8 26 09 00 00       	call   800d75 <sys_cputs>
+
+  return b.cnt;
+}
+  80044f:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800455:	c9                   	leave
+  800456:	c3                   	ret
+
+00800457 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800457:	55                   	push   %ebp
+  800458:	89 e5                	mov    %esp,%ebp
+  80045a:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  80045d:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  800460:	50                   	push   %eax
+  800461:	ff 75 08             	push   0x8(%ebp)
+  800464:	e8 9d ff ff ff       	call   800406 <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  800469:	c9                   	leave
+  80046a:	c3                   	ret
+
+0080046b <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  80046b:	55                   	push   %ebp
+  80046c:	89 e5                	mov    %esp,%ebp
+  80046e:	57                   	push   %edi
+  80046f:	56                   	push   %esi
+  800470:	53                   	push   %ebx
+  800471:	83 ec 1c             	sub    $0x1c,%esp
+  800474:	89 c7                	mov    %eax,%edi
+  800476:	89 d6                	mov    %edx,%esi
+  800478:	8b 45 08             	mov    0x8(%ebp),%eax
+  80047b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80047e:	89 d1                	mov    %edx,%ecx
+  800480:	89 c2                	mov    %eax,%edx
+  800482:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800485:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800488:	8b 45 10             	mov    0x10(%ebp),%eax
+  80048b:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  80048e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800491:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800498:	39 c2                	cmp    %eax,%edx
+  80049a:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80049d:	72 3e                	jb     8004dd <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  80049f:	83 ec 0c             	sub    $0xc,%esp
+  8004a2:	ff 75 18             	push   0x18(%ebp)
+  8004a5:	83 eb 01             	sub    $0x1,%ebx
+  8004a8:	53                   	push   %ebx
+  8004a9:	50                   	push   %eax
+  8004aa:	83 ec 08             	sub    $0x8,%esp
+  8004ad:	ff 75 e4             	push   -0x1c(%ebp)
+  8004b0:	ff 75 e0             	push   -0x20(%ebp)
+  8004b3:	ff 75 dc             	push   -0x24(%ebp)
+  8004b6:	ff 75 d8             	push   -0x28(%ebp)
+  8004b9:	e8 db 2a 00 00       	call   802f99 <__udivdi3>
+  8004be:	83 c4 18             	add    $0x18,%esp
+  8004c1:	52                   	push   %edx
+  8004c2:	50                   	push   %eax
+  8004c3:	89 f2                	mov    %esi,%edx
+  8004c5:	89 f8                	mov    %edi,%eax
+  8004c7:	e8 9f ff ff ff       	call   80046b <printnum>
+  8004cc:	83 c4 20             	add    $0x20,%esp
+  8004cf:	eb 13                	jmp    8004e4 <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  8004d1:	83 ec 08             	sub    $0x8,%esp
+  8004d4:	56                   	push   %esi
+  8004d5:	ff 75 18             	push   0x18(%ebp)
+  8004d8:	ff d7                	call   *%edi
+  8004da:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  8004dd:	83 eb 01             	sub    $0x1,%ebx
+  8004e0:	85 db                	test   %ebx,%ebx
+  8004e2:	7f ed                	jg     8004d1 <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  8004e4:	83 ec 08             	sub    $0x8,%esp
+  8004e7:	56                   	push   %esi
+  8004e8:	83 ec 04             	sub    $0x4,%esp
+  8004eb:	ff 75 e4             	push   -0x1c(%ebp)
+  8004ee:	ff 75 e0             	push   -0x20(%ebp)
+  8004f1:	ff 75 dc             	push   -0x24(%ebp)
+  8004f4:	ff 75 d8             	push   -0x28(%ebp)
+  8004f7:	e8 be 2a 00 00       	call   802fba <__umoddi3>
+  8004fc:	83 c4 14             	add    $0x14,%esp
+  8004ff:	0f be 80 1b 32 80 00 	movsbl 0x80321b(%eax),%eax
+  800506:	50                   	push   %eax
+  800507:	ff d7                	call   *%edi
+}
+  800509:	83 c4 10             	add    $0x10,%esp
+  80050c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80050f:	5b                   	pop    %ebx
+  800510:	5e                   	pop    %esi
+  800511:	5f                   	pop    %edi
+  800512:	5d                   	pop    %ebp
+  800513:	c3                   	ret
+
+00800514 <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800514:	55                   	push   %ebp
+  800515:	89 e5                	mov    %esp,%ebp
+  800517:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  80051a:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  80051e:	8b 10                	mov    (%eax),%edx
+  800520:	3b 50 04             	cmp    0x4(%eax),%edx
+  800523:	73 0a                	jae    80052f <sprintputch+0x1b>
+    *b->buf++ = ch;
+  800525:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800528:	89 08                	mov    %ecx,(%eax)
+  80052a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80052d:	88 02                	mov    %al,(%edx)
+}
+  80052f:	5d                   	pop    %ebp
+  800530:	c3                   	ret
+
+00800531 <printfmt>:
+{
+  800531:	55                   	push   %ebp
+  800532:	89 e5                	mov    %esp,%ebp
+  800534:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  800537:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  80053a:	50                   	push   %eax
+  80053b:	ff 75 10             	push   0x10(%ebp)
+  80053e:	ff 75 0c             	push   0xc(%ebp)
+  800541:	ff 75 08             	push   0x8(%ebp)
+  800544:	e8 05 00 00 00       	call   80054e <vprintfmt>
+}
+  800549:	83 c4 10             	add    $0x10,%esp
+  80054c:	c9                   	leave
+  80054d:	c3                   	ret
+
+0080054e <vprintfmt>:
+{
+  80054e:	55                   	push   %ebp
+  80054f:	89 e5                	mov    %esp,%ebp
+  800551:	57                   	push   %edi
+  800552:	56                   	push   %esi
+  800553:	53                   	push   %ebx
+  800554:	83 ec 2c             	sub    $0x2c,%esp
+  800557:	8b 75 08             	mov    0x8(%ebp),%esi
+  80055a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80055d:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800560:	eb 0a                	jmp    80056c <vprintfmt+0x1e>
+      putch(ch, putdat);
+  800562:	83 ec 08             	sub    $0x8,%esp
+  800565:	53                   	push   %ebx
+  800566:	50                   	push   %eax
+  800567:	ff d6                	call   *%esi
+  800569:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  80056c:	83 c7 01             	add    $0x1,%edi
+  80056f:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800573:	83 f8 25             	cmp    $0x25,%eax
+  800576:	74 0c                	je     800584 <vprintfmt+0x36>
+      if (ch == '\0')
+  800578:	85 c0                	test   %eax,%eax
+  80057a:	75 e6                	jne    800562 <vprintfmt+0x14>
+}
+  80057c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80057f:	5b                   	pop    %ebx
+  800580:	5e                   	pop    %esi
+  800581:	5f                   	pop    %edi
+  800582:	5d                   	pop    %ebp
+  800583:	c3                   	ret
+    padc = ' ';
+  800584:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  800588:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  80058f:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  800596:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  80059d:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  8005a2:	8d 47 01             	lea    0x1(%edi),%eax
+  8005a5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8005a8:	0f b6 17             	movzbl (%edi),%edx
+  8005ab:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8005ae:	3c 55                	cmp    $0x55,%al
+  8005b0:	0f 87 cf 03 00 00    	ja     800985 <vprintfmt+0x437>
+  8005b6:	0f b6 c0             	movzbl %al,%eax
+  8005b9:	ff 24 85 60 33 80 00 	jmp    *0x803360(,%eax,4)
+  8005c0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  8005c3:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8005c7:	eb d9                	jmp    8005a2 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  8005c9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8005cc:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8005d0:	eb d0                	jmp    8005a2 <vprintfmt+0x54>
+  8005d2:	0f b6 d2             	movzbl %dl,%edx
+  8005d5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  8005d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005dd:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  8005e0:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8005e3:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  8005e7:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  8005ea:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8005ed:	83 f9 09             	cmp    $0x9,%ecx
+  8005f0:	77 55                	ja     800647 <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  8005f2:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  8005f5:	eb e9                	jmp    8005e0 <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  8005f7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005fa:	8b 00                	mov    (%eax),%eax
+  8005fc:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8005ff:	8b 45 14             	mov    0x14(%ebp),%eax
+  800602:	8d 40 04             	lea    0x4(%eax),%eax
+  800605:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  800608:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  80060b:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80060f:	79 91                	jns    8005a2 <vprintfmt+0x54>
+        width = precision, precision = -1;
+  800611:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800614:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800617:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80061e:	eb 82                	jmp    8005a2 <vprintfmt+0x54>
+      if (width < 0)
+  800620:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800623:	85 d2                	test   %edx,%edx
+  800625:	b8 00 00 00 00       	mov    $0x0,%eax
+  80062a:	0f 49 c2             	cmovns %edx,%eax
+  80062d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  800630:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  800633:	e9 6a ff ff ff       	jmp    8005a2 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  800638:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  80063b:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  800642:	e9 5b ff ff ff       	jmp    8005a2 <vprintfmt+0x54>
+  800647:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80064a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80064d:	eb bc                	jmp    80060b <vprintfmt+0xbd>
+      lflag++;
+  80064f:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  800652:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  800655:	e9 48 ff ff ff       	jmp    8005a2 <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  80065a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80065d:	8d 78 04             	lea    0x4(%eax),%edi
+  800660:	83 ec 08             	sub    $0x8,%esp
+  800663:	53                   	push   %ebx
+  800664:	ff 30                	push   (%eax)
+  800666:	ff d6                	call   *%esi
+      break;
+  800668:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  80066b:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  80066e:	e9 b1 02 00 00       	jmp    800924 <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  800673:	8b 45 14             	mov    0x14(%ebp),%eax
+  800676:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  800679:	8b 10                	mov    (%eax),%edx
+  80067b:	89 d0                	mov    %edx,%eax
+  80067d:	f7 d8                	neg    %eax
+  80067f:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800682:	83 f8 10             	cmp    $0x10,%eax
+  800685:	7f 23                	jg     8006aa <vprintfmt+0x15c>
+  800687:	8b 14 85 c0 34 80 00 	mov    0x8034c0(,%eax,4),%edx
+  80068e:	85 d2                	test   %edx,%edx
+  800690:	74 18                	je     8006aa <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  800692:	52                   	push   %edx
+  800693:	68 0a 36 80 00       	push   $0x80360a
+  800698:	53                   	push   %ebx
+  800699:	56                   	push   %esi
+  80069a:	e8 92 fe ff ff       	call   800531 <printfmt>
+  80069f:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  8006a2:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8006a5:	e9 7a 02 00 00       	jmp    800924 <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  8006aa:	50                   	push   %eax
+  8006ab:	68 33 32 80 00       	push   $0x803233
+  8006b0:	53                   	push   %ebx
+  8006b1:	56                   	push   %esi
+  8006b2:	e8 7a fe ff ff       	call   800531 <printfmt>
+  8006b7:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  8006ba:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  8006bd:	e9 62 02 00 00       	jmp    800924 <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  8006c2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c5:	83 c0 04             	add    $0x4,%eax
+  8006c8:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8006cb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ce:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  8006d0:	85 c9                	test   %ecx,%ecx
+  8006d2:	b8 2c 32 80 00       	mov    $0x80322c,%eax
+  8006d7:	0f 45 c1             	cmovne %ecx,%eax
+  8006da:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  8006dd:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8006e1:	7e 06                	jle    8006e9 <vprintfmt+0x19b>
+  8006e3:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8006e7:	75 0b                	jne    8006f4 <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8006e9:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8006ec:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8006ef:	89 75 08             	mov    %esi,0x8(%ebp)
+  8006f2:	eb 5c                	jmp    800750 <vprintfmt+0x202>
+  8006f4:	83 ec 08             	sub    $0x8,%esp
+  8006f7:	ff 75 d0             	push   -0x30(%ebp)
+  8006fa:	ff 75 cc             	push   -0x34(%ebp)
+  8006fd:	e8 20 03 00 00       	call   800a22 <strnlen>
+  800702:	89 c2                	mov    %eax,%edx
+  800704:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800707:	29 d0                	sub    %edx,%eax
+  800709:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  80070c:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800710:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800713:	89 75 08             	mov    %esi,0x8(%ebp)
+  800716:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800718:	eb 0e                	jmp    800728 <vprintfmt+0x1da>
+          putch(padc, putdat);
+  80071a:	83 ec 08             	sub    $0x8,%esp
+  80071d:	53                   	push   %ebx
+  80071e:	57                   	push   %edi
+  80071f:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800722:	83 ee 01             	sub    $0x1,%esi
+  800725:	83 c4 10             	add    $0x10,%esp
+  800728:	85 f6                	test   %esi,%esi
+  80072a:	7f ee                	jg     80071a <vprintfmt+0x1cc>
+  80072c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80072f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800732:	85 c0                	test   %eax,%eax
+  800734:	ba 00 00 00 00       	mov    $0x0,%edx
+  800739:	0f 49 d0             	cmovns %eax,%edx
+  80073c:	29 d0                	sub    %edx,%eax
+  80073e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800741:	eb a6                	jmp    8006e9 <vprintfmt+0x19b>
+          putch(ch, putdat);
+  800743:	83 ec 08             	sub    $0x8,%esp
+  800746:	53                   	push   %ebx
+  800747:	52                   	push   %edx
+  800748:	ff 55 08             	call   *0x8(%ebp)
+  80074b:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80074e:	89 f1                	mov    %esi,%ecx
+  800750:	8d 71 01             	lea    0x1(%ecx),%esi
+  800753:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800757:	0f be d0             	movsbl %al,%edx
+  80075a:	85 d2                	test   %edx,%edx
+  80075c:	74 28                	je     800786 <vprintfmt+0x238>
+  80075e:	85 ff                	test   %edi,%edi
+  800760:	78 05                	js     800767 <vprintfmt+0x219>
+  800762:	83 ef 01             	sub    $0x1,%edi
+  800765:	78 30                	js     800797 <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  800767:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80076b:	74 d6                	je     800743 <vprintfmt+0x1f5>
+  80076d:	0f be c0             	movsbl %al,%eax
+  800770:	83 e8 20             	sub    $0x20,%eax
+  800773:	83 f8 5e             	cmp    $0x5e,%eax
+  800776:	76 cb                	jbe    800743 <vprintfmt+0x1f5>
+          putch('?', putdat);
+  800778:	83 ec 08             	sub    $0x8,%esp
+  80077b:	53                   	push   %ebx
+  80077c:	6a 3f                	push   $0x3f
+  80077e:	ff 55 08             	call   *0x8(%ebp)
+  800781:	83 c4 10             	add    $0x10,%esp
+  800784:	eb c8                	jmp    80074e <vprintfmt+0x200>
+  800786:	8b 75 08             	mov    0x8(%ebp),%esi
+  800789:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80078c:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80078f:	01 d0                	add    %edx,%eax
+  800791:	29 c8                	sub    %ecx,%eax
+  800793:	89 c7                	mov    %eax,%edi
+  800795:	eb 13                	jmp    8007aa <vprintfmt+0x25c>
+  800797:	8b 75 08             	mov    0x8(%ebp),%esi
+  80079a:	eb ed                	jmp    800789 <vprintfmt+0x23b>
+        putch(' ', putdat);
+  80079c:	83 ec 08             	sub    $0x8,%esp
+  80079f:	53                   	push   %ebx
+  8007a0:	6a 20                	push   $0x20
+  8007a2:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  8007a4:	83 ef 01             	sub    $0x1,%edi
+  8007a7:	83 c4 10             	add    $0x10,%esp
+  8007aa:	85 ff                	test   %edi,%edi
+  8007ac:	7f ee                	jg     80079c <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  8007ae:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8007b1:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007b4:	e9 6b 01 00 00       	jmp    800924 <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  8007b9:	83 f9 01             	cmp    $0x1,%ecx
+  8007bc:	7f 1f                	jg     8007dd <vprintfmt+0x28f>
+  else if (lflag)
+  8007be:	85 c9                	test   %ecx,%ecx
+  8007c0:	74 67                	je     800829 <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  8007c2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007c5:	8b 00                	mov    (%eax),%eax
+  8007c7:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007ca:	89 c1                	mov    %eax,%ecx
+  8007cc:	c1 f9 1f             	sar    $0x1f,%ecx
+  8007cf:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8007d2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d5:	8d 40 04             	lea    0x4(%eax),%eax
+  8007d8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007db:	eb 17                	jmp    8007f4 <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  8007dd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e0:	8b 50 04             	mov    0x4(%eax),%edx
+  8007e3:	8b 00                	mov    (%eax),%eax
+  8007e5:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007e8:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8007eb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ee:	8d 40 08             	lea    0x8(%eax),%eax
+  8007f1:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  8007f4:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8007f7:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  8007fa:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  8007ff:	85 c9                	test   %ecx,%ecx
+  800801:	0f 89 03 01 00 00    	jns    80090a <vprintfmt+0x3bc>
+        putch('-', putdat);
+  800807:	83 ec 08             	sub    $0x8,%esp
+  80080a:	53                   	push   %ebx
+  80080b:	6a 2d                	push   $0x2d
+  80080d:	ff d6                	call   *%esi
+        num = -(long long)num;
+  80080f:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800812:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800815:	f7 da                	neg    %edx
+  800817:	83 d1 00             	adc    $0x0,%ecx
+  80081a:	f7 d9                	neg    %ecx
+  80081c:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  80081f:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800824:	e9 e1 00 00 00       	jmp    80090a <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  800829:	8b 45 14             	mov    0x14(%ebp),%eax
+  80082c:	8b 00                	mov    (%eax),%eax
+  80082e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800831:	89 c1                	mov    %eax,%ecx
+  800833:	c1 f9 1f             	sar    $0x1f,%ecx
+  800836:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800839:	8b 45 14             	mov    0x14(%ebp),%eax
+  80083c:	8d 40 04             	lea    0x4(%eax),%eax
+  80083f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800842:	eb b0                	jmp    8007f4 <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  800844:	83 f9 01             	cmp    $0x1,%ecx
+  800847:	7f 1e                	jg     800867 <vprintfmt+0x319>
+  else if (lflag)
+  800849:	85 c9                	test   %ecx,%ecx
+  80084b:	74 32                	je     80087f <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  80084d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800850:	8b 10                	mov    (%eax),%edx
+  800852:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800857:	8d 40 04             	lea    0x4(%eax),%eax
+  80085a:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  80085d:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  800862:	e9 a3 00 00 00       	jmp    80090a <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800867:	8b 45 14             	mov    0x14(%ebp),%eax
+  80086a:	8b 10                	mov    (%eax),%edx
+  80086c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80086f:	8d 40 08             	lea    0x8(%eax),%eax
+  800872:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800875:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  80087a:	e9 8b 00 00 00       	jmp    80090a <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  80087f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800882:	8b 10                	mov    (%eax),%edx
+  800884:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800889:	8d 40 04             	lea    0x4(%eax),%eax
+  80088c:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  80088f:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  800894:	eb 74                	jmp    80090a <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  800896:	83 f9 01             	cmp    $0x1,%ecx
+  800899:	7f 1b                	jg     8008b6 <vprintfmt+0x368>
+  else if (lflag)
+  80089b:	85 c9                	test   %ecx,%ecx
+  80089d:	74 2c                	je     8008cb <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  80089f:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008a2:	8b 10                	mov    (%eax),%edx
+  8008a4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008a9:	8d 40 04             	lea    0x4(%eax),%eax
+  8008ac:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8008af:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  8008b4:	eb 54                	jmp    80090a <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  8008b6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008b9:	8b 10                	mov    (%eax),%edx
+  8008bb:	8b 48 04             	mov    0x4(%eax),%ecx
+  8008be:	8d 40 08             	lea    0x8(%eax),%eax
+  8008c1:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8008c4:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  8008c9:	eb 3f                	jmp    80090a <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8008cb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008ce:	8b 10                	mov    (%eax),%edx
+  8008d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008d5:	8d 40 04             	lea    0x4(%eax),%eax
+  8008d8:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8008db:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  8008e0:	eb 28                	jmp    80090a <vprintfmt+0x3bc>
+      putch('0', putdat);
+  8008e2:	83 ec 08             	sub    $0x8,%esp
+  8008e5:	53                   	push   %ebx
+  8008e6:	6a 30                	push   $0x30
+  8008e8:	ff d6                	call   *%esi
+      putch('x', putdat);
+  8008ea:	83 c4 08             	add    $0x8,%esp
+  8008ed:	53                   	push   %ebx
+  8008ee:	6a 78                	push   $0x78
+  8008f0:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  8008f2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008f5:	8b 10                	mov    (%eax),%edx
+  8008f7:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  8008fc:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  8008ff:	8d 40 04             	lea    0x4(%eax),%eax
+  800902:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800905:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  80090a:	83 ec 0c             	sub    $0xc,%esp
+  80090d:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800911:	50                   	push   %eax
+  800912:	ff 75 e0             	push   -0x20(%ebp)
+  800915:	57                   	push   %edi
+  800916:	51                   	push   %ecx
+  800917:	52                   	push   %edx
+  800918:	89 da                	mov    %ebx,%edx
+  80091a:	89 f0                	mov    %esi,%eax
+  80091c:	e8 4a fb ff ff       	call   80046b <printnum>
+      break;
+  800921:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  800924:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  800927:	e9 40 fc ff ff       	jmp    80056c <vprintfmt+0x1e>
+  if (lflag >= 2)
+  80092c:	83 f9 01             	cmp    $0x1,%ecx
+  80092f:	7f 1b                	jg     80094c <vprintfmt+0x3fe>
+  else if (lflag)
+  800931:	85 c9                	test   %ecx,%ecx
+  800933:	74 2c                	je     800961 <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  800935:	8b 45 14             	mov    0x14(%ebp),%eax
+  800938:	8b 10                	mov    (%eax),%edx
+  80093a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80093f:	8d 40 04             	lea    0x4(%eax),%eax
+  800942:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800945:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  80094a:	eb be                	jmp    80090a <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  80094c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80094f:	8b 10                	mov    (%eax),%edx
+  800951:	8b 48 04             	mov    0x4(%eax),%ecx
+  800954:	8d 40 08             	lea    0x8(%eax),%eax
+  800957:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  80095a:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  80095f:	eb a9                	jmp    80090a <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800961:	8b 45 14             	mov    0x14(%ebp),%eax
+  800964:	8b 10                	mov    (%eax),%edx
+  800966:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80096b:	8d 40 04             	lea    0x4(%eax),%eax
+  80096e:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800971:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  800976:	eb 92                	jmp    80090a <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  800978:	83 ec 08             	sub    $0x8,%esp
+  80097b:	53                   	push   %ebx
+  80097c:	6a 25                	push   $0x25
+  80097e:	ff d6                	call   *%esi
+      break;
+  800980:	83 c4 10             	add    $0x10,%esp
+  800983:	eb 9f                	jmp    800924 <vprintfmt+0x3d6>
+      putch('%', putdat);
+  800985:	83 ec 08             	sub    $0x8,%esp
+  800988:	53                   	push   %ebx
+  800989:	6a 25                	push   $0x25
+  80098b:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  80098d:	83 c4 10             	add    $0x10,%esp
+  800990:	89 f8                	mov    %edi,%eax
+  800992:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800996:	74 05                	je     80099d <vprintfmt+0x44f>
+  800998:	83 e8 01             	sub    $0x1,%eax
+  80099b:	eb f5                	jmp    800992 <vprintfmt+0x444>
+  80099d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8009a0:	eb 82                	jmp    800924 <vprintfmt+0x3d6>
+
+008009a2 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8009a2:	55                   	push   %ebp
+  8009a3:	89 e5                	mov    %esp,%ebp
+  8009a5:	83 ec 18             	sub    $0x18,%esp
+  8009a8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009ab:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  8009ae:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8009b1:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8009b5:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8009b8:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  8009bf:	85 c0                	test   %eax,%eax
+  8009c1:	74 26                	je     8009e9 <vsnprintf+0x47>
+  8009c3:	85 d2                	test   %edx,%edx
+  8009c5:	7e 22                	jle    8009e9 <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8009c7:	ff 75 14             	push   0x14(%ebp)
+  8009ca:	ff 75 10             	push   0x10(%ebp)
+  8009cd:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8009d0:	50                   	push   %eax
+  8009d1:	68 14 05 80 00       	push   $0x800514
+  8009d6:	e8 73 fb ff ff       	call   80054e <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  8009db:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8009de:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  8009e1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009e4:	83 c4 10             	add    $0x10,%esp
+}
+  8009e7:	c9                   	leave
+  8009e8:	c3                   	ret
+    return -E_INVAL;
+  8009e9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8009ee:	eb f7                	jmp    8009e7 <vsnprintf+0x45>
+
+008009f0 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8009f0:	55                   	push   %ebp
+  8009f1:	89 e5                	mov    %esp,%ebp
+  8009f3:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  8009f6:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  8009f9:	50                   	push   %eax
+  8009fa:	ff 75 10             	push   0x10(%ebp)
+  8009fd:	ff 75 0c             	push   0xc(%ebp)
+  800a00:	ff 75 08             	push   0x8(%ebp)
+  800a03:	e8 9a ff ff ff       	call   8009a2 <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  800a08:	c9                   	leave
+  800a09:	c3                   	ret
+
+00800a0a <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800a0a:	55                   	push   %ebp
+  800a0b:	89 e5                	mov    %esp,%ebp
+  800a0d:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  800a10:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a15:	eb 03                	jmp    800a1a <strlen+0x10>
+    n++;
+  800a17:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  800a1a:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800a1e:	75 f7                	jne    800a17 <strlen+0xd>
+  return n;
+}
+  800a20:	5d                   	pop    %ebp
+  800a21:	c3                   	ret
+
+00800a22 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800a22:	55                   	push   %ebp
+  800a23:	89 e5                	mov    %esp,%ebp
+  800a25:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a28:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a2b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a30:	eb 03                	jmp    800a35 <strnlen+0x13>
+    n++;
+  800a32:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a35:	39 d0                	cmp    %edx,%eax
+  800a37:	74 08                	je     800a41 <strnlen+0x1f>
+  800a39:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800a3d:	75 f3                	jne    800a32 <strnlen+0x10>
+  800a3f:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  800a41:	89 d0                	mov    %edx,%eax
+  800a43:	5d                   	pop    %ebp
+  800a44:	c3                   	ret
+
+00800a45 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800a45:	55                   	push   %ebp
+  800a46:	89 e5                	mov    %esp,%ebp
+  800a48:	53                   	push   %ebx
+  800a49:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a4c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  800a4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a54:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800a58:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800a5b:	83 c0 01             	add    $0x1,%eax
+  800a5e:	84 d2                	test   %dl,%dl
+  800a60:	75 f2                	jne    800a54 <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  800a62:	89 c8                	mov    %ecx,%eax
+  800a64:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a67:	c9                   	leave
+  800a68:	c3                   	ret
+
+00800a69 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800a69:	55                   	push   %ebp
+  800a6a:	89 e5                	mov    %esp,%ebp
+  800a6c:	53                   	push   %ebx
+  800a6d:	83 ec 10             	sub    $0x10,%esp
+  800a70:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  800a73:	53                   	push   %ebx
+  800a74:	e8 91 ff ff ff       	call   800a0a <strlen>
+  800a79:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  800a7c:	ff 75 0c             	push   0xc(%ebp)
+  800a7f:	01 d8                	add    %ebx,%eax
+  800a81:	50                   	push   %eax
+  800a82:	e8 be ff ff ff       	call   800a45 <strcpy>
+  return dst;
+}
+  800a87:	89 d8                	mov    %ebx,%eax
+  800a89:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a8c:	c9                   	leave
+  800a8d:	c3                   	ret
+
+00800a8e <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  800a8e:	55                   	push   %ebp
+  800a8f:	89 e5                	mov    %esp,%ebp
+  800a91:	56                   	push   %esi
+  800a92:	53                   	push   %ebx
+  800a93:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a96:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  800a99:	89 f3                	mov    %esi,%ebx
+  800a9b:	03 5d 10             	add    0x10(%ebp),%ebx
+  800a9e:	89 f0                	mov    %esi,%eax
+  800aa0:	eb 0f                	jmp    800ab1 <strncpy+0x23>
+    *dst++ = *src;
+  800aa2:	83 c0 01             	add    $0x1,%eax
+  800aa5:	0f b6 0a             	movzbl (%edx),%ecx
+  800aa8:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  800aab:	80 f9 01             	cmp    $0x1,%cl
+  800aae:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  800ab1:	39 d8                	cmp    %ebx,%eax
+  800ab3:	75 ed                	jne    800aa2 <strncpy+0x14>
+  }
+  return ret;
+}
+  800ab5:	89 f0                	mov    %esi,%eax
+  800ab7:	5b                   	pop    %ebx
+  800ab8:	5e                   	pop    %esi
+  800ab9:	5d                   	pop    %ebp
+  800aba:	c3                   	ret
+
+00800abb <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800abb:	55                   	push   %ebp
+  800abc:	89 e5                	mov    %esp,%ebp
+  800abe:	56                   	push   %esi
+  800abf:	53                   	push   %ebx
+  800ac0:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ac3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ac6:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  800ac9:	89 f0                	mov    %esi,%eax
+  800acb:	85 d2                	test   %edx,%edx
+  800acd:	74 21                	je     800af0 <strlcpy+0x35>
+  800acf:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800ad3:	89 f2                	mov    %esi,%edx
+  800ad5:	eb 09                	jmp    800ae0 <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  800ad7:	83 c1 01             	add    $0x1,%ecx
+  800ada:	83 c2 01             	add    $0x1,%edx
+  800add:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  800ae0:	39 c2                	cmp    %eax,%edx
+  800ae2:	74 09                	je     800aed <strlcpy+0x32>
+  800ae4:	0f b6 19             	movzbl (%ecx),%ebx
+  800ae7:	84 db                	test   %bl,%bl
+  800ae9:	75 ec                	jne    800ad7 <strlcpy+0x1c>
+  800aeb:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  800aed:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  800af0:	29 f0                	sub    %esi,%eax
+}
+  800af2:	5b                   	pop    %ebx
+  800af3:	5e                   	pop    %esi
+  800af4:	5d                   	pop    %ebp
+  800af5:	c3                   	ret
+
+00800af6 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800af6:	55                   	push   %ebp
+  800af7:	89 e5                	mov    %esp,%ebp
+  800af9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800afc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  800aff:	eb 06                	jmp    800b07 <strcmp+0x11>
+    p++, q++;
+  800b01:	83 c1 01             	add    $0x1,%ecx
+  800b04:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  800b07:	0f b6 01             	movzbl (%ecx),%eax
+  800b0a:	84 c0                	test   %al,%al
+  800b0c:	74 04                	je     800b12 <strcmp+0x1c>
+  800b0e:	3a 02                	cmp    (%edx),%al
+  800b10:	74 ef                	je     800b01 <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  800b12:	0f b6 c0             	movzbl %al,%eax
+  800b15:	0f b6 12             	movzbl (%edx),%edx
+  800b18:	29 d0                	sub    %edx,%eax
+}
+  800b1a:	5d                   	pop    %ebp
+  800b1b:	c3                   	ret
+
+00800b1c <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800b1c:	55                   	push   %ebp
+  800b1d:	89 e5                	mov    %esp,%ebp
+  800b1f:	53                   	push   %ebx
+  800b20:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b23:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b26:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  800b29:	eb 09                	jmp    800b34 <strncmp+0x18>
+    n--, p++, q++;
+  800b2b:	83 ea 01             	sub    $0x1,%edx
+  800b2e:	83 c0 01             	add    $0x1,%eax
+  800b31:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  800b34:	85 d2                	test   %edx,%edx
+  800b36:	74 18                	je     800b50 <strncmp+0x34>
+  800b38:	0f b6 18             	movzbl (%eax),%ebx
+  800b3b:	84 db                	test   %bl,%bl
+  800b3d:	74 04                	je     800b43 <strncmp+0x27>
+  800b3f:	3a 19                	cmp    (%ecx),%bl
+  800b41:	74 e8                	je     800b2b <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800b43:	0f b6 00             	movzbl (%eax),%eax
+  800b46:	0f b6 11             	movzbl (%ecx),%edx
+  800b49:	29 d0                	sub    %edx,%eax
+}
+  800b4b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b4e:	c9                   	leave
+  800b4f:	c3                   	ret
+    return 0;
+  800b50:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b55:	eb f4                	jmp    800b4b <strncmp+0x2f>
+
+00800b57 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800b57:	55                   	push   %ebp
+  800b58:	89 e5                	mov    %esp,%ebp
+  800b5a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b5d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800b61:	eb 03                	jmp    800b66 <strchr+0xf>
+  800b63:	83 c0 01             	add    $0x1,%eax
+  800b66:	0f b6 10             	movzbl (%eax),%edx
+  800b69:	84 d2                	test   %dl,%dl
+  800b6b:	74 06                	je     800b73 <strchr+0x1c>
+    if (*s == c)
+  800b6d:	38 ca                	cmp    %cl,%dl
+  800b6f:	75 f2                	jne    800b63 <strchr+0xc>
+  800b71:	eb 05                	jmp    800b78 <strchr+0x21>
+      return (char*)s;
+  return 0;
+  800b73:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b78:	5d                   	pop    %ebp
+  800b79:	c3                   	ret
+
+00800b7a <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800b7a:	55                   	push   %ebp
+  800b7b:	89 e5                	mov    %esp,%ebp
+  800b7d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b80:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800b84:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  800b87:	38 ca                	cmp    %cl,%dl
+  800b89:	74 09                	je     800b94 <strfind+0x1a>
+  800b8b:	84 d2                	test   %dl,%dl
+  800b8d:	74 05                	je     800b94 <strfind+0x1a>
+  for (; *s; s++)
+  800b8f:	83 c0 01             	add    $0x1,%eax
+  800b92:	eb f0                	jmp    800b84 <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  800b94:	5d                   	pop    %ebp
+  800b95:	c3                   	ret
+
+00800b96 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800b96:	55                   	push   %ebp
+  800b97:	89 e5                	mov    %esp,%ebp
+  800b99:	57                   	push   %edi
+  800b9a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b9d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  800ba0:	85 c9                	test   %ecx,%ecx
+  800ba2:	74 20                	je     800bc4 <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  800ba4:	89 f8                	mov    %edi,%eax
+  800ba6:	09 c8                	or     %ecx,%eax
+  800ba8:	a8 03                	test   $0x3,%al
+  800baa:	75 12                	jne    800bbe <memset+0x28>
+    c &= 0xFF;
+  800bac:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800bb0:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  800bb6:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  800bb9:	fc                   	cld
+  800bba:	f3 ab                	rep stos %eax,%es:(%edi)
+  800bbc:	eb 06                	jmp    800bc4 <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  800bbe:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800bc1:	fc                   	cld
+  800bc2:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  800bc4:	89 f8                	mov    %edi,%eax
+  800bc6:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800bc9:	c9                   	leave
+  800bca:	c3                   	ret
+
+00800bcb <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800bcb:	55                   	push   %ebp
+  800bcc:	89 e5                	mov    %esp,%ebp
+  800bce:	57                   	push   %edi
+  800bcf:	56                   	push   %esi
+  800bd0:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bd3:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800bd6:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  800bd9:	39 c6                	cmp    %eax,%esi
+  800bdb:	73 32                	jae    800c0f <memmove+0x44>
+  800bdd:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800be0:	39 d0                	cmp    %edx,%eax
+  800be2:	73 2b                	jae    800c0f <memmove+0x44>
+    s += n;
+    d += n;
+  800be4:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800be7:	89 d6                	mov    %edx,%esi
+  800be9:	09 fe                	or     %edi,%esi
+  800beb:	09 ce                	or     %ecx,%esi
+  800bed:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800bf3:	75 0e                	jne    800c03 <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800bf5:	83 ef 04             	sub    $0x4,%edi
+  800bf8:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800bfb:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  800bfe:	fd                   	std
+  800bff:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c01:	eb 09                	jmp    800c0c <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800c03:	83 ef 01             	sub    $0x1,%edi
+  800c06:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  800c09:	fd                   	std
+  800c0a:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  800c0c:	fc                   	cld
+  800c0d:	eb 1a                	jmp    800c29 <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c0f:	89 f2                	mov    %esi,%edx
+  800c11:	09 c2                	or     %eax,%edx
+  800c13:	09 ca                	or     %ecx,%edx
+  800c15:	f6 c2 03             	test   $0x3,%dl
+  800c18:	75 0a                	jne    800c24 <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800c1a:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  800c1d:	89 c7                	mov    %eax,%edi
+  800c1f:	fc                   	cld
+  800c20:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c22:	eb 05                	jmp    800c29 <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  800c24:	89 c7                	mov    %eax,%edi
+  800c26:	fc                   	cld
+  800c27:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  800c29:	5e                   	pop    %esi
+  800c2a:	5f                   	pop    %edi
+  800c2b:	5d                   	pop    %ebp
+  800c2c:	c3                   	ret
+
+00800c2d <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800c2d:	55                   	push   %ebp
+  800c2e:	89 e5                	mov    %esp,%ebp
+  800c30:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  800c33:	ff 75 10             	push   0x10(%ebp)
+  800c36:	ff 75 0c             	push   0xc(%ebp)
+  800c39:	ff 75 08             	push   0x8(%ebp)
+  800c3c:	e8 8a ff ff ff       	call   800bcb <memmove>
+}
+  800c41:	c9                   	leave
+  800c42:	c3                   	ret
+
+00800c43 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800c43:	55                   	push   %ebp
+  800c44:	89 e5                	mov    %esp,%ebp
+  800c46:	56                   	push   %esi
+  800c47:	53                   	push   %ebx
+  800c48:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c4b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  800c4e:	89 c6                	mov    %eax,%esi
+  800c50:	03 75 10             	add    0x10(%ebp),%esi
+  800c53:	eb 06                	jmp    800c5b <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  800c55:	83 c0 01             	add    $0x1,%eax
+  800c58:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  800c5b:	39 f0                	cmp    %esi,%eax
+  800c5d:	74 14                	je     800c73 <memcmp+0x30>
+    if (*s1 != *s2)
+  800c5f:	0f b6 08             	movzbl (%eax),%ecx
+  800c62:	0f b6 1a             	movzbl (%edx),%ebx
+  800c65:	38 d9                	cmp    %bl,%cl
+  800c67:	74 ec                	je     800c55 <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  800c69:	0f b6 c1             	movzbl %cl,%eax
+  800c6c:	0f b6 db             	movzbl %bl,%ebx
+  800c6f:	29 d8                	sub    %ebx,%eax
+  800c71:	eb 05                	jmp    800c78 <memcmp+0x35>
+  }
+
+  return 0;
+  800c73:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c78:	5b                   	pop    %ebx
+  800c79:	5e                   	pop    %esi
+  800c7a:	5d                   	pop    %ebp
+  800c7b:	c3                   	ret
+
+00800c7c <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800c7c:	55                   	push   %ebp
+  800c7d:	89 e5                	mov    %esp,%ebp
+  800c7f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c82:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  800c85:	89 c2                	mov    %eax,%edx
+  800c87:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  800c8a:	eb 03                	jmp    800c8f <memfind+0x13>
+  800c8c:	83 c0 01             	add    $0x1,%eax
+  800c8f:	39 d0                	cmp    %edx,%eax
+  800c91:	73 04                	jae    800c97 <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  800c93:	38 08                	cmp    %cl,(%eax)
+  800c95:	75 f5                	jne    800c8c <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  800c97:	5d                   	pop    %ebp
+  800c98:	c3                   	ret
+
+00800c99 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800c99:	55                   	push   %ebp
+  800c9a:	89 e5                	mov    %esp,%ebp
+  800c9c:	57                   	push   %edi
+  800c9d:	56                   	push   %esi
+  800c9e:	53                   	push   %ebx
+  800c9f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ca2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  800ca5:	eb 03                	jmp    800caa <strtol+0x11>
+    s++;
+  800ca7:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  800caa:	0f b6 02             	movzbl (%edx),%eax
+  800cad:	3c 20                	cmp    $0x20,%al
+  800caf:	74 f6                	je     800ca7 <strtol+0xe>
+  800cb1:	3c 09                	cmp    $0x9,%al
+  800cb3:	74 f2                	je     800ca7 <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  800cb5:	3c 2b                	cmp    $0x2b,%al
+  800cb7:	74 2a                	je     800ce3 <strtol+0x4a>
+  int neg = 0;
+  800cb9:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  800cbe:	3c 2d                	cmp    $0x2d,%al
+  800cc0:	74 2b                	je     800ced <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800cc2:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800cc8:	75 0f                	jne    800cd9 <strtol+0x40>
+  800cca:	80 3a 30             	cmpb   $0x30,(%edx)
+  800ccd:	74 28                	je     800cf7 <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  800ccf:	85 db                	test   %ebx,%ebx
+  800cd1:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800cd6:	0f 44 d8             	cmove  %eax,%ebx
+  800cd9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cde:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800ce1:	eb 46                	jmp    800d29 <strtol+0x90>
+    s++;
+  800ce3:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  800ce6:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ceb:	eb d5                	jmp    800cc2 <strtol+0x29>
+    s++, neg = 1;
+  800ced:	83 c2 01             	add    $0x1,%edx
+  800cf0:	bf 01 00 00 00       	mov    $0x1,%edi
+  800cf5:	eb cb                	jmp    800cc2 <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800cf7:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800cfb:	74 0e                	je     800d0b <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  800cfd:	85 db                	test   %ebx,%ebx
+  800cff:	75 d8                	jne    800cd9 <strtol+0x40>
+    s++, base = 8;
+  800d01:	83 c2 01             	add    $0x1,%edx
+  800d04:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800d09:	eb ce                	jmp    800cd9 <strtol+0x40>
+    s += 2, base = 16;
+  800d0b:	83 c2 02             	add    $0x2,%edx
+  800d0e:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800d13:	eb c4                	jmp    800cd9 <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  800d15:	0f be c0             	movsbl %al,%eax
+  800d18:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  800d1b:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800d1e:	7d 3a                	jge    800d5a <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  800d20:	83 c2 01             	add    $0x1,%edx
+  800d23:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800d27:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  800d29:	0f b6 02             	movzbl (%edx),%eax
+  800d2c:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800d2f:	89 f3                	mov    %esi,%ebx
+  800d31:	80 fb 09             	cmp    $0x9,%bl
+  800d34:	76 df                	jbe    800d15 <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  800d36:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800d39:	89 f3                	mov    %esi,%ebx
+  800d3b:	80 fb 19             	cmp    $0x19,%bl
+  800d3e:	77 08                	ja     800d48 <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  800d40:	0f be c0             	movsbl %al,%eax
+  800d43:	83 e8 57             	sub    $0x57,%eax
+  800d46:	eb d3                	jmp    800d1b <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  800d48:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800d4b:	89 f3                	mov    %esi,%ebx
+  800d4d:	80 fb 19             	cmp    $0x19,%bl
+  800d50:	77 08                	ja     800d5a <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  800d52:	0f be c0             	movsbl %al,%eax
+  800d55:	83 e8 37             	sub    $0x37,%eax
+  800d58:	eb c1                	jmp    800d1b <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  800d5a:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800d5e:	74 05                	je     800d65 <strtol+0xcc>
+    *endptr = (char*)s;
+  800d60:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d63:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  800d65:	89 c8                	mov    %ecx,%eax
+  800d67:	f7 d8                	neg    %eax
+  800d69:	85 ff                	test   %edi,%edi
+  800d6b:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800d6e:	89 c8                	mov    %ecx,%eax
+  800d70:	5b                   	pop    %ebx
+  800d71:	5e                   	pop    %esi
+  800d72:	5f                   	pop    %edi
+  800d73:	5d                   	pop    %ebp
+  800d74:	c3                   	ret
+
+00800d75 <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800d75:	55                   	push   %ebp
+  800d76:	89 e5                	mov    %esp,%ebp
+  800d78:	57                   	push   %edi
+  800d79:	56                   	push   %esi
+  800d7a:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d80:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d83:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d86:	89 c3                	mov    %eax,%ebx
+  800d88:	89 c7                	mov    %eax,%edi
+  800d8a:	89 c6                	mov    %eax,%esi
+  800d8c:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800d8e:	5b                   	pop    %ebx
+  800d8f:	5e                   	pop    %esi
+  800d90:	5f                   	pop    %edi
+  800d91:	5d                   	pop    %ebp
+  800d92:	c3                   	ret
+
+00800d93 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800d93:	55                   	push   %ebp
+  800d94:	89 e5                	mov    %esp,%ebp
+  800d96:	57                   	push   %edi
+  800d97:	56                   	push   %esi
+  800d98:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d99:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d9e:	b8 01 00 00 00       	mov    $0x1,%eax
+  800da3:	89 d1                	mov    %edx,%ecx
+  800da5:	89 d3                	mov    %edx,%ebx
+  800da7:	89 d7                	mov    %edx,%edi
+  800da9:	89 d6                	mov    %edx,%esi
+  800dab:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800dad:	5b                   	pop    %ebx
+  800dae:	5e                   	pop    %esi
+  800daf:	5f                   	pop    %edi
+  800db0:	5d                   	pop    %ebp
+  800db1:	c3                   	ret
+
+00800db2 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800db2:	55                   	push   %ebp
+  800db3:	89 e5                	mov    %esp,%ebp
+  800db5:	57                   	push   %edi
+  800db6:	56                   	push   %esi
+  800db7:	53                   	push   %ebx
+  800db8:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800dbb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800dc0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dc3:	b8 03 00 00 00       	mov    $0x3,%eax
+  800dc8:	89 cb                	mov    %ecx,%ebx
+  800dca:	89 cf                	mov    %ecx,%edi
+  800dcc:	89 ce                	mov    %ecx,%esi
+  800dce:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800dd0:	85 c0                	test   %eax,%eax
+  800dd2:	7f 08                	jg     800ddc <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800dd4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dd7:	5b                   	pop    %ebx
+  800dd8:	5e                   	pop    %esi
+  800dd9:	5f                   	pop    %edi
+  800dda:	5d                   	pop    %ebp
+  800ddb:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ddc:	83 ec 0c             	sub    $0xc,%esp
+  800ddf:	50                   	push   %eax
+  800de0:	6a 03                	push   $0x3
+  800de2:	68 23 35 80 00       	push   $0x803523
+  800de7:	6a 23                	push   $0x23
+  800de9:	68 40 35 80 00       	push   $0x803540
+  800dee:	e8 89 f5 ff ff       	call   80037c <_panic>
+
+00800df3 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800df3:	55                   	push   %ebp
+  800df4:	89 e5                	mov    %esp,%ebp
+  800df6:	57                   	push   %edi
+  800df7:	56                   	push   %esi
+  800df8:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800df9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dfe:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e03:	89 d1                	mov    %edx,%ecx
+  800e05:	89 d3                	mov    %edx,%ebx
+  800e07:	89 d7                	mov    %edx,%edi
+  800e09:	89 d6                	mov    %edx,%esi
+  800e0b:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800e0d:	5b                   	pop    %ebx
+  800e0e:	5e                   	pop    %esi
+  800e0f:	5f                   	pop    %edi
+  800e10:	5d                   	pop    %ebp
+  800e11:	c3                   	ret
+
+00800e12 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800e12:	55                   	push   %ebp
+  800e13:	89 e5                	mov    %esp,%ebp
+  800e15:	57                   	push   %edi
+  800e16:	56                   	push   %esi
+  800e17:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e18:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e1d:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e22:	89 d1                	mov    %edx,%ecx
+  800e24:	89 d3                	mov    %edx,%ebx
+  800e26:	89 d7                	mov    %edx,%edi
+  800e28:	89 d6                	mov    %edx,%esi
+  800e2a:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800e2c:	5b                   	pop    %ebx
+  800e2d:	5e                   	pop    %esi
+  800e2e:	5f                   	pop    %edi
+  800e2f:	5d                   	pop    %ebp
+  800e30:	c3                   	ret
+
+00800e31 <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  800e31:	55                   	push   %ebp
+  800e32:	89 e5                	mov    %esp,%ebp
+  800e34:	57                   	push   %edi
+  800e35:	56                   	push   %esi
+  800e36:	53                   	push   %ebx
+  800e37:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  800e3a:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  800e3e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e43:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e46:	b8 14 00 00 00       	mov    $0x14,%eax
+  800e4b:	89 df                	mov    %ebx,%edi
+  800e4d:	89 de                	mov    %ebx,%esi
+  800e4f:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e51:	85 c0                	test   %eax,%eax
+  800e53:	7f 08                	jg     800e5d <sys_env_set_cow+0x2c>
+}
+  800e55:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e58:	5b                   	pop    %ebx
+  800e59:	5e                   	pop    %esi
+  800e5a:	5f                   	pop    %edi
+  800e5b:	5d                   	pop    %ebp
+  800e5c:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e5d:	83 ec 0c             	sub    $0xc,%esp
+  800e60:	50                   	push   %eax
+  800e61:	6a 14                	push   $0x14
+  800e63:	68 23 35 80 00       	push   $0x803523
+  800e68:	6a 23                	push   $0x23
+  800e6a:	68 40 35 80 00       	push   $0x803540
+  800e6f:	e8 08 f5 ff ff       	call   80037c <_panic>
+
+00800e74 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800e74:	55                   	push   %ebp
+  800e75:	89 e5                	mov    %esp,%ebp
+  800e77:	57                   	push   %edi
+  800e78:	56                   	push   %esi
+  800e79:	53                   	push   %ebx
+  800e7a:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e7d:	be 00 00 00 00       	mov    $0x0,%esi
+  800e82:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e85:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e88:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e8d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e90:	89 f7                	mov    %esi,%edi
+  800e92:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e94:	85 c0                	test   %eax,%eax
+  800e96:	7f 08                	jg     800ea0 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  800e98:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e9b:	5b                   	pop    %ebx
+  800e9c:	5e                   	pop    %esi
+  800e9d:	5f                   	pop    %edi
+  800e9e:	5d                   	pop    %ebp
+  800e9f:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ea0:	83 ec 0c             	sub    $0xc,%esp
+  800ea3:	50                   	push   %eax
+  800ea4:	6a 04                	push   $0x4
+  800ea6:	68 23 35 80 00       	push   $0x803523
+  800eab:	6a 23                	push   $0x23
+  800ead:	68 40 35 80 00       	push   $0x803540
+  800eb2:	e8 c5 f4 ff ff       	call   80037c <_panic>
+
+00800eb7 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800eb7:	55                   	push   %ebp
+  800eb8:	89 e5                	mov    %esp,%ebp
+  800eba:	57                   	push   %edi
+  800ebb:	56                   	push   %esi
+  800ebc:	53                   	push   %ebx
+  800ebd:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800ec0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ec6:	b8 05 00 00 00       	mov    $0x5,%eax
+  800ecb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ece:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ed1:	8b 75 18             	mov    0x18(%ebp),%esi
+  800ed4:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ed6:	85 c0                	test   %eax,%eax
+  800ed8:	7f 08                	jg     800ee2 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  800eda:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800edd:	5b                   	pop    %ebx
+  800ede:	5e                   	pop    %esi
+  800edf:	5f                   	pop    %edi
+  800ee0:	5d                   	pop    %ebp
+  800ee1:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ee2:	83 ec 0c             	sub    $0xc,%esp
+  800ee5:	50                   	push   %eax
+  800ee6:	6a 05                	push   $0x5
+  800ee8:	68 23 35 80 00       	push   $0x803523
+  800eed:	6a 23                	push   $0x23
+  800eef:	68 40 35 80 00       	push   $0x803540
+  800ef4:	e8 83 f4 ff ff       	call   80037c <_panic>
+
+00800ef9 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800ef9:	55                   	push   %ebp
+  800efa:	89 e5                	mov    %esp,%ebp
+  800efc:	57                   	push   %edi
+  800efd:	56                   	push   %esi
+  800efe:	53                   	push   %ebx
+  800eff:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f02:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f07:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f0a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f0d:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f12:	89 df                	mov    %ebx,%edi
+  800f14:	89 de                	mov    %ebx,%esi
+  800f16:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f18:	85 c0                	test   %eax,%eax
+  800f1a:	7f 08                	jg     800f24 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  800f1c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f1f:	5b                   	pop    %ebx
+  800f20:	5e                   	pop    %esi
+  800f21:	5f                   	pop    %edi
+  800f22:	5d                   	pop    %ebp
+  800f23:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f24:	83 ec 0c             	sub    $0xc,%esp
+  800f27:	50                   	push   %eax
+  800f28:	6a 06                	push   $0x6
+  800f2a:	68 23 35 80 00       	push   $0x803523
+  800f2f:	6a 23                	push   $0x23
+  800f31:	68 40 35 80 00       	push   $0x803540
+  800f36:	e8 41 f4 ff ff       	call   80037c <_panic>
+
+00800f3b <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  800f3b:	55                   	push   %ebp
+  800f3c:	89 e5                	mov    %esp,%ebp
+  800f3e:	57                   	push   %edi
+  800f3f:	56                   	push   %esi
+  800f40:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f41:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f44:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f47:	b8 11 00 00 00       	mov    $0x11,%eax
+  800f4c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f4f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f52:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f55:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  800f57:	5b                   	pop    %ebx
+  800f58:	5e                   	pop    %esi
+  800f59:	5f                   	pop    %edi
+  800f5a:	5d                   	pop    %ebp
+  800f5b:	c3                   	ret
+
+00800f5c <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  800f5c:	55                   	push   %ebp
+  800f5d:	89 e5                	mov    %esp,%ebp
+  800f5f:	57                   	push   %edi
+  800f60:	56                   	push   %esi
+  800f61:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f62:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f65:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f68:	b8 12 00 00 00       	mov    $0x12,%eax
+  800f6d:	be 00 00 00 00       	mov    $0x0,%esi
+  800f72:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f75:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f78:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  800f7a:	5b                   	pop    %ebx
+  800f7b:	5e                   	pop    %esi
+  800f7c:	5f                   	pop    %edi
+  800f7d:	5d                   	pop    %ebp
+  800f7e:	c3                   	ret
+
+00800f7f <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  800f7f:	55                   	push   %ebp
+  800f80:	89 e5                	mov    %esp,%ebp
+  800f82:	57                   	push   %edi
+  800f83:	56                   	push   %esi
+  800f84:	53                   	push   %ebx
+  800f85:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f88:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f8d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f90:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f93:	b8 16 00 00 00       	mov    $0x16,%eax
+  800f98:	89 df                	mov    %ebx,%edi
+  800f9a:	89 de                	mov    %ebx,%esi
+  800f9c:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f9e:	85 c0                	test   %eax,%eax
+  800fa0:	7f 08                	jg     800faa <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  800fa2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fa5:	5b                   	pop    %ebx
+  800fa6:	5e                   	pop    %esi
+  800fa7:	5f                   	pop    %edi
+  800fa8:	5d                   	pop    %ebp
+  800fa9:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800faa:	83 ec 0c             	sub    $0xc,%esp
+  800fad:	50                   	push   %eax
+  800fae:	6a 16                	push   $0x16
+  800fb0:	68 23 35 80 00       	push   $0x803523
+  800fb5:	6a 23                	push   $0x23
+  800fb7:	68 40 35 80 00       	push   $0x803540
+  800fbc:	e8 bb f3 ff ff       	call   80037c <_panic>
+
+00800fc1 <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  800fc1:	55                   	push   %ebp
+  800fc2:	89 e5                	mov    %esp,%ebp
+  800fc4:	57                   	push   %edi
+  800fc5:	56                   	push   %esi
+  800fc6:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800fc7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fcc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fcf:	b8 17 00 00 00       	mov    $0x17,%eax
+  800fd4:	89 cb                	mov    %ecx,%ebx
+  800fd6:	89 cf                	mov    %ecx,%edi
+  800fd8:	89 ce                	mov    %ecx,%esi
+  800fda:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  800fdc:	5b                   	pop    %ebx
+  800fdd:	5e                   	pop    %esi
+  800fde:	5f                   	pop    %edi
+  800fdf:	5d                   	pop    %ebp
+  800fe0:	c3                   	ret
+
+00800fe1 <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  800fe1:	55                   	push   %ebp
+  800fe2:	89 e5                	mov    %esp,%ebp
+  800fe4:	57                   	push   %edi
+  800fe5:	56                   	push   %esi
+  800fe6:	53                   	push   %ebx
+  800fe7:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800fea:	be 00 00 00 00       	mov    $0x0,%esi
+  800fef:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ff2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ff5:	b8 18 00 00 00       	mov    $0x18,%eax
+  800ffa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ffd:	89 f7                	mov    %esi,%edi
+  800fff:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801001:	85 c0                	test   %eax,%eax
+  801003:	7f 08                	jg     80100d <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  801005:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801008:	5b                   	pop    %ebx
+  801009:	5e                   	pop    %esi
+  80100a:	5f                   	pop    %edi
+  80100b:	5d                   	pop    %ebp
+  80100c:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80100d:	83 ec 0c             	sub    $0xc,%esp
+  801010:	50                   	push   %eax
+  801011:	6a 18                	push   $0x18
+  801013:	68 23 35 80 00       	push   $0x803523
+  801018:	6a 23                	push   $0x23
+  80101a:	68 40 35 80 00       	push   $0x803540
+  80101f:	e8 58 f3 ff ff       	call   80037c <_panic>
+
+00801024 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  801024:	55                   	push   %ebp
+  801025:	89 e5                	mov    %esp,%ebp
+  801027:	57                   	push   %edi
+  801028:	56                   	push   %esi
+  801029:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80102a:	be 00 00 00 00       	mov    $0x0,%esi
+  80102f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801032:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801035:	b8 19 00 00 00       	mov    $0x19,%eax
+  80103a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80103d:	89 f7                	mov    %esi,%edi
+  80103f:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  801041:	5b                   	pop    %ebx
+  801042:	5e                   	pop    %esi
+  801043:	5f                   	pop    %edi
+  801044:	5d                   	pop    %ebp
+  801045:	c3                   	ret
+
+00801046 <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  801046:	55                   	push   %ebp
+  801047:	89 e5                	mov    %esp,%ebp
+  801049:	57                   	push   %edi
+  80104a:	56                   	push   %esi
+  80104b:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80104c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801051:	b8 15 00 00 00       	mov    $0x15,%eax
+  801056:	89 d1                	mov    %edx,%ecx
+  801058:	89 d3                	mov    %edx,%ebx
+  80105a:	89 d7                	mov    %edx,%edi
+  80105c:	89 d6                	mov    %edx,%esi
+  80105e:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  801060:	5b                   	pop    %ebx
+  801061:	5e                   	pop    %esi
+  801062:	5f                   	pop    %edi
+  801063:	5d                   	pop    %ebp
+  801064:	c3                   	ret
+
+00801065 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801065:	55                   	push   %ebp
+  801066:	89 e5                	mov    %esp,%ebp
+  801068:	57                   	push   %edi
+  801069:	56                   	push   %esi
+  80106a:	53                   	push   %ebx
+  80106b:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80106e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801073:	8b 55 08             	mov    0x8(%ebp),%edx
+  801076:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801079:	b8 08 00 00 00       	mov    $0x8,%eax
+  80107e:	89 df                	mov    %ebx,%edi
+  801080:	89 de                	mov    %ebx,%esi
+  801082:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801084:	85 c0                	test   %eax,%eax
+  801086:	7f 08                	jg     801090 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801088:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80108b:	5b                   	pop    %ebx
+  80108c:	5e                   	pop    %esi
+  80108d:	5f                   	pop    %edi
+  80108e:	5d                   	pop    %ebp
+  80108f:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801090:	83 ec 0c             	sub    $0xc,%esp
+  801093:	50                   	push   %eax
+  801094:	6a 08                	push   $0x8
+  801096:	68 23 35 80 00       	push   $0x803523
+  80109b:	6a 23                	push   $0x23
+  80109d:	68 40 35 80 00       	push   $0x803540
+  8010a2:	e8 d5 f2 ff ff       	call   80037c <_panic>
+
+008010a7 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8010a7:	55                   	push   %ebp
+  8010a8:	89 e5                	mov    %esp,%ebp
+  8010aa:	57                   	push   %edi
+  8010ab:	56                   	push   %esi
+  8010ac:	53                   	push   %ebx
+  8010ad:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8010b0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010b5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010bb:	b8 09 00 00 00       	mov    $0x9,%eax
+  8010c0:	89 df                	mov    %ebx,%edi
+  8010c2:	89 de                	mov    %ebx,%esi
+  8010c4:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8010c6:	85 c0                	test   %eax,%eax
+  8010c8:	7f 08                	jg     8010d2 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  8010ca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010cd:	5b                   	pop    %ebx
+  8010ce:	5e                   	pop    %esi
+  8010cf:	5f                   	pop    %edi
+  8010d0:	5d                   	pop    %ebp
+  8010d1:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8010d2:	83 ec 0c             	sub    $0xc,%esp
+  8010d5:	50                   	push   %eax
+  8010d6:	6a 09                	push   $0x9
+  8010d8:	68 23 35 80 00       	push   $0x803523
+  8010dd:	6a 23                	push   $0x23
+  8010df:	68 40 35 80 00       	push   $0x803540
+  8010e4:	e8 93 f2 ff ff       	call   80037c <_panic>
+
+008010e9 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8010e9:	55                   	push   %ebp
+  8010ea:	89 e5                	mov    %esp,%ebp
+  8010ec:	57                   	push   %edi
+  8010ed:	56                   	push   %esi
+  8010ee:	53                   	push   %ebx
+  8010ef:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8010f2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010f7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010fa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010fd:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801102:	89 df                	mov    %ebx,%edi
+  801104:	89 de                	mov    %ebx,%esi
+  801106:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801108:	85 c0                	test   %eax,%eax
+  80110a:	7f 08                	jg     801114 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  80110c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80110f:	5b                   	pop    %ebx
+  801110:	5e                   	pop    %esi
+  801111:	5f                   	pop    %edi
+  801112:	5d                   	pop    %ebp
+  801113:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801114:	83 ec 0c             	sub    $0xc,%esp
+  801117:	50                   	push   %eax
+  801118:	6a 0a                	push   $0xa
+  80111a:	68 23 35 80 00       	push   $0x803523
+  80111f:	6a 23                	push   $0x23
+  801121:	68 40 35 80 00       	push   $0x803540
+  801126:	e8 51 f2 ff ff       	call   80037c <_panic>
+
+0080112b <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  80112b:	55                   	push   %ebp
+  80112c:	89 e5                	mov    %esp,%ebp
+  80112e:	57                   	push   %edi
+  80112f:	56                   	push   %esi
+  801130:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801131:	8b 55 08             	mov    0x8(%ebp),%edx
+  801134:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801137:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80113c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80113f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801142:	8b 75 18             	mov    0x18(%ebp),%esi
+  801145:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  801147:	5b                   	pop    %ebx
+  801148:	5e                   	pop    %esi
+  801149:	5f                   	pop    %edi
+  80114a:	5d                   	pop    %ebp
+  80114b:	c3                   	ret
+
+0080114c <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  80114c:	55                   	push   %ebp
+  80114d:	89 e5                	mov    %esp,%ebp
+  80114f:	57                   	push   %edi
+  801150:	56                   	push   %esi
+  801151:	53                   	push   %ebx
+  801152:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801155:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80115a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80115d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801160:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801165:	89 df                	mov    %ebx,%edi
+  801167:	89 de                	mov    %ebx,%esi
+  801169:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80116b:	85 c0                	test   %eax,%eax
+  80116d:	7f 08                	jg     801177 <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  80116f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801172:	5b                   	pop    %ebx
+  801173:	5e                   	pop    %esi
+  801174:	5f                   	pop    %edi
+  801175:	5d                   	pop    %ebp
+  801176:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801177:	83 ec 0c             	sub    $0xc,%esp
+  80117a:	50                   	push   %eax
+  80117b:	6a 0d                	push   $0xd
+  80117d:	68 23 35 80 00       	push   $0x803523
+  801182:	6a 23                	push   $0x23
+  801184:	68 40 35 80 00       	push   $0x803540
+  801189:	e8 ee f1 ff ff       	call   80037c <_panic>
+
+0080118e <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  80118e:	55                   	push   %ebp
+  80118f:	89 e5                	mov    %esp,%ebp
+  801191:	57                   	push   %edi
+  801192:	56                   	push   %esi
+  801193:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801194:	ba 00 00 00 00       	mov    $0x0,%edx
+  801199:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80119e:	89 d1                	mov    %edx,%ecx
+  8011a0:	89 d3                	mov    %edx,%ebx
+  8011a2:	89 d7                	mov    %edx,%edi
+  8011a4:	89 d6                	mov    %edx,%esi
+  8011a6:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8011a8:	5b                   	pop    %ebx
+  8011a9:	5e                   	pop    %esi
+  8011aa:	5f                   	pop    %edi
+  8011ab:	5d                   	pop    %ebp
+  8011ac:	c3                   	ret
+
+008011ad <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  8011ad:	55                   	push   %ebp
+  8011ae:	89 e5                	mov    %esp,%ebp
+  8011b0:	57                   	push   %edi
+  8011b1:	56                   	push   %esi
+  8011b2:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8011b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011b6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011b9:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8011be:	be 00 00 00 00       	mov    $0x0,%esi
+  8011c3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011c6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011c9:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  8011cb:	5b                   	pop    %ebx
+  8011cc:	5e                   	pop    %esi
+  8011cd:	5f                   	pop    %edi
+  8011ce:	5d                   	pop    %ebp
+  8011cf:	c3                   	ret
+
+008011d0 <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  8011d0:	55                   	push   %ebp
+  8011d1:	89 e5                	mov    %esp,%ebp
+  8011d3:	57                   	push   %edi
+  8011d4:	56                   	push   %esi
+  8011d5:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8011d6:	be 00 00 00 00       	mov    $0x0,%esi
+  8011db:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011de:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011e1:	b8 10 00 00 00       	mov    $0x10,%eax
+  8011e6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011e9:	89 f7                	mov    %esi,%edi
+  8011eb:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  8011ed:	5b                   	pop    %ebx
+  8011ee:	5e                   	pop    %esi
+  8011ef:	5f                   	pop    %edi
+  8011f0:	5d                   	pop    %ebp
+  8011f1:	c3                   	ret
+
+008011f2 <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  8011f2:	55                   	push   %ebp
+  8011f3:	89 e5                	mov    %esp,%ebp
+  8011f5:	57                   	push   %edi
+  8011f6:	56                   	push   %esi
+  8011f7:	53                   	push   %ebx
+  8011f8:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  8011fb:	80 3d 48 57 90 00 00 	cmpb   $0x0,0x905748
+  801202:	74 41                	je     801245 <sys_batch+0x53>
+  801204:	8b 45 08             	mov    0x8(%ebp),%eax
+  801207:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  80120a:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  801211:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801214:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  801217:	7d 45                	jge    80125e <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  801219:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80121c:	8b 06                	mov    (%esi),%eax
+  80121e:	8b 56 04             	mov    0x4(%esi),%edx
+  801221:	8b 4e 08             	mov    0x8(%esi),%ecx
+  801224:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  801227:	8b 7e 10             	mov    0x10(%esi),%edi
+  80122a:	8b 76 14             	mov    0x14(%esi),%esi
+  80122d:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  80122f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801232:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  801235:	83 c6 1c             	add    $0x1c,%esi
+  801238:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  80123b:	85 c0                	test   %eax,%eax
+  80123d:	78 1f                	js     80125e <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  80123f:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  801243:	eb cc                	jmp    801211 <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  801245:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80124a:	b8 13 00 00 00       	mov    $0x13,%eax
+  80124f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801252:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801255:	89 df                	mov    %ebx,%edi
+  801257:	89 de                	mov    %ebx,%esi
+  801259:	cd 30                	int    $0x30
+  80125b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  80125e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801261:	83 c4 08             	add    $0x8,%esp
+  801264:	5b                   	pop    %ebx
+  801265:	5e                   	pop    %esi
+  801266:	5f                   	pop    %edi
+  801267:	5d                   	pop    %ebp
+  801268:	c3                   	ret
+
+00801269 <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  801269:	55                   	push   %ebp
+  80126a:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  80126c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80126f:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  801275:	5d                   	pop    %ebp
+  801276:	c3                   	ret
+
+00801277 <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  801277:	55                   	push   %ebp
+  801278:	89 e5                	mov    %esp,%ebp
+  80127a:	56                   	push   %esi
+  80127b:	53                   	push   %ebx
+  80127c:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  80127f:	8b 1e                	mov    (%esi),%ebx
+  801281:	85 db                	test   %ebx,%ebx
+  801283:	75 09                	jne    80128e <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  801285:	89 d8                	mov    %ebx,%eax
+  801287:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80128a:	5b                   	pop    %ebx
+  80128b:	5e                   	pop    %esi
+  80128c:	5d                   	pop    %ebp
+  80128d:	c3                   	ret
+  b->sb_n = 0;
+  80128e:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  801294:	53                   	push   %ebx
+  801295:	8d 46 04             	lea    0x4(%esi),%eax
+  801298:	50                   	push   %eax
+  801299:	e8 54 ff ff ff       	call   8011f2 <sys_batch>
+  80129e:	83 c4 08             	add    $0x8,%esp
+  8012a1:	85 c0                	test   %eax,%eax
+  8012a3:	78 1e                	js     8012c3 <sysbatch_flush+0x4c>
+  if (r < n)
+  8012a5:	39 c3                	cmp    %eax,%ebx
+  8012a7:	7f 07                	jg     8012b0 <sysbatch_flush+0x39>
+  return 0;
+  8012a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012ae:	eb d5                	jmp    801285 <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  8012b0:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8012b3:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  8012b7:	85 db                	test   %ebx,%ebx
+  8012b9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012be:	0f 49 d8             	cmovns %eax,%ebx
+  8012c1:	eb c2                	jmp    801285 <sysbatch_flush+0xe>
+    return r;
+  8012c3:	89 c3                	mov    %eax,%ebx
+  8012c5:	eb be                	jmp    801285 <sysbatch_flush+0xe>
+
+008012c7 <sysbatch_add>:
+{
+  8012c7:	55                   	push   %ebp
+  8012c8:	89 e5                	mov    %esp,%ebp
+  8012ca:	53                   	push   %ebx
+  8012cb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  8012ce:	83 3b 40             	cmpl   $0x40,(%ebx)
+  8012d1:	74 41                	je     801314 <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  8012d3:	8b 03                	mov    (%ebx),%eax
+  8012d5:	8d 50 01             	lea    0x1(%eax),%edx
+  8012d8:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  8012da:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8012dd:	01 d8                	add    %ebx,%eax
+  8012df:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8012e2:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  8012e5:	8b 55 10             	mov    0x10(%ebp),%edx
+  8012e8:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  8012eb:	8b 55 14             	mov    0x14(%ebp),%edx
+  8012ee:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  8012f1:	8b 55 18             	mov    0x18(%ebp),%edx
+  8012f4:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  8012f7:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  8012fa:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  8012fd:	8b 55 20             	mov    0x20(%ebp),%edx
+  801300:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  801303:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  80130a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80130f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801312:	c9                   	leave
+  801313:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  801314:	53                   	push   %ebx
+  801315:	e8 5d ff ff ff       	call   801277 <sysbatch_flush>
+  80131a:	83 c4 04             	add    $0x4,%esp
+  80131d:	85 c0                	test   %eax,%eax
+  80131f:	79 b2                	jns    8012d3 <sysbatch_add+0xc>
+  801321:	eb ec                	jmp    80130f <sysbatch_add+0x48>
+
+00801323 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801323:	55                   	push   %ebp
+  801324:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801326:	8b 45 08             	mov    0x8(%ebp),%eax
+  801329:	05 00 00 00 30       	add    $0x30000000,%eax
+  80132e:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801331:	5d                   	pop    %ebp
+  801332:	c3                   	ret
+
+00801333 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801333:	55                   	push   %ebp
+  801334:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801336:	8b 45 08             	mov    0x8(%ebp),%eax
+  801339:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  80133c:	66 b8 00 00          	mov    $0x0,%ax
+  801340:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801345:	5d                   	pop    %ebp
+  801346:	c3                   	ret
+
+00801347 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801347:	55                   	push   %ebp
+  801348:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  80134a:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80134f:	eb 02                	jmp    801353 <fd_alloc+0xc>
+  801351:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801353:	89 c2                	mov    %eax,%edx
+  801355:	c1 ea 16             	shr    $0x16,%edx
+  801358:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80135f:	f6 c2 01             	test   $0x1,%dl
+  801362:	74 2b                	je     80138f <fd_alloc+0x48>
+  801364:	89 c2                	mov    %eax,%edx
+  801366:	c1 ea 0c             	shr    $0xc,%edx
+  801369:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801370:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801376:	f6 c1 01             	test   $0x1,%cl
+  801379:	74 14                	je     80138f <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  80137b:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801381:	75 ce                	jne    801351 <fd_alloc+0xa>
+  801383:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  801388:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80138d:	eb 05                	jmp    801394 <fd_alloc+0x4d>
+      return 0;
+  80138f:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  801394:	8b 55 08             	mov    0x8(%ebp),%edx
+  801397:	89 02                	mov    %eax,(%edx)
+}
+  801399:	89 c8                	mov    %ecx,%eax
+  80139b:	5d                   	pop    %ebp
+  80139c:	c3                   	ret
+
+0080139d <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80139d:	55                   	push   %ebp
+  80139e:	89 e5                	mov    %esp,%ebp
+  8013a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  8013a3:	83 f8 1f             	cmp    $0x1f,%eax
+  8013a6:	77 30                	ja     8013d8 <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  8013a8:	c1 e0 0c             	shl    $0xc,%eax
+  8013ab:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8013b0:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8013b6:	f6 c2 01             	test   $0x1,%dl
+  8013b9:	74 24                	je     8013df <fd_lookup+0x42>
+  8013bb:	89 c2                	mov    %eax,%edx
+  8013bd:	c1 ea 0c             	shr    $0xc,%edx
+  8013c0:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8013c7:	f6 c2 01             	test   $0x1,%dl
+  8013ca:	74 1a                	je     8013e6 <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  8013cc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8013cf:	89 02                	mov    %eax,(%edx)
+  return 0;
+  8013d1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013d6:	5d                   	pop    %ebp
+  8013d7:	c3                   	ret
+    return -E_INVAL;
+  8013d8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013dd:	eb f7                	jmp    8013d6 <fd_lookup+0x39>
+    return -E_INVAL;
+  8013df:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013e4:	eb f0                	jmp    8013d6 <fd_lookup+0x39>
+  8013e6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013eb:	eb e9                	jmp    8013d6 <fd_lookup+0x39>
+
+008013ed <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8013ed:	55                   	push   %ebp
+  8013ee:	89 e5                	mov    %esp,%ebp
+  8013f0:	53                   	push   %ebx
+  8013f1:	83 ec 04             	sub    $0x4,%esp
+  8013f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  8013f7:	b8 cc 35 80 00       	mov    $0x8035cc,%eax
+  8013fc:	8b 18                	mov    (%eax),%ebx
+  8013fe:	85 db                	test   %ebx,%ebx
+  801400:	74 0e                	je     801410 <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  801402:	83 c0 04             	add    $0x4,%eax
+  801405:	39 13                	cmp    %edx,(%ebx)
+  801407:	75 f3                	jne    8013fc <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  801409:	b8 00 00 00 00       	mov    $0x0,%eax
+  80140e:	eb 1f                	jmp    80142f <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801410:	a1 44 57 90 00       	mov    0x905744,%eax
+  801415:	8b 40 48             	mov    0x48(%eax),%eax
+  801418:	83 ec 04             	sub    $0x4,%esp
+  80141b:	52                   	push   %edx
+  80141c:	50                   	push   %eax
+  80141d:	68 50 35 80 00       	push   $0x803550
+  801422:	e8 30 f0 ff ff       	call   800457 <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  801427:	83 c4 10             	add    $0x10,%esp
+  80142a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  80142f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801432:	89 1a                	mov    %ebx,(%edx)
+}
+  801434:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801437:	c9                   	leave
+  801438:	c3                   	ret
+
+00801439 <fd_close>:
+{
+  801439:	55                   	push   %ebp
+  80143a:	89 e5                	mov    %esp,%ebp
+  80143c:	57                   	push   %edi
+  80143d:	56                   	push   %esi
+  80143e:	53                   	push   %ebx
+  80143f:	83 ec 24             	sub    $0x24,%esp
+  801442:	8b 75 08             	mov    0x8(%ebp),%esi
+  801445:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801448:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80144b:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80144c:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801452:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801455:	50                   	push   %eax
+  801456:	e8 42 ff ff ff       	call   80139d <fd_lookup>
+  80145b:	89 c3                	mov    %eax,%ebx
+  80145d:	83 c4 10             	add    $0x10,%esp
+  801460:	85 c0                	test   %eax,%eax
+  801462:	78 05                	js     801469 <fd_close+0x30>
+      || fd != fd2)
+  801464:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801467:	74 16                	je     80147f <fd_close+0x46>
+    return must_exist ? r : 0;
+  801469:	89 f8                	mov    %edi,%eax
+  80146b:	84 c0                	test   %al,%al
+  80146d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801472:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801475:	89 d8                	mov    %ebx,%eax
+  801477:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80147a:	5b                   	pop    %ebx
+  80147b:	5e                   	pop    %esi
+  80147c:	5f                   	pop    %edi
+  80147d:	5d                   	pop    %ebp
+  80147e:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80147f:	83 ec 08             	sub    $0x8,%esp
+  801482:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801485:	50                   	push   %eax
+  801486:	ff 36                	push   (%esi)
+  801488:	e8 60 ff ff ff       	call   8013ed <dev_lookup>
+  80148d:	89 c3                	mov    %eax,%ebx
+  80148f:	83 c4 10             	add    $0x10,%esp
+  801492:	85 c0                	test   %eax,%eax
+  801494:	78 1a                	js     8014b0 <fd_close+0x77>
+    if (dev->dev_close)
+  801496:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801499:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  80149c:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  8014a1:	85 c0                	test   %eax,%eax
+  8014a3:	74 0b                	je     8014b0 <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  8014a5:	83 ec 0c             	sub    $0xc,%esp
+  8014a8:	56                   	push   %esi
+  8014a9:	ff d0                	call   *%eax
+  8014ab:	89 c3                	mov    %eax,%ebx
+  8014ad:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  8014b0:	83 ec 08             	sub    $0x8,%esp
+  8014b3:	56                   	push   %esi
+  8014b4:	6a 00                	push   $0x0
+  8014b6:	e8 3e fa ff ff       	call   800ef9 <sys_page_unmap>
+  return r;
+  8014bb:	83 c4 10             	add    $0x10,%esp
+  8014be:	eb b5                	jmp    801475 <fd_close+0x3c>
+
+008014c0 <close>:
+
+int
+close(int fdnum)
+{
+  8014c0:	55                   	push   %ebp
+  8014c1:	89 e5                	mov    %esp,%ebp
+  8014c3:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8014c6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014c9:	50                   	push   %eax
+  8014ca:	ff 75 08             	push   0x8(%ebp)
+  8014cd:	e8 cb fe ff ff       	call   80139d <fd_lookup>
+  8014d2:	83 c4 10             	add    $0x10,%esp
+  8014d5:	85 c0                	test   %eax,%eax
+  8014d7:	79 02                	jns    8014db <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  8014d9:	c9                   	leave
+  8014da:	c3                   	ret
+    return fd_close(fd, 1);
+  8014db:	83 ec 08             	sub    $0x8,%esp
+  8014de:	6a 01                	push   $0x1
+  8014e0:	ff 75 f4             	push   -0xc(%ebp)
+  8014e3:	e8 51 ff ff ff       	call   801439 <fd_close>
+  8014e8:	83 c4 10             	add    $0x10,%esp
+  8014eb:	eb ec                	jmp    8014d9 <close+0x19>
+
+008014ed <close_all>:
+
+void
+close_all(void)
+{
+  8014ed:	55                   	push   %ebp
+  8014ee:	89 e5                	mov    %esp,%ebp
+  8014f0:	53                   	push   %ebx
+  8014f1:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  8014f4:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  8014f9:	83 ec 0c             	sub    $0xc,%esp
+  8014fc:	53                   	push   %ebx
+  8014fd:	e8 be ff ff ff       	call   8014c0 <close>
+  for (i = 0; i < MAXFD; i++)
+  801502:	83 c3 01             	add    $0x1,%ebx
+  801505:	83 c4 10             	add    $0x10,%esp
+  801508:	83 fb 20             	cmp    $0x20,%ebx
+  80150b:	75 ec                	jne    8014f9 <close_all+0xc>
+}
+  80150d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801510:	c9                   	leave
+  801511:	c3                   	ret
+
+00801512 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801512:	55                   	push   %ebp
+  801513:	89 e5                	mov    %esp,%ebp
+  801515:	57                   	push   %edi
+  801516:	56                   	push   %esi
+  801517:	53                   	push   %ebx
+  801518:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80151b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80151e:	50                   	push   %eax
+  80151f:	ff 75 08             	push   0x8(%ebp)
+  801522:	e8 76 fe ff ff       	call   80139d <fd_lookup>
+  801527:	89 c6                	mov    %eax,%esi
+  801529:	83 c4 10             	add    $0x10,%esp
+  80152c:	85 c0                	test   %eax,%eax
+  80152e:	0f 88 0a 01 00 00    	js     80163e <dup+0x12c>
+    return r;
+  close(newfdnum);
+  801534:	83 ec 0c             	sub    $0xc,%esp
+  801537:	ff 75 0c             	push   0xc(%ebp)
+  80153a:	e8 81 ff ff ff       	call   8014c0 <close>
+
+  newfd = INDEX2FD(newfdnum);
+  80153f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801542:	c1 e0 0c             	shl    $0xc,%eax
+  801545:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  80154b:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  80154e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801551:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  801554:	89 04 24             	mov    %eax,(%esp)
+  801557:	e8 d7 fd ff ff       	call   801333 <fd2data>
+  80155c:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  80155e:	89 3c 24             	mov    %edi,(%esp)
+  801561:	e8 cd fd ff ff       	call   801333 <fd2data>
+  801566:	83 c4 10             	add    $0x10,%esp
+  801569:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80156c:	89 f3                	mov    %esi,%ebx
+  80156e:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  801574:	89 c6                	mov    %eax,%esi
+  801576:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801579:	89 cf                	mov    %ecx,%edi
+  80157b:	eb 0c                	jmp    801589 <dup+0x77>
+  80157d:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801583:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801589:	39 fb                	cmp    %edi,%ebx
+  80158b:	74 7b                	je     801608 <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  80158d:	89 d8                	mov    %ebx,%eax
+  80158f:	c1 e8 16             	shr    $0x16,%eax
+  801592:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801599:	a8 01                	test   $0x1,%al
+  80159b:	74 e0                	je     80157d <dup+0x6b>
+  80159d:	89 d8                	mov    %ebx,%eax
+  80159f:	c1 e8 0c             	shr    $0xc,%eax
+  8015a2:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8015a9:	f6 c2 01             	test   $0x1,%dl
+  8015ac:	74 cf                	je     80157d <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  8015ae:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  8015b5:	83 ec 0c             	sub    $0xc,%esp
+  8015b8:	25 07 0e 00 00       	and    $0xe07,%eax
+  8015bd:	50                   	push   %eax
+  8015be:	56                   	push   %esi
+  8015bf:	6a 00                	push   $0x0
+  8015c1:	53                   	push   %ebx
+  8015c2:	6a 00                	push   $0x0
+  8015c4:	e8 ee f8 ff ff       	call   800eb7 <sys_page_map>
+  8015c9:	83 c4 20             	add    $0x20,%esp
+  8015cc:	85 c0                	test   %eax,%eax
+  8015ce:	79 ad                	jns    80157d <dup+0x6b>
+  8015d0:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8015d3:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  8015d5:	83 ec 08             	sub    $0x8,%esp
+  8015d8:	ff 75 d4             	push   -0x2c(%ebp)
+  8015db:	6a 00                	push   $0x0
+  8015dd:	e8 17 f9 ff ff       	call   800ef9 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8015e2:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  8015e5:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  8015eb:	83 c4 10             	add    $0x10,%esp
+  8015ee:	39 df                	cmp    %ebx,%edi
+  8015f0:	74 4c                	je     80163e <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  8015f2:	83 ec 08             	sub    $0x8,%esp
+  8015f5:	57                   	push   %edi
+  8015f6:	6a 00                	push   $0x0
+  8015f8:	e8 fc f8 ff ff       	call   800ef9 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8015fd:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  801603:	83 c4 10             	add    $0x10,%esp
+  801606:	eb e6                	jmp    8015ee <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801608:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80160b:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80160e:	89 c8                	mov    %ecx,%eax
+  801610:	c1 e8 0c             	shr    $0xc,%eax
+  801613:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80161a:	83 ec 0c             	sub    $0xc,%esp
+  80161d:	25 07 0e 00 00       	and    $0xe07,%eax
+  801622:	50                   	push   %eax
+  801623:	ff 75 d4             	push   -0x2c(%ebp)
+  801626:	6a 00                	push   $0x0
+  801628:	51                   	push   %ecx
+  801629:	6a 00                	push   $0x0
+  80162b:	e8 87 f8 ff ff       	call   800eb7 <sys_page_map>
+  801630:	89 c6                	mov    %eax,%esi
+  801632:	83 c4 20             	add    $0x20,%esp
+  801635:	85 c0                	test   %eax,%eax
+  801637:	78 9c                	js     8015d5 <dup+0xc3>
+  return newfdnum;
+  801639:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80163c:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  80163e:	89 f0                	mov    %esi,%eax
+  801640:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801643:	5b                   	pop    %ebx
+  801644:	5e                   	pop    %esi
+  801645:	5f                   	pop    %edi
+  801646:	5d                   	pop    %ebp
+  801647:	c3                   	ret
+
+00801648 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801648:	55                   	push   %ebp
+  801649:	89 e5                	mov    %esp,%ebp
+  80164b:	56                   	push   %esi
+  80164c:	53                   	push   %ebx
+  80164d:	83 ec 18             	sub    $0x18,%esp
+  801650:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801653:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801656:	50                   	push   %eax
+  801657:	56                   	push   %esi
+  801658:	e8 40 fd ff ff       	call   80139d <fd_lookup>
+  80165d:	83 c4 10             	add    $0x10,%esp
+  801660:	85 c0                	test   %eax,%eax
+  801662:	78 3c                	js     8016a0 <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801664:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801667:	83 ec 08             	sub    $0x8,%esp
+  80166a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80166d:	50                   	push   %eax
+  80166e:	ff 33                	push   (%ebx)
+  801670:	e8 78 fd ff ff       	call   8013ed <dev_lookup>
+  801675:	83 c4 10             	add    $0x10,%esp
+  801678:	85 c0                	test   %eax,%eax
+  80167a:	78 24                	js     8016a0 <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80167c:	8b 43 08             	mov    0x8(%ebx),%eax
+  80167f:	83 e0 03             	and    $0x3,%eax
+  801682:	83 f8 01             	cmp    $0x1,%eax
+  801685:	74 20                	je     8016a7 <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  801687:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80168a:	8b 40 08             	mov    0x8(%eax),%eax
+  80168d:	85 c0                	test   %eax,%eax
+  80168f:	74 37                	je     8016c8 <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  801691:	83 ec 04             	sub    $0x4,%esp
+  801694:	ff 75 10             	push   0x10(%ebp)
+  801697:	ff 75 0c             	push   0xc(%ebp)
+  80169a:	53                   	push   %ebx
+  80169b:	ff d0                	call   *%eax
+  80169d:	83 c4 10             	add    $0x10,%esp
+}
+  8016a0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016a3:	5b                   	pop    %ebx
+  8016a4:	5e                   	pop    %esi
+  8016a5:	5d                   	pop    %ebp
+  8016a6:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8016a7:	a1 44 57 90 00       	mov    0x905744,%eax
+  8016ac:	8b 40 48             	mov    0x48(%eax),%eax
+  8016af:	83 ec 04             	sub    $0x4,%esp
+  8016b2:	56                   	push   %esi
+  8016b3:	50                   	push   %eax
+  8016b4:	68 91 35 80 00       	push   $0x803591
+  8016b9:	e8 99 ed ff ff       	call   800457 <cprintf>
+    return -E_INVAL;
+  8016be:	83 c4 10             	add    $0x10,%esp
+  8016c1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016c6:	eb d8                	jmp    8016a0 <read+0x58>
+    return -E_NOT_SUPP;
+  8016c8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016cd:	eb d1                	jmp    8016a0 <read+0x58>
+
+008016cf <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8016cf:	55                   	push   %ebp
+  8016d0:	89 e5                	mov    %esp,%ebp
+  8016d2:	57                   	push   %edi
+  8016d3:	56                   	push   %esi
+  8016d4:	53                   	push   %ebx
+  8016d5:	83 ec 0c             	sub    $0xc,%esp
+  8016d8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8016db:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  8016de:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016e3:	eb 02                	jmp    8016e7 <readn+0x18>
+  8016e5:	01 c3                	add    %eax,%ebx
+  8016e7:	39 f3                	cmp    %esi,%ebx
+  8016e9:	73 21                	jae    80170c <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  8016eb:	83 ec 04             	sub    $0x4,%esp
+  8016ee:	89 f0                	mov    %esi,%eax
+  8016f0:	29 d8                	sub    %ebx,%eax
+  8016f2:	50                   	push   %eax
+  8016f3:	89 d8                	mov    %ebx,%eax
+  8016f5:	03 45 0c             	add    0xc(%ebp),%eax
+  8016f8:	50                   	push   %eax
+  8016f9:	57                   	push   %edi
+  8016fa:	e8 49 ff ff ff       	call   801648 <read>
+    if (m < 0)
+  8016ff:	83 c4 10             	add    $0x10,%esp
+  801702:	85 c0                	test   %eax,%eax
+  801704:	78 04                	js     80170a <readn+0x3b>
+      return m;
+    if (m == 0)
+  801706:	75 dd                	jne    8016e5 <readn+0x16>
+  801708:	eb 02                	jmp    80170c <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  80170a:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  80170c:	89 d8                	mov    %ebx,%eax
+  80170e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801711:	5b                   	pop    %ebx
+  801712:	5e                   	pop    %esi
+  801713:	5f                   	pop    %edi
+  801714:	5d                   	pop    %ebp
+  801715:	c3                   	ret
+
+00801716 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801716:	55                   	push   %ebp
+  801717:	89 e5                	mov    %esp,%ebp
+  801719:	56                   	push   %esi
+  80171a:	53                   	push   %ebx
+  80171b:	83 ec 18             	sub    $0x18,%esp
+  80171e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801721:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801724:	50                   	push   %eax
+  801725:	53                   	push   %ebx
+  801726:	e8 72 fc ff ff       	call   80139d <fd_lookup>
+  80172b:	83 c4 10             	add    $0x10,%esp
+  80172e:	85 c0                	test   %eax,%eax
+  801730:	78 37                	js     801769 <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801732:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801735:	83 ec 08             	sub    $0x8,%esp
+  801738:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80173b:	50                   	push   %eax
+  80173c:	ff 36                	push   (%esi)
+  80173e:	e8 aa fc ff ff       	call   8013ed <dev_lookup>
+  801743:	83 c4 10             	add    $0x10,%esp
+  801746:	85 c0                	test   %eax,%eax
+  801748:	78 1f                	js     801769 <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80174a:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80174e:	74 20                	je     801770 <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  801750:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801753:	8b 40 0c             	mov    0xc(%eax),%eax
+  801756:	85 c0                	test   %eax,%eax
+  801758:	74 37                	je     801791 <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  80175a:	83 ec 04             	sub    $0x4,%esp
+  80175d:	ff 75 10             	push   0x10(%ebp)
+  801760:	ff 75 0c             	push   0xc(%ebp)
+  801763:	56                   	push   %esi
+  801764:	ff d0                	call   *%eax
+  801766:	83 c4 10             	add    $0x10,%esp
+}
+  801769:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80176c:	5b                   	pop    %ebx
+  80176d:	5e                   	pop    %esi
+  80176e:	5d                   	pop    %ebp
+  80176f:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801770:	a1 44 57 90 00       	mov    0x905744,%eax
+  801775:	8b 40 48             	mov    0x48(%eax),%eax
+  801778:	83 ec 04             	sub    $0x4,%esp
+  80177b:	53                   	push   %ebx
+  80177c:	50                   	push   %eax
+  80177d:	68 ad 35 80 00       	push   $0x8035ad
+  801782:	e8 d0 ec ff ff       	call   800457 <cprintf>
+    return -E_INVAL;
+  801787:	83 c4 10             	add    $0x10,%esp
+  80178a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80178f:	eb d8                	jmp    801769 <write+0x53>
+    return -E_NOT_SUPP;
+  801791:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801796:	eb d1                	jmp    801769 <write+0x53>
+
+00801798 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801798:	55                   	push   %ebp
+  801799:	89 e5                	mov    %esp,%ebp
+  80179b:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80179e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017a1:	50                   	push   %eax
+  8017a2:	ff 75 08             	push   0x8(%ebp)
+  8017a5:	e8 f3 fb ff ff       	call   80139d <fd_lookup>
+  8017aa:	83 c4 10             	add    $0x10,%esp
+  8017ad:	85 c0                	test   %eax,%eax
+  8017af:	78 0e                	js     8017bf <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  8017b1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8017b4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017b7:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  8017ba:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017bf:	c9                   	leave
+  8017c0:	c3                   	ret
+
+008017c1 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8017c1:	55                   	push   %ebp
+  8017c2:	89 e5                	mov    %esp,%ebp
+  8017c4:	56                   	push   %esi
+  8017c5:	53                   	push   %ebx
+  8017c6:	83 ec 18             	sub    $0x18,%esp
+  8017c9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017cc:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017cf:	50                   	push   %eax
+  8017d0:	53                   	push   %ebx
+  8017d1:	e8 c7 fb ff ff       	call   80139d <fd_lookup>
+  8017d6:	83 c4 10             	add    $0x10,%esp
+  8017d9:	85 c0                	test   %eax,%eax
+  8017db:	78 34                	js     801811 <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017dd:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8017e0:	83 ec 08             	sub    $0x8,%esp
+  8017e3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017e6:	50                   	push   %eax
+  8017e7:	ff 36                	push   (%esi)
+  8017e9:	e8 ff fb ff ff       	call   8013ed <dev_lookup>
+  8017ee:	83 c4 10             	add    $0x10,%esp
+  8017f1:	85 c0                	test   %eax,%eax
+  8017f3:	78 1c                	js     801811 <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8017f5:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8017f9:	74 1d                	je     801818 <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  8017fb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017fe:	8b 40 18             	mov    0x18(%eax),%eax
+  801801:	85 c0                	test   %eax,%eax
+  801803:	74 34                	je     801839 <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  801805:	83 ec 08             	sub    $0x8,%esp
+  801808:	ff 75 0c             	push   0xc(%ebp)
+  80180b:	56                   	push   %esi
+  80180c:	ff d0                	call   *%eax
+  80180e:	83 c4 10             	add    $0x10,%esp
+}
+  801811:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801814:	5b                   	pop    %ebx
+  801815:	5e                   	pop    %esi
+  801816:	5d                   	pop    %ebp
+  801817:	c3                   	ret
+            thisenv->env_id, fdnum);
+  801818:	a1 44 57 90 00       	mov    0x905744,%eax
+  80181d:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801820:	83 ec 04             	sub    $0x4,%esp
+  801823:	53                   	push   %ebx
+  801824:	50                   	push   %eax
+  801825:	68 70 35 80 00       	push   $0x803570
+  80182a:	e8 28 ec ff ff       	call   800457 <cprintf>
+    return -E_INVAL;
+  80182f:	83 c4 10             	add    $0x10,%esp
+  801832:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801837:	eb d8                	jmp    801811 <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  801839:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80183e:	eb d1                	jmp    801811 <ftruncate+0x50>
+
+00801840 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801840:	55                   	push   %ebp
+  801841:	89 e5                	mov    %esp,%ebp
+  801843:	56                   	push   %esi
+  801844:	53                   	push   %ebx
+  801845:	83 ec 18             	sub    $0x18,%esp
+  801848:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  80184b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80184e:	50                   	push   %eax
+  80184f:	ff 75 08             	push   0x8(%ebp)
+  801852:	e8 46 fb ff ff       	call   80139d <fd_lookup>
+  801857:	83 c4 10             	add    $0x10,%esp
+  80185a:	85 c0                	test   %eax,%eax
+  80185c:	78 49                	js     8018a7 <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80185e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801861:	83 ec 08             	sub    $0x8,%esp
+  801864:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801867:	50                   	push   %eax
+  801868:	ff 36                	push   (%esi)
+  80186a:	e8 7e fb ff ff       	call   8013ed <dev_lookup>
+  80186f:	83 c4 10             	add    $0x10,%esp
+  801872:	85 c0                	test   %eax,%eax
+  801874:	78 31                	js     8018a7 <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  801876:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801879:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80187d:	74 2f                	je     8018ae <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  80187f:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  801882:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801889:	00 00 00 
+  stat->st_isdir = 0;
+  80188c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801893:	00 00 00 
+  stat->st_dev = dev;
+  801896:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  80189c:	83 ec 08             	sub    $0x8,%esp
+  80189f:	53                   	push   %ebx
+  8018a0:	56                   	push   %esi
+  8018a1:	ff 50 14             	call   *0x14(%eax)
+  8018a4:	83 c4 10             	add    $0x10,%esp
+}
+  8018a7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018aa:	5b                   	pop    %ebx
+  8018ab:	5e                   	pop    %esi
+  8018ac:	5d                   	pop    %ebp
+  8018ad:	c3                   	ret
+    return -E_NOT_SUPP;
+  8018ae:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8018b3:	eb f2                	jmp    8018a7 <fstat+0x67>
+
+008018b5 <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  8018b5:	55                   	push   %ebp
+  8018b6:	89 e5                	mov    %esp,%ebp
+  8018b8:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  8018bb:	ff 75 0c             	push   0xc(%ebp)
+  8018be:	ff 75 08             	push   0x8(%ebp)
+  8018c1:	e8 58 07 00 00       	call   80201e <file_stat>
+}
+  8018c6:	c9                   	leave
+  8018c7:	c3                   	ret
+
+008018c8 <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  8018c8:	55                   	push   %ebp
+  8018c9:	89 e5                	mov    %esp,%ebp
+  8018cb:	57                   	push   %edi
+  8018cc:	56                   	push   %esi
+  8018cd:	53                   	push   %ebx
+  8018ce:	83 ec 1c             	sub    $0x1c,%esp
+  8018d1:	89 c7                	mov    %eax,%edi
+  8018d3:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8018d6:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8018d9:	e9 a2 00 00 00       	jmp    801980 <fsipc_send+0xb8>
+  nfsenvs = 0;
+  8018de:	c7 05 00 50 90 00 00 	movl   $0x0,0x905000
+  8018e5:	00 00 00 
+  8018e8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018ed:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  8018f2:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  8018f7:	be 01 00 00 00       	mov    $0x1,%esi
+  8018fc:	eb 0f                	jmp    80190d <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  8018fe:	83 c0 01             	add    $0x1,%eax
+  801901:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801906:	74 49                	je     801951 <fsipc_send+0x89>
+  801908:	83 f9 07             	cmp    $0x7,%ecx
+  80190b:	7f 50                	jg     80195d <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  80190d:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801910:	c1 e2 04             	shl    $0x4,%edx
+  801913:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801919:	8b 52 50             	mov    0x50(%edx),%edx
+  80191c:	83 fa 01             	cmp    $0x1,%edx
+  80191f:	75 dd                	jne    8018fe <fsipc_send+0x36>
+  801921:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801924:	c1 e2 04             	shl    $0x4,%edx
+  801927:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80192d:	8b 52 54             	mov    0x54(%edx),%edx
+  801930:	85 d2                	test   %edx,%edx
+  801932:	74 ca                	je     8018fe <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801934:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801937:	c1 e2 04             	shl    $0x4,%edx
+  80193a:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801940:	8b 52 48             	mov    0x48(%edx),%edx
+  801943:	89 14 8d 20 50 90 00 	mov    %edx,0x905020(,%ecx,4)
+  80194a:	8d 49 01             	lea    0x1(%ecx),%ecx
+  80194d:	89 f3                	mov    %esi,%ebx
+  80194f:	eb ad                	jmp    8018fe <fsipc_send+0x36>
+  801951:	84 db                	test   %bl,%bl
+  801953:	74 38                	je     80198d <fsipc_send+0xc5>
+  801955:	89 0d 00 50 90 00    	mov    %ecx,0x905000
+  80195b:	eb 30                	jmp    80198d <fsipc_send+0xc5>
+  80195d:	84 db                	test   %bl,%bl
+  80195f:	74 2c                	je     80198d <fsipc_send+0xc5>
+  801961:	89 0d 00 50 90 00    	mov    %ecx,0x905000
+  801967:	eb 24                	jmp    80198d <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  801969:	50                   	push   %eax
+  80196a:	68 dc 35 80 00       	push   $0x8035dc
+  80196f:	6a 34                	push   $0x34
+  801971:	68 e6 35 80 00       	push   $0x8035e6
+  801976:	e8 01 ea ff ff       	call   80037c <_panic>
+    }
+    sys_yield();
+  80197b:	e8 92 f4 ff ff       	call   800e12 <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  801980:	83 3d 00 50 90 00 03 	cmpl   $0x3,0x905000
+  801987:	0f 8e 51 ff ff ff    	jle    8018de <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  80198d:	a1 44 57 90 00       	mov    0x905744,%eax
+  801992:	8b 70 48             	mov    0x48(%eax),%esi
+  801995:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  80199b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019a0:	8b 0d 00 50 90 00    	mov    0x905000,%ecx
+  8019a6:	39 d9                	cmp    %ebx,%ecx
+  8019a8:	7e d1                	jle    80197b <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  8019aa:	83 ec 0c             	sub    $0xc,%esp
+  8019ad:	ff 75 e0             	push   -0x20(%ebp)
+  8019b0:	6a 07                	push   $0x7
+  8019b2:	ff 75 e4             	push   -0x1c(%ebp)
+  8019b5:	57                   	push   %edi
+  8019b6:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  8019b9:	99                   	cltd
+  8019ba:	f7 f9                	idiv   %ecx
+  8019bc:	ff 34 95 20 50 90 00 	push   0x905020(,%edx,4)
+  8019c3:	e8 63 f7 ff ff       	call   80112b <sys_ipc_try_send>
+      if (r == 0)
+  8019c8:	83 c4 20             	add    $0x20,%esp
+  8019cb:	85 c0                	test   %eax,%eax
+  8019cd:	74 0a                	je     8019d9 <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  8019cf:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8019d2:	75 95                	jne    801969 <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  8019d4:	83 c3 01             	add    $0x1,%ebx
+  8019d7:	eb c7                	jmp    8019a0 <fsipc_send+0xd8>
+  }
+}
+  8019d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019dc:	5b                   	pop    %ebx
+  8019dd:	5e                   	pop    %esi
+  8019de:	5f                   	pop    %edi
+  8019df:	5d                   	pop    %ebp
+  8019e0:	c3                   	ret
+
+008019e1 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8019e1:	55                   	push   %ebp
+  8019e2:	89 e5                	mov    %esp,%ebp
+  8019e4:	53                   	push   %ebx
+  8019e5:	83 ec 14             	sub    $0x14,%esp
+  8019e8:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  8019ea:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  8019f1:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8019f6:	ba 00 60 90 00       	mov    $0x906000,%edx
+  8019fb:	e8 c8 fe ff ff       	call   8018c8 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801a00:	6a 00                	push   $0x0
+  801a02:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a05:	50                   	push   %eax
+  801a06:	53                   	push   %ebx
+  801a07:	6a 00                	push   $0x0
+  801a09:	e8 26 13 00 00       	call   802d34 <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  801a0e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a11:	c9                   	leave
+  801a12:	c3                   	ret
+
+00801a13 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801a13:	55                   	push   %ebp
+  801a14:	89 e5                	mov    %esp,%ebp
+  801a16:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801a19:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a1c:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a1f:	a3 00 60 90 00       	mov    %eax,0x906000
+  fsipcbuf.set_size.req_size = newsize;
+  801a24:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a27:	a3 04 60 90 00       	mov    %eax,0x906004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801a2c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a31:	b8 02 00 00 00       	mov    $0x2,%eax
+  801a36:	e8 a6 ff ff ff       	call   8019e1 <fsipc>
+}
+  801a3b:	c9                   	leave
+  801a3c:	c3                   	ret
+
+00801a3d <devfile_flush>:
+{
+  801a3d:	55                   	push   %ebp
+  801a3e:	89 e5                	mov    %esp,%ebp
+  801a40:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801a43:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a46:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a49:	a3 00 60 90 00       	mov    %eax,0x906000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801a4e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a53:	b8 06 00 00 00       	mov    $0x6,%eax
+  801a58:	e8 84 ff ff ff       	call   8019e1 <fsipc>
+}
+  801a5d:	c9                   	leave
+  801a5e:	c3                   	ret
+
+00801a5f <devfile_stat>:
+{
+  801a5f:	55                   	push   %ebp
+  801a60:	89 e5                	mov    %esp,%ebp
+  801a62:	53                   	push   %ebx
+  801a63:	83 ec 04             	sub    $0x4,%esp
+  801a66:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801a69:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a6c:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a6f:	a3 00 60 90 00       	mov    %eax,0x906000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801a74:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a79:	b8 05 00 00 00       	mov    $0x5,%eax
+  801a7e:	e8 5e ff ff ff       	call   8019e1 <fsipc>
+  801a83:	85 c0                	test   %eax,%eax
+  801a85:	78 2c                	js     801ab3 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801a87:	83 ec 08             	sub    $0x8,%esp
+  801a8a:	68 00 60 90 00       	push   $0x906000
+  801a8f:	53                   	push   %ebx
+  801a90:	e8 b0 ef ff ff       	call   800a45 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  801a95:	a1 80 60 90 00       	mov    0x906080,%eax
+  801a9a:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801aa0:	a1 84 60 90 00       	mov    0x906084,%eax
+  801aa5:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801aab:	83 c4 10             	add    $0x10,%esp
+  801aae:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ab3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ab6:	c9                   	leave
+  801ab7:	c3                   	ret
+
+00801ab8 <fsv_alloc>:
+{
+  801ab8:	55                   	push   %ebp
+  801ab9:	89 e5                	mov    %esp,%ebp
+  801abb:	56                   	push   %esi
+  801abc:	53                   	push   %ebx
+  801abd:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  801abf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ac4:	eb 22                	jmp    801ae8 <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  801ac6:	83 ec 04             	sub    $0x4,%esp
+  801ac9:	6a 00                	push   $0x0
+  801acb:	6a 00                	push   $0x0
+  801acd:	6a 07                	push   $0x7
+  801acf:	50                   	push   %eax
+  801ad0:	6a 00                	push   $0x0
+  801ad2:	6a 04                	push   $0x4
+  801ad4:	68 40 50 90 00       	push   $0x905040
+  801ad9:	e8 e9 f7 ff ff       	call   8012c7 <sysbatch_add>
+  801ade:	83 c4 20             	add    $0x20,%esp
+  801ae1:	85 c0                	test   %eax,%eax
+  801ae3:	78 48                	js     801b2d <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  801ae5:	83 c3 01             	add    $0x1,%ebx
+  801ae8:	39 f3                	cmp    %esi,%ebx
+  801aea:	74 31                	je     801b1d <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  801aec:	89 d8                	mov    %ebx,%eax
+  801aee:	c1 e0 0c             	shl    $0xc,%eax
+  801af1:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801af6:	89 c2                	mov    %eax,%edx
+  801af8:	c1 ea 16             	shr    $0x16,%edx
+  801afb:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801b02:	f6 c2 01             	test   $0x1,%dl
+  801b05:	74 bf                	je     801ac6 <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  801b07:	89 c2                	mov    %eax,%edx
+  801b09:	c1 ea 0c             	shr    $0xc,%edx
+  801b0c:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801b13:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801b16:	83 fa 03             	cmp    $0x3,%edx
+  801b19:	75 ab                	jne    801ac6 <fsv_alloc+0xe>
+  801b1b:	eb c8                	jmp    801ae5 <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  801b1d:	83 ec 0c             	sub    $0xc,%esp
+  801b20:	68 40 50 90 00       	push   $0x905040
+  801b25:	e8 4d f7 ff ff       	call   801277 <sysbatch_flush>
+  801b2a:	83 c4 10             	add    $0x10,%esp
+}
+  801b2d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b30:	5b                   	pop    %ebx
+  801b31:	5e                   	pop    %esi
+  801b32:	5d                   	pop    %ebp
+  801b33:	c3                   	ret
+
+00801b34 <devfile_read>:
+{
+  801b34:	55                   	push   %ebp
+  801b35:	89 e5                	mov    %esp,%ebp
+  801b37:	57                   	push   %edi
+  801b38:	56                   	push   %esi
+  801b39:	53                   	push   %ebx
+  801b3a:	83 ec 3c             	sub    $0x3c,%esp
+  801b3d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  801b40:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  801b46:	77 57                	ja     801b9f <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801b48:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b4b:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b4e:	a3 00 60 90 00       	mov    %eax,0x906000
+  fsipcbuf.read.req_n = n;
+  801b53:	89 1d 04 60 90 00    	mov    %ebx,0x906004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801b59:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b5e:	b8 03 00 00 00       	mov    $0x3,%eax
+  801b63:	e8 79 fe ff ff       	call   8019e1 <fsipc>
+  801b68:	89 c6                	mov    %eax,%esi
+  801b6a:	85 c0                	test   %eax,%eax
+  801b6c:	78 27                	js     801b95 <devfile_read+0x61>
+  assert(r <= n);
+  801b6e:	39 c3                	cmp    %eax,%ebx
+  801b70:	0f 82 0e 02 00 00    	jb     801d84 <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  801b76:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801b7b:	0f 8f 1c 02 00 00    	jg     801d9d <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801b81:	83 ec 04             	sub    $0x4,%esp
+  801b84:	50                   	push   %eax
+  801b85:	68 00 60 90 00       	push   $0x906000
+  801b8a:	ff 75 0c             	push   0xc(%ebp)
+  801b8d:	e8 39 f0 ff ff       	call   800bcb <memmove>
+  return r;
+  801b92:	83 c4 10             	add    $0x10,%esp
+}
+  801b95:	89 f0                	mov    %esi,%eax
+  801b97:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b9a:	5b                   	pop    %ebx
+  801b9b:	5e                   	pop    %esi
+  801b9c:	5f                   	pop    %edi
+  801b9d:	5d                   	pop    %ebp
+  801b9e:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  801b9f:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ba4:	e8 0f ff ff ff       	call   801ab8 <fsv_alloc>
+  801ba9:	89 c6                	mov    %eax,%esi
+  801bab:	85 c0                	test   %eax,%eax
+  801bad:	78 e6                	js     801b95 <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  801baf:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bb2:	8b 40 0c             	mov    0xc(%eax),%eax
+  801bb5:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  801bba:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bbd:	8b 40 04             	mov    0x4(%eax),%eax
+  801bc0:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  801bc5:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  801bcb:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801bd2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801bd7:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801bdc:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801be1:	e8 e2 fc ff ff       	call   8018c8 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801be6:	6a 00                	push   $0x0
+  801be8:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801beb:	50                   	push   %eax
+  801bec:	68 00 10 c0 9f       	push   $0x9fc01000
+  801bf1:	6a 00                	push   $0x0
+  801bf3:	e8 3c 11 00 00       	call   802d34 <ipc_recv_pages>
+  801bf8:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  801bfa:	83 c4 10             	add    $0x10,%esp
+  801bfd:	85 c0                	test   %eax,%eax
+  801bff:	7e 94                	jle    801b95 <devfile_read+0x61>
+  assert(r <= n);
+  801c01:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801c04:	39 c3                	cmp    %eax,%ebx
+  801c06:	72 2e                	jb     801c36 <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801c08:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c0b:	8b 40 04             	mov    0x4(%eax),%eax
+  801c0e:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801c13:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  801c16:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801c19:	c1 e2 0c             	shl    $0xc,%edx
+  801c1c:	39 ca                	cmp    %ecx,%edx
+  801c1e:	72 2f                	jb     801c4f <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  801c20:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  801c25:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  801c28:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  801c2c:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801c31:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  801c34:	eb 52                	jmp    801c88 <devfile_read+0x154>
+  assert(r <= n);
+  801c36:	68 f1 35 80 00       	push   $0x8035f1
+  801c3b:	68 f8 35 80 00       	push   $0x8035f8
+  801c40:	68 49 01 00 00       	push   $0x149
+  801c45:	68 e6 35 80 00       	push   $0x8035e6
+  801c4a:	e8 2d e7 ff ff       	call   80037c <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801c4f:	68 1c 36 80 00       	push   $0x80361c
+  801c54:	68 f8 35 80 00       	push   $0x8035f8
+  801c59:	68 4a 01 00 00       	push   $0x14a
+  801c5e:	68 e6 35 80 00       	push   $0x8035e6
+  801c63:	e8 14 e7 ff ff       	call   80037c <_panic>
+      memmove(dst + done, src + done, m);
+  801c68:	83 ec 04             	sub    $0x4,%esp
+  801c6b:	53                   	push   %ebx
+  801c6c:	56                   	push   %esi
+  801c6d:	89 f8                	mov    %edi,%eax
+  801c6f:	03 45 0c             	add    0xc(%ebp),%eax
+  801c72:	50                   	push   %eax
+  801c73:	e8 53 ef ff ff       	call   800bcb <memmove>
+  801c78:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  801c7b:	01 df                	add    %ebx,%edi
+  801c7d:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801c80:	39 c7                	cmp    %eax,%edi
+  801c82:	0f 83 c0 00 00 00    	jae    801d48 <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801c88:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801c8b:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  801c8e:	89 f0                	mov    %esi,%eax
+  801c90:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801c95:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  801c9a:	29 c3                	sub    %eax,%ebx
+  801c9c:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801c9f:	29 f8                	sub    %edi,%eax
+  801ca1:	39 c3                	cmp    %eax,%ebx
+  801ca3:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  801ca6:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801cac:	75 ba                	jne    801c68 <devfile_read+0x134>
+  801cae:	89 f9                	mov    %edi,%ecx
+  801cb0:	03 4d 0c             	add    0xc(%ebp),%ecx
+  801cb3:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  801cb6:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  801cbc:	75 aa                	jne    801c68 <devfile_read+0x134>
+  801cbe:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  801cc4:	77 a2                	ja     801c68 <devfile_read+0x134>
+  801cc6:	89 c8                	mov    %ecx,%eax
+  801cc8:	c1 e8 16             	shr    $0x16,%eax
+  801ccb:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801cd2:	a8 01                	test   $0x1,%al
+  801cd4:	74 92                	je     801c68 <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  801cd6:	89 c8                	mov    %ecx,%eax
+  801cd8:	c1 e8 0c             	shr    $0xc,%eax
+  801cdb:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  801ce2:	a8 01                	test   $0x1,%al
+  801ce4:	74 82                	je     801c68 <devfile_read+0x134>
+  801ce6:	a9 02 08 00 00       	test   $0x802,%eax
+  801ceb:	0f 84 77 ff ff ff    	je     801c68 <devfile_read+0x134>
+  801cf1:	f6 c4 04             	test   $0x4,%ah
+  801cf4:	0f 85 6e ff ff ff    	jne    801c68 <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  801cfa:	a1 44 57 90 00       	mov    0x905744,%eax
+  801cff:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  801d03:	84 c0                	test   %al,%al
+  801d05:	75 17                	jne    801d1e <devfile_read+0x1ea>
+  801d07:	83 ec 08             	sub    $0x8,%esp
+  801d0a:	6a 01                	push   $0x1
+  801d0c:	6a 00                	push   $0x0
+  801d0e:	e8 1e f1 ff ff       	call   800e31 <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  801d13:	83 c4 10             	add    $0x10,%esp
+  801d16:	85 c0                	test   %eax,%eax
+  801d18:	0f 85 4a ff ff ff    	jne    801c68 <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  801d1e:	83 ec 04             	sub    $0x4,%esp
+  801d21:	68 05 08 00 00       	push   $0x805
+  801d26:	ff 75 cc             	push   -0x34(%ebp)
+  801d29:	6a 00                	push   $0x0
+  801d2b:	56                   	push   %esi
+  801d2c:	6a 00                	push   $0x0
+  801d2e:	6a 05                	push   $0x5
+  801d30:	68 40 50 90 00       	push   $0x905040
+  801d35:	e8 8d f5 ff ff       	call   8012c7 <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  801d3a:	c1 e8 1f             	shr    $0x1f,%eax
+  801d3d:	08 45 cb             	or     %al,-0x35(%ebp)
+  801d40:	83 c4 20             	add    $0x20,%esp
+  801d43:	e9 33 ff ff ff       	jmp    801c7b <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  801d48:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  801d4b:	83 ec 0c             	sub    $0xc,%esp
+  801d4e:	68 40 50 90 00       	push   $0x905040
+  801d53:	e8 1f f5 ff ff       	call   801277 <sysbatch_flush>
+  801d58:	83 c4 10             	add    $0x10,%esp
+  801d5b:	85 c0                	test   %eax,%eax
+  801d5d:	78 06                	js     801d65 <devfile_read+0x231>
+  801d5f:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  801d63:	74 14                	je     801d79 <devfile_read+0x245>
+    memmove(dst, src, r);
+  801d65:	83 ec 04             	sub    $0x4,%esp
+  801d68:	ff 75 d4             	push   -0x2c(%ebp)
+  801d6b:	ff 75 d0             	push   -0x30(%ebp)
+  801d6e:	ff 75 0c             	push   0xc(%ebp)
+  801d71:	e8 55 ee ff ff       	call   800bcb <memmove>
+  801d76:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  801d79:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d7c:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  801d7f:	e9 11 fe ff ff       	jmp    801b95 <devfile_read+0x61>
+  assert(r <= n);
+  801d84:	68 f1 35 80 00       	push   $0x8035f1
+  801d89:	68 f8 35 80 00       	push   $0x8035f8
+  801d8e:	68 1c 01 00 00       	push   $0x11c
+  801d93:	68 e6 35 80 00       	push   $0x8035e6
+  801d98:	e8 df e5 ff ff       	call   80037c <_panic>
+  assert(r <= PGSIZE);
+  801d9d:	68 0d 36 80 00       	push   $0x80360d
+  801da2:	68 f8 35 80 00       	push   $0x8035f8
+  801da7:	68 1d 01 00 00       	push   $0x11d
+  801dac:	68 e6 35 80 00       	push   $0x8035e6
+  801db1:	e8 c6 e5 ff ff       	call   80037c <_panic>
+
+00801db6 <devfile_write>:
+{
+  801db6:	55                   	push   %ebp
+  801db7:	89 e5                	mov    %esp,%ebp
+  801db9:	57                   	push   %edi
+  801dba:	56                   	push   %esi
+  801dbb:	53                   	push   %ebx
+  801dbc:	83 ec 1c             	sub    $0x1c,%esp
+  801dbf:	8b 75 08             	mov    0x8(%ebp),%esi
+  801dc2:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  801dc5:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  801dca:	77 39                	ja     801e05 <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801dcc:	8b 56 0c             	mov    0xc(%esi),%edx
+  801dcf:	89 15 00 60 90 00    	mov    %edx,0x906000
+  fsipcbuf.write.req_n = n;
+  801dd5:	a3 04 60 90 00       	mov    %eax,0x906004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  801dda:	83 ec 04             	sub    $0x4,%esp
+  801ddd:	50                   	push   %eax
+  801dde:	ff 75 0c             	push   0xc(%ebp)
+  801de1:	68 08 60 90 00       	push   $0x906008
+  801de6:	e8 e0 ed ff ff       	call   800bcb <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801deb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801df0:	b8 04 00 00 00       	mov    $0x4,%eax
+  801df5:	e8 e7 fb ff ff       	call   8019e1 <fsipc>
+  801dfa:	83 c4 10             	add    $0x10,%esp
+}
+  801dfd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e00:	5b                   	pop    %ebx
+  801e01:	5e                   	pop    %esi
+  801e02:	5f                   	pop    %edi
+  801e03:	5d                   	pop    %ebp
+  801e04:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  801e05:	ba 00 00 10 00       	mov    $0x100000,%edx
+  801e0a:	39 d0                	cmp    %edx,%eax
+  801e0c:	89 d3                	mov    %edx,%ebx
+  801e0e:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  801e11:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  801e17:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  801e1a:	83 c7 01             	add    $0x1,%edi
+  801e1d:	89 f8                	mov    %edi,%eax
+  801e1f:	e8 94 fc ff ff       	call   801ab8 <fsv_alloc>
+  801e24:	85 c0                	test   %eax,%eax
+  801e26:	78 d5                	js     801dfd <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  801e28:	83 ec 04             	sub    $0x4,%esp
+  801e2b:	53                   	push   %ebx
+  801e2c:	ff 75 0c             	push   0xc(%ebp)
+  801e2f:	68 00 10 c0 9f       	push   $0x9fc01000
+  801e34:	e8 92 ed ff ff       	call   800bcb <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  801e39:	8b 46 0c             	mov    0xc(%esi),%eax
+  801e3c:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  801e41:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  801e47:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801e4e:	89 f9                	mov    %edi,%ecx
+  801e50:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801e55:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801e5a:	e8 69 fa ff ff       	call   8018c8 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801e5f:	6a 00                	push   $0x0
+  801e61:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801e64:	50                   	push   %eax
+  801e65:	6a 00                	push   $0x0
+  801e67:	6a 00                	push   $0x0
+  801e69:	e8 c6 0e 00 00       	call   802d34 <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  801e6e:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  801e71:	eb 8a                	jmp    801dfd <devfile_write+0x47>
+
+00801e73 <open>:
+{
+  801e73:	55                   	push   %ebp
+  801e74:	89 e5                	mov    %esp,%ebp
+  801e76:	56                   	push   %esi
+  801e77:	53                   	push   %ebx
+  801e78:	83 ec 1c             	sub    $0x1c,%esp
+  801e7b:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801e7e:	56                   	push   %esi
+  801e7f:	e8 86 eb ff ff       	call   800a0a <strlen>
+  801e84:	83 c4 10             	add    $0x10,%esp
+  801e87:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801e8c:	7f 6c                	jg     801efa <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  801e8e:	83 ec 0c             	sub    $0xc,%esp
+  801e91:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e94:	50                   	push   %eax
+  801e95:	e8 ad f4 ff ff       	call   801347 <fd_alloc>
+  801e9a:	89 c3                	mov    %eax,%ebx
+  801e9c:	83 c4 10             	add    $0x10,%esp
+  801e9f:	85 c0                	test   %eax,%eax
+  801ea1:	78 3c                	js     801edf <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801ea3:	83 ec 08             	sub    $0x8,%esp
+  801ea6:	56                   	push   %esi
+  801ea7:	68 00 60 90 00       	push   $0x906000
+  801eac:	e8 94 eb ff ff       	call   800a45 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801eb1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801eb4:	a3 00 64 90 00       	mov    %eax,0x906400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801eb9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801ebc:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ec1:	e8 1b fb ff ff       	call   8019e1 <fsipc>
+  801ec6:	89 c3                	mov    %eax,%ebx
+  801ec8:	83 c4 10             	add    $0x10,%esp
+  801ecb:	85 c0                	test   %eax,%eax
+  801ecd:	78 19                	js     801ee8 <open+0x75>
+  return fd2num(fd);
+  801ecf:	83 ec 0c             	sub    $0xc,%esp
+  801ed2:	ff 75 f4             	push   -0xc(%ebp)
+  801ed5:	e8 49 f4 ff ff       	call   801323 <fd2num>
+  801eda:	89 c3                	mov    %eax,%ebx
+  801edc:	83 c4 10             	add    $0x10,%esp
+}
+  801edf:	89 d8                	mov    %ebx,%eax
+  801ee1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ee4:	5b                   	pop    %ebx
+  801ee5:	5e                   	pop    %esi
+  801ee6:	5d                   	pop    %ebp
+  801ee7:	c3                   	ret
+    fd_close(fd, 0);
+  801ee8:	83 ec 08             	sub    $0x8,%esp
+  801eeb:	6a 00                	push   $0x0
+  801eed:	ff 75 f4             	push   -0xc(%ebp)
+  801ef0:	e8 44 f5 ff ff       	call   801439 <fd_close>
+    return r;
+  801ef5:	83 c4 10             	add    $0x10,%esp
+  801ef8:	eb e5                	jmp    801edf <open+0x6c>
+    return -E_BAD_PATH;
+  801efa:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801eff:	eb de                	jmp    801edf <open+0x6c>
+
+00801f01 <open_read>:
+{
+  801f01:	55                   	push   %ebp
+  801f02:	89 e5                	mov    %esp,%ebp
+  801f04:	57                   	push   %edi
+  801f05:	56                   	push   %esi
+  801f06:	53                   	push   %ebx
+  801f07:	83 ec 28             	sub    $0x28,%esp
+  801f0a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  801f0d:	57                   	push   %edi
+  801f0e:	e8 f7 ea ff ff       	call   800a0a <strlen>
+  801f13:	83 c4 10             	add    $0x10,%esp
+  801f16:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801f1b:	0f 87 f6 00 00 00    	ja     802017 <open_read+0x116>
+  801f21:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  801f23:	83 ec 0c             	sub    $0xc,%esp
+  801f26:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801f29:	50                   	push   %eax
+  801f2a:	e8 18 f4 ff ff       	call   801347 <fd_alloc>
+  801f2f:	89 c3                	mov    %eax,%ebx
+  801f31:	83 c4 10             	add    $0x10,%esp
+  801f34:	85 c0                	test   %eax,%eax
+  801f36:	0f 88 b2 00 00 00    	js     801fee <open_read+0xed>
+  strcpy(req->req_buf, path);
+  801f3c:	83 ec 08             	sub    $0x8,%esp
+  801f3f:	57                   	push   %edi
+  801f40:	68 e4 60 90 00       	push   $0x9060e4
+  801f45:	e8 fb ea ff ff       	call   800a45 <strcpy>
+  req->req_nops = 2;
+  801f4a:	c7 05 00 60 90 00 02 	movl   $0x2,0x906000
+  801f51:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  801f54:	c7 05 04 60 90 00 01 	movl   $0x1,0x906004
+  801f5b:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  801f5e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f61:	a3 10 60 90 00       	mov    %eax,0x906010
+  req->req_ops[0].op_buf = 0;
+  801f66:	c7 05 18 60 90 00 00 	movl   $0x0,0x906018
+  801f6d:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  801f70:	c7 05 20 60 90 00 04 	movl   $0x4,0x906020
+  801f77:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  801f7a:	c7 05 24 60 90 00 01 	movl   $0x1,0x906024
+  801f81:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  801f84:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  801f89:	29 f0                	sub    %esi,%eax
+  801f8b:	3b 45 14             	cmp    0x14(%ebp),%eax
+  801f8e:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  801f92:	a3 2c 60 90 00       	mov    %eax,0x90602c
+  req->req_ops[1].op_offset = 0;
+  801f97:	c7 05 30 60 90 00 00 	movl   $0x0,0x906030
+  801f9e:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  801fa1:	83 c6 01             	add    $0x1,%esi
+  801fa4:	89 35 34 60 90 00    	mov    %esi,0x906034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  801faa:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801fad:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801fb2:	e8 2a fa ff ff       	call   8019e1 <fsipc>
+  801fb7:	89 c3                	mov    %eax,%ebx
+  801fb9:	83 c4 10             	add    $0x10,%esp
+  801fbc:	83 f8 01             	cmp    $0x1,%eax
+  801fbf:	7e 37                	jle    801ff8 <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  801fc1:	a1 38 60 90 00       	mov    0x906038,%eax
+  801fc6:	8b 55 18             	mov    0x18(%ebp),%edx
+  801fc9:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  801fcb:	83 ec 04             	sub    $0x4,%esp
+  801fce:	50                   	push   %eax
+  801fcf:	81 c6 e4 60 90 00    	add    $0x9060e4,%esi
+  801fd5:	56                   	push   %esi
+  801fd6:	ff 75 10             	push   0x10(%ebp)
+  801fd9:	e8 ed eb ff ff       	call   800bcb <memmove>
+  return fd2num(fd);
+  801fde:	83 c4 04             	add    $0x4,%esp
+  801fe1:	ff 75 e4             	push   -0x1c(%ebp)
+  801fe4:	e8 3a f3 ff ff       	call   801323 <fd2num>
+  801fe9:	89 c3                	mov    %eax,%ebx
+  801feb:	83 c4 10             	add    $0x10,%esp
+}
+  801fee:	89 d8                	mov    %ebx,%eax
+  801ff0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ff3:	5b                   	pop    %ebx
+  801ff4:	5e                   	pop    %esi
+  801ff5:	5f                   	pop    %edi
+  801ff6:	5d                   	pop    %ebp
+  801ff7:	c3                   	ret
+    fd_close(fd, 0);
+  801ff8:	83 ec 08             	sub    $0x8,%esp
+  801ffb:	6a 00                	push   $0x0
+  801ffd:	ff 75 e4             	push   -0x1c(%ebp)
+  802000:	e8 34 f4 ff ff       	call   801439 <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  802005:	83 c4 10             	add    $0x10,%esp
+  802008:	85 db                	test   %ebx,%ebx
+  80200a:	78 e2                	js     801fee <open_read+0xed>
+  80200c:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  80200f:	8b 9b 1c 60 90 00    	mov    0x90601c(%ebx),%ebx
+  802015:	eb d7                	jmp    801fee <open_read+0xed>
+    return -E_BAD_PATH;
+  802017:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80201c:	eb d0                	jmp    801fee <open_read+0xed>
+
+0080201e <file_stat>:
+{
+  80201e:	55                   	push   %ebp
+  80201f:	89 e5                	mov    %esp,%ebp
+  802021:	57                   	push   %edi
+  802022:	56                   	push   %esi
+  802023:	53                   	push   %ebx
+  802024:	83 ec 18             	sub    $0x18,%esp
+  802027:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80202a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  80202d:	57                   	push   %edi
+  80202e:	e8 d7 e9 ff ff       	call   800a0a <strlen>
+  802033:	83 c4 10             	add    $0x10,%esp
+  802036:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80203b:	0f 8f c7 00 00 00    	jg     802108 <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  802041:	83 ec 0c             	sub    $0xc,%esp
+  802044:	57                   	push   %edi
+  802045:	e8 c0 e9 ff ff       	call   800a0a <strlen>
+  80204a:	8d 58 04             	lea    0x4(%eax),%ebx
+  80204d:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  802050:	83 c4 08             	add    $0x8,%esp
+  802053:	57                   	push   %edi
+  802054:	68 e4 60 90 00       	push   $0x9060e4
+  802059:	e8 e7 e9 ff ff       	call   800a45 <strcpy>
+  req->req_nops = 2;
+  80205e:	c7 05 00 60 90 00 02 	movl   $0x2,0x906000
+  802065:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  802068:	c7 05 04 60 90 00 02 	movl   $0x2,0x906004
+  80206f:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  802072:	c7 05 10 60 90 00 00 	movl   $0x0,0x906010
+  802079:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  80207c:	c7 05 18 60 90 00 00 	movl   $0x0,0x906018
+  802083:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  802086:	c7 05 20 60 90 00 03 	movl   $0x3,0x906020
+  80208d:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  802090:	c7 05 24 60 90 00 01 	movl   $0x1,0x906024
+  802097:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  80209a:	89 1d 34 60 90 00    	mov    %ebx,0x906034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  8020a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020a5:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8020aa:	e8 32 f9 ff ff       	call   8019e1 <fsipc>
+  8020af:	83 c4 10             	add    $0x10,%esp
+  8020b2:	83 f8 01             	cmp    $0x1,%eax
+  8020b5:	7e 42                	jle    8020f9 <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  8020b7:	81 c3 e4 60 90 00    	add    $0x9060e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  8020bd:	83 ec 08             	sub    $0x8,%esp
+  8020c0:	53                   	push   %ebx
+  8020c1:	56                   	push   %esi
+  8020c2:	e8 7e e9 ff ff       	call   800a45 <strcpy>
+  st->st_size = ret->ret_size;
+  8020c7:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  8020cd:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  8020d3:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  8020d9:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  8020df:	c7 86 88 00 00 00 04 	movl   $0x804004,0x88(%esi)
+  8020e6:	40 80 00 
+  return 0;
+  8020e9:	83 c4 10             	add    $0x10,%esp
+  8020ec:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020f1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020f4:	5b                   	pop    %ebx
+  8020f5:	5e                   	pop    %esi
+  8020f6:	5f                   	pop    %edi
+  8020f7:	5d                   	pop    %ebp
+  8020f8:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  8020f9:	85 c0                	test   %eax,%eax
+  8020fb:	78 f4                	js     8020f1 <file_stat+0xd3>
+  8020fd:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802100:	8b 80 1c 60 90 00    	mov    0x90601c(%eax),%eax
+  802106:	eb e9                	jmp    8020f1 <file_stat+0xd3>
+    return -E_BAD_PATH;
+  802108:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  80210d:	eb e2                	jmp    8020f1 <file_stat+0xd3>
+
+0080210f <read_map>:
+{
+  80210f:	55                   	push   %ebp
+  802110:	89 e5                	mov    %esp,%ebp
+  802112:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802115:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802118:	50                   	push   %eax
+  802119:	ff 75 08             	push   0x8(%ebp)
+  80211c:	e8 7c f2 ff ff       	call   80139d <fd_lookup>
+  802121:	83 c4 10             	add    $0x10,%esp
+  802124:	85 c0                	test   %eax,%eax
+  802126:	78 2a                	js     802152 <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  802128:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80212b:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  802131:	39 08                	cmp    %ecx,(%eax)
+  802133:	75 1f                	jne    802154 <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  802135:	8b 40 0c             	mov    0xc(%eax),%eax
+  802138:	a3 00 60 90 00       	mov    %eax,0x906000
+  fsipcbuf.read_map.req_offset = offset;
+  80213d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802140:	a3 04 60 90 00       	mov    %eax,0x906004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  802145:	8b 55 10             	mov    0x10(%ebp),%edx
+  802148:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80214d:	e8 8f f8 ff ff       	call   8019e1 <fsipc>
+}
+  802152:	c9                   	leave
+  802153:	c3                   	ret
+    return -E_INVAL;
+  802154:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802159:	eb f7                	jmp    802152 <read_map+0x43>
+
+0080215b <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80215b:	55                   	push   %ebp
+  80215c:	89 e5                	mov    %esp,%ebp
+  80215e:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  802161:	ba 00 00 00 00       	mov    $0x0,%edx
+  802166:	b8 08 00 00 00       	mov    $0x8,%eax
+  80216b:	e8 71 f8 ff ff       	call   8019e1 <fsipc>
+}
+  802170:	c9                   	leave
+  802171:	c3                   	ret
+
+00802172 <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  802172:	55                   	push   %ebp
+  802173:	89 e5                	mov    %esp,%ebp
+  802175:	57                   	push   %edi
+  802176:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  802177:	8b 45 08             	mov    0x8(%ebp),%eax
+  80217a:	a3 00 60 90 00       	mov    %eax,0x906000
+  fsipcbuf.stats.req_bio_sched = 0;
+  80217f:	c7 05 04 60 90 00 00 	movl   $0x0,0x906004
+  802186:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  802189:	c7 05 08 60 90 00 00 	movl   $0x0,0x906008
+  802190:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  802193:	ba 00 00 00 00       	mov    $0x0,%edx
+  802198:	b8 09 00 00 00       	mov    $0x9,%eax
+  80219d:	e8 3f f8 ff ff       	call   8019e1 <fsipc>
+  8021a2:	85 c0                	test   %eax,%eax
+  8021a4:	78 14                	js     8021ba <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  8021a6:	be 00 60 90 00       	mov    $0x906000,%esi
+  8021ab:	b9 16 00 00 00       	mov    $0x16,%ecx
+  8021b0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8021b3:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  8021b5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021ba:	5e                   	pop    %esi
+  8021bb:	5f                   	pop    %edi
+  8021bc:	5d                   	pop    %ebp
+  8021bd:	c3                   	ret
+
+008021be <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  8021be:	55                   	push   %ebp
+  8021bf:	89 e5                	mov    %esp,%ebp
+  8021c1:	53                   	push   %ebx
+  8021c2:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  8021c5:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8021c8:	50                   	push   %eax
+  8021c9:	6a 00                	push   $0x0
+  8021cb:	e8 a2 ff ff ff       	call   802172 <fs_stats>
+  8021d0:	83 c4 10             	add    $0x10,%esp
+  8021d3:	85 c0                	test   %eax,%eax
+  8021d5:	78 28                	js     8021ff <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  8021d7:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  8021da:	83 ec 08             	sub    $0x8,%esp
+  8021dd:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8021e0:	50                   	push   %eax
+  8021e1:	6a 20                	push   $0x20
+  8021e3:	e8 8a ff ff ff       	call   802172 <fs_stats>
+  8021e8:	83 c4 10             	add    $0x10,%esp
+  8021eb:	85 c0                	test   %eax,%eax
+  8021ed:	78 10                	js     8021ff <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  8021ef:	83 ec 08             	sub    $0x8,%esp
+  8021f2:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8021f5:	50                   	push   %eax
+  8021f6:	53                   	push   %ebx
+  8021f7:	e8 76 ff ff ff       	call   802172 <fs_stats>
+  8021fc:	83 c4 10             	add    $0x10,%esp
+}
+  8021ff:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802202:	c9                   	leave
+  802203:	c3                   	ret
+
+00802204 <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  802204:	55                   	push   %ebp
+  802205:	89 e5                	mov    %esp,%ebp
+  802207:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  80220a:	c7 05 00 60 90 00 00 	movl   $0x0,0x906000
+  802211:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  802214:	8b 45 08             	mov    0x8(%ebp),%eax
+  802217:	a3 04 60 90 00       	mov    %eax,0x906004
+  fsipcbuf.stats.req_dcache = 0;
+  80221c:	c7 05 08 60 90 00 00 	movl   $0x0,0x906008
+  802223:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  802226:	ba 00 00 00 00       	mov    $0x0,%edx
+  80222b:	b8 09 00 00 00       	mov    $0x9,%eax
+  802230:	e8 ac f7 ff ff       	call   8019e1 <fsipc>
+}
+  802235:	c9                   	leave
+  802236:	c3                   	ret
+
+00802237 <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  802237:	55                   	push   %ebp
+  802238:	89 e5                	mov    %esp,%ebp
+  80223a:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  80223d:	c7 05 00 60 90 00 00 	movl   $0x0,0x906000
+  802244:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  802247:	c7 05 04 60 90 00 00 	movl   $0x0,0x906004
+  80224e:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  802251:	8b 45 08             	mov    0x8(%ebp),%eax
+  802254:	a3 08 60 90 00       	mov    %eax,0x906008
+  return fsipc(FSREQ_STATS, NULL);
+  802259:	ba 00 00 00 00       	mov    $0x0,%edx
+  80225e:	b8 09 00 00 00       	mov    $0x9,%eax
+  802263:	e8 79 f7 ff ff       	call   8019e1 <fsipc>
+}
+  802268:	c9                   	leave
+  802269:	c3                   	ret
+
+0080226a <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  80226a:	55                   	push   %ebp
+  80226b:	89 e5                	mov    %esp,%ebp
+  80226d:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802270:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802273:	50                   	push   %eax
+  802274:	ff 75 08             	push   0x8(%ebp)
+  802277:	e8 21 f1 ff ff       	call   80139d <fd_lookup>
+  80227c:	83 c4 10             	add    $0x10,%esp
+  80227f:	85 c0                	test   %eax,%eax
+  802281:	78 34                	js     8022b7 <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  802283:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802286:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  80228c:	39 08                	cmp    %ecx,(%eax)
+  80228e:	75 29                	jne    8022b9 <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  802290:	8b 40 0c             	mov    0xc(%eax),%eax
+  802293:	a3 00 60 90 00       	mov    %eax,0x906000
+  fsipcbuf.fallocate.req_offset = offset;
+  802298:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80229b:	a3 04 60 90 00       	mov    %eax,0x906004
+  fsipcbuf.fallocate.req_len = len;
+  8022a0:	8b 45 10             	mov    0x10(%ebp),%eax
+  8022a3:	a3 08 60 90 00       	mov    %eax,0x906008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  8022a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022ad:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8022b2:	e8 2a f7 ff ff       	call   8019e1 <fsipc>
+}
+  8022b7:	c9                   	leave
+  8022b8:	c3                   	ret
+    return -E_INVAL;
+  8022b9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8022be:	eb f7                	jmp    8022b7 <fallocate+0x4d>
+
+008022c0 <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  8022c0:	55                   	push   %ebp
+  8022c1:	89 e5                	mov    %esp,%ebp
+  8022c3:	57                   	push   %edi
+  8022c4:	56                   	push   %esi
+  8022c5:	53                   	push   %ebx
+  8022c6:	83 ec 24             	sub    $0x24,%esp
+  8022c9:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8022cc:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8022cf:	50                   	push   %eax
+  8022d0:	ff 75 08             	push   0x8(%ebp)
+  8022d3:	e8 c5 f0 ff ff       	call   80139d <fd_lookup>
+  8022d8:	83 c4 10             	add    $0x10,%esp
+  8022db:	85 c0                	test   %eax,%eax
+  8022dd:	78 66                	js     802345 <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  8022df:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8022e2:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  8022e8:	39 08                	cmp    %ecx,(%eax)
+  8022ea:	75 61                	jne    80234d <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  8022ec:	85 f6                	test   %esi,%esi
+  8022ee:	7e 50                	jle    802340 <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  8022f0:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  8022f5:	39 de                	cmp    %ebx,%esi
+  8022f7:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  8022fa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8022fd:	8b 40 0c             	mov    0xc(%eax),%eax
+  802300:	a3 00 60 90 00       	mov    %eax,0x906000
+    fsipcbuf.prefetch.req_n = m;
+  802305:	89 1d 04 60 90 00    	mov    %ebx,0x906004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  80230b:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  802312:	83 ec 04             	sub    $0x4,%esp
+  802315:	57                   	push   %edi
+  802316:	ff 75 0c             	push   0xc(%ebp)
+  802319:	68 08 60 90 00       	push   $0x906008
+  80231e:	e8 a8 e8 ff ff       	call   800bcb <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  802323:	ba 00 00 00 00       	mov    $0x0,%edx
+  802328:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80232d:	e8 af f6 ff ff       	call   8019e1 <fsipc>
+  802332:	83 c4 10             	add    $0x10,%esp
+  802335:	85 c0                	test   %eax,%eax
+  802337:	78 0c                	js     802345 <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  802339:	01 7d 0c             	add    %edi,0xc(%ebp)
+  80233c:	29 de                	sub    %ebx,%esi
+  80233e:	eb ac                	jmp    8022ec <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  802340:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802345:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802348:	5b                   	pop    %ebx
+  802349:	5e                   	pop    %esi
+  80234a:	5f                   	pop    %edi
+  80234b:	5d                   	pop    %ebp
+  80234c:	c3                   	ret
+    return -E_INVAL;
+  80234d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802352:	eb f1                	jmp    802345 <prefetch+0x85>
+
+00802354 <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  802354:	55                   	push   %ebp
+  802355:	89 e5                	mov    %esp,%ebp
+  802357:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  80235a:	50                   	push   %eax
+  80235b:	e8 d3 ef ff ff       	call   801333 <fd2data>
+  802360:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  802365:	c9                   	leave
+  802366:	c3                   	ret
+
+00802367 <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802367:	55                   	push   %ebp
+  802368:	89 e5                	mov    %esp,%ebp
+  80236a:	56                   	push   %esi
+  80236b:	53                   	push   %ebx
+  80236c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  80236f:	83 ec 0c             	sub    $0xc,%esp
+  802372:	ff 75 08             	push   0x8(%ebp)
+  802375:	e8 b9 ef ff ff       	call   801333 <fd2data>
+  80237a:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  80237c:	83 c4 08             	add    $0x8,%esp
+  80237f:	68 48 36 80 00       	push   $0x803648
+  802384:	53                   	push   %ebx
+  802385:	e8 bb e6 ff ff       	call   800a45 <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  80238a:	8b 46 04             	mov    0x4(%esi),%eax
+  80238d:	2b 06                	sub    (%esi),%eax
+  80238f:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  802395:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80239c:	00 00 00 
+  stat->st_dev = &devpipe;
+  80239f:	c7 83 88 00 00 00 20 	movl   $0x804020,0x88(%ebx)
+  8023a6:	40 80 00 
+  return 0;
+}
+  8023a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023ae:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023b1:	5b                   	pop    %ebx
+  8023b2:	5e                   	pop    %esi
+  8023b3:	5d                   	pop    %ebp
+  8023b4:	c3                   	ret
+
+008023b5 <pipe_wakeup>:
+{
+  8023b5:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  8023b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023bc:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  8023bf:	85 c0                	test   %eax,%eax
+  8023c1:	75 01                	jne    8023c4 <pipe_wakeup+0xf>
+  8023c3:	c3                   	ret
+{
+  8023c4:	55                   	push   %ebp
+  8023c5:	89 e5                	mov    %esp,%ebp
+  8023c7:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  8023ca:	6a 00                	push   $0x0
+  8023cc:	68 00 00 c0 ee       	push   $0xeec00000
+  8023d1:	52                   	push   %edx
+  8023d2:	e8 f9 ed ff ff       	call   8011d0 <sys_chan_wakeup>
+  8023d7:	83 c4 10             	add    $0x10,%esp
+}
+  8023da:	c9                   	leave
+  8023db:	c3                   	ret
+
+008023dc <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8023dc:	55                   	push   %ebp
+  8023dd:	89 e5                	mov    %esp,%ebp
+  8023df:	57                   	push   %edi
+  8023e0:	56                   	push   %esi
+  8023e1:	53                   	push   %ebx
+  8023e2:	83 ec 18             	sub    $0x18,%esp
+  8023e5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  8023e8:	57                   	push   %edi
+  8023e9:	e8 45 ef ff ff       	call   801333 <fd2data>
+  8023ee:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  8023f0:	83 c4 10             	add    $0x10,%esp
+  8023f3:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  8023f7:	74 2a                	je     802423 <devpipe_close+0x47>
+  8023f9:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  8023fe:	89 f8                	mov    %edi,%eax
+  802400:	e8 4f ff ff ff       	call   802354 <pipe_ring>
+  802405:	83 ec 08             	sub    $0x8,%esp
+  802408:	01 d8                	add    %ebx,%eax
+  80240a:	50                   	push   %eax
+  80240b:	6a 00                	push   $0x0
+  80240d:	e8 e7 ea ff ff       	call   800ef9 <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  802412:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802418:	83 c4 10             	add    $0x10,%esp
+  80241b:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  802421:	75 db                	jne    8023fe <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  802423:	83 ec 08             	sub    $0x8,%esp
+  802426:	57                   	push   %edi
+  802427:	6a 00                	push   $0x0
+  802429:	e8 cb ea ff ff       	call   800ef9 <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  80242e:	83 c4 10             	add    $0x10,%esp
+  802431:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  802435:	75 13                	jne    80244a <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  802437:	83 ec 08             	sub    $0x8,%esp
+  80243a:	56                   	push   %esi
+  80243b:	6a 00                	push   $0x0
+  80243d:	e8 b7 ea ff ff       	call   800ef9 <sys_page_unmap>
+}
+  802442:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802445:	5b                   	pop    %ebx
+  802446:	5e                   	pop    %esi
+  802447:	5f                   	pop    %edi
+  802448:	5d                   	pop    %ebp
+  802449:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  80244a:	8d 56 04             	lea    0x4(%esi),%edx
+  80244d:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802450:	e8 60 ff ff ff       	call   8023b5 <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802455:	8d 46 30             	lea    0x30(%esi),%eax
+  802458:	89 f2                	mov    %esi,%edx
+  80245a:	e8 56 ff ff ff       	call   8023b5 <pipe_wakeup>
+  80245f:	eb d6                	jmp    802437 <devpipe_close+0x5b>
+
+00802461 <_pipeisclosed>:
+{
+  802461:	55                   	push   %ebp
+  802462:	89 e5                	mov    %esp,%ebp
+  802464:	57                   	push   %edi
+  802465:	56                   	push   %esi
+  802466:	53                   	push   %ebx
+  802467:	83 ec 1c             	sub    $0x1c,%esp
+  80246a:	89 c7                	mov    %eax,%edi
+  80246c:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  80246e:	a1 44 57 90 00       	mov    0x905744,%eax
+  802473:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  802476:	83 ec 0c             	sub    $0xc,%esp
+  802479:	57                   	push   %edi
+  80247a:	e8 18 0a 00 00       	call   802e97 <pageref>
+  80247f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802482:	89 34 24             	mov    %esi,(%esp)
+  802485:	e8 0d 0a 00 00       	call   802e97 <pageref>
+    nn = thisenv->env_runs;
+  80248a:	8b 15 44 57 90 00    	mov    0x905744,%edx
+  802490:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  802493:	83 c4 10             	add    $0x10,%esp
+  802496:	39 cb                	cmp    %ecx,%ebx
+  802498:	74 1b                	je     8024b5 <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  80249a:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80249d:	75 cf                	jne    80246e <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80249f:	8b 42 58             	mov    0x58(%edx),%eax
+  8024a2:	6a 01                	push   $0x1
+  8024a4:	50                   	push   %eax
+  8024a5:	53                   	push   %ebx
+  8024a6:	68 4f 36 80 00       	push   $0x80364f
+  8024ab:	e8 a7 df ff ff       	call   800457 <cprintf>
+  8024b0:	83 c4 10             	add    $0x10,%esp
+  8024b3:	eb b9                	jmp    80246e <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  8024b5:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8024b8:	0f 94 c0             	sete   %al
+  8024bb:	0f b6 c0             	movzbl %al,%eax
+}
+  8024be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024c1:	5b                   	pop    %ebx
+  8024c2:	5e                   	pop    %esi
+  8024c3:	5f                   	pop    %edi
+  8024c4:	5d                   	pop    %ebp
+  8024c5:	c3                   	ret
+
+008024c6 <devpipe_write_bulk>:
+{
+  8024c6:	55                   	push   %ebp
+  8024c7:	89 e5                	mov    %esp,%ebp
+  8024c9:	57                   	push   %edi
+  8024ca:	56                   	push   %esi
+  8024cb:	53                   	push   %ebx
+  8024cc:	83 ec 1c             	sub    $0x1c,%esp
+  8024cf:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8024d2:	89 d6                	mov    %edx,%esi
+  8024d4:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  8024d7:	e8 78 fe ff ff       	call   802354 <pipe_ring>
+  8024dc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  8024df:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  8024e4:	8d 46 04             	lea    0x4(%esi),%eax
+  8024e7:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  8024ea:	eb 75                	jmp    802561 <devpipe_write_bulk+0x9b>
+  8024ec:	b8 01 00 00 00       	mov    $0x1,%eax
+  8024f1:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  8024f5:	6a 64                	push   $0x64
+  8024f7:	68 00 00 c0 ee       	push   $0xeec00000
+  8024fc:	53                   	push   %ebx
+  8024fd:	56                   	push   %esi
+  8024fe:	e8 aa ec ff ff       	call   8011ad <sys_chan_sleep>
+      continue;
+  802503:	83 c4 10             	add    $0x10,%esp
+  802506:	eb 59                	jmp    802561 <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  802508:	89 d1                	mov    %edx,%ecx
+  80250a:	c1 f9 1f             	sar    $0x1f,%ecx
+  80250d:	c1 e9 11             	shr    $0x11,%ecx
+  802510:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802513:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802518:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  80251a:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  802520:	29 d3                	sub    %edx,%ebx
+  802522:	ba 00 80 00 00       	mov    $0x8000,%edx
+  802527:	29 c2                	sub    %eax,%edx
+  802529:	39 d3                	cmp    %edx,%ebx
+  80252b:	0f 47 da             	cmova  %edx,%ebx
+  80252e:	8b 55 08             	mov    0x8(%ebp),%edx
+  802531:	29 fa                	sub    %edi,%edx
+  802533:	39 d3                	cmp    %edx,%ebx
+  802535:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  802538:	83 ec 04             	sub    $0x4,%esp
+  80253b:	53                   	push   %ebx
+  80253c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80253f:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  802542:	52                   	push   %edx
+  802543:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802546:	01 c8                	add    %ecx,%eax
+  802548:	50                   	push   %eax
+  802549:	e8 df e6 ff ff       	call   800c2d <memcpy>
+    i += m;
+  80254e:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  802550:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802553:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802556:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802559:	e8 57 fe ff ff       	call   8023b5 <pipe_wakeup>
+  80255e:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802561:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802564:	73 2b                	jae    802591 <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  802566:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  802568:	8b 56 04             	mov    0x4(%esi),%edx
+  80256b:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  802571:	39 d0                	cmp    %edx,%eax
+  802573:	7d 93                	jge    802508 <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  802575:	89 f2                	mov    %esi,%edx
+  802577:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80257a:	e8 e2 fe ff ff       	call   802461 <_pipeisclosed>
+  80257f:	85 c0                	test   %eax,%eax
+  802581:	0f 84 65 ff ff ff    	je     8024ec <devpipe_write_bulk+0x26>
+        return i;
+  802587:	89 f8                	mov    %edi,%eax
+}
+  802589:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80258c:	5b                   	pop    %ebx
+  80258d:	5e                   	pop    %esi
+  80258e:	5f                   	pop    %edi
+  80258f:	5d                   	pop    %ebp
+  802590:	c3                   	ret
+  return i;
+  802591:	89 f8                	mov    %edi,%eax
+  802593:	eb f4                	jmp    802589 <devpipe_write_bulk+0xc3>
+
+00802595 <devpipe_write>:
+{
+  802595:	55                   	push   %ebp
+  802596:	89 e5                	mov    %esp,%ebp
+  802598:	57                   	push   %edi
+  802599:	56                   	push   %esi
+  80259a:	53                   	push   %ebx
+  80259b:	83 ec 28             	sub    $0x28,%esp
+  80259e:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  8025a1:	56                   	push   %esi
+  8025a2:	e8 8c ed ff ff       	call   801333 <fd2data>
+  8025a7:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  8025a9:	8b 78 28             	mov    0x28(%eax),%edi
+  8025ac:	83 c4 10             	add    $0x10,%esp
+  8025af:	85 ff                	test   %edi,%edi
+  8025b1:	75 25                	jne    8025d8 <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  8025b3:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8025b6:	74 66                	je     80261e <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8025b8:	8b 43 04             	mov    0x4(%ebx),%eax
+  8025bb:	8b 0b                	mov    (%ebx),%ecx
+  8025bd:	8d 51 20             	lea    0x20(%ecx),%edx
+  8025c0:	39 d0                	cmp    %edx,%eax
+  8025c2:	72 2b                	jb     8025ef <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  8025c4:	89 da                	mov    %ebx,%edx
+  8025c6:	89 f0                	mov    %esi,%eax
+  8025c8:	e8 94 fe ff ff       	call   802461 <_pipeisclosed>
+  8025cd:	85 c0                	test   %eax,%eax
+  8025cf:	75 51                	jne    802622 <devpipe_write+0x8d>
+      sys_yield();
+  8025d1:	e8 3c e8 ff ff       	call   800e12 <sys_yield>
+  8025d6:	eb e0                	jmp    8025b8 <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  8025d8:	83 ec 0c             	sub    $0xc,%esp
+  8025db:	ff 75 10             	push   0x10(%ebp)
+  8025de:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8025e1:	89 c2                	mov    %eax,%edx
+  8025e3:	89 f0                	mov    %esi,%eax
+  8025e5:	e8 dc fe ff ff       	call   8024c6 <devpipe_write_bulk>
+  8025ea:	83 c4 10             	add    $0x10,%esp
+  8025ed:	eb 38                	jmp    802627 <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8025ef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8025f2:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8025f6:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8025f9:	89 c2                	mov    %eax,%edx
+  8025fb:	c1 fa 1f             	sar    $0x1f,%edx
+  8025fe:	89 d1                	mov    %edx,%ecx
+  802600:	c1 e9 1b             	shr    $0x1b,%ecx
+  802603:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802606:	83 e2 1f             	and    $0x1f,%edx
+  802609:	29 ca                	sub    %ecx,%edx
+  80260b:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  80260f:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  802613:	83 c0 01             	add    $0x1,%eax
+  802616:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  802619:	83 c7 01             	add    $0x1,%edi
+  80261c:	eb 95                	jmp    8025b3 <devpipe_write+0x1e>
+  return i;
+  80261e:	89 f8                	mov    %edi,%eax
+  802620:	eb 05                	jmp    802627 <devpipe_write+0x92>
+        return 0;
+  802622:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802627:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80262a:	5b                   	pop    %ebx
+  80262b:	5e                   	pop    %esi
+  80262c:	5f                   	pop    %edi
+  80262d:	5d                   	pop    %ebp
+  80262e:	c3                   	ret
+
+0080262f <devpipe_read_bulk>:
+{
+  80262f:	55                   	push   %ebp
+  802630:	89 e5                	mov    %esp,%ebp
+  802632:	57                   	push   %edi
+  802633:	56                   	push   %esi
+  802634:	53                   	push   %ebx
+  802635:	83 ec 2c             	sub    $0x2c,%esp
+  802638:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80263b:	89 d6                	mov    %edx,%esi
+  80263d:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802640:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  802643:	e8 0c fd ff ff       	call   802354 <pipe_ring>
+  802648:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  80264b:	85 db                	test   %ebx,%ebx
+  80264d:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802652:	0f 45 c3             	cmovne %ebx,%eax
+  802655:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802658:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  80265d:	8d 46 30             	lea    0x30(%esi),%eax
+  802660:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  802663:	eb 50                	jmp    8026b5 <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  802665:	89 d1                	mov    %edx,%ecx
+  802667:	c1 f9 1f             	sar    $0x1f,%ecx
+  80266a:	c1 e9 11             	shr    $0x11,%ecx
+  80266d:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802670:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802675:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  802677:	29 d3                	sub    %edx,%ebx
+  802679:	ba 00 80 00 00       	mov    $0x8000,%edx
+  80267e:	29 c2                	sub    %eax,%edx
+  802680:	39 d3                	cmp    %edx,%ebx
+  802682:	0f 47 da             	cmova  %edx,%ebx
+  802685:	8b 55 08             	mov    0x8(%ebp),%edx
+  802688:	29 fa                	sub    %edi,%edx
+  80268a:	39 d3                	cmp    %edx,%ebx
+  80268c:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  80268f:	83 ec 04             	sub    $0x4,%esp
+  802692:	53                   	push   %ebx
+  802693:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802696:	01 c8                	add    %ecx,%eax
+  802698:	50                   	push   %eax
+  802699:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80269c:	01 f8                	add    %edi,%eax
+  80269e:	50                   	push   %eax
+  80269f:	e8 89 e5 ff ff       	call   800c2d <memcpy>
+    i += m;
+  8026a4:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  8026a6:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8026a8:	89 f2                	mov    %esi,%edx
+  8026aa:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8026ad:	e8 03 fd ff ff       	call   8023b5 <pipe_wakeup>
+  8026b2:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  8026b5:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  8026b8:	73 51                	jae    80270b <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  8026ba:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  8026bd:	8b 16                	mov    (%esi),%edx
+  8026bf:	39 da                	cmp    %ebx,%edx
+  8026c1:	75 a2                	jne    802665 <devpipe_read_bulk+0x36>
+      if (i > 0)
+  8026c3:	85 ff                	test   %edi,%edi
+  8026c5:	75 44                	jne    80270b <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  8026c7:	89 f2                	mov    %esi,%edx
+  8026c9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8026cc:	e8 90 fd ff ff       	call   802461 <_pipeisclosed>
+  8026d1:	85 c0                	test   %eax,%eax
+  8026d3:	75 3a                	jne    80270f <devpipe_read_bulk+0xe0>
+  8026d5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8026da:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  8026de:	6a 64                	push   $0x64
+  8026e0:	ff 75 d4             	push   -0x2c(%ebp)
+  8026e3:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  8026e4:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  8026e7:	50                   	push   %eax
+  8026e8:	e8 c0 ea ff ff       	call   8011ad <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  8026ed:	85 c0                	test   %eax,%eax
+  8026ef:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026f4:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  8026f7:	83 c4 10             	add    $0x10,%esp
+  8026fa:	a8 01                	test   $0x1,%al
+  8026fc:	74 b7                	je     8026b5 <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  8026fe:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  802703:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802706:	5b                   	pop    %ebx
+  802707:	5e                   	pop    %esi
+  802708:	5f                   	pop    %edi
+  802709:	5d                   	pop    %ebp
+  80270a:	c3                   	ret
+  return i;
+  80270b:	89 f8                	mov    %edi,%eax
+  80270d:	eb f4                	jmp    802703 <devpipe_read_bulk+0xd4>
+        return 0;
+  80270f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802714:	eb ed                	jmp    802703 <devpipe_read_bulk+0xd4>
+
+00802716 <devpipe_read>:
+{
+  802716:	55                   	push   %ebp
+  802717:	89 e5                	mov    %esp,%ebp
+  802719:	57                   	push   %edi
+  80271a:	56                   	push   %esi
+  80271b:	53                   	push   %ebx
+  80271c:	83 ec 18             	sub    $0x18,%esp
+  80271f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  802722:	57                   	push   %edi
+  802723:	e8 0b ec ff ff       	call   801333 <fd2data>
+  802728:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  80272a:	8b 70 28             	mov    0x28(%eax),%esi
+  80272d:	83 c4 10             	add    $0x10,%esp
+  802730:	85 f6                	test   %esi,%esi
+  802732:	75 24                	jne    802758 <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  802734:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802737:	74 60                	je     802799 <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  802739:	8b 03                	mov    (%ebx),%eax
+  80273b:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80273e:	75 3b                	jne    80277b <devpipe_read+0x65>
+      if (i > 0)
+  802740:	85 f6                	test   %esi,%esi
+  802742:	75 2d                	jne    802771 <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  802744:	89 da                	mov    %ebx,%edx
+  802746:	89 f8                	mov    %edi,%eax
+  802748:	e8 14 fd ff ff       	call   802461 <_pipeisclosed>
+  80274d:	85 c0                	test   %eax,%eax
+  80274f:	75 4c                	jne    80279d <devpipe_read+0x87>
+      sys_yield();
+  802751:	e8 bc e6 ff ff       	call   800e12 <sys_yield>
+  802756:	eb e1                	jmp    802739 <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  802758:	83 ec 08             	sub    $0x8,%esp
+  80275b:	6a 00                	push   $0x0
+  80275d:	ff 75 10             	push   0x10(%ebp)
+  802760:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802763:	89 c2                	mov    %eax,%edx
+  802765:	89 f8                	mov    %edi,%eax
+  802767:	e8 c3 fe ff ff       	call   80262f <devpipe_read_bulk>
+  80276c:	83 c4 10             	add    $0x10,%esp
+  80276f:	eb 02                	jmp    802773 <devpipe_read+0x5d>
+        return i;
+  802771:	89 f0                	mov    %esi,%eax
+}
+  802773:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802776:	5b                   	pop    %ebx
+  802777:	5e                   	pop    %esi
+  802778:	5f                   	pop    %edi
+  802779:	5d                   	pop    %ebp
+  80277a:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80277b:	99                   	cltd
+  80277c:	c1 ea 1b             	shr    $0x1b,%edx
+  80277f:	01 d0                	add    %edx,%eax
+  802781:	83 e0 1f             	and    $0x1f,%eax
+  802784:	29 d0                	sub    %edx,%eax
+  802786:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  80278b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80278e:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  802791:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  802794:	83 c6 01             	add    $0x1,%esi
+  802797:	eb 9b                	jmp    802734 <devpipe_read+0x1e>
+  return i;
+  802799:	89 f0                	mov    %esi,%eax
+  80279b:	eb d6                	jmp    802773 <devpipe_read+0x5d>
+        return 0;
+  80279d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027a2:	eb cf                	jmp    802773 <devpipe_read+0x5d>
+
+008027a4 <pipe2>:
+{
+  8027a4:	55                   	push   %ebp
+  8027a5:	89 e5                	mov    %esp,%ebp
+  8027a7:	57                   	push   %edi
+  8027a8:	56                   	push   %esi
+  8027a9:	53                   	push   %ebx
+  8027aa:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  8027ad:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8027b0:	50                   	push   %eax
+  8027b1:	e8 91 eb ff ff       	call   801347 <fd_alloc>
+  8027b6:	89 c3                	mov    %eax,%ebx
+  8027b8:	83 c4 10             	add    $0x10,%esp
+  8027bb:	85 c0                	test   %eax,%eax
+  8027bd:	0f 88 fb 01 00 00    	js     8029be <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8027c3:	83 ec 04             	sub    $0x4,%esp
+  8027c6:	68 07 04 00 00       	push   $0x407
+  8027cb:	ff 75 e4             	push   -0x1c(%ebp)
+  8027ce:	6a 00                	push   $0x0
+  8027d0:	e8 9f e6 ff ff       	call   800e74 <sys_page_alloc>
+  8027d5:	89 c3                	mov    %eax,%ebx
+  8027d7:	83 c4 10             	add    $0x10,%esp
+  8027da:	85 c0                	test   %eax,%eax
+  8027dc:	0f 88 dc 01 00 00    	js     8029be <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  8027e2:	83 ec 0c             	sub    $0xc,%esp
+  8027e5:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8027e8:	50                   	push   %eax
+  8027e9:	e8 59 eb ff ff       	call   801347 <fd_alloc>
+  8027ee:	89 c3                	mov    %eax,%ebx
+  8027f0:	83 c4 10             	add    $0x10,%esp
+  8027f3:	85 c0                	test   %eax,%eax
+  8027f5:	0f 88 b3 01 00 00    	js     8029ae <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8027fb:	83 ec 04             	sub    $0x4,%esp
+  8027fe:	68 07 04 00 00       	push   $0x407
+  802803:	ff 75 e0             	push   -0x20(%ebp)
+  802806:	6a 00                	push   $0x0
+  802808:	e8 67 e6 ff ff       	call   800e74 <sys_page_alloc>
+  80280d:	89 c3                	mov    %eax,%ebx
+  80280f:	83 c4 10             	add    $0x10,%esp
+  802812:	85 c0                	test   %eax,%eax
+  802814:	0f 88 94 01 00 00    	js     8029ae <pipe2+0x20a>
+  va = fd2data(fd0);
+  80281a:	83 ec 0c             	sub    $0xc,%esp
+  80281d:	ff 75 e4             	push   -0x1c(%ebp)
+  802820:	e8 0e eb ff ff       	call   801333 <fd2data>
+  802825:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802827:	83 c4 0c             	add    $0xc,%esp
+  80282a:	68 07 04 00 00       	push   $0x407
+  80282f:	50                   	push   %eax
+  802830:	6a 00                	push   $0x0
+  802832:	e8 3d e6 ff ff       	call   800e74 <sys_page_alloc>
+  802837:	89 c3                	mov    %eax,%ebx
+  802839:	83 c4 10             	add    $0x10,%esp
+  80283c:	85 c0                	test   %eax,%eax
+  80283e:	0f 88 5a 01 00 00    	js     80299e <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802844:	83 ec 0c             	sub    $0xc,%esp
+  802847:	ff 75 e0             	push   -0x20(%ebp)
+  80284a:	e8 e4 ea ff ff       	call   801333 <fd2data>
+  80284f:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802856:	50                   	push   %eax
+  802857:	6a 00                	push   $0x0
+  802859:	57                   	push   %edi
+  80285a:	6a 00                	push   $0x0
+  80285c:	e8 56 e6 ff ff       	call   800eb7 <sys_page_map>
+  802861:	89 c3                	mov    %eax,%ebx
+  802863:	83 c4 20             	add    $0x20,%esp
+  802866:	85 c0                	test   %eax,%eax
+  802868:	0f 88 22 01 00 00    	js     802990 <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  80286e:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  802872:	74 72                	je     8028e6 <pipe2+0x142>
+  802874:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  802879:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80287c:	e8 d3 fa ff ff       	call   802354 <pipe_ring>
+  802881:	83 ec 04             	sub    $0x4,%esp
+  802884:	68 07 04 00 00       	push   $0x407
+  802889:	01 f0                	add    %esi,%eax
+  80288b:	50                   	push   %eax
+  80288c:	6a 00                	push   $0x0
+  80288e:	e8 e1 e5 ff ff       	call   800e74 <sys_page_alloc>
+  802893:	89 c3                	mov    %eax,%ebx
+  802895:	83 c4 10             	add    $0x10,%esp
+  802898:	85 c0                	test   %eax,%eax
+  80289a:	0f 88 97 00 00 00    	js     802937 <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  8028a0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8028a3:	e8 ac fa ff ff       	call   802354 <pipe_ring>
+  8028a8:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  8028ab:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8028ae:	e8 a1 fa ff ff       	call   802354 <pipe_ring>
+  8028b3:	83 ec 0c             	sub    $0xc,%esp
+  8028b6:	68 07 04 00 00       	push   $0x407
+  8028bb:	53                   	push   %ebx
+  8028bc:	6a 00                	push   $0x0
+  8028be:	01 f0                	add    %esi,%eax
+  8028c0:	50                   	push   %eax
+  8028c1:	6a 00                	push   $0x0
+  8028c3:	e8 ef e5 ff ff       	call   800eb7 <sys_page_map>
+  8028c8:	89 c3                	mov    %eax,%ebx
+  8028ca:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8028d0:	83 c4 20             	add    $0x20,%esp
+  8028d3:	85 c0                	test   %eax,%eax
+  8028d5:	78 60                	js     802937 <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  8028d7:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  8028dd:	75 9a                	jne    802879 <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  8028df:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  8028e6:	a1 20 40 80 00       	mov    0x804020,%eax
+  8028eb:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8028ee:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  8028f0:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8028f3:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  8028fa:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8028fd:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  8028ff:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802902:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  802909:	83 ec 0c             	sub    $0xc,%esp
+  80290c:	ff 75 e4             	push   -0x1c(%ebp)
+  80290f:	e8 0f ea ff ff       	call   801323 <fd2num>
+  802914:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802917:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  802919:	83 c4 04             	add    $0x4,%esp
+  80291c:	ff 75 e0             	push   -0x20(%ebp)
+  80291f:	e8 ff e9 ff ff       	call   801323 <fd2num>
+  802924:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802927:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  80292a:	83 c4 10             	add    $0x10,%esp
+  80292d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802932:	e9 87 00 00 00       	jmp    8029be <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802937:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  80293c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80293f:	e8 10 fa ff ff       	call   802354 <pipe_ring>
+  802944:	83 ec 08             	sub    $0x8,%esp
+  802947:	01 f0                	add    %esi,%eax
+  802949:	50                   	push   %eax
+  80294a:	6a 00                	push   $0x0
+  80294c:	e8 a8 e5 ff ff       	call   800ef9 <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  802951:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802954:	e8 fb f9 ff ff       	call   802354 <pipe_ring>
+  802959:	83 c4 08             	add    $0x8,%esp
+  80295c:	01 f0                	add    %esi,%eax
+  80295e:	50                   	push   %eax
+  80295f:	6a 00                	push   $0x0
+  802961:	e8 93 e5 ff ff       	call   800ef9 <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802966:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80296c:	83 c4 10             	add    $0x10,%esp
+  80296f:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802975:	75 c5                	jne    80293c <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  802977:	83 ec 0c             	sub    $0xc,%esp
+  80297a:	ff 75 e0             	push   -0x20(%ebp)
+  80297d:	e8 b1 e9 ff ff       	call   801333 <fd2data>
+  802982:	83 c4 08             	add    $0x8,%esp
+  802985:	50                   	push   %eax
+  802986:	6a 00                	push   $0x0
+  802988:	e8 6c e5 ff ff       	call   800ef9 <sys_page_unmap>
+  80298d:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  802990:	83 ec 08             	sub    $0x8,%esp
+  802993:	57                   	push   %edi
+  802994:	6a 00                	push   $0x0
+  802996:	e8 5e e5 ff ff       	call   800ef9 <sys_page_unmap>
+  80299b:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  80299e:	83 ec 08             	sub    $0x8,%esp
+  8029a1:	ff 75 e0             	push   -0x20(%ebp)
+  8029a4:	6a 00                	push   $0x0
+  8029a6:	e8 4e e5 ff ff       	call   800ef9 <sys_page_unmap>
+  8029ab:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  8029ae:	83 ec 08             	sub    $0x8,%esp
+  8029b1:	ff 75 e4             	push   -0x1c(%ebp)
+  8029b4:	6a 00                	push   $0x0
+  8029b6:	e8 3e e5 ff ff       	call   800ef9 <sys_page_unmap>
+  8029bb:	83 c4 10             	add    $0x10,%esp
+}
+  8029be:	89 d8                	mov    %ebx,%eax
+  8029c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029c3:	5b                   	pop    %ebx
+  8029c4:	5e                   	pop    %esi
+  8029c5:	5f                   	pop    %edi
+  8029c6:	5d                   	pop    %ebp
+  8029c7:	c3                   	ret
+
+008029c8 <pipe>:
+{
+  8029c8:	55                   	push   %ebp
+  8029c9:	89 e5                	mov    %esp,%ebp
+  8029cb:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  8029ce:	6a 00                	push   $0x0
+  8029d0:	ff 75 08             	push   0x8(%ebp)
+  8029d3:	e8 cc fd ff ff       	call   8027a4 <pipe2>
+}
+  8029d8:	c9                   	leave
+  8029d9:	c3                   	ret
+
+008029da <pipeisclosed>:
+{
+  8029da:	55                   	push   %ebp
+  8029db:	89 e5                	mov    %esp,%ebp
+  8029dd:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8029e0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8029e3:	50                   	push   %eax
+  8029e4:	ff 75 08             	push   0x8(%ebp)
+  8029e7:	e8 b1 e9 ff ff       	call   80139d <fd_lookup>
+  8029ec:	83 c4 10             	add    $0x10,%esp
+  8029ef:	85 c0                	test   %eax,%eax
+  8029f1:	78 18                	js     802a0b <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  8029f3:	83 ec 0c             	sub    $0xc,%esp
+  8029f6:	ff 75 f4             	push   -0xc(%ebp)
+  8029f9:	e8 35 e9 ff ff       	call   801333 <fd2data>
+  8029fe:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  802a00:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a03:	e8 59 fa ff ff       	call   802461 <_pipeisclosed>
+  802a08:	83 c4 10             	add    $0x10,%esp
+}
+  802a0b:	c9                   	leave
+  802a0c:	c3                   	ret
+
+00802a0d <pipe_splice>:
+{
+  802a0d:	55                   	push   %ebp
+  802a0e:	89 e5                	mov    %esp,%ebp
+  802a10:	57                   	push   %edi
+  802a11:	56                   	push   %esi
+  802a12:	53                   	push   %ebx
+  802a13:	83 ec 34             	sub    $0x34,%esp
+  802a16:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802a19:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802a1c:	50                   	push   %eax
+  802a1d:	ff 75 08             	push   0x8(%ebp)
+  802a20:	e8 78 e9 ff ff       	call   80139d <fd_lookup>
+  802a25:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802a28:	83 c4 10             	add    $0x10,%esp
+  802a2b:	85 c0                	test   %eax,%eax
+  802a2d:	0f 88 d7 00 00 00    	js     802b0a <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  802a33:	83 ec 0c             	sub    $0xc,%esp
+  802a36:	ff 75 e4             	push   -0x1c(%ebp)
+  802a39:	e8 f5 e8 ff ff       	call   801333 <fd2data>
+  802a3e:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802a40:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802a43:	83 c4 10             	add    $0x10,%esp
+  802a46:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802a4c:	39 10                	cmp    %edx,(%eax)
+  802a4e:	0f 85 c1 00 00 00    	jne    802b15 <pipe_splice+0x108>
+  802a54:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  802a58:	0f 84 c0 00 00 00    	je     802b1e <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  802a5e:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802a62:	0f 84 bf 00 00 00    	je     802b27 <pipe_splice+0x11a>
+  802a68:	89 f7                	mov    %esi,%edi
+  802a6a:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  802a70:	0f 85 ba 00 00 00    	jne    802b30 <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802a76:	8d 43 04             	lea    0x4(%ebx),%eax
+  802a79:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802a7c:	eb 38                	jmp    802ab6 <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802a7e:	83 ec 0c             	sub    $0xc,%esp
+  802a81:	68 00 10 00 00       	push   $0x1000
+  802a86:	89 f1                	mov    %esi,%ecx
+  802a88:	89 da                	mov    %ebx,%edx
+  802a8a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802a8d:	e8 34 fa ff ff       	call   8024c6 <devpipe_write_bulk>
+  802a92:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802a95:	83 c4 10             	add    $0x10,%esp
+  802a98:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802a9d:	75 53                	jne    802af2 <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  802a9f:	83 ec 08             	sub    $0x8,%esp
+  802aa2:	56                   	push   %esi
+  802aa3:	6a 00                	push   $0x0
+  802aa5:	e8 4f e4 ff ff       	call   800ef9 <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  802aaa:	83 c7 01             	add    $0x1,%edi
+  802aad:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802ab3:	83 c4 10             	add    $0x10,%esp
+  802ab6:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802ab9:	74 3a                	je     802af5 <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  802abb:	8b 03                	mov    (%ebx),%eax
+  802abd:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802ac0:	75 bc                	jne    802a7e <pipe_splice+0x71>
+  802ac2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ac7:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  802acb:	85 c0                	test   %eax,%eax
+  802acd:	74 af                	je     802a7e <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802acf:	83 ec 04             	sub    $0x4,%esp
+  802ad2:	6a 07                	push   $0x7
+  802ad4:	56                   	push   %esi
+  802ad5:	ff 75 d0             	push   -0x30(%ebp)
+  802ad8:	e8 f3 e6 ff ff       	call   8011d0 <sys_chan_wakeup>
+  802add:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802ae0:	83 c4 10             	add    $0x10,%esp
+  802ae3:	85 c0                	test   %eax,%eax
+  802ae5:	79 b8                	jns    802a9f <pipe_splice+0x92>
+  802ae7:	b8 01 00 00 00       	mov    $0x1,%eax
+  802aec:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802af0:	eb 8c                	jmp    802a7e <pipe_splice+0x71>
+  802af2:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  802af5:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802af9:	75 06                	jne    802b01 <pipe_splice+0xf4>
+  802afb:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802aff:	78 09                	js     802b0a <pipe_splice+0xfd>
+  return i * PGSIZE;
+  802b01:	8b 45 10             	mov    0x10(%ebp),%eax
+  802b04:	c1 e0 0c             	shl    $0xc,%eax
+  802b07:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  802b0a:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802b0d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b10:	5b                   	pop    %ebx
+  802b11:	5e                   	pop    %esi
+  802b12:	5f                   	pop    %edi
+  802b13:	5d                   	pop    %ebp
+  802b14:	c3                   	ret
+    return -E_INVAL;
+  802b15:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802b1c:	eb ec                	jmp    802b0a <pipe_splice+0xfd>
+  802b1e:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802b25:	eb e3                	jmp    802b0a <pipe_splice+0xfd>
+  802b27:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802b2e:	eb da                	jmp    802b0a <pipe_splice+0xfd>
+  802b30:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802b37:	eb d1                	jmp    802b0a <pipe_splice+0xfd>
+
+00802b39 <pipe_splice_read>:
+{
+  802b39:	55                   	push   %ebp
+  802b3a:	89 e5                	mov    %esp,%ebp
+  802b3c:	53                   	push   %ebx
+  802b3d:	83 ec 1c             	sub    $0x1c,%esp
+  802b40:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802b43:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b46:	50                   	push   %eax
+  802b47:	ff 75 08             	push   0x8(%ebp)
+  802b4a:	e8 4e e8 ff ff       	call   80139d <fd_lookup>
+  802b4f:	83 c4 10             	add    $0x10,%esp
+  802b52:	85 c0                	test   %eax,%eax
+  802b54:	78 49                	js     802b9f <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  802b56:	83 ec 0c             	sub    $0xc,%esp
+  802b59:	ff 75 f4             	push   -0xc(%ebp)
+  802b5c:	e8 d2 e7 ff ff       	call   801333 <fd2data>
+  802b61:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802b63:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b66:	83 c4 10             	add    $0x10,%esp
+  802b69:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  802b6f:	39 08                	cmp    %ecx,(%eax)
+  802b71:	75 31                	jne    802ba4 <pipe_splice_read+0x6b>
+  802b73:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  802b77:	74 32                	je     802bab <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  802b79:	8b 48 08             	mov    0x8(%eax),%ecx
+  802b7c:	83 e1 03             	and    $0x3,%ecx
+  802b7f:	83 f9 01             	cmp    $0x1,%ecx
+  802b82:	74 2e                	je     802bb2 <pipe_splice_read+0x79>
+  802b84:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  802b8a:	75 2d                	jne    802bb9 <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  802b8c:	83 ec 08             	sub    $0x8,%esp
+  802b8f:	53                   	push   %ebx
+  802b90:	68 00 10 00 00       	push   $0x1000
+  802b95:	89 d9                	mov    %ebx,%ecx
+  802b97:	e8 93 fa ff ff       	call   80262f <devpipe_read_bulk>
+  802b9c:	83 c4 10             	add    $0x10,%esp
+}
+  802b9f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ba2:	c9                   	leave
+  802ba3:	c3                   	ret
+    return -E_INVAL;
+  802ba4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ba9:	eb f4                	jmp    802b9f <pipe_splice_read+0x66>
+  802bab:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802bb0:	eb ed                	jmp    802b9f <pipe_splice_read+0x66>
+  802bb2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802bb7:	eb e6                	jmp    802b9f <pipe_splice_read+0x66>
+  802bb9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802bbe:	eb df                	jmp    802b9f <pipe_splice_read+0x66>
+
+00802bc0 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  802bc0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bc5:	c3                   	ret
+
+00802bc6 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802bc6:	55                   	push   %ebp
+  802bc7:	89 e5                	mov    %esp,%ebp
+  802bc9:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  802bcc:	68 67 36 80 00       	push   $0x803667
+  802bd1:	ff 75 0c             	push   0xc(%ebp)
+  802bd4:	e8 6c de ff ff       	call   800a45 <strcpy>
+  return 0;
+}
+  802bd9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bde:	c9                   	leave
+  802bdf:	c3                   	ret
+
+00802be0 <devcons_write>:
+{
+  802be0:	55                   	push   %ebp
+  802be1:	89 e5                	mov    %esp,%ebp
+  802be3:	57                   	push   %edi
+  802be4:	56                   	push   %esi
+  802be5:	53                   	push   %ebx
+  802be6:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  802bec:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  802bf1:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  802bf7:	eb 2e                	jmp    802c27 <devcons_write+0x47>
+    m = n - tot;
+  802bf9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802bfc:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  802bfe:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802c03:	39 c3                	cmp    %eax,%ebx
+  802c05:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  802c08:	83 ec 04             	sub    $0x4,%esp
+  802c0b:	53                   	push   %ebx
+  802c0c:	89 f0                	mov    %esi,%eax
+  802c0e:	03 45 0c             	add    0xc(%ebp),%eax
+  802c11:	50                   	push   %eax
+  802c12:	57                   	push   %edi
+  802c13:	e8 b3 df ff ff       	call   800bcb <memmove>
+    sys_cputs(buf, m);
+  802c18:	83 c4 08             	add    $0x8,%esp
+  802c1b:	53                   	push   %ebx
+  802c1c:	57                   	push   %edi
+  802c1d:	e8 53 e1 ff ff       	call   800d75 <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  802c22:	01 de                	add    %ebx,%esi
+  802c24:	83 c4 10             	add    $0x10,%esp
+  802c27:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802c2a:	72 cd                	jb     802bf9 <devcons_write+0x19>
+}
+  802c2c:	89 f0                	mov    %esi,%eax
+  802c2e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c31:	5b                   	pop    %ebx
+  802c32:	5e                   	pop    %esi
+  802c33:	5f                   	pop    %edi
+  802c34:	5d                   	pop    %ebp
+  802c35:	c3                   	ret
+
+00802c36 <devcons_read>:
+{
+  802c36:	55                   	push   %ebp
+  802c37:	89 e5                	mov    %esp,%ebp
+  802c39:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  802c3c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c41:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802c45:	75 07                	jne    802c4e <devcons_read+0x18>
+  802c47:	eb 1f                	jmp    802c68 <devcons_read+0x32>
+    sys_yield();
+  802c49:	e8 c4 e1 ff ff       	call   800e12 <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  802c4e:	e8 40 e1 ff ff       	call   800d93 <sys_cgetc>
+  802c53:	85 c0                	test   %eax,%eax
+  802c55:	74 f2                	je     802c49 <devcons_read+0x13>
+  if (c < 0)
+  802c57:	78 0f                	js     802c68 <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  802c59:	83 f8 04             	cmp    $0x4,%eax
+  802c5c:	74 0c                	je     802c6a <devcons_read+0x34>
+  *(char*)vbuf = c;
+  802c5e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802c61:	88 02                	mov    %al,(%edx)
+  return 1;
+  802c63:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802c68:	c9                   	leave
+  802c69:	c3                   	ret
+    return 0;
+  802c6a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c6f:	eb f7                	jmp    802c68 <devcons_read+0x32>
+
+00802c71 <cputchar>:
+{
+  802c71:	55                   	push   %ebp
+  802c72:	89 e5                	mov    %esp,%ebp
+  802c74:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  802c77:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c7a:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  802c7d:	6a 01                	push   $0x1
+  802c7f:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802c82:	50                   	push   %eax
+  802c83:	e8 ed e0 ff ff       	call   800d75 <sys_cputs>
+}
+  802c88:	83 c4 10             	add    $0x10,%esp
+  802c8b:	c9                   	leave
+  802c8c:	c3                   	ret
+
+00802c8d <getchar>:
+{
+  802c8d:	55                   	push   %ebp
+  802c8e:	89 e5                	mov    %esp,%ebp
+  802c90:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  802c93:	6a 01                	push   $0x1
+  802c95:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802c98:	50                   	push   %eax
+  802c99:	6a 00                	push   $0x0
+  802c9b:	e8 a8 e9 ff ff       	call   801648 <read>
+  if (r < 0)
+  802ca0:	83 c4 10             	add    $0x10,%esp
+  802ca3:	85 c0                	test   %eax,%eax
+  802ca5:	78 06                	js     802cad <getchar+0x20>
+  if (r < 1)
+  802ca7:	74 06                	je     802caf <getchar+0x22>
+  return c;
+  802ca9:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802cad:	c9                   	leave
+  802cae:	c3                   	ret
+    return -E_EOF;
+  802caf:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802cb4:	eb f7                	jmp    802cad <getchar+0x20>
+
+00802cb6 <iscons>:
+{
+  802cb6:	55                   	push   %ebp
+  802cb7:	89 e5                	mov    %esp,%ebp
+  802cb9:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802cbc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802cbf:	50                   	push   %eax
+  802cc0:	ff 75 08             	push   0x8(%ebp)
+  802cc3:	e8 d5 e6 ff ff       	call   80139d <fd_lookup>
+  802cc8:	83 c4 10             	add    $0x10,%esp
+  802ccb:	85 c0                	test   %eax,%eax
+  802ccd:	78 11                	js     802ce0 <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  802ccf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802cd2:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802cd8:	39 10                	cmp    %edx,(%eax)
+  802cda:	0f 94 c0             	sete   %al
+  802cdd:	0f b6 c0             	movzbl %al,%eax
+}
+  802ce0:	c9                   	leave
+  802ce1:	c3                   	ret
+
+00802ce2 <opencons>:
+{
+  802ce2:	55                   	push   %ebp
+  802ce3:	89 e5                	mov    %esp,%ebp
+  802ce5:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  802ce8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802ceb:	50                   	push   %eax
+  802cec:	e8 56 e6 ff ff       	call   801347 <fd_alloc>
+  802cf1:	83 c4 10             	add    $0x10,%esp
+  802cf4:	85 c0                	test   %eax,%eax
+  802cf6:	78 3a                	js     802d32 <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802cf8:	83 ec 04             	sub    $0x4,%esp
+  802cfb:	68 07 04 00 00       	push   $0x407
+  802d00:	ff 75 f4             	push   -0xc(%ebp)
+  802d03:	6a 00                	push   $0x0
+  802d05:	e8 6a e1 ff ff       	call   800e74 <sys_page_alloc>
+  802d0a:	83 c4 10             	add    $0x10,%esp
+  802d0d:	85 c0                	test   %eax,%eax
+  802d0f:	78 21                	js     802d32 <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  802d11:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802d14:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802d1a:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  802d1c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802d1f:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  802d26:	83 ec 0c             	sub    $0xc,%esp
+  802d29:	50                   	push   %eax
+  802d2a:	e8 f4 e5 ff ff       	call   801323 <fd2num>
+  802d2f:	83 c4 10             	add    $0x10,%esp
+}
+  802d32:	c9                   	leave
+  802d33:	c3                   	ret
+
+00802d34 <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  802d34:	55                   	push   %ebp
+  802d35:	89 e5                	mov    %esp,%ebp
+  802d37:	57                   	push   %edi
+  802d38:	56                   	push   %esi
+  802d39:	53                   	push   %ebx
+  802d3a:	83 ec 14             	sub    $0x14,%esp
+  802d3d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802d40:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d43:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802d46:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  802d49:	85 c0                	test   %eax,%eax
+  802d4b:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802d50:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  802d53:	ff 33                	push   (%ebx)
+  802d55:	50                   	push   %eax
+  802d56:	e8 f1 e3 ff ff       	call   80114c <sys_ipc_recv>
+  802d5b:	83 c4 10             	add    $0x10,%esp
+  802d5e:	85 c0                	test   %eax,%eax
+  802d60:	78 39                	js     802d9b <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  802d62:	85 ff                	test   %edi,%edi
+  802d64:	74 0a                	je     802d70 <ipc_recv_pages+0x3c>
+  802d66:	a1 44 57 90 00       	mov    0x905744,%eax
+  802d6b:	8b 40 7c             	mov    0x7c(%eax),%eax
+  802d6e:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  802d70:	85 f6                	test   %esi,%esi
+  802d72:	74 0d                	je     802d81 <ipc_recv_pages+0x4d>
+  802d74:	a1 44 57 90 00       	mov    0x905744,%eax
+  802d79:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  802d7f:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  802d81:	a1 44 57 90 00       	mov    0x905744,%eax
+  802d86:	8b 40 74             	mov    0x74(%eax),%eax
+  802d89:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  802d8b:	a1 44 57 90 00       	mov    0x905744,%eax
+  802d90:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  802d93:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d96:	5b                   	pop    %ebx
+  802d97:	5e                   	pop    %esi
+  802d98:	5f                   	pop    %edi
+  802d99:	5d                   	pop    %ebp
+  802d9a:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  802d9b:	85 ff                	test   %edi,%edi
+  802d9d:	74 06                	je     802da5 <ipc_recv_pages+0x71>
+  802d9f:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  802da5:	85 f6                	test   %esi,%esi
+  802da7:	74 06                	je     802daf <ipc_recv_pages+0x7b>
+  802da9:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  802daf:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  802db5:	eb dc                	jmp    802d93 <ipc_recv_pages+0x5f>
+
+00802db7 <ipc_recv>:
+{
+  802db7:	55                   	push   %ebp
+  802db8:	89 e5                	mov    %esp,%ebp
+  802dba:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  802dbd:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  802dc4:	ff 75 10             	push   0x10(%ebp)
+  802dc7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802dca:	50                   	push   %eax
+  802dcb:	ff 75 0c             	push   0xc(%ebp)
+  802dce:	ff 75 08             	push   0x8(%ebp)
+  802dd1:	e8 5e ff ff ff       	call   802d34 <ipc_recv_pages>
+}
+  802dd6:	c9                   	leave
+  802dd7:	c3                   	ret
+
+00802dd8 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  802dd8:	55                   	push   %ebp
+  802dd9:	89 e5                	mov    %esp,%ebp
+  802ddb:	57                   	push   %edi
+  802ddc:	56                   	push   %esi
+  802ddd:	53                   	push   %ebx
+  802dde:	83 ec 0c             	sub    $0xc,%esp
+  802de1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802de4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802de7:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  802dea:	89 c3                	mov    %eax,%ebx
+  802dec:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  802df2:	85 c0                	test   %eax,%eax
+  802df4:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802df9:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  802dfc:	83 ec 0c             	sub    $0xc,%esp
+  802dff:	ff 75 14             	push   0x14(%ebp)
+  802e02:	ff 75 18             	push   0x18(%ebp)
+  802e05:	53                   	push   %ebx
+  802e06:	56                   	push   %esi
+  802e07:	57                   	push   %edi
+  802e08:	e8 1e e3 ff ff       	call   80112b <sys_ipc_try_send>
+  802e0d:	83 c4 20             	add    $0x20,%esp
+  802e10:	85 c0                	test   %eax,%eax
+  802e12:	79 1e                	jns    802e32 <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  802e14:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802e17:	75 07                	jne    802e20 <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  802e19:	e8 f4 df ff ff       	call   800e12 <sys_yield>
+  802e1e:	eb dc                	jmp    802dfc <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  802e20:	50                   	push   %eax
+  802e21:	68 73 36 80 00       	push   $0x803673
+  802e26:	6a 5c                	push   $0x5c
+  802e28:	68 80 36 80 00       	push   $0x803680
+  802e2d:	e8 4a d5 ff ff       	call   80037c <_panic>
+  }
+}
+  802e32:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e35:	5b                   	pop    %ebx
+  802e36:	5e                   	pop    %esi
+  802e37:	5f                   	pop    %edi
+  802e38:	5d                   	pop    %ebp
+  802e39:	c3                   	ret
+
+00802e3a <ipc_send>:
+{
+  802e3a:	55                   	push   %ebp
+  802e3b:	89 e5                	mov    %esp,%ebp
+  802e3d:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  802e40:	ff 75 14             	push   0x14(%ebp)
+  802e43:	6a 01                	push   $0x1
+  802e45:	ff 75 10             	push   0x10(%ebp)
+  802e48:	ff 75 0c             	push   0xc(%ebp)
+  802e4b:	ff 75 08             	push   0x8(%ebp)
+  802e4e:	e8 85 ff ff ff       	call   802dd8 <ipc_send_pages>
+}
+  802e53:	83 c4 20             	add    $0x20,%esp
+  802e56:	c9                   	leave
+  802e57:	c3                   	ret
+
+00802e58 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802e58:	55                   	push   %ebp
+  802e59:	89 e5                	mov    %esp,%ebp
+  802e5b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  802e5e:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  802e63:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802e66:	c1 e0 04             	shl    $0x4,%eax
+  802e69:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802e6e:	8b 40 50             	mov    0x50(%eax),%eax
+  802e71:	39 c8                	cmp    %ecx,%eax
+  802e73:	74 12                	je     802e87 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  802e75:	83 c2 01             	add    $0x1,%edx
+  802e78:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802e7e:	75 e3                	jne    802e63 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  802e80:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e85:	eb 0e                	jmp    802e95 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  802e87:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802e8a:	c1 e0 04             	shl    $0x4,%eax
+  802e8d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802e92:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802e95:	5d                   	pop    %ebp
+  802e96:	c3                   	ret
+
+00802e97 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802e97:	55                   	push   %ebp
+  802e98:	89 e5                	mov    %esp,%ebp
+  802e9a:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802e9d:	89 c2                	mov    %eax,%edx
+  802e9f:	c1 ea 16             	shr    $0x16,%edx
+  802ea2:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  802ea9:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802eae:	f6 c1 01             	test   $0x1,%cl
+  802eb1:	74 1c                	je     802ecf <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  802eb3:	c1 e8 0c             	shr    $0xc,%eax
+  802eb6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  802ebd:	a8 01                	test   $0x1,%al
+  802ebf:	74 0e                	je     802ecf <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  802ec1:	c1 e8 0c             	shr    $0xc,%eax
+  802ec4:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802ecb:	ef 
+  802ecc:	0f b7 d2             	movzwl %dx,%edx
+}
+  802ecf:	89 d0                	mov    %edx,%eax
+  802ed1:	5d                   	pop    %ebp
+  802ed2:	c3                   	ret
+
+00802ed3 <udivmod>:
+  802ed3:	55                   	push   %ebp
+  802ed4:	57                   	push   %edi
+  802ed5:	56                   	push   %esi
+  802ed6:	53                   	push   %ebx
+  802ed7:	83 ec 14             	sub    $0x14,%esp
+  802eda:	8b 74 24 28          	mov    0x28(%esp),%esi
+  802ede:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  802ee2:	89 fb                	mov    %edi,%ebx
+  802ee4:	09 f3                	or     %esi,%ebx
+  802ee6:	0f 84 88 00 00 00    	je     802f74 <udivmod+0xa1>
+  802eec:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802ef1:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802ef8:	00 
+  802ef9:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802f00:	00 
+  802f01:	89 cd                	mov    %ecx,%ebp
+  802f03:	89 34 24             	mov    %esi,(%esp)
+  802f06:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802f0a:	eb 08                	jmp    802f14 <udivmod+0x41>
+  802f0c:	83 ed 01             	sub    $0x1,%ebp
+  802f0f:	83 fd ff             	cmp    $0xffffffff,%ebp
+  802f12:	74 6c                	je     802f80 <udivmod+0xad>
+  802f14:	89 c3                	mov    %eax,%ebx
+  802f16:	89 d6                	mov    %edx,%esi
+  802f18:	89 e9                	mov    %ebp,%ecx
+  802f1a:	0f ad f3             	shrd   %cl,%esi,%ebx
+  802f1d:	d3 ee                	shr    %cl,%esi
+  802f1f:	f6 c1 20             	test   $0x20,%cl
+  802f22:	74 04                	je     802f28 <udivmod+0x55>
+  802f24:	89 f3                	mov    %esi,%ebx
+  802f26:	31 f6                	xor    %esi,%esi
+  802f28:	8b 3c 24             	mov    (%esp),%edi
+  802f2b:	39 fb                	cmp    %edi,%ebx
+  802f2d:	89 f7                	mov    %esi,%edi
+  802f2f:	8b 1c 24             	mov    (%esp),%ebx
+  802f32:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802f36:	19 f7                	sbb    %esi,%edi
+  802f38:	72 d2                	jb     802f0c <udivmod+0x39>
+  802f3a:	89 f7                	mov    %esi,%edi
+  802f3c:	89 de                	mov    %ebx,%esi
+  802f3e:	89 e9                	mov    %ebp,%ecx
+  802f40:	0f a5 f7             	shld   %cl,%esi,%edi
+  802f43:	d3 e6                	shl    %cl,%esi
+  802f45:	f6 c1 20             	test   $0x20,%cl
+  802f48:	74 04                	je     802f4e <udivmod+0x7b>
+  802f4a:	89 f7                	mov    %esi,%edi
+  802f4c:	31 f6                	xor    %esi,%esi
+  802f4e:	29 f0                	sub    %esi,%eax
+  802f50:	19 fa                	sbb    %edi,%edx
+  802f52:	be 01 00 00 00       	mov    $0x1,%esi
+  802f57:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f5c:	0f a5 f7             	shld   %cl,%esi,%edi
+  802f5f:	d3 e6                	shl    %cl,%esi
+  802f61:	f6 c1 20             	test   $0x20,%cl
+  802f64:	74 04                	je     802f6a <udivmod+0x97>
+  802f66:	89 f7                	mov    %esi,%edi
+  802f68:	31 f6                	xor    %esi,%esi
+  802f6a:	09 74 24 08          	or     %esi,0x8(%esp)
+  802f6e:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802f72:	eb 98                	jmp    802f0c <udivmod+0x39>
+  802f74:	89 f0                	mov    %esi,%eax
+  802f76:	89 fa                	mov    %edi,%edx
+  802f78:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802f7c:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802f80:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802f84:	89 01                	mov    %eax,(%ecx)
+  802f86:	89 51 04             	mov    %edx,0x4(%ecx)
+  802f89:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802f8d:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802f91:	83 c4 14             	add    $0x14,%esp
+  802f94:	5b                   	pop    %ebx
+  802f95:	5e                   	pop    %esi
+  802f96:	5f                   	pop    %edi
+  802f97:	5d                   	pop    %ebp
+  802f98:	c3                   	ret
+
+00802f99 <__udivdi3>:
+  802f99:	83 ec 18             	sub    $0x18,%esp
+  802f9c:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802fa0:	50                   	push   %eax
+  802fa1:	ff 74 24 2c          	push   0x2c(%esp)
+  802fa5:	ff 74 24 2c          	push   0x2c(%esp)
+  802fa9:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802fad:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802fb1:	e8 1d ff ff ff       	call   802ed3 <udivmod>
+  802fb6:	83 c4 24             	add    $0x24,%esp
+  802fb9:	c3                   	ret
+
+00802fba <__umoddi3>:
+  802fba:	83 ec 18             	sub    $0x18,%esp
+  802fbd:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802fc1:	50                   	push   %eax
+  802fc2:	ff 74 24 2c          	push   0x2c(%esp)
+  802fc6:	ff 74 24 2c          	push   0x2c(%esp)
+  802fca:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802fce:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802fd2:	e8 fc fe ff ff       	call   802ed3 <udivmod>
+  802fd7:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802fdb:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802fdf:	83 c4 24             	add    $0x24,%esp
+  802fe2:	c3                   	ret
+
+00802fe3 <__divdi3>:
+  802fe3:	56                   	push   %esi
+  802fe4:	53                   	push   %ebx
+  802fe5:	83 ec 14             	sub    $0x14,%esp
+  802fe8:	8b 44 24 20          	mov    0x20(%esp),%eax
+  802fec:	8b 54 24 24          	mov    0x24(%esp),%edx
+  802ff0:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  802ff4:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  802ff8:	85 d2                	test   %edx,%edx
+  802ffa:	78 18                	js     803014 <__divdi3+0x31>
+  802ffc:	85 db                	test   %ebx,%ebx
+  802ffe:	78 3e                	js     80303e <__divdi3+0x5b>
+  803000:	83 ec 04             	sub    $0x4,%esp
+  803003:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803007:	56                   	push   %esi
+  803008:	53                   	push   %ebx
+  803009:	51                   	push   %ecx
+  80300a:	e8 c4 fe ff ff       	call   802ed3 <udivmod>
+  80300f:	83 c4 10             	add    $0x10,%esp
+  803012:	eb 24                	jmp    803038 <__divdi3+0x55>
+  803014:	f7 d8                	neg    %eax
+  803016:	83 d2 00             	adc    $0x0,%edx
+  803019:	f7 da                	neg    %edx
+  80301b:	85 db                	test   %ebx,%ebx
+  80301d:	78 3a                	js     803059 <__divdi3+0x76>
+  80301f:	83 ec 04             	sub    $0x4,%esp
+  803022:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803026:	56                   	push   %esi
+  803027:	53                   	push   %ebx
+  803028:	51                   	push   %ecx
+  803029:	e8 a5 fe ff ff       	call   802ed3 <udivmod>
+  80302e:	83 c4 10             	add    $0x10,%esp
+  803031:	f7 d8                	neg    %eax
+  803033:	83 d2 00             	adc    $0x0,%edx
+  803036:	f7 da                	neg    %edx
+  803038:	83 c4 14             	add    $0x14,%esp
+  80303b:	5b                   	pop    %ebx
+  80303c:	5e                   	pop    %esi
+  80303d:	c3                   	ret
+  80303e:	83 ec 04             	sub    $0x4,%esp
+  803041:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803045:	56                   	push   %esi
+  803046:	f7 d9                	neg    %ecx
+  803048:	83 d3 00             	adc    $0x0,%ebx
+  80304b:	f7 db                	neg    %ebx
+  80304d:	53                   	push   %ebx
+  80304e:	51                   	push   %ecx
+  80304f:	e8 7f fe ff ff       	call   802ed3 <udivmod>
+  803054:	83 c4 10             	add    $0x10,%esp
+  803057:	eb d8                	jmp    803031 <__divdi3+0x4e>
+  803059:	83 ec 04             	sub    $0x4,%esp
+  80305c:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803060:	56                   	push   %esi
+  803061:	f7 d9                	neg    %ecx
+  803063:	83 d3 00             	adc    $0x0,%ebx
+  803066:	f7 db                	neg    %ebx
+  803068:	53                   	push   %ebx
+  803069:	51                   	push   %ecx
+  80306a:	e8 64 fe ff ff       	call   802ed3 <udivmod>
+  80306f:	83 c4 10             	add    $0x10,%esp
+  803072:	eb c4                	jmp    803038 <__divdi3+0x55>
+
+00803074 <__moddi3>:
+  803074:	55                   	push   %ebp
+  803075:	57                   	push   %edi
+  803076:	56                   	push   %esi
+  803077:	53                   	push   %ebx
+  803078:	83 ec 24             	sub    $0x24,%esp
+  80307b:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80307f:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803083:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  803087:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  80308b:	85 d2                	test   %edx,%edx
+  80308d:	78 3b                	js     8030ca <__moddi3+0x56>
+  80308f:	83 ec 04             	sub    $0x4,%esp
+  803092:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803096:	56                   	push   %esi
+  803097:	89 ce                	mov    %ecx,%esi
+  803099:	f7 de                	neg    %esi
+  80309b:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80309f:	89 de                	mov    %ebx,%esi
+  8030a1:	83 d6 00             	adc    $0x0,%esi
+  8030a4:	f7 de                	neg    %esi
+  8030a6:	89 74 24 14          	mov    %esi,0x14(%esp)
+  8030aa:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8030ae:	0f 48 f1             	cmovs  %ecx,%esi
+  8030b1:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  8030b6:	53                   	push   %ebx
+  8030b7:	56                   	push   %esi
+  8030b8:	e8 16 fe ff ff       	call   802ed3 <udivmod>
+  8030bd:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8030c1:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8030c5:	83 c4 10             	add    $0x10,%esp
+  8030c8:	eb 47                	jmp    803111 <__moddi3+0x9d>
+  8030ca:	f7 d8                	neg    %eax
+  8030cc:	83 d2 00             	adc    $0x0,%edx
+  8030cf:	f7 da                	neg    %edx
+  8030d1:	83 ec 04             	sub    $0x4,%esp
+  8030d4:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8030d8:	56                   	push   %esi
+  8030d9:	89 cf                	mov    %ecx,%edi
+  8030db:	f7 df                	neg    %edi
+  8030dd:	89 de                	mov    %ebx,%esi
+  8030df:	83 d6 00             	adc    $0x0,%esi
+  8030e2:	f7 de                	neg    %esi
+  8030e4:	0f 49 cf             	cmovns %edi,%ecx
+  8030e7:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  8030eb:	0f 49 de             	cmovns %esi,%ebx
+  8030ee:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  8030f2:	ff 74 24 0c          	push   0xc(%esp)
+  8030f6:	ff 74 24 0c          	push   0xc(%esp)
+  8030fa:	e8 d4 fd ff ff       	call   802ed3 <udivmod>
+  8030ff:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803103:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803107:	f7 d8                	neg    %eax
+  803109:	83 d2 00             	adc    $0x0,%edx
+  80310c:	f7 da                	neg    %edx
+  80310e:	83 c4 10             	add    $0x10,%esp
+  803111:	83 c4 24             	add    $0x24,%esp
+  803114:	5b                   	pop    %ebx
+  803115:	5e                   	pop    %esi
+  803116:	5f                   	pop    %edi
+  803117:	5d                   	pop    %ebp
+  803118:	c3                   	ret
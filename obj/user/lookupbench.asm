@@ -0,0 +1,7405 @@
+
+obj/user/lookupbench.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 98 02 00 00       	call   8002c9 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <run>:
+
+#define NOPEN           500
+
+static void
+run(const char *label, int nspawn)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	81 ec e4 00 00 00    	sub    $0xe4,%esp
+  80003f:	89 85 30 ff ff ff    	mov    %eax,-0xd0(%ebp)
+  800045:	89 d7                	mov    %edx,%edi
+  struct Fsret_stats before, after;
+  unsigned hit, miss, sp;
+  uint32_t hits, misses;
+  int i, fd, r;
+
+  if ((r = fs_stats(0, &before)) < 0)
+  800047:	8d 45 90             	lea    -0x70(%ebp),%eax
+  80004a:	50                   	push   %eax
+  80004b:	6a 00                	push   $0x0
+  80004d:	e8 da 20 00 00       	call   80212c <fs_stats>
+  800052:	83 c4 10             	add    $0x10,%esp
+  800055:	85 c0                	test   %eax,%eax
+  800057:	78 35                	js     80008e <run+0x5b>
+    panic("fs_stats: %e", r);
+
+  hit = sys_time_msec();
+  800059:	e8 ea 10 00 00       	call   801148 <sys_time_msec>
+  80005e:	89 c3                	mov    %eax,%ebx
+  for (i = 0; i < NOPEN; i++) {
+  800060:	be f5 01 00 00       	mov    $0x1f5,%esi
+  800065:	83 ee 01             	sub    $0x1,%esi
+  800068:	74 48                	je     8000b2 <run+0x7f>
+    if ((fd = open("/ls", O_RDONLY)) < 0)
+  80006a:	83 ec 08             	sub    $0x8,%esp
+  80006d:	6a 00                	push   $0x0
+  80006f:	68 00 39 80 00       	push   $0x803900
+  800074:	e8 b4 1d 00 00       	call   801e2d <open>
+  800079:	83 c4 10             	add    $0x10,%esp
+  80007c:	85 c0                	test   %eax,%eax
+  80007e:	78 20                	js     8000a0 <run+0x6d>
+      panic("open /ls: %e", fd);
+    close(fd);
+  800080:	83 ec 0c             	sub    $0xc,%esp
+  800083:	50                   	push   %eax
+  800084:	e8 f1 13 00 00       	call   80147a <close>
+  800089:	83 c4 10             	add    $0x10,%esp
+  80008c:	eb d7                	jmp    800065 <run+0x32>
+    panic("fs_stats: %e", r);
+  80008e:	50                   	push   %eax
+  80008f:	68 e0 38 80 00       	push   $0x8038e0
+  800094:	6a 15                	push   $0x15
+  800096:	68 ed 38 80 00       	push   $0x8038ed
+  80009b:	e8 96 02 00 00       	call   800336 <_panic>
+      panic("open /ls: %e", fd);
+  8000a0:	50                   	push   %eax
+  8000a1:	68 04 39 80 00       	push   $0x803904
+  8000a6:	6a 1a                	push   $0x1a
+  8000a8:	68 ed 38 80 00       	push   $0x8038ed
+  8000ad:	e8 84 02 00 00       	call   800336 <_panic>
+  }
+  hit = sys_time_msec() - hit;
+  8000b2:	e8 91 10 00 00       	call   801148 <sys_time_msec>
+  8000b7:	29 d8                	sub    %ebx,%eax
+  8000b9:	89 85 34 ff ff ff    	mov    %eax,-0xcc(%ebp)
+
+  miss = sys_time_msec();
+  8000bf:	e8 84 10 00 00       	call   801148 <sys_time_msec>
+  8000c4:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < NOPEN; i++)
+  8000c6:	bb f5 01 00 00       	mov    $0x1f5,%ebx
+  8000cb:	83 eb 01             	sub    $0x1,%ebx
+  8000ce:	74 29                	je     8000f9 <run+0xc6>
+    if ((fd = open("/lookupbench.missing", O_RDONLY)) != -E_NOT_FOUND)
+  8000d0:	83 ec 08             	sub    $0x8,%esp
+  8000d3:	6a 00                	push   $0x0
+  8000d5:	68 11 39 80 00       	push   $0x803911
+  8000da:	e8 4e 1d 00 00       	call   801e2d <open>
+  8000df:	83 c4 10             	add    $0x10,%esp
+  8000e2:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8000e5:	74 e4                	je     8000cb <run+0x98>
+      panic("open /lookupbench.missing: %e", fd);
+  8000e7:	50                   	push   %eax
+  8000e8:	68 26 39 80 00       	push   $0x803926
+  8000ed:	6a 22                	push   $0x22
+  8000ef:	68 ed 38 80 00       	push   $0x8038ed
+  8000f4:	e8 3d 02 00 00       	call   800336 <_panic>
+  miss = sys_time_msec() - miss;
+  8000f9:	e8 4a 10 00 00       	call   801148 <sys_time_msec>
+  8000fe:	29 f0                	sub    %esi,%eax
+  800100:	89 85 2c ff ff ff    	mov    %eax,-0xd4(%ebp)
+
+  sp = sys_time_msec();
+  800106:	e8 3d 10 00 00       	call   801148 <sys_time_msec>
+  80010b:	89 85 24 ff ff ff    	mov    %eax,-0xdc(%ebp)
+  for (i = 0; i < nspawn; i++) {
+  800111:	be 00 00 00 00       	mov    $0x0,%esi
+  800116:	39 fe                	cmp    %edi,%esi
+  800118:	7d 48                	jge    800162 <run+0x12f>
+    if ((r = spawnl("/ls", "ls", "-d", "/", (char*) 0)) < 0)
+  80011a:	83 ec 0c             	sub    $0xc,%esp
+  80011d:	6a 00                	push   $0x0
+  80011f:	68 44 39 80 00       	push   $0x803944
+  800124:	68 46 39 80 00       	push   $0x803946
+  800129:	68 01 39 80 00       	push   $0x803901
+  80012e:	68 00 39 80 00       	push   $0x803900
+  800133:	e8 e8 28 00 00       	call   802a20 <spawnl>
+  800138:	83 c4 20             	add    $0x20,%esp
+  80013b:	85 c0                	test   %eax,%eax
+  80013d:	78 11                	js     800150 <run+0x11d>
+      panic("spawn /ls: %e", r);
+    wait(r);
+  80013f:	83 ec 0c             	sub    $0xc,%esp
+  800142:	50                   	push   %eax
+  800143:	e8 d9 31 00 00       	call   803321 <wait>
+  for (i = 0; i < nspawn; i++) {
+  800148:	83 c6 01             	add    $0x1,%esi
+  80014b:	83 c4 10             	add    $0x10,%esp
+  80014e:	eb c6                	jmp    800116 <run+0xe3>
+      panic("spawn /ls: %e", r);
+  800150:	50                   	push   %eax
+  800151:	68 49 39 80 00       	push   $0x803949
+  800156:	6a 28                	push   $0x28
+  800158:	68 ed 38 80 00       	push   $0x8038ed
+  80015d:	e8 d4 01 00 00       	call   800336 <_panic>
+  }
+  sp = sys_time_msec() - sp;
+  800162:	e8 e1 0f 00 00       	call   801148 <sys_time_msec>
+  800167:	89 85 28 ff ff ff    	mov    %eax,-0xd8(%ebp)
+
+  if ((r = fs_stats(0, &after)) < 0)
+  80016d:	83 ec 08             	sub    $0x8,%esp
+  800170:	8d 85 38 ff ff ff    	lea    -0xc8(%ebp),%eax
+  800176:	50                   	push   %eax
+  800177:	6a 00                	push   $0x0
+  800179:	e8 ae 1f 00 00       	call   80212c <fs_stats>
+  80017e:	83 c4 10             	add    $0x10,%esp
+  800181:	85 c0                	test   %eax,%eax
+  800183:	0f 88 96 00 00 00    	js     80021f <run+0x1ec>
+    panic("fs_stats: %e", r);
+  hits = after.ret_dc_hits - before.ret_dc_hits;
+  800189:	8b 85 6c ff ff ff    	mov    -0x94(%ebp),%eax
+  80018f:	2b 45 c4             	sub    -0x3c(%ebp),%eax
+  misses = after.ret_dc_misses - before.ret_dc_misses;
+
+  cprintf("lookupbench: cache %s  open %4d us  miss %4d us  "
+  800192:	8b b5 70 ff ff ff    	mov    -0x90(%ebp),%esi
+  800198:	2b 75 c8             	sub    -0x38(%ebp),%esi
+          "spawn /ls %6d us  %d%% hits (%d negative)\n", label,
+          hit * 1000 / NOPEN, miss * 1000 / NOPEN,
+          nspawn ? sp * 1000 / nspawn : 0,
+          hits + misses ? hits * 100 / (hits + misses) : 0,
+  80019b:	89 c1                	mov    %eax,%ecx
+  80019d:	2b 4d cc             	sub    -0x34(%ebp),%ecx
+  cprintf("lookupbench: cache %s  open %4d us  miss %4d us  "
+  8001a0:	03 8d 74 ff ff ff    	add    -0x8c(%ebp),%ecx
+  8001a6:	74 0c                	je     8001b4 <run+0x181>
+          hits + misses ? hits * 100 / (hits + misses) : 0,
+  8001a8:	6b c0 64             	imul   $0x64,%eax,%eax
+  cprintf("lookupbench: cache %s  open %4d us  miss %4d us  "
+  8001ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001b0:	f7 f1                	div    %ecx
+  8001b2:	89 c1                	mov    %eax,%ecx
+  8001b4:	85 ff                	test   %edi,%edi
+  8001b6:	74 1d                	je     8001d5 <run+0x1a2>
+  sp = sys_time_msec() - sp;
+  8001b8:	8b 85 28 ff ff ff    	mov    -0xd8(%ebp),%eax
+  8001be:	8b 95 24 ff ff ff    	mov    -0xdc(%ebp),%edx
+  8001c4:	29 d0                	sub    %edx,%eax
+          nspawn ? sp * 1000 / nspawn : 0,
+  8001c6:	69 c0 e8 03 00 00    	imul   $0x3e8,%eax,%eax
+  cprintf("lookupbench: cache %s  open %4d us  miss %4d us  "
+  8001cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001d1:	f7 f7                	div    %edi
+  8001d3:	89 c3                	mov    %eax,%ebx
+  8001d5:	83 ec 04             	sub    $0x4,%esp
+  8001d8:	56                   	push   %esi
+  8001d9:	51                   	push   %ecx
+  8001da:	53                   	push   %ebx
+          hit * 1000 / NOPEN, miss * 1000 / NOPEN,
+  8001db:	69 95 2c ff ff ff e8 	imul   $0x3e8,-0xd4(%ebp),%edx
+  8001e2:	03 00 00 
+  cprintf("lookupbench: cache %s  open %4d us  miss %4d us  "
+  8001e5:	b9 d3 4d 62 10       	mov    $0x10624dd3,%ecx
+  8001ea:	89 d0                	mov    %edx,%eax
+  8001ec:	f7 e1                	mul    %ecx
+  8001ee:	c1 ea 05             	shr    $0x5,%edx
+  8001f1:	52                   	push   %edx
+          hit * 1000 / NOPEN, miss * 1000 / NOPEN,
+  8001f2:	69 95 34 ff ff ff e8 	imul   $0x3e8,-0xcc(%ebp),%edx
+  8001f9:	03 00 00 
+  cprintf("lookupbench: cache %s  open %4d us  miss %4d us  "
+  8001fc:	89 d0                	mov    %edx,%eax
+  8001fe:	f7 e1                	mul    %ecx
+  800200:	c1 ea 05             	shr    $0x5,%edx
+  800203:	52                   	push   %edx
+  800204:	ff b5 30 ff ff ff    	push   -0xd0(%ebp)
+  80020a:	68 80 39 80 00       	push   $0x803980
+  80020f:	e8 fd 01 00 00       	call   800411 <cprintf>
+          after.ret_dc_negative - before.ret_dc_negative);
+}
+  800214:	83 c4 20             	add    $0x20,%esp
+  800217:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80021a:	5b                   	pop    %ebx
+  80021b:	5e                   	pop    %esi
+  80021c:	5f                   	pop    %edi
+  80021d:	5d                   	pop    %ebp
+  80021e:	c3                   	ret
+    panic("fs_stats: %e", r);
+  80021f:	50                   	push   %eax
+  800220:	68 e0 38 80 00       	push   $0x8038e0
+  800225:	6a 2e                	push   $0x2e
+  800227:	68 ed 38 80 00       	push   $0x8038ed
+  80022c:	e8 05 01 00 00       	call   800336 <_panic>
+
+00800231 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800231:	55                   	push   %ebp
+  800232:	89 e5                	mov    %esp,%ebp
+  800234:	53                   	push   %ebx
+  800235:	83 ec 04             	sub    $0x4,%esp
+  int nspawn, r;
+
+  binaryname = "lookupbench";
+  800238:	c7 05 00 40 80 00 57 	movl   $0x803957,0x804000
+  80023f:	39 80 00 
+  nspawn = 20;
+  800242:	bb 14 00 00 00       	mov    $0x14,%ebx
+  if (argc > 1)
+  800247:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+  80024b:	7f 3f                	jg     80028c <umain+0x5b>
+    nspawn = strtol(argv[1], 0, 0);
+
+  if ((r = fs_set_dcache(DCACHE_OFF)) < 0)
+  80024d:	83 ec 0c             	sub    $0xc,%esp
+  800250:	6a 02                	push   $0x2
+  800252:	e8 9a 1f 00 00       	call   8021f1 <fs_set_dcache>
+  800257:	83 c4 10             	add    $0x10,%esp
+  80025a:	85 c0                	test   %eax,%eax
+  80025c:	78 47                	js     8002a5 <umain+0x74>
+    panic("fs_set_dcache: %e", r);
+  run("off", nspawn);
+  80025e:	89 da                	mov    %ebx,%edx
+  800260:	b8 75 39 80 00       	mov    $0x803975,%eax
+  800265:	e8 c9 fd ff ff       	call   800033 <run>
+  if ((r = fs_set_dcache(DCACHE_ON)) < 0)
+  80026a:	83 ec 0c             	sub    $0xc,%esp
+  80026d:	6a 01                	push   $0x1
+  80026f:	e8 7d 1f 00 00       	call   8021f1 <fs_set_dcache>
+  800274:	83 c4 10             	add    $0x10,%esp
+  800277:	85 c0                	test   %eax,%eax
+  800279:	78 3c                	js     8002b7 <umain+0x86>
+    panic("fs_set_dcache: %e", r);
+  run("on ", nspawn);
+  80027b:	89 da                	mov    %ebx,%edx
+  80027d:	b8 79 39 80 00       	mov    $0x803979,%eax
+  800282:	e8 ac fd ff ff       	call   800033 <run>
+}
+  800287:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80028a:	c9                   	leave
+  80028b:	c3                   	ret
+    nspawn = strtol(argv[1], 0, 0);
+  80028c:	83 ec 04             	sub    $0x4,%esp
+  80028f:	6a 00                	push   $0x0
+  800291:	6a 00                	push   $0x0
+  800293:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800296:	ff 70 04             	push   0x4(%eax)
+  800299:	e8 b5 09 00 00       	call   800c53 <strtol>
+  80029e:	89 c3                	mov    %eax,%ebx
+  8002a0:	83 c4 10             	add    $0x10,%esp
+  8002a3:	eb a8                	jmp    80024d <umain+0x1c>
+    panic("fs_set_dcache: %e", r);
+  8002a5:	50                   	push   %eax
+  8002a6:	68 63 39 80 00       	push   $0x803963
+  8002ab:	6a 45                	push   $0x45
+  8002ad:	68 ed 38 80 00       	push   $0x8038ed
+  8002b2:	e8 7f 00 00 00       	call   800336 <_panic>
+    panic("fs_set_dcache: %e", r);
+  8002b7:	50                   	push   %eax
+  8002b8:	68 63 39 80 00       	push   $0x803963
+  8002bd:	6a 48                	push   $0x48
+  8002bf:	68 ed 38 80 00       	push   $0x8038ed
+  8002c4:	e8 6d 00 00 00       	call   800336 <_panic>
+
+008002c9 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8002c9:	55                   	push   %ebp
+  8002ca:	89 e5                	mov    %esp,%ebp
+  8002cc:	56                   	push   %esi
+  8002cd:	53                   	push   %ebx
+  8002ce:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8002d1:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  8002d4:	c7 05 64 5e 80 00 00 	movl   $0x0,0x805e64
+  8002db:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  8002de:	e8 ca 0a 00 00       	call   800dad <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  8002e3:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8002e8:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8002eb:	c1 e0 04             	shl    $0x4,%eax
+  8002ee:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8002f3:	a3 64 5e 80 00       	mov    %eax,0x805e64
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8002f8:	85 db                	test   %ebx,%ebx
+  8002fa:	7e 07                	jle    800303 <libmain+0x3a>
+    binaryname = argv[0];
+  8002fc:	8b 06                	mov    (%esi),%eax
+  8002fe:	a3 00 40 80 00       	mov    %eax,0x804000
+
+  // call user main routine
+  umain(argc, argv);
+  800303:	83 ec 08             	sub    $0x8,%esp
+  800306:	56                   	push   %esi
+  800307:	53                   	push   %ebx
+  800308:	e8 24 ff ff ff       	call   800231 <umain>
+
+  // exit gracefully
+  exit();
+  80030d:	e8 0a 00 00 00       	call   80031c <exit>
+}
+  800312:	83 c4 10             	add    $0x10,%esp
+  800315:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800318:	5b                   	pop    %ebx
+  800319:	5e                   	pop    %esi
+  80031a:	5d                   	pop    %ebp
+  80031b:	c3                   	ret
+
+0080031c <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80031c:	55                   	push   %ebp
+  80031d:	89 e5                	mov    %esp,%ebp
+  80031f:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  800322:	e8 80 11 00 00       	call   8014a7 <close_all>
+  sys_env_destroy(0);
+  800327:	83 ec 0c             	sub    $0xc,%esp
+  80032a:	6a 00                	push   $0x0
+  80032c:	e8 3b 0a 00 00       	call   800d6c <sys_env_destroy>
+}
+  800331:	83 c4 10             	add    $0x10,%esp
+  800334:	c9                   	leave
+  800335:	c3                   	ret
+
+00800336 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800336:	55                   	push   %ebp
+  800337:	89 e5                	mov    %esp,%ebp
+  800339:	56                   	push   %esi
+  80033a:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  80033b:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  80033e:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  800344:	e8 64 0a 00 00       	call   800dad <sys_getenvid>
+  800349:	83 ec 0c             	sub    $0xc,%esp
+  80034c:	ff 75 0c             	push   0xc(%ebp)
+  80034f:	ff 75 08             	push   0x8(%ebp)
+  800352:	56                   	push   %esi
+  800353:	50                   	push   %eax
+  800354:	68 e8 39 80 00       	push   $0x8039e8
+  800359:	e8 b3 00 00 00       	call   800411 <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  80035e:	83 c4 18             	add    $0x18,%esp
+  800361:	53                   	push   %ebx
+  800362:	ff 75 10             	push   0x10(%ebp)
+  800365:	e8 56 00 00 00       	call   8003c0 <vcprintf>
+  cprintf("\n");
+  80036a:	c7 04 24 bd 3e 80 00 	movl   $0x803ebd,(%esp)
+  800371:	e8 9b 00 00 00       	call   800411 <cprintf>
+  800376:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  800379:	cc                   	int3
+  while (1)
+  80037a:	eb fd                	jmp    800379 <_panic+0x43>
+
+0080037c <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80037c:	55                   	push   %ebp
+  80037d:	89 e5                	mov    %esp,%ebp
+  80037f:	53                   	push   %ebx
+  800380:	83 ec 04             	sub    $0x4,%esp
+  800383:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  800386:	8b 13                	mov    (%ebx),%edx
+  800388:	8d 42 01             	lea    0x1(%edx),%eax
+  80038b:	89 03                	mov    %eax,(%ebx)
+  80038d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800390:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  800394:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800399:	74 09                	je     8003a4 <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  80039b:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80039f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8003a2:	c9                   	leave
+  8003a3:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  8003a4:	83 ec 08             	sub    $0x8,%esp
+  8003a7:	68 ff 00 00 00       	push   $0xff
+  8003ac:	8d 43 08             	lea    0x8(%ebx),%eax
+  8003af:	50                   	push   %eax
+  8003b0:	e8 7a 09 00 00       	call   800d2f <sys_cputs>
+    b->idx = 0;
+  8003b5:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8003bb:	83 c4 10             	add    $0x10,%esp
+  8003be:	eb db                	jmp    80039b <putch+0x1f>
+
+008003c0 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8003c0:	55                   	push   %ebp
+  8003c1:	89 e5                	mov    %esp,%ebp
+  8003c3:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  8003c9:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8003d0:	00 00 00 
+  b.cnt = 0;
+  8003d3:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8003da:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  8003dd:	ff 75 0c             	push   0xc(%ebp)
+  8003e0:	ff 75 08             	push   0x8(%ebp)
+  8003e3:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8003e9:	50                   	push   %eax
+  8003ea:	68 7c 03 80 00       	push   $0x80037c
+  8003ef:	e8 14 01 00 00       	call   800508 <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  8003f4:	83 c4 08             	add    $0x8,%esp
+  8003f7:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8003fd:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800403:	50                   	push   %eax
+  800404:	e8 26 09 00 00       	call   800d2f <sys_cputs>
+
+  return b.cnt;
+}
+  800409:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80040f:	c9                   	leave
+  800410:	c3                   	ret
+
+00800411 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800411:	55                   	push   %ebp
+  800412:	89 e5                	mov    %esp,%ebp
+  800414:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  800417:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  80041a:	50                   	push   %eax
+  80041b:	ff 75 08             	push   0x8(%ebp)
+  80041e:	e8 9d ff ff ff       	call   8003c0 <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  800423:	c9                   	leave
+  800424:	c3                   	ret
+
+00800425 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  800425:	55                   	push   %ebp
+  800426:	89 e5                	mov    %esp,%ebp
+  800428:	57                   	push   %edi
+  800429:	56                   	push   %esi
+  80042a:	53                   	push   %ebx
+  80042b:	83 ec 1c             	sub    $0x1c,%esp
+  80042e:	89 c7                	mov    %eax,%edi
+  800430:	89 d6                	mov    %edx,%esi
+  800432:	8b 45 08             	mov    0x8(%ebp),%eax
+  800435:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800438:	89 d1                	mov    %edx,%ecx
+  80043a:	89 c2                	mov    %eax,%edx
+  80043c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80043f:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800442:	8b 45 10             	mov    0x10(%ebp),%eax
+  800445:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  800448:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80044b:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800452:	39 c2                	cmp    %eax,%edx
+  800454:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800457:	72 3e                	jb     800497 <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  800459:	83 ec 0c             	sub    $0xc,%esp
+  80045c:	ff 75 18             	push   0x18(%ebp)
+  80045f:	83 eb 01             	sub    $0x1,%ebx
+  800462:	53                   	push   %ebx
+  800463:	50                   	push   %eax
+  800464:	83 ec 08             	sub    $0x8,%esp
+  800467:	ff 75 e4             	push   -0x1c(%ebp)
+  80046a:	ff 75 e0             	push   -0x20(%ebp)
+  80046d:	ff 75 dc             	push   -0x24(%ebp)
+  800470:	ff 75 d8             	push   -0x28(%ebp)
+  800473:	e8 d3 32 00 00       	call   80374b <__udivdi3>
+  800478:	83 c4 18             	add    $0x18,%esp
+  80047b:	52                   	push   %edx
+  80047c:	50                   	push   %eax
+  80047d:	89 f2                	mov    %esi,%edx
+  80047f:	89 f8                	mov    %edi,%eax
+  800481:	e8 9f ff ff ff       	call   800425 <printnum>
+  800486:	83 c4 20             	add    $0x20,%esp
+  800489:	eb 13                	jmp    80049e <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  80048b:	83 ec 08             	sub    $0x8,%esp
+  80048e:	56                   	push   %esi
+  80048f:	ff 75 18             	push   0x18(%ebp)
+  800492:	ff d7                	call   *%edi
+  800494:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  800497:	83 eb 01             	sub    $0x1,%ebx
+  80049a:	85 db                	test   %ebx,%ebx
+  80049c:	7f ed                	jg     80048b <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  80049e:	83 ec 08             	sub    $0x8,%esp
+  8004a1:	56                   	push   %esi
+  8004a2:	83 ec 04             	sub    $0x4,%esp
+  8004a5:	ff 75 e4             	push   -0x1c(%ebp)
+  8004a8:	ff 75 e0             	push   -0x20(%ebp)
+  8004ab:	ff 75 dc             	push   -0x24(%ebp)
+  8004ae:	ff 75 d8             	push   -0x28(%ebp)
+  8004b1:	e8 b6 32 00 00       	call   80376c <__umoddi3>
+  8004b6:	83 c4 14             	add    $0x14,%esp
+  8004b9:	0f be 80 0b 3a 80 00 	movsbl 0x803a0b(%eax),%eax
+  8004c0:	50                   	push   %eax
+  8004c1:	ff d7                	call   *%edi
+}
+  8004c3:	83 c4 10             	add    $0x10,%esp
+  8004c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004c9:	5b                   	pop    %ebx
+  8004ca:	5e                   	pop    %esi
+  8004cb:	5f                   	pop    %edi
+  8004cc:	5d                   	pop    %ebp
+  8004cd:	c3                   	ret
+
+008004ce <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8004ce:	55                   	push   %ebp
+  8004cf:	89 e5                	mov    %esp,%ebp
+  8004d1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  8004d4:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  8004d8:	8b 10                	mov    (%eax),%edx
+  8004da:	3b 50 04             	cmp    0x4(%eax),%edx
+  8004dd:	73 0a                	jae    8004e9 <sprintputch+0x1b>
+    *b->buf++ = ch;
+  8004df:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8004e2:	89 08                	mov    %ecx,(%eax)
+  8004e4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8004e7:	88 02                	mov    %al,(%edx)
+}
+  8004e9:	5d                   	pop    %ebp
+  8004ea:	c3                   	ret
+
+008004eb <printfmt>:
+{
+  8004eb:	55                   	push   %ebp
+  8004ec:	89 e5                	mov    %esp,%ebp
+  8004ee:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  8004f1:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  8004f4:	50                   	push   %eax
+  8004f5:	ff 75 10             	push   0x10(%ebp)
+  8004f8:	ff 75 0c             	push   0xc(%ebp)
+  8004fb:	ff 75 08             	push   0x8(%ebp)
+  8004fe:	e8 05 00 00 00       	call   800508 <vprintfmt>
+}
+  800503:	83 c4 10             	add    $0x10,%esp
+  800506:	c9                   	leave
+  800507:	c3                   	ret
+
+00800508 <vprintfmt>:
+{
+  800508:	55                   	push   %ebp
+  800509:	89 e5                	mov    %esp,%ebp
+  80050b:	57                   	push   %edi
+  80050c:	56                   	push   %esi
+  80050d:	53                   	push   %ebx
+  80050e:	83 ec 2c             	sub    $0x2c,%esp
+  800511:	8b 75 08             	mov    0x8(%ebp),%esi
+  800514:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800517:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80051a:	eb 0a                	jmp    800526 <vprintfmt+0x1e>
+      putch(ch, putdat);
+  80051c:	83 ec 08             	sub    $0x8,%esp
+  80051f:	53                   	push   %ebx
+  800520:	50                   	push   %eax
+  800521:	ff d6                	call   *%esi
+  800523:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  800526:	83 c7 01             	add    $0x1,%edi
+  800529:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80052d:	83 f8 25             	cmp    $0x25,%eax
+  800530:	74 0c                	je     80053e <vprintfmt+0x36>
+      if (ch == '\0')
+  800532:	85 c0                	test   %eax,%eax
+  800534:	75 e6                	jne    80051c <vprintfmt+0x14>
+}
+  800536:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800539:	5b                   	pop    %ebx
+  80053a:	5e                   	pop    %esi
+  80053b:	5f                   	pop    %edi
+  80053c:	5d                   	pop    %ebp
+  80053d:	c3                   	ret
+    padc = ' ';
+  80053e:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  800542:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  800549:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  800550:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  800557:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  80055c:	8d 47 01             	lea    0x1(%edi),%eax
+  80055f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800562:	0f b6 17             	movzbl (%edi),%edx
+  800565:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800568:	3c 55                	cmp    $0x55,%al
+  80056a:	0f 87 cf 03 00 00    	ja     80093f <vprintfmt+0x437>
+  800570:	0f b6 c0             	movzbl %al,%eax
+  800573:	ff 24 85 60 3b 80 00 	jmp    *0x803b60(,%eax,4)
+  80057a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  80057d:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800581:	eb d9                	jmp    80055c <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  800583:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800586:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80058a:	eb d0                	jmp    80055c <vprintfmt+0x54>
+  80058c:	0f b6 d2             	movzbl %dl,%edx
+  80058f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  800592:	b8 00 00 00 00       	mov    $0x0,%eax
+  800597:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  80059a:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80059d:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  8005a1:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  8005a4:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8005a7:	83 f9 09             	cmp    $0x9,%ecx
+  8005aa:	77 55                	ja     800601 <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  8005ac:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  8005af:	eb e9                	jmp    80059a <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  8005b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b4:	8b 00                	mov    (%eax),%eax
+  8005b6:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8005b9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005bc:	8d 40 04             	lea    0x4(%eax),%eax
+  8005bf:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  8005c2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  8005c5:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8005c9:	79 91                	jns    80055c <vprintfmt+0x54>
+        width = precision, precision = -1;
+  8005cb:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8005ce:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005d1:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8005d8:	eb 82                	jmp    80055c <vprintfmt+0x54>
+      if (width < 0)
+  8005da:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8005dd:	85 d2                	test   %edx,%edx
+  8005df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005e4:	0f 49 c2             	cmovns %edx,%eax
+  8005e7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  8005ea:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  8005ed:	e9 6a ff ff ff       	jmp    80055c <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  8005f2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  8005f5:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  8005fc:	e9 5b ff ff ff       	jmp    80055c <vprintfmt+0x54>
+  800601:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800604:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800607:	eb bc                	jmp    8005c5 <vprintfmt+0xbd>
+      lflag++;
+  800609:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  80060c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  80060f:	e9 48 ff ff ff       	jmp    80055c <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  800614:	8b 45 14             	mov    0x14(%ebp),%eax
+  800617:	8d 78 04             	lea    0x4(%eax),%edi
+  80061a:	83 ec 08             	sub    $0x8,%esp
+  80061d:	53                   	push   %ebx
+  80061e:	ff 30                	push   (%eax)
+  800620:	ff d6                	call   *%esi
+      break;
+  800622:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  800625:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  800628:	e9 b1 02 00 00       	jmp    8008de <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  80062d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800630:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  800633:	8b 10                	mov    (%eax),%edx
+  800635:	89 d0                	mov    %edx,%eax
+  800637:	f7 d8                	neg    %eax
+  800639:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80063c:	83 f8 10             	cmp    $0x10,%eax
+  80063f:	7f 23                	jg     800664 <vprintfmt+0x15c>
+  800641:	8b 14 85 c0 3c 80 00 	mov    0x803cc0(,%eax,4),%edx
+  800648:	85 d2                	test   %edx,%edx
+  80064a:	74 18                	je     800664 <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  80064c:	52                   	push   %edx
+  80064d:	68 0a 3e 80 00       	push   $0x803e0a
+  800652:	53                   	push   %ebx
+  800653:	56                   	push   %esi
+  800654:	e8 92 fe ff ff       	call   8004eb <printfmt>
+  800659:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  80065c:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80065f:	e9 7a 02 00 00       	jmp    8008de <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  800664:	50                   	push   %eax
+  800665:	68 23 3a 80 00       	push   $0x803a23
+  80066a:	53                   	push   %ebx
+  80066b:	56                   	push   %esi
+  80066c:	e8 7a fe ff ff       	call   8004eb <printfmt>
+  800671:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  800674:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  800677:	e9 62 02 00 00       	jmp    8008de <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  80067c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067f:	83 c0 04             	add    $0x4,%eax
+  800682:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800685:	8b 45 14             	mov    0x14(%ebp),%eax
+  800688:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  80068a:	85 c9                	test   %ecx,%ecx
+  80068c:	b8 1c 3a 80 00       	mov    $0x803a1c,%eax
+  800691:	0f 45 c1             	cmovne %ecx,%eax
+  800694:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  800697:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80069b:	7e 06                	jle    8006a3 <vprintfmt+0x19b>
+  80069d:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8006a1:	75 0b                	jne    8006ae <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8006a3:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8006a6:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8006a9:	89 75 08             	mov    %esi,0x8(%ebp)
+  8006ac:	eb 5c                	jmp    80070a <vprintfmt+0x202>
+  8006ae:	83 ec 08             	sub    $0x8,%esp
+  8006b1:	ff 75 d0             	push   -0x30(%ebp)
+  8006b4:	ff 75 cc             	push   -0x34(%ebp)
+  8006b7:	e8 20 03 00 00       	call   8009dc <strnlen>
+  8006bc:	89 c2                	mov    %eax,%edx
+  8006be:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006c1:	29 d0                	sub    %edx,%eax
+  8006c3:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  8006c6:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8006ca:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006cd:	89 75 08             	mov    %esi,0x8(%ebp)
+  8006d0:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8006d2:	eb 0e                	jmp    8006e2 <vprintfmt+0x1da>
+          putch(padc, putdat);
+  8006d4:	83 ec 08             	sub    $0x8,%esp
+  8006d7:	53                   	push   %ebx
+  8006d8:	57                   	push   %edi
+  8006d9:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8006dc:	83 ee 01             	sub    $0x1,%esi
+  8006df:	83 c4 10             	add    $0x10,%esp
+  8006e2:	85 f6                	test   %esi,%esi
+  8006e4:	7f ee                	jg     8006d4 <vprintfmt+0x1cc>
+  8006e6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006e9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006ec:	85 c0                	test   %eax,%eax
+  8006ee:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006f3:	0f 49 d0             	cmovns %eax,%edx
+  8006f6:	29 d0                	sub    %edx,%eax
+  8006f8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006fb:	eb a6                	jmp    8006a3 <vprintfmt+0x19b>
+          putch(ch, putdat);
+  8006fd:	83 ec 08             	sub    $0x8,%esp
+  800700:	53                   	push   %ebx
+  800701:	52                   	push   %edx
+  800702:	ff 55 08             	call   *0x8(%ebp)
+  800705:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800708:	89 f1                	mov    %esi,%ecx
+  80070a:	8d 71 01             	lea    0x1(%ecx),%esi
+  80070d:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800711:	0f be d0             	movsbl %al,%edx
+  800714:	85 d2                	test   %edx,%edx
+  800716:	74 28                	je     800740 <vprintfmt+0x238>
+  800718:	85 ff                	test   %edi,%edi
+  80071a:	78 05                	js     800721 <vprintfmt+0x219>
+  80071c:	83 ef 01             	sub    $0x1,%edi
+  80071f:	78 30                	js     800751 <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  800721:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800725:	74 d6                	je     8006fd <vprintfmt+0x1f5>
+  800727:	0f be c0             	movsbl %al,%eax
+  80072a:	83 e8 20             	sub    $0x20,%eax
+  80072d:	83 f8 5e             	cmp    $0x5e,%eax
+  800730:	76 cb                	jbe    8006fd <vprintfmt+0x1f5>
+          putch('?', putdat);
+  800732:	83 ec 08             	sub    $0x8,%esp
+  800735:	53                   	push   %ebx
+  800736:	6a 3f                	push   $0x3f
+  800738:	ff 55 08             	call   *0x8(%ebp)
+  80073b:	83 c4 10             	add    $0x10,%esp
+  80073e:	eb c8                	jmp    800708 <vprintfmt+0x200>
+  800740:	8b 75 08             	mov    0x8(%ebp),%esi
+  800743:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800746:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800749:	01 d0                	add    %edx,%eax
+  80074b:	29 c8                	sub    %ecx,%eax
+  80074d:	89 c7                	mov    %eax,%edi
+  80074f:	eb 13                	jmp    800764 <vprintfmt+0x25c>
+  800751:	8b 75 08             	mov    0x8(%ebp),%esi
+  800754:	eb ed                	jmp    800743 <vprintfmt+0x23b>
+        putch(' ', putdat);
+  800756:	83 ec 08             	sub    $0x8,%esp
+  800759:	53                   	push   %ebx
+  80075a:	6a 20                	push   $0x20
+  80075c:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  80075e:	83 ef 01             	sub    $0x1,%edi
+  800761:	83 c4 10             	add    $0x10,%esp
+  800764:	85 ff                	test   %edi,%edi
+  800766:	7f ee                	jg     800756 <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  800768:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80076b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80076e:	e9 6b 01 00 00       	jmp    8008de <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  800773:	83 f9 01             	cmp    $0x1,%ecx
+  800776:	7f 1f                	jg     800797 <vprintfmt+0x28f>
+  else if (lflag)
+  800778:	85 c9                	test   %ecx,%ecx
+  80077a:	74 67                	je     8007e3 <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  80077c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80077f:	8b 00                	mov    (%eax),%eax
+  800781:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800784:	89 c1                	mov    %eax,%ecx
+  800786:	c1 f9 1f             	sar    $0x1f,%ecx
+  800789:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80078c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80078f:	8d 40 04             	lea    0x4(%eax),%eax
+  800792:	89 45 14             	mov    %eax,0x14(%ebp)
+  800795:	eb 17                	jmp    8007ae <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  800797:	8b 45 14             	mov    0x14(%ebp),%eax
+  80079a:	8b 50 04             	mov    0x4(%eax),%edx
+  80079d:	8b 00                	mov    (%eax),%eax
+  80079f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007a2:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8007a5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a8:	8d 40 08             	lea    0x8(%eax),%eax
+  8007ab:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  8007ae:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8007b1:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  8007b4:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  8007b9:	85 c9                	test   %ecx,%ecx
+  8007bb:	0f 89 03 01 00 00    	jns    8008c4 <vprintfmt+0x3bc>
+        putch('-', putdat);
+  8007c1:	83 ec 08             	sub    $0x8,%esp
+  8007c4:	53                   	push   %ebx
+  8007c5:	6a 2d                	push   $0x2d
+  8007c7:	ff d6                	call   *%esi
+        num = -(long long)num;
+  8007c9:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8007cc:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8007cf:	f7 da                	neg    %edx
+  8007d1:	83 d1 00             	adc    $0x0,%ecx
+  8007d4:	f7 d9                	neg    %ecx
+  8007d6:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  8007d9:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8007de:	e9 e1 00 00 00       	jmp    8008c4 <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  8007e3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e6:	8b 00                	mov    (%eax),%eax
+  8007e8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007eb:	89 c1                	mov    %eax,%ecx
+  8007ed:	c1 f9 1f             	sar    $0x1f,%ecx
+  8007f0:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8007f3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007f6:	8d 40 04             	lea    0x4(%eax),%eax
+  8007f9:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007fc:	eb b0                	jmp    8007ae <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  8007fe:	83 f9 01             	cmp    $0x1,%ecx
+  800801:	7f 1e                	jg     800821 <vprintfmt+0x319>
+  else if (lflag)
+  800803:	85 c9                	test   %ecx,%ecx
+  800805:	74 32                	je     800839 <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  800807:	8b 45 14             	mov    0x14(%ebp),%eax
+  80080a:	8b 10                	mov    (%eax),%edx
+  80080c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800811:	8d 40 04             	lea    0x4(%eax),%eax
+  800814:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800817:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  80081c:	e9 a3 00 00 00       	jmp    8008c4 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800821:	8b 45 14             	mov    0x14(%ebp),%eax
+  800824:	8b 10                	mov    (%eax),%edx
+  800826:	8b 48 04             	mov    0x4(%eax),%ecx
+  800829:	8d 40 08             	lea    0x8(%eax),%eax
+  80082c:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  80082f:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  800834:	e9 8b 00 00 00       	jmp    8008c4 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800839:	8b 45 14             	mov    0x14(%ebp),%eax
+  80083c:	8b 10                	mov    (%eax),%edx
+  80083e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800843:	8d 40 04             	lea    0x4(%eax),%eax
+  800846:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800849:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  80084e:	eb 74                	jmp    8008c4 <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  800850:	83 f9 01             	cmp    $0x1,%ecx
+  800853:	7f 1b                	jg     800870 <vprintfmt+0x368>
+  else if (lflag)
+  800855:	85 c9                	test   %ecx,%ecx
+  800857:	74 2c                	je     800885 <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  800859:	8b 45 14             	mov    0x14(%ebp),%eax
+  80085c:	8b 10                	mov    (%eax),%edx
+  80085e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800863:	8d 40 04             	lea    0x4(%eax),%eax
+  800866:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800869:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  80086e:	eb 54                	jmp    8008c4 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800870:	8b 45 14             	mov    0x14(%ebp),%eax
+  800873:	8b 10                	mov    (%eax),%edx
+  800875:	8b 48 04             	mov    0x4(%eax),%ecx
+  800878:	8d 40 08             	lea    0x8(%eax),%eax
+  80087b:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  80087e:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  800883:	eb 3f                	jmp    8008c4 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800885:	8b 45 14             	mov    0x14(%ebp),%eax
+  800888:	8b 10                	mov    (%eax),%edx
+  80088a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80088f:	8d 40 04             	lea    0x4(%eax),%eax
+  800892:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800895:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  80089a:	eb 28                	jmp    8008c4 <vprintfmt+0x3bc>
+      putch('0', putdat);
+  80089c:	83 ec 08             	sub    $0x8,%esp
+  80089f:	53                   	push   %ebx
+  8008a0:	6a 30                	push   $0x30
+  8008a2:	ff d6                	call   *%esi
+      putch('x', putdat);
+  8008a4:	83 c4 08             	add    $0x8,%esp
+  8008a7:	53                   	push   %ebx
+  8008a8:	6a 78                	push   $0x78
+  8008aa:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  8008ac:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008af:	8b 10                	mov    (%eax),%edx
+  8008b1:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  8008b6:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  8008b9:	8d 40 04             	lea    0x4(%eax),%eax
+  8008bc:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8008bf:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  8008c4:	83 ec 0c             	sub    $0xc,%esp
+  8008c7:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8008cb:	50                   	push   %eax
+  8008cc:	ff 75 e0             	push   -0x20(%ebp)
+  8008cf:	57                   	push   %edi
+  8008d0:	51                   	push   %ecx
+  8008d1:	52                   	push   %edx
+  8008d2:	89 da                	mov    %ebx,%edx
+  8008d4:	89 f0                	mov    %esi,%eax
+  8008d6:	e8 4a fb ff ff       	call   800425 <printnum>
+      break;
+  8008db:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  8008de:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  8008e1:	e9 40 fc ff ff       	jmp    800526 <vprintfmt+0x1e>
+  if (lflag >= 2)
+  8008e6:	83 f9 01             	cmp    $0x1,%ecx
+  8008e9:	7f 1b                	jg     800906 <vprintfmt+0x3fe>
+  else if (lflag)
+  8008eb:	85 c9                	test   %ecx,%ecx
+  8008ed:	74 2c                	je     80091b <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  8008ef:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008f2:	8b 10                	mov    (%eax),%edx
+  8008f4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008f9:	8d 40 04             	lea    0x4(%eax),%eax
+  8008fc:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8008ff:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  800904:	eb be                	jmp    8008c4 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800906:	8b 45 14             	mov    0x14(%ebp),%eax
+  800909:	8b 10                	mov    (%eax),%edx
+  80090b:	8b 48 04             	mov    0x4(%eax),%ecx
+  80090e:	8d 40 08             	lea    0x8(%eax),%eax
+  800911:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800914:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  800919:	eb a9                	jmp    8008c4 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  80091b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80091e:	8b 10                	mov    (%eax),%edx
+  800920:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800925:	8d 40 04             	lea    0x4(%eax),%eax
+  800928:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  80092b:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  800930:	eb 92                	jmp    8008c4 <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  800932:	83 ec 08             	sub    $0x8,%esp
+  800935:	53                   	push   %ebx
+  800936:	6a 25                	push   $0x25
+  800938:	ff d6                	call   *%esi
+      break;
+  80093a:	83 c4 10             	add    $0x10,%esp
+  80093d:	eb 9f                	jmp    8008de <vprintfmt+0x3d6>
+      putch('%', putdat);
+  80093f:	83 ec 08             	sub    $0x8,%esp
+  800942:	53                   	push   %ebx
+  800943:	6a 25                	push   $0x25
+  800945:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  800947:	83 c4 10             	add    $0x10,%esp
+  80094a:	89 f8                	mov    %edi,%eax
+  80094c:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800950:	74 05                	je     800957 <vprintfmt+0x44f>
+  800952:	83 e8 01             	sub    $0x1,%eax
+  800955:	eb f5                	jmp    80094c <vprintfmt+0x444>
+  800957:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80095a:	eb 82                	jmp    8008de <vprintfmt+0x3d6>
+
+0080095c <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80095c:	55                   	push   %ebp
+  80095d:	89 e5                	mov    %esp,%ebp
+  80095f:	83 ec 18             	sub    $0x18,%esp
+  800962:	8b 45 08             	mov    0x8(%ebp),%eax
+  800965:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  800968:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80096b:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80096f:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800972:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  800979:	85 c0                	test   %eax,%eax
+  80097b:	74 26                	je     8009a3 <vsnprintf+0x47>
+  80097d:	85 d2                	test   %edx,%edx
+  80097f:	7e 22                	jle    8009a3 <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800981:	ff 75 14             	push   0x14(%ebp)
+  800984:	ff 75 10             	push   0x10(%ebp)
+  800987:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80098a:	50                   	push   %eax
+  80098b:	68 ce 04 80 00       	push   $0x8004ce
+  800990:	e8 73 fb ff ff       	call   800508 <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800995:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800998:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  80099b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80099e:	83 c4 10             	add    $0x10,%esp
+}
+  8009a1:	c9                   	leave
+  8009a2:	c3                   	ret
+    return -E_INVAL;
+  8009a3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8009a8:	eb f7                	jmp    8009a1 <vsnprintf+0x45>
+
+008009aa <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8009aa:	55                   	push   %ebp
+  8009ab:	89 e5                	mov    %esp,%ebp
+  8009ad:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  8009b0:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  8009b3:	50                   	push   %eax
+  8009b4:	ff 75 10             	push   0x10(%ebp)
+  8009b7:	ff 75 0c             	push   0xc(%ebp)
+  8009ba:	ff 75 08             	push   0x8(%ebp)
+  8009bd:	e8 9a ff ff ff       	call   80095c <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  8009c2:	c9                   	leave
+  8009c3:	c3                   	ret
+
+008009c4 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8009c4:	55                   	push   %ebp
+  8009c5:	89 e5                	mov    %esp,%ebp
+  8009c7:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  8009ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009cf:	eb 03                	jmp    8009d4 <strlen+0x10>
+    n++;
+  8009d1:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  8009d4:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8009d8:	75 f7                	jne    8009d1 <strlen+0xd>
+  return n;
+}
+  8009da:	5d                   	pop    %ebp
+  8009db:	c3                   	ret
+
+008009dc <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8009dc:	55                   	push   %ebp
+  8009dd:	89 e5                	mov    %esp,%ebp
+  8009df:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8009e2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009ea:	eb 03                	jmp    8009ef <strnlen+0x13>
+    n++;
+  8009ec:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8009ef:	39 d0                	cmp    %edx,%eax
+  8009f1:	74 08                	je     8009fb <strnlen+0x1f>
+  8009f3:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8009f7:	75 f3                	jne    8009ec <strnlen+0x10>
+  8009f9:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  8009fb:	89 d0                	mov    %edx,%eax
+  8009fd:	5d                   	pop    %ebp
+  8009fe:	c3                   	ret
+
+008009ff <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8009ff:	55                   	push   %ebp
+  800a00:	89 e5                	mov    %esp,%ebp
+  800a02:	53                   	push   %ebx
+  800a03:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a06:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  800a09:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a0e:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800a12:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800a15:	83 c0 01             	add    $0x1,%eax
+  800a18:	84 d2                	test   %dl,%dl
+  800a1a:	75 f2                	jne    800a0e <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  800a1c:	89 c8                	mov    %ecx,%eax
+  800a1e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a21:	c9                   	leave
+  800a22:	c3                   	ret
+
+00800a23 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800a23:	55                   	push   %ebp
+  800a24:	89 e5                	mov    %esp,%ebp
+  800a26:	53                   	push   %ebx
+  800a27:	83 ec 10             	sub    $0x10,%esp
+  800a2a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  800a2d:	53                   	push   %ebx
+  800a2e:	e8 91 ff ff ff       	call   8009c4 <strlen>
+  800a33:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  800a36:	ff 75 0c             	push   0xc(%ebp)
+  800a39:	01 d8                	add    %ebx,%eax
+  800a3b:	50                   	push   %eax
+  800a3c:	e8 be ff ff ff       	call   8009ff <strcpy>
+  return dst;
+}
+  800a41:	89 d8                	mov    %ebx,%eax
+  800a43:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a46:	c9                   	leave
+  800a47:	c3                   	ret
+
+00800a48 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  800a48:	55                   	push   %ebp
+  800a49:	89 e5                	mov    %esp,%ebp
+  800a4b:	56                   	push   %esi
+  800a4c:	53                   	push   %ebx
+  800a4d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a50:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  800a53:	89 f3                	mov    %esi,%ebx
+  800a55:	03 5d 10             	add    0x10(%ebp),%ebx
+  800a58:	89 f0                	mov    %esi,%eax
+  800a5a:	eb 0f                	jmp    800a6b <strncpy+0x23>
+    *dst++ = *src;
+  800a5c:	83 c0 01             	add    $0x1,%eax
+  800a5f:	0f b6 0a             	movzbl (%edx),%ecx
+  800a62:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  800a65:	80 f9 01             	cmp    $0x1,%cl
+  800a68:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  800a6b:	39 d8                	cmp    %ebx,%eax
+  800a6d:	75 ed                	jne    800a5c <strncpy+0x14>
+  }
+  return ret;
+}
+  800a6f:	89 f0                	mov    %esi,%eax
+  800a71:	5b                   	pop    %ebx
+  800a72:	5e                   	pop    %esi
+  800a73:	5d                   	pop    %ebp
+  800a74:	c3                   	ret
+
+00800a75 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800a75:	55                   	push   %ebp
+  800a76:	89 e5                	mov    %esp,%ebp
+  800a78:	56                   	push   %esi
+  800a79:	53                   	push   %ebx
+  800a7a:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a7d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a80:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  800a83:	89 f0                	mov    %esi,%eax
+  800a85:	85 d2                	test   %edx,%edx
+  800a87:	74 21                	je     800aaa <strlcpy+0x35>
+  800a89:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800a8d:	89 f2                	mov    %esi,%edx
+  800a8f:	eb 09                	jmp    800a9a <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  800a91:	83 c1 01             	add    $0x1,%ecx
+  800a94:	83 c2 01             	add    $0x1,%edx
+  800a97:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  800a9a:	39 c2                	cmp    %eax,%edx
+  800a9c:	74 09                	je     800aa7 <strlcpy+0x32>
+  800a9e:	0f b6 19             	movzbl (%ecx),%ebx
+  800aa1:	84 db                	test   %bl,%bl
+  800aa3:	75 ec                	jne    800a91 <strlcpy+0x1c>
+  800aa5:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  800aa7:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  800aaa:	29 f0                	sub    %esi,%eax
+}
+  800aac:	5b                   	pop    %ebx
+  800aad:	5e                   	pop    %esi
+  800aae:	5d                   	pop    %ebp
+  800aaf:	c3                   	ret
+
+00800ab0 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800ab0:	55                   	push   %ebp
+  800ab1:	89 e5                	mov    %esp,%ebp
+  800ab3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ab6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  800ab9:	eb 06                	jmp    800ac1 <strcmp+0x11>
+    p++, q++;
+  800abb:	83 c1 01             	add    $0x1,%ecx
+  800abe:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  800ac1:	0f b6 01             	movzbl (%ecx),%eax
+  800ac4:	84 c0                	test   %al,%al
+  800ac6:	74 04                	je     800acc <strcmp+0x1c>
+  800ac8:	3a 02                	cmp    (%edx),%al
+  800aca:	74 ef                	je     800abb <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  800acc:	0f b6 c0             	movzbl %al,%eax
+  800acf:	0f b6 12             	movzbl (%edx),%edx
+  800ad2:	29 d0                	sub    %edx,%eax
+}
+  800ad4:	5d                   	pop    %ebp
+  800ad5:	c3                   	ret
+
+00800ad6 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800ad6:	55                   	push   %ebp
+  800ad7:	89 e5                	mov    %esp,%ebp
+  800ad9:	53                   	push   %ebx
+  800ada:	8b 45 08             	mov    0x8(%ebp),%eax
+  800add:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ae0:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  800ae3:	eb 09                	jmp    800aee <strncmp+0x18>
+    n--, p++, q++;
+  800ae5:	83 ea 01             	sub    $0x1,%edx
+  800ae8:	83 c0 01             	add    $0x1,%eax
+  800aeb:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  800aee:	85 d2                	test   %edx,%edx
+  800af0:	74 18                	je     800b0a <strncmp+0x34>
+  800af2:	0f b6 18             	movzbl (%eax),%ebx
+  800af5:	84 db                	test   %bl,%bl
+  800af7:	74 04                	je     800afd <strncmp+0x27>
+  800af9:	3a 19                	cmp    (%ecx),%bl
+  800afb:	74 e8                	je     800ae5 <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800afd:	0f b6 00             	movzbl (%eax),%eax
+  800b00:	0f b6 11             	movzbl (%ecx),%edx
+  800b03:	29 d0                	sub    %edx,%eax
+}
+  800b05:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b08:	c9                   	leave
+  800b09:	c3                   	ret
+    return 0;
+  800b0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b0f:	eb f4                	jmp    800b05 <strncmp+0x2f>
+
+00800b11 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800b11:	55                   	push   %ebp
+  800b12:	89 e5                	mov    %esp,%ebp
+  800b14:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b17:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800b1b:	eb 03                	jmp    800b20 <strchr+0xf>
+  800b1d:	83 c0 01             	add    $0x1,%eax
+  800b20:	0f b6 10             	movzbl (%eax),%edx
+  800b23:	84 d2                	test   %dl,%dl
+  800b25:	74 06                	je     800b2d <strchr+0x1c>
+    if (*s == c)
+  800b27:	38 ca                	cmp    %cl,%dl
+  800b29:	75 f2                	jne    800b1d <strchr+0xc>
+  800b2b:	eb 05                	jmp    800b32 <strchr+0x21>
+      return (char*)s;
+  return 0;
+  800b2d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b32:	5d                   	pop    %ebp
+  800b33:	c3                   	ret
+
+00800b34 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800b34:	55                   	push   %ebp
+  800b35:	89 e5                	mov    %esp,%ebp
+  800b37:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b3a:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800b3e:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  800b41:	38 ca                	cmp    %cl,%dl
+  800b43:	74 09                	je     800b4e <strfind+0x1a>
+  800b45:	84 d2                	test   %dl,%dl
+  800b47:	74 05                	je     800b4e <strfind+0x1a>
+  for (; *s; s++)
+  800b49:	83 c0 01             	add    $0x1,%eax
+  800b4c:	eb f0                	jmp    800b3e <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  800b4e:	5d                   	pop    %ebp
+  800b4f:	c3                   	ret
+
+00800b50 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800b50:	55                   	push   %ebp
+  800b51:	89 e5                	mov    %esp,%ebp
+  800b53:	57                   	push   %edi
+  800b54:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b57:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  800b5a:	85 c9                	test   %ecx,%ecx
+  800b5c:	74 20                	je     800b7e <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  800b5e:	89 f8                	mov    %edi,%eax
+  800b60:	09 c8                	or     %ecx,%eax
+  800b62:	a8 03                	test   $0x3,%al
+  800b64:	75 12                	jne    800b78 <memset+0x28>
+    c &= 0xFF;
+  800b66:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800b6a:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  800b70:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  800b73:	fc                   	cld
+  800b74:	f3 ab                	rep stos %eax,%es:(%edi)
+  800b76:	eb 06                	jmp    800b7e <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  800b78:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b7b:	fc                   	cld
+  800b7c:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  800b7e:	89 f8                	mov    %edi,%eax
+  800b80:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800b83:	c9                   	leave
+  800b84:	c3                   	ret
+
+00800b85 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800b85:	55                   	push   %ebp
+  800b86:	89 e5                	mov    %esp,%ebp
+  800b88:	57                   	push   %edi
+  800b89:	56                   	push   %esi
+  800b8a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b8d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b90:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  800b93:	39 c6                	cmp    %eax,%esi
+  800b95:	73 32                	jae    800bc9 <memmove+0x44>
+  800b97:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800b9a:	39 d0                	cmp    %edx,%eax
+  800b9c:	73 2b                	jae    800bc9 <memmove+0x44>
+    s += n;
+    d += n;
+  800b9e:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ba1:	89 d6                	mov    %edx,%esi
+  800ba3:	09 fe                	or     %edi,%esi
+  800ba5:	09 ce                	or     %ecx,%esi
+  800ba7:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800bad:	75 0e                	jne    800bbd <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800baf:	83 ef 04             	sub    $0x4,%edi
+  800bb2:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800bb5:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  800bb8:	fd                   	std
+  800bb9:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800bbb:	eb 09                	jmp    800bc6 <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800bbd:	83 ef 01             	sub    $0x1,%edi
+  800bc0:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  800bc3:	fd                   	std
+  800bc4:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  800bc6:	fc                   	cld
+  800bc7:	eb 1a                	jmp    800be3 <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800bc9:	89 f2                	mov    %esi,%edx
+  800bcb:	09 c2                	or     %eax,%edx
+  800bcd:	09 ca                	or     %ecx,%edx
+  800bcf:	f6 c2 03             	test   $0x3,%dl
+  800bd2:	75 0a                	jne    800bde <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800bd4:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  800bd7:	89 c7                	mov    %eax,%edi
+  800bd9:	fc                   	cld
+  800bda:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800bdc:	eb 05                	jmp    800be3 <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  800bde:	89 c7                	mov    %eax,%edi
+  800be0:	fc                   	cld
+  800be1:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  800be3:	5e                   	pop    %esi
+  800be4:	5f                   	pop    %edi
+  800be5:	5d                   	pop    %ebp
+  800be6:	c3                   	ret
+
+00800be7 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800be7:	55                   	push   %ebp
+  800be8:	89 e5                	mov    %esp,%ebp
+  800bea:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  800bed:	ff 75 10             	push   0x10(%ebp)
+  800bf0:	ff 75 0c             	push   0xc(%ebp)
+  800bf3:	ff 75 08             	push   0x8(%ebp)
+  800bf6:	e8 8a ff ff ff       	call   800b85 <memmove>
+}
+  800bfb:	c9                   	leave
+  800bfc:	c3                   	ret
+
+00800bfd <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800bfd:	55                   	push   %ebp
+  800bfe:	89 e5                	mov    %esp,%ebp
+  800c00:	56                   	push   %esi
+  800c01:	53                   	push   %ebx
+  800c02:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c05:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  800c08:	89 c6                	mov    %eax,%esi
+  800c0a:	03 75 10             	add    0x10(%ebp),%esi
+  800c0d:	eb 06                	jmp    800c15 <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  800c0f:	83 c0 01             	add    $0x1,%eax
+  800c12:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  800c15:	39 f0                	cmp    %esi,%eax
+  800c17:	74 14                	je     800c2d <memcmp+0x30>
+    if (*s1 != *s2)
+  800c19:	0f b6 08             	movzbl (%eax),%ecx
+  800c1c:	0f b6 1a             	movzbl (%edx),%ebx
+  800c1f:	38 d9                	cmp    %bl,%cl
+  800c21:	74 ec                	je     800c0f <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  800c23:	0f b6 c1             	movzbl %cl,%eax
+  800c26:	0f b6 db             	movzbl %bl,%ebx
+  800c29:	29 d8                	sub    %ebx,%eax
+  800c2b:	eb 05                	jmp    800c32 <memcmp+0x35>
+  }
+
+  return 0;
+  800c2d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c32:	5b                   	pop    %ebx
+  800c33:	5e                   	pop    %esi
+  800c34:	5d                   	pop    %ebp
+  800c35:	c3                   	ret
+
+00800c36 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800c36:	55                   	push   %ebp
+  800c37:	89 e5                	mov    %esp,%ebp
+  800c39:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c3c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  800c3f:	89 c2                	mov    %eax,%edx
+  800c41:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  800c44:	eb 03                	jmp    800c49 <memfind+0x13>
+  800c46:	83 c0 01             	add    $0x1,%eax
+  800c49:	39 d0                	cmp    %edx,%eax
+  800c4b:	73 04                	jae    800c51 <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  800c4d:	38 08                	cmp    %cl,(%eax)
+  800c4f:	75 f5                	jne    800c46 <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  800c51:	5d                   	pop    %ebp
+  800c52:	c3                   	ret
+
+00800c53 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800c53:	55                   	push   %ebp
+  800c54:	89 e5                	mov    %esp,%ebp
+  800c56:	57                   	push   %edi
+  800c57:	56                   	push   %esi
+  800c58:	53                   	push   %ebx
+  800c59:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c5c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  800c5f:	eb 03                	jmp    800c64 <strtol+0x11>
+    s++;
+  800c61:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  800c64:	0f b6 02             	movzbl (%edx),%eax
+  800c67:	3c 20                	cmp    $0x20,%al
+  800c69:	74 f6                	je     800c61 <strtol+0xe>
+  800c6b:	3c 09                	cmp    $0x9,%al
+  800c6d:	74 f2                	je     800c61 <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  800c6f:	3c 2b                	cmp    $0x2b,%al
+  800c71:	74 2a                	je     800c9d <strtol+0x4a>
+  int neg = 0;
+  800c73:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  800c78:	3c 2d                	cmp    $0x2d,%al
+  800c7a:	74 2b                	je     800ca7 <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c7c:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800c82:	75 0f                	jne    800c93 <strtol+0x40>
+  800c84:	80 3a 30             	cmpb   $0x30,(%edx)
+  800c87:	74 28                	je     800cb1 <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  800c89:	85 db                	test   %ebx,%ebx
+  800c8b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c90:	0f 44 d8             	cmove  %eax,%ebx
+  800c93:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c98:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800c9b:	eb 46                	jmp    800ce3 <strtol+0x90>
+    s++;
+  800c9d:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  800ca0:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ca5:	eb d5                	jmp    800c7c <strtol+0x29>
+    s++, neg = 1;
+  800ca7:	83 c2 01             	add    $0x1,%edx
+  800caa:	bf 01 00 00 00       	mov    $0x1,%edi
+  800caf:	eb cb                	jmp    800c7c <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800cb1:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800cb5:	74 0e                	je     800cc5 <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  800cb7:	85 db                	test   %ebx,%ebx
+  800cb9:	75 d8                	jne    800c93 <strtol+0x40>
+    s++, base = 8;
+  800cbb:	83 c2 01             	add    $0x1,%edx
+  800cbe:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800cc3:	eb ce                	jmp    800c93 <strtol+0x40>
+    s += 2, base = 16;
+  800cc5:	83 c2 02             	add    $0x2,%edx
+  800cc8:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800ccd:	eb c4                	jmp    800c93 <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  800ccf:	0f be c0             	movsbl %al,%eax
+  800cd2:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  800cd5:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800cd8:	7d 3a                	jge    800d14 <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  800cda:	83 c2 01             	add    $0x1,%edx
+  800cdd:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800ce1:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  800ce3:	0f b6 02             	movzbl (%edx),%eax
+  800ce6:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800ce9:	89 f3                	mov    %esi,%ebx
+  800ceb:	80 fb 09             	cmp    $0x9,%bl
+  800cee:	76 df                	jbe    800ccf <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  800cf0:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800cf3:	89 f3                	mov    %esi,%ebx
+  800cf5:	80 fb 19             	cmp    $0x19,%bl
+  800cf8:	77 08                	ja     800d02 <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  800cfa:	0f be c0             	movsbl %al,%eax
+  800cfd:	83 e8 57             	sub    $0x57,%eax
+  800d00:	eb d3                	jmp    800cd5 <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  800d02:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800d05:	89 f3                	mov    %esi,%ebx
+  800d07:	80 fb 19             	cmp    $0x19,%bl
+  800d0a:	77 08                	ja     800d14 <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  800d0c:	0f be c0             	movsbl %al,%eax
+  800d0f:	83 e8 37             	sub    $0x37,%eax
+  800d12:	eb c1                	jmp    800cd5 <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  800d14:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800d18:	74 05                	je     800d1f <strtol+0xcc>
+    *endptr = (char*)s;
+  800d1a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d1d:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  800d1f:	89 c8                	mov    %ecx,%eax
+  800d21:	f7 d8                	neg    %eax
+  800d23:	85 ff                	test   %edi,%edi
+  800d25:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800d28:	89 c8                	mov    %ecx,%eax
+  800d2a:	5b                   	pop    %ebx
+  800d2b:	5e                   	pop    %esi
+  800d2c:	5f                   	pop    %edi
+  800d2d:	5d                   	pop    %ebp
+  800d2e:	c3                   	ret
+
+00800d2f <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800d2f:	55                   	push   %ebp
+  800d30:	89 e5                	mov    %esp,%ebp
+  800d32:	57                   	push   %edi
+  800d33:	56                   	push   %esi
+  800d34:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d35:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d3a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d3d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d40:	89 c3                	mov    %eax,%ebx
+  800d42:	89 c7                	mov    %eax,%edi
+  800d44:	89 c6                	mov    %eax,%esi
+  800d46:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800d48:	5b                   	pop    %ebx
+  800d49:	5e                   	pop    %esi
+  800d4a:	5f                   	pop    %edi
+  800d4b:	5d                   	pop    %ebp
+  800d4c:	c3                   	ret
+
+00800d4d <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800d4d:	55                   	push   %ebp
+  800d4e:	89 e5                	mov    %esp,%ebp
+  800d50:	57                   	push   %edi
+  800d51:	56                   	push   %esi
+  800d52:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d53:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d58:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d5d:	89 d1                	mov    %edx,%ecx
+  800d5f:	89 d3                	mov    %edx,%ebx
+  800d61:	89 d7                	mov    %edx,%edi
+  800d63:	89 d6                	mov    %edx,%esi
+  800d65:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800d67:	5b                   	pop    %ebx
+  800d68:	5e                   	pop    %esi
+  800d69:	5f                   	pop    %edi
+  800d6a:	5d                   	pop    %ebp
+  800d6b:	c3                   	ret
+
+00800d6c <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800d6c:	55                   	push   %ebp
+  800d6d:	89 e5                	mov    %esp,%ebp
+  800d6f:	57                   	push   %edi
+  800d70:	56                   	push   %esi
+  800d71:	53                   	push   %ebx
+  800d72:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800d75:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d7a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d7d:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d82:	89 cb                	mov    %ecx,%ebx
+  800d84:	89 cf                	mov    %ecx,%edi
+  800d86:	89 ce                	mov    %ecx,%esi
+  800d88:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d8a:	85 c0                	test   %eax,%eax
+  800d8c:	7f 08                	jg     800d96 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800d8e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d91:	5b                   	pop    %ebx
+  800d92:	5e                   	pop    %esi
+  800d93:	5f                   	pop    %edi
+  800d94:	5d                   	pop    %ebp
+  800d95:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d96:	83 ec 0c             	sub    $0xc,%esp
+  800d99:	50                   	push   %eax
+  800d9a:	6a 03                	push   $0x3
+  800d9c:	68 23 3d 80 00       	push   $0x803d23
+  800da1:	6a 23                	push   $0x23
+  800da3:	68 40 3d 80 00       	push   $0x803d40
+  800da8:	e8 89 f5 ff ff       	call   800336 <_panic>
+
+00800dad <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800dad:	55                   	push   %ebp
+  800dae:	89 e5                	mov    %esp,%ebp
+  800db0:	57                   	push   %edi
+  800db1:	56                   	push   %esi
+  800db2:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800db3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800db8:	b8 02 00 00 00       	mov    $0x2,%eax
+  800dbd:	89 d1                	mov    %edx,%ecx
+  800dbf:	89 d3                	mov    %edx,%ebx
+  800dc1:	89 d7                	mov    %edx,%edi
+  800dc3:	89 d6                	mov    %edx,%esi
+  800dc5:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800dc7:	5b                   	pop    %ebx
+  800dc8:	5e                   	pop    %esi
+  800dc9:	5f                   	pop    %edi
+  800dca:	5d                   	pop    %ebp
+  800dcb:	c3                   	ret
+
+00800dcc <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800dcc:	55                   	push   %ebp
+  800dcd:	89 e5                	mov    %esp,%ebp
+  800dcf:	57                   	push   %edi
+  800dd0:	56                   	push   %esi
+  800dd1:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800dd2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dd7:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800ddc:	89 d1                	mov    %edx,%ecx
+  800dde:	89 d3                	mov    %edx,%ebx
+  800de0:	89 d7                	mov    %edx,%edi
+  800de2:	89 d6                	mov    %edx,%esi
+  800de4:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800de6:	5b                   	pop    %ebx
+  800de7:	5e                   	pop    %esi
+  800de8:	5f                   	pop    %edi
+  800de9:	5d                   	pop    %ebp
+  800dea:	c3                   	ret
+
+00800deb <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  800deb:	55                   	push   %ebp
+  800dec:	89 e5                	mov    %esp,%ebp
+  800dee:	57                   	push   %edi
+  800def:	56                   	push   %esi
+  800df0:	53                   	push   %ebx
+  800df1:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  800df4:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  800df8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dfd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e00:	b8 14 00 00 00       	mov    $0x14,%eax
+  800e05:	89 df                	mov    %ebx,%edi
+  800e07:	89 de                	mov    %ebx,%esi
+  800e09:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e0b:	85 c0                	test   %eax,%eax
+  800e0d:	7f 08                	jg     800e17 <sys_env_set_cow+0x2c>
+}
+  800e0f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e12:	5b                   	pop    %ebx
+  800e13:	5e                   	pop    %esi
+  800e14:	5f                   	pop    %edi
+  800e15:	5d                   	pop    %ebp
+  800e16:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e17:	83 ec 0c             	sub    $0xc,%esp
+  800e1a:	50                   	push   %eax
+  800e1b:	6a 14                	push   $0x14
+  800e1d:	68 23 3d 80 00       	push   $0x803d23
+  800e22:	6a 23                	push   $0x23
+  800e24:	68 40 3d 80 00       	push   $0x803d40
+  800e29:	e8 08 f5 ff ff       	call   800336 <_panic>
+
+00800e2e <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800e2e:	55                   	push   %ebp
+  800e2f:	89 e5                	mov    %esp,%ebp
+  800e31:	57                   	push   %edi
+  800e32:	56                   	push   %esi
+  800e33:	53                   	push   %ebx
+  800e34:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e37:	be 00 00 00 00       	mov    $0x0,%esi
+  800e3c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e3f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e42:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e47:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e4a:	89 f7                	mov    %esi,%edi
+  800e4c:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e4e:	85 c0                	test   %eax,%eax
+  800e50:	7f 08                	jg     800e5a <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  800e52:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e55:	5b                   	pop    %ebx
+  800e56:	5e                   	pop    %esi
+  800e57:	5f                   	pop    %edi
+  800e58:	5d                   	pop    %ebp
+  800e59:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e5a:	83 ec 0c             	sub    $0xc,%esp
+  800e5d:	50                   	push   %eax
+  800e5e:	6a 04                	push   $0x4
+  800e60:	68 23 3d 80 00       	push   $0x803d23
+  800e65:	6a 23                	push   $0x23
+  800e67:	68 40 3d 80 00       	push   $0x803d40
+  800e6c:	e8 c5 f4 ff ff       	call   800336 <_panic>
+
+00800e71 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800e71:	55                   	push   %ebp
+  800e72:	89 e5                	mov    %esp,%ebp
+  800e74:	57                   	push   %edi
+  800e75:	56                   	push   %esi
+  800e76:	53                   	push   %ebx
+  800e77:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e7a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e7d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e80:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e85:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e88:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e8b:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e8e:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e90:	85 c0                	test   %eax,%eax
+  800e92:	7f 08                	jg     800e9c <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  800e94:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e97:	5b                   	pop    %ebx
+  800e98:	5e                   	pop    %esi
+  800e99:	5f                   	pop    %edi
+  800e9a:	5d                   	pop    %ebp
+  800e9b:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e9c:	83 ec 0c             	sub    $0xc,%esp
+  800e9f:	50                   	push   %eax
+  800ea0:	6a 05                	push   $0x5
+  800ea2:	68 23 3d 80 00       	push   $0x803d23
+  800ea7:	6a 23                	push   $0x23
+  800ea9:	68 40 3d 80 00       	push   $0x803d40
+  800eae:	e8 83 f4 ff ff       	call   800336 <_panic>
+
+00800eb3 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800eb3:	55                   	push   %ebp
+  800eb4:	89 e5                	mov    %esp,%ebp
+  800eb6:	57                   	push   %edi
+  800eb7:	56                   	push   %esi
+  800eb8:	53                   	push   %ebx
+  800eb9:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800ebc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ec1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ec7:	b8 06 00 00 00       	mov    $0x6,%eax
+  800ecc:	89 df                	mov    %ebx,%edi
+  800ece:	89 de                	mov    %ebx,%esi
+  800ed0:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ed2:	85 c0                	test   %eax,%eax
+  800ed4:	7f 08                	jg     800ede <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  800ed6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ed9:	5b                   	pop    %ebx
+  800eda:	5e                   	pop    %esi
+  800edb:	5f                   	pop    %edi
+  800edc:	5d                   	pop    %ebp
+  800edd:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ede:	83 ec 0c             	sub    $0xc,%esp
+  800ee1:	50                   	push   %eax
+  800ee2:	6a 06                	push   $0x6
+  800ee4:	68 23 3d 80 00       	push   $0x803d23
+  800ee9:	6a 23                	push   $0x23
+  800eeb:	68 40 3d 80 00       	push   $0x803d40
+  800ef0:	e8 41 f4 ff ff       	call   800336 <_panic>
+
+00800ef5 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  800ef5:	55                   	push   %ebp
+  800ef6:	89 e5                	mov    %esp,%ebp
+  800ef8:	57                   	push   %edi
+  800ef9:	56                   	push   %esi
+  800efa:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800efb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800efe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f01:	b8 11 00 00 00       	mov    $0x11,%eax
+  800f06:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f09:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f0c:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f0f:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  800f11:	5b                   	pop    %ebx
+  800f12:	5e                   	pop    %esi
+  800f13:	5f                   	pop    %edi
+  800f14:	5d                   	pop    %ebp
+  800f15:	c3                   	ret
+
+00800f16 <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  800f16:	55                   	push   %ebp
+  800f17:	89 e5                	mov    %esp,%ebp
+  800f19:	57                   	push   %edi
+  800f1a:	56                   	push   %esi
+  800f1b:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f1c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f1f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f22:	b8 12 00 00 00       	mov    $0x12,%eax
+  800f27:	be 00 00 00 00       	mov    $0x0,%esi
+  800f2c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f2f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f32:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  800f34:	5b                   	pop    %ebx
+  800f35:	5e                   	pop    %esi
+  800f36:	5f                   	pop    %edi
+  800f37:	5d                   	pop    %ebp
+  800f38:	c3                   	ret
+
+00800f39 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  800f39:	55                   	push   %ebp
+  800f3a:	89 e5                	mov    %esp,%ebp
+  800f3c:	57                   	push   %edi
+  800f3d:	56                   	push   %esi
+  800f3e:	53                   	push   %ebx
+  800f3f:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f42:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f47:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f4a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f4d:	b8 16 00 00 00       	mov    $0x16,%eax
+  800f52:	89 df                	mov    %ebx,%edi
+  800f54:	89 de                	mov    %ebx,%esi
+  800f56:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f58:	85 c0                	test   %eax,%eax
+  800f5a:	7f 08                	jg     800f64 <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  800f5c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f5f:	5b                   	pop    %ebx
+  800f60:	5e                   	pop    %esi
+  800f61:	5f                   	pop    %edi
+  800f62:	5d                   	pop    %ebp
+  800f63:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f64:	83 ec 0c             	sub    $0xc,%esp
+  800f67:	50                   	push   %eax
+  800f68:	6a 16                	push   $0x16
+  800f6a:	68 23 3d 80 00       	push   $0x803d23
+  800f6f:	6a 23                	push   $0x23
+  800f71:	68 40 3d 80 00       	push   $0x803d40
+  800f76:	e8 bb f3 ff ff       	call   800336 <_panic>
+
+00800f7b <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  800f7b:	55                   	push   %ebp
+  800f7c:	89 e5                	mov    %esp,%ebp
+  800f7e:	57                   	push   %edi
+  800f7f:	56                   	push   %esi
+  800f80:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f81:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f86:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f89:	b8 17 00 00 00       	mov    $0x17,%eax
+  800f8e:	89 cb                	mov    %ecx,%ebx
+  800f90:	89 cf                	mov    %ecx,%edi
+  800f92:	89 ce                	mov    %ecx,%esi
+  800f94:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  800f96:	5b                   	pop    %ebx
+  800f97:	5e                   	pop    %esi
+  800f98:	5f                   	pop    %edi
+  800f99:	5d                   	pop    %ebp
+  800f9a:	c3                   	ret
+
+00800f9b <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  800f9b:	55                   	push   %ebp
+  800f9c:	89 e5                	mov    %esp,%ebp
+  800f9e:	57                   	push   %edi
+  800f9f:	56                   	push   %esi
+  800fa0:	53                   	push   %ebx
+  800fa1:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800fa4:	be 00 00 00 00       	mov    $0x0,%esi
+  800fa9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800faf:	b8 18 00 00 00       	mov    $0x18,%eax
+  800fb4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fb7:	89 f7                	mov    %esi,%edi
+  800fb9:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800fbb:	85 c0                	test   %eax,%eax
+  800fbd:	7f 08                	jg     800fc7 <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  800fbf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fc2:	5b                   	pop    %ebx
+  800fc3:	5e                   	pop    %esi
+  800fc4:	5f                   	pop    %edi
+  800fc5:	5d                   	pop    %ebp
+  800fc6:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800fc7:	83 ec 0c             	sub    $0xc,%esp
+  800fca:	50                   	push   %eax
+  800fcb:	6a 18                	push   $0x18
+  800fcd:	68 23 3d 80 00       	push   $0x803d23
+  800fd2:	6a 23                	push   $0x23
+  800fd4:	68 40 3d 80 00       	push   $0x803d40
+  800fd9:	e8 58 f3 ff ff       	call   800336 <_panic>
+
+00800fde <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  800fde:	55                   	push   %ebp
+  800fdf:	89 e5                	mov    %esp,%ebp
+  800fe1:	57                   	push   %edi
+  800fe2:	56                   	push   %esi
+  800fe3:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800fe4:	be 00 00 00 00       	mov    $0x0,%esi
+  800fe9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fef:	b8 19 00 00 00       	mov    $0x19,%eax
+  800ff4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ff7:	89 f7                	mov    %esi,%edi
+  800ff9:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  800ffb:	5b                   	pop    %ebx
+  800ffc:	5e                   	pop    %esi
+  800ffd:	5f                   	pop    %edi
+  800ffe:	5d                   	pop    %ebp
+  800fff:	c3                   	ret
+
+00801000 <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  801000:	55                   	push   %ebp
+  801001:	89 e5                	mov    %esp,%ebp
+  801003:	57                   	push   %edi
+  801004:	56                   	push   %esi
+  801005:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801006:	ba 00 00 00 00       	mov    $0x0,%edx
+  80100b:	b8 15 00 00 00       	mov    $0x15,%eax
+  801010:	89 d1                	mov    %edx,%ecx
+  801012:	89 d3                	mov    %edx,%ebx
+  801014:	89 d7                	mov    %edx,%edi
+  801016:	89 d6                	mov    %edx,%esi
+  801018:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  80101a:	5b                   	pop    %ebx
+  80101b:	5e                   	pop    %esi
+  80101c:	5f                   	pop    %edi
+  80101d:	5d                   	pop    %ebp
+  80101e:	c3                   	ret
+
+0080101f <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  80101f:	55                   	push   %ebp
+  801020:	89 e5                	mov    %esp,%ebp
+  801022:	57                   	push   %edi
+  801023:	56                   	push   %esi
+  801024:	53                   	push   %ebx
+  801025:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801028:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80102d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801030:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801033:	b8 08 00 00 00       	mov    $0x8,%eax
+  801038:	89 df                	mov    %ebx,%edi
+  80103a:	89 de                	mov    %ebx,%esi
+  80103c:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80103e:	85 c0                	test   %eax,%eax
+  801040:	7f 08                	jg     80104a <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801042:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801045:	5b                   	pop    %ebx
+  801046:	5e                   	pop    %esi
+  801047:	5f                   	pop    %edi
+  801048:	5d                   	pop    %ebp
+  801049:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80104a:	83 ec 0c             	sub    $0xc,%esp
+  80104d:	50                   	push   %eax
+  80104e:	6a 08                	push   $0x8
+  801050:	68 23 3d 80 00       	push   $0x803d23
+  801055:	6a 23                	push   $0x23
+  801057:	68 40 3d 80 00       	push   $0x803d40
+  80105c:	e8 d5 f2 ff ff       	call   800336 <_panic>
+
+00801061 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801061:	55                   	push   %ebp
+  801062:	89 e5                	mov    %esp,%ebp
+  801064:	57                   	push   %edi
+  801065:	56                   	push   %esi
+  801066:	53                   	push   %ebx
+  801067:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80106a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80106f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801072:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801075:	b8 09 00 00 00       	mov    $0x9,%eax
+  80107a:	89 df                	mov    %ebx,%edi
+  80107c:	89 de                	mov    %ebx,%esi
+  80107e:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801080:	85 c0                	test   %eax,%eax
+  801082:	7f 08                	jg     80108c <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  801084:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801087:	5b                   	pop    %ebx
+  801088:	5e                   	pop    %esi
+  801089:	5f                   	pop    %edi
+  80108a:	5d                   	pop    %ebp
+  80108b:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80108c:	83 ec 0c             	sub    $0xc,%esp
+  80108f:	50                   	push   %eax
+  801090:	6a 09                	push   $0x9
+  801092:	68 23 3d 80 00       	push   $0x803d23
+  801097:	6a 23                	push   $0x23
+  801099:	68 40 3d 80 00       	push   $0x803d40
+  80109e:	e8 93 f2 ff ff       	call   800336 <_panic>
+
+008010a3 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8010a3:	55                   	push   %ebp
+  8010a4:	89 e5                	mov    %esp,%ebp
+  8010a6:	57                   	push   %edi
+  8010a7:	56                   	push   %esi
+  8010a8:	53                   	push   %ebx
+  8010a9:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8010ac:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010b1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010b7:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010bc:	89 df                	mov    %ebx,%edi
+  8010be:	89 de                	mov    %ebx,%esi
+  8010c0:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8010c2:	85 c0                	test   %eax,%eax
+  8010c4:	7f 08                	jg     8010ce <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  8010c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010c9:	5b                   	pop    %ebx
+  8010ca:	5e                   	pop    %esi
+  8010cb:	5f                   	pop    %edi
+  8010cc:	5d                   	pop    %ebp
+  8010cd:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8010ce:	83 ec 0c             	sub    $0xc,%esp
+  8010d1:	50                   	push   %eax
+  8010d2:	6a 0a                	push   $0xa
+  8010d4:	68 23 3d 80 00       	push   $0x803d23
+  8010d9:	6a 23                	push   $0x23
+  8010db:	68 40 3d 80 00       	push   $0x803d40
+  8010e0:	e8 51 f2 ff ff       	call   800336 <_panic>
+
+008010e5 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  8010e5:	55                   	push   %ebp
+  8010e6:	89 e5                	mov    %esp,%ebp
+  8010e8:	57                   	push   %edi
+  8010e9:	56                   	push   %esi
+  8010ea:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8010eb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010f1:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010f6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010f9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010fc:	8b 75 18             	mov    0x18(%ebp),%esi
+  8010ff:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  801101:	5b                   	pop    %ebx
+  801102:	5e                   	pop    %esi
+  801103:	5f                   	pop    %edi
+  801104:	5d                   	pop    %ebp
+  801105:	c3                   	ret
+
+00801106 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  801106:	55                   	push   %ebp
+  801107:	89 e5                	mov    %esp,%ebp
+  801109:	57                   	push   %edi
+  80110a:	56                   	push   %esi
+  80110b:	53                   	push   %ebx
+  80110c:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80110f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801114:	8b 55 08             	mov    0x8(%ebp),%edx
+  801117:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80111a:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80111f:	89 df                	mov    %ebx,%edi
+  801121:	89 de                	mov    %ebx,%esi
+  801123:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801125:	85 c0                	test   %eax,%eax
+  801127:	7f 08                	jg     801131 <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  801129:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80112c:	5b                   	pop    %ebx
+  80112d:	5e                   	pop    %esi
+  80112e:	5f                   	pop    %edi
+  80112f:	5d                   	pop    %ebp
+  801130:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801131:	83 ec 0c             	sub    $0xc,%esp
+  801134:	50                   	push   %eax
+  801135:	6a 0d                	push   $0xd
+  801137:	68 23 3d 80 00       	push   $0x803d23
+  80113c:	6a 23                	push   $0x23
+  80113e:	68 40 3d 80 00       	push   $0x803d40
+  801143:	e8 ee f1 ff ff       	call   800336 <_panic>
+
+00801148 <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  801148:	55                   	push   %ebp
+  801149:	89 e5                	mov    %esp,%ebp
+  80114b:	57                   	push   %edi
+  80114c:	56                   	push   %esi
+  80114d:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80114e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801153:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801158:	89 d1                	mov    %edx,%ecx
+  80115a:	89 d3                	mov    %edx,%ebx
+  80115c:	89 d7                	mov    %edx,%edi
+  80115e:	89 d6                	mov    %edx,%esi
+  801160:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801162:	5b                   	pop    %ebx
+  801163:	5e                   	pop    %esi
+  801164:	5f                   	pop    %edi
+  801165:	5d                   	pop    %ebp
+  801166:	c3                   	ret
+
+00801167 <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  801167:	55                   	push   %ebp
+  801168:	89 e5                	mov    %esp,%ebp
+  80116a:	57                   	push   %edi
+  80116b:	56                   	push   %esi
+  80116c:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80116d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801170:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801173:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801178:	be 00 00 00 00       	mov    $0x0,%esi
+  80117d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801180:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801183:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  801185:	5b                   	pop    %ebx
+  801186:	5e                   	pop    %esi
+  801187:	5f                   	pop    %edi
+  801188:	5d                   	pop    %ebp
+  801189:	c3                   	ret
+
+0080118a <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  80118a:	55                   	push   %ebp
+  80118b:	89 e5                	mov    %esp,%ebp
+  80118d:	57                   	push   %edi
+  80118e:	56                   	push   %esi
+  80118f:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801190:	be 00 00 00 00       	mov    $0x0,%esi
+  801195:	8b 55 08             	mov    0x8(%ebp),%edx
+  801198:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80119b:	b8 10 00 00 00       	mov    $0x10,%eax
+  8011a0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011a3:	89 f7                	mov    %esi,%edi
+  8011a5:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  8011a7:	5b                   	pop    %ebx
+  8011a8:	5e                   	pop    %esi
+  8011a9:	5f                   	pop    %edi
+  8011aa:	5d                   	pop    %ebp
+  8011ab:	c3                   	ret
+
+008011ac <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  8011ac:	55                   	push   %ebp
+  8011ad:	89 e5                	mov    %esp,%ebp
+  8011af:	57                   	push   %edi
+  8011b0:	56                   	push   %esi
+  8011b1:	53                   	push   %ebx
+  8011b2:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  8011b5:	80 3d 68 5e 80 00 00 	cmpb   $0x0,0x805e68
+  8011bc:	74 41                	je     8011ff <sys_batch+0x53>
+  8011be:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011c1:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  8011c4:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  8011cb:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8011ce:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  8011d1:	7d 45                	jge    801218 <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  8011d3:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8011d6:	8b 06                	mov    (%esi),%eax
+  8011d8:	8b 56 04             	mov    0x4(%esi),%edx
+  8011db:	8b 4e 08             	mov    0x8(%esi),%ecx
+  8011de:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  8011e1:	8b 7e 10             	mov    0x10(%esi),%edi
+  8011e4:	8b 76 14             	mov    0x14(%esi),%esi
+  8011e7:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  8011e9:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8011ec:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  8011ef:	83 c6 1c             	add    $0x1c,%esi
+  8011f2:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  8011f5:	85 c0                	test   %eax,%eax
+  8011f7:	78 1f                	js     801218 <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  8011f9:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  8011fd:	eb cc                	jmp    8011cb <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  8011ff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801204:	b8 13 00 00 00       	mov    $0x13,%eax
+  801209:	8b 55 08             	mov    0x8(%ebp),%edx
+  80120c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80120f:	89 df                	mov    %ebx,%edi
+  801211:	89 de                	mov    %ebx,%esi
+  801213:	cd 30                	int    $0x30
+  801215:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  801218:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80121b:	83 c4 08             	add    $0x8,%esp
+  80121e:	5b                   	pop    %ebx
+  80121f:	5e                   	pop    %esi
+  801220:	5f                   	pop    %edi
+  801221:	5d                   	pop    %ebp
+  801222:	c3                   	ret
+
+00801223 <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  801223:	55                   	push   %ebp
+  801224:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  801226:	8b 45 08             	mov    0x8(%ebp),%eax
+  801229:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  80122f:	5d                   	pop    %ebp
+  801230:	c3                   	ret
+
+00801231 <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  801231:	55                   	push   %ebp
+  801232:	89 e5                	mov    %esp,%ebp
+  801234:	56                   	push   %esi
+  801235:	53                   	push   %ebx
+  801236:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  801239:	8b 1e                	mov    (%esi),%ebx
+  80123b:	85 db                	test   %ebx,%ebx
+  80123d:	75 09                	jne    801248 <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  80123f:	89 d8                	mov    %ebx,%eax
+  801241:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801244:	5b                   	pop    %ebx
+  801245:	5e                   	pop    %esi
+  801246:	5d                   	pop    %ebp
+  801247:	c3                   	ret
+  b->sb_n = 0;
+  801248:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  80124e:	53                   	push   %ebx
+  80124f:	8d 46 04             	lea    0x4(%esi),%eax
+  801252:	50                   	push   %eax
+  801253:	e8 54 ff ff ff       	call   8011ac <sys_batch>
+  801258:	83 c4 08             	add    $0x8,%esp
+  80125b:	85 c0                	test   %eax,%eax
+  80125d:	78 1e                	js     80127d <sysbatch_flush+0x4c>
+  if (r < n)
+  80125f:	39 c3                	cmp    %eax,%ebx
+  801261:	7f 07                	jg     80126a <sysbatch_flush+0x39>
+  return 0;
+  801263:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801268:	eb d5                	jmp    80123f <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  80126a:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80126d:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  801271:	85 db                	test   %ebx,%ebx
+  801273:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801278:	0f 49 d8             	cmovns %eax,%ebx
+  80127b:	eb c2                	jmp    80123f <sysbatch_flush+0xe>
+    return r;
+  80127d:	89 c3                	mov    %eax,%ebx
+  80127f:	eb be                	jmp    80123f <sysbatch_flush+0xe>
+
+00801281 <sysbatch_add>:
+{
+  801281:	55                   	push   %ebp
+  801282:	89 e5                	mov    %esp,%ebp
+  801284:	53                   	push   %ebx
+  801285:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  801288:	83 3b 40             	cmpl   $0x40,(%ebx)
+  80128b:	74 41                	je     8012ce <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  80128d:	8b 03                	mov    (%ebx),%eax
+  80128f:	8d 50 01             	lea    0x1(%eax),%edx
+  801292:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  801294:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801297:	01 d8                	add    %ebx,%eax
+  801299:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80129c:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  80129f:	8b 55 10             	mov    0x10(%ebp),%edx
+  8012a2:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  8012a5:	8b 55 14             	mov    0x14(%ebp),%edx
+  8012a8:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  8012ab:	8b 55 18             	mov    0x18(%ebp),%edx
+  8012ae:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  8012b1:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  8012b4:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  8012b7:	8b 55 20             	mov    0x20(%ebp),%edx
+  8012ba:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  8012bd:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  8012c4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8012c9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012cc:	c9                   	leave
+  8012cd:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  8012ce:	53                   	push   %ebx
+  8012cf:	e8 5d ff ff ff       	call   801231 <sysbatch_flush>
+  8012d4:	83 c4 04             	add    $0x4,%esp
+  8012d7:	85 c0                	test   %eax,%eax
+  8012d9:	79 b2                	jns    80128d <sysbatch_add+0xc>
+  8012db:	eb ec                	jmp    8012c9 <sysbatch_add+0x48>
+
+008012dd <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8012dd:	55                   	push   %ebp
+  8012de:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8012e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8012e3:	05 00 00 00 30       	add    $0x30000000,%eax
+  8012e8:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8012eb:	5d                   	pop    %ebp
+  8012ec:	c3                   	ret
+
+008012ed <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8012ed:	55                   	push   %ebp
+  8012ee:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8012f0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8012f3:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  8012f6:	66 b8 00 00          	mov    $0x0,%ax
+  8012fa:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8012ff:	5d                   	pop    %ebp
+  801300:	c3                   	ret
+
+00801301 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801301:	55                   	push   %ebp
+  801302:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  801304:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801309:	eb 02                	jmp    80130d <fd_alloc+0xc>
+  80130b:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80130d:	89 c2                	mov    %eax,%edx
+  80130f:	c1 ea 16             	shr    $0x16,%edx
+  801312:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801319:	f6 c2 01             	test   $0x1,%dl
+  80131c:	74 2b                	je     801349 <fd_alloc+0x48>
+  80131e:	89 c2                	mov    %eax,%edx
+  801320:	c1 ea 0c             	shr    $0xc,%edx
+  801323:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80132a:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801330:	f6 c1 01             	test   $0x1,%cl
+  801333:	74 14                	je     801349 <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  801335:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  80133b:	75 ce                	jne    80130b <fd_alloc+0xa>
+  80133d:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  801342:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801347:	eb 05                	jmp    80134e <fd_alloc+0x4d>
+      return 0;
+  801349:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  80134e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801351:	89 02                	mov    %eax,(%edx)
+}
+  801353:	89 c8                	mov    %ecx,%eax
+  801355:	5d                   	pop    %ebp
+  801356:	c3                   	ret
+
+00801357 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801357:	55                   	push   %ebp
+  801358:	89 e5                	mov    %esp,%ebp
+  80135a:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  80135d:	83 f8 1f             	cmp    $0x1f,%eax
+  801360:	77 30                	ja     801392 <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  801362:	c1 e0 0c             	shl    $0xc,%eax
+  801365:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80136a:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801370:	f6 c2 01             	test   $0x1,%dl
+  801373:	74 24                	je     801399 <fd_lookup+0x42>
+  801375:	89 c2                	mov    %eax,%edx
+  801377:	c1 ea 0c             	shr    $0xc,%edx
+  80137a:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801381:	f6 c2 01             	test   $0x1,%dl
+  801384:	74 1a                	je     8013a0 <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  801386:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801389:	89 02                	mov    %eax,(%edx)
+  return 0;
+  80138b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801390:	5d                   	pop    %ebp
+  801391:	c3                   	ret
+    return -E_INVAL;
+  801392:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801397:	eb f7                	jmp    801390 <fd_lookup+0x39>
+    return -E_INVAL;
+  801399:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80139e:	eb f0                	jmp    801390 <fd_lookup+0x39>
+  8013a0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013a5:	eb e9                	jmp    801390 <fd_lookup+0x39>
+
+008013a7 <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8013a7:	55                   	push   %ebp
+  8013a8:	89 e5                	mov    %esp,%ebp
+  8013aa:	53                   	push   %ebx
+  8013ab:	83 ec 04             	sub    $0x4,%esp
+  8013ae:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  8013b1:	b8 cc 3d 80 00       	mov    $0x803dcc,%eax
+  8013b6:	8b 18                	mov    (%eax),%ebx
+  8013b8:	85 db                	test   %ebx,%ebx
+  8013ba:	74 0e                	je     8013ca <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  8013bc:	83 c0 04             	add    $0x4,%eax
+  8013bf:	39 13                	cmp    %edx,(%ebx)
+  8013c1:	75 f3                	jne    8013b6 <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  8013c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013c8:	eb 1f                	jmp    8013e9 <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8013ca:	a1 64 5e 80 00       	mov    0x805e64,%eax
+  8013cf:	8b 40 48             	mov    0x48(%eax),%eax
+  8013d2:	83 ec 04             	sub    $0x4,%esp
+  8013d5:	52                   	push   %edx
+  8013d6:	50                   	push   %eax
+  8013d7:	68 50 3d 80 00       	push   $0x803d50
+  8013dc:	e8 30 f0 ff ff       	call   800411 <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  8013e1:	83 c4 10             	add    $0x10,%esp
+  8013e4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  8013e9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8013ec:	89 1a                	mov    %ebx,(%edx)
+}
+  8013ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013f1:	c9                   	leave
+  8013f2:	c3                   	ret
+
+008013f3 <fd_close>:
+{
+  8013f3:	55                   	push   %ebp
+  8013f4:	89 e5                	mov    %esp,%ebp
+  8013f6:	57                   	push   %edi
+  8013f7:	56                   	push   %esi
+  8013f8:	53                   	push   %ebx
+  8013f9:	83 ec 24             	sub    $0x24,%esp
+  8013fc:	8b 75 08             	mov    0x8(%ebp),%esi
+  8013ff:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801402:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801405:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801406:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80140c:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80140f:	50                   	push   %eax
+  801410:	e8 42 ff ff ff       	call   801357 <fd_lookup>
+  801415:	89 c3                	mov    %eax,%ebx
+  801417:	83 c4 10             	add    $0x10,%esp
+  80141a:	85 c0                	test   %eax,%eax
+  80141c:	78 05                	js     801423 <fd_close+0x30>
+      || fd != fd2)
+  80141e:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801421:	74 16                	je     801439 <fd_close+0x46>
+    return must_exist ? r : 0;
+  801423:	89 f8                	mov    %edi,%eax
+  801425:	84 c0                	test   %al,%al
+  801427:	b8 00 00 00 00       	mov    $0x0,%eax
+  80142c:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80142f:	89 d8                	mov    %ebx,%eax
+  801431:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801434:	5b                   	pop    %ebx
+  801435:	5e                   	pop    %esi
+  801436:	5f                   	pop    %edi
+  801437:	5d                   	pop    %ebp
+  801438:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801439:	83 ec 08             	sub    $0x8,%esp
+  80143c:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80143f:	50                   	push   %eax
+  801440:	ff 36                	push   (%esi)
+  801442:	e8 60 ff ff ff       	call   8013a7 <dev_lookup>
+  801447:	89 c3                	mov    %eax,%ebx
+  801449:	83 c4 10             	add    $0x10,%esp
+  80144c:	85 c0                	test   %eax,%eax
+  80144e:	78 1a                	js     80146a <fd_close+0x77>
+    if (dev->dev_close)
+  801450:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801453:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  801456:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  80145b:	85 c0                	test   %eax,%eax
+  80145d:	74 0b                	je     80146a <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  80145f:	83 ec 0c             	sub    $0xc,%esp
+  801462:	56                   	push   %esi
+  801463:	ff d0                	call   *%eax
+  801465:	89 c3                	mov    %eax,%ebx
+  801467:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  80146a:	83 ec 08             	sub    $0x8,%esp
+  80146d:	56                   	push   %esi
+  80146e:	6a 00                	push   $0x0
+  801470:	e8 3e fa ff ff       	call   800eb3 <sys_page_unmap>
+  return r;
+  801475:	83 c4 10             	add    $0x10,%esp
+  801478:	eb b5                	jmp    80142f <fd_close+0x3c>
+
+0080147a <close>:
+
+int
+close(int fdnum)
+{
+  80147a:	55                   	push   %ebp
+  80147b:	89 e5                	mov    %esp,%ebp
+  80147d:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801480:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801483:	50                   	push   %eax
+  801484:	ff 75 08             	push   0x8(%ebp)
+  801487:	e8 cb fe ff ff       	call   801357 <fd_lookup>
+  80148c:	83 c4 10             	add    $0x10,%esp
+  80148f:	85 c0                	test   %eax,%eax
+  801491:	79 02                	jns    801495 <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  801493:	c9                   	leave
+  801494:	c3                   	ret
+    return fd_close(fd, 1);
+  801495:	83 ec 08             	sub    $0x8,%esp
+  801498:	6a 01                	push   $0x1
+  80149a:	ff 75 f4             	push   -0xc(%ebp)
+  80149d:	e8 51 ff ff ff       	call   8013f3 <fd_close>
+  8014a2:	83 c4 10             	add    $0x10,%esp
+  8014a5:	eb ec                	jmp    801493 <close+0x19>
+
+008014a7 <close_all>:
+
+void
+close_all(void)
+{
+  8014a7:	55                   	push   %ebp
+  8014a8:	89 e5                	mov    %esp,%ebp
+  8014aa:	53                   	push   %ebx
+  8014ab:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  8014ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  8014b3:	83 ec 0c             	sub    $0xc,%esp
+  8014b6:	53                   	push   %ebx
+  8014b7:	e8 be ff ff ff       	call   80147a <close>
+  for (i = 0; i < MAXFD; i++)
+  8014bc:	83 c3 01             	add    $0x1,%ebx
+  8014bf:	83 c4 10             	add    $0x10,%esp
+  8014c2:	83 fb 20             	cmp    $0x20,%ebx
+  8014c5:	75 ec                	jne    8014b3 <close_all+0xc>
+}
+  8014c7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014ca:	c9                   	leave
+  8014cb:	c3                   	ret
+
+008014cc <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8014cc:	55                   	push   %ebp
+  8014cd:	89 e5                	mov    %esp,%ebp
+  8014cf:	57                   	push   %edi
+  8014d0:	56                   	push   %esi
+  8014d1:	53                   	push   %ebx
+  8014d2:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8014d5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8014d8:	50                   	push   %eax
+  8014d9:	ff 75 08             	push   0x8(%ebp)
+  8014dc:	e8 76 fe ff ff       	call   801357 <fd_lookup>
+  8014e1:	89 c6                	mov    %eax,%esi
+  8014e3:	83 c4 10             	add    $0x10,%esp
+  8014e6:	85 c0                	test   %eax,%eax
+  8014e8:	0f 88 0a 01 00 00    	js     8015f8 <dup+0x12c>
+    return r;
+  close(newfdnum);
+  8014ee:	83 ec 0c             	sub    $0xc,%esp
+  8014f1:	ff 75 0c             	push   0xc(%ebp)
+  8014f4:	e8 81 ff ff ff       	call   80147a <close>
+
+  newfd = INDEX2FD(newfdnum);
+  8014f9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8014fc:	c1 e0 0c             	shl    $0xc,%eax
+  8014ff:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  801505:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  801508:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80150b:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  80150e:	89 04 24             	mov    %eax,(%esp)
+  801511:	e8 d7 fd ff ff       	call   8012ed <fd2data>
+  801516:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  801518:	89 3c 24             	mov    %edi,(%esp)
+  80151b:	e8 cd fd ff ff       	call   8012ed <fd2data>
+  801520:	83 c4 10             	add    $0x10,%esp
+  801523:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801526:	89 f3                	mov    %esi,%ebx
+  801528:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  80152e:	89 c6                	mov    %eax,%esi
+  801530:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801533:	89 cf                	mov    %ecx,%edi
+  801535:	eb 0c                	jmp    801543 <dup+0x77>
+  801537:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80153d:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801543:	39 fb                	cmp    %edi,%ebx
+  801545:	74 7b                	je     8015c2 <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  801547:	89 d8                	mov    %ebx,%eax
+  801549:	c1 e8 16             	shr    $0x16,%eax
+  80154c:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801553:	a8 01                	test   $0x1,%al
+  801555:	74 e0                	je     801537 <dup+0x6b>
+  801557:	89 d8                	mov    %ebx,%eax
+  801559:	c1 e8 0c             	shr    $0xc,%eax
+  80155c:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801563:	f6 c2 01             	test   $0x1,%dl
+  801566:	74 cf                	je     801537 <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  801568:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  80156f:	83 ec 0c             	sub    $0xc,%esp
+  801572:	25 07 0e 00 00       	and    $0xe07,%eax
+  801577:	50                   	push   %eax
+  801578:	56                   	push   %esi
+  801579:	6a 00                	push   $0x0
+  80157b:	53                   	push   %ebx
+  80157c:	6a 00                	push   $0x0
+  80157e:	e8 ee f8 ff ff       	call   800e71 <sys_page_map>
+  801583:	83 c4 20             	add    $0x20,%esp
+  801586:	85 c0                	test   %eax,%eax
+  801588:	79 ad                	jns    801537 <dup+0x6b>
+  80158a:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80158d:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  80158f:	83 ec 08             	sub    $0x8,%esp
+  801592:	ff 75 d4             	push   -0x2c(%ebp)
+  801595:	6a 00                	push   $0x0
+  801597:	e8 17 f9 ff ff       	call   800eb3 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80159c:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  80159f:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  8015a5:	83 c4 10             	add    $0x10,%esp
+  8015a8:	39 df                	cmp    %ebx,%edi
+  8015aa:	74 4c                	je     8015f8 <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  8015ac:	83 ec 08             	sub    $0x8,%esp
+  8015af:	57                   	push   %edi
+  8015b0:	6a 00                	push   $0x0
+  8015b2:	e8 fc f8 ff ff       	call   800eb3 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8015b7:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  8015bd:	83 c4 10             	add    $0x10,%esp
+  8015c0:	eb e6                	jmp    8015a8 <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8015c2:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8015c5:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8015c8:	89 c8                	mov    %ecx,%eax
+  8015ca:	c1 e8 0c             	shr    $0xc,%eax
+  8015cd:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8015d4:	83 ec 0c             	sub    $0xc,%esp
+  8015d7:	25 07 0e 00 00       	and    $0xe07,%eax
+  8015dc:	50                   	push   %eax
+  8015dd:	ff 75 d4             	push   -0x2c(%ebp)
+  8015e0:	6a 00                	push   $0x0
+  8015e2:	51                   	push   %ecx
+  8015e3:	6a 00                	push   $0x0
+  8015e5:	e8 87 f8 ff ff       	call   800e71 <sys_page_map>
+  8015ea:	89 c6                	mov    %eax,%esi
+  8015ec:	83 c4 20             	add    $0x20,%esp
+  8015ef:	85 c0                	test   %eax,%eax
+  8015f1:	78 9c                	js     80158f <dup+0xc3>
+  return newfdnum;
+  8015f3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8015f6:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  8015f8:	89 f0                	mov    %esi,%eax
+  8015fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015fd:	5b                   	pop    %ebx
+  8015fe:	5e                   	pop    %esi
+  8015ff:	5f                   	pop    %edi
+  801600:	5d                   	pop    %ebp
+  801601:	c3                   	ret
+
+00801602 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801602:	55                   	push   %ebp
+  801603:	89 e5                	mov    %esp,%ebp
+  801605:	56                   	push   %esi
+  801606:	53                   	push   %ebx
+  801607:	83 ec 18             	sub    $0x18,%esp
+  80160a:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  80160d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801610:	50                   	push   %eax
+  801611:	56                   	push   %esi
+  801612:	e8 40 fd ff ff       	call   801357 <fd_lookup>
+  801617:	83 c4 10             	add    $0x10,%esp
+  80161a:	85 c0                	test   %eax,%eax
+  80161c:	78 3c                	js     80165a <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80161e:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801621:	83 ec 08             	sub    $0x8,%esp
+  801624:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801627:	50                   	push   %eax
+  801628:	ff 33                	push   (%ebx)
+  80162a:	e8 78 fd ff ff       	call   8013a7 <dev_lookup>
+  80162f:	83 c4 10             	add    $0x10,%esp
+  801632:	85 c0                	test   %eax,%eax
+  801634:	78 24                	js     80165a <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801636:	8b 43 08             	mov    0x8(%ebx),%eax
+  801639:	83 e0 03             	and    $0x3,%eax
+  80163c:	83 f8 01             	cmp    $0x1,%eax
+  80163f:	74 20                	je     801661 <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  801641:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801644:	8b 40 08             	mov    0x8(%eax),%eax
+  801647:	85 c0                	test   %eax,%eax
+  801649:	74 37                	je     801682 <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  80164b:	83 ec 04             	sub    $0x4,%esp
+  80164e:	ff 75 10             	push   0x10(%ebp)
+  801651:	ff 75 0c             	push   0xc(%ebp)
+  801654:	53                   	push   %ebx
+  801655:	ff d0                	call   *%eax
+  801657:	83 c4 10             	add    $0x10,%esp
+}
+  80165a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80165d:	5b                   	pop    %ebx
+  80165e:	5e                   	pop    %esi
+  80165f:	5d                   	pop    %ebp
+  801660:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801661:	a1 64 5e 80 00       	mov    0x805e64,%eax
+  801666:	8b 40 48             	mov    0x48(%eax),%eax
+  801669:	83 ec 04             	sub    $0x4,%esp
+  80166c:	56                   	push   %esi
+  80166d:	50                   	push   %eax
+  80166e:	68 91 3d 80 00       	push   $0x803d91
+  801673:	e8 99 ed ff ff       	call   800411 <cprintf>
+    return -E_INVAL;
+  801678:	83 c4 10             	add    $0x10,%esp
+  80167b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801680:	eb d8                	jmp    80165a <read+0x58>
+    return -E_NOT_SUPP;
+  801682:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801687:	eb d1                	jmp    80165a <read+0x58>
+
+00801689 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801689:	55                   	push   %ebp
+  80168a:	89 e5                	mov    %esp,%ebp
+  80168c:	57                   	push   %edi
+  80168d:	56                   	push   %esi
+  80168e:	53                   	push   %ebx
+  80168f:	83 ec 0c             	sub    $0xc,%esp
+  801692:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801695:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  801698:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80169d:	eb 02                	jmp    8016a1 <readn+0x18>
+  80169f:	01 c3                	add    %eax,%ebx
+  8016a1:	39 f3                	cmp    %esi,%ebx
+  8016a3:	73 21                	jae    8016c6 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  8016a5:	83 ec 04             	sub    $0x4,%esp
+  8016a8:	89 f0                	mov    %esi,%eax
+  8016aa:	29 d8                	sub    %ebx,%eax
+  8016ac:	50                   	push   %eax
+  8016ad:	89 d8                	mov    %ebx,%eax
+  8016af:	03 45 0c             	add    0xc(%ebp),%eax
+  8016b2:	50                   	push   %eax
+  8016b3:	57                   	push   %edi
+  8016b4:	e8 49 ff ff ff       	call   801602 <read>
+    if (m < 0)
+  8016b9:	83 c4 10             	add    $0x10,%esp
+  8016bc:	85 c0                	test   %eax,%eax
+  8016be:	78 04                	js     8016c4 <readn+0x3b>
+      return m;
+    if (m == 0)
+  8016c0:	75 dd                	jne    80169f <readn+0x16>
+  8016c2:	eb 02                	jmp    8016c6 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  8016c4:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  8016c6:	89 d8                	mov    %ebx,%eax
+  8016c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016cb:	5b                   	pop    %ebx
+  8016cc:	5e                   	pop    %esi
+  8016cd:	5f                   	pop    %edi
+  8016ce:	5d                   	pop    %ebp
+  8016cf:	c3                   	ret
+
+008016d0 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8016d0:	55                   	push   %ebp
+  8016d1:	89 e5                	mov    %esp,%ebp
+  8016d3:	56                   	push   %esi
+  8016d4:	53                   	push   %ebx
+  8016d5:	83 ec 18             	sub    $0x18,%esp
+  8016d8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016db:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016de:	50                   	push   %eax
+  8016df:	53                   	push   %ebx
+  8016e0:	e8 72 fc ff ff       	call   801357 <fd_lookup>
+  8016e5:	83 c4 10             	add    $0x10,%esp
+  8016e8:	85 c0                	test   %eax,%eax
+  8016ea:	78 37                	js     801723 <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8016ec:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8016ef:	83 ec 08             	sub    $0x8,%esp
+  8016f2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016f5:	50                   	push   %eax
+  8016f6:	ff 36                	push   (%esi)
+  8016f8:	e8 aa fc ff ff       	call   8013a7 <dev_lookup>
+  8016fd:	83 c4 10             	add    $0x10,%esp
+  801700:	85 c0                	test   %eax,%eax
+  801702:	78 1f                	js     801723 <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801704:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801708:	74 20                	je     80172a <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  80170a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80170d:	8b 40 0c             	mov    0xc(%eax),%eax
+  801710:	85 c0                	test   %eax,%eax
+  801712:	74 37                	je     80174b <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  801714:	83 ec 04             	sub    $0x4,%esp
+  801717:	ff 75 10             	push   0x10(%ebp)
+  80171a:	ff 75 0c             	push   0xc(%ebp)
+  80171d:	56                   	push   %esi
+  80171e:	ff d0                	call   *%eax
+  801720:	83 c4 10             	add    $0x10,%esp
+}
+  801723:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801726:	5b                   	pop    %ebx
+  801727:	5e                   	pop    %esi
+  801728:	5d                   	pop    %ebp
+  801729:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80172a:	a1 64 5e 80 00       	mov    0x805e64,%eax
+  80172f:	8b 40 48             	mov    0x48(%eax),%eax
+  801732:	83 ec 04             	sub    $0x4,%esp
+  801735:	53                   	push   %ebx
+  801736:	50                   	push   %eax
+  801737:	68 ad 3d 80 00       	push   $0x803dad
+  80173c:	e8 d0 ec ff ff       	call   800411 <cprintf>
+    return -E_INVAL;
+  801741:	83 c4 10             	add    $0x10,%esp
+  801744:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801749:	eb d8                	jmp    801723 <write+0x53>
+    return -E_NOT_SUPP;
+  80174b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801750:	eb d1                	jmp    801723 <write+0x53>
+
+00801752 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801752:	55                   	push   %ebp
+  801753:	89 e5                	mov    %esp,%ebp
+  801755:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801758:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80175b:	50                   	push   %eax
+  80175c:	ff 75 08             	push   0x8(%ebp)
+  80175f:	e8 f3 fb ff ff       	call   801357 <fd_lookup>
+  801764:	83 c4 10             	add    $0x10,%esp
+  801767:	85 c0                	test   %eax,%eax
+  801769:	78 0e                	js     801779 <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  80176b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80176e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801771:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  801774:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801779:	c9                   	leave
+  80177a:	c3                   	ret
+
+0080177b <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80177b:	55                   	push   %ebp
+  80177c:	89 e5                	mov    %esp,%ebp
+  80177e:	56                   	push   %esi
+  80177f:	53                   	push   %ebx
+  801780:	83 ec 18             	sub    $0x18,%esp
+  801783:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801786:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801789:	50                   	push   %eax
+  80178a:	53                   	push   %ebx
+  80178b:	e8 c7 fb ff ff       	call   801357 <fd_lookup>
+  801790:	83 c4 10             	add    $0x10,%esp
+  801793:	85 c0                	test   %eax,%eax
+  801795:	78 34                	js     8017cb <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801797:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80179a:	83 ec 08             	sub    $0x8,%esp
+  80179d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017a0:	50                   	push   %eax
+  8017a1:	ff 36                	push   (%esi)
+  8017a3:	e8 ff fb ff ff       	call   8013a7 <dev_lookup>
+  8017a8:	83 c4 10             	add    $0x10,%esp
+  8017ab:	85 c0                	test   %eax,%eax
+  8017ad:	78 1c                	js     8017cb <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8017af:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8017b3:	74 1d                	je     8017d2 <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  8017b5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017b8:	8b 40 18             	mov    0x18(%eax),%eax
+  8017bb:	85 c0                	test   %eax,%eax
+  8017bd:	74 34                	je     8017f3 <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  8017bf:	83 ec 08             	sub    $0x8,%esp
+  8017c2:	ff 75 0c             	push   0xc(%ebp)
+  8017c5:	56                   	push   %esi
+  8017c6:	ff d0                	call   *%eax
+  8017c8:	83 c4 10             	add    $0x10,%esp
+}
+  8017cb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017ce:	5b                   	pop    %ebx
+  8017cf:	5e                   	pop    %esi
+  8017d0:	5d                   	pop    %ebp
+  8017d1:	c3                   	ret
+            thisenv->env_id, fdnum);
+  8017d2:	a1 64 5e 80 00       	mov    0x805e64,%eax
+  8017d7:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8017da:	83 ec 04             	sub    $0x4,%esp
+  8017dd:	53                   	push   %ebx
+  8017de:	50                   	push   %eax
+  8017df:	68 70 3d 80 00       	push   $0x803d70
+  8017e4:	e8 28 ec ff ff       	call   800411 <cprintf>
+    return -E_INVAL;
+  8017e9:	83 c4 10             	add    $0x10,%esp
+  8017ec:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017f1:	eb d8                	jmp    8017cb <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  8017f3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017f8:	eb d1                	jmp    8017cb <ftruncate+0x50>
+
+008017fa <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8017fa:	55                   	push   %ebp
+  8017fb:	89 e5                	mov    %esp,%ebp
+  8017fd:	56                   	push   %esi
+  8017fe:	53                   	push   %ebx
+  8017ff:	83 ec 18             	sub    $0x18,%esp
+  801802:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801805:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801808:	50                   	push   %eax
+  801809:	ff 75 08             	push   0x8(%ebp)
+  80180c:	e8 46 fb ff ff       	call   801357 <fd_lookup>
+  801811:	83 c4 10             	add    $0x10,%esp
+  801814:	85 c0                	test   %eax,%eax
+  801816:	78 49                	js     801861 <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801818:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80181b:	83 ec 08             	sub    $0x8,%esp
+  80181e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801821:	50                   	push   %eax
+  801822:	ff 36                	push   (%esi)
+  801824:	e8 7e fb ff ff       	call   8013a7 <dev_lookup>
+  801829:	83 c4 10             	add    $0x10,%esp
+  80182c:	85 c0                	test   %eax,%eax
+  80182e:	78 31                	js     801861 <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  801830:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801833:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801837:	74 2f                	je     801868 <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  801839:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  80183c:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801843:	00 00 00 
+  stat->st_isdir = 0;
+  801846:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80184d:	00 00 00 
+  stat->st_dev = dev;
+  801850:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  801856:	83 ec 08             	sub    $0x8,%esp
+  801859:	53                   	push   %ebx
+  80185a:	56                   	push   %esi
+  80185b:	ff 50 14             	call   *0x14(%eax)
+  80185e:	83 c4 10             	add    $0x10,%esp
+}
+  801861:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801864:	5b                   	pop    %ebx
+  801865:	5e                   	pop    %esi
+  801866:	5d                   	pop    %ebp
+  801867:	c3                   	ret
+    return -E_NOT_SUPP;
+  801868:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80186d:	eb f2                	jmp    801861 <fstat+0x67>
+
+0080186f <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  80186f:	55                   	push   %ebp
+  801870:	89 e5                	mov    %esp,%ebp
+  801872:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  801875:	ff 75 0c             	push   0xc(%ebp)
+  801878:	ff 75 08             	push   0x8(%ebp)
+  80187b:	e8 58 07 00 00       	call   801fd8 <file_stat>
+}
+  801880:	c9                   	leave
+  801881:	c3                   	ret
+
+00801882 <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  801882:	55                   	push   %ebp
+  801883:	89 e5                	mov    %esp,%ebp
+  801885:	57                   	push   %edi
+  801886:	56                   	push   %esi
+  801887:	53                   	push   %ebx
+  801888:	83 ec 1c             	sub    $0x1c,%esp
+  80188b:	89 c7                	mov    %eax,%edi
+  80188d:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801890:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801893:	e9 a2 00 00 00       	jmp    80193a <fsipc_send+0xb8>
+  nfsenvs = 0;
+  801898:	c7 05 00 50 80 00 00 	movl   $0x0,0x805000
+  80189f:	00 00 00 
+  8018a2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018a7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  8018ac:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  8018b1:	be 01 00 00 00       	mov    $0x1,%esi
+  8018b6:	eb 0f                	jmp    8018c7 <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  8018b8:	83 c0 01             	add    $0x1,%eax
+  8018bb:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8018c0:	74 49                	je     80190b <fsipc_send+0x89>
+  8018c2:	83 f9 07             	cmp    $0x7,%ecx
+  8018c5:	7f 50                	jg     801917 <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  8018c7:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  8018ca:	c1 e2 04             	shl    $0x4,%edx
+  8018cd:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8018d3:	8b 52 50             	mov    0x50(%edx),%edx
+  8018d6:	83 fa 01             	cmp    $0x1,%edx
+  8018d9:	75 dd                	jne    8018b8 <fsipc_send+0x36>
+  8018db:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  8018de:	c1 e2 04             	shl    $0x4,%edx
+  8018e1:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8018e7:	8b 52 54             	mov    0x54(%edx),%edx
+  8018ea:	85 d2                	test   %edx,%edx
+  8018ec:	74 ca                	je     8018b8 <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  8018ee:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  8018f1:	c1 e2 04             	shl    $0x4,%edx
+  8018f4:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8018fa:	8b 52 48             	mov    0x48(%edx),%edx
+  8018fd:	89 14 8d 20 50 80 00 	mov    %edx,0x805020(,%ecx,4)
+  801904:	8d 49 01             	lea    0x1(%ecx),%ecx
+  801907:	89 f3                	mov    %esi,%ebx
+  801909:	eb ad                	jmp    8018b8 <fsipc_send+0x36>
+  80190b:	84 db                	test   %bl,%bl
+  80190d:	74 38                	je     801947 <fsipc_send+0xc5>
+  80190f:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  801915:	eb 30                	jmp    801947 <fsipc_send+0xc5>
+  801917:	84 db                	test   %bl,%bl
+  801919:	74 2c                	je     801947 <fsipc_send+0xc5>
+  80191b:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  801921:	eb 24                	jmp    801947 <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  801923:	50                   	push   %eax
+  801924:	68 dc 3d 80 00       	push   $0x803ddc
+  801929:	6a 34                	push   $0x34
+  80192b:	68 e6 3d 80 00       	push   $0x803de6
+  801930:	e8 01 ea ff ff       	call   800336 <_panic>
+    }
+    sys_yield();
+  801935:	e8 92 f4 ff ff       	call   800dcc <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  80193a:	83 3d 00 50 80 00 03 	cmpl   $0x3,0x805000
+  801941:	0f 8e 51 ff ff ff    	jle    801898 <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  801947:	a1 64 5e 80 00       	mov    0x805e64,%eax
+  80194c:	8b 70 48             	mov    0x48(%eax),%esi
+  80194f:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  801955:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80195a:	8b 0d 00 50 80 00    	mov    0x805000,%ecx
+  801960:	39 d9                	cmp    %ebx,%ecx
+  801962:	7e d1                	jle    801935 <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  801964:	83 ec 0c             	sub    $0xc,%esp
+  801967:	ff 75 e0             	push   -0x20(%ebp)
+  80196a:	6a 07                	push   $0x7
+  80196c:	ff 75 e4             	push   -0x1c(%ebp)
+  80196f:	57                   	push   %edi
+  801970:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  801973:	99                   	cltd
+  801974:	f7 f9                	idiv   %ecx
+  801976:	ff 34 95 20 50 80 00 	push   0x805020(,%edx,4)
+  80197d:	e8 63 f7 ff ff       	call   8010e5 <sys_ipc_try_send>
+      if (r == 0)
+  801982:	83 c4 20             	add    $0x20,%esp
+  801985:	85 c0                	test   %eax,%eax
+  801987:	74 0a                	je     801993 <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  801989:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80198c:	75 95                	jne    801923 <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  80198e:	83 c3 01             	add    $0x1,%ebx
+  801991:	eb c7                	jmp    80195a <fsipc_send+0xd8>
+  }
+}
+  801993:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801996:	5b                   	pop    %ebx
+  801997:	5e                   	pop    %esi
+  801998:	5f                   	pop    %edi
+  801999:	5d                   	pop    %ebp
+  80199a:	c3                   	ret
+
+0080199b <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  80199b:	55                   	push   %ebp
+  80199c:	89 e5                	mov    %esp,%ebp
+  80199e:	53                   	push   %ebx
+  80199f:	83 ec 14             	sub    $0x14,%esp
+  8019a2:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  8019a4:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  8019ab:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8019b0:	ba 00 60 80 00       	mov    $0x806000,%edx
+  8019b5:	e8 c8 fe ff ff       	call   801882 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  8019ba:	6a 00                	push   $0x0
+  8019bc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019bf:	50                   	push   %eax
+  8019c0:	53                   	push   %ebx
+  8019c1:	6a 00                	push   $0x0
+  8019c3:	e8 1e 1b 00 00       	call   8034e6 <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  8019c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019cb:	c9                   	leave
+  8019cc:	c3                   	ret
+
+008019cd <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8019cd:	55                   	push   %ebp
+  8019ce:	89 e5                	mov    %esp,%ebp
+  8019d0:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8019d3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019d6:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019d9:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.set_size.req_size = newsize;
+  8019de:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8019e1:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  8019e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019eb:	b8 02 00 00 00       	mov    $0x2,%eax
+  8019f0:	e8 a6 ff ff ff       	call   80199b <fsipc>
+}
+  8019f5:	c9                   	leave
+  8019f6:	c3                   	ret
+
+008019f7 <devfile_flush>:
+{
+  8019f7:	55                   	push   %ebp
+  8019f8:	89 e5                	mov    %esp,%ebp
+  8019fa:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8019fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a00:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a03:	a3 00 60 80 00       	mov    %eax,0x806000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801a08:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a0d:	b8 06 00 00 00       	mov    $0x6,%eax
+  801a12:	e8 84 ff ff ff       	call   80199b <fsipc>
+}
+  801a17:	c9                   	leave
+  801a18:	c3                   	ret
+
+00801a19 <devfile_stat>:
+{
+  801a19:	55                   	push   %ebp
+  801a1a:	89 e5                	mov    %esp,%ebp
+  801a1c:	53                   	push   %ebx
+  801a1d:	83 ec 04             	sub    $0x4,%esp
+  801a20:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801a23:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a26:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a29:	a3 00 60 80 00       	mov    %eax,0x806000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801a2e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a33:	b8 05 00 00 00       	mov    $0x5,%eax
+  801a38:	e8 5e ff ff ff       	call   80199b <fsipc>
+  801a3d:	85 c0                	test   %eax,%eax
+  801a3f:	78 2c                	js     801a6d <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801a41:	83 ec 08             	sub    $0x8,%esp
+  801a44:	68 00 60 80 00       	push   $0x806000
+  801a49:	53                   	push   %ebx
+  801a4a:	e8 b0 ef ff ff       	call   8009ff <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  801a4f:	a1 80 60 80 00       	mov    0x806080,%eax
+  801a54:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801a5a:	a1 84 60 80 00       	mov    0x806084,%eax
+  801a5f:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801a65:	83 c4 10             	add    $0x10,%esp
+  801a68:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a6d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a70:	c9                   	leave
+  801a71:	c3                   	ret
+
+00801a72 <fsv_alloc>:
+{
+  801a72:	55                   	push   %ebp
+  801a73:	89 e5                	mov    %esp,%ebp
+  801a75:	56                   	push   %esi
+  801a76:	53                   	push   %ebx
+  801a77:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  801a79:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a7e:	eb 22                	jmp    801aa2 <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  801a80:	83 ec 04             	sub    $0x4,%esp
+  801a83:	6a 00                	push   $0x0
+  801a85:	6a 00                	push   $0x0
+  801a87:	6a 07                	push   $0x7
+  801a89:	50                   	push   %eax
+  801a8a:	6a 00                	push   $0x0
+  801a8c:	6a 04                	push   $0x4
+  801a8e:	68 40 50 80 00       	push   $0x805040
+  801a93:	e8 e9 f7 ff ff       	call   801281 <sysbatch_add>
+  801a98:	83 c4 20             	add    $0x20,%esp
+  801a9b:	85 c0                	test   %eax,%eax
+  801a9d:	78 48                	js     801ae7 <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  801a9f:	83 c3 01             	add    $0x1,%ebx
+  801aa2:	39 f3                	cmp    %esi,%ebx
+  801aa4:	74 31                	je     801ad7 <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  801aa6:	89 d8                	mov    %ebx,%eax
+  801aa8:	c1 e0 0c             	shl    $0xc,%eax
+  801aab:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801ab0:	89 c2                	mov    %eax,%edx
+  801ab2:	c1 ea 16             	shr    $0x16,%edx
+  801ab5:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801abc:	f6 c2 01             	test   $0x1,%dl
+  801abf:	74 bf                	je     801a80 <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  801ac1:	89 c2                	mov    %eax,%edx
+  801ac3:	c1 ea 0c             	shr    $0xc,%edx
+  801ac6:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801acd:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801ad0:	83 fa 03             	cmp    $0x3,%edx
+  801ad3:	75 ab                	jne    801a80 <fsv_alloc+0xe>
+  801ad5:	eb c8                	jmp    801a9f <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  801ad7:	83 ec 0c             	sub    $0xc,%esp
+  801ada:	68 40 50 80 00       	push   $0x805040
+  801adf:	e8 4d f7 ff ff       	call   801231 <sysbatch_flush>
+  801ae4:	83 c4 10             	add    $0x10,%esp
+}
+  801ae7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801aea:	5b                   	pop    %ebx
+  801aeb:	5e                   	pop    %esi
+  801aec:	5d                   	pop    %ebp
+  801aed:	c3                   	ret
+
+00801aee <devfile_read>:
+{
+  801aee:	55                   	push   %ebp
+  801aef:	89 e5                	mov    %esp,%ebp
+  801af1:	57                   	push   %edi
+  801af2:	56                   	push   %esi
+  801af3:	53                   	push   %ebx
+  801af4:	83 ec 3c             	sub    $0x3c,%esp
+  801af7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  801afa:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  801b00:	77 57                	ja     801b59 <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801b02:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b05:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b08:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read.req_n = n;
+  801b0d:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801b13:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b18:	b8 03 00 00 00       	mov    $0x3,%eax
+  801b1d:	e8 79 fe ff ff       	call   80199b <fsipc>
+  801b22:	89 c6                	mov    %eax,%esi
+  801b24:	85 c0                	test   %eax,%eax
+  801b26:	78 27                	js     801b4f <devfile_read+0x61>
+  assert(r <= n);
+  801b28:	39 c3                	cmp    %eax,%ebx
+  801b2a:	0f 82 0e 02 00 00    	jb     801d3e <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  801b30:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801b35:	0f 8f 1c 02 00 00    	jg     801d57 <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801b3b:	83 ec 04             	sub    $0x4,%esp
+  801b3e:	50                   	push   %eax
+  801b3f:	68 00 60 80 00       	push   $0x806000
+  801b44:	ff 75 0c             	push   0xc(%ebp)
+  801b47:	e8 39 f0 ff ff       	call   800b85 <memmove>
+  return r;
+  801b4c:	83 c4 10             	add    $0x10,%esp
+}
+  801b4f:	89 f0                	mov    %esi,%eax
+  801b51:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b54:	5b                   	pop    %ebx
+  801b55:	5e                   	pop    %esi
+  801b56:	5f                   	pop    %edi
+  801b57:	5d                   	pop    %ebp
+  801b58:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  801b59:	b8 01 00 00 00       	mov    $0x1,%eax
+  801b5e:	e8 0f ff ff ff       	call   801a72 <fsv_alloc>
+  801b63:	89 c6                	mov    %eax,%esi
+  801b65:	85 c0                	test   %eax,%eax
+  801b67:	78 e6                	js     801b4f <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  801b69:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b6c:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b6f:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  801b74:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b77:	8b 40 04             	mov    0x4(%eax),%eax
+  801b7a:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  801b7f:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  801b85:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801b8c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801b91:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801b96:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801b9b:	e8 e2 fc ff ff       	call   801882 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801ba0:	6a 00                	push   $0x0
+  801ba2:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801ba5:	50                   	push   %eax
+  801ba6:	68 00 10 c0 9f       	push   $0x9fc01000
+  801bab:	6a 00                	push   $0x0
+  801bad:	e8 34 19 00 00       	call   8034e6 <ipc_recv_pages>
+  801bb2:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  801bb4:	83 c4 10             	add    $0x10,%esp
+  801bb7:	85 c0                	test   %eax,%eax
+  801bb9:	7e 94                	jle    801b4f <devfile_read+0x61>
+  assert(r <= n);
+  801bbb:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801bbe:	39 c3                	cmp    %eax,%ebx
+  801bc0:	72 2e                	jb     801bf0 <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801bc2:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bc5:	8b 40 04             	mov    0x4(%eax),%eax
+  801bc8:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801bcd:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  801bd0:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801bd3:	c1 e2 0c             	shl    $0xc,%edx
+  801bd6:	39 ca                	cmp    %ecx,%edx
+  801bd8:	72 2f                	jb     801c09 <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  801bda:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  801bdf:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  801be2:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  801be6:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801beb:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  801bee:	eb 52                	jmp    801c42 <devfile_read+0x154>
+  assert(r <= n);
+  801bf0:	68 f1 3d 80 00       	push   $0x803df1
+  801bf5:	68 f8 3d 80 00       	push   $0x803df8
+  801bfa:	68 49 01 00 00       	push   $0x149
+  801bff:	68 e6 3d 80 00       	push   $0x803de6
+  801c04:	e8 2d e7 ff ff       	call   800336 <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801c09:	68 1c 3e 80 00       	push   $0x803e1c
+  801c0e:	68 f8 3d 80 00       	push   $0x803df8
+  801c13:	68 4a 01 00 00       	push   $0x14a
+  801c18:	68 e6 3d 80 00       	push   $0x803de6
+  801c1d:	e8 14 e7 ff ff       	call   800336 <_panic>
+      memmove(dst + done, src + done, m);
+  801c22:	83 ec 04             	sub    $0x4,%esp
+  801c25:	53                   	push   %ebx
+  801c26:	56                   	push   %esi
+  801c27:	89 f8                	mov    %edi,%eax
+  801c29:	03 45 0c             	add    0xc(%ebp),%eax
+  801c2c:	50                   	push   %eax
+  801c2d:	e8 53 ef ff ff       	call   800b85 <memmove>
+  801c32:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  801c35:	01 df                	add    %ebx,%edi
+  801c37:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801c3a:	39 c7                	cmp    %eax,%edi
+  801c3c:	0f 83 c0 00 00 00    	jae    801d02 <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801c42:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801c45:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  801c48:	89 f0                	mov    %esi,%eax
+  801c4a:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801c4f:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  801c54:	29 c3                	sub    %eax,%ebx
+  801c56:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801c59:	29 f8                	sub    %edi,%eax
+  801c5b:	39 c3                	cmp    %eax,%ebx
+  801c5d:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  801c60:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801c66:	75 ba                	jne    801c22 <devfile_read+0x134>
+  801c68:	89 f9                	mov    %edi,%ecx
+  801c6a:	03 4d 0c             	add    0xc(%ebp),%ecx
+  801c6d:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  801c70:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  801c76:	75 aa                	jne    801c22 <devfile_read+0x134>
+  801c78:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  801c7e:	77 a2                	ja     801c22 <devfile_read+0x134>
+  801c80:	89 c8                	mov    %ecx,%eax
+  801c82:	c1 e8 16             	shr    $0x16,%eax
+  801c85:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801c8c:	a8 01                	test   $0x1,%al
+  801c8e:	74 92                	je     801c22 <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  801c90:	89 c8                	mov    %ecx,%eax
+  801c92:	c1 e8 0c             	shr    $0xc,%eax
+  801c95:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  801c9c:	a8 01                	test   $0x1,%al
+  801c9e:	74 82                	je     801c22 <devfile_read+0x134>
+  801ca0:	a9 02 08 00 00       	test   $0x802,%eax
+  801ca5:	0f 84 77 ff ff ff    	je     801c22 <devfile_read+0x134>
+  801cab:	f6 c4 04             	test   $0x4,%ah
+  801cae:	0f 85 6e ff ff ff    	jne    801c22 <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  801cb4:	a1 64 5e 80 00       	mov    0x805e64,%eax
+  801cb9:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  801cbd:	84 c0                	test   %al,%al
+  801cbf:	75 17                	jne    801cd8 <devfile_read+0x1ea>
+  801cc1:	83 ec 08             	sub    $0x8,%esp
+  801cc4:	6a 01                	push   $0x1
+  801cc6:	6a 00                	push   $0x0
+  801cc8:	e8 1e f1 ff ff       	call   800deb <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  801ccd:	83 c4 10             	add    $0x10,%esp
+  801cd0:	85 c0                	test   %eax,%eax
+  801cd2:	0f 85 4a ff ff ff    	jne    801c22 <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  801cd8:	83 ec 04             	sub    $0x4,%esp
+  801cdb:	68 05 08 00 00       	push   $0x805
+  801ce0:	ff 75 cc             	push   -0x34(%ebp)
+  801ce3:	6a 00                	push   $0x0
+  801ce5:	56                   	push   %esi
+  801ce6:	6a 00                	push   $0x0
+  801ce8:	6a 05                	push   $0x5
+  801cea:	68 40 50 80 00       	push   $0x805040
+  801cef:	e8 8d f5 ff ff       	call   801281 <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  801cf4:	c1 e8 1f             	shr    $0x1f,%eax
+  801cf7:	08 45 cb             	or     %al,-0x35(%ebp)
+  801cfa:	83 c4 20             	add    $0x20,%esp
+  801cfd:	e9 33 ff ff ff       	jmp    801c35 <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  801d02:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  801d05:	83 ec 0c             	sub    $0xc,%esp
+  801d08:	68 40 50 80 00       	push   $0x805040
+  801d0d:	e8 1f f5 ff ff       	call   801231 <sysbatch_flush>
+  801d12:	83 c4 10             	add    $0x10,%esp
+  801d15:	85 c0                	test   %eax,%eax
+  801d17:	78 06                	js     801d1f <devfile_read+0x231>
+  801d19:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  801d1d:	74 14                	je     801d33 <devfile_read+0x245>
+    memmove(dst, src, r);
+  801d1f:	83 ec 04             	sub    $0x4,%esp
+  801d22:	ff 75 d4             	push   -0x2c(%ebp)
+  801d25:	ff 75 d0             	push   -0x30(%ebp)
+  801d28:	ff 75 0c             	push   0xc(%ebp)
+  801d2b:	e8 55 ee ff ff       	call   800b85 <memmove>
+  801d30:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  801d33:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d36:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  801d39:	e9 11 fe ff ff       	jmp    801b4f <devfile_read+0x61>
+  assert(r <= n);
+  801d3e:	68 f1 3d 80 00       	push   $0x803df1
+  801d43:	68 f8 3d 80 00       	push   $0x803df8
+  801d48:	68 1c 01 00 00       	push   $0x11c
+  801d4d:	68 e6 3d 80 00       	push   $0x803de6
+  801d52:	e8 df e5 ff ff       	call   800336 <_panic>
+  assert(r <= PGSIZE);
+  801d57:	68 0d 3e 80 00       	push   $0x803e0d
+  801d5c:	68 f8 3d 80 00       	push   $0x803df8
+  801d61:	68 1d 01 00 00       	push   $0x11d
+  801d66:	68 e6 3d 80 00       	push   $0x803de6
+  801d6b:	e8 c6 e5 ff ff       	call   800336 <_panic>
+
+00801d70 <devfile_write>:
+{
+  801d70:	55                   	push   %ebp
+  801d71:	89 e5                	mov    %esp,%ebp
+  801d73:	57                   	push   %edi
+  801d74:	56                   	push   %esi
+  801d75:	53                   	push   %ebx
+  801d76:	83 ec 1c             	sub    $0x1c,%esp
+  801d79:	8b 75 08             	mov    0x8(%ebp),%esi
+  801d7c:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  801d7f:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  801d84:	77 39                	ja     801dbf <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801d86:	8b 56 0c             	mov    0xc(%esi),%edx
+  801d89:	89 15 00 60 80 00    	mov    %edx,0x806000
+  fsipcbuf.write.req_n = n;
+  801d8f:	a3 04 60 80 00       	mov    %eax,0x806004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  801d94:	83 ec 04             	sub    $0x4,%esp
+  801d97:	50                   	push   %eax
+  801d98:	ff 75 0c             	push   0xc(%ebp)
+  801d9b:	68 08 60 80 00       	push   $0x806008
+  801da0:	e8 e0 ed ff ff       	call   800b85 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801da5:	ba 00 00 00 00       	mov    $0x0,%edx
+  801daa:	b8 04 00 00 00       	mov    $0x4,%eax
+  801daf:	e8 e7 fb ff ff       	call   80199b <fsipc>
+  801db4:	83 c4 10             	add    $0x10,%esp
+}
+  801db7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801dba:	5b                   	pop    %ebx
+  801dbb:	5e                   	pop    %esi
+  801dbc:	5f                   	pop    %edi
+  801dbd:	5d                   	pop    %ebp
+  801dbe:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  801dbf:	ba 00 00 10 00       	mov    $0x100000,%edx
+  801dc4:	39 d0                	cmp    %edx,%eax
+  801dc6:	89 d3                	mov    %edx,%ebx
+  801dc8:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  801dcb:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  801dd1:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  801dd4:	83 c7 01             	add    $0x1,%edi
+  801dd7:	89 f8                	mov    %edi,%eax
+  801dd9:	e8 94 fc ff ff       	call   801a72 <fsv_alloc>
+  801dde:	85 c0                	test   %eax,%eax
+  801de0:	78 d5                	js     801db7 <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  801de2:	83 ec 04             	sub    $0x4,%esp
+  801de5:	53                   	push   %ebx
+  801de6:	ff 75 0c             	push   0xc(%ebp)
+  801de9:	68 00 10 c0 9f       	push   $0x9fc01000
+  801dee:	e8 92 ed ff ff       	call   800b85 <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  801df3:	8b 46 0c             	mov    0xc(%esi),%eax
+  801df6:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  801dfb:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  801e01:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801e08:	89 f9                	mov    %edi,%ecx
+  801e0a:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801e0f:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801e14:	e8 69 fa ff ff       	call   801882 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801e19:	6a 00                	push   $0x0
+  801e1b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801e1e:	50                   	push   %eax
+  801e1f:	6a 00                	push   $0x0
+  801e21:	6a 00                	push   $0x0
+  801e23:	e8 be 16 00 00       	call   8034e6 <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  801e28:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  801e2b:	eb 8a                	jmp    801db7 <devfile_write+0x47>
+
+00801e2d <open>:
+{
+  801e2d:	55                   	push   %ebp
+  801e2e:	89 e5                	mov    %esp,%ebp
+  801e30:	56                   	push   %esi
+  801e31:	53                   	push   %ebx
+  801e32:	83 ec 1c             	sub    $0x1c,%esp
+  801e35:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801e38:	56                   	push   %esi
+  801e39:	e8 86 eb ff ff       	call   8009c4 <strlen>
+  801e3e:	83 c4 10             	add    $0x10,%esp
+  801e41:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801e46:	7f 6c                	jg     801eb4 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  801e48:	83 ec 0c             	sub    $0xc,%esp
+  801e4b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e4e:	50                   	push   %eax
+  801e4f:	e8 ad f4 ff ff       	call   801301 <fd_alloc>
+  801e54:	89 c3                	mov    %eax,%ebx
+  801e56:	83 c4 10             	add    $0x10,%esp
+  801e59:	85 c0                	test   %eax,%eax
+  801e5b:	78 3c                	js     801e99 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801e5d:	83 ec 08             	sub    $0x8,%esp
+  801e60:	56                   	push   %esi
+  801e61:	68 00 60 80 00       	push   $0x806000
+  801e66:	e8 94 eb ff ff       	call   8009ff <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801e6b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e6e:	a3 00 64 80 00       	mov    %eax,0x806400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801e73:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801e76:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e7b:	e8 1b fb ff ff       	call   80199b <fsipc>
+  801e80:	89 c3                	mov    %eax,%ebx
+  801e82:	83 c4 10             	add    $0x10,%esp
+  801e85:	85 c0                	test   %eax,%eax
+  801e87:	78 19                	js     801ea2 <open+0x75>
+  return fd2num(fd);
+  801e89:	83 ec 0c             	sub    $0xc,%esp
+  801e8c:	ff 75 f4             	push   -0xc(%ebp)
+  801e8f:	e8 49 f4 ff ff       	call   8012dd <fd2num>
+  801e94:	89 c3                	mov    %eax,%ebx
+  801e96:	83 c4 10             	add    $0x10,%esp
+}
+  801e99:	89 d8                	mov    %ebx,%eax
+  801e9b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e9e:	5b                   	pop    %ebx
+  801e9f:	5e                   	pop    %esi
+  801ea0:	5d                   	pop    %ebp
+  801ea1:	c3                   	ret
+    fd_close(fd, 0);
+  801ea2:	83 ec 08             	sub    $0x8,%esp
+  801ea5:	6a 00                	push   $0x0
+  801ea7:	ff 75 f4             	push   -0xc(%ebp)
+  801eaa:	e8 44 f5 ff ff       	call   8013f3 <fd_close>
+    return r;
+  801eaf:	83 c4 10             	add    $0x10,%esp
+  801eb2:	eb e5                	jmp    801e99 <open+0x6c>
+    return -E_BAD_PATH;
+  801eb4:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801eb9:	eb de                	jmp    801e99 <open+0x6c>
+
+00801ebb <open_read>:
+{
+  801ebb:	55                   	push   %ebp
+  801ebc:	89 e5                	mov    %esp,%ebp
+  801ebe:	57                   	push   %edi
+  801ebf:	56                   	push   %esi
+  801ec0:	53                   	push   %ebx
+  801ec1:	83 ec 28             	sub    $0x28,%esp
+  801ec4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  801ec7:	57                   	push   %edi
+  801ec8:	e8 f7 ea ff ff       	call   8009c4 <strlen>
+  801ecd:	83 c4 10             	add    $0x10,%esp
+  801ed0:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801ed5:	0f 87 f6 00 00 00    	ja     801fd1 <open_read+0x116>
+  801edb:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  801edd:	83 ec 0c             	sub    $0xc,%esp
+  801ee0:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801ee3:	50                   	push   %eax
+  801ee4:	e8 18 f4 ff ff       	call   801301 <fd_alloc>
+  801ee9:	89 c3                	mov    %eax,%ebx
+  801eeb:	83 c4 10             	add    $0x10,%esp
+  801eee:	85 c0                	test   %eax,%eax
+  801ef0:	0f 88 b2 00 00 00    	js     801fa8 <open_read+0xed>
+  strcpy(req->req_buf, path);
+  801ef6:	83 ec 08             	sub    $0x8,%esp
+  801ef9:	57                   	push   %edi
+  801efa:	68 e4 60 80 00       	push   $0x8060e4
+  801eff:	e8 fb ea ff ff       	call   8009ff <strcpy>
+  req->req_nops = 2;
+  801f04:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  801f0b:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  801f0e:	c7 05 04 60 80 00 01 	movl   $0x1,0x806004
+  801f15:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  801f18:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f1b:	a3 10 60 80 00       	mov    %eax,0x806010
+  req->req_ops[0].op_buf = 0;
+  801f20:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  801f27:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  801f2a:	c7 05 20 60 80 00 04 	movl   $0x4,0x806020
+  801f31:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  801f34:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  801f3b:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  801f3e:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  801f43:	29 f0                	sub    %esi,%eax
+  801f45:	3b 45 14             	cmp    0x14(%ebp),%eax
+  801f48:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  801f4c:	a3 2c 60 80 00       	mov    %eax,0x80602c
+  req->req_ops[1].op_offset = 0;
+  801f51:	c7 05 30 60 80 00 00 	movl   $0x0,0x806030
+  801f58:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  801f5b:	83 c6 01             	add    $0x1,%esi
+  801f5e:	89 35 34 60 80 00    	mov    %esi,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  801f64:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801f67:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801f6c:	e8 2a fa ff ff       	call   80199b <fsipc>
+  801f71:	89 c3                	mov    %eax,%ebx
+  801f73:	83 c4 10             	add    $0x10,%esp
+  801f76:	83 f8 01             	cmp    $0x1,%eax
+  801f79:	7e 37                	jle    801fb2 <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  801f7b:	a1 38 60 80 00       	mov    0x806038,%eax
+  801f80:	8b 55 18             	mov    0x18(%ebp),%edx
+  801f83:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  801f85:	83 ec 04             	sub    $0x4,%esp
+  801f88:	50                   	push   %eax
+  801f89:	81 c6 e4 60 80 00    	add    $0x8060e4,%esi
+  801f8f:	56                   	push   %esi
+  801f90:	ff 75 10             	push   0x10(%ebp)
+  801f93:	e8 ed eb ff ff       	call   800b85 <memmove>
+  return fd2num(fd);
+  801f98:	83 c4 04             	add    $0x4,%esp
+  801f9b:	ff 75 e4             	push   -0x1c(%ebp)
+  801f9e:	e8 3a f3 ff ff       	call   8012dd <fd2num>
+  801fa3:	89 c3                	mov    %eax,%ebx
+  801fa5:	83 c4 10             	add    $0x10,%esp
+}
+  801fa8:	89 d8                	mov    %ebx,%eax
+  801faa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fad:	5b                   	pop    %ebx
+  801fae:	5e                   	pop    %esi
+  801faf:	5f                   	pop    %edi
+  801fb0:	5d                   	pop    %ebp
+  801fb1:	c3                   	ret
+    fd_close(fd, 0);
+  801fb2:	83 ec 08             	sub    $0x8,%esp
+  801fb5:	6a 00                	push   $0x0
+  801fb7:	ff 75 e4             	push   -0x1c(%ebp)
+  801fba:	e8 34 f4 ff ff       	call   8013f3 <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  801fbf:	83 c4 10             	add    $0x10,%esp
+  801fc2:	85 db                	test   %ebx,%ebx
+  801fc4:	78 e2                	js     801fa8 <open_read+0xed>
+  801fc6:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  801fc9:	8b 9b 1c 60 80 00    	mov    0x80601c(%ebx),%ebx
+  801fcf:	eb d7                	jmp    801fa8 <open_read+0xed>
+    return -E_BAD_PATH;
+  801fd1:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801fd6:	eb d0                	jmp    801fa8 <open_read+0xed>
+
+00801fd8 <file_stat>:
+{
+  801fd8:	55                   	push   %ebp
+  801fd9:	89 e5                	mov    %esp,%ebp
+  801fdb:	57                   	push   %edi
+  801fdc:	56                   	push   %esi
+  801fdd:	53                   	push   %ebx
+  801fde:	83 ec 18             	sub    $0x18,%esp
+  801fe1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801fe4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801fe7:	57                   	push   %edi
+  801fe8:	e8 d7 e9 ff ff       	call   8009c4 <strlen>
+  801fed:	83 c4 10             	add    $0x10,%esp
+  801ff0:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801ff5:	0f 8f c7 00 00 00    	jg     8020c2 <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  801ffb:	83 ec 0c             	sub    $0xc,%esp
+  801ffe:	57                   	push   %edi
+  801fff:	e8 c0 e9 ff ff       	call   8009c4 <strlen>
+  802004:	8d 58 04             	lea    0x4(%eax),%ebx
+  802007:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  80200a:	83 c4 08             	add    $0x8,%esp
+  80200d:	57                   	push   %edi
+  80200e:	68 e4 60 80 00       	push   $0x8060e4
+  802013:	e8 e7 e9 ff ff       	call   8009ff <strcpy>
+  req->req_nops = 2;
+  802018:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  80201f:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  802022:	c7 05 04 60 80 00 02 	movl   $0x2,0x806004
+  802029:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  80202c:	c7 05 10 60 80 00 00 	movl   $0x0,0x806010
+  802033:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  802036:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  80203d:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  802040:	c7 05 20 60 80 00 03 	movl   $0x3,0x806020
+  802047:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  80204a:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  802051:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  802054:	89 1d 34 60 80 00    	mov    %ebx,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  80205a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80205f:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802064:	e8 32 f9 ff ff       	call   80199b <fsipc>
+  802069:	83 c4 10             	add    $0x10,%esp
+  80206c:	83 f8 01             	cmp    $0x1,%eax
+  80206f:	7e 42                	jle    8020b3 <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  802071:	81 c3 e4 60 80 00    	add    $0x8060e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  802077:	83 ec 08             	sub    $0x8,%esp
+  80207a:	53                   	push   %ebx
+  80207b:	56                   	push   %esi
+  80207c:	e8 7e e9 ff ff       	call   8009ff <strcpy>
+  st->st_size = ret->ret_size;
+  802081:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  802087:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  80208d:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  802093:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  802099:	c7 86 88 00 00 00 04 	movl   $0x804004,0x88(%esi)
+  8020a0:	40 80 00 
+  return 0;
+  8020a3:	83 c4 10             	add    $0x10,%esp
+  8020a6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020ab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020ae:	5b                   	pop    %ebx
+  8020af:	5e                   	pop    %esi
+  8020b0:	5f                   	pop    %edi
+  8020b1:	5d                   	pop    %ebp
+  8020b2:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  8020b3:	85 c0                	test   %eax,%eax
+  8020b5:	78 f4                	js     8020ab <file_stat+0xd3>
+  8020b7:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8020ba:	8b 80 1c 60 80 00    	mov    0x80601c(%eax),%eax
+  8020c0:	eb e9                	jmp    8020ab <file_stat+0xd3>
+    return -E_BAD_PATH;
+  8020c2:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8020c7:	eb e2                	jmp    8020ab <file_stat+0xd3>
+
+008020c9 <read_map>:
+{
+  8020c9:	55                   	push   %ebp
+  8020ca:	89 e5                	mov    %esp,%ebp
+  8020cc:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8020cf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020d2:	50                   	push   %eax
+  8020d3:	ff 75 08             	push   0x8(%ebp)
+  8020d6:	e8 7c f2 ff ff       	call   801357 <fd_lookup>
+  8020db:	83 c4 10             	add    $0x10,%esp
+  8020de:	85 c0                	test   %eax,%eax
+  8020e0:	78 2a                	js     80210c <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  8020e2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020e5:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  8020eb:	39 08                	cmp    %ecx,(%eax)
+  8020ed:	75 1f                	jne    80210e <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  8020ef:	8b 40 0c             	mov    0xc(%eax),%eax
+  8020f2:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read_map.req_offset = offset;
+  8020f7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020fa:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  8020ff:	8b 55 10             	mov    0x10(%ebp),%edx
+  802102:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802107:	e8 8f f8 ff ff       	call   80199b <fsipc>
+}
+  80210c:	c9                   	leave
+  80210d:	c3                   	ret
+    return -E_INVAL;
+  80210e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802113:	eb f7                	jmp    80210c <read_map+0x43>
+
+00802115 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802115:	55                   	push   %ebp
+  802116:	89 e5                	mov    %esp,%ebp
+  802118:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  80211b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802120:	b8 08 00 00 00       	mov    $0x8,%eax
+  802125:	e8 71 f8 ff ff       	call   80199b <fsipc>
+}
+  80212a:	c9                   	leave
+  80212b:	c3                   	ret
+
+0080212c <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  80212c:	55                   	push   %ebp
+  80212d:	89 e5                	mov    %esp,%ebp
+  80212f:	57                   	push   %edi
+  802130:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  802131:	8b 45 08             	mov    0x8(%ebp),%eax
+  802134:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.stats.req_bio_sched = 0;
+  802139:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  802140:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  802143:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  80214a:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  80214d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802152:	b8 09 00 00 00       	mov    $0x9,%eax
+  802157:	e8 3f f8 ff ff       	call   80199b <fsipc>
+  80215c:	85 c0                	test   %eax,%eax
+  80215e:	78 14                	js     802174 <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  802160:	be 00 60 80 00       	mov    $0x806000,%esi
+  802165:	b9 16 00 00 00       	mov    $0x16,%ecx
+  80216a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80216d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  80216f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802174:	5e                   	pop    %esi
+  802175:	5f                   	pop    %edi
+  802176:	5d                   	pop    %ebp
+  802177:	c3                   	ret
+
+00802178 <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  802178:	55                   	push   %ebp
+  802179:	89 e5                	mov    %esp,%ebp
+  80217b:	53                   	push   %ebx
+  80217c:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  80217f:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802182:	50                   	push   %eax
+  802183:	6a 00                	push   $0x0
+  802185:	e8 a2 ff ff ff       	call   80212c <fs_stats>
+  80218a:	83 c4 10             	add    $0x10,%esp
+  80218d:	85 c0                	test   %eax,%eax
+  80218f:	78 28                	js     8021b9 <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  802191:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  802194:	83 ec 08             	sub    $0x8,%esp
+  802197:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  80219a:	50                   	push   %eax
+  80219b:	6a 20                	push   $0x20
+  80219d:	e8 8a ff ff ff       	call   80212c <fs_stats>
+  8021a2:	83 c4 10             	add    $0x10,%esp
+  8021a5:	85 c0                	test   %eax,%eax
+  8021a7:	78 10                	js     8021b9 <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  8021a9:	83 ec 08             	sub    $0x8,%esp
+  8021ac:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8021af:	50                   	push   %eax
+  8021b0:	53                   	push   %ebx
+  8021b1:	e8 76 ff ff ff       	call   80212c <fs_stats>
+  8021b6:	83 c4 10             	add    $0x10,%esp
+}
+  8021b9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021bc:	c9                   	leave
+  8021bd:	c3                   	ret
+
+008021be <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  8021be:	55                   	push   %ebp
+  8021bf:	89 e5                	mov    %esp,%ebp
+  8021c1:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  8021c4:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  8021cb:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  8021ce:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021d1:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.stats.req_dcache = 0;
+  8021d6:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  8021dd:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  8021e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021e5:	b8 09 00 00 00       	mov    $0x9,%eax
+  8021ea:	e8 ac f7 ff ff       	call   80199b <fsipc>
+}
+  8021ef:	c9                   	leave
+  8021f0:	c3                   	ret
+
+008021f1 <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  8021f1:	55                   	push   %ebp
+  8021f2:	89 e5                	mov    %esp,%ebp
+  8021f4:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  8021f7:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  8021fe:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  802201:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  802208:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  80220b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80220e:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_STATS, NULL);
+  802213:	ba 00 00 00 00       	mov    $0x0,%edx
+  802218:	b8 09 00 00 00       	mov    $0x9,%eax
+  80221d:	e8 79 f7 ff ff       	call   80199b <fsipc>
+}
+  802222:	c9                   	leave
+  802223:	c3                   	ret
+
+00802224 <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  802224:	55                   	push   %ebp
+  802225:	89 e5                	mov    %esp,%ebp
+  802227:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80222a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80222d:	50                   	push   %eax
+  80222e:	ff 75 08             	push   0x8(%ebp)
+  802231:	e8 21 f1 ff ff       	call   801357 <fd_lookup>
+  802236:	83 c4 10             	add    $0x10,%esp
+  802239:	85 c0                	test   %eax,%eax
+  80223b:	78 34                	js     802271 <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  80223d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802240:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  802246:	39 08                	cmp    %ecx,(%eax)
+  802248:	75 29                	jne    802273 <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  80224a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80224d:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.fallocate.req_offset = offset;
+  802252:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802255:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.fallocate.req_len = len;
+  80225a:	8b 45 10             	mov    0x10(%ebp),%eax
+  80225d:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  802262:	ba 00 00 00 00       	mov    $0x0,%edx
+  802267:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80226c:	e8 2a f7 ff ff       	call   80199b <fsipc>
+}
+  802271:	c9                   	leave
+  802272:	c3                   	ret
+    return -E_INVAL;
+  802273:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802278:	eb f7                	jmp    802271 <fallocate+0x4d>
+
+0080227a <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  80227a:	55                   	push   %ebp
+  80227b:	89 e5                	mov    %esp,%ebp
+  80227d:	57                   	push   %edi
+  80227e:	56                   	push   %esi
+  80227f:	53                   	push   %ebx
+  802280:	83 ec 24             	sub    $0x24,%esp
+  802283:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802286:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802289:	50                   	push   %eax
+  80228a:	ff 75 08             	push   0x8(%ebp)
+  80228d:	e8 c5 f0 ff ff       	call   801357 <fd_lookup>
+  802292:	83 c4 10             	add    $0x10,%esp
+  802295:	85 c0                	test   %eax,%eax
+  802297:	78 66                	js     8022ff <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  802299:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80229c:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  8022a2:	39 08                	cmp    %ecx,(%eax)
+  8022a4:	75 61                	jne    802307 <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  8022a6:	85 f6                	test   %esi,%esi
+  8022a8:	7e 50                	jle    8022fa <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  8022aa:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  8022af:	39 de                	cmp    %ebx,%esi
+  8022b1:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  8022b4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8022b7:	8b 40 0c             	mov    0xc(%eax),%eax
+  8022ba:	a3 00 60 80 00       	mov    %eax,0x806000
+    fsipcbuf.prefetch.req_n = m;
+  8022bf:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  8022c5:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  8022cc:	83 ec 04             	sub    $0x4,%esp
+  8022cf:	57                   	push   %edi
+  8022d0:	ff 75 0c             	push   0xc(%ebp)
+  8022d3:	68 08 60 80 00       	push   $0x806008
+  8022d8:	e8 a8 e8 ff ff       	call   800b85 <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  8022dd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022e2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8022e7:	e8 af f6 ff ff       	call   80199b <fsipc>
+  8022ec:	83 c4 10             	add    $0x10,%esp
+  8022ef:	85 c0                	test   %eax,%eax
+  8022f1:	78 0c                	js     8022ff <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  8022f3:	01 7d 0c             	add    %edi,0xc(%ebp)
+  8022f6:	29 de                	sub    %ebx,%esi
+  8022f8:	eb ac                	jmp    8022a6 <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  8022fa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802302:	5b                   	pop    %ebx
+  802303:	5e                   	pop    %esi
+  802304:	5f                   	pop    %edi
+  802305:	5d                   	pop    %ebp
+  802306:	c3                   	ret
+    return -E_INVAL;
+  802307:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80230c:	eb f1                	jmp    8022ff <prefetch+0x85>
+
+0080230e <spawn>:
+// argv: pointer to null-terminated array of pointers to strings,
+//   which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv)
+{
+  80230e:	55                   	push   %ebp
+  80230f:	89 e5                	mov    %esp,%ebp
+  802311:	57                   	push   %edi
+  802312:	56                   	push   %esi
+  802313:	53                   	push   %ebx
+  802314:	81 ec a8 02 00 00    	sub    $0x2a8,%esp
+  //     correct initial eip and esp values in the child.
+  //
+  //   - Start the child process running with sys_env_set_status().
+
+  // Open the program and read its ELF header in one round trip.
+  if ((r = open_read(prog, O_RDONLY, elf_buf, sizeof(elf_buf), &n)) < 0)
+  80231a:	8d 85 a0 fd ff ff    	lea    -0x260(%ebp),%eax
+  802320:	50                   	push   %eax
+  802321:	68 00 02 00 00       	push   $0x200
+  802326:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  80232c:	50                   	push   %eax
+  80232d:	6a 00                	push   $0x0
+  80232f:	ff 75 08             	push   0x8(%ebp)
+  802332:	e8 84 fb ff ff       	call   801ebb <open_read>
+  802337:	89 85 88 fd ff ff    	mov    %eax,-0x278(%ebp)
+  80233d:	83 c4 20             	add    $0x20,%esp
+  802340:	85 c0                	test   %eax,%eax
+  802342:	0f 88 66 06 00 00    	js     8029ae <spawn+0x6a0>
+    return r;
+  fd = r;
+
+  elf = (struct Elf*)elf_buf;
+  if (n != sizeof(elf_buf) || elf->e_magic != ELF_MAGIC) {
+  802348:	81 bd a0 fd ff ff 00 	cmpl   $0x200,-0x260(%ebp)
+  80234f:	02 00 00 
+  802352:	0f 85 92 00 00 00    	jne    8023ea <spawn+0xdc>
+  802358:	81 bd e8 fd ff ff 7f 	cmpl   $0x464c457f,-0x218(%ebp)
+  80235f:	45 4c 46 
+  802362:	0f 85 82 00 00 00    	jne    8023ea <spawn+0xdc>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+  envid_t ret;
+  __asm __volatile("int %2"
+  802368:	b8 07 00 00 00       	mov    $0x7,%eax
+  80236d:	cd 30                	int    $0x30
+  80236f:	89 85 90 fd ff ff    	mov    %eax,-0x270(%ebp)
+  802375:	89 c6                	mov    %eax,%esi
+  802377:	89 85 6c fd ff ff    	mov    %eax,-0x294(%ebp)
+    cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+    return -E_NOT_EXEC;
+  }
+
+  // Create new child environment
+  if ((r = sys_exofork()) < 0)
+  80237d:	85 c0                	test   %eax,%eax
+  80237f:	0f 88 35 06 00 00    	js     8029ba <spawn+0x6ac>
+    return r;
+  child = r;
+  sysbatch_init(&batch);
+  802385:	83 ec 0c             	sub    $0xc,%esp
+  802388:	68 60 57 80 00       	push   $0x805760
+  80238d:	e8 91 ee ff ff       	call   801223 <sysbatch_init>
+
+  // Set up trap frame, including initial stack.
+  child_tf = envs[ENVX(child)].env_tf;
+  802392:	89 f0                	mov    %esi,%eax
+  802394:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802399:	8d 34 c0             	lea    (%eax,%eax,8),%esi
+  80239c:	c1 e6 04             	shl    $0x4,%esi
+  80239f:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  8023a5:	8d bd a4 fd ff ff    	lea    -0x25c(%ebp),%edi
+  8023ab:	b9 11 00 00 00       	mov    $0x11,%ecx
+  8023b0:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  child_tf.tf_eip = elf->e_entry;
+  8023b2:	8b 85 00 fe ff ff    	mov    -0x200(%ebp),%eax
+  8023b8:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  uintptr_t *argv_store;
+
+  // Count the number of arguments (argc)
+  // and the total amount of space needed for strings (string_size).
+  string_size = 0;
+  for (argc = 0; argv[argc] != 0; argc++)
+  8023be:	83 c4 10             	add    $0x10,%esp
+  8023c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  string_size = 0;
+  8023c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8023cb:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  for (argc = 0; argv[argc] != 0; argc++)
+  8023ce:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+  8023d1:	85 c0                	test   %eax,%eax
+  8023d3:	74 4d                	je     802422 <spawn+0x114>
+    string_size += strlen(argv[argc]) + 1;
+  8023d5:	83 ec 0c             	sub    $0xc,%esp
+  8023d8:	50                   	push   %eax
+  8023d9:	e8 e6 e5 ff ff       	call   8009c4 <strlen>
+  8023de:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+  for (argc = 0; argv[argc] != 0; argc++)
+  8023e2:	83 c3 01             	add    $0x1,%ebx
+  8023e5:	83 c4 10             	add    $0x10,%esp
+  8023e8:	eb e4                	jmp    8023ce <spawn+0xc0>
+    close(fd);
+  8023ea:	83 ec 0c             	sub    $0xc,%esp
+  8023ed:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  8023f3:	e8 82 f0 ff ff       	call   80147a <close>
+    cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  8023f8:	83 c4 0c             	add    $0xc,%esp
+  8023fb:	68 7f 45 4c 46       	push   $0x464c457f
+  802400:	ff b5 e8 fd ff ff    	push   -0x218(%ebp)
+  802406:	68 48 3e 80 00       	push   $0x803e48
+  80240b:	e8 01 e0 ff ff       	call   800411 <cprintf>
+    return -E_NOT_EXEC;
+  802410:	83 c4 10             	add    $0x10,%esp
+  802413:	c7 85 6c fd ff ff f2 	movl   $0xfffffff2,-0x294(%ebp)
+  80241a:	ff ff ff 
+  80241d:	e9 98 05 00 00       	jmp    8029ba <spawn+0x6ac>
+  // Determine where to place the strings and the argv array.
+  // Set up pointers into the temporary page 'UTEMP'; we'll map a page
+  // there later, then remap that page into the child environment
+  // at (USTACKTOP - PGSIZE).
+  // strings is the topmost thing on the stack.
+  string_store = (char*)UTEMP + PGSIZE - string_size;
+  802422:	89 9d 84 fd ff ff    	mov    %ebx,-0x27c(%ebp)
+  802428:	bf 00 10 40 00       	mov    $0x401000,%edi
+  80242d:	29 f7                	sub    %esi,%edi
+  // argv is below that.  There's one argument pointer per argument, plus
+  // a null pointer.
+  argv_store = (uintptr_t*)(ROUNDDOWN(string_store, 4) - 4 * (argc + 1));
+  80242f:	89 fa                	mov    %edi,%edx
+  802431:	83 e2 fc             	and    $0xfffffffc,%edx
+  802434:	8d 04 9d 04 00 00 00 	lea    0x4(,%ebx,4),%eax
+  80243b:	29 c2                	sub    %eax,%edx
+  80243d:	89 95 94 fd ff ff    	mov    %edx,-0x26c(%ebp)
+
+  // Make sure that argv, strings, and the 2 words that hold 'argc'
+  // and 'argv' themselves will all fit in a single stack page.
+  if ((void*)(argv_store - 2) < (void*)UTEMP)
+  802443:	8d 42 f8             	lea    -0x8(%edx),%eax
+  802446:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  80244b:	0f 86 a8 05 00 00    	jbe    8029f9 <spawn+0x6eb>
+    return -E_NO_MEM;
+
+  // Allocate the single stack page at UTEMP.
+  if ((r = sys_page_alloc(0, (void*)UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  802451:	83 ec 04             	sub    $0x4,%esp
+  802454:	6a 07                	push   $0x7
+  802456:	68 00 00 40 00       	push   $0x400000
+  80245b:	6a 00                	push   $0x0
+  80245d:	e8 cc e9 ff ff       	call   800e2e <sys_page_alloc>
+  802462:	83 c4 10             	add    $0x10,%esp
+  802465:	85 c0                	test   %eax,%eax
+  802467:	0f 88 91 05 00 00    	js     8029fe <spawn+0x6f0>
+  //	  (Again, argv should use an address valid in the child's
+  //	  environment.)
+  //
+  //	* Set *init_esp to the initial stack pointer for the child,
+  //	  (Again, use an address valid in the child's environment.)
+  for (i = 0; i < argc; i++) {
+  80246d:	be 00 00 00 00       	mov    $0x0,%esi
+  802472:	89 9d 8c fd ff ff    	mov    %ebx,-0x274(%ebp)
+  802478:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80247b:	eb 30                	jmp    8024ad <spawn+0x19f>
+    argv_store[i] = UTEMP2USTACK(string_store);
+  80247d:	8d 87 00 d0 7f ee    	lea    -0x11803000(%edi),%eax
+  802483:	8b 8d 94 fd ff ff    	mov    -0x26c(%ebp),%ecx
+  802489:	89 04 b1             	mov    %eax,(%ecx,%esi,4)
+    strcpy(string_store, argv[i]);
+  80248c:	83 ec 08             	sub    $0x8,%esp
+  80248f:	ff 34 b3             	push   (%ebx,%esi,4)
+  802492:	57                   	push   %edi
+  802493:	e8 67 e5 ff ff       	call   8009ff <strcpy>
+    string_store += strlen(argv[i]) + 1;
+  802498:	83 c4 04             	add    $0x4,%esp
+  80249b:	ff 34 b3             	push   (%ebx,%esi,4)
+  80249e:	e8 21 e5 ff ff       	call   8009c4 <strlen>
+  8024a3:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+  for (i = 0; i < argc; i++) {
+  8024a7:	83 c6 01             	add    $0x1,%esi
+  8024aa:	83 c4 10             	add    $0x10,%esp
+  8024ad:	39 b5 8c fd ff ff    	cmp    %esi,-0x274(%ebp)
+  8024b3:	7f c8                	jg     80247d <spawn+0x16f>
+  }
+  argv_store[argc] = 0;
+  8024b5:	8b 85 94 fd ff ff    	mov    -0x26c(%ebp),%eax
+  8024bb:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  8024c1:	c7 04 88 00 00 00 00 	movl   $0x0,(%eax,%ecx,4)
+  assert(string_store == (char*)UTEMP + PGSIZE);
+  8024c8:	81 ff 00 10 40 00    	cmp    $0x401000,%edi
+  8024ce:	0f 85 97 00 00 00    	jne    80256b <spawn+0x25d>
+
+  argv_store[-1] = UTEMP2USTACK(argv_store);
+  8024d4:	8b 8d 94 fd ff ff    	mov    -0x26c(%ebp),%ecx
+  8024da:	8d 81 00 d0 7f ee    	lea    -0x11803000(%ecx),%eax
+  8024e0:	89 41 fc             	mov    %eax,-0x4(%ecx)
+  argv_store[-2] = argc;
+  8024e3:	89 c8                	mov    %ecx,%eax
+  8024e5:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  8024eb:	89 48 f8             	mov    %ecx,-0x8(%eax)
+
+  *init_esp = UTEMP2USTACK(&argv_store[-2]);
+  8024ee:	2d 08 30 80 11       	sub    $0x11803008,%eax
+  8024f3:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+
+  // After completing the stack, map it into the child's address space
+  // and unmap it from ours!  Both calls ride along with the first batch
+  // of segment mappings.
+  if ((r = sysbatch_add(&batch, SYS_page_map, 0, (uint32_t) UTEMP, child,
+  8024f9:	83 ec 04             	sub    $0x4,%esp
+  8024fc:	6a 07                	push   $0x7
+  8024fe:	68 00 d0 bf ee       	push   $0xeebfd000
+  802503:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  802509:	68 00 00 40 00       	push   $0x400000
+  80250e:	6a 00                	push   $0x0
+  802510:	6a 05                	push   $0x5
+  802512:	68 60 57 80 00       	push   $0x805760
+  802517:	e8 65 ed ff ff       	call   801281 <sysbatch_add>
+  80251c:	89 c3                	mov    %eax,%ebx
+  80251e:	83 c4 20             	add    $0x20,%esp
+  802521:	85 c0                	test   %eax,%eax
+  802523:	0f 88 dd 04 00 00    	js     802a06 <spawn+0x6f8>
+                        USTACKTOP - PGSIZE, PTE_P | PTE_U | PTE_W)) < 0)
+    goto error;
+  if ((r = sysbatch_add(&batch, SYS_page_unmap, 0, (uint32_t) UTEMP,
+  802529:	83 ec 04             	sub    $0x4,%esp
+  80252c:	6a 00                	push   $0x0
+  80252e:	6a 00                	push   $0x0
+  802530:	6a 00                	push   $0x0
+  802532:	68 00 00 40 00       	push   $0x400000
+  802537:	6a 00                	push   $0x0
+  802539:	6a 06                	push   $0x6
+  80253b:	68 60 57 80 00       	push   $0x805760
+  802540:	e8 3c ed ff ff       	call   801281 <sysbatch_add>
+  802545:	89 c3                	mov    %eax,%ebx
+  802547:	83 c4 20             	add    $0x20,%esp
+  80254a:	85 c0                	test   %eax,%eax
+  80254c:	0f 88 b4 04 00 00    	js     802a06 <spawn+0x6f8>
+  ph = (struct Proghdr*)(elf_buf + elf->e_phoff);
+  802552:	8b 85 04 fe ff ff    	mov    -0x1fc(%ebp),%eax
+  802558:	8d bc 05 e8 fd ff ff 	lea    -0x218(%ebp,%eax,1),%edi
+  for (i = 0; i < elf->e_phnum; i++, ph++) {
+  80255f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802564:	89 d6                	mov    %edx,%esi
+  802566:	e9 dd 01 00 00       	jmp    802748 <spawn+0x43a>
+  assert(string_store == (char*)UTEMP + PGSIZE);
+  80256b:	68 c0 3e 80 00       	push   $0x803ec0
+  802570:	68 f8 3d 80 00       	push   $0x803df8
+  802575:	68 01 01 00 00       	push   $0x101
+  80257a:	68 62 3e 80 00       	push   $0x803e62
+  80257f:	e8 b2 dd ff ff       	call   800336 <_panic>
+
+  for (i = 0; i < memsz; i += n * PGSIZE) {
+    if (i >= filesz) {
+      // allocate a blank page
+      n = 1;
+      if ((r = sysbatch_add(&batch, SYS_page_alloc, child, va + i,
+  802584:	83 ec 04             	sub    $0x4,%esp
+  802587:	6a 00                	push   $0x0
+  802589:	6a 00                	push   $0x0
+  80258b:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  802591:	8b 85 78 fd ff ff    	mov    -0x288(%ebp),%eax
+  802597:	8b 8d 70 fd ff ff    	mov    -0x290(%ebp),%ecx
+  80259d:	01 c8                	add    %ecx,%eax
+  80259f:	50                   	push   %eax
+  8025a0:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  8025a6:	6a 04                	push   $0x4
+  8025a8:	68 60 57 80 00       	push   $0x805760
+  8025ad:	e8 cf ec ff ff       	call   801281 <sysbatch_add>
+  8025b2:	83 c4 20             	add    $0x20,%esp
+  8025b5:	85 c0                	test   %eax,%eax
+  8025b7:	0f 88 0b 04 00 00    	js     8029c8 <spawn+0x6ba>
+      n = 1;
+  8025bd:	bf 01 00 00 00       	mov    $0x1,%edi
+  for (i = 0; i < memsz; i += n * PGSIZE) {
+  8025c2:	89 f8                	mov    %edi,%eax
+  8025c4:	c1 e0 0c             	shl    $0xc,%eax
+  8025c7:	01 85 84 fd ff ff    	add    %eax,-0x27c(%ebp)
+  8025cd:	e9 fc 01 00 00       	jmp    8027ce <spawn+0x4c0>
+  8025d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8025d7:	eb 0e                	jmp    8025e7 <spawn+0x2d9>
+  8025d9:	8b bd 60 fd ff ff    	mov    -0x2a0(%ebp),%edi
+  8025df:	e9 c1 00 00 00       	jmp    8026a5 <spawn+0x397>
+          return r;
+        if (r < MIN(PGSIZE, filesz - i - j * PGSIZE))
+          return -E_INVAL;
+      }
+    } else {
+      for (j = 0; j < n; j++)
+  8025e4:	83 c3 01             	add    $0x1,%ebx
+  8025e7:	39 df                	cmp    %ebx,%edi
+  8025e9:	7e 55                	jle    802640 <spawn+0x332>
+        if ((r = sysbatch_add(&batch, SYS_page_alloc, 0,
+  8025eb:	83 ec 04             	sub    $0x4,%esp
+  8025ee:	6a 00                	push   $0x0
+  8025f0:	6a 00                	push   $0x0
+  8025f2:	6a 07                	push   $0x7
+  8025f4:	89 d8                	mov    %ebx,%eax
+  8025f6:	c1 e0 0c             	shl    $0xc,%eax
+  8025f9:	05 00 10 40 00       	add    $0x401000,%eax
+  8025fe:	50                   	push   %eax
+  8025ff:	6a 00                	push   $0x0
+  802601:	6a 04                	push   $0x4
+  802603:	68 60 57 80 00       	push   $0x805760
+  802608:	e8 74 ec ff ff       	call   801281 <sysbatch_add>
+  80260d:	83 c4 20             	add    $0x20,%esp
+  802610:	85 c0                	test   %eax,%eax
+  802612:	79 d0                	jns    8025e4 <spawn+0x2d6>
+  802614:	89 c6                	mov    %eax,%esi
+  sys_env_destroy(child);
+  802616:	83 ec 0c             	sub    $0xc,%esp
+  802619:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  80261f:	e8 48 e7 ff ff       	call   800d6c <sys_env_destroy>
+  close(fd);
+  802624:	83 c4 04             	add    $0x4,%esp
+  802627:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  80262d:	e8 48 ee ff ff       	call   80147a <close>
+  return r;
+  802632:	83 c4 10             	add    $0x10,%esp
+  802635:	89 b5 6c fd ff ff    	mov    %esi,-0x294(%ebp)
+  80263b:	e9 7a 03 00 00       	jmp    8029ba <spawn+0x6ac>
+                              (uint32_t) UTEMP2 + j * PGSIZE,
+                              PTE_P|PTE_U|PTE_W, 0, 0)) < 0)
+          return r;
+      if ((r = sysbatch_flush(&batch)) < 0)
+  802640:	83 ec 0c             	sub    $0xc,%esp
+  802643:	68 60 57 80 00       	push   $0x805760
+  802648:	e8 e4 eb ff ff       	call   801231 <sysbatch_flush>
+  80264d:	83 c4 10             	add    $0x10,%esp
+  802650:	85 c0                	test   %eax,%eax
+  802652:	0f 88 85 03 00 00    	js     8029dd <spawn+0x6cf>
+        return r;
+      if ((r = seek(fd, fileoffset + i)) < 0)
+  802658:	83 ec 08             	sub    $0x8,%esp
+  80265b:	8b 85 74 fd ff ff    	mov    -0x28c(%ebp),%eax
+  802661:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  802667:	01 c8                	add    %ecx,%eax
+  802669:	50                   	push   %eax
+  80266a:	8b 9d 88 fd ff ff    	mov    -0x278(%ebp),%ebx
+  802670:	53                   	push   %ebx
+  802671:	e8 dc f0 ff ff       	call   801752 <seek>
+  802676:	83 c4 10             	add    $0x10,%esp
+  802679:	85 c0                	test   %eax,%eax
+  80267b:	0f 88 63 03 00 00    	js     8029e4 <spawn+0x6d6>
+        return r;
+      if ((r = readn(fd, UTEMP2, MIN(n * PGSIZE, filesz - i))) < 0)
+  802681:	83 ec 04             	sub    $0x4,%esp
+  802684:	89 f8                	mov    %edi,%eax
+  802686:	c1 e0 0c             	shl    $0xc,%eax
+  802689:	39 f0                	cmp    %esi,%eax
+  80268b:	0f 47 c6             	cmova  %esi,%eax
+  80268e:	50                   	push   %eax
+  80268f:	68 00 10 40 00       	push   $0x401000
+  802694:	53                   	push   %ebx
+  802695:	e8 ef ef ff ff       	call   801689 <readn>
+  80269a:	83 c4 10             	add    $0x10,%esp
+  80269d:	85 c0                	test   %eax,%eax
+  80269f:	0f 88 46 03 00 00    	js     8029eb <spawn+0x6dd>
+        return r;
+    }
+    for (j = 0; j < n; j++) {
+  8026a5:	8d b7 01 04 00 00    	lea    0x401(%edi),%esi
+  8026ab:	c1 e6 0c             	shl    $0xc,%esi
+  8026ae:	bb 00 10 40 00       	mov    $0x401000,%ebx
+      if ((r = sysbatch_add(&batch, SYS_page_map, 0,
+  8026b3:	8b 85 70 fd ff ff    	mov    -0x290(%ebp),%eax
+  8026b9:	8b 8d 78 fd ff ff    	mov    -0x288(%ebp),%ecx
+  8026bf:	8d 84 08 00 f0 bf ff 	lea    -0x401000(%eax,%ecx,1),%eax
+  8026c6:	89 bd 80 fd ff ff    	mov    %edi,-0x280(%ebp)
+  8026cc:	89 c7                	mov    %eax,%edi
+    for (j = 0; j < n; j++) {
+  8026ce:	39 f3                	cmp    %esi,%ebx
+  8026d0:	74 59                	je     80272b <spawn+0x41d>
+      if ((r = sysbatch_add(&batch, SYS_page_map, 0,
+  8026d2:	83 ec 04             	sub    $0x4,%esp
+  8026d5:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  8026db:	8d 04 1f             	lea    (%edi,%ebx,1),%eax
+  8026de:	50                   	push   %eax
+  8026df:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  8026e5:	53                   	push   %ebx
+  8026e6:	6a 00                	push   $0x0
+  8026e8:	6a 05                	push   $0x5
+  8026ea:	68 60 57 80 00       	push   $0x805760
+  8026ef:	e8 8d eb ff ff       	call   801281 <sysbatch_add>
+  8026f4:	83 c4 20             	add    $0x20,%esp
+  8026f7:	85 c0                	test   %eax,%eax
+  8026f9:	0f 88 f3 02 00 00    	js     8029f2 <spawn+0x6e4>
+                            (uint32_t) UTEMP2 + j * PGSIZE, child,
+                            va + i + j * PGSIZE, perm)) < 0)
+        return r;
+      if ((r = sysbatch_add(&batch, SYS_page_unmap, 0,
+  8026ff:	83 ec 04             	sub    $0x4,%esp
+  802702:	6a 00                	push   $0x0
+  802704:	6a 00                	push   $0x0
+  802706:	6a 00                	push   $0x0
+  802708:	53                   	push   %ebx
+  802709:	6a 00                	push   $0x0
+  80270b:	6a 06                	push   $0x6
+  80270d:	68 60 57 80 00       	push   $0x805760
+  802712:	e8 6a eb ff ff       	call   801281 <sysbatch_add>
+  802717:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80271d:	83 c4 20             	add    $0x20,%esp
+  802720:	85 c0                	test   %eax,%eax
+  802722:	79 aa                	jns    8026ce <spawn+0x3c0>
+  802724:	89 c6                	mov    %eax,%esi
+  802726:	e9 eb fe ff ff       	jmp    802616 <spawn+0x308>
+  80272b:	8b bd 80 fd ff ff    	mov    -0x280(%ebp),%edi
+  802731:	e9 8c fe ff ff       	jmp    8025c2 <spawn+0x2b4>
+  802736:	8b b5 68 fd ff ff    	mov    -0x298(%ebp),%esi
+  80273c:	8b bd 64 fd ff ff    	mov    -0x29c(%ebp),%edi
+  for (i = 0; i < elf->e_phnum; i++, ph++) {
+  802742:	83 c6 01             	add    $0x1,%esi
+  802745:	83 c7 20             	add    $0x20,%edi
+  802748:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  80274f:	39 f0                	cmp    %esi,%eax
+  802751:	0f 8e 9b 01 00 00    	jle    8028f2 <spawn+0x5e4>
+    if (ph->p_type != ELF_PROG_LOAD)
+  802757:	83 3f 01             	cmpl   $0x1,(%edi)
+  80275a:	75 e6                	jne    802742 <spawn+0x434>
+    if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  80275c:	8b 47 18             	mov    0x18(%edi),%eax
+  80275f:	83 e0 02             	and    $0x2,%eax
+    perm = PTE_P | PTE_U;
+  802762:	83 f8 01             	cmp    $0x1,%eax
+  802765:	19 c0                	sbb    %eax,%eax
+  802767:	83 e0 fe             	and    $0xfffffffe,%eax
+  80276a:	83 c0 07             	add    $0x7,%eax
+  80276d:	89 85 94 fd ff ff    	mov    %eax,-0x26c(%ebp)
+    if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  802773:	8b 57 04             	mov    0x4(%edi),%edx
+  802776:	89 95 74 fd ff ff    	mov    %edx,-0x28c(%ebp)
+  80277c:	8b 5f 10             	mov    0x10(%edi),%ebx
+  80277f:	89 9d 8c fd ff ff    	mov    %ebx,-0x274(%ebp)
+  802785:	8b 47 14             	mov    0x14(%edi),%eax
+  802788:	89 85 7c fd ff ff    	mov    %eax,-0x284(%ebp)
+  80278e:	8b 4f 08             	mov    0x8(%edi),%ecx
+  if ((i = PGOFF(va))) {
+  802791:	89 c8                	mov    %ecx,%eax
+  802793:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802798:	74 18                	je     8027b2 <spawn+0x4a4>
+    va -= i;
+  80279a:	29 c1                	sub    %eax,%ecx
+    memsz += i;
+  80279c:	01 85 7c fd ff ff    	add    %eax,-0x284(%ebp)
+    filesz += i;
+  8027a2:	01 c3                	add    %eax,%ebx
+  8027a4:	89 9d 8c fd ff ff    	mov    %ebx,-0x274(%ebp)
+    fileoffset -= i;
+  8027aa:	29 c2                	sub    %eax,%edx
+  8027ac:	89 95 74 fd ff ff    	mov    %edx,-0x28c(%ebp)
+  for (i = 0; i < memsz; i += n * PGSIZE) {
+  8027b2:	c7 85 84 fd ff ff 00 	movl   $0x0,-0x27c(%ebp)
+  8027b9:	00 00 00 
+  8027bc:	89 8d 70 fd ff ff    	mov    %ecx,-0x290(%ebp)
+  8027c2:	89 b5 68 fd ff ff    	mov    %esi,-0x298(%ebp)
+  8027c8:	89 bd 64 fd ff ff    	mov    %edi,-0x29c(%ebp)
+  8027ce:	8b 85 84 fd ff ff    	mov    -0x27c(%ebp),%eax
+  8027d4:	89 85 78 fd ff ff    	mov    %eax,-0x288(%ebp)
+  8027da:	8b 8d 7c fd ff ff    	mov    -0x284(%ebp),%ecx
+  8027e0:	39 c8                	cmp    %ecx,%eax
+  8027e2:	0f 83 4e ff ff ff    	jae    802736 <spawn+0x428>
+    if (i >= filesz) {
+  8027e8:	8b 8d 8c fd ff ff    	mov    -0x274(%ebp),%ecx
+  8027ee:	39 8d 84 fd ff ff    	cmp    %ecx,-0x27c(%ebp)
+  8027f4:	0f 83 8a fd ff ff    	jae    802584 <spawn+0x276>
+    n = MIN(SEGCHUNK, ROUNDUP(filesz - i, PGSIZE) / PGSIZE);
+  8027fa:	8b b5 8c fd ff ff    	mov    -0x274(%ebp),%esi
+  802800:	8b 85 78 fd ff ff    	mov    -0x288(%ebp),%eax
+  802806:	29 c6                	sub    %eax,%esi
+  802808:	8d 86 ff 0f 00 00    	lea    0xfff(%esi),%eax
+  80280e:	c1 e8 0c             	shr    $0xc,%eax
+  802811:	ba 10 00 00 00       	mov    $0x10,%edx
+  802816:	39 d0                	cmp    %edx,%eax
+  802818:	0f 47 c2             	cmova  %edx,%eax
+  80281b:	89 c7                	mov    %eax,%edi
+  if ((perm & PTE_W) || PGOFF(fileoffset))
+  80281d:	8b 9d 94 fd ff ff    	mov    -0x26c(%ebp),%ebx
+  802823:	83 e3 02             	and    $0x2,%ebx
+  802826:	8b 95 74 fd ff ff    	mov    -0x28c(%ebp),%edx
+  80282c:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  802832:	09 d3                	or     %edx,%ebx
+  802834:	0f 85 98 fd ff ff    	jne    8025d2 <spawn+0x2c4>
+    n = MIN(n, (filesz - i) / PGSIZE);
+  80283a:	89 f2                	mov    %esi,%edx
+  80283c:	c1 ea 0c             	shr    $0xc,%edx
+  80283f:	39 c2                	cmp    %eax,%edx
+  802841:	0f 47 d0             	cmova  %eax,%edx
+  802844:	8b 8d 7c fd ff ff    	mov    -0x284(%ebp),%ecx
+  80284a:	39 8d 8c fd ff ff    	cmp    %ecx,-0x274(%ebp)
+  802850:	0f 43 d0             	cmovae %eax,%edx
+    if ((m = shared_pages(perm, memsz, filesz, fileoffset, i, n)) > 0) {
+  802853:	89 95 60 fd ff ff    	mov    %edx,-0x2a0(%ebp)
+  802859:	85 d2                	test   %edx,%edx
+  80285b:	0f 8e 86 fd ff ff    	jle    8025e7 <spawn+0x2d9>
+      if ((r = sysbatch_flush(&batch)) < 0)
+  802861:	83 ec 0c             	sub    $0xc,%esp
+  802864:	68 60 57 80 00       	push   $0x805760
+  802869:	e8 c3 e9 ff ff       	call   801231 <sysbatch_flush>
+  80286e:	83 c4 10             	add    $0x10,%esp
+  802871:	85 c0                	test   %eax,%eax
+  802873:	0f 88 56 01 00 00    	js     8029cf <spawn+0x6c1>
+  802879:	8b 85 60 fd ff ff    	mov    -0x2a0(%ebp),%eax
+  80287f:	c1 e0 0c             	shl    $0xc,%eax
+  802882:	89 f1                	mov    %esi,%ecx
+  802884:	29 c1                	sub    %eax,%ecx
+  802886:	89 8d 80 fd ff ff    	mov    %ecx,-0x280(%ebp)
+  80288c:	89 f3                	mov    %esi,%ebx
+        if ((r = read_map(fd, fileoffset + i + j * PGSIZE,
+  80288e:	8d be 00 10 40 00    	lea    0x401000(%esi),%edi
+  802894:	8b 8d 74 fd ff ff    	mov    -0x28c(%ebp),%ecx
+  80289a:	8b 85 8c fd ff ff    	mov    -0x274(%ebp),%eax
+  8028a0:	8d 34 01             	lea    (%ecx,%eax,1),%esi
+      for (j = 0; j < n; j++) {
+  8028a3:	8b 85 80 fd ff ff    	mov    -0x280(%ebp),%eax
+  8028a9:	39 c3                	cmp    %eax,%ebx
+  8028ab:	0f 84 28 fd ff ff    	je     8025d9 <spawn+0x2cb>
+        if ((r = read_map(fd, fileoffset + i + j * PGSIZE,
+  8028b1:	83 ec 04             	sub    $0x4,%esp
+  8028b4:	89 f8                	mov    %edi,%eax
+  8028b6:	29 d8                	sub    %ebx,%eax
+  8028b8:	50                   	push   %eax
+  8028b9:	89 f0                	mov    %esi,%eax
+  8028bb:	29 d8                	sub    %ebx,%eax
+  8028bd:	50                   	push   %eax
+  8028be:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  8028c4:	e8 00 f8 ff ff       	call   8020c9 <read_map>
+  8028c9:	83 c4 10             	add    $0x10,%esp
+  8028cc:	85 c0                	test   %eax,%eax
+  8028ce:	0f 88 02 01 00 00    	js     8029d6 <spawn+0x6c8>
+        if (r < MIN(PGSIZE, filesz - i - j * PGSIZE))
+  8028d4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8028d9:	39 d3                	cmp    %edx,%ebx
+  8028db:	0f 46 d3             	cmovbe %ebx,%edx
+  8028de:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  8028e4:	39 d0                	cmp    %edx,%eax
+  8028e6:	73 bb                	jae    8028a3 <spawn+0x595>
+          return -E_INVAL;
+  8028e8:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+  8028ed:	e9 24 fd ff ff       	jmp    802616 <spawn+0x308>
+  close(fd);
+  8028f2:	83 ec 0c             	sub    $0xc,%esp
+  8028f5:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  8028fb:	e8 7a eb ff ff       	call   80147a <close>
+// Copy the mappings for shared pages into the child address space.
+static int
+copy_shared_pages(envid_t child)
+{
+  // LAB 5: Your code here.
+  return sysbatch_add(&batch, SYS_page_map_range, 0, 0, UTOP,
+  802900:	83 c4 0c             	add    $0xc,%esp
+  802903:	6a 02                	push   $0x2
+  802905:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  80290b:	68 00 00 c0 ee       	push   $0xeec00000
+  802910:	6a 00                	push   $0x0
+  802912:	6a 00                	push   $0x0
+  802914:	6a 11                	push   $0x11
+  802916:	68 60 57 80 00       	push   $0x805760
+  80291b:	e8 61 e9 ff ff       	call   801281 <sysbatch_add>
+  if ((r = copy_shared_pages(child)) < 0)
+  802920:	83 c4 20             	add    $0x20,%esp
+  802923:	85 c0                	test   %eax,%eax
+  802925:	78 72                	js     802999 <spawn+0x68b>
+  if ((r = sysbatch_add(&batch, SYS_env_set_trapframe, child,
+  802927:	83 ec 04             	sub    $0x4,%esp
+  80292a:	6a 00                	push   $0x0
+  80292c:	6a 00                	push   $0x0
+  80292e:	6a 00                	push   $0x0
+  802930:	8d 85 a4 fd ff ff    	lea    -0x25c(%ebp),%eax
+  802936:	50                   	push   %eax
+  802937:	8b bd 90 fd ff ff    	mov    -0x270(%ebp),%edi
+  80293d:	57                   	push   %edi
+  80293e:	6a 09                	push   $0x9
+  802940:	68 60 57 80 00       	push   $0x805760
+  802945:	e8 37 e9 ff ff       	call   801281 <sysbatch_add>
+  80294a:	83 c4 20             	add    $0x20,%esp
+  80294d:	85 c0                	test   %eax,%eax
+  80294f:	78 33                	js     802984 <spawn+0x676>
+      (r = sysbatch_add(&batch, SYS_env_set_status, child,
+  802951:	83 ec 04             	sub    $0x4,%esp
+  802954:	6a 00                	push   $0x0
+  802956:	6a 00                	push   $0x0
+  802958:	6a 00                	push   $0x0
+  80295a:	6a 02                	push   $0x2
+  80295c:	57                   	push   %edi
+  80295d:	6a 08                	push   $0x8
+  80295f:	68 60 57 80 00       	push   $0x805760
+  802964:	e8 18 e9 ff ff       	call   801281 <sysbatch_add>
+                        (uint32_t) &child_tf, 0, 0, 0)) < 0 ||
+  802969:	83 c4 20             	add    $0x20,%esp
+  80296c:	85 c0                	test   %eax,%eax
+  80296e:	78 14                	js     802984 <spawn+0x676>
+      (r = sysbatch_flush(&batch)) < 0)
+  802970:	83 ec 0c             	sub    $0xc,%esp
+  802973:	68 60 57 80 00       	push   $0x805760
+  802978:	e8 b4 e8 ff ff       	call   801231 <sysbatch_flush>
+                        ENV_RUNNABLE, 0, 0, 0)) < 0 ||
+  80297d:	83 c4 10             	add    $0x10,%esp
+  802980:	85 c0                	test   %eax,%eax
+  802982:	79 36                	jns    8029ba <spawn+0x6ac>
+    panic("spawn: starting child: %e", r);
+  802984:	50                   	push   %eax
+  802985:	68 84 3e 80 00       	push   $0x803e84
+  80298a:	68 93 00 00 00       	push   $0x93
+  80298f:	68 62 3e 80 00       	push   $0x803e62
+  802994:	e8 9d d9 ff ff       	call   800336 <_panic>
+    panic("copy_shared_pages: %e", r);
+  802999:	50                   	push   %eax
+  80299a:	68 6e 3e 80 00       	push   $0x803e6e
+  80299f:	68 8c 00 00 00       	push   $0x8c
+  8029a4:	68 62 3e 80 00       	push   $0x803e62
+  8029a9:	e8 88 d9 ff ff       	call   800336 <_panic>
+    return r;
+  8029ae:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  8029b4:	89 85 6c fd ff ff    	mov    %eax,-0x294(%ebp)
+}
+  8029ba:	8b 85 6c fd ff ff    	mov    -0x294(%ebp),%eax
+  8029c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029c3:	5b                   	pop    %ebx
+  8029c4:	5e                   	pop    %esi
+  8029c5:	5f                   	pop    %edi
+  8029c6:	5d                   	pop    %ebp
+  8029c7:	c3                   	ret
+  8029c8:	89 c6                	mov    %eax,%esi
+  8029ca:	e9 47 fc ff ff       	jmp    802616 <spawn+0x308>
+  8029cf:	89 c6                	mov    %eax,%esi
+  8029d1:	e9 40 fc ff ff       	jmp    802616 <spawn+0x308>
+  8029d6:	89 c6                	mov    %eax,%esi
+  8029d8:	e9 39 fc ff ff       	jmp    802616 <spawn+0x308>
+  8029dd:	89 c6                	mov    %eax,%esi
+  8029df:	e9 32 fc ff ff       	jmp    802616 <spawn+0x308>
+  8029e4:	89 c6                	mov    %eax,%esi
+  8029e6:	e9 2b fc ff ff       	jmp    802616 <spawn+0x308>
+  8029eb:	89 c6                	mov    %eax,%esi
+  8029ed:	e9 24 fc ff ff       	jmp    802616 <spawn+0x308>
+  8029f2:	89 c6                	mov    %eax,%esi
+  8029f4:	e9 1d fc ff ff       	jmp    802616 <spawn+0x308>
+    return -E_NO_MEM;
+  8029f9:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  return r;
+  8029fe:	89 85 6c fd ff ff    	mov    %eax,-0x294(%ebp)
+  802a04:	eb b4                	jmp    8029ba <spawn+0x6ac>
+  sys_page_unmap(0, UTEMP);
+  802a06:	83 ec 08             	sub    $0x8,%esp
+  802a09:	68 00 00 40 00       	push   $0x400000
+  802a0e:	6a 00                	push   $0x0
+  802a10:	e8 9e e4 ff ff       	call   800eb3 <sys_page_unmap>
+  802a15:	83 c4 10             	add    $0x10,%esp
+  802a18:	89 9d 6c fd ff ff    	mov    %ebx,-0x294(%ebp)
+  802a1e:	eb 9a                	jmp    8029ba <spawn+0x6ac>
+
+00802a20 <spawnl>:
+{
+  802a20:	55                   	push   %ebp
+  802a21:	89 e5                	mov    %esp,%ebp
+  802a23:	56                   	push   %esi
+  802a24:	53                   	push   %ebx
+  va_start(vl, arg0);
+  802a25:	8d 45 10             	lea    0x10(%ebp),%eax
+  int argc = 0;
+  802a28:	be 00 00 00 00       	mov    $0x0,%esi
+  while (va_arg(vl, void *) != NULL) {
+  802a2d:	eb 17                	jmp    802a46 <spawnl+0x26>
+      cprintf("vl: %p saying %s\n", vl, vl);
+  802a2f:	83 ec 04             	sub    $0x4,%esp
+  802a32:	53                   	push   %ebx
+  802a33:	53                   	push   %ebx
+  802a34:	68 9e 3e 80 00       	push   $0x803e9e
+  802a39:	e8 d3 d9 ff ff       	call   800411 <cprintf>
+    argc++;
+  802a3e:	83 c6 01             	add    $0x1,%esi
+  802a41:	83 c4 10             	add    $0x10,%esp
+  while (va_arg(vl, void *) != NULL) {
+  802a44:	89 d8                	mov    %ebx,%eax
+  802a46:	8d 58 04             	lea    0x4(%eax),%ebx
+  802a49:	83 38 00             	cmpl   $0x0,(%eax)
+  802a4c:	75 e1                	jne    802a2f <spawnl+0xf>
+  cprintf("argc found %d\n", argc);
+  802a4e:	83 ec 08             	sub    $0x8,%esp
+  802a51:	56                   	push   %esi
+  802a52:	68 b0 3e 80 00       	push   $0x803eb0
+  802a57:	e8 b5 d9 ff ff       	call   800411 <cprintf>
+  const char *argv[argc+2];
+  802a5c:	8d 04 b5 17 00 00 00 	lea    0x17(,%esi,4),%eax
+  802a63:	83 e0 f0             	and    $0xfffffff0,%eax
+  802a66:	83 c4 10             	add    $0x10,%esp
+  802a69:	29 c4                	sub    %eax,%esp
+  802a6b:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  802a6f:	89 d8                	mov    %ebx,%eax
+  802a71:	c1 e8 02             	shr    $0x2,%eax
+  802a74:	83 e3 fc             	and    $0xfffffffc,%ebx
+  argv[0] = arg0;
+  802a77:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802a7a:	89 14 85 00 00 00 00 	mov    %edx,0x0(,%eax,4)
+  argv[argc+1] = NULL;
+  802a81:	c7 44 b3 04 00 00 00 	movl   $0x0,0x4(%ebx,%esi,4)
+  802a88:	00 
+  va_start(vl, arg0);
+  802a89:	8d 55 10             	lea    0x10(%ebp),%edx
+  for (i = 0; i < argc; i++)
+  802a8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a91:	eb 0b                	jmp    802a9e <spawnl+0x7e>
+    argv[i+1] = va_arg(vl, const char *);
+  802a93:	83 c0 01             	add    $0x1,%eax
+  802a96:	8b 0a                	mov    (%edx),%ecx
+  802a98:	89 0c 83             	mov    %ecx,(%ebx,%eax,4)
+  802a9b:	8d 52 04             	lea    0x4(%edx),%edx
+  for (i = 0; i < argc; i++)
+  802a9e:	39 f0                	cmp    %esi,%eax
+  802aa0:	75 f1                	jne    802a93 <spawnl+0x73>
+  return spawn(prog, argv);
+  802aa2:	83 ec 08             	sub    $0x8,%esp
+  802aa5:	53                   	push   %ebx
+  802aa6:	ff 75 08             	push   0x8(%ebp)
+  802aa9:	e8 60 f8 ff ff       	call   80230e <spawn>
+}
+  802aae:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ab1:	5b                   	pop    %ebx
+  802ab2:	5e                   	pop    %esi
+  802ab3:	5d                   	pop    %ebp
+  802ab4:	c3                   	ret
+
+00802ab5 <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  802ab5:	55                   	push   %ebp
+  802ab6:	89 e5                	mov    %esp,%ebp
+  802ab8:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  802abb:	50                   	push   %eax
+  802abc:	e8 2c e8 ff ff       	call   8012ed <fd2data>
+  802ac1:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  802ac6:	c9                   	leave
+  802ac7:	c3                   	ret
+
+00802ac8 <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802ac8:	55                   	push   %ebp
+  802ac9:	89 e5                	mov    %esp,%ebp
+  802acb:	56                   	push   %esi
+  802acc:	53                   	push   %ebx
+  802acd:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  802ad0:	83 ec 0c             	sub    $0xc,%esp
+  802ad3:	ff 75 08             	push   0x8(%ebp)
+  802ad6:	e8 12 e8 ff ff       	call   8012ed <fd2data>
+  802adb:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  802add:	83 c4 08             	add    $0x8,%esp
+  802ae0:	68 e6 3e 80 00       	push   $0x803ee6
+  802ae5:	53                   	push   %ebx
+  802ae6:	e8 14 df ff ff       	call   8009ff <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  802aeb:	8b 46 04             	mov    0x4(%esi),%eax
+  802aee:	2b 06                	sub    (%esi),%eax
+  802af0:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  802af6:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802afd:	00 00 00 
+  stat->st_dev = &devpipe;
+  802b00:	c7 83 88 00 00 00 20 	movl   $0x804020,0x88(%ebx)
+  802b07:	40 80 00 
+  return 0;
+}
+  802b0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b0f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b12:	5b                   	pop    %ebx
+  802b13:	5e                   	pop    %esi
+  802b14:	5d                   	pop    %ebp
+  802b15:	c3                   	ret
+
+00802b16 <pipe_wakeup>:
+{
+  802b16:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  802b18:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b1d:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  802b20:	85 c0                	test   %eax,%eax
+  802b22:	75 01                	jne    802b25 <pipe_wakeup+0xf>
+  802b24:	c3                   	ret
+{
+  802b25:	55                   	push   %ebp
+  802b26:	89 e5                	mov    %esp,%ebp
+  802b28:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  802b2b:	6a 00                	push   $0x0
+  802b2d:	68 00 00 c0 ee       	push   $0xeec00000
+  802b32:	52                   	push   %edx
+  802b33:	e8 52 e6 ff ff       	call   80118a <sys_chan_wakeup>
+  802b38:	83 c4 10             	add    $0x10,%esp
+}
+  802b3b:	c9                   	leave
+  802b3c:	c3                   	ret
+
+00802b3d <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802b3d:	55                   	push   %ebp
+  802b3e:	89 e5                	mov    %esp,%ebp
+  802b40:	57                   	push   %edi
+  802b41:	56                   	push   %esi
+  802b42:	53                   	push   %ebx
+  802b43:	83 ec 18             	sub    $0x18,%esp
+  802b46:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  802b49:	57                   	push   %edi
+  802b4a:	e8 9e e7 ff ff       	call   8012ed <fd2data>
+  802b4f:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  802b51:	83 c4 10             	add    $0x10,%esp
+  802b54:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  802b58:	74 2a                	je     802b84 <devpipe_close+0x47>
+  802b5a:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  802b5f:	89 f8                	mov    %edi,%eax
+  802b61:	e8 4f ff ff ff       	call   802ab5 <pipe_ring>
+  802b66:	83 ec 08             	sub    $0x8,%esp
+  802b69:	01 d8                	add    %ebx,%eax
+  802b6b:	50                   	push   %eax
+  802b6c:	6a 00                	push   $0x0
+  802b6e:	e8 40 e3 ff ff       	call   800eb3 <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  802b73:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802b79:	83 c4 10             	add    $0x10,%esp
+  802b7c:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  802b82:	75 db                	jne    802b5f <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  802b84:	83 ec 08             	sub    $0x8,%esp
+  802b87:	57                   	push   %edi
+  802b88:	6a 00                	push   $0x0
+  802b8a:	e8 24 e3 ff ff       	call   800eb3 <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  802b8f:	83 c4 10             	add    $0x10,%esp
+  802b92:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  802b96:	75 13                	jne    802bab <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  802b98:	83 ec 08             	sub    $0x8,%esp
+  802b9b:	56                   	push   %esi
+  802b9c:	6a 00                	push   $0x0
+  802b9e:	e8 10 e3 ff ff       	call   800eb3 <sys_page_unmap>
+}
+  802ba3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ba6:	5b                   	pop    %ebx
+  802ba7:	5e                   	pop    %esi
+  802ba8:	5f                   	pop    %edi
+  802ba9:	5d                   	pop    %ebp
+  802baa:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802bab:	8d 56 04             	lea    0x4(%esi),%edx
+  802bae:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802bb1:	e8 60 ff ff ff       	call   802b16 <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802bb6:	8d 46 30             	lea    0x30(%esi),%eax
+  802bb9:	89 f2                	mov    %esi,%edx
+  802bbb:	e8 56 ff ff ff       	call   802b16 <pipe_wakeup>
+  802bc0:	eb d6                	jmp    802b98 <devpipe_close+0x5b>
+
+00802bc2 <_pipeisclosed>:
+{
+  802bc2:	55                   	push   %ebp
+  802bc3:	89 e5                	mov    %esp,%ebp
+  802bc5:	57                   	push   %edi
+  802bc6:	56                   	push   %esi
+  802bc7:	53                   	push   %ebx
+  802bc8:	83 ec 1c             	sub    $0x1c,%esp
+  802bcb:	89 c7                	mov    %eax,%edi
+  802bcd:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  802bcf:	a1 64 5e 80 00       	mov    0x805e64,%eax
+  802bd4:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  802bd7:	83 ec 0c             	sub    $0xc,%esp
+  802bda:	57                   	push   %edi
+  802bdb:	e8 69 0a 00 00       	call   803649 <pageref>
+  802be0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802be3:	89 34 24             	mov    %esi,(%esp)
+  802be6:	e8 5e 0a 00 00       	call   803649 <pageref>
+    nn = thisenv->env_runs;
+  802beb:	8b 15 64 5e 80 00    	mov    0x805e64,%edx
+  802bf1:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  802bf4:	83 c4 10             	add    $0x10,%esp
+  802bf7:	39 cb                	cmp    %ecx,%ebx
+  802bf9:	74 1b                	je     802c16 <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  802bfb:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802bfe:	75 cf                	jne    802bcf <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802c00:	8b 42 58             	mov    0x58(%edx),%eax
+  802c03:	6a 01                	push   $0x1
+  802c05:	50                   	push   %eax
+  802c06:	53                   	push   %ebx
+  802c07:	68 ed 3e 80 00       	push   $0x803eed
+  802c0c:	e8 00 d8 ff ff       	call   800411 <cprintf>
+  802c11:	83 c4 10             	add    $0x10,%esp
+  802c14:	eb b9                	jmp    802bcf <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  802c16:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802c19:	0f 94 c0             	sete   %al
+  802c1c:	0f b6 c0             	movzbl %al,%eax
+}
+  802c1f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c22:	5b                   	pop    %ebx
+  802c23:	5e                   	pop    %esi
+  802c24:	5f                   	pop    %edi
+  802c25:	5d                   	pop    %ebp
+  802c26:	c3                   	ret
+
+00802c27 <devpipe_write_bulk>:
+{
+  802c27:	55                   	push   %ebp
+  802c28:	89 e5                	mov    %esp,%ebp
+  802c2a:	57                   	push   %edi
+  802c2b:	56                   	push   %esi
+  802c2c:	53                   	push   %ebx
+  802c2d:	83 ec 1c             	sub    $0x1c,%esp
+  802c30:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802c33:	89 d6                	mov    %edx,%esi
+  802c35:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  802c38:	e8 78 fe ff ff       	call   802ab5 <pipe_ring>
+  802c3d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  802c40:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802c45:	8d 46 04             	lea    0x4(%esi),%eax
+  802c48:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  802c4b:	eb 75                	jmp    802cc2 <devpipe_write_bulk+0x9b>
+  802c4d:	b8 01 00 00 00       	mov    $0x1,%eax
+  802c52:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802c56:	6a 64                	push   $0x64
+  802c58:	68 00 00 c0 ee       	push   $0xeec00000
+  802c5d:	53                   	push   %ebx
+  802c5e:	56                   	push   %esi
+  802c5f:	e8 03 e5 ff ff       	call   801167 <sys_chan_sleep>
+      continue;
+  802c64:	83 c4 10             	add    $0x10,%esp
+  802c67:	eb 59                	jmp    802cc2 <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  802c69:	89 d1                	mov    %edx,%ecx
+  802c6b:	c1 f9 1f             	sar    $0x1f,%ecx
+  802c6e:	c1 e9 11             	shr    $0x11,%ecx
+  802c71:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802c74:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802c79:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  802c7b:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  802c81:	29 d3                	sub    %edx,%ebx
+  802c83:	ba 00 80 00 00       	mov    $0x8000,%edx
+  802c88:	29 c2                	sub    %eax,%edx
+  802c8a:	39 d3                	cmp    %edx,%ebx
+  802c8c:	0f 47 da             	cmova  %edx,%ebx
+  802c8f:	8b 55 08             	mov    0x8(%ebp),%edx
+  802c92:	29 fa                	sub    %edi,%edx
+  802c94:	39 d3                	cmp    %edx,%ebx
+  802c96:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  802c99:	83 ec 04             	sub    $0x4,%esp
+  802c9c:	53                   	push   %ebx
+  802c9d:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802ca0:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  802ca3:	52                   	push   %edx
+  802ca4:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802ca7:	01 c8                	add    %ecx,%eax
+  802ca9:	50                   	push   %eax
+  802caa:	e8 38 df ff ff       	call   800be7 <memcpy>
+    i += m;
+  802caf:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  802cb1:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802cb4:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802cb7:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802cba:	e8 57 fe ff ff       	call   802b16 <pipe_wakeup>
+  802cbf:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802cc2:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802cc5:	73 2b                	jae    802cf2 <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  802cc7:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  802cc9:	8b 56 04             	mov    0x4(%esi),%edx
+  802ccc:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  802cd2:	39 d0                	cmp    %edx,%eax
+  802cd4:	7d 93                	jge    802c69 <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  802cd6:	89 f2                	mov    %esi,%edx
+  802cd8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802cdb:	e8 e2 fe ff ff       	call   802bc2 <_pipeisclosed>
+  802ce0:	85 c0                	test   %eax,%eax
+  802ce2:	0f 84 65 ff ff ff    	je     802c4d <devpipe_write_bulk+0x26>
+        return i;
+  802ce8:	89 f8                	mov    %edi,%eax
+}
+  802cea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ced:	5b                   	pop    %ebx
+  802cee:	5e                   	pop    %esi
+  802cef:	5f                   	pop    %edi
+  802cf0:	5d                   	pop    %ebp
+  802cf1:	c3                   	ret
+  return i;
+  802cf2:	89 f8                	mov    %edi,%eax
+  802cf4:	eb f4                	jmp    802cea <devpipe_write_bulk+0xc3>
+
+00802cf6 <devpipe_write>:
+{
+  802cf6:	55                   	push   %ebp
+  802cf7:	89 e5                	mov    %esp,%ebp
+  802cf9:	57                   	push   %edi
+  802cfa:	56                   	push   %esi
+  802cfb:	53                   	push   %ebx
+  802cfc:	83 ec 28             	sub    $0x28,%esp
+  802cff:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  802d02:	56                   	push   %esi
+  802d03:	e8 e5 e5 ff ff       	call   8012ed <fd2data>
+  802d08:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  802d0a:	8b 78 28             	mov    0x28(%eax),%edi
+  802d0d:	83 c4 10             	add    $0x10,%esp
+  802d10:	85 ff                	test   %edi,%edi
+  802d12:	75 25                	jne    802d39 <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  802d14:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802d17:	74 66                	je     802d7f <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802d19:	8b 43 04             	mov    0x4(%ebx),%eax
+  802d1c:	8b 0b                	mov    (%ebx),%ecx
+  802d1e:	8d 51 20             	lea    0x20(%ecx),%edx
+  802d21:	39 d0                	cmp    %edx,%eax
+  802d23:	72 2b                	jb     802d50 <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  802d25:	89 da                	mov    %ebx,%edx
+  802d27:	89 f0                	mov    %esi,%eax
+  802d29:	e8 94 fe ff ff       	call   802bc2 <_pipeisclosed>
+  802d2e:	85 c0                	test   %eax,%eax
+  802d30:	75 51                	jne    802d83 <devpipe_write+0x8d>
+      sys_yield();
+  802d32:	e8 95 e0 ff ff       	call   800dcc <sys_yield>
+  802d37:	eb e0                	jmp    802d19 <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  802d39:	83 ec 0c             	sub    $0xc,%esp
+  802d3c:	ff 75 10             	push   0x10(%ebp)
+  802d3f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802d42:	89 c2                	mov    %eax,%edx
+  802d44:	89 f0                	mov    %esi,%eax
+  802d46:	e8 dc fe ff ff       	call   802c27 <devpipe_write_bulk>
+  802d4b:	83 c4 10             	add    $0x10,%esp
+  802d4e:	eb 38                	jmp    802d88 <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802d50:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802d53:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802d57:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802d5a:	89 c2                	mov    %eax,%edx
+  802d5c:	c1 fa 1f             	sar    $0x1f,%edx
+  802d5f:	89 d1                	mov    %edx,%ecx
+  802d61:	c1 e9 1b             	shr    $0x1b,%ecx
+  802d64:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802d67:	83 e2 1f             	and    $0x1f,%edx
+  802d6a:	29 ca                	sub    %ecx,%edx
+  802d6c:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802d70:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  802d74:	83 c0 01             	add    $0x1,%eax
+  802d77:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  802d7a:	83 c7 01             	add    $0x1,%edi
+  802d7d:	eb 95                	jmp    802d14 <devpipe_write+0x1e>
+  return i;
+  802d7f:	89 f8                	mov    %edi,%eax
+  802d81:	eb 05                	jmp    802d88 <devpipe_write+0x92>
+        return 0;
+  802d83:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d88:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d8b:	5b                   	pop    %ebx
+  802d8c:	5e                   	pop    %esi
+  802d8d:	5f                   	pop    %edi
+  802d8e:	5d                   	pop    %ebp
+  802d8f:	c3                   	ret
+
+00802d90 <devpipe_read_bulk>:
+{
+  802d90:	55                   	push   %ebp
+  802d91:	89 e5                	mov    %esp,%ebp
+  802d93:	57                   	push   %edi
+  802d94:	56                   	push   %esi
+  802d95:	53                   	push   %ebx
+  802d96:	83 ec 2c             	sub    $0x2c,%esp
+  802d99:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802d9c:	89 d6                	mov    %edx,%esi
+  802d9e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802da1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  802da4:	e8 0c fd ff ff       	call   802ab5 <pipe_ring>
+  802da9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  802dac:	85 db                	test   %ebx,%ebx
+  802dae:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802db3:	0f 45 c3             	cmovne %ebx,%eax
+  802db6:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802db9:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802dbe:	8d 46 30             	lea    0x30(%esi),%eax
+  802dc1:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  802dc4:	eb 50                	jmp    802e16 <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  802dc6:	89 d1                	mov    %edx,%ecx
+  802dc8:	c1 f9 1f             	sar    $0x1f,%ecx
+  802dcb:	c1 e9 11             	shr    $0x11,%ecx
+  802dce:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802dd1:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802dd6:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  802dd8:	29 d3                	sub    %edx,%ebx
+  802dda:	ba 00 80 00 00       	mov    $0x8000,%edx
+  802ddf:	29 c2                	sub    %eax,%edx
+  802de1:	39 d3                	cmp    %edx,%ebx
+  802de3:	0f 47 da             	cmova  %edx,%ebx
+  802de6:	8b 55 08             	mov    0x8(%ebp),%edx
+  802de9:	29 fa                	sub    %edi,%edx
+  802deb:	39 d3                	cmp    %edx,%ebx
+  802ded:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  802df0:	83 ec 04             	sub    $0x4,%esp
+  802df3:	53                   	push   %ebx
+  802df4:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802df7:	01 c8                	add    %ecx,%eax
+  802df9:	50                   	push   %eax
+  802dfa:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802dfd:	01 f8                	add    %edi,%eax
+  802dff:	50                   	push   %eax
+  802e00:	e8 e2 dd ff ff       	call   800be7 <memcpy>
+    i += m;
+  802e05:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  802e07:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802e09:	89 f2                	mov    %esi,%edx
+  802e0b:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802e0e:	e8 03 fd ff ff       	call   802b16 <pipe_wakeup>
+  802e13:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802e16:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802e19:	73 51                	jae    802e6c <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  802e1b:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  802e1e:	8b 16                	mov    (%esi),%edx
+  802e20:	39 da                	cmp    %ebx,%edx
+  802e22:	75 a2                	jne    802dc6 <devpipe_read_bulk+0x36>
+      if (i > 0)
+  802e24:	85 ff                	test   %edi,%edi
+  802e26:	75 44                	jne    802e6c <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  802e28:	89 f2                	mov    %esi,%edx
+  802e2a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802e2d:	e8 90 fd ff ff       	call   802bc2 <_pipeisclosed>
+  802e32:	85 c0                	test   %eax,%eax
+  802e34:	75 3a                	jne    802e70 <devpipe_read_bulk+0xe0>
+  802e36:	b8 01 00 00 00       	mov    $0x1,%eax
+  802e3b:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802e3f:	6a 64                	push   $0x64
+  802e41:	ff 75 d4             	push   -0x2c(%ebp)
+  802e44:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  802e45:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802e48:	50                   	push   %eax
+  802e49:	e8 19 e3 ff ff       	call   801167 <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  802e4e:	85 c0                	test   %eax,%eax
+  802e50:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e55:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  802e58:	83 c4 10             	add    $0x10,%esp
+  802e5b:	a8 01                	test   $0x1,%al
+  802e5d:	74 b7                	je     802e16 <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  802e5f:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  802e64:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e67:	5b                   	pop    %ebx
+  802e68:	5e                   	pop    %esi
+  802e69:	5f                   	pop    %edi
+  802e6a:	5d                   	pop    %ebp
+  802e6b:	c3                   	ret
+  return i;
+  802e6c:	89 f8                	mov    %edi,%eax
+  802e6e:	eb f4                	jmp    802e64 <devpipe_read_bulk+0xd4>
+        return 0;
+  802e70:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e75:	eb ed                	jmp    802e64 <devpipe_read_bulk+0xd4>
+
+00802e77 <devpipe_read>:
+{
+  802e77:	55                   	push   %ebp
+  802e78:	89 e5                	mov    %esp,%ebp
+  802e7a:	57                   	push   %edi
+  802e7b:	56                   	push   %esi
+  802e7c:	53                   	push   %ebx
+  802e7d:	83 ec 18             	sub    $0x18,%esp
+  802e80:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  802e83:	57                   	push   %edi
+  802e84:	e8 64 e4 ff ff       	call   8012ed <fd2data>
+  802e89:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  802e8b:	8b 70 28             	mov    0x28(%eax),%esi
+  802e8e:	83 c4 10             	add    $0x10,%esp
+  802e91:	85 f6                	test   %esi,%esi
+  802e93:	75 24                	jne    802eb9 <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  802e95:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802e98:	74 60                	je     802efa <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  802e9a:	8b 03                	mov    (%ebx),%eax
+  802e9c:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802e9f:	75 3b                	jne    802edc <devpipe_read+0x65>
+      if (i > 0)
+  802ea1:	85 f6                	test   %esi,%esi
+  802ea3:	75 2d                	jne    802ed2 <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  802ea5:	89 da                	mov    %ebx,%edx
+  802ea7:	89 f8                	mov    %edi,%eax
+  802ea9:	e8 14 fd ff ff       	call   802bc2 <_pipeisclosed>
+  802eae:	85 c0                	test   %eax,%eax
+  802eb0:	75 4c                	jne    802efe <devpipe_read+0x87>
+      sys_yield();
+  802eb2:	e8 15 df ff ff       	call   800dcc <sys_yield>
+  802eb7:	eb e1                	jmp    802e9a <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  802eb9:	83 ec 08             	sub    $0x8,%esp
+  802ebc:	6a 00                	push   $0x0
+  802ebe:	ff 75 10             	push   0x10(%ebp)
+  802ec1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802ec4:	89 c2                	mov    %eax,%edx
+  802ec6:	89 f8                	mov    %edi,%eax
+  802ec8:	e8 c3 fe ff ff       	call   802d90 <devpipe_read_bulk>
+  802ecd:	83 c4 10             	add    $0x10,%esp
+  802ed0:	eb 02                	jmp    802ed4 <devpipe_read+0x5d>
+        return i;
+  802ed2:	89 f0                	mov    %esi,%eax
+}
+  802ed4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ed7:	5b                   	pop    %ebx
+  802ed8:	5e                   	pop    %esi
+  802ed9:	5f                   	pop    %edi
+  802eda:	5d                   	pop    %ebp
+  802edb:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802edc:	99                   	cltd
+  802edd:	c1 ea 1b             	shr    $0x1b,%edx
+  802ee0:	01 d0                	add    %edx,%eax
+  802ee2:	83 e0 1f             	and    $0x1f,%eax
+  802ee5:	29 d0                	sub    %edx,%eax
+  802ee7:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802eec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802eef:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  802ef2:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  802ef5:	83 c6 01             	add    $0x1,%esi
+  802ef8:	eb 9b                	jmp    802e95 <devpipe_read+0x1e>
+  return i;
+  802efa:	89 f0                	mov    %esi,%eax
+  802efc:	eb d6                	jmp    802ed4 <devpipe_read+0x5d>
+        return 0;
+  802efe:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f03:	eb cf                	jmp    802ed4 <devpipe_read+0x5d>
+
+00802f05 <pipe2>:
+{
+  802f05:	55                   	push   %ebp
+  802f06:	89 e5                	mov    %esp,%ebp
+  802f08:	57                   	push   %edi
+  802f09:	56                   	push   %esi
+  802f0a:	53                   	push   %ebx
+  802f0b:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  802f0e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802f11:	50                   	push   %eax
+  802f12:	e8 ea e3 ff ff       	call   801301 <fd_alloc>
+  802f17:	89 c3                	mov    %eax,%ebx
+  802f19:	83 c4 10             	add    $0x10,%esp
+  802f1c:	85 c0                	test   %eax,%eax
+  802f1e:	0f 88 fb 01 00 00    	js     80311f <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802f24:	83 ec 04             	sub    $0x4,%esp
+  802f27:	68 07 04 00 00       	push   $0x407
+  802f2c:	ff 75 e4             	push   -0x1c(%ebp)
+  802f2f:	6a 00                	push   $0x0
+  802f31:	e8 f8 de ff ff       	call   800e2e <sys_page_alloc>
+  802f36:	89 c3                	mov    %eax,%ebx
+  802f38:	83 c4 10             	add    $0x10,%esp
+  802f3b:	85 c0                	test   %eax,%eax
+  802f3d:	0f 88 dc 01 00 00    	js     80311f <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  802f43:	83 ec 0c             	sub    $0xc,%esp
+  802f46:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  802f49:	50                   	push   %eax
+  802f4a:	e8 b2 e3 ff ff       	call   801301 <fd_alloc>
+  802f4f:	89 c3                	mov    %eax,%ebx
+  802f51:	83 c4 10             	add    $0x10,%esp
+  802f54:	85 c0                	test   %eax,%eax
+  802f56:	0f 88 b3 01 00 00    	js     80310f <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802f5c:	83 ec 04             	sub    $0x4,%esp
+  802f5f:	68 07 04 00 00       	push   $0x407
+  802f64:	ff 75 e0             	push   -0x20(%ebp)
+  802f67:	6a 00                	push   $0x0
+  802f69:	e8 c0 de ff ff       	call   800e2e <sys_page_alloc>
+  802f6e:	89 c3                	mov    %eax,%ebx
+  802f70:	83 c4 10             	add    $0x10,%esp
+  802f73:	85 c0                	test   %eax,%eax
+  802f75:	0f 88 94 01 00 00    	js     80310f <pipe2+0x20a>
+  va = fd2data(fd0);
+  802f7b:	83 ec 0c             	sub    $0xc,%esp
+  802f7e:	ff 75 e4             	push   -0x1c(%ebp)
+  802f81:	e8 67 e3 ff ff       	call   8012ed <fd2data>
+  802f86:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802f88:	83 c4 0c             	add    $0xc,%esp
+  802f8b:	68 07 04 00 00       	push   $0x407
+  802f90:	50                   	push   %eax
+  802f91:	6a 00                	push   $0x0
+  802f93:	e8 96 de ff ff       	call   800e2e <sys_page_alloc>
+  802f98:	89 c3                	mov    %eax,%ebx
+  802f9a:	83 c4 10             	add    $0x10,%esp
+  802f9d:	85 c0                	test   %eax,%eax
+  802f9f:	0f 88 5a 01 00 00    	js     8030ff <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802fa5:	83 ec 0c             	sub    $0xc,%esp
+  802fa8:	ff 75 e0             	push   -0x20(%ebp)
+  802fab:	e8 3d e3 ff ff       	call   8012ed <fd2data>
+  802fb0:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802fb7:	50                   	push   %eax
+  802fb8:	6a 00                	push   $0x0
+  802fba:	57                   	push   %edi
+  802fbb:	6a 00                	push   $0x0
+  802fbd:	e8 af de ff ff       	call   800e71 <sys_page_map>
+  802fc2:	89 c3                	mov    %eax,%ebx
+  802fc4:	83 c4 20             	add    $0x20,%esp
+  802fc7:	85 c0                	test   %eax,%eax
+  802fc9:	0f 88 22 01 00 00    	js     8030f1 <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  802fcf:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  802fd3:	74 72                	je     803047 <pipe2+0x142>
+  802fd5:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  802fda:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802fdd:	e8 d3 fa ff ff       	call   802ab5 <pipe_ring>
+  802fe2:	83 ec 04             	sub    $0x4,%esp
+  802fe5:	68 07 04 00 00       	push   $0x407
+  802fea:	01 f0                	add    %esi,%eax
+  802fec:	50                   	push   %eax
+  802fed:	6a 00                	push   $0x0
+  802fef:	e8 3a de ff ff       	call   800e2e <sys_page_alloc>
+  802ff4:	89 c3                	mov    %eax,%ebx
+  802ff6:	83 c4 10             	add    $0x10,%esp
+  802ff9:	85 c0                	test   %eax,%eax
+  802ffb:	0f 88 97 00 00 00    	js     803098 <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  803001:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803004:	e8 ac fa ff ff       	call   802ab5 <pipe_ring>
+  803009:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  80300c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80300f:	e8 a1 fa ff ff       	call   802ab5 <pipe_ring>
+  803014:	83 ec 0c             	sub    $0xc,%esp
+  803017:	68 07 04 00 00       	push   $0x407
+  80301c:	53                   	push   %ebx
+  80301d:	6a 00                	push   $0x0
+  80301f:	01 f0                	add    %esi,%eax
+  803021:	50                   	push   %eax
+  803022:	6a 00                	push   $0x0
+  803024:	e8 48 de ff ff       	call   800e71 <sys_page_map>
+  803029:	89 c3                	mov    %eax,%ebx
+  80302b:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803031:	83 c4 20             	add    $0x20,%esp
+  803034:	85 c0                	test   %eax,%eax
+  803036:	78 60                	js     803098 <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  803038:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  80303e:	75 9a                	jne    802fda <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  803040:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  803047:	a1 20 40 80 00       	mov    0x804020,%eax
+  80304c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80304f:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  803051:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  803054:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  80305b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80305e:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  803060:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803063:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  80306a:	83 ec 0c             	sub    $0xc,%esp
+  80306d:	ff 75 e4             	push   -0x1c(%ebp)
+  803070:	e8 68 e2 ff ff       	call   8012dd <fd2num>
+  803075:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803078:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  80307a:	83 c4 04             	add    $0x4,%esp
+  80307d:	ff 75 e0             	push   -0x20(%ebp)
+  803080:	e8 58 e2 ff ff       	call   8012dd <fd2num>
+  803085:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803088:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  80308b:	83 c4 10             	add    $0x10,%esp
+  80308e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803093:	e9 87 00 00 00       	jmp    80311f <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  803098:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  80309d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8030a0:	e8 10 fa ff ff       	call   802ab5 <pipe_ring>
+  8030a5:	83 ec 08             	sub    $0x8,%esp
+  8030a8:	01 f0                	add    %esi,%eax
+  8030aa:	50                   	push   %eax
+  8030ab:	6a 00                	push   $0x0
+  8030ad:	e8 01 de ff ff       	call   800eb3 <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  8030b2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8030b5:	e8 fb f9 ff ff       	call   802ab5 <pipe_ring>
+  8030ba:	83 c4 08             	add    $0x8,%esp
+  8030bd:	01 f0                	add    %esi,%eax
+  8030bf:	50                   	push   %eax
+  8030c0:	6a 00                	push   $0x0
+  8030c2:	e8 ec dd ff ff       	call   800eb3 <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  8030c7:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8030cd:	83 c4 10             	add    $0x10,%esp
+  8030d0:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  8030d6:	75 c5                	jne    80309d <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  8030d8:	83 ec 0c             	sub    $0xc,%esp
+  8030db:	ff 75 e0             	push   -0x20(%ebp)
+  8030de:	e8 0a e2 ff ff       	call   8012ed <fd2data>
+  8030e3:	83 c4 08             	add    $0x8,%esp
+  8030e6:	50                   	push   %eax
+  8030e7:	6a 00                	push   $0x0
+  8030e9:	e8 c5 dd ff ff       	call   800eb3 <sys_page_unmap>
+  8030ee:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  8030f1:	83 ec 08             	sub    $0x8,%esp
+  8030f4:	57                   	push   %edi
+  8030f5:	6a 00                	push   $0x0
+  8030f7:	e8 b7 dd ff ff       	call   800eb3 <sys_page_unmap>
+  8030fc:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  8030ff:	83 ec 08             	sub    $0x8,%esp
+  803102:	ff 75 e0             	push   -0x20(%ebp)
+  803105:	6a 00                	push   $0x0
+  803107:	e8 a7 dd ff ff       	call   800eb3 <sys_page_unmap>
+  80310c:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  80310f:	83 ec 08             	sub    $0x8,%esp
+  803112:	ff 75 e4             	push   -0x1c(%ebp)
+  803115:	6a 00                	push   $0x0
+  803117:	e8 97 dd ff ff       	call   800eb3 <sys_page_unmap>
+  80311c:	83 c4 10             	add    $0x10,%esp
+}
+  80311f:	89 d8                	mov    %ebx,%eax
+  803121:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803124:	5b                   	pop    %ebx
+  803125:	5e                   	pop    %esi
+  803126:	5f                   	pop    %edi
+  803127:	5d                   	pop    %ebp
+  803128:	c3                   	ret
+
+00803129 <pipe>:
+{
+  803129:	55                   	push   %ebp
+  80312a:	89 e5                	mov    %esp,%ebp
+  80312c:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  80312f:	6a 00                	push   $0x0
+  803131:	ff 75 08             	push   0x8(%ebp)
+  803134:	e8 cc fd ff ff       	call   802f05 <pipe2>
+}
+  803139:	c9                   	leave
+  80313a:	c3                   	ret
+
+0080313b <pipeisclosed>:
+{
+  80313b:	55                   	push   %ebp
+  80313c:	89 e5                	mov    %esp,%ebp
+  80313e:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803141:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803144:	50                   	push   %eax
+  803145:	ff 75 08             	push   0x8(%ebp)
+  803148:	e8 0a e2 ff ff       	call   801357 <fd_lookup>
+  80314d:	83 c4 10             	add    $0x10,%esp
+  803150:	85 c0                	test   %eax,%eax
+  803152:	78 18                	js     80316c <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  803154:	83 ec 0c             	sub    $0xc,%esp
+  803157:	ff 75 f4             	push   -0xc(%ebp)
+  80315a:	e8 8e e1 ff ff       	call   8012ed <fd2data>
+  80315f:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  803161:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803164:	e8 59 fa ff ff       	call   802bc2 <_pipeisclosed>
+  803169:	83 c4 10             	add    $0x10,%esp
+}
+  80316c:	c9                   	leave
+  80316d:	c3                   	ret
+
+0080316e <pipe_splice>:
+{
+  80316e:	55                   	push   %ebp
+  80316f:	89 e5                	mov    %esp,%ebp
+  803171:	57                   	push   %edi
+  803172:	56                   	push   %esi
+  803173:	53                   	push   %ebx
+  803174:	83 ec 34             	sub    $0x34,%esp
+  803177:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80317a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80317d:	50                   	push   %eax
+  80317e:	ff 75 08             	push   0x8(%ebp)
+  803181:	e8 d1 e1 ff ff       	call   801357 <fd_lookup>
+  803186:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  803189:	83 c4 10             	add    $0x10,%esp
+  80318c:	85 c0                	test   %eax,%eax
+  80318e:	0f 88 d7 00 00 00    	js     80326b <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  803194:	83 ec 0c             	sub    $0xc,%esp
+  803197:	ff 75 e4             	push   -0x1c(%ebp)
+  80319a:	e8 4e e1 ff ff       	call   8012ed <fd2data>
+  80319f:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  8031a1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8031a4:	83 c4 10             	add    $0x10,%esp
+  8031a7:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  8031ad:	39 10                	cmp    %edx,(%eax)
+  8031af:	0f 85 c1 00 00 00    	jne    803276 <pipe_splice+0x108>
+  8031b5:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  8031b9:	0f 84 c0 00 00 00    	je     80327f <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  8031bf:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  8031c3:	0f 84 bf 00 00 00    	je     803288 <pipe_splice+0x11a>
+  8031c9:	89 f7                	mov    %esi,%edi
+  8031cb:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  8031d1:	0f 85 ba 00 00 00    	jne    803291 <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  8031d7:	8d 43 04             	lea    0x4(%ebx),%eax
+  8031da:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8031dd:	eb 38                	jmp    803217 <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  8031df:	83 ec 0c             	sub    $0xc,%esp
+  8031e2:	68 00 10 00 00       	push   $0x1000
+  8031e7:	89 f1                	mov    %esi,%ecx
+  8031e9:	89 da                	mov    %ebx,%edx
+  8031eb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8031ee:	e8 34 fa ff ff       	call   802c27 <devpipe_write_bulk>
+  8031f3:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8031f6:	83 c4 10             	add    $0x10,%esp
+  8031f9:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8031fe:	75 53                	jne    803253 <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  803200:	83 ec 08             	sub    $0x8,%esp
+  803203:	56                   	push   %esi
+  803204:	6a 00                	push   $0x0
+  803206:	e8 a8 dc ff ff       	call   800eb3 <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  80320b:	83 c7 01             	add    $0x1,%edi
+  80320e:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803214:	83 c4 10             	add    $0x10,%esp
+  803217:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  80321a:	74 3a                	je     803256 <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  80321c:	8b 03                	mov    (%ebx),%eax
+  80321e:	39 43 04             	cmp    %eax,0x4(%ebx)
+  803221:	75 bc                	jne    8031df <pipe_splice+0x71>
+  803223:	b8 00 00 00 00       	mov    $0x0,%eax
+  803228:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  80322c:	85 c0                	test   %eax,%eax
+  80322e:	74 af                	je     8031df <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  803230:	83 ec 04             	sub    $0x4,%esp
+  803233:	6a 07                	push   $0x7
+  803235:	56                   	push   %esi
+  803236:	ff 75 d0             	push   -0x30(%ebp)
+  803239:	e8 4c df ff ff       	call   80118a <sys_chan_wakeup>
+  80323e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  803241:	83 c4 10             	add    $0x10,%esp
+  803244:	85 c0                	test   %eax,%eax
+  803246:	79 b8                	jns    803200 <pipe_splice+0x92>
+  803248:	b8 01 00 00 00       	mov    $0x1,%eax
+  80324d:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  803251:	eb 8c                	jmp    8031df <pipe_splice+0x71>
+  803253:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  803256:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80325a:	75 06                	jne    803262 <pipe_splice+0xf4>
+  80325c:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  803260:	78 09                	js     80326b <pipe_splice+0xfd>
+  return i * PGSIZE;
+  803262:	8b 45 10             	mov    0x10(%ebp),%eax
+  803265:	c1 e0 0c             	shl    $0xc,%eax
+  803268:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  80326b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80326e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803271:	5b                   	pop    %ebx
+  803272:	5e                   	pop    %esi
+  803273:	5f                   	pop    %edi
+  803274:	5d                   	pop    %ebp
+  803275:	c3                   	ret
+    return -E_INVAL;
+  803276:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  80327d:	eb ec                	jmp    80326b <pipe_splice+0xfd>
+  80327f:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  803286:	eb e3                	jmp    80326b <pipe_splice+0xfd>
+  803288:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  80328f:	eb da                	jmp    80326b <pipe_splice+0xfd>
+  803291:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  803298:	eb d1                	jmp    80326b <pipe_splice+0xfd>
+
+0080329a <pipe_splice_read>:
+{
+  80329a:	55                   	push   %ebp
+  80329b:	89 e5                	mov    %esp,%ebp
+  80329d:	53                   	push   %ebx
+  80329e:	83 ec 1c             	sub    $0x1c,%esp
+  8032a1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8032a4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8032a7:	50                   	push   %eax
+  8032a8:	ff 75 08             	push   0x8(%ebp)
+  8032ab:	e8 a7 e0 ff ff       	call   801357 <fd_lookup>
+  8032b0:	83 c4 10             	add    $0x10,%esp
+  8032b3:	85 c0                	test   %eax,%eax
+  8032b5:	78 49                	js     803300 <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  8032b7:	83 ec 0c             	sub    $0xc,%esp
+  8032ba:	ff 75 f4             	push   -0xc(%ebp)
+  8032bd:	e8 2b e0 ff ff       	call   8012ed <fd2data>
+  8032c2:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  8032c4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8032c7:	83 c4 10             	add    $0x10,%esp
+  8032ca:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  8032d0:	39 08                	cmp    %ecx,(%eax)
+  8032d2:	75 31                	jne    803305 <pipe_splice_read+0x6b>
+  8032d4:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  8032d8:	74 32                	je     80330c <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  8032da:	8b 48 08             	mov    0x8(%eax),%ecx
+  8032dd:	83 e1 03             	and    $0x3,%ecx
+  8032e0:	83 f9 01             	cmp    $0x1,%ecx
+  8032e3:	74 2e                	je     803313 <pipe_splice_read+0x79>
+  8032e5:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  8032eb:	75 2d                	jne    80331a <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  8032ed:	83 ec 08             	sub    $0x8,%esp
+  8032f0:	53                   	push   %ebx
+  8032f1:	68 00 10 00 00       	push   $0x1000
+  8032f6:	89 d9                	mov    %ebx,%ecx
+  8032f8:	e8 93 fa ff ff       	call   802d90 <devpipe_read_bulk>
+  8032fd:	83 c4 10             	add    $0x10,%esp
+}
+  803300:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803303:	c9                   	leave
+  803304:	c3                   	ret
+    return -E_INVAL;
+  803305:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80330a:	eb f4                	jmp    803300 <pipe_splice_read+0x66>
+  80330c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803311:	eb ed                	jmp    803300 <pipe_splice_read+0x66>
+  803313:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803318:	eb e6                	jmp    803300 <pipe_splice_read+0x66>
+  80331a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80331f:	eb df                	jmp    803300 <pipe_splice_read+0x66>
+
+00803321 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  803321:	55                   	push   %ebp
+  803322:	89 e5                	mov    %esp,%ebp
+  803324:	56                   	push   %esi
+  803325:	53                   	push   %ebx
+  803326:	8b 75 08             	mov    0x8(%ebp),%esi
+  const volatile struct Env *e;
+
+  assert(envid != 0);
+  803329:	85 f6                	test   %esi,%esi
+  80332b:	74 15                	je     803342 <wait+0x21>
+  e = &envs[ENVX(envid)];
+  80332d:	89 f0                	mov    %esi,%eax
+  80332f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  while (e->env_id == envid && e->env_status != ENV_FREE)
+  803334:	8d 1c c0             	lea    (%eax,%eax,8),%ebx
+  803337:	c1 e3 04             	shl    $0x4,%ebx
+  80333a:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  803340:	eb 1b                	jmp    80335d <wait+0x3c>
+  assert(envid != 0);
+  803342:	68 05 3f 80 00       	push   $0x803f05
+  803347:	68 f8 3d 80 00       	push   $0x803df8
+  80334c:	6a 09                	push   $0x9
+  80334e:	68 10 3f 80 00       	push   $0x803f10
+  803353:	e8 de cf ff ff       	call   800336 <_panic>
+    sys_yield();
+  803358:	e8 6f da ff ff       	call   800dcc <sys_yield>
+  while (e->env_id == envid && e->env_status != ENV_FREE)
+  80335d:	8b 43 48             	mov    0x48(%ebx),%eax
+  803360:	39 f0                	cmp    %esi,%eax
+  803362:	75 07                	jne    80336b <wait+0x4a>
+  803364:	8b 43 54             	mov    0x54(%ebx),%eax
+  803367:	85 c0                	test   %eax,%eax
+  803369:	75 ed                	jne    803358 <wait+0x37>
+}
+  80336b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80336e:	5b                   	pop    %ebx
+  80336f:	5e                   	pop    %esi
+  803370:	5d                   	pop    %ebp
+  803371:	c3                   	ret
+
+00803372 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  803372:	b8 00 00 00 00       	mov    $0x0,%eax
+  803377:	c3                   	ret
+
+00803378 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803378:	55                   	push   %ebp
+  803379:	89 e5                	mov    %esp,%ebp
+  80337b:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  80337e:	68 1b 3f 80 00       	push   $0x803f1b
+  803383:	ff 75 0c             	push   0xc(%ebp)
+  803386:	e8 74 d6 ff ff       	call   8009ff <strcpy>
+  return 0;
+}
+  80338b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803390:	c9                   	leave
+  803391:	c3                   	ret
+
+00803392 <devcons_write>:
+{
+  803392:	55                   	push   %ebp
+  803393:	89 e5                	mov    %esp,%ebp
+  803395:	57                   	push   %edi
+  803396:	56                   	push   %esi
+  803397:	53                   	push   %ebx
+  803398:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  80339e:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  8033a3:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  8033a9:	eb 2e                	jmp    8033d9 <devcons_write+0x47>
+    m = n - tot;
+  8033ab:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8033ae:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  8033b0:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8033b5:	39 c3                	cmp    %eax,%ebx
+  8033b7:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  8033ba:	83 ec 04             	sub    $0x4,%esp
+  8033bd:	53                   	push   %ebx
+  8033be:	89 f0                	mov    %esi,%eax
+  8033c0:	03 45 0c             	add    0xc(%ebp),%eax
+  8033c3:	50                   	push   %eax
+  8033c4:	57                   	push   %edi
+  8033c5:	e8 bb d7 ff ff       	call   800b85 <memmove>
+    sys_cputs(buf, m);
+  8033ca:	83 c4 08             	add    $0x8,%esp
+  8033cd:	53                   	push   %ebx
+  8033ce:	57                   	push   %edi
+  8033cf:	e8 5b d9 ff ff       	call   800d2f <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  8033d4:	01 de                	add    %ebx,%esi
+  8033d6:	83 c4 10             	add    $0x10,%esp
+  8033d9:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8033dc:	72 cd                	jb     8033ab <devcons_write+0x19>
+}
+  8033de:	89 f0                	mov    %esi,%eax
+  8033e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033e3:	5b                   	pop    %ebx
+  8033e4:	5e                   	pop    %esi
+  8033e5:	5f                   	pop    %edi
+  8033e6:	5d                   	pop    %ebp
+  8033e7:	c3                   	ret
+
+008033e8 <devcons_read>:
+{
+  8033e8:	55                   	push   %ebp
+  8033e9:	89 e5                	mov    %esp,%ebp
+  8033eb:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  8033ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033f3:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8033f7:	75 07                	jne    803400 <devcons_read+0x18>
+  8033f9:	eb 1f                	jmp    80341a <devcons_read+0x32>
+    sys_yield();
+  8033fb:	e8 cc d9 ff ff       	call   800dcc <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  803400:	e8 48 d9 ff ff       	call   800d4d <sys_cgetc>
+  803405:	85 c0                	test   %eax,%eax
+  803407:	74 f2                	je     8033fb <devcons_read+0x13>
+  if (c < 0)
+  803409:	78 0f                	js     80341a <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  80340b:	83 f8 04             	cmp    $0x4,%eax
+  80340e:	74 0c                	je     80341c <devcons_read+0x34>
+  *(char*)vbuf = c;
+  803410:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803413:	88 02                	mov    %al,(%edx)
+  return 1;
+  803415:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80341a:	c9                   	leave
+  80341b:	c3                   	ret
+    return 0;
+  80341c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803421:	eb f7                	jmp    80341a <devcons_read+0x32>
+
+00803423 <cputchar>:
+{
+  803423:	55                   	push   %ebp
+  803424:	89 e5                	mov    %esp,%ebp
+  803426:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  803429:	8b 45 08             	mov    0x8(%ebp),%eax
+  80342c:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  80342f:	6a 01                	push   $0x1
+  803431:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803434:	50                   	push   %eax
+  803435:	e8 f5 d8 ff ff       	call   800d2f <sys_cputs>
+}
+  80343a:	83 c4 10             	add    $0x10,%esp
+  80343d:	c9                   	leave
+  80343e:	c3                   	ret
+
+0080343f <getchar>:
+{
+  80343f:	55                   	push   %ebp
+  803440:	89 e5                	mov    %esp,%ebp
+  803442:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  803445:	6a 01                	push   $0x1
+  803447:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80344a:	50                   	push   %eax
+  80344b:	6a 00                	push   $0x0
+  80344d:	e8 b0 e1 ff ff       	call   801602 <read>
+  if (r < 0)
+  803452:	83 c4 10             	add    $0x10,%esp
+  803455:	85 c0                	test   %eax,%eax
+  803457:	78 06                	js     80345f <getchar+0x20>
+  if (r < 1)
+  803459:	74 06                	je     803461 <getchar+0x22>
+  return c;
+  80345b:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80345f:	c9                   	leave
+  803460:	c3                   	ret
+    return -E_EOF;
+  803461:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803466:	eb f7                	jmp    80345f <getchar+0x20>
+
+00803468 <iscons>:
+{
+  803468:	55                   	push   %ebp
+  803469:	89 e5                	mov    %esp,%ebp
+  80346b:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80346e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803471:	50                   	push   %eax
+  803472:	ff 75 08             	push   0x8(%ebp)
+  803475:	e8 dd de ff ff       	call   801357 <fd_lookup>
+  80347a:	83 c4 10             	add    $0x10,%esp
+  80347d:	85 c0                	test   %eax,%eax
+  80347f:	78 11                	js     803492 <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  803481:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803484:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  80348a:	39 10                	cmp    %edx,(%eax)
+  80348c:	0f 94 c0             	sete   %al
+  80348f:	0f b6 c0             	movzbl %al,%eax
+}
+  803492:	c9                   	leave
+  803493:	c3                   	ret
+
+00803494 <opencons>:
+{
+  803494:	55                   	push   %ebp
+  803495:	89 e5                	mov    %esp,%ebp
+  803497:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  80349a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80349d:	50                   	push   %eax
+  80349e:	e8 5e de ff ff       	call   801301 <fd_alloc>
+  8034a3:	83 c4 10             	add    $0x10,%esp
+  8034a6:	85 c0                	test   %eax,%eax
+  8034a8:	78 3a                	js     8034e4 <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8034aa:	83 ec 04             	sub    $0x4,%esp
+  8034ad:	68 07 04 00 00       	push   $0x407
+  8034b2:	ff 75 f4             	push   -0xc(%ebp)
+  8034b5:	6a 00                	push   $0x0
+  8034b7:	e8 72 d9 ff ff       	call   800e2e <sys_page_alloc>
+  8034bc:	83 c4 10             	add    $0x10,%esp
+  8034bf:	85 c0                	test   %eax,%eax
+  8034c1:	78 21                	js     8034e4 <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  8034c3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8034c6:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  8034cc:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  8034ce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8034d1:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  8034d8:	83 ec 0c             	sub    $0xc,%esp
+  8034db:	50                   	push   %eax
+  8034dc:	e8 fc dd ff ff       	call   8012dd <fd2num>
+  8034e1:	83 c4 10             	add    $0x10,%esp
+}
+  8034e4:	c9                   	leave
+  8034e5:	c3                   	ret
+
+008034e6 <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  8034e6:	55                   	push   %ebp
+  8034e7:	89 e5                	mov    %esp,%ebp
+  8034e9:	57                   	push   %edi
+  8034ea:	56                   	push   %esi
+  8034eb:	53                   	push   %ebx
+  8034ec:	83 ec 14             	sub    $0x14,%esp
+  8034ef:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8034f2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8034f5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8034f8:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  8034fb:	85 c0                	test   %eax,%eax
+  8034fd:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803502:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  803505:	ff 33                	push   (%ebx)
+  803507:	50                   	push   %eax
+  803508:	e8 f9 db ff ff       	call   801106 <sys_ipc_recv>
+  80350d:	83 c4 10             	add    $0x10,%esp
+  803510:	85 c0                	test   %eax,%eax
+  803512:	78 39                	js     80354d <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  803514:	85 ff                	test   %edi,%edi
+  803516:	74 0a                	je     803522 <ipc_recv_pages+0x3c>
+  803518:	a1 64 5e 80 00       	mov    0x805e64,%eax
+  80351d:	8b 40 7c             	mov    0x7c(%eax),%eax
+  803520:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803522:	85 f6                	test   %esi,%esi
+  803524:	74 0d                	je     803533 <ipc_recv_pages+0x4d>
+  803526:	a1 64 5e 80 00       	mov    0x805e64,%eax
+  80352b:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  803531:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  803533:	a1 64 5e 80 00       	mov    0x805e64,%eax
+  803538:	8b 40 74             	mov    0x74(%eax),%eax
+  80353b:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  80353d:	a1 64 5e 80 00       	mov    0x805e64,%eax
+  803542:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  803545:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803548:	5b                   	pop    %ebx
+  803549:	5e                   	pop    %esi
+  80354a:	5f                   	pop    %edi
+  80354b:	5d                   	pop    %ebp
+  80354c:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  80354d:	85 ff                	test   %edi,%edi
+  80354f:	74 06                	je     803557 <ipc_recv_pages+0x71>
+  803551:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  803557:	85 f6                	test   %esi,%esi
+  803559:	74 06                	je     803561 <ipc_recv_pages+0x7b>
+  80355b:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  803561:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  803567:	eb dc                	jmp    803545 <ipc_recv_pages+0x5f>
+
+00803569 <ipc_recv>:
+{
+  803569:	55                   	push   %ebp
+  80356a:	89 e5                	mov    %esp,%ebp
+  80356c:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  80356f:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  803576:	ff 75 10             	push   0x10(%ebp)
+  803579:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80357c:	50                   	push   %eax
+  80357d:	ff 75 0c             	push   0xc(%ebp)
+  803580:	ff 75 08             	push   0x8(%ebp)
+  803583:	e8 5e ff ff ff       	call   8034e6 <ipc_recv_pages>
+}
+  803588:	c9                   	leave
+  803589:	c3                   	ret
+
+0080358a <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  80358a:	55                   	push   %ebp
+  80358b:	89 e5                	mov    %esp,%ebp
+  80358d:	57                   	push   %edi
+  80358e:	56                   	push   %esi
+  80358f:	53                   	push   %ebx
+  803590:	83 ec 0c             	sub    $0xc,%esp
+  803593:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803596:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803599:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  80359c:	89 c3                	mov    %eax,%ebx
+  80359e:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  8035a4:	85 c0                	test   %eax,%eax
+  8035a6:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8035ab:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  8035ae:	83 ec 0c             	sub    $0xc,%esp
+  8035b1:	ff 75 14             	push   0x14(%ebp)
+  8035b4:	ff 75 18             	push   0x18(%ebp)
+  8035b7:	53                   	push   %ebx
+  8035b8:	56                   	push   %esi
+  8035b9:	57                   	push   %edi
+  8035ba:	e8 26 db ff ff       	call   8010e5 <sys_ipc_try_send>
+  8035bf:	83 c4 20             	add    $0x20,%esp
+  8035c2:	85 c0                	test   %eax,%eax
+  8035c4:	79 1e                	jns    8035e4 <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  8035c6:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8035c9:	75 07                	jne    8035d2 <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  8035cb:	e8 fc d7 ff ff       	call   800dcc <sys_yield>
+  8035d0:	eb dc                	jmp    8035ae <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  8035d2:	50                   	push   %eax
+  8035d3:	68 27 3f 80 00       	push   $0x803f27
+  8035d8:	6a 5c                	push   $0x5c
+  8035da:	68 34 3f 80 00       	push   $0x803f34
+  8035df:	e8 52 cd ff ff       	call   800336 <_panic>
+  }
+}
+  8035e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8035e7:	5b                   	pop    %ebx
+  8035e8:	5e                   	pop    %esi
+  8035e9:	5f                   	pop    %edi
+  8035ea:	5d                   	pop    %ebp
+  8035eb:	c3                   	ret
+
+008035ec <ipc_send>:
+{
+  8035ec:	55                   	push   %ebp
+  8035ed:	89 e5                	mov    %esp,%ebp
+  8035ef:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  8035f2:	ff 75 14             	push   0x14(%ebp)
+  8035f5:	6a 01                	push   $0x1
+  8035f7:	ff 75 10             	push   0x10(%ebp)
+  8035fa:	ff 75 0c             	push   0xc(%ebp)
+  8035fd:	ff 75 08             	push   0x8(%ebp)
+  803600:	e8 85 ff ff ff       	call   80358a <ipc_send_pages>
+}
+  803605:	83 c4 20             	add    $0x20,%esp
+  803608:	c9                   	leave
+  803609:	c3                   	ret
+
+0080360a <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80360a:	55                   	push   %ebp
+  80360b:	89 e5                	mov    %esp,%ebp
+  80360d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  803610:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  803615:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803618:	c1 e0 04             	shl    $0x4,%eax
+  80361b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803620:	8b 40 50             	mov    0x50(%eax),%eax
+  803623:	39 c8                	cmp    %ecx,%eax
+  803625:	74 12                	je     803639 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  803627:	83 c2 01             	add    $0x1,%edx
+  80362a:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  803630:	75 e3                	jne    803615 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  803632:	b8 00 00 00 00       	mov    $0x0,%eax
+  803637:	eb 0e                	jmp    803647 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  803639:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80363c:	c1 e0 04             	shl    $0x4,%eax
+  80363f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803644:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803647:	5d                   	pop    %ebp
+  803648:	c3                   	ret
+
+00803649 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803649:	55                   	push   %ebp
+  80364a:	89 e5                	mov    %esp,%ebp
+  80364c:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  80364f:	89 c2                	mov    %eax,%edx
+  803651:	c1 ea 16             	shr    $0x16,%edx
+  803654:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  80365b:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  803660:	f6 c1 01             	test   $0x1,%cl
+  803663:	74 1c                	je     803681 <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  803665:	c1 e8 0c             	shr    $0xc,%eax
+  803668:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  80366f:	a8 01                	test   $0x1,%al
+  803671:	74 0e                	je     803681 <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  803673:	c1 e8 0c             	shr    $0xc,%eax
+  803676:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  80367d:	ef 
+  80367e:	0f b7 d2             	movzwl %dx,%edx
+}
+  803681:	89 d0                	mov    %edx,%eax
+  803683:	5d                   	pop    %ebp
+  803684:	c3                   	ret
+
+00803685 <udivmod>:
+  803685:	55                   	push   %ebp
+  803686:	57                   	push   %edi
+  803687:	56                   	push   %esi
+  803688:	53                   	push   %ebx
+  803689:	83 ec 14             	sub    $0x14,%esp
+  80368c:	8b 74 24 28          	mov    0x28(%esp),%esi
+  803690:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  803694:	89 fb                	mov    %edi,%ebx
+  803696:	09 f3                	or     %esi,%ebx
+  803698:	0f 84 88 00 00 00    	je     803726 <udivmod+0xa1>
+  80369e:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8036a3:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8036aa:	00 
+  8036ab:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8036b2:	00 
+  8036b3:	89 cd                	mov    %ecx,%ebp
+  8036b5:	89 34 24             	mov    %esi,(%esp)
+  8036b8:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  8036bc:	eb 08                	jmp    8036c6 <udivmod+0x41>
+  8036be:	83 ed 01             	sub    $0x1,%ebp
+  8036c1:	83 fd ff             	cmp    $0xffffffff,%ebp
+  8036c4:	74 6c                	je     803732 <udivmod+0xad>
+  8036c6:	89 c3                	mov    %eax,%ebx
+  8036c8:	89 d6                	mov    %edx,%esi
+  8036ca:	89 e9                	mov    %ebp,%ecx
+  8036cc:	0f ad f3             	shrd   %cl,%esi,%ebx
+  8036cf:	d3 ee                	shr    %cl,%esi
+  8036d1:	f6 c1 20             	test   $0x20,%cl
+  8036d4:	74 04                	je     8036da <udivmod+0x55>
+  8036d6:	89 f3                	mov    %esi,%ebx
+  8036d8:	31 f6                	xor    %esi,%esi
+  8036da:	8b 3c 24             	mov    (%esp),%edi
+  8036dd:	39 fb                	cmp    %edi,%ebx
+  8036df:	89 f7                	mov    %esi,%edi
+  8036e1:	8b 1c 24             	mov    (%esp),%ebx
+  8036e4:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8036e8:	19 f7                	sbb    %esi,%edi
+  8036ea:	72 d2                	jb     8036be <udivmod+0x39>
+  8036ec:	89 f7                	mov    %esi,%edi
+  8036ee:	89 de                	mov    %ebx,%esi
+  8036f0:	89 e9                	mov    %ebp,%ecx
+  8036f2:	0f a5 f7             	shld   %cl,%esi,%edi
+  8036f5:	d3 e6                	shl    %cl,%esi
+  8036f7:	f6 c1 20             	test   $0x20,%cl
+  8036fa:	74 04                	je     803700 <udivmod+0x7b>
+  8036fc:	89 f7                	mov    %esi,%edi
+  8036fe:	31 f6                	xor    %esi,%esi
+  803700:	29 f0                	sub    %esi,%eax
+  803702:	19 fa                	sbb    %edi,%edx
+  803704:	be 01 00 00 00       	mov    $0x1,%esi
+  803709:	bf 00 00 00 00       	mov    $0x0,%edi
+  80370e:	0f a5 f7             	shld   %cl,%esi,%edi
+  803711:	d3 e6                	shl    %cl,%esi
+  803713:	f6 c1 20             	test   $0x20,%cl
+  803716:	74 04                	je     80371c <udivmod+0x97>
+  803718:	89 f7                	mov    %esi,%edi
+  80371a:	31 f6                	xor    %esi,%esi
+  80371c:	09 74 24 08          	or     %esi,0x8(%esp)
+  803720:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  803724:	eb 98                	jmp    8036be <udivmod+0x39>
+  803726:	89 f0                	mov    %esi,%eax
+  803728:	89 fa                	mov    %edi,%edx
+  80372a:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80372e:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  803732:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  803736:	89 01                	mov    %eax,(%ecx)
+  803738:	89 51 04             	mov    %edx,0x4(%ecx)
+  80373b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80373f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803743:	83 c4 14             	add    $0x14,%esp
+  803746:	5b                   	pop    %ebx
+  803747:	5e                   	pop    %esi
+  803748:	5f                   	pop    %edi
+  803749:	5d                   	pop    %ebp
+  80374a:	c3                   	ret
+
+0080374b <__udivdi3>:
+  80374b:	83 ec 18             	sub    $0x18,%esp
+  80374e:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803752:	50                   	push   %eax
+  803753:	ff 74 24 2c          	push   0x2c(%esp)
+  803757:	ff 74 24 2c          	push   0x2c(%esp)
+  80375b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80375f:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803763:	e8 1d ff ff ff       	call   803685 <udivmod>
+  803768:	83 c4 24             	add    $0x24,%esp
+  80376b:	c3                   	ret
+
+0080376c <__umoddi3>:
+  80376c:	83 ec 18             	sub    $0x18,%esp
+  80376f:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803773:	50                   	push   %eax
+  803774:	ff 74 24 2c          	push   0x2c(%esp)
+  803778:	ff 74 24 2c          	push   0x2c(%esp)
+  80377c:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803780:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803784:	e8 fc fe ff ff       	call   803685 <udivmod>
+  803789:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80378d:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803791:	83 c4 24             	add    $0x24,%esp
+  803794:	c3                   	ret
+
+00803795 <__divdi3>:
+  803795:	56                   	push   %esi
+  803796:	53                   	push   %ebx
+  803797:	83 ec 14             	sub    $0x14,%esp
+  80379a:	8b 44 24 20          	mov    0x20(%esp),%eax
+  80379e:	8b 54 24 24          	mov    0x24(%esp),%edx
+  8037a2:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  8037a6:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  8037aa:	85 d2                	test   %edx,%edx
+  8037ac:	78 18                	js     8037c6 <__divdi3+0x31>
+  8037ae:	85 db                	test   %ebx,%ebx
+  8037b0:	78 3e                	js     8037f0 <__divdi3+0x5b>
+  8037b2:	83 ec 04             	sub    $0x4,%esp
+  8037b5:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8037b9:	56                   	push   %esi
+  8037ba:	53                   	push   %ebx
+  8037bb:	51                   	push   %ecx
+  8037bc:	e8 c4 fe ff ff       	call   803685 <udivmod>
+  8037c1:	83 c4 10             	add    $0x10,%esp
+  8037c4:	eb 24                	jmp    8037ea <__divdi3+0x55>
+  8037c6:	f7 d8                	neg    %eax
+  8037c8:	83 d2 00             	adc    $0x0,%edx
+  8037cb:	f7 da                	neg    %edx
+  8037cd:	85 db                	test   %ebx,%ebx
+  8037cf:	78 3a                	js     80380b <__divdi3+0x76>
+  8037d1:	83 ec 04             	sub    $0x4,%esp
+  8037d4:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8037d8:	56                   	push   %esi
+  8037d9:	53                   	push   %ebx
+  8037da:	51                   	push   %ecx
+  8037db:	e8 a5 fe ff ff       	call   803685 <udivmod>
+  8037e0:	83 c4 10             	add    $0x10,%esp
+  8037e3:	f7 d8                	neg    %eax
+  8037e5:	83 d2 00             	adc    $0x0,%edx
+  8037e8:	f7 da                	neg    %edx
+  8037ea:	83 c4 14             	add    $0x14,%esp
+  8037ed:	5b                   	pop    %ebx
+  8037ee:	5e                   	pop    %esi
+  8037ef:	c3                   	ret
+  8037f0:	83 ec 04             	sub    $0x4,%esp
+  8037f3:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8037f7:	56                   	push   %esi
+  8037f8:	f7 d9                	neg    %ecx
+  8037fa:	83 d3 00             	adc    $0x0,%ebx
+  8037fd:	f7 db                	neg    %ebx
+  8037ff:	53                   	push   %ebx
+  803800:	51                   	push   %ecx
+  803801:	e8 7f fe ff ff       	call   803685 <udivmod>
+  803806:	83 c4 10             	add    $0x10,%esp
+  803809:	eb d8                	jmp    8037e3 <__divdi3+0x4e>
+  80380b:	83 ec 04             	sub    $0x4,%esp
+  80380e:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803812:	56                   	push   %esi
+  803813:	f7 d9                	neg    %ecx
+  803815:	83 d3 00             	adc    $0x0,%ebx
+  803818:	f7 db                	neg    %ebx
+  80381a:	53                   	push   %ebx
+  80381b:	51                   	push   %ecx
+  80381c:	e8 64 fe ff ff       	call   803685 <udivmod>
+  803821:	83 c4 10             	add    $0x10,%esp
+  803824:	eb c4                	jmp    8037ea <__divdi3+0x55>
+
+00803826 <__moddi3>:
+  803826:	55                   	push   %ebp
+  803827:	57                   	push   %edi
+  803828:	56                   	push   %esi
+  803829:	53                   	push   %ebx
+  80382a:	83 ec 24             	sub    $0x24,%esp
+  80382d:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803831:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803835:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  803839:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  80383d:	85 d2                	test   %edx,%edx
+  80383f:	78 3b                	js     80387c <__moddi3+0x56>
+  803841:	83 ec 04             	sub    $0x4,%esp
+  803844:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803848:	56                   	push   %esi
+  803849:	89 ce                	mov    %ecx,%esi
+  80384b:	f7 de                	neg    %esi
+  80384d:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803851:	89 de                	mov    %ebx,%esi
+  803853:	83 d6 00             	adc    $0x0,%esi
+  803856:	f7 de                	neg    %esi
+  803858:	89 74 24 14          	mov    %esi,0x14(%esp)
+  80385c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  803860:	0f 48 f1             	cmovs  %ecx,%esi
+  803863:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  803868:	53                   	push   %ebx
+  803869:	56                   	push   %esi
+  80386a:	e8 16 fe ff ff       	call   803685 <udivmod>
+  80386f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803873:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803877:	83 c4 10             	add    $0x10,%esp
+  80387a:	eb 47                	jmp    8038c3 <__moddi3+0x9d>
+  80387c:	f7 d8                	neg    %eax
+  80387e:	83 d2 00             	adc    $0x0,%edx
+  803881:	f7 da                	neg    %edx
+  803883:	83 ec 04             	sub    $0x4,%esp
+  803886:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  80388a:	56                   	push   %esi
+  80388b:	89 cf                	mov    %ecx,%edi
+  80388d:	f7 df                	neg    %edi
+  80388f:	89 de                	mov    %ebx,%esi
+  803891:	83 d6 00             	adc    $0x0,%esi
+  803894:	f7 de                	neg    %esi
+  803896:	0f 49 cf             	cmovns %edi,%ecx
+  803899:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  80389d:	0f 49 de             	cmovns %esi,%ebx
+  8038a0:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  8038a4:	ff 74 24 0c          	push   0xc(%esp)
+  8038a8:	ff 74 24 0c          	push   0xc(%esp)
+  8038ac:	e8 d4 fd ff ff       	call   803685 <udivmod>
+  8038b1:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8038b5:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8038b9:	f7 d8                	neg    %eax
+  8038bb:	83 d2 00             	adc    $0x0,%edx
+  8038be:	f7 da                	neg    %edx
+  8038c0:	83 c4 10             	add    $0x10,%esp
+  8038c3:	83 c4 24             	add    $0x24,%esp
+  8038c6:	5b                   	pop    %ebx
+  8038c7:	5e                   	pop    %esi
+  8038c8:	5f                   	pop    %edi
+  8038c9:	5d                   	pop    %ebp
+  8038ca:	c3                   	ret
@@ -0,0 +1,7051 @@
+
+obj/user/ls.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 9b 02 00 00       	call   8002cc <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <ls1>:
+    panic("error reading directory %s: %e", path, n);
+}
+
+void
+ls1(const char *prefix, bool isdir, off_t size, const char *name)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80003b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  const char *sep;
+
+  if (flag['l'])
+  80003e:	83 3d 10 59 80 00 00 	cmpl   $0x0,0x805910
+  800045:	74 20                	je     800067 <ls1+0x34>
+    printf("%11d %c ", size, isdir ? 'd' : '-');
+  800047:	89 f0                	mov    %esi,%eax
+  800049:	3c 01                	cmp    $0x1,%al
+  80004b:	19 c0                	sbb    %eax,%eax
+  80004d:	83 e0 c9             	and    $0xffffffc9,%eax
+  800050:	83 c0 64             	add    $0x64,%eax
+  800053:	83 ec 04             	sub    $0x4,%esp
+  800056:	50                   	push   %eax
+  800057:	ff 75 10             	push   0x10(%ebp)
+  80005a:	68 42 33 80 00       	push   $0x803342
+  80005f:	e8 fa 24 00 00       	call   80255e <printf>
+  800064:	83 c4 10             	add    $0x10,%esp
+  if (prefix) {
+  800067:	85 db                	test   %ebx,%ebx
+  800069:	74 1c                	je     800087 <ls1+0x54>
+    if (prefix[0] && prefix[strlen(prefix)-1] != '/')
+      sep = "/";
+    else
+      sep = "";
+  80006b:	b8 a8 33 80 00       	mov    $0x8033a8,%eax
+    if (prefix[0] && prefix[strlen(prefix)-1] != '/')
+  800070:	80 3b 00             	cmpb   $0x0,(%ebx)
+  800073:	75 4b                	jne    8000c0 <ls1+0x8d>
+    printf("%s%s", prefix, sep);
+  800075:	83 ec 04             	sub    $0x4,%esp
+  800078:	50                   	push   %eax
+  800079:	53                   	push   %ebx
+  80007a:	68 4b 33 80 00       	push   $0x80334b
+  80007f:	e8 da 24 00 00       	call   80255e <printf>
+  800084:	83 c4 10             	add    $0x10,%esp
+  }
+  printf("%s", name);
+  800087:	83 ec 08             	sub    $0x8,%esp
+  80008a:	ff 75 14             	push   0x14(%ebp)
+  80008d:	68 ea 37 80 00       	push   $0x8037ea
+  800092:	e8 c7 24 00 00       	call   80255e <printf>
+  if (flag['F'] && isdir)
+  800097:	83 c4 10             	add    $0x10,%esp
+  80009a:	83 3d 78 58 80 00 00 	cmpl   $0x0,0x805878
+  8000a1:	74 06                	je     8000a9 <ls1+0x76>
+  8000a3:	89 f0                	mov    %esi,%eax
+  8000a5:	84 c0                	test   %al,%al
+  8000a7:	75 37                	jne    8000e0 <ls1+0xad>
+    printf("/");
+  printf("\n");
+  8000a9:	83 ec 0c             	sub    $0xc,%esp
+  8000ac:	68 a7 33 80 00       	push   $0x8033a7
+  8000b1:	e8 a8 24 00 00       	call   80255e <printf>
+}
+  8000b6:	83 c4 10             	add    $0x10,%esp
+  8000b9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000bc:	5b                   	pop    %ebx
+  8000bd:	5e                   	pop    %esi
+  8000be:	5d                   	pop    %ebp
+  8000bf:	c3                   	ret
+    if (prefix[0] && prefix[strlen(prefix)-1] != '/')
+  8000c0:	83 ec 0c             	sub    $0xc,%esp
+  8000c3:	53                   	push   %ebx
+  8000c4:	e8 fe 08 00 00       	call   8009c7 <strlen>
+  8000c9:	83 c4 10             	add    $0x10,%esp
+      sep = "/";
+  8000cc:	80 7c 03 ff 2f       	cmpb   $0x2f,-0x1(%ebx,%eax,1)
+  8000d1:	b8 a8 33 80 00       	mov    $0x8033a8,%eax
+  8000d6:	ba 40 33 80 00       	mov    $0x803340,%edx
+  8000db:	0f 45 c2             	cmovne %edx,%eax
+  8000de:	eb 95                	jmp    800075 <ls1+0x42>
+    printf("/");
+  8000e0:	83 ec 0c             	sub    $0xc,%esp
+  8000e3:	68 40 33 80 00       	push   $0x803340
+  8000e8:	e8 71 24 00 00       	call   80255e <printf>
+  8000ed:	83 c4 10             	add    $0x10,%esp
+  8000f0:	eb b7                	jmp    8000a9 <ls1+0x76>
+
+008000f2 <lsdir>:
+{
+  8000f2:	55                   	push   %ebp
+  8000f3:	89 e5                	mov    %esp,%ebp
+  8000f5:	57                   	push   %edi
+  8000f6:	56                   	push   %esi
+  8000f7:	53                   	push   %ebx
+  8000f8:	81 ec 14 01 00 00    	sub    $0x114,%esp
+  8000fe:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((fd = open(path, O_RDONLY)) < 0)
+  800101:	6a 00                	push   $0x0
+  800103:	57                   	push   %edi
+  800104:	e8 76 1e 00 00       	call   801f7f <open>
+  800109:	89 c3                	mov    %eax,%ebx
+  80010b:	83 c4 10             	add    $0x10,%esp
+  80010e:	85 c0                	test   %eax,%eax
+  800110:	78 50                	js     800162 <lsdir+0x70>
+  while ((n = readn(fd, &f, sizeof f)) == sizeof f)
+  800112:	8d b5 e8 fe ff ff    	lea    -0x118(%ebp),%esi
+  800118:	83 ec 04             	sub    $0x4,%esp
+  80011b:	68 00 01 00 00       	push   $0x100
+  800120:	56                   	push   %esi
+  800121:	53                   	push   %ebx
+  800122:	e8 b4 16 00 00       	call   8017db <readn>
+  800127:	83 c4 10             	add    $0x10,%esp
+  80012a:	3d 00 01 00 00       	cmp    $0x100,%eax
+  80012f:	75 47                	jne    800178 <lsdir+0x86>
+    if (f.f_name[0])
+  800131:	80 bd e8 fe ff ff 00 	cmpb   $0x0,-0x118(%ebp)
+  800138:	74 de                	je     800118 <lsdir+0x26>
+      ls1(prefix, f.f_type == FTYPE_DIR, f.f_size, f.f_name);
+  80013a:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  800140:	50                   	push   %eax
+  800141:	ff b5 68 ff ff ff    	push   -0x98(%ebp)
+  800147:	83 bd 6c ff ff ff 01 	cmpl   $0x1,-0x94(%ebp)
+  80014e:	0f 94 c0             	sete   %al
+  800151:	0f b6 c0             	movzbl %al,%eax
+  800154:	50                   	push   %eax
+  800155:	ff 75 0c             	push   0xc(%ebp)
+  800158:	e8 d6 fe ff ff       	call   800033 <ls1>
+  80015d:	83 c4 10             	add    $0x10,%esp
+  800160:	eb b6                	jmp    800118 <lsdir+0x26>
+    panic("open %s: %e", path, fd);
+  800162:	83 ec 0c             	sub    $0xc,%esp
+  800165:	50                   	push   %eax
+  800166:	57                   	push   %edi
+  800167:	68 50 33 80 00       	push   $0x803350
+  80016c:	6a 1d                	push   $0x1d
+  80016e:	68 5c 33 80 00       	push   $0x80335c
+  800173:	e8 c1 01 00 00       	call   800339 <_panic>
+  if (n > 0)
+  800178:	85 c0                	test   %eax,%eax
+  80017a:	7f 0a                	jg     800186 <lsdir+0x94>
+  if (n < 0)
+  80017c:	78 1a                	js     800198 <lsdir+0xa6>
+}
+  80017e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800181:	5b                   	pop    %ebx
+  800182:	5e                   	pop    %esi
+  800183:	5f                   	pop    %edi
+  800184:	5d                   	pop    %ebp
+  800185:	c3                   	ret
+    panic("short read in directory %s", path);
+  800186:	57                   	push   %edi
+  800187:	68 66 33 80 00       	push   $0x803366
+  80018c:	6a 22                	push   $0x22
+  80018e:	68 5c 33 80 00       	push   $0x80335c
+  800193:	e8 a1 01 00 00       	call   800339 <_panic>
+    panic("error reading directory %s: %e", path, n);
+  800198:	83 ec 0c             	sub    $0xc,%esp
+  80019b:	50                   	push   %eax
+  80019c:	57                   	push   %edi
+  80019d:	68 ac 33 80 00       	push   $0x8033ac
+  8001a2:	6a 24                	push   $0x24
+  8001a4:	68 5c 33 80 00       	push   $0x80335c
+  8001a9:	e8 8b 01 00 00       	call   800339 <_panic>
+
+008001ae <ls>:
+{
+  8001ae:	55                   	push   %ebp
+  8001af:	89 e5                	mov    %esp,%ebp
+  8001b1:	53                   	push   %ebx
+  8001b2:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  8001b8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if ((r = stat(path, &st)) < 0)
+  8001bb:	8d 85 6c ff ff ff    	lea    -0x94(%ebp),%eax
+  8001c1:	50                   	push   %eax
+  8001c2:	53                   	push   %ebx
+  8001c3:	e8 f9 17 00 00       	call   8019c1 <stat>
+  8001c8:	83 c4 10             	add    $0x10,%esp
+  8001cb:	85 c0                	test   %eax,%eax
+  8001cd:	78 2c                	js     8001fb <ls+0x4d>
+  if (st.st_isdir && !flag['d'])
+  8001cf:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  8001d2:	85 c0                	test   %eax,%eax
+  8001d4:	74 09                	je     8001df <ls+0x31>
+  8001d6:	83 3d f0 58 80 00 00 	cmpl   $0x0,0x8058f0
+  8001dd:	74 32                	je     800211 <ls+0x63>
+    ls1(0, st.st_isdir, st.st_size, path);
+  8001df:	53                   	push   %ebx
+  8001e0:	ff 75 ec             	push   -0x14(%ebp)
+  8001e3:	85 c0                	test   %eax,%eax
+  8001e5:	0f 95 c0             	setne  %al
+  8001e8:	0f b6 c0             	movzbl %al,%eax
+  8001eb:	50                   	push   %eax
+  8001ec:	6a 00                	push   $0x0
+  8001ee:	e8 40 fe ff ff       	call   800033 <ls1>
+  8001f3:	83 c4 10             	add    $0x10,%esp
+}
+  8001f6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001f9:	c9                   	leave
+  8001fa:	c3                   	ret
+    panic("stat %s: %e", path, r);
+  8001fb:	83 ec 0c             	sub    $0xc,%esp
+  8001fe:	50                   	push   %eax
+  8001ff:	53                   	push   %ebx
+  800200:	68 81 33 80 00       	push   $0x803381
+  800205:	6a 0f                	push   $0xf
+  800207:	68 5c 33 80 00       	push   $0x80335c
+  80020c:	e8 28 01 00 00       	call   800339 <_panic>
+    lsdir(path, prefix);
+  800211:	83 ec 08             	sub    $0x8,%esp
+  800214:	ff 75 0c             	push   0xc(%ebp)
+  800217:	53                   	push   %ebx
+  800218:	e8 d5 fe ff ff       	call   8000f2 <lsdir>
+  80021d:	83 c4 10             	add    $0x10,%esp
+  800220:	eb d4                	jmp    8001f6 <ls+0x48>
+
+00800222 <usage>:
+
+void
+usage(void)
+{
+  800222:	55                   	push   %ebp
+  800223:	89 e5                	mov    %esp,%ebp
+  800225:	83 ec 14             	sub    $0x14,%esp
+  printf("usage: ls [-dFl] [file...]\n");
+  800228:	68 8d 33 80 00       	push   $0x80338d
+  80022d:	e8 2c 23 00 00       	call   80255e <printf>
+  exit();
+  800232:	e8 e8 00 00 00       	call   80031f <exit>
+}
+  800237:	83 c4 10             	add    $0x10,%esp
+  80023a:	c9                   	leave
+  80023b:	c3                   	ret
+
+0080023c <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  80023c:	55                   	push   %ebp
+  80023d:	89 e5                	mov    %esp,%ebp
+  80023f:	56                   	push   %esi
+  800240:	53                   	push   %ebx
+  800241:	83 ec 14             	sub    $0x14,%esp
+  800244:	8b 75 0c             	mov    0xc(%ebp),%esi
+  int i;
+  struct Argstate args;
+
+  argstart(&argc, argv, &args);
+  800247:	8d 45 e8             	lea    -0x18(%ebp),%eax
+  80024a:	50                   	push   %eax
+  80024b:	56                   	push   %esi
+  80024c:	8d 45 08             	lea    0x8(%ebp),%eax
+  80024f:	50                   	push   %eax
+  800250:	e8 8b 10 00 00       	call   8012e0 <argstart>
+  while ((i = argnext(&args)) >= 0)
+  800255:	83 c4 10             	add    $0x10,%esp
+  800258:	8d 5d e8             	lea    -0x18(%ebp),%ebx
+  80025b:	eb 08                	jmp    800265 <umain+0x29>
+    switch (i) {
+    case 'd':
+    case 'F':
+    case 'l':
+      flag[i]++;
+  80025d:	83 04 85 60 57 80 00 	addl   $0x1,0x805760(,%eax,4)
+  800264:	01 
+  while ((i = argnext(&args)) >= 0)
+  800265:	83 ec 0c             	sub    $0xc,%esp
+  800268:	53                   	push   %ebx
+  800269:	e8 a2 10 00 00       	call   801310 <argnext>
+  80026e:	83 c4 10             	add    $0x10,%esp
+  800271:	85 c0                	test   %eax,%eax
+  800273:	78 16                	js     80028b <umain+0x4f>
+    switch (i) {
+  800275:	89 c2                	mov    %eax,%edx
+  800277:	83 e2 f7             	and    $0xfffffff7,%edx
+  80027a:	83 fa 64             	cmp    $0x64,%edx
+  80027d:	74 de                	je     80025d <umain+0x21>
+  80027f:	83 f8 46             	cmp    $0x46,%eax
+  800282:	74 d9                	je     80025d <umain+0x21>
+      break;
+    default:
+      usage();
+  800284:	e8 99 ff ff ff       	call   800222 <usage>
+  800289:	eb da                	jmp    800265 <umain+0x29>
+    }
+
+  if (argc == 1)
+    ls("/", "");
+  else
+    for (i = 1; i < argc; i++)
+  80028b:	bb 01 00 00 00       	mov    $0x1,%ebx
+  if (argc == 1)
+  800290:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+  800294:	75 2a                	jne    8002c0 <umain+0x84>
+    ls("/", "");
+  800296:	83 ec 08             	sub    $0x8,%esp
+  800299:	68 a8 33 80 00       	push   $0x8033a8
+  80029e:	68 40 33 80 00       	push   $0x803340
+  8002a3:	e8 06 ff ff ff       	call   8001ae <ls>
+  8002a8:	83 c4 10             	add    $0x10,%esp
+  8002ab:	eb 18                	jmp    8002c5 <umain+0x89>
+      ls(argv[i], argv[i]);
+  8002ad:	8b 04 9e             	mov    (%esi,%ebx,4),%eax
+  8002b0:	83 ec 08             	sub    $0x8,%esp
+  8002b3:	50                   	push   %eax
+  8002b4:	50                   	push   %eax
+  8002b5:	e8 f4 fe ff ff       	call   8001ae <ls>
+    for (i = 1; i < argc; i++)
+  8002ba:	83 c3 01             	add    $0x1,%ebx
+  8002bd:	83 c4 10             	add    $0x10,%esp
+  8002c0:	39 5d 08             	cmp    %ebx,0x8(%ebp)
+  8002c3:	7f e8                	jg     8002ad <umain+0x71>
+}
+  8002c5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8002c8:	5b                   	pop    %ebx
+  8002c9:	5e                   	pop    %esi
+  8002ca:	5d                   	pop    %ebp
+  8002cb:	c3                   	ret
+
+008002cc <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8002cc:	55                   	push   %ebp
+  8002cd:	89 e5                	mov    %esp,%ebp
+  8002cf:	56                   	push   %esi
+  8002d0:	53                   	push   %ebx
+  8002d1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8002d4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  8002d7:	c7 05 60 5b 80 00 00 	movl   $0x0,0x805b60
+  8002de:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  8002e1:	e8 ca 0a 00 00       	call   800db0 <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  8002e6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8002eb:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8002ee:	c1 e0 04             	shl    $0x4,%eax
+  8002f1:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8002f6:	a3 60 5b 80 00       	mov    %eax,0x805b60
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8002fb:	85 db                	test   %ebx,%ebx
+  8002fd:	7e 07                	jle    800306 <libmain+0x3a>
+    binaryname = argv[0];
+  8002ff:	8b 06                	mov    (%esi),%eax
+  800301:	a3 00 40 80 00       	mov    %eax,0x804000
+
+  // call user main routine
+  umain(argc, argv);
+  800306:	83 ec 08             	sub    $0x8,%esp
+  800309:	56                   	push   %esi
+  80030a:	53                   	push   %ebx
+  80030b:	e8 2c ff ff ff       	call   80023c <umain>
+
+  // exit gracefully
+  exit();
+  800310:	e8 0a 00 00 00       	call   80031f <exit>
+}
+  800315:	83 c4 10             	add    $0x10,%esp
+  800318:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80031b:	5b                   	pop    %ebx
+  80031c:	5e                   	pop    %esi
+  80031d:	5d                   	pop    %ebp
+  80031e:	c3                   	ret
+
+0080031f <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80031f:	55                   	push   %ebp
+  800320:	89 e5                	mov    %esp,%ebp
+  800322:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  800325:	e8 cf 12 00 00       	call   8015f9 <close_all>
+  sys_env_destroy(0);
+  80032a:	83 ec 0c             	sub    $0xc,%esp
+  80032d:	6a 00                	push   $0x0
+  80032f:	e8 3b 0a 00 00       	call   800d6f <sys_env_destroy>
+}
+  800334:	83 c4 10             	add    $0x10,%esp
+  800337:	c9                   	leave
+  800338:	c3                   	ret
+
+00800339 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800339:	55                   	push   %ebp
+  80033a:	89 e5                	mov    %esp,%ebp
+  80033c:	56                   	push   %esi
+  80033d:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  80033e:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  800341:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  800347:	e8 64 0a 00 00       	call   800db0 <sys_getenvid>
+  80034c:	83 ec 0c             	sub    $0xc,%esp
+  80034f:	ff 75 0c             	push   0xc(%ebp)
+  800352:	ff 75 08             	push   0x8(%ebp)
+  800355:	56                   	push   %esi
+  800356:	50                   	push   %eax
+  800357:	68 d8 33 80 00       	push   $0x8033d8
+  80035c:	e8 b3 00 00 00       	call   800414 <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  800361:	83 c4 18             	add    $0x18,%esp
+  800364:	53                   	push   %ebx
+  800365:	ff 75 10             	push   0x10(%ebp)
+  800368:	e8 56 00 00 00       	call   8003c3 <vcprintf>
+  cprintf("\n");
+  80036d:	c7 04 24 a7 33 80 00 	movl   $0x8033a7,(%esp)
+  800374:	e8 9b 00 00 00       	call   800414 <cprintf>
+  800379:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  80037c:	cc                   	int3
+  while (1)
+  80037d:	eb fd                	jmp    80037c <_panic+0x43>
+
+0080037f <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80037f:	55                   	push   %ebp
+  800380:	89 e5                	mov    %esp,%ebp
+  800382:	53                   	push   %ebx
+  800383:	83 ec 04             	sub    $0x4,%esp
+  800386:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  800389:	8b 13                	mov    (%ebx),%edx
+  80038b:	8d 42 01             	lea    0x1(%edx),%eax
+  80038e:	89 03                	mov    %eax,(%ebx)
+  800390:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800393:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  800397:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80039c:	74 09                	je     8003a7 <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  80039e:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8003a2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8003a5:	c9                   	leave
+  8003a6:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  8003a7:	83 ec 08             	sub    $0x8,%esp
+  8003aa:	68 ff 00 00 00       	push   $0xff
+  8003af:	8d 43 08             	lea    0x8(%ebx),%eax
+  8003b2:	50                   	push   %eax
+  8003b3:	e8 7a 09 00 00       	call   800d32 <sys_cputs>
+    b->idx = 0;
+  8003b8:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8003be:	83 c4 10             	add    $0x10,%esp
+  8003c1:	eb db                	jmp    80039e <putch+0x1f>
+
+008003c3 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8003c3:	55                   	push   %ebp
+  8003c4:	89 e5                	mov    %esp,%ebp
+  8003c6:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  8003cc:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8003d3:	00 00 00 
+  b.cnt = 0;
+  8003d6:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8003dd:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  8003e0:	ff 75 0c             	push   0xc(%ebp)
+  8003e3:	ff 75 08             	push   0x8(%ebp)
+  8003e6:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8003ec:	50                   	push   %eax
+  8003ed:	68 7f 03 80 00       	push   $0x80037f
+  8003f2:	e8 14 01 00 00       	call   80050b <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  8003f7:	83 c4 08             	add    $0x8,%esp
+  8003fa:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800400:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800406:	50                   	push   %eax
+  800407:	e8 26 09 00 00       	call   800d32 <sys_cputs>
+
+  return b.cnt;
+}
+  80040c:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800412:	c9                   	leave
+  800413:	c3                   	ret
+
+00800414 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800414:	55                   	push   %ebp
+  800415:	89 e5                	mov    %esp,%ebp
+  800417:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  80041a:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  80041d:	50                   	push   %eax
+  80041e:	ff 75 08             	push   0x8(%ebp)
+  800421:	e8 9d ff ff ff       	call   8003c3 <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  800426:	c9                   	leave
+  800427:	c3                   	ret
+
+00800428 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  800428:	55                   	push   %ebp
+  800429:	89 e5                	mov    %esp,%ebp
+  80042b:	57                   	push   %edi
+  80042c:	56                   	push   %esi
+  80042d:	53                   	push   %ebx
+  80042e:	83 ec 1c             	sub    $0x1c,%esp
+  800431:	89 c7                	mov    %eax,%edi
+  800433:	89 d6                	mov    %edx,%esi
+  800435:	8b 45 08             	mov    0x8(%ebp),%eax
+  800438:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80043b:	89 d1                	mov    %edx,%ecx
+  80043d:	89 c2                	mov    %eax,%edx
+  80043f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800442:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800445:	8b 45 10             	mov    0x10(%ebp),%eax
+  800448:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  80044b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80044e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800455:	39 c2                	cmp    %eax,%edx
+  800457:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80045a:	72 3e                	jb     80049a <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  80045c:	83 ec 0c             	sub    $0xc,%esp
+  80045f:	ff 75 18             	push   0x18(%ebp)
+  800462:	83 eb 01             	sub    $0x1,%ebx
+  800465:	53                   	push   %ebx
+  800466:	50                   	push   %eax
+  800467:	83 ec 08             	sub    $0x8,%esp
+  80046a:	ff 75 e4             	push   -0x1c(%ebp)
+  80046d:	ff 75 e0             	push   -0x20(%ebp)
+  800470:	ff 75 dc             	push   -0x24(%ebp)
+  800473:	ff 75 d8             	push   -0x28(%ebp)
+  800476:	e8 3e 2d 00 00       	call   8031b9 <__udivdi3>
+  80047b:	83 c4 18             	add    $0x18,%esp
+  80047e:	52                   	push   %edx
+  80047f:	50                   	push   %eax
+  800480:	89 f2                	mov    %esi,%edx
+  800482:	89 f8                	mov    %edi,%eax
+  800484:	e8 9f ff ff ff       	call   800428 <printnum>
+  800489:	83 c4 20             	add    $0x20,%esp
+  80048c:	eb 13                	jmp    8004a1 <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  80048e:	83 ec 08             	sub    $0x8,%esp
+  800491:	56                   	push   %esi
+  800492:	ff 75 18             	push   0x18(%ebp)
+  800495:	ff d7                	call   *%edi
+  800497:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  80049a:	83 eb 01             	sub    $0x1,%ebx
+  80049d:	85 db                	test   %ebx,%ebx
+  80049f:	7f ed                	jg     80048e <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  8004a1:	83 ec 08             	sub    $0x8,%esp
+  8004a4:	56                   	push   %esi
+  8004a5:	83 ec 04             	sub    $0x4,%esp
+  8004a8:	ff 75 e4             	push   -0x1c(%ebp)
+  8004ab:	ff 75 e0             	push   -0x20(%ebp)
+  8004ae:	ff 75 dc             	push   -0x24(%ebp)
+  8004b1:	ff 75 d8             	push   -0x28(%ebp)
+  8004b4:	e8 21 2d 00 00       	call   8031da <__umoddi3>
+  8004b9:	83 c4 14             	add    $0x14,%esp
+  8004bc:	0f be 80 fb 33 80 00 	movsbl 0x8033fb(%eax),%eax
+  8004c3:	50                   	push   %eax
+  8004c4:	ff d7                	call   *%edi
+}
+  8004c6:	83 c4 10             	add    $0x10,%esp
+  8004c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004cc:	5b                   	pop    %ebx
+  8004cd:	5e                   	pop    %esi
+  8004ce:	5f                   	pop    %edi
+  8004cf:	5d                   	pop    %ebp
+  8004d0:	c3                   	ret
+
+008004d1 <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8004d1:	55                   	push   %ebp
+  8004d2:	89 e5                	mov    %esp,%ebp
+  8004d4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  8004d7:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  8004db:	8b 10                	mov    (%eax),%edx
+  8004dd:	3b 50 04             	cmp    0x4(%eax),%edx
+  8004e0:	73 0a                	jae    8004ec <sprintputch+0x1b>
+    *b->buf++ = ch;
+  8004e2:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8004e5:	89 08                	mov    %ecx,(%eax)
+  8004e7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8004ea:	88 02                	mov    %al,(%edx)
+}
+  8004ec:	5d                   	pop    %ebp
+  8004ed:	c3                   	ret
+
+008004ee <printfmt>:
+{
+  8004ee:	55                   	push   %ebp
+  8004ef:	89 e5                	mov    %esp,%ebp
+  8004f1:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  8004f4:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  8004f7:	50                   	push   %eax
+  8004f8:	ff 75 10             	push   0x10(%ebp)
+  8004fb:	ff 75 0c             	push   0xc(%ebp)
+  8004fe:	ff 75 08             	push   0x8(%ebp)
+  800501:	e8 05 00 00 00       	call   80050b <vprintfmt>
+}
+  800506:	83 c4 10             	add    $0x10,%esp
+  800509:	c9                   	leave
+  80050a:	c3                   	ret
+
+0080050b <vprintfmt>:
+{
+  80050b:	55                   	push   %ebp
+  80050c:	89 e5                	mov    %esp,%ebp
+  80050e:	57                   	push   %edi
+  80050f:	56                   	push   %esi
+  800510:	53                   	push   %ebx
+  800511:	83 ec 2c             	sub    $0x2c,%esp
+  800514:	8b 75 08             	mov    0x8(%ebp),%esi
+  800517:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80051a:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80051d:	eb 0a                	jmp    800529 <vprintfmt+0x1e>
+      putch(ch, putdat);
+  80051f:	83 ec 08             	sub    $0x8,%esp
+  800522:	53                   	push   %ebx
+  800523:	50                   	push   %eax
+  800524:	ff d6                	call   *%esi
+  800526:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  800529:	83 c7 01             	add    $0x1,%edi
+  80052c:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800530:	83 f8 25             	cmp    $0x25,%eax
+  800533:	74 0c                	je     800541 <vprintfmt+0x36>
+      if (ch == '\0')
+  800535:	85 c0                	test   %eax,%eax
+  800537:	75 e6                	jne    80051f <vprintfmt+0x14>
+}
+  800539:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80053c:	5b                   	pop    %ebx
+  80053d:	5e                   	pop    %esi
+  80053e:	5f                   	pop    %edi
+  80053f:	5d                   	pop    %ebp
+  800540:	c3                   	ret
+    padc = ' ';
+  800541:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  800545:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  80054c:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  800553:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  80055a:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  80055f:	8d 47 01             	lea    0x1(%edi),%eax
+  800562:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800565:	0f b6 17             	movzbl (%edi),%edx
+  800568:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80056b:	3c 55                	cmp    $0x55,%al
+  80056d:	0f 87 cf 03 00 00    	ja     800942 <vprintfmt+0x437>
+  800573:	0f b6 c0             	movzbl %al,%eax
+  800576:	ff 24 85 40 35 80 00 	jmp    *0x803540(,%eax,4)
+  80057d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  800580:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800584:	eb d9                	jmp    80055f <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  800586:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800589:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80058d:	eb d0                	jmp    80055f <vprintfmt+0x54>
+  80058f:	0f b6 d2             	movzbl %dl,%edx
+  800592:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  800595:	b8 00 00 00 00       	mov    $0x0,%eax
+  80059a:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  80059d:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8005a0:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  8005a4:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  8005a7:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8005aa:	83 f9 09             	cmp    $0x9,%ecx
+  8005ad:	77 55                	ja     800604 <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  8005af:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  8005b2:	eb e9                	jmp    80059d <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  8005b4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b7:	8b 00                	mov    (%eax),%eax
+  8005b9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8005bc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005bf:	8d 40 04             	lea    0x4(%eax),%eax
+  8005c2:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  8005c5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  8005c8:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8005cc:	79 91                	jns    80055f <vprintfmt+0x54>
+        width = precision, precision = -1;
+  8005ce:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8005d1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005d4:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8005db:	eb 82                	jmp    80055f <vprintfmt+0x54>
+      if (width < 0)
+  8005dd:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8005e0:	85 d2                	test   %edx,%edx
+  8005e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005e7:	0f 49 c2             	cmovns %edx,%eax
+  8005ea:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  8005ed:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  8005f0:	e9 6a ff ff ff       	jmp    80055f <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  8005f5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  8005f8:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  8005ff:	e9 5b ff ff ff       	jmp    80055f <vprintfmt+0x54>
+  800604:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800607:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80060a:	eb bc                	jmp    8005c8 <vprintfmt+0xbd>
+      lflag++;
+  80060c:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  80060f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  800612:	e9 48 ff ff ff       	jmp    80055f <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  800617:	8b 45 14             	mov    0x14(%ebp),%eax
+  80061a:	8d 78 04             	lea    0x4(%eax),%edi
+  80061d:	83 ec 08             	sub    $0x8,%esp
+  800620:	53                   	push   %ebx
+  800621:	ff 30                	push   (%eax)
+  800623:	ff d6                	call   *%esi
+      break;
+  800625:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  800628:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  80062b:	e9 b1 02 00 00       	jmp    8008e1 <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  800630:	8b 45 14             	mov    0x14(%ebp),%eax
+  800633:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  800636:	8b 10                	mov    (%eax),%edx
+  800638:	89 d0                	mov    %edx,%eax
+  80063a:	f7 d8                	neg    %eax
+  80063c:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80063f:	83 f8 10             	cmp    $0x10,%eax
+  800642:	7f 23                	jg     800667 <vprintfmt+0x15c>
+  800644:	8b 14 85 a0 36 80 00 	mov    0x8036a0(,%eax,4),%edx
+  80064b:	85 d2                	test   %edx,%edx
+  80064d:	74 18                	je     800667 <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  80064f:	52                   	push   %edx
+  800650:	68 ea 37 80 00       	push   $0x8037ea
+  800655:	53                   	push   %ebx
+  800656:	56                   	push   %esi
+  800657:	e8 92 fe ff ff       	call   8004ee <printfmt>
+  80065c:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  80065f:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800662:	e9 7a 02 00 00       	jmp    8008e1 <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  800667:	50                   	push   %eax
+  800668:	68 13 34 80 00       	push   $0x803413
+  80066d:	53                   	push   %ebx
+  80066e:	56                   	push   %esi
+  80066f:	e8 7a fe ff ff       	call   8004ee <printfmt>
+  800674:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  800677:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  80067a:	e9 62 02 00 00       	jmp    8008e1 <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  80067f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800682:	83 c0 04             	add    $0x4,%eax
+  800685:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800688:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068b:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  80068d:	85 c9                	test   %ecx,%ecx
+  80068f:	b8 0c 34 80 00       	mov    $0x80340c,%eax
+  800694:	0f 45 c1             	cmovne %ecx,%eax
+  800697:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  80069a:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80069e:	7e 06                	jle    8006a6 <vprintfmt+0x19b>
+  8006a0:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8006a4:	75 0b                	jne    8006b1 <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8006a6:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8006a9:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8006ac:	89 75 08             	mov    %esi,0x8(%ebp)
+  8006af:	eb 5c                	jmp    80070d <vprintfmt+0x202>
+  8006b1:	83 ec 08             	sub    $0x8,%esp
+  8006b4:	ff 75 d0             	push   -0x30(%ebp)
+  8006b7:	ff 75 cc             	push   -0x34(%ebp)
+  8006ba:	e8 20 03 00 00       	call   8009df <strnlen>
+  8006bf:	89 c2                	mov    %eax,%edx
+  8006c1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006c4:	29 d0                	sub    %edx,%eax
+  8006c6:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  8006c9:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8006cd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006d0:	89 75 08             	mov    %esi,0x8(%ebp)
+  8006d3:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8006d5:	eb 0e                	jmp    8006e5 <vprintfmt+0x1da>
+          putch(padc, putdat);
+  8006d7:	83 ec 08             	sub    $0x8,%esp
+  8006da:	53                   	push   %ebx
+  8006db:	57                   	push   %edi
+  8006dc:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8006df:	83 ee 01             	sub    $0x1,%esi
+  8006e2:	83 c4 10             	add    $0x10,%esp
+  8006e5:	85 f6                	test   %esi,%esi
+  8006e7:	7f ee                	jg     8006d7 <vprintfmt+0x1cc>
+  8006e9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006ec:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006ef:	85 c0                	test   %eax,%eax
+  8006f1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006f6:	0f 49 d0             	cmovns %eax,%edx
+  8006f9:	29 d0                	sub    %edx,%eax
+  8006fb:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006fe:	eb a6                	jmp    8006a6 <vprintfmt+0x19b>
+          putch(ch, putdat);
+  800700:	83 ec 08             	sub    $0x8,%esp
+  800703:	53                   	push   %ebx
+  800704:	52                   	push   %edx
+  800705:	ff 55 08             	call   *0x8(%ebp)
+  800708:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80070b:	89 f1                	mov    %esi,%ecx
+  80070d:	8d 71 01             	lea    0x1(%ecx),%esi
+  800710:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800714:	0f be d0             	movsbl %al,%edx
+  800717:	85 d2                	test   %edx,%edx
+  800719:	74 28                	je     800743 <vprintfmt+0x238>
+  80071b:	85 ff                	test   %edi,%edi
+  80071d:	78 05                	js     800724 <vprintfmt+0x219>
+  80071f:	83 ef 01             	sub    $0x1,%edi
+  800722:	78 30                	js     800754 <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  800724:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800728:	74 d6                	je     800700 <vprintfmt+0x1f5>
+  80072a:	0f be c0             	movsbl %al,%eax
+  80072d:	83 e8 20             	sub    $0x20,%eax
+  800730:	83 f8 5e             	cmp    $0x5e,%eax
+  800733:	76 cb                	jbe    800700 <vprintfmt+0x1f5>
+          putch('?', putdat);
+  800735:	83 ec 08             	sub    $0x8,%esp
+  800738:	53                   	push   %ebx
+  800739:	6a 3f                	push   $0x3f
+  80073b:	ff 55 08             	call   *0x8(%ebp)
+  80073e:	83 c4 10             	add    $0x10,%esp
+  800741:	eb c8                	jmp    80070b <vprintfmt+0x200>
+  800743:	8b 75 08             	mov    0x8(%ebp),%esi
+  800746:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800749:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80074c:	01 d0                	add    %edx,%eax
+  80074e:	29 c8                	sub    %ecx,%eax
+  800750:	89 c7                	mov    %eax,%edi
+  800752:	eb 13                	jmp    800767 <vprintfmt+0x25c>
+  800754:	8b 75 08             	mov    0x8(%ebp),%esi
+  800757:	eb ed                	jmp    800746 <vprintfmt+0x23b>
+        putch(' ', putdat);
+  800759:	83 ec 08             	sub    $0x8,%esp
+  80075c:	53                   	push   %ebx
+  80075d:	6a 20                	push   $0x20
+  80075f:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  800761:	83 ef 01             	sub    $0x1,%edi
+  800764:	83 c4 10             	add    $0x10,%esp
+  800767:	85 ff                	test   %edi,%edi
+  800769:	7f ee                	jg     800759 <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  80076b:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80076e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800771:	e9 6b 01 00 00       	jmp    8008e1 <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  800776:	83 f9 01             	cmp    $0x1,%ecx
+  800779:	7f 1f                	jg     80079a <vprintfmt+0x28f>
+  else if (lflag)
+  80077b:	85 c9                	test   %ecx,%ecx
+  80077d:	74 67                	je     8007e6 <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  80077f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800782:	8b 00                	mov    (%eax),%eax
+  800784:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800787:	89 c1                	mov    %eax,%ecx
+  800789:	c1 f9 1f             	sar    $0x1f,%ecx
+  80078c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80078f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800792:	8d 40 04             	lea    0x4(%eax),%eax
+  800795:	89 45 14             	mov    %eax,0x14(%ebp)
+  800798:	eb 17                	jmp    8007b1 <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  80079a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80079d:	8b 50 04             	mov    0x4(%eax),%edx
+  8007a0:	8b 00                	mov    (%eax),%eax
+  8007a2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007a5:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8007a8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ab:	8d 40 08             	lea    0x8(%eax),%eax
+  8007ae:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  8007b1:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8007b4:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  8007b7:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  8007bc:	85 c9                	test   %ecx,%ecx
+  8007be:	0f 89 03 01 00 00    	jns    8008c7 <vprintfmt+0x3bc>
+        putch('-', putdat);
+  8007c4:	83 ec 08             	sub    $0x8,%esp
+  8007c7:	53                   	push   %ebx
+  8007c8:	6a 2d                	push   $0x2d
+  8007ca:	ff d6                	call   *%esi
+        num = -(long long)num;
+  8007cc:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8007cf:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8007d2:	f7 da                	neg    %edx
+  8007d4:	83 d1 00             	adc    $0x0,%ecx
+  8007d7:	f7 d9                	neg    %ecx
+  8007d9:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  8007dc:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8007e1:	e9 e1 00 00 00       	jmp    8008c7 <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  8007e6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e9:	8b 00                	mov    (%eax),%eax
+  8007eb:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007ee:	89 c1                	mov    %eax,%ecx
+  8007f0:	c1 f9 1f             	sar    $0x1f,%ecx
+  8007f3:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8007f6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007f9:	8d 40 04             	lea    0x4(%eax),%eax
+  8007fc:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007ff:	eb b0                	jmp    8007b1 <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  800801:	83 f9 01             	cmp    $0x1,%ecx
+  800804:	7f 1e                	jg     800824 <vprintfmt+0x319>
+  else if (lflag)
+  800806:	85 c9                	test   %ecx,%ecx
+  800808:	74 32                	je     80083c <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  80080a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80080d:	8b 10                	mov    (%eax),%edx
+  80080f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800814:	8d 40 04             	lea    0x4(%eax),%eax
+  800817:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  80081a:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  80081f:	e9 a3 00 00 00       	jmp    8008c7 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800824:	8b 45 14             	mov    0x14(%ebp),%eax
+  800827:	8b 10                	mov    (%eax),%edx
+  800829:	8b 48 04             	mov    0x4(%eax),%ecx
+  80082c:	8d 40 08             	lea    0x8(%eax),%eax
+  80082f:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800832:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  800837:	e9 8b 00 00 00       	jmp    8008c7 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  80083c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80083f:	8b 10                	mov    (%eax),%edx
+  800841:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800846:	8d 40 04             	lea    0x4(%eax),%eax
+  800849:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  80084c:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  800851:	eb 74                	jmp    8008c7 <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  800853:	83 f9 01             	cmp    $0x1,%ecx
+  800856:	7f 1b                	jg     800873 <vprintfmt+0x368>
+  else if (lflag)
+  800858:	85 c9                	test   %ecx,%ecx
+  80085a:	74 2c                	je     800888 <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  80085c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80085f:	8b 10                	mov    (%eax),%edx
+  800861:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800866:	8d 40 04             	lea    0x4(%eax),%eax
+  800869:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  80086c:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  800871:	eb 54                	jmp    8008c7 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800873:	8b 45 14             	mov    0x14(%ebp),%eax
+  800876:	8b 10                	mov    (%eax),%edx
+  800878:	8b 48 04             	mov    0x4(%eax),%ecx
+  80087b:	8d 40 08             	lea    0x8(%eax),%eax
+  80087e:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800881:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  800886:	eb 3f                	jmp    8008c7 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800888:	8b 45 14             	mov    0x14(%ebp),%eax
+  80088b:	8b 10                	mov    (%eax),%edx
+  80088d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800892:	8d 40 04             	lea    0x4(%eax),%eax
+  800895:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800898:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  80089d:	eb 28                	jmp    8008c7 <vprintfmt+0x3bc>
+      putch('0', putdat);
+  80089f:	83 ec 08             	sub    $0x8,%esp
+  8008a2:	53                   	push   %ebx
+  8008a3:	6a 30                	push   $0x30
+  8008a5:	ff d6                	call   *%esi
+      putch('x', putdat);
+  8008a7:	83 c4 08             	add    $0x8,%esp
+  8008aa:	53                   	push   %ebx
+  8008ab:	6a 78                	push   $0x78
+  8008ad:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  8008af:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008b2:	8b 10                	mov    (%eax),%edx
+  8008b4:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  8008b9:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  8008bc:	8d 40 04             	lea    0x4(%eax),%eax
+  8008bf:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8008c2:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  8008c7:	83 ec 0c             	sub    $0xc,%esp
+  8008ca:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8008ce:	50                   	push   %eax
+  8008cf:	ff 75 e0             	push   -0x20(%ebp)
+  8008d2:	57                   	push   %edi
+  8008d3:	51                   	push   %ecx
+  8008d4:	52                   	push   %edx
+  8008d5:	89 da                	mov    %ebx,%edx
+  8008d7:	89 f0                	mov    %esi,%eax
+  8008d9:	e8 4a fb ff ff       	call   800428 <printnum>
+      break;
+  8008de:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  8008e1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  8008e4:	e9 40 fc ff ff       	jmp    800529 <vprintfmt+0x1e>
+  if (lflag >= 2)
+  8008e9:	83 f9 01             	cmp    $0x1,%ecx
+  8008ec:	7f 1b                	jg     800909 <vprintfmt+0x3fe>
+  else if (lflag)
+  8008ee:	85 c9                	test   %ecx,%ecx
+  8008f0:	74 2c                	je     80091e <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  8008f2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008f5:	8b 10                	mov    (%eax),%edx
+  8008f7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008fc:	8d 40 04             	lea    0x4(%eax),%eax
+  8008ff:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800902:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  800907:	eb be                	jmp    8008c7 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800909:	8b 45 14             	mov    0x14(%ebp),%eax
+  80090c:	8b 10                	mov    (%eax),%edx
+  80090e:	8b 48 04             	mov    0x4(%eax),%ecx
+  800911:	8d 40 08             	lea    0x8(%eax),%eax
+  800914:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800917:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  80091c:	eb a9                	jmp    8008c7 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  80091e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800921:	8b 10                	mov    (%eax),%edx
+  800923:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800928:	8d 40 04             	lea    0x4(%eax),%eax
+  80092b:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  80092e:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  800933:	eb 92                	jmp    8008c7 <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  800935:	83 ec 08             	sub    $0x8,%esp
+  800938:	53                   	push   %ebx
+  800939:	6a 25                	push   $0x25
+  80093b:	ff d6                	call   *%esi
+      break;
+  80093d:	83 c4 10             	add    $0x10,%esp
+  800940:	eb 9f                	jmp    8008e1 <vprintfmt+0x3d6>
+      putch('%', putdat);
+  800942:	83 ec 08             	sub    $0x8,%esp
+  800945:	53                   	push   %ebx
+  800946:	6a 25                	push   $0x25
+  800948:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  80094a:	83 c4 10             	add    $0x10,%esp
+  80094d:	89 f8                	mov    %edi,%eax
+  80094f:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800953:	74 05                	je     80095a <vprintfmt+0x44f>
+  800955:	83 e8 01             	sub    $0x1,%eax
+  800958:	eb f5                	jmp    80094f <vprintfmt+0x444>
+  80095a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80095d:	eb 82                	jmp    8008e1 <vprintfmt+0x3d6>
+
+0080095f <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80095f:	55                   	push   %ebp
+  800960:	89 e5                	mov    %esp,%ebp
+  800962:	83 ec 18             	sub    $0x18,%esp
+  800965:	8b 45 08             	mov    0x8(%ebp),%eax
+  800968:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  80096b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80096e:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800972:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800975:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  80097c:	85 c0                	test   %eax,%eax
+  80097e:	74 26                	je     8009a6 <vsnprintf+0x47>
+  800980:	85 d2                	test   %edx,%edx
+  800982:	7e 22                	jle    8009a6 <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800984:	ff 75 14             	push   0x14(%ebp)
+  800987:	ff 75 10             	push   0x10(%ebp)
+  80098a:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80098d:	50                   	push   %eax
+  80098e:	68 d1 04 80 00       	push   $0x8004d1
+  800993:	e8 73 fb ff ff       	call   80050b <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800998:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80099b:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  80099e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009a1:	83 c4 10             	add    $0x10,%esp
+}
+  8009a4:	c9                   	leave
+  8009a5:	c3                   	ret
+    return -E_INVAL;
+  8009a6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8009ab:	eb f7                	jmp    8009a4 <vsnprintf+0x45>
+
+008009ad <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8009ad:	55                   	push   %ebp
+  8009ae:	89 e5                	mov    %esp,%ebp
+  8009b0:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  8009b3:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  8009b6:	50                   	push   %eax
+  8009b7:	ff 75 10             	push   0x10(%ebp)
+  8009ba:	ff 75 0c             	push   0xc(%ebp)
+  8009bd:	ff 75 08             	push   0x8(%ebp)
+  8009c0:	e8 9a ff ff ff       	call   80095f <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  8009c5:	c9                   	leave
+  8009c6:	c3                   	ret
+
+008009c7 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8009c7:	55                   	push   %ebp
+  8009c8:	89 e5                	mov    %esp,%ebp
+  8009ca:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  8009cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009d2:	eb 03                	jmp    8009d7 <strlen+0x10>
+    n++;
+  8009d4:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  8009d7:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8009db:	75 f7                	jne    8009d4 <strlen+0xd>
+  return n;
+}
+  8009dd:	5d                   	pop    %ebp
+  8009de:	c3                   	ret
+
+008009df <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8009df:	55                   	push   %ebp
+  8009e0:	89 e5                	mov    %esp,%ebp
+  8009e2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8009e5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009ed:	eb 03                	jmp    8009f2 <strnlen+0x13>
+    n++;
+  8009ef:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8009f2:	39 d0                	cmp    %edx,%eax
+  8009f4:	74 08                	je     8009fe <strnlen+0x1f>
+  8009f6:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8009fa:	75 f3                	jne    8009ef <strnlen+0x10>
+  8009fc:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  8009fe:	89 d0                	mov    %edx,%eax
+  800a00:	5d                   	pop    %ebp
+  800a01:	c3                   	ret
+
+00800a02 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800a02:	55                   	push   %ebp
+  800a03:	89 e5                	mov    %esp,%ebp
+  800a05:	53                   	push   %ebx
+  800a06:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a09:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  800a0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a11:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800a15:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800a18:	83 c0 01             	add    $0x1,%eax
+  800a1b:	84 d2                	test   %dl,%dl
+  800a1d:	75 f2                	jne    800a11 <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  800a1f:	89 c8                	mov    %ecx,%eax
+  800a21:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a24:	c9                   	leave
+  800a25:	c3                   	ret
+
+00800a26 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800a26:	55                   	push   %ebp
+  800a27:	89 e5                	mov    %esp,%ebp
+  800a29:	53                   	push   %ebx
+  800a2a:	83 ec 10             	sub    $0x10,%esp
+  800a2d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  800a30:	53                   	push   %ebx
+  800a31:	e8 91 ff ff ff       	call   8009c7 <strlen>
+  800a36:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  800a39:	ff 75 0c             	push   0xc(%ebp)
+  800a3c:	01 d8                	add    %ebx,%eax
+  800a3e:	50                   	push   %eax
+  800a3f:	e8 be ff ff ff       	call   800a02 <strcpy>
+  return dst;
+}
+  800a44:	89 d8                	mov    %ebx,%eax
+  800a46:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a49:	c9                   	leave
+  800a4a:	c3                   	ret
+
+00800a4b <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  800a4b:	55                   	push   %ebp
+  800a4c:	89 e5                	mov    %esp,%ebp
+  800a4e:	56                   	push   %esi
+  800a4f:	53                   	push   %ebx
+  800a50:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a53:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  800a56:	89 f3                	mov    %esi,%ebx
+  800a58:	03 5d 10             	add    0x10(%ebp),%ebx
+  800a5b:	89 f0                	mov    %esi,%eax
+  800a5d:	eb 0f                	jmp    800a6e <strncpy+0x23>
+    *dst++ = *src;
+  800a5f:	83 c0 01             	add    $0x1,%eax
+  800a62:	0f b6 0a             	movzbl (%edx),%ecx
+  800a65:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  800a68:	80 f9 01             	cmp    $0x1,%cl
+  800a6b:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  800a6e:	39 d8                	cmp    %ebx,%eax
+  800a70:	75 ed                	jne    800a5f <strncpy+0x14>
+  }
+  return ret;
+}
+  800a72:	89 f0                	mov    %esi,%eax
+  800a74:	5b                   	pop    %ebx
+  800a75:	5e                   	pop    %esi
+  800a76:	5d                   	pop    %ebp
+  800a77:	c3                   	ret
+
+00800a78 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800a78:	55                   	push   %ebp
+  800a79:	89 e5                	mov    %esp,%ebp
+  800a7b:	56                   	push   %esi
+  800a7c:	53                   	push   %ebx
+  800a7d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a80:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a83:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  800a86:	89 f0                	mov    %esi,%eax
+  800a88:	85 d2                	test   %edx,%edx
+  800a8a:	74 21                	je     800aad <strlcpy+0x35>
+  800a8c:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800a90:	89 f2                	mov    %esi,%edx
+  800a92:	eb 09                	jmp    800a9d <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  800a94:	83 c1 01             	add    $0x1,%ecx
+  800a97:	83 c2 01             	add    $0x1,%edx
+  800a9a:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  800a9d:	39 c2                	cmp    %eax,%edx
+  800a9f:	74 09                	je     800aaa <strlcpy+0x32>
+  800aa1:	0f b6 19             	movzbl (%ecx),%ebx
+  800aa4:	84 db                	test   %bl,%bl
+  800aa6:	75 ec                	jne    800a94 <strlcpy+0x1c>
+  800aa8:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  800aaa:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  800aad:	29 f0                	sub    %esi,%eax
+}
+  800aaf:	5b                   	pop    %ebx
+  800ab0:	5e                   	pop    %esi
+  800ab1:	5d                   	pop    %ebp
+  800ab2:	c3                   	ret
+
+00800ab3 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800ab3:	55                   	push   %ebp
+  800ab4:	89 e5                	mov    %esp,%ebp
+  800ab6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ab9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  800abc:	eb 06                	jmp    800ac4 <strcmp+0x11>
+    p++, q++;
+  800abe:	83 c1 01             	add    $0x1,%ecx
+  800ac1:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  800ac4:	0f b6 01             	movzbl (%ecx),%eax
+  800ac7:	84 c0                	test   %al,%al
+  800ac9:	74 04                	je     800acf <strcmp+0x1c>
+  800acb:	3a 02                	cmp    (%edx),%al
+  800acd:	74 ef                	je     800abe <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  800acf:	0f b6 c0             	movzbl %al,%eax
+  800ad2:	0f b6 12             	movzbl (%edx),%edx
+  800ad5:	29 d0                	sub    %edx,%eax
+}
+  800ad7:	5d                   	pop    %ebp
+  800ad8:	c3                   	ret
+
+00800ad9 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800ad9:	55                   	push   %ebp
+  800ada:	89 e5                	mov    %esp,%ebp
+  800adc:	53                   	push   %ebx
+  800add:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ae0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ae3:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  800ae6:	eb 09                	jmp    800af1 <strncmp+0x18>
+    n--, p++, q++;
+  800ae8:	83 ea 01             	sub    $0x1,%edx
+  800aeb:	83 c0 01             	add    $0x1,%eax
+  800aee:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  800af1:	85 d2                	test   %edx,%edx
+  800af3:	74 18                	je     800b0d <strncmp+0x34>
+  800af5:	0f b6 18             	movzbl (%eax),%ebx
+  800af8:	84 db                	test   %bl,%bl
+  800afa:	74 04                	je     800b00 <strncmp+0x27>
+  800afc:	3a 19                	cmp    (%ecx),%bl
+  800afe:	74 e8                	je     800ae8 <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800b00:	0f b6 00             	movzbl (%eax),%eax
+  800b03:	0f b6 11             	movzbl (%ecx),%edx
+  800b06:	29 d0                	sub    %edx,%eax
+}
+  800b08:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b0b:	c9                   	leave
+  800b0c:	c3                   	ret
+    return 0;
+  800b0d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b12:	eb f4                	jmp    800b08 <strncmp+0x2f>
+
+00800b14 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800b14:	55                   	push   %ebp
+  800b15:	89 e5                	mov    %esp,%ebp
+  800b17:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b1a:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800b1e:	eb 03                	jmp    800b23 <strchr+0xf>
+  800b20:	83 c0 01             	add    $0x1,%eax
+  800b23:	0f b6 10             	movzbl (%eax),%edx
+  800b26:	84 d2                	test   %dl,%dl
+  800b28:	74 06                	je     800b30 <strchr+0x1c>
+    if (*s == c)
+  800b2a:	38 ca                	cmp    %cl,%dl
+  800b2c:	75 f2                	jne    800b20 <strchr+0xc>
+  800b2e:	eb 05                	jmp    800b35 <strchr+0x21>
+      return (char*)s;
+  return 0;
+  800b30:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b35:	5d                   	pop    %ebp
+  800b36:	c3                   	ret
+
+00800b37 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800b37:	55                   	push   %ebp
+  800b38:	89 e5                	mov    %esp,%ebp
+  800b3a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b3d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800b41:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  800b44:	38 ca                	cmp    %cl,%dl
+  800b46:	74 09                	je     800b51 <strfind+0x1a>
+  800b48:	84 d2                	test   %dl,%dl
+  800b4a:	74 05                	je     800b51 <strfind+0x1a>
+  for (; *s; s++)
+  800b4c:	83 c0 01             	add    $0x1,%eax
+  800b4f:	eb f0                	jmp    800b41 <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  800b51:	5d                   	pop    %ebp
+  800b52:	c3                   	ret
+
+00800b53 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800b53:	55                   	push   %ebp
+  800b54:	89 e5                	mov    %esp,%ebp
+  800b56:	57                   	push   %edi
+  800b57:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b5a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  800b5d:	85 c9                	test   %ecx,%ecx
+  800b5f:	74 20                	je     800b81 <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  800b61:	89 f8                	mov    %edi,%eax
+  800b63:	09 c8                	or     %ecx,%eax
+  800b65:	a8 03                	test   $0x3,%al
+  800b67:	75 12                	jne    800b7b <memset+0x28>
+    c &= 0xFF;
+  800b69:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800b6d:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  800b73:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  800b76:	fc                   	cld
+  800b77:	f3 ab                	rep stos %eax,%es:(%edi)
+  800b79:	eb 06                	jmp    800b81 <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  800b7b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b7e:	fc                   	cld
+  800b7f:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  800b81:	89 f8                	mov    %edi,%eax
+  800b83:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800b86:	c9                   	leave
+  800b87:	c3                   	ret
+
+00800b88 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800b88:	55                   	push   %ebp
+  800b89:	89 e5                	mov    %esp,%ebp
+  800b8b:	57                   	push   %edi
+  800b8c:	56                   	push   %esi
+  800b8d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b90:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b93:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  800b96:	39 c6                	cmp    %eax,%esi
+  800b98:	73 32                	jae    800bcc <memmove+0x44>
+  800b9a:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800b9d:	39 d0                	cmp    %edx,%eax
+  800b9f:	73 2b                	jae    800bcc <memmove+0x44>
+    s += n;
+    d += n;
+  800ba1:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ba4:	89 d6                	mov    %edx,%esi
+  800ba6:	09 fe                	or     %edi,%esi
+  800ba8:	09 ce                	or     %ecx,%esi
+  800baa:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800bb0:	75 0e                	jne    800bc0 <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800bb2:	83 ef 04             	sub    $0x4,%edi
+  800bb5:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800bb8:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  800bbb:	fd                   	std
+  800bbc:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800bbe:	eb 09                	jmp    800bc9 <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800bc0:	83 ef 01             	sub    $0x1,%edi
+  800bc3:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  800bc6:	fd                   	std
+  800bc7:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  800bc9:	fc                   	cld
+  800bca:	eb 1a                	jmp    800be6 <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800bcc:	89 f2                	mov    %esi,%edx
+  800bce:	09 c2                	or     %eax,%edx
+  800bd0:	09 ca                	or     %ecx,%edx
+  800bd2:	f6 c2 03             	test   $0x3,%dl
+  800bd5:	75 0a                	jne    800be1 <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800bd7:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  800bda:	89 c7                	mov    %eax,%edi
+  800bdc:	fc                   	cld
+  800bdd:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800bdf:	eb 05                	jmp    800be6 <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  800be1:	89 c7                	mov    %eax,%edi
+  800be3:	fc                   	cld
+  800be4:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  800be6:	5e                   	pop    %esi
+  800be7:	5f                   	pop    %edi
+  800be8:	5d                   	pop    %ebp
+  800be9:	c3                   	ret
+
+00800bea <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800bea:	55                   	push   %ebp
+  800beb:	89 e5                	mov    %esp,%ebp
+  800bed:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  800bf0:	ff 75 10             	push   0x10(%ebp)
+  800bf3:	ff 75 0c             	push   0xc(%ebp)
+  800bf6:	ff 75 08             	push   0x8(%ebp)
+  800bf9:	e8 8a ff ff ff       	call   800b88 <memmove>
+}
+  800bfe:	c9                   	leave
+  800bff:	c3                   	ret
+
+00800c00 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800c00:	55                   	push   %ebp
+  800c01:	89 e5                	mov    %esp,%ebp
+  800c03:	56                   	push   %esi
+  800c04:	53                   	push   %ebx
+  800c05:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c08:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  800c0b:	89 c6                	mov    %eax,%esi
+  800c0d:	03 75 10             	add    0x10(%ebp),%esi
+  800c10:	eb 06                	jmp    800c18 <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  800c12:	83 c0 01             	add    $0x1,%eax
+  800c15:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  800c18:	39 f0                	cmp    %esi,%eax
+  800c1a:	74 14                	je     800c30 <memcmp+0x30>
+    if (*s1 != *s2)
+  800c1c:	0f b6 08             	movzbl (%eax),%ecx
+  800c1f:	0f b6 1a             	movzbl (%edx),%ebx
+  800c22:	38 d9                	cmp    %bl,%cl
+  800c24:	74 ec                	je     800c12 <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  800c26:	0f b6 c1             	movzbl %cl,%eax
+  800c29:	0f b6 db             	movzbl %bl,%ebx
+  800c2c:	29 d8                	sub    %ebx,%eax
+  800c2e:	eb 05                	jmp    800c35 <memcmp+0x35>
+  }
+
+  return 0;
+  800c30:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c35:	5b                   	pop    %ebx
+  800c36:	5e                   	pop    %esi
+  800c37:	5d                   	pop    %ebp
+  800c38:	c3                   	ret
+
+00800c39 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800c39:	55                   	push   %ebp
+  800c3a:	89 e5                	mov    %esp,%ebp
+  800c3c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c3f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  800c42:	89 c2                	mov    %eax,%edx
+  800c44:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  800c47:	eb 03                	jmp    800c4c <memfind+0x13>
+  800c49:	83 c0 01             	add    $0x1,%eax
+  800c4c:	39 d0                	cmp    %edx,%eax
+  800c4e:	73 04                	jae    800c54 <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  800c50:	38 08                	cmp    %cl,(%eax)
+  800c52:	75 f5                	jne    800c49 <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  800c54:	5d                   	pop    %ebp
+  800c55:	c3                   	ret
+
+00800c56 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800c56:	55                   	push   %ebp
+  800c57:	89 e5                	mov    %esp,%ebp
+  800c59:	57                   	push   %edi
+  800c5a:	56                   	push   %esi
+  800c5b:	53                   	push   %ebx
+  800c5c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c5f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  800c62:	eb 03                	jmp    800c67 <strtol+0x11>
+    s++;
+  800c64:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  800c67:	0f b6 02             	movzbl (%edx),%eax
+  800c6a:	3c 20                	cmp    $0x20,%al
+  800c6c:	74 f6                	je     800c64 <strtol+0xe>
+  800c6e:	3c 09                	cmp    $0x9,%al
+  800c70:	74 f2                	je     800c64 <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  800c72:	3c 2b                	cmp    $0x2b,%al
+  800c74:	74 2a                	je     800ca0 <strtol+0x4a>
+  int neg = 0;
+  800c76:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  800c7b:	3c 2d                	cmp    $0x2d,%al
+  800c7d:	74 2b                	je     800caa <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c7f:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800c85:	75 0f                	jne    800c96 <strtol+0x40>
+  800c87:	80 3a 30             	cmpb   $0x30,(%edx)
+  800c8a:	74 28                	je     800cb4 <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  800c8c:	85 db                	test   %ebx,%ebx
+  800c8e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c93:	0f 44 d8             	cmove  %eax,%ebx
+  800c96:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c9b:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800c9e:	eb 46                	jmp    800ce6 <strtol+0x90>
+    s++;
+  800ca0:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  800ca3:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ca8:	eb d5                	jmp    800c7f <strtol+0x29>
+    s++, neg = 1;
+  800caa:	83 c2 01             	add    $0x1,%edx
+  800cad:	bf 01 00 00 00       	mov    $0x1,%edi
+  800cb2:	eb cb                	jmp    800c7f <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800cb4:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800cb8:	74 0e                	je     800cc8 <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  800cba:	85 db                	test   %ebx,%ebx
+  800cbc:	75 d8                	jne    800c96 <strtol+0x40>
+    s++, base = 8;
+  800cbe:	83 c2 01             	add    $0x1,%edx
+  800cc1:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800cc6:	eb ce                	jmp    800c96 <strtol+0x40>
+    s += 2, base = 16;
+  800cc8:	83 c2 02             	add    $0x2,%edx
+  800ccb:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800cd0:	eb c4                	jmp    800c96 <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  800cd2:	0f be c0             	movsbl %al,%eax
+  800cd5:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  800cd8:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800cdb:	7d 3a                	jge    800d17 <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  800cdd:	83 c2 01             	add    $0x1,%edx
+  800ce0:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800ce4:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  800ce6:	0f b6 02             	movzbl (%edx),%eax
+  800ce9:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800cec:	89 f3                	mov    %esi,%ebx
+  800cee:	80 fb 09             	cmp    $0x9,%bl
+  800cf1:	76 df                	jbe    800cd2 <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  800cf3:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800cf6:	89 f3                	mov    %esi,%ebx
+  800cf8:	80 fb 19             	cmp    $0x19,%bl
+  800cfb:	77 08                	ja     800d05 <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  800cfd:	0f be c0             	movsbl %al,%eax
+  800d00:	83 e8 57             	sub    $0x57,%eax
+  800d03:	eb d3                	jmp    800cd8 <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  800d05:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800d08:	89 f3                	mov    %esi,%ebx
+  800d0a:	80 fb 19             	cmp    $0x19,%bl
+  800d0d:	77 08                	ja     800d17 <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  800d0f:	0f be c0             	movsbl %al,%eax
+  800d12:	83 e8 37             	sub    $0x37,%eax
+  800d15:	eb c1                	jmp    800cd8 <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  800d17:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800d1b:	74 05                	je     800d22 <strtol+0xcc>
+    *endptr = (char*)s;
+  800d1d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d20:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  800d22:	89 c8                	mov    %ecx,%eax
+  800d24:	f7 d8                	neg    %eax
+  800d26:	85 ff                	test   %edi,%edi
+  800d28:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800d2b:	89 c8                	mov    %ecx,%eax
+  800d2d:	5b                   	pop    %ebx
+  800d2e:	5e                   	pop    %esi
+  800d2f:	5f                   	pop    %edi
+  800d30:	5d                   	pop    %ebp
+  800d31:	c3                   	ret
+
+00800d32 <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800d32:	55                   	push   %ebp
+  800d33:	89 e5                	mov    %esp,%ebp
+  800d35:	57                   	push   %edi
+  800d36:	56                   	push   %esi
+  800d37:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d38:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d3d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d40:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d43:	89 c3                	mov    %eax,%ebx
+  800d45:	89 c7                	mov    %eax,%edi
+  800d47:	89 c6                	mov    %eax,%esi
+  800d49:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800d4b:	5b                   	pop    %ebx
+  800d4c:	5e                   	pop    %esi
+  800d4d:	5f                   	pop    %edi
+  800d4e:	5d                   	pop    %ebp
+  800d4f:	c3                   	ret
+
+00800d50 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800d50:	55                   	push   %ebp
+  800d51:	89 e5                	mov    %esp,%ebp
+  800d53:	57                   	push   %edi
+  800d54:	56                   	push   %esi
+  800d55:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d56:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d5b:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d60:	89 d1                	mov    %edx,%ecx
+  800d62:	89 d3                	mov    %edx,%ebx
+  800d64:	89 d7                	mov    %edx,%edi
+  800d66:	89 d6                	mov    %edx,%esi
+  800d68:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800d6a:	5b                   	pop    %ebx
+  800d6b:	5e                   	pop    %esi
+  800d6c:	5f                   	pop    %edi
+  800d6d:	5d                   	pop    %ebp
+  800d6e:	c3                   	ret
+
+00800d6f <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800d6f:	55                   	push   %ebp
+  800d70:	89 e5                	mov    %esp,%ebp
+  800d72:	57                   	push   %edi
+  800d73:	56                   	push   %esi
+  800d74:	53                   	push   %ebx
+  800d75:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800d78:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d7d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d80:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d85:	89 cb                	mov    %ecx,%ebx
+  800d87:	89 cf                	mov    %ecx,%edi
+  800d89:	89 ce                	mov    %ecx,%esi
+  800d8b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d8d:	85 c0                	test   %eax,%eax
+  800d8f:	7f 08                	jg     800d99 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800d91:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d94:	5b                   	pop    %ebx
+  800d95:	5e                   	pop    %esi
+  800d96:	5f                   	pop    %edi
+  800d97:	5d                   	pop    %ebp
+  800d98:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d99:	83 ec 0c             	sub    $0xc,%esp
+  800d9c:	50                   	push   %eax
+  800d9d:	6a 03                	push   $0x3
+  800d9f:	68 03 37 80 00       	push   $0x803703
+  800da4:	6a 23                	push   $0x23
+  800da6:	68 20 37 80 00       	push   $0x803720
+  800dab:	e8 89 f5 ff ff       	call   800339 <_panic>
+
+00800db0 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800db0:	55                   	push   %ebp
+  800db1:	89 e5                	mov    %esp,%ebp
+  800db3:	57                   	push   %edi
+  800db4:	56                   	push   %esi
+  800db5:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800db6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dbb:	b8 02 00 00 00       	mov    $0x2,%eax
+  800dc0:	89 d1                	mov    %edx,%ecx
+  800dc2:	89 d3                	mov    %edx,%ebx
+  800dc4:	89 d7                	mov    %edx,%edi
+  800dc6:	89 d6                	mov    %edx,%esi
+  800dc8:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800dca:	5b                   	pop    %ebx
+  800dcb:	5e                   	pop    %esi
+  800dcc:	5f                   	pop    %edi
+  800dcd:	5d                   	pop    %ebp
+  800dce:	c3                   	ret
+
+00800dcf <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800dcf:	55                   	push   %ebp
+  800dd0:	89 e5                	mov    %esp,%ebp
+  800dd2:	57                   	push   %edi
+  800dd3:	56                   	push   %esi
+  800dd4:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800dd5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dda:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800ddf:	89 d1                	mov    %edx,%ecx
+  800de1:	89 d3                	mov    %edx,%ebx
+  800de3:	89 d7                	mov    %edx,%edi
+  800de5:	89 d6                	mov    %edx,%esi
+  800de7:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800de9:	5b                   	pop    %ebx
+  800dea:	5e                   	pop    %esi
+  800deb:	5f                   	pop    %edi
+  800dec:	5d                   	pop    %ebp
+  800ded:	c3                   	ret
+
+00800dee <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  800dee:	55                   	push   %ebp
+  800def:	89 e5                	mov    %esp,%ebp
+  800df1:	57                   	push   %edi
+  800df2:	56                   	push   %esi
+  800df3:	53                   	push   %ebx
+  800df4:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  800df7:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  800dfb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e00:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e03:	b8 14 00 00 00       	mov    $0x14,%eax
+  800e08:	89 df                	mov    %ebx,%edi
+  800e0a:	89 de                	mov    %ebx,%esi
+  800e0c:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e0e:	85 c0                	test   %eax,%eax
+  800e10:	7f 08                	jg     800e1a <sys_env_set_cow+0x2c>
+}
+  800e12:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e15:	5b                   	pop    %ebx
+  800e16:	5e                   	pop    %esi
+  800e17:	5f                   	pop    %edi
+  800e18:	5d                   	pop    %ebp
+  800e19:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e1a:	83 ec 0c             	sub    $0xc,%esp
+  800e1d:	50                   	push   %eax
+  800e1e:	6a 14                	push   $0x14
+  800e20:	68 03 37 80 00       	push   $0x803703
+  800e25:	6a 23                	push   $0x23
+  800e27:	68 20 37 80 00       	push   $0x803720
+  800e2c:	e8 08 f5 ff ff       	call   800339 <_panic>
+
+00800e31 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800e31:	55                   	push   %ebp
+  800e32:	89 e5                	mov    %esp,%ebp
+  800e34:	57                   	push   %edi
+  800e35:	56                   	push   %esi
+  800e36:	53                   	push   %ebx
+  800e37:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e3a:	be 00 00 00 00       	mov    $0x0,%esi
+  800e3f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e42:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e45:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e4a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e4d:	89 f7                	mov    %esi,%edi
+  800e4f:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e51:	85 c0                	test   %eax,%eax
+  800e53:	7f 08                	jg     800e5d <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  800e55:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e58:	5b                   	pop    %ebx
+  800e59:	5e                   	pop    %esi
+  800e5a:	5f                   	pop    %edi
+  800e5b:	5d                   	pop    %ebp
+  800e5c:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e5d:	83 ec 0c             	sub    $0xc,%esp
+  800e60:	50                   	push   %eax
+  800e61:	6a 04                	push   $0x4
+  800e63:	68 03 37 80 00       	push   $0x803703
+  800e68:	6a 23                	push   $0x23
+  800e6a:	68 20 37 80 00       	push   $0x803720
+  800e6f:	e8 c5 f4 ff ff       	call   800339 <_panic>
+
+00800e74 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800e74:	55                   	push   %ebp
+  800e75:	89 e5                	mov    %esp,%ebp
+  800e77:	57                   	push   %edi
+  800e78:	56                   	push   %esi
+  800e79:	53                   	push   %ebx
+  800e7a:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e7d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e80:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e83:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e88:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e8b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e8e:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e91:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e93:	85 c0                	test   %eax,%eax
+  800e95:	7f 08                	jg     800e9f <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  800e97:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e9a:	5b                   	pop    %ebx
+  800e9b:	5e                   	pop    %esi
+  800e9c:	5f                   	pop    %edi
+  800e9d:	5d                   	pop    %ebp
+  800e9e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e9f:	83 ec 0c             	sub    $0xc,%esp
+  800ea2:	50                   	push   %eax
+  800ea3:	6a 05                	push   $0x5
+  800ea5:	68 03 37 80 00       	push   $0x803703
+  800eaa:	6a 23                	push   $0x23
+  800eac:	68 20 37 80 00       	push   $0x803720
+  800eb1:	e8 83 f4 ff ff       	call   800339 <_panic>
+
+00800eb6 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800eb6:	55                   	push   %ebp
+  800eb7:	89 e5                	mov    %esp,%ebp
+  800eb9:	57                   	push   %edi
+  800eba:	56                   	push   %esi
+  800ebb:	53                   	push   %ebx
+  800ebc:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800ebf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ec4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eca:	b8 06 00 00 00       	mov    $0x6,%eax
+  800ecf:	89 df                	mov    %ebx,%edi
+  800ed1:	89 de                	mov    %ebx,%esi
+  800ed3:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ed5:	85 c0                	test   %eax,%eax
+  800ed7:	7f 08                	jg     800ee1 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  800ed9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800edc:	5b                   	pop    %ebx
+  800edd:	5e                   	pop    %esi
+  800ede:	5f                   	pop    %edi
+  800edf:	5d                   	pop    %ebp
+  800ee0:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ee1:	83 ec 0c             	sub    $0xc,%esp
+  800ee4:	50                   	push   %eax
+  800ee5:	6a 06                	push   $0x6
+  800ee7:	68 03 37 80 00       	push   $0x803703
+  800eec:	6a 23                	push   $0x23
+  800eee:	68 20 37 80 00       	push   $0x803720
+  800ef3:	e8 41 f4 ff ff       	call   800339 <_panic>
+
+00800ef8 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  800ef8:	55                   	push   %ebp
+  800ef9:	89 e5                	mov    %esp,%ebp
+  800efb:	57                   	push   %edi
+  800efc:	56                   	push   %esi
+  800efd:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800efe:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f01:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f04:	b8 11 00 00 00       	mov    $0x11,%eax
+  800f09:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f0c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f0f:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f12:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  800f14:	5b                   	pop    %ebx
+  800f15:	5e                   	pop    %esi
+  800f16:	5f                   	pop    %edi
+  800f17:	5d                   	pop    %ebp
+  800f18:	c3                   	ret
+
+00800f19 <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  800f19:	55                   	push   %ebp
+  800f1a:	89 e5                	mov    %esp,%ebp
+  800f1c:	57                   	push   %edi
+  800f1d:	56                   	push   %esi
+  800f1e:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f1f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f22:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f25:	b8 12 00 00 00       	mov    $0x12,%eax
+  800f2a:	be 00 00 00 00       	mov    $0x0,%esi
+  800f2f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f32:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f35:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  800f37:	5b                   	pop    %ebx
+  800f38:	5e                   	pop    %esi
+  800f39:	5f                   	pop    %edi
+  800f3a:	5d                   	pop    %ebp
+  800f3b:	c3                   	ret
+
+00800f3c <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  800f3c:	55                   	push   %ebp
+  800f3d:	89 e5                	mov    %esp,%ebp
+  800f3f:	57                   	push   %edi
+  800f40:	56                   	push   %esi
+  800f41:	53                   	push   %ebx
+  800f42:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f45:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f4a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f4d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f50:	b8 16 00 00 00       	mov    $0x16,%eax
+  800f55:	89 df                	mov    %ebx,%edi
+  800f57:	89 de                	mov    %ebx,%esi
+  800f59:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f5b:	85 c0                	test   %eax,%eax
+  800f5d:	7f 08                	jg     800f67 <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  800f5f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f62:	5b                   	pop    %ebx
+  800f63:	5e                   	pop    %esi
+  800f64:	5f                   	pop    %edi
+  800f65:	5d                   	pop    %ebp
+  800f66:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f67:	83 ec 0c             	sub    $0xc,%esp
+  800f6a:	50                   	push   %eax
+  800f6b:	6a 16                	push   $0x16
+  800f6d:	68 03 37 80 00       	push   $0x803703
+  800f72:	6a 23                	push   $0x23
+  800f74:	68 20 37 80 00       	push   $0x803720
+  800f79:	e8 bb f3 ff ff       	call   800339 <_panic>
+
+00800f7e <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  800f7e:	55                   	push   %ebp
+  800f7f:	89 e5                	mov    %esp,%ebp
+  800f81:	57                   	push   %edi
+  800f82:	56                   	push   %esi
+  800f83:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f84:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f89:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f8c:	b8 17 00 00 00       	mov    $0x17,%eax
+  800f91:	89 cb                	mov    %ecx,%ebx
+  800f93:	89 cf                	mov    %ecx,%edi
+  800f95:	89 ce                	mov    %ecx,%esi
+  800f97:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  800f99:	5b                   	pop    %ebx
+  800f9a:	5e                   	pop    %esi
+  800f9b:	5f                   	pop    %edi
+  800f9c:	5d                   	pop    %ebp
+  800f9d:	c3                   	ret
+
+00800f9e <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  800f9e:	55                   	push   %ebp
+  800f9f:	89 e5                	mov    %esp,%ebp
+  800fa1:	57                   	push   %edi
+  800fa2:	56                   	push   %esi
+  800fa3:	53                   	push   %ebx
+  800fa4:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800fa7:	be 00 00 00 00       	mov    $0x0,%esi
+  800fac:	8b 55 08             	mov    0x8(%ebp),%edx
+  800faf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fb2:	b8 18 00 00 00       	mov    $0x18,%eax
+  800fb7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fba:	89 f7                	mov    %esi,%edi
+  800fbc:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800fbe:	85 c0                	test   %eax,%eax
+  800fc0:	7f 08                	jg     800fca <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  800fc2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fc5:	5b                   	pop    %ebx
+  800fc6:	5e                   	pop    %esi
+  800fc7:	5f                   	pop    %edi
+  800fc8:	5d                   	pop    %ebp
+  800fc9:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800fca:	83 ec 0c             	sub    $0xc,%esp
+  800fcd:	50                   	push   %eax
+  800fce:	6a 18                	push   $0x18
+  800fd0:	68 03 37 80 00       	push   $0x803703
+  800fd5:	6a 23                	push   $0x23
+  800fd7:	68 20 37 80 00       	push   $0x803720
+  800fdc:	e8 58 f3 ff ff       	call   800339 <_panic>
+
+00800fe1 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  800fe1:	55                   	push   %ebp
+  800fe2:	89 e5                	mov    %esp,%ebp
+  800fe4:	57                   	push   %edi
+  800fe5:	56                   	push   %esi
+  800fe6:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800fe7:	be 00 00 00 00       	mov    $0x0,%esi
+  800fec:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ff2:	b8 19 00 00 00       	mov    $0x19,%eax
+  800ff7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ffa:	89 f7                	mov    %esi,%edi
+  800ffc:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  800ffe:	5b                   	pop    %ebx
+  800fff:	5e                   	pop    %esi
+  801000:	5f                   	pop    %edi
+  801001:	5d                   	pop    %ebp
+  801002:	c3                   	ret
+
+00801003 <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  801003:	55                   	push   %ebp
+  801004:	89 e5                	mov    %esp,%ebp
+  801006:	57                   	push   %edi
+  801007:	56                   	push   %esi
+  801008:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801009:	ba 00 00 00 00       	mov    $0x0,%edx
+  80100e:	b8 15 00 00 00       	mov    $0x15,%eax
+  801013:	89 d1                	mov    %edx,%ecx
+  801015:	89 d3                	mov    %edx,%ebx
+  801017:	89 d7                	mov    %edx,%edi
+  801019:	89 d6                	mov    %edx,%esi
+  80101b:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  80101d:	5b                   	pop    %ebx
+  80101e:	5e                   	pop    %esi
+  80101f:	5f                   	pop    %edi
+  801020:	5d                   	pop    %ebp
+  801021:	c3                   	ret
+
+00801022 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801022:	55                   	push   %ebp
+  801023:	89 e5                	mov    %esp,%ebp
+  801025:	57                   	push   %edi
+  801026:	56                   	push   %esi
+  801027:	53                   	push   %ebx
+  801028:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80102b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801030:	8b 55 08             	mov    0x8(%ebp),%edx
+  801033:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801036:	b8 08 00 00 00       	mov    $0x8,%eax
+  80103b:	89 df                	mov    %ebx,%edi
+  80103d:	89 de                	mov    %ebx,%esi
+  80103f:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801041:	85 c0                	test   %eax,%eax
+  801043:	7f 08                	jg     80104d <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801045:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801048:	5b                   	pop    %ebx
+  801049:	5e                   	pop    %esi
+  80104a:	5f                   	pop    %edi
+  80104b:	5d                   	pop    %ebp
+  80104c:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80104d:	83 ec 0c             	sub    $0xc,%esp
+  801050:	50                   	push   %eax
+  801051:	6a 08                	push   $0x8
+  801053:	68 03 37 80 00       	push   $0x803703
+  801058:	6a 23                	push   $0x23
+  80105a:	68 20 37 80 00       	push   $0x803720
+  80105f:	e8 d5 f2 ff ff       	call   800339 <_panic>
+
+00801064 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801064:	55                   	push   %ebp
+  801065:	89 e5                	mov    %esp,%ebp
+  801067:	57                   	push   %edi
+  801068:	56                   	push   %esi
+  801069:	53                   	push   %ebx
+  80106a:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80106d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801072:	8b 55 08             	mov    0x8(%ebp),%edx
+  801075:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801078:	b8 09 00 00 00       	mov    $0x9,%eax
+  80107d:	89 df                	mov    %ebx,%edi
+  80107f:	89 de                	mov    %ebx,%esi
+  801081:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801083:	85 c0                	test   %eax,%eax
+  801085:	7f 08                	jg     80108f <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  801087:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80108a:	5b                   	pop    %ebx
+  80108b:	5e                   	pop    %esi
+  80108c:	5f                   	pop    %edi
+  80108d:	5d                   	pop    %ebp
+  80108e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80108f:	83 ec 0c             	sub    $0xc,%esp
+  801092:	50                   	push   %eax
+  801093:	6a 09                	push   $0x9
+  801095:	68 03 37 80 00       	push   $0x803703
+  80109a:	6a 23                	push   $0x23
+  80109c:	68 20 37 80 00       	push   $0x803720
+  8010a1:	e8 93 f2 ff ff       	call   800339 <_panic>
+
+008010a6 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8010a6:	55                   	push   %ebp
+  8010a7:	89 e5                	mov    %esp,%ebp
+  8010a9:	57                   	push   %edi
+  8010aa:	56                   	push   %esi
+  8010ab:	53                   	push   %ebx
+  8010ac:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8010af:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ba:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010bf:	89 df                	mov    %ebx,%edi
+  8010c1:	89 de                	mov    %ebx,%esi
+  8010c3:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8010c5:	85 c0                	test   %eax,%eax
+  8010c7:	7f 08                	jg     8010d1 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  8010c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010cc:	5b                   	pop    %ebx
+  8010cd:	5e                   	pop    %esi
+  8010ce:	5f                   	pop    %edi
+  8010cf:	5d                   	pop    %ebp
+  8010d0:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8010d1:	83 ec 0c             	sub    $0xc,%esp
+  8010d4:	50                   	push   %eax
+  8010d5:	6a 0a                	push   $0xa
+  8010d7:	68 03 37 80 00       	push   $0x803703
+  8010dc:	6a 23                	push   $0x23
+  8010de:	68 20 37 80 00       	push   $0x803720
+  8010e3:	e8 51 f2 ff ff       	call   800339 <_panic>
+
+008010e8 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  8010e8:	55                   	push   %ebp
+  8010e9:	89 e5                	mov    %esp,%ebp
+  8010eb:	57                   	push   %edi
+  8010ec:	56                   	push   %esi
+  8010ed:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8010ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010f4:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010f9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010fc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010ff:	8b 75 18             	mov    0x18(%ebp),%esi
+  801102:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  801104:	5b                   	pop    %ebx
+  801105:	5e                   	pop    %esi
+  801106:	5f                   	pop    %edi
+  801107:	5d                   	pop    %ebp
+  801108:	c3                   	ret
+
+00801109 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  801109:	55                   	push   %ebp
+  80110a:	89 e5                	mov    %esp,%ebp
+  80110c:	57                   	push   %edi
+  80110d:	56                   	push   %esi
+  80110e:	53                   	push   %ebx
+  80110f:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801112:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801117:	8b 55 08             	mov    0x8(%ebp),%edx
+  80111a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80111d:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801122:	89 df                	mov    %ebx,%edi
+  801124:	89 de                	mov    %ebx,%esi
+  801126:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801128:	85 c0                	test   %eax,%eax
+  80112a:	7f 08                	jg     801134 <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  80112c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80112f:	5b                   	pop    %ebx
+  801130:	5e                   	pop    %esi
+  801131:	5f                   	pop    %edi
+  801132:	5d                   	pop    %ebp
+  801133:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801134:	83 ec 0c             	sub    $0xc,%esp
+  801137:	50                   	push   %eax
+  801138:	6a 0d                	push   $0xd
+  80113a:	68 03 37 80 00       	push   $0x803703
+  80113f:	6a 23                	push   $0x23
+  801141:	68 20 37 80 00       	push   $0x803720
+  801146:	e8 ee f1 ff ff       	call   800339 <_panic>
+
+0080114b <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  80114b:	55                   	push   %ebp
+  80114c:	89 e5                	mov    %esp,%ebp
+  80114e:	57                   	push   %edi
+  80114f:	56                   	push   %esi
+  801150:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801151:	ba 00 00 00 00       	mov    $0x0,%edx
+  801156:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80115b:	89 d1                	mov    %edx,%ecx
+  80115d:	89 d3                	mov    %edx,%ebx
+  80115f:	89 d7                	mov    %edx,%edi
+  801161:	89 d6                	mov    %edx,%esi
+  801163:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801165:	5b                   	pop    %ebx
+  801166:	5e                   	pop    %esi
+  801167:	5f                   	pop    %edi
+  801168:	5d                   	pop    %ebp
+  801169:	c3                   	ret
+
+0080116a <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  80116a:	55                   	push   %ebp
+  80116b:	89 e5                	mov    %esp,%ebp
+  80116d:	57                   	push   %edi
+  80116e:	56                   	push   %esi
+  80116f:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801170:	8b 55 08             	mov    0x8(%ebp),%edx
+  801173:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801176:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80117b:	be 00 00 00 00       	mov    $0x0,%esi
+  801180:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801183:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801186:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  801188:	5b                   	pop    %ebx
+  801189:	5e                   	pop    %esi
+  80118a:	5f                   	pop    %edi
+  80118b:	5d                   	pop    %ebp
+  80118c:	c3                   	ret
+
+0080118d <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  80118d:	55                   	push   %ebp
+  80118e:	89 e5                	mov    %esp,%ebp
+  801190:	57                   	push   %edi
+  801191:	56                   	push   %esi
+  801192:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801193:	be 00 00 00 00       	mov    $0x0,%esi
+  801198:	8b 55 08             	mov    0x8(%ebp),%edx
+  80119b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80119e:	b8 10 00 00 00       	mov    $0x10,%eax
+  8011a3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011a6:	89 f7                	mov    %esi,%edi
+  8011a8:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  8011aa:	5b                   	pop    %ebx
+  8011ab:	5e                   	pop    %esi
+  8011ac:	5f                   	pop    %edi
+  8011ad:	5d                   	pop    %ebp
+  8011ae:	c3                   	ret
+
+008011af <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  8011af:	55                   	push   %ebp
+  8011b0:	89 e5                	mov    %esp,%ebp
+  8011b2:	57                   	push   %edi
+  8011b3:	56                   	push   %esi
+  8011b4:	53                   	push   %ebx
+  8011b5:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  8011b8:	80 3d 64 5b 80 00 00 	cmpb   $0x0,0x805b64
+  8011bf:	74 41                	je     801202 <sys_batch+0x53>
+  8011c1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011c4:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  8011c7:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  8011ce:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8011d1:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  8011d4:	7d 45                	jge    80121b <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  8011d6:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8011d9:	8b 06                	mov    (%esi),%eax
+  8011db:	8b 56 04             	mov    0x4(%esi),%edx
+  8011de:	8b 4e 08             	mov    0x8(%esi),%ecx
+  8011e1:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  8011e4:	8b 7e 10             	mov    0x10(%esi),%edi
+  8011e7:	8b 76 14             	mov    0x14(%esi),%esi
+  8011ea:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  8011ec:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8011ef:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  8011f2:	83 c6 1c             	add    $0x1c,%esi
+  8011f5:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  8011f8:	85 c0                	test   %eax,%eax
+  8011fa:	78 1f                	js     80121b <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  8011fc:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  801200:	eb cc                	jmp    8011ce <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  801202:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801207:	b8 13 00 00 00       	mov    $0x13,%eax
+  80120c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80120f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801212:	89 df                	mov    %ebx,%edi
+  801214:	89 de                	mov    %ebx,%esi
+  801216:	cd 30                	int    $0x30
+  801218:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  80121b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80121e:	83 c4 08             	add    $0x8,%esp
+  801221:	5b                   	pop    %ebx
+  801222:	5e                   	pop    %esi
+  801223:	5f                   	pop    %edi
+  801224:	5d                   	pop    %ebp
+  801225:	c3                   	ret
+
+00801226 <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  801226:	55                   	push   %ebp
+  801227:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  801229:	8b 45 08             	mov    0x8(%ebp),%eax
+  80122c:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  801232:	5d                   	pop    %ebp
+  801233:	c3                   	ret
+
+00801234 <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  801234:	55                   	push   %ebp
+  801235:	89 e5                	mov    %esp,%ebp
+  801237:	56                   	push   %esi
+  801238:	53                   	push   %ebx
+  801239:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  80123c:	8b 1e                	mov    (%esi),%ebx
+  80123e:	85 db                	test   %ebx,%ebx
+  801240:	75 09                	jne    80124b <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  801242:	89 d8                	mov    %ebx,%eax
+  801244:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801247:	5b                   	pop    %ebx
+  801248:	5e                   	pop    %esi
+  801249:	5d                   	pop    %ebp
+  80124a:	c3                   	ret
+  b->sb_n = 0;
+  80124b:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  801251:	53                   	push   %ebx
+  801252:	8d 46 04             	lea    0x4(%esi),%eax
+  801255:	50                   	push   %eax
+  801256:	e8 54 ff ff ff       	call   8011af <sys_batch>
+  80125b:	83 c4 08             	add    $0x8,%esp
+  80125e:	85 c0                	test   %eax,%eax
+  801260:	78 1e                	js     801280 <sysbatch_flush+0x4c>
+  if (r < n)
+  801262:	39 c3                	cmp    %eax,%ebx
+  801264:	7f 07                	jg     80126d <sysbatch_flush+0x39>
+  return 0;
+  801266:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80126b:	eb d5                	jmp    801242 <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  80126d:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801270:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  801274:	85 db                	test   %ebx,%ebx
+  801276:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80127b:	0f 49 d8             	cmovns %eax,%ebx
+  80127e:	eb c2                	jmp    801242 <sysbatch_flush+0xe>
+    return r;
+  801280:	89 c3                	mov    %eax,%ebx
+  801282:	eb be                	jmp    801242 <sysbatch_flush+0xe>
+
+00801284 <sysbatch_add>:
+{
+  801284:	55                   	push   %ebp
+  801285:	89 e5                	mov    %esp,%ebp
+  801287:	53                   	push   %ebx
+  801288:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  80128b:	83 3b 40             	cmpl   $0x40,(%ebx)
+  80128e:	74 41                	je     8012d1 <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  801290:	8b 03                	mov    (%ebx),%eax
+  801292:	8d 50 01             	lea    0x1(%eax),%edx
+  801295:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  801297:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80129a:	01 d8                	add    %ebx,%eax
+  80129c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80129f:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  8012a2:	8b 55 10             	mov    0x10(%ebp),%edx
+  8012a5:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  8012a8:	8b 55 14             	mov    0x14(%ebp),%edx
+  8012ab:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  8012ae:	8b 55 18             	mov    0x18(%ebp),%edx
+  8012b1:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  8012b4:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  8012b7:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  8012ba:	8b 55 20             	mov    0x20(%ebp),%edx
+  8012bd:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  8012c0:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  8012c7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8012cc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012cf:	c9                   	leave
+  8012d0:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  8012d1:	53                   	push   %ebx
+  8012d2:	e8 5d ff ff ff       	call   801234 <sysbatch_flush>
+  8012d7:	83 c4 04             	add    $0x4,%esp
+  8012da:	85 c0                	test   %eax,%eax
+  8012dc:	79 b2                	jns    801290 <sysbatch_add+0xc>
+  8012de:	eb ec                	jmp    8012cc <sysbatch_add+0x48>
+
+008012e0 <argstart>:
+#include <inc/args.h>
+#include <inc/string.h>
+
+void
+argstart(int *argc, char **argv, struct Argstate *args)
+{
+  8012e0:	55                   	push   %ebp
+  8012e1:	89 e5                	mov    %esp,%ebp
+  8012e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012e6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012e9:	8b 45 10             	mov    0x10(%ebp),%eax
+  args->argc = argc;
+  8012ec:	89 10                	mov    %edx,(%eax)
+  args->argv = (const char**)argv;
+  8012ee:	89 48 04             	mov    %ecx,0x4(%eax)
+  args->curarg = (*argc > 1 && argv ? "" : 0);
+  8012f1:	83 3a 01             	cmpl   $0x1,(%edx)
+  8012f4:	7e 09                	jle    8012ff <argstart+0x1f>
+  8012f6:	ba a8 33 80 00       	mov    $0x8033a8,%edx
+  8012fb:	85 c9                	test   %ecx,%ecx
+  8012fd:	75 05                	jne    801304 <argstart+0x24>
+  8012ff:	ba 00 00 00 00       	mov    $0x0,%edx
+  801304:	89 50 08             	mov    %edx,0x8(%eax)
+  args->argvalue = 0;
+  801307:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+}
+  80130e:	5d                   	pop    %ebp
+  80130f:	c3                   	ret
+
+00801310 <argnext>:
+
+int
+argnext(struct Argstate *args)
+{
+  801310:	55                   	push   %ebp
+  801311:	89 e5                	mov    %esp,%ebp
+  801313:	53                   	push   %ebx
+  801314:	83 ec 04             	sub    $0x4,%esp
+  801317:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int arg;
+
+  args->argvalue = 0;
+  80131a:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+
+  // Done processing arguments if args->curarg == 0
+  if (args->curarg == 0)
+  801321:	8b 43 08             	mov    0x8(%ebx),%eax
+  801324:	85 c0                	test   %eax,%eax
+  801326:	74 74                	je     80139c <argnext+0x8c>
+    return -1;
+
+  if (!*args->curarg) {
+  801328:	80 38 00             	cmpb   $0x0,(%eax)
+  80132b:	75 48                	jne    801375 <argnext+0x65>
+    // Need to process the next argument
+    // Check for end of argument list
+    if (*args->argc == 1
+  80132d:	8b 0b                	mov    (%ebx),%ecx
+  80132f:	83 39 01             	cmpl   $0x1,(%ecx)
+  801332:	74 5a                	je     80138e <argnext+0x7e>
+        || args->argv[1][0] != '-'
+  801334:	8b 53 04             	mov    0x4(%ebx),%edx
+  801337:	8b 42 04             	mov    0x4(%edx),%eax
+  80133a:	80 38 2d             	cmpb   $0x2d,(%eax)
+  80133d:	75 4f                	jne    80138e <argnext+0x7e>
+        || args->argv[1][1] == '\0')
+  80133f:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  801343:	74 49                	je     80138e <argnext+0x7e>
+      goto endofargs;
+    // Shift arguments down one
+    args->curarg = args->argv[1] + 1;
+  801345:	83 c0 01             	add    $0x1,%eax
+  801348:	89 43 08             	mov    %eax,0x8(%ebx)
+    memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  80134b:	83 ec 04             	sub    $0x4,%esp
+  80134e:	8b 01                	mov    (%ecx),%eax
+  801350:	8d 04 85 fc ff ff ff 	lea    -0x4(,%eax,4),%eax
+  801357:	50                   	push   %eax
+  801358:	8d 42 08             	lea    0x8(%edx),%eax
+  80135b:	50                   	push   %eax
+  80135c:	83 c2 04             	add    $0x4,%edx
+  80135f:	52                   	push   %edx
+  801360:	e8 23 f8 ff ff       	call   800b88 <memmove>
+    (*args->argc)--;
+  801365:	8b 03                	mov    (%ebx),%eax
+  801367:	83 28 01             	subl   $0x1,(%eax)
+    // Check for "--": end of argument list
+    if (args->curarg[0] == '-' && args->curarg[1] == '\0')
+  80136a:	8b 43 08             	mov    0x8(%ebx),%eax
+  80136d:	83 c4 10             	add    $0x10,%esp
+  801370:	80 38 2d             	cmpb   $0x2d,(%eax)
+  801373:	74 13                	je     801388 <argnext+0x78>
+      goto endofargs;
+  }
+
+  arg = (unsigned char)*args->curarg;
+  801375:	8b 43 08             	mov    0x8(%ebx),%eax
+  801378:	0f b6 10             	movzbl (%eax),%edx
+  args->curarg++;
+  80137b:	83 c0 01             	add    $0x1,%eax
+  80137e:	89 43 08             	mov    %eax,0x8(%ebx)
+  return arg;
+
+endofargs:
+  args->curarg = 0;
+  return -1;
+}
+  801381:	89 d0                	mov    %edx,%eax
+  801383:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801386:	c9                   	leave
+  801387:	c3                   	ret
+    if (args->curarg[0] == '-' && args->curarg[1] == '\0')
+  801388:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  80138c:	75 e7                	jne    801375 <argnext+0x65>
+  args->curarg = 0;
+  80138e:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  return -1;
+  801395:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  80139a:	eb e5                	jmp    801381 <argnext+0x71>
+    return -1;
+  80139c:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8013a1:	eb de                	jmp    801381 <argnext+0x71>
+
+008013a3 <argnextvalue>:
+  return (char*)(args->argvalue ? args->argvalue : argnextvalue(args));
+}
+
+char *
+argnextvalue(struct Argstate *args)
+{
+  8013a3:	55                   	push   %ebp
+  8013a4:	89 e5                	mov    %esp,%ebp
+  8013a6:	53                   	push   %ebx
+  8013a7:	83 ec 04             	sub    $0x4,%esp
+  8013aa:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (!args->curarg)
+  8013ad:	8b 43 08             	mov    0x8(%ebx),%eax
+  8013b0:	85 c0                	test   %eax,%eax
+  8013b2:	74 12                	je     8013c6 <argnextvalue+0x23>
+    return 0;
+  if (*args->curarg) {
+  8013b4:	80 38 00             	cmpb   $0x0,(%eax)
+  8013b7:	74 12                	je     8013cb <argnextvalue+0x28>
+    args->argvalue = args->curarg;
+  8013b9:	89 43 0c             	mov    %eax,0xc(%ebx)
+    args->curarg = "";
+  8013bc:	c7 43 08 a8 33 80 00 	movl   $0x8033a8,0x8(%ebx)
+    (*args->argc)--;
+  } else {
+    args->argvalue = 0;
+    args->curarg = 0;
+  }
+  return (char*)args->argvalue;
+  8013c3:	8b 43 0c             	mov    0xc(%ebx),%eax
+}
+  8013c6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013c9:	c9                   	leave
+  8013ca:	c3                   	ret
+  } else if (*args->argc > 1) {
+  8013cb:	8b 13                	mov    (%ebx),%edx
+  8013cd:	83 3a 01             	cmpl   $0x1,(%edx)
+  8013d0:	7f 10                	jg     8013e2 <argnextvalue+0x3f>
+    args->argvalue = 0;
+  8013d2:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+    args->curarg = 0;
+  8013d9:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  8013e0:	eb e1                	jmp    8013c3 <argnextvalue+0x20>
+    args->argvalue = args->argv[1];
+  8013e2:	8b 43 04             	mov    0x4(%ebx),%eax
+  8013e5:	8b 48 04             	mov    0x4(%eax),%ecx
+  8013e8:	89 4b 0c             	mov    %ecx,0xc(%ebx)
+    memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  8013eb:	83 ec 04             	sub    $0x4,%esp
+  8013ee:	8b 12                	mov    (%edx),%edx
+  8013f0:	8d 14 95 fc ff ff ff 	lea    -0x4(,%edx,4),%edx
+  8013f7:	52                   	push   %edx
+  8013f8:	8d 50 08             	lea    0x8(%eax),%edx
+  8013fb:	52                   	push   %edx
+  8013fc:	83 c0 04             	add    $0x4,%eax
+  8013ff:	50                   	push   %eax
+  801400:	e8 83 f7 ff ff       	call   800b88 <memmove>
+    (*args->argc)--;
+  801405:	8b 03                	mov    (%ebx),%eax
+  801407:	83 28 01             	subl   $0x1,(%eax)
+  80140a:	83 c4 10             	add    $0x10,%esp
+  80140d:	eb b4                	jmp    8013c3 <argnextvalue+0x20>
+
+0080140f <argvalue>:
+{
+  80140f:	55                   	push   %ebp
+  801410:	89 e5                	mov    %esp,%ebp
+  801412:	83 ec 08             	sub    $0x8,%esp
+  801415:	8b 55 08             	mov    0x8(%ebp),%edx
+  return (char*)(args->argvalue ? args->argvalue : argnextvalue(args));
+  801418:	8b 42 0c             	mov    0xc(%edx),%eax
+  80141b:	85 c0                	test   %eax,%eax
+  80141d:	74 02                	je     801421 <argvalue+0x12>
+}
+  80141f:	c9                   	leave
+  801420:	c3                   	ret
+  return (char*)(args->argvalue ? args->argvalue : argnextvalue(args));
+  801421:	83 ec 0c             	sub    $0xc,%esp
+  801424:	52                   	push   %edx
+  801425:	e8 79 ff ff ff       	call   8013a3 <argnextvalue>
+  80142a:	83 c4 10             	add    $0x10,%esp
+  80142d:	eb f0                	jmp    80141f <argvalue+0x10>
+
+0080142f <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80142f:	55                   	push   %ebp
+  801430:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801432:	8b 45 08             	mov    0x8(%ebp),%eax
+  801435:	05 00 00 00 30       	add    $0x30000000,%eax
+  80143a:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80143d:	5d                   	pop    %ebp
+  80143e:	c3                   	ret
+
+0080143f <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80143f:	55                   	push   %ebp
+  801440:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801442:	8b 45 08             	mov    0x8(%ebp),%eax
+  801445:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  801448:	66 b8 00 00          	mov    $0x0,%ax
+  80144c:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801451:	5d                   	pop    %ebp
+  801452:	c3                   	ret
+
+00801453 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801453:	55                   	push   %ebp
+  801454:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  801456:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80145b:	eb 02                	jmp    80145f <fd_alloc+0xc>
+  80145d:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80145f:	89 c2                	mov    %eax,%edx
+  801461:	c1 ea 16             	shr    $0x16,%edx
+  801464:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80146b:	f6 c2 01             	test   $0x1,%dl
+  80146e:	74 2b                	je     80149b <fd_alloc+0x48>
+  801470:	89 c2                	mov    %eax,%edx
+  801472:	c1 ea 0c             	shr    $0xc,%edx
+  801475:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80147c:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801482:	f6 c1 01             	test   $0x1,%cl
+  801485:	74 14                	je     80149b <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  801487:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  80148d:	75 ce                	jne    80145d <fd_alloc+0xa>
+  80148f:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  801494:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801499:	eb 05                	jmp    8014a0 <fd_alloc+0x4d>
+      return 0;
+  80149b:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  8014a0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014a3:	89 02                	mov    %eax,(%edx)
+}
+  8014a5:	89 c8                	mov    %ecx,%eax
+  8014a7:	5d                   	pop    %ebp
+  8014a8:	c3                   	ret
+
+008014a9 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8014a9:	55                   	push   %ebp
+  8014aa:	89 e5                	mov    %esp,%ebp
+  8014ac:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  8014af:	83 f8 1f             	cmp    $0x1f,%eax
+  8014b2:	77 30                	ja     8014e4 <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  8014b4:	c1 e0 0c             	shl    $0xc,%eax
+  8014b7:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8014bc:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8014c2:	f6 c2 01             	test   $0x1,%dl
+  8014c5:	74 24                	je     8014eb <fd_lookup+0x42>
+  8014c7:	89 c2                	mov    %eax,%edx
+  8014c9:	c1 ea 0c             	shr    $0xc,%edx
+  8014cc:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8014d3:	f6 c2 01             	test   $0x1,%dl
+  8014d6:	74 1a                	je     8014f2 <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  8014d8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8014db:	89 02                	mov    %eax,(%edx)
+  return 0;
+  8014dd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8014e2:	5d                   	pop    %ebp
+  8014e3:	c3                   	ret
+    return -E_INVAL;
+  8014e4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014e9:	eb f7                	jmp    8014e2 <fd_lookup+0x39>
+    return -E_INVAL;
+  8014eb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014f0:	eb f0                	jmp    8014e2 <fd_lookup+0x39>
+  8014f2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014f7:	eb e9                	jmp    8014e2 <fd_lookup+0x39>
+
+008014f9 <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8014f9:	55                   	push   %ebp
+  8014fa:	89 e5                	mov    %esp,%ebp
+  8014fc:	53                   	push   %ebx
+  8014fd:	83 ec 04             	sub    $0x4,%esp
+  801500:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  801503:	b8 ac 37 80 00       	mov    $0x8037ac,%eax
+  801508:	8b 18                	mov    (%eax),%ebx
+  80150a:	85 db                	test   %ebx,%ebx
+  80150c:	74 0e                	je     80151c <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  80150e:	83 c0 04             	add    $0x4,%eax
+  801511:	39 13                	cmp    %edx,(%ebx)
+  801513:	75 f3                	jne    801508 <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  801515:	b8 00 00 00 00       	mov    $0x0,%eax
+  80151a:	eb 1f                	jmp    80153b <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80151c:	a1 60 5b 80 00       	mov    0x805b60,%eax
+  801521:	8b 40 48             	mov    0x48(%eax),%eax
+  801524:	83 ec 04             	sub    $0x4,%esp
+  801527:	52                   	push   %edx
+  801528:	50                   	push   %eax
+  801529:	68 30 37 80 00       	push   $0x803730
+  80152e:	e8 e1 ee ff ff       	call   800414 <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  801533:	83 c4 10             	add    $0x10,%esp
+  801536:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  80153b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80153e:	89 1a                	mov    %ebx,(%edx)
+}
+  801540:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801543:	c9                   	leave
+  801544:	c3                   	ret
+
+00801545 <fd_close>:
+{
+  801545:	55                   	push   %ebp
+  801546:	89 e5                	mov    %esp,%ebp
+  801548:	57                   	push   %edi
+  801549:	56                   	push   %esi
+  80154a:	53                   	push   %ebx
+  80154b:	83 ec 24             	sub    $0x24,%esp
+  80154e:	8b 75 08             	mov    0x8(%ebp),%esi
+  801551:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801554:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801557:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801558:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80155e:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801561:	50                   	push   %eax
+  801562:	e8 42 ff ff ff       	call   8014a9 <fd_lookup>
+  801567:	89 c3                	mov    %eax,%ebx
+  801569:	83 c4 10             	add    $0x10,%esp
+  80156c:	85 c0                	test   %eax,%eax
+  80156e:	78 05                	js     801575 <fd_close+0x30>
+      || fd != fd2)
+  801570:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801573:	74 16                	je     80158b <fd_close+0x46>
+    return must_exist ? r : 0;
+  801575:	89 f8                	mov    %edi,%eax
+  801577:	84 c0                	test   %al,%al
+  801579:	b8 00 00 00 00       	mov    $0x0,%eax
+  80157e:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801581:	89 d8                	mov    %ebx,%eax
+  801583:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801586:	5b                   	pop    %ebx
+  801587:	5e                   	pop    %esi
+  801588:	5f                   	pop    %edi
+  801589:	5d                   	pop    %ebp
+  80158a:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80158b:	83 ec 08             	sub    $0x8,%esp
+  80158e:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801591:	50                   	push   %eax
+  801592:	ff 36                	push   (%esi)
+  801594:	e8 60 ff ff ff       	call   8014f9 <dev_lookup>
+  801599:	89 c3                	mov    %eax,%ebx
+  80159b:	83 c4 10             	add    $0x10,%esp
+  80159e:	85 c0                	test   %eax,%eax
+  8015a0:	78 1a                	js     8015bc <fd_close+0x77>
+    if (dev->dev_close)
+  8015a2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8015a5:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  8015a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  8015ad:	85 c0                	test   %eax,%eax
+  8015af:	74 0b                	je     8015bc <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  8015b1:	83 ec 0c             	sub    $0xc,%esp
+  8015b4:	56                   	push   %esi
+  8015b5:	ff d0                	call   *%eax
+  8015b7:	89 c3                	mov    %eax,%ebx
+  8015b9:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  8015bc:	83 ec 08             	sub    $0x8,%esp
+  8015bf:	56                   	push   %esi
+  8015c0:	6a 00                	push   $0x0
+  8015c2:	e8 ef f8 ff ff       	call   800eb6 <sys_page_unmap>
+  return r;
+  8015c7:	83 c4 10             	add    $0x10,%esp
+  8015ca:	eb b5                	jmp    801581 <fd_close+0x3c>
+
+008015cc <close>:
+
+int
+close(int fdnum)
+{
+  8015cc:	55                   	push   %ebp
+  8015cd:	89 e5                	mov    %esp,%ebp
+  8015cf:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8015d2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015d5:	50                   	push   %eax
+  8015d6:	ff 75 08             	push   0x8(%ebp)
+  8015d9:	e8 cb fe ff ff       	call   8014a9 <fd_lookup>
+  8015de:	83 c4 10             	add    $0x10,%esp
+  8015e1:	85 c0                	test   %eax,%eax
+  8015e3:	79 02                	jns    8015e7 <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  8015e5:	c9                   	leave
+  8015e6:	c3                   	ret
+    return fd_close(fd, 1);
+  8015e7:	83 ec 08             	sub    $0x8,%esp
+  8015ea:	6a 01                	push   $0x1
+  8015ec:	ff 75 f4             	push   -0xc(%ebp)
+  8015ef:	e8 51 ff ff ff       	call   801545 <fd_close>
+  8015f4:	83 c4 10             	add    $0x10,%esp
+  8015f7:	eb ec                	jmp    8015e5 <close+0x19>
+
+008015f9 <close_all>:
+
+void
+close_all(void)
+{
+  8015f9:	55                   	push   %ebp
+  8015fa:	89 e5                	mov    %esp,%ebp
+  8015fc:	53                   	push   %ebx
+  8015fd:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  801600:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  801605:	83 ec 0c             	sub    $0xc,%esp
+  801608:	53                   	push   %ebx
+  801609:	e8 be ff ff ff       	call   8015cc <close>
+  for (i = 0; i < MAXFD; i++)
+  80160e:	83 c3 01             	add    $0x1,%ebx
+  801611:	83 c4 10             	add    $0x10,%esp
+  801614:	83 fb 20             	cmp    $0x20,%ebx
+  801617:	75 ec                	jne    801605 <close_all+0xc>
+}
+  801619:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80161c:	c9                   	leave
+  80161d:	c3                   	ret
+
+0080161e <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80161e:	55                   	push   %ebp
+  80161f:	89 e5                	mov    %esp,%ebp
+  801621:	57                   	push   %edi
+  801622:	56                   	push   %esi
+  801623:	53                   	push   %ebx
+  801624:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801627:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80162a:	50                   	push   %eax
+  80162b:	ff 75 08             	push   0x8(%ebp)
+  80162e:	e8 76 fe ff ff       	call   8014a9 <fd_lookup>
+  801633:	89 c6                	mov    %eax,%esi
+  801635:	83 c4 10             	add    $0x10,%esp
+  801638:	85 c0                	test   %eax,%eax
+  80163a:	0f 88 0a 01 00 00    	js     80174a <dup+0x12c>
+    return r;
+  close(newfdnum);
+  801640:	83 ec 0c             	sub    $0xc,%esp
+  801643:	ff 75 0c             	push   0xc(%ebp)
+  801646:	e8 81 ff ff ff       	call   8015cc <close>
+
+  newfd = INDEX2FD(newfdnum);
+  80164b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80164e:	c1 e0 0c             	shl    $0xc,%eax
+  801651:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  801657:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  80165a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80165d:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  801660:	89 04 24             	mov    %eax,(%esp)
+  801663:	e8 d7 fd ff ff       	call   80143f <fd2data>
+  801668:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  80166a:	89 3c 24             	mov    %edi,(%esp)
+  80166d:	e8 cd fd ff ff       	call   80143f <fd2data>
+  801672:	83 c4 10             	add    $0x10,%esp
+  801675:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801678:	89 f3                	mov    %esi,%ebx
+  80167a:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  801680:	89 c6                	mov    %eax,%esi
+  801682:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801685:	89 cf                	mov    %ecx,%edi
+  801687:	eb 0c                	jmp    801695 <dup+0x77>
+  801689:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80168f:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801695:	39 fb                	cmp    %edi,%ebx
+  801697:	74 7b                	je     801714 <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  801699:	89 d8                	mov    %ebx,%eax
+  80169b:	c1 e8 16             	shr    $0x16,%eax
+  80169e:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8016a5:	a8 01                	test   $0x1,%al
+  8016a7:	74 e0                	je     801689 <dup+0x6b>
+  8016a9:	89 d8                	mov    %ebx,%eax
+  8016ab:	c1 e8 0c             	shr    $0xc,%eax
+  8016ae:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8016b5:	f6 c2 01             	test   $0x1,%dl
+  8016b8:	74 cf                	je     801689 <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  8016ba:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  8016c1:	83 ec 0c             	sub    $0xc,%esp
+  8016c4:	25 07 0e 00 00       	and    $0xe07,%eax
+  8016c9:	50                   	push   %eax
+  8016ca:	56                   	push   %esi
+  8016cb:	6a 00                	push   $0x0
+  8016cd:	53                   	push   %ebx
+  8016ce:	6a 00                	push   $0x0
+  8016d0:	e8 9f f7 ff ff       	call   800e74 <sys_page_map>
+  8016d5:	83 c4 20             	add    $0x20,%esp
+  8016d8:	85 c0                	test   %eax,%eax
+  8016da:	79 ad                	jns    801689 <dup+0x6b>
+  8016dc:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8016df:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  8016e1:	83 ec 08             	sub    $0x8,%esp
+  8016e4:	ff 75 d4             	push   -0x2c(%ebp)
+  8016e7:	6a 00                	push   $0x0
+  8016e9:	e8 c8 f7 ff ff       	call   800eb6 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8016ee:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  8016f1:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  8016f7:	83 c4 10             	add    $0x10,%esp
+  8016fa:	39 df                	cmp    %ebx,%edi
+  8016fc:	74 4c                	je     80174a <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  8016fe:	83 ec 08             	sub    $0x8,%esp
+  801701:	57                   	push   %edi
+  801702:	6a 00                	push   $0x0
+  801704:	e8 ad f7 ff ff       	call   800eb6 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801709:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  80170f:	83 c4 10             	add    $0x10,%esp
+  801712:	eb e6                	jmp    8016fa <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801714:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801717:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80171a:	89 c8                	mov    %ecx,%eax
+  80171c:	c1 e8 0c             	shr    $0xc,%eax
+  80171f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801726:	83 ec 0c             	sub    $0xc,%esp
+  801729:	25 07 0e 00 00       	and    $0xe07,%eax
+  80172e:	50                   	push   %eax
+  80172f:	ff 75 d4             	push   -0x2c(%ebp)
+  801732:	6a 00                	push   $0x0
+  801734:	51                   	push   %ecx
+  801735:	6a 00                	push   $0x0
+  801737:	e8 38 f7 ff ff       	call   800e74 <sys_page_map>
+  80173c:	89 c6                	mov    %eax,%esi
+  80173e:	83 c4 20             	add    $0x20,%esp
+  801741:	85 c0                	test   %eax,%eax
+  801743:	78 9c                	js     8016e1 <dup+0xc3>
+  return newfdnum;
+  801745:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801748:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  80174a:	89 f0                	mov    %esi,%eax
+  80174c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80174f:	5b                   	pop    %ebx
+  801750:	5e                   	pop    %esi
+  801751:	5f                   	pop    %edi
+  801752:	5d                   	pop    %ebp
+  801753:	c3                   	ret
+
+00801754 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801754:	55                   	push   %ebp
+  801755:	89 e5                	mov    %esp,%ebp
+  801757:	56                   	push   %esi
+  801758:	53                   	push   %ebx
+  801759:	83 ec 18             	sub    $0x18,%esp
+  80175c:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  80175f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801762:	50                   	push   %eax
+  801763:	56                   	push   %esi
+  801764:	e8 40 fd ff ff       	call   8014a9 <fd_lookup>
+  801769:	83 c4 10             	add    $0x10,%esp
+  80176c:	85 c0                	test   %eax,%eax
+  80176e:	78 3c                	js     8017ac <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801770:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801773:	83 ec 08             	sub    $0x8,%esp
+  801776:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801779:	50                   	push   %eax
+  80177a:	ff 33                	push   (%ebx)
+  80177c:	e8 78 fd ff ff       	call   8014f9 <dev_lookup>
+  801781:	83 c4 10             	add    $0x10,%esp
+  801784:	85 c0                	test   %eax,%eax
+  801786:	78 24                	js     8017ac <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801788:	8b 43 08             	mov    0x8(%ebx),%eax
+  80178b:	83 e0 03             	and    $0x3,%eax
+  80178e:	83 f8 01             	cmp    $0x1,%eax
+  801791:	74 20                	je     8017b3 <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  801793:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801796:	8b 40 08             	mov    0x8(%eax),%eax
+  801799:	85 c0                	test   %eax,%eax
+  80179b:	74 37                	je     8017d4 <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  80179d:	83 ec 04             	sub    $0x4,%esp
+  8017a0:	ff 75 10             	push   0x10(%ebp)
+  8017a3:	ff 75 0c             	push   0xc(%ebp)
+  8017a6:	53                   	push   %ebx
+  8017a7:	ff d0                	call   *%eax
+  8017a9:	83 c4 10             	add    $0x10,%esp
+}
+  8017ac:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017af:	5b                   	pop    %ebx
+  8017b0:	5e                   	pop    %esi
+  8017b1:	5d                   	pop    %ebp
+  8017b2:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8017b3:	a1 60 5b 80 00       	mov    0x805b60,%eax
+  8017b8:	8b 40 48             	mov    0x48(%eax),%eax
+  8017bb:	83 ec 04             	sub    $0x4,%esp
+  8017be:	56                   	push   %esi
+  8017bf:	50                   	push   %eax
+  8017c0:	68 71 37 80 00       	push   $0x803771
+  8017c5:	e8 4a ec ff ff       	call   800414 <cprintf>
+    return -E_INVAL;
+  8017ca:	83 c4 10             	add    $0x10,%esp
+  8017cd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017d2:	eb d8                	jmp    8017ac <read+0x58>
+    return -E_NOT_SUPP;
+  8017d4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017d9:	eb d1                	jmp    8017ac <read+0x58>
+
+008017db <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8017db:	55                   	push   %ebp
+  8017dc:	89 e5                	mov    %esp,%ebp
+  8017de:	57                   	push   %edi
+  8017df:	56                   	push   %esi
+  8017e0:	53                   	push   %ebx
+  8017e1:	83 ec 0c             	sub    $0xc,%esp
+  8017e4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8017e7:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  8017ea:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017ef:	eb 02                	jmp    8017f3 <readn+0x18>
+  8017f1:	01 c3                	add    %eax,%ebx
+  8017f3:	39 f3                	cmp    %esi,%ebx
+  8017f5:	73 21                	jae    801818 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  8017f7:	83 ec 04             	sub    $0x4,%esp
+  8017fa:	89 f0                	mov    %esi,%eax
+  8017fc:	29 d8                	sub    %ebx,%eax
+  8017fe:	50                   	push   %eax
+  8017ff:	89 d8                	mov    %ebx,%eax
+  801801:	03 45 0c             	add    0xc(%ebp),%eax
+  801804:	50                   	push   %eax
+  801805:	57                   	push   %edi
+  801806:	e8 49 ff ff ff       	call   801754 <read>
+    if (m < 0)
+  80180b:	83 c4 10             	add    $0x10,%esp
+  80180e:	85 c0                	test   %eax,%eax
+  801810:	78 04                	js     801816 <readn+0x3b>
+      return m;
+    if (m == 0)
+  801812:	75 dd                	jne    8017f1 <readn+0x16>
+  801814:	eb 02                	jmp    801818 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  801816:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  801818:	89 d8                	mov    %ebx,%eax
+  80181a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80181d:	5b                   	pop    %ebx
+  80181e:	5e                   	pop    %esi
+  80181f:	5f                   	pop    %edi
+  801820:	5d                   	pop    %ebp
+  801821:	c3                   	ret
+
+00801822 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801822:	55                   	push   %ebp
+  801823:	89 e5                	mov    %esp,%ebp
+  801825:	56                   	push   %esi
+  801826:	53                   	push   %ebx
+  801827:	83 ec 18             	sub    $0x18,%esp
+  80182a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  80182d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801830:	50                   	push   %eax
+  801831:	53                   	push   %ebx
+  801832:	e8 72 fc ff ff       	call   8014a9 <fd_lookup>
+  801837:	83 c4 10             	add    $0x10,%esp
+  80183a:	85 c0                	test   %eax,%eax
+  80183c:	78 37                	js     801875 <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80183e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801841:	83 ec 08             	sub    $0x8,%esp
+  801844:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801847:	50                   	push   %eax
+  801848:	ff 36                	push   (%esi)
+  80184a:	e8 aa fc ff ff       	call   8014f9 <dev_lookup>
+  80184f:	83 c4 10             	add    $0x10,%esp
+  801852:	85 c0                	test   %eax,%eax
+  801854:	78 1f                	js     801875 <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801856:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80185a:	74 20                	je     80187c <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  80185c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80185f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801862:	85 c0                	test   %eax,%eax
+  801864:	74 37                	je     80189d <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  801866:	83 ec 04             	sub    $0x4,%esp
+  801869:	ff 75 10             	push   0x10(%ebp)
+  80186c:	ff 75 0c             	push   0xc(%ebp)
+  80186f:	56                   	push   %esi
+  801870:	ff d0                	call   *%eax
+  801872:	83 c4 10             	add    $0x10,%esp
+}
+  801875:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801878:	5b                   	pop    %ebx
+  801879:	5e                   	pop    %esi
+  80187a:	5d                   	pop    %ebp
+  80187b:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80187c:	a1 60 5b 80 00       	mov    0x805b60,%eax
+  801881:	8b 40 48             	mov    0x48(%eax),%eax
+  801884:	83 ec 04             	sub    $0x4,%esp
+  801887:	53                   	push   %ebx
+  801888:	50                   	push   %eax
+  801889:	68 8d 37 80 00       	push   $0x80378d
+  80188e:	e8 81 eb ff ff       	call   800414 <cprintf>
+    return -E_INVAL;
+  801893:	83 c4 10             	add    $0x10,%esp
+  801896:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80189b:	eb d8                	jmp    801875 <write+0x53>
+    return -E_NOT_SUPP;
+  80189d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8018a2:	eb d1                	jmp    801875 <write+0x53>
+
+008018a4 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8018a4:	55                   	push   %ebp
+  8018a5:	89 e5                	mov    %esp,%ebp
+  8018a7:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8018aa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018ad:	50                   	push   %eax
+  8018ae:	ff 75 08             	push   0x8(%ebp)
+  8018b1:	e8 f3 fb ff ff       	call   8014a9 <fd_lookup>
+  8018b6:	83 c4 10             	add    $0x10,%esp
+  8018b9:	85 c0                	test   %eax,%eax
+  8018bb:	78 0e                	js     8018cb <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  8018bd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8018c0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018c3:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  8018c6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018cb:	c9                   	leave
+  8018cc:	c3                   	ret
+
+008018cd <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8018cd:	55                   	push   %ebp
+  8018ce:	89 e5                	mov    %esp,%ebp
+  8018d0:	56                   	push   %esi
+  8018d1:	53                   	push   %ebx
+  8018d2:	83 ec 18             	sub    $0x18,%esp
+  8018d5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  8018d8:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018db:	50                   	push   %eax
+  8018dc:	53                   	push   %ebx
+  8018dd:	e8 c7 fb ff ff       	call   8014a9 <fd_lookup>
+  8018e2:	83 c4 10             	add    $0x10,%esp
+  8018e5:	85 c0                	test   %eax,%eax
+  8018e7:	78 34                	js     80191d <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8018e9:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8018ec:	83 ec 08             	sub    $0x8,%esp
+  8018ef:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018f2:	50                   	push   %eax
+  8018f3:	ff 36                	push   (%esi)
+  8018f5:	e8 ff fb ff ff       	call   8014f9 <dev_lookup>
+  8018fa:	83 c4 10             	add    $0x10,%esp
+  8018fd:	85 c0                	test   %eax,%eax
+  8018ff:	78 1c                	js     80191d <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801901:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801905:	74 1d                	je     801924 <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  801907:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80190a:	8b 40 18             	mov    0x18(%eax),%eax
+  80190d:	85 c0                	test   %eax,%eax
+  80190f:	74 34                	je     801945 <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  801911:	83 ec 08             	sub    $0x8,%esp
+  801914:	ff 75 0c             	push   0xc(%ebp)
+  801917:	56                   	push   %esi
+  801918:	ff d0                	call   *%eax
+  80191a:	83 c4 10             	add    $0x10,%esp
+}
+  80191d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801920:	5b                   	pop    %ebx
+  801921:	5e                   	pop    %esi
+  801922:	5d                   	pop    %ebp
+  801923:	c3                   	ret
+            thisenv->env_id, fdnum);
+  801924:	a1 60 5b 80 00       	mov    0x805b60,%eax
+  801929:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80192c:	83 ec 04             	sub    $0x4,%esp
+  80192f:	53                   	push   %ebx
+  801930:	50                   	push   %eax
+  801931:	68 50 37 80 00       	push   $0x803750
+  801936:	e8 d9 ea ff ff       	call   800414 <cprintf>
+    return -E_INVAL;
+  80193b:	83 c4 10             	add    $0x10,%esp
+  80193e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801943:	eb d8                	jmp    80191d <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  801945:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80194a:	eb d1                	jmp    80191d <ftruncate+0x50>
+
+0080194c <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80194c:	55                   	push   %ebp
+  80194d:	89 e5                	mov    %esp,%ebp
+  80194f:	56                   	push   %esi
+  801950:	53                   	push   %ebx
+  801951:	83 ec 18             	sub    $0x18,%esp
+  801954:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801957:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80195a:	50                   	push   %eax
+  80195b:	ff 75 08             	push   0x8(%ebp)
+  80195e:	e8 46 fb ff ff       	call   8014a9 <fd_lookup>
+  801963:	83 c4 10             	add    $0x10,%esp
+  801966:	85 c0                	test   %eax,%eax
+  801968:	78 49                	js     8019b3 <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80196a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80196d:	83 ec 08             	sub    $0x8,%esp
+  801970:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801973:	50                   	push   %eax
+  801974:	ff 36                	push   (%esi)
+  801976:	e8 7e fb ff ff       	call   8014f9 <dev_lookup>
+  80197b:	83 c4 10             	add    $0x10,%esp
+  80197e:	85 c0                	test   %eax,%eax
+  801980:	78 31                	js     8019b3 <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  801982:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801985:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801989:	74 2f                	je     8019ba <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  80198b:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  80198e:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801995:	00 00 00 
+  stat->st_isdir = 0;
+  801998:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80199f:	00 00 00 
+  stat->st_dev = dev;
+  8019a2:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  8019a8:	83 ec 08             	sub    $0x8,%esp
+  8019ab:	53                   	push   %ebx
+  8019ac:	56                   	push   %esi
+  8019ad:	ff 50 14             	call   *0x14(%eax)
+  8019b0:	83 c4 10             	add    $0x10,%esp
+}
+  8019b3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019b6:	5b                   	pop    %ebx
+  8019b7:	5e                   	pop    %esi
+  8019b8:	5d                   	pop    %ebp
+  8019b9:	c3                   	ret
+    return -E_NOT_SUPP;
+  8019ba:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8019bf:	eb f2                	jmp    8019b3 <fstat+0x67>
+
+008019c1 <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  8019c1:	55                   	push   %ebp
+  8019c2:	89 e5                	mov    %esp,%ebp
+  8019c4:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  8019c7:	ff 75 0c             	push   0xc(%ebp)
+  8019ca:	ff 75 08             	push   0x8(%ebp)
+  8019cd:	e8 58 07 00 00       	call   80212a <file_stat>
+}
+  8019d2:	c9                   	leave
+  8019d3:	c3                   	ret
+
+008019d4 <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  8019d4:	55                   	push   %ebp
+  8019d5:	89 e5                	mov    %esp,%ebp
+  8019d7:	57                   	push   %edi
+  8019d8:	56                   	push   %esi
+  8019d9:	53                   	push   %ebx
+  8019da:	83 ec 1c             	sub    $0x1c,%esp
+  8019dd:	89 c7                	mov    %eax,%edi
+  8019df:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8019e2:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8019e5:	e9 a2 00 00 00       	jmp    801a8c <fsipc_send+0xb8>
+  nfsenvs = 0;
+  8019ea:	c7 05 00 50 80 00 00 	movl   $0x0,0x805000
+  8019f1:	00 00 00 
+  8019f4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019f9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  8019fe:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801a03:	be 01 00 00 00       	mov    $0x1,%esi
+  801a08:	eb 0f                	jmp    801a19 <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801a0a:	83 c0 01             	add    $0x1,%eax
+  801a0d:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801a12:	74 49                	je     801a5d <fsipc_send+0x89>
+  801a14:	83 f9 07             	cmp    $0x7,%ecx
+  801a17:	7f 50                	jg     801a69 <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  801a19:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801a1c:	c1 e2 04             	shl    $0x4,%edx
+  801a1f:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801a25:	8b 52 50             	mov    0x50(%edx),%edx
+  801a28:	83 fa 01             	cmp    $0x1,%edx
+  801a2b:	75 dd                	jne    801a0a <fsipc_send+0x36>
+  801a2d:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801a30:	c1 e2 04             	shl    $0x4,%edx
+  801a33:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801a39:	8b 52 54             	mov    0x54(%edx),%edx
+  801a3c:	85 d2                	test   %edx,%edx
+  801a3e:	74 ca                	je     801a0a <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801a40:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801a43:	c1 e2 04             	shl    $0x4,%edx
+  801a46:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801a4c:	8b 52 48             	mov    0x48(%edx),%edx
+  801a4f:	89 14 8d 20 50 80 00 	mov    %edx,0x805020(,%ecx,4)
+  801a56:	8d 49 01             	lea    0x1(%ecx),%ecx
+  801a59:	89 f3                	mov    %esi,%ebx
+  801a5b:	eb ad                	jmp    801a0a <fsipc_send+0x36>
+  801a5d:	84 db                	test   %bl,%bl
+  801a5f:	74 38                	je     801a99 <fsipc_send+0xc5>
+  801a61:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  801a67:	eb 30                	jmp    801a99 <fsipc_send+0xc5>
+  801a69:	84 db                	test   %bl,%bl
+  801a6b:	74 2c                	je     801a99 <fsipc_send+0xc5>
+  801a6d:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  801a73:	eb 24                	jmp    801a99 <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  801a75:	50                   	push   %eax
+  801a76:	68 bc 37 80 00       	push   $0x8037bc
+  801a7b:	6a 34                	push   $0x34
+  801a7d:	68 c6 37 80 00       	push   $0x8037c6
+  801a82:	e8 b2 e8 ff ff       	call   800339 <_panic>
+    }
+    sys_yield();
+  801a87:	e8 43 f3 ff ff       	call   800dcf <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  801a8c:	83 3d 00 50 80 00 03 	cmpl   $0x3,0x805000
+  801a93:	0f 8e 51 ff ff ff    	jle    8019ea <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  801a99:	a1 60 5b 80 00       	mov    0x805b60,%eax
+  801a9e:	8b 70 48             	mov    0x48(%eax),%esi
+  801aa1:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  801aa7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801aac:	8b 0d 00 50 80 00    	mov    0x805000,%ecx
+  801ab2:	39 d9                	cmp    %ebx,%ecx
+  801ab4:	7e d1                	jle    801a87 <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  801ab6:	83 ec 0c             	sub    $0xc,%esp
+  801ab9:	ff 75 e0             	push   -0x20(%ebp)
+  801abc:	6a 07                	push   $0x7
+  801abe:	ff 75 e4             	push   -0x1c(%ebp)
+  801ac1:	57                   	push   %edi
+  801ac2:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  801ac5:	99                   	cltd
+  801ac6:	f7 f9                	idiv   %ecx
+  801ac8:	ff 34 95 20 50 80 00 	push   0x805020(,%edx,4)
+  801acf:	e8 14 f6 ff ff       	call   8010e8 <sys_ipc_try_send>
+      if (r == 0)
+  801ad4:	83 c4 20             	add    $0x20,%esp
+  801ad7:	85 c0                	test   %eax,%eax
+  801ad9:	74 0a                	je     801ae5 <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  801adb:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801ade:	75 95                	jne    801a75 <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  801ae0:	83 c3 01             	add    $0x1,%ebx
+  801ae3:	eb c7                	jmp    801aac <fsipc_send+0xd8>
+  }
+}
+  801ae5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ae8:	5b                   	pop    %ebx
+  801ae9:	5e                   	pop    %esi
+  801aea:	5f                   	pop    %edi
+  801aeb:	5d                   	pop    %ebp
+  801aec:	c3                   	ret
+
+00801aed <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801aed:	55                   	push   %ebp
+  801aee:	89 e5                	mov    %esp,%ebp
+  801af0:	53                   	push   %ebx
+  801af1:	83 ec 14             	sub    $0x14,%esp
+  801af4:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  801af6:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  801afd:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801b02:	ba 00 60 80 00       	mov    $0x806000,%edx
+  801b07:	e8 c8 fe ff ff       	call   8019d4 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801b0c:	6a 00                	push   $0x0
+  801b0e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b11:	50                   	push   %eax
+  801b12:	53                   	push   %ebx
+  801b13:	6a 00                	push   $0x0
+  801b15:	e8 3a 14 00 00       	call   802f54 <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  801b1a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b1d:	c9                   	leave
+  801b1e:	c3                   	ret
+
+00801b1f <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801b1f:	55                   	push   %ebp
+  801b20:	89 e5                	mov    %esp,%ebp
+  801b22:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801b25:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b28:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b2b:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.set_size.req_size = newsize;
+  801b30:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b33:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801b38:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b3d:	b8 02 00 00 00       	mov    $0x2,%eax
+  801b42:	e8 a6 ff ff ff       	call   801aed <fsipc>
+}
+  801b47:	c9                   	leave
+  801b48:	c3                   	ret
+
+00801b49 <devfile_flush>:
+{
+  801b49:	55                   	push   %ebp
+  801b4a:	89 e5                	mov    %esp,%ebp
+  801b4c:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801b4f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b52:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b55:	a3 00 60 80 00       	mov    %eax,0x806000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801b5a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b5f:	b8 06 00 00 00       	mov    $0x6,%eax
+  801b64:	e8 84 ff ff ff       	call   801aed <fsipc>
+}
+  801b69:	c9                   	leave
+  801b6a:	c3                   	ret
+
+00801b6b <devfile_stat>:
+{
+  801b6b:	55                   	push   %ebp
+  801b6c:	89 e5                	mov    %esp,%ebp
+  801b6e:	53                   	push   %ebx
+  801b6f:	83 ec 04             	sub    $0x4,%esp
+  801b72:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801b75:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b78:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b7b:	a3 00 60 80 00       	mov    %eax,0x806000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801b80:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b85:	b8 05 00 00 00       	mov    $0x5,%eax
+  801b8a:	e8 5e ff ff ff       	call   801aed <fsipc>
+  801b8f:	85 c0                	test   %eax,%eax
+  801b91:	78 2c                	js     801bbf <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801b93:	83 ec 08             	sub    $0x8,%esp
+  801b96:	68 00 60 80 00       	push   $0x806000
+  801b9b:	53                   	push   %ebx
+  801b9c:	e8 61 ee ff ff       	call   800a02 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  801ba1:	a1 80 60 80 00       	mov    0x806080,%eax
+  801ba6:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801bac:	a1 84 60 80 00       	mov    0x806084,%eax
+  801bb1:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801bb7:	83 c4 10             	add    $0x10,%esp
+  801bba:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801bbf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bc2:	c9                   	leave
+  801bc3:	c3                   	ret
+
+00801bc4 <fsv_alloc>:
+{
+  801bc4:	55                   	push   %ebp
+  801bc5:	89 e5                	mov    %esp,%ebp
+  801bc7:	56                   	push   %esi
+  801bc8:	53                   	push   %ebx
+  801bc9:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  801bcb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bd0:	eb 22                	jmp    801bf4 <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  801bd2:	83 ec 04             	sub    $0x4,%esp
+  801bd5:	6a 00                	push   $0x0
+  801bd7:	6a 00                	push   $0x0
+  801bd9:	6a 07                	push   $0x7
+  801bdb:	50                   	push   %eax
+  801bdc:	6a 00                	push   $0x0
+  801bde:	6a 04                	push   $0x4
+  801be0:	68 40 50 80 00       	push   $0x805040
+  801be5:	e8 9a f6 ff ff       	call   801284 <sysbatch_add>
+  801bea:	83 c4 20             	add    $0x20,%esp
+  801bed:	85 c0                	test   %eax,%eax
+  801bef:	78 48                	js     801c39 <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  801bf1:	83 c3 01             	add    $0x1,%ebx
+  801bf4:	39 f3                	cmp    %esi,%ebx
+  801bf6:	74 31                	je     801c29 <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  801bf8:	89 d8                	mov    %ebx,%eax
+  801bfa:	c1 e0 0c             	shl    $0xc,%eax
+  801bfd:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801c02:	89 c2                	mov    %eax,%edx
+  801c04:	c1 ea 16             	shr    $0x16,%edx
+  801c07:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801c0e:	f6 c2 01             	test   $0x1,%dl
+  801c11:	74 bf                	je     801bd2 <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  801c13:	89 c2                	mov    %eax,%edx
+  801c15:	c1 ea 0c             	shr    $0xc,%edx
+  801c18:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801c1f:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801c22:	83 fa 03             	cmp    $0x3,%edx
+  801c25:	75 ab                	jne    801bd2 <fsv_alloc+0xe>
+  801c27:	eb c8                	jmp    801bf1 <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  801c29:	83 ec 0c             	sub    $0xc,%esp
+  801c2c:	68 40 50 80 00       	push   $0x805040
+  801c31:	e8 fe f5 ff ff       	call   801234 <sysbatch_flush>
+  801c36:	83 c4 10             	add    $0x10,%esp
+}
+  801c39:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c3c:	5b                   	pop    %ebx
+  801c3d:	5e                   	pop    %esi
+  801c3e:	5d                   	pop    %ebp
+  801c3f:	c3                   	ret
+
+00801c40 <devfile_read>:
+{
+  801c40:	55                   	push   %ebp
+  801c41:	89 e5                	mov    %esp,%ebp
+  801c43:	57                   	push   %edi
+  801c44:	56                   	push   %esi
+  801c45:	53                   	push   %ebx
+  801c46:	83 ec 3c             	sub    $0x3c,%esp
+  801c49:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  801c4c:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  801c52:	77 57                	ja     801cab <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801c54:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c57:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c5a:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read.req_n = n;
+  801c5f:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801c65:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c6a:	b8 03 00 00 00       	mov    $0x3,%eax
+  801c6f:	e8 79 fe ff ff       	call   801aed <fsipc>
+  801c74:	89 c6                	mov    %eax,%esi
+  801c76:	85 c0                	test   %eax,%eax
+  801c78:	78 27                	js     801ca1 <devfile_read+0x61>
+  assert(r <= n);
+  801c7a:	39 c3                	cmp    %eax,%ebx
+  801c7c:	0f 82 0e 02 00 00    	jb     801e90 <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  801c82:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801c87:	0f 8f 1c 02 00 00    	jg     801ea9 <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801c8d:	83 ec 04             	sub    $0x4,%esp
+  801c90:	50                   	push   %eax
+  801c91:	68 00 60 80 00       	push   $0x806000
+  801c96:	ff 75 0c             	push   0xc(%ebp)
+  801c99:	e8 ea ee ff ff       	call   800b88 <memmove>
+  return r;
+  801c9e:	83 c4 10             	add    $0x10,%esp
+}
+  801ca1:	89 f0                	mov    %esi,%eax
+  801ca3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ca6:	5b                   	pop    %ebx
+  801ca7:	5e                   	pop    %esi
+  801ca8:	5f                   	pop    %edi
+  801ca9:	5d                   	pop    %ebp
+  801caa:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  801cab:	b8 01 00 00 00       	mov    $0x1,%eax
+  801cb0:	e8 0f ff ff ff       	call   801bc4 <fsv_alloc>
+  801cb5:	89 c6                	mov    %eax,%esi
+  801cb7:	85 c0                	test   %eax,%eax
+  801cb9:	78 e6                	js     801ca1 <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  801cbb:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cbe:	8b 40 0c             	mov    0xc(%eax),%eax
+  801cc1:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  801cc6:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cc9:	8b 40 04             	mov    0x4(%eax),%eax
+  801ccc:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  801cd1:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  801cd7:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801cde:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801ce3:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801ce8:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801ced:	e8 e2 fc ff ff       	call   8019d4 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801cf2:	6a 00                	push   $0x0
+  801cf4:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801cf7:	50                   	push   %eax
+  801cf8:	68 00 10 c0 9f       	push   $0x9fc01000
+  801cfd:	6a 00                	push   $0x0
+  801cff:	e8 50 12 00 00       	call   802f54 <ipc_recv_pages>
+  801d04:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  801d06:	83 c4 10             	add    $0x10,%esp
+  801d09:	85 c0                	test   %eax,%eax
+  801d0b:	7e 94                	jle    801ca1 <devfile_read+0x61>
+  assert(r <= n);
+  801d0d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801d10:	39 c3                	cmp    %eax,%ebx
+  801d12:	72 2e                	jb     801d42 <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801d14:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d17:	8b 40 04             	mov    0x4(%eax),%eax
+  801d1a:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801d1f:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  801d22:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801d25:	c1 e2 0c             	shl    $0xc,%edx
+  801d28:	39 ca                	cmp    %ecx,%edx
+  801d2a:	72 2f                	jb     801d5b <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  801d2c:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  801d31:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  801d34:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  801d38:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801d3d:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  801d40:	eb 52                	jmp    801d94 <devfile_read+0x154>
+  assert(r <= n);
+  801d42:	68 d1 37 80 00       	push   $0x8037d1
+  801d47:	68 d8 37 80 00       	push   $0x8037d8
+  801d4c:	68 49 01 00 00       	push   $0x149
+  801d51:	68 c6 37 80 00       	push   $0x8037c6
+  801d56:	e8 de e5 ff ff       	call   800339 <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801d5b:	68 fc 37 80 00       	push   $0x8037fc
+  801d60:	68 d8 37 80 00       	push   $0x8037d8
+  801d65:	68 4a 01 00 00       	push   $0x14a
+  801d6a:	68 c6 37 80 00       	push   $0x8037c6
+  801d6f:	e8 c5 e5 ff ff       	call   800339 <_panic>
+      memmove(dst + done, src + done, m);
+  801d74:	83 ec 04             	sub    $0x4,%esp
+  801d77:	53                   	push   %ebx
+  801d78:	56                   	push   %esi
+  801d79:	89 f8                	mov    %edi,%eax
+  801d7b:	03 45 0c             	add    0xc(%ebp),%eax
+  801d7e:	50                   	push   %eax
+  801d7f:	e8 04 ee ff ff       	call   800b88 <memmove>
+  801d84:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  801d87:	01 df                	add    %ebx,%edi
+  801d89:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801d8c:	39 c7                	cmp    %eax,%edi
+  801d8e:	0f 83 c0 00 00 00    	jae    801e54 <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801d94:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801d97:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  801d9a:	89 f0                	mov    %esi,%eax
+  801d9c:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801da1:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  801da6:	29 c3                	sub    %eax,%ebx
+  801da8:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801dab:	29 f8                	sub    %edi,%eax
+  801dad:	39 c3                	cmp    %eax,%ebx
+  801daf:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  801db2:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801db8:	75 ba                	jne    801d74 <devfile_read+0x134>
+  801dba:	89 f9                	mov    %edi,%ecx
+  801dbc:	03 4d 0c             	add    0xc(%ebp),%ecx
+  801dbf:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  801dc2:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  801dc8:	75 aa                	jne    801d74 <devfile_read+0x134>
+  801dca:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  801dd0:	77 a2                	ja     801d74 <devfile_read+0x134>
+  801dd2:	89 c8                	mov    %ecx,%eax
+  801dd4:	c1 e8 16             	shr    $0x16,%eax
+  801dd7:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801dde:	a8 01                	test   $0x1,%al
+  801de0:	74 92                	je     801d74 <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  801de2:	89 c8                	mov    %ecx,%eax
+  801de4:	c1 e8 0c             	shr    $0xc,%eax
+  801de7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  801dee:	a8 01                	test   $0x1,%al
+  801df0:	74 82                	je     801d74 <devfile_read+0x134>
+  801df2:	a9 02 08 00 00       	test   $0x802,%eax
+  801df7:	0f 84 77 ff ff ff    	je     801d74 <devfile_read+0x134>
+  801dfd:	f6 c4 04             	test   $0x4,%ah
+  801e00:	0f 85 6e ff ff ff    	jne    801d74 <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  801e06:	a1 60 5b 80 00       	mov    0x805b60,%eax
+  801e0b:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  801e0f:	84 c0                	test   %al,%al
+  801e11:	75 17                	jne    801e2a <devfile_read+0x1ea>
+  801e13:	83 ec 08             	sub    $0x8,%esp
+  801e16:	6a 01                	push   $0x1
+  801e18:	6a 00                	push   $0x0
+  801e1a:	e8 cf ef ff ff       	call   800dee <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  801e1f:	83 c4 10             	add    $0x10,%esp
+  801e22:	85 c0                	test   %eax,%eax
+  801e24:	0f 85 4a ff ff ff    	jne    801d74 <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  801e2a:	83 ec 04             	sub    $0x4,%esp
+  801e2d:	68 05 08 00 00       	push   $0x805
+  801e32:	ff 75 cc             	push   -0x34(%ebp)
+  801e35:	6a 00                	push   $0x0
+  801e37:	56                   	push   %esi
+  801e38:	6a 00                	push   $0x0
+  801e3a:	6a 05                	push   $0x5
+  801e3c:	68 40 50 80 00       	push   $0x805040
+  801e41:	e8 3e f4 ff ff       	call   801284 <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  801e46:	c1 e8 1f             	shr    $0x1f,%eax
+  801e49:	08 45 cb             	or     %al,-0x35(%ebp)
+  801e4c:	83 c4 20             	add    $0x20,%esp
+  801e4f:	e9 33 ff ff ff       	jmp    801d87 <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  801e54:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  801e57:	83 ec 0c             	sub    $0xc,%esp
+  801e5a:	68 40 50 80 00       	push   $0x805040
+  801e5f:	e8 d0 f3 ff ff       	call   801234 <sysbatch_flush>
+  801e64:	83 c4 10             	add    $0x10,%esp
+  801e67:	85 c0                	test   %eax,%eax
+  801e69:	78 06                	js     801e71 <devfile_read+0x231>
+  801e6b:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  801e6f:	74 14                	je     801e85 <devfile_read+0x245>
+    memmove(dst, src, r);
+  801e71:	83 ec 04             	sub    $0x4,%esp
+  801e74:	ff 75 d4             	push   -0x2c(%ebp)
+  801e77:	ff 75 d0             	push   -0x30(%ebp)
+  801e7a:	ff 75 0c             	push   0xc(%ebp)
+  801e7d:	e8 06 ed ff ff       	call   800b88 <memmove>
+  801e82:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  801e85:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e88:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  801e8b:	e9 11 fe ff ff       	jmp    801ca1 <devfile_read+0x61>
+  assert(r <= n);
+  801e90:	68 d1 37 80 00       	push   $0x8037d1
+  801e95:	68 d8 37 80 00       	push   $0x8037d8
+  801e9a:	68 1c 01 00 00       	push   $0x11c
+  801e9f:	68 c6 37 80 00       	push   $0x8037c6
+  801ea4:	e8 90 e4 ff ff       	call   800339 <_panic>
+  assert(r <= PGSIZE);
+  801ea9:	68 ed 37 80 00       	push   $0x8037ed
+  801eae:	68 d8 37 80 00       	push   $0x8037d8
+  801eb3:	68 1d 01 00 00       	push   $0x11d
+  801eb8:	68 c6 37 80 00       	push   $0x8037c6
+  801ebd:	e8 77 e4 ff ff       	call   800339 <_panic>
+
+00801ec2 <devfile_write>:
+{
+  801ec2:	55                   	push   %ebp
+  801ec3:	89 e5                	mov    %esp,%ebp
+  801ec5:	57                   	push   %edi
+  801ec6:	56                   	push   %esi
+  801ec7:	53                   	push   %ebx
+  801ec8:	83 ec 1c             	sub    $0x1c,%esp
+  801ecb:	8b 75 08             	mov    0x8(%ebp),%esi
+  801ece:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  801ed1:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  801ed6:	77 39                	ja     801f11 <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801ed8:	8b 56 0c             	mov    0xc(%esi),%edx
+  801edb:	89 15 00 60 80 00    	mov    %edx,0x806000
+  fsipcbuf.write.req_n = n;
+  801ee1:	a3 04 60 80 00       	mov    %eax,0x806004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  801ee6:	83 ec 04             	sub    $0x4,%esp
+  801ee9:	50                   	push   %eax
+  801eea:	ff 75 0c             	push   0xc(%ebp)
+  801eed:	68 08 60 80 00       	push   $0x806008
+  801ef2:	e8 91 ec ff ff       	call   800b88 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801ef7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801efc:	b8 04 00 00 00       	mov    $0x4,%eax
+  801f01:	e8 e7 fb ff ff       	call   801aed <fsipc>
+  801f06:	83 c4 10             	add    $0x10,%esp
+}
+  801f09:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f0c:	5b                   	pop    %ebx
+  801f0d:	5e                   	pop    %esi
+  801f0e:	5f                   	pop    %edi
+  801f0f:	5d                   	pop    %ebp
+  801f10:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  801f11:	ba 00 00 10 00       	mov    $0x100000,%edx
+  801f16:	39 d0                	cmp    %edx,%eax
+  801f18:	89 d3                	mov    %edx,%ebx
+  801f1a:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  801f1d:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  801f23:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  801f26:	83 c7 01             	add    $0x1,%edi
+  801f29:	89 f8                	mov    %edi,%eax
+  801f2b:	e8 94 fc ff ff       	call   801bc4 <fsv_alloc>
+  801f30:	85 c0                	test   %eax,%eax
+  801f32:	78 d5                	js     801f09 <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  801f34:	83 ec 04             	sub    $0x4,%esp
+  801f37:	53                   	push   %ebx
+  801f38:	ff 75 0c             	push   0xc(%ebp)
+  801f3b:	68 00 10 c0 9f       	push   $0x9fc01000
+  801f40:	e8 43 ec ff ff       	call   800b88 <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  801f45:	8b 46 0c             	mov    0xc(%esi),%eax
+  801f48:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  801f4d:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  801f53:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801f5a:	89 f9                	mov    %edi,%ecx
+  801f5c:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801f61:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801f66:	e8 69 fa ff ff       	call   8019d4 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801f6b:	6a 00                	push   $0x0
+  801f6d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801f70:	50                   	push   %eax
+  801f71:	6a 00                	push   $0x0
+  801f73:	6a 00                	push   $0x0
+  801f75:	e8 da 0f 00 00       	call   802f54 <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  801f7a:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  801f7d:	eb 8a                	jmp    801f09 <devfile_write+0x47>
+
+00801f7f <open>:
+{
+  801f7f:	55                   	push   %ebp
+  801f80:	89 e5                	mov    %esp,%ebp
+  801f82:	56                   	push   %esi
+  801f83:	53                   	push   %ebx
+  801f84:	83 ec 1c             	sub    $0x1c,%esp
+  801f87:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801f8a:	56                   	push   %esi
+  801f8b:	e8 37 ea ff ff       	call   8009c7 <strlen>
+  801f90:	83 c4 10             	add    $0x10,%esp
+  801f93:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801f98:	7f 6c                	jg     802006 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  801f9a:	83 ec 0c             	sub    $0xc,%esp
+  801f9d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fa0:	50                   	push   %eax
+  801fa1:	e8 ad f4 ff ff       	call   801453 <fd_alloc>
+  801fa6:	89 c3                	mov    %eax,%ebx
+  801fa8:	83 c4 10             	add    $0x10,%esp
+  801fab:	85 c0                	test   %eax,%eax
+  801fad:	78 3c                	js     801feb <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801faf:	83 ec 08             	sub    $0x8,%esp
+  801fb2:	56                   	push   %esi
+  801fb3:	68 00 60 80 00       	push   $0x806000
+  801fb8:	e8 45 ea ff ff       	call   800a02 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801fbd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801fc0:	a3 00 64 80 00       	mov    %eax,0x806400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801fc5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801fc8:	b8 01 00 00 00       	mov    $0x1,%eax
+  801fcd:	e8 1b fb ff ff       	call   801aed <fsipc>
+  801fd2:	89 c3                	mov    %eax,%ebx
+  801fd4:	83 c4 10             	add    $0x10,%esp
+  801fd7:	85 c0                	test   %eax,%eax
+  801fd9:	78 19                	js     801ff4 <open+0x75>
+  return fd2num(fd);
+  801fdb:	83 ec 0c             	sub    $0xc,%esp
+  801fde:	ff 75 f4             	push   -0xc(%ebp)
+  801fe1:	e8 49 f4 ff ff       	call   80142f <fd2num>
+  801fe6:	89 c3                	mov    %eax,%ebx
+  801fe8:	83 c4 10             	add    $0x10,%esp
+}
+  801feb:	89 d8                	mov    %ebx,%eax
+  801fed:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ff0:	5b                   	pop    %ebx
+  801ff1:	5e                   	pop    %esi
+  801ff2:	5d                   	pop    %ebp
+  801ff3:	c3                   	ret
+    fd_close(fd, 0);
+  801ff4:	83 ec 08             	sub    $0x8,%esp
+  801ff7:	6a 00                	push   $0x0
+  801ff9:	ff 75 f4             	push   -0xc(%ebp)
+  801ffc:	e8 44 f5 ff ff       	call   801545 <fd_close>
+    return r;
+  802001:	83 c4 10             	add    $0x10,%esp
+  802004:	eb e5                	jmp    801feb <open+0x6c>
+    return -E_BAD_PATH;
+  802006:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80200b:	eb de                	jmp    801feb <open+0x6c>
+
+0080200d <open_read>:
+{
+  80200d:	55                   	push   %ebp
+  80200e:	89 e5                	mov    %esp,%ebp
+  802010:	57                   	push   %edi
+  802011:	56                   	push   %esi
+  802012:	53                   	push   %ebx
+  802013:	83 ec 28             	sub    $0x28,%esp
+  802016:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  802019:	57                   	push   %edi
+  80201a:	e8 a8 e9 ff ff       	call   8009c7 <strlen>
+  80201f:	83 c4 10             	add    $0x10,%esp
+  802022:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802027:	0f 87 f6 00 00 00    	ja     802123 <open_read+0x116>
+  80202d:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  80202f:	83 ec 0c             	sub    $0xc,%esp
+  802032:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802035:	50                   	push   %eax
+  802036:	e8 18 f4 ff ff       	call   801453 <fd_alloc>
+  80203b:	89 c3                	mov    %eax,%ebx
+  80203d:	83 c4 10             	add    $0x10,%esp
+  802040:	85 c0                	test   %eax,%eax
+  802042:	0f 88 b2 00 00 00    	js     8020fa <open_read+0xed>
+  strcpy(req->req_buf, path);
+  802048:	83 ec 08             	sub    $0x8,%esp
+  80204b:	57                   	push   %edi
+  80204c:	68 e4 60 80 00       	push   $0x8060e4
+  802051:	e8 ac e9 ff ff       	call   800a02 <strcpy>
+  req->req_nops = 2;
+  802056:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  80205d:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  802060:	c7 05 04 60 80 00 01 	movl   $0x1,0x806004
+  802067:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  80206a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80206d:	a3 10 60 80 00       	mov    %eax,0x806010
+  req->req_ops[0].op_buf = 0;
+  802072:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  802079:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  80207c:	c7 05 20 60 80 00 04 	movl   $0x4,0x806020
+  802083:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  802086:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  80208d:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  802090:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  802095:	29 f0                	sub    %esi,%eax
+  802097:	3b 45 14             	cmp    0x14(%ebp),%eax
+  80209a:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  80209e:	a3 2c 60 80 00       	mov    %eax,0x80602c
+  req->req_ops[1].op_offset = 0;
+  8020a3:	c7 05 30 60 80 00 00 	movl   $0x0,0x806030
+  8020aa:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  8020ad:	83 c6 01             	add    $0x1,%esi
+  8020b0:	89 35 34 60 80 00    	mov    %esi,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  8020b6:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8020b9:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8020be:	e8 2a fa ff ff       	call   801aed <fsipc>
+  8020c3:	89 c3                	mov    %eax,%ebx
+  8020c5:	83 c4 10             	add    $0x10,%esp
+  8020c8:	83 f8 01             	cmp    $0x1,%eax
+  8020cb:	7e 37                	jle    802104 <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  8020cd:	a1 38 60 80 00       	mov    0x806038,%eax
+  8020d2:	8b 55 18             	mov    0x18(%ebp),%edx
+  8020d5:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  8020d7:	83 ec 04             	sub    $0x4,%esp
+  8020da:	50                   	push   %eax
+  8020db:	81 c6 e4 60 80 00    	add    $0x8060e4,%esi
+  8020e1:	56                   	push   %esi
+  8020e2:	ff 75 10             	push   0x10(%ebp)
+  8020e5:	e8 9e ea ff ff       	call   800b88 <memmove>
+  return fd2num(fd);
+  8020ea:	83 c4 04             	add    $0x4,%esp
+  8020ed:	ff 75 e4             	push   -0x1c(%ebp)
+  8020f0:	e8 3a f3 ff ff       	call   80142f <fd2num>
+  8020f5:	89 c3                	mov    %eax,%ebx
+  8020f7:	83 c4 10             	add    $0x10,%esp
+}
+  8020fa:	89 d8                	mov    %ebx,%eax
+  8020fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020ff:	5b                   	pop    %ebx
+  802100:	5e                   	pop    %esi
+  802101:	5f                   	pop    %edi
+  802102:	5d                   	pop    %ebp
+  802103:	c3                   	ret
+    fd_close(fd, 0);
+  802104:	83 ec 08             	sub    $0x8,%esp
+  802107:	6a 00                	push   $0x0
+  802109:	ff 75 e4             	push   -0x1c(%ebp)
+  80210c:	e8 34 f4 ff ff       	call   801545 <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  802111:	83 c4 10             	add    $0x10,%esp
+  802114:	85 db                	test   %ebx,%ebx
+  802116:	78 e2                	js     8020fa <open_read+0xed>
+  802118:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  80211b:	8b 9b 1c 60 80 00    	mov    0x80601c(%ebx),%ebx
+  802121:	eb d7                	jmp    8020fa <open_read+0xed>
+    return -E_BAD_PATH;
+  802123:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802128:	eb d0                	jmp    8020fa <open_read+0xed>
+
+0080212a <file_stat>:
+{
+  80212a:	55                   	push   %ebp
+  80212b:	89 e5                	mov    %esp,%ebp
+  80212d:	57                   	push   %edi
+  80212e:	56                   	push   %esi
+  80212f:	53                   	push   %ebx
+  802130:	83 ec 18             	sub    $0x18,%esp
+  802133:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802136:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  802139:	57                   	push   %edi
+  80213a:	e8 88 e8 ff ff       	call   8009c7 <strlen>
+  80213f:	83 c4 10             	add    $0x10,%esp
+  802142:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802147:	0f 8f c7 00 00 00    	jg     802214 <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  80214d:	83 ec 0c             	sub    $0xc,%esp
+  802150:	57                   	push   %edi
+  802151:	e8 71 e8 ff ff       	call   8009c7 <strlen>
+  802156:	8d 58 04             	lea    0x4(%eax),%ebx
+  802159:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  80215c:	83 c4 08             	add    $0x8,%esp
+  80215f:	57                   	push   %edi
+  802160:	68 e4 60 80 00       	push   $0x8060e4
+  802165:	e8 98 e8 ff ff       	call   800a02 <strcpy>
+  req->req_nops = 2;
+  80216a:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  802171:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  802174:	c7 05 04 60 80 00 02 	movl   $0x2,0x806004
+  80217b:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  80217e:	c7 05 10 60 80 00 00 	movl   $0x0,0x806010
+  802185:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  802188:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  80218f:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  802192:	c7 05 20 60 80 00 03 	movl   $0x3,0x806020
+  802199:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  80219c:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  8021a3:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  8021a6:	89 1d 34 60 80 00    	mov    %ebx,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  8021ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021b1:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8021b6:	e8 32 f9 ff ff       	call   801aed <fsipc>
+  8021bb:	83 c4 10             	add    $0x10,%esp
+  8021be:	83 f8 01             	cmp    $0x1,%eax
+  8021c1:	7e 42                	jle    802205 <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  8021c3:	81 c3 e4 60 80 00    	add    $0x8060e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  8021c9:	83 ec 08             	sub    $0x8,%esp
+  8021cc:	53                   	push   %ebx
+  8021cd:	56                   	push   %esi
+  8021ce:	e8 2f e8 ff ff       	call   800a02 <strcpy>
+  st->st_size = ret->ret_size;
+  8021d3:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  8021d9:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  8021df:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  8021e5:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  8021eb:	c7 86 88 00 00 00 04 	movl   $0x804004,0x88(%esi)
+  8021f2:	40 80 00 
+  return 0;
+  8021f5:	83 c4 10             	add    $0x10,%esp
+  8021f8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802200:	5b                   	pop    %ebx
+  802201:	5e                   	pop    %esi
+  802202:	5f                   	pop    %edi
+  802203:	5d                   	pop    %ebp
+  802204:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  802205:	85 c0                	test   %eax,%eax
+  802207:	78 f4                	js     8021fd <file_stat+0xd3>
+  802209:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80220c:	8b 80 1c 60 80 00    	mov    0x80601c(%eax),%eax
+  802212:	eb e9                	jmp    8021fd <file_stat+0xd3>
+    return -E_BAD_PATH;
+  802214:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802219:	eb e2                	jmp    8021fd <file_stat+0xd3>
+
+0080221b <read_map>:
+{
+  80221b:	55                   	push   %ebp
+  80221c:	89 e5                	mov    %esp,%ebp
+  80221e:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802221:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802224:	50                   	push   %eax
+  802225:	ff 75 08             	push   0x8(%ebp)
+  802228:	e8 7c f2 ff ff       	call   8014a9 <fd_lookup>
+  80222d:	83 c4 10             	add    $0x10,%esp
+  802230:	85 c0                	test   %eax,%eax
+  802232:	78 2a                	js     80225e <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  802234:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802237:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  80223d:	39 08                	cmp    %ecx,(%eax)
+  80223f:	75 1f                	jne    802260 <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  802241:	8b 40 0c             	mov    0xc(%eax),%eax
+  802244:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read_map.req_offset = offset;
+  802249:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80224c:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  802251:	8b 55 10             	mov    0x10(%ebp),%edx
+  802254:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802259:	e8 8f f8 ff ff       	call   801aed <fsipc>
+}
+  80225e:	c9                   	leave
+  80225f:	c3                   	ret
+    return -E_INVAL;
+  802260:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802265:	eb f7                	jmp    80225e <read_map+0x43>
+
+00802267 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802267:	55                   	push   %ebp
+  802268:	89 e5                	mov    %esp,%ebp
+  80226a:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  80226d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802272:	b8 08 00 00 00       	mov    $0x8,%eax
+  802277:	e8 71 f8 ff ff       	call   801aed <fsipc>
+}
+  80227c:	c9                   	leave
+  80227d:	c3                   	ret
+
+0080227e <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  80227e:	55                   	push   %ebp
+  80227f:	89 e5                	mov    %esp,%ebp
+  802281:	57                   	push   %edi
+  802282:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  802283:	8b 45 08             	mov    0x8(%ebp),%eax
+  802286:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.stats.req_bio_sched = 0;
+  80228b:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  802292:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  802295:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  80229c:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  80229f:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022a4:	b8 09 00 00 00       	mov    $0x9,%eax
+  8022a9:	e8 3f f8 ff ff       	call   801aed <fsipc>
+  8022ae:	85 c0                	test   %eax,%eax
+  8022b0:	78 14                	js     8022c6 <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  8022b2:	be 00 60 80 00       	mov    $0x806000,%esi
+  8022b7:	b9 16 00 00 00       	mov    $0x16,%ecx
+  8022bc:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8022bf:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  8022c1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022c6:	5e                   	pop    %esi
+  8022c7:	5f                   	pop    %edi
+  8022c8:	5d                   	pop    %ebp
+  8022c9:	c3                   	ret
+
+008022ca <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  8022ca:	55                   	push   %ebp
+  8022cb:	89 e5                	mov    %esp,%ebp
+  8022cd:	53                   	push   %ebx
+  8022ce:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  8022d1:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8022d4:	50                   	push   %eax
+  8022d5:	6a 00                	push   $0x0
+  8022d7:	e8 a2 ff ff ff       	call   80227e <fs_stats>
+  8022dc:	83 c4 10             	add    $0x10,%esp
+  8022df:	85 c0                	test   %eax,%eax
+  8022e1:	78 28                	js     80230b <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  8022e3:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  8022e6:	83 ec 08             	sub    $0x8,%esp
+  8022e9:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8022ec:	50                   	push   %eax
+  8022ed:	6a 20                	push   $0x20
+  8022ef:	e8 8a ff ff ff       	call   80227e <fs_stats>
+  8022f4:	83 c4 10             	add    $0x10,%esp
+  8022f7:	85 c0                	test   %eax,%eax
+  8022f9:	78 10                	js     80230b <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  8022fb:	83 ec 08             	sub    $0x8,%esp
+  8022fe:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802301:	50                   	push   %eax
+  802302:	53                   	push   %ebx
+  802303:	e8 76 ff ff ff       	call   80227e <fs_stats>
+  802308:	83 c4 10             	add    $0x10,%esp
+}
+  80230b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80230e:	c9                   	leave
+  80230f:	c3                   	ret
+
+00802310 <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  802310:	55                   	push   %ebp
+  802311:	89 e5                	mov    %esp,%ebp
+  802313:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  802316:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  80231d:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  802320:	8b 45 08             	mov    0x8(%ebp),%eax
+  802323:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.stats.req_dcache = 0;
+  802328:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  80232f:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  802332:	ba 00 00 00 00       	mov    $0x0,%edx
+  802337:	b8 09 00 00 00       	mov    $0x9,%eax
+  80233c:	e8 ac f7 ff ff       	call   801aed <fsipc>
+}
+  802341:	c9                   	leave
+  802342:	c3                   	ret
+
+00802343 <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  802343:	55                   	push   %ebp
+  802344:	89 e5                	mov    %esp,%ebp
+  802346:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  802349:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  802350:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  802353:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  80235a:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  80235d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802360:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_STATS, NULL);
+  802365:	ba 00 00 00 00       	mov    $0x0,%edx
+  80236a:	b8 09 00 00 00       	mov    $0x9,%eax
+  80236f:	e8 79 f7 ff ff       	call   801aed <fsipc>
+}
+  802374:	c9                   	leave
+  802375:	c3                   	ret
+
+00802376 <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  802376:	55                   	push   %ebp
+  802377:	89 e5                	mov    %esp,%ebp
+  802379:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80237c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80237f:	50                   	push   %eax
+  802380:	ff 75 08             	push   0x8(%ebp)
+  802383:	e8 21 f1 ff ff       	call   8014a9 <fd_lookup>
+  802388:	83 c4 10             	add    $0x10,%esp
+  80238b:	85 c0                	test   %eax,%eax
+  80238d:	78 34                	js     8023c3 <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  80238f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802392:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  802398:	39 08                	cmp    %ecx,(%eax)
+  80239a:	75 29                	jne    8023c5 <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  80239c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80239f:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.fallocate.req_offset = offset;
+  8023a4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023a7:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.fallocate.req_len = len;
+  8023ac:	8b 45 10             	mov    0x10(%ebp),%eax
+  8023af:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  8023b4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023b9:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8023be:	e8 2a f7 ff ff       	call   801aed <fsipc>
+}
+  8023c3:	c9                   	leave
+  8023c4:	c3                   	ret
+    return -E_INVAL;
+  8023c5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8023ca:	eb f7                	jmp    8023c3 <fallocate+0x4d>
+
+008023cc <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  8023cc:	55                   	push   %ebp
+  8023cd:	89 e5                	mov    %esp,%ebp
+  8023cf:	57                   	push   %edi
+  8023d0:	56                   	push   %esi
+  8023d1:	53                   	push   %ebx
+  8023d2:	83 ec 24             	sub    $0x24,%esp
+  8023d5:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8023d8:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8023db:	50                   	push   %eax
+  8023dc:	ff 75 08             	push   0x8(%ebp)
+  8023df:	e8 c5 f0 ff ff       	call   8014a9 <fd_lookup>
+  8023e4:	83 c4 10             	add    $0x10,%esp
+  8023e7:	85 c0                	test   %eax,%eax
+  8023e9:	78 66                	js     802451 <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  8023eb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8023ee:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  8023f4:	39 08                	cmp    %ecx,(%eax)
+  8023f6:	75 61                	jne    802459 <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  8023f8:	85 f6                	test   %esi,%esi
+  8023fa:	7e 50                	jle    80244c <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  8023fc:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  802401:	39 de                	cmp    %ebx,%esi
+  802403:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  802406:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802409:	8b 40 0c             	mov    0xc(%eax),%eax
+  80240c:	a3 00 60 80 00       	mov    %eax,0x806000
+    fsipcbuf.prefetch.req_n = m;
+  802411:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  802417:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  80241e:	83 ec 04             	sub    $0x4,%esp
+  802421:	57                   	push   %edi
+  802422:	ff 75 0c             	push   0xc(%ebp)
+  802425:	68 08 60 80 00       	push   $0x806008
+  80242a:	e8 59 e7 ff ff       	call   800b88 <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  80242f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802434:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802439:	e8 af f6 ff ff       	call   801aed <fsipc>
+  80243e:	83 c4 10             	add    $0x10,%esp
+  802441:	85 c0                	test   %eax,%eax
+  802443:	78 0c                	js     802451 <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  802445:	01 7d 0c             	add    %edi,0xc(%ebp)
+  802448:	29 de                	sub    %ebx,%esi
+  80244a:	eb ac                	jmp    8023f8 <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  80244c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802451:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802454:	5b                   	pop    %ebx
+  802455:	5e                   	pop    %esi
+  802456:	5f                   	pop    %edi
+  802457:	5d                   	pop    %ebp
+  802458:	c3                   	ret
+    return -E_INVAL;
+  802459:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80245e:	eb f1                	jmp    802451 <prefetch+0x85>
+
+00802460 <writebuf>:
+
+
+static void
+writebuf(struct printbuf *b)
+{
+  if (b->error > 0) {
+  802460:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802464:	7f 01                	jg     802467 <writebuf+0x7>
+  802466:	c3                   	ret
+{
+  802467:	55                   	push   %ebp
+  802468:	89 e5                	mov    %esp,%ebp
+  80246a:	53                   	push   %ebx
+  80246b:	83 ec 08             	sub    $0x8,%esp
+  80246e:	89 c3                	mov    %eax,%ebx
+    ssize_t result = write(b->fd, b->buf, b->idx);
+  802470:	ff 70 04             	push   0x4(%eax)
+  802473:	8d 40 10             	lea    0x10(%eax),%eax
+  802476:	50                   	push   %eax
+  802477:	ff 33                	push   (%ebx)
+  802479:	e8 a4 f3 ff ff       	call   801822 <write>
+    if (result > 0)
+  80247e:	83 c4 10             	add    $0x10,%esp
+  802481:	85 c0                	test   %eax,%eax
+  802483:	7e 03                	jle    802488 <writebuf+0x28>
+      b->result += result;
+  802485:	01 43 08             	add    %eax,0x8(%ebx)
+    if (result != b->idx)             // error, or wrote less than supplied
+  802488:	39 43 04             	cmp    %eax,0x4(%ebx)
+  80248b:	74 0d                	je     80249a <writebuf+0x3a>
+      b->error = (result < 0 ? result : 0);
+  80248d:	85 c0                	test   %eax,%eax
+  80248f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802494:	0f 4f c2             	cmovg  %edx,%eax
+  802497:	89 43 0c             	mov    %eax,0xc(%ebx)
+  }
+}
+  80249a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80249d:	c9                   	leave
+  80249e:	c3                   	ret
+
+0080249f <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  80249f:	55                   	push   %ebp
+  8024a0:	89 e5                	mov    %esp,%ebp
+  8024a2:	53                   	push   %ebx
+  8024a3:	83 ec 04             	sub    $0x4,%esp
+  8024a6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct printbuf *b = (struct printbuf *)thunk;
+
+  b->buf[b->idx++] = ch;
+  8024a9:	8b 53 04             	mov    0x4(%ebx),%edx
+  8024ac:	8d 42 01             	lea    0x1(%edx),%eax
+  8024af:	89 43 04             	mov    %eax,0x4(%ebx)
+  8024b2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8024b5:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+  if (b->idx == 256) {
+  8024b9:	3d 00 01 00 00       	cmp    $0x100,%eax
+  8024be:	74 05                	je     8024c5 <putch+0x26>
+    writebuf(b);
+    b->idx = 0;
+  }
+}
+  8024c0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024c3:	c9                   	leave
+  8024c4:	c3                   	ret
+    writebuf(b);
+  8024c5:	89 d8                	mov    %ebx,%eax
+  8024c7:	e8 94 ff ff ff       	call   802460 <writebuf>
+    b->idx = 0;
+  8024cc:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+  8024d3:	eb eb                	jmp    8024c0 <putch+0x21>
+
+008024d5 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap)
+{
+  8024d5:	55                   	push   %ebp
+  8024d6:	89 e5                	mov    %esp,%ebp
+  8024d8:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.fd = fd;
+  8024de:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024e1:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+  b.idx = 0;
+  8024e7:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  8024ee:	00 00 00 
+  b.result = 0;
+  8024f1:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8024f8:	00 00 00 
+  b.error = 1;
+  8024fb:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  802502:	00 00 00 
+  vprintfmt(putch, &b, fmt, ap);
+  802505:	ff 75 10             	push   0x10(%ebp)
+  802508:	ff 75 0c             	push   0xc(%ebp)
+  80250b:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  802511:	50                   	push   %eax
+  802512:	68 9f 24 80 00       	push   $0x80249f
+  802517:	e8 ef df ff ff       	call   80050b <vprintfmt>
+  if (b.idx > 0)
+  80251c:	83 c4 10             	add    $0x10,%esp
+  80251f:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  802526:	7f 12                	jg     80253a <vfprintf+0x65>
+    writebuf(&b);
+
+  return b.result ? b.result : b.error;
+  802528:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  80252e:	85 c0                	test   %eax,%eax
+  802530:	75 06                	jne    802538 <vfprintf+0x63>
+  802532:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+}
+  802538:	c9                   	leave
+  802539:	c3                   	ret
+    writebuf(&b);
+  80253a:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  802540:	e8 1b ff ff ff       	call   802460 <writebuf>
+  802545:	eb e1                	jmp    802528 <vfprintf+0x53>
+
+00802547 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...)
+{
+  802547:	55                   	push   %ebp
+  802548:	89 e5                	mov    %esp,%ebp
+  80254a:	83 ec 0c             	sub    $0xc,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  80254d:	8d 45 10             	lea    0x10(%ebp),%eax
+  cnt = vfprintf(fd, fmt, ap);
+  802550:	50                   	push   %eax
+  802551:	ff 75 0c             	push   0xc(%ebp)
+  802554:	ff 75 08             	push   0x8(%ebp)
+  802557:	e8 79 ff ff ff       	call   8024d5 <vfprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  80255c:	c9                   	leave
+  80255d:	c3                   	ret
+
+0080255e <printf>:
+
+int
+printf(const char *fmt, ...)
+{
+  80255e:	55                   	push   %ebp
+  80255f:	89 e5                	mov    %esp,%ebp
+  802561:	83 ec 0c             	sub    $0xc,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  802564:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vfprintf(1, fmt, ap);
+  802567:	50                   	push   %eax
+  802568:	ff 75 08             	push   0x8(%ebp)
+  80256b:	6a 01                	push   $0x1
+  80256d:	e8 63 ff ff ff       	call   8024d5 <vfprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  802572:	c9                   	leave
+  802573:	c3                   	ret
+
+00802574 <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  802574:	55                   	push   %ebp
+  802575:	89 e5                	mov    %esp,%ebp
+  802577:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  80257a:	50                   	push   %eax
+  80257b:	e8 bf ee ff ff       	call   80143f <fd2data>
+  802580:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  802585:	c9                   	leave
+  802586:	c3                   	ret
+
+00802587 <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802587:	55                   	push   %ebp
+  802588:	89 e5                	mov    %esp,%ebp
+  80258a:	56                   	push   %esi
+  80258b:	53                   	push   %ebx
+  80258c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  80258f:	83 ec 0c             	sub    $0xc,%esp
+  802592:	ff 75 08             	push   0x8(%ebp)
+  802595:	e8 a5 ee ff ff       	call   80143f <fd2data>
+  80259a:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  80259c:	83 c4 08             	add    $0x8,%esp
+  80259f:	68 28 38 80 00       	push   $0x803828
+  8025a4:	53                   	push   %ebx
+  8025a5:	e8 58 e4 ff ff       	call   800a02 <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  8025aa:	8b 46 04             	mov    0x4(%esi),%eax
+  8025ad:	2b 06                	sub    (%esi),%eax
+  8025af:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  8025b5:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8025bc:	00 00 00 
+  stat->st_dev = &devpipe;
+  8025bf:	c7 83 88 00 00 00 20 	movl   $0x804020,0x88(%ebx)
+  8025c6:	40 80 00 
+  return 0;
+}
+  8025c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025ce:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025d1:	5b                   	pop    %ebx
+  8025d2:	5e                   	pop    %esi
+  8025d3:	5d                   	pop    %ebp
+  8025d4:	c3                   	ret
+
+008025d5 <pipe_wakeup>:
+{
+  8025d5:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  8025d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025dc:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  8025df:	85 c0                	test   %eax,%eax
+  8025e1:	75 01                	jne    8025e4 <pipe_wakeup+0xf>
+  8025e3:	c3                   	ret
+{
+  8025e4:	55                   	push   %ebp
+  8025e5:	89 e5                	mov    %esp,%ebp
+  8025e7:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  8025ea:	6a 00                	push   $0x0
+  8025ec:	68 00 00 c0 ee       	push   $0xeec00000
+  8025f1:	52                   	push   %edx
+  8025f2:	e8 96 eb ff ff       	call   80118d <sys_chan_wakeup>
+  8025f7:	83 c4 10             	add    $0x10,%esp
+}
+  8025fa:	c9                   	leave
+  8025fb:	c3                   	ret
+
+008025fc <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8025fc:	55                   	push   %ebp
+  8025fd:	89 e5                	mov    %esp,%ebp
+  8025ff:	57                   	push   %edi
+  802600:	56                   	push   %esi
+  802601:	53                   	push   %ebx
+  802602:	83 ec 18             	sub    $0x18,%esp
+  802605:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  802608:	57                   	push   %edi
+  802609:	e8 31 ee ff ff       	call   80143f <fd2data>
+  80260e:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  802610:	83 c4 10             	add    $0x10,%esp
+  802613:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  802617:	74 2a                	je     802643 <devpipe_close+0x47>
+  802619:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  80261e:	89 f8                	mov    %edi,%eax
+  802620:	e8 4f ff ff ff       	call   802574 <pipe_ring>
+  802625:	83 ec 08             	sub    $0x8,%esp
+  802628:	01 d8                	add    %ebx,%eax
+  80262a:	50                   	push   %eax
+  80262b:	6a 00                	push   $0x0
+  80262d:	e8 84 e8 ff ff       	call   800eb6 <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  802632:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802638:	83 c4 10             	add    $0x10,%esp
+  80263b:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  802641:	75 db                	jne    80261e <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  802643:	83 ec 08             	sub    $0x8,%esp
+  802646:	57                   	push   %edi
+  802647:	6a 00                	push   $0x0
+  802649:	e8 68 e8 ff ff       	call   800eb6 <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  80264e:	83 c4 10             	add    $0x10,%esp
+  802651:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  802655:	75 13                	jne    80266a <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  802657:	83 ec 08             	sub    $0x8,%esp
+  80265a:	56                   	push   %esi
+  80265b:	6a 00                	push   $0x0
+  80265d:	e8 54 e8 ff ff       	call   800eb6 <sys_page_unmap>
+}
+  802662:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802665:	5b                   	pop    %ebx
+  802666:	5e                   	pop    %esi
+  802667:	5f                   	pop    %edi
+  802668:	5d                   	pop    %ebp
+  802669:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  80266a:	8d 56 04             	lea    0x4(%esi),%edx
+  80266d:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802670:	e8 60 ff ff ff       	call   8025d5 <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802675:	8d 46 30             	lea    0x30(%esi),%eax
+  802678:	89 f2                	mov    %esi,%edx
+  80267a:	e8 56 ff ff ff       	call   8025d5 <pipe_wakeup>
+  80267f:	eb d6                	jmp    802657 <devpipe_close+0x5b>
+
+00802681 <_pipeisclosed>:
+{
+  802681:	55                   	push   %ebp
+  802682:	89 e5                	mov    %esp,%ebp
+  802684:	57                   	push   %edi
+  802685:	56                   	push   %esi
+  802686:	53                   	push   %ebx
+  802687:	83 ec 1c             	sub    $0x1c,%esp
+  80268a:	89 c7                	mov    %eax,%edi
+  80268c:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  80268e:	a1 60 5b 80 00       	mov    0x805b60,%eax
+  802693:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  802696:	83 ec 0c             	sub    $0xc,%esp
+  802699:	57                   	push   %edi
+  80269a:	e8 18 0a 00 00       	call   8030b7 <pageref>
+  80269f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8026a2:	89 34 24             	mov    %esi,(%esp)
+  8026a5:	e8 0d 0a 00 00       	call   8030b7 <pageref>
+    nn = thisenv->env_runs;
+  8026aa:	8b 15 60 5b 80 00    	mov    0x805b60,%edx
+  8026b0:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  8026b3:	83 c4 10             	add    $0x10,%esp
+  8026b6:	39 cb                	cmp    %ecx,%ebx
+  8026b8:	74 1b                	je     8026d5 <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  8026ba:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8026bd:	75 cf                	jne    80268e <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8026bf:	8b 42 58             	mov    0x58(%edx),%eax
+  8026c2:	6a 01                	push   $0x1
+  8026c4:	50                   	push   %eax
+  8026c5:	53                   	push   %ebx
+  8026c6:	68 2f 38 80 00       	push   $0x80382f
+  8026cb:	e8 44 dd ff ff       	call   800414 <cprintf>
+  8026d0:	83 c4 10             	add    $0x10,%esp
+  8026d3:	eb b9                	jmp    80268e <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  8026d5:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8026d8:	0f 94 c0             	sete   %al
+  8026db:	0f b6 c0             	movzbl %al,%eax
+}
+  8026de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026e1:	5b                   	pop    %ebx
+  8026e2:	5e                   	pop    %esi
+  8026e3:	5f                   	pop    %edi
+  8026e4:	5d                   	pop    %ebp
+  8026e5:	c3                   	ret
+
+008026e6 <devpipe_write_bulk>:
+{
+  8026e6:	55                   	push   %ebp
+  8026e7:	89 e5                	mov    %esp,%ebp
+  8026e9:	57                   	push   %edi
+  8026ea:	56                   	push   %esi
+  8026eb:	53                   	push   %ebx
+  8026ec:	83 ec 1c             	sub    $0x1c,%esp
+  8026ef:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8026f2:	89 d6                	mov    %edx,%esi
+  8026f4:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  8026f7:	e8 78 fe ff ff       	call   802574 <pipe_ring>
+  8026fc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  8026ff:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802704:	8d 46 04             	lea    0x4(%esi),%eax
+  802707:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  80270a:	eb 75                	jmp    802781 <devpipe_write_bulk+0x9b>
+  80270c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802711:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802715:	6a 64                	push   $0x64
+  802717:	68 00 00 c0 ee       	push   $0xeec00000
+  80271c:	53                   	push   %ebx
+  80271d:	56                   	push   %esi
+  80271e:	e8 47 ea ff ff       	call   80116a <sys_chan_sleep>
+      continue;
+  802723:	83 c4 10             	add    $0x10,%esp
+  802726:	eb 59                	jmp    802781 <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  802728:	89 d1                	mov    %edx,%ecx
+  80272a:	c1 f9 1f             	sar    $0x1f,%ecx
+  80272d:	c1 e9 11             	shr    $0x11,%ecx
+  802730:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802733:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802738:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  80273a:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  802740:	29 d3                	sub    %edx,%ebx
+  802742:	ba 00 80 00 00       	mov    $0x8000,%edx
+  802747:	29 c2                	sub    %eax,%edx
+  802749:	39 d3                	cmp    %edx,%ebx
+  80274b:	0f 47 da             	cmova  %edx,%ebx
+  80274e:	8b 55 08             	mov    0x8(%ebp),%edx
+  802751:	29 fa                	sub    %edi,%edx
+  802753:	39 d3                	cmp    %edx,%ebx
+  802755:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  802758:	83 ec 04             	sub    $0x4,%esp
+  80275b:	53                   	push   %ebx
+  80275c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80275f:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  802762:	52                   	push   %edx
+  802763:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802766:	01 c8                	add    %ecx,%eax
+  802768:	50                   	push   %eax
+  802769:	e8 7c e4 ff ff       	call   800bea <memcpy>
+    i += m;
+  80276e:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  802770:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802773:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802776:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802779:	e8 57 fe ff ff       	call   8025d5 <pipe_wakeup>
+  80277e:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802781:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802784:	73 2b                	jae    8027b1 <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  802786:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  802788:	8b 56 04             	mov    0x4(%esi),%edx
+  80278b:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  802791:	39 d0                	cmp    %edx,%eax
+  802793:	7d 93                	jge    802728 <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  802795:	89 f2                	mov    %esi,%edx
+  802797:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80279a:	e8 e2 fe ff ff       	call   802681 <_pipeisclosed>
+  80279f:	85 c0                	test   %eax,%eax
+  8027a1:	0f 84 65 ff ff ff    	je     80270c <devpipe_write_bulk+0x26>
+        return i;
+  8027a7:	89 f8                	mov    %edi,%eax
+}
+  8027a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027ac:	5b                   	pop    %ebx
+  8027ad:	5e                   	pop    %esi
+  8027ae:	5f                   	pop    %edi
+  8027af:	5d                   	pop    %ebp
+  8027b0:	c3                   	ret
+  return i;
+  8027b1:	89 f8                	mov    %edi,%eax
+  8027b3:	eb f4                	jmp    8027a9 <devpipe_write_bulk+0xc3>
+
+008027b5 <devpipe_write>:
+{
+  8027b5:	55                   	push   %ebp
+  8027b6:	89 e5                	mov    %esp,%ebp
+  8027b8:	57                   	push   %edi
+  8027b9:	56                   	push   %esi
+  8027ba:	53                   	push   %ebx
+  8027bb:	83 ec 28             	sub    $0x28,%esp
+  8027be:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  8027c1:	56                   	push   %esi
+  8027c2:	e8 78 ec ff ff       	call   80143f <fd2data>
+  8027c7:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  8027c9:	8b 78 28             	mov    0x28(%eax),%edi
+  8027cc:	83 c4 10             	add    $0x10,%esp
+  8027cf:	85 ff                	test   %edi,%edi
+  8027d1:	75 25                	jne    8027f8 <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  8027d3:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8027d6:	74 66                	je     80283e <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8027d8:	8b 43 04             	mov    0x4(%ebx),%eax
+  8027db:	8b 0b                	mov    (%ebx),%ecx
+  8027dd:	8d 51 20             	lea    0x20(%ecx),%edx
+  8027e0:	39 d0                	cmp    %edx,%eax
+  8027e2:	72 2b                	jb     80280f <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  8027e4:	89 da                	mov    %ebx,%edx
+  8027e6:	89 f0                	mov    %esi,%eax
+  8027e8:	e8 94 fe ff ff       	call   802681 <_pipeisclosed>
+  8027ed:	85 c0                	test   %eax,%eax
+  8027ef:	75 51                	jne    802842 <devpipe_write+0x8d>
+      sys_yield();
+  8027f1:	e8 d9 e5 ff ff       	call   800dcf <sys_yield>
+  8027f6:	eb e0                	jmp    8027d8 <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  8027f8:	83 ec 0c             	sub    $0xc,%esp
+  8027fb:	ff 75 10             	push   0x10(%ebp)
+  8027fe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802801:	89 c2                	mov    %eax,%edx
+  802803:	89 f0                	mov    %esi,%eax
+  802805:	e8 dc fe ff ff       	call   8026e6 <devpipe_write_bulk>
+  80280a:	83 c4 10             	add    $0x10,%esp
+  80280d:	eb 38                	jmp    802847 <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80280f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802812:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802816:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802819:	89 c2                	mov    %eax,%edx
+  80281b:	c1 fa 1f             	sar    $0x1f,%edx
+  80281e:	89 d1                	mov    %edx,%ecx
+  802820:	c1 e9 1b             	shr    $0x1b,%ecx
+  802823:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802826:	83 e2 1f             	and    $0x1f,%edx
+  802829:	29 ca                	sub    %ecx,%edx
+  80282b:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  80282f:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  802833:	83 c0 01             	add    $0x1,%eax
+  802836:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  802839:	83 c7 01             	add    $0x1,%edi
+  80283c:	eb 95                	jmp    8027d3 <devpipe_write+0x1e>
+  return i;
+  80283e:	89 f8                	mov    %edi,%eax
+  802840:	eb 05                	jmp    802847 <devpipe_write+0x92>
+        return 0;
+  802842:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802847:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80284a:	5b                   	pop    %ebx
+  80284b:	5e                   	pop    %esi
+  80284c:	5f                   	pop    %edi
+  80284d:	5d                   	pop    %ebp
+  80284e:	c3                   	ret
+
+0080284f <devpipe_read_bulk>:
+{
+  80284f:	55                   	push   %ebp
+  802850:	89 e5                	mov    %esp,%ebp
+  802852:	57                   	push   %edi
+  802853:	56                   	push   %esi
+  802854:	53                   	push   %ebx
+  802855:	83 ec 2c             	sub    $0x2c,%esp
+  802858:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80285b:	89 d6                	mov    %edx,%esi
+  80285d:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802860:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  802863:	e8 0c fd ff ff       	call   802574 <pipe_ring>
+  802868:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  80286b:	85 db                	test   %ebx,%ebx
+  80286d:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802872:	0f 45 c3             	cmovne %ebx,%eax
+  802875:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802878:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  80287d:	8d 46 30             	lea    0x30(%esi),%eax
+  802880:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  802883:	eb 50                	jmp    8028d5 <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  802885:	89 d1                	mov    %edx,%ecx
+  802887:	c1 f9 1f             	sar    $0x1f,%ecx
+  80288a:	c1 e9 11             	shr    $0x11,%ecx
+  80288d:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802890:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802895:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  802897:	29 d3                	sub    %edx,%ebx
+  802899:	ba 00 80 00 00       	mov    $0x8000,%edx
+  80289e:	29 c2                	sub    %eax,%edx
+  8028a0:	39 d3                	cmp    %edx,%ebx
+  8028a2:	0f 47 da             	cmova  %edx,%ebx
+  8028a5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8028a8:	29 fa                	sub    %edi,%edx
+  8028aa:	39 d3                	cmp    %edx,%ebx
+  8028ac:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  8028af:	83 ec 04             	sub    $0x4,%esp
+  8028b2:	53                   	push   %ebx
+  8028b3:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8028b6:	01 c8                	add    %ecx,%eax
+  8028b8:	50                   	push   %eax
+  8028b9:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8028bc:	01 f8                	add    %edi,%eax
+  8028be:	50                   	push   %eax
+  8028bf:	e8 26 e3 ff ff       	call   800bea <memcpy>
+    i += m;
+  8028c4:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  8028c6:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8028c8:	89 f2                	mov    %esi,%edx
+  8028ca:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8028cd:	e8 03 fd ff ff       	call   8025d5 <pipe_wakeup>
+  8028d2:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  8028d5:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  8028d8:	73 51                	jae    80292b <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  8028da:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  8028dd:	8b 16                	mov    (%esi),%edx
+  8028df:	39 da                	cmp    %ebx,%edx
+  8028e1:	75 a2                	jne    802885 <devpipe_read_bulk+0x36>
+      if (i > 0)
+  8028e3:	85 ff                	test   %edi,%edi
+  8028e5:	75 44                	jne    80292b <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  8028e7:	89 f2                	mov    %esi,%edx
+  8028e9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8028ec:	e8 90 fd ff ff       	call   802681 <_pipeisclosed>
+  8028f1:	85 c0                	test   %eax,%eax
+  8028f3:	75 3a                	jne    80292f <devpipe_read_bulk+0xe0>
+  8028f5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8028fa:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  8028fe:	6a 64                	push   $0x64
+  802900:	ff 75 d4             	push   -0x2c(%ebp)
+  802903:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  802904:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802907:	50                   	push   %eax
+  802908:	e8 5d e8 ff ff       	call   80116a <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  80290d:	85 c0                	test   %eax,%eax
+  80290f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802914:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  802917:	83 c4 10             	add    $0x10,%esp
+  80291a:	a8 01                	test   $0x1,%al
+  80291c:	74 b7                	je     8028d5 <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  80291e:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  802923:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802926:	5b                   	pop    %ebx
+  802927:	5e                   	pop    %esi
+  802928:	5f                   	pop    %edi
+  802929:	5d                   	pop    %ebp
+  80292a:	c3                   	ret
+  return i;
+  80292b:	89 f8                	mov    %edi,%eax
+  80292d:	eb f4                	jmp    802923 <devpipe_read_bulk+0xd4>
+        return 0;
+  80292f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802934:	eb ed                	jmp    802923 <devpipe_read_bulk+0xd4>
+
+00802936 <devpipe_read>:
+{
+  802936:	55                   	push   %ebp
+  802937:	89 e5                	mov    %esp,%ebp
+  802939:	57                   	push   %edi
+  80293a:	56                   	push   %esi
+  80293b:	53                   	push   %ebx
+  80293c:	83 ec 18             	sub    $0x18,%esp
+  80293f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  802942:	57                   	push   %edi
+  802943:	e8 f7 ea ff ff       	call   80143f <fd2data>
+  802948:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  80294a:	8b 70 28             	mov    0x28(%eax),%esi
+  80294d:	83 c4 10             	add    $0x10,%esp
+  802950:	85 f6                	test   %esi,%esi
+  802952:	75 24                	jne    802978 <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  802954:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802957:	74 60                	je     8029b9 <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  802959:	8b 03                	mov    (%ebx),%eax
+  80295b:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80295e:	75 3b                	jne    80299b <devpipe_read+0x65>
+      if (i > 0)
+  802960:	85 f6                	test   %esi,%esi
+  802962:	75 2d                	jne    802991 <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  802964:	89 da                	mov    %ebx,%edx
+  802966:	89 f8                	mov    %edi,%eax
+  802968:	e8 14 fd ff ff       	call   802681 <_pipeisclosed>
+  80296d:	85 c0                	test   %eax,%eax
+  80296f:	75 4c                	jne    8029bd <devpipe_read+0x87>
+      sys_yield();
+  802971:	e8 59 e4 ff ff       	call   800dcf <sys_yield>
+  802976:	eb e1                	jmp    802959 <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  802978:	83 ec 08             	sub    $0x8,%esp
+  80297b:	6a 00                	push   $0x0
+  80297d:	ff 75 10             	push   0x10(%ebp)
+  802980:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802983:	89 c2                	mov    %eax,%edx
+  802985:	89 f8                	mov    %edi,%eax
+  802987:	e8 c3 fe ff ff       	call   80284f <devpipe_read_bulk>
+  80298c:	83 c4 10             	add    $0x10,%esp
+  80298f:	eb 02                	jmp    802993 <devpipe_read+0x5d>
+        return i;
+  802991:	89 f0                	mov    %esi,%eax
+}
+  802993:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802996:	5b                   	pop    %ebx
+  802997:	5e                   	pop    %esi
+  802998:	5f                   	pop    %edi
+  802999:	5d                   	pop    %ebp
+  80299a:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80299b:	99                   	cltd
+  80299c:	c1 ea 1b             	shr    $0x1b,%edx
+  80299f:	01 d0                	add    %edx,%eax
+  8029a1:	83 e0 1f             	and    $0x1f,%eax
+  8029a4:	29 d0                	sub    %edx,%eax
+  8029a6:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8029ab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8029ae:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  8029b1:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  8029b4:	83 c6 01             	add    $0x1,%esi
+  8029b7:	eb 9b                	jmp    802954 <devpipe_read+0x1e>
+  return i;
+  8029b9:	89 f0                	mov    %esi,%eax
+  8029bb:	eb d6                	jmp    802993 <devpipe_read+0x5d>
+        return 0;
+  8029bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029c2:	eb cf                	jmp    802993 <devpipe_read+0x5d>
+
+008029c4 <pipe2>:
+{
+  8029c4:	55                   	push   %ebp
+  8029c5:	89 e5                	mov    %esp,%ebp
+  8029c7:	57                   	push   %edi
+  8029c8:	56                   	push   %esi
+  8029c9:	53                   	push   %ebx
+  8029ca:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  8029cd:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8029d0:	50                   	push   %eax
+  8029d1:	e8 7d ea ff ff       	call   801453 <fd_alloc>
+  8029d6:	89 c3                	mov    %eax,%ebx
+  8029d8:	83 c4 10             	add    $0x10,%esp
+  8029db:	85 c0                	test   %eax,%eax
+  8029dd:	0f 88 fb 01 00 00    	js     802bde <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8029e3:	83 ec 04             	sub    $0x4,%esp
+  8029e6:	68 07 04 00 00       	push   $0x407
+  8029eb:	ff 75 e4             	push   -0x1c(%ebp)
+  8029ee:	6a 00                	push   $0x0
+  8029f0:	e8 3c e4 ff ff       	call   800e31 <sys_page_alloc>
+  8029f5:	89 c3                	mov    %eax,%ebx
+  8029f7:	83 c4 10             	add    $0x10,%esp
+  8029fa:	85 c0                	test   %eax,%eax
+  8029fc:	0f 88 dc 01 00 00    	js     802bde <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  802a02:	83 ec 0c             	sub    $0xc,%esp
+  802a05:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  802a08:	50                   	push   %eax
+  802a09:	e8 45 ea ff ff       	call   801453 <fd_alloc>
+  802a0e:	89 c3                	mov    %eax,%ebx
+  802a10:	83 c4 10             	add    $0x10,%esp
+  802a13:	85 c0                	test   %eax,%eax
+  802a15:	0f 88 b3 01 00 00    	js     802bce <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802a1b:	83 ec 04             	sub    $0x4,%esp
+  802a1e:	68 07 04 00 00       	push   $0x407
+  802a23:	ff 75 e0             	push   -0x20(%ebp)
+  802a26:	6a 00                	push   $0x0
+  802a28:	e8 04 e4 ff ff       	call   800e31 <sys_page_alloc>
+  802a2d:	89 c3                	mov    %eax,%ebx
+  802a2f:	83 c4 10             	add    $0x10,%esp
+  802a32:	85 c0                	test   %eax,%eax
+  802a34:	0f 88 94 01 00 00    	js     802bce <pipe2+0x20a>
+  va = fd2data(fd0);
+  802a3a:	83 ec 0c             	sub    $0xc,%esp
+  802a3d:	ff 75 e4             	push   -0x1c(%ebp)
+  802a40:	e8 fa e9 ff ff       	call   80143f <fd2data>
+  802a45:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802a47:	83 c4 0c             	add    $0xc,%esp
+  802a4a:	68 07 04 00 00       	push   $0x407
+  802a4f:	50                   	push   %eax
+  802a50:	6a 00                	push   $0x0
+  802a52:	e8 da e3 ff ff       	call   800e31 <sys_page_alloc>
+  802a57:	89 c3                	mov    %eax,%ebx
+  802a59:	83 c4 10             	add    $0x10,%esp
+  802a5c:	85 c0                	test   %eax,%eax
+  802a5e:	0f 88 5a 01 00 00    	js     802bbe <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802a64:	83 ec 0c             	sub    $0xc,%esp
+  802a67:	ff 75 e0             	push   -0x20(%ebp)
+  802a6a:	e8 d0 e9 ff ff       	call   80143f <fd2data>
+  802a6f:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802a76:	50                   	push   %eax
+  802a77:	6a 00                	push   $0x0
+  802a79:	57                   	push   %edi
+  802a7a:	6a 00                	push   $0x0
+  802a7c:	e8 f3 e3 ff ff       	call   800e74 <sys_page_map>
+  802a81:	89 c3                	mov    %eax,%ebx
+  802a83:	83 c4 20             	add    $0x20,%esp
+  802a86:	85 c0                	test   %eax,%eax
+  802a88:	0f 88 22 01 00 00    	js     802bb0 <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  802a8e:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  802a92:	74 72                	je     802b06 <pipe2+0x142>
+  802a94:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  802a99:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802a9c:	e8 d3 fa ff ff       	call   802574 <pipe_ring>
+  802aa1:	83 ec 04             	sub    $0x4,%esp
+  802aa4:	68 07 04 00 00       	push   $0x407
+  802aa9:	01 f0                	add    %esi,%eax
+  802aab:	50                   	push   %eax
+  802aac:	6a 00                	push   $0x0
+  802aae:	e8 7e e3 ff ff       	call   800e31 <sys_page_alloc>
+  802ab3:	89 c3                	mov    %eax,%ebx
+  802ab5:	83 c4 10             	add    $0x10,%esp
+  802ab8:	85 c0                	test   %eax,%eax
+  802aba:	0f 88 97 00 00 00    	js     802b57 <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  802ac0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802ac3:	e8 ac fa ff ff       	call   802574 <pipe_ring>
+  802ac8:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  802acb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802ace:	e8 a1 fa ff ff       	call   802574 <pipe_ring>
+  802ad3:	83 ec 0c             	sub    $0xc,%esp
+  802ad6:	68 07 04 00 00       	push   $0x407
+  802adb:	53                   	push   %ebx
+  802adc:	6a 00                	push   $0x0
+  802ade:	01 f0                	add    %esi,%eax
+  802ae0:	50                   	push   %eax
+  802ae1:	6a 00                	push   $0x0
+  802ae3:	e8 8c e3 ff ff       	call   800e74 <sys_page_map>
+  802ae8:	89 c3                	mov    %eax,%ebx
+  802aea:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802af0:	83 c4 20             	add    $0x20,%esp
+  802af3:	85 c0                	test   %eax,%eax
+  802af5:	78 60                	js     802b57 <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  802af7:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802afd:	75 9a                	jne    802a99 <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  802aff:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  802b06:	a1 20 40 80 00       	mov    0x804020,%eax
+  802b0b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802b0e:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  802b10:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802b13:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  802b1a:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802b1d:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  802b1f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802b22:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  802b29:	83 ec 0c             	sub    $0xc,%esp
+  802b2c:	ff 75 e4             	push   -0x1c(%ebp)
+  802b2f:	e8 fb e8 ff ff       	call   80142f <fd2num>
+  802b34:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802b37:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  802b39:	83 c4 04             	add    $0x4,%esp
+  802b3c:	ff 75 e0             	push   -0x20(%ebp)
+  802b3f:	e8 eb e8 ff ff       	call   80142f <fd2num>
+  802b44:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802b47:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  802b4a:	83 c4 10             	add    $0x10,%esp
+  802b4d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b52:	e9 87 00 00 00       	jmp    802bde <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802b57:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  802b5c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802b5f:	e8 10 fa ff ff       	call   802574 <pipe_ring>
+  802b64:	83 ec 08             	sub    $0x8,%esp
+  802b67:	01 f0                	add    %esi,%eax
+  802b69:	50                   	push   %eax
+  802b6a:	6a 00                	push   $0x0
+  802b6c:	e8 45 e3 ff ff       	call   800eb6 <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  802b71:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802b74:	e8 fb f9 ff ff       	call   802574 <pipe_ring>
+  802b79:	83 c4 08             	add    $0x8,%esp
+  802b7c:	01 f0                	add    %esi,%eax
+  802b7e:	50                   	push   %eax
+  802b7f:	6a 00                	push   $0x0
+  802b81:	e8 30 e3 ff ff       	call   800eb6 <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802b86:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802b8c:	83 c4 10             	add    $0x10,%esp
+  802b8f:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802b95:	75 c5                	jne    802b5c <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  802b97:	83 ec 0c             	sub    $0xc,%esp
+  802b9a:	ff 75 e0             	push   -0x20(%ebp)
+  802b9d:	e8 9d e8 ff ff       	call   80143f <fd2data>
+  802ba2:	83 c4 08             	add    $0x8,%esp
+  802ba5:	50                   	push   %eax
+  802ba6:	6a 00                	push   $0x0
+  802ba8:	e8 09 e3 ff ff       	call   800eb6 <sys_page_unmap>
+  802bad:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  802bb0:	83 ec 08             	sub    $0x8,%esp
+  802bb3:	57                   	push   %edi
+  802bb4:	6a 00                	push   $0x0
+  802bb6:	e8 fb e2 ff ff       	call   800eb6 <sys_page_unmap>
+  802bbb:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  802bbe:	83 ec 08             	sub    $0x8,%esp
+  802bc1:	ff 75 e0             	push   -0x20(%ebp)
+  802bc4:	6a 00                	push   $0x0
+  802bc6:	e8 eb e2 ff ff       	call   800eb6 <sys_page_unmap>
+  802bcb:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  802bce:	83 ec 08             	sub    $0x8,%esp
+  802bd1:	ff 75 e4             	push   -0x1c(%ebp)
+  802bd4:	6a 00                	push   $0x0
+  802bd6:	e8 db e2 ff ff       	call   800eb6 <sys_page_unmap>
+  802bdb:	83 c4 10             	add    $0x10,%esp
+}
+  802bde:	89 d8                	mov    %ebx,%eax
+  802be0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802be3:	5b                   	pop    %ebx
+  802be4:	5e                   	pop    %esi
+  802be5:	5f                   	pop    %edi
+  802be6:	5d                   	pop    %ebp
+  802be7:	c3                   	ret
+
+00802be8 <pipe>:
+{
+  802be8:	55                   	push   %ebp
+  802be9:	89 e5                	mov    %esp,%ebp
+  802beb:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  802bee:	6a 00                	push   $0x0
+  802bf0:	ff 75 08             	push   0x8(%ebp)
+  802bf3:	e8 cc fd ff ff       	call   8029c4 <pipe2>
+}
+  802bf8:	c9                   	leave
+  802bf9:	c3                   	ret
+
+00802bfa <pipeisclosed>:
+{
+  802bfa:	55                   	push   %ebp
+  802bfb:	89 e5                	mov    %esp,%ebp
+  802bfd:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802c00:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802c03:	50                   	push   %eax
+  802c04:	ff 75 08             	push   0x8(%ebp)
+  802c07:	e8 9d e8 ff ff       	call   8014a9 <fd_lookup>
+  802c0c:	83 c4 10             	add    $0x10,%esp
+  802c0f:	85 c0                	test   %eax,%eax
+  802c11:	78 18                	js     802c2b <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  802c13:	83 ec 0c             	sub    $0xc,%esp
+  802c16:	ff 75 f4             	push   -0xc(%ebp)
+  802c19:	e8 21 e8 ff ff       	call   80143f <fd2data>
+  802c1e:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  802c20:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c23:	e8 59 fa ff ff       	call   802681 <_pipeisclosed>
+  802c28:	83 c4 10             	add    $0x10,%esp
+}
+  802c2b:	c9                   	leave
+  802c2c:	c3                   	ret
+
+00802c2d <pipe_splice>:
+{
+  802c2d:	55                   	push   %ebp
+  802c2e:	89 e5                	mov    %esp,%ebp
+  802c30:	57                   	push   %edi
+  802c31:	56                   	push   %esi
+  802c32:	53                   	push   %ebx
+  802c33:	83 ec 34             	sub    $0x34,%esp
+  802c36:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802c39:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802c3c:	50                   	push   %eax
+  802c3d:	ff 75 08             	push   0x8(%ebp)
+  802c40:	e8 64 e8 ff ff       	call   8014a9 <fd_lookup>
+  802c45:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802c48:	83 c4 10             	add    $0x10,%esp
+  802c4b:	85 c0                	test   %eax,%eax
+  802c4d:	0f 88 d7 00 00 00    	js     802d2a <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  802c53:	83 ec 0c             	sub    $0xc,%esp
+  802c56:	ff 75 e4             	push   -0x1c(%ebp)
+  802c59:	e8 e1 e7 ff ff       	call   80143f <fd2data>
+  802c5e:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802c60:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802c63:	83 c4 10             	add    $0x10,%esp
+  802c66:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802c6c:	39 10                	cmp    %edx,(%eax)
+  802c6e:	0f 85 c1 00 00 00    	jne    802d35 <pipe_splice+0x108>
+  802c74:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  802c78:	0f 84 c0 00 00 00    	je     802d3e <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  802c7e:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802c82:	0f 84 bf 00 00 00    	je     802d47 <pipe_splice+0x11a>
+  802c88:	89 f7                	mov    %esi,%edi
+  802c8a:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  802c90:	0f 85 ba 00 00 00    	jne    802d50 <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802c96:	8d 43 04             	lea    0x4(%ebx),%eax
+  802c99:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802c9c:	eb 38                	jmp    802cd6 <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802c9e:	83 ec 0c             	sub    $0xc,%esp
+  802ca1:	68 00 10 00 00       	push   $0x1000
+  802ca6:	89 f1                	mov    %esi,%ecx
+  802ca8:	89 da                	mov    %ebx,%edx
+  802caa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802cad:	e8 34 fa ff ff       	call   8026e6 <devpipe_write_bulk>
+  802cb2:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802cb5:	83 c4 10             	add    $0x10,%esp
+  802cb8:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802cbd:	75 53                	jne    802d12 <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  802cbf:	83 ec 08             	sub    $0x8,%esp
+  802cc2:	56                   	push   %esi
+  802cc3:	6a 00                	push   $0x0
+  802cc5:	e8 ec e1 ff ff       	call   800eb6 <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  802cca:	83 c7 01             	add    $0x1,%edi
+  802ccd:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802cd3:	83 c4 10             	add    $0x10,%esp
+  802cd6:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802cd9:	74 3a                	je     802d15 <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  802cdb:	8b 03                	mov    (%ebx),%eax
+  802cdd:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802ce0:	75 bc                	jne    802c9e <pipe_splice+0x71>
+  802ce2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ce7:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  802ceb:	85 c0                	test   %eax,%eax
+  802ced:	74 af                	je     802c9e <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802cef:	83 ec 04             	sub    $0x4,%esp
+  802cf2:	6a 07                	push   $0x7
+  802cf4:	56                   	push   %esi
+  802cf5:	ff 75 d0             	push   -0x30(%ebp)
+  802cf8:	e8 90 e4 ff ff       	call   80118d <sys_chan_wakeup>
+  802cfd:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802d00:	83 c4 10             	add    $0x10,%esp
+  802d03:	85 c0                	test   %eax,%eax
+  802d05:	79 b8                	jns    802cbf <pipe_splice+0x92>
+  802d07:	b8 01 00 00 00       	mov    $0x1,%eax
+  802d0c:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802d10:	eb 8c                	jmp    802c9e <pipe_splice+0x71>
+  802d12:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  802d15:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802d19:	75 06                	jne    802d21 <pipe_splice+0xf4>
+  802d1b:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802d1f:	78 09                	js     802d2a <pipe_splice+0xfd>
+  return i * PGSIZE;
+  802d21:	8b 45 10             	mov    0x10(%ebp),%eax
+  802d24:	c1 e0 0c             	shl    $0xc,%eax
+  802d27:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  802d2a:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802d2d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d30:	5b                   	pop    %ebx
+  802d31:	5e                   	pop    %esi
+  802d32:	5f                   	pop    %edi
+  802d33:	5d                   	pop    %ebp
+  802d34:	c3                   	ret
+    return -E_INVAL;
+  802d35:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802d3c:	eb ec                	jmp    802d2a <pipe_splice+0xfd>
+  802d3e:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802d45:	eb e3                	jmp    802d2a <pipe_splice+0xfd>
+  802d47:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802d4e:	eb da                	jmp    802d2a <pipe_splice+0xfd>
+  802d50:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802d57:	eb d1                	jmp    802d2a <pipe_splice+0xfd>
+
+00802d59 <pipe_splice_read>:
+{
+  802d59:	55                   	push   %ebp
+  802d5a:	89 e5                	mov    %esp,%ebp
+  802d5c:	53                   	push   %ebx
+  802d5d:	83 ec 1c             	sub    $0x1c,%esp
+  802d60:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802d63:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802d66:	50                   	push   %eax
+  802d67:	ff 75 08             	push   0x8(%ebp)
+  802d6a:	e8 3a e7 ff ff       	call   8014a9 <fd_lookup>
+  802d6f:	83 c4 10             	add    $0x10,%esp
+  802d72:	85 c0                	test   %eax,%eax
+  802d74:	78 49                	js     802dbf <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  802d76:	83 ec 0c             	sub    $0xc,%esp
+  802d79:	ff 75 f4             	push   -0xc(%ebp)
+  802d7c:	e8 be e6 ff ff       	call   80143f <fd2data>
+  802d81:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802d83:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802d86:	83 c4 10             	add    $0x10,%esp
+  802d89:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  802d8f:	39 08                	cmp    %ecx,(%eax)
+  802d91:	75 31                	jne    802dc4 <pipe_splice_read+0x6b>
+  802d93:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  802d97:	74 32                	je     802dcb <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  802d99:	8b 48 08             	mov    0x8(%eax),%ecx
+  802d9c:	83 e1 03             	and    $0x3,%ecx
+  802d9f:	83 f9 01             	cmp    $0x1,%ecx
+  802da2:	74 2e                	je     802dd2 <pipe_splice_read+0x79>
+  802da4:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  802daa:	75 2d                	jne    802dd9 <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  802dac:	83 ec 08             	sub    $0x8,%esp
+  802daf:	53                   	push   %ebx
+  802db0:	68 00 10 00 00       	push   $0x1000
+  802db5:	89 d9                	mov    %ebx,%ecx
+  802db7:	e8 93 fa ff ff       	call   80284f <devpipe_read_bulk>
+  802dbc:	83 c4 10             	add    $0x10,%esp
+}
+  802dbf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802dc2:	c9                   	leave
+  802dc3:	c3                   	ret
+    return -E_INVAL;
+  802dc4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802dc9:	eb f4                	jmp    802dbf <pipe_splice_read+0x66>
+  802dcb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802dd0:	eb ed                	jmp    802dbf <pipe_splice_read+0x66>
+  802dd2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802dd7:	eb e6                	jmp    802dbf <pipe_splice_read+0x66>
+  802dd9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802dde:	eb df                	jmp    802dbf <pipe_splice_read+0x66>
+
+00802de0 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  802de0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802de5:	c3                   	ret
+
+00802de6 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802de6:	55                   	push   %ebp
+  802de7:	89 e5                	mov    %esp,%ebp
+  802de9:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  802dec:	68 47 38 80 00       	push   $0x803847
+  802df1:	ff 75 0c             	push   0xc(%ebp)
+  802df4:	e8 09 dc ff ff       	call   800a02 <strcpy>
+  return 0;
+}
+  802df9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dfe:	c9                   	leave
+  802dff:	c3                   	ret
+
+00802e00 <devcons_write>:
+{
+  802e00:	55                   	push   %ebp
+  802e01:	89 e5                	mov    %esp,%ebp
+  802e03:	57                   	push   %edi
+  802e04:	56                   	push   %esi
+  802e05:	53                   	push   %ebx
+  802e06:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  802e0c:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  802e11:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  802e17:	eb 2e                	jmp    802e47 <devcons_write+0x47>
+    m = n - tot;
+  802e19:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802e1c:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  802e1e:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802e23:	39 c3                	cmp    %eax,%ebx
+  802e25:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  802e28:	83 ec 04             	sub    $0x4,%esp
+  802e2b:	53                   	push   %ebx
+  802e2c:	89 f0                	mov    %esi,%eax
+  802e2e:	03 45 0c             	add    0xc(%ebp),%eax
+  802e31:	50                   	push   %eax
+  802e32:	57                   	push   %edi
+  802e33:	e8 50 dd ff ff       	call   800b88 <memmove>
+    sys_cputs(buf, m);
+  802e38:	83 c4 08             	add    $0x8,%esp
+  802e3b:	53                   	push   %ebx
+  802e3c:	57                   	push   %edi
+  802e3d:	e8 f0 de ff ff       	call   800d32 <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  802e42:	01 de                	add    %ebx,%esi
+  802e44:	83 c4 10             	add    $0x10,%esp
+  802e47:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802e4a:	72 cd                	jb     802e19 <devcons_write+0x19>
+}
+  802e4c:	89 f0                	mov    %esi,%eax
+  802e4e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e51:	5b                   	pop    %ebx
+  802e52:	5e                   	pop    %esi
+  802e53:	5f                   	pop    %edi
+  802e54:	5d                   	pop    %ebp
+  802e55:	c3                   	ret
+
+00802e56 <devcons_read>:
+{
+  802e56:	55                   	push   %ebp
+  802e57:	89 e5                	mov    %esp,%ebp
+  802e59:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  802e5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e61:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802e65:	75 07                	jne    802e6e <devcons_read+0x18>
+  802e67:	eb 1f                	jmp    802e88 <devcons_read+0x32>
+    sys_yield();
+  802e69:	e8 61 df ff ff       	call   800dcf <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  802e6e:	e8 dd de ff ff       	call   800d50 <sys_cgetc>
+  802e73:	85 c0                	test   %eax,%eax
+  802e75:	74 f2                	je     802e69 <devcons_read+0x13>
+  if (c < 0)
+  802e77:	78 0f                	js     802e88 <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  802e79:	83 f8 04             	cmp    $0x4,%eax
+  802e7c:	74 0c                	je     802e8a <devcons_read+0x34>
+  *(char*)vbuf = c;
+  802e7e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802e81:	88 02                	mov    %al,(%edx)
+  return 1;
+  802e83:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802e88:	c9                   	leave
+  802e89:	c3                   	ret
+    return 0;
+  802e8a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e8f:	eb f7                	jmp    802e88 <devcons_read+0x32>
+
+00802e91 <cputchar>:
+{
+  802e91:	55                   	push   %ebp
+  802e92:	89 e5                	mov    %esp,%ebp
+  802e94:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  802e97:	8b 45 08             	mov    0x8(%ebp),%eax
+  802e9a:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  802e9d:	6a 01                	push   $0x1
+  802e9f:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802ea2:	50                   	push   %eax
+  802ea3:	e8 8a de ff ff       	call   800d32 <sys_cputs>
+}
+  802ea8:	83 c4 10             	add    $0x10,%esp
+  802eab:	c9                   	leave
+  802eac:	c3                   	ret
+
+00802ead <getchar>:
+{
+  802ead:	55                   	push   %ebp
+  802eae:	89 e5                	mov    %esp,%ebp
+  802eb0:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  802eb3:	6a 01                	push   $0x1
+  802eb5:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802eb8:	50                   	push   %eax
+  802eb9:	6a 00                	push   $0x0
+  802ebb:	e8 94 e8 ff ff       	call   801754 <read>
+  if (r < 0)
+  802ec0:	83 c4 10             	add    $0x10,%esp
+  802ec3:	85 c0                	test   %eax,%eax
+  802ec5:	78 06                	js     802ecd <getchar+0x20>
+  if (r < 1)
+  802ec7:	74 06                	je     802ecf <getchar+0x22>
+  return c;
+  802ec9:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802ecd:	c9                   	leave
+  802ece:	c3                   	ret
+    return -E_EOF;
+  802ecf:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802ed4:	eb f7                	jmp    802ecd <getchar+0x20>
+
+00802ed6 <iscons>:
+{
+  802ed6:	55                   	push   %ebp
+  802ed7:	89 e5                	mov    %esp,%ebp
+  802ed9:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802edc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802edf:	50                   	push   %eax
+  802ee0:	ff 75 08             	push   0x8(%ebp)
+  802ee3:	e8 c1 e5 ff ff       	call   8014a9 <fd_lookup>
+  802ee8:	83 c4 10             	add    $0x10,%esp
+  802eeb:	85 c0                	test   %eax,%eax
+  802eed:	78 11                	js     802f00 <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  802eef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ef2:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802ef8:	39 10                	cmp    %edx,(%eax)
+  802efa:	0f 94 c0             	sete   %al
+  802efd:	0f b6 c0             	movzbl %al,%eax
+}
+  802f00:	c9                   	leave
+  802f01:	c3                   	ret
+
+00802f02 <opencons>:
+{
+  802f02:	55                   	push   %ebp
+  802f03:	89 e5                	mov    %esp,%ebp
+  802f05:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  802f08:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802f0b:	50                   	push   %eax
+  802f0c:	e8 42 e5 ff ff       	call   801453 <fd_alloc>
+  802f11:	83 c4 10             	add    $0x10,%esp
+  802f14:	85 c0                	test   %eax,%eax
+  802f16:	78 3a                	js     802f52 <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802f18:	83 ec 04             	sub    $0x4,%esp
+  802f1b:	68 07 04 00 00       	push   $0x407
+  802f20:	ff 75 f4             	push   -0xc(%ebp)
+  802f23:	6a 00                	push   $0x0
+  802f25:	e8 07 df ff ff       	call   800e31 <sys_page_alloc>
+  802f2a:	83 c4 10             	add    $0x10,%esp
+  802f2d:	85 c0                	test   %eax,%eax
+  802f2f:	78 21                	js     802f52 <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  802f31:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802f34:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802f3a:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  802f3c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802f3f:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  802f46:	83 ec 0c             	sub    $0xc,%esp
+  802f49:	50                   	push   %eax
+  802f4a:	e8 e0 e4 ff ff       	call   80142f <fd2num>
+  802f4f:	83 c4 10             	add    $0x10,%esp
+}
+  802f52:	c9                   	leave
+  802f53:	c3                   	ret
+
+00802f54 <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  802f54:	55                   	push   %ebp
+  802f55:	89 e5                	mov    %esp,%ebp
+  802f57:	57                   	push   %edi
+  802f58:	56                   	push   %esi
+  802f59:	53                   	push   %ebx
+  802f5a:	83 ec 14             	sub    $0x14,%esp
+  802f5d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802f60:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802f63:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802f66:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  802f69:	85 c0                	test   %eax,%eax
+  802f6b:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802f70:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  802f73:	ff 33                	push   (%ebx)
+  802f75:	50                   	push   %eax
+  802f76:	e8 8e e1 ff ff       	call   801109 <sys_ipc_recv>
+  802f7b:	83 c4 10             	add    $0x10,%esp
+  802f7e:	85 c0                	test   %eax,%eax
+  802f80:	78 39                	js     802fbb <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  802f82:	85 ff                	test   %edi,%edi
+  802f84:	74 0a                	je     802f90 <ipc_recv_pages+0x3c>
+  802f86:	a1 60 5b 80 00       	mov    0x805b60,%eax
+  802f8b:	8b 40 7c             	mov    0x7c(%eax),%eax
+  802f8e:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  802f90:	85 f6                	test   %esi,%esi
+  802f92:	74 0d                	je     802fa1 <ipc_recv_pages+0x4d>
+  802f94:	a1 60 5b 80 00       	mov    0x805b60,%eax
+  802f99:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  802f9f:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  802fa1:	a1 60 5b 80 00       	mov    0x805b60,%eax
+  802fa6:	8b 40 74             	mov    0x74(%eax),%eax
+  802fa9:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  802fab:	a1 60 5b 80 00       	mov    0x805b60,%eax
+  802fb0:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  802fb3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fb6:	5b                   	pop    %ebx
+  802fb7:	5e                   	pop    %esi
+  802fb8:	5f                   	pop    %edi
+  802fb9:	5d                   	pop    %ebp
+  802fba:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  802fbb:	85 ff                	test   %edi,%edi
+  802fbd:	74 06                	je     802fc5 <ipc_recv_pages+0x71>
+  802fbf:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  802fc5:	85 f6                	test   %esi,%esi
+  802fc7:	74 06                	je     802fcf <ipc_recv_pages+0x7b>
+  802fc9:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  802fcf:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  802fd5:	eb dc                	jmp    802fb3 <ipc_recv_pages+0x5f>
+
+00802fd7 <ipc_recv>:
+{
+  802fd7:	55                   	push   %ebp
+  802fd8:	89 e5                	mov    %esp,%ebp
+  802fda:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  802fdd:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  802fe4:	ff 75 10             	push   0x10(%ebp)
+  802fe7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802fea:	50                   	push   %eax
+  802feb:	ff 75 0c             	push   0xc(%ebp)
+  802fee:	ff 75 08             	push   0x8(%ebp)
+  802ff1:	e8 5e ff ff ff       	call   802f54 <ipc_recv_pages>
+}
+  802ff6:	c9                   	leave
+  802ff7:	c3                   	ret
+
+00802ff8 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  802ff8:	55                   	push   %ebp
+  802ff9:	89 e5                	mov    %esp,%ebp
+  802ffb:	57                   	push   %edi
+  802ffc:	56                   	push   %esi
+  802ffd:	53                   	push   %ebx
+  802ffe:	83 ec 0c             	sub    $0xc,%esp
+  803001:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803004:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803007:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  80300a:	89 c3                	mov    %eax,%ebx
+  80300c:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  803012:	85 c0                	test   %eax,%eax
+  803014:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  803019:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  80301c:	83 ec 0c             	sub    $0xc,%esp
+  80301f:	ff 75 14             	push   0x14(%ebp)
+  803022:	ff 75 18             	push   0x18(%ebp)
+  803025:	53                   	push   %ebx
+  803026:	56                   	push   %esi
+  803027:	57                   	push   %edi
+  803028:	e8 bb e0 ff ff       	call   8010e8 <sys_ipc_try_send>
+  80302d:	83 c4 20             	add    $0x20,%esp
+  803030:	85 c0                	test   %eax,%eax
+  803032:	79 1e                	jns    803052 <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  803034:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803037:	75 07                	jne    803040 <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  803039:	e8 91 dd ff ff       	call   800dcf <sys_yield>
+  80303e:	eb dc                	jmp    80301c <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  803040:	50                   	push   %eax
+  803041:	68 53 38 80 00       	push   $0x803853
+  803046:	6a 5c                	push   $0x5c
+  803048:	68 60 38 80 00       	push   $0x803860
+  80304d:	e8 e7 d2 ff ff       	call   800339 <_panic>
+  }
+}
+  803052:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803055:	5b                   	pop    %ebx
+  803056:	5e                   	pop    %esi
+  803057:	5f                   	pop    %edi
+  803058:	5d                   	pop    %ebp
+  803059:	c3                   	ret
+
+0080305a <ipc_send>:
+{
+  80305a:	55                   	push   %ebp
+  80305b:	89 e5                	mov    %esp,%ebp
+  80305d:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  803060:	ff 75 14             	push   0x14(%ebp)
+  803063:	6a 01                	push   $0x1
+  803065:	ff 75 10             	push   0x10(%ebp)
+  803068:	ff 75 0c             	push   0xc(%ebp)
+  80306b:	ff 75 08             	push   0x8(%ebp)
+  80306e:	e8 85 ff ff ff       	call   802ff8 <ipc_send_pages>
+}
+  803073:	83 c4 20             	add    $0x20,%esp
+  803076:	c9                   	leave
+  803077:	c3                   	ret
+
+00803078 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803078:	55                   	push   %ebp
+  803079:	89 e5                	mov    %esp,%ebp
+  80307b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  80307e:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  803083:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803086:	c1 e0 04             	shl    $0x4,%eax
+  803089:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80308e:	8b 40 50             	mov    0x50(%eax),%eax
+  803091:	39 c8                	cmp    %ecx,%eax
+  803093:	74 12                	je     8030a7 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  803095:	83 c2 01             	add    $0x1,%edx
+  803098:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  80309e:	75 e3                	jne    803083 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  8030a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030a5:	eb 0e                	jmp    8030b5 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  8030a7:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8030aa:	c1 e0 04             	shl    $0x4,%eax
+  8030ad:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8030b2:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8030b5:	5d                   	pop    %ebp
+  8030b6:	c3                   	ret
+
+008030b7 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8030b7:	55                   	push   %ebp
+  8030b8:	89 e5                	mov    %esp,%ebp
+  8030ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  8030bd:	89 c2                	mov    %eax,%edx
+  8030bf:	c1 ea 16             	shr    $0x16,%edx
+  8030c2:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  8030c9:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  8030ce:	f6 c1 01             	test   $0x1,%cl
+  8030d1:	74 1c                	je     8030ef <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  8030d3:	c1 e8 0c             	shr    $0xc,%eax
+  8030d6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  8030dd:	a8 01                	test   $0x1,%al
+  8030df:	74 0e                	je     8030ef <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  8030e1:	c1 e8 0c             	shr    $0xc,%eax
+  8030e4:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  8030eb:	ef 
+  8030ec:	0f b7 d2             	movzwl %dx,%edx
+}
+  8030ef:	89 d0                	mov    %edx,%eax
+  8030f1:	5d                   	pop    %ebp
+  8030f2:	c3                   	ret
+
+008030f3 <udivmod>:
+  8030f3:	55                   	push   %ebp
+  8030f4:	57                   	push   %edi
+  8030f5:	56                   	push   %esi
+  8030f6:	53                   	push   %ebx
+  8030f7:	83 ec 14             	sub    $0x14,%esp
+  8030fa:	8b 74 24 28          	mov    0x28(%esp),%esi
+  8030fe:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  803102:	89 fb                	mov    %edi,%ebx
+  803104:	09 f3                	or     %esi,%ebx
+  803106:	0f 84 88 00 00 00    	je     803194 <udivmod+0xa1>
+  80310c:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803111:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  803118:	00 
+  803119:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  803120:	00 
+  803121:	89 cd                	mov    %ecx,%ebp
+  803123:	89 34 24             	mov    %esi,(%esp)
+  803126:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  80312a:	eb 08                	jmp    803134 <udivmod+0x41>
+  80312c:	83 ed 01             	sub    $0x1,%ebp
+  80312f:	83 fd ff             	cmp    $0xffffffff,%ebp
+  803132:	74 6c                	je     8031a0 <udivmod+0xad>
+  803134:	89 c3                	mov    %eax,%ebx
+  803136:	89 d6                	mov    %edx,%esi
+  803138:	89 e9                	mov    %ebp,%ecx
+  80313a:	0f ad f3             	shrd   %cl,%esi,%ebx
+  80313d:	d3 ee                	shr    %cl,%esi
+  80313f:	f6 c1 20             	test   $0x20,%cl
+  803142:	74 04                	je     803148 <udivmod+0x55>
+  803144:	89 f3                	mov    %esi,%ebx
+  803146:	31 f6                	xor    %esi,%esi
+  803148:	8b 3c 24             	mov    (%esp),%edi
+  80314b:	39 fb                	cmp    %edi,%ebx
+  80314d:	89 f7                	mov    %esi,%edi
+  80314f:	8b 1c 24             	mov    (%esp),%ebx
+  803152:	8b 74 24 04          	mov    0x4(%esp),%esi
+  803156:	19 f7                	sbb    %esi,%edi
+  803158:	72 d2                	jb     80312c <udivmod+0x39>
+  80315a:	89 f7                	mov    %esi,%edi
+  80315c:	89 de                	mov    %ebx,%esi
+  80315e:	89 e9                	mov    %ebp,%ecx
+  803160:	0f a5 f7             	shld   %cl,%esi,%edi
+  803163:	d3 e6                	shl    %cl,%esi
+  803165:	f6 c1 20             	test   $0x20,%cl
+  803168:	74 04                	je     80316e <udivmod+0x7b>
+  80316a:	89 f7                	mov    %esi,%edi
+  80316c:	31 f6                	xor    %esi,%esi
+  80316e:	29 f0                	sub    %esi,%eax
+  803170:	19 fa                	sbb    %edi,%edx
+  803172:	be 01 00 00 00       	mov    $0x1,%esi
+  803177:	bf 00 00 00 00       	mov    $0x0,%edi
+  80317c:	0f a5 f7             	shld   %cl,%esi,%edi
+  80317f:	d3 e6                	shl    %cl,%esi
+  803181:	f6 c1 20             	test   $0x20,%cl
+  803184:	74 04                	je     80318a <udivmod+0x97>
+  803186:	89 f7                	mov    %esi,%edi
+  803188:	31 f6                	xor    %esi,%esi
+  80318a:	09 74 24 08          	or     %esi,0x8(%esp)
+  80318e:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  803192:	eb 98                	jmp    80312c <udivmod+0x39>
+  803194:	89 f0                	mov    %esi,%eax
+  803196:	89 fa                	mov    %edi,%edx
+  803198:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80319c:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  8031a0:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  8031a4:	89 01                	mov    %eax,(%ecx)
+  8031a6:	89 51 04             	mov    %edx,0x4(%ecx)
+  8031a9:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8031ad:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8031b1:	83 c4 14             	add    $0x14,%esp
+  8031b4:	5b                   	pop    %ebx
+  8031b5:	5e                   	pop    %esi
+  8031b6:	5f                   	pop    %edi
+  8031b7:	5d                   	pop    %ebp
+  8031b8:	c3                   	ret
+
+008031b9 <__udivdi3>:
+  8031b9:	83 ec 18             	sub    $0x18,%esp
+  8031bc:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8031c0:	50                   	push   %eax
+  8031c1:	ff 74 24 2c          	push   0x2c(%esp)
+  8031c5:	ff 74 24 2c          	push   0x2c(%esp)
+  8031c9:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8031cd:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8031d1:	e8 1d ff ff ff       	call   8030f3 <udivmod>
+  8031d6:	83 c4 24             	add    $0x24,%esp
+  8031d9:	c3                   	ret
+
+008031da <__umoddi3>:
+  8031da:	83 ec 18             	sub    $0x18,%esp
+  8031dd:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8031e1:	50                   	push   %eax
+  8031e2:	ff 74 24 2c          	push   0x2c(%esp)
+  8031e6:	ff 74 24 2c          	push   0x2c(%esp)
+  8031ea:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8031ee:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8031f2:	e8 fc fe ff ff       	call   8030f3 <udivmod>
+  8031f7:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8031fb:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8031ff:	83 c4 24             	add    $0x24,%esp
+  803202:	c3                   	ret
+
+00803203 <__divdi3>:
+  803203:	56                   	push   %esi
+  803204:	53                   	push   %ebx
+  803205:	83 ec 14             	sub    $0x14,%esp
+  803208:	8b 44 24 20          	mov    0x20(%esp),%eax
+  80320c:	8b 54 24 24          	mov    0x24(%esp),%edx
+  803210:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  803214:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  803218:	85 d2                	test   %edx,%edx
+  80321a:	78 18                	js     803234 <__divdi3+0x31>
+  80321c:	85 db                	test   %ebx,%ebx
+  80321e:	78 3e                	js     80325e <__divdi3+0x5b>
+  803220:	83 ec 04             	sub    $0x4,%esp
+  803223:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803227:	56                   	push   %esi
+  803228:	53                   	push   %ebx
+  803229:	51                   	push   %ecx
+  80322a:	e8 c4 fe ff ff       	call   8030f3 <udivmod>
+  80322f:	83 c4 10             	add    $0x10,%esp
+  803232:	eb 24                	jmp    803258 <__divdi3+0x55>
+  803234:	f7 d8                	neg    %eax
+  803236:	83 d2 00             	adc    $0x0,%edx
+  803239:	f7 da                	neg    %edx
+  80323b:	85 db                	test   %ebx,%ebx
+  80323d:	78 3a                	js     803279 <__divdi3+0x76>
+  80323f:	83 ec 04             	sub    $0x4,%esp
+  803242:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803246:	56                   	push   %esi
+  803247:	53                   	push   %ebx
+  803248:	51                   	push   %ecx
+  803249:	e8 a5 fe ff ff       	call   8030f3 <udivmod>
+  80324e:	83 c4 10             	add    $0x10,%esp
+  803251:	f7 d8                	neg    %eax
+  803253:	83 d2 00             	adc    $0x0,%edx
+  803256:	f7 da                	neg    %edx
+  803258:	83 c4 14             	add    $0x14,%esp
+  80325b:	5b                   	pop    %ebx
+  80325c:	5e                   	pop    %esi
+  80325d:	c3                   	ret
+  80325e:	83 ec 04             	sub    $0x4,%esp
+  803261:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803265:	56                   	push   %esi
+  803266:	f7 d9                	neg    %ecx
+  803268:	83 d3 00             	adc    $0x0,%ebx
+  80326b:	f7 db                	neg    %ebx
+  80326d:	53                   	push   %ebx
+  80326e:	51                   	push   %ecx
+  80326f:	e8 7f fe ff ff       	call   8030f3 <udivmod>
+  803274:	83 c4 10             	add    $0x10,%esp
+  803277:	eb d8                	jmp    803251 <__divdi3+0x4e>
+  803279:	83 ec 04             	sub    $0x4,%esp
+  80327c:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803280:	56                   	push   %esi
+  803281:	f7 d9                	neg    %ecx
+  803283:	83 d3 00             	adc    $0x0,%ebx
+  803286:	f7 db                	neg    %ebx
+  803288:	53                   	push   %ebx
+  803289:	51                   	push   %ecx
+  80328a:	e8 64 fe ff ff       	call   8030f3 <udivmod>
+  80328f:	83 c4 10             	add    $0x10,%esp
+  803292:	eb c4                	jmp    803258 <__divdi3+0x55>
+
+00803294 <__moddi3>:
+  803294:	55                   	push   %ebp
+  803295:	57                   	push   %edi
+  803296:	56                   	push   %esi
+  803297:	53                   	push   %ebx
+  803298:	83 ec 24             	sub    $0x24,%esp
+  80329b:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80329f:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8032a3:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  8032a7:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  8032ab:	85 d2                	test   %edx,%edx
+  8032ad:	78 3b                	js     8032ea <__moddi3+0x56>
+  8032af:	83 ec 04             	sub    $0x4,%esp
+  8032b2:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8032b6:	56                   	push   %esi
+  8032b7:	89 ce                	mov    %ecx,%esi
+  8032b9:	f7 de                	neg    %esi
+  8032bb:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8032bf:	89 de                	mov    %ebx,%esi
+  8032c1:	83 d6 00             	adc    $0x0,%esi
+  8032c4:	f7 de                	neg    %esi
+  8032c6:	89 74 24 14          	mov    %esi,0x14(%esp)
+  8032ca:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8032ce:	0f 48 f1             	cmovs  %ecx,%esi
+  8032d1:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  8032d6:	53                   	push   %ebx
+  8032d7:	56                   	push   %esi
+  8032d8:	e8 16 fe ff ff       	call   8030f3 <udivmod>
+  8032dd:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8032e1:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8032e5:	83 c4 10             	add    $0x10,%esp
+  8032e8:	eb 47                	jmp    803331 <__moddi3+0x9d>
+  8032ea:	f7 d8                	neg    %eax
+  8032ec:	83 d2 00             	adc    $0x0,%edx
+  8032ef:	f7 da                	neg    %edx
+  8032f1:	83 ec 04             	sub    $0x4,%esp
+  8032f4:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8032f8:	56                   	push   %esi
+  8032f9:	89 cf                	mov    %ecx,%edi
+  8032fb:	f7 df                	neg    %edi
+  8032fd:	89 de                	mov    %ebx,%esi
+  8032ff:	83 d6 00             	adc    $0x0,%esi
+  803302:	f7 de                	neg    %esi
+  803304:	0f 49 cf             	cmovns %edi,%ecx
+  803307:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  80330b:	0f 49 de             	cmovns %esi,%ebx
+  80330e:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  803312:	ff 74 24 0c          	push   0xc(%esp)
+  803316:	ff 74 24 0c          	push   0xc(%esp)
+  80331a:	e8 d4 fd ff ff       	call   8030f3 <udivmod>
+  80331f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803323:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803327:	f7 d8                	neg    %eax
+  803329:	83 d2 00             	adc    $0x0,%edx
+  80332c:	f7 da                	neg    %edx
+  80332e:	83 c4 10             	add    $0x10,%esp
+  803331:	83 c4 24             	add    $0x24,%esp
+  803334:	5b                   	pop    %ebx
+  803335:	5e                   	pop    %esi
+  803336:	5f                   	pop    %edi
+  803337:	5d                   	pop    %ebp
+  803338:	c3                   	ret
@@ -0,0 +1,6856 @@
+
+obj/user/lsfd.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 e0 00 00 00       	call   800111 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <usage>:
+#include <inc/lib.h>
+
+void
+usage(void)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 14             	sub    $0x14,%esp
+  cprintf("usage: lsfd [-1]\n");
+  800039:	68 80 31 80 00       	push   $0x803180
+  80003e:	e8 d0 01 00 00       	call   800213 <cprintf>
+  exit();
+  800043:	e8 1c 01 00 00       	call   800164 <exit>
+}
+  800048:	83 c4 10             	add    $0x10,%esp
+  80004b:	c9                   	leave
+  80004c:	c3                   	ret
+
+0080004d <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  80004d:	55                   	push   %ebp
+  80004e:	89 e5                	mov    %esp,%ebp
+  800050:	57                   	push   %edi
+  800051:	56                   	push   %esi
+  800052:	53                   	push   %ebx
+  800053:	81 ec b0 00 00 00    	sub    $0xb0,%esp
+  int i, usefprint = 0;
+  struct Stat st;
+  struct Argstate args;
+
+  argstart(&argc, argv, &args);
+  800059:	8d 85 4c ff ff ff    	lea    -0xb4(%ebp),%eax
+  80005f:	50                   	push   %eax
+  800060:	ff 75 0c             	push   0xc(%ebp)
+  800063:	8d 45 08             	lea    0x8(%ebp),%eax
+  800066:	50                   	push   %eax
+  800067:	e8 73 10 00 00       	call   8010df <argstart>
+  while ((i = argnext(&args)) >= 0)
+  80006c:	83 c4 10             	add    $0x10,%esp
+  int i, usefprint = 0;
+  80006f:	be 00 00 00 00       	mov    $0x0,%esi
+  while ((i = argnext(&args)) >= 0)
+  800074:	8d 9d 4c ff ff ff    	lea    -0xb4(%ebp),%ebx
+    if (i == '1')
+      usefprint = 1;
+  80007a:	bf 01 00 00 00       	mov    $0x1,%edi
+  while ((i = argnext(&args)) >= 0)
+  80007f:	83 ec 0c             	sub    $0xc,%esp
+  800082:	53                   	push   %ebx
+  800083:	e8 87 10 00 00       	call   80110f <argnext>
+  800088:	83 c4 10             	add    $0x10,%esp
+  80008b:	85 c0                	test   %eax,%eax
+  80008d:	78 10                	js     80009f <umain+0x52>
+    if (i == '1')
+  80008f:	83 f8 31             	cmp    $0x31,%eax
+  800092:	75 04                	jne    800098 <umain+0x4b>
+      usefprint = 1;
+  800094:	89 fe                	mov    %edi,%esi
+  800096:	eb e7                	jmp    80007f <umain+0x32>
+    else
+      usage();
+  800098:	e8 96 ff ff ff       	call   800033 <usage>
+  80009d:	eb e0                	jmp    80007f <umain+0x32>
+
+  for (i = 0; i < 32; i++)
+  80009f:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (fstat(i, &st) >= 0) {
+  8000a4:	8d bd 5c ff ff ff    	lea    -0xa4(%ebp),%edi
+  8000aa:	eb 26                	jmp    8000d2 <umain+0x85>
+      if (usefprint)
+        fprintf(1, "fd %d: name %s isdir %d size %d dev %s\n",
+                i, st.st_name, st.st_isdir,
+                st.st_size, st.st_dev->dev_name);
+      else
+        cprintf("fd %d: name %s isdir %d size %d dev %s\n",
+  8000ac:	83 ec 08             	sub    $0x8,%esp
+  8000af:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8000b2:	ff 70 04             	push   0x4(%eax)
+  8000b5:	ff 75 dc             	push   -0x24(%ebp)
+  8000b8:	ff 75 e0             	push   -0x20(%ebp)
+  8000bb:	57                   	push   %edi
+  8000bc:	53                   	push   %ebx
+  8000bd:	68 94 31 80 00       	push   $0x803194
+  8000c2:	e8 4c 01 00 00       	call   800213 <cprintf>
+  8000c7:	83 c4 20             	add    $0x20,%esp
+  for (i = 0; i < 32; i++)
+  8000ca:	83 c3 01             	add    $0x1,%ebx
+  8000cd:	83 fb 20             	cmp    $0x20,%ebx
+  8000d0:	74 37                	je     800109 <umain+0xbc>
+    if (fstat(i, &st) >= 0) {
+  8000d2:	83 ec 08             	sub    $0x8,%esp
+  8000d5:	57                   	push   %edi
+  8000d6:	53                   	push   %ebx
+  8000d7:	e8 6f 16 00 00       	call   80174b <fstat>
+  8000dc:	83 c4 10             	add    $0x10,%esp
+  8000df:	85 c0                	test   %eax,%eax
+  8000e1:	78 e7                	js     8000ca <umain+0x7d>
+      if (usefprint)
+  8000e3:	85 f6                	test   %esi,%esi
+  8000e5:	74 c5                	je     8000ac <umain+0x5f>
+        fprintf(1, "fd %d: name %s isdir %d size %d dev %s\n",
+  8000e7:	83 ec 04             	sub    $0x4,%esp
+  8000ea:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8000ed:	ff 70 04             	push   0x4(%eax)
+  8000f0:	ff 75 dc             	push   -0x24(%ebp)
+  8000f3:	ff 75 e0             	push   -0x20(%ebp)
+  8000f6:	57                   	push   %edi
+  8000f7:	53                   	push   %ebx
+  8000f8:	68 94 31 80 00       	push   $0x803194
+  8000fd:	6a 01                	push   $0x1
+  8000ff:	e8 42 22 00 00       	call   802346 <fprintf>
+  800104:	83 c4 20             	add    $0x20,%esp
+  800107:	eb c1                	jmp    8000ca <umain+0x7d>
+                i, st.st_name, st.st_isdir,
+                st.st_size, st.st_dev->dev_name);
+    }
+}
+  800109:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80010c:	5b                   	pop    %ebx
+  80010d:	5e                   	pop    %esi
+  80010e:	5f                   	pop    %edi
+  80010f:	5d                   	pop    %ebp
+  800110:	c3                   	ret
+
+00800111 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800111:	55                   	push   %ebp
+  800112:	89 e5                	mov    %esp,%ebp
+  800114:	56                   	push   %esi
+  800115:	53                   	push   %ebx
+  800116:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800119:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  80011c:	c7 05 44 57 80 00 00 	movl   $0x0,0x805744
+  800123:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  800126:	e8 84 0a 00 00       	call   800baf <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  80012b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800130:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800133:	c1 e0 04             	shl    $0x4,%eax
+  800136:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80013b:	a3 44 57 80 00       	mov    %eax,0x805744
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800140:	85 db                	test   %ebx,%ebx
+  800142:	7e 07                	jle    80014b <libmain+0x3a>
+    binaryname = argv[0];
+  800144:	8b 06                	mov    (%esi),%eax
+  800146:	a3 00 40 80 00       	mov    %eax,0x804000
+
+  // call user main routine
+  umain(argc, argv);
+  80014b:	83 ec 08             	sub    $0x8,%esp
+  80014e:	56                   	push   %esi
+  80014f:	53                   	push   %ebx
+  800150:	e8 f8 fe ff ff       	call   80004d <umain>
+
+  // exit gracefully
+  exit();
+  800155:	e8 0a 00 00 00       	call   800164 <exit>
+}
+  80015a:	83 c4 10             	add    $0x10,%esp
+  80015d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800160:	5b                   	pop    %ebx
+  800161:	5e                   	pop    %esi
+  800162:	5d                   	pop    %ebp
+  800163:	c3                   	ret
+
+00800164 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800164:	55                   	push   %ebp
+  800165:	89 e5                	mov    %esp,%ebp
+  800167:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  80016a:	e8 89 12 00 00       	call   8013f8 <close_all>
+  sys_env_destroy(0);
+  80016f:	83 ec 0c             	sub    $0xc,%esp
+  800172:	6a 00                	push   $0x0
+  800174:	e8 f5 09 00 00       	call   800b6e <sys_env_destroy>
+}
+  800179:	83 c4 10             	add    $0x10,%esp
+  80017c:	c9                   	leave
+  80017d:	c3                   	ret
+
+0080017e <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80017e:	55                   	push   %ebp
+  80017f:	89 e5                	mov    %esp,%ebp
+  800181:	53                   	push   %ebx
+  800182:	83 ec 04             	sub    $0x4,%esp
+  800185:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  800188:	8b 13                	mov    (%ebx),%edx
+  80018a:	8d 42 01             	lea    0x1(%edx),%eax
+  80018d:	89 03                	mov    %eax,(%ebx)
+  80018f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800192:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  800196:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80019b:	74 09                	je     8001a6 <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  80019d:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8001a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001a4:	c9                   	leave
+  8001a5:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  8001a6:	83 ec 08             	sub    $0x8,%esp
+  8001a9:	68 ff 00 00 00       	push   $0xff
+  8001ae:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001b1:	50                   	push   %eax
+  8001b2:	e8 7a 09 00 00       	call   800b31 <sys_cputs>
+    b->idx = 0;
+  8001b7:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001bd:	83 c4 10             	add    $0x10,%esp
+  8001c0:	eb db                	jmp    80019d <putch+0x1f>
+
+008001c2 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001c2:	55                   	push   %ebp
+  8001c3:	89 e5                	mov    %esp,%ebp
+  8001c5:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  8001cb:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001d2:	00 00 00 
+  b.cnt = 0;
+  8001d5:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001dc:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  8001df:	ff 75 0c             	push   0xc(%ebp)
+  8001e2:	ff 75 08             	push   0x8(%ebp)
+  8001e5:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001eb:	50                   	push   %eax
+  8001ec:	68 7e 01 80 00       	push   $0x80017e
+  8001f1:	e8 14 01 00 00       	call   80030a <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  8001f6:	83 c4 08             	add    $0x8,%esp
+  8001f9:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001ff:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800205:	50                   	push   %eax
+  800206:	e8 26 09 00 00       	call   800b31 <sys_cputs>
+
+  return b.cnt;
+}
+  80020b:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800211:	c9                   	leave
+  800212:	c3                   	ret
+
+00800213 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800213:	55                   	push   %ebp
+  800214:	89 e5                	mov    %esp,%ebp
+  800216:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  800219:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  80021c:	50                   	push   %eax
+  80021d:	ff 75 08             	push   0x8(%ebp)
+  800220:	e8 9d ff ff ff       	call   8001c2 <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  800225:	c9                   	leave
+  800226:	c3                   	ret
+
+00800227 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  800227:	55                   	push   %ebp
+  800228:	89 e5                	mov    %esp,%ebp
+  80022a:	57                   	push   %edi
+  80022b:	56                   	push   %esi
+  80022c:	53                   	push   %ebx
+  80022d:	83 ec 1c             	sub    $0x1c,%esp
+  800230:	89 c7                	mov    %eax,%edi
+  800232:	89 d6                	mov    %edx,%esi
+  800234:	8b 45 08             	mov    0x8(%ebp),%eax
+  800237:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80023a:	89 d1                	mov    %edx,%ecx
+  80023c:	89 c2                	mov    %eax,%edx
+  80023e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800241:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800244:	8b 45 10             	mov    0x10(%ebp),%eax
+  800247:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  80024a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80024d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800254:	39 c2                	cmp    %eax,%edx
+  800256:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800259:	72 3e                	jb     800299 <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  80025b:	83 ec 0c             	sub    $0xc,%esp
+  80025e:	ff 75 18             	push   0x18(%ebp)
+  800261:	83 eb 01             	sub    $0x1,%ebx
+  800264:	53                   	push   %ebx
+  800265:	50                   	push   %eax
+  800266:	83 ec 08             	sub    $0x8,%esp
+  800269:	ff 75 e4             	push   -0x1c(%ebp)
+  80026c:	ff 75 e0             	push   -0x20(%ebp)
+  80026f:	ff 75 dc             	push   -0x24(%ebp)
+  800272:	ff 75 d8             	push   -0x28(%ebp)
+  800275:	e8 84 2d 00 00       	call   802ffe <__udivdi3>
+  80027a:	83 c4 18             	add    $0x18,%esp
+  80027d:	52                   	push   %edx
+  80027e:	50                   	push   %eax
+  80027f:	89 f2                	mov    %esi,%edx
+  800281:	89 f8                	mov    %edi,%eax
+  800283:	e8 9f ff ff ff       	call   800227 <printnum>
+  800288:	83 c4 20             	add    $0x20,%esp
+  80028b:	eb 13                	jmp    8002a0 <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  80028d:	83 ec 08             	sub    $0x8,%esp
+  800290:	56                   	push   %esi
+  800291:	ff 75 18             	push   0x18(%ebp)
+  800294:	ff d7                	call   *%edi
+  800296:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  800299:	83 eb 01             	sub    $0x1,%ebx
+  80029c:	85 db                	test   %ebx,%ebx
+  80029e:	7f ed                	jg     80028d <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  8002a0:	83 ec 08             	sub    $0x8,%esp
+  8002a3:	56                   	push   %esi
+  8002a4:	83 ec 04             	sub    $0x4,%esp
+  8002a7:	ff 75 e4             	push   -0x1c(%ebp)
+  8002aa:	ff 75 e0             	push   -0x20(%ebp)
+  8002ad:	ff 75 dc             	push   -0x24(%ebp)
+  8002b0:	ff 75 d8             	push   -0x28(%ebp)
+  8002b3:	e8 67 2d 00 00       	call   80301f <__umoddi3>
+  8002b8:	83 c4 14             	add    $0x14,%esp
+  8002bb:	0f be 80 c6 31 80 00 	movsbl 0x8031c6(%eax),%eax
+  8002c2:	50                   	push   %eax
+  8002c3:	ff d7                	call   *%edi
+}
+  8002c5:	83 c4 10             	add    $0x10,%esp
+  8002c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002cb:	5b                   	pop    %ebx
+  8002cc:	5e                   	pop    %esi
+  8002cd:	5f                   	pop    %edi
+  8002ce:	5d                   	pop    %ebp
+  8002cf:	c3                   	ret
+
+008002d0 <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002d0:	55                   	push   %ebp
+  8002d1:	89 e5                	mov    %esp,%ebp
+  8002d3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  8002d6:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  8002da:	8b 10                	mov    (%eax),%edx
+  8002dc:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002df:	73 0a                	jae    8002eb <sprintputch+0x1b>
+    *b->buf++ = ch;
+  8002e1:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002e4:	89 08                	mov    %ecx,(%eax)
+  8002e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002e9:	88 02                	mov    %al,(%edx)
+}
+  8002eb:	5d                   	pop    %ebp
+  8002ec:	c3                   	ret
+
+008002ed <printfmt>:
+{
+  8002ed:	55                   	push   %ebp
+  8002ee:	89 e5                	mov    %esp,%ebp
+  8002f0:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  8002f3:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  8002f6:	50                   	push   %eax
+  8002f7:	ff 75 10             	push   0x10(%ebp)
+  8002fa:	ff 75 0c             	push   0xc(%ebp)
+  8002fd:	ff 75 08             	push   0x8(%ebp)
+  800300:	e8 05 00 00 00       	call   80030a <vprintfmt>
+}
+  800305:	83 c4 10             	add    $0x10,%esp
+  800308:	c9                   	leave
+  800309:	c3                   	ret
+
+0080030a <vprintfmt>:
+{
+  80030a:	55                   	push   %ebp
+  80030b:	89 e5                	mov    %esp,%ebp
+  80030d:	57                   	push   %edi
+  80030e:	56                   	push   %esi
+  80030f:	53                   	push   %ebx
+  800310:	83 ec 2c             	sub    $0x2c,%esp
+  800313:	8b 75 08             	mov    0x8(%ebp),%esi
+  800316:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800319:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80031c:	eb 0a                	jmp    800328 <vprintfmt+0x1e>
+      putch(ch, putdat);
+  80031e:	83 ec 08             	sub    $0x8,%esp
+  800321:	53                   	push   %ebx
+  800322:	50                   	push   %eax
+  800323:	ff d6                	call   *%esi
+  800325:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  800328:	83 c7 01             	add    $0x1,%edi
+  80032b:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80032f:	83 f8 25             	cmp    $0x25,%eax
+  800332:	74 0c                	je     800340 <vprintfmt+0x36>
+      if (ch == '\0')
+  800334:	85 c0                	test   %eax,%eax
+  800336:	75 e6                	jne    80031e <vprintfmt+0x14>
+}
+  800338:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80033b:	5b                   	pop    %ebx
+  80033c:	5e                   	pop    %esi
+  80033d:	5f                   	pop    %edi
+  80033e:	5d                   	pop    %ebp
+  80033f:	c3                   	ret
+    padc = ' ';
+  800340:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  800344:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  80034b:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  800352:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  800359:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  80035e:	8d 47 01             	lea    0x1(%edi),%eax
+  800361:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800364:	0f b6 17             	movzbl (%edi),%edx
+  800367:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80036a:	3c 55                	cmp    $0x55,%al
+  80036c:	0f 87 cf 03 00 00    	ja     800741 <vprintfmt+0x437>
+  800372:	0f b6 c0             	movzbl %al,%eax
+  800375:	ff 24 85 20 33 80 00 	jmp    *0x803320(,%eax,4)
+  80037c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  80037f:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800383:	eb d9                	jmp    80035e <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  800385:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800388:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80038c:	eb d0                	jmp    80035e <vprintfmt+0x54>
+  80038e:	0f b6 d2             	movzbl %dl,%edx
+  800391:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  800394:	b8 00 00 00 00       	mov    $0x0,%eax
+  800399:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  80039c:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80039f:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  8003a3:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  8003a6:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8003a9:	83 f9 09             	cmp    $0x9,%ecx
+  8003ac:	77 55                	ja     800403 <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  8003ae:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  8003b1:	eb e9                	jmp    80039c <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  8003b3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003b6:	8b 00                	mov    (%eax),%eax
+  8003b8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003bb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003be:	8d 40 04             	lea    0x4(%eax),%eax
+  8003c1:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  8003c4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  8003c7:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003cb:	79 91                	jns    80035e <vprintfmt+0x54>
+        width = precision, precision = -1;
+  8003cd:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003d0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003d3:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003da:	eb 82                	jmp    80035e <vprintfmt+0x54>
+      if (width < 0)
+  8003dc:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8003df:	85 d2                	test   %edx,%edx
+  8003e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003e6:	0f 49 c2             	cmovns %edx,%eax
+  8003e9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  8003ec:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  8003ef:	e9 6a ff ff ff       	jmp    80035e <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  8003f4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  8003f7:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  8003fe:	e9 5b ff ff ff       	jmp    80035e <vprintfmt+0x54>
+  800403:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800406:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800409:	eb bc                	jmp    8003c7 <vprintfmt+0xbd>
+      lflag++;
+  80040b:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  80040e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  800411:	e9 48 ff ff ff       	jmp    80035e <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  800416:	8b 45 14             	mov    0x14(%ebp),%eax
+  800419:	8d 78 04             	lea    0x4(%eax),%edi
+  80041c:	83 ec 08             	sub    $0x8,%esp
+  80041f:	53                   	push   %ebx
+  800420:	ff 30                	push   (%eax)
+  800422:	ff d6                	call   *%esi
+      break;
+  800424:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  800427:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  80042a:	e9 b1 02 00 00       	jmp    8006e0 <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  80042f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800432:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  800435:	8b 10                	mov    (%eax),%edx
+  800437:	89 d0                	mov    %edx,%eax
+  800439:	f7 d8                	neg    %eax
+  80043b:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80043e:	83 f8 10             	cmp    $0x10,%eax
+  800441:	7f 23                	jg     800466 <vprintfmt+0x15c>
+  800443:	8b 14 85 80 34 80 00 	mov    0x803480(,%eax,4),%edx
+  80044a:	85 d2                	test   %edx,%edx
+  80044c:	74 18                	je     800466 <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  80044e:	52                   	push   %edx
+  80044f:	68 ca 35 80 00       	push   $0x8035ca
+  800454:	53                   	push   %ebx
+  800455:	56                   	push   %esi
+  800456:	e8 92 fe ff ff       	call   8002ed <printfmt>
+  80045b:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  80045e:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800461:	e9 7a 02 00 00       	jmp    8006e0 <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  800466:	50                   	push   %eax
+  800467:	68 de 31 80 00       	push   $0x8031de
+  80046c:	53                   	push   %ebx
+  80046d:	56                   	push   %esi
+  80046e:	e8 7a fe ff ff       	call   8002ed <printfmt>
+  800473:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  800476:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  800479:	e9 62 02 00 00       	jmp    8006e0 <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  80047e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800481:	83 c0 04             	add    $0x4,%eax
+  800484:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800487:	8b 45 14             	mov    0x14(%ebp),%eax
+  80048a:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  80048c:	85 c9                	test   %ecx,%ecx
+  80048e:	b8 d7 31 80 00       	mov    $0x8031d7,%eax
+  800493:	0f 45 c1             	cmovne %ecx,%eax
+  800496:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  800499:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80049d:	7e 06                	jle    8004a5 <vprintfmt+0x19b>
+  80049f:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8004a3:	75 0b                	jne    8004b0 <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8004a5:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8004a8:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8004ab:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004ae:	eb 5c                	jmp    80050c <vprintfmt+0x202>
+  8004b0:	83 ec 08             	sub    $0x8,%esp
+  8004b3:	ff 75 d0             	push   -0x30(%ebp)
+  8004b6:	ff 75 cc             	push   -0x34(%ebp)
+  8004b9:	e8 20 03 00 00       	call   8007de <strnlen>
+  8004be:	89 c2                	mov    %eax,%edx
+  8004c0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004c3:	29 d0                	sub    %edx,%eax
+  8004c5:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  8004c8:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8004cc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004cf:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004d2:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8004d4:	eb 0e                	jmp    8004e4 <vprintfmt+0x1da>
+          putch(padc, putdat);
+  8004d6:	83 ec 08             	sub    $0x8,%esp
+  8004d9:	53                   	push   %ebx
+  8004da:	57                   	push   %edi
+  8004db:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8004de:	83 ee 01             	sub    $0x1,%esi
+  8004e1:	83 c4 10             	add    $0x10,%esp
+  8004e4:	85 f6                	test   %esi,%esi
+  8004e6:	7f ee                	jg     8004d6 <vprintfmt+0x1cc>
+  8004e8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004eb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004ee:	85 c0                	test   %eax,%eax
+  8004f0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004f5:	0f 49 d0             	cmovns %eax,%edx
+  8004f8:	29 d0                	sub    %edx,%eax
+  8004fa:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004fd:	eb a6                	jmp    8004a5 <vprintfmt+0x19b>
+          putch(ch, putdat);
+  8004ff:	83 ec 08             	sub    $0x8,%esp
+  800502:	53                   	push   %ebx
+  800503:	52                   	push   %edx
+  800504:	ff 55 08             	call   *0x8(%ebp)
+  800507:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80050a:	89 f1                	mov    %esi,%ecx
+  80050c:	8d 71 01             	lea    0x1(%ecx),%esi
+  80050f:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800513:	0f be d0             	movsbl %al,%edx
+  800516:	85 d2                	test   %edx,%edx
+  800518:	74 28                	je     800542 <vprintfmt+0x238>
+  80051a:	85 ff                	test   %edi,%edi
+  80051c:	78 05                	js     800523 <vprintfmt+0x219>
+  80051e:	83 ef 01             	sub    $0x1,%edi
+  800521:	78 30                	js     800553 <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  800523:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800527:	74 d6                	je     8004ff <vprintfmt+0x1f5>
+  800529:	0f be c0             	movsbl %al,%eax
+  80052c:	83 e8 20             	sub    $0x20,%eax
+  80052f:	83 f8 5e             	cmp    $0x5e,%eax
+  800532:	76 cb                	jbe    8004ff <vprintfmt+0x1f5>
+          putch('?', putdat);
+  800534:	83 ec 08             	sub    $0x8,%esp
+  800537:	53                   	push   %ebx
+  800538:	6a 3f                	push   $0x3f
+  80053a:	ff 55 08             	call   *0x8(%ebp)
+  80053d:	83 c4 10             	add    $0x10,%esp
+  800540:	eb c8                	jmp    80050a <vprintfmt+0x200>
+  800542:	8b 75 08             	mov    0x8(%ebp),%esi
+  800545:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800548:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80054b:	01 d0                	add    %edx,%eax
+  80054d:	29 c8                	sub    %ecx,%eax
+  80054f:	89 c7                	mov    %eax,%edi
+  800551:	eb 13                	jmp    800566 <vprintfmt+0x25c>
+  800553:	8b 75 08             	mov    0x8(%ebp),%esi
+  800556:	eb ed                	jmp    800545 <vprintfmt+0x23b>
+        putch(' ', putdat);
+  800558:	83 ec 08             	sub    $0x8,%esp
+  80055b:	53                   	push   %ebx
+  80055c:	6a 20                	push   $0x20
+  80055e:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  800560:	83 ef 01             	sub    $0x1,%edi
+  800563:	83 c4 10             	add    $0x10,%esp
+  800566:	85 ff                	test   %edi,%edi
+  800568:	7f ee                	jg     800558 <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  80056a:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80056d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800570:	e9 6b 01 00 00       	jmp    8006e0 <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  800575:	83 f9 01             	cmp    $0x1,%ecx
+  800578:	7f 1f                	jg     800599 <vprintfmt+0x28f>
+  else if (lflag)
+  80057a:	85 c9                	test   %ecx,%ecx
+  80057c:	74 67                	je     8005e5 <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  80057e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800581:	8b 00                	mov    (%eax),%eax
+  800583:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800586:	89 c1                	mov    %eax,%ecx
+  800588:	c1 f9 1f             	sar    $0x1f,%ecx
+  80058b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80058e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800591:	8d 40 04             	lea    0x4(%eax),%eax
+  800594:	89 45 14             	mov    %eax,0x14(%ebp)
+  800597:	eb 17                	jmp    8005b0 <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  800599:	8b 45 14             	mov    0x14(%ebp),%eax
+  80059c:	8b 50 04             	mov    0x4(%eax),%edx
+  80059f:	8b 00                	mov    (%eax),%eax
+  8005a1:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005a4:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005a7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005aa:	8d 40 08             	lea    0x8(%eax),%eax
+  8005ad:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  8005b0:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005b3:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  8005b6:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  8005bb:	85 c9                	test   %ecx,%ecx
+  8005bd:	0f 89 03 01 00 00    	jns    8006c6 <vprintfmt+0x3bc>
+        putch('-', putdat);
+  8005c3:	83 ec 08             	sub    $0x8,%esp
+  8005c6:	53                   	push   %ebx
+  8005c7:	6a 2d                	push   $0x2d
+  8005c9:	ff d6                	call   *%esi
+        num = -(long long)num;
+  8005cb:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005ce:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005d1:	f7 da                	neg    %edx
+  8005d3:	83 d1 00             	adc    $0x0,%ecx
+  8005d6:	f7 d9                	neg    %ecx
+  8005d8:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  8005db:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005e0:	e9 e1 00 00 00       	jmp    8006c6 <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  8005e5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e8:	8b 00                	mov    (%eax),%eax
+  8005ea:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005ed:	89 c1                	mov    %eax,%ecx
+  8005ef:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005f2:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005f5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f8:	8d 40 04             	lea    0x4(%eax),%eax
+  8005fb:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005fe:	eb b0                	jmp    8005b0 <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  800600:	83 f9 01             	cmp    $0x1,%ecx
+  800603:	7f 1e                	jg     800623 <vprintfmt+0x319>
+  else if (lflag)
+  800605:	85 c9                	test   %ecx,%ecx
+  800607:	74 32                	je     80063b <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  800609:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060c:	8b 10                	mov    (%eax),%edx
+  80060e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800613:	8d 40 04             	lea    0x4(%eax),%eax
+  800616:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800619:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  80061e:	e9 a3 00 00 00       	jmp    8006c6 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800623:	8b 45 14             	mov    0x14(%ebp),%eax
+  800626:	8b 10                	mov    (%eax),%edx
+  800628:	8b 48 04             	mov    0x4(%eax),%ecx
+  80062b:	8d 40 08             	lea    0x8(%eax),%eax
+  80062e:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800631:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  800636:	e9 8b 00 00 00       	jmp    8006c6 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  80063b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80063e:	8b 10                	mov    (%eax),%edx
+  800640:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800645:	8d 40 04             	lea    0x4(%eax),%eax
+  800648:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  80064b:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  800650:	eb 74                	jmp    8006c6 <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  800652:	83 f9 01             	cmp    $0x1,%ecx
+  800655:	7f 1b                	jg     800672 <vprintfmt+0x368>
+  else if (lflag)
+  800657:	85 c9                	test   %ecx,%ecx
+  800659:	74 2c                	je     800687 <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  80065b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80065e:	8b 10                	mov    (%eax),%edx
+  800660:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800665:	8d 40 04             	lea    0x4(%eax),%eax
+  800668:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  80066b:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  800670:	eb 54                	jmp    8006c6 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800672:	8b 45 14             	mov    0x14(%ebp),%eax
+  800675:	8b 10                	mov    (%eax),%edx
+  800677:	8b 48 04             	mov    0x4(%eax),%ecx
+  80067a:	8d 40 08             	lea    0x8(%eax),%eax
+  80067d:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800680:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  800685:	eb 3f                	jmp    8006c6 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800687:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068a:	8b 10                	mov    (%eax),%edx
+  80068c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800691:	8d 40 04             	lea    0x4(%eax),%eax
+  800694:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800697:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  80069c:	eb 28                	jmp    8006c6 <vprintfmt+0x3bc>
+      putch('0', putdat);
+  80069e:	83 ec 08             	sub    $0x8,%esp
+  8006a1:	53                   	push   %ebx
+  8006a2:	6a 30                	push   $0x30
+  8006a4:	ff d6                	call   *%esi
+      putch('x', putdat);
+  8006a6:	83 c4 08             	add    $0x8,%esp
+  8006a9:	53                   	push   %ebx
+  8006aa:	6a 78                	push   $0x78
+  8006ac:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  8006ae:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b1:	8b 10                	mov    (%eax),%edx
+  8006b3:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  8006b8:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  8006bb:	8d 40 04             	lea    0x4(%eax),%eax
+  8006be:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8006c1:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  8006c6:	83 ec 0c             	sub    $0xc,%esp
+  8006c9:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8006cd:	50                   	push   %eax
+  8006ce:	ff 75 e0             	push   -0x20(%ebp)
+  8006d1:	57                   	push   %edi
+  8006d2:	51                   	push   %ecx
+  8006d3:	52                   	push   %edx
+  8006d4:	89 da                	mov    %ebx,%edx
+  8006d6:	89 f0                	mov    %esi,%eax
+  8006d8:	e8 4a fb ff ff       	call   800227 <printnum>
+      break;
+  8006dd:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  8006e0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  8006e3:	e9 40 fc ff ff       	jmp    800328 <vprintfmt+0x1e>
+  if (lflag >= 2)
+  8006e8:	83 f9 01             	cmp    $0x1,%ecx
+  8006eb:	7f 1b                	jg     800708 <vprintfmt+0x3fe>
+  else if (lflag)
+  8006ed:	85 c9                	test   %ecx,%ecx
+  8006ef:	74 2c                	je     80071d <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  8006f1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f4:	8b 10                	mov    (%eax),%edx
+  8006f6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006fb:	8d 40 04             	lea    0x4(%eax),%eax
+  8006fe:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800701:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  800706:	eb be                	jmp    8006c6 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800708:	8b 45 14             	mov    0x14(%ebp),%eax
+  80070b:	8b 10                	mov    (%eax),%edx
+  80070d:	8b 48 04             	mov    0x4(%eax),%ecx
+  800710:	8d 40 08             	lea    0x8(%eax),%eax
+  800713:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800716:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  80071b:	eb a9                	jmp    8006c6 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  80071d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800720:	8b 10                	mov    (%eax),%edx
+  800722:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800727:	8d 40 04             	lea    0x4(%eax),%eax
+  80072a:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  80072d:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  800732:	eb 92                	jmp    8006c6 <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  800734:	83 ec 08             	sub    $0x8,%esp
+  800737:	53                   	push   %ebx
+  800738:	6a 25                	push   $0x25
+  80073a:	ff d6                	call   *%esi
+      break;
+  80073c:	83 c4 10             	add    $0x10,%esp
+  80073f:	eb 9f                	jmp    8006e0 <vprintfmt+0x3d6>
+      putch('%', putdat);
+  800741:	83 ec 08             	sub    $0x8,%esp
+  800744:	53                   	push   %ebx
+  800745:	6a 25                	push   $0x25
+  800747:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  800749:	83 c4 10             	add    $0x10,%esp
+  80074c:	89 f8                	mov    %edi,%eax
+  80074e:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800752:	74 05                	je     800759 <vprintfmt+0x44f>
+  800754:	83 e8 01             	sub    $0x1,%eax
+  800757:	eb f5                	jmp    80074e <vprintfmt+0x444>
+  800759:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80075c:	eb 82                	jmp    8006e0 <vprintfmt+0x3d6>
+
+0080075e <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80075e:	55                   	push   %ebp
+  80075f:	89 e5                	mov    %esp,%ebp
+  800761:	83 ec 18             	sub    $0x18,%esp
+  800764:	8b 45 08             	mov    0x8(%ebp),%eax
+  800767:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  80076a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80076d:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800771:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800774:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  80077b:	85 c0                	test   %eax,%eax
+  80077d:	74 26                	je     8007a5 <vsnprintf+0x47>
+  80077f:	85 d2                	test   %edx,%edx
+  800781:	7e 22                	jle    8007a5 <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800783:	ff 75 14             	push   0x14(%ebp)
+  800786:	ff 75 10             	push   0x10(%ebp)
+  800789:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80078c:	50                   	push   %eax
+  80078d:	68 d0 02 80 00       	push   $0x8002d0
+  800792:	e8 73 fb ff ff       	call   80030a <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800797:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80079a:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  80079d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8007a0:	83 c4 10             	add    $0x10,%esp
+}
+  8007a3:	c9                   	leave
+  8007a4:	c3                   	ret
+    return -E_INVAL;
+  8007a5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007aa:	eb f7                	jmp    8007a3 <vsnprintf+0x45>
+
+008007ac <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8007ac:	55                   	push   %ebp
+  8007ad:	89 e5                	mov    %esp,%ebp
+  8007af:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  8007b2:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  8007b5:	50                   	push   %eax
+  8007b6:	ff 75 10             	push   0x10(%ebp)
+  8007b9:	ff 75 0c             	push   0xc(%ebp)
+  8007bc:	ff 75 08             	push   0x8(%ebp)
+  8007bf:	e8 9a ff ff ff       	call   80075e <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  8007c4:	c9                   	leave
+  8007c5:	c3                   	ret
+
+008007c6 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8007c6:	55                   	push   %ebp
+  8007c7:	89 e5                	mov    %esp,%ebp
+  8007c9:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  8007cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007d1:	eb 03                	jmp    8007d6 <strlen+0x10>
+    n++;
+  8007d3:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  8007d6:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8007da:	75 f7                	jne    8007d3 <strlen+0xd>
+  return n;
+}
+  8007dc:	5d                   	pop    %ebp
+  8007dd:	c3                   	ret
+
+008007de <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8007de:	55                   	push   %ebp
+  8007df:	89 e5                	mov    %esp,%ebp
+  8007e1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007e4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007ec:	eb 03                	jmp    8007f1 <strnlen+0x13>
+    n++;
+  8007ee:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007f1:	39 d0                	cmp    %edx,%eax
+  8007f3:	74 08                	je     8007fd <strnlen+0x1f>
+  8007f5:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8007f9:	75 f3                	jne    8007ee <strnlen+0x10>
+  8007fb:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  8007fd:	89 d0                	mov    %edx,%eax
+  8007ff:	5d                   	pop    %ebp
+  800800:	c3                   	ret
+
+00800801 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800801:	55                   	push   %ebp
+  800802:	89 e5                	mov    %esp,%ebp
+  800804:	53                   	push   %ebx
+  800805:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800808:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  80080b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800810:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800814:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800817:	83 c0 01             	add    $0x1,%eax
+  80081a:	84 d2                	test   %dl,%dl
+  80081c:	75 f2                	jne    800810 <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  80081e:	89 c8                	mov    %ecx,%eax
+  800820:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800823:	c9                   	leave
+  800824:	c3                   	ret
+
+00800825 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800825:	55                   	push   %ebp
+  800826:	89 e5                	mov    %esp,%ebp
+  800828:	53                   	push   %ebx
+  800829:	83 ec 10             	sub    $0x10,%esp
+  80082c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  80082f:	53                   	push   %ebx
+  800830:	e8 91 ff ff ff       	call   8007c6 <strlen>
+  800835:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  800838:	ff 75 0c             	push   0xc(%ebp)
+  80083b:	01 d8                	add    %ebx,%eax
+  80083d:	50                   	push   %eax
+  80083e:	e8 be ff ff ff       	call   800801 <strcpy>
+  return dst;
+}
+  800843:	89 d8                	mov    %ebx,%eax
+  800845:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800848:	c9                   	leave
+  800849:	c3                   	ret
+
+0080084a <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  80084a:	55                   	push   %ebp
+  80084b:	89 e5                	mov    %esp,%ebp
+  80084d:	56                   	push   %esi
+  80084e:	53                   	push   %ebx
+  80084f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800852:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  800855:	89 f3                	mov    %esi,%ebx
+  800857:	03 5d 10             	add    0x10(%ebp),%ebx
+  80085a:	89 f0                	mov    %esi,%eax
+  80085c:	eb 0f                	jmp    80086d <strncpy+0x23>
+    *dst++ = *src;
+  80085e:	83 c0 01             	add    $0x1,%eax
+  800861:	0f b6 0a             	movzbl (%edx),%ecx
+  800864:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  800867:	80 f9 01             	cmp    $0x1,%cl
+  80086a:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  80086d:	39 d8                	cmp    %ebx,%eax
+  80086f:	75 ed                	jne    80085e <strncpy+0x14>
+  }
+  return ret;
+}
+  800871:	89 f0                	mov    %esi,%eax
+  800873:	5b                   	pop    %ebx
+  800874:	5e                   	pop    %esi
+  800875:	5d                   	pop    %ebp
+  800876:	c3                   	ret
+
+00800877 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800877:	55                   	push   %ebp
+  800878:	89 e5                	mov    %esp,%ebp
+  80087a:	56                   	push   %esi
+  80087b:	53                   	push   %ebx
+  80087c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80087f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800882:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  800885:	89 f0                	mov    %esi,%eax
+  800887:	85 d2                	test   %edx,%edx
+  800889:	74 21                	je     8008ac <strlcpy+0x35>
+  80088b:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80088f:	89 f2                	mov    %esi,%edx
+  800891:	eb 09                	jmp    80089c <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  800893:	83 c1 01             	add    $0x1,%ecx
+  800896:	83 c2 01             	add    $0x1,%edx
+  800899:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  80089c:	39 c2                	cmp    %eax,%edx
+  80089e:	74 09                	je     8008a9 <strlcpy+0x32>
+  8008a0:	0f b6 19             	movzbl (%ecx),%ebx
+  8008a3:	84 db                	test   %bl,%bl
+  8008a5:	75 ec                	jne    800893 <strlcpy+0x1c>
+  8008a7:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  8008a9:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  8008ac:	29 f0                	sub    %esi,%eax
+}
+  8008ae:	5b                   	pop    %ebx
+  8008af:	5e                   	pop    %esi
+  8008b0:	5d                   	pop    %ebp
+  8008b1:	c3                   	ret
+
+008008b2 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8008b2:	55                   	push   %ebp
+  8008b3:	89 e5                	mov    %esp,%ebp
+  8008b5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008b8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  8008bb:	eb 06                	jmp    8008c3 <strcmp+0x11>
+    p++, q++;
+  8008bd:	83 c1 01             	add    $0x1,%ecx
+  8008c0:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  8008c3:	0f b6 01             	movzbl (%ecx),%eax
+  8008c6:	84 c0                	test   %al,%al
+  8008c8:	74 04                	je     8008ce <strcmp+0x1c>
+  8008ca:	3a 02                	cmp    (%edx),%al
+  8008cc:	74 ef                	je     8008bd <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  8008ce:	0f b6 c0             	movzbl %al,%eax
+  8008d1:	0f b6 12             	movzbl (%edx),%edx
+  8008d4:	29 d0                	sub    %edx,%eax
+}
+  8008d6:	5d                   	pop    %ebp
+  8008d7:	c3                   	ret
+
+008008d8 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8008d8:	55                   	push   %ebp
+  8008d9:	89 e5                	mov    %esp,%ebp
+  8008db:	53                   	push   %ebx
+  8008dc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008df:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008e2:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  8008e5:	eb 09                	jmp    8008f0 <strncmp+0x18>
+    n--, p++, q++;
+  8008e7:	83 ea 01             	sub    $0x1,%edx
+  8008ea:	83 c0 01             	add    $0x1,%eax
+  8008ed:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  8008f0:	85 d2                	test   %edx,%edx
+  8008f2:	74 18                	je     80090c <strncmp+0x34>
+  8008f4:	0f b6 18             	movzbl (%eax),%ebx
+  8008f7:	84 db                	test   %bl,%bl
+  8008f9:	74 04                	je     8008ff <strncmp+0x27>
+  8008fb:	3a 19                	cmp    (%ecx),%bl
+  8008fd:	74 e8                	je     8008e7 <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8008ff:	0f b6 00             	movzbl (%eax),%eax
+  800902:	0f b6 11             	movzbl (%ecx),%edx
+  800905:	29 d0                	sub    %edx,%eax
+}
+  800907:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80090a:	c9                   	leave
+  80090b:	c3                   	ret
+    return 0;
+  80090c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800911:	eb f4                	jmp    800907 <strncmp+0x2f>
+
+00800913 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800913:	55                   	push   %ebp
+  800914:	89 e5                	mov    %esp,%ebp
+  800916:	8b 45 08             	mov    0x8(%ebp),%eax
+  800919:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  80091d:	eb 03                	jmp    800922 <strchr+0xf>
+  80091f:	83 c0 01             	add    $0x1,%eax
+  800922:	0f b6 10             	movzbl (%eax),%edx
+  800925:	84 d2                	test   %dl,%dl
+  800927:	74 06                	je     80092f <strchr+0x1c>
+    if (*s == c)
+  800929:	38 ca                	cmp    %cl,%dl
+  80092b:	75 f2                	jne    80091f <strchr+0xc>
+  80092d:	eb 05                	jmp    800934 <strchr+0x21>
+      return (char*)s;
+  return 0;
+  80092f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800934:	5d                   	pop    %ebp
+  800935:	c3                   	ret
+
+00800936 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800936:	55                   	push   %ebp
+  800937:	89 e5                	mov    %esp,%ebp
+  800939:	8b 45 08             	mov    0x8(%ebp),%eax
+  80093c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800940:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  800943:	38 ca                	cmp    %cl,%dl
+  800945:	74 09                	je     800950 <strfind+0x1a>
+  800947:	84 d2                	test   %dl,%dl
+  800949:	74 05                	je     800950 <strfind+0x1a>
+  for (; *s; s++)
+  80094b:	83 c0 01             	add    $0x1,%eax
+  80094e:	eb f0                	jmp    800940 <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  800950:	5d                   	pop    %ebp
+  800951:	c3                   	ret
+
+00800952 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800952:	55                   	push   %ebp
+  800953:	89 e5                	mov    %esp,%ebp
+  800955:	57                   	push   %edi
+  800956:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800959:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  80095c:	85 c9                	test   %ecx,%ecx
+  80095e:	74 20                	je     800980 <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  800960:	89 f8                	mov    %edi,%eax
+  800962:	09 c8                	or     %ecx,%eax
+  800964:	a8 03                	test   $0x3,%al
+  800966:	75 12                	jne    80097a <memset+0x28>
+    c &= 0xFF;
+  800968:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80096c:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  800972:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  800975:	fc                   	cld
+  800976:	f3 ab                	rep stos %eax,%es:(%edi)
+  800978:	eb 06                	jmp    800980 <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  80097a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80097d:	fc                   	cld
+  80097e:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  800980:	89 f8                	mov    %edi,%eax
+  800982:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800985:	c9                   	leave
+  800986:	c3                   	ret
+
+00800987 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800987:	55                   	push   %ebp
+  800988:	89 e5                	mov    %esp,%ebp
+  80098a:	57                   	push   %edi
+  80098b:	56                   	push   %esi
+  80098c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80098f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800992:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  800995:	39 c6                	cmp    %eax,%esi
+  800997:	73 32                	jae    8009cb <memmove+0x44>
+  800999:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80099c:	39 d0                	cmp    %edx,%eax
+  80099e:	73 2b                	jae    8009cb <memmove+0x44>
+    s += n;
+    d += n;
+  8009a0:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009a3:	89 d6                	mov    %edx,%esi
+  8009a5:	09 fe                	or     %edi,%esi
+  8009a7:	09 ce                	or     %ecx,%esi
+  8009a9:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8009af:	75 0e                	jne    8009bf <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8009b1:	83 ef 04             	sub    $0x4,%edi
+  8009b4:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8009b7:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  8009ba:	fd                   	std
+  8009bb:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009bd:	eb 09                	jmp    8009c8 <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8009bf:	83 ef 01             	sub    $0x1,%edi
+  8009c2:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  8009c5:	fd                   	std
+  8009c6:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  8009c8:	fc                   	cld
+  8009c9:	eb 1a                	jmp    8009e5 <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009cb:	89 f2                	mov    %esi,%edx
+  8009cd:	09 c2                	or     %eax,%edx
+  8009cf:	09 ca                	or     %ecx,%edx
+  8009d1:	f6 c2 03             	test   $0x3,%dl
+  8009d4:	75 0a                	jne    8009e0 <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8009d6:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  8009d9:	89 c7                	mov    %eax,%edi
+  8009db:	fc                   	cld
+  8009dc:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009de:	eb 05                	jmp    8009e5 <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  8009e0:	89 c7                	mov    %eax,%edi
+  8009e2:	fc                   	cld
+  8009e3:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  8009e5:	5e                   	pop    %esi
+  8009e6:	5f                   	pop    %edi
+  8009e7:	5d                   	pop    %ebp
+  8009e8:	c3                   	ret
+
+008009e9 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8009e9:	55                   	push   %ebp
+  8009ea:	89 e5                	mov    %esp,%ebp
+  8009ec:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  8009ef:	ff 75 10             	push   0x10(%ebp)
+  8009f2:	ff 75 0c             	push   0xc(%ebp)
+  8009f5:	ff 75 08             	push   0x8(%ebp)
+  8009f8:	e8 8a ff ff ff       	call   800987 <memmove>
+}
+  8009fd:	c9                   	leave
+  8009fe:	c3                   	ret
+
+008009ff <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8009ff:	55                   	push   %ebp
+  800a00:	89 e5                	mov    %esp,%ebp
+  800a02:	56                   	push   %esi
+  800a03:	53                   	push   %ebx
+  800a04:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a07:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  800a0a:	89 c6                	mov    %eax,%esi
+  800a0c:	03 75 10             	add    0x10(%ebp),%esi
+  800a0f:	eb 06                	jmp    800a17 <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  800a11:	83 c0 01             	add    $0x1,%eax
+  800a14:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  800a17:	39 f0                	cmp    %esi,%eax
+  800a19:	74 14                	je     800a2f <memcmp+0x30>
+    if (*s1 != *s2)
+  800a1b:	0f b6 08             	movzbl (%eax),%ecx
+  800a1e:	0f b6 1a             	movzbl (%edx),%ebx
+  800a21:	38 d9                	cmp    %bl,%cl
+  800a23:	74 ec                	je     800a11 <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  800a25:	0f b6 c1             	movzbl %cl,%eax
+  800a28:	0f b6 db             	movzbl %bl,%ebx
+  800a2b:	29 d8                	sub    %ebx,%eax
+  800a2d:	eb 05                	jmp    800a34 <memcmp+0x35>
+  }
+
+  return 0;
+  800a2f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a34:	5b                   	pop    %ebx
+  800a35:	5e                   	pop    %esi
+  800a36:	5d                   	pop    %ebp
+  800a37:	c3                   	ret
+
+00800a38 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a38:	55                   	push   %ebp
+  800a39:	89 e5                	mov    %esp,%ebp
+  800a3b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a3e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  800a41:	89 c2                	mov    %eax,%edx
+  800a43:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  800a46:	eb 03                	jmp    800a4b <memfind+0x13>
+  800a48:	83 c0 01             	add    $0x1,%eax
+  800a4b:	39 d0                	cmp    %edx,%eax
+  800a4d:	73 04                	jae    800a53 <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  800a4f:	38 08                	cmp    %cl,(%eax)
+  800a51:	75 f5                	jne    800a48 <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  800a53:	5d                   	pop    %ebp
+  800a54:	c3                   	ret
+
+00800a55 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a55:	55                   	push   %ebp
+  800a56:	89 e5                	mov    %esp,%ebp
+  800a58:	57                   	push   %edi
+  800a59:	56                   	push   %esi
+  800a5a:	53                   	push   %ebx
+  800a5b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a5e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  800a61:	eb 03                	jmp    800a66 <strtol+0x11>
+    s++;
+  800a63:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  800a66:	0f b6 02             	movzbl (%edx),%eax
+  800a69:	3c 20                	cmp    $0x20,%al
+  800a6b:	74 f6                	je     800a63 <strtol+0xe>
+  800a6d:	3c 09                	cmp    $0x9,%al
+  800a6f:	74 f2                	je     800a63 <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  800a71:	3c 2b                	cmp    $0x2b,%al
+  800a73:	74 2a                	je     800a9f <strtol+0x4a>
+  int neg = 0;
+  800a75:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  800a7a:	3c 2d                	cmp    $0x2d,%al
+  800a7c:	74 2b                	je     800aa9 <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a7e:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a84:	75 0f                	jne    800a95 <strtol+0x40>
+  800a86:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a89:	74 28                	je     800ab3 <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  800a8b:	85 db                	test   %ebx,%ebx
+  800a8d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a92:	0f 44 d8             	cmove  %eax,%ebx
+  800a95:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a9a:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a9d:	eb 46                	jmp    800ae5 <strtol+0x90>
+    s++;
+  800a9f:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  800aa2:	bf 00 00 00 00       	mov    $0x0,%edi
+  800aa7:	eb d5                	jmp    800a7e <strtol+0x29>
+    s++, neg = 1;
+  800aa9:	83 c2 01             	add    $0x1,%edx
+  800aac:	bf 01 00 00 00       	mov    $0x1,%edi
+  800ab1:	eb cb                	jmp    800a7e <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ab3:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800ab7:	74 0e                	je     800ac7 <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  800ab9:	85 db                	test   %ebx,%ebx
+  800abb:	75 d8                	jne    800a95 <strtol+0x40>
+    s++, base = 8;
+  800abd:	83 c2 01             	add    $0x1,%edx
+  800ac0:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800ac5:	eb ce                	jmp    800a95 <strtol+0x40>
+    s += 2, base = 16;
+  800ac7:	83 c2 02             	add    $0x2,%edx
+  800aca:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800acf:	eb c4                	jmp    800a95 <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  800ad1:	0f be c0             	movsbl %al,%eax
+  800ad4:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  800ad7:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800ada:	7d 3a                	jge    800b16 <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  800adc:	83 c2 01             	add    $0x1,%edx
+  800adf:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800ae3:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  800ae5:	0f b6 02             	movzbl (%edx),%eax
+  800ae8:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800aeb:	89 f3                	mov    %esi,%ebx
+  800aed:	80 fb 09             	cmp    $0x9,%bl
+  800af0:	76 df                	jbe    800ad1 <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  800af2:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800af5:	89 f3                	mov    %esi,%ebx
+  800af7:	80 fb 19             	cmp    $0x19,%bl
+  800afa:	77 08                	ja     800b04 <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  800afc:	0f be c0             	movsbl %al,%eax
+  800aff:	83 e8 57             	sub    $0x57,%eax
+  800b02:	eb d3                	jmp    800ad7 <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  800b04:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800b07:	89 f3                	mov    %esi,%ebx
+  800b09:	80 fb 19             	cmp    $0x19,%bl
+  800b0c:	77 08                	ja     800b16 <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  800b0e:	0f be c0             	movsbl %al,%eax
+  800b11:	83 e8 37             	sub    $0x37,%eax
+  800b14:	eb c1                	jmp    800ad7 <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  800b16:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b1a:	74 05                	je     800b21 <strtol+0xcc>
+    *endptr = (char*)s;
+  800b1c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b1f:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  800b21:	89 c8                	mov    %ecx,%eax
+  800b23:	f7 d8                	neg    %eax
+  800b25:	85 ff                	test   %edi,%edi
+  800b27:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b2a:	89 c8                	mov    %ecx,%eax
+  800b2c:	5b                   	pop    %ebx
+  800b2d:	5e                   	pop    %esi
+  800b2e:	5f                   	pop    %edi
+  800b2f:	5d                   	pop    %ebp
+  800b30:	c3                   	ret
+
+00800b31 <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800b31:	55                   	push   %ebp
+  800b32:	89 e5                	mov    %esp,%ebp
+  800b34:	57                   	push   %edi
+  800b35:	56                   	push   %esi
+  800b36:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800b37:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b3c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b3f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b42:	89 c3                	mov    %eax,%ebx
+  800b44:	89 c7                	mov    %eax,%edi
+  800b46:	89 c6                	mov    %eax,%esi
+  800b48:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800b4a:	5b                   	pop    %ebx
+  800b4b:	5e                   	pop    %esi
+  800b4c:	5f                   	pop    %edi
+  800b4d:	5d                   	pop    %ebp
+  800b4e:	c3                   	ret
+
+00800b4f <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800b4f:	55                   	push   %ebp
+  800b50:	89 e5                	mov    %esp,%ebp
+  800b52:	57                   	push   %edi
+  800b53:	56                   	push   %esi
+  800b54:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800b55:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b5a:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b5f:	89 d1                	mov    %edx,%ecx
+  800b61:	89 d3                	mov    %edx,%ebx
+  800b63:	89 d7                	mov    %edx,%edi
+  800b65:	89 d6                	mov    %edx,%esi
+  800b67:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800b69:	5b                   	pop    %ebx
+  800b6a:	5e                   	pop    %esi
+  800b6b:	5f                   	pop    %edi
+  800b6c:	5d                   	pop    %ebp
+  800b6d:	c3                   	ret
+
+00800b6e <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800b6e:	55                   	push   %ebp
+  800b6f:	89 e5                	mov    %esp,%ebp
+  800b71:	57                   	push   %edi
+  800b72:	56                   	push   %esi
+  800b73:	53                   	push   %ebx
+  800b74:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800b77:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b7c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b7f:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b84:	89 cb                	mov    %ecx,%ebx
+  800b86:	89 cf                	mov    %ecx,%edi
+  800b88:	89 ce                	mov    %ecx,%esi
+  800b8a:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800b8c:	85 c0                	test   %eax,%eax
+  800b8e:	7f 08                	jg     800b98 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800b90:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b93:	5b                   	pop    %ebx
+  800b94:	5e                   	pop    %esi
+  800b95:	5f                   	pop    %edi
+  800b96:	5d                   	pop    %ebp
+  800b97:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800b98:	83 ec 0c             	sub    $0xc,%esp
+  800b9b:	50                   	push   %eax
+  800b9c:	6a 03                	push   $0x3
+  800b9e:	68 e3 34 80 00       	push   $0x8034e3
+  800ba3:	6a 23                	push   $0x23
+  800ba5:	68 00 35 80 00       	push   $0x803500
+  800baa:	e8 a4 21 00 00       	call   802d53 <_panic>
+
+00800baf <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800baf:	55                   	push   %ebp
+  800bb0:	89 e5                	mov    %esp,%ebp
+  800bb2:	57                   	push   %edi
+  800bb3:	56                   	push   %esi
+  800bb4:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800bb5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bba:	b8 02 00 00 00       	mov    $0x2,%eax
+  800bbf:	89 d1                	mov    %edx,%ecx
+  800bc1:	89 d3                	mov    %edx,%ebx
+  800bc3:	89 d7                	mov    %edx,%edi
+  800bc5:	89 d6                	mov    %edx,%esi
+  800bc7:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800bc9:	5b                   	pop    %ebx
+  800bca:	5e                   	pop    %esi
+  800bcb:	5f                   	pop    %edi
+  800bcc:	5d                   	pop    %ebp
+  800bcd:	c3                   	ret
+
+00800bce <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800bce:	55                   	push   %ebp
+  800bcf:	89 e5                	mov    %esp,%ebp
+  800bd1:	57                   	push   %edi
+  800bd2:	56                   	push   %esi
+  800bd3:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800bd4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bd9:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800bde:	89 d1                	mov    %edx,%ecx
+  800be0:	89 d3                	mov    %edx,%ebx
+  800be2:	89 d7                	mov    %edx,%edi
+  800be4:	89 d6                	mov    %edx,%esi
+  800be6:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800be8:	5b                   	pop    %ebx
+  800be9:	5e                   	pop    %esi
+  800bea:	5f                   	pop    %edi
+  800beb:	5d                   	pop    %ebp
+  800bec:	c3                   	ret
+
+00800bed <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  800bed:	55                   	push   %ebp
+  800bee:	89 e5                	mov    %esp,%ebp
+  800bf0:	57                   	push   %edi
+  800bf1:	56                   	push   %esi
+  800bf2:	53                   	push   %ebx
+  800bf3:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  800bf6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  800bfa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800bff:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c02:	b8 14 00 00 00       	mov    $0x14,%eax
+  800c07:	89 df                	mov    %ebx,%edi
+  800c09:	89 de                	mov    %ebx,%esi
+  800c0b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c0d:	85 c0                	test   %eax,%eax
+  800c0f:	7f 08                	jg     800c19 <sys_env_set_cow+0x2c>
+}
+  800c11:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c14:	5b                   	pop    %ebx
+  800c15:	5e                   	pop    %esi
+  800c16:	5f                   	pop    %edi
+  800c17:	5d                   	pop    %ebp
+  800c18:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c19:	83 ec 0c             	sub    $0xc,%esp
+  800c1c:	50                   	push   %eax
+  800c1d:	6a 14                	push   $0x14
+  800c1f:	68 e3 34 80 00       	push   $0x8034e3
+  800c24:	6a 23                	push   $0x23
+  800c26:	68 00 35 80 00       	push   $0x803500
+  800c2b:	e8 23 21 00 00       	call   802d53 <_panic>
+
+00800c30 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800c30:	55                   	push   %ebp
+  800c31:	89 e5                	mov    %esp,%ebp
+  800c33:	57                   	push   %edi
+  800c34:	56                   	push   %esi
+  800c35:	53                   	push   %ebx
+  800c36:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800c39:	be 00 00 00 00       	mov    $0x0,%esi
+  800c3e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c41:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c44:	b8 04 00 00 00       	mov    $0x4,%eax
+  800c49:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c4c:	89 f7                	mov    %esi,%edi
+  800c4e:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c50:	85 c0                	test   %eax,%eax
+  800c52:	7f 08                	jg     800c5c <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  800c54:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c57:	5b                   	pop    %ebx
+  800c58:	5e                   	pop    %esi
+  800c59:	5f                   	pop    %edi
+  800c5a:	5d                   	pop    %ebp
+  800c5b:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c5c:	83 ec 0c             	sub    $0xc,%esp
+  800c5f:	50                   	push   %eax
+  800c60:	6a 04                	push   $0x4
+  800c62:	68 e3 34 80 00       	push   $0x8034e3
+  800c67:	6a 23                	push   $0x23
+  800c69:	68 00 35 80 00       	push   $0x803500
+  800c6e:	e8 e0 20 00 00       	call   802d53 <_panic>
+
+00800c73 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800c73:	55                   	push   %ebp
+  800c74:	89 e5                	mov    %esp,%ebp
+  800c76:	57                   	push   %edi
+  800c77:	56                   	push   %esi
+  800c78:	53                   	push   %ebx
+  800c79:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800c7c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c7f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c82:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c87:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c8a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c8d:	8b 75 18             	mov    0x18(%ebp),%esi
+  800c90:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c92:	85 c0                	test   %eax,%eax
+  800c94:	7f 08                	jg     800c9e <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  800c96:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c99:	5b                   	pop    %ebx
+  800c9a:	5e                   	pop    %esi
+  800c9b:	5f                   	pop    %edi
+  800c9c:	5d                   	pop    %ebp
+  800c9d:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c9e:	83 ec 0c             	sub    $0xc,%esp
+  800ca1:	50                   	push   %eax
+  800ca2:	6a 05                	push   $0x5
+  800ca4:	68 e3 34 80 00       	push   $0x8034e3
+  800ca9:	6a 23                	push   $0x23
+  800cab:	68 00 35 80 00       	push   $0x803500
+  800cb0:	e8 9e 20 00 00       	call   802d53 <_panic>
+
+00800cb5 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800cb5:	55                   	push   %ebp
+  800cb6:	89 e5                	mov    %esp,%ebp
+  800cb8:	57                   	push   %edi
+  800cb9:	56                   	push   %esi
+  800cba:	53                   	push   %ebx
+  800cbb:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800cbe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cc3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cc6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cc9:	b8 06 00 00 00       	mov    $0x6,%eax
+  800cce:	89 df                	mov    %ebx,%edi
+  800cd0:	89 de                	mov    %ebx,%esi
+  800cd2:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800cd4:	85 c0                	test   %eax,%eax
+  800cd6:	7f 08                	jg     800ce0 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  800cd8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cdb:	5b                   	pop    %ebx
+  800cdc:	5e                   	pop    %esi
+  800cdd:	5f                   	pop    %edi
+  800cde:	5d                   	pop    %ebp
+  800cdf:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ce0:	83 ec 0c             	sub    $0xc,%esp
+  800ce3:	50                   	push   %eax
+  800ce4:	6a 06                	push   $0x6
+  800ce6:	68 e3 34 80 00       	push   $0x8034e3
+  800ceb:	6a 23                	push   $0x23
+  800ced:	68 00 35 80 00       	push   $0x803500
+  800cf2:	e8 5c 20 00 00       	call   802d53 <_panic>
+
+00800cf7 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  800cf7:	55                   	push   %ebp
+  800cf8:	89 e5                	mov    %esp,%ebp
+  800cfa:	57                   	push   %edi
+  800cfb:	56                   	push   %esi
+  800cfc:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800cfd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d00:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d03:	b8 11 00 00 00       	mov    $0x11,%eax
+  800d08:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d0b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d0e:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d11:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  800d13:	5b                   	pop    %ebx
+  800d14:	5e                   	pop    %esi
+  800d15:	5f                   	pop    %edi
+  800d16:	5d                   	pop    %ebp
+  800d17:	c3                   	ret
+
+00800d18 <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  800d18:	55                   	push   %ebp
+  800d19:	89 e5                	mov    %esp,%ebp
+  800d1b:	57                   	push   %edi
+  800d1c:	56                   	push   %esi
+  800d1d:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d1e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d21:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d24:	b8 12 00 00 00       	mov    $0x12,%eax
+  800d29:	be 00 00 00 00       	mov    $0x0,%esi
+  800d2e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d31:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d34:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  800d36:	5b                   	pop    %ebx
+  800d37:	5e                   	pop    %esi
+  800d38:	5f                   	pop    %edi
+  800d39:	5d                   	pop    %ebp
+  800d3a:	c3                   	ret
+
+00800d3b <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  800d3b:	55                   	push   %ebp
+  800d3c:	89 e5                	mov    %esp,%ebp
+  800d3e:	57                   	push   %edi
+  800d3f:	56                   	push   %esi
+  800d40:	53                   	push   %ebx
+  800d41:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800d44:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d49:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d4c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d4f:	b8 16 00 00 00       	mov    $0x16,%eax
+  800d54:	89 df                	mov    %ebx,%edi
+  800d56:	89 de                	mov    %ebx,%esi
+  800d58:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d5a:	85 c0                	test   %eax,%eax
+  800d5c:	7f 08                	jg     800d66 <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  800d5e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d61:	5b                   	pop    %ebx
+  800d62:	5e                   	pop    %esi
+  800d63:	5f                   	pop    %edi
+  800d64:	5d                   	pop    %ebp
+  800d65:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d66:	83 ec 0c             	sub    $0xc,%esp
+  800d69:	50                   	push   %eax
+  800d6a:	6a 16                	push   $0x16
+  800d6c:	68 e3 34 80 00       	push   $0x8034e3
+  800d71:	6a 23                	push   $0x23
+  800d73:	68 00 35 80 00       	push   $0x803500
+  800d78:	e8 d6 1f 00 00       	call   802d53 <_panic>
+
+00800d7d <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  800d7d:	55                   	push   %ebp
+  800d7e:	89 e5                	mov    %esp,%ebp
+  800d80:	57                   	push   %edi
+  800d81:	56                   	push   %esi
+  800d82:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d83:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d88:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d8b:	b8 17 00 00 00       	mov    $0x17,%eax
+  800d90:	89 cb                	mov    %ecx,%ebx
+  800d92:	89 cf                	mov    %ecx,%edi
+  800d94:	89 ce                	mov    %ecx,%esi
+  800d96:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  800d98:	5b                   	pop    %ebx
+  800d99:	5e                   	pop    %esi
+  800d9a:	5f                   	pop    %edi
+  800d9b:	5d                   	pop    %ebp
+  800d9c:	c3                   	ret
+
+00800d9d <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  800d9d:	55                   	push   %ebp
+  800d9e:	89 e5                	mov    %esp,%ebp
+  800da0:	57                   	push   %edi
+  800da1:	56                   	push   %esi
+  800da2:	53                   	push   %ebx
+  800da3:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800da6:	be 00 00 00 00       	mov    $0x0,%esi
+  800dab:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800db1:	b8 18 00 00 00       	mov    $0x18,%eax
+  800db6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800db9:	89 f7                	mov    %esi,%edi
+  800dbb:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800dbd:	85 c0                	test   %eax,%eax
+  800dbf:	7f 08                	jg     800dc9 <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  800dc1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dc4:	5b                   	pop    %ebx
+  800dc5:	5e                   	pop    %esi
+  800dc6:	5f                   	pop    %edi
+  800dc7:	5d                   	pop    %ebp
+  800dc8:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800dc9:	83 ec 0c             	sub    $0xc,%esp
+  800dcc:	50                   	push   %eax
+  800dcd:	6a 18                	push   $0x18
+  800dcf:	68 e3 34 80 00       	push   $0x8034e3
+  800dd4:	6a 23                	push   $0x23
+  800dd6:	68 00 35 80 00       	push   $0x803500
+  800ddb:	e8 73 1f 00 00       	call   802d53 <_panic>
+
+00800de0 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  800de0:	55                   	push   %ebp
+  800de1:	89 e5                	mov    %esp,%ebp
+  800de3:	57                   	push   %edi
+  800de4:	56                   	push   %esi
+  800de5:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800de6:	be 00 00 00 00       	mov    $0x0,%esi
+  800deb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800df1:	b8 19 00 00 00       	mov    $0x19,%eax
+  800df6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800df9:	89 f7                	mov    %esi,%edi
+  800dfb:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  800dfd:	5b                   	pop    %ebx
+  800dfe:	5e                   	pop    %esi
+  800dff:	5f                   	pop    %edi
+  800e00:	5d                   	pop    %ebp
+  800e01:	c3                   	ret
+
+00800e02 <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  800e02:	55                   	push   %ebp
+  800e03:	89 e5                	mov    %esp,%ebp
+  800e05:	57                   	push   %edi
+  800e06:	56                   	push   %esi
+  800e07:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e08:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e0d:	b8 15 00 00 00       	mov    $0x15,%eax
+  800e12:	89 d1                	mov    %edx,%ecx
+  800e14:	89 d3                	mov    %edx,%ebx
+  800e16:	89 d7                	mov    %edx,%edi
+  800e18:	89 d6                	mov    %edx,%esi
+  800e1a:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800e1c:	5b                   	pop    %ebx
+  800e1d:	5e                   	pop    %esi
+  800e1e:	5f                   	pop    %edi
+  800e1f:	5d                   	pop    %ebp
+  800e20:	c3                   	ret
+
+00800e21 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800e21:	55                   	push   %ebp
+  800e22:	89 e5                	mov    %esp,%ebp
+  800e24:	57                   	push   %edi
+  800e25:	56                   	push   %esi
+  800e26:	53                   	push   %ebx
+  800e27:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e2a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e2f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e32:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e35:	b8 08 00 00 00       	mov    $0x8,%eax
+  800e3a:	89 df                	mov    %ebx,%edi
+  800e3c:	89 de                	mov    %ebx,%esi
+  800e3e:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e40:	85 c0                	test   %eax,%eax
+  800e42:	7f 08                	jg     800e4c <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800e44:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e47:	5b                   	pop    %ebx
+  800e48:	5e                   	pop    %esi
+  800e49:	5f                   	pop    %edi
+  800e4a:	5d                   	pop    %ebp
+  800e4b:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e4c:	83 ec 0c             	sub    $0xc,%esp
+  800e4f:	50                   	push   %eax
+  800e50:	6a 08                	push   $0x8
+  800e52:	68 e3 34 80 00       	push   $0x8034e3
+  800e57:	6a 23                	push   $0x23
+  800e59:	68 00 35 80 00       	push   $0x803500
+  800e5e:	e8 f0 1e 00 00       	call   802d53 <_panic>
+
+00800e63 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800e63:	55                   	push   %ebp
+  800e64:	89 e5                	mov    %esp,%ebp
+  800e66:	57                   	push   %edi
+  800e67:	56                   	push   %esi
+  800e68:	53                   	push   %ebx
+  800e69:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e6c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e71:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e74:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e77:	b8 09 00 00 00       	mov    $0x9,%eax
+  800e7c:	89 df                	mov    %ebx,%edi
+  800e7e:	89 de                	mov    %ebx,%esi
+  800e80:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e82:	85 c0                	test   %eax,%eax
+  800e84:	7f 08                	jg     800e8e <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  800e86:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e89:	5b                   	pop    %ebx
+  800e8a:	5e                   	pop    %esi
+  800e8b:	5f                   	pop    %edi
+  800e8c:	5d                   	pop    %ebp
+  800e8d:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e8e:	83 ec 0c             	sub    $0xc,%esp
+  800e91:	50                   	push   %eax
+  800e92:	6a 09                	push   $0x9
+  800e94:	68 e3 34 80 00       	push   $0x8034e3
+  800e99:	6a 23                	push   $0x23
+  800e9b:	68 00 35 80 00       	push   $0x803500
+  800ea0:	e8 ae 1e 00 00       	call   802d53 <_panic>
+
+00800ea5 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800ea5:	55                   	push   %ebp
+  800ea6:	89 e5                	mov    %esp,%ebp
+  800ea8:	57                   	push   %edi
+  800ea9:	56                   	push   %esi
+  800eaa:	53                   	push   %ebx
+  800eab:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800eae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eb3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eb9:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ebe:	89 df                	mov    %ebx,%edi
+  800ec0:	89 de                	mov    %ebx,%esi
+  800ec2:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ec4:	85 c0                	test   %eax,%eax
+  800ec6:	7f 08                	jg     800ed0 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  800ec8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ecb:	5b                   	pop    %ebx
+  800ecc:	5e                   	pop    %esi
+  800ecd:	5f                   	pop    %edi
+  800ece:	5d                   	pop    %ebp
+  800ecf:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ed0:	83 ec 0c             	sub    $0xc,%esp
+  800ed3:	50                   	push   %eax
+  800ed4:	6a 0a                	push   $0xa
+  800ed6:	68 e3 34 80 00       	push   $0x8034e3
+  800edb:	6a 23                	push   $0x23
+  800edd:	68 00 35 80 00       	push   $0x803500
+  800ee2:	e8 6c 1e 00 00       	call   802d53 <_panic>
+
+00800ee7 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  800ee7:	55                   	push   %ebp
+  800ee8:	89 e5                	mov    %esp,%ebp
+  800eea:	57                   	push   %edi
+  800eeb:	56                   	push   %esi
+  800eec:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800eed:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ef3:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800ef8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800efb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800efe:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f01:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  800f03:	5b                   	pop    %ebx
+  800f04:	5e                   	pop    %esi
+  800f05:	5f                   	pop    %edi
+  800f06:	5d                   	pop    %ebp
+  800f07:	c3                   	ret
+
+00800f08 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  800f08:	55                   	push   %ebp
+  800f09:	89 e5                	mov    %esp,%ebp
+  800f0b:	57                   	push   %edi
+  800f0c:	56                   	push   %esi
+  800f0d:	53                   	push   %ebx
+  800f0e:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f11:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f16:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f19:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f1c:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f21:	89 df                	mov    %ebx,%edi
+  800f23:	89 de                	mov    %ebx,%esi
+  800f25:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f27:	85 c0                	test   %eax,%eax
+  800f29:	7f 08                	jg     800f33 <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  800f2b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f2e:	5b                   	pop    %ebx
+  800f2f:	5e                   	pop    %esi
+  800f30:	5f                   	pop    %edi
+  800f31:	5d                   	pop    %ebp
+  800f32:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f33:	83 ec 0c             	sub    $0xc,%esp
+  800f36:	50                   	push   %eax
+  800f37:	6a 0d                	push   $0xd
+  800f39:	68 e3 34 80 00       	push   $0x8034e3
+  800f3e:	6a 23                	push   $0x23
+  800f40:	68 00 35 80 00       	push   $0x803500
+  800f45:	e8 09 1e 00 00       	call   802d53 <_panic>
+
+00800f4a <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  800f4a:	55                   	push   %ebp
+  800f4b:	89 e5                	mov    %esp,%ebp
+  800f4d:	57                   	push   %edi
+  800f4e:	56                   	push   %esi
+  800f4f:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f50:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f55:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800f5a:	89 d1                	mov    %edx,%ecx
+  800f5c:	89 d3                	mov    %edx,%ebx
+  800f5e:	89 d7                	mov    %edx,%edi
+  800f60:	89 d6                	mov    %edx,%esi
+  800f62:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800f64:	5b                   	pop    %ebx
+  800f65:	5e                   	pop    %esi
+  800f66:	5f                   	pop    %edi
+  800f67:	5d                   	pop    %ebp
+  800f68:	c3                   	ret
+
+00800f69 <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  800f69:	55                   	push   %ebp
+  800f6a:	89 e5                	mov    %esp,%ebp
+  800f6c:	57                   	push   %edi
+  800f6d:	56                   	push   %esi
+  800f6e:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f6f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f72:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f75:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f7a:	be 00 00 00 00       	mov    $0x0,%esi
+  800f7f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f82:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f85:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  800f87:	5b                   	pop    %ebx
+  800f88:	5e                   	pop    %esi
+  800f89:	5f                   	pop    %edi
+  800f8a:	5d                   	pop    %ebp
+  800f8b:	c3                   	ret
+
+00800f8c <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  800f8c:	55                   	push   %ebp
+  800f8d:	89 e5                	mov    %esp,%ebp
+  800f8f:	57                   	push   %edi
+  800f90:	56                   	push   %esi
+  800f91:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f92:	be 00 00 00 00       	mov    $0x0,%esi
+  800f97:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f9a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f9d:	b8 10 00 00 00       	mov    $0x10,%eax
+  800fa2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fa5:	89 f7                	mov    %esi,%edi
+  800fa7:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  800fa9:	5b                   	pop    %ebx
+  800faa:	5e                   	pop    %esi
+  800fab:	5f                   	pop    %edi
+  800fac:	5d                   	pop    %ebp
+  800fad:	c3                   	ret
+
+00800fae <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  800fae:	55                   	push   %ebp
+  800faf:	89 e5                	mov    %esp,%ebp
+  800fb1:	57                   	push   %edi
+  800fb2:	56                   	push   %esi
+  800fb3:	53                   	push   %ebx
+  800fb4:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  800fb7:	80 3d 48 57 80 00 00 	cmpb   $0x0,0x805748
+  800fbe:	74 41                	je     801001 <sys_batch+0x53>
+  800fc0:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fc3:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  800fc6:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  800fcd:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800fd0:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  800fd3:	7d 45                	jge    80101a <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  800fd5:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800fd8:	8b 06                	mov    (%esi),%eax
+  800fda:	8b 56 04             	mov    0x4(%esi),%edx
+  800fdd:	8b 4e 08             	mov    0x8(%esi),%ecx
+  800fe0:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  800fe3:	8b 7e 10             	mov    0x10(%esi),%edi
+  800fe6:	8b 76 14             	mov    0x14(%esi),%esi
+  800fe9:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  800feb:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800fee:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  800ff1:	83 c6 1c             	add    $0x1c,%esi
+  800ff4:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  800ff7:	85 c0                	test   %eax,%eax
+  800ff9:	78 1f                	js     80101a <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  800ffb:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  800fff:	eb cc                	jmp    800fcd <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  801001:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801006:	b8 13 00 00 00       	mov    $0x13,%eax
+  80100b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80100e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801011:	89 df                	mov    %ebx,%edi
+  801013:	89 de                	mov    %ebx,%esi
+  801015:	cd 30                	int    $0x30
+  801017:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  80101a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80101d:	83 c4 08             	add    $0x8,%esp
+  801020:	5b                   	pop    %ebx
+  801021:	5e                   	pop    %esi
+  801022:	5f                   	pop    %edi
+  801023:	5d                   	pop    %ebp
+  801024:	c3                   	ret
+
+00801025 <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  801025:	55                   	push   %ebp
+  801026:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  801028:	8b 45 08             	mov    0x8(%ebp),%eax
+  80102b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  801031:	5d                   	pop    %ebp
+  801032:	c3                   	ret
+
+00801033 <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  801033:	55                   	push   %ebp
+  801034:	89 e5                	mov    %esp,%ebp
+  801036:	56                   	push   %esi
+  801037:	53                   	push   %ebx
+  801038:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  80103b:	8b 1e                	mov    (%esi),%ebx
+  80103d:	85 db                	test   %ebx,%ebx
+  80103f:	75 09                	jne    80104a <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  801041:	89 d8                	mov    %ebx,%eax
+  801043:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801046:	5b                   	pop    %ebx
+  801047:	5e                   	pop    %esi
+  801048:	5d                   	pop    %ebp
+  801049:	c3                   	ret
+  b->sb_n = 0;
+  80104a:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  801050:	53                   	push   %ebx
+  801051:	8d 46 04             	lea    0x4(%esi),%eax
+  801054:	50                   	push   %eax
+  801055:	e8 54 ff ff ff       	call   800fae <sys_batch>
+  80105a:	83 c4 08             	add    $0x8,%esp
+  80105d:	85 c0                	test   %eax,%eax
+  80105f:	78 1e                	js     80107f <sysbatch_flush+0x4c>
+  if (r < n)
+  801061:	39 c3                	cmp    %eax,%ebx
+  801063:	7f 07                	jg     80106c <sysbatch_flush+0x39>
+  return 0;
+  801065:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80106a:	eb d5                	jmp    801041 <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  80106c:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80106f:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  801073:	85 db                	test   %ebx,%ebx
+  801075:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80107a:	0f 49 d8             	cmovns %eax,%ebx
+  80107d:	eb c2                	jmp    801041 <sysbatch_flush+0xe>
+    return r;
+  80107f:	89 c3                	mov    %eax,%ebx
+  801081:	eb be                	jmp    801041 <sysbatch_flush+0xe>
+
+00801083 <sysbatch_add>:
+{
+  801083:	55                   	push   %ebp
+  801084:	89 e5                	mov    %esp,%ebp
+  801086:	53                   	push   %ebx
+  801087:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  80108a:	83 3b 40             	cmpl   $0x40,(%ebx)
+  80108d:	74 41                	je     8010d0 <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  80108f:	8b 03                	mov    (%ebx),%eax
+  801091:	8d 50 01             	lea    0x1(%eax),%edx
+  801094:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  801096:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801099:	01 d8                	add    %ebx,%eax
+  80109b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80109e:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  8010a1:	8b 55 10             	mov    0x10(%ebp),%edx
+  8010a4:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  8010a7:	8b 55 14             	mov    0x14(%ebp),%edx
+  8010aa:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  8010ad:	8b 55 18             	mov    0x18(%ebp),%edx
+  8010b0:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  8010b3:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  8010b6:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  8010b9:	8b 55 20             	mov    0x20(%ebp),%edx
+  8010bc:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  8010bf:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  8010c6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8010cb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8010ce:	c9                   	leave
+  8010cf:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  8010d0:	53                   	push   %ebx
+  8010d1:	e8 5d ff ff ff       	call   801033 <sysbatch_flush>
+  8010d6:	83 c4 04             	add    $0x4,%esp
+  8010d9:	85 c0                	test   %eax,%eax
+  8010db:	79 b2                	jns    80108f <sysbatch_add+0xc>
+  8010dd:	eb ec                	jmp    8010cb <sysbatch_add+0x48>
+
+008010df <argstart>:
+#include <inc/args.h>
+#include <inc/string.h>
+
+void
+argstart(int *argc, char **argv, struct Argstate *args)
+{
+  8010df:	55                   	push   %ebp
+  8010e0:	89 e5                	mov    %esp,%ebp
+  8010e2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010e5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010e8:	8b 45 10             	mov    0x10(%ebp),%eax
+  args->argc = argc;
+  8010eb:	89 10                	mov    %edx,(%eax)
+  args->argv = (const char**)argv;
+  8010ed:	89 48 04             	mov    %ecx,0x4(%eax)
+  args->curarg = (*argc > 1 && argv ? "" : 0);
+  8010f0:	83 3a 01             	cmpl   $0x1,(%edx)
+  8010f3:	7e 09                	jle    8010fe <argstart+0x1f>
+  8010f5:	ba 91 31 80 00       	mov    $0x803191,%edx
+  8010fa:	85 c9                	test   %ecx,%ecx
+  8010fc:	75 05                	jne    801103 <argstart+0x24>
+  8010fe:	ba 00 00 00 00       	mov    $0x0,%edx
+  801103:	89 50 08             	mov    %edx,0x8(%eax)
+  args->argvalue = 0;
+  801106:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+}
+  80110d:	5d                   	pop    %ebp
+  80110e:	c3                   	ret
+
+0080110f <argnext>:
+
+int
+argnext(struct Argstate *args)
+{
+  80110f:	55                   	push   %ebp
+  801110:	89 e5                	mov    %esp,%ebp
+  801112:	53                   	push   %ebx
+  801113:	83 ec 04             	sub    $0x4,%esp
+  801116:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int arg;
+
+  args->argvalue = 0;
+  801119:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+
+  // Done processing arguments if args->curarg == 0
+  if (args->curarg == 0)
+  801120:	8b 43 08             	mov    0x8(%ebx),%eax
+  801123:	85 c0                	test   %eax,%eax
+  801125:	74 74                	je     80119b <argnext+0x8c>
+    return -1;
+
+  if (!*args->curarg) {
+  801127:	80 38 00             	cmpb   $0x0,(%eax)
+  80112a:	75 48                	jne    801174 <argnext+0x65>
+    // Need to process the next argument
+    // Check for end of argument list
+    if (*args->argc == 1
+  80112c:	8b 0b                	mov    (%ebx),%ecx
+  80112e:	83 39 01             	cmpl   $0x1,(%ecx)
+  801131:	74 5a                	je     80118d <argnext+0x7e>
+        || args->argv[1][0] != '-'
+  801133:	8b 53 04             	mov    0x4(%ebx),%edx
+  801136:	8b 42 04             	mov    0x4(%edx),%eax
+  801139:	80 38 2d             	cmpb   $0x2d,(%eax)
+  80113c:	75 4f                	jne    80118d <argnext+0x7e>
+        || args->argv[1][1] == '\0')
+  80113e:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  801142:	74 49                	je     80118d <argnext+0x7e>
+      goto endofargs;
+    // Shift arguments down one
+    args->curarg = args->argv[1] + 1;
+  801144:	83 c0 01             	add    $0x1,%eax
+  801147:	89 43 08             	mov    %eax,0x8(%ebx)
+    memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  80114a:	83 ec 04             	sub    $0x4,%esp
+  80114d:	8b 01                	mov    (%ecx),%eax
+  80114f:	8d 04 85 fc ff ff ff 	lea    -0x4(,%eax,4),%eax
+  801156:	50                   	push   %eax
+  801157:	8d 42 08             	lea    0x8(%edx),%eax
+  80115a:	50                   	push   %eax
+  80115b:	83 c2 04             	add    $0x4,%edx
+  80115e:	52                   	push   %edx
+  80115f:	e8 23 f8 ff ff       	call   800987 <memmove>
+    (*args->argc)--;
+  801164:	8b 03                	mov    (%ebx),%eax
+  801166:	83 28 01             	subl   $0x1,(%eax)
+    // Check for "--": end of argument list
+    if (args->curarg[0] == '-' && args->curarg[1] == '\0')
+  801169:	8b 43 08             	mov    0x8(%ebx),%eax
+  80116c:	83 c4 10             	add    $0x10,%esp
+  80116f:	80 38 2d             	cmpb   $0x2d,(%eax)
+  801172:	74 13                	je     801187 <argnext+0x78>
+      goto endofargs;
+  }
+
+  arg = (unsigned char)*args->curarg;
+  801174:	8b 43 08             	mov    0x8(%ebx),%eax
+  801177:	0f b6 10             	movzbl (%eax),%edx
+  args->curarg++;
+  80117a:	83 c0 01             	add    $0x1,%eax
+  80117d:	89 43 08             	mov    %eax,0x8(%ebx)
+  return arg;
+
+endofargs:
+  args->curarg = 0;
+  return -1;
+}
+  801180:	89 d0                	mov    %edx,%eax
+  801182:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801185:	c9                   	leave
+  801186:	c3                   	ret
+    if (args->curarg[0] == '-' && args->curarg[1] == '\0')
+  801187:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  80118b:	75 e7                	jne    801174 <argnext+0x65>
+  args->curarg = 0;
+  80118d:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  return -1;
+  801194:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  801199:	eb e5                	jmp    801180 <argnext+0x71>
+    return -1;
+  80119b:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8011a0:	eb de                	jmp    801180 <argnext+0x71>
+
+008011a2 <argnextvalue>:
+  return (char*)(args->argvalue ? args->argvalue : argnextvalue(args));
+}
+
+char *
+argnextvalue(struct Argstate *args)
+{
+  8011a2:	55                   	push   %ebp
+  8011a3:	89 e5                	mov    %esp,%ebp
+  8011a5:	53                   	push   %ebx
+  8011a6:	83 ec 04             	sub    $0x4,%esp
+  8011a9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (!args->curarg)
+  8011ac:	8b 43 08             	mov    0x8(%ebx),%eax
+  8011af:	85 c0                	test   %eax,%eax
+  8011b1:	74 12                	je     8011c5 <argnextvalue+0x23>
+    return 0;
+  if (*args->curarg) {
+  8011b3:	80 38 00             	cmpb   $0x0,(%eax)
+  8011b6:	74 12                	je     8011ca <argnextvalue+0x28>
+    args->argvalue = args->curarg;
+  8011b8:	89 43 0c             	mov    %eax,0xc(%ebx)
+    args->curarg = "";
+  8011bb:	c7 43 08 91 31 80 00 	movl   $0x803191,0x8(%ebx)
+    (*args->argc)--;
+  } else {
+    args->argvalue = 0;
+    args->curarg = 0;
+  }
+  return (char*)args->argvalue;
+  8011c2:	8b 43 0c             	mov    0xc(%ebx),%eax
+}
+  8011c5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8011c8:	c9                   	leave
+  8011c9:	c3                   	ret
+  } else if (*args->argc > 1) {
+  8011ca:	8b 13                	mov    (%ebx),%edx
+  8011cc:	83 3a 01             	cmpl   $0x1,(%edx)
+  8011cf:	7f 10                	jg     8011e1 <argnextvalue+0x3f>
+    args->argvalue = 0;
+  8011d1:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+    args->curarg = 0;
+  8011d8:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  8011df:	eb e1                	jmp    8011c2 <argnextvalue+0x20>
+    args->argvalue = args->argv[1];
+  8011e1:	8b 43 04             	mov    0x4(%ebx),%eax
+  8011e4:	8b 48 04             	mov    0x4(%eax),%ecx
+  8011e7:	89 4b 0c             	mov    %ecx,0xc(%ebx)
+    memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  8011ea:	83 ec 04             	sub    $0x4,%esp
+  8011ed:	8b 12                	mov    (%edx),%edx
+  8011ef:	8d 14 95 fc ff ff ff 	lea    -0x4(,%edx,4),%edx
+  8011f6:	52                   	push   %edx
+  8011f7:	8d 50 08             	lea    0x8(%eax),%edx
+  8011fa:	52                   	push   %edx
+  8011fb:	83 c0 04             	add    $0x4,%eax
+  8011fe:	50                   	push   %eax
+  8011ff:	e8 83 f7 ff ff       	call   800987 <memmove>
+    (*args->argc)--;
+  801204:	8b 03                	mov    (%ebx),%eax
+  801206:	83 28 01             	subl   $0x1,(%eax)
+  801209:	83 c4 10             	add    $0x10,%esp
+  80120c:	eb b4                	jmp    8011c2 <argnextvalue+0x20>
+
+0080120e <argvalue>:
+{
+  80120e:	55                   	push   %ebp
+  80120f:	89 e5                	mov    %esp,%ebp
+  801211:	83 ec 08             	sub    $0x8,%esp
+  801214:	8b 55 08             	mov    0x8(%ebp),%edx
+  return (char*)(args->argvalue ? args->argvalue : argnextvalue(args));
+  801217:	8b 42 0c             	mov    0xc(%edx),%eax
+  80121a:	85 c0                	test   %eax,%eax
+  80121c:	74 02                	je     801220 <argvalue+0x12>
+}
+  80121e:	c9                   	leave
+  80121f:	c3                   	ret
+  return (char*)(args->argvalue ? args->argvalue : argnextvalue(args));
+  801220:	83 ec 0c             	sub    $0xc,%esp
+  801223:	52                   	push   %edx
+  801224:	e8 79 ff ff ff       	call   8011a2 <argnextvalue>
+  801229:	83 c4 10             	add    $0x10,%esp
+  80122c:	eb f0                	jmp    80121e <argvalue+0x10>
+
+0080122e <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80122e:	55                   	push   %ebp
+  80122f:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801231:	8b 45 08             	mov    0x8(%ebp),%eax
+  801234:	05 00 00 00 30       	add    $0x30000000,%eax
+  801239:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80123c:	5d                   	pop    %ebp
+  80123d:	c3                   	ret
+
+0080123e <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80123e:	55                   	push   %ebp
+  80123f:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801241:	8b 45 08             	mov    0x8(%ebp),%eax
+  801244:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  801247:	66 b8 00 00          	mov    $0x0,%ax
+  80124b:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801250:	5d                   	pop    %ebp
+  801251:	c3                   	ret
+
+00801252 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801252:	55                   	push   %ebp
+  801253:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  801255:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80125a:	eb 02                	jmp    80125e <fd_alloc+0xc>
+  80125c:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80125e:	89 c2                	mov    %eax,%edx
+  801260:	c1 ea 16             	shr    $0x16,%edx
+  801263:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80126a:	f6 c2 01             	test   $0x1,%dl
+  80126d:	74 2b                	je     80129a <fd_alloc+0x48>
+  80126f:	89 c2                	mov    %eax,%edx
+  801271:	c1 ea 0c             	shr    $0xc,%edx
+  801274:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80127b:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801281:	f6 c1 01             	test   $0x1,%cl
+  801284:	74 14                	je     80129a <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  801286:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  80128c:	75 ce                	jne    80125c <fd_alloc+0xa>
+  80128e:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  801293:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801298:	eb 05                	jmp    80129f <fd_alloc+0x4d>
+      return 0;
+  80129a:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  80129f:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012a2:	89 02                	mov    %eax,(%edx)
+}
+  8012a4:	89 c8                	mov    %ecx,%eax
+  8012a6:	5d                   	pop    %ebp
+  8012a7:	c3                   	ret
+
+008012a8 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8012a8:	55                   	push   %ebp
+  8012a9:	89 e5                	mov    %esp,%ebp
+  8012ab:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  8012ae:	83 f8 1f             	cmp    $0x1f,%eax
+  8012b1:	77 30                	ja     8012e3 <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  8012b3:	c1 e0 0c             	shl    $0xc,%eax
+  8012b6:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8012bb:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8012c1:	f6 c2 01             	test   $0x1,%dl
+  8012c4:	74 24                	je     8012ea <fd_lookup+0x42>
+  8012c6:	89 c2                	mov    %eax,%edx
+  8012c8:	c1 ea 0c             	shr    $0xc,%edx
+  8012cb:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8012d2:	f6 c2 01             	test   $0x1,%dl
+  8012d5:	74 1a                	je     8012f1 <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  8012d7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8012da:	89 02                	mov    %eax,(%edx)
+  return 0;
+  8012dc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8012e1:	5d                   	pop    %ebp
+  8012e2:	c3                   	ret
+    return -E_INVAL;
+  8012e3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012e8:	eb f7                	jmp    8012e1 <fd_lookup+0x39>
+    return -E_INVAL;
+  8012ea:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012ef:	eb f0                	jmp    8012e1 <fd_lookup+0x39>
+  8012f1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012f6:	eb e9                	jmp    8012e1 <fd_lookup+0x39>
+
+008012f8 <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8012f8:	55                   	push   %ebp
+  8012f9:	89 e5                	mov    %esp,%ebp
+  8012fb:	53                   	push   %ebx
+  8012fc:	83 ec 04             	sub    $0x4,%esp
+  8012ff:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  801302:	b8 8c 35 80 00       	mov    $0x80358c,%eax
+  801307:	8b 18                	mov    (%eax),%ebx
+  801309:	85 db                	test   %ebx,%ebx
+  80130b:	74 0e                	je     80131b <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  80130d:	83 c0 04             	add    $0x4,%eax
+  801310:	39 13                	cmp    %edx,(%ebx)
+  801312:	75 f3                	jne    801307 <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  801314:	b8 00 00 00 00       	mov    $0x0,%eax
+  801319:	eb 1f                	jmp    80133a <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80131b:	a1 44 57 80 00       	mov    0x805744,%eax
+  801320:	8b 40 48             	mov    0x48(%eax),%eax
+  801323:	83 ec 04             	sub    $0x4,%esp
+  801326:	52                   	push   %edx
+  801327:	50                   	push   %eax
+  801328:	68 10 35 80 00       	push   $0x803510
+  80132d:	e8 e1 ee ff ff       	call   800213 <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  801332:	83 c4 10             	add    $0x10,%esp
+  801335:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  80133a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80133d:	89 1a                	mov    %ebx,(%edx)
+}
+  80133f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801342:	c9                   	leave
+  801343:	c3                   	ret
+
+00801344 <fd_close>:
+{
+  801344:	55                   	push   %ebp
+  801345:	89 e5                	mov    %esp,%ebp
+  801347:	57                   	push   %edi
+  801348:	56                   	push   %esi
+  801349:	53                   	push   %ebx
+  80134a:	83 ec 24             	sub    $0x24,%esp
+  80134d:	8b 75 08             	mov    0x8(%ebp),%esi
+  801350:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801353:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801356:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801357:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80135d:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801360:	50                   	push   %eax
+  801361:	e8 42 ff ff ff       	call   8012a8 <fd_lookup>
+  801366:	89 c3                	mov    %eax,%ebx
+  801368:	83 c4 10             	add    $0x10,%esp
+  80136b:	85 c0                	test   %eax,%eax
+  80136d:	78 05                	js     801374 <fd_close+0x30>
+      || fd != fd2)
+  80136f:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801372:	74 16                	je     80138a <fd_close+0x46>
+    return must_exist ? r : 0;
+  801374:	89 f8                	mov    %edi,%eax
+  801376:	84 c0                	test   %al,%al
+  801378:	b8 00 00 00 00       	mov    $0x0,%eax
+  80137d:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801380:	89 d8                	mov    %ebx,%eax
+  801382:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801385:	5b                   	pop    %ebx
+  801386:	5e                   	pop    %esi
+  801387:	5f                   	pop    %edi
+  801388:	5d                   	pop    %ebp
+  801389:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80138a:	83 ec 08             	sub    $0x8,%esp
+  80138d:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801390:	50                   	push   %eax
+  801391:	ff 36                	push   (%esi)
+  801393:	e8 60 ff ff ff       	call   8012f8 <dev_lookup>
+  801398:	89 c3                	mov    %eax,%ebx
+  80139a:	83 c4 10             	add    $0x10,%esp
+  80139d:	85 c0                	test   %eax,%eax
+  80139f:	78 1a                	js     8013bb <fd_close+0x77>
+    if (dev->dev_close)
+  8013a1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8013a4:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  8013a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  8013ac:	85 c0                	test   %eax,%eax
+  8013ae:	74 0b                	je     8013bb <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  8013b0:	83 ec 0c             	sub    $0xc,%esp
+  8013b3:	56                   	push   %esi
+  8013b4:	ff d0                	call   *%eax
+  8013b6:	89 c3                	mov    %eax,%ebx
+  8013b8:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  8013bb:	83 ec 08             	sub    $0x8,%esp
+  8013be:	56                   	push   %esi
+  8013bf:	6a 00                	push   $0x0
+  8013c1:	e8 ef f8 ff ff       	call   800cb5 <sys_page_unmap>
+  return r;
+  8013c6:	83 c4 10             	add    $0x10,%esp
+  8013c9:	eb b5                	jmp    801380 <fd_close+0x3c>
+
+008013cb <close>:
+
+int
+close(int fdnum)
+{
+  8013cb:	55                   	push   %ebp
+  8013cc:	89 e5                	mov    %esp,%ebp
+  8013ce:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8013d1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013d4:	50                   	push   %eax
+  8013d5:	ff 75 08             	push   0x8(%ebp)
+  8013d8:	e8 cb fe ff ff       	call   8012a8 <fd_lookup>
+  8013dd:	83 c4 10             	add    $0x10,%esp
+  8013e0:	85 c0                	test   %eax,%eax
+  8013e2:	79 02                	jns    8013e6 <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  8013e4:	c9                   	leave
+  8013e5:	c3                   	ret
+    return fd_close(fd, 1);
+  8013e6:	83 ec 08             	sub    $0x8,%esp
+  8013e9:	6a 01                	push   $0x1
+  8013eb:	ff 75 f4             	push   -0xc(%ebp)
+  8013ee:	e8 51 ff ff ff       	call   801344 <fd_close>
+  8013f3:	83 c4 10             	add    $0x10,%esp
+  8013f6:	eb ec                	jmp    8013e4 <close+0x19>
+
+008013f8 <close_all>:
+
+void
+close_all(void)
+{
+  8013f8:	55                   	push   %ebp
+  8013f9:	89 e5                	mov    %esp,%ebp
+  8013fb:	53                   	push   %ebx
+  8013fc:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  8013ff:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  801404:	83 ec 0c             	sub    $0xc,%esp
+  801407:	53                   	push   %ebx
+  801408:	e8 be ff ff ff       	call   8013cb <close>
+  for (i = 0; i < MAXFD; i++)
+  80140d:	83 c3 01             	add    $0x1,%ebx
+  801410:	83 c4 10             	add    $0x10,%esp
+  801413:	83 fb 20             	cmp    $0x20,%ebx
+  801416:	75 ec                	jne    801404 <close_all+0xc>
+}
+  801418:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80141b:	c9                   	leave
+  80141c:	c3                   	ret
+
+0080141d <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80141d:	55                   	push   %ebp
+  80141e:	89 e5                	mov    %esp,%ebp
+  801420:	57                   	push   %edi
+  801421:	56                   	push   %esi
+  801422:	53                   	push   %ebx
+  801423:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801426:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801429:	50                   	push   %eax
+  80142a:	ff 75 08             	push   0x8(%ebp)
+  80142d:	e8 76 fe ff ff       	call   8012a8 <fd_lookup>
+  801432:	89 c6                	mov    %eax,%esi
+  801434:	83 c4 10             	add    $0x10,%esp
+  801437:	85 c0                	test   %eax,%eax
+  801439:	0f 88 0a 01 00 00    	js     801549 <dup+0x12c>
+    return r;
+  close(newfdnum);
+  80143f:	83 ec 0c             	sub    $0xc,%esp
+  801442:	ff 75 0c             	push   0xc(%ebp)
+  801445:	e8 81 ff ff ff       	call   8013cb <close>
+
+  newfd = INDEX2FD(newfdnum);
+  80144a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80144d:	c1 e0 0c             	shl    $0xc,%eax
+  801450:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  801456:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  801459:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80145c:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  80145f:	89 04 24             	mov    %eax,(%esp)
+  801462:	e8 d7 fd ff ff       	call   80123e <fd2data>
+  801467:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  801469:	89 3c 24             	mov    %edi,(%esp)
+  80146c:	e8 cd fd ff ff       	call   80123e <fd2data>
+  801471:	83 c4 10             	add    $0x10,%esp
+  801474:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801477:	89 f3                	mov    %esi,%ebx
+  801479:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  80147f:	89 c6                	mov    %eax,%esi
+  801481:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801484:	89 cf                	mov    %ecx,%edi
+  801486:	eb 0c                	jmp    801494 <dup+0x77>
+  801488:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80148e:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801494:	39 fb                	cmp    %edi,%ebx
+  801496:	74 7b                	je     801513 <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  801498:	89 d8                	mov    %ebx,%eax
+  80149a:	c1 e8 16             	shr    $0x16,%eax
+  80149d:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8014a4:	a8 01                	test   $0x1,%al
+  8014a6:	74 e0                	je     801488 <dup+0x6b>
+  8014a8:	89 d8                	mov    %ebx,%eax
+  8014aa:	c1 e8 0c             	shr    $0xc,%eax
+  8014ad:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8014b4:	f6 c2 01             	test   $0x1,%dl
+  8014b7:	74 cf                	je     801488 <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  8014b9:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  8014c0:	83 ec 0c             	sub    $0xc,%esp
+  8014c3:	25 07 0e 00 00       	and    $0xe07,%eax
+  8014c8:	50                   	push   %eax
+  8014c9:	56                   	push   %esi
+  8014ca:	6a 00                	push   $0x0
+  8014cc:	53                   	push   %ebx
+  8014cd:	6a 00                	push   $0x0
+  8014cf:	e8 9f f7 ff ff       	call   800c73 <sys_page_map>
+  8014d4:	83 c4 20             	add    $0x20,%esp
+  8014d7:	85 c0                	test   %eax,%eax
+  8014d9:	79 ad                	jns    801488 <dup+0x6b>
+  8014db:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8014de:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  8014e0:	83 ec 08             	sub    $0x8,%esp
+  8014e3:	ff 75 d4             	push   -0x2c(%ebp)
+  8014e6:	6a 00                	push   $0x0
+  8014e8:	e8 c8 f7 ff ff       	call   800cb5 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8014ed:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  8014f0:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  8014f6:	83 c4 10             	add    $0x10,%esp
+  8014f9:	39 df                	cmp    %ebx,%edi
+  8014fb:	74 4c                	je     801549 <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  8014fd:	83 ec 08             	sub    $0x8,%esp
+  801500:	57                   	push   %edi
+  801501:	6a 00                	push   $0x0
+  801503:	e8 ad f7 ff ff       	call   800cb5 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801508:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  80150e:	83 c4 10             	add    $0x10,%esp
+  801511:	eb e6                	jmp    8014f9 <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801513:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801516:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  801519:	89 c8                	mov    %ecx,%eax
+  80151b:	c1 e8 0c             	shr    $0xc,%eax
+  80151e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801525:	83 ec 0c             	sub    $0xc,%esp
+  801528:	25 07 0e 00 00       	and    $0xe07,%eax
+  80152d:	50                   	push   %eax
+  80152e:	ff 75 d4             	push   -0x2c(%ebp)
+  801531:	6a 00                	push   $0x0
+  801533:	51                   	push   %ecx
+  801534:	6a 00                	push   $0x0
+  801536:	e8 38 f7 ff ff       	call   800c73 <sys_page_map>
+  80153b:	89 c6                	mov    %eax,%esi
+  80153d:	83 c4 20             	add    $0x20,%esp
+  801540:	85 c0                	test   %eax,%eax
+  801542:	78 9c                	js     8014e0 <dup+0xc3>
+  return newfdnum;
+  801544:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801547:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  801549:	89 f0                	mov    %esi,%eax
+  80154b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80154e:	5b                   	pop    %ebx
+  80154f:	5e                   	pop    %esi
+  801550:	5f                   	pop    %edi
+  801551:	5d                   	pop    %ebp
+  801552:	c3                   	ret
+
+00801553 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801553:	55                   	push   %ebp
+  801554:	89 e5                	mov    %esp,%ebp
+  801556:	56                   	push   %esi
+  801557:	53                   	push   %ebx
+  801558:	83 ec 18             	sub    $0x18,%esp
+  80155b:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  80155e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801561:	50                   	push   %eax
+  801562:	56                   	push   %esi
+  801563:	e8 40 fd ff ff       	call   8012a8 <fd_lookup>
+  801568:	83 c4 10             	add    $0x10,%esp
+  80156b:	85 c0                	test   %eax,%eax
+  80156d:	78 3c                	js     8015ab <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80156f:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801572:	83 ec 08             	sub    $0x8,%esp
+  801575:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801578:	50                   	push   %eax
+  801579:	ff 33                	push   (%ebx)
+  80157b:	e8 78 fd ff ff       	call   8012f8 <dev_lookup>
+  801580:	83 c4 10             	add    $0x10,%esp
+  801583:	85 c0                	test   %eax,%eax
+  801585:	78 24                	js     8015ab <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801587:	8b 43 08             	mov    0x8(%ebx),%eax
+  80158a:	83 e0 03             	and    $0x3,%eax
+  80158d:	83 f8 01             	cmp    $0x1,%eax
+  801590:	74 20                	je     8015b2 <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  801592:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801595:	8b 40 08             	mov    0x8(%eax),%eax
+  801598:	85 c0                	test   %eax,%eax
+  80159a:	74 37                	je     8015d3 <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  80159c:	83 ec 04             	sub    $0x4,%esp
+  80159f:	ff 75 10             	push   0x10(%ebp)
+  8015a2:	ff 75 0c             	push   0xc(%ebp)
+  8015a5:	53                   	push   %ebx
+  8015a6:	ff d0                	call   *%eax
+  8015a8:	83 c4 10             	add    $0x10,%esp
+}
+  8015ab:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015ae:	5b                   	pop    %ebx
+  8015af:	5e                   	pop    %esi
+  8015b0:	5d                   	pop    %ebp
+  8015b1:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8015b2:	a1 44 57 80 00       	mov    0x805744,%eax
+  8015b7:	8b 40 48             	mov    0x48(%eax),%eax
+  8015ba:	83 ec 04             	sub    $0x4,%esp
+  8015bd:	56                   	push   %esi
+  8015be:	50                   	push   %eax
+  8015bf:	68 51 35 80 00       	push   $0x803551
+  8015c4:	e8 4a ec ff ff       	call   800213 <cprintf>
+    return -E_INVAL;
+  8015c9:	83 c4 10             	add    $0x10,%esp
+  8015cc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015d1:	eb d8                	jmp    8015ab <read+0x58>
+    return -E_NOT_SUPP;
+  8015d3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015d8:	eb d1                	jmp    8015ab <read+0x58>
+
+008015da <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8015da:	55                   	push   %ebp
+  8015db:	89 e5                	mov    %esp,%ebp
+  8015dd:	57                   	push   %edi
+  8015de:	56                   	push   %esi
+  8015df:	53                   	push   %ebx
+  8015e0:	83 ec 0c             	sub    $0xc,%esp
+  8015e3:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8015e6:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  8015e9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015ee:	eb 02                	jmp    8015f2 <readn+0x18>
+  8015f0:	01 c3                	add    %eax,%ebx
+  8015f2:	39 f3                	cmp    %esi,%ebx
+  8015f4:	73 21                	jae    801617 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  8015f6:	83 ec 04             	sub    $0x4,%esp
+  8015f9:	89 f0                	mov    %esi,%eax
+  8015fb:	29 d8                	sub    %ebx,%eax
+  8015fd:	50                   	push   %eax
+  8015fe:	89 d8                	mov    %ebx,%eax
+  801600:	03 45 0c             	add    0xc(%ebp),%eax
+  801603:	50                   	push   %eax
+  801604:	57                   	push   %edi
+  801605:	e8 49 ff ff ff       	call   801553 <read>
+    if (m < 0)
+  80160a:	83 c4 10             	add    $0x10,%esp
+  80160d:	85 c0                	test   %eax,%eax
+  80160f:	78 04                	js     801615 <readn+0x3b>
+      return m;
+    if (m == 0)
+  801611:	75 dd                	jne    8015f0 <readn+0x16>
+  801613:	eb 02                	jmp    801617 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  801615:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  801617:	89 d8                	mov    %ebx,%eax
+  801619:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80161c:	5b                   	pop    %ebx
+  80161d:	5e                   	pop    %esi
+  80161e:	5f                   	pop    %edi
+  80161f:	5d                   	pop    %ebp
+  801620:	c3                   	ret
+
+00801621 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801621:	55                   	push   %ebp
+  801622:	89 e5                	mov    %esp,%ebp
+  801624:	56                   	push   %esi
+  801625:	53                   	push   %ebx
+  801626:	83 ec 18             	sub    $0x18,%esp
+  801629:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  80162c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80162f:	50                   	push   %eax
+  801630:	53                   	push   %ebx
+  801631:	e8 72 fc ff ff       	call   8012a8 <fd_lookup>
+  801636:	83 c4 10             	add    $0x10,%esp
+  801639:	85 c0                	test   %eax,%eax
+  80163b:	78 37                	js     801674 <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80163d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801640:	83 ec 08             	sub    $0x8,%esp
+  801643:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801646:	50                   	push   %eax
+  801647:	ff 36                	push   (%esi)
+  801649:	e8 aa fc ff ff       	call   8012f8 <dev_lookup>
+  80164e:	83 c4 10             	add    $0x10,%esp
+  801651:	85 c0                	test   %eax,%eax
+  801653:	78 1f                	js     801674 <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801655:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801659:	74 20                	je     80167b <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  80165b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80165e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801661:	85 c0                	test   %eax,%eax
+  801663:	74 37                	je     80169c <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  801665:	83 ec 04             	sub    $0x4,%esp
+  801668:	ff 75 10             	push   0x10(%ebp)
+  80166b:	ff 75 0c             	push   0xc(%ebp)
+  80166e:	56                   	push   %esi
+  80166f:	ff d0                	call   *%eax
+  801671:	83 c4 10             	add    $0x10,%esp
+}
+  801674:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801677:	5b                   	pop    %ebx
+  801678:	5e                   	pop    %esi
+  801679:	5d                   	pop    %ebp
+  80167a:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80167b:	a1 44 57 80 00       	mov    0x805744,%eax
+  801680:	8b 40 48             	mov    0x48(%eax),%eax
+  801683:	83 ec 04             	sub    $0x4,%esp
+  801686:	53                   	push   %ebx
+  801687:	50                   	push   %eax
+  801688:	68 6d 35 80 00       	push   $0x80356d
+  80168d:	e8 81 eb ff ff       	call   800213 <cprintf>
+    return -E_INVAL;
+  801692:	83 c4 10             	add    $0x10,%esp
+  801695:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80169a:	eb d8                	jmp    801674 <write+0x53>
+    return -E_NOT_SUPP;
+  80169c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016a1:	eb d1                	jmp    801674 <write+0x53>
+
+008016a3 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8016a3:	55                   	push   %ebp
+  8016a4:	89 e5                	mov    %esp,%ebp
+  8016a6:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8016a9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016ac:	50                   	push   %eax
+  8016ad:	ff 75 08             	push   0x8(%ebp)
+  8016b0:	e8 f3 fb ff ff       	call   8012a8 <fd_lookup>
+  8016b5:	83 c4 10             	add    $0x10,%esp
+  8016b8:	85 c0                	test   %eax,%eax
+  8016ba:	78 0e                	js     8016ca <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  8016bc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8016bf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016c2:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  8016c5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8016ca:	c9                   	leave
+  8016cb:	c3                   	ret
+
+008016cc <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8016cc:	55                   	push   %ebp
+  8016cd:	89 e5                	mov    %esp,%ebp
+  8016cf:	56                   	push   %esi
+  8016d0:	53                   	push   %ebx
+  8016d1:	83 ec 18             	sub    $0x18,%esp
+  8016d4:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016d7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016da:	50                   	push   %eax
+  8016db:	53                   	push   %ebx
+  8016dc:	e8 c7 fb ff ff       	call   8012a8 <fd_lookup>
+  8016e1:	83 c4 10             	add    $0x10,%esp
+  8016e4:	85 c0                	test   %eax,%eax
+  8016e6:	78 34                	js     80171c <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8016e8:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8016eb:	83 ec 08             	sub    $0x8,%esp
+  8016ee:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016f1:	50                   	push   %eax
+  8016f2:	ff 36                	push   (%esi)
+  8016f4:	e8 ff fb ff ff       	call   8012f8 <dev_lookup>
+  8016f9:	83 c4 10             	add    $0x10,%esp
+  8016fc:	85 c0                	test   %eax,%eax
+  8016fe:	78 1c                	js     80171c <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801700:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801704:	74 1d                	je     801723 <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  801706:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801709:	8b 40 18             	mov    0x18(%eax),%eax
+  80170c:	85 c0                	test   %eax,%eax
+  80170e:	74 34                	je     801744 <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  801710:	83 ec 08             	sub    $0x8,%esp
+  801713:	ff 75 0c             	push   0xc(%ebp)
+  801716:	56                   	push   %esi
+  801717:	ff d0                	call   *%eax
+  801719:	83 c4 10             	add    $0x10,%esp
+}
+  80171c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80171f:	5b                   	pop    %ebx
+  801720:	5e                   	pop    %esi
+  801721:	5d                   	pop    %ebp
+  801722:	c3                   	ret
+            thisenv->env_id, fdnum);
+  801723:	a1 44 57 80 00       	mov    0x805744,%eax
+  801728:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80172b:	83 ec 04             	sub    $0x4,%esp
+  80172e:	53                   	push   %ebx
+  80172f:	50                   	push   %eax
+  801730:	68 30 35 80 00       	push   $0x803530
+  801735:	e8 d9 ea ff ff       	call   800213 <cprintf>
+    return -E_INVAL;
+  80173a:	83 c4 10             	add    $0x10,%esp
+  80173d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801742:	eb d8                	jmp    80171c <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  801744:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801749:	eb d1                	jmp    80171c <ftruncate+0x50>
+
+0080174b <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80174b:	55                   	push   %ebp
+  80174c:	89 e5                	mov    %esp,%ebp
+  80174e:	56                   	push   %esi
+  80174f:	53                   	push   %ebx
+  801750:	83 ec 18             	sub    $0x18,%esp
+  801753:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801756:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801759:	50                   	push   %eax
+  80175a:	ff 75 08             	push   0x8(%ebp)
+  80175d:	e8 46 fb ff ff       	call   8012a8 <fd_lookup>
+  801762:	83 c4 10             	add    $0x10,%esp
+  801765:	85 c0                	test   %eax,%eax
+  801767:	78 49                	js     8017b2 <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801769:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80176c:	83 ec 08             	sub    $0x8,%esp
+  80176f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801772:	50                   	push   %eax
+  801773:	ff 36                	push   (%esi)
+  801775:	e8 7e fb ff ff       	call   8012f8 <dev_lookup>
+  80177a:	83 c4 10             	add    $0x10,%esp
+  80177d:	85 c0                	test   %eax,%eax
+  80177f:	78 31                	js     8017b2 <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  801781:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801784:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801788:	74 2f                	je     8017b9 <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  80178a:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  80178d:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801794:	00 00 00 
+  stat->st_isdir = 0;
+  801797:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80179e:	00 00 00 
+  stat->st_dev = dev;
+  8017a1:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  8017a7:	83 ec 08             	sub    $0x8,%esp
+  8017aa:	53                   	push   %ebx
+  8017ab:	56                   	push   %esi
+  8017ac:	ff 50 14             	call   *0x14(%eax)
+  8017af:	83 c4 10             	add    $0x10,%esp
+}
+  8017b2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017b5:	5b                   	pop    %ebx
+  8017b6:	5e                   	pop    %esi
+  8017b7:	5d                   	pop    %ebp
+  8017b8:	c3                   	ret
+    return -E_NOT_SUPP;
+  8017b9:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017be:	eb f2                	jmp    8017b2 <fstat+0x67>
+
+008017c0 <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  8017c0:	55                   	push   %ebp
+  8017c1:	89 e5                	mov    %esp,%ebp
+  8017c3:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  8017c6:	ff 75 0c             	push   0xc(%ebp)
+  8017c9:	ff 75 08             	push   0x8(%ebp)
+  8017cc:	e8 58 07 00 00       	call   801f29 <file_stat>
+}
+  8017d1:	c9                   	leave
+  8017d2:	c3                   	ret
+
+008017d3 <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  8017d3:	55                   	push   %ebp
+  8017d4:	89 e5                	mov    %esp,%ebp
+  8017d6:	57                   	push   %edi
+  8017d7:	56                   	push   %esi
+  8017d8:	53                   	push   %ebx
+  8017d9:	83 ec 1c             	sub    $0x1c,%esp
+  8017dc:	89 c7                	mov    %eax,%edi
+  8017de:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8017e1:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8017e4:	e9 a2 00 00 00       	jmp    80188b <fsipc_send+0xb8>
+  nfsenvs = 0;
+  8017e9:	c7 05 00 50 80 00 00 	movl   $0x0,0x805000
+  8017f0:	00 00 00 
+  8017f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017f8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  8017fd:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801802:	be 01 00 00 00       	mov    $0x1,%esi
+  801807:	eb 0f                	jmp    801818 <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801809:	83 c0 01             	add    $0x1,%eax
+  80180c:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801811:	74 49                	je     80185c <fsipc_send+0x89>
+  801813:	83 f9 07             	cmp    $0x7,%ecx
+  801816:	7f 50                	jg     801868 <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  801818:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  80181b:	c1 e2 04             	shl    $0x4,%edx
+  80181e:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801824:	8b 52 50             	mov    0x50(%edx),%edx
+  801827:	83 fa 01             	cmp    $0x1,%edx
+  80182a:	75 dd                	jne    801809 <fsipc_send+0x36>
+  80182c:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  80182f:	c1 e2 04             	shl    $0x4,%edx
+  801832:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801838:	8b 52 54             	mov    0x54(%edx),%edx
+  80183b:	85 d2                	test   %edx,%edx
+  80183d:	74 ca                	je     801809 <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  80183f:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801842:	c1 e2 04             	shl    $0x4,%edx
+  801845:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80184b:	8b 52 48             	mov    0x48(%edx),%edx
+  80184e:	89 14 8d 20 50 80 00 	mov    %edx,0x805020(,%ecx,4)
+  801855:	8d 49 01             	lea    0x1(%ecx),%ecx
+  801858:	89 f3                	mov    %esi,%ebx
+  80185a:	eb ad                	jmp    801809 <fsipc_send+0x36>
+  80185c:	84 db                	test   %bl,%bl
+  80185e:	74 38                	je     801898 <fsipc_send+0xc5>
+  801860:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  801866:	eb 30                	jmp    801898 <fsipc_send+0xc5>
+  801868:	84 db                	test   %bl,%bl
+  80186a:	74 2c                	je     801898 <fsipc_send+0xc5>
+  80186c:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  801872:	eb 24                	jmp    801898 <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  801874:	50                   	push   %eax
+  801875:	68 9c 35 80 00       	push   $0x80359c
+  80187a:	6a 34                	push   $0x34
+  80187c:	68 a6 35 80 00       	push   $0x8035a6
+  801881:	e8 cd 14 00 00       	call   802d53 <_panic>
+    }
+    sys_yield();
+  801886:	e8 43 f3 ff ff       	call   800bce <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  80188b:	83 3d 00 50 80 00 03 	cmpl   $0x3,0x805000
+  801892:	0f 8e 51 ff ff ff    	jle    8017e9 <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  801898:	a1 44 57 80 00       	mov    0x805744,%eax
+  80189d:	8b 70 48             	mov    0x48(%eax),%esi
+  8018a0:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  8018a6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018ab:	8b 0d 00 50 80 00    	mov    0x805000,%ecx
+  8018b1:	39 d9                	cmp    %ebx,%ecx
+  8018b3:	7e d1                	jle    801886 <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  8018b5:	83 ec 0c             	sub    $0xc,%esp
+  8018b8:	ff 75 e0             	push   -0x20(%ebp)
+  8018bb:	6a 07                	push   $0x7
+  8018bd:	ff 75 e4             	push   -0x1c(%ebp)
+  8018c0:	57                   	push   %edi
+  8018c1:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  8018c4:	99                   	cltd
+  8018c5:	f7 f9                	idiv   %ecx
+  8018c7:	ff 34 95 20 50 80 00 	push   0x805020(,%edx,4)
+  8018ce:	e8 14 f6 ff ff       	call   800ee7 <sys_ipc_try_send>
+      if (r == 0)
+  8018d3:	83 c4 20             	add    $0x20,%esp
+  8018d6:	85 c0                	test   %eax,%eax
+  8018d8:	74 0a                	je     8018e4 <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  8018da:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8018dd:	75 95                	jne    801874 <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  8018df:	83 c3 01             	add    $0x1,%ebx
+  8018e2:	eb c7                	jmp    8018ab <fsipc_send+0xd8>
+  }
+}
+  8018e4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018e7:	5b                   	pop    %ebx
+  8018e8:	5e                   	pop    %esi
+  8018e9:	5f                   	pop    %edi
+  8018ea:	5d                   	pop    %ebp
+  8018eb:	c3                   	ret
+
+008018ec <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8018ec:	55                   	push   %ebp
+  8018ed:	89 e5                	mov    %esp,%ebp
+  8018ef:	53                   	push   %ebx
+  8018f0:	83 ec 14             	sub    $0x14,%esp
+  8018f3:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  8018f5:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  8018fc:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801901:	ba 00 60 80 00       	mov    $0x806000,%edx
+  801906:	e8 c8 fe ff ff       	call   8017d3 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  80190b:	6a 00                	push   $0x0
+  80190d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801910:	50                   	push   %eax
+  801911:	53                   	push   %ebx
+  801912:	6a 00                	push   $0x0
+  801914:	e8 80 14 00 00       	call   802d99 <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  801919:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80191c:	c9                   	leave
+  80191d:	c3                   	ret
+
+0080191e <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  80191e:	55                   	push   %ebp
+  80191f:	89 e5                	mov    %esp,%ebp
+  801921:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801924:	8b 45 08             	mov    0x8(%ebp),%eax
+  801927:	8b 40 0c             	mov    0xc(%eax),%eax
+  80192a:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.set_size.req_size = newsize;
+  80192f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801932:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801937:	ba 00 00 00 00       	mov    $0x0,%edx
+  80193c:	b8 02 00 00 00       	mov    $0x2,%eax
+  801941:	e8 a6 ff ff ff       	call   8018ec <fsipc>
+}
+  801946:	c9                   	leave
+  801947:	c3                   	ret
+
+00801948 <devfile_flush>:
+{
+  801948:	55                   	push   %ebp
+  801949:	89 e5                	mov    %esp,%ebp
+  80194b:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80194e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801951:	8b 40 0c             	mov    0xc(%eax),%eax
+  801954:	a3 00 60 80 00       	mov    %eax,0x806000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801959:	ba 00 00 00 00       	mov    $0x0,%edx
+  80195e:	b8 06 00 00 00       	mov    $0x6,%eax
+  801963:	e8 84 ff ff ff       	call   8018ec <fsipc>
+}
+  801968:	c9                   	leave
+  801969:	c3                   	ret
+
+0080196a <devfile_stat>:
+{
+  80196a:	55                   	push   %ebp
+  80196b:	89 e5                	mov    %esp,%ebp
+  80196d:	53                   	push   %ebx
+  80196e:	83 ec 04             	sub    $0x4,%esp
+  801971:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801974:	8b 45 08             	mov    0x8(%ebp),%eax
+  801977:	8b 40 0c             	mov    0xc(%eax),%eax
+  80197a:	a3 00 60 80 00       	mov    %eax,0x806000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  80197f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801984:	b8 05 00 00 00       	mov    $0x5,%eax
+  801989:	e8 5e ff ff ff       	call   8018ec <fsipc>
+  80198e:	85 c0                	test   %eax,%eax
+  801990:	78 2c                	js     8019be <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801992:	83 ec 08             	sub    $0x8,%esp
+  801995:	68 00 60 80 00       	push   $0x806000
+  80199a:	53                   	push   %ebx
+  80199b:	e8 61 ee ff ff       	call   800801 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  8019a0:	a1 80 60 80 00       	mov    0x806080,%eax
+  8019a5:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8019ab:	a1 84 60 80 00       	mov    0x806084,%eax
+  8019b0:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  8019b6:	83 c4 10             	add    $0x10,%esp
+  8019b9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019c1:	c9                   	leave
+  8019c2:	c3                   	ret
+
+008019c3 <fsv_alloc>:
+{
+  8019c3:	55                   	push   %ebp
+  8019c4:	89 e5                	mov    %esp,%ebp
+  8019c6:	56                   	push   %esi
+  8019c7:	53                   	push   %ebx
+  8019c8:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  8019ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019cf:	eb 22                	jmp    8019f3 <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  8019d1:	83 ec 04             	sub    $0x4,%esp
+  8019d4:	6a 00                	push   $0x0
+  8019d6:	6a 00                	push   $0x0
+  8019d8:	6a 07                	push   $0x7
+  8019da:	50                   	push   %eax
+  8019db:	6a 00                	push   $0x0
+  8019dd:	6a 04                	push   $0x4
+  8019df:	68 40 50 80 00       	push   $0x805040
+  8019e4:	e8 9a f6 ff ff       	call   801083 <sysbatch_add>
+  8019e9:	83 c4 20             	add    $0x20,%esp
+  8019ec:	85 c0                	test   %eax,%eax
+  8019ee:	78 48                	js     801a38 <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  8019f0:	83 c3 01             	add    $0x1,%ebx
+  8019f3:	39 f3                	cmp    %esi,%ebx
+  8019f5:	74 31                	je     801a28 <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  8019f7:	89 d8                	mov    %ebx,%eax
+  8019f9:	c1 e0 0c             	shl    $0xc,%eax
+  8019fc:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801a01:	89 c2                	mov    %eax,%edx
+  801a03:	c1 ea 16             	shr    $0x16,%edx
+  801a06:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801a0d:	f6 c2 01             	test   $0x1,%dl
+  801a10:	74 bf                	je     8019d1 <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  801a12:	89 c2                	mov    %eax,%edx
+  801a14:	c1 ea 0c             	shr    $0xc,%edx
+  801a17:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801a1e:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801a21:	83 fa 03             	cmp    $0x3,%edx
+  801a24:	75 ab                	jne    8019d1 <fsv_alloc+0xe>
+  801a26:	eb c8                	jmp    8019f0 <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  801a28:	83 ec 0c             	sub    $0xc,%esp
+  801a2b:	68 40 50 80 00       	push   $0x805040
+  801a30:	e8 fe f5 ff ff       	call   801033 <sysbatch_flush>
+  801a35:	83 c4 10             	add    $0x10,%esp
+}
+  801a38:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a3b:	5b                   	pop    %ebx
+  801a3c:	5e                   	pop    %esi
+  801a3d:	5d                   	pop    %ebp
+  801a3e:	c3                   	ret
+
+00801a3f <devfile_read>:
+{
+  801a3f:	55                   	push   %ebp
+  801a40:	89 e5                	mov    %esp,%ebp
+  801a42:	57                   	push   %edi
+  801a43:	56                   	push   %esi
+  801a44:	53                   	push   %ebx
+  801a45:	83 ec 3c             	sub    $0x3c,%esp
+  801a48:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  801a4b:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  801a51:	77 57                	ja     801aaa <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801a53:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a56:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a59:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read.req_n = n;
+  801a5e:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801a64:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a69:	b8 03 00 00 00       	mov    $0x3,%eax
+  801a6e:	e8 79 fe ff ff       	call   8018ec <fsipc>
+  801a73:	89 c6                	mov    %eax,%esi
+  801a75:	85 c0                	test   %eax,%eax
+  801a77:	78 27                	js     801aa0 <devfile_read+0x61>
+  assert(r <= n);
+  801a79:	39 c3                	cmp    %eax,%ebx
+  801a7b:	0f 82 0e 02 00 00    	jb     801c8f <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  801a81:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801a86:	0f 8f 1c 02 00 00    	jg     801ca8 <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801a8c:	83 ec 04             	sub    $0x4,%esp
+  801a8f:	50                   	push   %eax
+  801a90:	68 00 60 80 00       	push   $0x806000
+  801a95:	ff 75 0c             	push   0xc(%ebp)
+  801a98:	e8 ea ee ff ff       	call   800987 <memmove>
+  return r;
+  801a9d:	83 c4 10             	add    $0x10,%esp
+}
+  801aa0:	89 f0                	mov    %esi,%eax
+  801aa2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801aa5:	5b                   	pop    %ebx
+  801aa6:	5e                   	pop    %esi
+  801aa7:	5f                   	pop    %edi
+  801aa8:	5d                   	pop    %ebp
+  801aa9:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  801aaa:	b8 01 00 00 00       	mov    $0x1,%eax
+  801aaf:	e8 0f ff ff ff       	call   8019c3 <fsv_alloc>
+  801ab4:	89 c6                	mov    %eax,%esi
+  801ab6:	85 c0                	test   %eax,%eax
+  801ab8:	78 e6                	js     801aa0 <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  801aba:	8b 45 08             	mov    0x8(%ebp),%eax
+  801abd:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ac0:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  801ac5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ac8:	8b 40 04             	mov    0x4(%eax),%eax
+  801acb:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  801ad0:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  801ad6:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801add:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801ae2:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801ae7:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801aec:	e8 e2 fc ff ff       	call   8017d3 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801af1:	6a 00                	push   $0x0
+  801af3:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801af6:	50                   	push   %eax
+  801af7:	68 00 10 c0 9f       	push   $0x9fc01000
+  801afc:	6a 00                	push   $0x0
+  801afe:	e8 96 12 00 00       	call   802d99 <ipc_recv_pages>
+  801b03:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  801b05:	83 c4 10             	add    $0x10,%esp
+  801b08:	85 c0                	test   %eax,%eax
+  801b0a:	7e 94                	jle    801aa0 <devfile_read+0x61>
+  assert(r <= n);
+  801b0c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801b0f:	39 c3                	cmp    %eax,%ebx
+  801b11:	72 2e                	jb     801b41 <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801b13:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b16:	8b 40 04             	mov    0x4(%eax),%eax
+  801b19:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801b1e:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  801b21:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801b24:	c1 e2 0c             	shl    $0xc,%edx
+  801b27:	39 ca                	cmp    %ecx,%edx
+  801b29:	72 2f                	jb     801b5a <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  801b2b:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  801b30:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  801b33:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  801b37:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801b3c:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  801b3f:	eb 52                	jmp    801b93 <devfile_read+0x154>
+  assert(r <= n);
+  801b41:	68 b1 35 80 00       	push   $0x8035b1
+  801b46:	68 b8 35 80 00       	push   $0x8035b8
+  801b4b:	68 49 01 00 00       	push   $0x149
+  801b50:	68 a6 35 80 00       	push   $0x8035a6
+  801b55:	e8 f9 11 00 00       	call   802d53 <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801b5a:	68 dc 35 80 00       	push   $0x8035dc
+  801b5f:	68 b8 35 80 00       	push   $0x8035b8
+  801b64:	68 4a 01 00 00       	push   $0x14a
+  801b69:	68 a6 35 80 00       	push   $0x8035a6
+  801b6e:	e8 e0 11 00 00       	call   802d53 <_panic>
+      memmove(dst + done, src + done, m);
+  801b73:	83 ec 04             	sub    $0x4,%esp
+  801b76:	53                   	push   %ebx
+  801b77:	56                   	push   %esi
+  801b78:	89 f8                	mov    %edi,%eax
+  801b7a:	03 45 0c             	add    0xc(%ebp),%eax
+  801b7d:	50                   	push   %eax
+  801b7e:	e8 04 ee ff ff       	call   800987 <memmove>
+  801b83:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  801b86:	01 df                	add    %ebx,%edi
+  801b88:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801b8b:	39 c7                	cmp    %eax,%edi
+  801b8d:	0f 83 c0 00 00 00    	jae    801c53 <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801b93:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801b96:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  801b99:	89 f0                	mov    %esi,%eax
+  801b9b:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801ba0:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  801ba5:	29 c3                	sub    %eax,%ebx
+  801ba7:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801baa:	29 f8                	sub    %edi,%eax
+  801bac:	39 c3                	cmp    %eax,%ebx
+  801bae:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  801bb1:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801bb7:	75 ba                	jne    801b73 <devfile_read+0x134>
+  801bb9:	89 f9                	mov    %edi,%ecx
+  801bbb:	03 4d 0c             	add    0xc(%ebp),%ecx
+  801bbe:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  801bc1:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  801bc7:	75 aa                	jne    801b73 <devfile_read+0x134>
+  801bc9:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  801bcf:	77 a2                	ja     801b73 <devfile_read+0x134>
+  801bd1:	89 c8                	mov    %ecx,%eax
+  801bd3:	c1 e8 16             	shr    $0x16,%eax
+  801bd6:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801bdd:	a8 01                	test   $0x1,%al
+  801bdf:	74 92                	je     801b73 <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  801be1:	89 c8                	mov    %ecx,%eax
+  801be3:	c1 e8 0c             	shr    $0xc,%eax
+  801be6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  801bed:	a8 01                	test   $0x1,%al
+  801bef:	74 82                	je     801b73 <devfile_read+0x134>
+  801bf1:	a9 02 08 00 00       	test   $0x802,%eax
+  801bf6:	0f 84 77 ff ff ff    	je     801b73 <devfile_read+0x134>
+  801bfc:	f6 c4 04             	test   $0x4,%ah
+  801bff:	0f 85 6e ff ff ff    	jne    801b73 <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  801c05:	a1 44 57 80 00       	mov    0x805744,%eax
+  801c0a:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  801c0e:	84 c0                	test   %al,%al
+  801c10:	75 17                	jne    801c29 <devfile_read+0x1ea>
+  801c12:	83 ec 08             	sub    $0x8,%esp
+  801c15:	6a 01                	push   $0x1
+  801c17:	6a 00                	push   $0x0
+  801c19:	e8 cf ef ff ff       	call   800bed <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  801c1e:	83 c4 10             	add    $0x10,%esp
+  801c21:	85 c0                	test   %eax,%eax
+  801c23:	0f 85 4a ff ff ff    	jne    801b73 <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  801c29:	83 ec 04             	sub    $0x4,%esp
+  801c2c:	68 05 08 00 00       	push   $0x805
+  801c31:	ff 75 cc             	push   -0x34(%ebp)
+  801c34:	6a 00                	push   $0x0
+  801c36:	56                   	push   %esi
+  801c37:	6a 00                	push   $0x0
+  801c39:	6a 05                	push   $0x5
+  801c3b:	68 40 50 80 00       	push   $0x805040
+  801c40:	e8 3e f4 ff ff       	call   801083 <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  801c45:	c1 e8 1f             	shr    $0x1f,%eax
+  801c48:	08 45 cb             	or     %al,-0x35(%ebp)
+  801c4b:	83 c4 20             	add    $0x20,%esp
+  801c4e:	e9 33 ff ff ff       	jmp    801b86 <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  801c53:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  801c56:	83 ec 0c             	sub    $0xc,%esp
+  801c59:	68 40 50 80 00       	push   $0x805040
+  801c5e:	e8 d0 f3 ff ff       	call   801033 <sysbatch_flush>
+  801c63:	83 c4 10             	add    $0x10,%esp
+  801c66:	85 c0                	test   %eax,%eax
+  801c68:	78 06                	js     801c70 <devfile_read+0x231>
+  801c6a:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  801c6e:	74 14                	je     801c84 <devfile_read+0x245>
+    memmove(dst, src, r);
+  801c70:	83 ec 04             	sub    $0x4,%esp
+  801c73:	ff 75 d4             	push   -0x2c(%ebp)
+  801c76:	ff 75 d0             	push   -0x30(%ebp)
+  801c79:	ff 75 0c             	push   0xc(%ebp)
+  801c7c:	e8 06 ed ff ff       	call   800987 <memmove>
+  801c81:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  801c84:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c87:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  801c8a:	e9 11 fe ff ff       	jmp    801aa0 <devfile_read+0x61>
+  assert(r <= n);
+  801c8f:	68 b1 35 80 00       	push   $0x8035b1
+  801c94:	68 b8 35 80 00       	push   $0x8035b8
+  801c99:	68 1c 01 00 00       	push   $0x11c
+  801c9e:	68 a6 35 80 00       	push   $0x8035a6
+  801ca3:	e8 ab 10 00 00       	call   802d53 <_panic>
+  assert(r <= PGSIZE);
+  801ca8:	68 cd 35 80 00       	push   $0x8035cd
+  801cad:	68 b8 35 80 00       	push   $0x8035b8
+  801cb2:	68 1d 01 00 00       	push   $0x11d
+  801cb7:	68 a6 35 80 00       	push   $0x8035a6
+  801cbc:	e8 92 10 00 00       	call   802d53 <_panic>
+
+00801cc1 <devfile_write>:
+{
+  801cc1:	55                   	push   %ebp
+  801cc2:	89 e5                	mov    %esp,%ebp
+  801cc4:	57                   	push   %edi
+  801cc5:	56                   	push   %esi
+  801cc6:	53                   	push   %ebx
+  801cc7:	83 ec 1c             	sub    $0x1c,%esp
+  801cca:	8b 75 08             	mov    0x8(%ebp),%esi
+  801ccd:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  801cd0:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  801cd5:	77 39                	ja     801d10 <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801cd7:	8b 56 0c             	mov    0xc(%esi),%edx
+  801cda:	89 15 00 60 80 00    	mov    %edx,0x806000
+  fsipcbuf.write.req_n = n;
+  801ce0:	a3 04 60 80 00       	mov    %eax,0x806004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  801ce5:	83 ec 04             	sub    $0x4,%esp
+  801ce8:	50                   	push   %eax
+  801ce9:	ff 75 0c             	push   0xc(%ebp)
+  801cec:	68 08 60 80 00       	push   $0x806008
+  801cf1:	e8 91 ec ff ff       	call   800987 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801cf6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cfb:	b8 04 00 00 00       	mov    $0x4,%eax
+  801d00:	e8 e7 fb ff ff       	call   8018ec <fsipc>
+  801d05:	83 c4 10             	add    $0x10,%esp
+}
+  801d08:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d0b:	5b                   	pop    %ebx
+  801d0c:	5e                   	pop    %esi
+  801d0d:	5f                   	pop    %edi
+  801d0e:	5d                   	pop    %ebp
+  801d0f:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  801d10:	ba 00 00 10 00       	mov    $0x100000,%edx
+  801d15:	39 d0                	cmp    %edx,%eax
+  801d17:	89 d3                	mov    %edx,%ebx
+  801d19:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  801d1c:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  801d22:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  801d25:	83 c7 01             	add    $0x1,%edi
+  801d28:	89 f8                	mov    %edi,%eax
+  801d2a:	e8 94 fc ff ff       	call   8019c3 <fsv_alloc>
+  801d2f:	85 c0                	test   %eax,%eax
+  801d31:	78 d5                	js     801d08 <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  801d33:	83 ec 04             	sub    $0x4,%esp
+  801d36:	53                   	push   %ebx
+  801d37:	ff 75 0c             	push   0xc(%ebp)
+  801d3a:	68 00 10 c0 9f       	push   $0x9fc01000
+  801d3f:	e8 43 ec ff ff       	call   800987 <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  801d44:	8b 46 0c             	mov    0xc(%esi),%eax
+  801d47:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  801d4c:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  801d52:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801d59:	89 f9                	mov    %edi,%ecx
+  801d5b:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801d60:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801d65:	e8 69 fa ff ff       	call   8017d3 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801d6a:	6a 00                	push   $0x0
+  801d6c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801d6f:	50                   	push   %eax
+  801d70:	6a 00                	push   $0x0
+  801d72:	6a 00                	push   $0x0
+  801d74:	e8 20 10 00 00       	call   802d99 <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  801d79:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  801d7c:	eb 8a                	jmp    801d08 <devfile_write+0x47>
+
+00801d7e <open>:
+{
+  801d7e:	55                   	push   %ebp
+  801d7f:	89 e5                	mov    %esp,%ebp
+  801d81:	56                   	push   %esi
+  801d82:	53                   	push   %ebx
+  801d83:	83 ec 1c             	sub    $0x1c,%esp
+  801d86:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801d89:	56                   	push   %esi
+  801d8a:	e8 37 ea ff ff       	call   8007c6 <strlen>
+  801d8f:	83 c4 10             	add    $0x10,%esp
+  801d92:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801d97:	7f 6c                	jg     801e05 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  801d99:	83 ec 0c             	sub    $0xc,%esp
+  801d9c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d9f:	50                   	push   %eax
+  801da0:	e8 ad f4 ff ff       	call   801252 <fd_alloc>
+  801da5:	89 c3                	mov    %eax,%ebx
+  801da7:	83 c4 10             	add    $0x10,%esp
+  801daa:	85 c0                	test   %eax,%eax
+  801dac:	78 3c                	js     801dea <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801dae:	83 ec 08             	sub    $0x8,%esp
+  801db1:	56                   	push   %esi
+  801db2:	68 00 60 80 00       	push   $0x806000
+  801db7:	e8 45 ea ff ff       	call   800801 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801dbc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801dbf:	a3 00 64 80 00       	mov    %eax,0x806400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801dc4:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801dc7:	b8 01 00 00 00       	mov    $0x1,%eax
+  801dcc:	e8 1b fb ff ff       	call   8018ec <fsipc>
+  801dd1:	89 c3                	mov    %eax,%ebx
+  801dd3:	83 c4 10             	add    $0x10,%esp
+  801dd6:	85 c0                	test   %eax,%eax
+  801dd8:	78 19                	js     801df3 <open+0x75>
+  return fd2num(fd);
+  801dda:	83 ec 0c             	sub    $0xc,%esp
+  801ddd:	ff 75 f4             	push   -0xc(%ebp)
+  801de0:	e8 49 f4 ff ff       	call   80122e <fd2num>
+  801de5:	89 c3                	mov    %eax,%ebx
+  801de7:	83 c4 10             	add    $0x10,%esp
+}
+  801dea:	89 d8                	mov    %ebx,%eax
+  801dec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801def:	5b                   	pop    %ebx
+  801df0:	5e                   	pop    %esi
+  801df1:	5d                   	pop    %ebp
+  801df2:	c3                   	ret
+    fd_close(fd, 0);
+  801df3:	83 ec 08             	sub    $0x8,%esp
+  801df6:	6a 00                	push   $0x0
+  801df8:	ff 75 f4             	push   -0xc(%ebp)
+  801dfb:	e8 44 f5 ff ff       	call   801344 <fd_close>
+    return r;
+  801e00:	83 c4 10             	add    $0x10,%esp
+  801e03:	eb e5                	jmp    801dea <open+0x6c>
+    return -E_BAD_PATH;
+  801e05:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801e0a:	eb de                	jmp    801dea <open+0x6c>
+
+00801e0c <open_read>:
+{
+  801e0c:	55                   	push   %ebp
+  801e0d:	89 e5                	mov    %esp,%ebp
+  801e0f:	57                   	push   %edi
+  801e10:	56                   	push   %esi
+  801e11:	53                   	push   %ebx
+  801e12:	83 ec 28             	sub    $0x28,%esp
+  801e15:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  801e18:	57                   	push   %edi
+  801e19:	e8 a8 e9 ff ff       	call   8007c6 <strlen>
+  801e1e:	83 c4 10             	add    $0x10,%esp
+  801e21:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801e26:	0f 87 f6 00 00 00    	ja     801f22 <open_read+0x116>
+  801e2c:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  801e2e:	83 ec 0c             	sub    $0xc,%esp
+  801e31:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801e34:	50                   	push   %eax
+  801e35:	e8 18 f4 ff ff       	call   801252 <fd_alloc>
+  801e3a:	89 c3                	mov    %eax,%ebx
+  801e3c:	83 c4 10             	add    $0x10,%esp
+  801e3f:	85 c0                	test   %eax,%eax
+  801e41:	0f 88 b2 00 00 00    	js     801ef9 <open_read+0xed>
+  strcpy(req->req_buf, path);
+  801e47:	83 ec 08             	sub    $0x8,%esp
+  801e4a:	57                   	push   %edi
+  801e4b:	68 e4 60 80 00       	push   $0x8060e4
+  801e50:	e8 ac e9 ff ff       	call   800801 <strcpy>
+  req->req_nops = 2;
+  801e55:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  801e5c:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  801e5f:	c7 05 04 60 80 00 01 	movl   $0x1,0x806004
+  801e66:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  801e69:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e6c:	a3 10 60 80 00       	mov    %eax,0x806010
+  req->req_ops[0].op_buf = 0;
+  801e71:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  801e78:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  801e7b:	c7 05 20 60 80 00 04 	movl   $0x4,0x806020
+  801e82:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  801e85:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  801e8c:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  801e8f:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  801e94:	29 f0                	sub    %esi,%eax
+  801e96:	3b 45 14             	cmp    0x14(%ebp),%eax
+  801e99:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  801e9d:	a3 2c 60 80 00       	mov    %eax,0x80602c
+  req->req_ops[1].op_offset = 0;
+  801ea2:	c7 05 30 60 80 00 00 	movl   $0x0,0x806030
+  801ea9:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  801eac:	83 c6 01             	add    $0x1,%esi
+  801eaf:	89 35 34 60 80 00    	mov    %esi,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  801eb5:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801eb8:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801ebd:	e8 2a fa ff ff       	call   8018ec <fsipc>
+  801ec2:	89 c3                	mov    %eax,%ebx
+  801ec4:	83 c4 10             	add    $0x10,%esp
+  801ec7:	83 f8 01             	cmp    $0x1,%eax
+  801eca:	7e 37                	jle    801f03 <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  801ecc:	a1 38 60 80 00       	mov    0x806038,%eax
+  801ed1:	8b 55 18             	mov    0x18(%ebp),%edx
+  801ed4:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  801ed6:	83 ec 04             	sub    $0x4,%esp
+  801ed9:	50                   	push   %eax
+  801eda:	81 c6 e4 60 80 00    	add    $0x8060e4,%esi
+  801ee0:	56                   	push   %esi
+  801ee1:	ff 75 10             	push   0x10(%ebp)
+  801ee4:	e8 9e ea ff ff       	call   800987 <memmove>
+  return fd2num(fd);
+  801ee9:	83 c4 04             	add    $0x4,%esp
+  801eec:	ff 75 e4             	push   -0x1c(%ebp)
+  801eef:	e8 3a f3 ff ff       	call   80122e <fd2num>
+  801ef4:	89 c3                	mov    %eax,%ebx
+  801ef6:	83 c4 10             	add    $0x10,%esp
+}
+  801ef9:	89 d8                	mov    %ebx,%eax
+  801efb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801efe:	5b                   	pop    %ebx
+  801eff:	5e                   	pop    %esi
+  801f00:	5f                   	pop    %edi
+  801f01:	5d                   	pop    %ebp
+  801f02:	c3                   	ret
+    fd_close(fd, 0);
+  801f03:	83 ec 08             	sub    $0x8,%esp
+  801f06:	6a 00                	push   $0x0
+  801f08:	ff 75 e4             	push   -0x1c(%ebp)
+  801f0b:	e8 34 f4 ff ff       	call   801344 <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  801f10:	83 c4 10             	add    $0x10,%esp
+  801f13:	85 db                	test   %ebx,%ebx
+  801f15:	78 e2                	js     801ef9 <open_read+0xed>
+  801f17:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  801f1a:	8b 9b 1c 60 80 00    	mov    0x80601c(%ebx),%ebx
+  801f20:	eb d7                	jmp    801ef9 <open_read+0xed>
+    return -E_BAD_PATH;
+  801f22:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801f27:	eb d0                	jmp    801ef9 <open_read+0xed>
+
+00801f29 <file_stat>:
+{
+  801f29:	55                   	push   %ebp
+  801f2a:	89 e5                	mov    %esp,%ebp
+  801f2c:	57                   	push   %edi
+  801f2d:	56                   	push   %esi
+  801f2e:	53                   	push   %ebx
+  801f2f:	83 ec 18             	sub    $0x18,%esp
+  801f32:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801f35:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801f38:	57                   	push   %edi
+  801f39:	e8 88 e8 ff ff       	call   8007c6 <strlen>
+  801f3e:	83 c4 10             	add    $0x10,%esp
+  801f41:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801f46:	0f 8f c7 00 00 00    	jg     802013 <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  801f4c:	83 ec 0c             	sub    $0xc,%esp
+  801f4f:	57                   	push   %edi
+  801f50:	e8 71 e8 ff ff       	call   8007c6 <strlen>
+  801f55:	8d 58 04             	lea    0x4(%eax),%ebx
+  801f58:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  801f5b:	83 c4 08             	add    $0x8,%esp
+  801f5e:	57                   	push   %edi
+  801f5f:	68 e4 60 80 00       	push   $0x8060e4
+  801f64:	e8 98 e8 ff ff       	call   800801 <strcpy>
+  req->req_nops = 2;
+  801f69:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  801f70:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  801f73:	c7 05 04 60 80 00 02 	movl   $0x2,0x806004
+  801f7a:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  801f7d:	c7 05 10 60 80 00 00 	movl   $0x0,0x806010
+  801f84:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  801f87:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  801f8e:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  801f91:	c7 05 20 60 80 00 03 	movl   $0x3,0x806020
+  801f98:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  801f9b:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  801fa2:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  801fa5:	89 1d 34 60 80 00    	mov    %ebx,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  801fab:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fb0:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801fb5:	e8 32 f9 ff ff       	call   8018ec <fsipc>
+  801fba:	83 c4 10             	add    $0x10,%esp
+  801fbd:	83 f8 01             	cmp    $0x1,%eax
+  801fc0:	7e 42                	jle    802004 <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  801fc2:	81 c3 e4 60 80 00    	add    $0x8060e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  801fc8:	83 ec 08             	sub    $0x8,%esp
+  801fcb:	53                   	push   %ebx
+  801fcc:	56                   	push   %esi
+  801fcd:	e8 2f e8 ff ff       	call   800801 <strcpy>
+  st->st_size = ret->ret_size;
+  801fd2:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  801fd8:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  801fde:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  801fe4:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  801fea:	c7 86 88 00 00 00 04 	movl   $0x804004,0x88(%esi)
+  801ff1:	40 80 00 
+  return 0;
+  801ff4:	83 c4 10             	add    $0x10,%esp
+  801ff7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ffc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801fff:	5b                   	pop    %ebx
+  802000:	5e                   	pop    %esi
+  802001:	5f                   	pop    %edi
+  802002:	5d                   	pop    %ebp
+  802003:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  802004:	85 c0                	test   %eax,%eax
+  802006:	78 f4                	js     801ffc <file_stat+0xd3>
+  802008:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80200b:	8b 80 1c 60 80 00    	mov    0x80601c(%eax),%eax
+  802011:	eb e9                	jmp    801ffc <file_stat+0xd3>
+    return -E_BAD_PATH;
+  802013:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802018:	eb e2                	jmp    801ffc <file_stat+0xd3>
+
+0080201a <read_map>:
+{
+  80201a:	55                   	push   %ebp
+  80201b:	89 e5                	mov    %esp,%ebp
+  80201d:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802020:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802023:	50                   	push   %eax
+  802024:	ff 75 08             	push   0x8(%ebp)
+  802027:	e8 7c f2 ff ff       	call   8012a8 <fd_lookup>
+  80202c:	83 c4 10             	add    $0x10,%esp
+  80202f:	85 c0                	test   %eax,%eax
+  802031:	78 2a                	js     80205d <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  802033:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802036:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  80203c:	39 08                	cmp    %ecx,(%eax)
+  80203e:	75 1f                	jne    80205f <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  802040:	8b 40 0c             	mov    0xc(%eax),%eax
+  802043:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read_map.req_offset = offset;
+  802048:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80204b:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  802050:	8b 55 10             	mov    0x10(%ebp),%edx
+  802053:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802058:	e8 8f f8 ff ff       	call   8018ec <fsipc>
+}
+  80205d:	c9                   	leave
+  80205e:	c3                   	ret
+    return -E_INVAL;
+  80205f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802064:	eb f7                	jmp    80205d <read_map+0x43>
+
+00802066 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802066:	55                   	push   %ebp
+  802067:	89 e5                	mov    %esp,%ebp
+  802069:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  80206c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802071:	b8 08 00 00 00       	mov    $0x8,%eax
+  802076:	e8 71 f8 ff ff       	call   8018ec <fsipc>
+}
+  80207b:	c9                   	leave
+  80207c:	c3                   	ret
+
+0080207d <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  80207d:	55                   	push   %ebp
+  80207e:	89 e5                	mov    %esp,%ebp
+  802080:	57                   	push   %edi
+  802081:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  802082:	8b 45 08             	mov    0x8(%ebp),%eax
+  802085:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.stats.req_bio_sched = 0;
+  80208a:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  802091:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  802094:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  80209b:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  80209e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020a3:	b8 09 00 00 00       	mov    $0x9,%eax
+  8020a8:	e8 3f f8 ff ff       	call   8018ec <fsipc>
+  8020ad:	85 c0                	test   %eax,%eax
+  8020af:	78 14                	js     8020c5 <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  8020b1:	be 00 60 80 00       	mov    $0x806000,%esi
+  8020b6:	b9 16 00 00 00       	mov    $0x16,%ecx
+  8020bb:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8020be:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  8020c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020c5:	5e                   	pop    %esi
+  8020c6:	5f                   	pop    %edi
+  8020c7:	5d                   	pop    %ebp
+  8020c8:	c3                   	ret
+
+008020c9 <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  8020c9:	55                   	push   %ebp
+  8020ca:	89 e5                	mov    %esp,%ebp
+  8020cc:	53                   	push   %ebx
+  8020cd:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  8020d0:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8020d3:	50                   	push   %eax
+  8020d4:	6a 00                	push   $0x0
+  8020d6:	e8 a2 ff ff ff       	call   80207d <fs_stats>
+  8020db:	83 c4 10             	add    $0x10,%esp
+  8020de:	85 c0                	test   %eax,%eax
+  8020e0:	78 28                	js     80210a <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  8020e2:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  8020e5:	83 ec 08             	sub    $0x8,%esp
+  8020e8:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8020eb:	50                   	push   %eax
+  8020ec:	6a 20                	push   $0x20
+  8020ee:	e8 8a ff ff ff       	call   80207d <fs_stats>
+  8020f3:	83 c4 10             	add    $0x10,%esp
+  8020f6:	85 c0                	test   %eax,%eax
+  8020f8:	78 10                	js     80210a <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  8020fa:	83 ec 08             	sub    $0x8,%esp
+  8020fd:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802100:	50                   	push   %eax
+  802101:	53                   	push   %ebx
+  802102:	e8 76 ff ff ff       	call   80207d <fs_stats>
+  802107:	83 c4 10             	add    $0x10,%esp
+}
+  80210a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80210d:	c9                   	leave
+  80210e:	c3                   	ret
+
+0080210f <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  80210f:	55                   	push   %ebp
+  802110:	89 e5                	mov    %esp,%ebp
+  802112:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  802115:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  80211c:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  80211f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802122:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.stats.req_dcache = 0;
+  802127:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  80212e:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  802131:	ba 00 00 00 00       	mov    $0x0,%edx
+  802136:	b8 09 00 00 00       	mov    $0x9,%eax
+  80213b:	e8 ac f7 ff ff       	call   8018ec <fsipc>
+}
+  802140:	c9                   	leave
+  802141:	c3                   	ret
+
+00802142 <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  802142:	55                   	push   %ebp
+  802143:	89 e5                	mov    %esp,%ebp
+  802145:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  802148:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  80214f:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  802152:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  802159:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  80215c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80215f:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_STATS, NULL);
+  802164:	ba 00 00 00 00       	mov    $0x0,%edx
+  802169:	b8 09 00 00 00       	mov    $0x9,%eax
+  80216e:	e8 79 f7 ff ff       	call   8018ec <fsipc>
+}
+  802173:	c9                   	leave
+  802174:	c3                   	ret
+
+00802175 <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  802175:	55                   	push   %ebp
+  802176:	89 e5                	mov    %esp,%ebp
+  802178:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80217b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80217e:	50                   	push   %eax
+  80217f:	ff 75 08             	push   0x8(%ebp)
+  802182:	e8 21 f1 ff ff       	call   8012a8 <fd_lookup>
+  802187:	83 c4 10             	add    $0x10,%esp
+  80218a:	85 c0                	test   %eax,%eax
+  80218c:	78 34                	js     8021c2 <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  80218e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802191:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  802197:	39 08                	cmp    %ecx,(%eax)
+  802199:	75 29                	jne    8021c4 <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  80219b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80219e:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.fallocate.req_offset = offset;
+  8021a3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021a6:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.fallocate.req_len = len;
+  8021ab:	8b 45 10             	mov    0x10(%ebp),%eax
+  8021ae:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  8021b3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021b8:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8021bd:	e8 2a f7 ff ff       	call   8018ec <fsipc>
+}
+  8021c2:	c9                   	leave
+  8021c3:	c3                   	ret
+    return -E_INVAL;
+  8021c4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021c9:	eb f7                	jmp    8021c2 <fallocate+0x4d>
+
+008021cb <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  8021cb:	55                   	push   %ebp
+  8021cc:	89 e5                	mov    %esp,%ebp
+  8021ce:	57                   	push   %edi
+  8021cf:	56                   	push   %esi
+  8021d0:	53                   	push   %ebx
+  8021d1:	83 ec 24             	sub    $0x24,%esp
+  8021d4:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8021d7:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8021da:	50                   	push   %eax
+  8021db:	ff 75 08             	push   0x8(%ebp)
+  8021de:	e8 c5 f0 ff ff       	call   8012a8 <fd_lookup>
+  8021e3:	83 c4 10             	add    $0x10,%esp
+  8021e6:	85 c0                	test   %eax,%eax
+  8021e8:	78 66                	js     802250 <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  8021ea:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8021ed:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  8021f3:	39 08                	cmp    %ecx,(%eax)
+  8021f5:	75 61                	jne    802258 <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  8021f7:	85 f6                	test   %esi,%esi
+  8021f9:	7e 50                	jle    80224b <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  8021fb:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  802200:	39 de                	cmp    %ebx,%esi
+  802202:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  802205:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802208:	8b 40 0c             	mov    0xc(%eax),%eax
+  80220b:	a3 00 60 80 00       	mov    %eax,0x806000
+    fsipcbuf.prefetch.req_n = m;
+  802210:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  802216:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  80221d:	83 ec 04             	sub    $0x4,%esp
+  802220:	57                   	push   %edi
+  802221:	ff 75 0c             	push   0xc(%ebp)
+  802224:	68 08 60 80 00       	push   $0x806008
+  802229:	e8 59 e7 ff ff       	call   800987 <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  80222e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802233:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802238:	e8 af f6 ff ff       	call   8018ec <fsipc>
+  80223d:	83 c4 10             	add    $0x10,%esp
+  802240:	85 c0                	test   %eax,%eax
+  802242:	78 0c                	js     802250 <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  802244:	01 7d 0c             	add    %edi,0xc(%ebp)
+  802247:	29 de                	sub    %ebx,%esi
+  802249:	eb ac                	jmp    8021f7 <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  80224b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802250:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802253:	5b                   	pop    %ebx
+  802254:	5e                   	pop    %esi
+  802255:	5f                   	pop    %edi
+  802256:	5d                   	pop    %ebp
+  802257:	c3                   	ret
+    return -E_INVAL;
+  802258:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80225d:	eb f1                	jmp    802250 <prefetch+0x85>
+
+0080225f <writebuf>:
+
+
+static void
+writebuf(struct printbuf *b)
+{
+  if (b->error > 0) {
+  80225f:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802263:	7f 01                	jg     802266 <writebuf+0x7>
+  802265:	c3                   	ret
+{
+  802266:	55                   	push   %ebp
+  802267:	89 e5                	mov    %esp,%ebp
+  802269:	53                   	push   %ebx
+  80226a:	83 ec 08             	sub    $0x8,%esp
+  80226d:	89 c3                	mov    %eax,%ebx
+    ssize_t result = write(b->fd, b->buf, b->idx);
+  80226f:	ff 70 04             	push   0x4(%eax)
+  802272:	8d 40 10             	lea    0x10(%eax),%eax
+  802275:	50                   	push   %eax
+  802276:	ff 33                	push   (%ebx)
+  802278:	e8 a4 f3 ff ff       	call   801621 <write>
+    if (result > 0)
+  80227d:	83 c4 10             	add    $0x10,%esp
+  802280:	85 c0                	test   %eax,%eax
+  802282:	7e 03                	jle    802287 <writebuf+0x28>
+      b->result += result;
+  802284:	01 43 08             	add    %eax,0x8(%ebx)
+    if (result != b->idx)             // error, or wrote less than supplied
+  802287:	39 43 04             	cmp    %eax,0x4(%ebx)
+  80228a:	74 0d                	je     802299 <writebuf+0x3a>
+      b->error = (result < 0 ? result : 0);
+  80228c:	85 c0                	test   %eax,%eax
+  80228e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802293:	0f 4f c2             	cmovg  %edx,%eax
+  802296:	89 43 0c             	mov    %eax,0xc(%ebx)
+  }
+}
+  802299:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80229c:	c9                   	leave
+  80229d:	c3                   	ret
+
+0080229e <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  80229e:	55                   	push   %ebp
+  80229f:	89 e5                	mov    %esp,%ebp
+  8022a1:	53                   	push   %ebx
+  8022a2:	83 ec 04             	sub    $0x4,%esp
+  8022a5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct printbuf *b = (struct printbuf *)thunk;
+
+  b->buf[b->idx++] = ch;
+  8022a8:	8b 53 04             	mov    0x4(%ebx),%edx
+  8022ab:	8d 42 01             	lea    0x1(%edx),%eax
+  8022ae:	89 43 04             	mov    %eax,0x4(%ebx)
+  8022b1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8022b4:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+  if (b->idx == 256) {
+  8022b8:	3d 00 01 00 00       	cmp    $0x100,%eax
+  8022bd:	74 05                	je     8022c4 <putch+0x26>
+    writebuf(b);
+    b->idx = 0;
+  }
+}
+  8022bf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8022c2:	c9                   	leave
+  8022c3:	c3                   	ret
+    writebuf(b);
+  8022c4:	89 d8                	mov    %ebx,%eax
+  8022c6:	e8 94 ff ff ff       	call   80225f <writebuf>
+    b->idx = 0;
+  8022cb:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+  8022d2:	eb eb                	jmp    8022bf <putch+0x21>
+
+008022d4 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap)
+{
+  8022d4:	55                   	push   %ebp
+  8022d5:	89 e5                	mov    %esp,%ebp
+  8022d7:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.fd = fd;
+  8022dd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022e0:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+  b.idx = 0;
+  8022e6:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  8022ed:	00 00 00 
+  b.result = 0;
+  8022f0:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8022f7:	00 00 00 
+  b.error = 1;
+  8022fa:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  802301:	00 00 00 
+  vprintfmt(putch, &b, fmt, ap);
+  802304:	ff 75 10             	push   0x10(%ebp)
+  802307:	ff 75 0c             	push   0xc(%ebp)
+  80230a:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  802310:	50                   	push   %eax
+  802311:	68 9e 22 80 00       	push   $0x80229e
+  802316:	e8 ef df ff ff       	call   80030a <vprintfmt>
+  if (b.idx > 0)
+  80231b:	83 c4 10             	add    $0x10,%esp
+  80231e:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  802325:	7f 12                	jg     802339 <vfprintf+0x65>
+    writebuf(&b);
+
+  return b.result ? b.result : b.error;
+  802327:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  80232d:	85 c0                	test   %eax,%eax
+  80232f:	75 06                	jne    802337 <vfprintf+0x63>
+  802331:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+}
+  802337:	c9                   	leave
+  802338:	c3                   	ret
+    writebuf(&b);
+  802339:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  80233f:	e8 1b ff ff ff       	call   80225f <writebuf>
+  802344:	eb e1                	jmp    802327 <vfprintf+0x53>
+
+00802346 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...)
+{
+  802346:	55                   	push   %ebp
+  802347:	89 e5                	mov    %esp,%ebp
+  802349:	83 ec 0c             	sub    $0xc,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  80234c:	8d 45 10             	lea    0x10(%ebp),%eax
+  cnt = vfprintf(fd, fmt, ap);
+  80234f:	50                   	push   %eax
+  802350:	ff 75 0c             	push   0xc(%ebp)
+  802353:	ff 75 08             	push   0x8(%ebp)
+  802356:	e8 79 ff ff ff       	call   8022d4 <vfprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  80235b:	c9                   	leave
+  80235c:	c3                   	ret
+
+0080235d <printf>:
+
+int
+printf(const char *fmt, ...)
+{
+  80235d:	55                   	push   %ebp
+  80235e:	89 e5                	mov    %esp,%ebp
+  802360:	83 ec 0c             	sub    $0xc,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  802363:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vfprintf(1, fmt, ap);
+  802366:	50                   	push   %eax
+  802367:	ff 75 08             	push   0x8(%ebp)
+  80236a:	6a 01                	push   $0x1
+  80236c:	e8 63 ff ff ff       	call   8022d4 <vfprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  802371:	c9                   	leave
+  802372:	c3                   	ret
+
+00802373 <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  802373:	55                   	push   %ebp
+  802374:	89 e5                	mov    %esp,%ebp
+  802376:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  802379:	50                   	push   %eax
+  80237a:	e8 bf ee ff ff       	call   80123e <fd2data>
+  80237f:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  802384:	c9                   	leave
+  802385:	c3                   	ret
+
+00802386 <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802386:	55                   	push   %ebp
+  802387:	89 e5                	mov    %esp,%ebp
+  802389:	56                   	push   %esi
+  80238a:	53                   	push   %ebx
+  80238b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  80238e:	83 ec 0c             	sub    $0xc,%esp
+  802391:	ff 75 08             	push   0x8(%ebp)
+  802394:	e8 a5 ee ff ff       	call   80123e <fd2data>
+  802399:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  80239b:	83 c4 08             	add    $0x8,%esp
+  80239e:	68 08 36 80 00       	push   $0x803608
+  8023a3:	53                   	push   %ebx
+  8023a4:	e8 58 e4 ff ff       	call   800801 <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  8023a9:	8b 46 04             	mov    0x4(%esi),%eax
+  8023ac:	2b 06                	sub    (%esi),%eax
+  8023ae:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  8023b4:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8023bb:	00 00 00 
+  stat->st_dev = &devpipe;
+  8023be:	c7 83 88 00 00 00 20 	movl   $0x804020,0x88(%ebx)
+  8023c5:	40 80 00 
+  return 0;
+}
+  8023c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023cd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023d0:	5b                   	pop    %ebx
+  8023d1:	5e                   	pop    %esi
+  8023d2:	5d                   	pop    %ebp
+  8023d3:	c3                   	ret
+
+008023d4 <pipe_wakeup>:
+{
+  8023d4:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  8023d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023db:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  8023de:	85 c0                	test   %eax,%eax
+  8023e0:	75 01                	jne    8023e3 <pipe_wakeup+0xf>
+  8023e2:	c3                   	ret
+{
+  8023e3:	55                   	push   %ebp
+  8023e4:	89 e5                	mov    %esp,%ebp
+  8023e6:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  8023e9:	6a 00                	push   $0x0
+  8023eb:	68 00 00 c0 ee       	push   $0xeec00000
+  8023f0:	52                   	push   %edx
+  8023f1:	e8 96 eb ff ff       	call   800f8c <sys_chan_wakeup>
+  8023f6:	83 c4 10             	add    $0x10,%esp
+}
+  8023f9:	c9                   	leave
+  8023fa:	c3                   	ret
+
+008023fb <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8023fb:	55                   	push   %ebp
+  8023fc:	89 e5                	mov    %esp,%ebp
+  8023fe:	57                   	push   %edi
+  8023ff:	56                   	push   %esi
+  802400:	53                   	push   %ebx
+  802401:	83 ec 18             	sub    $0x18,%esp
+  802404:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  802407:	57                   	push   %edi
+  802408:	e8 31 ee ff ff       	call   80123e <fd2data>
+  80240d:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  80240f:	83 c4 10             	add    $0x10,%esp
+  802412:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  802416:	74 2a                	je     802442 <devpipe_close+0x47>
+  802418:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  80241d:	89 f8                	mov    %edi,%eax
+  80241f:	e8 4f ff ff ff       	call   802373 <pipe_ring>
+  802424:	83 ec 08             	sub    $0x8,%esp
+  802427:	01 d8                	add    %ebx,%eax
+  802429:	50                   	push   %eax
+  80242a:	6a 00                	push   $0x0
+  80242c:	e8 84 e8 ff ff       	call   800cb5 <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  802431:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802437:	83 c4 10             	add    $0x10,%esp
+  80243a:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  802440:	75 db                	jne    80241d <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  802442:	83 ec 08             	sub    $0x8,%esp
+  802445:	57                   	push   %edi
+  802446:	6a 00                	push   $0x0
+  802448:	e8 68 e8 ff ff       	call   800cb5 <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  80244d:	83 c4 10             	add    $0x10,%esp
+  802450:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  802454:	75 13                	jne    802469 <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  802456:	83 ec 08             	sub    $0x8,%esp
+  802459:	56                   	push   %esi
+  80245a:	6a 00                	push   $0x0
+  80245c:	e8 54 e8 ff ff       	call   800cb5 <sys_page_unmap>
+}
+  802461:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802464:	5b                   	pop    %ebx
+  802465:	5e                   	pop    %esi
+  802466:	5f                   	pop    %edi
+  802467:	5d                   	pop    %ebp
+  802468:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802469:	8d 56 04             	lea    0x4(%esi),%edx
+  80246c:	8d 46 2c             	lea    0x2c(%esi),%eax
+  80246f:	e8 60 ff ff ff       	call   8023d4 <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802474:	8d 46 30             	lea    0x30(%esi),%eax
+  802477:	89 f2                	mov    %esi,%edx
+  802479:	e8 56 ff ff ff       	call   8023d4 <pipe_wakeup>
+  80247e:	eb d6                	jmp    802456 <devpipe_close+0x5b>
+
+00802480 <_pipeisclosed>:
+{
+  802480:	55                   	push   %ebp
+  802481:	89 e5                	mov    %esp,%ebp
+  802483:	57                   	push   %edi
+  802484:	56                   	push   %esi
+  802485:	53                   	push   %ebx
+  802486:	83 ec 1c             	sub    $0x1c,%esp
+  802489:	89 c7                	mov    %eax,%edi
+  80248b:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  80248d:	a1 44 57 80 00       	mov    0x805744,%eax
+  802492:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  802495:	83 ec 0c             	sub    $0xc,%esp
+  802498:	57                   	push   %edi
+  802499:	e8 5e 0a 00 00       	call   802efc <pageref>
+  80249e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8024a1:	89 34 24             	mov    %esi,(%esp)
+  8024a4:	e8 53 0a 00 00       	call   802efc <pageref>
+    nn = thisenv->env_runs;
+  8024a9:	8b 15 44 57 80 00    	mov    0x805744,%edx
+  8024af:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  8024b2:	83 c4 10             	add    $0x10,%esp
+  8024b5:	39 cb                	cmp    %ecx,%ebx
+  8024b7:	74 1b                	je     8024d4 <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  8024b9:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8024bc:	75 cf                	jne    80248d <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8024be:	8b 42 58             	mov    0x58(%edx),%eax
+  8024c1:	6a 01                	push   $0x1
+  8024c3:	50                   	push   %eax
+  8024c4:	53                   	push   %ebx
+  8024c5:	68 0f 36 80 00       	push   $0x80360f
+  8024ca:	e8 44 dd ff ff       	call   800213 <cprintf>
+  8024cf:	83 c4 10             	add    $0x10,%esp
+  8024d2:	eb b9                	jmp    80248d <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  8024d4:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8024d7:	0f 94 c0             	sete   %al
+  8024da:	0f b6 c0             	movzbl %al,%eax
+}
+  8024dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024e0:	5b                   	pop    %ebx
+  8024e1:	5e                   	pop    %esi
+  8024e2:	5f                   	pop    %edi
+  8024e3:	5d                   	pop    %ebp
+  8024e4:	c3                   	ret
+
+008024e5 <devpipe_write_bulk>:
+{
+  8024e5:	55                   	push   %ebp
+  8024e6:	89 e5                	mov    %esp,%ebp
+  8024e8:	57                   	push   %edi
+  8024e9:	56                   	push   %esi
+  8024ea:	53                   	push   %ebx
+  8024eb:	83 ec 1c             	sub    $0x1c,%esp
+  8024ee:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8024f1:	89 d6                	mov    %edx,%esi
+  8024f3:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  8024f6:	e8 78 fe ff ff       	call   802373 <pipe_ring>
+  8024fb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  8024fe:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802503:	8d 46 04             	lea    0x4(%esi),%eax
+  802506:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  802509:	eb 75                	jmp    802580 <devpipe_write_bulk+0x9b>
+  80250b:	b8 01 00 00 00       	mov    $0x1,%eax
+  802510:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802514:	6a 64                	push   $0x64
+  802516:	68 00 00 c0 ee       	push   $0xeec00000
+  80251b:	53                   	push   %ebx
+  80251c:	56                   	push   %esi
+  80251d:	e8 47 ea ff ff       	call   800f69 <sys_chan_sleep>
+      continue;
+  802522:	83 c4 10             	add    $0x10,%esp
+  802525:	eb 59                	jmp    802580 <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  802527:	89 d1                	mov    %edx,%ecx
+  802529:	c1 f9 1f             	sar    $0x1f,%ecx
+  80252c:	c1 e9 11             	shr    $0x11,%ecx
+  80252f:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802532:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802537:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  802539:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  80253f:	29 d3                	sub    %edx,%ebx
+  802541:	ba 00 80 00 00       	mov    $0x8000,%edx
+  802546:	29 c2                	sub    %eax,%edx
+  802548:	39 d3                	cmp    %edx,%ebx
+  80254a:	0f 47 da             	cmova  %edx,%ebx
+  80254d:	8b 55 08             	mov    0x8(%ebp),%edx
+  802550:	29 fa                	sub    %edi,%edx
+  802552:	39 d3                	cmp    %edx,%ebx
+  802554:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  802557:	83 ec 04             	sub    $0x4,%esp
+  80255a:	53                   	push   %ebx
+  80255b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80255e:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  802561:	52                   	push   %edx
+  802562:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802565:	01 c8                	add    %ecx,%eax
+  802567:	50                   	push   %eax
+  802568:	e8 7c e4 ff ff       	call   8009e9 <memcpy>
+    i += m;
+  80256d:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  80256f:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802572:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802575:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802578:	e8 57 fe ff ff       	call   8023d4 <pipe_wakeup>
+  80257d:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802580:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802583:	73 2b                	jae    8025b0 <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  802585:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  802587:	8b 56 04             	mov    0x4(%esi),%edx
+  80258a:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  802590:	39 d0                	cmp    %edx,%eax
+  802592:	7d 93                	jge    802527 <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  802594:	89 f2                	mov    %esi,%edx
+  802596:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802599:	e8 e2 fe ff ff       	call   802480 <_pipeisclosed>
+  80259e:	85 c0                	test   %eax,%eax
+  8025a0:	0f 84 65 ff ff ff    	je     80250b <devpipe_write_bulk+0x26>
+        return i;
+  8025a6:	89 f8                	mov    %edi,%eax
+}
+  8025a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025ab:	5b                   	pop    %ebx
+  8025ac:	5e                   	pop    %esi
+  8025ad:	5f                   	pop    %edi
+  8025ae:	5d                   	pop    %ebp
+  8025af:	c3                   	ret
+  return i;
+  8025b0:	89 f8                	mov    %edi,%eax
+  8025b2:	eb f4                	jmp    8025a8 <devpipe_write_bulk+0xc3>
+
+008025b4 <devpipe_write>:
+{
+  8025b4:	55                   	push   %ebp
+  8025b5:	89 e5                	mov    %esp,%ebp
+  8025b7:	57                   	push   %edi
+  8025b8:	56                   	push   %esi
+  8025b9:	53                   	push   %ebx
+  8025ba:	83 ec 28             	sub    $0x28,%esp
+  8025bd:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  8025c0:	56                   	push   %esi
+  8025c1:	e8 78 ec ff ff       	call   80123e <fd2data>
+  8025c6:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  8025c8:	8b 78 28             	mov    0x28(%eax),%edi
+  8025cb:	83 c4 10             	add    $0x10,%esp
+  8025ce:	85 ff                	test   %edi,%edi
+  8025d0:	75 25                	jne    8025f7 <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  8025d2:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8025d5:	74 66                	je     80263d <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8025d7:	8b 43 04             	mov    0x4(%ebx),%eax
+  8025da:	8b 0b                	mov    (%ebx),%ecx
+  8025dc:	8d 51 20             	lea    0x20(%ecx),%edx
+  8025df:	39 d0                	cmp    %edx,%eax
+  8025e1:	72 2b                	jb     80260e <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  8025e3:	89 da                	mov    %ebx,%edx
+  8025e5:	89 f0                	mov    %esi,%eax
+  8025e7:	e8 94 fe ff ff       	call   802480 <_pipeisclosed>
+  8025ec:	85 c0                	test   %eax,%eax
+  8025ee:	75 51                	jne    802641 <devpipe_write+0x8d>
+      sys_yield();
+  8025f0:	e8 d9 e5 ff ff       	call   800bce <sys_yield>
+  8025f5:	eb e0                	jmp    8025d7 <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  8025f7:	83 ec 0c             	sub    $0xc,%esp
+  8025fa:	ff 75 10             	push   0x10(%ebp)
+  8025fd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802600:	89 c2                	mov    %eax,%edx
+  802602:	89 f0                	mov    %esi,%eax
+  802604:	e8 dc fe ff ff       	call   8024e5 <devpipe_write_bulk>
+  802609:	83 c4 10             	add    $0x10,%esp
+  80260c:	eb 38                	jmp    802646 <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80260e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802611:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802615:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802618:	89 c2                	mov    %eax,%edx
+  80261a:	c1 fa 1f             	sar    $0x1f,%edx
+  80261d:	89 d1                	mov    %edx,%ecx
+  80261f:	c1 e9 1b             	shr    $0x1b,%ecx
+  802622:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802625:	83 e2 1f             	and    $0x1f,%edx
+  802628:	29 ca                	sub    %ecx,%edx
+  80262a:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  80262e:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  802632:	83 c0 01             	add    $0x1,%eax
+  802635:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  802638:	83 c7 01             	add    $0x1,%edi
+  80263b:	eb 95                	jmp    8025d2 <devpipe_write+0x1e>
+  return i;
+  80263d:	89 f8                	mov    %edi,%eax
+  80263f:	eb 05                	jmp    802646 <devpipe_write+0x92>
+        return 0;
+  802641:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802646:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802649:	5b                   	pop    %ebx
+  80264a:	5e                   	pop    %esi
+  80264b:	5f                   	pop    %edi
+  80264c:	5d                   	pop    %ebp
+  80264d:	c3                   	ret
+
+0080264e <devpipe_read_bulk>:
+{
+  80264e:	55                   	push   %ebp
+  80264f:	89 e5                	mov    %esp,%ebp
+  802651:	57                   	push   %edi
+  802652:	56                   	push   %esi
+  802653:	53                   	push   %ebx
+  802654:	83 ec 2c             	sub    $0x2c,%esp
+  802657:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80265a:	89 d6                	mov    %edx,%esi
+  80265c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80265f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  802662:	e8 0c fd ff ff       	call   802373 <pipe_ring>
+  802667:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  80266a:	85 db                	test   %ebx,%ebx
+  80266c:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802671:	0f 45 c3             	cmovne %ebx,%eax
+  802674:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802677:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  80267c:	8d 46 30             	lea    0x30(%esi),%eax
+  80267f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  802682:	eb 50                	jmp    8026d4 <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  802684:	89 d1                	mov    %edx,%ecx
+  802686:	c1 f9 1f             	sar    $0x1f,%ecx
+  802689:	c1 e9 11             	shr    $0x11,%ecx
+  80268c:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  80268f:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802694:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  802696:	29 d3                	sub    %edx,%ebx
+  802698:	ba 00 80 00 00       	mov    $0x8000,%edx
+  80269d:	29 c2                	sub    %eax,%edx
+  80269f:	39 d3                	cmp    %edx,%ebx
+  8026a1:	0f 47 da             	cmova  %edx,%ebx
+  8026a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8026a7:	29 fa                	sub    %edi,%edx
+  8026a9:	39 d3                	cmp    %edx,%ebx
+  8026ab:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  8026ae:	83 ec 04             	sub    $0x4,%esp
+  8026b1:	53                   	push   %ebx
+  8026b2:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8026b5:	01 c8                	add    %ecx,%eax
+  8026b7:	50                   	push   %eax
+  8026b8:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8026bb:	01 f8                	add    %edi,%eax
+  8026bd:	50                   	push   %eax
+  8026be:	e8 26 e3 ff ff       	call   8009e9 <memcpy>
+    i += m;
+  8026c3:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  8026c5:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8026c7:	89 f2                	mov    %esi,%edx
+  8026c9:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8026cc:	e8 03 fd ff ff       	call   8023d4 <pipe_wakeup>
+  8026d1:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  8026d4:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  8026d7:	73 51                	jae    80272a <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  8026d9:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  8026dc:	8b 16                	mov    (%esi),%edx
+  8026de:	39 da                	cmp    %ebx,%edx
+  8026e0:	75 a2                	jne    802684 <devpipe_read_bulk+0x36>
+      if (i > 0)
+  8026e2:	85 ff                	test   %edi,%edi
+  8026e4:	75 44                	jne    80272a <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  8026e6:	89 f2                	mov    %esi,%edx
+  8026e8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8026eb:	e8 90 fd ff ff       	call   802480 <_pipeisclosed>
+  8026f0:	85 c0                	test   %eax,%eax
+  8026f2:	75 3a                	jne    80272e <devpipe_read_bulk+0xe0>
+  8026f4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8026f9:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  8026fd:	6a 64                	push   $0x64
+  8026ff:	ff 75 d4             	push   -0x2c(%ebp)
+  802702:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  802703:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802706:	50                   	push   %eax
+  802707:	e8 5d e8 ff ff       	call   800f69 <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  80270c:	85 c0                	test   %eax,%eax
+  80270e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802713:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  802716:	83 c4 10             	add    $0x10,%esp
+  802719:	a8 01                	test   $0x1,%al
+  80271b:	74 b7                	je     8026d4 <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  80271d:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  802722:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802725:	5b                   	pop    %ebx
+  802726:	5e                   	pop    %esi
+  802727:	5f                   	pop    %edi
+  802728:	5d                   	pop    %ebp
+  802729:	c3                   	ret
+  return i;
+  80272a:	89 f8                	mov    %edi,%eax
+  80272c:	eb f4                	jmp    802722 <devpipe_read_bulk+0xd4>
+        return 0;
+  80272e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802733:	eb ed                	jmp    802722 <devpipe_read_bulk+0xd4>
+
+00802735 <devpipe_read>:
+{
+  802735:	55                   	push   %ebp
+  802736:	89 e5                	mov    %esp,%ebp
+  802738:	57                   	push   %edi
+  802739:	56                   	push   %esi
+  80273a:	53                   	push   %ebx
+  80273b:	83 ec 18             	sub    $0x18,%esp
+  80273e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  802741:	57                   	push   %edi
+  802742:	e8 f7 ea ff ff       	call   80123e <fd2data>
+  802747:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  802749:	8b 70 28             	mov    0x28(%eax),%esi
+  80274c:	83 c4 10             	add    $0x10,%esp
+  80274f:	85 f6                	test   %esi,%esi
+  802751:	75 24                	jne    802777 <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  802753:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802756:	74 60                	je     8027b8 <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  802758:	8b 03                	mov    (%ebx),%eax
+  80275a:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80275d:	75 3b                	jne    80279a <devpipe_read+0x65>
+      if (i > 0)
+  80275f:	85 f6                	test   %esi,%esi
+  802761:	75 2d                	jne    802790 <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  802763:	89 da                	mov    %ebx,%edx
+  802765:	89 f8                	mov    %edi,%eax
+  802767:	e8 14 fd ff ff       	call   802480 <_pipeisclosed>
+  80276c:	85 c0                	test   %eax,%eax
+  80276e:	75 4c                	jne    8027bc <devpipe_read+0x87>
+      sys_yield();
+  802770:	e8 59 e4 ff ff       	call   800bce <sys_yield>
+  802775:	eb e1                	jmp    802758 <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  802777:	83 ec 08             	sub    $0x8,%esp
+  80277a:	6a 00                	push   $0x0
+  80277c:	ff 75 10             	push   0x10(%ebp)
+  80277f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802782:	89 c2                	mov    %eax,%edx
+  802784:	89 f8                	mov    %edi,%eax
+  802786:	e8 c3 fe ff ff       	call   80264e <devpipe_read_bulk>
+  80278b:	83 c4 10             	add    $0x10,%esp
+  80278e:	eb 02                	jmp    802792 <devpipe_read+0x5d>
+        return i;
+  802790:	89 f0                	mov    %esi,%eax
+}
+  802792:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802795:	5b                   	pop    %ebx
+  802796:	5e                   	pop    %esi
+  802797:	5f                   	pop    %edi
+  802798:	5d                   	pop    %ebp
+  802799:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80279a:	99                   	cltd
+  80279b:	c1 ea 1b             	shr    $0x1b,%edx
+  80279e:	01 d0                	add    %edx,%eax
+  8027a0:	83 e0 1f             	and    $0x1f,%eax
+  8027a3:	29 d0                	sub    %edx,%eax
+  8027a5:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8027aa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8027ad:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  8027b0:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  8027b3:	83 c6 01             	add    $0x1,%esi
+  8027b6:	eb 9b                	jmp    802753 <devpipe_read+0x1e>
+  return i;
+  8027b8:	89 f0                	mov    %esi,%eax
+  8027ba:	eb d6                	jmp    802792 <devpipe_read+0x5d>
+        return 0;
+  8027bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027c1:	eb cf                	jmp    802792 <devpipe_read+0x5d>
+
+008027c3 <pipe2>:
+{
+  8027c3:	55                   	push   %ebp
+  8027c4:	89 e5                	mov    %esp,%ebp
+  8027c6:	57                   	push   %edi
+  8027c7:	56                   	push   %esi
+  8027c8:	53                   	push   %ebx
+  8027c9:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  8027cc:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8027cf:	50                   	push   %eax
+  8027d0:	e8 7d ea ff ff       	call   801252 <fd_alloc>
+  8027d5:	89 c3                	mov    %eax,%ebx
+  8027d7:	83 c4 10             	add    $0x10,%esp
+  8027da:	85 c0                	test   %eax,%eax
+  8027dc:	0f 88 fb 01 00 00    	js     8029dd <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8027e2:	83 ec 04             	sub    $0x4,%esp
+  8027e5:	68 07 04 00 00       	push   $0x407
+  8027ea:	ff 75 e4             	push   -0x1c(%ebp)
+  8027ed:	6a 00                	push   $0x0
+  8027ef:	e8 3c e4 ff ff       	call   800c30 <sys_page_alloc>
+  8027f4:	89 c3                	mov    %eax,%ebx
+  8027f6:	83 c4 10             	add    $0x10,%esp
+  8027f9:	85 c0                	test   %eax,%eax
+  8027fb:	0f 88 dc 01 00 00    	js     8029dd <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  802801:	83 ec 0c             	sub    $0xc,%esp
+  802804:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  802807:	50                   	push   %eax
+  802808:	e8 45 ea ff ff       	call   801252 <fd_alloc>
+  80280d:	89 c3                	mov    %eax,%ebx
+  80280f:	83 c4 10             	add    $0x10,%esp
+  802812:	85 c0                	test   %eax,%eax
+  802814:	0f 88 b3 01 00 00    	js     8029cd <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80281a:	83 ec 04             	sub    $0x4,%esp
+  80281d:	68 07 04 00 00       	push   $0x407
+  802822:	ff 75 e0             	push   -0x20(%ebp)
+  802825:	6a 00                	push   $0x0
+  802827:	e8 04 e4 ff ff       	call   800c30 <sys_page_alloc>
+  80282c:	89 c3                	mov    %eax,%ebx
+  80282e:	83 c4 10             	add    $0x10,%esp
+  802831:	85 c0                	test   %eax,%eax
+  802833:	0f 88 94 01 00 00    	js     8029cd <pipe2+0x20a>
+  va = fd2data(fd0);
+  802839:	83 ec 0c             	sub    $0xc,%esp
+  80283c:	ff 75 e4             	push   -0x1c(%ebp)
+  80283f:	e8 fa e9 ff ff       	call   80123e <fd2data>
+  802844:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802846:	83 c4 0c             	add    $0xc,%esp
+  802849:	68 07 04 00 00       	push   $0x407
+  80284e:	50                   	push   %eax
+  80284f:	6a 00                	push   $0x0
+  802851:	e8 da e3 ff ff       	call   800c30 <sys_page_alloc>
+  802856:	89 c3                	mov    %eax,%ebx
+  802858:	83 c4 10             	add    $0x10,%esp
+  80285b:	85 c0                	test   %eax,%eax
+  80285d:	0f 88 5a 01 00 00    	js     8029bd <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802863:	83 ec 0c             	sub    $0xc,%esp
+  802866:	ff 75 e0             	push   -0x20(%ebp)
+  802869:	e8 d0 e9 ff ff       	call   80123e <fd2data>
+  80286e:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802875:	50                   	push   %eax
+  802876:	6a 00                	push   $0x0
+  802878:	57                   	push   %edi
+  802879:	6a 00                	push   $0x0
+  80287b:	e8 f3 e3 ff ff       	call   800c73 <sys_page_map>
+  802880:	89 c3                	mov    %eax,%ebx
+  802882:	83 c4 20             	add    $0x20,%esp
+  802885:	85 c0                	test   %eax,%eax
+  802887:	0f 88 22 01 00 00    	js     8029af <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  80288d:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  802891:	74 72                	je     802905 <pipe2+0x142>
+  802893:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  802898:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80289b:	e8 d3 fa ff ff       	call   802373 <pipe_ring>
+  8028a0:	83 ec 04             	sub    $0x4,%esp
+  8028a3:	68 07 04 00 00       	push   $0x407
+  8028a8:	01 f0                	add    %esi,%eax
+  8028aa:	50                   	push   %eax
+  8028ab:	6a 00                	push   $0x0
+  8028ad:	e8 7e e3 ff ff       	call   800c30 <sys_page_alloc>
+  8028b2:	89 c3                	mov    %eax,%ebx
+  8028b4:	83 c4 10             	add    $0x10,%esp
+  8028b7:	85 c0                	test   %eax,%eax
+  8028b9:	0f 88 97 00 00 00    	js     802956 <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  8028bf:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8028c2:	e8 ac fa ff ff       	call   802373 <pipe_ring>
+  8028c7:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  8028ca:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8028cd:	e8 a1 fa ff ff       	call   802373 <pipe_ring>
+  8028d2:	83 ec 0c             	sub    $0xc,%esp
+  8028d5:	68 07 04 00 00       	push   $0x407
+  8028da:	53                   	push   %ebx
+  8028db:	6a 00                	push   $0x0
+  8028dd:	01 f0                	add    %esi,%eax
+  8028df:	50                   	push   %eax
+  8028e0:	6a 00                	push   $0x0
+  8028e2:	e8 8c e3 ff ff       	call   800c73 <sys_page_map>
+  8028e7:	89 c3                	mov    %eax,%ebx
+  8028e9:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8028ef:	83 c4 20             	add    $0x20,%esp
+  8028f2:	85 c0                	test   %eax,%eax
+  8028f4:	78 60                	js     802956 <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  8028f6:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  8028fc:	75 9a                	jne    802898 <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  8028fe:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  802905:	a1 20 40 80 00       	mov    0x804020,%eax
+  80290a:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80290d:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  80290f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802912:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  802919:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80291c:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  80291e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802921:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  802928:	83 ec 0c             	sub    $0xc,%esp
+  80292b:	ff 75 e4             	push   -0x1c(%ebp)
+  80292e:	e8 fb e8 ff ff       	call   80122e <fd2num>
+  802933:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802936:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  802938:	83 c4 04             	add    $0x4,%esp
+  80293b:	ff 75 e0             	push   -0x20(%ebp)
+  80293e:	e8 eb e8 ff ff       	call   80122e <fd2num>
+  802943:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802946:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  802949:	83 c4 10             	add    $0x10,%esp
+  80294c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802951:	e9 87 00 00 00       	jmp    8029dd <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802956:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  80295b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80295e:	e8 10 fa ff ff       	call   802373 <pipe_ring>
+  802963:	83 ec 08             	sub    $0x8,%esp
+  802966:	01 f0                	add    %esi,%eax
+  802968:	50                   	push   %eax
+  802969:	6a 00                	push   $0x0
+  80296b:	e8 45 e3 ff ff       	call   800cb5 <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  802970:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802973:	e8 fb f9 ff ff       	call   802373 <pipe_ring>
+  802978:	83 c4 08             	add    $0x8,%esp
+  80297b:	01 f0                	add    %esi,%eax
+  80297d:	50                   	push   %eax
+  80297e:	6a 00                	push   $0x0
+  802980:	e8 30 e3 ff ff       	call   800cb5 <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802985:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80298b:	83 c4 10             	add    $0x10,%esp
+  80298e:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802994:	75 c5                	jne    80295b <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  802996:	83 ec 0c             	sub    $0xc,%esp
+  802999:	ff 75 e0             	push   -0x20(%ebp)
+  80299c:	e8 9d e8 ff ff       	call   80123e <fd2data>
+  8029a1:	83 c4 08             	add    $0x8,%esp
+  8029a4:	50                   	push   %eax
+  8029a5:	6a 00                	push   $0x0
+  8029a7:	e8 09 e3 ff ff       	call   800cb5 <sys_page_unmap>
+  8029ac:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  8029af:	83 ec 08             	sub    $0x8,%esp
+  8029b2:	57                   	push   %edi
+  8029b3:	6a 00                	push   $0x0
+  8029b5:	e8 fb e2 ff ff       	call   800cb5 <sys_page_unmap>
+  8029ba:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  8029bd:	83 ec 08             	sub    $0x8,%esp
+  8029c0:	ff 75 e0             	push   -0x20(%ebp)
+  8029c3:	6a 00                	push   $0x0
+  8029c5:	e8 eb e2 ff ff       	call   800cb5 <sys_page_unmap>
+  8029ca:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  8029cd:	83 ec 08             	sub    $0x8,%esp
+  8029d0:	ff 75 e4             	push   -0x1c(%ebp)
+  8029d3:	6a 00                	push   $0x0
+  8029d5:	e8 db e2 ff ff       	call   800cb5 <sys_page_unmap>
+  8029da:	83 c4 10             	add    $0x10,%esp
+}
+  8029dd:	89 d8                	mov    %ebx,%eax
+  8029df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029e2:	5b                   	pop    %ebx
+  8029e3:	5e                   	pop    %esi
+  8029e4:	5f                   	pop    %edi
+  8029e5:	5d                   	pop    %ebp
+  8029e6:	c3                   	ret
+
+008029e7 <pipe>:
+{
+  8029e7:	55                   	push   %ebp
+  8029e8:	89 e5                	mov    %esp,%ebp
+  8029ea:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  8029ed:	6a 00                	push   $0x0
+  8029ef:	ff 75 08             	push   0x8(%ebp)
+  8029f2:	e8 cc fd ff ff       	call   8027c3 <pipe2>
+}
+  8029f7:	c9                   	leave
+  8029f8:	c3                   	ret
+
+008029f9 <pipeisclosed>:
+{
+  8029f9:	55                   	push   %ebp
+  8029fa:	89 e5                	mov    %esp,%ebp
+  8029fc:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8029ff:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a02:	50                   	push   %eax
+  802a03:	ff 75 08             	push   0x8(%ebp)
+  802a06:	e8 9d e8 ff ff       	call   8012a8 <fd_lookup>
+  802a0b:	83 c4 10             	add    $0x10,%esp
+  802a0e:	85 c0                	test   %eax,%eax
+  802a10:	78 18                	js     802a2a <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  802a12:	83 ec 0c             	sub    $0xc,%esp
+  802a15:	ff 75 f4             	push   -0xc(%ebp)
+  802a18:	e8 21 e8 ff ff       	call   80123e <fd2data>
+  802a1d:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  802a1f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a22:	e8 59 fa ff ff       	call   802480 <_pipeisclosed>
+  802a27:	83 c4 10             	add    $0x10,%esp
+}
+  802a2a:	c9                   	leave
+  802a2b:	c3                   	ret
+
+00802a2c <pipe_splice>:
+{
+  802a2c:	55                   	push   %ebp
+  802a2d:	89 e5                	mov    %esp,%ebp
+  802a2f:	57                   	push   %edi
+  802a30:	56                   	push   %esi
+  802a31:	53                   	push   %ebx
+  802a32:	83 ec 34             	sub    $0x34,%esp
+  802a35:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802a38:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802a3b:	50                   	push   %eax
+  802a3c:	ff 75 08             	push   0x8(%ebp)
+  802a3f:	e8 64 e8 ff ff       	call   8012a8 <fd_lookup>
+  802a44:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802a47:	83 c4 10             	add    $0x10,%esp
+  802a4a:	85 c0                	test   %eax,%eax
+  802a4c:	0f 88 d7 00 00 00    	js     802b29 <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  802a52:	83 ec 0c             	sub    $0xc,%esp
+  802a55:	ff 75 e4             	push   -0x1c(%ebp)
+  802a58:	e8 e1 e7 ff ff       	call   80123e <fd2data>
+  802a5d:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802a5f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802a62:	83 c4 10             	add    $0x10,%esp
+  802a65:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802a6b:	39 10                	cmp    %edx,(%eax)
+  802a6d:	0f 85 c1 00 00 00    	jne    802b34 <pipe_splice+0x108>
+  802a73:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  802a77:	0f 84 c0 00 00 00    	je     802b3d <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  802a7d:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802a81:	0f 84 bf 00 00 00    	je     802b46 <pipe_splice+0x11a>
+  802a87:	89 f7                	mov    %esi,%edi
+  802a89:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  802a8f:	0f 85 ba 00 00 00    	jne    802b4f <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802a95:	8d 43 04             	lea    0x4(%ebx),%eax
+  802a98:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802a9b:	eb 38                	jmp    802ad5 <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802a9d:	83 ec 0c             	sub    $0xc,%esp
+  802aa0:	68 00 10 00 00       	push   $0x1000
+  802aa5:	89 f1                	mov    %esi,%ecx
+  802aa7:	89 da                	mov    %ebx,%edx
+  802aa9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802aac:	e8 34 fa ff ff       	call   8024e5 <devpipe_write_bulk>
+  802ab1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802ab4:	83 c4 10             	add    $0x10,%esp
+  802ab7:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802abc:	75 53                	jne    802b11 <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  802abe:	83 ec 08             	sub    $0x8,%esp
+  802ac1:	56                   	push   %esi
+  802ac2:	6a 00                	push   $0x0
+  802ac4:	e8 ec e1 ff ff       	call   800cb5 <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  802ac9:	83 c7 01             	add    $0x1,%edi
+  802acc:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802ad2:	83 c4 10             	add    $0x10,%esp
+  802ad5:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802ad8:	74 3a                	je     802b14 <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  802ada:	8b 03                	mov    (%ebx),%eax
+  802adc:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802adf:	75 bc                	jne    802a9d <pipe_splice+0x71>
+  802ae1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ae6:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  802aea:	85 c0                	test   %eax,%eax
+  802aec:	74 af                	je     802a9d <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802aee:	83 ec 04             	sub    $0x4,%esp
+  802af1:	6a 07                	push   $0x7
+  802af3:	56                   	push   %esi
+  802af4:	ff 75 d0             	push   -0x30(%ebp)
+  802af7:	e8 90 e4 ff ff       	call   800f8c <sys_chan_wakeup>
+  802afc:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802aff:	83 c4 10             	add    $0x10,%esp
+  802b02:	85 c0                	test   %eax,%eax
+  802b04:	79 b8                	jns    802abe <pipe_splice+0x92>
+  802b06:	b8 01 00 00 00       	mov    $0x1,%eax
+  802b0b:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802b0f:	eb 8c                	jmp    802a9d <pipe_splice+0x71>
+  802b11:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  802b14:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802b18:	75 06                	jne    802b20 <pipe_splice+0xf4>
+  802b1a:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802b1e:	78 09                	js     802b29 <pipe_splice+0xfd>
+  return i * PGSIZE;
+  802b20:	8b 45 10             	mov    0x10(%ebp),%eax
+  802b23:	c1 e0 0c             	shl    $0xc,%eax
+  802b26:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  802b29:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802b2c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b2f:	5b                   	pop    %ebx
+  802b30:	5e                   	pop    %esi
+  802b31:	5f                   	pop    %edi
+  802b32:	5d                   	pop    %ebp
+  802b33:	c3                   	ret
+    return -E_INVAL;
+  802b34:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802b3b:	eb ec                	jmp    802b29 <pipe_splice+0xfd>
+  802b3d:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802b44:	eb e3                	jmp    802b29 <pipe_splice+0xfd>
+  802b46:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802b4d:	eb da                	jmp    802b29 <pipe_splice+0xfd>
+  802b4f:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802b56:	eb d1                	jmp    802b29 <pipe_splice+0xfd>
+
+00802b58 <pipe_splice_read>:
+{
+  802b58:	55                   	push   %ebp
+  802b59:	89 e5                	mov    %esp,%ebp
+  802b5b:	53                   	push   %ebx
+  802b5c:	83 ec 1c             	sub    $0x1c,%esp
+  802b5f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802b62:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b65:	50                   	push   %eax
+  802b66:	ff 75 08             	push   0x8(%ebp)
+  802b69:	e8 3a e7 ff ff       	call   8012a8 <fd_lookup>
+  802b6e:	83 c4 10             	add    $0x10,%esp
+  802b71:	85 c0                	test   %eax,%eax
+  802b73:	78 49                	js     802bbe <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  802b75:	83 ec 0c             	sub    $0xc,%esp
+  802b78:	ff 75 f4             	push   -0xc(%ebp)
+  802b7b:	e8 be e6 ff ff       	call   80123e <fd2data>
+  802b80:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802b82:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b85:	83 c4 10             	add    $0x10,%esp
+  802b88:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  802b8e:	39 08                	cmp    %ecx,(%eax)
+  802b90:	75 31                	jne    802bc3 <pipe_splice_read+0x6b>
+  802b92:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  802b96:	74 32                	je     802bca <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  802b98:	8b 48 08             	mov    0x8(%eax),%ecx
+  802b9b:	83 e1 03             	and    $0x3,%ecx
+  802b9e:	83 f9 01             	cmp    $0x1,%ecx
+  802ba1:	74 2e                	je     802bd1 <pipe_splice_read+0x79>
+  802ba3:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  802ba9:	75 2d                	jne    802bd8 <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  802bab:	83 ec 08             	sub    $0x8,%esp
+  802bae:	53                   	push   %ebx
+  802baf:	68 00 10 00 00       	push   $0x1000
+  802bb4:	89 d9                	mov    %ebx,%ecx
+  802bb6:	e8 93 fa ff ff       	call   80264e <devpipe_read_bulk>
+  802bbb:	83 c4 10             	add    $0x10,%esp
+}
+  802bbe:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802bc1:	c9                   	leave
+  802bc2:	c3                   	ret
+    return -E_INVAL;
+  802bc3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802bc8:	eb f4                	jmp    802bbe <pipe_splice_read+0x66>
+  802bca:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802bcf:	eb ed                	jmp    802bbe <pipe_splice_read+0x66>
+  802bd1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802bd6:	eb e6                	jmp    802bbe <pipe_splice_read+0x66>
+  802bd8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802bdd:	eb df                	jmp    802bbe <pipe_splice_read+0x66>
+
+00802bdf <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  802bdf:	b8 00 00 00 00       	mov    $0x0,%eax
+  802be4:	c3                   	ret
+
+00802be5 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802be5:	55                   	push   %ebp
+  802be6:	89 e5                	mov    %esp,%ebp
+  802be8:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  802beb:	68 27 36 80 00       	push   $0x803627
+  802bf0:	ff 75 0c             	push   0xc(%ebp)
+  802bf3:	e8 09 dc ff ff       	call   800801 <strcpy>
+  return 0;
+}
+  802bf8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bfd:	c9                   	leave
+  802bfe:	c3                   	ret
+
+00802bff <devcons_write>:
+{
+  802bff:	55                   	push   %ebp
+  802c00:	89 e5                	mov    %esp,%ebp
+  802c02:	57                   	push   %edi
+  802c03:	56                   	push   %esi
+  802c04:	53                   	push   %ebx
+  802c05:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  802c0b:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  802c10:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  802c16:	eb 2e                	jmp    802c46 <devcons_write+0x47>
+    m = n - tot;
+  802c18:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802c1b:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  802c1d:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802c22:	39 c3                	cmp    %eax,%ebx
+  802c24:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  802c27:	83 ec 04             	sub    $0x4,%esp
+  802c2a:	53                   	push   %ebx
+  802c2b:	89 f0                	mov    %esi,%eax
+  802c2d:	03 45 0c             	add    0xc(%ebp),%eax
+  802c30:	50                   	push   %eax
+  802c31:	57                   	push   %edi
+  802c32:	e8 50 dd ff ff       	call   800987 <memmove>
+    sys_cputs(buf, m);
+  802c37:	83 c4 08             	add    $0x8,%esp
+  802c3a:	53                   	push   %ebx
+  802c3b:	57                   	push   %edi
+  802c3c:	e8 f0 de ff ff       	call   800b31 <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  802c41:	01 de                	add    %ebx,%esi
+  802c43:	83 c4 10             	add    $0x10,%esp
+  802c46:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802c49:	72 cd                	jb     802c18 <devcons_write+0x19>
+}
+  802c4b:	89 f0                	mov    %esi,%eax
+  802c4d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c50:	5b                   	pop    %ebx
+  802c51:	5e                   	pop    %esi
+  802c52:	5f                   	pop    %edi
+  802c53:	5d                   	pop    %ebp
+  802c54:	c3                   	ret
+
+00802c55 <devcons_read>:
+{
+  802c55:	55                   	push   %ebp
+  802c56:	89 e5                	mov    %esp,%ebp
+  802c58:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  802c5b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c60:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802c64:	75 07                	jne    802c6d <devcons_read+0x18>
+  802c66:	eb 1f                	jmp    802c87 <devcons_read+0x32>
+    sys_yield();
+  802c68:	e8 61 df ff ff       	call   800bce <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  802c6d:	e8 dd de ff ff       	call   800b4f <sys_cgetc>
+  802c72:	85 c0                	test   %eax,%eax
+  802c74:	74 f2                	je     802c68 <devcons_read+0x13>
+  if (c < 0)
+  802c76:	78 0f                	js     802c87 <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  802c78:	83 f8 04             	cmp    $0x4,%eax
+  802c7b:	74 0c                	je     802c89 <devcons_read+0x34>
+  *(char*)vbuf = c;
+  802c7d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802c80:	88 02                	mov    %al,(%edx)
+  return 1;
+  802c82:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802c87:	c9                   	leave
+  802c88:	c3                   	ret
+    return 0;
+  802c89:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c8e:	eb f7                	jmp    802c87 <devcons_read+0x32>
+
+00802c90 <cputchar>:
+{
+  802c90:	55                   	push   %ebp
+  802c91:	89 e5                	mov    %esp,%ebp
+  802c93:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  802c96:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c99:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  802c9c:	6a 01                	push   $0x1
+  802c9e:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802ca1:	50                   	push   %eax
+  802ca2:	e8 8a de ff ff       	call   800b31 <sys_cputs>
+}
+  802ca7:	83 c4 10             	add    $0x10,%esp
+  802caa:	c9                   	leave
+  802cab:	c3                   	ret
+
+00802cac <getchar>:
+{
+  802cac:	55                   	push   %ebp
+  802cad:	89 e5                	mov    %esp,%ebp
+  802caf:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  802cb2:	6a 01                	push   $0x1
+  802cb4:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802cb7:	50                   	push   %eax
+  802cb8:	6a 00                	push   $0x0
+  802cba:	e8 94 e8 ff ff       	call   801553 <read>
+  if (r < 0)
+  802cbf:	83 c4 10             	add    $0x10,%esp
+  802cc2:	85 c0                	test   %eax,%eax
+  802cc4:	78 06                	js     802ccc <getchar+0x20>
+  if (r < 1)
+  802cc6:	74 06                	je     802cce <getchar+0x22>
+  return c;
+  802cc8:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802ccc:	c9                   	leave
+  802ccd:	c3                   	ret
+    return -E_EOF;
+  802cce:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802cd3:	eb f7                	jmp    802ccc <getchar+0x20>
+
+00802cd5 <iscons>:
+{
+  802cd5:	55                   	push   %ebp
+  802cd6:	89 e5                	mov    %esp,%ebp
+  802cd8:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802cdb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802cde:	50                   	push   %eax
+  802cdf:	ff 75 08             	push   0x8(%ebp)
+  802ce2:	e8 c1 e5 ff ff       	call   8012a8 <fd_lookup>
+  802ce7:	83 c4 10             	add    $0x10,%esp
+  802cea:	85 c0                	test   %eax,%eax
+  802cec:	78 11                	js     802cff <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  802cee:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802cf1:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802cf7:	39 10                	cmp    %edx,(%eax)
+  802cf9:	0f 94 c0             	sete   %al
+  802cfc:	0f b6 c0             	movzbl %al,%eax
+}
+  802cff:	c9                   	leave
+  802d00:	c3                   	ret
+
+00802d01 <opencons>:
+{
+  802d01:	55                   	push   %ebp
+  802d02:	89 e5                	mov    %esp,%ebp
+  802d04:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  802d07:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802d0a:	50                   	push   %eax
+  802d0b:	e8 42 e5 ff ff       	call   801252 <fd_alloc>
+  802d10:	83 c4 10             	add    $0x10,%esp
+  802d13:	85 c0                	test   %eax,%eax
+  802d15:	78 3a                	js     802d51 <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802d17:	83 ec 04             	sub    $0x4,%esp
+  802d1a:	68 07 04 00 00       	push   $0x407
+  802d1f:	ff 75 f4             	push   -0xc(%ebp)
+  802d22:	6a 00                	push   $0x0
+  802d24:	e8 07 df ff ff       	call   800c30 <sys_page_alloc>
+  802d29:	83 c4 10             	add    $0x10,%esp
+  802d2c:	85 c0                	test   %eax,%eax
+  802d2e:	78 21                	js     802d51 <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  802d30:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802d33:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802d39:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  802d3b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802d3e:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  802d45:	83 ec 0c             	sub    $0xc,%esp
+  802d48:	50                   	push   %eax
+  802d49:	e8 e0 e4 ff ff       	call   80122e <fd2num>
+  802d4e:	83 c4 10             	add    $0x10,%esp
+}
+  802d51:	c9                   	leave
+  802d52:	c3                   	ret
+
+00802d53 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  802d53:	55                   	push   %ebp
+  802d54:	89 e5                	mov    %esp,%ebp
+  802d56:	56                   	push   %esi
+  802d57:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  802d58:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  802d5b:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  802d61:	e8 49 de ff ff       	call   800baf <sys_getenvid>
+  802d66:	83 ec 0c             	sub    $0xc,%esp
+  802d69:	ff 75 0c             	push   0xc(%ebp)
+  802d6c:	ff 75 08             	push   0x8(%ebp)
+  802d6f:	56                   	push   %esi
+  802d70:	50                   	push   %eax
+  802d71:	68 34 36 80 00       	push   $0x803634
+  802d76:	e8 98 d4 ff ff       	call   800213 <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  802d7b:	83 c4 18             	add    $0x18,%esp
+  802d7e:	53                   	push   %ebx
+  802d7f:	ff 75 10             	push   0x10(%ebp)
+  802d82:	e8 3b d4 ff ff       	call   8001c2 <vcprintf>
+  cprintf("\n");
+  802d87:	c7 04 24 90 31 80 00 	movl   $0x803190,(%esp)
+  802d8e:	e8 80 d4 ff ff       	call   800213 <cprintf>
+  802d93:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  802d96:	cc                   	int3
+  while (1)
+  802d97:	eb fd                	jmp    802d96 <_panic+0x43>
+
+00802d99 <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  802d99:	55                   	push   %ebp
+  802d9a:	89 e5                	mov    %esp,%ebp
+  802d9c:	57                   	push   %edi
+  802d9d:	56                   	push   %esi
+  802d9e:	53                   	push   %ebx
+  802d9f:	83 ec 14             	sub    $0x14,%esp
+  802da2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802da5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802da8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802dab:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  802dae:	85 c0                	test   %eax,%eax
+  802db0:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802db5:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  802db8:	ff 33                	push   (%ebx)
+  802dba:	50                   	push   %eax
+  802dbb:	e8 48 e1 ff ff       	call   800f08 <sys_ipc_recv>
+  802dc0:	83 c4 10             	add    $0x10,%esp
+  802dc3:	85 c0                	test   %eax,%eax
+  802dc5:	78 39                	js     802e00 <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  802dc7:	85 ff                	test   %edi,%edi
+  802dc9:	74 0a                	je     802dd5 <ipc_recv_pages+0x3c>
+  802dcb:	a1 44 57 80 00       	mov    0x805744,%eax
+  802dd0:	8b 40 7c             	mov    0x7c(%eax),%eax
+  802dd3:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  802dd5:	85 f6                	test   %esi,%esi
+  802dd7:	74 0d                	je     802de6 <ipc_recv_pages+0x4d>
+  802dd9:	a1 44 57 80 00       	mov    0x805744,%eax
+  802dde:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  802de4:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  802de6:	a1 44 57 80 00       	mov    0x805744,%eax
+  802deb:	8b 40 74             	mov    0x74(%eax),%eax
+  802dee:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  802df0:	a1 44 57 80 00       	mov    0x805744,%eax
+  802df5:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  802df8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802dfb:	5b                   	pop    %ebx
+  802dfc:	5e                   	pop    %esi
+  802dfd:	5f                   	pop    %edi
+  802dfe:	5d                   	pop    %ebp
+  802dff:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  802e00:	85 ff                	test   %edi,%edi
+  802e02:	74 06                	je     802e0a <ipc_recv_pages+0x71>
+  802e04:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  802e0a:	85 f6                	test   %esi,%esi
+  802e0c:	74 06                	je     802e14 <ipc_recv_pages+0x7b>
+  802e0e:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  802e14:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  802e1a:	eb dc                	jmp    802df8 <ipc_recv_pages+0x5f>
+
+00802e1c <ipc_recv>:
+{
+  802e1c:	55                   	push   %ebp
+  802e1d:	89 e5                	mov    %esp,%ebp
+  802e1f:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  802e22:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  802e29:	ff 75 10             	push   0x10(%ebp)
+  802e2c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802e2f:	50                   	push   %eax
+  802e30:	ff 75 0c             	push   0xc(%ebp)
+  802e33:	ff 75 08             	push   0x8(%ebp)
+  802e36:	e8 5e ff ff ff       	call   802d99 <ipc_recv_pages>
+}
+  802e3b:	c9                   	leave
+  802e3c:	c3                   	ret
+
+00802e3d <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  802e3d:	55                   	push   %ebp
+  802e3e:	89 e5                	mov    %esp,%ebp
+  802e40:	57                   	push   %edi
+  802e41:	56                   	push   %esi
+  802e42:	53                   	push   %ebx
+  802e43:	83 ec 0c             	sub    $0xc,%esp
+  802e46:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802e49:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802e4c:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  802e4f:	89 c3                	mov    %eax,%ebx
+  802e51:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  802e57:	85 c0                	test   %eax,%eax
+  802e59:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802e5e:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  802e61:	83 ec 0c             	sub    $0xc,%esp
+  802e64:	ff 75 14             	push   0x14(%ebp)
+  802e67:	ff 75 18             	push   0x18(%ebp)
+  802e6a:	53                   	push   %ebx
+  802e6b:	56                   	push   %esi
+  802e6c:	57                   	push   %edi
+  802e6d:	e8 75 e0 ff ff       	call   800ee7 <sys_ipc_try_send>
+  802e72:	83 c4 20             	add    $0x20,%esp
+  802e75:	85 c0                	test   %eax,%eax
+  802e77:	79 1e                	jns    802e97 <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  802e79:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802e7c:	75 07                	jne    802e85 <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  802e7e:	e8 4b dd ff ff       	call   800bce <sys_yield>
+  802e83:	eb dc                	jmp    802e61 <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  802e85:	50                   	push   %eax
+  802e86:	68 57 36 80 00       	push   $0x803657
+  802e8b:	6a 5c                	push   $0x5c
+  802e8d:	68 64 36 80 00       	push   $0x803664
+  802e92:	e8 bc fe ff ff       	call   802d53 <_panic>
+  }
+}
+  802e97:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e9a:	5b                   	pop    %ebx
+  802e9b:	5e                   	pop    %esi
+  802e9c:	5f                   	pop    %edi
+  802e9d:	5d                   	pop    %ebp
+  802e9e:	c3                   	ret
+
+00802e9f <ipc_send>:
+{
+  802e9f:	55                   	push   %ebp
+  802ea0:	89 e5                	mov    %esp,%ebp
+  802ea2:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  802ea5:	ff 75 14             	push   0x14(%ebp)
+  802ea8:	6a 01                	push   $0x1
+  802eaa:	ff 75 10             	push   0x10(%ebp)
+  802ead:	ff 75 0c             	push   0xc(%ebp)
+  802eb0:	ff 75 08             	push   0x8(%ebp)
+  802eb3:	e8 85 ff ff ff       	call   802e3d <ipc_send_pages>
+}
+  802eb8:	83 c4 20             	add    $0x20,%esp
+  802ebb:	c9                   	leave
+  802ebc:	c3                   	ret
+
+00802ebd <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802ebd:	55                   	push   %ebp
+  802ebe:	89 e5                	mov    %esp,%ebp
+  802ec0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  802ec3:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  802ec8:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802ecb:	c1 e0 04             	shl    $0x4,%eax
+  802ece:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802ed3:	8b 40 50             	mov    0x50(%eax),%eax
+  802ed6:	39 c8                	cmp    %ecx,%eax
+  802ed8:	74 12                	je     802eec <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  802eda:	83 c2 01             	add    $0x1,%edx
+  802edd:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802ee3:	75 e3                	jne    802ec8 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  802ee5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802eea:	eb 0e                	jmp    802efa <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  802eec:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802eef:	c1 e0 04             	shl    $0x4,%eax
+  802ef2:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802ef7:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802efa:	5d                   	pop    %ebp
+  802efb:	c3                   	ret
+
+00802efc <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802efc:	55                   	push   %ebp
+  802efd:	89 e5                	mov    %esp,%ebp
+  802eff:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802f02:	89 c2                	mov    %eax,%edx
+  802f04:	c1 ea 16             	shr    $0x16,%edx
+  802f07:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  802f0e:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802f13:	f6 c1 01             	test   $0x1,%cl
+  802f16:	74 1c                	je     802f34 <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  802f18:	c1 e8 0c             	shr    $0xc,%eax
+  802f1b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  802f22:	a8 01                	test   $0x1,%al
+  802f24:	74 0e                	je     802f34 <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  802f26:	c1 e8 0c             	shr    $0xc,%eax
+  802f29:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802f30:	ef 
+  802f31:	0f b7 d2             	movzwl %dx,%edx
+}
+  802f34:	89 d0                	mov    %edx,%eax
+  802f36:	5d                   	pop    %ebp
+  802f37:	c3                   	ret
+
+00802f38 <udivmod>:
+  802f38:	55                   	push   %ebp
+  802f39:	57                   	push   %edi
+  802f3a:	56                   	push   %esi
+  802f3b:	53                   	push   %ebx
+  802f3c:	83 ec 14             	sub    $0x14,%esp
+  802f3f:	8b 74 24 28          	mov    0x28(%esp),%esi
+  802f43:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  802f47:	89 fb                	mov    %edi,%ebx
+  802f49:	09 f3                	or     %esi,%ebx
+  802f4b:	0f 84 88 00 00 00    	je     802fd9 <udivmod+0xa1>
+  802f51:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802f56:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802f5d:	00 
+  802f5e:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802f65:	00 
+  802f66:	89 cd                	mov    %ecx,%ebp
+  802f68:	89 34 24             	mov    %esi,(%esp)
+  802f6b:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802f6f:	eb 08                	jmp    802f79 <udivmod+0x41>
+  802f71:	83 ed 01             	sub    $0x1,%ebp
+  802f74:	83 fd ff             	cmp    $0xffffffff,%ebp
+  802f77:	74 6c                	je     802fe5 <udivmod+0xad>
+  802f79:	89 c3                	mov    %eax,%ebx
+  802f7b:	89 d6                	mov    %edx,%esi
+  802f7d:	89 e9                	mov    %ebp,%ecx
+  802f7f:	0f ad f3             	shrd   %cl,%esi,%ebx
+  802f82:	d3 ee                	shr    %cl,%esi
+  802f84:	f6 c1 20             	test   $0x20,%cl
+  802f87:	74 04                	je     802f8d <udivmod+0x55>
+  802f89:	89 f3                	mov    %esi,%ebx
+  802f8b:	31 f6                	xor    %esi,%esi
+  802f8d:	8b 3c 24             	mov    (%esp),%edi
+  802f90:	39 fb                	cmp    %edi,%ebx
+  802f92:	89 f7                	mov    %esi,%edi
+  802f94:	8b 1c 24             	mov    (%esp),%ebx
+  802f97:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802f9b:	19 f7                	sbb    %esi,%edi
+  802f9d:	72 d2                	jb     802f71 <udivmod+0x39>
+  802f9f:	89 f7                	mov    %esi,%edi
+  802fa1:	89 de                	mov    %ebx,%esi
+  802fa3:	89 e9                	mov    %ebp,%ecx
+  802fa5:	0f a5 f7             	shld   %cl,%esi,%edi
+  802fa8:	d3 e6                	shl    %cl,%esi
+  802faa:	f6 c1 20             	test   $0x20,%cl
+  802fad:	74 04                	je     802fb3 <udivmod+0x7b>
+  802faf:	89 f7                	mov    %esi,%edi
+  802fb1:	31 f6                	xor    %esi,%esi
+  802fb3:	29 f0                	sub    %esi,%eax
+  802fb5:	19 fa                	sbb    %edi,%edx
+  802fb7:	be 01 00 00 00       	mov    $0x1,%esi
+  802fbc:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fc1:	0f a5 f7             	shld   %cl,%esi,%edi
+  802fc4:	d3 e6                	shl    %cl,%esi
+  802fc6:	f6 c1 20             	test   $0x20,%cl
+  802fc9:	74 04                	je     802fcf <udivmod+0x97>
+  802fcb:	89 f7                	mov    %esi,%edi
+  802fcd:	31 f6                	xor    %esi,%esi
+  802fcf:	09 74 24 08          	or     %esi,0x8(%esp)
+  802fd3:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802fd7:	eb 98                	jmp    802f71 <udivmod+0x39>
+  802fd9:	89 f0                	mov    %esi,%eax
+  802fdb:	89 fa                	mov    %edi,%edx
+  802fdd:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802fe1:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802fe5:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802fe9:	89 01                	mov    %eax,(%ecx)
+  802feb:	89 51 04             	mov    %edx,0x4(%ecx)
+  802fee:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802ff2:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802ff6:	83 c4 14             	add    $0x14,%esp
+  802ff9:	5b                   	pop    %ebx
+  802ffa:	5e                   	pop    %esi
+  802ffb:	5f                   	pop    %edi
+  802ffc:	5d                   	pop    %ebp
+  802ffd:	c3                   	ret
+
+00802ffe <__udivdi3>:
+  802ffe:	83 ec 18             	sub    $0x18,%esp
+  803001:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803005:	50                   	push   %eax
+  803006:	ff 74 24 2c          	push   0x2c(%esp)
+  80300a:	ff 74 24 2c          	push   0x2c(%esp)
+  80300e:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803012:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803016:	e8 1d ff ff ff       	call   802f38 <udivmod>
+  80301b:	83 c4 24             	add    $0x24,%esp
+  80301e:	c3                   	ret
+
+0080301f <__umoddi3>:
+  80301f:	83 ec 18             	sub    $0x18,%esp
+  803022:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803026:	50                   	push   %eax
+  803027:	ff 74 24 2c          	push   0x2c(%esp)
+  80302b:	ff 74 24 2c          	push   0x2c(%esp)
+  80302f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803033:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803037:	e8 fc fe ff ff       	call   802f38 <udivmod>
+  80303c:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803040:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803044:	83 c4 24             	add    $0x24,%esp
+  803047:	c3                   	ret
+
+00803048 <__divdi3>:
+  803048:	56                   	push   %esi
+  803049:	53                   	push   %ebx
+  80304a:	83 ec 14             	sub    $0x14,%esp
+  80304d:	8b 44 24 20          	mov    0x20(%esp),%eax
+  803051:	8b 54 24 24          	mov    0x24(%esp),%edx
+  803055:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  803059:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  80305d:	85 d2                	test   %edx,%edx
+  80305f:	78 18                	js     803079 <__divdi3+0x31>
+  803061:	85 db                	test   %ebx,%ebx
+  803063:	78 3e                	js     8030a3 <__divdi3+0x5b>
+  803065:	83 ec 04             	sub    $0x4,%esp
+  803068:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80306c:	56                   	push   %esi
+  80306d:	53                   	push   %ebx
+  80306e:	51                   	push   %ecx
+  80306f:	e8 c4 fe ff ff       	call   802f38 <udivmod>
+  803074:	83 c4 10             	add    $0x10,%esp
+  803077:	eb 24                	jmp    80309d <__divdi3+0x55>
+  803079:	f7 d8                	neg    %eax
+  80307b:	83 d2 00             	adc    $0x0,%edx
+  80307e:	f7 da                	neg    %edx
+  803080:	85 db                	test   %ebx,%ebx
+  803082:	78 3a                	js     8030be <__divdi3+0x76>
+  803084:	83 ec 04             	sub    $0x4,%esp
+  803087:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80308b:	56                   	push   %esi
+  80308c:	53                   	push   %ebx
+  80308d:	51                   	push   %ecx
+  80308e:	e8 a5 fe ff ff       	call   802f38 <udivmod>
+  803093:	83 c4 10             	add    $0x10,%esp
+  803096:	f7 d8                	neg    %eax
+  803098:	83 d2 00             	adc    $0x0,%edx
+  80309b:	f7 da                	neg    %edx
+  80309d:	83 c4 14             	add    $0x14,%esp
+  8030a0:	5b                   	pop    %ebx
+  8030a1:	5e                   	pop    %esi
+  8030a2:	c3                   	ret
+  8030a3:	83 ec 04             	sub    $0x4,%esp
+  8030a6:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8030aa:	56                   	push   %esi
+  8030ab:	f7 d9                	neg    %ecx
+  8030ad:	83 d3 00             	adc    $0x0,%ebx
+  8030b0:	f7 db                	neg    %ebx
+  8030b2:	53                   	push   %ebx
+  8030b3:	51                   	push   %ecx
+  8030b4:	e8 7f fe ff ff       	call   802f38 <udivmod>
+  8030b9:	83 c4 10             	add    $0x10,%esp
+  8030bc:	eb d8                	jmp    803096 <__divdi3+0x4e>
+  8030be:	83 ec 04             	sub    $0x4,%esp
+  8030c1:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8030c5:	56                   	push   %esi
+  8030c6:	f7 d9                	neg    %ecx
+  8030c8:	83 d3 00             	adc    $0x0,%ebx
+  8030cb:	f7 db                	neg    %ebx
+  8030cd:	53                   	push   %ebx
+  8030ce:	51                   	push   %ecx
+  8030cf:	e8 64 fe ff ff       	call   802f38 <udivmod>
+  8030d4:	83 c4 10             	add    $0x10,%esp
+  8030d7:	eb c4                	jmp    80309d <__divdi3+0x55>
+
+008030d9 <__moddi3>:
+  8030d9:	55                   	push   %ebp
+  8030da:	57                   	push   %edi
+  8030db:	56                   	push   %esi
+  8030dc:	53                   	push   %ebx
+  8030dd:	83 ec 24             	sub    $0x24,%esp
+  8030e0:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8030e4:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8030e8:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  8030ec:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  8030f0:	85 d2                	test   %edx,%edx
+  8030f2:	78 3b                	js     80312f <__moddi3+0x56>
+  8030f4:	83 ec 04             	sub    $0x4,%esp
+  8030f7:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8030fb:	56                   	push   %esi
+  8030fc:	89 ce                	mov    %ecx,%esi
+  8030fe:	f7 de                	neg    %esi
+  803100:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803104:	89 de                	mov    %ebx,%esi
+  803106:	83 d6 00             	adc    $0x0,%esi
+  803109:	f7 de                	neg    %esi
+  80310b:	89 74 24 14          	mov    %esi,0x14(%esp)
+  80310f:	8b 74 24 08          	mov    0x8(%esp),%esi
+  803113:	0f 48 f1             	cmovs  %ecx,%esi
+  803116:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  80311b:	53                   	push   %ebx
+  80311c:	56                   	push   %esi
+  80311d:	e8 16 fe ff ff       	call   802f38 <udivmod>
+  803122:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803126:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80312a:	83 c4 10             	add    $0x10,%esp
+  80312d:	eb 47                	jmp    803176 <__moddi3+0x9d>
+  80312f:	f7 d8                	neg    %eax
+  803131:	83 d2 00             	adc    $0x0,%edx
+  803134:	f7 da                	neg    %edx
+  803136:	83 ec 04             	sub    $0x4,%esp
+  803139:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  80313d:	56                   	push   %esi
+  80313e:	89 cf                	mov    %ecx,%edi
+  803140:	f7 df                	neg    %edi
+  803142:	89 de                	mov    %ebx,%esi
+  803144:	83 d6 00             	adc    $0x0,%esi
+  803147:	f7 de                	neg    %esi
+  803149:	0f 49 cf             	cmovns %edi,%ecx
+  80314c:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  803150:	0f 49 de             	cmovns %esi,%ebx
+  803153:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  803157:	ff 74 24 0c          	push   0xc(%esp)
+  80315b:	ff 74 24 0c          	push   0xc(%esp)
+  80315f:	e8 d4 fd ff ff       	call   802f38 <udivmod>
+  803164:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803168:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80316c:	f7 d8                	neg    %eax
+  80316e:	83 d2 00             	adc    $0x0,%edx
+  803171:	f7 da                	neg    %edx
+  803173:	83 c4 10             	add    $0x10,%esp
+  803176:	83 c4 24             	add    $0x24,%esp
+  803179:	5b                   	pop    %ebx
+  80317a:	5e                   	pop    %esi
+  80317b:	5f                   	pop    %edi
+  80317c:	5d                   	pop    %ebp
+  80317d:	c3                   	ret
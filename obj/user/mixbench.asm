@@ -0,0 +1,8246 @@
+
+obj/user/mixbench.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 9a 04 00 00       	call   8004cb <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <mkfile>:
+
+static char buf[PGSIZE] __attribute__((aligned(PGSIZE)));
+
+static void
+mkfile(const char *path, off_t size)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 24             	sub    $0x24,%esp
+  80003c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80003f:	89 d7                	mov    %edx,%edi
+  off_t off;
+  int fd, r;
+
+  if ((fd = open(path, O_RDWR | O_CREAT | O_TRUNC)) < 0)
+  800041:	68 02 03 00 00       	push   $0x302
+  800046:	50                   	push   %eax
+  800047:	e8 7a 25 00 00       	call   8025c6 <open>
+  80004c:	89 c6                	mov    %eax,%esi
+  80004e:	83 c4 10             	add    $0x10,%esp
+  800051:	85 c0                	test   %eax,%eax
+  800053:	78 41                	js     800096 <mkfile+0x63>
+    panic("open %s: %e", path, fd);
+  for (off = 0; off < size; off += PGSIZE) {
+  800055:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80005a:	39 fb                	cmp    %edi,%ebx
+  80005c:	7d 68                	jge    8000c6 <mkfile+0x93>
+    *(int*) buf = off / PGSIZE;
+  80005e:	8d 83 ff 0f 00 00    	lea    0xfff(%ebx),%eax
+  800064:	85 db                	test   %ebx,%ebx
+  800066:	0f 49 c3             	cmovns %ebx,%eax
+  800069:	c1 f8 0c             	sar    $0xc,%eax
+  80006c:	a3 00 60 80 00       	mov    %eax,0x806000
+    if ((r = write(fd, buf, PGSIZE)) != PGSIZE)
+  800071:	83 ec 04             	sub    $0x4,%esp
+  800074:	68 00 10 00 00       	push   $0x1000
+  800079:	68 00 60 80 00       	push   $0x806000
+  80007e:	56                   	push   %esi
+  80007f:	e8 e5 1d 00 00       	call   801e69 <write>
+  800084:	83 c4 10             	add    $0x10,%esp
+  800087:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80008c:	75 20                	jne    8000ae <mkfile+0x7b>
+  for (off = 0; off < size; off += PGSIZE) {
+  80008e:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  800094:	eb c4                	jmp    80005a <mkfile+0x27>
+    panic("open %s: %e", path, fd);
+  800096:	83 ec 0c             	sub    $0xc,%esp
+  800099:	50                   	push   %eax
+  80009a:	ff 75 e4             	push   -0x1c(%ebp)
+  80009d:	68 e0 3d 80 00       	push   $0x803de0
+  8000a2:	6a 22                	push   $0x22
+  8000a4:	68 ec 3d 80 00       	push   $0x803dec
+  8000a9:	e8 8a 04 00 00       	call   800538 <_panic>
+      panic("write %s: %e", path, r);
+  8000ae:	83 ec 0c             	sub    $0xc,%esp
+  8000b1:	50                   	push   %eax
+  8000b2:	ff 75 e4             	push   -0x1c(%ebp)
+  8000b5:	68 fc 3d 80 00       	push   $0x803dfc
+  8000ba:	6a 26                	push   $0x26
+  8000bc:	68 ec 3d 80 00       	push   $0x803dec
+  8000c1:	e8 72 04 00 00       	call   800538 <_panic>
+  }
+  close(fd);
+  8000c6:	83 ec 0c             	sub    $0xc,%esp
+  8000c9:	56                   	push   %esi
+  8000ca:	e8 44 1b 00 00       	call   801c13 <close>
+}
+  8000cf:	83 c4 10             	add    $0x10,%esp
+  8000d2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000d5:	5b                   	pop    %ebx
+  8000d6:	5e                   	pop    %esi
+  8000d7:	5f                   	pop    %edi
+  8000d8:	5d                   	pop    %ebp
+  8000d9:	c3                   	ret
+
+008000da <reader>:
+
+// Read 'path' a page at a time, from the start again at its end, 'n'
+// times or until *stop if n is 0.  Returns the mean us per read.
+static unsigned
+reader(const char *path, int n)
+{
+  8000da:	55                   	push   %ebp
+  8000db:	89 e5                	mov    %esp,%ebp
+  8000dd:	57                   	push   %edi
+  8000de:	56                   	push   %esi
+  8000df:	53                   	push   %ebx
+  8000e0:	83 ec 24             	sub    $0x24,%esp
+  8000e3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8000e6:	89 d7                	mov    %edx,%edi
+  unsigned ms;
+  int fd, i, r;
+
+  if ((fd = open(path, O_RDONLY)) < 0)
+  8000e8:	6a 00                	push   $0x0
+  8000ea:	50                   	push   %eax
+  8000eb:	e8 d6 24 00 00       	call   8025c6 <open>
+  8000f0:	89 c6                	mov    %eax,%esi
+  8000f2:	83 c4 10             	add    $0x10,%esp
+  8000f5:	85 c0                	test   %eax,%eax
+  8000f7:	78 12                	js     80010b <reader+0x31>
+    panic("open %s: %e", path, fd);
+  ms = sys_time_msec();
+  8000f9:	e8 4c 12 00 00       	call   80134a <sys_time_msec>
+  8000fe:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; n ? i < n : !*stop; i++) {
+  800101:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800106:	e9 80 00 00 00       	jmp    80018b <reader+0xb1>
+    panic("open %s: %e", path, fd);
+  80010b:	83 ec 0c             	sub    $0xc,%esp
+  80010e:	50                   	push   %eax
+  80010f:	ff 75 e0             	push   -0x20(%ebp)
+  800112:	68 e0 3d 80 00       	push   $0x803de0
+  800117:	6a 34                	push   $0x34
+  800119:	68 ec 3d 80 00       	push   $0x803dec
+  80011e:	e8 15 04 00 00       	call   800538 <_panic>
+    if ((r = readn(fd, buf, PGSIZE)) == 0) {
+      seek(fd, 0);
+  800123:	83 ec 08             	sub    $0x8,%esp
+  800126:	6a 00                	push   $0x0
+  800128:	56                   	push   %esi
+  800129:	e8 bd 1d 00 00       	call   801eeb <seek>
+      r = readn(fd, buf, PGSIZE);
+  80012e:	83 c4 0c             	add    $0xc,%esp
+  800131:	68 00 10 00 00       	push   $0x1000
+  800136:	68 00 60 80 00       	push   $0x806000
+  80013b:	56                   	push   %esi
+  80013c:	e8 e1 1c 00 00       	call   801e22 <readn>
+  800141:	83 c4 10             	add    $0x10,%esp
+  800144:	eb 3b                	jmp    800181 <reader+0xa7>
+    }
+    if (r != PGSIZE)
+      panic("read %s: %e", path, r);
+  800146:	83 ec 0c             	sub    $0xc,%esp
+  800149:	50                   	push   %eax
+  80014a:	ff 75 e0             	push   -0x20(%ebp)
+  80014d:	68 09 3e 80 00       	push   $0x803e09
+  800152:	6a 3c                	push   $0x3c
+  800154:	68 ec 3d 80 00       	push   $0x803dec
+  800159:	e8 da 03 00 00       	call   800538 <_panic>
+  for (i = 0; n ? i < n : !*stop; i++) {
+  80015e:	a1 00 00 00 30       	mov    0x30000000,%eax
+  800163:	85 c0                	test   %eax,%eax
+  800165:	75 2c                	jne    800193 <reader+0xb9>
+    if ((r = readn(fd, buf, PGSIZE)) == 0) {
+  800167:	83 ec 04             	sub    $0x4,%esp
+  80016a:	68 00 10 00 00       	push   $0x1000
+  80016f:	68 00 60 80 00       	push   $0x806000
+  800174:	56                   	push   %esi
+  800175:	e8 a8 1c 00 00       	call   801e22 <readn>
+  80017a:	83 c4 10             	add    $0x10,%esp
+  80017d:	85 c0                	test   %eax,%eax
+  80017f:	74 a2                	je     800123 <reader+0x49>
+    if (r != PGSIZE)
+  800181:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800186:	75 be                	jne    800146 <reader+0x6c>
+  for (i = 0; n ? i < n : !*stop; i++) {
+  800188:	83 c3 01             	add    $0x1,%ebx
+  80018b:	85 ff                	test   %edi,%edi
+  80018d:	74 cf                	je     80015e <reader+0x84>
+  80018f:	39 fb                	cmp    %edi,%ebx
+  800191:	7c d4                	jl     800167 <reader+0x8d>
+  }
+  ms = sys_time_msec() - ms;
+  800193:	e8 b2 11 00 00       	call   80134a <sys_time_msec>
+  800198:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80019b:	29 c8                	sub    %ecx,%eax
+  80019d:	89 c7                	mov    %eax,%edi
+  close(fd);
+  80019f:	83 ec 0c             	sub    $0xc,%esp
+  8001a2:	56                   	push   %esi
+  8001a3:	e8 6b 1a 00 00       	call   801c13 <close>
+  return ms * 1000 / MAX(i, 1);
+  8001a8:	69 c7 e8 03 00 00    	imul   $0x3e8,%edi,%eax
+  8001ae:	85 db                	test   %ebx,%ebx
+  8001b0:	ba 01 00 00 00       	mov    $0x1,%edx
+  8001b5:	0f 4e da             	cmovle %edx,%ebx
+  8001b8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001bd:	f7 f3                	div    %ebx
+}
+  8001bf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001c2:	5b                   	pop    %ebx
+  8001c3:	5e                   	pop    %esi
+  8001c4:	5f                   	pop    %edi
+  8001c5:	5d                   	pop    %ebp
+  8001c6:	c3                   	ret
+
+008001c7 <run>:
+
+// Run 'nhot' hot and 'ncold' cold clients; returns the hot clients'
+// mean us per read.
+static unsigned
+run(int nhot, int ncold)
+{
+  8001c7:	55                   	push   %ebp
+  8001c8:	89 e5                	mov    %esp,%ebp
+  8001ca:	57                   	push   %edi
+  8001cb:	56                   	push   %esi
+  8001cc:	53                   	push   %ebx
+  8001cd:	83 ec 5c             	sub    $0x5c,%esp
+  8001d0:	89 c7                	mov    %eax,%edi
+  envid_t kids[MAXCLIENT];
+  unsigned us;
+  int i;
+
+  *stop = 0;
+  8001d2:	c7 05 00 00 00 30 00 	movl   $0x0,0x30000000
+  8001d9:	00 00 00 
+  for (i = 0; i < nhot + ncold; i++) {
+  8001dc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001e1:	8d 34 10             	lea    (%eax,%edx,1),%esi
+  8001e4:	eb 29                	jmp    80020f <run+0x48>
+    if ((kids[i] = fork()) < 0)
+      panic("fork: %e", kids[i]);
+  8001e6:	50                   	push   %eax
+  8001e7:	68 d0 42 80 00       	push   $0x8042d0
+  8001ec:	6a 4f                	push   $0x4f
+  8001ee:	68 ec 3d 80 00       	push   $0x803dec
+  8001f3:	e8 40 03 00 00       	call   800538 <_panic>
+    if (kids[i] == 0) {
+      us = i < nhot ? reader(HOTNAME, NREAD) : reader(COLDNAME, 0);
+  8001f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001fd:	b8 23 3e 80 00       	mov    $0x803e23,%eax
+  800202:	e8 d3 fe ff ff       	call   8000da <reader>
+      if (i < nhot)
+        ipc_send(thisenv->env_parent_id, us, 0, 0);
+      exit();
+  800207:	e8 12 03 00 00       	call   80051e <exit>
+  for (i = 0; i < nhot + ncold; i++) {
+  80020c:	83 c3 01             	add    $0x1,%ebx
+  80020f:	39 de                	cmp    %ebx,%esi
+  800211:	7e 3c                	jle    80024f <run+0x88>
+    if ((kids[i] = fork()) < 0)
+  800213:	e8 85 14 00 00       	call   80169d <fork>
+  800218:	89 44 9d a8          	mov    %eax,-0x58(%ebp,%ebx,4)
+  80021c:	85 c0                	test   %eax,%eax
+  80021e:	78 c6                	js     8001e6 <run+0x1f>
+    if (kids[i] == 0) {
+  800220:	75 ea                	jne    80020c <run+0x45>
+      us = i < nhot ? reader(HOTNAME, NREAD) : reader(COLDNAME, 0);
+  800222:	39 fb                	cmp    %edi,%ebx
+  800224:	7d d2                	jge    8001f8 <run+0x31>
+  800226:	ba d0 07 00 00       	mov    $0x7d0,%edx
+  80022b:	b8 15 3e 80 00       	mov    $0x803e15,%eax
+  800230:	e8 a5 fe ff ff       	call   8000da <reader>
+  800235:	89 c2                	mov    %eax,%edx
+        ipc_send(thisenv->env_parent_id, us, 0, 0);
+  800237:	a1 a0 78 80 00       	mov    0x8078a0,%eax
+  80023c:	8b 40 4c             	mov    0x4c(%eax),%eax
+  80023f:	6a 00                	push   $0x0
+  800241:	6a 00                	push   $0x0
+  800243:	52                   	push   %edx
+  800244:	50                   	push   %eax
+  800245:	e8 cf 17 00 00       	call   801a19 <ipc_send>
+  80024a:	83 c4 10             	add    $0x10,%esp
+  80024d:	eb b8                	jmp    800207 <run+0x40>
+    }
+  }
+
+  us = 0;
+  for (i = 0; i < nhot; i++)
+  80024f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  us = 0;
+  800254:	c7 45 a4 00 00 00 00 	movl   $0x0,-0x5c(%ebp)
+  for (i = 0; i < nhot; i++)
+  80025b:	39 fb                	cmp    %edi,%ebx
+  80025d:	7d 19                	jge    800278 <run+0xb1>
+    us += ipc_recv(NULL, 0, NULL);
+  80025f:	83 ec 04             	sub    $0x4,%esp
+  800262:	6a 00                	push   $0x0
+  800264:	6a 00                	push   $0x0
+  800266:	6a 00                	push   $0x0
+  800268:	e8 29 17 00 00       	call   801996 <ipc_recv>
+  80026d:	01 45 a4             	add    %eax,-0x5c(%ebp)
+  for (i = 0; i < nhot; i++)
+  800270:	83 c3 01             	add    $0x1,%ebx
+  800273:	83 c4 10             	add    $0x10,%esp
+  800276:	eb e3                	jmp    80025b <run+0x94>
+  *stop = 1;
+  800278:	c7 05 00 00 00 30 01 	movl   $0x1,0x30000000
+  80027f:	00 00 00 
+  for (i = 0; i < nhot + ncold; i++)
+  800282:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800287:	39 de                	cmp    %ebx,%esi
+  800289:	7e 14                	jle    80029f <run+0xd8>
+    wait(kids[i]);
+  80028b:	83 ec 0c             	sub    $0xc,%esp
+  80028e:	ff 74 9d a8          	push   -0x58(%ebp,%ebx,4)
+  800292:	e8 7c 30 00 00       	call   803313 <wait>
+  for (i = 0; i < nhot + ncold; i++)
+  800297:	83 c3 01             	add    $0x1,%ebx
+  80029a:	83 c4 10             	add    $0x10,%esp
+  80029d:	eb e8                	jmp    800287 <run+0xc0>
+  return us / MAX(nhot, 1);
+  80029f:	85 ff                	test   %edi,%edi
+  8002a1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8002a6:	0f 4e f8             	cmovle %eax,%edi
+  8002a9:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  8002ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002b1:	f7 f7                	div    %edi
+}
+  8002b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002b6:	5b                   	pop    %ebx
+  8002b7:	5e                   	pop    %esi
+  8002b8:	5f                   	pop    %edi
+  8002b9:	5d                   	pop    %ebp
+  8002ba:	c3                   	ret
+
+008002bb <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8002bb:	55                   	push   %ebp
+  8002bc:	89 e5                	mov    %esp,%ebp
+  8002be:	57                   	push   %edi
+  8002bf:	56                   	push   %esi
+  8002c0:	53                   	push   %ebx
+  8002c1:	83 ec 7c             	sub    $0x7c,%esp
+  8002c4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Fsret_stats st;
+  uint32_t capacity;
+  unsigned alone, mixed;
+  int nhot, ncold, fd, r;
+
+  binaryname = "mixbench";
+  8002c7:	c7 05 00 50 80 00 32 	movl   $0x803e32,0x805000
+  8002ce:	3e 80 00 
+  nhot = ncold = 4;
+  8002d1:	bb 04 00 00 00       	mov    $0x4,%ebx
+  8002d6:	be 04 00 00 00       	mov    $0x4,%esi
+  if (argc > 1)
+  8002db:	83 ff 01             	cmp    $0x1,%edi
+  8002de:	0f 8f 1e 01 00 00    	jg     800402 <umain+0x147>
+  if (argc > 2)
+    ncold = strtol(argv[2], 0, 0);
+  if (nhot < 1 || ncold < 0 || nhot + ncold > MAXCLIENT)
+    panic("usage: mixbench [NHOT [NCOLD]], at most %d in all", MAXCLIENT);
+
+  if ((r = sys_page_alloc(0, (void *) stop, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8002e4:	83 ec 04             	sub    $0x4,%esp
+  8002e7:	68 07 04 00 00       	push   $0x407
+  8002ec:	68 00 00 00 30       	push   $0x30000000
+  8002f1:	6a 00                	push   $0x0
+  8002f3:	e8 38 0d 00 00       	call   801030 <sys_page_alloc>
+  8002f8:	83 c4 10             	add    $0x10,%esp
+  8002fb:	85 c0                	test   %eax,%eax
+  8002fd:	0f 88 5b 01 00 00    	js     80045e <umain+0x1a3>
+    panic("sys_page_alloc: %e", r);
+  mkfile(HOTNAME, HOTSIZE);
+  800303:	ba 00 00 01 00       	mov    $0x10000,%edx
+  800308:	b8 15 3e 80 00       	mov    $0x803e15,%eax
+  80030d:	e8 21 fd ff ff       	call   800033 <mkfile>
+  mkfile(COLDNAME, COLDSIZE);
+  800312:	ba 00 00 20 00       	mov    $0x200000,%edx
+  800317:	b8 23 3e 80 00       	mov    $0x803e23,%eax
+  80031c:	e8 12 fd ff ff       	call   800033 <mkfile>
+  sync();
+  800321:	e8 88 25 00 00       	call   8028ae <sync>
+
+  // Shrink the cache so the cold file can't stay in it.
+  if ((r = fs_stats(0, &st)) < 0)
+  800326:	83 ec 08             	sub    $0x8,%esp
+  800329:	8d 45 90             	lea    -0x70(%ebp),%eax
+  80032c:	50                   	push   %eax
+  80032d:	6a 00                	push   $0x0
+  80032f:	e8 91 25 00 00       	call   8028c5 <fs_stats>
+  800334:	83 c4 10             	add    $0x10,%esp
+  800337:	85 c0                	test   %eax,%eax
+  800339:	0f 88 31 01 00 00    	js     800470 <umain+0x1b5>
+    panic("fs_stats: %e", r);
+  capacity = st.ret_bc_capacity;
+  80033f:	8b 7d 90             	mov    -0x70(%ebp),%edi
+  if ((r = fs_stats(SMALLCACHE, &st)) < 0)
+  800342:	83 ec 08             	sub    $0x8,%esp
+  800345:	8d 45 90             	lea    -0x70(%ebp),%eax
+  800348:	50                   	push   %eax
+  800349:	68 00 01 00 00       	push   $0x100
+  80034e:	e8 72 25 00 00       	call   8028c5 <fs_stats>
+  800353:	83 c4 10             	add    $0x10,%esp
+  800356:	85 c0                	test   %eax,%eax
+  800358:	0f 88 24 01 00 00    	js     800482 <umain+0x1c7>
+    panic("fs_stats: %e", r);
+
+  reader(HOTNAME, HOTSIZE / PGSIZE);
+  80035e:	ba 10 00 00 00       	mov    $0x10,%edx
+  800363:	b8 15 3e 80 00       	mov    $0x803e15,%eax
+  800368:	e8 6d fd ff ff       	call   8000da <reader>
+  alone = run(nhot, 0);
+  80036d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800372:	89 d8                	mov    %ebx,%eax
+  800374:	e8 4e fe ff ff       	call   8001c7 <run>
+  800379:	89 45 84             	mov    %eax,-0x7c(%ebp)
+  mixed = run(nhot, ncold);
+  80037c:	89 f2                	mov    %esi,%edx
+  80037e:	89 d8                	mov    %ebx,%eax
+  800380:	e8 42 fe ff ff       	call   8001c7 <run>
+  800385:	89 45 80             	mov    %eax,-0x80(%ebp)
+  cprintf("mixbench: %d hot clients alone        %5d us/read\n", nhot, alone);
+  800388:	83 ec 04             	sub    $0x4,%esp
+  80038b:	ff 75 84             	push   -0x7c(%ebp)
+  80038e:	53                   	push   %ebx
+  80038f:	68 90 3e 80 00       	push   $0x803e90
+  800394:	e8 7a 02 00 00       	call   800613 <cprintf>
+  cprintf("mixbench: %d hot with %d cold clients  %5d us/read\n", nhot, ncold,
+  800399:	ff 75 80             	push   -0x80(%ebp)
+  80039c:	56                   	push   %esi
+  80039d:	53                   	push   %ebx
+  80039e:	68 c4 3e 80 00       	push   $0x803ec4
+  8003a3:	e8 6b 02 00 00       	call   800613 <cprintf>
+          mixed);
+
+  if ((r = fs_stats(capacity, &st)) < 0)
+  8003a8:	83 c4 18             	add    $0x18,%esp
+  8003ab:	8d 45 90             	lea    -0x70(%ebp),%eax
+  8003ae:	50                   	push   %eax
+  8003af:	57                   	push   %edi
+  8003b0:	e8 10 25 00 00       	call   8028c5 <fs_stats>
+  8003b5:	83 c4 10             	add    $0x10,%esp
+  8003b8:	85 c0                	test   %eax,%eax
+  8003ba:	0f 88 d4 00 00 00    	js     800494 <umain+0x1d9>
+    panic("fs_stats: %e", r);
+
+  // Give the space back (there is no remove).
+  if ((fd = open(HOTNAME, O_RDWR | O_TRUNC)) >= 0)
+  8003c0:	83 ec 08             	sub    $0x8,%esp
+  8003c3:	68 02 02 00 00       	push   $0x202
+  8003c8:	68 15 3e 80 00       	push   $0x803e15
+  8003cd:	e8 f4 21 00 00       	call   8025c6 <open>
+  8003d2:	83 c4 10             	add    $0x10,%esp
+  8003d5:	85 c0                	test   %eax,%eax
+  8003d7:	0f 89 cc 00 00 00    	jns    8004a9 <umain+0x1ee>
+    close(fd);
+  if ((fd = open(COLDNAME, O_RDWR | O_TRUNC)) >= 0)
+  8003dd:	83 ec 08             	sub    $0x8,%esp
+  8003e0:	68 02 02 00 00       	push   $0x202
+  8003e5:	68 23 3e 80 00       	push   $0x803e23
+  8003ea:	e8 d7 21 00 00       	call   8025c6 <open>
+  8003ef:	83 c4 10             	add    $0x10,%esp
+  8003f2:	85 c0                	test   %eax,%eax
+  8003f4:	0f 89 c0 00 00 00    	jns    8004ba <umain+0x1ff>
+    close(fd);
+}
+  8003fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003fd:	5b                   	pop    %ebx
+  8003fe:	5e                   	pop    %esi
+  8003ff:	5f                   	pop    %edi
+  800400:	5d                   	pop    %ebp
+  800401:	c3                   	ret
+    nhot = strtol(argv[1], 0, 0);
+  800402:	83 ec 04             	sub    $0x4,%esp
+  800405:	6a 00                	push   $0x0
+  800407:	6a 00                	push   $0x0
+  800409:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80040c:	ff 70 04             	push   0x4(%eax)
+  80040f:	e8 41 0a 00 00       	call   800e55 <strtol>
+  800414:	89 c3                	mov    %eax,%ebx
+  if (argc > 2)
+  800416:	83 c4 10             	add    $0x10,%esp
+  800419:	83 ff 02             	cmp    $0x2,%edi
+  80041c:	7f 27                	jg     800445 <umain+0x18a>
+  if (nhot < 1 || ncold < 0 || nhot + ncold > MAXCLIENT)
+  80041e:	85 db                	test   %ebx,%ebx
+  800420:	7e 10                	jle    800432 <umain+0x177>
+  800422:	85 f6                	test   %esi,%esi
+  800424:	78 0c                	js     800432 <umain+0x177>
+  800426:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  800429:	83 f8 10             	cmp    $0x10,%eax
+  80042c:	0f 8e b2 fe ff ff    	jle    8002e4 <umain+0x29>
+    panic("usage: mixbench [NHOT [NCOLD]], at most %d in all", MAXCLIENT);
+  800432:	6a 10                	push   $0x10
+  800434:	68 5c 3e 80 00       	push   $0x803e5c
+  800439:	6a 70                	push   $0x70
+  80043b:	68 ec 3d 80 00       	push   $0x803dec
+  800440:	e8 f3 00 00 00       	call   800538 <_panic>
+    ncold = strtol(argv[2], 0, 0);
+  800445:	83 ec 04             	sub    $0x4,%esp
+  800448:	6a 00                	push   $0x0
+  80044a:	6a 00                	push   $0x0
+  80044c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80044f:	ff 70 08             	push   0x8(%eax)
+  800452:	e8 fe 09 00 00       	call   800e55 <strtol>
+  800457:	89 c6                	mov    %eax,%esi
+  800459:	83 c4 10             	add    $0x10,%esp
+  80045c:	eb c0                	jmp    80041e <umain+0x163>
+    panic("sys_page_alloc: %e", r);
+  80045e:	50                   	push   %eax
+  80045f:	68 3b 3e 80 00       	push   $0x803e3b
+  800464:	6a 73                	push   $0x73
+  800466:	68 ec 3d 80 00       	push   $0x803dec
+  80046b:	e8 c8 00 00 00       	call   800538 <_panic>
+    panic("fs_stats: %e", r);
+  800470:	50                   	push   %eax
+  800471:	68 4e 3e 80 00       	push   $0x803e4e
+  800476:	6a 7a                	push   $0x7a
+  800478:	68 ec 3d 80 00       	push   $0x803dec
+  80047d:	e8 b6 00 00 00       	call   800538 <_panic>
+    panic("fs_stats: %e", r);
+  800482:	50                   	push   %eax
+  800483:	68 4e 3e 80 00       	push   $0x803e4e
+  800488:	6a 7d                	push   $0x7d
+  80048a:	68 ec 3d 80 00       	push   $0x803dec
+  80048f:	e8 a4 00 00 00       	call   800538 <_panic>
+    panic("fs_stats: %e", r);
+  800494:	50                   	push   %eax
+  800495:	68 4e 3e 80 00       	push   $0x803e4e
+  80049a:	68 87 00 00 00       	push   $0x87
+  80049f:	68 ec 3d 80 00       	push   $0x803dec
+  8004a4:	e8 8f 00 00 00       	call   800538 <_panic>
+    close(fd);
+  8004a9:	83 ec 0c             	sub    $0xc,%esp
+  8004ac:	50                   	push   %eax
+  8004ad:	e8 61 17 00 00       	call   801c13 <close>
+  8004b2:	83 c4 10             	add    $0x10,%esp
+  8004b5:	e9 23 ff ff ff       	jmp    8003dd <umain+0x122>
+    close(fd);
+  8004ba:	83 ec 0c             	sub    $0xc,%esp
+  8004bd:	50                   	push   %eax
+  8004be:	e8 50 17 00 00       	call   801c13 <close>
+  8004c3:	83 c4 10             	add    $0x10,%esp
+}
+  8004c6:	e9 2f ff ff ff       	jmp    8003fa <umain+0x13f>
+
+008004cb <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8004cb:	55                   	push   %ebp
+  8004cc:	89 e5                	mov    %esp,%ebp
+  8004ce:	56                   	push   %esi
+  8004cf:	53                   	push   %ebx
+  8004d0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8004d3:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  8004d6:	c7 05 a0 78 80 00 00 	movl   $0x0,0x8078a0
+  8004dd:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  8004e0:	e8 ca 0a 00 00       	call   800faf <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  8004e5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8004ea:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8004ed:	c1 e0 04             	shl    $0x4,%eax
+  8004f0:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8004f5:	a3 a0 78 80 00       	mov    %eax,0x8078a0
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8004fa:	85 db                	test   %ebx,%ebx
+  8004fc:	7e 07                	jle    800505 <libmain+0x3a>
+    binaryname = argv[0];
+  8004fe:	8b 06                	mov    (%esi),%eax
+  800500:	a3 00 50 80 00       	mov    %eax,0x805000
+
+  // call user main routine
+  umain(argc, argv);
+  800505:	83 ec 08             	sub    $0x8,%esp
+  800508:	56                   	push   %esi
+  800509:	53                   	push   %ebx
+  80050a:	e8 ac fd ff ff       	call   8002bb <umain>
+
+  // exit gracefully
+  exit();
+  80050f:	e8 0a 00 00 00       	call   80051e <exit>
+}
+  800514:	83 c4 10             	add    $0x10,%esp
+  800517:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80051a:	5b                   	pop    %ebx
+  80051b:	5e                   	pop    %esi
+  80051c:	5d                   	pop    %ebp
+  80051d:	c3                   	ret
+
+0080051e <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80051e:	55                   	push   %ebp
+  80051f:	89 e5                	mov    %esp,%ebp
+  800521:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  800524:	e8 17 17 00 00       	call   801c40 <close_all>
+  sys_env_destroy(0);
+  800529:	83 ec 0c             	sub    $0xc,%esp
+  80052c:	6a 00                	push   $0x0
+  80052e:	e8 3b 0a 00 00       	call   800f6e <sys_env_destroy>
+}
+  800533:	83 c4 10             	add    $0x10,%esp
+  800536:	c9                   	leave
+  800537:	c3                   	ret
+
+00800538 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800538:	55                   	push   %ebp
+  800539:	89 e5                	mov    %esp,%ebp
+  80053b:	56                   	push   %esi
+  80053c:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  80053d:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  800540:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  800546:	e8 64 0a 00 00       	call   800faf <sys_getenvid>
+  80054b:	83 ec 0c             	sub    $0xc,%esp
+  80054e:	ff 75 0c             	push   0xc(%ebp)
+  800551:	ff 75 08             	push   0x8(%ebp)
+  800554:	56                   	push   %esi
+  800555:	50                   	push   %eax
+  800556:	68 04 3f 80 00       	push   $0x803f04
+  80055b:	e8 b3 00 00 00       	call   800613 <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  800560:	83 c4 18             	add    $0x18,%esp
+  800563:	53                   	push   %ebx
+  800564:	ff 75 10             	push   0x10(%ebp)
+  800567:	e8 56 00 00 00       	call   8005c2 <vcprintf>
+  cprintf("\n");
+  80056c:	c7 04 24 50 44 80 00 	movl   $0x804450,(%esp)
+  800573:	e8 9b 00 00 00       	call   800613 <cprintf>
+  800578:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  80057b:	cc                   	int3
+  while (1)
+  80057c:	eb fd                	jmp    80057b <_panic+0x43>
+
+0080057e <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80057e:	55                   	push   %ebp
+  80057f:	89 e5                	mov    %esp,%ebp
+  800581:	53                   	push   %ebx
+  800582:	83 ec 04             	sub    $0x4,%esp
+  800585:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  800588:	8b 13                	mov    (%ebx),%edx
+  80058a:	8d 42 01             	lea    0x1(%edx),%eax
+  80058d:	89 03                	mov    %eax,(%ebx)
+  80058f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800592:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  800596:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80059b:	74 09                	je     8005a6 <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  80059d:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8005a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8005a4:	c9                   	leave
+  8005a5:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  8005a6:	83 ec 08             	sub    $0x8,%esp
+  8005a9:	68 ff 00 00 00       	push   $0xff
+  8005ae:	8d 43 08             	lea    0x8(%ebx),%eax
+  8005b1:	50                   	push   %eax
+  8005b2:	e8 7a 09 00 00       	call   800f31 <sys_cputs>
+    b->idx = 0;
+  8005b7:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8005bd:	83 c4 10             	add    $0x10,%esp
+  8005c0:	eb db                	jmp    80059d <putch+0x1f>
+
+008005c2 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8005c2:	55                   	push   %ebp
+  8005c3:	89 e5                	mov    %esp,%ebp
+  8005c5:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  8005cb:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8005d2:	00 00 00 
+  b.cnt = 0;
+  8005d5:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8005dc:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  8005df:	ff 75 0c             	push   0xc(%ebp)
+  8005e2:	ff 75 08             	push   0x8(%ebp)
+  8005e5:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8005eb:	50                   	push   %eax
+  8005ec:	68 7e 05 80 00       	push   $0x80057e
+  8005f1:	e8 14 01 00 00       	call   80070a <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  8005f6:	83 c4 08             	add    $0x8,%esp
+  8005f9:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8005ff:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800605:	50                   	push   %eax
+  800606:	e8 26 09 00 00       	call   800f31 <sys_cputs>
+
+  return b.cnt;
+}
+  80060b:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800611:	c9                   	leave
+  800612:	c3                   	ret
+
+00800613 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800613:	55                   	push   %ebp
+  800614:	89 e5                	mov    %esp,%ebp
+  800616:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  800619:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  80061c:	50                   	push   %eax
+  80061d:	ff 75 08             	push   0x8(%ebp)
+  800620:	e8 9d ff ff ff       	call   8005c2 <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  800625:	c9                   	leave
+  800626:	c3                   	ret
+
+00800627 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  800627:	55                   	push   %ebp
+  800628:	89 e5                	mov    %esp,%ebp
+  80062a:	57                   	push   %edi
+  80062b:	56                   	push   %esi
+  80062c:	53                   	push   %ebx
+  80062d:	83 ec 1c             	sub    $0x1c,%esp
+  800630:	89 c7                	mov    %eax,%edi
+  800632:	89 d6                	mov    %edx,%esi
+  800634:	8b 45 08             	mov    0x8(%ebp),%eax
+  800637:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80063a:	89 d1                	mov    %edx,%ecx
+  80063c:	89 c2                	mov    %eax,%edx
+  80063e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800641:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800644:	8b 45 10             	mov    0x10(%ebp),%eax
+  800647:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  80064a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80064d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800654:	39 c2                	cmp    %eax,%edx
+  800656:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800659:	72 3e                	jb     800699 <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  80065b:	83 ec 0c             	sub    $0xc,%esp
+  80065e:	ff 75 18             	push   0x18(%ebp)
+  800661:	83 eb 01             	sub    $0x1,%ebx
+  800664:	53                   	push   %ebx
+  800665:	50                   	push   %eax
+  800666:	83 ec 08             	sub    $0x8,%esp
+  800669:	ff 75 e4             	push   -0x1c(%ebp)
+  80066c:	ff 75 e0             	push   -0x20(%ebp)
+  80066f:	ff 75 dc             	push   -0x24(%ebp)
+  800672:	ff 75 d8             	push   -0x28(%ebp)
+  800675:	e8 e1 35 00 00       	call   803c5b <__udivdi3>
+  80067a:	83 c4 18             	add    $0x18,%esp
+  80067d:	52                   	push   %edx
+  80067e:	50                   	push   %eax
+  80067f:	89 f2                	mov    %esi,%edx
+  800681:	89 f8                	mov    %edi,%eax
+  800683:	e8 9f ff ff ff       	call   800627 <printnum>
+  800688:	83 c4 20             	add    $0x20,%esp
+  80068b:	eb 13                	jmp    8006a0 <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  80068d:	83 ec 08             	sub    $0x8,%esp
+  800690:	56                   	push   %esi
+  800691:	ff 75 18             	push   0x18(%ebp)
+  800694:	ff d7                	call   *%edi
+  800696:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  800699:	83 eb 01             	sub    $0x1,%ebx
+  80069c:	85 db                	test   %ebx,%ebx
+  80069e:	7f ed                	jg     80068d <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  8006a0:	83 ec 08             	sub    $0x8,%esp
+  8006a3:	56                   	push   %esi
+  8006a4:	83 ec 04             	sub    $0x4,%esp
+  8006a7:	ff 75 e4             	push   -0x1c(%ebp)
+  8006aa:	ff 75 e0             	push   -0x20(%ebp)
+  8006ad:	ff 75 dc             	push   -0x24(%ebp)
+  8006b0:	ff 75 d8             	push   -0x28(%ebp)
+  8006b3:	e8 c4 35 00 00       	call   803c7c <__umoddi3>
+  8006b8:	83 c4 14             	add    $0x14,%esp
+  8006bb:	0f be 80 27 3f 80 00 	movsbl 0x803f27(%eax),%eax
+  8006c2:	50                   	push   %eax
+  8006c3:	ff d7                	call   *%edi
+}
+  8006c5:	83 c4 10             	add    $0x10,%esp
+  8006c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006cb:	5b                   	pop    %ebx
+  8006cc:	5e                   	pop    %esi
+  8006cd:	5f                   	pop    %edi
+  8006ce:	5d                   	pop    %ebp
+  8006cf:	c3                   	ret
+
+008006d0 <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8006d0:	55                   	push   %ebp
+  8006d1:	89 e5                	mov    %esp,%ebp
+  8006d3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  8006d6:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  8006da:	8b 10                	mov    (%eax),%edx
+  8006dc:	3b 50 04             	cmp    0x4(%eax),%edx
+  8006df:	73 0a                	jae    8006eb <sprintputch+0x1b>
+    *b->buf++ = ch;
+  8006e1:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8006e4:	89 08                	mov    %ecx,(%eax)
+  8006e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8006e9:	88 02                	mov    %al,(%edx)
+}
+  8006eb:	5d                   	pop    %ebp
+  8006ec:	c3                   	ret
+
+008006ed <printfmt>:
+{
+  8006ed:	55                   	push   %ebp
+  8006ee:	89 e5                	mov    %esp,%ebp
+  8006f0:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  8006f3:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  8006f6:	50                   	push   %eax
+  8006f7:	ff 75 10             	push   0x10(%ebp)
+  8006fa:	ff 75 0c             	push   0xc(%ebp)
+  8006fd:	ff 75 08             	push   0x8(%ebp)
+  800700:	e8 05 00 00 00       	call   80070a <vprintfmt>
+}
+  800705:	83 c4 10             	add    $0x10,%esp
+  800708:	c9                   	leave
+  800709:	c3                   	ret
+
+0080070a <vprintfmt>:
+{
+  80070a:	55                   	push   %ebp
+  80070b:	89 e5                	mov    %esp,%ebp
+  80070d:	57                   	push   %edi
+  80070e:	56                   	push   %esi
+  80070f:	53                   	push   %ebx
+  800710:	83 ec 2c             	sub    $0x2c,%esp
+  800713:	8b 75 08             	mov    0x8(%ebp),%esi
+  800716:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800719:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80071c:	eb 0a                	jmp    800728 <vprintfmt+0x1e>
+      putch(ch, putdat);
+  80071e:	83 ec 08             	sub    $0x8,%esp
+  800721:	53                   	push   %ebx
+  800722:	50                   	push   %eax
+  800723:	ff d6                	call   *%esi
+  800725:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  800728:	83 c7 01             	add    $0x1,%edi
+  80072b:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80072f:	83 f8 25             	cmp    $0x25,%eax
+  800732:	74 0c                	je     800740 <vprintfmt+0x36>
+      if (ch == '\0')
+  800734:	85 c0                	test   %eax,%eax
+  800736:	75 e6                	jne    80071e <vprintfmt+0x14>
+}
+  800738:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80073b:	5b                   	pop    %ebx
+  80073c:	5e                   	pop    %esi
+  80073d:	5f                   	pop    %edi
+  80073e:	5d                   	pop    %ebp
+  80073f:	c3                   	ret
+    padc = ' ';
+  800740:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  800744:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  80074b:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  800752:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  800759:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  80075e:	8d 47 01             	lea    0x1(%edi),%eax
+  800761:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800764:	0f b6 17             	movzbl (%edi),%edx
+  800767:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80076a:	3c 55                	cmp    $0x55,%al
+  80076c:	0f 87 cf 03 00 00    	ja     800b41 <vprintfmt+0x437>
+  800772:	0f b6 c0             	movzbl %al,%eax
+  800775:	ff 24 85 80 40 80 00 	jmp    *0x804080(,%eax,4)
+  80077c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  80077f:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800783:	eb d9                	jmp    80075e <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  800785:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800788:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80078c:	eb d0                	jmp    80075e <vprintfmt+0x54>
+  80078e:	0f b6 d2             	movzbl %dl,%edx
+  800791:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  800794:	b8 00 00 00 00       	mov    $0x0,%eax
+  800799:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  80079c:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80079f:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  8007a3:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  8007a6:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8007a9:	83 f9 09             	cmp    $0x9,%ecx
+  8007ac:	77 55                	ja     800803 <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  8007ae:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  8007b1:	eb e9                	jmp    80079c <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  8007b3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b6:	8b 00                	mov    (%eax),%eax
+  8007b8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8007bb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007be:	8d 40 04             	lea    0x4(%eax),%eax
+  8007c1:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  8007c4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  8007c7:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8007cb:	79 91                	jns    80075e <vprintfmt+0x54>
+        width = precision, precision = -1;
+  8007cd:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8007d0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8007d3:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8007da:	eb 82                	jmp    80075e <vprintfmt+0x54>
+      if (width < 0)
+  8007dc:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8007df:	85 d2                	test   %edx,%edx
+  8007e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007e6:	0f 49 c2             	cmovns %edx,%eax
+  8007e9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  8007ec:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  8007ef:	e9 6a ff ff ff       	jmp    80075e <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  8007f4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  8007f7:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  8007fe:	e9 5b ff ff ff       	jmp    80075e <vprintfmt+0x54>
+  800803:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800806:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800809:	eb bc                	jmp    8007c7 <vprintfmt+0xbd>
+      lflag++;
+  80080b:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  80080e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  800811:	e9 48 ff ff ff       	jmp    80075e <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  800816:	8b 45 14             	mov    0x14(%ebp),%eax
+  800819:	8d 78 04             	lea    0x4(%eax),%edi
+  80081c:	83 ec 08             	sub    $0x8,%esp
+  80081f:	53                   	push   %ebx
+  800820:	ff 30                	push   (%eax)
+  800822:	ff d6                	call   *%esi
+      break;
+  800824:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  800827:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  80082a:	e9 b1 02 00 00       	jmp    800ae0 <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  80082f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800832:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  800835:	8b 10                	mov    (%eax),%edx
+  800837:	89 d0                	mov    %edx,%eax
+  800839:	f7 d8                	neg    %eax
+  80083b:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80083e:	83 f8 10             	cmp    $0x10,%eax
+  800841:	7f 23                	jg     800866 <vprintfmt+0x15c>
+  800843:	8b 14 85 e0 41 80 00 	mov    0x8041e0(,%eax,4),%edx
+  80084a:	85 d2                	test   %edx,%edx
+  80084c:	74 18                	je     800866 <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  80084e:	52                   	push   %edx
+  80084f:	68 fa 43 80 00       	push   $0x8043fa
+  800854:	53                   	push   %ebx
+  800855:	56                   	push   %esi
+  800856:	e8 92 fe ff ff       	call   8006ed <printfmt>
+  80085b:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  80085e:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800861:	e9 7a 02 00 00       	jmp    800ae0 <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  800866:	50                   	push   %eax
+  800867:	68 3f 3f 80 00       	push   $0x803f3f
+  80086c:	53                   	push   %ebx
+  80086d:	56                   	push   %esi
+  80086e:	e8 7a fe ff ff       	call   8006ed <printfmt>
+  800873:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  800876:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  800879:	e9 62 02 00 00       	jmp    800ae0 <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  80087e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800881:	83 c0 04             	add    $0x4,%eax
+  800884:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800887:	8b 45 14             	mov    0x14(%ebp),%eax
+  80088a:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  80088c:	85 c9                	test   %ecx,%ecx
+  80088e:	b8 38 3f 80 00       	mov    $0x803f38,%eax
+  800893:	0f 45 c1             	cmovne %ecx,%eax
+  800896:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  800899:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80089d:	7e 06                	jle    8008a5 <vprintfmt+0x19b>
+  80089f:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8008a3:	75 0b                	jne    8008b0 <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8008a5:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8008a8:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8008ab:	89 75 08             	mov    %esi,0x8(%ebp)
+  8008ae:	eb 5c                	jmp    80090c <vprintfmt+0x202>
+  8008b0:	83 ec 08             	sub    $0x8,%esp
+  8008b3:	ff 75 d0             	push   -0x30(%ebp)
+  8008b6:	ff 75 cc             	push   -0x34(%ebp)
+  8008b9:	e8 20 03 00 00       	call   800bde <strnlen>
+  8008be:	89 c2                	mov    %eax,%edx
+  8008c0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8008c3:	29 d0                	sub    %edx,%eax
+  8008c5:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  8008c8:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8008cc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8008cf:	89 75 08             	mov    %esi,0x8(%ebp)
+  8008d2:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8008d4:	eb 0e                	jmp    8008e4 <vprintfmt+0x1da>
+          putch(padc, putdat);
+  8008d6:	83 ec 08             	sub    $0x8,%esp
+  8008d9:	53                   	push   %ebx
+  8008da:	57                   	push   %edi
+  8008db:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8008de:	83 ee 01             	sub    $0x1,%esi
+  8008e1:	83 c4 10             	add    $0x10,%esp
+  8008e4:	85 f6                	test   %esi,%esi
+  8008e6:	7f ee                	jg     8008d6 <vprintfmt+0x1cc>
+  8008e8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8008eb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008ee:	85 c0                	test   %eax,%eax
+  8008f0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008f5:	0f 49 d0             	cmovns %eax,%edx
+  8008f8:	29 d0                	sub    %edx,%eax
+  8008fa:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8008fd:	eb a6                	jmp    8008a5 <vprintfmt+0x19b>
+          putch(ch, putdat);
+  8008ff:	83 ec 08             	sub    $0x8,%esp
+  800902:	53                   	push   %ebx
+  800903:	52                   	push   %edx
+  800904:	ff 55 08             	call   *0x8(%ebp)
+  800907:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80090a:	89 f1                	mov    %esi,%ecx
+  80090c:	8d 71 01             	lea    0x1(%ecx),%esi
+  80090f:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800913:	0f be d0             	movsbl %al,%edx
+  800916:	85 d2                	test   %edx,%edx
+  800918:	74 28                	je     800942 <vprintfmt+0x238>
+  80091a:	85 ff                	test   %edi,%edi
+  80091c:	78 05                	js     800923 <vprintfmt+0x219>
+  80091e:	83 ef 01             	sub    $0x1,%edi
+  800921:	78 30                	js     800953 <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  800923:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800927:	74 d6                	je     8008ff <vprintfmt+0x1f5>
+  800929:	0f be c0             	movsbl %al,%eax
+  80092c:	83 e8 20             	sub    $0x20,%eax
+  80092f:	83 f8 5e             	cmp    $0x5e,%eax
+  800932:	76 cb                	jbe    8008ff <vprintfmt+0x1f5>
+          putch('?', putdat);
+  800934:	83 ec 08             	sub    $0x8,%esp
+  800937:	53                   	push   %ebx
+  800938:	6a 3f                	push   $0x3f
+  80093a:	ff 55 08             	call   *0x8(%ebp)
+  80093d:	83 c4 10             	add    $0x10,%esp
+  800940:	eb c8                	jmp    80090a <vprintfmt+0x200>
+  800942:	8b 75 08             	mov    0x8(%ebp),%esi
+  800945:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800948:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80094b:	01 d0                	add    %edx,%eax
+  80094d:	29 c8                	sub    %ecx,%eax
+  80094f:	89 c7                	mov    %eax,%edi
+  800951:	eb 13                	jmp    800966 <vprintfmt+0x25c>
+  800953:	8b 75 08             	mov    0x8(%ebp),%esi
+  800956:	eb ed                	jmp    800945 <vprintfmt+0x23b>
+        putch(' ', putdat);
+  800958:	83 ec 08             	sub    $0x8,%esp
+  80095b:	53                   	push   %ebx
+  80095c:	6a 20                	push   $0x20
+  80095e:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  800960:	83 ef 01             	sub    $0x1,%edi
+  800963:	83 c4 10             	add    $0x10,%esp
+  800966:	85 ff                	test   %edi,%edi
+  800968:	7f ee                	jg     800958 <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  80096a:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80096d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800970:	e9 6b 01 00 00       	jmp    800ae0 <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  800975:	83 f9 01             	cmp    $0x1,%ecx
+  800978:	7f 1f                	jg     800999 <vprintfmt+0x28f>
+  else if (lflag)
+  80097a:	85 c9                	test   %ecx,%ecx
+  80097c:	74 67                	je     8009e5 <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  80097e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800981:	8b 00                	mov    (%eax),%eax
+  800983:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800986:	89 c1                	mov    %eax,%ecx
+  800988:	c1 f9 1f             	sar    $0x1f,%ecx
+  80098b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80098e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800991:	8d 40 04             	lea    0x4(%eax),%eax
+  800994:	89 45 14             	mov    %eax,0x14(%ebp)
+  800997:	eb 17                	jmp    8009b0 <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  800999:	8b 45 14             	mov    0x14(%ebp),%eax
+  80099c:	8b 50 04             	mov    0x4(%eax),%edx
+  80099f:	8b 00                	mov    (%eax),%eax
+  8009a1:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8009a4:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8009a7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009aa:	8d 40 08             	lea    0x8(%eax),%eax
+  8009ad:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  8009b0:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8009b3:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  8009b6:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  8009bb:	85 c9                	test   %ecx,%ecx
+  8009bd:	0f 89 03 01 00 00    	jns    800ac6 <vprintfmt+0x3bc>
+        putch('-', putdat);
+  8009c3:	83 ec 08             	sub    $0x8,%esp
+  8009c6:	53                   	push   %ebx
+  8009c7:	6a 2d                	push   $0x2d
+  8009c9:	ff d6                	call   *%esi
+        num = -(long long)num;
+  8009cb:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8009ce:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8009d1:	f7 da                	neg    %edx
+  8009d3:	83 d1 00             	adc    $0x0,%ecx
+  8009d6:	f7 d9                	neg    %ecx
+  8009d8:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  8009db:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8009e0:	e9 e1 00 00 00       	jmp    800ac6 <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  8009e5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009e8:	8b 00                	mov    (%eax),%eax
+  8009ea:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8009ed:	89 c1                	mov    %eax,%ecx
+  8009ef:	c1 f9 1f             	sar    $0x1f,%ecx
+  8009f2:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8009f5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009f8:	8d 40 04             	lea    0x4(%eax),%eax
+  8009fb:	89 45 14             	mov    %eax,0x14(%ebp)
+  8009fe:	eb b0                	jmp    8009b0 <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  800a00:	83 f9 01             	cmp    $0x1,%ecx
+  800a03:	7f 1e                	jg     800a23 <vprintfmt+0x319>
+  else if (lflag)
+  800a05:	85 c9                	test   %ecx,%ecx
+  800a07:	74 32                	je     800a3b <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  800a09:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a0c:	8b 10                	mov    (%eax),%edx
+  800a0e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a13:	8d 40 04             	lea    0x4(%eax),%eax
+  800a16:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800a19:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  800a1e:	e9 a3 00 00 00       	jmp    800ac6 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800a23:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a26:	8b 10                	mov    (%eax),%edx
+  800a28:	8b 48 04             	mov    0x4(%eax),%ecx
+  800a2b:	8d 40 08             	lea    0x8(%eax),%eax
+  800a2e:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800a31:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  800a36:	e9 8b 00 00 00       	jmp    800ac6 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800a3b:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a3e:	8b 10                	mov    (%eax),%edx
+  800a40:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a45:	8d 40 04             	lea    0x4(%eax),%eax
+  800a48:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800a4b:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  800a50:	eb 74                	jmp    800ac6 <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  800a52:	83 f9 01             	cmp    $0x1,%ecx
+  800a55:	7f 1b                	jg     800a72 <vprintfmt+0x368>
+  else if (lflag)
+  800a57:	85 c9                	test   %ecx,%ecx
+  800a59:	74 2c                	je     800a87 <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  800a5b:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a5e:	8b 10                	mov    (%eax),%edx
+  800a60:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a65:	8d 40 04             	lea    0x4(%eax),%eax
+  800a68:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800a6b:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  800a70:	eb 54                	jmp    800ac6 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800a72:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a75:	8b 10                	mov    (%eax),%edx
+  800a77:	8b 48 04             	mov    0x4(%eax),%ecx
+  800a7a:	8d 40 08             	lea    0x8(%eax),%eax
+  800a7d:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800a80:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  800a85:	eb 3f                	jmp    800ac6 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800a87:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a8a:	8b 10                	mov    (%eax),%edx
+  800a8c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a91:	8d 40 04             	lea    0x4(%eax),%eax
+  800a94:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800a97:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  800a9c:	eb 28                	jmp    800ac6 <vprintfmt+0x3bc>
+      putch('0', putdat);
+  800a9e:	83 ec 08             	sub    $0x8,%esp
+  800aa1:	53                   	push   %ebx
+  800aa2:	6a 30                	push   $0x30
+  800aa4:	ff d6                	call   *%esi
+      putch('x', putdat);
+  800aa6:	83 c4 08             	add    $0x8,%esp
+  800aa9:	53                   	push   %ebx
+  800aaa:	6a 78                	push   $0x78
+  800aac:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  800aae:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ab1:	8b 10                	mov    (%eax),%edx
+  800ab3:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  800ab8:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  800abb:	8d 40 04             	lea    0x4(%eax),%eax
+  800abe:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800ac1:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  800ac6:	83 ec 0c             	sub    $0xc,%esp
+  800ac9:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800acd:	50                   	push   %eax
+  800ace:	ff 75 e0             	push   -0x20(%ebp)
+  800ad1:	57                   	push   %edi
+  800ad2:	51                   	push   %ecx
+  800ad3:	52                   	push   %edx
+  800ad4:	89 da                	mov    %ebx,%edx
+  800ad6:	89 f0                	mov    %esi,%eax
+  800ad8:	e8 4a fb ff ff       	call   800627 <printnum>
+      break;
+  800add:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  800ae0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  800ae3:	e9 40 fc ff ff       	jmp    800728 <vprintfmt+0x1e>
+  if (lflag >= 2)
+  800ae8:	83 f9 01             	cmp    $0x1,%ecx
+  800aeb:	7f 1b                	jg     800b08 <vprintfmt+0x3fe>
+  else if (lflag)
+  800aed:	85 c9                	test   %ecx,%ecx
+  800aef:	74 2c                	je     800b1d <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  800af1:	8b 45 14             	mov    0x14(%ebp),%eax
+  800af4:	8b 10                	mov    (%eax),%edx
+  800af6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800afb:	8d 40 04             	lea    0x4(%eax),%eax
+  800afe:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800b01:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  800b06:	eb be                	jmp    800ac6 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800b08:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b0b:	8b 10                	mov    (%eax),%edx
+  800b0d:	8b 48 04             	mov    0x4(%eax),%ecx
+  800b10:	8d 40 08             	lea    0x8(%eax),%eax
+  800b13:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800b16:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  800b1b:	eb a9                	jmp    800ac6 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800b1d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b20:	8b 10                	mov    (%eax),%edx
+  800b22:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b27:	8d 40 04             	lea    0x4(%eax),%eax
+  800b2a:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800b2d:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  800b32:	eb 92                	jmp    800ac6 <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  800b34:	83 ec 08             	sub    $0x8,%esp
+  800b37:	53                   	push   %ebx
+  800b38:	6a 25                	push   $0x25
+  800b3a:	ff d6                	call   *%esi
+      break;
+  800b3c:	83 c4 10             	add    $0x10,%esp
+  800b3f:	eb 9f                	jmp    800ae0 <vprintfmt+0x3d6>
+      putch('%', putdat);
+  800b41:	83 ec 08             	sub    $0x8,%esp
+  800b44:	53                   	push   %ebx
+  800b45:	6a 25                	push   $0x25
+  800b47:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  800b49:	83 c4 10             	add    $0x10,%esp
+  800b4c:	89 f8                	mov    %edi,%eax
+  800b4e:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800b52:	74 05                	je     800b59 <vprintfmt+0x44f>
+  800b54:	83 e8 01             	sub    $0x1,%eax
+  800b57:	eb f5                	jmp    800b4e <vprintfmt+0x444>
+  800b59:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800b5c:	eb 82                	jmp    800ae0 <vprintfmt+0x3d6>
+
+00800b5e <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800b5e:	55                   	push   %ebp
+  800b5f:	89 e5                	mov    %esp,%ebp
+  800b61:	83 ec 18             	sub    $0x18,%esp
+  800b64:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b67:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  800b6a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800b6d:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800b71:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800b74:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  800b7b:	85 c0                	test   %eax,%eax
+  800b7d:	74 26                	je     800ba5 <vsnprintf+0x47>
+  800b7f:	85 d2                	test   %edx,%edx
+  800b81:	7e 22                	jle    800ba5 <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800b83:	ff 75 14             	push   0x14(%ebp)
+  800b86:	ff 75 10             	push   0x10(%ebp)
+  800b89:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800b8c:	50                   	push   %eax
+  800b8d:	68 d0 06 80 00       	push   $0x8006d0
+  800b92:	e8 73 fb ff ff       	call   80070a <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800b97:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800b9a:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  800b9d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ba0:	83 c4 10             	add    $0x10,%esp
+}
+  800ba3:	c9                   	leave
+  800ba4:	c3                   	ret
+    return -E_INVAL;
+  800ba5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800baa:	eb f7                	jmp    800ba3 <vsnprintf+0x45>
+
+00800bac <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800bac:	55                   	push   %ebp
+  800bad:	89 e5                	mov    %esp,%ebp
+  800baf:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  800bb2:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  800bb5:	50                   	push   %eax
+  800bb6:	ff 75 10             	push   0x10(%ebp)
+  800bb9:	ff 75 0c             	push   0xc(%ebp)
+  800bbc:	ff 75 08             	push   0x8(%ebp)
+  800bbf:	e8 9a ff ff ff       	call   800b5e <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  800bc4:	c9                   	leave
+  800bc5:	c3                   	ret
+
+00800bc6 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800bc6:	55                   	push   %ebp
+  800bc7:	89 e5                	mov    %esp,%ebp
+  800bc9:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  800bcc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bd1:	eb 03                	jmp    800bd6 <strlen+0x10>
+    n++;
+  800bd3:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  800bd6:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800bda:	75 f7                	jne    800bd3 <strlen+0xd>
+  return n;
+}
+  800bdc:	5d                   	pop    %ebp
+  800bdd:	c3                   	ret
+
+00800bde <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800bde:	55                   	push   %ebp
+  800bdf:	89 e5                	mov    %esp,%ebp
+  800be1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800be4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800be7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bec:	eb 03                	jmp    800bf1 <strnlen+0x13>
+    n++;
+  800bee:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800bf1:	39 d0                	cmp    %edx,%eax
+  800bf3:	74 08                	je     800bfd <strnlen+0x1f>
+  800bf5:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800bf9:	75 f3                	jne    800bee <strnlen+0x10>
+  800bfb:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  800bfd:	89 d0                	mov    %edx,%eax
+  800bff:	5d                   	pop    %ebp
+  800c00:	c3                   	ret
+
+00800c01 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800c01:	55                   	push   %ebp
+  800c02:	89 e5                	mov    %esp,%ebp
+  800c04:	53                   	push   %ebx
+  800c05:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c08:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  800c0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c10:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800c14:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800c17:	83 c0 01             	add    $0x1,%eax
+  800c1a:	84 d2                	test   %dl,%dl
+  800c1c:	75 f2                	jne    800c10 <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  800c1e:	89 c8                	mov    %ecx,%eax
+  800c20:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c23:	c9                   	leave
+  800c24:	c3                   	ret
+
+00800c25 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800c25:	55                   	push   %ebp
+  800c26:	89 e5                	mov    %esp,%ebp
+  800c28:	53                   	push   %ebx
+  800c29:	83 ec 10             	sub    $0x10,%esp
+  800c2c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  800c2f:	53                   	push   %ebx
+  800c30:	e8 91 ff ff ff       	call   800bc6 <strlen>
+  800c35:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  800c38:	ff 75 0c             	push   0xc(%ebp)
+  800c3b:	01 d8                	add    %ebx,%eax
+  800c3d:	50                   	push   %eax
+  800c3e:	e8 be ff ff ff       	call   800c01 <strcpy>
+  return dst;
+}
+  800c43:	89 d8                	mov    %ebx,%eax
+  800c45:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c48:	c9                   	leave
+  800c49:	c3                   	ret
+
+00800c4a <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  800c4a:	55                   	push   %ebp
+  800c4b:	89 e5                	mov    %esp,%ebp
+  800c4d:	56                   	push   %esi
+  800c4e:	53                   	push   %ebx
+  800c4f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c52:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  800c55:	89 f3                	mov    %esi,%ebx
+  800c57:	03 5d 10             	add    0x10(%ebp),%ebx
+  800c5a:	89 f0                	mov    %esi,%eax
+  800c5c:	eb 0f                	jmp    800c6d <strncpy+0x23>
+    *dst++ = *src;
+  800c5e:	83 c0 01             	add    $0x1,%eax
+  800c61:	0f b6 0a             	movzbl (%edx),%ecx
+  800c64:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  800c67:	80 f9 01             	cmp    $0x1,%cl
+  800c6a:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  800c6d:	39 d8                	cmp    %ebx,%eax
+  800c6f:	75 ed                	jne    800c5e <strncpy+0x14>
+  }
+  return ret;
+}
+  800c71:	89 f0                	mov    %esi,%eax
+  800c73:	5b                   	pop    %ebx
+  800c74:	5e                   	pop    %esi
+  800c75:	5d                   	pop    %ebp
+  800c76:	c3                   	ret
+
+00800c77 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800c77:	55                   	push   %ebp
+  800c78:	89 e5                	mov    %esp,%ebp
+  800c7a:	56                   	push   %esi
+  800c7b:	53                   	push   %ebx
+  800c7c:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c7f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c82:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  800c85:	89 f0                	mov    %esi,%eax
+  800c87:	85 d2                	test   %edx,%edx
+  800c89:	74 21                	je     800cac <strlcpy+0x35>
+  800c8b:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800c8f:	89 f2                	mov    %esi,%edx
+  800c91:	eb 09                	jmp    800c9c <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  800c93:	83 c1 01             	add    $0x1,%ecx
+  800c96:	83 c2 01             	add    $0x1,%edx
+  800c99:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  800c9c:	39 c2                	cmp    %eax,%edx
+  800c9e:	74 09                	je     800ca9 <strlcpy+0x32>
+  800ca0:	0f b6 19             	movzbl (%ecx),%ebx
+  800ca3:	84 db                	test   %bl,%bl
+  800ca5:	75 ec                	jne    800c93 <strlcpy+0x1c>
+  800ca7:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  800ca9:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  800cac:	29 f0                	sub    %esi,%eax
+}
+  800cae:	5b                   	pop    %ebx
+  800caf:	5e                   	pop    %esi
+  800cb0:	5d                   	pop    %ebp
+  800cb1:	c3                   	ret
+
+00800cb2 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800cb2:	55                   	push   %ebp
+  800cb3:	89 e5                	mov    %esp,%ebp
+  800cb5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800cb8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  800cbb:	eb 06                	jmp    800cc3 <strcmp+0x11>
+    p++, q++;
+  800cbd:	83 c1 01             	add    $0x1,%ecx
+  800cc0:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  800cc3:	0f b6 01             	movzbl (%ecx),%eax
+  800cc6:	84 c0                	test   %al,%al
+  800cc8:	74 04                	je     800cce <strcmp+0x1c>
+  800cca:	3a 02                	cmp    (%edx),%al
+  800ccc:	74 ef                	je     800cbd <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  800cce:	0f b6 c0             	movzbl %al,%eax
+  800cd1:	0f b6 12             	movzbl (%edx),%edx
+  800cd4:	29 d0                	sub    %edx,%eax
+}
+  800cd6:	5d                   	pop    %ebp
+  800cd7:	c3                   	ret
+
+00800cd8 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800cd8:	55                   	push   %ebp
+  800cd9:	89 e5                	mov    %esp,%ebp
+  800cdb:	53                   	push   %ebx
+  800cdc:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cdf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ce2:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  800ce5:	eb 09                	jmp    800cf0 <strncmp+0x18>
+    n--, p++, q++;
+  800ce7:	83 ea 01             	sub    $0x1,%edx
+  800cea:	83 c0 01             	add    $0x1,%eax
+  800ced:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  800cf0:	85 d2                	test   %edx,%edx
+  800cf2:	74 18                	je     800d0c <strncmp+0x34>
+  800cf4:	0f b6 18             	movzbl (%eax),%ebx
+  800cf7:	84 db                	test   %bl,%bl
+  800cf9:	74 04                	je     800cff <strncmp+0x27>
+  800cfb:	3a 19                	cmp    (%ecx),%bl
+  800cfd:	74 e8                	je     800ce7 <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800cff:	0f b6 00             	movzbl (%eax),%eax
+  800d02:	0f b6 11             	movzbl (%ecx),%edx
+  800d05:	29 d0                	sub    %edx,%eax
+}
+  800d07:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d0a:	c9                   	leave
+  800d0b:	c3                   	ret
+    return 0;
+  800d0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d11:	eb f4                	jmp    800d07 <strncmp+0x2f>
+
+00800d13 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800d13:	55                   	push   %ebp
+  800d14:	89 e5                	mov    %esp,%ebp
+  800d16:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d19:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800d1d:	eb 03                	jmp    800d22 <strchr+0xf>
+  800d1f:	83 c0 01             	add    $0x1,%eax
+  800d22:	0f b6 10             	movzbl (%eax),%edx
+  800d25:	84 d2                	test   %dl,%dl
+  800d27:	74 06                	je     800d2f <strchr+0x1c>
+    if (*s == c)
+  800d29:	38 ca                	cmp    %cl,%dl
+  800d2b:	75 f2                	jne    800d1f <strchr+0xc>
+  800d2d:	eb 05                	jmp    800d34 <strchr+0x21>
+      return (char*)s;
+  return 0;
+  800d2f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d34:	5d                   	pop    %ebp
+  800d35:	c3                   	ret
+
+00800d36 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800d36:	55                   	push   %ebp
+  800d37:	89 e5                	mov    %esp,%ebp
+  800d39:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d3c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800d40:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  800d43:	38 ca                	cmp    %cl,%dl
+  800d45:	74 09                	je     800d50 <strfind+0x1a>
+  800d47:	84 d2                	test   %dl,%dl
+  800d49:	74 05                	je     800d50 <strfind+0x1a>
+  for (; *s; s++)
+  800d4b:	83 c0 01             	add    $0x1,%eax
+  800d4e:	eb f0                	jmp    800d40 <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  800d50:	5d                   	pop    %ebp
+  800d51:	c3                   	ret
+
+00800d52 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800d52:	55                   	push   %ebp
+  800d53:	89 e5                	mov    %esp,%ebp
+  800d55:	57                   	push   %edi
+  800d56:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800d59:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  800d5c:	85 c9                	test   %ecx,%ecx
+  800d5e:	74 20                	je     800d80 <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  800d60:	89 f8                	mov    %edi,%eax
+  800d62:	09 c8                	or     %ecx,%eax
+  800d64:	a8 03                	test   $0x3,%al
+  800d66:	75 12                	jne    800d7a <memset+0x28>
+    c &= 0xFF;
+  800d68:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800d6c:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  800d72:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  800d75:	fc                   	cld
+  800d76:	f3 ab                	rep stos %eax,%es:(%edi)
+  800d78:	eb 06                	jmp    800d80 <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  800d7a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d7d:	fc                   	cld
+  800d7e:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  800d80:	89 f8                	mov    %edi,%eax
+  800d82:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800d85:	c9                   	leave
+  800d86:	c3                   	ret
+
+00800d87 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800d87:	55                   	push   %ebp
+  800d88:	89 e5                	mov    %esp,%ebp
+  800d8a:	57                   	push   %edi
+  800d8b:	56                   	push   %esi
+  800d8c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d8f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800d92:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  800d95:	39 c6                	cmp    %eax,%esi
+  800d97:	73 32                	jae    800dcb <memmove+0x44>
+  800d99:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800d9c:	39 d0                	cmp    %edx,%eax
+  800d9e:	73 2b                	jae    800dcb <memmove+0x44>
+    s += n;
+    d += n;
+  800da0:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800da3:	89 d6                	mov    %edx,%esi
+  800da5:	09 fe                	or     %edi,%esi
+  800da7:	09 ce                	or     %ecx,%esi
+  800da9:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800daf:	75 0e                	jne    800dbf <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800db1:	83 ef 04             	sub    $0x4,%edi
+  800db4:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800db7:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  800dba:	fd                   	std
+  800dbb:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800dbd:	eb 09                	jmp    800dc8 <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800dbf:	83 ef 01             	sub    $0x1,%edi
+  800dc2:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  800dc5:	fd                   	std
+  800dc6:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  800dc8:	fc                   	cld
+  800dc9:	eb 1a                	jmp    800de5 <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800dcb:	89 f2                	mov    %esi,%edx
+  800dcd:	09 c2                	or     %eax,%edx
+  800dcf:	09 ca                	or     %ecx,%edx
+  800dd1:	f6 c2 03             	test   $0x3,%dl
+  800dd4:	75 0a                	jne    800de0 <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800dd6:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  800dd9:	89 c7                	mov    %eax,%edi
+  800ddb:	fc                   	cld
+  800ddc:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800dde:	eb 05                	jmp    800de5 <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  800de0:	89 c7                	mov    %eax,%edi
+  800de2:	fc                   	cld
+  800de3:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  800de5:	5e                   	pop    %esi
+  800de6:	5f                   	pop    %edi
+  800de7:	5d                   	pop    %ebp
+  800de8:	c3                   	ret
+
+00800de9 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800de9:	55                   	push   %ebp
+  800dea:	89 e5                	mov    %esp,%ebp
+  800dec:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  800def:	ff 75 10             	push   0x10(%ebp)
+  800df2:	ff 75 0c             	push   0xc(%ebp)
+  800df5:	ff 75 08             	push   0x8(%ebp)
+  800df8:	e8 8a ff ff ff       	call   800d87 <memmove>
+}
+  800dfd:	c9                   	leave
+  800dfe:	c3                   	ret
+
+00800dff <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800dff:	55                   	push   %ebp
+  800e00:	89 e5                	mov    %esp,%ebp
+  800e02:	56                   	push   %esi
+  800e03:	53                   	push   %ebx
+  800e04:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e07:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  800e0a:	89 c6                	mov    %eax,%esi
+  800e0c:	03 75 10             	add    0x10(%ebp),%esi
+  800e0f:	eb 06                	jmp    800e17 <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  800e11:	83 c0 01             	add    $0x1,%eax
+  800e14:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  800e17:	39 f0                	cmp    %esi,%eax
+  800e19:	74 14                	je     800e2f <memcmp+0x30>
+    if (*s1 != *s2)
+  800e1b:	0f b6 08             	movzbl (%eax),%ecx
+  800e1e:	0f b6 1a             	movzbl (%edx),%ebx
+  800e21:	38 d9                	cmp    %bl,%cl
+  800e23:	74 ec                	je     800e11 <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  800e25:	0f b6 c1             	movzbl %cl,%eax
+  800e28:	0f b6 db             	movzbl %bl,%ebx
+  800e2b:	29 d8                	sub    %ebx,%eax
+  800e2d:	eb 05                	jmp    800e34 <memcmp+0x35>
+  }
+
+  return 0;
+  800e2f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e34:	5b                   	pop    %ebx
+  800e35:	5e                   	pop    %esi
+  800e36:	5d                   	pop    %ebp
+  800e37:	c3                   	ret
+
+00800e38 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800e38:	55                   	push   %ebp
+  800e39:	89 e5                	mov    %esp,%ebp
+  800e3b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e3e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  800e41:	89 c2                	mov    %eax,%edx
+  800e43:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  800e46:	eb 03                	jmp    800e4b <memfind+0x13>
+  800e48:	83 c0 01             	add    $0x1,%eax
+  800e4b:	39 d0                	cmp    %edx,%eax
+  800e4d:	73 04                	jae    800e53 <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  800e4f:	38 08                	cmp    %cl,(%eax)
+  800e51:	75 f5                	jne    800e48 <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  800e53:	5d                   	pop    %ebp
+  800e54:	c3                   	ret
+
+00800e55 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800e55:	55                   	push   %ebp
+  800e56:	89 e5                	mov    %esp,%ebp
+  800e58:	57                   	push   %edi
+  800e59:	56                   	push   %esi
+  800e5a:	53                   	push   %ebx
+  800e5b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e5e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  800e61:	eb 03                	jmp    800e66 <strtol+0x11>
+    s++;
+  800e63:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  800e66:	0f b6 02             	movzbl (%edx),%eax
+  800e69:	3c 20                	cmp    $0x20,%al
+  800e6b:	74 f6                	je     800e63 <strtol+0xe>
+  800e6d:	3c 09                	cmp    $0x9,%al
+  800e6f:	74 f2                	je     800e63 <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  800e71:	3c 2b                	cmp    $0x2b,%al
+  800e73:	74 2a                	je     800e9f <strtol+0x4a>
+  int neg = 0;
+  800e75:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  800e7a:	3c 2d                	cmp    $0x2d,%al
+  800e7c:	74 2b                	je     800ea9 <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e7e:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800e84:	75 0f                	jne    800e95 <strtol+0x40>
+  800e86:	80 3a 30             	cmpb   $0x30,(%edx)
+  800e89:	74 28                	je     800eb3 <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  800e8b:	85 db                	test   %ebx,%ebx
+  800e8d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e92:	0f 44 d8             	cmove  %eax,%ebx
+  800e95:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e9a:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800e9d:	eb 46                	jmp    800ee5 <strtol+0x90>
+    s++;
+  800e9f:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  800ea2:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ea7:	eb d5                	jmp    800e7e <strtol+0x29>
+    s++, neg = 1;
+  800ea9:	83 c2 01             	add    $0x1,%edx
+  800eac:	bf 01 00 00 00       	mov    $0x1,%edi
+  800eb1:	eb cb                	jmp    800e7e <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800eb3:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800eb7:	74 0e                	je     800ec7 <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  800eb9:	85 db                	test   %ebx,%ebx
+  800ebb:	75 d8                	jne    800e95 <strtol+0x40>
+    s++, base = 8;
+  800ebd:	83 c2 01             	add    $0x1,%edx
+  800ec0:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800ec5:	eb ce                	jmp    800e95 <strtol+0x40>
+    s += 2, base = 16;
+  800ec7:	83 c2 02             	add    $0x2,%edx
+  800eca:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800ecf:	eb c4                	jmp    800e95 <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  800ed1:	0f be c0             	movsbl %al,%eax
+  800ed4:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  800ed7:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800eda:	7d 3a                	jge    800f16 <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  800edc:	83 c2 01             	add    $0x1,%edx
+  800edf:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800ee3:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  800ee5:	0f b6 02             	movzbl (%edx),%eax
+  800ee8:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800eeb:	89 f3                	mov    %esi,%ebx
+  800eed:	80 fb 09             	cmp    $0x9,%bl
+  800ef0:	76 df                	jbe    800ed1 <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  800ef2:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800ef5:	89 f3                	mov    %esi,%ebx
+  800ef7:	80 fb 19             	cmp    $0x19,%bl
+  800efa:	77 08                	ja     800f04 <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  800efc:	0f be c0             	movsbl %al,%eax
+  800eff:	83 e8 57             	sub    $0x57,%eax
+  800f02:	eb d3                	jmp    800ed7 <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  800f04:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800f07:	89 f3                	mov    %esi,%ebx
+  800f09:	80 fb 19             	cmp    $0x19,%bl
+  800f0c:	77 08                	ja     800f16 <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  800f0e:	0f be c0             	movsbl %al,%eax
+  800f11:	83 e8 37             	sub    $0x37,%eax
+  800f14:	eb c1                	jmp    800ed7 <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  800f16:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800f1a:	74 05                	je     800f21 <strtol+0xcc>
+    *endptr = (char*)s;
+  800f1c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f1f:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  800f21:	89 c8                	mov    %ecx,%eax
+  800f23:	f7 d8                	neg    %eax
+  800f25:	85 ff                	test   %edi,%edi
+  800f27:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800f2a:	89 c8                	mov    %ecx,%eax
+  800f2c:	5b                   	pop    %ebx
+  800f2d:	5e                   	pop    %esi
+  800f2e:	5f                   	pop    %edi
+  800f2f:	5d                   	pop    %ebp
+  800f30:	c3                   	ret
+
+00800f31 <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800f31:	55                   	push   %ebp
+  800f32:	89 e5                	mov    %esp,%ebp
+  800f34:	57                   	push   %edi
+  800f35:	56                   	push   %esi
+  800f36:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f37:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f3c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f3f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f42:	89 c3                	mov    %eax,%ebx
+  800f44:	89 c7                	mov    %eax,%edi
+  800f46:	89 c6                	mov    %eax,%esi
+  800f48:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800f4a:	5b                   	pop    %ebx
+  800f4b:	5e                   	pop    %esi
+  800f4c:	5f                   	pop    %edi
+  800f4d:	5d                   	pop    %ebp
+  800f4e:	c3                   	ret
+
+00800f4f <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800f4f:	55                   	push   %ebp
+  800f50:	89 e5                	mov    %esp,%ebp
+  800f52:	57                   	push   %edi
+  800f53:	56                   	push   %esi
+  800f54:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f55:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f5a:	b8 01 00 00 00       	mov    $0x1,%eax
+  800f5f:	89 d1                	mov    %edx,%ecx
+  800f61:	89 d3                	mov    %edx,%ebx
+  800f63:	89 d7                	mov    %edx,%edi
+  800f65:	89 d6                	mov    %edx,%esi
+  800f67:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800f69:	5b                   	pop    %ebx
+  800f6a:	5e                   	pop    %esi
+  800f6b:	5f                   	pop    %edi
+  800f6c:	5d                   	pop    %ebp
+  800f6d:	c3                   	ret
+
+00800f6e <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800f6e:	55                   	push   %ebp
+  800f6f:	89 e5                	mov    %esp,%ebp
+  800f71:	57                   	push   %edi
+  800f72:	56                   	push   %esi
+  800f73:	53                   	push   %ebx
+  800f74:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f77:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f7c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f7f:	b8 03 00 00 00       	mov    $0x3,%eax
+  800f84:	89 cb                	mov    %ecx,%ebx
+  800f86:	89 cf                	mov    %ecx,%edi
+  800f88:	89 ce                	mov    %ecx,%esi
+  800f8a:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f8c:	85 c0                	test   %eax,%eax
+  800f8e:	7f 08                	jg     800f98 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800f90:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f93:	5b                   	pop    %ebx
+  800f94:	5e                   	pop    %esi
+  800f95:	5f                   	pop    %edi
+  800f96:	5d                   	pop    %ebp
+  800f97:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f98:	83 ec 0c             	sub    $0xc,%esp
+  800f9b:	50                   	push   %eax
+  800f9c:	6a 03                	push   $0x3
+  800f9e:	68 43 42 80 00       	push   $0x804243
+  800fa3:	6a 23                	push   $0x23
+  800fa5:	68 60 42 80 00       	push   $0x804260
+  800faa:	e8 89 f5 ff ff       	call   800538 <_panic>
+
+00800faf <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800faf:	55                   	push   %ebp
+  800fb0:	89 e5                	mov    %esp,%ebp
+  800fb2:	57                   	push   %edi
+  800fb3:	56                   	push   %esi
+  800fb4:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800fb5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fba:	b8 02 00 00 00       	mov    $0x2,%eax
+  800fbf:	89 d1                	mov    %edx,%ecx
+  800fc1:	89 d3                	mov    %edx,%ebx
+  800fc3:	89 d7                	mov    %edx,%edi
+  800fc5:	89 d6                	mov    %edx,%esi
+  800fc7:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800fc9:	5b                   	pop    %ebx
+  800fca:	5e                   	pop    %esi
+  800fcb:	5f                   	pop    %edi
+  800fcc:	5d                   	pop    %ebp
+  800fcd:	c3                   	ret
+
+00800fce <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800fce:	55                   	push   %ebp
+  800fcf:	89 e5                	mov    %esp,%ebp
+  800fd1:	57                   	push   %edi
+  800fd2:	56                   	push   %esi
+  800fd3:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800fd4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fd9:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800fde:	89 d1                	mov    %edx,%ecx
+  800fe0:	89 d3                	mov    %edx,%ebx
+  800fe2:	89 d7                	mov    %edx,%edi
+  800fe4:	89 d6                	mov    %edx,%esi
+  800fe6:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800fe8:	5b                   	pop    %ebx
+  800fe9:	5e                   	pop    %esi
+  800fea:	5f                   	pop    %edi
+  800feb:	5d                   	pop    %ebp
+  800fec:	c3                   	ret
+
+00800fed <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  800fed:	55                   	push   %ebp
+  800fee:	89 e5                	mov    %esp,%ebp
+  800ff0:	57                   	push   %edi
+  800ff1:	56                   	push   %esi
+  800ff2:	53                   	push   %ebx
+  800ff3:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  800ff6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  800ffa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fff:	8b 55 08             	mov    0x8(%ebp),%edx
+  801002:	b8 14 00 00 00       	mov    $0x14,%eax
+  801007:	89 df                	mov    %ebx,%edi
+  801009:	89 de                	mov    %ebx,%esi
+  80100b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80100d:	85 c0                	test   %eax,%eax
+  80100f:	7f 08                	jg     801019 <sys_env_set_cow+0x2c>
+}
+  801011:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801014:	5b                   	pop    %ebx
+  801015:	5e                   	pop    %esi
+  801016:	5f                   	pop    %edi
+  801017:	5d                   	pop    %ebp
+  801018:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801019:	83 ec 0c             	sub    $0xc,%esp
+  80101c:	50                   	push   %eax
+  80101d:	6a 14                	push   $0x14
+  80101f:	68 43 42 80 00       	push   $0x804243
+  801024:	6a 23                	push   $0x23
+  801026:	68 60 42 80 00       	push   $0x804260
+  80102b:	e8 08 f5 ff ff       	call   800538 <_panic>
+
+00801030 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  801030:	55                   	push   %ebp
+  801031:	89 e5                	mov    %esp,%ebp
+  801033:	57                   	push   %edi
+  801034:	56                   	push   %esi
+  801035:	53                   	push   %ebx
+  801036:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801039:	be 00 00 00 00       	mov    $0x0,%esi
+  80103e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801041:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801044:	b8 04 00 00 00       	mov    $0x4,%eax
+  801049:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80104c:	89 f7                	mov    %esi,%edi
+  80104e:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801050:	85 c0                	test   %eax,%eax
+  801052:	7f 08                	jg     80105c <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  801054:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801057:	5b                   	pop    %ebx
+  801058:	5e                   	pop    %esi
+  801059:	5f                   	pop    %edi
+  80105a:	5d                   	pop    %ebp
+  80105b:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80105c:	83 ec 0c             	sub    $0xc,%esp
+  80105f:	50                   	push   %eax
+  801060:	6a 04                	push   $0x4
+  801062:	68 43 42 80 00       	push   $0x804243
+  801067:	6a 23                	push   $0x23
+  801069:	68 60 42 80 00       	push   $0x804260
+  80106e:	e8 c5 f4 ff ff       	call   800538 <_panic>
+
+00801073 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  801073:	55                   	push   %ebp
+  801074:	89 e5                	mov    %esp,%ebp
+  801076:	57                   	push   %edi
+  801077:	56                   	push   %esi
+  801078:	53                   	push   %ebx
+  801079:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80107c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80107f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801082:	b8 05 00 00 00       	mov    $0x5,%eax
+  801087:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80108a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80108d:	8b 75 18             	mov    0x18(%ebp),%esi
+  801090:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801092:	85 c0                	test   %eax,%eax
+  801094:	7f 08                	jg     80109e <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  801096:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801099:	5b                   	pop    %ebx
+  80109a:	5e                   	pop    %esi
+  80109b:	5f                   	pop    %edi
+  80109c:	5d                   	pop    %ebp
+  80109d:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80109e:	83 ec 0c             	sub    $0xc,%esp
+  8010a1:	50                   	push   %eax
+  8010a2:	6a 05                	push   $0x5
+  8010a4:	68 43 42 80 00       	push   $0x804243
+  8010a9:	6a 23                	push   $0x23
+  8010ab:	68 60 42 80 00       	push   $0x804260
+  8010b0:	e8 83 f4 ff ff       	call   800538 <_panic>
+
+008010b5 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  8010b5:	55                   	push   %ebp
+  8010b6:	89 e5                	mov    %esp,%ebp
+  8010b8:	57                   	push   %edi
+  8010b9:	56                   	push   %esi
+  8010ba:	53                   	push   %ebx
+  8010bb:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8010be:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010c6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010c9:	b8 06 00 00 00       	mov    $0x6,%eax
+  8010ce:	89 df                	mov    %ebx,%edi
+  8010d0:	89 de                	mov    %ebx,%esi
+  8010d2:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8010d4:	85 c0                	test   %eax,%eax
+  8010d6:	7f 08                	jg     8010e0 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  8010d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010db:	5b                   	pop    %ebx
+  8010dc:	5e                   	pop    %esi
+  8010dd:	5f                   	pop    %edi
+  8010de:	5d                   	pop    %ebp
+  8010df:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8010e0:	83 ec 0c             	sub    $0xc,%esp
+  8010e3:	50                   	push   %eax
+  8010e4:	6a 06                	push   $0x6
+  8010e6:	68 43 42 80 00       	push   $0x804243
+  8010eb:	6a 23                	push   $0x23
+  8010ed:	68 60 42 80 00       	push   $0x804260
+  8010f2:	e8 41 f4 ff ff       	call   800538 <_panic>
+
+008010f7 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  8010f7:	55                   	push   %ebp
+  8010f8:	89 e5                	mov    %esp,%ebp
+  8010fa:	57                   	push   %edi
+  8010fb:	56                   	push   %esi
+  8010fc:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8010fd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801100:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801103:	b8 11 00 00 00       	mov    $0x11,%eax
+  801108:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80110b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80110e:	8b 75 18             	mov    0x18(%ebp),%esi
+  801111:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  801113:	5b                   	pop    %ebx
+  801114:	5e                   	pop    %esi
+  801115:	5f                   	pop    %edi
+  801116:	5d                   	pop    %ebp
+  801117:	c3                   	ret
+
+00801118 <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  801118:	55                   	push   %ebp
+  801119:	89 e5                	mov    %esp,%ebp
+  80111b:	57                   	push   %edi
+  80111c:	56                   	push   %esi
+  80111d:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80111e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801121:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801124:	b8 12 00 00 00       	mov    $0x12,%eax
+  801129:	be 00 00 00 00       	mov    $0x0,%esi
+  80112e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801131:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801134:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  801136:	5b                   	pop    %ebx
+  801137:	5e                   	pop    %esi
+  801138:	5f                   	pop    %edi
+  801139:	5d                   	pop    %ebp
+  80113a:	c3                   	ret
+
+0080113b <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  80113b:	55                   	push   %ebp
+  80113c:	89 e5                	mov    %esp,%ebp
+  80113e:	57                   	push   %edi
+  80113f:	56                   	push   %esi
+  801140:	53                   	push   %ebx
+  801141:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801144:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801149:	8b 55 08             	mov    0x8(%ebp),%edx
+  80114c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80114f:	b8 16 00 00 00       	mov    $0x16,%eax
+  801154:	89 df                	mov    %ebx,%edi
+  801156:	89 de                	mov    %ebx,%esi
+  801158:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80115a:	85 c0                	test   %eax,%eax
+  80115c:	7f 08                	jg     801166 <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  80115e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801161:	5b                   	pop    %ebx
+  801162:	5e                   	pop    %esi
+  801163:	5f                   	pop    %edi
+  801164:	5d                   	pop    %ebp
+  801165:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801166:	83 ec 0c             	sub    $0xc,%esp
+  801169:	50                   	push   %eax
+  80116a:	6a 16                	push   $0x16
+  80116c:	68 43 42 80 00       	push   $0x804243
+  801171:	6a 23                	push   $0x23
+  801173:	68 60 42 80 00       	push   $0x804260
+  801178:	e8 bb f3 ff ff       	call   800538 <_panic>
+
+0080117d <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  80117d:	55                   	push   %ebp
+  80117e:	89 e5                	mov    %esp,%ebp
+  801180:	57                   	push   %edi
+  801181:	56                   	push   %esi
+  801182:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801183:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801188:	8b 55 08             	mov    0x8(%ebp),%edx
+  80118b:	b8 17 00 00 00       	mov    $0x17,%eax
+  801190:	89 cb                	mov    %ecx,%ebx
+  801192:	89 cf                	mov    %ecx,%edi
+  801194:	89 ce                	mov    %ecx,%esi
+  801196:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  801198:	5b                   	pop    %ebx
+  801199:	5e                   	pop    %esi
+  80119a:	5f                   	pop    %edi
+  80119b:	5d                   	pop    %ebp
+  80119c:	c3                   	ret
+
+0080119d <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  80119d:	55                   	push   %ebp
+  80119e:	89 e5                	mov    %esp,%ebp
+  8011a0:	57                   	push   %edi
+  8011a1:	56                   	push   %esi
+  8011a2:	53                   	push   %ebx
+  8011a3:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8011a6:	be 00 00 00 00       	mov    $0x0,%esi
+  8011ab:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011b1:	b8 18 00 00 00       	mov    $0x18,%eax
+  8011b6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011b9:	89 f7                	mov    %esi,%edi
+  8011bb:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8011bd:	85 c0                	test   %eax,%eax
+  8011bf:	7f 08                	jg     8011c9 <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  8011c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011c4:	5b                   	pop    %ebx
+  8011c5:	5e                   	pop    %esi
+  8011c6:	5f                   	pop    %edi
+  8011c7:	5d                   	pop    %ebp
+  8011c8:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8011c9:	83 ec 0c             	sub    $0xc,%esp
+  8011cc:	50                   	push   %eax
+  8011cd:	6a 18                	push   $0x18
+  8011cf:	68 43 42 80 00       	push   $0x804243
+  8011d4:	6a 23                	push   $0x23
+  8011d6:	68 60 42 80 00       	push   $0x804260
+  8011db:	e8 58 f3 ff ff       	call   800538 <_panic>
+
+008011e0 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  8011e0:	55                   	push   %ebp
+  8011e1:	89 e5                	mov    %esp,%ebp
+  8011e3:	57                   	push   %edi
+  8011e4:	56                   	push   %esi
+  8011e5:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8011e6:	be 00 00 00 00       	mov    $0x0,%esi
+  8011eb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011f1:	b8 19 00 00 00       	mov    $0x19,%eax
+  8011f6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011f9:	89 f7                	mov    %esi,%edi
+  8011fb:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  8011fd:	5b                   	pop    %ebx
+  8011fe:	5e                   	pop    %esi
+  8011ff:	5f                   	pop    %edi
+  801200:	5d                   	pop    %ebp
+  801201:	c3                   	ret
+
+00801202 <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  801202:	55                   	push   %ebp
+  801203:	89 e5                	mov    %esp,%ebp
+  801205:	57                   	push   %edi
+  801206:	56                   	push   %esi
+  801207:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801208:	ba 00 00 00 00       	mov    $0x0,%edx
+  80120d:	b8 15 00 00 00       	mov    $0x15,%eax
+  801212:	89 d1                	mov    %edx,%ecx
+  801214:	89 d3                	mov    %edx,%ebx
+  801216:	89 d7                	mov    %edx,%edi
+  801218:	89 d6                	mov    %edx,%esi
+  80121a:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  80121c:	5b                   	pop    %ebx
+  80121d:	5e                   	pop    %esi
+  80121e:	5f                   	pop    %edi
+  80121f:	5d                   	pop    %ebp
+  801220:	c3                   	ret
+
+00801221 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801221:	55                   	push   %ebp
+  801222:	89 e5                	mov    %esp,%ebp
+  801224:	57                   	push   %edi
+  801225:	56                   	push   %esi
+  801226:	53                   	push   %ebx
+  801227:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80122a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80122f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801232:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801235:	b8 08 00 00 00       	mov    $0x8,%eax
+  80123a:	89 df                	mov    %ebx,%edi
+  80123c:	89 de                	mov    %ebx,%esi
+  80123e:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801240:	85 c0                	test   %eax,%eax
+  801242:	7f 08                	jg     80124c <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801244:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801247:	5b                   	pop    %ebx
+  801248:	5e                   	pop    %esi
+  801249:	5f                   	pop    %edi
+  80124a:	5d                   	pop    %ebp
+  80124b:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80124c:	83 ec 0c             	sub    $0xc,%esp
+  80124f:	50                   	push   %eax
+  801250:	6a 08                	push   $0x8
+  801252:	68 43 42 80 00       	push   $0x804243
+  801257:	6a 23                	push   $0x23
+  801259:	68 60 42 80 00       	push   $0x804260
+  80125e:	e8 d5 f2 ff ff       	call   800538 <_panic>
+
+00801263 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801263:	55                   	push   %ebp
+  801264:	89 e5                	mov    %esp,%ebp
+  801266:	57                   	push   %edi
+  801267:	56                   	push   %esi
+  801268:	53                   	push   %ebx
+  801269:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80126c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801271:	8b 55 08             	mov    0x8(%ebp),%edx
+  801274:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801277:	b8 09 00 00 00       	mov    $0x9,%eax
+  80127c:	89 df                	mov    %ebx,%edi
+  80127e:	89 de                	mov    %ebx,%esi
+  801280:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801282:	85 c0                	test   %eax,%eax
+  801284:	7f 08                	jg     80128e <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  801286:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801289:	5b                   	pop    %ebx
+  80128a:	5e                   	pop    %esi
+  80128b:	5f                   	pop    %edi
+  80128c:	5d                   	pop    %ebp
+  80128d:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80128e:	83 ec 0c             	sub    $0xc,%esp
+  801291:	50                   	push   %eax
+  801292:	6a 09                	push   $0x9
+  801294:	68 43 42 80 00       	push   $0x804243
+  801299:	6a 23                	push   $0x23
+  80129b:	68 60 42 80 00       	push   $0x804260
+  8012a0:	e8 93 f2 ff ff       	call   800538 <_panic>
+
+008012a5 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8012a5:	55                   	push   %ebp
+  8012a6:	89 e5                	mov    %esp,%ebp
+  8012a8:	57                   	push   %edi
+  8012a9:	56                   	push   %esi
+  8012aa:	53                   	push   %ebx
+  8012ab:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8012ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012b6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012b9:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8012be:	89 df                	mov    %ebx,%edi
+  8012c0:	89 de                	mov    %ebx,%esi
+  8012c2:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8012c4:	85 c0                	test   %eax,%eax
+  8012c6:	7f 08                	jg     8012d0 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  8012c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012cb:	5b                   	pop    %ebx
+  8012cc:	5e                   	pop    %esi
+  8012cd:	5f                   	pop    %edi
+  8012ce:	5d                   	pop    %ebp
+  8012cf:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8012d0:	83 ec 0c             	sub    $0xc,%esp
+  8012d3:	50                   	push   %eax
+  8012d4:	6a 0a                	push   $0xa
+  8012d6:	68 43 42 80 00       	push   $0x804243
+  8012db:	6a 23                	push   $0x23
+  8012dd:	68 60 42 80 00       	push   $0x804260
+  8012e2:	e8 51 f2 ff ff       	call   800538 <_panic>
+
+008012e7 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  8012e7:	55                   	push   %ebp
+  8012e8:	89 e5                	mov    %esp,%ebp
+  8012ea:	57                   	push   %edi
+  8012eb:	56                   	push   %esi
+  8012ec:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8012ed:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012f0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012f3:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8012f8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012fb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012fe:	8b 75 18             	mov    0x18(%ebp),%esi
+  801301:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  801303:	5b                   	pop    %ebx
+  801304:	5e                   	pop    %esi
+  801305:	5f                   	pop    %edi
+  801306:	5d                   	pop    %ebp
+  801307:	c3                   	ret
+
+00801308 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  801308:	55                   	push   %ebp
+  801309:	89 e5                	mov    %esp,%ebp
+  80130b:	57                   	push   %edi
+  80130c:	56                   	push   %esi
+  80130d:	53                   	push   %ebx
+  80130e:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801311:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801316:	8b 55 08             	mov    0x8(%ebp),%edx
+  801319:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80131c:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801321:	89 df                	mov    %ebx,%edi
+  801323:	89 de                	mov    %ebx,%esi
+  801325:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801327:	85 c0                	test   %eax,%eax
+  801329:	7f 08                	jg     801333 <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  80132b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80132e:	5b                   	pop    %ebx
+  80132f:	5e                   	pop    %esi
+  801330:	5f                   	pop    %edi
+  801331:	5d                   	pop    %ebp
+  801332:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801333:	83 ec 0c             	sub    $0xc,%esp
+  801336:	50                   	push   %eax
+  801337:	6a 0d                	push   $0xd
+  801339:	68 43 42 80 00       	push   $0x804243
+  80133e:	6a 23                	push   $0x23
+  801340:	68 60 42 80 00       	push   $0x804260
+  801345:	e8 ee f1 ff ff       	call   800538 <_panic>
+
+0080134a <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  80134a:	55                   	push   %ebp
+  80134b:	89 e5                	mov    %esp,%ebp
+  80134d:	57                   	push   %edi
+  80134e:	56                   	push   %esi
+  80134f:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801350:	ba 00 00 00 00       	mov    $0x0,%edx
+  801355:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80135a:	89 d1                	mov    %edx,%ecx
+  80135c:	89 d3                	mov    %edx,%ebx
+  80135e:	89 d7                	mov    %edx,%edi
+  801360:	89 d6                	mov    %edx,%esi
+  801362:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801364:	5b                   	pop    %ebx
+  801365:	5e                   	pop    %esi
+  801366:	5f                   	pop    %edi
+  801367:	5d                   	pop    %ebp
+  801368:	c3                   	ret
+
+00801369 <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  801369:	55                   	push   %ebp
+  80136a:	89 e5                	mov    %esp,%ebp
+  80136c:	57                   	push   %edi
+  80136d:	56                   	push   %esi
+  80136e:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80136f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801372:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801375:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80137a:	be 00 00 00 00       	mov    $0x0,%esi
+  80137f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801382:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801385:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  801387:	5b                   	pop    %ebx
+  801388:	5e                   	pop    %esi
+  801389:	5f                   	pop    %edi
+  80138a:	5d                   	pop    %ebp
+  80138b:	c3                   	ret
+
+0080138c <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  80138c:	55                   	push   %ebp
+  80138d:	89 e5                	mov    %esp,%ebp
+  80138f:	57                   	push   %edi
+  801390:	56                   	push   %esi
+  801391:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801392:	be 00 00 00 00       	mov    $0x0,%esi
+  801397:	8b 55 08             	mov    0x8(%ebp),%edx
+  80139a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80139d:	b8 10 00 00 00       	mov    $0x10,%eax
+  8013a2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013a5:	89 f7                	mov    %esi,%edi
+  8013a7:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  8013a9:	5b                   	pop    %ebx
+  8013aa:	5e                   	pop    %esi
+  8013ab:	5f                   	pop    %edi
+  8013ac:	5d                   	pop    %ebp
+  8013ad:	c3                   	ret
+
+008013ae <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  8013ae:	55                   	push   %ebp
+  8013af:	89 e5                	mov    %esp,%ebp
+  8013b1:	57                   	push   %edi
+  8013b2:	56                   	push   %esi
+  8013b3:	53                   	push   %ebx
+  8013b4:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  8013b7:	80 3d a4 78 80 00 00 	cmpb   $0x0,0x8078a4
+  8013be:	74 41                	je     801401 <sys_batch+0x53>
+  8013c0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013c3:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  8013c6:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  8013cd:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8013d0:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  8013d3:	7d 45                	jge    80141a <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  8013d5:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8013d8:	8b 06                	mov    (%esi),%eax
+  8013da:	8b 56 04             	mov    0x4(%esi),%edx
+  8013dd:	8b 4e 08             	mov    0x8(%esi),%ecx
+  8013e0:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  8013e3:	8b 7e 10             	mov    0x10(%esi),%edi
+  8013e6:	8b 76 14             	mov    0x14(%esi),%esi
+  8013e9:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  8013eb:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8013ee:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  8013f1:	83 c6 1c             	add    $0x1c,%esi
+  8013f4:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  8013f7:	85 c0                	test   %eax,%eax
+  8013f9:	78 1f                	js     80141a <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  8013fb:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  8013ff:	eb cc                	jmp    8013cd <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  801401:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801406:	b8 13 00 00 00       	mov    $0x13,%eax
+  80140b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80140e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801411:	89 df                	mov    %ebx,%edi
+  801413:	89 de                	mov    %ebx,%esi
+  801415:	cd 30                	int    $0x30
+  801417:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  80141a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80141d:	83 c4 08             	add    $0x8,%esp
+  801420:	5b                   	pop    %ebx
+  801421:	5e                   	pop    %esi
+  801422:	5f                   	pop    %edi
+  801423:	5d                   	pop    %ebp
+  801424:	c3                   	ret
+
+00801425 <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  801425:	55                   	push   %ebp
+  801426:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  801428:	8b 45 08             	mov    0x8(%ebp),%eax
+  80142b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  801431:	5d                   	pop    %ebp
+  801432:	c3                   	ret
+
+00801433 <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  801433:	55                   	push   %ebp
+  801434:	89 e5                	mov    %esp,%ebp
+  801436:	56                   	push   %esi
+  801437:	53                   	push   %ebx
+  801438:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  80143b:	8b 1e                	mov    (%esi),%ebx
+  80143d:	85 db                	test   %ebx,%ebx
+  80143f:	75 09                	jne    80144a <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  801441:	89 d8                	mov    %ebx,%eax
+  801443:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801446:	5b                   	pop    %ebx
+  801447:	5e                   	pop    %esi
+  801448:	5d                   	pop    %ebp
+  801449:	c3                   	ret
+  b->sb_n = 0;
+  80144a:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  801450:	53                   	push   %ebx
+  801451:	8d 46 04             	lea    0x4(%esi),%eax
+  801454:	50                   	push   %eax
+  801455:	e8 54 ff ff ff       	call   8013ae <sys_batch>
+  80145a:	83 c4 08             	add    $0x8,%esp
+  80145d:	85 c0                	test   %eax,%eax
+  80145f:	78 1e                	js     80147f <sysbatch_flush+0x4c>
+  if (r < n)
+  801461:	39 c3                	cmp    %eax,%ebx
+  801463:	7f 07                	jg     80146c <sysbatch_flush+0x39>
+  return 0;
+  801465:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80146a:	eb d5                	jmp    801441 <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  80146c:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80146f:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  801473:	85 db                	test   %ebx,%ebx
+  801475:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80147a:	0f 49 d8             	cmovns %eax,%ebx
+  80147d:	eb c2                	jmp    801441 <sysbatch_flush+0xe>
+    return r;
+  80147f:	89 c3                	mov    %eax,%ebx
+  801481:	eb be                	jmp    801441 <sysbatch_flush+0xe>
+
+00801483 <sysbatch_add>:
+{
+  801483:	55                   	push   %ebp
+  801484:	89 e5                	mov    %esp,%ebp
+  801486:	53                   	push   %ebx
+  801487:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  80148a:	83 3b 40             	cmpl   $0x40,(%ebx)
+  80148d:	74 41                	je     8014d0 <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  80148f:	8b 03                	mov    (%ebx),%eax
+  801491:	8d 50 01             	lea    0x1(%eax),%edx
+  801494:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  801496:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801499:	01 d8                	add    %ebx,%eax
+  80149b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80149e:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  8014a1:	8b 55 10             	mov    0x10(%ebp),%edx
+  8014a4:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  8014a7:	8b 55 14             	mov    0x14(%ebp),%edx
+  8014aa:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  8014ad:	8b 55 18             	mov    0x18(%ebp),%edx
+  8014b0:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  8014b3:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  8014b6:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  8014b9:	8b 55 20             	mov    0x20(%ebp),%edx
+  8014bc:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  8014bf:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  8014c6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8014cb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014ce:	c9                   	leave
+  8014cf:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  8014d0:	53                   	push   %ebx
+  8014d1:	e8 5d ff ff ff       	call   801433 <sysbatch_flush>
+  8014d6:	83 c4 04             	add    $0x4,%esp
+  8014d9:	85 c0                	test   %eax,%eax
+  8014db:	79 b2                	jns    80148f <sysbatch_add+0xc>
+  8014dd:	eb ec                	jmp    8014cb <sysbatch_add+0x48>
+
+008014df <pgfault>:
+// Custom page fault handler - if faulting page is copy-on-write,
+// map in our own private writable copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  8014df:	55                   	push   %ebp
+  8014e0:	89 e5                	mov    %esp,%ebp
+  8014e2:	56                   	push   %esi
+  8014e3:	53                   	push   %ebx
+  8014e4:	8b 45 08             	mov    0x8(%ebp),%eax
+  void *addr = (void*)utf->utf_fault_va;
+  8014e7:	8b 18                	mov    (%eax),%ebx
+  uint32_t err = utf->utf_err;
+  8014e9:	8b 70 04             	mov    0x4(%eax),%esi
+  // Hint:
+  //   Use the read-only page table mappings at uvpt
+  //   (see <inc/memlayout.h>).
+
+  // Faults in file mappings are mmap's to handle.
+  if (mmap_fault(utf))
+  8014ec:	83 ec 0c             	sub    $0xc,%esp
+  8014ef:	50                   	push   %eax
+  8014f0:	e8 68 1f 00 00       	call   80345d <mmap_fault>
+  8014f5:	83 c4 10             	add    $0x10,%esp
+  8014f8:	84 c0                	test   %al,%al
+  8014fa:	75 7d                	jne    801579 <pgfault+0x9a>
+    return;
+
+  // LAB 4: Your code here.
+  if ( !(err & FEC_WR) ) {
+  8014fc:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  801502:	74 7c                	je     801580 <pgfault+0xa1>
+    panic("user_pgfault: %e", err);
+  }
+
+  if ( !(uvpt[PGNUM(addr)] & PTE_COW) ) {
+  801504:	89 d8                	mov    %ebx,%eax
+  801506:	c1 e8 0c             	shr    $0xc,%eax
+  801509:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801510:	f6 c4 08             	test   $0x8,%ah
+  801513:	74 7d                	je     801592 <pgfault+0xb3>
+  // page to the old page's address.
+  // Hint:
+  //   You should make three system calls.
+
+  // LAB 4: Your code here.
+  addr = ROUNDDOWN(addr, PGSIZE);
+  801515:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+
+  // map page to temporary location
+  if ( (r = sys_page_alloc(0, PFTEMP, (PTE_P | PTE_U | PTE_W))) < 0) {
+  80151b:	83 ec 04             	sub    $0x4,%esp
+  80151e:	6a 07                	push   $0x7
+  801520:	68 00 f0 7f 00       	push   $0x7ff000
+  801525:	6a 00                	push   $0x0
+  801527:	e8 04 fb ff ff       	call   801030 <sys_page_alloc>
+  80152c:	83 c4 10             	add    $0x10,%esp
+  80152f:	85 c0                	test   %eax,%eax
+  801531:	78 73                	js     8015a6 <pgfault+0xc7>
+    panic("sys_page_alloc: %e", r);
+  }
+
+  // copy data from old page to new page
+  memmove(PFTEMP, addr, PGSIZE);
+  801533:	83 ec 04             	sub    $0x4,%esp
+  801536:	68 00 10 00 00       	push   $0x1000
+  80153b:	53                   	push   %ebx
+  80153c:	68 00 f0 7f 00       	push   $0x7ff000
+  801541:	e8 41 f8 ff ff       	call   800d87 <memmove>
+
+  // move new page to old page address
+  if ( (r = sys_page_map(0, PFTEMP, 0, addr, (PTE_P | PTE_U | PTE_W))) < 0) {
+  801546:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  80154d:	53                   	push   %ebx
+  80154e:	6a 00                	push   $0x0
+  801550:	68 00 f0 7f 00       	push   $0x7ff000
+  801555:	6a 00                	push   $0x0
+  801557:	e8 17 fb ff ff       	call   801073 <sys_page_map>
+  80155c:	83 c4 20             	add    $0x20,%esp
+  80155f:	85 c0                	test   %eax,%eax
+  801561:	78 55                	js     8015b8 <pgfault+0xd9>
+    panic("sys_page_map: %e", r);
+  }
+
+  if ( (r = sys_page_unmap(0, PFTEMP)) < 0) {
+  801563:	83 ec 08             	sub    $0x8,%esp
+  801566:	68 00 f0 7f 00       	push   $0x7ff000
+  80156b:	6a 00                	push   $0x0
+  80156d:	e8 43 fb ff ff       	call   8010b5 <sys_page_unmap>
+  801572:	83 c4 10             	add    $0x10,%esp
+  801575:	85 c0                	test   %eax,%eax
+  801577:	78 51                	js     8015ca <pgfault+0xeb>
+    panic("sys_page_unmap: %e", r);
+  }
+}
+  801579:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80157c:	5b                   	pop    %ebx
+  80157d:	5e                   	pop    %esi
+  80157e:	5d                   	pop    %ebp
+  80157f:	c3                   	ret
+    panic("user_pgfault: %e", err);
+  801580:	56                   	push   %esi
+  801581:	68 6e 42 80 00       	push   $0x80426e
+  801586:	6a 1d                	push   $0x1d
+  801588:	68 7f 42 80 00       	push   $0x80427f
+  80158d:	e8 a6 ef ff ff       	call   800538 <_panic>
+    panic("user_pgfault: page not COW");
+  801592:	83 ec 04             	sub    $0x4,%esp
+  801595:	68 8a 42 80 00       	push   $0x80428a
+  80159a:	6a 21                	push   $0x21
+  80159c:	68 7f 42 80 00       	push   $0x80427f
+  8015a1:	e8 92 ef ff ff       	call   800538 <_panic>
+    panic("sys_page_alloc: %e", r);
+  8015a6:	50                   	push   %eax
+  8015a7:	68 3b 3e 80 00       	push   $0x803e3b
+  8015ac:	6a 2f                	push   $0x2f
+  8015ae:	68 7f 42 80 00       	push   $0x80427f
+  8015b3:	e8 80 ef ff ff       	call   800538 <_panic>
+    panic("sys_page_map: %e", r);
+  8015b8:	50                   	push   %eax
+  8015b9:	68 a5 42 80 00       	push   $0x8042a5
+  8015be:	6a 37                	push   $0x37
+  8015c0:	68 7f 42 80 00       	push   $0x80427f
+  8015c5:	e8 6e ef ff ff       	call   800538 <_panic>
+    panic("sys_page_unmap: %e", r);
+  8015ca:	50                   	push   %eax
+  8015cb:	68 b6 42 80 00       	push   $0x8042b6
+  8015d0:	6a 3b                	push   $0x3b
+  8015d2:	68 7f 42 80 00       	push   $0x80427f
+  8015d7:	e8 5c ef ff ff       	call   800538 <_panic>
+
+008015dc <shared_pgfault>:
+
+// Challenge!
+//
+static void
+shared_pgfault(struct UTrapframe *utf)
+{
+  8015dc:	55                   	push   %ebp
+  8015dd:	89 e5                	mov    %esp,%ebp
+  8015df:	53                   	push   %ebx
+  8015e0:	83 ec 10             	sub    $0x10,%esp
+  8015e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  // just has fewer error checks
+  
+  void *addr = (void*)utf->utf_fault_va;
+  8015e6:	8b 18                	mov    (%eax),%ebx
+  uint32_t err = utf->utf_err;
+  int r;
+
+  if (mmap_fault(utf))
+  8015e8:	50                   	push   %eax
+  8015e9:	e8 6f 1e 00 00       	call   80345d <mmap_fault>
+  8015ee:	83 c4 10             	add    $0x10,%esp
+  8015f1:	84 c0                	test   %al,%al
+  8015f3:	74 05                	je     8015fa <shared_pgfault+0x1e>
+  }
+
+  if ( (r = sys_page_unmap(0, PFTEMP)) < 0) {
+    panic("sys_page_unmap: %e", r);
+  }
+}
+  8015f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015f8:	c9                   	leave
+  8015f9:	c3                   	ret
+  addr = ROUNDDOWN(addr, PGSIZE);
+  8015fa:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if ( (r = sys_page_alloc(0, PFTEMP, (PTE_P | PTE_U | PTE_W))) < 0) {
+  801600:	83 ec 04             	sub    $0x4,%esp
+  801603:	6a 07                	push   $0x7
+  801605:	68 00 f0 7f 00       	push   $0x7ff000
+  80160a:	6a 00                	push   $0x0
+  80160c:	e8 1f fa ff ff       	call   801030 <sys_page_alloc>
+  801611:	83 c4 10             	add    $0x10,%esp
+  801614:	85 c0                	test   %eax,%eax
+  801616:	78 5b                	js     801673 <shared_pgfault+0x97>
+  memmove(PFTEMP, addr, PGSIZE);
+  801618:	83 ec 04             	sub    $0x4,%esp
+  80161b:	68 00 10 00 00       	push   $0x1000
+  801620:	53                   	push   %ebx
+  801621:	68 00 f0 7f 00       	push   $0x7ff000
+  801626:	e8 5c f7 ff ff       	call   800d87 <memmove>
+  if ( (r = sys_page_map(0, PFTEMP, 0, addr, (PTE_P | PTE_U | PTE_W))) < 0) {
+  80162b:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801632:	53                   	push   %ebx
+  801633:	6a 00                	push   $0x0
+  801635:	68 00 f0 7f 00       	push   $0x7ff000
+  80163a:	6a 00                	push   $0x0
+  80163c:	e8 32 fa ff ff       	call   801073 <sys_page_map>
+  801641:	83 c4 20             	add    $0x20,%esp
+  801644:	85 c0                	test   %eax,%eax
+  801646:	78 40                	js     801688 <shared_pgfault+0xac>
+  if ( (r = sys_page_unmap(0, PFTEMP)) < 0) {
+  801648:	83 ec 08             	sub    $0x8,%esp
+  80164b:	68 00 f0 7f 00       	push   $0x7ff000
+  801650:	6a 00                	push   $0x0
+  801652:	e8 5e fa ff ff       	call   8010b5 <sys_page_unmap>
+  801657:	83 c4 10             	add    $0x10,%esp
+  80165a:	85 c0                	test   %eax,%eax
+  80165c:	79 97                	jns    8015f5 <shared_pgfault+0x19>
+    panic("sys_page_unmap: %e", r);
+  80165e:	50                   	push   %eax
+  80165f:	68 b6 42 80 00       	push   $0x8042b6
+  801664:	68 b0 00 00 00       	push   $0xb0
+  801669:	68 7f 42 80 00       	push   $0x80427f
+  80166e:	e8 c5 ee ff ff       	call   800538 <_panic>
+    panic("sys_page_alloc: %e", r);
+  801673:	50                   	push   %eax
+  801674:	68 3b 3e 80 00       	push   $0x803e3b
+  801679:	68 a4 00 00 00       	push   $0xa4
+  80167e:	68 7f 42 80 00       	push   $0x80427f
+  801683:	e8 b0 ee ff ff       	call   800538 <_panic>
+    panic("sys_page_map: %e", r);
+  801688:	50                   	push   %eax
+  801689:	68 a5 42 80 00       	push   $0x8042a5
+  80168e:	68 ac 00 00 00       	push   $0xac
+  801693:	68 7f 42 80 00       	push   $0x80427f
+  801698:	e8 9b ee ff ff       	call   800538 <_panic>
+
+0080169d <fork>:
+{
+  80169d:	55                   	push   %ebp
+  80169e:	89 e5                	mov    %esp,%ebp
+  8016a0:	53                   	push   %ebx
+  8016a1:	83 ec 04             	sub    $0x4,%esp
+  parent_id = sys_getenvid();
+  8016a4:	e8 06 f9 ff ff       	call   800faf <sys_getenvid>
+  set_pgfault_handler(pgfault);
+  8016a9:	83 ec 0c             	sub    $0xc,%esp
+  8016ac:	68 df 14 80 00       	push   $0x8014df
+  8016b1:	e8 36 24 00 00       	call   803aec <set_pgfault_handler>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+  envid_t ret;
+  __asm __volatile("int %2"
+  8016b6:	b8 07 00 00 00       	mov    $0x7,%eax
+  8016bb:	cd 30                	int    $0x30
+  8016bd:	89 c3                	mov    %eax,%ebx
+  if (envid < 0) {
+  8016bf:	83 c4 10             	add    $0x10,%esp
+  8016c2:	85 c0                	test   %eax,%eax
+  8016c4:	78 66                	js     80172c <fork+0x8f>
+  } else if (envid == 0) {
+  8016c6:	74 76                	je     80173e <fork+0xa1>
+  if ( (error = sys_page_map_range(0, 0, UXSTACKTOP - PGSIZE,
+  8016c8:	83 ec 0c             	sub    $0xc,%esp
+  8016cb:	6a 01                	push   $0x1
+  8016cd:	50                   	push   %eax
+  8016ce:	68 00 f0 bf ee       	push   $0xeebff000
+  8016d3:	6a 00                	push   $0x0
+  8016d5:	6a 00                	push   $0x0
+  8016d7:	e8 1b fa ff ff       	call   8010f7 <sys_page_map_range>
+  8016dc:	83 c4 20             	add    $0x20,%esp
+  8016df:	85 c0                	test   %eax,%eax
+  8016e1:	78 77                	js     80175a <fork+0xbd>
+  if ( (error = sys_page_alloc(envid,
+  8016e3:	83 ec 04             	sub    $0x4,%esp
+  8016e6:	6a 07                	push   $0x7
+  8016e8:	68 00 f0 bf ee       	push   $0xeebff000
+  8016ed:	53                   	push   %ebx
+  8016ee:	e8 3d f9 ff ff       	call   801030 <sys_page_alloc>
+  8016f3:	83 c4 10             	add    $0x10,%esp
+  8016f6:	85 c0                	test   %eax,%eax
+  8016f8:	78 72                	js     80176c <fork+0xcf>
+          thisenv->env_pgfault_upcall)) < 0) {
+  8016fa:	a1 a0 78 80 00       	mov    0x8078a0,%eax
+  8016ff:	8b 40 64             	mov    0x64(%eax),%eax
+  if ( (error = sys_env_set_pgfault_upcall(envid,
+  801702:	83 ec 08             	sub    $0x8,%esp
+  801705:	50                   	push   %eax
+  801706:	53                   	push   %ebx
+  801707:	e8 99 fb ff ff       	call   8012a5 <sys_env_set_pgfault_upcall>
+  80170c:	83 c4 10             	add    $0x10,%esp
+  80170f:	85 c0                	test   %eax,%eax
+  801711:	78 6b                	js     80177e <fork+0xe1>
+  if ( (error = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+  801713:	83 ec 08             	sub    $0x8,%esp
+  801716:	6a 02                	push   $0x2
+  801718:	53                   	push   %ebx
+  801719:	e8 03 fb ff ff       	call   801221 <sys_env_set_status>
+  80171e:	83 c4 10             	add    $0x10,%esp
+  801721:	85 c0                	test   %eax,%eax
+  801723:	78 6b                	js     801790 <fork+0xf3>
+}
+  801725:	89 d8                	mov    %ebx,%eax
+  801727:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80172a:	c9                   	leave
+  80172b:	c3                   	ret
+    panic("sys_exofork: %e", envid);
+  80172c:	50                   	push   %eax
+  80172d:	68 c9 42 80 00       	push   $0x8042c9
+  801732:	6a 5e                	push   $0x5e
+  801734:	68 7f 42 80 00       	push   $0x80427f
+  801739:	e8 fa ed ff ff       	call   800538 <_panic>
+    thisenv = &envs[ENVX(sys_getenvid())];
+  80173e:	e8 6c f8 ff ff       	call   800faf <sys_getenvid>
+  801743:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801748:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80174b:	c1 e0 04             	shl    $0x4,%eax
+  80174e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801753:	a3 a0 78 80 00       	mov    %eax,0x8078a0
+    return 0;
+  801758:	eb cb                	jmp    801725 <fork+0x88>
+    panic("sys_page_map_range: %e", error);
+  80175a:	50                   	push   %eax
+  80175b:	68 d9 42 80 00       	push   $0x8042d9
+  801760:	6a 69                	push   $0x69
+  801762:	68 7f 42 80 00       	push   $0x80427f
+  801767:	e8 cc ed ff ff       	call   800538 <_panic>
+    panic("sys_page_alloc: %e", error);
+  80176c:	50                   	push   %eax
+  80176d:	68 3b 3e 80 00       	push   $0x803e3b
+  801772:	6a 70                	push   $0x70
+  801774:	68 7f 42 80 00       	push   $0x80427f
+  801779:	e8 ba ed ff ff       	call   800538 <_panic>
+    panic("sys_env_set_pgfault_upcall: %e", error);
+  80177e:	50                   	push   %eax
+  80177f:	68 08 43 80 00       	push   $0x804308
+  801784:	6a 76                	push   $0x76
+  801786:	68 7f 42 80 00       	push   $0x80427f
+  80178b:	e8 a8 ed ff ff       	call   800538 <_panic>
+    panic("sys_env_set_status: %e", error);
+  801790:	50                   	push   %eax
+  801791:	68 f0 42 80 00       	push   $0x8042f0
+  801796:	6a 7a                	push   $0x7a
+  801798:	68 7f 42 80 00       	push   $0x80427f
+  80179d:	e8 96 ed ff ff       	call   800538 <_panic>
+
+008017a2 <kfork>:
+{
+  8017a2:	55                   	push   %ebp
+  8017a3:	89 e5                	mov    %esp,%ebp
+  8017a5:	53                   	push   %ebx
+  8017a6:	83 ec 10             	sub    $0x10,%esp
+  set_pgfault_handler(pgfault);
+  8017a9:	68 df 14 80 00       	push   $0x8014df
+  8017ae:	e8 39 23 00 00       	call   803aec <set_pgfault_handler>
+  if ((envid = sys_fork()) == 0)
+  8017b3:	e8 4a fa ff ff       	call   801202 <sys_fork>
+  8017b8:	89 c3                	mov    %eax,%ebx
+  8017ba:	83 c4 10             	add    $0x10,%esp
+  8017bd:	85 c0                	test   %eax,%eax
+  8017bf:	74 07                	je     8017c8 <kfork+0x26>
+}
+  8017c1:	89 d8                	mov    %ebx,%eax
+  8017c3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017c6:	c9                   	leave
+  8017c7:	c3                   	ret
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8017c8:	e8 e2 f7 ff ff       	call   800faf <sys_getenvid>
+  8017cd:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8017d2:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8017d5:	c1 e0 04             	shl    $0x4,%eax
+  8017d8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8017dd:	a3 a0 78 80 00       	mov    %eax,0x8078a0
+  return envid;
+  8017e2:	eb dd                	jmp    8017c1 <kfork+0x1f>
+
+008017e4 <sfork>:
+
+int
+sfork(void)
+{
+  8017e4:	55                   	push   %ebp
+  8017e5:	89 e5                	mov    %esp,%ebp
+  8017e7:	53                   	push   %ebx
+  8017e8:	83 ec 04             	sub    $0x4,%esp
+  envid_t envid, parent_id;
+  int error;
+
+  parent_id = sys_getenvid();
+  8017eb:	e8 bf f7 ff ff       	call   800faf <sys_getenvid>
+
+  // set up page fault handler
+  set_pgfault_handler(shared_pgfault);
+  8017f0:	83 ec 0c             	sub    $0xc,%esp
+  8017f3:	68 dc 15 80 00       	push   $0x8015dc
+  8017f8:	e8 ef 22 00 00       	call   803aec <set_pgfault_handler>
+  8017fd:	b8 07 00 00 00       	mov    $0x7,%eax
+  801802:	cd 30                	int    $0x30
+  801804:	89 c3                	mov    %eax,%ebx
+
+  // create a child with sys_exofork
+  envid = sys_exofork();
+  
+  if (envid < 0) {
+  801806:	83 c4 10             	add    $0x10,%esp
+  801809:	85 c0                	test   %eax,%eax
+  80180b:	78 09                	js     801816 <sfork+0x32>
+    panic("sys_exofork: %e", envid);
+  } else if (envid == 0) {
+  80180d:	75 1c                	jne    80182b <sfork+0x47>
+  if ( (error = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+    panic("sys_env_set_status: %e", error);
+  }
+
+  return envid;
+}
+  80180f:	89 d8                	mov    %ebx,%eax
+  801811:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801814:	c9                   	leave
+  801815:	c3                   	ret
+    panic("sys_exofork: %e", envid);
+  801816:	50                   	push   %eax
+  801817:	68 c9 42 80 00       	push   $0x8042c9
+  80181c:	68 c3 00 00 00       	push   $0xc3
+  801821:	68 7f 42 80 00       	push   $0x80427f
+  801826:	e8 0d ed ff ff       	call   800538 <_panic>
+  if ( (error = sys_page_map_range(0, 0, USTACKTOP - PGSIZE,
+  80182b:	83 ec 0c             	sub    $0xc,%esp
+  80182e:	6a 00                	push   $0x0
+  801830:	50                   	push   %eax
+  801831:	68 00 d0 bf ee       	push   $0xeebfd000
+  801836:	6a 00                	push   $0x0
+  801838:	6a 00                	push   $0x0
+  80183a:	e8 b8 f8 ff ff       	call   8010f7 <sys_page_map_range>
+  80183f:	83 c4 20             	add    $0x20,%esp
+  801842:	85 c0                	test   %eax,%eax
+  801844:	78 79                	js     8018bf <sfork+0xdb>
+  if ( (error = sys_page_map_range(0, (void *) (USTACKTOP - PGSIZE), PGSIZE,
+  801846:	83 ec 0c             	sub    $0xc,%esp
+  801849:	6a 01                	push   $0x1
+  80184b:	53                   	push   %ebx
+  80184c:	68 00 10 00 00       	push   $0x1000
+  801851:	68 00 d0 bf ee       	push   $0xeebfd000
+  801856:	6a 00                	push   $0x0
+  801858:	e8 9a f8 ff ff       	call   8010f7 <sys_page_map_range>
+  80185d:	83 c4 20             	add    $0x20,%esp
+  801860:	85 c0                	test   %eax,%eax
+  801862:	78 70                	js     8018d4 <sfork+0xf0>
+  if ( (error = sys_page_alloc(envid,
+  801864:	83 ec 04             	sub    $0x4,%esp
+  801867:	6a 07                	push   $0x7
+  801869:	68 00 f0 bf ee       	push   $0xeebff000
+  80186e:	53                   	push   %ebx
+  80186f:	e8 bc f7 ff ff       	call   801030 <sys_page_alloc>
+  801874:	83 c4 10             	add    $0x10,%esp
+  801877:	85 c0                	test   %eax,%eax
+  801879:	78 6e                	js     8018e9 <sfork+0x105>
+          thisenv->env_pgfault_upcall)) < 0) {
+  80187b:	a1 a0 78 80 00       	mov    0x8078a0,%eax
+  801880:	8b 40 64             	mov    0x64(%eax),%eax
+  if ( (error = sys_env_set_pgfault_upcall(envid,
+  801883:	83 ec 08             	sub    $0x8,%esp
+  801886:	50                   	push   %eax
+  801887:	53                   	push   %ebx
+  801888:	e8 18 fa ff ff       	call   8012a5 <sys_env_set_pgfault_upcall>
+  80188d:	83 c4 10             	add    $0x10,%esp
+  801890:	85 c0                	test   %eax,%eax
+  801892:	78 6a                	js     8018fe <sfork+0x11a>
+  if ( (error = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+  801894:	83 ec 08             	sub    $0x8,%esp
+  801897:	6a 02                	push   $0x2
+  801899:	53                   	push   %ebx
+  80189a:	e8 82 f9 ff ff       	call   801221 <sys_env_set_status>
+  80189f:	83 c4 10             	add    $0x10,%esp
+  8018a2:	85 c0                	test   %eax,%eax
+  8018a4:	0f 89 65 ff ff ff    	jns    80180f <sfork+0x2b>
+    panic("sys_env_set_status: %e", error);
+  8018aa:	50                   	push   %eax
+  8018ab:	68 f0 42 80 00       	push   $0x8042f0
+  8018b0:	68 e4 00 00 00       	push   $0xe4
+  8018b5:	68 7f 42 80 00       	push   $0x80427f
+  8018ba:	e8 79 ec ff ff       	call   800538 <_panic>
+    panic("sys_page_map_range: %e", error);
+  8018bf:	50                   	push   %eax
+  8018c0:	68 d9 42 80 00       	push   $0x8042d9
+  8018c5:	68 ce 00 00 00       	push   $0xce
+  8018ca:	68 7f 42 80 00       	push   $0x80427f
+  8018cf:	e8 64 ec ff ff       	call   800538 <_panic>
+    panic("sys_page_map_range: %e", error);
+  8018d4:	50                   	push   %eax
+  8018d5:	68 d9 42 80 00       	push   $0x8042d9
+  8018da:	68 d3 00 00 00       	push   $0xd3
+  8018df:	68 7f 42 80 00       	push   $0x80427f
+  8018e4:	e8 4f ec ff ff       	call   800538 <_panic>
+    panic("sys_page_alloc: %e", error);
+  8018e9:	50                   	push   %eax
+  8018ea:	68 3b 3e 80 00       	push   $0x803e3b
+  8018ef:	68 da 00 00 00       	push   $0xda
+  8018f4:	68 7f 42 80 00       	push   $0x80427f
+  8018f9:	e8 3a ec ff ff       	call   800538 <_panic>
+    panic("sys_env_set_pgfault_upcall: %e", error);
+  8018fe:	50                   	push   %eax
+  8018ff:	68 08 43 80 00       	push   $0x804308
+  801904:	68 e0 00 00 00       	push   $0xe0
+  801909:	68 7f 42 80 00       	push   $0x80427f
+  80190e:	e8 25 ec ff ff       	call   800538 <_panic>
+
+00801913 <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  801913:	55                   	push   %ebp
+  801914:	89 e5                	mov    %esp,%ebp
+  801916:	57                   	push   %edi
+  801917:	56                   	push   %esi
+  801918:	53                   	push   %ebx
+  801919:	83 ec 14             	sub    $0x14,%esp
+  80191c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80191f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801922:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801925:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  801928:	85 c0                	test   %eax,%eax
+  80192a:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80192f:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  801932:	ff 33                	push   (%ebx)
+  801934:	50                   	push   %eax
+  801935:	e8 ce f9 ff ff       	call   801308 <sys_ipc_recv>
+  80193a:	83 c4 10             	add    $0x10,%esp
+  80193d:	85 c0                	test   %eax,%eax
+  80193f:	78 39                	js     80197a <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  801941:	85 ff                	test   %edi,%edi
+  801943:	74 0a                	je     80194f <ipc_recv_pages+0x3c>
+  801945:	a1 a0 78 80 00       	mov    0x8078a0,%eax
+  80194a:	8b 40 7c             	mov    0x7c(%eax),%eax
+  80194d:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  80194f:	85 f6                	test   %esi,%esi
+  801951:	74 0d                	je     801960 <ipc_recv_pages+0x4d>
+  801953:	a1 a0 78 80 00       	mov    0x8078a0,%eax
+  801958:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  80195e:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  801960:	a1 a0 78 80 00       	mov    0x8078a0,%eax
+  801965:	8b 40 74             	mov    0x74(%eax),%eax
+  801968:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  80196a:	a1 a0 78 80 00       	mov    0x8078a0,%eax
+  80196f:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  801972:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801975:	5b                   	pop    %ebx
+  801976:	5e                   	pop    %esi
+  801977:	5f                   	pop    %edi
+  801978:	5d                   	pop    %ebp
+  801979:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  80197a:	85 ff                	test   %edi,%edi
+  80197c:	74 06                	je     801984 <ipc_recv_pages+0x71>
+  80197e:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  801984:	85 f6                	test   %esi,%esi
+  801986:	74 06                	je     80198e <ipc_recv_pages+0x7b>
+  801988:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  80198e:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  801994:	eb dc                	jmp    801972 <ipc_recv_pages+0x5f>
+
+00801996 <ipc_recv>:
+{
+  801996:	55                   	push   %ebp
+  801997:	89 e5                	mov    %esp,%ebp
+  801999:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  80199c:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  8019a3:	ff 75 10             	push   0x10(%ebp)
+  8019a6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019a9:	50                   	push   %eax
+  8019aa:	ff 75 0c             	push   0xc(%ebp)
+  8019ad:	ff 75 08             	push   0x8(%ebp)
+  8019b0:	e8 5e ff ff ff       	call   801913 <ipc_recv_pages>
+}
+  8019b5:	c9                   	leave
+  8019b6:	c3                   	ret
+
+008019b7 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  8019b7:	55                   	push   %ebp
+  8019b8:	89 e5                	mov    %esp,%ebp
+  8019ba:	57                   	push   %edi
+  8019bb:	56                   	push   %esi
+  8019bc:	53                   	push   %ebx
+  8019bd:	83 ec 0c             	sub    $0xc,%esp
+  8019c0:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8019c3:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8019c6:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  8019c9:	89 c3                	mov    %eax,%ebx
+  8019cb:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  8019d1:	85 c0                	test   %eax,%eax
+  8019d3:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8019d8:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  8019db:	83 ec 0c             	sub    $0xc,%esp
+  8019de:	ff 75 14             	push   0x14(%ebp)
+  8019e1:	ff 75 18             	push   0x18(%ebp)
+  8019e4:	53                   	push   %ebx
+  8019e5:	56                   	push   %esi
+  8019e6:	57                   	push   %edi
+  8019e7:	e8 fb f8 ff ff       	call   8012e7 <sys_ipc_try_send>
+  8019ec:	83 c4 20             	add    $0x20,%esp
+  8019ef:	85 c0                	test   %eax,%eax
+  8019f1:	79 1e                	jns    801a11 <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  8019f3:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8019f6:	75 07                	jne    8019ff <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  8019f8:	e8 d1 f5 ff ff       	call   800fce <sys_yield>
+  8019fd:	eb dc                	jmp    8019db <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  8019ff:	50                   	push   %eax
+  801a00:	68 27 43 80 00       	push   $0x804327
+  801a05:	6a 5c                	push   $0x5c
+  801a07:	68 34 43 80 00       	push   $0x804334
+  801a0c:	e8 27 eb ff ff       	call   800538 <_panic>
+  }
+}
+  801a11:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a14:	5b                   	pop    %ebx
+  801a15:	5e                   	pop    %esi
+  801a16:	5f                   	pop    %edi
+  801a17:	5d                   	pop    %ebp
+  801a18:	c3                   	ret
+
+00801a19 <ipc_send>:
+{
+  801a19:	55                   	push   %ebp
+  801a1a:	89 e5                	mov    %esp,%ebp
+  801a1c:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  801a1f:	ff 75 14             	push   0x14(%ebp)
+  801a22:	6a 01                	push   $0x1
+  801a24:	ff 75 10             	push   0x10(%ebp)
+  801a27:	ff 75 0c             	push   0xc(%ebp)
+  801a2a:	ff 75 08             	push   0x8(%ebp)
+  801a2d:	e8 85 ff ff ff       	call   8019b7 <ipc_send_pages>
+}
+  801a32:	83 c4 20             	add    $0x20,%esp
+  801a35:	c9                   	leave
+  801a36:	c3                   	ret
+
+00801a37 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  801a37:	55                   	push   %ebp
+  801a38:	89 e5                	mov    %esp,%ebp
+  801a3a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  801a3d:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  801a42:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  801a45:	c1 e0 04             	shl    $0x4,%eax
+  801a48:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801a4d:	8b 40 50             	mov    0x50(%eax),%eax
+  801a50:	39 c8                	cmp    %ecx,%eax
+  801a52:	74 12                	je     801a66 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  801a54:	83 c2 01             	add    $0x1,%edx
+  801a57:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  801a5d:	75 e3                	jne    801a42 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  801a5f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a64:	eb 0e                	jmp    801a74 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  801a66:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  801a69:	c1 e0 04             	shl    $0x4,%eax
+  801a6c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801a71:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  801a74:	5d                   	pop    %ebp
+  801a75:	c3                   	ret
+
+00801a76 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801a76:	55                   	push   %ebp
+  801a77:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801a79:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a7c:	05 00 00 00 30       	add    $0x30000000,%eax
+  801a81:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801a84:	5d                   	pop    %ebp
+  801a85:	c3                   	ret
+
+00801a86 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801a86:	55                   	push   %ebp
+  801a87:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801a89:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a8c:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  801a8f:	66 b8 00 00          	mov    $0x0,%ax
+  801a93:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801a98:	5d                   	pop    %ebp
+  801a99:	c3                   	ret
+
+00801a9a <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801a9a:	55                   	push   %ebp
+  801a9b:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  801a9d:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801aa2:	eb 02                	jmp    801aa6 <fd_alloc+0xc>
+  801aa4:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801aa6:	89 c2                	mov    %eax,%edx
+  801aa8:	c1 ea 16             	shr    $0x16,%edx
+  801aab:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801ab2:	f6 c2 01             	test   $0x1,%dl
+  801ab5:	74 2b                	je     801ae2 <fd_alloc+0x48>
+  801ab7:	89 c2                	mov    %eax,%edx
+  801ab9:	c1 ea 0c             	shr    $0xc,%edx
+  801abc:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801ac3:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801ac9:	f6 c1 01             	test   $0x1,%cl
+  801acc:	74 14                	je     801ae2 <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  801ace:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801ad4:	75 ce                	jne    801aa4 <fd_alloc+0xa>
+  801ad6:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  801adb:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801ae0:	eb 05                	jmp    801ae7 <fd_alloc+0x4d>
+      return 0;
+  801ae2:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  801ae7:	8b 55 08             	mov    0x8(%ebp),%edx
+  801aea:	89 02                	mov    %eax,(%edx)
+}
+  801aec:	89 c8                	mov    %ecx,%eax
+  801aee:	5d                   	pop    %ebp
+  801aef:	c3                   	ret
+
+00801af0 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801af0:	55                   	push   %ebp
+  801af1:	89 e5                	mov    %esp,%ebp
+  801af3:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  801af6:	83 f8 1f             	cmp    $0x1f,%eax
+  801af9:	77 30                	ja     801b2b <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  801afb:	c1 e0 0c             	shl    $0xc,%eax
+  801afe:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801b03:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801b09:	f6 c2 01             	test   $0x1,%dl
+  801b0c:	74 24                	je     801b32 <fd_lookup+0x42>
+  801b0e:	89 c2                	mov    %eax,%edx
+  801b10:	c1 ea 0c             	shr    $0xc,%edx
+  801b13:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801b1a:	f6 c2 01             	test   $0x1,%dl
+  801b1d:	74 1a                	je     801b39 <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  801b1f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801b22:	89 02                	mov    %eax,(%edx)
+  return 0;
+  801b24:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b29:	5d                   	pop    %ebp
+  801b2a:	c3                   	ret
+    return -E_INVAL;
+  801b2b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b30:	eb f7                	jmp    801b29 <fd_lookup+0x39>
+    return -E_INVAL;
+  801b32:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b37:	eb f0                	jmp    801b29 <fd_lookup+0x39>
+  801b39:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b3e:	eb e9                	jmp    801b29 <fd_lookup+0x39>
+
+00801b40 <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801b40:	55                   	push   %ebp
+  801b41:	89 e5                	mov    %esp,%ebp
+  801b43:	53                   	push   %ebx
+  801b44:	83 ec 04             	sub    $0x4,%esp
+  801b47:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  801b4a:	b8 bc 43 80 00       	mov    $0x8043bc,%eax
+  801b4f:	8b 18                	mov    (%eax),%ebx
+  801b51:	85 db                	test   %ebx,%ebx
+  801b53:	74 0e                	je     801b63 <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  801b55:	83 c0 04             	add    $0x4,%eax
+  801b58:	39 13                	cmp    %edx,(%ebx)
+  801b5a:	75 f3                	jne    801b4f <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  801b5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b61:	eb 1f                	jmp    801b82 <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801b63:	a1 a0 78 80 00       	mov    0x8078a0,%eax
+  801b68:	8b 40 48             	mov    0x48(%eax),%eax
+  801b6b:	83 ec 04             	sub    $0x4,%esp
+  801b6e:	52                   	push   %edx
+  801b6f:	50                   	push   %eax
+  801b70:	68 40 43 80 00       	push   $0x804340
+  801b75:	e8 99 ea ff ff       	call   800613 <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  801b7a:	83 c4 10             	add    $0x10,%esp
+  801b7d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  801b82:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801b85:	89 1a                	mov    %ebx,(%edx)
+}
+  801b87:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b8a:	c9                   	leave
+  801b8b:	c3                   	ret
+
+00801b8c <fd_close>:
+{
+  801b8c:	55                   	push   %ebp
+  801b8d:	89 e5                	mov    %esp,%ebp
+  801b8f:	57                   	push   %edi
+  801b90:	56                   	push   %esi
+  801b91:	53                   	push   %ebx
+  801b92:	83 ec 24             	sub    $0x24,%esp
+  801b95:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b98:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801b9b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801b9e:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801b9f:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801ba5:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801ba8:	50                   	push   %eax
+  801ba9:	e8 42 ff ff ff       	call   801af0 <fd_lookup>
+  801bae:	89 c3                	mov    %eax,%ebx
+  801bb0:	83 c4 10             	add    $0x10,%esp
+  801bb3:	85 c0                	test   %eax,%eax
+  801bb5:	78 05                	js     801bbc <fd_close+0x30>
+      || fd != fd2)
+  801bb7:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801bba:	74 16                	je     801bd2 <fd_close+0x46>
+    return must_exist ? r : 0;
+  801bbc:	89 f8                	mov    %edi,%eax
+  801bbe:	84 c0                	test   %al,%al
+  801bc0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bc5:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801bc8:	89 d8                	mov    %ebx,%eax
+  801bca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bcd:	5b                   	pop    %ebx
+  801bce:	5e                   	pop    %esi
+  801bcf:	5f                   	pop    %edi
+  801bd0:	5d                   	pop    %ebp
+  801bd1:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801bd2:	83 ec 08             	sub    $0x8,%esp
+  801bd5:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801bd8:	50                   	push   %eax
+  801bd9:	ff 36                	push   (%esi)
+  801bdb:	e8 60 ff ff ff       	call   801b40 <dev_lookup>
+  801be0:	89 c3                	mov    %eax,%ebx
+  801be2:	83 c4 10             	add    $0x10,%esp
+  801be5:	85 c0                	test   %eax,%eax
+  801be7:	78 1a                	js     801c03 <fd_close+0x77>
+    if (dev->dev_close)
+  801be9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801bec:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  801bef:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  801bf4:	85 c0                	test   %eax,%eax
+  801bf6:	74 0b                	je     801c03 <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  801bf8:	83 ec 0c             	sub    $0xc,%esp
+  801bfb:	56                   	push   %esi
+  801bfc:	ff d0                	call   *%eax
+  801bfe:	89 c3                	mov    %eax,%ebx
+  801c00:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  801c03:	83 ec 08             	sub    $0x8,%esp
+  801c06:	56                   	push   %esi
+  801c07:	6a 00                	push   $0x0
+  801c09:	e8 a7 f4 ff ff       	call   8010b5 <sys_page_unmap>
+  return r;
+  801c0e:	83 c4 10             	add    $0x10,%esp
+  801c11:	eb b5                	jmp    801bc8 <fd_close+0x3c>
+
+00801c13 <close>:
+
+int
+close(int fdnum)
+{
+  801c13:	55                   	push   %ebp
+  801c14:	89 e5                	mov    %esp,%ebp
+  801c16:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801c19:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c1c:	50                   	push   %eax
+  801c1d:	ff 75 08             	push   0x8(%ebp)
+  801c20:	e8 cb fe ff ff       	call   801af0 <fd_lookup>
+  801c25:	83 c4 10             	add    $0x10,%esp
+  801c28:	85 c0                	test   %eax,%eax
+  801c2a:	79 02                	jns    801c2e <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  801c2c:	c9                   	leave
+  801c2d:	c3                   	ret
+    return fd_close(fd, 1);
+  801c2e:	83 ec 08             	sub    $0x8,%esp
+  801c31:	6a 01                	push   $0x1
+  801c33:	ff 75 f4             	push   -0xc(%ebp)
+  801c36:	e8 51 ff ff ff       	call   801b8c <fd_close>
+  801c3b:	83 c4 10             	add    $0x10,%esp
+  801c3e:	eb ec                	jmp    801c2c <close+0x19>
+
+00801c40 <close_all>:
+
+void
+close_all(void)
+{
+  801c40:	55                   	push   %ebp
+  801c41:	89 e5                	mov    %esp,%ebp
+  801c43:	53                   	push   %ebx
+  801c44:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  801c47:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  801c4c:	83 ec 0c             	sub    $0xc,%esp
+  801c4f:	53                   	push   %ebx
+  801c50:	e8 be ff ff ff       	call   801c13 <close>
+  for (i = 0; i < MAXFD; i++)
+  801c55:	83 c3 01             	add    $0x1,%ebx
+  801c58:	83 c4 10             	add    $0x10,%esp
+  801c5b:	83 fb 20             	cmp    $0x20,%ebx
+  801c5e:	75 ec                	jne    801c4c <close_all+0xc>
+}
+  801c60:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c63:	c9                   	leave
+  801c64:	c3                   	ret
+
+00801c65 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801c65:	55                   	push   %ebp
+  801c66:	89 e5                	mov    %esp,%ebp
+  801c68:	57                   	push   %edi
+  801c69:	56                   	push   %esi
+  801c6a:	53                   	push   %ebx
+  801c6b:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801c6e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801c71:	50                   	push   %eax
+  801c72:	ff 75 08             	push   0x8(%ebp)
+  801c75:	e8 76 fe ff ff       	call   801af0 <fd_lookup>
+  801c7a:	89 c6                	mov    %eax,%esi
+  801c7c:	83 c4 10             	add    $0x10,%esp
+  801c7f:	85 c0                	test   %eax,%eax
+  801c81:	0f 88 0a 01 00 00    	js     801d91 <dup+0x12c>
+    return r;
+  close(newfdnum);
+  801c87:	83 ec 0c             	sub    $0xc,%esp
+  801c8a:	ff 75 0c             	push   0xc(%ebp)
+  801c8d:	e8 81 ff ff ff       	call   801c13 <close>
+
+  newfd = INDEX2FD(newfdnum);
+  801c92:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c95:	c1 e0 0c             	shl    $0xc,%eax
+  801c98:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  801c9e:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  801ca1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801ca4:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  801ca7:	89 04 24             	mov    %eax,(%esp)
+  801caa:	e8 d7 fd ff ff       	call   801a86 <fd2data>
+  801caf:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  801cb1:	89 3c 24             	mov    %edi,(%esp)
+  801cb4:	e8 cd fd ff ff       	call   801a86 <fd2data>
+  801cb9:	83 c4 10             	add    $0x10,%esp
+  801cbc:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801cbf:	89 f3                	mov    %esi,%ebx
+  801cc1:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  801cc7:	89 c6                	mov    %eax,%esi
+  801cc9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801ccc:	89 cf                	mov    %ecx,%edi
+  801cce:	eb 0c                	jmp    801cdc <dup+0x77>
+  801cd0:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801cd6:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801cdc:	39 fb                	cmp    %edi,%ebx
+  801cde:	74 7b                	je     801d5b <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  801ce0:	89 d8                	mov    %ebx,%eax
+  801ce2:	c1 e8 16             	shr    $0x16,%eax
+  801ce5:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801cec:	a8 01                	test   $0x1,%al
+  801cee:	74 e0                	je     801cd0 <dup+0x6b>
+  801cf0:	89 d8                	mov    %ebx,%eax
+  801cf2:	c1 e8 0c             	shr    $0xc,%eax
+  801cf5:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801cfc:	f6 c2 01             	test   $0x1,%dl
+  801cff:	74 cf                	je     801cd0 <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  801d01:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  801d08:	83 ec 0c             	sub    $0xc,%esp
+  801d0b:	25 07 0e 00 00       	and    $0xe07,%eax
+  801d10:	50                   	push   %eax
+  801d11:	56                   	push   %esi
+  801d12:	6a 00                	push   $0x0
+  801d14:	53                   	push   %ebx
+  801d15:	6a 00                	push   $0x0
+  801d17:	e8 57 f3 ff ff       	call   801073 <sys_page_map>
+  801d1c:	83 c4 20             	add    $0x20,%esp
+  801d1f:	85 c0                	test   %eax,%eax
+  801d21:	79 ad                	jns    801cd0 <dup+0x6b>
+  801d23:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801d26:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  801d28:	83 ec 08             	sub    $0x8,%esp
+  801d2b:	ff 75 d4             	push   -0x2c(%ebp)
+  801d2e:	6a 00                	push   $0x0
+  801d30:	e8 80 f3 ff ff       	call   8010b5 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801d35:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  801d38:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  801d3e:	83 c4 10             	add    $0x10,%esp
+  801d41:	39 df                	cmp    %ebx,%edi
+  801d43:	74 4c                	je     801d91 <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  801d45:	83 ec 08             	sub    $0x8,%esp
+  801d48:	57                   	push   %edi
+  801d49:	6a 00                	push   $0x0
+  801d4b:	e8 65 f3 ff ff       	call   8010b5 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801d50:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  801d56:	83 c4 10             	add    $0x10,%esp
+  801d59:	eb e6                	jmp    801d41 <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801d5b:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801d5e:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  801d61:	89 c8                	mov    %ecx,%eax
+  801d63:	c1 e8 0c             	shr    $0xc,%eax
+  801d66:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801d6d:	83 ec 0c             	sub    $0xc,%esp
+  801d70:	25 07 0e 00 00       	and    $0xe07,%eax
+  801d75:	50                   	push   %eax
+  801d76:	ff 75 d4             	push   -0x2c(%ebp)
+  801d79:	6a 00                	push   $0x0
+  801d7b:	51                   	push   %ecx
+  801d7c:	6a 00                	push   $0x0
+  801d7e:	e8 f0 f2 ff ff       	call   801073 <sys_page_map>
+  801d83:	89 c6                	mov    %eax,%esi
+  801d85:	83 c4 20             	add    $0x20,%esp
+  801d88:	85 c0                	test   %eax,%eax
+  801d8a:	78 9c                	js     801d28 <dup+0xc3>
+  return newfdnum;
+  801d8c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d8f:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  801d91:	89 f0                	mov    %esi,%eax
+  801d93:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d96:	5b                   	pop    %ebx
+  801d97:	5e                   	pop    %esi
+  801d98:	5f                   	pop    %edi
+  801d99:	5d                   	pop    %ebp
+  801d9a:	c3                   	ret
+
+00801d9b <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801d9b:	55                   	push   %ebp
+  801d9c:	89 e5                	mov    %esp,%ebp
+  801d9e:	56                   	push   %esi
+  801d9f:	53                   	push   %ebx
+  801da0:	83 ec 18             	sub    $0x18,%esp
+  801da3:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801da6:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801da9:	50                   	push   %eax
+  801daa:	56                   	push   %esi
+  801dab:	e8 40 fd ff ff       	call   801af0 <fd_lookup>
+  801db0:	83 c4 10             	add    $0x10,%esp
+  801db3:	85 c0                	test   %eax,%eax
+  801db5:	78 3c                	js     801df3 <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801db7:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801dba:	83 ec 08             	sub    $0x8,%esp
+  801dbd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801dc0:	50                   	push   %eax
+  801dc1:	ff 33                	push   (%ebx)
+  801dc3:	e8 78 fd ff ff       	call   801b40 <dev_lookup>
+  801dc8:	83 c4 10             	add    $0x10,%esp
+  801dcb:	85 c0                	test   %eax,%eax
+  801dcd:	78 24                	js     801df3 <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801dcf:	8b 43 08             	mov    0x8(%ebx),%eax
+  801dd2:	83 e0 03             	and    $0x3,%eax
+  801dd5:	83 f8 01             	cmp    $0x1,%eax
+  801dd8:	74 20                	je     801dfa <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  801dda:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ddd:	8b 40 08             	mov    0x8(%eax),%eax
+  801de0:	85 c0                	test   %eax,%eax
+  801de2:	74 37                	je     801e1b <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  801de4:	83 ec 04             	sub    $0x4,%esp
+  801de7:	ff 75 10             	push   0x10(%ebp)
+  801dea:	ff 75 0c             	push   0xc(%ebp)
+  801ded:	53                   	push   %ebx
+  801dee:	ff d0                	call   *%eax
+  801df0:	83 c4 10             	add    $0x10,%esp
+}
+  801df3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801df6:	5b                   	pop    %ebx
+  801df7:	5e                   	pop    %esi
+  801df8:	5d                   	pop    %ebp
+  801df9:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801dfa:	a1 a0 78 80 00       	mov    0x8078a0,%eax
+  801dff:	8b 40 48             	mov    0x48(%eax),%eax
+  801e02:	83 ec 04             	sub    $0x4,%esp
+  801e05:	56                   	push   %esi
+  801e06:	50                   	push   %eax
+  801e07:	68 81 43 80 00       	push   $0x804381
+  801e0c:	e8 02 e8 ff ff       	call   800613 <cprintf>
+    return -E_INVAL;
+  801e11:	83 c4 10             	add    $0x10,%esp
+  801e14:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e19:	eb d8                	jmp    801df3 <read+0x58>
+    return -E_NOT_SUPP;
+  801e1b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e20:	eb d1                	jmp    801df3 <read+0x58>
+
+00801e22 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801e22:	55                   	push   %ebp
+  801e23:	89 e5                	mov    %esp,%ebp
+  801e25:	57                   	push   %edi
+  801e26:	56                   	push   %esi
+  801e27:	53                   	push   %ebx
+  801e28:	83 ec 0c             	sub    $0xc,%esp
+  801e2b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801e2e:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  801e31:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e36:	eb 02                	jmp    801e3a <readn+0x18>
+  801e38:	01 c3                	add    %eax,%ebx
+  801e3a:	39 f3                	cmp    %esi,%ebx
+  801e3c:	73 21                	jae    801e5f <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  801e3e:	83 ec 04             	sub    $0x4,%esp
+  801e41:	89 f0                	mov    %esi,%eax
+  801e43:	29 d8                	sub    %ebx,%eax
+  801e45:	50                   	push   %eax
+  801e46:	89 d8                	mov    %ebx,%eax
+  801e48:	03 45 0c             	add    0xc(%ebp),%eax
+  801e4b:	50                   	push   %eax
+  801e4c:	57                   	push   %edi
+  801e4d:	e8 49 ff ff ff       	call   801d9b <read>
+    if (m < 0)
+  801e52:	83 c4 10             	add    $0x10,%esp
+  801e55:	85 c0                	test   %eax,%eax
+  801e57:	78 04                	js     801e5d <readn+0x3b>
+      return m;
+    if (m == 0)
+  801e59:	75 dd                	jne    801e38 <readn+0x16>
+  801e5b:	eb 02                	jmp    801e5f <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  801e5d:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  801e5f:	89 d8                	mov    %ebx,%eax
+  801e61:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e64:	5b                   	pop    %ebx
+  801e65:	5e                   	pop    %esi
+  801e66:	5f                   	pop    %edi
+  801e67:	5d                   	pop    %ebp
+  801e68:	c3                   	ret
+
+00801e69 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801e69:	55                   	push   %ebp
+  801e6a:	89 e5                	mov    %esp,%ebp
+  801e6c:	56                   	push   %esi
+  801e6d:	53                   	push   %ebx
+  801e6e:	83 ec 18             	sub    $0x18,%esp
+  801e71:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801e74:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801e77:	50                   	push   %eax
+  801e78:	53                   	push   %ebx
+  801e79:	e8 72 fc ff ff       	call   801af0 <fd_lookup>
+  801e7e:	83 c4 10             	add    $0x10,%esp
+  801e81:	85 c0                	test   %eax,%eax
+  801e83:	78 37                	js     801ebc <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801e85:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801e88:	83 ec 08             	sub    $0x8,%esp
+  801e8b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e8e:	50                   	push   %eax
+  801e8f:	ff 36                	push   (%esi)
+  801e91:	e8 aa fc ff ff       	call   801b40 <dev_lookup>
+  801e96:	83 c4 10             	add    $0x10,%esp
+  801e99:	85 c0                	test   %eax,%eax
+  801e9b:	78 1f                	js     801ebc <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e9d:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801ea1:	74 20                	je     801ec3 <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  801ea3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ea6:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ea9:	85 c0                	test   %eax,%eax
+  801eab:	74 37                	je     801ee4 <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  801ead:	83 ec 04             	sub    $0x4,%esp
+  801eb0:	ff 75 10             	push   0x10(%ebp)
+  801eb3:	ff 75 0c             	push   0xc(%ebp)
+  801eb6:	56                   	push   %esi
+  801eb7:	ff d0                	call   *%eax
+  801eb9:	83 c4 10             	add    $0x10,%esp
+}
+  801ebc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ebf:	5b                   	pop    %ebx
+  801ec0:	5e                   	pop    %esi
+  801ec1:	5d                   	pop    %ebp
+  801ec2:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801ec3:	a1 a0 78 80 00       	mov    0x8078a0,%eax
+  801ec8:	8b 40 48             	mov    0x48(%eax),%eax
+  801ecb:	83 ec 04             	sub    $0x4,%esp
+  801ece:	53                   	push   %ebx
+  801ecf:	50                   	push   %eax
+  801ed0:	68 9d 43 80 00       	push   $0x80439d
+  801ed5:	e8 39 e7 ff ff       	call   800613 <cprintf>
+    return -E_INVAL;
+  801eda:	83 c4 10             	add    $0x10,%esp
+  801edd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ee2:	eb d8                	jmp    801ebc <write+0x53>
+    return -E_NOT_SUPP;
+  801ee4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ee9:	eb d1                	jmp    801ebc <write+0x53>
+
+00801eeb <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801eeb:	55                   	push   %ebp
+  801eec:	89 e5                	mov    %esp,%ebp
+  801eee:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801ef1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ef4:	50                   	push   %eax
+  801ef5:	ff 75 08             	push   0x8(%ebp)
+  801ef8:	e8 f3 fb ff ff       	call   801af0 <fd_lookup>
+  801efd:	83 c4 10             	add    $0x10,%esp
+  801f00:	85 c0                	test   %eax,%eax
+  801f02:	78 0e                	js     801f12 <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  801f04:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801f07:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f0a:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  801f0d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f12:	c9                   	leave
+  801f13:	c3                   	ret
+
+00801f14 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801f14:	55                   	push   %ebp
+  801f15:	89 e5                	mov    %esp,%ebp
+  801f17:	56                   	push   %esi
+  801f18:	53                   	push   %ebx
+  801f19:	83 ec 18             	sub    $0x18,%esp
+  801f1c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801f1f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801f22:	50                   	push   %eax
+  801f23:	53                   	push   %ebx
+  801f24:	e8 c7 fb ff ff       	call   801af0 <fd_lookup>
+  801f29:	83 c4 10             	add    $0x10,%esp
+  801f2c:	85 c0                	test   %eax,%eax
+  801f2e:	78 34                	js     801f64 <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801f30:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801f33:	83 ec 08             	sub    $0x8,%esp
+  801f36:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f39:	50                   	push   %eax
+  801f3a:	ff 36                	push   (%esi)
+  801f3c:	e8 ff fb ff ff       	call   801b40 <dev_lookup>
+  801f41:	83 c4 10             	add    $0x10,%esp
+  801f44:	85 c0                	test   %eax,%eax
+  801f46:	78 1c                	js     801f64 <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801f48:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801f4c:	74 1d                	je     801f6b <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  801f4e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f51:	8b 40 18             	mov    0x18(%eax),%eax
+  801f54:	85 c0                	test   %eax,%eax
+  801f56:	74 34                	je     801f8c <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  801f58:	83 ec 08             	sub    $0x8,%esp
+  801f5b:	ff 75 0c             	push   0xc(%ebp)
+  801f5e:	56                   	push   %esi
+  801f5f:	ff d0                	call   *%eax
+  801f61:	83 c4 10             	add    $0x10,%esp
+}
+  801f64:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f67:	5b                   	pop    %ebx
+  801f68:	5e                   	pop    %esi
+  801f69:	5d                   	pop    %ebp
+  801f6a:	c3                   	ret
+            thisenv->env_id, fdnum);
+  801f6b:	a1 a0 78 80 00       	mov    0x8078a0,%eax
+  801f70:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801f73:	83 ec 04             	sub    $0x4,%esp
+  801f76:	53                   	push   %ebx
+  801f77:	50                   	push   %eax
+  801f78:	68 60 43 80 00       	push   $0x804360
+  801f7d:	e8 91 e6 ff ff       	call   800613 <cprintf>
+    return -E_INVAL;
+  801f82:	83 c4 10             	add    $0x10,%esp
+  801f85:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f8a:	eb d8                	jmp    801f64 <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  801f8c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801f91:	eb d1                	jmp    801f64 <ftruncate+0x50>
+
+00801f93 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801f93:	55                   	push   %ebp
+  801f94:	89 e5                	mov    %esp,%ebp
+  801f96:	56                   	push   %esi
+  801f97:	53                   	push   %ebx
+  801f98:	83 ec 18             	sub    $0x18,%esp
+  801f9b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801f9e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801fa1:	50                   	push   %eax
+  801fa2:	ff 75 08             	push   0x8(%ebp)
+  801fa5:	e8 46 fb ff ff       	call   801af0 <fd_lookup>
+  801faa:	83 c4 10             	add    $0x10,%esp
+  801fad:	85 c0                	test   %eax,%eax
+  801faf:	78 49                	js     801ffa <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801fb1:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801fb4:	83 ec 08             	sub    $0x8,%esp
+  801fb7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fba:	50                   	push   %eax
+  801fbb:	ff 36                	push   (%esi)
+  801fbd:	e8 7e fb ff ff       	call   801b40 <dev_lookup>
+  801fc2:	83 c4 10             	add    $0x10,%esp
+  801fc5:	85 c0                	test   %eax,%eax
+  801fc7:	78 31                	js     801ffa <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  801fc9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801fcc:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801fd0:	74 2f                	je     802001 <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  801fd2:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  801fd5:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801fdc:	00 00 00 
+  stat->st_isdir = 0;
+  801fdf:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801fe6:	00 00 00 
+  stat->st_dev = dev;
+  801fe9:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  801fef:	83 ec 08             	sub    $0x8,%esp
+  801ff2:	53                   	push   %ebx
+  801ff3:	56                   	push   %esi
+  801ff4:	ff 50 14             	call   *0x14(%eax)
+  801ff7:	83 c4 10             	add    $0x10,%esp
+}
+  801ffa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ffd:	5b                   	pop    %ebx
+  801ffe:	5e                   	pop    %esi
+  801fff:	5d                   	pop    %ebp
+  802000:	c3                   	ret
+    return -E_NOT_SUPP;
+  802001:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  802006:	eb f2                	jmp    801ffa <fstat+0x67>
+
+00802008 <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  802008:	55                   	push   %ebp
+  802009:	89 e5                	mov    %esp,%ebp
+  80200b:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  80200e:	ff 75 0c             	push   0xc(%ebp)
+  802011:	ff 75 08             	push   0x8(%ebp)
+  802014:	e8 58 07 00 00       	call   802771 <file_stat>
+}
+  802019:	c9                   	leave
+  80201a:	c3                   	ret
+
+0080201b <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  80201b:	55                   	push   %ebp
+  80201c:	89 e5                	mov    %esp,%ebp
+  80201e:	57                   	push   %edi
+  80201f:	56                   	push   %esi
+  802020:	53                   	push   %ebx
+  802021:	83 ec 1c             	sub    $0x1c,%esp
+  802024:	89 c7                	mov    %eax,%edi
+  802026:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802029:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80202c:	e9 a2 00 00 00       	jmp    8020d3 <fsipc_send+0xb8>
+  nfsenvs = 0;
+  802031:	c7 05 00 70 80 00 00 	movl   $0x0,0x807000
+  802038:	00 00 00 
+  80203b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802040:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  802045:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  80204a:	be 01 00 00 00       	mov    $0x1,%esi
+  80204f:	eb 0f                	jmp    802060 <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  802051:	83 c0 01             	add    $0x1,%eax
+  802054:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802059:	74 49                	je     8020a4 <fsipc_send+0x89>
+  80205b:	83 f9 07             	cmp    $0x7,%ecx
+  80205e:	7f 50                	jg     8020b0 <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  802060:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  802063:	c1 e2 04             	shl    $0x4,%edx
+  802066:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80206c:	8b 52 50             	mov    0x50(%edx),%edx
+  80206f:	83 fa 01             	cmp    $0x1,%edx
+  802072:	75 dd                	jne    802051 <fsipc_send+0x36>
+  802074:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  802077:	c1 e2 04             	shl    $0x4,%edx
+  80207a:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802080:	8b 52 54             	mov    0x54(%edx),%edx
+  802083:	85 d2                	test   %edx,%edx
+  802085:	74 ca                	je     802051 <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  802087:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  80208a:	c1 e2 04             	shl    $0x4,%edx
+  80208d:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802093:	8b 52 48             	mov    0x48(%edx),%edx
+  802096:	89 14 8d 20 70 80 00 	mov    %edx,0x807020(,%ecx,4)
+  80209d:	8d 49 01             	lea    0x1(%ecx),%ecx
+  8020a0:	89 f3                	mov    %esi,%ebx
+  8020a2:	eb ad                	jmp    802051 <fsipc_send+0x36>
+  8020a4:	84 db                	test   %bl,%bl
+  8020a6:	74 38                	je     8020e0 <fsipc_send+0xc5>
+  8020a8:	89 0d 00 70 80 00    	mov    %ecx,0x807000
+  8020ae:	eb 30                	jmp    8020e0 <fsipc_send+0xc5>
+  8020b0:	84 db                	test   %bl,%bl
+  8020b2:	74 2c                	je     8020e0 <fsipc_send+0xc5>
+  8020b4:	89 0d 00 70 80 00    	mov    %ecx,0x807000
+  8020ba:	eb 24                	jmp    8020e0 <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  8020bc:	50                   	push   %eax
+  8020bd:	68 cc 43 80 00       	push   $0x8043cc
+  8020c2:	6a 34                	push   $0x34
+  8020c4:	68 d6 43 80 00       	push   $0x8043d6
+  8020c9:	e8 6a e4 ff ff       	call   800538 <_panic>
+    }
+    sys_yield();
+  8020ce:	e8 fb ee ff ff       	call   800fce <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  8020d3:	83 3d 00 70 80 00 03 	cmpl   $0x3,0x807000
+  8020da:	0f 8e 51 ff ff ff    	jle    802031 <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  8020e0:	a1 a0 78 80 00       	mov    0x8078a0,%eax
+  8020e5:	8b 70 48             	mov    0x48(%eax),%esi
+  8020e8:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  8020ee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8020f3:	8b 0d 00 70 80 00    	mov    0x807000,%ecx
+  8020f9:	39 d9                	cmp    %ebx,%ecx
+  8020fb:	7e d1                	jle    8020ce <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  8020fd:	83 ec 0c             	sub    $0xc,%esp
+  802100:	ff 75 e0             	push   -0x20(%ebp)
+  802103:	6a 07                	push   $0x7
+  802105:	ff 75 e4             	push   -0x1c(%ebp)
+  802108:	57                   	push   %edi
+  802109:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  80210c:	99                   	cltd
+  80210d:	f7 f9                	idiv   %ecx
+  80210f:	ff 34 95 20 70 80 00 	push   0x807020(,%edx,4)
+  802116:	e8 cc f1 ff ff       	call   8012e7 <sys_ipc_try_send>
+      if (r == 0)
+  80211b:	83 c4 20             	add    $0x20,%esp
+  80211e:	85 c0                	test   %eax,%eax
+  802120:	74 0a                	je     80212c <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  802122:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802125:	75 95                	jne    8020bc <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  802127:	83 c3 01             	add    $0x1,%ebx
+  80212a:	eb c7                	jmp    8020f3 <fsipc_send+0xd8>
+  }
+}
+  80212c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80212f:	5b                   	pop    %ebx
+  802130:	5e                   	pop    %esi
+  802131:	5f                   	pop    %edi
+  802132:	5d                   	pop    %ebp
+  802133:	c3                   	ret
+
+00802134 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  802134:	55                   	push   %ebp
+  802135:	89 e5                	mov    %esp,%ebp
+  802137:	53                   	push   %ebx
+  802138:	83 ec 14             	sub    $0x14,%esp
+  80213b:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  80213d:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  802144:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802149:	ba 00 80 80 00       	mov    $0x808000,%edx
+  80214e:	e8 c8 fe ff ff       	call   80201b <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  802153:	6a 00                	push   $0x0
+  802155:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802158:	50                   	push   %eax
+  802159:	53                   	push   %ebx
+  80215a:	6a 00                	push   $0x0
+  80215c:	e8 b2 f7 ff ff       	call   801913 <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  802161:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802164:	c9                   	leave
+  802165:	c3                   	ret
+
+00802166 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  802166:	55                   	push   %ebp
+  802167:	89 e5                	mov    %esp,%ebp
+  802169:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80216c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80216f:	8b 40 0c             	mov    0xc(%eax),%eax
+  802172:	a3 00 80 80 00       	mov    %eax,0x808000
+  fsipcbuf.set_size.req_size = newsize;
+  802177:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80217a:	a3 04 80 80 00       	mov    %eax,0x808004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  80217f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802184:	b8 02 00 00 00       	mov    $0x2,%eax
+  802189:	e8 a6 ff ff ff       	call   802134 <fsipc>
+}
+  80218e:	c9                   	leave
+  80218f:	c3                   	ret
+
+00802190 <devfile_flush>:
+{
+  802190:	55                   	push   %ebp
+  802191:	89 e5                	mov    %esp,%ebp
+  802193:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802196:	8b 45 08             	mov    0x8(%ebp),%eax
+  802199:	8b 40 0c             	mov    0xc(%eax),%eax
+  80219c:	a3 00 80 80 00       	mov    %eax,0x808000
+  return fsipc(FSREQ_FLUSH, NULL);
+  8021a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021a6:	b8 06 00 00 00       	mov    $0x6,%eax
+  8021ab:	e8 84 ff ff ff       	call   802134 <fsipc>
+}
+  8021b0:	c9                   	leave
+  8021b1:	c3                   	ret
+
+008021b2 <devfile_stat>:
+{
+  8021b2:	55                   	push   %ebp
+  8021b3:	89 e5                	mov    %esp,%ebp
+  8021b5:	53                   	push   %ebx
+  8021b6:	83 ec 04             	sub    $0x4,%esp
+  8021b9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8021bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021bf:	8b 40 0c             	mov    0xc(%eax),%eax
+  8021c2:	a3 00 80 80 00       	mov    %eax,0x808000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8021c7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021cc:	b8 05 00 00 00       	mov    $0x5,%eax
+  8021d1:	e8 5e ff ff ff       	call   802134 <fsipc>
+  8021d6:	85 c0                	test   %eax,%eax
+  8021d8:	78 2c                	js     802206 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8021da:	83 ec 08             	sub    $0x8,%esp
+  8021dd:	68 00 80 80 00       	push   $0x808000
+  8021e2:	53                   	push   %ebx
+  8021e3:	e8 19 ea ff ff       	call   800c01 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  8021e8:	a1 80 80 80 00       	mov    0x808080,%eax
+  8021ed:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8021f3:	a1 84 80 80 00       	mov    0x808084,%eax
+  8021f8:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  8021fe:	83 c4 10             	add    $0x10,%esp
+  802201:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802206:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802209:	c9                   	leave
+  80220a:	c3                   	ret
+
+0080220b <fsv_alloc>:
+{
+  80220b:	55                   	push   %ebp
+  80220c:	89 e5                	mov    %esp,%ebp
+  80220e:	56                   	push   %esi
+  80220f:	53                   	push   %ebx
+  802210:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  802212:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802217:	eb 22                	jmp    80223b <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  802219:	83 ec 04             	sub    $0x4,%esp
+  80221c:	6a 00                	push   $0x0
+  80221e:	6a 00                	push   $0x0
+  802220:	6a 07                	push   $0x7
+  802222:	50                   	push   %eax
+  802223:	6a 00                	push   $0x0
+  802225:	6a 04                	push   $0x4
+  802227:	68 40 70 80 00       	push   $0x807040
+  80222c:	e8 52 f2 ff ff       	call   801483 <sysbatch_add>
+  802231:	83 c4 20             	add    $0x20,%esp
+  802234:	85 c0                	test   %eax,%eax
+  802236:	78 48                	js     802280 <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  802238:	83 c3 01             	add    $0x1,%ebx
+  80223b:	39 f3                	cmp    %esi,%ebx
+  80223d:	74 31                	je     802270 <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  80223f:	89 d8                	mov    %ebx,%eax
+  802241:	c1 e0 0c             	shl    $0xc,%eax
+  802244:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  802249:	89 c2                	mov    %eax,%edx
+  80224b:	c1 ea 16             	shr    $0x16,%edx
+  80224e:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802255:	f6 c2 01             	test   $0x1,%dl
+  802258:	74 bf                	je     802219 <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  80225a:	89 c2                	mov    %eax,%edx
+  80225c:	c1 ea 0c             	shr    $0xc,%edx
+  80225f:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802266:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  802269:	83 fa 03             	cmp    $0x3,%edx
+  80226c:	75 ab                	jne    802219 <fsv_alloc+0xe>
+  80226e:	eb c8                	jmp    802238 <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  802270:	83 ec 0c             	sub    $0xc,%esp
+  802273:	68 40 70 80 00       	push   $0x807040
+  802278:	e8 b6 f1 ff ff       	call   801433 <sysbatch_flush>
+  80227d:	83 c4 10             	add    $0x10,%esp
+}
+  802280:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802283:	5b                   	pop    %ebx
+  802284:	5e                   	pop    %esi
+  802285:	5d                   	pop    %ebp
+  802286:	c3                   	ret
+
+00802287 <devfile_read>:
+{
+  802287:	55                   	push   %ebp
+  802288:	89 e5                	mov    %esp,%ebp
+  80228a:	57                   	push   %edi
+  80228b:	56                   	push   %esi
+  80228c:	53                   	push   %ebx
+  80228d:	83 ec 3c             	sub    $0x3c,%esp
+  802290:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  802293:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  802299:	77 57                	ja     8022f2 <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80229b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80229e:	8b 40 0c             	mov    0xc(%eax),%eax
+  8022a1:	a3 00 80 80 00       	mov    %eax,0x808000
+  fsipcbuf.read.req_n = n;
+  8022a6:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8022ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022b1:	b8 03 00 00 00       	mov    $0x3,%eax
+  8022b6:	e8 79 fe ff ff       	call   802134 <fsipc>
+  8022bb:	89 c6                	mov    %eax,%esi
+  8022bd:	85 c0                	test   %eax,%eax
+  8022bf:	78 27                	js     8022e8 <devfile_read+0x61>
+  assert(r <= n);
+  8022c1:	39 c3                	cmp    %eax,%ebx
+  8022c3:	0f 82 0e 02 00 00    	jb     8024d7 <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  8022c9:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8022ce:	0f 8f 1c 02 00 00    	jg     8024f0 <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8022d4:	83 ec 04             	sub    $0x4,%esp
+  8022d7:	50                   	push   %eax
+  8022d8:	68 00 80 80 00       	push   $0x808000
+  8022dd:	ff 75 0c             	push   0xc(%ebp)
+  8022e0:	e8 a2 ea ff ff       	call   800d87 <memmove>
+  return r;
+  8022e5:	83 c4 10             	add    $0x10,%esp
+}
+  8022e8:	89 f0                	mov    %esi,%eax
+  8022ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022ed:	5b                   	pop    %ebx
+  8022ee:	5e                   	pop    %esi
+  8022ef:	5f                   	pop    %edi
+  8022f0:	5d                   	pop    %ebp
+  8022f1:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  8022f2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022f7:	e8 0f ff ff ff       	call   80220b <fsv_alloc>
+  8022fc:	89 c6                	mov    %eax,%esi
+  8022fe:	85 c0                	test   %eax,%eax
+  802300:	78 e6                	js     8022e8 <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  802302:	8b 45 08             	mov    0x8(%ebp),%eax
+  802305:	8b 40 0c             	mov    0xc(%eax),%eax
+  802308:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  80230d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802310:	8b 40 04             	mov    0x4(%eax),%eax
+  802313:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  802318:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  80231e:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  802325:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80232a:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  80232f:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802334:	e8 e2 fc ff ff       	call   80201b <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  802339:	6a 00                	push   $0x0
+  80233b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80233e:	50                   	push   %eax
+  80233f:	68 00 10 c0 9f       	push   $0x9fc01000
+  802344:	6a 00                	push   $0x0
+  802346:	e8 c8 f5 ff ff       	call   801913 <ipc_recv_pages>
+  80234b:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  80234d:	83 c4 10             	add    $0x10,%esp
+  802350:	85 c0                	test   %eax,%eax
+  802352:	7e 94                	jle    8022e8 <devfile_read+0x61>
+  assert(r <= n);
+  802354:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802357:	39 c3                	cmp    %eax,%ebx
+  802359:	72 2e                	jb     802389 <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  80235b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80235e:	8b 40 04             	mov    0x4(%eax),%eax
+  802361:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802366:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  802369:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80236c:	c1 e2 0c             	shl    $0xc,%edx
+  80236f:	39 ca                	cmp    %ecx,%edx
+  802371:	72 2f                	jb     8023a2 <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  802373:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  802378:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  80237b:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  80237f:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  802384:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  802387:	eb 52                	jmp    8023db <devfile_read+0x154>
+  assert(r <= n);
+  802389:	68 e1 43 80 00       	push   $0x8043e1
+  80238e:	68 e8 43 80 00       	push   $0x8043e8
+  802393:	68 49 01 00 00       	push   $0x149
+  802398:	68 d6 43 80 00       	push   $0x8043d6
+  80239d:	e8 96 e1 ff ff       	call   800538 <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  8023a2:	68 0c 44 80 00       	push   $0x80440c
+  8023a7:	68 e8 43 80 00       	push   $0x8043e8
+  8023ac:	68 4a 01 00 00       	push   $0x14a
+  8023b1:	68 d6 43 80 00       	push   $0x8043d6
+  8023b6:	e8 7d e1 ff ff       	call   800538 <_panic>
+      memmove(dst + done, src + done, m);
+  8023bb:	83 ec 04             	sub    $0x4,%esp
+  8023be:	53                   	push   %ebx
+  8023bf:	56                   	push   %esi
+  8023c0:	89 f8                	mov    %edi,%eax
+  8023c2:	03 45 0c             	add    0xc(%ebp),%eax
+  8023c5:	50                   	push   %eax
+  8023c6:	e8 bc e9 ff ff       	call   800d87 <memmove>
+  8023cb:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  8023ce:	01 df                	add    %ebx,%edi
+  8023d0:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8023d3:	39 c7                	cmp    %eax,%edi
+  8023d5:	0f 83 c0 00 00 00    	jae    80249b <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  8023db:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8023de:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  8023e1:	89 f0                	mov    %esi,%eax
+  8023e3:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8023e8:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  8023ed:	29 c3                	sub    %eax,%ebx
+  8023ef:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8023f2:	29 f8                	sub    %edi,%eax
+  8023f4:	39 c3                	cmp    %eax,%ebx
+  8023f6:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  8023f9:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  8023ff:	75 ba                	jne    8023bb <devfile_read+0x134>
+  802401:	89 f9                	mov    %edi,%ecx
+  802403:	03 4d 0c             	add    0xc(%ebp),%ecx
+  802406:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  802409:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  80240f:	75 aa                	jne    8023bb <devfile_read+0x134>
+  802411:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  802417:	77 a2                	ja     8023bb <devfile_read+0x134>
+  802419:	89 c8                	mov    %ecx,%eax
+  80241b:	c1 e8 16             	shr    $0x16,%eax
+  80241e:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802425:	a8 01                	test   $0x1,%al
+  802427:	74 92                	je     8023bb <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  802429:	89 c8                	mov    %ecx,%eax
+  80242b:	c1 e8 0c             	shr    $0xc,%eax
+  80242e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  802435:	a8 01                	test   $0x1,%al
+  802437:	74 82                	je     8023bb <devfile_read+0x134>
+  802439:	a9 02 08 00 00       	test   $0x802,%eax
+  80243e:	0f 84 77 ff ff ff    	je     8023bb <devfile_read+0x134>
+  802444:	f6 c4 04             	test   $0x4,%ah
+  802447:	0f 85 6e ff ff ff    	jne    8023bb <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  80244d:	a1 a0 78 80 00       	mov    0x8078a0,%eax
+  802452:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  802456:	84 c0                	test   %al,%al
+  802458:	75 17                	jne    802471 <devfile_read+0x1ea>
+  80245a:	83 ec 08             	sub    $0x8,%esp
+  80245d:	6a 01                	push   $0x1
+  80245f:	6a 00                	push   $0x0
+  802461:	e8 87 eb ff ff       	call   800fed <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  802466:	83 c4 10             	add    $0x10,%esp
+  802469:	85 c0                	test   %eax,%eax
+  80246b:	0f 85 4a ff ff ff    	jne    8023bb <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  802471:	83 ec 04             	sub    $0x4,%esp
+  802474:	68 05 08 00 00       	push   $0x805
+  802479:	ff 75 cc             	push   -0x34(%ebp)
+  80247c:	6a 00                	push   $0x0
+  80247e:	56                   	push   %esi
+  80247f:	6a 00                	push   $0x0
+  802481:	6a 05                	push   $0x5
+  802483:	68 40 70 80 00       	push   $0x807040
+  802488:	e8 f6 ef ff ff       	call   801483 <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  80248d:	c1 e8 1f             	shr    $0x1f,%eax
+  802490:	08 45 cb             	or     %al,-0x35(%ebp)
+  802493:	83 c4 20             	add    $0x20,%esp
+  802496:	e9 33 ff ff ff       	jmp    8023ce <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  80249b:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  80249e:	83 ec 0c             	sub    $0xc,%esp
+  8024a1:	68 40 70 80 00       	push   $0x807040
+  8024a6:	e8 88 ef ff ff       	call   801433 <sysbatch_flush>
+  8024ab:	83 c4 10             	add    $0x10,%esp
+  8024ae:	85 c0                	test   %eax,%eax
+  8024b0:	78 06                	js     8024b8 <devfile_read+0x231>
+  8024b2:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  8024b6:	74 14                	je     8024cc <devfile_read+0x245>
+    memmove(dst, src, r);
+  8024b8:	83 ec 04             	sub    $0x4,%esp
+  8024bb:	ff 75 d4             	push   -0x2c(%ebp)
+  8024be:	ff 75 d0             	push   -0x30(%ebp)
+  8024c1:	ff 75 0c             	push   0xc(%ebp)
+  8024c4:	e8 be e8 ff ff       	call   800d87 <memmove>
+  8024c9:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  8024cc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024cf:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  8024d2:	e9 11 fe ff ff       	jmp    8022e8 <devfile_read+0x61>
+  assert(r <= n);
+  8024d7:	68 e1 43 80 00       	push   $0x8043e1
+  8024dc:	68 e8 43 80 00       	push   $0x8043e8
+  8024e1:	68 1c 01 00 00       	push   $0x11c
+  8024e6:	68 d6 43 80 00       	push   $0x8043d6
+  8024eb:	e8 48 e0 ff ff       	call   800538 <_panic>
+  assert(r <= PGSIZE);
+  8024f0:	68 fd 43 80 00       	push   $0x8043fd
+  8024f5:	68 e8 43 80 00       	push   $0x8043e8
+  8024fa:	68 1d 01 00 00       	push   $0x11d
+  8024ff:	68 d6 43 80 00       	push   $0x8043d6
+  802504:	e8 2f e0 ff ff       	call   800538 <_panic>
+
+00802509 <devfile_write>:
+{
+  802509:	55                   	push   %ebp
+  80250a:	89 e5                	mov    %esp,%ebp
+  80250c:	57                   	push   %edi
+  80250d:	56                   	push   %esi
+  80250e:	53                   	push   %ebx
+  80250f:	83 ec 1c             	sub    $0x1c,%esp
+  802512:	8b 75 08             	mov    0x8(%ebp),%esi
+  802515:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  802518:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  80251d:	77 39                	ja     802558 <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80251f:	8b 56 0c             	mov    0xc(%esi),%edx
+  802522:	89 15 00 80 80 00    	mov    %edx,0x808000
+  fsipcbuf.write.req_n = n;
+  802528:	a3 04 80 80 00       	mov    %eax,0x808004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  80252d:	83 ec 04             	sub    $0x4,%esp
+  802530:	50                   	push   %eax
+  802531:	ff 75 0c             	push   0xc(%ebp)
+  802534:	68 08 80 80 00       	push   $0x808008
+  802539:	e8 49 e8 ff ff       	call   800d87 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  80253e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802543:	b8 04 00 00 00       	mov    $0x4,%eax
+  802548:	e8 e7 fb ff ff       	call   802134 <fsipc>
+  80254d:	83 c4 10             	add    $0x10,%esp
+}
+  802550:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802553:	5b                   	pop    %ebx
+  802554:	5e                   	pop    %esi
+  802555:	5f                   	pop    %edi
+  802556:	5d                   	pop    %ebp
+  802557:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  802558:	ba 00 00 10 00       	mov    $0x100000,%edx
+  80255d:	39 d0                	cmp    %edx,%eax
+  80255f:	89 d3                	mov    %edx,%ebx
+  802561:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  802564:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  80256a:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  80256d:	83 c7 01             	add    $0x1,%edi
+  802570:	89 f8                	mov    %edi,%eax
+  802572:	e8 94 fc ff ff       	call   80220b <fsv_alloc>
+  802577:	85 c0                	test   %eax,%eax
+  802579:	78 d5                	js     802550 <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  80257b:	83 ec 04             	sub    $0x4,%esp
+  80257e:	53                   	push   %ebx
+  80257f:	ff 75 0c             	push   0xc(%ebp)
+  802582:	68 00 10 c0 9f       	push   $0x9fc01000
+  802587:	e8 fb e7 ff ff       	call   800d87 <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  80258c:	8b 46 0c             	mov    0xc(%esi),%eax
+  80258f:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  802594:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  80259a:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  8025a1:	89 f9                	mov    %edi,%ecx
+  8025a3:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  8025a8:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8025ad:	e8 69 fa ff ff       	call   80201b <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  8025b2:	6a 00                	push   $0x0
+  8025b4:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8025b7:	50                   	push   %eax
+  8025b8:	6a 00                	push   $0x0
+  8025ba:	6a 00                	push   $0x0
+  8025bc:	e8 52 f3 ff ff       	call   801913 <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  8025c1:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  8025c4:	eb 8a                	jmp    802550 <devfile_write+0x47>
+
+008025c6 <open>:
+{
+  8025c6:	55                   	push   %ebp
+  8025c7:	89 e5                	mov    %esp,%ebp
+  8025c9:	56                   	push   %esi
+  8025ca:	53                   	push   %ebx
+  8025cb:	83 ec 1c             	sub    $0x1c,%esp
+  8025ce:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  8025d1:	56                   	push   %esi
+  8025d2:	e8 ef e5 ff ff       	call   800bc6 <strlen>
+  8025d7:	83 c4 10             	add    $0x10,%esp
+  8025da:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8025df:	7f 6c                	jg     80264d <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  8025e1:	83 ec 0c             	sub    $0xc,%esp
+  8025e4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8025e7:	50                   	push   %eax
+  8025e8:	e8 ad f4 ff ff       	call   801a9a <fd_alloc>
+  8025ed:	89 c3                	mov    %eax,%ebx
+  8025ef:	83 c4 10             	add    $0x10,%esp
+  8025f2:	85 c0                	test   %eax,%eax
+  8025f4:	78 3c                	js     802632 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  8025f6:	83 ec 08             	sub    $0x8,%esp
+  8025f9:	56                   	push   %esi
+  8025fa:	68 00 80 80 00       	push   $0x808000
+  8025ff:	e8 fd e5 ff ff       	call   800c01 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  802604:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802607:	a3 00 84 80 00       	mov    %eax,0x808400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80260c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80260f:	b8 01 00 00 00       	mov    $0x1,%eax
+  802614:	e8 1b fb ff ff       	call   802134 <fsipc>
+  802619:	89 c3                	mov    %eax,%ebx
+  80261b:	83 c4 10             	add    $0x10,%esp
+  80261e:	85 c0                	test   %eax,%eax
+  802620:	78 19                	js     80263b <open+0x75>
+  return fd2num(fd);
+  802622:	83 ec 0c             	sub    $0xc,%esp
+  802625:	ff 75 f4             	push   -0xc(%ebp)
+  802628:	e8 49 f4 ff ff       	call   801a76 <fd2num>
+  80262d:	89 c3                	mov    %eax,%ebx
+  80262f:	83 c4 10             	add    $0x10,%esp
+}
+  802632:	89 d8                	mov    %ebx,%eax
+  802634:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802637:	5b                   	pop    %ebx
+  802638:	5e                   	pop    %esi
+  802639:	5d                   	pop    %ebp
+  80263a:	c3                   	ret
+    fd_close(fd, 0);
+  80263b:	83 ec 08             	sub    $0x8,%esp
+  80263e:	6a 00                	push   $0x0
+  802640:	ff 75 f4             	push   -0xc(%ebp)
+  802643:	e8 44 f5 ff ff       	call   801b8c <fd_close>
+    return r;
+  802648:	83 c4 10             	add    $0x10,%esp
+  80264b:	eb e5                	jmp    802632 <open+0x6c>
+    return -E_BAD_PATH;
+  80264d:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802652:	eb de                	jmp    802632 <open+0x6c>
+
+00802654 <open_read>:
+{
+  802654:	55                   	push   %ebp
+  802655:	89 e5                	mov    %esp,%ebp
+  802657:	57                   	push   %edi
+  802658:	56                   	push   %esi
+  802659:	53                   	push   %ebx
+  80265a:	83 ec 28             	sub    $0x28,%esp
+  80265d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  802660:	57                   	push   %edi
+  802661:	e8 60 e5 ff ff       	call   800bc6 <strlen>
+  802666:	83 c4 10             	add    $0x10,%esp
+  802669:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80266e:	0f 87 f6 00 00 00    	ja     80276a <open_read+0x116>
+  802674:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  802676:	83 ec 0c             	sub    $0xc,%esp
+  802679:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80267c:	50                   	push   %eax
+  80267d:	e8 18 f4 ff ff       	call   801a9a <fd_alloc>
+  802682:	89 c3                	mov    %eax,%ebx
+  802684:	83 c4 10             	add    $0x10,%esp
+  802687:	85 c0                	test   %eax,%eax
+  802689:	0f 88 b2 00 00 00    	js     802741 <open_read+0xed>
+  strcpy(req->req_buf, path);
+  80268f:	83 ec 08             	sub    $0x8,%esp
+  802692:	57                   	push   %edi
+  802693:	68 e4 80 80 00       	push   $0x8080e4
+  802698:	e8 64 e5 ff ff       	call   800c01 <strcpy>
+  req->req_nops = 2;
+  80269d:	c7 05 00 80 80 00 02 	movl   $0x2,0x808000
+  8026a4:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  8026a7:	c7 05 04 80 80 00 01 	movl   $0x1,0x808004
+  8026ae:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  8026b1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8026b4:	a3 10 80 80 00       	mov    %eax,0x808010
+  req->req_ops[0].op_buf = 0;
+  8026b9:	c7 05 18 80 80 00 00 	movl   $0x0,0x808018
+  8026c0:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  8026c3:	c7 05 20 80 80 00 04 	movl   $0x4,0x808020
+  8026ca:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  8026cd:	c7 05 24 80 80 00 01 	movl   $0x1,0x808024
+  8026d4:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  8026d7:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  8026dc:	29 f0                	sub    %esi,%eax
+  8026de:	3b 45 14             	cmp    0x14(%ebp),%eax
+  8026e1:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  8026e5:	a3 2c 80 80 00       	mov    %eax,0x80802c
+  req->req_ops[1].op_offset = 0;
+  8026ea:	c7 05 30 80 80 00 00 	movl   $0x0,0x808030
+  8026f1:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  8026f4:	83 c6 01             	add    $0x1,%esi
+  8026f7:	89 35 34 80 80 00    	mov    %esi,0x808034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  8026fd:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802700:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802705:	e8 2a fa ff ff       	call   802134 <fsipc>
+  80270a:	89 c3                	mov    %eax,%ebx
+  80270c:	83 c4 10             	add    $0x10,%esp
+  80270f:	83 f8 01             	cmp    $0x1,%eax
+  802712:	7e 37                	jle    80274b <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  802714:	a1 38 80 80 00       	mov    0x808038,%eax
+  802719:	8b 55 18             	mov    0x18(%ebp),%edx
+  80271c:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  80271e:	83 ec 04             	sub    $0x4,%esp
+  802721:	50                   	push   %eax
+  802722:	81 c6 e4 80 80 00    	add    $0x8080e4,%esi
+  802728:	56                   	push   %esi
+  802729:	ff 75 10             	push   0x10(%ebp)
+  80272c:	e8 56 e6 ff ff       	call   800d87 <memmove>
+  return fd2num(fd);
+  802731:	83 c4 04             	add    $0x4,%esp
+  802734:	ff 75 e4             	push   -0x1c(%ebp)
+  802737:	e8 3a f3 ff ff       	call   801a76 <fd2num>
+  80273c:	89 c3                	mov    %eax,%ebx
+  80273e:	83 c4 10             	add    $0x10,%esp
+}
+  802741:	89 d8                	mov    %ebx,%eax
+  802743:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802746:	5b                   	pop    %ebx
+  802747:	5e                   	pop    %esi
+  802748:	5f                   	pop    %edi
+  802749:	5d                   	pop    %ebp
+  80274a:	c3                   	ret
+    fd_close(fd, 0);
+  80274b:	83 ec 08             	sub    $0x8,%esp
+  80274e:	6a 00                	push   $0x0
+  802750:	ff 75 e4             	push   -0x1c(%ebp)
+  802753:	e8 34 f4 ff ff       	call   801b8c <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  802758:	83 c4 10             	add    $0x10,%esp
+  80275b:	85 db                	test   %ebx,%ebx
+  80275d:	78 e2                	js     802741 <open_read+0xed>
+  80275f:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  802762:	8b 9b 1c 80 80 00    	mov    0x80801c(%ebx),%ebx
+  802768:	eb d7                	jmp    802741 <open_read+0xed>
+    return -E_BAD_PATH;
+  80276a:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80276f:	eb d0                	jmp    802741 <open_read+0xed>
+
+00802771 <file_stat>:
+{
+  802771:	55                   	push   %ebp
+  802772:	89 e5                	mov    %esp,%ebp
+  802774:	57                   	push   %edi
+  802775:	56                   	push   %esi
+  802776:	53                   	push   %ebx
+  802777:	83 ec 18             	sub    $0x18,%esp
+  80277a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80277d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  802780:	57                   	push   %edi
+  802781:	e8 40 e4 ff ff       	call   800bc6 <strlen>
+  802786:	83 c4 10             	add    $0x10,%esp
+  802789:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80278e:	0f 8f c7 00 00 00    	jg     80285b <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  802794:	83 ec 0c             	sub    $0xc,%esp
+  802797:	57                   	push   %edi
+  802798:	e8 29 e4 ff ff       	call   800bc6 <strlen>
+  80279d:	8d 58 04             	lea    0x4(%eax),%ebx
+  8027a0:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  8027a3:	83 c4 08             	add    $0x8,%esp
+  8027a6:	57                   	push   %edi
+  8027a7:	68 e4 80 80 00       	push   $0x8080e4
+  8027ac:	e8 50 e4 ff ff       	call   800c01 <strcpy>
+  req->req_nops = 2;
+  8027b1:	c7 05 00 80 80 00 02 	movl   $0x2,0x808000
+  8027b8:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  8027bb:	c7 05 04 80 80 00 02 	movl   $0x2,0x808004
+  8027c2:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  8027c5:	c7 05 10 80 80 00 00 	movl   $0x0,0x808010
+  8027cc:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  8027cf:	c7 05 18 80 80 00 00 	movl   $0x0,0x808018
+  8027d6:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  8027d9:	c7 05 20 80 80 00 03 	movl   $0x3,0x808020
+  8027e0:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  8027e3:	c7 05 24 80 80 00 01 	movl   $0x1,0x808024
+  8027ea:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  8027ed:	89 1d 34 80 80 00    	mov    %ebx,0x808034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  8027f3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027f8:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8027fd:	e8 32 f9 ff ff       	call   802134 <fsipc>
+  802802:	83 c4 10             	add    $0x10,%esp
+  802805:	83 f8 01             	cmp    $0x1,%eax
+  802808:	7e 42                	jle    80284c <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  80280a:	81 c3 e4 80 80 00    	add    $0x8080e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  802810:	83 ec 08             	sub    $0x8,%esp
+  802813:	53                   	push   %ebx
+  802814:	56                   	push   %esi
+  802815:	e8 e7 e3 ff ff       	call   800c01 <strcpy>
+  st->st_size = ret->ret_size;
+  80281a:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  802820:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  802826:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  80282c:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  802832:	c7 86 88 00 00 00 04 	movl   $0x805004,0x88(%esi)
+  802839:	50 80 00 
+  return 0;
+  80283c:	83 c4 10             	add    $0x10,%esp
+  80283f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802844:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802847:	5b                   	pop    %ebx
+  802848:	5e                   	pop    %esi
+  802849:	5f                   	pop    %edi
+  80284a:	5d                   	pop    %ebp
+  80284b:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  80284c:	85 c0                	test   %eax,%eax
+  80284e:	78 f4                	js     802844 <file_stat+0xd3>
+  802850:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802853:	8b 80 1c 80 80 00    	mov    0x80801c(%eax),%eax
+  802859:	eb e9                	jmp    802844 <file_stat+0xd3>
+    return -E_BAD_PATH;
+  80285b:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802860:	eb e2                	jmp    802844 <file_stat+0xd3>
+
+00802862 <read_map>:
+{
+  802862:	55                   	push   %ebp
+  802863:	89 e5                	mov    %esp,%ebp
+  802865:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802868:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80286b:	50                   	push   %eax
+  80286c:	ff 75 08             	push   0x8(%ebp)
+  80286f:	e8 7c f2 ff ff       	call   801af0 <fd_lookup>
+  802874:	83 c4 10             	add    $0x10,%esp
+  802877:	85 c0                	test   %eax,%eax
+  802879:	78 2a                	js     8028a5 <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  80287b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80287e:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  802884:	39 08                	cmp    %ecx,(%eax)
+  802886:	75 1f                	jne    8028a7 <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  802888:	8b 40 0c             	mov    0xc(%eax),%eax
+  80288b:	a3 00 80 80 00       	mov    %eax,0x808000
+  fsipcbuf.read_map.req_offset = offset;
+  802890:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802893:	a3 04 80 80 00       	mov    %eax,0x808004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  802898:	8b 55 10             	mov    0x10(%ebp),%edx
+  80289b:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8028a0:	e8 8f f8 ff ff       	call   802134 <fsipc>
+}
+  8028a5:	c9                   	leave
+  8028a6:	c3                   	ret
+    return -E_INVAL;
+  8028a7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028ac:	eb f7                	jmp    8028a5 <read_map+0x43>
+
+008028ae <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8028ae:	55                   	push   %ebp
+  8028af:	89 e5                	mov    %esp,%ebp
+  8028b1:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  8028b4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028b9:	b8 08 00 00 00       	mov    $0x8,%eax
+  8028be:	e8 71 f8 ff ff       	call   802134 <fsipc>
+}
+  8028c3:	c9                   	leave
+  8028c4:	c3                   	ret
+
+008028c5 <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  8028c5:	55                   	push   %ebp
+  8028c6:	89 e5                	mov    %esp,%ebp
+  8028c8:	57                   	push   %edi
+  8028c9:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  8028ca:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028cd:	a3 00 80 80 00       	mov    %eax,0x808000
+  fsipcbuf.stats.req_bio_sched = 0;
+  8028d2:	c7 05 04 80 80 00 00 	movl   $0x0,0x808004
+  8028d9:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  8028dc:	c7 05 08 80 80 00 00 	movl   $0x0,0x808008
+  8028e3:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  8028e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8028eb:	b8 09 00 00 00       	mov    $0x9,%eax
+  8028f0:	e8 3f f8 ff ff       	call   802134 <fsipc>
+  8028f5:	85 c0                	test   %eax,%eax
+  8028f7:	78 14                	js     80290d <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  8028f9:	be 00 80 80 00       	mov    $0x808000,%esi
+  8028fe:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802903:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802906:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  802908:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80290d:	5e                   	pop    %esi
+  80290e:	5f                   	pop    %edi
+  80290f:	5d                   	pop    %ebp
+  802910:	c3                   	ret
+
+00802911 <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  802911:	55                   	push   %ebp
+  802912:	89 e5                	mov    %esp,%ebp
+  802914:	53                   	push   %ebx
+  802915:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  802918:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  80291b:	50                   	push   %eax
+  80291c:	6a 00                	push   $0x0
+  80291e:	e8 a2 ff ff ff       	call   8028c5 <fs_stats>
+  802923:	83 c4 10             	add    $0x10,%esp
+  802926:	85 c0                	test   %eax,%eax
+  802928:	78 28                	js     802952 <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  80292a:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  80292d:	83 ec 08             	sub    $0x8,%esp
+  802930:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802933:	50                   	push   %eax
+  802934:	6a 20                	push   $0x20
+  802936:	e8 8a ff ff ff       	call   8028c5 <fs_stats>
+  80293b:	83 c4 10             	add    $0x10,%esp
+  80293e:	85 c0                	test   %eax,%eax
+  802940:	78 10                	js     802952 <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  802942:	83 ec 08             	sub    $0x8,%esp
+  802945:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802948:	50                   	push   %eax
+  802949:	53                   	push   %ebx
+  80294a:	e8 76 ff ff ff       	call   8028c5 <fs_stats>
+  80294f:	83 c4 10             	add    $0x10,%esp
+}
+  802952:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802955:	c9                   	leave
+  802956:	c3                   	ret
+
+00802957 <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  802957:	55                   	push   %ebp
+  802958:	89 e5                	mov    %esp,%ebp
+  80295a:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  80295d:	c7 05 00 80 80 00 00 	movl   $0x0,0x808000
+  802964:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  802967:	8b 45 08             	mov    0x8(%ebp),%eax
+  80296a:	a3 04 80 80 00       	mov    %eax,0x808004
+  fsipcbuf.stats.req_dcache = 0;
+  80296f:	c7 05 08 80 80 00 00 	movl   $0x0,0x808008
+  802976:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  802979:	ba 00 00 00 00       	mov    $0x0,%edx
+  80297e:	b8 09 00 00 00       	mov    $0x9,%eax
+  802983:	e8 ac f7 ff ff       	call   802134 <fsipc>
+}
+  802988:	c9                   	leave
+  802989:	c3                   	ret
+
+0080298a <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  80298a:	55                   	push   %ebp
+  80298b:	89 e5                	mov    %esp,%ebp
+  80298d:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  802990:	c7 05 00 80 80 00 00 	movl   $0x0,0x808000
+  802997:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  80299a:	c7 05 04 80 80 00 00 	movl   $0x0,0x808004
+  8029a1:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  8029a4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8029a7:	a3 08 80 80 00       	mov    %eax,0x808008
+  return fsipc(FSREQ_STATS, NULL);
+  8029ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029b1:	b8 09 00 00 00       	mov    $0x9,%eax
+  8029b6:	e8 79 f7 ff ff       	call   802134 <fsipc>
+}
+  8029bb:	c9                   	leave
+  8029bc:	c3                   	ret
+
+008029bd <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  8029bd:	55                   	push   %ebp
+  8029be:	89 e5                	mov    %esp,%ebp
+  8029c0:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8029c3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8029c6:	50                   	push   %eax
+  8029c7:	ff 75 08             	push   0x8(%ebp)
+  8029ca:	e8 21 f1 ff ff       	call   801af0 <fd_lookup>
+  8029cf:	83 c4 10             	add    $0x10,%esp
+  8029d2:	85 c0                	test   %eax,%eax
+  8029d4:	78 34                	js     802a0a <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  8029d6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8029d9:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  8029df:	39 08                	cmp    %ecx,(%eax)
+  8029e1:	75 29                	jne    802a0c <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  8029e3:	8b 40 0c             	mov    0xc(%eax),%eax
+  8029e6:	a3 00 80 80 00       	mov    %eax,0x808000
+  fsipcbuf.fallocate.req_offset = offset;
+  8029eb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8029ee:	a3 04 80 80 00       	mov    %eax,0x808004
+  fsipcbuf.fallocate.req_len = len;
+  8029f3:	8b 45 10             	mov    0x10(%ebp),%eax
+  8029f6:	a3 08 80 80 00       	mov    %eax,0x808008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  8029fb:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a00:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802a05:	e8 2a f7 ff ff       	call   802134 <fsipc>
+}
+  802a0a:	c9                   	leave
+  802a0b:	c3                   	ret
+    return -E_INVAL;
+  802a0c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802a11:	eb f7                	jmp    802a0a <fallocate+0x4d>
+
+00802a13 <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  802a13:	55                   	push   %ebp
+  802a14:	89 e5                	mov    %esp,%ebp
+  802a16:	57                   	push   %edi
+  802a17:	56                   	push   %esi
+  802a18:	53                   	push   %ebx
+  802a19:	83 ec 24             	sub    $0x24,%esp
+  802a1c:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802a1f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802a22:	50                   	push   %eax
+  802a23:	ff 75 08             	push   0x8(%ebp)
+  802a26:	e8 c5 f0 ff ff       	call   801af0 <fd_lookup>
+  802a2b:	83 c4 10             	add    $0x10,%esp
+  802a2e:	85 c0                	test   %eax,%eax
+  802a30:	78 66                	js     802a98 <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  802a32:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802a35:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  802a3b:	39 08                	cmp    %ecx,(%eax)
+  802a3d:	75 61                	jne    802aa0 <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  802a3f:	85 f6                	test   %esi,%esi
+  802a41:	7e 50                	jle    802a93 <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  802a43:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  802a48:	39 de                	cmp    %ebx,%esi
+  802a4a:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  802a4d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802a50:	8b 40 0c             	mov    0xc(%eax),%eax
+  802a53:	a3 00 80 80 00       	mov    %eax,0x808000
+    fsipcbuf.prefetch.req_n = m;
+  802a58:	89 1d 04 80 80 00    	mov    %ebx,0x808004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  802a5e:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  802a65:	83 ec 04             	sub    $0x4,%esp
+  802a68:	57                   	push   %edi
+  802a69:	ff 75 0c             	push   0xc(%ebp)
+  802a6c:	68 08 80 80 00       	push   $0x808008
+  802a71:	e8 11 e3 ff ff       	call   800d87 <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  802a76:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a7b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802a80:	e8 af f6 ff ff       	call   802134 <fsipc>
+  802a85:	83 c4 10             	add    $0x10,%esp
+  802a88:	85 c0                	test   %eax,%eax
+  802a8a:	78 0c                	js     802a98 <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  802a8c:	01 7d 0c             	add    %edi,0xc(%ebp)
+  802a8f:	29 de                	sub    %ebx,%esi
+  802a91:	eb ac                	jmp    802a3f <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  802a93:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a98:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a9b:	5b                   	pop    %ebx
+  802a9c:	5e                   	pop    %esi
+  802a9d:	5f                   	pop    %edi
+  802a9e:	5d                   	pop    %ebp
+  802a9f:	c3                   	ret
+    return -E_INVAL;
+  802aa0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802aa5:	eb f1                	jmp    802a98 <prefetch+0x85>
+
+00802aa7 <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  802aa7:	55                   	push   %ebp
+  802aa8:	89 e5                	mov    %esp,%ebp
+  802aaa:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  802aad:	50                   	push   %eax
+  802aae:	e8 d3 ef ff ff       	call   801a86 <fd2data>
+  802ab3:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  802ab8:	c9                   	leave
+  802ab9:	c3                   	ret
+
+00802aba <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802aba:	55                   	push   %ebp
+  802abb:	89 e5                	mov    %esp,%ebp
+  802abd:	56                   	push   %esi
+  802abe:	53                   	push   %ebx
+  802abf:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  802ac2:	83 ec 0c             	sub    $0xc,%esp
+  802ac5:	ff 75 08             	push   0x8(%ebp)
+  802ac8:	e8 b9 ef ff ff       	call   801a86 <fd2data>
+  802acd:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  802acf:	83 c4 08             	add    $0x8,%esp
+  802ad2:	68 38 44 80 00       	push   $0x804438
+  802ad7:	53                   	push   %ebx
+  802ad8:	e8 24 e1 ff ff       	call   800c01 <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  802add:	8b 46 04             	mov    0x4(%esi),%eax
+  802ae0:	2b 06                	sub    (%esi),%eax
+  802ae2:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  802ae8:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802aef:	00 00 00 
+  stat->st_dev = &devpipe;
+  802af2:	c7 83 88 00 00 00 20 	movl   $0x805020,0x88(%ebx)
+  802af9:	50 80 00 
+  return 0;
+}
+  802afc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b01:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b04:	5b                   	pop    %ebx
+  802b05:	5e                   	pop    %esi
+  802b06:	5d                   	pop    %ebp
+  802b07:	c3                   	ret
+
+00802b08 <pipe_wakeup>:
+{
+  802b08:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  802b0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b0f:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  802b12:	85 c0                	test   %eax,%eax
+  802b14:	75 01                	jne    802b17 <pipe_wakeup+0xf>
+  802b16:	c3                   	ret
+{
+  802b17:	55                   	push   %ebp
+  802b18:	89 e5                	mov    %esp,%ebp
+  802b1a:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  802b1d:	6a 00                	push   $0x0
+  802b1f:	68 00 00 c0 ee       	push   $0xeec00000
+  802b24:	52                   	push   %edx
+  802b25:	e8 62 e8 ff ff       	call   80138c <sys_chan_wakeup>
+  802b2a:	83 c4 10             	add    $0x10,%esp
+}
+  802b2d:	c9                   	leave
+  802b2e:	c3                   	ret
+
+00802b2f <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802b2f:	55                   	push   %ebp
+  802b30:	89 e5                	mov    %esp,%ebp
+  802b32:	57                   	push   %edi
+  802b33:	56                   	push   %esi
+  802b34:	53                   	push   %ebx
+  802b35:	83 ec 18             	sub    $0x18,%esp
+  802b38:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  802b3b:	57                   	push   %edi
+  802b3c:	e8 45 ef ff ff       	call   801a86 <fd2data>
+  802b41:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  802b43:	83 c4 10             	add    $0x10,%esp
+  802b46:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  802b4a:	74 2a                	je     802b76 <devpipe_close+0x47>
+  802b4c:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  802b51:	89 f8                	mov    %edi,%eax
+  802b53:	e8 4f ff ff ff       	call   802aa7 <pipe_ring>
+  802b58:	83 ec 08             	sub    $0x8,%esp
+  802b5b:	01 d8                	add    %ebx,%eax
+  802b5d:	50                   	push   %eax
+  802b5e:	6a 00                	push   $0x0
+  802b60:	e8 50 e5 ff ff       	call   8010b5 <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  802b65:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802b6b:	83 c4 10             	add    $0x10,%esp
+  802b6e:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  802b74:	75 db                	jne    802b51 <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  802b76:	83 ec 08             	sub    $0x8,%esp
+  802b79:	57                   	push   %edi
+  802b7a:	6a 00                	push   $0x0
+  802b7c:	e8 34 e5 ff ff       	call   8010b5 <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  802b81:	83 c4 10             	add    $0x10,%esp
+  802b84:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  802b88:	75 13                	jne    802b9d <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  802b8a:	83 ec 08             	sub    $0x8,%esp
+  802b8d:	56                   	push   %esi
+  802b8e:	6a 00                	push   $0x0
+  802b90:	e8 20 e5 ff ff       	call   8010b5 <sys_page_unmap>
+}
+  802b95:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b98:	5b                   	pop    %ebx
+  802b99:	5e                   	pop    %esi
+  802b9a:	5f                   	pop    %edi
+  802b9b:	5d                   	pop    %ebp
+  802b9c:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802b9d:	8d 56 04             	lea    0x4(%esi),%edx
+  802ba0:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802ba3:	e8 60 ff ff ff       	call   802b08 <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802ba8:	8d 46 30             	lea    0x30(%esi),%eax
+  802bab:	89 f2                	mov    %esi,%edx
+  802bad:	e8 56 ff ff ff       	call   802b08 <pipe_wakeup>
+  802bb2:	eb d6                	jmp    802b8a <devpipe_close+0x5b>
+
+00802bb4 <_pipeisclosed>:
+{
+  802bb4:	55                   	push   %ebp
+  802bb5:	89 e5                	mov    %esp,%ebp
+  802bb7:	57                   	push   %edi
+  802bb8:	56                   	push   %esi
+  802bb9:	53                   	push   %ebx
+  802bba:	83 ec 1c             	sub    $0x1c,%esp
+  802bbd:	89 c7                	mov    %eax,%edi
+  802bbf:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  802bc1:	a1 a0 78 80 00       	mov    0x8078a0,%eax
+  802bc6:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  802bc9:	83 ec 0c             	sub    $0xc,%esp
+  802bcc:	57                   	push   %edi
+  802bcd:	e8 87 0f 00 00       	call   803b59 <pageref>
+  802bd2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802bd5:	89 34 24             	mov    %esi,(%esp)
+  802bd8:	e8 7c 0f 00 00       	call   803b59 <pageref>
+    nn = thisenv->env_runs;
+  802bdd:	8b 15 a0 78 80 00    	mov    0x8078a0,%edx
+  802be3:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  802be6:	83 c4 10             	add    $0x10,%esp
+  802be9:	39 cb                	cmp    %ecx,%ebx
+  802beb:	74 1b                	je     802c08 <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  802bed:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802bf0:	75 cf                	jne    802bc1 <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802bf2:	8b 42 58             	mov    0x58(%edx),%eax
+  802bf5:	6a 01                	push   $0x1
+  802bf7:	50                   	push   %eax
+  802bf8:	53                   	push   %ebx
+  802bf9:	68 3f 44 80 00       	push   $0x80443f
+  802bfe:	e8 10 da ff ff       	call   800613 <cprintf>
+  802c03:	83 c4 10             	add    $0x10,%esp
+  802c06:	eb b9                	jmp    802bc1 <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  802c08:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802c0b:	0f 94 c0             	sete   %al
+  802c0e:	0f b6 c0             	movzbl %al,%eax
+}
+  802c11:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c14:	5b                   	pop    %ebx
+  802c15:	5e                   	pop    %esi
+  802c16:	5f                   	pop    %edi
+  802c17:	5d                   	pop    %ebp
+  802c18:	c3                   	ret
+
+00802c19 <devpipe_write_bulk>:
+{
+  802c19:	55                   	push   %ebp
+  802c1a:	89 e5                	mov    %esp,%ebp
+  802c1c:	57                   	push   %edi
+  802c1d:	56                   	push   %esi
+  802c1e:	53                   	push   %ebx
+  802c1f:	83 ec 1c             	sub    $0x1c,%esp
+  802c22:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802c25:	89 d6                	mov    %edx,%esi
+  802c27:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  802c2a:	e8 78 fe ff ff       	call   802aa7 <pipe_ring>
+  802c2f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  802c32:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802c37:	8d 46 04             	lea    0x4(%esi),%eax
+  802c3a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  802c3d:	eb 75                	jmp    802cb4 <devpipe_write_bulk+0x9b>
+  802c3f:	b8 01 00 00 00       	mov    $0x1,%eax
+  802c44:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802c48:	6a 64                	push   $0x64
+  802c4a:	68 00 00 c0 ee       	push   $0xeec00000
+  802c4f:	53                   	push   %ebx
+  802c50:	56                   	push   %esi
+  802c51:	e8 13 e7 ff ff       	call   801369 <sys_chan_sleep>
+      continue;
+  802c56:	83 c4 10             	add    $0x10,%esp
+  802c59:	eb 59                	jmp    802cb4 <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  802c5b:	89 d1                	mov    %edx,%ecx
+  802c5d:	c1 f9 1f             	sar    $0x1f,%ecx
+  802c60:	c1 e9 11             	shr    $0x11,%ecx
+  802c63:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802c66:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802c6b:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  802c6d:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  802c73:	29 d3                	sub    %edx,%ebx
+  802c75:	ba 00 80 00 00       	mov    $0x8000,%edx
+  802c7a:	29 c2                	sub    %eax,%edx
+  802c7c:	39 d3                	cmp    %edx,%ebx
+  802c7e:	0f 47 da             	cmova  %edx,%ebx
+  802c81:	8b 55 08             	mov    0x8(%ebp),%edx
+  802c84:	29 fa                	sub    %edi,%edx
+  802c86:	39 d3                	cmp    %edx,%ebx
+  802c88:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  802c8b:	83 ec 04             	sub    $0x4,%esp
+  802c8e:	53                   	push   %ebx
+  802c8f:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802c92:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  802c95:	52                   	push   %edx
+  802c96:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802c99:	01 c8                	add    %ecx,%eax
+  802c9b:	50                   	push   %eax
+  802c9c:	e8 48 e1 ff ff       	call   800de9 <memcpy>
+    i += m;
+  802ca1:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  802ca3:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802ca6:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802ca9:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802cac:	e8 57 fe ff ff       	call   802b08 <pipe_wakeup>
+  802cb1:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802cb4:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802cb7:	73 2b                	jae    802ce4 <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  802cb9:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  802cbb:	8b 56 04             	mov    0x4(%esi),%edx
+  802cbe:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  802cc4:	39 d0                	cmp    %edx,%eax
+  802cc6:	7d 93                	jge    802c5b <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  802cc8:	89 f2                	mov    %esi,%edx
+  802cca:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802ccd:	e8 e2 fe ff ff       	call   802bb4 <_pipeisclosed>
+  802cd2:	85 c0                	test   %eax,%eax
+  802cd4:	0f 84 65 ff ff ff    	je     802c3f <devpipe_write_bulk+0x26>
+        return i;
+  802cda:	89 f8                	mov    %edi,%eax
+}
+  802cdc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802cdf:	5b                   	pop    %ebx
+  802ce0:	5e                   	pop    %esi
+  802ce1:	5f                   	pop    %edi
+  802ce2:	5d                   	pop    %ebp
+  802ce3:	c3                   	ret
+  return i;
+  802ce4:	89 f8                	mov    %edi,%eax
+  802ce6:	eb f4                	jmp    802cdc <devpipe_write_bulk+0xc3>
+
+00802ce8 <devpipe_write>:
+{
+  802ce8:	55                   	push   %ebp
+  802ce9:	89 e5                	mov    %esp,%ebp
+  802ceb:	57                   	push   %edi
+  802cec:	56                   	push   %esi
+  802ced:	53                   	push   %ebx
+  802cee:	83 ec 28             	sub    $0x28,%esp
+  802cf1:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  802cf4:	56                   	push   %esi
+  802cf5:	e8 8c ed ff ff       	call   801a86 <fd2data>
+  802cfa:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  802cfc:	8b 78 28             	mov    0x28(%eax),%edi
+  802cff:	83 c4 10             	add    $0x10,%esp
+  802d02:	85 ff                	test   %edi,%edi
+  802d04:	75 25                	jne    802d2b <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  802d06:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802d09:	74 66                	je     802d71 <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802d0b:	8b 43 04             	mov    0x4(%ebx),%eax
+  802d0e:	8b 0b                	mov    (%ebx),%ecx
+  802d10:	8d 51 20             	lea    0x20(%ecx),%edx
+  802d13:	39 d0                	cmp    %edx,%eax
+  802d15:	72 2b                	jb     802d42 <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  802d17:	89 da                	mov    %ebx,%edx
+  802d19:	89 f0                	mov    %esi,%eax
+  802d1b:	e8 94 fe ff ff       	call   802bb4 <_pipeisclosed>
+  802d20:	85 c0                	test   %eax,%eax
+  802d22:	75 51                	jne    802d75 <devpipe_write+0x8d>
+      sys_yield();
+  802d24:	e8 a5 e2 ff ff       	call   800fce <sys_yield>
+  802d29:	eb e0                	jmp    802d0b <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  802d2b:	83 ec 0c             	sub    $0xc,%esp
+  802d2e:	ff 75 10             	push   0x10(%ebp)
+  802d31:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802d34:	89 c2                	mov    %eax,%edx
+  802d36:	89 f0                	mov    %esi,%eax
+  802d38:	e8 dc fe ff ff       	call   802c19 <devpipe_write_bulk>
+  802d3d:	83 c4 10             	add    $0x10,%esp
+  802d40:	eb 38                	jmp    802d7a <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802d42:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802d45:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802d49:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802d4c:	89 c2                	mov    %eax,%edx
+  802d4e:	c1 fa 1f             	sar    $0x1f,%edx
+  802d51:	89 d1                	mov    %edx,%ecx
+  802d53:	c1 e9 1b             	shr    $0x1b,%ecx
+  802d56:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802d59:	83 e2 1f             	and    $0x1f,%edx
+  802d5c:	29 ca                	sub    %ecx,%edx
+  802d5e:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802d62:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  802d66:	83 c0 01             	add    $0x1,%eax
+  802d69:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  802d6c:	83 c7 01             	add    $0x1,%edi
+  802d6f:	eb 95                	jmp    802d06 <devpipe_write+0x1e>
+  return i;
+  802d71:	89 f8                	mov    %edi,%eax
+  802d73:	eb 05                	jmp    802d7a <devpipe_write+0x92>
+        return 0;
+  802d75:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d7a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d7d:	5b                   	pop    %ebx
+  802d7e:	5e                   	pop    %esi
+  802d7f:	5f                   	pop    %edi
+  802d80:	5d                   	pop    %ebp
+  802d81:	c3                   	ret
+
+00802d82 <devpipe_read_bulk>:
+{
+  802d82:	55                   	push   %ebp
+  802d83:	89 e5                	mov    %esp,%ebp
+  802d85:	57                   	push   %edi
+  802d86:	56                   	push   %esi
+  802d87:	53                   	push   %ebx
+  802d88:	83 ec 2c             	sub    $0x2c,%esp
+  802d8b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802d8e:	89 d6                	mov    %edx,%esi
+  802d90:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802d93:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  802d96:	e8 0c fd ff ff       	call   802aa7 <pipe_ring>
+  802d9b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  802d9e:	85 db                	test   %ebx,%ebx
+  802da0:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802da5:	0f 45 c3             	cmovne %ebx,%eax
+  802da8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802dab:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802db0:	8d 46 30             	lea    0x30(%esi),%eax
+  802db3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  802db6:	eb 50                	jmp    802e08 <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  802db8:	89 d1                	mov    %edx,%ecx
+  802dba:	c1 f9 1f             	sar    $0x1f,%ecx
+  802dbd:	c1 e9 11             	shr    $0x11,%ecx
+  802dc0:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802dc3:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802dc8:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  802dca:	29 d3                	sub    %edx,%ebx
+  802dcc:	ba 00 80 00 00       	mov    $0x8000,%edx
+  802dd1:	29 c2                	sub    %eax,%edx
+  802dd3:	39 d3                	cmp    %edx,%ebx
+  802dd5:	0f 47 da             	cmova  %edx,%ebx
+  802dd8:	8b 55 08             	mov    0x8(%ebp),%edx
+  802ddb:	29 fa                	sub    %edi,%edx
+  802ddd:	39 d3                	cmp    %edx,%ebx
+  802ddf:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  802de2:	83 ec 04             	sub    $0x4,%esp
+  802de5:	53                   	push   %ebx
+  802de6:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802de9:	01 c8                	add    %ecx,%eax
+  802deb:	50                   	push   %eax
+  802dec:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802def:	01 f8                	add    %edi,%eax
+  802df1:	50                   	push   %eax
+  802df2:	e8 f2 df ff ff       	call   800de9 <memcpy>
+    i += m;
+  802df7:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  802df9:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802dfb:	89 f2                	mov    %esi,%edx
+  802dfd:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802e00:	e8 03 fd ff ff       	call   802b08 <pipe_wakeup>
+  802e05:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802e08:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802e0b:	73 51                	jae    802e5e <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  802e0d:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  802e10:	8b 16                	mov    (%esi),%edx
+  802e12:	39 da                	cmp    %ebx,%edx
+  802e14:	75 a2                	jne    802db8 <devpipe_read_bulk+0x36>
+      if (i > 0)
+  802e16:	85 ff                	test   %edi,%edi
+  802e18:	75 44                	jne    802e5e <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  802e1a:	89 f2                	mov    %esi,%edx
+  802e1c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802e1f:	e8 90 fd ff ff       	call   802bb4 <_pipeisclosed>
+  802e24:	85 c0                	test   %eax,%eax
+  802e26:	75 3a                	jne    802e62 <devpipe_read_bulk+0xe0>
+  802e28:	b8 01 00 00 00       	mov    $0x1,%eax
+  802e2d:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802e31:	6a 64                	push   $0x64
+  802e33:	ff 75 d4             	push   -0x2c(%ebp)
+  802e36:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  802e37:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802e3a:	50                   	push   %eax
+  802e3b:	e8 29 e5 ff ff       	call   801369 <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  802e40:	85 c0                	test   %eax,%eax
+  802e42:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e47:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  802e4a:	83 c4 10             	add    $0x10,%esp
+  802e4d:	a8 01                	test   $0x1,%al
+  802e4f:	74 b7                	je     802e08 <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  802e51:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  802e56:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e59:	5b                   	pop    %ebx
+  802e5a:	5e                   	pop    %esi
+  802e5b:	5f                   	pop    %edi
+  802e5c:	5d                   	pop    %ebp
+  802e5d:	c3                   	ret
+  return i;
+  802e5e:	89 f8                	mov    %edi,%eax
+  802e60:	eb f4                	jmp    802e56 <devpipe_read_bulk+0xd4>
+        return 0;
+  802e62:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e67:	eb ed                	jmp    802e56 <devpipe_read_bulk+0xd4>
+
+00802e69 <devpipe_read>:
+{
+  802e69:	55                   	push   %ebp
+  802e6a:	89 e5                	mov    %esp,%ebp
+  802e6c:	57                   	push   %edi
+  802e6d:	56                   	push   %esi
+  802e6e:	53                   	push   %ebx
+  802e6f:	83 ec 18             	sub    $0x18,%esp
+  802e72:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  802e75:	57                   	push   %edi
+  802e76:	e8 0b ec ff ff       	call   801a86 <fd2data>
+  802e7b:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  802e7d:	8b 70 28             	mov    0x28(%eax),%esi
+  802e80:	83 c4 10             	add    $0x10,%esp
+  802e83:	85 f6                	test   %esi,%esi
+  802e85:	75 24                	jne    802eab <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  802e87:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802e8a:	74 60                	je     802eec <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  802e8c:	8b 03                	mov    (%ebx),%eax
+  802e8e:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802e91:	75 3b                	jne    802ece <devpipe_read+0x65>
+      if (i > 0)
+  802e93:	85 f6                	test   %esi,%esi
+  802e95:	75 2d                	jne    802ec4 <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  802e97:	89 da                	mov    %ebx,%edx
+  802e99:	89 f8                	mov    %edi,%eax
+  802e9b:	e8 14 fd ff ff       	call   802bb4 <_pipeisclosed>
+  802ea0:	85 c0                	test   %eax,%eax
+  802ea2:	75 4c                	jne    802ef0 <devpipe_read+0x87>
+      sys_yield();
+  802ea4:	e8 25 e1 ff ff       	call   800fce <sys_yield>
+  802ea9:	eb e1                	jmp    802e8c <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  802eab:	83 ec 08             	sub    $0x8,%esp
+  802eae:	6a 00                	push   $0x0
+  802eb0:	ff 75 10             	push   0x10(%ebp)
+  802eb3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802eb6:	89 c2                	mov    %eax,%edx
+  802eb8:	89 f8                	mov    %edi,%eax
+  802eba:	e8 c3 fe ff ff       	call   802d82 <devpipe_read_bulk>
+  802ebf:	83 c4 10             	add    $0x10,%esp
+  802ec2:	eb 02                	jmp    802ec6 <devpipe_read+0x5d>
+        return i;
+  802ec4:	89 f0                	mov    %esi,%eax
+}
+  802ec6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ec9:	5b                   	pop    %ebx
+  802eca:	5e                   	pop    %esi
+  802ecb:	5f                   	pop    %edi
+  802ecc:	5d                   	pop    %ebp
+  802ecd:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802ece:	99                   	cltd
+  802ecf:	c1 ea 1b             	shr    $0x1b,%edx
+  802ed2:	01 d0                	add    %edx,%eax
+  802ed4:	83 e0 1f             	and    $0x1f,%eax
+  802ed7:	29 d0                	sub    %edx,%eax
+  802ed9:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802ede:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802ee1:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  802ee4:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  802ee7:	83 c6 01             	add    $0x1,%esi
+  802eea:	eb 9b                	jmp    802e87 <devpipe_read+0x1e>
+  return i;
+  802eec:	89 f0                	mov    %esi,%eax
+  802eee:	eb d6                	jmp    802ec6 <devpipe_read+0x5d>
+        return 0;
+  802ef0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ef5:	eb cf                	jmp    802ec6 <devpipe_read+0x5d>
+
+00802ef7 <pipe2>:
+{
+  802ef7:	55                   	push   %ebp
+  802ef8:	89 e5                	mov    %esp,%ebp
+  802efa:	57                   	push   %edi
+  802efb:	56                   	push   %esi
+  802efc:	53                   	push   %ebx
+  802efd:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  802f00:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802f03:	50                   	push   %eax
+  802f04:	e8 91 eb ff ff       	call   801a9a <fd_alloc>
+  802f09:	89 c3                	mov    %eax,%ebx
+  802f0b:	83 c4 10             	add    $0x10,%esp
+  802f0e:	85 c0                	test   %eax,%eax
+  802f10:	0f 88 fb 01 00 00    	js     803111 <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802f16:	83 ec 04             	sub    $0x4,%esp
+  802f19:	68 07 04 00 00       	push   $0x407
+  802f1e:	ff 75 e4             	push   -0x1c(%ebp)
+  802f21:	6a 00                	push   $0x0
+  802f23:	e8 08 e1 ff ff       	call   801030 <sys_page_alloc>
+  802f28:	89 c3                	mov    %eax,%ebx
+  802f2a:	83 c4 10             	add    $0x10,%esp
+  802f2d:	85 c0                	test   %eax,%eax
+  802f2f:	0f 88 dc 01 00 00    	js     803111 <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  802f35:	83 ec 0c             	sub    $0xc,%esp
+  802f38:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  802f3b:	50                   	push   %eax
+  802f3c:	e8 59 eb ff ff       	call   801a9a <fd_alloc>
+  802f41:	89 c3                	mov    %eax,%ebx
+  802f43:	83 c4 10             	add    $0x10,%esp
+  802f46:	85 c0                	test   %eax,%eax
+  802f48:	0f 88 b3 01 00 00    	js     803101 <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802f4e:	83 ec 04             	sub    $0x4,%esp
+  802f51:	68 07 04 00 00       	push   $0x407
+  802f56:	ff 75 e0             	push   -0x20(%ebp)
+  802f59:	6a 00                	push   $0x0
+  802f5b:	e8 d0 e0 ff ff       	call   801030 <sys_page_alloc>
+  802f60:	89 c3                	mov    %eax,%ebx
+  802f62:	83 c4 10             	add    $0x10,%esp
+  802f65:	85 c0                	test   %eax,%eax
+  802f67:	0f 88 94 01 00 00    	js     803101 <pipe2+0x20a>
+  va = fd2data(fd0);
+  802f6d:	83 ec 0c             	sub    $0xc,%esp
+  802f70:	ff 75 e4             	push   -0x1c(%ebp)
+  802f73:	e8 0e eb ff ff       	call   801a86 <fd2data>
+  802f78:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802f7a:	83 c4 0c             	add    $0xc,%esp
+  802f7d:	68 07 04 00 00       	push   $0x407
+  802f82:	50                   	push   %eax
+  802f83:	6a 00                	push   $0x0
+  802f85:	e8 a6 e0 ff ff       	call   801030 <sys_page_alloc>
+  802f8a:	89 c3                	mov    %eax,%ebx
+  802f8c:	83 c4 10             	add    $0x10,%esp
+  802f8f:	85 c0                	test   %eax,%eax
+  802f91:	0f 88 5a 01 00 00    	js     8030f1 <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802f97:	83 ec 0c             	sub    $0xc,%esp
+  802f9a:	ff 75 e0             	push   -0x20(%ebp)
+  802f9d:	e8 e4 ea ff ff       	call   801a86 <fd2data>
+  802fa2:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802fa9:	50                   	push   %eax
+  802faa:	6a 00                	push   $0x0
+  802fac:	57                   	push   %edi
+  802fad:	6a 00                	push   $0x0
+  802faf:	e8 bf e0 ff ff       	call   801073 <sys_page_map>
+  802fb4:	89 c3                	mov    %eax,%ebx
+  802fb6:	83 c4 20             	add    $0x20,%esp
+  802fb9:	85 c0                	test   %eax,%eax
+  802fbb:	0f 88 22 01 00 00    	js     8030e3 <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  802fc1:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  802fc5:	74 72                	je     803039 <pipe2+0x142>
+  802fc7:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  802fcc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802fcf:	e8 d3 fa ff ff       	call   802aa7 <pipe_ring>
+  802fd4:	83 ec 04             	sub    $0x4,%esp
+  802fd7:	68 07 04 00 00       	push   $0x407
+  802fdc:	01 f0                	add    %esi,%eax
+  802fde:	50                   	push   %eax
+  802fdf:	6a 00                	push   $0x0
+  802fe1:	e8 4a e0 ff ff       	call   801030 <sys_page_alloc>
+  802fe6:	89 c3                	mov    %eax,%ebx
+  802fe8:	83 c4 10             	add    $0x10,%esp
+  802feb:	85 c0                	test   %eax,%eax
+  802fed:	0f 88 97 00 00 00    	js     80308a <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  802ff3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802ff6:	e8 ac fa ff ff       	call   802aa7 <pipe_ring>
+  802ffb:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  802ffe:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803001:	e8 a1 fa ff ff       	call   802aa7 <pipe_ring>
+  803006:	83 ec 0c             	sub    $0xc,%esp
+  803009:	68 07 04 00 00       	push   $0x407
+  80300e:	53                   	push   %ebx
+  80300f:	6a 00                	push   $0x0
+  803011:	01 f0                	add    %esi,%eax
+  803013:	50                   	push   %eax
+  803014:	6a 00                	push   $0x0
+  803016:	e8 58 e0 ff ff       	call   801073 <sys_page_map>
+  80301b:	89 c3                	mov    %eax,%ebx
+  80301d:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803023:	83 c4 20             	add    $0x20,%esp
+  803026:	85 c0                	test   %eax,%eax
+  803028:	78 60                	js     80308a <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  80302a:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  803030:	75 9a                	jne    802fcc <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  803032:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  803039:	a1 20 50 80 00       	mov    0x805020,%eax
+  80303e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  803041:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  803043:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  803046:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  80304d:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  803050:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  803052:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803055:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  80305c:	83 ec 0c             	sub    $0xc,%esp
+  80305f:	ff 75 e4             	push   -0x1c(%ebp)
+  803062:	e8 0f ea ff ff       	call   801a76 <fd2num>
+  803067:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80306a:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  80306c:	83 c4 04             	add    $0x4,%esp
+  80306f:	ff 75 e0             	push   -0x20(%ebp)
+  803072:	e8 ff e9 ff ff       	call   801a76 <fd2num>
+  803077:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80307a:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  80307d:	83 c4 10             	add    $0x10,%esp
+  803080:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803085:	e9 87 00 00 00       	jmp    803111 <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  80308a:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  80308f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803092:	e8 10 fa ff ff       	call   802aa7 <pipe_ring>
+  803097:	83 ec 08             	sub    $0x8,%esp
+  80309a:	01 f0                	add    %esi,%eax
+  80309c:	50                   	push   %eax
+  80309d:	6a 00                	push   $0x0
+  80309f:	e8 11 e0 ff ff       	call   8010b5 <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  8030a4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8030a7:	e8 fb f9 ff ff       	call   802aa7 <pipe_ring>
+  8030ac:	83 c4 08             	add    $0x8,%esp
+  8030af:	01 f0                	add    %esi,%eax
+  8030b1:	50                   	push   %eax
+  8030b2:	6a 00                	push   $0x0
+  8030b4:	e8 fc df ff ff       	call   8010b5 <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  8030b9:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8030bf:	83 c4 10             	add    $0x10,%esp
+  8030c2:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  8030c8:	75 c5                	jne    80308f <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  8030ca:	83 ec 0c             	sub    $0xc,%esp
+  8030cd:	ff 75 e0             	push   -0x20(%ebp)
+  8030d0:	e8 b1 e9 ff ff       	call   801a86 <fd2data>
+  8030d5:	83 c4 08             	add    $0x8,%esp
+  8030d8:	50                   	push   %eax
+  8030d9:	6a 00                	push   $0x0
+  8030db:	e8 d5 df ff ff       	call   8010b5 <sys_page_unmap>
+  8030e0:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  8030e3:	83 ec 08             	sub    $0x8,%esp
+  8030e6:	57                   	push   %edi
+  8030e7:	6a 00                	push   $0x0
+  8030e9:	e8 c7 df ff ff       	call   8010b5 <sys_page_unmap>
+  8030ee:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  8030f1:	83 ec 08             	sub    $0x8,%esp
+  8030f4:	ff 75 e0             	push   -0x20(%ebp)
+  8030f7:	6a 00                	push   $0x0
+  8030f9:	e8 b7 df ff ff       	call   8010b5 <sys_page_unmap>
+  8030fe:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  803101:	83 ec 08             	sub    $0x8,%esp
+  803104:	ff 75 e4             	push   -0x1c(%ebp)
+  803107:	6a 00                	push   $0x0
+  803109:	e8 a7 df ff ff       	call   8010b5 <sys_page_unmap>
+  80310e:	83 c4 10             	add    $0x10,%esp
+}
+  803111:	89 d8                	mov    %ebx,%eax
+  803113:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803116:	5b                   	pop    %ebx
+  803117:	5e                   	pop    %esi
+  803118:	5f                   	pop    %edi
+  803119:	5d                   	pop    %ebp
+  80311a:	c3                   	ret
+
+0080311b <pipe>:
+{
+  80311b:	55                   	push   %ebp
+  80311c:	89 e5                	mov    %esp,%ebp
+  80311e:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  803121:	6a 00                	push   $0x0
+  803123:	ff 75 08             	push   0x8(%ebp)
+  803126:	e8 cc fd ff ff       	call   802ef7 <pipe2>
+}
+  80312b:	c9                   	leave
+  80312c:	c3                   	ret
+
+0080312d <pipeisclosed>:
+{
+  80312d:	55                   	push   %ebp
+  80312e:	89 e5                	mov    %esp,%ebp
+  803130:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803133:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803136:	50                   	push   %eax
+  803137:	ff 75 08             	push   0x8(%ebp)
+  80313a:	e8 b1 e9 ff ff       	call   801af0 <fd_lookup>
+  80313f:	83 c4 10             	add    $0x10,%esp
+  803142:	85 c0                	test   %eax,%eax
+  803144:	78 18                	js     80315e <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  803146:	83 ec 0c             	sub    $0xc,%esp
+  803149:	ff 75 f4             	push   -0xc(%ebp)
+  80314c:	e8 35 e9 ff ff       	call   801a86 <fd2data>
+  803151:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  803153:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803156:	e8 59 fa ff ff       	call   802bb4 <_pipeisclosed>
+  80315b:	83 c4 10             	add    $0x10,%esp
+}
+  80315e:	c9                   	leave
+  80315f:	c3                   	ret
+
+00803160 <pipe_splice>:
+{
+  803160:	55                   	push   %ebp
+  803161:	89 e5                	mov    %esp,%ebp
+  803163:	57                   	push   %edi
+  803164:	56                   	push   %esi
+  803165:	53                   	push   %ebx
+  803166:	83 ec 34             	sub    $0x34,%esp
+  803169:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80316c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80316f:	50                   	push   %eax
+  803170:	ff 75 08             	push   0x8(%ebp)
+  803173:	e8 78 e9 ff ff       	call   801af0 <fd_lookup>
+  803178:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80317b:	83 c4 10             	add    $0x10,%esp
+  80317e:	85 c0                	test   %eax,%eax
+  803180:	0f 88 d7 00 00 00    	js     80325d <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  803186:	83 ec 0c             	sub    $0xc,%esp
+  803189:	ff 75 e4             	push   -0x1c(%ebp)
+  80318c:	e8 f5 e8 ff ff       	call   801a86 <fd2data>
+  803191:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  803193:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803196:	83 c4 10             	add    $0x10,%esp
+  803199:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  80319f:	39 10                	cmp    %edx,(%eax)
+  8031a1:	0f 85 c1 00 00 00    	jne    803268 <pipe_splice+0x108>
+  8031a7:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  8031ab:	0f 84 c0 00 00 00    	je     803271 <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  8031b1:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  8031b5:	0f 84 bf 00 00 00    	je     80327a <pipe_splice+0x11a>
+  8031bb:	89 f7                	mov    %esi,%edi
+  8031bd:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  8031c3:	0f 85 ba 00 00 00    	jne    803283 <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  8031c9:	8d 43 04             	lea    0x4(%ebx),%eax
+  8031cc:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8031cf:	eb 38                	jmp    803209 <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  8031d1:	83 ec 0c             	sub    $0xc,%esp
+  8031d4:	68 00 10 00 00       	push   $0x1000
+  8031d9:	89 f1                	mov    %esi,%ecx
+  8031db:	89 da                	mov    %ebx,%edx
+  8031dd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8031e0:	e8 34 fa ff ff       	call   802c19 <devpipe_write_bulk>
+  8031e5:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8031e8:	83 c4 10             	add    $0x10,%esp
+  8031eb:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8031f0:	75 53                	jne    803245 <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  8031f2:	83 ec 08             	sub    $0x8,%esp
+  8031f5:	56                   	push   %esi
+  8031f6:	6a 00                	push   $0x0
+  8031f8:	e8 b8 de ff ff       	call   8010b5 <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  8031fd:	83 c7 01             	add    $0x1,%edi
+  803200:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803206:	83 c4 10             	add    $0x10,%esp
+  803209:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  80320c:	74 3a                	je     803248 <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  80320e:	8b 03                	mov    (%ebx),%eax
+  803210:	39 43 04             	cmp    %eax,0x4(%ebx)
+  803213:	75 bc                	jne    8031d1 <pipe_splice+0x71>
+  803215:	b8 00 00 00 00       	mov    $0x0,%eax
+  80321a:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  80321e:	85 c0                	test   %eax,%eax
+  803220:	74 af                	je     8031d1 <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  803222:	83 ec 04             	sub    $0x4,%esp
+  803225:	6a 07                	push   $0x7
+  803227:	56                   	push   %esi
+  803228:	ff 75 d0             	push   -0x30(%ebp)
+  80322b:	e8 5c e1 ff ff       	call   80138c <sys_chan_wakeup>
+  803230:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  803233:	83 c4 10             	add    $0x10,%esp
+  803236:	85 c0                	test   %eax,%eax
+  803238:	79 b8                	jns    8031f2 <pipe_splice+0x92>
+  80323a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80323f:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  803243:	eb 8c                	jmp    8031d1 <pipe_splice+0x71>
+  803245:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  803248:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80324c:	75 06                	jne    803254 <pipe_splice+0xf4>
+  80324e:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  803252:	78 09                	js     80325d <pipe_splice+0xfd>
+  return i * PGSIZE;
+  803254:	8b 45 10             	mov    0x10(%ebp),%eax
+  803257:	c1 e0 0c             	shl    $0xc,%eax
+  80325a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  80325d:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  803260:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803263:	5b                   	pop    %ebx
+  803264:	5e                   	pop    %esi
+  803265:	5f                   	pop    %edi
+  803266:	5d                   	pop    %ebp
+  803267:	c3                   	ret
+    return -E_INVAL;
+  803268:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  80326f:	eb ec                	jmp    80325d <pipe_splice+0xfd>
+  803271:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  803278:	eb e3                	jmp    80325d <pipe_splice+0xfd>
+  80327a:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  803281:	eb da                	jmp    80325d <pipe_splice+0xfd>
+  803283:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  80328a:	eb d1                	jmp    80325d <pipe_splice+0xfd>
+
+0080328c <pipe_splice_read>:
+{
+  80328c:	55                   	push   %ebp
+  80328d:	89 e5                	mov    %esp,%ebp
+  80328f:	53                   	push   %ebx
+  803290:	83 ec 1c             	sub    $0x1c,%esp
+  803293:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803296:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803299:	50                   	push   %eax
+  80329a:	ff 75 08             	push   0x8(%ebp)
+  80329d:	e8 4e e8 ff ff       	call   801af0 <fd_lookup>
+  8032a2:	83 c4 10             	add    $0x10,%esp
+  8032a5:	85 c0                	test   %eax,%eax
+  8032a7:	78 49                	js     8032f2 <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  8032a9:	83 ec 0c             	sub    $0xc,%esp
+  8032ac:	ff 75 f4             	push   -0xc(%ebp)
+  8032af:	e8 d2 e7 ff ff       	call   801a86 <fd2data>
+  8032b4:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  8032b6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8032b9:	83 c4 10             	add    $0x10,%esp
+  8032bc:	8b 0d 20 50 80 00    	mov    0x805020,%ecx
+  8032c2:	39 08                	cmp    %ecx,(%eax)
+  8032c4:	75 31                	jne    8032f7 <pipe_splice_read+0x6b>
+  8032c6:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  8032ca:	74 32                	je     8032fe <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  8032cc:	8b 48 08             	mov    0x8(%eax),%ecx
+  8032cf:	83 e1 03             	and    $0x3,%ecx
+  8032d2:	83 f9 01             	cmp    $0x1,%ecx
+  8032d5:	74 2e                	je     803305 <pipe_splice_read+0x79>
+  8032d7:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  8032dd:	75 2d                	jne    80330c <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  8032df:	83 ec 08             	sub    $0x8,%esp
+  8032e2:	53                   	push   %ebx
+  8032e3:	68 00 10 00 00       	push   $0x1000
+  8032e8:	89 d9                	mov    %ebx,%ecx
+  8032ea:	e8 93 fa ff ff       	call   802d82 <devpipe_read_bulk>
+  8032ef:	83 c4 10             	add    $0x10,%esp
+}
+  8032f2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8032f5:	c9                   	leave
+  8032f6:	c3                   	ret
+    return -E_INVAL;
+  8032f7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8032fc:	eb f4                	jmp    8032f2 <pipe_splice_read+0x66>
+  8032fe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803303:	eb ed                	jmp    8032f2 <pipe_splice_read+0x66>
+  803305:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80330a:	eb e6                	jmp    8032f2 <pipe_splice_read+0x66>
+  80330c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803311:	eb df                	jmp    8032f2 <pipe_splice_read+0x66>
+
+00803313 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  803313:	55                   	push   %ebp
+  803314:	89 e5                	mov    %esp,%ebp
+  803316:	56                   	push   %esi
+  803317:	53                   	push   %ebx
+  803318:	8b 75 08             	mov    0x8(%ebp),%esi
+  const volatile struct Env *e;
+
+  assert(envid != 0);
+  80331b:	85 f6                	test   %esi,%esi
+  80331d:	74 15                	je     803334 <wait+0x21>
+  e = &envs[ENVX(envid)];
+  80331f:	89 f0                	mov    %esi,%eax
+  803321:	25 ff 03 00 00       	and    $0x3ff,%eax
+  while (e->env_id == envid && e->env_status != ENV_FREE)
+  803326:	8d 1c c0             	lea    (%eax,%eax,8),%ebx
+  803329:	c1 e3 04             	shl    $0x4,%ebx
+  80332c:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  803332:	eb 1b                	jmp    80334f <wait+0x3c>
+  assert(envid != 0);
+  803334:	68 57 44 80 00       	push   $0x804457
+  803339:	68 e8 43 80 00       	push   $0x8043e8
+  80333e:	6a 09                	push   $0x9
+  803340:	68 62 44 80 00       	push   $0x804462
+  803345:	e8 ee d1 ff ff       	call   800538 <_panic>
+    sys_yield();
+  80334a:	e8 7f dc ff ff       	call   800fce <sys_yield>
+  while (e->env_id == envid && e->env_status != ENV_FREE)
+  80334f:	8b 43 48             	mov    0x48(%ebx),%eax
+  803352:	39 f0                	cmp    %esi,%eax
+  803354:	75 07                	jne    80335d <wait+0x4a>
+  803356:	8b 43 54             	mov    0x54(%ebx),%eax
+  803359:	85 c0                	test   %eax,%eax
+  80335b:	75 ed                	jne    80334a <wait+0x37>
+}
+  80335d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803360:	5b                   	pop    %ebx
+  803361:	5e                   	pop    %esi
+  803362:	5d                   	pop    %ebp
+  803363:	c3                   	ret
+
+00803364 <mmap_find>:
+          utf->utf_eip, utf->utf_err);
+}
+
+static struct Mmap *
+mmap_find(uintptr_t va)
+{
+  803364:	55                   	push   %ebp
+  803365:	89 e5                	mov    %esp,%ebp
+  803367:	56                   	push   %esi
+  803368:	53                   	push   %ebx
+  int i;
+
+  for (i = 0; i < NMMAP; i++)
+  803369:	ba 60 77 80 00       	mov    $0x807760,%edx
+  80336e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803373:	eb 0b                	jmp    803380 <mmap_find+0x1c>
+  803375:	83 c3 01             	add    $0x1,%ebx
+  803378:	83 c2 14             	add    $0x14,%edx
+  80337b:	83 fb 10             	cmp    $0x10,%ebx
+  80337e:	74 1d                	je     80339d <mmap_find+0x39>
+    if (mmaps[i].mm_va && va >= mmaps[i].mm_va &&
+  803380:	8b 0a                	mov    (%edx),%ecx
+  803382:	39 c8                	cmp    %ecx,%eax
+  803384:	72 ef                	jb     803375 <mmap_find+0x11>
+  803386:	85 c9                	test   %ecx,%ecx
+  803388:	74 eb                	je     803375 <mmap_find+0x11>
+        va < mmaps[i].mm_va + mmaps[i].mm_len)
+  80338a:	03 4a 04             	add    0x4(%edx),%ecx
+    if (mmaps[i].mm_va && va >= mmaps[i].mm_va &&
+  80338d:	39 c8                	cmp    %ecx,%eax
+  80338f:	73 e4                	jae    803375 <mmap_find+0x11>
+      return &mmaps[i];
+  803391:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803394:	8d 04 85 60 77 80 00 	lea    0x807760(,%eax,4),%eax
+  80339b:	eb 05                	jmp    8033a2 <mmap_find+0x3e>
+  return NULL;
+  80339d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8033a2:	5b                   	pop    %ebx
+  8033a3:	5e                   	pop    %esi
+  8033a4:	5d                   	pop    %ebp
+  8033a5:	c3                   	ret
+
+008033a6 <va_mapped>:
+
+static bool
+va_mapped(uintptr_t va)
+{
+  return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+  8033a6:	89 c2                	mov    %eax,%edx
+  8033a8:	c1 ea 16             	shr    $0x16,%edx
+  8033ab:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8033b2:	f6 c2 01             	test   $0x1,%dl
+  8033b5:	74 11                	je     8033c8 <va_mapped+0x22>
+  8033b7:	c1 e8 0c             	shr    $0xc,%eax
+  8033ba:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8033c1:	83 e0 01             	and    $0x1,%eax
+  8033c4:	83 e0 01             	and    $0x1,%eax
+}
+  8033c7:	c3                   	ret
+  return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+  8033c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033cd:	eb f5                	jmp    8033c4 <va_mapped+0x1e>
+
+008033cf <mmap_copy>:
+
+// Replace the page at 'va' with a copy of its first 'n' bytes, the rest
+// zeroed, mapped with 'perm'.
+static void
+mmap_copy(uintptr_t va, size_t n, int perm)
+{
+  8033cf:	55                   	push   %ebp
+  8033d0:	89 e5                	mov    %esp,%ebp
+  8033d2:	57                   	push   %edi
+  8033d3:	56                   	push   %esi
+  8033d4:	53                   	push   %ebx
+  8033d5:	83 ec 10             	sub    $0x10,%esp
+  8033d8:	89 c3                	mov    %eax,%ebx
+  8033da:	89 d7                	mov    %edx,%edi
+  8033dc:	89 ce                	mov    %ecx,%esi
+  int r;
+
+  if ((r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  8033de:	6a 07                	push   $0x7
+  8033e0:	68 00 f0 7f 00       	push   $0x7ff000
+  8033e5:	6a 00                	push   $0x0
+  8033e7:	e8 44 dc ff ff       	call   801030 <sys_page_alloc>
+  8033ec:	83 c4 10             	add    $0x10,%esp
+  8033ef:	85 c0                	test   %eax,%eax
+  8033f1:	78 46                	js     803439 <mmap_copy+0x6a>
+    panic("mmap: %e", r);
+  memmove(PFTEMP, (void *) va, n);
+  8033f3:	83 ec 04             	sub    $0x4,%esp
+  8033f6:	57                   	push   %edi
+  8033f7:	53                   	push   %ebx
+  8033f8:	68 00 f0 7f 00       	push   $0x7ff000
+  8033fd:	e8 85 d9 ff ff       	call   800d87 <memmove>
+  if ((r = sys_page_map(0, PFTEMP, 0, (void *) va, perm)) < 0 ||
+  803402:	89 34 24             	mov    %esi,(%esp)
+  803405:	53                   	push   %ebx
+  803406:	6a 00                	push   $0x0
+  803408:	68 00 f0 7f 00       	push   $0x7ff000
+  80340d:	6a 00                	push   $0x0
+  80340f:	e8 5f dc ff ff       	call   801073 <sys_page_map>
+  803414:	83 c4 20             	add    $0x20,%esp
+  803417:	85 c0                	test   %eax,%eax
+  803419:	78 30                	js     80344b <mmap_copy+0x7c>
+      (r = sys_page_unmap(0, PFTEMP)) < 0)
+  80341b:	83 ec 08             	sub    $0x8,%esp
+  80341e:	68 00 f0 7f 00       	push   $0x7ff000
+  803423:	6a 00                	push   $0x0
+  803425:	e8 8b dc ff ff       	call   8010b5 <sys_page_unmap>
+  if ((r = sys_page_map(0, PFTEMP, 0, (void *) va, perm)) < 0 ||
+  80342a:	83 c4 10             	add    $0x10,%esp
+  80342d:	85 c0                	test   %eax,%eax
+  80342f:	78 1a                	js     80344b <mmap_copy+0x7c>
+    panic("mmap: %e", r);
+}
+  803431:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803434:	5b                   	pop    %ebx
+  803435:	5e                   	pop    %esi
+  803436:	5f                   	pop    %edi
+  803437:	5d                   	pop    %ebp
+  803438:	c3                   	ret
+    panic("mmap: %e", r);
+  803439:	50                   	push   %eax
+  80343a:	68 6d 44 80 00       	push   $0x80446d
+  80343f:	6a 3e                	push   $0x3e
+  803441:	68 76 44 80 00       	push   $0x804476
+  803446:	e8 ed d0 ff ff       	call   800538 <_panic>
+    panic("mmap: %e", r);
+  80344b:	50                   	push   %eax
+  80344c:	68 6d 44 80 00       	push   $0x80446d
+  803451:	6a 42                	push   $0x42
+  803453:	68 76 44 80 00       	push   $0x804476
+  803458:	e8 db d0 ff ff       	call   800538 <_panic>
+
+0080345d <mmap_fault>:
+// Handle a page fault in a mapping, if it is one.  Returns 1 if it was.
+// The fork page fault handlers call this first, so that mappings keep
+// working after a fork.
+bool
+mmap_fault(struct UTrapframe *utf)
+{
+  80345d:	55                   	push   %ebp
+  80345e:	89 e5                	mov    %esp,%ebp
+  803460:	57                   	push   %edi
+  803461:	56                   	push   %esi
+  803462:	53                   	push   %ebx
+  803463:	83 ec 1c             	sub    $0x1c,%esp
+  803466:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Fsreq_read_map saved;
+  struct Mmap *m;
+  uintptr_t va;
+  int perm, r;
+
+  va = ROUNDDOWN(utf->utf_fault_va, PGSIZE);
+  803469:	8b 1f                	mov    (%edi),%ebx
+  80346b:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if (va < MMAPBASE || va >= MMAPTOP || (m = mmap_find(va)) == NULL)
+  803471:	8d 83 00 00 00 60    	lea    0x60000000(%ebx),%eax
+  803477:	3d ff ff ff 2f       	cmp    $0x2fffffff,%eax
+  80347c:	0f 87 24 01 00 00    	ja     8035a6 <mmap_fault+0x149>
+  803482:	89 d8                	mov    %ebx,%eax
+  803484:	e8 db fe ff ff       	call   803364 <mmap_find>
+  803489:	89 c6                	mov    %eax,%esi
+  80348b:	85 c0                	test   %eax,%eax
+  80348d:	0f 84 20 01 00 00    	je     8035b3 <mmap_fault+0x156>
+    return 0;
+  if ((utf->utf_err & FEC_WR) && m->mm_perm == MAP_RDONLY)
+  803493:	f6 47 04 02          	testb  $0x2,0x4(%edi)
+  803497:	74 13                	je     8034ac <mmap_fault+0x4f>
+  803499:	83 78 10 00          	cmpl   $0x0,0x10(%eax)
+  80349d:	0f 84 17 01 00 00    	je     8035ba <mmap_fault+0x15d>
+    return 0;
+  perm = PTE_P | PTE_U | (m->mm_perm == MAP_RDONLY ? 0 : PTE_W);
+  8034a3:	c7 45 e4 07 00 00 00 	movl   $0x7,-0x1c(%ebp)
+  8034aa:	eb 0f                	jmp    8034bb <mmap_fault+0x5e>
+  8034ac:	83 78 10 01          	cmpl   $0x1,0x10(%eax)
+  8034b0:	19 c0                	sbb    %eax,%eax
+  8034b2:	83 e0 fe             	and    $0xfffffffe,%eax
+  8034b5:	83 c0 07             	add    $0x7,%eax
+  8034b8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+
+  if (!va_mapped(va)) {
+  8034bb:	89 d8                	mov    %ebx,%eax
+  8034bd:	e8 e4 fe ff ff       	call   8033a6 <va_mapped>
+  8034c2:	84 c0                	test   %al,%al
+  8034c4:	74 42                	je     803508 <mmap_fault+0xab>
+    }
+  }
+
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+    mmap_copy(va, PGSIZE, perm);
+  return 1;
+  8034c6:	b8 01 00 00 00       	mov    $0x1,%eax
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+  8034cb:	f6 47 04 02          	testb  $0x2,0x4(%edi)
+  8034cf:	0f 84 d6 00 00 00    	je     8035ab <mmap_fault+0x14e>
+  8034d5:	89 d8                	mov    %ebx,%eax
+  8034d7:	c1 e8 0c             	shr    $0xc,%eax
+  8034da:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  return 1;
+  8034e1:	b8 01 00 00 00       	mov    $0x1,%eax
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+  8034e6:	f6 c2 02             	test   $0x2,%dl
+  8034e9:	0f 85 bc 00 00 00    	jne    8035ab <mmap_fault+0x14e>
+    mmap_copy(va, PGSIZE, perm);
+  8034ef:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8034f2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8034f7:	89 d8                	mov    %ebx,%eax
+  8034f9:	e8 d1 fe ff ff       	call   8033cf <mmap_copy>
+  return 1;
+  8034fe:	b8 01 00 00 00       	mov    $0x1,%eax
+  803503:	e9 a3 00 00 00       	jmp    8035ab <mmap_fault+0x14e>
+    saved = fsipcbuf.read_map;
+  803508:	a1 00 80 80 00       	mov    0x808000,%eax
+  80350d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803510:	8b 15 04 80 80 00    	mov    0x808004,%edx
+  803516:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    r = read_map(m->mm_fd, m->mm_offset + (va - m->mm_va), (void *) va);
+  803519:	83 ec 04             	sub    $0x4,%esp
+  80351c:	53                   	push   %ebx
+  80351d:	89 d8                	mov    %ebx,%eax
+  80351f:	03 46 0c             	add    0xc(%esi),%eax
+  803522:	2b 06                	sub    (%esi),%eax
+  803524:	50                   	push   %eax
+  803525:	ff 76 08             	push   0x8(%esi)
+  803528:	e8 35 f3 ff ff       	call   802862 <read_map>
+    fsipcbuf.read_map = saved;
+  80352d:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  803530:	89 0d 00 80 80 00    	mov    %ecx,0x808000
+  803536:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  803539:	89 15 04 80 80 00    	mov    %edx,0x808004
+    if (r < 0)
+  80353f:	83 c4 10             	add    $0x10,%esp
+  803542:	85 c0                	test   %eax,%eax
+  803544:	78 20                	js     803566 <mmap_fault+0x109>
+    if (r == 0) {
+  803546:	74 30                	je     803578 <mmap_fault+0x11b>
+    if (r < PGSIZE) {
+  803548:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  80354d:	0f 8f 73 ff ff ff    	jg     8034c6 <mmap_fault+0x69>
+      mmap_copy(va, r, perm);
+  803553:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803556:	89 c2                	mov    %eax,%edx
+  803558:	89 d8                	mov    %ebx,%eax
+  80355a:	e8 70 fe ff ff       	call   8033cf <mmap_copy>
+      return 1;
+  80355f:	b8 01 00 00 00       	mov    $0x1,%eax
+  803564:	eb 45                	jmp    8035ab <mmap_fault+0x14e>
+      panic("mmap: read_map: %e", r);
+  803566:	50                   	push   %eax
+  803567:	68 81 44 80 00       	push   $0x804481
+  80356c:	6a 5f                	push   $0x5f
+  80356e:	68 76 44 80 00       	push   $0x804476
+  803573:	e8 c0 cf ff ff       	call   800538 <_panic>
+      if ((r = sys_page_alloc(0, (void *) va, perm)) < 0)
+  803578:	83 ec 04             	sub    $0x4,%esp
+  80357b:	ff 75 e4             	push   -0x1c(%ebp)
+  80357e:	53                   	push   %ebx
+  80357f:	6a 00                	push   $0x0
+  803581:	e8 aa da ff ff       	call   801030 <sys_page_alloc>
+  803586:	83 c4 10             	add    $0x10,%esp
+  803589:	85 c0                	test   %eax,%eax
+  80358b:	78 07                	js     803594 <mmap_fault+0x137>
+      return 1;
+  80358d:	b8 01 00 00 00       	mov    $0x1,%eax
+  803592:	eb 17                	jmp    8035ab <mmap_fault+0x14e>
+        panic("mmap: %e", r);
+  803594:	50                   	push   %eax
+  803595:	68 6d 44 80 00       	push   $0x80446d
+  80359a:	6a 64                	push   $0x64
+  80359c:	68 76 44 80 00       	push   $0x804476
+  8035a1:	e8 92 cf ff ff       	call   800538 <_panic>
+    return 0;
+  8035a6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8035ab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8035ae:	5b                   	pop    %ebx
+  8035af:	5e                   	pop    %esi
+  8035b0:	5f                   	pop    %edi
+  8035b1:	5d                   	pop    %ebp
+  8035b2:	c3                   	ret
+    return 0;
+  8035b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035b8:	eb f1                	jmp    8035ab <mmap_fault+0x14e>
+    return 0;
+  8035ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035bf:	eb ea                	jmp    8035ab <mmap_fault+0x14e>
+
+008035c1 <mmap_pgfault>:
+{
+  8035c1:	55                   	push   %ebp
+  8035c2:	89 e5                	mov    %esp,%ebp
+  8035c4:	53                   	push   %ebx
+  8035c5:	83 ec 10             	sub    $0x10,%esp
+  8035c8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (!mmap_fault(utf))
+  8035cb:	53                   	push   %ebx
+  8035cc:	e8 8c fe ff ff       	call   80345d <mmap_fault>
+  8035d1:	83 c4 10             	add    $0x10,%esp
+  8035d4:	84 c0                	test   %al,%al
+  8035d6:	74 05                	je     8035dd <mmap_pgfault+0x1c>
+}
+  8035d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8035db:	c9                   	leave
+  8035dc:	c3                   	ret
+    panic("page fault at %08x, eip %08x, err %04x", utf->utf_fault_va,
+  8035dd:	83 ec 08             	sub    $0x8,%esp
+  8035e0:	ff 73 04             	push   0x4(%ebx)
+  8035e3:	ff 73 28             	push   0x28(%ebx)
+  8035e6:	ff 33                	push   (%ebx)
+  8035e8:	68 94 44 80 00       	push   $0x804494
+  8035ed:	6a 20                	push   $0x20
+  8035ef:	68 76 44 80 00       	push   $0x804476
+  8035f4:	e8 3f cf ff ff       	call   800538 <_panic>
+
+008035f9 <mmap>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_INVAL if offset isn't aligned, len is 0, or perm is unknown
+//	-E_NO_MEM if there's no free slot or address space for it
+int
+mmap(int fdnum, off_t offset, size_t len, int perm, void **addr)
+{
+  8035f9:	55                   	push   %ebp
+  8035fa:	89 e5                	mov    %esp,%ebp
+  8035fc:	57                   	push   %edi
+  8035fd:	56                   	push   %esi
+  8035fe:	53                   	push   %ebx
+  8035ff:	83 ec 44             	sub    $0x44,%esp
+  803602:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  struct Fd *fd;
+  uintptr_t va;
+  int i, j, r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803605:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  803608:	50                   	push   %eax
+  803609:	ff 75 08             	push   0x8(%ebp)
+  80360c:	e8 df e4 ff ff       	call   801af0 <fd_lookup>
+  803611:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  803614:	83 c4 10             	add    $0x10,%esp
+  803617:	85 c0                	test   %eax,%eax
+  803619:	0f 88 3e 01 00 00    	js     80375d <mmap+0x164>
+    return r;
+  if (offset < 0 || PGOFF(offset) || len == 0 ||
+  80361f:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803623:	0f 88 d1 00 00 00    	js     8036fa <mmap+0x101>
+  803629:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80362c:	25 ff 0f 00 00       	and    $0xfff,%eax
+  803631:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  803634:	0f 85 c9 00 00 00    	jne    803703 <mmap+0x10a>
+  80363a:	85 db                	test   %ebx,%ebx
+  80363c:	0f 84 ca 00 00 00    	je     80370c <mmap+0x113>
+  803642:	83 7d 14 02          	cmpl   $0x2,0x14(%ebp)
+  803646:	0f 87 c0 00 00 00    	ja     80370c <mmap+0x113>
+      (perm != MAP_RDONLY && perm != MAP_PRIVATE && perm != MAP_SHARED))
+    return -E_INVAL;
+  len = ROUNDUP(len, PGSIZE);
+  80364c:	81 c3 ff 0f 00 00    	add    $0xfff,%ebx
+  803652:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  803658:	89 d9                	mov    %ebx,%ecx
+  80365a:	89 5d c4             	mov    %ebx,-0x3c(%ebp)
+
+  // First fit: try the start of the region and the end of each
+  // mapping.
+  for (i = -1; i < NMMAP; i++) {
+  80365d:	bb 4c 77 80 00       	mov    $0x80774c,%ebx
+  803662:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+    if (i >= 0 && !mmaps[i].mm_va)
+      continue;
+    va = i < 0 ? MMAPBASE : mmaps[i].mm_va + mmaps[i].mm_len;
+  803667:	bf 00 00 00 a0       	mov    $0xa0000000,%edi
+  80366c:	eb 53                	jmp    8036c1 <mmap+0xc8>
+  80366e:	bf 00 00 00 a0       	mov    $0xa0000000,%edi
+  803673:	eb 4c                	jmp    8036c1 <mmap+0xc8>
+    if (len > MMAPTOP - va)
+      continue;
+    for (j = 0; j < NMMAP; j++)
+  803675:	83 c0 01             	add    $0x1,%eax
+  803678:	83 f8 10             	cmp    $0x10,%eax
+  80367b:	0f 84 e7 00 00 00    	je     803768 <mmap+0x16f>
+      if (mmaps[j].mm_va && va < mmaps[j].mm_va + mmaps[j].mm_len &&
+  803681:	8d 34 80             	lea    (%eax,%eax,4),%esi
+  803684:	8b 14 b5 60 77 80 00 	mov    0x807760(,%esi,4),%edx
+  80368b:	85 d2                	test   %edx,%edx
+  80368d:	74 e6                	je     803675 <mmap+0x7c>
+  80368f:	89 d1                	mov    %edx,%ecx
+  803691:	03 0c b5 64 77 80 00 	add    0x807764(,%esi,4),%ecx
+  803698:	39 cf                	cmp    %ecx,%edi
+  80369a:	73 d9                	jae    803675 <mmap+0x7c>
+  80369c:	39 da                	cmp    %ebx,%edx
+  80369e:	73 d5                	jae    803675 <mmap+0x7c>
+  8036a0:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8036a3:	8b 55 cc             	mov    -0x34(%ebp),%edx
+  8036a6:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  for (i = -1; i < NMMAP; i++) {
+  8036a9:	83 c2 01             	add    $0x1,%edx
+  8036ac:	83 c3 14             	add    $0x14,%ebx
+  8036af:	83 fa 10             	cmp    $0x10,%edx
+  8036b2:	74 2b                	je     8036df <mmap+0xe6>
+    if (i >= 0 && !mmaps[i].mm_va)
+  8036b4:	85 d2                	test   %edx,%edx
+  8036b6:	78 b6                	js     80366e <mmap+0x75>
+  8036b8:	8b 3b                	mov    (%ebx),%edi
+  8036ba:	85 ff                	test   %edi,%edi
+  8036bc:	74 eb                	je     8036a9 <mmap+0xb0>
+    va = i < 0 ? MMAPBASE : mmaps[i].mm_va + mmaps[i].mm_len;
+  8036be:	03 7b 04             	add    0x4(%ebx),%edi
+    if (len > MMAPTOP - va)
+  8036c1:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8036c6:	29 f8                	sub    %edi,%eax
+  8036c8:	39 c8                	cmp    %ecx,%eax
+  8036ca:	72 dd                	jb     8036a9 <mmap+0xb0>
+    for (j = 0; j < NMMAP; j++)
+  8036cc:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+          mmaps[j].mm_va < va + len)
+  8036cf:	8d 34 0f             	lea    (%edi,%ecx,1),%esi
+  8036d2:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  8036d5:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  8036d8:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+  8036db:	89 f3                	mov    %esi,%ebx
+  8036dd:	eb a2                	jmp    803681 <mmap+0x88>
+        break;
+    if (j == NMMAP)
+      break;
+  }
+  if (i == NMMAP)
+    return -E_NO_MEM;
+  8036df:	c7 45 d4 fc ff ff ff 	movl   $0xfffffffc,-0x2c(%ebp)
+  8036e6:	eb 75                	jmp    80375d <mmap+0x164>
+    ;
+  if (j == NMMAP)
+    return -E_NO_MEM;
+
+  if (_pgfault_handler == 0)
+    set_pgfault_handler(mmap_pgfault);
+  8036e8:	83 ec 0c             	sub    $0xc,%esp
+  8036eb:	68 c1 35 80 00       	push   $0x8035c1
+  8036f0:	e8 f7 03 00 00       	call   803aec <set_pgfault_handler>
+  8036f5:	83 c4 10             	add    $0x10,%esp
+  8036f8:	eb 24                	jmp    80371e <mmap+0x125>
+    return -E_INVAL;
+  8036fa:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  803701:	eb 5a                	jmp    80375d <mmap+0x164>
+  803703:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  80370a:	eb 51                	jmp    80375d <mmap+0x164>
+  80370c:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  803713:	eb 48                	jmp    80375d <mmap+0x164>
+  if (_pgfault_handler == 0)
+  803715:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  80371c:	74 ca                	je     8036e8 <mmap+0xef>
+
+  mmaps[j].mm_va = va;
+  80371e:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803725:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803728:	c1 e2 02             	shl    $0x2,%edx
+  80372b:	89 ba 60 77 80 00    	mov    %edi,0x807760(%edx)
+  mmaps[j].mm_len = len;
+  803731:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  803734:	89 b2 64 77 80 00    	mov    %esi,0x807764(%edx)
+  mmaps[j].mm_fd = fdnum;
+  80373a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80373d:	89 b2 68 77 80 00    	mov    %esi,0x807768(%edx)
+  mmaps[j].mm_offset = offset;
+  803743:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803746:	89 b2 6c 77 80 00    	mov    %esi,0x80776c(%edx)
+  mmaps[j].mm_perm = perm;
+  80374c:	01 d8                	add    %ebx,%eax
+  80374e:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  803751:	89 1c 85 70 77 80 00 	mov    %ebx,0x807770(,%eax,4)
+  *addr = (void *) va;
+  803758:	8b 45 18             	mov    0x18(%ebp),%eax
+  80375b:	89 38                	mov    %edi,(%eax)
+  return 0;
+}
+  80375d:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  803760:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803763:	5b                   	pop    %ebx
+  803764:	5e                   	pop    %esi
+  803765:	5f                   	pop    %edi
+  803766:	5d                   	pop    %ebp
+  803767:	c3                   	ret
+  if (i == NMMAP)
+  803768:	b8 60 77 80 00       	mov    $0x807760,%eax
+  for (j = 0; j < NMMAP && mmaps[j].mm_va; j++)
+  80376d:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+  803770:	83 c0 14             	add    $0x14,%eax
+  803773:	83 78 ec 00          	cmpl   $0x0,-0x14(%eax)
+  803777:	74 9c                	je     803715 <mmap+0x11c>
+  803779:	83 c3 01             	add    $0x1,%ebx
+  80377c:	83 fb 10             	cmp    $0x10,%ebx
+  80377f:	75 ef                	jne    803770 <mmap+0x177>
+    return -E_NO_MEM;
+  803781:	c7 45 d4 fc ff ff ff 	movl   $0xfffffffc,-0x2c(%ebp)
+  803788:	eb d3                	jmp    80375d <mmap+0x164>
+
+0080378a <msync>:
+// nothing for other kinds of mapping.
+//
+// Returns 0 on success, < 0 on error.
+int
+msync(void *addr)
+{
+  80378a:	55                   	push   %ebp
+  80378b:	89 e5                	mov    %esp,%ebp
+  80378d:	57                   	push   %edi
+  80378e:	56                   	push   %esi
+  80378f:	53                   	push   %ebx
+  803790:	81 ec ac 00 00 00    	sub    $0xac,%esp
+  struct Stat st;
+  off_t saved, off;
+  uintptr_t va;
+  int n, r;
+
+  if ((m = mmap_find((uintptr_t) addr)) == NULL)
+  803796:	8b 45 08             	mov    0x8(%ebp),%eax
+  803799:	e8 c6 fb ff ff       	call   803364 <mmap_find>
+  80379e:	85 c0                	test   %eax,%eax
+  8037a0:	0f 84 58 01 00 00    	je     8038fe <msync+0x174>
+  8037a6:	89 c7                	mov    %eax,%edi
+    return -E_INVAL;
+  if (m->mm_perm != MAP_SHARED)
+    return 0;
+  8037a8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  if (m->mm_perm != MAP_SHARED)
+  8037ad:	83 78 10 02          	cmpl   $0x2,0x10(%eax)
+  8037b1:	74 0a                	je     8037bd <msync+0x33>
+                          PTE_P | PTE_U | PTE_W)) < 0)
+      break;
+  }
+  fd->fd_offset = saved;
+  return r < 0 ? r : 0;
+}
+  8037b3:	89 d8                	mov    %ebx,%eax
+  8037b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8037b8:	5b                   	pop    %ebx
+  8037b9:	5e                   	pop    %esi
+  8037ba:	5f                   	pop    %edi
+  8037bb:	5d                   	pop    %ebp
+  8037bc:	c3                   	ret
+  if ((r = fd_lookup(m->mm_fd, &fd)) < 0 || (r = fstat(m->mm_fd, &st)) < 0)
+  8037bd:	83 ec 08             	sub    $0x8,%esp
+  8037c0:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8037c3:	50                   	push   %eax
+  8037c4:	ff 77 08             	push   0x8(%edi)
+  8037c7:	e8 24 e3 ff ff       	call   801af0 <fd_lookup>
+  8037cc:	89 c3                	mov    %eax,%ebx
+  8037ce:	83 c4 10             	add    $0x10,%esp
+  8037d1:	85 c0                	test   %eax,%eax
+  8037d3:	78 de                	js     8037b3 <msync+0x29>
+  8037d5:	83 ec 08             	sub    $0x8,%esp
+  8037d8:	8d 85 58 ff ff ff    	lea    -0xa8(%ebp),%eax
+  8037de:	50                   	push   %eax
+  8037df:	ff 77 08             	push   0x8(%edi)
+  8037e2:	e8 ac e7 ff ff       	call   801f93 <fstat>
+  8037e7:	89 c3                	mov    %eax,%ebx
+  8037e9:	83 c4 10             	add    $0x10,%esp
+  8037ec:	85 c0                	test   %eax,%eax
+  8037ee:	78 c3                	js     8037b3 <msync+0x29>
+  saved = fd->fd_offset;
+  8037f0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8037f3:	8b 40 04             	mov    0x4(%eax),%eax
+  8037f6:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%ebp)
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE) {
+  8037fc:	8b 37                	mov    (%edi),%esi
+  8037fe:	eb 29                	jmp    803829 <msync+0x9f>
+    if ((r = sys_page_map(0, (void *) va, 0, (void *) va,
+  803800:	83 ec 0c             	sub    $0xc,%esp
+  803803:	6a 07                	push   $0x7
+  803805:	8b 85 50 ff ff ff    	mov    -0xb0(%ebp),%eax
+  80380b:	50                   	push   %eax
+  80380c:	6a 00                	push   $0x0
+  80380e:	50                   	push   %eax
+  80380f:	6a 00                	push   $0x0
+  803811:	e8 5d d8 ff ff       	call   801073 <sys_page_map>
+  803816:	89 c3                	mov    %eax,%ebx
+  803818:	83 c4 20             	add    $0x20,%esp
+  80381b:	85 c0                	test   %eax,%eax
+  80381d:	0f 88 c0 00 00 00    	js     8038e3 <msync+0x159>
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE) {
+  803823:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803829:	8b 07                	mov    (%edi),%eax
+  80382b:	89 85 54 ff ff ff    	mov    %eax,-0xac(%ebp)
+  803831:	03 47 04             	add    0x4(%edi),%eax
+  803834:	39 c6                	cmp    %eax,%esi
+  803836:	0f 83 a7 00 00 00    	jae    8038e3 <msync+0x159>
+    if (!va_mapped(va) || !(uvpt[PGNUM(va)] & PTE_D))
+  80383c:	89 f0                	mov    %esi,%eax
+  80383e:	e8 63 fb ff ff       	call   8033a6 <va_mapped>
+  803843:	84 c0                	test   %al,%al
+  803845:	74 dc                	je     803823 <msync+0x99>
+  803847:	89 f0                	mov    %esi,%eax
+  803849:	c1 e8 0c             	shr    $0xc,%eax
+  80384c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803853:	a8 40                	test   $0x40,%al
+  803855:	74 cc                	je     803823 <msync+0x99>
+    off = m->mm_offset + (va - m->mm_va);
+  803857:	8b 47 0c             	mov    0xc(%edi),%eax
+  80385a:	8b 8d 54 ff ff ff    	mov    -0xac(%ebp),%ecx
+  803860:	29 c8                	sub    %ecx,%eax
+  803862:	01 f0                	add    %esi,%eax
+    if (off >= st.st_size)
+  803864:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  803867:	39 c2                	cmp    %eax,%edx
+  803869:	7e 78                	jle    8038e3 <msync+0x159>
+    n = MIN(PGSIZE, st.st_size - off);
+  80386b:	29 c2                	sub    %eax,%edx
+  80386d:	89 d1                	mov    %edx,%ecx
+  80386f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803874:	39 d1                	cmp    %edx,%ecx
+  803876:	0f 4e d1             	cmovle %ecx,%edx
+  803879:	89 95 54 ff ff ff    	mov    %edx,-0xac(%ebp)
+    if ((r = seek(m->mm_fd, off)) < 0 ||
+  80387f:	83 ec 08             	sub    $0x8,%esp
+  803882:	50                   	push   %eax
+  803883:	ff 77 08             	push   0x8(%edi)
+  803886:	e8 60 e6 ff ff       	call   801eeb <seek>
+  80388b:	89 c3                	mov    %eax,%ebx
+  80388d:	83 c4 10             	add    $0x10,%esp
+  803890:	85 c0                	test   %eax,%eax
+  803892:	78 4f                	js     8038e3 <msync+0x159>
+        (r = write(m->mm_fd, (void *) va, n)) < 0)
+  803894:	89 b5 50 ff ff ff    	mov    %esi,-0xb0(%ebp)
+  80389a:	83 ec 04             	sub    $0x4,%esp
+  80389d:	ff b5 54 ff ff ff    	push   -0xac(%ebp)
+  8038a3:	56                   	push   %esi
+  8038a4:	ff 77 08             	push   0x8(%edi)
+  8038a7:	e8 bd e5 ff ff       	call   801e69 <write>
+  8038ac:	89 c3                	mov    %eax,%ebx
+    if ((r = seek(m->mm_fd, off)) < 0 ||
+  8038ae:	83 c4 10             	add    $0x10,%esp
+  8038b1:	85 c0                	test   %eax,%eax
+  8038b3:	78 2e                	js     8038e3 <msync+0x159>
+    if (r < n && (r = write(m->mm_fd, (char *) va + r, n - r)) < 0)
+  8038b5:	8b 95 54 ff ff ff    	mov    -0xac(%ebp),%edx
+  8038bb:	39 c2                	cmp    %eax,%edx
+  8038bd:	0f 8e 3d ff ff ff    	jle    803800 <msync+0x76>
+  8038c3:	89 d0                	mov    %edx,%eax
+  8038c5:	29 d8                	sub    %ebx,%eax
+  8038c7:	01 f3                	add    %esi,%ebx
+  8038c9:	83 ec 04             	sub    $0x4,%esp
+  8038cc:	50                   	push   %eax
+  8038cd:	53                   	push   %ebx
+  8038ce:	ff 77 08             	push   0x8(%edi)
+  8038d1:	e8 93 e5 ff ff       	call   801e69 <write>
+  8038d6:	89 c3                	mov    %eax,%ebx
+  8038d8:	83 c4 10             	add    $0x10,%esp
+  8038db:	85 c0                	test   %eax,%eax
+  8038dd:	0f 89 1d ff ff ff    	jns    803800 <msync+0x76>
+  fd->fd_offset = saved;
+  8038e3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8038e6:	8b 8d 4c ff ff ff    	mov    -0xb4(%ebp),%ecx
+  8038ec:	89 48 04             	mov    %ecx,0x4(%eax)
+  return r < 0 ? r : 0;
+  8038ef:	85 db                	test   %ebx,%ebx
+  8038f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038f6:	0f 4f d8             	cmovg  %eax,%ebx
+  8038f9:	e9 b5 fe ff ff       	jmp    8037b3 <msync+0x29>
+    return -E_INVAL;
+  8038fe:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  803903:	e9 ab fe ff ff       	jmp    8037b3 <msync+0x29>
+
+00803908 <munmap>:
+// Remove the mapping at 'addr', writing a MAP_SHARED one back first.
+//
+// Returns 0 on success, < 0 on error.
+int
+munmap(void *addr)
+{
+  803908:	55                   	push   %ebp
+  803909:	89 e5                	mov    %esp,%ebp
+  80390b:	56                   	push   %esi
+  80390c:	53                   	push   %ebx
+  80390d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct Mmap *m;
+  uintptr_t va;
+  int r;
+
+  if ((m = mmap_find((uintptr_t) addr)) == NULL)
+  803910:	89 d8                	mov    %ebx,%eax
+  803912:	e8 4d fa ff ff       	call   803364 <mmap_find>
+  803917:	85 c0                	test   %eax,%eax
+  803919:	74 56                	je     803971 <munmap+0x69>
+  80391b:	89 c6                	mov    %eax,%esi
+    return -E_INVAL;
+  if ((r = msync(addr)) < 0)
+  80391d:	83 ec 0c             	sub    $0xc,%esp
+  803920:	53                   	push   %ebx
+  803921:	e8 64 fe ff ff       	call   80378a <msync>
+  803926:	83 c4 10             	add    $0x10,%esp
+  803929:	85 c0                	test   %eax,%eax
+  80392b:	78 3d                	js     80396a <munmap+0x62>
+    return r;
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE)
+  80392d:	8b 1e                	mov    (%esi),%ebx
+  80392f:	eb 06                	jmp    803937 <munmap+0x2f>
+  803931:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803937:	8b 46 04             	mov    0x4(%esi),%eax
+  80393a:	03 06                	add    (%esi),%eax
+  80393c:	39 c3                	cmp    %eax,%ebx
+  80393e:	73 1f                	jae    80395f <munmap+0x57>
+    if (va_mapped(va) && (r = sys_page_unmap(0, (void *) va)) < 0)
+  803940:	89 d8                	mov    %ebx,%eax
+  803942:	e8 5f fa ff ff       	call   8033a6 <va_mapped>
+  803947:	84 c0                	test   %al,%al
+  803949:	74 e6                	je     803931 <munmap+0x29>
+  80394b:	83 ec 08             	sub    $0x8,%esp
+  80394e:	53                   	push   %ebx
+  80394f:	6a 00                	push   $0x0
+  803951:	e8 5f d7 ff ff       	call   8010b5 <sys_page_unmap>
+  803956:	83 c4 10             	add    $0x10,%esp
+  803959:	85 c0                	test   %eax,%eax
+  80395b:	79 d4                	jns    803931 <munmap+0x29>
+  80395d:	eb 0b                	jmp    80396a <munmap+0x62>
+      return r;
+  m->mm_va = 0;
+  80395f:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  return 0;
+  803965:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80396a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80396d:	5b                   	pop    %ebx
+  80396e:	5e                   	pop    %esi
+  80396f:	5d                   	pop    %ebp
+  803970:	c3                   	ret
+    return -E_INVAL;
+  803971:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803976:	eb f2                	jmp    80396a <munmap+0x62>
+
+00803978 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  803978:	b8 00 00 00 00       	mov    $0x0,%eax
+  80397d:	c3                   	ret
+
+0080397e <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80397e:	55                   	push   %ebp
+  80397f:	89 e5                	mov    %esp,%ebp
+  803981:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  803984:	68 bb 44 80 00       	push   $0x8044bb
+  803989:	ff 75 0c             	push   0xc(%ebp)
+  80398c:	e8 70 d2 ff ff       	call   800c01 <strcpy>
+  return 0;
+}
+  803991:	b8 00 00 00 00       	mov    $0x0,%eax
+  803996:	c9                   	leave
+  803997:	c3                   	ret
+
+00803998 <devcons_write>:
+{
+  803998:	55                   	push   %ebp
+  803999:	89 e5                	mov    %esp,%ebp
+  80399b:	57                   	push   %edi
+  80399c:	56                   	push   %esi
+  80399d:	53                   	push   %ebx
+  80399e:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  8039a4:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  8039a9:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  8039af:	eb 2e                	jmp    8039df <devcons_write+0x47>
+    m = n - tot;
+  8039b1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8039b4:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  8039b6:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8039bb:	39 c3                	cmp    %eax,%ebx
+  8039bd:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  8039c0:	83 ec 04             	sub    $0x4,%esp
+  8039c3:	53                   	push   %ebx
+  8039c4:	89 f0                	mov    %esi,%eax
+  8039c6:	03 45 0c             	add    0xc(%ebp),%eax
+  8039c9:	50                   	push   %eax
+  8039ca:	57                   	push   %edi
+  8039cb:	e8 b7 d3 ff ff       	call   800d87 <memmove>
+    sys_cputs(buf, m);
+  8039d0:	83 c4 08             	add    $0x8,%esp
+  8039d3:	53                   	push   %ebx
+  8039d4:	57                   	push   %edi
+  8039d5:	e8 57 d5 ff ff       	call   800f31 <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  8039da:	01 de                	add    %ebx,%esi
+  8039dc:	83 c4 10             	add    $0x10,%esp
+  8039df:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8039e2:	72 cd                	jb     8039b1 <devcons_write+0x19>
+}
+  8039e4:	89 f0                	mov    %esi,%eax
+  8039e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8039e9:	5b                   	pop    %ebx
+  8039ea:	5e                   	pop    %esi
+  8039eb:	5f                   	pop    %edi
+  8039ec:	5d                   	pop    %ebp
+  8039ed:	c3                   	ret
+
+008039ee <devcons_read>:
+{
+  8039ee:	55                   	push   %ebp
+  8039ef:	89 e5                	mov    %esp,%ebp
+  8039f1:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  8039f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039f9:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8039fd:	75 07                	jne    803a06 <devcons_read+0x18>
+  8039ff:	eb 1f                	jmp    803a20 <devcons_read+0x32>
+    sys_yield();
+  803a01:	e8 c8 d5 ff ff       	call   800fce <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  803a06:	e8 44 d5 ff ff       	call   800f4f <sys_cgetc>
+  803a0b:	85 c0                	test   %eax,%eax
+  803a0d:	74 f2                	je     803a01 <devcons_read+0x13>
+  if (c < 0)
+  803a0f:	78 0f                	js     803a20 <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  803a11:	83 f8 04             	cmp    $0x4,%eax
+  803a14:	74 0c                	je     803a22 <devcons_read+0x34>
+  *(char*)vbuf = c;
+  803a16:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803a19:	88 02                	mov    %al,(%edx)
+  return 1;
+  803a1b:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803a20:	c9                   	leave
+  803a21:	c3                   	ret
+    return 0;
+  803a22:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a27:	eb f7                	jmp    803a20 <devcons_read+0x32>
+
+00803a29 <cputchar>:
+{
+  803a29:	55                   	push   %ebp
+  803a2a:	89 e5                	mov    %esp,%ebp
+  803a2c:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  803a2f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803a32:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  803a35:	6a 01                	push   $0x1
+  803a37:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803a3a:	50                   	push   %eax
+  803a3b:	e8 f1 d4 ff ff       	call   800f31 <sys_cputs>
+}
+  803a40:	83 c4 10             	add    $0x10,%esp
+  803a43:	c9                   	leave
+  803a44:	c3                   	ret
+
+00803a45 <getchar>:
+{
+  803a45:	55                   	push   %ebp
+  803a46:	89 e5                	mov    %esp,%ebp
+  803a48:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  803a4b:	6a 01                	push   $0x1
+  803a4d:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803a50:	50                   	push   %eax
+  803a51:	6a 00                	push   $0x0
+  803a53:	e8 43 e3 ff ff       	call   801d9b <read>
+  if (r < 0)
+  803a58:	83 c4 10             	add    $0x10,%esp
+  803a5b:	85 c0                	test   %eax,%eax
+  803a5d:	78 06                	js     803a65 <getchar+0x20>
+  if (r < 1)
+  803a5f:	74 06                	je     803a67 <getchar+0x22>
+  return c;
+  803a61:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803a65:	c9                   	leave
+  803a66:	c3                   	ret
+    return -E_EOF;
+  803a67:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803a6c:	eb f7                	jmp    803a65 <getchar+0x20>
+
+00803a6e <iscons>:
+{
+  803a6e:	55                   	push   %ebp
+  803a6f:	89 e5                	mov    %esp,%ebp
+  803a71:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803a74:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803a77:	50                   	push   %eax
+  803a78:	ff 75 08             	push   0x8(%ebp)
+  803a7b:	e8 70 e0 ff ff       	call   801af0 <fd_lookup>
+  803a80:	83 c4 10             	add    $0x10,%esp
+  803a83:	85 c0                	test   %eax,%eax
+  803a85:	78 11                	js     803a98 <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  803a87:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803a8a:	8b 15 3c 50 80 00    	mov    0x80503c,%edx
+  803a90:	39 10                	cmp    %edx,(%eax)
+  803a92:	0f 94 c0             	sete   %al
+  803a95:	0f b6 c0             	movzbl %al,%eax
+}
+  803a98:	c9                   	leave
+  803a99:	c3                   	ret
+
+00803a9a <opencons>:
+{
+  803a9a:	55                   	push   %ebp
+  803a9b:	89 e5                	mov    %esp,%ebp
+  803a9d:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  803aa0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803aa3:	50                   	push   %eax
+  803aa4:	e8 f1 df ff ff       	call   801a9a <fd_alloc>
+  803aa9:	83 c4 10             	add    $0x10,%esp
+  803aac:	85 c0                	test   %eax,%eax
+  803aae:	78 3a                	js     803aea <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803ab0:	83 ec 04             	sub    $0x4,%esp
+  803ab3:	68 07 04 00 00       	push   $0x407
+  803ab8:	ff 75 f4             	push   -0xc(%ebp)
+  803abb:	6a 00                	push   $0x0
+  803abd:	e8 6e d5 ff ff       	call   801030 <sys_page_alloc>
+  803ac2:	83 c4 10             	add    $0x10,%esp
+  803ac5:	85 c0                	test   %eax,%eax
+  803ac7:	78 21                	js     803aea <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  803ac9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803acc:	8b 15 3c 50 80 00    	mov    0x80503c,%edx
+  803ad2:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  803ad4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803ad7:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  803ade:	83 ec 0c             	sub    $0xc,%esp
+  803ae1:	50                   	push   %eax
+  803ae2:	e8 8f df ff ff       	call   801a76 <fd2num>
+  803ae7:	83 c4 10             	add    $0x10,%esp
+}
+  803aea:	c9                   	leave
+  803aeb:	c3                   	ret
+
+00803aec <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  803aec:	55                   	push   %ebp
+  803aed:	89 e5                	mov    %esp,%ebp
+  803aef:	53                   	push   %ebx
+  803af0:	83 ec 04             	sub    $0x4,%esp
+  int r;
+
+  if (_pgfault_handler == 0) {
+  803af3:	83 3d 00 90 80 00 00 	cmpl   $0x0,0x809000
+  803afa:	74 0d                	je     803b09 <set_pgfault_handler+0x1d>
+
+    sys_env_set_pgfault_upcall(id, _pgfault_upcall);
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  803afc:	8b 45 08             	mov    0x8(%ebp),%eax
+  803aff:	a3 00 90 80 00       	mov    %eax,0x809000
+}
+  803b04:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803b07:	c9                   	leave
+  803b08:	c3                   	ret
+    envid_t id = sys_getenvid();
+  803b09:	e8 a1 d4 ff ff       	call   800faf <sys_getenvid>
+  803b0e:	89 c3                	mov    %eax,%ebx
+    sys_page_alloc(id, (void *) (UXSTACKTOP - PGSIZE), (PTE_P | PTE_U | PTE_W));
+  803b10:	83 ec 04             	sub    $0x4,%esp
+  803b13:	6a 07                	push   $0x7
+  803b15:	68 00 f0 bf ee       	push   $0xeebff000
+  803b1a:	50                   	push   %eax
+  803b1b:	e8 10 d5 ff ff       	call   801030 <sys_page_alloc>
+    sys_env_set_pgfault_upcall(id, _pgfault_upcall);
+  803b20:	83 c4 08             	add    $0x8,%esp
+  803b23:	68 33 3b 80 00       	push   $0x803b33
+  803b28:	53                   	push   %ebx
+  803b29:	e8 77 d7 ff ff       	call   8012a5 <sys_env_set_pgfault_upcall>
+  803b2e:	83 c4 10             	add    $0x10,%esp
+  803b31:	eb c9                	jmp    803afc <set_pgfault_handler+0x10>
+
+00803b33 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  803b33:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  803b34:	a1 00 90 80 00       	mov    0x809000,%eax
+	call *%eax
+  803b39:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  803b3b:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+  movl 48(%esp), %eax       // move trap time esp to eax
+  803b3e:	8b 44 24 30          	mov    0x30(%esp),%eax
+  subl $4, %eax             // make room for eip on trap time esp
+  803b42:	83 e8 04             	sub    $0x4,%eax
+  movl %eax, 48(%esp)       // move value to esp
+  803b45:	89 44 24 30          	mov    %eax,0x30(%esp)
+  movl 40(%esp), %ebx       // move trap time eip to ebx
+  803b49:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+  movl %ebx, 0(%eax)
+  803b4d:	89 18                	mov    %ebx,(%eax)
+
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+  addl $0x08,%esp
+  803b4f:	83 c4 08             	add    $0x8,%esp
+  popal
+  803b52:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+  addl $4, %esp          // skip tf->eip
+  803b53:	83 c4 04             	add    $0x4,%esp
+  popf                 // pop stack value into flags register
+  803b56:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+  popl %esp
+  803b57:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+  ret
+  803b58:	c3                   	ret
+
+00803b59 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803b59:	55                   	push   %ebp
+  803b5a:	89 e5                	mov    %esp,%ebp
+  803b5c:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  803b5f:	89 c2                	mov    %eax,%edx
+  803b61:	c1 ea 16             	shr    $0x16,%edx
+  803b64:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  803b6b:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  803b70:	f6 c1 01             	test   $0x1,%cl
+  803b73:	74 1c                	je     803b91 <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  803b75:	c1 e8 0c             	shr    $0xc,%eax
+  803b78:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  803b7f:	a8 01                	test   $0x1,%al
+  803b81:	74 0e                	je     803b91 <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  803b83:	c1 e8 0c             	shr    $0xc,%eax
+  803b86:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  803b8d:	ef 
+  803b8e:	0f b7 d2             	movzwl %dx,%edx
+}
+  803b91:	89 d0                	mov    %edx,%eax
+  803b93:	5d                   	pop    %ebp
+  803b94:	c3                   	ret
+
+00803b95 <udivmod>:
+  803b95:	55                   	push   %ebp
+  803b96:	57                   	push   %edi
+  803b97:	56                   	push   %esi
+  803b98:	53                   	push   %ebx
+  803b99:	83 ec 14             	sub    $0x14,%esp
+  803b9c:	8b 74 24 28          	mov    0x28(%esp),%esi
+  803ba0:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  803ba4:	89 fb                	mov    %edi,%ebx
+  803ba6:	09 f3                	or     %esi,%ebx
+  803ba8:	0f 84 88 00 00 00    	je     803c36 <udivmod+0xa1>
+  803bae:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803bb3:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  803bba:	00 
+  803bbb:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  803bc2:	00 
+  803bc3:	89 cd                	mov    %ecx,%ebp
+  803bc5:	89 34 24             	mov    %esi,(%esp)
+  803bc8:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  803bcc:	eb 08                	jmp    803bd6 <udivmod+0x41>
+  803bce:	83 ed 01             	sub    $0x1,%ebp
+  803bd1:	83 fd ff             	cmp    $0xffffffff,%ebp
+  803bd4:	74 6c                	je     803c42 <udivmod+0xad>
+  803bd6:	89 c3                	mov    %eax,%ebx
+  803bd8:	89 d6                	mov    %edx,%esi
+  803bda:	89 e9                	mov    %ebp,%ecx
+  803bdc:	0f ad f3             	shrd   %cl,%esi,%ebx
+  803bdf:	d3 ee                	shr    %cl,%esi
+  803be1:	f6 c1 20             	test   $0x20,%cl
+  803be4:	74 04                	je     803bea <udivmod+0x55>
+  803be6:	89 f3                	mov    %esi,%ebx
+  803be8:	31 f6                	xor    %esi,%esi
+  803bea:	8b 3c 24             	mov    (%esp),%edi
+  803bed:	39 fb                	cmp    %edi,%ebx
+  803bef:	89 f7                	mov    %esi,%edi
+  803bf1:	8b 1c 24             	mov    (%esp),%ebx
+  803bf4:	8b 74 24 04          	mov    0x4(%esp),%esi
+  803bf8:	19 f7                	sbb    %esi,%edi
+  803bfa:	72 d2                	jb     803bce <udivmod+0x39>
+  803bfc:	89 f7                	mov    %esi,%edi
+  803bfe:	89 de                	mov    %ebx,%esi
+  803c00:	89 e9                	mov    %ebp,%ecx
+  803c02:	0f a5 f7             	shld   %cl,%esi,%edi
+  803c05:	d3 e6                	shl    %cl,%esi
+  803c07:	f6 c1 20             	test   $0x20,%cl
+  803c0a:	74 04                	je     803c10 <udivmod+0x7b>
+  803c0c:	89 f7                	mov    %esi,%edi
+  803c0e:	31 f6                	xor    %esi,%esi
+  803c10:	29 f0                	sub    %esi,%eax
+  803c12:	19 fa                	sbb    %edi,%edx
+  803c14:	be 01 00 00 00       	mov    $0x1,%esi
+  803c19:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c1e:	0f a5 f7             	shld   %cl,%esi,%edi
+  803c21:	d3 e6                	shl    %cl,%esi
+  803c23:	f6 c1 20             	test   $0x20,%cl
+  803c26:	74 04                	je     803c2c <udivmod+0x97>
+  803c28:	89 f7                	mov    %esi,%edi
+  803c2a:	31 f6                	xor    %esi,%esi
+  803c2c:	09 74 24 08          	or     %esi,0x8(%esp)
+  803c30:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  803c34:	eb 98                	jmp    803bce <udivmod+0x39>
+  803c36:	89 f0                	mov    %esi,%eax
+  803c38:	89 fa                	mov    %edi,%edx
+  803c3a:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803c3e:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  803c42:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  803c46:	89 01                	mov    %eax,(%ecx)
+  803c48:	89 51 04             	mov    %edx,0x4(%ecx)
+  803c4b:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803c4f:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803c53:	83 c4 14             	add    $0x14,%esp
+  803c56:	5b                   	pop    %ebx
+  803c57:	5e                   	pop    %esi
+  803c58:	5f                   	pop    %edi
+  803c59:	5d                   	pop    %ebp
+  803c5a:	c3                   	ret
+
+00803c5b <__udivdi3>:
+  803c5b:	83 ec 18             	sub    $0x18,%esp
+  803c5e:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803c62:	50                   	push   %eax
+  803c63:	ff 74 24 2c          	push   0x2c(%esp)
+  803c67:	ff 74 24 2c          	push   0x2c(%esp)
+  803c6b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803c6f:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803c73:	e8 1d ff ff ff       	call   803b95 <udivmod>
+  803c78:	83 c4 24             	add    $0x24,%esp
+  803c7b:	c3                   	ret
+
+00803c7c <__umoddi3>:
+  803c7c:	83 ec 18             	sub    $0x18,%esp
+  803c7f:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803c83:	50                   	push   %eax
+  803c84:	ff 74 24 2c          	push   0x2c(%esp)
+  803c88:	ff 74 24 2c          	push   0x2c(%esp)
+  803c8c:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803c90:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803c94:	e8 fc fe ff ff       	call   803b95 <udivmod>
+  803c99:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803c9d:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803ca1:	83 c4 24             	add    $0x24,%esp
+  803ca4:	c3                   	ret
+
+00803ca5 <__divdi3>:
+  803ca5:	56                   	push   %esi
+  803ca6:	53                   	push   %ebx
+  803ca7:	83 ec 14             	sub    $0x14,%esp
+  803caa:	8b 44 24 20          	mov    0x20(%esp),%eax
+  803cae:	8b 54 24 24          	mov    0x24(%esp),%edx
+  803cb2:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  803cb6:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  803cba:	85 d2                	test   %edx,%edx
+  803cbc:	78 18                	js     803cd6 <__divdi3+0x31>
+  803cbe:	85 db                	test   %ebx,%ebx
+  803cc0:	78 3e                	js     803d00 <__divdi3+0x5b>
+  803cc2:	83 ec 04             	sub    $0x4,%esp
+  803cc5:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803cc9:	56                   	push   %esi
+  803cca:	53                   	push   %ebx
+  803ccb:	51                   	push   %ecx
+  803ccc:	e8 c4 fe ff ff       	call   803b95 <udivmod>
+  803cd1:	83 c4 10             	add    $0x10,%esp
+  803cd4:	eb 24                	jmp    803cfa <__divdi3+0x55>
+  803cd6:	f7 d8                	neg    %eax
+  803cd8:	83 d2 00             	adc    $0x0,%edx
+  803cdb:	f7 da                	neg    %edx
+  803cdd:	85 db                	test   %ebx,%ebx
+  803cdf:	78 3a                	js     803d1b <__divdi3+0x76>
+  803ce1:	83 ec 04             	sub    $0x4,%esp
+  803ce4:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803ce8:	56                   	push   %esi
+  803ce9:	53                   	push   %ebx
+  803cea:	51                   	push   %ecx
+  803ceb:	e8 a5 fe ff ff       	call   803b95 <udivmod>
+  803cf0:	83 c4 10             	add    $0x10,%esp
+  803cf3:	f7 d8                	neg    %eax
+  803cf5:	83 d2 00             	adc    $0x0,%edx
+  803cf8:	f7 da                	neg    %edx
+  803cfa:	83 c4 14             	add    $0x14,%esp
+  803cfd:	5b                   	pop    %ebx
+  803cfe:	5e                   	pop    %esi
+  803cff:	c3                   	ret
+  803d00:	83 ec 04             	sub    $0x4,%esp
+  803d03:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803d07:	56                   	push   %esi
+  803d08:	f7 d9                	neg    %ecx
+  803d0a:	83 d3 00             	adc    $0x0,%ebx
+  803d0d:	f7 db                	neg    %ebx
+  803d0f:	53                   	push   %ebx
+  803d10:	51                   	push   %ecx
+  803d11:	e8 7f fe ff ff       	call   803b95 <udivmod>
+  803d16:	83 c4 10             	add    $0x10,%esp
+  803d19:	eb d8                	jmp    803cf3 <__divdi3+0x4e>
+  803d1b:	83 ec 04             	sub    $0x4,%esp
+  803d1e:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803d22:	56                   	push   %esi
+  803d23:	f7 d9                	neg    %ecx
+  803d25:	83 d3 00             	adc    $0x0,%ebx
+  803d28:	f7 db                	neg    %ebx
+  803d2a:	53                   	push   %ebx
+  803d2b:	51                   	push   %ecx
+  803d2c:	e8 64 fe ff ff       	call   803b95 <udivmod>
+  803d31:	83 c4 10             	add    $0x10,%esp
+  803d34:	eb c4                	jmp    803cfa <__divdi3+0x55>
+
+00803d36 <__moddi3>:
+  803d36:	55                   	push   %ebp
+  803d37:	57                   	push   %edi
+  803d38:	56                   	push   %esi
+  803d39:	53                   	push   %ebx
+  803d3a:	83 ec 24             	sub    $0x24,%esp
+  803d3d:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803d41:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803d45:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  803d49:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  803d4d:	85 d2                	test   %edx,%edx
+  803d4f:	78 3b                	js     803d8c <__moddi3+0x56>
+  803d51:	83 ec 04             	sub    $0x4,%esp
+  803d54:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803d58:	56                   	push   %esi
+  803d59:	89 ce                	mov    %ecx,%esi
+  803d5b:	f7 de                	neg    %esi
+  803d5d:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803d61:	89 de                	mov    %ebx,%esi
+  803d63:	83 d6 00             	adc    $0x0,%esi
+  803d66:	f7 de                	neg    %esi
+  803d68:	89 74 24 14          	mov    %esi,0x14(%esp)
+  803d6c:	8b 74 24 08          	mov    0x8(%esp),%esi
+  803d70:	0f 48 f1             	cmovs  %ecx,%esi
+  803d73:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  803d78:	53                   	push   %ebx
+  803d79:	56                   	push   %esi
+  803d7a:	e8 16 fe ff ff       	call   803b95 <udivmod>
+  803d7f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803d83:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803d87:	83 c4 10             	add    $0x10,%esp
+  803d8a:	eb 47                	jmp    803dd3 <__moddi3+0x9d>
+  803d8c:	f7 d8                	neg    %eax
+  803d8e:	83 d2 00             	adc    $0x0,%edx
+  803d91:	f7 da                	neg    %edx
+  803d93:	83 ec 04             	sub    $0x4,%esp
+  803d96:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803d9a:	56                   	push   %esi
+  803d9b:	89 cf                	mov    %ecx,%edi
+  803d9d:	f7 df                	neg    %edi
+  803d9f:	89 de                	mov    %ebx,%esi
+  803da1:	83 d6 00             	adc    $0x0,%esi
+  803da4:	f7 de                	neg    %esi
+  803da6:	0f 49 cf             	cmovns %edi,%ecx
+  803da9:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  803dad:	0f 49 de             	cmovns %esi,%ebx
+  803db0:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  803db4:	ff 74 24 0c          	push   0xc(%esp)
+  803db8:	ff 74 24 0c          	push   0xc(%esp)
+  803dbc:	e8 d4 fd ff ff       	call   803b95 <udivmod>
+  803dc1:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803dc5:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803dc9:	f7 d8                	neg    %eax
+  803dcb:	83 d2 00             	adc    $0x0,%edx
+  803dce:	f7 da                	neg    %edx
+  803dd0:	83 c4 10             	add    $0x10,%esp
+  803dd3:	83 c4 24             	add    $0x24,%esp
+  803dd6:	5b                   	pop    %ebx
+  803dd7:	5e                   	pop    %esi
+  803dd8:	5f                   	pop    %edi
+  803dd9:	5d                   	pop    %ebp
+  803dda:	c3                   	ret
@@ -0,0 +1,7727 @@
+
+obj/user/mmapbench.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 72 05 00 00       	call   8005a3 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <byread>:
+  close(fd);
+}
+
+static unsigned
+byread(int fd)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 1c             	sub    $0x1c,%esp
+  80003c:	89 c6                	mov    %eax,%esi
+  unsigned us;
+  int i, r;
+
+  us = sys_time_msec();
+  80003e:	e8 df 13 00 00       	call   801422 <sys_time_msec>
+  800043:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < NACCESS; i++) {
+  800046:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if ((r = seek(fd, offsets[i])) < 0 ||
+  80004b:	83 ec 08             	sub    $0x8,%esp
+  80004e:	ff 34 9d 00 60 80 00 	push   0x806000(,%ebx,4)
+  800055:	56                   	push   %esi
+  800056:	e8 d1 19 00 00       	call   801a2c <seek>
+  80005b:	83 c4 10             	add    $0x10,%esp
+  80005e:	85 c0                	test   %eax,%eax
+  800060:	78 63                	js     8000c5 <byread+0x92>
+        (r = readn(fd, buf, RECSIZE)) != RECSIZE)
+  800062:	83 ec 04             	sub    $0x4,%esp
+  800065:	6a 40                	push   $0x40
+  800067:	68 40 7f 80 00       	push   $0x807f40
+  80006c:	56                   	push   %esi
+  80006d:	e8 f1 18 00 00       	call   801963 <readn>
+    if ((r = seek(fd, offsets[i])) < 0 ||
+  800072:	83 c4 10             	add    $0x10,%esp
+  800075:	83 f8 40             	cmp    $0x40,%eax
+  800078:	75 4b                	jne    8000c5 <byread+0x92>
+      panic("read %s: %e", BIGNAME, r);
+    if (*(uint32_t*) buf != offsets[i] / 4)
+  80007a:	8b 14 9d 00 60 80 00 	mov    0x806000(,%ebx,4),%edx
+  800081:	8d 42 03             	lea    0x3(%edx),%eax
+  800084:	85 d2                	test   %edx,%edx
+  800086:	0f 49 c2             	cmovns %edx,%eax
+  800089:	c1 f8 02             	sar    $0x2,%eax
+  80008c:	39 05 40 7f 80 00    	cmp    %eax,0x807f40
+  800092:	75 4b                	jne    8000df <byread+0xac>
+  for (i = 0; i < NACCESS; i++) {
+  800094:	83 c3 01             	add    $0x1,%ebx
+  800097:	81 fb d0 07 00 00    	cmp    $0x7d0,%ebx
+  80009d:	75 ac                	jne    80004b <byread+0x18>
+      panic("read %s: bad data at %d", BIGNAME, offsets[i]);
+  }
+  return (sys_time_msec() - us) * 1000 / NACCESS;
+  80009f:	e8 7e 13 00 00       	call   801422 <sys_time_msec>
+  8000a4:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8000a7:	29 c8                	sub    %ecx,%eax
+  8000a9:	69 d0 e8 03 00 00    	imul   $0x3e8,%eax,%edx
+  8000af:	b9 d3 4d 62 10       	mov    $0x10624dd3,%ecx
+  8000b4:	89 d0                	mov    %edx,%eax
+  8000b6:	f7 e1                	mul    %ecx
+  8000b8:	89 d0                	mov    %edx,%eax
+  8000ba:	c1 e8 07             	shr    $0x7,%eax
+}
+  8000bd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000c0:	5b                   	pop    %ebx
+  8000c1:	5e                   	pop    %esi
+  8000c2:	5f                   	pop    %edi
+  8000c3:	5d                   	pop    %ebp
+  8000c4:	c3                   	ret
+      panic("read %s: %e", BIGNAME, r);
+  8000c5:	83 ec 0c             	sub    $0xc,%esp
+  8000c8:	50                   	push   %eax
+  8000c9:	68 40 3a 80 00       	push   $0x803a40
+  8000ce:	68 4f 3a 80 00       	push   $0x803a4f
+  8000d3:	6a 2e                	push   $0x2e
+  8000d5:	68 5b 3a 80 00       	push   $0x803a5b
+  8000da:	e8 31 05 00 00       	call   800610 <_panic>
+      panic("read %s: bad data at %d", BIGNAME, offsets[i]);
+  8000df:	83 ec 0c             	sub    $0xc,%esp
+  8000e2:	52                   	push   %edx
+  8000e3:	68 40 3a 80 00       	push   $0x803a40
+  8000e8:	68 6c 3a 80 00       	push   $0x803a6c
+  8000ed:	6a 30                	push   $0x30
+  8000ef:	68 5b 3a 80 00       	push   $0x803a5b
+  8000f4:	e8 17 05 00 00       	call   800610 <_panic>
+
+008000f9 <bymap>:
+
+static unsigned
+bymap(char *map)
+{
+  8000f9:	55                   	push   %ebp
+  8000fa:	89 e5                	mov    %esp,%ebp
+  8000fc:	57                   	push   %edi
+  8000fd:	56                   	push   %esi
+  8000fe:	53                   	push   %ebx
+  8000ff:	83 ec 0c             	sub    $0xc,%esp
+  800102:	89 c6                	mov    %eax,%esi
+  unsigned us;
+  int i;
+
+  us = sys_time_msec();
+  800104:	e8 19 13 00 00       	call   801422 <sys_time_msec>
+  800109:	89 c7                	mov    %eax,%edi
+  for (i = 0; i < NACCESS; i++) {
+  80010b:	bb 00 00 00 00       	mov    $0x0,%ebx
+    memmove(buf, map + offsets[i], RECSIZE);
+  800110:	83 ec 04             	sub    $0x4,%esp
+  800113:	6a 40                	push   $0x40
+  800115:	89 f0                	mov    %esi,%eax
+  800117:	03 04 9d 00 60 80 00 	add    0x806000(,%ebx,4),%eax
+  80011e:	50                   	push   %eax
+  80011f:	68 40 7f 80 00       	push   $0x807f40
+  800124:	e8 36 0d 00 00       	call   800e5f <memmove>
+    if (*(uint32_t*) buf != offsets[i] / 4)
+  800129:	8b 14 9d 00 60 80 00 	mov    0x806000(,%ebx,4),%edx
+  800130:	8d 42 03             	lea    0x3(%edx),%eax
+  800133:	83 c4 10             	add    $0x10,%esp
+  800136:	85 d2                	test   %edx,%edx
+  800138:	0f 49 c2             	cmovns %edx,%eax
+  80013b:	c1 f8 02             	sar    $0x2,%eax
+  80013e:	39 05 40 7f 80 00    	cmp    %eax,0x807f40
+  800144:	75 2e                	jne    800174 <bymap+0x7b>
+  for (i = 0; i < NACCESS; i++) {
+  800146:	83 c3 01             	add    $0x1,%ebx
+  800149:	81 fb d0 07 00 00    	cmp    $0x7d0,%ebx
+  80014f:	75 bf                	jne    800110 <bymap+0x17>
+      panic("mmap %s: bad data at %d", BIGNAME, offsets[i]);
+  }
+  return (sys_time_msec() - us) * 1000 / NACCESS;
+  800151:	e8 cc 12 00 00       	call   801422 <sys_time_msec>
+  800156:	29 f8                	sub    %edi,%eax
+  800158:	69 d0 e8 03 00 00    	imul   $0x3e8,%eax,%edx
+  80015e:	b9 d3 4d 62 10       	mov    $0x10624dd3,%ecx
+  800163:	89 d0                	mov    %edx,%eax
+  800165:	f7 e1                	mul    %ecx
+  800167:	89 d0                	mov    %edx,%eax
+  800169:	c1 e8 07             	shr    $0x7,%eax
+}
+  80016c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80016f:	5b                   	pop    %ebx
+  800170:	5e                   	pop    %esi
+  800171:	5f                   	pop    %edi
+  800172:	5d                   	pop    %ebp
+  800173:	c3                   	ret
+      panic("mmap %s: bad data at %d", BIGNAME, offsets[i]);
+  800174:	83 ec 0c             	sub    $0xc,%esp
+  800177:	52                   	push   %edx
+  800178:	68 40 3a 80 00       	push   $0x803a40
+  80017d:	68 84 3a 80 00       	push   $0x803a84
+  800182:	6a 3f                	push   $0x3f
+  800184:	68 5b 3a 80 00       	push   $0x803a5b
+  800189:	e8 82 04 00 00       	call   800610 <_panic>
+
+0080018e <umain>:
+    panic("MAP_PRIVATE write reached the file: %08x", word);
+}
+
+void
+umain(int argc, char **argv)
+{
+  80018e:	55                   	push   %ebp
+  80018f:	89 e5                	mov    %esp,%ebp
+  800191:	57                   	push   %edi
+  800192:	56                   	push   %esi
+  800193:	53                   	push   %ebx
+  800194:	83 ec 1c             	sub    $0x1c,%esp
+  unsigned cold, warm;
+  off_t size;
+  char *map;
+  int fd, i, r;
+
+  binaryname = "mmapbench";
+  800197:	c7 05 00 50 80 00 9c 	movl   $0x803a9c,0x805000
+  80019e:	3a 80 00 
+  size = 1024 * 1024;
+  8001a1:	b8 00 00 10 00       	mov    $0x100000,%eax
+  if (argc > 1)
+  8001a6:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+  8001aa:	7f 7d                	jg     800229 <umain+0x9b>
+    size = strtol(argv[1], 0, 0) * 1024;
+  size = ROUNDUP(size, PGSIZE);
+  8001ac:	05 ff 0f 00 00       	add    $0xfff,%eax
+  8001b1:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8001b6:	89 c6                	mov    %eax,%esi
+  if ((fd = open(BIGNAME, O_RDWR | O_CREAT | O_TRUNC)) < 0)
+  8001b8:	83 ec 08             	sub    $0x8,%esp
+  8001bb:	68 02 03 00 00       	push   $0x302
+  8001c0:	68 40 3a 80 00       	push   $0x803a40
+  8001c5:	e8 3d 1f 00 00       	call   802107 <open>
+  8001ca:	89 c7                	mov    %eax,%edi
+  8001cc:	83 c4 10             	add    $0x10,%esp
+  8001cf:	85 c0                	test   %eax,%eax
+  8001d1:	78 73                	js     800246 <umain+0xb8>
+  for (off = 0; off < size; off += PGSIZE) {
+  8001d3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8001d8:	39 de                	cmp    %ebx,%esi
+  8001da:	0f 8e 9a 00 00 00    	jle    80027a <umain+0xec>
+      ((uint32_t*) buf)[i] = off / 4 + i;
+  8001e0:	8d 4b 03             	lea    0x3(%ebx),%ecx
+  8001e3:	85 db                	test   %ebx,%ebx
+  8001e5:	0f 49 cb             	cmovns %ebx,%ecx
+  8001e8:	c1 f9 02             	sar    $0x2,%ecx
+    for (i = 0; i < PGSIZE / 4; i++)
+  8001eb:	b8 00 00 00 00       	mov    $0x0,%eax
+      ((uint32_t*) buf)[i] = off / 4 + i;
+  8001f0:	8d 14 01             	lea    (%ecx,%eax,1),%edx
+  8001f3:	89 14 85 40 7f 80 00 	mov    %edx,0x807f40(,%eax,4)
+    for (i = 0; i < PGSIZE / 4; i++)
+  8001fa:	83 c0 01             	add    $0x1,%eax
+  8001fd:	3d 00 04 00 00       	cmp    $0x400,%eax
+  800202:	75 ec                	jne    8001f0 <umain+0x62>
+    if ((r = write(fd, buf, PGSIZE)) != PGSIZE)
+  800204:	83 ec 04             	sub    $0x4,%esp
+  800207:	68 00 10 00 00       	push   $0x1000
+  80020c:	68 40 7f 80 00       	push   $0x807f40
+  800211:	57                   	push   %edi
+  800212:	e8 93 17 00 00       	call   8019aa <write>
+  800217:	83 c4 10             	add    $0x10,%esp
+  80021a:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80021f:	75 3f                	jne    800260 <umain+0xd2>
+  for (off = 0; off < size; off += PGSIZE) {
+  800221:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  800227:	eb af                	jmp    8001d8 <umain+0x4a>
+    size = strtol(argv[1], 0, 0) * 1024;
+  800229:	83 ec 04             	sub    $0x4,%esp
+  80022c:	6a 00                	push   $0x0
+  80022e:	6a 00                	push   $0x0
+  800230:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800233:	ff 70 04             	push   0x4(%eax)
+  800236:	e8 f2 0c 00 00       	call   800f2d <strtol>
+  80023b:	c1 e0 0a             	shl    $0xa,%eax
+  80023e:	83 c4 10             	add    $0x10,%esp
+  800241:	e9 66 ff ff ff       	jmp    8001ac <umain+0x1e>
+    panic("open %s: %e", BIGNAME, fd);
+  800246:	83 ec 0c             	sub    $0xc,%esp
+  800249:	50                   	push   %eax
+  80024a:	68 40 3a 80 00       	push   $0x803a40
+  80024f:	68 a6 3a 80 00       	push   $0x803aa6
+  800254:	6a 1a                	push   $0x1a
+  800256:	68 5b 3a 80 00       	push   $0x803a5b
+  80025b:	e8 b0 03 00 00       	call   800610 <_panic>
+      panic("write %s: %e", BIGNAME, r);
+  800260:	83 ec 0c             	sub    $0xc,%esp
+  800263:	50                   	push   %eax
+  800264:	68 40 3a 80 00       	push   $0x803a40
+  800269:	68 b2 3a 80 00       	push   $0x803ab2
+  80026e:	6a 1f                	push   $0x1f
+  800270:	68 5b 3a 80 00       	push   $0x803a5b
+  800275:	e8 96 03 00 00       	call   800610 <_panic>
+  close(fd);
+  80027a:	83 ec 0c             	sub    $0xc,%esp
+  80027d:	57                   	push   %edi
+  80027e:	e8 d1 14 00 00       	call   801754 <close>
+
+  mkfile(size);
+  seed = 1;
+  for (i = 0; i < NACCESS; i++) {
+    seed = seed * 1103515245 + 12345;
+    offsets[i] = ((seed >> 8) % (size / RECSIZE)) * RECSIZE;
+  800283:	8d 7e 3f             	lea    0x3f(%esi),%edi
+  800286:	83 c4 10             	add    $0x10,%esp
+  800289:	85 f6                	test   %esi,%esi
+  80028b:	0f 49 fe             	cmovns %esi,%edi
+  80028e:	c1 ff 06             	sar    $0x6,%edi
+  for (i = 0; i < NACCESS; i++) {
+  800291:	bb 00 00 00 00       	mov    $0x0,%ebx
+  seed = 1;
+  800296:	b9 01 00 00 00       	mov    $0x1,%ecx
+    seed = seed * 1103515245 + 12345;
+  80029b:	69 c9 6d 4e c6 41    	imul   $0x41c64e6d,%ecx,%ecx
+  8002a1:	81 c1 39 30 00 00    	add    $0x3039,%ecx
+    offsets[i] = ((seed >> 8) % (size / RECSIZE)) * RECSIZE;
+  8002a7:	89 c8                	mov    %ecx,%eax
+  8002a9:	c1 e8 08             	shr    $0x8,%eax
+  8002ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002b1:	f7 f7                	div    %edi
+  8002b3:	c1 e2 06             	shl    $0x6,%edx
+  8002b6:	89 14 9d 00 60 80 00 	mov    %edx,0x806000(,%ebx,4)
+  for (i = 0; i < NACCESS; i++) {
+  8002bd:	83 c3 01             	add    $0x1,%ebx
+  8002c0:	81 fb d0 07 00 00    	cmp    $0x7d0,%ebx
+  8002c6:	75 d3                	jne    80029b <umain+0x10d>
+  }
+
+  if ((fd = open(BIGNAME, O_RDWR)) < 0)
+  8002c8:	83 ec 08             	sub    $0x8,%esp
+  8002cb:	6a 02                	push   $0x2
+  8002cd:	68 40 3a 80 00       	push   $0x803a40
+  8002d2:	e8 30 1e 00 00       	call   802107 <open>
+  8002d7:	89 c3                	mov    %eax,%ebx
+  8002d9:	83 c4 10             	add    $0x10,%esp
+  8002dc:	85 c0                	test   %eax,%eax
+  8002de:	0f 88 d1 01 00 00    	js     8004b5 <umain+0x327>
+    panic("open %s: %e", BIGNAME, fd);
+  if ((r = mmap(fd, 0, size, MAP_RDONLY, (void **) &map)) < 0)
+  8002e4:	83 ec 0c             	sub    $0xc,%esp
+  8002e7:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8002ea:	50                   	push   %eax
+  8002eb:	6a 00                	push   $0x0
+  8002ed:	56                   	push   %esi
+  8002ee:	6a 00                	push   $0x0
+  8002f0:	53                   	push   %ebx
+  8002f1:	e8 f3 2d 00 00       	call   8030e9 <mmap>
+  8002f6:	83 c4 20             	add    $0x20,%esp
+  8002f9:	85 c0                	test   %eax,%eax
+  8002fb:	0f 88 ce 01 00 00    	js     8004cf <umain+0x341>
+    panic("mmap %s: %e", BIGNAME, r);
+
+  cprintf("mmapbench: %d KB, %d random %d-byte records\n", size / 1024,
+  800301:	6a 40                	push   $0x40
+  800303:	68 d0 07 00 00       	push   $0x7d0
+  800308:	8d 86 ff 03 00 00    	lea    0x3ff(%esi),%eax
+  80030e:	85 f6                	test   %esi,%esi
+  800310:	0f 49 c6             	cmovns %esi,%eax
+  800313:	c1 f8 0a             	sar    $0xa,%eax
+  800316:	50                   	push   %eax
+  800317:	68 f8 3a 80 00       	push   $0x803af8
+  80031c:	e8 ca 03 00 00       	call   8006eb <cprintf>
+          NACCESS, RECSIZE);
+  cold = byread(fd);
+  800321:	89 d8                	mov    %ebx,%eax
+  800323:	e8 0b fd ff ff       	call   800033 <byread>
+  800328:	89 c6                	mov    %eax,%esi
+  warm = byread(fd);
+  80032a:	89 d8                	mov    %ebx,%eax
+  80032c:	e8 02 fd ff ff       	call   800033 <byread>
+  cprintf("mmapbench: seek+read  %5d us/record, again %5d us/record\n",
+  800331:	83 c4 0c             	add    $0xc,%esp
+  800334:	50                   	push   %eax
+  800335:	56                   	push   %esi
+  800336:	68 28 3b 80 00       	push   $0x803b28
+  80033b:	e8 ab 03 00 00       	call   8006eb <cprintf>
+          cold, warm);
+  cold = bymap(map);
+  800340:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800343:	e8 b1 fd ff ff       	call   8000f9 <bymap>
+  800348:	89 c6                	mov    %eax,%esi
+  warm = bymap(map);
+  80034a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80034d:	e8 a7 fd ff ff       	call   8000f9 <bymap>
+  cprintf("mmapbench: mmap       %5d us/record, again %5d us/record\n",
+  800352:	83 c4 0c             	add    $0xc,%esp
+  800355:	50                   	push   %eax
+  800356:	56                   	push   %esi
+  800357:	68 64 3b 80 00       	push   $0x803b64
+  80035c:	e8 8a 03 00 00       	call   8006eb <cprintf>
+          cold, warm);
+
+  if ((r = munmap(map)) < 0)
+  800361:	83 c4 04             	add    $0x4,%esp
+  800364:	ff 75 e4             	push   -0x1c(%ebp)
+  800367:	e8 8c 30 00 00       	call   8033f8 <munmap>
+  80036c:	83 c4 10             	add    $0x10,%esp
+  80036f:	85 c0                	test   %eax,%eax
+  800371:	0f 88 72 01 00 00    	js     8004e9 <umain+0x35b>
+  if ((r = mmap(fd, 0, PGSIZE, MAP_SHARED, (void **) &shared)) < 0 ||
+  800377:	83 ec 0c             	sub    $0xc,%esp
+  80037a:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  80037d:	50                   	push   %eax
+  80037e:	6a 02                	push   $0x2
+  800380:	68 00 10 00 00       	push   $0x1000
+  800385:	6a 00                	push   $0x0
+  800387:	53                   	push   %ebx
+  800388:	e8 5c 2d 00 00       	call   8030e9 <mmap>
+  80038d:	83 c4 20             	add    $0x20,%esp
+  800390:	85 c0                	test   %eax,%eax
+  800392:	0f 88 6e 01 00 00    	js     800506 <umain+0x378>
+      (r = mmap(fd, PGSIZE, PGSIZE, MAP_PRIVATE, (void **) &private)) < 0)
+  800398:	83 ec 0c             	sub    $0xc,%esp
+  80039b:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  80039e:	50                   	push   %eax
+  80039f:	6a 01                	push   $0x1
+  8003a1:	68 00 10 00 00       	push   $0x1000
+  8003a6:	68 00 10 00 00       	push   $0x1000
+  8003ab:	53                   	push   %ebx
+  8003ac:	e8 38 2d 00 00       	call   8030e9 <mmap>
+  if ((r = mmap(fd, 0, PGSIZE, MAP_SHARED, (void **) &shared)) < 0 ||
+  8003b1:	83 c4 20             	add    $0x20,%esp
+  8003b4:	85 c0                	test   %eax,%eax
+  8003b6:	0f 88 4a 01 00 00    	js     800506 <umain+0x378>
+  shared[1] = 0xdeadbeef;
+  8003bc:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8003bf:	c7 40 04 ef be ad de 	movl   $0xdeadbeef,0x4(%eax)
+  private[1] = 0xfeedface;
+  8003c6:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  8003c9:	c7 42 04 ce fa ed fe 	movl   $0xfeedface,0x4(%edx)
+  if ((r = munmap(shared)) < 0 || (r = munmap(private)) < 0)
+  8003d0:	83 ec 0c             	sub    $0xc,%esp
+  8003d3:	50                   	push   %eax
+  8003d4:	e8 1f 30 00 00       	call   8033f8 <munmap>
+  8003d9:	83 c4 10             	add    $0x10,%esp
+  8003dc:	85 c0                	test   %eax,%eax
+  8003de:	0f 88 3c 01 00 00    	js     800520 <umain+0x392>
+  8003e4:	83 ec 0c             	sub    $0xc,%esp
+  8003e7:	ff 75 dc             	push   -0x24(%ebp)
+  8003ea:	e8 09 30 00 00       	call   8033f8 <munmap>
+  8003ef:	83 c4 10             	add    $0x10,%esp
+  8003f2:	85 c0                	test   %eax,%eax
+  8003f4:	0f 88 26 01 00 00    	js     800520 <umain+0x392>
+  if ((r = seek(fd, 4)) < 0 || (r = readn(fd, &word, 4)) != 4)
+  8003fa:	83 ec 08             	sub    $0x8,%esp
+  8003fd:	6a 04                	push   $0x4
+  8003ff:	53                   	push   %ebx
+  800400:	e8 27 16 00 00       	call   801a2c <seek>
+  800405:	83 c4 10             	add    $0x10,%esp
+  800408:	85 c0                	test   %eax,%eax
+  80040a:	0f 88 2a 01 00 00    	js     80053a <umain+0x3ac>
+  800410:	83 ec 04             	sub    $0x4,%esp
+  800413:	6a 04                	push   $0x4
+  800415:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800418:	50                   	push   %eax
+  800419:	53                   	push   %ebx
+  80041a:	e8 44 15 00 00       	call   801963 <readn>
+  80041f:	83 c4 10             	add    $0x10,%esp
+  800422:	83 f8 04             	cmp    $0x4,%eax
+  800425:	0f 85 0f 01 00 00    	jne    80053a <umain+0x3ac>
+  if (word != 0xdeadbeef)
+  80042b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80042e:	3d ef be ad de       	cmp    $0xdeadbeef,%eax
+  800433:	0f 85 1b 01 00 00    	jne    800554 <umain+0x3c6>
+  if ((r = seek(fd, PGSIZE + 4)) < 0 || (r = readn(fd, &word, 4)) != 4)
+  800439:	83 ec 08             	sub    $0x8,%esp
+  80043c:	68 04 10 00 00       	push   $0x1004
+  800441:	53                   	push   %ebx
+  800442:	e8 e5 15 00 00       	call   801a2c <seek>
+  800447:	83 c4 10             	add    $0x10,%esp
+  80044a:	85 c0                	test   %eax,%eax
+  80044c:	0f 88 14 01 00 00    	js     800566 <umain+0x3d8>
+  800452:	83 ec 04             	sub    $0x4,%esp
+  800455:	6a 04                	push   $0x4
+  800457:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80045a:	50                   	push   %eax
+  80045b:	53                   	push   %ebx
+  80045c:	e8 02 15 00 00       	call   801963 <readn>
+  800461:	83 c4 10             	add    $0x10,%esp
+  800464:	83 f8 04             	cmp    $0x4,%eax
+  800467:	0f 85 f9 00 00 00    	jne    800566 <umain+0x3d8>
+  if (word != PGSIZE / 4 + 1)
+  80046d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800470:	3d 01 04 00 00       	cmp    $0x401,%eax
+  800475:	0f 85 05 01 00 00    	jne    800580 <umain+0x3f2>
+    panic("munmap %s: %e", BIGNAME, r);
+  checkwrite(fd);
+  cprintf("mmapbench: MAP_SHARED and MAP_PRIVATE writes OK\n");
+  80047b:	83 ec 0c             	sub    $0xc,%esp
+  80047e:	68 cc 3b 80 00       	push   $0x803bcc
+  800483:	e8 63 02 00 00       	call   8006eb <cprintf>
+  close(fd);
+  800488:	89 1c 24             	mov    %ebx,(%esp)
+  80048b:	e8 c4 12 00 00       	call   801754 <close>
+
+  // Give the space back (there is no remove).
+  if ((fd = open(BIGNAME, O_RDWR | O_TRUNC)) >= 0)
+  800490:	83 c4 08             	add    $0x8,%esp
+  800493:	68 02 02 00 00       	push   $0x202
+  800498:	68 40 3a 80 00       	push   $0x803a40
+  80049d:	e8 65 1c 00 00       	call   802107 <open>
+  8004a2:	83 c4 10             	add    $0x10,%esp
+  8004a5:	85 c0                	test   %eax,%eax
+  8004a7:	0f 89 e5 00 00 00    	jns    800592 <umain+0x404>
+    close(fd);
+}
+  8004ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004b0:	5b                   	pop    %ebx
+  8004b1:	5e                   	pop    %esi
+  8004b2:	5f                   	pop    %edi
+  8004b3:	5d                   	pop    %ebp
+  8004b4:	c3                   	ret
+    panic("open %s: %e", BIGNAME, fd);
+  8004b5:	83 ec 0c             	sub    $0xc,%esp
+  8004b8:	50                   	push   %eax
+  8004b9:	68 40 3a 80 00       	push   $0x803a40
+  8004be:	68 a6 3a 80 00       	push   $0x803aa6
+  8004c3:	6a 75                	push   $0x75
+  8004c5:	68 5b 3a 80 00       	push   $0x803a5b
+  8004ca:	e8 41 01 00 00       	call   800610 <_panic>
+    panic("mmap %s: %e", BIGNAME, r);
+  8004cf:	83 ec 0c             	sub    $0xc,%esp
+  8004d2:	50                   	push   %eax
+  8004d3:	68 40 3a 80 00       	push   $0x803a40
+  8004d8:	68 bf 3a 80 00       	push   $0x803abf
+  8004dd:	6a 77                	push   $0x77
+  8004df:	68 5b 3a 80 00       	push   $0x803a5b
+  8004e4:	e8 27 01 00 00       	call   800610 <_panic>
+    panic("munmap %s: %e", BIGNAME, r);
+  8004e9:	83 ec 0c             	sub    $0xc,%esp
+  8004ec:	50                   	push   %eax
+  8004ed:	68 40 3a 80 00       	push   $0x803a40
+  8004f2:	68 cb 3a 80 00       	push   $0x803acb
+  8004f7:	68 85 00 00 00       	push   $0x85
+  8004fc:	68 5b 3a 80 00       	push   $0x803a5b
+  800501:	e8 0a 01 00 00       	call   800610 <_panic>
+    panic("mmap %s: %e", BIGNAME, r);
+  800506:	83 ec 0c             	sub    $0xc,%esp
+  800509:	50                   	push   %eax
+  80050a:	68 40 3a 80 00       	push   $0x803a40
+  80050f:	68 bf 3a 80 00       	push   $0x803abf
+  800514:	6a 4e                	push   $0x4e
+  800516:	68 5b 3a 80 00       	push   $0x803a5b
+  80051b:	e8 f0 00 00 00       	call   800610 <_panic>
+    panic("munmap %s: %e", BIGNAME, r);
+  800520:	83 ec 0c             	sub    $0xc,%esp
+  800523:	50                   	push   %eax
+  800524:	68 40 3a 80 00       	push   $0x803a40
+  800529:	68 cb 3a 80 00       	push   $0x803acb
+  80052e:	6a 52                	push   $0x52
+  800530:	68 5b 3a 80 00       	push   $0x803a5b
+  800535:	e8 d6 00 00 00       	call   800610 <_panic>
+    panic("read %s: %e", BIGNAME, r);
+  80053a:	83 ec 0c             	sub    $0xc,%esp
+  80053d:	50                   	push   %eax
+  80053e:	68 40 3a 80 00       	push   $0x803a40
+  800543:	68 4f 3a 80 00       	push   $0x803a4f
+  800548:	6a 55                	push   $0x55
+  80054a:	68 5b 3a 80 00       	push   $0x803a5b
+  80054f:	e8 bc 00 00 00       	call   800610 <_panic>
+    panic("MAP_SHARED write lost: %08x", word);
+  800554:	50                   	push   %eax
+  800555:	68 d9 3a 80 00       	push   $0x803ad9
+  80055a:	6a 57                	push   $0x57
+  80055c:	68 5b 3a 80 00       	push   $0x803a5b
+  800561:	e8 aa 00 00 00       	call   800610 <_panic>
+    panic("read %s: %e", BIGNAME, r);
+  800566:	83 ec 0c             	sub    $0xc,%esp
+  800569:	50                   	push   %eax
+  80056a:	68 40 3a 80 00       	push   $0x803a40
+  80056f:	68 4f 3a 80 00       	push   $0x803a4f
+  800574:	6a 59                	push   $0x59
+  800576:	68 5b 3a 80 00       	push   $0x803a5b
+  80057b:	e8 90 00 00 00       	call   800610 <_panic>
+    panic("MAP_PRIVATE write reached the file: %08x", word);
+  800580:	50                   	push   %eax
+  800581:	68 a0 3b 80 00       	push   $0x803ba0
+  800586:	6a 5b                	push   $0x5b
+  800588:	68 5b 3a 80 00       	push   $0x803a5b
+  80058d:	e8 7e 00 00 00       	call   800610 <_panic>
+    close(fd);
+  800592:	83 ec 0c             	sub    $0xc,%esp
+  800595:	50                   	push   %eax
+  800596:	e8 b9 11 00 00       	call   801754 <close>
+  80059b:	83 c4 10             	add    $0x10,%esp
+}
+  80059e:	e9 0a ff ff ff       	jmp    8004ad <umain+0x31f>
+
+008005a3 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8005a3:	55                   	push   %ebp
+  8005a4:	89 e5                	mov    %esp,%ebp
+  8005a6:	56                   	push   %esi
+  8005a7:	53                   	push   %ebx
+  8005a8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8005ab:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  8005ae:	c7 05 e0 97 80 00 00 	movl   $0x0,0x8097e0
+  8005b5:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  8005b8:	e8 ca 0a 00 00       	call   801087 <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  8005bd:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8005c2:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8005c5:	c1 e0 04             	shl    $0x4,%eax
+  8005c8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8005cd:	a3 e0 97 80 00       	mov    %eax,0x8097e0
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8005d2:	85 db                	test   %ebx,%ebx
+  8005d4:	7e 07                	jle    8005dd <libmain+0x3a>
+    binaryname = argv[0];
+  8005d6:	8b 06                	mov    (%esi),%eax
+  8005d8:	a3 00 50 80 00       	mov    %eax,0x805000
+
+  // call user main routine
+  umain(argc, argv);
+  8005dd:	83 ec 08             	sub    $0x8,%esp
+  8005e0:	56                   	push   %esi
+  8005e1:	53                   	push   %ebx
+  8005e2:	e8 a7 fb ff ff       	call   80018e <umain>
+
+  // exit gracefully
+  exit();
+  8005e7:	e8 0a 00 00 00       	call   8005f6 <exit>
+}
+  8005ec:	83 c4 10             	add    $0x10,%esp
+  8005ef:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8005f2:	5b                   	pop    %ebx
+  8005f3:	5e                   	pop    %esi
+  8005f4:	5d                   	pop    %ebp
+  8005f5:	c3                   	ret
+
+008005f6 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8005f6:	55                   	push   %ebp
+  8005f7:	89 e5                	mov    %esp,%ebp
+  8005f9:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  8005fc:	e8 80 11 00 00       	call   801781 <close_all>
+  sys_env_destroy(0);
+  800601:	83 ec 0c             	sub    $0xc,%esp
+  800604:	6a 00                	push   $0x0
+  800606:	e8 3b 0a 00 00       	call   801046 <sys_env_destroy>
+}
+  80060b:	83 c4 10             	add    $0x10,%esp
+  80060e:	c9                   	leave
+  80060f:	c3                   	ret
+
+00800610 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800610:	55                   	push   %ebp
+  800611:	89 e5                	mov    %esp,%ebp
+  800613:	56                   	push   %esi
+  800614:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  800615:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  800618:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  80061e:	e8 64 0a 00 00       	call   801087 <sys_getenvid>
+  800623:	83 ec 0c             	sub    $0xc,%esp
+  800626:	ff 75 0c             	push   0xc(%ebp)
+  800629:	ff 75 08             	push   0x8(%ebp)
+  80062c:	56                   	push   %esi
+  80062d:	50                   	push   %eax
+  80062e:	68 08 3c 80 00       	push   $0x803c08
+  800633:	e8 b3 00 00 00       	call   8006eb <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  800638:	83 c4 18             	add    $0x18,%esp
+  80063b:	53                   	push   %ebx
+  80063c:	ff 75 10             	push   0x10(%ebp)
+  80063f:	e8 56 00 00 00       	call   80069a <vcprintf>
+  cprintf("\n");
+  800644:	c7 04 24 80 40 80 00 	movl   $0x804080,(%esp)
+  80064b:	e8 9b 00 00 00       	call   8006eb <cprintf>
+  800650:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  800653:	cc                   	int3
+  while (1)
+  800654:	eb fd                	jmp    800653 <_panic+0x43>
+
+00800656 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800656:	55                   	push   %ebp
+  800657:	89 e5                	mov    %esp,%ebp
+  800659:	53                   	push   %ebx
+  80065a:	83 ec 04             	sub    $0x4,%esp
+  80065d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  800660:	8b 13                	mov    (%ebx),%edx
+  800662:	8d 42 01             	lea    0x1(%edx),%eax
+  800665:	89 03                	mov    %eax,(%ebx)
+  800667:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80066a:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  80066e:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800673:	74 09                	je     80067e <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  800675:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800679:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80067c:	c9                   	leave
+  80067d:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  80067e:	83 ec 08             	sub    $0x8,%esp
+  800681:	68 ff 00 00 00       	push   $0xff
+  800686:	8d 43 08             	lea    0x8(%ebx),%eax
+  800689:	50                   	push   %eax
+  80068a:	e8 7a 09 00 00       	call   801009 <sys_cputs>
+    b->idx = 0;
+  80068f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800695:	83 c4 10             	add    $0x10,%esp
+  800698:	eb db                	jmp    800675 <putch+0x1f>
+
+0080069a <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80069a:	55                   	push   %ebp
+  80069b:	89 e5                	mov    %esp,%ebp
+  80069d:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  8006a3:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8006aa:	00 00 00 
+  b.cnt = 0;
+  8006ad:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8006b4:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  8006b7:	ff 75 0c             	push   0xc(%ebp)
+  8006ba:	ff 75 08             	push   0x8(%ebp)
+  8006bd:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8006c3:	50                   	push   %eax
+  8006c4:	68 56 06 80 00       	push   $0x800656
+  8006c9:	e8 14 01 00 00       	call   8007e2 <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  8006ce:	83 c4 08             	add    $0x8,%esp
+  8006d1:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8006d7:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8006dd:	50                   	push   %eax
+  8006de:	e8 26 09 00 00       	call   801009 <sys_cputs>
+
+  return b.cnt;
+}
+  8006e3:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8006e9:	c9                   	leave
+  8006ea:	c3                   	ret
+
+008006eb <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8006eb:	55                   	push   %ebp
+  8006ec:	89 e5                	mov    %esp,%ebp
+  8006ee:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  8006f1:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  8006f4:	50                   	push   %eax
+  8006f5:	ff 75 08             	push   0x8(%ebp)
+  8006f8:	e8 9d ff ff ff       	call   80069a <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  8006fd:	c9                   	leave
+  8006fe:	c3                   	ret
+
+008006ff <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  8006ff:	55                   	push   %ebp
+  800700:	89 e5                	mov    %esp,%ebp
+  800702:	57                   	push   %edi
+  800703:	56                   	push   %esi
+  800704:	53                   	push   %ebx
+  800705:	83 ec 1c             	sub    $0x1c,%esp
+  800708:	89 c7                	mov    %eax,%edi
+  80070a:	89 d6                	mov    %edx,%esi
+  80070c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80070f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800712:	89 d1                	mov    %edx,%ecx
+  800714:	89 c2                	mov    %eax,%edx
+  800716:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800719:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80071c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80071f:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  800722:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800725:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80072c:	39 c2                	cmp    %eax,%edx
+  80072e:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800731:	72 3e                	jb     800771 <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  800733:	83 ec 0c             	sub    $0xc,%esp
+  800736:	ff 75 18             	push   0x18(%ebp)
+  800739:	83 eb 01             	sub    $0x1,%ebx
+  80073c:	53                   	push   %ebx
+  80073d:	50                   	push   %eax
+  80073e:	83 ec 08             	sub    $0x8,%esp
+  800741:	ff 75 e4             	push   -0x1c(%ebp)
+  800744:	ff 75 e0             	push   -0x20(%ebp)
+  800747:	ff 75 dc             	push   -0x24(%ebp)
+  80074a:	ff 75 d8             	push   -0x28(%ebp)
+  80074d:	e8 5c 31 00 00       	call   8038ae <__udivdi3>
+  800752:	83 c4 18             	add    $0x18,%esp
+  800755:	52                   	push   %edx
+  800756:	50                   	push   %eax
+  800757:	89 f2                	mov    %esi,%edx
+  800759:	89 f8                	mov    %edi,%eax
+  80075b:	e8 9f ff ff ff       	call   8006ff <printnum>
+  800760:	83 c4 20             	add    $0x20,%esp
+  800763:	eb 13                	jmp    800778 <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  800765:	83 ec 08             	sub    $0x8,%esp
+  800768:	56                   	push   %esi
+  800769:	ff 75 18             	push   0x18(%ebp)
+  80076c:	ff d7                	call   *%edi
+  80076e:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  800771:	83 eb 01             	sub    $0x1,%ebx
+  800774:	85 db                	test   %ebx,%ebx
+  800776:	7f ed                	jg     800765 <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  800778:	83 ec 08             	sub    $0x8,%esp
+  80077b:	56                   	push   %esi
+  80077c:	83 ec 04             	sub    $0x4,%esp
+  80077f:	ff 75 e4             	push   -0x1c(%ebp)
+  800782:	ff 75 e0             	push   -0x20(%ebp)
+  800785:	ff 75 dc             	push   -0x24(%ebp)
+  800788:	ff 75 d8             	push   -0x28(%ebp)
+  80078b:	e8 3f 31 00 00       	call   8038cf <__umoddi3>
+  800790:	83 c4 14             	add    $0x14,%esp
+  800793:	0f be 80 2b 3c 80 00 	movsbl 0x803c2b(%eax),%eax
+  80079a:	50                   	push   %eax
+  80079b:	ff d7                	call   *%edi
+}
+  80079d:	83 c4 10             	add    $0x10,%esp
+  8007a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007a3:	5b                   	pop    %ebx
+  8007a4:	5e                   	pop    %esi
+  8007a5:	5f                   	pop    %edi
+  8007a6:	5d                   	pop    %ebp
+  8007a7:	c3                   	ret
+
+008007a8 <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8007a8:	55                   	push   %ebp
+  8007a9:	89 e5                	mov    %esp,%ebp
+  8007ab:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  8007ae:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  8007b2:	8b 10                	mov    (%eax),%edx
+  8007b4:	3b 50 04             	cmp    0x4(%eax),%edx
+  8007b7:	73 0a                	jae    8007c3 <sprintputch+0x1b>
+    *b->buf++ = ch;
+  8007b9:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8007bc:	89 08                	mov    %ecx,(%eax)
+  8007be:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007c1:	88 02                	mov    %al,(%edx)
+}
+  8007c3:	5d                   	pop    %ebp
+  8007c4:	c3                   	ret
+
+008007c5 <printfmt>:
+{
+  8007c5:	55                   	push   %ebp
+  8007c6:	89 e5                	mov    %esp,%ebp
+  8007c8:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  8007cb:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  8007ce:	50                   	push   %eax
+  8007cf:	ff 75 10             	push   0x10(%ebp)
+  8007d2:	ff 75 0c             	push   0xc(%ebp)
+  8007d5:	ff 75 08             	push   0x8(%ebp)
+  8007d8:	e8 05 00 00 00       	call   8007e2 <vprintfmt>
+}
+  8007dd:	83 c4 10             	add    $0x10,%esp
+  8007e0:	c9                   	leave
+  8007e1:	c3                   	ret
+
+008007e2 <vprintfmt>:
+{
+  8007e2:	55                   	push   %ebp
+  8007e3:	89 e5                	mov    %esp,%ebp
+  8007e5:	57                   	push   %edi
+  8007e6:	56                   	push   %esi
+  8007e7:	53                   	push   %ebx
+  8007e8:	83 ec 2c             	sub    $0x2c,%esp
+  8007eb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007ee:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8007f1:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8007f4:	eb 0a                	jmp    800800 <vprintfmt+0x1e>
+      putch(ch, putdat);
+  8007f6:	83 ec 08             	sub    $0x8,%esp
+  8007f9:	53                   	push   %ebx
+  8007fa:	50                   	push   %eax
+  8007fb:	ff d6                	call   *%esi
+  8007fd:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  800800:	83 c7 01             	add    $0x1,%edi
+  800803:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800807:	83 f8 25             	cmp    $0x25,%eax
+  80080a:	74 0c                	je     800818 <vprintfmt+0x36>
+      if (ch == '\0')
+  80080c:	85 c0                	test   %eax,%eax
+  80080e:	75 e6                	jne    8007f6 <vprintfmt+0x14>
+}
+  800810:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800813:	5b                   	pop    %ebx
+  800814:	5e                   	pop    %esi
+  800815:	5f                   	pop    %edi
+  800816:	5d                   	pop    %ebp
+  800817:	c3                   	ret
+    padc = ' ';
+  800818:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  80081c:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  800823:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  80082a:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  800831:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  800836:	8d 47 01             	lea    0x1(%edi),%eax
+  800839:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80083c:	0f b6 17             	movzbl (%edi),%edx
+  80083f:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800842:	3c 55                	cmp    $0x55,%al
+  800844:	0f 87 cf 03 00 00    	ja     800c19 <vprintfmt+0x437>
+  80084a:	0f b6 c0             	movzbl %al,%eax
+  80084d:	ff 24 85 80 3d 80 00 	jmp    *0x803d80(,%eax,4)
+  800854:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  800857:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80085b:	eb d9                	jmp    800836 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  80085d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800860:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800864:	eb d0                	jmp    800836 <vprintfmt+0x54>
+  800866:	0f b6 d2             	movzbl %dl,%edx
+  800869:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  80086c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800871:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  800874:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800877:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  80087b:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  80087e:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800881:	83 f9 09             	cmp    $0x9,%ecx
+  800884:	77 55                	ja     8008db <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  800886:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  800889:	eb e9                	jmp    800874 <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  80088b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80088e:	8b 00                	mov    (%eax),%eax
+  800890:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800893:	8b 45 14             	mov    0x14(%ebp),%eax
+  800896:	8d 40 04             	lea    0x4(%eax),%eax
+  800899:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  80089c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  80089f:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8008a3:	79 91                	jns    800836 <vprintfmt+0x54>
+        width = precision, precision = -1;
+  8008a5:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8008a8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8008ab:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8008b2:	eb 82                	jmp    800836 <vprintfmt+0x54>
+      if (width < 0)
+  8008b4:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8008b7:	85 d2                	test   %edx,%edx
+  8008b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008be:	0f 49 c2             	cmovns %edx,%eax
+  8008c1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  8008c4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  8008c7:	e9 6a ff ff ff       	jmp    800836 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  8008cc:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  8008cf:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  8008d6:	e9 5b ff ff ff       	jmp    800836 <vprintfmt+0x54>
+  8008db:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8008de:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8008e1:	eb bc                	jmp    80089f <vprintfmt+0xbd>
+      lflag++;
+  8008e3:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  8008e6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  8008e9:	e9 48 ff ff ff       	jmp    800836 <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  8008ee:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008f1:	8d 78 04             	lea    0x4(%eax),%edi
+  8008f4:	83 ec 08             	sub    $0x8,%esp
+  8008f7:	53                   	push   %ebx
+  8008f8:	ff 30                	push   (%eax)
+  8008fa:	ff d6                	call   *%esi
+      break;
+  8008fc:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  8008ff:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  800902:	e9 b1 02 00 00       	jmp    800bb8 <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  800907:	8b 45 14             	mov    0x14(%ebp),%eax
+  80090a:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  80090d:	8b 10                	mov    (%eax),%edx
+  80090f:	89 d0                	mov    %edx,%eax
+  800911:	f7 d8                	neg    %eax
+  800913:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800916:	83 f8 10             	cmp    $0x10,%eax
+  800919:	7f 23                	jg     80093e <vprintfmt+0x15c>
+  80091b:	8b 14 85 e0 3e 80 00 	mov    0x803ee0(,%eax,4),%edx
+  800922:	85 d2                	test   %edx,%edx
+  800924:	74 18                	je     80093e <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  800926:	52                   	push   %edx
+  800927:	68 2a 40 80 00       	push   $0x80402a
+  80092c:	53                   	push   %ebx
+  80092d:	56                   	push   %esi
+  80092e:	e8 92 fe ff ff       	call   8007c5 <printfmt>
+  800933:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  800936:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800939:	e9 7a 02 00 00       	jmp    800bb8 <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  80093e:	50                   	push   %eax
+  80093f:	68 43 3c 80 00       	push   $0x803c43
+  800944:	53                   	push   %ebx
+  800945:	56                   	push   %esi
+  800946:	e8 7a fe ff ff       	call   8007c5 <printfmt>
+  80094b:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  80094e:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  800951:	e9 62 02 00 00       	jmp    800bb8 <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  800956:	8b 45 14             	mov    0x14(%ebp),%eax
+  800959:	83 c0 04             	add    $0x4,%eax
+  80095c:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80095f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800962:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  800964:	85 c9                	test   %ecx,%ecx
+  800966:	b8 3c 3c 80 00       	mov    $0x803c3c,%eax
+  80096b:	0f 45 c1             	cmovne %ecx,%eax
+  80096e:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  800971:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800975:	7e 06                	jle    80097d <vprintfmt+0x19b>
+  800977:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80097b:	75 0b                	jne    800988 <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  80097d:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800980:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800983:	89 75 08             	mov    %esi,0x8(%ebp)
+  800986:	eb 5c                	jmp    8009e4 <vprintfmt+0x202>
+  800988:	83 ec 08             	sub    $0x8,%esp
+  80098b:	ff 75 d0             	push   -0x30(%ebp)
+  80098e:	ff 75 cc             	push   -0x34(%ebp)
+  800991:	e8 20 03 00 00       	call   800cb6 <strnlen>
+  800996:	89 c2                	mov    %eax,%edx
+  800998:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80099b:	29 d0                	sub    %edx,%eax
+  80099d:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  8009a0:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8009a4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8009a7:	89 75 08             	mov    %esi,0x8(%ebp)
+  8009aa:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8009ac:	eb 0e                	jmp    8009bc <vprintfmt+0x1da>
+          putch(padc, putdat);
+  8009ae:	83 ec 08             	sub    $0x8,%esp
+  8009b1:	53                   	push   %ebx
+  8009b2:	57                   	push   %edi
+  8009b3:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8009b6:	83 ee 01             	sub    $0x1,%esi
+  8009b9:	83 c4 10             	add    $0x10,%esp
+  8009bc:	85 f6                	test   %esi,%esi
+  8009be:	7f ee                	jg     8009ae <vprintfmt+0x1cc>
+  8009c0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8009c3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009c6:	85 c0                	test   %eax,%eax
+  8009c8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009cd:	0f 49 d0             	cmovns %eax,%edx
+  8009d0:	29 d0                	sub    %edx,%eax
+  8009d2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8009d5:	eb a6                	jmp    80097d <vprintfmt+0x19b>
+          putch(ch, putdat);
+  8009d7:	83 ec 08             	sub    $0x8,%esp
+  8009da:	53                   	push   %ebx
+  8009db:	52                   	push   %edx
+  8009dc:	ff 55 08             	call   *0x8(%ebp)
+  8009df:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8009e2:	89 f1                	mov    %esi,%ecx
+  8009e4:	8d 71 01             	lea    0x1(%ecx),%esi
+  8009e7:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8009eb:	0f be d0             	movsbl %al,%edx
+  8009ee:	85 d2                	test   %edx,%edx
+  8009f0:	74 28                	je     800a1a <vprintfmt+0x238>
+  8009f2:	85 ff                	test   %edi,%edi
+  8009f4:	78 05                	js     8009fb <vprintfmt+0x219>
+  8009f6:	83 ef 01             	sub    $0x1,%edi
+  8009f9:	78 30                	js     800a2b <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  8009fb:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8009ff:	74 d6                	je     8009d7 <vprintfmt+0x1f5>
+  800a01:	0f be c0             	movsbl %al,%eax
+  800a04:	83 e8 20             	sub    $0x20,%eax
+  800a07:	83 f8 5e             	cmp    $0x5e,%eax
+  800a0a:	76 cb                	jbe    8009d7 <vprintfmt+0x1f5>
+          putch('?', putdat);
+  800a0c:	83 ec 08             	sub    $0x8,%esp
+  800a0f:	53                   	push   %ebx
+  800a10:	6a 3f                	push   $0x3f
+  800a12:	ff 55 08             	call   *0x8(%ebp)
+  800a15:	83 c4 10             	add    $0x10,%esp
+  800a18:	eb c8                	jmp    8009e2 <vprintfmt+0x200>
+  800a1a:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a1d:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800a20:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800a23:	01 d0                	add    %edx,%eax
+  800a25:	29 c8                	sub    %ecx,%eax
+  800a27:	89 c7                	mov    %eax,%edi
+  800a29:	eb 13                	jmp    800a3e <vprintfmt+0x25c>
+  800a2b:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a2e:	eb ed                	jmp    800a1d <vprintfmt+0x23b>
+        putch(' ', putdat);
+  800a30:	83 ec 08             	sub    $0x8,%esp
+  800a33:	53                   	push   %ebx
+  800a34:	6a 20                	push   $0x20
+  800a36:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  800a38:	83 ef 01             	sub    $0x1,%edi
+  800a3b:	83 c4 10             	add    $0x10,%esp
+  800a3e:	85 ff                	test   %edi,%edi
+  800a40:	7f ee                	jg     800a30 <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  800a42:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800a45:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a48:	e9 6b 01 00 00       	jmp    800bb8 <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  800a4d:	83 f9 01             	cmp    $0x1,%ecx
+  800a50:	7f 1f                	jg     800a71 <vprintfmt+0x28f>
+  else if (lflag)
+  800a52:	85 c9                	test   %ecx,%ecx
+  800a54:	74 67                	je     800abd <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  800a56:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a59:	8b 00                	mov    (%eax),%eax
+  800a5b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800a5e:	89 c1                	mov    %eax,%ecx
+  800a60:	c1 f9 1f             	sar    $0x1f,%ecx
+  800a63:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800a66:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a69:	8d 40 04             	lea    0x4(%eax),%eax
+  800a6c:	89 45 14             	mov    %eax,0x14(%ebp)
+  800a6f:	eb 17                	jmp    800a88 <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  800a71:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a74:	8b 50 04             	mov    0x4(%eax),%edx
+  800a77:	8b 00                	mov    (%eax),%eax
+  800a79:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800a7c:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800a7f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a82:	8d 40 08             	lea    0x8(%eax),%eax
+  800a85:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  800a88:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800a8b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  800a8e:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  800a93:	85 c9                	test   %ecx,%ecx
+  800a95:	0f 89 03 01 00 00    	jns    800b9e <vprintfmt+0x3bc>
+        putch('-', putdat);
+  800a9b:	83 ec 08             	sub    $0x8,%esp
+  800a9e:	53                   	push   %ebx
+  800a9f:	6a 2d                	push   $0x2d
+  800aa1:	ff d6                	call   *%esi
+        num = -(long long)num;
+  800aa3:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800aa6:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800aa9:	f7 da                	neg    %edx
+  800aab:	83 d1 00             	adc    $0x0,%ecx
+  800aae:	f7 d9                	neg    %ecx
+  800ab0:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  800ab3:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800ab8:	e9 e1 00 00 00       	jmp    800b9e <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  800abd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ac0:	8b 00                	mov    (%eax),%eax
+  800ac2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800ac5:	89 c1                	mov    %eax,%ecx
+  800ac7:	c1 f9 1f             	sar    $0x1f,%ecx
+  800aca:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800acd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ad0:	8d 40 04             	lea    0x4(%eax),%eax
+  800ad3:	89 45 14             	mov    %eax,0x14(%ebp)
+  800ad6:	eb b0                	jmp    800a88 <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  800ad8:	83 f9 01             	cmp    $0x1,%ecx
+  800adb:	7f 1e                	jg     800afb <vprintfmt+0x319>
+  else if (lflag)
+  800add:	85 c9                	test   %ecx,%ecx
+  800adf:	74 32                	je     800b13 <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  800ae1:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ae4:	8b 10                	mov    (%eax),%edx
+  800ae6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800aeb:	8d 40 04             	lea    0x4(%eax),%eax
+  800aee:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800af1:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  800af6:	e9 a3 00 00 00       	jmp    800b9e <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800afb:	8b 45 14             	mov    0x14(%ebp),%eax
+  800afe:	8b 10                	mov    (%eax),%edx
+  800b00:	8b 48 04             	mov    0x4(%eax),%ecx
+  800b03:	8d 40 08             	lea    0x8(%eax),%eax
+  800b06:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800b09:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  800b0e:	e9 8b 00 00 00       	jmp    800b9e <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800b13:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b16:	8b 10                	mov    (%eax),%edx
+  800b18:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b1d:	8d 40 04             	lea    0x4(%eax),%eax
+  800b20:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800b23:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  800b28:	eb 74                	jmp    800b9e <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  800b2a:	83 f9 01             	cmp    $0x1,%ecx
+  800b2d:	7f 1b                	jg     800b4a <vprintfmt+0x368>
+  else if (lflag)
+  800b2f:	85 c9                	test   %ecx,%ecx
+  800b31:	74 2c                	je     800b5f <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  800b33:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b36:	8b 10                	mov    (%eax),%edx
+  800b38:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b3d:	8d 40 04             	lea    0x4(%eax),%eax
+  800b40:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800b43:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  800b48:	eb 54                	jmp    800b9e <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800b4a:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b4d:	8b 10                	mov    (%eax),%edx
+  800b4f:	8b 48 04             	mov    0x4(%eax),%ecx
+  800b52:	8d 40 08             	lea    0x8(%eax),%eax
+  800b55:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800b58:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  800b5d:	eb 3f                	jmp    800b9e <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800b5f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b62:	8b 10                	mov    (%eax),%edx
+  800b64:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b69:	8d 40 04             	lea    0x4(%eax),%eax
+  800b6c:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800b6f:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  800b74:	eb 28                	jmp    800b9e <vprintfmt+0x3bc>
+      putch('0', putdat);
+  800b76:	83 ec 08             	sub    $0x8,%esp
+  800b79:	53                   	push   %ebx
+  800b7a:	6a 30                	push   $0x30
+  800b7c:	ff d6                	call   *%esi
+      putch('x', putdat);
+  800b7e:	83 c4 08             	add    $0x8,%esp
+  800b81:	53                   	push   %ebx
+  800b82:	6a 78                	push   $0x78
+  800b84:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  800b86:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b89:	8b 10                	mov    (%eax),%edx
+  800b8b:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  800b90:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  800b93:	8d 40 04             	lea    0x4(%eax),%eax
+  800b96:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800b99:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  800b9e:	83 ec 0c             	sub    $0xc,%esp
+  800ba1:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800ba5:	50                   	push   %eax
+  800ba6:	ff 75 e0             	push   -0x20(%ebp)
+  800ba9:	57                   	push   %edi
+  800baa:	51                   	push   %ecx
+  800bab:	52                   	push   %edx
+  800bac:	89 da                	mov    %ebx,%edx
+  800bae:	89 f0                	mov    %esi,%eax
+  800bb0:	e8 4a fb ff ff       	call   8006ff <printnum>
+      break;
+  800bb5:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  800bb8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  800bbb:	e9 40 fc ff ff       	jmp    800800 <vprintfmt+0x1e>
+  if (lflag >= 2)
+  800bc0:	83 f9 01             	cmp    $0x1,%ecx
+  800bc3:	7f 1b                	jg     800be0 <vprintfmt+0x3fe>
+  else if (lflag)
+  800bc5:	85 c9                	test   %ecx,%ecx
+  800bc7:	74 2c                	je     800bf5 <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  800bc9:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bcc:	8b 10                	mov    (%eax),%edx
+  800bce:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bd3:	8d 40 04             	lea    0x4(%eax),%eax
+  800bd6:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800bd9:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  800bde:	eb be                	jmp    800b9e <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800be0:	8b 45 14             	mov    0x14(%ebp),%eax
+  800be3:	8b 10                	mov    (%eax),%edx
+  800be5:	8b 48 04             	mov    0x4(%eax),%ecx
+  800be8:	8d 40 08             	lea    0x8(%eax),%eax
+  800beb:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800bee:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  800bf3:	eb a9                	jmp    800b9e <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800bf5:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bf8:	8b 10                	mov    (%eax),%edx
+  800bfa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bff:	8d 40 04             	lea    0x4(%eax),%eax
+  800c02:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800c05:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  800c0a:	eb 92                	jmp    800b9e <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  800c0c:	83 ec 08             	sub    $0x8,%esp
+  800c0f:	53                   	push   %ebx
+  800c10:	6a 25                	push   $0x25
+  800c12:	ff d6                	call   *%esi
+      break;
+  800c14:	83 c4 10             	add    $0x10,%esp
+  800c17:	eb 9f                	jmp    800bb8 <vprintfmt+0x3d6>
+      putch('%', putdat);
+  800c19:	83 ec 08             	sub    $0x8,%esp
+  800c1c:	53                   	push   %ebx
+  800c1d:	6a 25                	push   $0x25
+  800c1f:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  800c21:	83 c4 10             	add    $0x10,%esp
+  800c24:	89 f8                	mov    %edi,%eax
+  800c26:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800c2a:	74 05                	je     800c31 <vprintfmt+0x44f>
+  800c2c:	83 e8 01             	sub    $0x1,%eax
+  800c2f:	eb f5                	jmp    800c26 <vprintfmt+0x444>
+  800c31:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800c34:	eb 82                	jmp    800bb8 <vprintfmt+0x3d6>
+
+00800c36 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800c36:	55                   	push   %ebp
+  800c37:	89 e5                	mov    %esp,%ebp
+  800c39:	83 ec 18             	sub    $0x18,%esp
+  800c3c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c3f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  800c42:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800c45:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800c49:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800c4c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  800c53:	85 c0                	test   %eax,%eax
+  800c55:	74 26                	je     800c7d <vsnprintf+0x47>
+  800c57:	85 d2                	test   %edx,%edx
+  800c59:	7e 22                	jle    800c7d <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800c5b:	ff 75 14             	push   0x14(%ebp)
+  800c5e:	ff 75 10             	push   0x10(%ebp)
+  800c61:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800c64:	50                   	push   %eax
+  800c65:	68 a8 07 80 00       	push   $0x8007a8
+  800c6a:	e8 73 fb ff ff       	call   8007e2 <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800c6f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800c72:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  800c75:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800c78:	83 c4 10             	add    $0x10,%esp
+}
+  800c7b:	c9                   	leave
+  800c7c:	c3                   	ret
+    return -E_INVAL;
+  800c7d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c82:	eb f7                	jmp    800c7b <vsnprintf+0x45>
+
+00800c84 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800c84:	55                   	push   %ebp
+  800c85:	89 e5                	mov    %esp,%ebp
+  800c87:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  800c8a:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  800c8d:	50                   	push   %eax
+  800c8e:	ff 75 10             	push   0x10(%ebp)
+  800c91:	ff 75 0c             	push   0xc(%ebp)
+  800c94:	ff 75 08             	push   0x8(%ebp)
+  800c97:	e8 9a ff ff ff       	call   800c36 <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  800c9c:	c9                   	leave
+  800c9d:	c3                   	ret
+
+00800c9e <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800c9e:	55                   	push   %ebp
+  800c9f:	89 e5                	mov    %esp,%ebp
+  800ca1:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  800ca4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ca9:	eb 03                	jmp    800cae <strlen+0x10>
+    n++;
+  800cab:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  800cae:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800cb2:	75 f7                	jne    800cab <strlen+0xd>
+  return n;
+}
+  800cb4:	5d                   	pop    %ebp
+  800cb5:	c3                   	ret
+
+00800cb6 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800cb6:	55                   	push   %ebp
+  800cb7:	89 e5                	mov    %esp,%ebp
+  800cb9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800cbc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800cbf:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cc4:	eb 03                	jmp    800cc9 <strnlen+0x13>
+    n++;
+  800cc6:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800cc9:	39 d0                	cmp    %edx,%eax
+  800ccb:	74 08                	je     800cd5 <strnlen+0x1f>
+  800ccd:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800cd1:	75 f3                	jne    800cc6 <strnlen+0x10>
+  800cd3:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  800cd5:	89 d0                	mov    %edx,%eax
+  800cd7:	5d                   	pop    %ebp
+  800cd8:	c3                   	ret
+
+00800cd9 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800cd9:	55                   	push   %ebp
+  800cda:	89 e5                	mov    %esp,%ebp
+  800cdc:	53                   	push   %ebx
+  800cdd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ce0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  800ce3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ce8:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800cec:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800cef:	83 c0 01             	add    $0x1,%eax
+  800cf2:	84 d2                	test   %dl,%dl
+  800cf4:	75 f2                	jne    800ce8 <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  800cf6:	89 c8                	mov    %ecx,%eax
+  800cf8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800cfb:	c9                   	leave
+  800cfc:	c3                   	ret
+
+00800cfd <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800cfd:	55                   	push   %ebp
+  800cfe:	89 e5                	mov    %esp,%ebp
+  800d00:	53                   	push   %ebx
+  800d01:	83 ec 10             	sub    $0x10,%esp
+  800d04:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  800d07:	53                   	push   %ebx
+  800d08:	e8 91 ff ff ff       	call   800c9e <strlen>
+  800d0d:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  800d10:	ff 75 0c             	push   0xc(%ebp)
+  800d13:	01 d8                	add    %ebx,%eax
+  800d15:	50                   	push   %eax
+  800d16:	e8 be ff ff ff       	call   800cd9 <strcpy>
+  return dst;
+}
+  800d1b:	89 d8                	mov    %ebx,%eax
+  800d1d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d20:	c9                   	leave
+  800d21:	c3                   	ret
+
+00800d22 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  800d22:	55                   	push   %ebp
+  800d23:	89 e5                	mov    %esp,%ebp
+  800d25:	56                   	push   %esi
+  800d26:	53                   	push   %ebx
+  800d27:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d2a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  800d2d:	89 f3                	mov    %esi,%ebx
+  800d2f:	03 5d 10             	add    0x10(%ebp),%ebx
+  800d32:	89 f0                	mov    %esi,%eax
+  800d34:	eb 0f                	jmp    800d45 <strncpy+0x23>
+    *dst++ = *src;
+  800d36:	83 c0 01             	add    $0x1,%eax
+  800d39:	0f b6 0a             	movzbl (%edx),%ecx
+  800d3c:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  800d3f:	80 f9 01             	cmp    $0x1,%cl
+  800d42:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  800d45:	39 d8                	cmp    %ebx,%eax
+  800d47:	75 ed                	jne    800d36 <strncpy+0x14>
+  }
+  return ret;
+}
+  800d49:	89 f0                	mov    %esi,%eax
+  800d4b:	5b                   	pop    %ebx
+  800d4c:	5e                   	pop    %esi
+  800d4d:	5d                   	pop    %ebp
+  800d4e:	c3                   	ret
+
+00800d4f <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800d4f:	55                   	push   %ebp
+  800d50:	89 e5                	mov    %esp,%ebp
+  800d52:	56                   	push   %esi
+  800d53:	53                   	push   %ebx
+  800d54:	8b 75 08             	mov    0x8(%ebp),%esi
+  800d57:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d5a:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  800d5d:	89 f0                	mov    %esi,%eax
+  800d5f:	85 d2                	test   %edx,%edx
+  800d61:	74 21                	je     800d84 <strlcpy+0x35>
+  800d63:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800d67:	89 f2                	mov    %esi,%edx
+  800d69:	eb 09                	jmp    800d74 <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  800d6b:	83 c1 01             	add    $0x1,%ecx
+  800d6e:	83 c2 01             	add    $0x1,%edx
+  800d71:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  800d74:	39 c2                	cmp    %eax,%edx
+  800d76:	74 09                	je     800d81 <strlcpy+0x32>
+  800d78:	0f b6 19             	movzbl (%ecx),%ebx
+  800d7b:	84 db                	test   %bl,%bl
+  800d7d:	75 ec                	jne    800d6b <strlcpy+0x1c>
+  800d7f:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  800d81:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  800d84:	29 f0                	sub    %esi,%eax
+}
+  800d86:	5b                   	pop    %ebx
+  800d87:	5e                   	pop    %esi
+  800d88:	5d                   	pop    %ebp
+  800d89:	c3                   	ret
+
+00800d8a <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800d8a:	55                   	push   %ebp
+  800d8b:	89 e5                	mov    %esp,%ebp
+  800d8d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800d90:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  800d93:	eb 06                	jmp    800d9b <strcmp+0x11>
+    p++, q++;
+  800d95:	83 c1 01             	add    $0x1,%ecx
+  800d98:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  800d9b:	0f b6 01             	movzbl (%ecx),%eax
+  800d9e:	84 c0                	test   %al,%al
+  800da0:	74 04                	je     800da6 <strcmp+0x1c>
+  800da2:	3a 02                	cmp    (%edx),%al
+  800da4:	74 ef                	je     800d95 <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  800da6:	0f b6 c0             	movzbl %al,%eax
+  800da9:	0f b6 12             	movzbl (%edx),%edx
+  800dac:	29 d0                	sub    %edx,%eax
+}
+  800dae:	5d                   	pop    %ebp
+  800daf:	c3                   	ret
+
+00800db0 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800db0:	55                   	push   %ebp
+  800db1:	89 e5                	mov    %esp,%ebp
+  800db3:	53                   	push   %ebx
+  800db4:	8b 45 08             	mov    0x8(%ebp),%eax
+  800db7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dba:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  800dbd:	eb 09                	jmp    800dc8 <strncmp+0x18>
+    n--, p++, q++;
+  800dbf:	83 ea 01             	sub    $0x1,%edx
+  800dc2:	83 c0 01             	add    $0x1,%eax
+  800dc5:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  800dc8:	85 d2                	test   %edx,%edx
+  800dca:	74 18                	je     800de4 <strncmp+0x34>
+  800dcc:	0f b6 18             	movzbl (%eax),%ebx
+  800dcf:	84 db                	test   %bl,%bl
+  800dd1:	74 04                	je     800dd7 <strncmp+0x27>
+  800dd3:	3a 19                	cmp    (%ecx),%bl
+  800dd5:	74 e8                	je     800dbf <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800dd7:	0f b6 00             	movzbl (%eax),%eax
+  800dda:	0f b6 11             	movzbl (%ecx),%edx
+  800ddd:	29 d0                	sub    %edx,%eax
+}
+  800ddf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800de2:	c9                   	leave
+  800de3:	c3                   	ret
+    return 0;
+  800de4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800de9:	eb f4                	jmp    800ddf <strncmp+0x2f>
+
+00800deb <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800deb:	55                   	push   %ebp
+  800dec:	89 e5                	mov    %esp,%ebp
+  800dee:	8b 45 08             	mov    0x8(%ebp),%eax
+  800df1:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800df5:	eb 03                	jmp    800dfa <strchr+0xf>
+  800df7:	83 c0 01             	add    $0x1,%eax
+  800dfa:	0f b6 10             	movzbl (%eax),%edx
+  800dfd:	84 d2                	test   %dl,%dl
+  800dff:	74 06                	je     800e07 <strchr+0x1c>
+    if (*s == c)
+  800e01:	38 ca                	cmp    %cl,%dl
+  800e03:	75 f2                	jne    800df7 <strchr+0xc>
+  800e05:	eb 05                	jmp    800e0c <strchr+0x21>
+      return (char*)s;
+  return 0;
+  800e07:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e0c:	5d                   	pop    %ebp
+  800e0d:	c3                   	ret
+
+00800e0e <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800e0e:	55                   	push   %ebp
+  800e0f:	89 e5                	mov    %esp,%ebp
+  800e11:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e14:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800e18:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  800e1b:	38 ca                	cmp    %cl,%dl
+  800e1d:	74 09                	je     800e28 <strfind+0x1a>
+  800e1f:	84 d2                	test   %dl,%dl
+  800e21:	74 05                	je     800e28 <strfind+0x1a>
+  for (; *s; s++)
+  800e23:	83 c0 01             	add    $0x1,%eax
+  800e26:	eb f0                	jmp    800e18 <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  800e28:	5d                   	pop    %ebp
+  800e29:	c3                   	ret
+
+00800e2a <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800e2a:	55                   	push   %ebp
+  800e2b:	89 e5                	mov    %esp,%ebp
+  800e2d:	57                   	push   %edi
+  800e2e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800e31:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  800e34:	85 c9                	test   %ecx,%ecx
+  800e36:	74 20                	je     800e58 <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  800e38:	89 f8                	mov    %edi,%eax
+  800e3a:	09 c8                	or     %ecx,%eax
+  800e3c:	a8 03                	test   $0x3,%al
+  800e3e:	75 12                	jne    800e52 <memset+0x28>
+    c &= 0xFF;
+  800e40:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800e44:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  800e4a:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  800e4d:	fc                   	cld
+  800e4e:	f3 ab                	rep stos %eax,%es:(%edi)
+  800e50:	eb 06                	jmp    800e58 <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  800e52:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e55:	fc                   	cld
+  800e56:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  800e58:	89 f8                	mov    %edi,%eax
+  800e5a:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800e5d:	c9                   	leave
+  800e5e:	c3                   	ret
+
+00800e5f <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800e5f:	55                   	push   %ebp
+  800e60:	89 e5                	mov    %esp,%ebp
+  800e62:	57                   	push   %edi
+  800e63:	56                   	push   %esi
+  800e64:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e67:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800e6a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  800e6d:	39 c6                	cmp    %eax,%esi
+  800e6f:	73 32                	jae    800ea3 <memmove+0x44>
+  800e71:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800e74:	39 d0                	cmp    %edx,%eax
+  800e76:	73 2b                	jae    800ea3 <memmove+0x44>
+    s += n;
+    d += n;
+  800e78:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800e7b:	89 d6                	mov    %edx,%esi
+  800e7d:	09 fe                	or     %edi,%esi
+  800e7f:	09 ce                	or     %ecx,%esi
+  800e81:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800e87:	75 0e                	jne    800e97 <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800e89:	83 ef 04             	sub    $0x4,%edi
+  800e8c:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800e8f:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  800e92:	fd                   	std
+  800e93:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800e95:	eb 09                	jmp    800ea0 <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800e97:	83 ef 01             	sub    $0x1,%edi
+  800e9a:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  800e9d:	fd                   	std
+  800e9e:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  800ea0:	fc                   	cld
+  800ea1:	eb 1a                	jmp    800ebd <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ea3:	89 f2                	mov    %esi,%edx
+  800ea5:	09 c2                	or     %eax,%edx
+  800ea7:	09 ca                	or     %ecx,%edx
+  800ea9:	f6 c2 03             	test   $0x3,%dl
+  800eac:	75 0a                	jne    800eb8 <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800eae:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  800eb1:	89 c7                	mov    %eax,%edi
+  800eb3:	fc                   	cld
+  800eb4:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800eb6:	eb 05                	jmp    800ebd <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  800eb8:	89 c7                	mov    %eax,%edi
+  800eba:	fc                   	cld
+  800ebb:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  800ebd:	5e                   	pop    %esi
+  800ebe:	5f                   	pop    %edi
+  800ebf:	5d                   	pop    %ebp
+  800ec0:	c3                   	ret
+
+00800ec1 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800ec1:	55                   	push   %ebp
+  800ec2:	89 e5                	mov    %esp,%ebp
+  800ec4:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  800ec7:	ff 75 10             	push   0x10(%ebp)
+  800eca:	ff 75 0c             	push   0xc(%ebp)
+  800ecd:	ff 75 08             	push   0x8(%ebp)
+  800ed0:	e8 8a ff ff ff       	call   800e5f <memmove>
+}
+  800ed5:	c9                   	leave
+  800ed6:	c3                   	ret
+
+00800ed7 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800ed7:	55                   	push   %ebp
+  800ed8:	89 e5                	mov    %esp,%ebp
+  800eda:	56                   	push   %esi
+  800edb:	53                   	push   %ebx
+  800edc:	8b 45 08             	mov    0x8(%ebp),%eax
+  800edf:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  800ee2:	89 c6                	mov    %eax,%esi
+  800ee4:	03 75 10             	add    0x10(%ebp),%esi
+  800ee7:	eb 06                	jmp    800eef <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  800ee9:	83 c0 01             	add    $0x1,%eax
+  800eec:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  800eef:	39 f0                	cmp    %esi,%eax
+  800ef1:	74 14                	je     800f07 <memcmp+0x30>
+    if (*s1 != *s2)
+  800ef3:	0f b6 08             	movzbl (%eax),%ecx
+  800ef6:	0f b6 1a             	movzbl (%edx),%ebx
+  800ef9:	38 d9                	cmp    %bl,%cl
+  800efb:	74 ec                	je     800ee9 <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  800efd:	0f b6 c1             	movzbl %cl,%eax
+  800f00:	0f b6 db             	movzbl %bl,%ebx
+  800f03:	29 d8                	sub    %ebx,%eax
+  800f05:	eb 05                	jmp    800f0c <memcmp+0x35>
+  }
+
+  return 0;
+  800f07:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f0c:	5b                   	pop    %ebx
+  800f0d:	5e                   	pop    %esi
+  800f0e:	5d                   	pop    %ebp
+  800f0f:	c3                   	ret
+
+00800f10 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800f10:	55                   	push   %ebp
+  800f11:	89 e5                	mov    %esp,%ebp
+  800f13:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f16:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  800f19:	89 c2                	mov    %eax,%edx
+  800f1b:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  800f1e:	eb 03                	jmp    800f23 <memfind+0x13>
+  800f20:	83 c0 01             	add    $0x1,%eax
+  800f23:	39 d0                	cmp    %edx,%eax
+  800f25:	73 04                	jae    800f2b <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  800f27:	38 08                	cmp    %cl,(%eax)
+  800f29:	75 f5                	jne    800f20 <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  800f2b:	5d                   	pop    %ebp
+  800f2c:	c3                   	ret
+
+00800f2d <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800f2d:	55                   	push   %ebp
+  800f2e:	89 e5                	mov    %esp,%ebp
+  800f30:	57                   	push   %edi
+  800f31:	56                   	push   %esi
+  800f32:	53                   	push   %ebx
+  800f33:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f36:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  800f39:	eb 03                	jmp    800f3e <strtol+0x11>
+    s++;
+  800f3b:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  800f3e:	0f b6 02             	movzbl (%edx),%eax
+  800f41:	3c 20                	cmp    $0x20,%al
+  800f43:	74 f6                	je     800f3b <strtol+0xe>
+  800f45:	3c 09                	cmp    $0x9,%al
+  800f47:	74 f2                	je     800f3b <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  800f49:	3c 2b                	cmp    $0x2b,%al
+  800f4b:	74 2a                	je     800f77 <strtol+0x4a>
+  int neg = 0;
+  800f4d:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  800f52:	3c 2d                	cmp    $0x2d,%al
+  800f54:	74 2b                	je     800f81 <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800f56:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800f5c:	75 0f                	jne    800f6d <strtol+0x40>
+  800f5e:	80 3a 30             	cmpb   $0x30,(%edx)
+  800f61:	74 28                	je     800f8b <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  800f63:	85 db                	test   %ebx,%ebx
+  800f65:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f6a:	0f 44 d8             	cmove  %eax,%ebx
+  800f6d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f72:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800f75:	eb 46                	jmp    800fbd <strtol+0x90>
+    s++;
+  800f77:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  800f7a:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f7f:	eb d5                	jmp    800f56 <strtol+0x29>
+    s++, neg = 1;
+  800f81:	83 c2 01             	add    $0x1,%edx
+  800f84:	bf 01 00 00 00       	mov    $0x1,%edi
+  800f89:	eb cb                	jmp    800f56 <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800f8b:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800f8f:	74 0e                	je     800f9f <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  800f91:	85 db                	test   %ebx,%ebx
+  800f93:	75 d8                	jne    800f6d <strtol+0x40>
+    s++, base = 8;
+  800f95:	83 c2 01             	add    $0x1,%edx
+  800f98:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800f9d:	eb ce                	jmp    800f6d <strtol+0x40>
+    s += 2, base = 16;
+  800f9f:	83 c2 02             	add    $0x2,%edx
+  800fa2:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800fa7:	eb c4                	jmp    800f6d <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  800fa9:	0f be c0             	movsbl %al,%eax
+  800fac:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  800faf:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800fb2:	7d 3a                	jge    800fee <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  800fb4:	83 c2 01             	add    $0x1,%edx
+  800fb7:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800fbb:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  800fbd:	0f b6 02             	movzbl (%edx),%eax
+  800fc0:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800fc3:	89 f3                	mov    %esi,%ebx
+  800fc5:	80 fb 09             	cmp    $0x9,%bl
+  800fc8:	76 df                	jbe    800fa9 <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  800fca:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800fcd:	89 f3                	mov    %esi,%ebx
+  800fcf:	80 fb 19             	cmp    $0x19,%bl
+  800fd2:	77 08                	ja     800fdc <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  800fd4:	0f be c0             	movsbl %al,%eax
+  800fd7:	83 e8 57             	sub    $0x57,%eax
+  800fda:	eb d3                	jmp    800faf <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  800fdc:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800fdf:	89 f3                	mov    %esi,%ebx
+  800fe1:	80 fb 19             	cmp    $0x19,%bl
+  800fe4:	77 08                	ja     800fee <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  800fe6:	0f be c0             	movsbl %al,%eax
+  800fe9:	83 e8 37             	sub    $0x37,%eax
+  800fec:	eb c1                	jmp    800faf <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  800fee:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800ff2:	74 05                	je     800ff9 <strtol+0xcc>
+    *endptr = (char*)s;
+  800ff4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ff7:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  800ff9:	89 c8                	mov    %ecx,%eax
+  800ffb:	f7 d8                	neg    %eax
+  800ffd:	85 ff                	test   %edi,%edi
+  800fff:	0f 45 c8             	cmovne %eax,%ecx
+}
+  801002:	89 c8                	mov    %ecx,%eax
+  801004:	5b                   	pop    %ebx
+  801005:	5e                   	pop    %esi
+  801006:	5f                   	pop    %edi
+  801007:	5d                   	pop    %ebp
+  801008:	c3                   	ret
+
+00801009 <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  801009:	55                   	push   %ebp
+  80100a:	89 e5                	mov    %esp,%ebp
+  80100c:	57                   	push   %edi
+  80100d:	56                   	push   %esi
+  80100e:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80100f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801014:	8b 55 08             	mov    0x8(%ebp),%edx
+  801017:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80101a:	89 c3                	mov    %eax,%ebx
+  80101c:	89 c7                	mov    %eax,%edi
+  80101e:	89 c6                	mov    %eax,%esi
+  801020:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  801022:	5b                   	pop    %ebx
+  801023:	5e                   	pop    %esi
+  801024:	5f                   	pop    %edi
+  801025:	5d                   	pop    %ebp
+  801026:	c3                   	ret
+
+00801027 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  801027:	55                   	push   %ebp
+  801028:	89 e5                	mov    %esp,%ebp
+  80102a:	57                   	push   %edi
+  80102b:	56                   	push   %esi
+  80102c:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80102d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801032:	b8 01 00 00 00       	mov    $0x1,%eax
+  801037:	89 d1                	mov    %edx,%ecx
+  801039:	89 d3                	mov    %edx,%ebx
+  80103b:	89 d7                	mov    %edx,%edi
+  80103d:	89 d6                	mov    %edx,%esi
+  80103f:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  801041:	5b                   	pop    %ebx
+  801042:	5e                   	pop    %esi
+  801043:	5f                   	pop    %edi
+  801044:	5d                   	pop    %ebp
+  801045:	c3                   	ret
+
+00801046 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  801046:	55                   	push   %ebp
+  801047:	89 e5                	mov    %esp,%ebp
+  801049:	57                   	push   %edi
+  80104a:	56                   	push   %esi
+  80104b:	53                   	push   %ebx
+  80104c:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80104f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801054:	8b 55 08             	mov    0x8(%ebp),%edx
+  801057:	b8 03 00 00 00       	mov    $0x3,%eax
+  80105c:	89 cb                	mov    %ecx,%ebx
+  80105e:	89 cf                	mov    %ecx,%edi
+  801060:	89 ce                	mov    %ecx,%esi
+  801062:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801064:	85 c0                	test   %eax,%eax
+  801066:	7f 08                	jg     801070 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  801068:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80106b:	5b                   	pop    %ebx
+  80106c:	5e                   	pop    %esi
+  80106d:	5f                   	pop    %edi
+  80106e:	5d                   	pop    %ebp
+  80106f:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801070:	83 ec 0c             	sub    $0xc,%esp
+  801073:	50                   	push   %eax
+  801074:	6a 03                	push   $0x3
+  801076:	68 43 3f 80 00       	push   $0x803f43
+  80107b:	6a 23                	push   $0x23
+  80107d:	68 60 3f 80 00       	push   $0x803f60
+  801082:	e8 89 f5 ff ff       	call   800610 <_panic>
+
+00801087 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  801087:	55                   	push   %ebp
+  801088:	89 e5                	mov    %esp,%ebp
+  80108a:	57                   	push   %edi
+  80108b:	56                   	push   %esi
+  80108c:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80108d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801092:	b8 02 00 00 00       	mov    $0x2,%eax
+  801097:	89 d1                	mov    %edx,%ecx
+  801099:	89 d3                	mov    %edx,%ebx
+  80109b:	89 d7                	mov    %edx,%edi
+  80109d:	89 d6                	mov    %edx,%esi
+  80109f:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  8010a1:	5b                   	pop    %ebx
+  8010a2:	5e                   	pop    %esi
+  8010a3:	5f                   	pop    %edi
+  8010a4:	5d                   	pop    %ebp
+  8010a5:	c3                   	ret
+
+008010a6 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  8010a6:	55                   	push   %ebp
+  8010a7:	89 e5                	mov    %esp,%ebp
+  8010a9:	57                   	push   %edi
+  8010aa:	56                   	push   %esi
+  8010ab:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8010ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010b1:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8010b6:	89 d1                	mov    %edx,%ecx
+  8010b8:	89 d3                	mov    %edx,%ebx
+  8010ba:	89 d7                	mov    %edx,%edi
+  8010bc:	89 d6                	mov    %edx,%esi
+  8010be:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  8010c0:	5b                   	pop    %ebx
+  8010c1:	5e                   	pop    %esi
+  8010c2:	5f                   	pop    %edi
+  8010c3:	5d                   	pop    %ebp
+  8010c4:	c3                   	ret
+
+008010c5 <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  8010c5:	55                   	push   %ebp
+  8010c6:	89 e5                	mov    %esp,%ebp
+  8010c8:	57                   	push   %edi
+  8010c9:	56                   	push   %esi
+  8010ca:	53                   	push   %ebx
+  8010cb:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  8010ce:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  8010d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010d7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010da:	b8 14 00 00 00       	mov    $0x14,%eax
+  8010df:	89 df                	mov    %ebx,%edi
+  8010e1:	89 de                	mov    %ebx,%esi
+  8010e3:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8010e5:	85 c0                	test   %eax,%eax
+  8010e7:	7f 08                	jg     8010f1 <sys_env_set_cow+0x2c>
+}
+  8010e9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010ec:	5b                   	pop    %ebx
+  8010ed:	5e                   	pop    %esi
+  8010ee:	5f                   	pop    %edi
+  8010ef:	5d                   	pop    %ebp
+  8010f0:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8010f1:	83 ec 0c             	sub    $0xc,%esp
+  8010f4:	50                   	push   %eax
+  8010f5:	6a 14                	push   $0x14
+  8010f7:	68 43 3f 80 00       	push   $0x803f43
+  8010fc:	6a 23                	push   $0x23
+  8010fe:	68 60 3f 80 00       	push   $0x803f60
+  801103:	e8 08 f5 ff ff       	call   800610 <_panic>
+
+00801108 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  801108:	55                   	push   %ebp
+  801109:	89 e5                	mov    %esp,%ebp
+  80110b:	57                   	push   %edi
+  80110c:	56                   	push   %esi
+  80110d:	53                   	push   %ebx
+  80110e:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801111:	be 00 00 00 00       	mov    $0x0,%esi
+  801116:	8b 55 08             	mov    0x8(%ebp),%edx
+  801119:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80111c:	b8 04 00 00 00       	mov    $0x4,%eax
+  801121:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801124:	89 f7                	mov    %esi,%edi
+  801126:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801128:	85 c0                	test   %eax,%eax
+  80112a:	7f 08                	jg     801134 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  80112c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80112f:	5b                   	pop    %ebx
+  801130:	5e                   	pop    %esi
+  801131:	5f                   	pop    %edi
+  801132:	5d                   	pop    %ebp
+  801133:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801134:	83 ec 0c             	sub    $0xc,%esp
+  801137:	50                   	push   %eax
+  801138:	6a 04                	push   $0x4
+  80113a:	68 43 3f 80 00       	push   $0x803f43
+  80113f:	6a 23                	push   $0x23
+  801141:	68 60 3f 80 00       	push   $0x803f60
+  801146:	e8 c5 f4 ff ff       	call   800610 <_panic>
+
+0080114b <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  80114b:	55                   	push   %ebp
+  80114c:	89 e5                	mov    %esp,%ebp
+  80114e:	57                   	push   %edi
+  80114f:	56                   	push   %esi
+  801150:	53                   	push   %ebx
+  801151:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801154:	8b 55 08             	mov    0x8(%ebp),%edx
+  801157:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80115a:	b8 05 00 00 00       	mov    $0x5,%eax
+  80115f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801162:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801165:	8b 75 18             	mov    0x18(%ebp),%esi
+  801168:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80116a:	85 c0                	test   %eax,%eax
+  80116c:	7f 08                	jg     801176 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  80116e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801171:	5b                   	pop    %ebx
+  801172:	5e                   	pop    %esi
+  801173:	5f                   	pop    %edi
+  801174:	5d                   	pop    %ebp
+  801175:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801176:	83 ec 0c             	sub    $0xc,%esp
+  801179:	50                   	push   %eax
+  80117a:	6a 05                	push   $0x5
+  80117c:	68 43 3f 80 00       	push   $0x803f43
+  801181:	6a 23                	push   $0x23
+  801183:	68 60 3f 80 00       	push   $0x803f60
+  801188:	e8 83 f4 ff ff       	call   800610 <_panic>
+
+0080118d <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  80118d:	55                   	push   %ebp
+  80118e:	89 e5                	mov    %esp,%ebp
+  801190:	57                   	push   %edi
+  801191:	56                   	push   %esi
+  801192:	53                   	push   %ebx
+  801193:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801196:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80119b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80119e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011a1:	b8 06 00 00 00       	mov    $0x6,%eax
+  8011a6:	89 df                	mov    %ebx,%edi
+  8011a8:	89 de                	mov    %ebx,%esi
+  8011aa:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8011ac:	85 c0                	test   %eax,%eax
+  8011ae:	7f 08                	jg     8011b8 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  8011b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011b3:	5b                   	pop    %ebx
+  8011b4:	5e                   	pop    %esi
+  8011b5:	5f                   	pop    %edi
+  8011b6:	5d                   	pop    %ebp
+  8011b7:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8011b8:	83 ec 0c             	sub    $0xc,%esp
+  8011bb:	50                   	push   %eax
+  8011bc:	6a 06                	push   $0x6
+  8011be:	68 43 3f 80 00       	push   $0x803f43
+  8011c3:	6a 23                	push   $0x23
+  8011c5:	68 60 3f 80 00       	push   $0x803f60
+  8011ca:	e8 41 f4 ff ff       	call   800610 <_panic>
+
+008011cf <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  8011cf:	55                   	push   %ebp
+  8011d0:	89 e5                	mov    %esp,%ebp
+  8011d2:	57                   	push   %edi
+  8011d3:	56                   	push   %esi
+  8011d4:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8011d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011db:	b8 11 00 00 00       	mov    $0x11,%eax
+  8011e0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011e3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011e6:	8b 75 18             	mov    0x18(%ebp),%esi
+  8011e9:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  8011eb:	5b                   	pop    %ebx
+  8011ec:	5e                   	pop    %esi
+  8011ed:	5f                   	pop    %edi
+  8011ee:	5d                   	pop    %ebp
+  8011ef:	c3                   	ret
+
+008011f0 <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  8011f0:	55                   	push   %ebp
+  8011f1:	89 e5                	mov    %esp,%ebp
+  8011f3:	57                   	push   %edi
+  8011f4:	56                   	push   %esi
+  8011f5:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8011f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011f9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011fc:	b8 12 00 00 00       	mov    $0x12,%eax
+  801201:	be 00 00 00 00       	mov    $0x0,%esi
+  801206:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801209:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80120c:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  80120e:	5b                   	pop    %ebx
+  80120f:	5e                   	pop    %esi
+  801210:	5f                   	pop    %edi
+  801211:	5d                   	pop    %ebp
+  801212:	c3                   	ret
+
+00801213 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  801213:	55                   	push   %ebp
+  801214:	89 e5                	mov    %esp,%ebp
+  801216:	57                   	push   %edi
+  801217:	56                   	push   %esi
+  801218:	53                   	push   %ebx
+  801219:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80121c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801221:	8b 55 08             	mov    0x8(%ebp),%edx
+  801224:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801227:	b8 16 00 00 00       	mov    $0x16,%eax
+  80122c:	89 df                	mov    %ebx,%edi
+  80122e:	89 de                	mov    %ebx,%esi
+  801230:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801232:	85 c0                	test   %eax,%eax
+  801234:	7f 08                	jg     80123e <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  801236:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801239:	5b                   	pop    %ebx
+  80123a:	5e                   	pop    %esi
+  80123b:	5f                   	pop    %edi
+  80123c:	5d                   	pop    %ebp
+  80123d:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80123e:	83 ec 0c             	sub    $0xc,%esp
+  801241:	50                   	push   %eax
+  801242:	6a 16                	push   $0x16
+  801244:	68 43 3f 80 00       	push   $0x803f43
+  801249:	6a 23                	push   $0x23
+  80124b:	68 60 3f 80 00       	push   $0x803f60
+  801250:	e8 bb f3 ff ff       	call   800610 <_panic>
+
+00801255 <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  801255:	55                   	push   %ebp
+  801256:	89 e5                	mov    %esp,%ebp
+  801258:	57                   	push   %edi
+  801259:	56                   	push   %esi
+  80125a:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80125b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801260:	8b 55 08             	mov    0x8(%ebp),%edx
+  801263:	b8 17 00 00 00       	mov    $0x17,%eax
+  801268:	89 cb                	mov    %ecx,%ebx
+  80126a:	89 cf                	mov    %ecx,%edi
+  80126c:	89 ce                	mov    %ecx,%esi
+  80126e:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  801270:	5b                   	pop    %ebx
+  801271:	5e                   	pop    %esi
+  801272:	5f                   	pop    %edi
+  801273:	5d                   	pop    %ebp
+  801274:	c3                   	ret
+
+00801275 <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  801275:	55                   	push   %ebp
+  801276:	89 e5                	mov    %esp,%ebp
+  801278:	57                   	push   %edi
+  801279:	56                   	push   %esi
+  80127a:	53                   	push   %ebx
+  80127b:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80127e:	be 00 00 00 00       	mov    $0x0,%esi
+  801283:	8b 55 08             	mov    0x8(%ebp),%edx
+  801286:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801289:	b8 18 00 00 00       	mov    $0x18,%eax
+  80128e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801291:	89 f7                	mov    %esi,%edi
+  801293:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801295:	85 c0                	test   %eax,%eax
+  801297:	7f 08                	jg     8012a1 <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  801299:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80129c:	5b                   	pop    %ebx
+  80129d:	5e                   	pop    %esi
+  80129e:	5f                   	pop    %edi
+  80129f:	5d                   	pop    %ebp
+  8012a0:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8012a1:	83 ec 0c             	sub    $0xc,%esp
+  8012a4:	50                   	push   %eax
+  8012a5:	6a 18                	push   $0x18
+  8012a7:	68 43 3f 80 00       	push   $0x803f43
+  8012ac:	6a 23                	push   $0x23
+  8012ae:	68 60 3f 80 00       	push   $0x803f60
+  8012b3:	e8 58 f3 ff ff       	call   800610 <_panic>
+
+008012b8 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  8012b8:	55                   	push   %ebp
+  8012b9:	89 e5                	mov    %esp,%ebp
+  8012bb:	57                   	push   %edi
+  8012bc:	56                   	push   %esi
+  8012bd:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8012be:	be 00 00 00 00       	mov    $0x0,%esi
+  8012c3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012c6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012c9:	b8 19 00 00 00       	mov    $0x19,%eax
+  8012ce:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012d1:	89 f7                	mov    %esi,%edi
+  8012d3:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  8012d5:	5b                   	pop    %ebx
+  8012d6:	5e                   	pop    %esi
+  8012d7:	5f                   	pop    %edi
+  8012d8:	5d                   	pop    %ebp
+  8012d9:	c3                   	ret
+
+008012da <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  8012da:	55                   	push   %ebp
+  8012db:	89 e5                	mov    %esp,%ebp
+  8012dd:	57                   	push   %edi
+  8012de:	56                   	push   %esi
+  8012df:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8012e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012e5:	b8 15 00 00 00       	mov    $0x15,%eax
+  8012ea:	89 d1                	mov    %edx,%ecx
+  8012ec:	89 d3                	mov    %edx,%ebx
+  8012ee:	89 d7                	mov    %edx,%edi
+  8012f0:	89 d6                	mov    %edx,%esi
+  8012f2:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8012f4:	5b                   	pop    %ebx
+  8012f5:	5e                   	pop    %esi
+  8012f6:	5f                   	pop    %edi
+  8012f7:	5d                   	pop    %ebp
+  8012f8:	c3                   	ret
+
+008012f9 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8012f9:	55                   	push   %ebp
+  8012fa:	89 e5                	mov    %esp,%ebp
+  8012fc:	57                   	push   %edi
+  8012fd:	56                   	push   %esi
+  8012fe:	53                   	push   %ebx
+  8012ff:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801302:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801307:	8b 55 08             	mov    0x8(%ebp),%edx
+  80130a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80130d:	b8 08 00 00 00       	mov    $0x8,%eax
+  801312:	89 df                	mov    %ebx,%edi
+  801314:	89 de                	mov    %ebx,%esi
+  801316:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801318:	85 c0                	test   %eax,%eax
+  80131a:	7f 08                	jg     801324 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  80131c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80131f:	5b                   	pop    %ebx
+  801320:	5e                   	pop    %esi
+  801321:	5f                   	pop    %edi
+  801322:	5d                   	pop    %ebp
+  801323:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801324:	83 ec 0c             	sub    $0xc,%esp
+  801327:	50                   	push   %eax
+  801328:	6a 08                	push   $0x8
+  80132a:	68 43 3f 80 00       	push   $0x803f43
+  80132f:	6a 23                	push   $0x23
+  801331:	68 60 3f 80 00       	push   $0x803f60
+  801336:	e8 d5 f2 ff ff       	call   800610 <_panic>
+
+0080133b <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80133b:	55                   	push   %ebp
+  80133c:	89 e5                	mov    %esp,%ebp
+  80133e:	57                   	push   %edi
+  80133f:	56                   	push   %esi
+  801340:	53                   	push   %ebx
+  801341:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801344:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801349:	8b 55 08             	mov    0x8(%ebp),%edx
+  80134c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80134f:	b8 09 00 00 00       	mov    $0x9,%eax
+  801354:	89 df                	mov    %ebx,%edi
+  801356:	89 de                	mov    %ebx,%esi
+  801358:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80135a:	85 c0                	test   %eax,%eax
+  80135c:	7f 08                	jg     801366 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  80135e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801361:	5b                   	pop    %ebx
+  801362:	5e                   	pop    %esi
+  801363:	5f                   	pop    %edi
+  801364:	5d                   	pop    %ebp
+  801365:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801366:	83 ec 0c             	sub    $0xc,%esp
+  801369:	50                   	push   %eax
+  80136a:	6a 09                	push   $0x9
+  80136c:	68 43 3f 80 00       	push   $0x803f43
+  801371:	6a 23                	push   $0x23
+  801373:	68 60 3f 80 00       	push   $0x803f60
+  801378:	e8 93 f2 ff ff       	call   800610 <_panic>
+
+0080137d <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80137d:	55                   	push   %ebp
+  80137e:	89 e5                	mov    %esp,%ebp
+  801380:	57                   	push   %edi
+  801381:	56                   	push   %esi
+  801382:	53                   	push   %ebx
+  801383:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801386:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80138b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80138e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801391:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801396:	89 df                	mov    %ebx,%edi
+  801398:	89 de                	mov    %ebx,%esi
+  80139a:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80139c:	85 c0                	test   %eax,%eax
+  80139e:	7f 08                	jg     8013a8 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  8013a0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013a3:	5b                   	pop    %ebx
+  8013a4:	5e                   	pop    %esi
+  8013a5:	5f                   	pop    %edi
+  8013a6:	5d                   	pop    %ebp
+  8013a7:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8013a8:	83 ec 0c             	sub    $0xc,%esp
+  8013ab:	50                   	push   %eax
+  8013ac:	6a 0a                	push   $0xa
+  8013ae:	68 43 3f 80 00       	push   $0x803f43
+  8013b3:	6a 23                	push   $0x23
+  8013b5:	68 60 3f 80 00       	push   $0x803f60
+  8013ba:	e8 51 f2 ff ff       	call   800610 <_panic>
+
+008013bf <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  8013bf:	55                   	push   %ebp
+  8013c0:	89 e5                	mov    %esp,%ebp
+  8013c2:	57                   	push   %edi
+  8013c3:	56                   	push   %esi
+  8013c4:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8013c5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013c8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013cb:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8013d0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013d3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8013d6:	8b 75 18             	mov    0x18(%ebp),%esi
+  8013d9:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  8013db:	5b                   	pop    %ebx
+  8013dc:	5e                   	pop    %esi
+  8013dd:	5f                   	pop    %edi
+  8013de:	5d                   	pop    %ebp
+  8013df:	c3                   	ret
+
+008013e0 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  8013e0:	55                   	push   %ebp
+  8013e1:	89 e5                	mov    %esp,%ebp
+  8013e3:	57                   	push   %edi
+  8013e4:	56                   	push   %esi
+  8013e5:	53                   	push   %ebx
+  8013e6:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8013e9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013f1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013f4:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8013f9:	89 df                	mov    %ebx,%edi
+  8013fb:	89 de                	mov    %ebx,%esi
+  8013fd:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8013ff:	85 c0                	test   %eax,%eax
+  801401:	7f 08                	jg     80140b <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  801403:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801406:	5b                   	pop    %ebx
+  801407:	5e                   	pop    %esi
+  801408:	5f                   	pop    %edi
+  801409:	5d                   	pop    %ebp
+  80140a:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80140b:	83 ec 0c             	sub    $0xc,%esp
+  80140e:	50                   	push   %eax
+  80140f:	6a 0d                	push   $0xd
+  801411:	68 43 3f 80 00       	push   $0x803f43
+  801416:	6a 23                	push   $0x23
+  801418:	68 60 3f 80 00       	push   $0x803f60
+  80141d:	e8 ee f1 ff ff       	call   800610 <_panic>
+
+00801422 <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  801422:	55                   	push   %ebp
+  801423:	89 e5                	mov    %esp,%ebp
+  801425:	57                   	push   %edi
+  801426:	56                   	push   %esi
+  801427:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801428:	ba 00 00 00 00       	mov    $0x0,%edx
+  80142d:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801432:	89 d1                	mov    %edx,%ecx
+  801434:	89 d3                	mov    %edx,%ebx
+  801436:	89 d7                	mov    %edx,%edi
+  801438:	89 d6                	mov    %edx,%esi
+  80143a:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  80143c:	5b                   	pop    %ebx
+  80143d:	5e                   	pop    %esi
+  80143e:	5f                   	pop    %edi
+  80143f:	5d                   	pop    %ebp
+  801440:	c3                   	ret
+
+00801441 <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  801441:	55                   	push   %ebp
+  801442:	89 e5                	mov    %esp,%ebp
+  801444:	57                   	push   %edi
+  801445:	56                   	push   %esi
+  801446:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801447:	8b 55 08             	mov    0x8(%ebp),%edx
+  80144a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80144d:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801452:	be 00 00 00 00       	mov    $0x0,%esi
+  801457:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80145a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80145d:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  80145f:	5b                   	pop    %ebx
+  801460:	5e                   	pop    %esi
+  801461:	5f                   	pop    %edi
+  801462:	5d                   	pop    %ebp
+  801463:	c3                   	ret
+
+00801464 <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  801464:	55                   	push   %ebp
+  801465:	89 e5                	mov    %esp,%ebp
+  801467:	57                   	push   %edi
+  801468:	56                   	push   %esi
+  801469:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80146a:	be 00 00 00 00       	mov    $0x0,%esi
+  80146f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801472:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801475:	b8 10 00 00 00       	mov    $0x10,%eax
+  80147a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80147d:	89 f7                	mov    %esi,%edi
+  80147f:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  801481:	5b                   	pop    %ebx
+  801482:	5e                   	pop    %esi
+  801483:	5f                   	pop    %edi
+  801484:	5d                   	pop    %ebp
+  801485:	c3                   	ret
+
+00801486 <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  801486:	55                   	push   %ebp
+  801487:	89 e5                	mov    %esp,%ebp
+  801489:	57                   	push   %edi
+  80148a:	56                   	push   %esi
+  80148b:	53                   	push   %ebx
+  80148c:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  80148f:	80 3d e4 97 80 00 00 	cmpb   $0x0,0x8097e4
+  801496:	74 41                	je     8014d9 <sys_batch+0x53>
+  801498:	8b 45 08             	mov    0x8(%ebp),%eax
+  80149b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  80149e:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  8014a5:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8014a8:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  8014ab:	7d 45                	jge    8014f2 <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  8014ad:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8014b0:	8b 06                	mov    (%esi),%eax
+  8014b2:	8b 56 04             	mov    0x4(%esi),%edx
+  8014b5:	8b 4e 08             	mov    0x8(%esi),%ecx
+  8014b8:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  8014bb:	8b 7e 10             	mov    0x10(%esi),%edi
+  8014be:	8b 76 14             	mov    0x14(%esi),%esi
+  8014c1:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  8014c3:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8014c6:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  8014c9:	83 c6 1c             	add    $0x1c,%esi
+  8014cc:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  8014cf:	85 c0                	test   %eax,%eax
+  8014d1:	78 1f                	js     8014f2 <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  8014d3:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  8014d7:	eb cc                	jmp    8014a5 <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  8014d9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014de:	b8 13 00 00 00       	mov    $0x13,%eax
+  8014e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014e6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014e9:	89 df                	mov    %ebx,%edi
+  8014eb:	89 de                	mov    %ebx,%esi
+  8014ed:	cd 30                	int    $0x30
+  8014ef:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  8014f2:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8014f5:	83 c4 08             	add    $0x8,%esp
+  8014f8:	5b                   	pop    %ebx
+  8014f9:	5e                   	pop    %esi
+  8014fa:	5f                   	pop    %edi
+  8014fb:	5d                   	pop    %ebp
+  8014fc:	c3                   	ret
+
+008014fd <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  8014fd:	55                   	push   %ebp
+  8014fe:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  801500:	8b 45 08             	mov    0x8(%ebp),%eax
+  801503:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  801509:	5d                   	pop    %ebp
+  80150a:	c3                   	ret
+
+0080150b <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  80150b:	55                   	push   %ebp
+  80150c:	89 e5                	mov    %esp,%ebp
+  80150e:	56                   	push   %esi
+  80150f:	53                   	push   %ebx
+  801510:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  801513:	8b 1e                	mov    (%esi),%ebx
+  801515:	85 db                	test   %ebx,%ebx
+  801517:	75 09                	jne    801522 <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  801519:	89 d8                	mov    %ebx,%eax
+  80151b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80151e:	5b                   	pop    %ebx
+  80151f:	5e                   	pop    %esi
+  801520:	5d                   	pop    %ebp
+  801521:	c3                   	ret
+  b->sb_n = 0;
+  801522:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  801528:	53                   	push   %ebx
+  801529:	8d 46 04             	lea    0x4(%esi),%eax
+  80152c:	50                   	push   %eax
+  80152d:	e8 54 ff ff ff       	call   801486 <sys_batch>
+  801532:	83 c4 08             	add    $0x8,%esp
+  801535:	85 c0                	test   %eax,%eax
+  801537:	78 1e                	js     801557 <sysbatch_flush+0x4c>
+  if (r < n)
+  801539:	39 c3                	cmp    %eax,%ebx
+  80153b:	7f 07                	jg     801544 <sysbatch_flush+0x39>
+  return 0;
+  80153d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801542:	eb d5                	jmp    801519 <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  801544:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801547:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  80154b:	85 db                	test   %ebx,%ebx
+  80154d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801552:	0f 49 d8             	cmovns %eax,%ebx
+  801555:	eb c2                	jmp    801519 <sysbatch_flush+0xe>
+    return r;
+  801557:	89 c3                	mov    %eax,%ebx
+  801559:	eb be                	jmp    801519 <sysbatch_flush+0xe>
+
+0080155b <sysbatch_add>:
+{
+  80155b:	55                   	push   %ebp
+  80155c:	89 e5                	mov    %esp,%ebp
+  80155e:	53                   	push   %ebx
+  80155f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  801562:	83 3b 40             	cmpl   $0x40,(%ebx)
+  801565:	74 41                	je     8015a8 <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  801567:	8b 03                	mov    (%ebx),%eax
+  801569:	8d 50 01             	lea    0x1(%eax),%edx
+  80156c:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  80156e:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801571:	01 d8                	add    %ebx,%eax
+  801573:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801576:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  801579:	8b 55 10             	mov    0x10(%ebp),%edx
+  80157c:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  80157f:	8b 55 14             	mov    0x14(%ebp),%edx
+  801582:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  801585:	8b 55 18             	mov    0x18(%ebp),%edx
+  801588:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  80158b:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  80158e:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  801591:	8b 55 20             	mov    0x20(%ebp),%edx
+  801594:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  801597:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  80159e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015a3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015a6:	c9                   	leave
+  8015a7:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  8015a8:	53                   	push   %ebx
+  8015a9:	e8 5d ff ff ff       	call   80150b <sysbatch_flush>
+  8015ae:	83 c4 04             	add    $0x4,%esp
+  8015b1:	85 c0                	test   %eax,%eax
+  8015b3:	79 b2                	jns    801567 <sysbatch_add+0xc>
+  8015b5:	eb ec                	jmp    8015a3 <sysbatch_add+0x48>
+
+008015b7 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8015b7:	55                   	push   %ebp
+  8015b8:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8015ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015bd:	05 00 00 00 30       	add    $0x30000000,%eax
+  8015c2:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8015c5:	5d                   	pop    %ebp
+  8015c6:	c3                   	ret
+
+008015c7 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8015c7:	55                   	push   %ebp
+  8015c8:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8015ca:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015cd:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  8015d0:	66 b8 00 00          	mov    $0x0,%ax
+  8015d4:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8015d9:	5d                   	pop    %ebp
+  8015da:	c3                   	ret
+
+008015db <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8015db:	55                   	push   %ebp
+  8015dc:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  8015de:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8015e3:	eb 02                	jmp    8015e7 <fd_alloc+0xc>
+  8015e5:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8015e7:	89 c2                	mov    %eax,%edx
+  8015e9:	c1 ea 16             	shr    $0x16,%edx
+  8015ec:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8015f3:	f6 c2 01             	test   $0x1,%dl
+  8015f6:	74 2b                	je     801623 <fd_alloc+0x48>
+  8015f8:	89 c2                	mov    %eax,%edx
+  8015fa:	c1 ea 0c             	shr    $0xc,%edx
+  8015fd:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801604:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80160a:	f6 c1 01             	test   $0x1,%cl
+  80160d:	74 14                	je     801623 <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  80160f:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801615:	75 ce                	jne    8015e5 <fd_alloc+0xa>
+  801617:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  80161c:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801621:	eb 05                	jmp    801628 <fd_alloc+0x4d>
+      return 0;
+  801623:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  801628:	8b 55 08             	mov    0x8(%ebp),%edx
+  80162b:	89 02                	mov    %eax,(%edx)
+}
+  80162d:	89 c8                	mov    %ecx,%eax
+  80162f:	5d                   	pop    %ebp
+  801630:	c3                   	ret
+
+00801631 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801631:	55                   	push   %ebp
+  801632:	89 e5                	mov    %esp,%ebp
+  801634:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  801637:	83 f8 1f             	cmp    $0x1f,%eax
+  80163a:	77 30                	ja     80166c <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  80163c:	c1 e0 0c             	shl    $0xc,%eax
+  80163f:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801644:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80164a:	f6 c2 01             	test   $0x1,%dl
+  80164d:	74 24                	je     801673 <fd_lookup+0x42>
+  80164f:	89 c2                	mov    %eax,%edx
+  801651:	c1 ea 0c             	shr    $0xc,%edx
+  801654:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80165b:	f6 c2 01             	test   $0x1,%dl
+  80165e:	74 1a                	je     80167a <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  801660:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801663:	89 02                	mov    %eax,(%edx)
+  return 0;
+  801665:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80166a:	5d                   	pop    %ebp
+  80166b:	c3                   	ret
+    return -E_INVAL;
+  80166c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801671:	eb f7                	jmp    80166a <fd_lookup+0x39>
+    return -E_INVAL;
+  801673:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801678:	eb f0                	jmp    80166a <fd_lookup+0x39>
+  80167a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80167f:	eb e9                	jmp    80166a <fd_lookup+0x39>
+
+00801681 <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801681:	55                   	push   %ebp
+  801682:	89 e5                	mov    %esp,%ebp
+  801684:	53                   	push   %ebx
+  801685:	83 ec 04             	sub    $0x4,%esp
+  801688:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  80168b:	b8 ec 3f 80 00       	mov    $0x803fec,%eax
+  801690:	8b 18                	mov    (%eax),%ebx
+  801692:	85 db                	test   %ebx,%ebx
+  801694:	74 0e                	je     8016a4 <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  801696:	83 c0 04             	add    $0x4,%eax
+  801699:	39 13                	cmp    %edx,(%ebx)
+  80169b:	75 f3                	jne    801690 <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  80169d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016a2:	eb 1f                	jmp    8016c3 <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8016a4:	a1 e0 97 80 00       	mov    0x8097e0,%eax
+  8016a9:	8b 40 48             	mov    0x48(%eax),%eax
+  8016ac:	83 ec 04             	sub    $0x4,%esp
+  8016af:	52                   	push   %edx
+  8016b0:	50                   	push   %eax
+  8016b1:	68 70 3f 80 00       	push   $0x803f70
+  8016b6:	e8 30 f0 ff ff       	call   8006eb <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  8016bb:	83 c4 10             	add    $0x10,%esp
+  8016be:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  8016c3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8016c6:	89 1a                	mov    %ebx,(%edx)
+}
+  8016c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8016cb:	c9                   	leave
+  8016cc:	c3                   	ret
+
+008016cd <fd_close>:
+{
+  8016cd:	55                   	push   %ebp
+  8016ce:	89 e5                	mov    %esp,%ebp
+  8016d0:	57                   	push   %edi
+  8016d1:	56                   	push   %esi
+  8016d2:	53                   	push   %ebx
+  8016d3:	83 ec 24             	sub    $0x24,%esp
+  8016d6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8016d9:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8016dc:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8016df:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8016e0:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8016e6:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8016e9:	50                   	push   %eax
+  8016ea:	e8 42 ff ff ff       	call   801631 <fd_lookup>
+  8016ef:	89 c3                	mov    %eax,%ebx
+  8016f1:	83 c4 10             	add    $0x10,%esp
+  8016f4:	85 c0                	test   %eax,%eax
+  8016f6:	78 05                	js     8016fd <fd_close+0x30>
+      || fd != fd2)
+  8016f8:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8016fb:	74 16                	je     801713 <fd_close+0x46>
+    return must_exist ? r : 0;
+  8016fd:	89 f8                	mov    %edi,%eax
+  8016ff:	84 c0                	test   %al,%al
+  801701:	b8 00 00 00 00       	mov    $0x0,%eax
+  801706:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801709:	89 d8                	mov    %ebx,%eax
+  80170b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80170e:	5b                   	pop    %ebx
+  80170f:	5e                   	pop    %esi
+  801710:	5f                   	pop    %edi
+  801711:	5d                   	pop    %ebp
+  801712:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801713:	83 ec 08             	sub    $0x8,%esp
+  801716:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801719:	50                   	push   %eax
+  80171a:	ff 36                	push   (%esi)
+  80171c:	e8 60 ff ff ff       	call   801681 <dev_lookup>
+  801721:	89 c3                	mov    %eax,%ebx
+  801723:	83 c4 10             	add    $0x10,%esp
+  801726:	85 c0                	test   %eax,%eax
+  801728:	78 1a                	js     801744 <fd_close+0x77>
+    if (dev->dev_close)
+  80172a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80172d:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  801730:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  801735:	85 c0                	test   %eax,%eax
+  801737:	74 0b                	je     801744 <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  801739:	83 ec 0c             	sub    $0xc,%esp
+  80173c:	56                   	push   %esi
+  80173d:	ff d0                	call   *%eax
+  80173f:	89 c3                	mov    %eax,%ebx
+  801741:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  801744:	83 ec 08             	sub    $0x8,%esp
+  801747:	56                   	push   %esi
+  801748:	6a 00                	push   $0x0
+  80174a:	e8 3e fa ff ff       	call   80118d <sys_page_unmap>
+  return r;
+  80174f:	83 c4 10             	add    $0x10,%esp
+  801752:	eb b5                	jmp    801709 <fd_close+0x3c>
+
+00801754 <close>:
+
+int
+close(int fdnum)
+{
+  801754:	55                   	push   %ebp
+  801755:	89 e5                	mov    %esp,%ebp
+  801757:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80175a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80175d:	50                   	push   %eax
+  80175e:	ff 75 08             	push   0x8(%ebp)
+  801761:	e8 cb fe ff ff       	call   801631 <fd_lookup>
+  801766:	83 c4 10             	add    $0x10,%esp
+  801769:	85 c0                	test   %eax,%eax
+  80176b:	79 02                	jns    80176f <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  80176d:	c9                   	leave
+  80176e:	c3                   	ret
+    return fd_close(fd, 1);
+  80176f:	83 ec 08             	sub    $0x8,%esp
+  801772:	6a 01                	push   $0x1
+  801774:	ff 75 f4             	push   -0xc(%ebp)
+  801777:	e8 51 ff ff ff       	call   8016cd <fd_close>
+  80177c:	83 c4 10             	add    $0x10,%esp
+  80177f:	eb ec                	jmp    80176d <close+0x19>
+
+00801781 <close_all>:
+
+void
+close_all(void)
+{
+  801781:	55                   	push   %ebp
+  801782:	89 e5                	mov    %esp,%ebp
+  801784:	53                   	push   %ebx
+  801785:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  801788:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  80178d:	83 ec 0c             	sub    $0xc,%esp
+  801790:	53                   	push   %ebx
+  801791:	e8 be ff ff ff       	call   801754 <close>
+  for (i = 0; i < MAXFD; i++)
+  801796:	83 c3 01             	add    $0x1,%ebx
+  801799:	83 c4 10             	add    $0x10,%esp
+  80179c:	83 fb 20             	cmp    $0x20,%ebx
+  80179f:	75 ec                	jne    80178d <close_all+0xc>
+}
+  8017a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017a4:	c9                   	leave
+  8017a5:	c3                   	ret
+
+008017a6 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8017a6:	55                   	push   %ebp
+  8017a7:	89 e5                	mov    %esp,%ebp
+  8017a9:	57                   	push   %edi
+  8017aa:	56                   	push   %esi
+  8017ab:	53                   	push   %ebx
+  8017ac:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8017af:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8017b2:	50                   	push   %eax
+  8017b3:	ff 75 08             	push   0x8(%ebp)
+  8017b6:	e8 76 fe ff ff       	call   801631 <fd_lookup>
+  8017bb:	89 c6                	mov    %eax,%esi
+  8017bd:	83 c4 10             	add    $0x10,%esp
+  8017c0:	85 c0                	test   %eax,%eax
+  8017c2:	0f 88 0a 01 00 00    	js     8018d2 <dup+0x12c>
+    return r;
+  close(newfdnum);
+  8017c8:	83 ec 0c             	sub    $0xc,%esp
+  8017cb:	ff 75 0c             	push   0xc(%ebp)
+  8017ce:	e8 81 ff ff ff       	call   801754 <close>
+
+  newfd = INDEX2FD(newfdnum);
+  8017d3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8017d6:	c1 e0 0c             	shl    $0xc,%eax
+  8017d9:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  8017df:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  8017e2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8017e5:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8017e8:	89 04 24             	mov    %eax,(%esp)
+  8017eb:	e8 d7 fd ff ff       	call   8015c7 <fd2data>
+  8017f0:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  8017f2:	89 3c 24             	mov    %edi,(%esp)
+  8017f5:	e8 cd fd ff ff       	call   8015c7 <fd2data>
+  8017fa:	83 c4 10             	add    $0x10,%esp
+  8017fd:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801800:	89 f3                	mov    %esi,%ebx
+  801802:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  801808:	89 c6                	mov    %eax,%esi
+  80180a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80180d:	89 cf                	mov    %ecx,%edi
+  80180f:	eb 0c                	jmp    80181d <dup+0x77>
+  801811:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801817:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80181d:	39 fb                	cmp    %edi,%ebx
+  80181f:	74 7b                	je     80189c <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  801821:	89 d8                	mov    %ebx,%eax
+  801823:	c1 e8 16             	shr    $0x16,%eax
+  801826:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80182d:	a8 01                	test   $0x1,%al
+  80182f:	74 e0                	je     801811 <dup+0x6b>
+  801831:	89 d8                	mov    %ebx,%eax
+  801833:	c1 e8 0c             	shr    $0xc,%eax
+  801836:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80183d:	f6 c2 01             	test   $0x1,%dl
+  801840:	74 cf                	je     801811 <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  801842:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  801849:	83 ec 0c             	sub    $0xc,%esp
+  80184c:	25 07 0e 00 00       	and    $0xe07,%eax
+  801851:	50                   	push   %eax
+  801852:	56                   	push   %esi
+  801853:	6a 00                	push   $0x0
+  801855:	53                   	push   %ebx
+  801856:	6a 00                	push   $0x0
+  801858:	e8 ee f8 ff ff       	call   80114b <sys_page_map>
+  80185d:	83 c4 20             	add    $0x20,%esp
+  801860:	85 c0                	test   %eax,%eax
+  801862:	79 ad                	jns    801811 <dup+0x6b>
+  801864:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801867:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  801869:	83 ec 08             	sub    $0x8,%esp
+  80186c:	ff 75 d4             	push   -0x2c(%ebp)
+  80186f:	6a 00                	push   $0x0
+  801871:	e8 17 f9 ff ff       	call   80118d <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801876:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  801879:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  80187f:	83 c4 10             	add    $0x10,%esp
+  801882:	39 df                	cmp    %ebx,%edi
+  801884:	74 4c                	je     8018d2 <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  801886:	83 ec 08             	sub    $0x8,%esp
+  801889:	57                   	push   %edi
+  80188a:	6a 00                	push   $0x0
+  80188c:	e8 fc f8 ff ff       	call   80118d <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801891:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  801897:	83 c4 10             	add    $0x10,%esp
+  80189a:	eb e6                	jmp    801882 <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80189c:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80189f:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8018a2:	89 c8                	mov    %ecx,%eax
+  8018a4:	c1 e8 0c             	shr    $0xc,%eax
+  8018a7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8018ae:	83 ec 0c             	sub    $0xc,%esp
+  8018b1:	25 07 0e 00 00       	and    $0xe07,%eax
+  8018b6:	50                   	push   %eax
+  8018b7:	ff 75 d4             	push   -0x2c(%ebp)
+  8018ba:	6a 00                	push   $0x0
+  8018bc:	51                   	push   %ecx
+  8018bd:	6a 00                	push   $0x0
+  8018bf:	e8 87 f8 ff ff       	call   80114b <sys_page_map>
+  8018c4:	89 c6                	mov    %eax,%esi
+  8018c6:	83 c4 20             	add    $0x20,%esp
+  8018c9:	85 c0                	test   %eax,%eax
+  8018cb:	78 9c                	js     801869 <dup+0xc3>
+  return newfdnum;
+  8018cd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8018d0:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  8018d2:	89 f0                	mov    %esi,%eax
+  8018d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018d7:	5b                   	pop    %ebx
+  8018d8:	5e                   	pop    %esi
+  8018d9:	5f                   	pop    %edi
+  8018da:	5d                   	pop    %ebp
+  8018db:	c3                   	ret
+
+008018dc <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8018dc:	55                   	push   %ebp
+  8018dd:	89 e5                	mov    %esp,%ebp
+  8018df:	56                   	push   %esi
+  8018e0:	53                   	push   %ebx
+  8018e1:	83 ec 18             	sub    $0x18,%esp
+  8018e4:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  8018e7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018ea:	50                   	push   %eax
+  8018eb:	56                   	push   %esi
+  8018ec:	e8 40 fd ff ff       	call   801631 <fd_lookup>
+  8018f1:	83 c4 10             	add    $0x10,%esp
+  8018f4:	85 c0                	test   %eax,%eax
+  8018f6:	78 3c                	js     801934 <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8018f8:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8018fb:	83 ec 08             	sub    $0x8,%esp
+  8018fe:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801901:	50                   	push   %eax
+  801902:	ff 33                	push   (%ebx)
+  801904:	e8 78 fd ff ff       	call   801681 <dev_lookup>
+  801909:	83 c4 10             	add    $0x10,%esp
+  80190c:	85 c0                	test   %eax,%eax
+  80190e:	78 24                	js     801934 <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801910:	8b 43 08             	mov    0x8(%ebx),%eax
+  801913:	83 e0 03             	and    $0x3,%eax
+  801916:	83 f8 01             	cmp    $0x1,%eax
+  801919:	74 20                	je     80193b <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  80191b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80191e:	8b 40 08             	mov    0x8(%eax),%eax
+  801921:	85 c0                	test   %eax,%eax
+  801923:	74 37                	je     80195c <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  801925:	83 ec 04             	sub    $0x4,%esp
+  801928:	ff 75 10             	push   0x10(%ebp)
+  80192b:	ff 75 0c             	push   0xc(%ebp)
+  80192e:	53                   	push   %ebx
+  80192f:	ff d0                	call   *%eax
+  801931:	83 c4 10             	add    $0x10,%esp
+}
+  801934:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801937:	5b                   	pop    %ebx
+  801938:	5e                   	pop    %esi
+  801939:	5d                   	pop    %ebp
+  80193a:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80193b:	a1 e0 97 80 00       	mov    0x8097e0,%eax
+  801940:	8b 40 48             	mov    0x48(%eax),%eax
+  801943:	83 ec 04             	sub    $0x4,%esp
+  801946:	56                   	push   %esi
+  801947:	50                   	push   %eax
+  801948:	68 b1 3f 80 00       	push   $0x803fb1
+  80194d:	e8 99 ed ff ff       	call   8006eb <cprintf>
+    return -E_INVAL;
+  801952:	83 c4 10             	add    $0x10,%esp
+  801955:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80195a:	eb d8                	jmp    801934 <read+0x58>
+    return -E_NOT_SUPP;
+  80195c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801961:	eb d1                	jmp    801934 <read+0x58>
+
+00801963 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801963:	55                   	push   %ebp
+  801964:	89 e5                	mov    %esp,%ebp
+  801966:	57                   	push   %edi
+  801967:	56                   	push   %esi
+  801968:	53                   	push   %ebx
+  801969:	83 ec 0c             	sub    $0xc,%esp
+  80196c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80196f:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  801972:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801977:	eb 02                	jmp    80197b <readn+0x18>
+  801979:	01 c3                	add    %eax,%ebx
+  80197b:	39 f3                	cmp    %esi,%ebx
+  80197d:	73 21                	jae    8019a0 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  80197f:	83 ec 04             	sub    $0x4,%esp
+  801982:	89 f0                	mov    %esi,%eax
+  801984:	29 d8                	sub    %ebx,%eax
+  801986:	50                   	push   %eax
+  801987:	89 d8                	mov    %ebx,%eax
+  801989:	03 45 0c             	add    0xc(%ebp),%eax
+  80198c:	50                   	push   %eax
+  80198d:	57                   	push   %edi
+  80198e:	e8 49 ff ff ff       	call   8018dc <read>
+    if (m < 0)
+  801993:	83 c4 10             	add    $0x10,%esp
+  801996:	85 c0                	test   %eax,%eax
+  801998:	78 04                	js     80199e <readn+0x3b>
+      return m;
+    if (m == 0)
+  80199a:	75 dd                	jne    801979 <readn+0x16>
+  80199c:	eb 02                	jmp    8019a0 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  80199e:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  8019a0:	89 d8                	mov    %ebx,%eax
+  8019a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019a5:	5b                   	pop    %ebx
+  8019a6:	5e                   	pop    %esi
+  8019a7:	5f                   	pop    %edi
+  8019a8:	5d                   	pop    %ebp
+  8019a9:	c3                   	ret
+
+008019aa <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8019aa:	55                   	push   %ebp
+  8019ab:	89 e5                	mov    %esp,%ebp
+  8019ad:	56                   	push   %esi
+  8019ae:	53                   	push   %ebx
+  8019af:	83 ec 18             	sub    $0x18,%esp
+  8019b2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  8019b5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8019b8:	50                   	push   %eax
+  8019b9:	53                   	push   %ebx
+  8019ba:	e8 72 fc ff ff       	call   801631 <fd_lookup>
+  8019bf:	83 c4 10             	add    $0x10,%esp
+  8019c2:	85 c0                	test   %eax,%eax
+  8019c4:	78 37                	js     8019fd <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8019c6:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8019c9:	83 ec 08             	sub    $0x8,%esp
+  8019cc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019cf:	50                   	push   %eax
+  8019d0:	ff 36                	push   (%esi)
+  8019d2:	e8 aa fc ff ff       	call   801681 <dev_lookup>
+  8019d7:	83 c4 10             	add    $0x10,%esp
+  8019da:	85 c0                	test   %eax,%eax
+  8019dc:	78 1f                	js     8019fd <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8019de:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8019e2:	74 20                	je     801a04 <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  8019e4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019e7:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019ea:	85 c0                	test   %eax,%eax
+  8019ec:	74 37                	je     801a25 <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  8019ee:	83 ec 04             	sub    $0x4,%esp
+  8019f1:	ff 75 10             	push   0x10(%ebp)
+  8019f4:	ff 75 0c             	push   0xc(%ebp)
+  8019f7:	56                   	push   %esi
+  8019f8:	ff d0                	call   *%eax
+  8019fa:	83 c4 10             	add    $0x10,%esp
+}
+  8019fd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a00:	5b                   	pop    %ebx
+  801a01:	5e                   	pop    %esi
+  801a02:	5d                   	pop    %ebp
+  801a03:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801a04:	a1 e0 97 80 00       	mov    0x8097e0,%eax
+  801a09:	8b 40 48             	mov    0x48(%eax),%eax
+  801a0c:	83 ec 04             	sub    $0x4,%esp
+  801a0f:	53                   	push   %ebx
+  801a10:	50                   	push   %eax
+  801a11:	68 cd 3f 80 00       	push   $0x803fcd
+  801a16:	e8 d0 ec ff ff       	call   8006eb <cprintf>
+    return -E_INVAL;
+  801a1b:	83 c4 10             	add    $0x10,%esp
+  801a1e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a23:	eb d8                	jmp    8019fd <write+0x53>
+    return -E_NOT_SUPP;
+  801a25:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a2a:	eb d1                	jmp    8019fd <write+0x53>
+
+00801a2c <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801a2c:	55                   	push   %ebp
+  801a2d:	89 e5                	mov    %esp,%ebp
+  801a2f:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801a32:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a35:	50                   	push   %eax
+  801a36:	ff 75 08             	push   0x8(%ebp)
+  801a39:	e8 f3 fb ff ff       	call   801631 <fd_lookup>
+  801a3e:	83 c4 10             	add    $0x10,%esp
+  801a41:	85 c0                	test   %eax,%eax
+  801a43:	78 0e                	js     801a53 <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  801a45:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a48:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a4b:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  801a4e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a53:	c9                   	leave
+  801a54:	c3                   	ret
+
+00801a55 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801a55:	55                   	push   %ebp
+  801a56:	89 e5                	mov    %esp,%ebp
+  801a58:	56                   	push   %esi
+  801a59:	53                   	push   %ebx
+  801a5a:	83 ec 18             	sub    $0x18,%esp
+  801a5d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a60:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a63:	50                   	push   %eax
+  801a64:	53                   	push   %ebx
+  801a65:	e8 c7 fb ff ff       	call   801631 <fd_lookup>
+  801a6a:	83 c4 10             	add    $0x10,%esp
+  801a6d:	85 c0                	test   %eax,%eax
+  801a6f:	78 34                	js     801aa5 <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801a71:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801a74:	83 ec 08             	sub    $0x8,%esp
+  801a77:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a7a:	50                   	push   %eax
+  801a7b:	ff 36                	push   (%esi)
+  801a7d:	e8 ff fb ff ff       	call   801681 <dev_lookup>
+  801a82:	83 c4 10             	add    $0x10,%esp
+  801a85:	85 c0                	test   %eax,%eax
+  801a87:	78 1c                	js     801aa5 <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801a89:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801a8d:	74 1d                	je     801aac <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  801a8f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a92:	8b 40 18             	mov    0x18(%eax),%eax
+  801a95:	85 c0                	test   %eax,%eax
+  801a97:	74 34                	je     801acd <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  801a99:	83 ec 08             	sub    $0x8,%esp
+  801a9c:	ff 75 0c             	push   0xc(%ebp)
+  801a9f:	56                   	push   %esi
+  801aa0:	ff d0                	call   *%eax
+  801aa2:	83 c4 10             	add    $0x10,%esp
+}
+  801aa5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801aa8:	5b                   	pop    %ebx
+  801aa9:	5e                   	pop    %esi
+  801aaa:	5d                   	pop    %ebp
+  801aab:	c3                   	ret
+            thisenv->env_id, fdnum);
+  801aac:	a1 e0 97 80 00       	mov    0x8097e0,%eax
+  801ab1:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801ab4:	83 ec 04             	sub    $0x4,%esp
+  801ab7:	53                   	push   %ebx
+  801ab8:	50                   	push   %eax
+  801ab9:	68 90 3f 80 00       	push   $0x803f90
+  801abe:	e8 28 ec ff ff       	call   8006eb <cprintf>
+    return -E_INVAL;
+  801ac3:	83 c4 10             	add    $0x10,%esp
+  801ac6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801acb:	eb d8                	jmp    801aa5 <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  801acd:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ad2:	eb d1                	jmp    801aa5 <ftruncate+0x50>
+
+00801ad4 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801ad4:	55                   	push   %ebp
+  801ad5:	89 e5                	mov    %esp,%ebp
+  801ad7:	56                   	push   %esi
+  801ad8:	53                   	push   %ebx
+  801ad9:	83 ec 18             	sub    $0x18,%esp
+  801adc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801adf:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ae2:	50                   	push   %eax
+  801ae3:	ff 75 08             	push   0x8(%ebp)
+  801ae6:	e8 46 fb ff ff       	call   801631 <fd_lookup>
+  801aeb:	83 c4 10             	add    $0x10,%esp
+  801aee:	85 c0                	test   %eax,%eax
+  801af0:	78 49                	js     801b3b <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801af2:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801af5:	83 ec 08             	sub    $0x8,%esp
+  801af8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801afb:	50                   	push   %eax
+  801afc:	ff 36                	push   (%esi)
+  801afe:	e8 7e fb ff ff       	call   801681 <dev_lookup>
+  801b03:	83 c4 10             	add    $0x10,%esp
+  801b06:	85 c0                	test   %eax,%eax
+  801b08:	78 31                	js     801b3b <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  801b0a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b0d:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801b11:	74 2f                	je     801b42 <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  801b13:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  801b16:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801b1d:	00 00 00 
+  stat->st_isdir = 0;
+  801b20:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801b27:	00 00 00 
+  stat->st_dev = dev;
+  801b2a:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  801b30:	83 ec 08             	sub    $0x8,%esp
+  801b33:	53                   	push   %ebx
+  801b34:	56                   	push   %esi
+  801b35:	ff 50 14             	call   *0x14(%eax)
+  801b38:	83 c4 10             	add    $0x10,%esp
+}
+  801b3b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b3e:	5b                   	pop    %ebx
+  801b3f:	5e                   	pop    %esi
+  801b40:	5d                   	pop    %ebp
+  801b41:	c3                   	ret
+    return -E_NOT_SUPP;
+  801b42:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b47:	eb f2                	jmp    801b3b <fstat+0x67>
+
+00801b49 <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  801b49:	55                   	push   %ebp
+  801b4a:	89 e5                	mov    %esp,%ebp
+  801b4c:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  801b4f:	ff 75 0c             	push   0xc(%ebp)
+  801b52:	ff 75 08             	push   0x8(%ebp)
+  801b55:	e8 58 07 00 00       	call   8022b2 <file_stat>
+}
+  801b5a:	c9                   	leave
+  801b5b:	c3                   	ret
+
+00801b5c <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  801b5c:	55                   	push   %ebp
+  801b5d:	89 e5                	mov    %esp,%ebp
+  801b5f:	57                   	push   %edi
+  801b60:	56                   	push   %esi
+  801b61:	53                   	push   %ebx
+  801b62:	83 ec 1c             	sub    $0x1c,%esp
+  801b65:	89 c7                	mov    %eax,%edi
+  801b67:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801b6a:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801b6d:	e9 a2 00 00 00       	jmp    801c14 <fsipc_send+0xb8>
+  nfsenvs = 0;
+  801b72:	c7 05 40 8f 80 00 00 	movl   $0x0,0x808f40
+  801b79:	00 00 00 
+  801b7c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b81:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801b86:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801b8b:	be 01 00 00 00       	mov    $0x1,%esi
+  801b90:	eb 0f                	jmp    801ba1 <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801b92:	83 c0 01             	add    $0x1,%eax
+  801b95:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801b9a:	74 49                	je     801be5 <fsipc_send+0x89>
+  801b9c:	83 f9 07             	cmp    $0x7,%ecx
+  801b9f:	7f 50                	jg     801bf1 <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  801ba1:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801ba4:	c1 e2 04             	shl    $0x4,%edx
+  801ba7:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801bad:	8b 52 50             	mov    0x50(%edx),%edx
+  801bb0:	83 fa 01             	cmp    $0x1,%edx
+  801bb3:	75 dd                	jne    801b92 <fsipc_send+0x36>
+  801bb5:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801bb8:	c1 e2 04             	shl    $0x4,%edx
+  801bbb:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801bc1:	8b 52 54             	mov    0x54(%edx),%edx
+  801bc4:	85 d2                	test   %edx,%edx
+  801bc6:	74 ca                	je     801b92 <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801bc8:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801bcb:	c1 e2 04             	shl    $0x4,%edx
+  801bce:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801bd4:	8b 52 48             	mov    0x48(%edx),%edx
+  801bd7:	89 14 8d 60 8f 80 00 	mov    %edx,0x808f60(,%ecx,4)
+  801bde:	8d 49 01             	lea    0x1(%ecx),%ecx
+  801be1:	89 f3                	mov    %esi,%ebx
+  801be3:	eb ad                	jmp    801b92 <fsipc_send+0x36>
+  801be5:	84 db                	test   %bl,%bl
+  801be7:	74 38                	je     801c21 <fsipc_send+0xc5>
+  801be9:	89 0d 40 8f 80 00    	mov    %ecx,0x808f40
+  801bef:	eb 30                	jmp    801c21 <fsipc_send+0xc5>
+  801bf1:	84 db                	test   %bl,%bl
+  801bf3:	74 2c                	je     801c21 <fsipc_send+0xc5>
+  801bf5:	89 0d 40 8f 80 00    	mov    %ecx,0x808f40
+  801bfb:	eb 24                	jmp    801c21 <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  801bfd:	50                   	push   %eax
+  801bfe:	68 fc 3f 80 00       	push   $0x803ffc
+  801c03:	6a 34                	push   $0x34
+  801c05:	68 06 40 80 00       	push   $0x804006
+  801c0a:	e8 01 ea ff ff       	call   800610 <_panic>
+    }
+    sys_yield();
+  801c0f:	e8 92 f4 ff ff       	call   8010a6 <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  801c14:	83 3d 40 8f 80 00 03 	cmpl   $0x3,0x808f40
+  801c1b:	0f 8e 51 ff ff ff    	jle    801b72 <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  801c21:	a1 e0 97 80 00       	mov    0x8097e0,%eax
+  801c26:	8b 70 48             	mov    0x48(%eax),%esi
+  801c29:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  801c2f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c34:	8b 0d 40 8f 80 00    	mov    0x808f40,%ecx
+  801c3a:	39 d9                	cmp    %ebx,%ecx
+  801c3c:	7e d1                	jle    801c0f <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  801c3e:	83 ec 0c             	sub    $0xc,%esp
+  801c41:	ff 75 e0             	push   -0x20(%ebp)
+  801c44:	6a 07                	push   $0x7
+  801c46:	ff 75 e4             	push   -0x1c(%ebp)
+  801c49:	57                   	push   %edi
+  801c4a:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  801c4d:	99                   	cltd
+  801c4e:	f7 f9                	idiv   %ecx
+  801c50:	ff 34 95 60 8f 80 00 	push   0x808f60(,%edx,4)
+  801c57:	e8 63 f7 ff ff       	call   8013bf <sys_ipc_try_send>
+      if (r == 0)
+  801c5c:	83 c4 20             	add    $0x20,%esp
+  801c5f:	85 c0                	test   %eax,%eax
+  801c61:	74 0a                	je     801c6d <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  801c63:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801c66:	75 95                	jne    801bfd <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  801c68:	83 c3 01             	add    $0x1,%ebx
+  801c6b:	eb c7                	jmp    801c34 <fsipc_send+0xd8>
+  }
+}
+  801c6d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c70:	5b                   	pop    %ebx
+  801c71:	5e                   	pop    %esi
+  801c72:	5f                   	pop    %edi
+  801c73:	5d                   	pop    %ebp
+  801c74:	c3                   	ret
+
+00801c75 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801c75:	55                   	push   %ebp
+  801c76:	89 e5                	mov    %esp,%ebp
+  801c78:	53                   	push   %ebx
+  801c79:	83 ec 14             	sub    $0x14,%esp
+  801c7c:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  801c7e:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  801c85:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801c8a:	ba 00 a0 80 00       	mov    $0x80a000,%edx
+  801c8f:	e8 c8 fe ff ff       	call   801b5c <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801c94:	6a 00                	push   $0x0
+  801c96:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c99:	50                   	push   %eax
+  801c9a:	53                   	push   %ebx
+  801c9b:	6a 00                	push   $0x0
+  801c9d:	e8 a7 19 00 00       	call   803649 <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  801ca2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ca5:	c9                   	leave
+  801ca6:	c3                   	ret
+
+00801ca7 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801ca7:	55                   	push   %ebp
+  801ca8:	89 e5                	mov    %esp,%ebp
+  801caa:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801cad:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cb0:	8b 40 0c             	mov    0xc(%eax),%eax
+  801cb3:	a3 00 a0 80 00       	mov    %eax,0x80a000
+  fsipcbuf.set_size.req_size = newsize;
+  801cb8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801cbb:	a3 04 a0 80 00       	mov    %eax,0x80a004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801cc0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cc5:	b8 02 00 00 00       	mov    $0x2,%eax
+  801cca:	e8 a6 ff ff ff       	call   801c75 <fsipc>
+}
+  801ccf:	c9                   	leave
+  801cd0:	c3                   	ret
+
+00801cd1 <devfile_flush>:
+{
+  801cd1:	55                   	push   %ebp
+  801cd2:	89 e5                	mov    %esp,%ebp
+  801cd4:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801cd7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cda:	8b 40 0c             	mov    0xc(%eax),%eax
+  801cdd:	a3 00 a0 80 00       	mov    %eax,0x80a000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801ce2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ce7:	b8 06 00 00 00       	mov    $0x6,%eax
+  801cec:	e8 84 ff ff ff       	call   801c75 <fsipc>
+}
+  801cf1:	c9                   	leave
+  801cf2:	c3                   	ret
+
+00801cf3 <devfile_stat>:
+{
+  801cf3:	55                   	push   %ebp
+  801cf4:	89 e5                	mov    %esp,%ebp
+  801cf6:	53                   	push   %ebx
+  801cf7:	83 ec 04             	sub    $0x4,%esp
+  801cfa:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801cfd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d00:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d03:	a3 00 a0 80 00       	mov    %eax,0x80a000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801d08:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d0d:	b8 05 00 00 00       	mov    $0x5,%eax
+  801d12:	e8 5e ff ff ff       	call   801c75 <fsipc>
+  801d17:	85 c0                	test   %eax,%eax
+  801d19:	78 2c                	js     801d47 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801d1b:	83 ec 08             	sub    $0x8,%esp
+  801d1e:	68 00 a0 80 00       	push   $0x80a000
+  801d23:	53                   	push   %ebx
+  801d24:	e8 b0 ef ff ff       	call   800cd9 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  801d29:	a1 80 a0 80 00       	mov    0x80a080,%eax
+  801d2e:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801d34:	a1 84 a0 80 00       	mov    0x80a084,%eax
+  801d39:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801d3f:	83 c4 10             	add    $0x10,%esp
+  801d42:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d47:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d4a:	c9                   	leave
+  801d4b:	c3                   	ret
+
+00801d4c <fsv_alloc>:
+{
+  801d4c:	55                   	push   %ebp
+  801d4d:	89 e5                	mov    %esp,%ebp
+  801d4f:	56                   	push   %esi
+  801d50:	53                   	push   %ebx
+  801d51:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  801d53:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d58:	eb 22                	jmp    801d7c <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  801d5a:	83 ec 04             	sub    $0x4,%esp
+  801d5d:	6a 00                	push   $0x0
+  801d5f:	6a 00                	push   $0x0
+  801d61:	6a 07                	push   $0x7
+  801d63:	50                   	push   %eax
+  801d64:	6a 00                	push   $0x0
+  801d66:	6a 04                	push   $0x4
+  801d68:	68 80 8f 80 00       	push   $0x808f80
+  801d6d:	e8 e9 f7 ff ff       	call   80155b <sysbatch_add>
+  801d72:	83 c4 20             	add    $0x20,%esp
+  801d75:	85 c0                	test   %eax,%eax
+  801d77:	78 48                	js     801dc1 <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  801d79:	83 c3 01             	add    $0x1,%ebx
+  801d7c:	39 f3                	cmp    %esi,%ebx
+  801d7e:	74 31                	je     801db1 <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  801d80:	89 d8                	mov    %ebx,%eax
+  801d82:	c1 e0 0c             	shl    $0xc,%eax
+  801d85:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801d8a:	89 c2                	mov    %eax,%edx
+  801d8c:	c1 ea 16             	shr    $0x16,%edx
+  801d8f:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801d96:	f6 c2 01             	test   $0x1,%dl
+  801d99:	74 bf                	je     801d5a <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  801d9b:	89 c2                	mov    %eax,%edx
+  801d9d:	c1 ea 0c             	shr    $0xc,%edx
+  801da0:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801da7:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801daa:	83 fa 03             	cmp    $0x3,%edx
+  801dad:	75 ab                	jne    801d5a <fsv_alloc+0xe>
+  801daf:	eb c8                	jmp    801d79 <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  801db1:	83 ec 0c             	sub    $0xc,%esp
+  801db4:	68 80 8f 80 00       	push   $0x808f80
+  801db9:	e8 4d f7 ff ff       	call   80150b <sysbatch_flush>
+  801dbe:	83 c4 10             	add    $0x10,%esp
+}
+  801dc1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801dc4:	5b                   	pop    %ebx
+  801dc5:	5e                   	pop    %esi
+  801dc6:	5d                   	pop    %ebp
+  801dc7:	c3                   	ret
+
+00801dc8 <devfile_read>:
+{
+  801dc8:	55                   	push   %ebp
+  801dc9:	89 e5                	mov    %esp,%ebp
+  801dcb:	57                   	push   %edi
+  801dcc:	56                   	push   %esi
+  801dcd:	53                   	push   %ebx
+  801dce:	83 ec 3c             	sub    $0x3c,%esp
+  801dd1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  801dd4:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  801dda:	77 57                	ja     801e33 <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801ddc:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ddf:	8b 40 0c             	mov    0xc(%eax),%eax
+  801de2:	a3 00 a0 80 00       	mov    %eax,0x80a000
+  fsipcbuf.read.req_n = n;
+  801de7:	89 1d 04 a0 80 00    	mov    %ebx,0x80a004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801ded:	ba 00 00 00 00       	mov    $0x0,%edx
+  801df2:	b8 03 00 00 00       	mov    $0x3,%eax
+  801df7:	e8 79 fe ff ff       	call   801c75 <fsipc>
+  801dfc:	89 c6                	mov    %eax,%esi
+  801dfe:	85 c0                	test   %eax,%eax
+  801e00:	78 27                	js     801e29 <devfile_read+0x61>
+  assert(r <= n);
+  801e02:	39 c3                	cmp    %eax,%ebx
+  801e04:	0f 82 0e 02 00 00    	jb     802018 <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  801e0a:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801e0f:	0f 8f 1c 02 00 00    	jg     802031 <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801e15:	83 ec 04             	sub    $0x4,%esp
+  801e18:	50                   	push   %eax
+  801e19:	68 00 a0 80 00       	push   $0x80a000
+  801e1e:	ff 75 0c             	push   0xc(%ebp)
+  801e21:	e8 39 f0 ff ff       	call   800e5f <memmove>
+  return r;
+  801e26:	83 c4 10             	add    $0x10,%esp
+}
+  801e29:	89 f0                	mov    %esi,%eax
+  801e2b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e2e:	5b                   	pop    %ebx
+  801e2f:	5e                   	pop    %esi
+  801e30:	5f                   	pop    %edi
+  801e31:	5d                   	pop    %ebp
+  801e32:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  801e33:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e38:	e8 0f ff ff ff       	call   801d4c <fsv_alloc>
+  801e3d:	89 c6                	mov    %eax,%esi
+  801e3f:	85 c0                	test   %eax,%eax
+  801e41:	78 e6                	js     801e29 <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  801e43:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e46:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e49:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  801e4e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e51:	8b 40 04             	mov    0x4(%eax),%eax
+  801e54:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  801e59:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  801e5f:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801e66:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801e6b:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801e70:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801e75:	e8 e2 fc ff ff       	call   801b5c <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801e7a:	6a 00                	push   $0x0
+  801e7c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801e7f:	50                   	push   %eax
+  801e80:	68 00 10 c0 9f       	push   $0x9fc01000
+  801e85:	6a 00                	push   $0x0
+  801e87:	e8 bd 17 00 00       	call   803649 <ipc_recv_pages>
+  801e8c:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  801e8e:	83 c4 10             	add    $0x10,%esp
+  801e91:	85 c0                	test   %eax,%eax
+  801e93:	7e 94                	jle    801e29 <devfile_read+0x61>
+  assert(r <= n);
+  801e95:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801e98:	39 c3                	cmp    %eax,%ebx
+  801e9a:	72 2e                	jb     801eca <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801e9c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e9f:	8b 40 04             	mov    0x4(%eax),%eax
+  801ea2:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801ea7:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  801eaa:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801ead:	c1 e2 0c             	shl    $0xc,%edx
+  801eb0:	39 ca                	cmp    %ecx,%edx
+  801eb2:	72 2f                	jb     801ee3 <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  801eb4:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  801eb9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  801ebc:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  801ec0:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801ec5:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  801ec8:	eb 52                	jmp    801f1c <devfile_read+0x154>
+  assert(r <= n);
+  801eca:	68 11 40 80 00       	push   $0x804011
+  801ecf:	68 18 40 80 00       	push   $0x804018
+  801ed4:	68 49 01 00 00       	push   $0x149
+  801ed9:	68 06 40 80 00       	push   $0x804006
+  801ede:	e8 2d e7 ff ff       	call   800610 <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801ee3:	68 3c 40 80 00       	push   $0x80403c
+  801ee8:	68 18 40 80 00       	push   $0x804018
+  801eed:	68 4a 01 00 00       	push   $0x14a
+  801ef2:	68 06 40 80 00       	push   $0x804006
+  801ef7:	e8 14 e7 ff ff       	call   800610 <_panic>
+      memmove(dst + done, src + done, m);
+  801efc:	83 ec 04             	sub    $0x4,%esp
+  801eff:	53                   	push   %ebx
+  801f00:	56                   	push   %esi
+  801f01:	89 f8                	mov    %edi,%eax
+  801f03:	03 45 0c             	add    0xc(%ebp),%eax
+  801f06:	50                   	push   %eax
+  801f07:	e8 53 ef ff ff       	call   800e5f <memmove>
+  801f0c:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  801f0f:	01 df                	add    %ebx,%edi
+  801f11:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801f14:	39 c7                	cmp    %eax,%edi
+  801f16:	0f 83 c0 00 00 00    	jae    801fdc <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801f1c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801f1f:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  801f22:	89 f0                	mov    %esi,%eax
+  801f24:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801f29:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  801f2e:	29 c3                	sub    %eax,%ebx
+  801f30:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801f33:	29 f8                	sub    %edi,%eax
+  801f35:	39 c3                	cmp    %eax,%ebx
+  801f37:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  801f3a:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801f40:	75 ba                	jne    801efc <devfile_read+0x134>
+  801f42:	89 f9                	mov    %edi,%ecx
+  801f44:	03 4d 0c             	add    0xc(%ebp),%ecx
+  801f47:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  801f4a:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  801f50:	75 aa                	jne    801efc <devfile_read+0x134>
+  801f52:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  801f58:	77 a2                	ja     801efc <devfile_read+0x134>
+  801f5a:	89 c8                	mov    %ecx,%eax
+  801f5c:	c1 e8 16             	shr    $0x16,%eax
+  801f5f:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801f66:	a8 01                	test   $0x1,%al
+  801f68:	74 92                	je     801efc <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  801f6a:	89 c8                	mov    %ecx,%eax
+  801f6c:	c1 e8 0c             	shr    $0xc,%eax
+  801f6f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  801f76:	a8 01                	test   $0x1,%al
+  801f78:	74 82                	je     801efc <devfile_read+0x134>
+  801f7a:	a9 02 08 00 00       	test   $0x802,%eax
+  801f7f:	0f 84 77 ff ff ff    	je     801efc <devfile_read+0x134>
+  801f85:	f6 c4 04             	test   $0x4,%ah
+  801f88:	0f 85 6e ff ff ff    	jne    801efc <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  801f8e:	a1 e0 97 80 00       	mov    0x8097e0,%eax
+  801f93:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  801f97:	84 c0                	test   %al,%al
+  801f99:	75 17                	jne    801fb2 <devfile_read+0x1ea>
+  801f9b:	83 ec 08             	sub    $0x8,%esp
+  801f9e:	6a 01                	push   $0x1
+  801fa0:	6a 00                	push   $0x0
+  801fa2:	e8 1e f1 ff ff       	call   8010c5 <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  801fa7:	83 c4 10             	add    $0x10,%esp
+  801faa:	85 c0                	test   %eax,%eax
+  801fac:	0f 85 4a ff ff ff    	jne    801efc <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  801fb2:	83 ec 04             	sub    $0x4,%esp
+  801fb5:	68 05 08 00 00       	push   $0x805
+  801fba:	ff 75 cc             	push   -0x34(%ebp)
+  801fbd:	6a 00                	push   $0x0
+  801fbf:	56                   	push   %esi
+  801fc0:	6a 00                	push   $0x0
+  801fc2:	6a 05                	push   $0x5
+  801fc4:	68 80 8f 80 00       	push   $0x808f80
+  801fc9:	e8 8d f5 ff ff       	call   80155b <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  801fce:	c1 e8 1f             	shr    $0x1f,%eax
+  801fd1:	08 45 cb             	or     %al,-0x35(%ebp)
+  801fd4:	83 c4 20             	add    $0x20,%esp
+  801fd7:	e9 33 ff ff ff       	jmp    801f0f <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  801fdc:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  801fdf:	83 ec 0c             	sub    $0xc,%esp
+  801fe2:	68 80 8f 80 00       	push   $0x808f80
+  801fe7:	e8 1f f5 ff ff       	call   80150b <sysbatch_flush>
+  801fec:	83 c4 10             	add    $0x10,%esp
+  801fef:	85 c0                	test   %eax,%eax
+  801ff1:	78 06                	js     801ff9 <devfile_read+0x231>
+  801ff3:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  801ff7:	74 14                	je     80200d <devfile_read+0x245>
+    memmove(dst, src, r);
+  801ff9:	83 ec 04             	sub    $0x4,%esp
+  801ffc:	ff 75 d4             	push   -0x2c(%ebp)
+  801fff:	ff 75 d0             	push   -0x30(%ebp)
+  802002:	ff 75 0c             	push   0xc(%ebp)
+  802005:	e8 55 ee ff ff       	call   800e5f <memmove>
+  80200a:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  80200d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802010:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  802013:	e9 11 fe ff ff       	jmp    801e29 <devfile_read+0x61>
+  assert(r <= n);
+  802018:	68 11 40 80 00       	push   $0x804011
+  80201d:	68 18 40 80 00       	push   $0x804018
+  802022:	68 1c 01 00 00       	push   $0x11c
+  802027:	68 06 40 80 00       	push   $0x804006
+  80202c:	e8 df e5 ff ff       	call   800610 <_panic>
+  assert(r <= PGSIZE);
+  802031:	68 2d 40 80 00       	push   $0x80402d
+  802036:	68 18 40 80 00       	push   $0x804018
+  80203b:	68 1d 01 00 00       	push   $0x11d
+  802040:	68 06 40 80 00       	push   $0x804006
+  802045:	e8 c6 e5 ff ff       	call   800610 <_panic>
+
+0080204a <devfile_write>:
+{
+  80204a:	55                   	push   %ebp
+  80204b:	89 e5                	mov    %esp,%ebp
+  80204d:	57                   	push   %edi
+  80204e:	56                   	push   %esi
+  80204f:	53                   	push   %ebx
+  802050:	83 ec 1c             	sub    $0x1c,%esp
+  802053:	8b 75 08             	mov    0x8(%ebp),%esi
+  802056:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  802059:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  80205e:	77 39                	ja     802099 <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802060:	8b 56 0c             	mov    0xc(%esi),%edx
+  802063:	89 15 00 a0 80 00    	mov    %edx,0x80a000
+  fsipcbuf.write.req_n = n;
+  802069:	a3 04 a0 80 00       	mov    %eax,0x80a004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  80206e:	83 ec 04             	sub    $0x4,%esp
+  802071:	50                   	push   %eax
+  802072:	ff 75 0c             	push   0xc(%ebp)
+  802075:	68 08 a0 80 00       	push   $0x80a008
+  80207a:	e8 e0 ed ff ff       	call   800e5f <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  80207f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802084:	b8 04 00 00 00       	mov    $0x4,%eax
+  802089:	e8 e7 fb ff ff       	call   801c75 <fsipc>
+  80208e:	83 c4 10             	add    $0x10,%esp
+}
+  802091:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802094:	5b                   	pop    %ebx
+  802095:	5e                   	pop    %esi
+  802096:	5f                   	pop    %edi
+  802097:	5d                   	pop    %ebp
+  802098:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  802099:	ba 00 00 10 00       	mov    $0x100000,%edx
+  80209e:	39 d0                	cmp    %edx,%eax
+  8020a0:	89 d3                	mov    %edx,%ebx
+  8020a2:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  8020a5:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  8020ab:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  8020ae:	83 c7 01             	add    $0x1,%edi
+  8020b1:	89 f8                	mov    %edi,%eax
+  8020b3:	e8 94 fc ff ff       	call   801d4c <fsv_alloc>
+  8020b8:	85 c0                	test   %eax,%eax
+  8020ba:	78 d5                	js     802091 <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  8020bc:	83 ec 04             	sub    $0x4,%esp
+  8020bf:	53                   	push   %ebx
+  8020c0:	ff 75 0c             	push   0xc(%ebp)
+  8020c3:	68 00 10 c0 9f       	push   $0x9fc01000
+  8020c8:	e8 92 ed ff ff       	call   800e5f <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  8020cd:	8b 46 0c             	mov    0xc(%esi),%eax
+  8020d0:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  8020d5:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  8020db:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  8020e2:	89 f9                	mov    %edi,%ecx
+  8020e4:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  8020e9:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8020ee:	e8 69 fa ff ff       	call   801b5c <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  8020f3:	6a 00                	push   $0x0
+  8020f5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8020f8:	50                   	push   %eax
+  8020f9:	6a 00                	push   $0x0
+  8020fb:	6a 00                	push   $0x0
+  8020fd:	e8 47 15 00 00       	call   803649 <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  802102:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  802105:	eb 8a                	jmp    802091 <devfile_write+0x47>
+
+00802107 <open>:
+{
+  802107:	55                   	push   %ebp
+  802108:	89 e5                	mov    %esp,%ebp
+  80210a:	56                   	push   %esi
+  80210b:	53                   	push   %ebx
+  80210c:	83 ec 1c             	sub    $0x1c,%esp
+  80210f:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  802112:	56                   	push   %esi
+  802113:	e8 86 eb ff ff       	call   800c9e <strlen>
+  802118:	83 c4 10             	add    $0x10,%esp
+  80211b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802120:	7f 6c                	jg     80218e <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  802122:	83 ec 0c             	sub    $0xc,%esp
+  802125:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802128:	50                   	push   %eax
+  802129:	e8 ad f4 ff ff       	call   8015db <fd_alloc>
+  80212e:	89 c3                	mov    %eax,%ebx
+  802130:	83 c4 10             	add    $0x10,%esp
+  802133:	85 c0                	test   %eax,%eax
+  802135:	78 3c                	js     802173 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  802137:	83 ec 08             	sub    $0x8,%esp
+  80213a:	56                   	push   %esi
+  80213b:	68 00 a0 80 00       	push   $0x80a000
+  802140:	e8 94 eb ff ff       	call   800cd9 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  802145:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802148:	a3 00 a4 80 00       	mov    %eax,0x80a400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80214d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802150:	b8 01 00 00 00       	mov    $0x1,%eax
+  802155:	e8 1b fb ff ff       	call   801c75 <fsipc>
+  80215a:	89 c3                	mov    %eax,%ebx
+  80215c:	83 c4 10             	add    $0x10,%esp
+  80215f:	85 c0                	test   %eax,%eax
+  802161:	78 19                	js     80217c <open+0x75>
+  return fd2num(fd);
+  802163:	83 ec 0c             	sub    $0xc,%esp
+  802166:	ff 75 f4             	push   -0xc(%ebp)
+  802169:	e8 49 f4 ff ff       	call   8015b7 <fd2num>
+  80216e:	89 c3                	mov    %eax,%ebx
+  802170:	83 c4 10             	add    $0x10,%esp
+}
+  802173:	89 d8                	mov    %ebx,%eax
+  802175:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802178:	5b                   	pop    %ebx
+  802179:	5e                   	pop    %esi
+  80217a:	5d                   	pop    %ebp
+  80217b:	c3                   	ret
+    fd_close(fd, 0);
+  80217c:	83 ec 08             	sub    $0x8,%esp
+  80217f:	6a 00                	push   $0x0
+  802181:	ff 75 f4             	push   -0xc(%ebp)
+  802184:	e8 44 f5 ff ff       	call   8016cd <fd_close>
+    return r;
+  802189:	83 c4 10             	add    $0x10,%esp
+  80218c:	eb e5                	jmp    802173 <open+0x6c>
+    return -E_BAD_PATH;
+  80218e:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802193:	eb de                	jmp    802173 <open+0x6c>
+
+00802195 <open_read>:
+{
+  802195:	55                   	push   %ebp
+  802196:	89 e5                	mov    %esp,%ebp
+  802198:	57                   	push   %edi
+  802199:	56                   	push   %esi
+  80219a:	53                   	push   %ebx
+  80219b:	83 ec 28             	sub    $0x28,%esp
+  80219e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  8021a1:	57                   	push   %edi
+  8021a2:	e8 f7 ea ff ff       	call   800c9e <strlen>
+  8021a7:	83 c4 10             	add    $0x10,%esp
+  8021aa:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8021af:	0f 87 f6 00 00 00    	ja     8022ab <open_read+0x116>
+  8021b5:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  8021b7:	83 ec 0c             	sub    $0xc,%esp
+  8021ba:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8021bd:	50                   	push   %eax
+  8021be:	e8 18 f4 ff ff       	call   8015db <fd_alloc>
+  8021c3:	89 c3                	mov    %eax,%ebx
+  8021c5:	83 c4 10             	add    $0x10,%esp
+  8021c8:	85 c0                	test   %eax,%eax
+  8021ca:	0f 88 b2 00 00 00    	js     802282 <open_read+0xed>
+  strcpy(req->req_buf, path);
+  8021d0:	83 ec 08             	sub    $0x8,%esp
+  8021d3:	57                   	push   %edi
+  8021d4:	68 e4 a0 80 00       	push   $0x80a0e4
+  8021d9:	e8 fb ea ff ff       	call   800cd9 <strcpy>
+  req->req_nops = 2;
+  8021de:	c7 05 00 a0 80 00 02 	movl   $0x2,0x80a000
+  8021e5:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  8021e8:	c7 05 04 a0 80 00 01 	movl   $0x1,0x80a004
+  8021ef:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  8021f2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021f5:	a3 10 a0 80 00       	mov    %eax,0x80a010
+  req->req_ops[0].op_buf = 0;
+  8021fa:	c7 05 18 a0 80 00 00 	movl   $0x0,0x80a018
+  802201:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  802204:	c7 05 20 a0 80 00 04 	movl   $0x4,0x80a020
+  80220b:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  80220e:	c7 05 24 a0 80 00 01 	movl   $0x1,0x80a024
+  802215:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  802218:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  80221d:	29 f0                	sub    %esi,%eax
+  80221f:	3b 45 14             	cmp    0x14(%ebp),%eax
+  802222:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  802226:	a3 2c a0 80 00       	mov    %eax,0x80a02c
+  req->req_ops[1].op_offset = 0;
+  80222b:	c7 05 30 a0 80 00 00 	movl   $0x0,0x80a030
+  802232:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  802235:	83 c6 01             	add    $0x1,%esi
+  802238:	89 35 34 a0 80 00    	mov    %esi,0x80a034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  80223e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802241:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802246:	e8 2a fa ff ff       	call   801c75 <fsipc>
+  80224b:	89 c3                	mov    %eax,%ebx
+  80224d:	83 c4 10             	add    $0x10,%esp
+  802250:	83 f8 01             	cmp    $0x1,%eax
+  802253:	7e 37                	jle    80228c <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  802255:	a1 38 a0 80 00       	mov    0x80a038,%eax
+  80225a:	8b 55 18             	mov    0x18(%ebp),%edx
+  80225d:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  80225f:	83 ec 04             	sub    $0x4,%esp
+  802262:	50                   	push   %eax
+  802263:	81 c6 e4 a0 80 00    	add    $0x80a0e4,%esi
+  802269:	56                   	push   %esi
+  80226a:	ff 75 10             	push   0x10(%ebp)
+  80226d:	e8 ed eb ff ff       	call   800e5f <memmove>
+  return fd2num(fd);
+  802272:	83 c4 04             	add    $0x4,%esp
+  802275:	ff 75 e4             	push   -0x1c(%ebp)
+  802278:	e8 3a f3 ff ff       	call   8015b7 <fd2num>
+  80227d:	89 c3                	mov    %eax,%ebx
+  80227f:	83 c4 10             	add    $0x10,%esp
+}
+  802282:	89 d8                	mov    %ebx,%eax
+  802284:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802287:	5b                   	pop    %ebx
+  802288:	5e                   	pop    %esi
+  802289:	5f                   	pop    %edi
+  80228a:	5d                   	pop    %ebp
+  80228b:	c3                   	ret
+    fd_close(fd, 0);
+  80228c:	83 ec 08             	sub    $0x8,%esp
+  80228f:	6a 00                	push   $0x0
+  802291:	ff 75 e4             	push   -0x1c(%ebp)
+  802294:	e8 34 f4 ff ff       	call   8016cd <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  802299:	83 c4 10             	add    $0x10,%esp
+  80229c:	85 db                	test   %ebx,%ebx
+  80229e:	78 e2                	js     802282 <open_read+0xed>
+  8022a0:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  8022a3:	8b 9b 1c a0 80 00    	mov    0x80a01c(%ebx),%ebx
+  8022a9:	eb d7                	jmp    802282 <open_read+0xed>
+    return -E_BAD_PATH;
+  8022ab:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8022b0:	eb d0                	jmp    802282 <open_read+0xed>
+
+008022b2 <file_stat>:
+{
+  8022b2:	55                   	push   %ebp
+  8022b3:	89 e5                	mov    %esp,%ebp
+  8022b5:	57                   	push   %edi
+  8022b6:	56                   	push   %esi
+  8022b7:	53                   	push   %ebx
+  8022b8:	83 ec 18             	sub    $0x18,%esp
+  8022bb:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8022be:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  8022c1:	57                   	push   %edi
+  8022c2:	e8 d7 e9 ff ff       	call   800c9e <strlen>
+  8022c7:	83 c4 10             	add    $0x10,%esp
+  8022ca:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8022cf:	0f 8f c7 00 00 00    	jg     80239c <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  8022d5:	83 ec 0c             	sub    $0xc,%esp
+  8022d8:	57                   	push   %edi
+  8022d9:	e8 c0 e9 ff ff       	call   800c9e <strlen>
+  8022de:	8d 58 04             	lea    0x4(%eax),%ebx
+  8022e1:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  8022e4:	83 c4 08             	add    $0x8,%esp
+  8022e7:	57                   	push   %edi
+  8022e8:	68 e4 a0 80 00       	push   $0x80a0e4
+  8022ed:	e8 e7 e9 ff ff       	call   800cd9 <strcpy>
+  req->req_nops = 2;
+  8022f2:	c7 05 00 a0 80 00 02 	movl   $0x2,0x80a000
+  8022f9:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  8022fc:	c7 05 04 a0 80 00 02 	movl   $0x2,0x80a004
+  802303:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  802306:	c7 05 10 a0 80 00 00 	movl   $0x0,0x80a010
+  80230d:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  802310:	c7 05 18 a0 80 00 00 	movl   $0x0,0x80a018
+  802317:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  80231a:	c7 05 20 a0 80 00 03 	movl   $0x3,0x80a020
+  802321:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  802324:	c7 05 24 a0 80 00 01 	movl   $0x1,0x80a024
+  80232b:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  80232e:	89 1d 34 a0 80 00    	mov    %ebx,0x80a034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  802334:	ba 00 00 00 00       	mov    $0x0,%edx
+  802339:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80233e:	e8 32 f9 ff ff       	call   801c75 <fsipc>
+  802343:	83 c4 10             	add    $0x10,%esp
+  802346:	83 f8 01             	cmp    $0x1,%eax
+  802349:	7e 42                	jle    80238d <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  80234b:	81 c3 e4 a0 80 00    	add    $0x80a0e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  802351:	83 ec 08             	sub    $0x8,%esp
+  802354:	53                   	push   %ebx
+  802355:	56                   	push   %esi
+  802356:	e8 7e e9 ff ff       	call   800cd9 <strcpy>
+  st->st_size = ret->ret_size;
+  80235b:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  802361:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  802367:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  80236d:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  802373:	c7 86 88 00 00 00 04 	movl   $0x805004,0x88(%esi)
+  80237a:	50 80 00 
+  return 0;
+  80237d:	83 c4 10             	add    $0x10,%esp
+  802380:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802385:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802388:	5b                   	pop    %ebx
+  802389:	5e                   	pop    %esi
+  80238a:	5f                   	pop    %edi
+  80238b:	5d                   	pop    %ebp
+  80238c:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  80238d:	85 c0                	test   %eax,%eax
+  80238f:	78 f4                	js     802385 <file_stat+0xd3>
+  802391:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802394:	8b 80 1c a0 80 00    	mov    0x80a01c(%eax),%eax
+  80239a:	eb e9                	jmp    802385 <file_stat+0xd3>
+    return -E_BAD_PATH;
+  80239c:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8023a1:	eb e2                	jmp    802385 <file_stat+0xd3>
+
+008023a3 <read_map>:
+{
+  8023a3:	55                   	push   %ebp
+  8023a4:	89 e5                	mov    %esp,%ebp
+  8023a6:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8023a9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023ac:	50                   	push   %eax
+  8023ad:	ff 75 08             	push   0x8(%ebp)
+  8023b0:	e8 7c f2 ff ff       	call   801631 <fd_lookup>
+  8023b5:	83 c4 10             	add    $0x10,%esp
+  8023b8:	85 c0                	test   %eax,%eax
+  8023ba:	78 2a                	js     8023e6 <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  8023bc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023bf:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  8023c5:	39 08                	cmp    %ecx,(%eax)
+  8023c7:	75 1f                	jne    8023e8 <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  8023c9:	8b 40 0c             	mov    0xc(%eax),%eax
+  8023cc:	a3 00 a0 80 00       	mov    %eax,0x80a000
+  fsipcbuf.read_map.req_offset = offset;
+  8023d1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023d4:	a3 04 a0 80 00       	mov    %eax,0x80a004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  8023d9:	8b 55 10             	mov    0x10(%ebp),%edx
+  8023dc:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8023e1:	e8 8f f8 ff ff       	call   801c75 <fsipc>
+}
+  8023e6:	c9                   	leave
+  8023e7:	c3                   	ret
+    return -E_INVAL;
+  8023e8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8023ed:	eb f7                	jmp    8023e6 <read_map+0x43>
+
+008023ef <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8023ef:	55                   	push   %ebp
+  8023f0:	89 e5                	mov    %esp,%ebp
+  8023f2:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  8023f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023fa:	b8 08 00 00 00       	mov    $0x8,%eax
+  8023ff:	e8 71 f8 ff ff       	call   801c75 <fsipc>
+}
+  802404:	c9                   	leave
+  802405:	c3                   	ret
+
+00802406 <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  802406:	55                   	push   %ebp
+  802407:	89 e5                	mov    %esp,%ebp
+  802409:	57                   	push   %edi
+  80240a:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  80240b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80240e:	a3 00 a0 80 00       	mov    %eax,0x80a000
+  fsipcbuf.stats.req_bio_sched = 0;
+  802413:	c7 05 04 a0 80 00 00 	movl   $0x0,0x80a004
+  80241a:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  80241d:	c7 05 08 a0 80 00 00 	movl   $0x0,0x80a008
+  802424:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  802427:	ba 00 00 00 00       	mov    $0x0,%edx
+  80242c:	b8 09 00 00 00       	mov    $0x9,%eax
+  802431:	e8 3f f8 ff ff       	call   801c75 <fsipc>
+  802436:	85 c0                	test   %eax,%eax
+  802438:	78 14                	js     80244e <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  80243a:	be 00 a0 80 00       	mov    $0x80a000,%esi
+  80243f:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802444:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802447:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  802449:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80244e:	5e                   	pop    %esi
+  80244f:	5f                   	pop    %edi
+  802450:	5d                   	pop    %ebp
+  802451:	c3                   	ret
+
+00802452 <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  802452:	55                   	push   %ebp
+  802453:	89 e5                	mov    %esp,%ebp
+  802455:	53                   	push   %ebx
+  802456:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  802459:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  80245c:	50                   	push   %eax
+  80245d:	6a 00                	push   $0x0
+  80245f:	e8 a2 ff ff ff       	call   802406 <fs_stats>
+  802464:	83 c4 10             	add    $0x10,%esp
+  802467:	85 c0                	test   %eax,%eax
+  802469:	78 28                	js     802493 <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  80246b:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  80246e:	83 ec 08             	sub    $0x8,%esp
+  802471:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802474:	50                   	push   %eax
+  802475:	6a 20                	push   $0x20
+  802477:	e8 8a ff ff ff       	call   802406 <fs_stats>
+  80247c:	83 c4 10             	add    $0x10,%esp
+  80247f:	85 c0                	test   %eax,%eax
+  802481:	78 10                	js     802493 <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  802483:	83 ec 08             	sub    $0x8,%esp
+  802486:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802489:	50                   	push   %eax
+  80248a:	53                   	push   %ebx
+  80248b:	e8 76 ff ff ff       	call   802406 <fs_stats>
+  802490:	83 c4 10             	add    $0x10,%esp
+}
+  802493:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802496:	c9                   	leave
+  802497:	c3                   	ret
+
+00802498 <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  802498:	55                   	push   %ebp
+  802499:	89 e5                	mov    %esp,%ebp
+  80249b:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  80249e:	c7 05 00 a0 80 00 00 	movl   $0x0,0x80a000
+  8024a5:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  8024a8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024ab:	a3 04 a0 80 00       	mov    %eax,0x80a004
+  fsipcbuf.stats.req_dcache = 0;
+  8024b0:	c7 05 08 a0 80 00 00 	movl   $0x0,0x80a008
+  8024b7:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  8024ba:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024bf:	b8 09 00 00 00       	mov    $0x9,%eax
+  8024c4:	e8 ac f7 ff ff       	call   801c75 <fsipc>
+}
+  8024c9:	c9                   	leave
+  8024ca:	c3                   	ret
+
+008024cb <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  8024cb:	55                   	push   %ebp
+  8024cc:	89 e5                	mov    %esp,%ebp
+  8024ce:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  8024d1:	c7 05 00 a0 80 00 00 	movl   $0x0,0x80a000
+  8024d8:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  8024db:	c7 05 04 a0 80 00 00 	movl   $0x0,0x80a004
+  8024e2:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  8024e5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024e8:	a3 08 a0 80 00       	mov    %eax,0x80a008
+  return fsipc(FSREQ_STATS, NULL);
+  8024ed:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024f2:	b8 09 00 00 00       	mov    $0x9,%eax
+  8024f7:	e8 79 f7 ff ff       	call   801c75 <fsipc>
+}
+  8024fc:	c9                   	leave
+  8024fd:	c3                   	ret
+
+008024fe <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  8024fe:	55                   	push   %ebp
+  8024ff:	89 e5                	mov    %esp,%ebp
+  802501:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802504:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802507:	50                   	push   %eax
+  802508:	ff 75 08             	push   0x8(%ebp)
+  80250b:	e8 21 f1 ff ff       	call   801631 <fd_lookup>
+  802510:	83 c4 10             	add    $0x10,%esp
+  802513:	85 c0                	test   %eax,%eax
+  802515:	78 34                	js     80254b <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  802517:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80251a:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  802520:	39 08                	cmp    %ecx,(%eax)
+  802522:	75 29                	jne    80254d <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  802524:	8b 40 0c             	mov    0xc(%eax),%eax
+  802527:	a3 00 a0 80 00       	mov    %eax,0x80a000
+  fsipcbuf.fallocate.req_offset = offset;
+  80252c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80252f:	a3 04 a0 80 00       	mov    %eax,0x80a004
+  fsipcbuf.fallocate.req_len = len;
+  802534:	8b 45 10             	mov    0x10(%ebp),%eax
+  802537:	a3 08 a0 80 00       	mov    %eax,0x80a008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  80253c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802541:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802546:	e8 2a f7 ff ff       	call   801c75 <fsipc>
+}
+  80254b:	c9                   	leave
+  80254c:	c3                   	ret
+    return -E_INVAL;
+  80254d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802552:	eb f7                	jmp    80254b <fallocate+0x4d>
+
+00802554 <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  802554:	55                   	push   %ebp
+  802555:	89 e5                	mov    %esp,%ebp
+  802557:	57                   	push   %edi
+  802558:	56                   	push   %esi
+  802559:	53                   	push   %ebx
+  80255a:	83 ec 24             	sub    $0x24,%esp
+  80255d:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802560:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802563:	50                   	push   %eax
+  802564:	ff 75 08             	push   0x8(%ebp)
+  802567:	e8 c5 f0 ff ff       	call   801631 <fd_lookup>
+  80256c:	83 c4 10             	add    $0x10,%esp
+  80256f:	85 c0                	test   %eax,%eax
+  802571:	78 66                	js     8025d9 <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  802573:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802576:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  80257c:	39 08                	cmp    %ecx,(%eax)
+  80257e:	75 61                	jne    8025e1 <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  802580:	85 f6                	test   %esi,%esi
+  802582:	7e 50                	jle    8025d4 <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  802584:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  802589:	39 de                	cmp    %ebx,%esi
+  80258b:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  80258e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802591:	8b 40 0c             	mov    0xc(%eax),%eax
+  802594:	a3 00 a0 80 00       	mov    %eax,0x80a000
+    fsipcbuf.prefetch.req_n = m;
+  802599:	89 1d 04 a0 80 00    	mov    %ebx,0x80a004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  80259f:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  8025a6:	83 ec 04             	sub    $0x4,%esp
+  8025a9:	57                   	push   %edi
+  8025aa:	ff 75 0c             	push   0xc(%ebp)
+  8025ad:	68 08 a0 80 00       	push   $0x80a008
+  8025b2:	e8 a8 e8 ff ff       	call   800e5f <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  8025b7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025bc:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8025c1:	e8 af f6 ff ff       	call   801c75 <fsipc>
+  8025c6:	83 c4 10             	add    $0x10,%esp
+  8025c9:	85 c0                	test   %eax,%eax
+  8025cb:	78 0c                	js     8025d9 <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  8025cd:	01 7d 0c             	add    %edi,0xc(%ebp)
+  8025d0:	29 de                	sub    %ebx,%esi
+  8025d2:	eb ac                	jmp    802580 <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  8025d4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025dc:	5b                   	pop    %ebx
+  8025dd:	5e                   	pop    %esi
+  8025de:	5f                   	pop    %edi
+  8025df:	5d                   	pop    %ebp
+  8025e0:	c3                   	ret
+    return -E_INVAL;
+  8025e1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8025e6:	eb f1                	jmp    8025d9 <prefetch+0x85>
+
+008025e8 <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  8025e8:	55                   	push   %ebp
+  8025e9:	89 e5                	mov    %esp,%ebp
+  8025eb:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  8025ee:	50                   	push   %eax
+  8025ef:	e8 d3 ef ff ff       	call   8015c7 <fd2data>
+  8025f4:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  8025f9:	c9                   	leave
+  8025fa:	c3                   	ret
+
+008025fb <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8025fb:	55                   	push   %ebp
+  8025fc:	89 e5                	mov    %esp,%ebp
+  8025fe:	56                   	push   %esi
+  8025ff:	53                   	push   %ebx
+  802600:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  802603:	83 ec 0c             	sub    $0xc,%esp
+  802606:	ff 75 08             	push   0x8(%ebp)
+  802609:	e8 b9 ef ff ff       	call   8015c7 <fd2data>
+  80260e:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  802610:	83 c4 08             	add    $0x8,%esp
+  802613:	68 68 40 80 00       	push   $0x804068
+  802618:	53                   	push   %ebx
+  802619:	e8 bb e6 ff ff       	call   800cd9 <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  80261e:	8b 46 04             	mov    0x4(%esi),%eax
+  802621:	2b 06                	sub    (%esi),%eax
+  802623:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  802629:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802630:	00 00 00 
+  stat->st_dev = &devpipe;
+  802633:	c7 83 88 00 00 00 20 	movl   $0x805020,0x88(%ebx)
+  80263a:	50 80 00 
+  return 0;
+}
+  80263d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802642:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802645:	5b                   	pop    %ebx
+  802646:	5e                   	pop    %esi
+  802647:	5d                   	pop    %ebp
+  802648:	c3                   	ret
+
+00802649 <pipe_wakeup>:
+{
+  802649:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  80264b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802650:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  802653:	85 c0                	test   %eax,%eax
+  802655:	75 01                	jne    802658 <pipe_wakeup+0xf>
+  802657:	c3                   	ret
+{
+  802658:	55                   	push   %ebp
+  802659:	89 e5                	mov    %esp,%ebp
+  80265b:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  80265e:	6a 00                	push   $0x0
+  802660:	68 00 00 c0 ee       	push   $0xeec00000
+  802665:	52                   	push   %edx
+  802666:	e8 f9 ed ff ff       	call   801464 <sys_chan_wakeup>
+  80266b:	83 c4 10             	add    $0x10,%esp
+}
+  80266e:	c9                   	leave
+  80266f:	c3                   	ret
+
+00802670 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802670:	55                   	push   %ebp
+  802671:	89 e5                	mov    %esp,%ebp
+  802673:	57                   	push   %edi
+  802674:	56                   	push   %esi
+  802675:	53                   	push   %ebx
+  802676:	83 ec 18             	sub    $0x18,%esp
+  802679:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  80267c:	57                   	push   %edi
+  80267d:	e8 45 ef ff ff       	call   8015c7 <fd2data>
+  802682:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  802684:	83 c4 10             	add    $0x10,%esp
+  802687:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  80268b:	74 2a                	je     8026b7 <devpipe_close+0x47>
+  80268d:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  802692:	89 f8                	mov    %edi,%eax
+  802694:	e8 4f ff ff ff       	call   8025e8 <pipe_ring>
+  802699:	83 ec 08             	sub    $0x8,%esp
+  80269c:	01 d8                	add    %ebx,%eax
+  80269e:	50                   	push   %eax
+  80269f:	6a 00                	push   $0x0
+  8026a1:	e8 e7 ea ff ff       	call   80118d <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  8026a6:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8026ac:	83 c4 10             	add    $0x10,%esp
+  8026af:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  8026b5:	75 db                	jne    802692 <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  8026b7:	83 ec 08             	sub    $0x8,%esp
+  8026ba:	57                   	push   %edi
+  8026bb:	6a 00                	push   $0x0
+  8026bd:	e8 cb ea ff ff       	call   80118d <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  8026c2:	83 c4 10             	add    $0x10,%esp
+  8026c5:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  8026c9:	75 13                	jne    8026de <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  8026cb:	83 ec 08             	sub    $0x8,%esp
+  8026ce:	56                   	push   %esi
+  8026cf:	6a 00                	push   $0x0
+  8026d1:	e8 b7 ea ff ff       	call   80118d <sys_page_unmap>
+}
+  8026d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026d9:	5b                   	pop    %ebx
+  8026da:	5e                   	pop    %esi
+  8026db:	5f                   	pop    %edi
+  8026dc:	5d                   	pop    %ebp
+  8026dd:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  8026de:	8d 56 04             	lea    0x4(%esi),%edx
+  8026e1:	8d 46 2c             	lea    0x2c(%esi),%eax
+  8026e4:	e8 60 ff ff ff       	call   802649 <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8026e9:	8d 46 30             	lea    0x30(%esi),%eax
+  8026ec:	89 f2                	mov    %esi,%edx
+  8026ee:	e8 56 ff ff ff       	call   802649 <pipe_wakeup>
+  8026f3:	eb d6                	jmp    8026cb <devpipe_close+0x5b>
+
+008026f5 <_pipeisclosed>:
+{
+  8026f5:	55                   	push   %ebp
+  8026f6:	89 e5                	mov    %esp,%ebp
+  8026f8:	57                   	push   %edi
+  8026f9:	56                   	push   %esi
+  8026fa:	53                   	push   %ebx
+  8026fb:	83 ec 1c             	sub    $0x1c,%esp
+  8026fe:	89 c7                	mov    %eax,%edi
+  802700:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  802702:	a1 e0 97 80 00       	mov    0x8097e0,%eax
+  802707:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  80270a:	83 ec 0c             	sub    $0xc,%esp
+  80270d:	57                   	push   %edi
+  80270e:	e8 99 10 00 00       	call   8037ac <pageref>
+  802713:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802716:	89 34 24             	mov    %esi,(%esp)
+  802719:	e8 8e 10 00 00       	call   8037ac <pageref>
+    nn = thisenv->env_runs;
+  80271e:	8b 15 e0 97 80 00    	mov    0x8097e0,%edx
+  802724:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  802727:	83 c4 10             	add    $0x10,%esp
+  80272a:	39 cb                	cmp    %ecx,%ebx
+  80272c:	74 1b                	je     802749 <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  80272e:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802731:	75 cf                	jne    802702 <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802733:	8b 42 58             	mov    0x58(%edx),%eax
+  802736:	6a 01                	push   $0x1
+  802738:	50                   	push   %eax
+  802739:	53                   	push   %ebx
+  80273a:	68 6f 40 80 00       	push   $0x80406f
+  80273f:	e8 a7 df ff ff       	call   8006eb <cprintf>
+  802744:	83 c4 10             	add    $0x10,%esp
+  802747:	eb b9                	jmp    802702 <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  802749:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80274c:	0f 94 c0             	sete   %al
+  80274f:	0f b6 c0             	movzbl %al,%eax
+}
+  802752:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802755:	5b                   	pop    %ebx
+  802756:	5e                   	pop    %esi
+  802757:	5f                   	pop    %edi
+  802758:	5d                   	pop    %ebp
+  802759:	c3                   	ret
+
+0080275a <devpipe_write_bulk>:
+{
+  80275a:	55                   	push   %ebp
+  80275b:	89 e5                	mov    %esp,%ebp
+  80275d:	57                   	push   %edi
+  80275e:	56                   	push   %esi
+  80275f:	53                   	push   %ebx
+  802760:	83 ec 1c             	sub    $0x1c,%esp
+  802763:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802766:	89 d6                	mov    %edx,%esi
+  802768:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  80276b:	e8 78 fe ff ff       	call   8025e8 <pipe_ring>
+  802770:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  802773:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802778:	8d 46 04             	lea    0x4(%esi),%eax
+  80277b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  80277e:	eb 75                	jmp    8027f5 <devpipe_write_bulk+0x9b>
+  802780:	b8 01 00 00 00       	mov    $0x1,%eax
+  802785:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802789:	6a 64                	push   $0x64
+  80278b:	68 00 00 c0 ee       	push   $0xeec00000
+  802790:	53                   	push   %ebx
+  802791:	56                   	push   %esi
+  802792:	e8 aa ec ff ff       	call   801441 <sys_chan_sleep>
+      continue;
+  802797:	83 c4 10             	add    $0x10,%esp
+  80279a:	eb 59                	jmp    8027f5 <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  80279c:	89 d1                	mov    %edx,%ecx
+  80279e:	c1 f9 1f             	sar    $0x1f,%ecx
+  8027a1:	c1 e9 11             	shr    $0x11,%ecx
+  8027a4:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  8027a7:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8027ac:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  8027ae:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  8027b4:	29 d3                	sub    %edx,%ebx
+  8027b6:	ba 00 80 00 00       	mov    $0x8000,%edx
+  8027bb:	29 c2                	sub    %eax,%edx
+  8027bd:	39 d3                	cmp    %edx,%ebx
+  8027bf:	0f 47 da             	cmova  %edx,%ebx
+  8027c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8027c5:	29 fa                	sub    %edi,%edx
+  8027c7:	39 d3                	cmp    %edx,%ebx
+  8027c9:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  8027cc:	83 ec 04             	sub    $0x4,%esp
+  8027cf:	53                   	push   %ebx
+  8027d0:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8027d3:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  8027d6:	52                   	push   %edx
+  8027d7:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8027da:	01 c8                	add    %ecx,%eax
+  8027dc:	50                   	push   %eax
+  8027dd:	e8 df e6 ff ff       	call   800ec1 <memcpy>
+    i += m;
+  8027e2:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  8027e4:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  8027e7:	8d 46 2c             	lea    0x2c(%esi),%eax
+  8027ea:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8027ed:	e8 57 fe ff ff       	call   802649 <pipe_wakeup>
+  8027f2:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  8027f5:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  8027f8:	73 2b                	jae    802825 <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  8027fa:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  8027fc:	8b 56 04             	mov    0x4(%esi),%edx
+  8027ff:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  802805:	39 d0                	cmp    %edx,%eax
+  802807:	7d 93                	jge    80279c <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  802809:	89 f2                	mov    %esi,%edx
+  80280b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80280e:	e8 e2 fe ff ff       	call   8026f5 <_pipeisclosed>
+  802813:	85 c0                	test   %eax,%eax
+  802815:	0f 84 65 ff ff ff    	je     802780 <devpipe_write_bulk+0x26>
+        return i;
+  80281b:	89 f8                	mov    %edi,%eax
+}
+  80281d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802820:	5b                   	pop    %ebx
+  802821:	5e                   	pop    %esi
+  802822:	5f                   	pop    %edi
+  802823:	5d                   	pop    %ebp
+  802824:	c3                   	ret
+  return i;
+  802825:	89 f8                	mov    %edi,%eax
+  802827:	eb f4                	jmp    80281d <devpipe_write_bulk+0xc3>
+
+00802829 <devpipe_write>:
+{
+  802829:	55                   	push   %ebp
+  80282a:	89 e5                	mov    %esp,%ebp
+  80282c:	57                   	push   %edi
+  80282d:	56                   	push   %esi
+  80282e:	53                   	push   %ebx
+  80282f:	83 ec 28             	sub    $0x28,%esp
+  802832:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  802835:	56                   	push   %esi
+  802836:	e8 8c ed ff ff       	call   8015c7 <fd2data>
+  80283b:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  80283d:	8b 78 28             	mov    0x28(%eax),%edi
+  802840:	83 c4 10             	add    $0x10,%esp
+  802843:	85 ff                	test   %edi,%edi
+  802845:	75 25                	jne    80286c <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  802847:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  80284a:	74 66                	je     8028b2 <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  80284c:	8b 43 04             	mov    0x4(%ebx),%eax
+  80284f:	8b 0b                	mov    (%ebx),%ecx
+  802851:	8d 51 20             	lea    0x20(%ecx),%edx
+  802854:	39 d0                	cmp    %edx,%eax
+  802856:	72 2b                	jb     802883 <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  802858:	89 da                	mov    %ebx,%edx
+  80285a:	89 f0                	mov    %esi,%eax
+  80285c:	e8 94 fe ff ff       	call   8026f5 <_pipeisclosed>
+  802861:	85 c0                	test   %eax,%eax
+  802863:	75 51                	jne    8028b6 <devpipe_write+0x8d>
+      sys_yield();
+  802865:	e8 3c e8 ff ff       	call   8010a6 <sys_yield>
+  80286a:	eb e0                	jmp    80284c <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  80286c:	83 ec 0c             	sub    $0xc,%esp
+  80286f:	ff 75 10             	push   0x10(%ebp)
+  802872:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802875:	89 c2                	mov    %eax,%edx
+  802877:	89 f0                	mov    %esi,%eax
+  802879:	e8 dc fe ff ff       	call   80275a <devpipe_write_bulk>
+  80287e:	83 c4 10             	add    $0x10,%esp
+  802881:	eb 38                	jmp    8028bb <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802883:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802886:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  80288a:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  80288d:	89 c2                	mov    %eax,%edx
+  80288f:	c1 fa 1f             	sar    $0x1f,%edx
+  802892:	89 d1                	mov    %edx,%ecx
+  802894:	c1 e9 1b             	shr    $0x1b,%ecx
+  802897:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80289a:	83 e2 1f             	and    $0x1f,%edx
+  80289d:	29 ca                	sub    %ecx,%edx
+  80289f:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8028a3:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  8028a7:	83 c0 01             	add    $0x1,%eax
+  8028aa:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  8028ad:	83 c7 01             	add    $0x1,%edi
+  8028b0:	eb 95                	jmp    802847 <devpipe_write+0x1e>
+  return i;
+  8028b2:	89 f8                	mov    %edi,%eax
+  8028b4:	eb 05                	jmp    8028bb <devpipe_write+0x92>
+        return 0;
+  8028b6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8028bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028be:	5b                   	pop    %ebx
+  8028bf:	5e                   	pop    %esi
+  8028c0:	5f                   	pop    %edi
+  8028c1:	5d                   	pop    %ebp
+  8028c2:	c3                   	ret
+
+008028c3 <devpipe_read_bulk>:
+{
+  8028c3:	55                   	push   %ebp
+  8028c4:	89 e5                	mov    %esp,%ebp
+  8028c6:	57                   	push   %edi
+  8028c7:	56                   	push   %esi
+  8028c8:	53                   	push   %ebx
+  8028c9:	83 ec 2c             	sub    $0x2c,%esp
+  8028cc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8028cf:	89 d6                	mov    %edx,%esi
+  8028d1:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8028d4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  8028d7:	e8 0c fd ff ff       	call   8025e8 <pipe_ring>
+  8028dc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  8028df:	85 db                	test   %ebx,%ebx
+  8028e1:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8028e6:	0f 45 c3             	cmovne %ebx,%eax
+  8028e9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8028ec:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8028f1:	8d 46 30             	lea    0x30(%esi),%eax
+  8028f4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  8028f7:	eb 50                	jmp    802949 <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  8028f9:	89 d1                	mov    %edx,%ecx
+  8028fb:	c1 f9 1f             	sar    $0x1f,%ecx
+  8028fe:	c1 e9 11             	shr    $0x11,%ecx
+  802901:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802904:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802909:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  80290b:	29 d3                	sub    %edx,%ebx
+  80290d:	ba 00 80 00 00       	mov    $0x8000,%edx
+  802912:	29 c2                	sub    %eax,%edx
+  802914:	39 d3                	cmp    %edx,%ebx
+  802916:	0f 47 da             	cmova  %edx,%ebx
+  802919:	8b 55 08             	mov    0x8(%ebp),%edx
+  80291c:	29 fa                	sub    %edi,%edx
+  80291e:	39 d3                	cmp    %edx,%ebx
+  802920:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  802923:	83 ec 04             	sub    $0x4,%esp
+  802926:	53                   	push   %ebx
+  802927:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80292a:	01 c8                	add    %ecx,%eax
+  80292c:	50                   	push   %eax
+  80292d:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802930:	01 f8                	add    %edi,%eax
+  802932:	50                   	push   %eax
+  802933:	e8 89 e5 ff ff       	call   800ec1 <memcpy>
+    i += m;
+  802938:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  80293a:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  80293c:	89 f2                	mov    %esi,%edx
+  80293e:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802941:	e8 03 fd ff ff       	call   802649 <pipe_wakeup>
+  802946:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802949:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  80294c:	73 51                	jae    80299f <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  80294e:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  802951:	8b 16                	mov    (%esi),%edx
+  802953:	39 da                	cmp    %ebx,%edx
+  802955:	75 a2                	jne    8028f9 <devpipe_read_bulk+0x36>
+      if (i > 0)
+  802957:	85 ff                	test   %edi,%edi
+  802959:	75 44                	jne    80299f <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  80295b:	89 f2                	mov    %esi,%edx
+  80295d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802960:	e8 90 fd ff ff       	call   8026f5 <_pipeisclosed>
+  802965:	85 c0                	test   %eax,%eax
+  802967:	75 3a                	jne    8029a3 <devpipe_read_bulk+0xe0>
+  802969:	b8 01 00 00 00       	mov    $0x1,%eax
+  80296e:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802972:	6a 64                	push   $0x64
+  802974:	ff 75 d4             	push   -0x2c(%ebp)
+  802977:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  802978:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  80297b:	50                   	push   %eax
+  80297c:	e8 c0 ea ff ff       	call   801441 <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  802981:	85 c0                	test   %eax,%eax
+  802983:	ba 00 00 00 00       	mov    $0x0,%edx
+  802988:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  80298b:	83 c4 10             	add    $0x10,%esp
+  80298e:	a8 01                	test   $0x1,%al
+  802990:	74 b7                	je     802949 <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  802992:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  802997:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80299a:	5b                   	pop    %ebx
+  80299b:	5e                   	pop    %esi
+  80299c:	5f                   	pop    %edi
+  80299d:	5d                   	pop    %ebp
+  80299e:	c3                   	ret
+  return i;
+  80299f:	89 f8                	mov    %edi,%eax
+  8029a1:	eb f4                	jmp    802997 <devpipe_read_bulk+0xd4>
+        return 0;
+  8029a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029a8:	eb ed                	jmp    802997 <devpipe_read_bulk+0xd4>
+
+008029aa <devpipe_read>:
+{
+  8029aa:	55                   	push   %ebp
+  8029ab:	89 e5                	mov    %esp,%ebp
+  8029ad:	57                   	push   %edi
+  8029ae:	56                   	push   %esi
+  8029af:	53                   	push   %ebx
+  8029b0:	83 ec 18             	sub    $0x18,%esp
+  8029b3:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  8029b6:	57                   	push   %edi
+  8029b7:	e8 0b ec ff ff       	call   8015c7 <fd2data>
+  8029bc:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  8029be:	8b 70 28             	mov    0x28(%eax),%esi
+  8029c1:	83 c4 10             	add    $0x10,%esp
+  8029c4:	85 f6                	test   %esi,%esi
+  8029c6:	75 24                	jne    8029ec <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  8029c8:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8029cb:	74 60                	je     802a2d <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  8029cd:	8b 03                	mov    (%ebx),%eax
+  8029cf:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8029d2:	75 3b                	jne    802a0f <devpipe_read+0x65>
+      if (i > 0)
+  8029d4:	85 f6                	test   %esi,%esi
+  8029d6:	75 2d                	jne    802a05 <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  8029d8:	89 da                	mov    %ebx,%edx
+  8029da:	89 f8                	mov    %edi,%eax
+  8029dc:	e8 14 fd ff ff       	call   8026f5 <_pipeisclosed>
+  8029e1:	85 c0                	test   %eax,%eax
+  8029e3:	75 4c                	jne    802a31 <devpipe_read+0x87>
+      sys_yield();
+  8029e5:	e8 bc e6 ff ff       	call   8010a6 <sys_yield>
+  8029ea:	eb e1                	jmp    8029cd <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  8029ec:	83 ec 08             	sub    $0x8,%esp
+  8029ef:	6a 00                	push   $0x0
+  8029f1:	ff 75 10             	push   0x10(%ebp)
+  8029f4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8029f7:	89 c2                	mov    %eax,%edx
+  8029f9:	89 f8                	mov    %edi,%eax
+  8029fb:	e8 c3 fe ff ff       	call   8028c3 <devpipe_read_bulk>
+  802a00:	83 c4 10             	add    $0x10,%esp
+  802a03:	eb 02                	jmp    802a07 <devpipe_read+0x5d>
+        return i;
+  802a05:	89 f0                	mov    %esi,%eax
+}
+  802a07:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a0a:	5b                   	pop    %ebx
+  802a0b:	5e                   	pop    %esi
+  802a0c:	5f                   	pop    %edi
+  802a0d:	5d                   	pop    %ebp
+  802a0e:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802a0f:	99                   	cltd
+  802a10:	c1 ea 1b             	shr    $0x1b,%edx
+  802a13:	01 d0                	add    %edx,%eax
+  802a15:	83 e0 1f             	and    $0x1f,%eax
+  802a18:	29 d0                	sub    %edx,%eax
+  802a1a:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802a1f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802a22:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  802a25:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  802a28:	83 c6 01             	add    $0x1,%esi
+  802a2b:	eb 9b                	jmp    8029c8 <devpipe_read+0x1e>
+  return i;
+  802a2d:	89 f0                	mov    %esi,%eax
+  802a2f:	eb d6                	jmp    802a07 <devpipe_read+0x5d>
+        return 0;
+  802a31:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a36:	eb cf                	jmp    802a07 <devpipe_read+0x5d>
+
+00802a38 <pipe2>:
+{
+  802a38:	55                   	push   %ebp
+  802a39:	89 e5                	mov    %esp,%ebp
+  802a3b:	57                   	push   %edi
+  802a3c:	56                   	push   %esi
+  802a3d:	53                   	push   %ebx
+  802a3e:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  802a41:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802a44:	50                   	push   %eax
+  802a45:	e8 91 eb ff ff       	call   8015db <fd_alloc>
+  802a4a:	89 c3                	mov    %eax,%ebx
+  802a4c:	83 c4 10             	add    $0x10,%esp
+  802a4f:	85 c0                	test   %eax,%eax
+  802a51:	0f 88 fb 01 00 00    	js     802c52 <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802a57:	83 ec 04             	sub    $0x4,%esp
+  802a5a:	68 07 04 00 00       	push   $0x407
+  802a5f:	ff 75 e4             	push   -0x1c(%ebp)
+  802a62:	6a 00                	push   $0x0
+  802a64:	e8 9f e6 ff ff       	call   801108 <sys_page_alloc>
+  802a69:	89 c3                	mov    %eax,%ebx
+  802a6b:	83 c4 10             	add    $0x10,%esp
+  802a6e:	85 c0                	test   %eax,%eax
+  802a70:	0f 88 dc 01 00 00    	js     802c52 <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  802a76:	83 ec 0c             	sub    $0xc,%esp
+  802a79:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  802a7c:	50                   	push   %eax
+  802a7d:	e8 59 eb ff ff       	call   8015db <fd_alloc>
+  802a82:	89 c3                	mov    %eax,%ebx
+  802a84:	83 c4 10             	add    $0x10,%esp
+  802a87:	85 c0                	test   %eax,%eax
+  802a89:	0f 88 b3 01 00 00    	js     802c42 <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802a8f:	83 ec 04             	sub    $0x4,%esp
+  802a92:	68 07 04 00 00       	push   $0x407
+  802a97:	ff 75 e0             	push   -0x20(%ebp)
+  802a9a:	6a 00                	push   $0x0
+  802a9c:	e8 67 e6 ff ff       	call   801108 <sys_page_alloc>
+  802aa1:	89 c3                	mov    %eax,%ebx
+  802aa3:	83 c4 10             	add    $0x10,%esp
+  802aa6:	85 c0                	test   %eax,%eax
+  802aa8:	0f 88 94 01 00 00    	js     802c42 <pipe2+0x20a>
+  va = fd2data(fd0);
+  802aae:	83 ec 0c             	sub    $0xc,%esp
+  802ab1:	ff 75 e4             	push   -0x1c(%ebp)
+  802ab4:	e8 0e eb ff ff       	call   8015c7 <fd2data>
+  802ab9:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802abb:	83 c4 0c             	add    $0xc,%esp
+  802abe:	68 07 04 00 00       	push   $0x407
+  802ac3:	50                   	push   %eax
+  802ac4:	6a 00                	push   $0x0
+  802ac6:	e8 3d e6 ff ff       	call   801108 <sys_page_alloc>
+  802acb:	89 c3                	mov    %eax,%ebx
+  802acd:	83 c4 10             	add    $0x10,%esp
+  802ad0:	85 c0                	test   %eax,%eax
+  802ad2:	0f 88 5a 01 00 00    	js     802c32 <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802ad8:	83 ec 0c             	sub    $0xc,%esp
+  802adb:	ff 75 e0             	push   -0x20(%ebp)
+  802ade:	e8 e4 ea ff ff       	call   8015c7 <fd2data>
+  802ae3:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802aea:	50                   	push   %eax
+  802aeb:	6a 00                	push   $0x0
+  802aed:	57                   	push   %edi
+  802aee:	6a 00                	push   $0x0
+  802af0:	e8 56 e6 ff ff       	call   80114b <sys_page_map>
+  802af5:	89 c3                	mov    %eax,%ebx
+  802af7:	83 c4 20             	add    $0x20,%esp
+  802afa:	85 c0                	test   %eax,%eax
+  802afc:	0f 88 22 01 00 00    	js     802c24 <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  802b02:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  802b06:	74 72                	je     802b7a <pipe2+0x142>
+  802b08:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  802b0d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802b10:	e8 d3 fa ff ff       	call   8025e8 <pipe_ring>
+  802b15:	83 ec 04             	sub    $0x4,%esp
+  802b18:	68 07 04 00 00       	push   $0x407
+  802b1d:	01 f0                	add    %esi,%eax
+  802b1f:	50                   	push   %eax
+  802b20:	6a 00                	push   $0x0
+  802b22:	e8 e1 e5 ff ff       	call   801108 <sys_page_alloc>
+  802b27:	89 c3                	mov    %eax,%ebx
+  802b29:	83 c4 10             	add    $0x10,%esp
+  802b2c:	85 c0                	test   %eax,%eax
+  802b2e:	0f 88 97 00 00 00    	js     802bcb <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  802b34:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802b37:	e8 ac fa ff ff       	call   8025e8 <pipe_ring>
+  802b3c:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  802b3f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802b42:	e8 a1 fa ff ff       	call   8025e8 <pipe_ring>
+  802b47:	83 ec 0c             	sub    $0xc,%esp
+  802b4a:	68 07 04 00 00       	push   $0x407
+  802b4f:	53                   	push   %ebx
+  802b50:	6a 00                	push   $0x0
+  802b52:	01 f0                	add    %esi,%eax
+  802b54:	50                   	push   %eax
+  802b55:	6a 00                	push   $0x0
+  802b57:	e8 ef e5 ff ff       	call   80114b <sys_page_map>
+  802b5c:	89 c3                	mov    %eax,%ebx
+  802b5e:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802b64:	83 c4 20             	add    $0x20,%esp
+  802b67:	85 c0                	test   %eax,%eax
+  802b69:	78 60                	js     802bcb <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  802b6b:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802b71:	75 9a                	jne    802b0d <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  802b73:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  802b7a:	a1 20 50 80 00       	mov    0x805020,%eax
+  802b7f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802b82:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  802b84:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802b87:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  802b8e:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802b91:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  802b93:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802b96:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  802b9d:	83 ec 0c             	sub    $0xc,%esp
+  802ba0:	ff 75 e4             	push   -0x1c(%ebp)
+  802ba3:	e8 0f ea ff ff       	call   8015b7 <fd2num>
+  802ba8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802bab:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  802bad:	83 c4 04             	add    $0x4,%esp
+  802bb0:	ff 75 e0             	push   -0x20(%ebp)
+  802bb3:	e8 ff e9 ff ff       	call   8015b7 <fd2num>
+  802bb8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802bbb:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  802bbe:	83 c4 10             	add    $0x10,%esp
+  802bc1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802bc6:	e9 87 00 00 00       	jmp    802c52 <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802bcb:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  802bd0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802bd3:	e8 10 fa ff ff       	call   8025e8 <pipe_ring>
+  802bd8:	83 ec 08             	sub    $0x8,%esp
+  802bdb:	01 f0                	add    %esi,%eax
+  802bdd:	50                   	push   %eax
+  802bde:	6a 00                	push   $0x0
+  802be0:	e8 a8 e5 ff ff       	call   80118d <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  802be5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802be8:	e8 fb f9 ff ff       	call   8025e8 <pipe_ring>
+  802bed:	83 c4 08             	add    $0x8,%esp
+  802bf0:	01 f0                	add    %esi,%eax
+  802bf2:	50                   	push   %eax
+  802bf3:	6a 00                	push   $0x0
+  802bf5:	e8 93 e5 ff ff       	call   80118d <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802bfa:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802c00:	83 c4 10             	add    $0x10,%esp
+  802c03:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802c09:	75 c5                	jne    802bd0 <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  802c0b:	83 ec 0c             	sub    $0xc,%esp
+  802c0e:	ff 75 e0             	push   -0x20(%ebp)
+  802c11:	e8 b1 e9 ff ff       	call   8015c7 <fd2data>
+  802c16:	83 c4 08             	add    $0x8,%esp
+  802c19:	50                   	push   %eax
+  802c1a:	6a 00                	push   $0x0
+  802c1c:	e8 6c e5 ff ff       	call   80118d <sys_page_unmap>
+  802c21:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  802c24:	83 ec 08             	sub    $0x8,%esp
+  802c27:	57                   	push   %edi
+  802c28:	6a 00                	push   $0x0
+  802c2a:	e8 5e e5 ff ff       	call   80118d <sys_page_unmap>
+  802c2f:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  802c32:	83 ec 08             	sub    $0x8,%esp
+  802c35:	ff 75 e0             	push   -0x20(%ebp)
+  802c38:	6a 00                	push   $0x0
+  802c3a:	e8 4e e5 ff ff       	call   80118d <sys_page_unmap>
+  802c3f:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  802c42:	83 ec 08             	sub    $0x8,%esp
+  802c45:	ff 75 e4             	push   -0x1c(%ebp)
+  802c48:	6a 00                	push   $0x0
+  802c4a:	e8 3e e5 ff ff       	call   80118d <sys_page_unmap>
+  802c4f:	83 c4 10             	add    $0x10,%esp
+}
+  802c52:	89 d8                	mov    %ebx,%eax
+  802c54:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c57:	5b                   	pop    %ebx
+  802c58:	5e                   	pop    %esi
+  802c59:	5f                   	pop    %edi
+  802c5a:	5d                   	pop    %ebp
+  802c5b:	c3                   	ret
+
+00802c5c <pipe>:
+{
+  802c5c:	55                   	push   %ebp
+  802c5d:	89 e5                	mov    %esp,%ebp
+  802c5f:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  802c62:	6a 00                	push   $0x0
+  802c64:	ff 75 08             	push   0x8(%ebp)
+  802c67:	e8 cc fd ff ff       	call   802a38 <pipe2>
+}
+  802c6c:	c9                   	leave
+  802c6d:	c3                   	ret
+
+00802c6e <pipeisclosed>:
+{
+  802c6e:	55                   	push   %ebp
+  802c6f:	89 e5                	mov    %esp,%ebp
+  802c71:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802c74:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802c77:	50                   	push   %eax
+  802c78:	ff 75 08             	push   0x8(%ebp)
+  802c7b:	e8 b1 e9 ff ff       	call   801631 <fd_lookup>
+  802c80:	83 c4 10             	add    $0x10,%esp
+  802c83:	85 c0                	test   %eax,%eax
+  802c85:	78 18                	js     802c9f <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  802c87:	83 ec 0c             	sub    $0xc,%esp
+  802c8a:	ff 75 f4             	push   -0xc(%ebp)
+  802c8d:	e8 35 e9 ff ff       	call   8015c7 <fd2data>
+  802c92:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  802c94:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c97:	e8 59 fa ff ff       	call   8026f5 <_pipeisclosed>
+  802c9c:	83 c4 10             	add    $0x10,%esp
+}
+  802c9f:	c9                   	leave
+  802ca0:	c3                   	ret
+
+00802ca1 <pipe_splice>:
+{
+  802ca1:	55                   	push   %ebp
+  802ca2:	89 e5                	mov    %esp,%ebp
+  802ca4:	57                   	push   %edi
+  802ca5:	56                   	push   %esi
+  802ca6:	53                   	push   %ebx
+  802ca7:	83 ec 34             	sub    $0x34,%esp
+  802caa:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802cad:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802cb0:	50                   	push   %eax
+  802cb1:	ff 75 08             	push   0x8(%ebp)
+  802cb4:	e8 78 e9 ff ff       	call   801631 <fd_lookup>
+  802cb9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802cbc:	83 c4 10             	add    $0x10,%esp
+  802cbf:	85 c0                	test   %eax,%eax
+  802cc1:	0f 88 d7 00 00 00    	js     802d9e <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  802cc7:	83 ec 0c             	sub    $0xc,%esp
+  802cca:	ff 75 e4             	push   -0x1c(%ebp)
+  802ccd:	e8 f5 e8 ff ff       	call   8015c7 <fd2data>
+  802cd2:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802cd4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802cd7:	83 c4 10             	add    $0x10,%esp
+  802cda:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  802ce0:	39 10                	cmp    %edx,(%eax)
+  802ce2:	0f 85 c1 00 00 00    	jne    802da9 <pipe_splice+0x108>
+  802ce8:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  802cec:	0f 84 c0 00 00 00    	je     802db2 <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  802cf2:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802cf6:	0f 84 bf 00 00 00    	je     802dbb <pipe_splice+0x11a>
+  802cfc:	89 f7                	mov    %esi,%edi
+  802cfe:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  802d04:	0f 85 ba 00 00 00    	jne    802dc4 <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802d0a:	8d 43 04             	lea    0x4(%ebx),%eax
+  802d0d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802d10:	eb 38                	jmp    802d4a <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802d12:	83 ec 0c             	sub    $0xc,%esp
+  802d15:	68 00 10 00 00       	push   $0x1000
+  802d1a:	89 f1                	mov    %esi,%ecx
+  802d1c:	89 da                	mov    %ebx,%edx
+  802d1e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802d21:	e8 34 fa ff ff       	call   80275a <devpipe_write_bulk>
+  802d26:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802d29:	83 c4 10             	add    $0x10,%esp
+  802d2c:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802d31:	75 53                	jne    802d86 <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  802d33:	83 ec 08             	sub    $0x8,%esp
+  802d36:	56                   	push   %esi
+  802d37:	6a 00                	push   $0x0
+  802d39:	e8 4f e4 ff ff       	call   80118d <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  802d3e:	83 c7 01             	add    $0x1,%edi
+  802d41:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802d47:	83 c4 10             	add    $0x10,%esp
+  802d4a:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802d4d:	74 3a                	je     802d89 <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  802d4f:	8b 03                	mov    (%ebx),%eax
+  802d51:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802d54:	75 bc                	jne    802d12 <pipe_splice+0x71>
+  802d56:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d5b:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  802d5f:	85 c0                	test   %eax,%eax
+  802d61:	74 af                	je     802d12 <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802d63:	83 ec 04             	sub    $0x4,%esp
+  802d66:	6a 07                	push   $0x7
+  802d68:	56                   	push   %esi
+  802d69:	ff 75 d0             	push   -0x30(%ebp)
+  802d6c:	e8 f3 e6 ff ff       	call   801464 <sys_chan_wakeup>
+  802d71:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802d74:	83 c4 10             	add    $0x10,%esp
+  802d77:	85 c0                	test   %eax,%eax
+  802d79:	79 b8                	jns    802d33 <pipe_splice+0x92>
+  802d7b:	b8 01 00 00 00       	mov    $0x1,%eax
+  802d80:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802d84:	eb 8c                	jmp    802d12 <pipe_splice+0x71>
+  802d86:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  802d89:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802d8d:	75 06                	jne    802d95 <pipe_splice+0xf4>
+  802d8f:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802d93:	78 09                	js     802d9e <pipe_splice+0xfd>
+  return i * PGSIZE;
+  802d95:	8b 45 10             	mov    0x10(%ebp),%eax
+  802d98:	c1 e0 0c             	shl    $0xc,%eax
+  802d9b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  802d9e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802da1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802da4:	5b                   	pop    %ebx
+  802da5:	5e                   	pop    %esi
+  802da6:	5f                   	pop    %edi
+  802da7:	5d                   	pop    %ebp
+  802da8:	c3                   	ret
+    return -E_INVAL;
+  802da9:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802db0:	eb ec                	jmp    802d9e <pipe_splice+0xfd>
+  802db2:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802db9:	eb e3                	jmp    802d9e <pipe_splice+0xfd>
+  802dbb:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802dc2:	eb da                	jmp    802d9e <pipe_splice+0xfd>
+  802dc4:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802dcb:	eb d1                	jmp    802d9e <pipe_splice+0xfd>
+
+00802dcd <pipe_splice_read>:
+{
+  802dcd:	55                   	push   %ebp
+  802dce:	89 e5                	mov    %esp,%ebp
+  802dd0:	53                   	push   %ebx
+  802dd1:	83 ec 1c             	sub    $0x1c,%esp
+  802dd4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802dd7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802dda:	50                   	push   %eax
+  802ddb:	ff 75 08             	push   0x8(%ebp)
+  802dde:	e8 4e e8 ff ff       	call   801631 <fd_lookup>
+  802de3:	83 c4 10             	add    $0x10,%esp
+  802de6:	85 c0                	test   %eax,%eax
+  802de8:	78 49                	js     802e33 <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  802dea:	83 ec 0c             	sub    $0xc,%esp
+  802ded:	ff 75 f4             	push   -0xc(%ebp)
+  802df0:	e8 d2 e7 ff ff       	call   8015c7 <fd2data>
+  802df5:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802df7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802dfa:	83 c4 10             	add    $0x10,%esp
+  802dfd:	8b 0d 20 50 80 00    	mov    0x805020,%ecx
+  802e03:	39 08                	cmp    %ecx,(%eax)
+  802e05:	75 31                	jne    802e38 <pipe_splice_read+0x6b>
+  802e07:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  802e0b:	74 32                	je     802e3f <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  802e0d:	8b 48 08             	mov    0x8(%eax),%ecx
+  802e10:	83 e1 03             	and    $0x3,%ecx
+  802e13:	83 f9 01             	cmp    $0x1,%ecx
+  802e16:	74 2e                	je     802e46 <pipe_splice_read+0x79>
+  802e18:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  802e1e:	75 2d                	jne    802e4d <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  802e20:	83 ec 08             	sub    $0x8,%esp
+  802e23:	53                   	push   %ebx
+  802e24:	68 00 10 00 00       	push   $0x1000
+  802e29:	89 d9                	mov    %ebx,%ecx
+  802e2b:	e8 93 fa ff ff       	call   8028c3 <devpipe_read_bulk>
+  802e30:	83 c4 10             	add    $0x10,%esp
+}
+  802e33:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e36:	c9                   	leave
+  802e37:	c3                   	ret
+    return -E_INVAL;
+  802e38:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e3d:	eb f4                	jmp    802e33 <pipe_splice_read+0x66>
+  802e3f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e44:	eb ed                	jmp    802e33 <pipe_splice_read+0x66>
+  802e46:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e4b:	eb e6                	jmp    802e33 <pipe_splice_read+0x66>
+  802e4d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e52:	eb df                	jmp    802e33 <pipe_splice_read+0x66>
+
+00802e54 <mmap_find>:
+          utf->utf_eip, utf->utf_err);
+}
+
+static struct Mmap *
+mmap_find(uintptr_t va)
+{
+  802e54:	55                   	push   %ebp
+  802e55:	89 e5                	mov    %esp,%ebp
+  802e57:	56                   	push   %esi
+  802e58:	53                   	push   %ebx
+  int i;
+
+  for (i = 0; i < NMMAP; i++)
+  802e59:	ba a0 96 80 00       	mov    $0x8096a0,%edx
+  802e5e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e63:	eb 0b                	jmp    802e70 <mmap_find+0x1c>
+  802e65:	83 c3 01             	add    $0x1,%ebx
+  802e68:	83 c2 14             	add    $0x14,%edx
+  802e6b:	83 fb 10             	cmp    $0x10,%ebx
+  802e6e:	74 1d                	je     802e8d <mmap_find+0x39>
+    if (mmaps[i].mm_va && va >= mmaps[i].mm_va &&
+  802e70:	8b 0a                	mov    (%edx),%ecx
+  802e72:	39 c8                	cmp    %ecx,%eax
+  802e74:	72 ef                	jb     802e65 <mmap_find+0x11>
+  802e76:	85 c9                	test   %ecx,%ecx
+  802e78:	74 eb                	je     802e65 <mmap_find+0x11>
+        va < mmaps[i].mm_va + mmaps[i].mm_len)
+  802e7a:	03 4a 04             	add    0x4(%edx),%ecx
+    if (mmaps[i].mm_va && va >= mmaps[i].mm_va &&
+  802e7d:	39 c8                	cmp    %ecx,%eax
+  802e7f:	73 e4                	jae    802e65 <mmap_find+0x11>
+      return &mmaps[i];
+  802e81:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802e84:	8d 04 85 a0 96 80 00 	lea    0x8096a0(,%eax,4),%eax
+  802e8b:	eb 05                	jmp    802e92 <mmap_find+0x3e>
+  return NULL;
+  802e8d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e92:	5b                   	pop    %ebx
+  802e93:	5e                   	pop    %esi
+  802e94:	5d                   	pop    %ebp
+  802e95:	c3                   	ret
+
+00802e96 <va_mapped>:
+
+static bool
+va_mapped(uintptr_t va)
+{
+  return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+  802e96:	89 c2                	mov    %eax,%edx
+  802e98:	c1 ea 16             	shr    $0x16,%edx
+  802e9b:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802ea2:	f6 c2 01             	test   $0x1,%dl
+  802ea5:	74 11                	je     802eb8 <va_mapped+0x22>
+  802ea7:	c1 e8 0c             	shr    $0xc,%eax
+  802eaa:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802eb1:	83 e0 01             	and    $0x1,%eax
+  802eb4:	83 e0 01             	and    $0x1,%eax
+}
+  802eb7:	c3                   	ret
+  return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+  802eb8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ebd:	eb f5                	jmp    802eb4 <va_mapped+0x1e>
+
+00802ebf <mmap_copy>:
+
+// Replace the page at 'va' with a copy of its first 'n' bytes, the rest
+// zeroed, mapped with 'perm'.
+static void
+mmap_copy(uintptr_t va, size_t n, int perm)
+{
+  802ebf:	55                   	push   %ebp
+  802ec0:	89 e5                	mov    %esp,%ebp
+  802ec2:	57                   	push   %edi
+  802ec3:	56                   	push   %esi
+  802ec4:	53                   	push   %ebx
+  802ec5:	83 ec 10             	sub    $0x10,%esp
+  802ec8:	89 c3                	mov    %eax,%ebx
+  802eca:	89 d7                	mov    %edx,%edi
+  802ecc:	89 ce                	mov    %ecx,%esi
+  int r;
+
+  if ((r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  802ece:	6a 07                	push   $0x7
+  802ed0:	68 00 f0 7f 00       	push   $0x7ff000
+  802ed5:	6a 00                	push   $0x0
+  802ed7:	e8 2c e2 ff ff       	call   801108 <sys_page_alloc>
+  802edc:	83 c4 10             	add    $0x10,%esp
+  802edf:	85 c0                	test   %eax,%eax
+  802ee1:	78 46                	js     802f29 <mmap_copy+0x6a>
+    panic("mmap: %e", r);
+  memmove(PFTEMP, (void *) va, n);
+  802ee3:	83 ec 04             	sub    $0x4,%esp
+  802ee6:	57                   	push   %edi
+  802ee7:	53                   	push   %ebx
+  802ee8:	68 00 f0 7f 00       	push   $0x7ff000
+  802eed:	e8 6d df ff ff       	call   800e5f <memmove>
+  if ((r = sys_page_map(0, PFTEMP, 0, (void *) va, perm)) < 0 ||
+  802ef2:	89 34 24             	mov    %esi,(%esp)
+  802ef5:	53                   	push   %ebx
+  802ef6:	6a 00                	push   $0x0
+  802ef8:	68 00 f0 7f 00       	push   $0x7ff000
+  802efd:	6a 00                	push   $0x0
+  802eff:	e8 47 e2 ff ff       	call   80114b <sys_page_map>
+  802f04:	83 c4 20             	add    $0x20,%esp
+  802f07:	85 c0                	test   %eax,%eax
+  802f09:	78 30                	js     802f3b <mmap_copy+0x7c>
+      (r = sys_page_unmap(0, PFTEMP)) < 0)
+  802f0b:	83 ec 08             	sub    $0x8,%esp
+  802f0e:	68 00 f0 7f 00       	push   $0x7ff000
+  802f13:	6a 00                	push   $0x0
+  802f15:	e8 73 e2 ff ff       	call   80118d <sys_page_unmap>
+  if ((r = sys_page_map(0, PFTEMP, 0, (void *) va, perm)) < 0 ||
+  802f1a:	83 c4 10             	add    $0x10,%esp
+  802f1d:	85 c0                	test   %eax,%eax
+  802f1f:	78 1a                	js     802f3b <mmap_copy+0x7c>
+    panic("mmap: %e", r);
+}
+  802f21:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f24:	5b                   	pop    %ebx
+  802f25:	5e                   	pop    %esi
+  802f26:	5f                   	pop    %edi
+  802f27:	5d                   	pop    %ebp
+  802f28:	c3                   	ret
+    panic("mmap: %e", r);
+  802f29:	50                   	push   %eax
+  802f2a:	68 87 40 80 00       	push   $0x804087
+  802f2f:	6a 3e                	push   $0x3e
+  802f31:	68 90 40 80 00       	push   $0x804090
+  802f36:	e8 d5 d6 ff ff       	call   800610 <_panic>
+    panic("mmap: %e", r);
+  802f3b:	50                   	push   %eax
+  802f3c:	68 87 40 80 00       	push   $0x804087
+  802f41:	6a 42                	push   $0x42
+  802f43:	68 90 40 80 00       	push   $0x804090
+  802f48:	e8 c3 d6 ff ff       	call   800610 <_panic>
+
+00802f4d <mmap_fault>:
+// Handle a page fault in a mapping, if it is one.  Returns 1 if it was.
+// The fork page fault handlers call this first, so that mappings keep
+// working after a fork.
+bool
+mmap_fault(struct UTrapframe *utf)
+{
+  802f4d:	55                   	push   %ebp
+  802f4e:	89 e5                	mov    %esp,%ebp
+  802f50:	57                   	push   %edi
+  802f51:	56                   	push   %esi
+  802f52:	53                   	push   %ebx
+  802f53:	83 ec 1c             	sub    $0x1c,%esp
+  802f56:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Fsreq_read_map saved;
+  struct Mmap *m;
+  uintptr_t va;
+  int perm, r;
+
+  va = ROUNDDOWN(utf->utf_fault_va, PGSIZE);
+  802f59:	8b 1f                	mov    (%edi),%ebx
+  802f5b:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if (va < MMAPBASE || va >= MMAPTOP || (m = mmap_find(va)) == NULL)
+  802f61:	8d 83 00 00 00 60    	lea    0x60000000(%ebx),%eax
+  802f67:	3d ff ff ff 2f       	cmp    $0x2fffffff,%eax
+  802f6c:	0f 87 24 01 00 00    	ja     803096 <mmap_fault+0x149>
+  802f72:	89 d8                	mov    %ebx,%eax
+  802f74:	e8 db fe ff ff       	call   802e54 <mmap_find>
+  802f79:	89 c6                	mov    %eax,%esi
+  802f7b:	85 c0                	test   %eax,%eax
+  802f7d:	0f 84 20 01 00 00    	je     8030a3 <mmap_fault+0x156>
+    return 0;
+  if ((utf->utf_err & FEC_WR) && m->mm_perm == MAP_RDONLY)
+  802f83:	f6 47 04 02          	testb  $0x2,0x4(%edi)
+  802f87:	74 13                	je     802f9c <mmap_fault+0x4f>
+  802f89:	83 78 10 00          	cmpl   $0x0,0x10(%eax)
+  802f8d:	0f 84 17 01 00 00    	je     8030aa <mmap_fault+0x15d>
+    return 0;
+  perm = PTE_P | PTE_U | (m->mm_perm == MAP_RDONLY ? 0 : PTE_W);
+  802f93:	c7 45 e4 07 00 00 00 	movl   $0x7,-0x1c(%ebp)
+  802f9a:	eb 0f                	jmp    802fab <mmap_fault+0x5e>
+  802f9c:	83 78 10 01          	cmpl   $0x1,0x10(%eax)
+  802fa0:	19 c0                	sbb    %eax,%eax
+  802fa2:	83 e0 fe             	and    $0xfffffffe,%eax
+  802fa5:	83 c0 07             	add    $0x7,%eax
+  802fa8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+
+  if (!va_mapped(va)) {
+  802fab:	89 d8                	mov    %ebx,%eax
+  802fad:	e8 e4 fe ff ff       	call   802e96 <va_mapped>
+  802fb2:	84 c0                	test   %al,%al
+  802fb4:	74 42                	je     802ff8 <mmap_fault+0xab>
+    }
+  }
+
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+    mmap_copy(va, PGSIZE, perm);
+  return 1;
+  802fb6:	b8 01 00 00 00       	mov    $0x1,%eax
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+  802fbb:	f6 47 04 02          	testb  $0x2,0x4(%edi)
+  802fbf:	0f 84 d6 00 00 00    	je     80309b <mmap_fault+0x14e>
+  802fc5:	89 d8                	mov    %ebx,%eax
+  802fc7:	c1 e8 0c             	shr    $0xc,%eax
+  802fca:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  return 1;
+  802fd1:	b8 01 00 00 00       	mov    $0x1,%eax
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+  802fd6:	f6 c2 02             	test   $0x2,%dl
+  802fd9:	0f 85 bc 00 00 00    	jne    80309b <mmap_fault+0x14e>
+    mmap_copy(va, PGSIZE, perm);
+  802fdf:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802fe2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802fe7:	89 d8                	mov    %ebx,%eax
+  802fe9:	e8 d1 fe ff ff       	call   802ebf <mmap_copy>
+  return 1;
+  802fee:	b8 01 00 00 00       	mov    $0x1,%eax
+  802ff3:	e9 a3 00 00 00       	jmp    80309b <mmap_fault+0x14e>
+    saved = fsipcbuf.read_map;
+  802ff8:	a1 00 a0 80 00       	mov    0x80a000,%eax
+  802ffd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803000:	8b 15 04 a0 80 00    	mov    0x80a004,%edx
+  803006:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    r = read_map(m->mm_fd, m->mm_offset + (va - m->mm_va), (void *) va);
+  803009:	83 ec 04             	sub    $0x4,%esp
+  80300c:	53                   	push   %ebx
+  80300d:	89 d8                	mov    %ebx,%eax
+  80300f:	03 46 0c             	add    0xc(%esi),%eax
+  803012:	2b 06                	sub    (%esi),%eax
+  803014:	50                   	push   %eax
+  803015:	ff 76 08             	push   0x8(%esi)
+  803018:	e8 86 f3 ff ff       	call   8023a3 <read_map>
+    fsipcbuf.read_map = saved;
+  80301d:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  803020:	89 0d 00 a0 80 00    	mov    %ecx,0x80a000
+  803026:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  803029:	89 15 04 a0 80 00    	mov    %edx,0x80a004
+    if (r < 0)
+  80302f:	83 c4 10             	add    $0x10,%esp
+  803032:	85 c0                	test   %eax,%eax
+  803034:	78 20                	js     803056 <mmap_fault+0x109>
+    if (r == 0) {
+  803036:	74 30                	je     803068 <mmap_fault+0x11b>
+    if (r < PGSIZE) {
+  803038:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  80303d:	0f 8f 73 ff ff ff    	jg     802fb6 <mmap_fault+0x69>
+      mmap_copy(va, r, perm);
+  803043:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803046:	89 c2                	mov    %eax,%edx
+  803048:	89 d8                	mov    %ebx,%eax
+  80304a:	e8 70 fe ff ff       	call   802ebf <mmap_copy>
+      return 1;
+  80304f:	b8 01 00 00 00       	mov    $0x1,%eax
+  803054:	eb 45                	jmp    80309b <mmap_fault+0x14e>
+      panic("mmap: read_map: %e", r);
+  803056:	50                   	push   %eax
+  803057:	68 9b 40 80 00       	push   $0x80409b
+  80305c:	6a 5f                	push   $0x5f
+  80305e:	68 90 40 80 00       	push   $0x804090
+  803063:	e8 a8 d5 ff ff       	call   800610 <_panic>
+      if ((r = sys_page_alloc(0, (void *) va, perm)) < 0)
+  803068:	83 ec 04             	sub    $0x4,%esp
+  80306b:	ff 75 e4             	push   -0x1c(%ebp)
+  80306e:	53                   	push   %ebx
+  80306f:	6a 00                	push   $0x0
+  803071:	e8 92 e0 ff ff       	call   801108 <sys_page_alloc>
+  803076:	83 c4 10             	add    $0x10,%esp
+  803079:	85 c0                	test   %eax,%eax
+  80307b:	78 07                	js     803084 <mmap_fault+0x137>
+      return 1;
+  80307d:	b8 01 00 00 00       	mov    $0x1,%eax
+  803082:	eb 17                	jmp    80309b <mmap_fault+0x14e>
+        panic("mmap: %e", r);
+  803084:	50                   	push   %eax
+  803085:	68 87 40 80 00       	push   $0x804087
+  80308a:	6a 64                	push   $0x64
+  80308c:	68 90 40 80 00       	push   $0x804090
+  803091:	e8 7a d5 ff ff       	call   800610 <_panic>
+    return 0;
+  803096:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80309b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80309e:	5b                   	pop    %ebx
+  80309f:	5e                   	pop    %esi
+  8030a0:	5f                   	pop    %edi
+  8030a1:	5d                   	pop    %ebp
+  8030a2:	c3                   	ret
+    return 0;
+  8030a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030a8:	eb f1                	jmp    80309b <mmap_fault+0x14e>
+    return 0;
+  8030aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030af:	eb ea                	jmp    80309b <mmap_fault+0x14e>
+
+008030b1 <mmap_pgfault>:
+{
+  8030b1:	55                   	push   %ebp
+  8030b2:	89 e5                	mov    %esp,%ebp
+  8030b4:	53                   	push   %ebx
+  8030b5:	83 ec 10             	sub    $0x10,%esp
+  8030b8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (!mmap_fault(utf))
+  8030bb:	53                   	push   %ebx
+  8030bc:	e8 8c fe ff ff       	call   802f4d <mmap_fault>
+  8030c1:	83 c4 10             	add    $0x10,%esp
+  8030c4:	84 c0                	test   %al,%al
+  8030c6:	74 05                	je     8030cd <mmap_pgfault+0x1c>
+}
+  8030c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8030cb:	c9                   	leave
+  8030cc:	c3                   	ret
+    panic("page fault at %08x, eip %08x, err %04x", utf->utf_fault_va,
+  8030cd:	83 ec 08             	sub    $0x8,%esp
+  8030d0:	ff 73 04             	push   0x4(%ebx)
+  8030d3:	ff 73 28             	push   0x28(%ebx)
+  8030d6:	ff 33                	push   (%ebx)
+  8030d8:	68 b0 40 80 00       	push   $0x8040b0
+  8030dd:	6a 20                	push   $0x20
+  8030df:	68 90 40 80 00       	push   $0x804090
+  8030e4:	e8 27 d5 ff ff       	call   800610 <_panic>
+
+008030e9 <mmap>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_INVAL if offset isn't aligned, len is 0, or perm is unknown
+//	-E_NO_MEM if there's no free slot or address space for it
+int
+mmap(int fdnum, off_t offset, size_t len, int perm, void **addr)
+{
+  8030e9:	55                   	push   %ebp
+  8030ea:	89 e5                	mov    %esp,%ebp
+  8030ec:	57                   	push   %edi
+  8030ed:	56                   	push   %esi
+  8030ee:	53                   	push   %ebx
+  8030ef:	83 ec 44             	sub    $0x44,%esp
+  8030f2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  struct Fd *fd;
+  uintptr_t va;
+  int i, j, r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8030f5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8030f8:	50                   	push   %eax
+  8030f9:	ff 75 08             	push   0x8(%ebp)
+  8030fc:	e8 30 e5 ff ff       	call   801631 <fd_lookup>
+  803101:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  803104:	83 c4 10             	add    $0x10,%esp
+  803107:	85 c0                	test   %eax,%eax
+  803109:	0f 88 3e 01 00 00    	js     80324d <mmap+0x164>
+    return r;
+  if (offset < 0 || PGOFF(offset) || len == 0 ||
+  80310f:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803113:	0f 88 d1 00 00 00    	js     8031ea <mmap+0x101>
+  803119:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80311c:	25 ff 0f 00 00       	and    $0xfff,%eax
+  803121:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  803124:	0f 85 c9 00 00 00    	jne    8031f3 <mmap+0x10a>
+  80312a:	85 db                	test   %ebx,%ebx
+  80312c:	0f 84 ca 00 00 00    	je     8031fc <mmap+0x113>
+  803132:	83 7d 14 02          	cmpl   $0x2,0x14(%ebp)
+  803136:	0f 87 c0 00 00 00    	ja     8031fc <mmap+0x113>
+      (perm != MAP_RDONLY && perm != MAP_PRIVATE && perm != MAP_SHARED))
+    return -E_INVAL;
+  len = ROUNDUP(len, PGSIZE);
+  80313c:	81 c3 ff 0f 00 00    	add    $0xfff,%ebx
+  803142:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  803148:	89 d9                	mov    %ebx,%ecx
+  80314a:	89 5d c4             	mov    %ebx,-0x3c(%ebp)
+
+  // First fit: try the start of the region and the end of each
+  // mapping.
+  for (i = -1; i < NMMAP; i++) {
+  80314d:	bb 8c 96 80 00       	mov    $0x80968c,%ebx
+  803152:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+    if (i >= 0 && !mmaps[i].mm_va)
+      continue;
+    va = i < 0 ? MMAPBASE : mmaps[i].mm_va + mmaps[i].mm_len;
+  803157:	bf 00 00 00 a0       	mov    $0xa0000000,%edi
+  80315c:	eb 53                	jmp    8031b1 <mmap+0xc8>
+  80315e:	bf 00 00 00 a0       	mov    $0xa0000000,%edi
+  803163:	eb 4c                	jmp    8031b1 <mmap+0xc8>
+    if (len > MMAPTOP - va)
+      continue;
+    for (j = 0; j < NMMAP; j++)
+  803165:	83 c0 01             	add    $0x1,%eax
+  803168:	83 f8 10             	cmp    $0x10,%eax
+  80316b:	0f 84 e7 00 00 00    	je     803258 <mmap+0x16f>
+      if (mmaps[j].mm_va && va < mmaps[j].mm_va + mmaps[j].mm_len &&
+  803171:	8d 34 80             	lea    (%eax,%eax,4),%esi
+  803174:	8b 14 b5 a0 96 80 00 	mov    0x8096a0(,%esi,4),%edx
+  80317b:	85 d2                	test   %edx,%edx
+  80317d:	74 e6                	je     803165 <mmap+0x7c>
+  80317f:	89 d1                	mov    %edx,%ecx
+  803181:	03 0c b5 a4 96 80 00 	add    0x8096a4(,%esi,4),%ecx
+  803188:	39 cf                	cmp    %ecx,%edi
+  80318a:	73 d9                	jae    803165 <mmap+0x7c>
+  80318c:	39 da                	cmp    %ebx,%edx
+  80318e:	73 d5                	jae    803165 <mmap+0x7c>
+  803190:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  803193:	8b 55 cc             	mov    -0x34(%ebp),%edx
+  803196:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  for (i = -1; i < NMMAP; i++) {
+  803199:	83 c2 01             	add    $0x1,%edx
+  80319c:	83 c3 14             	add    $0x14,%ebx
+  80319f:	83 fa 10             	cmp    $0x10,%edx
+  8031a2:	74 2b                	je     8031cf <mmap+0xe6>
+    if (i >= 0 && !mmaps[i].mm_va)
+  8031a4:	85 d2                	test   %edx,%edx
+  8031a6:	78 b6                	js     80315e <mmap+0x75>
+  8031a8:	8b 3b                	mov    (%ebx),%edi
+  8031aa:	85 ff                	test   %edi,%edi
+  8031ac:	74 eb                	je     803199 <mmap+0xb0>
+    va = i < 0 ? MMAPBASE : mmaps[i].mm_va + mmaps[i].mm_len;
+  8031ae:	03 7b 04             	add    0x4(%ebx),%edi
+    if (len > MMAPTOP - va)
+  8031b1:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8031b6:	29 f8                	sub    %edi,%eax
+  8031b8:	39 c8                	cmp    %ecx,%eax
+  8031ba:	72 dd                	jb     803199 <mmap+0xb0>
+    for (j = 0; j < NMMAP; j++)
+  8031bc:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+          mmaps[j].mm_va < va + len)
+  8031bf:	8d 34 0f             	lea    (%edi,%ecx,1),%esi
+  8031c2:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  8031c5:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  8031c8:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+  8031cb:	89 f3                	mov    %esi,%ebx
+  8031cd:	eb a2                	jmp    803171 <mmap+0x88>
+        break;
+    if (j == NMMAP)
+      break;
+  }
+  if (i == NMMAP)
+    return -E_NO_MEM;
+  8031cf:	c7 45 d4 fc ff ff ff 	movl   $0xfffffffc,-0x2c(%ebp)
+  8031d6:	eb 75                	jmp    80324d <mmap+0x164>
+    ;
+  if (j == NMMAP)
+    return -E_NO_MEM;
+
+  if (_pgfault_handler == 0)
+    set_pgfault_handler(mmap_pgfault);
+  8031d8:	83 ec 0c             	sub    $0xc,%esp
+  8031db:	68 b1 30 80 00       	push   $0x8030b1
+  8031e0:	e8 f7 03 00 00       	call   8035dc <set_pgfault_handler>
+  8031e5:	83 c4 10             	add    $0x10,%esp
+  8031e8:	eb 24                	jmp    80320e <mmap+0x125>
+    return -E_INVAL;
+  8031ea:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  8031f1:	eb 5a                	jmp    80324d <mmap+0x164>
+  8031f3:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  8031fa:	eb 51                	jmp    80324d <mmap+0x164>
+  8031fc:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  803203:	eb 48                	jmp    80324d <mmap+0x164>
+  if (_pgfault_handler == 0)
+  803205:	83 3d 00 b0 80 00 00 	cmpl   $0x0,0x80b000
+  80320c:	74 ca                	je     8031d8 <mmap+0xef>
+
+  mmaps[j].mm_va = va;
+  80320e:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803215:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803218:	c1 e2 02             	shl    $0x2,%edx
+  80321b:	89 ba a0 96 80 00    	mov    %edi,0x8096a0(%edx)
+  mmaps[j].mm_len = len;
+  803221:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  803224:	89 b2 a4 96 80 00    	mov    %esi,0x8096a4(%edx)
+  mmaps[j].mm_fd = fdnum;
+  80322a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80322d:	89 b2 a8 96 80 00    	mov    %esi,0x8096a8(%edx)
+  mmaps[j].mm_offset = offset;
+  803233:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803236:	89 b2 ac 96 80 00    	mov    %esi,0x8096ac(%edx)
+  mmaps[j].mm_perm = perm;
+  80323c:	01 d8                	add    %ebx,%eax
+  80323e:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  803241:	89 1c 85 b0 96 80 00 	mov    %ebx,0x8096b0(,%eax,4)
+  *addr = (void *) va;
+  803248:	8b 45 18             	mov    0x18(%ebp),%eax
+  80324b:	89 38                	mov    %edi,(%eax)
+  return 0;
+}
+  80324d:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  803250:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803253:	5b                   	pop    %ebx
+  803254:	5e                   	pop    %esi
+  803255:	5f                   	pop    %edi
+  803256:	5d                   	pop    %ebp
+  803257:	c3                   	ret
+  if (i == NMMAP)
+  803258:	b8 a0 96 80 00       	mov    $0x8096a0,%eax
+  for (j = 0; j < NMMAP && mmaps[j].mm_va; j++)
+  80325d:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+  803260:	83 c0 14             	add    $0x14,%eax
+  803263:	83 78 ec 00          	cmpl   $0x0,-0x14(%eax)
+  803267:	74 9c                	je     803205 <mmap+0x11c>
+  803269:	83 c3 01             	add    $0x1,%ebx
+  80326c:	83 fb 10             	cmp    $0x10,%ebx
+  80326f:	75 ef                	jne    803260 <mmap+0x177>
+    return -E_NO_MEM;
+  803271:	c7 45 d4 fc ff ff ff 	movl   $0xfffffffc,-0x2c(%ebp)
+  803278:	eb d3                	jmp    80324d <mmap+0x164>
+
+0080327a <msync>:
+// nothing for other kinds of mapping.
+//
+// Returns 0 on success, < 0 on error.
+int
+msync(void *addr)
+{
+  80327a:	55                   	push   %ebp
+  80327b:	89 e5                	mov    %esp,%ebp
+  80327d:	57                   	push   %edi
+  80327e:	56                   	push   %esi
+  80327f:	53                   	push   %ebx
+  803280:	81 ec ac 00 00 00    	sub    $0xac,%esp
+  struct Stat st;
+  off_t saved, off;
+  uintptr_t va;
+  int n, r;
+
+  if ((m = mmap_find((uintptr_t) addr)) == NULL)
+  803286:	8b 45 08             	mov    0x8(%ebp),%eax
+  803289:	e8 c6 fb ff ff       	call   802e54 <mmap_find>
+  80328e:	85 c0                	test   %eax,%eax
+  803290:	0f 84 58 01 00 00    	je     8033ee <msync+0x174>
+  803296:	89 c7                	mov    %eax,%edi
+    return -E_INVAL;
+  if (m->mm_perm != MAP_SHARED)
+    return 0;
+  803298:	bb 00 00 00 00       	mov    $0x0,%ebx
+  if (m->mm_perm != MAP_SHARED)
+  80329d:	83 78 10 02          	cmpl   $0x2,0x10(%eax)
+  8032a1:	74 0a                	je     8032ad <msync+0x33>
+                          PTE_P | PTE_U | PTE_W)) < 0)
+      break;
+  }
+  fd->fd_offset = saved;
+  return r < 0 ? r : 0;
+}
+  8032a3:	89 d8                	mov    %ebx,%eax
+  8032a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8032a8:	5b                   	pop    %ebx
+  8032a9:	5e                   	pop    %esi
+  8032aa:	5f                   	pop    %edi
+  8032ab:	5d                   	pop    %ebp
+  8032ac:	c3                   	ret
+  if ((r = fd_lookup(m->mm_fd, &fd)) < 0 || (r = fstat(m->mm_fd, &st)) < 0)
+  8032ad:	83 ec 08             	sub    $0x8,%esp
+  8032b0:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8032b3:	50                   	push   %eax
+  8032b4:	ff 77 08             	push   0x8(%edi)
+  8032b7:	e8 75 e3 ff ff       	call   801631 <fd_lookup>
+  8032bc:	89 c3                	mov    %eax,%ebx
+  8032be:	83 c4 10             	add    $0x10,%esp
+  8032c1:	85 c0                	test   %eax,%eax
+  8032c3:	78 de                	js     8032a3 <msync+0x29>
+  8032c5:	83 ec 08             	sub    $0x8,%esp
+  8032c8:	8d 85 58 ff ff ff    	lea    -0xa8(%ebp),%eax
+  8032ce:	50                   	push   %eax
+  8032cf:	ff 77 08             	push   0x8(%edi)
+  8032d2:	e8 fd e7 ff ff       	call   801ad4 <fstat>
+  8032d7:	89 c3                	mov    %eax,%ebx
+  8032d9:	83 c4 10             	add    $0x10,%esp
+  8032dc:	85 c0                	test   %eax,%eax
+  8032de:	78 c3                	js     8032a3 <msync+0x29>
+  saved = fd->fd_offset;
+  8032e0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8032e3:	8b 40 04             	mov    0x4(%eax),%eax
+  8032e6:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%ebp)
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE) {
+  8032ec:	8b 37                	mov    (%edi),%esi
+  8032ee:	eb 29                	jmp    803319 <msync+0x9f>
+    if ((r = sys_page_map(0, (void *) va, 0, (void *) va,
+  8032f0:	83 ec 0c             	sub    $0xc,%esp
+  8032f3:	6a 07                	push   $0x7
+  8032f5:	8b 85 50 ff ff ff    	mov    -0xb0(%ebp),%eax
+  8032fb:	50                   	push   %eax
+  8032fc:	6a 00                	push   $0x0
+  8032fe:	50                   	push   %eax
+  8032ff:	6a 00                	push   $0x0
+  803301:	e8 45 de ff ff       	call   80114b <sys_page_map>
+  803306:	89 c3                	mov    %eax,%ebx
+  803308:	83 c4 20             	add    $0x20,%esp
+  80330b:	85 c0                	test   %eax,%eax
+  80330d:	0f 88 c0 00 00 00    	js     8033d3 <msync+0x159>
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE) {
+  803313:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803319:	8b 07                	mov    (%edi),%eax
+  80331b:	89 85 54 ff ff ff    	mov    %eax,-0xac(%ebp)
+  803321:	03 47 04             	add    0x4(%edi),%eax
+  803324:	39 c6                	cmp    %eax,%esi
+  803326:	0f 83 a7 00 00 00    	jae    8033d3 <msync+0x159>
+    if (!va_mapped(va) || !(uvpt[PGNUM(va)] & PTE_D))
+  80332c:	89 f0                	mov    %esi,%eax
+  80332e:	e8 63 fb ff ff       	call   802e96 <va_mapped>
+  803333:	84 c0                	test   %al,%al
+  803335:	74 dc                	je     803313 <msync+0x99>
+  803337:	89 f0                	mov    %esi,%eax
+  803339:	c1 e8 0c             	shr    $0xc,%eax
+  80333c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803343:	a8 40                	test   $0x40,%al
+  803345:	74 cc                	je     803313 <msync+0x99>
+    off = m->mm_offset + (va - m->mm_va);
+  803347:	8b 47 0c             	mov    0xc(%edi),%eax
+  80334a:	8b 8d 54 ff ff ff    	mov    -0xac(%ebp),%ecx
+  803350:	29 c8                	sub    %ecx,%eax
+  803352:	01 f0                	add    %esi,%eax
+    if (off >= st.st_size)
+  803354:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  803357:	39 c2                	cmp    %eax,%edx
+  803359:	7e 78                	jle    8033d3 <msync+0x159>
+    n = MIN(PGSIZE, st.st_size - off);
+  80335b:	29 c2                	sub    %eax,%edx
+  80335d:	89 d1                	mov    %edx,%ecx
+  80335f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803364:	39 d1                	cmp    %edx,%ecx
+  803366:	0f 4e d1             	cmovle %ecx,%edx
+  803369:	89 95 54 ff ff ff    	mov    %edx,-0xac(%ebp)
+    if ((r = seek(m->mm_fd, off)) < 0 ||
+  80336f:	83 ec 08             	sub    $0x8,%esp
+  803372:	50                   	push   %eax
+  803373:	ff 77 08             	push   0x8(%edi)
+  803376:	e8 b1 e6 ff ff       	call   801a2c <seek>
+  80337b:	89 c3                	mov    %eax,%ebx
+  80337d:	83 c4 10             	add    $0x10,%esp
+  803380:	85 c0                	test   %eax,%eax
+  803382:	78 4f                	js     8033d3 <msync+0x159>
+        (r = write(m->mm_fd, (void *) va, n)) < 0)
+  803384:	89 b5 50 ff ff ff    	mov    %esi,-0xb0(%ebp)
+  80338a:	83 ec 04             	sub    $0x4,%esp
+  80338d:	ff b5 54 ff ff ff    	push   -0xac(%ebp)
+  803393:	56                   	push   %esi
+  803394:	ff 77 08             	push   0x8(%edi)
+  803397:	e8 0e e6 ff ff       	call   8019aa <write>
+  80339c:	89 c3                	mov    %eax,%ebx
+    if ((r = seek(m->mm_fd, off)) < 0 ||
+  80339e:	83 c4 10             	add    $0x10,%esp
+  8033a1:	85 c0                	test   %eax,%eax
+  8033a3:	78 2e                	js     8033d3 <msync+0x159>
+    if (r < n && (r = write(m->mm_fd, (char *) va + r, n - r)) < 0)
+  8033a5:	8b 95 54 ff ff ff    	mov    -0xac(%ebp),%edx
+  8033ab:	39 c2                	cmp    %eax,%edx
+  8033ad:	0f 8e 3d ff ff ff    	jle    8032f0 <msync+0x76>
+  8033b3:	89 d0                	mov    %edx,%eax
+  8033b5:	29 d8                	sub    %ebx,%eax
+  8033b7:	01 f3                	add    %esi,%ebx
+  8033b9:	83 ec 04             	sub    $0x4,%esp
+  8033bc:	50                   	push   %eax
+  8033bd:	53                   	push   %ebx
+  8033be:	ff 77 08             	push   0x8(%edi)
+  8033c1:	e8 e4 e5 ff ff       	call   8019aa <write>
+  8033c6:	89 c3                	mov    %eax,%ebx
+  8033c8:	83 c4 10             	add    $0x10,%esp
+  8033cb:	85 c0                	test   %eax,%eax
+  8033cd:	0f 89 1d ff ff ff    	jns    8032f0 <msync+0x76>
+  fd->fd_offset = saved;
+  8033d3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8033d6:	8b 8d 4c ff ff ff    	mov    -0xb4(%ebp),%ecx
+  8033dc:	89 48 04             	mov    %ecx,0x4(%eax)
+  return r < 0 ? r : 0;
+  8033df:	85 db                	test   %ebx,%ebx
+  8033e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033e6:	0f 4f d8             	cmovg  %eax,%ebx
+  8033e9:	e9 b5 fe ff ff       	jmp    8032a3 <msync+0x29>
+    return -E_INVAL;
+  8033ee:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8033f3:	e9 ab fe ff ff       	jmp    8032a3 <msync+0x29>
+
+008033f8 <munmap>:
+// Remove the mapping at 'addr', writing a MAP_SHARED one back first.
+//
+// Returns 0 on success, < 0 on error.
+int
+munmap(void *addr)
+{
+  8033f8:	55                   	push   %ebp
+  8033f9:	89 e5                	mov    %esp,%ebp
+  8033fb:	56                   	push   %esi
+  8033fc:	53                   	push   %ebx
+  8033fd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct Mmap *m;
+  uintptr_t va;
+  int r;
+
+  if ((m = mmap_find((uintptr_t) addr)) == NULL)
+  803400:	89 d8                	mov    %ebx,%eax
+  803402:	e8 4d fa ff ff       	call   802e54 <mmap_find>
+  803407:	85 c0                	test   %eax,%eax
+  803409:	74 56                	je     803461 <munmap+0x69>
+  80340b:	89 c6                	mov    %eax,%esi
+    return -E_INVAL;
+  if ((r = msync(addr)) < 0)
+  80340d:	83 ec 0c             	sub    $0xc,%esp
+  803410:	53                   	push   %ebx
+  803411:	e8 64 fe ff ff       	call   80327a <msync>
+  803416:	83 c4 10             	add    $0x10,%esp
+  803419:	85 c0                	test   %eax,%eax
+  80341b:	78 3d                	js     80345a <munmap+0x62>
+    return r;
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE)
+  80341d:	8b 1e                	mov    (%esi),%ebx
+  80341f:	eb 06                	jmp    803427 <munmap+0x2f>
+  803421:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803427:	8b 46 04             	mov    0x4(%esi),%eax
+  80342a:	03 06                	add    (%esi),%eax
+  80342c:	39 c3                	cmp    %eax,%ebx
+  80342e:	73 1f                	jae    80344f <munmap+0x57>
+    if (va_mapped(va) && (r = sys_page_unmap(0, (void *) va)) < 0)
+  803430:	89 d8                	mov    %ebx,%eax
+  803432:	e8 5f fa ff ff       	call   802e96 <va_mapped>
+  803437:	84 c0                	test   %al,%al
+  803439:	74 e6                	je     803421 <munmap+0x29>
+  80343b:	83 ec 08             	sub    $0x8,%esp
+  80343e:	53                   	push   %ebx
+  80343f:	6a 00                	push   $0x0
+  803441:	e8 47 dd ff ff       	call   80118d <sys_page_unmap>
+  803446:	83 c4 10             	add    $0x10,%esp
+  803449:	85 c0                	test   %eax,%eax
+  80344b:	79 d4                	jns    803421 <munmap+0x29>
+  80344d:	eb 0b                	jmp    80345a <munmap+0x62>
+      return r;
+  m->mm_va = 0;
+  80344f:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  return 0;
+  803455:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80345a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80345d:	5b                   	pop    %ebx
+  80345e:	5e                   	pop    %esi
+  80345f:	5d                   	pop    %ebp
+  803460:	c3                   	ret
+    return -E_INVAL;
+  803461:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803466:	eb f2                	jmp    80345a <munmap+0x62>
+
+00803468 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  803468:	b8 00 00 00 00       	mov    $0x0,%eax
+  80346d:	c3                   	ret
+
+0080346e <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80346e:	55                   	push   %ebp
+  80346f:	89 e5                	mov    %esp,%ebp
+  803471:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  803474:	68 d7 40 80 00       	push   $0x8040d7
+  803479:	ff 75 0c             	push   0xc(%ebp)
+  80347c:	e8 58 d8 ff ff       	call   800cd9 <strcpy>
+  return 0;
+}
+  803481:	b8 00 00 00 00       	mov    $0x0,%eax
+  803486:	c9                   	leave
+  803487:	c3                   	ret
+
+00803488 <devcons_write>:
+{
+  803488:	55                   	push   %ebp
+  803489:	89 e5                	mov    %esp,%ebp
+  80348b:	57                   	push   %edi
+  80348c:	56                   	push   %esi
+  80348d:	53                   	push   %ebx
+  80348e:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  803494:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  803499:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  80349f:	eb 2e                	jmp    8034cf <devcons_write+0x47>
+    m = n - tot;
+  8034a1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8034a4:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  8034a6:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8034ab:	39 c3                	cmp    %eax,%ebx
+  8034ad:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  8034b0:	83 ec 04             	sub    $0x4,%esp
+  8034b3:	53                   	push   %ebx
+  8034b4:	89 f0                	mov    %esi,%eax
+  8034b6:	03 45 0c             	add    0xc(%ebp),%eax
+  8034b9:	50                   	push   %eax
+  8034ba:	57                   	push   %edi
+  8034bb:	e8 9f d9 ff ff       	call   800e5f <memmove>
+    sys_cputs(buf, m);
+  8034c0:	83 c4 08             	add    $0x8,%esp
+  8034c3:	53                   	push   %ebx
+  8034c4:	57                   	push   %edi
+  8034c5:	e8 3f db ff ff       	call   801009 <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  8034ca:	01 de                	add    %ebx,%esi
+  8034cc:	83 c4 10             	add    $0x10,%esp
+  8034cf:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8034d2:	72 cd                	jb     8034a1 <devcons_write+0x19>
+}
+  8034d4:	89 f0                	mov    %esi,%eax
+  8034d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8034d9:	5b                   	pop    %ebx
+  8034da:	5e                   	pop    %esi
+  8034db:	5f                   	pop    %edi
+  8034dc:	5d                   	pop    %ebp
+  8034dd:	c3                   	ret
+
+008034de <devcons_read>:
+{
+  8034de:	55                   	push   %ebp
+  8034df:	89 e5                	mov    %esp,%ebp
+  8034e1:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  8034e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034e9:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8034ed:	75 07                	jne    8034f6 <devcons_read+0x18>
+  8034ef:	eb 1f                	jmp    803510 <devcons_read+0x32>
+    sys_yield();
+  8034f1:	e8 b0 db ff ff       	call   8010a6 <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  8034f6:	e8 2c db ff ff       	call   801027 <sys_cgetc>
+  8034fb:	85 c0                	test   %eax,%eax
+  8034fd:	74 f2                	je     8034f1 <devcons_read+0x13>
+  if (c < 0)
+  8034ff:	78 0f                	js     803510 <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  803501:	83 f8 04             	cmp    $0x4,%eax
+  803504:	74 0c                	je     803512 <devcons_read+0x34>
+  *(char*)vbuf = c;
+  803506:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803509:	88 02                	mov    %al,(%edx)
+  return 1;
+  80350b:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803510:	c9                   	leave
+  803511:	c3                   	ret
+    return 0;
+  803512:	b8 00 00 00 00       	mov    $0x0,%eax
+  803517:	eb f7                	jmp    803510 <devcons_read+0x32>
+
+00803519 <cputchar>:
+{
+  803519:	55                   	push   %ebp
+  80351a:	89 e5                	mov    %esp,%ebp
+  80351c:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  80351f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803522:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  803525:	6a 01                	push   $0x1
+  803527:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80352a:	50                   	push   %eax
+  80352b:	e8 d9 da ff ff       	call   801009 <sys_cputs>
+}
+  803530:	83 c4 10             	add    $0x10,%esp
+  803533:	c9                   	leave
+  803534:	c3                   	ret
+
+00803535 <getchar>:
+{
+  803535:	55                   	push   %ebp
+  803536:	89 e5                	mov    %esp,%ebp
+  803538:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  80353b:	6a 01                	push   $0x1
+  80353d:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803540:	50                   	push   %eax
+  803541:	6a 00                	push   $0x0
+  803543:	e8 94 e3 ff ff       	call   8018dc <read>
+  if (r < 0)
+  803548:	83 c4 10             	add    $0x10,%esp
+  80354b:	85 c0                	test   %eax,%eax
+  80354d:	78 06                	js     803555 <getchar+0x20>
+  if (r < 1)
+  80354f:	74 06                	je     803557 <getchar+0x22>
+  return c;
+  803551:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803555:	c9                   	leave
+  803556:	c3                   	ret
+    return -E_EOF;
+  803557:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80355c:	eb f7                	jmp    803555 <getchar+0x20>
+
+0080355e <iscons>:
+{
+  80355e:	55                   	push   %ebp
+  80355f:	89 e5                	mov    %esp,%ebp
+  803561:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803564:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803567:	50                   	push   %eax
+  803568:	ff 75 08             	push   0x8(%ebp)
+  80356b:	e8 c1 e0 ff ff       	call   801631 <fd_lookup>
+  803570:	83 c4 10             	add    $0x10,%esp
+  803573:	85 c0                	test   %eax,%eax
+  803575:	78 11                	js     803588 <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  803577:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80357a:	8b 15 3c 50 80 00    	mov    0x80503c,%edx
+  803580:	39 10                	cmp    %edx,(%eax)
+  803582:	0f 94 c0             	sete   %al
+  803585:	0f b6 c0             	movzbl %al,%eax
+}
+  803588:	c9                   	leave
+  803589:	c3                   	ret
+
+0080358a <opencons>:
+{
+  80358a:	55                   	push   %ebp
+  80358b:	89 e5                	mov    %esp,%ebp
+  80358d:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  803590:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803593:	50                   	push   %eax
+  803594:	e8 42 e0 ff ff       	call   8015db <fd_alloc>
+  803599:	83 c4 10             	add    $0x10,%esp
+  80359c:	85 c0                	test   %eax,%eax
+  80359e:	78 3a                	js     8035da <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8035a0:	83 ec 04             	sub    $0x4,%esp
+  8035a3:	68 07 04 00 00       	push   $0x407
+  8035a8:	ff 75 f4             	push   -0xc(%ebp)
+  8035ab:	6a 00                	push   $0x0
+  8035ad:	e8 56 db ff ff       	call   801108 <sys_page_alloc>
+  8035b2:	83 c4 10             	add    $0x10,%esp
+  8035b5:	85 c0                	test   %eax,%eax
+  8035b7:	78 21                	js     8035da <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  8035b9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8035bc:	8b 15 3c 50 80 00    	mov    0x80503c,%edx
+  8035c2:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  8035c4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8035c7:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  8035ce:	83 ec 0c             	sub    $0xc,%esp
+  8035d1:	50                   	push   %eax
+  8035d2:	e8 e0 df ff ff       	call   8015b7 <fd2num>
+  8035d7:	83 c4 10             	add    $0x10,%esp
+}
+  8035da:	c9                   	leave
+  8035db:	c3                   	ret
+
+008035dc <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8035dc:	55                   	push   %ebp
+  8035dd:	89 e5                	mov    %esp,%ebp
+  8035df:	53                   	push   %ebx
+  8035e0:	83 ec 04             	sub    $0x4,%esp
+  int r;
+
+  if (_pgfault_handler == 0) {
+  8035e3:	83 3d 00 b0 80 00 00 	cmpl   $0x0,0x80b000
+  8035ea:	74 0d                	je     8035f9 <set_pgfault_handler+0x1d>
+
+    sys_env_set_pgfault_upcall(id, _pgfault_upcall);
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  8035ec:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035ef:	a3 00 b0 80 00       	mov    %eax,0x80b000
+}
+  8035f4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8035f7:	c9                   	leave
+  8035f8:	c3                   	ret
+    envid_t id = sys_getenvid();
+  8035f9:	e8 89 da ff ff       	call   801087 <sys_getenvid>
+  8035fe:	89 c3                	mov    %eax,%ebx
+    sys_page_alloc(id, (void *) (UXSTACKTOP - PGSIZE), (PTE_P | PTE_U | PTE_W));
+  803600:	83 ec 04             	sub    $0x4,%esp
+  803603:	6a 07                	push   $0x7
+  803605:	68 00 f0 bf ee       	push   $0xeebff000
+  80360a:	50                   	push   %eax
+  80360b:	e8 f8 da ff ff       	call   801108 <sys_page_alloc>
+    sys_env_set_pgfault_upcall(id, _pgfault_upcall);
+  803610:	83 c4 08             	add    $0x8,%esp
+  803613:	68 23 36 80 00       	push   $0x803623
+  803618:	53                   	push   %ebx
+  803619:	e8 5f dd ff ff       	call   80137d <sys_env_set_pgfault_upcall>
+  80361e:	83 c4 10             	add    $0x10,%esp
+  803621:	eb c9                	jmp    8035ec <set_pgfault_handler+0x10>
+
+00803623 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  803623:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  803624:	a1 00 b0 80 00       	mov    0x80b000,%eax
+	call *%eax
+  803629:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80362b:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+  movl 48(%esp), %eax       // move trap time esp to eax
+  80362e:	8b 44 24 30          	mov    0x30(%esp),%eax
+  subl $4, %eax             // make room for eip on trap time esp
+  803632:	83 e8 04             	sub    $0x4,%eax
+  movl %eax, 48(%esp)       // move value to esp
+  803635:	89 44 24 30          	mov    %eax,0x30(%esp)
+  movl 40(%esp), %ebx       // move trap time eip to ebx
+  803639:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+  movl %ebx, 0(%eax)
+  80363d:	89 18                	mov    %ebx,(%eax)
+
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+  addl $0x08,%esp
+  80363f:	83 c4 08             	add    $0x8,%esp
+  popal
+  803642:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+  addl $4, %esp          // skip tf->eip
+  803643:	83 c4 04             	add    $0x4,%esp
+  popf                 // pop stack value into flags register
+  803646:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+  popl %esp
+  803647:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+  ret
+  803648:	c3                   	ret
+
+00803649 <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  803649:	55                   	push   %ebp
+  80364a:	89 e5                	mov    %esp,%ebp
+  80364c:	57                   	push   %edi
+  80364d:	56                   	push   %esi
+  80364e:	53                   	push   %ebx
+  80364f:	83 ec 14             	sub    $0x14,%esp
+  803652:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803655:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803658:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80365b:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  80365e:	85 c0                	test   %eax,%eax
+  803660:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803665:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  803668:	ff 33                	push   (%ebx)
+  80366a:	50                   	push   %eax
+  80366b:	e8 70 dd ff ff       	call   8013e0 <sys_ipc_recv>
+  803670:	83 c4 10             	add    $0x10,%esp
+  803673:	85 c0                	test   %eax,%eax
+  803675:	78 39                	js     8036b0 <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  803677:	85 ff                	test   %edi,%edi
+  803679:	74 0a                	je     803685 <ipc_recv_pages+0x3c>
+  80367b:	a1 e0 97 80 00       	mov    0x8097e0,%eax
+  803680:	8b 40 7c             	mov    0x7c(%eax),%eax
+  803683:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803685:	85 f6                	test   %esi,%esi
+  803687:	74 0d                	je     803696 <ipc_recv_pages+0x4d>
+  803689:	a1 e0 97 80 00       	mov    0x8097e0,%eax
+  80368e:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  803694:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  803696:	a1 e0 97 80 00       	mov    0x8097e0,%eax
+  80369b:	8b 40 74             	mov    0x74(%eax),%eax
+  80369e:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  8036a0:	a1 e0 97 80 00       	mov    0x8097e0,%eax
+  8036a5:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  8036a8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8036ab:	5b                   	pop    %ebx
+  8036ac:	5e                   	pop    %esi
+  8036ad:	5f                   	pop    %edi
+  8036ae:	5d                   	pop    %ebp
+  8036af:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  8036b0:	85 ff                	test   %edi,%edi
+  8036b2:	74 06                	je     8036ba <ipc_recv_pages+0x71>
+  8036b4:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  8036ba:	85 f6                	test   %esi,%esi
+  8036bc:	74 06                	je     8036c4 <ipc_recv_pages+0x7b>
+  8036be:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  8036c4:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  8036ca:	eb dc                	jmp    8036a8 <ipc_recv_pages+0x5f>
+
+008036cc <ipc_recv>:
+{
+  8036cc:	55                   	push   %ebp
+  8036cd:	89 e5                	mov    %esp,%ebp
+  8036cf:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  8036d2:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  8036d9:	ff 75 10             	push   0x10(%ebp)
+  8036dc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8036df:	50                   	push   %eax
+  8036e0:	ff 75 0c             	push   0xc(%ebp)
+  8036e3:	ff 75 08             	push   0x8(%ebp)
+  8036e6:	e8 5e ff ff ff       	call   803649 <ipc_recv_pages>
+}
+  8036eb:	c9                   	leave
+  8036ec:	c3                   	ret
+
+008036ed <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  8036ed:	55                   	push   %ebp
+  8036ee:	89 e5                	mov    %esp,%ebp
+  8036f0:	57                   	push   %edi
+  8036f1:	56                   	push   %esi
+  8036f2:	53                   	push   %ebx
+  8036f3:	83 ec 0c             	sub    $0xc,%esp
+  8036f6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8036f9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8036fc:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  8036ff:	89 c3                	mov    %eax,%ebx
+  803701:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  803707:	85 c0                	test   %eax,%eax
+  803709:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80370e:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  803711:	83 ec 0c             	sub    $0xc,%esp
+  803714:	ff 75 14             	push   0x14(%ebp)
+  803717:	ff 75 18             	push   0x18(%ebp)
+  80371a:	53                   	push   %ebx
+  80371b:	56                   	push   %esi
+  80371c:	57                   	push   %edi
+  80371d:	e8 9d dc ff ff       	call   8013bf <sys_ipc_try_send>
+  803722:	83 c4 20             	add    $0x20,%esp
+  803725:	85 c0                	test   %eax,%eax
+  803727:	79 1e                	jns    803747 <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  803729:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80372c:	75 07                	jne    803735 <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  80372e:	e8 73 d9 ff ff       	call   8010a6 <sys_yield>
+  803733:	eb dc                	jmp    803711 <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  803735:	50                   	push   %eax
+  803736:	68 e3 40 80 00       	push   $0x8040e3
+  80373b:	6a 5c                	push   $0x5c
+  80373d:	68 f0 40 80 00       	push   $0x8040f0
+  803742:	e8 c9 ce ff ff       	call   800610 <_panic>
+  }
+}
+  803747:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80374a:	5b                   	pop    %ebx
+  80374b:	5e                   	pop    %esi
+  80374c:	5f                   	pop    %edi
+  80374d:	5d                   	pop    %ebp
+  80374e:	c3                   	ret
+
+0080374f <ipc_send>:
+{
+  80374f:	55                   	push   %ebp
+  803750:	89 e5                	mov    %esp,%ebp
+  803752:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  803755:	ff 75 14             	push   0x14(%ebp)
+  803758:	6a 01                	push   $0x1
+  80375a:	ff 75 10             	push   0x10(%ebp)
+  80375d:	ff 75 0c             	push   0xc(%ebp)
+  803760:	ff 75 08             	push   0x8(%ebp)
+  803763:	e8 85 ff ff ff       	call   8036ed <ipc_send_pages>
+}
+  803768:	83 c4 20             	add    $0x20,%esp
+  80376b:	c9                   	leave
+  80376c:	c3                   	ret
+
+0080376d <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80376d:	55                   	push   %ebp
+  80376e:	89 e5                	mov    %esp,%ebp
+  803770:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  803773:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  803778:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80377b:	c1 e0 04             	shl    $0x4,%eax
+  80377e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803783:	8b 40 50             	mov    0x50(%eax),%eax
+  803786:	39 c8                	cmp    %ecx,%eax
+  803788:	74 12                	je     80379c <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  80378a:	83 c2 01             	add    $0x1,%edx
+  80378d:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  803793:	75 e3                	jne    803778 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  803795:	b8 00 00 00 00       	mov    $0x0,%eax
+  80379a:	eb 0e                	jmp    8037aa <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  80379c:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80379f:	c1 e0 04             	shl    $0x4,%eax
+  8037a2:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8037a7:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8037aa:	5d                   	pop    %ebp
+  8037ab:	c3                   	ret
+
+008037ac <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8037ac:	55                   	push   %ebp
+  8037ad:	89 e5                	mov    %esp,%ebp
+  8037af:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  8037b2:	89 c2                	mov    %eax,%edx
+  8037b4:	c1 ea 16             	shr    $0x16,%edx
+  8037b7:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  8037be:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  8037c3:	f6 c1 01             	test   $0x1,%cl
+  8037c6:	74 1c                	je     8037e4 <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  8037c8:	c1 e8 0c             	shr    $0xc,%eax
+  8037cb:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  8037d2:	a8 01                	test   $0x1,%al
+  8037d4:	74 0e                	je     8037e4 <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  8037d6:	c1 e8 0c             	shr    $0xc,%eax
+  8037d9:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  8037e0:	ef 
+  8037e1:	0f b7 d2             	movzwl %dx,%edx
+}
+  8037e4:	89 d0                	mov    %edx,%eax
+  8037e6:	5d                   	pop    %ebp
+  8037e7:	c3                   	ret
+
+008037e8 <udivmod>:
+  8037e8:	55                   	push   %ebp
+  8037e9:	57                   	push   %edi
+  8037ea:	56                   	push   %esi
+  8037eb:	53                   	push   %ebx
+  8037ec:	83 ec 14             	sub    $0x14,%esp
+  8037ef:	8b 74 24 28          	mov    0x28(%esp),%esi
+  8037f3:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  8037f7:	89 fb                	mov    %edi,%ebx
+  8037f9:	09 f3                	or     %esi,%ebx
+  8037fb:	0f 84 88 00 00 00    	je     803889 <udivmod+0xa1>
+  803801:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803806:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  80380d:	00 
+  80380e:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  803815:	00 
+  803816:	89 cd                	mov    %ecx,%ebp
+  803818:	89 34 24             	mov    %esi,(%esp)
+  80381b:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  80381f:	eb 08                	jmp    803829 <udivmod+0x41>
+  803821:	83 ed 01             	sub    $0x1,%ebp
+  803824:	83 fd ff             	cmp    $0xffffffff,%ebp
+  803827:	74 6c                	je     803895 <udivmod+0xad>
+  803829:	89 c3                	mov    %eax,%ebx
+  80382b:	89 d6                	mov    %edx,%esi
+  80382d:	89 e9                	mov    %ebp,%ecx
+  80382f:	0f ad f3             	shrd   %cl,%esi,%ebx
+  803832:	d3 ee                	shr    %cl,%esi
+  803834:	f6 c1 20             	test   $0x20,%cl
+  803837:	74 04                	je     80383d <udivmod+0x55>
+  803839:	89 f3                	mov    %esi,%ebx
+  80383b:	31 f6                	xor    %esi,%esi
+  80383d:	8b 3c 24             	mov    (%esp),%edi
+  803840:	39 fb                	cmp    %edi,%ebx
+  803842:	89 f7                	mov    %esi,%edi
+  803844:	8b 1c 24             	mov    (%esp),%ebx
+  803847:	8b 74 24 04          	mov    0x4(%esp),%esi
+  80384b:	19 f7                	sbb    %esi,%edi
+  80384d:	72 d2                	jb     803821 <udivmod+0x39>
+  80384f:	89 f7                	mov    %esi,%edi
+  803851:	89 de                	mov    %ebx,%esi
+  803853:	89 e9                	mov    %ebp,%ecx
+  803855:	0f a5 f7             	shld   %cl,%esi,%edi
+  803858:	d3 e6                	shl    %cl,%esi
+  80385a:	f6 c1 20             	test   $0x20,%cl
+  80385d:	74 04                	je     803863 <udivmod+0x7b>
+  80385f:	89 f7                	mov    %esi,%edi
+  803861:	31 f6                	xor    %esi,%esi
+  803863:	29 f0                	sub    %esi,%eax
+  803865:	19 fa                	sbb    %edi,%edx
+  803867:	be 01 00 00 00       	mov    $0x1,%esi
+  80386c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803871:	0f a5 f7             	shld   %cl,%esi,%edi
+  803874:	d3 e6                	shl    %cl,%esi
+  803876:	f6 c1 20             	test   $0x20,%cl
+  803879:	74 04                	je     80387f <udivmod+0x97>
+  80387b:	89 f7                	mov    %esi,%edi
+  80387d:	31 f6                	xor    %esi,%esi
+  80387f:	09 74 24 08          	or     %esi,0x8(%esp)
+  803883:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  803887:	eb 98                	jmp    803821 <udivmod+0x39>
+  803889:	89 f0                	mov    %esi,%eax
+  80388b:	89 fa                	mov    %edi,%edx
+  80388d:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803891:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  803895:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  803899:	89 01                	mov    %eax,(%ecx)
+  80389b:	89 51 04             	mov    %edx,0x4(%ecx)
+  80389e:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8038a2:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8038a6:	83 c4 14             	add    $0x14,%esp
+  8038a9:	5b                   	pop    %ebx
+  8038aa:	5e                   	pop    %esi
+  8038ab:	5f                   	pop    %edi
+  8038ac:	5d                   	pop    %ebp
+  8038ad:	c3                   	ret
+
+008038ae <__udivdi3>:
+  8038ae:	83 ec 18             	sub    $0x18,%esp
+  8038b1:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8038b5:	50                   	push   %eax
+  8038b6:	ff 74 24 2c          	push   0x2c(%esp)
+  8038ba:	ff 74 24 2c          	push   0x2c(%esp)
+  8038be:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8038c2:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8038c6:	e8 1d ff ff ff       	call   8037e8 <udivmod>
+  8038cb:	83 c4 24             	add    $0x24,%esp
+  8038ce:	c3                   	ret
+
+008038cf <__umoddi3>:
+  8038cf:	83 ec 18             	sub    $0x18,%esp
+  8038d2:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8038d6:	50                   	push   %eax
+  8038d7:	ff 74 24 2c          	push   0x2c(%esp)
+  8038db:	ff 74 24 2c          	push   0x2c(%esp)
+  8038df:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8038e3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8038e7:	e8 fc fe ff ff       	call   8037e8 <udivmod>
+  8038ec:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8038f0:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8038f4:	83 c4 24             	add    $0x24,%esp
+  8038f7:	c3                   	ret
+
+008038f8 <__divdi3>:
+  8038f8:	56                   	push   %esi
+  8038f9:	53                   	push   %ebx
+  8038fa:	83 ec 14             	sub    $0x14,%esp
+  8038fd:	8b 44 24 20          	mov    0x20(%esp),%eax
+  803901:	8b 54 24 24          	mov    0x24(%esp),%edx
+  803905:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  803909:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  80390d:	85 d2                	test   %edx,%edx
+  80390f:	78 18                	js     803929 <__divdi3+0x31>
+  803911:	85 db                	test   %ebx,%ebx
+  803913:	78 3e                	js     803953 <__divdi3+0x5b>
+  803915:	83 ec 04             	sub    $0x4,%esp
+  803918:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80391c:	56                   	push   %esi
+  80391d:	53                   	push   %ebx
+  80391e:	51                   	push   %ecx
+  80391f:	e8 c4 fe ff ff       	call   8037e8 <udivmod>
+  803924:	83 c4 10             	add    $0x10,%esp
+  803927:	eb 24                	jmp    80394d <__divdi3+0x55>
+  803929:	f7 d8                	neg    %eax
+  80392b:	83 d2 00             	adc    $0x0,%edx
+  80392e:	f7 da                	neg    %edx
+  803930:	85 db                	test   %ebx,%ebx
+  803932:	78 3a                	js     80396e <__divdi3+0x76>
+  803934:	83 ec 04             	sub    $0x4,%esp
+  803937:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80393b:	56                   	push   %esi
+  80393c:	53                   	push   %ebx
+  80393d:	51                   	push   %ecx
+  80393e:	e8 a5 fe ff ff       	call   8037e8 <udivmod>
+  803943:	83 c4 10             	add    $0x10,%esp
+  803946:	f7 d8                	neg    %eax
+  803948:	83 d2 00             	adc    $0x0,%edx
+  80394b:	f7 da                	neg    %edx
+  80394d:	83 c4 14             	add    $0x14,%esp
+  803950:	5b                   	pop    %ebx
+  803951:	5e                   	pop    %esi
+  803952:	c3                   	ret
+  803953:	83 ec 04             	sub    $0x4,%esp
+  803956:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80395a:	56                   	push   %esi
+  80395b:	f7 d9                	neg    %ecx
+  80395d:	83 d3 00             	adc    $0x0,%ebx
+  803960:	f7 db                	neg    %ebx
+  803962:	53                   	push   %ebx
+  803963:	51                   	push   %ecx
+  803964:	e8 7f fe ff ff       	call   8037e8 <udivmod>
+  803969:	83 c4 10             	add    $0x10,%esp
+  80396c:	eb d8                	jmp    803946 <__divdi3+0x4e>
+  80396e:	83 ec 04             	sub    $0x4,%esp
+  803971:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803975:	56                   	push   %esi
+  803976:	f7 d9                	neg    %ecx
+  803978:	83 d3 00             	adc    $0x0,%ebx
+  80397b:	f7 db                	neg    %ebx
+  80397d:	53                   	push   %ebx
+  80397e:	51                   	push   %ecx
+  80397f:	e8 64 fe ff ff       	call   8037e8 <udivmod>
+  803984:	83 c4 10             	add    $0x10,%esp
+  803987:	eb c4                	jmp    80394d <__divdi3+0x55>
+
+00803989 <__moddi3>:
+  803989:	55                   	push   %ebp
+  80398a:	57                   	push   %edi
+  80398b:	56                   	push   %esi
+  80398c:	53                   	push   %ebx
+  80398d:	83 ec 24             	sub    $0x24,%esp
+  803990:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803994:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803998:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  80399c:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  8039a0:	85 d2                	test   %edx,%edx
+  8039a2:	78 3b                	js     8039df <__moddi3+0x56>
+  8039a4:	83 ec 04             	sub    $0x4,%esp
+  8039a7:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8039ab:	56                   	push   %esi
+  8039ac:	89 ce                	mov    %ecx,%esi
+  8039ae:	f7 de                	neg    %esi
+  8039b0:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8039b4:	89 de                	mov    %ebx,%esi
+  8039b6:	83 d6 00             	adc    $0x0,%esi
+  8039b9:	f7 de                	neg    %esi
+  8039bb:	89 74 24 14          	mov    %esi,0x14(%esp)
+  8039bf:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8039c3:	0f 48 f1             	cmovs  %ecx,%esi
+  8039c6:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  8039cb:	53                   	push   %ebx
+  8039cc:	56                   	push   %esi
+  8039cd:	e8 16 fe ff ff       	call   8037e8 <udivmod>
+  8039d2:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8039d6:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8039da:	83 c4 10             	add    $0x10,%esp
+  8039dd:	eb 47                	jmp    803a26 <__moddi3+0x9d>
+  8039df:	f7 d8                	neg    %eax
+  8039e1:	83 d2 00             	adc    $0x0,%edx
+  8039e4:	f7 da                	neg    %edx
+  8039e6:	83 ec 04             	sub    $0x4,%esp
+  8039e9:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8039ed:	56                   	push   %esi
+  8039ee:	89 cf                	mov    %ecx,%edi
+  8039f0:	f7 df                	neg    %edi
+  8039f2:	89 de                	mov    %ebx,%esi
+  8039f4:	83 d6 00             	adc    $0x0,%esi
+  8039f7:	f7 de                	neg    %esi
+  8039f9:	0f 49 cf             	cmovns %edi,%ecx
+  8039fc:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  803a00:	0f 49 de             	cmovns %esi,%ebx
+  803a03:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  803a07:	ff 74 24 0c          	push   0xc(%esp)
+  803a0b:	ff 74 24 0c          	push   0xc(%esp)
+  803a0f:	e8 d4 fd ff ff       	call   8037e8 <udivmod>
+  803a14:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803a18:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803a1c:	f7 d8                	neg    %eax
+  803a1e:	83 d2 00             	adc    $0x0,%edx
+  803a21:	f7 da                	neg    %edx
+  803a23:	83 c4 10             	add    $0x10,%esp
+  803a26:	83 c4 24             	add    $0x24,%esp
+  803a29:	5b                   	pop    %ebx
+  803a2a:	5e                   	pop    %esi
+  803a2b:	5f                   	pop    %edi
+  803a2c:	5d                   	pop    %ebp
+  803a2d:	c3                   	ret
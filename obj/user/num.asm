@@ -0,0 +1,6692 @@
+
+obj/user/num.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 4a 01 00 00       	call   80017b <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <num>:
+int bol = 1;
+int line = 0;
+
+void
+num(int f, const char *s)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	83 ec 10             	sub    $0x10,%esp
+  80003b:	8b 75 08             	mov    0x8(%ebp),%esi
+  long n;
+  int r;
+  char c;
+
+  while ((n = read(f, &c, 1)) > 0) {
+  80003e:	8d 5d f7             	lea    -0x9(%ebp),%ebx
+  800041:	eb 1b                	jmp    80005e <num+0x2b>
+    if (bol) {
+      printf("%5d ", ++line);
+      bol = 0;
+    }
+    if ((r = write(1, &c, 1)) != 1)
+  800043:	83 ec 04             	sub    $0x4,%esp
+  800046:	6a 01                	push   $0x1
+  800048:	53                   	push   %ebx
+  800049:	6a 01                	push   $0x1
+  80004b:	e8 32 15 00 00       	call   801582 <write>
+  800050:	83 c4 10             	add    $0x10,%esp
+  800053:	83 f8 01             	cmp    $0x1,%eax
+  800056:	75 4c                	jne    8000a4 <num+0x71>
+      panic("write error copying %s: %e", s, r);
+    if (c == '\n')
+  800058:	80 7d f7 0a          	cmpb   $0xa,-0x9(%ebp)
+  80005c:	74 5e                	je     8000bc <num+0x89>
+  while ((n = read(f, &c, 1)) > 0) {
+  80005e:	83 ec 04             	sub    $0x4,%esp
+  800061:	6a 01                	push   $0x1
+  800063:	53                   	push   %ebx
+  800064:	56                   	push   %esi
+  800065:	e8 4a 14 00 00       	call   8014b4 <read>
+  80006a:	83 c4 10             	add    $0x10,%esp
+  80006d:	85 c0                	test   %eax,%eax
+  80006f:	7e 57                	jle    8000c8 <num+0x95>
+    if (bol) {
+  800071:	83 3d 00 40 80 00 00 	cmpl   $0x0,0x804000
+  800078:	74 c9                	je     800043 <num+0x10>
+      printf("%5d ", ++line);
+  80007a:	a1 00 50 80 00       	mov    0x805000,%eax
+  80007f:	83 c0 01             	add    $0x1,%eax
+  800082:	a3 00 50 80 00       	mov    %eax,0x805000
+  800087:	83 ec 08             	sub    $0x8,%esp
+  80008a:	50                   	push   %eax
+  80008b:	68 a0 30 80 00       	push   $0x8030a0
+  800090:	e8 29 22 00 00       	call   8022be <printf>
+      bol = 0;
+  800095:	c7 05 00 40 80 00 00 	movl   $0x0,0x804000
+  80009c:	00 00 00 
+  80009f:	83 c4 10             	add    $0x10,%esp
+  8000a2:	eb 9f                	jmp    800043 <num+0x10>
+      panic("write error copying %s: %e", s, r);
+  8000a4:	83 ec 0c             	sub    $0xc,%esp
+  8000a7:	50                   	push   %eax
+  8000a8:	ff 75 0c             	push   0xc(%ebp)
+  8000ab:	68 a5 30 80 00       	push   $0x8030a5
+  8000b0:	6a 13                	push   $0x13
+  8000b2:	68 c0 30 80 00       	push   $0x8030c0
+  8000b7:	e8 2c 01 00 00       	call   8001e8 <_panic>
+      bol = 1;
+  8000bc:	c7 05 00 40 80 00 01 	movl   $0x1,0x804000
+  8000c3:	00 00 00 
+  8000c6:	eb 96                	jmp    80005e <num+0x2b>
+  }
+  if (n < 0)
+  8000c8:	78 07                	js     8000d1 <num+0x9e>
+    panic("error reading %s: %e", s, n);
+}
+  8000ca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000cd:	5b                   	pop    %ebx
+  8000ce:	5e                   	pop    %esi
+  8000cf:	5d                   	pop    %ebp
+  8000d0:	c3                   	ret
+    panic("error reading %s: %e", s, n);
+  8000d1:	83 ec 0c             	sub    $0xc,%esp
+  8000d4:	50                   	push   %eax
+  8000d5:	ff 75 0c             	push   0xc(%ebp)
+  8000d8:	68 cb 30 80 00       	push   $0x8030cb
+  8000dd:	6a 18                	push   $0x18
+  8000df:	68 c0 30 80 00       	push   $0x8030c0
+  8000e4:	e8 ff 00 00 00       	call   8001e8 <_panic>
+
+008000e9 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8000e9:	55                   	push   %ebp
+  8000ea:	89 e5                	mov    %esp,%ebp
+  8000ec:	57                   	push   %edi
+  8000ed:	56                   	push   %esi
+  8000ee:	53                   	push   %ebx
+  8000ef:	83 ec 0c             	sub    $0xc,%esp
+  int f, i;
+
+  binaryname = "num";
+  8000f2:	c7 05 04 40 80 00 e0 	movl   $0x8030e0,0x804004
+  8000f9:	30 80 00 
+  if (argc == 1)
+  8000fc:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+  800100:	74 0d                	je     80010f <umain+0x26>
+  800102:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800105:	8d 70 04             	lea    0x4(%eax),%esi
+    num(0, "<stdin>");
+  else
+    for (i = 1; i < argc; i++) {
+  800108:	bf 01 00 00 00       	mov    $0x1,%edi
+  80010d:	eb 3b                	jmp    80014a <umain+0x61>
+    num(0, "<stdin>");
+  80010f:	83 ec 08             	sub    $0x8,%esp
+  800112:	68 e4 30 80 00       	push   $0x8030e4
+  800117:	6a 00                	push   $0x0
+  800119:	e8 15 ff ff ff       	call   800033 <num>
+  80011e:	83 c4 10             	add    $0x10,%esp
+      else {
+        num(f, argv[i]);
+        close(f);
+      }
+    }
+  exit();
+  800121:	e8 a8 00 00 00       	call   8001ce <exit>
+}
+  800126:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800129:	5b                   	pop    %ebx
+  80012a:	5e                   	pop    %esi
+  80012b:	5f                   	pop    %edi
+  80012c:	5d                   	pop    %ebp
+  80012d:	c3                   	ret
+        num(f, argv[i]);
+  80012e:	83 ec 08             	sub    $0x8,%esp
+  800131:	ff 36                	push   (%esi)
+  800133:	50                   	push   %eax
+  800134:	e8 fa fe ff ff       	call   800033 <num>
+        close(f);
+  800139:	89 1c 24             	mov    %ebx,(%esp)
+  80013c:	e8 eb 11 00 00       	call   80132c <close>
+    for (i = 1; i < argc; i++) {
+  800141:	83 c7 01             	add    $0x1,%edi
+  800144:	83 c6 04             	add    $0x4,%esi
+  800147:	83 c4 10             	add    $0x10,%esp
+  80014a:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  80014d:	7d d2                	jge    800121 <umain+0x38>
+      f = open(argv[i], O_RDONLY);
+  80014f:	83 ec 08             	sub    $0x8,%esp
+  800152:	6a 00                	push   $0x0
+  800154:	ff 36                	push   (%esi)
+  800156:	e8 84 1b 00 00       	call   801cdf <open>
+  80015b:	89 c3                	mov    %eax,%ebx
+      if (f < 0)
+  80015d:	83 c4 10             	add    $0x10,%esp
+  800160:	85 c0                	test   %eax,%eax
+  800162:	79 ca                	jns    80012e <umain+0x45>
+        panic("can't open %s: %e", argv[i], f);
+  800164:	83 ec 0c             	sub    $0xc,%esp
+  800167:	50                   	push   %eax
+  800168:	ff 36                	push   (%esi)
+  80016a:	68 ec 30 80 00       	push   $0x8030ec
+  80016f:	6a 27                	push   $0x27
+  800171:	68 c0 30 80 00       	push   $0x8030c0
+  800176:	e8 6d 00 00 00       	call   8001e8 <_panic>
+
+0080017b <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80017b:	55                   	push   %ebp
+  80017c:	89 e5                	mov    %esp,%ebp
+  80017e:	56                   	push   %esi
+  80017f:	53                   	push   %ebx
+  800180:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800183:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  800186:	c7 05 64 57 80 00 00 	movl   $0x0,0x805764
+  80018d:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  800190:	e8 ca 0a 00 00       	call   800c5f <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  800195:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80019a:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80019d:	c1 e0 04             	shl    $0x4,%eax
+  8001a0:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8001a5:	a3 64 57 80 00       	mov    %eax,0x805764
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8001aa:	85 db                	test   %ebx,%ebx
+  8001ac:	7e 07                	jle    8001b5 <libmain+0x3a>
+    binaryname = argv[0];
+  8001ae:	8b 06                	mov    (%esi),%eax
+  8001b0:	a3 04 40 80 00       	mov    %eax,0x804004
+
+  // call user main routine
+  umain(argc, argv);
+  8001b5:	83 ec 08             	sub    $0x8,%esp
+  8001b8:	56                   	push   %esi
+  8001b9:	53                   	push   %ebx
+  8001ba:	e8 2a ff ff ff       	call   8000e9 <umain>
+
+  // exit gracefully
+  exit();
+  8001bf:	e8 0a 00 00 00       	call   8001ce <exit>
+}
+  8001c4:	83 c4 10             	add    $0x10,%esp
+  8001c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8001ca:	5b                   	pop    %ebx
+  8001cb:	5e                   	pop    %esi
+  8001cc:	5d                   	pop    %ebp
+  8001cd:	c3                   	ret
+
+008001ce <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8001ce:	55                   	push   %ebp
+  8001cf:	89 e5                	mov    %esp,%ebp
+  8001d1:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  8001d4:	e8 80 11 00 00       	call   801359 <close_all>
+  sys_env_destroy(0);
+  8001d9:	83 ec 0c             	sub    $0xc,%esp
+  8001dc:	6a 00                	push   $0x0
+  8001de:	e8 3b 0a 00 00       	call   800c1e <sys_env_destroy>
+}
+  8001e3:	83 c4 10             	add    $0x10,%esp
+  8001e6:	c9                   	leave
+  8001e7:	c3                   	ret
+
+008001e8 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8001e8:	55                   	push   %ebp
+  8001e9:	89 e5                	mov    %esp,%ebp
+  8001eb:	56                   	push   %esi
+  8001ec:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  8001ed:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  8001f0:	8b 35 04 40 80 00    	mov    0x804004,%esi
+  8001f6:	e8 64 0a 00 00       	call   800c5f <sys_getenvid>
+  8001fb:	83 ec 0c             	sub    $0xc,%esp
+  8001fe:	ff 75 0c             	push   0xc(%ebp)
+  800201:	ff 75 08             	push   0x8(%ebp)
+  800204:	56                   	push   %esi
+  800205:	50                   	push   %eax
+  800206:	68 08 31 80 00       	push   $0x803108
+  80020b:	e8 b3 00 00 00       	call   8002c3 <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  800210:	83 c4 18             	add    $0x18,%esp
+  800213:	53                   	push   %ebx
+  800214:	ff 75 10             	push   0x10(%ebp)
+  800217:	e8 56 00 00 00       	call   800272 <vcprintf>
+  cprintf("\n");
+  80021c:	c7 04 24 80 35 80 00 	movl   $0x803580,(%esp)
+  800223:	e8 9b 00 00 00       	call   8002c3 <cprintf>
+  800228:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  80022b:	cc                   	int3
+  while (1)
+  80022c:	eb fd                	jmp    80022b <_panic+0x43>
+
+0080022e <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80022e:	55                   	push   %ebp
+  80022f:	89 e5                	mov    %esp,%ebp
+  800231:	53                   	push   %ebx
+  800232:	83 ec 04             	sub    $0x4,%esp
+  800235:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  800238:	8b 13                	mov    (%ebx),%edx
+  80023a:	8d 42 01             	lea    0x1(%edx),%eax
+  80023d:	89 03                	mov    %eax,(%ebx)
+  80023f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800242:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  800246:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80024b:	74 09                	je     800256 <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  80024d:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800251:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800254:	c9                   	leave
+  800255:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  800256:	83 ec 08             	sub    $0x8,%esp
+  800259:	68 ff 00 00 00       	push   $0xff
+  80025e:	8d 43 08             	lea    0x8(%ebx),%eax
+  800261:	50                   	push   %eax
+  800262:	e8 7a 09 00 00       	call   800be1 <sys_cputs>
+    b->idx = 0;
+  800267:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80026d:	83 c4 10             	add    $0x10,%esp
+  800270:	eb db                	jmp    80024d <putch+0x1f>
+
+00800272 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800272:	55                   	push   %ebp
+  800273:	89 e5                	mov    %esp,%ebp
+  800275:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  80027b:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800282:	00 00 00 
+  b.cnt = 0;
+  800285:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80028c:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  80028f:	ff 75 0c             	push   0xc(%ebp)
+  800292:	ff 75 08             	push   0x8(%ebp)
+  800295:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80029b:	50                   	push   %eax
+  80029c:	68 2e 02 80 00       	push   $0x80022e
+  8002a1:	e8 14 01 00 00       	call   8003ba <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  8002a6:	83 c4 08             	add    $0x8,%esp
+  8002a9:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8002af:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8002b5:	50                   	push   %eax
+  8002b6:	e8 26 09 00 00       	call   800be1 <sys_cputs>
+
+  return b.cnt;
+}
+  8002bb:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8002c1:	c9                   	leave
+  8002c2:	c3                   	ret
+
+008002c3 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8002c3:	55                   	push   %ebp
+  8002c4:	89 e5                	mov    %esp,%ebp
+  8002c6:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  8002c9:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  8002cc:	50                   	push   %eax
+  8002cd:	ff 75 08             	push   0x8(%ebp)
+  8002d0:	e8 9d ff ff ff       	call   800272 <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  8002d5:	c9                   	leave
+  8002d6:	c3                   	ret
+
+008002d7 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  8002d7:	55                   	push   %ebp
+  8002d8:	89 e5                	mov    %esp,%ebp
+  8002da:	57                   	push   %edi
+  8002db:	56                   	push   %esi
+  8002dc:	53                   	push   %ebx
+  8002dd:	83 ec 1c             	sub    $0x1c,%esp
+  8002e0:	89 c7                	mov    %eax,%edi
+  8002e2:	89 d6                	mov    %edx,%esi
+  8002e4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002e7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8002ea:	89 d1                	mov    %edx,%ecx
+  8002ec:	89 c2                	mov    %eax,%edx
+  8002ee:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8002f1:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8002f4:	8b 45 10             	mov    0x10(%ebp),%eax
+  8002f7:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  8002fa:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8002fd:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800304:	39 c2                	cmp    %eax,%edx
+  800306:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800309:	72 3e                	jb     800349 <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  80030b:	83 ec 0c             	sub    $0xc,%esp
+  80030e:	ff 75 18             	push   0x18(%ebp)
+  800311:	83 eb 01             	sub    $0x1,%ebx
+  800314:	53                   	push   %ebx
+  800315:	50                   	push   %eax
+  800316:	83 ec 08             	sub    $0x8,%esp
+  800319:	ff 75 e4             	push   -0x1c(%ebp)
+  80031c:	ff 75 e0             	push   -0x20(%ebp)
+  80031f:	ff 75 dc             	push   -0x24(%ebp)
+  800322:	ff 75 d8             	push   -0x28(%ebp)
+  800325:	e8 ef 2b 00 00       	call   802f19 <__udivdi3>
+  80032a:	83 c4 18             	add    $0x18,%esp
+  80032d:	52                   	push   %edx
+  80032e:	50                   	push   %eax
+  80032f:	89 f2                	mov    %esi,%edx
+  800331:	89 f8                	mov    %edi,%eax
+  800333:	e8 9f ff ff ff       	call   8002d7 <printnum>
+  800338:	83 c4 20             	add    $0x20,%esp
+  80033b:	eb 13                	jmp    800350 <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  80033d:	83 ec 08             	sub    $0x8,%esp
+  800340:	56                   	push   %esi
+  800341:	ff 75 18             	push   0x18(%ebp)
+  800344:	ff d7                	call   *%edi
+  800346:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  800349:	83 eb 01             	sub    $0x1,%ebx
+  80034c:	85 db                	test   %ebx,%ebx
+  80034e:	7f ed                	jg     80033d <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  800350:	83 ec 08             	sub    $0x8,%esp
+  800353:	56                   	push   %esi
+  800354:	83 ec 04             	sub    $0x4,%esp
+  800357:	ff 75 e4             	push   -0x1c(%ebp)
+  80035a:	ff 75 e0             	push   -0x20(%ebp)
+  80035d:	ff 75 dc             	push   -0x24(%ebp)
+  800360:	ff 75 d8             	push   -0x28(%ebp)
+  800363:	e8 d2 2b 00 00       	call   802f3a <__umoddi3>
+  800368:	83 c4 14             	add    $0x14,%esp
+  80036b:	0f be 80 2b 31 80 00 	movsbl 0x80312b(%eax),%eax
+  800372:	50                   	push   %eax
+  800373:	ff d7                	call   *%edi
+}
+  800375:	83 c4 10             	add    $0x10,%esp
+  800378:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80037b:	5b                   	pop    %ebx
+  80037c:	5e                   	pop    %esi
+  80037d:	5f                   	pop    %edi
+  80037e:	5d                   	pop    %ebp
+  80037f:	c3                   	ret
+
+00800380 <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800380:	55                   	push   %ebp
+  800381:	89 e5                	mov    %esp,%ebp
+  800383:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  800386:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  80038a:	8b 10                	mov    (%eax),%edx
+  80038c:	3b 50 04             	cmp    0x4(%eax),%edx
+  80038f:	73 0a                	jae    80039b <sprintputch+0x1b>
+    *b->buf++ = ch;
+  800391:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800394:	89 08                	mov    %ecx,(%eax)
+  800396:	8b 45 08             	mov    0x8(%ebp),%eax
+  800399:	88 02                	mov    %al,(%edx)
+}
+  80039b:	5d                   	pop    %ebp
+  80039c:	c3                   	ret
+
+0080039d <printfmt>:
+{
+  80039d:	55                   	push   %ebp
+  80039e:	89 e5                	mov    %esp,%ebp
+  8003a0:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  8003a3:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  8003a6:	50                   	push   %eax
+  8003a7:	ff 75 10             	push   0x10(%ebp)
+  8003aa:	ff 75 0c             	push   0xc(%ebp)
+  8003ad:	ff 75 08             	push   0x8(%ebp)
+  8003b0:	e8 05 00 00 00       	call   8003ba <vprintfmt>
+}
+  8003b5:	83 c4 10             	add    $0x10,%esp
+  8003b8:	c9                   	leave
+  8003b9:	c3                   	ret
+
+008003ba <vprintfmt>:
+{
+  8003ba:	55                   	push   %ebp
+  8003bb:	89 e5                	mov    %esp,%ebp
+  8003bd:	57                   	push   %edi
+  8003be:	56                   	push   %esi
+  8003bf:	53                   	push   %ebx
+  8003c0:	83 ec 2c             	sub    $0x2c,%esp
+  8003c3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8003c6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8003c9:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8003cc:	eb 0a                	jmp    8003d8 <vprintfmt+0x1e>
+      putch(ch, putdat);
+  8003ce:	83 ec 08             	sub    $0x8,%esp
+  8003d1:	53                   	push   %ebx
+  8003d2:	50                   	push   %eax
+  8003d3:	ff d6                	call   *%esi
+  8003d5:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  8003d8:	83 c7 01             	add    $0x1,%edi
+  8003db:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8003df:	83 f8 25             	cmp    $0x25,%eax
+  8003e2:	74 0c                	je     8003f0 <vprintfmt+0x36>
+      if (ch == '\0')
+  8003e4:	85 c0                	test   %eax,%eax
+  8003e6:	75 e6                	jne    8003ce <vprintfmt+0x14>
+}
+  8003e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003eb:	5b                   	pop    %ebx
+  8003ec:	5e                   	pop    %esi
+  8003ed:	5f                   	pop    %edi
+  8003ee:	5d                   	pop    %ebp
+  8003ef:	c3                   	ret
+    padc = ' ';
+  8003f0:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  8003f4:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  8003fb:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  800402:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  800409:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  80040e:	8d 47 01             	lea    0x1(%edi),%eax
+  800411:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800414:	0f b6 17             	movzbl (%edi),%edx
+  800417:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80041a:	3c 55                	cmp    $0x55,%al
+  80041c:	0f 87 cf 03 00 00    	ja     8007f1 <vprintfmt+0x437>
+  800422:	0f b6 c0             	movzbl %al,%eax
+  800425:	ff 24 85 80 32 80 00 	jmp    *0x803280(,%eax,4)
+  80042c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  80042f:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800433:	eb d9                	jmp    80040e <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  800435:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800438:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80043c:	eb d0                	jmp    80040e <vprintfmt+0x54>
+  80043e:	0f b6 d2             	movzbl %dl,%edx
+  800441:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  800444:	b8 00 00 00 00       	mov    $0x0,%eax
+  800449:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  80044c:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80044f:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  800453:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  800456:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800459:	83 f9 09             	cmp    $0x9,%ecx
+  80045c:	77 55                	ja     8004b3 <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  80045e:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  800461:	eb e9                	jmp    80044c <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  800463:	8b 45 14             	mov    0x14(%ebp),%eax
+  800466:	8b 00                	mov    (%eax),%eax
+  800468:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80046b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80046e:	8d 40 04             	lea    0x4(%eax),%eax
+  800471:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  800474:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  800477:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80047b:	79 91                	jns    80040e <vprintfmt+0x54>
+        width = precision, precision = -1;
+  80047d:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800480:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800483:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80048a:	eb 82                	jmp    80040e <vprintfmt+0x54>
+      if (width < 0)
+  80048c:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80048f:	85 d2                	test   %edx,%edx
+  800491:	b8 00 00 00 00       	mov    $0x0,%eax
+  800496:	0f 49 c2             	cmovns %edx,%eax
+  800499:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  80049c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  80049f:	e9 6a ff ff ff       	jmp    80040e <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  8004a4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  8004a7:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  8004ae:	e9 5b ff ff ff       	jmp    80040e <vprintfmt+0x54>
+  8004b3:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8004b6:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004b9:	eb bc                	jmp    800477 <vprintfmt+0xbd>
+      lflag++;
+  8004bb:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  8004be:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  8004c1:	e9 48 ff ff ff       	jmp    80040e <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  8004c6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004c9:	8d 78 04             	lea    0x4(%eax),%edi
+  8004cc:	83 ec 08             	sub    $0x8,%esp
+  8004cf:	53                   	push   %ebx
+  8004d0:	ff 30                	push   (%eax)
+  8004d2:	ff d6                	call   *%esi
+      break;
+  8004d4:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  8004d7:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  8004da:	e9 b1 02 00 00       	jmp    800790 <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  8004df:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004e2:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  8004e5:	8b 10                	mov    (%eax),%edx
+  8004e7:	89 d0                	mov    %edx,%eax
+  8004e9:	f7 d8                	neg    %eax
+  8004eb:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8004ee:	83 f8 10             	cmp    $0x10,%eax
+  8004f1:	7f 23                	jg     800516 <vprintfmt+0x15c>
+  8004f3:	8b 14 85 e0 33 80 00 	mov    0x8033e0(,%eax,4),%edx
+  8004fa:	85 d2                	test   %edx,%edx
+  8004fc:	74 18                	je     800516 <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  8004fe:	52                   	push   %edx
+  8004ff:	68 2a 35 80 00       	push   $0x80352a
+  800504:	53                   	push   %ebx
+  800505:	56                   	push   %esi
+  800506:	e8 92 fe ff ff       	call   80039d <printfmt>
+  80050b:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  80050e:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800511:	e9 7a 02 00 00       	jmp    800790 <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  800516:	50                   	push   %eax
+  800517:	68 43 31 80 00       	push   $0x803143
+  80051c:	53                   	push   %ebx
+  80051d:	56                   	push   %esi
+  80051e:	e8 7a fe ff ff       	call   80039d <printfmt>
+  800523:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  800526:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  800529:	e9 62 02 00 00       	jmp    800790 <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  80052e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800531:	83 c0 04             	add    $0x4,%eax
+  800534:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800537:	8b 45 14             	mov    0x14(%ebp),%eax
+  80053a:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  80053c:	85 c9                	test   %ecx,%ecx
+  80053e:	b8 3c 31 80 00       	mov    $0x80313c,%eax
+  800543:	0f 45 c1             	cmovne %ecx,%eax
+  800546:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  800549:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80054d:	7e 06                	jle    800555 <vprintfmt+0x19b>
+  80054f:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800553:	75 0b                	jne    800560 <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800555:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800558:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80055b:	89 75 08             	mov    %esi,0x8(%ebp)
+  80055e:	eb 5c                	jmp    8005bc <vprintfmt+0x202>
+  800560:	83 ec 08             	sub    $0x8,%esp
+  800563:	ff 75 d0             	push   -0x30(%ebp)
+  800566:	ff 75 cc             	push   -0x34(%ebp)
+  800569:	e8 20 03 00 00       	call   80088e <strnlen>
+  80056e:	89 c2                	mov    %eax,%edx
+  800570:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800573:	29 d0                	sub    %edx,%eax
+  800575:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  800578:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80057c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80057f:	89 75 08             	mov    %esi,0x8(%ebp)
+  800582:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800584:	eb 0e                	jmp    800594 <vprintfmt+0x1da>
+          putch(padc, putdat);
+  800586:	83 ec 08             	sub    $0x8,%esp
+  800589:	53                   	push   %ebx
+  80058a:	57                   	push   %edi
+  80058b:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  80058e:	83 ee 01             	sub    $0x1,%esi
+  800591:	83 c4 10             	add    $0x10,%esp
+  800594:	85 f6                	test   %esi,%esi
+  800596:	7f ee                	jg     800586 <vprintfmt+0x1cc>
+  800598:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80059b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80059e:	85 c0                	test   %eax,%eax
+  8005a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005a5:	0f 49 d0             	cmovns %eax,%edx
+  8005a8:	29 d0                	sub    %edx,%eax
+  8005aa:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005ad:	eb a6                	jmp    800555 <vprintfmt+0x19b>
+          putch(ch, putdat);
+  8005af:	83 ec 08             	sub    $0x8,%esp
+  8005b2:	53                   	push   %ebx
+  8005b3:	52                   	push   %edx
+  8005b4:	ff 55 08             	call   *0x8(%ebp)
+  8005b7:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8005ba:	89 f1                	mov    %esi,%ecx
+  8005bc:	8d 71 01             	lea    0x1(%ecx),%esi
+  8005bf:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8005c3:	0f be d0             	movsbl %al,%edx
+  8005c6:	85 d2                	test   %edx,%edx
+  8005c8:	74 28                	je     8005f2 <vprintfmt+0x238>
+  8005ca:	85 ff                	test   %edi,%edi
+  8005cc:	78 05                	js     8005d3 <vprintfmt+0x219>
+  8005ce:	83 ef 01             	sub    $0x1,%edi
+  8005d1:	78 30                	js     800603 <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  8005d3:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8005d7:	74 d6                	je     8005af <vprintfmt+0x1f5>
+  8005d9:	0f be c0             	movsbl %al,%eax
+  8005dc:	83 e8 20             	sub    $0x20,%eax
+  8005df:	83 f8 5e             	cmp    $0x5e,%eax
+  8005e2:	76 cb                	jbe    8005af <vprintfmt+0x1f5>
+          putch('?', putdat);
+  8005e4:	83 ec 08             	sub    $0x8,%esp
+  8005e7:	53                   	push   %ebx
+  8005e8:	6a 3f                	push   $0x3f
+  8005ea:	ff 55 08             	call   *0x8(%ebp)
+  8005ed:	83 c4 10             	add    $0x10,%esp
+  8005f0:	eb c8                	jmp    8005ba <vprintfmt+0x200>
+  8005f2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005f5:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8005f8:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8005fb:	01 d0                	add    %edx,%eax
+  8005fd:	29 c8                	sub    %ecx,%eax
+  8005ff:	89 c7                	mov    %eax,%edi
+  800601:	eb 13                	jmp    800616 <vprintfmt+0x25c>
+  800603:	8b 75 08             	mov    0x8(%ebp),%esi
+  800606:	eb ed                	jmp    8005f5 <vprintfmt+0x23b>
+        putch(' ', putdat);
+  800608:	83 ec 08             	sub    $0x8,%esp
+  80060b:	53                   	push   %ebx
+  80060c:	6a 20                	push   $0x20
+  80060e:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  800610:	83 ef 01             	sub    $0x1,%edi
+  800613:	83 c4 10             	add    $0x10,%esp
+  800616:	85 ff                	test   %edi,%edi
+  800618:	7f ee                	jg     800608 <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  80061a:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80061d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800620:	e9 6b 01 00 00       	jmp    800790 <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  800625:	83 f9 01             	cmp    $0x1,%ecx
+  800628:	7f 1f                	jg     800649 <vprintfmt+0x28f>
+  else if (lflag)
+  80062a:	85 c9                	test   %ecx,%ecx
+  80062c:	74 67                	je     800695 <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  80062e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800631:	8b 00                	mov    (%eax),%eax
+  800633:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800636:	89 c1                	mov    %eax,%ecx
+  800638:	c1 f9 1f             	sar    $0x1f,%ecx
+  80063b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80063e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800641:	8d 40 04             	lea    0x4(%eax),%eax
+  800644:	89 45 14             	mov    %eax,0x14(%ebp)
+  800647:	eb 17                	jmp    800660 <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  800649:	8b 45 14             	mov    0x14(%ebp),%eax
+  80064c:	8b 50 04             	mov    0x4(%eax),%edx
+  80064f:	8b 00                	mov    (%eax),%eax
+  800651:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800654:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800657:	8b 45 14             	mov    0x14(%ebp),%eax
+  80065a:	8d 40 08             	lea    0x8(%eax),%eax
+  80065d:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  800660:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800663:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  800666:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  80066b:	85 c9                	test   %ecx,%ecx
+  80066d:	0f 89 03 01 00 00    	jns    800776 <vprintfmt+0x3bc>
+        putch('-', putdat);
+  800673:	83 ec 08             	sub    $0x8,%esp
+  800676:	53                   	push   %ebx
+  800677:	6a 2d                	push   $0x2d
+  800679:	ff d6                	call   *%esi
+        num = -(long long)num;
+  80067b:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80067e:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800681:	f7 da                	neg    %edx
+  800683:	83 d1 00             	adc    $0x0,%ecx
+  800686:	f7 d9                	neg    %ecx
+  800688:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  80068b:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800690:	e9 e1 00 00 00       	jmp    800776 <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  800695:	8b 45 14             	mov    0x14(%ebp),%eax
+  800698:	8b 00                	mov    (%eax),%eax
+  80069a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80069d:	89 c1                	mov    %eax,%ecx
+  80069f:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006a2:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006a5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a8:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ab:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006ae:	eb b0                	jmp    800660 <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  8006b0:	83 f9 01             	cmp    $0x1,%ecx
+  8006b3:	7f 1e                	jg     8006d3 <vprintfmt+0x319>
+  else if (lflag)
+  8006b5:	85 c9                	test   %ecx,%ecx
+  8006b7:	74 32                	je     8006eb <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  8006b9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006bc:	8b 10                	mov    (%eax),%edx
+  8006be:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006c3:	8d 40 04             	lea    0x4(%eax),%eax
+  8006c6:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  8006c9:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  8006ce:	e9 a3 00 00 00       	jmp    800776 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  8006d3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d6:	8b 10                	mov    (%eax),%edx
+  8006d8:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006db:	8d 40 08             	lea    0x8(%eax),%eax
+  8006de:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  8006e1:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  8006e6:	e9 8b 00 00 00       	jmp    800776 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8006eb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ee:	8b 10                	mov    (%eax),%edx
+  8006f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006f5:	8d 40 04             	lea    0x4(%eax),%eax
+  8006f8:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  8006fb:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  800700:	eb 74                	jmp    800776 <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  800702:	83 f9 01             	cmp    $0x1,%ecx
+  800705:	7f 1b                	jg     800722 <vprintfmt+0x368>
+  else if (lflag)
+  800707:	85 c9                	test   %ecx,%ecx
+  800709:	74 2c                	je     800737 <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  80070b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80070e:	8b 10                	mov    (%eax),%edx
+  800710:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800715:	8d 40 04             	lea    0x4(%eax),%eax
+  800718:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  80071b:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  800720:	eb 54                	jmp    800776 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800722:	8b 45 14             	mov    0x14(%ebp),%eax
+  800725:	8b 10                	mov    (%eax),%edx
+  800727:	8b 48 04             	mov    0x4(%eax),%ecx
+  80072a:	8d 40 08             	lea    0x8(%eax),%eax
+  80072d:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800730:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  800735:	eb 3f                	jmp    800776 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800737:	8b 45 14             	mov    0x14(%ebp),%eax
+  80073a:	8b 10                	mov    (%eax),%edx
+  80073c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800741:	8d 40 04             	lea    0x4(%eax),%eax
+  800744:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800747:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  80074c:	eb 28                	jmp    800776 <vprintfmt+0x3bc>
+      putch('0', putdat);
+  80074e:	83 ec 08             	sub    $0x8,%esp
+  800751:	53                   	push   %ebx
+  800752:	6a 30                	push   $0x30
+  800754:	ff d6                	call   *%esi
+      putch('x', putdat);
+  800756:	83 c4 08             	add    $0x8,%esp
+  800759:	53                   	push   %ebx
+  80075a:	6a 78                	push   $0x78
+  80075c:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  80075e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800761:	8b 10                	mov    (%eax),%edx
+  800763:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  800768:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  80076b:	8d 40 04             	lea    0x4(%eax),%eax
+  80076e:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800771:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  800776:	83 ec 0c             	sub    $0xc,%esp
+  800779:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80077d:	50                   	push   %eax
+  80077e:	ff 75 e0             	push   -0x20(%ebp)
+  800781:	57                   	push   %edi
+  800782:	51                   	push   %ecx
+  800783:	52                   	push   %edx
+  800784:	89 da                	mov    %ebx,%edx
+  800786:	89 f0                	mov    %esi,%eax
+  800788:	e8 4a fb ff ff       	call   8002d7 <printnum>
+      break;
+  80078d:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  800790:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  800793:	e9 40 fc ff ff       	jmp    8003d8 <vprintfmt+0x1e>
+  if (lflag >= 2)
+  800798:	83 f9 01             	cmp    $0x1,%ecx
+  80079b:	7f 1b                	jg     8007b8 <vprintfmt+0x3fe>
+  else if (lflag)
+  80079d:	85 c9                	test   %ecx,%ecx
+  80079f:	74 2c                	je     8007cd <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  8007a1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a4:	8b 10                	mov    (%eax),%edx
+  8007a6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007ab:	8d 40 04             	lea    0x4(%eax),%eax
+  8007ae:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8007b1:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  8007b6:	eb be                	jmp    800776 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  8007b8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007bb:	8b 10                	mov    (%eax),%edx
+  8007bd:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007c0:	8d 40 08             	lea    0x8(%eax),%eax
+  8007c3:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8007c6:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  8007cb:	eb a9                	jmp    800776 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8007cd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007d0:	8b 10                	mov    (%eax),%edx
+  8007d2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007d7:	8d 40 04             	lea    0x4(%eax),%eax
+  8007da:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8007dd:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  8007e2:	eb 92                	jmp    800776 <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  8007e4:	83 ec 08             	sub    $0x8,%esp
+  8007e7:	53                   	push   %ebx
+  8007e8:	6a 25                	push   $0x25
+  8007ea:	ff d6                	call   *%esi
+      break;
+  8007ec:	83 c4 10             	add    $0x10,%esp
+  8007ef:	eb 9f                	jmp    800790 <vprintfmt+0x3d6>
+      putch('%', putdat);
+  8007f1:	83 ec 08             	sub    $0x8,%esp
+  8007f4:	53                   	push   %ebx
+  8007f5:	6a 25                	push   $0x25
+  8007f7:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  8007f9:	83 c4 10             	add    $0x10,%esp
+  8007fc:	89 f8                	mov    %edi,%eax
+  8007fe:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800802:	74 05                	je     800809 <vprintfmt+0x44f>
+  800804:	83 e8 01             	sub    $0x1,%eax
+  800807:	eb f5                	jmp    8007fe <vprintfmt+0x444>
+  800809:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80080c:	eb 82                	jmp    800790 <vprintfmt+0x3d6>
+
+0080080e <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80080e:	55                   	push   %ebp
+  80080f:	89 e5                	mov    %esp,%ebp
+  800811:	83 ec 18             	sub    $0x18,%esp
+  800814:	8b 45 08             	mov    0x8(%ebp),%eax
+  800817:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  80081a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80081d:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800821:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800824:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  80082b:	85 c0                	test   %eax,%eax
+  80082d:	74 26                	je     800855 <vsnprintf+0x47>
+  80082f:	85 d2                	test   %edx,%edx
+  800831:	7e 22                	jle    800855 <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800833:	ff 75 14             	push   0x14(%ebp)
+  800836:	ff 75 10             	push   0x10(%ebp)
+  800839:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80083c:	50                   	push   %eax
+  80083d:	68 80 03 80 00       	push   $0x800380
+  800842:	e8 73 fb ff ff       	call   8003ba <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800847:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80084a:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  80084d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800850:	83 c4 10             	add    $0x10,%esp
+}
+  800853:	c9                   	leave
+  800854:	c3                   	ret
+    return -E_INVAL;
+  800855:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80085a:	eb f7                	jmp    800853 <vsnprintf+0x45>
+
+0080085c <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80085c:	55                   	push   %ebp
+  80085d:	89 e5                	mov    %esp,%ebp
+  80085f:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  800862:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  800865:	50                   	push   %eax
+  800866:	ff 75 10             	push   0x10(%ebp)
+  800869:	ff 75 0c             	push   0xc(%ebp)
+  80086c:	ff 75 08             	push   0x8(%ebp)
+  80086f:	e8 9a ff ff ff       	call   80080e <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  800874:	c9                   	leave
+  800875:	c3                   	ret
+
+00800876 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800876:	55                   	push   %ebp
+  800877:	89 e5                	mov    %esp,%ebp
+  800879:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  80087c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800881:	eb 03                	jmp    800886 <strlen+0x10>
+    n++;
+  800883:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  800886:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80088a:	75 f7                	jne    800883 <strlen+0xd>
+  return n;
+}
+  80088c:	5d                   	pop    %ebp
+  80088d:	c3                   	ret
+
+0080088e <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80088e:	55                   	push   %ebp
+  80088f:	89 e5                	mov    %esp,%ebp
+  800891:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800894:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800897:	b8 00 00 00 00       	mov    $0x0,%eax
+  80089c:	eb 03                	jmp    8008a1 <strnlen+0x13>
+    n++;
+  80089e:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008a1:	39 d0                	cmp    %edx,%eax
+  8008a3:	74 08                	je     8008ad <strnlen+0x1f>
+  8008a5:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8008a9:	75 f3                	jne    80089e <strnlen+0x10>
+  8008ab:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  8008ad:	89 d0                	mov    %edx,%eax
+  8008af:	5d                   	pop    %ebp
+  8008b0:	c3                   	ret
+
+008008b1 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8008b1:	55                   	push   %ebp
+  8008b2:	89 e5                	mov    %esp,%ebp
+  8008b4:	53                   	push   %ebx
+  8008b5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008b8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  8008bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008c0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8008c4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8008c7:	83 c0 01             	add    $0x1,%eax
+  8008ca:	84 d2                	test   %dl,%dl
+  8008cc:	75 f2                	jne    8008c0 <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  8008ce:	89 c8                	mov    %ecx,%eax
+  8008d0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008d3:	c9                   	leave
+  8008d4:	c3                   	ret
+
+008008d5 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8008d5:	55                   	push   %ebp
+  8008d6:	89 e5                	mov    %esp,%ebp
+  8008d8:	53                   	push   %ebx
+  8008d9:	83 ec 10             	sub    $0x10,%esp
+  8008dc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  8008df:	53                   	push   %ebx
+  8008e0:	e8 91 ff ff ff       	call   800876 <strlen>
+  8008e5:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  8008e8:	ff 75 0c             	push   0xc(%ebp)
+  8008eb:	01 d8                	add    %ebx,%eax
+  8008ed:	50                   	push   %eax
+  8008ee:	e8 be ff ff ff       	call   8008b1 <strcpy>
+  return dst;
+}
+  8008f3:	89 d8                	mov    %ebx,%eax
+  8008f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008f8:	c9                   	leave
+  8008f9:	c3                   	ret
+
+008008fa <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  8008fa:	55                   	push   %ebp
+  8008fb:	89 e5                	mov    %esp,%ebp
+  8008fd:	56                   	push   %esi
+  8008fe:	53                   	push   %ebx
+  8008ff:	8b 75 08             	mov    0x8(%ebp),%esi
+  800902:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  800905:	89 f3                	mov    %esi,%ebx
+  800907:	03 5d 10             	add    0x10(%ebp),%ebx
+  80090a:	89 f0                	mov    %esi,%eax
+  80090c:	eb 0f                	jmp    80091d <strncpy+0x23>
+    *dst++ = *src;
+  80090e:	83 c0 01             	add    $0x1,%eax
+  800911:	0f b6 0a             	movzbl (%edx),%ecx
+  800914:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  800917:	80 f9 01             	cmp    $0x1,%cl
+  80091a:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  80091d:	39 d8                	cmp    %ebx,%eax
+  80091f:	75 ed                	jne    80090e <strncpy+0x14>
+  }
+  return ret;
+}
+  800921:	89 f0                	mov    %esi,%eax
+  800923:	5b                   	pop    %ebx
+  800924:	5e                   	pop    %esi
+  800925:	5d                   	pop    %ebp
+  800926:	c3                   	ret
+
+00800927 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800927:	55                   	push   %ebp
+  800928:	89 e5                	mov    %esp,%ebp
+  80092a:	56                   	push   %esi
+  80092b:	53                   	push   %ebx
+  80092c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80092f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800932:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  800935:	89 f0                	mov    %esi,%eax
+  800937:	85 d2                	test   %edx,%edx
+  800939:	74 21                	je     80095c <strlcpy+0x35>
+  80093b:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80093f:	89 f2                	mov    %esi,%edx
+  800941:	eb 09                	jmp    80094c <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  800943:	83 c1 01             	add    $0x1,%ecx
+  800946:	83 c2 01             	add    $0x1,%edx
+  800949:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  80094c:	39 c2                	cmp    %eax,%edx
+  80094e:	74 09                	je     800959 <strlcpy+0x32>
+  800950:	0f b6 19             	movzbl (%ecx),%ebx
+  800953:	84 db                	test   %bl,%bl
+  800955:	75 ec                	jne    800943 <strlcpy+0x1c>
+  800957:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  800959:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  80095c:	29 f0                	sub    %esi,%eax
+}
+  80095e:	5b                   	pop    %ebx
+  80095f:	5e                   	pop    %esi
+  800960:	5d                   	pop    %ebp
+  800961:	c3                   	ret
+
+00800962 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800962:	55                   	push   %ebp
+  800963:	89 e5                	mov    %esp,%ebp
+  800965:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800968:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  80096b:	eb 06                	jmp    800973 <strcmp+0x11>
+    p++, q++;
+  80096d:	83 c1 01             	add    $0x1,%ecx
+  800970:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  800973:	0f b6 01             	movzbl (%ecx),%eax
+  800976:	84 c0                	test   %al,%al
+  800978:	74 04                	je     80097e <strcmp+0x1c>
+  80097a:	3a 02                	cmp    (%edx),%al
+  80097c:	74 ef                	je     80096d <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  80097e:	0f b6 c0             	movzbl %al,%eax
+  800981:	0f b6 12             	movzbl (%edx),%edx
+  800984:	29 d0                	sub    %edx,%eax
+}
+  800986:	5d                   	pop    %ebp
+  800987:	c3                   	ret
+
+00800988 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800988:	55                   	push   %ebp
+  800989:	89 e5                	mov    %esp,%ebp
+  80098b:	53                   	push   %ebx
+  80098c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80098f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800992:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  800995:	eb 09                	jmp    8009a0 <strncmp+0x18>
+    n--, p++, q++;
+  800997:	83 ea 01             	sub    $0x1,%edx
+  80099a:	83 c0 01             	add    $0x1,%eax
+  80099d:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  8009a0:	85 d2                	test   %edx,%edx
+  8009a2:	74 18                	je     8009bc <strncmp+0x34>
+  8009a4:	0f b6 18             	movzbl (%eax),%ebx
+  8009a7:	84 db                	test   %bl,%bl
+  8009a9:	74 04                	je     8009af <strncmp+0x27>
+  8009ab:	3a 19                	cmp    (%ecx),%bl
+  8009ad:	74 e8                	je     800997 <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8009af:	0f b6 00             	movzbl (%eax),%eax
+  8009b2:	0f b6 11             	movzbl (%ecx),%edx
+  8009b5:	29 d0                	sub    %edx,%eax
+}
+  8009b7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009ba:	c9                   	leave
+  8009bb:	c3                   	ret
+    return 0;
+  8009bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009c1:	eb f4                	jmp    8009b7 <strncmp+0x2f>
+
+008009c3 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8009c3:	55                   	push   %ebp
+  8009c4:	89 e5                	mov    %esp,%ebp
+  8009c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009c9:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  8009cd:	eb 03                	jmp    8009d2 <strchr+0xf>
+  8009cf:	83 c0 01             	add    $0x1,%eax
+  8009d2:	0f b6 10             	movzbl (%eax),%edx
+  8009d5:	84 d2                	test   %dl,%dl
+  8009d7:	74 06                	je     8009df <strchr+0x1c>
+    if (*s == c)
+  8009d9:	38 ca                	cmp    %cl,%dl
+  8009db:	75 f2                	jne    8009cf <strchr+0xc>
+  8009dd:	eb 05                	jmp    8009e4 <strchr+0x21>
+      return (char*)s;
+  return 0;
+  8009df:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009e4:	5d                   	pop    %ebp
+  8009e5:	c3                   	ret
+
+008009e6 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8009e6:	55                   	push   %ebp
+  8009e7:	89 e5                	mov    %esp,%ebp
+  8009e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009ec:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  8009f0:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  8009f3:	38 ca                	cmp    %cl,%dl
+  8009f5:	74 09                	je     800a00 <strfind+0x1a>
+  8009f7:	84 d2                	test   %dl,%dl
+  8009f9:	74 05                	je     800a00 <strfind+0x1a>
+  for (; *s; s++)
+  8009fb:	83 c0 01             	add    $0x1,%eax
+  8009fe:	eb f0                	jmp    8009f0 <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  800a00:	5d                   	pop    %ebp
+  800a01:	c3                   	ret
+
+00800a02 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a02:	55                   	push   %ebp
+  800a03:	89 e5                	mov    %esp,%ebp
+  800a05:	57                   	push   %edi
+  800a06:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a09:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  800a0c:	85 c9                	test   %ecx,%ecx
+  800a0e:	74 20                	je     800a30 <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  800a10:	89 f8                	mov    %edi,%eax
+  800a12:	09 c8                	or     %ecx,%eax
+  800a14:	a8 03                	test   $0x3,%al
+  800a16:	75 12                	jne    800a2a <memset+0x28>
+    c &= 0xFF;
+  800a18:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a1c:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  800a22:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  800a25:	fc                   	cld
+  800a26:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a28:	eb 06                	jmp    800a30 <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  800a2a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a2d:	fc                   	cld
+  800a2e:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  800a30:	89 f8                	mov    %edi,%eax
+  800a32:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a35:	c9                   	leave
+  800a36:	c3                   	ret
+
+00800a37 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a37:	55                   	push   %ebp
+  800a38:	89 e5                	mov    %esp,%ebp
+  800a3a:	57                   	push   %edi
+  800a3b:	56                   	push   %esi
+  800a3c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a3f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a42:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  800a45:	39 c6                	cmp    %eax,%esi
+  800a47:	73 32                	jae    800a7b <memmove+0x44>
+  800a49:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a4c:	39 d0                	cmp    %edx,%eax
+  800a4e:	73 2b                	jae    800a7b <memmove+0x44>
+    s += n;
+    d += n;
+  800a50:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a53:	89 d6                	mov    %edx,%esi
+  800a55:	09 fe                	or     %edi,%esi
+  800a57:	09 ce                	or     %ecx,%esi
+  800a59:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a5f:	75 0e                	jne    800a6f <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a61:	83 ef 04             	sub    $0x4,%edi
+  800a64:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a67:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  800a6a:	fd                   	std
+  800a6b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a6d:	eb 09                	jmp    800a78 <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a6f:	83 ef 01             	sub    $0x1,%edi
+  800a72:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  800a75:	fd                   	std
+  800a76:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  800a78:	fc                   	cld
+  800a79:	eb 1a                	jmp    800a95 <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a7b:	89 f2                	mov    %esi,%edx
+  800a7d:	09 c2                	or     %eax,%edx
+  800a7f:	09 ca                	or     %ecx,%edx
+  800a81:	f6 c2 03             	test   $0x3,%dl
+  800a84:	75 0a                	jne    800a90 <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a86:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  800a89:	89 c7                	mov    %eax,%edi
+  800a8b:	fc                   	cld
+  800a8c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a8e:	eb 05                	jmp    800a95 <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  800a90:	89 c7                	mov    %eax,%edi
+  800a92:	fc                   	cld
+  800a93:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  800a95:	5e                   	pop    %esi
+  800a96:	5f                   	pop    %edi
+  800a97:	5d                   	pop    %ebp
+  800a98:	c3                   	ret
+
+00800a99 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a99:	55                   	push   %ebp
+  800a9a:	89 e5                	mov    %esp,%ebp
+  800a9c:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  800a9f:	ff 75 10             	push   0x10(%ebp)
+  800aa2:	ff 75 0c             	push   0xc(%ebp)
+  800aa5:	ff 75 08             	push   0x8(%ebp)
+  800aa8:	e8 8a ff ff ff       	call   800a37 <memmove>
+}
+  800aad:	c9                   	leave
+  800aae:	c3                   	ret
+
+00800aaf <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800aaf:	55                   	push   %ebp
+  800ab0:	89 e5                	mov    %esp,%ebp
+  800ab2:	56                   	push   %esi
+  800ab3:	53                   	push   %ebx
+  800ab4:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ab7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  800aba:	89 c6                	mov    %eax,%esi
+  800abc:	03 75 10             	add    0x10(%ebp),%esi
+  800abf:	eb 06                	jmp    800ac7 <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  800ac1:	83 c0 01             	add    $0x1,%eax
+  800ac4:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  800ac7:	39 f0                	cmp    %esi,%eax
+  800ac9:	74 14                	je     800adf <memcmp+0x30>
+    if (*s1 != *s2)
+  800acb:	0f b6 08             	movzbl (%eax),%ecx
+  800ace:	0f b6 1a             	movzbl (%edx),%ebx
+  800ad1:	38 d9                	cmp    %bl,%cl
+  800ad3:	74 ec                	je     800ac1 <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  800ad5:	0f b6 c1             	movzbl %cl,%eax
+  800ad8:	0f b6 db             	movzbl %bl,%ebx
+  800adb:	29 d8                	sub    %ebx,%eax
+  800add:	eb 05                	jmp    800ae4 <memcmp+0x35>
+  }
+
+  return 0;
+  800adf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ae4:	5b                   	pop    %ebx
+  800ae5:	5e                   	pop    %esi
+  800ae6:	5d                   	pop    %ebp
+  800ae7:	c3                   	ret
+
+00800ae8 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800ae8:	55                   	push   %ebp
+  800ae9:	89 e5                	mov    %esp,%ebp
+  800aeb:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  800af1:	89 c2                	mov    %eax,%edx
+  800af3:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  800af6:	eb 03                	jmp    800afb <memfind+0x13>
+  800af8:	83 c0 01             	add    $0x1,%eax
+  800afb:	39 d0                	cmp    %edx,%eax
+  800afd:	73 04                	jae    800b03 <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  800aff:	38 08                	cmp    %cl,(%eax)
+  800b01:	75 f5                	jne    800af8 <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  800b03:	5d                   	pop    %ebp
+  800b04:	c3                   	ret
+
+00800b05 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800b05:	55                   	push   %ebp
+  800b06:	89 e5                	mov    %esp,%ebp
+  800b08:	57                   	push   %edi
+  800b09:	56                   	push   %esi
+  800b0a:	53                   	push   %ebx
+  800b0b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b0e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  800b11:	eb 03                	jmp    800b16 <strtol+0x11>
+    s++;
+  800b13:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  800b16:	0f b6 02             	movzbl (%edx),%eax
+  800b19:	3c 20                	cmp    $0x20,%al
+  800b1b:	74 f6                	je     800b13 <strtol+0xe>
+  800b1d:	3c 09                	cmp    $0x9,%al
+  800b1f:	74 f2                	je     800b13 <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  800b21:	3c 2b                	cmp    $0x2b,%al
+  800b23:	74 2a                	je     800b4f <strtol+0x4a>
+  int neg = 0;
+  800b25:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  800b2a:	3c 2d                	cmp    $0x2d,%al
+  800b2c:	74 2b                	je     800b59 <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b2e:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b34:	75 0f                	jne    800b45 <strtol+0x40>
+  800b36:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b39:	74 28                	je     800b63 <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  800b3b:	85 db                	test   %ebx,%ebx
+  800b3d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b42:	0f 44 d8             	cmove  %eax,%ebx
+  800b45:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b4a:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b4d:	eb 46                	jmp    800b95 <strtol+0x90>
+    s++;
+  800b4f:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  800b52:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b57:	eb d5                	jmp    800b2e <strtol+0x29>
+    s++, neg = 1;
+  800b59:	83 c2 01             	add    $0x1,%edx
+  800b5c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b61:	eb cb                	jmp    800b2e <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b63:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800b67:	74 0e                	je     800b77 <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  800b69:	85 db                	test   %ebx,%ebx
+  800b6b:	75 d8                	jne    800b45 <strtol+0x40>
+    s++, base = 8;
+  800b6d:	83 c2 01             	add    $0x1,%edx
+  800b70:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800b75:	eb ce                	jmp    800b45 <strtol+0x40>
+    s += 2, base = 16;
+  800b77:	83 c2 02             	add    $0x2,%edx
+  800b7a:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800b7f:	eb c4                	jmp    800b45 <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  800b81:	0f be c0             	movsbl %al,%eax
+  800b84:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  800b87:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800b8a:	7d 3a                	jge    800bc6 <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  800b8c:	83 c2 01             	add    $0x1,%edx
+  800b8f:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800b93:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  800b95:	0f b6 02             	movzbl (%edx),%eax
+  800b98:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800b9b:	89 f3                	mov    %esi,%ebx
+  800b9d:	80 fb 09             	cmp    $0x9,%bl
+  800ba0:	76 df                	jbe    800b81 <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  800ba2:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800ba5:	89 f3                	mov    %esi,%ebx
+  800ba7:	80 fb 19             	cmp    $0x19,%bl
+  800baa:	77 08                	ja     800bb4 <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  800bac:	0f be c0             	movsbl %al,%eax
+  800baf:	83 e8 57             	sub    $0x57,%eax
+  800bb2:	eb d3                	jmp    800b87 <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  800bb4:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800bb7:	89 f3                	mov    %esi,%ebx
+  800bb9:	80 fb 19             	cmp    $0x19,%bl
+  800bbc:	77 08                	ja     800bc6 <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  800bbe:	0f be c0             	movsbl %al,%eax
+  800bc1:	83 e8 37             	sub    $0x37,%eax
+  800bc4:	eb c1                	jmp    800b87 <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  800bc6:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800bca:	74 05                	je     800bd1 <strtol+0xcc>
+    *endptr = (char*)s;
+  800bcc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800bcf:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  800bd1:	89 c8                	mov    %ecx,%eax
+  800bd3:	f7 d8                	neg    %eax
+  800bd5:	85 ff                	test   %edi,%edi
+  800bd7:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800bda:	89 c8                	mov    %ecx,%eax
+  800bdc:	5b                   	pop    %ebx
+  800bdd:	5e                   	pop    %esi
+  800bde:	5f                   	pop    %edi
+  800bdf:	5d                   	pop    %ebp
+  800be0:	c3                   	ret
+
+00800be1 <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800be1:	55                   	push   %ebp
+  800be2:	89 e5                	mov    %esp,%ebp
+  800be4:	57                   	push   %edi
+  800be5:	56                   	push   %esi
+  800be6:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800be7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bec:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bf2:	89 c3                	mov    %eax,%ebx
+  800bf4:	89 c7                	mov    %eax,%edi
+  800bf6:	89 c6                	mov    %eax,%esi
+  800bf8:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800bfa:	5b                   	pop    %ebx
+  800bfb:	5e                   	pop    %esi
+  800bfc:	5f                   	pop    %edi
+  800bfd:	5d                   	pop    %ebp
+  800bfe:	c3                   	ret
+
+00800bff <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800bff:	55                   	push   %ebp
+  800c00:	89 e5                	mov    %esp,%ebp
+  800c02:	57                   	push   %edi
+  800c03:	56                   	push   %esi
+  800c04:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800c05:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c0a:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c0f:	89 d1                	mov    %edx,%ecx
+  800c11:	89 d3                	mov    %edx,%ebx
+  800c13:	89 d7                	mov    %edx,%edi
+  800c15:	89 d6                	mov    %edx,%esi
+  800c17:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800c19:	5b                   	pop    %ebx
+  800c1a:	5e                   	pop    %esi
+  800c1b:	5f                   	pop    %edi
+  800c1c:	5d                   	pop    %ebp
+  800c1d:	c3                   	ret
+
+00800c1e <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c1e:	55                   	push   %ebp
+  800c1f:	89 e5                	mov    %esp,%ebp
+  800c21:	57                   	push   %edi
+  800c22:	56                   	push   %esi
+  800c23:	53                   	push   %ebx
+  800c24:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800c27:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c2c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c2f:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c34:	89 cb                	mov    %ecx,%ebx
+  800c36:	89 cf                	mov    %ecx,%edi
+  800c38:	89 ce                	mov    %ecx,%esi
+  800c3a:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c3c:	85 c0                	test   %eax,%eax
+  800c3e:	7f 08                	jg     800c48 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800c40:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c43:	5b                   	pop    %ebx
+  800c44:	5e                   	pop    %esi
+  800c45:	5f                   	pop    %edi
+  800c46:	5d                   	pop    %ebp
+  800c47:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c48:	83 ec 0c             	sub    $0xc,%esp
+  800c4b:	50                   	push   %eax
+  800c4c:	6a 03                	push   $0x3
+  800c4e:	68 43 34 80 00       	push   $0x803443
+  800c53:	6a 23                	push   $0x23
+  800c55:	68 60 34 80 00       	push   $0x803460
+  800c5a:	e8 89 f5 ff ff       	call   8001e8 <_panic>
+
+00800c5f <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800c5f:	55                   	push   %ebp
+  800c60:	89 e5                	mov    %esp,%ebp
+  800c62:	57                   	push   %edi
+  800c63:	56                   	push   %esi
+  800c64:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800c65:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c6a:	b8 02 00 00 00       	mov    $0x2,%eax
+  800c6f:	89 d1                	mov    %edx,%ecx
+  800c71:	89 d3                	mov    %edx,%ebx
+  800c73:	89 d7                	mov    %edx,%edi
+  800c75:	89 d6                	mov    %edx,%esi
+  800c77:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800c79:	5b                   	pop    %ebx
+  800c7a:	5e                   	pop    %esi
+  800c7b:	5f                   	pop    %edi
+  800c7c:	5d                   	pop    %ebp
+  800c7d:	c3                   	ret
+
+00800c7e <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800c7e:	55                   	push   %ebp
+  800c7f:	89 e5                	mov    %esp,%ebp
+  800c81:	57                   	push   %edi
+  800c82:	56                   	push   %esi
+  800c83:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800c84:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c89:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800c8e:	89 d1                	mov    %edx,%ecx
+  800c90:	89 d3                	mov    %edx,%ebx
+  800c92:	89 d7                	mov    %edx,%edi
+  800c94:	89 d6                	mov    %edx,%esi
+  800c96:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800c98:	5b                   	pop    %ebx
+  800c99:	5e                   	pop    %esi
+  800c9a:	5f                   	pop    %edi
+  800c9b:	5d                   	pop    %ebp
+  800c9c:	c3                   	ret
+
+00800c9d <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  800c9d:	55                   	push   %ebp
+  800c9e:	89 e5                	mov    %esp,%ebp
+  800ca0:	57                   	push   %edi
+  800ca1:	56                   	push   %esi
+  800ca2:	53                   	push   %ebx
+  800ca3:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  800ca6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  800caa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800caf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cb2:	b8 14 00 00 00       	mov    $0x14,%eax
+  800cb7:	89 df                	mov    %ebx,%edi
+  800cb9:	89 de                	mov    %ebx,%esi
+  800cbb:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800cbd:	85 c0                	test   %eax,%eax
+  800cbf:	7f 08                	jg     800cc9 <sys_env_set_cow+0x2c>
+}
+  800cc1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cc4:	5b                   	pop    %ebx
+  800cc5:	5e                   	pop    %esi
+  800cc6:	5f                   	pop    %edi
+  800cc7:	5d                   	pop    %ebp
+  800cc8:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800cc9:	83 ec 0c             	sub    $0xc,%esp
+  800ccc:	50                   	push   %eax
+  800ccd:	6a 14                	push   $0x14
+  800ccf:	68 43 34 80 00       	push   $0x803443
+  800cd4:	6a 23                	push   $0x23
+  800cd6:	68 60 34 80 00       	push   $0x803460
+  800cdb:	e8 08 f5 ff ff       	call   8001e8 <_panic>
+
+00800ce0 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800ce0:	55                   	push   %ebp
+  800ce1:	89 e5                	mov    %esp,%ebp
+  800ce3:	57                   	push   %edi
+  800ce4:	56                   	push   %esi
+  800ce5:	53                   	push   %ebx
+  800ce6:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800ce9:	be 00 00 00 00       	mov    $0x0,%esi
+  800cee:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cf1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cf4:	b8 04 00 00 00       	mov    $0x4,%eax
+  800cf9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cfc:	89 f7                	mov    %esi,%edi
+  800cfe:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d00:	85 c0                	test   %eax,%eax
+  800d02:	7f 08                	jg     800d0c <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  800d04:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d07:	5b                   	pop    %ebx
+  800d08:	5e                   	pop    %esi
+  800d09:	5f                   	pop    %edi
+  800d0a:	5d                   	pop    %ebp
+  800d0b:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d0c:	83 ec 0c             	sub    $0xc,%esp
+  800d0f:	50                   	push   %eax
+  800d10:	6a 04                	push   $0x4
+  800d12:	68 43 34 80 00       	push   $0x803443
+  800d17:	6a 23                	push   $0x23
+  800d19:	68 60 34 80 00       	push   $0x803460
+  800d1e:	e8 c5 f4 ff ff       	call   8001e8 <_panic>
+
+00800d23 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800d23:	55                   	push   %ebp
+  800d24:	89 e5                	mov    %esp,%ebp
+  800d26:	57                   	push   %edi
+  800d27:	56                   	push   %esi
+  800d28:	53                   	push   %ebx
+  800d29:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800d2c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d2f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d32:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d37:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d3a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d3d:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d40:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d42:	85 c0                	test   %eax,%eax
+  800d44:	7f 08                	jg     800d4e <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  800d46:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d49:	5b                   	pop    %ebx
+  800d4a:	5e                   	pop    %esi
+  800d4b:	5f                   	pop    %edi
+  800d4c:	5d                   	pop    %ebp
+  800d4d:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d4e:	83 ec 0c             	sub    $0xc,%esp
+  800d51:	50                   	push   %eax
+  800d52:	6a 05                	push   $0x5
+  800d54:	68 43 34 80 00       	push   $0x803443
+  800d59:	6a 23                	push   $0x23
+  800d5b:	68 60 34 80 00       	push   $0x803460
+  800d60:	e8 83 f4 ff ff       	call   8001e8 <_panic>
+
+00800d65 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800d65:	55                   	push   %ebp
+  800d66:	89 e5                	mov    %esp,%ebp
+  800d68:	57                   	push   %edi
+  800d69:	56                   	push   %esi
+  800d6a:	53                   	push   %ebx
+  800d6b:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800d6e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d73:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d76:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d79:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d7e:	89 df                	mov    %ebx,%edi
+  800d80:	89 de                	mov    %ebx,%esi
+  800d82:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d84:	85 c0                	test   %eax,%eax
+  800d86:	7f 08                	jg     800d90 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  800d88:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d8b:	5b                   	pop    %ebx
+  800d8c:	5e                   	pop    %esi
+  800d8d:	5f                   	pop    %edi
+  800d8e:	5d                   	pop    %ebp
+  800d8f:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d90:	83 ec 0c             	sub    $0xc,%esp
+  800d93:	50                   	push   %eax
+  800d94:	6a 06                	push   $0x6
+  800d96:	68 43 34 80 00       	push   $0x803443
+  800d9b:	6a 23                	push   $0x23
+  800d9d:	68 60 34 80 00       	push   $0x803460
+  800da2:	e8 41 f4 ff ff       	call   8001e8 <_panic>
+
+00800da7 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  800da7:	55                   	push   %ebp
+  800da8:	89 e5                	mov    %esp,%ebp
+  800daa:	57                   	push   %edi
+  800dab:	56                   	push   %esi
+  800dac:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800dad:	8b 55 08             	mov    0x8(%ebp),%edx
+  800db0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800db3:	b8 11 00 00 00       	mov    $0x11,%eax
+  800db8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dbb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dbe:	8b 75 18             	mov    0x18(%ebp),%esi
+  800dc1:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  800dc3:	5b                   	pop    %ebx
+  800dc4:	5e                   	pop    %esi
+  800dc5:	5f                   	pop    %edi
+  800dc6:	5d                   	pop    %ebp
+  800dc7:	c3                   	ret
+
+00800dc8 <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  800dc8:	55                   	push   %ebp
+  800dc9:	89 e5                	mov    %esp,%ebp
+  800dcb:	57                   	push   %edi
+  800dcc:	56                   	push   %esi
+  800dcd:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800dce:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dd1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dd4:	b8 12 00 00 00       	mov    $0x12,%eax
+  800dd9:	be 00 00 00 00       	mov    $0x0,%esi
+  800dde:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800de1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800de4:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  800de6:	5b                   	pop    %ebx
+  800de7:	5e                   	pop    %esi
+  800de8:	5f                   	pop    %edi
+  800de9:	5d                   	pop    %ebp
+  800dea:	c3                   	ret
+
+00800deb <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  800deb:	55                   	push   %ebp
+  800dec:	89 e5                	mov    %esp,%ebp
+  800dee:	57                   	push   %edi
+  800def:	56                   	push   %esi
+  800df0:	53                   	push   %ebx
+  800df1:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800df4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800df9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dfc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dff:	b8 16 00 00 00       	mov    $0x16,%eax
+  800e04:	89 df                	mov    %ebx,%edi
+  800e06:	89 de                	mov    %ebx,%esi
+  800e08:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e0a:	85 c0                	test   %eax,%eax
+  800e0c:	7f 08                	jg     800e16 <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  800e0e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e11:	5b                   	pop    %ebx
+  800e12:	5e                   	pop    %esi
+  800e13:	5f                   	pop    %edi
+  800e14:	5d                   	pop    %ebp
+  800e15:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e16:	83 ec 0c             	sub    $0xc,%esp
+  800e19:	50                   	push   %eax
+  800e1a:	6a 16                	push   $0x16
+  800e1c:	68 43 34 80 00       	push   $0x803443
+  800e21:	6a 23                	push   $0x23
+  800e23:	68 60 34 80 00       	push   $0x803460
+  800e28:	e8 bb f3 ff ff       	call   8001e8 <_panic>
+
+00800e2d <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  800e2d:	55                   	push   %ebp
+  800e2e:	89 e5                	mov    %esp,%ebp
+  800e30:	57                   	push   %edi
+  800e31:	56                   	push   %esi
+  800e32:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e33:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e38:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e3b:	b8 17 00 00 00       	mov    $0x17,%eax
+  800e40:	89 cb                	mov    %ecx,%ebx
+  800e42:	89 cf                	mov    %ecx,%edi
+  800e44:	89 ce                	mov    %ecx,%esi
+  800e46:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  800e48:	5b                   	pop    %ebx
+  800e49:	5e                   	pop    %esi
+  800e4a:	5f                   	pop    %edi
+  800e4b:	5d                   	pop    %ebp
+  800e4c:	c3                   	ret
+
+00800e4d <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  800e4d:	55                   	push   %ebp
+  800e4e:	89 e5                	mov    %esp,%ebp
+  800e50:	57                   	push   %edi
+  800e51:	56                   	push   %esi
+  800e52:	53                   	push   %ebx
+  800e53:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e56:	be 00 00 00 00       	mov    $0x0,%esi
+  800e5b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e5e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e61:	b8 18 00 00 00       	mov    $0x18,%eax
+  800e66:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e69:	89 f7                	mov    %esi,%edi
+  800e6b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e6d:	85 c0                	test   %eax,%eax
+  800e6f:	7f 08                	jg     800e79 <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  800e71:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e74:	5b                   	pop    %ebx
+  800e75:	5e                   	pop    %esi
+  800e76:	5f                   	pop    %edi
+  800e77:	5d                   	pop    %ebp
+  800e78:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e79:	83 ec 0c             	sub    $0xc,%esp
+  800e7c:	50                   	push   %eax
+  800e7d:	6a 18                	push   $0x18
+  800e7f:	68 43 34 80 00       	push   $0x803443
+  800e84:	6a 23                	push   $0x23
+  800e86:	68 60 34 80 00       	push   $0x803460
+  800e8b:	e8 58 f3 ff ff       	call   8001e8 <_panic>
+
+00800e90 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  800e90:	55                   	push   %ebp
+  800e91:	89 e5                	mov    %esp,%ebp
+  800e93:	57                   	push   %edi
+  800e94:	56                   	push   %esi
+  800e95:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e96:	be 00 00 00 00       	mov    $0x0,%esi
+  800e9b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e9e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ea1:	b8 19 00 00 00       	mov    $0x19,%eax
+  800ea6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ea9:	89 f7                	mov    %esi,%edi
+  800eab:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  800ead:	5b                   	pop    %ebx
+  800eae:	5e                   	pop    %esi
+  800eaf:	5f                   	pop    %edi
+  800eb0:	5d                   	pop    %ebp
+  800eb1:	c3                   	ret
+
+00800eb2 <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  800eb2:	55                   	push   %ebp
+  800eb3:	89 e5                	mov    %esp,%ebp
+  800eb5:	57                   	push   %edi
+  800eb6:	56                   	push   %esi
+  800eb7:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800eb8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ebd:	b8 15 00 00 00       	mov    $0x15,%eax
+  800ec2:	89 d1                	mov    %edx,%ecx
+  800ec4:	89 d3                	mov    %edx,%ebx
+  800ec6:	89 d7                	mov    %edx,%edi
+  800ec8:	89 d6                	mov    %edx,%esi
+  800eca:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800ecc:	5b                   	pop    %ebx
+  800ecd:	5e                   	pop    %esi
+  800ece:	5f                   	pop    %edi
+  800ecf:	5d                   	pop    %ebp
+  800ed0:	c3                   	ret
+
+00800ed1 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800ed1:	55                   	push   %ebp
+  800ed2:	89 e5                	mov    %esp,%ebp
+  800ed4:	57                   	push   %edi
+  800ed5:	56                   	push   %esi
+  800ed6:	53                   	push   %ebx
+  800ed7:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800eda:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800edf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ee5:	b8 08 00 00 00       	mov    $0x8,%eax
+  800eea:	89 df                	mov    %ebx,%edi
+  800eec:	89 de                	mov    %ebx,%esi
+  800eee:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ef0:	85 c0                	test   %eax,%eax
+  800ef2:	7f 08                	jg     800efc <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800ef4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ef7:	5b                   	pop    %ebx
+  800ef8:	5e                   	pop    %esi
+  800ef9:	5f                   	pop    %edi
+  800efa:	5d                   	pop    %ebp
+  800efb:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800efc:	83 ec 0c             	sub    $0xc,%esp
+  800eff:	50                   	push   %eax
+  800f00:	6a 08                	push   $0x8
+  800f02:	68 43 34 80 00       	push   $0x803443
+  800f07:	6a 23                	push   $0x23
+  800f09:	68 60 34 80 00       	push   $0x803460
+  800f0e:	e8 d5 f2 ff ff       	call   8001e8 <_panic>
+
+00800f13 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800f13:	55                   	push   %ebp
+  800f14:	89 e5                	mov    %esp,%ebp
+  800f16:	57                   	push   %edi
+  800f17:	56                   	push   %esi
+  800f18:	53                   	push   %ebx
+  800f19:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f1c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f21:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f24:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f27:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f2c:	89 df                	mov    %ebx,%edi
+  800f2e:	89 de                	mov    %ebx,%esi
+  800f30:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f32:	85 c0                	test   %eax,%eax
+  800f34:	7f 08                	jg     800f3e <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  800f36:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f39:	5b                   	pop    %ebx
+  800f3a:	5e                   	pop    %esi
+  800f3b:	5f                   	pop    %edi
+  800f3c:	5d                   	pop    %ebp
+  800f3d:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f3e:	83 ec 0c             	sub    $0xc,%esp
+  800f41:	50                   	push   %eax
+  800f42:	6a 09                	push   $0x9
+  800f44:	68 43 34 80 00       	push   $0x803443
+  800f49:	6a 23                	push   $0x23
+  800f4b:	68 60 34 80 00       	push   $0x803460
+  800f50:	e8 93 f2 ff ff       	call   8001e8 <_panic>
+
+00800f55 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800f55:	55                   	push   %ebp
+  800f56:	89 e5                	mov    %esp,%ebp
+  800f58:	57                   	push   %edi
+  800f59:	56                   	push   %esi
+  800f5a:	53                   	push   %ebx
+  800f5b:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f5e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f63:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f66:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f69:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f6e:	89 df                	mov    %ebx,%edi
+  800f70:	89 de                	mov    %ebx,%esi
+  800f72:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f74:	85 c0                	test   %eax,%eax
+  800f76:	7f 08                	jg     800f80 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  800f78:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f7b:	5b                   	pop    %ebx
+  800f7c:	5e                   	pop    %esi
+  800f7d:	5f                   	pop    %edi
+  800f7e:	5d                   	pop    %ebp
+  800f7f:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f80:	83 ec 0c             	sub    $0xc,%esp
+  800f83:	50                   	push   %eax
+  800f84:	6a 0a                	push   $0xa
+  800f86:	68 43 34 80 00       	push   $0x803443
+  800f8b:	6a 23                	push   $0x23
+  800f8d:	68 60 34 80 00       	push   $0x803460
+  800f92:	e8 51 f2 ff ff       	call   8001e8 <_panic>
+
+00800f97 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  800f97:	55                   	push   %ebp
+  800f98:	89 e5                	mov    %esp,%ebp
+  800f9a:	57                   	push   %edi
+  800f9b:	56                   	push   %esi
+  800f9c:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f9d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fa3:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800fa8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fab:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fae:	8b 75 18             	mov    0x18(%ebp),%esi
+  800fb1:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  800fb3:	5b                   	pop    %ebx
+  800fb4:	5e                   	pop    %esi
+  800fb5:	5f                   	pop    %edi
+  800fb6:	5d                   	pop    %ebp
+  800fb7:	c3                   	ret
+
+00800fb8 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  800fb8:	55                   	push   %ebp
+  800fb9:	89 e5                	mov    %esp,%ebp
+  800fbb:	57                   	push   %edi
+  800fbc:	56                   	push   %esi
+  800fbd:	53                   	push   %ebx
+  800fbe:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800fc1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fc6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fcc:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800fd1:	89 df                	mov    %ebx,%edi
+  800fd3:	89 de                	mov    %ebx,%esi
+  800fd5:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800fd7:	85 c0                	test   %eax,%eax
+  800fd9:	7f 08                	jg     800fe3 <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  800fdb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fde:	5b                   	pop    %ebx
+  800fdf:	5e                   	pop    %esi
+  800fe0:	5f                   	pop    %edi
+  800fe1:	5d                   	pop    %ebp
+  800fe2:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800fe3:	83 ec 0c             	sub    $0xc,%esp
+  800fe6:	50                   	push   %eax
+  800fe7:	6a 0d                	push   $0xd
+  800fe9:	68 43 34 80 00       	push   $0x803443
+  800fee:	6a 23                	push   $0x23
+  800ff0:	68 60 34 80 00       	push   $0x803460
+  800ff5:	e8 ee f1 ff ff       	call   8001e8 <_panic>
+
+00800ffa <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  800ffa:	55                   	push   %ebp
+  800ffb:	89 e5                	mov    %esp,%ebp
+  800ffd:	57                   	push   %edi
+  800ffe:	56                   	push   %esi
+  800fff:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801000:	ba 00 00 00 00       	mov    $0x0,%edx
+  801005:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80100a:	89 d1                	mov    %edx,%ecx
+  80100c:	89 d3                	mov    %edx,%ebx
+  80100e:	89 d7                	mov    %edx,%edi
+  801010:	89 d6                	mov    %edx,%esi
+  801012:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801014:	5b                   	pop    %ebx
+  801015:	5e                   	pop    %esi
+  801016:	5f                   	pop    %edi
+  801017:	5d                   	pop    %ebp
+  801018:	c3                   	ret
+
+00801019 <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  801019:	55                   	push   %ebp
+  80101a:	89 e5                	mov    %esp,%ebp
+  80101c:	57                   	push   %edi
+  80101d:	56                   	push   %esi
+  80101e:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80101f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801022:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801025:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80102a:	be 00 00 00 00       	mov    $0x0,%esi
+  80102f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801032:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801035:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  801037:	5b                   	pop    %ebx
+  801038:	5e                   	pop    %esi
+  801039:	5f                   	pop    %edi
+  80103a:	5d                   	pop    %ebp
+  80103b:	c3                   	ret
+
+0080103c <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  80103c:	55                   	push   %ebp
+  80103d:	89 e5                	mov    %esp,%ebp
+  80103f:	57                   	push   %edi
+  801040:	56                   	push   %esi
+  801041:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801042:	be 00 00 00 00       	mov    $0x0,%esi
+  801047:	8b 55 08             	mov    0x8(%ebp),%edx
+  80104a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80104d:	b8 10 00 00 00       	mov    $0x10,%eax
+  801052:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801055:	89 f7                	mov    %esi,%edi
+  801057:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  801059:	5b                   	pop    %ebx
+  80105a:	5e                   	pop    %esi
+  80105b:	5f                   	pop    %edi
+  80105c:	5d                   	pop    %ebp
+  80105d:	c3                   	ret
+
+0080105e <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  80105e:	55                   	push   %ebp
+  80105f:	89 e5                	mov    %esp,%ebp
+  801061:	57                   	push   %edi
+  801062:	56                   	push   %esi
+  801063:	53                   	push   %ebx
+  801064:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  801067:	80 3d 68 57 80 00 00 	cmpb   $0x0,0x805768
+  80106e:	74 41                	je     8010b1 <sys_batch+0x53>
+  801070:	8b 45 08             	mov    0x8(%ebp),%eax
+  801073:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  801076:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  80107d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801080:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  801083:	7d 45                	jge    8010ca <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  801085:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801088:	8b 06                	mov    (%esi),%eax
+  80108a:	8b 56 04             	mov    0x4(%esi),%edx
+  80108d:	8b 4e 08             	mov    0x8(%esi),%ecx
+  801090:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  801093:	8b 7e 10             	mov    0x10(%esi),%edi
+  801096:	8b 76 14             	mov    0x14(%esi),%esi
+  801099:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  80109b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80109e:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  8010a1:	83 c6 1c             	add    $0x1c,%esi
+  8010a4:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  8010a7:	85 c0                	test   %eax,%eax
+  8010a9:	78 1f                	js     8010ca <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  8010ab:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  8010af:	eb cc                	jmp    80107d <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  8010b1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010b6:	b8 13 00 00 00       	mov    $0x13,%eax
+  8010bb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010be:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010c1:	89 df                	mov    %ebx,%edi
+  8010c3:	89 de                	mov    %ebx,%esi
+  8010c5:	cd 30                	int    $0x30
+  8010c7:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  8010ca:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8010cd:	83 c4 08             	add    $0x8,%esp
+  8010d0:	5b                   	pop    %ebx
+  8010d1:	5e                   	pop    %esi
+  8010d2:	5f                   	pop    %edi
+  8010d3:	5d                   	pop    %ebp
+  8010d4:	c3                   	ret
+
+008010d5 <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  8010d5:	55                   	push   %ebp
+  8010d6:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  8010d8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010db:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8010e1:	5d                   	pop    %ebp
+  8010e2:	c3                   	ret
+
+008010e3 <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  8010e3:	55                   	push   %ebp
+  8010e4:	89 e5                	mov    %esp,%ebp
+  8010e6:	56                   	push   %esi
+  8010e7:	53                   	push   %ebx
+  8010e8:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  8010eb:	8b 1e                	mov    (%esi),%ebx
+  8010ed:	85 db                	test   %ebx,%ebx
+  8010ef:	75 09                	jne    8010fa <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  8010f1:	89 d8                	mov    %ebx,%eax
+  8010f3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8010f6:	5b                   	pop    %ebx
+  8010f7:	5e                   	pop    %esi
+  8010f8:	5d                   	pop    %ebp
+  8010f9:	c3                   	ret
+  b->sb_n = 0;
+  8010fa:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  801100:	53                   	push   %ebx
+  801101:	8d 46 04             	lea    0x4(%esi),%eax
+  801104:	50                   	push   %eax
+  801105:	e8 54 ff ff ff       	call   80105e <sys_batch>
+  80110a:	83 c4 08             	add    $0x8,%esp
+  80110d:	85 c0                	test   %eax,%eax
+  80110f:	78 1e                	js     80112f <sysbatch_flush+0x4c>
+  if (r < n)
+  801111:	39 c3                	cmp    %eax,%ebx
+  801113:	7f 07                	jg     80111c <sysbatch_flush+0x39>
+  return 0;
+  801115:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80111a:	eb d5                	jmp    8010f1 <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  80111c:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80111f:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  801123:	85 db                	test   %ebx,%ebx
+  801125:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80112a:	0f 49 d8             	cmovns %eax,%ebx
+  80112d:	eb c2                	jmp    8010f1 <sysbatch_flush+0xe>
+    return r;
+  80112f:	89 c3                	mov    %eax,%ebx
+  801131:	eb be                	jmp    8010f1 <sysbatch_flush+0xe>
+
+00801133 <sysbatch_add>:
+{
+  801133:	55                   	push   %ebp
+  801134:	89 e5                	mov    %esp,%ebp
+  801136:	53                   	push   %ebx
+  801137:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  80113a:	83 3b 40             	cmpl   $0x40,(%ebx)
+  80113d:	74 41                	je     801180 <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  80113f:	8b 03                	mov    (%ebx),%eax
+  801141:	8d 50 01             	lea    0x1(%eax),%edx
+  801144:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  801146:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801149:	01 d8                	add    %ebx,%eax
+  80114b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80114e:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  801151:	8b 55 10             	mov    0x10(%ebp),%edx
+  801154:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  801157:	8b 55 14             	mov    0x14(%ebp),%edx
+  80115a:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  80115d:	8b 55 18             	mov    0x18(%ebp),%edx
+  801160:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  801163:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  801166:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  801169:	8b 55 20             	mov    0x20(%ebp),%edx
+  80116c:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  80116f:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  801176:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80117b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80117e:	c9                   	leave
+  80117f:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  801180:	53                   	push   %ebx
+  801181:	e8 5d ff ff ff       	call   8010e3 <sysbatch_flush>
+  801186:	83 c4 04             	add    $0x4,%esp
+  801189:	85 c0                	test   %eax,%eax
+  80118b:	79 b2                	jns    80113f <sysbatch_add+0xc>
+  80118d:	eb ec                	jmp    80117b <sysbatch_add+0x48>
+
+0080118f <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80118f:	55                   	push   %ebp
+  801190:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801192:	8b 45 08             	mov    0x8(%ebp),%eax
+  801195:	05 00 00 00 30       	add    $0x30000000,%eax
+  80119a:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80119d:	5d                   	pop    %ebp
+  80119e:	c3                   	ret
+
+0080119f <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80119f:	55                   	push   %ebp
+  8011a0:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8011a2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011a5:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  8011a8:	66 b8 00 00          	mov    $0x0,%ax
+  8011ac:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8011b1:	5d                   	pop    %ebp
+  8011b2:	c3                   	ret
+
+008011b3 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8011b3:	55                   	push   %ebp
+  8011b4:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  8011b6:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8011bb:	eb 02                	jmp    8011bf <fd_alloc+0xc>
+  8011bd:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8011bf:	89 c2                	mov    %eax,%edx
+  8011c1:	c1 ea 16             	shr    $0x16,%edx
+  8011c4:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8011cb:	f6 c2 01             	test   $0x1,%dl
+  8011ce:	74 2b                	je     8011fb <fd_alloc+0x48>
+  8011d0:	89 c2                	mov    %eax,%edx
+  8011d2:	c1 ea 0c             	shr    $0xc,%edx
+  8011d5:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8011dc:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8011e2:	f6 c1 01             	test   $0x1,%cl
+  8011e5:	74 14                	je     8011fb <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  8011e7:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8011ed:	75 ce                	jne    8011bd <fd_alloc+0xa>
+  8011ef:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  8011f4:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8011f9:	eb 05                	jmp    801200 <fd_alloc+0x4d>
+      return 0;
+  8011fb:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  801200:	8b 55 08             	mov    0x8(%ebp),%edx
+  801203:	89 02                	mov    %eax,(%edx)
+}
+  801205:	89 c8                	mov    %ecx,%eax
+  801207:	5d                   	pop    %ebp
+  801208:	c3                   	ret
+
+00801209 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801209:	55                   	push   %ebp
+  80120a:	89 e5                	mov    %esp,%ebp
+  80120c:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  80120f:	83 f8 1f             	cmp    $0x1f,%eax
+  801212:	77 30                	ja     801244 <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  801214:	c1 e0 0c             	shl    $0xc,%eax
+  801217:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80121c:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801222:	f6 c2 01             	test   $0x1,%dl
+  801225:	74 24                	je     80124b <fd_lookup+0x42>
+  801227:	89 c2                	mov    %eax,%edx
+  801229:	c1 ea 0c             	shr    $0xc,%edx
+  80122c:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801233:	f6 c2 01             	test   $0x1,%dl
+  801236:	74 1a                	je     801252 <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  801238:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80123b:	89 02                	mov    %eax,(%edx)
+  return 0;
+  80123d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801242:	5d                   	pop    %ebp
+  801243:	c3                   	ret
+    return -E_INVAL;
+  801244:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801249:	eb f7                	jmp    801242 <fd_lookup+0x39>
+    return -E_INVAL;
+  80124b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801250:	eb f0                	jmp    801242 <fd_lookup+0x39>
+  801252:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801257:	eb e9                	jmp    801242 <fd_lookup+0x39>
+
+00801259 <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801259:	55                   	push   %ebp
+  80125a:	89 e5                	mov    %esp,%ebp
+  80125c:	53                   	push   %ebx
+  80125d:	83 ec 04             	sub    $0x4,%esp
+  801260:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  801263:	b8 ec 34 80 00       	mov    $0x8034ec,%eax
+  801268:	8b 18                	mov    (%eax),%ebx
+  80126a:	85 db                	test   %ebx,%ebx
+  80126c:	74 0e                	je     80127c <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  80126e:	83 c0 04             	add    $0x4,%eax
+  801271:	39 13                	cmp    %edx,(%ebx)
+  801273:	75 f3                	jne    801268 <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  801275:	b8 00 00 00 00       	mov    $0x0,%eax
+  80127a:	eb 1f                	jmp    80129b <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80127c:	a1 64 57 80 00       	mov    0x805764,%eax
+  801281:	8b 40 48             	mov    0x48(%eax),%eax
+  801284:	83 ec 04             	sub    $0x4,%esp
+  801287:	52                   	push   %edx
+  801288:	50                   	push   %eax
+  801289:	68 70 34 80 00       	push   $0x803470
+  80128e:	e8 30 f0 ff ff       	call   8002c3 <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  801293:	83 c4 10             	add    $0x10,%esp
+  801296:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  80129b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80129e:	89 1a                	mov    %ebx,(%edx)
+}
+  8012a0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012a3:	c9                   	leave
+  8012a4:	c3                   	ret
+
+008012a5 <fd_close>:
+{
+  8012a5:	55                   	push   %ebp
+  8012a6:	89 e5                	mov    %esp,%ebp
+  8012a8:	57                   	push   %edi
+  8012a9:	56                   	push   %esi
+  8012aa:	53                   	push   %ebx
+  8012ab:	83 ec 24             	sub    $0x24,%esp
+  8012ae:	8b 75 08             	mov    0x8(%ebp),%esi
+  8012b1:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8012b4:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8012b7:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8012b8:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8012be:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8012c1:	50                   	push   %eax
+  8012c2:	e8 42 ff ff ff       	call   801209 <fd_lookup>
+  8012c7:	89 c3                	mov    %eax,%ebx
+  8012c9:	83 c4 10             	add    $0x10,%esp
+  8012cc:	85 c0                	test   %eax,%eax
+  8012ce:	78 05                	js     8012d5 <fd_close+0x30>
+      || fd != fd2)
+  8012d0:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8012d3:	74 16                	je     8012eb <fd_close+0x46>
+    return must_exist ? r : 0;
+  8012d5:	89 f8                	mov    %edi,%eax
+  8012d7:	84 c0                	test   %al,%al
+  8012d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012de:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8012e1:	89 d8                	mov    %ebx,%eax
+  8012e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012e6:	5b                   	pop    %ebx
+  8012e7:	5e                   	pop    %esi
+  8012e8:	5f                   	pop    %edi
+  8012e9:	5d                   	pop    %ebp
+  8012ea:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8012eb:	83 ec 08             	sub    $0x8,%esp
+  8012ee:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8012f1:	50                   	push   %eax
+  8012f2:	ff 36                	push   (%esi)
+  8012f4:	e8 60 ff ff ff       	call   801259 <dev_lookup>
+  8012f9:	89 c3                	mov    %eax,%ebx
+  8012fb:	83 c4 10             	add    $0x10,%esp
+  8012fe:	85 c0                	test   %eax,%eax
+  801300:	78 1a                	js     80131c <fd_close+0x77>
+    if (dev->dev_close)
+  801302:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801305:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  801308:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  80130d:	85 c0                	test   %eax,%eax
+  80130f:	74 0b                	je     80131c <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  801311:	83 ec 0c             	sub    $0xc,%esp
+  801314:	56                   	push   %esi
+  801315:	ff d0                	call   *%eax
+  801317:	89 c3                	mov    %eax,%ebx
+  801319:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  80131c:	83 ec 08             	sub    $0x8,%esp
+  80131f:	56                   	push   %esi
+  801320:	6a 00                	push   $0x0
+  801322:	e8 3e fa ff ff       	call   800d65 <sys_page_unmap>
+  return r;
+  801327:	83 c4 10             	add    $0x10,%esp
+  80132a:	eb b5                	jmp    8012e1 <fd_close+0x3c>
+
+0080132c <close>:
+
+int
+close(int fdnum)
+{
+  80132c:	55                   	push   %ebp
+  80132d:	89 e5                	mov    %esp,%ebp
+  80132f:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801332:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801335:	50                   	push   %eax
+  801336:	ff 75 08             	push   0x8(%ebp)
+  801339:	e8 cb fe ff ff       	call   801209 <fd_lookup>
+  80133e:	83 c4 10             	add    $0x10,%esp
+  801341:	85 c0                	test   %eax,%eax
+  801343:	79 02                	jns    801347 <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  801345:	c9                   	leave
+  801346:	c3                   	ret
+    return fd_close(fd, 1);
+  801347:	83 ec 08             	sub    $0x8,%esp
+  80134a:	6a 01                	push   $0x1
+  80134c:	ff 75 f4             	push   -0xc(%ebp)
+  80134f:	e8 51 ff ff ff       	call   8012a5 <fd_close>
+  801354:	83 c4 10             	add    $0x10,%esp
+  801357:	eb ec                	jmp    801345 <close+0x19>
+
+00801359 <close_all>:
+
+void
+close_all(void)
+{
+  801359:	55                   	push   %ebp
+  80135a:	89 e5                	mov    %esp,%ebp
+  80135c:	53                   	push   %ebx
+  80135d:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  801360:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  801365:	83 ec 0c             	sub    $0xc,%esp
+  801368:	53                   	push   %ebx
+  801369:	e8 be ff ff ff       	call   80132c <close>
+  for (i = 0; i < MAXFD; i++)
+  80136e:	83 c3 01             	add    $0x1,%ebx
+  801371:	83 c4 10             	add    $0x10,%esp
+  801374:	83 fb 20             	cmp    $0x20,%ebx
+  801377:	75 ec                	jne    801365 <close_all+0xc>
+}
+  801379:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80137c:	c9                   	leave
+  80137d:	c3                   	ret
+
+0080137e <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80137e:	55                   	push   %ebp
+  80137f:	89 e5                	mov    %esp,%ebp
+  801381:	57                   	push   %edi
+  801382:	56                   	push   %esi
+  801383:	53                   	push   %ebx
+  801384:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801387:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80138a:	50                   	push   %eax
+  80138b:	ff 75 08             	push   0x8(%ebp)
+  80138e:	e8 76 fe ff ff       	call   801209 <fd_lookup>
+  801393:	89 c6                	mov    %eax,%esi
+  801395:	83 c4 10             	add    $0x10,%esp
+  801398:	85 c0                	test   %eax,%eax
+  80139a:	0f 88 0a 01 00 00    	js     8014aa <dup+0x12c>
+    return r;
+  close(newfdnum);
+  8013a0:	83 ec 0c             	sub    $0xc,%esp
+  8013a3:	ff 75 0c             	push   0xc(%ebp)
+  8013a6:	e8 81 ff ff ff       	call   80132c <close>
+
+  newfd = INDEX2FD(newfdnum);
+  8013ab:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8013ae:	c1 e0 0c             	shl    $0xc,%eax
+  8013b1:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  8013b7:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  8013ba:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8013bd:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8013c0:	89 04 24             	mov    %eax,(%esp)
+  8013c3:	e8 d7 fd ff ff       	call   80119f <fd2data>
+  8013c8:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  8013ca:	89 3c 24             	mov    %edi,(%esp)
+  8013cd:	e8 cd fd ff ff       	call   80119f <fd2data>
+  8013d2:	83 c4 10             	add    $0x10,%esp
+  8013d5:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8013d8:	89 f3                	mov    %esi,%ebx
+  8013da:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  8013e0:	89 c6                	mov    %eax,%esi
+  8013e2:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8013e5:	89 cf                	mov    %ecx,%edi
+  8013e7:	eb 0c                	jmp    8013f5 <dup+0x77>
+  8013e9:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8013ef:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8013f5:	39 fb                	cmp    %edi,%ebx
+  8013f7:	74 7b                	je     801474 <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  8013f9:	89 d8                	mov    %ebx,%eax
+  8013fb:	c1 e8 16             	shr    $0x16,%eax
+  8013fe:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801405:	a8 01                	test   $0x1,%al
+  801407:	74 e0                	je     8013e9 <dup+0x6b>
+  801409:	89 d8                	mov    %ebx,%eax
+  80140b:	c1 e8 0c             	shr    $0xc,%eax
+  80140e:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801415:	f6 c2 01             	test   $0x1,%dl
+  801418:	74 cf                	je     8013e9 <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  80141a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  801421:	83 ec 0c             	sub    $0xc,%esp
+  801424:	25 07 0e 00 00       	and    $0xe07,%eax
+  801429:	50                   	push   %eax
+  80142a:	56                   	push   %esi
+  80142b:	6a 00                	push   $0x0
+  80142d:	53                   	push   %ebx
+  80142e:	6a 00                	push   $0x0
+  801430:	e8 ee f8 ff ff       	call   800d23 <sys_page_map>
+  801435:	83 c4 20             	add    $0x20,%esp
+  801438:	85 c0                	test   %eax,%eax
+  80143a:	79 ad                	jns    8013e9 <dup+0x6b>
+  80143c:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80143f:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  801441:	83 ec 08             	sub    $0x8,%esp
+  801444:	ff 75 d4             	push   -0x2c(%ebp)
+  801447:	6a 00                	push   $0x0
+  801449:	e8 17 f9 ff ff       	call   800d65 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80144e:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  801451:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  801457:	83 c4 10             	add    $0x10,%esp
+  80145a:	39 df                	cmp    %ebx,%edi
+  80145c:	74 4c                	je     8014aa <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  80145e:	83 ec 08             	sub    $0x8,%esp
+  801461:	57                   	push   %edi
+  801462:	6a 00                	push   $0x0
+  801464:	e8 fc f8 ff ff       	call   800d65 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801469:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  80146f:	83 c4 10             	add    $0x10,%esp
+  801472:	eb e6                	jmp    80145a <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801474:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801477:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80147a:	89 c8                	mov    %ecx,%eax
+  80147c:	c1 e8 0c             	shr    $0xc,%eax
+  80147f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801486:	83 ec 0c             	sub    $0xc,%esp
+  801489:	25 07 0e 00 00       	and    $0xe07,%eax
+  80148e:	50                   	push   %eax
+  80148f:	ff 75 d4             	push   -0x2c(%ebp)
+  801492:	6a 00                	push   $0x0
+  801494:	51                   	push   %ecx
+  801495:	6a 00                	push   $0x0
+  801497:	e8 87 f8 ff ff       	call   800d23 <sys_page_map>
+  80149c:	89 c6                	mov    %eax,%esi
+  80149e:	83 c4 20             	add    $0x20,%esp
+  8014a1:	85 c0                	test   %eax,%eax
+  8014a3:	78 9c                	js     801441 <dup+0xc3>
+  return newfdnum;
+  8014a5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8014a8:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  8014aa:	89 f0                	mov    %esi,%eax
+  8014ac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014af:	5b                   	pop    %ebx
+  8014b0:	5e                   	pop    %esi
+  8014b1:	5f                   	pop    %edi
+  8014b2:	5d                   	pop    %ebp
+  8014b3:	c3                   	ret
+
+008014b4 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8014b4:	55                   	push   %ebp
+  8014b5:	89 e5                	mov    %esp,%ebp
+  8014b7:	56                   	push   %esi
+  8014b8:	53                   	push   %ebx
+  8014b9:	83 ec 18             	sub    $0x18,%esp
+  8014bc:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  8014bf:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8014c2:	50                   	push   %eax
+  8014c3:	56                   	push   %esi
+  8014c4:	e8 40 fd ff ff       	call   801209 <fd_lookup>
+  8014c9:	83 c4 10             	add    $0x10,%esp
+  8014cc:	85 c0                	test   %eax,%eax
+  8014ce:	78 3c                	js     80150c <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8014d0:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8014d3:	83 ec 08             	sub    $0x8,%esp
+  8014d6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014d9:	50                   	push   %eax
+  8014da:	ff 33                	push   (%ebx)
+  8014dc:	e8 78 fd ff ff       	call   801259 <dev_lookup>
+  8014e1:	83 c4 10             	add    $0x10,%esp
+  8014e4:	85 c0                	test   %eax,%eax
+  8014e6:	78 24                	js     80150c <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8014e8:	8b 43 08             	mov    0x8(%ebx),%eax
+  8014eb:	83 e0 03             	and    $0x3,%eax
+  8014ee:	83 f8 01             	cmp    $0x1,%eax
+  8014f1:	74 20                	je     801513 <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  8014f3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014f6:	8b 40 08             	mov    0x8(%eax),%eax
+  8014f9:	85 c0                	test   %eax,%eax
+  8014fb:	74 37                	je     801534 <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  8014fd:	83 ec 04             	sub    $0x4,%esp
+  801500:	ff 75 10             	push   0x10(%ebp)
+  801503:	ff 75 0c             	push   0xc(%ebp)
+  801506:	53                   	push   %ebx
+  801507:	ff d0                	call   *%eax
+  801509:	83 c4 10             	add    $0x10,%esp
+}
+  80150c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80150f:	5b                   	pop    %ebx
+  801510:	5e                   	pop    %esi
+  801511:	5d                   	pop    %ebp
+  801512:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801513:	a1 64 57 80 00       	mov    0x805764,%eax
+  801518:	8b 40 48             	mov    0x48(%eax),%eax
+  80151b:	83 ec 04             	sub    $0x4,%esp
+  80151e:	56                   	push   %esi
+  80151f:	50                   	push   %eax
+  801520:	68 b1 34 80 00       	push   $0x8034b1
+  801525:	e8 99 ed ff ff       	call   8002c3 <cprintf>
+    return -E_INVAL;
+  80152a:	83 c4 10             	add    $0x10,%esp
+  80152d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801532:	eb d8                	jmp    80150c <read+0x58>
+    return -E_NOT_SUPP;
+  801534:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801539:	eb d1                	jmp    80150c <read+0x58>
+
+0080153b <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80153b:	55                   	push   %ebp
+  80153c:	89 e5                	mov    %esp,%ebp
+  80153e:	57                   	push   %edi
+  80153f:	56                   	push   %esi
+  801540:	53                   	push   %ebx
+  801541:	83 ec 0c             	sub    $0xc,%esp
+  801544:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801547:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  80154a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80154f:	eb 02                	jmp    801553 <readn+0x18>
+  801551:	01 c3                	add    %eax,%ebx
+  801553:	39 f3                	cmp    %esi,%ebx
+  801555:	73 21                	jae    801578 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  801557:	83 ec 04             	sub    $0x4,%esp
+  80155a:	89 f0                	mov    %esi,%eax
+  80155c:	29 d8                	sub    %ebx,%eax
+  80155e:	50                   	push   %eax
+  80155f:	89 d8                	mov    %ebx,%eax
+  801561:	03 45 0c             	add    0xc(%ebp),%eax
+  801564:	50                   	push   %eax
+  801565:	57                   	push   %edi
+  801566:	e8 49 ff ff ff       	call   8014b4 <read>
+    if (m < 0)
+  80156b:	83 c4 10             	add    $0x10,%esp
+  80156e:	85 c0                	test   %eax,%eax
+  801570:	78 04                	js     801576 <readn+0x3b>
+      return m;
+    if (m == 0)
+  801572:	75 dd                	jne    801551 <readn+0x16>
+  801574:	eb 02                	jmp    801578 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  801576:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  801578:	89 d8                	mov    %ebx,%eax
+  80157a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80157d:	5b                   	pop    %ebx
+  80157e:	5e                   	pop    %esi
+  80157f:	5f                   	pop    %edi
+  801580:	5d                   	pop    %ebp
+  801581:	c3                   	ret
+
+00801582 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801582:	55                   	push   %ebp
+  801583:	89 e5                	mov    %esp,%ebp
+  801585:	56                   	push   %esi
+  801586:	53                   	push   %ebx
+  801587:	83 ec 18             	sub    $0x18,%esp
+  80158a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  80158d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801590:	50                   	push   %eax
+  801591:	53                   	push   %ebx
+  801592:	e8 72 fc ff ff       	call   801209 <fd_lookup>
+  801597:	83 c4 10             	add    $0x10,%esp
+  80159a:	85 c0                	test   %eax,%eax
+  80159c:	78 37                	js     8015d5 <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80159e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8015a1:	83 ec 08             	sub    $0x8,%esp
+  8015a4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015a7:	50                   	push   %eax
+  8015a8:	ff 36                	push   (%esi)
+  8015aa:	e8 aa fc ff ff       	call   801259 <dev_lookup>
+  8015af:	83 c4 10             	add    $0x10,%esp
+  8015b2:	85 c0                	test   %eax,%eax
+  8015b4:	78 1f                	js     8015d5 <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8015b6:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8015ba:	74 20                	je     8015dc <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  8015bc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015bf:	8b 40 0c             	mov    0xc(%eax),%eax
+  8015c2:	85 c0                	test   %eax,%eax
+  8015c4:	74 37                	je     8015fd <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  8015c6:	83 ec 04             	sub    $0x4,%esp
+  8015c9:	ff 75 10             	push   0x10(%ebp)
+  8015cc:	ff 75 0c             	push   0xc(%ebp)
+  8015cf:	56                   	push   %esi
+  8015d0:	ff d0                	call   *%eax
+  8015d2:	83 c4 10             	add    $0x10,%esp
+}
+  8015d5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015d8:	5b                   	pop    %ebx
+  8015d9:	5e                   	pop    %esi
+  8015da:	5d                   	pop    %ebp
+  8015db:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8015dc:	a1 64 57 80 00       	mov    0x805764,%eax
+  8015e1:	8b 40 48             	mov    0x48(%eax),%eax
+  8015e4:	83 ec 04             	sub    $0x4,%esp
+  8015e7:	53                   	push   %ebx
+  8015e8:	50                   	push   %eax
+  8015e9:	68 cd 34 80 00       	push   $0x8034cd
+  8015ee:	e8 d0 ec ff ff       	call   8002c3 <cprintf>
+    return -E_INVAL;
+  8015f3:	83 c4 10             	add    $0x10,%esp
+  8015f6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015fb:	eb d8                	jmp    8015d5 <write+0x53>
+    return -E_NOT_SUPP;
+  8015fd:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801602:	eb d1                	jmp    8015d5 <write+0x53>
+
+00801604 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801604:	55                   	push   %ebp
+  801605:	89 e5                	mov    %esp,%ebp
+  801607:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80160a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80160d:	50                   	push   %eax
+  80160e:	ff 75 08             	push   0x8(%ebp)
+  801611:	e8 f3 fb ff ff       	call   801209 <fd_lookup>
+  801616:	83 c4 10             	add    $0x10,%esp
+  801619:	85 c0                	test   %eax,%eax
+  80161b:	78 0e                	js     80162b <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  80161d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801620:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801623:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  801626:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80162b:	c9                   	leave
+  80162c:	c3                   	ret
+
+0080162d <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80162d:	55                   	push   %ebp
+  80162e:	89 e5                	mov    %esp,%ebp
+  801630:	56                   	push   %esi
+  801631:	53                   	push   %ebx
+  801632:	83 ec 18             	sub    $0x18,%esp
+  801635:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801638:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80163b:	50                   	push   %eax
+  80163c:	53                   	push   %ebx
+  80163d:	e8 c7 fb ff ff       	call   801209 <fd_lookup>
+  801642:	83 c4 10             	add    $0x10,%esp
+  801645:	85 c0                	test   %eax,%eax
+  801647:	78 34                	js     80167d <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801649:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80164c:	83 ec 08             	sub    $0x8,%esp
+  80164f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801652:	50                   	push   %eax
+  801653:	ff 36                	push   (%esi)
+  801655:	e8 ff fb ff ff       	call   801259 <dev_lookup>
+  80165a:	83 c4 10             	add    $0x10,%esp
+  80165d:	85 c0                	test   %eax,%eax
+  80165f:	78 1c                	js     80167d <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801661:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801665:	74 1d                	je     801684 <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  801667:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80166a:	8b 40 18             	mov    0x18(%eax),%eax
+  80166d:	85 c0                	test   %eax,%eax
+  80166f:	74 34                	je     8016a5 <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  801671:	83 ec 08             	sub    $0x8,%esp
+  801674:	ff 75 0c             	push   0xc(%ebp)
+  801677:	56                   	push   %esi
+  801678:	ff d0                	call   *%eax
+  80167a:	83 c4 10             	add    $0x10,%esp
+}
+  80167d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801680:	5b                   	pop    %ebx
+  801681:	5e                   	pop    %esi
+  801682:	5d                   	pop    %ebp
+  801683:	c3                   	ret
+            thisenv->env_id, fdnum);
+  801684:	a1 64 57 80 00       	mov    0x805764,%eax
+  801689:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80168c:	83 ec 04             	sub    $0x4,%esp
+  80168f:	53                   	push   %ebx
+  801690:	50                   	push   %eax
+  801691:	68 90 34 80 00       	push   $0x803490
+  801696:	e8 28 ec ff ff       	call   8002c3 <cprintf>
+    return -E_INVAL;
+  80169b:	83 c4 10             	add    $0x10,%esp
+  80169e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016a3:	eb d8                	jmp    80167d <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  8016a5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016aa:	eb d1                	jmp    80167d <ftruncate+0x50>
+
+008016ac <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8016ac:	55                   	push   %ebp
+  8016ad:	89 e5                	mov    %esp,%ebp
+  8016af:	56                   	push   %esi
+  8016b0:	53                   	push   %ebx
+  8016b1:	83 ec 18             	sub    $0x18,%esp
+  8016b4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016b7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016ba:	50                   	push   %eax
+  8016bb:	ff 75 08             	push   0x8(%ebp)
+  8016be:	e8 46 fb ff ff       	call   801209 <fd_lookup>
+  8016c3:	83 c4 10             	add    $0x10,%esp
+  8016c6:	85 c0                	test   %eax,%eax
+  8016c8:	78 49                	js     801713 <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8016ca:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8016cd:	83 ec 08             	sub    $0x8,%esp
+  8016d0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016d3:	50                   	push   %eax
+  8016d4:	ff 36                	push   (%esi)
+  8016d6:	e8 7e fb ff ff       	call   801259 <dev_lookup>
+  8016db:	83 c4 10             	add    $0x10,%esp
+  8016de:	85 c0                	test   %eax,%eax
+  8016e0:	78 31                	js     801713 <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  8016e2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016e5:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8016e9:	74 2f                	je     80171a <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  8016eb:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  8016ee:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8016f5:	00 00 00 
+  stat->st_isdir = 0;
+  8016f8:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8016ff:	00 00 00 
+  stat->st_dev = dev;
+  801702:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  801708:	83 ec 08             	sub    $0x8,%esp
+  80170b:	53                   	push   %ebx
+  80170c:	56                   	push   %esi
+  80170d:	ff 50 14             	call   *0x14(%eax)
+  801710:	83 c4 10             	add    $0x10,%esp
+}
+  801713:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801716:	5b                   	pop    %ebx
+  801717:	5e                   	pop    %esi
+  801718:	5d                   	pop    %ebp
+  801719:	c3                   	ret
+    return -E_NOT_SUPP;
+  80171a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80171f:	eb f2                	jmp    801713 <fstat+0x67>
+
+00801721 <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  801721:	55                   	push   %ebp
+  801722:	89 e5                	mov    %esp,%ebp
+  801724:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  801727:	ff 75 0c             	push   0xc(%ebp)
+  80172a:	ff 75 08             	push   0x8(%ebp)
+  80172d:	e8 58 07 00 00       	call   801e8a <file_stat>
+}
+  801732:	c9                   	leave
+  801733:	c3                   	ret
+
+00801734 <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  801734:	55                   	push   %ebp
+  801735:	89 e5                	mov    %esp,%ebp
+  801737:	57                   	push   %edi
+  801738:	56                   	push   %esi
+  801739:	53                   	push   %ebx
+  80173a:	83 ec 1c             	sub    $0x1c,%esp
+  80173d:	89 c7                	mov    %eax,%edi
+  80173f:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801742:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801745:	e9 a2 00 00 00       	jmp    8017ec <fsipc_send+0xb8>
+  nfsenvs = 0;
+  80174a:	c7 05 20 50 80 00 00 	movl   $0x0,0x805020
+  801751:	00 00 00 
+  801754:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801759:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  80175e:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801763:	be 01 00 00 00       	mov    $0x1,%esi
+  801768:	eb 0f                	jmp    801779 <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  80176a:	83 c0 01             	add    $0x1,%eax
+  80176d:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801772:	74 49                	je     8017bd <fsipc_send+0x89>
+  801774:	83 f9 07             	cmp    $0x7,%ecx
+  801777:	7f 50                	jg     8017c9 <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  801779:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  80177c:	c1 e2 04             	shl    $0x4,%edx
+  80177f:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801785:	8b 52 50             	mov    0x50(%edx),%edx
+  801788:	83 fa 01             	cmp    $0x1,%edx
+  80178b:	75 dd                	jne    80176a <fsipc_send+0x36>
+  80178d:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801790:	c1 e2 04             	shl    $0x4,%edx
+  801793:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801799:	8b 52 54             	mov    0x54(%edx),%edx
+  80179c:	85 d2                	test   %edx,%edx
+  80179e:	74 ca                	je     80176a <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  8017a0:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  8017a3:	c1 e2 04             	shl    $0x4,%edx
+  8017a6:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8017ac:	8b 52 48             	mov    0x48(%edx),%edx
+  8017af:	89 14 8d 40 50 80 00 	mov    %edx,0x805040(,%ecx,4)
+  8017b6:	8d 49 01             	lea    0x1(%ecx),%ecx
+  8017b9:	89 f3                	mov    %esi,%ebx
+  8017bb:	eb ad                	jmp    80176a <fsipc_send+0x36>
+  8017bd:	84 db                	test   %bl,%bl
+  8017bf:	74 38                	je     8017f9 <fsipc_send+0xc5>
+  8017c1:	89 0d 20 50 80 00    	mov    %ecx,0x805020
+  8017c7:	eb 30                	jmp    8017f9 <fsipc_send+0xc5>
+  8017c9:	84 db                	test   %bl,%bl
+  8017cb:	74 2c                	je     8017f9 <fsipc_send+0xc5>
+  8017cd:	89 0d 20 50 80 00    	mov    %ecx,0x805020
+  8017d3:	eb 24                	jmp    8017f9 <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  8017d5:	50                   	push   %eax
+  8017d6:	68 fc 34 80 00       	push   $0x8034fc
+  8017db:	6a 34                	push   $0x34
+  8017dd:	68 06 35 80 00       	push   $0x803506
+  8017e2:	e8 01 ea ff ff       	call   8001e8 <_panic>
+    }
+    sys_yield();
+  8017e7:	e8 92 f4 ff ff       	call   800c7e <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  8017ec:	83 3d 20 50 80 00 03 	cmpl   $0x3,0x805020
+  8017f3:	0f 8e 51 ff ff ff    	jle    80174a <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  8017f9:	a1 64 57 80 00       	mov    0x805764,%eax
+  8017fe:	8b 70 48             	mov    0x48(%eax),%esi
+  801801:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  801807:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80180c:	8b 0d 20 50 80 00    	mov    0x805020,%ecx
+  801812:	39 d9                	cmp    %ebx,%ecx
+  801814:	7e d1                	jle    8017e7 <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  801816:	83 ec 0c             	sub    $0xc,%esp
+  801819:	ff 75 e0             	push   -0x20(%ebp)
+  80181c:	6a 07                	push   $0x7
+  80181e:	ff 75 e4             	push   -0x1c(%ebp)
+  801821:	57                   	push   %edi
+  801822:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  801825:	99                   	cltd
+  801826:	f7 f9                	idiv   %ecx
+  801828:	ff 34 95 40 50 80 00 	push   0x805040(,%edx,4)
+  80182f:	e8 63 f7 ff ff       	call   800f97 <sys_ipc_try_send>
+      if (r == 0)
+  801834:	83 c4 20             	add    $0x20,%esp
+  801837:	85 c0                	test   %eax,%eax
+  801839:	74 0a                	je     801845 <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  80183b:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80183e:	75 95                	jne    8017d5 <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  801840:	83 c3 01             	add    $0x1,%ebx
+  801843:	eb c7                	jmp    80180c <fsipc_send+0xd8>
+  }
+}
+  801845:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801848:	5b                   	pop    %ebx
+  801849:	5e                   	pop    %esi
+  80184a:	5f                   	pop    %edi
+  80184b:	5d                   	pop    %ebp
+  80184c:	c3                   	ret
+
+0080184d <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  80184d:	55                   	push   %ebp
+  80184e:	89 e5                	mov    %esp,%ebp
+  801850:	53                   	push   %ebx
+  801851:	83 ec 14             	sub    $0x14,%esp
+  801854:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  801856:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  80185d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801862:	ba 00 60 80 00       	mov    $0x806000,%edx
+  801867:	e8 c8 fe ff ff       	call   801734 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  80186c:	6a 00                	push   $0x0
+  80186e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801871:	50                   	push   %eax
+  801872:	53                   	push   %ebx
+  801873:	6a 00                	push   $0x0
+  801875:	e8 3a 14 00 00       	call   802cb4 <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  80187a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80187d:	c9                   	leave
+  80187e:	c3                   	ret
+
+0080187f <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  80187f:	55                   	push   %ebp
+  801880:	89 e5                	mov    %esp,%ebp
+  801882:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801885:	8b 45 08             	mov    0x8(%ebp),%eax
+  801888:	8b 40 0c             	mov    0xc(%eax),%eax
+  80188b:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.set_size.req_size = newsize;
+  801890:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801893:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801898:	ba 00 00 00 00       	mov    $0x0,%edx
+  80189d:	b8 02 00 00 00       	mov    $0x2,%eax
+  8018a2:	e8 a6 ff ff ff       	call   80184d <fsipc>
+}
+  8018a7:	c9                   	leave
+  8018a8:	c3                   	ret
+
+008018a9 <devfile_flush>:
+{
+  8018a9:	55                   	push   %ebp
+  8018aa:	89 e5                	mov    %esp,%ebp
+  8018ac:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8018af:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018b2:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018b5:	a3 00 60 80 00       	mov    %eax,0x806000
+  return fsipc(FSREQ_FLUSH, NULL);
+  8018ba:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018bf:	b8 06 00 00 00       	mov    $0x6,%eax
+  8018c4:	e8 84 ff ff ff       	call   80184d <fsipc>
+}
+  8018c9:	c9                   	leave
+  8018ca:	c3                   	ret
+
+008018cb <devfile_stat>:
+{
+  8018cb:	55                   	push   %ebp
+  8018cc:	89 e5                	mov    %esp,%ebp
+  8018ce:	53                   	push   %ebx
+  8018cf:	83 ec 04             	sub    $0x4,%esp
+  8018d2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8018d5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018d8:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018db:	a3 00 60 80 00       	mov    %eax,0x806000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8018e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018e5:	b8 05 00 00 00       	mov    $0x5,%eax
+  8018ea:	e8 5e ff ff ff       	call   80184d <fsipc>
+  8018ef:	85 c0                	test   %eax,%eax
+  8018f1:	78 2c                	js     80191f <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8018f3:	83 ec 08             	sub    $0x8,%esp
+  8018f6:	68 00 60 80 00       	push   $0x806000
+  8018fb:	53                   	push   %ebx
+  8018fc:	e8 b0 ef ff ff       	call   8008b1 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  801901:	a1 80 60 80 00       	mov    0x806080,%eax
+  801906:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80190c:	a1 84 60 80 00       	mov    0x806084,%eax
+  801911:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801917:	83 c4 10             	add    $0x10,%esp
+  80191a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80191f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801922:	c9                   	leave
+  801923:	c3                   	ret
+
+00801924 <fsv_alloc>:
+{
+  801924:	55                   	push   %ebp
+  801925:	89 e5                	mov    %esp,%ebp
+  801927:	56                   	push   %esi
+  801928:	53                   	push   %ebx
+  801929:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  80192b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801930:	eb 22                	jmp    801954 <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  801932:	83 ec 04             	sub    $0x4,%esp
+  801935:	6a 00                	push   $0x0
+  801937:	6a 00                	push   $0x0
+  801939:	6a 07                	push   $0x7
+  80193b:	50                   	push   %eax
+  80193c:	6a 00                	push   $0x0
+  80193e:	6a 04                	push   $0x4
+  801940:	68 60 50 80 00       	push   $0x805060
+  801945:	e8 e9 f7 ff ff       	call   801133 <sysbatch_add>
+  80194a:	83 c4 20             	add    $0x20,%esp
+  80194d:	85 c0                	test   %eax,%eax
+  80194f:	78 48                	js     801999 <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  801951:	83 c3 01             	add    $0x1,%ebx
+  801954:	39 f3                	cmp    %esi,%ebx
+  801956:	74 31                	je     801989 <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  801958:	89 d8                	mov    %ebx,%eax
+  80195a:	c1 e0 0c             	shl    $0xc,%eax
+  80195d:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801962:	89 c2                	mov    %eax,%edx
+  801964:	c1 ea 16             	shr    $0x16,%edx
+  801967:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80196e:	f6 c2 01             	test   $0x1,%dl
+  801971:	74 bf                	je     801932 <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  801973:	89 c2                	mov    %eax,%edx
+  801975:	c1 ea 0c             	shr    $0xc,%edx
+  801978:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80197f:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801982:	83 fa 03             	cmp    $0x3,%edx
+  801985:	75 ab                	jne    801932 <fsv_alloc+0xe>
+  801987:	eb c8                	jmp    801951 <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  801989:	83 ec 0c             	sub    $0xc,%esp
+  80198c:	68 60 50 80 00       	push   $0x805060
+  801991:	e8 4d f7 ff ff       	call   8010e3 <sysbatch_flush>
+  801996:	83 c4 10             	add    $0x10,%esp
+}
+  801999:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80199c:	5b                   	pop    %ebx
+  80199d:	5e                   	pop    %esi
+  80199e:	5d                   	pop    %ebp
+  80199f:	c3                   	ret
+
+008019a0 <devfile_read>:
+{
+  8019a0:	55                   	push   %ebp
+  8019a1:	89 e5                	mov    %esp,%ebp
+  8019a3:	57                   	push   %edi
+  8019a4:	56                   	push   %esi
+  8019a5:	53                   	push   %ebx
+  8019a6:	83 ec 3c             	sub    $0x3c,%esp
+  8019a9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  8019ac:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  8019b2:	77 57                	ja     801a0b <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8019b4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019b7:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019ba:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read.req_n = n;
+  8019bf:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8019c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019ca:	b8 03 00 00 00       	mov    $0x3,%eax
+  8019cf:	e8 79 fe ff ff       	call   80184d <fsipc>
+  8019d4:	89 c6                	mov    %eax,%esi
+  8019d6:	85 c0                	test   %eax,%eax
+  8019d8:	78 27                	js     801a01 <devfile_read+0x61>
+  assert(r <= n);
+  8019da:	39 c3                	cmp    %eax,%ebx
+  8019dc:	0f 82 0e 02 00 00    	jb     801bf0 <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  8019e2:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8019e7:	0f 8f 1c 02 00 00    	jg     801c09 <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8019ed:	83 ec 04             	sub    $0x4,%esp
+  8019f0:	50                   	push   %eax
+  8019f1:	68 00 60 80 00       	push   $0x806000
+  8019f6:	ff 75 0c             	push   0xc(%ebp)
+  8019f9:	e8 39 f0 ff ff       	call   800a37 <memmove>
+  return r;
+  8019fe:	83 c4 10             	add    $0x10,%esp
+}
+  801a01:	89 f0                	mov    %esi,%eax
+  801a03:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a06:	5b                   	pop    %ebx
+  801a07:	5e                   	pop    %esi
+  801a08:	5f                   	pop    %edi
+  801a09:	5d                   	pop    %ebp
+  801a0a:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  801a0b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a10:	e8 0f ff ff ff       	call   801924 <fsv_alloc>
+  801a15:	89 c6                	mov    %eax,%esi
+  801a17:	85 c0                	test   %eax,%eax
+  801a19:	78 e6                	js     801a01 <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  801a1b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a1e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a21:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  801a26:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a29:	8b 40 04             	mov    0x4(%eax),%eax
+  801a2c:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  801a31:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  801a37:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801a3e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801a43:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801a48:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801a4d:	e8 e2 fc ff ff       	call   801734 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801a52:	6a 00                	push   $0x0
+  801a54:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801a57:	50                   	push   %eax
+  801a58:	68 00 10 c0 9f       	push   $0x9fc01000
+  801a5d:	6a 00                	push   $0x0
+  801a5f:	e8 50 12 00 00       	call   802cb4 <ipc_recv_pages>
+  801a64:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  801a66:	83 c4 10             	add    $0x10,%esp
+  801a69:	85 c0                	test   %eax,%eax
+  801a6b:	7e 94                	jle    801a01 <devfile_read+0x61>
+  assert(r <= n);
+  801a6d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801a70:	39 c3                	cmp    %eax,%ebx
+  801a72:	72 2e                	jb     801aa2 <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801a74:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a77:	8b 40 04             	mov    0x4(%eax),%eax
+  801a7a:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801a7f:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  801a82:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801a85:	c1 e2 0c             	shl    $0xc,%edx
+  801a88:	39 ca                	cmp    %ecx,%edx
+  801a8a:	72 2f                	jb     801abb <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  801a8c:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  801a91:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  801a94:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  801a98:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801a9d:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  801aa0:	eb 52                	jmp    801af4 <devfile_read+0x154>
+  assert(r <= n);
+  801aa2:	68 11 35 80 00       	push   $0x803511
+  801aa7:	68 18 35 80 00       	push   $0x803518
+  801aac:	68 49 01 00 00       	push   $0x149
+  801ab1:	68 06 35 80 00       	push   $0x803506
+  801ab6:	e8 2d e7 ff ff       	call   8001e8 <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801abb:	68 3c 35 80 00       	push   $0x80353c
+  801ac0:	68 18 35 80 00       	push   $0x803518
+  801ac5:	68 4a 01 00 00       	push   $0x14a
+  801aca:	68 06 35 80 00       	push   $0x803506
+  801acf:	e8 14 e7 ff ff       	call   8001e8 <_panic>
+      memmove(dst + done, src + done, m);
+  801ad4:	83 ec 04             	sub    $0x4,%esp
+  801ad7:	53                   	push   %ebx
+  801ad8:	56                   	push   %esi
+  801ad9:	89 f8                	mov    %edi,%eax
+  801adb:	03 45 0c             	add    0xc(%ebp),%eax
+  801ade:	50                   	push   %eax
+  801adf:	e8 53 ef ff ff       	call   800a37 <memmove>
+  801ae4:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  801ae7:	01 df                	add    %ebx,%edi
+  801ae9:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801aec:	39 c7                	cmp    %eax,%edi
+  801aee:	0f 83 c0 00 00 00    	jae    801bb4 <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801af4:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801af7:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  801afa:	89 f0                	mov    %esi,%eax
+  801afc:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801b01:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  801b06:	29 c3                	sub    %eax,%ebx
+  801b08:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801b0b:	29 f8                	sub    %edi,%eax
+  801b0d:	39 c3                	cmp    %eax,%ebx
+  801b0f:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  801b12:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801b18:	75 ba                	jne    801ad4 <devfile_read+0x134>
+  801b1a:	89 f9                	mov    %edi,%ecx
+  801b1c:	03 4d 0c             	add    0xc(%ebp),%ecx
+  801b1f:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  801b22:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  801b28:	75 aa                	jne    801ad4 <devfile_read+0x134>
+  801b2a:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  801b30:	77 a2                	ja     801ad4 <devfile_read+0x134>
+  801b32:	89 c8                	mov    %ecx,%eax
+  801b34:	c1 e8 16             	shr    $0x16,%eax
+  801b37:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801b3e:	a8 01                	test   $0x1,%al
+  801b40:	74 92                	je     801ad4 <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  801b42:	89 c8                	mov    %ecx,%eax
+  801b44:	c1 e8 0c             	shr    $0xc,%eax
+  801b47:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  801b4e:	a8 01                	test   $0x1,%al
+  801b50:	74 82                	je     801ad4 <devfile_read+0x134>
+  801b52:	a9 02 08 00 00       	test   $0x802,%eax
+  801b57:	0f 84 77 ff ff ff    	je     801ad4 <devfile_read+0x134>
+  801b5d:	f6 c4 04             	test   $0x4,%ah
+  801b60:	0f 85 6e ff ff ff    	jne    801ad4 <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  801b66:	a1 64 57 80 00       	mov    0x805764,%eax
+  801b6b:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  801b6f:	84 c0                	test   %al,%al
+  801b71:	75 17                	jne    801b8a <devfile_read+0x1ea>
+  801b73:	83 ec 08             	sub    $0x8,%esp
+  801b76:	6a 01                	push   $0x1
+  801b78:	6a 00                	push   $0x0
+  801b7a:	e8 1e f1 ff ff       	call   800c9d <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  801b7f:	83 c4 10             	add    $0x10,%esp
+  801b82:	85 c0                	test   %eax,%eax
+  801b84:	0f 85 4a ff ff ff    	jne    801ad4 <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  801b8a:	83 ec 04             	sub    $0x4,%esp
+  801b8d:	68 05 08 00 00       	push   $0x805
+  801b92:	ff 75 cc             	push   -0x34(%ebp)
+  801b95:	6a 00                	push   $0x0
+  801b97:	56                   	push   %esi
+  801b98:	6a 00                	push   $0x0
+  801b9a:	6a 05                	push   $0x5
+  801b9c:	68 60 50 80 00       	push   $0x805060
+  801ba1:	e8 8d f5 ff ff       	call   801133 <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  801ba6:	c1 e8 1f             	shr    $0x1f,%eax
+  801ba9:	08 45 cb             	or     %al,-0x35(%ebp)
+  801bac:	83 c4 20             	add    $0x20,%esp
+  801baf:	e9 33 ff ff ff       	jmp    801ae7 <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  801bb4:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  801bb7:	83 ec 0c             	sub    $0xc,%esp
+  801bba:	68 60 50 80 00       	push   $0x805060
+  801bbf:	e8 1f f5 ff ff       	call   8010e3 <sysbatch_flush>
+  801bc4:	83 c4 10             	add    $0x10,%esp
+  801bc7:	85 c0                	test   %eax,%eax
+  801bc9:	78 06                	js     801bd1 <devfile_read+0x231>
+  801bcb:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  801bcf:	74 14                	je     801be5 <devfile_read+0x245>
+    memmove(dst, src, r);
+  801bd1:	83 ec 04             	sub    $0x4,%esp
+  801bd4:	ff 75 d4             	push   -0x2c(%ebp)
+  801bd7:	ff 75 d0             	push   -0x30(%ebp)
+  801bda:	ff 75 0c             	push   0xc(%ebp)
+  801bdd:	e8 55 ee ff ff       	call   800a37 <memmove>
+  801be2:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  801be5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801be8:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  801beb:	e9 11 fe ff ff       	jmp    801a01 <devfile_read+0x61>
+  assert(r <= n);
+  801bf0:	68 11 35 80 00       	push   $0x803511
+  801bf5:	68 18 35 80 00       	push   $0x803518
+  801bfa:	68 1c 01 00 00       	push   $0x11c
+  801bff:	68 06 35 80 00       	push   $0x803506
+  801c04:	e8 df e5 ff ff       	call   8001e8 <_panic>
+  assert(r <= PGSIZE);
+  801c09:	68 2d 35 80 00       	push   $0x80352d
+  801c0e:	68 18 35 80 00       	push   $0x803518
+  801c13:	68 1d 01 00 00       	push   $0x11d
+  801c18:	68 06 35 80 00       	push   $0x803506
+  801c1d:	e8 c6 e5 ff ff       	call   8001e8 <_panic>
+
+00801c22 <devfile_write>:
+{
+  801c22:	55                   	push   %ebp
+  801c23:	89 e5                	mov    %esp,%ebp
+  801c25:	57                   	push   %edi
+  801c26:	56                   	push   %esi
+  801c27:	53                   	push   %ebx
+  801c28:	83 ec 1c             	sub    $0x1c,%esp
+  801c2b:	8b 75 08             	mov    0x8(%ebp),%esi
+  801c2e:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  801c31:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  801c36:	77 39                	ja     801c71 <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801c38:	8b 56 0c             	mov    0xc(%esi),%edx
+  801c3b:	89 15 00 60 80 00    	mov    %edx,0x806000
+  fsipcbuf.write.req_n = n;
+  801c41:	a3 04 60 80 00       	mov    %eax,0x806004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  801c46:	83 ec 04             	sub    $0x4,%esp
+  801c49:	50                   	push   %eax
+  801c4a:	ff 75 0c             	push   0xc(%ebp)
+  801c4d:	68 08 60 80 00       	push   $0x806008
+  801c52:	e8 e0 ed ff ff       	call   800a37 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801c57:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c5c:	b8 04 00 00 00       	mov    $0x4,%eax
+  801c61:	e8 e7 fb ff ff       	call   80184d <fsipc>
+  801c66:	83 c4 10             	add    $0x10,%esp
+}
+  801c69:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c6c:	5b                   	pop    %ebx
+  801c6d:	5e                   	pop    %esi
+  801c6e:	5f                   	pop    %edi
+  801c6f:	5d                   	pop    %ebp
+  801c70:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  801c71:	ba 00 00 10 00       	mov    $0x100000,%edx
+  801c76:	39 d0                	cmp    %edx,%eax
+  801c78:	89 d3                	mov    %edx,%ebx
+  801c7a:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  801c7d:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  801c83:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  801c86:	83 c7 01             	add    $0x1,%edi
+  801c89:	89 f8                	mov    %edi,%eax
+  801c8b:	e8 94 fc ff ff       	call   801924 <fsv_alloc>
+  801c90:	85 c0                	test   %eax,%eax
+  801c92:	78 d5                	js     801c69 <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  801c94:	83 ec 04             	sub    $0x4,%esp
+  801c97:	53                   	push   %ebx
+  801c98:	ff 75 0c             	push   0xc(%ebp)
+  801c9b:	68 00 10 c0 9f       	push   $0x9fc01000
+  801ca0:	e8 92 ed ff ff       	call   800a37 <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  801ca5:	8b 46 0c             	mov    0xc(%esi),%eax
+  801ca8:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  801cad:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  801cb3:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801cba:	89 f9                	mov    %edi,%ecx
+  801cbc:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801cc1:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801cc6:	e8 69 fa ff ff       	call   801734 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801ccb:	6a 00                	push   $0x0
+  801ccd:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801cd0:	50                   	push   %eax
+  801cd1:	6a 00                	push   $0x0
+  801cd3:	6a 00                	push   $0x0
+  801cd5:	e8 da 0f 00 00       	call   802cb4 <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  801cda:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  801cdd:	eb 8a                	jmp    801c69 <devfile_write+0x47>
+
+00801cdf <open>:
+{
+  801cdf:	55                   	push   %ebp
+  801ce0:	89 e5                	mov    %esp,%ebp
+  801ce2:	56                   	push   %esi
+  801ce3:	53                   	push   %ebx
+  801ce4:	83 ec 1c             	sub    $0x1c,%esp
+  801ce7:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801cea:	56                   	push   %esi
+  801ceb:	e8 86 eb ff ff       	call   800876 <strlen>
+  801cf0:	83 c4 10             	add    $0x10,%esp
+  801cf3:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801cf8:	7f 6c                	jg     801d66 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  801cfa:	83 ec 0c             	sub    $0xc,%esp
+  801cfd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d00:	50                   	push   %eax
+  801d01:	e8 ad f4 ff ff       	call   8011b3 <fd_alloc>
+  801d06:	89 c3                	mov    %eax,%ebx
+  801d08:	83 c4 10             	add    $0x10,%esp
+  801d0b:	85 c0                	test   %eax,%eax
+  801d0d:	78 3c                	js     801d4b <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801d0f:	83 ec 08             	sub    $0x8,%esp
+  801d12:	56                   	push   %esi
+  801d13:	68 00 60 80 00       	push   $0x806000
+  801d18:	e8 94 eb ff ff       	call   8008b1 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801d1d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d20:	a3 00 64 80 00       	mov    %eax,0x806400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801d25:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801d28:	b8 01 00 00 00       	mov    $0x1,%eax
+  801d2d:	e8 1b fb ff ff       	call   80184d <fsipc>
+  801d32:	89 c3                	mov    %eax,%ebx
+  801d34:	83 c4 10             	add    $0x10,%esp
+  801d37:	85 c0                	test   %eax,%eax
+  801d39:	78 19                	js     801d54 <open+0x75>
+  return fd2num(fd);
+  801d3b:	83 ec 0c             	sub    $0xc,%esp
+  801d3e:	ff 75 f4             	push   -0xc(%ebp)
+  801d41:	e8 49 f4 ff ff       	call   80118f <fd2num>
+  801d46:	89 c3                	mov    %eax,%ebx
+  801d48:	83 c4 10             	add    $0x10,%esp
+}
+  801d4b:	89 d8                	mov    %ebx,%eax
+  801d4d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d50:	5b                   	pop    %ebx
+  801d51:	5e                   	pop    %esi
+  801d52:	5d                   	pop    %ebp
+  801d53:	c3                   	ret
+    fd_close(fd, 0);
+  801d54:	83 ec 08             	sub    $0x8,%esp
+  801d57:	6a 00                	push   $0x0
+  801d59:	ff 75 f4             	push   -0xc(%ebp)
+  801d5c:	e8 44 f5 ff ff       	call   8012a5 <fd_close>
+    return r;
+  801d61:	83 c4 10             	add    $0x10,%esp
+  801d64:	eb e5                	jmp    801d4b <open+0x6c>
+    return -E_BAD_PATH;
+  801d66:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801d6b:	eb de                	jmp    801d4b <open+0x6c>
+
+00801d6d <open_read>:
+{
+  801d6d:	55                   	push   %ebp
+  801d6e:	89 e5                	mov    %esp,%ebp
+  801d70:	57                   	push   %edi
+  801d71:	56                   	push   %esi
+  801d72:	53                   	push   %ebx
+  801d73:	83 ec 28             	sub    $0x28,%esp
+  801d76:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  801d79:	57                   	push   %edi
+  801d7a:	e8 f7 ea ff ff       	call   800876 <strlen>
+  801d7f:	83 c4 10             	add    $0x10,%esp
+  801d82:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801d87:	0f 87 f6 00 00 00    	ja     801e83 <open_read+0x116>
+  801d8d:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  801d8f:	83 ec 0c             	sub    $0xc,%esp
+  801d92:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801d95:	50                   	push   %eax
+  801d96:	e8 18 f4 ff ff       	call   8011b3 <fd_alloc>
+  801d9b:	89 c3                	mov    %eax,%ebx
+  801d9d:	83 c4 10             	add    $0x10,%esp
+  801da0:	85 c0                	test   %eax,%eax
+  801da2:	0f 88 b2 00 00 00    	js     801e5a <open_read+0xed>
+  strcpy(req->req_buf, path);
+  801da8:	83 ec 08             	sub    $0x8,%esp
+  801dab:	57                   	push   %edi
+  801dac:	68 e4 60 80 00       	push   $0x8060e4
+  801db1:	e8 fb ea ff ff       	call   8008b1 <strcpy>
+  req->req_nops = 2;
+  801db6:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  801dbd:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  801dc0:	c7 05 04 60 80 00 01 	movl   $0x1,0x806004
+  801dc7:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  801dca:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801dcd:	a3 10 60 80 00       	mov    %eax,0x806010
+  req->req_ops[0].op_buf = 0;
+  801dd2:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  801dd9:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  801ddc:	c7 05 20 60 80 00 04 	movl   $0x4,0x806020
+  801de3:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  801de6:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  801ded:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  801df0:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  801df5:	29 f0                	sub    %esi,%eax
+  801df7:	3b 45 14             	cmp    0x14(%ebp),%eax
+  801dfa:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  801dfe:	a3 2c 60 80 00       	mov    %eax,0x80602c
+  req->req_ops[1].op_offset = 0;
+  801e03:	c7 05 30 60 80 00 00 	movl   $0x0,0x806030
+  801e0a:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  801e0d:	83 c6 01             	add    $0x1,%esi
+  801e10:	89 35 34 60 80 00    	mov    %esi,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  801e16:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801e19:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801e1e:	e8 2a fa ff ff       	call   80184d <fsipc>
+  801e23:	89 c3                	mov    %eax,%ebx
+  801e25:	83 c4 10             	add    $0x10,%esp
+  801e28:	83 f8 01             	cmp    $0x1,%eax
+  801e2b:	7e 37                	jle    801e64 <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  801e2d:	a1 38 60 80 00       	mov    0x806038,%eax
+  801e32:	8b 55 18             	mov    0x18(%ebp),%edx
+  801e35:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  801e37:	83 ec 04             	sub    $0x4,%esp
+  801e3a:	50                   	push   %eax
+  801e3b:	81 c6 e4 60 80 00    	add    $0x8060e4,%esi
+  801e41:	56                   	push   %esi
+  801e42:	ff 75 10             	push   0x10(%ebp)
+  801e45:	e8 ed eb ff ff       	call   800a37 <memmove>
+  return fd2num(fd);
+  801e4a:	83 c4 04             	add    $0x4,%esp
+  801e4d:	ff 75 e4             	push   -0x1c(%ebp)
+  801e50:	e8 3a f3 ff ff       	call   80118f <fd2num>
+  801e55:	89 c3                	mov    %eax,%ebx
+  801e57:	83 c4 10             	add    $0x10,%esp
+}
+  801e5a:	89 d8                	mov    %ebx,%eax
+  801e5c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e5f:	5b                   	pop    %ebx
+  801e60:	5e                   	pop    %esi
+  801e61:	5f                   	pop    %edi
+  801e62:	5d                   	pop    %ebp
+  801e63:	c3                   	ret
+    fd_close(fd, 0);
+  801e64:	83 ec 08             	sub    $0x8,%esp
+  801e67:	6a 00                	push   $0x0
+  801e69:	ff 75 e4             	push   -0x1c(%ebp)
+  801e6c:	e8 34 f4 ff ff       	call   8012a5 <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  801e71:	83 c4 10             	add    $0x10,%esp
+  801e74:	85 db                	test   %ebx,%ebx
+  801e76:	78 e2                	js     801e5a <open_read+0xed>
+  801e78:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  801e7b:	8b 9b 1c 60 80 00    	mov    0x80601c(%ebx),%ebx
+  801e81:	eb d7                	jmp    801e5a <open_read+0xed>
+    return -E_BAD_PATH;
+  801e83:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801e88:	eb d0                	jmp    801e5a <open_read+0xed>
+
+00801e8a <file_stat>:
+{
+  801e8a:	55                   	push   %ebp
+  801e8b:	89 e5                	mov    %esp,%ebp
+  801e8d:	57                   	push   %edi
+  801e8e:	56                   	push   %esi
+  801e8f:	53                   	push   %ebx
+  801e90:	83 ec 18             	sub    $0x18,%esp
+  801e93:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801e96:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801e99:	57                   	push   %edi
+  801e9a:	e8 d7 e9 ff ff       	call   800876 <strlen>
+  801e9f:	83 c4 10             	add    $0x10,%esp
+  801ea2:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801ea7:	0f 8f c7 00 00 00    	jg     801f74 <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  801ead:	83 ec 0c             	sub    $0xc,%esp
+  801eb0:	57                   	push   %edi
+  801eb1:	e8 c0 e9 ff ff       	call   800876 <strlen>
+  801eb6:	8d 58 04             	lea    0x4(%eax),%ebx
+  801eb9:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  801ebc:	83 c4 08             	add    $0x8,%esp
+  801ebf:	57                   	push   %edi
+  801ec0:	68 e4 60 80 00       	push   $0x8060e4
+  801ec5:	e8 e7 e9 ff ff       	call   8008b1 <strcpy>
+  req->req_nops = 2;
+  801eca:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  801ed1:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  801ed4:	c7 05 04 60 80 00 02 	movl   $0x2,0x806004
+  801edb:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  801ede:	c7 05 10 60 80 00 00 	movl   $0x0,0x806010
+  801ee5:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  801ee8:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  801eef:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  801ef2:	c7 05 20 60 80 00 03 	movl   $0x3,0x806020
+  801ef9:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  801efc:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  801f03:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  801f06:	89 1d 34 60 80 00    	mov    %ebx,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  801f0c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f11:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801f16:	e8 32 f9 ff ff       	call   80184d <fsipc>
+  801f1b:	83 c4 10             	add    $0x10,%esp
+  801f1e:	83 f8 01             	cmp    $0x1,%eax
+  801f21:	7e 42                	jle    801f65 <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  801f23:	81 c3 e4 60 80 00    	add    $0x8060e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  801f29:	83 ec 08             	sub    $0x8,%esp
+  801f2c:	53                   	push   %ebx
+  801f2d:	56                   	push   %esi
+  801f2e:	e8 7e e9 ff ff       	call   8008b1 <strcpy>
+  st->st_size = ret->ret_size;
+  801f33:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  801f39:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  801f3f:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  801f45:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  801f4b:	c7 86 88 00 00 00 08 	movl   $0x804008,0x88(%esi)
+  801f52:	40 80 00 
+  return 0;
+  801f55:	83 c4 10             	add    $0x10,%esp
+  801f58:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f5d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f60:	5b                   	pop    %ebx
+  801f61:	5e                   	pop    %esi
+  801f62:	5f                   	pop    %edi
+  801f63:	5d                   	pop    %ebp
+  801f64:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  801f65:	85 c0                	test   %eax,%eax
+  801f67:	78 f4                	js     801f5d <file_stat+0xd3>
+  801f69:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801f6c:	8b 80 1c 60 80 00    	mov    0x80601c(%eax),%eax
+  801f72:	eb e9                	jmp    801f5d <file_stat+0xd3>
+    return -E_BAD_PATH;
+  801f74:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801f79:	eb e2                	jmp    801f5d <file_stat+0xd3>
+
+00801f7b <read_map>:
+{
+  801f7b:	55                   	push   %ebp
+  801f7c:	89 e5                	mov    %esp,%ebp
+  801f7e:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801f81:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f84:	50                   	push   %eax
+  801f85:	ff 75 08             	push   0x8(%ebp)
+  801f88:	e8 7c f2 ff ff       	call   801209 <fd_lookup>
+  801f8d:	83 c4 10             	add    $0x10,%esp
+  801f90:	85 c0                	test   %eax,%eax
+  801f92:	78 2a                	js     801fbe <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  801f94:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f97:	8b 0d 08 40 80 00    	mov    0x804008,%ecx
+  801f9d:	39 08                	cmp    %ecx,(%eax)
+  801f9f:	75 1f                	jne    801fc0 <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  801fa1:	8b 40 0c             	mov    0xc(%eax),%eax
+  801fa4:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read_map.req_offset = offset;
+  801fa9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801fac:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  801fb1:	8b 55 10             	mov    0x10(%ebp),%edx
+  801fb4:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801fb9:	e8 8f f8 ff ff       	call   80184d <fsipc>
+}
+  801fbe:	c9                   	leave
+  801fbf:	c3                   	ret
+    return -E_INVAL;
+  801fc0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801fc5:	eb f7                	jmp    801fbe <read_map+0x43>
+
+00801fc7 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801fc7:	55                   	push   %ebp
+  801fc8:	89 e5                	mov    %esp,%ebp
+  801fca:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  801fcd:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fd2:	b8 08 00 00 00       	mov    $0x8,%eax
+  801fd7:	e8 71 f8 ff ff       	call   80184d <fsipc>
+}
+  801fdc:	c9                   	leave
+  801fdd:	c3                   	ret
+
+00801fde <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  801fde:	55                   	push   %ebp
+  801fdf:	89 e5                	mov    %esp,%ebp
+  801fe1:	57                   	push   %edi
+  801fe2:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  801fe3:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fe6:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.stats.req_bio_sched = 0;
+  801feb:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  801ff2:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  801ff5:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  801ffc:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  801fff:	ba 00 00 00 00       	mov    $0x0,%edx
+  802004:	b8 09 00 00 00       	mov    $0x9,%eax
+  802009:	e8 3f f8 ff ff       	call   80184d <fsipc>
+  80200e:	85 c0                	test   %eax,%eax
+  802010:	78 14                	js     802026 <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  802012:	be 00 60 80 00       	mov    $0x806000,%esi
+  802017:	b9 16 00 00 00       	mov    $0x16,%ecx
+  80201c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80201f:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  802021:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802026:	5e                   	pop    %esi
+  802027:	5f                   	pop    %edi
+  802028:	5d                   	pop    %ebp
+  802029:	c3                   	ret
+
+0080202a <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  80202a:	55                   	push   %ebp
+  80202b:	89 e5                	mov    %esp,%ebp
+  80202d:	53                   	push   %ebx
+  80202e:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  802031:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802034:	50                   	push   %eax
+  802035:	6a 00                	push   $0x0
+  802037:	e8 a2 ff ff ff       	call   801fde <fs_stats>
+  80203c:	83 c4 10             	add    $0x10,%esp
+  80203f:	85 c0                	test   %eax,%eax
+  802041:	78 28                	js     80206b <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  802043:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  802046:	83 ec 08             	sub    $0x8,%esp
+  802049:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  80204c:	50                   	push   %eax
+  80204d:	6a 20                	push   $0x20
+  80204f:	e8 8a ff ff ff       	call   801fde <fs_stats>
+  802054:	83 c4 10             	add    $0x10,%esp
+  802057:	85 c0                	test   %eax,%eax
+  802059:	78 10                	js     80206b <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  80205b:	83 ec 08             	sub    $0x8,%esp
+  80205e:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802061:	50                   	push   %eax
+  802062:	53                   	push   %ebx
+  802063:	e8 76 ff ff ff       	call   801fde <fs_stats>
+  802068:	83 c4 10             	add    $0x10,%esp
+}
+  80206b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80206e:	c9                   	leave
+  80206f:	c3                   	ret
+
+00802070 <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  802070:	55                   	push   %ebp
+  802071:	89 e5                	mov    %esp,%ebp
+  802073:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  802076:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  80207d:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  802080:	8b 45 08             	mov    0x8(%ebp),%eax
+  802083:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.stats.req_dcache = 0;
+  802088:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  80208f:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  802092:	ba 00 00 00 00       	mov    $0x0,%edx
+  802097:	b8 09 00 00 00       	mov    $0x9,%eax
+  80209c:	e8 ac f7 ff ff       	call   80184d <fsipc>
+}
+  8020a1:	c9                   	leave
+  8020a2:	c3                   	ret
+
+008020a3 <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  8020a3:	55                   	push   %ebp
+  8020a4:	89 e5                	mov    %esp,%ebp
+  8020a6:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  8020a9:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  8020b0:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  8020b3:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  8020ba:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  8020bd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020c0:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_STATS, NULL);
+  8020c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020ca:	b8 09 00 00 00       	mov    $0x9,%eax
+  8020cf:	e8 79 f7 ff ff       	call   80184d <fsipc>
+}
+  8020d4:	c9                   	leave
+  8020d5:	c3                   	ret
+
+008020d6 <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  8020d6:	55                   	push   %ebp
+  8020d7:	89 e5                	mov    %esp,%ebp
+  8020d9:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8020dc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020df:	50                   	push   %eax
+  8020e0:	ff 75 08             	push   0x8(%ebp)
+  8020e3:	e8 21 f1 ff ff       	call   801209 <fd_lookup>
+  8020e8:	83 c4 10             	add    $0x10,%esp
+  8020eb:	85 c0                	test   %eax,%eax
+  8020ed:	78 34                	js     802123 <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  8020ef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020f2:	8b 0d 08 40 80 00    	mov    0x804008,%ecx
+  8020f8:	39 08                	cmp    %ecx,(%eax)
+  8020fa:	75 29                	jne    802125 <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  8020fc:	8b 40 0c             	mov    0xc(%eax),%eax
+  8020ff:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.fallocate.req_offset = offset;
+  802104:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802107:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.fallocate.req_len = len;
+  80210c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80210f:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  802114:	ba 00 00 00 00       	mov    $0x0,%edx
+  802119:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80211e:	e8 2a f7 ff ff       	call   80184d <fsipc>
+}
+  802123:	c9                   	leave
+  802124:	c3                   	ret
+    return -E_INVAL;
+  802125:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80212a:	eb f7                	jmp    802123 <fallocate+0x4d>
+
+0080212c <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  80212c:	55                   	push   %ebp
+  80212d:	89 e5                	mov    %esp,%ebp
+  80212f:	57                   	push   %edi
+  802130:	56                   	push   %esi
+  802131:	53                   	push   %ebx
+  802132:	83 ec 24             	sub    $0x24,%esp
+  802135:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802138:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80213b:	50                   	push   %eax
+  80213c:	ff 75 08             	push   0x8(%ebp)
+  80213f:	e8 c5 f0 ff ff       	call   801209 <fd_lookup>
+  802144:	83 c4 10             	add    $0x10,%esp
+  802147:	85 c0                	test   %eax,%eax
+  802149:	78 66                	js     8021b1 <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  80214b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80214e:	8b 0d 08 40 80 00    	mov    0x804008,%ecx
+  802154:	39 08                	cmp    %ecx,(%eax)
+  802156:	75 61                	jne    8021b9 <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  802158:	85 f6                	test   %esi,%esi
+  80215a:	7e 50                	jle    8021ac <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  80215c:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  802161:	39 de                	cmp    %ebx,%esi
+  802163:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  802166:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802169:	8b 40 0c             	mov    0xc(%eax),%eax
+  80216c:	a3 00 60 80 00       	mov    %eax,0x806000
+    fsipcbuf.prefetch.req_n = m;
+  802171:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  802177:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  80217e:	83 ec 04             	sub    $0x4,%esp
+  802181:	57                   	push   %edi
+  802182:	ff 75 0c             	push   0xc(%ebp)
+  802185:	68 08 60 80 00       	push   $0x806008
+  80218a:	e8 a8 e8 ff ff       	call   800a37 <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  80218f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802194:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802199:	e8 af f6 ff ff       	call   80184d <fsipc>
+  80219e:	83 c4 10             	add    $0x10,%esp
+  8021a1:	85 c0                	test   %eax,%eax
+  8021a3:	78 0c                	js     8021b1 <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  8021a5:	01 7d 0c             	add    %edi,0xc(%ebp)
+  8021a8:	29 de                	sub    %ebx,%esi
+  8021aa:	eb ac                	jmp    802158 <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  8021ac:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021b4:	5b                   	pop    %ebx
+  8021b5:	5e                   	pop    %esi
+  8021b6:	5f                   	pop    %edi
+  8021b7:	5d                   	pop    %ebp
+  8021b8:	c3                   	ret
+    return -E_INVAL;
+  8021b9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021be:	eb f1                	jmp    8021b1 <prefetch+0x85>
+
+008021c0 <writebuf>:
+
+
+static void
+writebuf(struct printbuf *b)
+{
+  if (b->error > 0) {
+  8021c0:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  8021c4:	7f 01                	jg     8021c7 <writebuf+0x7>
+  8021c6:	c3                   	ret
+{
+  8021c7:	55                   	push   %ebp
+  8021c8:	89 e5                	mov    %esp,%ebp
+  8021ca:	53                   	push   %ebx
+  8021cb:	83 ec 08             	sub    $0x8,%esp
+  8021ce:	89 c3                	mov    %eax,%ebx
+    ssize_t result = write(b->fd, b->buf, b->idx);
+  8021d0:	ff 70 04             	push   0x4(%eax)
+  8021d3:	8d 40 10             	lea    0x10(%eax),%eax
+  8021d6:	50                   	push   %eax
+  8021d7:	ff 33                	push   (%ebx)
+  8021d9:	e8 a4 f3 ff ff       	call   801582 <write>
+    if (result > 0)
+  8021de:	83 c4 10             	add    $0x10,%esp
+  8021e1:	85 c0                	test   %eax,%eax
+  8021e3:	7e 03                	jle    8021e8 <writebuf+0x28>
+      b->result += result;
+  8021e5:	01 43 08             	add    %eax,0x8(%ebx)
+    if (result != b->idx)             // error, or wrote less than supplied
+  8021e8:	39 43 04             	cmp    %eax,0x4(%ebx)
+  8021eb:	74 0d                	je     8021fa <writebuf+0x3a>
+      b->error = (result < 0 ? result : 0);
+  8021ed:	85 c0                	test   %eax,%eax
+  8021ef:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021f4:	0f 4f c2             	cmovg  %edx,%eax
+  8021f7:	89 43 0c             	mov    %eax,0xc(%ebx)
+  }
+}
+  8021fa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8021fd:	c9                   	leave
+  8021fe:	c3                   	ret
+
+008021ff <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  8021ff:	55                   	push   %ebp
+  802200:	89 e5                	mov    %esp,%ebp
+  802202:	53                   	push   %ebx
+  802203:	83 ec 04             	sub    $0x4,%esp
+  802206:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct printbuf *b = (struct printbuf *)thunk;
+
+  b->buf[b->idx++] = ch;
+  802209:	8b 53 04             	mov    0x4(%ebx),%edx
+  80220c:	8d 42 01             	lea    0x1(%edx),%eax
+  80220f:	89 43 04             	mov    %eax,0x4(%ebx)
+  802212:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802215:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+  if (b->idx == 256) {
+  802219:	3d 00 01 00 00       	cmp    $0x100,%eax
+  80221e:	74 05                	je     802225 <putch+0x26>
+    writebuf(b);
+    b->idx = 0;
+  }
+}
+  802220:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802223:	c9                   	leave
+  802224:	c3                   	ret
+    writebuf(b);
+  802225:	89 d8                	mov    %ebx,%eax
+  802227:	e8 94 ff ff ff       	call   8021c0 <writebuf>
+    b->idx = 0;
+  80222c:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+  802233:	eb eb                	jmp    802220 <putch+0x21>
+
+00802235 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap)
+{
+  802235:	55                   	push   %ebp
+  802236:	89 e5                	mov    %esp,%ebp
+  802238:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.fd = fd;
+  80223e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802241:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+  b.idx = 0;
+  802247:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  80224e:	00 00 00 
+  b.result = 0;
+  802251:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  802258:	00 00 00 
+  b.error = 1;
+  80225b:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  802262:	00 00 00 
+  vprintfmt(putch, &b, fmt, ap);
+  802265:	ff 75 10             	push   0x10(%ebp)
+  802268:	ff 75 0c             	push   0xc(%ebp)
+  80226b:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  802271:	50                   	push   %eax
+  802272:	68 ff 21 80 00       	push   $0x8021ff
+  802277:	e8 3e e1 ff ff       	call   8003ba <vprintfmt>
+  if (b.idx > 0)
+  80227c:	83 c4 10             	add    $0x10,%esp
+  80227f:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  802286:	7f 12                	jg     80229a <vfprintf+0x65>
+    writebuf(&b);
+
+  return b.result ? b.result : b.error;
+  802288:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  80228e:	85 c0                	test   %eax,%eax
+  802290:	75 06                	jne    802298 <vfprintf+0x63>
+  802292:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+}
+  802298:	c9                   	leave
+  802299:	c3                   	ret
+    writebuf(&b);
+  80229a:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  8022a0:	e8 1b ff ff ff       	call   8021c0 <writebuf>
+  8022a5:	eb e1                	jmp    802288 <vfprintf+0x53>
+
+008022a7 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...)
+{
+  8022a7:	55                   	push   %ebp
+  8022a8:	89 e5                	mov    %esp,%ebp
+  8022aa:	83 ec 0c             	sub    $0xc,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  8022ad:	8d 45 10             	lea    0x10(%ebp),%eax
+  cnt = vfprintf(fd, fmt, ap);
+  8022b0:	50                   	push   %eax
+  8022b1:	ff 75 0c             	push   0xc(%ebp)
+  8022b4:	ff 75 08             	push   0x8(%ebp)
+  8022b7:	e8 79 ff ff ff       	call   802235 <vfprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  8022bc:	c9                   	leave
+  8022bd:	c3                   	ret
+
+008022be <printf>:
+
+int
+printf(const char *fmt, ...)
+{
+  8022be:	55                   	push   %ebp
+  8022bf:	89 e5                	mov    %esp,%ebp
+  8022c1:	83 ec 0c             	sub    $0xc,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  8022c4:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vfprintf(1, fmt, ap);
+  8022c7:	50                   	push   %eax
+  8022c8:	ff 75 08             	push   0x8(%ebp)
+  8022cb:	6a 01                	push   $0x1
+  8022cd:	e8 63 ff ff ff       	call   802235 <vfprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  8022d2:	c9                   	leave
+  8022d3:	c3                   	ret
+
+008022d4 <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  8022d4:	55                   	push   %ebp
+  8022d5:	89 e5                	mov    %esp,%ebp
+  8022d7:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  8022da:	50                   	push   %eax
+  8022db:	e8 bf ee ff ff       	call   80119f <fd2data>
+  8022e0:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  8022e5:	c9                   	leave
+  8022e6:	c3                   	ret
+
+008022e7 <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8022e7:	55                   	push   %ebp
+  8022e8:	89 e5                	mov    %esp,%ebp
+  8022ea:	56                   	push   %esi
+  8022eb:	53                   	push   %ebx
+  8022ec:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  8022ef:	83 ec 0c             	sub    $0xc,%esp
+  8022f2:	ff 75 08             	push   0x8(%ebp)
+  8022f5:	e8 a5 ee ff ff       	call   80119f <fd2data>
+  8022fa:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  8022fc:	83 c4 08             	add    $0x8,%esp
+  8022ff:	68 68 35 80 00       	push   $0x803568
+  802304:	53                   	push   %ebx
+  802305:	e8 a7 e5 ff ff       	call   8008b1 <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  80230a:	8b 46 04             	mov    0x4(%esi),%eax
+  80230d:	2b 06                	sub    (%esi),%eax
+  80230f:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  802315:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80231c:	00 00 00 
+  stat->st_dev = &devpipe;
+  80231f:	c7 83 88 00 00 00 24 	movl   $0x804024,0x88(%ebx)
+  802326:	40 80 00 
+  return 0;
+}
+  802329:	b8 00 00 00 00       	mov    $0x0,%eax
+  80232e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802331:	5b                   	pop    %ebx
+  802332:	5e                   	pop    %esi
+  802333:	5d                   	pop    %ebp
+  802334:	c3                   	ret
+
+00802335 <pipe_wakeup>:
+{
+  802335:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  802337:	b8 00 00 00 00       	mov    $0x0,%eax
+  80233c:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  80233f:	85 c0                	test   %eax,%eax
+  802341:	75 01                	jne    802344 <pipe_wakeup+0xf>
+  802343:	c3                   	ret
+{
+  802344:	55                   	push   %ebp
+  802345:	89 e5                	mov    %esp,%ebp
+  802347:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  80234a:	6a 00                	push   $0x0
+  80234c:	68 00 00 c0 ee       	push   $0xeec00000
+  802351:	52                   	push   %edx
+  802352:	e8 e5 ec ff ff       	call   80103c <sys_chan_wakeup>
+  802357:	83 c4 10             	add    $0x10,%esp
+}
+  80235a:	c9                   	leave
+  80235b:	c3                   	ret
+
+0080235c <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80235c:	55                   	push   %ebp
+  80235d:	89 e5                	mov    %esp,%ebp
+  80235f:	57                   	push   %edi
+  802360:	56                   	push   %esi
+  802361:	53                   	push   %ebx
+  802362:	83 ec 18             	sub    $0x18,%esp
+  802365:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  802368:	57                   	push   %edi
+  802369:	e8 31 ee ff ff       	call   80119f <fd2data>
+  80236e:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  802370:	83 c4 10             	add    $0x10,%esp
+  802373:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  802377:	74 2a                	je     8023a3 <devpipe_close+0x47>
+  802379:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  80237e:	89 f8                	mov    %edi,%eax
+  802380:	e8 4f ff ff ff       	call   8022d4 <pipe_ring>
+  802385:	83 ec 08             	sub    $0x8,%esp
+  802388:	01 d8                	add    %ebx,%eax
+  80238a:	50                   	push   %eax
+  80238b:	6a 00                	push   $0x0
+  80238d:	e8 d3 e9 ff ff       	call   800d65 <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  802392:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802398:	83 c4 10             	add    $0x10,%esp
+  80239b:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  8023a1:	75 db                	jne    80237e <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  8023a3:	83 ec 08             	sub    $0x8,%esp
+  8023a6:	57                   	push   %edi
+  8023a7:	6a 00                	push   $0x0
+  8023a9:	e8 b7 e9 ff ff       	call   800d65 <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  8023ae:	83 c4 10             	add    $0x10,%esp
+  8023b1:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  8023b5:	75 13                	jne    8023ca <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  8023b7:	83 ec 08             	sub    $0x8,%esp
+  8023ba:	56                   	push   %esi
+  8023bb:	6a 00                	push   $0x0
+  8023bd:	e8 a3 e9 ff ff       	call   800d65 <sys_page_unmap>
+}
+  8023c2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023c5:	5b                   	pop    %ebx
+  8023c6:	5e                   	pop    %esi
+  8023c7:	5f                   	pop    %edi
+  8023c8:	5d                   	pop    %ebp
+  8023c9:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  8023ca:	8d 56 04             	lea    0x4(%esi),%edx
+  8023cd:	8d 46 2c             	lea    0x2c(%esi),%eax
+  8023d0:	e8 60 ff ff ff       	call   802335 <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8023d5:	8d 46 30             	lea    0x30(%esi),%eax
+  8023d8:	89 f2                	mov    %esi,%edx
+  8023da:	e8 56 ff ff ff       	call   802335 <pipe_wakeup>
+  8023df:	eb d6                	jmp    8023b7 <devpipe_close+0x5b>
+
+008023e1 <_pipeisclosed>:
+{
+  8023e1:	55                   	push   %ebp
+  8023e2:	89 e5                	mov    %esp,%ebp
+  8023e4:	57                   	push   %edi
+  8023e5:	56                   	push   %esi
+  8023e6:	53                   	push   %ebx
+  8023e7:	83 ec 1c             	sub    $0x1c,%esp
+  8023ea:	89 c7                	mov    %eax,%edi
+  8023ec:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  8023ee:	a1 64 57 80 00       	mov    0x805764,%eax
+  8023f3:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  8023f6:	83 ec 0c             	sub    $0xc,%esp
+  8023f9:	57                   	push   %edi
+  8023fa:	e8 18 0a 00 00       	call   802e17 <pageref>
+  8023ff:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802402:	89 34 24             	mov    %esi,(%esp)
+  802405:	e8 0d 0a 00 00       	call   802e17 <pageref>
+    nn = thisenv->env_runs;
+  80240a:	8b 15 64 57 80 00    	mov    0x805764,%edx
+  802410:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  802413:	83 c4 10             	add    $0x10,%esp
+  802416:	39 cb                	cmp    %ecx,%ebx
+  802418:	74 1b                	je     802435 <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  80241a:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80241d:	75 cf                	jne    8023ee <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80241f:	8b 42 58             	mov    0x58(%edx),%eax
+  802422:	6a 01                	push   $0x1
+  802424:	50                   	push   %eax
+  802425:	53                   	push   %ebx
+  802426:	68 6f 35 80 00       	push   $0x80356f
+  80242b:	e8 93 de ff ff       	call   8002c3 <cprintf>
+  802430:	83 c4 10             	add    $0x10,%esp
+  802433:	eb b9                	jmp    8023ee <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  802435:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802438:	0f 94 c0             	sete   %al
+  80243b:	0f b6 c0             	movzbl %al,%eax
+}
+  80243e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802441:	5b                   	pop    %ebx
+  802442:	5e                   	pop    %esi
+  802443:	5f                   	pop    %edi
+  802444:	5d                   	pop    %ebp
+  802445:	c3                   	ret
+
+00802446 <devpipe_write_bulk>:
+{
+  802446:	55                   	push   %ebp
+  802447:	89 e5                	mov    %esp,%ebp
+  802449:	57                   	push   %edi
+  80244a:	56                   	push   %esi
+  80244b:	53                   	push   %ebx
+  80244c:	83 ec 1c             	sub    $0x1c,%esp
+  80244f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802452:	89 d6                	mov    %edx,%esi
+  802454:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  802457:	e8 78 fe ff ff       	call   8022d4 <pipe_ring>
+  80245c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  80245f:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802464:	8d 46 04             	lea    0x4(%esi),%eax
+  802467:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  80246a:	eb 75                	jmp    8024e1 <devpipe_write_bulk+0x9b>
+  80246c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802471:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802475:	6a 64                	push   $0x64
+  802477:	68 00 00 c0 ee       	push   $0xeec00000
+  80247c:	53                   	push   %ebx
+  80247d:	56                   	push   %esi
+  80247e:	e8 96 eb ff ff       	call   801019 <sys_chan_sleep>
+      continue;
+  802483:	83 c4 10             	add    $0x10,%esp
+  802486:	eb 59                	jmp    8024e1 <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  802488:	89 d1                	mov    %edx,%ecx
+  80248a:	c1 f9 1f             	sar    $0x1f,%ecx
+  80248d:	c1 e9 11             	shr    $0x11,%ecx
+  802490:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802493:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802498:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  80249a:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  8024a0:	29 d3                	sub    %edx,%ebx
+  8024a2:	ba 00 80 00 00       	mov    $0x8000,%edx
+  8024a7:	29 c2                	sub    %eax,%edx
+  8024a9:	39 d3                	cmp    %edx,%ebx
+  8024ab:	0f 47 da             	cmova  %edx,%ebx
+  8024ae:	8b 55 08             	mov    0x8(%ebp),%edx
+  8024b1:	29 fa                	sub    %edi,%edx
+  8024b3:	39 d3                	cmp    %edx,%ebx
+  8024b5:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  8024b8:	83 ec 04             	sub    $0x4,%esp
+  8024bb:	53                   	push   %ebx
+  8024bc:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8024bf:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  8024c2:	52                   	push   %edx
+  8024c3:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8024c6:	01 c8                	add    %ecx,%eax
+  8024c8:	50                   	push   %eax
+  8024c9:	e8 cb e5 ff ff       	call   800a99 <memcpy>
+    i += m;
+  8024ce:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  8024d0:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  8024d3:	8d 46 2c             	lea    0x2c(%esi),%eax
+  8024d6:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8024d9:	e8 57 fe ff ff       	call   802335 <pipe_wakeup>
+  8024de:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  8024e1:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  8024e4:	73 2b                	jae    802511 <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  8024e6:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  8024e8:	8b 56 04             	mov    0x4(%esi),%edx
+  8024eb:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  8024f1:	39 d0                	cmp    %edx,%eax
+  8024f3:	7d 93                	jge    802488 <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  8024f5:	89 f2                	mov    %esi,%edx
+  8024f7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8024fa:	e8 e2 fe ff ff       	call   8023e1 <_pipeisclosed>
+  8024ff:	85 c0                	test   %eax,%eax
+  802501:	0f 84 65 ff ff ff    	je     80246c <devpipe_write_bulk+0x26>
+        return i;
+  802507:	89 f8                	mov    %edi,%eax
+}
+  802509:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80250c:	5b                   	pop    %ebx
+  80250d:	5e                   	pop    %esi
+  80250e:	5f                   	pop    %edi
+  80250f:	5d                   	pop    %ebp
+  802510:	c3                   	ret
+  return i;
+  802511:	89 f8                	mov    %edi,%eax
+  802513:	eb f4                	jmp    802509 <devpipe_write_bulk+0xc3>
+
+00802515 <devpipe_write>:
+{
+  802515:	55                   	push   %ebp
+  802516:	89 e5                	mov    %esp,%ebp
+  802518:	57                   	push   %edi
+  802519:	56                   	push   %esi
+  80251a:	53                   	push   %ebx
+  80251b:	83 ec 28             	sub    $0x28,%esp
+  80251e:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  802521:	56                   	push   %esi
+  802522:	e8 78 ec ff ff       	call   80119f <fd2data>
+  802527:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  802529:	8b 78 28             	mov    0x28(%eax),%edi
+  80252c:	83 c4 10             	add    $0x10,%esp
+  80252f:	85 ff                	test   %edi,%edi
+  802531:	75 25                	jne    802558 <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  802533:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802536:	74 66                	je     80259e <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802538:	8b 43 04             	mov    0x4(%ebx),%eax
+  80253b:	8b 0b                	mov    (%ebx),%ecx
+  80253d:	8d 51 20             	lea    0x20(%ecx),%edx
+  802540:	39 d0                	cmp    %edx,%eax
+  802542:	72 2b                	jb     80256f <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  802544:	89 da                	mov    %ebx,%edx
+  802546:	89 f0                	mov    %esi,%eax
+  802548:	e8 94 fe ff ff       	call   8023e1 <_pipeisclosed>
+  80254d:	85 c0                	test   %eax,%eax
+  80254f:	75 51                	jne    8025a2 <devpipe_write+0x8d>
+      sys_yield();
+  802551:	e8 28 e7 ff ff       	call   800c7e <sys_yield>
+  802556:	eb e0                	jmp    802538 <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  802558:	83 ec 0c             	sub    $0xc,%esp
+  80255b:	ff 75 10             	push   0x10(%ebp)
+  80255e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802561:	89 c2                	mov    %eax,%edx
+  802563:	89 f0                	mov    %esi,%eax
+  802565:	e8 dc fe ff ff       	call   802446 <devpipe_write_bulk>
+  80256a:	83 c4 10             	add    $0x10,%esp
+  80256d:	eb 38                	jmp    8025a7 <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80256f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802572:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802576:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802579:	89 c2                	mov    %eax,%edx
+  80257b:	c1 fa 1f             	sar    $0x1f,%edx
+  80257e:	89 d1                	mov    %edx,%ecx
+  802580:	c1 e9 1b             	shr    $0x1b,%ecx
+  802583:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802586:	83 e2 1f             	and    $0x1f,%edx
+  802589:	29 ca                	sub    %ecx,%edx
+  80258b:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  80258f:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  802593:	83 c0 01             	add    $0x1,%eax
+  802596:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  802599:	83 c7 01             	add    $0x1,%edi
+  80259c:	eb 95                	jmp    802533 <devpipe_write+0x1e>
+  return i;
+  80259e:	89 f8                	mov    %edi,%eax
+  8025a0:	eb 05                	jmp    8025a7 <devpipe_write+0x92>
+        return 0;
+  8025a2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025a7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025aa:	5b                   	pop    %ebx
+  8025ab:	5e                   	pop    %esi
+  8025ac:	5f                   	pop    %edi
+  8025ad:	5d                   	pop    %ebp
+  8025ae:	c3                   	ret
+
+008025af <devpipe_read_bulk>:
+{
+  8025af:	55                   	push   %ebp
+  8025b0:	89 e5                	mov    %esp,%ebp
+  8025b2:	57                   	push   %edi
+  8025b3:	56                   	push   %esi
+  8025b4:	53                   	push   %ebx
+  8025b5:	83 ec 2c             	sub    $0x2c,%esp
+  8025b8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8025bb:	89 d6                	mov    %edx,%esi
+  8025bd:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8025c0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  8025c3:	e8 0c fd ff ff       	call   8022d4 <pipe_ring>
+  8025c8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  8025cb:	85 db                	test   %ebx,%ebx
+  8025cd:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8025d2:	0f 45 c3             	cmovne %ebx,%eax
+  8025d5:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8025d8:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8025dd:	8d 46 30             	lea    0x30(%esi),%eax
+  8025e0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  8025e3:	eb 50                	jmp    802635 <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  8025e5:	89 d1                	mov    %edx,%ecx
+  8025e7:	c1 f9 1f             	sar    $0x1f,%ecx
+  8025ea:	c1 e9 11             	shr    $0x11,%ecx
+  8025ed:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  8025f0:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8025f5:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  8025f7:	29 d3                	sub    %edx,%ebx
+  8025f9:	ba 00 80 00 00       	mov    $0x8000,%edx
+  8025fe:	29 c2                	sub    %eax,%edx
+  802600:	39 d3                	cmp    %edx,%ebx
+  802602:	0f 47 da             	cmova  %edx,%ebx
+  802605:	8b 55 08             	mov    0x8(%ebp),%edx
+  802608:	29 fa                	sub    %edi,%edx
+  80260a:	39 d3                	cmp    %edx,%ebx
+  80260c:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  80260f:	83 ec 04             	sub    $0x4,%esp
+  802612:	53                   	push   %ebx
+  802613:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802616:	01 c8                	add    %ecx,%eax
+  802618:	50                   	push   %eax
+  802619:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80261c:	01 f8                	add    %edi,%eax
+  80261e:	50                   	push   %eax
+  80261f:	e8 75 e4 ff ff       	call   800a99 <memcpy>
+    i += m;
+  802624:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  802626:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802628:	89 f2                	mov    %esi,%edx
+  80262a:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80262d:	e8 03 fd ff ff       	call   802335 <pipe_wakeup>
+  802632:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802635:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802638:	73 51                	jae    80268b <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  80263a:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  80263d:	8b 16                	mov    (%esi),%edx
+  80263f:	39 da                	cmp    %ebx,%edx
+  802641:	75 a2                	jne    8025e5 <devpipe_read_bulk+0x36>
+      if (i > 0)
+  802643:	85 ff                	test   %edi,%edi
+  802645:	75 44                	jne    80268b <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  802647:	89 f2                	mov    %esi,%edx
+  802649:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80264c:	e8 90 fd ff ff       	call   8023e1 <_pipeisclosed>
+  802651:	85 c0                	test   %eax,%eax
+  802653:	75 3a                	jne    80268f <devpipe_read_bulk+0xe0>
+  802655:	b8 01 00 00 00       	mov    $0x1,%eax
+  80265a:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  80265e:	6a 64                	push   $0x64
+  802660:	ff 75 d4             	push   -0x2c(%ebp)
+  802663:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  802664:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802667:	50                   	push   %eax
+  802668:	e8 ac e9 ff ff       	call   801019 <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  80266d:	85 c0                	test   %eax,%eax
+  80266f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802674:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  802677:	83 c4 10             	add    $0x10,%esp
+  80267a:	a8 01                	test   $0x1,%al
+  80267c:	74 b7                	je     802635 <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  80267e:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  802683:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802686:	5b                   	pop    %ebx
+  802687:	5e                   	pop    %esi
+  802688:	5f                   	pop    %edi
+  802689:	5d                   	pop    %ebp
+  80268a:	c3                   	ret
+  return i;
+  80268b:	89 f8                	mov    %edi,%eax
+  80268d:	eb f4                	jmp    802683 <devpipe_read_bulk+0xd4>
+        return 0;
+  80268f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802694:	eb ed                	jmp    802683 <devpipe_read_bulk+0xd4>
+
+00802696 <devpipe_read>:
+{
+  802696:	55                   	push   %ebp
+  802697:	89 e5                	mov    %esp,%ebp
+  802699:	57                   	push   %edi
+  80269a:	56                   	push   %esi
+  80269b:	53                   	push   %ebx
+  80269c:	83 ec 18             	sub    $0x18,%esp
+  80269f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  8026a2:	57                   	push   %edi
+  8026a3:	e8 f7 ea ff ff       	call   80119f <fd2data>
+  8026a8:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  8026aa:	8b 70 28             	mov    0x28(%eax),%esi
+  8026ad:	83 c4 10             	add    $0x10,%esp
+  8026b0:	85 f6                	test   %esi,%esi
+  8026b2:	75 24                	jne    8026d8 <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  8026b4:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8026b7:	74 60                	je     802719 <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  8026b9:	8b 03                	mov    (%ebx),%eax
+  8026bb:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8026be:	75 3b                	jne    8026fb <devpipe_read+0x65>
+      if (i > 0)
+  8026c0:	85 f6                	test   %esi,%esi
+  8026c2:	75 2d                	jne    8026f1 <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  8026c4:	89 da                	mov    %ebx,%edx
+  8026c6:	89 f8                	mov    %edi,%eax
+  8026c8:	e8 14 fd ff ff       	call   8023e1 <_pipeisclosed>
+  8026cd:	85 c0                	test   %eax,%eax
+  8026cf:	75 4c                	jne    80271d <devpipe_read+0x87>
+      sys_yield();
+  8026d1:	e8 a8 e5 ff ff       	call   800c7e <sys_yield>
+  8026d6:	eb e1                	jmp    8026b9 <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  8026d8:	83 ec 08             	sub    $0x8,%esp
+  8026db:	6a 00                	push   $0x0
+  8026dd:	ff 75 10             	push   0x10(%ebp)
+  8026e0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8026e3:	89 c2                	mov    %eax,%edx
+  8026e5:	89 f8                	mov    %edi,%eax
+  8026e7:	e8 c3 fe ff ff       	call   8025af <devpipe_read_bulk>
+  8026ec:	83 c4 10             	add    $0x10,%esp
+  8026ef:	eb 02                	jmp    8026f3 <devpipe_read+0x5d>
+        return i;
+  8026f1:	89 f0                	mov    %esi,%eax
+}
+  8026f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026f6:	5b                   	pop    %ebx
+  8026f7:	5e                   	pop    %esi
+  8026f8:	5f                   	pop    %edi
+  8026f9:	5d                   	pop    %ebp
+  8026fa:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8026fb:	99                   	cltd
+  8026fc:	c1 ea 1b             	shr    $0x1b,%edx
+  8026ff:	01 d0                	add    %edx,%eax
+  802701:	83 e0 1f             	and    $0x1f,%eax
+  802704:	29 d0                	sub    %edx,%eax
+  802706:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  80270b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80270e:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  802711:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  802714:	83 c6 01             	add    $0x1,%esi
+  802717:	eb 9b                	jmp    8026b4 <devpipe_read+0x1e>
+  return i;
+  802719:	89 f0                	mov    %esi,%eax
+  80271b:	eb d6                	jmp    8026f3 <devpipe_read+0x5d>
+        return 0;
+  80271d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802722:	eb cf                	jmp    8026f3 <devpipe_read+0x5d>
+
+00802724 <pipe2>:
+{
+  802724:	55                   	push   %ebp
+  802725:	89 e5                	mov    %esp,%ebp
+  802727:	57                   	push   %edi
+  802728:	56                   	push   %esi
+  802729:	53                   	push   %ebx
+  80272a:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  80272d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802730:	50                   	push   %eax
+  802731:	e8 7d ea ff ff       	call   8011b3 <fd_alloc>
+  802736:	89 c3                	mov    %eax,%ebx
+  802738:	83 c4 10             	add    $0x10,%esp
+  80273b:	85 c0                	test   %eax,%eax
+  80273d:	0f 88 fb 01 00 00    	js     80293e <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802743:	83 ec 04             	sub    $0x4,%esp
+  802746:	68 07 04 00 00       	push   $0x407
+  80274b:	ff 75 e4             	push   -0x1c(%ebp)
+  80274e:	6a 00                	push   $0x0
+  802750:	e8 8b e5 ff ff       	call   800ce0 <sys_page_alloc>
+  802755:	89 c3                	mov    %eax,%ebx
+  802757:	83 c4 10             	add    $0x10,%esp
+  80275a:	85 c0                	test   %eax,%eax
+  80275c:	0f 88 dc 01 00 00    	js     80293e <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  802762:	83 ec 0c             	sub    $0xc,%esp
+  802765:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  802768:	50                   	push   %eax
+  802769:	e8 45 ea ff ff       	call   8011b3 <fd_alloc>
+  80276e:	89 c3                	mov    %eax,%ebx
+  802770:	83 c4 10             	add    $0x10,%esp
+  802773:	85 c0                	test   %eax,%eax
+  802775:	0f 88 b3 01 00 00    	js     80292e <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80277b:	83 ec 04             	sub    $0x4,%esp
+  80277e:	68 07 04 00 00       	push   $0x407
+  802783:	ff 75 e0             	push   -0x20(%ebp)
+  802786:	6a 00                	push   $0x0
+  802788:	e8 53 e5 ff ff       	call   800ce0 <sys_page_alloc>
+  80278d:	89 c3                	mov    %eax,%ebx
+  80278f:	83 c4 10             	add    $0x10,%esp
+  802792:	85 c0                	test   %eax,%eax
+  802794:	0f 88 94 01 00 00    	js     80292e <pipe2+0x20a>
+  va = fd2data(fd0);
+  80279a:	83 ec 0c             	sub    $0xc,%esp
+  80279d:	ff 75 e4             	push   -0x1c(%ebp)
+  8027a0:	e8 fa e9 ff ff       	call   80119f <fd2data>
+  8027a5:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8027a7:	83 c4 0c             	add    $0xc,%esp
+  8027aa:	68 07 04 00 00       	push   $0x407
+  8027af:	50                   	push   %eax
+  8027b0:	6a 00                	push   $0x0
+  8027b2:	e8 29 e5 ff ff       	call   800ce0 <sys_page_alloc>
+  8027b7:	89 c3                	mov    %eax,%ebx
+  8027b9:	83 c4 10             	add    $0x10,%esp
+  8027bc:	85 c0                	test   %eax,%eax
+  8027be:	0f 88 5a 01 00 00    	js     80291e <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8027c4:	83 ec 0c             	sub    $0xc,%esp
+  8027c7:	ff 75 e0             	push   -0x20(%ebp)
+  8027ca:	e8 d0 e9 ff ff       	call   80119f <fd2data>
+  8027cf:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8027d6:	50                   	push   %eax
+  8027d7:	6a 00                	push   $0x0
+  8027d9:	57                   	push   %edi
+  8027da:	6a 00                	push   $0x0
+  8027dc:	e8 42 e5 ff ff       	call   800d23 <sys_page_map>
+  8027e1:	89 c3                	mov    %eax,%ebx
+  8027e3:	83 c4 20             	add    $0x20,%esp
+  8027e6:	85 c0                	test   %eax,%eax
+  8027e8:	0f 88 22 01 00 00    	js     802910 <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  8027ee:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  8027f2:	74 72                	je     802866 <pipe2+0x142>
+  8027f4:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  8027f9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8027fc:	e8 d3 fa ff ff       	call   8022d4 <pipe_ring>
+  802801:	83 ec 04             	sub    $0x4,%esp
+  802804:	68 07 04 00 00       	push   $0x407
+  802809:	01 f0                	add    %esi,%eax
+  80280b:	50                   	push   %eax
+  80280c:	6a 00                	push   $0x0
+  80280e:	e8 cd e4 ff ff       	call   800ce0 <sys_page_alloc>
+  802813:	89 c3                	mov    %eax,%ebx
+  802815:	83 c4 10             	add    $0x10,%esp
+  802818:	85 c0                	test   %eax,%eax
+  80281a:	0f 88 97 00 00 00    	js     8028b7 <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  802820:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802823:	e8 ac fa ff ff       	call   8022d4 <pipe_ring>
+  802828:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  80282b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80282e:	e8 a1 fa ff ff       	call   8022d4 <pipe_ring>
+  802833:	83 ec 0c             	sub    $0xc,%esp
+  802836:	68 07 04 00 00       	push   $0x407
+  80283b:	53                   	push   %ebx
+  80283c:	6a 00                	push   $0x0
+  80283e:	01 f0                	add    %esi,%eax
+  802840:	50                   	push   %eax
+  802841:	6a 00                	push   $0x0
+  802843:	e8 db e4 ff ff       	call   800d23 <sys_page_map>
+  802848:	89 c3                	mov    %eax,%ebx
+  80284a:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802850:	83 c4 20             	add    $0x20,%esp
+  802853:	85 c0                	test   %eax,%eax
+  802855:	78 60                	js     8028b7 <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  802857:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  80285d:	75 9a                	jne    8027f9 <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  80285f:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  802866:	a1 24 40 80 00       	mov    0x804024,%eax
+  80286b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80286e:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  802870:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802873:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  80287a:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80287d:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  80287f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802882:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  802889:	83 ec 0c             	sub    $0xc,%esp
+  80288c:	ff 75 e4             	push   -0x1c(%ebp)
+  80288f:	e8 fb e8 ff ff       	call   80118f <fd2num>
+  802894:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802897:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  802899:	83 c4 04             	add    $0x4,%esp
+  80289c:	ff 75 e0             	push   -0x20(%ebp)
+  80289f:	e8 eb e8 ff ff       	call   80118f <fd2num>
+  8028a4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8028a7:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  8028aa:	83 c4 10             	add    $0x10,%esp
+  8028ad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028b2:	e9 87 00 00 00       	jmp    80293e <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  8028b7:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  8028bc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8028bf:	e8 10 fa ff ff       	call   8022d4 <pipe_ring>
+  8028c4:	83 ec 08             	sub    $0x8,%esp
+  8028c7:	01 f0                	add    %esi,%eax
+  8028c9:	50                   	push   %eax
+  8028ca:	6a 00                	push   $0x0
+  8028cc:	e8 94 e4 ff ff       	call   800d65 <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  8028d1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8028d4:	e8 fb f9 ff ff       	call   8022d4 <pipe_ring>
+  8028d9:	83 c4 08             	add    $0x8,%esp
+  8028dc:	01 f0                	add    %esi,%eax
+  8028de:	50                   	push   %eax
+  8028df:	6a 00                	push   $0x0
+  8028e1:	e8 7f e4 ff ff       	call   800d65 <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  8028e6:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8028ec:	83 c4 10             	add    $0x10,%esp
+  8028ef:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  8028f5:	75 c5                	jne    8028bc <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  8028f7:	83 ec 0c             	sub    $0xc,%esp
+  8028fa:	ff 75 e0             	push   -0x20(%ebp)
+  8028fd:	e8 9d e8 ff ff       	call   80119f <fd2data>
+  802902:	83 c4 08             	add    $0x8,%esp
+  802905:	50                   	push   %eax
+  802906:	6a 00                	push   $0x0
+  802908:	e8 58 e4 ff ff       	call   800d65 <sys_page_unmap>
+  80290d:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  802910:	83 ec 08             	sub    $0x8,%esp
+  802913:	57                   	push   %edi
+  802914:	6a 00                	push   $0x0
+  802916:	e8 4a e4 ff ff       	call   800d65 <sys_page_unmap>
+  80291b:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  80291e:	83 ec 08             	sub    $0x8,%esp
+  802921:	ff 75 e0             	push   -0x20(%ebp)
+  802924:	6a 00                	push   $0x0
+  802926:	e8 3a e4 ff ff       	call   800d65 <sys_page_unmap>
+  80292b:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  80292e:	83 ec 08             	sub    $0x8,%esp
+  802931:	ff 75 e4             	push   -0x1c(%ebp)
+  802934:	6a 00                	push   $0x0
+  802936:	e8 2a e4 ff ff       	call   800d65 <sys_page_unmap>
+  80293b:	83 c4 10             	add    $0x10,%esp
+}
+  80293e:	89 d8                	mov    %ebx,%eax
+  802940:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802943:	5b                   	pop    %ebx
+  802944:	5e                   	pop    %esi
+  802945:	5f                   	pop    %edi
+  802946:	5d                   	pop    %ebp
+  802947:	c3                   	ret
+
+00802948 <pipe>:
+{
+  802948:	55                   	push   %ebp
+  802949:	89 e5                	mov    %esp,%ebp
+  80294b:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  80294e:	6a 00                	push   $0x0
+  802950:	ff 75 08             	push   0x8(%ebp)
+  802953:	e8 cc fd ff ff       	call   802724 <pipe2>
+}
+  802958:	c9                   	leave
+  802959:	c3                   	ret
+
+0080295a <pipeisclosed>:
+{
+  80295a:	55                   	push   %ebp
+  80295b:	89 e5                	mov    %esp,%ebp
+  80295d:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802960:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802963:	50                   	push   %eax
+  802964:	ff 75 08             	push   0x8(%ebp)
+  802967:	e8 9d e8 ff ff       	call   801209 <fd_lookup>
+  80296c:	83 c4 10             	add    $0x10,%esp
+  80296f:	85 c0                	test   %eax,%eax
+  802971:	78 18                	js     80298b <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  802973:	83 ec 0c             	sub    $0xc,%esp
+  802976:	ff 75 f4             	push   -0xc(%ebp)
+  802979:	e8 21 e8 ff ff       	call   80119f <fd2data>
+  80297e:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  802980:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802983:	e8 59 fa ff ff       	call   8023e1 <_pipeisclosed>
+  802988:	83 c4 10             	add    $0x10,%esp
+}
+  80298b:	c9                   	leave
+  80298c:	c3                   	ret
+
+0080298d <pipe_splice>:
+{
+  80298d:	55                   	push   %ebp
+  80298e:	89 e5                	mov    %esp,%ebp
+  802990:	57                   	push   %edi
+  802991:	56                   	push   %esi
+  802992:	53                   	push   %ebx
+  802993:	83 ec 34             	sub    $0x34,%esp
+  802996:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802999:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80299c:	50                   	push   %eax
+  80299d:	ff 75 08             	push   0x8(%ebp)
+  8029a0:	e8 64 e8 ff ff       	call   801209 <fd_lookup>
+  8029a5:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8029a8:	83 c4 10             	add    $0x10,%esp
+  8029ab:	85 c0                	test   %eax,%eax
+  8029ad:	0f 88 d7 00 00 00    	js     802a8a <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  8029b3:	83 ec 0c             	sub    $0xc,%esp
+  8029b6:	ff 75 e4             	push   -0x1c(%ebp)
+  8029b9:	e8 e1 e7 ff ff       	call   80119f <fd2data>
+  8029be:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  8029c0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8029c3:	83 c4 10             	add    $0x10,%esp
+  8029c6:	8b 15 24 40 80 00    	mov    0x804024,%edx
+  8029cc:	39 10                	cmp    %edx,(%eax)
+  8029ce:	0f 85 c1 00 00 00    	jne    802a95 <pipe_splice+0x108>
+  8029d4:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  8029d8:	0f 84 c0 00 00 00    	je     802a9e <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  8029de:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  8029e2:	0f 84 bf 00 00 00    	je     802aa7 <pipe_splice+0x11a>
+  8029e8:	89 f7                	mov    %esi,%edi
+  8029ea:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  8029f0:	0f 85 ba 00 00 00    	jne    802ab0 <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  8029f6:	8d 43 04             	lea    0x4(%ebx),%eax
+  8029f9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8029fc:	eb 38                	jmp    802a36 <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  8029fe:	83 ec 0c             	sub    $0xc,%esp
+  802a01:	68 00 10 00 00       	push   $0x1000
+  802a06:	89 f1                	mov    %esi,%ecx
+  802a08:	89 da                	mov    %ebx,%edx
+  802a0a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802a0d:	e8 34 fa ff ff       	call   802446 <devpipe_write_bulk>
+  802a12:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802a15:	83 c4 10             	add    $0x10,%esp
+  802a18:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802a1d:	75 53                	jne    802a72 <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  802a1f:	83 ec 08             	sub    $0x8,%esp
+  802a22:	56                   	push   %esi
+  802a23:	6a 00                	push   $0x0
+  802a25:	e8 3b e3 ff ff       	call   800d65 <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  802a2a:	83 c7 01             	add    $0x1,%edi
+  802a2d:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802a33:	83 c4 10             	add    $0x10,%esp
+  802a36:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802a39:	74 3a                	je     802a75 <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  802a3b:	8b 03                	mov    (%ebx),%eax
+  802a3d:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802a40:	75 bc                	jne    8029fe <pipe_splice+0x71>
+  802a42:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a47:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  802a4b:	85 c0                	test   %eax,%eax
+  802a4d:	74 af                	je     8029fe <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802a4f:	83 ec 04             	sub    $0x4,%esp
+  802a52:	6a 07                	push   $0x7
+  802a54:	56                   	push   %esi
+  802a55:	ff 75 d0             	push   -0x30(%ebp)
+  802a58:	e8 df e5 ff ff       	call   80103c <sys_chan_wakeup>
+  802a5d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802a60:	83 c4 10             	add    $0x10,%esp
+  802a63:	85 c0                	test   %eax,%eax
+  802a65:	79 b8                	jns    802a1f <pipe_splice+0x92>
+  802a67:	b8 01 00 00 00       	mov    $0x1,%eax
+  802a6c:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802a70:	eb 8c                	jmp    8029fe <pipe_splice+0x71>
+  802a72:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  802a75:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802a79:	75 06                	jne    802a81 <pipe_splice+0xf4>
+  802a7b:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802a7f:	78 09                	js     802a8a <pipe_splice+0xfd>
+  return i * PGSIZE;
+  802a81:	8b 45 10             	mov    0x10(%ebp),%eax
+  802a84:	c1 e0 0c             	shl    $0xc,%eax
+  802a87:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  802a8a:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802a8d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a90:	5b                   	pop    %ebx
+  802a91:	5e                   	pop    %esi
+  802a92:	5f                   	pop    %edi
+  802a93:	5d                   	pop    %ebp
+  802a94:	c3                   	ret
+    return -E_INVAL;
+  802a95:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802a9c:	eb ec                	jmp    802a8a <pipe_splice+0xfd>
+  802a9e:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802aa5:	eb e3                	jmp    802a8a <pipe_splice+0xfd>
+  802aa7:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802aae:	eb da                	jmp    802a8a <pipe_splice+0xfd>
+  802ab0:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802ab7:	eb d1                	jmp    802a8a <pipe_splice+0xfd>
+
+00802ab9 <pipe_splice_read>:
+{
+  802ab9:	55                   	push   %ebp
+  802aba:	89 e5                	mov    %esp,%ebp
+  802abc:	53                   	push   %ebx
+  802abd:	83 ec 1c             	sub    $0x1c,%esp
+  802ac0:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802ac3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802ac6:	50                   	push   %eax
+  802ac7:	ff 75 08             	push   0x8(%ebp)
+  802aca:	e8 3a e7 ff ff       	call   801209 <fd_lookup>
+  802acf:	83 c4 10             	add    $0x10,%esp
+  802ad2:	85 c0                	test   %eax,%eax
+  802ad4:	78 49                	js     802b1f <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  802ad6:	83 ec 0c             	sub    $0xc,%esp
+  802ad9:	ff 75 f4             	push   -0xc(%ebp)
+  802adc:	e8 be e6 ff ff       	call   80119f <fd2data>
+  802ae1:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802ae3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ae6:	83 c4 10             	add    $0x10,%esp
+  802ae9:	8b 0d 24 40 80 00    	mov    0x804024,%ecx
+  802aef:	39 08                	cmp    %ecx,(%eax)
+  802af1:	75 31                	jne    802b24 <pipe_splice_read+0x6b>
+  802af3:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  802af7:	74 32                	je     802b2b <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  802af9:	8b 48 08             	mov    0x8(%eax),%ecx
+  802afc:	83 e1 03             	and    $0x3,%ecx
+  802aff:	83 f9 01             	cmp    $0x1,%ecx
+  802b02:	74 2e                	je     802b32 <pipe_splice_read+0x79>
+  802b04:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  802b0a:	75 2d                	jne    802b39 <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  802b0c:	83 ec 08             	sub    $0x8,%esp
+  802b0f:	53                   	push   %ebx
+  802b10:	68 00 10 00 00       	push   $0x1000
+  802b15:	89 d9                	mov    %ebx,%ecx
+  802b17:	e8 93 fa ff ff       	call   8025af <devpipe_read_bulk>
+  802b1c:	83 c4 10             	add    $0x10,%esp
+}
+  802b1f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802b22:	c9                   	leave
+  802b23:	c3                   	ret
+    return -E_INVAL;
+  802b24:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b29:	eb f4                	jmp    802b1f <pipe_splice_read+0x66>
+  802b2b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b30:	eb ed                	jmp    802b1f <pipe_splice_read+0x66>
+  802b32:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b37:	eb e6                	jmp    802b1f <pipe_splice_read+0x66>
+  802b39:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802b3e:	eb df                	jmp    802b1f <pipe_splice_read+0x66>
+
+00802b40 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  802b40:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b45:	c3                   	ret
+
+00802b46 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802b46:	55                   	push   %ebp
+  802b47:	89 e5                	mov    %esp,%ebp
+  802b49:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  802b4c:	68 87 35 80 00       	push   $0x803587
+  802b51:	ff 75 0c             	push   0xc(%ebp)
+  802b54:	e8 58 dd ff ff       	call   8008b1 <strcpy>
+  return 0;
+}
+  802b59:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b5e:	c9                   	leave
+  802b5f:	c3                   	ret
+
+00802b60 <devcons_write>:
+{
+  802b60:	55                   	push   %ebp
+  802b61:	89 e5                	mov    %esp,%ebp
+  802b63:	57                   	push   %edi
+  802b64:	56                   	push   %esi
+  802b65:	53                   	push   %ebx
+  802b66:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  802b6c:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  802b71:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  802b77:	eb 2e                	jmp    802ba7 <devcons_write+0x47>
+    m = n - tot;
+  802b79:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802b7c:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  802b7e:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802b83:	39 c3                	cmp    %eax,%ebx
+  802b85:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  802b88:	83 ec 04             	sub    $0x4,%esp
+  802b8b:	53                   	push   %ebx
+  802b8c:	89 f0                	mov    %esi,%eax
+  802b8e:	03 45 0c             	add    0xc(%ebp),%eax
+  802b91:	50                   	push   %eax
+  802b92:	57                   	push   %edi
+  802b93:	e8 9f de ff ff       	call   800a37 <memmove>
+    sys_cputs(buf, m);
+  802b98:	83 c4 08             	add    $0x8,%esp
+  802b9b:	53                   	push   %ebx
+  802b9c:	57                   	push   %edi
+  802b9d:	e8 3f e0 ff ff       	call   800be1 <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  802ba2:	01 de                	add    %ebx,%esi
+  802ba4:	83 c4 10             	add    $0x10,%esp
+  802ba7:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802baa:	72 cd                	jb     802b79 <devcons_write+0x19>
+}
+  802bac:	89 f0                	mov    %esi,%eax
+  802bae:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802bb1:	5b                   	pop    %ebx
+  802bb2:	5e                   	pop    %esi
+  802bb3:	5f                   	pop    %edi
+  802bb4:	5d                   	pop    %ebp
+  802bb5:	c3                   	ret
+
+00802bb6 <devcons_read>:
+{
+  802bb6:	55                   	push   %ebp
+  802bb7:	89 e5                	mov    %esp,%ebp
+  802bb9:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  802bbc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bc1:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802bc5:	75 07                	jne    802bce <devcons_read+0x18>
+  802bc7:	eb 1f                	jmp    802be8 <devcons_read+0x32>
+    sys_yield();
+  802bc9:	e8 b0 e0 ff ff       	call   800c7e <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  802bce:	e8 2c e0 ff ff       	call   800bff <sys_cgetc>
+  802bd3:	85 c0                	test   %eax,%eax
+  802bd5:	74 f2                	je     802bc9 <devcons_read+0x13>
+  if (c < 0)
+  802bd7:	78 0f                	js     802be8 <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  802bd9:	83 f8 04             	cmp    $0x4,%eax
+  802bdc:	74 0c                	je     802bea <devcons_read+0x34>
+  *(char*)vbuf = c;
+  802bde:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802be1:	88 02                	mov    %al,(%edx)
+  return 1;
+  802be3:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802be8:	c9                   	leave
+  802be9:	c3                   	ret
+    return 0;
+  802bea:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bef:	eb f7                	jmp    802be8 <devcons_read+0x32>
+
+00802bf1 <cputchar>:
+{
+  802bf1:	55                   	push   %ebp
+  802bf2:	89 e5                	mov    %esp,%ebp
+  802bf4:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  802bf7:	8b 45 08             	mov    0x8(%ebp),%eax
+  802bfa:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  802bfd:	6a 01                	push   $0x1
+  802bff:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802c02:	50                   	push   %eax
+  802c03:	e8 d9 df ff ff       	call   800be1 <sys_cputs>
+}
+  802c08:	83 c4 10             	add    $0x10,%esp
+  802c0b:	c9                   	leave
+  802c0c:	c3                   	ret
+
+00802c0d <getchar>:
+{
+  802c0d:	55                   	push   %ebp
+  802c0e:	89 e5                	mov    %esp,%ebp
+  802c10:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  802c13:	6a 01                	push   $0x1
+  802c15:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802c18:	50                   	push   %eax
+  802c19:	6a 00                	push   $0x0
+  802c1b:	e8 94 e8 ff ff       	call   8014b4 <read>
+  if (r < 0)
+  802c20:	83 c4 10             	add    $0x10,%esp
+  802c23:	85 c0                	test   %eax,%eax
+  802c25:	78 06                	js     802c2d <getchar+0x20>
+  if (r < 1)
+  802c27:	74 06                	je     802c2f <getchar+0x22>
+  return c;
+  802c29:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802c2d:	c9                   	leave
+  802c2e:	c3                   	ret
+    return -E_EOF;
+  802c2f:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802c34:	eb f7                	jmp    802c2d <getchar+0x20>
+
+00802c36 <iscons>:
+{
+  802c36:	55                   	push   %ebp
+  802c37:	89 e5                	mov    %esp,%ebp
+  802c39:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802c3c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802c3f:	50                   	push   %eax
+  802c40:	ff 75 08             	push   0x8(%ebp)
+  802c43:	e8 c1 e5 ff ff       	call   801209 <fd_lookup>
+  802c48:	83 c4 10             	add    $0x10,%esp
+  802c4b:	85 c0                	test   %eax,%eax
+  802c4d:	78 11                	js     802c60 <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  802c4f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c52:	8b 15 40 40 80 00    	mov    0x804040,%edx
+  802c58:	39 10                	cmp    %edx,(%eax)
+  802c5a:	0f 94 c0             	sete   %al
+  802c5d:	0f b6 c0             	movzbl %al,%eax
+}
+  802c60:	c9                   	leave
+  802c61:	c3                   	ret
+
+00802c62 <opencons>:
+{
+  802c62:	55                   	push   %ebp
+  802c63:	89 e5                	mov    %esp,%ebp
+  802c65:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  802c68:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802c6b:	50                   	push   %eax
+  802c6c:	e8 42 e5 ff ff       	call   8011b3 <fd_alloc>
+  802c71:	83 c4 10             	add    $0x10,%esp
+  802c74:	85 c0                	test   %eax,%eax
+  802c76:	78 3a                	js     802cb2 <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802c78:	83 ec 04             	sub    $0x4,%esp
+  802c7b:	68 07 04 00 00       	push   $0x407
+  802c80:	ff 75 f4             	push   -0xc(%ebp)
+  802c83:	6a 00                	push   $0x0
+  802c85:	e8 56 e0 ff ff       	call   800ce0 <sys_page_alloc>
+  802c8a:	83 c4 10             	add    $0x10,%esp
+  802c8d:	85 c0                	test   %eax,%eax
+  802c8f:	78 21                	js     802cb2 <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  802c91:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c94:	8b 15 40 40 80 00    	mov    0x804040,%edx
+  802c9a:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  802c9c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c9f:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  802ca6:	83 ec 0c             	sub    $0xc,%esp
+  802ca9:	50                   	push   %eax
+  802caa:	e8 e0 e4 ff ff       	call   80118f <fd2num>
+  802caf:	83 c4 10             	add    $0x10,%esp
+}
+  802cb2:	c9                   	leave
+  802cb3:	c3                   	ret
+
+00802cb4 <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  802cb4:	55                   	push   %ebp
+  802cb5:	89 e5                	mov    %esp,%ebp
+  802cb7:	57                   	push   %edi
+  802cb8:	56                   	push   %esi
+  802cb9:	53                   	push   %ebx
+  802cba:	83 ec 14             	sub    $0x14,%esp
+  802cbd:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802cc0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802cc3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802cc6:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  802cc9:	85 c0                	test   %eax,%eax
+  802ccb:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802cd0:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  802cd3:	ff 33                	push   (%ebx)
+  802cd5:	50                   	push   %eax
+  802cd6:	e8 dd e2 ff ff       	call   800fb8 <sys_ipc_recv>
+  802cdb:	83 c4 10             	add    $0x10,%esp
+  802cde:	85 c0                	test   %eax,%eax
+  802ce0:	78 39                	js     802d1b <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  802ce2:	85 ff                	test   %edi,%edi
+  802ce4:	74 0a                	je     802cf0 <ipc_recv_pages+0x3c>
+  802ce6:	a1 64 57 80 00       	mov    0x805764,%eax
+  802ceb:	8b 40 7c             	mov    0x7c(%eax),%eax
+  802cee:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  802cf0:	85 f6                	test   %esi,%esi
+  802cf2:	74 0d                	je     802d01 <ipc_recv_pages+0x4d>
+  802cf4:	a1 64 57 80 00       	mov    0x805764,%eax
+  802cf9:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  802cff:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  802d01:	a1 64 57 80 00       	mov    0x805764,%eax
+  802d06:	8b 40 74             	mov    0x74(%eax),%eax
+  802d09:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  802d0b:	a1 64 57 80 00       	mov    0x805764,%eax
+  802d10:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  802d13:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d16:	5b                   	pop    %ebx
+  802d17:	5e                   	pop    %esi
+  802d18:	5f                   	pop    %edi
+  802d19:	5d                   	pop    %ebp
+  802d1a:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  802d1b:	85 ff                	test   %edi,%edi
+  802d1d:	74 06                	je     802d25 <ipc_recv_pages+0x71>
+  802d1f:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  802d25:	85 f6                	test   %esi,%esi
+  802d27:	74 06                	je     802d2f <ipc_recv_pages+0x7b>
+  802d29:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  802d2f:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  802d35:	eb dc                	jmp    802d13 <ipc_recv_pages+0x5f>
+
+00802d37 <ipc_recv>:
+{
+  802d37:	55                   	push   %ebp
+  802d38:	89 e5                	mov    %esp,%ebp
+  802d3a:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  802d3d:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  802d44:	ff 75 10             	push   0x10(%ebp)
+  802d47:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802d4a:	50                   	push   %eax
+  802d4b:	ff 75 0c             	push   0xc(%ebp)
+  802d4e:	ff 75 08             	push   0x8(%ebp)
+  802d51:	e8 5e ff ff ff       	call   802cb4 <ipc_recv_pages>
+}
+  802d56:	c9                   	leave
+  802d57:	c3                   	ret
+
+00802d58 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  802d58:	55                   	push   %ebp
+  802d59:	89 e5                	mov    %esp,%ebp
+  802d5b:	57                   	push   %edi
+  802d5c:	56                   	push   %esi
+  802d5d:	53                   	push   %ebx
+  802d5e:	83 ec 0c             	sub    $0xc,%esp
+  802d61:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802d64:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802d67:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  802d6a:	89 c3                	mov    %eax,%ebx
+  802d6c:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  802d72:	85 c0                	test   %eax,%eax
+  802d74:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802d79:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  802d7c:	83 ec 0c             	sub    $0xc,%esp
+  802d7f:	ff 75 14             	push   0x14(%ebp)
+  802d82:	ff 75 18             	push   0x18(%ebp)
+  802d85:	53                   	push   %ebx
+  802d86:	56                   	push   %esi
+  802d87:	57                   	push   %edi
+  802d88:	e8 0a e2 ff ff       	call   800f97 <sys_ipc_try_send>
+  802d8d:	83 c4 20             	add    $0x20,%esp
+  802d90:	85 c0                	test   %eax,%eax
+  802d92:	79 1e                	jns    802db2 <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  802d94:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802d97:	75 07                	jne    802da0 <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  802d99:	e8 e0 de ff ff       	call   800c7e <sys_yield>
+  802d9e:	eb dc                	jmp    802d7c <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  802da0:	50                   	push   %eax
+  802da1:	68 93 35 80 00       	push   $0x803593
+  802da6:	6a 5c                	push   $0x5c
+  802da8:	68 a0 35 80 00       	push   $0x8035a0
+  802dad:	e8 36 d4 ff ff       	call   8001e8 <_panic>
+  }
+}
+  802db2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802db5:	5b                   	pop    %ebx
+  802db6:	5e                   	pop    %esi
+  802db7:	5f                   	pop    %edi
+  802db8:	5d                   	pop    %ebp
+  802db9:	c3                   	ret
+
+00802dba <ipc_send>:
+{
+  802dba:	55                   	push   %ebp
+  802dbb:	89 e5                	mov    %esp,%ebp
+  802dbd:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  802dc0:	ff 75 14             	push   0x14(%ebp)
+  802dc3:	6a 01                	push   $0x1
+  802dc5:	ff 75 10             	push   0x10(%ebp)
+  802dc8:	ff 75 0c             	push   0xc(%ebp)
+  802dcb:	ff 75 08             	push   0x8(%ebp)
+  802dce:	e8 85 ff ff ff       	call   802d58 <ipc_send_pages>
+}
+  802dd3:	83 c4 20             	add    $0x20,%esp
+  802dd6:	c9                   	leave
+  802dd7:	c3                   	ret
+
+00802dd8 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802dd8:	55                   	push   %ebp
+  802dd9:	89 e5                	mov    %esp,%ebp
+  802ddb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  802dde:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  802de3:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802de6:	c1 e0 04             	shl    $0x4,%eax
+  802de9:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802dee:	8b 40 50             	mov    0x50(%eax),%eax
+  802df1:	39 c8                	cmp    %ecx,%eax
+  802df3:	74 12                	je     802e07 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  802df5:	83 c2 01             	add    $0x1,%edx
+  802df8:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802dfe:	75 e3                	jne    802de3 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  802e00:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e05:	eb 0e                	jmp    802e15 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  802e07:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802e0a:	c1 e0 04             	shl    $0x4,%eax
+  802e0d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802e12:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802e15:	5d                   	pop    %ebp
+  802e16:	c3                   	ret
+
+00802e17 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802e17:	55                   	push   %ebp
+  802e18:	89 e5                	mov    %esp,%ebp
+  802e1a:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802e1d:	89 c2                	mov    %eax,%edx
+  802e1f:	c1 ea 16             	shr    $0x16,%edx
+  802e22:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  802e29:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802e2e:	f6 c1 01             	test   $0x1,%cl
+  802e31:	74 1c                	je     802e4f <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  802e33:	c1 e8 0c             	shr    $0xc,%eax
+  802e36:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  802e3d:	a8 01                	test   $0x1,%al
+  802e3f:	74 0e                	je     802e4f <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  802e41:	c1 e8 0c             	shr    $0xc,%eax
+  802e44:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802e4b:	ef 
+  802e4c:	0f b7 d2             	movzwl %dx,%edx
+}
+  802e4f:	89 d0                	mov    %edx,%eax
+  802e51:	5d                   	pop    %ebp
+  802e52:	c3                   	ret
+
+00802e53 <udivmod>:
+  802e53:	55                   	push   %ebp
+  802e54:	57                   	push   %edi
+  802e55:	56                   	push   %esi
+  802e56:	53                   	push   %ebx
+  802e57:	83 ec 14             	sub    $0x14,%esp
+  802e5a:	8b 74 24 28          	mov    0x28(%esp),%esi
+  802e5e:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  802e62:	89 fb                	mov    %edi,%ebx
+  802e64:	09 f3                	or     %esi,%ebx
+  802e66:	0f 84 88 00 00 00    	je     802ef4 <udivmod+0xa1>
+  802e6c:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802e71:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802e78:	00 
+  802e79:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802e80:	00 
+  802e81:	89 cd                	mov    %ecx,%ebp
+  802e83:	89 34 24             	mov    %esi,(%esp)
+  802e86:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802e8a:	eb 08                	jmp    802e94 <udivmod+0x41>
+  802e8c:	83 ed 01             	sub    $0x1,%ebp
+  802e8f:	83 fd ff             	cmp    $0xffffffff,%ebp
+  802e92:	74 6c                	je     802f00 <udivmod+0xad>
+  802e94:	89 c3                	mov    %eax,%ebx
+  802e96:	89 d6                	mov    %edx,%esi
+  802e98:	89 e9                	mov    %ebp,%ecx
+  802e9a:	0f ad f3             	shrd   %cl,%esi,%ebx
+  802e9d:	d3 ee                	shr    %cl,%esi
+  802e9f:	f6 c1 20             	test   $0x20,%cl
+  802ea2:	74 04                	je     802ea8 <udivmod+0x55>
+  802ea4:	89 f3                	mov    %esi,%ebx
+  802ea6:	31 f6                	xor    %esi,%esi
+  802ea8:	8b 3c 24             	mov    (%esp),%edi
+  802eab:	39 fb                	cmp    %edi,%ebx
+  802ead:	89 f7                	mov    %esi,%edi
+  802eaf:	8b 1c 24             	mov    (%esp),%ebx
+  802eb2:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802eb6:	19 f7                	sbb    %esi,%edi
+  802eb8:	72 d2                	jb     802e8c <udivmod+0x39>
+  802eba:	89 f7                	mov    %esi,%edi
+  802ebc:	89 de                	mov    %ebx,%esi
+  802ebe:	89 e9                	mov    %ebp,%ecx
+  802ec0:	0f a5 f7             	shld   %cl,%esi,%edi
+  802ec3:	d3 e6                	shl    %cl,%esi
+  802ec5:	f6 c1 20             	test   $0x20,%cl
+  802ec8:	74 04                	je     802ece <udivmod+0x7b>
+  802eca:	89 f7                	mov    %esi,%edi
+  802ecc:	31 f6                	xor    %esi,%esi
+  802ece:	29 f0                	sub    %esi,%eax
+  802ed0:	19 fa                	sbb    %edi,%edx
+  802ed2:	be 01 00 00 00       	mov    $0x1,%esi
+  802ed7:	bf 00 00 00 00       	mov    $0x0,%edi
+  802edc:	0f a5 f7             	shld   %cl,%esi,%edi
+  802edf:	d3 e6                	shl    %cl,%esi
+  802ee1:	f6 c1 20             	test   $0x20,%cl
+  802ee4:	74 04                	je     802eea <udivmod+0x97>
+  802ee6:	89 f7                	mov    %esi,%edi
+  802ee8:	31 f6                	xor    %esi,%esi
+  802eea:	09 74 24 08          	or     %esi,0x8(%esp)
+  802eee:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802ef2:	eb 98                	jmp    802e8c <udivmod+0x39>
+  802ef4:	89 f0                	mov    %esi,%eax
+  802ef6:	89 fa                	mov    %edi,%edx
+  802ef8:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802efc:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802f00:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802f04:	89 01                	mov    %eax,(%ecx)
+  802f06:	89 51 04             	mov    %edx,0x4(%ecx)
+  802f09:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802f0d:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802f11:	83 c4 14             	add    $0x14,%esp
+  802f14:	5b                   	pop    %ebx
+  802f15:	5e                   	pop    %esi
+  802f16:	5f                   	pop    %edi
+  802f17:	5d                   	pop    %ebp
+  802f18:	c3                   	ret
+
+00802f19 <__udivdi3>:
+  802f19:	83 ec 18             	sub    $0x18,%esp
+  802f1c:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802f20:	50                   	push   %eax
+  802f21:	ff 74 24 2c          	push   0x2c(%esp)
+  802f25:	ff 74 24 2c          	push   0x2c(%esp)
+  802f29:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802f2d:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802f31:	e8 1d ff ff ff       	call   802e53 <udivmod>
+  802f36:	83 c4 24             	add    $0x24,%esp
+  802f39:	c3                   	ret
+
+00802f3a <__umoddi3>:
+  802f3a:	83 ec 18             	sub    $0x18,%esp
+  802f3d:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802f41:	50                   	push   %eax
+  802f42:	ff 74 24 2c          	push   0x2c(%esp)
+  802f46:	ff 74 24 2c          	push   0x2c(%esp)
+  802f4a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802f4e:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802f52:	e8 fc fe ff ff       	call   802e53 <udivmod>
+  802f57:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802f5b:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802f5f:	83 c4 24             	add    $0x24,%esp
+  802f62:	c3                   	ret
+
+00802f63 <__divdi3>:
+  802f63:	56                   	push   %esi
+  802f64:	53                   	push   %ebx
+  802f65:	83 ec 14             	sub    $0x14,%esp
+  802f68:	8b 44 24 20          	mov    0x20(%esp),%eax
+  802f6c:	8b 54 24 24          	mov    0x24(%esp),%edx
+  802f70:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  802f74:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  802f78:	85 d2                	test   %edx,%edx
+  802f7a:	78 18                	js     802f94 <__divdi3+0x31>
+  802f7c:	85 db                	test   %ebx,%ebx
+  802f7e:	78 3e                	js     802fbe <__divdi3+0x5b>
+  802f80:	83 ec 04             	sub    $0x4,%esp
+  802f83:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802f87:	56                   	push   %esi
+  802f88:	53                   	push   %ebx
+  802f89:	51                   	push   %ecx
+  802f8a:	e8 c4 fe ff ff       	call   802e53 <udivmod>
+  802f8f:	83 c4 10             	add    $0x10,%esp
+  802f92:	eb 24                	jmp    802fb8 <__divdi3+0x55>
+  802f94:	f7 d8                	neg    %eax
+  802f96:	83 d2 00             	adc    $0x0,%edx
+  802f99:	f7 da                	neg    %edx
+  802f9b:	85 db                	test   %ebx,%ebx
+  802f9d:	78 3a                	js     802fd9 <__divdi3+0x76>
+  802f9f:	83 ec 04             	sub    $0x4,%esp
+  802fa2:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802fa6:	56                   	push   %esi
+  802fa7:	53                   	push   %ebx
+  802fa8:	51                   	push   %ecx
+  802fa9:	e8 a5 fe ff ff       	call   802e53 <udivmod>
+  802fae:	83 c4 10             	add    $0x10,%esp
+  802fb1:	f7 d8                	neg    %eax
+  802fb3:	83 d2 00             	adc    $0x0,%edx
+  802fb6:	f7 da                	neg    %edx
+  802fb8:	83 c4 14             	add    $0x14,%esp
+  802fbb:	5b                   	pop    %ebx
+  802fbc:	5e                   	pop    %esi
+  802fbd:	c3                   	ret
+  802fbe:	83 ec 04             	sub    $0x4,%esp
+  802fc1:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802fc5:	56                   	push   %esi
+  802fc6:	f7 d9                	neg    %ecx
+  802fc8:	83 d3 00             	adc    $0x0,%ebx
+  802fcb:	f7 db                	neg    %ebx
+  802fcd:	53                   	push   %ebx
+  802fce:	51                   	push   %ecx
+  802fcf:	e8 7f fe ff ff       	call   802e53 <udivmod>
+  802fd4:	83 c4 10             	add    $0x10,%esp
+  802fd7:	eb d8                	jmp    802fb1 <__divdi3+0x4e>
+  802fd9:	83 ec 04             	sub    $0x4,%esp
+  802fdc:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802fe0:	56                   	push   %esi
+  802fe1:	f7 d9                	neg    %ecx
+  802fe3:	83 d3 00             	adc    $0x0,%ebx
+  802fe6:	f7 db                	neg    %ebx
+  802fe8:	53                   	push   %ebx
+  802fe9:	51                   	push   %ecx
+  802fea:	e8 64 fe ff ff       	call   802e53 <udivmod>
+  802fef:	83 c4 10             	add    $0x10,%esp
+  802ff2:	eb c4                	jmp    802fb8 <__divdi3+0x55>
+
+00802ff4 <__moddi3>:
+  802ff4:	55                   	push   %ebp
+  802ff5:	57                   	push   %edi
+  802ff6:	56                   	push   %esi
+  802ff7:	53                   	push   %ebx
+  802ff8:	83 ec 24             	sub    $0x24,%esp
+  802ffb:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802fff:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803003:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  803007:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  80300b:	85 d2                	test   %edx,%edx
+  80300d:	78 3b                	js     80304a <__moddi3+0x56>
+  80300f:	83 ec 04             	sub    $0x4,%esp
+  803012:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803016:	56                   	push   %esi
+  803017:	89 ce                	mov    %ecx,%esi
+  803019:	f7 de                	neg    %esi
+  80301b:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80301f:	89 de                	mov    %ebx,%esi
+  803021:	83 d6 00             	adc    $0x0,%esi
+  803024:	f7 de                	neg    %esi
+  803026:	89 74 24 14          	mov    %esi,0x14(%esp)
+  80302a:	8b 74 24 08          	mov    0x8(%esp),%esi
+  80302e:	0f 48 f1             	cmovs  %ecx,%esi
+  803031:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  803036:	53                   	push   %ebx
+  803037:	56                   	push   %esi
+  803038:	e8 16 fe ff ff       	call   802e53 <udivmod>
+  80303d:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803041:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803045:	83 c4 10             	add    $0x10,%esp
+  803048:	eb 47                	jmp    803091 <__moddi3+0x9d>
+  80304a:	f7 d8                	neg    %eax
+  80304c:	83 d2 00             	adc    $0x0,%edx
+  80304f:	f7 da                	neg    %edx
+  803051:	83 ec 04             	sub    $0x4,%esp
+  803054:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803058:	56                   	push   %esi
+  803059:	89 cf                	mov    %ecx,%edi
+  80305b:	f7 df                	neg    %edi
+  80305d:	89 de                	mov    %ebx,%esi
+  80305f:	83 d6 00             	adc    $0x0,%esi
+  803062:	f7 de                	neg    %esi
+  803064:	0f 49 cf             	cmovns %edi,%ecx
+  803067:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  80306b:	0f 49 de             	cmovns %esi,%ebx
+  80306e:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  803072:	ff 74 24 0c          	push   0xc(%esp)
+  803076:	ff 74 24 0c          	push   0xc(%esp)
+  80307a:	e8 d4 fd ff ff       	call   802e53 <udivmod>
+  80307f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803083:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803087:	f7 d8                	neg    %eax
+  803089:	83 d2 00             	adc    $0x0,%edx
+  80308c:	f7 da                	neg    %edx
+  80308e:	83 c4 10             	add    $0x10,%esp
+  803091:	83 c4 24             	add    $0x24,%esp
+  803094:	5b                   	pop    %ebx
+  803095:	5e                   	pop    %esi
+  803096:	5f                   	pop    %edi
+  803097:	5d                   	pop    %ebp
+  803098:	c3                   	ret
@@ -0,0 +1,8011 @@
+
+obj/user/openbench.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 95 02 00 00       	call   8002c6 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <report>:
+  return n * 1000 / MAX(ms, 1);
+}
+
+static void
+report(const char *what, int n)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 7c             	sub    $0x7c,%esp
+  80003c:	89 45 84             	mov    %eax,-0x7c(%ebp)
+  80003f:	89 d6                	mov    %edx,%esi
+  start = sys_time_msec();
+  800041:	e8 ff 10 00 00       	call   801145 <sys_time_msec>
+  800046:	89 c7                	mov    %eax,%edi
+  for (i = 0; i < n; i++) {
+  800048:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80004d:	39 de                	cmp    %ebx,%esi
+  80004f:	7e 41                	jle    800092 <report+0x5f>
+    if ((fd = open(NAME, O_RDONLY)) < 0)
+  800051:	83 ec 08             	sub    $0x8,%esp
+  800054:	6a 00                	push   $0x0
+  800056:	68 e0 3b 80 00       	push   $0x803be0
+  80005b:	e8 61 23 00 00       	call   8023c1 <open>
+  800060:	83 c4 10             	add    $0x10,%esp
+  800063:	85 c0                	test   %eax,%eax
+  800065:	78 11                	js     800078 <report+0x45>
+    close(fd);
+  800067:	83 ec 0c             	sub    $0xc,%esp
+  80006a:	50                   	push   %eax
+  80006b:	e8 9e 19 00 00       	call   801a0e <close>
+  for (i = 0; i < n; i++) {
+  800070:	83 c3 01             	add    $0x1,%ebx
+  800073:	83 c4 10             	add    $0x10,%esp
+  800076:	eb d5                	jmp    80004d <report+0x1a>
+      panic("open %s: %e", NAME, fd);
+  800078:	83 ec 0c             	sub    $0xc,%esp
+  80007b:	50                   	push   %eax
+  80007c:	68 e0 3b 80 00       	push   $0x803be0
+  800081:	68 eb 3b 80 00       	push   $0x803beb
+  800086:	6a 1e                	push   $0x1e
+  800088:	68 f7 3b 80 00       	push   $0x803bf7
+  80008d:	e8 a1 02 00 00       	call   800333 <_panic>
+  ms = sys_time_msec() - start;
+  800092:	e8 ae 10 00 00       	call   801145 <sys_time_msec>
+  return n * 1000 / MAX(ms, 1);
+  800097:	69 f6 e8 03 00 00    	imul   $0x3e8,%esi,%esi
+  ms = sys_time_msec() - start;
+  80009d:	29 f8                	sub    %edi,%eax
+  80009f:	89 c1                	mov    %eax,%ecx
+  return n * 1000 / MAX(ms, 1);
+  8000a1:	ba 01 00 00 00       	mov    $0x1,%edx
+  8000a6:	0f 44 ca             	cmove  %edx,%ecx
+  8000a9:	89 f0                	mov    %esi,%eax
+  8000ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000b0:	f7 f1                	div    %ecx
+  8000b2:	89 c6                	mov    %eax,%esi
+  struct Fsret_stats st;
+  unsigned rate;
+  int r;
+
+  rate = openclose(n);
+  if ((r = fs_stats(0, &st)) < 0)
+  8000b4:	83 ec 08             	sub    $0x8,%esp
+  8000b7:	8d 45 90             	lea    -0x70(%ebp),%eax
+  8000ba:	50                   	push   %eax
+  8000bb:	6a 00                	push   $0x0
+  8000bd:	e8 fe 25 00 00       	call   8026c0 <fs_stats>
+  8000c2:	83 c4 10             	add    $0x10,%esp
+  8000c5:	85 c0                	test   %eax,%eax
+  8000c7:	78 22                	js     8000eb <report+0xb8>
+    panic("fs_stats: %e", r);
+  cprintf("openbench: %-22s %6d opens/s, %4d entries free, %4d scans\n",
+  8000c9:	83 ec 0c             	sub    $0xc,%esp
+  8000cc:	ff 75 e0             	push   -0x20(%ebp)
+  8000cf:	ff 75 d8             	push   -0x28(%ebp)
+  8000d2:	56                   	push   %esi
+  8000d3:	ff 75 84             	push   -0x7c(%ebp)
+  8000d6:	68 48 3c 80 00       	push   $0x803c48
+  8000db:	e8 2e 03 00 00       	call   80040e <cprintf>
+          what, rate, st.ret_of_free, st.ret_of_sweeps);
+}
+  8000e0:	83 c4 20             	add    $0x20,%esp
+  8000e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000e6:	5b                   	pop    %ebx
+  8000e7:	5e                   	pop    %esi
+  8000e8:	5f                   	pop    %edi
+  8000e9:	5d                   	pop    %ebp
+  8000ea:	c3                   	ret
+    panic("fs_stats: %e", r);
+  8000eb:	50                   	push   %eax
+  8000ec:	68 08 3c 80 00       	push   $0x803c08
+  8000f1:	6a 2e                	push   $0x2e
+  8000f3:	68 f7 3b 80 00       	push   $0x803bf7
+  8000f8:	e8 36 02 00 00       	call   800333 <_panic>
+
+008000fd <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8000fd:	55                   	push   %ebp
+  8000fe:	89 e5                	mov    %esp,%ebp
+  800100:	57                   	push   %edi
+  800101:	56                   	push   %esi
+  800102:	53                   	push   %ebx
+  800103:	81 ec bc 00 00 00    	sub    $0xbc,%esp
+  envid_t kids[NCHILD];
+  char what[32];
+  int nops, i, j, fd, r;
+
+  binaryname = "openbench";
+  800109:	c7 05 00 50 80 00 e1 	movl   $0x803be1,0x805000
+  800110:	3b 80 00 
+  nops = 2000;
+  800113:	c7 85 44 ff ff ff d0 	movl   $0x7d0,-0xbc(%ebp)
+  80011a:	07 00 00 
+  if (argc > 1)
+  80011d:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+  800121:	7f 67                	jg     80018a <umain+0x8d>
+    nops = strtol(argv[1], 0, 0);
+
+  if ((r = sys_page_alloc(0, (void *) stop, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  800123:	83 ec 04             	sub    $0x4,%esp
+  800126:	68 07 04 00 00       	push   $0x407
+  80012b:	68 00 00 00 30       	push   $0x30000000
+  800130:	6a 00                	push   $0x0
+  800132:	e8 f4 0c 00 00       	call   800e2b <sys_page_alloc>
+  800137:	83 c4 10             	add    $0x10,%esp
+  80013a:	85 c0                	test   %eax,%eax
+  80013c:	78 6c                	js     8001aa <umain+0xad>
+    panic("sys_page_alloc: %e", r);
+  if ((fd = open(NAME, O_RDWR | O_CREAT)) < 0)
+  80013e:	83 ec 08             	sub    $0x8,%esp
+  800141:	68 02 01 00 00       	push   $0x102
+  800146:	68 e0 3b 80 00       	push   $0x803be0
+  80014b:	e8 71 22 00 00       	call   8023c1 <open>
+  800150:	83 c4 10             	add    $0x10,%esp
+  800153:	85 c0                	test   %eax,%eax
+  800155:	78 65                	js     8001bc <umain+0xbf>
+    panic("open %s: %e", NAME, fd);
+  close(fd);
+  800157:	83 ec 0c             	sub    $0xc,%esp
+  80015a:	50                   	push   %eax
+  80015b:	e8 ae 18 00 00       	call   801a0e <close>
+
+  report("none held open:", nops);
+  800160:	8b 95 44 ff ff ff    	mov    -0xbc(%ebp),%edx
+  800166:	b8 28 3c 80 00       	mov    $0x803c28,%eax
+  80016b:	e8 c3 fe ff ff       	call   800033 <report>
+
+  *stop = 0;
+  800170:	c7 05 00 00 00 30 00 	movl   $0x0,0x30000000
+  800177:	00 00 00 
+  for (i = 0; i < NCHILD; i++) {
+  80017a:	8d bd 70 ff ff ff    	lea    -0x90(%ebp),%edi
+  800180:	83 c4 10             	add    $0x10,%esp
+  800183:	89 fe                	mov    %edi,%esi
+  800185:	e9 9e 00 00 00       	jmp    800228 <umain+0x12b>
+    nops = strtol(argv[1], 0, 0);
+  80018a:	83 ec 04             	sub    $0x4,%esp
+  80018d:	6a 00                	push   $0x0
+  80018f:	6a 00                	push   $0x0
+  800191:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800194:	ff 70 04             	push   0x4(%eax)
+  800197:	e8 b4 0a 00 00       	call   800c50 <strtol>
+  80019c:	89 85 44 ff ff ff    	mov    %eax,-0xbc(%ebp)
+  8001a2:	83 c4 10             	add    $0x10,%esp
+  8001a5:	e9 79 ff ff ff       	jmp    800123 <umain+0x26>
+    panic("sys_page_alloc: %e", r);
+  8001aa:	50                   	push   %eax
+  8001ab:	68 15 3c 80 00       	push   $0x803c15
+  8001b0:	6a 40                	push   $0x40
+  8001b2:	68 f7 3b 80 00       	push   $0x803bf7
+  8001b7:	e8 77 01 00 00       	call   800333 <_panic>
+    panic("open %s: %e", NAME, fd);
+  8001bc:	83 ec 0c             	sub    $0xc,%esp
+  8001bf:	50                   	push   %eax
+  8001c0:	68 e0 3b 80 00       	push   $0x803be0
+  8001c5:	68 eb 3b 80 00       	push   $0x803beb
+  8001ca:	6a 42                	push   $0x42
+  8001cc:	68 f7 3b 80 00       	push   $0x803bf7
+  8001d1:	e8 5d 01 00 00       	call   800333 <_panic>
+    if ((kids[i] = fork()) < 0)
+      panic("fork: %e", kids[i]);
+  8001d6:	50                   	push   %eax
+  8001d7:	68 50 40 80 00       	push   $0x804050
+  8001dc:	6a 4a                	push   $0x4a
+  8001de:	68 f7 3b 80 00       	push   $0x803bf7
+  8001e3:	e8 4b 01 00 00       	call   800333 <_panic>
+    if (kids[i] == 0) {
+      for (j = 0; j < NHOLD; j++)
+        if ((fd = open(NAME, O_RDONLY)) < 0)
+          panic("open %s: %e", NAME, fd);
+      ipc_send(thisenv->env_parent_id, 0, 0, 0);
+  8001e8:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  8001ed:	8b 40 4c             	mov    0x4c(%eax),%eax
+  8001f0:	6a 00                	push   $0x0
+  8001f2:	6a 00                	push   $0x0
+  8001f4:	6a 00                	push   $0x0
+  8001f6:	50                   	push   %eax
+  8001f7:	e8 18 16 00 00       	call   801814 <ipc_send>
+      while (!*stop)
+  8001fc:	83 c4 10             	add    $0x10,%esp
+  8001ff:	eb 05                	jmp    800206 <umain+0x109>
+        sys_yield();
+  800201:	e8 c3 0b 00 00       	call   800dc9 <sys_yield>
+      while (!*stop)
+  800206:	a1 00 00 00 30       	mov    0x30000000,%eax
+  80020b:	85 c0                	test   %eax,%eax
+  80020d:	74 f2                	je     800201 <umain+0x104>
+      exit();
+  80020f:	e8 05 01 00 00       	call   800319 <exit>
+    }
+    ipc_recv(NULL, 0, NULL);
+  800214:	83 ec 04             	sub    $0x4,%esp
+  800217:	6a 00                	push   $0x0
+  800219:	6a 00                	push   $0x0
+  80021b:	6a 00                	push   $0x0
+  80021d:	e8 6f 15 00 00       	call   801791 <ipc_recv>
+  for (i = 0; i < NCHILD; i++) {
+  800222:	83 c6 04             	add    $0x4,%esi
+  800225:	83 c4 10             	add    $0x10,%esp
+  800228:	8d 45 e8             	lea    -0x18(%ebp),%eax
+  80022b:	39 c6                	cmp    %eax,%esi
+  80022d:	74 47                	je     800276 <umain+0x179>
+    if ((kids[i] = fork()) < 0)
+  80022f:	e8 64 12 00 00       	call   801498 <fork>
+  800234:	89 06                	mov    %eax,(%esi)
+  800236:	85 c0                	test   %eax,%eax
+  800238:	78 9c                	js     8001d6 <umain+0xd9>
+    if (kids[i] == 0) {
+  80023a:	75 d8                	jne    800214 <umain+0x117>
+  80023c:	bb 1f 00 00 00       	mov    $0x1f,%ebx
+      for (j = 0; j < NHOLD; j++)
+  800241:	83 eb 01             	sub    $0x1,%ebx
+  800244:	74 a2                	je     8001e8 <umain+0xeb>
+        if ((fd = open(NAME, O_RDONLY)) < 0)
+  800246:	83 ec 08             	sub    $0x8,%esp
+  800249:	6a 00                	push   $0x0
+  80024b:	68 e0 3b 80 00       	push   $0x803be0
+  800250:	e8 6c 21 00 00       	call   8023c1 <open>
+  800255:	83 c4 10             	add    $0x10,%esp
+  800258:	85 c0                	test   %eax,%eax
+  80025a:	79 e5                	jns    800241 <umain+0x144>
+          panic("open %s: %e", NAME, fd);
+  80025c:	83 ec 0c             	sub    $0xc,%esp
+  80025f:	50                   	push   %eax
+  800260:	68 e0 3b 80 00       	push   $0x803be0
+  800265:	68 eb 3b 80 00       	push   $0x803beb
+  80026a:	6a 4e                	push   $0x4e
+  80026c:	68 f7 3b 80 00       	push   $0x803bf7
+  800271:	e8 bd 00 00 00       	call   800333 <_panic>
+  }
+  snprintf(what, sizeof(what), "%d held open:", NCHILD * NHOLD);
+  800276:	68 84 03 00 00       	push   $0x384
+  80027b:	68 38 3c 80 00       	push   $0x803c38
+  800280:	6a 20                	push   $0x20
+  800282:	8d 9d 50 ff ff ff    	lea    -0xb0(%ebp),%ebx
+  800288:	53                   	push   %ebx
+  800289:	e8 19 07 00 00       	call   8009a7 <snprintf>
+  report(what, nops);
+  80028e:	8b 95 44 ff ff ff    	mov    -0xbc(%ebp),%edx
+  800294:	89 d8                	mov    %ebx,%eax
+  800296:	e8 98 fd ff ff       	call   800033 <report>
+
+  *stop = 1;
+  80029b:	c7 05 00 00 00 30 01 	movl   $0x1,0x30000000
+  8002a2:	00 00 00 
+  for (i = 0; i < NCHILD; i++)
+  8002a5:	83 c4 10             	add    $0x10,%esp
+  8002a8:	eb 10                	jmp    8002ba <umain+0x1bd>
+    wait(kids[i]);
+  8002aa:	83 ec 0c             	sub    $0xc,%esp
+  8002ad:	ff 37                	push   (%edi)
+  8002af:	e8 5a 2e 00 00       	call   80310e <wait>
+  for (i = 0; i < NCHILD; i++)
+  8002b4:	83 c7 04             	add    $0x4,%edi
+  8002b7:	83 c4 10             	add    $0x10,%esp
+  8002ba:	39 f7                	cmp    %esi,%edi
+  8002bc:	75 ec                	jne    8002aa <umain+0x1ad>
+}
+  8002be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002c1:	5b                   	pop    %ebx
+  8002c2:	5e                   	pop    %esi
+  8002c3:	5f                   	pop    %edi
+  8002c4:	5d                   	pop    %ebp
+  8002c5:	c3                   	ret
+
+008002c6 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8002c6:	55                   	push   %ebp
+  8002c7:	89 e5                	mov    %esp,%ebp
+  8002c9:	56                   	push   %esi
+  8002ca:	53                   	push   %ebx
+  8002cb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8002ce:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  8002d1:	c7 05 a0 68 80 00 00 	movl   $0x0,0x8068a0
+  8002d8:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  8002db:	e8 ca 0a 00 00       	call   800daa <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  8002e0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8002e5:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8002e8:	c1 e0 04             	shl    $0x4,%eax
+  8002eb:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8002f0:	a3 a0 68 80 00       	mov    %eax,0x8068a0
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8002f5:	85 db                	test   %ebx,%ebx
+  8002f7:	7e 07                	jle    800300 <libmain+0x3a>
+    binaryname = argv[0];
+  8002f9:	8b 06                	mov    (%esi),%eax
+  8002fb:	a3 00 50 80 00       	mov    %eax,0x805000
+
+  // call user main routine
+  umain(argc, argv);
+  800300:	83 ec 08             	sub    $0x8,%esp
+  800303:	56                   	push   %esi
+  800304:	53                   	push   %ebx
+  800305:	e8 f3 fd ff ff       	call   8000fd <umain>
+
+  // exit gracefully
+  exit();
+  80030a:	e8 0a 00 00 00       	call   800319 <exit>
+}
+  80030f:	83 c4 10             	add    $0x10,%esp
+  800312:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800315:	5b                   	pop    %ebx
+  800316:	5e                   	pop    %esi
+  800317:	5d                   	pop    %ebp
+  800318:	c3                   	ret
+
+00800319 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800319:	55                   	push   %ebp
+  80031a:	89 e5                	mov    %esp,%ebp
+  80031c:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  80031f:	e8 17 17 00 00       	call   801a3b <close_all>
+  sys_env_destroy(0);
+  800324:	83 ec 0c             	sub    $0xc,%esp
+  800327:	6a 00                	push   $0x0
+  800329:	e8 3b 0a 00 00       	call   800d69 <sys_env_destroy>
+}
+  80032e:	83 c4 10             	add    $0x10,%esp
+  800331:	c9                   	leave
+  800332:	c3                   	ret
+
+00800333 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800333:	55                   	push   %ebp
+  800334:	89 e5                	mov    %esp,%ebp
+  800336:	56                   	push   %esi
+  800337:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  800338:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  80033b:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  800341:	e8 64 0a 00 00       	call   800daa <sys_getenvid>
+  800346:	83 ec 0c             	sub    $0xc,%esp
+  800349:	ff 75 0c             	push   0xc(%ebp)
+  80034c:	ff 75 08             	push   0x8(%ebp)
+  80034f:	56                   	push   %esi
+  800350:	50                   	push   %eax
+  800351:	68 90 3c 80 00       	push   $0x803c90
+  800356:	e8 b3 00 00 00       	call   80040e <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  80035b:	83 c4 18             	add    $0x18,%esp
+  80035e:	53                   	push   %ebx
+  80035f:	ff 75 10             	push   0x10(%ebp)
+  800362:	e8 56 00 00 00       	call   8003bd <vcprintf>
+  cprintf("\n");
+  800367:	c7 04 24 d0 41 80 00 	movl   $0x8041d0,(%esp)
+  80036e:	e8 9b 00 00 00       	call   80040e <cprintf>
+  800373:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  800376:	cc                   	int3
+  while (1)
+  800377:	eb fd                	jmp    800376 <_panic+0x43>
+
+00800379 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800379:	55                   	push   %ebp
+  80037a:	89 e5                	mov    %esp,%ebp
+  80037c:	53                   	push   %ebx
+  80037d:	83 ec 04             	sub    $0x4,%esp
+  800380:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  800383:	8b 13                	mov    (%ebx),%edx
+  800385:	8d 42 01             	lea    0x1(%edx),%eax
+  800388:	89 03                	mov    %eax,(%ebx)
+  80038a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80038d:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  800391:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800396:	74 09                	je     8003a1 <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  800398:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80039c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80039f:	c9                   	leave
+  8003a0:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  8003a1:	83 ec 08             	sub    $0x8,%esp
+  8003a4:	68 ff 00 00 00       	push   $0xff
+  8003a9:	8d 43 08             	lea    0x8(%ebx),%eax
+  8003ac:	50                   	push   %eax
+  8003ad:	e8 7a 09 00 00       	call   800d2c <sys_cputs>
+    b->idx = 0;
+  8003b2:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8003b8:	83 c4 10             	add    $0x10,%esp
+  8003bb:	eb db                	jmp    800398 <putch+0x1f>
+
+008003bd <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8003bd:	55                   	push   %ebp
+  8003be:	89 e5                	mov    %esp,%ebp
+  8003c0:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  8003c6:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8003cd:	00 00 00 
+  b.cnt = 0;
+  8003d0:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8003d7:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  8003da:	ff 75 0c             	push   0xc(%ebp)
+  8003dd:	ff 75 08             	push   0x8(%ebp)
+  8003e0:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8003e6:	50                   	push   %eax
+  8003e7:	68 79 03 80 00       	push   $0x800379
+  8003ec:	e8 14 01 00 00       	call   800505 <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  8003f1:	83 c4 08             	add    $0x8,%esp
+  8003f4:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8003fa:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800400:	50                   	push   %eax
+  800401:	e8 26 09 00 00       	call   800d2c <sys_cputs>
+
+  return b.cnt;
+}
+  800406:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80040c:	c9                   	leave
+  80040d:	c3                   	ret
+
+0080040e <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80040e:	55                   	push   %ebp
+  80040f:	89 e5                	mov    %esp,%ebp
+  800411:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  800414:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  800417:	50                   	push   %eax
+  800418:	ff 75 08             	push   0x8(%ebp)
+  80041b:	e8 9d ff ff ff       	call   8003bd <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  800420:	c9                   	leave
+  800421:	c3                   	ret
+
+00800422 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  800422:	55                   	push   %ebp
+  800423:	89 e5                	mov    %esp,%ebp
+  800425:	57                   	push   %edi
+  800426:	56                   	push   %esi
+  800427:	53                   	push   %ebx
+  800428:	83 ec 1c             	sub    $0x1c,%esp
+  80042b:	89 c7                	mov    %eax,%edi
+  80042d:	89 d6                	mov    %edx,%esi
+  80042f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800432:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800435:	89 d1                	mov    %edx,%ecx
+  800437:	89 c2                	mov    %eax,%edx
+  800439:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80043c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80043f:	8b 45 10             	mov    0x10(%ebp),%eax
+  800442:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  800445:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800448:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80044f:	39 c2                	cmp    %eax,%edx
+  800451:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800454:	72 3e                	jb     800494 <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  800456:	83 ec 0c             	sub    $0xc,%esp
+  800459:	ff 75 18             	push   0x18(%ebp)
+  80045c:	83 eb 01             	sub    $0x1,%ebx
+  80045f:	53                   	push   %ebx
+  800460:	50                   	push   %eax
+  800461:	83 ec 08             	sub    $0x8,%esp
+  800464:	ff 75 e4             	push   -0x1c(%ebp)
+  800467:	ff 75 e0             	push   -0x20(%ebp)
+  80046a:	ff 75 dc             	push   -0x24(%ebp)
+  80046d:	ff 75 d8             	push   -0x28(%ebp)
+  800470:	e8 e1 35 00 00       	call   803a56 <__udivdi3>
+  800475:	83 c4 18             	add    $0x18,%esp
+  800478:	52                   	push   %edx
+  800479:	50                   	push   %eax
+  80047a:	89 f2                	mov    %esi,%edx
+  80047c:	89 f8                	mov    %edi,%eax
+  80047e:	e8 9f ff ff ff       	call   800422 <printnum>
+  800483:	83 c4 20             	add    $0x20,%esp
+  800486:	eb 13                	jmp    80049b <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  800488:	83 ec 08             	sub    $0x8,%esp
+  80048b:	56                   	push   %esi
+  80048c:	ff 75 18             	push   0x18(%ebp)
+  80048f:	ff d7                	call   *%edi
+  800491:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  800494:	83 eb 01             	sub    $0x1,%ebx
+  800497:	85 db                	test   %ebx,%ebx
+  800499:	7f ed                	jg     800488 <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  80049b:	83 ec 08             	sub    $0x8,%esp
+  80049e:	56                   	push   %esi
+  80049f:	83 ec 04             	sub    $0x4,%esp
+  8004a2:	ff 75 e4             	push   -0x1c(%ebp)
+  8004a5:	ff 75 e0             	push   -0x20(%ebp)
+  8004a8:	ff 75 dc             	push   -0x24(%ebp)
+  8004ab:	ff 75 d8             	push   -0x28(%ebp)
+  8004ae:	e8 c4 35 00 00       	call   803a77 <__umoddi3>
+  8004b3:	83 c4 14             	add    $0x14,%esp
+  8004b6:	0f be 80 b3 3c 80 00 	movsbl 0x803cb3(%eax),%eax
+  8004bd:	50                   	push   %eax
+  8004be:	ff d7                	call   *%edi
+}
+  8004c0:	83 c4 10             	add    $0x10,%esp
+  8004c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004c6:	5b                   	pop    %ebx
+  8004c7:	5e                   	pop    %esi
+  8004c8:	5f                   	pop    %edi
+  8004c9:	5d                   	pop    %ebp
+  8004ca:	c3                   	ret
+
+008004cb <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8004cb:	55                   	push   %ebp
+  8004cc:	89 e5                	mov    %esp,%ebp
+  8004ce:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  8004d1:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  8004d5:	8b 10                	mov    (%eax),%edx
+  8004d7:	3b 50 04             	cmp    0x4(%eax),%edx
+  8004da:	73 0a                	jae    8004e6 <sprintputch+0x1b>
+    *b->buf++ = ch;
+  8004dc:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8004df:	89 08                	mov    %ecx,(%eax)
+  8004e1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8004e4:	88 02                	mov    %al,(%edx)
+}
+  8004e6:	5d                   	pop    %ebp
+  8004e7:	c3                   	ret
+
+008004e8 <printfmt>:
+{
+  8004e8:	55                   	push   %ebp
+  8004e9:	89 e5                	mov    %esp,%ebp
+  8004eb:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  8004ee:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  8004f1:	50                   	push   %eax
+  8004f2:	ff 75 10             	push   0x10(%ebp)
+  8004f5:	ff 75 0c             	push   0xc(%ebp)
+  8004f8:	ff 75 08             	push   0x8(%ebp)
+  8004fb:	e8 05 00 00 00       	call   800505 <vprintfmt>
+}
+  800500:	83 c4 10             	add    $0x10,%esp
+  800503:	c9                   	leave
+  800504:	c3                   	ret
+
+00800505 <vprintfmt>:
+{
+  800505:	55                   	push   %ebp
+  800506:	89 e5                	mov    %esp,%ebp
+  800508:	57                   	push   %edi
+  800509:	56                   	push   %esi
+  80050a:	53                   	push   %ebx
+  80050b:	83 ec 2c             	sub    $0x2c,%esp
+  80050e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800511:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800514:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800517:	eb 0a                	jmp    800523 <vprintfmt+0x1e>
+      putch(ch, putdat);
+  800519:	83 ec 08             	sub    $0x8,%esp
+  80051c:	53                   	push   %ebx
+  80051d:	50                   	push   %eax
+  80051e:	ff d6                	call   *%esi
+  800520:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  800523:	83 c7 01             	add    $0x1,%edi
+  800526:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80052a:	83 f8 25             	cmp    $0x25,%eax
+  80052d:	74 0c                	je     80053b <vprintfmt+0x36>
+      if (ch == '\0')
+  80052f:	85 c0                	test   %eax,%eax
+  800531:	75 e6                	jne    800519 <vprintfmt+0x14>
+}
+  800533:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800536:	5b                   	pop    %ebx
+  800537:	5e                   	pop    %esi
+  800538:	5f                   	pop    %edi
+  800539:	5d                   	pop    %ebp
+  80053a:	c3                   	ret
+    padc = ' ';
+  80053b:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  80053f:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  800546:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  80054d:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  800554:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  800559:	8d 47 01             	lea    0x1(%edi),%eax
+  80055c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80055f:	0f b6 17             	movzbl (%edi),%edx
+  800562:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800565:	3c 55                	cmp    $0x55,%al
+  800567:	0f 87 cf 03 00 00    	ja     80093c <vprintfmt+0x437>
+  80056d:	0f b6 c0             	movzbl %al,%eax
+  800570:	ff 24 85 00 3e 80 00 	jmp    *0x803e00(,%eax,4)
+  800577:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  80057a:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80057e:	eb d9                	jmp    800559 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  800580:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800583:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800587:	eb d0                	jmp    800559 <vprintfmt+0x54>
+  800589:	0f b6 d2             	movzbl %dl,%edx
+  80058c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  80058f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800594:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  800597:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80059a:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  80059e:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  8005a1:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8005a4:	83 f9 09             	cmp    $0x9,%ecx
+  8005a7:	77 55                	ja     8005fe <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  8005a9:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  8005ac:	eb e9                	jmp    800597 <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  8005ae:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b1:	8b 00                	mov    (%eax),%eax
+  8005b3:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8005b6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b9:	8d 40 04             	lea    0x4(%eax),%eax
+  8005bc:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  8005bf:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  8005c2:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8005c6:	79 91                	jns    800559 <vprintfmt+0x54>
+        width = precision, precision = -1;
+  8005c8:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8005cb:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005ce:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8005d5:	eb 82                	jmp    800559 <vprintfmt+0x54>
+      if (width < 0)
+  8005d7:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8005da:	85 d2                	test   %edx,%edx
+  8005dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005e1:	0f 49 c2             	cmovns %edx,%eax
+  8005e4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  8005e7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  8005ea:	e9 6a ff ff ff       	jmp    800559 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  8005ef:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  8005f2:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  8005f9:	e9 5b ff ff ff       	jmp    800559 <vprintfmt+0x54>
+  8005fe:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800601:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800604:	eb bc                	jmp    8005c2 <vprintfmt+0xbd>
+      lflag++;
+  800606:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  800609:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  80060c:	e9 48 ff ff ff       	jmp    800559 <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  800611:	8b 45 14             	mov    0x14(%ebp),%eax
+  800614:	8d 78 04             	lea    0x4(%eax),%edi
+  800617:	83 ec 08             	sub    $0x8,%esp
+  80061a:	53                   	push   %ebx
+  80061b:	ff 30                	push   (%eax)
+  80061d:	ff d6                	call   *%esi
+      break;
+  80061f:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  800622:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  800625:	e9 b1 02 00 00       	jmp    8008db <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  80062a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80062d:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  800630:	8b 10                	mov    (%eax),%edx
+  800632:	89 d0                	mov    %edx,%eax
+  800634:	f7 d8                	neg    %eax
+  800636:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800639:	83 f8 10             	cmp    $0x10,%eax
+  80063c:	7f 23                	jg     800661 <vprintfmt+0x15c>
+  80063e:	8b 14 85 60 3f 80 00 	mov    0x803f60(,%eax,4),%edx
+  800645:	85 d2                	test   %edx,%edx
+  800647:	74 18                	je     800661 <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  800649:	52                   	push   %edx
+  80064a:	68 7a 41 80 00       	push   $0x80417a
+  80064f:	53                   	push   %ebx
+  800650:	56                   	push   %esi
+  800651:	e8 92 fe ff ff       	call   8004e8 <printfmt>
+  800656:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  800659:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80065c:	e9 7a 02 00 00       	jmp    8008db <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  800661:	50                   	push   %eax
+  800662:	68 cb 3c 80 00       	push   $0x803ccb
+  800667:	53                   	push   %ebx
+  800668:	56                   	push   %esi
+  800669:	e8 7a fe ff ff       	call   8004e8 <printfmt>
+  80066e:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  800671:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  800674:	e9 62 02 00 00       	jmp    8008db <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  800679:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067c:	83 c0 04             	add    $0x4,%eax
+  80067f:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800682:	8b 45 14             	mov    0x14(%ebp),%eax
+  800685:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  800687:	85 c9                	test   %ecx,%ecx
+  800689:	b8 c4 3c 80 00       	mov    $0x803cc4,%eax
+  80068e:	0f 45 c1             	cmovne %ecx,%eax
+  800691:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  800694:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800698:	7e 06                	jle    8006a0 <vprintfmt+0x19b>
+  80069a:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80069e:	75 0b                	jne    8006ab <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8006a0:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8006a3:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8006a6:	89 75 08             	mov    %esi,0x8(%ebp)
+  8006a9:	eb 5c                	jmp    800707 <vprintfmt+0x202>
+  8006ab:	83 ec 08             	sub    $0x8,%esp
+  8006ae:	ff 75 d0             	push   -0x30(%ebp)
+  8006b1:	ff 75 cc             	push   -0x34(%ebp)
+  8006b4:	e8 20 03 00 00       	call   8009d9 <strnlen>
+  8006b9:	89 c2                	mov    %eax,%edx
+  8006bb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006be:	29 d0                	sub    %edx,%eax
+  8006c0:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  8006c3:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8006c7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006ca:	89 75 08             	mov    %esi,0x8(%ebp)
+  8006cd:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8006cf:	eb 0e                	jmp    8006df <vprintfmt+0x1da>
+          putch(padc, putdat);
+  8006d1:	83 ec 08             	sub    $0x8,%esp
+  8006d4:	53                   	push   %ebx
+  8006d5:	57                   	push   %edi
+  8006d6:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8006d9:	83 ee 01             	sub    $0x1,%esi
+  8006dc:	83 c4 10             	add    $0x10,%esp
+  8006df:	85 f6                	test   %esi,%esi
+  8006e1:	7f ee                	jg     8006d1 <vprintfmt+0x1cc>
+  8006e3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006e6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006e9:	85 c0                	test   %eax,%eax
+  8006eb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006f0:	0f 49 d0             	cmovns %eax,%edx
+  8006f3:	29 d0                	sub    %edx,%eax
+  8006f5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006f8:	eb a6                	jmp    8006a0 <vprintfmt+0x19b>
+          putch(ch, putdat);
+  8006fa:	83 ec 08             	sub    $0x8,%esp
+  8006fd:	53                   	push   %ebx
+  8006fe:	52                   	push   %edx
+  8006ff:	ff 55 08             	call   *0x8(%ebp)
+  800702:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800705:	89 f1                	mov    %esi,%ecx
+  800707:	8d 71 01             	lea    0x1(%ecx),%esi
+  80070a:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80070e:	0f be d0             	movsbl %al,%edx
+  800711:	85 d2                	test   %edx,%edx
+  800713:	74 28                	je     80073d <vprintfmt+0x238>
+  800715:	85 ff                	test   %edi,%edi
+  800717:	78 05                	js     80071e <vprintfmt+0x219>
+  800719:	83 ef 01             	sub    $0x1,%edi
+  80071c:	78 30                	js     80074e <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  80071e:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800722:	74 d6                	je     8006fa <vprintfmt+0x1f5>
+  800724:	0f be c0             	movsbl %al,%eax
+  800727:	83 e8 20             	sub    $0x20,%eax
+  80072a:	83 f8 5e             	cmp    $0x5e,%eax
+  80072d:	76 cb                	jbe    8006fa <vprintfmt+0x1f5>
+          putch('?', putdat);
+  80072f:	83 ec 08             	sub    $0x8,%esp
+  800732:	53                   	push   %ebx
+  800733:	6a 3f                	push   $0x3f
+  800735:	ff 55 08             	call   *0x8(%ebp)
+  800738:	83 c4 10             	add    $0x10,%esp
+  80073b:	eb c8                	jmp    800705 <vprintfmt+0x200>
+  80073d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800740:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800743:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800746:	01 d0                	add    %edx,%eax
+  800748:	29 c8                	sub    %ecx,%eax
+  80074a:	89 c7                	mov    %eax,%edi
+  80074c:	eb 13                	jmp    800761 <vprintfmt+0x25c>
+  80074e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800751:	eb ed                	jmp    800740 <vprintfmt+0x23b>
+        putch(' ', putdat);
+  800753:	83 ec 08             	sub    $0x8,%esp
+  800756:	53                   	push   %ebx
+  800757:	6a 20                	push   $0x20
+  800759:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  80075b:	83 ef 01             	sub    $0x1,%edi
+  80075e:	83 c4 10             	add    $0x10,%esp
+  800761:	85 ff                	test   %edi,%edi
+  800763:	7f ee                	jg     800753 <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  800765:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800768:	89 45 14             	mov    %eax,0x14(%ebp)
+  80076b:	e9 6b 01 00 00       	jmp    8008db <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  800770:	83 f9 01             	cmp    $0x1,%ecx
+  800773:	7f 1f                	jg     800794 <vprintfmt+0x28f>
+  else if (lflag)
+  800775:	85 c9                	test   %ecx,%ecx
+  800777:	74 67                	je     8007e0 <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  800779:	8b 45 14             	mov    0x14(%ebp),%eax
+  80077c:	8b 00                	mov    (%eax),%eax
+  80077e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800781:	89 c1                	mov    %eax,%ecx
+  800783:	c1 f9 1f             	sar    $0x1f,%ecx
+  800786:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800789:	8b 45 14             	mov    0x14(%ebp),%eax
+  80078c:	8d 40 04             	lea    0x4(%eax),%eax
+  80078f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800792:	eb 17                	jmp    8007ab <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  800794:	8b 45 14             	mov    0x14(%ebp),%eax
+  800797:	8b 50 04             	mov    0x4(%eax),%edx
+  80079a:	8b 00                	mov    (%eax),%eax
+  80079c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80079f:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8007a2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a5:	8d 40 08             	lea    0x8(%eax),%eax
+  8007a8:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  8007ab:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8007ae:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  8007b1:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  8007b6:	85 c9                	test   %ecx,%ecx
+  8007b8:	0f 89 03 01 00 00    	jns    8008c1 <vprintfmt+0x3bc>
+        putch('-', putdat);
+  8007be:	83 ec 08             	sub    $0x8,%esp
+  8007c1:	53                   	push   %ebx
+  8007c2:	6a 2d                	push   $0x2d
+  8007c4:	ff d6                	call   *%esi
+        num = -(long long)num;
+  8007c6:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8007c9:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8007cc:	f7 da                	neg    %edx
+  8007ce:	83 d1 00             	adc    $0x0,%ecx
+  8007d1:	f7 d9                	neg    %ecx
+  8007d3:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  8007d6:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8007db:	e9 e1 00 00 00       	jmp    8008c1 <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  8007e0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e3:	8b 00                	mov    (%eax),%eax
+  8007e5:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007e8:	89 c1                	mov    %eax,%ecx
+  8007ea:	c1 f9 1f             	sar    $0x1f,%ecx
+  8007ed:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8007f0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007f3:	8d 40 04             	lea    0x4(%eax),%eax
+  8007f6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007f9:	eb b0                	jmp    8007ab <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  8007fb:	83 f9 01             	cmp    $0x1,%ecx
+  8007fe:	7f 1e                	jg     80081e <vprintfmt+0x319>
+  else if (lflag)
+  800800:	85 c9                	test   %ecx,%ecx
+  800802:	74 32                	je     800836 <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  800804:	8b 45 14             	mov    0x14(%ebp),%eax
+  800807:	8b 10                	mov    (%eax),%edx
+  800809:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80080e:	8d 40 04             	lea    0x4(%eax),%eax
+  800811:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800814:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  800819:	e9 a3 00 00 00       	jmp    8008c1 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  80081e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800821:	8b 10                	mov    (%eax),%edx
+  800823:	8b 48 04             	mov    0x4(%eax),%ecx
+  800826:	8d 40 08             	lea    0x8(%eax),%eax
+  800829:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  80082c:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  800831:	e9 8b 00 00 00       	jmp    8008c1 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800836:	8b 45 14             	mov    0x14(%ebp),%eax
+  800839:	8b 10                	mov    (%eax),%edx
+  80083b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800840:	8d 40 04             	lea    0x4(%eax),%eax
+  800843:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800846:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  80084b:	eb 74                	jmp    8008c1 <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  80084d:	83 f9 01             	cmp    $0x1,%ecx
+  800850:	7f 1b                	jg     80086d <vprintfmt+0x368>
+  else if (lflag)
+  800852:	85 c9                	test   %ecx,%ecx
+  800854:	74 2c                	je     800882 <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  800856:	8b 45 14             	mov    0x14(%ebp),%eax
+  800859:	8b 10                	mov    (%eax),%edx
+  80085b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800860:	8d 40 04             	lea    0x4(%eax),%eax
+  800863:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800866:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  80086b:	eb 54                	jmp    8008c1 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  80086d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800870:	8b 10                	mov    (%eax),%edx
+  800872:	8b 48 04             	mov    0x4(%eax),%ecx
+  800875:	8d 40 08             	lea    0x8(%eax),%eax
+  800878:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  80087b:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  800880:	eb 3f                	jmp    8008c1 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800882:	8b 45 14             	mov    0x14(%ebp),%eax
+  800885:	8b 10                	mov    (%eax),%edx
+  800887:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80088c:	8d 40 04             	lea    0x4(%eax),%eax
+  80088f:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800892:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  800897:	eb 28                	jmp    8008c1 <vprintfmt+0x3bc>
+      putch('0', putdat);
+  800899:	83 ec 08             	sub    $0x8,%esp
+  80089c:	53                   	push   %ebx
+  80089d:	6a 30                	push   $0x30
+  80089f:	ff d6                	call   *%esi
+      putch('x', putdat);
+  8008a1:	83 c4 08             	add    $0x8,%esp
+  8008a4:	53                   	push   %ebx
+  8008a5:	6a 78                	push   $0x78
+  8008a7:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  8008a9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008ac:	8b 10                	mov    (%eax),%edx
+  8008ae:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  8008b3:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  8008b6:	8d 40 04             	lea    0x4(%eax),%eax
+  8008b9:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8008bc:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  8008c1:	83 ec 0c             	sub    $0xc,%esp
+  8008c4:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8008c8:	50                   	push   %eax
+  8008c9:	ff 75 e0             	push   -0x20(%ebp)
+  8008cc:	57                   	push   %edi
+  8008cd:	51                   	push   %ecx
+  8008ce:	52                   	push   %edx
+  8008cf:	89 da                	mov    %ebx,%edx
+  8008d1:	89 f0                	mov    %esi,%eax
+  8008d3:	e8 4a fb ff ff       	call   800422 <printnum>
+      break;
+  8008d8:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  8008db:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  8008de:	e9 40 fc ff ff       	jmp    800523 <vprintfmt+0x1e>
+  if (lflag >= 2)
+  8008e3:	83 f9 01             	cmp    $0x1,%ecx
+  8008e6:	7f 1b                	jg     800903 <vprintfmt+0x3fe>
+  else if (lflag)
+  8008e8:	85 c9                	test   %ecx,%ecx
+  8008ea:	74 2c                	je     800918 <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  8008ec:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008ef:	8b 10                	mov    (%eax),%edx
+  8008f1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008f6:	8d 40 04             	lea    0x4(%eax),%eax
+  8008f9:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8008fc:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  800901:	eb be                	jmp    8008c1 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800903:	8b 45 14             	mov    0x14(%ebp),%eax
+  800906:	8b 10                	mov    (%eax),%edx
+  800908:	8b 48 04             	mov    0x4(%eax),%ecx
+  80090b:	8d 40 08             	lea    0x8(%eax),%eax
+  80090e:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800911:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  800916:	eb a9                	jmp    8008c1 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800918:	8b 45 14             	mov    0x14(%ebp),%eax
+  80091b:	8b 10                	mov    (%eax),%edx
+  80091d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800922:	8d 40 04             	lea    0x4(%eax),%eax
+  800925:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800928:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  80092d:	eb 92                	jmp    8008c1 <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  80092f:	83 ec 08             	sub    $0x8,%esp
+  800932:	53                   	push   %ebx
+  800933:	6a 25                	push   $0x25
+  800935:	ff d6                	call   *%esi
+      break;
+  800937:	83 c4 10             	add    $0x10,%esp
+  80093a:	eb 9f                	jmp    8008db <vprintfmt+0x3d6>
+      putch('%', putdat);
+  80093c:	83 ec 08             	sub    $0x8,%esp
+  80093f:	53                   	push   %ebx
+  800940:	6a 25                	push   $0x25
+  800942:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  800944:	83 c4 10             	add    $0x10,%esp
+  800947:	89 f8                	mov    %edi,%eax
+  800949:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80094d:	74 05                	je     800954 <vprintfmt+0x44f>
+  80094f:	83 e8 01             	sub    $0x1,%eax
+  800952:	eb f5                	jmp    800949 <vprintfmt+0x444>
+  800954:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800957:	eb 82                	jmp    8008db <vprintfmt+0x3d6>
+
+00800959 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800959:	55                   	push   %ebp
+  80095a:	89 e5                	mov    %esp,%ebp
+  80095c:	83 ec 18             	sub    $0x18,%esp
+  80095f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800962:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  800965:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800968:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80096c:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80096f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  800976:	85 c0                	test   %eax,%eax
+  800978:	74 26                	je     8009a0 <vsnprintf+0x47>
+  80097a:	85 d2                	test   %edx,%edx
+  80097c:	7e 22                	jle    8009a0 <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80097e:	ff 75 14             	push   0x14(%ebp)
+  800981:	ff 75 10             	push   0x10(%ebp)
+  800984:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800987:	50                   	push   %eax
+  800988:	68 cb 04 80 00       	push   $0x8004cb
+  80098d:	e8 73 fb ff ff       	call   800505 <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800992:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800995:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  800998:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80099b:	83 c4 10             	add    $0x10,%esp
+}
+  80099e:	c9                   	leave
+  80099f:	c3                   	ret
+    return -E_INVAL;
+  8009a0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8009a5:	eb f7                	jmp    80099e <vsnprintf+0x45>
+
+008009a7 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8009a7:	55                   	push   %ebp
+  8009a8:	89 e5                	mov    %esp,%ebp
+  8009aa:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  8009ad:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  8009b0:	50                   	push   %eax
+  8009b1:	ff 75 10             	push   0x10(%ebp)
+  8009b4:	ff 75 0c             	push   0xc(%ebp)
+  8009b7:	ff 75 08             	push   0x8(%ebp)
+  8009ba:	e8 9a ff ff ff       	call   800959 <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  8009bf:	c9                   	leave
+  8009c0:	c3                   	ret
+
+008009c1 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8009c1:	55                   	push   %ebp
+  8009c2:	89 e5                	mov    %esp,%ebp
+  8009c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  8009c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009cc:	eb 03                	jmp    8009d1 <strlen+0x10>
+    n++;
+  8009ce:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  8009d1:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8009d5:	75 f7                	jne    8009ce <strlen+0xd>
+  return n;
+}
+  8009d7:	5d                   	pop    %ebp
+  8009d8:	c3                   	ret
+
+008009d9 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8009d9:	55                   	push   %ebp
+  8009da:	89 e5                	mov    %esp,%ebp
+  8009dc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8009df:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009e7:	eb 03                	jmp    8009ec <strnlen+0x13>
+    n++;
+  8009e9:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8009ec:	39 d0                	cmp    %edx,%eax
+  8009ee:	74 08                	je     8009f8 <strnlen+0x1f>
+  8009f0:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8009f4:	75 f3                	jne    8009e9 <strnlen+0x10>
+  8009f6:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  8009f8:	89 d0                	mov    %edx,%eax
+  8009fa:	5d                   	pop    %ebp
+  8009fb:	c3                   	ret
+
+008009fc <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8009fc:	55                   	push   %ebp
+  8009fd:	89 e5                	mov    %esp,%ebp
+  8009ff:	53                   	push   %ebx
+  800a00:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a03:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  800a06:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a0b:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800a0f:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800a12:	83 c0 01             	add    $0x1,%eax
+  800a15:	84 d2                	test   %dl,%dl
+  800a17:	75 f2                	jne    800a0b <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  800a19:	89 c8                	mov    %ecx,%eax
+  800a1b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a1e:	c9                   	leave
+  800a1f:	c3                   	ret
+
+00800a20 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800a20:	55                   	push   %ebp
+  800a21:	89 e5                	mov    %esp,%ebp
+  800a23:	53                   	push   %ebx
+  800a24:	83 ec 10             	sub    $0x10,%esp
+  800a27:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  800a2a:	53                   	push   %ebx
+  800a2b:	e8 91 ff ff ff       	call   8009c1 <strlen>
+  800a30:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  800a33:	ff 75 0c             	push   0xc(%ebp)
+  800a36:	01 d8                	add    %ebx,%eax
+  800a38:	50                   	push   %eax
+  800a39:	e8 be ff ff ff       	call   8009fc <strcpy>
+  return dst;
+}
+  800a3e:	89 d8                	mov    %ebx,%eax
+  800a40:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a43:	c9                   	leave
+  800a44:	c3                   	ret
+
+00800a45 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  800a45:	55                   	push   %ebp
+  800a46:	89 e5                	mov    %esp,%ebp
+  800a48:	56                   	push   %esi
+  800a49:	53                   	push   %ebx
+  800a4a:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a4d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  800a50:	89 f3                	mov    %esi,%ebx
+  800a52:	03 5d 10             	add    0x10(%ebp),%ebx
+  800a55:	89 f0                	mov    %esi,%eax
+  800a57:	eb 0f                	jmp    800a68 <strncpy+0x23>
+    *dst++ = *src;
+  800a59:	83 c0 01             	add    $0x1,%eax
+  800a5c:	0f b6 0a             	movzbl (%edx),%ecx
+  800a5f:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  800a62:	80 f9 01             	cmp    $0x1,%cl
+  800a65:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  800a68:	39 d8                	cmp    %ebx,%eax
+  800a6a:	75 ed                	jne    800a59 <strncpy+0x14>
+  }
+  return ret;
+}
+  800a6c:	89 f0                	mov    %esi,%eax
+  800a6e:	5b                   	pop    %ebx
+  800a6f:	5e                   	pop    %esi
+  800a70:	5d                   	pop    %ebp
+  800a71:	c3                   	ret
+
+00800a72 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800a72:	55                   	push   %ebp
+  800a73:	89 e5                	mov    %esp,%ebp
+  800a75:	56                   	push   %esi
+  800a76:	53                   	push   %ebx
+  800a77:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a7a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a7d:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  800a80:	89 f0                	mov    %esi,%eax
+  800a82:	85 d2                	test   %edx,%edx
+  800a84:	74 21                	je     800aa7 <strlcpy+0x35>
+  800a86:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800a8a:	89 f2                	mov    %esi,%edx
+  800a8c:	eb 09                	jmp    800a97 <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  800a8e:	83 c1 01             	add    $0x1,%ecx
+  800a91:	83 c2 01             	add    $0x1,%edx
+  800a94:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  800a97:	39 c2                	cmp    %eax,%edx
+  800a99:	74 09                	je     800aa4 <strlcpy+0x32>
+  800a9b:	0f b6 19             	movzbl (%ecx),%ebx
+  800a9e:	84 db                	test   %bl,%bl
+  800aa0:	75 ec                	jne    800a8e <strlcpy+0x1c>
+  800aa2:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  800aa4:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  800aa7:	29 f0                	sub    %esi,%eax
+}
+  800aa9:	5b                   	pop    %ebx
+  800aaa:	5e                   	pop    %esi
+  800aab:	5d                   	pop    %ebp
+  800aac:	c3                   	ret
+
+00800aad <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800aad:	55                   	push   %ebp
+  800aae:	89 e5                	mov    %esp,%ebp
+  800ab0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ab3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  800ab6:	eb 06                	jmp    800abe <strcmp+0x11>
+    p++, q++;
+  800ab8:	83 c1 01             	add    $0x1,%ecx
+  800abb:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  800abe:	0f b6 01             	movzbl (%ecx),%eax
+  800ac1:	84 c0                	test   %al,%al
+  800ac3:	74 04                	je     800ac9 <strcmp+0x1c>
+  800ac5:	3a 02                	cmp    (%edx),%al
+  800ac7:	74 ef                	je     800ab8 <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  800ac9:	0f b6 c0             	movzbl %al,%eax
+  800acc:	0f b6 12             	movzbl (%edx),%edx
+  800acf:	29 d0                	sub    %edx,%eax
+}
+  800ad1:	5d                   	pop    %ebp
+  800ad2:	c3                   	ret
+
+00800ad3 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800ad3:	55                   	push   %ebp
+  800ad4:	89 e5                	mov    %esp,%ebp
+  800ad6:	53                   	push   %ebx
+  800ad7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ada:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800add:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  800ae0:	eb 09                	jmp    800aeb <strncmp+0x18>
+    n--, p++, q++;
+  800ae2:	83 ea 01             	sub    $0x1,%edx
+  800ae5:	83 c0 01             	add    $0x1,%eax
+  800ae8:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  800aeb:	85 d2                	test   %edx,%edx
+  800aed:	74 18                	je     800b07 <strncmp+0x34>
+  800aef:	0f b6 18             	movzbl (%eax),%ebx
+  800af2:	84 db                	test   %bl,%bl
+  800af4:	74 04                	je     800afa <strncmp+0x27>
+  800af6:	3a 19                	cmp    (%ecx),%bl
+  800af8:	74 e8                	je     800ae2 <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800afa:	0f b6 00             	movzbl (%eax),%eax
+  800afd:	0f b6 11             	movzbl (%ecx),%edx
+  800b00:	29 d0                	sub    %edx,%eax
+}
+  800b02:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b05:	c9                   	leave
+  800b06:	c3                   	ret
+    return 0;
+  800b07:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b0c:	eb f4                	jmp    800b02 <strncmp+0x2f>
+
+00800b0e <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800b0e:	55                   	push   %ebp
+  800b0f:	89 e5                	mov    %esp,%ebp
+  800b11:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b14:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800b18:	eb 03                	jmp    800b1d <strchr+0xf>
+  800b1a:	83 c0 01             	add    $0x1,%eax
+  800b1d:	0f b6 10             	movzbl (%eax),%edx
+  800b20:	84 d2                	test   %dl,%dl
+  800b22:	74 06                	je     800b2a <strchr+0x1c>
+    if (*s == c)
+  800b24:	38 ca                	cmp    %cl,%dl
+  800b26:	75 f2                	jne    800b1a <strchr+0xc>
+  800b28:	eb 05                	jmp    800b2f <strchr+0x21>
+      return (char*)s;
+  return 0;
+  800b2a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b2f:	5d                   	pop    %ebp
+  800b30:	c3                   	ret
+
+00800b31 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800b31:	55                   	push   %ebp
+  800b32:	89 e5                	mov    %esp,%ebp
+  800b34:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b37:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800b3b:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  800b3e:	38 ca                	cmp    %cl,%dl
+  800b40:	74 09                	je     800b4b <strfind+0x1a>
+  800b42:	84 d2                	test   %dl,%dl
+  800b44:	74 05                	je     800b4b <strfind+0x1a>
+  for (; *s; s++)
+  800b46:	83 c0 01             	add    $0x1,%eax
+  800b49:	eb f0                	jmp    800b3b <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  800b4b:	5d                   	pop    %ebp
+  800b4c:	c3                   	ret
+
+00800b4d <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800b4d:	55                   	push   %ebp
+  800b4e:	89 e5                	mov    %esp,%ebp
+  800b50:	57                   	push   %edi
+  800b51:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b54:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  800b57:	85 c9                	test   %ecx,%ecx
+  800b59:	74 20                	je     800b7b <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  800b5b:	89 f8                	mov    %edi,%eax
+  800b5d:	09 c8                	or     %ecx,%eax
+  800b5f:	a8 03                	test   $0x3,%al
+  800b61:	75 12                	jne    800b75 <memset+0x28>
+    c &= 0xFF;
+  800b63:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800b67:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  800b6d:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  800b70:	fc                   	cld
+  800b71:	f3 ab                	rep stos %eax,%es:(%edi)
+  800b73:	eb 06                	jmp    800b7b <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  800b75:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b78:	fc                   	cld
+  800b79:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  800b7b:	89 f8                	mov    %edi,%eax
+  800b7d:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800b80:	c9                   	leave
+  800b81:	c3                   	ret
+
+00800b82 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800b82:	55                   	push   %ebp
+  800b83:	89 e5                	mov    %esp,%ebp
+  800b85:	57                   	push   %edi
+  800b86:	56                   	push   %esi
+  800b87:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b8a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b8d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  800b90:	39 c6                	cmp    %eax,%esi
+  800b92:	73 32                	jae    800bc6 <memmove+0x44>
+  800b94:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800b97:	39 d0                	cmp    %edx,%eax
+  800b99:	73 2b                	jae    800bc6 <memmove+0x44>
+    s += n;
+    d += n;
+  800b9b:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b9e:	89 d6                	mov    %edx,%esi
+  800ba0:	09 fe                	or     %edi,%esi
+  800ba2:	09 ce                	or     %ecx,%esi
+  800ba4:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800baa:	75 0e                	jne    800bba <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800bac:	83 ef 04             	sub    $0x4,%edi
+  800baf:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800bb2:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  800bb5:	fd                   	std
+  800bb6:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800bb8:	eb 09                	jmp    800bc3 <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800bba:	83 ef 01             	sub    $0x1,%edi
+  800bbd:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  800bc0:	fd                   	std
+  800bc1:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  800bc3:	fc                   	cld
+  800bc4:	eb 1a                	jmp    800be0 <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800bc6:	89 f2                	mov    %esi,%edx
+  800bc8:	09 c2                	or     %eax,%edx
+  800bca:	09 ca                	or     %ecx,%edx
+  800bcc:	f6 c2 03             	test   $0x3,%dl
+  800bcf:	75 0a                	jne    800bdb <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800bd1:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  800bd4:	89 c7                	mov    %eax,%edi
+  800bd6:	fc                   	cld
+  800bd7:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800bd9:	eb 05                	jmp    800be0 <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  800bdb:	89 c7                	mov    %eax,%edi
+  800bdd:	fc                   	cld
+  800bde:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  800be0:	5e                   	pop    %esi
+  800be1:	5f                   	pop    %edi
+  800be2:	5d                   	pop    %ebp
+  800be3:	c3                   	ret
+
+00800be4 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800be4:	55                   	push   %ebp
+  800be5:	89 e5                	mov    %esp,%ebp
+  800be7:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  800bea:	ff 75 10             	push   0x10(%ebp)
+  800bed:	ff 75 0c             	push   0xc(%ebp)
+  800bf0:	ff 75 08             	push   0x8(%ebp)
+  800bf3:	e8 8a ff ff ff       	call   800b82 <memmove>
+}
+  800bf8:	c9                   	leave
+  800bf9:	c3                   	ret
+
+00800bfa <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800bfa:	55                   	push   %ebp
+  800bfb:	89 e5                	mov    %esp,%ebp
+  800bfd:	56                   	push   %esi
+  800bfe:	53                   	push   %ebx
+  800bff:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c02:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  800c05:	89 c6                	mov    %eax,%esi
+  800c07:	03 75 10             	add    0x10(%ebp),%esi
+  800c0a:	eb 06                	jmp    800c12 <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  800c0c:	83 c0 01             	add    $0x1,%eax
+  800c0f:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  800c12:	39 f0                	cmp    %esi,%eax
+  800c14:	74 14                	je     800c2a <memcmp+0x30>
+    if (*s1 != *s2)
+  800c16:	0f b6 08             	movzbl (%eax),%ecx
+  800c19:	0f b6 1a             	movzbl (%edx),%ebx
+  800c1c:	38 d9                	cmp    %bl,%cl
+  800c1e:	74 ec                	je     800c0c <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  800c20:	0f b6 c1             	movzbl %cl,%eax
+  800c23:	0f b6 db             	movzbl %bl,%ebx
+  800c26:	29 d8                	sub    %ebx,%eax
+  800c28:	eb 05                	jmp    800c2f <memcmp+0x35>
+  }
+
+  return 0;
+  800c2a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c2f:	5b                   	pop    %ebx
+  800c30:	5e                   	pop    %esi
+  800c31:	5d                   	pop    %ebp
+  800c32:	c3                   	ret
+
+00800c33 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800c33:	55                   	push   %ebp
+  800c34:	89 e5                	mov    %esp,%ebp
+  800c36:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c39:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  800c3c:	89 c2                	mov    %eax,%edx
+  800c3e:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  800c41:	eb 03                	jmp    800c46 <memfind+0x13>
+  800c43:	83 c0 01             	add    $0x1,%eax
+  800c46:	39 d0                	cmp    %edx,%eax
+  800c48:	73 04                	jae    800c4e <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  800c4a:	38 08                	cmp    %cl,(%eax)
+  800c4c:	75 f5                	jne    800c43 <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  800c4e:	5d                   	pop    %ebp
+  800c4f:	c3                   	ret
+
+00800c50 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800c50:	55                   	push   %ebp
+  800c51:	89 e5                	mov    %esp,%ebp
+  800c53:	57                   	push   %edi
+  800c54:	56                   	push   %esi
+  800c55:	53                   	push   %ebx
+  800c56:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c59:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  800c5c:	eb 03                	jmp    800c61 <strtol+0x11>
+    s++;
+  800c5e:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  800c61:	0f b6 02             	movzbl (%edx),%eax
+  800c64:	3c 20                	cmp    $0x20,%al
+  800c66:	74 f6                	je     800c5e <strtol+0xe>
+  800c68:	3c 09                	cmp    $0x9,%al
+  800c6a:	74 f2                	je     800c5e <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  800c6c:	3c 2b                	cmp    $0x2b,%al
+  800c6e:	74 2a                	je     800c9a <strtol+0x4a>
+  int neg = 0;
+  800c70:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  800c75:	3c 2d                	cmp    $0x2d,%al
+  800c77:	74 2b                	je     800ca4 <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c79:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800c7f:	75 0f                	jne    800c90 <strtol+0x40>
+  800c81:	80 3a 30             	cmpb   $0x30,(%edx)
+  800c84:	74 28                	je     800cae <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  800c86:	85 db                	test   %ebx,%ebx
+  800c88:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c8d:	0f 44 d8             	cmove  %eax,%ebx
+  800c90:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c95:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800c98:	eb 46                	jmp    800ce0 <strtol+0x90>
+    s++;
+  800c9a:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  800c9d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ca2:	eb d5                	jmp    800c79 <strtol+0x29>
+    s++, neg = 1;
+  800ca4:	83 c2 01             	add    $0x1,%edx
+  800ca7:	bf 01 00 00 00       	mov    $0x1,%edi
+  800cac:	eb cb                	jmp    800c79 <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800cae:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800cb2:	74 0e                	je     800cc2 <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  800cb4:	85 db                	test   %ebx,%ebx
+  800cb6:	75 d8                	jne    800c90 <strtol+0x40>
+    s++, base = 8;
+  800cb8:	83 c2 01             	add    $0x1,%edx
+  800cbb:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800cc0:	eb ce                	jmp    800c90 <strtol+0x40>
+    s += 2, base = 16;
+  800cc2:	83 c2 02             	add    $0x2,%edx
+  800cc5:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800cca:	eb c4                	jmp    800c90 <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  800ccc:	0f be c0             	movsbl %al,%eax
+  800ccf:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  800cd2:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800cd5:	7d 3a                	jge    800d11 <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  800cd7:	83 c2 01             	add    $0x1,%edx
+  800cda:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800cde:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  800ce0:	0f b6 02             	movzbl (%edx),%eax
+  800ce3:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800ce6:	89 f3                	mov    %esi,%ebx
+  800ce8:	80 fb 09             	cmp    $0x9,%bl
+  800ceb:	76 df                	jbe    800ccc <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  800ced:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800cf0:	89 f3                	mov    %esi,%ebx
+  800cf2:	80 fb 19             	cmp    $0x19,%bl
+  800cf5:	77 08                	ja     800cff <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  800cf7:	0f be c0             	movsbl %al,%eax
+  800cfa:	83 e8 57             	sub    $0x57,%eax
+  800cfd:	eb d3                	jmp    800cd2 <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  800cff:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800d02:	89 f3                	mov    %esi,%ebx
+  800d04:	80 fb 19             	cmp    $0x19,%bl
+  800d07:	77 08                	ja     800d11 <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  800d09:	0f be c0             	movsbl %al,%eax
+  800d0c:	83 e8 37             	sub    $0x37,%eax
+  800d0f:	eb c1                	jmp    800cd2 <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  800d11:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800d15:	74 05                	je     800d1c <strtol+0xcc>
+    *endptr = (char*)s;
+  800d17:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d1a:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  800d1c:	89 c8                	mov    %ecx,%eax
+  800d1e:	f7 d8                	neg    %eax
+  800d20:	85 ff                	test   %edi,%edi
+  800d22:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800d25:	89 c8                	mov    %ecx,%eax
+  800d27:	5b                   	pop    %ebx
+  800d28:	5e                   	pop    %esi
+  800d29:	5f                   	pop    %edi
+  800d2a:	5d                   	pop    %ebp
+  800d2b:	c3                   	ret
+
+00800d2c <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800d2c:	55                   	push   %ebp
+  800d2d:	89 e5                	mov    %esp,%ebp
+  800d2f:	57                   	push   %edi
+  800d30:	56                   	push   %esi
+  800d31:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d32:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d37:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d3a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d3d:	89 c3                	mov    %eax,%ebx
+  800d3f:	89 c7                	mov    %eax,%edi
+  800d41:	89 c6                	mov    %eax,%esi
+  800d43:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800d45:	5b                   	pop    %ebx
+  800d46:	5e                   	pop    %esi
+  800d47:	5f                   	pop    %edi
+  800d48:	5d                   	pop    %ebp
+  800d49:	c3                   	ret
+
+00800d4a <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800d4a:	55                   	push   %ebp
+  800d4b:	89 e5                	mov    %esp,%ebp
+  800d4d:	57                   	push   %edi
+  800d4e:	56                   	push   %esi
+  800d4f:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d50:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d55:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d5a:	89 d1                	mov    %edx,%ecx
+  800d5c:	89 d3                	mov    %edx,%ebx
+  800d5e:	89 d7                	mov    %edx,%edi
+  800d60:	89 d6                	mov    %edx,%esi
+  800d62:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800d64:	5b                   	pop    %ebx
+  800d65:	5e                   	pop    %esi
+  800d66:	5f                   	pop    %edi
+  800d67:	5d                   	pop    %ebp
+  800d68:	c3                   	ret
+
+00800d69 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800d69:	55                   	push   %ebp
+  800d6a:	89 e5                	mov    %esp,%ebp
+  800d6c:	57                   	push   %edi
+  800d6d:	56                   	push   %esi
+  800d6e:	53                   	push   %ebx
+  800d6f:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800d72:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d77:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d7a:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d7f:	89 cb                	mov    %ecx,%ebx
+  800d81:	89 cf                	mov    %ecx,%edi
+  800d83:	89 ce                	mov    %ecx,%esi
+  800d85:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d87:	85 c0                	test   %eax,%eax
+  800d89:	7f 08                	jg     800d93 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800d8b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d8e:	5b                   	pop    %ebx
+  800d8f:	5e                   	pop    %esi
+  800d90:	5f                   	pop    %edi
+  800d91:	5d                   	pop    %ebp
+  800d92:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d93:	83 ec 0c             	sub    $0xc,%esp
+  800d96:	50                   	push   %eax
+  800d97:	6a 03                	push   $0x3
+  800d99:	68 c3 3f 80 00       	push   $0x803fc3
+  800d9e:	6a 23                	push   $0x23
+  800da0:	68 e0 3f 80 00       	push   $0x803fe0
+  800da5:	e8 89 f5 ff ff       	call   800333 <_panic>
+
+00800daa <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800daa:	55                   	push   %ebp
+  800dab:	89 e5                	mov    %esp,%ebp
+  800dad:	57                   	push   %edi
+  800dae:	56                   	push   %esi
+  800daf:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800db0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800db5:	b8 02 00 00 00       	mov    $0x2,%eax
+  800dba:	89 d1                	mov    %edx,%ecx
+  800dbc:	89 d3                	mov    %edx,%ebx
+  800dbe:	89 d7                	mov    %edx,%edi
+  800dc0:	89 d6                	mov    %edx,%esi
+  800dc2:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800dc4:	5b                   	pop    %ebx
+  800dc5:	5e                   	pop    %esi
+  800dc6:	5f                   	pop    %edi
+  800dc7:	5d                   	pop    %ebp
+  800dc8:	c3                   	ret
+
+00800dc9 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800dc9:	55                   	push   %ebp
+  800dca:	89 e5                	mov    %esp,%ebp
+  800dcc:	57                   	push   %edi
+  800dcd:	56                   	push   %esi
+  800dce:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800dcf:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dd4:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800dd9:	89 d1                	mov    %edx,%ecx
+  800ddb:	89 d3                	mov    %edx,%ebx
+  800ddd:	89 d7                	mov    %edx,%edi
+  800ddf:	89 d6                	mov    %edx,%esi
+  800de1:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800de3:	5b                   	pop    %ebx
+  800de4:	5e                   	pop    %esi
+  800de5:	5f                   	pop    %edi
+  800de6:	5d                   	pop    %ebp
+  800de7:	c3                   	ret
+
+00800de8 <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  800de8:	55                   	push   %ebp
+  800de9:	89 e5                	mov    %esp,%ebp
+  800deb:	57                   	push   %edi
+  800dec:	56                   	push   %esi
+  800ded:	53                   	push   %ebx
+  800dee:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  800df1:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  800df5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dfa:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dfd:	b8 14 00 00 00       	mov    $0x14,%eax
+  800e02:	89 df                	mov    %ebx,%edi
+  800e04:	89 de                	mov    %ebx,%esi
+  800e06:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e08:	85 c0                	test   %eax,%eax
+  800e0a:	7f 08                	jg     800e14 <sys_env_set_cow+0x2c>
+}
+  800e0c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e0f:	5b                   	pop    %ebx
+  800e10:	5e                   	pop    %esi
+  800e11:	5f                   	pop    %edi
+  800e12:	5d                   	pop    %ebp
+  800e13:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e14:	83 ec 0c             	sub    $0xc,%esp
+  800e17:	50                   	push   %eax
+  800e18:	6a 14                	push   $0x14
+  800e1a:	68 c3 3f 80 00       	push   $0x803fc3
+  800e1f:	6a 23                	push   $0x23
+  800e21:	68 e0 3f 80 00       	push   $0x803fe0
+  800e26:	e8 08 f5 ff ff       	call   800333 <_panic>
+
+00800e2b <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800e2b:	55                   	push   %ebp
+  800e2c:	89 e5                	mov    %esp,%ebp
+  800e2e:	57                   	push   %edi
+  800e2f:	56                   	push   %esi
+  800e30:	53                   	push   %ebx
+  800e31:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e34:	be 00 00 00 00       	mov    $0x0,%esi
+  800e39:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e3c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e3f:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e44:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e47:	89 f7                	mov    %esi,%edi
+  800e49:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e4b:	85 c0                	test   %eax,%eax
+  800e4d:	7f 08                	jg     800e57 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  800e4f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e52:	5b                   	pop    %ebx
+  800e53:	5e                   	pop    %esi
+  800e54:	5f                   	pop    %edi
+  800e55:	5d                   	pop    %ebp
+  800e56:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e57:	83 ec 0c             	sub    $0xc,%esp
+  800e5a:	50                   	push   %eax
+  800e5b:	6a 04                	push   $0x4
+  800e5d:	68 c3 3f 80 00       	push   $0x803fc3
+  800e62:	6a 23                	push   $0x23
+  800e64:	68 e0 3f 80 00       	push   $0x803fe0
+  800e69:	e8 c5 f4 ff ff       	call   800333 <_panic>
+
+00800e6e <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800e6e:	55                   	push   %ebp
+  800e6f:	89 e5                	mov    %esp,%ebp
+  800e71:	57                   	push   %edi
+  800e72:	56                   	push   %esi
+  800e73:	53                   	push   %ebx
+  800e74:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e77:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e7a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e7d:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e82:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e85:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e88:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e8b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e8d:	85 c0                	test   %eax,%eax
+  800e8f:	7f 08                	jg     800e99 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  800e91:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e94:	5b                   	pop    %ebx
+  800e95:	5e                   	pop    %esi
+  800e96:	5f                   	pop    %edi
+  800e97:	5d                   	pop    %ebp
+  800e98:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e99:	83 ec 0c             	sub    $0xc,%esp
+  800e9c:	50                   	push   %eax
+  800e9d:	6a 05                	push   $0x5
+  800e9f:	68 c3 3f 80 00       	push   $0x803fc3
+  800ea4:	6a 23                	push   $0x23
+  800ea6:	68 e0 3f 80 00       	push   $0x803fe0
+  800eab:	e8 83 f4 ff ff       	call   800333 <_panic>
+
+00800eb0 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800eb0:	55                   	push   %ebp
+  800eb1:	89 e5                	mov    %esp,%ebp
+  800eb3:	57                   	push   %edi
+  800eb4:	56                   	push   %esi
+  800eb5:	53                   	push   %ebx
+  800eb6:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800eb9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ebe:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ec4:	b8 06 00 00 00       	mov    $0x6,%eax
+  800ec9:	89 df                	mov    %ebx,%edi
+  800ecb:	89 de                	mov    %ebx,%esi
+  800ecd:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ecf:	85 c0                	test   %eax,%eax
+  800ed1:	7f 08                	jg     800edb <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  800ed3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ed6:	5b                   	pop    %ebx
+  800ed7:	5e                   	pop    %esi
+  800ed8:	5f                   	pop    %edi
+  800ed9:	5d                   	pop    %ebp
+  800eda:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800edb:	83 ec 0c             	sub    $0xc,%esp
+  800ede:	50                   	push   %eax
+  800edf:	6a 06                	push   $0x6
+  800ee1:	68 c3 3f 80 00       	push   $0x803fc3
+  800ee6:	6a 23                	push   $0x23
+  800ee8:	68 e0 3f 80 00       	push   $0x803fe0
+  800eed:	e8 41 f4 ff ff       	call   800333 <_panic>
+
+00800ef2 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  800ef2:	55                   	push   %ebp
+  800ef3:	89 e5                	mov    %esp,%ebp
+  800ef5:	57                   	push   %edi
+  800ef6:	56                   	push   %esi
+  800ef7:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800ef8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800efb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800efe:	b8 11 00 00 00       	mov    $0x11,%eax
+  800f03:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f06:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f09:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f0c:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  800f0e:	5b                   	pop    %ebx
+  800f0f:	5e                   	pop    %esi
+  800f10:	5f                   	pop    %edi
+  800f11:	5d                   	pop    %ebp
+  800f12:	c3                   	ret
+
+00800f13 <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  800f13:	55                   	push   %ebp
+  800f14:	89 e5                	mov    %esp,%ebp
+  800f16:	57                   	push   %edi
+  800f17:	56                   	push   %esi
+  800f18:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f19:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f1c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f1f:	b8 12 00 00 00       	mov    $0x12,%eax
+  800f24:	be 00 00 00 00       	mov    $0x0,%esi
+  800f29:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f2c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f2f:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  800f31:	5b                   	pop    %ebx
+  800f32:	5e                   	pop    %esi
+  800f33:	5f                   	pop    %edi
+  800f34:	5d                   	pop    %ebp
+  800f35:	c3                   	ret
+
+00800f36 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  800f36:	55                   	push   %ebp
+  800f37:	89 e5                	mov    %esp,%ebp
+  800f39:	57                   	push   %edi
+  800f3a:	56                   	push   %esi
+  800f3b:	53                   	push   %ebx
+  800f3c:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f3f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f44:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f47:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f4a:	b8 16 00 00 00       	mov    $0x16,%eax
+  800f4f:	89 df                	mov    %ebx,%edi
+  800f51:	89 de                	mov    %ebx,%esi
+  800f53:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f55:	85 c0                	test   %eax,%eax
+  800f57:	7f 08                	jg     800f61 <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  800f59:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f5c:	5b                   	pop    %ebx
+  800f5d:	5e                   	pop    %esi
+  800f5e:	5f                   	pop    %edi
+  800f5f:	5d                   	pop    %ebp
+  800f60:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f61:	83 ec 0c             	sub    $0xc,%esp
+  800f64:	50                   	push   %eax
+  800f65:	6a 16                	push   $0x16
+  800f67:	68 c3 3f 80 00       	push   $0x803fc3
+  800f6c:	6a 23                	push   $0x23
+  800f6e:	68 e0 3f 80 00       	push   $0x803fe0
+  800f73:	e8 bb f3 ff ff       	call   800333 <_panic>
+
+00800f78 <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  800f78:	55                   	push   %ebp
+  800f79:	89 e5                	mov    %esp,%ebp
+  800f7b:	57                   	push   %edi
+  800f7c:	56                   	push   %esi
+  800f7d:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f7e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f83:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f86:	b8 17 00 00 00       	mov    $0x17,%eax
+  800f8b:	89 cb                	mov    %ecx,%ebx
+  800f8d:	89 cf                	mov    %ecx,%edi
+  800f8f:	89 ce                	mov    %ecx,%esi
+  800f91:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  800f93:	5b                   	pop    %ebx
+  800f94:	5e                   	pop    %esi
+  800f95:	5f                   	pop    %edi
+  800f96:	5d                   	pop    %ebp
+  800f97:	c3                   	ret
+
+00800f98 <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  800f98:	55                   	push   %ebp
+  800f99:	89 e5                	mov    %esp,%ebp
+  800f9b:	57                   	push   %edi
+  800f9c:	56                   	push   %esi
+  800f9d:	53                   	push   %ebx
+  800f9e:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800fa1:	be 00 00 00 00       	mov    $0x0,%esi
+  800fa6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fac:	b8 18 00 00 00       	mov    $0x18,%eax
+  800fb1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fb4:	89 f7                	mov    %esi,%edi
+  800fb6:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800fb8:	85 c0                	test   %eax,%eax
+  800fba:	7f 08                	jg     800fc4 <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  800fbc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fbf:	5b                   	pop    %ebx
+  800fc0:	5e                   	pop    %esi
+  800fc1:	5f                   	pop    %edi
+  800fc2:	5d                   	pop    %ebp
+  800fc3:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800fc4:	83 ec 0c             	sub    $0xc,%esp
+  800fc7:	50                   	push   %eax
+  800fc8:	6a 18                	push   $0x18
+  800fca:	68 c3 3f 80 00       	push   $0x803fc3
+  800fcf:	6a 23                	push   $0x23
+  800fd1:	68 e0 3f 80 00       	push   $0x803fe0
+  800fd6:	e8 58 f3 ff ff       	call   800333 <_panic>
+
+00800fdb <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  800fdb:	55                   	push   %ebp
+  800fdc:	89 e5                	mov    %esp,%ebp
+  800fde:	57                   	push   %edi
+  800fdf:	56                   	push   %esi
+  800fe0:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800fe1:	be 00 00 00 00       	mov    $0x0,%esi
+  800fe6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fec:	b8 19 00 00 00       	mov    $0x19,%eax
+  800ff1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ff4:	89 f7                	mov    %esi,%edi
+  800ff6:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  800ff8:	5b                   	pop    %ebx
+  800ff9:	5e                   	pop    %esi
+  800ffa:	5f                   	pop    %edi
+  800ffb:	5d                   	pop    %ebp
+  800ffc:	c3                   	ret
+
+00800ffd <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  800ffd:	55                   	push   %ebp
+  800ffe:	89 e5                	mov    %esp,%ebp
+  801000:	57                   	push   %edi
+  801001:	56                   	push   %esi
+  801002:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801003:	ba 00 00 00 00       	mov    $0x0,%edx
+  801008:	b8 15 00 00 00       	mov    $0x15,%eax
+  80100d:	89 d1                	mov    %edx,%ecx
+  80100f:	89 d3                	mov    %edx,%ebx
+  801011:	89 d7                	mov    %edx,%edi
+  801013:	89 d6                	mov    %edx,%esi
+  801015:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  801017:	5b                   	pop    %ebx
+  801018:	5e                   	pop    %esi
+  801019:	5f                   	pop    %edi
+  80101a:	5d                   	pop    %ebp
+  80101b:	c3                   	ret
+
+0080101c <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  80101c:	55                   	push   %ebp
+  80101d:	89 e5                	mov    %esp,%ebp
+  80101f:	57                   	push   %edi
+  801020:	56                   	push   %esi
+  801021:	53                   	push   %ebx
+  801022:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801025:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80102a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80102d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801030:	b8 08 00 00 00       	mov    $0x8,%eax
+  801035:	89 df                	mov    %ebx,%edi
+  801037:	89 de                	mov    %ebx,%esi
+  801039:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80103b:	85 c0                	test   %eax,%eax
+  80103d:	7f 08                	jg     801047 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  80103f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801042:	5b                   	pop    %ebx
+  801043:	5e                   	pop    %esi
+  801044:	5f                   	pop    %edi
+  801045:	5d                   	pop    %ebp
+  801046:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801047:	83 ec 0c             	sub    $0xc,%esp
+  80104a:	50                   	push   %eax
+  80104b:	6a 08                	push   $0x8
+  80104d:	68 c3 3f 80 00       	push   $0x803fc3
+  801052:	6a 23                	push   $0x23
+  801054:	68 e0 3f 80 00       	push   $0x803fe0
+  801059:	e8 d5 f2 ff ff       	call   800333 <_panic>
+
+0080105e <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80105e:	55                   	push   %ebp
+  80105f:	89 e5                	mov    %esp,%ebp
+  801061:	57                   	push   %edi
+  801062:	56                   	push   %esi
+  801063:	53                   	push   %ebx
+  801064:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801067:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80106c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80106f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801072:	b8 09 00 00 00       	mov    $0x9,%eax
+  801077:	89 df                	mov    %ebx,%edi
+  801079:	89 de                	mov    %ebx,%esi
+  80107b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80107d:	85 c0                	test   %eax,%eax
+  80107f:	7f 08                	jg     801089 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  801081:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801084:	5b                   	pop    %ebx
+  801085:	5e                   	pop    %esi
+  801086:	5f                   	pop    %edi
+  801087:	5d                   	pop    %ebp
+  801088:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801089:	83 ec 0c             	sub    $0xc,%esp
+  80108c:	50                   	push   %eax
+  80108d:	6a 09                	push   $0x9
+  80108f:	68 c3 3f 80 00       	push   $0x803fc3
+  801094:	6a 23                	push   $0x23
+  801096:	68 e0 3f 80 00       	push   $0x803fe0
+  80109b:	e8 93 f2 ff ff       	call   800333 <_panic>
+
+008010a0 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8010a0:	55                   	push   %ebp
+  8010a1:	89 e5                	mov    %esp,%ebp
+  8010a3:	57                   	push   %edi
+  8010a4:	56                   	push   %esi
+  8010a5:	53                   	push   %ebx
+  8010a6:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8010a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010ae:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010b4:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010b9:	89 df                	mov    %ebx,%edi
+  8010bb:	89 de                	mov    %ebx,%esi
+  8010bd:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8010bf:	85 c0                	test   %eax,%eax
+  8010c1:	7f 08                	jg     8010cb <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  8010c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010c6:	5b                   	pop    %ebx
+  8010c7:	5e                   	pop    %esi
+  8010c8:	5f                   	pop    %edi
+  8010c9:	5d                   	pop    %ebp
+  8010ca:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8010cb:	83 ec 0c             	sub    $0xc,%esp
+  8010ce:	50                   	push   %eax
+  8010cf:	6a 0a                	push   $0xa
+  8010d1:	68 c3 3f 80 00       	push   $0x803fc3
+  8010d6:	6a 23                	push   $0x23
+  8010d8:	68 e0 3f 80 00       	push   $0x803fe0
+  8010dd:	e8 51 f2 ff ff       	call   800333 <_panic>
+
+008010e2 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  8010e2:	55                   	push   %ebp
+  8010e3:	89 e5                	mov    %esp,%ebp
+  8010e5:	57                   	push   %edi
+  8010e6:	56                   	push   %esi
+  8010e7:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8010e8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010eb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ee:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010f3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010f6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010f9:	8b 75 18             	mov    0x18(%ebp),%esi
+  8010fc:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  8010fe:	5b                   	pop    %ebx
+  8010ff:	5e                   	pop    %esi
+  801100:	5f                   	pop    %edi
+  801101:	5d                   	pop    %ebp
+  801102:	c3                   	ret
+
+00801103 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  801103:	55                   	push   %ebp
+  801104:	89 e5                	mov    %esp,%ebp
+  801106:	57                   	push   %edi
+  801107:	56                   	push   %esi
+  801108:	53                   	push   %ebx
+  801109:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80110c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801111:	8b 55 08             	mov    0x8(%ebp),%edx
+  801114:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801117:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80111c:	89 df                	mov    %ebx,%edi
+  80111e:	89 de                	mov    %ebx,%esi
+  801120:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801122:	85 c0                	test   %eax,%eax
+  801124:	7f 08                	jg     80112e <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  801126:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801129:	5b                   	pop    %ebx
+  80112a:	5e                   	pop    %esi
+  80112b:	5f                   	pop    %edi
+  80112c:	5d                   	pop    %ebp
+  80112d:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80112e:	83 ec 0c             	sub    $0xc,%esp
+  801131:	50                   	push   %eax
+  801132:	6a 0d                	push   $0xd
+  801134:	68 c3 3f 80 00       	push   $0x803fc3
+  801139:	6a 23                	push   $0x23
+  80113b:	68 e0 3f 80 00       	push   $0x803fe0
+  801140:	e8 ee f1 ff ff       	call   800333 <_panic>
+
+00801145 <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  801145:	55                   	push   %ebp
+  801146:	89 e5                	mov    %esp,%ebp
+  801148:	57                   	push   %edi
+  801149:	56                   	push   %esi
+  80114a:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80114b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801150:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801155:	89 d1                	mov    %edx,%ecx
+  801157:	89 d3                	mov    %edx,%ebx
+  801159:	89 d7                	mov    %edx,%edi
+  80115b:	89 d6                	mov    %edx,%esi
+  80115d:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  80115f:	5b                   	pop    %ebx
+  801160:	5e                   	pop    %esi
+  801161:	5f                   	pop    %edi
+  801162:	5d                   	pop    %ebp
+  801163:	c3                   	ret
+
+00801164 <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  801164:	55                   	push   %ebp
+  801165:	89 e5                	mov    %esp,%ebp
+  801167:	57                   	push   %edi
+  801168:	56                   	push   %esi
+  801169:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80116a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80116d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801170:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801175:	be 00 00 00 00       	mov    $0x0,%esi
+  80117a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80117d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801180:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  801182:	5b                   	pop    %ebx
+  801183:	5e                   	pop    %esi
+  801184:	5f                   	pop    %edi
+  801185:	5d                   	pop    %ebp
+  801186:	c3                   	ret
+
+00801187 <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  801187:	55                   	push   %ebp
+  801188:	89 e5                	mov    %esp,%ebp
+  80118a:	57                   	push   %edi
+  80118b:	56                   	push   %esi
+  80118c:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80118d:	be 00 00 00 00       	mov    $0x0,%esi
+  801192:	8b 55 08             	mov    0x8(%ebp),%edx
+  801195:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801198:	b8 10 00 00 00       	mov    $0x10,%eax
+  80119d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011a0:	89 f7                	mov    %esi,%edi
+  8011a2:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  8011a4:	5b                   	pop    %ebx
+  8011a5:	5e                   	pop    %esi
+  8011a6:	5f                   	pop    %edi
+  8011a7:	5d                   	pop    %ebp
+  8011a8:	c3                   	ret
+
+008011a9 <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  8011a9:	55                   	push   %ebp
+  8011aa:	89 e5                	mov    %esp,%ebp
+  8011ac:	57                   	push   %edi
+  8011ad:	56                   	push   %esi
+  8011ae:	53                   	push   %ebx
+  8011af:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  8011b2:	80 3d a4 68 80 00 00 	cmpb   $0x0,0x8068a4
+  8011b9:	74 41                	je     8011fc <sys_batch+0x53>
+  8011bb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011be:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  8011c1:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  8011c8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8011cb:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  8011ce:	7d 45                	jge    801215 <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  8011d0:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8011d3:	8b 06                	mov    (%esi),%eax
+  8011d5:	8b 56 04             	mov    0x4(%esi),%edx
+  8011d8:	8b 4e 08             	mov    0x8(%esi),%ecx
+  8011db:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  8011de:	8b 7e 10             	mov    0x10(%esi),%edi
+  8011e1:	8b 76 14             	mov    0x14(%esi),%esi
+  8011e4:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  8011e6:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8011e9:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  8011ec:	83 c6 1c             	add    $0x1c,%esi
+  8011ef:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  8011f2:	85 c0                	test   %eax,%eax
+  8011f4:	78 1f                	js     801215 <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  8011f6:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  8011fa:	eb cc                	jmp    8011c8 <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  8011fc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801201:	b8 13 00 00 00       	mov    $0x13,%eax
+  801206:	8b 55 08             	mov    0x8(%ebp),%edx
+  801209:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80120c:	89 df                	mov    %ebx,%edi
+  80120e:	89 de                	mov    %ebx,%esi
+  801210:	cd 30                	int    $0x30
+  801212:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  801215:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801218:	83 c4 08             	add    $0x8,%esp
+  80121b:	5b                   	pop    %ebx
+  80121c:	5e                   	pop    %esi
+  80121d:	5f                   	pop    %edi
+  80121e:	5d                   	pop    %ebp
+  80121f:	c3                   	ret
+
+00801220 <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  801220:	55                   	push   %ebp
+  801221:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  801223:	8b 45 08             	mov    0x8(%ebp),%eax
+  801226:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  80122c:	5d                   	pop    %ebp
+  80122d:	c3                   	ret
+
+0080122e <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  80122e:	55                   	push   %ebp
+  80122f:	89 e5                	mov    %esp,%ebp
+  801231:	56                   	push   %esi
+  801232:	53                   	push   %ebx
+  801233:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  801236:	8b 1e                	mov    (%esi),%ebx
+  801238:	85 db                	test   %ebx,%ebx
+  80123a:	75 09                	jne    801245 <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  80123c:	89 d8                	mov    %ebx,%eax
+  80123e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801241:	5b                   	pop    %ebx
+  801242:	5e                   	pop    %esi
+  801243:	5d                   	pop    %ebp
+  801244:	c3                   	ret
+  b->sb_n = 0;
+  801245:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  80124b:	53                   	push   %ebx
+  80124c:	8d 46 04             	lea    0x4(%esi),%eax
+  80124f:	50                   	push   %eax
+  801250:	e8 54 ff ff ff       	call   8011a9 <sys_batch>
+  801255:	83 c4 08             	add    $0x8,%esp
+  801258:	85 c0                	test   %eax,%eax
+  80125a:	78 1e                	js     80127a <sysbatch_flush+0x4c>
+  if (r < n)
+  80125c:	39 c3                	cmp    %eax,%ebx
+  80125e:	7f 07                	jg     801267 <sysbatch_flush+0x39>
+  return 0;
+  801260:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801265:	eb d5                	jmp    80123c <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  801267:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80126a:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  80126e:	85 db                	test   %ebx,%ebx
+  801270:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801275:	0f 49 d8             	cmovns %eax,%ebx
+  801278:	eb c2                	jmp    80123c <sysbatch_flush+0xe>
+    return r;
+  80127a:	89 c3                	mov    %eax,%ebx
+  80127c:	eb be                	jmp    80123c <sysbatch_flush+0xe>
+
+0080127e <sysbatch_add>:
+{
+  80127e:	55                   	push   %ebp
+  80127f:	89 e5                	mov    %esp,%ebp
+  801281:	53                   	push   %ebx
+  801282:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  801285:	83 3b 40             	cmpl   $0x40,(%ebx)
+  801288:	74 41                	je     8012cb <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  80128a:	8b 03                	mov    (%ebx),%eax
+  80128c:	8d 50 01             	lea    0x1(%eax),%edx
+  80128f:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  801291:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801294:	01 d8                	add    %ebx,%eax
+  801296:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801299:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  80129c:	8b 55 10             	mov    0x10(%ebp),%edx
+  80129f:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  8012a2:	8b 55 14             	mov    0x14(%ebp),%edx
+  8012a5:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  8012a8:	8b 55 18             	mov    0x18(%ebp),%edx
+  8012ab:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  8012ae:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  8012b1:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  8012b4:	8b 55 20             	mov    0x20(%ebp),%edx
+  8012b7:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  8012ba:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  8012c1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8012c6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012c9:	c9                   	leave
+  8012ca:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  8012cb:	53                   	push   %ebx
+  8012cc:	e8 5d ff ff ff       	call   80122e <sysbatch_flush>
+  8012d1:	83 c4 04             	add    $0x4,%esp
+  8012d4:	85 c0                	test   %eax,%eax
+  8012d6:	79 b2                	jns    80128a <sysbatch_add+0xc>
+  8012d8:	eb ec                	jmp    8012c6 <sysbatch_add+0x48>
+
+008012da <pgfault>:
+// Custom page fault handler - if faulting page is copy-on-write,
+// map in our own private writable copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  8012da:	55                   	push   %ebp
+  8012db:	89 e5                	mov    %esp,%ebp
+  8012dd:	56                   	push   %esi
+  8012de:	53                   	push   %ebx
+  8012df:	8b 45 08             	mov    0x8(%ebp),%eax
+  void *addr = (void*)utf->utf_fault_va;
+  8012e2:	8b 18                	mov    (%eax),%ebx
+  uint32_t err = utf->utf_err;
+  8012e4:	8b 70 04             	mov    0x4(%eax),%esi
+  // Hint:
+  //   Use the read-only page table mappings at uvpt
+  //   (see <inc/memlayout.h>).
+
+  // Faults in file mappings are mmap's to handle.
+  if (mmap_fault(utf))
+  8012e7:	83 ec 0c             	sub    $0xc,%esp
+  8012ea:	50                   	push   %eax
+  8012eb:	e8 68 1f 00 00       	call   803258 <mmap_fault>
+  8012f0:	83 c4 10             	add    $0x10,%esp
+  8012f3:	84 c0                	test   %al,%al
+  8012f5:	75 7d                	jne    801374 <pgfault+0x9a>
+    return;
+
+  // LAB 4: Your code here.
+  if ( !(err & FEC_WR) ) {
+  8012f7:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  8012fd:	74 7c                	je     80137b <pgfault+0xa1>
+    panic("user_pgfault: %e", err);
+  }
+
+  if ( !(uvpt[PGNUM(addr)] & PTE_COW) ) {
+  8012ff:	89 d8                	mov    %ebx,%eax
+  801301:	c1 e8 0c             	shr    $0xc,%eax
+  801304:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80130b:	f6 c4 08             	test   $0x8,%ah
+  80130e:	74 7d                	je     80138d <pgfault+0xb3>
+  // page to the old page's address.
+  // Hint:
+  //   You should make three system calls.
+
+  // LAB 4: Your code here.
+  addr = ROUNDDOWN(addr, PGSIZE);
+  801310:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+
+  // map page to temporary location
+  if ( (r = sys_page_alloc(0, PFTEMP, (PTE_P | PTE_U | PTE_W))) < 0) {
+  801316:	83 ec 04             	sub    $0x4,%esp
+  801319:	6a 07                	push   $0x7
+  80131b:	68 00 f0 7f 00       	push   $0x7ff000
+  801320:	6a 00                	push   $0x0
+  801322:	e8 04 fb ff ff       	call   800e2b <sys_page_alloc>
+  801327:	83 c4 10             	add    $0x10,%esp
+  80132a:	85 c0                	test   %eax,%eax
+  80132c:	78 73                	js     8013a1 <pgfault+0xc7>
+    panic("sys_page_alloc: %e", r);
+  }
+
+  // copy data from old page to new page
+  memmove(PFTEMP, addr, PGSIZE);
+  80132e:	83 ec 04             	sub    $0x4,%esp
+  801331:	68 00 10 00 00       	push   $0x1000
+  801336:	53                   	push   %ebx
+  801337:	68 00 f0 7f 00       	push   $0x7ff000
+  80133c:	e8 41 f8 ff ff       	call   800b82 <memmove>
+
+  // move new page to old page address
+  if ( (r = sys_page_map(0, PFTEMP, 0, addr, (PTE_P | PTE_U | PTE_W))) < 0) {
+  801341:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801348:	53                   	push   %ebx
+  801349:	6a 00                	push   $0x0
+  80134b:	68 00 f0 7f 00       	push   $0x7ff000
+  801350:	6a 00                	push   $0x0
+  801352:	e8 17 fb ff ff       	call   800e6e <sys_page_map>
+  801357:	83 c4 20             	add    $0x20,%esp
+  80135a:	85 c0                	test   %eax,%eax
+  80135c:	78 55                	js     8013b3 <pgfault+0xd9>
+    panic("sys_page_map: %e", r);
+  }
+
+  if ( (r = sys_page_unmap(0, PFTEMP)) < 0) {
+  80135e:	83 ec 08             	sub    $0x8,%esp
+  801361:	68 00 f0 7f 00       	push   $0x7ff000
+  801366:	6a 00                	push   $0x0
+  801368:	e8 43 fb ff ff       	call   800eb0 <sys_page_unmap>
+  80136d:	83 c4 10             	add    $0x10,%esp
+  801370:	85 c0                	test   %eax,%eax
+  801372:	78 51                	js     8013c5 <pgfault+0xeb>
+    panic("sys_page_unmap: %e", r);
+  }
+}
+  801374:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801377:	5b                   	pop    %ebx
+  801378:	5e                   	pop    %esi
+  801379:	5d                   	pop    %ebp
+  80137a:	c3                   	ret
+    panic("user_pgfault: %e", err);
+  80137b:	56                   	push   %esi
+  80137c:	68 ee 3f 80 00       	push   $0x803fee
+  801381:	6a 1d                	push   $0x1d
+  801383:	68 ff 3f 80 00       	push   $0x803fff
+  801388:	e8 a6 ef ff ff       	call   800333 <_panic>
+    panic("user_pgfault: page not COW");
+  80138d:	83 ec 04             	sub    $0x4,%esp
+  801390:	68 0a 40 80 00       	push   $0x80400a
+  801395:	6a 21                	push   $0x21
+  801397:	68 ff 3f 80 00       	push   $0x803fff
+  80139c:	e8 92 ef ff ff       	call   800333 <_panic>
+    panic("sys_page_alloc: %e", r);
+  8013a1:	50                   	push   %eax
+  8013a2:	68 15 3c 80 00       	push   $0x803c15
+  8013a7:	6a 2f                	push   $0x2f
+  8013a9:	68 ff 3f 80 00       	push   $0x803fff
+  8013ae:	e8 80 ef ff ff       	call   800333 <_panic>
+    panic("sys_page_map: %e", r);
+  8013b3:	50                   	push   %eax
+  8013b4:	68 25 40 80 00       	push   $0x804025
+  8013b9:	6a 37                	push   $0x37
+  8013bb:	68 ff 3f 80 00       	push   $0x803fff
+  8013c0:	e8 6e ef ff ff       	call   800333 <_panic>
+    panic("sys_page_unmap: %e", r);
+  8013c5:	50                   	push   %eax
+  8013c6:	68 36 40 80 00       	push   $0x804036
+  8013cb:	6a 3b                	push   $0x3b
+  8013cd:	68 ff 3f 80 00       	push   $0x803fff
+  8013d2:	e8 5c ef ff ff       	call   800333 <_panic>
+
+008013d7 <shared_pgfault>:
+
+// Challenge!
+//
+static void
+shared_pgfault(struct UTrapframe *utf)
+{
+  8013d7:	55                   	push   %ebp
+  8013d8:	89 e5                	mov    %esp,%ebp
+  8013da:	53                   	push   %ebx
+  8013db:	83 ec 10             	sub    $0x10,%esp
+  8013de:	8b 45 08             	mov    0x8(%ebp),%eax
+  // just has fewer error checks
+  
+  void *addr = (void*)utf->utf_fault_va;
+  8013e1:	8b 18                	mov    (%eax),%ebx
+  uint32_t err = utf->utf_err;
+  int r;
+
+  if (mmap_fault(utf))
+  8013e3:	50                   	push   %eax
+  8013e4:	e8 6f 1e 00 00       	call   803258 <mmap_fault>
+  8013e9:	83 c4 10             	add    $0x10,%esp
+  8013ec:	84 c0                	test   %al,%al
+  8013ee:	74 05                	je     8013f5 <shared_pgfault+0x1e>
+  }
+
+  if ( (r = sys_page_unmap(0, PFTEMP)) < 0) {
+    panic("sys_page_unmap: %e", r);
+  }
+}
+  8013f0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013f3:	c9                   	leave
+  8013f4:	c3                   	ret
+  addr = ROUNDDOWN(addr, PGSIZE);
+  8013f5:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if ( (r = sys_page_alloc(0, PFTEMP, (PTE_P | PTE_U | PTE_W))) < 0) {
+  8013fb:	83 ec 04             	sub    $0x4,%esp
+  8013fe:	6a 07                	push   $0x7
+  801400:	68 00 f0 7f 00       	push   $0x7ff000
+  801405:	6a 00                	push   $0x0
+  801407:	e8 1f fa ff ff       	call   800e2b <sys_page_alloc>
+  80140c:	83 c4 10             	add    $0x10,%esp
+  80140f:	85 c0                	test   %eax,%eax
+  801411:	78 5b                	js     80146e <shared_pgfault+0x97>
+  memmove(PFTEMP, addr, PGSIZE);
+  801413:	83 ec 04             	sub    $0x4,%esp
+  801416:	68 00 10 00 00       	push   $0x1000
+  80141b:	53                   	push   %ebx
+  80141c:	68 00 f0 7f 00       	push   $0x7ff000
+  801421:	e8 5c f7 ff ff       	call   800b82 <memmove>
+  if ( (r = sys_page_map(0, PFTEMP, 0, addr, (PTE_P | PTE_U | PTE_W))) < 0) {
+  801426:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  80142d:	53                   	push   %ebx
+  80142e:	6a 00                	push   $0x0
+  801430:	68 00 f0 7f 00       	push   $0x7ff000
+  801435:	6a 00                	push   $0x0
+  801437:	e8 32 fa ff ff       	call   800e6e <sys_page_map>
+  80143c:	83 c4 20             	add    $0x20,%esp
+  80143f:	85 c0                	test   %eax,%eax
+  801441:	78 40                	js     801483 <shared_pgfault+0xac>
+  if ( (r = sys_page_unmap(0, PFTEMP)) < 0) {
+  801443:	83 ec 08             	sub    $0x8,%esp
+  801446:	68 00 f0 7f 00       	push   $0x7ff000
+  80144b:	6a 00                	push   $0x0
+  80144d:	e8 5e fa ff ff       	call   800eb0 <sys_page_unmap>
+  801452:	83 c4 10             	add    $0x10,%esp
+  801455:	85 c0                	test   %eax,%eax
+  801457:	79 97                	jns    8013f0 <shared_pgfault+0x19>
+    panic("sys_page_unmap: %e", r);
+  801459:	50                   	push   %eax
+  80145a:	68 36 40 80 00       	push   $0x804036
+  80145f:	68 b0 00 00 00       	push   $0xb0
+  801464:	68 ff 3f 80 00       	push   $0x803fff
+  801469:	e8 c5 ee ff ff       	call   800333 <_panic>
+    panic("sys_page_alloc: %e", r);
+  80146e:	50                   	push   %eax
+  80146f:	68 15 3c 80 00       	push   $0x803c15
+  801474:	68 a4 00 00 00       	push   $0xa4
+  801479:	68 ff 3f 80 00       	push   $0x803fff
+  80147e:	e8 b0 ee ff ff       	call   800333 <_panic>
+    panic("sys_page_map: %e", r);
+  801483:	50                   	push   %eax
+  801484:	68 25 40 80 00       	push   $0x804025
+  801489:	68 ac 00 00 00       	push   $0xac
+  80148e:	68 ff 3f 80 00       	push   $0x803fff
+  801493:	e8 9b ee ff ff       	call   800333 <_panic>
+
+00801498 <fork>:
+{
+  801498:	55                   	push   %ebp
+  801499:	89 e5                	mov    %esp,%ebp
+  80149b:	53                   	push   %ebx
+  80149c:	83 ec 04             	sub    $0x4,%esp
+  parent_id = sys_getenvid();
+  80149f:	e8 06 f9 ff ff       	call   800daa <sys_getenvid>
+  set_pgfault_handler(pgfault);
+  8014a4:	83 ec 0c             	sub    $0xc,%esp
+  8014a7:	68 da 12 80 00       	push   $0x8012da
+  8014ac:	e8 36 24 00 00       	call   8038e7 <set_pgfault_handler>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+  envid_t ret;
+  __asm __volatile("int %2"
+  8014b1:	b8 07 00 00 00       	mov    $0x7,%eax
+  8014b6:	cd 30                	int    $0x30
+  8014b8:	89 c3                	mov    %eax,%ebx
+  if (envid < 0) {
+  8014ba:	83 c4 10             	add    $0x10,%esp
+  8014bd:	85 c0                	test   %eax,%eax
+  8014bf:	78 66                	js     801527 <fork+0x8f>
+  } else if (envid == 0) {
+  8014c1:	74 76                	je     801539 <fork+0xa1>
+  if ( (error = sys_page_map_range(0, 0, UXSTACKTOP - PGSIZE,
+  8014c3:	83 ec 0c             	sub    $0xc,%esp
+  8014c6:	6a 01                	push   $0x1
+  8014c8:	50                   	push   %eax
+  8014c9:	68 00 f0 bf ee       	push   $0xeebff000
+  8014ce:	6a 00                	push   $0x0
+  8014d0:	6a 00                	push   $0x0
+  8014d2:	e8 1b fa ff ff       	call   800ef2 <sys_page_map_range>
+  8014d7:	83 c4 20             	add    $0x20,%esp
+  8014da:	85 c0                	test   %eax,%eax
+  8014dc:	78 77                	js     801555 <fork+0xbd>
+  if ( (error = sys_page_alloc(envid,
+  8014de:	83 ec 04             	sub    $0x4,%esp
+  8014e1:	6a 07                	push   $0x7
+  8014e3:	68 00 f0 bf ee       	push   $0xeebff000
+  8014e8:	53                   	push   %ebx
+  8014e9:	e8 3d f9 ff ff       	call   800e2b <sys_page_alloc>
+  8014ee:	83 c4 10             	add    $0x10,%esp
+  8014f1:	85 c0                	test   %eax,%eax
+  8014f3:	78 72                	js     801567 <fork+0xcf>
+          thisenv->env_pgfault_upcall)) < 0) {
+  8014f5:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  8014fa:	8b 40 64             	mov    0x64(%eax),%eax
+  if ( (error = sys_env_set_pgfault_upcall(envid,
+  8014fd:	83 ec 08             	sub    $0x8,%esp
+  801500:	50                   	push   %eax
+  801501:	53                   	push   %ebx
+  801502:	e8 99 fb ff ff       	call   8010a0 <sys_env_set_pgfault_upcall>
+  801507:	83 c4 10             	add    $0x10,%esp
+  80150a:	85 c0                	test   %eax,%eax
+  80150c:	78 6b                	js     801579 <fork+0xe1>
+  if ( (error = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+  80150e:	83 ec 08             	sub    $0x8,%esp
+  801511:	6a 02                	push   $0x2
+  801513:	53                   	push   %ebx
+  801514:	e8 03 fb ff ff       	call   80101c <sys_env_set_status>
+  801519:	83 c4 10             	add    $0x10,%esp
+  80151c:	85 c0                	test   %eax,%eax
+  80151e:	78 6b                	js     80158b <fork+0xf3>
+}
+  801520:	89 d8                	mov    %ebx,%eax
+  801522:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801525:	c9                   	leave
+  801526:	c3                   	ret
+    panic("sys_exofork: %e", envid);
+  801527:	50                   	push   %eax
+  801528:	68 49 40 80 00       	push   $0x804049
+  80152d:	6a 5e                	push   $0x5e
+  80152f:	68 ff 3f 80 00       	push   $0x803fff
+  801534:	e8 fa ed ff ff       	call   800333 <_panic>
+    thisenv = &envs[ENVX(sys_getenvid())];
+  801539:	e8 6c f8 ff ff       	call   800daa <sys_getenvid>
+  80153e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801543:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  801546:	c1 e0 04             	shl    $0x4,%eax
+  801549:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80154e:	a3 a0 68 80 00       	mov    %eax,0x8068a0
+    return 0;
+  801553:	eb cb                	jmp    801520 <fork+0x88>
+    panic("sys_page_map_range: %e", error);
+  801555:	50                   	push   %eax
+  801556:	68 59 40 80 00       	push   $0x804059
+  80155b:	6a 69                	push   $0x69
+  80155d:	68 ff 3f 80 00       	push   $0x803fff
+  801562:	e8 cc ed ff ff       	call   800333 <_panic>
+    panic("sys_page_alloc: %e", error);
+  801567:	50                   	push   %eax
+  801568:	68 15 3c 80 00       	push   $0x803c15
+  80156d:	6a 70                	push   $0x70
+  80156f:	68 ff 3f 80 00       	push   $0x803fff
+  801574:	e8 ba ed ff ff       	call   800333 <_panic>
+    panic("sys_env_set_pgfault_upcall: %e", error);
+  801579:	50                   	push   %eax
+  80157a:	68 88 40 80 00       	push   $0x804088
+  80157f:	6a 76                	push   $0x76
+  801581:	68 ff 3f 80 00       	push   $0x803fff
+  801586:	e8 a8 ed ff ff       	call   800333 <_panic>
+    panic("sys_env_set_status: %e", error);
+  80158b:	50                   	push   %eax
+  80158c:	68 70 40 80 00       	push   $0x804070
+  801591:	6a 7a                	push   $0x7a
+  801593:	68 ff 3f 80 00       	push   $0x803fff
+  801598:	e8 96 ed ff ff       	call   800333 <_panic>
+
+0080159d <kfork>:
+{
+  80159d:	55                   	push   %ebp
+  80159e:	89 e5                	mov    %esp,%ebp
+  8015a0:	53                   	push   %ebx
+  8015a1:	83 ec 10             	sub    $0x10,%esp
+  set_pgfault_handler(pgfault);
+  8015a4:	68 da 12 80 00       	push   $0x8012da
+  8015a9:	e8 39 23 00 00       	call   8038e7 <set_pgfault_handler>
+  if ((envid = sys_fork()) == 0)
+  8015ae:	e8 4a fa ff ff       	call   800ffd <sys_fork>
+  8015b3:	89 c3                	mov    %eax,%ebx
+  8015b5:	83 c4 10             	add    $0x10,%esp
+  8015b8:	85 c0                	test   %eax,%eax
+  8015ba:	74 07                	je     8015c3 <kfork+0x26>
+}
+  8015bc:	89 d8                	mov    %ebx,%eax
+  8015be:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015c1:	c9                   	leave
+  8015c2:	c3                   	ret
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8015c3:	e8 e2 f7 ff ff       	call   800daa <sys_getenvid>
+  8015c8:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8015cd:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8015d0:	c1 e0 04             	shl    $0x4,%eax
+  8015d3:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8015d8:	a3 a0 68 80 00       	mov    %eax,0x8068a0
+  return envid;
+  8015dd:	eb dd                	jmp    8015bc <kfork+0x1f>
+
+008015df <sfork>:
+
+int
+sfork(void)
+{
+  8015df:	55                   	push   %ebp
+  8015e0:	89 e5                	mov    %esp,%ebp
+  8015e2:	53                   	push   %ebx
+  8015e3:	83 ec 04             	sub    $0x4,%esp
+  envid_t envid, parent_id;
+  int error;
+
+  parent_id = sys_getenvid();
+  8015e6:	e8 bf f7 ff ff       	call   800daa <sys_getenvid>
+
+  // set up page fault handler
+  set_pgfault_handler(shared_pgfault);
+  8015eb:	83 ec 0c             	sub    $0xc,%esp
+  8015ee:	68 d7 13 80 00       	push   $0x8013d7
+  8015f3:	e8 ef 22 00 00       	call   8038e7 <set_pgfault_handler>
+  8015f8:	b8 07 00 00 00       	mov    $0x7,%eax
+  8015fd:	cd 30                	int    $0x30
+  8015ff:	89 c3                	mov    %eax,%ebx
+
+  // create a child with sys_exofork
+  envid = sys_exofork();
+  
+  if (envid < 0) {
+  801601:	83 c4 10             	add    $0x10,%esp
+  801604:	85 c0                	test   %eax,%eax
+  801606:	78 09                	js     801611 <sfork+0x32>
+    panic("sys_exofork: %e", envid);
+  } else if (envid == 0) {
+  801608:	75 1c                	jne    801626 <sfork+0x47>
+  if ( (error = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+    panic("sys_env_set_status: %e", error);
+  }
+
+  return envid;
+}
+  80160a:	89 d8                	mov    %ebx,%eax
+  80160c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80160f:	c9                   	leave
+  801610:	c3                   	ret
+    panic("sys_exofork: %e", envid);
+  801611:	50                   	push   %eax
+  801612:	68 49 40 80 00       	push   $0x804049
+  801617:	68 c3 00 00 00       	push   $0xc3
+  80161c:	68 ff 3f 80 00       	push   $0x803fff
+  801621:	e8 0d ed ff ff       	call   800333 <_panic>
+  if ( (error = sys_page_map_range(0, 0, USTACKTOP - PGSIZE,
+  801626:	83 ec 0c             	sub    $0xc,%esp
+  801629:	6a 00                	push   $0x0
+  80162b:	50                   	push   %eax
+  80162c:	68 00 d0 bf ee       	push   $0xeebfd000
+  801631:	6a 00                	push   $0x0
+  801633:	6a 00                	push   $0x0
+  801635:	e8 b8 f8 ff ff       	call   800ef2 <sys_page_map_range>
+  80163a:	83 c4 20             	add    $0x20,%esp
+  80163d:	85 c0                	test   %eax,%eax
+  80163f:	78 79                	js     8016ba <sfork+0xdb>
+  if ( (error = sys_page_map_range(0, (void *) (USTACKTOP - PGSIZE), PGSIZE,
+  801641:	83 ec 0c             	sub    $0xc,%esp
+  801644:	6a 01                	push   $0x1
+  801646:	53                   	push   %ebx
+  801647:	68 00 10 00 00       	push   $0x1000
+  80164c:	68 00 d0 bf ee       	push   $0xeebfd000
+  801651:	6a 00                	push   $0x0
+  801653:	e8 9a f8 ff ff       	call   800ef2 <sys_page_map_range>
+  801658:	83 c4 20             	add    $0x20,%esp
+  80165b:	85 c0                	test   %eax,%eax
+  80165d:	78 70                	js     8016cf <sfork+0xf0>
+  if ( (error = sys_page_alloc(envid,
+  80165f:	83 ec 04             	sub    $0x4,%esp
+  801662:	6a 07                	push   $0x7
+  801664:	68 00 f0 bf ee       	push   $0xeebff000
+  801669:	53                   	push   %ebx
+  80166a:	e8 bc f7 ff ff       	call   800e2b <sys_page_alloc>
+  80166f:	83 c4 10             	add    $0x10,%esp
+  801672:	85 c0                	test   %eax,%eax
+  801674:	78 6e                	js     8016e4 <sfork+0x105>
+          thisenv->env_pgfault_upcall)) < 0) {
+  801676:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  80167b:	8b 40 64             	mov    0x64(%eax),%eax
+  if ( (error = sys_env_set_pgfault_upcall(envid,
+  80167e:	83 ec 08             	sub    $0x8,%esp
+  801681:	50                   	push   %eax
+  801682:	53                   	push   %ebx
+  801683:	e8 18 fa ff ff       	call   8010a0 <sys_env_set_pgfault_upcall>
+  801688:	83 c4 10             	add    $0x10,%esp
+  80168b:	85 c0                	test   %eax,%eax
+  80168d:	78 6a                	js     8016f9 <sfork+0x11a>
+  if ( (error = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+  80168f:	83 ec 08             	sub    $0x8,%esp
+  801692:	6a 02                	push   $0x2
+  801694:	53                   	push   %ebx
+  801695:	e8 82 f9 ff ff       	call   80101c <sys_env_set_status>
+  80169a:	83 c4 10             	add    $0x10,%esp
+  80169d:	85 c0                	test   %eax,%eax
+  80169f:	0f 89 65 ff ff ff    	jns    80160a <sfork+0x2b>
+    panic("sys_env_set_status: %e", error);
+  8016a5:	50                   	push   %eax
+  8016a6:	68 70 40 80 00       	push   $0x804070
+  8016ab:	68 e4 00 00 00       	push   $0xe4
+  8016b0:	68 ff 3f 80 00       	push   $0x803fff
+  8016b5:	e8 79 ec ff ff       	call   800333 <_panic>
+    panic("sys_page_map_range: %e", error);
+  8016ba:	50                   	push   %eax
+  8016bb:	68 59 40 80 00       	push   $0x804059
+  8016c0:	68 ce 00 00 00       	push   $0xce
+  8016c5:	68 ff 3f 80 00       	push   $0x803fff
+  8016ca:	e8 64 ec ff ff       	call   800333 <_panic>
+    panic("sys_page_map_range: %e", error);
+  8016cf:	50                   	push   %eax
+  8016d0:	68 59 40 80 00       	push   $0x804059
+  8016d5:	68 d3 00 00 00       	push   $0xd3
+  8016da:	68 ff 3f 80 00       	push   $0x803fff
+  8016df:	e8 4f ec ff ff       	call   800333 <_panic>
+    panic("sys_page_alloc: %e", error);
+  8016e4:	50                   	push   %eax
+  8016e5:	68 15 3c 80 00       	push   $0x803c15
+  8016ea:	68 da 00 00 00       	push   $0xda
+  8016ef:	68 ff 3f 80 00       	push   $0x803fff
+  8016f4:	e8 3a ec ff ff       	call   800333 <_panic>
+    panic("sys_env_set_pgfault_upcall: %e", error);
+  8016f9:	50                   	push   %eax
+  8016fa:	68 88 40 80 00       	push   $0x804088
+  8016ff:	68 e0 00 00 00       	push   $0xe0
+  801704:	68 ff 3f 80 00       	push   $0x803fff
+  801709:	e8 25 ec ff ff       	call   800333 <_panic>
+
+0080170e <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  80170e:	55                   	push   %ebp
+  80170f:	89 e5                	mov    %esp,%ebp
+  801711:	57                   	push   %edi
+  801712:	56                   	push   %esi
+  801713:	53                   	push   %ebx
+  801714:	83 ec 14             	sub    $0x14,%esp
+  801717:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80171a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80171d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801720:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  801723:	85 c0                	test   %eax,%eax
+  801725:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80172a:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  80172d:	ff 33                	push   (%ebx)
+  80172f:	50                   	push   %eax
+  801730:	e8 ce f9 ff ff       	call   801103 <sys_ipc_recv>
+  801735:	83 c4 10             	add    $0x10,%esp
+  801738:	85 c0                	test   %eax,%eax
+  80173a:	78 39                	js     801775 <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  80173c:	85 ff                	test   %edi,%edi
+  80173e:	74 0a                	je     80174a <ipc_recv_pages+0x3c>
+  801740:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  801745:	8b 40 7c             	mov    0x7c(%eax),%eax
+  801748:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  80174a:	85 f6                	test   %esi,%esi
+  80174c:	74 0d                	je     80175b <ipc_recv_pages+0x4d>
+  80174e:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  801753:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  801759:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  80175b:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  801760:	8b 40 74             	mov    0x74(%eax),%eax
+  801763:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  801765:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  80176a:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  80176d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801770:	5b                   	pop    %ebx
+  801771:	5e                   	pop    %esi
+  801772:	5f                   	pop    %edi
+  801773:	5d                   	pop    %ebp
+  801774:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  801775:	85 ff                	test   %edi,%edi
+  801777:	74 06                	je     80177f <ipc_recv_pages+0x71>
+  801779:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  80177f:	85 f6                	test   %esi,%esi
+  801781:	74 06                	je     801789 <ipc_recv_pages+0x7b>
+  801783:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  801789:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  80178f:	eb dc                	jmp    80176d <ipc_recv_pages+0x5f>
+
+00801791 <ipc_recv>:
+{
+  801791:	55                   	push   %ebp
+  801792:	89 e5                	mov    %esp,%ebp
+  801794:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  801797:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  80179e:	ff 75 10             	push   0x10(%ebp)
+  8017a1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017a4:	50                   	push   %eax
+  8017a5:	ff 75 0c             	push   0xc(%ebp)
+  8017a8:	ff 75 08             	push   0x8(%ebp)
+  8017ab:	e8 5e ff ff ff       	call   80170e <ipc_recv_pages>
+}
+  8017b0:	c9                   	leave
+  8017b1:	c3                   	ret
+
+008017b2 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  8017b2:	55                   	push   %ebp
+  8017b3:	89 e5                	mov    %esp,%ebp
+  8017b5:	57                   	push   %edi
+  8017b6:	56                   	push   %esi
+  8017b7:	53                   	push   %ebx
+  8017b8:	83 ec 0c             	sub    $0xc,%esp
+  8017bb:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8017be:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8017c1:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  8017c4:	89 c3                	mov    %eax,%ebx
+  8017c6:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  8017cc:	85 c0                	test   %eax,%eax
+  8017ce:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8017d3:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  8017d6:	83 ec 0c             	sub    $0xc,%esp
+  8017d9:	ff 75 14             	push   0x14(%ebp)
+  8017dc:	ff 75 18             	push   0x18(%ebp)
+  8017df:	53                   	push   %ebx
+  8017e0:	56                   	push   %esi
+  8017e1:	57                   	push   %edi
+  8017e2:	e8 fb f8 ff ff       	call   8010e2 <sys_ipc_try_send>
+  8017e7:	83 c4 20             	add    $0x20,%esp
+  8017ea:	85 c0                	test   %eax,%eax
+  8017ec:	79 1e                	jns    80180c <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  8017ee:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8017f1:	75 07                	jne    8017fa <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  8017f3:	e8 d1 f5 ff ff       	call   800dc9 <sys_yield>
+  8017f8:	eb dc                	jmp    8017d6 <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  8017fa:	50                   	push   %eax
+  8017fb:	68 a7 40 80 00       	push   $0x8040a7
+  801800:	6a 5c                	push   $0x5c
+  801802:	68 b4 40 80 00       	push   $0x8040b4
+  801807:	e8 27 eb ff ff       	call   800333 <_panic>
+  }
+}
+  80180c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80180f:	5b                   	pop    %ebx
+  801810:	5e                   	pop    %esi
+  801811:	5f                   	pop    %edi
+  801812:	5d                   	pop    %ebp
+  801813:	c3                   	ret
+
+00801814 <ipc_send>:
+{
+  801814:	55                   	push   %ebp
+  801815:	89 e5                	mov    %esp,%ebp
+  801817:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  80181a:	ff 75 14             	push   0x14(%ebp)
+  80181d:	6a 01                	push   $0x1
+  80181f:	ff 75 10             	push   0x10(%ebp)
+  801822:	ff 75 0c             	push   0xc(%ebp)
+  801825:	ff 75 08             	push   0x8(%ebp)
+  801828:	e8 85 ff ff ff       	call   8017b2 <ipc_send_pages>
+}
+  80182d:	83 c4 20             	add    $0x20,%esp
+  801830:	c9                   	leave
+  801831:	c3                   	ret
+
+00801832 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  801832:	55                   	push   %ebp
+  801833:	89 e5                	mov    %esp,%ebp
+  801835:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  801838:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  80183d:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  801840:	c1 e0 04             	shl    $0x4,%eax
+  801843:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801848:	8b 40 50             	mov    0x50(%eax),%eax
+  80184b:	39 c8                	cmp    %ecx,%eax
+  80184d:	74 12                	je     801861 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  80184f:	83 c2 01             	add    $0x1,%edx
+  801852:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  801858:	75 e3                	jne    80183d <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  80185a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80185f:	eb 0e                	jmp    80186f <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  801861:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  801864:	c1 e0 04             	shl    $0x4,%eax
+  801867:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80186c:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  80186f:	5d                   	pop    %ebp
+  801870:	c3                   	ret
+
+00801871 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801871:	55                   	push   %ebp
+  801872:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801874:	8b 45 08             	mov    0x8(%ebp),%eax
+  801877:	05 00 00 00 30       	add    $0x30000000,%eax
+  80187c:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80187f:	5d                   	pop    %ebp
+  801880:	c3                   	ret
+
+00801881 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801881:	55                   	push   %ebp
+  801882:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801884:	8b 45 08             	mov    0x8(%ebp),%eax
+  801887:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  80188a:	66 b8 00 00          	mov    $0x0,%ax
+  80188e:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801893:	5d                   	pop    %ebp
+  801894:	c3                   	ret
+
+00801895 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801895:	55                   	push   %ebp
+  801896:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  801898:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80189d:	eb 02                	jmp    8018a1 <fd_alloc+0xc>
+  80189f:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8018a1:	89 c2                	mov    %eax,%edx
+  8018a3:	c1 ea 16             	shr    $0x16,%edx
+  8018a6:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8018ad:	f6 c2 01             	test   $0x1,%dl
+  8018b0:	74 2b                	je     8018dd <fd_alloc+0x48>
+  8018b2:	89 c2                	mov    %eax,%edx
+  8018b4:	c1 ea 0c             	shr    $0xc,%edx
+  8018b7:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8018be:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8018c4:	f6 c1 01             	test   $0x1,%cl
+  8018c7:	74 14                	je     8018dd <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  8018c9:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8018cf:	75 ce                	jne    80189f <fd_alloc+0xa>
+  8018d1:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  8018d6:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8018db:	eb 05                	jmp    8018e2 <fd_alloc+0x4d>
+      return 0;
+  8018dd:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  8018e2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018e5:	89 02                	mov    %eax,(%edx)
+}
+  8018e7:	89 c8                	mov    %ecx,%eax
+  8018e9:	5d                   	pop    %ebp
+  8018ea:	c3                   	ret
+
+008018eb <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8018eb:	55                   	push   %ebp
+  8018ec:	89 e5                	mov    %esp,%ebp
+  8018ee:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  8018f1:	83 f8 1f             	cmp    $0x1f,%eax
+  8018f4:	77 30                	ja     801926 <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  8018f6:	c1 e0 0c             	shl    $0xc,%eax
+  8018f9:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8018fe:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801904:	f6 c2 01             	test   $0x1,%dl
+  801907:	74 24                	je     80192d <fd_lookup+0x42>
+  801909:	89 c2                	mov    %eax,%edx
+  80190b:	c1 ea 0c             	shr    $0xc,%edx
+  80190e:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801915:	f6 c2 01             	test   $0x1,%dl
+  801918:	74 1a                	je     801934 <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  80191a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80191d:	89 02                	mov    %eax,(%edx)
+  return 0;
+  80191f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801924:	5d                   	pop    %ebp
+  801925:	c3                   	ret
+    return -E_INVAL;
+  801926:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80192b:	eb f7                	jmp    801924 <fd_lookup+0x39>
+    return -E_INVAL;
+  80192d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801932:	eb f0                	jmp    801924 <fd_lookup+0x39>
+  801934:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801939:	eb e9                	jmp    801924 <fd_lookup+0x39>
+
+0080193b <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80193b:	55                   	push   %ebp
+  80193c:	89 e5                	mov    %esp,%ebp
+  80193e:	53                   	push   %ebx
+  80193f:	83 ec 04             	sub    $0x4,%esp
+  801942:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  801945:	b8 3c 41 80 00       	mov    $0x80413c,%eax
+  80194a:	8b 18                	mov    (%eax),%ebx
+  80194c:	85 db                	test   %ebx,%ebx
+  80194e:	74 0e                	je     80195e <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  801950:	83 c0 04             	add    $0x4,%eax
+  801953:	39 13                	cmp    %edx,(%ebx)
+  801955:	75 f3                	jne    80194a <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  801957:	b8 00 00 00 00       	mov    $0x0,%eax
+  80195c:	eb 1f                	jmp    80197d <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80195e:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  801963:	8b 40 48             	mov    0x48(%eax),%eax
+  801966:	83 ec 04             	sub    $0x4,%esp
+  801969:	52                   	push   %edx
+  80196a:	50                   	push   %eax
+  80196b:	68 c0 40 80 00       	push   $0x8040c0
+  801970:	e8 99 ea ff ff       	call   80040e <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  801975:	83 c4 10             	add    $0x10,%esp
+  801978:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  80197d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801980:	89 1a                	mov    %ebx,(%edx)
+}
+  801982:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801985:	c9                   	leave
+  801986:	c3                   	ret
+
+00801987 <fd_close>:
+{
+  801987:	55                   	push   %ebp
+  801988:	89 e5                	mov    %esp,%ebp
+  80198a:	57                   	push   %edi
+  80198b:	56                   	push   %esi
+  80198c:	53                   	push   %ebx
+  80198d:	83 ec 24             	sub    $0x24,%esp
+  801990:	8b 75 08             	mov    0x8(%ebp),%esi
+  801993:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801996:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801999:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80199a:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8019a0:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8019a3:	50                   	push   %eax
+  8019a4:	e8 42 ff ff ff       	call   8018eb <fd_lookup>
+  8019a9:	89 c3                	mov    %eax,%ebx
+  8019ab:	83 c4 10             	add    $0x10,%esp
+  8019ae:	85 c0                	test   %eax,%eax
+  8019b0:	78 05                	js     8019b7 <fd_close+0x30>
+      || fd != fd2)
+  8019b2:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8019b5:	74 16                	je     8019cd <fd_close+0x46>
+    return must_exist ? r : 0;
+  8019b7:	89 f8                	mov    %edi,%eax
+  8019b9:	84 c0                	test   %al,%al
+  8019bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019c0:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8019c3:	89 d8                	mov    %ebx,%eax
+  8019c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019c8:	5b                   	pop    %ebx
+  8019c9:	5e                   	pop    %esi
+  8019ca:	5f                   	pop    %edi
+  8019cb:	5d                   	pop    %ebp
+  8019cc:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8019cd:	83 ec 08             	sub    $0x8,%esp
+  8019d0:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8019d3:	50                   	push   %eax
+  8019d4:	ff 36                	push   (%esi)
+  8019d6:	e8 60 ff ff ff       	call   80193b <dev_lookup>
+  8019db:	89 c3                	mov    %eax,%ebx
+  8019dd:	83 c4 10             	add    $0x10,%esp
+  8019e0:	85 c0                	test   %eax,%eax
+  8019e2:	78 1a                	js     8019fe <fd_close+0x77>
+    if (dev->dev_close)
+  8019e4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8019e7:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  8019ea:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  8019ef:	85 c0                	test   %eax,%eax
+  8019f1:	74 0b                	je     8019fe <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  8019f3:	83 ec 0c             	sub    $0xc,%esp
+  8019f6:	56                   	push   %esi
+  8019f7:	ff d0                	call   *%eax
+  8019f9:	89 c3                	mov    %eax,%ebx
+  8019fb:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  8019fe:	83 ec 08             	sub    $0x8,%esp
+  801a01:	56                   	push   %esi
+  801a02:	6a 00                	push   $0x0
+  801a04:	e8 a7 f4 ff ff       	call   800eb0 <sys_page_unmap>
+  return r;
+  801a09:	83 c4 10             	add    $0x10,%esp
+  801a0c:	eb b5                	jmp    8019c3 <fd_close+0x3c>
+
+00801a0e <close>:
+
+int
+close(int fdnum)
+{
+  801a0e:	55                   	push   %ebp
+  801a0f:	89 e5                	mov    %esp,%ebp
+  801a11:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801a14:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a17:	50                   	push   %eax
+  801a18:	ff 75 08             	push   0x8(%ebp)
+  801a1b:	e8 cb fe ff ff       	call   8018eb <fd_lookup>
+  801a20:	83 c4 10             	add    $0x10,%esp
+  801a23:	85 c0                	test   %eax,%eax
+  801a25:	79 02                	jns    801a29 <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  801a27:	c9                   	leave
+  801a28:	c3                   	ret
+    return fd_close(fd, 1);
+  801a29:	83 ec 08             	sub    $0x8,%esp
+  801a2c:	6a 01                	push   $0x1
+  801a2e:	ff 75 f4             	push   -0xc(%ebp)
+  801a31:	e8 51 ff ff ff       	call   801987 <fd_close>
+  801a36:	83 c4 10             	add    $0x10,%esp
+  801a39:	eb ec                	jmp    801a27 <close+0x19>
+
+00801a3b <close_all>:
+
+void
+close_all(void)
+{
+  801a3b:	55                   	push   %ebp
+  801a3c:	89 e5                	mov    %esp,%ebp
+  801a3e:	53                   	push   %ebx
+  801a3f:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  801a42:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  801a47:	83 ec 0c             	sub    $0xc,%esp
+  801a4a:	53                   	push   %ebx
+  801a4b:	e8 be ff ff ff       	call   801a0e <close>
+  for (i = 0; i < MAXFD; i++)
+  801a50:	83 c3 01             	add    $0x1,%ebx
+  801a53:	83 c4 10             	add    $0x10,%esp
+  801a56:	83 fb 20             	cmp    $0x20,%ebx
+  801a59:	75 ec                	jne    801a47 <close_all+0xc>
+}
+  801a5b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a5e:	c9                   	leave
+  801a5f:	c3                   	ret
+
+00801a60 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801a60:	55                   	push   %ebp
+  801a61:	89 e5                	mov    %esp,%ebp
+  801a63:	57                   	push   %edi
+  801a64:	56                   	push   %esi
+  801a65:	53                   	push   %ebx
+  801a66:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801a69:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801a6c:	50                   	push   %eax
+  801a6d:	ff 75 08             	push   0x8(%ebp)
+  801a70:	e8 76 fe ff ff       	call   8018eb <fd_lookup>
+  801a75:	89 c6                	mov    %eax,%esi
+  801a77:	83 c4 10             	add    $0x10,%esp
+  801a7a:	85 c0                	test   %eax,%eax
+  801a7c:	0f 88 0a 01 00 00    	js     801b8c <dup+0x12c>
+    return r;
+  close(newfdnum);
+  801a82:	83 ec 0c             	sub    $0xc,%esp
+  801a85:	ff 75 0c             	push   0xc(%ebp)
+  801a88:	e8 81 ff ff ff       	call   801a0e <close>
+
+  newfd = INDEX2FD(newfdnum);
+  801a8d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a90:	c1 e0 0c             	shl    $0xc,%eax
+  801a93:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  801a99:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  801a9c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801a9f:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  801aa2:	89 04 24             	mov    %eax,(%esp)
+  801aa5:	e8 d7 fd ff ff       	call   801881 <fd2data>
+  801aaa:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  801aac:	89 3c 24             	mov    %edi,(%esp)
+  801aaf:	e8 cd fd ff ff       	call   801881 <fd2data>
+  801ab4:	83 c4 10             	add    $0x10,%esp
+  801ab7:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801aba:	89 f3                	mov    %esi,%ebx
+  801abc:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  801ac2:	89 c6                	mov    %eax,%esi
+  801ac4:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801ac7:	89 cf                	mov    %ecx,%edi
+  801ac9:	eb 0c                	jmp    801ad7 <dup+0x77>
+  801acb:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801ad1:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801ad7:	39 fb                	cmp    %edi,%ebx
+  801ad9:	74 7b                	je     801b56 <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  801adb:	89 d8                	mov    %ebx,%eax
+  801add:	c1 e8 16             	shr    $0x16,%eax
+  801ae0:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801ae7:	a8 01                	test   $0x1,%al
+  801ae9:	74 e0                	je     801acb <dup+0x6b>
+  801aeb:	89 d8                	mov    %ebx,%eax
+  801aed:	c1 e8 0c             	shr    $0xc,%eax
+  801af0:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801af7:	f6 c2 01             	test   $0x1,%dl
+  801afa:	74 cf                	je     801acb <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  801afc:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  801b03:	83 ec 0c             	sub    $0xc,%esp
+  801b06:	25 07 0e 00 00       	and    $0xe07,%eax
+  801b0b:	50                   	push   %eax
+  801b0c:	56                   	push   %esi
+  801b0d:	6a 00                	push   $0x0
+  801b0f:	53                   	push   %ebx
+  801b10:	6a 00                	push   $0x0
+  801b12:	e8 57 f3 ff ff       	call   800e6e <sys_page_map>
+  801b17:	83 c4 20             	add    $0x20,%esp
+  801b1a:	85 c0                	test   %eax,%eax
+  801b1c:	79 ad                	jns    801acb <dup+0x6b>
+  801b1e:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801b21:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  801b23:	83 ec 08             	sub    $0x8,%esp
+  801b26:	ff 75 d4             	push   -0x2c(%ebp)
+  801b29:	6a 00                	push   $0x0
+  801b2b:	e8 80 f3 ff ff       	call   800eb0 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801b30:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  801b33:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  801b39:	83 c4 10             	add    $0x10,%esp
+  801b3c:	39 df                	cmp    %ebx,%edi
+  801b3e:	74 4c                	je     801b8c <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  801b40:	83 ec 08             	sub    $0x8,%esp
+  801b43:	57                   	push   %edi
+  801b44:	6a 00                	push   $0x0
+  801b46:	e8 65 f3 ff ff       	call   800eb0 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801b4b:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  801b51:	83 c4 10             	add    $0x10,%esp
+  801b54:	eb e6                	jmp    801b3c <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801b56:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801b59:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  801b5c:	89 c8                	mov    %ecx,%eax
+  801b5e:	c1 e8 0c             	shr    $0xc,%eax
+  801b61:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801b68:	83 ec 0c             	sub    $0xc,%esp
+  801b6b:	25 07 0e 00 00       	and    $0xe07,%eax
+  801b70:	50                   	push   %eax
+  801b71:	ff 75 d4             	push   -0x2c(%ebp)
+  801b74:	6a 00                	push   $0x0
+  801b76:	51                   	push   %ecx
+  801b77:	6a 00                	push   $0x0
+  801b79:	e8 f0 f2 ff ff       	call   800e6e <sys_page_map>
+  801b7e:	89 c6                	mov    %eax,%esi
+  801b80:	83 c4 20             	add    $0x20,%esp
+  801b83:	85 c0                	test   %eax,%eax
+  801b85:	78 9c                	js     801b23 <dup+0xc3>
+  return newfdnum;
+  801b87:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b8a:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  801b8c:	89 f0                	mov    %esi,%eax
+  801b8e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b91:	5b                   	pop    %ebx
+  801b92:	5e                   	pop    %esi
+  801b93:	5f                   	pop    %edi
+  801b94:	5d                   	pop    %ebp
+  801b95:	c3                   	ret
+
+00801b96 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801b96:	55                   	push   %ebp
+  801b97:	89 e5                	mov    %esp,%ebp
+  801b99:	56                   	push   %esi
+  801b9a:	53                   	push   %ebx
+  801b9b:	83 ec 18             	sub    $0x18,%esp
+  801b9e:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801ba1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ba4:	50                   	push   %eax
+  801ba5:	56                   	push   %esi
+  801ba6:	e8 40 fd ff ff       	call   8018eb <fd_lookup>
+  801bab:	83 c4 10             	add    $0x10,%esp
+  801bae:	85 c0                	test   %eax,%eax
+  801bb0:	78 3c                	js     801bee <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801bb2:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801bb5:	83 ec 08             	sub    $0x8,%esp
+  801bb8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bbb:	50                   	push   %eax
+  801bbc:	ff 33                	push   (%ebx)
+  801bbe:	e8 78 fd ff ff       	call   80193b <dev_lookup>
+  801bc3:	83 c4 10             	add    $0x10,%esp
+  801bc6:	85 c0                	test   %eax,%eax
+  801bc8:	78 24                	js     801bee <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801bca:	8b 43 08             	mov    0x8(%ebx),%eax
+  801bcd:	83 e0 03             	and    $0x3,%eax
+  801bd0:	83 f8 01             	cmp    $0x1,%eax
+  801bd3:	74 20                	je     801bf5 <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  801bd5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bd8:	8b 40 08             	mov    0x8(%eax),%eax
+  801bdb:	85 c0                	test   %eax,%eax
+  801bdd:	74 37                	je     801c16 <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  801bdf:	83 ec 04             	sub    $0x4,%esp
+  801be2:	ff 75 10             	push   0x10(%ebp)
+  801be5:	ff 75 0c             	push   0xc(%ebp)
+  801be8:	53                   	push   %ebx
+  801be9:	ff d0                	call   *%eax
+  801beb:	83 c4 10             	add    $0x10,%esp
+}
+  801bee:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bf1:	5b                   	pop    %ebx
+  801bf2:	5e                   	pop    %esi
+  801bf3:	5d                   	pop    %ebp
+  801bf4:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801bf5:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  801bfa:	8b 40 48             	mov    0x48(%eax),%eax
+  801bfd:	83 ec 04             	sub    $0x4,%esp
+  801c00:	56                   	push   %esi
+  801c01:	50                   	push   %eax
+  801c02:	68 01 41 80 00       	push   $0x804101
+  801c07:	e8 02 e8 ff ff       	call   80040e <cprintf>
+    return -E_INVAL;
+  801c0c:	83 c4 10             	add    $0x10,%esp
+  801c0f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c14:	eb d8                	jmp    801bee <read+0x58>
+    return -E_NOT_SUPP;
+  801c16:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c1b:	eb d1                	jmp    801bee <read+0x58>
+
+00801c1d <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801c1d:	55                   	push   %ebp
+  801c1e:	89 e5                	mov    %esp,%ebp
+  801c20:	57                   	push   %edi
+  801c21:	56                   	push   %esi
+  801c22:	53                   	push   %ebx
+  801c23:	83 ec 0c             	sub    $0xc,%esp
+  801c26:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801c29:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  801c2c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c31:	eb 02                	jmp    801c35 <readn+0x18>
+  801c33:	01 c3                	add    %eax,%ebx
+  801c35:	39 f3                	cmp    %esi,%ebx
+  801c37:	73 21                	jae    801c5a <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  801c39:	83 ec 04             	sub    $0x4,%esp
+  801c3c:	89 f0                	mov    %esi,%eax
+  801c3e:	29 d8                	sub    %ebx,%eax
+  801c40:	50                   	push   %eax
+  801c41:	89 d8                	mov    %ebx,%eax
+  801c43:	03 45 0c             	add    0xc(%ebp),%eax
+  801c46:	50                   	push   %eax
+  801c47:	57                   	push   %edi
+  801c48:	e8 49 ff ff ff       	call   801b96 <read>
+    if (m < 0)
+  801c4d:	83 c4 10             	add    $0x10,%esp
+  801c50:	85 c0                	test   %eax,%eax
+  801c52:	78 04                	js     801c58 <readn+0x3b>
+      return m;
+    if (m == 0)
+  801c54:	75 dd                	jne    801c33 <readn+0x16>
+  801c56:	eb 02                	jmp    801c5a <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  801c58:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  801c5a:	89 d8                	mov    %ebx,%eax
+  801c5c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c5f:	5b                   	pop    %ebx
+  801c60:	5e                   	pop    %esi
+  801c61:	5f                   	pop    %edi
+  801c62:	5d                   	pop    %ebp
+  801c63:	c3                   	ret
+
+00801c64 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801c64:	55                   	push   %ebp
+  801c65:	89 e5                	mov    %esp,%ebp
+  801c67:	56                   	push   %esi
+  801c68:	53                   	push   %ebx
+  801c69:	83 ec 18             	sub    $0x18,%esp
+  801c6c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c6f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c72:	50                   	push   %eax
+  801c73:	53                   	push   %ebx
+  801c74:	e8 72 fc ff ff       	call   8018eb <fd_lookup>
+  801c79:	83 c4 10             	add    $0x10,%esp
+  801c7c:	85 c0                	test   %eax,%eax
+  801c7e:	78 37                	js     801cb7 <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c80:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801c83:	83 ec 08             	sub    $0x8,%esp
+  801c86:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c89:	50                   	push   %eax
+  801c8a:	ff 36                	push   (%esi)
+  801c8c:	e8 aa fc ff ff       	call   80193b <dev_lookup>
+  801c91:	83 c4 10             	add    $0x10,%esp
+  801c94:	85 c0                	test   %eax,%eax
+  801c96:	78 1f                	js     801cb7 <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801c98:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801c9c:	74 20                	je     801cbe <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  801c9e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ca1:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ca4:	85 c0                	test   %eax,%eax
+  801ca6:	74 37                	je     801cdf <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  801ca8:	83 ec 04             	sub    $0x4,%esp
+  801cab:	ff 75 10             	push   0x10(%ebp)
+  801cae:	ff 75 0c             	push   0xc(%ebp)
+  801cb1:	56                   	push   %esi
+  801cb2:	ff d0                	call   *%eax
+  801cb4:	83 c4 10             	add    $0x10,%esp
+}
+  801cb7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cba:	5b                   	pop    %ebx
+  801cbb:	5e                   	pop    %esi
+  801cbc:	5d                   	pop    %ebp
+  801cbd:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801cbe:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  801cc3:	8b 40 48             	mov    0x48(%eax),%eax
+  801cc6:	83 ec 04             	sub    $0x4,%esp
+  801cc9:	53                   	push   %ebx
+  801cca:	50                   	push   %eax
+  801ccb:	68 1d 41 80 00       	push   $0x80411d
+  801cd0:	e8 39 e7 ff ff       	call   80040e <cprintf>
+    return -E_INVAL;
+  801cd5:	83 c4 10             	add    $0x10,%esp
+  801cd8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801cdd:	eb d8                	jmp    801cb7 <write+0x53>
+    return -E_NOT_SUPP;
+  801cdf:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ce4:	eb d1                	jmp    801cb7 <write+0x53>
+
+00801ce6 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801ce6:	55                   	push   %ebp
+  801ce7:	89 e5                	mov    %esp,%ebp
+  801ce9:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801cec:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cef:	50                   	push   %eax
+  801cf0:	ff 75 08             	push   0x8(%ebp)
+  801cf3:	e8 f3 fb ff ff       	call   8018eb <fd_lookup>
+  801cf8:	83 c4 10             	add    $0x10,%esp
+  801cfb:	85 c0                	test   %eax,%eax
+  801cfd:	78 0e                	js     801d0d <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  801cff:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801d02:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d05:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  801d08:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d0d:	c9                   	leave
+  801d0e:	c3                   	ret
+
+00801d0f <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801d0f:	55                   	push   %ebp
+  801d10:	89 e5                	mov    %esp,%ebp
+  801d12:	56                   	push   %esi
+  801d13:	53                   	push   %ebx
+  801d14:	83 ec 18             	sub    $0x18,%esp
+  801d17:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d1a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d1d:	50                   	push   %eax
+  801d1e:	53                   	push   %ebx
+  801d1f:	e8 c7 fb ff ff       	call   8018eb <fd_lookup>
+  801d24:	83 c4 10             	add    $0x10,%esp
+  801d27:	85 c0                	test   %eax,%eax
+  801d29:	78 34                	js     801d5f <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d2b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d2e:	83 ec 08             	sub    $0x8,%esp
+  801d31:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d34:	50                   	push   %eax
+  801d35:	ff 36                	push   (%esi)
+  801d37:	e8 ff fb ff ff       	call   80193b <dev_lookup>
+  801d3c:	83 c4 10             	add    $0x10,%esp
+  801d3f:	85 c0                	test   %eax,%eax
+  801d41:	78 1c                	js     801d5f <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d43:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801d47:	74 1d                	je     801d66 <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  801d49:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d4c:	8b 40 18             	mov    0x18(%eax),%eax
+  801d4f:	85 c0                	test   %eax,%eax
+  801d51:	74 34                	je     801d87 <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  801d53:	83 ec 08             	sub    $0x8,%esp
+  801d56:	ff 75 0c             	push   0xc(%ebp)
+  801d59:	56                   	push   %esi
+  801d5a:	ff d0                	call   *%eax
+  801d5c:	83 c4 10             	add    $0x10,%esp
+}
+  801d5f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d62:	5b                   	pop    %ebx
+  801d63:	5e                   	pop    %esi
+  801d64:	5d                   	pop    %ebp
+  801d65:	c3                   	ret
+            thisenv->env_id, fdnum);
+  801d66:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  801d6b:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801d6e:	83 ec 04             	sub    $0x4,%esp
+  801d71:	53                   	push   %ebx
+  801d72:	50                   	push   %eax
+  801d73:	68 e0 40 80 00       	push   $0x8040e0
+  801d78:	e8 91 e6 ff ff       	call   80040e <cprintf>
+    return -E_INVAL;
+  801d7d:	83 c4 10             	add    $0x10,%esp
+  801d80:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d85:	eb d8                	jmp    801d5f <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  801d87:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d8c:	eb d1                	jmp    801d5f <ftruncate+0x50>
+
+00801d8e <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801d8e:	55                   	push   %ebp
+  801d8f:	89 e5                	mov    %esp,%ebp
+  801d91:	56                   	push   %esi
+  801d92:	53                   	push   %ebx
+  801d93:	83 ec 18             	sub    $0x18,%esp
+  801d96:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d99:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d9c:	50                   	push   %eax
+  801d9d:	ff 75 08             	push   0x8(%ebp)
+  801da0:	e8 46 fb ff ff       	call   8018eb <fd_lookup>
+  801da5:	83 c4 10             	add    $0x10,%esp
+  801da8:	85 c0                	test   %eax,%eax
+  801daa:	78 49                	js     801df5 <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801dac:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801daf:	83 ec 08             	sub    $0x8,%esp
+  801db2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801db5:	50                   	push   %eax
+  801db6:	ff 36                	push   (%esi)
+  801db8:	e8 7e fb ff ff       	call   80193b <dev_lookup>
+  801dbd:	83 c4 10             	add    $0x10,%esp
+  801dc0:	85 c0                	test   %eax,%eax
+  801dc2:	78 31                	js     801df5 <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  801dc4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801dc7:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801dcb:	74 2f                	je     801dfc <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  801dcd:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  801dd0:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801dd7:	00 00 00 
+  stat->st_isdir = 0;
+  801dda:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801de1:	00 00 00 
+  stat->st_dev = dev;
+  801de4:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  801dea:	83 ec 08             	sub    $0x8,%esp
+  801ded:	53                   	push   %ebx
+  801dee:	56                   	push   %esi
+  801def:	ff 50 14             	call   *0x14(%eax)
+  801df2:	83 c4 10             	add    $0x10,%esp
+}
+  801df5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801df8:	5b                   	pop    %ebx
+  801df9:	5e                   	pop    %esi
+  801dfa:	5d                   	pop    %ebp
+  801dfb:	c3                   	ret
+    return -E_NOT_SUPP;
+  801dfc:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801e01:	eb f2                	jmp    801df5 <fstat+0x67>
+
+00801e03 <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  801e03:	55                   	push   %ebp
+  801e04:	89 e5                	mov    %esp,%ebp
+  801e06:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  801e09:	ff 75 0c             	push   0xc(%ebp)
+  801e0c:	ff 75 08             	push   0x8(%ebp)
+  801e0f:	e8 58 07 00 00       	call   80256c <file_stat>
+}
+  801e14:	c9                   	leave
+  801e15:	c3                   	ret
+
+00801e16 <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  801e16:	55                   	push   %ebp
+  801e17:	89 e5                	mov    %esp,%ebp
+  801e19:	57                   	push   %edi
+  801e1a:	56                   	push   %esi
+  801e1b:	53                   	push   %ebx
+  801e1c:	83 ec 1c             	sub    $0x1c,%esp
+  801e1f:	89 c7                	mov    %eax,%edi
+  801e21:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801e24:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801e27:	e9 a2 00 00 00       	jmp    801ece <fsipc_send+0xb8>
+  nfsenvs = 0;
+  801e2c:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  801e33:	00 00 00 
+  801e36:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e3b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801e40:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801e45:	be 01 00 00 00       	mov    $0x1,%esi
+  801e4a:	eb 0f                	jmp    801e5b <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801e4c:	83 c0 01             	add    $0x1,%eax
+  801e4f:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801e54:	74 49                	je     801e9f <fsipc_send+0x89>
+  801e56:	83 f9 07             	cmp    $0x7,%ecx
+  801e59:	7f 50                	jg     801eab <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  801e5b:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801e5e:	c1 e2 04             	shl    $0x4,%edx
+  801e61:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801e67:	8b 52 50             	mov    0x50(%edx),%edx
+  801e6a:	83 fa 01             	cmp    $0x1,%edx
+  801e6d:	75 dd                	jne    801e4c <fsipc_send+0x36>
+  801e6f:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801e72:	c1 e2 04             	shl    $0x4,%edx
+  801e75:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801e7b:	8b 52 54             	mov    0x54(%edx),%edx
+  801e7e:	85 d2                	test   %edx,%edx
+  801e80:	74 ca                	je     801e4c <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801e82:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801e85:	c1 e2 04             	shl    $0x4,%edx
+  801e88:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801e8e:	8b 52 48             	mov    0x48(%edx),%edx
+  801e91:	89 14 8d 20 60 80 00 	mov    %edx,0x806020(,%ecx,4)
+  801e98:	8d 49 01             	lea    0x1(%ecx),%ecx
+  801e9b:	89 f3                	mov    %esi,%ebx
+  801e9d:	eb ad                	jmp    801e4c <fsipc_send+0x36>
+  801e9f:	84 db                	test   %bl,%bl
+  801ea1:	74 38                	je     801edb <fsipc_send+0xc5>
+  801ea3:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+  801ea9:	eb 30                	jmp    801edb <fsipc_send+0xc5>
+  801eab:	84 db                	test   %bl,%bl
+  801ead:	74 2c                	je     801edb <fsipc_send+0xc5>
+  801eaf:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+  801eb5:	eb 24                	jmp    801edb <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  801eb7:	50                   	push   %eax
+  801eb8:	68 4c 41 80 00       	push   $0x80414c
+  801ebd:	6a 34                	push   $0x34
+  801ebf:	68 56 41 80 00       	push   $0x804156
+  801ec4:	e8 6a e4 ff ff       	call   800333 <_panic>
+    }
+    sys_yield();
+  801ec9:	e8 fb ee ff ff       	call   800dc9 <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  801ece:	83 3d 00 60 80 00 03 	cmpl   $0x3,0x806000
+  801ed5:	0f 8e 51 ff ff ff    	jle    801e2c <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  801edb:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  801ee0:	8b 70 48             	mov    0x48(%eax),%esi
+  801ee3:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  801ee9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801eee:	8b 0d 00 60 80 00    	mov    0x806000,%ecx
+  801ef4:	39 d9                	cmp    %ebx,%ecx
+  801ef6:	7e d1                	jle    801ec9 <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  801ef8:	83 ec 0c             	sub    $0xc,%esp
+  801efb:	ff 75 e0             	push   -0x20(%ebp)
+  801efe:	6a 07                	push   $0x7
+  801f00:	ff 75 e4             	push   -0x1c(%ebp)
+  801f03:	57                   	push   %edi
+  801f04:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  801f07:	99                   	cltd
+  801f08:	f7 f9                	idiv   %ecx
+  801f0a:	ff 34 95 20 60 80 00 	push   0x806020(,%edx,4)
+  801f11:	e8 cc f1 ff ff       	call   8010e2 <sys_ipc_try_send>
+      if (r == 0)
+  801f16:	83 c4 20             	add    $0x20,%esp
+  801f19:	85 c0                	test   %eax,%eax
+  801f1b:	74 0a                	je     801f27 <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  801f1d:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801f20:	75 95                	jne    801eb7 <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  801f22:	83 c3 01             	add    $0x1,%ebx
+  801f25:	eb c7                	jmp    801eee <fsipc_send+0xd8>
+  }
+}
+  801f27:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f2a:	5b                   	pop    %ebx
+  801f2b:	5e                   	pop    %esi
+  801f2c:	5f                   	pop    %edi
+  801f2d:	5d                   	pop    %ebp
+  801f2e:	c3                   	ret
+
+00801f2f <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801f2f:	55                   	push   %ebp
+  801f30:	89 e5                	mov    %esp,%ebp
+  801f32:	53                   	push   %ebx
+  801f33:	83 ec 14             	sub    $0x14,%esp
+  801f36:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  801f38:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  801f3f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801f44:	ba 00 70 80 00       	mov    $0x807000,%edx
+  801f49:	e8 c8 fe ff ff       	call   801e16 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801f4e:	6a 00                	push   $0x0
+  801f50:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f53:	50                   	push   %eax
+  801f54:	53                   	push   %ebx
+  801f55:	6a 00                	push   $0x0
+  801f57:	e8 b2 f7 ff ff       	call   80170e <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  801f5c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f5f:	c9                   	leave
+  801f60:	c3                   	ret
+
+00801f61 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801f61:	55                   	push   %ebp
+  801f62:	89 e5                	mov    %esp,%ebp
+  801f64:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801f67:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f6a:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f6d:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.set_size.req_size = newsize;
+  801f72:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f75:	a3 04 70 80 00       	mov    %eax,0x807004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801f7a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f7f:	b8 02 00 00 00       	mov    $0x2,%eax
+  801f84:	e8 a6 ff ff ff       	call   801f2f <fsipc>
+}
+  801f89:	c9                   	leave
+  801f8a:	c3                   	ret
+
+00801f8b <devfile_flush>:
+{
+  801f8b:	55                   	push   %ebp
+  801f8c:	89 e5                	mov    %esp,%ebp
+  801f8e:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801f91:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f94:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f97:	a3 00 70 80 00       	mov    %eax,0x807000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801f9c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fa1:	b8 06 00 00 00       	mov    $0x6,%eax
+  801fa6:	e8 84 ff ff ff       	call   801f2f <fsipc>
+}
+  801fab:	c9                   	leave
+  801fac:	c3                   	ret
+
+00801fad <devfile_stat>:
+{
+  801fad:	55                   	push   %ebp
+  801fae:	89 e5                	mov    %esp,%ebp
+  801fb0:	53                   	push   %ebx
+  801fb1:	83 ec 04             	sub    $0x4,%esp
+  801fb4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801fb7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fba:	8b 40 0c             	mov    0xc(%eax),%eax
+  801fbd:	a3 00 70 80 00       	mov    %eax,0x807000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801fc2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fc7:	b8 05 00 00 00       	mov    $0x5,%eax
+  801fcc:	e8 5e ff ff ff       	call   801f2f <fsipc>
+  801fd1:	85 c0                	test   %eax,%eax
+  801fd3:	78 2c                	js     802001 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801fd5:	83 ec 08             	sub    $0x8,%esp
+  801fd8:	68 00 70 80 00       	push   $0x807000
+  801fdd:	53                   	push   %ebx
+  801fde:	e8 19 ea ff ff       	call   8009fc <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  801fe3:	a1 80 70 80 00       	mov    0x807080,%eax
+  801fe8:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801fee:	a1 84 70 80 00       	mov    0x807084,%eax
+  801ff3:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801ff9:	83 c4 10             	add    $0x10,%esp
+  801ffc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802001:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802004:	c9                   	leave
+  802005:	c3                   	ret
+
+00802006 <fsv_alloc>:
+{
+  802006:	55                   	push   %ebp
+  802007:	89 e5                	mov    %esp,%ebp
+  802009:	56                   	push   %esi
+  80200a:	53                   	push   %ebx
+  80200b:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  80200d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802012:	eb 22                	jmp    802036 <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  802014:	83 ec 04             	sub    $0x4,%esp
+  802017:	6a 00                	push   $0x0
+  802019:	6a 00                	push   $0x0
+  80201b:	6a 07                	push   $0x7
+  80201d:	50                   	push   %eax
+  80201e:	6a 00                	push   $0x0
+  802020:	6a 04                	push   $0x4
+  802022:	68 40 60 80 00       	push   $0x806040
+  802027:	e8 52 f2 ff ff       	call   80127e <sysbatch_add>
+  80202c:	83 c4 20             	add    $0x20,%esp
+  80202f:	85 c0                	test   %eax,%eax
+  802031:	78 48                	js     80207b <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  802033:	83 c3 01             	add    $0x1,%ebx
+  802036:	39 f3                	cmp    %esi,%ebx
+  802038:	74 31                	je     80206b <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  80203a:	89 d8                	mov    %ebx,%eax
+  80203c:	c1 e0 0c             	shl    $0xc,%eax
+  80203f:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  802044:	89 c2                	mov    %eax,%edx
+  802046:	c1 ea 16             	shr    $0x16,%edx
+  802049:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802050:	f6 c2 01             	test   $0x1,%dl
+  802053:	74 bf                	je     802014 <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  802055:	89 c2                	mov    %eax,%edx
+  802057:	c1 ea 0c             	shr    $0xc,%edx
+  80205a:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802061:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  802064:	83 fa 03             	cmp    $0x3,%edx
+  802067:	75 ab                	jne    802014 <fsv_alloc+0xe>
+  802069:	eb c8                	jmp    802033 <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  80206b:	83 ec 0c             	sub    $0xc,%esp
+  80206e:	68 40 60 80 00       	push   $0x806040
+  802073:	e8 b6 f1 ff ff       	call   80122e <sysbatch_flush>
+  802078:	83 c4 10             	add    $0x10,%esp
+}
+  80207b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80207e:	5b                   	pop    %ebx
+  80207f:	5e                   	pop    %esi
+  802080:	5d                   	pop    %ebp
+  802081:	c3                   	ret
+
+00802082 <devfile_read>:
+{
+  802082:	55                   	push   %ebp
+  802083:	89 e5                	mov    %esp,%ebp
+  802085:	57                   	push   %edi
+  802086:	56                   	push   %esi
+  802087:	53                   	push   %ebx
+  802088:	83 ec 3c             	sub    $0x3c,%esp
+  80208b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  80208e:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  802094:	77 57                	ja     8020ed <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802096:	8b 45 08             	mov    0x8(%ebp),%eax
+  802099:	8b 40 0c             	mov    0xc(%eax),%eax
+  80209c:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.read.req_n = n;
+  8020a1:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8020a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020ac:	b8 03 00 00 00       	mov    $0x3,%eax
+  8020b1:	e8 79 fe ff ff       	call   801f2f <fsipc>
+  8020b6:	89 c6                	mov    %eax,%esi
+  8020b8:	85 c0                	test   %eax,%eax
+  8020ba:	78 27                	js     8020e3 <devfile_read+0x61>
+  assert(r <= n);
+  8020bc:	39 c3                	cmp    %eax,%ebx
+  8020be:	0f 82 0e 02 00 00    	jb     8022d2 <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  8020c4:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8020c9:	0f 8f 1c 02 00 00    	jg     8022eb <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8020cf:	83 ec 04             	sub    $0x4,%esp
+  8020d2:	50                   	push   %eax
+  8020d3:	68 00 70 80 00       	push   $0x807000
+  8020d8:	ff 75 0c             	push   0xc(%ebp)
+  8020db:	e8 a2 ea ff ff       	call   800b82 <memmove>
+  return r;
+  8020e0:	83 c4 10             	add    $0x10,%esp
+}
+  8020e3:	89 f0                	mov    %esi,%eax
+  8020e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020e8:	5b                   	pop    %ebx
+  8020e9:	5e                   	pop    %esi
+  8020ea:	5f                   	pop    %edi
+  8020eb:	5d                   	pop    %ebp
+  8020ec:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  8020ed:	b8 01 00 00 00       	mov    $0x1,%eax
+  8020f2:	e8 0f ff ff ff       	call   802006 <fsv_alloc>
+  8020f7:	89 c6                	mov    %eax,%esi
+  8020f9:	85 c0                	test   %eax,%eax
+  8020fb:	78 e6                	js     8020e3 <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  8020fd:	8b 45 08             	mov    0x8(%ebp),%eax
+  802100:	8b 40 0c             	mov    0xc(%eax),%eax
+  802103:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  802108:	8b 45 08             	mov    0x8(%ebp),%eax
+  80210b:	8b 40 04             	mov    0x4(%eax),%eax
+  80210e:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  802113:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  802119:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  802120:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802125:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  80212a:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80212f:	e8 e2 fc ff ff       	call   801e16 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  802134:	6a 00                	push   $0x0
+  802136:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802139:	50                   	push   %eax
+  80213a:	68 00 10 c0 9f       	push   $0x9fc01000
+  80213f:	6a 00                	push   $0x0
+  802141:	e8 c8 f5 ff ff       	call   80170e <ipc_recv_pages>
+  802146:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  802148:	83 c4 10             	add    $0x10,%esp
+  80214b:	85 c0                	test   %eax,%eax
+  80214d:	7e 94                	jle    8020e3 <devfile_read+0x61>
+  assert(r <= n);
+  80214f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802152:	39 c3                	cmp    %eax,%ebx
+  802154:	72 2e                	jb     802184 <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  802156:	8b 45 08             	mov    0x8(%ebp),%eax
+  802159:	8b 40 04             	mov    0x4(%eax),%eax
+  80215c:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802161:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  802164:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802167:	c1 e2 0c             	shl    $0xc,%edx
+  80216a:	39 ca                	cmp    %ecx,%edx
+  80216c:	72 2f                	jb     80219d <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  80216e:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  802173:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  802176:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  80217a:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  80217f:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  802182:	eb 52                	jmp    8021d6 <devfile_read+0x154>
+  assert(r <= n);
+  802184:	68 61 41 80 00       	push   $0x804161
+  802189:	68 68 41 80 00       	push   $0x804168
+  80218e:	68 49 01 00 00       	push   $0x149
+  802193:	68 56 41 80 00       	push   $0x804156
+  802198:	e8 96 e1 ff ff       	call   800333 <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  80219d:	68 8c 41 80 00       	push   $0x80418c
+  8021a2:	68 68 41 80 00       	push   $0x804168
+  8021a7:	68 4a 01 00 00       	push   $0x14a
+  8021ac:	68 56 41 80 00       	push   $0x804156
+  8021b1:	e8 7d e1 ff ff       	call   800333 <_panic>
+      memmove(dst + done, src + done, m);
+  8021b6:	83 ec 04             	sub    $0x4,%esp
+  8021b9:	53                   	push   %ebx
+  8021ba:	56                   	push   %esi
+  8021bb:	89 f8                	mov    %edi,%eax
+  8021bd:	03 45 0c             	add    0xc(%ebp),%eax
+  8021c0:	50                   	push   %eax
+  8021c1:	e8 bc e9 ff ff       	call   800b82 <memmove>
+  8021c6:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  8021c9:	01 df                	add    %ebx,%edi
+  8021cb:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8021ce:	39 c7                	cmp    %eax,%edi
+  8021d0:	0f 83 c0 00 00 00    	jae    802296 <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  8021d6:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8021d9:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  8021dc:	89 f0                	mov    %esi,%eax
+  8021de:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8021e3:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  8021e8:	29 c3                	sub    %eax,%ebx
+  8021ea:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8021ed:	29 f8                	sub    %edi,%eax
+  8021ef:	39 c3                	cmp    %eax,%ebx
+  8021f1:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  8021f4:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  8021fa:	75 ba                	jne    8021b6 <devfile_read+0x134>
+  8021fc:	89 f9                	mov    %edi,%ecx
+  8021fe:	03 4d 0c             	add    0xc(%ebp),%ecx
+  802201:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  802204:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  80220a:	75 aa                	jne    8021b6 <devfile_read+0x134>
+  80220c:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  802212:	77 a2                	ja     8021b6 <devfile_read+0x134>
+  802214:	89 c8                	mov    %ecx,%eax
+  802216:	c1 e8 16             	shr    $0x16,%eax
+  802219:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802220:	a8 01                	test   $0x1,%al
+  802222:	74 92                	je     8021b6 <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  802224:	89 c8                	mov    %ecx,%eax
+  802226:	c1 e8 0c             	shr    $0xc,%eax
+  802229:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  802230:	a8 01                	test   $0x1,%al
+  802232:	74 82                	je     8021b6 <devfile_read+0x134>
+  802234:	a9 02 08 00 00       	test   $0x802,%eax
+  802239:	0f 84 77 ff ff ff    	je     8021b6 <devfile_read+0x134>
+  80223f:	f6 c4 04             	test   $0x4,%ah
+  802242:	0f 85 6e ff ff ff    	jne    8021b6 <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  802248:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  80224d:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  802251:	84 c0                	test   %al,%al
+  802253:	75 17                	jne    80226c <devfile_read+0x1ea>
+  802255:	83 ec 08             	sub    $0x8,%esp
+  802258:	6a 01                	push   $0x1
+  80225a:	6a 00                	push   $0x0
+  80225c:	e8 87 eb ff ff       	call   800de8 <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  802261:	83 c4 10             	add    $0x10,%esp
+  802264:	85 c0                	test   %eax,%eax
+  802266:	0f 85 4a ff ff ff    	jne    8021b6 <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  80226c:	83 ec 04             	sub    $0x4,%esp
+  80226f:	68 05 08 00 00       	push   $0x805
+  802274:	ff 75 cc             	push   -0x34(%ebp)
+  802277:	6a 00                	push   $0x0
+  802279:	56                   	push   %esi
+  80227a:	6a 00                	push   $0x0
+  80227c:	6a 05                	push   $0x5
+  80227e:	68 40 60 80 00       	push   $0x806040
+  802283:	e8 f6 ef ff ff       	call   80127e <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  802288:	c1 e8 1f             	shr    $0x1f,%eax
+  80228b:	08 45 cb             	or     %al,-0x35(%ebp)
+  80228e:	83 c4 20             	add    $0x20,%esp
+  802291:	e9 33 ff ff ff       	jmp    8021c9 <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  802296:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  802299:	83 ec 0c             	sub    $0xc,%esp
+  80229c:	68 40 60 80 00       	push   $0x806040
+  8022a1:	e8 88 ef ff ff       	call   80122e <sysbatch_flush>
+  8022a6:	83 c4 10             	add    $0x10,%esp
+  8022a9:	85 c0                	test   %eax,%eax
+  8022ab:	78 06                	js     8022b3 <devfile_read+0x231>
+  8022ad:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  8022b1:	74 14                	je     8022c7 <devfile_read+0x245>
+    memmove(dst, src, r);
+  8022b3:	83 ec 04             	sub    $0x4,%esp
+  8022b6:	ff 75 d4             	push   -0x2c(%ebp)
+  8022b9:	ff 75 d0             	push   -0x30(%ebp)
+  8022bc:	ff 75 0c             	push   0xc(%ebp)
+  8022bf:	e8 be e8 ff ff       	call   800b82 <memmove>
+  8022c4:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  8022c7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022ca:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  8022cd:	e9 11 fe ff ff       	jmp    8020e3 <devfile_read+0x61>
+  assert(r <= n);
+  8022d2:	68 61 41 80 00       	push   $0x804161
+  8022d7:	68 68 41 80 00       	push   $0x804168
+  8022dc:	68 1c 01 00 00       	push   $0x11c
+  8022e1:	68 56 41 80 00       	push   $0x804156
+  8022e6:	e8 48 e0 ff ff       	call   800333 <_panic>
+  assert(r <= PGSIZE);
+  8022eb:	68 7d 41 80 00       	push   $0x80417d
+  8022f0:	68 68 41 80 00       	push   $0x804168
+  8022f5:	68 1d 01 00 00       	push   $0x11d
+  8022fa:	68 56 41 80 00       	push   $0x804156
+  8022ff:	e8 2f e0 ff ff       	call   800333 <_panic>
+
+00802304 <devfile_write>:
+{
+  802304:	55                   	push   %ebp
+  802305:	89 e5                	mov    %esp,%ebp
+  802307:	57                   	push   %edi
+  802308:	56                   	push   %esi
+  802309:	53                   	push   %ebx
+  80230a:	83 ec 1c             	sub    $0x1c,%esp
+  80230d:	8b 75 08             	mov    0x8(%ebp),%esi
+  802310:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  802313:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  802318:	77 39                	ja     802353 <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80231a:	8b 56 0c             	mov    0xc(%esi),%edx
+  80231d:	89 15 00 70 80 00    	mov    %edx,0x807000
+  fsipcbuf.write.req_n = n;
+  802323:	a3 04 70 80 00       	mov    %eax,0x807004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  802328:	83 ec 04             	sub    $0x4,%esp
+  80232b:	50                   	push   %eax
+  80232c:	ff 75 0c             	push   0xc(%ebp)
+  80232f:	68 08 70 80 00       	push   $0x807008
+  802334:	e8 49 e8 ff ff       	call   800b82 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  802339:	ba 00 00 00 00       	mov    $0x0,%edx
+  80233e:	b8 04 00 00 00       	mov    $0x4,%eax
+  802343:	e8 e7 fb ff ff       	call   801f2f <fsipc>
+  802348:	83 c4 10             	add    $0x10,%esp
+}
+  80234b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80234e:	5b                   	pop    %ebx
+  80234f:	5e                   	pop    %esi
+  802350:	5f                   	pop    %edi
+  802351:	5d                   	pop    %ebp
+  802352:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  802353:	ba 00 00 10 00       	mov    $0x100000,%edx
+  802358:	39 d0                	cmp    %edx,%eax
+  80235a:	89 d3                	mov    %edx,%ebx
+  80235c:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  80235f:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  802365:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  802368:	83 c7 01             	add    $0x1,%edi
+  80236b:	89 f8                	mov    %edi,%eax
+  80236d:	e8 94 fc ff ff       	call   802006 <fsv_alloc>
+  802372:	85 c0                	test   %eax,%eax
+  802374:	78 d5                	js     80234b <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  802376:	83 ec 04             	sub    $0x4,%esp
+  802379:	53                   	push   %ebx
+  80237a:	ff 75 0c             	push   0xc(%ebp)
+  80237d:	68 00 10 c0 9f       	push   $0x9fc01000
+  802382:	e8 fb e7 ff ff       	call   800b82 <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  802387:	8b 46 0c             	mov    0xc(%esi),%eax
+  80238a:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  80238f:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  802395:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  80239c:	89 f9                	mov    %edi,%ecx
+  80239e:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  8023a3:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8023a8:	e8 69 fa ff ff       	call   801e16 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  8023ad:	6a 00                	push   $0x0
+  8023af:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8023b2:	50                   	push   %eax
+  8023b3:	6a 00                	push   $0x0
+  8023b5:	6a 00                	push   $0x0
+  8023b7:	e8 52 f3 ff ff       	call   80170e <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  8023bc:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  8023bf:	eb 8a                	jmp    80234b <devfile_write+0x47>
+
+008023c1 <open>:
+{
+  8023c1:	55                   	push   %ebp
+  8023c2:	89 e5                	mov    %esp,%ebp
+  8023c4:	56                   	push   %esi
+  8023c5:	53                   	push   %ebx
+  8023c6:	83 ec 1c             	sub    $0x1c,%esp
+  8023c9:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  8023cc:	56                   	push   %esi
+  8023cd:	e8 ef e5 ff ff       	call   8009c1 <strlen>
+  8023d2:	83 c4 10             	add    $0x10,%esp
+  8023d5:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8023da:	7f 6c                	jg     802448 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  8023dc:	83 ec 0c             	sub    $0xc,%esp
+  8023df:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023e2:	50                   	push   %eax
+  8023e3:	e8 ad f4 ff ff       	call   801895 <fd_alloc>
+  8023e8:	89 c3                	mov    %eax,%ebx
+  8023ea:	83 c4 10             	add    $0x10,%esp
+  8023ed:	85 c0                	test   %eax,%eax
+  8023ef:	78 3c                	js     80242d <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  8023f1:	83 ec 08             	sub    $0x8,%esp
+  8023f4:	56                   	push   %esi
+  8023f5:	68 00 70 80 00       	push   $0x807000
+  8023fa:	e8 fd e5 ff ff       	call   8009fc <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  8023ff:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802402:	a3 00 74 80 00       	mov    %eax,0x807400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802407:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80240a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80240f:	e8 1b fb ff ff       	call   801f2f <fsipc>
+  802414:	89 c3                	mov    %eax,%ebx
+  802416:	83 c4 10             	add    $0x10,%esp
+  802419:	85 c0                	test   %eax,%eax
+  80241b:	78 19                	js     802436 <open+0x75>
+  return fd2num(fd);
+  80241d:	83 ec 0c             	sub    $0xc,%esp
+  802420:	ff 75 f4             	push   -0xc(%ebp)
+  802423:	e8 49 f4 ff ff       	call   801871 <fd2num>
+  802428:	89 c3                	mov    %eax,%ebx
+  80242a:	83 c4 10             	add    $0x10,%esp
+}
+  80242d:	89 d8                	mov    %ebx,%eax
+  80242f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802432:	5b                   	pop    %ebx
+  802433:	5e                   	pop    %esi
+  802434:	5d                   	pop    %ebp
+  802435:	c3                   	ret
+    fd_close(fd, 0);
+  802436:	83 ec 08             	sub    $0x8,%esp
+  802439:	6a 00                	push   $0x0
+  80243b:	ff 75 f4             	push   -0xc(%ebp)
+  80243e:	e8 44 f5 ff ff       	call   801987 <fd_close>
+    return r;
+  802443:	83 c4 10             	add    $0x10,%esp
+  802446:	eb e5                	jmp    80242d <open+0x6c>
+    return -E_BAD_PATH;
+  802448:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80244d:	eb de                	jmp    80242d <open+0x6c>
+
+0080244f <open_read>:
+{
+  80244f:	55                   	push   %ebp
+  802450:	89 e5                	mov    %esp,%ebp
+  802452:	57                   	push   %edi
+  802453:	56                   	push   %esi
+  802454:	53                   	push   %ebx
+  802455:	83 ec 28             	sub    $0x28,%esp
+  802458:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  80245b:	57                   	push   %edi
+  80245c:	e8 60 e5 ff ff       	call   8009c1 <strlen>
+  802461:	83 c4 10             	add    $0x10,%esp
+  802464:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802469:	0f 87 f6 00 00 00    	ja     802565 <open_read+0x116>
+  80246f:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  802471:	83 ec 0c             	sub    $0xc,%esp
+  802474:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802477:	50                   	push   %eax
+  802478:	e8 18 f4 ff ff       	call   801895 <fd_alloc>
+  80247d:	89 c3                	mov    %eax,%ebx
+  80247f:	83 c4 10             	add    $0x10,%esp
+  802482:	85 c0                	test   %eax,%eax
+  802484:	0f 88 b2 00 00 00    	js     80253c <open_read+0xed>
+  strcpy(req->req_buf, path);
+  80248a:	83 ec 08             	sub    $0x8,%esp
+  80248d:	57                   	push   %edi
+  80248e:	68 e4 70 80 00       	push   $0x8070e4
+  802493:	e8 64 e5 ff ff       	call   8009fc <strcpy>
+  req->req_nops = 2;
+  802498:	c7 05 00 70 80 00 02 	movl   $0x2,0x807000
+  80249f:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  8024a2:	c7 05 04 70 80 00 01 	movl   $0x1,0x807004
+  8024a9:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  8024ac:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8024af:	a3 10 70 80 00       	mov    %eax,0x807010
+  req->req_ops[0].op_buf = 0;
+  8024b4:	c7 05 18 70 80 00 00 	movl   $0x0,0x807018
+  8024bb:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  8024be:	c7 05 20 70 80 00 04 	movl   $0x4,0x807020
+  8024c5:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  8024c8:	c7 05 24 70 80 00 01 	movl   $0x1,0x807024
+  8024cf:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  8024d2:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  8024d7:	29 f0                	sub    %esi,%eax
+  8024d9:	3b 45 14             	cmp    0x14(%ebp),%eax
+  8024dc:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  8024e0:	a3 2c 70 80 00       	mov    %eax,0x80702c
+  req->req_ops[1].op_offset = 0;
+  8024e5:	c7 05 30 70 80 00 00 	movl   $0x0,0x807030
+  8024ec:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  8024ef:	83 c6 01             	add    $0x1,%esi
+  8024f2:	89 35 34 70 80 00    	mov    %esi,0x807034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  8024f8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8024fb:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802500:	e8 2a fa ff ff       	call   801f2f <fsipc>
+  802505:	89 c3                	mov    %eax,%ebx
+  802507:	83 c4 10             	add    $0x10,%esp
+  80250a:	83 f8 01             	cmp    $0x1,%eax
+  80250d:	7e 37                	jle    802546 <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  80250f:	a1 38 70 80 00       	mov    0x807038,%eax
+  802514:	8b 55 18             	mov    0x18(%ebp),%edx
+  802517:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  802519:	83 ec 04             	sub    $0x4,%esp
+  80251c:	50                   	push   %eax
+  80251d:	81 c6 e4 70 80 00    	add    $0x8070e4,%esi
+  802523:	56                   	push   %esi
+  802524:	ff 75 10             	push   0x10(%ebp)
+  802527:	e8 56 e6 ff ff       	call   800b82 <memmove>
+  return fd2num(fd);
+  80252c:	83 c4 04             	add    $0x4,%esp
+  80252f:	ff 75 e4             	push   -0x1c(%ebp)
+  802532:	e8 3a f3 ff ff       	call   801871 <fd2num>
+  802537:	89 c3                	mov    %eax,%ebx
+  802539:	83 c4 10             	add    $0x10,%esp
+}
+  80253c:	89 d8                	mov    %ebx,%eax
+  80253e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802541:	5b                   	pop    %ebx
+  802542:	5e                   	pop    %esi
+  802543:	5f                   	pop    %edi
+  802544:	5d                   	pop    %ebp
+  802545:	c3                   	ret
+    fd_close(fd, 0);
+  802546:	83 ec 08             	sub    $0x8,%esp
+  802549:	6a 00                	push   $0x0
+  80254b:	ff 75 e4             	push   -0x1c(%ebp)
+  80254e:	e8 34 f4 ff ff       	call   801987 <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  802553:	83 c4 10             	add    $0x10,%esp
+  802556:	85 db                	test   %ebx,%ebx
+  802558:	78 e2                	js     80253c <open_read+0xed>
+  80255a:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  80255d:	8b 9b 1c 70 80 00    	mov    0x80701c(%ebx),%ebx
+  802563:	eb d7                	jmp    80253c <open_read+0xed>
+    return -E_BAD_PATH;
+  802565:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80256a:	eb d0                	jmp    80253c <open_read+0xed>
+
+0080256c <file_stat>:
+{
+  80256c:	55                   	push   %ebp
+  80256d:	89 e5                	mov    %esp,%ebp
+  80256f:	57                   	push   %edi
+  802570:	56                   	push   %esi
+  802571:	53                   	push   %ebx
+  802572:	83 ec 18             	sub    $0x18,%esp
+  802575:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802578:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  80257b:	57                   	push   %edi
+  80257c:	e8 40 e4 ff ff       	call   8009c1 <strlen>
+  802581:	83 c4 10             	add    $0x10,%esp
+  802584:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802589:	0f 8f c7 00 00 00    	jg     802656 <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  80258f:	83 ec 0c             	sub    $0xc,%esp
+  802592:	57                   	push   %edi
+  802593:	e8 29 e4 ff ff       	call   8009c1 <strlen>
+  802598:	8d 58 04             	lea    0x4(%eax),%ebx
+  80259b:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  80259e:	83 c4 08             	add    $0x8,%esp
+  8025a1:	57                   	push   %edi
+  8025a2:	68 e4 70 80 00       	push   $0x8070e4
+  8025a7:	e8 50 e4 ff ff       	call   8009fc <strcpy>
+  req->req_nops = 2;
+  8025ac:	c7 05 00 70 80 00 02 	movl   $0x2,0x807000
+  8025b3:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  8025b6:	c7 05 04 70 80 00 02 	movl   $0x2,0x807004
+  8025bd:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  8025c0:	c7 05 10 70 80 00 00 	movl   $0x0,0x807010
+  8025c7:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  8025ca:	c7 05 18 70 80 00 00 	movl   $0x0,0x807018
+  8025d1:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  8025d4:	c7 05 20 70 80 00 03 	movl   $0x3,0x807020
+  8025db:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  8025de:	c7 05 24 70 80 00 01 	movl   $0x1,0x807024
+  8025e5:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  8025e8:	89 1d 34 70 80 00    	mov    %ebx,0x807034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  8025ee:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025f3:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8025f8:	e8 32 f9 ff ff       	call   801f2f <fsipc>
+  8025fd:	83 c4 10             	add    $0x10,%esp
+  802600:	83 f8 01             	cmp    $0x1,%eax
+  802603:	7e 42                	jle    802647 <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  802605:	81 c3 e4 70 80 00    	add    $0x8070e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  80260b:	83 ec 08             	sub    $0x8,%esp
+  80260e:	53                   	push   %ebx
+  80260f:	56                   	push   %esi
+  802610:	e8 e7 e3 ff ff       	call   8009fc <strcpy>
+  st->st_size = ret->ret_size;
+  802615:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  80261b:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  802621:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  802627:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  80262d:	c7 86 88 00 00 00 04 	movl   $0x805004,0x88(%esi)
+  802634:	50 80 00 
+  return 0;
+  802637:	83 c4 10             	add    $0x10,%esp
+  80263a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80263f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802642:	5b                   	pop    %ebx
+  802643:	5e                   	pop    %esi
+  802644:	5f                   	pop    %edi
+  802645:	5d                   	pop    %ebp
+  802646:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  802647:	85 c0                	test   %eax,%eax
+  802649:	78 f4                	js     80263f <file_stat+0xd3>
+  80264b:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80264e:	8b 80 1c 70 80 00    	mov    0x80701c(%eax),%eax
+  802654:	eb e9                	jmp    80263f <file_stat+0xd3>
+    return -E_BAD_PATH;
+  802656:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  80265b:	eb e2                	jmp    80263f <file_stat+0xd3>
+
+0080265d <read_map>:
+{
+  80265d:	55                   	push   %ebp
+  80265e:	89 e5                	mov    %esp,%ebp
+  802660:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802663:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802666:	50                   	push   %eax
+  802667:	ff 75 08             	push   0x8(%ebp)
+  80266a:	e8 7c f2 ff ff       	call   8018eb <fd_lookup>
+  80266f:	83 c4 10             	add    $0x10,%esp
+  802672:	85 c0                	test   %eax,%eax
+  802674:	78 2a                	js     8026a0 <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  802676:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802679:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  80267f:	39 08                	cmp    %ecx,(%eax)
+  802681:	75 1f                	jne    8026a2 <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  802683:	8b 40 0c             	mov    0xc(%eax),%eax
+  802686:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.read_map.req_offset = offset;
+  80268b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80268e:	a3 04 70 80 00       	mov    %eax,0x807004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  802693:	8b 55 10             	mov    0x10(%ebp),%edx
+  802696:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80269b:	e8 8f f8 ff ff       	call   801f2f <fsipc>
+}
+  8026a0:	c9                   	leave
+  8026a1:	c3                   	ret
+    return -E_INVAL;
+  8026a2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026a7:	eb f7                	jmp    8026a0 <read_map+0x43>
+
+008026a9 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8026a9:	55                   	push   %ebp
+  8026aa:	89 e5                	mov    %esp,%ebp
+  8026ac:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  8026af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026b4:	b8 08 00 00 00       	mov    $0x8,%eax
+  8026b9:	e8 71 f8 ff ff       	call   801f2f <fsipc>
+}
+  8026be:	c9                   	leave
+  8026bf:	c3                   	ret
+
+008026c0 <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  8026c0:	55                   	push   %ebp
+  8026c1:	89 e5                	mov    %esp,%ebp
+  8026c3:	57                   	push   %edi
+  8026c4:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  8026c5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026c8:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.stats.req_bio_sched = 0;
+  8026cd:	c7 05 04 70 80 00 00 	movl   $0x0,0x807004
+  8026d4:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  8026d7:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  8026de:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  8026e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026e6:	b8 09 00 00 00       	mov    $0x9,%eax
+  8026eb:	e8 3f f8 ff ff       	call   801f2f <fsipc>
+  8026f0:	85 c0                	test   %eax,%eax
+  8026f2:	78 14                	js     802708 <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  8026f4:	be 00 70 80 00       	mov    $0x807000,%esi
+  8026f9:	b9 16 00 00 00       	mov    $0x16,%ecx
+  8026fe:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802701:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  802703:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802708:	5e                   	pop    %esi
+  802709:	5f                   	pop    %edi
+  80270a:	5d                   	pop    %ebp
+  80270b:	c3                   	ret
+
+0080270c <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  80270c:	55                   	push   %ebp
+  80270d:	89 e5                	mov    %esp,%ebp
+  80270f:	53                   	push   %ebx
+  802710:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  802713:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802716:	50                   	push   %eax
+  802717:	6a 00                	push   $0x0
+  802719:	e8 a2 ff ff ff       	call   8026c0 <fs_stats>
+  80271e:	83 c4 10             	add    $0x10,%esp
+  802721:	85 c0                	test   %eax,%eax
+  802723:	78 28                	js     80274d <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  802725:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  802728:	83 ec 08             	sub    $0x8,%esp
+  80272b:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  80272e:	50                   	push   %eax
+  80272f:	6a 20                	push   $0x20
+  802731:	e8 8a ff ff ff       	call   8026c0 <fs_stats>
+  802736:	83 c4 10             	add    $0x10,%esp
+  802739:	85 c0                	test   %eax,%eax
+  80273b:	78 10                	js     80274d <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  80273d:	83 ec 08             	sub    $0x8,%esp
+  802740:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802743:	50                   	push   %eax
+  802744:	53                   	push   %ebx
+  802745:	e8 76 ff ff ff       	call   8026c0 <fs_stats>
+  80274a:	83 c4 10             	add    $0x10,%esp
+}
+  80274d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802750:	c9                   	leave
+  802751:	c3                   	ret
+
+00802752 <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  802752:	55                   	push   %ebp
+  802753:	89 e5                	mov    %esp,%ebp
+  802755:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  802758:	c7 05 00 70 80 00 00 	movl   $0x0,0x807000
+  80275f:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  802762:	8b 45 08             	mov    0x8(%ebp),%eax
+  802765:	a3 04 70 80 00       	mov    %eax,0x807004
+  fsipcbuf.stats.req_dcache = 0;
+  80276a:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  802771:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  802774:	ba 00 00 00 00       	mov    $0x0,%edx
+  802779:	b8 09 00 00 00       	mov    $0x9,%eax
+  80277e:	e8 ac f7 ff ff       	call   801f2f <fsipc>
+}
+  802783:	c9                   	leave
+  802784:	c3                   	ret
+
+00802785 <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  802785:	55                   	push   %ebp
+  802786:	89 e5                	mov    %esp,%ebp
+  802788:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  80278b:	c7 05 00 70 80 00 00 	movl   $0x0,0x807000
+  802792:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  802795:	c7 05 04 70 80 00 00 	movl   $0x0,0x807004
+  80279c:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  80279f:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027a2:	a3 08 70 80 00       	mov    %eax,0x807008
+  return fsipc(FSREQ_STATS, NULL);
+  8027a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027ac:	b8 09 00 00 00       	mov    $0x9,%eax
+  8027b1:	e8 79 f7 ff ff       	call   801f2f <fsipc>
+}
+  8027b6:	c9                   	leave
+  8027b7:	c3                   	ret
+
+008027b8 <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  8027b8:	55                   	push   %ebp
+  8027b9:	89 e5                	mov    %esp,%ebp
+  8027bb:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8027be:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8027c1:	50                   	push   %eax
+  8027c2:	ff 75 08             	push   0x8(%ebp)
+  8027c5:	e8 21 f1 ff ff       	call   8018eb <fd_lookup>
+  8027ca:	83 c4 10             	add    $0x10,%esp
+  8027cd:	85 c0                	test   %eax,%eax
+  8027cf:	78 34                	js     802805 <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  8027d1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027d4:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  8027da:	39 08                	cmp    %ecx,(%eax)
+  8027dc:	75 29                	jne    802807 <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  8027de:	8b 40 0c             	mov    0xc(%eax),%eax
+  8027e1:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.fallocate.req_offset = offset;
+  8027e6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8027e9:	a3 04 70 80 00       	mov    %eax,0x807004
+  fsipcbuf.fallocate.req_len = len;
+  8027ee:	8b 45 10             	mov    0x10(%ebp),%eax
+  8027f1:	a3 08 70 80 00       	mov    %eax,0x807008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  8027f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027fb:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802800:	e8 2a f7 ff ff       	call   801f2f <fsipc>
+}
+  802805:	c9                   	leave
+  802806:	c3                   	ret
+    return -E_INVAL;
+  802807:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80280c:	eb f7                	jmp    802805 <fallocate+0x4d>
+
+0080280e <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  80280e:	55                   	push   %ebp
+  80280f:	89 e5                	mov    %esp,%ebp
+  802811:	57                   	push   %edi
+  802812:	56                   	push   %esi
+  802813:	53                   	push   %ebx
+  802814:	83 ec 24             	sub    $0x24,%esp
+  802817:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80281a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80281d:	50                   	push   %eax
+  80281e:	ff 75 08             	push   0x8(%ebp)
+  802821:	e8 c5 f0 ff ff       	call   8018eb <fd_lookup>
+  802826:	83 c4 10             	add    $0x10,%esp
+  802829:	85 c0                	test   %eax,%eax
+  80282b:	78 66                	js     802893 <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  80282d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802830:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  802836:	39 08                	cmp    %ecx,(%eax)
+  802838:	75 61                	jne    80289b <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  80283a:	85 f6                	test   %esi,%esi
+  80283c:	7e 50                	jle    80288e <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  80283e:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  802843:	39 de                	cmp    %ebx,%esi
+  802845:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  802848:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80284b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80284e:	a3 00 70 80 00       	mov    %eax,0x807000
+    fsipcbuf.prefetch.req_n = m;
+  802853:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  802859:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  802860:	83 ec 04             	sub    $0x4,%esp
+  802863:	57                   	push   %edi
+  802864:	ff 75 0c             	push   0xc(%ebp)
+  802867:	68 08 70 80 00       	push   $0x807008
+  80286c:	e8 11 e3 ff ff       	call   800b82 <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  802871:	ba 00 00 00 00       	mov    $0x0,%edx
+  802876:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80287b:	e8 af f6 ff ff       	call   801f2f <fsipc>
+  802880:	83 c4 10             	add    $0x10,%esp
+  802883:	85 c0                	test   %eax,%eax
+  802885:	78 0c                	js     802893 <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  802887:	01 7d 0c             	add    %edi,0xc(%ebp)
+  80288a:	29 de                	sub    %ebx,%esi
+  80288c:	eb ac                	jmp    80283a <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  80288e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802893:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802896:	5b                   	pop    %ebx
+  802897:	5e                   	pop    %esi
+  802898:	5f                   	pop    %edi
+  802899:	5d                   	pop    %ebp
+  80289a:	c3                   	ret
+    return -E_INVAL;
+  80289b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8028a0:	eb f1                	jmp    802893 <prefetch+0x85>
+
+008028a2 <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  8028a2:	55                   	push   %ebp
+  8028a3:	89 e5                	mov    %esp,%ebp
+  8028a5:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  8028a8:	50                   	push   %eax
+  8028a9:	e8 d3 ef ff ff       	call   801881 <fd2data>
+  8028ae:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  8028b3:	c9                   	leave
+  8028b4:	c3                   	ret
+
+008028b5 <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8028b5:	55                   	push   %ebp
+  8028b6:	89 e5                	mov    %esp,%ebp
+  8028b8:	56                   	push   %esi
+  8028b9:	53                   	push   %ebx
+  8028ba:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  8028bd:	83 ec 0c             	sub    $0xc,%esp
+  8028c0:	ff 75 08             	push   0x8(%ebp)
+  8028c3:	e8 b9 ef ff ff       	call   801881 <fd2data>
+  8028c8:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  8028ca:	83 c4 08             	add    $0x8,%esp
+  8028cd:	68 b8 41 80 00       	push   $0x8041b8
+  8028d2:	53                   	push   %ebx
+  8028d3:	e8 24 e1 ff ff       	call   8009fc <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  8028d8:	8b 46 04             	mov    0x4(%esi),%eax
+  8028db:	2b 06                	sub    (%esi),%eax
+  8028dd:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  8028e3:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8028ea:	00 00 00 
+  stat->st_dev = &devpipe;
+  8028ed:	c7 83 88 00 00 00 20 	movl   $0x805020,0x88(%ebx)
+  8028f4:	50 80 00 
+  return 0;
+}
+  8028f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028fc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8028ff:	5b                   	pop    %ebx
+  802900:	5e                   	pop    %esi
+  802901:	5d                   	pop    %ebp
+  802902:	c3                   	ret
+
+00802903 <pipe_wakeup>:
+{
+  802903:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  802905:	b8 00 00 00 00       	mov    $0x0,%eax
+  80290a:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  80290d:	85 c0                	test   %eax,%eax
+  80290f:	75 01                	jne    802912 <pipe_wakeup+0xf>
+  802911:	c3                   	ret
+{
+  802912:	55                   	push   %ebp
+  802913:	89 e5                	mov    %esp,%ebp
+  802915:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  802918:	6a 00                	push   $0x0
+  80291a:	68 00 00 c0 ee       	push   $0xeec00000
+  80291f:	52                   	push   %edx
+  802920:	e8 62 e8 ff ff       	call   801187 <sys_chan_wakeup>
+  802925:	83 c4 10             	add    $0x10,%esp
+}
+  802928:	c9                   	leave
+  802929:	c3                   	ret
+
+0080292a <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80292a:	55                   	push   %ebp
+  80292b:	89 e5                	mov    %esp,%ebp
+  80292d:	57                   	push   %edi
+  80292e:	56                   	push   %esi
+  80292f:	53                   	push   %ebx
+  802930:	83 ec 18             	sub    $0x18,%esp
+  802933:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  802936:	57                   	push   %edi
+  802937:	e8 45 ef ff ff       	call   801881 <fd2data>
+  80293c:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  80293e:	83 c4 10             	add    $0x10,%esp
+  802941:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  802945:	74 2a                	je     802971 <devpipe_close+0x47>
+  802947:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  80294c:	89 f8                	mov    %edi,%eax
+  80294e:	e8 4f ff ff ff       	call   8028a2 <pipe_ring>
+  802953:	83 ec 08             	sub    $0x8,%esp
+  802956:	01 d8                	add    %ebx,%eax
+  802958:	50                   	push   %eax
+  802959:	6a 00                	push   $0x0
+  80295b:	e8 50 e5 ff ff       	call   800eb0 <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  802960:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802966:	83 c4 10             	add    $0x10,%esp
+  802969:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  80296f:	75 db                	jne    80294c <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  802971:	83 ec 08             	sub    $0x8,%esp
+  802974:	57                   	push   %edi
+  802975:	6a 00                	push   $0x0
+  802977:	e8 34 e5 ff ff       	call   800eb0 <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  80297c:	83 c4 10             	add    $0x10,%esp
+  80297f:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  802983:	75 13                	jne    802998 <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  802985:	83 ec 08             	sub    $0x8,%esp
+  802988:	56                   	push   %esi
+  802989:	6a 00                	push   $0x0
+  80298b:	e8 20 e5 ff ff       	call   800eb0 <sys_page_unmap>
+}
+  802990:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802993:	5b                   	pop    %ebx
+  802994:	5e                   	pop    %esi
+  802995:	5f                   	pop    %edi
+  802996:	5d                   	pop    %ebp
+  802997:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802998:	8d 56 04             	lea    0x4(%esi),%edx
+  80299b:	8d 46 2c             	lea    0x2c(%esi),%eax
+  80299e:	e8 60 ff ff ff       	call   802903 <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8029a3:	8d 46 30             	lea    0x30(%esi),%eax
+  8029a6:	89 f2                	mov    %esi,%edx
+  8029a8:	e8 56 ff ff ff       	call   802903 <pipe_wakeup>
+  8029ad:	eb d6                	jmp    802985 <devpipe_close+0x5b>
+
+008029af <_pipeisclosed>:
+{
+  8029af:	55                   	push   %ebp
+  8029b0:	89 e5                	mov    %esp,%ebp
+  8029b2:	57                   	push   %edi
+  8029b3:	56                   	push   %esi
+  8029b4:	53                   	push   %ebx
+  8029b5:	83 ec 1c             	sub    $0x1c,%esp
+  8029b8:	89 c7                	mov    %eax,%edi
+  8029ba:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  8029bc:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  8029c1:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  8029c4:	83 ec 0c             	sub    $0xc,%esp
+  8029c7:	57                   	push   %edi
+  8029c8:	e8 87 0f 00 00       	call   803954 <pageref>
+  8029cd:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8029d0:	89 34 24             	mov    %esi,(%esp)
+  8029d3:	e8 7c 0f 00 00       	call   803954 <pageref>
+    nn = thisenv->env_runs;
+  8029d8:	8b 15 a0 68 80 00    	mov    0x8068a0,%edx
+  8029de:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  8029e1:	83 c4 10             	add    $0x10,%esp
+  8029e4:	39 cb                	cmp    %ecx,%ebx
+  8029e6:	74 1b                	je     802a03 <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  8029e8:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8029eb:	75 cf                	jne    8029bc <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8029ed:	8b 42 58             	mov    0x58(%edx),%eax
+  8029f0:	6a 01                	push   $0x1
+  8029f2:	50                   	push   %eax
+  8029f3:	53                   	push   %ebx
+  8029f4:	68 bf 41 80 00       	push   $0x8041bf
+  8029f9:	e8 10 da ff ff       	call   80040e <cprintf>
+  8029fe:	83 c4 10             	add    $0x10,%esp
+  802a01:	eb b9                	jmp    8029bc <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  802a03:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802a06:	0f 94 c0             	sete   %al
+  802a09:	0f b6 c0             	movzbl %al,%eax
+}
+  802a0c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a0f:	5b                   	pop    %ebx
+  802a10:	5e                   	pop    %esi
+  802a11:	5f                   	pop    %edi
+  802a12:	5d                   	pop    %ebp
+  802a13:	c3                   	ret
+
+00802a14 <devpipe_write_bulk>:
+{
+  802a14:	55                   	push   %ebp
+  802a15:	89 e5                	mov    %esp,%ebp
+  802a17:	57                   	push   %edi
+  802a18:	56                   	push   %esi
+  802a19:	53                   	push   %ebx
+  802a1a:	83 ec 1c             	sub    $0x1c,%esp
+  802a1d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802a20:	89 d6                	mov    %edx,%esi
+  802a22:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  802a25:	e8 78 fe ff ff       	call   8028a2 <pipe_ring>
+  802a2a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  802a2d:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802a32:	8d 46 04             	lea    0x4(%esi),%eax
+  802a35:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  802a38:	eb 75                	jmp    802aaf <devpipe_write_bulk+0x9b>
+  802a3a:	b8 01 00 00 00       	mov    $0x1,%eax
+  802a3f:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802a43:	6a 64                	push   $0x64
+  802a45:	68 00 00 c0 ee       	push   $0xeec00000
+  802a4a:	53                   	push   %ebx
+  802a4b:	56                   	push   %esi
+  802a4c:	e8 13 e7 ff ff       	call   801164 <sys_chan_sleep>
+      continue;
+  802a51:	83 c4 10             	add    $0x10,%esp
+  802a54:	eb 59                	jmp    802aaf <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  802a56:	89 d1                	mov    %edx,%ecx
+  802a58:	c1 f9 1f             	sar    $0x1f,%ecx
+  802a5b:	c1 e9 11             	shr    $0x11,%ecx
+  802a5e:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802a61:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802a66:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  802a68:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  802a6e:	29 d3                	sub    %edx,%ebx
+  802a70:	ba 00 80 00 00       	mov    $0x8000,%edx
+  802a75:	29 c2                	sub    %eax,%edx
+  802a77:	39 d3                	cmp    %edx,%ebx
+  802a79:	0f 47 da             	cmova  %edx,%ebx
+  802a7c:	8b 55 08             	mov    0x8(%ebp),%edx
+  802a7f:	29 fa                	sub    %edi,%edx
+  802a81:	39 d3                	cmp    %edx,%ebx
+  802a83:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  802a86:	83 ec 04             	sub    $0x4,%esp
+  802a89:	53                   	push   %ebx
+  802a8a:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802a8d:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  802a90:	52                   	push   %edx
+  802a91:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802a94:	01 c8                	add    %ecx,%eax
+  802a96:	50                   	push   %eax
+  802a97:	e8 48 e1 ff ff       	call   800be4 <memcpy>
+    i += m;
+  802a9c:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  802a9e:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802aa1:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802aa4:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802aa7:	e8 57 fe ff ff       	call   802903 <pipe_wakeup>
+  802aac:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802aaf:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802ab2:	73 2b                	jae    802adf <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  802ab4:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  802ab6:	8b 56 04             	mov    0x4(%esi),%edx
+  802ab9:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  802abf:	39 d0                	cmp    %edx,%eax
+  802ac1:	7d 93                	jge    802a56 <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  802ac3:	89 f2                	mov    %esi,%edx
+  802ac5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802ac8:	e8 e2 fe ff ff       	call   8029af <_pipeisclosed>
+  802acd:	85 c0                	test   %eax,%eax
+  802acf:	0f 84 65 ff ff ff    	je     802a3a <devpipe_write_bulk+0x26>
+        return i;
+  802ad5:	89 f8                	mov    %edi,%eax
+}
+  802ad7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ada:	5b                   	pop    %ebx
+  802adb:	5e                   	pop    %esi
+  802adc:	5f                   	pop    %edi
+  802add:	5d                   	pop    %ebp
+  802ade:	c3                   	ret
+  return i;
+  802adf:	89 f8                	mov    %edi,%eax
+  802ae1:	eb f4                	jmp    802ad7 <devpipe_write_bulk+0xc3>
+
+00802ae3 <devpipe_write>:
+{
+  802ae3:	55                   	push   %ebp
+  802ae4:	89 e5                	mov    %esp,%ebp
+  802ae6:	57                   	push   %edi
+  802ae7:	56                   	push   %esi
+  802ae8:	53                   	push   %ebx
+  802ae9:	83 ec 28             	sub    $0x28,%esp
+  802aec:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  802aef:	56                   	push   %esi
+  802af0:	e8 8c ed ff ff       	call   801881 <fd2data>
+  802af5:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  802af7:	8b 78 28             	mov    0x28(%eax),%edi
+  802afa:	83 c4 10             	add    $0x10,%esp
+  802afd:	85 ff                	test   %edi,%edi
+  802aff:	75 25                	jne    802b26 <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  802b01:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802b04:	74 66                	je     802b6c <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802b06:	8b 43 04             	mov    0x4(%ebx),%eax
+  802b09:	8b 0b                	mov    (%ebx),%ecx
+  802b0b:	8d 51 20             	lea    0x20(%ecx),%edx
+  802b0e:	39 d0                	cmp    %edx,%eax
+  802b10:	72 2b                	jb     802b3d <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  802b12:	89 da                	mov    %ebx,%edx
+  802b14:	89 f0                	mov    %esi,%eax
+  802b16:	e8 94 fe ff ff       	call   8029af <_pipeisclosed>
+  802b1b:	85 c0                	test   %eax,%eax
+  802b1d:	75 51                	jne    802b70 <devpipe_write+0x8d>
+      sys_yield();
+  802b1f:	e8 a5 e2 ff ff       	call   800dc9 <sys_yield>
+  802b24:	eb e0                	jmp    802b06 <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  802b26:	83 ec 0c             	sub    $0xc,%esp
+  802b29:	ff 75 10             	push   0x10(%ebp)
+  802b2c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802b2f:	89 c2                	mov    %eax,%edx
+  802b31:	89 f0                	mov    %esi,%eax
+  802b33:	e8 dc fe ff ff       	call   802a14 <devpipe_write_bulk>
+  802b38:	83 c4 10             	add    $0x10,%esp
+  802b3b:	eb 38                	jmp    802b75 <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802b3d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802b40:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802b44:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802b47:	89 c2                	mov    %eax,%edx
+  802b49:	c1 fa 1f             	sar    $0x1f,%edx
+  802b4c:	89 d1                	mov    %edx,%ecx
+  802b4e:	c1 e9 1b             	shr    $0x1b,%ecx
+  802b51:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802b54:	83 e2 1f             	and    $0x1f,%edx
+  802b57:	29 ca                	sub    %ecx,%edx
+  802b59:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802b5d:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  802b61:	83 c0 01             	add    $0x1,%eax
+  802b64:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  802b67:	83 c7 01             	add    $0x1,%edi
+  802b6a:	eb 95                	jmp    802b01 <devpipe_write+0x1e>
+  return i;
+  802b6c:	89 f8                	mov    %edi,%eax
+  802b6e:	eb 05                	jmp    802b75 <devpipe_write+0x92>
+        return 0;
+  802b70:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b75:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b78:	5b                   	pop    %ebx
+  802b79:	5e                   	pop    %esi
+  802b7a:	5f                   	pop    %edi
+  802b7b:	5d                   	pop    %ebp
+  802b7c:	c3                   	ret
+
+00802b7d <devpipe_read_bulk>:
+{
+  802b7d:	55                   	push   %ebp
+  802b7e:	89 e5                	mov    %esp,%ebp
+  802b80:	57                   	push   %edi
+  802b81:	56                   	push   %esi
+  802b82:	53                   	push   %ebx
+  802b83:	83 ec 2c             	sub    $0x2c,%esp
+  802b86:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802b89:	89 d6                	mov    %edx,%esi
+  802b8b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802b8e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  802b91:	e8 0c fd ff ff       	call   8028a2 <pipe_ring>
+  802b96:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  802b99:	85 db                	test   %ebx,%ebx
+  802b9b:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802ba0:	0f 45 c3             	cmovne %ebx,%eax
+  802ba3:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802ba6:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802bab:	8d 46 30             	lea    0x30(%esi),%eax
+  802bae:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  802bb1:	eb 50                	jmp    802c03 <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  802bb3:	89 d1                	mov    %edx,%ecx
+  802bb5:	c1 f9 1f             	sar    $0x1f,%ecx
+  802bb8:	c1 e9 11             	shr    $0x11,%ecx
+  802bbb:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802bbe:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802bc3:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  802bc5:	29 d3                	sub    %edx,%ebx
+  802bc7:	ba 00 80 00 00       	mov    $0x8000,%edx
+  802bcc:	29 c2                	sub    %eax,%edx
+  802bce:	39 d3                	cmp    %edx,%ebx
+  802bd0:	0f 47 da             	cmova  %edx,%ebx
+  802bd3:	8b 55 08             	mov    0x8(%ebp),%edx
+  802bd6:	29 fa                	sub    %edi,%edx
+  802bd8:	39 d3                	cmp    %edx,%ebx
+  802bda:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  802bdd:	83 ec 04             	sub    $0x4,%esp
+  802be0:	53                   	push   %ebx
+  802be1:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802be4:	01 c8                	add    %ecx,%eax
+  802be6:	50                   	push   %eax
+  802be7:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802bea:	01 f8                	add    %edi,%eax
+  802bec:	50                   	push   %eax
+  802bed:	e8 f2 df ff ff       	call   800be4 <memcpy>
+    i += m;
+  802bf2:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  802bf4:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802bf6:	89 f2                	mov    %esi,%edx
+  802bf8:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802bfb:	e8 03 fd ff ff       	call   802903 <pipe_wakeup>
+  802c00:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802c03:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802c06:	73 51                	jae    802c59 <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  802c08:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  802c0b:	8b 16                	mov    (%esi),%edx
+  802c0d:	39 da                	cmp    %ebx,%edx
+  802c0f:	75 a2                	jne    802bb3 <devpipe_read_bulk+0x36>
+      if (i > 0)
+  802c11:	85 ff                	test   %edi,%edi
+  802c13:	75 44                	jne    802c59 <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  802c15:	89 f2                	mov    %esi,%edx
+  802c17:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802c1a:	e8 90 fd ff ff       	call   8029af <_pipeisclosed>
+  802c1f:	85 c0                	test   %eax,%eax
+  802c21:	75 3a                	jne    802c5d <devpipe_read_bulk+0xe0>
+  802c23:	b8 01 00 00 00       	mov    $0x1,%eax
+  802c28:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802c2c:	6a 64                	push   $0x64
+  802c2e:	ff 75 d4             	push   -0x2c(%ebp)
+  802c31:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  802c32:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802c35:	50                   	push   %eax
+  802c36:	e8 29 e5 ff ff       	call   801164 <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  802c3b:	85 c0                	test   %eax,%eax
+  802c3d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c42:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  802c45:	83 c4 10             	add    $0x10,%esp
+  802c48:	a8 01                	test   $0x1,%al
+  802c4a:	74 b7                	je     802c03 <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  802c4c:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  802c51:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c54:	5b                   	pop    %ebx
+  802c55:	5e                   	pop    %esi
+  802c56:	5f                   	pop    %edi
+  802c57:	5d                   	pop    %ebp
+  802c58:	c3                   	ret
+  return i;
+  802c59:	89 f8                	mov    %edi,%eax
+  802c5b:	eb f4                	jmp    802c51 <devpipe_read_bulk+0xd4>
+        return 0;
+  802c5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c62:	eb ed                	jmp    802c51 <devpipe_read_bulk+0xd4>
+
+00802c64 <devpipe_read>:
+{
+  802c64:	55                   	push   %ebp
+  802c65:	89 e5                	mov    %esp,%ebp
+  802c67:	57                   	push   %edi
+  802c68:	56                   	push   %esi
+  802c69:	53                   	push   %ebx
+  802c6a:	83 ec 18             	sub    $0x18,%esp
+  802c6d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  802c70:	57                   	push   %edi
+  802c71:	e8 0b ec ff ff       	call   801881 <fd2data>
+  802c76:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  802c78:	8b 70 28             	mov    0x28(%eax),%esi
+  802c7b:	83 c4 10             	add    $0x10,%esp
+  802c7e:	85 f6                	test   %esi,%esi
+  802c80:	75 24                	jne    802ca6 <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  802c82:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802c85:	74 60                	je     802ce7 <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  802c87:	8b 03                	mov    (%ebx),%eax
+  802c89:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802c8c:	75 3b                	jne    802cc9 <devpipe_read+0x65>
+      if (i > 0)
+  802c8e:	85 f6                	test   %esi,%esi
+  802c90:	75 2d                	jne    802cbf <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  802c92:	89 da                	mov    %ebx,%edx
+  802c94:	89 f8                	mov    %edi,%eax
+  802c96:	e8 14 fd ff ff       	call   8029af <_pipeisclosed>
+  802c9b:	85 c0                	test   %eax,%eax
+  802c9d:	75 4c                	jne    802ceb <devpipe_read+0x87>
+      sys_yield();
+  802c9f:	e8 25 e1 ff ff       	call   800dc9 <sys_yield>
+  802ca4:	eb e1                	jmp    802c87 <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  802ca6:	83 ec 08             	sub    $0x8,%esp
+  802ca9:	6a 00                	push   $0x0
+  802cab:	ff 75 10             	push   0x10(%ebp)
+  802cae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802cb1:	89 c2                	mov    %eax,%edx
+  802cb3:	89 f8                	mov    %edi,%eax
+  802cb5:	e8 c3 fe ff ff       	call   802b7d <devpipe_read_bulk>
+  802cba:	83 c4 10             	add    $0x10,%esp
+  802cbd:	eb 02                	jmp    802cc1 <devpipe_read+0x5d>
+        return i;
+  802cbf:	89 f0                	mov    %esi,%eax
+}
+  802cc1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802cc4:	5b                   	pop    %ebx
+  802cc5:	5e                   	pop    %esi
+  802cc6:	5f                   	pop    %edi
+  802cc7:	5d                   	pop    %ebp
+  802cc8:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802cc9:	99                   	cltd
+  802cca:	c1 ea 1b             	shr    $0x1b,%edx
+  802ccd:	01 d0                	add    %edx,%eax
+  802ccf:	83 e0 1f             	and    $0x1f,%eax
+  802cd2:	29 d0                	sub    %edx,%eax
+  802cd4:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802cd9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802cdc:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  802cdf:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  802ce2:	83 c6 01             	add    $0x1,%esi
+  802ce5:	eb 9b                	jmp    802c82 <devpipe_read+0x1e>
+  return i;
+  802ce7:	89 f0                	mov    %esi,%eax
+  802ce9:	eb d6                	jmp    802cc1 <devpipe_read+0x5d>
+        return 0;
+  802ceb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cf0:	eb cf                	jmp    802cc1 <devpipe_read+0x5d>
+
+00802cf2 <pipe2>:
+{
+  802cf2:	55                   	push   %ebp
+  802cf3:	89 e5                	mov    %esp,%ebp
+  802cf5:	57                   	push   %edi
+  802cf6:	56                   	push   %esi
+  802cf7:	53                   	push   %ebx
+  802cf8:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  802cfb:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802cfe:	50                   	push   %eax
+  802cff:	e8 91 eb ff ff       	call   801895 <fd_alloc>
+  802d04:	89 c3                	mov    %eax,%ebx
+  802d06:	83 c4 10             	add    $0x10,%esp
+  802d09:	85 c0                	test   %eax,%eax
+  802d0b:	0f 88 fb 01 00 00    	js     802f0c <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802d11:	83 ec 04             	sub    $0x4,%esp
+  802d14:	68 07 04 00 00       	push   $0x407
+  802d19:	ff 75 e4             	push   -0x1c(%ebp)
+  802d1c:	6a 00                	push   $0x0
+  802d1e:	e8 08 e1 ff ff       	call   800e2b <sys_page_alloc>
+  802d23:	89 c3                	mov    %eax,%ebx
+  802d25:	83 c4 10             	add    $0x10,%esp
+  802d28:	85 c0                	test   %eax,%eax
+  802d2a:	0f 88 dc 01 00 00    	js     802f0c <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  802d30:	83 ec 0c             	sub    $0xc,%esp
+  802d33:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  802d36:	50                   	push   %eax
+  802d37:	e8 59 eb ff ff       	call   801895 <fd_alloc>
+  802d3c:	89 c3                	mov    %eax,%ebx
+  802d3e:	83 c4 10             	add    $0x10,%esp
+  802d41:	85 c0                	test   %eax,%eax
+  802d43:	0f 88 b3 01 00 00    	js     802efc <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802d49:	83 ec 04             	sub    $0x4,%esp
+  802d4c:	68 07 04 00 00       	push   $0x407
+  802d51:	ff 75 e0             	push   -0x20(%ebp)
+  802d54:	6a 00                	push   $0x0
+  802d56:	e8 d0 e0 ff ff       	call   800e2b <sys_page_alloc>
+  802d5b:	89 c3                	mov    %eax,%ebx
+  802d5d:	83 c4 10             	add    $0x10,%esp
+  802d60:	85 c0                	test   %eax,%eax
+  802d62:	0f 88 94 01 00 00    	js     802efc <pipe2+0x20a>
+  va = fd2data(fd0);
+  802d68:	83 ec 0c             	sub    $0xc,%esp
+  802d6b:	ff 75 e4             	push   -0x1c(%ebp)
+  802d6e:	e8 0e eb ff ff       	call   801881 <fd2data>
+  802d73:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802d75:	83 c4 0c             	add    $0xc,%esp
+  802d78:	68 07 04 00 00       	push   $0x407
+  802d7d:	50                   	push   %eax
+  802d7e:	6a 00                	push   $0x0
+  802d80:	e8 a6 e0 ff ff       	call   800e2b <sys_page_alloc>
+  802d85:	89 c3                	mov    %eax,%ebx
+  802d87:	83 c4 10             	add    $0x10,%esp
+  802d8a:	85 c0                	test   %eax,%eax
+  802d8c:	0f 88 5a 01 00 00    	js     802eec <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802d92:	83 ec 0c             	sub    $0xc,%esp
+  802d95:	ff 75 e0             	push   -0x20(%ebp)
+  802d98:	e8 e4 ea ff ff       	call   801881 <fd2data>
+  802d9d:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802da4:	50                   	push   %eax
+  802da5:	6a 00                	push   $0x0
+  802da7:	57                   	push   %edi
+  802da8:	6a 00                	push   $0x0
+  802daa:	e8 bf e0 ff ff       	call   800e6e <sys_page_map>
+  802daf:	89 c3                	mov    %eax,%ebx
+  802db1:	83 c4 20             	add    $0x20,%esp
+  802db4:	85 c0                	test   %eax,%eax
+  802db6:	0f 88 22 01 00 00    	js     802ede <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  802dbc:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  802dc0:	74 72                	je     802e34 <pipe2+0x142>
+  802dc2:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  802dc7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802dca:	e8 d3 fa ff ff       	call   8028a2 <pipe_ring>
+  802dcf:	83 ec 04             	sub    $0x4,%esp
+  802dd2:	68 07 04 00 00       	push   $0x407
+  802dd7:	01 f0                	add    %esi,%eax
+  802dd9:	50                   	push   %eax
+  802dda:	6a 00                	push   $0x0
+  802ddc:	e8 4a e0 ff ff       	call   800e2b <sys_page_alloc>
+  802de1:	89 c3                	mov    %eax,%ebx
+  802de3:	83 c4 10             	add    $0x10,%esp
+  802de6:	85 c0                	test   %eax,%eax
+  802de8:	0f 88 97 00 00 00    	js     802e85 <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  802dee:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802df1:	e8 ac fa ff ff       	call   8028a2 <pipe_ring>
+  802df6:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  802df9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802dfc:	e8 a1 fa ff ff       	call   8028a2 <pipe_ring>
+  802e01:	83 ec 0c             	sub    $0xc,%esp
+  802e04:	68 07 04 00 00       	push   $0x407
+  802e09:	53                   	push   %ebx
+  802e0a:	6a 00                	push   $0x0
+  802e0c:	01 f0                	add    %esi,%eax
+  802e0e:	50                   	push   %eax
+  802e0f:	6a 00                	push   $0x0
+  802e11:	e8 58 e0 ff ff       	call   800e6e <sys_page_map>
+  802e16:	89 c3                	mov    %eax,%ebx
+  802e18:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802e1e:	83 c4 20             	add    $0x20,%esp
+  802e21:	85 c0                	test   %eax,%eax
+  802e23:	78 60                	js     802e85 <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  802e25:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802e2b:	75 9a                	jne    802dc7 <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  802e2d:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  802e34:	a1 20 50 80 00       	mov    0x805020,%eax
+  802e39:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802e3c:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  802e3e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802e41:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  802e48:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802e4b:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  802e4d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802e50:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  802e57:	83 ec 0c             	sub    $0xc,%esp
+  802e5a:	ff 75 e4             	push   -0x1c(%ebp)
+  802e5d:	e8 0f ea ff ff       	call   801871 <fd2num>
+  802e62:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802e65:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  802e67:	83 c4 04             	add    $0x4,%esp
+  802e6a:	ff 75 e0             	push   -0x20(%ebp)
+  802e6d:	e8 ff e9 ff ff       	call   801871 <fd2num>
+  802e72:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802e75:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  802e78:	83 c4 10             	add    $0x10,%esp
+  802e7b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e80:	e9 87 00 00 00       	jmp    802f0c <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802e85:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  802e8a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802e8d:	e8 10 fa ff ff       	call   8028a2 <pipe_ring>
+  802e92:	83 ec 08             	sub    $0x8,%esp
+  802e95:	01 f0                	add    %esi,%eax
+  802e97:	50                   	push   %eax
+  802e98:	6a 00                	push   $0x0
+  802e9a:	e8 11 e0 ff ff       	call   800eb0 <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  802e9f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802ea2:	e8 fb f9 ff ff       	call   8028a2 <pipe_ring>
+  802ea7:	83 c4 08             	add    $0x8,%esp
+  802eaa:	01 f0                	add    %esi,%eax
+  802eac:	50                   	push   %eax
+  802ead:	6a 00                	push   $0x0
+  802eaf:	e8 fc df ff ff       	call   800eb0 <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802eb4:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802eba:	83 c4 10             	add    $0x10,%esp
+  802ebd:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802ec3:	75 c5                	jne    802e8a <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  802ec5:	83 ec 0c             	sub    $0xc,%esp
+  802ec8:	ff 75 e0             	push   -0x20(%ebp)
+  802ecb:	e8 b1 e9 ff ff       	call   801881 <fd2data>
+  802ed0:	83 c4 08             	add    $0x8,%esp
+  802ed3:	50                   	push   %eax
+  802ed4:	6a 00                	push   $0x0
+  802ed6:	e8 d5 df ff ff       	call   800eb0 <sys_page_unmap>
+  802edb:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  802ede:	83 ec 08             	sub    $0x8,%esp
+  802ee1:	57                   	push   %edi
+  802ee2:	6a 00                	push   $0x0
+  802ee4:	e8 c7 df ff ff       	call   800eb0 <sys_page_unmap>
+  802ee9:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  802eec:	83 ec 08             	sub    $0x8,%esp
+  802eef:	ff 75 e0             	push   -0x20(%ebp)
+  802ef2:	6a 00                	push   $0x0
+  802ef4:	e8 b7 df ff ff       	call   800eb0 <sys_page_unmap>
+  802ef9:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  802efc:	83 ec 08             	sub    $0x8,%esp
+  802eff:	ff 75 e4             	push   -0x1c(%ebp)
+  802f02:	6a 00                	push   $0x0
+  802f04:	e8 a7 df ff ff       	call   800eb0 <sys_page_unmap>
+  802f09:	83 c4 10             	add    $0x10,%esp
+}
+  802f0c:	89 d8                	mov    %ebx,%eax
+  802f0e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f11:	5b                   	pop    %ebx
+  802f12:	5e                   	pop    %esi
+  802f13:	5f                   	pop    %edi
+  802f14:	5d                   	pop    %ebp
+  802f15:	c3                   	ret
+
+00802f16 <pipe>:
+{
+  802f16:	55                   	push   %ebp
+  802f17:	89 e5                	mov    %esp,%ebp
+  802f19:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  802f1c:	6a 00                	push   $0x0
+  802f1e:	ff 75 08             	push   0x8(%ebp)
+  802f21:	e8 cc fd ff ff       	call   802cf2 <pipe2>
+}
+  802f26:	c9                   	leave
+  802f27:	c3                   	ret
+
+00802f28 <pipeisclosed>:
+{
+  802f28:	55                   	push   %ebp
+  802f29:	89 e5                	mov    %esp,%ebp
+  802f2b:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802f2e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802f31:	50                   	push   %eax
+  802f32:	ff 75 08             	push   0x8(%ebp)
+  802f35:	e8 b1 e9 ff ff       	call   8018eb <fd_lookup>
+  802f3a:	83 c4 10             	add    $0x10,%esp
+  802f3d:	85 c0                	test   %eax,%eax
+  802f3f:	78 18                	js     802f59 <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  802f41:	83 ec 0c             	sub    $0xc,%esp
+  802f44:	ff 75 f4             	push   -0xc(%ebp)
+  802f47:	e8 35 e9 ff ff       	call   801881 <fd2data>
+  802f4c:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  802f4e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802f51:	e8 59 fa ff ff       	call   8029af <_pipeisclosed>
+  802f56:	83 c4 10             	add    $0x10,%esp
+}
+  802f59:	c9                   	leave
+  802f5a:	c3                   	ret
+
+00802f5b <pipe_splice>:
+{
+  802f5b:	55                   	push   %ebp
+  802f5c:	89 e5                	mov    %esp,%ebp
+  802f5e:	57                   	push   %edi
+  802f5f:	56                   	push   %esi
+  802f60:	53                   	push   %ebx
+  802f61:	83 ec 34             	sub    $0x34,%esp
+  802f64:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802f67:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802f6a:	50                   	push   %eax
+  802f6b:	ff 75 08             	push   0x8(%ebp)
+  802f6e:	e8 78 e9 ff ff       	call   8018eb <fd_lookup>
+  802f73:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802f76:	83 c4 10             	add    $0x10,%esp
+  802f79:	85 c0                	test   %eax,%eax
+  802f7b:	0f 88 d7 00 00 00    	js     803058 <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  802f81:	83 ec 0c             	sub    $0xc,%esp
+  802f84:	ff 75 e4             	push   -0x1c(%ebp)
+  802f87:	e8 f5 e8 ff ff       	call   801881 <fd2data>
+  802f8c:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802f8e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802f91:	83 c4 10             	add    $0x10,%esp
+  802f94:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  802f9a:	39 10                	cmp    %edx,(%eax)
+  802f9c:	0f 85 c1 00 00 00    	jne    803063 <pipe_splice+0x108>
+  802fa2:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  802fa6:	0f 84 c0 00 00 00    	je     80306c <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  802fac:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802fb0:	0f 84 bf 00 00 00    	je     803075 <pipe_splice+0x11a>
+  802fb6:	89 f7                	mov    %esi,%edi
+  802fb8:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  802fbe:	0f 85 ba 00 00 00    	jne    80307e <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802fc4:	8d 43 04             	lea    0x4(%ebx),%eax
+  802fc7:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802fca:	eb 38                	jmp    803004 <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802fcc:	83 ec 0c             	sub    $0xc,%esp
+  802fcf:	68 00 10 00 00       	push   $0x1000
+  802fd4:	89 f1                	mov    %esi,%ecx
+  802fd6:	89 da                	mov    %ebx,%edx
+  802fd8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802fdb:	e8 34 fa ff ff       	call   802a14 <devpipe_write_bulk>
+  802fe0:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802fe3:	83 c4 10             	add    $0x10,%esp
+  802fe6:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802feb:	75 53                	jne    803040 <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  802fed:	83 ec 08             	sub    $0x8,%esp
+  802ff0:	56                   	push   %esi
+  802ff1:	6a 00                	push   $0x0
+  802ff3:	e8 b8 de ff ff       	call   800eb0 <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  802ff8:	83 c7 01             	add    $0x1,%edi
+  802ffb:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803001:	83 c4 10             	add    $0x10,%esp
+  803004:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  803007:	74 3a                	je     803043 <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  803009:	8b 03                	mov    (%ebx),%eax
+  80300b:	39 43 04             	cmp    %eax,0x4(%ebx)
+  80300e:	75 bc                	jne    802fcc <pipe_splice+0x71>
+  803010:	b8 00 00 00 00       	mov    $0x0,%eax
+  803015:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  803019:	85 c0                	test   %eax,%eax
+  80301b:	74 af                	je     802fcc <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  80301d:	83 ec 04             	sub    $0x4,%esp
+  803020:	6a 07                	push   $0x7
+  803022:	56                   	push   %esi
+  803023:	ff 75 d0             	push   -0x30(%ebp)
+  803026:	e8 5c e1 ff ff       	call   801187 <sys_chan_wakeup>
+  80302b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80302e:	83 c4 10             	add    $0x10,%esp
+  803031:	85 c0                	test   %eax,%eax
+  803033:	79 b8                	jns    802fed <pipe_splice+0x92>
+  803035:	b8 01 00 00 00       	mov    $0x1,%eax
+  80303a:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  80303e:	eb 8c                	jmp    802fcc <pipe_splice+0x71>
+  803040:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  803043:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803047:	75 06                	jne    80304f <pipe_splice+0xf4>
+  803049:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  80304d:	78 09                	js     803058 <pipe_splice+0xfd>
+  return i * PGSIZE;
+  80304f:	8b 45 10             	mov    0x10(%ebp),%eax
+  803052:	c1 e0 0c             	shl    $0xc,%eax
+  803055:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  803058:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80305b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80305e:	5b                   	pop    %ebx
+  80305f:	5e                   	pop    %esi
+  803060:	5f                   	pop    %edi
+  803061:	5d                   	pop    %ebp
+  803062:	c3                   	ret
+    return -E_INVAL;
+  803063:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  80306a:	eb ec                	jmp    803058 <pipe_splice+0xfd>
+  80306c:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  803073:	eb e3                	jmp    803058 <pipe_splice+0xfd>
+  803075:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  80307c:	eb da                	jmp    803058 <pipe_splice+0xfd>
+  80307e:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  803085:	eb d1                	jmp    803058 <pipe_splice+0xfd>
+
+00803087 <pipe_splice_read>:
+{
+  803087:	55                   	push   %ebp
+  803088:	89 e5                	mov    %esp,%ebp
+  80308a:	53                   	push   %ebx
+  80308b:	83 ec 1c             	sub    $0x1c,%esp
+  80308e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803091:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803094:	50                   	push   %eax
+  803095:	ff 75 08             	push   0x8(%ebp)
+  803098:	e8 4e e8 ff ff       	call   8018eb <fd_lookup>
+  80309d:	83 c4 10             	add    $0x10,%esp
+  8030a0:	85 c0                	test   %eax,%eax
+  8030a2:	78 49                	js     8030ed <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  8030a4:	83 ec 0c             	sub    $0xc,%esp
+  8030a7:	ff 75 f4             	push   -0xc(%ebp)
+  8030aa:	e8 d2 e7 ff ff       	call   801881 <fd2data>
+  8030af:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  8030b1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8030b4:	83 c4 10             	add    $0x10,%esp
+  8030b7:	8b 0d 20 50 80 00    	mov    0x805020,%ecx
+  8030bd:	39 08                	cmp    %ecx,(%eax)
+  8030bf:	75 31                	jne    8030f2 <pipe_splice_read+0x6b>
+  8030c1:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  8030c5:	74 32                	je     8030f9 <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  8030c7:	8b 48 08             	mov    0x8(%eax),%ecx
+  8030ca:	83 e1 03             	and    $0x3,%ecx
+  8030cd:	83 f9 01             	cmp    $0x1,%ecx
+  8030d0:	74 2e                	je     803100 <pipe_splice_read+0x79>
+  8030d2:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  8030d8:	75 2d                	jne    803107 <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  8030da:	83 ec 08             	sub    $0x8,%esp
+  8030dd:	53                   	push   %ebx
+  8030de:	68 00 10 00 00       	push   $0x1000
+  8030e3:	89 d9                	mov    %ebx,%ecx
+  8030e5:	e8 93 fa ff ff       	call   802b7d <devpipe_read_bulk>
+  8030ea:	83 c4 10             	add    $0x10,%esp
+}
+  8030ed:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8030f0:	c9                   	leave
+  8030f1:	c3                   	ret
+    return -E_INVAL;
+  8030f2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8030f7:	eb f4                	jmp    8030ed <pipe_splice_read+0x66>
+  8030f9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8030fe:	eb ed                	jmp    8030ed <pipe_splice_read+0x66>
+  803100:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803105:	eb e6                	jmp    8030ed <pipe_splice_read+0x66>
+  803107:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80310c:	eb df                	jmp    8030ed <pipe_splice_read+0x66>
+
+0080310e <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  80310e:	55                   	push   %ebp
+  80310f:	89 e5                	mov    %esp,%ebp
+  803111:	56                   	push   %esi
+  803112:	53                   	push   %ebx
+  803113:	8b 75 08             	mov    0x8(%ebp),%esi
+  const volatile struct Env *e;
+
+  assert(envid != 0);
+  803116:	85 f6                	test   %esi,%esi
+  803118:	74 15                	je     80312f <wait+0x21>
+  e = &envs[ENVX(envid)];
+  80311a:	89 f0                	mov    %esi,%eax
+  80311c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  while (e->env_id == envid && e->env_status != ENV_FREE)
+  803121:	8d 1c c0             	lea    (%eax,%eax,8),%ebx
+  803124:	c1 e3 04             	shl    $0x4,%ebx
+  803127:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  80312d:	eb 1b                	jmp    80314a <wait+0x3c>
+  assert(envid != 0);
+  80312f:	68 d7 41 80 00       	push   $0x8041d7
+  803134:	68 68 41 80 00       	push   $0x804168
+  803139:	6a 09                	push   $0x9
+  80313b:	68 e2 41 80 00       	push   $0x8041e2
+  803140:	e8 ee d1 ff ff       	call   800333 <_panic>
+    sys_yield();
+  803145:	e8 7f dc ff ff       	call   800dc9 <sys_yield>
+  while (e->env_id == envid && e->env_status != ENV_FREE)
+  80314a:	8b 43 48             	mov    0x48(%ebx),%eax
+  80314d:	39 f0                	cmp    %esi,%eax
+  80314f:	75 07                	jne    803158 <wait+0x4a>
+  803151:	8b 43 54             	mov    0x54(%ebx),%eax
+  803154:	85 c0                	test   %eax,%eax
+  803156:	75 ed                	jne    803145 <wait+0x37>
+}
+  803158:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80315b:	5b                   	pop    %ebx
+  80315c:	5e                   	pop    %esi
+  80315d:	5d                   	pop    %ebp
+  80315e:	c3                   	ret
+
+0080315f <mmap_find>:
+          utf->utf_eip, utf->utf_err);
+}
+
+static struct Mmap *
+mmap_find(uintptr_t va)
+{
+  80315f:	55                   	push   %ebp
+  803160:	89 e5                	mov    %esp,%ebp
+  803162:	56                   	push   %esi
+  803163:	53                   	push   %ebx
+  int i;
+
+  for (i = 0; i < NMMAP; i++)
+  803164:	ba 60 67 80 00       	mov    $0x806760,%edx
+  803169:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80316e:	eb 0b                	jmp    80317b <mmap_find+0x1c>
+  803170:	83 c3 01             	add    $0x1,%ebx
+  803173:	83 c2 14             	add    $0x14,%edx
+  803176:	83 fb 10             	cmp    $0x10,%ebx
+  803179:	74 1d                	je     803198 <mmap_find+0x39>
+    if (mmaps[i].mm_va && va >= mmaps[i].mm_va &&
+  80317b:	8b 0a                	mov    (%edx),%ecx
+  80317d:	39 c8                	cmp    %ecx,%eax
+  80317f:	72 ef                	jb     803170 <mmap_find+0x11>
+  803181:	85 c9                	test   %ecx,%ecx
+  803183:	74 eb                	je     803170 <mmap_find+0x11>
+        va < mmaps[i].mm_va + mmaps[i].mm_len)
+  803185:	03 4a 04             	add    0x4(%edx),%ecx
+    if (mmaps[i].mm_va && va >= mmaps[i].mm_va &&
+  803188:	39 c8                	cmp    %ecx,%eax
+  80318a:	73 e4                	jae    803170 <mmap_find+0x11>
+      return &mmaps[i];
+  80318c:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80318f:	8d 04 85 60 67 80 00 	lea    0x806760(,%eax,4),%eax
+  803196:	eb 05                	jmp    80319d <mmap_find+0x3e>
+  return NULL;
+  803198:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80319d:	5b                   	pop    %ebx
+  80319e:	5e                   	pop    %esi
+  80319f:	5d                   	pop    %ebp
+  8031a0:	c3                   	ret
+
+008031a1 <va_mapped>:
+
+static bool
+va_mapped(uintptr_t va)
+{
+  return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+  8031a1:	89 c2                	mov    %eax,%edx
+  8031a3:	c1 ea 16             	shr    $0x16,%edx
+  8031a6:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8031ad:	f6 c2 01             	test   $0x1,%dl
+  8031b0:	74 11                	je     8031c3 <va_mapped+0x22>
+  8031b2:	c1 e8 0c             	shr    $0xc,%eax
+  8031b5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8031bc:	83 e0 01             	and    $0x1,%eax
+  8031bf:	83 e0 01             	and    $0x1,%eax
+}
+  8031c2:	c3                   	ret
+  return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+  8031c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031c8:	eb f5                	jmp    8031bf <va_mapped+0x1e>
+
+008031ca <mmap_copy>:
+
+// Replace the page at 'va' with a copy of its first 'n' bytes, the rest
+// zeroed, mapped with 'perm'.
+static void
+mmap_copy(uintptr_t va, size_t n, int perm)
+{
+  8031ca:	55                   	push   %ebp
+  8031cb:	89 e5                	mov    %esp,%ebp
+  8031cd:	57                   	push   %edi
+  8031ce:	56                   	push   %esi
+  8031cf:	53                   	push   %ebx
+  8031d0:	83 ec 10             	sub    $0x10,%esp
+  8031d3:	89 c3                	mov    %eax,%ebx
+  8031d5:	89 d7                	mov    %edx,%edi
+  8031d7:	89 ce                	mov    %ecx,%esi
+  int r;
+
+  if ((r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  8031d9:	6a 07                	push   $0x7
+  8031db:	68 00 f0 7f 00       	push   $0x7ff000
+  8031e0:	6a 00                	push   $0x0
+  8031e2:	e8 44 dc ff ff       	call   800e2b <sys_page_alloc>
+  8031e7:	83 c4 10             	add    $0x10,%esp
+  8031ea:	85 c0                	test   %eax,%eax
+  8031ec:	78 46                	js     803234 <mmap_copy+0x6a>
+    panic("mmap: %e", r);
+  memmove(PFTEMP, (void *) va, n);
+  8031ee:	83 ec 04             	sub    $0x4,%esp
+  8031f1:	57                   	push   %edi
+  8031f2:	53                   	push   %ebx
+  8031f3:	68 00 f0 7f 00       	push   $0x7ff000
+  8031f8:	e8 85 d9 ff ff       	call   800b82 <memmove>
+  if ((r = sys_page_map(0, PFTEMP, 0, (void *) va, perm)) < 0 ||
+  8031fd:	89 34 24             	mov    %esi,(%esp)
+  803200:	53                   	push   %ebx
+  803201:	6a 00                	push   $0x0
+  803203:	68 00 f0 7f 00       	push   $0x7ff000
+  803208:	6a 00                	push   $0x0
+  80320a:	e8 5f dc ff ff       	call   800e6e <sys_page_map>
+  80320f:	83 c4 20             	add    $0x20,%esp
+  803212:	85 c0                	test   %eax,%eax
+  803214:	78 30                	js     803246 <mmap_copy+0x7c>
+      (r = sys_page_unmap(0, PFTEMP)) < 0)
+  803216:	83 ec 08             	sub    $0x8,%esp
+  803219:	68 00 f0 7f 00       	push   $0x7ff000
+  80321e:	6a 00                	push   $0x0
+  803220:	e8 8b dc ff ff       	call   800eb0 <sys_page_unmap>
+  if ((r = sys_page_map(0, PFTEMP, 0, (void *) va, perm)) < 0 ||
+  803225:	83 c4 10             	add    $0x10,%esp
+  803228:	85 c0                	test   %eax,%eax
+  80322a:	78 1a                	js     803246 <mmap_copy+0x7c>
+    panic("mmap: %e", r);
+}
+  80322c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80322f:	5b                   	pop    %ebx
+  803230:	5e                   	pop    %esi
+  803231:	5f                   	pop    %edi
+  803232:	5d                   	pop    %ebp
+  803233:	c3                   	ret
+    panic("mmap: %e", r);
+  803234:	50                   	push   %eax
+  803235:	68 ed 41 80 00       	push   $0x8041ed
+  80323a:	6a 3e                	push   $0x3e
+  80323c:	68 f6 41 80 00       	push   $0x8041f6
+  803241:	e8 ed d0 ff ff       	call   800333 <_panic>
+    panic("mmap: %e", r);
+  803246:	50                   	push   %eax
+  803247:	68 ed 41 80 00       	push   $0x8041ed
+  80324c:	6a 42                	push   $0x42
+  80324e:	68 f6 41 80 00       	push   $0x8041f6
+  803253:	e8 db d0 ff ff       	call   800333 <_panic>
+
+00803258 <mmap_fault>:
+// Handle a page fault in a mapping, if it is one.  Returns 1 if it was.
+// The fork page fault handlers call this first, so that mappings keep
+// working after a fork.
+bool
+mmap_fault(struct UTrapframe *utf)
+{
+  803258:	55                   	push   %ebp
+  803259:	89 e5                	mov    %esp,%ebp
+  80325b:	57                   	push   %edi
+  80325c:	56                   	push   %esi
+  80325d:	53                   	push   %ebx
+  80325e:	83 ec 1c             	sub    $0x1c,%esp
+  803261:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Fsreq_read_map saved;
+  struct Mmap *m;
+  uintptr_t va;
+  int perm, r;
+
+  va = ROUNDDOWN(utf->utf_fault_va, PGSIZE);
+  803264:	8b 1f                	mov    (%edi),%ebx
+  803266:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if (va < MMAPBASE || va >= MMAPTOP || (m = mmap_find(va)) == NULL)
+  80326c:	8d 83 00 00 00 60    	lea    0x60000000(%ebx),%eax
+  803272:	3d ff ff ff 2f       	cmp    $0x2fffffff,%eax
+  803277:	0f 87 24 01 00 00    	ja     8033a1 <mmap_fault+0x149>
+  80327d:	89 d8                	mov    %ebx,%eax
+  80327f:	e8 db fe ff ff       	call   80315f <mmap_find>
+  803284:	89 c6                	mov    %eax,%esi
+  803286:	85 c0                	test   %eax,%eax
+  803288:	0f 84 20 01 00 00    	je     8033ae <mmap_fault+0x156>
+    return 0;
+  if ((utf->utf_err & FEC_WR) && m->mm_perm == MAP_RDONLY)
+  80328e:	f6 47 04 02          	testb  $0x2,0x4(%edi)
+  803292:	74 13                	je     8032a7 <mmap_fault+0x4f>
+  803294:	83 78 10 00          	cmpl   $0x0,0x10(%eax)
+  803298:	0f 84 17 01 00 00    	je     8033b5 <mmap_fault+0x15d>
+    return 0;
+  perm = PTE_P | PTE_U | (m->mm_perm == MAP_RDONLY ? 0 : PTE_W);
+  80329e:	c7 45 e4 07 00 00 00 	movl   $0x7,-0x1c(%ebp)
+  8032a5:	eb 0f                	jmp    8032b6 <mmap_fault+0x5e>
+  8032a7:	83 78 10 01          	cmpl   $0x1,0x10(%eax)
+  8032ab:	19 c0                	sbb    %eax,%eax
+  8032ad:	83 e0 fe             	and    $0xfffffffe,%eax
+  8032b0:	83 c0 07             	add    $0x7,%eax
+  8032b3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+
+  if (!va_mapped(va)) {
+  8032b6:	89 d8                	mov    %ebx,%eax
+  8032b8:	e8 e4 fe ff ff       	call   8031a1 <va_mapped>
+  8032bd:	84 c0                	test   %al,%al
+  8032bf:	74 42                	je     803303 <mmap_fault+0xab>
+    }
+  }
+
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+    mmap_copy(va, PGSIZE, perm);
+  return 1;
+  8032c1:	b8 01 00 00 00       	mov    $0x1,%eax
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+  8032c6:	f6 47 04 02          	testb  $0x2,0x4(%edi)
+  8032ca:	0f 84 d6 00 00 00    	je     8033a6 <mmap_fault+0x14e>
+  8032d0:	89 d8                	mov    %ebx,%eax
+  8032d2:	c1 e8 0c             	shr    $0xc,%eax
+  8032d5:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  return 1;
+  8032dc:	b8 01 00 00 00       	mov    $0x1,%eax
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+  8032e1:	f6 c2 02             	test   $0x2,%dl
+  8032e4:	0f 85 bc 00 00 00    	jne    8033a6 <mmap_fault+0x14e>
+    mmap_copy(va, PGSIZE, perm);
+  8032ea:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8032ed:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8032f2:	89 d8                	mov    %ebx,%eax
+  8032f4:	e8 d1 fe ff ff       	call   8031ca <mmap_copy>
+  return 1;
+  8032f9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8032fe:	e9 a3 00 00 00       	jmp    8033a6 <mmap_fault+0x14e>
+    saved = fsipcbuf.read_map;
+  803303:	a1 00 70 80 00       	mov    0x807000,%eax
+  803308:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80330b:	8b 15 04 70 80 00    	mov    0x807004,%edx
+  803311:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    r = read_map(m->mm_fd, m->mm_offset + (va - m->mm_va), (void *) va);
+  803314:	83 ec 04             	sub    $0x4,%esp
+  803317:	53                   	push   %ebx
+  803318:	89 d8                	mov    %ebx,%eax
+  80331a:	03 46 0c             	add    0xc(%esi),%eax
+  80331d:	2b 06                	sub    (%esi),%eax
+  80331f:	50                   	push   %eax
+  803320:	ff 76 08             	push   0x8(%esi)
+  803323:	e8 35 f3 ff ff       	call   80265d <read_map>
+    fsipcbuf.read_map = saved;
+  803328:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80332b:	89 0d 00 70 80 00    	mov    %ecx,0x807000
+  803331:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  803334:	89 15 04 70 80 00    	mov    %edx,0x807004
+    if (r < 0)
+  80333a:	83 c4 10             	add    $0x10,%esp
+  80333d:	85 c0                	test   %eax,%eax
+  80333f:	78 20                	js     803361 <mmap_fault+0x109>
+    if (r == 0) {
+  803341:	74 30                	je     803373 <mmap_fault+0x11b>
+    if (r < PGSIZE) {
+  803343:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  803348:	0f 8f 73 ff ff ff    	jg     8032c1 <mmap_fault+0x69>
+      mmap_copy(va, r, perm);
+  80334e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803351:	89 c2                	mov    %eax,%edx
+  803353:	89 d8                	mov    %ebx,%eax
+  803355:	e8 70 fe ff ff       	call   8031ca <mmap_copy>
+      return 1;
+  80335a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80335f:	eb 45                	jmp    8033a6 <mmap_fault+0x14e>
+      panic("mmap: read_map: %e", r);
+  803361:	50                   	push   %eax
+  803362:	68 01 42 80 00       	push   $0x804201
+  803367:	6a 5f                	push   $0x5f
+  803369:	68 f6 41 80 00       	push   $0x8041f6
+  80336e:	e8 c0 cf ff ff       	call   800333 <_panic>
+      if ((r = sys_page_alloc(0, (void *) va, perm)) < 0)
+  803373:	83 ec 04             	sub    $0x4,%esp
+  803376:	ff 75 e4             	push   -0x1c(%ebp)
+  803379:	53                   	push   %ebx
+  80337a:	6a 00                	push   $0x0
+  80337c:	e8 aa da ff ff       	call   800e2b <sys_page_alloc>
+  803381:	83 c4 10             	add    $0x10,%esp
+  803384:	85 c0                	test   %eax,%eax
+  803386:	78 07                	js     80338f <mmap_fault+0x137>
+      return 1;
+  803388:	b8 01 00 00 00       	mov    $0x1,%eax
+  80338d:	eb 17                	jmp    8033a6 <mmap_fault+0x14e>
+        panic("mmap: %e", r);
+  80338f:	50                   	push   %eax
+  803390:	68 ed 41 80 00       	push   $0x8041ed
+  803395:	6a 64                	push   $0x64
+  803397:	68 f6 41 80 00       	push   $0x8041f6
+  80339c:	e8 92 cf ff ff       	call   800333 <_panic>
+    return 0;
+  8033a1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8033a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033a9:	5b                   	pop    %ebx
+  8033aa:	5e                   	pop    %esi
+  8033ab:	5f                   	pop    %edi
+  8033ac:	5d                   	pop    %ebp
+  8033ad:	c3                   	ret
+    return 0;
+  8033ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033b3:	eb f1                	jmp    8033a6 <mmap_fault+0x14e>
+    return 0;
+  8033b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033ba:	eb ea                	jmp    8033a6 <mmap_fault+0x14e>
+
+008033bc <mmap_pgfault>:
+{
+  8033bc:	55                   	push   %ebp
+  8033bd:	89 e5                	mov    %esp,%ebp
+  8033bf:	53                   	push   %ebx
+  8033c0:	83 ec 10             	sub    $0x10,%esp
+  8033c3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (!mmap_fault(utf))
+  8033c6:	53                   	push   %ebx
+  8033c7:	e8 8c fe ff ff       	call   803258 <mmap_fault>
+  8033cc:	83 c4 10             	add    $0x10,%esp
+  8033cf:	84 c0                	test   %al,%al
+  8033d1:	74 05                	je     8033d8 <mmap_pgfault+0x1c>
+}
+  8033d3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8033d6:	c9                   	leave
+  8033d7:	c3                   	ret
+    panic("page fault at %08x, eip %08x, err %04x", utf->utf_fault_va,
+  8033d8:	83 ec 08             	sub    $0x8,%esp
+  8033db:	ff 73 04             	push   0x4(%ebx)
+  8033de:	ff 73 28             	push   0x28(%ebx)
+  8033e1:	ff 33                	push   (%ebx)
+  8033e3:	68 14 42 80 00       	push   $0x804214
+  8033e8:	6a 20                	push   $0x20
+  8033ea:	68 f6 41 80 00       	push   $0x8041f6
+  8033ef:	e8 3f cf ff ff       	call   800333 <_panic>
+
+008033f4 <mmap>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_INVAL if offset isn't aligned, len is 0, or perm is unknown
+//	-E_NO_MEM if there's no free slot or address space for it
+int
+mmap(int fdnum, off_t offset, size_t len, int perm, void **addr)
+{
+  8033f4:	55                   	push   %ebp
+  8033f5:	89 e5                	mov    %esp,%ebp
+  8033f7:	57                   	push   %edi
+  8033f8:	56                   	push   %esi
+  8033f9:	53                   	push   %ebx
+  8033fa:	83 ec 44             	sub    $0x44,%esp
+  8033fd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  struct Fd *fd;
+  uintptr_t va;
+  int i, j, r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803400:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  803403:	50                   	push   %eax
+  803404:	ff 75 08             	push   0x8(%ebp)
+  803407:	e8 df e4 ff ff       	call   8018eb <fd_lookup>
+  80340c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80340f:	83 c4 10             	add    $0x10,%esp
+  803412:	85 c0                	test   %eax,%eax
+  803414:	0f 88 3e 01 00 00    	js     803558 <mmap+0x164>
+    return r;
+  if (offset < 0 || PGOFF(offset) || len == 0 ||
+  80341a:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80341e:	0f 88 d1 00 00 00    	js     8034f5 <mmap+0x101>
+  803424:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803427:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80342c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80342f:	0f 85 c9 00 00 00    	jne    8034fe <mmap+0x10a>
+  803435:	85 db                	test   %ebx,%ebx
+  803437:	0f 84 ca 00 00 00    	je     803507 <mmap+0x113>
+  80343d:	83 7d 14 02          	cmpl   $0x2,0x14(%ebp)
+  803441:	0f 87 c0 00 00 00    	ja     803507 <mmap+0x113>
+      (perm != MAP_RDONLY && perm != MAP_PRIVATE && perm != MAP_SHARED))
+    return -E_INVAL;
+  len = ROUNDUP(len, PGSIZE);
+  803447:	81 c3 ff 0f 00 00    	add    $0xfff,%ebx
+  80344d:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  803453:	89 d9                	mov    %ebx,%ecx
+  803455:	89 5d c4             	mov    %ebx,-0x3c(%ebp)
+
+  // First fit: try the start of the region and the end of each
+  // mapping.
+  for (i = -1; i < NMMAP; i++) {
+  803458:	bb 4c 67 80 00       	mov    $0x80674c,%ebx
+  80345d:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+    if (i >= 0 && !mmaps[i].mm_va)
+      continue;
+    va = i < 0 ? MMAPBASE : mmaps[i].mm_va + mmaps[i].mm_len;
+  803462:	bf 00 00 00 a0       	mov    $0xa0000000,%edi
+  803467:	eb 53                	jmp    8034bc <mmap+0xc8>
+  803469:	bf 00 00 00 a0       	mov    $0xa0000000,%edi
+  80346e:	eb 4c                	jmp    8034bc <mmap+0xc8>
+    if (len > MMAPTOP - va)
+      continue;
+    for (j = 0; j < NMMAP; j++)
+  803470:	83 c0 01             	add    $0x1,%eax
+  803473:	83 f8 10             	cmp    $0x10,%eax
+  803476:	0f 84 e7 00 00 00    	je     803563 <mmap+0x16f>
+      if (mmaps[j].mm_va && va < mmaps[j].mm_va + mmaps[j].mm_len &&
+  80347c:	8d 34 80             	lea    (%eax,%eax,4),%esi
+  80347f:	8b 14 b5 60 67 80 00 	mov    0x806760(,%esi,4),%edx
+  803486:	85 d2                	test   %edx,%edx
+  803488:	74 e6                	je     803470 <mmap+0x7c>
+  80348a:	89 d1                	mov    %edx,%ecx
+  80348c:	03 0c b5 64 67 80 00 	add    0x806764(,%esi,4),%ecx
+  803493:	39 cf                	cmp    %ecx,%edi
+  803495:	73 d9                	jae    803470 <mmap+0x7c>
+  803497:	39 da                	cmp    %ebx,%edx
+  803499:	73 d5                	jae    803470 <mmap+0x7c>
+  80349b:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80349e:	8b 55 cc             	mov    -0x34(%ebp),%edx
+  8034a1:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  for (i = -1; i < NMMAP; i++) {
+  8034a4:	83 c2 01             	add    $0x1,%edx
+  8034a7:	83 c3 14             	add    $0x14,%ebx
+  8034aa:	83 fa 10             	cmp    $0x10,%edx
+  8034ad:	74 2b                	je     8034da <mmap+0xe6>
+    if (i >= 0 && !mmaps[i].mm_va)
+  8034af:	85 d2                	test   %edx,%edx
+  8034b1:	78 b6                	js     803469 <mmap+0x75>
+  8034b3:	8b 3b                	mov    (%ebx),%edi
+  8034b5:	85 ff                	test   %edi,%edi
+  8034b7:	74 eb                	je     8034a4 <mmap+0xb0>
+    va = i < 0 ? MMAPBASE : mmaps[i].mm_va + mmaps[i].mm_len;
+  8034b9:	03 7b 04             	add    0x4(%ebx),%edi
+    if (len > MMAPTOP - va)
+  8034bc:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8034c1:	29 f8                	sub    %edi,%eax
+  8034c3:	39 c8                	cmp    %ecx,%eax
+  8034c5:	72 dd                	jb     8034a4 <mmap+0xb0>
+    for (j = 0; j < NMMAP; j++)
+  8034c7:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+          mmaps[j].mm_va < va + len)
+  8034ca:	8d 34 0f             	lea    (%edi,%ecx,1),%esi
+  8034cd:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  8034d0:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  8034d3:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+  8034d6:	89 f3                	mov    %esi,%ebx
+  8034d8:	eb a2                	jmp    80347c <mmap+0x88>
+        break;
+    if (j == NMMAP)
+      break;
+  }
+  if (i == NMMAP)
+    return -E_NO_MEM;
+  8034da:	c7 45 d4 fc ff ff ff 	movl   $0xfffffffc,-0x2c(%ebp)
+  8034e1:	eb 75                	jmp    803558 <mmap+0x164>
+    ;
+  if (j == NMMAP)
+    return -E_NO_MEM;
+
+  if (_pgfault_handler == 0)
+    set_pgfault_handler(mmap_pgfault);
+  8034e3:	83 ec 0c             	sub    $0xc,%esp
+  8034e6:	68 bc 33 80 00       	push   $0x8033bc
+  8034eb:	e8 f7 03 00 00       	call   8038e7 <set_pgfault_handler>
+  8034f0:	83 c4 10             	add    $0x10,%esp
+  8034f3:	eb 24                	jmp    803519 <mmap+0x125>
+    return -E_INVAL;
+  8034f5:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  8034fc:	eb 5a                	jmp    803558 <mmap+0x164>
+  8034fe:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  803505:	eb 51                	jmp    803558 <mmap+0x164>
+  803507:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  80350e:	eb 48                	jmp    803558 <mmap+0x164>
+  if (_pgfault_handler == 0)
+  803510:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  803517:	74 ca                	je     8034e3 <mmap+0xef>
+
+  mmaps[j].mm_va = va;
+  803519:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803520:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803523:	c1 e2 02             	shl    $0x2,%edx
+  803526:	89 ba 60 67 80 00    	mov    %edi,0x806760(%edx)
+  mmaps[j].mm_len = len;
+  80352c:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  80352f:	89 b2 64 67 80 00    	mov    %esi,0x806764(%edx)
+  mmaps[j].mm_fd = fdnum;
+  803535:	8b 75 08             	mov    0x8(%ebp),%esi
+  803538:	89 b2 68 67 80 00    	mov    %esi,0x806768(%edx)
+  mmaps[j].mm_offset = offset;
+  80353e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803541:	89 b2 6c 67 80 00    	mov    %esi,0x80676c(%edx)
+  mmaps[j].mm_perm = perm;
+  803547:	01 d8                	add    %ebx,%eax
+  803549:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  80354c:	89 1c 85 70 67 80 00 	mov    %ebx,0x806770(,%eax,4)
+  *addr = (void *) va;
+  803553:	8b 45 18             	mov    0x18(%ebp),%eax
+  803556:	89 38                	mov    %edi,(%eax)
+  return 0;
+}
+  803558:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80355b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80355e:	5b                   	pop    %ebx
+  80355f:	5e                   	pop    %esi
+  803560:	5f                   	pop    %edi
+  803561:	5d                   	pop    %ebp
+  803562:	c3                   	ret
+  if (i == NMMAP)
+  803563:	b8 60 67 80 00       	mov    $0x806760,%eax
+  for (j = 0; j < NMMAP && mmaps[j].mm_va; j++)
+  803568:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+  80356b:	83 c0 14             	add    $0x14,%eax
+  80356e:	83 78 ec 00          	cmpl   $0x0,-0x14(%eax)
+  803572:	74 9c                	je     803510 <mmap+0x11c>
+  803574:	83 c3 01             	add    $0x1,%ebx
+  803577:	83 fb 10             	cmp    $0x10,%ebx
+  80357a:	75 ef                	jne    80356b <mmap+0x177>
+    return -E_NO_MEM;
+  80357c:	c7 45 d4 fc ff ff ff 	movl   $0xfffffffc,-0x2c(%ebp)
+  803583:	eb d3                	jmp    803558 <mmap+0x164>
+
+00803585 <msync>:
+// nothing for other kinds of mapping.
+//
+// Returns 0 on success, < 0 on error.
+int
+msync(void *addr)
+{
+  803585:	55                   	push   %ebp
+  803586:	89 e5                	mov    %esp,%ebp
+  803588:	57                   	push   %edi
+  803589:	56                   	push   %esi
+  80358a:	53                   	push   %ebx
+  80358b:	81 ec ac 00 00 00    	sub    $0xac,%esp
+  struct Stat st;
+  off_t saved, off;
+  uintptr_t va;
+  int n, r;
+
+  if ((m = mmap_find((uintptr_t) addr)) == NULL)
+  803591:	8b 45 08             	mov    0x8(%ebp),%eax
+  803594:	e8 c6 fb ff ff       	call   80315f <mmap_find>
+  803599:	85 c0                	test   %eax,%eax
+  80359b:	0f 84 58 01 00 00    	je     8036f9 <msync+0x174>
+  8035a1:	89 c7                	mov    %eax,%edi
+    return -E_INVAL;
+  if (m->mm_perm != MAP_SHARED)
+    return 0;
+  8035a3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  if (m->mm_perm != MAP_SHARED)
+  8035a8:	83 78 10 02          	cmpl   $0x2,0x10(%eax)
+  8035ac:	74 0a                	je     8035b8 <msync+0x33>
+                          PTE_P | PTE_U | PTE_W)) < 0)
+      break;
+  }
+  fd->fd_offset = saved;
+  return r < 0 ? r : 0;
+}
+  8035ae:	89 d8                	mov    %ebx,%eax
+  8035b0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8035b3:	5b                   	pop    %ebx
+  8035b4:	5e                   	pop    %esi
+  8035b5:	5f                   	pop    %edi
+  8035b6:	5d                   	pop    %ebp
+  8035b7:	c3                   	ret
+  if ((r = fd_lookup(m->mm_fd, &fd)) < 0 || (r = fstat(m->mm_fd, &st)) < 0)
+  8035b8:	83 ec 08             	sub    $0x8,%esp
+  8035bb:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8035be:	50                   	push   %eax
+  8035bf:	ff 77 08             	push   0x8(%edi)
+  8035c2:	e8 24 e3 ff ff       	call   8018eb <fd_lookup>
+  8035c7:	89 c3                	mov    %eax,%ebx
+  8035c9:	83 c4 10             	add    $0x10,%esp
+  8035cc:	85 c0                	test   %eax,%eax
+  8035ce:	78 de                	js     8035ae <msync+0x29>
+  8035d0:	83 ec 08             	sub    $0x8,%esp
+  8035d3:	8d 85 58 ff ff ff    	lea    -0xa8(%ebp),%eax
+  8035d9:	50                   	push   %eax
+  8035da:	ff 77 08             	push   0x8(%edi)
+  8035dd:	e8 ac e7 ff ff       	call   801d8e <fstat>
+  8035e2:	89 c3                	mov    %eax,%ebx
+  8035e4:	83 c4 10             	add    $0x10,%esp
+  8035e7:	85 c0                	test   %eax,%eax
+  8035e9:	78 c3                	js     8035ae <msync+0x29>
+  saved = fd->fd_offset;
+  8035eb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8035ee:	8b 40 04             	mov    0x4(%eax),%eax
+  8035f1:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%ebp)
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE) {
+  8035f7:	8b 37                	mov    (%edi),%esi
+  8035f9:	eb 29                	jmp    803624 <msync+0x9f>
+    if ((r = sys_page_map(0, (void *) va, 0, (void *) va,
+  8035fb:	83 ec 0c             	sub    $0xc,%esp
+  8035fe:	6a 07                	push   $0x7
+  803600:	8b 85 50 ff ff ff    	mov    -0xb0(%ebp),%eax
+  803606:	50                   	push   %eax
+  803607:	6a 00                	push   $0x0
+  803609:	50                   	push   %eax
+  80360a:	6a 00                	push   $0x0
+  80360c:	e8 5d d8 ff ff       	call   800e6e <sys_page_map>
+  803611:	89 c3                	mov    %eax,%ebx
+  803613:	83 c4 20             	add    $0x20,%esp
+  803616:	85 c0                	test   %eax,%eax
+  803618:	0f 88 c0 00 00 00    	js     8036de <msync+0x159>
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE) {
+  80361e:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803624:	8b 07                	mov    (%edi),%eax
+  803626:	89 85 54 ff ff ff    	mov    %eax,-0xac(%ebp)
+  80362c:	03 47 04             	add    0x4(%edi),%eax
+  80362f:	39 c6                	cmp    %eax,%esi
+  803631:	0f 83 a7 00 00 00    	jae    8036de <msync+0x159>
+    if (!va_mapped(va) || !(uvpt[PGNUM(va)] & PTE_D))
+  803637:	89 f0                	mov    %esi,%eax
+  803639:	e8 63 fb ff ff       	call   8031a1 <va_mapped>
+  80363e:	84 c0                	test   %al,%al
+  803640:	74 dc                	je     80361e <msync+0x99>
+  803642:	89 f0                	mov    %esi,%eax
+  803644:	c1 e8 0c             	shr    $0xc,%eax
+  803647:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80364e:	a8 40                	test   $0x40,%al
+  803650:	74 cc                	je     80361e <msync+0x99>
+    off = m->mm_offset + (va - m->mm_va);
+  803652:	8b 47 0c             	mov    0xc(%edi),%eax
+  803655:	8b 8d 54 ff ff ff    	mov    -0xac(%ebp),%ecx
+  80365b:	29 c8                	sub    %ecx,%eax
+  80365d:	01 f0                	add    %esi,%eax
+    if (off >= st.st_size)
+  80365f:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  803662:	39 c2                	cmp    %eax,%edx
+  803664:	7e 78                	jle    8036de <msync+0x159>
+    n = MIN(PGSIZE, st.st_size - off);
+  803666:	29 c2                	sub    %eax,%edx
+  803668:	89 d1                	mov    %edx,%ecx
+  80366a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80366f:	39 d1                	cmp    %edx,%ecx
+  803671:	0f 4e d1             	cmovle %ecx,%edx
+  803674:	89 95 54 ff ff ff    	mov    %edx,-0xac(%ebp)
+    if ((r = seek(m->mm_fd, off)) < 0 ||
+  80367a:	83 ec 08             	sub    $0x8,%esp
+  80367d:	50                   	push   %eax
+  80367e:	ff 77 08             	push   0x8(%edi)
+  803681:	e8 60 e6 ff ff       	call   801ce6 <seek>
+  803686:	89 c3                	mov    %eax,%ebx
+  803688:	83 c4 10             	add    $0x10,%esp
+  80368b:	85 c0                	test   %eax,%eax
+  80368d:	78 4f                	js     8036de <msync+0x159>
+        (r = write(m->mm_fd, (void *) va, n)) < 0)
+  80368f:	89 b5 50 ff ff ff    	mov    %esi,-0xb0(%ebp)
+  803695:	83 ec 04             	sub    $0x4,%esp
+  803698:	ff b5 54 ff ff ff    	push   -0xac(%ebp)
+  80369e:	56                   	push   %esi
+  80369f:	ff 77 08             	push   0x8(%edi)
+  8036a2:	e8 bd e5 ff ff       	call   801c64 <write>
+  8036a7:	89 c3                	mov    %eax,%ebx
+    if ((r = seek(m->mm_fd, off)) < 0 ||
+  8036a9:	83 c4 10             	add    $0x10,%esp
+  8036ac:	85 c0                	test   %eax,%eax
+  8036ae:	78 2e                	js     8036de <msync+0x159>
+    if (r < n && (r = write(m->mm_fd, (char *) va + r, n - r)) < 0)
+  8036b0:	8b 95 54 ff ff ff    	mov    -0xac(%ebp),%edx
+  8036b6:	39 c2                	cmp    %eax,%edx
+  8036b8:	0f 8e 3d ff ff ff    	jle    8035fb <msync+0x76>
+  8036be:	89 d0                	mov    %edx,%eax
+  8036c0:	29 d8                	sub    %ebx,%eax
+  8036c2:	01 f3                	add    %esi,%ebx
+  8036c4:	83 ec 04             	sub    $0x4,%esp
+  8036c7:	50                   	push   %eax
+  8036c8:	53                   	push   %ebx
+  8036c9:	ff 77 08             	push   0x8(%edi)
+  8036cc:	e8 93 e5 ff ff       	call   801c64 <write>
+  8036d1:	89 c3                	mov    %eax,%ebx
+  8036d3:	83 c4 10             	add    $0x10,%esp
+  8036d6:	85 c0                	test   %eax,%eax
+  8036d8:	0f 89 1d ff ff ff    	jns    8035fb <msync+0x76>
+  fd->fd_offset = saved;
+  8036de:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8036e1:	8b 8d 4c ff ff ff    	mov    -0xb4(%ebp),%ecx
+  8036e7:	89 48 04             	mov    %ecx,0x4(%eax)
+  return r < 0 ? r : 0;
+  8036ea:	85 db                	test   %ebx,%ebx
+  8036ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036f1:	0f 4f d8             	cmovg  %eax,%ebx
+  8036f4:	e9 b5 fe ff ff       	jmp    8035ae <msync+0x29>
+    return -E_INVAL;
+  8036f9:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8036fe:	e9 ab fe ff ff       	jmp    8035ae <msync+0x29>
+
+00803703 <munmap>:
+// Remove the mapping at 'addr', writing a MAP_SHARED one back first.
+//
+// Returns 0 on success, < 0 on error.
+int
+munmap(void *addr)
+{
+  803703:	55                   	push   %ebp
+  803704:	89 e5                	mov    %esp,%ebp
+  803706:	56                   	push   %esi
+  803707:	53                   	push   %ebx
+  803708:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct Mmap *m;
+  uintptr_t va;
+  int r;
+
+  if ((m = mmap_find((uintptr_t) addr)) == NULL)
+  80370b:	89 d8                	mov    %ebx,%eax
+  80370d:	e8 4d fa ff ff       	call   80315f <mmap_find>
+  803712:	85 c0                	test   %eax,%eax
+  803714:	74 56                	je     80376c <munmap+0x69>
+  803716:	89 c6                	mov    %eax,%esi
+    return -E_INVAL;
+  if ((r = msync(addr)) < 0)
+  803718:	83 ec 0c             	sub    $0xc,%esp
+  80371b:	53                   	push   %ebx
+  80371c:	e8 64 fe ff ff       	call   803585 <msync>
+  803721:	83 c4 10             	add    $0x10,%esp
+  803724:	85 c0                	test   %eax,%eax
+  803726:	78 3d                	js     803765 <munmap+0x62>
+    return r;
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE)
+  803728:	8b 1e                	mov    (%esi),%ebx
+  80372a:	eb 06                	jmp    803732 <munmap+0x2f>
+  80372c:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803732:	8b 46 04             	mov    0x4(%esi),%eax
+  803735:	03 06                	add    (%esi),%eax
+  803737:	39 c3                	cmp    %eax,%ebx
+  803739:	73 1f                	jae    80375a <munmap+0x57>
+    if (va_mapped(va) && (r = sys_page_unmap(0, (void *) va)) < 0)
+  80373b:	89 d8                	mov    %ebx,%eax
+  80373d:	e8 5f fa ff ff       	call   8031a1 <va_mapped>
+  803742:	84 c0                	test   %al,%al
+  803744:	74 e6                	je     80372c <munmap+0x29>
+  803746:	83 ec 08             	sub    $0x8,%esp
+  803749:	53                   	push   %ebx
+  80374a:	6a 00                	push   $0x0
+  80374c:	e8 5f d7 ff ff       	call   800eb0 <sys_page_unmap>
+  803751:	83 c4 10             	add    $0x10,%esp
+  803754:	85 c0                	test   %eax,%eax
+  803756:	79 d4                	jns    80372c <munmap+0x29>
+  803758:	eb 0b                	jmp    803765 <munmap+0x62>
+      return r;
+  m->mm_va = 0;
+  80375a:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  return 0;
+  803760:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803765:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803768:	5b                   	pop    %ebx
+  803769:	5e                   	pop    %esi
+  80376a:	5d                   	pop    %ebp
+  80376b:	c3                   	ret
+    return -E_INVAL;
+  80376c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803771:	eb f2                	jmp    803765 <munmap+0x62>
+
+00803773 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  803773:	b8 00 00 00 00       	mov    $0x0,%eax
+  803778:	c3                   	ret
+
+00803779 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803779:	55                   	push   %ebp
+  80377a:	89 e5                	mov    %esp,%ebp
+  80377c:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  80377f:	68 3b 42 80 00       	push   $0x80423b
+  803784:	ff 75 0c             	push   0xc(%ebp)
+  803787:	e8 70 d2 ff ff       	call   8009fc <strcpy>
+  return 0;
+}
+  80378c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803791:	c9                   	leave
+  803792:	c3                   	ret
+
+00803793 <devcons_write>:
+{
+  803793:	55                   	push   %ebp
+  803794:	89 e5                	mov    %esp,%ebp
+  803796:	57                   	push   %edi
+  803797:	56                   	push   %esi
+  803798:	53                   	push   %ebx
+  803799:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  80379f:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  8037a4:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  8037aa:	eb 2e                	jmp    8037da <devcons_write+0x47>
+    m = n - tot;
+  8037ac:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8037af:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  8037b1:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8037b6:	39 c3                	cmp    %eax,%ebx
+  8037b8:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  8037bb:	83 ec 04             	sub    $0x4,%esp
+  8037be:	53                   	push   %ebx
+  8037bf:	89 f0                	mov    %esi,%eax
+  8037c1:	03 45 0c             	add    0xc(%ebp),%eax
+  8037c4:	50                   	push   %eax
+  8037c5:	57                   	push   %edi
+  8037c6:	e8 b7 d3 ff ff       	call   800b82 <memmove>
+    sys_cputs(buf, m);
+  8037cb:	83 c4 08             	add    $0x8,%esp
+  8037ce:	53                   	push   %ebx
+  8037cf:	57                   	push   %edi
+  8037d0:	e8 57 d5 ff ff       	call   800d2c <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  8037d5:	01 de                	add    %ebx,%esi
+  8037d7:	83 c4 10             	add    $0x10,%esp
+  8037da:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8037dd:	72 cd                	jb     8037ac <devcons_write+0x19>
+}
+  8037df:	89 f0                	mov    %esi,%eax
+  8037e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8037e4:	5b                   	pop    %ebx
+  8037e5:	5e                   	pop    %esi
+  8037e6:	5f                   	pop    %edi
+  8037e7:	5d                   	pop    %ebp
+  8037e8:	c3                   	ret
+
+008037e9 <devcons_read>:
+{
+  8037e9:	55                   	push   %ebp
+  8037ea:	89 e5                	mov    %esp,%ebp
+  8037ec:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  8037ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037f4:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8037f8:	75 07                	jne    803801 <devcons_read+0x18>
+  8037fa:	eb 1f                	jmp    80381b <devcons_read+0x32>
+    sys_yield();
+  8037fc:	e8 c8 d5 ff ff       	call   800dc9 <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  803801:	e8 44 d5 ff ff       	call   800d4a <sys_cgetc>
+  803806:	85 c0                	test   %eax,%eax
+  803808:	74 f2                	je     8037fc <devcons_read+0x13>
+  if (c < 0)
+  80380a:	78 0f                	js     80381b <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  80380c:	83 f8 04             	cmp    $0x4,%eax
+  80380f:	74 0c                	je     80381d <devcons_read+0x34>
+  *(char*)vbuf = c;
+  803811:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803814:	88 02                	mov    %al,(%edx)
+  return 1;
+  803816:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80381b:	c9                   	leave
+  80381c:	c3                   	ret
+    return 0;
+  80381d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803822:	eb f7                	jmp    80381b <devcons_read+0x32>
+
+00803824 <cputchar>:
+{
+  803824:	55                   	push   %ebp
+  803825:	89 e5                	mov    %esp,%ebp
+  803827:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  80382a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80382d:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  803830:	6a 01                	push   $0x1
+  803832:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803835:	50                   	push   %eax
+  803836:	e8 f1 d4 ff ff       	call   800d2c <sys_cputs>
+}
+  80383b:	83 c4 10             	add    $0x10,%esp
+  80383e:	c9                   	leave
+  80383f:	c3                   	ret
+
+00803840 <getchar>:
+{
+  803840:	55                   	push   %ebp
+  803841:	89 e5                	mov    %esp,%ebp
+  803843:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  803846:	6a 01                	push   $0x1
+  803848:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80384b:	50                   	push   %eax
+  80384c:	6a 00                	push   $0x0
+  80384e:	e8 43 e3 ff ff       	call   801b96 <read>
+  if (r < 0)
+  803853:	83 c4 10             	add    $0x10,%esp
+  803856:	85 c0                	test   %eax,%eax
+  803858:	78 06                	js     803860 <getchar+0x20>
+  if (r < 1)
+  80385a:	74 06                	je     803862 <getchar+0x22>
+  return c;
+  80385c:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803860:	c9                   	leave
+  803861:	c3                   	ret
+    return -E_EOF;
+  803862:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803867:	eb f7                	jmp    803860 <getchar+0x20>
+
+00803869 <iscons>:
+{
+  803869:	55                   	push   %ebp
+  80386a:	89 e5                	mov    %esp,%ebp
+  80386c:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80386f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803872:	50                   	push   %eax
+  803873:	ff 75 08             	push   0x8(%ebp)
+  803876:	e8 70 e0 ff ff       	call   8018eb <fd_lookup>
+  80387b:	83 c4 10             	add    $0x10,%esp
+  80387e:	85 c0                	test   %eax,%eax
+  803880:	78 11                	js     803893 <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  803882:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803885:	8b 15 3c 50 80 00    	mov    0x80503c,%edx
+  80388b:	39 10                	cmp    %edx,(%eax)
+  80388d:	0f 94 c0             	sete   %al
+  803890:	0f b6 c0             	movzbl %al,%eax
+}
+  803893:	c9                   	leave
+  803894:	c3                   	ret
+
+00803895 <opencons>:
+{
+  803895:	55                   	push   %ebp
+  803896:	89 e5                	mov    %esp,%ebp
+  803898:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  80389b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80389e:	50                   	push   %eax
+  80389f:	e8 f1 df ff ff       	call   801895 <fd_alloc>
+  8038a4:	83 c4 10             	add    $0x10,%esp
+  8038a7:	85 c0                	test   %eax,%eax
+  8038a9:	78 3a                	js     8038e5 <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8038ab:	83 ec 04             	sub    $0x4,%esp
+  8038ae:	68 07 04 00 00       	push   $0x407
+  8038b3:	ff 75 f4             	push   -0xc(%ebp)
+  8038b6:	6a 00                	push   $0x0
+  8038b8:	e8 6e d5 ff ff       	call   800e2b <sys_page_alloc>
+  8038bd:	83 c4 10             	add    $0x10,%esp
+  8038c0:	85 c0                	test   %eax,%eax
+  8038c2:	78 21                	js     8038e5 <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  8038c4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8038c7:	8b 15 3c 50 80 00    	mov    0x80503c,%edx
+  8038cd:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  8038cf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8038d2:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  8038d9:	83 ec 0c             	sub    $0xc,%esp
+  8038dc:	50                   	push   %eax
+  8038dd:	e8 8f df ff ff       	call   801871 <fd2num>
+  8038e2:	83 c4 10             	add    $0x10,%esp
+}
+  8038e5:	c9                   	leave
+  8038e6:	c3                   	ret
+
+008038e7 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8038e7:	55                   	push   %ebp
+  8038e8:	89 e5                	mov    %esp,%ebp
+  8038ea:	53                   	push   %ebx
+  8038eb:	83 ec 04             	sub    $0x4,%esp
+  int r;
+
+  if (_pgfault_handler == 0) {
+  8038ee:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  8038f5:	74 0d                	je     803904 <set_pgfault_handler+0x1d>
+
+    sys_env_set_pgfault_upcall(id, _pgfault_upcall);
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  8038f7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8038fa:	a3 00 80 80 00       	mov    %eax,0x808000
+}
+  8038ff:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803902:	c9                   	leave
+  803903:	c3                   	ret
+    envid_t id = sys_getenvid();
+  803904:	e8 a1 d4 ff ff       	call   800daa <sys_getenvid>
+  803909:	89 c3                	mov    %eax,%ebx
+    sys_page_alloc(id, (void *) (UXSTACKTOP - PGSIZE), (PTE_P | PTE_U | PTE_W));
+  80390b:	83 ec 04             	sub    $0x4,%esp
+  80390e:	6a 07                	push   $0x7
+  803910:	68 00 f0 bf ee       	push   $0xeebff000
+  803915:	50                   	push   %eax
+  803916:	e8 10 d5 ff ff       	call   800e2b <sys_page_alloc>
+    sys_env_set_pgfault_upcall(id, _pgfault_upcall);
+  80391b:	83 c4 08             	add    $0x8,%esp
+  80391e:	68 2e 39 80 00       	push   $0x80392e
+  803923:	53                   	push   %ebx
+  803924:	e8 77 d7 ff ff       	call   8010a0 <sys_env_set_pgfault_upcall>
+  803929:	83 c4 10             	add    $0x10,%esp
+  80392c:	eb c9                	jmp    8038f7 <set_pgfault_handler+0x10>
+
+0080392e <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  80392e:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  80392f:	a1 00 80 80 00       	mov    0x808000,%eax
+	call *%eax
+  803934:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  803936:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+  movl 48(%esp), %eax       // move trap time esp to eax
+  803939:	8b 44 24 30          	mov    0x30(%esp),%eax
+  subl $4, %eax             // make room for eip on trap time esp
+  80393d:	83 e8 04             	sub    $0x4,%eax
+  movl %eax, 48(%esp)       // move value to esp
+  803940:	89 44 24 30          	mov    %eax,0x30(%esp)
+  movl 40(%esp), %ebx       // move trap time eip to ebx
+  803944:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+  movl %ebx, 0(%eax)
+  803948:	89 18                	mov    %ebx,(%eax)
+
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+  addl $0x08,%esp
+  80394a:	83 c4 08             	add    $0x8,%esp
+  popal
+  80394d:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+  addl $4, %esp          // skip tf->eip
+  80394e:	83 c4 04             	add    $0x4,%esp
+  popf                 // pop stack value into flags register
+  803951:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+  popl %esp
+  803952:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+  ret
+  803953:	c3                   	ret
+
+00803954 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803954:	55                   	push   %ebp
+  803955:	89 e5                	mov    %esp,%ebp
+  803957:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  80395a:	89 c2                	mov    %eax,%edx
+  80395c:	c1 ea 16             	shr    $0x16,%edx
+  80395f:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  803966:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  80396b:	f6 c1 01             	test   $0x1,%cl
+  80396e:	74 1c                	je     80398c <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  803970:	c1 e8 0c             	shr    $0xc,%eax
+  803973:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  80397a:	a8 01                	test   $0x1,%al
+  80397c:	74 0e                	je     80398c <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  80397e:	c1 e8 0c             	shr    $0xc,%eax
+  803981:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  803988:	ef 
+  803989:	0f b7 d2             	movzwl %dx,%edx
+}
+  80398c:	89 d0                	mov    %edx,%eax
+  80398e:	5d                   	pop    %ebp
+  80398f:	c3                   	ret
+
+00803990 <udivmod>:
+  803990:	55                   	push   %ebp
+  803991:	57                   	push   %edi
+  803992:	56                   	push   %esi
+  803993:	53                   	push   %ebx
+  803994:	83 ec 14             	sub    $0x14,%esp
+  803997:	8b 74 24 28          	mov    0x28(%esp),%esi
+  80399b:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  80399f:	89 fb                	mov    %edi,%ebx
+  8039a1:	09 f3                	or     %esi,%ebx
+  8039a3:	0f 84 88 00 00 00    	je     803a31 <udivmod+0xa1>
+  8039a9:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8039ae:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8039b5:	00 
+  8039b6:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8039bd:	00 
+  8039be:	89 cd                	mov    %ecx,%ebp
+  8039c0:	89 34 24             	mov    %esi,(%esp)
+  8039c3:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  8039c7:	eb 08                	jmp    8039d1 <udivmod+0x41>
+  8039c9:	83 ed 01             	sub    $0x1,%ebp
+  8039cc:	83 fd ff             	cmp    $0xffffffff,%ebp
+  8039cf:	74 6c                	je     803a3d <udivmod+0xad>
+  8039d1:	89 c3                	mov    %eax,%ebx
+  8039d3:	89 d6                	mov    %edx,%esi
+  8039d5:	89 e9                	mov    %ebp,%ecx
+  8039d7:	0f ad f3             	shrd   %cl,%esi,%ebx
+  8039da:	d3 ee                	shr    %cl,%esi
+  8039dc:	f6 c1 20             	test   $0x20,%cl
+  8039df:	74 04                	je     8039e5 <udivmod+0x55>
+  8039e1:	89 f3                	mov    %esi,%ebx
+  8039e3:	31 f6                	xor    %esi,%esi
+  8039e5:	8b 3c 24             	mov    (%esp),%edi
+  8039e8:	39 fb                	cmp    %edi,%ebx
+  8039ea:	89 f7                	mov    %esi,%edi
+  8039ec:	8b 1c 24             	mov    (%esp),%ebx
+  8039ef:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8039f3:	19 f7                	sbb    %esi,%edi
+  8039f5:	72 d2                	jb     8039c9 <udivmod+0x39>
+  8039f7:	89 f7                	mov    %esi,%edi
+  8039f9:	89 de                	mov    %ebx,%esi
+  8039fb:	89 e9                	mov    %ebp,%ecx
+  8039fd:	0f a5 f7             	shld   %cl,%esi,%edi
+  803a00:	d3 e6                	shl    %cl,%esi
+  803a02:	f6 c1 20             	test   $0x20,%cl
+  803a05:	74 04                	je     803a0b <udivmod+0x7b>
+  803a07:	89 f7                	mov    %esi,%edi
+  803a09:	31 f6                	xor    %esi,%esi
+  803a0b:	29 f0                	sub    %esi,%eax
+  803a0d:	19 fa                	sbb    %edi,%edx
+  803a0f:	be 01 00 00 00       	mov    $0x1,%esi
+  803a14:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a19:	0f a5 f7             	shld   %cl,%esi,%edi
+  803a1c:	d3 e6                	shl    %cl,%esi
+  803a1e:	f6 c1 20             	test   $0x20,%cl
+  803a21:	74 04                	je     803a27 <udivmod+0x97>
+  803a23:	89 f7                	mov    %esi,%edi
+  803a25:	31 f6                	xor    %esi,%esi
+  803a27:	09 74 24 08          	or     %esi,0x8(%esp)
+  803a2b:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  803a2f:	eb 98                	jmp    8039c9 <udivmod+0x39>
+  803a31:	89 f0                	mov    %esi,%eax
+  803a33:	89 fa                	mov    %edi,%edx
+  803a35:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803a39:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  803a3d:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  803a41:	89 01                	mov    %eax,(%ecx)
+  803a43:	89 51 04             	mov    %edx,0x4(%ecx)
+  803a46:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803a4a:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803a4e:	83 c4 14             	add    $0x14,%esp
+  803a51:	5b                   	pop    %ebx
+  803a52:	5e                   	pop    %esi
+  803a53:	5f                   	pop    %edi
+  803a54:	5d                   	pop    %ebp
+  803a55:	c3                   	ret
+
+00803a56 <__udivdi3>:
+  803a56:	83 ec 18             	sub    $0x18,%esp
+  803a59:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803a5d:	50                   	push   %eax
+  803a5e:	ff 74 24 2c          	push   0x2c(%esp)
+  803a62:	ff 74 24 2c          	push   0x2c(%esp)
+  803a66:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803a6a:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803a6e:	e8 1d ff ff ff       	call   803990 <udivmod>
+  803a73:	83 c4 24             	add    $0x24,%esp
+  803a76:	c3                   	ret
+
+00803a77 <__umoddi3>:
+  803a77:	83 ec 18             	sub    $0x18,%esp
+  803a7a:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803a7e:	50                   	push   %eax
+  803a7f:	ff 74 24 2c          	push   0x2c(%esp)
+  803a83:	ff 74 24 2c          	push   0x2c(%esp)
+  803a87:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803a8b:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803a8f:	e8 fc fe ff ff       	call   803990 <udivmod>
+  803a94:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803a98:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803a9c:	83 c4 24             	add    $0x24,%esp
+  803a9f:	c3                   	ret
+
+00803aa0 <__divdi3>:
+  803aa0:	56                   	push   %esi
+  803aa1:	53                   	push   %ebx
+  803aa2:	83 ec 14             	sub    $0x14,%esp
+  803aa5:	8b 44 24 20          	mov    0x20(%esp),%eax
+  803aa9:	8b 54 24 24          	mov    0x24(%esp),%edx
+  803aad:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  803ab1:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  803ab5:	85 d2                	test   %edx,%edx
+  803ab7:	78 18                	js     803ad1 <__divdi3+0x31>
+  803ab9:	85 db                	test   %ebx,%ebx
+  803abb:	78 3e                	js     803afb <__divdi3+0x5b>
+  803abd:	83 ec 04             	sub    $0x4,%esp
+  803ac0:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803ac4:	56                   	push   %esi
+  803ac5:	53                   	push   %ebx
+  803ac6:	51                   	push   %ecx
+  803ac7:	e8 c4 fe ff ff       	call   803990 <udivmod>
+  803acc:	83 c4 10             	add    $0x10,%esp
+  803acf:	eb 24                	jmp    803af5 <__divdi3+0x55>
+  803ad1:	f7 d8                	neg    %eax
+  803ad3:	83 d2 00             	adc    $0x0,%edx
+  803ad6:	f7 da                	neg    %edx
+  803ad8:	85 db                	test   %ebx,%ebx
+  803ada:	78 3a                	js     803b16 <__divdi3+0x76>
+  803adc:	83 ec 04             	sub    $0x4,%esp
+  803adf:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803ae3:	56                   	push   %esi
+  803ae4:	53                   	push   %ebx
+  803ae5:	51                   	push   %ecx
+  803ae6:	e8 a5 fe ff ff       	call   803990 <udivmod>
+  803aeb:	83 c4 10             	add    $0x10,%esp
+  803aee:	f7 d8                	neg    %eax
+  803af0:	83 d2 00             	adc    $0x0,%edx
+  803af3:	f7 da                	neg    %edx
+  803af5:	83 c4 14             	add    $0x14,%esp
+  803af8:	5b                   	pop    %ebx
+  803af9:	5e                   	pop    %esi
+  803afa:	c3                   	ret
+  803afb:	83 ec 04             	sub    $0x4,%esp
+  803afe:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803b02:	56                   	push   %esi
+  803b03:	f7 d9                	neg    %ecx
+  803b05:	83 d3 00             	adc    $0x0,%ebx
+  803b08:	f7 db                	neg    %ebx
+  803b0a:	53                   	push   %ebx
+  803b0b:	51                   	push   %ecx
+  803b0c:	e8 7f fe ff ff       	call   803990 <udivmod>
+  803b11:	83 c4 10             	add    $0x10,%esp
+  803b14:	eb d8                	jmp    803aee <__divdi3+0x4e>
+  803b16:	83 ec 04             	sub    $0x4,%esp
+  803b19:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803b1d:	56                   	push   %esi
+  803b1e:	f7 d9                	neg    %ecx
+  803b20:	83 d3 00             	adc    $0x0,%ebx
+  803b23:	f7 db                	neg    %ebx
+  803b25:	53                   	push   %ebx
+  803b26:	51                   	push   %ecx
+  803b27:	e8 64 fe ff ff       	call   803990 <udivmod>
+  803b2c:	83 c4 10             	add    $0x10,%esp
+  803b2f:	eb c4                	jmp    803af5 <__divdi3+0x55>
+
+00803b31 <__moddi3>:
+  803b31:	55                   	push   %ebp
+  803b32:	57                   	push   %edi
+  803b33:	56                   	push   %esi
+  803b34:	53                   	push   %ebx
+  803b35:	83 ec 24             	sub    $0x24,%esp
+  803b38:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803b3c:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803b40:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  803b44:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  803b48:	85 d2                	test   %edx,%edx
+  803b4a:	78 3b                	js     803b87 <__moddi3+0x56>
+  803b4c:	83 ec 04             	sub    $0x4,%esp
+  803b4f:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803b53:	56                   	push   %esi
+  803b54:	89 ce                	mov    %ecx,%esi
+  803b56:	f7 de                	neg    %esi
+  803b58:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803b5c:	89 de                	mov    %ebx,%esi
+  803b5e:	83 d6 00             	adc    $0x0,%esi
+  803b61:	f7 de                	neg    %esi
+  803b63:	89 74 24 14          	mov    %esi,0x14(%esp)
+  803b67:	8b 74 24 08          	mov    0x8(%esp),%esi
+  803b6b:	0f 48 f1             	cmovs  %ecx,%esi
+  803b6e:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  803b73:	53                   	push   %ebx
+  803b74:	56                   	push   %esi
+  803b75:	e8 16 fe ff ff       	call   803990 <udivmod>
+  803b7a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803b7e:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803b82:	83 c4 10             	add    $0x10,%esp
+  803b85:	eb 47                	jmp    803bce <__moddi3+0x9d>
+  803b87:	f7 d8                	neg    %eax
+  803b89:	83 d2 00             	adc    $0x0,%edx
+  803b8c:	f7 da                	neg    %edx
+  803b8e:	83 ec 04             	sub    $0x4,%esp
+  803b91:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803b95:	56                   	push   %esi
+  803b96:	89 cf                	mov    %ecx,%edi
+  803b98:	f7 df                	neg    %edi
+  803b9a:	89 de                	mov    %ebx,%esi
+  803b9c:	83 d6 00             	adc    $0x0,%esi
+  803b9f:	f7 de                	neg    %esi
+  803ba1:	0f 49 cf             	cmovns %edi,%ecx
+  803ba4:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  803ba8:	0f 49 de             	cmovns %esi,%ebx
+  803bab:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  803baf:	ff 74 24 0c          	push   0xc(%esp)
+  803bb3:	ff 74 24 0c          	push   0xc(%esp)
+  803bb7:	e8 d4 fd ff ff       	call   803990 <udivmod>
+  803bbc:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803bc0:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803bc4:	f7 d8                	neg    %eax
+  803bc6:	83 d2 00             	adc    $0x0,%edx
+  803bc9:	f7 da                	neg    %edx
+  803bcb:	83 c4 10             	add    $0x10,%esp
+  803bce:	83 c4 24             	add    $0x24,%esp
+  803bd1:	5b                   	pop    %ebx
+  803bd2:	5e                   	pop    %esi
+  803bd3:	5f                   	pop    %edi
+  803bd4:	5d                   	pop    %ebp
+  803bd5:	c3                   	ret
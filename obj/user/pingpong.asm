@@ -0,0 +1,7756 @@
+
+obj/user/pingpong.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 8f 00 00 00       	call   8000c0 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 1c             	sub    $0x1c,%esp
+  envid_t who;
+
+  if ((who = fork()) != 0) {
+  80003c:	e8 0b 12 00 00       	call   80124c <fork>
+  800041:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800044:	85 c0                	test   %eax,%eax
+  800046:	75 4f                	jne    800097 <umain+0x64>
+    cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+    ipc_send(who, 0, 0, 0);
+  }
+
+  while (1) {
+    uint32_t i = ipc_recv(&who, 0, 0);
+  800048:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  80004b:	83 ec 04             	sub    $0x4,%esp
+  80004e:	6a 00                	push   $0x0
+  800050:	6a 00                	push   $0x0
+  800052:	56                   	push   %esi
+  800053:	e8 ed 14 00 00       	call   801545 <ipc_recv>
+  800058:	89 c3                	mov    %eax,%ebx
+    cprintf("%x got %d from %x\n", sys_getenvid(), i, who);
+  80005a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80005d:	e8 fc 0a 00 00       	call   800b5e <sys_getenvid>
+  800062:	57                   	push   %edi
+  800063:	53                   	push   %ebx
+  800064:	50                   	push   %eax
+  800065:	68 96 39 80 00       	push   $0x803996
+  80006a:	e8 53 01 00 00       	call   8001c2 <cprintf>
+    if (i == 10)
+  80006f:	83 c4 20             	add    $0x20,%esp
+  800072:	83 fb 0a             	cmp    $0xa,%ebx
+  800075:	74 18                	je     80008f <umain+0x5c>
+      return;
+    i++;
+  800077:	83 c3 01             	add    $0x1,%ebx
+    ipc_send(who, i, 0, 0);
+  80007a:	6a 00                	push   $0x0
+  80007c:	6a 00                	push   $0x0
+  80007e:	53                   	push   %ebx
+  80007f:	ff 75 e4             	push   -0x1c(%ebp)
+  800082:	e8 41 15 00 00       	call   8015c8 <ipc_send>
+    if (i == 10)
+  800087:	83 c4 10             	add    $0x10,%esp
+  80008a:	83 fb 0a             	cmp    $0xa,%ebx
+  80008d:	75 bc                	jne    80004b <umain+0x18>
+      return;
+  }
+}
+  80008f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800092:	5b                   	pop    %ebx
+  800093:	5e                   	pop    %esi
+  800094:	5f                   	pop    %edi
+  800095:	5d                   	pop    %ebp
+  800096:	c3                   	ret
+  800097:	89 c3                	mov    %eax,%ebx
+    cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+  800099:	e8 c0 0a 00 00       	call   800b5e <sys_getenvid>
+  80009e:	83 ec 04             	sub    $0x4,%esp
+  8000a1:	53                   	push   %ebx
+  8000a2:	50                   	push   %eax
+  8000a3:	68 80 39 80 00       	push   $0x803980
+  8000a8:	e8 15 01 00 00       	call   8001c2 <cprintf>
+    ipc_send(who, 0, 0, 0);
+  8000ad:	6a 00                	push   $0x0
+  8000af:	6a 00                	push   $0x0
+  8000b1:	6a 00                	push   $0x0
+  8000b3:	ff 75 e4             	push   -0x1c(%ebp)
+  8000b6:	e8 0d 15 00 00       	call   8015c8 <ipc_send>
+  8000bb:	83 c4 20             	add    $0x20,%esp
+  8000be:	eb 88                	jmp    800048 <umain+0x15>
+
+008000c0 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000c0:	55                   	push   %ebp
+  8000c1:	89 e5                	mov    %esp,%ebp
+  8000c3:	56                   	push   %esi
+  8000c4:	53                   	push   %ebx
+  8000c5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000c8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  8000cb:	c7 05 a0 58 80 00 00 	movl   $0x0,0x8058a0
+  8000d2:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  8000d5:	e8 84 0a 00 00       	call   800b5e <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  8000da:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000df:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8000e2:	c1 e0 04             	shl    $0x4,%eax
+  8000e5:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000ea:	a3 a0 58 80 00       	mov    %eax,0x8058a0
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8000ef:	85 db                	test   %ebx,%ebx
+  8000f1:	7e 07                	jle    8000fa <libmain+0x3a>
+    binaryname = argv[0];
+  8000f3:	8b 06                	mov    (%esi),%eax
+  8000f5:	a3 00 40 80 00       	mov    %eax,0x804000
+
+  // call user main routine
+  umain(argc, argv);
+  8000fa:	83 ec 08             	sub    $0x8,%esp
+  8000fd:	56                   	push   %esi
+  8000fe:	53                   	push   %ebx
+  8000ff:	e8 2f ff ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  800104:	e8 0a 00 00 00       	call   800113 <exit>
+}
+  800109:	83 c4 10             	add    $0x10,%esp
+  80010c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80010f:	5b                   	pop    %ebx
+  800110:	5e                   	pop    %esi
+  800111:	5d                   	pop    %ebp
+  800112:	c3                   	ret
+
+00800113 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800113:	55                   	push   %ebp
+  800114:	89 e5                	mov    %esp,%ebp
+  800116:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  800119:	e8 d1 16 00 00       	call   8017ef <close_all>
+  sys_env_destroy(0);
+  80011e:	83 ec 0c             	sub    $0xc,%esp
+  800121:	6a 00                	push   $0x0
+  800123:	e8 f5 09 00 00       	call   800b1d <sys_env_destroy>
+}
+  800128:	83 c4 10             	add    $0x10,%esp
+  80012b:	c9                   	leave
+  80012c:	c3                   	ret
+
+0080012d <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80012d:	55                   	push   %ebp
+  80012e:	89 e5                	mov    %esp,%ebp
+  800130:	53                   	push   %ebx
+  800131:	83 ec 04             	sub    $0x4,%esp
+  800134:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  800137:	8b 13                	mov    (%ebx),%edx
+  800139:	8d 42 01             	lea    0x1(%edx),%eax
+  80013c:	89 03                	mov    %eax,(%ebx)
+  80013e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800141:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  800145:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80014a:	74 09                	je     800155 <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  80014c:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800150:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800153:	c9                   	leave
+  800154:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  800155:	83 ec 08             	sub    $0x8,%esp
+  800158:	68 ff 00 00 00       	push   $0xff
+  80015d:	8d 43 08             	lea    0x8(%ebx),%eax
+  800160:	50                   	push   %eax
+  800161:	e8 7a 09 00 00       	call   800ae0 <sys_cputs>
+    b->idx = 0;
+  800166:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80016c:	83 c4 10             	add    $0x10,%esp
+  80016f:	eb db                	jmp    80014c <putch+0x1f>
+
+00800171 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800171:	55                   	push   %ebp
+  800172:	89 e5                	mov    %esp,%ebp
+  800174:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  80017a:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800181:	00 00 00 
+  b.cnt = 0;
+  800184:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80018b:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  80018e:	ff 75 0c             	push   0xc(%ebp)
+  800191:	ff 75 08             	push   0x8(%ebp)
+  800194:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80019a:	50                   	push   %eax
+  80019b:	68 2d 01 80 00       	push   $0x80012d
+  8001a0:	e8 14 01 00 00       	call   8002b9 <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  8001a5:	83 c4 08             	add    $0x8,%esp
+  8001a8:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001ae:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001b4:	50                   	push   %eax
+  8001b5:	e8 26 09 00 00       	call   800ae0 <sys_cputs>
+
+  return b.cnt;
+}
+  8001ba:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001c0:	c9                   	leave
+  8001c1:	c3                   	ret
+
+008001c2 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8001c2:	55                   	push   %ebp
+  8001c3:	89 e5                	mov    %esp,%ebp
+  8001c5:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  8001c8:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  8001cb:	50                   	push   %eax
+  8001cc:	ff 75 08             	push   0x8(%ebp)
+  8001cf:	e8 9d ff ff ff       	call   800171 <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  8001d4:	c9                   	leave
+  8001d5:	c3                   	ret
+
+008001d6 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  8001d6:	55                   	push   %ebp
+  8001d7:	89 e5                	mov    %esp,%ebp
+  8001d9:	57                   	push   %edi
+  8001da:	56                   	push   %esi
+  8001db:	53                   	push   %ebx
+  8001dc:	83 ec 1c             	sub    $0x1c,%esp
+  8001df:	89 c7                	mov    %eax,%edi
+  8001e1:	89 d6                	mov    %edx,%esi
+  8001e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001e6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8001e9:	89 d1                	mov    %edx,%ecx
+  8001eb:	89 c2                	mov    %eax,%edx
+  8001ed:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001f0:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001f3:	8b 45 10             	mov    0x10(%ebp),%eax
+  8001f6:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  8001f9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001fc:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800203:	39 c2                	cmp    %eax,%edx
+  800205:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800208:	72 3e                	jb     800248 <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  80020a:	83 ec 0c             	sub    $0xc,%esp
+  80020d:	ff 75 18             	push   0x18(%ebp)
+  800210:	83 eb 01             	sub    $0x1,%ebx
+  800213:	53                   	push   %ebx
+  800214:	50                   	push   %eax
+  800215:	83 ec 08             	sub    $0x8,%esp
+  800218:	ff 75 e4             	push   -0x1c(%ebp)
+  80021b:	ff 75 e0             	push   -0x20(%ebp)
+  80021e:	ff 75 dc             	push   -0x24(%ebp)
+  800221:	ff 75 d8             	push   -0x28(%ebp)
+  800224:	e8 d6 35 00 00       	call   8037ff <__udivdi3>
+  800229:	83 c4 18             	add    $0x18,%esp
+  80022c:	52                   	push   %edx
+  80022d:	50                   	push   %eax
+  80022e:	89 f2                	mov    %esi,%edx
+  800230:	89 f8                	mov    %edi,%eax
+  800232:	e8 9f ff ff ff       	call   8001d6 <printnum>
+  800237:	83 c4 20             	add    $0x20,%esp
+  80023a:	eb 13                	jmp    80024f <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  80023c:	83 ec 08             	sub    $0x8,%esp
+  80023f:	56                   	push   %esi
+  800240:	ff 75 18             	push   0x18(%ebp)
+  800243:	ff d7                	call   *%edi
+  800245:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  800248:	83 eb 01             	sub    $0x1,%ebx
+  80024b:	85 db                	test   %ebx,%ebx
+  80024d:	7f ed                	jg     80023c <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  80024f:	83 ec 08             	sub    $0x8,%esp
+  800252:	56                   	push   %esi
+  800253:	83 ec 04             	sub    $0x4,%esp
+  800256:	ff 75 e4             	push   -0x1c(%ebp)
+  800259:	ff 75 e0             	push   -0x20(%ebp)
+  80025c:	ff 75 dc             	push   -0x24(%ebp)
+  80025f:	ff 75 d8             	push   -0x28(%ebp)
+  800262:	e8 b9 35 00 00       	call   803820 <__umoddi3>
+  800267:	83 c4 14             	add    $0x14,%esp
+  80026a:	0f be 80 b3 39 80 00 	movsbl 0x8039b3(%eax),%eax
+  800271:	50                   	push   %eax
+  800272:	ff d7                	call   *%edi
+}
+  800274:	83 c4 10             	add    $0x10,%esp
+  800277:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80027a:	5b                   	pop    %ebx
+  80027b:	5e                   	pop    %esi
+  80027c:	5f                   	pop    %edi
+  80027d:	5d                   	pop    %ebp
+  80027e:	c3                   	ret
+
+0080027f <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80027f:	55                   	push   %ebp
+  800280:	89 e5                	mov    %esp,%ebp
+  800282:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  800285:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  800289:	8b 10                	mov    (%eax),%edx
+  80028b:	3b 50 04             	cmp    0x4(%eax),%edx
+  80028e:	73 0a                	jae    80029a <sprintputch+0x1b>
+    *b->buf++ = ch;
+  800290:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800293:	89 08                	mov    %ecx,(%eax)
+  800295:	8b 45 08             	mov    0x8(%ebp),%eax
+  800298:	88 02                	mov    %al,(%edx)
+}
+  80029a:	5d                   	pop    %ebp
+  80029b:	c3                   	ret
+
+0080029c <printfmt>:
+{
+  80029c:	55                   	push   %ebp
+  80029d:	89 e5                	mov    %esp,%ebp
+  80029f:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  8002a2:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  8002a5:	50                   	push   %eax
+  8002a6:	ff 75 10             	push   0x10(%ebp)
+  8002a9:	ff 75 0c             	push   0xc(%ebp)
+  8002ac:	ff 75 08             	push   0x8(%ebp)
+  8002af:	e8 05 00 00 00       	call   8002b9 <vprintfmt>
+}
+  8002b4:	83 c4 10             	add    $0x10,%esp
+  8002b7:	c9                   	leave
+  8002b8:	c3                   	ret
+
+008002b9 <vprintfmt>:
+{
+  8002b9:	55                   	push   %ebp
+  8002ba:	89 e5                	mov    %esp,%ebp
+  8002bc:	57                   	push   %edi
+  8002bd:	56                   	push   %esi
+  8002be:	53                   	push   %ebx
+  8002bf:	83 ec 2c             	sub    $0x2c,%esp
+  8002c2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8002c5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8002c8:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8002cb:	eb 0a                	jmp    8002d7 <vprintfmt+0x1e>
+      putch(ch, putdat);
+  8002cd:	83 ec 08             	sub    $0x8,%esp
+  8002d0:	53                   	push   %ebx
+  8002d1:	50                   	push   %eax
+  8002d2:	ff d6                	call   *%esi
+  8002d4:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  8002d7:	83 c7 01             	add    $0x1,%edi
+  8002da:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8002de:	83 f8 25             	cmp    $0x25,%eax
+  8002e1:	74 0c                	je     8002ef <vprintfmt+0x36>
+      if (ch == '\0')
+  8002e3:	85 c0                	test   %eax,%eax
+  8002e5:	75 e6                	jne    8002cd <vprintfmt+0x14>
+}
+  8002e7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002ea:	5b                   	pop    %ebx
+  8002eb:	5e                   	pop    %esi
+  8002ec:	5f                   	pop    %edi
+  8002ed:	5d                   	pop    %ebp
+  8002ee:	c3                   	ret
+    padc = ' ';
+  8002ef:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  8002f3:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  8002fa:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  800301:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  800308:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  80030d:	8d 47 01             	lea    0x1(%edi),%eax
+  800310:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800313:	0f b6 17             	movzbl (%edi),%edx
+  800316:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800319:	3c 55                	cmp    $0x55,%al
+  80031b:	0f 87 cf 03 00 00    	ja     8006f0 <vprintfmt+0x437>
+  800321:	0f b6 c0             	movzbl %al,%eax
+  800324:	ff 24 85 00 3b 80 00 	jmp    *0x803b00(,%eax,4)
+  80032b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  80032e:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800332:	eb d9                	jmp    80030d <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  800334:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800337:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80033b:	eb d0                	jmp    80030d <vprintfmt+0x54>
+  80033d:	0f b6 d2             	movzbl %dl,%edx
+  800340:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  800343:	b8 00 00 00 00       	mov    $0x0,%eax
+  800348:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  80034b:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80034e:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  800352:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  800355:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800358:	83 f9 09             	cmp    $0x9,%ecx
+  80035b:	77 55                	ja     8003b2 <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  80035d:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  800360:	eb e9                	jmp    80034b <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  800362:	8b 45 14             	mov    0x14(%ebp),%eax
+  800365:	8b 00                	mov    (%eax),%eax
+  800367:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80036a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80036d:	8d 40 04             	lea    0x4(%eax),%eax
+  800370:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  800373:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  800376:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80037a:	79 91                	jns    80030d <vprintfmt+0x54>
+        width = precision, precision = -1;
+  80037c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80037f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800382:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800389:	eb 82                	jmp    80030d <vprintfmt+0x54>
+      if (width < 0)
+  80038b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80038e:	85 d2                	test   %edx,%edx
+  800390:	b8 00 00 00 00       	mov    $0x0,%eax
+  800395:	0f 49 c2             	cmovns %edx,%eax
+  800398:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  80039b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  80039e:	e9 6a ff ff ff       	jmp    80030d <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  8003a3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  8003a6:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  8003ad:	e9 5b ff ff ff       	jmp    80030d <vprintfmt+0x54>
+  8003b2:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003b5:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003b8:	eb bc                	jmp    800376 <vprintfmt+0xbd>
+      lflag++;
+  8003ba:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  8003bd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  8003c0:	e9 48 ff ff ff       	jmp    80030d <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  8003c5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003c8:	8d 78 04             	lea    0x4(%eax),%edi
+  8003cb:	83 ec 08             	sub    $0x8,%esp
+  8003ce:	53                   	push   %ebx
+  8003cf:	ff 30                	push   (%eax)
+  8003d1:	ff d6                	call   *%esi
+      break;
+  8003d3:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  8003d6:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  8003d9:	e9 b1 02 00 00       	jmp    80068f <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  8003de:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003e1:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  8003e4:	8b 10                	mov    (%eax),%edx
+  8003e6:	89 d0                	mov    %edx,%eax
+  8003e8:	f7 d8                	neg    %eax
+  8003ea:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8003ed:	83 f8 10             	cmp    $0x10,%eax
+  8003f0:	7f 23                	jg     800415 <vprintfmt+0x15c>
+  8003f2:	8b 14 85 60 3c 80 00 	mov    0x803c60(,%eax,4),%edx
+  8003f9:	85 d2                	test   %edx,%edx
+  8003fb:	74 18                	je     800415 <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  8003fd:	52                   	push   %edx
+  8003fe:	68 8e 3e 80 00       	push   $0x803e8e
+  800403:	53                   	push   %ebx
+  800404:	56                   	push   %esi
+  800405:	e8 92 fe ff ff       	call   80029c <printfmt>
+  80040a:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  80040d:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800410:	e9 7a 02 00 00       	jmp    80068f <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  800415:	50                   	push   %eax
+  800416:	68 cb 39 80 00       	push   $0x8039cb
+  80041b:	53                   	push   %ebx
+  80041c:	56                   	push   %esi
+  80041d:	e8 7a fe ff ff       	call   80029c <printfmt>
+  800422:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  800425:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  800428:	e9 62 02 00 00       	jmp    80068f <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  80042d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800430:	83 c0 04             	add    $0x4,%eax
+  800433:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800436:	8b 45 14             	mov    0x14(%ebp),%eax
+  800439:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  80043b:	85 c9                	test   %ecx,%ecx
+  80043d:	b8 c4 39 80 00       	mov    $0x8039c4,%eax
+  800442:	0f 45 c1             	cmovne %ecx,%eax
+  800445:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  800448:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80044c:	7e 06                	jle    800454 <vprintfmt+0x19b>
+  80044e:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800452:	75 0b                	jne    80045f <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800454:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800457:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80045a:	89 75 08             	mov    %esi,0x8(%ebp)
+  80045d:	eb 5c                	jmp    8004bb <vprintfmt+0x202>
+  80045f:	83 ec 08             	sub    $0x8,%esp
+  800462:	ff 75 d0             	push   -0x30(%ebp)
+  800465:	ff 75 cc             	push   -0x34(%ebp)
+  800468:	e8 20 03 00 00       	call   80078d <strnlen>
+  80046d:	89 c2                	mov    %eax,%edx
+  80046f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800472:	29 d0                	sub    %edx,%eax
+  800474:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  800477:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80047b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80047e:	89 75 08             	mov    %esi,0x8(%ebp)
+  800481:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800483:	eb 0e                	jmp    800493 <vprintfmt+0x1da>
+          putch(padc, putdat);
+  800485:	83 ec 08             	sub    $0x8,%esp
+  800488:	53                   	push   %ebx
+  800489:	57                   	push   %edi
+  80048a:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  80048d:	83 ee 01             	sub    $0x1,%esi
+  800490:	83 c4 10             	add    $0x10,%esp
+  800493:	85 f6                	test   %esi,%esi
+  800495:	7f ee                	jg     800485 <vprintfmt+0x1cc>
+  800497:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80049a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80049d:	85 c0                	test   %eax,%eax
+  80049f:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004a4:	0f 49 d0             	cmovns %eax,%edx
+  8004a7:	29 d0                	sub    %edx,%eax
+  8004a9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004ac:	eb a6                	jmp    800454 <vprintfmt+0x19b>
+          putch(ch, putdat);
+  8004ae:	83 ec 08             	sub    $0x8,%esp
+  8004b1:	53                   	push   %ebx
+  8004b2:	52                   	push   %edx
+  8004b3:	ff 55 08             	call   *0x8(%ebp)
+  8004b6:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8004b9:	89 f1                	mov    %esi,%ecx
+  8004bb:	8d 71 01             	lea    0x1(%ecx),%esi
+  8004be:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004c2:	0f be d0             	movsbl %al,%edx
+  8004c5:	85 d2                	test   %edx,%edx
+  8004c7:	74 28                	je     8004f1 <vprintfmt+0x238>
+  8004c9:	85 ff                	test   %edi,%edi
+  8004cb:	78 05                	js     8004d2 <vprintfmt+0x219>
+  8004cd:	83 ef 01             	sub    $0x1,%edi
+  8004d0:	78 30                	js     800502 <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  8004d2:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8004d6:	74 d6                	je     8004ae <vprintfmt+0x1f5>
+  8004d8:	0f be c0             	movsbl %al,%eax
+  8004db:	83 e8 20             	sub    $0x20,%eax
+  8004de:	83 f8 5e             	cmp    $0x5e,%eax
+  8004e1:	76 cb                	jbe    8004ae <vprintfmt+0x1f5>
+          putch('?', putdat);
+  8004e3:	83 ec 08             	sub    $0x8,%esp
+  8004e6:	53                   	push   %ebx
+  8004e7:	6a 3f                	push   $0x3f
+  8004e9:	ff 55 08             	call   *0x8(%ebp)
+  8004ec:	83 c4 10             	add    $0x10,%esp
+  8004ef:	eb c8                	jmp    8004b9 <vprintfmt+0x200>
+  8004f1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004f4:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8004f7:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004fa:	01 d0                	add    %edx,%eax
+  8004fc:	29 c8                	sub    %ecx,%eax
+  8004fe:	89 c7                	mov    %eax,%edi
+  800500:	eb 13                	jmp    800515 <vprintfmt+0x25c>
+  800502:	8b 75 08             	mov    0x8(%ebp),%esi
+  800505:	eb ed                	jmp    8004f4 <vprintfmt+0x23b>
+        putch(' ', putdat);
+  800507:	83 ec 08             	sub    $0x8,%esp
+  80050a:	53                   	push   %ebx
+  80050b:	6a 20                	push   $0x20
+  80050d:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  80050f:	83 ef 01             	sub    $0x1,%edi
+  800512:	83 c4 10             	add    $0x10,%esp
+  800515:	85 ff                	test   %edi,%edi
+  800517:	7f ee                	jg     800507 <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  800519:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80051c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80051f:	e9 6b 01 00 00       	jmp    80068f <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  800524:	83 f9 01             	cmp    $0x1,%ecx
+  800527:	7f 1f                	jg     800548 <vprintfmt+0x28f>
+  else if (lflag)
+  800529:	85 c9                	test   %ecx,%ecx
+  80052b:	74 67                	je     800594 <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  80052d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800530:	8b 00                	mov    (%eax),%eax
+  800532:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800535:	89 c1                	mov    %eax,%ecx
+  800537:	c1 f9 1f             	sar    $0x1f,%ecx
+  80053a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80053d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800540:	8d 40 04             	lea    0x4(%eax),%eax
+  800543:	89 45 14             	mov    %eax,0x14(%ebp)
+  800546:	eb 17                	jmp    80055f <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  800548:	8b 45 14             	mov    0x14(%ebp),%eax
+  80054b:	8b 50 04             	mov    0x4(%eax),%edx
+  80054e:	8b 00                	mov    (%eax),%eax
+  800550:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800553:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800556:	8b 45 14             	mov    0x14(%ebp),%eax
+  800559:	8d 40 08             	lea    0x8(%eax),%eax
+  80055c:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  80055f:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800562:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  800565:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  80056a:	85 c9                	test   %ecx,%ecx
+  80056c:	0f 89 03 01 00 00    	jns    800675 <vprintfmt+0x3bc>
+        putch('-', putdat);
+  800572:	83 ec 08             	sub    $0x8,%esp
+  800575:	53                   	push   %ebx
+  800576:	6a 2d                	push   $0x2d
+  800578:	ff d6                	call   *%esi
+        num = -(long long)num;
+  80057a:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80057d:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800580:	f7 da                	neg    %edx
+  800582:	83 d1 00             	adc    $0x0,%ecx
+  800585:	f7 d9                	neg    %ecx
+  800587:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  80058a:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80058f:	e9 e1 00 00 00       	jmp    800675 <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  800594:	8b 45 14             	mov    0x14(%ebp),%eax
+  800597:	8b 00                	mov    (%eax),%eax
+  800599:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80059c:	89 c1                	mov    %eax,%ecx
+  80059e:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005a1:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005a4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a7:	8d 40 04             	lea    0x4(%eax),%eax
+  8005aa:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005ad:	eb b0                	jmp    80055f <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  8005af:	83 f9 01             	cmp    $0x1,%ecx
+  8005b2:	7f 1e                	jg     8005d2 <vprintfmt+0x319>
+  else if (lflag)
+  8005b4:	85 c9                	test   %ecx,%ecx
+  8005b6:	74 32                	je     8005ea <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  8005b8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005bb:	8b 10                	mov    (%eax),%edx
+  8005bd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005c2:	8d 40 04             	lea    0x4(%eax),%eax
+  8005c5:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  8005c8:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  8005cd:	e9 a3 00 00 00       	jmp    800675 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  8005d2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d5:	8b 10                	mov    (%eax),%edx
+  8005d7:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005da:	8d 40 08             	lea    0x8(%eax),%eax
+  8005dd:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  8005e0:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  8005e5:	e9 8b 00 00 00       	jmp    800675 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8005ea:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ed:	8b 10                	mov    (%eax),%edx
+  8005ef:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005f4:	8d 40 04             	lea    0x4(%eax),%eax
+  8005f7:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  8005fa:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  8005ff:	eb 74                	jmp    800675 <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  800601:	83 f9 01             	cmp    $0x1,%ecx
+  800604:	7f 1b                	jg     800621 <vprintfmt+0x368>
+  else if (lflag)
+  800606:	85 c9                	test   %ecx,%ecx
+  800608:	74 2c                	je     800636 <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  80060a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060d:	8b 10                	mov    (%eax),%edx
+  80060f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800614:	8d 40 04             	lea    0x4(%eax),%eax
+  800617:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  80061a:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  80061f:	eb 54                	jmp    800675 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800621:	8b 45 14             	mov    0x14(%ebp),%eax
+  800624:	8b 10                	mov    (%eax),%edx
+  800626:	8b 48 04             	mov    0x4(%eax),%ecx
+  800629:	8d 40 08             	lea    0x8(%eax),%eax
+  80062c:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  80062f:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  800634:	eb 3f                	jmp    800675 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800636:	8b 45 14             	mov    0x14(%ebp),%eax
+  800639:	8b 10                	mov    (%eax),%edx
+  80063b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800640:	8d 40 04             	lea    0x4(%eax),%eax
+  800643:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800646:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  80064b:	eb 28                	jmp    800675 <vprintfmt+0x3bc>
+      putch('0', putdat);
+  80064d:	83 ec 08             	sub    $0x8,%esp
+  800650:	53                   	push   %ebx
+  800651:	6a 30                	push   $0x30
+  800653:	ff d6                	call   *%esi
+      putch('x', putdat);
+  800655:	83 c4 08             	add    $0x8,%esp
+  800658:	53                   	push   %ebx
+  800659:	6a 78                	push   $0x78
+  80065b:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  80065d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800660:	8b 10                	mov    (%eax),%edx
+  800662:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  800667:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  80066a:	8d 40 04             	lea    0x4(%eax),%eax
+  80066d:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800670:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  800675:	83 ec 0c             	sub    $0xc,%esp
+  800678:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80067c:	50                   	push   %eax
+  80067d:	ff 75 e0             	push   -0x20(%ebp)
+  800680:	57                   	push   %edi
+  800681:	51                   	push   %ecx
+  800682:	52                   	push   %edx
+  800683:	89 da                	mov    %ebx,%edx
+  800685:	89 f0                	mov    %esi,%eax
+  800687:	e8 4a fb ff ff       	call   8001d6 <printnum>
+      break;
+  80068c:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  80068f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  800692:	e9 40 fc ff ff       	jmp    8002d7 <vprintfmt+0x1e>
+  if (lflag >= 2)
+  800697:	83 f9 01             	cmp    $0x1,%ecx
+  80069a:	7f 1b                	jg     8006b7 <vprintfmt+0x3fe>
+  else if (lflag)
+  80069c:	85 c9                	test   %ecx,%ecx
+  80069e:	74 2c                	je     8006cc <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  8006a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a3:	8b 10                	mov    (%eax),%edx
+  8006a5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006aa:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ad:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8006b0:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  8006b5:	eb be                	jmp    800675 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  8006b7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ba:	8b 10                	mov    (%eax),%edx
+  8006bc:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006bf:	8d 40 08             	lea    0x8(%eax),%eax
+  8006c2:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8006c5:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  8006ca:	eb a9                	jmp    800675 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8006cc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006cf:	8b 10                	mov    (%eax),%edx
+  8006d1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006d6:	8d 40 04             	lea    0x4(%eax),%eax
+  8006d9:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8006dc:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  8006e1:	eb 92                	jmp    800675 <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  8006e3:	83 ec 08             	sub    $0x8,%esp
+  8006e6:	53                   	push   %ebx
+  8006e7:	6a 25                	push   $0x25
+  8006e9:	ff d6                	call   *%esi
+      break;
+  8006eb:	83 c4 10             	add    $0x10,%esp
+  8006ee:	eb 9f                	jmp    80068f <vprintfmt+0x3d6>
+      putch('%', putdat);
+  8006f0:	83 ec 08             	sub    $0x8,%esp
+  8006f3:	53                   	push   %ebx
+  8006f4:	6a 25                	push   $0x25
+  8006f6:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  8006f8:	83 c4 10             	add    $0x10,%esp
+  8006fb:	89 f8                	mov    %edi,%eax
+  8006fd:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800701:	74 05                	je     800708 <vprintfmt+0x44f>
+  800703:	83 e8 01             	sub    $0x1,%eax
+  800706:	eb f5                	jmp    8006fd <vprintfmt+0x444>
+  800708:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80070b:	eb 82                	jmp    80068f <vprintfmt+0x3d6>
+
+0080070d <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80070d:	55                   	push   %ebp
+  80070e:	89 e5                	mov    %esp,%ebp
+  800710:	83 ec 18             	sub    $0x18,%esp
+  800713:	8b 45 08             	mov    0x8(%ebp),%eax
+  800716:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  800719:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80071c:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800720:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800723:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  80072a:	85 c0                	test   %eax,%eax
+  80072c:	74 26                	je     800754 <vsnprintf+0x47>
+  80072e:	85 d2                	test   %edx,%edx
+  800730:	7e 22                	jle    800754 <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800732:	ff 75 14             	push   0x14(%ebp)
+  800735:	ff 75 10             	push   0x10(%ebp)
+  800738:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80073b:	50                   	push   %eax
+  80073c:	68 7f 02 80 00       	push   $0x80027f
+  800741:	e8 73 fb ff ff       	call   8002b9 <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800746:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800749:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  80074c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80074f:	83 c4 10             	add    $0x10,%esp
+}
+  800752:	c9                   	leave
+  800753:	c3                   	ret
+    return -E_INVAL;
+  800754:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800759:	eb f7                	jmp    800752 <vsnprintf+0x45>
+
+0080075b <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80075b:	55                   	push   %ebp
+  80075c:	89 e5                	mov    %esp,%ebp
+  80075e:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  800761:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  800764:	50                   	push   %eax
+  800765:	ff 75 10             	push   0x10(%ebp)
+  800768:	ff 75 0c             	push   0xc(%ebp)
+  80076b:	ff 75 08             	push   0x8(%ebp)
+  80076e:	e8 9a ff ff ff       	call   80070d <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  800773:	c9                   	leave
+  800774:	c3                   	ret
+
+00800775 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800775:	55                   	push   %ebp
+  800776:	89 e5                	mov    %esp,%ebp
+  800778:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  80077b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800780:	eb 03                	jmp    800785 <strlen+0x10>
+    n++;
+  800782:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  800785:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800789:	75 f7                	jne    800782 <strlen+0xd>
+  return n;
+}
+  80078b:	5d                   	pop    %ebp
+  80078c:	c3                   	ret
+
+0080078d <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80078d:	55                   	push   %ebp
+  80078e:	89 e5                	mov    %esp,%ebp
+  800790:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800793:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800796:	b8 00 00 00 00       	mov    $0x0,%eax
+  80079b:	eb 03                	jmp    8007a0 <strnlen+0x13>
+    n++;
+  80079d:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007a0:	39 d0                	cmp    %edx,%eax
+  8007a2:	74 08                	je     8007ac <strnlen+0x1f>
+  8007a4:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8007a8:	75 f3                	jne    80079d <strnlen+0x10>
+  8007aa:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  8007ac:	89 d0                	mov    %edx,%eax
+  8007ae:	5d                   	pop    %ebp
+  8007af:	c3                   	ret
+
+008007b0 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8007b0:	55                   	push   %ebp
+  8007b1:	89 e5                	mov    %esp,%ebp
+  8007b3:	53                   	push   %ebx
+  8007b4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007b7:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  8007ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007bf:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8007c3:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8007c6:	83 c0 01             	add    $0x1,%eax
+  8007c9:	84 d2                	test   %dl,%dl
+  8007cb:	75 f2                	jne    8007bf <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  8007cd:	89 c8                	mov    %ecx,%eax
+  8007cf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007d2:	c9                   	leave
+  8007d3:	c3                   	ret
+
+008007d4 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8007d4:	55                   	push   %ebp
+  8007d5:	89 e5                	mov    %esp,%ebp
+  8007d7:	53                   	push   %ebx
+  8007d8:	83 ec 10             	sub    $0x10,%esp
+  8007db:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  8007de:	53                   	push   %ebx
+  8007df:	e8 91 ff ff ff       	call   800775 <strlen>
+  8007e4:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  8007e7:	ff 75 0c             	push   0xc(%ebp)
+  8007ea:	01 d8                	add    %ebx,%eax
+  8007ec:	50                   	push   %eax
+  8007ed:	e8 be ff ff ff       	call   8007b0 <strcpy>
+  return dst;
+}
+  8007f2:	89 d8                	mov    %ebx,%eax
+  8007f4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007f7:	c9                   	leave
+  8007f8:	c3                   	ret
+
+008007f9 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  8007f9:	55                   	push   %ebp
+  8007fa:	89 e5                	mov    %esp,%ebp
+  8007fc:	56                   	push   %esi
+  8007fd:	53                   	push   %ebx
+  8007fe:	8b 75 08             	mov    0x8(%ebp),%esi
+  800801:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  800804:	89 f3                	mov    %esi,%ebx
+  800806:	03 5d 10             	add    0x10(%ebp),%ebx
+  800809:	89 f0                	mov    %esi,%eax
+  80080b:	eb 0f                	jmp    80081c <strncpy+0x23>
+    *dst++ = *src;
+  80080d:	83 c0 01             	add    $0x1,%eax
+  800810:	0f b6 0a             	movzbl (%edx),%ecx
+  800813:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  800816:	80 f9 01             	cmp    $0x1,%cl
+  800819:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  80081c:	39 d8                	cmp    %ebx,%eax
+  80081e:	75 ed                	jne    80080d <strncpy+0x14>
+  }
+  return ret;
+}
+  800820:	89 f0                	mov    %esi,%eax
+  800822:	5b                   	pop    %ebx
+  800823:	5e                   	pop    %esi
+  800824:	5d                   	pop    %ebp
+  800825:	c3                   	ret
+
+00800826 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800826:	55                   	push   %ebp
+  800827:	89 e5                	mov    %esp,%ebp
+  800829:	56                   	push   %esi
+  80082a:	53                   	push   %ebx
+  80082b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80082e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800831:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  800834:	89 f0                	mov    %esi,%eax
+  800836:	85 d2                	test   %edx,%edx
+  800838:	74 21                	je     80085b <strlcpy+0x35>
+  80083a:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80083e:	89 f2                	mov    %esi,%edx
+  800840:	eb 09                	jmp    80084b <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  800842:	83 c1 01             	add    $0x1,%ecx
+  800845:	83 c2 01             	add    $0x1,%edx
+  800848:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  80084b:	39 c2                	cmp    %eax,%edx
+  80084d:	74 09                	je     800858 <strlcpy+0x32>
+  80084f:	0f b6 19             	movzbl (%ecx),%ebx
+  800852:	84 db                	test   %bl,%bl
+  800854:	75 ec                	jne    800842 <strlcpy+0x1c>
+  800856:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  800858:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  80085b:	29 f0                	sub    %esi,%eax
+}
+  80085d:	5b                   	pop    %ebx
+  80085e:	5e                   	pop    %esi
+  80085f:	5d                   	pop    %ebp
+  800860:	c3                   	ret
+
+00800861 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800861:	55                   	push   %ebp
+  800862:	89 e5                	mov    %esp,%ebp
+  800864:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800867:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  80086a:	eb 06                	jmp    800872 <strcmp+0x11>
+    p++, q++;
+  80086c:	83 c1 01             	add    $0x1,%ecx
+  80086f:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  800872:	0f b6 01             	movzbl (%ecx),%eax
+  800875:	84 c0                	test   %al,%al
+  800877:	74 04                	je     80087d <strcmp+0x1c>
+  800879:	3a 02                	cmp    (%edx),%al
+  80087b:	74 ef                	je     80086c <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  80087d:	0f b6 c0             	movzbl %al,%eax
+  800880:	0f b6 12             	movzbl (%edx),%edx
+  800883:	29 d0                	sub    %edx,%eax
+}
+  800885:	5d                   	pop    %ebp
+  800886:	c3                   	ret
+
+00800887 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800887:	55                   	push   %ebp
+  800888:	89 e5                	mov    %esp,%ebp
+  80088a:	53                   	push   %ebx
+  80088b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80088e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800891:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  800894:	eb 09                	jmp    80089f <strncmp+0x18>
+    n--, p++, q++;
+  800896:	83 ea 01             	sub    $0x1,%edx
+  800899:	83 c0 01             	add    $0x1,%eax
+  80089c:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  80089f:	85 d2                	test   %edx,%edx
+  8008a1:	74 18                	je     8008bb <strncmp+0x34>
+  8008a3:	0f b6 18             	movzbl (%eax),%ebx
+  8008a6:	84 db                	test   %bl,%bl
+  8008a8:	74 04                	je     8008ae <strncmp+0x27>
+  8008aa:	3a 19                	cmp    (%ecx),%bl
+  8008ac:	74 e8                	je     800896 <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8008ae:	0f b6 00             	movzbl (%eax),%eax
+  8008b1:	0f b6 11             	movzbl (%ecx),%edx
+  8008b4:	29 d0                	sub    %edx,%eax
+}
+  8008b6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008b9:	c9                   	leave
+  8008ba:	c3                   	ret
+    return 0;
+  8008bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008c0:	eb f4                	jmp    8008b6 <strncmp+0x2f>
+
+008008c2 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8008c2:	55                   	push   %ebp
+  8008c3:	89 e5                	mov    %esp,%ebp
+  8008c5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008c8:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  8008cc:	eb 03                	jmp    8008d1 <strchr+0xf>
+  8008ce:	83 c0 01             	add    $0x1,%eax
+  8008d1:	0f b6 10             	movzbl (%eax),%edx
+  8008d4:	84 d2                	test   %dl,%dl
+  8008d6:	74 06                	je     8008de <strchr+0x1c>
+    if (*s == c)
+  8008d8:	38 ca                	cmp    %cl,%dl
+  8008da:	75 f2                	jne    8008ce <strchr+0xc>
+  8008dc:	eb 05                	jmp    8008e3 <strchr+0x21>
+      return (char*)s;
+  return 0;
+  8008de:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008e3:	5d                   	pop    %ebp
+  8008e4:	c3                   	ret
+
+008008e5 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8008e5:	55                   	push   %ebp
+  8008e6:	89 e5                	mov    %esp,%ebp
+  8008e8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008eb:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  8008ef:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  8008f2:	38 ca                	cmp    %cl,%dl
+  8008f4:	74 09                	je     8008ff <strfind+0x1a>
+  8008f6:	84 d2                	test   %dl,%dl
+  8008f8:	74 05                	je     8008ff <strfind+0x1a>
+  for (; *s; s++)
+  8008fa:	83 c0 01             	add    $0x1,%eax
+  8008fd:	eb f0                	jmp    8008ef <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  8008ff:	5d                   	pop    %ebp
+  800900:	c3                   	ret
+
+00800901 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800901:	55                   	push   %ebp
+  800902:	89 e5                	mov    %esp,%ebp
+  800904:	57                   	push   %edi
+  800905:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800908:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  80090b:	85 c9                	test   %ecx,%ecx
+  80090d:	74 20                	je     80092f <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  80090f:	89 f8                	mov    %edi,%eax
+  800911:	09 c8                	or     %ecx,%eax
+  800913:	a8 03                	test   $0x3,%al
+  800915:	75 12                	jne    800929 <memset+0x28>
+    c &= 0xFF;
+  800917:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80091b:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  800921:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  800924:	fc                   	cld
+  800925:	f3 ab                	rep stos %eax,%es:(%edi)
+  800927:	eb 06                	jmp    80092f <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  800929:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80092c:	fc                   	cld
+  80092d:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  80092f:	89 f8                	mov    %edi,%eax
+  800931:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800934:	c9                   	leave
+  800935:	c3                   	ret
+
+00800936 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800936:	55                   	push   %ebp
+  800937:	89 e5                	mov    %esp,%ebp
+  800939:	57                   	push   %edi
+  80093a:	56                   	push   %esi
+  80093b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80093e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800941:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  800944:	39 c6                	cmp    %eax,%esi
+  800946:	73 32                	jae    80097a <memmove+0x44>
+  800948:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80094b:	39 d0                	cmp    %edx,%eax
+  80094d:	73 2b                	jae    80097a <memmove+0x44>
+    s += n;
+    d += n;
+  80094f:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800952:	89 d6                	mov    %edx,%esi
+  800954:	09 fe                	or     %edi,%esi
+  800956:	09 ce                	or     %ecx,%esi
+  800958:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  80095e:	75 0e                	jne    80096e <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800960:	83 ef 04             	sub    $0x4,%edi
+  800963:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800966:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  800969:	fd                   	std
+  80096a:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80096c:	eb 09                	jmp    800977 <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  80096e:	83 ef 01             	sub    $0x1,%edi
+  800971:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  800974:	fd                   	std
+  800975:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  800977:	fc                   	cld
+  800978:	eb 1a                	jmp    800994 <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80097a:	89 f2                	mov    %esi,%edx
+  80097c:	09 c2                	or     %eax,%edx
+  80097e:	09 ca                	or     %ecx,%edx
+  800980:	f6 c2 03             	test   $0x3,%dl
+  800983:	75 0a                	jne    80098f <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800985:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  800988:	89 c7                	mov    %eax,%edi
+  80098a:	fc                   	cld
+  80098b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80098d:	eb 05                	jmp    800994 <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  80098f:	89 c7                	mov    %eax,%edi
+  800991:	fc                   	cld
+  800992:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  800994:	5e                   	pop    %esi
+  800995:	5f                   	pop    %edi
+  800996:	5d                   	pop    %ebp
+  800997:	c3                   	ret
+
+00800998 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800998:	55                   	push   %ebp
+  800999:	89 e5                	mov    %esp,%ebp
+  80099b:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  80099e:	ff 75 10             	push   0x10(%ebp)
+  8009a1:	ff 75 0c             	push   0xc(%ebp)
+  8009a4:	ff 75 08             	push   0x8(%ebp)
+  8009a7:	e8 8a ff ff ff       	call   800936 <memmove>
+}
+  8009ac:	c9                   	leave
+  8009ad:	c3                   	ret
+
+008009ae <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8009ae:	55                   	push   %ebp
+  8009af:	89 e5                	mov    %esp,%ebp
+  8009b1:	56                   	push   %esi
+  8009b2:	53                   	push   %ebx
+  8009b3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009b6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  8009b9:	89 c6                	mov    %eax,%esi
+  8009bb:	03 75 10             	add    0x10(%ebp),%esi
+  8009be:	eb 06                	jmp    8009c6 <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  8009c0:	83 c0 01             	add    $0x1,%eax
+  8009c3:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  8009c6:	39 f0                	cmp    %esi,%eax
+  8009c8:	74 14                	je     8009de <memcmp+0x30>
+    if (*s1 != *s2)
+  8009ca:	0f b6 08             	movzbl (%eax),%ecx
+  8009cd:	0f b6 1a             	movzbl (%edx),%ebx
+  8009d0:	38 d9                	cmp    %bl,%cl
+  8009d2:	74 ec                	je     8009c0 <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  8009d4:	0f b6 c1             	movzbl %cl,%eax
+  8009d7:	0f b6 db             	movzbl %bl,%ebx
+  8009da:	29 d8                	sub    %ebx,%eax
+  8009dc:	eb 05                	jmp    8009e3 <memcmp+0x35>
+  }
+
+  return 0;
+  8009de:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009e3:	5b                   	pop    %ebx
+  8009e4:	5e                   	pop    %esi
+  8009e5:	5d                   	pop    %ebp
+  8009e6:	c3                   	ret
+
+008009e7 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8009e7:	55                   	push   %ebp
+  8009e8:	89 e5                	mov    %esp,%ebp
+  8009ea:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009ed:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  8009f0:	89 c2                	mov    %eax,%edx
+  8009f2:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  8009f5:	eb 03                	jmp    8009fa <memfind+0x13>
+  8009f7:	83 c0 01             	add    $0x1,%eax
+  8009fa:	39 d0                	cmp    %edx,%eax
+  8009fc:	73 04                	jae    800a02 <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  8009fe:	38 08                	cmp    %cl,(%eax)
+  800a00:	75 f5                	jne    8009f7 <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  800a02:	5d                   	pop    %ebp
+  800a03:	c3                   	ret
+
+00800a04 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a04:	55                   	push   %ebp
+  800a05:	89 e5                	mov    %esp,%ebp
+  800a07:	57                   	push   %edi
+  800a08:	56                   	push   %esi
+  800a09:	53                   	push   %ebx
+  800a0a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a0d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  800a10:	eb 03                	jmp    800a15 <strtol+0x11>
+    s++;
+  800a12:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  800a15:	0f b6 02             	movzbl (%edx),%eax
+  800a18:	3c 20                	cmp    $0x20,%al
+  800a1a:	74 f6                	je     800a12 <strtol+0xe>
+  800a1c:	3c 09                	cmp    $0x9,%al
+  800a1e:	74 f2                	je     800a12 <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  800a20:	3c 2b                	cmp    $0x2b,%al
+  800a22:	74 2a                	je     800a4e <strtol+0x4a>
+  int neg = 0;
+  800a24:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  800a29:	3c 2d                	cmp    $0x2d,%al
+  800a2b:	74 2b                	je     800a58 <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a2d:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a33:	75 0f                	jne    800a44 <strtol+0x40>
+  800a35:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a38:	74 28                	je     800a62 <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  800a3a:	85 db                	test   %ebx,%ebx
+  800a3c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a41:	0f 44 d8             	cmove  %eax,%ebx
+  800a44:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a49:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a4c:	eb 46                	jmp    800a94 <strtol+0x90>
+    s++;
+  800a4e:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  800a51:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a56:	eb d5                	jmp    800a2d <strtol+0x29>
+    s++, neg = 1;
+  800a58:	83 c2 01             	add    $0x1,%edx
+  800a5b:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a60:	eb cb                	jmp    800a2d <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a62:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a66:	74 0e                	je     800a76 <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  800a68:	85 db                	test   %ebx,%ebx
+  800a6a:	75 d8                	jne    800a44 <strtol+0x40>
+    s++, base = 8;
+  800a6c:	83 c2 01             	add    $0x1,%edx
+  800a6f:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a74:	eb ce                	jmp    800a44 <strtol+0x40>
+    s += 2, base = 16;
+  800a76:	83 c2 02             	add    $0x2,%edx
+  800a79:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a7e:	eb c4                	jmp    800a44 <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  800a80:	0f be c0             	movsbl %al,%eax
+  800a83:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  800a86:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a89:	7d 3a                	jge    800ac5 <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  800a8b:	83 c2 01             	add    $0x1,%edx
+  800a8e:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a92:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  800a94:	0f b6 02             	movzbl (%edx),%eax
+  800a97:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a9a:	89 f3                	mov    %esi,%ebx
+  800a9c:	80 fb 09             	cmp    $0x9,%bl
+  800a9f:	76 df                	jbe    800a80 <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  800aa1:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800aa4:	89 f3                	mov    %esi,%ebx
+  800aa6:	80 fb 19             	cmp    $0x19,%bl
+  800aa9:	77 08                	ja     800ab3 <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  800aab:	0f be c0             	movsbl %al,%eax
+  800aae:	83 e8 57             	sub    $0x57,%eax
+  800ab1:	eb d3                	jmp    800a86 <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  800ab3:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800ab6:	89 f3                	mov    %esi,%ebx
+  800ab8:	80 fb 19             	cmp    $0x19,%bl
+  800abb:	77 08                	ja     800ac5 <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  800abd:	0f be c0             	movsbl %al,%eax
+  800ac0:	83 e8 37             	sub    $0x37,%eax
+  800ac3:	eb c1                	jmp    800a86 <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  800ac5:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800ac9:	74 05                	je     800ad0 <strtol+0xcc>
+    *endptr = (char*)s;
+  800acb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ace:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  800ad0:	89 c8                	mov    %ecx,%eax
+  800ad2:	f7 d8                	neg    %eax
+  800ad4:	85 ff                	test   %edi,%edi
+  800ad6:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800ad9:	89 c8                	mov    %ecx,%eax
+  800adb:	5b                   	pop    %ebx
+  800adc:	5e                   	pop    %esi
+  800add:	5f                   	pop    %edi
+  800ade:	5d                   	pop    %ebp
+  800adf:	c3                   	ret
+
+00800ae0 <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800ae0:	55                   	push   %ebp
+  800ae1:	89 e5                	mov    %esp,%ebp
+  800ae3:	57                   	push   %edi
+  800ae4:	56                   	push   %esi
+  800ae5:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800ae6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aeb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800aee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800af1:	89 c3                	mov    %eax,%ebx
+  800af3:	89 c7                	mov    %eax,%edi
+  800af5:	89 c6                	mov    %eax,%esi
+  800af7:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800af9:	5b                   	pop    %ebx
+  800afa:	5e                   	pop    %esi
+  800afb:	5f                   	pop    %edi
+  800afc:	5d                   	pop    %ebp
+  800afd:	c3                   	ret
+
+00800afe <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800afe:	55                   	push   %ebp
+  800aff:	89 e5                	mov    %esp,%ebp
+  800b01:	57                   	push   %edi
+  800b02:	56                   	push   %esi
+  800b03:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800b04:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b09:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b0e:	89 d1                	mov    %edx,%ecx
+  800b10:	89 d3                	mov    %edx,%ebx
+  800b12:	89 d7                	mov    %edx,%edi
+  800b14:	89 d6                	mov    %edx,%esi
+  800b16:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800b18:	5b                   	pop    %ebx
+  800b19:	5e                   	pop    %esi
+  800b1a:	5f                   	pop    %edi
+  800b1b:	5d                   	pop    %ebp
+  800b1c:	c3                   	ret
+
+00800b1d <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800b1d:	55                   	push   %ebp
+  800b1e:	89 e5                	mov    %esp,%ebp
+  800b20:	57                   	push   %edi
+  800b21:	56                   	push   %esi
+  800b22:	53                   	push   %ebx
+  800b23:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800b26:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b2b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b2e:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b33:	89 cb                	mov    %ecx,%ebx
+  800b35:	89 cf                	mov    %ecx,%edi
+  800b37:	89 ce                	mov    %ecx,%esi
+  800b39:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800b3b:	85 c0                	test   %eax,%eax
+  800b3d:	7f 08                	jg     800b47 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800b3f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b42:	5b                   	pop    %ebx
+  800b43:	5e                   	pop    %esi
+  800b44:	5f                   	pop    %edi
+  800b45:	5d                   	pop    %ebp
+  800b46:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800b47:	83 ec 0c             	sub    $0xc,%esp
+  800b4a:	50                   	push   %eax
+  800b4b:	6a 03                	push   $0x3
+  800b4d:	68 c3 3c 80 00       	push   $0x803cc3
+  800b52:	6a 23                	push   $0x23
+  800b54:	68 e0 3c 80 00       	push   $0x803ce0
+  800b59:	e8 ec 2a 00 00       	call   80364a <_panic>
+
+00800b5e <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800b5e:	55                   	push   %ebp
+  800b5f:	89 e5                	mov    %esp,%ebp
+  800b61:	57                   	push   %edi
+  800b62:	56                   	push   %esi
+  800b63:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800b64:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b69:	b8 02 00 00 00       	mov    $0x2,%eax
+  800b6e:	89 d1                	mov    %edx,%ecx
+  800b70:	89 d3                	mov    %edx,%ebx
+  800b72:	89 d7                	mov    %edx,%edi
+  800b74:	89 d6                	mov    %edx,%esi
+  800b76:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800b78:	5b                   	pop    %ebx
+  800b79:	5e                   	pop    %esi
+  800b7a:	5f                   	pop    %edi
+  800b7b:	5d                   	pop    %ebp
+  800b7c:	c3                   	ret
+
+00800b7d <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800b7d:	55                   	push   %ebp
+  800b7e:	89 e5                	mov    %esp,%ebp
+  800b80:	57                   	push   %edi
+  800b81:	56                   	push   %esi
+  800b82:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800b83:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b88:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800b8d:	89 d1                	mov    %edx,%ecx
+  800b8f:	89 d3                	mov    %edx,%ebx
+  800b91:	89 d7                	mov    %edx,%edi
+  800b93:	89 d6                	mov    %edx,%esi
+  800b95:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800b97:	5b                   	pop    %ebx
+  800b98:	5e                   	pop    %esi
+  800b99:	5f                   	pop    %edi
+  800b9a:	5d                   	pop    %ebp
+  800b9b:	c3                   	ret
+
+00800b9c <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  800b9c:	55                   	push   %ebp
+  800b9d:	89 e5                	mov    %esp,%ebp
+  800b9f:	57                   	push   %edi
+  800ba0:	56                   	push   %esi
+  800ba1:	53                   	push   %ebx
+  800ba2:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  800ba5:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  800ba9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800bae:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bb1:	b8 14 00 00 00       	mov    $0x14,%eax
+  800bb6:	89 df                	mov    %ebx,%edi
+  800bb8:	89 de                	mov    %ebx,%esi
+  800bba:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800bbc:	85 c0                	test   %eax,%eax
+  800bbe:	7f 08                	jg     800bc8 <sys_env_set_cow+0x2c>
+}
+  800bc0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bc3:	5b                   	pop    %ebx
+  800bc4:	5e                   	pop    %esi
+  800bc5:	5f                   	pop    %edi
+  800bc6:	5d                   	pop    %ebp
+  800bc7:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800bc8:	83 ec 0c             	sub    $0xc,%esp
+  800bcb:	50                   	push   %eax
+  800bcc:	6a 14                	push   $0x14
+  800bce:	68 c3 3c 80 00       	push   $0x803cc3
+  800bd3:	6a 23                	push   $0x23
+  800bd5:	68 e0 3c 80 00       	push   $0x803ce0
+  800bda:	e8 6b 2a 00 00       	call   80364a <_panic>
+
+00800bdf <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800bdf:	55                   	push   %ebp
+  800be0:	89 e5                	mov    %esp,%ebp
+  800be2:	57                   	push   %edi
+  800be3:	56                   	push   %esi
+  800be4:	53                   	push   %ebx
+  800be5:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800be8:	be 00 00 00 00       	mov    $0x0,%esi
+  800bed:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bf0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bf3:	b8 04 00 00 00       	mov    $0x4,%eax
+  800bf8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800bfb:	89 f7                	mov    %esi,%edi
+  800bfd:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800bff:	85 c0                	test   %eax,%eax
+  800c01:	7f 08                	jg     800c0b <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  800c03:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c06:	5b                   	pop    %ebx
+  800c07:	5e                   	pop    %esi
+  800c08:	5f                   	pop    %edi
+  800c09:	5d                   	pop    %ebp
+  800c0a:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c0b:	83 ec 0c             	sub    $0xc,%esp
+  800c0e:	50                   	push   %eax
+  800c0f:	6a 04                	push   $0x4
+  800c11:	68 c3 3c 80 00       	push   $0x803cc3
+  800c16:	6a 23                	push   $0x23
+  800c18:	68 e0 3c 80 00       	push   $0x803ce0
+  800c1d:	e8 28 2a 00 00       	call   80364a <_panic>
+
+00800c22 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800c22:	55                   	push   %ebp
+  800c23:	89 e5                	mov    %esp,%ebp
+  800c25:	57                   	push   %edi
+  800c26:	56                   	push   %esi
+  800c27:	53                   	push   %ebx
+  800c28:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800c2b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c2e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c31:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c36:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c39:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c3c:	8b 75 18             	mov    0x18(%ebp),%esi
+  800c3f:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c41:	85 c0                	test   %eax,%eax
+  800c43:	7f 08                	jg     800c4d <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  800c45:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c48:	5b                   	pop    %ebx
+  800c49:	5e                   	pop    %esi
+  800c4a:	5f                   	pop    %edi
+  800c4b:	5d                   	pop    %ebp
+  800c4c:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c4d:	83 ec 0c             	sub    $0xc,%esp
+  800c50:	50                   	push   %eax
+  800c51:	6a 05                	push   $0x5
+  800c53:	68 c3 3c 80 00       	push   $0x803cc3
+  800c58:	6a 23                	push   $0x23
+  800c5a:	68 e0 3c 80 00       	push   $0x803ce0
+  800c5f:	e8 e6 29 00 00       	call   80364a <_panic>
+
+00800c64 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800c64:	55                   	push   %ebp
+  800c65:	89 e5                	mov    %esp,%ebp
+  800c67:	57                   	push   %edi
+  800c68:	56                   	push   %esi
+  800c69:	53                   	push   %ebx
+  800c6a:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800c6d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c72:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c75:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c78:	b8 06 00 00 00       	mov    $0x6,%eax
+  800c7d:	89 df                	mov    %ebx,%edi
+  800c7f:	89 de                	mov    %ebx,%esi
+  800c81:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c83:	85 c0                	test   %eax,%eax
+  800c85:	7f 08                	jg     800c8f <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  800c87:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c8a:	5b                   	pop    %ebx
+  800c8b:	5e                   	pop    %esi
+  800c8c:	5f                   	pop    %edi
+  800c8d:	5d                   	pop    %ebp
+  800c8e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c8f:	83 ec 0c             	sub    $0xc,%esp
+  800c92:	50                   	push   %eax
+  800c93:	6a 06                	push   $0x6
+  800c95:	68 c3 3c 80 00       	push   $0x803cc3
+  800c9a:	6a 23                	push   $0x23
+  800c9c:	68 e0 3c 80 00       	push   $0x803ce0
+  800ca1:	e8 a4 29 00 00       	call   80364a <_panic>
+
+00800ca6 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  800ca6:	55                   	push   %ebp
+  800ca7:	89 e5                	mov    %esp,%ebp
+  800ca9:	57                   	push   %edi
+  800caa:	56                   	push   %esi
+  800cab:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800cac:	8b 55 08             	mov    0x8(%ebp),%edx
+  800caf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cb2:	b8 11 00 00 00       	mov    $0x11,%eax
+  800cb7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cba:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800cbd:	8b 75 18             	mov    0x18(%ebp),%esi
+  800cc0:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  800cc2:	5b                   	pop    %ebx
+  800cc3:	5e                   	pop    %esi
+  800cc4:	5f                   	pop    %edi
+  800cc5:	5d                   	pop    %ebp
+  800cc6:	c3                   	ret
+
+00800cc7 <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  800cc7:	55                   	push   %ebp
+  800cc8:	89 e5                	mov    %esp,%ebp
+  800cca:	57                   	push   %edi
+  800ccb:	56                   	push   %esi
+  800ccc:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800ccd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cd0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cd3:	b8 12 00 00 00       	mov    $0x12,%eax
+  800cd8:	be 00 00 00 00       	mov    $0x0,%esi
+  800cdd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ce0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ce3:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  800ce5:	5b                   	pop    %ebx
+  800ce6:	5e                   	pop    %esi
+  800ce7:	5f                   	pop    %edi
+  800ce8:	5d                   	pop    %ebp
+  800ce9:	c3                   	ret
+
+00800cea <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  800cea:	55                   	push   %ebp
+  800ceb:	89 e5                	mov    %esp,%ebp
+  800ced:	57                   	push   %edi
+  800cee:	56                   	push   %esi
+  800cef:	53                   	push   %ebx
+  800cf0:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800cf3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cf8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cfb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cfe:	b8 16 00 00 00       	mov    $0x16,%eax
+  800d03:	89 df                	mov    %ebx,%edi
+  800d05:	89 de                	mov    %ebx,%esi
+  800d07:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d09:	85 c0                	test   %eax,%eax
+  800d0b:	7f 08                	jg     800d15 <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  800d0d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d10:	5b                   	pop    %ebx
+  800d11:	5e                   	pop    %esi
+  800d12:	5f                   	pop    %edi
+  800d13:	5d                   	pop    %ebp
+  800d14:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d15:	83 ec 0c             	sub    $0xc,%esp
+  800d18:	50                   	push   %eax
+  800d19:	6a 16                	push   $0x16
+  800d1b:	68 c3 3c 80 00       	push   $0x803cc3
+  800d20:	6a 23                	push   $0x23
+  800d22:	68 e0 3c 80 00       	push   $0x803ce0
+  800d27:	e8 1e 29 00 00       	call   80364a <_panic>
+
+00800d2c <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  800d2c:	55                   	push   %ebp
+  800d2d:	89 e5                	mov    %esp,%ebp
+  800d2f:	57                   	push   %edi
+  800d30:	56                   	push   %esi
+  800d31:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d32:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d37:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d3a:	b8 17 00 00 00       	mov    $0x17,%eax
+  800d3f:	89 cb                	mov    %ecx,%ebx
+  800d41:	89 cf                	mov    %ecx,%edi
+  800d43:	89 ce                	mov    %ecx,%esi
+  800d45:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  800d47:	5b                   	pop    %ebx
+  800d48:	5e                   	pop    %esi
+  800d49:	5f                   	pop    %edi
+  800d4a:	5d                   	pop    %ebp
+  800d4b:	c3                   	ret
+
+00800d4c <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  800d4c:	55                   	push   %ebp
+  800d4d:	89 e5                	mov    %esp,%ebp
+  800d4f:	57                   	push   %edi
+  800d50:	56                   	push   %esi
+  800d51:	53                   	push   %ebx
+  800d52:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800d55:	be 00 00 00 00       	mov    $0x0,%esi
+  800d5a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d5d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d60:	b8 18 00 00 00       	mov    $0x18,%eax
+  800d65:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d68:	89 f7                	mov    %esi,%edi
+  800d6a:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d6c:	85 c0                	test   %eax,%eax
+  800d6e:	7f 08                	jg     800d78 <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  800d70:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d73:	5b                   	pop    %ebx
+  800d74:	5e                   	pop    %esi
+  800d75:	5f                   	pop    %edi
+  800d76:	5d                   	pop    %ebp
+  800d77:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d78:	83 ec 0c             	sub    $0xc,%esp
+  800d7b:	50                   	push   %eax
+  800d7c:	6a 18                	push   $0x18
+  800d7e:	68 c3 3c 80 00       	push   $0x803cc3
+  800d83:	6a 23                	push   $0x23
+  800d85:	68 e0 3c 80 00       	push   $0x803ce0
+  800d8a:	e8 bb 28 00 00       	call   80364a <_panic>
+
+00800d8f <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  800d8f:	55                   	push   %ebp
+  800d90:	89 e5                	mov    %esp,%ebp
+  800d92:	57                   	push   %edi
+  800d93:	56                   	push   %esi
+  800d94:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d95:	be 00 00 00 00       	mov    $0x0,%esi
+  800d9a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d9d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800da0:	b8 19 00 00 00       	mov    $0x19,%eax
+  800da5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800da8:	89 f7                	mov    %esi,%edi
+  800daa:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  800dac:	5b                   	pop    %ebx
+  800dad:	5e                   	pop    %esi
+  800dae:	5f                   	pop    %edi
+  800daf:	5d                   	pop    %ebp
+  800db0:	c3                   	ret
+
+00800db1 <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  800db1:	55                   	push   %ebp
+  800db2:	89 e5                	mov    %esp,%ebp
+  800db4:	57                   	push   %edi
+  800db5:	56                   	push   %esi
+  800db6:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800db7:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dbc:	b8 15 00 00 00       	mov    $0x15,%eax
+  800dc1:	89 d1                	mov    %edx,%ecx
+  800dc3:	89 d3                	mov    %edx,%ebx
+  800dc5:	89 d7                	mov    %edx,%edi
+  800dc7:	89 d6                	mov    %edx,%esi
+  800dc9:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800dcb:	5b                   	pop    %ebx
+  800dcc:	5e                   	pop    %esi
+  800dcd:	5f                   	pop    %edi
+  800dce:	5d                   	pop    %ebp
+  800dcf:	c3                   	ret
+
+00800dd0 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800dd0:	55                   	push   %ebp
+  800dd1:	89 e5                	mov    %esp,%ebp
+  800dd3:	57                   	push   %edi
+  800dd4:	56                   	push   %esi
+  800dd5:	53                   	push   %ebx
+  800dd6:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800dd9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dde:	8b 55 08             	mov    0x8(%ebp),%edx
+  800de1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800de4:	b8 08 00 00 00       	mov    $0x8,%eax
+  800de9:	89 df                	mov    %ebx,%edi
+  800deb:	89 de                	mov    %ebx,%esi
+  800ded:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800def:	85 c0                	test   %eax,%eax
+  800df1:	7f 08                	jg     800dfb <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800df3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800df6:	5b                   	pop    %ebx
+  800df7:	5e                   	pop    %esi
+  800df8:	5f                   	pop    %edi
+  800df9:	5d                   	pop    %ebp
+  800dfa:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800dfb:	83 ec 0c             	sub    $0xc,%esp
+  800dfe:	50                   	push   %eax
+  800dff:	6a 08                	push   $0x8
+  800e01:	68 c3 3c 80 00       	push   $0x803cc3
+  800e06:	6a 23                	push   $0x23
+  800e08:	68 e0 3c 80 00       	push   $0x803ce0
+  800e0d:	e8 38 28 00 00       	call   80364a <_panic>
+
+00800e12 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800e12:	55                   	push   %ebp
+  800e13:	89 e5                	mov    %esp,%ebp
+  800e15:	57                   	push   %edi
+  800e16:	56                   	push   %esi
+  800e17:	53                   	push   %ebx
+  800e18:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e1b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e20:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e23:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e26:	b8 09 00 00 00       	mov    $0x9,%eax
+  800e2b:	89 df                	mov    %ebx,%edi
+  800e2d:	89 de                	mov    %ebx,%esi
+  800e2f:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e31:	85 c0                	test   %eax,%eax
+  800e33:	7f 08                	jg     800e3d <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  800e35:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e38:	5b                   	pop    %ebx
+  800e39:	5e                   	pop    %esi
+  800e3a:	5f                   	pop    %edi
+  800e3b:	5d                   	pop    %ebp
+  800e3c:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e3d:	83 ec 0c             	sub    $0xc,%esp
+  800e40:	50                   	push   %eax
+  800e41:	6a 09                	push   $0x9
+  800e43:	68 c3 3c 80 00       	push   $0x803cc3
+  800e48:	6a 23                	push   $0x23
+  800e4a:	68 e0 3c 80 00       	push   $0x803ce0
+  800e4f:	e8 f6 27 00 00       	call   80364a <_panic>
+
+00800e54 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800e54:	55                   	push   %ebp
+  800e55:	89 e5                	mov    %esp,%ebp
+  800e57:	57                   	push   %edi
+  800e58:	56                   	push   %esi
+  800e59:	53                   	push   %ebx
+  800e5a:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e5d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e62:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e65:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e68:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e6d:	89 df                	mov    %ebx,%edi
+  800e6f:	89 de                	mov    %ebx,%esi
+  800e71:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e73:	85 c0                	test   %eax,%eax
+  800e75:	7f 08                	jg     800e7f <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  800e77:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e7a:	5b                   	pop    %ebx
+  800e7b:	5e                   	pop    %esi
+  800e7c:	5f                   	pop    %edi
+  800e7d:	5d                   	pop    %ebp
+  800e7e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e7f:	83 ec 0c             	sub    $0xc,%esp
+  800e82:	50                   	push   %eax
+  800e83:	6a 0a                	push   $0xa
+  800e85:	68 c3 3c 80 00       	push   $0x803cc3
+  800e8a:	6a 23                	push   $0x23
+  800e8c:	68 e0 3c 80 00       	push   $0x803ce0
+  800e91:	e8 b4 27 00 00       	call   80364a <_panic>
+
+00800e96 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  800e96:	55                   	push   %ebp
+  800e97:	89 e5                	mov    %esp,%ebp
+  800e99:	57                   	push   %edi
+  800e9a:	56                   	push   %esi
+  800e9b:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e9c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e9f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ea2:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800ea7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800eaa:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ead:	8b 75 18             	mov    0x18(%ebp),%esi
+  800eb0:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  800eb2:	5b                   	pop    %ebx
+  800eb3:	5e                   	pop    %esi
+  800eb4:	5f                   	pop    %edi
+  800eb5:	5d                   	pop    %ebp
+  800eb6:	c3                   	ret
+
+00800eb7 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  800eb7:	55                   	push   %ebp
+  800eb8:	89 e5                	mov    %esp,%ebp
+  800eba:	57                   	push   %edi
+  800ebb:	56                   	push   %esi
+  800ebc:	53                   	push   %ebx
+  800ebd:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800ec0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ec5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ecb:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800ed0:	89 df                	mov    %ebx,%edi
+  800ed2:	89 de                	mov    %ebx,%esi
+  800ed4:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ed6:	85 c0                	test   %eax,%eax
+  800ed8:	7f 08                	jg     800ee2 <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  800eda:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800edd:	5b                   	pop    %ebx
+  800ede:	5e                   	pop    %esi
+  800edf:	5f                   	pop    %edi
+  800ee0:	5d                   	pop    %ebp
+  800ee1:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ee2:	83 ec 0c             	sub    $0xc,%esp
+  800ee5:	50                   	push   %eax
+  800ee6:	6a 0d                	push   $0xd
+  800ee8:	68 c3 3c 80 00       	push   $0x803cc3
+  800eed:	6a 23                	push   $0x23
+  800eef:	68 e0 3c 80 00       	push   $0x803ce0
+  800ef4:	e8 51 27 00 00       	call   80364a <_panic>
+
+00800ef9 <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  800ef9:	55                   	push   %ebp
+  800efa:	89 e5                	mov    %esp,%ebp
+  800efc:	57                   	push   %edi
+  800efd:	56                   	push   %esi
+  800efe:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800eff:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f04:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800f09:	89 d1                	mov    %edx,%ecx
+  800f0b:	89 d3                	mov    %edx,%ebx
+  800f0d:	89 d7                	mov    %edx,%edi
+  800f0f:	89 d6                	mov    %edx,%esi
+  800f11:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800f13:	5b                   	pop    %ebx
+  800f14:	5e                   	pop    %esi
+  800f15:	5f                   	pop    %edi
+  800f16:	5d                   	pop    %ebp
+  800f17:	c3                   	ret
+
+00800f18 <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  800f18:	55                   	push   %ebp
+  800f19:	89 e5                	mov    %esp,%ebp
+  800f1b:	57                   	push   %edi
+  800f1c:	56                   	push   %esi
+  800f1d:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f1e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f21:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f24:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f29:	be 00 00 00 00       	mov    $0x0,%esi
+  800f2e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f31:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f34:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  800f36:	5b                   	pop    %ebx
+  800f37:	5e                   	pop    %esi
+  800f38:	5f                   	pop    %edi
+  800f39:	5d                   	pop    %ebp
+  800f3a:	c3                   	ret
+
+00800f3b <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  800f3b:	55                   	push   %ebp
+  800f3c:	89 e5                	mov    %esp,%ebp
+  800f3e:	57                   	push   %edi
+  800f3f:	56                   	push   %esi
+  800f40:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f41:	be 00 00 00 00       	mov    $0x0,%esi
+  800f46:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f49:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f4c:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f51:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f54:	89 f7                	mov    %esi,%edi
+  800f56:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  800f58:	5b                   	pop    %ebx
+  800f59:	5e                   	pop    %esi
+  800f5a:	5f                   	pop    %edi
+  800f5b:	5d                   	pop    %ebp
+  800f5c:	c3                   	ret
+
+00800f5d <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  800f5d:	55                   	push   %ebp
+  800f5e:	89 e5                	mov    %esp,%ebp
+  800f60:	57                   	push   %edi
+  800f61:	56                   	push   %esi
+  800f62:	53                   	push   %ebx
+  800f63:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  800f66:	80 3d a4 58 80 00 00 	cmpb   $0x0,0x8058a4
+  800f6d:	74 41                	je     800fb0 <sys_batch+0x53>
+  800f6f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f72:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  800f75:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  800f7c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800f7f:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  800f82:	7d 45                	jge    800fc9 <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  800f84:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800f87:	8b 06                	mov    (%esi),%eax
+  800f89:	8b 56 04             	mov    0x4(%esi),%edx
+  800f8c:	8b 4e 08             	mov    0x8(%esi),%ecx
+  800f8f:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  800f92:	8b 7e 10             	mov    0x10(%esi),%edi
+  800f95:	8b 76 14             	mov    0x14(%esi),%esi
+  800f98:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  800f9a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800f9d:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  800fa0:	83 c6 1c             	add    $0x1c,%esi
+  800fa3:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  800fa6:	85 c0                	test   %eax,%eax
+  800fa8:	78 1f                	js     800fc9 <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  800faa:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  800fae:	eb cc                	jmp    800f7c <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  800fb0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fb5:	b8 13 00 00 00       	mov    $0x13,%eax
+  800fba:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fbd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fc0:	89 df                	mov    %ebx,%edi
+  800fc2:	89 de                	mov    %ebx,%esi
+  800fc4:	cd 30                	int    $0x30
+  800fc6:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  800fc9:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800fcc:	83 c4 08             	add    $0x8,%esp
+  800fcf:	5b                   	pop    %ebx
+  800fd0:	5e                   	pop    %esi
+  800fd1:	5f                   	pop    %edi
+  800fd2:	5d                   	pop    %ebp
+  800fd3:	c3                   	ret
+
+00800fd4 <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  800fd4:	55                   	push   %ebp
+  800fd5:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  800fd7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fda:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  800fe0:	5d                   	pop    %ebp
+  800fe1:	c3                   	ret
+
+00800fe2 <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  800fe2:	55                   	push   %ebp
+  800fe3:	89 e5                	mov    %esp,%ebp
+  800fe5:	56                   	push   %esi
+  800fe6:	53                   	push   %ebx
+  800fe7:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  800fea:	8b 1e                	mov    (%esi),%ebx
+  800fec:	85 db                	test   %ebx,%ebx
+  800fee:	75 09                	jne    800ff9 <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  800ff0:	89 d8                	mov    %ebx,%eax
+  800ff2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ff5:	5b                   	pop    %ebx
+  800ff6:	5e                   	pop    %esi
+  800ff7:	5d                   	pop    %ebp
+  800ff8:	c3                   	ret
+  b->sb_n = 0;
+  800ff9:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  800fff:	53                   	push   %ebx
+  801000:	8d 46 04             	lea    0x4(%esi),%eax
+  801003:	50                   	push   %eax
+  801004:	e8 54 ff ff ff       	call   800f5d <sys_batch>
+  801009:	83 c4 08             	add    $0x8,%esp
+  80100c:	85 c0                	test   %eax,%eax
+  80100e:	78 1e                	js     80102e <sysbatch_flush+0x4c>
+  if (r < n)
+  801010:	39 c3                	cmp    %eax,%ebx
+  801012:	7f 07                	jg     80101b <sysbatch_flush+0x39>
+  return 0;
+  801014:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801019:	eb d5                	jmp    800ff0 <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  80101b:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80101e:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  801022:	85 db                	test   %ebx,%ebx
+  801024:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801029:	0f 49 d8             	cmovns %eax,%ebx
+  80102c:	eb c2                	jmp    800ff0 <sysbatch_flush+0xe>
+    return r;
+  80102e:	89 c3                	mov    %eax,%ebx
+  801030:	eb be                	jmp    800ff0 <sysbatch_flush+0xe>
+
+00801032 <sysbatch_add>:
+{
+  801032:	55                   	push   %ebp
+  801033:	89 e5                	mov    %esp,%ebp
+  801035:	53                   	push   %ebx
+  801036:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  801039:	83 3b 40             	cmpl   $0x40,(%ebx)
+  80103c:	74 41                	je     80107f <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  80103e:	8b 03                	mov    (%ebx),%eax
+  801040:	8d 50 01             	lea    0x1(%eax),%edx
+  801043:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  801045:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801048:	01 d8                	add    %ebx,%eax
+  80104a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80104d:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  801050:	8b 55 10             	mov    0x10(%ebp),%edx
+  801053:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  801056:	8b 55 14             	mov    0x14(%ebp),%edx
+  801059:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  80105c:	8b 55 18             	mov    0x18(%ebp),%edx
+  80105f:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  801062:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  801065:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  801068:	8b 55 20             	mov    0x20(%ebp),%edx
+  80106b:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  80106e:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  801075:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80107a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80107d:	c9                   	leave
+  80107e:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  80107f:	53                   	push   %ebx
+  801080:	e8 5d ff ff ff       	call   800fe2 <sysbatch_flush>
+  801085:	83 c4 04             	add    $0x4,%esp
+  801088:	85 c0                	test   %eax,%eax
+  80108a:	79 b2                	jns    80103e <sysbatch_add+0xc>
+  80108c:	eb ec                	jmp    80107a <sysbatch_add+0x48>
+
+0080108e <pgfault>:
+// Custom page fault handler - if faulting page is copy-on-write,
+// map in our own private writable copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  80108e:	55                   	push   %ebp
+  80108f:	89 e5                	mov    %esp,%ebp
+  801091:	56                   	push   %esi
+  801092:	53                   	push   %ebx
+  801093:	8b 45 08             	mov    0x8(%ebp),%eax
+  void *addr = (void*)utf->utf_fault_va;
+  801096:	8b 18                	mov    (%eax),%ebx
+  uint32_t err = utf->utf_err;
+  801098:	8b 70 04             	mov    0x4(%eax),%esi
+  // Hint:
+  //   Use the read-only page table mappings at uvpt
+  //   (see <inc/memlayout.h>).
+
+  // Faults in file mappings are mmap's to handle.
+  if (mmap_fault(utf))
+  80109b:	83 ec 0c             	sub    $0xc,%esp
+  80109e:	50                   	push   %eax
+  80109f:	e8 17 1f 00 00       	call   802fbb <mmap_fault>
+  8010a4:	83 c4 10             	add    $0x10,%esp
+  8010a7:	84 c0                	test   %al,%al
+  8010a9:	75 7d                	jne    801128 <pgfault+0x9a>
+    return;
+
+  // LAB 4: Your code here.
+  if ( !(err & FEC_WR) ) {
+  8010ab:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  8010b1:	74 7c                	je     80112f <pgfault+0xa1>
+    panic("user_pgfault: %e", err);
+  }
+
+  if ( !(uvpt[PGNUM(addr)] & PTE_COW) ) {
+  8010b3:	89 d8                	mov    %ebx,%eax
+  8010b5:	c1 e8 0c             	shr    $0xc,%eax
+  8010b8:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8010bf:	f6 c4 08             	test   $0x8,%ah
+  8010c2:	74 7d                	je     801141 <pgfault+0xb3>
+  // page to the old page's address.
+  // Hint:
+  //   You should make three system calls.
+
+  // LAB 4: Your code here.
+  addr = ROUNDDOWN(addr, PGSIZE);
+  8010c4:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+
+  // map page to temporary location
+  if ( (r = sys_page_alloc(0, PFTEMP, (PTE_P | PTE_U | PTE_W))) < 0) {
+  8010ca:	83 ec 04             	sub    $0x4,%esp
+  8010cd:	6a 07                	push   $0x7
+  8010cf:	68 00 f0 7f 00       	push   $0x7ff000
+  8010d4:	6a 00                	push   $0x0
+  8010d6:	e8 04 fb ff ff       	call   800bdf <sys_page_alloc>
+  8010db:	83 c4 10             	add    $0x10,%esp
+  8010de:	85 c0                	test   %eax,%eax
+  8010e0:	78 73                	js     801155 <pgfault+0xc7>
+    panic("sys_page_alloc: %e", r);
+  }
+
+  // copy data from old page to new page
+  memmove(PFTEMP, addr, PGSIZE);
+  8010e2:	83 ec 04             	sub    $0x4,%esp
+  8010e5:	68 00 10 00 00       	push   $0x1000
+  8010ea:	53                   	push   %ebx
+  8010eb:	68 00 f0 7f 00       	push   $0x7ff000
+  8010f0:	e8 41 f8 ff ff       	call   800936 <memmove>
+
+  // move new page to old page address
+  if ( (r = sys_page_map(0, PFTEMP, 0, addr, (PTE_P | PTE_U | PTE_W))) < 0) {
+  8010f5:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8010fc:	53                   	push   %ebx
+  8010fd:	6a 00                	push   $0x0
+  8010ff:	68 00 f0 7f 00       	push   $0x7ff000
+  801104:	6a 00                	push   $0x0
+  801106:	e8 17 fb ff ff       	call   800c22 <sys_page_map>
+  80110b:	83 c4 20             	add    $0x20,%esp
+  80110e:	85 c0                	test   %eax,%eax
+  801110:	78 55                	js     801167 <pgfault+0xd9>
+    panic("sys_page_map: %e", r);
+  }
+
+  if ( (r = sys_page_unmap(0, PFTEMP)) < 0) {
+  801112:	83 ec 08             	sub    $0x8,%esp
+  801115:	68 00 f0 7f 00       	push   $0x7ff000
+  80111a:	6a 00                	push   $0x0
+  80111c:	e8 43 fb ff ff       	call   800c64 <sys_page_unmap>
+  801121:	83 c4 10             	add    $0x10,%esp
+  801124:	85 c0                	test   %eax,%eax
+  801126:	78 51                	js     801179 <pgfault+0xeb>
+    panic("sys_page_unmap: %e", r);
+  }
+}
+  801128:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80112b:	5b                   	pop    %ebx
+  80112c:	5e                   	pop    %esi
+  80112d:	5d                   	pop    %ebp
+  80112e:	c3                   	ret
+    panic("user_pgfault: %e", err);
+  80112f:	56                   	push   %esi
+  801130:	68 ee 3c 80 00       	push   $0x803cee
+  801135:	6a 1d                	push   $0x1d
+  801137:	68 ff 3c 80 00       	push   $0x803cff
+  80113c:	e8 09 25 00 00       	call   80364a <_panic>
+    panic("user_pgfault: page not COW");
+  801141:	83 ec 04             	sub    $0x4,%esp
+  801144:	68 0a 3d 80 00       	push   $0x803d0a
+  801149:	6a 21                	push   $0x21
+  80114b:	68 ff 3c 80 00       	push   $0x803cff
+  801150:	e8 f5 24 00 00       	call   80364a <_panic>
+    panic("sys_page_alloc: %e", r);
+  801155:	50                   	push   %eax
+  801156:	68 25 3d 80 00       	push   $0x803d25
+  80115b:	6a 2f                	push   $0x2f
+  80115d:	68 ff 3c 80 00       	push   $0x803cff
+  801162:	e8 e3 24 00 00       	call   80364a <_panic>
+    panic("sys_page_map: %e", r);
+  801167:	50                   	push   %eax
+  801168:	68 38 3d 80 00       	push   $0x803d38
+  80116d:	6a 37                	push   $0x37
+  80116f:	68 ff 3c 80 00       	push   $0x803cff
+  801174:	e8 d1 24 00 00       	call   80364a <_panic>
+    panic("sys_page_unmap: %e", r);
+  801179:	50                   	push   %eax
+  80117a:	68 49 3d 80 00       	push   $0x803d49
+  80117f:	6a 3b                	push   $0x3b
+  801181:	68 ff 3c 80 00       	push   $0x803cff
+  801186:	e8 bf 24 00 00       	call   80364a <_panic>
+
+0080118b <shared_pgfault>:
+
+// Challenge!
+//
+static void
+shared_pgfault(struct UTrapframe *utf)
+{
+  80118b:	55                   	push   %ebp
+  80118c:	89 e5                	mov    %esp,%ebp
+  80118e:	53                   	push   %ebx
+  80118f:	83 ec 10             	sub    $0x10,%esp
+  801192:	8b 45 08             	mov    0x8(%ebp),%eax
+  // just has fewer error checks
+  
+  void *addr = (void*)utf->utf_fault_va;
+  801195:	8b 18                	mov    (%eax),%ebx
+  uint32_t err = utf->utf_err;
+  int r;
+
+  if (mmap_fault(utf))
+  801197:	50                   	push   %eax
+  801198:	e8 1e 1e 00 00       	call   802fbb <mmap_fault>
+  80119d:	83 c4 10             	add    $0x10,%esp
+  8011a0:	84 c0                	test   %al,%al
+  8011a2:	74 05                	je     8011a9 <shared_pgfault+0x1e>
+  }
+
+  if ( (r = sys_page_unmap(0, PFTEMP)) < 0) {
+    panic("sys_page_unmap: %e", r);
+  }
+}
+  8011a4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8011a7:	c9                   	leave
+  8011a8:	c3                   	ret
+  addr = ROUNDDOWN(addr, PGSIZE);
+  8011a9:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if ( (r = sys_page_alloc(0, PFTEMP, (PTE_P | PTE_U | PTE_W))) < 0) {
+  8011af:	83 ec 04             	sub    $0x4,%esp
+  8011b2:	6a 07                	push   $0x7
+  8011b4:	68 00 f0 7f 00       	push   $0x7ff000
+  8011b9:	6a 00                	push   $0x0
+  8011bb:	e8 1f fa ff ff       	call   800bdf <sys_page_alloc>
+  8011c0:	83 c4 10             	add    $0x10,%esp
+  8011c3:	85 c0                	test   %eax,%eax
+  8011c5:	78 5b                	js     801222 <shared_pgfault+0x97>
+  memmove(PFTEMP, addr, PGSIZE);
+  8011c7:	83 ec 04             	sub    $0x4,%esp
+  8011ca:	68 00 10 00 00       	push   $0x1000
+  8011cf:	53                   	push   %ebx
+  8011d0:	68 00 f0 7f 00       	push   $0x7ff000
+  8011d5:	e8 5c f7 ff ff       	call   800936 <memmove>
+  if ( (r = sys_page_map(0, PFTEMP, 0, addr, (PTE_P | PTE_U | PTE_W))) < 0) {
+  8011da:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8011e1:	53                   	push   %ebx
+  8011e2:	6a 00                	push   $0x0
+  8011e4:	68 00 f0 7f 00       	push   $0x7ff000
+  8011e9:	6a 00                	push   $0x0
+  8011eb:	e8 32 fa ff ff       	call   800c22 <sys_page_map>
+  8011f0:	83 c4 20             	add    $0x20,%esp
+  8011f3:	85 c0                	test   %eax,%eax
+  8011f5:	78 40                	js     801237 <shared_pgfault+0xac>
+  if ( (r = sys_page_unmap(0, PFTEMP)) < 0) {
+  8011f7:	83 ec 08             	sub    $0x8,%esp
+  8011fa:	68 00 f0 7f 00       	push   $0x7ff000
+  8011ff:	6a 00                	push   $0x0
+  801201:	e8 5e fa ff ff       	call   800c64 <sys_page_unmap>
+  801206:	83 c4 10             	add    $0x10,%esp
+  801209:	85 c0                	test   %eax,%eax
+  80120b:	79 97                	jns    8011a4 <shared_pgfault+0x19>
+    panic("sys_page_unmap: %e", r);
+  80120d:	50                   	push   %eax
+  80120e:	68 49 3d 80 00       	push   $0x803d49
+  801213:	68 b0 00 00 00       	push   $0xb0
+  801218:	68 ff 3c 80 00       	push   $0x803cff
+  80121d:	e8 28 24 00 00       	call   80364a <_panic>
+    panic("sys_page_alloc: %e", r);
+  801222:	50                   	push   %eax
+  801223:	68 25 3d 80 00       	push   $0x803d25
+  801228:	68 a4 00 00 00       	push   $0xa4
+  80122d:	68 ff 3c 80 00       	push   $0x803cff
+  801232:	e8 13 24 00 00       	call   80364a <_panic>
+    panic("sys_page_map: %e", r);
+  801237:	50                   	push   %eax
+  801238:	68 38 3d 80 00       	push   $0x803d38
+  80123d:	68 ac 00 00 00       	push   $0xac
+  801242:	68 ff 3c 80 00       	push   $0x803cff
+  801247:	e8 fe 23 00 00       	call   80364a <_panic>
+
+0080124c <fork>:
+{
+  80124c:	55                   	push   %ebp
+  80124d:	89 e5                	mov    %esp,%ebp
+  80124f:	53                   	push   %ebx
+  801250:	83 ec 04             	sub    $0x4,%esp
+  parent_id = sys_getenvid();
+  801253:	e8 06 f9 ff ff       	call   800b5e <sys_getenvid>
+  set_pgfault_handler(pgfault);
+  801258:	83 ec 0c             	sub    $0xc,%esp
+  80125b:	68 8e 10 80 00       	push   $0x80108e
+  801260:	e8 2b 24 00 00       	call   803690 <set_pgfault_handler>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+  envid_t ret;
+  __asm __volatile("int %2"
+  801265:	b8 07 00 00 00       	mov    $0x7,%eax
+  80126a:	cd 30                	int    $0x30
+  80126c:	89 c3                	mov    %eax,%ebx
+  if (envid < 0) {
+  80126e:	83 c4 10             	add    $0x10,%esp
+  801271:	85 c0                	test   %eax,%eax
+  801273:	78 66                	js     8012db <fork+0x8f>
+  } else if (envid == 0) {
+  801275:	74 76                	je     8012ed <fork+0xa1>
+  if ( (error = sys_page_map_range(0, 0, UXSTACKTOP - PGSIZE,
+  801277:	83 ec 0c             	sub    $0xc,%esp
+  80127a:	6a 01                	push   $0x1
+  80127c:	50                   	push   %eax
+  80127d:	68 00 f0 bf ee       	push   $0xeebff000
+  801282:	6a 00                	push   $0x0
+  801284:	6a 00                	push   $0x0
+  801286:	e8 1b fa ff ff       	call   800ca6 <sys_page_map_range>
+  80128b:	83 c4 20             	add    $0x20,%esp
+  80128e:	85 c0                	test   %eax,%eax
+  801290:	78 77                	js     801309 <fork+0xbd>
+  if ( (error = sys_page_alloc(envid,
+  801292:	83 ec 04             	sub    $0x4,%esp
+  801295:	6a 07                	push   $0x7
+  801297:	68 00 f0 bf ee       	push   $0xeebff000
+  80129c:	53                   	push   %ebx
+  80129d:	e8 3d f9 ff ff       	call   800bdf <sys_page_alloc>
+  8012a2:	83 c4 10             	add    $0x10,%esp
+  8012a5:	85 c0                	test   %eax,%eax
+  8012a7:	78 72                	js     80131b <fork+0xcf>
+          thisenv->env_pgfault_upcall)) < 0) {
+  8012a9:	a1 a0 58 80 00       	mov    0x8058a0,%eax
+  8012ae:	8b 40 64             	mov    0x64(%eax),%eax
+  if ( (error = sys_env_set_pgfault_upcall(envid,
+  8012b1:	83 ec 08             	sub    $0x8,%esp
+  8012b4:	50                   	push   %eax
+  8012b5:	53                   	push   %ebx
+  8012b6:	e8 99 fb ff ff       	call   800e54 <sys_env_set_pgfault_upcall>
+  8012bb:	83 c4 10             	add    $0x10,%esp
+  8012be:	85 c0                	test   %eax,%eax
+  8012c0:	78 6b                	js     80132d <fork+0xe1>
+  if ( (error = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+  8012c2:	83 ec 08             	sub    $0x8,%esp
+  8012c5:	6a 02                	push   $0x2
+  8012c7:	53                   	push   %ebx
+  8012c8:	e8 03 fb ff ff       	call   800dd0 <sys_env_set_status>
+  8012cd:	83 c4 10             	add    $0x10,%esp
+  8012d0:	85 c0                	test   %eax,%eax
+  8012d2:	78 6b                	js     80133f <fork+0xf3>
+}
+  8012d4:	89 d8                	mov    %ebx,%eax
+  8012d6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012d9:	c9                   	leave
+  8012da:	c3                   	ret
+    panic("sys_exofork: %e", envid);
+  8012db:	50                   	push   %eax
+  8012dc:	68 5c 3d 80 00       	push   $0x803d5c
+  8012e1:	6a 5e                	push   $0x5e
+  8012e3:	68 ff 3c 80 00       	push   $0x803cff
+  8012e8:	e8 5d 23 00 00       	call   80364a <_panic>
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8012ed:	e8 6c f8 ff ff       	call   800b5e <sys_getenvid>
+  8012f2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8012f7:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8012fa:	c1 e0 04             	shl    $0x4,%eax
+  8012fd:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801302:	a3 a0 58 80 00       	mov    %eax,0x8058a0
+    return 0;
+  801307:	eb cb                	jmp    8012d4 <fork+0x88>
+    panic("sys_page_map_range: %e", error);
+  801309:	50                   	push   %eax
+  80130a:	68 6c 3d 80 00       	push   $0x803d6c
+  80130f:	6a 69                	push   $0x69
+  801311:	68 ff 3c 80 00       	push   $0x803cff
+  801316:	e8 2f 23 00 00       	call   80364a <_panic>
+    panic("sys_page_alloc: %e", error);
+  80131b:	50                   	push   %eax
+  80131c:	68 25 3d 80 00       	push   $0x803d25
+  801321:	6a 70                	push   $0x70
+  801323:	68 ff 3c 80 00       	push   $0x803cff
+  801328:	e8 1d 23 00 00       	call   80364a <_panic>
+    panic("sys_env_set_pgfault_upcall: %e", error);
+  80132d:	50                   	push   %eax
+  80132e:	68 9c 3d 80 00       	push   $0x803d9c
+  801333:	6a 76                	push   $0x76
+  801335:	68 ff 3c 80 00       	push   $0x803cff
+  80133a:	e8 0b 23 00 00       	call   80364a <_panic>
+    panic("sys_env_set_status: %e", error);
+  80133f:	50                   	push   %eax
+  801340:	68 83 3d 80 00       	push   $0x803d83
+  801345:	6a 7a                	push   $0x7a
+  801347:	68 ff 3c 80 00       	push   $0x803cff
+  80134c:	e8 f9 22 00 00       	call   80364a <_panic>
+
+00801351 <kfork>:
+{
+  801351:	55                   	push   %ebp
+  801352:	89 e5                	mov    %esp,%ebp
+  801354:	53                   	push   %ebx
+  801355:	83 ec 10             	sub    $0x10,%esp
+  set_pgfault_handler(pgfault);
+  801358:	68 8e 10 80 00       	push   $0x80108e
+  80135d:	e8 2e 23 00 00       	call   803690 <set_pgfault_handler>
+  if ((envid = sys_fork()) == 0)
+  801362:	e8 4a fa ff ff       	call   800db1 <sys_fork>
+  801367:	89 c3                	mov    %eax,%ebx
+  801369:	83 c4 10             	add    $0x10,%esp
+  80136c:	85 c0                	test   %eax,%eax
+  80136e:	74 07                	je     801377 <kfork+0x26>
+}
+  801370:	89 d8                	mov    %ebx,%eax
+  801372:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801375:	c9                   	leave
+  801376:	c3                   	ret
+    thisenv = &envs[ENVX(sys_getenvid())];
+  801377:	e8 e2 f7 ff ff       	call   800b5e <sys_getenvid>
+  80137c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801381:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  801384:	c1 e0 04             	shl    $0x4,%eax
+  801387:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80138c:	a3 a0 58 80 00       	mov    %eax,0x8058a0
+  return envid;
+  801391:	eb dd                	jmp    801370 <kfork+0x1f>
+
+00801393 <sfork>:
+
+int
+sfork(void)
+{
+  801393:	55                   	push   %ebp
+  801394:	89 e5                	mov    %esp,%ebp
+  801396:	53                   	push   %ebx
+  801397:	83 ec 04             	sub    $0x4,%esp
+  envid_t envid, parent_id;
+  int error;
+
+  parent_id = sys_getenvid();
+  80139a:	e8 bf f7 ff ff       	call   800b5e <sys_getenvid>
+
+  // set up page fault handler
+  set_pgfault_handler(shared_pgfault);
+  80139f:	83 ec 0c             	sub    $0xc,%esp
+  8013a2:	68 8b 11 80 00       	push   $0x80118b
+  8013a7:	e8 e4 22 00 00       	call   803690 <set_pgfault_handler>
+  8013ac:	b8 07 00 00 00       	mov    $0x7,%eax
+  8013b1:	cd 30                	int    $0x30
+  8013b3:	89 c3                	mov    %eax,%ebx
+
+  // create a child with sys_exofork
+  envid = sys_exofork();
+  
+  if (envid < 0) {
+  8013b5:	83 c4 10             	add    $0x10,%esp
+  8013b8:	85 c0                	test   %eax,%eax
+  8013ba:	78 09                	js     8013c5 <sfork+0x32>
+    panic("sys_exofork: %e", envid);
+  } else if (envid == 0) {
+  8013bc:	75 1c                	jne    8013da <sfork+0x47>
+  if ( (error = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+    panic("sys_env_set_status: %e", error);
+  }
+
+  return envid;
+}
+  8013be:	89 d8                	mov    %ebx,%eax
+  8013c0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013c3:	c9                   	leave
+  8013c4:	c3                   	ret
+    panic("sys_exofork: %e", envid);
+  8013c5:	50                   	push   %eax
+  8013c6:	68 5c 3d 80 00       	push   $0x803d5c
+  8013cb:	68 c3 00 00 00       	push   $0xc3
+  8013d0:	68 ff 3c 80 00       	push   $0x803cff
+  8013d5:	e8 70 22 00 00       	call   80364a <_panic>
+  if ( (error = sys_page_map_range(0, 0, USTACKTOP - PGSIZE,
+  8013da:	83 ec 0c             	sub    $0xc,%esp
+  8013dd:	6a 00                	push   $0x0
+  8013df:	50                   	push   %eax
+  8013e0:	68 00 d0 bf ee       	push   $0xeebfd000
+  8013e5:	6a 00                	push   $0x0
+  8013e7:	6a 00                	push   $0x0
+  8013e9:	e8 b8 f8 ff ff       	call   800ca6 <sys_page_map_range>
+  8013ee:	83 c4 20             	add    $0x20,%esp
+  8013f1:	85 c0                	test   %eax,%eax
+  8013f3:	78 79                	js     80146e <sfork+0xdb>
+  if ( (error = sys_page_map_range(0, (void *) (USTACKTOP - PGSIZE), PGSIZE,
+  8013f5:	83 ec 0c             	sub    $0xc,%esp
+  8013f8:	6a 01                	push   $0x1
+  8013fa:	53                   	push   %ebx
+  8013fb:	68 00 10 00 00       	push   $0x1000
+  801400:	68 00 d0 bf ee       	push   $0xeebfd000
+  801405:	6a 00                	push   $0x0
+  801407:	e8 9a f8 ff ff       	call   800ca6 <sys_page_map_range>
+  80140c:	83 c4 20             	add    $0x20,%esp
+  80140f:	85 c0                	test   %eax,%eax
+  801411:	78 70                	js     801483 <sfork+0xf0>
+  if ( (error = sys_page_alloc(envid,
+  801413:	83 ec 04             	sub    $0x4,%esp
+  801416:	6a 07                	push   $0x7
+  801418:	68 00 f0 bf ee       	push   $0xeebff000
+  80141d:	53                   	push   %ebx
+  80141e:	e8 bc f7 ff ff       	call   800bdf <sys_page_alloc>
+  801423:	83 c4 10             	add    $0x10,%esp
+  801426:	85 c0                	test   %eax,%eax
+  801428:	78 6e                	js     801498 <sfork+0x105>
+          thisenv->env_pgfault_upcall)) < 0) {
+  80142a:	a1 a0 58 80 00       	mov    0x8058a0,%eax
+  80142f:	8b 40 64             	mov    0x64(%eax),%eax
+  if ( (error = sys_env_set_pgfault_upcall(envid,
+  801432:	83 ec 08             	sub    $0x8,%esp
+  801435:	50                   	push   %eax
+  801436:	53                   	push   %ebx
+  801437:	e8 18 fa ff ff       	call   800e54 <sys_env_set_pgfault_upcall>
+  80143c:	83 c4 10             	add    $0x10,%esp
+  80143f:	85 c0                	test   %eax,%eax
+  801441:	78 6a                	js     8014ad <sfork+0x11a>
+  if ( (error = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+  801443:	83 ec 08             	sub    $0x8,%esp
+  801446:	6a 02                	push   $0x2
+  801448:	53                   	push   %ebx
+  801449:	e8 82 f9 ff ff       	call   800dd0 <sys_env_set_status>
+  80144e:	83 c4 10             	add    $0x10,%esp
+  801451:	85 c0                	test   %eax,%eax
+  801453:	0f 89 65 ff ff ff    	jns    8013be <sfork+0x2b>
+    panic("sys_env_set_status: %e", error);
+  801459:	50                   	push   %eax
+  80145a:	68 83 3d 80 00       	push   $0x803d83
+  80145f:	68 e4 00 00 00       	push   $0xe4
+  801464:	68 ff 3c 80 00       	push   $0x803cff
+  801469:	e8 dc 21 00 00       	call   80364a <_panic>
+    panic("sys_page_map_range: %e", error);
+  80146e:	50                   	push   %eax
+  80146f:	68 6c 3d 80 00       	push   $0x803d6c
+  801474:	68 ce 00 00 00       	push   $0xce
+  801479:	68 ff 3c 80 00       	push   $0x803cff
+  80147e:	e8 c7 21 00 00       	call   80364a <_panic>
+    panic("sys_page_map_range: %e", error);
+  801483:	50                   	push   %eax
+  801484:	68 6c 3d 80 00       	push   $0x803d6c
+  801489:	68 d3 00 00 00       	push   $0xd3
+  80148e:	68 ff 3c 80 00       	push   $0x803cff
+  801493:	e8 b2 21 00 00       	call   80364a <_panic>
+    panic("sys_page_alloc: %e", error);
+  801498:	50                   	push   %eax
+  801499:	68 25 3d 80 00       	push   $0x803d25
+  80149e:	68 da 00 00 00       	push   $0xda
+  8014a3:	68 ff 3c 80 00       	push   $0x803cff
+  8014a8:	e8 9d 21 00 00       	call   80364a <_panic>
+    panic("sys_env_set_pgfault_upcall: %e", error);
+  8014ad:	50                   	push   %eax
+  8014ae:	68 9c 3d 80 00       	push   $0x803d9c
+  8014b3:	68 e0 00 00 00       	push   $0xe0
+  8014b8:	68 ff 3c 80 00       	push   $0x803cff
+  8014bd:	e8 88 21 00 00       	call   80364a <_panic>
+
+008014c2 <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  8014c2:	55                   	push   %ebp
+  8014c3:	89 e5                	mov    %esp,%ebp
+  8014c5:	57                   	push   %edi
+  8014c6:	56                   	push   %esi
+  8014c7:	53                   	push   %ebx
+  8014c8:	83 ec 14             	sub    $0x14,%esp
+  8014cb:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8014ce:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8014d1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014d4:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  8014d7:	85 c0                	test   %eax,%eax
+  8014d9:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8014de:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  8014e1:	ff 33                	push   (%ebx)
+  8014e3:	50                   	push   %eax
+  8014e4:	e8 ce f9 ff ff       	call   800eb7 <sys_ipc_recv>
+  8014e9:	83 c4 10             	add    $0x10,%esp
+  8014ec:	85 c0                	test   %eax,%eax
+  8014ee:	78 39                	js     801529 <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  8014f0:	85 ff                	test   %edi,%edi
+  8014f2:	74 0a                	je     8014fe <ipc_recv_pages+0x3c>
+  8014f4:	a1 a0 58 80 00       	mov    0x8058a0,%eax
+  8014f9:	8b 40 7c             	mov    0x7c(%eax),%eax
+  8014fc:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  8014fe:	85 f6                	test   %esi,%esi
+  801500:	74 0d                	je     80150f <ipc_recv_pages+0x4d>
+  801502:	a1 a0 58 80 00       	mov    0x8058a0,%eax
+  801507:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  80150d:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  80150f:	a1 a0 58 80 00       	mov    0x8058a0,%eax
+  801514:	8b 40 74             	mov    0x74(%eax),%eax
+  801517:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  801519:	a1 a0 58 80 00       	mov    0x8058a0,%eax
+  80151e:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  801521:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801524:	5b                   	pop    %ebx
+  801525:	5e                   	pop    %esi
+  801526:	5f                   	pop    %edi
+  801527:	5d                   	pop    %ebp
+  801528:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  801529:	85 ff                	test   %edi,%edi
+  80152b:	74 06                	je     801533 <ipc_recv_pages+0x71>
+  80152d:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  801533:	85 f6                	test   %esi,%esi
+  801535:	74 06                	je     80153d <ipc_recv_pages+0x7b>
+  801537:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  80153d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  801543:	eb dc                	jmp    801521 <ipc_recv_pages+0x5f>
+
+00801545 <ipc_recv>:
+{
+  801545:	55                   	push   %ebp
+  801546:	89 e5                	mov    %esp,%ebp
+  801548:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  80154b:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  801552:	ff 75 10             	push   0x10(%ebp)
+  801555:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801558:	50                   	push   %eax
+  801559:	ff 75 0c             	push   0xc(%ebp)
+  80155c:	ff 75 08             	push   0x8(%ebp)
+  80155f:	e8 5e ff ff ff       	call   8014c2 <ipc_recv_pages>
+}
+  801564:	c9                   	leave
+  801565:	c3                   	ret
+
+00801566 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  801566:	55                   	push   %ebp
+  801567:	89 e5                	mov    %esp,%ebp
+  801569:	57                   	push   %edi
+  80156a:	56                   	push   %esi
+  80156b:	53                   	push   %ebx
+  80156c:	83 ec 0c             	sub    $0xc,%esp
+  80156f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801572:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801575:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  801578:	89 c3                	mov    %eax,%ebx
+  80157a:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  801580:	85 c0                	test   %eax,%eax
+  801582:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801587:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  80158a:	83 ec 0c             	sub    $0xc,%esp
+  80158d:	ff 75 14             	push   0x14(%ebp)
+  801590:	ff 75 18             	push   0x18(%ebp)
+  801593:	53                   	push   %ebx
+  801594:	56                   	push   %esi
+  801595:	57                   	push   %edi
+  801596:	e8 fb f8 ff ff       	call   800e96 <sys_ipc_try_send>
+  80159b:	83 c4 20             	add    $0x20,%esp
+  80159e:	85 c0                	test   %eax,%eax
+  8015a0:	79 1e                	jns    8015c0 <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  8015a2:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8015a5:	75 07                	jne    8015ae <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  8015a7:	e8 d1 f5 ff ff       	call   800b7d <sys_yield>
+  8015ac:	eb dc                	jmp    80158a <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  8015ae:	50                   	push   %eax
+  8015af:	68 bb 3d 80 00       	push   $0x803dbb
+  8015b4:	6a 5c                	push   $0x5c
+  8015b6:	68 c8 3d 80 00       	push   $0x803dc8
+  8015bb:	e8 8a 20 00 00       	call   80364a <_panic>
+  }
+}
+  8015c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8015c3:	5b                   	pop    %ebx
+  8015c4:	5e                   	pop    %esi
+  8015c5:	5f                   	pop    %edi
+  8015c6:	5d                   	pop    %ebp
+  8015c7:	c3                   	ret
+
+008015c8 <ipc_send>:
+{
+  8015c8:	55                   	push   %ebp
+  8015c9:	89 e5                	mov    %esp,%ebp
+  8015cb:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  8015ce:	ff 75 14             	push   0x14(%ebp)
+  8015d1:	6a 01                	push   $0x1
+  8015d3:	ff 75 10             	push   0x10(%ebp)
+  8015d6:	ff 75 0c             	push   0xc(%ebp)
+  8015d9:	ff 75 08             	push   0x8(%ebp)
+  8015dc:	e8 85 ff ff ff       	call   801566 <ipc_send_pages>
+}
+  8015e1:	83 c4 20             	add    $0x20,%esp
+  8015e4:	c9                   	leave
+  8015e5:	c3                   	ret
+
+008015e6 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8015e6:	55                   	push   %ebp
+  8015e7:	89 e5                	mov    %esp,%ebp
+  8015e9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  8015ec:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  8015f1:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8015f4:	c1 e0 04             	shl    $0x4,%eax
+  8015f7:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8015fc:	8b 40 50             	mov    0x50(%eax),%eax
+  8015ff:	39 c8                	cmp    %ecx,%eax
+  801601:	74 12                	je     801615 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  801603:	83 c2 01             	add    $0x1,%edx
+  801606:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  80160c:	75 e3                	jne    8015f1 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  80160e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801613:	eb 0e                	jmp    801623 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  801615:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  801618:	c1 e0 04             	shl    $0x4,%eax
+  80161b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801620:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  801623:	5d                   	pop    %ebp
+  801624:	c3                   	ret
+
+00801625 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801625:	55                   	push   %ebp
+  801626:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801628:	8b 45 08             	mov    0x8(%ebp),%eax
+  80162b:	05 00 00 00 30       	add    $0x30000000,%eax
+  801630:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801633:	5d                   	pop    %ebp
+  801634:	c3                   	ret
+
+00801635 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801635:	55                   	push   %ebp
+  801636:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801638:	8b 45 08             	mov    0x8(%ebp),%eax
+  80163b:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  80163e:	66 b8 00 00          	mov    $0x0,%ax
+  801642:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801647:	5d                   	pop    %ebp
+  801648:	c3                   	ret
+
+00801649 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801649:	55                   	push   %ebp
+  80164a:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  80164c:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801651:	eb 02                	jmp    801655 <fd_alloc+0xc>
+  801653:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801655:	89 c2                	mov    %eax,%edx
+  801657:	c1 ea 16             	shr    $0x16,%edx
+  80165a:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801661:	f6 c2 01             	test   $0x1,%dl
+  801664:	74 2b                	je     801691 <fd_alloc+0x48>
+  801666:	89 c2                	mov    %eax,%edx
+  801668:	c1 ea 0c             	shr    $0xc,%edx
+  80166b:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801672:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801678:	f6 c1 01             	test   $0x1,%cl
+  80167b:	74 14                	je     801691 <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  80167d:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801683:	75 ce                	jne    801653 <fd_alloc+0xa>
+  801685:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  80168a:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80168f:	eb 05                	jmp    801696 <fd_alloc+0x4d>
+      return 0;
+  801691:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  801696:	8b 55 08             	mov    0x8(%ebp),%edx
+  801699:	89 02                	mov    %eax,(%edx)
+}
+  80169b:	89 c8                	mov    %ecx,%eax
+  80169d:	5d                   	pop    %ebp
+  80169e:	c3                   	ret
+
+0080169f <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80169f:	55                   	push   %ebp
+  8016a0:	89 e5                	mov    %esp,%ebp
+  8016a2:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  8016a5:	83 f8 1f             	cmp    $0x1f,%eax
+  8016a8:	77 30                	ja     8016da <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  8016aa:	c1 e0 0c             	shl    $0xc,%eax
+  8016ad:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8016b2:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8016b8:	f6 c2 01             	test   $0x1,%dl
+  8016bb:	74 24                	je     8016e1 <fd_lookup+0x42>
+  8016bd:	89 c2                	mov    %eax,%edx
+  8016bf:	c1 ea 0c             	shr    $0xc,%edx
+  8016c2:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8016c9:	f6 c2 01             	test   $0x1,%dl
+  8016cc:	74 1a                	je     8016e8 <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  8016ce:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8016d1:	89 02                	mov    %eax,(%edx)
+  return 0;
+  8016d3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8016d8:	5d                   	pop    %ebp
+  8016d9:	c3                   	ret
+    return -E_INVAL;
+  8016da:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016df:	eb f7                	jmp    8016d8 <fd_lookup+0x39>
+    return -E_INVAL;
+  8016e1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016e6:	eb f0                	jmp    8016d8 <fd_lookup+0x39>
+  8016e8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016ed:	eb e9                	jmp    8016d8 <fd_lookup+0x39>
+
+008016ef <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8016ef:	55                   	push   %ebp
+  8016f0:	89 e5                	mov    %esp,%ebp
+  8016f2:	53                   	push   %ebx
+  8016f3:	83 ec 04             	sub    $0x4,%esp
+  8016f6:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  8016f9:	b8 50 3e 80 00       	mov    $0x803e50,%eax
+  8016fe:	8b 18                	mov    (%eax),%ebx
+  801700:	85 db                	test   %ebx,%ebx
+  801702:	74 0e                	je     801712 <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  801704:	83 c0 04             	add    $0x4,%eax
+  801707:	39 13                	cmp    %edx,(%ebx)
+  801709:	75 f3                	jne    8016fe <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  80170b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801710:	eb 1f                	jmp    801731 <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801712:	a1 a0 58 80 00       	mov    0x8058a0,%eax
+  801717:	8b 40 48             	mov    0x48(%eax),%eax
+  80171a:	83 ec 04             	sub    $0x4,%esp
+  80171d:	52                   	push   %edx
+  80171e:	50                   	push   %eax
+  80171f:	68 d4 3d 80 00       	push   $0x803dd4
+  801724:	e8 99 ea ff ff       	call   8001c2 <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  801729:	83 c4 10             	add    $0x10,%esp
+  80172c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  801731:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801734:	89 1a                	mov    %ebx,(%edx)
+}
+  801736:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801739:	c9                   	leave
+  80173a:	c3                   	ret
+
+0080173b <fd_close>:
+{
+  80173b:	55                   	push   %ebp
+  80173c:	89 e5                	mov    %esp,%ebp
+  80173e:	57                   	push   %edi
+  80173f:	56                   	push   %esi
+  801740:	53                   	push   %ebx
+  801741:	83 ec 24             	sub    $0x24,%esp
+  801744:	8b 75 08             	mov    0x8(%ebp),%esi
+  801747:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80174a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80174d:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80174e:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801754:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801757:	50                   	push   %eax
+  801758:	e8 42 ff ff ff       	call   80169f <fd_lookup>
+  80175d:	89 c3                	mov    %eax,%ebx
+  80175f:	83 c4 10             	add    $0x10,%esp
+  801762:	85 c0                	test   %eax,%eax
+  801764:	78 05                	js     80176b <fd_close+0x30>
+      || fd != fd2)
+  801766:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801769:	74 16                	je     801781 <fd_close+0x46>
+    return must_exist ? r : 0;
+  80176b:	89 f8                	mov    %edi,%eax
+  80176d:	84 c0                	test   %al,%al
+  80176f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801774:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801777:	89 d8                	mov    %ebx,%eax
+  801779:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80177c:	5b                   	pop    %ebx
+  80177d:	5e                   	pop    %esi
+  80177e:	5f                   	pop    %edi
+  80177f:	5d                   	pop    %ebp
+  801780:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801781:	83 ec 08             	sub    $0x8,%esp
+  801784:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801787:	50                   	push   %eax
+  801788:	ff 36                	push   (%esi)
+  80178a:	e8 60 ff ff ff       	call   8016ef <dev_lookup>
+  80178f:	89 c3                	mov    %eax,%ebx
+  801791:	83 c4 10             	add    $0x10,%esp
+  801794:	85 c0                	test   %eax,%eax
+  801796:	78 1a                	js     8017b2 <fd_close+0x77>
+    if (dev->dev_close)
+  801798:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80179b:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  80179e:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  8017a3:	85 c0                	test   %eax,%eax
+  8017a5:	74 0b                	je     8017b2 <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  8017a7:	83 ec 0c             	sub    $0xc,%esp
+  8017aa:	56                   	push   %esi
+  8017ab:	ff d0                	call   *%eax
+  8017ad:	89 c3                	mov    %eax,%ebx
+  8017af:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  8017b2:	83 ec 08             	sub    $0x8,%esp
+  8017b5:	56                   	push   %esi
+  8017b6:	6a 00                	push   $0x0
+  8017b8:	e8 a7 f4 ff ff       	call   800c64 <sys_page_unmap>
+  return r;
+  8017bd:	83 c4 10             	add    $0x10,%esp
+  8017c0:	eb b5                	jmp    801777 <fd_close+0x3c>
+
+008017c2 <close>:
+
+int
+close(int fdnum)
+{
+  8017c2:	55                   	push   %ebp
+  8017c3:	89 e5                	mov    %esp,%ebp
+  8017c5:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8017c8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017cb:	50                   	push   %eax
+  8017cc:	ff 75 08             	push   0x8(%ebp)
+  8017cf:	e8 cb fe ff ff       	call   80169f <fd_lookup>
+  8017d4:	83 c4 10             	add    $0x10,%esp
+  8017d7:	85 c0                	test   %eax,%eax
+  8017d9:	79 02                	jns    8017dd <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  8017db:	c9                   	leave
+  8017dc:	c3                   	ret
+    return fd_close(fd, 1);
+  8017dd:	83 ec 08             	sub    $0x8,%esp
+  8017e0:	6a 01                	push   $0x1
+  8017e2:	ff 75 f4             	push   -0xc(%ebp)
+  8017e5:	e8 51 ff ff ff       	call   80173b <fd_close>
+  8017ea:	83 c4 10             	add    $0x10,%esp
+  8017ed:	eb ec                	jmp    8017db <close+0x19>
+
+008017ef <close_all>:
+
+void
+close_all(void)
+{
+  8017ef:	55                   	push   %ebp
+  8017f0:	89 e5                	mov    %esp,%ebp
+  8017f2:	53                   	push   %ebx
+  8017f3:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  8017f6:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  8017fb:	83 ec 0c             	sub    $0xc,%esp
+  8017fe:	53                   	push   %ebx
+  8017ff:	e8 be ff ff ff       	call   8017c2 <close>
+  for (i = 0; i < MAXFD; i++)
+  801804:	83 c3 01             	add    $0x1,%ebx
+  801807:	83 c4 10             	add    $0x10,%esp
+  80180a:	83 fb 20             	cmp    $0x20,%ebx
+  80180d:	75 ec                	jne    8017fb <close_all+0xc>
+}
+  80180f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801812:	c9                   	leave
+  801813:	c3                   	ret
+
+00801814 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801814:	55                   	push   %ebp
+  801815:	89 e5                	mov    %esp,%ebp
+  801817:	57                   	push   %edi
+  801818:	56                   	push   %esi
+  801819:	53                   	push   %ebx
+  80181a:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80181d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801820:	50                   	push   %eax
+  801821:	ff 75 08             	push   0x8(%ebp)
+  801824:	e8 76 fe ff ff       	call   80169f <fd_lookup>
+  801829:	89 c6                	mov    %eax,%esi
+  80182b:	83 c4 10             	add    $0x10,%esp
+  80182e:	85 c0                	test   %eax,%eax
+  801830:	0f 88 0a 01 00 00    	js     801940 <dup+0x12c>
+    return r;
+  close(newfdnum);
+  801836:	83 ec 0c             	sub    $0xc,%esp
+  801839:	ff 75 0c             	push   0xc(%ebp)
+  80183c:	e8 81 ff ff ff       	call   8017c2 <close>
+
+  newfd = INDEX2FD(newfdnum);
+  801841:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801844:	c1 e0 0c             	shl    $0xc,%eax
+  801847:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  80184d:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  801850:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801853:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  801856:	89 04 24             	mov    %eax,(%esp)
+  801859:	e8 d7 fd ff ff       	call   801635 <fd2data>
+  80185e:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  801860:	89 3c 24             	mov    %edi,(%esp)
+  801863:	e8 cd fd ff ff       	call   801635 <fd2data>
+  801868:	83 c4 10             	add    $0x10,%esp
+  80186b:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80186e:	89 f3                	mov    %esi,%ebx
+  801870:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  801876:	89 c6                	mov    %eax,%esi
+  801878:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80187b:	89 cf                	mov    %ecx,%edi
+  80187d:	eb 0c                	jmp    80188b <dup+0x77>
+  80187f:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801885:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80188b:	39 fb                	cmp    %edi,%ebx
+  80188d:	74 7b                	je     80190a <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  80188f:	89 d8                	mov    %ebx,%eax
+  801891:	c1 e8 16             	shr    $0x16,%eax
+  801894:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80189b:	a8 01                	test   $0x1,%al
+  80189d:	74 e0                	je     80187f <dup+0x6b>
+  80189f:	89 d8                	mov    %ebx,%eax
+  8018a1:	c1 e8 0c             	shr    $0xc,%eax
+  8018a4:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8018ab:	f6 c2 01             	test   $0x1,%dl
+  8018ae:	74 cf                	je     80187f <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  8018b0:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  8018b7:	83 ec 0c             	sub    $0xc,%esp
+  8018ba:	25 07 0e 00 00       	and    $0xe07,%eax
+  8018bf:	50                   	push   %eax
+  8018c0:	56                   	push   %esi
+  8018c1:	6a 00                	push   $0x0
+  8018c3:	53                   	push   %ebx
+  8018c4:	6a 00                	push   $0x0
+  8018c6:	e8 57 f3 ff ff       	call   800c22 <sys_page_map>
+  8018cb:	83 c4 20             	add    $0x20,%esp
+  8018ce:	85 c0                	test   %eax,%eax
+  8018d0:	79 ad                	jns    80187f <dup+0x6b>
+  8018d2:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8018d5:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  8018d7:	83 ec 08             	sub    $0x8,%esp
+  8018da:	ff 75 d4             	push   -0x2c(%ebp)
+  8018dd:	6a 00                	push   $0x0
+  8018df:	e8 80 f3 ff ff       	call   800c64 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8018e4:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  8018e7:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  8018ed:	83 c4 10             	add    $0x10,%esp
+  8018f0:	39 df                	cmp    %ebx,%edi
+  8018f2:	74 4c                	je     801940 <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  8018f4:	83 ec 08             	sub    $0x8,%esp
+  8018f7:	57                   	push   %edi
+  8018f8:	6a 00                	push   $0x0
+  8018fa:	e8 65 f3 ff ff       	call   800c64 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8018ff:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  801905:	83 c4 10             	add    $0x10,%esp
+  801908:	eb e6                	jmp    8018f0 <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80190a:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80190d:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  801910:	89 c8                	mov    %ecx,%eax
+  801912:	c1 e8 0c             	shr    $0xc,%eax
+  801915:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80191c:	83 ec 0c             	sub    $0xc,%esp
+  80191f:	25 07 0e 00 00       	and    $0xe07,%eax
+  801924:	50                   	push   %eax
+  801925:	ff 75 d4             	push   -0x2c(%ebp)
+  801928:	6a 00                	push   $0x0
+  80192a:	51                   	push   %ecx
+  80192b:	6a 00                	push   $0x0
+  80192d:	e8 f0 f2 ff ff       	call   800c22 <sys_page_map>
+  801932:	89 c6                	mov    %eax,%esi
+  801934:	83 c4 20             	add    $0x20,%esp
+  801937:	85 c0                	test   %eax,%eax
+  801939:	78 9c                	js     8018d7 <dup+0xc3>
+  return newfdnum;
+  80193b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80193e:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  801940:	89 f0                	mov    %esi,%eax
+  801942:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801945:	5b                   	pop    %ebx
+  801946:	5e                   	pop    %esi
+  801947:	5f                   	pop    %edi
+  801948:	5d                   	pop    %ebp
+  801949:	c3                   	ret
+
+0080194a <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80194a:	55                   	push   %ebp
+  80194b:	89 e5                	mov    %esp,%ebp
+  80194d:	56                   	push   %esi
+  80194e:	53                   	push   %ebx
+  80194f:	83 ec 18             	sub    $0x18,%esp
+  801952:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801955:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801958:	50                   	push   %eax
+  801959:	56                   	push   %esi
+  80195a:	e8 40 fd ff ff       	call   80169f <fd_lookup>
+  80195f:	83 c4 10             	add    $0x10,%esp
+  801962:	85 c0                	test   %eax,%eax
+  801964:	78 3c                	js     8019a2 <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801966:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801969:	83 ec 08             	sub    $0x8,%esp
+  80196c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80196f:	50                   	push   %eax
+  801970:	ff 33                	push   (%ebx)
+  801972:	e8 78 fd ff ff       	call   8016ef <dev_lookup>
+  801977:	83 c4 10             	add    $0x10,%esp
+  80197a:	85 c0                	test   %eax,%eax
+  80197c:	78 24                	js     8019a2 <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80197e:	8b 43 08             	mov    0x8(%ebx),%eax
+  801981:	83 e0 03             	and    $0x3,%eax
+  801984:	83 f8 01             	cmp    $0x1,%eax
+  801987:	74 20                	je     8019a9 <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  801989:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80198c:	8b 40 08             	mov    0x8(%eax),%eax
+  80198f:	85 c0                	test   %eax,%eax
+  801991:	74 37                	je     8019ca <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  801993:	83 ec 04             	sub    $0x4,%esp
+  801996:	ff 75 10             	push   0x10(%ebp)
+  801999:	ff 75 0c             	push   0xc(%ebp)
+  80199c:	53                   	push   %ebx
+  80199d:	ff d0                	call   *%eax
+  80199f:	83 c4 10             	add    $0x10,%esp
+}
+  8019a2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019a5:	5b                   	pop    %ebx
+  8019a6:	5e                   	pop    %esi
+  8019a7:	5d                   	pop    %ebp
+  8019a8:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8019a9:	a1 a0 58 80 00       	mov    0x8058a0,%eax
+  8019ae:	8b 40 48             	mov    0x48(%eax),%eax
+  8019b1:	83 ec 04             	sub    $0x4,%esp
+  8019b4:	56                   	push   %esi
+  8019b5:	50                   	push   %eax
+  8019b6:	68 15 3e 80 00       	push   $0x803e15
+  8019bb:	e8 02 e8 ff ff       	call   8001c2 <cprintf>
+    return -E_INVAL;
+  8019c0:	83 c4 10             	add    $0x10,%esp
+  8019c3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019c8:	eb d8                	jmp    8019a2 <read+0x58>
+    return -E_NOT_SUPP;
+  8019ca:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8019cf:	eb d1                	jmp    8019a2 <read+0x58>
+
+008019d1 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8019d1:	55                   	push   %ebp
+  8019d2:	89 e5                	mov    %esp,%ebp
+  8019d4:	57                   	push   %edi
+  8019d5:	56                   	push   %esi
+  8019d6:	53                   	push   %ebx
+  8019d7:	83 ec 0c             	sub    $0xc,%esp
+  8019da:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8019dd:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  8019e0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019e5:	eb 02                	jmp    8019e9 <readn+0x18>
+  8019e7:	01 c3                	add    %eax,%ebx
+  8019e9:	39 f3                	cmp    %esi,%ebx
+  8019eb:	73 21                	jae    801a0e <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  8019ed:	83 ec 04             	sub    $0x4,%esp
+  8019f0:	89 f0                	mov    %esi,%eax
+  8019f2:	29 d8                	sub    %ebx,%eax
+  8019f4:	50                   	push   %eax
+  8019f5:	89 d8                	mov    %ebx,%eax
+  8019f7:	03 45 0c             	add    0xc(%ebp),%eax
+  8019fa:	50                   	push   %eax
+  8019fb:	57                   	push   %edi
+  8019fc:	e8 49 ff ff ff       	call   80194a <read>
+    if (m < 0)
+  801a01:	83 c4 10             	add    $0x10,%esp
+  801a04:	85 c0                	test   %eax,%eax
+  801a06:	78 04                	js     801a0c <readn+0x3b>
+      return m;
+    if (m == 0)
+  801a08:	75 dd                	jne    8019e7 <readn+0x16>
+  801a0a:	eb 02                	jmp    801a0e <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  801a0c:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  801a0e:	89 d8                	mov    %ebx,%eax
+  801a10:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a13:	5b                   	pop    %ebx
+  801a14:	5e                   	pop    %esi
+  801a15:	5f                   	pop    %edi
+  801a16:	5d                   	pop    %ebp
+  801a17:	c3                   	ret
+
+00801a18 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801a18:	55                   	push   %ebp
+  801a19:	89 e5                	mov    %esp,%ebp
+  801a1b:	56                   	push   %esi
+  801a1c:	53                   	push   %ebx
+  801a1d:	83 ec 18             	sub    $0x18,%esp
+  801a20:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a23:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a26:	50                   	push   %eax
+  801a27:	53                   	push   %ebx
+  801a28:	e8 72 fc ff ff       	call   80169f <fd_lookup>
+  801a2d:	83 c4 10             	add    $0x10,%esp
+  801a30:	85 c0                	test   %eax,%eax
+  801a32:	78 37                	js     801a6b <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801a34:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801a37:	83 ec 08             	sub    $0x8,%esp
+  801a3a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a3d:	50                   	push   %eax
+  801a3e:	ff 36                	push   (%esi)
+  801a40:	e8 aa fc ff ff       	call   8016ef <dev_lookup>
+  801a45:	83 c4 10             	add    $0x10,%esp
+  801a48:	85 c0                	test   %eax,%eax
+  801a4a:	78 1f                	js     801a6b <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801a4c:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801a50:	74 20                	je     801a72 <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  801a52:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a55:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a58:	85 c0                	test   %eax,%eax
+  801a5a:	74 37                	je     801a93 <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  801a5c:	83 ec 04             	sub    $0x4,%esp
+  801a5f:	ff 75 10             	push   0x10(%ebp)
+  801a62:	ff 75 0c             	push   0xc(%ebp)
+  801a65:	56                   	push   %esi
+  801a66:	ff d0                	call   *%eax
+  801a68:	83 c4 10             	add    $0x10,%esp
+}
+  801a6b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a6e:	5b                   	pop    %ebx
+  801a6f:	5e                   	pop    %esi
+  801a70:	5d                   	pop    %ebp
+  801a71:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801a72:	a1 a0 58 80 00       	mov    0x8058a0,%eax
+  801a77:	8b 40 48             	mov    0x48(%eax),%eax
+  801a7a:	83 ec 04             	sub    $0x4,%esp
+  801a7d:	53                   	push   %ebx
+  801a7e:	50                   	push   %eax
+  801a7f:	68 31 3e 80 00       	push   $0x803e31
+  801a84:	e8 39 e7 ff ff       	call   8001c2 <cprintf>
+    return -E_INVAL;
+  801a89:	83 c4 10             	add    $0x10,%esp
+  801a8c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a91:	eb d8                	jmp    801a6b <write+0x53>
+    return -E_NOT_SUPP;
+  801a93:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a98:	eb d1                	jmp    801a6b <write+0x53>
+
+00801a9a <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801a9a:	55                   	push   %ebp
+  801a9b:	89 e5                	mov    %esp,%ebp
+  801a9d:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801aa0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801aa3:	50                   	push   %eax
+  801aa4:	ff 75 08             	push   0x8(%ebp)
+  801aa7:	e8 f3 fb ff ff       	call   80169f <fd_lookup>
+  801aac:	83 c4 10             	add    $0x10,%esp
+  801aaf:	85 c0                	test   %eax,%eax
+  801ab1:	78 0e                	js     801ac1 <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  801ab3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801ab6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ab9:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  801abc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ac1:	c9                   	leave
+  801ac2:	c3                   	ret
+
+00801ac3 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801ac3:	55                   	push   %ebp
+  801ac4:	89 e5                	mov    %esp,%ebp
+  801ac6:	56                   	push   %esi
+  801ac7:	53                   	push   %ebx
+  801ac8:	83 ec 18             	sub    $0x18,%esp
+  801acb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801ace:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ad1:	50                   	push   %eax
+  801ad2:	53                   	push   %ebx
+  801ad3:	e8 c7 fb ff ff       	call   80169f <fd_lookup>
+  801ad8:	83 c4 10             	add    $0x10,%esp
+  801adb:	85 c0                	test   %eax,%eax
+  801add:	78 34                	js     801b13 <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801adf:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801ae2:	83 ec 08             	sub    $0x8,%esp
+  801ae5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ae8:	50                   	push   %eax
+  801ae9:	ff 36                	push   (%esi)
+  801aeb:	e8 ff fb ff ff       	call   8016ef <dev_lookup>
+  801af0:	83 c4 10             	add    $0x10,%esp
+  801af3:	85 c0                	test   %eax,%eax
+  801af5:	78 1c                	js     801b13 <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801af7:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801afb:	74 1d                	je     801b1a <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  801afd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b00:	8b 40 18             	mov    0x18(%eax),%eax
+  801b03:	85 c0                	test   %eax,%eax
+  801b05:	74 34                	je     801b3b <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  801b07:	83 ec 08             	sub    $0x8,%esp
+  801b0a:	ff 75 0c             	push   0xc(%ebp)
+  801b0d:	56                   	push   %esi
+  801b0e:	ff d0                	call   *%eax
+  801b10:	83 c4 10             	add    $0x10,%esp
+}
+  801b13:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b16:	5b                   	pop    %ebx
+  801b17:	5e                   	pop    %esi
+  801b18:	5d                   	pop    %ebp
+  801b19:	c3                   	ret
+            thisenv->env_id, fdnum);
+  801b1a:	a1 a0 58 80 00       	mov    0x8058a0,%eax
+  801b1f:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801b22:	83 ec 04             	sub    $0x4,%esp
+  801b25:	53                   	push   %ebx
+  801b26:	50                   	push   %eax
+  801b27:	68 f4 3d 80 00       	push   $0x803df4
+  801b2c:	e8 91 e6 ff ff       	call   8001c2 <cprintf>
+    return -E_INVAL;
+  801b31:	83 c4 10             	add    $0x10,%esp
+  801b34:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b39:	eb d8                	jmp    801b13 <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  801b3b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b40:	eb d1                	jmp    801b13 <ftruncate+0x50>
+
+00801b42 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801b42:	55                   	push   %ebp
+  801b43:	89 e5                	mov    %esp,%ebp
+  801b45:	56                   	push   %esi
+  801b46:	53                   	push   %ebx
+  801b47:	83 ec 18             	sub    $0x18,%esp
+  801b4a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801b4d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b50:	50                   	push   %eax
+  801b51:	ff 75 08             	push   0x8(%ebp)
+  801b54:	e8 46 fb ff ff       	call   80169f <fd_lookup>
+  801b59:	83 c4 10             	add    $0x10,%esp
+  801b5c:	85 c0                	test   %eax,%eax
+  801b5e:	78 49                	js     801ba9 <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801b60:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b63:	83 ec 08             	sub    $0x8,%esp
+  801b66:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b69:	50                   	push   %eax
+  801b6a:	ff 36                	push   (%esi)
+  801b6c:	e8 7e fb ff ff       	call   8016ef <dev_lookup>
+  801b71:	83 c4 10             	add    $0x10,%esp
+  801b74:	85 c0                	test   %eax,%eax
+  801b76:	78 31                	js     801ba9 <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  801b78:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b7b:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801b7f:	74 2f                	je     801bb0 <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  801b81:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  801b84:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801b8b:	00 00 00 
+  stat->st_isdir = 0;
+  801b8e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801b95:	00 00 00 
+  stat->st_dev = dev;
+  801b98:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  801b9e:	83 ec 08             	sub    $0x8,%esp
+  801ba1:	53                   	push   %ebx
+  801ba2:	56                   	push   %esi
+  801ba3:	ff 50 14             	call   *0x14(%eax)
+  801ba6:	83 c4 10             	add    $0x10,%esp
+}
+  801ba9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bac:	5b                   	pop    %ebx
+  801bad:	5e                   	pop    %esi
+  801bae:	5d                   	pop    %ebp
+  801baf:	c3                   	ret
+    return -E_NOT_SUPP;
+  801bb0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801bb5:	eb f2                	jmp    801ba9 <fstat+0x67>
+
+00801bb7 <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  801bb7:	55                   	push   %ebp
+  801bb8:	89 e5                	mov    %esp,%ebp
+  801bba:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  801bbd:	ff 75 0c             	push   0xc(%ebp)
+  801bc0:	ff 75 08             	push   0x8(%ebp)
+  801bc3:	e8 58 07 00 00       	call   802320 <file_stat>
+}
+  801bc8:	c9                   	leave
+  801bc9:	c3                   	ret
+
+00801bca <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  801bca:	55                   	push   %ebp
+  801bcb:	89 e5                	mov    %esp,%ebp
+  801bcd:	57                   	push   %edi
+  801bce:	56                   	push   %esi
+  801bcf:	53                   	push   %ebx
+  801bd0:	83 ec 1c             	sub    $0x1c,%esp
+  801bd3:	89 c7                	mov    %eax,%edi
+  801bd5:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801bd8:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801bdb:	e9 a2 00 00 00       	jmp    801c82 <fsipc_send+0xb8>
+  nfsenvs = 0;
+  801be0:	c7 05 00 50 80 00 00 	movl   $0x0,0x805000
+  801be7:	00 00 00 
+  801bea:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bef:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801bf4:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801bf9:	be 01 00 00 00       	mov    $0x1,%esi
+  801bfe:	eb 0f                	jmp    801c0f <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801c00:	83 c0 01             	add    $0x1,%eax
+  801c03:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801c08:	74 49                	je     801c53 <fsipc_send+0x89>
+  801c0a:	83 f9 07             	cmp    $0x7,%ecx
+  801c0d:	7f 50                	jg     801c5f <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  801c0f:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801c12:	c1 e2 04             	shl    $0x4,%edx
+  801c15:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801c1b:	8b 52 50             	mov    0x50(%edx),%edx
+  801c1e:	83 fa 01             	cmp    $0x1,%edx
+  801c21:	75 dd                	jne    801c00 <fsipc_send+0x36>
+  801c23:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801c26:	c1 e2 04             	shl    $0x4,%edx
+  801c29:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801c2f:	8b 52 54             	mov    0x54(%edx),%edx
+  801c32:	85 d2                	test   %edx,%edx
+  801c34:	74 ca                	je     801c00 <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801c36:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801c39:	c1 e2 04             	shl    $0x4,%edx
+  801c3c:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801c42:	8b 52 48             	mov    0x48(%edx),%edx
+  801c45:	89 14 8d 20 50 80 00 	mov    %edx,0x805020(,%ecx,4)
+  801c4c:	8d 49 01             	lea    0x1(%ecx),%ecx
+  801c4f:	89 f3                	mov    %esi,%ebx
+  801c51:	eb ad                	jmp    801c00 <fsipc_send+0x36>
+  801c53:	84 db                	test   %bl,%bl
+  801c55:	74 38                	je     801c8f <fsipc_send+0xc5>
+  801c57:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  801c5d:	eb 30                	jmp    801c8f <fsipc_send+0xc5>
+  801c5f:	84 db                	test   %bl,%bl
+  801c61:	74 2c                	je     801c8f <fsipc_send+0xc5>
+  801c63:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  801c69:	eb 24                	jmp    801c8f <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  801c6b:	50                   	push   %eax
+  801c6c:	68 60 3e 80 00       	push   $0x803e60
+  801c71:	6a 34                	push   $0x34
+  801c73:	68 6a 3e 80 00       	push   $0x803e6a
+  801c78:	e8 cd 19 00 00       	call   80364a <_panic>
+    }
+    sys_yield();
+  801c7d:	e8 fb ee ff ff       	call   800b7d <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  801c82:	83 3d 00 50 80 00 03 	cmpl   $0x3,0x805000
+  801c89:	0f 8e 51 ff ff ff    	jle    801be0 <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  801c8f:	a1 a0 58 80 00       	mov    0x8058a0,%eax
+  801c94:	8b 70 48             	mov    0x48(%eax),%esi
+  801c97:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  801c9d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ca2:	8b 0d 00 50 80 00    	mov    0x805000,%ecx
+  801ca8:	39 d9                	cmp    %ebx,%ecx
+  801caa:	7e d1                	jle    801c7d <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  801cac:	83 ec 0c             	sub    $0xc,%esp
+  801caf:	ff 75 e0             	push   -0x20(%ebp)
+  801cb2:	6a 07                	push   $0x7
+  801cb4:	ff 75 e4             	push   -0x1c(%ebp)
+  801cb7:	57                   	push   %edi
+  801cb8:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  801cbb:	99                   	cltd
+  801cbc:	f7 f9                	idiv   %ecx
+  801cbe:	ff 34 95 20 50 80 00 	push   0x805020(,%edx,4)
+  801cc5:	e8 cc f1 ff ff       	call   800e96 <sys_ipc_try_send>
+      if (r == 0)
+  801cca:	83 c4 20             	add    $0x20,%esp
+  801ccd:	85 c0                	test   %eax,%eax
+  801ccf:	74 0a                	je     801cdb <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  801cd1:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801cd4:	75 95                	jne    801c6b <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  801cd6:	83 c3 01             	add    $0x1,%ebx
+  801cd9:	eb c7                	jmp    801ca2 <fsipc_send+0xd8>
+  }
+}
+  801cdb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cde:	5b                   	pop    %ebx
+  801cdf:	5e                   	pop    %esi
+  801ce0:	5f                   	pop    %edi
+  801ce1:	5d                   	pop    %ebp
+  801ce2:	c3                   	ret
+
+00801ce3 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801ce3:	55                   	push   %ebp
+  801ce4:	89 e5                	mov    %esp,%ebp
+  801ce6:	53                   	push   %ebx
+  801ce7:	83 ec 14             	sub    $0x14,%esp
+  801cea:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  801cec:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  801cf3:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801cf8:	ba 00 60 80 00       	mov    $0x806000,%edx
+  801cfd:	e8 c8 fe ff ff       	call   801bca <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801d02:	6a 00                	push   $0x0
+  801d04:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d07:	50                   	push   %eax
+  801d08:	53                   	push   %ebx
+  801d09:	6a 00                	push   $0x0
+  801d0b:	e8 b2 f7 ff ff       	call   8014c2 <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  801d10:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d13:	c9                   	leave
+  801d14:	c3                   	ret
+
+00801d15 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801d15:	55                   	push   %ebp
+  801d16:	89 e5                	mov    %esp,%ebp
+  801d18:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801d1b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d1e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d21:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.set_size.req_size = newsize;
+  801d26:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d29:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801d2e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d33:	b8 02 00 00 00       	mov    $0x2,%eax
+  801d38:	e8 a6 ff ff ff       	call   801ce3 <fsipc>
+}
+  801d3d:	c9                   	leave
+  801d3e:	c3                   	ret
+
+00801d3f <devfile_flush>:
+{
+  801d3f:	55                   	push   %ebp
+  801d40:	89 e5                	mov    %esp,%ebp
+  801d42:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801d45:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d48:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d4b:	a3 00 60 80 00       	mov    %eax,0x806000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801d50:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d55:	b8 06 00 00 00       	mov    $0x6,%eax
+  801d5a:	e8 84 ff ff ff       	call   801ce3 <fsipc>
+}
+  801d5f:	c9                   	leave
+  801d60:	c3                   	ret
+
+00801d61 <devfile_stat>:
+{
+  801d61:	55                   	push   %ebp
+  801d62:	89 e5                	mov    %esp,%ebp
+  801d64:	53                   	push   %ebx
+  801d65:	83 ec 04             	sub    $0x4,%esp
+  801d68:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801d6b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d6e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d71:	a3 00 60 80 00       	mov    %eax,0x806000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801d76:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d7b:	b8 05 00 00 00       	mov    $0x5,%eax
+  801d80:	e8 5e ff ff ff       	call   801ce3 <fsipc>
+  801d85:	85 c0                	test   %eax,%eax
+  801d87:	78 2c                	js     801db5 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801d89:	83 ec 08             	sub    $0x8,%esp
+  801d8c:	68 00 60 80 00       	push   $0x806000
+  801d91:	53                   	push   %ebx
+  801d92:	e8 19 ea ff ff       	call   8007b0 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  801d97:	a1 80 60 80 00       	mov    0x806080,%eax
+  801d9c:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801da2:	a1 84 60 80 00       	mov    0x806084,%eax
+  801da7:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801dad:	83 c4 10             	add    $0x10,%esp
+  801db0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801db5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801db8:	c9                   	leave
+  801db9:	c3                   	ret
+
+00801dba <fsv_alloc>:
+{
+  801dba:	55                   	push   %ebp
+  801dbb:	89 e5                	mov    %esp,%ebp
+  801dbd:	56                   	push   %esi
+  801dbe:	53                   	push   %ebx
+  801dbf:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  801dc1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801dc6:	eb 22                	jmp    801dea <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  801dc8:	83 ec 04             	sub    $0x4,%esp
+  801dcb:	6a 00                	push   $0x0
+  801dcd:	6a 00                	push   $0x0
+  801dcf:	6a 07                	push   $0x7
+  801dd1:	50                   	push   %eax
+  801dd2:	6a 00                	push   $0x0
+  801dd4:	6a 04                	push   $0x4
+  801dd6:	68 40 50 80 00       	push   $0x805040
+  801ddb:	e8 52 f2 ff ff       	call   801032 <sysbatch_add>
+  801de0:	83 c4 20             	add    $0x20,%esp
+  801de3:	85 c0                	test   %eax,%eax
+  801de5:	78 48                	js     801e2f <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  801de7:	83 c3 01             	add    $0x1,%ebx
+  801dea:	39 f3                	cmp    %esi,%ebx
+  801dec:	74 31                	je     801e1f <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  801dee:	89 d8                	mov    %ebx,%eax
+  801df0:	c1 e0 0c             	shl    $0xc,%eax
+  801df3:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801df8:	89 c2                	mov    %eax,%edx
+  801dfa:	c1 ea 16             	shr    $0x16,%edx
+  801dfd:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801e04:	f6 c2 01             	test   $0x1,%dl
+  801e07:	74 bf                	je     801dc8 <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  801e09:	89 c2                	mov    %eax,%edx
+  801e0b:	c1 ea 0c             	shr    $0xc,%edx
+  801e0e:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801e15:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801e18:	83 fa 03             	cmp    $0x3,%edx
+  801e1b:	75 ab                	jne    801dc8 <fsv_alloc+0xe>
+  801e1d:	eb c8                	jmp    801de7 <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  801e1f:	83 ec 0c             	sub    $0xc,%esp
+  801e22:	68 40 50 80 00       	push   $0x805040
+  801e27:	e8 b6 f1 ff ff       	call   800fe2 <sysbatch_flush>
+  801e2c:	83 c4 10             	add    $0x10,%esp
+}
+  801e2f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e32:	5b                   	pop    %ebx
+  801e33:	5e                   	pop    %esi
+  801e34:	5d                   	pop    %ebp
+  801e35:	c3                   	ret
+
+00801e36 <devfile_read>:
+{
+  801e36:	55                   	push   %ebp
+  801e37:	89 e5                	mov    %esp,%ebp
+  801e39:	57                   	push   %edi
+  801e3a:	56                   	push   %esi
+  801e3b:	53                   	push   %ebx
+  801e3c:	83 ec 3c             	sub    $0x3c,%esp
+  801e3f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  801e42:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  801e48:	77 57                	ja     801ea1 <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801e4a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e4d:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e50:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read.req_n = n;
+  801e55:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801e5b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e60:	b8 03 00 00 00       	mov    $0x3,%eax
+  801e65:	e8 79 fe ff ff       	call   801ce3 <fsipc>
+  801e6a:	89 c6                	mov    %eax,%esi
+  801e6c:	85 c0                	test   %eax,%eax
+  801e6e:	78 27                	js     801e97 <devfile_read+0x61>
+  assert(r <= n);
+  801e70:	39 c3                	cmp    %eax,%ebx
+  801e72:	0f 82 0e 02 00 00    	jb     802086 <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  801e78:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801e7d:	0f 8f 1c 02 00 00    	jg     80209f <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801e83:	83 ec 04             	sub    $0x4,%esp
+  801e86:	50                   	push   %eax
+  801e87:	68 00 60 80 00       	push   $0x806000
+  801e8c:	ff 75 0c             	push   0xc(%ebp)
+  801e8f:	e8 a2 ea ff ff       	call   800936 <memmove>
+  return r;
+  801e94:	83 c4 10             	add    $0x10,%esp
+}
+  801e97:	89 f0                	mov    %esi,%eax
+  801e99:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e9c:	5b                   	pop    %ebx
+  801e9d:	5e                   	pop    %esi
+  801e9e:	5f                   	pop    %edi
+  801e9f:	5d                   	pop    %ebp
+  801ea0:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  801ea1:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ea6:	e8 0f ff ff ff       	call   801dba <fsv_alloc>
+  801eab:	89 c6                	mov    %eax,%esi
+  801ead:	85 c0                	test   %eax,%eax
+  801eaf:	78 e6                	js     801e97 <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  801eb1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801eb4:	8b 40 0c             	mov    0xc(%eax),%eax
+  801eb7:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  801ebc:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ebf:	8b 40 04             	mov    0x4(%eax),%eax
+  801ec2:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  801ec7:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  801ecd:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801ed4:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801ed9:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801ede:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801ee3:	e8 e2 fc ff ff       	call   801bca <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801ee8:	6a 00                	push   $0x0
+  801eea:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801eed:	50                   	push   %eax
+  801eee:	68 00 10 c0 9f       	push   $0x9fc01000
+  801ef3:	6a 00                	push   $0x0
+  801ef5:	e8 c8 f5 ff ff       	call   8014c2 <ipc_recv_pages>
+  801efa:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  801efc:	83 c4 10             	add    $0x10,%esp
+  801eff:	85 c0                	test   %eax,%eax
+  801f01:	7e 94                	jle    801e97 <devfile_read+0x61>
+  assert(r <= n);
+  801f03:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801f06:	39 c3                	cmp    %eax,%ebx
+  801f08:	72 2e                	jb     801f38 <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801f0a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f0d:	8b 40 04             	mov    0x4(%eax),%eax
+  801f10:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801f15:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  801f18:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801f1b:	c1 e2 0c             	shl    $0xc,%edx
+  801f1e:	39 ca                	cmp    %ecx,%edx
+  801f20:	72 2f                	jb     801f51 <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  801f22:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  801f27:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  801f2a:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  801f2e:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801f33:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  801f36:	eb 52                	jmp    801f8a <devfile_read+0x154>
+  assert(r <= n);
+  801f38:	68 75 3e 80 00       	push   $0x803e75
+  801f3d:	68 7c 3e 80 00       	push   $0x803e7c
+  801f42:	68 49 01 00 00       	push   $0x149
+  801f47:	68 6a 3e 80 00       	push   $0x803e6a
+  801f4c:	e8 f9 16 00 00       	call   80364a <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801f51:	68 a0 3e 80 00       	push   $0x803ea0
+  801f56:	68 7c 3e 80 00       	push   $0x803e7c
+  801f5b:	68 4a 01 00 00       	push   $0x14a
+  801f60:	68 6a 3e 80 00       	push   $0x803e6a
+  801f65:	e8 e0 16 00 00       	call   80364a <_panic>
+      memmove(dst + done, src + done, m);
+  801f6a:	83 ec 04             	sub    $0x4,%esp
+  801f6d:	53                   	push   %ebx
+  801f6e:	56                   	push   %esi
+  801f6f:	89 f8                	mov    %edi,%eax
+  801f71:	03 45 0c             	add    0xc(%ebp),%eax
+  801f74:	50                   	push   %eax
+  801f75:	e8 bc e9 ff ff       	call   800936 <memmove>
+  801f7a:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  801f7d:	01 df                	add    %ebx,%edi
+  801f7f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801f82:	39 c7                	cmp    %eax,%edi
+  801f84:	0f 83 c0 00 00 00    	jae    80204a <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801f8a:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801f8d:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  801f90:	89 f0                	mov    %esi,%eax
+  801f92:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801f97:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  801f9c:	29 c3                	sub    %eax,%ebx
+  801f9e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801fa1:	29 f8                	sub    %edi,%eax
+  801fa3:	39 c3                	cmp    %eax,%ebx
+  801fa5:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  801fa8:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801fae:	75 ba                	jne    801f6a <devfile_read+0x134>
+  801fb0:	89 f9                	mov    %edi,%ecx
+  801fb2:	03 4d 0c             	add    0xc(%ebp),%ecx
+  801fb5:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  801fb8:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  801fbe:	75 aa                	jne    801f6a <devfile_read+0x134>
+  801fc0:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  801fc6:	77 a2                	ja     801f6a <devfile_read+0x134>
+  801fc8:	89 c8                	mov    %ecx,%eax
+  801fca:	c1 e8 16             	shr    $0x16,%eax
+  801fcd:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801fd4:	a8 01                	test   $0x1,%al
+  801fd6:	74 92                	je     801f6a <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  801fd8:	89 c8                	mov    %ecx,%eax
+  801fda:	c1 e8 0c             	shr    $0xc,%eax
+  801fdd:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  801fe4:	a8 01                	test   $0x1,%al
+  801fe6:	74 82                	je     801f6a <devfile_read+0x134>
+  801fe8:	a9 02 08 00 00       	test   $0x802,%eax
+  801fed:	0f 84 77 ff ff ff    	je     801f6a <devfile_read+0x134>
+  801ff3:	f6 c4 04             	test   $0x4,%ah
+  801ff6:	0f 85 6e ff ff ff    	jne    801f6a <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  801ffc:	a1 a0 58 80 00       	mov    0x8058a0,%eax
+  802001:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  802005:	84 c0                	test   %al,%al
+  802007:	75 17                	jne    802020 <devfile_read+0x1ea>
+  802009:	83 ec 08             	sub    $0x8,%esp
+  80200c:	6a 01                	push   $0x1
+  80200e:	6a 00                	push   $0x0
+  802010:	e8 87 eb ff ff       	call   800b9c <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  802015:	83 c4 10             	add    $0x10,%esp
+  802018:	85 c0                	test   %eax,%eax
+  80201a:	0f 85 4a ff ff ff    	jne    801f6a <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  802020:	83 ec 04             	sub    $0x4,%esp
+  802023:	68 05 08 00 00       	push   $0x805
+  802028:	ff 75 cc             	push   -0x34(%ebp)
+  80202b:	6a 00                	push   $0x0
+  80202d:	56                   	push   %esi
+  80202e:	6a 00                	push   $0x0
+  802030:	6a 05                	push   $0x5
+  802032:	68 40 50 80 00       	push   $0x805040
+  802037:	e8 f6 ef ff ff       	call   801032 <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  80203c:	c1 e8 1f             	shr    $0x1f,%eax
+  80203f:	08 45 cb             	or     %al,-0x35(%ebp)
+  802042:	83 c4 20             	add    $0x20,%esp
+  802045:	e9 33 ff ff ff       	jmp    801f7d <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  80204a:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  80204d:	83 ec 0c             	sub    $0xc,%esp
+  802050:	68 40 50 80 00       	push   $0x805040
+  802055:	e8 88 ef ff ff       	call   800fe2 <sysbatch_flush>
+  80205a:	83 c4 10             	add    $0x10,%esp
+  80205d:	85 c0                	test   %eax,%eax
+  80205f:	78 06                	js     802067 <devfile_read+0x231>
+  802061:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  802065:	74 14                	je     80207b <devfile_read+0x245>
+    memmove(dst, src, r);
+  802067:	83 ec 04             	sub    $0x4,%esp
+  80206a:	ff 75 d4             	push   -0x2c(%ebp)
+  80206d:	ff 75 d0             	push   -0x30(%ebp)
+  802070:	ff 75 0c             	push   0xc(%ebp)
+  802073:	e8 be e8 ff ff       	call   800936 <memmove>
+  802078:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  80207b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80207e:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  802081:	e9 11 fe ff ff       	jmp    801e97 <devfile_read+0x61>
+  assert(r <= n);
+  802086:	68 75 3e 80 00       	push   $0x803e75
+  80208b:	68 7c 3e 80 00       	push   $0x803e7c
+  802090:	68 1c 01 00 00       	push   $0x11c
+  802095:	68 6a 3e 80 00       	push   $0x803e6a
+  80209a:	e8 ab 15 00 00       	call   80364a <_panic>
+  assert(r <= PGSIZE);
+  80209f:	68 91 3e 80 00       	push   $0x803e91
+  8020a4:	68 7c 3e 80 00       	push   $0x803e7c
+  8020a9:	68 1d 01 00 00       	push   $0x11d
+  8020ae:	68 6a 3e 80 00       	push   $0x803e6a
+  8020b3:	e8 92 15 00 00       	call   80364a <_panic>
+
+008020b8 <devfile_write>:
+{
+  8020b8:	55                   	push   %ebp
+  8020b9:	89 e5                	mov    %esp,%ebp
+  8020bb:	57                   	push   %edi
+  8020bc:	56                   	push   %esi
+  8020bd:	53                   	push   %ebx
+  8020be:	83 ec 1c             	sub    $0x1c,%esp
+  8020c1:	8b 75 08             	mov    0x8(%ebp),%esi
+  8020c4:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  8020c7:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  8020cc:	77 39                	ja     802107 <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8020ce:	8b 56 0c             	mov    0xc(%esi),%edx
+  8020d1:	89 15 00 60 80 00    	mov    %edx,0x806000
+  fsipcbuf.write.req_n = n;
+  8020d7:	a3 04 60 80 00       	mov    %eax,0x806004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  8020dc:	83 ec 04             	sub    $0x4,%esp
+  8020df:	50                   	push   %eax
+  8020e0:	ff 75 0c             	push   0xc(%ebp)
+  8020e3:	68 08 60 80 00       	push   $0x806008
+  8020e8:	e8 49 e8 ff ff       	call   800936 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  8020ed:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020f2:	b8 04 00 00 00       	mov    $0x4,%eax
+  8020f7:	e8 e7 fb ff ff       	call   801ce3 <fsipc>
+  8020fc:	83 c4 10             	add    $0x10,%esp
+}
+  8020ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802102:	5b                   	pop    %ebx
+  802103:	5e                   	pop    %esi
+  802104:	5f                   	pop    %edi
+  802105:	5d                   	pop    %ebp
+  802106:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  802107:	ba 00 00 10 00       	mov    $0x100000,%edx
+  80210c:	39 d0                	cmp    %edx,%eax
+  80210e:	89 d3                	mov    %edx,%ebx
+  802110:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  802113:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  802119:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  80211c:	83 c7 01             	add    $0x1,%edi
+  80211f:	89 f8                	mov    %edi,%eax
+  802121:	e8 94 fc ff ff       	call   801dba <fsv_alloc>
+  802126:	85 c0                	test   %eax,%eax
+  802128:	78 d5                	js     8020ff <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  80212a:	83 ec 04             	sub    $0x4,%esp
+  80212d:	53                   	push   %ebx
+  80212e:	ff 75 0c             	push   0xc(%ebp)
+  802131:	68 00 10 c0 9f       	push   $0x9fc01000
+  802136:	e8 fb e7 ff ff       	call   800936 <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  80213b:	8b 46 0c             	mov    0xc(%esi),%eax
+  80213e:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  802143:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  802149:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  802150:	89 f9                	mov    %edi,%ecx
+  802152:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  802157:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80215c:	e8 69 fa ff ff       	call   801bca <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  802161:	6a 00                	push   $0x0
+  802163:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802166:	50                   	push   %eax
+  802167:	6a 00                	push   $0x0
+  802169:	6a 00                	push   $0x0
+  80216b:	e8 52 f3 ff ff       	call   8014c2 <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  802170:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  802173:	eb 8a                	jmp    8020ff <devfile_write+0x47>
+
+00802175 <open>:
+{
+  802175:	55                   	push   %ebp
+  802176:	89 e5                	mov    %esp,%ebp
+  802178:	56                   	push   %esi
+  802179:	53                   	push   %ebx
+  80217a:	83 ec 1c             	sub    $0x1c,%esp
+  80217d:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  802180:	56                   	push   %esi
+  802181:	e8 ef e5 ff ff       	call   800775 <strlen>
+  802186:	83 c4 10             	add    $0x10,%esp
+  802189:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80218e:	7f 6c                	jg     8021fc <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  802190:	83 ec 0c             	sub    $0xc,%esp
+  802193:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802196:	50                   	push   %eax
+  802197:	e8 ad f4 ff ff       	call   801649 <fd_alloc>
+  80219c:	89 c3                	mov    %eax,%ebx
+  80219e:	83 c4 10             	add    $0x10,%esp
+  8021a1:	85 c0                	test   %eax,%eax
+  8021a3:	78 3c                	js     8021e1 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  8021a5:	83 ec 08             	sub    $0x8,%esp
+  8021a8:	56                   	push   %esi
+  8021a9:	68 00 60 80 00       	push   $0x806000
+  8021ae:	e8 fd e5 ff ff       	call   8007b0 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  8021b3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021b6:	a3 00 64 80 00       	mov    %eax,0x806400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8021bb:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8021be:	b8 01 00 00 00       	mov    $0x1,%eax
+  8021c3:	e8 1b fb ff ff       	call   801ce3 <fsipc>
+  8021c8:	89 c3                	mov    %eax,%ebx
+  8021ca:	83 c4 10             	add    $0x10,%esp
+  8021cd:	85 c0                	test   %eax,%eax
+  8021cf:	78 19                	js     8021ea <open+0x75>
+  return fd2num(fd);
+  8021d1:	83 ec 0c             	sub    $0xc,%esp
+  8021d4:	ff 75 f4             	push   -0xc(%ebp)
+  8021d7:	e8 49 f4 ff ff       	call   801625 <fd2num>
+  8021dc:	89 c3                	mov    %eax,%ebx
+  8021de:	83 c4 10             	add    $0x10,%esp
+}
+  8021e1:	89 d8                	mov    %ebx,%eax
+  8021e3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021e6:	5b                   	pop    %ebx
+  8021e7:	5e                   	pop    %esi
+  8021e8:	5d                   	pop    %ebp
+  8021e9:	c3                   	ret
+    fd_close(fd, 0);
+  8021ea:	83 ec 08             	sub    $0x8,%esp
+  8021ed:	6a 00                	push   $0x0
+  8021ef:	ff 75 f4             	push   -0xc(%ebp)
+  8021f2:	e8 44 f5 ff ff       	call   80173b <fd_close>
+    return r;
+  8021f7:	83 c4 10             	add    $0x10,%esp
+  8021fa:	eb e5                	jmp    8021e1 <open+0x6c>
+    return -E_BAD_PATH;
+  8021fc:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802201:	eb de                	jmp    8021e1 <open+0x6c>
+
+00802203 <open_read>:
+{
+  802203:	55                   	push   %ebp
+  802204:	89 e5                	mov    %esp,%ebp
+  802206:	57                   	push   %edi
+  802207:	56                   	push   %esi
+  802208:	53                   	push   %ebx
+  802209:	83 ec 28             	sub    $0x28,%esp
+  80220c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  80220f:	57                   	push   %edi
+  802210:	e8 60 e5 ff ff       	call   800775 <strlen>
+  802215:	83 c4 10             	add    $0x10,%esp
+  802218:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80221d:	0f 87 f6 00 00 00    	ja     802319 <open_read+0x116>
+  802223:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  802225:	83 ec 0c             	sub    $0xc,%esp
+  802228:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80222b:	50                   	push   %eax
+  80222c:	e8 18 f4 ff ff       	call   801649 <fd_alloc>
+  802231:	89 c3                	mov    %eax,%ebx
+  802233:	83 c4 10             	add    $0x10,%esp
+  802236:	85 c0                	test   %eax,%eax
+  802238:	0f 88 b2 00 00 00    	js     8022f0 <open_read+0xed>
+  strcpy(req->req_buf, path);
+  80223e:	83 ec 08             	sub    $0x8,%esp
+  802241:	57                   	push   %edi
+  802242:	68 e4 60 80 00       	push   $0x8060e4
+  802247:	e8 64 e5 ff ff       	call   8007b0 <strcpy>
+  req->req_nops = 2;
+  80224c:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  802253:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  802256:	c7 05 04 60 80 00 01 	movl   $0x1,0x806004
+  80225d:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  802260:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802263:	a3 10 60 80 00       	mov    %eax,0x806010
+  req->req_ops[0].op_buf = 0;
+  802268:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  80226f:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  802272:	c7 05 20 60 80 00 04 	movl   $0x4,0x806020
+  802279:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  80227c:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  802283:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  802286:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  80228b:	29 f0                	sub    %esi,%eax
+  80228d:	3b 45 14             	cmp    0x14(%ebp),%eax
+  802290:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  802294:	a3 2c 60 80 00       	mov    %eax,0x80602c
+  req->req_ops[1].op_offset = 0;
+  802299:	c7 05 30 60 80 00 00 	movl   $0x0,0x806030
+  8022a0:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  8022a3:	83 c6 01             	add    $0x1,%esi
+  8022a6:	89 35 34 60 80 00    	mov    %esi,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  8022ac:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8022af:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8022b4:	e8 2a fa ff ff       	call   801ce3 <fsipc>
+  8022b9:	89 c3                	mov    %eax,%ebx
+  8022bb:	83 c4 10             	add    $0x10,%esp
+  8022be:	83 f8 01             	cmp    $0x1,%eax
+  8022c1:	7e 37                	jle    8022fa <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  8022c3:	a1 38 60 80 00       	mov    0x806038,%eax
+  8022c8:	8b 55 18             	mov    0x18(%ebp),%edx
+  8022cb:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  8022cd:	83 ec 04             	sub    $0x4,%esp
+  8022d0:	50                   	push   %eax
+  8022d1:	81 c6 e4 60 80 00    	add    $0x8060e4,%esi
+  8022d7:	56                   	push   %esi
+  8022d8:	ff 75 10             	push   0x10(%ebp)
+  8022db:	e8 56 e6 ff ff       	call   800936 <memmove>
+  return fd2num(fd);
+  8022e0:	83 c4 04             	add    $0x4,%esp
+  8022e3:	ff 75 e4             	push   -0x1c(%ebp)
+  8022e6:	e8 3a f3 ff ff       	call   801625 <fd2num>
+  8022eb:	89 c3                	mov    %eax,%ebx
+  8022ed:	83 c4 10             	add    $0x10,%esp
+}
+  8022f0:	89 d8                	mov    %ebx,%eax
+  8022f2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022f5:	5b                   	pop    %ebx
+  8022f6:	5e                   	pop    %esi
+  8022f7:	5f                   	pop    %edi
+  8022f8:	5d                   	pop    %ebp
+  8022f9:	c3                   	ret
+    fd_close(fd, 0);
+  8022fa:	83 ec 08             	sub    $0x8,%esp
+  8022fd:	6a 00                	push   $0x0
+  8022ff:	ff 75 e4             	push   -0x1c(%ebp)
+  802302:	e8 34 f4 ff ff       	call   80173b <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  802307:	83 c4 10             	add    $0x10,%esp
+  80230a:	85 db                	test   %ebx,%ebx
+  80230c:	78 e2                	js     8022f0 <open_read+0xed>
+  80230e:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  802311:	8b 9b 1c 60 80 00    	mov    0x80601c(%ebx),%ebx
+  802317:	eb d7                	jmp    8022f0 <open_read+0xed>
+    return -E_BAD_PATH;
+  802319:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80231e:	eb d0                	jmp    8022f0 <open_read+0xed>
+
+00802320 <file_stat>:
+{
+  802320:	55                   	push   %ebp
+  802321:	89 e5                	mov    %esp,%ebp
+  802323:	57                   	push   %edi
+  802324:	56                   	push   %esi
+  802325:	53                   	push   %ebx
+  802326:	83 ec 18             	sub    $0x18,%esp
+  802329:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80232c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  80232f:	57                   	push   %edi
+  802330:	e8 40 e4 ff ff       	call   800775 <strlen>
+  802335:	83 c4 10             	add    $0x10,%esp
+  802338:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80233d:	0f 8f c7 00 00 00    	jg     80240a <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  802343:	83 ec 0c             	sub    $0xc,%esp
+  802346:	57                   	push   %edi
+  802347:	e8 29 e4 ff ff       	call   800775 <strlen>
+  80234c:	8d 58 04             	lea    0x4(%eax),%ebx
+  80234f:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  802352:	83 c4 08             	add    $0x8,%esp
+  802355:	57                   	push   %edi
+  802356:	68 e4 60 80 00       	push   $0x8060e4
+  80235b:	e8 50 e4 ff ff       	call   8007b0 <strcpy>
+  req->req_nops = 2;
+  802360:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  802367:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  80236a:	c7 05 04 60 80 00 02 	movl   $0x2,0x806004
+  802371:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  802374:	c7 05 10 60 80 00 00 	movl   $0x0,0x806010
+  80237b:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  80237e:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  802385:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  802388:	c7 05 20 60 80 00 03 	movl   $0x3,0x806020
+  80238f:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  802392:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  802399:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  80239c:	89 1d 34 60 80 00    	mov    %ebx,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  8023a2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023a7:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8023ac:	e8 32 f9 ff ff       	call   801ce3 <fsipc>
+  8023b1:	83 c4 10             	add    $0x10,%esp
+  8023b4:	83 f8 01             	cmp    $0x1,%eax
+  8023b7:	7e 42                	jle    8023fb <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  8023b9:	81 c3 e4 60 80 00    	add    $0x8060e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  8023bf:	83 ec 08             	sub    $0x8,%esp
+  8023c2:	53                   	push   %ebx
+  8023c3:	56                   	push   %esi
+  8023c4:	e8 e7 e3 ff ff       	call   8007b0 <strcpy>
+  st->st_size = ret->ret_size;
+  8023c9:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  8023cf:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  8023d5:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  8023db:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  8023e1:	c7 86 88 00 00 00 04 	movl   $0x804004,0x88(%esi)
+  8023e8:	40 80 00 
+  return 0;
+  8023eb:	83 c4 10             	add    $0x10,%esp
+  8023ee:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023f6:	5b                   	pop    %ebx
+  8023f7:	5e                   	pop    %esi
+  8023f8:	5f                   	pop    %edi
+  8023f9:	5d                   	pop    %ebp
+  8023fa:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  8023fb:	85 c0                	test   %eax,%eax
+  8023fd:	78 f4                	js     8023f3 <file_stat+0xd3>
+  8023ff:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802402:	8b 80 1c 60 80 00    	mov    0x80601c(%eax),%eax
+  802408:	eb e9                	jmp    8023f3 <file_stat+0xd3>
+    return -E_BAD_PATH;
+  80240a:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  80240f:	eb e2                	jmp    8023f3 <file_stat+0xd3>
+
+00802411 <read_map>:
+{
+  802411:	55                   	push   %ebp
+  802412:	89 e5                	mov    %esp,%ebp
+  802414:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802417:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80241a:	50                   	push   %eax
+  80241b:	ff 75 08             	push   0x8(%ebp)
+  80241e:	e8 7c f2 ff ff       	call   80169f <fd_lookup>
+  802423:	83 c4 10             	add    $0x10,%esp
+  802426:	85 c0                	test   %eax,%eax
+  802428:	78 2a                	js     802454 <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  80242a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80242d:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  802433:	39 08                	cmp    %ecx,(%eax)
+  802435:	75 1f                	jne    802456 <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  802437:	8b 40 0c             	mov    0xc(%eax),%eax
+  80243a:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read_map.req_offset = offset;
+  80243f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802442:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  802447:	8b 55 10             	mov    0x10(%ebp),%edx
+  80244a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80244f:	e8 8f f8 ff ff       	call   801ce3 <fsipc>
+}
+  802454:	c9                   	leave
+  802455:	c3                   	ret
+    return -E_INVAL;
+  802456:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80245b:	eb f7                	jmp    802454 <read_map+0x43>
+
+0080245d <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80245d:	55                   	push   %ebp
+  80245e:	89 e5                	mov    %esp,%ebp
+  802460:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  802463:	ba 00 00 00 00       	mov    $0x0,%edx
+  802468:	b8 08 00 00 00       	mov    $0x8,%eax
+  80246d:	e8 71 f8 ff ff       	call   801ce3 <fsipc>
+}
+  802472:	c9                   	leave
+  802473:	c3                   	ret
+
+00802474 <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  802474:	55                   	push   %ebp
+  802475:	89 e5                	mov    %esp,%ebp
+  802477:	57                   	push   %edi
+  802478:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  802479:	8b 45 08             	mov    0x8(%ebp),%eax
+  80247c:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.stats.req_bio_sched = 0;
+  802481:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  802488:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  80248b:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  802492:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  802495:	ba 00 00 00 00       	mov    $0x0,%edx
+  80249a:	b8 09 00 00 00       	mov    $0x9,%eax
+  80249f:	e8 3f f8 ff ff       	call   801ce3 <fsipc>
+  8024a4:	85 c0                	test   %eax,%eax
+  8024a6:	78 14                	js     8024bc <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  8024a8:	be 00 60 80 00       	mov    $0x806000,%esi
+  8024ad:	b9 16 00 00 00       	mov    $0x16,%ecx
+  8024b2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8024b5:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  8024b7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024bc:	5e                   	pop    %esi
+  8024bd:	5f                   	pop    %edi
+  8024be:	5d                   	pop    %ebp
+  8024bf:	c3                   	ret
+
+008024c0 <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  8024c0:	55                   	push   %ebp
+  8024c1:	89 e5                	mov    %esp,%ebp
+  8024c3:	53                   	push   %ebx
+  8024c4:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  8024c7:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8024ca:	50                   	push   %eax
+  8024cb:	6a 00                	push   $0x0
+  8024cd:	e8 a2 ff ff ff       	call   802474 <fs_stats>
+  8024d2:	83 c4 10             	add    $0x10,%esp
+  8024d5:	85 c0                	test   %eax,%eax
+  8024d7:	78 28                	js     802501 <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  8024d9:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  8024dc:	83 ec 08             	sub    $0x8,%esp
+  8024df:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8024e2:	50                   	push   %eax
+  8024e3:	6a 20                	push   $0x20
+  8024e5:	e8 8a ff ff ff       	call   802474 <fs_stats>
+  8024ea:	83 c4 10             	add    $0x10,%esp
+  8024ed:	85 c0                	test   %eax,%eax
+  8024ef:	78 10                	js     802501 <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  8024f1:	83 ec 08             	sub    $0x8,%esp
+  8024f4:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8024f7:	50                   	push   %eax
+  8024f8:	53                   	push   %ebx
+  8024f9:	e8 76 ff ff ff       	call   802474 <fs_stats>
+  8024fe:	83 c4 10             	add    $0x10,%esp
+}
+  802501:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802504:	c9                   	leave
+  802505:	c3                   	ret
+
+00802506 <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  802506:	55                   	push   %ebp
+  802507:	89 e5                	mov    %esp,%ebp
+  802509:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  80250c:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  802513:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  802516:	8b 45 08             	mov    0x8(%ebp),%eax
+  802519:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.stats.req_dcache = 0;
+  80251e:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  802525:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  802528:	ba 00 00 00 00       	mov    $0x0,%edx
+  80252d:	b8 09 00 00 00       	mov    $0x9,%eax
+  802532:	e8 ac f7 ff ff       	call   801ce3 <fsipc>
+}
+  802537:	c9                   	leave
+  802538:	c3                   	ret
+
+00802539 <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  802539:	55                   	push   %ebp
+  80253a:	89 e5                	mov    %esp,%ebp
+  80253c:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  80253f:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  802546:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  802549:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  802550:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  802553:	8b 45 08             	mov    0x8(%ebp),%eax
+  802556:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_STATS, NULL);
+  80255b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802560:	b8 09 00 00 00       	mov    $0x9,%eax
+  802565:	e8 79 f7 ff ff       	call   801ce3 <fsipc>
+}
+  80256a:	c9                   	leave
+  80256b:	c3                   	ret
+
+0080256c <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  80256c:	55                   	push   %ebp
+  80256d:	89 e5                	mov    %esp,%ebp
+  80256f:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802572:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802575:	50                   	push   %eax
+  802576:	ff 75 08             	push   0x8(%ebp)
+  802579:	e8 21 f1 ff ff       	call   80169f <fd_lookup>
+  80257e:	83 c4 10             	add    $0x10,%esp
+  802581:	85 c0                	test   %eax,%eax
+  802583:	78 34                	js     8025b9 <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  802585:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802588:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  80258e:	39 08                	cmp    %ecx,(%eax)
+  802590:	75 29                	jne    8025bb <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  802592:	8b 40 0c             	mov    0xc(%eax),%eax
+  802595:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.fallocate.req_offset = offset;
+  80259a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80259d:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.fallocate.req_len = len;
+  8025a2:	8b 45 10             	mov    0x10(%ebp),%eax
+  8025a5:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  8025aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025af:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8025b4:	e8 2a f7 ff ff       	call   801ce3 <fsipc>
+}
+  8025b9:	c9                   	leave
+  8025ba:	c3                   	ret
+    return -E_INVAL;
+  8025bb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8025c0:	eb f7                	jmp    8025b9 <fallocate+0x4d>
+
+008025c2 <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  8025c2:	55                   	push   %ebp
+  8025c3:	89 e5                	mov    %esp,%ebp
+  8025c5:	57                   	push   %edi
+  8025c6:	56                   	push   %esi
+  8025c7:	53                   	push   %ebx
+  8025c8:	83 ec 24             	sub    $0x24,%esp
+  8025cb:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8025ce:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8025d1:	50                   	push   %eax
+  8025d2:	ff 75 08             	push   0x8(%ebp)
+  8025d5:	e8 c5 f0 ff ff       	call   80169f <fd_lookup>
+  8025da:	83 c4 10             	add    $0x10,%esp
+  8025dd:	85 c0                	test   %eax,%eax
+  8025df:	78 66                	js     802647 <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  8025e1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8025e4:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  8025ea:	39 08                	cmp    %ecx,(%eax)
+  8025ec:	75 61                	jne    80264f <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  8025ee:	85 f6                	test   %esi,%esi
+  8025f0:	7e 50                	jle    802642 <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  8025f2:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  8025f7:	39 de                	cmp    %ebx,%esi
+  8025f9:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  8025fc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8025ff:	8b 40 0c             	mov    0xc(%eax),%eax
+  802602:	a3 00 60 80 00       	mov    %eax,0x806000
+    fsipcbuf.prefetch.req_n = m;
+  802607:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  80260d:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  802614:	83 ec 04             	sub    $0x4,%esp
+  802617:	57                   	push   %edi
+  802618:	ff 75 0c             	push   0xc(%ebp)
+  80261b:	68 08 60 80 00       	push   $0x806008
+  802620:	e8 11 e3 ff ff       	call   800936 <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  802625:	ba 00 00 00 00       	mov    $0x0,%edx
+  80262a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80262f:	e8 af f6 ff ff       	call   801ce3 <fsipc>
+  802634:	83 c4 10             	add    $0x10,%esp
+  802637:	85 c0                	test   %eax,%eax
+  802639:	78 0c                	js     802647 <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  80263b:	01 7d 0c             	add    %edi,0xc(%ebp)
+  80263e:	29 de                	sub    %ebx,%esi
+  802640:	eb ac                	jmp    8025ee <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  802642:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802647:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80264a:	5b                   	pop    %ebx
+  80264b:	5e                   	pop    %esi
+  80264c:	5f                   	pop    %edi
+  80264d:	5d                   	pop    %ebp
+  80264e:	c3                   	ret
+    return -E_INVAL;
+  80264f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802654:	eb f1                	jmp    802647 <prefetch+0x85>
+
+00802656 <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  802656:	55                   	push   %ebp
+  802657:	89 e5                	mov    %esp,%ebp
+  802659:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  80265c:	50                   	push   %eax
+  80265d:	e8 d3 ef ff ff       	call   801635 <fd2data>
+  802662:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  802667:	c9                   	leave
+  802668:	c3                   	ret
+
+00802669 <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802669:	55                   	push   %ebp
+  80266a:	89 e5                	mov    %esp,%ebp
+  80266c:	56                   	push   %esi
+  80266d:	53                   	push   %ebx
+  80266e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  802671:	83 ec 0c             	sub    $0xc,%esp
+  802674:	ff 75 08             	push   0x8(%ebp)
+  802677:	e8 b9 ef ff ff       	call   801635 <fd2data>
+  80267c:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  80267e:	83 c4 08             	add    $0x8,%esp
+  802681:	68 cc 3e 80 00       	push   $0x803ecc
+  802686:	53                   	push   %ebx
+  802687:	e8 24 e1 ff ff       	call   8007b0 <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  80268c:	8b 46 04             	mov    0x4(%esi),%eax
+  80268f:	2b 06                	sub    (%esi),%eax
+  802691:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  802697:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80269e:	00 00 00 
+  stat->st_dev = &devpipe;
+  8026a1:	c7 83 88 00 00 00 20 	movl   $0x804020,0x88(%ebx)
+  8026a8:	40 80 00 
+  return 0;
+}
+  8026ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026b0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026b3:	5b                   	pop    %ebx
+  8026b4:	5e                   	pop    %esi
+  8026b5:	5d                   	pop    %ebp
+  8026b6:	c3                   	ret
+
+008026b7 <pipe_wakeup>:
+{
+  8026b7:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  8026b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026be:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  8026c1:	85 c0                	test   %eax,%eax
+  8026c3:	75 01                	jne    8026c6 <pipe_wakeup+0xf>
+  8026c5:	c3                   	ret
+{
+  8026c6:	55                   	push   %ebp
+  8026c7:	89 e5                	mov    %esp,%ebp
+  8026c9:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  8026cc:	6a 00                	push   $0x0
+  8026ce:	68 00 00 c0 ee       	push   $0xeec00000
+  8026d3:	52                   	push   %edx
+  8026d4:	e8 62 e8 ff ff       	call   800f3b <sys_chan_wakeup>
+  8026d9:	83 c4 10             	add    $0x10,%esp
+}
+  8026dc:	c9                   	leave
+  8026dd:	c3                   	ret
+
+008026de <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8026de:	55                   	push   %ebp
+  8026df:	89 e5                	mov    %esp,%ebp
+  8026e1:	57                   	push   %edi
+  8026e2:	56                   	push   %esi
+  8026e3:	53                   	push   %ebx
+  8026e4:	83 ec 18             	sub    $0x18,%esp
+  8026e7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  8026ea:	57                   	push   %edi
+  8026eb:	e8 45 ef ff ff       	call   801635 <fd2data>
+  8026f0:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  8026f2:	83 c4 10             	add    $0x10,%esp
+  8026f5:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  8026f9:	74 2a                	je     802725 <devpipe_close+0x47>
+  8026fb:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  802700:	89 f8                	mov    %edi,%eax
+  802702:	e8 4f ff ff ff       	call   802656 <pipe_ring>
+  802707:	83 ec 08             	sub    $0x8,%esp
+  80270a:	01 d8                	add    %ebx,%eax
+  80270c:	50                   	push   %eax
+  80270d:	6a 00                	push   $0x0
+  80270f:	e8 50 e5 ff ff       	call   800c64 <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  802714:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80271a:	83 c4 10             	add    $0x10,%esp
+  80271d:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  802723:	75 db                	jne    802700 <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  802725:	83 ec 08             	sub    $0x8,%esp
+  802728:	57                   	push   %edi
+  802729:	6a 00                	push   $0x0
+  80272b:	e8 34 e5 ff ff       	call   800c64 <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  802730:	83 c4 10             	add    $0x10,%esp
+  802733:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  802737:	75 13                	jne    80274c <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  802739:	83 ec 08             	sub    $0x8,%esp
+  80273c:	56                   	push   %esi
+  80273d:	6a 00                	push   $0x0
+  80273f:	e8 20 e5 ff ff       	call   800c64 <sys_page_unmap>
+}
+  802744:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802747:	5b                   	pop    %ebx
+  802748:	5e                   	pop    %esi
+  802749:	5f                   	pop    %edi
+  80274a:	5d                   	pop    %ebp
+  80274b:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  80274c:	8d 56 04             	lea    0x4(%esi),%edx
+  80274f:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802752:	e8 60 ff ff ff       	call   8026b7 <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802757:	8d 46 30             	lea    0x30(%esi),%eax
+  80275a:	89 f2                	mov    %esi,%edx
+  80275c:	e8 56 ff ff ff       	call   8026b7 <pipe_wakeup>
+  802761:	eb d6                	jmp    802739 <devpipe_close+0x5b>
+
+00802763 <_pipeisclosed>:
+{
+  802763:	55                   	push   %ebp
+  802764:	89 e5                	mov    %esp,%ebp
+  802766:	57                   	push   %edi
+  802767:	56                   	push   %esi
+  802768:	53                   	push   %ebx
+  802769:	83 ec 1c             	sub    $0x1c,%esp
+  80276c:	89 c7                	mov    %eax,%edi
+  80276e:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  802770:	a1 a0 58 80 00       	mov    0x8058a0,%eax
+  802775:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  802778:	83 ec 0c             	sub    $0xc,%esp
+  80277b:	57                   	push   %edi
+  80277c:	e8 7c 0f 00 00       	call   8036fd <pageref>
+  802781:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802784:	89 34 24             	mov    %esi,(%esp)
+  802787:	e8 71 0f 00 00       	call   8036fd <pageref>
+    nn = thisenv->env_runs;
+  80278c:	8b 15 a0 58 80 00    	mov    0x8058a0,%edx
+  802792:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  802795:	83 c4 10             	add    $0x10,%esp
+  802798:	39 cb                	cmp    %ecx,%ebx
+  80279a:	74 1b                	je     8027b7 <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  80279c:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80279f:	75 cf                	jne    802770 <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8027a1:	8b 42 58             	mov    0x58(%edx),%eax
+  8027a4:	6a 01                	push   $0x1
+  8027a6:	50                   	push   %eax
+  8027a7:	53                   	push   %ebx
+  8027a8:	68 d3 3e 80 00       	push   $0x803ed3
+  8027ad:	e8 10 da ff ff       	call   8001c2 <cprintf>
+  8027b2:	83 c4 10             	add    $0x10,%esp
+  8027b5:	eb b9                	jmp    802770 <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  8027b7:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8027ba:	0f 94 c0             	sete   %al
+  8027bd:	0f b6 c0             	movzbl %al,%eax
+}
+  8027c0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027c3:	5b                   	pop    %ebx
+  8027c4:	5e                   	pop    %esi
+  8027c5:	5f                   	pop    %edi
+  8027c6:	5d                   	pop    %ebp
+  8027c7:	c3                   	ret
+
+008027c8 <devpipe_write_bulk>:
+{
+  8027c8:	55                   	push   %ebp
+  8027c9:	89 e5                	mov    %esp,%ebp
+  8027cb:	57                   	push   %edi
+  8027cc:	56                   	push   %esi
+  8027cd:	53                   	push   %ebx
+  8027ce:	83 ec 1c             	sub    $0x1c,%esp
+  8027d1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8027d4:	89 d6                	mov    %edx,%esi
+  8027d6:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  8027d9:	e8 78 fe ff ff       	call   802656 <pipe_ring>
+  8027de:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  8027e1:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  8027e6:	8d 46 04             	lea    0x4(%esi),%eax
+  8027e9:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  8027ec:	eb 75                	jmp    802863 <devpipe_write_bulk+0x9b>
+  8027ee:	b8 01 00 00 00       	mov    $0x1,%eax
+  8027f3:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  8027f7:	6a 64                	push   $0x64
+  8027f9:	68 00 00 c0 ee       	push   $0xeec00000
+  8027fe:	53                   	push   %ebx
+  8027ff:	56                   	push   %esi
+  802800:	e8 13 e7 ff ff       	call   800f18 <sys_chan_sleep>
+      continue;
+  802805:	83 c4 10             	add    $0x10,%esp
+  802808:	eb 59                	jmp    802863 <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  80280a:	89 d1                	mov    %edx,%ecx
+  80280c:	c1 f9 1f             	sar    $0x1f,%ecx
+  80280f:	c1 e9 11             	shr    $0x11,%ecx
+  802812:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802815:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  80281a:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  80281c:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  802822:	29 d3                	sub    %edx,%ebx
+  802824:	ba 00 80 00 00       	mov    $0x8000,%edx
+  802829:	29 c2                	sub    %eax,%edx
+  80282b:	39 d3                	cmp    %edx,%ebx
+  80282d:	0f 47 da             	cmova  %edx,%ebx
+  802830:	8b 55 08             	mov    0x8(%ebp),%edx
+  802833:	29 fa                	sub    %edi,%edx
+  802835:	39 d3                	cmp    %edx,%ebx
+  802837:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  80283a:	83 ec 04             	sub    $0x4,%esp
+  80283d:	53                   	push   %ebx
+  80283e:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802841:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  802844:	52                   	push   %edx
+  802845:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802848:	01 c8                	add    %ecx,%eax
+  80284a:	50                   	push   %eax
+  80284b:	e8 48 e1 ff ff       	call   800998 <memcpy>
+    i += m;
+  802850:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  802852:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802855:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802858:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80285b:	e8 57 fe ff ff       	call   8026b7 <pipe_wakeup>
+  802860:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802863:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802866:	73 2b                	jae    802893 <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  802868:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  80286a:	8b 56 04             	mov    0x4(%esi),%edx
+  80286d:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  802873:	39 d0                	cmp    %edx,%eax
+  802875:	7d 93                	jge    80280a <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  802877:	89 f2                	mov    %esi,%edx
+  802879:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80287c:	e8 e2 fe ff ff       	call   802763 <_pipeisclosed>
+  802881:	85 c0                	test   %eax,%eax
+  802883:	0f 84 65 ff ff ff    	je     8027ee <devpipe_write_bulk+0x26>
+        return i;
+  802889:	89 f8                	mov    %edi,%eax
+}
+  80288b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80288e:	5b                   	pop    %ebx
+  80288f:	5e                   	pop    %esi
+  802890:	5f                   	pop    %edi
+  802891:	5d                   	pop    %ebp
+  802892:	c3                   	ret
+  return i;
+  802893:	89 f8                	mov    %edi,%eax
+  802895:	eb f4                	jmp    80288b <devpipe_write_bulk+0xc3>
+
+00802897 <devpipe_write>:
+{
+  802897:	55                   	push   %ebp
+  802898:	89 e5                	mov    %esp,%ebp
+  80289a:	57                   	push   %edi
+  80289b:	56                   	push   %esi
+  80289c:	53                   	push   %ebx
+  80289d:	83 ec 28             	sub    $0x28,%esp
+  8028a0:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  8028a3:	56                   	push   %esi
+  8028a4:	e8 8c ed ff ff       	call   801635 <fd2data>
+  8028a9:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  8028ab:	8b 78 28             	mov    0x28(%eax),%edi
+  8028ae:	83 c4 10             	add    $0x10,%esp
+  8028b1:	85 ff                	test   %edi,%edi
+  8028b3:	75 25                	jne    8028da <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  8028b5:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8028b8:	74 66                	je     802920 <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8028ba:	8b 43 04             	mov    0x4(%ebx),%eax
+  8028bd:	8b 0b                	mov    (%ebx),%ecx
+  8028bf:	8d 51 20             	lea    0x20(%ecx),%edx
+  8028c2:	39 d0                	cmp    %edx,%eax
+  8028c4:	72 2b                	jb     8028f1 <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  8028c6:	89 da                	mov    %ebx,%edx
+  8028c8:	89 f0                	mov    %esi,%eax
+  8028ca:	e8 94 fe ff ff       	call   802763 <_pipeisclosed>
+  8028cf:	85 c0                	test   %eax,%eax
+  8028d1:	75 51                	jne    802924 <devpipe_write+0x8d>
+      sys_yield();
+  8028d3:	e8 a5 e2 ff ff       	call   800b7d <sys_yield>
+  8028d8:	eb e0                	jmp    8028ba <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  8028da:	83 ec 0c             	sub    $0xc,%esp
+  8028dd:	ff 75 10             	push   0x10(%ebp)
+  8028e0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8028e3:	89 c2                	mov    %eax,%edx
+  8028e5:	89 f0                	mov    %esi,%eax
+  8028e7:	e8 dc fe ff ff       	call   8027c8 <devpipe_write_bulk>
+  8028ec:	83 c4 10             	add    $0x10,%esp
+  8028ef:	eb 38                	jmp    802929 <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8028f1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8028f4:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8028f8:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8028fb:	89 c2                	mov    %eax,%edx
+  8028fd:	c1 fa 1f             	sar    $0x1f,%edx
+  802900:	89 d1                	mov    %edx,%ecx
+  802902:	c1 e9 1b             	shr    $0x1b,%ecx
+  802905:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802908:	83 e2 1f             	and    $0x1f,%edx
+  80290b:	29 ca                	sub    %ecx,%edx
+  80290d:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802911:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  802915:	83 c0 01             	add    $0x1,%eax
+  802918:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  80291b:	83 c7 01             	add    $0x1,%edi
+  80291e:	eb 95                	jmp    8028b5 <devpipe_write+0x1e>
+  return i;
+  802920:	89 f8                	mov    %edi,%eax
+  802922:	eb 05                	jmp    802929 <devpipe_write+0x92>
+        return 0;
+  802924:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802929:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80292c:	5b                   	pop    %ebx
+  80292d:	5e                   	pop    %esi
+  80292e:	5f                   	pop    %edi
+  80292f:	5d                   	pop    %ebp
+  802930:	c3                   	ret
+
+00802931 <devpipe_read_bulk>:
+{
+  802931:	55                   	push   %ebp
+  802932:	89 e5                	mov    %esp,%ebp
+  802934:	57                   	push   %edi
+  802935:	56                   	push   %esi
+  802936:	53                   	push   %ebx
+  802937:	83 ec 2c             	sub    $0x2c,%esp
+  80293a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80293d:	89 d6                	mov    %edx,%esi
+  80293f:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802942:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  802945:	e8 0c fd ff ff       	call   802656 <pipe_ring>
+  80294a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  80294d:	85 db                	test   %ebx,%ebx
+  80294f:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802954:	0f 45 c3             	cmovne %ebx,%eax
+  802957:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80295a:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  80295f:	8d 46 30             	lea    0x30(%esi),%eax
+  802962:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  802965:	eb 50                	jmp    8029b7 <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  802967:	89 d1                	mov    %edx,%ecx
+  802969:	c1 f9 1f             	sar    $0x1f,%ecx
+  80296c:	c1 e9 11             	shr    $0x11,%ecx
+  80296f:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802972:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802977:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  802979:	29 d3                	sub    %edx,%ebx
+  80297b:	ba 00 80 00 00       	mov    $0x8000,%edx
+  802980:	29 c2                	sub    %eax,%edx
+  802982:	39 d3                	cmp    %edx,%ebx
+  802984:	0f 47 da             	cmova  %edx,%ebx
+  802987:	8b 55 08             	mov    0x8(%ebp),%edx
+  80298a:	29 fa                	sub    %edi,%edx
+  80298c:	39 d3                	cmp    %edx,%ebx
+  80298e:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  802991:	83 ec 04             	sub    $0x4,%esp
+  802994:	53                   	push   %ebx
+  802995:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802998:	01 c8                	add    %ecx,%eax
+  80299a:	50                   	push   %eax
+  80299b:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80299e:	01 f8                	add    %edi,%eax
+  8029a0:	50                   	push   %eax
+  8029a1:	e8 f2 df ff ff       	call   800998 <memcpy>
+    i += m;
+  8029a6:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  8029a8:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8029aa:	89 f2                	mov    %esi,%edx
+  8029ac:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8029af:	e8 03 fd ff ff       	call   8026b7 <pipe_wakeup>
+  8029b4:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  8029b7:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  8029ba:	73 51                	jae    802a0d <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  8029bc:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  8029bf:	8b 16                	mov    (%esi),%edx
+  8029c1:	39 da                	cmp    %ebx,%edx
+  8029c3:	75 a2                	jne    802967 <devpipe_read_bulk+0x36>
+      if (i > 0)
+  8029c5:	85 ff                	test   %edi,%edi
+  8029c7:	75 44                	jne    802a0d <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  8029c9:	89 f2                	mov    %esi,%edx
+  8029cb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8029ce:	e8 90 fd ff ff       	call   802763 <_pipeisclosed>
+  8029d3:	85 c0                	test   %eax,%eax
+  8029d5:	75 3a                	jne    802a11 <devpipe_read_bulk+0xe0>
+  8029d7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8029dc:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  8029e0:	6a 64                	push   $0x64
+  8029e2:	ff 75 d4             	push   -0x2c(%ebp)
+  8029e5:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  8029e6:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  8029e9:	50                   	push   %eax
+  8029ea:	e8 29 e5 ff ff       	call   800f18 <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  8029ef:	85 c0                	test   %eax,%eax
+  8029f1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029f6:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  8029f9:	83 c4 10             	add    $0x10,%esp
+  8029fc:	a8 01                	test   $0x1,%al
+  8029fe:	74 b7                	je     8029b7 <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  802a00:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  802a05:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a08:	5b                   	pop    %ebx
+  802a09:	5e                   	pop    %esi
+  802a0a:	5f                   	pop    %edi
+  802a0b:	5d                   	pop    %ebp
+  802a0c:	c3                   	ret
+  return i;
+  802a0d:	89 f8                	mov    %edi,%eax
+  802a0f:	eb f4                	jmp    802a05 <devpipe_read_bulk+0xd4>
+        return 0;
+  802a11:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a16:	eb ed                	jmp    802a05 <devpipe_read_bulk+0xd4>
+
+00802a18 <devpipe_read>:
+{
+  802a18:	55                   	push   %ebp
+  802a19:	89 e5                	mov    %esp,%ebp
+  802a1b:	57                   	push   %edi
+  802a1c:	56                   	push   %esi
+  802a1d:	53                   	push   %ebx
+  802a1e:	83 ec 18             	sub    $0x18,%esp
+  802a21:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  802a24:	57                   	push   %edi
+  802a25:	e8 0b ec ff ff       	call   801635 <fd2data>
+  802a2a:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  802a2c:	8b 70 28             	mov    0x28(%eax),%esi
+  802a2f:	83 c4 10             	add    $0x10,%esp
+  802a32:	85 f6                	test   %esi,%esi
+  802a34:	75 24                	jne    802a5a <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  802a36:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802a39:	74 60                	je     802a9b <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  802a3b:	8b 03                	mov    (%ebx),%eax
+  802a3d:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802a40:	75 3b                	jne    802a7d <devpipe_read+0x65>
+      if (i > 0)
+  802a42:	85 f6                	test   %esi,%esi
+  802a44:	75 2d                	jne    802a73 <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  802a46:	89 da                	mov    %ebx,%edx
+  802a48:	89 f8                	mov    %edi,%eax
+  802a4a:	e8 14 fd ff ff       	call   802763 <_pipeisclosed>
+  802a4f:	85 c0                	test   %eax,%eax
+  802a51:	75 4c                	jne    802a9f <devpipe_read+0x87>
+      sys_yield();
+  802a53:	e8 25 e1 ff ff       	call   800b7d <sys_yield>
+  802a58:	eb e1                	jmp    802a3b <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  802a5a:	83 ec 08             	sub    $0x8,%esp
+  802a5d:	6a 00                	push   $0x0
+  802a5f:	ff 75 10             	push   0x10(%ebp)
+  802a62:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802a65:	89 c2                	mov    %eax,%edx
+  802a67:	89 f8                	mov    %edi,%eax
+  802a69:	e8 c3 fe ff ff       	call   802931 <devpipe_read_bulk>
+  802a6e:	83 c4 10             	add    $0x10,%esp
+  802a71:	eb 02                	jmp    802a75 <devpipe_read+0x5d>
+        return i;
+  802a73:	89 f0                	mov    %esi,%eax
+}
+  802a75:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a78:	5b                   	pop    %ebx
+  802a79:	5e                   	pop    %esi
+  802a7a:	5f                   	pop    %edi
+  802a7b:	5d                   	pop    %ebp
+  802a7c:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802a7d:	99                   	cltd
+  802a7e:	c1 ea 1b             	shr    $0x1b,%edx
+  802a81:	01 d0                	add    %edx,%eax
+  802a83:	83 e0 1f             	and    $0x1f,%eax
+  802a86:	29 d0                	sub    %edx,%eax
+  802a88:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802a8d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802a90:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  802a93:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  802a96:	83 c6 01             	add    $0x1,%esi
+  802a99:	eb 9b                	jmp    802a36 <devpipe_read+0x1e>
+  return i;
+  802a9b:	89 f0                	mov    %esi,%eax
+  802a9d:	eb d6                	jmp    802a75 <devpipe_read+0x5d>
+        return 0;
+  802a9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aa4:	eb cf                	jmp    802a75 <devpipe_read+0x5d>
+
+00802aa6 <pipe2>:
+{
+  802aa6:	55                   	push   %ebp
+  802aa7:	89 e5                	mov    %esp,%ebp
+  802aa9:	57                   	push   %edi
+  802aaa:	56                   	push   %esi
+  802aab:	53                   	push   %ebx
+  802aac:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  802aaf:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802ab2:	50                   	push   %eax
+  802ab3:	e8 91 eb ff ff       	call   801649 <fd_alloc>
+  802ab8:	89 c3                	mov    %eax,%ebx
+  802aba:	83 c4 10             	add    $0x10,%esp
+  802abd:	85 c0                	test   %eax,%eax
+  802abf:	0f 88 fb 01 00 00    	js     802cc0 <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802ac5:	83 ec 04             	sub    $0x4,%esp
+  802ac8:	68 07 04 00 00       	push   $0x407
+  802acd:	ff 75 e4             	push   -0x1c(%ebp)
+  802ad0:	6a 00                	push   $0x0
+  802ad2:	e8 08 e1 ff ff       	call   800bdf <sys_page_alloc>
+  802ad7:	89 c3                	mov    %eax,%ebx
+  802ad9:	83 c4 10             	add    $0x10,%esp
+  802adc:	85 c0                	test   %eax,%eax
+  802ade:	0f 88 dc 01 00 00    	js     802cc0 <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  802ae4:	83 ec 0c             	sub    $0xc,%esp
+  802ae7:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  802aea:	50                   	push   %eax
+  802aeb:	e8 59 eb ff ff       	call   801649 <fd_alloc>
+  802af0:	89 c3                	mov    %eax,%ebx
+  802af2:	83 c4 10             	add    $0x10,%esp
+  802af5:	85 c0                	test   %eax,%eax
+  802af7:	0f 88 b3 01 00 00    	js     802cb0 <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802afd:	83 ec 04             	sub    $0x4,%esp
+  802b00:	68 07 04 00 00       	push   $0x407
+  802b05:	ff 75 e0             	push   -0x20(%ebp)
+  802b08:	6a 00                	push   $0x0
+  802b0a:	e8 d0 e0 ff ff       	call   800bdf <sys_page_alloc>
+  802b0f:	89 c3                	mov    %eax,%ebx
+  802b11:	83 c4 10             	add    $0x10,%esp
+  802b14:	85 c0                	test   %eax,%eax
+  802b16:	0f 88 94 01 00 00    	js     802cb0 <pipe2+0x20a>
+  va = fd2data(fd0);
+  802b1c:	83 ec 0c             	sub    $0xc,%esp
+  802b1f:	ff 75 e4             	push   -0x1c(%ebp)
+  802b22:	e8 0e eb ff ff       	call   801635 <fd2data>
+  802b27:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802b29:	83 c4 0c             	add    $0xc,%esp
+  802b2c:	68 07 04 00 00       	push   $0x407
+  802b31:	50                   	push   %eax
+  802b32:	6a 00                	push   $0x0
+  802b34:	e8 a6 e0 ff ff       	call   800bdf <sys_page_alloc>
+  802b39:	89 c3                	mov    %eax,%ebx
+  802b3b:	83 c4 10             	add    $0x10,%esp
+  802b3e:	85 c0                	test   %eax,%eax
+  802b40:	0f 88 5a 01 00 00    	js     802ca0 <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802b46:	83 ec 0c             	sub    $0xc,%esp
+  802b49:	ff 75 e0             	push   -0x20(%ebp)
+  802b4c:	e8 e4 ea ff ff       	call   801635 <fd2data>
+  802b51:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802b58:	50                   	push   %eax
+  802b59:	6a 00                	push   $0x0
+  802b5b:	57                   	push   %edi
+  802b5c:	6a 00                	push   $0x0
+  802b5e:	e8 bf e0 ff ff       	call   800c22 <sys_page_map>
+  802b63:	89 c3                	mov    %eax,%ebx
+  802b65:	83 c4 20             	add    $0x20,%esp
+  802b68:	85 c0                	test   %eax,%eax
+  802b6a:	0f 88 22 01 00 00    	js     802c92 <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  802b70:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  802b74:	74 72                	je     802be8 <pipe2+0x142>
+  802b76:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  802b7b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802b7e:	e8 d3 fa ff ff       	call   802656 <pipe_ring>
+  802b83:	83 ec 04             	sub    $0x4,%esp
+  802b86:	68 07 04 00 00       	push   $0x407
+  802b8b:	01 f0                	add    %esi,%eax
+  802b8d:	50                   	push   %eax
+  802b8e:	6a 00                	push   $0x0
+  802b90:	e8 4a e0 ff ff       	call   800bdf <sys_page_alloc>
+  802b95:	89 c3                	mov    %eax,%ebx
+  802b97:	83 c4 10             	add    $0x10,%esp
+  802b9a:	85 c0                	test   %eax,%eax
+  802b9c:	0f 88 97 00 00 00    	js     802c39 <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  802ba2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802ba5:	e8 ac fa ff ff       	call   802656 <pipe_ring>
+  802baa:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  802bad:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802bb0:	e8 a1 fa ff ff       	call   802656 <pipe_ring>
+  802bb5:	83 ec 0c             	sub    $0xc,%esp
+  802bb8:	68 07 04 00 00       	push   $0x407
+  802bbd:	53                   	push   %ebx
+  802bbe:	6a 00                	push   $0x0
+  802bc0:	01 f0                	add    %esi,%eax
+  802bc2:	50                   	push   %eax
+  802bc3:	6a 00                	push   $0x0
+  802bc5:	e8 58 e0 ff ff       	call   800c22 <sys_page_map>
+  802bca:	89 c3                	mov    %eax,%ebx
+  802bcc:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802bd2:	83 c4 20             	add    $0x20,%esp
+  802bd5:	85 c0                	test   %eax,%eax
+  802bd7:	78 60                	js     802c39 <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  802bd9:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802bdf:	75 9a                	jne    802b7b <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  802be1:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  802be8:	a1 20 40 80 00       	mov    0x804020,%eax
+  802bed:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802bf0:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  802bf2:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802bf5:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  802bfc:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802bff:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  802c01:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802c04:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  802c0b:	83 ec 0c             	sub    $0xc,%esp
+  802c0e:	ff 75 e4             	push   -0x1c(%ebp)
+  802c11:	e8 0f ea ff ff       	call   801625 <fd2num>
+  802c16:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802c19:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  802c1b:	83 c4 04             	add    $0x4,%esp
+  802c1e:	ff 75 e0             	push   -0x20(%ebp)
+  802c21:	e8 ff e9 ff ff       	call   801625 <fd2num>
+  802c26:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802c29:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  802c2c:	83 c4 10             	add    $0x10,%esp
+  802c2f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c34:	e9 87 00 00 00       	jmp    802cc0 <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802c39:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  802c3e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802c41:	e8 10 fa ff ff       	call   802656 <pipe_ring>
+  802c46:	83 ec 08             	sub    $0x8,%esp
+  802c49:	01 f0                	add    %esi,%eax
+  802c4b:	50                   	push   %eax
+  802c4c:	6a 00                	push   $0x0
+  802c4e:	e8 11 e0 ff ff       	call   800c64 <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  802c53:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802c56:	e8 fb f9 ff ff       	call   802656 <pipe_ring>
+  802c5b:	83 c4 08             	add    $0x8,%esp
+  802c5e:	01 f0                	add    %esi,%eax
+  802c60:	50                   	push   %eax
+  802c61:	6a 00                	push   $0x0
+  802c63:	e8 fc df ff ff       	call   800c64 <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802c68:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802c6e:	83 c4 10             	add    $0x10,%esp
+  802c71:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802c77:	75 c5                	jne    802c3e <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  802c79:	83 ec 0c             	sub    $0xc,%esp
+  802c7c:	ff 75 e0             	push   -0x20(%ebp)
+  802c7f:	e8 b1 e9 ff ff       	call   801635 <fd2data>
+  802c84:	83 c4 08             	add    $0x8,%esp
+  802c87:	50                   	push   %eax
+  802c88:	6a 00                	push   $0x0
+  802c8a:	e8 d5 df ff ff       	call   800c64 <sys_page_unmap>
+  802c8f:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  802c92:	83 ec 08             	sub    $0x8,%esp
+  802c95:	57                   	push   %edi
+  802c96:	6a 00                	push   $0x0
+  802c98:	e8 c7 df ff ff       	call   800c64 <sys_page_unmap>
+  802c9d:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  802ca0:	83 ec 08             	sub    $0x8,%esp
+  802ca3:	ff 75 e0             	push   -0x20(%ebp)
+  802ca6:	6a 00                	push   $0x0
+  802ca8:	e8 b7 df ff ff       	call   800c64 <sys_page_unmap>
+  802cad:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  802cb0:	83 ec 08             	sub    $0x8,%esp
+  802cb3:	ff 75 e4             	push   -0x1c(%ebp)
+  802cb6:	6a 00                	push   $0x0
+  802cb8:	e8 a7 df ff ff       	call   800c64 <sys_page_unmap>
+  802cbd:	83 c4 10             	add    $0x10,%esp
+}
+  802cc0:	89 d8                	mov    %ebx,%eax
+  802cc2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802cc5:	5b                   	pop    %ebx
+  802cc6:	5e                   	pop    %esi
+  802cc7:	5f                   	pop    %edi
+  802cc8:	5d                   	pop    %ebp
+  802cc9:	c3                   	ret
+
+00802cca <pipe>:
+{
+  802cca:	55                   	push   %ebp
+  802ccb:	89 e5                	mov    %esp,%ebp
+  802ccd:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  802cd0:	6a 00                	push   $0x0
+  802cd2:	ff 75 08             	push   0x8(%ebp)
+  802cd5:	e8 cc fd ff ff       	call   802aa6 <pipe2>
+}
+  802cda:	c9                   	leave
+  802cdb:	c3                   	ret
+
+00802cdc <pipeisclosed>:
+{
+  802cdc:	55                   	push   %ebp
+  802cdd:	89 e5                	mov    %esp,%ebp
+  802cdf:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802ce2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802ce5:	50                   	push   %eax
+  802ce6:	ff 75 08             	push   0x8(%ebp)
+  802ce9:	e8 b1 e9 ff ff       	call   80169f <fd_lookup>
+  802cee:	83 c4 10             	add    $0x10,%esp
+  802cf1:	85 c0                	test   %eax,%eax
+  802cf3:	78 18                	js     802d0d <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  802cf5:	83 ec 0c             	sub    $0xc,%esp
+  802cf8:	ff 75 f4             	push   -0xc(%ebp)
+  802cfb:	e8 35 e9 ff ff       	call   801635 <fd2data>
+  802d00:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  802d02:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802d05:	e8 59 fa ff ff       	call   802763 <_pipeisclosed>
+  802d0a:	83 c4 10             	add    $0x10,%esp
+}
+  802d0d:	c9                   	leave
+  802d0e:	c3                   	ret
+
+00802d0f <pipe_splice>:
+{
+  802d0f:	55                   	push   %ebp
+  802d10:	89 e5                	mov    %esp,%ebp
+  802d12:	57                   	push   %edi
+  802d13:	56                   	push   %esi
+  802d14:	53                   	push   %ebx
+  802d15:	83 ec 34             	sub    $0x34,%esp
+  802d18:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802d1b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802d1e:	50                   	push   %eax
+  802d1f:	ff 75 08             	push   0x8(%ebp)
+  802d22:	e8 78 e9 ff ff       	call   80169f <fd_lookup>
+  802d27:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802d2a:	83 c4 10             	add    $0x10,%esp
+  802d2d:	85 c0                	test   %eax,%eax
+  802d2f:	0f 88 d7 00 00 00    	js     802e0c <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  802d35:	83 ec 0c             	sub    $0xc,%esp
+  802d38:	ff 75 e4             	push   -0x1c(%ebp)
+  802d3b:	e8 f5 e8 ff ff       	call   801635 <fd2data>
+  802d40:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802d42:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802d45:	83 c4 10             	add    $0x10,%esp
+  802d48:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802d4e:	39 10                	cmp    %edx,(%eax)
+  802d50:	0f 85 c1 00 00 00    	jne    802e17 <pipe_splice+0x108>
+  802d56:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  802d5a:	0f 84 c0 00 00 00    	je     802e20 <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  802d60:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802d64:	0f 84 bf 00 00 00    	je     802e29 <pipe_splice+0x11a>
+  802d6a:	89 f7                	mov    %esi,%edi
+  802d6c:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  802d72:	0f 85 ba 00 00 00    	jne    802e32 <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802d78:	8d 43 04             	lea    0x4(%ebx),%eax
+  802d7b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802d7e:	eb 38                	jmp    802db8 <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802d80:	83 ec 0c             	sub    $0xc,%esp
+  802d83:	68 00 10 00 00       	push   $0x1000
+  802d88:	89 f1                	mov    %esi,%ecx
+  802d8a:	89 da                	mov    %ebx,%edx
+  802d8c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802d8f:	e8 34 fa ff ff       	call   8027c8 <devpipe_write_bulk>
+  802d94:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802d97:	83 c4 10             	add    $0x10,%esp
+  802d9a:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802d9f:	75 53                	jne    802df4 <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  802da1:	83 ec 08             	sub    $0x8,%esp
+  802da4:	56                   	push   %esi
+  802da5:	6a 00                	push   $0x0
+  802da7:	e8 b8 de ff ff       	call   800c64 <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  802dac:	83 c7 01             	add    $0x1,%edi
+  802daf:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802db5:	83 c4 10             	add    $0x10,%esp
+  802db8:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802dbb:	74 3a                	je     802df7 <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  802dbd:	8b 03                	mov    (%ebx),%eax
+  802dbf:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802dc2:	75 bc                	jne    802d80 <pipe_splice+0x71>
+  802dc4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dc9:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  802dcd:	85 c0                	test   %eax,%eax
+  802dcf:	74 af                	je     802d80 <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802dd1:	83 ec 04             	sub    $0x4,%esp
+  802dd4:	6a 07                	push   $0x7
+  802dd6:	56                   	push   %esi
+  802dd7:	ff 75 d0             	push   -0x30(%ebp)
+  802dda:	e8 5c e1 ff ff       	call   800f3b <sys_chan_wakeup>
+  802ddf:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802de2:	83 c4 10             	add    $0x10,%esp
+  802de5:	85 c0                	test   %eax,%eax
+  802de7:	79 b8                	jns    802da1 <pipe_splice+0x92>
+  802de9:	b8 01 00 00 00       	mov    $0x1,%eax
+  802dee:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802df2:	eb 8c                	jmp    802d80 <pipe_splice+0x71>
+  802df4:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  802df7:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802dfb:	75 06                	jne    802e03 <pipe_splice+0xf4>
+  802dfd:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802e01:	78 09                	js     802e0c <pipe_splice+0xfd>
+  return i * PGSIZE;
+  802e03:	8b 45 10             	mov    0x10(%ebp),%eax
+  802e06:	c1 e0 0c             	shl    $0xc,%eax
+  802e09:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  802e0c:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802e0f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e12:	5b                   	pop    %ebx
+  802e13:	5e                   	pop    %esi
+  802e14:	5f                   	pop    %edi
+  802e15:	5d                   	pop    %ebp
+  802e16:	c3                   	ret
+    return -E_INVAL;
+  802e17:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802e1e:	eb ec                	jmp    802e0c <pipe_splice+0xfd>
+  802e20:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802e27:	eb e3                	jmp    802e0c <pipe_splice+0xfd>
+  802e29:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802e30:	eb da                	jmp    802e0c <pipe_splice+0xfd>
+  802e32:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802e39:	eb d1                	jmp    802e0c <pipe_splice+0xfd>
+
+00802e3b <pipe_splice_read>:
+{
+  802e3b:	55                   	push   %ebp
+  802e3c:	89 e5                	mov    %esp,%ebp
+  802e3e:	53                   	push   %ebx
+  802e3f:	83 ec 1c             	sub    $0x1c,%esp
+  802e42:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802e45:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802e48:	50                   	push   %eax
+  802e49:	ff 75 08             	push   0x8(%ebp)
+  802e4c:	e8 4e e8 ff ff       	call   80169f <fd_lookup>
+  802e51:	83 c4 10             	add    $0x10,%esp
+  802e54:	85 c0                	test   %eax,%eax
+  802e56:	78 49                	js     802ea1 <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  802e58:	83 ec 0c             	sub    $0xc,%esp
+  802e5b:	ff 75 f4             	push   -0xc(%ebp)
+  802e5e:	e8 d2 e7 ff ff       	call   801635 <fd2data>
+  802e63:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802e65:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802e68:	83 c4 10             	add    $0x10,%esp
+  802e6b:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  802e71:	39 08                	cmp    %ecx,(%eax)
+  802e73:	75 31                	jne    802ea6 <pipe_splice_read+0x6b>
+  802e75:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  802e79:	74 32                	je     802ead <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  802e7b:	8b 48 08             	mov    0x8(%eax),%ecx
+  802e7e:	83 e1 03             	and    $0x3,%ecx
+  802e81:	83 f9 01             	cmp    $0x1,%ecx
+  802e84:	74 2e                	je     802eb4 <pipe_splice_read+0x79>
+  802e86:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  802e8c:	75 2d                	jne    802ebb <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  802e8e:	83 ec 08             	sub    $0x8,%esp
+  802e91:	53                   	push   %ebx
+  802e92:	68 00 10 00 00       	push   $0x1000
+  802e97:	89 d9                	mov    %ebx,%ecx
+  802e99:	e8 93 fa ff ff       	call   802931 <devpipe_read_bulk>
+  802e9e:	83 c4 10             	add    $0x10,%esp
+}
+  802ea1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ea4:	c9                   	leave
+  802ea5:	c3                   	ret
+    return -E_INVAL;
+  802ea6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802eab:	eb f4                	jmp    802ea1 <pipe_splice_read+0x66>
+  802ead:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802eb2:	eb ed                	jmp    802ea1 <pipe_splice_read+0x66>
+  802eb4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802eb9:	eb e6                	jmp    802ea1 <pipe_splice_read+0x66>
+  802ebb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ec0:	eb df                	jmp    802ea1 <pipe_splice_read+0x66>
+
+00802ec2 <mmap_find>:
+          utf->utf_eip, utf->utf_err);
+}
+
+static struct Mmap *
+mmap_find(uintptr_t va)
+{
+  802ec2:	55                   	push   %ebp
+  802ec3:	89 e5                	mov    %esp,%ebp
+  802ec5:	56                   	push   %esi
+  802ec6:	53                   	push   %ebx
+  int i;
+
+  for (i = 0; i < NMMAP; i++)
+  802ec7:	ba 60 57 80 00       	mov    $0x805760,%edx
+  802ecc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ed1:	eb 0b                	jmp    802ede <mmap_find+0x1c>
+  802ed3:	83 c3 01             	add    $0x1,%ebx
+  802ed6:	83 c2 14             	add    $0x14,%edx
+  802ed9:	83 fb 10             	cmp    $0x10,%ebx
+  802edc:	74 1d                	je     802efb <mmap_find+0x39>
+    if (mmaps[i].mm_va && va >= mmaps[i].mm_va &&
+  802ede:	8b 0a                	mov    (%edx),%ecx
+  802ee0:	39 c8                	cmp    %ecx,%eax
+  802ee2:	72 ef                	jb     802ed3 <mmap_find+0x11>
+  802ee4:	85 c9                	test   %ecx,%ecx
+  802ee6:	74 eb                	je     802ed3 <mmap_find+0x11>
+        va < mmaps[i].mm_va + mmaps[i].mm_len)
+  802ee8:	03 4a 04             	add    0x4(%edx),%ecx
+    if (mmaps[i].mm_va && va >= mmaps[i].mm_va &&
+  802eeb:	39 c8                	cmp    %ecx,%eax
+  802eed:	73 e4                	jae    802ed3 <mmap_find+0x11>
+      return &mmaps[i];
+  802eef:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802ef2:	8d 04 85 60 57 80 00 	lea    0x805760(,%eax,4),%eax
+  802ef9:	eb 05                	jmp    802f00 <mmap_find+0x3e>
+  return NULL;
+  802efb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802f00:	5b                   	pop    %ebx
+  802f01:	5e                   	pop    %esi
+  802f02:	5d                   	pop    %ebp
+  802f03:	c3                   	ret
+
+00802f04 <va_mapped>:
+
+static bool
+va_mapped(uintptr_t va)
+{
+  return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+  802f04:	89 c2                	mov    %eax,%edx
+  802f06:	c1 ea 16             	shr    $0x16,%edx
+  802f09:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802f10:	f6 c2 01             	test   $0x1,%dl
+  802f13:	74 11                	je     802f26 <va_mapped+0x22>
+  802f15:	c1 e8 0c             	shr    $0xc,%eax
+  802f18:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802f1f:	83 e0 01             	and    $0x1,%eax
+  802f22:	83 e0 01             	and    $0x1,%eax
+}
+  802f25:	c3                   	ret
+  return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+  802f26:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f2b:	eb f5                	jmp    802f22 <va_mapped+0x1e>
+
+00802f2d <mmap_copy>:
+
+// Replace the page at 'va' with a copy of its first 'n' bytes, the rest
+// zeroed, mapped with 'perm'.
+static void
+mmap_copy(uintptr_t va, size_t n, int perm)
+{
+  802f2d:	55                   	push   %ebp
+  802f2e:	89 e5                	mov    %esp,%ebp
+  802f30:	57                   	push   %edi
+  802f31:	56                   	push   %esi
+  802f32:	53                   	push   %ebx
+  802f33:	83 ec 10             	sub    $0x10,%esp
+  802f36:	89 c3                	mov    %eax,%ebx
+  802f38:	89 d7                	mov    %edx,%edi
+  802f3a:	89 ce                	mov    %ecx,%esi
+  int r;
+
+  if ((r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  802f3c:	6a 07                	push   $0x7
+  802f3e:	68 00 f0 7f 00       	push   $0x7ff000
+  802f43:	6a 00                	push   $0x0
+  802f45:	e8 95 dc ff ff       	call   800bdf <sys_page_alloc>
+  802f4a:	83 c4 10             	add    $0x10,%esp
+  802f4d:	85 c0                	test   %eax,%eax
+  802f4f:	78 46                	js     802f97 <mmap_copy+0x6a>
+    panic("mmap: %e", r);
+  memmove(PFTEMP, (void *) va, n);
+  802f51:	83 ec 04             	sub    $0x4,%esp
+  802f54:	57                   	push   %edi
+  802f55:	53                   	push   %ebx
+  802f56:	68 00 f0 7f 00       	push   $0x7ff000
+  802f5b:	e8 d6 d9 ff ff       	call   800936 <memmove>
+  if ((r = sys_page_map(0, PFTEMP, 0, (void *) va, perm)) < 0 ||
+  802f60:	89 34 24             	mov    %esi,(%esp)
+  802f63:	53                   	push   %ebx
+  802f64:	6a 00                	push   $0x0
+  802f66:	68 00 f0 7f 00       	push   $0x7ff000
+  802f6b:	6a 00                	push   $0x0
+  802f6d:	e8 b0 dc ff ff       	call   800c22 <sys_page_map>
+  802f72:	83 c4 20             	add    $0x20,%esp
+  802f75:	85 c0                	test   %eax,%eax
+  802f77:	78 30                	js     802fa9 <mmap_copy+0x7c>
+      (r = sys_page_unmap(0, PFTEMP)) < 0)
+  802f79:	83 ec 08             	sub    $0x8,%esp
+  802f7c:	68 00 f0 7f 00       	push   $0x7ff000
+  802f81:	6a 00                	push   $0x0
+  802f83:	e8 dc dc ff ff       	call   800c64 <sys_page_unmap>
+  if ((r = sys_page_map(0, PFTEMP, 0, (void *) va, perm)) < 0 ||
+  802f88:	83 c4 10             	add    $0x10,%esp
+  802f8b:	85 c0                	test   %eax,%eax
+  802f8d:	78 1a                	js     802fa9 <mmap_copy+0x7c>
+    panic("mmap: %e", r);
+}
+  802f8f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f92:	5b                   	pop    %ebx
+  802f93:	5e                   	pop    %esi
+  802f94:	5f                   	pop    %edi
+  802f95:	5d                   	pop    %ebp
+  802f96:	c3                   	ret
+    panic("mmap: %e", r);
+  802f97:	50                   	push   %eax
+  802f98:	68 eb 3e 80 00       	push   $0x803eeb
+  802f9d:	6a 3e                	push   $0x3e
+  802f9f:	68 f4 3e 80 00       	push   $0x803ef4
+  802fa4:	e8 a1 06 00 00       	call   80364a <_panic>
+    panic("mmap: %e", r);
+  802fa9:	50                   	push   %eax
+  802faa:	68 eb 3e 80 00       	push   $0x803eeb
+  802faf:	6a 42                	push   $0x42
+  802fb1:	68 f4 3e 80 00       	push   $0x803ef4
+  802fb6:	e8 8f 06 00 00       	call   80364a <_panic>
+
+00802fbb <mmap_fault>:
+// Handle a page fault in a mapping, if it is one.  Returns 1 if it was.
+// The fork page fault handlers call this first, so that mappings keep
+// working after a fork.
+bool
+mmap_fault(struct UTrapframe *utf)
+{
+  802fbb:	55                   	push   %ebp
+  802fbc:	89 e5                	mov    %esp,%ebp
+  802fbe:	57                   	push   %edi
+  802fbf:	56                   	push   %esi
+  802fc0:	53                   	push   %ebx
+  802fc1:	83 ec 1c             	sub    $0x1c,%esp
+  802fc4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Fsreq_read_map saved;
+  struct Mmap *m;
+  uintptr_t va;
+  int perm, r;
+
+  va = ROUNDDOWN(utf->utf_fault_va, PGSIZE);
+  802fc7:	8b 1f                	mov    (%edi),%ebx
+  802fc9:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if (va < MMAPBASE || va >= MMAPTOP || (m = mmap_find(va)) == NULL)
+  802fcf:	8d 83 00 00 00 60    	lea    0x60000000(%ebx),%eax
+  802fd5:	3d ff ff ff 2f       	cmp    $0x2fffffff,%eax
+  802fda:	0f 87 24 01 00 00    	ja     803104 <mmap_fault+0x149>
+  802fe0:	89 d8                	mov    %ebx,%eax
+  802fe2:	e8 db fe ff ff       	call   802ec2 <mmap_find>
+  802fe7:	89 c6                	mov    %eax,%esi
+  802fe9:	85 c0                	test   %eax,%eax
+  802feb:	0f 84 20 01 00 00    	je     803111 <mmap_fault+0x156>
+    return 0;
+  if ((utf->utf_err & FEC_WR) && m->mm_perm == MAP_RDONLY)
+  802ff1:	f6 47 04 02          	testb  $0x2,0x4(%edi)
+  802ff5:	74 13                	je     80300a <mmap_fault+0x4f>
+  802ff7:	83 78 10 00          	cmpl   $0x0,0x10(%eax)
+  802ffb:	0f 84 17 01 00 00    	je     803118 <mmap_fault+0x15d>
+    return 0;
+  perm = PTE_P | PTE_U | (m->mm_perm == MAP_RDONLY ? 0 : PTE_W);
+  803001:	c7 45 e4 07 00 00 00 	movl   $0x7,-0x1c(%ebp)
+  803008:	eb 0f                	jmp    803019 <mmap_fault+0x5e>
+  80300a:	83 78 10 01          	cmpl   $0x1,0x10(%eax)
+  80300e:	19 c0                	sbb    %eax,%eax
+  803010:	83 e0 fe             	and    $0xfffffffe,%eax
+  803013:	83 c0 07             	add    $0x7,%eax
+  803016:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+
+  if (!va_mapped(va)) {
+  803019:	89 d8                	mov    %ebx,%eax
+  80301b:	e8 e4 fe ff ff       	call   802f04 <va_mapped>
+  803020:	84 c0                	test   %al,%al
+  803022:	74 42                	je     803066 <mmap_fault+0xab>
+    }
+  }
+
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+    mmap_copy(va, PGSIZE, perm);
+  return 1;
+  803024:	b8 01 00 00 00       	mov    $0x1,%eax
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+  803029:	f6 47 04 02          	testb  $0x2,0x4(%edi)
+  80302d:	0f 84 d6 00 00 00    	je     803109 <mmap_fault+0x14e>
+  803033:	89 d8                	mov    %ebx,%eax
+  803035:	c1 e8 0c             	shr    $0xc,%eax
+  803038:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  return 1;
+  80303f:	b8 01 00 00 00       	mov    $0x1,%eax
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+  803044:	f6 c2 02             	test   $0x2,%dl
+  803047:	0f 85 bc 00 00 00    	jne    803109 <mmap_fault+0x14e>
+    mmap_copy(va, PGSIZE, perm);
+  80304d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803050:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803055:	89 d8                	mov    %ebx,%eax
+  803057:	e8 d1 fe ff ff       	call   802f2d <mmap_copy>
+  return 1;
+  80305c:	b8 01 00 00 00       	mov    $0x1,%eax
+  803061:	e9 a3 00 00 00       	jmp    803109 <mmap_fault+0x14e>
+    saved = fsipcbuf.read_map;
+  803066:	a1 00 60 80 00       	mov    0x806000,%eax
+  80306b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80306e:	8b 15 04 60 80 00    	mov    0x806004,%edx
+  803074:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    r = read_map(m->mm_fd, m->mm_offset + (va - m->mm_va), (void *) va);
+  803077:	83 ec 04             	sub    $0x4,%esp
+  80307a:	53                   	push   %ebx
+  80307b:	89 d8                	mov    %ebx,%eax
+  80307d:	03 46 0c             	add    0xc(%esi),%eax
+  803080:	2b 06                	sub    (%esi),%eax
+  803082:	50                   	push   %eax
+  803083:	ff 76 08             	push   0x8(%esi)
+  803086:	e8 86 f3 ff ff       	call   802411 <read_map>
+    fsipcbuf.read_map = saved;
+  80308b:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80308e:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+  803094:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  803097:	89 15 04 60 80 00    	mov    %edx,0x806004
+    if (r < 0)
+  80309d:	83 c4 10             	add    $0x10,%esp
+  8030a0:	85 c0                	test   %eax,%eax
+  8030a2:	78 20                	js     8030c4 <mmap_fault+0x109>
+    if (r == 0) {
+  8030a4:	74 30                	je     8030d6 <mmap_fault+0x11b>
+    if (r < PGSIZE) {
+  8030a6:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  8030ab:	0f 8f 73 ff ff ff    	jg     803024 <mmap_fault+0x69>
+      mmap_copy(va, r, perm);
+  8030b1:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8030b4:	89 c2                	mov    %eax,%edx
+  8030b6:	89 d8                	mov    %ebx,%eax
+  8030b8:	e8 70 fe ff ff       	call   802f2d <mmap_copy>
+      return 1;
+  8030bd:	b8 01 00 00 00       	mov    $0x1,%eax
+  8030c2:	eb 45                	jmp    803109 <mmap_fault+0x14e>
+      panic("mmap: read_map: %e", r);
+  8030c4:	50                   	push   %eax
+  8030c5:	68 ff 3e 80 00       	push   $0x803eff
+  8030ca:	6a 5f                	push   $0x5f
+  8030cc:	68 f4 3e 80 00       	push   $0x803ef4
+  8030d1:	e8 74 05 00 00       	call   80364a <_panic>
+      if ((r = sys_page_alloc(0, (void *) va, perm)) < 0)
+  8030d6:	83 ec 04             	sub    $0x4,%esp
+  8030d9:	ff 75 e4             	push   -0x1c(%ebp)
+  8030dc:	53                   	push   %ebx
+  8030dd:	6a 00                	push   $0x0
+  8030df:	e8 fb da ff ff       	call   800bdf <sys_page_alloc>
+  8030e4:	83 c4 10             	add    $0x10,%esp
+  8030e7:	85 c0                	test   %eax,%eax
+  8030e9:	78 07                	js     8030f2 <mmap_fault+0x137>
+      return 1;
+  8030eb:	b8 01 00 00 00       	mov    $0x1,%eax
+  8030f0:	eb 17                	jmp    803109 <mmap_fault+0x14e>
+        panic("mmap: %e", r);
+  8030f2:	50                   	push   %eax
+  8030f3:	68 eb 3e 80 00       	push   $0x803eeb
+  8030f8:	6a 64                	push   $0x64
+  8030fa:	68 f4 3e 80 00       	push   $0x803ef4
+  8030ff:	e8 46 05 00 00       	call   80364a <_panic>
+    return 0;
+  803104:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803109:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80310c:	5b                   	pop    %ebx
+  80310d:	5e                   	pop    %esi
+  80310e:	5f                   	pop    %edi
+  80310f:	5d                   	pop    %ebp
+  803110:	c3                   	ret
+    return 0;
+  803111:	b8 00 00 00 00       	mov    $0x0,%eax
+  803116:	eb f1                	jmp    803109 <mmap_fault+0x14e>
+    return 0;
+  803118:	b8 00 00 00 00       	mov    $0x0,%eax
+  80311d:	eb ea                	jmp    803109 <mmap_fault+0x14e>
+
+0080311f <mmap_pgfault>:
+{
+  80311f:	55                   	push   %ebp
+  803120:	89 e5                	mov    %esp,%ebp
+  803122:	53                   	push   %ebx
+  803123:	83 ec 10             	sub    $0x10,%esp
+  803126:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (!mmap_fault(utf))
+  803129:	53                   	push   %ebx
+  80312a:	e8 8c fe ff ff       	call   802fbb <mmap_fault>
+  80312f:	83 c4 10             	add    $0x10,%esp
+  803132:	84 c0                	test   %al,%al
+  803134:	74 05                	je     80313b <mmap_pgfault+0x1c>
+}
+  803136:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803139:	c9                   	leave
+  80313a:	c3                   	ret
+    panic("page fault at %08x, eip %08x, err %04x", utf->utf_fault_va,
+  80313b:	83 ec 08             	sub    $0x8,%esp
+  80313e:	ff 73 04             	push   0x4(%ebx)
+  803141:	ff 73 28             	push   0x28(%ebx)
+  803144:	ff 33                	push   (%ebx)
+  803146:	68 14 3f 80 00       	push   $0x803f14
+  80314b:	6a 20                	push   $0x20
+  80314d:	68 f4 3e 80 00       	push   $0x803ef4
+  803152:	e8 f3 04 00 00       	call   80364a <_panic>
+
+00803157 <mmap>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_INVAL if offset isn't aligned, len is 0, or perm is unknown
+//	-E_NO_MEM if there's no free slot or address space for it
+int
+mmap(int fdnum, off_t offset, size_t len, int perm, void **addr)
+{
+  803157:	55                   	push   %ebp
+  803158:	89 e5                	mov    %esp,%ebp
+  80315a:	57                   	push   %edi
+  80315b:	56                   	push   %esi
+  80315c:	53                   	push   %ebx
+  80315d:	83 ec 44             	sub    $0x44,%esp
+  803160:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  struct Fd *fd;
+  uintptr_t va;
+  int i, j, r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803163:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  803166:	50                   	push   %eax
+  803167:	ff 75 08             	push   0x8(%ebp)
+  80316a:	e8 30 e5 ff ff       	call   80169f <fd_lookup>
+  80316f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  803172:	83 c4 10             	add    $0x10,%esp
+  803175:	85 c0                	test   %eax,%eax
+  803177:	0f 88 3e 01 00 00    	js     8032bb <mmap+0x164>
+    return r;
+  if (offset < 0 || PGOFF(offset) || len == 0 ||
+  80317d:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803181:	0f 88 d1 00 00 00    	js     803258 <mmap+0x101>
+  803187:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80318a:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80318f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  803192:	0f 85 c9 00 00 00    	jne    803261 <mmap+0x10a>
+  803198:	85 db                	test   %ebx,%ebx
+  80319a:	0f 84 ca 00 00 00    	je     80326a <mmap+0x113>
+  8031a0:	83 7d 14 02          	cmpl   $0x2,0x14(%ebp)
+  8031a4:	0f 87 c0 00 00 00    	ja     80326a <mmap+0x113>
+      (perm != MAP_RDONLY && perm != MAP_PRIVATE && perm != MAP_SHARED))
+    return -E_INVAL;
+  len = ROUNDUP(len, PGSIZE);
+  8031aa:	81 c3 ff 0f 00 00    	add    $0xfff,%ebx
+  8031b0:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  8031b6:	89 d9                	mov    %ebx,%ecx
+  8031b8:	89 5d c4             	mov    %ebx,-0x3c(%ebp)
+
+  // First fit: try the start of the region and the end of each
+  // mapping.
+  for (i = -1; i < NMMAP; i++) {
+  8031bb:	bb 4c 57 80 00       	mov    $0x80574c,%ebx
+  8031c0:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+    if (i >= 0 && !mmaps[i].mm_va)
+      continue;
+    va = i < 0 ? MMAPBASE : mmaps[i].mm_va + mmaps[i].mm_len;
+  8031c5:	bf 00 00 00 a0       	mov    $0xa0000000,%edi
+  8031ca:	eb 53                	jmp    80321f <mmap+0xc8>
+  8031cc:	bf 00 00 00 a0       	mov    $0xa0000000,%edi
+  8031d1:	eb 4c                	jmp    80321f <mmap+0xc8>
+    if (len > MMAPTOP - va)
+      continue;
+    for (j = 0; j < NMMAP; j++)
+  8031d3:	83 c0 01             	add    $0x1,%eax
+  8031d6:	83 f8 10             	cmp    $0x10,%eax
+  8031d9:	0f 84 e7 00 00 00    	je     8032c6 <mmap+0x16f>
+      if (mmaps[j].mm_va && va < mmaps[j].mm_va + mmaps[j].mm_len &&
+  8031df:	8d 34 80             	lea    (%eax,%eax,4),%esi
+  8031e2:	8b 14 b5 60 57 80 00 	mov    0x805760(,%esi,4),%edx
+  8031e9:	85 d2                	test   %edx,%edx
+  8031eb:	74 e6                	je     8031d3 <mmap+0x7c>
+  8031ed:	89 d1                	mov    %edx,%ecx
+  8031ef:	03 0c b5 64 57 80 00 	add    0x805764(,%esi,4),%ecx
+  8031f6:	39 cf                	cmp    %ecx,%edi
+  8031f8:	73 d9                	jae    8031d3 <mmap+0x7c>
+  8031fa:	39 da                	cmp    %ebx,%edx
+  8031fc:	73 d5                	jae    8031d3 <mmap+0x7c>
+  8031fe:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  803201:	8b 55 cc             	mov    -0x34(%ebp),%edx
+  803204:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  for (i = -1; i < NMMAP; i++) {
+  803207:	83 c2 01             	add    $0x1,%edx
+  80320a:	83 c3 14             	add    $0x14,%ebx
+  80320d:	83 fa 10             	cmp    $0x10,%edx
+  803210:	74 2b                	je     80323d <mmap+0xe6>
+    if (i >= 0 && !mmaps[i].mm_va)
+  803212:	85 d2                	test   %edx,%edx
+  803214:	78 b6                	js     8031cc <mmap+0x75>
+  803216:	8b 3b                	mov    (%ebx),%edi
+  803218:	85 ff                	test   %edi,%edi
+  80321a:	74 eb                	je     803207 <mmap+0xb0>
+    va = i < 0 ? MMAPBASE : mmaps[i].mm_va + mmaps[i].mm_len;
+  80321c:	03 7b 04             	add    0x4(%ebx),%edi
+    if (len > MMAPTOP - va)
+  80321f:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  803224:	29 f8                	sub    %edi,%eax
+  803226:	39 c8                	cmp    %ecx,%eax
+  803228:	72 dd                	jb     803207 <mmap+0xb0>
+    for (j = 0; j < NMMAP; j++)
+  80322a:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+          mmaps[j].mm_va < va + len)
+  80322d:	8d 34 0f             	lea    (%edi,%ecx,1),%esi
+  803230:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  803233:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  803236:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+  803239:	89 f3                	mov    %esi,%ebx
+  80323b:	eb a2                	jmp    8031df <mmap+0x88>
+        break;
+    if (j == NMMAP)
+      break;
+  }
+  if (i == NMMAP)
+    return -E_NO_MEM;
+  80323d:	c7 45 d4 fc ff ff ff 	movl   $0xfffffffc,-0x2c(%ebp)
+  803244:	eb 75                	jmp    8032bb <mmap+0x164>
+    ;
+  if (j == NMMAP)
+    return -E_NO_MEM;
+
+  if (_pgfault_handler == 0)
+    set_pgfault_handler(mmap_pgfault);
+  803246:	83 ec 0c             	sub    $0xc,%esp
+  803249:	68 1f 31 80 00       	push   $0x80311f
+  80324e:	e8 3d 04 00 00       	call   803690 <set_pgfault_handler>
+  803253:	83 c4 10             	add    $0x10,%esp
+  803256:	eb 24                	jmp    80327c <mmap+0x125>
+    return -E_INVAL;
+  803258:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  80325f:	eb 5a                	jmp    8032bb <mmap+0x164>
+  803261:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  803268:	eb 51                	jmp    8032bb <mmap+0x164>
+  80326a:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  803271:	eb 48                	jmp    8032bb <mmap+0x164>
+  if (_pgfault_handler == 0)
+  803273:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  80327a:	74 ca                	je     803246 <mmap+0xef>
+
+  mmaps[j].mm_va = va;
+  80327c:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803283:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803286:	c1 e2 02             	shl    $0x2,%edx
+  803289:	89 ba 60 57 80 00    	mov    %edi,0x805760(%edx)
+  mmaps[j].mm_len = len;
+  80328f:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  803292:	89 b2 64 57 80 00    	mov    %esi,0x805764(%edx)
+  mmaps[j].mm_fd = fdnum;
+  803298:	8b 75 08             	mov    0x8(%ebp),%esi
+  80329b:	89 b2 68 57 80 00    	mov    %esi,0x805768(%edx)
+  mmaps[j].mm_offset = offset;
+  8032a1:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8032a4:	89 b2 6c 57 80 00    	mov    %esi,0x80576c(%edx)
+  mmaps[j].mm_perm = perm;
+  8032aa:	01 d8                	add    %ebx,%eax
+  8032ac:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  8032af:	89 1c 85 70 57 80 00 	mov    %ebx,0x805770(,%eax,4)
+  *addr = (void *) va;
+  8032b6:	8b 45 18             	mov    0x18(%ebp),%eax
+  8032b9:	89 38                	mov    %edi,(%eax)
+  return 0;
+}
+  8032bb:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8032be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8032c1:	5b                   	pop    %ebx
+  8032c2:	5e                   	pop    %esi
+  8032c3:	5f                   	pop    %edi
+  8032c4:	5d                   	pop    %ebp
+  8032c5:	c3                   	ret
+  if (i == NMMAP)
+  8032c6:	b8 60 57 80 00       	mov    $0x805760,%eax
+  for (j = 0; j < NMMAP && mmaps[j].mm_va; j++)
+  8032cb:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+  8032ce:	83 c0 14             	add    $0x14,%eax
+  8032d1:	83 78 ec 00          	cmpl   $0x0,-0x14(%eax)
+  8032d5:	74 9c                	je     803273 <mmap+0x11c>
+  8032d7:	83 c3 01             	add    $0x1,%ebx
+  8032da:	83 fb 10             	cmp    $0x10,%ebx
+  8032dd:	75 ef                	jne    8032ce <mmap+0x177>
+    return -E_NO_MEM;
+  8032df:	c7 45 d4 fc ff ff ff 	movl   $0xfffffffc,-0x2c(%ebp)
+  8032e6:	eb d3                	jmp    8032bb <mmap+0x164>
+
+008032e8 <msync>:
+// nothing for other kinds of mapping.
+//
+// Returns 0 on success, < 0 on error.
+int
+msync(void *addr)
+{
+  8032e8:	55                   	push   %ebp
+  8032e9:	89 e5                	mov    %esp,%ebp
+  8032eb:	57                   	push   %edi
+  8032ec:	56                   	push   %esi
+  8032ed:	53                   	push   %ebx
+  8032ee:	81 ec ac 00 00 00    	sub    $0xac,%esp
+  struct Stat st;
+  off_t saved, off;
+  uintptr_t va;
+  int n, r;
+
+  if ((m = mmap_find((uintptr_t) addr)) == NULL)
+  8032f4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032f7:	e8 c6 fb ff ff       	call   802ec2 <mmap_find>
+  8032fc:	85 c0                	test   %eax,%eax
+  8032fe:	0f 84 58 01 00 00    	je     80345c <msync+0x174>
+  803304:	89 c7                	mov    %eax,%edi
+    return -E_INVAL;
+  if (m->mm_perm != MAP_SHARED)
+    return 0;
+  803306:	bb 00 00 00 00       	mov    $0x0,%ebx
+  if (m->mm_perm != MAP_SHARED)
+  80330b:	83 78 10 02          	cmpl   $0x2,0x10(%eax)
+  80330f:	74 0a                	je     80331b <msync+0x33>
+                          PTE_P | PTE_U | PTE_W)) < 0)
+      break;
+  }
+  fd->fd_offset = saved;
+  return r < 0 ? r : 0;
+}
+  803311:	89 d8                	mov    %ebx,%eax
+  803313:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803316:	5b                   	pop    %ebx
+  803317:	5e                   	pop    %esi
+  803318:	5f                   	pop    %edi
+  803319:	5d                   	pop    %ebp
+  80331a:	c3                   	ret
+  if ((r = fd_lookup(m->mm_fd, &fd)) < 0 || (r = fstat(m->mm_fd, &st)) < 0)
+  80331b:	83 ec 08             	sub    $0x8,%esp
+  80331e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  803321:	50                   	push   %eax
+  803322:	ff 77 08             	push   0x8(%edi)
+  803325:	e8 75 e3 ff ff       	call   80169f <fd_lookup>
+  80332a:	89 c3                	mov    %eax,%ebx
+  80332c:	83 c4 10             	add    $0x10,%esp
+  80332f:	85 c0                	test   %eax,%eax
+  803331:	78 de                	js     803311 <msync+0x29>
+  803333:	83 ec 08             	sub    $0x8,%esp
+  803336:	8d 85 58 ff ff ff    	lea    -0xa8(%ebp),%eax
+  80333c:	50                   	push   %eax
+  80333d:	ff 77 08             	push   0x8(%edi)
+  803340:	e8 fd e7 ff ff       	call   801b42 <fstat>
+  803345:	89 c3                	mov    %eax,%ebx
+  803347:	83 c4 10             	add    $0x10,%esp
+  80334a:	85 c0                	test   %eax,%eax
+  80334c:	78 c3                	js     803311 <msync+0x29>
+  saved = fd->fd_offset;
+  80334e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803351:	8b 40 04             	mov    0x4(%eax),%eax
+  803354:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%ebp)
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE) {
+  80335a:	8b 37                	mov    (%edi),%esi
+  80335c:	eb 29                	jmp    803387 <msync+0x9f>
+    if ((r = sys_page_map(0, (void *) va, 0, (void *) va,
+  80335e:	83 ec 0c             	sub    $0xc,%esp
+  803361:	6a 07                	push   $0x7
+  803363:	8b 85 50 ff ff ff    	mov    -0xb0(%ebp),%eax
+  803369:	50                   	push   %eax
+  80336a:	6a 00                	push   $0x0
+  80336c:	50                   	push   %eax
+  80336d:	6a 00                	push   $0x0
+  80336f:	e8 ae d8 ff ff       	call   800c22 <sys_page_map>
+  803374:	89 c3                	mov    %eax,%ebx
+  803376:	83 c4 20             	add    $0x20,%esp
+  803379:	85 c0                	test   %eax,%eax
+  80337b:	0f 88 c0 00 00 00    	js     803441 <msync+0x159>
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE) {
+  803381:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803387:	8b 07                	mov    (%edi),%eax
+  803389:	89 85 54 ff ff ff    	mov    %eax,-0xac(%ebp)
+  80338f:	03 47 04             	add    0x4(%edi),%eax
+  803392:	39 c6                	cmp    %eax,%esi
+  803394:	0f 83 a7 00 00 00    	jae    803441 <msync+0x159>
+    if (!va_mapped(va) || !(uvpt[PGNUM(va)] & PTE_D))
+  80339a:	89 f0                	mov    %esi,%eax
+  80339c:	e8 63 fb ff ff       	call   802f04 <va_mapped>
+  8033a1:	84 c0                	test   %al,%al
+  8033a3:	74 dc                	je     803381 <msync+0x99>
+  8033a5:	89 f0                	mov    %esi,%eax
+  8033a7:	c1 e8 0c             	shr    $0xc,%eax
+  8033aa:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8033b1:	a8 40                	test   $0x40,%al
+  8033b3:	74 cc                	je     803381 <msync+0x99>
+    off = m->mm_offset + (va - m->mm_va);
+  8033b5:	8b 47 0c             	mov    0xc(%edi),%eax
+  8033b8:	8b 8d 54 ff ff ff    	mov    -0xac(%ebp),%ecx
+  8033be:	29 c8                	sub    %ecx,%eax
+  8033c0:	01 f0                	add    %esi,%eax
+    if (off >= st.st_size)
+  8033c2:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8033c5:	39 c2                	cmp    %eax,%edx
+  8033c7:	7e 78                	jle    803441 <msync+0x159>
+    n = MIN(PGSIZE, st.st_size - off);
+  8033c9:	29 c2                	sub    %eax,%edx
+  8033cb:	89 d1                	mov    %edx,%ecx
+  8033cd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8033d2:	39 d1                	cmp    %edx,%ecx
+  8033d4:	0f 4e d1             	cmovle %ecx,%edx
+  8033d7:	89 95 54 ff ff ff    	mov    %edx,-0xac(%ebp)
+    if ((r = seek(m->mm_fd, off)) < 0 ||
+  8033dd:	83 ec 08             	sub    $0x8,%esp
+  8033e0:	50                   	push   %eax
+  8033e1:	ff 77 08             	push   0x8(%edi)
+  8033e4:	e8 b1 e6 ff ff       	call   801a9a <seek>
+  8033e9:	89 c3                	mov    %eax,%ebx
+  8033eb:	83 c4 10             	add    $0x10,%esp
+  8033ee:	85 c0                	test   %eax,%eax
+  8033f0:	78 4f                	js     803441 <msync+0x159>
+        (r = write(m->mm_fd, (void *) va, n)) < 0)
+  8033f2:	89 b5 50 ff ff ff    	mov    %esi,-0xb0(%ebp)
+  8033f8:	83 ec 04             	sub    $0x4,%esp
+  8033fb:	ff b5 54 ff ff ff    	push   -0xac(%ebp)
+  803401:	56                   	push   %esi
+  803402:	ff 77 08             	push   0x8(%edi)
+  803405:	e8 0e e6 ff ff       	call   801a18 <write>
+  80340a:	89 c3                	mov    %eax,%ebx
+    if ((r = seek(m->mm_fd, off)) < 0 ||
+  80340c:	83 c4 10             	add    $0x10,%esp
+  80340f:	85 c0                	test   %eax,%eax
+  803411:	78 2e                	js     803441 <msync+0x159>
+    if (r < n && (r = write(m->mm_fd, (char *) va + r, n - r)) < 0)
+  803413:	8b 95 54 ff ff ff    	mov    -0xac(%ebp),%edx
+  803419:	39 c2                	cmp    %eax,%edx
+  80341b:	0f 8e 3d ff ff ff    	jle    80335e <msync+0x76>
+  803421:	89 d0                	mov    %edx,%eax
+  803423:	29 d8                	sub    %ebx,%eax
+  803425:	01 f3                	add    %esi,%ebx
+  803427:	83 ec 04             	sub    $0x4,%esp
+  80342a:	50                   	push   %eax
+  80342b:	53                   	push   %ebx
+  80342c:	ff 77 08             	push   0x8(%edi)
+  80342f:	e8 e4 e5 ff ff       	call   801a18 <write>
+  803434:	89 c3                	mov    %eax,%ebx
+  803436:	83 c4 10             	add    $0x10,%esp
+  803439:	85 c0                	test   %eax,%eax
+  80343b:	0f 89 1d ff ff ff    	jns    80335e <msync+0x76>
+  fd->fd_offset = saved;
+  803441:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803444:	8b 8d 4c ff ff ff    	mov    -0xb4(%ebp),%ecx
+  80344a:	89 48 04             	mov    %ecx,0x4(%eax)
+  return r < 0 ? r : 0;
+  80344d:	85 db                	test   %ebx,%ebx
+  80344f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803454:	0f 4f d8             	cmovg  %eax,%ebx
+  803457:	e9 b5 fe ff ff       	jmp    803311 <msync+0x29>
+    return -E_INVAL;
+  80345c:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  803461:	e9 ab fe ff ff       	jmp    803311 <msync+0x29>
+
+00803466 <munmap>:
+// Remove the mapping at 'addr', writing a MAP_SHARED one back first.
+//
+// Returns 0 on success, < 0 on error.
+int
+munmap(void *addr)
+{
+  803466:	55                   	push   %ebp
+  803467:	89 e5                	mov    %esp,%ebp
+  803469:	56                   	push   %esi
+  80346a:	53                   	push   %ebx
+  80346b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct Mmap *m;
+  uintptr_t va;
+  int r;
+
+  if ((m = mmap_find((uintptr_t) addr)) == NULL)
+  80346e:	89 d8                	mov    %ebx,%eax
+  803470:	e8 4d fa ff ff       	call   802ec2 <mmap_find>
+  803475:	85 c0                	test   %eax,%eax
+  803477:	74 56                	je     8034cf <munmap+0x69>
+  803479:	89 c6                	mov    %eax,%esi
+    return -E_INVAL;
+  if ((r = msync(addr)) < 0)
+  80347b:	83 ec 0c             	sub    $0xc,%esp
+  80347e:	53                   	push   %ebx
+  80347f:	e8 64 fe ff ff       	call   8032e8 <msync>
+  803484:	83 c4 10             	add    $0x10,%esp
+  803487:	85 c0                	test   %eax,%eax
+  803489:	78 3d                	js     8034c8 <munmap+0x62>
+    return r;
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE)
+  80348b:	8b 1e                	mov    (%esi),%ebx
+  80348d:	eb 06                	jmp    803495 <munmap+0x2f>
+  80348f:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803495:	8b 46 04             	mov    0x4(%esi),%eax
+  803498:	03 06                	add    (%esi),%eax
+  80349a:	39 c3                	cmp    %eax,%ebx
+  80349c:	73 1f                	jae    8034bd <munmap+0x57>
+    if (va_mapped(va) && (r = sys_page_unmap(0, (void *) va)) < 0)
+  80349e:	89 d8                	mov    %ebx,%eax
+  8034a0:	e8 5f fa ff ff       	call   802f04 <va_mapped>
+  8034a5:	84 c0                	test   %al,%al
+  8034a7:	74 e6                	je     80348f <munmap+0x29>
+  8034a9:	83 ec 08             	sub    $0x8,%esp
+  8034ac:	53                   	push   %ebx
+  8034ad:	6a 00                	push   $0x0
+  8034af:	e8 b0 d7 ff ff       	call   800c64 <sys_page_unmap>
+  8034b4:	83 c4 10             	add    $0x10,%esp
+  8034b7:	85 c0                	test   %eax,%eax
+  8034b9:	79 d4                	jns    80348f <munmap+0x29>
+  8034bb:	eb 0b                	jmp    8034c8 <munmap+0x62>
+      return r;
+  m->mm_va = 0;
+  8034bd:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  return 0;
+  8034c3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8034c8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8034cb:	5b                   	pop    %ebx
+  8034cc:	5e                   	pop    %esi
+  8034cd:	5d                   	pop    %ebp
+  8034ce:	c3                   	ret
+    return -E_INVAL;
+  8034cf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8034d4:	eb f2                	jmp    8034c8 <munmap+0x62>
+
+008034d6 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  8034d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034db:	c3                   	ret
+
+008034dc <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8034dc:	55                   	push   %ebp
+  8034dd:	89 e5                	mov    %esp,%ebp
+  8034df:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  8034e2:	68 3b 3f 80 00       	push   $0x803f3b
+  8034e7:	ff 75 0c             	push   0xc(%ebp)
+  8034ea:	e8 c1 d2 ff ff       	call   8007b0 <strcpy>
+  return 0;
+}
+  8034ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034f4:	c9                   	leave
+  8034f5:	c3                   	ret
+
+008034f6 <devcons_write>:
+{
+  8034f6:	55                   	push   %ebp
+  8034f7:	89 e5                	mov    %esp,%ebp
+  8034f9:	57                   	push   %edi
+  8034fa:	56                   	push   %esi
+  8034fb:	53                   	push   %ebx
+  8034fc:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  803502:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  803507:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  80350d:	eb 2e                	jmp    80353d <devcons_write+0x47>
+    m = n - tot;
+  80350f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803512:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  803514:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803519:	39 c3                	cmp    %eax,%ebx
+  80351b:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  80351e:	83 ec 04             	sub    $0x4,%esp
+  803521:	53                   	push   %ebx
+  803522:	89 f0                	mov    %esi,%eax
+  803524:	03 45 0c             	add    0xc(%ebp),%eax
+  803527:	50                   	push   %eax
+  803528:	57                   	push   %edi
+  803529:	e8 08 d4 ff ff       	call   800936 <memmove>
+    sys_cputs(buf, m);
+  80352e:	83 c4 08             	add    $0x8,%esp
+  803531:	53                   	push   %ebx
+  803532:	57                   	push   %edi
+  803533:	e8 a8 d5 ff ff       	call   800ae0 <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  803538:	01 de                	add    %ebx,%esi
+  80353a:	83 c4 10             	add    $0x10,%esp
+  80353d:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803540:	72 cd                	jb     80350f <devcons_write+0x19>
+}
+  803542:	89 f0                	mov    %esi,%eax
+  803544:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803547:	5b                   	pop    %ebx
+  803548:	5e                   	pop    %esi
+  803549:	5f                   	pop    %edi
+  80354a:	5d                   	pop    %ebp
+  80354b:	c3                   	ret
+
+0080354c <devcons_read>:
+{
+  80354c:	55                   	push   %ebp
+  80354d:	89 e5                	mov    %esp,%ebp
+  80354f:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  803552:	b8 00 00 00 00       	mov    $0x0,%eax
+  803557:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80355b:	75 07                	jne    803564 <devcons_read+0x18>
+  80355d:	eb 1f                	jmp    80357e <devcons_read+0x32>
+    sys_yield();
+  80355f:	e8 19 d6 ff ff       	call   800b7d <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  803564:	e8 95 d5 ff ff       	call   800afe <sys_cgetc>
+  803569:	85 c0                	test   %eax,%eax
+  80356b:	74 f2                	je     80355f <devcons_read+0x13>
+  if (c < 0)
+  80356d:	78 0f                	js     80357e <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  80356f:	83 f8 04             	cmp    $0x4,%eax
+  803572:	74 0c                	je     803580 <devcons_read+0x34>
+  *(char*)vbuf = c;
+  803574:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803577:	88 02                	mov    %al,(%edx)
+  return 1;
+  803579:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80357e:	c9                   	leave
+  80357f:	c3                   	ret
+    return 0;
+  803580:	b8 00 00 00 00       	mov    $0x0,%eax
+  803585:	eb f7                	jmp    80357e <devcons_read+0x32>
+
+00803587 <cputchar>:
+{
+  803587:	55                   	push   %ebp
+  803588:	89 e5                	mov    %esp,%ebp
+  80358a:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  80358d:	8b 45 08             	mov    0x8(%ebp),%eax
+  803590:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  803593:	6a 01                	push   $0x1
+  803595:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803598:	50                   	push   %eax
+  803599:	e8 42 d5 ff ff       	call   800ae0 <sys_cputs>
+}
+  80359e:	83 c4 10             	add    $0x10,%esp
+  8035a1:	c9                   	leave
+  8035a2:	c3                   	ret
+
+008035a3 <getchar>:
+{
+  8035a3:	55                   	push   %ebp
+  8035a4:	89 e5                	mov    %esp,%ebp
+  8035a6:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  8035a9:	6a 01                	push   $0x1
+  8035ab:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8035ae:	50                   	push   %eax
+  8035af:	6a 00                	push   $0x0
+  8035b1:	e8 94 e3 ff ff       	call   80194a <read>
+  if (r < 0)
+  8035b6:	83 c4 10             	add    $0x10,%esp
+  8035b9:	85 c0                	test   %eax,%eax
+  8035bb:	78 06                	js     8035c3 <getchar+0x20>
+  if (r < 1)
+  8035bd:	74 06                	je     8035c5 <getchar+0x22>
+  return c;
+  8035bf:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8035c3:	c9                   	leave
+  8035c4:	c3                   	ret
+    return -E_EOF;
+  8035c5:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8035ca:	eb f7                	jmp    8035c3 <getchar+0x20>
+
+008035cc <iscons>:
+{
+  8035cc:	55                   	push   %ebp
+  8035cd:	89 e5                	mov    %esp,%ebp
+  8035cf:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8035d2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8035d5:	50                   	push   %eax
+  8035d6:	ff 75 08             	push   0x8(%ebp)
+  8035d9:	e8 c1 e0 ff ff       	call   80169f <fd_lookup>
+  8035de:	83 c4 10             	add    $0x10,%esp
+  8035e1:	85 c0                	test   %eax,%eax
+  8035e3:	78 11                	js     8035f6 <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  8035e5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8035e8:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  8035ee:	39 10                	cmp    %edx,(%eax)
+  8035f0:	0f 94 c0             	sete   %al
+  8035f3:	0f b6 c0             	movzbl %al,%eax
+}
+  8035f6:	c9                   	leave
+  8035f7:	c3                   	ret
+
+008035f8 <opencons>:
+{
+  8035f8:	55                   	push   %ebp
+  8035f9:	89 e5                	mov    %esp,%ebp
+  8035fb:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  8035fe:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803601:	50                   	push   %eax
+  803602:	e8 42 e0 ff ff       	call   801649 <fd_alloc>
+  803607:	83 c4 10             	add    $0x10,%esp
+  80360a:	85 c0                	test   %eax,%eax
+  80360c:	78 3a                	js     803648 <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80360e:	83 ec 04             	sub    $0x4,%esp
+  803611:	68 07 04 00 00       	push   $0x407
+  803616:	ff 75 f4             	push   -0xc(%ebp)
+  803619:	6a 00                	push   $0x0
+  80361b:	e8 bf d5 ff ff       	call   800bdf <sys_page_alloc>
+  803620:	83 c4 10             	add    $0x10,%esp
+  803623:	85 c0                	test   %eax,%eax
+  803625:	78 21                	js     803648 <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  803627:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80362a:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  803630:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  803632:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803635:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  80363c:	83 ec 0c             	sub    $0xc,%esp
+  80363f:	50                   	push   %eax
+  803640:	e8 e0 df ff ff       	call   801625 <fd2num>
+  803645:	83 c4 10             	add    $0x10,%esp
+}
+  803648:	c9                   	leave
+  803649:	c3                   	ret
+
+0080364a <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80364a:	55                   	push   %ebp
+  80364b:	89 e5                	mov    %esp,%ebp
+  80364d:	56                   	push   %esi
+  80364e:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  80364f:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  803652:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  803658:	e8 01 d5 ff ff       	call   800b5e <sys_getenvid>
+  80365d:	83 ec 0c             	sub    $0xc,%esp
+  803660:	ff 75 0c             	push   0xc(%ebp)
+  803663:	ff 75 08             	push   0x8(%ebp)
+  803666:	56                   	push   %esi
+  803667:	50                   	push   %eax
+  803668:	68 48 3f 80 00       	push   $0x803f48
+  80366d:	e8 50 cb ff ff       	call   8001c2 <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  803672:	83 c4 18             	add    $0x18,%esp
+  803675:	53                   	push   %ebx
+  803676:	ff 75 10             	push   0x10(%ebp)
+  803679:	e8 f3 ca ff ff       	call   800171 <vcprintf>
+  cprintf("\n");
+  80367e:	c7 04 24 e4 3e 80 00 	movl   $0x803ee4,(%esp)
+  803685:	e8 38 cb ff ff       	call   8001c2 <cprintf>
+  80368a:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  80368d:	cc                   	int3
+  while (1)
+  80368e:	eb fd                	jmp    80368d <_panic+0x43>
+
+00803690 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  803690:	55                   	push   %ebp
+  803691:	89 e5                	mov    %esp,%ebp
+  803693:	53                   	push   %ebx
+  803694:	83 ec 04             	sub    $0x4,%esp
+  int r;
+
+  if (_pgfault_handler == 0) {
+  803697:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  80369e:	74 0d                	je     8036ad <set_pgfault_handler+0x1d>
+
+    sys_env_set_pgfault_upcall(id, _pgfault_upcall);
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  8036a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8036a3:	a3 00 70 80 00       	mov    %eax,0x807000
+}
+  8036a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8036ab:	c9                   	leave
+  8036ac:	c3                   	ret
+    envid_t id = sys_getenvid();
+  8036ad:	e8 ac d4 ff ff       	call   800b5e <sys_getenvid>
+  8036b2:	89 c3                	mov    %eax,%ebx
+    sys_page_alloc(id, (void *) (UXSTACKTOP - PGSIZE), (PTE_P | PTE_U | PTE_W));
+  8036b4:	83 ec 04             	sub    $0x4,%esp
+  8036b7:	6a 07                	push   $0x7
+  8036b9:	68 00 f0 bf ee       	push   $0xeebff000
+  8036be:	50                   	push   %eax
+  8036bf:	e8 1b d5 ff ff       	call   800bdf <sys_page_alloc>
+    sys_env_set_pgfault_upcall(id, _pgfault_upcall);
+  8036c4:	83 c4 08             	add    $0x8,%esp
+  8036c7:	68 d7 36 80 00       	push   $0x8036d7
+  8036cc:	53                   	push   %ebx
+  8036cd:	e8 82 d7 ff ff       	call   800e54 <sys_env_set_pgfault_upcall>
+  8036d2:	83 c4 10             	add    $0x10,%esp
+  8036d5:	eb c9                	jmp    8036a0 <set_pgfault_handler+0x10>
+
+008036d7 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8036d7:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8036d8:	a1 00 70 80 00       	mov    0x807000,%eax
+	call *%eax
+  8036dd:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8036df:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+  movl 48(%esp), %eax       // move trap time esp to eax
+  8036e2:	8b 44 24 30          	mov    0x30(%esp),%eax
+  subl $4, %eax             // make room for eip on trap time esp
+  8036e6:	83 e8 04             	sub    $0x4,%eax
+  movl %eax, 48(%esp)       // move value to esp
+  8036e9:	89 44 24 30          	mov    %eax,0x30(%esp)
+  movl 40(%esp), %ebx       // move trap time eip to ebx
+  8036ed:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+  movl %ebx, 0(%eax)
+  8036f1:	89 18                	mov    %ebx,(%eax)
+
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+  addl $0x08,%esp
+  8036f3:	83 c4 08             	add    $0x8,%esp
+  popal
+  8036f6:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+  addl $4, %esp          // skip tf->eip
+  8036f7:	83 c4 04             	add    $0x4,%esp
+  popf                 // pop stack value into flags register
+  8036fa:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+  popl %esp
+  8036fb:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+  ret
+  8036fc:	c3                   	ret
+
+008036fd <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8036fd:	55                   	push   %ebp
+  8036fe:	89 e5                	mov    %esp,%ebp
+  803700:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  803703:	89 c2                	mov    %eax,%edx
+  803705:	c1 ea 16             	shr    $0x16,%edx
+  803708:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  80370f:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  803714:	f6 c1 01             	test   $0x1,%cl
+  803717:	74 1c                	je     803735 <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  803719:	c1 e8 0c             	shr    $0xc,%eax
+  80371c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  803723:	a8 01                	test   $0x1,%al
+  803725:	74 0e                	je     803735 <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  803727:	c1 e8 0c             	shr    $0xc,%eax
+  80372a:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  803731:	ef 
+  803732:	0f b7 d2             	movzwl %dx,%edx
+}
+  803735:	89 d0                	mov    %edx,%eax
+  803737:	5d                   	pop    %ebp
+  803738:	c3                   	ret
+
+00803739 <udivmod>:
+  803739:	55                   	push   %ebp
+  80373a:	57                   	push   %edi
+  80373b:	56                   	push   %esi
+  80373c:	53                   	push   %ebx
+  80373d:	83 ec 14             	sub    $0x14,%esp
+  803740:	8b 74 24 28          	mov    0x28(%esp),%esi
+  803744:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  803748:	89 fb                	mov    %edi,%ebx
+  80374a:	09 f3                	or     %esi,%ebx
+  80374c:	0f 84 88 00 00 00    	je     8037da <udivmod+0xa1>
+  803752:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803757:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  80375e:	00 
+  80375f:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  803766:	00 
+  803767:	89 cd                	mov    %ecx,%ebp
+  803769:	89 34 24             	mov    %esi,(%esp)
+  80376c:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  803770:	eb 08                	jmp    80377a <udivmod+0x41>
+  803772:	83 ed 01             	sub    $0x1,%ebp
+  803775:	83 fd ff             	cmp    $0xffffffff,%ebp
+  803778:	74 6c                	je     8037e6 <udivmod+0xad>
+  80377a:	89 c3                	mov    %eax,%ebx
+  80377c:	89 d6                	mov    %edx,%esi
+  80377e:	89 e9                	mov    %ebp,%ecx
+  803780:	0f ad f3             	shrd   %cl,%esi,%ebx
+  803783:	d3 ee                	shr    %cl,%esi
+  803785:	f6 c1 20             	test   $0x20,%cl
+  803788:	74 04                	je     80378e <udivmod+0x55>
+  80378a:	89 f3                	mov    %esi,%ebx
+  80378c:	31 f6                	xor    %esi,%esi
+  80378e:	8b 3c 24             	mov    (%esp),%edi
+  803791:	39 fb                	cmp    %edi,%ebx
+  803793:	89 f7                	mov    %esi,%edi
+  803795:	8b 1c 24             	mov    (%esp),%ebx
+  803798:	8b 74 24 04          	mov    0x4(%esp),%esi
+  80379c:	19 f7                	sbb    %esi,%edi
+  80379e:	72 d2                	jb     803772 <udivmod+0x39>
+  8037a0:	89 f7                	mov    %esi,%edi
+  8037a2:	89 de                	mov    %ebx,%esi
+  8037a4:	89 e9                	mov    %ebp,%ecx
+  8037a6:	0f a5 f7             	shld   %cl,%esi,%edi
+  8037a9:	d3 e6                	shl    %cl,%esi
+  8037ab:	f6 c1 20             	test   $0x20,%cl
+  8037ae:	74 04                	je     8037b4 <udivmod+0x7b>
+  8037b0:	89 f7                	mov    %esi,%edi
+  8037b2:	31 f6                	xor    %esi,%esi
+  8037b4:	29 f0                	sub    %esi,%eax
+  8037b6:	19 fa                	sbb    %edi,%edx
+  8037b8:	be 01 00 00 00       	mov    $0x1,%esi
+  8037bd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037c2:	0f a5 f7             	shld   %cl,%esi,%edi
+  8037c5:	d3 e6                	shl    %cl,%esi
+  8037c7:	f6 c1 20             	test   $0x20,%cl
+  8037ca:	74 04                	je     8037d0 <udivmod+0x97>
+  8037cc:	89 f7                	mov    %esi,%edi
+  8037ce:	31 f6                	xor    %esi,%esi
+  8037d0:	09 74 24 08          	or     %esi,0x8(%esp)
+  8037d4:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8037d8:	eb 98                	jmp    803772 <udivmod+0x39>
+  8037da:	89 f0                	mov    %esi,%eax
+  8037dc:	89 fa                	mov    %edi,%edx
+  8037de:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8037e2:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  8037e6:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  8037ea:	89 01                	mov    %eax,(%ecx)
+  8037ec:	89 51 04             	mov    %edx,0x4(%ecx)
+  8037ef:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8037f3:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8037f7:	83 c4 14             	add    $0x14,%esp
+  8037fa:	5b                   	pop    %ebx
+  8037fb:	5e                   	pop    %esi
+  8037fc:	5f                   	pop    %edi
+  8037fd:	5d                   	pop    %ebp
+  8037fe:	c3                   	ret
+
+008037ff <__udivdi3>:
+  8037ff:	83 ec 18             	sub    $0x18,%esp
+  803802:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803806:	50                   	push   %eax
+  803807:	ff 74 24 2c          	push   0x2c(%esp)
+  80380b:	ff 74 24 2c          	push   0x2c(%esp)
+  80380f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803813:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803817:	e8 1d ff ff ff       	call   803739 <udivmod>
+  80381c:	83 c4 24             	add    $0x24,%esp
+  80381f:	c3                   	ret
+
+00803820 <__umoddi3>:
+  803820:	83 ec 18             	sub    $0x18,%esp
+  803823:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803827:	50                   	push   %eax
+  803828:	ff 74 24 2c          	push   0x2c(%esp)
+  80382c:	ff 74 24 2c          	push   0x2c(%esp)
+  803830:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803834:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803838:	e8 fc fe ff ff       	call   803739 <udivmod>
+  80383d:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803841:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803845:	83 c4 24             	add    $0x24,%esp
+  803848:	c3                   	ret
+
+00803849 <__divdi3>:
+  803849:	56                   	push   %esi
+  80384a:	53                   	push   %ebx
+  80384b:	83 ec 14             	sub    $0x14,%esp
+  80384e:	8b 44 24 20          	mov    0x20(%esp),%eax
+  803852:	8b 54 24 24          	mov    0x24(%esp),%edx
+  803856:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  80385a:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  80385e:	85 d2                	test   %edx,%edx
+  803860:	78 18                	js     80387a <__divdi3+0x31>
+  803862:	85 db                	test   %ebx,%ebx
+  803864:	78 3e                	js     8038a4 <__divdi3+0x5b>
+  803866:	83 ec 04             	sub    $0x4,%esp
+  803869:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80386d:	56                   	push   %esi
+  80386e:	53                   	push   %ebx
+  80386f:	51                   	push   %ecx
+  803870:	e8 c4 fe ff ff       	call   803739 <udivmod>
+  803875:	83 c4 10             	add    $0x10,%esp
+  803878:	eb 24                	jmp    80389e <__divdi3+0x55>
+  80387a:	f7 d8                	neg    %eax
+  80387c:	83 d2 00             	adc    $0x0,%edx
+  80387f:	f7 da                	neg    %edx
+  803881:	85 db                	test   %ebx,%ebx
+  803883:	78 3a                	js     8038bf <__divdi3+0x76>
+  803885:	83 ec 04             	sub    $0x4,%esp
+  803888:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80388c:	56                   	push   %esi
+  80388d:	53                   	push   %ebx
+  80388e:	51                   	push   %ecx
+  80388f:	e8 a5 fe ff ff       	call   803739 <udivmod>
+  803894:	83 c4 10             	add    $0x10,%esp
+  803897:	f7 d8                	neg    %eax
+  803899:	83 d2 00             	adc    $0x0,%edx
+  80389c:	f7 da                	neg    %edx
+  80389e:	83 c4 14             	add    $0x14,%esp
+  8038a1:	5b                   	pop    %ebx
+  8038a2:	5e                   	pop    %esi
+  8038a3:	c3                   	ret
+  8038a4:	83 ec 04             	sub    $0x4,%esp
+  8038a7:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8038ab:	56                   	push   %esi
+  8038ac:	f7 d9                	neg    %ecx
+  8038ae:	83 d3 00             	adc    $0x0,%ebx
+  8038b1:	f7 db                	neg    %ebx
+  8038b3:	53                   	push   %ebx
+  8038b4:	51                   	push   %ecx
+  8038b5:	e8 7f fe ff ff       	call   803739 <udivmod>
+  8038ba:	83 c4 10             	add    $0x10,%esp
+  8038bd:	eb d8                	jmp    803897 <__divdi3+0x4e>
+  8038bf:	83 ec 04             	sub    $0x4,%esp
+  8038c2:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8038c6:	56                   	push   %esi
+  8038c7:	f7 d9                	neg    %ecx
+  8038c9:	83 d3 00             	adc    $0x0,%ebx
+  8038cc:	f7 db                	neg    %ebx
+  8038ce:	53                   	push   %ebx
+  8038cf:	51                   	push   %ecx
+  8038d0:	e8 64 fe ff ff       	call   803739 <udivmod>
+  8038d5:	83 c4 10             	add    $0x10,%esp
+  8038d8:	eb c4                	jmp    80389e <__divdi3+0x55>
+
+008038da <__moddi3>:
+  8038da:	55                   	push   %ebp
+  8038db:	57                   	push   %edi
+  8038dc:	56                   	push   %esi
+  8038dd:	53                   	push   %ebx
+  8038de:	83 ec 24             	sub    $0x24,%esp
+  8038e1:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8038e5:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8038e9:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  8038ed:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  8038f1:	85 d2                	test   %edx,%edx
+  8038f3:	78 3b                	js     803930 <__moddi3+0x56>
+  8038f5:	83 ec 04             	sub    $0x4,%esp
+  8038f8:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8038fc:	56                   	push   %esi
+  8038fd:	89 ce                	mov    %ecx,%esi
+  8038ff:	f7 de                	neg    %esi
+  803901:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803905:	89 de                	mov    %ebx,%esi
+  803907:	83 d6 00             	adc    $0x0,%esi
+  80390a:	f7 de                	neg    %esi
+  80390c:	89 74 24 14          	mov    %esi,0x14(%esp)
+  803910:	8b 74 24 08          	mov    0x8(%esp),%esi
+  803914:	0f 48 f1             	cmovs  %ecx,%esi
+  803917:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  80391c:	53                   	push   %ebx
+  80391d:	56                   	push   %esi
+  80391e:	e8 16 fe ff ff       	call   803739 <udivmod>
+  803923:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803927:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80392b:	83 c4 10             	add    $0x10,%esp
+  80392e:	eb 47                	jmp    803977 <__moddi3+0x9d>
+  803930:	f7 d8                	neg    %eax
+  803932:	83 d2 00             	adc    $0x0,%edx
+  803935:	f7 da                	neg    %edx
+  803937:	83 ec 04             	sub    $0x4,%esp
+  80393a:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  80393e:	56                   	push   %esi
+  80393f:	89 cf                	mov    %ecx,%edi
+  803941:	f7 df                	neg    %edi
+  803943:	89 de                	mov    %ebx,%esi
+  803945:	83 d6 00             	adc    $0x0,%esi
+  803948:	f7 de                	neg    %esi
+  80394a:	0f 49 cf             	cmovns %edi,%ecx
+  80394d:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  803951:	0f 49 de             	cmovns %esi,%ebx
+  803954:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  803958:	ff 74 24 0c          	push   0xc(%esp)
+  80395c:	ff 74 24 0c          	push   0xc(%esp)
+  803960:	e8 d4 fd ff ff       	call   803739 <udivmod>
+  803965:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803969:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80396d:	f7 d8                	neg    %eax
+  80396f:	83 d2 00             	adc    $0x0,%edx
+  803972:	f7 da                	neg    %edx
+  803974:	83 c4 10             	add    $0x10,%esp
+  803977:	83 c4 24             	add    $0x24,%esp
+  80397a:	5b                   	pop    %ebx
+  80397b:	5e                   	pop    %esi
+  80397c:	5f                   	pop    %edi
+  80397d:	5d                   	pop    %ebp
+  80397e:	c3                   	ret
@@ -0,0 +1,7775 @@
+
+obj/user/pingpongs.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 d2 00 00 00       	call   800103 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+uint32_t val;
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 2c             	sub    $0x2c,%esp
+  envid_t who;
+  uint32_t i;
+
+  i = 0;
+  if ((who = sfork()) != 0) {
+  80003c:	e8 95 13 00 00       	call   8013d6 <sfork>
+  800041:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800044:	85 c0                	test   %eax,%eax
+  800046:	75 74                	jne    8000bc <umain+0x89>
+    cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+    ipc_send(who, 0, 0, 0);
+  }
+
+  while (1) {
+    ipc_recv(&who, 0, 0);
+  800048:	83 ec 04             	sub    $0x4,%esp
+  80004b:	6a 00                	push   $0x0
+  80004d:	6a 00                	push   $0x0
+  80004f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800052:	50                   	push   %eax
+  800053:	e8 30 15 00 00       	call   801588 <ipc_recv>
+    cprintf("%x got %d from %x (thisenv is %p %x)\n", sys_getenvid(), val, who, thisenv, thisenv->env_id);
+  800058:	8b 1d a4 58 80 00    	mov    0x8058a4,%ebx
+  80005e:	8b 7b 48             	mov    0x48(%ebx),%edi
+  800061:	8b 75 e4             	mov    -0x1c(%ebp),%esi
+  800064:	a1 a0 58 80 00       	mov    0x8058a0,%eax
+  800069:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80006c:	e8 30 0b 00 00       	call   800ba1 <sys_getenvid>
+  800071:	83 c4 08             	add    $0x8,%esp
+  800074:	57                   	push   %edi
+  800075:	53                   	push   %ebx
+  800076:	56                   	push   %esi
+  800077:	ff 75 d4             	push   -0x2c(%ebp)
+  80007a:	50                   	push   %eax
+  80007b:	68 10 3a 80 00       	push   $0x803a10
+  800080:	e8 80 01 00 00       	call   800205 <cprintf>
+    if (val == 10)
+  800085:	a1 a0 58 80 00       	mov    0x8058a0,%eax
+  80008a:	83 c4 20             	add    $0x20,%esp
+  80008d:	83 f8 0a             	cmp    $0xa,%eax
+  800090:	74 22                	je     8000b4 <umain+0x81>
+      return;
+    ++val;
+  800092:	83 c0 01             	add    $0x1,%eax
+  800095:	a3 a0 58 80 00       	mov    %eax,0x8058a0
+    ipc_send(who, 0, 0, 0);
+  80009a:	6a 00                	push   $0x0
+  80009c:	6a 00                	push   $0x0
+  80009e:	6a 00                	push   $0x0
+  8000a0:	ff 75 e4             	push   -0x1c(%ebp)
+  8000a3:	e8 63 15 00 00       	call   80160b <ipc_send>
+    if (val == 10)
+  8000a8:	83 c4 10             	add    $0x10,%esp
+  8000ab:	83 3d a0 58 80 00 0a 	cmpl   $0xa,0x8058a0
+  8000b2:	75 94                	jne    800048 <umain+0x15>
+      return;
+  }
+
+}
+  8000b4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000b7:	5b                   	pop    %ebx
+  8000b8:	5e                   	pop    %esi
+  8000b9:	5f                   	pop    %edi
+  8000ba:	5d                   	pop    %ebp
+  8000bb:	c3                   	ret
+    cprintf("i am %08x; thisenv is %p\n", sys_getenvid(), thisenv);
+  8000bc:	8b 1d a4 58 80 00    	mov    0x8058a4,%ebx
+  8000c2:	e8 da 0a 00 00       	call   800ba1 <sys_getenvid>
+  8000c7:	83 ec 04             	sub    $0x4,%esp
+  8000ca:	53                   	push   %ebx
+  8000cb:	50                   	push   %eax
+  8000cc:	68 e0 39 80 00       	push   $0x8039e0
+  8000d1:	e8 2f 01 00 00       	call   800205 <cprintf>
+    cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+  8000d6:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  8000d9:	e8 c3 0a 00 00       	call   800ba1 <sys_getenvid>
+  8000de:	83 c4 0c             	add    $0xc,%esp
+  8000e1:	53                   	push   %ebx
+  8000e2:	50                   	push   %eax
+  8000e3:	68 fa 39 80 00       	push   $0x8039fa
+  8000e8:	e8 18 01 00 00       	call   800205 <cprintf>
+    ipc_send(who, 0, 0, 0);
+  8000ed:	6a 00                	push   $0x0
+  8000ef:	6a 00                	push   $0x0
+  8000f1:	6a 00                	push   $0x0
+  8000f3:	ff 75 e4             	push   -0x1c(%ebp)
+  8000f6:	e8 10 15 00 00       	call   80160b <ipc_send>
+  8000fb:	83 c4 20             	add    $0x20,%esp
+  8000fe:	e9 45 ff ff ff       	jmp    800048 <umain+0x15>
+
+00800103 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800103:	55                   	push   %ebp
+  800104:	89 e5                	mov    %esp,%ebp
+  800106:	56                   	push   %esi
+  800107:	53                   	push   %ebx
+  800108:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80010b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  80010e:	c7 05 a4 58 80 00 00 	movl   $0x0,0x8058a4
+  800115:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  800118:	e8 84 0a 00 00       	call   800ba1 <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  80011d:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800122:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800125:	c1 e0 04             	shl    $0x4,%eax
+  800128:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80012d:	a3 a4 58 80 00       	mov    %eax,0x8058a4
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800132:	85 db                	test   %ebx,%ebx
+  800134:	7e 07                	jle    80013d <libmain+0x3a>
+    binaryname = argv[0];
+  800136:	8b 06                	mov    (%esi),%eax
+  800138:	a3 00 40 80 00       	mov    %eax,0x804000
+
+  // call user main routine
+  umain(argc, argv);
+  80013d:	83 ec 08             	sub    $0x8,%esp
+  800140:	56                   	push   %esi
+  800141:	53                   	push   %ebx
+  800142:	e8 ec fe ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  800147:	e8 0a 00 00 00       	call   800156 <exit>
+}
+  80014c:	83 c4 10             	add    $0x10,%esp
+  80014f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800152:	5b                   	pop    %ebx
+  800153:	5e                   	pop    %esi
+  800154:	5d                   	pop    %ebp
+  800155:	c3                   	ret
+
+00800156 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800156:	55                   	push   %ebp
+  800157:	89 e5                	mov    %esp,%ebp
+  800159:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  80015c:	e8 d1 16 00 00       	call   801832 <close_all>
+  sys_env_destroy(0);
+  800161:	83 ec 0c             	sub    $0xc,%esp
+  800164:	6a 00                	push   $0x0
+  800166:	e8 f5 09 00 00       	call   800b60 <sys_env_destroy>
+}
+  80016b:	83 c4 10             	add    $0x10,%esp
+  80016e:	c9                   	leave
+  80016f:	c3                   	ret
+
+00800170 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800170:	55                   	push   %ebp
+  800171:	89 e5                	mov    %esp,%ebp
+  800173:	53                   	push   %ebx
+  800174:	83 ec 04             	sub    $0x4,%esp
+  800177:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  80017a:	8b 13                	mov    (%ebx),%edx
+  80017c:	8d 42 01             	lea    0x1(%edx),%eax
+  80017f:	89 03                	mov    %eax,(%ebx)
+  800181:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800184:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  800188:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80018d:	74 09                	je     800198 <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  80018f:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800193:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800196:	c9                   	leave
+  800197:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  800198:	83 ec 08             	sub    $0x8,%esp
+  80019b:	68 ff 00 00 00       	push   $0xff
+  8001a0:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001a3:	50                   	push   %eax
+  8001a4:	e8 7a 09 00 00       	call   800b23 <sys_cputs>
+    b->idx = 0;
+  8001a9:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001af:	83 c4 10             	add    $0x10,%esp
+  8001b2:	eb db                	jmp    80018f <putch+0x1f>
+
+008001b4 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001b4:	55                   	push   %ebp
+  8001b5:	89 e5                	mov    %esp,%ebp
+  8001b7:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  8001bd:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001c4:	00 00 00 
+  b.cnt = 0;
+  8001c7:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001ce:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  8001d1:	ff 75 0c             	push   0xc(%ebp)
+  8001d4:	ff 75 08             	push   0x8(%ebp)
+  8001d7:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001dd:	50                   	push   %eax
+  8001de:	68 70 01 80 00       	push   $0x800170
+  8001e3:	e8 14 01 00 00       	call   8002fc <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  8001e8:	83 c4 08             	add    $0x8,%esp
+  8001eb:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001f1:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001f7:	50                   	push   %eax
+  8001f8:	e8 26 09 00 00       	call   800b23 <sys_cputs>
+
+  return b.cnt;
+}
+  8001fd:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800203:	c9                   	leave
+  800204:	c3                   	ret
+
+00800205 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800205:	55                   	push   %ebp
+  800206:	89 e5                	mov    %esp,%ebp
+  800208:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  80020b:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  80020e:	50                   	push   %eax
+  80020f:	ff 75 08             	push   0x8(%ebp)
+  800212:	e8 9d ff ff ff       	call   8001b4 <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  800217:	c9                   	leave
+  800218:	c3                   	ret
+
+00800219 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  800219:	55                   	push   %ebp
+  80021a:	89 e5                	mov    %esp,%ebp
+  80021c:	57                   	push   %edi
+  80021d:	56                   	push   %esi
+  80021e:	53                   	push   %ebx
+  80021f:	83 ec 1c             	sub    $0x1c,%esp
+  800222:	89 c7                	mov    %eax,%edi
+  800224:	89 d6                	mov    %edx,%esi
+  800226:	8b 45 08             	mov    0x8(%ebp),%eax
+  800229:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80022c:	89 d1                	mov    %edx,%ecx
+  80022e:	89 c2                	mov    %eax,%edx
+  800230:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800233:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800236:	8b 45 10             	mov    0x10(%ebp),%eax
+  800239:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  80023c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80023f:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800246:	39 c2                	cmp    %eax,%edx
+  800248:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80024b:	72 3e                	jb     80028b <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  80024d:	83 ec 0c             	sub    $0xc,%esp
+  800250:	ff 75 18             	push   0x18(%ebp)
+  800253:	83 eb 01             	sub    $0x1,%ebx
+  800256:	53                   	push   %ebx
+  800257:	50                   	push   %eax
+  800258:	83 ec 08             	sub    $0x8,%esp
+  80025b:	ff 75 e4             	push   -0x1c(%ebp)
+  80025e:	ff 75 e0             	push   -0x20(%ebp)
+  800261:	ff 75 dc             	push   -0x24(%ebp)
+  800264:	ff 75 d8             	push   -0x28(%ebp)
+  800267:	e8 d6 35 00 00       	call   803842 <__udivdi3>
+  80026c:	83 c4 18             	add    $0x18,%esp
+  80026f:	52                   	push   %edx
+  800270:	50                   	push   %eax
+  800271:	89 f2                	mov    %esi,%edx
+  800273:	89 f8                	mov    %edi,%eax
+  800275:	e8 9f ff ff ff       	call   800219 <printnum>
+  80027a:	83 c4 20             	add    $0x20,%esp
+  80027d:	eb 13                	jmp    800292 <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  80027f:	83 ec 08             	sub    $0x8,%esp
+  800282:	56                   	push   %esi
+  800283:	ff 75 18             	push   0x18(%ebp)
+  800286:	ff d7                	call   *%edi
+  800288:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  80028b:	83 eb 01             	sub    $0x1,%ebx
+  80028e:	85 db                	test   %ebx,%ebx
+  800290:	7f ed                	jg     80027f <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  800292:	83 ec 08             	sub    $0x8,%esp
+  800295:	56                   	push   %esi
+  800296:	83 ec 04             	sub    $0x4,%esp
+  800299:	ff 75 e4             	push   -0x1c(%ebp)
+  80029c:	ff 75 e0             	push   -0x20(%ebp)
+  80029f:	ff 75 dc             	push   -0x24(%ebp)
+  8002a2:	ff 75 d8             	push   -0x28(%ebp)
+  8002a5:	e8 b9 35 00 00       	call   803863 <__umoddi3>
+  8002aa:	83 c4 14             	add    $0x14,%esp
+  8002ad:	0f be 80 40 3a 80 00 	movsbl 0x803a40(%eax),%eax
+  8002b4:	50                   	push   %eax
+  8002b5:	ff d7                	call   *%edi
+}
+  8002b7:	83 c4 10             	add    $0x10,%esp
+  8002ba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002bd:	5b                   	pop    %ebx
+  8002be:	5e                   	pop    %esi
+  8002bf:	5f                   	pop    %edi
+  8002c0:	5d                   	pop    %ebp
+  8002c1:	c3                   	ret
+
+008002c2 <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002c2:	55                   	push   %ebp
+  8002c3:	89 e5                	mov    %esp,%ebp
+  8002c5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  8002c8:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  8002cc:	8b 10                	mov    (%eax),%edx
+  8002ce:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002d1:	73 0a                	jae    8002dd <sprintputch+0x1b>
+    *b->buf++ = ch;
+  8002d3:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002d6:	89 08                	mov    %ecx,(%eax)
+  8002d8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002db:	88 02                	mov    %al,(%edx)
+}
+  8002dd:	5d                   	pop    %ebp
+  8002de:	c3                   	ret
+
+008002df <printfmt>:
+{
+  8002df:	55                   	push   %ebp
+  8002e0:	89 e5                	mov    %esp,%ebp
+  8002e2:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  8002e5:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  8002e8:	50                   	push   %eax
+  8002e9:	ff 75 10             	push   0x10(%ebp)
+  8002ec:	ff 75 0c             	push   0xc(%ebp)
+  8002ef:	ff 75 08             	push   0x8(%ebp)
+  8002f2:	e8 05 00 00 00       	call   8002fc <vprintfmt>
+}
+  8002f7:	83 c4 10             	add    $0x10,%esp
+  8002fa:	c9                   	leave
+  8002fb:	c3                   	ret
+
+008002fc <vprintfmt>:
+{
+  8002fc:	55                   	push   %ebp
+  8002fd:	89 e5                	mov    %esp,%ebp
+  8002ff:	57                   	push   %edi
+  800300:	56                   	push   %esi
+  800301:	53                   	push   %ebx
+  800302:	83 ec 2c             	sub    $0x2c,%esp
+  800305:	8b 75 08             	mov    0x8(%ebp),%esi
+  800308:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80030b:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80030e:	eb 0a                	jmp    80031a <vprintfmt+0x1e>
+      putch(ch, putdat);
+  800310:	83 ec 08             	sub    $0x8,%esp
+  800313:	53                   	push   %ebx
+  800314:	50                   	push   %eax
+  800315:	ff d6                	call   *%esi
+  800317:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  80031a:	83 c7 01             	add    $0x1,%edi
+  80031d:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800321:	83 f8 25             	cmp    $0x25,%eax
+  800324:	74 0c                	je     800332 <vprintfmt+0x36>
+      if (ch == '\0')
+  800326:	85 c0                	test   %eax,%eax
+  800328:	75 e6                	jne    800310 <vprintfmt+0x14>
+}
+  80032a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80032d:	5b                   	pop    %ebx
+  80032e:	5e                   	pop    %esi
+  80032f:	5f                   	pop    %edi
+  800330:	5d                   	pop    %ebp
+  800331:	c3                   	ret
+    padc = ' ';
+  800332:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  800336:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  80033d:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  800344:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  80034b:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  800350:	8d 47 01             	lea    0x1(%edi),%eax
+  800353:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800356:	0f b6 17             	movzbl (%edi),%edx
+  800359:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80035c:	3c 55                	cmp    $0x55,%al
+  80035e:	0f 87 cf 03 00 00    	ja     800733 <vprintfmt+0x437>
+  800364:	0f b6 c0             	movzbl %al,%eax
+  800367:	ff 24 85 80 3b 80 00 	jmp    *0x803b80(,%eax,4)
+  80036e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  800371:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800375:	eb d9                	jmp    800350 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  800377:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80037a:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80037e:	eb d0                	jmp    800350 <vprintfmt+0x54>
+  800380:	0f b6 d2             	movzbl %dl,%edx
+  800383:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  800386:	b8 00 00 00 00       	mov    $0x0,%eax
+  80038b:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  80038e:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800391:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  800395:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  800398:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80039b:	83 f9 09             	cmp    $0x9,%ecx
+  80039e:	77 55                	ja     8003f5 <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  8003a0:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  8003a3:	eb e9                	jmp    80038e <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  8003a5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003a8:	8b 00                	mov    (%eax),%eax
+  8003aa:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003ad:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003b0:	8d 40 04             	lea    0x4(%eax),%eax
+  8003b3:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  8003b6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  8003b9:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003bd:	79 91                	jns    800350 <vprintfmt+0x54>
+        width = precision, precision = -1;
+  8003bf:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003c2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003c5:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003cc:	eb 82                	jmp    800350 <vprintfmt+0x54>
+      if (width < 0)
+  8003ce:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8003d1:	85 d2                	test   %edx,%edx
+  8003d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003d8:	0f 49 c2             	cmovns %edx,%eax
+  8003db:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  8003de:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  8003e1:	e9 6a ff ff ff       	jmp    800350 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  8003e6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  8003e9:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  8003f0:	e9 5b ff ff ff       	jmp    800350 <vprintfmt+0x54>
+  8003f5:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003f8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003fb:	eb bc                	jmp    8003b9 <vprintfmt+0xbd>
+      lflag++;
+  8003fd:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  800400:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  800403:	e9 48 ff ff ff       	jmp    800350 <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  800408:	8b 45 14             	mov    0x14(%ebp),%eax
+  80040b:	8d 78 04             	lea    0x4(%eax),%edi
+  80040e:	83 ec 08             	sub    $0x8,%esp
+  800411:	53                   	push   %ebx
+  800412:	ff 30                	push   (%eax)
+  800414:	ff d6                	call   *%esi
+      break;
+  800416:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  800419:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  80041c:	e9 b1 02 00 00       	jmp    8006d2 <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  800421:	8b 45 14             	mov    0x14(%ebp),%eax
+  800424:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  800427:	8b 10                	mov    (%eax),%edx
+  800429:	89 d0                	mov    %edx,%eax
+  80042b:	f7 d8                	neg    %eax
+  80042d:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800430:	83 f8 10             	cmp    $0x10,%eax
+  800433:	7f 23                	jg     800458 <vprintfmt+0x15c>
+  800435:	8b 14 85 e0 3c 80 00 	mov    0x803ce0(,%eax,4),%edx
+  80043c:	85 d2                	test   %edx,%edx
+  80043e:	74 18                	je     800458 <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  800440:	52                   	push   %edx
+  800441:	68 0e 3f 80 00       	push   $0x803f0e
+  800446:	53                   	push   %ebx
+  800447:	56                   	push   %esi
+  800448:	e8 92 fe ff ff       	call   8002df <printfmt>
+  80044d:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  800450:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800453:	e9 7a 02 00 00       	jmp    8006d2 <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  800458:	50                   	push   %eax
+  800459:	68 58 3a 80 00       	push   $0x803a58
+  80045e:	53                   	push   %ebx
+  80045f:	56                   	push   %esi
+  800460:	e8 7a fe ff ff       	call   8002df <printfmt>
+  800465:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  800468:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  80046b:	e9 62 02 00 00       	jmp    8006d2 <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  800470:	8b 45 14             	mov    0x14(%ebp),%eax
+  800473:	83 c0 04             	add    $0x4,%eax
+  800476:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800479:	8b 45 14             	mov    0x14(%ebp),%eax
+  80047c:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  80047e:	85 c9                	test   %ecx,%ecx
+  800480:	b8 51 3a 80 00       	mov    $0x803a51,%eax
+  800485:	0f 45 c1             	cmovne %ecx,%eax
+  800488:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  80048b:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80048f:	7e 06                	jle    800497 <vprintfmt+0x19b>
+  800491:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800495:	75 0b                	jne    8004a2 <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800497:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80049a:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80049d:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004a0:	eb 5c                	jmp    8004fe <vprintfmt+0x202>
+  8004a2:	83 ec 08             	sub    $0x8,%esp
+  8004a5:	ff 75 d0             	push   -0x30(%ebp)
+  8004a8:	ff 75 cc             	push   -0x34(%ebp)
+  8004ab:	e8 20 03 00 00       	call   8007d0 <strnlen>
+  8004b0:	89 c2                	mov    %eax,%edx
+  8004b2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004b5:	29 d0                	sub    %edx,%eax
+  8004b7:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  8004ba:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8004be:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004c1:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004c4:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8004c6:	eb 0e                	jmp    8004d6 <vprintfmt+0x1da>
+          putch(padc, putdat);
+  8004c8:	83 ec 08             	sub    $0x8,%esp
+  8004cb:	53                   	push   %ebx
+  8004cc:	57                   	push   %edi
+  8004cd:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8004d0:	83 ee 01             	sub    $0x1,%esi
+  8004d3:	83 c4 10             	add    $0x10,%esp
+  8004d6:	85 f6                	test   %esi,%esi
+  8004d8:	7f ee                	jg     8004c8 <vprintfmt+0x1cc>
+  8004da:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004dd:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004e0:	85 c0                	test   %eax,%eax
+  8004e2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004e7:	0f 49 d0             	cmovns %eax,%edx
+  8004ea:	29 d0                	sub    %edx,%eax
+  8004ec:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004ef:	eb a6                	jmp    800497 <vprintfmt+0x19b>
+          putch(ch, putdat);
+  8004f1:	83 ec 08             	sub    $0x8,%esp
+  8004f4:	53                   	push   %ebx
+  8004f5:	52                   	push   %edx
+  8004f6:	ff 55 08             	call   *0x8(%ebp)
+  8004f9:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8004fc:	89 f1                	mov    %esi,%ecx
+  8004fe:	8d 71 01             	lea    0x1(%ecx),%esi
+  800501:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800505:	0f be d0             	movsbl %al,%edx
+  800508:	85 d2                	test   %edx,%edx
+  80050a:	74 28                	je     800534 <vprintfmt+0x238>
+  80050c:	85 ff                	test   %edi,%edi
+  80050e:	78 05                	js     800515 <vprintfmt+0x219>
+  800510:	83 ef 01             	sub    $0x1,%edi
+  800513:	78 30                	js     800545 <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  800515:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800519:	74 d6                	je     8004f1 <vprintfmt+0x1f5>
+  80051b:	0f be c0             	movsbl %al,%eax
+  80051e:	83 e8 20             	sub    $0x20,%eax
+  800521:	83 f8 5e             	cmp    $0x5e,%eax
+  800524:	76 cb                	jbe    8004f1 <vprintfmt+0x1f5>
+          putch('?', putdat);
+  800526:	83 ec 08             	sub    $0x8,%esp
+  800529:	53                   	push   %ebx
+  80052a:	6a 3f                	push   $0x3f
+  80052c:	ff 55 08             	call   *0x8(%ebp)
+  80052f:	83 c4 10             	add    $0x10,%esp
+  800532:	eb c8                	jmp    8004fc <vprintfmt+0x200>
+  800534:	8b 75 08             	mov    0x8(%ebp),%esi
+  800537:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80053a:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80053d:	01 d0                	add    %edx,%eax
+  80053f:	29 c8                	sub    %ecx,%eax
+  800541:	89 c7                	mov    %eax,%edi
+  800543:	eb 13                	jmp    800558 <vprintfmt+0x25c>
+  800545:	8b 75 08             	mov    0x8(%ebp),%esi
+  800548:	eb ed                	jmp    800537 <vprintfmt+0x23b>
+        putch(' ', putdat);
+  80054a:	83 ec 08             	sub    $0x8,%esp
+  80054d:	53                   	push   %ebx
+  80054e:	6a 20                	push   $0x20
+  800550:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  800552:	83 ef 01             	sub    $0x1,%edi
+  800555:	83 c4 10             	add    $0x10,%esp
+  800558:	85 ff                	test   %edi,%edi
+  80055a:	7f ee                	jg     80054a <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  80055c:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80055f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800562:	e9 6b 01 00 00       	jmp    8006d2 <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  800567:	83 f9 01             	cmp    $0x1,%ecx
+  80056a:	7f 1f                	jg     80058b <vprintfmt+0x28f>
+  else if (lflag)
+  80056c:	85 c9                	test   %ecx,%ecx
+  80056e:	74 67                	je     8005d7 <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  800570:	8b 45 14             	mov    0x14(%ebp),%eax
+  800573:	8b 00                	mov    (%eax),%eax
+  800575:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800578:	89 c1                	mov    %eax,%ecx
+  80057a:	c1 f9 1f             	sar    $0x1f,%ecx
+  80057d:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800580:	8b 45 14             	mov    0x14(%ebp),%eax
+  800583:	8d 40 04             	lea    0x4(%eax),%eax
+  800586:	89 45 14             	mov    %eax,0x14(%ebp)
+  800589:	eb 17                	jmp    8005a2 <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  80058b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80058e:	8b 50 04             	mov    0x4(%eax),%edx
+  800591:	8b 00                	mov    (%eax),%eax
+  800593:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800596:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800599:	8b 45 14             	mov    0x14(%ebp),%eax
+  80059c:	8d 40 08             	lea    0x8(%eax),%eax
+  80059f:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  8005a2:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005a5:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  8005a8:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  8005ad:	85 c9                	test   %ecx,%ecx
+  8005af:	0f 89 03 01 00 00    	jns    8006b8 <vprintfmt+0x3bc>
+        putch('-', putdat);
+  8005b5:	83 ec 08             	sub    $0x8,%esp
+  8005b8:	53                   	push   %ebx
+  8005b9:	6a 2d                	push   $0x2d
+  8005bb:	ff d6                	call   *%esi
+        num = -(long long)num;
+  8005bd:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005c0:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005c3:	f7 da                	neg    %edx
+  8005c5:	83 d1 00             	adc    $0x0,%ecx
+  8005c8:	f7 d9                	neg    %ecx
+  8005ca:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  8005cd:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005d2:	e9 e1 00 00 00       	jmp    8006b8 <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  8005d7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005da:	8b 00                	mov    (%eax),%eax
+  8005dc:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005df:	89 c1                	mov    %eax,%ecx
+  8005e1:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005e4:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005e7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ea:	8d 40 04             	lea    0x4(%eax),%eax
+  8005ed:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005f0:	eb b0                	jmp    8005a2 <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  8005f2:	83 f9 01             	cmp    $0x1,%ecx
+  8005f5:	7f 1e                	jg     800615 <vprintfmt+0x319>
+  else if (lflag)
+  8005f7:	85 c9                	test   %ecx,%ecx
+  8005f9:	74 32                	je     80062d <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  8005fb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005fe:	8b 10                	mov    (%eax),%edx
+  800600:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800605:	8d 40 04             	lea    0x4(%eax),%eax
+  800608:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  80060b:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  800610:	e9 a3 00 00 00       	jmp    8006b8 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800615:	8b 45 14             	mov    0x14(%ebp),%eax
+  800618:	8b 10                	mov    (%eax),%edx
+  80061a:	8b 48 04             	mov    0x4(%eax),%ecx
+  80061d:	8d 40 08             	lea    0x8(%eax),%eax
+  800620:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800623:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  800628:	e9 8b 00 00 00       	jmp    8006b8 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  80062d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800630:	8b 10                	mov    (%eax),%edx
+  800632:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800637:	8d 40 04             	lea    0x4(%eax),%eax
+  80063a:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  80063d:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  800642:	eb 74                	jmp    8006b8 <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  800644:	83 f9 01             	cmp    $0x1,%ecx
+  800647:	7f 1b                	jg     800664 <vprintfmt+0x368>
+  else if (lflag)
+  800649:	85 c9                	test   %ecx,%ecx
+  80064b:	74 2c                	je     800679 <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  80064d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800650:	8b 10                	mov    (%eax),%edx
+  800652:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800657:	8d 40 04             	lea    0x4(%eax),%eax
+  80065a:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  80065d:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  800662:	eb 54                	jmp    8006b8 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800664:	8b 45 14             	mov    0x14(%ebp),%eax
+  800667:	8b 10                	mov    (%eax),%edx
+  800669:	8b 48 04             	mov    0x4(%eax),%ecx
+  80066c:	8d 40 08             	lea    0x8(%eax),%eax
+  80066f:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800672:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  800677:	eb 3f                	jmp    8006b8 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800679:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067c:	8b 10                	mov    (%eax),%edx
+  80067e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800683:	8d 40 04             	lea    0x4(%eax),%eax
+  800686:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800689:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  80068e:	eb 28                	jmp    8006b8 <vprintfmt+0x3bc>
+      putch('0', putdat);
+  800690:	83 ec 08             	sub    $0x8,%esp
+  800693:	53                   	push   %ebx
+  800694:	6a 30                	push   $0x30
+  800696:	ff d6                	call   *%esi
+      putch('x', putdat);
+  800698:	83 c4 08             	add    $0x8,%esp
+  80069b:	53                   	push   %ebx
+  80069c:	6a 78                	push   $0x78
+  80069e:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  8006a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a3:	8b 10                	mov    (%eax),%edx
+  8006a5:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  8006aa:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  8006ad:	8d 40 04             	lea    0x4(%eax),%eax
+  8006b0:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8006b3:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  8006b8:	83 ec 0c             	sub    $0xc,%esp
+  8006bb:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8006bf:	50                   	push   %eax
+  8006c0:	ff 75 e0             	push   -0x20(%ebp)
+  8006c3:	57                   	push   %edi
+  8006c4:	51                   	push   %ecx
+  8006c5:	52                   	push   %edx
+  8006c6:	89 da                	mov    %ebx,%edx
+  8006c8:	89 f0                	mov    %esi,%eax
+  8006ca:	e8 4a fb ff ff       	call   800219 <printnum>
+      break;
+  8006cf:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  8006d2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  8006d5:	e9 40 fc ff ff       	jmp    80031a <vprintfmt+0x1e>
+  if (lflag >= 2)
+  8006da:	83 f9 01             	cmp    $0x1,%ecx
+  8006dd:	7f 1b                	jg     8006fa <vprintfmt+0x3fe>
+  else if (lflag)
+  8006df:	85 c9                	test   %ecx,%ecx
+  8006e1:	74 2c                	je     80070f <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  8006e3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e6:	8b 10                	mov    (%eax),%edx
+  8006e8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006ed:	8d 40 04             	lea    0x4(%eax),%eax
+  8006f0:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8006f3:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  8006f8:	eb be                	jmp    8006b8 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  8006fa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006fd:	8b 10                	mov    (%eax),%edx
+  8006ff:	8b 48 04             	mov    0x4(%eax),%ecx
+  800702:	8d 40 08             	lea    0x8(%eax),%eax
+  800705:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800708:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  80070d:	eb a9                	jmp    8006b8 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  80070f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800712:	8b 10                	mov    (%eax),%edx
+  800714:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800719:	8d 40 04             	lea    0x4(%eax),%eax
+  80071c:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  80071f:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  800724:	eb 92                	jmp    8006b8 <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  800726:	83 ec 08             	sub    $0x8,%esp
+  800729:	53                   	push   %ebx
+  80072a:	6a 25                	push   $0x25
+  80072c:	ff d6                	call   *%esi
+      break;
+  80072e:	83 c4 10             	add    $0x10,%esp
+  800731:	eb 9f                	jmp    8006d2 <vprintfmt+0x3d6>
+      putch('%', putdat);
+  800733:	83 ec 08             	sub    $0x8,%esp
+  800736:	53                   	push   %ebx
+  800737:	6a 25                	push   $0x25
+  800739:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  80073b:	83 c4 10             	add    $0x10,%esp
+  80073e:	89 f8                	mov    %edi,%eax
+  800740:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800744:	74 05                	je     80074b <vprintfmt+0x44f>
+  800746:	83 e8 01             	sub    $0x1,%eax
+  800749:	eb f5                	jmp    800740 <vprintfmt+0x444>
+  80074b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80074e:	eb 82                	jmp    8006d2 <vprintfmt+0x3d6>
+
+00800750 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800750:	55                   	push   %ebp
+  800751:	89 e5                	mov    %esp,%ebp
+  800753:	83 ec 18             	sub    $0x18,%esp
+  800756:	8b 45 08             	mov    0x8(%ebp),%eax
+  800759:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  80075c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80075f:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800763:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800766:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  80076d:	85 c0                	test   %eax,%eax
+  80076f:	74 26                	je     800797 <vsnprintf+0x47>
+  800771:	85 d2                	test   %edx,%edx
+  800773:	7e 22                	jle    800797 <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800775:	ff 75 14             	push   0x14(%ebp)
+  800778:	ff 75 10             	push   0x10(%ebp)
+  80077b:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80077e:	50                   	push   %eax
+  80077f:	68 c2 02 80 00       	push   $0x8002c2
+  800784:	e8 73 fb ff ff       	call   8002fc <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800789:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80078c:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  80078f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800792:	83 c4 10             	add    $0x10,%esp
+}
+  800795:	c9                   	leave
+  800796:	c3                   	ret
+    return -E_INVAL;
+  800797:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80079c:	eb f7                	jmp    800795 <vsnprintf+0x45>
+
+0080079e <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80079e:	55                   	push   %ebp
+  80079f:	89 e5                	mov    %esp,%ebp
+  8007a1:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  8007a4:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  8007a7:	50                   	push   %eax
+  8007a8:	ff 75 10             	push   0x10(%ebp)
+  8007ab:	ff 75 0c             	push   0xc(%ebp)
+  8007ae:	ff 75 08             	push   0x8(%ebp)
+  8007b1:	e8 9a ff ff ff       	call   800750 <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  8007b6:	c9                   	leave
+  8007b7:	c3                   	ret
+
+008007b8 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8007b8:	55                   	push   %ebp
+  8007b9:	89 e5                	mov    %esp,%ebp
+  8007bb:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  8007be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007c3:	eb 03                	jmp    8007c8 <strlen+0x10>
+    n++;
+  8007c5:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  8007c8:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8007cc:	75 f7                	jne    8007c5 <strlen+0xd>
+  return n;
+}
+  8007ce:	5d                   	pop    %ebp
+  8007cf:	c3                   	ret
+
+008007d0 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8007d0:	55                   	push   %ebp
+  8007d1:	89 e5                	mov    %esp,%ebp
+  8007d3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007d6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007de:	eb 03                	jmp    8007e3 <strnlen+0x13>
+    n++;
+  8007e0:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007e3:	39 d0                	cmp    %edx,%eax
+  8007e5:	74 08                	je     8007ef <strnlen+0x1f>
+  8007e7:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8007eb:	75 f3                	jne    8007e0 <strnlen+0x10>
+  8007ed:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  8007ef:	89 d0                	mov    %edx,%eax
+  8007f1:	5d                   	pop    %ebp
+  8007f2:	c3                   	ret
+
+008007f3 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8007f3:	55                   	push   %ebp
+  8007f4:	89 e5                	mov    %esp,%ebp
+  8007f6:	53                   	push   %ebx
+  8007f7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007fa:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  8007fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800802:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800806:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800809:	83 c0 01             	add    $0x1,%eax
+  80080c:	84 d2                	test   %dl,%dl
+  80080e:	75 f2                	jne    800802 <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  800810:	89 c8                	mov    %ecx,%eax
+  800812:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800815:	c9                   	leave
+  800816:	c3                   	ret
+
+00800817 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800817:	55                   	push   %ebp
+  800818:	89 e5                	mov    %esp,%ebp
+  80081a:	53                   	push   %ebx
+  80081b:	83 ec 10             	sub    $0x10,%esp
+  80081e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  800821:	53                   	push   %ebx
+  800822:	e8 91 ff ff ff       	call   8007b8 <strlen>
+  800827:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  80082a:	ff 75 0c             	push   0xc(%ebp)
+  80082d:	01 d8                	add    %ebx,%eax
+  80082f:	50                   	push   %eax
+  800830:	e8 be ff ff ff       	call   8007f3 <strcpy>
+  return dst;
+}
+  800835:	89 d8                	mov    %ebx,%eax
+  800837:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80083a:	c9                   	leave
+  80083b:	c3                   	ret
+
+0080083c <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  80083c:	55                   	push   %ebp
+  80083d:	89 e5                	mov    %esp,%ebp
+  80083f:	56                   	push   %esi
+  800840:	53                   	push   %ebx
+  800841:	8b 75 08             	mov    0x8(%ebp),%esi
+  800844:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  800847:	89 f3                	mov    %esi,%ebx
+  800849:	03 5d 10             	add    0x10(%ebp),%ebx
+  80084c:	89 f0                	mov    %esi,%eax
+  80084e:	eb 0f                	jmp    80085f <strncpy+0x23>
+    *dst++ = *src;
+  800850:	83 c0 01             	add    $0x1,%eax
+  800853:	0f b6 0a             	movzbl (%edx),%ecx
+  800856:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  800859:	80 f9 01             	cmp    $0x1,%cl
+  80085c:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  80085f:	39 d8                	cmp    %ebx,%eax
+  800861:	75 ed                	jne    800850 <strncpy+0x14>
+  }
+  return ret;
+}
+  800863:	89 f0                	mov    %esi,%eax
+  800865:	5b                   	pop    %ebx
+  800866:	5e                   	pop    %esi
+  800867:	5d                   	pop    %ebp
+  800868:	c3                   	ret
+
+00800869 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800869:	55                   	push   %ebp
+  80086a:	89 e5                	mov    %esp,%ebp
+  80086c:	56                   	push   %esi
+  80086d:	53                   	push   %ebx
+  80086e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800871:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800874:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  800877:	89 f0                	mov    %esi,%eax
+  800879:	85 d2                	test   %edx,%edx
+  80087b:	74 21                	je     80089e <strlcpy+0x35>
+  80087d:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800881:	89 f2                	mov    %esi,%edx
+  800883:	eb 09                	jmp    80088e <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  800885:	83 c1 01             	add    $0x1,%ecx
+  800888:	83 c2 01             	add    $0x1,%edx
+  80088b:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  80088e:	39 c2                	cmp    %eax,%edx
+  800890:	74 09                	je     80089b <strlcpy+0x32>
+  800892:	0f b6 19             	movzbl (%ecx),%ebx
+  800895:	84 db                	test   %bl,%bl
+  800897:	75 ec                	jne    800885 <strlcpy+0x1c>
+  800899:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  80089b:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  80089e:	29 f0                	sub    %esi,%eax
+}
+  8008a0:	5b                   	pop    %ebx
+  8008a1:	5e                   	pop    %esi
+  8008a2:	5d                   	pop    %ebp
+  8008a3:	c3                   	ret
+
+008008a4 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8008a4:	55                   	push   %ebp
+  8008a5:	89 e5                	mov    %esp,%ebp
+  8008a7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008aa:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  8008ad:	eb 06                	jmp    8008b5 <strcmp+0x11>
+    p++, q++;
+  8008af:	83 c1 01             	add    $0x1,%ecx
+  8008b2:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  8008b5:	0f b6 01             	movzbl (%ecx),%eax
+  8008b8:	84 c0                	test   %al,%al
+  8008ba:	74 04                	je     8008c0 <strcmp+0x1c>
+  8008bc:	3a 02                	cmp    (%edx),%al
+  8008be:	74 ef                	je     8008af <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  8008c0:	0f b6 c0             	movzbl %al,%eax
+  8008c3:	0f b6 12             	movzbl (%edx),%edx
+  8008c6:	29 d0                	sub    %edx,%eax
+}
+  8008c8:	5d                   	pop    %ebp
+  8008c9:	c3                   	ret
+
+008008ca <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8008ca:	55                   	push   %ebp
+  8008cb:	89 e5                	mov    %esp,%ebp
+  8008cd:	53                   	push   %ebx
+  8008ce:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008d1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008d4:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  8008d7:	eb 09                	jmp    8008e2 <strncmp+0x18>
+    n--, p++, q++;
+  8008d9:	83 ea 01             	sub    $0x1,%edx
+  8008dc:	83 c0 01             	add    $0x1,%eax
+  8008df:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  8008e2:	85 d2                	test   %edx,%edx
+  8008e4:	74 18                	je     8008fe <strncmp+0x34>
+  8008e6:	0f b6 18             	movzbl (%eax),%ebx
+  8008e9:	84 db                	test   %bl,%bl
+  8008eb:	74 04                	je     8008f1 <strncmp+0x27>
+  8008ed:	3a 19                	cmp    (%ecx),%bl
+  8008ef:	74 e8                	je     8008d9 <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8008f1:	0f b6 00             	movzbl (%eax),%eax
+  8008f4:	0f b6 11             	movzbl (%ecx),%edx
+  8008f7:	29 d0                	sub    %edx,%eax
+}
+  8008f9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008fc:	c9                   	leave
+  8008fd:	c3                   	ret
+    return 0;
+  8008fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800903:	eb f4                	jmp    8008f9 <strncmp+0x2f>
+
+00800905 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800905:	55                   	push   %ebp
+  800906:	89 e5                	mov    %esp,%ebp
+  800908:	8b 45 08             	mov    0x8(%ebp),%eax
+  80090b:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  80090f:	eb 03                	jmp    800914 <strchr+0xf>
+  800911:	83 c0 01             	add    $0x1,%eax
+  800914:	0f b6 10             	movzbl (%eax),%edx
+  800917:	84 d2                	test   %dl,%dl
+  800919:	74 06                	je     800921 <strchr+0x1c>
+    if (*s == c)
+  80091b:	38 ca                	cmp    %cl,%dl
+  80091d:	75 f2                	jne    800911 <strchr+0xc>
+  80091f:	eb 05                	jmp    800926 <strchr+0x21>
+      return (char*)s;
+  return 0;
+  800921:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800926:	5d                   	pop    %ebp
+  800927:	c3                   	ret
+
+00800928 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800928:	55                   	push   %ebp
+  800929:	89 e5                	mov    %esp,%ebp
+  80092b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80092e:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800932:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  800935:	38 ca                	cmp    %cl,%dl
+  800937:	74 09                	je     800942 <strfind+0x1a>
+  800939:	84 d2                	test   %dl,%dl
+  80093b:	74 05                	je     800942 <strfind+0x1a>
+  for (; *s; s++)
+  80093d:	83 c0 01             	add    $0x1,%eax
+  800940:	eb f0                	jmp    800932 <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  800942:	5d                   	pop    %ebp
+  800943:	c3                   	ret
+
+00800944 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800944:	55                   	push   %ebp
+  800945:	89 e5                	mov    %esp,%ebp
+  800947:	57                   	push   %edi
+  800948:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80094b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  80094e:	85 c9                	test   %ecx,%ecx
+  800950:	74 20                	je     800972 <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  800952:	89 f8                	mov    %edi,%eax
+  800954:	09 c8                	or     %ecx,%eax
+  800956:	a8 03                	test   $0x3,%al
+  800958:	75 12                	jne    80096c <memset+0x28>
+    c &= 0xFF;
+  80095a:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80095e:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  800964:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  800967:	fc                   	cld
+  800968:	f3 ab                	rep stos %eax,%es:(%edi)
+  80096a:	eb 06                	jmp    800972 <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  80096c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80096f:	fc                   	cld
+  800970:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  800972:	89 f8                	mov    %edi,%eax
+  800974:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800977:	c9                   	leave
+  800978:	c3                   	ret
+
+00800979 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800979:	55                   	push   %ebp
+  80097a:	89 e5                	mov    %esp,%ebp
+  80097c:	57                   	push   %edi
+  80097d:	56                   	push   %esi
+  80097e:	8b 45 08             	mov    0x8(%ebp),%eax
+  800981:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800984:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  800987:	39 c6                	cmp    %eax,%esi
+  800989:	73 32                	jae    8009bd <memmove+0x44>
+  80098b:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80098e:	39 d0                	cmp    %edx,%eax
+  800990:	73 2b                	jae    8009bd <memmove+0x44>
+    s += n;
+    d += n;
+  800992:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800995:	89 d6                	mov    %edx,%esi
+  800997:	09 fe                	or     %edi,%esi
+  800999:	09 ce                	or     %ecx,%esi
+  80099b:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8009a1:	75 0e                	jne    8009b1 <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8009a3:	83 ef 04             	sub    $0x4,%edi
+  8009a6:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8009a9:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  8009ac:	fd                   	std
+  8009ad:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009af:	eb 09                	jmp    8009ba <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8009b1:	83 ef 01             	sub    $0x1,%edi
+  8009b4:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  8009b7:	fd                   	std
+  8009b8:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  8009ba:	fc                   	cld
+  8009bb:	eb 1a                	jmp    8009d7 <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009bd:	89 f2                	mov    %esi,%edx
+  8009bf:	09 c2                	or     %eax,%edx
+  8009c1:	09 ca                	or     %ecx,%edx
+  8009c3:	f6 c2 03             	test   $0x3,%dl
+  8009c6:	75 0a                	jne    8009d2 <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8009c8:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  8009cb:	89 c7                	mov    %eax,%edi
+  8009cd:	fc                   	cld
+  8009ce:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009d0:	eb 05                	jmp    8009d7 <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  8009d2:	89 c7                	mov    %eax,%edi
+  8009d4:	fc                   	cld
+  8009d5:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  8009d7:	5e                   	pop    %esi
+  8009d8:	5f                   	pop    %edi
+  8009d9:	5d                   	pop    %ebp
+  8009da:	c3                   	ret
+
+008009db <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8009db:	55                   	push   %ebp
+  8009dc:	89 e5                	mov    %esp,%ebp
+  8009de:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  8009e1:	ff 75 10             	push   0x10(%ebp)
+  8009e4:	ff 75 0c             	push   0xc(%ebp)
+  8009e7:	ff 75 08             	push   0x8(%ebp)
+  8009ea:	e8 8a ff ff ff       	call   800979 <memmove>
+}
+  8009ef:	c9                   	leave
+  8009f0:	c3                   	ret
+
+008009f1 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8009f1:	55                   	push   %ebp
+  8009f2:	89 e5                	mov    %esp,%ebp
+  8009f4:	56                   	push   %esi
+  8009f5:	53                   	push   %ebx
+  8009f6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009f9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  8009fc:	89 c6                	mov    %eax,%esi
+  8009fe:	03 75 10             	add    0x10(%ebp),%esi
+  800a01:	eb 06                	jmp    800a09 <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  800a03:	83 c0 01             	add    $0x1,%eax
+  800a06:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  800a09:	39 f0                	cmp    %esi,%eax
+  800a0b:	74 14                	je     800a21 <memcmp+0x30>
+    if (*s1 != *s2)
+  800a0d:	0f b6 08             	movzbl (%eax),%ecx
+  800a10:	0f b6 1a             	movzbl (%edx),%ebx
+  800a13:	38 d9                	cmp    %bl,%cl
+  800a15:	74 ec                	je     800a03 <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  800a17:	0f b6 c1             	movzbl %cl,%eax
+  800a1a:	0f b6 db             	movzbl %bl,%ebx
+  800a1d:	29 d8                	sub    %ebx,%eax
+  800a1f:	eb 05                	jmp    800a26 <memcmp+0x35>
+  }
+
+  return 0;
+  800a21:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a26:	5b                   	pop    %ebx
+  800a27:	5e                   	pop    %esi
+  800a28:	5d                   	pop    %ebp
+  800a29:	c3                   	ret
+
+00800a2a <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a2a:	55                   	push   %ebp
+  800a2b:	89 e5                	mov    %esp,%ebp
+  800a2d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a30:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  800a33:	89 c2                	mov    %eax,%edx
+  800a35:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  800a38:	eb 03                	jmp    800a3d <memfind+0x13>
+  800a3a:	83 c0 01             	add    $0x1,%eax
+  800a3d:	39 d0                	cmp    %edx,%eax
+  800a3f:	73 04                	jae    800a45 <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  800a41:	38 08                	cmp    %cl,(%eax)
+  800a43:	75 f5                	jne    800a3a <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  800a45:	5d                   	pop    %ebp
+  800a46:	c3                   	ret
+
+00800a47 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a47:	55                   	push   %ebp
+  800a48:	89 e5                	mov    %esp,%ebp
+  800a4a:	57                   	push   %edi
+  800a4b:	56                   	push   %esi
+  800a4c:	53                   	push   %ebx
+  800a4d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a50:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  800a53:	eb 03                	jmp    800a58 <strtol+0x11>
+    s++;
+  800a55:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  800a58:	0f b6 02             	movzbl (%edx),%eax
+  800a5b:	3c 20                	cmp    $0x20,%al
+  800a5d:	74 f6                	je     800a55 <strtol+0xe>
+  800a5f:	3c 09                	cmp    $0x9,%al
+  800a61:	74 f2                	je     800a55 <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  800a63:	3c 2b                	cmp    $0x2b,%al
+  800a65:	74 2a                	je     800a91 <strtol+0x4a>
+  int neg = 0;
+  800a67:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  800a6c:	3c 2d                	cmp    $0x2d,%al
+  800a6e:	74 2b                	je     800a9b <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a70:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a76:	75 0f                	jne    800a87 <strtol+0x40>
+  800a78:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a7b:	74 28                	je     800aa5 <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  800a7d:	85 db                	test   %ebx,%ebx
+  800a7f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a84:	0f 44 d8             	cmove  %eax,%ebx
+  800a87:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a8c:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a8f:	eb 46                	jmp    800ad7 <strtol+0x90>
+    s++;
+  800a91:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  800a94:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a99:	eb d5                	jmp    800a70 <strtol+0x29>
+    s++, neg = 1;
+  800a9b:	83 c2 01             	add    $0x1,%edx
+  800a9e:	bf 01 00 00 00       	mov    $0x1,%edi
+  800aa3:	eb cb                	jmp    800a70 <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800aa5:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800aa9:	74 0e                	je     800ab9 <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  800aab:	85 db                	test   %ebx,%ebx
+  800aad:	75 d8                	jne    800a87 <strtol+0x40>
+    s++, base = 8;
+  800aaf:	83 c2 01             	add    $0x1,%edx
+  800ab2:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800ab7:	eb ce                	jmp    800a87 <strtol+0x40>
+    s += 2, base = 16;
+  800ab9:	83 c2 02             	add    $0x2,%edx
+  800abc:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800ac1:	eb c4                	jmp    800a87 <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  800ac3:	0f be c0             	movsbl %al,%eax
+  800ac6:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  800ac9:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800acc:	7d 3a                	jge    800b08 <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  800ace:	83 c2 01             	add    $0x1,%edx
+  800ad1:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800ad5:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  800ad7:	0f b6 02             	movzbl (%edx),%eax
+  800ada:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800add:	89 f3                	mov    %esi,%ebx
+  800adf:	80 fb 09             	cmp    $0x9,%bl
+  800ae2:	76 df                	jbe    800ac3 <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  800ae4:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800ae7:	89 f3                	mov    %esi,%ebx
+  800ae9:	80 fb 19             	cmp    $0x19,%bl
+  800aec:	77 08                	ja     800af6 <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  800aee:	0f be c0             	movsbl %al,%eax
+  800af1:	83 e8 57             	sub    $0x57,%eax
+  800af4:	eb d3                	jmp    800ac9 <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  800af6:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800af9:	89 f3                	mov    %esi,%ebx
+  800afb:	80 fb 19             	cmp    $0x19,%bl
+  800afe:	77 08                	ja     800b08 <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  800b00:	0f be c0             	movsbl %al,%eax
+  800b03:	83 e8 37             	sub    $0x37,%eax
+  800b06:	eb c1                	jmp    800ac9 <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  800b08:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b0c:	74 05                	je     800b13 <strtol+0xcc>
+    *endptr = (char*)s;
+  800b0e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b11:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  800b13:	89 c8                	mov    %ecx,%eax
+  800b15:	f7 d8                	neg    %eax
+  800b17:	85 ff                	test   %edi,%edi
+  800b19:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b1c:	89 c8                	mov    %ecx,%eax
+  800b1e:	5b                   	pop    %ebx
+  800b1f:	5e                   	pop    %esi
+  800b20:	5f                   	pop    %edi
+  800b21:	5d                   	pop    %ebp
+  800b22:	c3                   	ret
+
+00800b23 <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800b23:	55                   	push   %ebp
+  800b24:	89 e5                	mov    %esp,%ebp
+  800b26:	57                   	push   %edi
+  800b27:	56                   	push   %esi
+  800b28:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800b29:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b2e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b31:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b34:	89 c3                	mov    %eax,%ebx
+  800b36:	89 c7                	mov    %eax,%edi
+  800b38:	89 c6                	mov    %eax,%esi
+  800b3a:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800b3c:	5b                   	pop    %ebx
+  800b3d:	5e                   	pop    %esi
+  800b3e:	5f                   	pop    %edi
+  800b3f:	5d                   	pop    %ebp
+  800b40:	c3                   	ret
+
+00800b41 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800b41:	55                   	push   %ebp
+  800b42:	89 e5                	mov    %esp,%ebp
+  800b44:	57                   	push   %edi
+  800b45:	56                   	push   %esi
+  800b46:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800b47:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b4c:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b51:	89 d1                	mov    %edx,%ecx
+  800b53:	89 d3                	mov    %edx,%ebx
+  800b55:	89 d7                	mov    %edx,%edi
+  800b57:	89 d6                	mov    %edx,%esi
+  800b59:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800b5b:	5b                   	pop    %ebx
+  800b5c:	5e                   	pop    %esi
+  800b5d:	5f                   	pop    %edi
+  800b5e:	5d                   	pop    %ebp
+  800b5f:	c3                   	ret
+
+00800b60 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800b60:	55                   	push   %ebp
+  800b61:	89 e5                	mov    %esp,%ebp
+  800b63:	57                   	push   %edi
+  800b64:	56                   	push   %esi
+  800b65:	53                   	push   %ebx
+  800b66:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800b69:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b6e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b71:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b76:	89 cb                	mov    %ecx,%ebx
+  800b78:	89 cf                	mov    %ecx,%edi
+  800b7a:	89 ce                	mov    %ecx,%esi
+  800b7c:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800b7e:	85 c0                	test   %eax,%eax
+  800b80:	7f 08                	jg     800b8a <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800b82:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b85:	5b                   	pop    %ebx
+  800b86:	5e                   	pop    %esi
+  800b87:	5f                   	pop    %edi
+  800b88:	5d                   	pop    %ebp
+  800b89:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800b8a:	83 ec 0c             	sub    $0xc,%esp
+  800b8d:	50                   	push   %eax
+  800b8e:	6a 03                	push   $0x3
+  800b90:	68 43 3d 80 00       	push   $0x803d43
+  800b95:	6a 23                	push   $0x23
+  800b97:	68 60 3d 80 00       	push   $0x803d60
+  800b9c:	e8 ec 2a 00 00       	call   80368d <_panic>
+
+00800ba1 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800ba1:	55                   	push   %ebp
+  800ba2:	89 e5                	mov    %esp,%ebp
+  800ba4:	57                   	push   %edi
+  800ba5:	56                   	push   %esi
+  800ba6:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800ba7:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bac:	b8 02 00 00 00       	mov    $0x2,%eax
+  800bb1:	89 d1                	mov    %edx,%ecx
+  800bb3:	89 d3                	mov    %edx,%ebx
+  800bb5:	89 d7                	mov    %edx,%edi
+  800bb7:	89 d6                	mov    %edx,%esi
+  800bb9:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800bbb:	5b                   	pop    %ebx
+  800bbc:	5e                   	pop    %esi
+  800bbd:	5f                   	pop    %edi
+  800bbe:	5d                   	pop    %ebp
+  800bbf:	c3                   	ret
+
+00800bc0 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800bc0:	55                   	push   %ebp
+  800bc1:	89 e5                	mov    %esp,%ebp
+  800bc3:	57                   	push   %edi
+  800bc4:	56                   	push   %esi
+  800bc5:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800bc6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bcb:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800bd0:	89 d1                	mov    %edx,%ecx
+  800bd2:	89 d3                	mov    %edx,%ebx
+  800bd4:	89 d7                	mov    %edx,%edi
+  800bd6:	89 d6                	mov    %edx,%esi
+  800bd8:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800bda:	5b                   	pop    %ebx
+  800bdb:	5e                   	pop    %esi
+  800bdc:	5f                   	pop    %edi
+  800bdd:	5d                   	pop    %ebp
+  800bde:	c3                   	ret
+
+00800bdf <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  800bdf:	55                   	push   %ebp
+  800be0:	89 e5                	mov    %esp,%ebp
+  800be2:	57                   	push   %edi
+  800be3:	56                   	push   %esi
+  800be4:	53                   	push   %ebx
+  800be5:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  800be8:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  800bec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800bf1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bf4:	b8 14 00 00 00       	mov    $0x14,%eax
+  800bf9:	89 df                	mov    %ebx,%edi
+  800bfb:	89 de                	mov    %ebx,%esi
+  800bfd:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800bff:	85 c0                	test   %eax,%eax
+  800c01:	7f 08                	jg     800c0b <sys_env_set_cow+0x2c>
+}
+  800c03:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c06:	5b                   	pop    %ebx
+  800c07:	5e                   	pop    %esi
+  800c08:	5f                   	pop    %edi
+  800c09:	5d                   	pop    %ebp
+  800c0a:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c0b:	83 ec 0c             	sub    $0xc,%esp
+  800c0e:	50                   	push   %eax
+  800c0f:	6a 14                	push   $0x14
+  800c11:	68 43 3d 80 00       	push   $0x803d43
+  800c16:	6a 23                	push   $0x23
+  800c18:	68 60 3d 80 00       	push   $0x803d60
+  800c1d:	e8 6b 2a 00 00       	call   80368d <_panic>
+
+00800c22 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800c22:	55                   	push   %ebp
+  800c23:	89 e5                	mov    %esp,%ebp
+  800c25:	57                   	push   %edi
+  800c26:	56                   	push   %esi
+  800c27:	53                   	push   %ebx
+  800c28:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800c2b:	be 00 00 00 00       	mov    $0x0,%esi
+  800c30:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c33:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c36:	b8 04 00 00 00       	mov    $0x4,%eax
+  800c3b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c3e:	89 f7                	mov    %esi,%edi
+  800c40:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c42:	85 c0                	test   %eax,%eax
+  800c44:	7f 08                	jg     800c4e <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  800c46:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c49:	5b                   	pop    %ebx
+  800c4a:	5e                   	pop    %esi
+  800c4b:	5f                   	pop    %edi
+  800c4c:	5d                   	pop    %ebp
+  800c4d:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c4e:	83 ec 0c             	sub    $0xc,%esp
+  800c51:	50                   	push   %eax
+  800c52:	6a 04                	push   $0x4
+  800c54:	68 43 3d 80 00       	push   $0x803d43
+  800c59:	6a 23                	push   $0x23
+  800c5b:	68 60 3d 80 00       	push   $0x803d60
+  800c60:	e8 28 2a 00 00       	call   80368d <_panic>
+
+00800c65 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800c65:	55                   	push   %ebp
+  800c66:	89 e5                	mov    %esp,%ebp
+  800c68:	57                   	push   %edi
+  800c69:	56                   	push   %esi
+  800c6a:	53                   	push   %ebx
+  800c6b:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800c6e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c71:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c74:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c79:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c7c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c7f:	8b 75 18             	mov    0x18(%ebp),%esi
+  800c82:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c84:	85 c0                	test   %eax,%eax
+  800c86:	7f 08                	jg     800c90 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  800c88:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c8b:	5b                   	pop    %ebx
+  800c8c:	5e                   	pop    %esi
+  800c8d:	5f                   	pop    %edi
+  800c8e:	5d                   	pop    %ebp
+  800c8f:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c90:	83 ec 0c             	sub    $0xc,%esp
+  800c93:	50                   	push   %eax
+  800c94:	6a 05                	push   $0x5
+  800c96:	68 43 3d 80 00       	push   $0x803d43
+  800c9b:	6a 23                	push   $0x23
+  800c9d:	68 60 3d 80 00       	push   $0x803d60
+  800ca2:	e8 e6 29 00 00       	call   80368d <_panic>
+
+00800ca7 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800ca7:	55                   	push   %ebp
+  800ca8:	89 e5                	mov    %esp,%ebp
+  800caa:	57                   	push   %edi
+  800cab:	56                   	push   %esi
+  800cac:	53                   	push   %ebx
+  800cad:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800cb0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cb5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cb8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cbb:	b8 06 00 00 00       	mov    $0x6,%eax
+  800cc0:	89 df                	mov    %ebx,%edi
+  800cc2:	89 de                	mov    %ebx,%esi
+  800cc4:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800cc6:	85 c0                	test   %eax,%eax
+  800cc8:	7f 08                	jg     800cd2 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  800cca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ccd:	5b                   	pop    %ebx
+  800cce:	5e                   	pop    %esi
+  800ccf:	5f                   	pop    %edi
+  800cd0:	5d                   	pop    %ebp
+  800cd1:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800cd2:	83 ec 0c             	sub    $0xc,%esp
+  800cd5:	50                   	push   %eax
+  800cd6:	6a 06                	push   $0x6
+  800cd8:	68 43 3d 80 00       	push   $0x803d43
+  800cdd:	6a 23                	push   $0x23
+  800cdf:	68 60 3d 80 00       	push   $0x803d60
+  800ce4:	e8 a4 29 00 00       	call   80368d <_panic>
+
+00800ce9 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  800ce9:	55                   	push   %ebp
+  800cea:	89 e5                	mov    %esp,%ebp
+  800cec:	57                   	push   %edi
+  800ced:	56                   	push   %esi
+  800cee:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800cef:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cf2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cf5:	b8 11 00 00 00       	mov    $0x11,%eax
+  800cfa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cfd:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d00:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d03:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  800d05:	5b                   	pop    %ebx
+  800d06:	5e                   	pop    %esi
+  800d07:	5f                   	pop    %edi
+  800d08:	5d                   	pop    %ebp
+  800d09:	c3                   	ret
+
+00800d0a <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  800d0a:	55                   	push   %ebp
+  800d0b:	89 e5                	mov    %esp,%ebp
+  800d0d:	57                   	push   %edi
+  800d0e:	56                   	push   %esi
+  800d0f:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d10:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d13:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d16:	b8 12 00 00 00       	mov    $0x12,%eax
+  800d1b:	be 00 00 00 00       	mov    $0x0,%esi
+  800d20:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d23:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d26:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  800d28:	5b                   	pop    %ebx
+  800d29:	5e                   	pop    %esi
+  800d2a:	5f                   	pop    %edi
+  800d2b:	5d                   	pop    %ebp
+  800d2c:	c3                   	ret
+
+00800d2d <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  800d2d:	55                   	push   %ebp
+  800d2e:	89 e5                	mov    %esp,%ebp
+  800d30:	57                   	push   %edi
+  800d31:	56                   	push   %esi
+  800d32:	53                   	push   %ebx
+  800d33:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800d36:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d3b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d3e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d41:	b8 16 00 00 00       	mov    $0x16,%eax
+  800d46:	89 df                	mov    %ebx,%edi
+  800d48:	89 de                	mov    %ebx,%esi
+  800d4a:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d4c:	85 c0                	test   %eax,%eax
+  800d4e:	7f 08                	jg     800d58 <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  800d50:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d53:	5b                   	pop    %ebx
+  800d54:	5e                   	pop    %esi
+  800d55:	5f                   	pop    %edi
+  800d56:	5d                   	pop    %ebp
+  800d57:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d58:	83 ec 0c             	sub    $0xc,%esp
+  800d5b:	50                   	push   %eax
+  800d5c:	6a 16                	push   $0x16
+  800d5e:	68 43 3d 80 00       	push   $0x803d43
+  800d63:	6a 23                	push   $0x23
+  800d65:	68 60 3d 80 00       	push   $0x803d60
+  800d6a:	e8 1e 29 00 00       	call   80368d <_panic>
+
+00800d6f <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  800d6f:	55                   	push   %ebp
+  800d70:	89 e5                	mov    %esp,%ebp
+  800d72:	57                   	push   %edi
+  800d73:	56                   	push   %esi
+  800d74:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d75:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d7a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d7d:	b8 17 00 00 00       	mov    $0x17,%eax
+  800d82:	89 cb                	mov    %ecx,%ebx
+  800d84:	89 cf                	mov    %ecx,%edi
+  800d86:	89 ce                	mov    %ecx,%esi
+  800d88:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  800d8a:	5b                   	pop    %ebx
+  800d8b:	5e                   	pop    %esi
+  800d8c:	5f                   	pop    %edi
+  800d8d:	5d                   	pop    %ebp
+  800d8e:	c3                   	ret
+
+00800d8f <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  800d8f:	55                   	push   %ebp
+  800d90:	89 e5                	mov    %esp,%ebp
+  800d92:	57                   	push   %edi
+  800d93:	56                   	push   %esi
+  800d94:	53                   	push   %ebx
+  800d95:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800d98:	be 00 00 00 00       	mov    $0x0,%esi
+  800d9d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800da0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800da3:	b8 18 00 00 00       	mov    $0x18,%eax
+  800da8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dab:	89 f7                	mov    %esi,%edi
+  800dad:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800daf:	85 c0                	test   %eax,%eax
+  800db1:	7f 08                	jg     800dbb <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  800db3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800db6:	5b                   	pop    %ebx
+  800db7:	5e                   	pop    %esi
+  800db8:	5f                   	pop    %edi
+  800db9:	5d                   	pop    %ebp
+  800dba:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800dbb:	83 ec 0c             	sub    $0xc,%esp
+  800dbe:	50                   	push   %eax
+  800dbf:	6a 18                	push   $0x18
+  800dc1:	68 43 3d 80 00       	push   $0x803d43
+  800dc6:	6a 23                	push   $0x23
+  800dc8:	68 60 3d 80 00       	push   $0x803d60
+  800dcd:	e8 bb 28 00 00       	call   80368d <_panic>
+
+00800dd2 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  800dd2:	55                   	push   %ebp
+  800dd3:	89 e5                	mov    %esp,%ebp
+  800dd5:	57                   	push   %edi
+  800dd6:	56                   	push   %esi
+  800dd7:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800dd8:	be 00 00 00 00       	mov    $0x0,%esi
+  800ddd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800de0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800de3:	b8 19 00 00 00       	mov    $0x19,%eax
+  800de8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800deb:	89 f7                	mov    %esi,%edi
+  800ded:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  800def:	5b                   	pop    %ebx
+  800df0:	5e                   	pop    %esi
+  800df1:	5f                   	pop    %edi
+  800df2:	5d                   	pop    %ebp
+  800df3:	c3                   	ret
+
+00800df4 <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  800df4:	55                   	push   %ebp
+  800df5:	89 e5                	mov    %esp,%ebp
+  800df7:	57                   	push   %edi
+  800df8:	56                   	push   %esi
+  800df9:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800dfa:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dff:	b8 15 00 00 00       	mov    $0x15,%eax
+  800e04:	89 d1                	mov    %edx,%ecx
+  800e06:	89 d3                	mov    %edx,%ebx
+  800e08:	89 d7                	mov    %edx,%edi
+  800e0a:	89 d6                	mov    %edx,%esi
+  800e0c:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800e0e:	5b                   	pop    %ebx
+  800e0f:	5e                   	pop    %esi
+  800e10:	5f                   	pop    %edi
+  800e11:	5d                   	pop    %ebp
+  800e12:	c3                   	ret
+
+00800e13 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800e13:	55                   	push   %ebp
+  800e14:	89 e5                	mov    %esp,%ebp
+  800e16:	57                   	push   %edi
+  800e17:	56                   	push   %esi
+  800e18:	53                   	push   %ebx
+  800e19:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e1c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e21:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e24:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e27:	b8 08 00 00 00       	mov    $0x8,%eax
+  800e2c:	89 df                	mov    %ebx,%edi
+  800e2e:	89 de                	mov    %ebx,%esi
+  800e30:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e32:	85 c0                	test   %eax,%eax
+  800e34:	7f 08                	jg     800e3e <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800e36:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e39:	5b                   	pop    %ebx
+  800e3a:	5e                   	pop    %esi
+  800e3b:	5f                   	pop    %edi
+  800e3c:	5d                   	pop    %ebp
+  800e3d:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e3e:	83 ec 0c             	sub    $0xc,%esp
+  800e41:	50                   	push   %eax
+  800e42:	6a 08                	push   $0x8
+  800e44:	68 43 3d 80 00       	push   $0x803d43
+  800e49:	6a 23                	push   $0x23
+  800e4b:	68 60 3d 80 00       	push   $0x803d60
+  800e50:	e8 38 28 00 00       	call   80368d <_panic>
+
+00800e55 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800e55:	55                   	push   %ebp
+  800e56:	89 e5                	mov    %esp,%ebp
+  800e58:	57                   	push   %edi
+  800e59:	56                   	push   %esi
+  800e5a:	53                   	push   %ebx
+  800e5b:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e5e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e63:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e66:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e69:	b8 09 00 00 00       	mov    $0x9,%eax
+  800e6e:	89 df                	mov    %ebx,%edi
+  800e70:	89 de                	mov    %ebx,%esi
+  800e72:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e74:	85 c0                	test   %eax,%eax
+  800e76:	7f 08                	jg     800e80 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  800e78:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e7b:	5b                   	pop    %ebx
+  800e7c:	5e                   	pop    %esi
+  800e7d:	5f                   	pop    %edi
+  800e7e:	5d                   	pop    %ebp
+  800e7f:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e80:	83 ec 0c             	sub    $0xc,%esp
+  800e83:	50                   	push   %eax
+  800e84:	6a 09                	push   $0x9
+  800e86:	68 43 3d 80 00       	push   $0x803d43
+  800e8b:	6a 23                	push   $0x23
+  800e8d:	68 60 3d 80 00       	push   $0x803d60
+  800e92:	e8 f6 27 00 00       	call   80368d <_panic>
+
+00800e97 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800e97:	55                   	push   %ebp
+  800e98:	89 e5                	mov    %esp,%ebp
+  800e9a:	57                   	push   %edi
+  800e9b:	56                   	push   %esi
+  800e9c:	53                   	push   %ebx
+  800e9d:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800ea0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ea5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ea8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eab:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800eb0:	89 df                	mov    %ebx,%edi
+  800eb2:	89 de                	mov    %ebx,%esi
+  800eb4:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800eb6:	85 c0                	test   %eax,%eax
+  800eb8:	7f 08                	jg     800ec2 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  800eba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ebd:	5b                   	pop    %ebx
+  800ebe:	5e                   	pop    %esi
+  800ebf:	5f                   	pop    %edi
+  800ec0:	5d                   	pop    %ebp
+  800ec1:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ec2:	83 ec 0c             	sub    $0xc,%esp
+  800ec5:	50                   	push   %eax
+  800ec6:	6a 0a                	push   $0xa
+  800ec8:	68 43 3d 80 00       	push   $0x803d43
+  800ecd:	6a 23                	push   $0x23
+  800ecf:	68 60 3d 80 00       	push   $0x803d60
+  800ed4:	e8 b4 27 00 00       	call   80368d <_panic>
+
+00800ed9 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  800ed9:	55                   	push   %ebp
+  800eda:	89 e5                	mov    %esp,%ebp
+  800edc:	57                   	push   %edi
+  800edd:	56                   	push   %esi
+  800ede:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800edf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ee5:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800eea:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800eed:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ef0:	8b 75 18             	mov    0x18(%ebp),%esi
+  800ef3:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  800ef5:	5b                   	pop    %ebx
+  800ef6:	5e                   	pop    %esi
+  800ef7:	5f                   	pop    %edi
+  800ef8:	5d                   	pop    %ebp
+  800ef9:	c3                   	ret
+
+00800efa <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  800efa:	55                   	push   %ebp
+  800efb:	89 e5                	mov    %esp,%ebp
+  800efd:	57                   	push   %edi
+  800efe:	56                   	push   %esi
+  800eff:	53                   	push   %ebx
+  800f00:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f03:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f08:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f0b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f0e:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f13:	89 df                	mov    %ebx,%edi
+  800f15:	89 de                	mov    %ebx,%esi
+  800f17:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f19:	85 c0                	test   %eax,%eax
+  800f1b:	7f 08                	jg     800f25 <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  800f1d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f20:	5b                   	pop    %ebx
+  800f21:	5e                   	pop    %esi
+  800f22:	5f                   	pop    %edi
+  800f23:	5d                   	pop    %ebp
+  800f24:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f25:	83 ec 0c             	sub    $0xc,%esp
+  800f28:	50                   	push   %eax
+  800f29:	6a 0d                	push   $0xd
+  800f2b:	68 43 3d 80 00       	push   $0x803d43
+  800f30:	6a 23                	push   $0x23
+  800f32:	68 60 3d 80 00       	push   $0x803d60
+  800f37:	e8 51 27 00 00       	call   80368d <_panic>
+
+00800f3c <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  800f3c:	55                   	push   %ebp
+  800f3d:	89 e5                	mov    %esp,%ebp
+  800f3f:	57                   	push   %edi
+  800f40:	56                   	push   %esi
+  800f41:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f42:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f47:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800f4c:	89 d1                	mov    %edx,%ecx
+  800f4e:	89 d3                	mov    %edx,%ebx
+  800f50:	89 d7                	mov    %edx,%edi
+  800f52:	89 d6                	mov    %edx,%esi
+  800f54:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800f56:	5b                   	pop    %ebx
+  800f57:	5e                   	pop    %esi
+  800f58:	5f                   	pop    %edi
+  800f59:	5d                   	pop    %ebp
+  800f5a:	c3                   	ret
+
+00800f5b <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  800f5b:	55                   	push   %ebp
+  800f5c:	89 e5                	mov    %esp,%ebp
+  800f5e:	57                   	push   %edi
+  800f5f:	56                   	push   %esi
+  800f60:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f61:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f64:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f67:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f6c:	be 00 00 00 00       	mov    $0x0,%esi
+  800f71:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f74:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f77:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  800f79:	5b                   	pop    %ebx
+  800f7a:	5e                   	pop    %esi
+  800f7b:	5f                   	pop    %edi
+  800f7c:	5d                   	pop    %ebp
+  800f7d:	c3                   	ret
+
+00800f7e <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  800f7e:	55                   	push   %ebp
+  800f7f:	89 e5                	mov    %esp,%ebp
+  800f81:	57                   	push   %edi
+  800f82:	56                   	push   %esi
+  800f83:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f84:	be 00 00 00 00       	mov    $0x0,%esi
+  800f89:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f8c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f8f:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f94:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f97:	89 f7                	mov    %esi,%edi
+  800f99:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  800f9b:	5b                   	pop    %ebx
+  800f9c:	5e                   	pop    %esi
+  800f9d:	5f                   	pop    %edi
+  800f9e:	5d                   	pop    %ebp
+  800f9f:	c3                   	ret
+
+00800fa0 <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  800fa0:	55                   	push   %ebp
+  800fa1:	89 e5                	mov    %esp,%ebp
+  800fa3:	57                   	push   %edi
+  800fa4:	56                   	push   %esi
+  800fa5:	53                   	push   %ebx
+  800fa6:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  800fa9:	80 3d a8 58 80 00 00 	cmpb   $0x0,0x8058a8
+  800fb0:	74 41                	je     800ff3 <sys_batch+0x53>
+  800fb2:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fb5:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  800fb8:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  800fbf:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800fc2:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  800fc5:	7d 45                	jge    80100c <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  800fc7:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800fca:	8b 06                	mov    (%esi),%eax
+  800fcc:	8b 56 04             	mov    0x4(%esi),%edx
+  800fcf:	8b 4e 08             	mov    0x8(%esi),%ecx
+  800fd2:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  800fd5:	8b 7e 10             	mov    0x10(%esi),%edi
+  800fd8:	8b 76 14             	mov    0x14(%esi),%esi
+  800fdb:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  800fdd:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800fe0:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  800fe3:	83 c6 1c             	add    $0x1c,%esi
+  800fe6:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  800fe9:	85 c0                	test   %eax,%eax
+  800feb:	78 1f                	js     80100c <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  800fed:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  800ff1:	eb cc                	jmp    800fbf <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  800ff3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ff8:	b8 13 00 00 00       	mov    $0x13,%eax
+  800ffd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801000:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801003:	89 df                	mov    %ebx,%edi
+  801005:	89 de                	mov    %ebx,%esi
+  801007:	cd 30                	int    $0x30
+  801009:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  80100c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80100f:	83 c4 08             	add    $0x8,%esp
+  801012:	5b                   	pop    %ebx
+  801013:	5e                   	pop    %esi
+  801014:	5f                   	pop    %edi
+  801015:	5d                   	pop    %ebp
+  801016:	c3                   	ret
+
+00801017 <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  801017:	55                   	push   %ebp
+  801018:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  80101a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80101d:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  801023:	5d                   	pop    %ebp
+  801024:	c3                   	ret
+
+00801025 <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  801025:	55                   	push   %ebp
+  801026:	89 e5                	mov    %esp,%ebp
+  801028:	56                   	push   %esi
+  801029:	53                   	push   %ebx
+  80102a:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  80102d:	8b 1e                	mov    (%esi),%ebx
+  80102f:	85 db                	test   %ebx,%ebx
+  801031:	75 09                	jne    80103c <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  801033:	89 d8                	mov    %ebx,%eax
+  801035:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801038:	5b                   	pop    %ebx
+  801039:	5e                   	pop    %esi
+  80103a:	5d                   	pop    %ebp
+  80103b:	c3                   	ret
+  b->sb_n = 0;
+  80103c:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  801042:	53                   	push   %ebx
+  801043:	8d 46 04             	lea    0x4(%esi),%eax
+  801046:	50                   	push   %eax
+  801047:	e8 54 ff ff ff       	call   800fa0 <sys_batch>
+  80104c:	83 c4 08             	add    $0x8,%esp
+  80104f:	85 c0                	test   %eax,%eax
+  801051:	78 1e                	js     801071 <sysbatch_flush+0x4c>
+  if (r < n)
+  801053:	39 c3                	cmp    %eax,%ebx
+  801055:	7f 07                	jg     80105e <sysbatch_flush+0x39>
+  return 0;
+  801057:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80105c:	eb d5                	jmp    801033 <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  80105e:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801061:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  801065:	85 db                	test   %ebx,%ebx
+  801067:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80106c:	0f 49 d8             	cmovns %eax,%ebx
+  80106f:	eb c2                	jmp    801033 <sysbatch_flush+0xe>
+    return r;
+  801071:	89 c3                	mov    %eax,%ebx
+  801073:	eb be                	jmp    801033 <sysbatch_flush+0xe>
+
+00801075 <sysbatch_add>:
+{
+  801075:	55                   	push   %ebp
+  801076:	89 e5                	mov    %esp,%ebp
+  801078:	53                   	push   %ebx
+  801079:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  80107c:	83 3b 40             	cmpl   $0x40,(%ebx)
+  80107f:	74 41                	je     8010c2 <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  801081:	8b 03                	mov    (%ebx),%eax
+  801083:	8d 50 01             	lea    0x1(%eax),%edx
+  801086:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  801088:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80108b:	01 d8                	add    %ebx,%eax
+  80108d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801090:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  801093:	8b 55 10             	mov    0x10(%ebp),%edx
+  801096:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  801099:	8b 55 14             	mov    0x14(%ebp),%edx
+  80109c:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  80109f:	8b 55 18             	mov    0x18(%ebp),%edx
+  8010a2:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  8010a5:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  8010a8:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  8010ab:	8b 55 20             	mov    0x20(%ebp),%edx
+  8010ae:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  8010b1:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  8010b8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8010bd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8010c0:	c9                   	leave
+  8010c1:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  8010c2:	53                   	push   %ebx
+  8010c3:	e8 5d ff ff ff       	call   801025 <sysbatch_flush>
+  8010c8:	83 c4 04             	add    $0x4,%esp
+  8010cb:	85 c0                	test   %eax,%eax
+  8010cd:	79 b2                	jns    801081 <sysbatch_add+0xc>
+  8010cf:	eb ec                	jmp    8010bd <sysbatch_add+0x48>
+
+008010d1 <pgfault>:
+// Custom page fault handler - if faulting page is copy-on-write,
+// map in our own private writable copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  8010d1:	55                   	push   %ebp
+  8010d2:	89 e5                	mov    %esp,%ebp
+  8010d4:	56                   	push   %esi
+  8010d5:	53                   	push   %ebx
+  8010d6:	8b 45 08             	mov    0x8(%ebp),%eax
+  void *addr = (void*)utf->utf_fault_va;
+  8010d9:	8b 18                	mov    (%eax),%ebx
+  uint32_t err = utf->utf_err;
+  8010db:	8b 70 04             	mov    0x4(%eax),%esi
+  // Hint:
+  //   Use the read-only page table mappings at uvpt
+  //   (see <inc/memlayout.h>).
+
+  // Faults in file mappings are mmap's to handle.
+  if (mmap_fault(utf))
+  8010de:	83 ec 0c             	sub    $0xc,%esp
+  8010e1:	50                   	push   %eax
+  8010e2:	e8 17 1f 00 00       	call   802ffe <mmap_fault>
+  8010e7:	83 c4 10             	add    $0x10,%esp
+  8010ea:	84 c0                	test   %al,%al
+  8010ec:	75 7d                	jne    80116b <pgfault+0x9a>
+    return;
+
+  // LAB 4: Your code here.
+  if ( !(err & FEC_WR) ) {
+  8010ee:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  8010f4:	74 7c                	je     801172 <pgfault+0xa1>
+    panic("user_pgfault: %e", err);
+  }
+
+  if ( !(uvpt[PGNUM(addr)] & PTE_COW) ) {
+  8010f6:	89 d8                	mov    %ebx,%eax
+  8010f8:	c1 e8 0c             	shr    $0xc,%eax
+  8010fb:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801102:	f6 c4 08             	test   $0x8,%ah
+  801105:	74 7d                	je     801184 <pgfault+0xb3>
+  // page to the old page's address.
+  // Hint:
+  //   You should make three system calls.
+
+  // LAB 4: Your code here.
+  addr = ROUNDDOWN(addr, PGSIZE);
+  801107:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+
+  // map page to temporary location
+  if ( (r = sys_page_alloc(0, PFTEMP, (PTE_P | PTE_U | PTE_W))) < 0) {
+  80110d:	83 ec 04             	sub    $0x4,%esp
+  801110:	6a 07                	push   $0x7
+  801112:	68 00 f0 7f 00       	push   $0x7ff000
+  801117:	6a 00                	push   $0x0
+  801119:	e8 04 fb ff ff       	call   800c22 <sys_page_alloc>
+  80111e:	83 c4 10             	add    $0x10,%esp
+  801121:	85 c0                	test   %eax,%eax
+  801123:	78 73                	js     801198 <pgfault+0xc7>
+    panic("sys_page_alloc: %e", r);
+  }
+
+  // copy data from old page to new page
+  memmove(PFTEMP, addr, PGSIZE);
+  801125:	83 ec 04             	sub    $0x4,%esp
+  801128:	68 00 10 00 00       	push   $0x1000
+  80112d:	53                   	push   %ebx
+  80112e:	68 00 f0 7f 00       	push   $0x7ff000
+  801133:	e8 41 f8 ff ff       	call   800979 <memmove>
+
+  // move new page to old page address
+  if ( (r = sys_page_map(0, PFTEMP, 0, addr, (PTE_P | PTE_U | PTE_W))) < 0) {
+  801138:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  80113f:	53                   	push   %ebx
+  801140:	6a 00                	push   $0x0
+  801142:	68 00 f0 7f 00       	push   $0x7ff000
+  801147:	6a 00                	push   $0x0
+  801149:	e8 17 fb ff ff       	call   800c65 <sys_page_map>
+  80114e:	83 c4 20             	add    $0x20,%esp
+  801151:	85 c0                	test   %eax,%eax
+  801153:	78 55                	js     8011aa <pgfault+0xd9>
+    panic("sys_page_map: %e", r);
+  }
+
+  if ( (r = sys_page_unmap(0, PFTEMP)) < 0) {
+  801155:	83 ec 08             	sub    $0x8,%esp
+  801158:	68 00 f0 7f 00       	push   $0x7ff000
+  80115d:	6a 00                	push   $0x0
+  80115f:	e8 43 fb ff ff       	call   800ca7 <sys_page_unmap>
+  801164:	83 c4 10             	add    $0x10,%esp
+  801167:	85 c0                	test   %eax,%eax
+  801169:	78 51                	js     8011bc <pgfault+0xeb>
+    panic("sys_page_unmap: %e", r);
+  }
+}
+  80116b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80116e:	5b                   	pop    %ebx
+  80116f:	5e                   	pop    %esi
+  801170:	5d                   	pop    %ebp
+  801171:	c3                   	ret
+    panic("user_pgfault: %e", err);
+  801172:	56                   	push   %esi
+  801173:	68 6e 3d 80 00       	push   $0x803d6e
+  801178:	6a 1d                	push   $0x1d
+  80117a:	68 7f 3d 80 00       	push   $0x803d7f
+  80117f:	e8 09 25 00 00       	call   80368d <_panic>
+    panic("user_pgfault: page not COW");
+  801184:	83 ec 04             	sub    $0x4,%esp
+  801187:	68 8a 3d 80 00       	push   $0x803d8a
+  80118c:	6a 21                	push   $0x21
+  80118e:	68 7f 3d 80 00       	push   $0x803d7f
+  801193:	e8 f5 24 00 00       	call   80368d <_panic>
+    panic("sys_page_alloc: %e", r);
+  801198:	50                   	push   %eax
+  801199:	68 a5 3d 80 00       	push   $0x803da5
+  80119e:	6a 2f                	push   $0x2f
+  8011a0:	68 7f 3d 80 00       	push   $0x803d7f
+  8011a5:	e8 e3 24 00 00       	call   80368d <_panic>
+    panic("sys_page_map: %e", r);
+  8011aa:	50                   	push   %eax
+  8011ab:	68 b8 3d 80 00       	push   $0x803db8
+  8011b0:	6a 37                	push   $0x37
+  8011b2:	68 7f 3d 80 00       	push   $0x803d7f
+  8011b7:	e8 d1 24 00 00       	call   80368d <_panic>
+    panic("sys_page_unmap: %e", r);
+  8011bc:	50                   	push   %eax
+  8011bd:	68 c9 3d 80 00       	push   $0x803dc9
+  8011c2:	6a 3b                	push   $0x3b
+  8011c4:	68 7f 3d 80 00       	push   $0x803d7f
+  8011c9:	e8 bf 24 00 00       	call   80368d <_panic>
+
+008011ce <shared_pgfault>:
+
+// Challenge!
+//
+static void
+shared_pgfault(struct UTrapframe *utf)
+{
+  8011ce:	55                   	push   %ebp
+  8011cf:	89 e5                	mov    %esp,%ebp
+  8011d1:	53                   	push   %ebx
+  8011d2:	83 ec 10             	sub    $0x10,%esp
+  8011d5:	8b 45 08             	mov    0x8(%ebp),%eax
+  // just has fewer error checks
+  
+  void *addr = (void*)utf->utf_fault_va;
+  8011d8:	8b 18                	mov    (%eax),%ebx
+  uint32_t err = utf->utf_err;
+  int r;
+
+  if (mmap_fault(utf))
+  8011da:	50                   	push   %eax
+  8011db:	e8 1e 1e 00 00       	call   802ffe <mmap_fault>
+  8011e0:	83 c4 10             	add    $0x10,%esp
+  8011e3:	84 c0                	test   %al,%al
+  8011e5:	74 05                	je     8011ec <shared_pgfault+0x1e>
+  }
+
+  if ( (r = sys_page_unmap(0, PFTEMP)) < 0) {
+    panic("sys_page_unmap: %e", r);
+  }
+}
+  8011e7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8011ea:	c9                   	leave
+  8011eb:	c3                   	ret
+  addr = ROUNDDOWN(addr, PGSIZE);
+  8011ec:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if ( (r = sys_page_alloc(0, PFTEMP, (PTE_P | PTE_U | PTE_W))) < 0) {
+  8011f2:	83 ec 04             	sub    $0x4,%esp
+  8011f5:	6a 07                	push   $0x7
+  8011f7:	68 00 f0 7f 00       	push   $0x7ff000
+  8011fc:	6a 00                	push   $0x0
+  8011fe:	e8 1f fa ff ff       	call   800c22 <sys_page_alloc>
+  801203:	83 c4 10             	add    $0x10,%esp
+  801206:	85 c0                	test   %eax,%eax
+  801208:	78 5b                	js     801265 <shared_pgfault+0x97>
+  memmove(PFTEMP, addr, PGSIZE);
+  80120a:	83 ec 04             	sub    $0x4,%esp
+  80120d:	68 00 10 00 00       	push   $0x1000
+  801212:	53                   	push   %ebx
+  801213:	68 00 f0 7f 00       	push   $0x7ff000
+  801218:	e8 5c f7 ff ff       	call   800979 <memmove>
+  if ( (r = sys_page_map(0, PFTEMP, 0, addr, (PTE_P | PTE_U | PTE_W))) < 0) {
+  80121d:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801224:	53                   	push   %ebx
+  801225:	6a 00                	push   $0x0
+  801227:	68 00 f0 7f 00       	push   $0x7ff000
+  80122c:	6a 00                	push   $0x0
+  80122e:	e8 32 fa ff ff       	call   800c65 <sys_page_map>
+  801233:	83 c4 20             	add    $0x20,%esp
+  801236:	85 c0                	test   %eax,%eax
+  801238:	78 40                	js     80127a <shared_pgfault+0xac>
+  if ( (r = sys_page_unmap(0, PFTEMP)) < 0) {
+  80123a:	83 ec 08             	sub    $0x8,%esp
+  80123d:	68 00 f0 7f 00       	push   $0x7ff000
+  801242:	6a 00                	push   $0x0
+  801244:	e8 5e fa ff ff       	call   800ca7 <sys_page_unmap>
+  801249:	83 c4 10             	add    $0x10,%esp
+  80124c:	85 c0                	test   %eax,%eax
+  80124e:	79 97                	jns    8011e7 <shared_pgfault+0x19>
+    panic("sys_page_unmap: %e", r);
+  801250:	50                   	push   %eax
+  801251:	68 c9 3d 80 00       	push   $0x803dc9
+  801256:	68 b0 00 00 00       	push   $0xb0
+  80125b:	68 7f 3d 80 00       	push   $0x803d7f
+  801260:	e8 28 24 00 00       	call   80368d <_panic>
+    panic("sys_page_alloc: %e", r);
+  801265:	50                   	push   %eax
+  801266:	68 a5 3d 80 00       	push   $0x803da5
+  80126b:	68 a4 00 00 00       	push   $0xa4
+  801270:	68 7f 3d 80 00       	push   $0x803d7f
+  801275:	e8 13 24 00 00       	call   80368d <_panic>
+    panic("sys_page_map: %e", r);
+  80127a:	50                   	push   %eax
+  80127b:	68 b8 3d 80 00       	push   $0x803db8
+  801280:	68 ac 00 00 00       	push   $0xac
+  801285:	68 7f 3d 80 00       	push   $0x803d7f
+  80128a:	e8 fe 23 00 00       	call   80368d <_panic>
+
+0080128f <fork>:
+{
+  80128f:	55                   	push   %ebp
+  801290:	89 e5                	mov    %esp,%ebp
+  801292:	53                   	push   %ebx
+  801293:	83 ec 04             	sub    $0x4,%esp
+  parent_id = sys_getenvid();
+  801296:	e8 06 f9 ff ff       	call   800ba1 <sys_getenvid>
+  set_pgfault_handler(pgfault);
+  80129b:	83 ec 0c             	sub    $0xc,%esp
+  80129e:	68 d1 10 80 00       	push   $0x8010d1
+  8012a3:	e8 2b 24 00 00       	call   8036d3 <set_pgfault_handler>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+  envid_t ret;
+  __asm __volatile("int %2"
+  8012a8:	b8 07 00 00 00       	mov    $0x7,%eax
+  8012ad:	cd 30                	int    $0x30
+  8012af:	89 c3                	mov    %eax,%ebx
+  if (envid < 0) {
+  8012b1:	83 c4 10             	add    $0x10,%esp
+  8012b4:	85 c0                	test   %eax,%eax
+  8012b6:	78 66                	js     80131e <fork+0x8f>
+  } else if (envid == 0) {
+  8012b8:	74 76                	je     801330 <fork+0xa1>
+  if ( (error = sys_page_map_range(0, 0, UXSTACKTOP - PGSIZE,
+  8012ba:	83 ec 0c             	sub    $0xc,%esp
+  8012bd:	6a 01                	push   $0x1
+  8012bf:	50                   	push   %eax
+  8012c0:	68 00 f0 bf ee       	push   $0xeebff000
+  8012c5:	6a 00                	push   $0x0
+  8012c7:	6a 00                	push   $0x0
+  8012c9:	e8 1b fa ff ff       	call   800ce9 <sys_page_map_range>
+  8012ce:	83 c4 20             	add    $0x20,%esp
+  8012d1:	85 c0                	test   %eax,%eax
+  8012d3:	78 77                	js     80134c <fork+0xbd>
+  if ( (error = sys_page_alloc(envid,
+  8012d5:	83 ec 04             	sub    $0x4,%esp
+  8012d8:	6a 07                	push   $0x7
+  8012da:	68 00 f0 bf ee       	push   $0xeebff000
+  8012df:	53                   	push   %ebx
+  8012e0:	e8 3d f9 ff ff       	call   800c22 <sys_page_alloc>
+  8012e5:	83 c4 10             	add    $0x10,%esp
+  8012e8:	85 c0                	test   %eax,%eax
+  8012ea:	78 72                	js     80135e <fork+0xcf>
+          thisenv->env_pgfault_upcall)) < 0) {
+  8012ec:	a1 a4 58 80 00       	mov    0x8058a4,%eax
+  8012f1:	8b 40 64             	mov    0x64(%eax),%eax
+  if ( (error = sys_env_set_pgfault_upcall(envid,
+  8012f4:	83 ec 08             	sub    $0x8,%esp
+  8012f7:	50                   	push   %eax
+  8012f8:	53                   	push   %ebx
+  8012f9:	e8 99 fb ff ff       	call   800e97 <sys_env_set_pgfault_upcall>
+  8012fe:	83 c4 10             	add    $0x10,%esp
+  801301:	85 c0                	test   %eax,%eax
+  801303:	78 6b                	js     801370 <fork+0xe1>
+  if ( (error = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+  801305:	83 ec 08             	sub    $0x8,%esp
+  801308:	6a 02                	push   $0x2
+  80130a:	53                   	push   %ebx
+  80130b:	e8 03 fb ff ff       	call   800e13 <sys_env_set_status>
+  801310:	83 c4 10             	add    $0x10,%esp
+  801313:	85 c0                	test   %eax,%eax
+  801315:	78 6b                	js     801382 <fork+0xf3>
+}
+  801317:	89 d8                	mov    %ebx,%eax
+  801319:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80131c:	c9                   	leave
+  80131d:	c3                   	ret
+    panic("sys_exofork: %e", envid);
+  80131e:	50                   	push   %eax
+  80131f:	68 dc 3d 80 00       	push   $0x803ddc
+  801324:	6a 5e                	push   $0x5e
+  801326:	68 7f 3d 80 00       	push   $0x803d7f
+  80132b:	e8 5d 23 00 00       	call   80368d <_panic>
+    thisenv = &envs[ENVX(sys_getenvid())];
+  801330:	e8 6c f8 ff ff       	call   800ba1 <sys_getenvid>
+  801335:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80133a:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80133d:	c1 e0 04             	shl    $0x4,%eax
+  801340:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801345:	a3 a4 58 80 00       	mov    %eax,0x8058a4
+    return 0;
+  80134a:	eb cb                	jmp    801317 <fork+0x88>
+    panic("sys_page_map_range: %e", error);
+  80134c:	50                   	push   %eax
+  80134d:	68 ec 3d 80 00       	push   $0x803dec
+  801352:	6a 69                	push   $0x69
+  801354:	68 7f 3d 80 00       	push   $0x803d7f
+  801359:	e8 2f 23 00 00       	call   80368d <_panic>
+    panic("sys_page_alloc: %e", error);
+  80135e:	50                   	push   %eax
+  80135f:	68 a5 3d 80 00       	push   $0x803da5
+  801364:	6a 70                	push   $0x70
+  801366:	68 7f 3d 80 00       	push   $0x803d7f
+  80136b:	e8 1d 23 00 00       	call   80368d <_panic>
+    panic("sys_env_set_pgfault_upcall: %e", error);
+  801370:	50                   	push   %eax
+  801371:	68 1c 3e 80 00       	push   $0x803e1c
+  801376:	6a 76                	push   $0x76
+  801378:	68 7f 3d 80 00       	push   $0x803d7f
+  80137d:	e8 0b 23 00 00       	call   80368d <_panic>
+    panic("sys_env_set_status: %e", error);
+  801382:	50                   	push   %eax
+  801383:	68 03 3e 80 00       	push   $0x803e03
+  801388:	6a 7a                	push   $0x7a
+  80138a:	68 7f 3d 80 00       	push   $0x803d7f
+  80138f:	e8 f9 22 00 00       	call   80368d <_panic>
+
+00801394 <kfork>:
+{
+  801394:	55                   	push   %ebp
+  801395:	89 e5                	mov    %esp,%ebp
+  801397:	53                   	push   %ebx
+  801398:	83 ec 10             	sub    $0x10,%esp
+  set_pgfault_handler(pgfault);
+  80139b:	68 d1 10 80 00       	push   $0x8010d1
+  8013a0:	e8 2e 23 00 00       	call   8036d3 <set_pgfault_handler>
+  if ((envid = sys_fork()) == 0)
+  8013a5:	e8 4a fa ff ff       	call   800df4 <sys_fork>
+  8013aa:	89 c3                	mov    %eax,%ebx
+  8013ac:	83 c4 10             	add    $0x10,%esp
+  8013af:	85 c0                	test   %eax,%eax
+  8013b1:	74 07                	je     8013ba <kfork+0x26>
+}
+  8013b3:	89 d8                	mov    %ebx,%eax
+  8013b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013b8:	c9                   	leave
+  8013b9:	c3                   	ret
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8013ba:	e8 e2 f7 ff ff       	call   800ba1 <sys_getenvid>
+  8013bf:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8013c4:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8013c7:	c1 e0 04             	shl    $0x4,%eax
+  8013ca:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8013cf:	a3 a4 58 80 00       	mov    %eax,0x8058a4
+  return envid;
+  8013d4:	eb dd                	jmp    8013b3 <kfork+0x1f>
+
+008013d6 <sfork>:
+
+int
+sfork(void)
+{
+  8013d6:	55                   	push   %ebp
+  8013d7:	89 e5                	mov    %esp,%ebp
+  8013d9:	53                   	push   %ebx
+  8013da:	83 ec 04             	sub    $0x4,%esp
+  envid_t envid, parent_id;
+  int error;
+
+  parent_id = sys_getenvid();
+  8013dd:	e8 bf f7 ff ff       	call   800ba1 <sys_getenvid>
+
+  // set up page fault handler
+  set_pgfault_handler(shared_pgfault);
+  8013e2:	83 ec 0c             	sub    $0xc,%esp
+  8013e5:	68 ce 11 80 00       	push   $0x8011ce
+  8013ea:	e8 e4 22 00 00       	call   8036d3 <set_pgfault_handler>
+  8013ef:	b8 07 00 00 00       	mov    $0x7,%eax
+  8013f4:	cd 30                	int    $0x30
+  8013f6:	89 c3                	mov    %eax,%ebx
+
+  // create a child with sys_exofork
+  envid = sys_exofork();
+  
+  if (envid < 0) {
+  8013f8:	83 c4 10             	add    $0x10,%esp
+  8013fb:	85 c0                	test   %eax,%eax
+  8013fd:	78 09                	js     801408 <sfork+0x32>
+    panic("sys_exofork: %e", envid);
+  } else if (envid == 0) {
+  8013ff:	75 1c                	jne    80141d <sfork+0x47>
+  if ( (error = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+    panic("sys_env_set_status: %e", error);
+  }
+
+  return envid;
+}
+  801401:	89 d8                	mov    %ebx,%eax
+  801403:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801406:	c9                   	leave
+  801407:	c3                   	ret
+    panic("sys_exofork: %e", envid);
+  801408:	50                   	push   %eax
+  801409:	68 dc 3d 80 00       	push   $0x803ddc
+  80140e:	68 c3 00 00 00       	push   $0xc3
+  801413:	68 7f 3d 80 00       	push   $0x803d7f
+  801418:	e8 70 22 00 00       	call   80368d <_panic>
+  if ( (error = sys_page_map_range(0, 0, USTACKTOP - PGSIZE,
+  80141d:	83 ec 0c             	sub    $0xc,%esp
+  801420:	6a 00                	push   $0x0
+  801422:	50                   	push   %eax
+  801423:	68 00 d0 bf ee       	push   $0xeebfd000
+  801428:	6a 00                	push   $0x0
+  80142a:	6a 00                	push   $0x0
+  80142c:	e8 b8 f8 ff ff       	call   800ce9 <sys_page_map_range>
+  801431:	83 c4 20             	add    $0x20,%esp
+  801434:	85 c0                	test   %eax,%eax
+  801436:	78 79                	js     8014b1 <sfork+0xdb>
+  if ( (error = sys_page_map_range(0, (void *) (USTACKTOP - PGSIZE), PGSIZE,
+  801438:	83 ec 0c             	sub    $0xc,%esp
+  80143b:	6a 01                	push   $0x1
+  80143d:	53                   	push   %ebx
+  80143e:	68 00 10 00 00       	push   $0x1000
+  801443:	68 00 d0 bf ee       	push   $0xeebfd000
+  801448:	6a 00                	push   $0x0
+  80144a:	e8 9a f8 ff ff       	call   800ce9 <sys_page_map_range>
+  80144f:	83 c4 20             	add    $0x20,%esp
+  801452:	85 c0                	test   %eax,%eax
+  801454:	78 70                	js     8014c6 <sfork+0xf0>
+  if ( (error = sys_page_alloc(envid,
+  801456:	83 ec 04             	sub    $0x4,%esp
+  801459:	6a 07                	push   $0x7
+  80145b:	68 00 f0 bf ee       	push   $0xeebff000
+  801460:	53                   	push   %ebx
+  801461:	e8 bc f7 ff ff       	call   800c22 <sys_page_alloc>
+  801466:	83 c4 10             	add    $0x10,%esp
+  801469:	85 c0                	test   %eax,%eax
+  80146b:	78 6e                	js     8014db <sfork+0x105>
+          thisenv->env_pgfault_upcall)) < 0) {
+  80146d:	a1 a4 58 80 00       	mov    0x8058a4,%eax
+  801472:	8b 40 64             	mov    0x64(%eax),%eax
+  if ( (error = sys_env_set_pgfault_upcall(envid,
+  801475:	83 ec 08             	sub    $0x8,%esp
+  801478:	50                   	push   %eax
+  801479:	53                   	push   %ebx
+  80147a:	e8 18 fa ff ff       	call   800e97 <sys_env_set_pgfault_upcall>
+  80147f:	83 c4 10             	add    $0x10,%esp
+  801482:	85 c0                	test   %eax,%eax
+  801484:	78 6a                	js     8014f0 <sfork+0x11a>
+  if ( (error = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+  801486:	83 ec 08             	sub    $0x8,%esp
+  801489:	6a 02                	push   $0x2
+  80148b:	53                   	push   %ebx
+  80148c:	e8 82 f9 ff ff       	call   800e13 <sys_env_set_status>
+  801491:	83 c4 10             	add    $0x10,%esp
+  801494:	85 c0                	test   %eax,%eax
+  801496:	0f 89 65 ff ff ff    	jns    801401 <sfork+0x2b>
+    panic("sys_env_set_status: %e", error);
+  80149c:	50                   	push   %eax
+  80149d:	68 03 3e 80 00       	push   $0x803e03
+  8014a2:	68 e4 00 00 00       	push   $0xe4
+  8014a7:	68 7f 3d 80 00       	push   $0x803d7f
+  8014ac:	e8 dc 21 00 00       	call   80368d <_panic>
+    panic("sys_page_map_range: %e", error);
+  8014b1:	50                   	push   %eax
+  8014b2:	68 ec 3d 80 00       	push   $0x803dec
+  8014b7:	68 ce 00 00 00       	push   $0xce
+  8014bc:	68 7f 3d 80 00       	push   $0x803d7f
+  8014c1:	e8 c7 21 00 00       	call   80368d <_panic>
+    panic("sys_page_map_range: %e", error);
+  8014c6:	50                   	push   %eax
+  8014c7:	68 ec 3d 80 00       	push   $0x803dec
+  8014cc:	68 d3 00 00 00       	push   $0xd3
+  8014d1:	68 7f 3d 80 00       	push   $0x803d7f
+  8014d6:	e8 b2 21 00 00       	call   80368d <_panic>
+    panic("sys_page_alloc: %e", error);
+  8014db:	50                   	push   %eax
+  8014dc:	68 a5 3d 80 00       	push   $0x803da5
+  8014e1:	68 da 00 00 00       	push   $0xda
+  8014e6:	68 7f 3d 80 00       	push   $0x803d7f
+  8014eb:	e8 9d 21 00 00       	call   80368d <_panic>
+    panic("sys_env_set_pgfault_upcall: %e", error);
+  8014f0:	50                   	push   %eax
+  8014f1:	68 1c 3e 80 00       	push   $0x803e1c
+  8014f6:	68 e0 00 00 00       	push   $0xe0
+  8014fb:	68 7f 3d 80 00       	push   $0x803d7f
+  801500:	e8 88 21 00 00       	call   80368d <_panic>
+
+00801505 <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  801505:	55                   	push   %ebp
+  801506:	89 e5                	mov    %esp,%ebp
+  801508:	57                   	push   %edi
+  801509:	56                   	push   %esi
+  80150a:	53                   	push   %ebx
+  80150b:	83 ec 14             	sub    $0x14,%esp
+  80150e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801511:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801514:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801517:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  80151a:	85 c0                	test   %eax,%eax
+  80151c:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801521:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  801524:	ff 33                	push   (%ebx)
+  801526:	50                   	push   %eax
+  801527:	e8 ce f9 ff ff       	call   800efa <sys_ipc_recv>
+  80152c:	83 c4 10             	add    $0x10,%esp
+  80152f:	85 c0                	test   %eax,%eax
+  801531:	78 39                	js     80156c <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  801533:	85 ff                	test   %edi,%edi
+  801535:	74 0a                	je     801541 <ipc_recv_pages+0x3c>
+  801537:	a1 a4 58 80 00       	mov    0x8058a4,%eax
+  80153c:	8b 40 7c             	mov    0x7c(%eax),%eax
+  80153f:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  801541:	85 f6                	test   %esi,%esi
+  801543:	74 0d                	je     801552 <ipc_recv_pages+0x4d>
+  801545:	a1 a4 58 80 00       	mov    0x8058a4,%eax
+  80154a:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  801550:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  801552:	a1 a4 58 80 00       	mov    0x8058a4,%eax
+  801557:	8b 40 74             	mov    0x74(%eax),%eax
+  80155a:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  80155c:	a1 a4 58 80 00       	mov    0x8058a4,%eax
+  801561:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  801564:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801567:	5b                   	pop    %ebx
+  801568:	5e                   	pop    %esi
+  801569:	5f                   	pop    %edi
+  80156a:	5d                   	pop    %ebp
+  80156b:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  80156c:	85 ff                	test   %edi,%edi
+  80156e:	74 06                	je     801576 <ipc_recv_pages+0x71>
+  801570:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  801576:	85 f6                	test   %esi,%esi
+  801578:	74 06                	je     801580 <ipc_recv_pages+0x7b>
+  80157a:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  801580:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  801586:	eb dc                	jmp    801564 <ipc_recv_pages+0x5f>
+
+00801588 <ipc_recv>:
+{
+  801588:	55                   	push   %ebp
+  801589:	89 e5                	mov    %esp,%ebp
+  80158b:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  80158e:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  801595:	ff 75 10             	push   0x10(%ebp)
+  801598:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80159b:	50                   	push   %eax
+  80159c:	ff 75 0c             	push   0xc(%ebp)
+  80159f:	ff 75 08             	push   0x8(%ebp)
+  8015a2:	e8 5e ff ff ff       	call   801505 <ipc_recv_pages>
+}
+  8015a7:	c9                   	leave
+  8015a8:	c3                   	ret
+
+008015a9 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  8015a9:	55                   	push   %ebp
+  8015aa:	89 e5                	mov    %esp,%ebp
+  8015ac:	57                   	push   %edi
+  8015ad:	56                   	push   %esi
+  8015ae:	53                   	push   %ebx
+  8015af:	83 ec 0c             	sub    $0xc,%esp
+  8015b2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8015b5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8015b8:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  8015bb:	89 c3                	mov    %eax,%ebx
+  8015bd:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  8015c3:	85 c0                	test   %eax,%eax
+  8015c5:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8015ca:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  8015cd:	83 ec 0c             	sub    $0xc,%esp
+  8015d0:	ff 75 14             	push   0x14(%ebp)
+  8015d3:	ff 75 18             	push   0x18(%ebp)
+  8015d6:	53                   	push   %ebx
+  8015d7:	56                   	push   %esi
+  8015d8:	57                   	push   %edi
+  8015d9:	e8 fb f8 ff ff       	call   800ed9 <sys_ipc_try_send>
+  8015de:	83 c4 20             	add    $0x20,%esp
+  8015e1:	85 c0                	test   %eax,%eax
+  8015e3:	79 1e                	jns    801603 <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  8015e5:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8015e8:	75 07                	jne    8015f1 <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  8015ea:	e8 d1 f5 ff ff       	call   800bc0 <sys_yield>
+  8015ef:	eb dc                	jmp    8015cd <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  8015f1:	50                   	push   %eax
+  8015f2:	68 3b 3e 80 00       	push   $0x803e3b
+  8015f7:	6a 5c                	push   $0x5c
+  8015f9:	68 48 3e 80 00       	push   $0x803e48
+  8015fe:	e8 8a 20 00 00       	call   80368d <_panic>
+  }
+}
+  801603:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801606:	5b                   	pop    %ebx
+  801607:	5e                   	pop    %esi
+  801608:	5f                   	pop    %edi
+  801609:	5d                   	pop    %ebp
+  80160a:	c3                   	ret
+
+0080160b <ipc_send>:
+{
+  80160b:	55                   	push   %ebp
+  80160c:	89 e5                	mov    %esp,%ebp
+  80160e:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  801611:	ff 75 14             	push   0x14(%ebp)
+  801614:	6a 01                	push   $0x1
+  801616:	ff 75 10             	push   0x10(%ebp)
+  801619:	ff 75 0c             	push   0xc(%ebp)
+  80161c:	ff 75 08             	push   0x8(%ebp)
+  80161f:	e8 85 ff ff ff       	call   8015a9 <ipc_send_pages>
+}
+  801624:	83 c4 20             	add    $0x20,%esp
+  801627:	c9                   	leave
+  801628:	c3                   	ret
+
+00801629 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  801629:	55                   	push   %ebp
+  80162a:	89 e5                	mov    %esp,%ebp
+  80162c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  80162f:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  801634:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  801637:	c1 e0 04             	shl    $0x4,%eax
+  80163a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80163f:	8b 40 50             	mov    0x50(%eax),%eax
+  801642:	39 c8                	cmp    %ecx,%eax
+  801644:	74 12                	je     801658 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  801646:	83 c2 01             	add    $0x1,%edx
+  801649:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  80164f:	75 e3                	jne    801634 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  801651:	b8 00 00 00 00       	mov    $0x0,%eax
+  801656:	eb 0e                	jmp    801666 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  801658:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80165b:	c1 e0 04             	shl    $0x4,%eax
+  80165e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801663:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  801666:	5d                   	pop    %ebp
+  801667:	c3                   	ret
+
+00801668 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801668:	55                   	push   %ebp
+  801669:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80166b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80166e:	05 00 00 00 30       	add    $0x30000000,%eax
+  801673:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801676:	5d                   	pop    %ebp
+  801677:	c3                   	ret
+
+00801678 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801678:	55                   	push   %ebp
+  801679:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80167b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80167e:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  801681:	66 b8 00 00          	mov    $0x0,%ax
+  801685:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80168a:	5d                   	pop    %ebp
+  80168b:	c3                   	ret
+
+0080168c <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80168c:	55                   	push   %ebp
+  80168d:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  80168f:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801694:	eb 02                	jmp    801698 <fd_alloc+0xc>
+  801696:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801698:	89 c2                	mov    %eax,%edx
+  80169a:	c1 ea 16             	shr    $0x16,%edx
+  80169d:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8016a4:	f6 c2 01             	test   $0x1,%dl
+  8016a7:	74 2b                	je     8016d4 <fd_alloc+0x48>
+  8016a9:	89 c2                	mov    %eax,%edx
+  8016ab:	c1 ea 0c             	shr    $0xc,%edx
+  8016ae:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8016b5:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8016bb:	f6 c1 01             	test   $0x1,%cl
+  8016be:	74 14                	je     8016d4 <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  8016c0:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8016c6:	75 ce                	jne    801696 <fd_alloc+0xa>
+  8016c8:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  8016cd:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8016d2:	eb 05                	jmp    8016d9 <fd_alloc+0x4d>
+      return 0;
+  8016d4:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  8016d9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016dc:	89 02                	mov    %eax,(%edx)
+}
+  8016de:	89 c8                	mov    %ecx,%eax
+  8016e0:	5d                   	pop    %ebp
+  8016e1:	c3                   	ret
+
+008016e2 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8016e2:	55                   	push   %ebp
+  8016e3:	89 e5                	mov    %esp,%ebp
+  8016e5:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  8016e8:	83 f8 1f             	cmp    $0x1f,%eax
+  8016eb:	77 30                	ja     80171d <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  8016ed:	c1 e0 0c             	shl    $0xc,%eax
+  8016f0:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8016f5:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8016fb:	f6 c2 01             	test   $0x1,%dl
+  8016fe:	74 24                	je     801724 <fd_lookup+0x42>
+  801700:	89 c2                	mov    %eax,%edx
+  801702:	c1 ea 0c             	shr    $0xc,%edx
+  801705:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80170c:	f6 c2 01             	test   $0x1,%dl
+  80170f:	74 1a                	je     80172b <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  801711:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801714:	89 02                	mov    %eax,(%edx)
+  return 0;
+  801716:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80171b:	5d                   	pop    %ebp
+  80171c:	c3                   	ret
+    return -E_INVAL;
+  80171d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801722:	eb f7                	jmp    80171b <fd_lookup+0x39>
+    return -E_INVAL;
+  801724:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801729:	eb f0                	jmp    80171b <fd_lookup+0x39>
+  80172b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801730:	eb e9                	jmp    80171b <fd_lookup+0x39>
+
+00801732 <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801732:	55                   	push   %ebp
+  801733:	89 e5                	mov    %esp,%ebp
+  801735:	53                   	push   %ebx
+  801736:	83 ec 04             	sub    $0x4,%esp
+  801739:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  80173c:	b8 d0 3e 80 00       	mov    $0x803ed0,%eax
+  801741:	8b 18                	mov    (%eax),%ebx
+  801743:	85 db                	test   %ebx,%ebx
+  801745:	74 0e                	je     801755 <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  801747:	83 c0 04             	add    $0x4,%eax
+  80174a:	39 13                	cmp    %edx,(%ebx)
+  80174c:	75 f3                	jne    801741 <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  80174e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801753:	eb 1f                	jmp    801774 <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801755:	a1 a4 58 80 00       	mov    0x8058a4,%eax
+  80175a:	8b 40 48             	mov    0x48(%eax),%eax
+  80175d:	83 ec 04             	sub    $0x4,%esp
+  801760:	52                   	push   %edx
+  801761:	50                   	push   %eax
+  801762:	68 54 3e 80 00       	push   $0x803e54
+  801767:	e8 99 ea ff ff       	call   800205 <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  80176c:	83 c4 10             	add    $0x10,%esp
+  80176f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  801774:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801777:	89 1a                	mov    %ebx,(%edx)
+}
+  801779:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80177c:	c9                   	leave
+  80177d:	c3                   	ret
+
+0080177e <fd_close>:
+{
+  80177e:	55                   	push   %ebp
+  80177f:	89 e5                	mov    %esp,%ebp
+  801781:	57                   	push   %edi
+  801782:	56                   	push   %esi
+  801783:	53                   	push   %ebx
+  801784:	83 ec 24             	sub    $0x24,%esp
+  801787:	8b 75 08             	mov    0x8(%ebp),%esi
+  80178a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80178d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801790:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801791:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801797:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80179a:	50                   	push   %eax
+  80179b:	e8 42 ff ff ff       	call   8016e2 <fd_lookup>
+  8017a0:	89 c3                	mov    %eax,%ebx
+  8017a2:	83 c4 10             	add    $0x10,%esp
+  8017a5:	85 c0                	test   %eax,%eax
+  8017a7:	78 05                	js     8017ae <fd_close+0x30>
+      || fd != fd2)
+  8017a9:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8017ac:	74 16                	je     8017c4 <fd_close+0x46>
+    return must_exist ? r : 0;
+  8017ae:	89 f8                	mov    %edi,%eax
+  8017b0:	84 c0                	test   %al,%al
+  8017b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017b7:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8017ba:	89 d8                	mov    %ebx,%eax
+  8017bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017bf:	5b                   	pop    %ebx
+  8017c0:	5e                   	pop    %esi
+  8017c1:	5f                   	pop    %edi
+  8017c2:	5d                   	pop    %ebp
+  8017c3:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8017c4:	83 ec 08             	sub    $0x8,%esp
+  8017c7:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8017ca:	50                   	push   %eax
+  8017cb:	ff 36                	push   (%esi)
+  8017cd:	e8 60 ff ff ff       	call   801732 <dev_lookup>
+  8017d2:	89 c3                	mov    %eax,%ebx
+  8017d4:	83 c4 10             	add    $0x10,%esp
+  8017d7:	85 c0                	test   %eax,%eax
+  8017d9:	78 1a                	js     8017f5 <fd_close+0x77>
+    if (dev->dev_close)
+  8017db:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8017de:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  8017e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  8017e6:	85 c0                	test   %eax,%eax
+  8017e8:	74 0b                	je     8017f5 <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  8017ea:	83 ec 0c             	sub    $0xc,%esp
+  8017ed:	56                   	push   %esi
+  8017ee:	ff d0                	call   *%eax
+  8017f0:	89 c3                	mov    %eax,%ebx
+  8017f2:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  8017f5:	83 ec 08             	sub    $0x8,%esp
+  8017f8:	56                   	push   %esi
+  8017f9:	6a 00                	push   $0x0
+  8017fb:	e8 a7 f4 ff ff       	call   800ca7 <sys_page_unmap>
+  return r;
+  801800:	83 c4 10             	add    $0x10,%esp
+  801803:	eb b5                	jmp    8017ba <fd_close+0x3c>
+
+00801805 <close>:
+
+int
+close(int fdnum)
+{
+  801805:	55                   	push   %ebp
+  801806:	89 e5                	mov    %esp,%ebp
+  801808:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80180b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80180e:	50                   	push   %eax
+  80180f:	ff 75 08             	push   0x8(%ebp)
+  801812:	e8 cb fe ff ff       	call   8016e2 <fd_lookup>
+  801817:	83 c4 10             	add    $0x10,%esp
+  80181a:	85 c0                	test   %eax,%eax
+  80181c:	79 02                	jns    801820 <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  80181e:	c9                   	leave
+  80181f:	c3                   	ret
+    return fd_close(fd, 1);
+  801820:	83 ec 08             	sub    $0x8,%esp
+  801823:	6a 01                	push   $0x1
+  801825:	ff 75 f4             	push   -0xc(%ebp)
+  801828:	e8 51 ff ff ff       	call   80177e <fd_close>
+  80182d:	83 c4 10             	add    $0x10,%esp
+  801830:	eb ec                	jmp    80181e <close+0x19>
+
+00801832 <close_all>:
+
+void
+close_all(void)
+{
+  801832:	55                   	push   %ebp
+  801833:	89 e5                	mov    %esp,%ebp
+  801835:	53                   	push   %ebx
+  801836:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  801839:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  80183e:	83 ec 0c             	sub    $0xc,%esp
+  801841:	53                   	push   %ebx
+  801842:	e8 be ff ff ff       	call   801805 <close>
+  for (i = 0; i < MAXFD; i++)
+  801847:	83 c3 01             	add    $0x1,%ebx
+  80184a:	83 c4 10             	add    $0x10,%esp
+  80184d:	83 fb 20             	cmp    $0x20,%ebx
+  801850:	75 ec                	jne    80183e <close_all+0xc>
+}
+  801852:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801855:	c9                   	leave
+  801856:	c3                   	ret
+
+00801857 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801857:	55                   	push   %ebp
+  801858:	89 e5                	mov    %esp,%ebp
+  80185a:	57                   	push   %edi
+  80185b:	56                   	push   %esi
+  80185c:	53                   	push   %ebx
+  80185d:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801860:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801863:	50                   	push   %eax
+  801864:	ff 75 08             	push   0x8(%ebp)
+  801867:	e8 76 fe ff ff       	call   8016e2 <fd_lookup>
+  80186c:	89 c6                	mov    %eax,%esi
+  80186e:	83 c4 10             	add    $0x10,%esp
+  801871:	85 c0                	test   %eax,%eax
+  801873:	0f 88 0a 01 00 00    	js     801983 <dup+0x12c>
+    return r;
+  close(newfdnum);
+  801879:	83 ec 0c             	sub    $0xc,%esp
+  80187c:	ff 75 0c             	push   0xc(%ebp)
+  80187f:	e8 81 ff ff ff       	call   801805 <close>
+
+  newfd = INDEX2FD(newfdnum);
+  801884:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801887:	c1 e0 0c             	shl    $0xc,%eax
+  80188a:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  801890:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  801893:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801896:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  801899:	89 04 24             	mov    %eax,(%esp)
+  80189c:	e8 d7 fd ff ff       	call   801678 <fd2data>
+  8018a1:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  8018a3:	89 3c 24             	mov    %edi,(%esp)
+  8018a6:	e8 cd fd ff ff       	call   801678 <fd2data>
+  8018ab:	83 c4 10             	add    $0x10,%esp
+  8018ae:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8018b1:	89 f3                	mov    %esi,%ebx
+  8018b3:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  8018b9:	89 c6                	mov    %eax,%esi
+  8018bb:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8018be:	89 cf                	mov    %ecx,%edi
+  8018c0:	eb 0c                	jmp    8018ce <dup+0x77>
+  8018c2:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8018c8:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8018ce:	39 fb                	cmp    %edi,%ebx
+  8018d0:	74 7b                	je     80194d <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  8018d2:	89 d8                	mov    %ebx,%eax
+  8018d4:	c1 e8 16             	shr    $0x16,%eax
+  8018d7:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8018de:	a8 01                	test   $0x1,%al
+  8018e0:	74 e0                	je     8018c2 <dup+0x6b>
+  8018e2:	89 d8                	mov    %ebx,%eax
+  8018e4:	c1 e8 0c             	shr    $0xc,%eax
+  8018e7:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8018ee:	f6 c2 01             	test   $0x1,%dl
+  8018f1:	74 cf                	je     8018c2 <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  8018f3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  8018fa:	83 ec 0c             	sub    $0xc,%esp
+  8018fd:	25 07 0e 00 00       	and    $0xe07,%eax
+  801902:	50                   	push   %eax
+  801903:	56                   	push   %esi
+  801904:	6a 00                	push   $0x0
+  801906:	53                   	push   %ebx
+  801907:	6a 00                	push   $0x0
+  801909:	e8 57 f3 ff ff       	call   800c65 <sys_page_map>
+  80190e:	83 c4 20             	add    $0x20,%esp
+  801911:	85 c0                	test   %eax,%eax
+  801913:	79 ad                	jns    8018c2 <dup+0x6b>
+  801915:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801918:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  80191a:	83 ec 08             	sub    $0x8,%esp
+  80191d:	ff 75 d4             	push   -0x2c(%ebp)
+  801920:	6a 00                	push   $0x0
+  801922:	e8 80 f3 ff ff       	call   800ca7 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801927:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  80192a:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  801930:	83 c4 10             	add    $0x10,%esp
+  801933:	39 df                	cmp    %ebx,%edi
+  801935:	74 4c                	je     801983 <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  801937:	83 ec 08             	sub    $0x8,%esp
+  80193a:	57                   	push   %edi
+  80193b:	6a 00                	push   $0x0
+  80193d:	e8 65 f3 ff ff       	call   800ca7 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801942:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  801948:	83 c4 10             	add    $0x10,%esp
+  80194b:	eb e6                	jmp    801933 <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80194d:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801950:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  801953:	89 c8                	mov    %ecx,%eax
+  801955:	c1 e8 0c             	shr    $0xc,%eax
+  801958:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80195f:	83 ec 0c             	sub    $0xc,%esp
+  801962:	25 07 0e 00 00       	and    $0xe07,%eax
+  801967:	50                   	push   %eax
+  801968:	ff 75 d4             	push   -0x2c(%ebp)
+  80196b:	6a 00                	push   $0x0
+  80196d:	51                   	push   %ecx
+  80196e:	6a 00                	push   $0x0
+  801970:	e8 f0 f2 ff ff       	call   800c65 <sys_page_map>
+  801975:	89 c6                	mov    %eax,%esi
+  801977:	83 c4 20             	add    $0x20,%esp
+  80197a:	85 c0                	test   %eax,%eax
+  80197c:	78 9c                	js     80191a <dup+0xc3>
+  return newfdnum;
+  80197e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801981:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  801983:	89 f0                	mov    %esi,%eax
+  801985:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801988:	5b                   	pop    %ebx
+  801989:	5e                   	pop    %esi
+  80198a:	5f                   	pop    %edi
+  80198b:	5d                   	pop    %ebp
+  80198c:	c3                   	ret
+
+0080198d <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80198d:	55                   	push   %ebp
+  80198e:	89 e5                	mov    %esp,%ebp
+  801990:	56                   	push   %esi
+  801991:	53                   	push   %ebx
+  801992:	83 ec 18             	sub    $0x18,%esp
+  801995:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801998:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80199b:	50                   	push   %eax
+  80199c:	56                   	push   %esi
+  80199d:	e8 40 fd ff ff       	call   8016e2 <fd_lookup>
+  8019a2:	83 c4 10             	add    $0x10,%esp
+  8019a5:	85 c0                	test   %eax,%eax
+  8019a7:	78 3c                	js     8019e5 <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8019a9:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8019ac:	83 ec 08             	sub    $0x8,%esp
+  8019af:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019b2:	50                   	push   %eax
+  8019b3:	ff 33                	push   (%ebx)
+  8019b5:	e8 78 fd ff ff       	call   801732 <dev_lookup>
+  8019ba:	83 c4 10             	add    $0x10,%esp
+  8019bd:	85 c0                	test   %eax,%eax
+  8019bf:	78 24                	js     8019e5 <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8019c1:	8b 43 08             	mov    0x8(%ebx),%eax
+  8019c4:	83 e0 03             	and    $0x3,%eax
+  8019c7:	83 f8 01             	cmp    $0x1,%eax
+  8019ca:	74 20                	je     8019ec <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  8019cc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019cf:	8b 40 08             	mov    0x8(%eax),%eax
+  8019d2:	85 c0                	test   %eax,%eax
+  8019d4:	74 37                	je     801a0d <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  8019d6:	83 ec 04             	sub    $0x4,%esp
+  8019d9:	ff 75 10             	push   0x10(%ebp)
+  8019dc:	ff 75 0c             	push   0xc(%ebp)
+  8019df:	53                   	push   %ebx
+  8019e0:	ff d0                	call   *%eax
+  8019e2:	83 c4 10             	add    $0x10,%esp
+}
+  8019e5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019e8:	5b                   	pop    %ebx
+  8019e9:	5e                   	pop    %esi
+  8019ea:	5d                   	pop    %ebp
+  8019eb:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8019ec:	a1 a4 58 80 00       	mov    0x8058a4,%eax
+  8019f1:	8b 40 48             	mov    0x48(%eax),%eax
+  8019f4:	83 ec 04             	sub    $0x4,%esp
+  8019f7:	56                   	push   %esi
+  8019f8:	50                   	push   %eax
+  8019f9:	68 95 3e 80 00       	push   $0x803e95
+  8019fe:	e8 02 e8 ff ff       	call   800205 <cprintf>
+    return -E_INVAL;
+  801a03:	83 c4 10             	add    $0x10,%esp
+  801a06:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a0b:	eb d8                	jmp    8019e5 <read+0x58>
+    return -E_NOT_SUPP;
+  801a0d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a12:	eb d1                	jmp    8019e5 <read+0x58>
+
+00801a14 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801a14:	55                   	push   %ebp
+  801a15:	89 e5                	mov    %esp,%ebp
+  801a17:	57                   	push   %edi
+  801a18:	56                   	push   %esi
+  801a19:	53                   	push   %ebx
+  801a1a:	83 ec 0c             	sub    $0xc,%esp
+  801a1d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801a20:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  801a23:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a28:	eb 02                	jmp    801a2c <readn+0x18>
+  801a2a:	01 c3                	add    %eax,%ebx
+  801a2c:	39 f3                	cmp    %esi,%ebx
+  801a2e:	73 21                	jae    801a51 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  801a30:	83 ec 04             	sub    $0x4,%esp
+  801a33:	89 f0                	mov    %esi,%eax
+  801a35:	29 d8                	sub    %ebx,%eax
+  801a37:	50                   	push   %eax
+  801a38:	89 d8                	mov    %ebx,%eax
+  801a3a:	03 45 0c             	add    0xc(%ebp),%eax
+  801a3d:	50                   	push   %eax
+  801a3e:	57                   	push   %edi
+  801a3f:	e8 49 ff ff ff       	call   80198d <read>
+    if (m < 0)
+  801a44:	83 c4 10             	add    $0x10,%esp
+  801a47:	85 c0                	test   %eax,%eax
+  801a49:	78 04                	js     801a4f <readn+0x3b>
+      return m;
+    if (m == 0)
+  801a4b:	75 dd                	jne    801a2a <readn+0x16>
+  801a4d:	eb 02                	jmp    801a51 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  801a4f:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  801a51:	89 d8                	mov    %ebx,%eax
+  801a53:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a56:	5b                   	pop    %ebx
+  801a57:	5e                   	pop    %esi
+  801a58:	5f                   	pop    %edi
+  801a59:	5d                   	pop    %ebp
+  801a5a:	c3                   	ret
+
+00801a5b <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801a5b:	55                   	push   %ebp
+  801a5c:	89 e5                	mov    %esp,%ebp
+  801a5e:	56                   	push   %esi
+  801a5f:	53                   	push   %ebx
+  801a60:	83 ec 18             	sub    $0x18,%esp
+  801a63:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a66:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a69:	50                   	push   %eax
+  801a6a:	53                   	push   %ebx
+  801a6b:	e8 72 fc ff ff       	call   8016e2 <fd_lookup>
+  801a70:	83 c4 10             	add    $0x10,%esp
+  801a73:	85 c0                	test   %eax,%eax
+  801a75:	78 37                	js     801aae <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801a77:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801a7a:	83 ec 08             	sub    $0x8,%esp
+  801a7d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a80:	50                   	push   %eax
+  801a81:	ff 36                	push   (%esi)
+  801a83:	e8 aa fc ff ff       	call   801732 <dev_lookup>
+  801a88:	83 c4 10             	add    $0x10,%esp
+  801a8b:	85 c0                	test   %eax,%eax
+  801a8d:	78 1f                	js     801aae <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801a8f:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801a93:	74 20                	je     801ab5 <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  801a95:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a98:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a9b:	85 c0                	test   %eax,%eax
+  801a9d:	74 37                	je     801ad6 <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  801a9f:	83 ec 04             	sub    $0x4,%esp
+  801aa2:	ff 75 10             	push   0x10(%ebp)
+  801aa5:	ff 75 0c             	push   0xc(%ebp)
+  801aa8:	56                   	push   %esi
+  801aa9:	ff d0                	call   *%eax
+  801aab:	83 c4 10             	add    $0x10,%esp
+}
+  801aae:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ab1:	5b                   	pop    %ebx
+  801ab2:	5e                   	pop    %esi
+  801ab3:	5d                   	pop    %ebp
+  801ab4:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801ab5:	a1 a4 58 80 00       	mov    0x8058a4,%eax
+  801aba:	8b 40 48             	mov    0x48(%eax),%eax
+  801abd:	83 ec 04             	sub    $0x4,%esp
+  801ac0:	53                   	push   %ebx
+  801ac1:	50                   	push   %eax
+  801ac2:	68 b1 3e 80 00       	push   $0x803eb1
+  801ac7:	e8 39 e7 ff ff       	call   800205 <cprintf>
+    return -E_INVAL;
+  801acc:	83 c4 10             	add    $0x10,%esp
+  801acf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ad4:	eb d8                	jmp    801aae <write+0x53>
+    return -E_NOT_SUPP;
+  801ad6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801adb:	eb d1                	jmp    801aae <write+0x53>
+
+00801add <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801add:	55                   	push   %ebp
+  801ade:	89 e5                	mov    %esp,%ebp
+  801ae0:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801ae3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ae6:	50                   	push   %eax
+  801ae7:	ff 75 08             	push   0x8(%ebp)
+  801aea:	e8 f3 fb ff ff       	call   8016e2 <fd_lookup>
+  801aef:	83 c4 10             	add    $0x10,%esp
+  801af2:	85 c0                	test   %eax,%eax
+  801af4:	78 0e                	js     801b04 <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  801af6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801af9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801afc:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  801aff:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b04:	c9                   	leave
+  801b05:	c3                   	ret
+
+00801b06 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801b06:	55                   	push   %ebp
+  801b07:	89 e5                	mov    %esp,%ebp
+  801b09:	56                   	push   %esi
+  801b0a:	53                   	push   %ebx
+  801b0b:	83 ec 18             	sub    $0x18,%esp
+  801b0e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801b11:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b14:	50                   	push   %eax
+  801b15:	53                   	push   %ebx
+  801b16:	e8 c7 fb ff ff       	call   8016e2 <fd_lookup>
+  801b1b:	83 c4 10             	add    $0x10,%esp
+  801b1e:	85 c0                	test   %eax,%eax
+  801b20:	78 34                	js     801b56 <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801b22:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b25:	83 ec 08             	sub    $0x8,%esp
+  801b28:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b2b:	50                   	push   %eax
+  801b2c:	ff 36                	push   (%esi)
+  801b2e:	e8 ff fb ff ff       	call   801732 <dev_lookup>
+  801b33:	83 c4 10             	add    $0x10,%esp
+  801b36:	85 c0                	test   %eax,%eax
+  801b38:	78 1c                	js     801b56 <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801b3a:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801b3e:	74 1d                	je     801b5d <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  801b40:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b43:	8b 40 18             	mov    0x18(%eax),%eax
+  801b46:	85 c0                	test   %eax,%eax
+  801b48:	74 34                	je     801b7e <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  801b4a:	83 ec 08             	sub    $0x8,%esp
+  801b4d:	ff 75 0c             	push   0xc(%ebp)
+  801b50:	56                   	push   %esi
+  801b51:	ff d0                	call   *%eax
+  801b53:	83 c4 10             	add    $0x10,%esp
+}
+  801b56:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b59:	5b                   	pop    %ebx
+  801b5a:	5e                   	pop    %esi
+  801b5b:	5d                   	pop    %ebp
+  801b5c:	c3                   	ret
+            thisenv->env_id, fdnum);
+  801b5d:	a1 a4 58 80 00       	mov    0x8058a4,%eax
+  801b62:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801b65:	83 ec 04             	sub    $0x4,%esp
+  801b68:	53                   	push   %ebx
+  801b69:	50                   	push   %eax
+  801b6a:	68 74 3e 80 00       	push   $0x803e74
+  801b6f:	e8 91 e6 ff ff       	call   800205 <cprintf>
+    return -E_INVAL;
+  801b74:	83 c4 10             	add    $0x10,%esp
+  801b77:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b7c:	eb d8                	jmp    801b56 <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  801b7e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b83:	eb d1                	jmp    801b56 <ftruncate+0x50>
+
+00801b85 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801b85:	55                   	push   %ebp
+  801b86:	89 e5                	mov    %esp,%ebp
+  801b88:	56                   	push   %esi
+  801b89:	53                   	push   %ebx
+  801b8a:	83 ec 18             	sub    $0x18,%esp
+  801b8d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801b90:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b93:	50                   	push   %eax
+  801b94:	ff 75 08             	push   0x8(%ebp)
+  801b97:	e8 46 fb ff ff       	call   8016e2 <fd_lookup>
+  801b9c:	83 c4 10             	add    $0x10,%esp
+  801b9f:	85 c0                	test   %eax,%eax
+  801ba1:	78 49                	js     801bec <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801ba3:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801ba6:	83 ec 08             	sub    $0x8,%esp
+  801ba9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bac:	50                   	push   %eax
+  801bad:	ff 36                	push   (%esi)
+  801baf:	e8 7e fb ff ff       	call   801732 <dev_lookup>
+  801bb4:	83 c4 10             	add    $0x10,%esp
+  801bb7:	85 c0                	test   %eax,%eax
+  801bb9:	78 31                	js     801bec <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  801bbb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bbe:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801bc2:	74 2f                	je     801bf3 <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  801bc4:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  801bc7:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801bce:	00 00 00 
+  stat->st_isdir = 0;
+  801bd1:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801bd8:	00 00 00 
+  stat->st_dev = dev;
+  801bdb:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  801be1:	83 ec 08             	sub    $0x8,%esp
+  801be4:	53                   	push   %ebx
+  801be5:	56                   	push   %esi
+  801be6:	ff 50 14             	call   *0x14(%eax)
+  801be9:	83 c4 10             	add    $0x10,%esp
+}
+  801bec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bef:	5b                   	pop    %ebx
+  801bf0:	5e                   	pop    %esi
+  801bf1:	5d                   	pop    %ebp
+  801bf2:	c3                   	ret
+    return -E_NOT_SUPP;
+  801bf3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801bf8:	eb f2                	jmp    801bec <fstat+0x67>
+
+00801bfa <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  801bfa:	55                   	push   %ebp
+  801bfb:	89 e5                	mov    %esp,%ebp
+  801bfd:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  801c00:	ff 75 0c             	push   0xc(%ebp)
+  801c03:	ff 75 08             	push   0x8(%ebp)
+  801c06:	e8 58 07 00 00       	call   802363 <file_stat>
+}
+  801c0b:	c9                   	leave
+  801c0c:	c3                   	ret
+
+00801c0d <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  801c0d:	55                   	push   %ebp
+  801c0e:	89 e5                	mov    %esp,%ebp
+  801c10:	57                   	push   %edi
+  801c11:	56                   	push   %esi
+  801c12:	53                   	push   %ebx
+  801c13:	83 ec 1c             	sub    $0x1c,%esp
+  801c16:	89 c7                	mov    %eax,%edi
+  801c18:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801c1b:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801c1e:	e9 a2 00 00 00       	jmp    801cc5 <fsipc_send+0xb8>
+  nfsenvs = 0;
+  801c23:	c7 05 00 50 80 00 00 	movl   $0x0,0x805000
+  801c2a:	00 00 00 
+  801c2d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c32:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801c37:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801c3c:	be 01 00 00 00       	mov    $0x1,%esi
+  801c41:	eb 0f                	jmp    801c52 <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801c43:	83 c0 01             	add    $0x1,%eax
+  801c46:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801c4b:	74 49                	je     801c96 <fsipc_send+0x89>
+  801c4d:	83 f9 07             	cmp    $0x7,%ecx
+  801c50:	7f 50                	jg     801ca2 <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  801c52:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801c55:	c1 e2 04             	shl    $0x4,%edx
+  801c58:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801c5e:	8b 52 50             	mov    0x50(%edx),%edx
+  801c61:	83 fa 01             	cmp    $0x1,%edx
+  801c64:	75 dd                	jne    801c43 <fsipc_send+0x36>
+  801c66:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801c69:	c1 e2 04             	shl    $0x4,%edx
+  801c6c:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801c72:	8b 52 54             	mov    0x54(%edx),%edx
+  801c75:	85 d2                	test   %edx,%edx
+  801c77:	74 ca                	je     801c43 <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801c79:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801c7c:	c1 e2 04             	shl    $0x4,%edx
+  801c7f:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801c85:	8b 52 48             	mov    0x48(%edx),%edx
+  801c88:	89 14 8d 20 50 80 00 	mov    %edx,0x805020(,%ecx,4)
+  801c8f:	8d 49 01             	lea    0x1(%ecx),%ecx
+  801c92:	89 f3                	mov    %esi,%ebx
+  801c94:	eb ad                	jmp    801c43 <fsipc_send+0x36>
+  801c96:	84 db                	test   %bl,%bl
+  801c98:	74 38                	je     801cd2 <fsipc_send+0xc5>
+  801c9a:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  801ca0:	eb 30                	jmp    801cd2 <fsipc_send+0xc5>
+  801ca2:	84 db                	test   %bl,%bl
+  801ca4:	74 2c                	je     801cd2 <fsipc_send+0xc5>
+  801ca6:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  801cac:	eb 24                	jmp    801cd2 <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  801cae:	50                   	push   %eax
+  801caf:	68 e0 3e 80 00       	push   $0x803ee0
+  801cb4:	6a 34                	push   $0x34
+  801cb6:	68 ea 3e 80 00       	push   $0x803eea
+  801cbb:	e8 cd 19 00 00       	call   80368d <_panic>
+    }
+    sys_yield();
+  801cc0:	e8 fb ee ff ff       	call   800bc0 <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  801cc5:	83 3d 00 50 80 00 03 	cmpl   $0x3,0x805000
+  801ccc:	0f 8e 51 ff ff ff    	jle    801c23 <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  801cd2:	a1 a4 58 80 00       	mov    0x8058a4,%eax
+  801cd7:	8b 70 48             	mov    0x48(%eax),%esi
+  801cda:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  801ce0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ce5:	8b 0d 00 50 80 00    	mov    0x805000,%ecx
+  801ceb:	39 d9                	cmp    %ebx,%ecx
+  801ced:	7e d1                	jle    801cc0 <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  801cef:	83 ec 0c             	sub    $0xc,%esp
+  801cf2:	ff 75 e0             	push   -0x20(%ebp)
+  801cf5:	6a 07                	push   $0x7
+  801cf7:	ff 75 e4             	push   -0x1c(%ebp)
+  801cfa:	57                   	push   %edi
+  801cfb:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  801cfe:	99                   	cltd
+  801cff:	f7 f9                	idiv   %ecx
+  801d01:	ff 34 95 20 50 80 00 	push   0x805020(,%edx,4)
+  801d08:	e8 cc f1 ff ff       	call   800ed9 <sys_ipc_try_send>
+      if (r == 0)
+  801d0d:	83 c4 20             	add    $0x20,%esp
+  801d10:	85 c0                	test   %eax,%eax
+  801d12:	74 0a                	je     801d1e <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  801d14:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801d17:	75 95                	jne    801cae <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  801d19:	83 c3 01             	add    $0x1,%ebx
+  801d1c:	eb c7                	jmp    801ce5 <fsipc_send+0xd8>
+  }
+}
+  801d1e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d21:	5b                   	pop    %ebx
+  801d22:	5e                   	pop    %esi
+  801d23:	5f                   	pop    %edi
+  801d24:	5d                   	pop    %ebp
+  801d25:	c3                   	ret
+
+00801d26 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801d26:	55                   	push   %ebp
+  801d27:	89 e5                	mov    %esp,%ebp
+  801d29:	53                   	push   %ebx
+  801d2a:	83 ec 14             	sub    $0x14,%esp
+  801d2d:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  801d2f:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  801d36:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801d3b:	ba 00 60 80 00       	mov    $0x806000,%edx
+  801d40:	e8 c8 fe ff ff       	call   801c0d <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801d45:	6a 00                	push   $0x0
+  801d47:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d4a:	50                   	push   %eax
+  801d4b:	53                   	push   %ebx
+  801d4c:	6a 00                	push   $0x0
+  801d4e:	e8 b2 f7 ff ff       	call   801505 <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  801d53:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d56:	c9                   	leave
+  801d57:	c3                   	ret
+
+00801d58 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801d58:	55                   	push   %ebp
+  801d59:	89 e5                	mov    %esp,%ebp
+  801d5b:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801d5e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d61:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d64:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.set_size.req_size = newsize;
+  801d69:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d6c:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801d71:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d76:	b8 02 00 00 00       	mov    $0x2,%eax
+  801d7b:	e8 a6 ff ff ff       	call   801d26 <fsipc>
+}
+  801d80:	c9                   	leave
+  801d81:	c3                   	ret
+
+00801d82 <devfile_flush>:
+{
+  801d82:	55                   	push   %ebp
+  801d83:	89 e5                	mov    %esp,%ebp
+  801d85:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801d88:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d8b:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d8e:	a3 00 60 80 00       	mov    %eax,0x806000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801d93:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d98:	b8 06 00 00 00       	mov    $0x6,%eax
+  801d9d:	e8 84 ff ff ff       	call   801d26 <fsipc>
+}
+  801da2:	c9                   	leave
+  801da3:	c3                   	ret
+
+00801da4 <devfile_stat>:
+{
+  801da4:	55                   	push   %ebp
+  801da5:	89 e5                	mov    %esp,%ebp
+  801da7:	53                   	push   %ebx
+  801da8:	83 ec 04             	sub    $0x4,%esp
+  801dab:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801dae:	8b 45 08             	mov    0x8(%ebp),%eax
+  801db1:	8b 40 0c             	mov    0xc(%eax),%eax
+  801db4:	a3 00 60 80 00       	mov    %eax,0x806000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801db9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dbe:	b8 05 00 00 00       	mov    $0x5,%eax
+  801dc3:	e8 5e ff ff ff       	call   801d26 <fsipc>
+  801dc8:	85 c0                	test   %eax,%eax
+  801dca:	78 2c                	js     801df8 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801dcc:	83 ec 08             	sub    $0x8,%esp
+  801dcf:	68 00 60 80 00       	push   $0x806000
+  801dd4:	53                   	push   %ebx
+  801dd5:	e8 19 ea ff ff       	call   8007f3 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  801dda:	a1 80 60 80 00       	mov    0x806080,%eax
+  801ddf:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801de5:	a1 84 60 80 00       	mov    0x806084,%eax
+  801dea:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801df0:	83 c4 10             	add    $0x10,%esp
+  801df3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801df8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801dfb:	c9                   	leave
+  801dfc:	c3                   	ret
+
+00801dfd <fsv_alloc>:
+{
+  801dfd:	55                   	push   %ebp
+  801dfe:	89 e5                	mov    %esp,%ebp
+  801e00:	56                   	push   %esi
+  801e01:	53                   	push   %ebx
+  801e02:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  801e04:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e09:	eb 22                	jmp    801e2d <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  801e0b:	83 ec 04             	sub    $0x4,%esp
+  801e0e:	6a 00                	push   $0x0
+  801e10:	6a 00                	push   $0x0
+  801e12:	6a 07                	push   $0x7
+  801e14:	50                   	push   %eax
+  801e15:	6a 00                	push   $0x0
+  801e17:	6a 04                	push   $0x4
+  801e19:	68 40 50 80 00       	push   $0x805040
+  801e1e:	e8 52 f2 ff ff       	call   801075 <sysbatch_add>
+  801e23:	83 c4 20             	add    $0x20,%esp
+  801e26:	85 c0                	test   %eax,%eax
+  801e28:	78 48                	js     801e72 <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  801e2a:	83 c3 01             	add    $0x1,%ebx
+  801e2d:	39 f3                	cmp    %esi,%ebx
+  801e2f:	74 31                	je     801e62 <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  801e31:	89 d8                	mov    %ebx,%eax
+  801e33:	c1 e0 0c             	shl    $0xc,%eax
+  801e36:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801e3b:	89 c2                	mov    %eax,%edx
+  801e3d:	c1 ea 16             	shr    $0x16,%edx
+  801e40:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801e47:	f6 c2 01             	test   $0x1,%dl
+  801e4a:	74 bf                	je     801e0b <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  801e4c:	89 c2                	mov    %eax,%edx
+  801e4e:	c1 ea 0c             	shr    $0xc,%edx
+  801e51:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801e58:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801e5b:	83 fa 03             	cmp    $0x3,%edx
+  801e5e:	75 ab                	jne    801e0b <fsv_alloc+0xe>
+  801e60:	eb c8                	jmp    801e2a <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  801e62:	83 ec 0c             	sub    $0xc,%esp
+  801e65:	68 40 50 80 00       	push   $0x805040
+  801e6a:	e8 b6 f1 ff ff       	call   801025 <sysbatch_flush>
+  801e6f:	83 c4 10             	add    $0x10,%esp
+}
+  801e72:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e75:	5b                   	pop    %ebx
+  801e76:	5e                   	pop    %esi
+  801e77:	5d                   	pop    %ebp
+  801e78:	c3                   	ret
+
+00801e79 <devfile_read>:
+{
+  801e79:	55                   	push   %ebp
+  801e7a:	89 e5                	mov    %esp,%ebp
+  801e7c:	57                   	push   %edi
+  801e7d:	56                   	push   %esi
+  801e7e:	53                   	push   %ebx
+  801e7f:	83 ec 3c             	sub    $0x3c,%esp
+  801e82:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  801e85:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  801e8b:	77 57                	ja     801ee4 <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801e8d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e90:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e93:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read.req_n = n;
+  801e98:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801e9e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ea3:	b8 03 00 00 00       	mov    $0x3,%eax
+  801ea8:	e8 79 fe ff ff       	call   801d26 <fsipc>
+  801ead:	89 c6                	mov    %eax,%esi
+  801eaf:	85 c0                	test   %eax,%eax
+  801eb1:	78 27                	js     801eda <devfile_read+0x61>
+  assert(r <= n);
+  801eb3:	39 c3                	cmp    %eax,%ebx
+  801eb5:	0f 82 0e 02 00 00    	jb     8020c9 <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  801ebb:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801ec0:	0f 8f 1c 02 00 00    	jg     8020e2 <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801ec6:	83 ec 04             	sub    $0x4,%esp
+  801ec9:	50                   	push   %eax
+  801eca:	68 00 60 80 00       	push   $0x806000
+  801ecf:	ff 75 0c             	push   0xc(%ebp)
+  801ed2:	e8 a2 ea ff ff       	call   800979 <memmove>
+  return r;
+  801ed7:	83 c4 10             	add    $0x10,%esp
+}
+  801eda:	89 f0                	mov    %esi,%eax
+  801edc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801edf:	5b                   	pop    %ebx
+  801ee0:	5e                   	pop    %esi
+  801ee1:	5f                   	pop    %edi
+  801ee2:	5d                   	pop    %ebp
+  801ee3:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  801ee4:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ee9:	e8 0f ff ff ff       	call   801dfd <fsv_alloc>
+  801eee:	89 c6                	mov    %eax,%esi
+  801ef0:	85 c0                	test   %eax,%eax
+  801ef2:	78 e6                	js     801eda <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  801ef4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ef7:	8b 40 0c             	mov    0xc(%eax),%eax
+  801efa:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  801eff:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f02:	8b 40 04             	mov    0x4(%eax),%eax
+  801f05:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  801f0a:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  801f10:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801f17:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801f1c:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801f21:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801f26:	e8 e2 fc ff ff       	call   801c0d <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801f2b:	6a 00                	push   $0x0
+  801f2d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801f30:	50                   	push   %eax
+  801f31:	68 00 10 c0 9f       	push   $0x9fc01000
+  801f36:	6a 00                	push   $0x0
+  801f38:	e8 c8 f5 ff ff       	call   801505 <ipc_recv_pages>
+  801f3d:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  801f3f:	83 c4 10             	add    $0x10,%esp
+  801f42:	85 c0                	test   %eax,%eax
+  801f44:	7e 94                	jle    801eda <devfile_read+0x61>
+  assert(r <= n);
+  801f46:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801f49:	39 c3                	cmp    %eax,%ebx
+  801f4b:	72 2e                	jb     801f7b <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801f4d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f50:	8b 40 04             	mov    0x4(%eax),%eax
+  801f53:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801f58:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  801f5b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801f5e:	c1 e2 0c             	shl    $0xc,%edx
+  801f61:	39 ca                	cmp    %ecx,%edx
+  801f63:	72 2f                	jb     801f94 <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  801f65:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  801f6a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  801f6d:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  801f71:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801f76:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  801f79:	eb 52                	jmp    801fcd <devfile_read+0x154>
+  assert(r <= n);
+  801f7b:	68 f5 3e 80 00       	push   $0x803ef5
+  801f80:	68 fc 3e 80 00       	push   $0x803efc
+  801f85:	68 49 01 00 00       	push   $0x149
+  801f8a:	68 ea 3e 80 00       	push   $0x803eea
+  801f8f:	e8 f9 16 00 00       	call   80368d <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801f94:	68 20 3f 80 00       	push   $0x803f20
+  801f99:	68 fc 3e 80 00       	push   $0x803efc
+  801f9e:	68 4a 01 00 00       	push   $0x14a
+  801fa3:	68 ea 3e 80 00       	push   $0x803eea
+  801fa8:	e8 e0 16 00 00       	call   80368d <_panic>
+      memmove(dst + done, src + done, m);
+  801fad:	83 ec 04             	sub    $0x4,%esp
+  801fb0:	53                   	push   %ebx
+  801fb1:	56                   	push   %esi
+  801fb2:	89 f8                	mov    %edi,%eax
+  801fb4:	03 45 0c             	add    0xc(%ebp),%eax
+  801fb7:	50                   	push   %eax
+  801fb8:	e8 bc e9 ff ff       	call   800979 <memmove>
+  801fbd:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  801fc0:	01 df                	add    %ebx,%edi
+  801fc2:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801fc5:	39 c7                	cmp    %eax,%edi
+  801fc7:	0f 83 c0 00 00 00    	jae    80208d <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801fcd:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801fd0:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  801fd3:	89 f0                	mov    %esi,%eax
+  801fd5:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801fda:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  801fdf:	29 c3                	sub    %eax,%ebx
+  801fe1:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801fe4:	29 f8                	sub    %edi,%eax
+  801fe6:	39 c3                	cmp    %eax,%ebx
+  801fe8:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  801feb:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801ff1:	75 ba                	jne    801fad <devfile_read+0x134>
+  801ff3:	89 f9                	mov    %edi,%ecx
+  801ff5:	03 4d 0c             	add    0xc(%ebp),%ecx
+  801ff8:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  801ffb:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  802001:	75 aa                	jne    801fad <devfile_read+0x134>
+  802003:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  802009:	77 a2                	ja     801fad <devfile_read+0x134>
+  80200b:	89 c8                	mov    %ecx,%eax
+  80200d:	c1 e8 16             	shr    $0x16,%eax
+  802010:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802017:	a8 01                	test   $0x1,%al
+  802019:	74 92                	je     801fad <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  80201b:	89 c8                	mov    %ecx,%eax
+  80201d:	c1 e8 0c             	shr    $0xc,%eax
+  802020:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  802027:	a8 01                	test   $0x1,%al
+  802029:	74 82                	je     801fad <devfile_read+0x134>
+  80202b:	a9 02 08 00 00       	test   $0x802,%eax
+  802030:	0f 84 77 ff ff ff    	je     801fad <devfile_read+0x134>
+  802036:	f6 c4 04             	test   $0x4,%ah
+  802039:	0f 85 6e ff ff ff    	jne    801fad <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  80203f:	a1 a4 58 80 00       	mov    0x8058a4,%eax
+  802044:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  802048:	84 c0                	test   %al,%al
+  80204a:	75 17                	jne    802063 <devfile_read+0x1ea>
+  80204c:	83 ec 08             	sub    $0x8,%esp
+  80204f:	6a 01                	push   $0x1
+  802051:	6a 00                	push   $0x0
+  802053:	e8 87 eb ff ff       	call   800bdf <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  802058:	83 c4 10             	add    $0x10,%esp
+  80205b:	85 c0                	test   %eax,%eax
+  80205d:	0f 85 4a ff ff ff    	jne    801fad <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  802063:	83 ec 04             	sub    $0x4,%esp
+  802066:	68 05 08 00 00       	push   $0x805
+  80206b:	ff 75 cc             	push   -0x34(%ebp)
+  80206e:	6a 00                	push   $0x0
+  802070:	56                   	push   %esi
+  802071:	6a 00                	push   $0x0
+  802073:	6a 05                	push   $0x5
+  802075:	68 40 50 80 00       	push   $0x805040
+  80207a:	e8 f6 ef ff ff       	call   801075 <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  80207f:	c1 e8 1f             	shr    $0x1f,%eax
+  802082:	08 45 cb             	or     %al,-0x35(%ebp)
+  802085:	83 c4 20             	add    $0x20,%esp
+  802088:	e9 33 ff ff ff       	jmp    801fc0 <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  80208d:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  802090:	83 ec 0c             	sub    $0xc,%esp
+  802093:	68 40 50 80 00       	push   $0x805040
+  802098:	e8 88 ef ff ff       	call   801025 <sysbatch_flush>
+  80209d:	83 c4 10             	add    $0x10,%esp
+  8020a0:	85 c0                	test   %eax,%eax
+  8020a2:	78 06                	js     8020aa <devfile_read+0x231>
+  8020a4:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  8020a8:	74 14                	je     8020be <devfile_read+0x245>
+    memmove(dst, src, r);
+  8020aa:	83 ec 04             	sub    $0x4,%esp
+  8020ad:	ff 75 d4             	push   -0x2c(%ebp)
+  8020b0:	ff 75 d0             	push   -0x30(%ebp)
+  8020b3:	ff 75 0c             	push   0xc(%ebp)
+  8020b6:	e8 be e8 ff ff       	call   800979 <memmove>
+  8020bb:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  8020be:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020c1:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  8020c4:	e9 11 fe ff ff       	jmp    801eda <devfile_read+0x61>
+  assert(r <= n);
+  8020c9:	68 f5 3e 80 00       	push   $0x803ef5
+  8020ce:	68 fc 3e 80 00       	push   $0x803efc
+  8020d3:	68 1c 01 00 00       	push   $0x11c
+  8020d8:	68 ea 3e 80 00       	push   $0x803eea
+  8020dd:	e8 ab 15 00 00       	call   80368d <_panic>
+  assert(r <= PGSIZE);
+  8020e2:	68 11 3f 80 00       	push   $0x803f11
+  8020e7:	68 fc 3e 80 00       	push   $0x803efc
+  8020ec:	68 1d 01 00 00       	push   $0x11d
+  8020f1:	68 ea 3e 80 00       	push   $0x803eea
+  8020f6:	e8 92 15 00 00       	call   80368d <_panic>
+
+008020fb <devfile_write>:
+{
+  8020fb:	55                   	push   %ebp
+  8020fc:	89 e5                	mov    %esp,%ebp
+  8020fe:	57                   	push   %edi
+  8020ff:	56                   	push   %esi
+  802100:	53                   	push   %ebx
+  802101:	83 ec 1c             	sub    $0x1c,%esp
+  802104:	8b 75 08             	mov    0x8(%ebp),%esi
+  802107:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  80210a:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  80210f:	77 39                	ja     80214a <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802111:	8b 56 0c             	mov    0xc(%esi),%edx
+  802114:	89 15 00 60 80 00    	mov    %edx,0x806000
+  fsipcbuf.write.req_n = n;
+  80211a:	a3 04 60 80 00       	mov    %eax,0x806004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  80211f:	83 ec 04             	sub    $0x4,%esp
+  802122:	50                   	push   %eax
+  802123:	ff 75 0c             	push   0xc(%ebp)
+  802126:	68 08 60 80 00       	push   $0x806008
+  80212b:	e8 49 e8 ff ff       	call   800979 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  802130:	ba 00 00 00 00       	mov    $0x0,%edx
+  802135:	b8 04 00 00 00       	mov    $0x4,%eax
+  80213a:	e8 e7 fb ff ff       	call   801d26 <fsipc>
+  80213f:	83 c4 10             	add    $0x10,%esp
+}
+  802142:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802145:	5b                   	pop    %ebx
+  802146:	5e                   	pop    %esi
+  802147:	5f                   	pop    %edi
+  802148:	5d                   	pop    %ebp
+  802149:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  80214a:	ba 00 00 10 00       	mov    $0x100000,%edx
+  80214f:	39 d0                	cmp    %edx,%eax
+  802151:	89 d3                	mov    %edx,%ebx
+  802153:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  802156:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  80215c:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  80215f:	83 c7 01             	add    $0x1,%edi
+  802162:	89 f8                	mov    %edi,%eax
+  802164:	e8 94 fc ff ff       	call   801dfd <fsv_alloc>
+  802169:	85 c0                	test   %eax,%eax
+  80216b:	78 d5                	js     802142 <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  80216d:	83 ec 04             	sub    $0x4,%esp
+  802170:	53                   	push   %ebx
+  802171:	ff 75 0c             	push   0xc(%ebp)
+  802174:	68 00 10 c0 9f       	push   $0x9fc01000
+  802179:	e8 fb e7 ff ff       	call   800979 <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  80217e:	8b 46 0c             	mov    0xc(%esi),%eax
+  802181:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  802186:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  80218c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  802193:	89 f9                	mov    %edi,%ecx
+  802195:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  80219a:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80219f:	e8 69 fa ff ff       	call   801c0d <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  8021a4:	6a 00                	push   $0x0
+  8021a6:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8021a9:	50                   	push   %eax
+  8021aa:	6a 00                	push   $0x0
+  8021ac:	6a 00                	push   $0x0
+  8021ae:	e8 52 f3 ff ff       	call   801505 <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  8021b3:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  8021b6:	eb 8a                	jmp    802142 <devfile_write+0x47>
+
+008021b8 <open>:
+{
+  8021b8:	55                   	push   %ebp
+  8021b9:	89 e5                	mov    %esp,%ebp
+  8021bb:	56                   	push   %esi
+  8021bc:	53                   	push   %ebx
+  8021bd:	83 ec 1c             	sub    $0x1c,%esp
+  8021c0:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  8021c3:	56                   	push   %esi
+  8021c4:	e8 ef e5 ff ff       	call   8007b8 <strlen>
+  8021c9:	83 c4 10             	add    $0x10,%esp
+  8021cc:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8021d1:	7f 6c                	jg     80223f <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  8021d3:	83 ec 0c             	sub    $0xc,%esp
+  8021d6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021d9:	50                   	push   %eax
+  8021da:	e8 ad f4 ff ff       	call   80168c <fd_alloc>
+  8021df:	89 c3                	mov    %eax,%ebx
+  8021e1:	83 c4 10             	add    $0x10,%esp
+  8021e4:	85 c0                	test   %eax,%eax
+  8021e6:	78 3c                	js     802224 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  8021e8:	83 ec 08             	sub    $0x8,%esp
+  8021eb:	56                   	push   %esi
+  8021ec:	68 00 60 80 00       	push   $0x806000
+  8021f1:	e8 fd e5 ff ff       	call   8007f3 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  8021f6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021f9:	a3 00 64 80 00       	mov    %eax,0x806400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8021fe:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802201:	b8 01 00 00 00       	mov    $0x1,%eax
+  802206:	e8 1b fb ff ff       	call   801d26 <fsipc>
+  80220b:	89 c3                	mov    %eax,%ebx
+  80220d:	83 c4 10             	add    $0x10,%esp
+  802210:	85 c0                	test   %eax,%eax
+  802212:	78 19                	js     80222d <open+0x75>
+  return fd2num(fd);
+  802214:	83 ec 0c             	sub    $0xc,%esp
+  802217:	ff 75 f4             	push   -0xc(%ebp)
+  80221a:	e8 49 f4 ff ff       	call   801668 <fd2num>
+  80221f:	89 c3                	mov    %eax,%ebx
+  802221:	83 c4 10             	add    $0x10,%esp
+}
+  802224:	89 d8                	mov    %ebx,%eax
+  802226:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802229:	5b                   	pop    %ebx
+  80222a:	5e                   	pop    %esi
+  80222b:	5d                   	pop    %ebp
+  80222c:	c3                   	ret
+    fd_close(fd, 0);
+  80222d:	83 ec 08             	sub    $0x8,%esp
+  802230:	6a 00                	push   $0x0
+  802232:	ff 75 f4             	push   -0xc(%ebp)
+  802235:	e8 44 f5 ff ff       	call   80177e <fd_close>
+    return r;
+  80223a:	83 c4 10             	add    $0x10,%esp
+  80223d:	eb e5                	jmp    802224 <open+0x6c>
+    return -E_BAD_PATH;
+  80223f:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802244:	eb de                	jmp    802224 <open+0x6c>
+
+00802246 <open_read>:
+{
+  802246:	55                   	push   %ebp
+  802247:	89 e5                	mov    %esp,%ebp
+  802249:	57                   	push   %edi
+  80224a:	56                   	push   %esi
+  80224b:	53                   	push   %ebx
+  80224c:	83 ec 28             	sub    $0x28,%esp
+  80224f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  802252:	57                   	push   %edi
+  802253:	e8 60 e5 ff ff       	call   8007b8 <strlen>
+  802258:	83 c4 10             	add    $0x10,%esp
+  80225b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802260:	0f 87 f6 00 00 00    	ja     80235c <open_read+0x116>
+  802266:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  802268:	83 ec 0c             	sub    $0xc,%esp
+  80226b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80226e:	50                   	push   %eax
+  80226f:	e8 18 f4 ff ff       	call   80168c <fd_alloc>
+  802274:	89 c3                	mov    %eax,%ebx
+  802276:	83 c4 10             	add    $0x10,%esp
+  802279:	85 c0                	test   %eax,%eax
+  80227b:	0f 88 b2 00 00 00    	js     802333 <open_read+0xed>
+  strcpy(req->req_buf, path);
+  802281:	83 ec 08             	sub    $0x8,%esp
+  802284:	57                   	push   %edi
+  802285:	68 e4 60 80 00       	push   $0x8060e4
+  80228a:	e8 64 e5 ff ff       	call   8007f3 <strcpy>
+  req->req_nops = 2;
+  80228f:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  802296:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  802299:	c7 05 04 60 80 00 01 	movl   $0x1,0x806004
+  8022a0:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  8022a3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022a6:	a3 10 60 80 00       	mov    %eax,0x806010
+  req->req_ops[0].op_buf = 0;
+  8022ab:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  8022b2:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  8022b5:	c7 05 20 60 80 00 04 	movl   $0x4,0x806020
+  8022bc:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  8022bf:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  8022c6:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  8022c9:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  8022ce:	29 f0                	sub    %esi,%eax
+  8022d0:	3b 45 14             	cmp    0x14(%ebp),%eax
+  8022d3:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  8022d7:	a3 2c 60 80 00       	mov    %eax,0x80602c
+  req->req_ops[1].op_offset = 0;
+  8022dc:	c7 05 30 60 80 00 00 	movl   $0x0,0x806030
+  8022e3:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  8022e6:	83 c6 01             	add    $0x1,%esi
+  8022e9:	89 35 34 60 80 00    	mov    %esi,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  8022ef:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8022f2:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8022f7:	e8 2a fa ff ff       	call   801d26 <fsipc>
+  8022fc:	89 c3                	mov    %eax,%ebx
+  8022fe:	83 c4 10             	add    $0x10,%esp
+  802301:	83 f8 01             	cmp    $0x1,%eax
+  802304:	7e 37                	jle    80233d <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  802306:	a1 38 60 80 00       	mov    0x806038,%eax
+  80230b:	8b 55 18             	mov    0x18(%ebp),%edx
+  80230e:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  802310:	83 ec 04             	sub    $0x4,%esp
+  802313:	50                   	push   %eax
+  802314:	81 c6 e4 60 80 00    	add    $0x8060e4,%esi
+  80231a:	56                   	push   %esi
+  80231b:	ff 75 10             	push   0x10(%ebp)
+  80231e:	e8 56 e6 ff ff       	call   800979 <memmove>
+  return fd2num(fd);
+  802323:	83 c4 04             	add    $0x4,%esp
+  802326:	ff 75 e4             	push   -0x1c(%ebp)
+  802329:	e8 3a f3 ff ff       	call   801668 <fd2num>
+  80232e:	89 c3                	mov    %eax,%ebx
+  802330:	83 c4 10             	add    $0x10,%esp
+}
+  802333:	89 d8                	mov    %ebx,%eax
+  802335:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802338:	5b                   	pop    %ebx
+  802339:	5e                   	pop    %esi
+  80233a:	5f                   	pop    %edi
+  80233b:	5d                   	pop    %ebp
+  80233c:	c3                   	ret
+    fd_close(fd, 0);
+  80233d:	83 ec 08             	sub    $0x8,%esp
+  802340:	6a 00                	push   $0x0
+  802342:	ff 75 e4             	push   -0x1c(%ebp)
+  802345:	e8 34 f4 ff ff       	call   80177e <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  80234a:	83 c4 10             	add    $0x10,%esp
+  80234d:	85 db                	test   %ebx,%ebx
+  80234f:	78 e2                	js     802333 <open_read+0xed>
+  802351:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  802354:	8b 9b 1c 60 80 00    	mov    0x80601c(%ebx),%ebx
+  80235a:	eb d7                	jmp    802333 <open_read+0xed>
+    return -E_BAD_PATH;
+  80235c:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802361:	eb d0                	jmp    802333 <open_read+0xed>
+
+00802363 <file_stat>:
+{
+  802363:	55                   	push   %ebp
+  802364:	89 e5                	mov    %esp,%ebp
+  802366:	57                   	push   %edi
+  802367:	56                   	push   %esi
+  802368:	53                   	push   %ebx
+  802369:	83 ec 18             	sub    $0x18,%esp
+  80236c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80236f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  802372:	57                   	push   %edi
+  802373:	e8 40 e4 ff ff       	call   8007b8 <strlen>
+  802378:	83 c4 10             	add    $0x10,%esp
+  80237b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802380:	0f 8f c7 00 00 00    	jg     80244d <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  802386:	83 ec 0c             	sub    $0xc,%esp
+  802389:	57                   	push   %edi
+  80238a:	e8 29 e4 ff ff       	call   8007b8 <strlen>
+  80238f:	8d 58 04             	lea    0x4(%eax),%ebx
+  802392:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  802395:	83 c4 08             	add    $0x8,%esp
+  802398:	57                   	push   %edi
+  802399:	68 e4 60 80 00       	push   $0x8060e4
+  80239e:	e8 50 e4 ff ff       	call   8007f3 <strcpy>
+  req->req_nops = 2;
+  8023a3:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  8023aa:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  8023ad:	c7 05 04 60 80 00 02 	movl   $0x2,0x806004
+  8023b4:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  8023b7:	c7 05 10 60 80 00 00 	movl   $0x0,0x806010
+  8023be:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  8023c1:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  8023c8:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  8023cb:	c7 05 20 60 80 00 03 	movl   $0x3,0x806020
+  8023d2:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  8023d5:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  8023dc:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  8023df:	89 1d 34 60 80 00    	mov    %ebx,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  8023e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023ea:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8023ef:	e8 32 f9 ff ff       	call   801d26 <fsipc>
+  8023f4:	83 c4 10             	add    $0x10,%esp
+  8023f7:	83 f8 01             	cmp    $0x1,%eax
+  8023fa:	7e 42                	jle    80243e <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  8023fc:	81 c3 e4 60 80 00    	add    $0x8060e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  802402:	83 ec 08             	sub    $0x8,%esp
+  802405:	53                   	push   %ebx
+  802406:	56                   	push   %esi
+  802407:	e8 e7 e3 ff ff       	call   8007f3 <strcpy>
+  st->st_size = ret->ret_size;
+  80240c:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  802412:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  802418:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  80241e:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  802424:	c7 86 88 00 00 00 04 	movl   $0x804004,0x88(%esi)
+  80242b:	40 80 00 
+  return 0;
+  80242e:	83 c4 10             	add    $0x10,%esp
+  802431:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802436:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802439:	5b                   	pop    %ebx
+  80243a:	5e                   	pop    %esi
+  80243b:	5f                   	pop    %edi
+  80243c:	5d                   	pop    %ebp
+  80243d:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  80243e:	85 c0                	test   %eax,%eax
+  802440:	78 f4                	js     802436 <file_stat+0xd3>
+  802442:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802445:	8b 80 1c 60 80 00    	mov    0x80601c(%eax),%eax
+  80244b:	eb e9                	jmp    802436 <file_stat+0xd3>
+    return -E_BAD_PATH;
+  80244d:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802452:	eb e2                	jmp    802436 <file_stat+0xd3>
+
+00802454 <read_map>:
+{
+  802454:	55                   	push   %ebp
+  802455:	89 e5                	mov    %esp,%ebp
+  802457:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80245a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80245d:	50                   	push   %eax
+  80245e:	ff 75 08             	push   0x8(%ebp)
+  802461:	e8 7c f2 ff ff       	call   8016e2 <fd_lookup>
+  802466:	83 c4 10             	add    $0x10,%esp
+  802469:	85 c0                	test   %eax,%eax
+  80246b:	78 2a                	js     802497 <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  80246d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802470:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  802476:	39 08                	cmp    %ecx,(%eax)
+  802478:	75 1f                	jne    802499 <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  80247a:	8b 40 0c             	mov    0xc(%eax),%eax
+  80247d:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read_map.req_offset = offset;
+  802482:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802485:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  80248a:	8b 55 10             	mov    0x10(%ebp),%edx
+  80248d:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802492:	e8 8f f8 ff ff       	call   801d26 <fsipc>
+}
+  802497:	c9                   	leave
+  802498:	c3                   	ret
+    return -E_INVAL;
+  802499:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80249e:	eb f7                	jmp    802497 <read_map+0x43>
+
+008024a0 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8024a0:	55                   	push   %ebp
+  8024a1:	89 e5                	mov    %esp,%ebp
+  8024a3:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  8024a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024ab:	b8 08 00 00 00       	mov    $0x8,%eax
+  8024b0:	e8 71 f8 ff ff       	call   801d26 <fsipc>
+}
+  8024b5:	c9                   	leave
+  8024b6:	c3                   	ret
+
+008024b7 <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  8024b7:	55                   	push   %ebp
+  8024b8:	89 e5                	mov    %esp,%ebp
+  8024ba:	57                   	push   %edi
+  8024bb:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  8024bc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024bf:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.stats.req_bio_sched = 0;
+  8024c4:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  8024cb:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  8024ce:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  8024d5:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  8024d8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024dd:	b8 09 00 00 00       	mov    $0x9,%eax
+  8024e2:	e8 3f f8 ff ff       	call   801d26 <fsipc>
+  8024e7:	85 c0                	test   %eax,%eax
+  8024e9:	78 14                	js     8024ff <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  8024eb:	be 00 60 80 00       	mov    $0x806000,%esi
+  8024f0:	b9 16 00 00 00       	mov    $0x16,%ecx
+  8024f5:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8024f8:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  8024fa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024ff:	5e                   	pop    %esi
+  802500:	5f                   	pop    %edi
+  802501:	5d                   	pop    %ebp
+  802502:	c3                   	ret
+
+00802503 <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  802503:	55                   	push   %ebp
+  802504:	89 e5                	mov    %esp,%ebp
+  802506:	53                   	push   %ebx
+  802507:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  80250a:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  80250d:	50                   	push   %eax
+  80250e:	6a 00                	push   $0x0
+  802510:	e8 a2 ff ff ff       	call   8024b7 <fs_stats>
+  802515:	83 c4 10             	add    $0x10,%esp
+  802518:	85 c0                	test   %eax,%eax
+  80251a:	78 28                	js     802544 <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  80251c:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  80251f:	83 ec 08             	sub    $0x8,%esp
+  802522:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802525:	50                   	push   %eax
+  802526:	6a 20                	push   $0x20
+  802528:	e8 8a ff ff ff       	call   8024b7 <fs_stats>
+  80252d:	83 c4 10             	add    $0x10,%esp
+  802530:	85 c0                	test   %eax,%eax
+  802532:	78 10                	js     802544 <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  802534:	83 ec 08             	sub    $0x8,%esp
+  802537:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  80253a:	50                   	push   %eax
+  80253b:	53                   	push   %ebx
+  80253c:	e8 76 ff ff ff       	call   8024b7 <fs_stats>
+  802541:	83 c4 10             	add    $0x10,%esp
+}
+  802544:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802547:	c9                   	leave
+  802548:	c3                   	ret
+
+00802549 <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  802549:	55                   	push   %ebp
+  80254a:	89 e5                	mov    %esp,%ebp
+  80254c:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  80254f:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  802556:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  802559:	8b 45 08             	mov    0x8(%ebp),%eax
+  80255c:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.stats.req_dcache = 0;
+  802561:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  802568:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  80256b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802570:	b8 09 00 00 00       	mov    $0x9,%eax
+  802575:	e8 ac f7 ff ff       	call   801d26 <fsipc>
+}
+  80257a:	c9                   	leave
+  80257b:	c3                   	ret
+
+0080257c <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  80257c:	55                   	push   %ebp
+  80257d:	89 e5                	mov    %esp,%ebp
+  80257f:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  802582:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  802589:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  80258c:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  802593:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  802596:	8b 45 08             	mov    0x8(%ebp),%eax
+  802599:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_STATS, NULL);
+  80259e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025a3:	b8 09 00 00 00       	mov    $0x9,%eax
+  8025a8:	e8 79 f7 ff ff       	call   801d26 <fsipc>
+}
+  8025ad:	c9                   	leave
+  8025ae:	c3                   	ret
+
+008025af <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  8025af:	55                   	push   %ebp
+  8025b0:	89 e5                	mov    %esp,%ebp
+  8025b2:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8025b5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8025b8:	50                   	push   %eax
+  8025b9:	ff 75 08             	push   0x8(%ebp)
+  8025bc:	e8 21 f1 ff ff       	call   8016e2 <fd_lookup>
+  8025c1:	83 c4 10             	add    $0x10,%esp
+  8025c4:	85 c0                	test   %eax,%eax
+  8025c6:	78 34                	js     8025fc <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  8025c8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025cb:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  8025d1:	39 08                	cmp    %ecx,(%eax)
+  8025d3:	75 29                	jne    8025fe <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  8025d5:	8b 40 0c             	mov    0xc(%eax),%eax
+  8025d8:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.fallocate.req_offset = offset;
+  8025dd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8025e0:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.fallocate.req_len = len;
+  8025e5:	8b 45 10             	mov    0x10(%ebp),%eax
+  8025e8:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  8025ed:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025f2:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8025f7:	e8 2a f7 ff ff       	call   801d26 <fsipc>
+}
+  8025fc:	c9                   	leave
+  8025fd:	c3                   	ret
+    return -E_INVAL;
+  8025fe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802603:	eb f7                	jmp    8025fc <fallocate+0x4d>
+
+00802605 <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  802605:	55                   	push   %ebp
+  802606:	89 e5                	mov    %esp,%ebp
+  802608:	57                   	push   %edi
+  802609:	56                   	push   %esi
+  80260a:	53                   	push   %ebx
+  80260b:	83 ec 24             	sub    $0x24,%esp
+  80260e:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802611:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802614:	50                   	push   %eax
+  802615:	ff 75 08             	push   0x8(%ebp)
+  802618:	e8 c5 f0 ff ff       	call   8016e2 <fd_lookup>
+  80261d:	83 c4 10             	add    $0x10,%esp
+  802620:	85 c0                	test   %eax,%eax
+  802622:	78 66                	js     80268a <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  802624:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802627:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  80262d:	39 08                	cmp    %ecx,(%eax)
+  80262f:	75 61                	jne    802692 <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  802631:	85 f6                	test   %esi,%esi
+  802633:	7e 50                	jle    802685 <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  802635:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  80263a:	39 de                	cmp    %ebx,%esi
+  80263c:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  80263f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802642:	8b 40 0c             	mov    0xc(%eax),%eax
+  802645:	a3 00 60 80 00       	mov    %eax,0x806000
+    fsipcbuf.prefetch.req_n = m;
+  80264a:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  802650:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  802657:	83 ec 04             	sub    $0x4,%esp
+  80265a:	57                   	push   %edi
+  80265b:	ff 75 0c             	push   0xc(%ebp)
+  80265e:	68 08 60 80 00       	push   $0x806008
+  802663:	e8 11 e3 ff ff       	call   800979 <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  802668:	ba 00 00 00 00       	mov    $0x0,%edx
+  80266d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802672:	e8 af f6 ff ff       	call   801d26 <fsipc>
+  802677:	83 c4 10             	add    $0x10,%esp
+  80267a:	85 c0                	test   %eax,%eax
+  80267c:	78 0c                	js     80268a <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  80267e:	01 7d 0c             	add    %edi,0xc(%ebp)
+  802681:	29 de                	sub    %ebx,%esi
+  802683:	eb ac                	jmp    802631 <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  802685:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80268a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80268d:	5b                   	pop    %ebx
+  80268e:	5e                   	pop    %esi
+  80268f:	5f                   	pop    %edi
+  802690:	5d                   	pop    %ebp
+  802691:	c3                   	ret
+    return -E_INVAL;
+  802692:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802697:	eb f1                	jmp    80268a <prefetch+0x85>
+
+00802699 <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  802699:	55                   	push   %ebp
+  80269a:	89 e5                	mov    %esp,%ebp
+  80269c:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  80269f:	50                   	push   %eax
+  8026a0:	e8 d3 ef ff ff       	call   801678 <fd2data>
+  8026a5:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  8026aa:	c9                   	leave
+  8026ab:	c3                   	ret
+
+008026ac <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8026ac:	55                   	push   %ebp
+  8026ad:	89 e5                	mov    %esp,%ebp
+  8026af:	56                   	push   %esi
+  8026b0:	53                   	push   %ebx
+  8026b1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  8026b4:	83 ec 0c             	sub    $0xc,%esp
+  8026b7:	ff 75 08             	push   0x8(%ebp)
+  8026ba:	e8 b9 ef ff ff       	call   801678 <fd2data>
+  8026bf:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  8026c1:	83 c4 08             	add    $0x8,%esp
+  8026c4:	68 4c 3f 80 00       	push   $0x803f4c
+  8026c9:	53                   	push   %ebx
+  8026ca:	e8 24 e1 ff ff       	call   8007f3 <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  8026cf:	8b 46 04             	mov    0x4(%esi),%eax
+  8026d2:	2b 06                	sub    (%esi),%eax
+  8026d4:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  8026da:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8026e1:	00 00 00 
+  stat->st_dev = &devpipe;
+  8026e4:	c7 83 88 00 00 00 20 	movl   $0x804020,0x88(%ebx)
+  8026eb:	40 80 00 
+  return 0;
+}
+  8026ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026f3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026f6:	5b                   	pop    %ebx
+  8026f7:	5e                   	pop    %esi
+  8026f8:	5d                   	pop    %ebp
+  8026f9:	c3                   	ret
+
+008026fa <pipe_wakeup>:
+{
+  8026fa:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  8026fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802701:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  802704:	85 c0                	test   %eax,%eax
+  802706:	75 01                	jne    802709 <pipe_wakeup+0xf>
+  802708:	c3                   	ret
+{
+  802709:	55                   	push   %ebp
+  80270a:	89 e5                	mov    %esp,%ebp
+  80270c:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  80270f:	6a 00                	push   $0x0
+  802711:	68 00 00 c0 ee       	push   $0xeec00000
+  802716:	52                   	push   %edx
+  802717:	e8 62 e8 ff ff       	call   800f7e <sys_chan_wakeup>
+  80271c:	83 c4 10             	add    $0x10,%esp
+}
+  80271f:	c9                   	leave
+  802720:	c3                   	ret
+
+00802721 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802721:	55                   	push   %ebp
+  802722:	89 e5                	mov    %esp,%ebp
+  802724:	57                   	push   %edi
+  802725:	56                   	push   %esi
+  802726:	53                   	push   %ebx
+  802727:	83 ec 18             	sub    $0x18,%esp
+  80272a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  80272d:	57                   	push   %edi
+  80272e:	e8 45 ef ff ff       	call   801678 <fd2data>
+  802733:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  802735:	83 c4 10             	add    $0x10,%esp
+  802738:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  80273c:	74 2a                	je     802768 <devpipe_close+0x47>
+  80273e:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  802743:	89 f8                	mov    %edi,%eax
+  802745:	e8 4f ff ff ff       	call   802699 <pipe_ring>
+  80274a:	83 ec 08             	sub    $0x8,%esp
+  80274d:	01 d8                	add    %ebx,%eax
+  80274f:	50                   	push   %eax
+  802750:	6a 00                	push   $0x0
+  802752:	e8 50 e5 ff ff       	call   800ca7 <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  802757:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80275d:	83 c4 10             	add    $0x10,%esp
+  802760:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  802766:	75 db                	jne    802743 <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  802768:	83 ec 08             	sub    $0x8,%esp
+  80276b:	57                   	push   %edi
+  80276c:	6a 00                	push   $0x0
+  80276e:	e8 34 e5 ff ff       	call   800ca7 <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  802773:	83 c4 10             	add    $0x10,%esp
+  802776:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  80277a:	75 13                	jne    80278f <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  80277c:	83 ec 08             	sub    $0x8,%esp
+  80277f:	56                   	push   %esi
+  802780:	6a 00                	push   $0x0
+  802782:	e8 20 e5 ff ff       	call   800ca7 <sys_page_unmap>
+}
+  802787:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80278a:	5b                   	pop    %ebx
+  80278b:	5e                   	pop    %esi
+  80278c:	5f                   	pop    %edi
+  80278d:	5d                   	pop    %ebp
+  80278e:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  80278f:	8d 56 04             	lea    0x4(%esi),%edx
+  802792:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802795:	e8 60 ff ff ff       	call   8026fa <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  80279a:	8d 46 30             	lea    0x30(%esi),%eax
+  80279d:	89 f2                	mov    %esi,%edx
+  80279f:	e8 56 ff ff ff       	call   8026fa <pipe_wakeup>
+  8027a4:	eb d6                	jmp    80277c <devpipe_close+0x5b>
+
+008027a6 <_pipeisclosed>:
+{
+  8027a6:	55                   	push   %ebp
+  8027a7:	89 e5                	mov    %esp,%ebp
+  8027a9:	57                   	push   %edi
+  8027aa:	56                   	push   %esi
+  8027ab:	53                   	push   %ebx
+  8027ac:	83 ec 1c             	sub    $0x1c,%esp
+  8027af:	89 c7                	mov    %eax,%edi
+  8027b1:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  8027b3:	a1 a4 58 80 00       	mov    0x8058a4,%eax
+  8027b8:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  8027bb:	83 ec 0c             	sub    $0xc,%esp
+  8027be:	57                   	push   %edi
+  8027bf:	e8 7c 0f 00 00       	call   803740 <pageref>
+  8027c4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8027c7:	89 34 24             	mov    %esi,(%esp)
+  8027ca:	e8 71 0f 00 00       	call   803740 <pageref>
+    nn = thisenv->env_runs;
+  8027cf:	8b 15 a4 58 80 00    	mov    0x8058a4,%edx
+  8027d5:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  8027d8:	83 c4 10             	add    $0x10,%esp
+  8027db:	39 cb                	cmp    %ecx,%ebx
+  8027dd:	74 1b                	je     8027fa <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  8027df:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8027e2:	75 cf                	jne    8027b3 <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8027e4:	8b 42 58             	mov    0x58(%edx),%eax
+  8027e7:	6a 01                	push   $0x1
+  8027e9:	50                   	push   %eax
+  8027ea:	53                   	push   %ebx
+  8027eb:	68 53 3f 80 00       	push   $0x803f53
+  8027f0:	e8 10 da ff ff       	call   800205 <cprintf>
+  8027f5:	83 c4 10             	add    $0x10,%esp
+  8027f8:	eb b9                	jmp    8027b3 <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  8027fa:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8027fd:	0f 94 c0             	sete   %al
+  802800:	0f b6 c0             	movzbl %al,%eax
+}
+  802803:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802806:	5b                   	pop    %ebx
+  802807:	5e                   	pop    %esi
+  802808:	5f                   	pop    %edi
+  802809:	5d                   	pop    %ebp
+  80280a:	c3                   	ret
+
+0080280b <devpipe_write_bulk>:
+{
+  80280b:	55                   	push   %ebp
+  80280c:	89 e5                	mov    %esp,%ebp
+  80280e:	57                   	push   %edi
+  80280f:	56                   	push   %esi
+  802810:	53                   	push   %ebx
+  802811:	83 ec 1c             	sub    $0x1c,%esp
+  802814:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802817:	89 d6                	mov    %edx,%esi
+  802819:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  80281c:	e8 78 fe ff ff       	call   802699 <pipe_ring>
+  802821:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  802824:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802829:	8d 46 04             	lea    0x4(%esi),%eax
+  80282c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  80282f:	eb 75                	jmp    8028a6 <devpipe_write_bulk+0x9b>
+  802831:	b8 01 00 00 00       	mov    $0x1,%eax
+  802836:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  80283a:	6a 64                	push   $0x64
+  80283c:	68 00 00 c0 ee       	push   $0xeec00000
+  802841:	53                   	push   %ebx
+  802842:	56                   	push   %esi
+  802843:	e8 13 e7 ff ff       	call   800f5b <sys_chan_sleep>
+      continue;
+  802848:	83 c4 10             	add    $0x10,%esp
+  80284b:	eb 59                	jmp    8028a6 <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  80284d:	89 d1                	mov    %edx,%ecx
+  80284f:	c1 f9 1f             	sar    $0x1f,%ecx
+  802852:	c1 e9 11             	shr    $0x11,%ecx
+  802855:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802858:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  80285d:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  80285f:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  802865:	29 d3                	sub    %edx,%ebx
+  802867:	ba 00 80 00 00       	mov    $0x8000,%edx
+  80286c:	29 c2                	sub    %eax,%edx
+  80286e:	39 d3                	cmp    %edx,%ebx
+  802870:	0f 47 da             	cmova  %edx,%ebx
+  802873:	8b 55 08             	mov    0x8(%ebp),%edx
+  802876:	29 fa                	sub    %edi,%edx
+  802878:	39 d3                	cmp    %edx,%ebx
+  80287a:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  80287d:	83 ec 04             	sub    $0x4,%esp
+  802880:	53                   	push   %ebx
+  802881:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802884:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  802887:	52                   	push   %edx
+  802888:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80288b:	01 c8                	add    %ecx,%eax
+  80288d:	50                   	push   %eax
+  80288e:	e8 48 e1 ff ff       	call   8009db <memcpy>
+    i += m;
+  802893:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  802895:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802898:	8d 46 2c             	lea    0x2c(%esi),%eax
+  80289b:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80289e:	e8 57 fe ff ff       	call   8026fa <pipe_wakeup>
+  8028a3:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  8028a6:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  8028a9:	73 2b                	jae    8028d6 <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  8028ab:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  8028ad:	8b 56 04             	mov    0x4(%esi),%edx
+  8028b0:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  8028b6:	39 d0                	cmp    %edx,%eax
+  8028b8:	7d 93                	jge    80284d <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  8028ba:	89 f2                	mov    %esi,%edx
+  8028bc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8028bf:	e8 e2 fe ff ff       	call   8027a6 <_pipeisclosed>
+  8028c4:	85 c0                	test   %eax,%eax
+  8028c6:	0f 84 65 ff ff ff    	je     802831 <devpipe_write_bulk+0x26>
+        return i;
+  8028cc:	89 f8                	mov    %edi,%eax
+}
+  8028ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028d1:	5b                   	pop    %ebx
+  8028d2:	5e                   	pop    %esi
+  8028d3:	5f                   	pop    %edi
+  8028d4:	5d                   	pop    %ebp
+  8028d5:	c3                   	ret
+  return i;
+  8028d6:	89 f8                	mov    %edi,%eax
+  8028d8:	eb f4                	jmp    8028ce <devpipe_write_bulk+0xc3>
+
+008028da <devpipe_write>:
+{
+  8028da:	55                   	push   %ebp
+  8028db:	89 e5                	mov    %esp,%ebp
+  8028dd:	57                   	push   %edi
+  8028de:	56                   	push   %esi
+  8028df:	53                   	push   %ebx
+  8028e0:	83 ec 28             	sub    $0x28,%esp
+  8028e3:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  8028e6:	56                   	push   %esi
+  8028e7:	e8 8c ed ff ff       	call   801678 <fd2data>
+  8028ec:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  8028ee:	8b 78 28             	mov    0x28(%eax),%edi
+  8028f1:	83 c4 10             	add    $0x10,%esp
+  8028f4:	85 ff                	test   %edi,%edi
+  8028f6:	75 25                	jne    80291d <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  8028f8:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8028fb:	74 66                	je     802963 <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8028fd:	8b 43 04             	mov    0x4(%ebx),%eax
+  802900:	8b 0b                	mov    (%ebx),%ecx
+  802902:	8d 51 20             	lea    0x20(%ecx),%edx
+  802905:	39 d0                	cmp    %edx,%eax
+  802907:	72 2b                	jb     802934 <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  802909:	89 da                	mov    %ebx,%edx
+  80290b:	89 f0                	mov    %esi,%eax
+  80290d:	e8 94 fe ff ff       	call   8027a6 <_pipeisclosed>
+  802912:	85 c0                	test   %eax,%eax
+  802914:	75 51                	jne    802967 <devpipe_write+0x8d>
+      sys_yield();
+  802916:	e8 a5 e2 ff ff       	call   800bc0 <sys_yield>
+  80291b:	eb e0                	jmp    8028fd <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  80291d:	83 ec 0c             	sub    $0xc,%esp
+  802920:	ff 75 10             	push   0x10(%ebp)
+  802923:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802926:	89 c2                	mov    %eax,%edx
+  802928:	89 f0                	mov    %esi,%eax
+  80292a:	e8 dc fe ff ff       	call   80280b <devpipe_write_bulk>
+  80292f:	83 c4 10             	add    $0x10,%esp
+  802932:	eb 38                	jmp    80296c <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802934:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802937:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  80293b:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  80293e:	89 c2                	mov    %eax,%edx
+  802940:	c1 fa 1f             	sar    $0x1f,%edx
+  802943:	89 d1                	mov    %edx,%ecx
+  802945:	c1 e9 1b             	shr    $0x1b,%ecx
+  802948:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80294b:	83 e2 1f             	and    $0x1f,%edx
+  80294e:	29 ca                	sub    %ecx,%edx
+  802950:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802954:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  802958:	83 c0 01             	add    $0x1,%eax
+  80295b:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  80295e:	83 c7 01             	add    $0x1,%edi
+  802961:	eb 95                	jmp    8028f8 <devpipe_write+0x1e>
+  return i;
+  802963:	89 f8                	mov    %edi,%eax
+  802965:	eb 05                	jmp    80296c <devpipe_write+0x92>
+        return 0;
+  802967:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80296c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80296f:	5b                   	pop    %ebx
+  802970:	5e                   	pop    %esi
+  802971:	5f                   	pop    %edi
+  802972:	5d                   	pop    %ebp
+  802973:	c3                   	ret
+
+00802974 <devpipe_read_bulk>:
+{
+  802974:	55                   	push   %ebp
+  802975:	89 e5                	mov    %esp,%ebp
+  802977:	57                   	push   %edi
+  802978:	56                   	push   %esi
+  802979:	53                   	push   %ebx
+  80297a:	83 ec 2c             	sub    $0x2c,%esp
+  80297d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802980:	89 d6                	mov    %edx,%esi
+  802982:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802985:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  802988:	e8 0c fd ff ff       	call   802699 <pipe_ring>
+  80298d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  802990:	85 db                	test   %ebx,%ebx
+  802992:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802997:	0f 45 c3             	cmovne %ebx,%eax
+  80299a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80299d:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8029a2:	8d 46 30             	lea    0x30(%esi),%eax
+  8029a5:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  8029a8:	eb 50                	jmp    8029fa <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  8029aa:	89 d1                	mov    %edx,%ecx
+  8029ac:	c1 f9 1f             	sar    $0x1f,%ecx
+  8029af:	c1 e9 11             	shr    $0x11,%ecx
+  8029b2:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  8029b5:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8029ba:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  8029bc:	29 d3                	sub    %edx,%ebx
+  8029be:	ba 00 80 00 00       	mov    $0x8000,%edx
+  8029c3:	29 c2                	sub    %eax,%edx
+  8029c5:	39 d3                	cmp    %edx,%ebx
+  8029c7:	0f 47 da             	cmova  %edx,%ebx
+  8029ca:	8b 55 08             	mov    0x8(%ebp),%edx
+  8029cd:	29 fa                	sub    %edi,%edx
+  8029cf:	39 d3                	cmp    %edx,%ebx
+  8029d1:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  8029d4:	83 ec 04             	sub    $0x4,%esp
+  8029d7:	53                   	push   %ebx
+  8029d8:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8029db:	01 c8                	add    %ecx,%eax
+  8029dd:	50                   	push   %eax
+  8029de:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8029e1:	01 f8                	add    %edi,%eax
+  8029e3:	50                   	push   %eax
+  8029e4:	e8 f2 df ff ff       	call   8009db <memcpy>
+    i += m;
+  8029e9:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  8029eb:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8029ed:	89 f2                	mov    %esi,%edx
+  8029ef:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8029f2:	e8 03 fd ff ff       	call   8026fa <pipe_wakeup>
+  8029f7:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  8029fa:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  8029fd:	73 51                	jae    802a50 <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  8029ff:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  802a02:	8b 16                	mov    (%esi),%edx
+  802a04:	39 da                	cmp    %ebx,%edx
+  802a06:	75 a2                	jne    8029aa <devpipe_read_bulk+0x36>
+      if (i > 0)
+  802a08:	85 ff                	test   %edi,%edi
+  802a0a:	75 44                	jne    802a50 <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  802a0c:	89 f2                	mov    %esi,%edx
+  802a0e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802a11:	e8 90 fd ff ff       	call   8027a6 <_pipeisclosed>
+  802a16:	85 c0                	test   %eax,%eax
+  802a18:	75 3a                	jne    802a54 <devpipe_read_bulk+0xe0>
+  802a1a:	b8 01 00 00 00       	mov    $0x1,%eax
+  802a1f:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802a23:	6a 64                	push   $0x64
+  802a25:	ff 75 d4             	push   -0x2c(%ebp)
+  802a28:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  802a29:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802a2c:	50                   	push   %eax
+  802a2d:	e8 29 e5 ff ff       	call   800f5b <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  802a32:	85 c0                	test   %eax,%eax
+  802a34:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a39:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  802a3c:	83 c4 10             	add    $0x10,%esp
+  802a3f:	a8 01                	test   $0x1,%al
+  802a41:	74 b7                	je     8029fa <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  802a43:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  802a48:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a4b:	5b                   	pop    %ebx
+  802a4c:	5e                   	pop    %esi
+  802a4d:	5f                   	pop    %edi
+  802a4e:	5d                   	pop    %ebp
+  802a4f:	c3                   	ret
+  return i;
+  802a50:	89 f8                	mov    %edi,%eax
+  802a52:	eb f4                	jmp    802a48 <devpipe_read_bulk+0xd4>
+        return 0;
+  802a54:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a59:	eb ed                	jmp    802a48 <devpipe_read_bulk+0xd4>
+
+00802a5b <devpipe_read>:
+{
+  802a5b:	55                   	push   %ebp
+  802a5c:	89 e5                	mov    %esp,%ebp
+  802a5e:	57                   	push   %edi
+  802a5f:	56                   	push   %esi
+  802a60:	53                   	push   %ebx
+  802a61:	83 ec 18             	sub    $0x18,%esp
+  802a64:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  802a67:	57                   	push   %edi
+  802a68:	e8 0b ec ff ff       	call   801678 <fd2data>
+  802a6d:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  802a6f:	8b 70 28             	mov    0x28(%eax),%esi
+  802a72:	83 c4 10             	add    $0x10,%esp
+  802a75:	85 f6                	test   %esi,%esi
+  802a77:	75 24                	jne    802a9d <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  802a79:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802a7c:	74 60                	je     802ade <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  802a7e:	8b 03                	mov    (%ebx),%eax
+  802a80:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802a83:	75 3b                	jne    802ac0 <devpipe_read+0x65>
+      if (i > 0)
+  802a85:	85 f6                	test   %esi,%esi
+  802a87:	75 2d                	jne    802ab6 <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  802a89:	89 da                	mov    %ebx,%edx
+  802a8b:	89 f8                	mov    %edi,%eax
+  802a8d:	e8 14 fd ff ff       	call   8027a6 <_pipeisclosed>
+  802a92:	85 c0                	test   %eax,%eax
+  802a94:	75 4c                	jne    802ae2 <devpipe_read+0x87>
+      sys_yield();
+  802a96:	e8 25 e1 ff ff       	call   800bc0 <sys_yield>
+  802a9b:	eb e1                	jmp    802a7e <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  802a9d:	83 ec 08             	sub    $0x8,%esp
+  802aa0:	6a 00                	push   $0x0
+  802aa2:	ff 75 10             	push   0x10(%ebp)
+  802aa5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802aa8:	89 c2                	mov    %eax,%edx
+  802aaa:	89 f8                	mov    %edi,%eax
+  802aac:	e8 c3 fe ff ff       	call   802974 <devpipe_read_bulk>
+  802ab1:	83 c4 10             	add    $0x10,%esp
+  802ab4:	eb 02                	jmp    802ab8 <devpipe_read+0x5d>
+        return i;
+  802ab6:	89 f0                	mov    %esi,%eax
+}
+  802ab8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802abb:	5b                   	pop    %ebx
+  802abc:	5e                   	pop    %esi
+  802abd:	5f                   	pop    %edi
+  802abe:	5d                   	pop    %ebp
+  802abf:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802ac0:	99                   	cltd
+  802ac1:	c1 ea 1b             	shr    $0x1b,%edx
+  802ac4:	01 d0                	add    %edx,%eax
+  802ac6:	83 e0 1f             	and    $0x1f,%eax
+  802ac9:	29 d0                	sub    %edx,%eax
+  802acb:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802ad0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802ad3:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  802ad6:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  802ad9:	83 c6 01             	add    $0x1,%esi
+  802adc:	eb 9b                	jmp    802a79 <devpipe_read+0x1e>
+  return i;
+  802ade:	89 f0                	mov    %esi,%eax
+  802ae0:	eb d6                	jmp    802ab8 <devpipe_read+0x5d>
+        return 0;
+  802ae2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ae7:	eb cf                	jmp    802ab8 <devpipe_read+0x5d>
+
+00802ae9 <pipe2>:
+{
+  802ae9:	55                   	push   %ebp
+  802aea:	89 e5                	mov    %esp,%ebp
+  802aec:	57                   	push   %edi
+  802aed:	56                   	push   %esi
+  802aee:	53                   	push   %ebx
+  802aef:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  802af2:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802af5:	50                   	push   %eax
+  802af6:	e8 91 eb ff ff       	call   80168c <fd_alloc>
+  802afb:	89 c3                	mov    %eax,%ebx
+  802afd:	83 c4 10             	add    $0x10,%esp
+  802b00:	85 c0                	test   %eax,%eax
+  802b02:	0f 88 fb 01 00 00    	js     802d03 <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802b08:	83 ec 04             	sub    $0x4,%esp
+  802b0b:	68 07 04 00 00       	push   $0x407
+  802b10:	ff 75 e4             	push   -0x1c(%ebp)
+  802b13:	6a 00                	push   $0x0
+  802b15:	e8 08 e1 ff ff       	call   800c22 <sys_page_alloc>
+  802b1a:	89 c3                	mov    %eax,%ebx
+  802b1c:	83 c4 10             	add    $0x10,%esp
+  802b1f:	85 c0                	test   %eax,%eax
+  802b21:	0f 88 dc 01 00 00    	js     802d03 <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  802b27:	83 ec 0c             	sub    $0xc,%esp
+  802b2a:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  802b2d:	50                   	push   %eax
+  802b2e:	e8 59 eb ff ff       	call   80168c <fd_alloc>
+  802b33:	89 c3                	mov    %eax,%ebx
+  802b35:	83 c4 10             	add    $0x10,%esp
+  802b38:	85 c0                	test   %eax,%eax
+  802b3a:	0f 88 b3 01 00 00    	js     802cf3 <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802b40:	83 ec 04             	sub    $0x4,%esp
+  802b43:	68 07 04 00 00       	push   $0x407
+  802b48:	ff 75 e0             	push   -0x20(%ebp)
+  802b4b:	6a 00                	push   $0x0
+  802b4d:	e8 d0 e0 ff ff       	call   800c22 <sys_page_alloc>
+  802b52:	89 c3                	mov    %eax,%ebx
+  802b54:	83 c4 10             	add    $0x10,%esp
+  802b57:	85 c0                	test   %eax,%eax
+  802b59:	0f 88 94 01 00 00    	js     802cf3 <pipe2+0x20a>
+  va = fd2data(fd0);
+  802b5f:	83 ec 0c             	sub    $0xc,%esp
+  802b62:	ff 75 e4             	push   -0x1c(%ebp)
+  802b65:	e8 0e eb ff ff       	call   801678 <fd2data>
+  802b6a:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802b6c:	83 c4 0c             	add    $0xc,%esp
+  802b6f:	68 07 04 00 00       	push   $0x407
+  802b74:	50                   	push   %eax
+  802b75:	6a 00                	push   $0x0
+  802b77:	e8 a6 e0 ff ff       	call   800c22 <sys_page_alloc>
+  802b7c:	89 c3                	mov    %eax,%ebx
+  802b7e:	83 c4 10             	add    $0x10,%esp
+  802b81:	85 c0                	test   %eax,%eax
+  802b83:	0f 88 5a 01 00 00    	js     802ce3 <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802b89:	83 ec 0c             	sub    $0xc,%esp
+  802b8c:	ff 75 e0             	push   -0x20(%ebp)
+  802b8f:	e8 e4 ea ff ff       	call   801678 <fd2data>
+  802b94:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802b9b:	50                   	push   %eax
+  802b9c:	6a 00                	push   $0x0
+  802b9e:	57                   	push   %edi
+  802b9f:	6a 00                	push   $0x0
+  802ba1:	e8 bf e0 ff ff       	call   800c65 <sys_page_map>
+  802ba6:	89 c3                	mov    %eax,%ebx
+  802ba8:	83 c4 20             	add    $0x20,%esp
+  802bab:	85 c0                	test   %eax,%eax
+  802bad:	0f 88 22 01 00 00    	js     802cd5 <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  802bb3:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  802bb7:	74 72                	je     802c2b <pipe2+0x142>
+  802bb9:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  802bbe:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802bc1:	e8 d3 fa ff ff       	call   802699 <pipe_ring>
+  802bc6:	83 ec 04             	sub    $0x4,%esp
+  802bc9:	68 07 04 00 00       	push   $0x407
+  802bce:	01 f0                	add    %esi,%eax
+  802bd0:	50                   	push   %eax
+  802bd1:	6a 00                	push   $0x0
+  802bd3:	e8 4a e0 ff ff       	call   800c22 <sys_page_alloc>
+  802bd8:	89 c3                	mov    %eax,%ebx
+  802bda:	83 c4 10             	add    $0x10,%esp
+  802bdd:	85 c0                	test   %eax,%eax
+  802bdf:	0f 88 97 00 00 00    	js     802c7c <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  802be5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802be8:	e8 ac fa ff ff       	call   802699 <pipe_ring>
+  802bed:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  802bf0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802bf3:	e8 a1 fa ff ff       	call   802699 <pipe_ring>
+  802bf8:	83 ec 0c             	sub    $0xc,%esp
+  802bfb:	68 07 04 00 00       	push   $0x407
+  802c00:	53                   	push   %ebx
+  802c01:	6a 00                	push   $0x0
+  802c03:	01 f0                	add    %esi,%eax
+  802c05:	50                   	push   %eax
+  802c06:	6a 00                	push   $0x0
+  802c08:	e8 58 e0 ff ff       	call   800c65 <sys_page_map>
+  802c0d:	89 c3                	mov    %eax,%ebx
+  802c0f:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802c15:	83 c4 20             	add    $0x20,%esp
+  802c18:	85 c0                	test   %eax,%eax
+  802c1a:	78 60                	js     802c7c <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  802c1c:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802c22:	75 9a                	jne    802bbe <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  802c24:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  802c2b:	a1 20 40 80 00       	mov    0x804020,%eax
+  802c30:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802c33:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  802c35:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802c38:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  802c3f:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802c42:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  802c44:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802c47:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  802c4e:	83 ec 0c             	sub    $0xc,%esp
+  802c51:	ff 75 e4             	push   -0x1c(%ebp)
+  802c54:	e8 0f ea ff ff       	call   801668 <fd2num>
+  802c59:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802c5c:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  802c5e:	83 c4 04             	add    $0x4,%esp
+  802c61:	ff 75 e0             	push   -0x20(%ebp)
+  802c64:	e8 ff e9 ff ff       	call   801668 <fd2num>
+  802c69:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802c6c:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  802c6f:	83 c4 10             	add    $0x10,%esp
+  802c72:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c77:	e9 87 00 00 00       	jmp    802d03 <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802c7c:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  802c81:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802c84:	e8 10 fa ff ff       	call   802699 <pipe_ring>
+  802c89:	83 ec 08             	sub    $0x8,%esp
+  802c8c:	01 f0                	add    %esi,%eax
+  802c8e:	50                   	push   %eax
+  802c8f:	6a 00                	push   $0x0
+  802c91:	e8 11 e0 ff ff       	call   800ca7 <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  802c96:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802c99:	e8 fb f9 ff ff       	call   802699 <pipe_ring>
+  802c9e:	83 c4 08             	add    $0x8,%esp
+  802ca1:	01 f0                	add    %esi,%eax
+  802ca3:	50                   	push   %eax
+  802ca4:	6a 00                	push   $0x0
+  802ca6:	e8 fc df ff ff       	call   800ca7 <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802cab:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802cb1:	83 c4 10             	add    $0x10,%esp
+  802cb4:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802cba:	75 c5                	jne    802c81 <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  802cbc:	83 ec 0c             	sub    $0xc,%esp
+  802cbf:	ff 75 e0             	push   -0x20(%ebp)
+  802cc2:	e8 b1 e9 ff ff       	call   801678 <fd2data>
+  802cc7:	83 c4 08             	add    $0x8,%esp
+  802cca:	50                   	push   %eax
+  802ccb:	6a 00                	push   $0x0
+  802ccd:	e8 d5 df ff ff       	call   800ca7 <sys_page_unmap>
+  802cd2:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  802cd5:	83 ec 08             	sub    $0x8,%esp
+  802cd8:	57                   	push   %edi
+  802cd9:	6a 00                	push   $0x0
+  802cdb:	e8 c7 df ff ff       	call   800ca7 <sys_page_unmap>
+  802ce0:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  802ce3:	83 ec 08             	sub    $0x8,%esp
+  802ce6:	ff 75 e0             	push   -0x20(%ebp)
+  802ce9:	6a 00                	push   $0x0
+  802ceb:	e8 b7 df ff ff       	call   800ca7 <sys_page_unmap>
+  802cf0:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  802cf3:	83 ec 08             	sub    $0x8,%esp
+  802cf6:	ff 75 e4             	push   -0x1c(%ebp)
+  802cf9:	6a 00                	push   $0x0
+  802cfb:	e8 a7 df ff ff       	call   800ca7 <sys_page_unmap>
+  802d00:	83 c4 10             	add    $0x10,%esp
+}
+  802d03:	89 d8                	mov    %ebx,%eax
+  802d05:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d08:	5b                   	pop    %ebx
+  802d09:	5e                   	pop    %esi
+  802d0a:	5f                   	pop    %edi
+  802d0b:	5d                   	pop    %ebp
+  802d0c:	c3                   	ret
+
+00802d0d <pipe>:
+{
+  802d0d:	55                   	push   %ebp
+  802d0e:	89 e5                	mov    %esp,%ebp
+  802d10:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  802d13:	6a 00                	push   $0x0
+  802d15:	ff 75 08             	push   0x8(%ebp)
+  802d18:	e8 cc fd ff ff       	call   802ae9 <pipe2>
+}
+  802d1d:	c9                   	leave
+  802d1e:	c3                   	ret
+
+00802d1f <pipeisclosed>:
+{
+  802d1f:	55                   	push   %ebp
+  802d20:	89 e5                	mov    %esp,%ebp
+  802d22:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802d25:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802d28:	50                   	push   %eax
+  802d29:	ff 75 08             	push   0x8(%ebp)
+  802d2c:	e8 b1 e9 ff ff       	call   8016e2 <fd_lookup>
+  802d31:	83 c4 10             	add    $0x10,%esp
+  802d34:	85 c0                	test   %eax,%eax
+  802d36:	78 18                	js     802d50 <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  802d38:	83 ec 0c             	sub    $0xc,%esp
+  802d3b:	ff 75 f4             	push   -0xc(%ebp)
+  802d3e:	e8 35 e9 ff ff       	call   801678 <fd2data>
+  802d43:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  802d45:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802d48:	e8 59 fa ff ff       	call   8027a6 <_pipeisclosed>
+  802d4d:	83 c4 10             	add    $0x10,%esp
+}
+  802d50:	c9                   	leave
+  802d51:	c3                   	ret
+
+00802d52 <pipe_splice>:
+{
+  802d52:	55                   	push   %ebp
+  802d53:	89 e5                	mov    %esp,%ebp
+  802d55:	57                   	push   %edi
+  802d56:	56                   	push   %esi
+  802d57:	53                   	push   %ebx
+  802d58:	83 ec 34             	sub    $0x34,%esp
+  802d5b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802d5e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802d61:	50                   	push   %eax
+  802d62:	ff 75 08             	push   0x8(%ebp)
+  802d65:	e8 78 e9 ff ff       	call   8016e2 <fd_lookup>
+  802d6a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802d6d:	83 c4 10             	add    $0x10,%esp
+  802d70:	85 c0                	test   %eax,%eax
+  802d72:	0f 88 d7 00 00 00    	js     802e4f <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  802d78:	83 ec 0c             	sub    $0xc,%esp
+  802d7b:	ff 75 e4             	push   -0x1c(%ebp)
+  802d7e:	e8 f5 e8 ff ff       	call   801678 <fd2data>
+  802d83:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802d85:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802d88:	83 c4 10             	add    $0x10,%esp
+  802d8b:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802d91:	39 10                	cmp    %edx,(%eax)
+  802d93:	0f 85 c1 00 00 00    	jne    802e5a <pipe_splice+0x108>
+  802d99:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  802d9d:	0f 84 c0 00 00 00    	je     802e63 <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  802da3:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802da7:	0f 84 bf 00 00 00    	je     802e6c <pipe_splice+0x11a>
+  802dad:	89 f7                	mov    %esi,%edi
+  802daf:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  802db5:	0f 85 ba 00 00 00    	jne    802e75 <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802dbb:	8d 43 04             	lea    0x4(%ebx),%eax
+  802dbe:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802dc1:	eb 38                	jmp    802dfb <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802dc3:	83 ec 0c             	sub    $0xc,%esp
+  802dc6:	68 00 10 00 00       	push   $0x1000
+  802dcb:	89 f1                	mov    %esi,%ecx
+  802dcd:	89 da                	mov    %ebx,%edx
+  802dcf:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802dd2:	e8 34 fa ff ff       	call   80280b <devpipe_write_bulk>
+  802dd7:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802dda:	83 c4 10             	add    $0x10,%esp
+  802ddd:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802de2:	75 53                	jne    802e37 <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  802de4:	83 ec 08             	sub    $0x8,%esp
+  802de7:	56                   	push   %esi
+  802de8:	6a 00                	push   $0x0
+  802dea:	e8 b8 de ff ff       	call   800ca7 <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  802def:	83 c7 01             	add    $0x1,%edi
+  802df2:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802df8:	83 c4 10             	add    $0x10,%esp
+  802dfb:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802dfe:	74 3a                	je     802e3a <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  802e00:	8b 03                	mov    (%ebx),%eax
+  802e02:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802e05:	75 bc                	jne    802dc3 <pipe_splice+0x71>
+  802e07:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e0c:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  802e10:	85 c0                	test   %eax,%eax
+  802e12:	74 af                	je     802dc3 <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802e14:	83 ec 04             	sub    $0x4,%esp
+  802e17:	6a 07                	push   $0x7
+  802e19:	56                   	push   %esi
+  802e1a:	ff 75 d0             	push   -0x30(%ebp)
+  802e1d:	e8 5c e1 ff ff       	call   800f7e <sys_chan_wakeup>
+  802e22:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802e25:	83 c4 10             	add    $0x10,%esp
+  802e28:	85 c0                	test   %eax,%eax
+  802e2a:	79 b8                	jns    802de4 <pipe_splice+0x92>
+  802e2c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802e31:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802e35:	eb 8c                	jmp    802dc3 <pipe_splice+0x71>
+  802e37:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  802e3a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802e3e:	75 06                	jne    802e46 <pipe_splice+0xf4>
+  802e40:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802e44:	78 09                	js     802e4f <pipe_splice+0xfd>
+  return i * PGSIZE;
+  802e46:	8b 45 10             	mov    0x10(%ebp),%eax
+  802e49:	c1 e0 0c             	shl    $0xc,%eax
+  802e4c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  802e4f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802e52:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e55:	5b                   	pop    %ebx
+  802e56:	5e                   	pop    %esi
+  802e57:	5f                   	pop    %edi
+  802e58:	5d                   	pop    %ebp
+  802e59:	c3                   	ret
+    return -E_INVAL;
+  802e5a:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802e61:	eb ec                	jmp    802e4f <pipe_splice+0xfd>
+  802e63:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802e6a:	eb e3                	jmp    802e4f <pipe_splice+0xfd>
+  802e6c:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802e73:	eb da                	jmp    802e4f <pipe_splice+0xfd>
+  802e75:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802e7c:	eb d1                	jmp    802e4f <pipe_splice+0xfd>
+
+00802e7e <pipe_splice_read>:
+{
+  802e7e:	55                   	push   %ebp
+  802e7f:	89 e5                	mov    %esp,%ebp
+  802e81:	53                   	push   %ebx
+  802e82:	83 ec 1c             	sub    $0x1c,%esp
+  802e85:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802e88:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802e8b:	50                   	push   %eax
+  802e8c:	ff 75 08             	push   0x8(%ebp)
+  802e8f:	e8 4e e8 ff ff       	call   8016e2 <fd_lookup>
+  802e94:	83 c4 10             	add    $0x10,%esp
+  802e97:	85 c0                	test   %eax,%eax
+  802e99:	78 49                	js     802ee4 <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  802e9b:	83 ec 0c             	sub    $0xc,%esp
+  802e9e:	ff 75 f4             	push   -0xc(%ebp)
+  802ea1:	e8 d2 e7 ff ff       	call   801678 <fd2data>
+  802ea6:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802ea8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802eab:	83 c4 10             	add    $0x10,%esp
+  802eae:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  802eb4:	39 08                	cmp    %ecx,(%eax)
+  802eb6:	75 31                	jne    802ee9 <pipe_splice_read+0x6b>
+  802eb8:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  802ebc:	74 32                	je     802ef0 <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  802ebe:	8b 48 08             	mov    0x8(%eax),%ecx
+  802ec1:	83 e1 03             	and    $0x3,%ecx
+  802ec4:	83 f9 01             	cmp    $0x1,%ecx
+  802ec7:	74 2e                	je     802ef7 <pipe_splice_read+0x79>
+  802ec9:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  802ecf:	75 2d                	jne    802efe <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  802ed1:	83 ec 08             	sub    $0x8,%esp
+  802ed4:	53                   	push   %ebx
+  802ed5:	68 00 10 00 00       	push   $0x1000
+  802eda:	89 d9                	mov    %ebx,%ecx
+  802edc:	e8 93 fa ff ff       	call   802974 <devpipe_read_bulk>
+  802ee1:	83 c4 10             	add    $0x10,%esp
+}
+  802ee4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802ee7:	c9                   	leave
+  802ee8:	c3                   	ret
+    return -E_INVAL;
+  802ee9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802eee:	eb f4                	jmp    802ee4 <pipe_splice_read+0x66>
+  802ef0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ef5:	eb ed                	jmp    802ee4 <pipe_splice_read+0x66>
+  802ef7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802efc:	eb e6                	jmp    802ee4 <pipe_splice_read+0x66>
+  802efe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802f03:	eb df                	jmp    802ee4 <pipe_splice_read+0x66>
+
+00802f05 <mmap_find>:
+          utf->utf_eip, utf->utf_err);
+}
+
+static struct Mmap *
+mmap_find(uintptr_t va)
+{
+  802f05:	55                   	push   %ebp
+  802f06:	89 e5                	mov    %esp,%ebp
+  802f08:	56                   	push   %esi
+  802f09:	53                   	push   %ebx
+  int i;
+
+  for (i = 0; i < NMMAP; i++)
+  802f0a:	ba 60 57 80 00       	mov    $0x805760,%edx
+  802f0f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f14:	eb 0b                	jmp    802f21 <mmap_find+0x1c>
+  802f16:	83 c3 01             	add    $0x1,%ebx
+  802f19:	83 c2 14             	add    $0x14,%edx
+  802f1c:	83 fb 10             	cmp    $0x10,%ebx
+  802f1f:	74 1d                	je     802f3e <mmap_find+0x39>
+    if (mmaps[i].mm_va && va >= mmaps[i].mm_va &&
+  802f21:	8b 0a                	mov    (%edx),%ecx
+  802f23:	39 c8                	cmp    %ecx,%eax
+  802f25:	72 ef                	jb     802f16 <mmap_find+0x11>
+  802f27:	85 c9                	test   %ecx,%ecx
+  802f29:	74 eb                	je     802f16 <mmap_find+0x11>
+        va < mmaps[i].mm_va + mmaps[i].mm_len)
+  802f2b:	03 4a 04             	add    0x4(%edx),%ecx
+    if (mmaps[i].mm_va && va >= mmaps[i].mm_va &&
+  802f2e:	39 c8                	cmp    %ecx,%eax
+  802f30:	73 e4                	jae    802f16 <mmap_find+0x11>
+      return &mmaps[i];
+  802f32:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802f35:	8d 04 85 60 57 80 00 	lea    0x805760(,%eax,4),%eax
+  802f3c:	eb 05                	jmp    802f43 <mmap_find+0x3e>
+  return NULL;
+  802f3e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802f43:	5b                   	pop    %ebx
+  802f44:	5e                   	pop    %esi
+  802f45:	5d                   	pop    %ebp
+  802f46:	c3                   	ret
+
+00802f47 <va_mapped>:
+
+static bool
+va_mapped(uintptr_t va)
+{
+  return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+  802f47:	89 c2                	mov    %eax,%edx
+  802f49:	c1 ea 16             	shr    $0x16,%edx
+  802f4c:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802f53:	f6 c2 01             	test   $0x1,%dl
+  802f56:	74 11                	je     802f69 <va_mapped+0x22>
+  802f58:	c1 e8 0c             	shr    $0xc,%eax
+  802f5b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802f62:	83 e0 01             	and    $0x1,%eax
+  802f65:	83 e0 01             	and    $0x1,%eax
+}
+  802f68:	c3                   	ret
+  return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+  802f69:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f6e:	eb f5                	jmp    802f65 <va_mapped+0x1e>
+
+00802f70 <mmap_copy>:
+
+// Replace the page at 'va' with a copy of its first 'n' bytes, the rest
+// zeroed, mapped with 'perm'.
+static void
+mmap_copy(uintptr_t va, size_t n, int perm)
+{
+  802f70:	55                   	push   %ebp
+  802f71:	89 e5                	mov    %esp,%ebp
+  802f73:	57                   	push   %edi
+  802f74:	56                   	push   %esi
+  802f75:	53                   	push   %ebx
+  802f76:	83 ec 10             	sub    $0x10,%esp
+  802f79:	89 c3                	mov    %eax,%ebx
+  802f7b:	89 d7                	mov    %edx,%edi
+  802f7d:	89 ce                	mov    %ecx,%esi
+  int r;
+
+  if ((r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  802f7f:	6a 07                	push   $0x7
+  802f81:	68 00 f0 7f 00       	push   $0x7ff000
+  802f86:	6a 00                	push   $0x0
+  802f88:	e8 95 dc ff ff       	call   800c22 <sys_page_alloc>
+  802f8d:	83 c4 10             	add    $0x10,%esp
+  802f90:	85 c0                	test   %eax,%eax
+  802f92:	78 46                	js     802fda <mmap_copy+0x6a>
+    panic("mmap: %e", r);
+  memmove(PFTEMP, (void *) va, n);
+  802f94:	83 ec 04             	sub    $0x4,%esp
+  802f97:	57                   	push   %edi
+  802f98:	53                   	push   %ebx
+  802f99:	68 00 f0 7f 00       	push   $0x7ff000
+  802f9e:	e8 d6 d9 ff ff       	call   800979 <memmove>
+  if ((r = sys_page_map(0, PFTEMP, 0, (void *) va, perm)) < 0 ||
+  802fa3:	89 34 24             	mov    %esi,(%esp)
+  802fa6:	53                   	push   %ebx
+  802fa7:	6a 00                	push   $0x0
+  802fa9:	68 00 f0 7f 00       	push   $0x7ff000
+  802fae:	6a 00                	push   $0x0
+  802fb0:	e8 b0 dc ff ff       	call   800c65 <sys_page_map>
+  802fb5:	83 c4 20             	add    $0x20,%esp
+  802fb8:	85 c0                	test   %eax,%eax
+  802fba:	78 30                	js     802fec <mmap_copy+0x7c>
+      (r = sys_page_unmap(0, PFTEMP)) < 0)
+  802fbc:	83 ec 08             	sub    $0x8,%esp
+  802fbf:	68 00 f0 7f 00       	push   $0x7ff000
+  802fc4:	6a 00                	push   $0x0
+  802fc6:	e8 dc dc ff ff       	call   800ca7 <sys_page_unmap>
+  if ((r = sys_page_map(0, PFTEMP, 0, (void *) va, perm)) < 0 ||
+  802fcb:	83 c4 10             	add    $0x10,%esp
+  802fce:	85 c0                	test   %eax,%eax
+  802fd0:	78 1a                	js     802fec <mmap_copy+0x7c>
+    panic("mmap: %e", r);
+}
+  802fd2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fd5:	5b                   	pop    %ebx
+  802fd6:	5e                   	pop    %esi
+  802fd7:	5f                   	pop    %edi
+  802fd8:	5d                   	pop    %ebp
+  802fd9:	c3                   	ret
+    panic("mmap: %e", r);
+  802fda:	50                   	push   %eax
+  802fdb:	68 6b 3f 80 00       	push   $0x803f6b
+  802fe0:	6a 3e                	push   $0x3e
+  802fe2:	68 74 3f 80 00       	push   $0x803f74
+  802fe7:	e8 a1 06 00 00       	call   80368d <_panic>
+    panic("mmap: %e", r);
+  802fec:	50                   	push   %eax
+  802fed:	68 6b 3f 80 00       	push   $0x803f6b
+  802ff2:	6a 42                	push   $0x42
+  802ff4:	68 74 3f 80 00       	push   $0x803f74
+  802ff9:	e8 8f 06 00 00       	call   80368d <_panic>
+
+00802ffe <mmap_fault>:
+// Handle a page fault in a mapping, if it is one.  Returns 1 if it was.
+// The fork page fault handlers call this first, so that mappings keep
+// working after a fork.
+bool
+mmap_fault(struct UTrapframe *utf)
+{
+  802ffe:	55                   	push   %ebp
+  802fff:	89 e5                	mov    %esp,%ebp
+  803001:	57                   	push   %edi
+  803002:	56                   	push   %esi
+  803003:	53                   	push   %ebx
+  803004:	83 ec 1c             	sub    $0x1c,%esp
+  803007:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Fsreq_read_map saved;
+  struct Mmap *m;
+  uintptr_t va;
+  int perm, r;
+
+  va = ROUNDDOWN(utf->utf_fault_va, PGSIZE);
+  80300a:	8b 1f                	mov    (%edi),%ebx
+  80300c:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if (va < MMAPBASE || va >= MMAPTOP || (m = mmap_find(va)) == NULL)
+  803012:	8d 83 00 00 00 60    	lea    0x60000000(%ebx),%eax
+  803018:	3d ff ff ff 2f       	cmp    $0x2fffffff,%eax
+  80301d:	0f 87 24 01 00 00    	ja     803147 <mmap_fault+0x149>
+  803023:	89 d8                	mov    %ebx,%eax
+  803025:	e8 db fe ff ff       	call   802f05 <mmap_find>
+  80302a:	89 c6                	mov    %eax,%esi
+  80302c:	85 c0                	test   %eax,%eax
+  80302e:	0f 84 20 01 00 00    	je     803154 <mmap_fault+0x156>
+    return 0;
+  if ((utf->utf_err & FEC_WR) && m->mm_perm == MAP_RDONLY)
+  803034:	f6 47 04 02          	testb  $0x2,0x4(%edi)
+  803038:	74 13                	je     80304d <mmap_fault+0x4f>
+  80303a:	83 78 10 00          	cmpl   $0x0,0x10(%eax)
+  80303e:	0f 84 17 01 00 00    	je     80315b <mmap_fault+0x15d>
+    return 0;
+  perm = PTE_P | PTE_U | (m->mm_perm == MAP_RDONLY ? 0 : PTE_W);
+  803044:	c7 45 e4 07 00 00 00 	movl   $0x7,-0x1c(%ebp)
+  80304b:	eb 0f                	jmp    80305c <mmap_fault+0x5e>
+  80304d:	83 78 10 01          	cmpl   $0x1,0x10(%eax)
+  803051:	19 c0                	sbb    %eax,%eax
+  803053:	83 e0 fe             	and    $0xfffffffe,%eax
+  803056:	83 c0 07             	add    $0x7,%eax
+  803059:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+
+  if (!va_mapped(va)) {
+  80305c:	89 d8                	mov    %ebx,%eax
+  80305e:	e8 e4 fe ff ff       	call   802f47 <va_mapped>
+  803063:	84 c0                	test   %al,%al
+  803065:	74 42                	je     8030a9 <mmap_fault+0xab>
+    }
+  }
+
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+    mmap_copy(va, PGSIZE, perm);
+  return 1;
+  803067:	b8 01 00 00 00       	mov    $0x1,%eax
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+  80306c:	f6 47 04 02          	testb  $0x2,0x4(%edi)
+  803070:	0f 84 d6 00 00 00    	je     80314c <mmap_fault+0x14e>
+  803076:	89 d8                	mov    %ebx,%eax
+  803078:	c1 e8 0c             	shr    $0xc,%eax
+  80307b:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  return 1;
+  803082:	b8 01 00 00 00       	mov    $0x1,%eax
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+  803087:	f6 c2 02             	test   $0x2,%dl
+  80308a:	0f 85 bc 00 00 00    	jne    80314c <mmap_fault+0x14e>
+    mmap_copy(va, PGSIZE, perm);
+  803090:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803093:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803098:	89 d8                	mov    %ebx,%eax
+  80309a:	e8 d1 fe ff ff       	call   802f70 <mmap_copy>
+  return 1;
+  80309f:	b8 01 00 00 00       	mov    $0x1,%eax
+  8030a4:	e9 a3 00 00 00       	jmp    80314c <mmap_fault+0x14e>
+    saved = fsipcbuf.read_map;
+  8030a9:	a1 00 60 80 00       	mov    0x806000,%eax
+  8030ae:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8030b1:	8b 15 04 60 80 00    	mov    0x806004,%edx
+  8030b7:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    r = read_map(m->mm_fd, m->mm_offset + (va - m->mm_va), (void *) va);
+  8030ba:	83 ec 04             	sub    $0x4,%esp
+  8030bd:	53                   	push   %ebx
+  8030be:	89 d8                	mov    %ebx,%eax
+  8030c0:	03 46 0c             	add    0xc(%esi),%eax
+  8030c3:	2b 06                	sub    (%esi),%eax
+  8030c5:	50                   	push   %eax
+  8030c6:	ff 76 08             	push   0x8(%esi)
+  8030c9:	e8 86 f3 ff ff       	call   802454 <read_map>
+    fsipcbuf.read_map = saved;
+  8030ce:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8030d1:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+  8030d7:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  8030da:	89 15 04 60 80 00    	mov    %edx,0x806004
+    if (r < 0)
+  8030e0:	83 c4 10             	add    $0x10,%esp
+  8030e3:	85 c0                	test   %eax,%eax
+  8030e5:	78 20                	js     803107 <mmap_fault+0x109>
+    if (r == 0) {
+  8030e7:	74 30                	je     803119 <mmap_fault+0x11b>
+    if (r < PGSIZE) {
+  8030e9:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  8030ee:	0f 8f 73 ff ff ff    	jg     803067 <mmap_fault+0x69>
+      mmap_copy(va, r, perm);
+  8030f4:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8030f7:	89 c2                	mov    %eax,%edx
+  8030f9:	89 d8                	mov    %ebx,%eax
+  8030fb:	e8 70 fe ff ff       	call   802f70 <mmap_copy>
+      return 1;
+  803100:	b8 01 00 00 00       	mov    $0x1,%eax
+  803105:	eb 45                	jmp    80314c <mmap_fault+0x14e>
+      panic("mmap: read_map: %e", r);
+  803107:	50                   	push   %eax
+  803108:	68 7f 3f 80 00       	push   $0x803f7f
+  80310d:	6a 5f                	push   $0x5f
+  80310f:	68 74 3f 80 00       	push   $0x803f74
+  803114:	e8 74 05 00 00       	call   80368d <_panic>
+      if ((r = sys_page_alloc(0, (void *) va, perm)) < 0)
+  803119:	83 ec 04             	sub    $0x4,%esp
+  80311c:	ff 75 e4             	push   -0x1c(%ebp)
+  80311f:	53                   	push   %ebx
+  803120:	6a 00                	push   $0x0
+  803122:	e8 fb da ff ff       	call   800c22 <sys_page_alloc>
+  803127:	83 c4 10             	add    $0x10,%esp
+  80312a:	85 c0                	test   %eax,%eax
+  80312c:	78 07                	js     803135 <mmap_fault+0x137>
+      return 1;
+  80312e:	b8 01 00 00 00       	mov    $0x1,%eax
+  803133:	eb 17                	jmp    80314c <mmap_fault+0x14e>
+        panic("mmap: %e", r);
+  803135:	50                   	push   %eax
+  803136:	68 6b 3f 80 00       	push   $0x803f6b
+  80313b:	6a 64                	push   $0x64
+  80313d:	68 74 3f 80 00       	push   $0x803f74
+  803142:	e8 46 05 00 00       	call   80368d <_panic>
+    return 0;
+  803147:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80314c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80314f:	5b                   	pop    %ebx
+  803150:	5e                   	pop    %esi
+  803151:	5f                   	pop    %edi
+  803152:	5d                   	pop    %ebp
+  803153:	c3                   	ret
+    return 0;
+  803154:	b8 00 00 00 00       	mov    $0x0,%eax
+  803159:	eb f1                	jmp    80314c <mmap_fault+0x14e>
+    return 0;
+  80315b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803160:	eb ea                	jmp    80314c <mmap_fault+0x14e>
+
+00803162 <mmap_pgfault>:
+{
+  803162:	55                   	push   %ebp
+  803163:	89 e5                	mov    %esp,%ebp
+  803165:	53                   	push   %ebx
+  803166:	83 ec 10             	sub    $0x10,%esp
+  803169:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (!mmap_fault(utf))
+  80316c:	53                   	push   %ebx
+  80316d:	e8 8c fe ff ff       	call   802ffe <mmap_fault>
+  803172:	83 c4 10             	add    $0x10,%esp
+  803175:	84 c0                	test   %al,%al
+  803177:	74 05                	je     80317e <mmap_pgfault+0x1c>
+}
+  803179:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80317c:	c9                   	leave
+  80317d:	c3                   	ret
+    panic("page fault at %08x, eip %08x, err %04x", utf->utf_fault_va,
+  80317e:	83 ec 08             	sub    $0x8,%esp
+  803181:	ff 73 04             	push   0x4(%ebx)
+  803184:	ff 73 28             	push   0x28(%ebx)
+  803187:	ff 33                	push   (%ebx)
+  803189:	68 94 3f 80 00       	push   $0x803f94
+  80318e:	6a 20                	push   $0x20
+  803190:	68 74 3f 80 00       	push   $0x803f74
+  803195:	e8 f3 04 00 00       	call   80368d <_panic>
+
+0080319a <mmap>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_INVAL if offset isn't aligned, len is 0, or perm is unknown
+//	-E_NO_MEM if there's no free slot or address space for it
+int
+mmap(int fdnum, off_t offset, size_t len, int perm, void **addr)
+{
+  80319a:	55                   	push   %ebp
+  80319b:	89 e5                	mov    %esp,%ebp
+  80319d:	57                   	push   %edi
+  80319e:	56                   	push   %esi
+  80319f:	53                   	push   %ebx
+  8031a0:	83 ec 44             	sub    $0x44,%esp
+  8031a3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  struct Fd *fd;
+  uintptr_t va;
+  int i, j, r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8031a6:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8031a9:	50                   	push   %eax
+  8031aa:	ff 75 08             	push   0x8(%ebp)
+  8031ad:	e8 30 e5 ff ff       	call   8016e2 <fd_lookup>
+  8031b2:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8031b5:	83 c4 10             	add    $0x10,%esp
+  8031b8:	85 c0                	test   %eax,%eax
+  8031ba:	0f 88 3e 01 00 00    	js     8032fe <mmap+0x164>
+    return r;
+  if (offset < 0 || PGOFF(offset) || len == 0 ||
+  8031c0:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8031c4:	0f 88 d1 00 00 00    	js     80329b <mmap+0x101>
+  8031ca:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8031cd:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8031d2:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8031d5:	0f 85 c9 00 00 00    	jne    8032a4 <mmap+0x10a>
+  8031db:	85 db                	test   %ebx,%ebx
+  8031dd:	0f 84 ca 00 00 00    	je     8032ad <mmap+0x113>
+  8031e3:	83 7d 14 02          	cmpl   $0x2,0x14(%ebp)
+  8031e7:	0f 87 c0 00 00 00    	ja     8032ad <mmap+0x113>
+      (perm != MAP_RDONLY && perm != MAP_PRIVATE && perm != MAP_SHARED))
+    return -E_INVAL;
+  len = ROUNDUP(len, PGSIZE);
+  8031ed:	81 c3 ff 0f 00 00    	add    $0xfff,%ebx
+  8031f3:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  8031f9:	89 d9                	mov    %ebx,%ecx
+  8031fb:	89 5d c4             	mov    %ebx,-0x3c(%ebp)
+
+  // First fit: try the start of the region and the end of each
+  // mapping.
+  for (i = -1; i < NMMAP; i++) {
+  8031fe:	bb 4c 57 80 00       	mov    $0x80574c,%ebx
+  803203:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+    if (i >= 0 && !mmaps[i].mm_va)
+      continue;
+    va = i < 0 ? MMAPBASE : mmaps[i].mm_va + mmaps[i].mm_len;
+  803208:	bf 00 00 00 a0       	mov    $0xa0000000,%edi
+  80320d:	eb 53                	jmp    803262 <mmap+0xc8>
+  80320f:	bf 00 00 00 a0       	mov    $0xa0000000,%edi
+  803214:	eb 4c                	jmp    803262 <mmap+0xc8>
+    if (len > MMAPTOP - va)
+      continue;
+    for (j = 0; j < NMMAP; j++)
+  803216:	83 c0 01             	add    $0x1,%eax
+  803219:	83 f8 10             	cmp    $0x10,%eax
+  80321c:	0f 84 e7 00 00 00    	je     803309 <mmap+0x16f>
+      if (mmaps[j].mm_va && va < mmaps[j].mm_va + mmaps[j].mm_len &&
+  803222:	8d 34 80             	lea    (%eax,%eax,4),%esi
+  803225:	8b 14 b5 60 57 80 00 	mov    0x805760(,%esi,4),%edx
+  80322c:	85 d2                	test   %edx,%edx
+  80322e:	74 e6                	je     803216 <mmap+0x7c>
+  803230:	89 d1                	mov    %edx,%ecx
+  803232:	03 0c b5 64 57 80 00 	add    0x805764(,%esi,4),%ecx
+  803239:	39 cf                	cmp    %ecx,%edi
+  80323b:	73 d9                	jae    803216 <mmap+0x7c>
+  80323d:	39 da                	cmp    %ebx,%edx
+  80323f:	73 d5                	jae    803216 <mmap+0x7c>
+  803241:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  803244:	8b 55 cc             	mov    -0x34(%ebp),%edx
+  803247:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  for (i = -1; i < NMMAP; i++) {
+  80324a:	83 c2 01             	add    $0x1,%edx
+  80324d:	83 c3 14             	add    $0x14,%ebx
+  803250:	83 fa 10             	cmp    $0x10,%edx
+  803253:	74 2b                	je     803280 <mmap+0xe6>
+    if (i >= 0 && !mmaps[i].mm_va)
+  803255:	85 d2                	test   %edx,%edx
+  803257:	78 b6                	js     80320f <mmap+0x75>
+  803259:	8b 3b                	mov    (%ebx),%edi
+  80325b:	85 ff                	test   %edi,%edi
+  80325d:	74 eb                	je     80324a <mmap+0xb0>
+    va = i < 0 ? MMAPBASE : mmaps[i].mm_va + mmaps[i].mm_len;
+  80325f:	03 7b 04             	add    0x4(%ebx),%edi
+    if (len > MMAPTOP - va)
+  803262:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  803267:	29 f8                	sub    %edi,%eax
+  803269:	39 c8                	cmp    %ecx,%eax
+  80326b:	72 dd                	jb     80324a <mmap+0xb0>
+    for (j = 0; j < NMMAP; j++)
+  80326d:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+          mmaps[j].mm_va < va + len)
+  803270:	8d 34 0f             	lea    (%edi,%ecx,1),%esi
+  803273:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  803276:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  803279:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+  80327c:	89 f3                	mov    %esi,%ebx
+  80327e:	eb a2                	jmp    803222 <mmap+0x88>
+        break;
+    if (j == NMMAP)
+      break;
+  }
+  if (i == NMMAP)
+    return -E_NO_MEM;
+  803280:	c7 45 d4 fc ff ff ff 	movl   $0xfffffffc,-0x2c(%ebp)
+  803287:	eb 75                	jmp    8032fe <mmap+0x164>
+    ;
+  if (j == NMMAP)
+    return -E_NO_MEM;
+
+  if (_pgfault_handler == 0)
+    set_pgfault_handler(mmap_pgfault);
+  803289:	83 ec 0c             	sub    $0xc,%esp
+  80328c:	68 62 31 80 00       	push   $0x803162
+  803291:	e8 3d 04 00 00       	call   8036d3 <set_pgfault_handler>
+  803296:	83 c4 10             	add    $0x10,%esp
+  803299:	eb 24                	jmp    8032bf <mmap+0x125>
+    return -E_INVAL;
+  80329b:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  8032a2:	eb 5a                	jmp    8032fe <mmap+0x164>
+  8032a4:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  8032ab:	eb 51                	jmp    8032fe <mmap+0x164>
+  8032ad:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  8032b4:	eb 48                	jmp    8032fe <mmap+0x164>
+  if (_pgfault_handler == 0)
+  8032b6:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  8032bd:	74 ca                	je     803289 <mmap+0xef>
+
+  mmaps[j].mm_va = va;
+  8032bf:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  8032c6:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  8032c9:	c1 e2 02             	shl    $0x2,%edx
+  8032cc:	89 ba 60 57 80 00    	mov    %edi,0x805760(%edx)
+  mmaps[j].mm_len = len;
+  8032d2:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  8032d5:	89 b2 64 57 80 00    	mov    %esi,0x805764(%edx)
+  mmaps[j].mm_fd = fdnum;
+  8032db:	8b 75 08             	mov    0x8(%ebp),%esi
+  8032de:	89 b2 68 57 80 00    	mov    %esi,0x805768(%edx)
+  mmaps[j].mm_offset = offset;
+  8032e4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8032e7:	89 b2 6c 57 80 00    	mov    %esi,0x80576c(%edx)
+  mmaps[j].mm_perm = perm;
+  8032ed:	01 d8                	add    %ebx,%eax
+  8032ef:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  8032f2:	89 1c 85 70 57 80 00 	mov    %ebx,0x805770(,%eax,4)
+  *addr = (void *) va;
+  8032f9:	8b 45 18             	mov    0x18(%ebp),%eax
+  8032fc:	89 38                	mov    %edi,(%eax)
+  return 0;
+}
+  8032fe:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  803301:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803304:	5b                   	pop    %ebx
+  803305:	5e                   	pop    %esi
+  803306:	5f                   	pop    %edi
+  803307:	5d                   	pop    %ebp
+  803308:	c3                   	ret
+  if (i == NMMAP)
+  803309:	b8 60 57 80 00       	mov    $0x805760,%eax
+  for (j = 0; j < NMMAP && mmaps[j].mm_va; j++)
+  80330e:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+  803311:	83 c0 14             	add    $0x14,%eax
+  803314:	83 78 ec 00          	cmpl   $0x0,-0x14(%eax)
+  803318:	74 9c                	je     8032b6 <mmap+0x11c>
+  80331a:	83 c3 01             	add    $0x1,%ebx
+  80331d:	83 fb 10             	cmp    $0x10,%ebx
+  803320:	75 ef                	jne    803311 <mmap+0x177>
+    return -E_NO_MEM;
+  803322:	c7 45 d4 fc ff ff ff 	movl   $0xfffffffc,-0x2c(%ebp)
+  803329:	eb d3                	jmp    8032fe <mmap+0x164>
+
+0080332b <msync>:
+// nothing for other kinds of mapping.
+//
+// Returns 0 on success, < 0 on error.
+int
+msync(void *addr)
+{
+  80332b:	55                   	push   %ebp
+  80332c:	89 e5                	mov    %esp,%ebp
+  80332e:	57                   	push   %edi
+  80332f:	56                   	push   %esi
+  803330:	53                   	push   %ebx
+  803331:	81 ec ac 00 00 00    	sub    $0xac,%esp
+  struct Stat st;
+  off_t saved, off;
+  uintptr_t va;
+  int n, r;
+
+  if ((m = mmap_find((uintptr_t) addr)) == NULL)
+  803337:	8b 45 08             	mov    0x8(%ebp),%eax
+  80333a:	e8 c6 fb ff ff       	call   802f05 <mmap_find>
+  80333f:	85 c0                	test   %eax,%eax
+  803341:	0f 84 58 01 00 00    	je     80349f <msync+0x174>
+  803347:	89 c7                	mov    %eax,%edi
+    return -E_INVAL;
+  if (m->mm_perm != MAP_SHARED)
+    return 0;
+  803349:	bb 00 00 00 00       	mov    $0x0,%ebx
+  if (m->mm_perm != MAP_SHARED)
+  80334e:	83 78 10 02          	cmpl   $0x2,0x10(%eax)
+  803352:	74 0a                	je     80335e <msync+0x33>
+                          PTE_P | PTE_U | PTE_W)) < 0)
+      break;
+  }
+  fd->fd_offset = saved;
+  return r < 0 ? r : 0;
+}
+  803354:	89 d8                	mov    %ebx,%eax
+  803356:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803359:	5b                   	pop    %ebx
+  80335a:	5e                   	pop    %esi
+  80335b:	5f                   	pop    %edi
+  80335c:	5d                   	pop    %ebp
+  80335d:	c3                   	ret
+  if ((r = fd_lookup(m->mm_fd, &fd)) < 0 || (r = fstat(m->mm_fd, &st)) < 0)
+  80335e:	83 ec 08             	sub    $0x8,%esp
+  803361:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  803364:	50                   	push   %eax
+  803365:	ff 77 08             	push   0x8(%edi)
+  803368:	e8 75 e3 ff ff       	call   8016e2 <fd_lookup>
+  80336d:	89 c3                	mov    %eax,%ebx
+  80336f:	83 c4 10             	add    $0x10,%esp
+  803372:	85 c0                	test   %eax,%eax
+  803374:	78 de                	js     803354 <msync+0x29>
+  803376:	83 ec 08             	sub    $0x8,%esp
+  803379:	8d 85 58 ff ff ff    	lea    -0xa8(%ebp),%eax
+  80337f:	50                   	push   %eax
+  803380:	ff 77 08             	push   0x8(%edi)
+  803383:	e8 fd e7 ff ff       	call   801b85 <fstat>
+  803388:	89 c3                	mov    %eax,%ebx
+  80338a:	83 c4 10             	add    $0x10,%esp
+  80338d:	85 c0                	test   %eax,%eax
+  80338f:	78 c3                	js     803354 <msync+0x29>
+  saved = fd->fd_offset;
+  803391:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803394:	8b 40 04             	mov    0x4(%eax),%eax
+  803397:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%ebp)
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE) {
+  80339d:	8b 37                	mov    (%edi),%esi
+  80339f:	eb 29                	jmp    8033ca <msync+0x9f>
+    if ((r = sys_page_map(0, (void *) va, 0, (void *) va,
+  8033a1:	83 ec 0c             	sub    $0xc,%esp
+  8033a4:	6a 07                	push   $0x7
+  8033a6:	8b 85 50 ff ff ff    	mov    -0xb0(%ebp),%eax
+  8033ac:	50                   	push   %eax
+  8033ad:	6a 00                	push   $0x0
+  8033af:	50                   	push   %eax
+  8033b0:	6a 00                	push   $0x0
+  8033b2:	e8 ae d8 ff ff       	call   800c65 <sys_page_map>
+  8033b7:	89 c3                	mov    %eax,%ebx
+  8033b9:	83 c4 20             	add    $0x20,%esp
+  8033bc:	85 c0                	test   %eax,%eax
+  8033be:	0f 88 c0 00 00 00    	js     803484 <msync+0x159>
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE) {
+  8033c4:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8033ca:	8b 07                	mov    (%edi),%eax
+  8033cc:	89 85 54 ff ff ff    	mov    %eax,-0xac(%ebp)
+  8033d2:	03 47 04             	add    0x4(%edi),%eax
+  8033d5:	39 c6                	cmp    %eax,%esi
+  8033d7:	0f 83 a7 00 00 00    	jae    803484 <msync+0x159>
+    if (!va_mapped(va) || !(uvpt[PGNUM(va)] & PTE_D))
+  8033dd:	89 f0                	mov    %esi,%eax
+  8033df:	e8 63 fb ff ff       	call   802f47 <va_mapped>
+  8033e4:	84 c0                	test   %al,%al
+  8033e6:	74 dc                	je     8033c4 <msync+0x99>
+  8033e8:	89 f0                	mov    %esi,%eax
+  8033ea:	c1 e8 0c             	shr    $0xc,%eax
+  8033ed:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8033f4:	a8 40                	test   $0x40,%al
+  8033f6:	74 cc                	je     8033c4 <msync+0x99>
+    off = m->mm_offset + (va - m->mm_va);
+  8033f8:	8b 47 0c             	mov    0xc(%edi),%eax
+  8033fb:	8b 8d 54 ff ff ff    	mov    -0xac(%ebp),%ecx
+  803401:	29 c8                	sub    %ecx,%eax
+  803403:	01 f0                	add    %esi,%eax
+    if (off >= st.st_size)
+  803405:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  803408:	39 c2                	cmp    %eax,%edx
+  80340a:	7e 78                	jle    803484 <msync+0x159>
+    n = MIN(PGSIZE, st.st_size - off);
+  80340c:	29 c2                	sub    %eax,%edx
+  80340e:	89 d1                	mov    %edx,%ecx
+  803410:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803415:	39 d1                	cmp    %edx,%ecx
+  803417:	0f 4e d1             	cmovle %ecx,%edx
+  80341a:	89 95 54 ff ff ff    	mov    %edx,-0xac(%ebp)
+    if ((r = seek(m->mm_fd, off)) < 0 ||
+  803420:	83 ec 08             	sub    $0x8,%esp
+  803423:	50                   	push   %eax
+  803424:	ff 77 08             	push   0x8(%edi)
+  803427:	e8 b1 e6 ff ff       	call   801add <seek>
+  80342c:	89 c3                	mov    %eax,%ebx
+  80342e:	83 c4 10             	add    $0x10,%esp
+  803431:	85 c0                	test   %eax,%eax
+  803433:	78 4f                	js     803484 <msync+0x159>
+        (r = write(m->mm_fd, (void *) va, n)) < 0)
+  803435:	89 b5 50 ff ff ff    	mov    %esi,-0xb0(%ebp)
+  80343b:	83 ec 04             	sub    $0x4,%esp
+  80343e:	ff b5 54 ff ff ff    	push   -0xac(%ebp)
+  803444:	56                   	push   %esi
+  803445:	ff 77 08             	push   0x8(%edi)
+  803448:	e8 0e e6 ff ff       	call   801a5b <write>
+  80344d:	89 c3                	mov    %eax,%ebx
+    if ((r = seek(m->mm_fd, off)) < 0 ||
+  80344f:	83 c4 10             	add    $0x10,%esp
+  803452:	85 c0                	test   %eax,%eax
+  803454:	78 2e                	js     803484 <msync+0x159>
+    if (r < n && (r = write(m->mm_fd, (char *) va + r, n - r)) < 0)
+  803456:	8b 95 54 ff ff ff    	mov    -0xac(%ebp),%edx
+  80345c:	39 c2                	cmp    %eax,%edx
+  80345e:	0f 8e 3d ff ff ff    	jle    8033a1 <msync+0x76>
+  803464:	89 d0                	mov    %edx,%eax
+  803466:	29 d8                	sub    %ebx,%eax
+  803468:	01 f3                	add    %esi,%ebx
+  80346a:	83 ec 04             	sub    $0x4,%esp
+  80346d:	50                   	push   %eax
+  80346e:	53                   	push   %ebx
+  80346f:	ff 77 08             	push   0x8(%edi)
+  803472:	e8 e4 e5 ff ff       	call   801a5b <write>
+  803477:	89 c3                	mov    %eax,%ebx
+  803479:	83 c4 10             	add    $0x10,%esp
+  80347c:	85 c0                	test   %eax,%eax
+  80347e:	0f 89 1d ff ff ff    	jns    8033a1 <msync+0x76>
+  fd->fd_offset = saved;
+  803484:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803487:	8b 8d 4c ff ff ff    	mov    -0xb4(%ebp),%ecx
+  80348d:	89 48 04             	mov    %ecx,0x4(%eax)
+  return r < 0 ? r : 0;
+  803490:	85 db                	test   %ebx,%ebx
+  803492:	b8 00 00 00 00       	mov    $0x0,%eax
+  803497:	0f 4f d8             	cmovg  %eax,%ebx
+  80349a:	e9 b5 fe ff ff       	jmp    803354 <msync+0x29>
+    return -E_INVAL;
+  80349f:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8034a4:	e9 ab fe ff ff       	jmp    803354 <msync+0x29>
+
+008034a9 <munmap>:
+// Remove the mapping at 'addr', writing a MAP_SHARED one back first.
+//
+// Returns 0 on success, < 0 on error.
+int
+munmap(void *addr)
+{
+  8034a9:	55                   	push   %ebp
+  8034aa:	89 e5                	mov    %esp,%ebp
+  8034ac:	56                   	push   %esi
+  8034ad:	53                   	push   %ebx
+  8034ae:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct Mmap *m;
+  uintptr_t va;
+  int r;
+
+  if ((m = mmap_find((uintptr_t) addr)) == NULL)
+  8034b1:	89 d8                	mov    %ebx,%eax
+  8034b3:	e8 4d fa ff ff       	call   802f05 <mmap_find>
+  8034b8:	85 c0                	test   %eax,%eax
+  8034ba:	74 56                	je     803512 <munmap+0x69>
+  8034bc:	89 c6                	mov    %eax,%esi
+    return -E_INVAL;
+  if ((r = msync(addr)) < 0)
+  8034be:	83 ec 0c             	sub    $0xc,%esp
+  8034c1:	53                   	push   %ebx
+  8034c2:	e8 64 fe ff ff       	call   80332b <msync>
+  8034c7:	83 c4 10             	add    $0x10,%esp
+  8034ca:	85 c0                	test   %eax,%eax
+  8034cc:	78 3d                	js     80350b <munmap+0x62>
+    return r;
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE)
+  8034ce:	8b 1e                	mov    (%esi),%ebx
+  8034d0:	eb 06                	jmp    8034d8 <munmap+0x2f>
+  8034d2:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8034d8:	8b 46 04             	mov    0x4(%esi),%eax
+  8034db:	03 06                	add    (%esi),%eax
+  8034dd:	39 c3                	cmp    %eax,%ebx
+  8034df:	73 1f                	jae    803500 <munmap+0x57>
+    if (va_mapped(va) && (r = sys_page_unmap(0, (void *) va)) < 0)
+  8034e1:	89 d8                	mov    %ebx,%eax
+  8034e3:	e8 5f fa ff ff       	call   802f47 <va_mapped>
+  8034e8:	84 c0                	test   %al,%al
+  8034ea:	74 e6                	je     8034d2 <munmap+0x29>
+  8034ec:	83 ec 08             	sub    $0x8,%esp
+  8034ef:	53                   	push   %ebx
+  8034f0:	6a 00                	push   $0x0
+  8034f2:	e8 b0 d7 ff ff       	call   800ca7 <sys_page_unmap>
+  8034f7:	83 c4 10             	add    $0x10,%esp
+  8034fa:	85 c0                	test   %eax,%eax
+  8034fc:	79 d4                	jns    8034d2 <munmap+0x29>
+  8034fe:	eb 0b                	jmp    80350b <munmap+0x62>
+      return r;
+  m->mm_va = 0;
+  803500:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  return 0;
+  803506:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80350b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80350e:	5b                   	pop    %ebx
+  80350f:	5e                   	pop    %esi
+  803510:	5d                   	pop    %ebp
+  803511:	c3                   	ret
+    return -E_INVAL;
+  803512:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803517:	eb f2                	jmp    80350b <munmap+0x62>
+
+00803519 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  803519:	b8 00 00 00 00       	mov    $0x0,%eax
+  80351e:	c3                   	ret
+
+0080351f <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80351f:	55                   	push   %ebp
+  803520:	89 e5                	mov    %esp,%ebp
+  803522:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  803525:	68 bb 3f 80 00       	push   $0x803fbb
+  80352a:	ff 75 0c             	push   0xc(%ebp)
+  80352d:	e8 c1 d2 ff ff       	call   8007f3 <strcpy>
+  return 0;
+}
+  803532:	b8 00 00 00 00       	mov    $0x0,%eax
+  803537:	c9                   	leave
+  803538:	c3                   	ret
+
+00803539 <devcons_write>:
+{
+  803539:	55                   	push   %ebp
+  80353a:	89 e5                	mov    %esp,%ebp
+  80353c:	57                   	push   %edi
+  80353d:	56                   	push   %esi
+  80353e:	53                   	push   %ebx
+  80353f:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  803545:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  80354a:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  803550:	eb 2e                	jmp    803580 <devcons_write+0x47>
+    m = n - tot;
+  803552:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803555:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  803557:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80355c:	39 c3                	cmp    %eax,%ebx
+  80355e:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  803561:	83 ec 04             	sub    $0x4,%esp
+  803564:	53                   	push   %ebx
+  803565:	89 f0                	mov    %esi,%eax
+  803567:	03 45 0c             	add    0xc(%ebp),%eax
+  80356a:	50                   	push   %eax
+  80356b:	57                   	push   %edi
+  80356c:	e8 08 d4 ff ff       	call   800979 <memmove>
+    sys_cputs(buf, m);
+  803571:	83 c4 08             	add    $0x8,%esp
+  803574:	53                   	push   %ebx
+  803575:	57                   	push   %edi
+  803576:	e8 a8 d5 ff ff       	call   800b23 <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  80357b:	01 de                	add    %ebx,%esi
+  80357d:	83 c4 10             	add    $0x10,%esp
+  803580:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803583:	72 cd                	jb     803552 <devcons_write+0x19>
+}
+  803585:	89 f0                	mov    %esi,%eax
+  803587:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80358a:	5b                   	pop    %ebx
+  80358b:	5e                   	pop    %esi
+  80358c:	5f                   	pop    %edi
+  80358d:	5d                   	pop    %ebp
+  80358e:	c3                   	ret
+
+0080358f <devcons_read>:
+{
+  80358f:	55                   	push   %ebp
+  803590:	89 e5                	mov    %esp,%ebp
+  803592:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  803595:	b8 00 00 00 00       	mov    $0x0,%eax
+  80359a:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80359e:	75 07                	jne    8035a7 <devcons_read+0x18>
+  8035a0:	eb 1f                	jmp    8035c1 <devcons_read+0x32>
+    sys_yield();
+  8035a2:	e8 19 d6 ff ff       	call   800bc0 <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  8035a7:	e8 95 d5 ff ff       	call   800b41 <sys_cgetc>
+  8035ac:	85 c0                	test   %eax,%eax
+  8035ae:	74 f2                	je     8035a2 <devcons_read+0x13>
+  if (c < 0)
+  8035b0:	78 0f                	js     8035c1 <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  8035b2:	83 f8 04             	cmp    $0x4,%eax
+  8035b5:	74 0c                	je     8035c3 <devcons_read+0x34>
+  *(char*)vbuf = c;
+  8035b7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8035ba:	88 02                	mov    %al,(%edx)
+  return 1;
+  8035bc:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8035c1:	c9                   	leave
+  8035c2:	c3                   	ret
+    return 0;
+  8035c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035c8:	eb f7                	jmp    8035c1 <devcons_read+0x32>
+
+008035ca <cputchar>:
+{
+  8035ca:	55                   	push   %ebp
+  8035cb:	89 e5                	mov    %esp,%ebp
+  8035cd:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  8035d0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035d3:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  8035d6:	6a 01                	push   $0x1
+  8035d8:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8035db:	50                   	push   %eax
+  8035dc:	e8 42 d5 ff ff       	call   800b23 <sys_cputs>
+}
+  8035e1:	83 c4 10             	add    $0x10,%esp
+  8035e4:	c9                   	leave
+  8035e5:	c3                   	ret
+
+008035e6 <getchar>:
+{
+  8035e6:	55                   	push   %ebp
+  8035e7:	89 e5                	mov    %esp,%ebp
+  8035e9:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  8035ec:	6a 01                	push   $0x1
+  8035ee:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8035f1:	50                   	push   %eax
+  8035f2:	6a 00                	push   $0x0
+  8035f4:	e8 94 e3 ff ff       	call   80198d <read>
+  if (r < 0)
+  8035f9:	83 c4 10             	add    $0x10,%esp
+  8035fc:	85 c0                	test   %eax,%eax
+  8035fe:	78 06                	js     803606 <getchar+0x20>
+  if (r < 1)
+  803600:	74 06                	je     803608 <getchar+0x22>
+  return c;
+  803602:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803606:	c9                   	leave
+  803607:	c3                   	ret
+    return -E_EOF;
+  803608:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80360d:	eb f7                	jmp    803606 <getchar+0x20>
+
+0080360f <iscons>:
+{
+  80360f:	55                   	push   %ebp
+  803610:	89 e5                	mov    %esp,%ebp
+  803612:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803615:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803618:	50                   	push   %eax
+  803619:	ff 75 08             	push   0x8(%ebp)
+  80361c:	e8 c1 e0 ff ff       	call   8016e2 <fd_lookup>
+  803621:	83 c4 10             	add    $0x10,%esp
+  803624:	85 c0                	test   %eax,%eax
+  803626:	78 11                	js     803639 <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  803628:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80362b:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  803631:	39 10                	cmp    %edx,(%eax)
+  803633:	0f 94 c0             	sete   %al
+  803636:	0f b6 c0             	movzbl %al,%eax
+}
+  803639:	c9                   	leave
+  80363a:	c3                   	ret
+
+0080363b <opencons>:
+{
+  80363b:	55                   	push   %ebp
+  80363c:	89 e5                	mov    %esp,%ebp
+  80363e:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  803641:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803644:	50                   	push   %eax
+  803645:	e8 42 e0 ff ff       	call   80168c <fd_alloc>
+  80364a:	83 c4 10             	add    $0x10,%esp
+  80364d:	85 c0                	test   %eax,%eax
+  80364f:	78 3a                	js     80368b <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803651:	83 ec 04             	sub    $0x4,%esp
+  803654:	68 07 04 00 00       	push   $0x407
+  803659:	ff 75 f4             	push   -0xc(%ebp)
+  80365c:	6a 00                	push   $0x0
+  80365e:	e8 bf d5 ff ff       	call   800c22 <sys_page_alloc>
+  803663:	83 c4 10             	add    $0x10,%esp
+  803666:	85 c0                	test   %eax,%eax
+  803668:	78 21                	js     80368b <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  80366a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80366d:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  803673:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  803675:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803678:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  80367f:	83 ec 0c             	sub    $0xc,%esp
+  803682:	50                   	push   %eax
+  803683:	e8 e0 df ff ff       	call   801668 <fd2num>
+  803688:	83 c4 10             	add    $0x10,%esp
+}
+  80368b:	c9                   	leave
+  80368c:	c3                   	ret
+
+0080368d <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80368d:	55                   	push   %ebp
+  80368e:	89 e5                	mov    %esp,%ebp
+  803690:	56                   	push   %esi
+  803691:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  803692:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  803695:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  80369b:	e8 01 d5 ff ff       	call   800ba1 <sys_getenvid>
+  8036a0:	83 ec 0c             	sub    $0xc,%esp
+  8036a3:	ff 75 0c             	push   0xc(%ebp)
+  8036a6:	ff 75 08             	push   0x8(%ebp)
+  8036a9:	56                   	push   %esi
+  8036aa:	50                   	push   %eax
+  8036ab:	68 c8 3f 80 00       	push   $0x803fc8
+  8036b0:	e8 50 cb ff ff       	call   800205 <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  8036b5:	83 c4 18             	add    $0x18,%esp
+  8036b8:	53                   	push   %ebx
+  8036b9:	ff 75 10             	push   0x10(%ebp)
+  8036bc:	e8 f3 ca ff ff       	call   8001b4 <vcprintf>
+  cprintf("\n");
+  8036c1:	c7 04 24 64 3f 80 00 	movl   $0x803f64,(%esp)
+  8036c8:	e8 38 cb ff ff       	call   800205 <cprintf>
+  8036cd:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  8036d0:	cc                   	int3
+  while (1)
+  8036d1:	eb fd                	jmp    8036d0 <_panic+0x43>
+
+008036d3 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8036d3:	55                   	push   %ebp
+  8036d4:	89 e5                	mov    %esp,%ebp
+  8036d6:	53                   	push   %ebx
+  8036d7:	83 ec 04             	sub    $0x4,%esp
+  int r;
+
+  if (_pgfault_handler == 0) {
+  8036da:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  8036e1:	74 0d                	je     8036f0 <set_pgfault_handler+0x1d>
+
+    sys_env_set_pgfault_upcall(id, _pgfault_upcall);
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  8036e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8036e6:	a3 00 70 80 00       	mov    %eax,0x807000
+}
+  8036eb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8036ee:	c9                   	leave
+  8036ef:	c3                   	ret
+    envid_t id = sys_getenvid();
+  8036f0:	e8 ac d4 ff ff       	call   800ba1 <sys_getenvid>
+  8036f5:	89 c3                	mov    %eax,%ebx
+    sys_page_alloc(id, (void *) (UXSTACKTOP - PGSIZE), (PTE_P | PTE_U | PTE_W));
+  8036f7:	83 ec 04             	sub    $0x4,%esp
+  8036fa:	6a 07                	push   $0x7
+  8036fc:	68 00 f0 bf ee       	push   $0xeebff000
+  803701:	50                   	push   %eax
+  803702:	e8 1b d5 ff ff       	call   800c22 <sys_page_alloc>
+    sys_env_set_pgfault_upcall(id, _pgfault_upcall);
+  803707:	83 c4 08             	add    $0x8,%esp
+  80370a:	68 1a 37 80 00       	push   $0x80371a
+  80370f:	53                   	push   %ebx
+  803710:	e8 82 d7 ff ff       	call   800e97 <sys_env_set_pgfault_upcall>
+  803715:	83 c4 10             	add    $0x10,%esp
+  803718:	eb c9                	jmp    8036e3 <set_pgfault_handler+0x10>
+
+0080371a <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  80371a:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  80371b:	a1 00 70 80 00       	mov    0x807000,%eax
+	call *%eax
+  803720:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  803722:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+  movl 48(%esp), %eax       // move trap time esp to eax
+  803725:	8b 44 24 30          	mov    0x30(%esp),%eax
+  subl $4, %eax             // make room for eip on trap time esp
+  803729:	83 e8 04             	sub    $0x4,%eax
+  movl %eax, 48(%esp)       // move value to esp
+  80372c:	89 44 24 30          	mov    %eax,0x30(%esp)
+  movl 40(%esp), %ebx       // move trap time eip to ebx
+  803730:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+  movl %ebx, 0(%eax)
+  803734:	89 18                	mov    %ebx,(%eax)
+
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+  addl $0x08,%esp
+  803736:	83 c4 08             	add    $0x8,%esp
+  popal
+  803739:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+  addl $4, %esp          // skip tf->eip
+  80373a:	83 c4 04             	add    $0x4,%esp
+  popf                 // pop stack value into flags register
+  80373d:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+  popl %esp
+  80373e:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+  ret
+  80373f:	c3                   	ret
+
+00803740 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803740:	55                   	push   %ebp
+  803741:	89 e5                	mov    %esp,%ebp
+  803743:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  803746:	89 c2                	mov    %eax,%edx
+  803748:	c1 ea 16             	shr    $0x16,%edx
+  80374b:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  803752:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  803757:	f6 c1 01             	test   $0x1,%cl
+  80375a:	74 1c                	je     803778 <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  80375c:	c1 e8 0c             	shr    $0xc,%eax
+  80375f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  803766:	a8 01                	test   $0x1,%al
+  803768:	74 0e                	je     803778 <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  80376a:	c1 e8 0c             	shr    $0xc,%eax
+  80376d:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  803774:	ef 
+  803775:	0f b7 d2             	movzwl %dx,%edx
+}
+  803778:	89 d0                	mov    %edx,%eax
+  80377a:	5d                   	pop    %ebp
+  80377b:	c3                   	ret
+
+0080377c <udivmod>:
+  80377c:	55                   	push   %ebp
+  80377d:	57                   	push   %edi
+  80377e:	56                   	push   %esi
+  80377f:	53                   	push   %ebx
+  803780:	83 ec 14             	sub    $0x14,%esp
+  803783:	8b 74 24 28          	mov    0x28(%esp),%esi
+  803787:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  80378b:	89 fb                	mov    %edi,%ebx
+  80378d:	09 f3                	or     %esi,%ebx
+  80378f:	0f 84 88 00 00 00    	je     80381d <udivmod+0xa1>
+  803795:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80379a:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8037a1:	00 
+  8037a2:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8037a9:	00 
+  8037aa:	89 cd                	mov    %ecx,%ebp
+  8037ac:	89 34 24             	mov    %esi,(%esp)
+  8037af:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  8037b3:	eb 08                	jmp    8037bd <udivmod+0x41>
+  8037b5:	83 ed 01             	sub    $0x1,%ebp
+  8037b8:	83 fd ff             	cmp    $0xffffffff,%ebp
+  8037bb:	74 6c                	je     803829 <udivmod+0xad>
+  8037bd:	89 c3                	mov    %eax,%ebx
+  8037bf:	89 d6                	mov    %edx,%esi
+  8037c1:	89 e9                	mov    %ebp,%ecx
+  8037c3:	0f ad f3             	shrd   %cl,%esi,%ebx
+  8037c6:	d3 ee                	shr    %cl,%esi
+  8037c8:	f6 c1 20             	test   $0x20,%cl
+  8037cb:	74 04                	je     8037d1 <udivmod+0x55>
+  8037cd:	89 f3                	mov    %esi,%ebx
+  8037cf:	31 f6                	xor    %esi,%esi
+  8037d1:	8b 3c 24             	mov    (%esp),%edi
+  8037d4:	39 fb                	cmp    %edi,%ebx
+  8037d6:	89 f7                	mov    %esi,%edi
+  8037d8:	8b 1c 24             	mov    (%esp),%ebx
+  8037db:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8037df:	19 f7                	sbb    %esi,%edi
+  8037e1:	72 d2                	jb     8037b5 <udivmod+0x39>
+  8037e3:	89 f7                	mov    %esi,%edi
+  8037e5:	89 de                	mov    %ebx,%esi
+  8037e7:	89 e9                	mov    %ebp,%ecx
+  8037e9:	0f a5 f7             	shld   %cl,%esi,%edi
+  8037ec:	d3 e6                	shl    %cl,%esi
+  8037ee:	f6 c1 20             	test   $0x20,%cl
+  8037f1:	74 04                	je     8037f7 <udivmod+0x7b>
+  8037f3:	89 f7                	mov    %esi,%edi
+  8037f5:	31 f6                	xor    %esi,%esi
+  8037f7:	29 f0                	sub    %esi,%eax
+  8037f9:	19 fa                	sbb    %edi,%edx
+  8037fb:	be 01 00 00 00       	mov    $0x1,%esi
+  803800:	bf 00 00 00 00       	mov    $0x0,%edi
+  803805:	0f a5 f7             	shld   %cl,%esi,%edi
+  803808:	d3 e6                	shl    %cl,%esi
+  80380a:	f6 c1 20             	test   $0x20,%cl
+  80380d:	74 04                	je     803813 <udivmod+0x97>
+  80380f:	89 f7                	mov    %esi,%edi
+  803811:	31 f6                	xor    %esi,%esi
+  803813:	09 74 24 08          	or     %esi,0x8(%esp)
+  803817:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  80381b:	eb 98                	jmp    8037b5 <udivmod+0x39>
+  80381d:	89 f0                	mov    %esi,%eax
+  80381f:	89 fa                	mov    %edi,%edx
+  803821:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803825:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  803829:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  80382d:	89 01                	mov    %eax,(%ecx)
+  80382f:	89 51 04             	mov    %edx,0x4(%ecx)
+  803832:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803836:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80383a:	83 c4 14             	add    $0x14,%esp
+  80383d:	5b                   	pop    %ebx
+  80383e:	5e                   	pop    %esi
+  80383f:	5f                   	pop    %edi
+  803840:	5d                   	pop    %ebp
+  803841:	c3                   	ret
+
+00803842 <__udivdi3>:
+  803842:	83 ec 18             	sub    $0x18,%esp
+  803845:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803849:	50                   	push   %eax
+  80384a:	ff 74 24 2c          	push   0x2c(%esp)
+  80384e:	ff 74 24 2c          	push   0x2c(%esp)
+  803852:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803856:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80385a:	e8 1d ff ff ff       	call   80377c <udivmod>
+  80385f:	83 c4 24             	add    $0x24,%esp
+  803862:	c3                   	ret
+
+00803863 <__umoddi3>:
+  803863:	83 ec 18             	sub    $0x18,%esp
+  803866:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80386a:	50                   	push   %eax
+  80386b:	ff 74 24 2c          	push   0x2c(%esp)
+  80386f:	ff 74 24 2c          	push   0x2c(%esp)
+  803873:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803877:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80387b:	e8 fc fe ff ff       	call   80377c <udivmod>
+  803880:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803884:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803888:	83 c4 24             	add    $0x24,%esp
+  80388b:	c3                   	ret
+
+0080388c <__divdi3>:
+  80388c:	56                   	push   %esi
+  80388d:	53                   	push   %ebx
+  80388e:	83 ec 14             	sub    $0x14,%esp
+  803891:	8b 44 24 20          	mov    0x20(%esp),%eax
+  803895:	8b 54 24 24          	mov    0x24(%esp),%edx
+  803899:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  80389d:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  8038a1:	85 d2                	test   %edx,%edx
+  8038a3:	78 18                	js     8038bd <__divdi3+0x31>
+  8038a5:	85 db                	test   %ebx,%ebx
+  8038a7:	78 3e                	js     8038e7 <__divdi3+0x5b>
+  8038a9:	83 ec 04             	sub    $0x4,%esp
+  8038ac:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8038b0:	56                   	push   %esi
+  8038b1:	53                   	push   %ebx
+  8038b2:	51                   	push   %ecx
+  8038b3:	e8 c4 fe ff ff       	call   80377c <udivmod>
+  8038b8:	83 c4 10             	add    $0x10,%esp
+  8038bb:	eb 24                	jmp    8038e1 <__divdi3+0x55>
+  8038bd:	f7 d8                	neg    %eax
+  8038bf:	83 d2 00             	adc    $0x0,%edx
+  8038c2:	f7 da                	neg    %edx
+  8038c4:	85 db                	test   %ebx,%ebx
+  8038c6:	78 3a                	js     803902 <__divdi3+0x76>
+  8038c8:	83 ec 04             	sub    $0x4,%esp
+  8038cb:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8038cf:	56                   	push   %esi
+  8038d0:	53                   	push   %ebx
+  8038d1:	51                   	push   %ecx
+  8038d2:	e8 a5 fe ff ff       	call   80377c <udivmod>
+  8038d7:	83 c4 10             	add    $0x10,%esp
+  8038da:	f7 d8                	neg    %eax
+  8038dc:	83 d2 00             	adc    $0x0,%edx
+  8038df:	f7 da                	neg    %edx
+  8038e1:	83 c4 14             	add    $0x14,%esp
+  8038e4:	5b                   	pop    %ebx
+  8038e5:	5e                   	pop    %esi
+  8038e6:	c3                   	ret
+  8038e7:	83 ec 04             	sub    $0x4,%esp
+  8038ea:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8038ee:	56                   	push   %esi
+  8038ef:	f7 d9                	neg    %ecx
+  8038f1:	83 d3 00             	adc    $0x0,%ebx
+  8038f4:	f7 db                	neg    %ebx
+  8038f6:	53                   	push   %ebx
+  8038f7:	51                   	push   %ecx
+  8038f8:	e8 7f fe ff ff       	call   80377c <udivmod>
+  8038fd:	83 c4 10             	add    $0x10,%esp
+  803900:	eb d8                	jmp    8038da <__divdi3+0x4e>
+  803902:	83 ec 04             	sub    $0x4,%esp
+  803905:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803909:	56                   	push   %esi
+  80390a:	f7 d9                	neg    %ecx
+  80390c:	83 d3 00             	adc    $0x0,%ebx
+  80390f:	f7 db                	neg    %ebx
+  803911:	53                   	push   %ebx
+  803912:	51                   	push   %ecx
+  803913:	e8 64 fe ff ff       	call   80377c <udivmod>
+  803918:	83 c4 10             	add    $0x10,%esp
+  80391b:	eb c4                	jmp    8038e1 <__divdi3+0x55>
+
+0080391d <__moddi3>:
+  80391d:	55                   	push   %ebp
+  80391e:	57                   	push   %edi
+  80391f:	56                   	push   %esi
+  803920:	53                   	push   %ebx
+  803921:	83 ec 24             	sub    $0x24,%esp
+  803924:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803928:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80392c:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  803930:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  803934:	85 d2                	test   %edx,%edx
+  803936:	78 3b                	js     803973 <__moddi3+0x56>
+  803938:	83 ec 04             	sub    $0x4,%esp
+  80393b:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  80393f:	56                   	push   %esi
+  803940:	89 ce                	mov    %ecx,%esi
+  803942:	f7 de                	neg    %esi
+  803944:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803948:	89 de                	mov    %ebx,%esi
+  80394a:	83 d6 00             	adc    $0x0,%esi
+  80394d:	f7 de                	neg    %esi
+  80394f:	89 74 24 14          	mov    %esi,0x14(%esp)
+  803953:	8b 74 24 08          	mov    0x8(%esp),%esi
+  803957:	0f 48 f1             	cmovs  %ecx,%esi
+  80395a:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  80395f:	53                   	push   %ebx
+  803960:	56                   	push   %esi
+  803961:	e8 16 fe ff ff       	call   80377c <udivmod>
+  803966:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80396a:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80396e:	83 c4 10             	add    $0x10,%esp
+  803971:	eb 47                	jmp    8039ba <__moddi3+0x9d>
+  803973:	f7 d8                	neg    %eax
+  803975:	83 d2 00             	adc    $0x0,%edx
+  803978:	f7 da                	neg    %edx
+  80397a:	83 ec 04             	sub    $0x4,%esp
+  80397d:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803981:	56                   	push   %esi
+  803982:	89 cf                	mov    %ecx,%edi
+  803984:	f7 df                	neg    %edi
+  803986:	89 de                	mov    %ebx,%esi
+  803988:	83 d6 00             	adc    $0x0,%esi
+  80398b:	f7 de                	neg    %esi
+  80398d:	0f 49 cf             	cmovns %edi,%ecx
+  803990:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  803994:	0f 49 de             	cmovns %esi,%ebx
+  803997:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  80399b:	ff 74 24 0c          	push   0xc(%esp)
+  80399f:	ff 74 24 0c          	push   0xc(%esp)
+  8039a3:	e8 d4 fd ff ff       	call   80377c <udivmod>
+  8039a8:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8039ac:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8039b0:	f7 d8                	neg    %eax
+  8039b2:	83 d2 00             	adc    $0x0,%edx
+  8039b5:	f7 da                	neg    %edx
+  8039b7:	83 c4 10             	add    $0x10,%esp
+  8039ba:	83 c4 24             	add    $0x24,%esp
+  8039bd:	5b                   	pop    %ebx
+  8039be:	5e                   	pop    %esi
+  8039bf:	5f                   	pop    %edi
+  8039c0:	5d                   	pop    %ebp
+  8039c1:	c3                   	ret
@@ -0,0 +1,8003 @@
+
+obj/user/pipebench.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 97 02 00 00       	call   8002c8 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <run>:
+  }
+}
+
+static void
+run(const char *name, int mode, bool splice, size_t total)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 34             	sub    $0x34,%esp
+  80003c:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80003f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800042:	88 4d d7             	mov    %cl,-0x29(%ebp)
+  int p[2], r;
+  envid_t child;
+  unsigned start, ms;
+
+  if ((r = pipe2(p, mode)) < 0)
+  800045:	52                   	push   %edx
+  800046:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  800049:	50                   	push   %eax
+  80004a:	e8 42 2b 00 00       	call   802b91 <pipe2>
+  80004f:	83 c4 10             	add    $0x10,%esp
+  800052:	85 c0                	test   %eax,%eax
+  800054:	78 35                	js     80008b <run+0x58>
+    panic("pipe2: %e", r);
+
+  start = sys_time_msec();
+  800056:	e8 ec 10 00 00       	call   801147 <sys_time_msec>
+  80005b:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  if ((child = fork()) < 0)
+  80005e:	e8 37 14 00 00       	call   80149a <fork>
+  800063:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800066:	85 c0                	test   %eax,%eax
+  800068:	78 33                	js     80009d <run+0x6a>
+    panic("fork: %e", child);
+  if (child == 0) {
+  80006a:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+  80006e:	74 3f                	je     8000af <run+0x7c>
+    close(p[1]);
+    reader(p[0], total, splice);
+  }
+  close(p[0]);
+  800070:	83 ec 0c             	sub    $0xc,%esp
+  800073:	ff 75 e0             	push   -0x20(%ebp)
+  800076:	e8 32 18 00 00       	call   8018ad <close>
+  writer(p[1], total, splice);
+  80007b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  for (sent = 0; sent < total; sent += n) {
+  80007e:	83 c4 10             	add    $0x10,%esp
+  800081:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800086:	e9 dd 00 00 00       	jmp    800168 <run+0x135>
+    panic("pipe2: %e", r);
+  80008b:	50                   	push   %eax
+  80008c:	68 e0 3b 80 00       	push   $0x803be0
+  800091:	6a 3f                	push   $0x3f
+  800093:	68 ea 3b 80 00       	push   $0x803bea
+  800098:	e8 98 02 00 00       	call   800335 <_panic>
+    panic("fork: %e", child);
+  80009d:	50                   	push   %eax
+  80009e:	68 70 40 80 00       	push   $0x804070
+  8000a3:	6a 43                	push   $0x43
+  8000a5:	68 ea 3b 80 00       	push   $0x803bea
+  8000aa:	e8 86 02 00 00       	call   800335 <_panic>
+    close(p[1]);
+  8000af:	83 ec 0c             	sub    $0xc,%esp
+  8000b2:	ff 75 e4             	push   -0x1c(%ebp)
+  8000b5:	e8 f3 17 00 00       	call   8018ad <close>
+    reader(p[0], total, splice);
+  8000ba:	8b 7d e0             	mov    -0x20(%ebp),%edi
+  for (got = 0; got < total; got += n) {
+  8000bd:	83 c4 10             	add    $0x10,%esp
+  8000c0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8000c5:	eb 1e                	jmp    8000e5 <run+0xb2>
+      n = read(fd, rbuf, NBUF);
+  8000c7:	83 ec 04             	sub    $0x4,%esp
+  8000ca:	68 00 20 00 00       	push   $0x2000
+  8000cf:	68 00 70 80 00       	push   $0x807000
+  8000d4:	57                   	push   %edi
+  8000d5:	e8 5b 19 00 00       	call   801a35 <read>
+  8000da:	83 c4 10             	add    $0x10,%esp
+    if (n < 0)
+  8000dd:	85 c0                	test   %eax,%eax
+  8000df:	78 21                	js     800102 <run+0xcf>
+    if (n == 0)
+  8000e1:	74 31                	je     800114 <run+0xe1>
+  for (got = 0; got < total; got += n) {
+  8000e3:	01 c3                	add    %eax,%ebx
+  8000e5:	39 f3                	cmp    %esi,%ebx
+  8000e7:	73 3d                	jae    800126 <run+0xf3>
+    if (splice)
+  8000e9:	80 7d d7 00          	cmpb   $0x0,-0x29(%ebp)
+  8000ed:	74 d8                	je     8000c7 <run+0x94>
+      n = pipe_splice_read(fd, rbuf);
+  8000ef:	83 ec 08             	sub    $0x8,%esp
+  8000f2:	68 00 70 80 00       	push   $0x807000
+  8000f7:	57                   	push   %edi
+  8000f8:	e8 29 2e 00 00       	call   802f26 <pipe_splice_read>
+  8000fd:	83 c4 10             	add    $0x10,%esp
+  800100:	eb db                	jmp    8000dd <run+0xaa>
+      panic("pipebench read: %e", n);
+  800102:	50                   	push   %eax
+  800103:	68 fb 3b 80 00       	push   $0x803bfb
+  800108:	6a 1c                	push   $0x1c
+  80010a:	68 ea 3b 80 00       	push   $0x803bea
+  80010f:	e8 21 02 00 00       	call   800335 <_panic>
+      panic("pipebench: early eof after %d bytes", got);
+  800114:	53                   	push   %ebx
+  800115:	68 54 3c 80 00       	push   $0x803c54
+  80011a:	6a 1e                	push   $0x1e
+  80011c:	68 ea 3b 80 00       	push   $0x803bea
+  800121:	e8 0f 02 00 00       	call   800335 <_panic>
+  exit();
+  800126:	e8 f0 01 00 00       	call   80031b <exit>
+}
+  80012b:	e9 40 ff ff ff       	jmp    800070 <run+0x3d>
+        panic("sys_page_alloc: %e", r);
+  800130:	50                   	push   %eax
+  800131:	68 0e 3c 80 00       	push   $0x803c0e
+  800136:	6a 2d                	push   $0x2d
+  800138:	68 ea 3b 80 00       	push   $0x803bea
+  80013d:	e8 f3 01 00 00       	call   800335 <_panic>
+      n = write(fd, wbuf, MIN(NBUF, total - sent));
+  800142:	83 ec 04             	sub    $0x4,%esp
+  800145:	89 f0                	mov    %esi,%eax
+  800147:	29 d8                	sub    %ebx,%eax
+  800149:	ba 00 20 00 00       	mov    $0x2000,%edx
+  80014e:	39 d0                	cmp    %edx,%eax
+  800150:	0f 47 c2             	cmova  %edx,%eax
+  800153:	50                   	push   %eax
+  800154:	68 00 90 80 00       	push   $0x809000
+  800159:	57                   	push   %edi
+  80015a:	e8 a4 19 00 00       	call   801b03 <write>
+  80015f:	83 c4 10             	add    $0x10,%esp
+    if (n <= 0)
+  800162:	85 c0                	test   %eax,%eax
+  800164:	7e 3f                	jle    8001a5 <run+0x172>
+  for (sent = 0; sent < total; sent += n) {
+  800166:	01 c3                	add    %eax,%ebx
+  800168:	39 f3                	cmp    %esi,%ebx
+  80016a:	73 4b                	jae    8001b7 <run+0x184>
+    if (splice) {
+  80016c:	80 7d d7 00          	cmpb   $0x0,-0x29(%ebp)
+  800170:	74 d0                	je     800142 <run+0x10f>
+      if ((r = sys_page_alloc(0, SPLICEVA, PTE_P|PTE_U|PTE_W)) < 0)
+  800172:	83 ec 04             	sub    $0x4,%esp
+  800175:	6a 07                	push   $0x7
+  800177:	68 00 00 00 0a       	push   $0xa000000
+  80017c:	6a 00                	push   $0x0
+  80017e:	e8 aa 0c 00 00       	call   800e2d <sys_page_alloc>
+  800183:	83 c4 10             	add    $0x10,%esp
+  800186:	85 c0                	test   %eax,%eax
+  800188:	78 a6                	js     800130 <run+0xfd>
+      *(uint32_t*) SPLICEVA = sent;
+  80018a:	89 1d 00 00 00 0a    	mov    %ebx,0xa000000
+      n = pipe_splice(fd, SPLICEVA, 1);
+  800190:	83 ec 04             	sub    $0x4,%esp
+  800193:	6a 01                	push   $0x1
+  800195:	68 00 00 00 0a       	push   $0xa000000
+  80019a:	57                   	push   %edi
+  80019b:	e8 5a 2c 00 00       	call   802dfa <pipe_splice>
+  8001a0:	83 c4 10             	add    $0x10,%esp
+  8001a3:	eb bd                	jmp    800162 <run+0x12f>
+      panic("pipebench write: %e", n);
+  8001a5:	50                   	push   %eax
+  8001a6:	68 21 3c 80 00       	push   $0x803c21
+  8001ab:	6a 33                	push   $0x33
+  8001ad:	68 ea 3b 80 00       	push   $0x803bea
+  8001b2:	e8 7e 01 00 00       	call   800335 <_panic>
+  close(p[1]);
+  8001b7:	83 ec 0c             	sub    $0xc,%esp
+  8001ba:	ff 75 e4             	push   -0x1c(%ebp)
+  8001bd:	e8 eb 16 00 00       	call   8018ad <close>
+  wait(child);
+  8001c2:	83 c4 04             	add    $0x4,%esp
+  8001c5:	ff 75 d0             	push   -0x30(%ebp)
+  8001c8:	e8 e0 2d 00 00       	call   802fad <wait>
+  ms = sys_time_msec() - start;
+  8001cd:	e8 75 0f 00 00       	call   801147 <sys_time_msec>
+  8001d2:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8001d5:	29 c8                	sub    %ecx,%eax
+  8001d7:	89 c1                	mov    %eax,%ecx
+  8001d9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8001de:	0f 44 c8             	cmove  %eax,%ecx
+
+  if (ms == 0)
+    ms = 1;
+  cprintf("pipebench: %-8s %6d KB in %5d ms = %5d KB/s (%d MB/s)\n",
+          name, total / 1024, ms,
+          (total / 1024) * 1000 / ms, (total / 1024) * 1000 / ms / 1024);
+  8001e1:	c1 ee 0a             	shr    $0xa,%esi
+  8001e4:	69 c6 e8 03 00 00    	imul   $0x3e8,%esi,%eax
+  8001ea:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001ef:	f7 f1                	div    %ecx
+  cprintf("pipebench: %-8s %6d KB in %5d ms = %5d KB/s (%d MB/s)\n",
+  8001f1:	83 c4 08             	add    $0x8,%esp
+  8001f4:	89 c2                	mov    %eax,%edx
+  8001f6:	c1 ea 0a             	shr    $0xa,%edx
+  8001f9:	52                   	push   %edx
+  8001fa:	50                   	push   %eax
+  8001fb:	51                   	push   %ecx
+  8001fc:	56                   	push   %esi
+  8001fd:	ff 75 c8             	push   -0x38(%ebp)
+  800200:	68 78 3c 80 00       	push   $0x803c78
+  800205:	e8 06 02 00 00       	call   800410 <cprintf>
+}
+  80020a:	83 c4 20             	add    $0x20,%esp
+  80020d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800210:	5b                   	pop    %ebx
+  800211:	5e                   	pop    %esi
+  800212:	5f                   	pop    %edi
+  800213:	5d                   	pop    %ebp
+  800214:	c3                   	ret
+
+00800215 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800215:	55                   	push   %ebp
+  800216:	89 e5                	mov    %esp,%ebp
+  800218:	53                   	push   %ebx
+  800219:	83 ec 04             	sub    $0x4,%esp
+  size_t kb = 4096;
+
+  binaryname = "pipebench";
+  80021c:	c7 05 00 50 80 00 35 	movl   $0x803c35,0x805000
+  800223:	3c 80 00 
+  size_t kb = 4096;
+  800226:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  if (argc > 1)
+  80022b:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+  80022f:	7f 7b                	jg     8002ac <umain+0x97>
+    kb = strtol(argv[1], 0, 0);
+
+  memset(wbuf, 'x', sizeof(wbuf));
+  800231:	83 ec 04             	sub    $0x4,%esp
+  800234:	68 00 20 00 00       	push   $0x2000
+  800239:	6a 78                	push   $0x78
+  80023b:	68 00 90 80 00       	push   $0x809000
+  800240:	e8 0a 09 00 00       	call   800b4f <memset>
+  run("classic", 0, 0, ROUNDUP(kb, 4) * 1024 / 4);
+  800245:	8d 43 03             	lea    0x3(%ebx),%eax
+  800248:	c1 e0 08             	shl    $0x8,%eax
+  80024b:	25 00 fc ff 3f       	and    $0x3ffffc00,%eax
+  800250:	89 04 24             	mov    %eax,(%esp)
+  800253:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800258:	ba 00 00 00 00       	mov    $0x0,%edx
+  80025d:	b8 3f 3c 80 00       	mov    $0x803c3f,%eax
+  800262:	e8 cc fd ff ff       	call   800033 <run>
+  run("bulk", PIPE_BULK, 0, kb * 1024);
+  800267:	c1 e3 0a             	shl    $0xa,%ebx
+  80026a:	89 1c 24             	mov    %ebx,(%esp)
+  80026d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800272:	ba 01 00 00 00       	mov    $0x1,%edx
+  800277:	b8 47 3c 80 00       	mov    $0x803c47,%eax
+  80027c:	e8 b2 fd ff ff       	call   800033 <run>
+  run("splice", PIPE_BULK, 1, ROUNDUP(kb * 1024, PGSIZE));
+  800281:	81 c3 ff 0f 00 00    	add    $0xfff,%ebx
+  800287:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  80028d:	89 1c 24             	mov    %ebx,(%esp)
+  800290:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800295:	ba 01 00 00 00       	mov    $0x1,%edx
+  80029a:	b8 4c 3c 80 00       	mov    $0x803c4c,%eax
+  80029f:	e8 8f fd ff ff       	call   800033 <run>
+}
+  8002a4:	83 c4 10             	add    $0x10,%esp
+  8002a7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8002aa:	c9                   	leave
+  8002ab:	c3                   	ret
+    kb = strtol(argv[1], 0, 0);
+  8002ac:	83 ec 04             	sub    $0x4,%esp
+  8002af:	6a 00                	push   $0x0
+  8002b1:	6a 00                	push   $0x0
+  8002b3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8002b6:	ff 70 04             	push   0x4(%eax)
+  8002b9:	e8 94 09 00 00       	call   800c52 <strtol>
+  8002be:	89 c3                	mov    %eax,%ebx
+  8002c0:	83 c4 10             	add    $0x10,%esp
+  8002c3:	e9 69 ff ff ff       	jmp    800231 <umain+0x1c>
+
+008002c8 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8002c8:	55                   	push   %ebp
+  8002c9:	89 e5                	mov    %esp,%ebp
+  8002cb:	56                   	push   %esi
+  8002cc:	53                   	push   %ebx
+  8002cd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8002d0:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  8002d3:	c7 05 00 b0 80 00 00 	movl   $0x0,0x80b000
+  8002da:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  8002dd:	e8 ca 0a 00 00       	call   800dac <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  8002e2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8002e7:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8002ea:	c1 e0 04             	shl    $0x4,%eax
+  8002ed:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8002f2:	a3 00 b0 80 00       	mov    %eax,0x80b000
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8002f7:	85 db                	test   %ebx,%ebx
+  8002f9:	7e 07                	jle    800302 <libmain+0x3a>
+    binaryname = argv[0];
+  8002fb:	8b 06                	mov    (%esi),%eax
+  8002fd:	a3 00 50 80 00       	mov    %eax,0x805000
+
+  // call user main routine
+  umain(argc, argv);
+  800302:	83 ec 08             	sub    $0x8,%esp
+  800305:	56                   	push   %esi
+  800306:	53                   	push   %ebx
+  800307:	e8 09 ff ff ff       	call   800215 <umain>
+
+  // exit gracefully
+  exit();
+  80030c:	e8 0a 00 00 00       	call   80031b <exit>
+}
+  800311:	83 c4 10             	add    $0x10,%esp
+  800314:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800317:	5b                   	pop    %ebx
+  800318:	5e                   	pop    %esi
+  800319:	5d                   	pop    %ebp
+  80031a:	c3                   	ret
+
+0080031b <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80031b:	55                   	push   %ebp
+  80031c:	89 e5                	mov    %esp,%ebp
+  80031e:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  800321:	e8 b4 15 00 00       	call   8018da <close_all>
+  sys_env_destroy(0);
+  800326:	83 ec 0c             	sub    $0xc,%esp
+  800329:	6a 00                	push   $0x0
+  80032b:	e8 3b 0a 00 00       	call   800d6b <sys_env_destroy>
+}
+  800330:	83 c4 10             	add    $0x10,%esp
+  800333:	c9                   	leave
+  800334:	c3                   	ret
+
+00800335 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800335:	55                   	push   %ebp
+  800336:	89 e5                	mov    %esp,%ebp
+  800338:	56                   	push   %esi
+  800339:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  80033a:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  80033d:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  800343:	e8 64 0a 00 00       	call   800dac <sys_getenvid>
+  800348:	83 ec 0c             	sub    $0xc,%esp
+  80034b:	ff 75 0c             	push   0xc(%ebp)
+  80034e:	ff 75 08             	push   0x8(%ebp)
+  800351:	56                   	push   %esi
+  800352:	50                   	push   %eax
+  800353:	68 bc 3c 80 00       	push   $0x803cbc
+  800358:	e8 b3 00 00 00       	call   800410 <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  80035d:	83 c4 18             	add    $0x18,%esp
+  800360:	53                   	push   %ebx
+  800361:	ff 75 10             	push   0x10(%ebp)
+  800364:	e8 56 00 00 00       	call   8003bf <vcprintf>
+  cprintf("\n");
+  800369:	c7 04 24 d8 41 80 00 	movl   $0x8041d8,(%esp)
+  800370:	e8 9b 00 00 00       	call   800410 <cprintf>
+  800375:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  800378:	cc                   	int3
+  while (1)
+  800379:	eb fd                	jmp    800378 <_panic+0x43>
+
+0080037b <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80037b:	55                   	push   %ebp
+  80037c:	89 e5                	mov    %esp,%ebp
+  80037e:	53                   	push   %ebx
+  80037f:	83 ec 04             	sub    $0x4,%esp
+  800382:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  800385:	8b 13                	mov    (%ebx),%edx
+  800387:	8d 42 01             	lea    0x1(%edx),%eax
+  80038a:	89 03                	mov    %eax,(%ebx)
+  80038c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80038f:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  800393:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800398:	74 09                	je     8003a3 <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  80039a:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80039e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8003a1:	c9                   	leave
+  8003a2:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  8003a3:	83 ec 08             	sub    $0x8,%esp
+  8003a6:	68 ff 00 00 00       	push   $0xff
+  8003ab:	8d 43 08             	lea    0x8(%ebx),%eax
+  8003ae:	50                   	push   %eax
+  8003af:	e8 7a 09 00 00       	call   800d2e <sys_cputs>
+    b->idx = 0;
+  8003b4:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8003ba:	83 c4 10             	add    $0x10,%esp
+  8003bd:	eb db                	jmp    80039a <putch+0x1f>
+
+008003bf <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8003bf:	55                   	push   %ebp
+  8003c0:	89 e5                	mov    %esp,%ebp
+  8003c2:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  8003c8:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8003cf:	00 00 00 
+  b.cnt = 0;
+  8003d2:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8003d9:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  8003dc:	ff 75 0c             	push   0xc(%ebp)
+  8003df:	ff 75 08             	push   0x8(%ebp)
+  8003e2:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8003e8:	50                   	push   %eax
+  8003e9:	68 7b 03 80 00       	push   $0x80037b
+  8003ee:	e8 14 01 00 00       	call   800507 <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  8003f3:	83 c4 08             	add    $0x8,%esp
+  8003f6:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8003fc:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800402:	50                   	push   %eax
+  800403:	e8 26 09 00 00       	call   800d2e <sys_cputs>
+
+  return b.cnt;
+}
+  800408:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80040e:	c9                   	leave
+  80040f:	c3                   	ret
+
+00800410 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800410:	55                   	push   %ebp
+  800411:	89 e5                	mov    %esp,%ebp
+  800413:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  800416:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  800419:	50                   	push   %eax
+  80041a:	ff 75 08             	push   0x8(%ebp)
+  80041d:	e8 9d ff ff ff       	call   8003bf <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  800422:	c9                   	leave
+  800423:	c3                   	ret
+
+00800424 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  800424:	55                   	push   %ebp
+  800425:	89 e5                	mov    %esp,%ebp
+  800427:	57                   	push   %edi
+  800428:	56                   	push   %esi
+  800429:	53                   	push   %ebx
+  80042a:	83 ec 1c             	sub    $0x1c,%esp
+  80042d:	89 c7                	mov    %eax,%edi
+  80042f:	89 d6                	mov    %edx,%esi
+  800431:	8b 45 08             	mov    0x8(%ebp),%eax
+  800434:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800437:	89 d1                	mov    %edx,%ecx
+  800439:	89 c2                	mov    %eax,%edx
+  80043b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80043e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800441:	8b 45 10             	mov    0x10(%ebp),%eax
+  800444:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  800447:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80044a:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800451:	39 c2                	cmp    %eax,%edx
+  800453:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800456:	72 3e                	jb     800496 <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  800458:	83 ec 0c             	sub    $0xc,%esp
+  80045b:	ff 75 18             	push   0x18(%ebp)
+  80045e:	83 eb 01             	sub    $0x1,%ebx
+  800461:	53                   	push   %ebx
+  800462:	50                   	push   %eax
+  800463:	83 ec 08             	sub    $0x8,%esp
+  800466:	ff 75 e4             	push   -0x1c(%ebp)
+  800469:	ff 75 e0             	push   -0x20(%ebp)
+  80046c:	ff 75 dc             	push   -0x24(%ebp)
+  80046f:	ff 75 d8             	push   -0x28(%ebp)
+  800472:	e8 e1 35 00 00       	call   803a58 <__udivdi3>
+  800477:	83 c4 18             	add    $0x18,%esp
+  80047a:	52                   	push   %edx
+  80047b:	50                   	push   %eax
+  80047c:	89 f2                	mov    %esi,%edx
+  80047e:	89 f8                	mov    %edi,%eax
+  800480:	e8 9f ff ff ff       	call   800424 <printnum>
+  800485:	83 c4 20             	add    $0x20,%esp
+  800488:	eb 13                	jmp    80049d <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  80048a:	83 ec 08             	sub    $0x8,%esp
+  80048d:	56                   	push   %esi
+  80048e:	ff 75 18             	push   0x18(%ebp)
+  800491:	ff d7                	call   *%edi
+  800493:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  800496:	83 eb 01             	sub    $0x1,%ebx
+  800499:	85 db                	test   %ebx,%ebx
+  80049b:	7f ed                	jg     80048a <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  80049d:	83 ec 08             	sub    $0x8,%esp
+  8004a0:	56                   	push   %esi
+  8004a1:	83 ec 04             	sub    $0x4,%esp
+  8004a4:	ff 75 e4             	push   -0x1c(%ebp)
+  8004a7:	ff 75 e0             	push   -0x20(%ebp)
+  8004aa:	ff 75 dc             	push   -0x24(%ebp)
+  8004ad:	ff 75 d8             	push   -0x28(%ebp)
+  8004b0:	e8 c4 35 00 00       	call   803a79 <__umoddi3>
+  8004b5:	83 c4 14             	add    $0x14,%esp
+  8004b8:	0f be 80 df 3c 80 00 	movsbl 0x803cdf(%eax),%eax
+  8004bf:	50                   	push   %eax
+  8004c0:	ff d7                	call   *%edi
+}
+  8004c2:	83 c4 10             	add    $0x10,%esp
+  8004c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004c8:	5b                   	pop    %ebx
+  8004c9:	5e                   	pop    %esi
+  8004ca:	5f                   	pop    %edi
+  8004cb:	5d                   	pop    %ebp
+  8004cc:	c3                   	ret
+
+008004cd <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8004cd:	55                   	push   %ebp
+  8004ce:	89 e5                	mov    %esp,%ebp
+  8004d0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  8004d3:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  8004d7:	8b 10                	mov    (%eax),%edx
+  8004d9:	3b 50 04             	cmp    0x4(%eax),%edx
+  8004dc:	73 0a                	jae    8004e8 <sprintputch+0x1b>
+    *b->buf++ = ch;
+  8004de:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8004e1:	89 08                	mov    %ecx,(%eax)
+  8004e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8004e6:	88 02                	mov    %al,(%edx)
+}
+  8004e8:	5d                   	pop    %ebp
+  8004e9:	c3                   	ret
+
+008004ea <printfmt>:
+{
+  8004ea:	55                   	push   %ebp
+  8004eb:	89 e5                	mov    %esp,%ebp
+  8004ed:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  8004f0:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  8004f3:	50                   	push   %eax
+  8004f4:	ff 75 10             	push   0x10(%ebp)
+  8004f7:	ff 75 0c             	push   0xc(%ebp)
+  8004fa:	ff 75 08             	push   0x8(%ebp)
+  8004fd:	e8 05 00 00 00       	call   800507 <vprintfmt>
+}
+  800502:	83 c4 10             	add    $0x10,%esp
+  800505:	c9                   	leave
+  800506:	c3                   	ret
+
+00800507 <vprintfmt>:
+{
+  800507:	55                   	push   %ebp
+  800508:	89 e5                	mov    %esp,%ebp
+  80050a:	57                   	push   %edi
+  80050b:	56                   	push   %esi
+  80050c:	53                   	push   %ebx
+  80050d:	83 ec 2c             	sub    $0x2c,%esp
+  800510:	8b 75 08             	mov    0x8(%ebp),%esi
+  800513:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800516:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800519:	eb 0a                	jmp    800525 <vprintfmt+0x1e>
+      putch(ch, putdat);
+  80051b:	83 ec 08             	sub    $0x8,%esp
+  80051e:	53                   	push   %ebx
+  80051f:	50                   	push   %eax
+  800520:	ff d6                	call   *%esi
+  800522:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  800525:	83 c7 01             	add    $0x1,%edi
+  800528:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80052c:	83 f8 25             	cmp    $0x25,%eax
+  80052f:	74 0c                	je     80053d <vprintfmt+0x36>
+      if (ch == '\0')
+  800531:	85 c0                	test   %eax,%eax
+  800533:	75 e6                	jne    80051b <vprintfmt+0x14>
+}
+  800535:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800538:	5b                   	pop    %ebx
+  800539:	5e                   	pop    %esi
+  80053a:	5f                   	pop    %edi
+  80053b:	5d                   	pop    %ebp
+  80053c:	c3                   	ret
+    padc = ' ';
+  80053d:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  800541:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  800548:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  80054f:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  800556:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  80055b:	8d 47 01             	lea    0x1(%edi),%eax
+  80055e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800561:	0f b6 17             	movzbl (%edi),%edx
+  800564:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800567:	3c 55                	cmp    $0x55,%al
+  800569:	0f 87 cf 03 00 00    	ja     80093e <vprintfmt+0x437>
+  80056f:	0f b6 c0             	movzbl %al,%eax
+  800572:	ff 24 85 20 3e 80 00 	jmp    *0x803e20(,%eax,4)
+  800579:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  80057c:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800580:	eb d9                	jmp    80055b <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  800582:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800585:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800589:	eb d0                	jmp    80055b <vprintfmt+0x54>
+  80058b:	0f b6 d2             	movzbl %dl,%edx
+  80058e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  800591:	b8 00 00 00 00       	mov    $0x0,%eax
+  800596:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  800599:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80059c:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  8005a0:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  8005a3:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8005a6:	83 f9 09             	cmp    $0x9,%ecx
+  8005a9:	77 55                	ja     800600 <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  8005ab:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  8005ae:	eb e9                	jmp    800599 <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  8005b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b3:	8b 00                	mov    (%eax),%eax
+  8005b5:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8005b8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005bb:	8d 40 04             	lea    0x4(%eax),%eax
+  8005be:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  8005c1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  8005c4:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8005c8:	79 91                	jns    80055b <vprintfmt+0x54>
+        width = precision, precision = -1;
+  8005ca:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8005cd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005d0:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8005d7:	eb 82                	jmp    80055b <vprintfmt+0x54>
+      if (width < 0)
+  8005d9:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8005dc:	85 d2                	test   %edx,%edx
+  8005de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005e3:	0f 49 c2             	cmovns %edx,%eax
+  8005e6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  8005e9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  8005ec:	e9 6a ff ff ff       	jmp    80055b <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  8005f1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  8005f4:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  8005fb:	e9 5b ff ff ff       	jmp    80055b <vprintfmt+0x54>
+  800600:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800603:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800606:	eb bc                	jmp    8005c4 <vprintfmt+0xbd>
+      lflag++;
+  800608:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  80060b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  80060e:	e9 48 ff ff ff       	jmp    80055b <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  800613:	8b 45 14             	mov    0x14(%ebp),%eax
+  800616:	8d 78 04             	lea    0x4(%eax),%edi
+  800619:	83 ec 08             	sub    $0x8,%esp
+  80061c:	53                   	push   %ebx
+  80061d:	ff 30                	push   (%eax)
+  80061f:	ff d6                	call   *%esi
+      break;
+  800621:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  800624:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  800627:	e9 b1 02 00 00       	jmp    8008dd <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  80062c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80062f:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  800632:	8b 10                	mov    (%eax),%edx
+  800634:	89 d0                	mov    %edx,%eax
+  800636:	f7 d8                	neg    %eax
+  800638:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80063b:	83 f8 10             	cmp    $0x10,%eax
+  80063e:	7f 23                	jg     800663 <vprintfmt+0x15c>
+  800640:	8b 14 85 80 3f 80 00 	mov    0x803f80(,%eax,4),%edx
+  800647:	85 d2                	test   %edx,%edx
+  800649:	74 18                	je     800663 <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  80064b:	52                   	push   %edx
+  80064c:	68 82 41 80 00       	push   $0x804182
+  800651:	53                   	push   %ebx
+  800652:	56                   	push   %esi
+  800653:	e8 92 fe ff ff       	call   8004ea <printfmt>
+  800658:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  80065b:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80065e:	e9 7a 02 00 00       	jmp    8008dd <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  800663:	50                   	push   %eax
+  800664:	68 f7 3c 80 00       	push   $0x803cf7
+  800669:	53                   	push   %ebx
+  80066a:	56                   	push   %esi
+  80066b:	e8 7a fe ff ff       	call   8004ea <printfmt>
+  800670:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  800673:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  800676:	e9 62 02 00 00       	jmp    8008dd <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  80067b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067e:	83 c0 04             	add    $0x4,%eax
+  800681:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800684:	8b 45 14             	mov    0x14(%ebp),%eax
+  800687:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  800689:	85 c9                	test   %ecx,%ecx
+  80068b:	b8 f0 3c 80 00       	mov    $0x803cf0,%eax
+  800690:	0f 45 c1             	cmovne %ecx,%eax
+  800693:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  800696:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80069a:	7e 06                	jle    8006a2 <vprintfmt+0x19b>
+  80069c:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8006a0:	75 0b                	jne    8006ad <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8006a2:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8006a5:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8006a8:	89 75 08             	mov    %esi,0x8(%ebp)
+  8006ab:	eb 5c                	jmp    800709 <vprintfmt+0x202>
+  8006ad:	83 ec 08             	sub    $0x8,%esp
+  8006b0:	ff 75 d0             	push   -0x30(%ebp)
+  8006b3:	ff 75 cc             	push   -0x34(%ebp)
+  8006b6:	e8 20 03 00 00       	call   8009db <strnlen>
+  8006bb:	89 c2                	mov    %eax,%edx
+  8006bd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006c0:	29 d0                	sub    %edx,%eax
+  8006c2:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  8006c5:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8006c9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006cc:	89 75 08             	mov    %esi,0x8(%ebp)
+  8006cf:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8006d1:	eb 0e                	jmp    8006e1 <vprintfmt+0x1da>
+          putch(padc, putdat);
+  8006d3:	83 ec 08             	sub    $0x8,%esp
+  8006d6:	53                   	push   %ebx
+  8006d7:	57                   	push   %edi
+  8006d8:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8006db:	83 ee 01             	sub    $0x1,%esi
+  8006de:	83 c4 10             	add    $0x10,%esp
+  8006e1:	85 f6                	test   %esi,%esi
+  8006e3:	7f ee                	jg     8006d3 <vprintfmt+0x1cc>
+  8006e5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006e8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006eb:	85 c0                	test   %eax,%eax
+  8006ed:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006f2:	0f 49 d0             	cmovns %eax,%edx
+  8006f5:	29 d0                	sub    %edx,%eax
+  8006f7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006fa:	eb a6                	jmp    8006a2 <vprintfmt+0x19b>
+          putch(ch, putdat);
+  8006fc:	83 ec 08             	sub    $0x8,%esp
+  8006ff:	53                   	push   %ebx
+  800700:	52                   	push   %edx
+  800701:	ff 55 08             	call   *0x8(%ebp)
+  800704:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800707:	89 f1                	mov    %esi,%ecx
+  800709:	8d 71 01             	lea    0x1(%ecx),%esi
+  80070c:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800710:	0f be d0             	movsbl %al,%edx
+  800713:	85 d2                	test   %edx,%edx
+  800715:	74 28                	je     80073f <vprintfmt+0x238>
+  800717:	85 ff                	test   %edi,%edi
+  800719:	78 05                	js     800720 <vprintfmt+0x219>
+  80071b:	83 ef 01             	sub    $0x1,%edi
+  80071e:	78 30                	js     800750 <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  800720:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800724:	74 d6                	je     8006fc <vprintfmt+0x1f5>
+  800726:	0f be c0             	movsbl %al,%eax
+  800729:	83 e8 20             	sub    $0x20,%eax
+  80072c:	83 f8 5e             	cmp    $0x5e,%eax
+  80072f:	76 cb                	jbe    8006fc <vprintfmt+0x1f5>
+          putch('?', putdat);
+  800731:	83 ec 08             	sub    $0x8,%esp
+  800734:	53                   	push   %ebx
+  800735:	6a 3f                	push   $0x3f
+  800737:	ff 55 08             	call   *0x8(%ebp)
+  80073a:	83 c4 10             	add    $0x10,%esp
+  80073d:	eb c8                	jmp    800707 <vprintfmt+0x200>
+  80073f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800742:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800745:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800748:	01 d0                	add    %edx,%eax
+  80074a:	29 c8                	sub    %ecx,%eax
+  80074c:	89 c7                	mov    %eax,%edi
+  80074e:	eb 13                	jmp    800763 <vprintfmt+0x25c>
+  800750:	8b 75 08             	mov    0x8(%ebp),%esi
+  800753:	eb ed                	jmp    800742 <vprintfmt+0x23b>
+        putch(' ', putdat);
+  800755:	83 ec 08             	sub    $0x8,%esp
+  800758:	53                   	push   %ebx
+  800759:	6a 20                	push   $0x20
+  80075b:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  80075d:	83 ef 01             	sub    $0x1,%edi
+  800760:	83 c4 10             	add    $0x10,%esp
+  800763:	85 ff                	test   %edi,%edi
+  800765:	7f ee                	jg     800755 <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  800767:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80076a:	89 45 14             	mov    %eax,0x14(%ebp)
+  80076d:	e9 6b 01 00 00       	jmp    8008dd <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  800772:	83 f9 01             	cmp    $0x1,%ecx
+  800775:	7f 1f                	jg     800796 <vprintfmt+0x28f>
+  else if (lflag)
+  800777:	85 c9                	test   %ecx,%ecx
+  800779:	74 67                	je     8007e2 <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  80077b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80077e:	8b 00                	mov    (%eax),%eax
+  800780:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800783:	89 c1                	mov    %eax,%ecx
+  800785:	c1 f9 1f             	sar    $0x1f,%ecx
+  800788:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80078b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80078e:	8d 40 04             	lea    0x4(%eax),%eax
+  800791:	89 45 14             	mov    %eax,0x14(%ebp)
+  800794:	eb 17                	jmp    8007ad <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  800796:	8b 45 14             	mov    0x14(%ebp),%eax
+  800799:	8b 50 04             	mov    0x4(%eax),%edx
+  80079c:	8b 00                	mov    (%eax),%eax
+  80079e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007a1:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8007a4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a7:	8d 40 08             	lea    0x8(%eax),%eax
+  8007aa:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  8007ad:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8007b0:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  8007b3:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  8007b8:	85 c9                	test   %ecx,%ecx
+  8007ba:	0f 89 03 01 00 00    	jns    8008c3 <vprintfmt+0x3bc>
+        putch('-', putdat);
+  8007c0:	83 ec 08             	sub    $0x8,%esp
+  8007c3:	53                   	push   %ebx
+  8007c4:	6a 2d                	push   $0x2d
+  8007c6:	ff d6                	call   *%esi
+        num = -(long long)num;
+  8007c8:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8007cb:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8007ce:	f7 da                	neg    %edx
+  8007d0:	83 d1 00             	adc    $0x0,%ecx
+  8007d3:	f7 d9                	neg    %ecx
+  8007d5:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  8007d8:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8007dd:	e9 e1 00 00 00       	jmp    8008c3 <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  8007e2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e5:	8b 00                	mov    (%eax),%eax
+  8007e7:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007ea:	89 c1                	mov    %eax,%ecx
+  8007ec:	c1 f9 1f             	sar    $0x1f,%ecx
+  8007ef:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8007f2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007f5:	8d 40 04             	lea    0x4(%eax),%eax
+  8007f8:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007fb:	eb b0                	jmp    8007ad <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  8007fd:	83 f9 01             	cmp    $0x1,%ecx
+  800800:	7f 1e                	jg     800820 <vprintfmt+0x319>
+  else if (lflag)
+  800802:	85 c9                	test   %ecx,%ecx
+  800804:	74 32                	je     800838 <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  800806:	8b 45 14             	mov    0x14(%ebp),%eax
+  800809:	8b 10                	mov    (%eax),%edx
+  80080b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800810:	8d 40 04             	lea    0x4(%eax),%eax
+  800813:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800816:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  80081b:	e9 a3 00 00 00       	jmp    8008c3 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800820:	8b 45 14             	mov    0x14(%ebp),%eax
+  800823:	8b 10                	mov    (%eax),%edx
+  800825:	8b 48 04             	mov    0x4(%eax),%ecx
+  800828:	8d 40 08             	lea    0x8(%eax),%eax
+  80082b:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  80082e:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  800833:	e9 8b 00 00 00       	jmp    8008c3 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800838:	8b 45 14             	mov    0x14(%ebp),%eax
+  80083b:	8b 10                	mov    (%eax),%edx
+  80083d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800842:	8d 40 04             	lea    0x4(%eax),%eax
+  800845:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800848:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  80084d:	eb 74                	jmp    8008c3 <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  80084f:	83 f9 01             	cmp    $0x1,%ecx
+  800852:	7f 1b                	jg     80086f <vprintfmt+0x368>
+  else if (lflag)
+  800854:	85 c9                	test   %ecx,%ecx
+  800856:	74 2c                	je     800884 <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  800858:	8b 45 14             	mov    0x14(%ebp),%eax
+  80085b:	8b 10                	mov    (%eax),%edx
+  80085d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800862:	8d 40 04             	lea    0x4(%eax),%eax
+  800865:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800868:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  80086d:	eb 54                	jmp    8008c3 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  80086f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800872:	8b 10                	mov    (%eax),%edx
+  800874:	8b 48 04             	mov    0x4(%eax),%ecx
+  800877:	8d 40 08             	lea    0x8(%eax),%eax
+  80087a:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  80087d:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  800882:	eb 3f                	jmp    8008c3 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800884:	8b 45 14             	mov    0x14(%ebp),%eax
+  800887:	8b 10                	mov    (%eax),%edx
+  800889:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80088e:	8d 40 04             	lea    0x4(%eax),%eax
+  800891:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800894:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  800899:	eb 28                	jmp    8008c3 <vprintfmt+0x3bc>
+      putch('0', putdat);
+  80089b:	83 ec 08             	sub    $0x8,%esp
+  80089e:	53                   	push   %ebx
+  80089f:	6a 30                	push   $0x30
+  8008a1:	ff d6                	call   *%esi
+      putch('x', putdat);
+  8008a3:	83 c4 08             	add    $0x8,%esp
+  8008a6:	53                   	push   %ebx
+  8008a7:	6a 78                	push   $0x78
+  8008a9:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  8008ab:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008ae:	8b 10                	mov    (%eax),%edx
+  8008b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  8008b5:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  8008b8:	8d 40 04             	lea    0x4(%eax),%eax
+  8008bb:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8008be:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  8008c3:	83 ec 0c             	sub    $0xc,%esp
+  8008c6:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8008ca:	50                   	push   %eax
+  8008cb:	ff 75 e0             	push   -0x20(%ebp)
+  8008ce:	57                   	push   %edi
+  8008cf:	51                   	push   %ecx
+  8008d0:	52                   	push   %edx
+  8008d1:	89 da                	mov    %ebx,%edx
+  8008d3:	89 f0                	mov    %esi,%eax
+  8008d5:	e8 4a fb ff ff       	call   800424 <printnum>
+      break;
+  8008da:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  8008dd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  8008e0:	e9 40 fc ff ff       	jmp    800525 <vprintfmt+0x1e>
+  if (lflag >= 2)
+  8008e5:	83 f9 01             	cmp    $0x1,%ecx
+  8008e8:	7f 1b                	jg     800905 <vprintfmt+0x3fe>
+  else if (lflag)
+  8008ea:	85 c9                	test   %ecx,%ecx
+  8008ec:	74 2c                	je     80091a <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  8008ee:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008f1:	8b 10                	mov    (%eax),%edx
+  8008f3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008f8:	8d 40 04             	lea    0x4(%eax),%eax
+  8008fb:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8008fe:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  800903:	eb be                	jmp    8008c3 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800905:	8b 45 14             	mov    0x14(%ebp),%eax
+  800908:	8b 10                	mov    (%eax),%edx
+  80090a:	8b 48 04             	mov    0x4(%eax),%ecx
+  80090d:	8d 40 08             	lea    0x8(%eax),%eax
+  800910:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800913:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  800918:	eb a9                	jmp    8008c3 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  80091a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80091d:	8b 10                	mov    (%eax),%edx
+  80091f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800924:	8d 40 04             	lea    0x4(%eax),%eax
+  800927:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  80092a:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  80092f:	eb 92                	jmp    8008c3 <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  800931:	83 ec 08             	sub    $0x8,%esp
+  800934:	53                   	push   %ebx
+  800935:	6a 25                	push   $0x25
+  800937:	ff d6                	call   *%esi
+      break;
+  800939:	83 c4 10             	add    $0x10,%esp
+  80093c:	eb 9f                	jmp    8008dd <vprintfmt+0x3d6>
+      putch('%', putdat);
+  80093e:	83 ec 08             	sub    $0x8,%esp
+  800941:	53                   	push   %ebx
+  800942:	6a 25                	push   $0x25
+  800944:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  800946:	83 c4 10             	add    $0x10,%esp
+  800949:	89 f8                	mov    %edi,%eax
+  80094b:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80094f:	74 05                	je     800956 <vprintfmt+0x44f>
+  800951:	83 e8 01             	sub    $0x1,%eax
+  800954:	eb f5                	jmp    80094b <vprintfmt+0x444>
+  800956:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800959:	eb 82                	jmp    8008dd <vprintfmt+0x3d6>
+
+0080095b <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80095b:	55                   	push   %ebp
+  80095c:	89 e5                	mov    %esp,%ebp
+  80095e:	83 ec 18             	sub    $0x18,%esp
+  800961:	8b 45 08             	mov    0x8(%ebp),%eax
+  800964:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  800967:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80096a:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80096e:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800971:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  800978:	85 c0                	test   %eax,%eax
+  80097a:	74 26                	je     8009a2 <vsnprintf+0x47>
+  80097c:	85 d2                	test   %edx,%edx
+  80097e:	7e 22                	jle    8009a2 <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800980:	ff 75 14             	push   0x14(%ebp)
+  800983:	ff 75 10             	push   0x10(%ebp)
+  800986:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800989:	50                   	push   %eax
+  80098a:	68 cd 04 80 00       	push   $0x8004cd
+  80098f:	e8 73 fb ff ff       	call   800507 <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800994:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800997:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  80099a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80099d:	83 c4 10             	add    $0x10,%esp
+}
+  8009a0:	c9                   	leave
+  8009a1:	c3                   	ret
+    return -E_INVAL;
+  8009a2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8009a7:	eb f7                	jmp    8009a0 <vsnprintf+0x45>
+
+008009a9 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8009a9:	55                   	push   %ebp
+  8009aa:	89 e5                	mov    %esp,%ebp
+  8009ac:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  8009af:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  8009b2:	50                   	push   %eax
+  8009b3:	ff 75 10             	push   0x10(%ebp)
+  8009b6:	ff 75 0c             	push   0xc(%ebp)
+  8009b9:	ff 75 08             	push   0x8(%ebp)
+  8009bc:	e8 9a ff ff ff       	call   80095b <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  8009c1:	c9                   	leave
+  8009c2:	c3                   	ret
+
+008009c3 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8009c3:	55                   	push   %ebp
+  8009c4:	89 e5                	mov    %esp,%ebp
+  8009c6:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  8009c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009ce:	eb 03                	jmp    8009d3 <strlen+0x10>
+    n++;
+  8009d0:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  8009d3:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8009d7:	75 f7                	jne    8009d0 <strlen+0xd>
+  return n;
+}
+  8009d9:	5d                   	pop    %ebp
+  8009da:	c3                   	ret
+
+008009db <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8009db:	55                   	push   %ebp
+  8009dc:	89 e5                	mov    %esp,%ebp
+  8009de:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8009e1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009e9:	eb 03                	jmp    8009ee <strnlen+0x13>
+    n++;
+  8009eb:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8009ee:	39 d0                	cmp    %edx,%eax
+  8009f0:	74 08                	je     8009fa <strnlen+0x1f>
+  8009f2:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8009f6:	75 f3                	jne    8009eb <strnlen+0x10>
+  8009f8:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  8009fa:	89 d0                	mov    %edx,%eax
+  8009fc:	5d                   	pop    %ebp
+  8009fd:	c3                   	ret
+
+008009fe <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8009fe:	55                   	push   %ebp
+  8009ff:	89 e5                	mov    %esp,%ebp
+  800a01:	53                   	push   %ebx
+  800a02:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a05:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  800a08:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a0d:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800a11:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800a14:	83 c0 01             	add    $0x1,%eax
+  800a17:	84 d2                	test   %dl,%dl
+  800a19:	75 f2                	jne    800a0d <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  800a1b:	89 c8                	mov    %ecx,%eax
+  800a1d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a20:	c9                   	leave
+  800a21:	c3                   	ret
+
+00800a22 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800a22:	55                   	push   %ebp
+  800a23:	89 e5                	mov    %esp,%ebp
+  800a25:	53                   	push   %ebx
+  800a26:	83 ec 10             	sub    $0x10,%esp
+  800a29:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  800a2c:	53                   	push   %ebx
+  800a2d:	e8 91 ff ff ff       	call   8009c3 <strlen>
+  800a32:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  800a35:	ff 75 0c             	push   0xc(%ebp)
+  800a38:	01 d8                	add    %ebx,%eax
+  800a3a:	50                   	push   %eax
+  800a3b:	e8 be ff ff ff       	call   8009fe <strcpy>
+  return dst;
+}
+  800a40:	89 d8                	mov    %ebx,%eax
+  800a42:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a45:	c9                   	leave
+  800a46:	c3                   	ret
+
+00800a47 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  800a47:	55                   	push   %ebp
+  800a48:	89 e5                	mov    %esp,%ebp
+  800a4a:	56                   	push   %esi
+  800a4b:	53                   	push   %ebx
+  800a4c:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a4f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  800a52:	89 f3                	mov    %esi,%ebx
+  800a54:	03 5d 10             	add    0x10(%ebp),%ebx
+  800a57:	89 f0                	mov    %esi,%eax
+  800a59:	eb 0f                	jmp    800a6a <strncpy+0x23>
+    *dst++ = *src;
+  800a5b:	83 c0 01             	add    $0x1,%eax
+  800a5e:	0f b6 0a             	movzbl (%edx),%ecx
+  800a61:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  800a64:	80 f9 01             	cmp    $0x1,%cl
+  800a67:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  800a6a:	39 d8                	cmp    %ebx,%eax
+  800a6c:	75 ed                	jne    800a5b <strncpy+0x14>
+  }
+  return ret;
+}
+  800a6e:	89 f0                	mov    %esi,%eax
+  800a70:	5b                   	pop    %ebx
+  800a71:	5e                   	pop    %esi
+  800a72:	5d                   	pop    %ebp
+  800a73:	c3                   	ret
+
+00800a74 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800a74:	55                   	push   %ebp
+  800a75:	89 e5                	mov    %esp,%ebp
+  800a77:	56                   	push   %esi
+  800a78:	53                   	push   %ebx
+  800a79:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a7c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a7f:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  800a82:	89 f0                	mov    %esi,%eax
+  800a84:	85 d2                	test   %edx,%edx
+  800a86:	74 21                	je     800aa9 <strlcpy+0x35>
+  800a88:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800a8c:	89 f2                	mov    %esi,%edx
+  800a8e:	eb 09                	jmp    800a99 <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  800a90:	83 c1 01             	add    $0x1,%ecx
+  800a93:	83 c2 01             	add    $0x1,%edx
+  800a96:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  800a99:	39 c2                	cmp    %eax,%edx
+  800a9b:	74 09                	je     800aa6 <strlcpy+0x32>
+  800a9d:	0f b6 19             	movzbl (%ecx),%ebx
+  800aa0:	84 db                	test   %bl,%bl
+  800aa2:	75 ec                	jne    800a90 <strlcpy+0x1c>
+  800aa4:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  800aa6:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  800aa9:	29 f0                	sub    %esi,%eax
+}
+  800aab:	5b                   	pop    %ebx
+  800aac:	5e                   	pop    %esi
+  800aad:	5d                   	pop    %ebp
+  800aae:	c3                   	ret
+
+00800aaf <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800aaf:	55                   	push   %ebp
+  800ab0:	89 e5                	mov    %esp,%ebp
+  800ab2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ab5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  800ab8:	eb 06                	jmp    800ac0 <strcmp+0x11>
+    p++, q++;
+  800aba:	83 c1 01             	add    $0x1,%ecx
+  800abd:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  800ac0:	0f b6 01             	movzbl (%ecx),%eax
+  800ac3:	84 c0                	test   %al,%al
+  800ac5:	74 04                	je     800acb <strcmp+0x1c>
+  800ac7:	3a 02                	cmp    (%edx),%al
+  800ac9:	74 ef                	je     800aba <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  800acb:	0f b6 c0             	movzbl %al,%eax
+  800ace:	0f b6 12             	movzbl (%edx),%edx
+  800ad1:	29 d0                	sub    %edx,%eax
+}
+  800ad3:	5d                   	pop    %ebp
+  800ad4:	c3                   	ret
+
+00800ad5 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800ad5:	55                   	push   %ebp
+  800ad6:	89 e5                	mov    %esp,%ebp
+  800ad8:	53                   	push   %ebx
+  800ad9:	8b 45 08             	mov    0x8(%ebp),%eax
+  800adc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800adf:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  800ae2:	eb 09                	jmp    800aed <strncmp+0x18>
+    n--, p++, q++;
+  800ae4:	83 ea 01             	sub    $0x1,%edx
+  800ae7:	83 c0 01             	add    $0x1,%eax
+  800aea:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  800aed:	85 d2                	test   %edx,%edx
+  800aef:	74 18                	je     800b09 <strncmp+0x34>
+  800af1:	0f b6 18             	movzbl (%eax),%ebx
+  800af4:	84 db                	test   %bl,%bl
+  800af6:	74 04                	je     800afc <strncmp+0x27>
+  800af8:	3a 19                	cmp    (%ecx),%bl
+  800afa:	74 e8                	je     800ae4 <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800afc:	0f b6 00             	movzbl (%eax),%eax
+  800aff:	0f b6 11             	movzbl (%ecx),%edx
+  800b02:	29 d0                	sub    %edx,%eax
+}
+  800b04:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b07:	c9                   	leave
+  800b08:	c3                   	ret
+    return 0;
+  800b09:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b0e:	eb f4                	jmp    800b04 <strncmp+0x2f>
+
+00800b10 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800b10:	55                   	push   %ebp
+  800b11:	89 e5                	mov    %esp,%ebp
+  800b13:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b16:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800b1a:	eb 03                	jmp    800b1f <strchr+0xf>
+  800b1c:	83 c0 01             	add    $0x1,%eax
+  800b1f:	0f b6 10             	movzbl (%eax),%edx
+  800b22:	84 d2                	test   %dl,%dl
+  800b24:	74 06                	je     800b2c <strchr+0x1c>
+    if (*s == c)
+  800b26:	38 ca                	cmp    %cl,%dl
+  800b28:	75 f2                	jne    800b1c <strchr+0xc>
+  800b2a:	eb 05                	jmp    800b31 <strchr+0x21>
+      return (char*)s;
+  return 0;
+  800b2c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b31:	5d                   	pop    %ebp
+  800b32:	c3                   	ret
+
+00800b33 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800b33:	55                   	push   %ebp
+  800b34:	89 e5                	mov    %esp,%ebp
+  800b36:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b39:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800b3d:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  800b40:	38 ca                	cmp    %cl,%dl
+  800b42:	74 09                	je     800b4d <strfind+0x1a>
+  800b44:	84 d2                	test   %dl,%dl
+  800b46:	74 05                	je     800b4d <strfind+0x1a>
+  for (; *s; s++)
+  800b48:	83 c0 01             	add    $0x1,%eax
+  800b4b:	eb f0                	jmp    800b3d <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  800b4d:	5d                   	pop    %ebp
+  800b4e:	c3                   	ret
+
+00800b4f <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800b4f:	55                   	push   %ebp
+  800b50:	89 e5                	mov    %esp,%ebp
+  800b52:	57                   	push   %edi
+  800b53:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b56:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  800b59:	85 c9                	test   %ecx,%ecx
+  800b5b:	74 20                	je     800b7d <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  800b5d:	89 f8                	mov    %edi,%eax
+  800b5f:	09 c8                	or     %ecx,%eax
+  800b61:	a8 03                	test   $0x3,%al
+  800b63:	75 12                	jne    800b77 <memset+0x28>
+    c &= 0xFF;
+  800b65:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800b69:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  800b6f:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  800b72:	fc                   	cld
+  800b73:	f3 ab                	rep stos %eax,%es:(%edi)
+  800b75:	eb 06                	jmp    800b7d <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  800b77:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b7a:	fc                   	cld
+  800b7b:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  800b7d:	89 f8                	mov    %edi,%eax
+  800b7f:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800b82:	c9                   	leave
+  800b83:	c3                   	ret
+
+00800b84 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800b84:	55                   	push   %ebp
+  800b85:	89 e5                	mov    %esp,%ebp
+  800b87:	57                   	push   %edi
+  800b88:	56                   	push   %esi
+  800b89:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b8c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b8f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  800b92:	39 c6                	cmp    %eax,%esi
+  800b94:	73 32                	jae    800bc8 <memmove+0x44>
+  800b96:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800b99:	39 d0                	cmp    %edx,%eax
+  800b9b:	73 2b                	jae    800bc8 <memmove+0x44>
+    s += n;
+    d += n;
+  800b9d:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800ba0:	89 d6                	mov    %edx,%esi
+  800ba2:	09 fe                	or     %edi,%esi
+  800ba4:	09 ce                	or     %ecx,%esi
+  800ba6:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800bac:	75 0e                	jne    800bbc <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800bae:	83 ef 04             	sub    $0x4,%edi
+  800bb1:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800bb4:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  800bb7:	fd                   	std
+  800bb8:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800bba:	eb 09                	jmp    800bc5 <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800bbc:	83 ef 01             	sub    $0x1,%edi
+  800bbf:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  800bc2:	fd                   	std
+  800bc3:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  800bc5:	fc                   	cld
+  800bc6:	eb 1a                	jmp    800be2 <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800bc8:	89 f2                	mov    %esi,%edx
+  800bca:	09 c2                	or     %eax,%edx
+  800bcc:	09 ca                	or     %ecx,%edx
+  800bce:	f6 c2 03             	test   $0x3,%dl
+  800bd1:	75 0a                	jne    800bdd <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800bd3:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  800bd6:	89 c7                	mov    %eax,%edi
+  800bd8:	fc                   	cld
+  800bd9:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800bdb:	eb 05                	jmp    800be2 <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  800bdd:	89 c7                	mov    %eax,%edi
+  800bdf:	fc                   	cld
+  800be0:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  800be2:	5e                   	pop    %esi
+  800be3:	5f                   	pop    %edi
+  800be4:	5d                   	pop    %ebp
+  800be5:	c3                   	ret
+
+00800be6 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800be6:	55                   	push   %ebp
+  800be7:	89 e5                	mov    %esp,%ebp
+  800be9:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  800bec:	ff 75 10             	push   0x10(%ebp)
+  800bef:	ff 75 0c             	push   0xc(%ebp)
+  800bf2:	ff 75 08             	push   0x8(%ebp)
+  800bf5:	e8 8a ff ff ff       	call   800b84 <memmove>
+}
+  800bfa:	c9                   	leave
+  800bfb:	c3                   	ret
+
+00800bfc <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800bfc:	55                   	push   %ebp
+  800bfd:	89 e5                	mov    %esp,%ebp
+  800bff:	56                   	push   %esi
+  800c00:	53                   	push   %ebx
+  800c01:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c04:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  800c07:	89 c6                	mov    %eax,%esi
+  800c09:	03 75 10             	add    0x10(%ebp),%esi
+  800c0c:	eb 06                	jmp    800c14 <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  800c0e:	83 c0 01             	add    $0x1,%eax
+  800c11:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  800c14:	39 f0                	cmp    %esi,%eax
+  800c16:	74 14                	je     800c2c <memcmp+0x30>
+    if (*s1 != *s2)
+  800c18:	0f b6 08             	movzbl (%eax),%ecx
+  800c1b:	0f b6 1a             	movzbl (%edx),%ebx
+  800c1e:	38 d9                	cmp    %bl,%cl
+  800c20:	74 ec                	je     800c0e <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  800c22:	0f b6 c1             	movzbl %cl,%eax
+  800c25:	0f b6 db             	movzbl %bl,%ebx
+  800c28:	29 d8                	sub    %ebx,%eax
+  800c2a:	eb 05                	jmp    800c31 <memcmp+0x35>
+  }
+
+  return 0;
+  800c2c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c31:	5b                   	pop    %ebx
+  800c32:	5e                   	pop    %esi
+  800c33:	5d                   	pop    %ebp
+  800c34:	c3                   	ret
+
+00800c35 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800c35:	55                   	push   %ebp
+  800c36:	89 e5                	mov    %esp,%ebp
+  800c38:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c3b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  800c3e:	89 c2                	mov    %eax,%edx
+  800c40:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  800c43:	eb 03                	jmp    800c48 <memfind+0x13>
+  800c45:	83 c0 01             	add    $0x1,%eax
+  800c48:	39 d0                	cmp    %edx,%eax
+  800c4a:	73 04                	jae    800c50 <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  800c4c:	38 08                	cmp    %cl,(%eax)
+  800c4e:	75 f5                	jne    800c45 <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  800c50:	5d                   	pop    %ebp
+  800c51:	c3                   	ret
+
+00800c52 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800c52:	55                   	push   %ebp
+  800c53:	89 e5                	mov    %esp,%ebp
+  800c55:	57                   	push   %edi
+  800c56:	56                   	push   %esi
+  800c57:	53                   	push   %ebx
+  800c58:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c5b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  800c5e:	eb 03                	jmp    800c63 <strtol+0x11>
+    s++;
+  800c60:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  800c63:	0f b6 02             	movzbl (%edx),%eax
+  800c66:	3c 20                	cmp    $0x20,%al
+  800c68:	74 f6                	je     800c60 <strtol+0xe>
+  800c6a:	3c 09                	cmp    $0x9,%al
+  800c6c:	74 f2                	je     800c60 <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  800c6e:	3c 2b                	cmp    $0x2b,%al
+  800c70:	74 2a                	je     800c9c <strtol+0x4a>
+  int neg = 0;
+  800c72:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  800c77:	3c 2d                	cmp    $0x2d,%al
+  800c79:	74 2b                	je     800ca6 <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c7b:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800c81:	75 0f                	jne    800c92 <strtol+0x40>
+  800c83:	80 3a 30             	cmpb   $0x30,(%edx)
+  800c86:	74 28                	je     800cb0 <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  800c88:	85 db                	test   %ebx,%ebx
+  800c8a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c8f:	0f 44 d8             	cmove  %eax,%ebx
+  800c92:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c97:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800c9a:	eb 46                	jmp    800ce2 <strtol+0x90>
+    s++;
+  800c9c:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  800c9f:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ca4:	eb d5                	jmp    800c7b <strtol+0x29>
+    s++, neg = 1;
+  800ca6:	83 c2 01             	add    $0x1,%edx
+  800ca9:	bf 01 00 00 00       	mov    $0x1,%edi
+  800cae:	eb cb                	jmp    800c7b <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800cb0:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800cb4:	74 0e                	je     800cc4 <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  800cb6:	85 db                	test   %ebx,%ebx
+  800cb8:	75 d8                	jne    800c92 <strtol+0x40>
+    s++, base = 8;
+  800cba:	83 c2 01             	add    $0x1,%edx
+  800cbd:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800cc2:	eb ce                	jmp    800c92 <strtol+0x40>
+    s += 2, base = 16;
+  800cc4:	83 c2 02             	add    $0x2,%edx
+  800cc7:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800ccc:	eb c4                	jmp    800c92 <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  800cce:	0f be c0             	movsbl %al,%eax
+  800cd1:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  800cd4:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800cd7:	7d 3a                	jge    800d13 <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  800cd9:	83 c2 01             	add    $0x1,%edx
+  800cdc:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800ce0:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  800ce2:	0f b6 02             	movzbl (%edx),%eax
+  800ce5:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800ce8:	89 f3                	mov    %esi,%ebx
+  800cea:	80 fb 09             	cmp    $0x9,%bl
+  800ced:	76 df                	jbe    800cce <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  800cef:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800cf2:	89 f3                	mov    %esi,%ebx
+  800cf4:	80 fb 19             	cmp    $0x19,%bl
+  800cf7:	77 08                	ja     800d01 <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  800cf9:	0f be c0             	movsbl %al,%eax
+  800cfc:	83 e8 57             	sub    $0x57,%eax
+  800cff:	eb d3                	jmp    800cd4 <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  800d01:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800d04:	89 f3                	mov    %esi,%ebx
+  800d06:	80 fb 19             	cmp    $0x19,%bl
+  800d09:	77 08                	ja     800d13 <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  800d0b:	0f be c0             	movsbl %al,%eax
+  800d0e:	83 e8 37             	sub    $0x37,%eax
+  800d11:	eb c1                	jmp    800cd4 <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  800d13:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800d17:	74 05                	je     800d1e <strtol+0xcc>
+    *endptr = (char*)s;
+  800d19:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d1c:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  800d1e:	89 c8                	mov    %ecx,%eax
+  800d20:	f7 d8                	neg    %eax
+  800d22:	85 ff                	test   %edi,%edi
+  800d24:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800d27:	89 c8                	mov    %ecx,%eax
+  800d29:	5b                   	pop    %ebx
+  800d2a:	5e                   	pop    %esi
+  800d2b:	5f                   	pop    %edi
+  800d2c:	5d                   	pop    %ebp
+  800d2d:	c3                   	ret
+
+00800d2e <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800d2e:	55                   	push   %ebp
+  800d2f:	89 e5                	mov    %esp,%ebp
+  800d31:	57                   	push   %edi
+  800d32:	56                   	push   %esi
+  800d33:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d34:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d39:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d3c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d3f:	89 c3                	mov    %eax,%ebx
+  800d41:	89 c7                	mov    %eax,%edi
+  800d43:	89 c6                	mov    %eax,%esi
+  800d45:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800d47:	5b                   	pop    %ebx
+  800d48:	5e                   	pop    %esi
+  800d49:	5f                   	pop    %edi
+  800d4a:	5d                   	pop    %ebp
+  800d4b:	c3                   	ret
+
+00800d4c <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800d4c:	55                   	push   %ebp
+  800d4d:	89 e5                	mov    %esp,%ebp
+  800d4f:	57                   	push   %edi
+  800d50:	56                   	push   %esi
+  800d51:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d52:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d57:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d5c:	89 d1                	mov    %edx,%ecx
+  800d5e:	89 d3                	mov    %edx,%ebx
+  800d60:	89 d7                	mov    %edx,%edi
+  800d62:	89 d6                	mov    %edx,%esi
+  800d64:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800d66:	5b                   	pop    %ebx
+  800d67:	5e                   	pop    %esi
+  800d68:	5f                   	pop    %edi
+  800d69:	5d                   	pop    %ebp
+  800d6a:	c3                   	ret
+
+00800d6b <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800d6b:	55                   	push   %ebp
+  800d6c:	89 e5                	mov    %esp,%ebp
+  800d6e:	57                   	push   %edi
+  800d6f:	56                   	push   %esi
+  800d70:	53                   	push   %ebx
+  800d71:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800d74:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d79:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d7c:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d81:	89 cb                	mov    %ecx,%ebx
+  800d83:	89 cf                	mov    %ecx,%edi
+  800d85:	89 ce                	mov    %ecx,%esi
+  800d87:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d89:	85 c0                	test   %eax,%eax
+  800d8b:	7f 08                	jg     800d95 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800d8d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d90:	5b                   	pop    %ebx
+  800d91:	5e                   	pop    %esi
+  800d92:	5f                   	pop    %edi
+  800d93:	5d                   	pop    %ebp
+  800d94:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d95:	83 ec 0c             	sub    $0xc,%esp
+  800d98:	50                   	push   %eax
+  800d99:	6a 03                	push   $0x3
+  800d9b:	68 e3 3f 80 00       	push   $0x803fe3
+  800da0:	6a 23                	push   $0x23
+  800da2:	68 00 40 80 00       	push   $0x804000
+  800da7:	e8 89 f5 ff ff       	call   800335 <_panic>
+
+00800dac <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800dac:	55                   	push   %ebp
+  800dad:	89 e5                	mov    %esp,%ebp
+  800daf:	57                   	push   %edi
+  800db0:	56                   	push   %esi
+  800db1:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800db2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800db7:	b8 02 00 00 00       	mov    $0x2,%eax
+  800dbc:	89 d1                	mov    %edx,%ecx
+  800dbe:	89 d3                	mov    %edx,%ebx
+  800dc0:	89 d7                	mov    %edx,%edi
+  800dc2:	89 d6                	mov    %edx,%esi
+  800dc4:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800dc6:	5b                   	pop    %ebx
+  800dc7:	5e                   	pop    %esi
+  800dc8:	5f                   	pop    %edi
+  800dc9:	5d                   	pop    %ebp
+  800dca:	c3                   	ret
+
+00800dcb <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800dcb:	55                   	push   %ebp
+  800dcc:	89 e5                	mov    %esp,%ebp
+  800dce:	57                   	push   %edi
+  800dcf:	56                   	push   %esi
+  800dd0:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800dd1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dd6:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800ddb:	89 d1                	mov    %edx,%ecx
+  800ddd:	89 d3                	mov    %edx,%ebx
+  800ddf:	89 d7                	mov    %edx,%edi
+  800de1:	89 d6                	mov    %edx,%esi
+  800de3:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800de5:	5b                   	pop    %ebx
+  800de6:	5e                   	pop    %esi
+  800de7:	5f                   	pop    %edi
+  800de8:	5d                   	pop    %ebp
+  800de9:	c3                   	ret
+
+00800dea <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  800dea:	55                   	push   %ebp
+  800deb:	89 e5                	mov    %esp,%ebp
+  800ded:	57                   	push   %edi
+  800dee:	56                   	push   %esi
+  800def:	53                   	push   %ebx
+  800df0:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  800df3:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  800df7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dfc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dff:	b8 14 00 00 00       	mov    $0x14,%eax
+  800e04:	89 df                	mov    %ebx,%edi
+  800e06:	89 de                	mov    %ebx,%esi
+  800e08:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e0a:	85 c0                	test   %eax,%eax
+  800e0c:	7f 08                	jg     800e16 <sys_env_set_cow+0x2c>
+}
+  800e0e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e11:	5b                   	pop    %ebx
+  800e12:	5e                   	pop    %esi
+  800e13:	5f                   	pop    %edi
+  800e14:	5d                   	pop    %ebp
+  800e15:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e16:	83 ec 0c             	sub    $0xc,%esp
+  800e19:	50                   	push   %eax
+  800e1a:	6a 14                	push   $0x14
+  800e1c:	68 e3 3f 80 00       	push   $0x803fe3
+  800e21:	6a 23                	push   $0x23
+  800e23:	68 00 40 80 00       	push   $0x804000
+  800e28:	e8 08 f5 ff ff       	call   800335 <_panic>
+
+00800e2d <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800e2d:	55                   	push   %ebp
+  800e2e:	89 e5                	mov    %esp,%ebp
+  800e30:	57                   	push   %edi
+  800e31:	56                   	push   %esi
+  800e32:	53                   	push   %ebx
+  800e33:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e36:	be 00 00 00 00       	mov    $0x0,%esi
+  800e3b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e3e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e41:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e46:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e49:	89 f7                	mov    %esi,%edi
+  800e4b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e4d:	85 c0                	test   %eax,%eax
+  800e4f:	7f 08                	jg     800e59 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  800e51:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e54:	5b                   	pop    %ebx
+  800e55:	5e                   	pop    %esi
+  800e56:	5f                   	pop    %edi
+  800e57:	5d                   	pop    %ebp
+  800e58:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e59:	83 ec 0c             	sub    $0xc,%esp
+  800e5c:	50                   	push   %eax
+  800e5d:	6a 04                	push   $0x4
+  800e5f:	68 e3 3f 80 00       	push   $0x803fe3
+  800e64:	6a 23                	push   $0x23
+  800e66:	68 00 40 80 00       	push   $0x804000
+  800e6b:	e8 c5 f4 ff ff       	call   800335 <_panic>
+
+00800e70 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800e70:	55                   	push   %ebp
+  800e71:	89 e5                	mov    %esp,%ebp
+  800e73:	57                   	push   %edi
+  800e74:	56                   	push   %esi
+  800e75:	53                   	push   %ebx
+  800e76:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e79:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e7c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e7f:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e84:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e87:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e8a:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e8d:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e8f:	85 c0                	test   %eax,%eax
+  800e91:	7f 08                	jg     800e9b <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  800e93:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e96:	5b                   	pop    %ebx
+  800e97:	5e                   	pop    %esi
+  800e98:	5f                   	pop    %edi
+  800e99:	5d                   	pop    %ebp
+  800e9a:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e9b:	83 ec 0c             	sub    $0xc,%esp
+  800e9e:	50                   	push   %eax
+  800e9f:	6a 05                	push   $0x5
+  800ea1:	68 e3 3f 80 00       	push   $0x803fe3
+  800ea6:	6a 23                	push   $0x23
+  800ea8:	68 00 40 80 00       	push   $0x804000
+  800ead:	e8 83 f4 ff ff       	call   800335 <_panic>
+
+00800eb2 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800eb2:	55                   	push   %ebp
+  800eb3:	89 e5                	mov    %esp,%ebp
+  800eb5:	57                   	push   %edi
+  800eb6:	56                   	push   %esi
+  800eb7:	53                   	push   %ebx
+  800eb8:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800ebb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ec0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ec6:	b8 06 00 00 00       	mov    $0x6,%eax
+  800ecb:	89 df                	mov    %ebx,%edi
+  800ecd:	89 de                	mov    %ebx,%esi
+  800ecf:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ed1:	85 c0                	test   %eax,%eax
+  800ed3:	7f 08                	jg     800edd <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  800ed5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ed8:	5b                   	pop    %ebx
+  800ed9:	5e                   	pop    %esi
+  800eda:	5f                   	pop    %edi
+  800edb:	5d                   	pop    %ebp
+  800edc:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800edd:	83 ec 0c             	sub    $0xc,%esp
+  800ee0:	50                   	push   %eax
+  800ee1:	6a 06                	push   $0x6
+  800ee3:	68 e3 3f 80 00       	push   $0x803fe3
+  800ee8:	6a 23                	push   $0x23
+  800eea:	68 00 40 80 00       	push   $0x804000
+  800eef:	e8 41 f4 ff ff       	call   800335 <_panic>
+
+00800ef4 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  800ef4:	55                   	push   %ebp
+  800ef5:	89 e5                	mov    %esp,%ebp
+  800ef7:	57                   	push   %edi
+  800ef8:	56                   	push   %esi
+  800ef9:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800efa:	8b 55 08             	mov    0x8(%ebp),%edx
+  800efd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f00:	b8 11 00 00 00       	mov    $0x11,%eax
+  800f05:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f08:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f0b:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f0e:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  800f10:	5b                   	pop    %ebx
+  800f11:	5e                   	pop    %esi
+  800f12:	5f                   	pop    %edi
+  800f13:	5d                   	pop    %ebp
+  800f14:	c3                   	ret
+
+00800f15 <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  800f15:	55                   	push   %ebp
+  800f16:	89 e5                	mov    %esp,%ebp
+  800f18:	57                   	push   %edi
+  800f19:	56                   	push   %esi
+  800f1a:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f1b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f1e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f21:	b8 12 00 00 00       	mov    $0x12,%eax
+  800f26:	be 00 00 00 00       	mov    $0x0,%esi
+  800f2b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f2e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f31:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  800f33:	5b                   	pop    %ebx
+  800f34:	5e                   	pop    %esi
+  800f35:	5f                   	pop    %edi
+  800f36:	5d                   	pop    %ebp
+  800f37:	c3                   	ret
+
+00800f38 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  800f38:	55                   	push   %ebp
+  800f39:	89 e5                	mov    %esp,%ebp
+  800f3b:	57                   	push   %edi
+  800f3c:	56                   	push   %esi
+  800f3d:	53                   	push   %ebx
+  800f3e:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f41:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f46:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f49:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f4c:	b8 16 00 00 00       	mov    $0x16,%eax
+  800f51:	89 df                	mov    %ebx,%edi
+  800f53:	89 de                	mov    %ebx,%esi
+  800f55:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f57:	85 c0                	test   %eax,%eax
+  800f59:	7f 08                	jg     800f63 <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  800f5b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f5e:	5b                   	pop    %ebx
+  800f5f:	5e                   	pop    %esi
+  800f60:	5f                   	pop    %edi
+  800f61:	5d                   	pop    %ebp
+  800f62:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f63:	83 ec 0c             	sub    $0xc,%esp
+  800f66:	50                   	push   %eax
+  800f67:	6a 16                	push   $0x16
+  800f69:	68 e3 3f 80 00       	push   $0x803fe3
+  800f6e:	6a 23                	push   $0x23
+  800f70:	68 00 40 80 00       	push   $0x804000
+  800f75:	e8 bb f3 ff ff       	call   800335 <_panic>
+
+00800f7a <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  800f7a:	55                   	push   %ebp
+  800f7b:	89 e5                	mov    %esp,%ebp
+  800f7d:	57                   	push   %edi
+  800f7e:	56                   	push   %esi
+  800f7f:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f80:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f85:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f88:	b8 17 00 00 00       	mov    $0x17,%eax
+  800f8d:	89 cb                	mov    %ecx,%ebx
+  800f8f:	89 cf                	mov    %ecx,%edi
+  800f91:	89 ce                	mov    %ecx,%esi
+  800f93:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  800f95:	5b                   	pop    %ebx
+  800f96:	5e                   	pop    %esi
+  800f97:	5f                   	pop    %edi
+  800f98:	5d                   	pop    %ebp
+  800f99:	c3                   	ret
+
+00800f9a <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  800f9a:	55                   	push   %ebp
+  800f9b:	89 e5                	mov    %esp,%ebp
+  800f9d:	57                   	push   %edi
+  800f9e:	56                   	push   %esi
+  800f9f:	53                   	push   %ebx
+  800fa0:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800fa3:	be 00 00 00 00       	mov    $0x0,%esi
+  800fa8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fae:	b8 18 00 00 00       	mov    $0x18,%eax
+  800fb3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fb6:	89 f7                	mov    %esi,%edi
+  800fb8:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800fba:	85 c0                	test   %eax,%eax
+  800fbc:	7f 08                	jg     800fc6 <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  800fbe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fc1:	5b                   	pop    %ebx
+  800fc2:	5e                   	pop    %esi
+  800fc3:	5f                   	pop    %edi
+  800fc4:	5d                   	pop    %ebp
+  800fc5:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800fc6:	83 ec 0c             	sub    $0xc,%esp
+  800fc9:	50                   	push   %eax
+  800fca:	6a 18                	push   $0x18
+  800fcc:	68 e3 3f 80 00       	push   $0x803fe3
+  800fd1:	6a 23                	push   $0x23
+  800fd3:	68 00 40 80 00       	push   $0x804000
+  800fd8:	e8 58 f3 ff ff       	call   800335 <_panic>
+
+00800fdd <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  800fdd:	55                   	push   %ebp
+  800fde:	89 e5                	mov    %esp,%ebp
+  800fe0:	57                   	push   %edi
+  800fe1:	56                   	push   %esi
+  800fe2:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800fe3:	be 00 00 00 00       	mov    $0x0,%esi
+  800fe8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800feb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fee:	b8 19 00 00 00       	mov    $0x19,%eax
+  800ff3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ff6:	89 f7                	mov    %esi,%edi
+  800ff8:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  800ffa:	5b                   	pop    %ebx
+  800ffb:	5e                   	pop    %esi
+  800ffc:	5f                   	pop    %edi
+  800ffd:	5d                   	pop    %ebp
+  800ffe:	c3                   	ret
+
+00800fff <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  800fff:	55                   	push   %ebp
+  801000:	89 e5                	mov    %esp,%ebp
+  801002:	57                   	push   %edi
+  801003:	56                   	push   %esi
+  801004:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801005:	ba 00 00 00 00       	mov    $0x0,%edx
+  80100a:	b8 15 00 00 00       	mov    $0x15,%eax
+  80100f:	89 d1                	mov    %edx,%ecx
+  801011:	89 d3                	mov    %edx,%ebx
+  801013:	89 d7                	mov    %edx,%edi
+  801015:	89 d6                	mov    %edx,%esi
+  801017:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  801019:	5b                   	pop    %ebx
+  80101a:	5e                   	pop    %esi
+  80101b:	5f                   	pop    %edi
+  80101c:	5d                   	pop    %ebp
+  80101d:	c3                   	ret
+
+0080101e <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  80101e:	55                   	push   %ebp
+  80101f:	89 e5                	mov    %esp,%ebp
+  801021:	57                   	push   %edi
+  801022:	56                   	push   %esi
+  801023:	53                   	push   %ebx
+  801024:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801027:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80102c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80102f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801032:	b8 08 00 00 00       	mov    $0x8,%eax
+  801037:	89 df                	mov    %ebx,%edi
+  801039:	89 de                	mov    %ebx,%esi
+  80103b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80103d:	85 c0                	test   %eax,%eax
+  80103f:	7f 08                	jg     801049 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801041:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801044:	5b                   	pop    %ebx
+  801045:	5e                   	pop    %esi
+  801046:	5f                   	pop    %edi
+  801047:	5d                   	pop    %ebp
+  801048:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801049:	83 ec 0c             	sub    $0xc,%esp
+  80104c:	50                   	push   %eax
+  80104d:	6a 08                	push   $0x8
+  80104f:	68 e3 3f 80 00       	push   $0x803fe3
+  801054:	6a 23                	push   $0x23
+  801056:	68 00 40 80 00       	push   $0x804000
+  80105b:	e8 d5 f2 ff ff       	call   800335 <_panic>
+
+00801060 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801060:	55                   	push   %ebp
+  801061:	89 e5                	mov    %esp,%ebp
+  801063:	57                   	push   %edi
+  801064:	56                   	push   %esi
+  801065:	53                   	push   %ebx
+  801066:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801069:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80106e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801071:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801074:	b8 09 00 00 00       	mov    $0x9,%eax
+  801079:	89 df                	mov    %ebx,%edi
+  80107b:	89 de                	mov    %ebx,%esi
+  80107d:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80107f:	85 c0                	test   %eax,%eax
+  801081:	7f 08                	jg     80108b <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  801083:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801086:	5b                   	pop    %ebx
+  801087:	5e                   	pop    %esi
+  801088:	5f                   	pop    %edi
+  801089:	5d                   	pop    %ebp
+  80108a:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80108b:	83 ec 0c             	sub    $0xc,%esp
+  80108e:	50                   	push   %eax
+  80108f:	6a 09                	push   $0x9
+  801091:	68 e3 3f 80 00       	push   $0x803fe3
+  801096:	6a 23                	push   $0x23
+  801098:	68 00 40 80 00       	push   $0x804000
+  80109d:	e8 93 f2 ff ff       	call   800335 <_panic>
+
+008010a2 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8010a2:	55                   	push   %ebp
+  8010a3:	89 e5                	mov    %esp,%ebp
+  8010a5:	57                   	push   %edi
+  8010a6:	56                   	push   %esi
+  8010a7:	53                   	push   %ebx
+  8010a8:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8010ab:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010b0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010b6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010bb:	89 df                	mov    %ebx,%edi
+  8010bd:	89 de                	mov    %ebx,%esi
+  8010bf:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8010c1:	85 c0                	test   %eax,%eax
+  8010c3:	7f 08                	jg     8010cd <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  8010c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010c8:	5b                   	pop    %ebx
+  8010c9:	5e                   	pop    %esi
+  8010ca:	5f                   	pop    %edi
+  8010cb:	5d                   	pop    %ebp
+  8010cc:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8010cd:	83 ec 0c             	sub    $0xc,%esp
+  8010d0:	50                   	push   %eax
+  8010d1:	6a 0a                	push   $0xa
+  8010d3:	68 e3 3f 80 00       	push   $0x803fe3
+  8010d8:	6a 23                	push   $0x23
+  8010da:	68 00 40 80 00       	push   $0x804000
+  8010df:	e8 51 f2 ff ff       	call   800335 <_panic>
+
+008010e4 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  8010e4:	55                   	push   %ebp
+  8010e5:	89 e5                	mov    %esp,%ebp
+  8010e7:	57                   	push   %edi
+  8010e8:	56                   	push   %esi
+  8010e9:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8010ea:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ed:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010f0:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010f5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010f8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010fb:	8b 75 18             	mov    0x18(%ebp),%esi
+  8010fe:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  801100:	5b                   	pop    %ebx
+  801101:	5e                   	pop    %esi
+  801102:	5f                   	pop    %edi
+  801103:	5d                   	pop    %ebp
+  801104:	c3                   	ret
+
+00801105 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  801105:	55                   	push   %ebp
+  801106:	89 e5                	mov    %esp,%ebp
+  801108:	57                   	push   %edi
+  801109:	56                   	push   %esi
+  80110a:	53                   	push   %ebx
+  80110b:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80110e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801113:	8b 55 08             	mov    0x8(%ebp),%edx
+  801116:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801119:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80111e:	89 df                	mov    %ebx,%edi
+  801120:	89 de                	mov    %ebx,%esi
+  801122:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801124:	85 c0                	test   %eax,%eax
+  801126:	7f 08                	jg     801130 <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  801128:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80112b:	5b                   	pop    %ebx
+  80112c:	5e                   	pop    %esi
+  80112d:	5f                   	pop    %edi
+  80112e:	5d                   	pop    %ebp
+  80112f:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801130:	83 ec 0c             	sub    $0xc,%esp
+  801133:	50                   	push   %eax
+  801134:	6a 0d                	push   $0xd
+  801136:	68 e3 3f 80 00       	push   $0x803fe3
+  80113b:	6a 23                	push   $0x23
+  80113d:	68 00 40 80 00       	push   $0x804000
+  801142:	e8 ee f1 ff ff       	call   800335 <_panic>
+
+00801147 <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  801147:	55                   	push   %ebp
+  801148:	89 e5                	mov    %esp,%ebp
+  80114a:	57                   	push   %edi
+  80114b:	56                   	push   %esi
+  80114c:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80114d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801152:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801157:	89 d1                	mov    %edx,%ecx
+  801159:	89 d3                	mov    %edx,%ebx
+  80115b:	89 d7                	mov    %edx,%edi
+  80115d:	89 d6                	mov    %edx,%esi
+  80115f:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801161:	5b                   	pop    %ebx
+  801162:	5e                   	pop    %esi
+  801163:	5f                   	pop    %edi
+  801164:	5d                   	pop    %ebp
+  801165:	c3                   	ret
+
+00801166 <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  801166:	55                   	push   %ebp
+  801167:	89 e5                	mov    %esp,%ebp
+  801169:	57                   	push   %edi
+  80116a:	56                   	push   %esi
+  80116b:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80116c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80116f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801172:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801177:	be 00 00 00 00       	mov    $0x0,%esi
+  80117c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80117f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801182:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  801184:	5b                   	pop    %ebx
+  801185:	5e                   	pop    %esi
+  801186:	5f                   	pop    %edi
+  801187:	5d                   	pop    %ebp
+  801188:	c3                   	ret
+
+00801189 <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  801189:	55                   	push   %ebp
+  80118a:	89 e5                	mov    %esp,%ebp
+  80118c:	57                   	push   %edi
+  80118d:	56                   	push   %esi
+  80118e:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80118f:	be 00 00 00 00       	mov    $0x0,%esi
+  801194:	8b 55 08             	mov    0x8(%ebp),%edx
+  801197:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80119a:	b8 10 00 00 00       	mov    $0x10,%eax
+  80119f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011a2:	89 f7                	mov    %esi,%edi
+  8011a4:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  8011a6:	5b                   	pop    %ebx
+  8011a7:	5e                   	pop    %esi
+  8011a8:	5f                   	pop    %edi
+  8011a9:	5d                   	pop    %ebp
+  8011aa:	c3                   	ret
+
+008011ab <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  8011ab:	55                   	push   %ebp
+  8011ac:	89 e5                	mov    %esp,%ebp
+  8011ae:	57                   	push   %edi
+  8011af:	56                   	push   %esi
+  8011b0:	53                   	push   %ebx
+  8011b1:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  8011b4:	80 3d 04 b0 80 00 00 	cmpb   $0x0,0x80b004
+  8011bb:	74 41                	je     8011fe <sys_batch+0x53>
+  8011bd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011c0:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  8011c3:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  8011ca:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8011cd:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  8011d0:	7d 45                	jge    801217 <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  8011d2:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8011d5:	8b 06                	mov    (%esi),%eax
+  8011d7:	8b 56 04             	mov    0x4(%esi),%edx
+  8011da:	8b 4e 08             	mov    0x8(%esi),%ecx
+  8011dd:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  8011e0:	8b 7e 10             	mov    0x10(%esi),%edi
+  8011e3:	8b 76 14             	mov    0x14(%esi),%esi
+  8011e6:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  8011e8:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8011eb:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  8011ee:	83 c6 1c             	add    $0x1c,%esi
+  8011f1:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  8011f4:	85 c0                	test   %eax,%eax
+  8011f6:	78 1f                	js     801217 <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  8011f8:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  8011fc:	eb cc                	jmp    8011ca <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  8011fe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801203:	b8 13 00 00 00       	mov    $0x13,%eax
+  801208:	8b 55 08             	mov    0x8(%ebp),%edx
+  80120b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80120e:	89 df                	mov    %ebx,%edi
+  801210:	89 de                	mov    %ebx,%esi
+  801212:	cd 30                	int    $0x30
+  801214:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  801217:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80121a:	83 c4 08             	add    $0x8,%esp
+  80121d:	5b                   	pop    %ebx
+  80121e:	5e                   	pop    %esi
+  80121f:	5f                   	pop    %edi
+  801220:	5d                   	pop    %ebp
+  801221:	c3                   	ret
+
+00801222 <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  801222:	55                   	push   %ebp
+  801223:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  801225:	8b 45 08             	mov    0x8(%ebp),%eax
+  801228:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  80122e:	5d                   	pop    %ebp
+  80122f:	c3                   	ret
+
+00801230 <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  801230:	55                   	push   %ebp
+  801231:	89 e5                	mov    %esp,%ebp
+  801233:	56                   	push   %esi
+  801234:	53                   	push   %ebx
+  801235:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  801238:	8b 1e                	mov    (%esi),%ebx
+  80123a:	85 db                	test   %ebx,%ebx
+  80123c:	75 09                	jne    801247 <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  80123e:	89 d8                	mov    %ebx,%eax
+  801240:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801243:	5b                   	pop    %ebx
+  801244:	5e                   	pop    %esi
+  801245:	5d                   	pop    %ebp
+  801246:	c3                   	ret
+  b->sb_n = 0;
+  801247:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  80124d:	53                   	push   %ebx
+  80124e:	8d 46 04             	lea    0x4(%esi),%eax
+  801251:	50                   	push   %eax
+  801252:	e8 54 ff ff ff       	call   8011ab <sys_batch>
+  801257:	83 c4 08             	add    $0x8,%esp
+  80125a:	85 c0                	test   %eax,%eax
+  80125c:	78 1e                	js     80127c <sysbatch_flush+0x4c>
+  if (r < n)
+  80125e:	39 c3                	cmp    %eax,%ebx
+  801260:	7f 07                	jg     801269 <sysbatch_flush+0x39>
+  return 0;
+  801262:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801267:	eb d5                	jmp    80123e <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  801269:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80126c:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  801270:	85 db                	test   %ebx,%ebx
+  801272:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801277:	0f 49 d8             	cmovns %eax,%ebx
+  80127a:	eb c2                	jmp    80123e <sysbatch_flush+0xe>
+    return r;
+  80127c:	89 c3                	mov    %eax,%ebx
+  80127e:	eb be                	jmp    80123e <sysbatch_flush+0xe>
+
+00801280 <sysbatch_add>:
+{
+  801280:	55                   	push   %ebp
+  801281:	89 e5                	mov    %esp,%ebp
+  801283:	53                   	push   %ebx
+  801284:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  801287:	83 3b 40             	cmpl   $0x40,(%ebx)
+  80128a:	74 41                	je     8012cd <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  80128c:	8b 03                	mov    (%ebx),%eax
+  80128e:	8d 50 01             	lea    0x1(%eax),%edx
+  801291:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  801293:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801296:	01 d8                	add    %ebx,%eax
+  801298:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80129b:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  80129e:	8b 55 10             	mov    0x10(%ebp),%edx
+  8012a1:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  8012a4:	8b 55 14             	mov    0x14(%ebp),%edx
+  8012a7:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  8012aa:	8b 55 18             	mov    0x18(%ebp),%edx
+  8012ad:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  8012b0:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  8012b3:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  8012b6:	8b 55 20             	mov    0x20(%ebp),%edx
+  8012b9:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  8012bc:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  8012c3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8012c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012cb:	c9                   	leave
+  8012cc:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  8012cd:	53                   	push   %ebx
+  8012ce:	e8 5d ff ff ff       	call   801230 <sysbatch_flush>
+  8012d3:	83 c4 04             	add    $0x4,%esp
+  8012d6:	85 c0                	test   %eax,%eax
+  8012d8:	79 b2                	jns    80128c <sysbatch_add+0xc>
+  8012da:	eb ec                	jmp    8012c8 <sysbatch_add+0x48>
+
+008012dc <pgfault>:
+// Custom page fault handler - if faulting page is copy-on-write,
+// map in our own private writable copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  8012dc:	55                   	push   %ebp
+  8012dd:	89 e5                	mov    %esp,%ebp
+  8012df:	56                   	push   %esi
+  8012e0:	53                   	push   %ebx
+  8012e1:	8b 45 08             	mov    0x8(%ebp),%eax
+  void *addr = (void*)utf->utf_fault_va;
+  8012e4:	8b 18                	mov    (%eax),%ebx
+  uint32_t err = utf->utf_err;
+  8012e6:	8b 70 04             	mov    0x4(%eax),%esi
+  // Hint:
+  //   Use the read-only page table mappings at uvpt
+  //   (see <inc/memlayout.h>).
+
+  // Faults in file mappings are mmap's to handle.
+  if (mmap_fault(utf))
+  8012e9:	83 ec 0c             	sub    $0xc,%esp
+  8012ec:	50                   	push   %eax
+  8012ed:	e8 05 1e 00 00       	call   8030f7 <mmap_fault>
+  8012f2:	83 c4 10             	add    $0x10,%esp
+  8012f5:	84 c0                	test   %al,%al
+  8012f7:	75 7d                	jne    801376 <pgfault+0x9a>
+    return;
+
+  // LAB 4: Your code here.
+  if ( !(err & FEC_WR) ) {
+  8012f9:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  8012ff:	74 7c                	je     80137d <pgfault+0xa1>
+    panic("user_pgfault: %e", err);
+  }
+
+  if ( !(uvpt[PGNUM(addr)] & PTE_COW) ) {
+  801301:	89 d8                	mov    %ebx,%eax
+  801303:	c1 e8 0c             	shr    $0xc,%eax
+  801306:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80130d:	f6 c4 08             	test   $0x8,%ah
+  801310:	74 7d                	je     80138f <pgfault+0xb3>
+  // page to the old page's address.
+  // Hint:
+  //   You should make three system calls.
+
+  // LAB 4: Your code here.
+  addr = ROUNDDOWN(addr, PGSIZE);
+  801312:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+
+  // map page to temporary location
+  if ( (r = sys_page_alloc(0, PFTEMP, (PTE_P | PTE_U | PTE_W))) < 0) {
+  801318:	83 ec 04             	sub    $0x4,%esp
+  80131b:	6a 07                	push   $0x7
+  80131d:	68 00 f0 7f 00       	push   $0x7ff000
+  801322:	6a 00                	push   $0x0
+  801324:	e8 04 fb ff ff       	call   800e2d <sys_page_alloc>
+  801329:	83 c4 10             	add    $0x10,%esp
+  80132c:	85 c0                	test   %eax,%eax
+  80132e:	78 73                	js     8013a3 <pgfault+0xc7>
+    panic("sys_page_alloc: %e", r);
+  }
+
+  // copy data from old page to new page
+  memmove(PFTEMP, addr, PGSIZE);
+  801330:	83 ec 04             	sub    $0x4,%esp
+  801333:	68 00 10 00 00       	push   $0x1000
+  801338:	53                   	push   %ebx
+  801339:	68 00 f0 7f 00       	push   $0x7ff000
+  80133e:	e8 41 f8 ff ff       	call   800b84 <memmove>
+
+  // move new page to old page address
+  if ( (r = sys_page_map(0, PFTEMP, 0, addr, (PTE_P | PTE_U | PTE_W))) < 0) {
+  801343:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  80134a:	53                   	push   %ebx
+  80134b:	6a 00                	push   $0x0
+  80134d:	68 00 f0 7f 00       	push   $0x7ff000
+  801352:	6a 00                	push   $0x0
+  801354:	e8 17 fb ff ff       	call   800e70 <sys_page_map>
+  801359:	83 c4 20             	add    $0x20,%esp
+  80135c:	85 c0                	test   %eax,%eax
+  80135e:	78 55                	js     8013b5 <pgfault+0xd9>
+    panic("sys_page_map: %e", r);
+  }
+
+  if ( (r = sys_page_unmap(0, PFTEMP)) < 0) {
+  801360:	83 ec 08             	sub    $0x8,%esp
+  801363:	68 00 f0 7f 00       	push   $0x7ff000
+  801368:	6a 00                	push   $0x0
+  80136a:	e8 43 fb ff ff       	call   800eb2 <sys_page_unmap>
+  80136f:	83 c4 10             	add    $0x10,%esp
+  801372:	85 c0                	test   %eax,%eax
+  801374:	78 51                	js     8013c7 <pgfault+0xeb>
+    panic("sys_page_unmap: %e", r);
+  }
+}
+  801376:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801379:	5b                   	pop    %ebx
+  80137a:	5e                   	pop    %esi
+  80137b:	5d                   	pop    %ebp
+  80137c:	c3                   	ret
+    panic("user_pgfault: %e", err);
+  80137d:	56                   	push   %esi
+  80137e:	68 0e 40 80 00       	push   $0x80400e
+  801383:	6a 1d                	push   $0x1d
+  801385:	68 1f 40 80 00       	push   $0x80401f
+  80138a:	e8 a6 ef ff ff       	call   800335 <_panic>
+    panic("user_pgfault: page not COW");
+  80138f:	83 ec 04             	sub    $0x4,%esp
+  801392:	68 2a 40 80 00       	push   $0x80402a
+  801397:	6a 21                	push   $0x21
+  801399:	68 1f 40 80 00       	push   $0x80401f
+  80139e:	e8 92 ef ff ff       	call   800335 <_panic>
+    panic("sys_page_alloc: %e", r);
+  8013a3:	50                   	push   %eax
+  8013a4:	68 0e 3c 80 00       	push   $0x803c0e
+  8013a9:	6a 2f                	push   $0x2f
+  8013ab:	68 1f 40 80 00       	push   $0x80401f
+  8013b0:	e8 80 ef ff ff       	call   800335 <_panic>
+    panic("sys_page_map: %e", r);
+  8013b5:	50                   	push   %eax
+  8013b6:	68 45 40 80 00       	push   $0x804045
+  8013bb:	6a 37                	push   $0x37
+  8013bd:	68 1f 40 80 00       	push   $0x80401f
+  8013c2:	e8 6e ef ff ff       	call   800335 <_panic>
+    panic("sys_page_unmap: %e", r);
+  8013c7:	50                   	push   %eax
+  8013c8:	68 56 40 80 00       	push   $0x804056
+  8013cd:	6a 3b                	push   $0x3b
+  8013cf:	68 1f 40 80 00       	push   $0x80401f
+  8013d4:	e8 5c ef ff ff       	call   800335 <_panic>
+
+008013d9 <shared_pgfault>:
+
+// Challenge!
+//
+static void
+shared_pgfault(struct UTrapframe *utf)
+{
+  8013d9:	55                   	push   %ebp
+  8013da:	89 e5                	mov    %esp,%ebp
+  8013dc:	53                   	push   %ebx
+  8013dd:	83 ec 10             	sub    $0x10,%esp
+  8013e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  // just has fewer error checks
+  
+  void *addr = (void*)utf->utf_fault_va;
+  8013e3:	8b 18                	mov    (%eax),%ebx
+  uint32_t err = utf->utf_err;
+  int r;
+
+  if (mmap_fault(utf))
+  8013e5:	50                   	push   %eax
+  8013e6:	e8 0c 1d 00 00       	call   8030f7 <mmap_fault>
+  8013eb:	83 c4 10             	add    $0x10,%esp
+  8013ee:	84 c0                	test   %al,%al
+  8013f0:	74 05                	je     8013f7 <shared_pgfault+0x1e>
+  }
+
+  if ( (r = sys_page_unmap(0, PFTEMP)) < 0) {
+    panic("sys_page_unmap: %e", r);
+  }
+}
+  8013f2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013f5:	c9                   	leave
+  8013f6:	c3                   	ret
+  addr = ROUNDDOWN(addr, PGSIZE);
+  8013f7:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if ( (r = sys_page_alloc(0, PFTEMP, (PTE_P | PTE_U | PTE_W))) < 0) {
+  8013fd:	83 ec 04             	sub    $0x4,%esp
+  801400:	6a 07                	push   $0x7
+  801402:	68 00 f0 7f 00       	push   $0x7ff000
+  801407:	6a 00                	push   $0x0
+  801409:	e8 1f fa ff ff       	call   800e2d <sys_page_alloc>
+  80140e:	83 c4 10             	add    $0x10,%esp
+  801411:	85 c0                	test   %eax,%eax
+  801413:	78 5b                	js     801470 <shared_pgfault+0x97>
+  memmove(PFTEMP, addr, PGSIZE);
+  801415:	83 ec 04             	sub    $0x4,%esp
+  801418:	68 00 10 00 00       	push   $0x1000
+  80141d:	53                   	push   %ebx
+  80141e:	68 00 f0 7f 00       	push   $0x7ff000
+  801423:	e8 5c f7 ff ff       	call   800b84 <memmove>
+  if ( (r = sys_page_map(0, PFTEMP, 0, addr, (PTE_P | PTE_U | PTE_W))) < 0) {
+  801428:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  80142f:	53                   	push   %ebx
+  801430:	6a 00                	push   $0x0
+  801432:	68 00 f0 7f 00       	push   $0x7ff000
+  801437:	6a 00                	push   $0x0
+  801439:	e8 32 fa ff ff       	call   800e70 <sys_page_map>
+  80143e:	83 c4 20             	add    $0x20,%esp
+  801441:	85 c0                	test   %eax,%eax
+  801443:	78 40                	js     801485 <shared_pgfault+0xac>
+  if ( (r = sys_page_unmap(0, PFTEMP)) < 0) {
+  801445:	83 ec 08             	sub    $0x8,%esp
+  801448:	68 00 f0 7f 00       	push   $0x7ff000
+  80144d:	6a 00                	push   $0x0
+  80144f:	e8 5e fa ff ff       	call   800eb2 <sys_page_unmap>
+  801454:	83 c4 10             	add    $0x10,%esp
+  801457:	85 c0                	test   %eax,%eax
+  801459:	79 97                	jns    8013f2 <shared_pgfault+0x19>
+    panic("sys_page_unmap: %e", r);
+  80145b:	50                   	push   %eax
+  80145c:	68 56 40 80 00       	push   $0x804056
+  801461:	68 b0 00 00 00       	push   $0xb0
+  801466:	68 1f 40 80 00       	push   $0x80401f
+  80146b:	e8 c5 ee ff ff       	call   800335 <_panic>
+    panic("sys_page_alloc: %e", r);
+  801470:	50                   	push   %eax
+  801471:	68 0e 3c 80 00       	push   $0x803c0e
+  801476:	68 a4 00 00 00       	push   $0xa4
+  80147b:	68 1f 40 80 00       	push   $0x80401f
+  801480:	e8 b0 ee ff ff       	call   800335 <_panic>
+    panic("sys_page_map: %e", r);
+  801485:	50                   	push   %eax
+  801486:	68 45 40 80 00       	push   $0x804045
+  80148b:	68 ac 00 00 00       	push   $0xac
+  801490:	68 1f 40 80 00       	push   $0x80401f
+  801495:	e8 9b ee ff ff       	call   800335 <_panic>
+
+0080149a <fork>:
+{
+  80149a:	55                   	push   %ebp
+  80149b:	89 e5                	mov    %esp,%ebp
+  80149d:	53                   	push   %ebx
+  80149e:	83 ec 04             	sub    $0x4,%esp
+  parent_id = sys_getenvid();
+  8014a1:	e8 06 f9 ff ff       	call   800dac <sys_getenvid>
+  set_pgfault_handler(pgfault);
+  8014a6:	83 ec 0c             	sub    $0xc,%esp
+  8014a9:	68 dc 12 80 00       	push   $0x8012dc
+  8014ae:	e8 d3 22 00 00       	call   803786 <set_pgfault_handler>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+  envid_t ret;
+  __asm __volatile("int %2"
+  8014b3:	b8 07 00 00 00       	mov    $0x7,%eax
+  8014b8:	cd 30                	int    $0x30
+  8014ba:	89 c3                	mov    %eax,%ebx
+  if (envid < 0) {
+  8014bc:	83 c4 10             	add    $0x10,%esp
+  8014bf:	85 c0                	test   %eax,%eax
+  8014c1:	78 66                	js     801529 <fork+0x8f>
+  } else if (envid == 0) {
+  8014c3:	74 76                	je     80153b <fork+0xa1>
+  if ( (error = sys_page_map_range(0, 0, UXSTACKTOP - PGSIZE,
+  8014c5:	83 ec 0c             	sub    $0xc,%esp
+  8014c8:	6a 01                	push   $0x1
+  8014ca:	50                   	push   %eax
+  8014cb:	68 00 f0 bf ee       	push   $0xeebff000
+  8014d0:	6a 00                	push   $0x0
+  8014d2:	6a 00                	push   $0x0
+  8014d4:	e8 1b fa ff ff       	call   800ef4 <sys_page_map_range>
+  8014d9:	83 c4 20             	add    $0x20,%esp
+  8014dc:	85 c0                	test   %eax,%eax
+  8014de:	78 77                	js     801557 <fork+0xbd>
+  if ( (error = sys_page_alloc(envid,
+  8014e0:	83 ec 04             	sub    $0x4,%esp
+  8014e3:	6a 07                	push   $0x7
+  8014e5:	68 00 f0 bf ee       	push   $0xeebff000
+  8014ea:	53                   	push   %ebx
+  8014eb:	e8 3d f9 ff ff       	call   800e2d <sys_page_alloc>
+  8014f0:	83 c4 10             	add    $0x10,%esp
+  8014f3:	85 c0                	test   %eax,%eax
+  8014f5:	78 72                	js     801569 <fork+0xcf>
+          thisenv->env_pgfault_upcall)) < 0) {
+  8014f7:	a1 00 b0 80 00       	mov    0x80b000,%eax
+  8014fc:	8b 40 64             	mov    0x64(%eax),%eax
+  if ( (error = sys_env_set_pgfault_upcall(envid,
+  8014ff:	83 ec 08             	sub    $0x8,%esp
+  801502:	50                   	push   %eax
+  801503:	53                   	push   %ebx
+  801504:	e8 99 fb ff ff       	call   8010a2 <sys_env_set_pgfault_upcall>
+  801509:	83 c4 10             	add    $0x10,%esp
+  80150c:	85 c0                	test   %eax,%eax
+  80150e:	78 6b                	js     80157b <fork+0xe1>
+  if ( (error = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+  801510:	83 ec 08             	sub    $0x8,%esp
+  801513:	6a 02                	push   $0x2
+  801515:	53                   	push   %ebx
+  801516:	e8 03 fb ff ff       	call   80101e <sys_env_set_status>
+  80151b:	83 c4 10             	add    $0x10,%esp
+  80151e:	85 c0                	test   %eax,%eax
+  801520:	78 6b                	js     80158d <fork+0xf3>
+}
+  801522:	89 d8                	mov    %ebx,%eax
+  801524:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801527:	c9                   	leave
+  801528:	c3                   	ret
+    panic("sys_exofork: %e", envid);
+  801529:	50                   	push   %eax
+  80152a:	68 69 40 80 00       	push   $0x804069
+  80152f:	6a 5e                	push   $0x5e
+  801531:	68 1f 40 80 00       	push   $0x80401f
+  801536:	e8 fa ed ff ff       	call   800335 <_panic>
+    thisenv = &envs[ENVX(sys_getenvid())];
+  80153b:	e8 6c f8 ff ff       	call   800dac <sys_getenvid>
+  801540:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801545:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  801548:	c1 e0 04             	shl    $0x4,%eax
+  80154b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801550:	a3 00 b0 80 00       	mov    %eax,0x80b000
+    return 0;
+  801555:	eb cb                	jmp    801522 <fork+0x88>
+    panic("sys_page_map_range: %e", error);
+  801557:	50                   	push   %eax
+  801558:	68 79 40 80 00       	push   $0x804079
+  80155d:	6a 69                	push   $0x69
+  80155f:	68 1f 40 80 00       	push   $0x80401f
+  801564:	e8 cc ed ff ff       	call   800335 <_panic>
+    panic("sys_page_alloc: %e", error);
+  801569:	50                   	push   %eax
+  80156a:	68 0e 3c 80 00       	push   $0x803c0e
+  80156f:	6a 70                	push   $0x70
+  801571:	68 1f 40 80 00       	push   $0x80401f
+  801576:	e8 ba ed ff ff       	call   800335 <_panic>
+    panic("sys_env_set_pgfault_upcall: %e", error);
+  80157b:	50                   	push   %eax
+  80157c:	68 a8 40 80 00       	push   $0x8040a8
+  801581:	6a 76                	push   $0x76
+  801583:	68 1f 40 80 00       	push   $0x80401f
+  801588:	e8 a8 ed ff ff       	call   800335 <_panic>
+    panic("sys_env_set_status: %e", error);
+  80158d:	50                   	push   %eax
+  80158e:	68 90 40 80 00       	push   $0x804090
+  801593:	6a 7a                	push   $0x7a
+  801595:	68 1f 40 80 00       	push   $0x80401f
+  80159a:	e8 96 ed ff ff       	call   800335 <_panic>
+
+0080159f <kfork>:
+{
+  80159f:	55                   	push   %ebp
+  8015a0:	89 e5                	mov    %esp,%ebp
+  8015a2:	53                   	push   %ebx
+  8015a3:	83 ec 10             	sub    $0x10,%esp
+  set_pgfault_handler(pgfault);
+  8015a6:	68 dc 12 80 00       	push   $0x8012dc
+  8015ab:	e8 d6 21 00 00       	call   803786 <set_pgfault_handler>
+  if ((envid = sys_fork()) == 0)
+  8015b0:	e8 4a fa ff ff       	call   800fff <sys_fork>
+  8015b5:	89 c3                	mov    %eax,%ebx
+  8015b7:	83 c4 10             	add    $0x10,%esp
+  8015ba:	85 c0                	test   %eax,%eax
+  8015bc:	74 07                	je     8015c5 <kfork+0x26>
+}
+  8015be:	89 d8                	mov    %ebx,%eax
+  8015c0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015c3:	c9                   	leave
+  8015c4:	c3                   	ret
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8015c5:	e8 e2 f7 ff ff       	call   800dac <sys_getenvid>
+  8015ca:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8015cf:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8015d2:	c1 e0 04             	shl    $0x4,%eax
+  8015d5:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8015da:	a3 00 b0 80 00       	mov    %eax,0x80b000
+  return envid;
+  8015df:	eb dd                	jmp    8015be <kfork+0x1f>
+
+008015e1 <sfork>:
+
+int
+sfork(void)
+{
+  8015e1:	55                   	push   %ebp
+  8015e2:	89 e5                	mov    %esp,%ebp
+  8015e4:	53                   	push   %ebx
+  8015e5:	83 ec 04             	sub    $0x4,%esp
+  envid_t envid, parent_id;
+  int error;
+
+  parent_id = sys_getenvid();
+  8015e8:	e8 bf f7 ff ff       	call   800dac <sys_getenvid>
+
+  // set up page fault handler
+  set_pgfault_handler(shared_pgfault);
+  8015ed:	83 ec 0c             	sub    $0xc,%esp
+  8015f0:	68 d9 13 80 00       	push   $0x8013d9
+  8015f5:	e8 8c 21 00 00       	call   803786 <set_pgfault_handler>
+  8015fa:	b8 07 00 00 00       	mov    $0x7,%eax
+  8015ff:	cd 30                	int    $0x30
+  801601:	89 c3                	mov    %eax,%ebx
+
+  // create a child with sys_exofork
+  envid = sys_exofork();
+  
+  if (envid < 0) {
+  801603:	83 c4 10             	add    $0x10,%esp
+  801606:	85 c0                	test   %eax,%eax
+  801608:	78 09                	js     801613 <sfork+0x32>
+    panic("sys_exofork: %e", envid);
+  } else if (envid == 0) {
+  80160a:	75 1c                	jne    801628 <sfork+0x47>
+  if ( (error = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+    panic("sys_env_set_status: %e", error);
+  }
+
+  return envid;
+}
+  80160c:	89 d8                	mov    %ebx,%eax
+  80160e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801611:	c9                   	leave
+  801612:	c3                   	ret
+    panic("sys_exofork: %e", envid);
+  801613:	50                   	push   %eax
+  801614:	68 69 40 80 00       	push   $0x804069
+  801619:	68 c3 00 00 00       	push   $0xc3
+  80161e:	68 1f 40 80 00       	push   $0x80401f
+  801623:	e8 0d ed ff ff       	call   800335 <_panic>
+  if ( (error = sys_page_map_range(0, 0, USTACKTOP - PGSIZE,
+  801628:	83 ec 0c             	sub    $0xc,%esp
+  80162b:	6a 00                	push   $0x0
+  80162d:	50                   	push   %eax
+  80162e:	68 00 d0 bf ee       	push   $0xeebfd000
+  801633:	6a 00                	push   $0x0
+  801635:	6a 00                	push   $0x0
+  801637:	e8 b8 f8 ff ff       	call   800ef4 <sys_page_map_range>
+  80163c:	83 c4 20             	add    $0x20,%esp
+  80163f:	85 c0                	test   %eax,%eax
+  801641:	78 79                	js     8016bc <sfork+0xdb>
+  if ( (error = sys_page_map_range(0, (void *) (USTACKTOP - PGSIZE), PGSIZE,
+  801643:	83 ec 0c             	sub    $0xc,%esp
+  801646:	6a 01                	push   $0x1
+  801648:	53                   	push   %ebx
+  801649:	68 00 10 00 00       	push   $0x1000
+  80164e:	68 00 d0 bf ee       	push   $0xeebfd000
+  801653:	6a 00                	push   $0x0
+  801655:	e8 9a f8 ff ff       	call   800ef4 <sys_page_map_range>
+  80165a:	83 c4 20             	add    $0x20,%esp
+  80165d:	85 c0                	test   %eax,%eax
+  80165f:	78 70                	js     8016d1 <sfork+0xf0>
+  if ( (error = sys_page_alloc(envid,
+  801661:	83 ec 04             	sub    $0x4,%esp
+  801664:	6a 07                	push   $0x7
+  801666:	68 00 f0 bf ee       	push   $0xeebff000
+  80166b:	53                   	push   %ebx
+  80166c:	e8 bc f7 ff ff       	call   800e2d <sys_page_alloc>
+  801671:	83 c4 10             	add    $0x10,%esp
+  801674:	85 c0                	test   %eax,%eax
+  801676:	78 6e                	js     8016e6 <sfork+0x105>
+          thisenv->env_pgfault_upcall)) < 0) {
+  801678:	a1 00 b0 80 00       	mov    0x80b000,%eax
+  80167d:	8b 40 64             	mov    0x64(%eax),%eax
+  if ( (error = sys_env_set_pgfault_upcall(envid,
+  801680:	83 ec 08             	sub    $0x8,%esp
+  801683:	50                   	push   %eax
+  801684:	53                   	push   %ebx
+  801685:	e8 18 fa ff ff       	call   8010a2 <sys_env_set_pgfault_upcall>
+  80168a:	83 c4 10             	add    $0x10,%esp
+  80168d:	85 c0                	test   %eax,%eax
+  80168f:	78 6a                	js     8016fb <sfork+0x11a>
+  if ( (error = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+  801691:	83 ec 08             	sub    $0x8,%esp
+  801694:	6a 02                	push   $0x2
+  801696:	53                   	push   %ebx
+  801697:	e8 82 f9 ff ff       	call   80101e <sys_env_set_status>
+  80169c:	83 c4 10             	add    $0x10,%esp
+  80169f:	85 c0                	test   %eax,%eax
+  8016a1:	0f 89 65 ff ff ff    	jns    80160c <sfork+0x2b>
+    panic("sys_env_set_status: %e", error);
+  8016a7:	50                   	push   %eax
+  8016a8:	68 90 40 80 00       	push   $0x804090
+  8016ad:	68 e4 00 00 00       	push   $0xe4
+  8016b2:	68 1f 40 80 00       	push   $0x80401f
+  8016b7:	e8 79 ec ff ff       	call   800335 <_panic>
+    panic("sys_page_map_range: %e", error);
+  8016bc:	50                   	push   %eax
+  8016bd:	68 79 40 80 00       	push   $0x804079
+  8016c2:	68 ce 00 00 00       	push   $0xce
+  8016c7:	68 1f 40 80 00       	push   $0x80401f
+  8016cc:	e8 64 ec ff ff       	call   800335 <_panic>
+    panic("sys_page_map_range: %e", error);
+  8016d1:	50                   	push   %eax
+  8016d2:	68 79 40 80 00       	push   $0x804079
+  8016d7:	68 d3 00 00 00       	push   $0xd3
+  8016dc:	68 1f 40 80 00       	push   $0x80401f
+  8016e1:	e8 4f ec ff ff       	call   800335 <_panic>
+    panic("sys_page_alloc: %e", error);
+  8016e6:	50                   	push   %eax
+  8016e7:	68 0e 3c 80 00       	push   $0x803c0e
+  8016ec:	68 da 00 00 00       	push   $0xda
+  8016f1:	68 1f 40 80 00       	push   $0x80401f
+  8016f6:	e8 3a ec ff ff       	call   800335 <_panic>
+    panic("sys_env_set_pgfault_upcall: %e", error);
+  8016fb:	50                   	push   %eax
+  8016fc:	68 a8 40 80 00       	push   $0x8040a8
+  801701:	68 e0 00 00 00       	push   $0xe0
+  801706:	68 1f 40 80 00       	push   $0x80401f
+  80170b:	e8 25 ec ff ff       	call   800335 <_panic>
+
+00801710 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801710:	55                   	push   %ebp
+  801711:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801713:	8b 45 08             	mov    0x8(%ebp),%eax
+  801716:	05 00 00 00 30       	add    $0x30000000,%eax
+  80171b:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80171e:	5d                   	pop    %ebp
+  80171f:	c3                   	ret
+
+00801720 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801720:	55                   	push   %ebp
+  801721:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801723:	8b 45 08             	mov    0x8(%ebp),%eax
+  801726:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  801729:	66 b8 00 00          	mov    $0x0,%ax
+  80172d:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801732:	5d                   	pop    %ebp
+  801733:	c3                   	ret
+
+00801734 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801734:	55                   	push   %ebp
+  801735:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  801737:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80173c:	eb 02                	jmp    801740 <fd_alloc+0xc>
+  80173e:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801740:	89 c2                	mov    %eax,%edx
+  801742:	c1 ea 16             	shr    $0x16,%edx
+  801745:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80174c:	f6 c2 01             	test   $0x1,%dl
+  80174f:	74 2b                	je     80177c <fd_alloc+0x48>
+  801751:	89 c2                	mov    %eax,%edx
+  801753:	c1 ea 0c             	shr    $0xc,%edx
+  801756:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80175d:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801763:	f6 c1 01             	test   $0x1,%cl
+  801766:	74 14                	je     80177c <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  801768:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  80176e:	75 ce                	jne    80173e <fd_alloc+0xa>
+  801770:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  801775:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80177a:	eb 05                	jmp    801781 <fd_alloc+0x4d>
+      return 0;
+  80177c:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  801781:	8b 55 08             	mov    0x8(%ebp),%edx
+  801784:	89 02                	mov    %eax,(%edx)
+}
+  801786:	89 c8                	mov    %ecx,%eax
+  801788:	5d                   	pop    %ebp
+  801789:	c3                   	ret
+
+0080178a <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80178a:	55                   	push   %ebp
+  80178b:	89 e5                	mov    %esp,%ebp
+  80178d:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  801790:	83 f8 1f             	cmp    $0x1f,%eax
+  801793:	77 30                	ja     8017c5 <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  801795:	c1 e0 0c             	shl    $0xc,%eax
+  801798:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80179d:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8017a3:	f6 c2 01             	test   $0x1,%dl
+  8017a6:	74 24                	je     8017cc <fd_lookup+0x42>
+  8017a8:	89 c2                	mov    %eax,%edx
+  8017aa:	c1 ea 0c             	shr    $0xc,%edx
+  8017ad:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8017b4:	f6 c2 01             	test   $0x1,%dl
+  8017b7:	74 1a                	je     8017d3 <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  8017b9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8017bc:	89 02                	mov    %eax,(%edx)
+  return 0;
+  8017be:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017c3:	5d                   	pop    %ebp
+  8017c4:	c3                   	ret
+    return -E_INVAL;
+  8017c5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017ca:	eb f7                	jmp    8017c3 <fd_lookup+0x39>
+    return -E_INVAL;
+  8017cc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017d1:	eb f0                	jmp    8017c3 <fd_lookup+0x39>
+  8017d3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017d8:	eb e9                	jmp    8017c3 <fd_lookup+0x39>
+
+008017da <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8017da:	55                   	push   %ebp
+  8017db:	89 e5                	mov    %esp,%ebp
+  8017dd:	53                   	push   %ebx
+  8017de:	83 ec 04             	sub    $0x4,%esp
+  8017e1:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  8017e4:	b8 44 41 80 00       	mov    $0x804144,%eax
+  8017e9:	8b 18                	mov    (%eax),%ebx
+  8017eb:	85 db                	test   %ebx,%ebx
+  8017ed:	74 0e                	je     8017fd <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  8017ef:	83 c0 04             	add    $0x4,%eax
+  8017f2:	39 13                	cmp    %edx,(%ebx)
+  8017f4:	75 f3                	jne    8017e9 <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  8017f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017fb:	eb 1f                	jmp    80181c <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8017fd:	a1 00 b0 80 00       	mov    0x80b000,%eax
+  801802:	8b 40 48             	mov    0x48(%eax),%eax
+  801805:	83 ec 04             	sub    $0x4,%esp
+  801808:	52                   	push   %edx
+  801809:	50                   	push   %eax
+  80180a:	68 c8 40 80 00       	push   $0x8040c8
+  80180f:	e8 fc eb ff ff       	call   800410 <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  801814:	83 c4 10             	add    $0x10,%esp
+  801817:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  80181c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80181f:	89 1a                	mov    %ebx,(%edx)
+}
+  801821:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801824:	c9                   	leave
+  801825:	c3                   	ret
+
+00801826 <fd_close>:
+{
+  801826:	55                   	push   %ebp
+  801827:	89 e5                	mov    %esp,%ebp
+  801829:	57                   	push   %edi
+  80182a:	56                   	push   %esi
+  80182b:	53                   	push   %ebx
+  80182c:	83 ec 24             	sub    $0x24,%esp
+  80182f:	8b 75 08             	mov    0x8(%ebp),%esi
+  801832:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801835:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801838:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801839:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80183f:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801842:	50                   	push   %eax
+  801843:	e8 42 ff ff ff       	call   80178a <fd_lookup>
+  801848:	89 c3                	mov    %eax,%ebx
+  80184a:	83 c4 10             	add    $0x10,%esp
+  80184d:	85 c0                	test   %eax,%eax
+  80184f:	78 05                	js     801856 <fd_close+0x30>
+      || fd != fd2)
+  801851:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801854:	74 16                	je     80186c <fd_close+0x46>
+    return must_exist ? r : 0;
+  801856:	89 f8                	mov    %edi,%eax
+  801858:	84 c0                	test   %al,%al
+  80185a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80185f:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801862:	89 d8                	mov    %ebx,%eax
+  801864:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801867:	5b                   	pop    %ebx
+  801868:	5e                   	pop    %esi
+  801869:	5f                   	pop    %edi
+  80186a:	5d                   	pop    %ebp
+  80186b:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80186c:	83 ec 08             	sub    $0x8,%esp
+  80186f:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801872:	50                   	push   %eax
+  801873:	ff 36                	push   (%esi)
+  801875:	e8 60 ff ff ff       	call   8017da <dev_lookup>
+  80187a:	89 c3                	mov    %eax,%ebx
+  80187c:	83 c4 10             	add    $0x10,%esp
+  80187f:	85 c0                	test   %eax,%eax
+  801881:	78 1a                	js     80189d <fd_close+0x77>
+    if (dev->dev_close)
+  801883:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801886:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  801889:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  80188e:	85 c0                	test   %eax,%eax
+  801890:	74 0b                	je     80189d <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  801892:	83 ec 0c             	sub    $0xc,%esp
+  801895:	56                   	push   %esi
+  801896:	ff d0                	call   *%eax
+  801898:	89 c3                	mov    %eax,%ebx
+  80189a:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  80189d:	83 ec 08             	sub    $0x8,%esp
+  8018a0:	56                   	push   %esi
+  8018a1:	6a 00                	push   $0x0
+  8018a3:	e8 0a f6 ff ff       	call   800eb2 <sys_page_unmap>
+  return r;
+  8018a8:	83 c4 10             	add    $0x10,%esp
+  8018ab:	eb b5                	jmp    801862 <fd_close+0x3c>
+
+008018ad <close>:
+
+int
+close(int fdnum)
+{
+  8018ad:	55                   	push   %ebp
+  8018ae:	89 e5                	mov    %esp,%ebp
+  8018b0:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8018b3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018b6:	50                   	push   %eax
+  8018b7:	ff 75 08             	push   0x8(%ebp)
+  8018ba:	e8 cb fe ff ff       	call   80178a <fd_lookup>
+  8018bf:	83 c4 10             	add    $0x10,%esp
+  8018c2:	85 c0                	test   %eax,%eax
+  8018c4:	79 02                	jns    8018c8 <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  8018c6:	c9                   	leave
+  8018c7:	c3                   	ret
+    return fd_close(fd, 1);
+  8018c8:	83 ec 08             	sub    $0x8,%esp
+  8018cb:	6a 01                	push   $0x1
+  8018cd:	ff 75 f4             	push   -0xc(%ebp)
+  8018d0:	e8 51 ff ff ff       	call   801826 <fd_close>
+  8018d5:	83 c4 10             	add    $0x10,%esp
+  8018d8:	eb ec                	jmp    8018c6 <close+0x19>
+
+008018da <close_all>:
+
+void
+close_all(void)
+{
+  8018da:	55                   	push   %ebp
+  8018db:	89 e5                	mov    %esp,%ebp
+  8018dd:	53                   	push   %ebx
+  8018de:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  8018e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  8018e6:	83 ec 0c             	sub    $0xc,%esp
+  8018e9:	53                   	push   %ebx
+  8018ea:	e8 be ff ff ff       	call   8018ad <close>
+  for (i = 0; i < MAXFD; i++)
+  8018ef:	83 c3 01             	add    $0x1,%ebx
+  8018f2:	83 c4 10             	add    $0x10,%esp
+  8018f5:	83 fb 20             	cmp    $0x20,%ebx
+  8018f8:	75 ec                	jne    8018e6 <close_all+0xc>
+}
+  8018fa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018fd:	c9                   	leave
+  8018fe:	c3                   	ret
+
+008018ff <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8018ff:	55                   	push   %ebp
+  801900:	89 e5                	mov    %esp,%ebp
+  801902:	57                   	push   %edi
+  801903:	56                   	push   %esi
+  801904:	53                   	push   %ebx
+  801905:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801908:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80190b:	50                   	push   %eax
+  80190c:	ff 75 08             	push   0x8(%ebp)
+  80190f:	e8 76 fe ff ff       	call   80178a <fd_lookup>
+  801914:	89 c6                	mov    %eax,%esi
+  801916:	83 c4 10             	add    $0x10,%esp
+  801919:	85 c0                	test   %eax,%eax
+  80191b:	0f 88 0a 01 00 00    	js     801a2b <dup+0x12c>
+    return r;
+  close(newfdnum);
+  801921:	83 ec 0c             	sub    $0xc,%esp
+  801924:	ff 75 0c             	push   0xc(%ebp)
+  801927:	e8 81 ff ff ff       	call   8018ad <close>
+
+  newfd = INDEX2FD(newfdnum);
+  80192c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80192f:	c1 e0 0c             	shl    $0xc,%eax
+  801932:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  801938:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  80193b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80193e:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  801941:	89 04 24             	mov    %eax,(%esp)
+  801944:	e8 d7 fd ff ff       	call   801720 <fd2data>
+  801949:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  80194b:	89 3c 24             	mov    %edi,(%esp)
+  80194e:	e8 cd fd ff ff       	call   801720 <fd2data>
+  801953:	83 c4 10             	add    $0x10,%esp
+  801956:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801959:	89 f3                	mov    %esi,%ebx
+  80195b:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  801961:	89 c6                	mov    %eax,%esi
+  801963:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801966:	89 cf                	mov    %ecx,%edi
+  801968:	eb 0c                	jmp    801976 <dup+0x77>
+  80196a:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801970:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801976:	39 fb                	cmp    %edi,%ebx
+  801978:	74 7b                	je     8019f5 <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  80197a:	89 d8                	mov    %ebx,%eax
+  80197c:	c1 e8 16             	shr    $0x16,%eax
+  80197f:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801986:	a8 01                	test   $0x1,%al
+  801988:	74 e0                	je     80196a <dup+0x6b>
+  80198a:	89 d8                	mov    %ebx,%eax
+  80198c:	c1 e8 0c             	shr    $0xc,%eax
+  80198f:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801996:	f6 c2 01             	test   $0x1,%dl
+  801999:	74 cf                	je     80196a <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  80199b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  8019a2:	83 ec 0c             	sub    $0xc,%esp
+  8019a5:	25 07 0e 00 00       	and    $0xe07,%eax
+  8019aa:	50                   	push   %eax
+  8019ab:	56                   	push   %esi
+  8019ac:	6a 00                	push   $0x0
+  8019ae:	53                   	push   %ebx
+  8019af:	6a 00                	push   $0x0
+  8019b1:	e8 ba f4 ff ff       	call   800e70 <sys_page_map>
+  8019b6:	83 c4 20             	add    $0x20,%esp
+  8019b9:	85 c0                	test   %eax,%eax
+  8019bb:	79 ad                	jns    80196a <dup+0x6b>
+  8019bd:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8019c0:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  8019c2:	83 ec 08             	sub    $0x8,%esp
+  8019c5:	ff 75 d4             	push   -0x2c(%ebp)
+  8019c8:	6a 00                	push   $0x0
+  8019ca:	e8 e3 f4 ff ff       	call   800eb2 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8019cf:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  8019d2:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  8019d8:	83 c4 10             	add    $0x10,%esp
+  8019db:	39 df                	cmp    %ebx,%edi
+  8019dd:	74 4c                	je     801a2b <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  8019df:	83 ec 08             	sub    $0x8,%esp
+  8019e2:	57                   	push   %edi
+  8019e3:	6a 00                	push   $0x0
+  8019e5:	e8 c8 f4 ff ff       	call   800eb2 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8019ea:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  8019f0:	83 c4 10             	add    $0x10,%esp
+  8019f3:	eb e6                	jmp    8019db <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8019f5:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8019f8:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8019fb:	89 c8                	mov    %ecx,%eax
+  8019fd:	c1 e8 0c             	shr    $0xc,%eax
+  801a00:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801a07:	83 ec 0c             	sub    $0xc,%esp
+  801a0a:	25 07 0e 00 00       	and    $0xe07,%eax
+  801a0f:	50                   	push   %eax
+  801a10:	ff 75 d4             	push   -0x2c(%ebp)
+  801a13:	6a 00                	push   $0x0
+  801a15:	51                   	push   %ecx
+  801a16:	6a 00                	push   $0x0
+  801a18:	e8 53 f4 ff ff       	call   800e70 <sys_page_map>
+  801a1d:	89 c6                	mov    %eax,%esi
+  801a1f:	83 c4 20             	add    $0x20,%esp
+  801a22:	85 c0                	test   %eax,%eax
+  801a24:	78 9c                	js     8019c2 <dup+0xc3>
+  return newfdnum;
+  801a26:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a29:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  801a2b:	89 f0                	mov    %esi,%eax
+  801a2d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a30:	5b                   	pop    %ebx
+  801a31:	5e                   	pop    %esi
+  801a32:	5f                   	pop    %edi
+  801a33:	5d                   	pop    %ebp
+  801a34:	c3                   	ret
+
+00801a35 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801a35:	55                   	push   %ebp
+  801a36:	89 e5                	mov    %esp,%ebp
+  801a38:	56                   	push   %esi
+  801a39:	53                   	push   %ebx
+  801a3a:	83 ec 18             	sub    $0x18,%esp
+  801a3d:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a40:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a43:	50                   	push   %eax
+  801a44:	56                   	push   %esi
+  801a45:	e8 40 fd ff ff       	call   80178a <fd_lookup>
+  801a4a:	83 c4 10             	add    $0x10,%esp
+  801a4d:	85 c0                	test   %eax,%eax
+  801a4f:	78 3c                	js     801a8d <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801a51:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801a54:	83 ec 08             	sub    $0x8,%esp
+  801a57:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a5a:	50                   	push   %eax
+  801a5b:	ff 33                	push   (%ebx)
+  801a5d:	e8 78 fd ff ff       	call   8017da <dev_lookup>
+  801a62:	83 c4 10             	add    $0x10,%esp
+  801a65:	85 c0                	test   %eax,%eax
+  801a67:	78 24                	js     801a8d <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801a69:	8b 43 08             	mov    0x8(%ebx),%eax
+  801a6c:	83 e0 03             	and    $0x3,%eax
+  801a6f:	83 f8 01             	cmp    $0x1,%eax
+  801a72:	74 20                	je     801a94 <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  801a74:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a77:	8b 40 08             	mov    0x8(%eax),%eax
+  801a7a:	85 c0                	test   %eax,%eax
+  801a7c:	74 37                	je     801ab5 <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  801a7e:	83 ec 04             	sub    $0x4,%esp
+  801a81:	ff 75 10             	push   0x10(%ebp)
+  801a84:	ff 75 0c             	push   0xc(%ebp)
+  801a87:	53                   	push   %ebx
+  801a88:	ff d0                	call   *%eax
+  801a8a:	83 c4 10             	add    $0x10,%esp
+}
+  801a8d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a90:	5b                   	pop    %ebx
+  801a91:	5e                   	pop    %esi
+  801a92:	5d                   	pop    %ebp
+  801a93:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801a94:	a1 00 b0 80 00       	mov    0x80b000,%eax
+  801a99:	8b 40 48             	mov    0x48(%eax),%eax
+  801a9c:	83 ec 04             	sub    $0x4,%esp
+  801a9f:	56                   	push   %esi
+  801aa0:	50                   	push   %eax
+  801aa1:	68 09 41 80 00       	push   $0x804109
+  801aa6:	e8 65 e9 ff ff       	call   800410 <cprintf>
+    return -E_INVAL;
+  801aab:	83 c4 10             	add    $0x10,%esp
+  801aae:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ab3:	eb d8                	jmp    801a8d <read+0x58>
+    return -E_NOT_SUPP;
+  801ab5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801aba:	eb d1                	jmp    801a8d <read+0x58>
+
+00801abc <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801abc:	55                   	push   %ebp
+  801abd:	89 e5                	mov    %esp,%ebp
+  801abf:	57                   	push   %edi
+  801ac0:	56                   	push   %esi
+  801ac1:	53                   	push   %ebx
+  801ac2:	83 ec 0c             	sub    $0xc,%esp
+  801ac5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801ac8:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  801acb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ad0:	eb 02                	jmp    801ad4 <readn+0x18>
+  801ad2:	01 c3                	add    %eax,%ebx
+  801ad4:	39 f3                	cmp    %esi,%ebx
+  801ad6:	73 21                	jae    801af9 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  801ad8:	83 ec 04             	sub    $0x4,%esp
+  801adb:	89 f0                	mov    %esi,%eax
+  801add:	29 d8                	sub    %ebx,%eax
+  801adf:	50                   	push   %eax
+  801ae0:	89 d8                	mov    %ebx,%eax
+  801ae2:	03 45 0c             	add    0xc(%ebp),%eax
+  801ae5:	50                   	push   %eax
+  801ae6:	57                   	push   %edi
+  801ae7:	e8 49 ff ff ff       	call   801a35 <read>
+    if (m < 0)
+  801aec:	83 c4 10             	add    $0x10,%esp
+  801aef:	85 c0                	test   %eax,%eax
+  801af1:	78 04                	js     801af7 <readn+0x3b>
+      return m;
+    if (m == 0)
+  801af3:	75 dd                	jne    801ad2 <readn+0x16>
+  801af5:	eb 02                	jmp    801af9 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  801af7:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  801af9:	89 d8                	mov    %ebx,%eax
+  801afb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801afe:	5b                   	pop    %ebx
+  801aff:	5e                   	pop    %esi
+  801b00:	5f                   	pop    %edi
+  801b01:	5d                   	pop    %ebp
+  801b02:	c3                   	ret
+
+00801b03 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801b03:	55                   	push   %ebp
+  801b04:	89 e5                	mov    %esp,%ebp
+  801b06:	56                   	push   %esi
+  801b07:	53                   	push   %ebx
+  801b08:	83 ec 18             	sub    $0x18,%esp
+  801b0b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801b0e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b11:	50                   	push   %eax
+  801b12:	53                   	push   %ebx
+  801b13:	e8 72 fc ff ff       	call   80178a <fd_lookup>
+  801b18:	83 c4 10             	add    $0x10,%esp
+  801b1b:	85 c0                	test   %eax,%eax
+  801b1d:	78 37                	js     801b56 <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801b1f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b22:	83 ec 08             	sub    $0x8,%esp
+  801b25:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b28:	50                   	push   %eax
+  801b29:	ff 36                	push   (%esi)
+  801b2b:	e8 aa fc ff ff       	call   8017da <dev_lookup>
+  801b30:	83 c4 10             	add    $0x10,%esp
+  801b33:	85 c0                	test   %eax,%eax
+  801b35:	78 1f                	js     801b56 <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801b37:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801b3b:	74 20                	je     801b5d <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  801b3d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b40:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b43:	85 c0                	test   %eax,%eax
+  801b45:	74 37                	je     801b7e <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  801b47:	83 ec 04             	sub    $0x4,%esp
+  801b4a:	ff 75 10             	push   0x10(%ebp)
+  801b4d:	ff 75 0c             	push   0xc(%ebp)
+  801b50:	56                   	push   %esi
+  801b51:	ff d0                	call   *%eax
+  801b53:	83 c4 10             	add    $0x10,%esp
+}
+  801b56:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b59:	5b                   	pop    %ebx
+  801b5a:	5e                   	pop    %esi
+  801b5b:	5d                   	pop    %ebp
+  801b5c:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b5d:	a1 00 b0 80 00       	mov    0x80b000,%eax
+  801b62:	8b 40 48             	mov    0x48(%eax),%eax
+  801b65:	83 ec 04             	sub    $0x4,%esp
+  801b68:	53                   	push   %ebx
+  801b69:	50                   	push   %eax
+  801b6a:	68 25 41 80 00       	push   $0x804125
+  801b6f:	e8 9c e8 ff ff       	call   800410 <cprintf>
+    return -E_INVAL;
+  801b74:	83 c4 10             	add    $0x10,%esp
+  801b77:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b7c:	eb d8                	jmp    801b56 <write+0x53>
+    return -E_NOT_SUPP;
+  801b7e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b83:	eb d1                	jmp    801b56 <write+0x53>
+
+00801b85 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801b85:	55                   	push   %ebp
+  801b86:	89 e5                	mov    %esp,%ebp
+  801b88:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801b8b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b8e:	50                   	push   %eax
+  801b8f:	ff 75 08             	push   0x8(%ebp)
+  801b92:	e8 f3 fb ff ff       	call   80178a <fd_lookup>
+  801b97:	83 c4 10             	add    $0x10,%esp
+  801b9a:	85 c0                	test   %eax,%eax
+  801b9c:	78 0e                	js     801bac <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  801b9e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801ba1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ba4:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  801ba7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801bac:	c9                   	leave
+  801bad:	c3                   	ret
+
+00801bae <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801bae:	55                   	push   %ebp
+  801baf:	89 e5                	mov    %esp,%ebp
+  801bb1:	56                   	push   %esi
+  801bb2:	53                   	push   %ebx
+  801bb3:	83 ec 18             	sub    $0x18,%esp
+  801bb6:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801bb9:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801bbc:	50                   	push   %eax
+  801bbd:	53                   	push   %ebx
+  801bbe:	e8 c7 fb ff ff       	call   80178a <fd_lookup>
+  801bc3:	83 c4 10             	add    $0x10,%esp
+  801bc6:	85 c0                	test   %eax,%eax
+  801bc8:	78 34                	js     801bfe <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801bca:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801bcd:	83 ec 08             	sub    $0x8,%esp
+  801bd0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bd3:	50                   	push   %eax
+  801bd4:	ff 36                	push   (%esi)
+  801bd6:	e8 ff fb ff ff       	call   8017da <dev_lookup>
+  801bdb:	83 c4 10             	add    $0x10,%esp
+  801bde:	85 c0                	test   %eax,%eax
+  801be0:	78 1c                	js     801bfe <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801be2:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801be6:	74 1d                	je     801c05 <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  801be8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801beb:	8b 40 18             	mov    0x18(%eax),%eax
+  801bee:	85 c0                	test   %eax,%eax
+  801bf0:	74 34                	je     801c26 <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  801bf2:	83 ec 08             	sub    $0x8,%esp
+  801bf5:	ff 75 0c             	push   0xc(%ebp)
+  801bf8:	56                   	push   %esi
+  801bf9:	ff d0                	call   *%eax
+  801bfb:	83 c4 10             	add    $0x10,%esp
+}
+  801bfe:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c01:	5b                   	pop    %ebx
+  801c02:	5e                   	pop    %esi
+  801c03:	5d                   	pop    %ebp
+  801c04:	c3                   	ret
+            thisenv->env_id, fdnum);
+  801c05:	a1 00 b0 80 00       	mov    0x80b000,%eax
+  801c0a:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801c0d:	83 ec 04             	sub    $0x4,%esp
+  801c10:	53                   	push   %ebx
+  801c11:	50                   	push   %eax
+  801c12:	68 e8 40 80 00       	push   $0x8040e8
+  801c17:	e8 f4 e7 ff ff       	call   800410 <cprintf>
+    return -E_INVAL;
+  801c1c:	83 c4 10             	add    $0x10,%esp
+  801c1f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c24:	eb d8                	jmp    801bfe <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  801c26:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c2b:	eb d1                	jmp    801bfe <ftruncate+0x50>
+
+00801c2d <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801c2d:	55                   	push   %ebp
+  801c2e:	89 e5                	mov    %esp,%ebp
+  801c30:	56                   	push   %esi
+  801c31:	53                   	push   %ebx
+  801c32:	83 ec 18             	sub    $0x18,%esp
+  801c35:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c38:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c3b:	50                   	push   %eax
+  801c3c:	ff 75 08             	push   0x8(%ebp)
+  801c3f:	e8 46 fb ff ff       	call   80178a <fd_lookup>
+  801c44:	83 c4 10             	add    $0x10,%esp
+  801c47:	85 c0                	test   %eax,%eax
+  801c49:	78 49                	js     801c94 <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c4b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801c4e:	83 ec 08             	sub    $0x8,%esp
+  801c51:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c54:	50                   	push   %eax
+  801c55:	ff 36                	push   (%esi)
+  801c57:	e8 7e fb ff ff       	call   8017da <dev_lookup>
+  801c5c:	83 c4 10             	add    $0x10,%esp
+  801c5f:	85 c0                	test   %eax,%eax
+  801c61:	78 31                	js     801c94 <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  801c63:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c66:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801c6a:	74 2f                	je     801c9b <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  801c6c:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  801c6f:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801c76:	00 00 00 
+  stat->st_isdir = 0;
+  801c79:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801c80:	00 00 00 
+  stat->st_dev = dev;
+  801c83:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  801c89:	83 ec 08             	sub    $0x8,%esp
+  801c8c:	53                   	push   %ebx
+  801c8d:	56                   	push   %esi
+  801c8e:	ff 50 14             	call   *0x14(%eax)
+  801c91:	83 c4 10             	add    $0x10,%esp
+}
+  801c94:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c97:	5b                   	pop    %ebx
+  801c98:	5e                   	pop    %esi
+  801c99:	5d                   	pop    %ebp
+  801c9a:	c3                   	ret
+    return -E_NOT_SUPP;
+  801c9b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ca0:	eb f2                	jmp    801c94 <fstat+0x67>
+
+00801ca2 <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  801ca2:	55                   	push   %ebp
+  801ca3:	89 e5                	mov    %esp,%ebp
+  801ca5:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  801ca8:	ff 75 0c             	push   0xc(%ebp)
+  801cab:	ff 75 08             	push   0x8(%ebp)
+  801cae:	e8 58 07 00 00       	call   80240b <file_stat>
+}
+  801cb3:	c9                   	leave
+  801cb4:	c3                   	ret
+
+00801cb5 <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  801cb5:	55                   	push   %ebp
+  801cb6:	89 e5                	mov    %esp,%ebp
+  801cb8:	57                   	push   %edi
+  801cb9:	56                   	push   %esi
+  801cba:	53                   	push   %ebx
+  801cbb:	83 ec 1c             	sub    $0x1c,%esp
+  801cbe:	89 c7                	mov    %eax,%edi
+  801cc0:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801cc3:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801cc6:	e9 a2 00 00 00       	jmp    801d6d <fsipc_send+0xb8>
+  nfsenvs = 0;
+  801ccb:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  801cd2:	00 00 00 
+  801cd5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cda:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801cdf:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801ce4:	be 01 00 00 00       	mov    $0x1,%esi
+  801ce9:	eb 0f                	jmp    801cfa <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801ceb:	83 c0 01             	add    $0x1,%eax
+  801cee:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801cf3:	74 49                	je     801d3e <fsipc_send+0x89>
+  801cf5:	83 f9 07             	cmp    $0x7,%ecx
+  801cf8:	7f 50                	jg     801d4a <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  801cfa:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801cfd:	c1 e2 04             	shl    $0x4,%edx
+  801d00:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801d06:	8b 52 50             	mov    0x50(%edx),%edx
+  801d09:	83 fa 01             	cmp    $0x1,%edx
+  801d0c:	75 dd                	jne    801ceb <fsipc_send+0x36>
+  801d0e:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801d11:	c1 e2 04             	shl    $0x4,%edx
+  801d14:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801d1a:	8b 52 54             	mov    0x54(%edx),%edx
+  801d1d:	85 d2                	test   %edx,%edx
+  801d1f:	74 ca                	je     801ceb <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801d21:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801d24:	c1 e2 04             	shl    $0x4,%edx
+  801d27:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801d2d:	8b 52 48             	mov    0x48(%edx),%edx
+  801d30:	89 14 8d 20 60 80 00 	mov    %edx,0x806020(,%ecx,4)
+  801d37:	8d 49 01             	lea    0x1(%ecx),%ecx
+  801d3a:	89 f3                	mov    %esi,%ebx
+  801d3c:	eb ad                	jmp    801ceb <fsipc_send+0x36>
+  801d3e:	84 db                	test   %bl,%bl
+  801d40:	74 38                	je     801d7a <fsipc_send+0xc5>
+  801d42:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+  801d48:	eb 30                	jmp    801d7a <fsipc_send+0xc5>
+  801d4a:	84 db                	test   %bl,%bl
+  801d4c:	74 2c                	je     801d7a <fsipc_send+0xc5>
+  801d4e:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+  801d54:	eb 24                	jmp    801d7a <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  801d56:	50                   	push   %eax
+  801d57:	68 54 41 80 00       	push   $0x804154
+  801d5c:	6a 34                	push   $0x34
+  801d5e:	68 5e 41 80 00       	push   $0x80415e
+  801d63:	e8 cd e5 ff ff       	call   800335 <_panic>
+    }
+    sys_yield();
+  801d68:	e8 5e f0 ff ff       	call   800dcb <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  801d6d:	83 3d 00 60 80 00 03 	cmpl   $0x3,0x806000
+  801d74:	0f 8e 51 ff ff ff    	jle    801ccb <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  801d7a:	a1 00 b0 80 00       	mov    0x80b000,%eax
+  801d7f:	8b 70 48             	mov    0x48(%eax),%esi
+  801d82:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  801d88:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d8d:	8b 0d 00 60 80 00    	mov    0x806000,%ecx
+  801d93:	39 d9                	cmp    %ebx,%ecx
+  801d95:	7e d1                	jle    801d68 <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  801d97:	83 ec 0c             	sub    $0xc,%esp
+  801d9a:	ff 75 e0             	push   -0x20(%ebp)
+  801d9d:	6a 07                	push   $0x7
+  801d9f:	ff 75 e4             	push   -0x1c(%ebp)
+  801da2:	57                   	push   %edi
+  801da3:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  801da6:	99                   	cltd
+  801da7:	f7 f9                	idiv   %ecx
+  801da9:	ff 34 95 20 60 80 00 	push   0x806020(,%edx,4)
+  801db0:	e8 2f f3 ff ff       	call   8010e4 <sys_ipc_try_send>
+      if (r == 0)
+  801db5:	83 c4 20             	add    $0x20,%esp
+  801db8:	85 c0                	test   %eax,%eax
+  801dba:	74 0a                	je     801dc6 <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  801dbc:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801dbf:	75 95                	jne    801d56 <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  801dc1:	83 c3 01             	add    $0x1,%ebx
+  801dc4:	eb c7                	jmp    801d8d <fsipc_send+0xd8>
+  }
+}
+  801dc6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801dc9:	5b                   	pop    %ebx
+  801dca:	5e                   	pop    %esi
+  801dcb:	5f                   	pop    %edi
+  801dcc:	5d                   	pop    %ebp
+  801dcd:	c3                   	ret
+
+00801dce <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801dce:	55                   	push   %ebp
+  801dcf:	89 e5                	mov    %esp,%ebp
+  801dd1:	53                   	push   %ebx
+  801dd2:	83 ec 14             	sub    $0x14,%esp
+  801dd5:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  801dd7:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  801dde:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801de3:	ba 00 c0 80 00       	mov    $0x80c000,%edx
+  801de8:	e8 c8 fe ff ff       	call   801cb5 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801ded:	6a 00                	push   $0x0
+  801def:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801df2:	50                   	push   %eax
+  801df3:	53                   	push   %ebx
+  801df4:	6a 00                	push   $0x0
+  801df6:	e8 f8 19 00 00       	call   8037f3 <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  801dfb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801dfe:	c9                   	leave
+  801dff:	c3                   	ret
+
+00801e00 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801e00:	55                   	push   %ebp
+  801e01:	89 e5                	mov    %esp,%ebp
+  801e03:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801e06:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e09:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e0c:	a3 00 c0 80 00       	mov    %eax,0x80c000
+  fsipcbuf.set_size.req_size = newsize;
+  801e11:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e14:	a3 04 c0 80 00       	mov    %eax,0x80c004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801e19:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e1e:	b8 02 00 00 00       	mov    $0x2,%eax
+  801e23:	e8 a6 ff ff ff       	call   801dce <fsipc>
+}
+  801e28:	c9                   	leave
+  801e29:	c3                   	ret
+
+00801e2a <devfile_flush>:
+{
+  801e2a:	55                   	push   %ebp
+  801e2b:	89 e5                	mov    %esp,%ebp
+  801e2d:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801e30:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e33:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e36:	a3 00 c0 80 00       	mov    %eax,0x80c000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801e3b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e40:	b8 06 00 00 00       	mov    $0x6,%eax
+  801e45:	e8 84 ff ff ff       	call   801dce <fsipc>
+}
+  801e4a:	c9                   	leave
+  801e4b:	c3                   	ret
+
+00801e4c <devfile_stat>:
+{
+  801e4c:	55                   	push   %ebp
+  801e4d:	89 e5                	mov    %esp,%ebp
+  801e4f:	53                   	push   %ebx
+  801e50:	83 ec 04             	sub    $0x4,%esp
+  801e53:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801e56:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e59:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e5c:	a3 00 c0 80 00       	mov    %eax,0x80c000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801e61:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e66:	b8 05 00 00 00       	mov    $0x5,%eax
+  801e6b:	e8 5e ff ff ff       	call   801dce <fsipc>
+  801e70:	85 c0                	test   %eax,%eax
+  801e72:	78 2c                	js     801ea0 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801e74:	83 ec 08             	sub    $0x8,%esp
+  801e77:	68 00 c0 80 00       	push   $0x80c000
+  801e7c:	53                   	push   %ebx
+  801e7d:	e8 7c eb ff ff       	call   8009fe <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  801e82:	a1 80 c0 80 00       	mov    0x80c080,%eax
+  801e87:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801e8d:	a1 84 c0 80 00       	mov    0x80c084,%eax
+  801e92:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801e98:	83 c4 10             	add    $0x10,%esp
+  801e9b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ea0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ea3:	c9                   	leave
+  801ea4:	c3                   	ret
+
+00801ea5 <fsv_alloc>:
+{
+  801ea5:	55                   	push   %ebp
+  801ea6:	89 e5                	mov    %esp,%ebp
+  801ea8:	56                   	push   %esi
+  801ea9:	53                   	push   %ebx
+  801eaa:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  801eac:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801eb1:	eb 22                	jmp    801ed5 <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  801eb3:	83 ec 04             	sub    $0x4,%esp
+  801eb6:	6a 00                	push   $0x0
+  801eb8:	6a 00                	push   $0x0
+  801eba:	6a 07                	push   $0x7
+  801ebc:	50                   	push   %eax
+  801ebd:	6a 00                	push   $0x0
+  801ebf:	6a 04                	push   $0x4
+  801ec1:	68 40 60 80 00       	push   $0x806040
+  801ec6:	e8 b5 f3 ff ff       	call   801280 <sysbatch_add>
+  801ecb:	83 c4 20             	add    $0x20,%esp
+  801ece:	85 c0                	test   %eax,%eax
+  801ed0:	78 48                	js     801f1a <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  801ed2:	83 c3 01             	add    $0x1,%ebx
+  801ed5:	39 f3                	cmp    %esi,%ebx
+  801ed7:	74 31                	je     801f0a <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  801ed9:	89 d8                	mov    %ebx,%eax
+  801edb:	c1 e0 0c             	shl    $0xc,%eax
+  801ede:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801ee3:	89 c2                	mov    %eax,%edx
+  801ee5:	c1 ea 16             	shr    $0x16,%edx
+  801ee8:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801eef:	f6 c2 01             	test   $0x1,%dl
+  801ef2:	74 bf                	je     801eb3 <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  801ef4:	89 c2                	mov    %eax,%edx
+  801ef6:	c1 ea 0c             	shr    $0xc,%edx
+  801ef9:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801f00:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801f03:	83 fa 03             	cmp    $0x3,%edx
+  801f06:	75 ab                	jne    801eb3 <fsv_alloc+0xe>
+  801f08:	eb c8                	jmp    801ed2 <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  801f0a:	83 ec 0c             	sub    $0xc,%esp
+  801f0d:	68 40 60 80 00       	push   $0x806040
+  801f12:	e8 19 f3 ff ff       	call   801230 <sysbatch_flush>
+  801f17:	83 c4 10             	add    $0x10,%esp
+}
+  801f1a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f1d:	5b                   	pop    %ebx
+  801f1e:	5e                   	pop    %esi
+  801f1f:	5d                   	pop    %ebp
+  801f20:	c3                   	ret
+
+00801f21 <devfile_read>:
+{
+  801f21:	55                   	push   %ebp
+  801f22:	89 e5                	mov    %esp,%ebp
+  801f24:	57                   	push   %edi
+  801f25:	56                   	push   %esi
+  801f26:	53                   	push   %ebx
+  801f27:	83 ec 3c             	sub    $0x3c,%esp
+  801f2a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  801f2d:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  801f33:	77 57                	ja     801f8c <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801f35:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f38:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f3b:	a3 00 c0 80 00       	mov    %eax,0x80c000
+  fsipcbuf.read.req_n = n;
+  801f40:	89 1d 04 c0 80 00    	mov    %ebx,0x80c004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801f46:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f4b:	b8 03 00 00 00       	mov    $0x3,%eax
+  801f50:	e8 79 fe ff ff       	call   801dce <fsipc>
+  801f55:	89 c6                	mov    %eax,%esi
+  801f57:	85 c0                	test   %eax,%eax
+  801f59:	78 27                	js     801f82 <devfile_read+0x61>
+  assert(r <= n);
+  801f5b:	39 c3                	cmp    %eax,%ebx
+  801f5d:	0f 82 0e 02 00 00    	jb     802171 <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  801f63:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801f68:	0f 8f 1c 02 00 00    	jg     80218a <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801f6e:	83 ec 04             	sub    $0x4,%esp
+  801f71:	50                   	push   %eax
+  801f72:	68 00 c0 80 00       	push   $0x80c000
+  801f77:	ff 75 0c             	push   0xc(%ebp)
+  801f7a:	e8 05 ec ff ff       	call   800b84 <memmove>
+  return r;
+  801f7f:	83 c4 10             	add    $0x10,%esp
+}
+  801f82:	89 f0                	mov    %esi,%eax
+  801f84:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f87:	5b                   	pop    %ebx
+  801f88:	5e                   	pop    %esi
+  801f89:	5f                   	pop    %edi
+  801f8a:	5d                   	pop    %ebp
+  801f8b:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  801f8c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f91:	e8 0f ff ff ff       	call   801ea5 <fsv_alloc>
+  801f96:	89 c6                	mov    %eax,%esi
+  801f98:	85 c0                	test   %eax,%eax
+  801f9a:	78 e6                	js     801f82 <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  801f9c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f9f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801fa2:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  801fa7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801faa:	8b 40 04             	mov    0x4(%eax),%eax
+  801fad:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  801fb2:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  801fb8:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801fbf:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801fc4:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801fc9:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801fce:	e8 e2 fc ff ff       	call   801cb5 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801fd3:	6a 00                	push   $0x0
+  801fd5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801fd8:	50                   	push   %eax
+  801fd9:	68 00 10 c0 9f       	push   $0x9fc01000
+  801fde:	6a 00                	push   $0x0
+  801fe0:	e8 0e 18 00 00       	call   8037f3 <ipc_recv_pages>
+  801fe5:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  801fe7:	83 c4 10             	add    $0x10,%esp
+  801fea:	85 c0                	test   %eax,%eax
+  801fec:	7e 94                	jle    801f82 <devfile_read+0x61>
+  assert(r <= n);
+  801fee:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801ff1:	39 c3                	cmp    %eax,%ebx
+  801ff3:	72 2e                	jb     802023 <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801ff5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ff8:	8b 40 04             	mov    0x4(%eax),%eax
+  801ffb:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802000:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  802003:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802006:	c1 e2 0c             	shl    $0xc,%edx
+  802009:	39 ca                	cmp    %ecx,%edx
+  80200b:	72 2f                	jb     80203c <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  80200d:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  802012:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  802015:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  802019:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  80201e:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  802021:	eb 52                	jmp    802075 <devfile_read+0x154>
+  assert(r <= n);
+  802023:	68 69 41 80 00       	push   $0x804169
+  802028:	68 70 41 80 00       	push   $0x804170
+  80202d:	68 49 01 00 00       	push   $0x149
+  802032:	68 5e 41 80 00       	push   $0x80415e
+  802037:	e8 f9 e2 ff ff       	call   800335 <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  80203c:	68 94 41 80 00       	push   $0x804194
+  802041:	68 70 41 80 00       	push   $0x804170
+  802046:	68 4a 01 00 00       	push   $0x14a
+  80204b:	68 5e 41 80 00       	push   $0x80415e
+  802050:	e8 e0 e2 ff ff       	call   800335 <_panic>
+      memmove(dst + done, src + done, m);
+  802055:	83 ec 04             	sub    $0x4,%esp
+  802058:	53                   	push   %ebx
+  802059:	56                   	push   %esi
+  80205a:	89 f8                	mov    %edi,%eax
+  80205c:	03 45 0c             	add    0xc(%ebp),%eax
+  80205f:	50                   	push   %eax
+  802060:	e8 1f eb ff ff       	call   800b84 <memmove>
+  802065:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  802068:	01 df                	add    %ebx,%edi
+  80206a:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80206d:	39 c7                	cmp    %eax,%edi
+  80206f:	0f 83 c0 00 00 00    	jae    802135 <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  802075:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802078:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  80207b:	89 f0                	mov    %esi,%eax
+  80207d:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802082:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  802087:	29 c3                	sub    %eax,%ebx
+  802089:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80208c:	29 f8                	sub    %edi,%eax
+  80208e:	39 c3                	cmp    %eax,%ebx
+  802090:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  802093:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  802099:	75 ba                	jne    802055 <devfile_read+0x134>
+  80209b:	89 f9                	mov    %edi,%ecx
+  80209d:	03 4d 0c             	add    0xc(%ebp),%ecx
+  8020a0:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  8020a3:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  8020a9:	75 aa                	jne    802055 <devfile_read+0x134>
+  8020ab:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  8020b1:	77 a2                	ja     802055 <devfile_read+0x134>
+  8020b3:	89 c8                	mov    %ecx,%eax
+  8020b5:	c1 e8 16             	shr    $0x16,%eax
+  8020b8:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8020bf:	a8 01                	test   $0x1,%al
+  8020c1:	74 92                	je     802055 <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  8020c3:	89 c8                	mov    %ecx,%eax
+  8020c5:	c1 e8 0c             	shr    $0xc,%eax
+  8020c8:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  8020cf:	a8 01                	test   $0x1,%al
+  8020d1:	74 82                	je     802055 <devfile_read+0x134>
+  8020d3:	a9 02 08 00 00       	test   $0x802,%eax
+  8020d8:	0f 84 77 ff ff ff    	je     802055 <devfile_read+0x134>
+  8020de:	f6 c4 04             	test   $0x4,%ah
+  8020e1:	0f 85 6e ff ff ff    	jne    802055 <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  8020e7:	a1 00 b0 80 00       	mov    0x80b000,%eax
+  8020ec:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  8020f0:	84 c0                	test   %al,%al
+  8020f2:	75 17                	jne    80210b <devfile_read+0x1ea>
+  8020f4:	83 ec 08             	sub    $0x8,%esp
+  8020f7:	6a 01                	push   $0x1
+  8020f9:	6a 00                	push   $0x0
+  8020fb:	e8 ea ec ff ff       	call   800dea <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  802100:	83 c4 10             	add    $0x10,%esp
+  802103:	85 c0                	test   %eax,%eax
+  802105:	0f 85 4a ff ff ff    	jne    802055 <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  80210b:	83 ec 04             	sub    $0x4,%esp
+  80210e:	68 05 08 00 00       	push   $0x805
+  802113:	ff 75 cc             	push   -0x34(%ebp)
+  802116:	6a 00                	push   $0x0
+  802118:	56                   	push   %esi
+  802119:	6a 00                	push   $0x0
+  80211b:	6a 05                	push   $0x5
+  80211d:	68 40 60 80 00       	push   $0x806040
+  802122:	e8 59 f1 ff ff       	call   801280 <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  802127:	c1 e8 1f             	shr    $0x1f,%eax
+  80212a:	08 45 cb             	or     %al,-0x35(%ebp)
+  80212d:	83 c4 20             	add    $0x20,%esp
+  802130:	e9 33 ff ff ff       	jmp    802068 <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  802135:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  802138:	83 ec 0c             	sub    $0xc,%esp
+  80213b:	68 40 60 80 00       	push   $0x806040
+  802140:	e8 eb f0 ff ff       	call   801230 <sysbatch_flush>
+  802145:	83 c4 10             	add    $0x10,%esp
+  802148:	85 c0                	test   %eax,%eax
+  80214a:	78 06                	js     802152 <devfile_read+0x231>
+  80214c:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  802150:	74 14                	je     802166 <devfile_read+0x245>
+    memmove(dst, src, r);
+  802152:	83 ec 04             	sub    $0x4,%esp
+  802155:	ff 75 d4             	push   -0x2c(%ebp)
+  802158:	ff 75 d0             	push   -0x30(%ebp)
+  80215b:	ff 75 0c             	push   0xc(%ebp)
+  80215e:	e8 21 ea ff ff       	call   800b84 <memmove>
+  802163:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  802166:	8b 45 08             	mov    0x8(%ebp),%eax
+  802169:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  80216c:	e9 11 fe ff ff       	jmp    801f82 <devfile_read+0x61>
+  assert(r <= n);
+  802171:	68 69 41 80 00       	push   $0x804169
+  802176:	68 70 41 80 00       	push   $0x804170
+  80217b:	68 1c 01 00 00       	push   $0x11c
+  802180:	68 5e 41 80 00       	push   $0x80415e
+  802185:	e8 ab e1 ff ff       	call   800335 <_panic>
+  assert(r <= PGSIZE);
+  80218a:	68 85 41 80 00       	push   $0x804185
+  80218f:	68 70 41 80 00       	push   $0x804170
+  802194:	68 1d 01 00 00       	push   $0x11d
+  802199:	68 5e 41 80 00       	push   $0x80415e
+  80219e:	e8 92 e1 ff ff       	call   800335 <_panic>
+
+008021a3 <devfile_write>:
+{
+  8021a3:	55                   	push   %ebp
+  8021a4:	89 e5                	mov    %esp,%ebp
+  8021a6:	57                   	push   %edi
+  8021a7:	56                   	push   %esi
+  8021a8:	53                   	push   %ebx
+  8021a9:	83 ec 1c             	sub    $0x1c,%esp
+  8021ac:	8b 75 08             	mov    0x8(%ebp),%esi
+  8021af:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  8021b2:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  8021b7:	77 39                	ja     8021f2 <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8021b9:	8b 56 0c             	mov    0xc(%esi),%edx
+  8021bc:	89 15 00 c0 80 00    	mov    %edx,0x80c000
+  fsipcbuf.write.req_n = n;
+  8021c2:	a3 04 c0 80 00       	mov    %eax,0x80c004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  8021c7:	83 ec 04             	sub    $0x4,%esp
+  8021ca:	50                   	push   %eax
+  8021cb:	ff 75 0c             	push   0xc(%ebp)
+  8021ce:	68 08 c0 80 00       	push   $0x80c008
+  8021d3:	e8 ac e9 ff ff       	call   800b84 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  8021d8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021dd:	b8 04 00 00 00       	mov    $0x4,%eax
+  8021e2:	e8 e7 fb ff ff       	call   801dce <fsipc>
+  8021e7:	83 c4 10             	add    $0x10,%esp
+}
+  8021ea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021ed:	5b                   	pop    %ebx
+  8021ee:	5e                   	pop    %esi
+  8021ef:	5f                   	pop    %edi
+  8021f0:	5d                   	pop    %ebp
+  8021f1:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  8021f2:	ba 00 00 10 00       	mov    $0x100000,%edx
+  8021f7:	39 d0                	cmp    %edx,%eax
+  8021f9:	89 d3                	mov    %edx,%ebx
+  8021fb:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  8021fe:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  802204:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  802207:	83 c7 01             	add    $0x1,%edi
+  80220a:	89 f8                	mov    %edi,%eax
+  80220c:	e8 94 fc ff ff       	call   801ea5 <fsv_alloc>
+  802211:	85 c0                	test   %eax,%eax
+  802213:	78 d5                	js     8021ea <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  802215:	83 ec 04             	sub    $0x4,%esp
+  802218:	53                   	push   %ebx
+  802219:	ff 75 0c             	push   0xc(%ebp)
+  80221c:	68 00 10 c0 9f       	push   $0x9fc01000
+  802221:	e8 5e e9 ff ff       	call   800b84 <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  802226:	8b 46 0c             	mov    0xc(%esi),%eax
+  802229:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  80222e:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  802234:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  80223b:	89 f9                	mov    %edi,%ecx
+  80223d:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  802242:	b8 0d 00 00 00       	mov    $0xd,%eax
+  802247:	e8 69 fa ff ff       	call   801cb5 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  80224c:	6a 00                	push   $0x0
+  80224e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802251:	50                   	push   %eax
+  802252:	6a 00                	push   $0x0
+  802254:	6a 00                	push   $0x0
+  802256:	e8 98 15 00 00       	call   8037f3 <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  80225b:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  80225e:	eb 8a                	jmp    8021ea <devfile_write+0x47>
+
+00802260 <open>:
+{
+  802260:	55                   	push   %ebp
+  802261:	89 e5                	mov    %esp,%ebp
+  802263:	56                   	push   %esi
+  802264:	53                   	push   %ebx
+  802265:	83 ec 1c             	sub    $0x1c,%esp
+  802268:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  80226b:	56                   	push   %esi
+  80226c:	e8 52 e7 ff ff       	call   8009c3 <strlen>
+  802271:	83 c4 10             	add    $0x10,%esp
+  802274:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802279:	7f 6c                	jg     8022e7 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  80227b:	83 ec 0c             	sub    $0xc,%esp
+  80227e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802281:	50                   	push   %eax
+  802282:	e8 ad f4 ff ff       	call   801734 <fd_alloc>
+  802287:	89 c3                	mov    %eax,%ebx
+  802289:	83 c4 10             	add    $0x10,%esp
+  80228c:	85 c0                	test   %eax,%eax
+  80228e:	78 3c                	js     8022cc <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  802290:	83 ec 08             	sub    $0x8,%esp
+  802293:	56                   	push   %esi
+  802294:	68 00 c0 80 00       	push   $0x80c000
+  802299:	e8 60 e7 ff ff       	call   8009fe <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  80229e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022a1:	a3 00 c4 80 00       	mov    %eax,0x80c400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8022a6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8022a9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022ae:	e8 1b fb ff ff       	call   801dce <fsipc>
+  8022b3:	89 c3                	mov    %eax,%ebx
+  8022b5:	83 c4 10             	add    $0x10,%esp
+  8022b8:	85 c0                	test   %eax,%eax
+  8022ba:	78 19                	js     8022d5 <open+0x75>
+  return fd2num(fd);
+  8022bc:	83 ec 0c             	sub    $0xc,%esp
+  8022bf:	ff 75 f4             	push   -0xc(%ebp)
+  8022c2:	e8 49 f4 ff ff       	call   801710 <fd2num>
+  8022c7:	89 c3                	mov    %eax,%ebx
+  8022c9:	83 c4 10             	add    $0x10,%esp
+}
+  8022cc:	89 d8                	mov    %ebx,%eax
+  8022ce:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022d1:	5b                   	pop    %ebx
+  8022d2:	5e                   	pop    %esi
+  8022d3:	5d                   	pop    %ebp
+  8022d4:	c3                   	ret
+    fd_close(fd, 0);
+  8022d5:	83 ec 08             	sub    $0x8,%esp
+  8022d8:	6a 00                	push   $0x0
+  8022da:	ff 75 f4             	push   -0xc(%ebp)
+  8022dd:	e8 44 f5 ff ff       	call   801826 <fd_close>
+    return r;
+  8022e2:	83 c4 10             	add    $0x10,%esp
+  8022e5:	eb e5                	jmp    8022cc <open+0x6c>
+    return -E_BAD_PATH;
+  8022e7:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8022ec:	eb de                	jmp    8022cc <open+0x6c>
+
+008022ee <open_read>:
+{
+  8022ee:	55                   	push   %ebp
+  8022ef:	89 e5                	mov    %esp,%ebp
+  8022f1:	57                   	push   %edi
+  8022f2:	56                   	push   %esi
+  8022f3:	53                   	push   %ebx
+  8022f4:	83 ec 28             	sub    $0x28,%esp
+  8022f7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  8022fa:	57                   	push   %edi
+  8022fb:	e8 c3 e6 ff ff       	call   8009c3 <strlen>
+  802300:	83 c4 10             	add    $0x10,%esp
+  802303:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802308:	0f 87 f6 00 00 00    	ja     802404 <open_read+0x116>
+  80230e:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  802310:	83 ec 0c             	sub    $0xc,%esp
+  802313:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802316:	50                   	push   %eax
+  802317:	e8 18 f4 ff ff       	call   801734 <fd_alloc>
+  80231c:	89 c3                	mov    %eax,%ebx
+  80231e:	83 c4 10             	add    $0x10,%esp
+  802321:	85 c0                	test   %eax,%eax
+  802323:	0f 88 b2 00 00 00    	js     8023db <open_read+0xed>
+  strcpy(req->req_buf, path);
+  802329:	83 ec 08             	sub    $0x8,%esp
+  80232c:	57                   	push   %edi
+  80232d:	68 e4 c0 80 00       	push   $0x80c0e4
+  802332:	e8 c7 e6 ff ff       	call   8009fe <strcpy>
+  req->req_nops = 2;
+  802337:	c7 05 00 c0 80 00 02 	movl   $0x2,0x80c000
+  80233e:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  802341:	c7 05 04 c0 80 00 01 	movl   $0x1,0x80c004
+  802348:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  80234b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80234e:	a3 10 c0 80 00       	mov    %eax,0x80c010
+  req->req_ops[0].op_buf = 0;
+  802353:	c7 05 18 c0 80 00 00 	movl   $0x0,0x80c018
+  80235a:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  80235d:	c7 05 20 c0 80 00 04 	movl   $0x4,0x80c020
+  802364:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  802367:	c7 05 24 c0 80 00 01 	movl   $0x1,0x80c024
+  80236e:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  802371:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  802376:	29 f0                	sub    %esi,%eax
+  802378:	3b 45 14             	cmp    0x14(%ebp),%eax
+  80237b:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  80237f:	a3 2c c0 80 00       	mov    %eax,0x80c02c
+  req->req_ops[1].op_offset = 0;
+  802384:	c7 05 30 c0 80 00 00 	movl   $0x0,0x80c030
+  80238b:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  80238e:	83 c6 01             	add    $0x1,%esi
+  802391:	89 35 34 c0 80 00    	mov    %esi,0x80c034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  802397:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80239a:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80239f:	e8 2a fa ff ff       	call   801dce <fsipc>
+  8023a4:	89 c3                	mov    %eax,%ebx
+  8023a6:	83 c4 10             	add    $0x10,%esp
+  8023a9:	83 f8 01             	cmp    $0x1,%eax
+  8023ac:	7e 37                	jle    8023e5 <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  8023ae:	a1 38 c0 80 00       	mov    0x80c038,%eax
+  8023b3:	8b 55 18             	mov    0x18(%ebp),%edx
+  8023b6:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  8023b8:	83 ec 04             	sub    $0x4,%esp
+  8023bb:	50                   	push   %eax
+  8023bc:	81 c6 e4 c0 80 00    	add    $0x80c0e4,%esi
+  8023c2:	56                   	push   %esi
+  8023c3:	ff 75 10             	push   0x10(%ebp)
+  8023c6:	e8 b9 e7 ff ff       	call   800b84 <memmove>
+  return fd2num(fd);
+  8023cb:	83 c4 04             	add    $0x4,%esp
+  8023ce:	ff 75 e4             	push   -0x1c(%ebp)
+  8023d1:	e8 3a f3 ff ff       	call   801710 <fd2num>
+  8023d6:	89 c3                	mov    %eax,%ebx
+  8023d8:	83 c4 10             	add    $0x10,%esp
+}
+  8023db:	89 d8                	mov    %ebx,%eax
+  8023dd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023e0:	5b                   	pop    %ebx
+  8023e1:	5e                   	pop    %esi
+  8023e2:	5f                   	pop    %edi
+  8023e3:	5d                   	pop    %ebp
+  8023e4:	c3                   	ret
+    fd_close(fd, 0);
+  8023e5:	83 ec 08             	sub    $0x8,%esp
+  8023e8:	6a 00                	push   $0x0
+  8023ea:	ff 75 e4             	push   -0x1c(%ebp)
+  8023ed:	e8 34 f4 ff ff       	call   801826 <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  8023f2:	83 c4 10             	add    $0x10,%esp
+  8023f5:	85 db                	test   %ebx,%ebx
+  8023f7:	78 e2                	js     8023db <open_read+0xed>
+  8023f9:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  8023fc:	8b 9b 1c c0 80 00    	mov    0x80c01c(%ebx),%ebx
+  802402:	eb d7                	jmp    8023db <open_read+0xed>
+    return -E_BAD_PATH;
+  802404:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802409:	eb d0                	jmp    8023db <open_read+0xed>
+
+0080240b <file_stat>:
+{
+  80240b:	55                   	push   %ebp
+  80240c:	89 e5                	mov    %esp,%ebp
+  80240e:	57                   	push   %edi
+  80240f:	56                   	push   %esi
+  802410:	53                   	push   %ebx
+  802411:	83 ec 18             	sub    $0x18,%esp
+  802414:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802417:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  80241a:	57                   	push   %edi
+  80241b:	e8 a3 e5 ff ff       	call   8009c3 <strlen>
+  802420:	83 c4 10             	add    $0x10,%esp
+  802423:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802428:	0f 8f c7 00 00 00    	jg     8024f5 <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  80242e:	83 ec 0c             	sub    $0xc,%esp
+  802431:	57                   	push   %edi
+  802432:	e8 8c e5 ff ff       	call   8009c3 <strlen>
+  802437:	8d 58 04             	lea    0x4(%eax),%ebx
+  80243a:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  80243d:	83 c4 08             	add    $0x8,%esp
+  802440:	57                   	push   %edi
+  802441:	68 e4 c0 80 00       	push   $0x80c0e4
+  802446:	e8 b3 e5 ff ff       	call   8009fe <strcpy>
+  req->req_nops = 2;
+  80244b:	c7 05 00 c0 80 00 02 	movl   $0x2,0x80c000
+  802452:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  802455:	c7 05 04 c0 80 00 02 	movl   $0x2,0x80c004
+  80245c:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  80245f:	c7 05 10 c0 80 00 00 	movl   $0x0,0x80c010
+  802466:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  802469:	c7 05 18 c0 80 00 00 	movl   $0x0,0x80c018
+  802470:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  802473:	c7 05 20 c0 80 00 03 	movl   $0x3,0x80c020
+  80247a:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  80247d:	c7 05 24 c0 80 00 01 	movl   $0x1,0x80c024
+  802484:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  802487:	89 1d 34 c0 80 00    	mov    %ebx,0x80c034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  80248d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802492:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802497:	e8 32 f9 ff ff       	call   801dce <fsipc>
+  80249c:	83 c4 10             	add    $0x10,%esp
+  80249f:	83 f8 01             	cmp    $0x1,%eax
+  8024a2:	7e 42                	jle    8024e6 <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  8024a4:	81 c3 e4 c0 80 00    	add    $0x80c0e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  8024aa:	83 ec 08             	sub    $0x8,%esp
+  8024ad:	53                   	push   %ebx
+  8024ae:	56                   	push   %esi
+  8024af:	e8 4a e5 ff ff       	call   8009fe <strcpy>
+  st->st_size = ret->ret_size;
+  8024b4:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  8024ba:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  8024c0:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  8024c6:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  8024cc:	c7 86 88 00 00 00 04 	movl   $0x805004,0x88(%esi)
+  8024d3:	50 80 00 
+  return 0;
+  8024d6:	83 c4 10             	add    $0x10,%esp
+  8024d9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024e1:	5b                   	pop    %ebx
+  8024e2:	5e                   	pop    %esi
+  8024e3:	5f                   	pop    %edi
+  8024e4:	5d                   	pop    %ebp
+  8024e5:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  8024e6:	85 c0                	test   %eax,%eax
+  8024e8:	78 f4                	js     8024de <file_stat+0xd3>
+  8024ea:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8024ed:	8b 80 1c c0 80 00    	mov    0x80c01c(%eax),%eax
+  8024f3:	eb e9                	jmp    8024de <file_stat+0xd3>
+    return -E_BAD_PATH;
+  8024f5:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8024fa:	eb e2                	jmp    8024de <file_stat+0xd3>
+
+008024fc <read_map>:
+{
+  8024fc:	55                   	push   %ebp
+  8024fd:	89 e5                	mov    %esp,%ebp
+  8024ff:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802502:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802505:	50                   	push   %eax
+  802506:	ff 75 08             	push   0x8(%ebp)
+  802509:	e8 7c f2 ff ff       	call   80178a <fd_lookup>
+  80250e:	83 c4 10             	add    $0x10,%esp
+  802511:	85 c0                	test   %eax,%eax
+  802513:	78 2a                	js     80253f <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  802515:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802518:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  80251e:	39 08                	cmp    %ecx,(%eax)
+  802520:	75 1f                	jne    802541 <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  802522:	8b 40 0c             	mov    0xc(%eax),%eax
+  802525:	a3 00 c0 80 00       	mov    %eax,0x80c000
+  fsipcbuf.read_map.req_offset = offset;
+  80252a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80252d:	a3 04 c0 80 00       	mov    %eax,0x80c004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  802532:	8b 55 10             	mov    0x10(%ebp),%edx
+  802535:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80253a:	e8 8f f8 ff ff       	call   801dce <fsipc>
+}
+  80253f:	c9                   	leave
+  802540:	c3                   	ret
+    return -E_INVAL;
+  802541:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802546:	eb f7                	jmp    80253f <read_map+0x43>
+
+00802548 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802548:	55                   	push   %ebp
+  802549:	89 e5                	mov    %esp,%ebp
+  80254b:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  80254e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802553:	b8 08 00 00 00       	mov    $0x8,%eax
+  802558:	e8 71 f8 ff ff       	call   801dce <fsipc>
+}
+  80255d:	c9                   	leave
+  80255e:	c3                   	ret
+
+0080255f <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  80255f:	55                   	push   %ebp
+  802560:	89 e5                	mov    %esp,%ebp
+  802562:	57                   	push   %edi
+  802563:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  802564:	8b 45 08             	mov    0x8(%ebp),%eax
+  802567:	a3 00 c0 80 00       	mov    %eax,0x80c000
+  fsipcbuf.stats.req_bio_sched = 0;
+  80256c:	c7 05 04 c0 80 00 00 	movl   $0x0,0x80c004
+  802573:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  802576:	c7 05 08 c0 80 00 00 	movl   $0x0,0x80c008
+  80257d:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  802580:	ba 00 00 00 00       	mov    $0x0,%edx
+  802585:	b8 09 00 00 00       	mov    $0x9,%eax
+  80258a:	e8 3f f8 ff ff       	call   801dce <fsipc>
+  80258f:	85 c0                	test   %eax,%eax
+  802591:	78 14                	js     8025a7 <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  802593:	be 00 c0 80 00       	mov    $0x80c000,%esi
+  802598:	b9 16 00 00 00       	mov    $0x16,%ecx
+  80259d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8025a0:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  8025a2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025a7:	5e                   	pop    %esi
+  8025a8:	5f                   	pop    %edi
+  8025a9:	5d                   	pop    %ebp
+  8025aa:	c3                   	ret
+
+008025ab <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  8025ab:	55                   	push   %ebp
+  8025ac:	89 e5                	mov    %esp,%ebp
+  8025ae:	53                   	push   %ebx
+  8025af:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  8025b2:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8025b5:	50                   	push   %eax
+  8025b6:	6a 00                	push   $0x0
+  8025b8:	e8 a2 ff ff ff       	call   80255f <fs_stats>
+  8025bd:	83 c4 10             	add    $0x10,%esp
+  8025c0:	85 c0                	test   %eax,%eax
+  8025c2:	78 28                	js     8025ec <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  8025c4:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  8025c7:	83 ec 08             	sub    $0x8,%esp
+  8025ca:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8025cd:	50                   	push   %eax
+  8025ce:	6a 20                	push   $0x20
+  8025d0:	e8 8a ff ff ff       	call   80255f <fs_stats>
+  8025d5:	83 c4 10             	add    $0x10,%esp
+  8025d8:	85 c0                	test   %eax,%eax
+  8025da:	78 10                	js     8025ec <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  8025dc:	83 ec 08             	sub    $0x8,%esp
+  8025df:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8025e2:	50                   	push   %eax
+  8025e3:	53                   	push   %ebx
+  8025e4:	e8 76 ff ff ff       	call   80255f <fs_stats>
+  8025e9:	83 c4 10             	add    $0x10,%esp
+}
+  8025ec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025ef:	c9                   	leave
+  8025f0:	c3                   	ret
+
+008025f1 <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  8025f1:	55                   	push   %ebp
+  8025f2:	89 e5                	mov    %esp,%ebp
+  8025f4:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  8025f7:	c7 05 00 c0 80 00 00 	movl   $0x0,0x80c000
+  8025fe:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  802601:	8b 45 08             	mov    0x8(%ebp),%eax
+  802604:	a3 04 c0 80 00       	mov    %eax,0x80c004
+  fsipcbuf.stats.req_dcache = 0;
+  802609:	c7 05 08 c0 80 00 00 	movl   $0x0,0x80c008
+  802610:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  802613:	ba 00 00 00 00       	mov    $0x0,%edx
+  802618:	b8 09 00 00 00       	mov    $0x9,%eax
+  80261d:	e8 ac f7 ff ff       	call   801dce <fsipc>
+}
+  802622:	c9                   	leave
+  802623:	c3                   	ret
+
+00802624 <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  802624:	55                   	push   %ebp
+  802625:	89 e5                	mov    %esp,%ebp
+  802627:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  80262a:	c7 05 00 c0 80 00 00 	movl   $0x0,0x80c000
+  802631:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  802634:	c7 05 04 c0 80 00 00 	movl   $0x0,0x80c004
+  80263b:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  80263e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802641:	a3 08 c0 80 00       	mov    %eax,0x80c008
+  return fsipc(FSREQ_STATS, NULL);
+  802646:	ba 00 00 00 00       	mov    $0x0,%edx
+  80264b:	b8 09 00 00 00       	mov    $0x9,%eax
+  802650:	e8 79 f7 ff ff       	call   801dce <fsipc>
+}
+  802655:	c9                   	leave
+  802656:	c3                   	ret
+
+00802657 <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  802657:	55                   	push   %ebp
+  802658:	89 e5                	mov    %esp,%ebp
+  80265a:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80265d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802660:	50                   	push   %eax
+  802661:	ff 75 08             	push   0x8(%ebp)
+  802664:	e8 21 f1 ff ff       	call   80178a <fd_lookup>
+  802669:	83 c4 10             	add    $0x10,%esp
+  80266c:	85 c0                	test   %eax,%eax
+  80266e:	78 34                	js     8026a4 <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  802670:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802673:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  802679:	39 08                	cmp    %ecx,(%eax)
+  80267b:	75 29                	jne    8026a6 <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  80267d:	8b 40 0c             	mov    0xc(%eax),%eax
+  802680:	a3 00 c0 80 00       	mov    %eax,0x80c000
+  fsipcbuf.fallocate.req_offset = offset;
+  802685:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802688:	a3 04 c0 80 00       	mov    %eax,0x80c004
+  fsipcbuf.fallocate.req_len = len;
+  80268d:	8b 45 10             	mov    0x10(%ebp),%eax
+  802690:	a3 08 c0 80 00       	mov    %eax,0x80c008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  802695:	ba 00 00 00 00       	mov    $0x0,%edx
+  80269a:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80269f:	e8 2a f7 ff ff       	call   801dce <fsipc>
+}
+  8026a4:	c9                   	leave
+  8026a5:	c3                   	ret
+    return -E_INVAL;
+  8026a6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026ab:	eb f7                	jmp    8026a4 <fallocate+0x4d>
+
+008026ad <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  8026ad:	55                   	push   %ebp
+  8026ae:	89 e5                	mov    %esp,%ebp
+  8026b0:	57                   	push   %edi
+  8026b1:	56                   	push   %esi
+  8026b2:	53                   	push   %ebx
+  8026b3:	83 ec 24             	sub    $0x24,%esp
+  8026b6:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8026b9:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8026bc:	50                   	push   %eax
+  8026bd:	ff 75 08             	push   0x8(%ebp)
+  8026c0:	e8 c5 f0 ff ff       	call   80178a <fd_lookup>
+  8026c5:	83 c4 10             	add    $0x10,%esp
+  8026c8:	85 c0                	test   %eax,%eax
+  8026ca:	78 66                	js     802732 <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  8026cc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8026cf:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  8026d5:	39 08                	cmp    %ecx,(%eax)
+  8026d7:	75 61                	jne    80273a <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  8026d9:	85 f6                	test   %esi,%esi
+  8026db:	7e 50                	jle    80272d <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  8026dd:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  8026e2:	39 de                	cmp    %ebx,%esi
+  8026e4:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  8026e7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8026ea:	8b 40 0c             	mov    0xc(%eax),%eax
+  8026ed:	a3 00 c0 80 00       	mov    %eax,0x80c000
+    fsipcbuf.prefetch.req_n = m;
+  8026f2:	89 1d 04 c0 80 00    	mov    %ebx,0x80c004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  8026f8:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  8026ff:	83 ec 04             	sub    $0x4,%esp
+  802702:	57                   	push   %edi
+  802703:	ff 75 0c             	push   0xc(%ebp)
+  802706:	68 08 c0 80 00       	push   $0x80c008
+  80270b:	e8 74 e4 ff ff       	call   800b84 <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  802710:	ba 00 00 00 00       	mov    $0x0,%edx
+  802715:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80271a:	e8 af f6 ff ff       	call   801dce <fsipc>
+  80271f:	83 c4 10             	add    $0x10,%esp
+  802722:	85 c0                	test   %eax,%eax
+  802724:	78 0c                	js     802732 <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  802726:	01 7d 0c             	add    %edi,0xc(%ebp)
+  802729:	29 de                	sub    %ebx,%esi
+  80272b:	eb ac                	jmp    8026d9 <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  80272d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802732:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802735:	5b                   	pop    %ebx
+  802736:	5e                   	pop    %esi
+  802737:	5f                   	pop    %edi
+  802738:	5d                   	pop    %ebp
+  802739:	c3                   	ret
+    return -E_INVAL;
+  80273a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80273f:	eb f1                	jmp    802732 <prefetch+0x85>
+
+00802741 <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  802741:	55                   	push   %ebp
+  802742:	89 e5                	mov    %esp,%ebp
+  802744:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  802747:	50                   	push   %eax
+  802748:	e8 d3 ef ff ff       	call   801720 <fd2data>
+  80274d:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  802752:	c9                   	leave
+  802753:	c3                   	ret
+
+00802754 <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802754:	55                   	push   %ebp
+  802755:	89 e5                	mov    %esp,%ebp
+  802757:	56                   	push   %esi
+  802758:	53                   	push   %ebx
+  802759:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  80275c:	83 ec 0c             	sub    $0xc,%esp
+  80275f:	ff 75 08             	push   0x8(%ebp)
+  802762:	e8 b9 ef ff ff       	call   801720 <fd2data>
+  802767:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  802769:	83 c4 08             	add    $0x8,%esp
+  80276c:	68 c0 41 80 00       	push   $0x8041c0
+  802771:	53                   	push   %ebx
+  802772:	e8 87 e2 ff ff       	call   8009fe <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  802777:	8b 46 04             	mov    0x4(%esi),%eax
+  80277a:	2b 06                	sub    (%esi),%eax
+  80277c:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  802782:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802789:	00 00 00 
+  stat->st_dev = &devpipe;
+  80278c:	c7 83 88 00 00 00 20 	movl   $0x805020,0x88(%ebx)
+  802793:	50 80 00 
+  return 0;
+}
+  802796:	b8 00 00 00 00       	mov    $0x0,%eax
+  80279b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80279e:	5b                   	pop    %ebx
+  80279f:	5e                   	pop    %esi
+  8027a0:	5d                   	pop    %ebp
+  8027a1:	c3                   	ret
+
+008027a2 <pipe_wakeup>:
+{
+  8027a2:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  8027a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027a9:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  8027ac:	85 c0                	test   %eax,%eax
+  8027ae:	75 01                	jne    8027b1 <pipe_wakeup+0xf>
+  8027b0:	c3                   	ret
+{
+  8027b1:	55                   	push   %ebp
+  8027b2:	89 e5                	mov    %esp,%ebp
+  8027b4:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  8027b7:	6a 00                	push   $0x0
+  8027b9:	68 00 00 c0 ee       	push   $0xeec00000
+  8027be:	52                   	push   %edx
+  8027bf:	e8 c5 e9 ff ff       	call   801189 <sys_chan_wakeup>
+  8027c4:	83 c4 10             	add    $0x10,%esp
+}
+  8027c7:	c9                   	leave
+  8027c8:	c3                   	ret
+
+008027c9 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8027c9:	55                   	push   %ebp
+  8027ca:	89 e5                	mov    %esp,%ebp
+  8027cc:	57                   	push   %edi
+  8027cd:	56                   	push   %esi
+  8027ce:	53                   	push   %ebx
+  8027cf:	83 ec 18             	sub    $0x18,%esp
+  8027d2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  8027d5:	57                   	push   %edi
+  8027d6:	e8 45 ef ff ff       	call   801720 <fd2data>
+  8027db:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  8027dd:	83 c4 10             	add    $0x10,%esp
+  8027e0:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  8027e4:	74 2a                	je     802810 <devpipe_close+0x47>
+  8027e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  8027eb:	89 f8                	mov    %edi,%eax
+  8027ed:	e8 4f ff ff ff       	call   802741 <pipe_ring>
+  8027f2:	83 ec 08             	sub    $0x8,%esp
+  8027f5:	01 d8                	add    %ebx,%eax
+  8027f7:	50                   	push   %eax
+  8027f8:	6a 00                	push   $0x0
+  8027fa:	e8 b3 e6 ff ff       	call   800eb2 <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  8027ff:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802805:	83 c4 10             	add    $0x10,%esp
+  802808:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  80280e:	75 db                	jne    8027eb <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  802810:	83 ec 08             	sub    $0x8,%esp
+  802813:	57                   	push   %edi
+  802814:	6a 00                	push   $0x0
+  802816:	e8 97 e6 ff ff       	call   800eb2 <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  80281b:	83 c4 10             	add    $0x10,%esp
+  80281e:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  802822:	75 13                	jne    802837 <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  802824:	83 ec 08             	sub    $0x8,%esp
+  802827:	56                   	push   %esi
+  802828:	6a 00                	push   $0x0
+  80282a:	e8 83 e6 ff ff       	call   800eb2 <sys_page_unmap>
+}
+  80282f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802832:	5b                   	pop    %ebx
+  802833:	5e                   	pop    %esi
+  802834:	5f                   	pop    %edi
+  802835:	5d                   	pop    %ebp
+  802836:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802837:	8d 56 04             	lea    0x4(%esi),%edx
+  80283a:	8d 46 2c             	lea    0x2c(%esi),%eax
+  80283d:	e8 60 ff ff ff       	call   8027a2 <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802842:	8d 46 30             	lea    0x30(%esi),%eax
+  802845:	89 f2                	mov    %esi,%edx
+  802847:	e8 56 ff ff ff       	call   8027a2 <pipe_wakeup>
+  80284c:	eb d6                	jmp    802824 <devpipe_close+0x5b>
+
+0080284e <_pipeisclosed>:
+{
+  80284e:	55                   	push   %ebp
+  80284f:	89 e5                	mov    %esp,%ebp
+  802851:	57                   	push   %edi
+  802852:	56                   	push   %esi
+  802853:	53                   	push   %ebx
+  802854:	83 ec 1c             	sub    $0x1c,%esp
+  802857:	89 c7                	mov    %eax,%edi
+  802859:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  80285b:	a1 00 b0 80 00       	mov    0x80b000,%eax
+  802860:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  802863:	83 ec 0c             	sub    $0xc,%esp
+  802866:	57                   	push   %edi
+  802867:	e8 ea 10 00 00       	call   803956 <pageref>
+  80286c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80286f:	89 34 24             	mov    %esi,(%esp)
+  802872:	e8 df 10 00 00       	call   803956 <pageref>
+    nn = thisenv->env_runs;
+  802877:	8b 15 00 b0 80 00    	mov    0x80b000,%edx
+  80287d:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  802880:	83 c4 10             	add    $0x10,%esp
+  802883:	39 cb                	cmp    %ecx,%ebx
+  802885:	74 1b                	je     8028a2 <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  802887:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80288a:	75 cf                	jne    80285b <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80288c:	8b 42 58             	mov    0x58(%edx),%eax
+  80288f:	6a 01                	push   $0x1
+  802891:	50                   	push   %eax
+  802892:	53                   	push   %ebx
+  802893:	68 c7 41 80 00       	push   $0x8041c7
+  802898:	e8 73 db ff ff       	call   800410 <cprintf>
+  80289d:	83 c4 10             	add    $0x10,%esp
+  8028a0:	eb b9                	jmp    80285b <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  8028a2:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8028a5:	0f 94 c0             	sete   %al
+  8028a8:	0f b6 c0             	movzbl %al,%eax
+}
+  8028ab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028ae:	5b                   	pop    %ebx
+  8028af:	5e                   	pop    %esi
+  8028b0:	5f                   	pop    %edi
+  8028b1:	5d                   	pop    %ebp
+  8028b2:	c3                   	ret
+
+008028b3 <devpipe_write_bulk>:
+{
+  8028b3:	55                   	push   %ebp
+  8028b4:	89 e5                	mov    %esp,%ebp
+  8028b6:	57                   	push   %edi
+  8028b7:	56                   	push   %esi
+  8028b8:	53                   	push   %ebx
+  8028b9:	83 ec 1c             	sub    $0x1c,%esp
+  8028bc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8028bf:	89 d6                	mov    %edx,%esi
+  8028c1:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  8028c4:	e8 78 fe ff ff       	call   802741 <pipe_ring>
+  8028c9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  8028cc:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  8028d1:	8d 46 04             	lea    0x4(%esi),%eax
+  8028d4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  8028d7:	eb 75                	jmp    80294e <devpipe_write_bulk+0x9b>
+  8028d9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8028de:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  8028e2:	6a 64                	push   $0x64
+  8028e4:	68 00 00 c0 ee       	push   $0xeec00000
+  8028e9:	53                   	push   %ebx
+  8028ea:	56                   	push   %esi
+  8028eb:	e8 76 e8 ff ff       	call   801166 <sys_chan_sleep>
+      continue;
+  8028f0:	83 c4 10             	add    $0x10,%esp
+  8028f3:	eb 59                	jmp    80294e <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  8028f5:	89 d1                	mov    %edx,%ecx
+  8028f7:	c1 f9 1f             	sar    $0x1f,%ecx
+  8028fa:	c1 e9 11             	shr    $0x11,%ecx
+  8028fd:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802900:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802905:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  802907:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  80290d:	29 d3                	sub    %edx,%ebx
+  80290f:	ba 00 80 00 00       	mov    $0x8000,%edx
+  802914:	29 c2                	sub    %eax,%edx
+  802916:	39 d3                	cmp    %edx,%ebx
+  802918:	0f 47 da             	cmova  %edx,%ebx
+  80291b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80291e:	29 fa                	sub    %edi,%edx
+  802920:	39 d3                	cmp    %edx,%ebx
+  802922:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  802925:	83 ec 04             	sub    $0x4,%esp
+  802928:	53                   	push   %ebx
+  802929:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80292c:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  80292f:	52                   	push   %edx
+  802930:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802933:	01 c8                	add    %ecx,%eax
+  802935:	50                   	push   %eax
+  802936:	e8 ab e2 ff ff       	call   800be6 <memcpy>
+    i += m;
+  80293b:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  80293d:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802940:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802943:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802946:	e8 57 fe ff ff       	call   8027a2 <pipe_wakeup>
+  80294b:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  80294e:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802951:	73 2b                	jae    80297e <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  802953:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  802955:	8b 56 04             	mov    0x4(%esi),%edx
+  802958:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  80295e:	39 d0                	cmp    %edx,%eax
+  802960:	7d 93                	jge    8028f5 <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  802962:	89 f2                	mov    %esi,%edx
+  802964:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802967:	e8 e2 fe ff ff       	call   80284e <_pipeisclosed>
+  80296c:	85 c0                	test   %eax,%eax
+  80296e:	0f 84 65 ff ff ff    	je     8028d9 <devpipe_write_bulk+0x26>
+        return i;
+  802974:	89 f8                	mov    %edi,%eax
+}
+  802976:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802979:	5b                   	pop    %ebx
+  80297a:	5e                   	pop    %esi
+  80297b:	5f                   	pop    %edi
+  80297c:	5d                   	pop    %ebp
+  80297d:	c3                   	ret
+  return i;
+  80297e:	89 f8                	mov    %edi,%eax
+  802980:	eb f4                	jmp    802976 <devpipe_write_bulk+0xc3>
+
+00802982 <devpipe_write>:
+{
+  802982:	55                   	push   %ebp
+  802983:	89 e5                	mov    %esp,%ebp
+  802985:	57                   	push   %edi
+  802986:	56                   	push   %esi
+  802987:	53                   	push   %ebx
+  802988:	83 ec 28             	sub    $0x28,%esp
+  80298b:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  80298e:	56                   	push   %esi
+  80298f:	e8 8c ed ff ff       	call   801720 <fd2data>
+  802994:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  802996:	8b 78 28             	mov    0x28(%eax),%edi
+  802999:	83 c4 10             	add    $0x10,%esp
+  80299c:	85 ff                	test   %edi,%edi
+  80299e:	75 25                	jne    8029c5 <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  8029a0:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8029a3:	74 66                	je     802a0b <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8029a5:	8b 43 04             	mov    0x4(%ebx),%eax
+  8029a8:	8b 0b                	mov    (%ebx),%ecx
+  8029aa:	8d 51 20             	lea    0x20(%ecx),%edx
+  8029ad:	39 d0                	cmp    %edx,%eax
+  8029af:	72 2b                	jb     8029dc <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  8029b1:	89 da                	mov    %ebx,%edx
+  8029b3:	89 f0                	mov    %esi,%eax
+  8029b5:	e8 94 fe ff ff       	call   80284e <_pipeisclosed>
+  8029ba:	85 c0                	test   %eax,%eax
+  8029bc:	75 51                	jne    802a0f <devpipe_write+0x8d>
+      sys_yield();
+  8029be:	e8 08 e4 ff ff       	call   800dcb <sys_yield>
+  8029c3:	eb e0                	jmp    8029a5 <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  8029c5:	83 ec 0c             	sub    $0xc,%esp
+  8029c8:	ff 75 10             	push   0x10(%ebp)
+  8029cb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8029ce:	89 c2                	mov    %eax,%edx
+  8029d0:	89 f0                	mov    %esi,%eax
+  8029d2:	e8 dc fe ff ff       	call   8028b3 <devpipe_write_bulk>
+  8029d7:	83 c4 10             	add    $0x10,%esp
+  8029da:	eb 38                	jmp    802a14 <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8029dc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8029df:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8029e3:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8029e6:	89 c2                	mov    %eax,%edx
+  8029e8:	c1 fa 1f             	sar    $0x1f,%edx
+  8029eb:	89 d1                	mov    %edx,%ecx
+  8029ed:	c1 e9 1b             	shr    $0x1b,%ecx
+  8029f0:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8029f3:	83 e2 1f             	and    $0x1f,%edx
+  8029f6:	29 ca                	sub    %ecx,%edx
+  8029f8:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8029fc:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  802a00:	83 c0 01             	add    $0x1,%eax
+  802a03:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  802a06:	83 c7 01             	add    $0x1,%edi
+  802a09:	eb 95                	jmp    8029a0 <devpipe_write+0x1e>
+  return i;
+  802a0b:	89 f8                	mov    %edi,%eax
+  802a0d:	eb 05                	jmp    802a14 <devpipe_write+0x92>
+        return 0;
+  802a0f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a14:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a17:	5b                   	pop    %ebx
+  802a18:	5e                   	pop    %esi
+  802a19:	5f                   	pop    %edi
+  802a1a:	5d                   	pop    %ebp
+  802a1b:	c3                   	ret
+
+00802a1c <devpipe_read_bulk>:
+{
+  802a1c:	55                   	push   %ebp
+  802a1d:	89 e5                	mov    %esp,%ebp
+  802a1f:	57                   	push   %edi
+  802a20:	56                   	push   %esi
+  802a21:	53                   	push   %ebx
+  802a22:	83 ec 2c             	sub    $0x2c,%esp
+  802a25:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802a28:	89 d6                	mov    %edx,%esi
+  802a2a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802a2d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  802a30:	e8 0c fd ff ff       	call   802741 <pipe_ring>
+  802a35:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  802a38:	85 db                	test   %ebx,%ebx
+  802a3a:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802a3f:	0f 45 c3             	cmovne %ebx,%eax
+  802a42:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802a45:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802a4a:	8d 46 30             	lea    0x30(%esi),%eax
+  802a4d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  802a50:	eb 50                	jmp    802aa2 <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  802a52:	89 d1                	mov    %edx,%ecx
+  802a54:	c1 f9 1f             	sar    $0x1f,%ecx
+  802a57:	c1 e9 11             	shr    $0x11,%ecx
+  802a5a:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802a5d:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802a62:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  802a64:	29 d3                	sub    %edx,%ebx
+  802a66:	ba 00 80 00 00       	mov    $0x8000,%edx
+  802a6b:	29 c2                	sub    %eax,%edx
+  802a6d:	39 d3                	cmp    %edx,%ebx
+  802a6f:	0f 47 da             	cmova  %edx,%ebx
+  802a72:	8b 55 08             	mov    0x8(%ebp),%edx
+  802a75:	29 fa                	sub    %edi,%edx
+  802a77:	39 d3                	cmp    %edx,%ebx
+  802a79:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  802a7c:	83 ec 04             	sub    $0x4,%esp
+  802a7f:	53                   	push   %ebx
+  802a80:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802a83:	01 c8                	add    %ecx,%eax
+  802a85:	50                   	push   %eax
+  802a86:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802a89:	01 f8                	add    %edi,%eax
+  802a8b:	50                   	push   %eax
+  802a8c:	e8 55 e1 ff ff       	call   800be6 <memcpy>
+    i += m;
+  802a91:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  802a93:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802a95:	89 f2                	mov    %esi,%edx
+  802a97:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802a9a:	e8 03 fd ff ff       	call   8027a2 <pipe_wakeup>
+  802a9f:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802aa2:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802aa5:	73 51                	jae    802af8 <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  802aa7:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  802aaa:	8b 16                	mov    (%esi),%edx
+  802aac:	39 da                	cmp    %ebx,%edx
+  802aae:	75 a2                	jne    802a52 <devpipe_read_bulk+0x36>
+      if (i > 0)
+  802ab0:	85 ff                	test   %edi,%edi
+  802ab2:	75 44                	jne    802af8 <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  802ab4:	89 f2                	mov    %esi,%edx
+  802ab6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802ab9:	e8 90 fd ff ff       	call   80284e <_pipeisclosed>
+  802abe:	85 c0                	test   %eax,%eax
+  802ac0:	75 3a                	jne    802afc <devpipe_read_bulk+0xe0>
+  802ac2:	b8 01 00 00 00       	mov    $0x1,%eax
+  802ac7:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802acb:	6a 64                	push   $0x64
+  802acd:	ff 75 d4             	push   -0x2c(%ebp)
+  802ad0:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  802ad1:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802ad4:	50                   	push   %eax
+  802ad5:	e8 8c e6 ff ff       	call   801166 <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  802ada:	85 c0                	test   %eax,%eax
+  802adc:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ae1:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  802ae4:	83 c4 10             	add    $0x10,%esp
+  802ae7:	a8 01                	test   $0x1,%al
+  802ae9:	74 b7                	je     802aa2 <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  802aeb:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  802af0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802af3:	5b                   	pop    %ebx
+  802af4:	5e                   	pop    %esi
+  802af5:	5f                   	pop    %edi
+  802af6:	5d                   	pop    %ebp
+  802af7:	c3                   	ret
+  return i;
+  802af8:	89 f8                	mov    %edi,%eax
+  802afa:	eb f4                	jmp    802af0 <devpipe_read_bulk+0xd4>
+        return 0;
+  802afc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b01:	eb ed                	jmp    802af0 <devpipe_read_bulk+0xd4>
+
+00802b03 <devpipe_read>:
+{
+  802b03:	55                   	push   %ebp
+  802b04:	89 e5                	mov    %esp,%ebp
+  802b06:	57                   	push   %edi
+  802b07:	56                   	push   %esi
+  802b08:	53                   	push   %ebx
+  802b09:	83 ec 18             	sub    $0x18,%esp
+  802b0c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  802b0f:	57                   	push   %edi
+  802b10:	e8 0b ec ff ff       	call   801720 <fd2data>
+  802b15:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  802b17:	8b 70 28             	mov    0x28(%eax),%esi
+  802b1a:	83 c4 10             	add    $0x10,%esp
+  802b1d:	85 f6                	test   %esi,%esi
+  802b1f:	75 24                	jne    802b45 <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  802b21:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802b24:	74 60                	je     802b86 <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  802b26:	8b 03                	mov    (%ebx),%eax
+  802b28:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802b2b:	75 3b                	jne    802b68 <devpipe_read+0x65>
+      if (i > 0)
+  802b2d:	85 f6                	test   %esi,%esi
+  802b2f:	75 2d                	jne    802b5e <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  802b31:	89 da                	mov    %ebx,%edx
+  802b33:	89 f8                	mov    %edi,%eax
+  802b35:	e8 14 fd ff ff       	call   80284e <_pipeisclosed>
+  802b3a:	85 c0                	test   %eax,%eax
+  802b3c:	75 4c                	jne    802b8a <devpipe_read+0x87>
+      sys_yield();
+  802b3e:	e8 88 e2 ff ff       	call   800dcb <sys_yield>
+  802b43:	eb e1                	jmp    802b26 <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  802b45:	83 ec 08             	sub    $0x8,%esp
+  802b48:	6a 00                	push   $0x0
+  802b4a:	ff 75 10             	push   0x10(%ebp)
+  802b4d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802b50:	89 c2                	mov    %eax,%edx
+  802b52:	89 f8                	mov    %edi,%eax
+  802b54:	e8 c3 fe ff ff       	call   802a1c <devpipe_read_bulk>
+  802b59:	83 c4 10             	add    $0x10,%esp
+  802b5c:	eb 02                	jmp    802b60 <devpipe_read+0x5d>
+        return i;
+  802b5e:	89 f0                	mov    %esi,%eax
+}
+  802b60:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b63:	5b                   	pop    %ebx
+  802b64:	5e                   	pop    %esi
+  802b65:	5f                   	pop    %edi
+  802b66:	5d                   	pop    %ebp
+  802b67:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802b68:	99                   	cltd
+  802b69:	c1 ea 1b             	shr    $0x1b,%edx
+  802b6c:	01 d0                	add    %edx,%eax
+  802b6e:	83 e0 1f             	and    $0x1f,%eax
+  802b71:	29 d0                	sub    %edx,%eax
+  802b73:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802b78:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802b7b:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  802b7e:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  802b81:	83 c6 01             	add    $0x1,%esi
+  802b84:	eb 9b                	jmp    802b21 <devpipe_read+0x1e>
+  return i;
+  802b86:	89 f0                	mov    %esi,%eax
+  802b88:	eb d6                	jmp    802b60 <devpipe_read+0x5d>
+        return 0;
+  802b8a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b8f:	eb cf                	jmp    802b60 <devpipe_read+0x5d>
+
+00802b91 <pipe2>:
+{
+  802b91:	55                   	push   %ebp
+  802b92:	89 e5                	mov    %esp,%ebp
+  802b94:	57                   	push   %edi
+  802b95:	56                   	push   %esi
+  802b96:	53                   	push   %ebx
+  802b97:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  802b9a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802b9d:	50                   	push   %eax
+  802b9e:	e8 91 eb ff ff       	call   801734 <fd_alloc>
+  802ba3:	89 c3                	mov    %eax,%ebx
+  802ba5:	83 c4 10             	add    $0x10,%esp
+  802ba8:	85 c0                	test   %eax,%eax
+  802baa:	0f 88 fb 01 00 00    	js     802dab <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802bb0:	83 ec 04             	sub    $0x4,%esp
+  802bb3:	68 07 04 00 00       	push   $0x407
+  802bb8:	ff 75 e4             	push   -0x1c(%ebp)
+  802bbb:	6a 00                	push   $0x0
+  802bbd:	e8 6b e2 ff ff       	call   800e2d <sys_page_alloc>
+  802bc2:	89 c3                	mov    %eax,%ebx
+  802bc4:	83 c4 10             	add    $0x10,%esp
+  802bc7:	85 c0                	test   %eax,%eax
+  802bc9:	0f 88 dc 01 00 00    	js     802dab <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  802bcf:	83 ec 0c             	sub    $0xc,%esp
+  802bd2:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  802bd5:	50                   	push   %eax
+  802bd6:	e8 59 eb ff ff       	call   801734 <fd_alloc>
+  802bdb:	89 c3                	mov    %eax,%ebx
+  802bdd:	83 c4 10             	add    $0x10,%esp
+  802be0:	85 c0                	test   %eax,%eax
+  802be2:	0f 88 b3 01 00 00    	js     802d9b <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802be8:	83 ec 04             	sub    $0x4,%esp
+  802beb:	68 07 04 00 00       	push   $0x407
+  802bf0:	ff 75 e0             	push   -0x20(%ebp)
+  802bf3:	6a 00                	push   $0x0
+  802bf5:	e8 33 e2 ff ff       	call   800e2d <sys_page_alloc>
+  802bfa:	89 c3                	mov    %eax,%ebx
+  802bfc:	83 c4 10             	add    $0x10,%esp
+  802bff:	85 c0                	test   %eax,%eax
+  802c01:	0f 88 94 01 00 00    	js     802d9b <pipe2+0x20a>
+  va = fd2data(fd0);
+  802c07:	83 ec 0c             	sub    $0xc,%esp
+  802c0a:	ff 75 e4             	push   -0x1c(%ebp)
+  802c0d:	e8 0e eb ff ff       	call   801720 <fd2data>
+  802c12:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802c14:	83 c4 0c             	add    $0xc,%esp
+  802c17:	68 07 04 00 00       	push   $0x407
+  802c1c:	50                   	push   %eax
+  802c1d:	6a 00                	push   $0x0
+  802c1f:	e8 09 e2 ff ff       	call   800e2d <sys_page_alloc>
+  802c24:	89 c3                	mov    %eax,%ebx
+  802c26:	83 c4 10             	add    $0x10,%esp
+  802c29:	85 c0                	test   %eax,%eax
+  802c2b:	0f 88 5a 01 00 00    	js     802d8b <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802c31:	83 ec 0c             	sub    $0xc,%esp
+  802c34:	ff 75 e0             	push   -0x20(%ebp)
+  802c37:	e8 e4 ea ff ff       	call   801720 <fd2data>
+  802c3c:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802c43:	50                   	push   %eax
+  802c44:	6a 00                	push   $0x0
+  802c46:	57                   	push   %edi
+  802c47:	6a 00                	push   $0x0
+  802c49:	e8 22 e2 ff ff       	call   800e70 <sys_page_map>
+  802c4e:	89 c3                	mov    %eax,%ebx
+  802c50:	83 c4 20             	add    $0x20,%esp
+  802c53:	85 c0                	test   %eax,%eax
+  802c55:	0f 88 22 01 00 00    	js     802d7d <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  802c5b:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  802c5f:	74 72                	je     802cd3 <pipe2+0x142>
+  802c61:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  802c66:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802c69:	e8 d3 fa ff ff       	call   802741 <pipe_ring>
+  802c6e:	83 ec 04             	sub    $0x4,%esp
+  802c71:	68 07 04 00 00       	push   $0x407
+  802c76:	01 f0                	add    %esi,%eax
+  802c78:	50                   	push   %eax
+  802c79:	6a 00                	push   $0x0
+  802c7b:	e8 ad e1 ff ff       	call   800e2d <sys_page_alloc>
+  802c80:	89 c3                	mov    %eax,%ebx
+  802c82:	83 c4 10             	add    $0x10,%esp
+  802c85:	85 c0                	test   %eax,%eax
+  802c87:	0f 88 97 00 00 00    	js     802d24 <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  802c8d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802c90:	e8 ac fa ff ff       	call   802741 <pipe_ring>
+  802c95:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  802c98:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802c9b:	e8 a1 fa ff ff       	call   802741 <pipe_ring>
+  802ca0:	83 ec 0c             	sub    $0xc,%esp
+  802ca3:	68 07 04 00 00       	push   $0x407
+  802ca8:	53                   	push   %ebx
+  802ca9:	6a 00                	push   $0x0
+  802cab:	01 f0                	add    %esi,%eax
+  802cad:	50                   	push   %eax
+  802cae:	6a 00                	push   $0x0
+  802cb0:	e8 bb e1 ff ff       	call   800e70 <sys_page_map>
+  802cb5:	89 c3                	mov    %eax,%ebx
+  802cb7:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802cbd:	83 c4 20             	add    $0x20,%esp
+  802cc0:	85 c0                	test   %eax,%eax
+  802cc2:	78 60                	js     802d24 <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  802cc4:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802cca:	75 9a                	jne    802c66 <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  802ccc:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  802cd3:	a1 20 50 80 00       	mov    0x805020,%eax
+  802cd8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802cdb:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  802cdd:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802ce0:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  802ce7:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802cea:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  802cec:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802cef:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  802cf6:	83 ec 0c             	sub    $0xc,%esp
+  802cf9:	ff 75 e4             	push   -0x1c(%ebp)
+  802cfc:	e8 0f ea ff ff       	call   801710 <fd2num>
+  802d01:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802d04:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  802d06:	83 c4 04             	add    $0x4,%esp
+  802d09:	ff 75 e0             	push   -0x20(%ebp)
+  802d0c:	e8 ff e9 ff ff       	call   801710 <fd2num>
+  802d11:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802d14:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  802d17:	83 c4 10             	add    $0x10,%esp
+  802d1a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d1f:	e9 87 00 00 00       	jmp    802dab <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802d24:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  802d29:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802d2c:	e8 10 fa ff ff       	call   802741 <pipe_ring>
+  802d31:	83 ec 08             	sub    $0x8,%esp
+  802d34:	01 f0                	add    %esi,%eax
+  802d36:	50                   	push   %eax
+  802d37:	6a 00                	push   $0x0
+  802d39:	e8 74 e1 ff ff       	call   800eb2 <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  802d3e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802d41:	e8 fb f9 ff ff       	call   802741 <pipe_ring>
+  802d46:	83 c4 08             	add    $0x8,%esp
+  802d49:	01 f0                	add    %esi,%eax
+  802d4b:	50                   	push   %eax
+  802d4c:	6a 00                	push   $0x0
+  802d4e:	e8 5f e1 ff ff       	call   800eb2 <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802d53:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802d59:	83 c4 10             	add    $0x10,%esp
+  802d5c:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802d62:	75 c5                	jne    802d29 <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  802d64:	83 ec 0c             	sub    $0xc,%esp
+  802d67:	ff 75 e0             	push   -0x20(%ebp)
+  802d6a:	e8 b1 e9 ff ff       	call   801720 <fd2data>
+  802d6f:	83 c4 08             	add    $0x8,%esp
+  802d72:	50                   	push   %eax
+  802d73:	6a 00                	push   $0x0
+  802d75:	e8 38 e1 ff ff       	call   800eb2 <sys_page_unmap>
+  802d7a:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  802d7d:	83 ec 08             	sub    $0x8,%esp
+  802d80:	57                   	push   %edi
+  802d81:	6a 00                	push   $0x0
+  802d83:	e8 2a e1 ff ff       	call   800eb2 <sys_page_unmap>
+  802d88:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  802d8b:	83 ec 08             	sub    $0x8,%esp
+  802d8e:	ff 75 e0             	push   -0x20(%ebp)
+  802d91:	6a 00                	push   $0x0
+  802d93:	e8 1a e1 ff ff       	call   800eb2 <sys_page_unmap>
+  802d98:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  802d9b:	83 ec 08             	sub    $0x8,%esp
+  802d9e:	ff 75 e4             	push   -0x1c(%ebp)
+  802da1:	6a 00                	push   $0x0
+  802da3:	e8 0a e1 ff ff       	call   800eb2 <sys_page_unmap>
+  802da8:	83 c4 10             	add    $0x10,%esp
+}
+  802dab:	89 d8                	mov    %ebx,%eax
+  802dad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802db0:	5b                   	pop    %ebx
+  802db1:	5e                   	pop    %esi
+  802db2:	5f                   	pop    %edi
+  802db3:	5d                   	pop    %ebp
+  802db4:	c3                   	ret
+
+00802db5 <pipe>:
+{
+  802db5:	55                   	push   %ebp
+  802db6:	89 e5                	mov    %esp,%ebp
+  802db8:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  802dbb:	6a 00                	push   $0x0
+  802dbd:	ff 75 08             	push   0x8(%ebp)
+  802dc0:	e8 cc fd ff ff       	call   802b91 <pipe2>
+}
+  802dc5:	c9                   	leave
+  802dc6:	c3                   	ret
+
+00802dc7 <pipeisclosed>:
+{
+  802dc7:	55                   	push   %ebp
+  802dc8:	89 e5                	mov    %esp,%ebp
+  802dca:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802dcd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802dd0:	50                   	push   %eax
+  802dd1:	ff 75 08             	push   0x8(%ebp)
+  802dd4:	e8 b1 e9 ff ff       	call   80178a <fd_lookup>
+  802dd9:	83 c4 10             	add    $0x10,%esp
+  802ddc:	85 c0                	test   %eax,%eax
+  802dde:	78 18                	js     802df8 <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  802de0:	83 ec 0c             	sub    $0xc,%esp
+  802de3:	ff 75 f4             	push   -0xc(%ebp)
+  802de6:	e8 35 e9 ff ff       	call   801720 <fd2data>
+  802deb:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  802ded:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802df0:	e8 59 fa ff ff       	call   80284e <_pipeisclosed>
+  802df5:	83 c4 10             	add    $0x10,%esp
+}
+  802df8:	c9                   	leave
+  802df9:	c3                   	ret
+
+00802dfa <pipe_splice>:
+{
+  802dfa:	55                   	push   %ebp
+  802dfb:	89 e5                	mov    %esp,%ebp
+  802dfd:	57                   	push   %edi
+  802dfe:	56                   	push   %esi
+  802dff:	53                   	push   %ebx
+  802e00:	83 ec 34             	sub    $0x34,%esp
+  802e03:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802e06:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802e09:	50                   	push   %eax
+  802e0a:	ff 75 08             	push   0x8(%ebp)
+  802e0d:	e8 78 e9 ff ff       	call   80178a <fd_lookup>
+  802e12:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802e15:	83 c4 10             	add    $0x10,%esp
+  802e18:	85 c0                	test   %eax,%eax
+  802e1a:	0f 88 d7 00 00 00    	js     802ef7 <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  802e20:	83 ec 0c             	sub    $0xc,%esp
+  802e23:	ff 75 e4             	push   -0x1c(%ebp)
+  802e26:	e8 f5 e8 ff ff       	call   801720 <fd2data>
+  802e2b:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802e2d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802e30:	83 c4 10             	add    $0x10,%esp
+  802e33:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  802e39:	39 10                	cmp    %edx,(%eax)
+  802e3b:	0f 85 c1 00 00 00    	jne    802f02 <pipe_splice+0x108>
+  802e41:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  802e45:	0f 84 c0 00 00 00    	je     802f0b <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  802e4b:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802e4f:	0f 84 bf 00 00 00    	je     802f14 <pipe_splice+0x11a>
+  802e55:	89 f7                	mov    %esi,%edi
+  802e57:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  802e5d:	0f 85 ba 00 00 00    	jne    802f1d <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802e63:	8d 43 04             	lea    0x4(%ebx),%eax
+  802e66:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802e69:	eb 38                	jmp    802ea3 <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802e6b:	83 ec 0c             	sub    $0xc,%esp
+  802e6e:	68 00 10 00 00       	push   $0x1000
+  802e73:	89 f1                	mov    %esi,%ecx
+  802e75:	89 da                	mov    %ebx,%edx
+  802e77:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802e7a:	e8 34 fa ff ff       	call   8028b3 <devpipe_write_bulk>
+  802e7f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802e82:	83 c4 10             	add    $0x10,%esp
+  802e85:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802e8a:	75 53                	jne    802edf <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  802e8c:	83 ec 08             	sub    $0x8,%esp
+  802e8f:	56                   	push   %esi
+  802e90:	6a 00                	push   $0x0
+  802e92:	e8 1b e0 ff ff       	call   800eb2 <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  802e97:	83 c7 01             	add    $0x1,%edi
+  802e9a:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802ea0:	83 c4 10             	add    $0x10,%esp
+  802ea3:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802ea6:	74 3a                	je     802ee2 <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  802ea8:	8b 03                	mov    (%ebx),%eax
+  802eaa:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802ead:	75 bc                	jne    802e6b <pipe_splice+0x71>
+  802eaf:	b8 00 00 00 00       	mov    $0x0,%eax
+  802eb4:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  802eb8:	85 c0                	test   %eax,%eax
+  802eba:	74 af                	je     802e6b <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802ebc:	83 ec 04             	sub    $0x4,%esp
+  802ebf:	6a 07                	push   $0x7
+  802ec1:	56                   	push   %esi
+  802ec2:	ff 75 d0             	push   -0x30(%ebp)
+  802ec5:	e8 bf e2 ff ff       	call   801189 <sys_chan_wakeup>
+  802eca:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802ecd:	83 c4 10             	add    $0x10,%esp
+  802ed0:	85 c0                	test   %eax,%eax
+  802ed2:	79 b8                	jns    802e8c <pipe_splice+0x92>
+  802ed4:	b8 01 00 00 00       	mov    $0x1,%eax
+  802ed9:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802edd:	eb 8c                	jmp    802e6b <pipe_splice+0x71>
+  802edf:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  802ee2:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802ee6:	75 06                	jne    802eee <pipe_splice+0xf4>
+  802ee8:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802eec:	78 09                	js     802ef7 <pipe_splice+0xfd>
+  return i * PGSIZE;
+  802eee:	8b 45 10             	mov    0x10(%ebp),%eax
+  802ef1:	c1 e0 0c             	shl    $0xc,%eax
+  802ef4:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  802ef7:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802efa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802efd:	5b                   	pop    %ebx
+  802efe:	5e                   	pop    %esi
+  802eff:	5f                   	pop    %edi
+  802f00:	5d                   	pop    %ebp
+  802f01:	c3                   	ret
+    return -E_INVAL;
+  802f02:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802f09:	eb ec                	jmp    802ef7 <pipe_splice+0xfd>
+  802f0b:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802f12:	eb e3                	jmp    802ef7 <pipe_splice+0xfd>
+  802f14:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802f1b:	eb da                	jmp    802ef7 <pipe_splice+0xfd>
+  802f1d:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802f24:	eb d1                	jmp    802ef7 <pipe_splice+0xfd>
+
+00802f26 <pipe_splice_read>:
+{
+  802f26:	55                   	push   %ebp
+  802f27:	89 e5                	mov    %esp,%ebp
+  802f29:	53                   	push   %ebx
+  802f2a:	83 ec 1c             	sub    $0x1c,%esp
+  802f2d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802f30:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802f33:	50                   	push   %eax
+  802f34:	ff 75 08             	push   0x8(%ebp)
+  802f37:	e8 4e e8 ff ff       	call   80178a <fd_lookup>
+  802f3c:	83 c4 10             	add    $0x10,%esp
+  802f3f:	85 c0                	test   %eax,%eax
+  802f41:	78 49                	js     802f8c <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  802f43:	83 ec 0c             	sub    $0xc,%esp
+  802f46:	ff 75 f4             	push   -0xc(%ebp)
+  802f49:	e8 d2 e7 ff ff       	call   801720 <fd2data>
+  802f4e:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802f50:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802f53:	83 c4 10             	add    $0x10,%esp
+  802f56:	8b 0d 20 50 80 00    	mov    0x805020,%ecx
+  802f5c:	39 08                	cmp    %ecx,(%eax)
+  802f5e:	75 31                	jne    802f91 <pipe_splice_read+0x6b>
+  802f60:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  802f64:	74 32                	je     802f98 <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  802f66:	8b 48 08             	mov    0x8(%eax),%ecx
+  802f69:	83 e1 03             	and    $0x3,%ecx
+  802f6c:	83 f9 01             	cmp    $0x1,%ecx
+  802f6f:	74 2e                	je     802f9f <pipe_splice_read+0x79>
+  802f71:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  802f77:	75 2d                	jne    802fa6 <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  802f79:	83 ec 08             	sub    $0x8,%esp
+  802f7c:	53                   	push   %ebx
+  802f7d:	68 00 10 00 00       	push   $0x1000
+  802f82:	89 d9                	mov    %ebx,%ecx
+  802f84:	e8 93 fa ff ff       	call   802a1c <devpipe_read_bulk>
+  802f89:	83 c4 10             	add    $0x10,%esp
+}
+  802f8c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f8f:	c9                   	leave
+  802f90:	c3                   	ret
+    return -E_INVAL;
+  802f91:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802f96:	eb f4                	jmp    802f8c <pipe_splice_read+0x66>
+  802f98:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802f9d:	eb ed                	jmp    802f8c <pipe_splice_read+0x66>
+  802f9f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802fa4:	eb e6                	jmp    802f8c <pipe_splice_read+0x66>
+  802fa6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802fab:	eb df                	jmp    802f8c <pipe_splice_read+0x66>
+
+00802fad <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  802fad:	55                   	push   %ebp
+  802fae:	89 e5                	mov    %esp,%ebp
+  802fb0:	56                   	push   %esi
+  802fb1:	53                   	push   %ebx
+  802fb2:	8b 75 08             	mov    0x8(%ebp),%esi
+  const volatile struct Env *e;
+
+  assert(envid != 0);
+  802fb5:	85 f6                	test   %esi,%esi
+  802fb7:	74 15                	je     802fce <wait+0x21>
+  e = &envs[ENVX(envid)];
+  802fb9:	89 f0                	mov    %esi,%eax
+  802fbb:	25 ff 03 00 00       	and    $0x3ff,%eax
+  while (e->env_id == envid && e->env_status != ENV_FREE)
+  802fc0:	8d 1c c0             	lea    (%eax,%eax,8),%ebx
+  802fc3:	c1 e3 04             	shl    $0x4,%ebx
+  802fc6:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  802fcc:	eb 1b                	jmp    802fe9 <wait+0x3c>
+  assert(envid != 0);
+  802fce:	68 df 41 80 00       	push   $0x8041df
+  802fd3:	68 70 41 80 00       	push   $0x804170
+  802fd8:	6a 09                	push   $0x9
+  802fda:	68 ea 41 80 00       	push   $0x8041ea
+  802fdf:	e8 51 d3 ff ff       	call   800335 <_panic>
+    sys_yield();
+  802fe4:	e8 e2 dd ff ff       	call   800dcb <sys_yield>
+  while (e->env_id == envid && e->env_status != ENV_FREE)
+  802fe9:	8b 43 48             	mov    0x48(%ebx),%eax
+  802fec:	39 f0                	cmp    %esi,%eax
+  802fee:	75 07                	jne    802ff7 <wait+0x4a>
+  802ff0:	8b 43 54             	mov    0x54(%ebx),%eax
+  802ff3:	85 c0                	test   %eax,%eax
+  802ff5:	75 ed                	jne    802fe4 <wait+0x37>
+}
+  802ff7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802ffa:	5b                   	pop    %ebx
+  802ffb:	5e                   	pop    %esi
+  802ffc:	5d                   	pop    %ebp
+  802ffd:	c3                   	ret
+
+00802ffe <mmap_find>:
+          utf->utf_eip, utf->utf_err);
+}
+
+static struct Mmap *
+mmap_find(uintptr_t va)
+{
+  802ffe:	55                   	push   %ebp
+  802fff:	89 e5                	mov    %esp,%ebp
+  803001:	56                   	push   %esi
+  803002:	53                   	push   %ebx
+  int i;
+
+  for (i = 0; i < NMMAP; i++)
+  803003:	ba 60 67 80 00       	mov    $0x806760,%edx
+  803008:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80300d:	eb 0b                	jmp    80301a <mmap_find+0x1c>
+  80300f:	83 c3 01             	add    $0x1,%ebx
+  803012:	83 c2 14             	add    $0x14,%edx
+  803015:	83 fb 10             	cmp    $0x10,%ebx
+  803018:	74 1d                	je     803037 <mmap_find+0x39>
+    if (mmaps[i].mm_va && va >= mmaps[i].mm_va &&
+  80301a:	8b 0a                	mov    (%edx),%ecx
+  80301c:	39 c8                	cmp    %ecx,%eax
+  80301e:	72 ef                	jb     80300f <mmap_find+0x11>
+  803020:	85 c9                	test   %ecx,%ecx
+  803022:	74 eb                	je     80300f <mmap_find+0x11>
+        va < mmaps[i].mm_va + mmaps[i].mm_len)
+  803024:	03 4a 04             	add    0x4(%edx),%ecx
+    if (mmaps[i].mm_va && va >= mmaps[i].mm_va &&
+  803027:	39 c8                	cmp    %ecx,%eax
+  803029:	73 e4                	jae    80300f <mmap_find+0x11>
+      return &mmaps[i];
+  80302b:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80302e:	8d 04 85 60 67 80 00 	lea    0x806760(,%eax,4),%eax
+  803035:	eb 05                	jmp    80303c <mmap_find+0x3e>
+  return NULL;
+  803037:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80303c:	5b                   	pop    %ebx
+  80303d:	5e                   	pop    %esi
+  80303e:	5d                   	pop    %ebp
+  80303f:	c3                   	ret
+
+00803040 <va_mapped>:
+
+static bool
+va_mapped(uintptr_t va)
+{
+  return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+  803040:	89 c2                	mov    %eax,%edx
+  803042:	c1 ea 16             	shr    $0x16,%edx
+  803045:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80304c:	f6 c2 01             	test   $0x1,%dl
+  80304f:	74 11                	je     803062 <va_mapped+0x22>
+  803051:	c1 e8 0c             	shr    $0xc,%eax
+  803054:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80305b:	83 e0 01             	and    $0x1,%eax
+  80305e:	83 e0 01             	and    $0x1,%eax
+}
+  803061:	c3                   	ret
+  return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+  803062:	b8 00 00 00 00       	mov    $0x0,%eax
+  803067:	eb f5                	jmp    80305e <va_mapped+0x1e>
+
+00803069 <mmap_copy>:
+
+// Replace the page at 'va' with a copy of its first 'n' bytes, the rest
+// zeroed, mapped with 'perm'.
+static void
+mmap_copy(uintptr_t va, size_t n, int perm)
+{
+  803069:	55                   	push   %ebp
+  80306a:	89 e5                	mov    %esp,%ebp
+  80306c:	57                   	push   %edi
+  80306d:	56                   	push   %esi
+  80306e:	53                   	push   %ebx
+  80306f:	83 ec 10             	sub    $0x10,%esp
+  803072:	89 c3                	mov    %eax,%ebx
+  803074:	89 d7                	mov    %edx,%edi
+  803076:	89 ce                	mov    %ecx,%esi
+  int r;
+
+  if ((r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  803078:	6a 07                	push   $0x7
+  80307a:	68 00 f0 7f 00       	push   $0x7ff000
+  80307f:	6a 00                	push   $0x0
+  803081:	e8 a7 dd ff ff       	call   800e2d <sys_page_alloc>
+  803086:	83 c4 10             	add    $0x10,%esp
+  803089:	85 c0                	test   %eax,%eax
+  80308b:	78 46                	js     8030d3 <mmap_copy+0x6a>
+    panic("mmap: %e", r);
+  memmove(PFTEMP, (void *) va, n);
+  80308d:	83 ec 04             	sub    $0x4,%esp
+  803090:	57                   	push   %edi
+  803091:	53                   	push   %ebx
+  803092:	68 00 f0 7f 00       	push   $0x7ff000
+  803097:	e8 e8 da ff ff       	call   800b84 <memmove>
+  if ((r = sys_page_map(0, PFTEMP, 0, (void *) va, perm)) < 0 ||
+  80309c:	89 34 24             	mov    %esi,(%esp)
+  80309f:	53                   	push   %ebx
+  8030a0:	6a 00                	push   $0x0
+  8030a2:	68 00 f0 7f 00       	push   $0x7ff000
+  8030a7:	6a 00                	push   $0x0
+  8030a9:	e8 c2 dd ff ff       	call   800e70 <sys_page_map>
+  8030ae:	83 c4 20             	add    $0x20,%esp
+  8030b1:	85 c0                	test   %eax,%eax
+  8030b3:	78 30                	js     8030e5 <mmap_copy+0x7c>
+      (r = sys_page_unmap(0, PFTEMP)) < 0)
+  8030b5:	83 ec 08             	sub    $0x8,%esp
+  8030b8:	68 00 f0 7f 00       	push   $0x7ff000
+  8030bd:	6a 00                	push   $0x0
+  8030bf:	e8 ee dd ff ff       	call   800eb2 <sys_page_unmap>
+  if ((r = sys_page_map(0, PFTEMP, 0, (void *) va, perm)) < 0 ||
+  8030c4:	83 c4 10             	add    $0x10,%esp
+  8030c7:	85 c0                	test   %eax,%eax
+  8030c9:	78 1a                	js     8030e5 <mmap_copy+0x7c>
+    panic("mmap: %e", r);
+}
+  8030cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030ce:	5b                   	pop    %ebx
+  8030cf:	5e                   	pop    %esi
+  8030d0:	5f                   	pop    %edi
+  8030d1:	5d                   	pop    %ebp
+  8030d2:	c3                   	ret
+    panic("mmap: %e", r);
+  8030d3:	50                   	push   %eax
+  8030d4:	68 f5 41 80 00       	push   $0x8041f5
+  8030d9:	6a 3e                	push   $0x3e
+  8030db:	68 fe 41 80 00       	push   $0x8041fe
+  8030e0:	e8 50 d2 ff ff       	call   800335 <_panic>
+    panic("mmap: %e", r);
+  8030e5:	50                   	push   %eax
+  8030e6:	68 f5 41 80 00       	push   $0x8041f5
+  8030eb:	6a 42                	push   $0x42
+  8030ed:	68 fe 41 80 00       	push   $0x8041fe
+  8030f2:	e8 3e d2 ff ff       	call   800335 <_panic>
+
+008030f7 <mmap_fault>:
+// Handle a page fault in a mapping, if it is one.  Returns 1 if it was.
+// The fork page fault handlers call this first, so that mappings keep
+// working after a fork.
+bool
+mmap_fault(struct UTrapframe *utf)
+{
+  8030f7:	55                   	push   %ebp
+  8030f8:	89 e5                	mov    %esp,%ebp
+  8030fa:	57                   	push   %edi
+  8030fb:	56                   	push   %esi
+  8030fc:	53                   	push   %ebx
+  8030fd:	83 ec 1c             	sub    $0x1c,%esp
+  803100:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Fsreq_read_map saved;
+  struct Mmap *m;
+  uintptr_t va;
+  int perm, r;
+
+  va = ROUNDDOWN(utf->utf_fault_va, PGSIZE);
+  803103:	8b 1f                	mov    (%edi),%ebx
+  803105:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if (va < MMAPBASE || va >= MMAPTOP || (m = mmap_find(va)) == NULL)
+  80310b:	8d 83 00 00 00 60    	lea    0x60000000(%ebx),%eax
+  803111:	3d ff ff ff 2f       	cmp    $0x2fffffff,%eax
+  803116:	0f 87 24 01 00 00    	ja     803240 <mmap_fault+0x149>
+  80311c:	89 d8                	mov    %ebx,%eax
+  80311e:	e8 db fe ff ff       	call   802ffe <mmap_find>
+  803123:	89 c6                	mov    %eax,%esi
+  803125:	85 c0                	test   %eax,%eax
+  803127:	0f 84 20 01 00 00    	je     80324d <mmap_fault+0x156>
+    return 0;
+  if ((utf->utf_err & FEC_WR) && m->mm_perm == MAP_RDONLY)
+  80312d:	f6 47 04 02          	testb  $0x2,0x4(%edi)
+  803131:	74 13                	je     803146 <mmap_fault+0x4f>
+  803133:	83 78 10 00          	cmpl   $0x0,0x10(%eax)
+  803137:	0f 84 17 01 00 00    	je     803254 <mmap_fault+0x15d>
+    return 0;
+  perm = PTE_P | PTE_U | (m->mm_perm == MAP_RDONLY ? 0 : PTE_W);
+  80313d:	c7 45 e4 07 00 00 00 	movl   $0x7,-0x1c(%ebp)
+  803144:	eb 0f                	jmp    803155 <mmap_fault+0x5e>
+  803146:	83 78 10 01          	cmpl   $0x1,0x10(%eax)
+  80314a:	19 c0                	sbb    %eax,%eax
+  80314c:	83 e0 fe             	and    $0xfffffffe,%eax
+  80314f:	83 c0 07             	add    $0x7,%eax
+  803152:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+
+  if (!va_mapped(va)) {
+  803155:	89 d8                	mov    %ebx,%eax
+  803157:	e8 e4 fe ff ff       	call   803040 <va_mapped>
+  80315c:	84 c0                	test   %al,%al
+  80315e:	74 42                	je     8031a2 <mmap_fault+0xab>
+    }
+  }
+
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+    mmap_copy(va, PGSIZE, perm);
+  return 1;
+  803160:	b8 01 00 00 00       	mov    $0x1,%eax
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+  803165:	f6 47 04 02          	testb  $0x2,0x4(%edi)
+  803169:	0f 84 d6 00 00 00    	je     803245 <mmap_fault+0x14e>
+  80316f:	89 d8                	mov    %ebx,%eax
+  803171:	c1 e8 0c             	shr    $0xc,%eax
+  803174:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  return 1;
+  80317b:	b8 01 00 00 00       	mov    $0x1,%eax
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+  803180:	f6 c2 02             	test   $0x2,%dl
+  803183:	0f 85 bc 00 00 00    	jne    803245 <mmap_fault+0x14e>
+    mmap_copy(va, PGSIZE, perm);
+  803189:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80318c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803191:	89 d8                	mov    %ebx,%eax
+  803193:	e8 d1 fe ff ff       	call   803069 <mmap_copy>
+  return 1;
+  803198:	b8 01 00 00 00       	mov    $0x1,%eax
+  80319d:	e9 a3 00 00 00       	jmp    803245 <mmap_fault+0x14e>
+    saved = fsipcbuf.read_map;
+  8031a2:	a1 00 c0 80 00       	mov    0x80c000,%eax
+  8031a7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8031aa:	8b 15 04 c0 80 00    	mov    0x80c004,%edx
+  8031b0:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    r = read_map(m->mm_fd, m->mm_offset + (va - m->mm_va), (void *) va);
+  8031b3:	83 ec 04             	sub    $0x4,%esp
+  8031b6:	53                   	push   %ebx
+  8031b7:	89 d8                	mov    %ebx,%eax
+  8031b9:	03 46 0c             	add    0xc(%esi),%eax
+  8031bc:	2b 06                	sub    (%esi),%eax
+  8031be:	50                   	push   %eax
+  8031bf:	ff 76 08             	push   0x8(%esi)
+  8031c2:	e8 35 f3 ff ff       	call   8024fc <read_map>
+    fsipcbuf.read_map = saved;
+  8031c7:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8031ca:	89 0d 00 c0 80 00    	mov    %ecx,0x80c000
+  8031d0:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  8031d3:	89 15 04 c0 80 00    	mov    %edx,0x80c004
+    if (r < 0)
+  8031d9:	83 c4 10             	add    $0x10,%esp
+  8031dc:	85 c0                	test   %eax,%eax
+  8031de:	78 20                	js     803200 <mmap_fault+0x109>
+    if (r == 0) {
+  8031e0:	74 30                	je     803212 <mmap_fault+0x11b>
+    if (r < PGSIZE) {
+  8031e2:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  8031e7:	0f 8f 73 ff ff ff    	jg     803160 <mmap_fault+0x69>
+      mmap_copy(va, r, perm);
+  8031ed:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8031f0:	89 c2                	mov    %eax,%edx
+  8031f2:	89 d8                	mov    %ebx,%eax
+  8031f4:	e8 70 fe ff ff       	call   803069 <mmap_copy>
+      return 1;
+  8031f9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8031fe:	eb 45                	jmp    803245 <mmap_fault+0x14e>
+      panic("mmap: read_map: %e", r);
+  803200:	50                   	push   %eax
+  803201:	68 09 42 80 00       	push   $0x804209
+  803206:	6a 5f                	push   $0x5f
+  803208:	68 fe 41 80 00       	push   $0x8041fe
+  80320d:	e8 23 d1 ff ff       	call   800335 <_panic>
+      if ((r = sys_page_alloc(0, (void *) va, perm)) < 0)
+  803212:	83 ec 04             	sub    $0x4,%esp
+  803215:	ff 75 e4             	push   -0x1c(%ebp)
+  803218:	53                   	push   %ebx
+  803219:	6a 00                	push   $0x0
+  80321b:	e8 0d dc ff ff       	call   800e2d <sys_page_alloc>
+  803220:	83 c4 10             	add    $0x10,%esp
+  803223:	85 c0                	test   %eax,%eax
+  803225:	78 07                	js     80322e <mmap_fault+0x137>
+      return 1;
+  803227:	b8 01 00 00 00       	mov    $0x1,%eax
+  80322c:	eb 17                	jmp    803245 <mmap_fault+0x14e>
+        panic("mmap: %e", r);
+  80322e:	50                   	push   %eax
+  80322f:	68 f5 41 80 00       	push   $0x8041f5
+  803234:	6a 64                	push   $0x64
+  803236:	68 fe 41 80 00       	push   $0x8041fe
+  80323b:	e8 f5 d0 ff ff       	call   800335 <_panic>
+    return 0;
+  803240:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803245:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803248:	5b                   	pop    %ebx
+  803249:	5e                   	pop    %esi
+  80324a:	5f                   	pop    %edi
+  80324b:	5d                   	pop    %ebp
+  80324c:	c3                   	ret
+    return 0;
+  80324d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803252:	eb f1                	jmp    803245 <mmap_fault+0x14e>
+    return 0;
+  803254:	b8 00 00 00 00       	mov    $0x0,%eax
+  803259:	eb ea                	jmp    803245 <mmap_fault+0x14e>
+
+0080325b <mmap_pgfault>:
+{
+  80325b:	55                   	push   %ebp
+  80325c:	89 e5                	mov    %esp,%ebp
+  80325e:	53                   	push   %ebx
+  80325f:	83 ec 10             	sub    $0x10,%esp
+  803262:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (!mmap_fault(utf))
+  803265:	53                   	push   %ebx
+  803266:	e8 8c fe ff ff       	call   8030f7 <mmap_fault>
+  80326b:	83 c4 10             	add    $0x10,%esp
+  80326e:	84 c0                	test   %al,%al
+  803270:	74 05                	je     803277 <mmap_pgfault+0x1c>
+}
+  803272:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803275:	c9                   	leave
+  803276:	c3                   	ret
+    panic("page fault at %08x, eip %08x, err %04x", utf->utf_fault_va,
+  803277:	83 ec 08             	sub    $0x8,%esp
+  80327a:	ff 73 04             	push   0x4(%ebx)
+  80327d:	ff 73 28             	push   0x28(%ebx)
+  803280:	ff 33                	push   (%ebx)
+  803282:	68 1c 42 80 00       	push   $0x80421c
+  803287:	6a 20                	push   $0x20
+  803289:	68 fe 41 80 00       	push   $0x8041fe
+  80328e:	e8 a2 d0 ff ff       	call   800335 <_panic>
+
+00803293 <mmap>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_INVAL if offset isn't aligned, len is 0, or perm is unknown
+//	-E_NO_MEM if there's no free slot or address space for it
+int
+mmap(int fdnum, off_t offset, size_t len, int perm, void **addr)
+{
+  803293:	55                   	push   %ebp
+  803294:	89 e5                	mov    %esp,%ebp
+  803296:	57                   	push   %edi
+  803297:	56                   	push   %esi
+  803298:	53                   	push   %ebx
+  803299:	83 ec 44             	sub    $0x44,%esp
+  80329c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  struct Fd *fd;
+  uintptr_t va;
+  int i, j, r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80329f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8032a2:	50                   	push   %eax
+  8032a3:	ff 75 08             	push   0x8(%ebp)
+  8032a6:	e8 df e4 ff ff       	call   80178a <fd_lookup>
+  8032ab:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8032ae:	83 c4 10             	add    $0x10,%esp
+  8032b1:	85 c0                	test   %eax,%eax
+  8032b3:	0f 88 3e 01 00 00    	js     8033f7 <mmap+0x164>
+    return r;
+  if (offset < 0 || PGOFF(offset) || len == 0 ||
+  8032b9:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8032bd:	0f 88 d1 00 00 00    	js     803394 <mmap+0x101>
+  8032c3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8032c6:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8032cb:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8032ce:	0f 85 c9 00 00 00    	jne    80339d <mmap+0x10a>
+  8032d4:	85 db                	test   %ebx,%ebx
+  8032d6:	0f 84 ca 00 00 00    	je     8033a6 <mmap+0x113>
+  8032dc:	83 7d 14 02          	cmpl   $0x2,0x14(%ebp)
+  8032e0:	0f 87 c0 00 00 00    	ja     8033a6 <mmap+0x113>
+      (perm != MAP_RDONLY && perm != MAP_PRIVATE && perm != MAP_SHARED))
+    return -E_INVAL;
+  len = ROUNDUP(len, PGSIZE);
+  8032e6:	81 c3 ff 0f 00 00    	add    $0xfff,%ebx
+  8032ec:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  8032f2:	89 d9                	mov    %ebx,%ecx
+  8032f4:	89 5d c4             	mov    %ebx,-0x3c(%ebp)
+
+  // First fit: try the start of the region and the end of each
+  // mapping.
+  for (i = -1; i < NMMAP; i++) {
+  8032f7:	bb 4c 67 80 00       	mov    $0x80674c,%ebx
+  8032fc:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+    if (i >= 0 && !mmaps[i].mm_va)
+      continue;
+    va = i < 0 ? MMAPBASE : mmaps[i].mm_va + mmaps[i].mm_len;
+  803301:	bf 00 00 00 a0       	mov    $0xa0000000,%edi
+  803306:	eb 53                	jmp    80335b <mmap+0xc8>
+  803308:	bf 00 00 00 a0       	mov    $0xa0000000,%edi
+  80330d:	eb 4c                	jmp    80335b <mmap+0xc8>
+    if (len > MMAPTOP - va)
+      continue;
+    for (j = 0; j < NMMAP; j++)
+  80330f:	83 c0 01             	add    $0x1,%eax
+  803312:	83 f8 10             	cmp    $0x10,%eax
+  803315:	0f 84 e7 00 00 00    	je     803402 <mmap+0x16f>
+      if (mmaps[j].mm_va && va < mmaps[j].mm_va + mmaps[j].mm_len &&
+  80331b:	8d 34 80             	lea    (%eax,%eax,4),%esi
+  80331e:	8b 14 b5 60 67 80 00 	mov    0x806760(,%esi,4),%edx
+  803325:	85 d2                	test   %edx,%edx
+  803327:	74 e6                	je     80330f <mmap+0x7c>
+  803329:	89 d1                	mov    %edx,%ecx
+  80332b:	03 0c b5 64 67 80 00 	add    0x806764(,%esi,4),%ecx
+  803332:	39 cf                	cmp    %ecx,%edi
+  803334:	73 d9                	jae    80330f <mmap+0x7c>
+  803336:	39 da                	cmp    %ebx,%edx
+  803338:	73 d5                	jae    80330f <mmap+0x7c>
+  80333a:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80333d:	8b 55 cc             	mov    -0x34(%ebp),%edx
+  803340:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  for (i = -1; i < NMMAP; i++) {
+  803343:	83 c2 01             	add    $0x1,%edx
+  803346:	83 c3 14             	add    $0x14,%ebx
+  803349:	83 fa 10             	cmp    $0x10,%edx
+  80334c:	74 2b                	je     803379 <mmap+0xe6>
+    if (i >= 0 && !mmaps[i].mm_va)
+  80334e:	85 d2                	test   %edx,%edx
+  803350:	78 b6                	js     803308 <mmap+0x75>
+  803352:	8b 3b                	mov    (%ebx),%edi
+  803354:	85 ff                	test   %edi,%edi
+  803356:	74 eb                	je     803343 <mmap+0xb0>
+    va = i < 0 ? MMAPBASE : mmaps[i].mm_va + mmaps[i].mm_len;
+  803358:	03 7b 04             	add    0x4(%ebx),%edi
+    if (len > MMAPTOP - va)
+  80335b:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  803360:	29 f8                	sub    %edi,%eax
+  803362:	39 c8                	cmp    %ecx,%eax
+  803364:	72 dd                	jb     803343 <mmap+0xb0>
+    for (j = 0; j < NMMAP; j++)
+  803366:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+          mmaps[j].mm_va < va + len)
+  803369:	8d 34 0f             	lea    (%edi,%ecx,1),%esi
+  80336c:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  80336f:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  803372:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+  803375:	89 f3                	mov    %esi,%ebx
+  803377:	eb a2                	jmp    80331b <mmap+0x88>
+        break;
+    if (j == NMMAP)
+      break;
+  }
+  if (i == NMMAP)
+    return -E_NO_MEM;
+  803379:	c7 45 d4 fc ff ff ff 	movl   $0xfffffffc,-0x2c(%ebp)
+  803380:	eb 75                	jmp    8033f7 <mmap+0x164>
+    ;
+  if (j == NMMAP)
+    return -E_NO_MEM;
+
+  if (_pgfault_handler == 0)
+    set_pgfault_handler(mmap_pgfault);
+  803382:	83 ec 0c             	sub    $0xc,%esp
+  803385:	68 5b 32 80 00       	push   $0x80325b
+  80338a:	e8 f7 03 00 00       	call   803786 <set_pgfault_handler>
+  80338f:	83 c4 10             	add    $0x10,%esp
+  803392:	eb 24                	jmp    8033b8 <mmap+0x125>
+    return -E_INVAL;
+  803394:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  80339b:	eb 5a                	jmp    8033f7 <mmap+0x164>
+  80339d:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  8033a4:	eb 51                	jmp    8033f7 <mmap+0x164>
+  8033a6:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  8033ad:	eb 48                	jmp    8033f7 <mmap+0x164>
+  if (_pgfault_handler == 0)
+  8033af:	83 3d 00 d0 80 00 00 	cmpl   $0x0,0x80d000
+  8033b6:	74 ca                	je     803382 <mmap+0xef>
+
+  mmaps[j].mm_va = va;
+  8033b8:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  8033bf:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  8033c2:	c1 e2 02             	shl    $0x2,%edx
+  8033c5:	89 ba 60 67 80 00    	mov    %edi,0x806760(%edx)
+  mmaps[j].mm_len = len;
+  8033cb:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  8033ce:	89 b2 64 67 80 00    	mov    %esi,0x806764(%edx)
+  mmaps[j].mm_fd = fdnum;
+  8033d4:	8b 75 08             	mov    0x8(%ebp),%esi
+  8033d7:	89 b2 68 67 80 00    	mov    %esi,0x806768(%edx)
+  mmaps[j].mm_offset = offset;
+  8033dd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8033e0:	89 b2 6c 67 80 00    	mov    %esi,0x80676c(%edx)
+  mmaps[j].mm_perm = perm;
+  8033e6:	01 d8                	add    %ebx,%eax
+  8033e8:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  8033eb:	89 1c 85 70 67 80 00 	mov    %ebx,0x806770(,%eax,4)
+  *addr = (void *) va;
+  8033f2:	8b 45 18             	mov    0x18(%ebp),%eax
+  8033f5:	89 38                	mov    %edi,(%eax)
+  return 0;
+}
+  8033f7:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8033fa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033fd:	5b                   	pop    %ebx
+  8033fe:	5e                   	pop    %esi
+  8033ff:	5f                   	pop    %edi
+  803400:	5d                   	pop    %ebp
+  803401:	c3                   	ret
+  if (i == NMMAP)
+  803402:	b8 60 67 80 00       	mov    $0x806760,%eax
+  for (j = 0; j < NMMAP && mmaps[j].mm_va; j++)
+  803407:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+  80340a:	83 c0 14             	add    $0x14,%eax
+  80340d:	83 78 ec 00          	cmpl   $0x0,-0x14(%eax)
+  803411:	74 9c                	je     8033af <mmap+0x11c>
+  803413:	83 c3 01             	add    $0x1,%ebx
+  803416:	83 fb 10             	cmp    $0x10,%ebx
+  803419:	75 ef                	jne    80340a <mmap+0x177>
+    return -E_NO_MEM;
+  80341b:	c7 45 d4 fc ff ff ff 	movl   $0xfffffffc,-0x2c(%ebp)
+  803422:	eb d3                	jmp    8033f7 <mmap+0x164>
+
+00803424 <msync>:
+// nothing for other kinds of mapping.
+//
+// Returns 0 on success, < 0 on error.
+int
+msync(void *addr)
+{
+  803424:	55                   	push   %ebp
+  803425:	89 e5                	mov    %esp,%ebp
+  803427:	57                   	push   %edi
+  803428:	56                   	push   %esi
+  803429:	53                   	push   %ebx
+  80342a:	81 ec ac 00 00 00    	sub    $0xac,%esp
+  struct Stat st;
+  off_t saved, off;
+  uintptr_t va;
+  int n, r;
+
+  if ((m = mmap_find((uintptr_t) addr)) == NULL)
+  803430:	8b 45 08             	mov    0x8(%ebp),%eax
+  803433:	e8 c6 fb ff ff       	call   802ffe <mmap_find>
+  803438:	85 c0                	test   %eax,%eax
+  80343a:	0f 84 58 01 00 00    	je     803598 <msync+0x174>
+  803440:	89 c7                	mov    %eax,%edi
+    return -E_INVAL;
+  if (m->mm_perm != MAP_SHARED)
+    return 0;
+  803442:	bb 00 00 00 00       	mov    $0x0,%ebx
+  if (m->mm_perm != MAP_SHARED)
+  803447:	83 78 10 02          	cmpl   $0x2,0x10(%eax)
+  80344b:	74 0a                	je     803457 <msync+0x33>
+                          PTE_P | PTE_U | PTE_W)) < 0)
+      break;
+  }
+  fd->fd_offset = saved;
+  return r < 0 ? r : 0;
+}
+  80344d:	89 d8                	mov    %ebx,%eax
+  80344f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803452:	5b                   	pop    %ebx
+  803453:	5e                   	pop    %esi
+  803454:	5f                   	pop    %edi
+  803455:	5d                   	pop    %ebp
+  803456:	c3                   	ret
+  if ((r = fd_lookup(m->mm_fd, &fd)) < 0 || (r = fstat(m->mm_fd, &st)) < 0)
+  803457:	83 ec 08             	sub    $0x8,%esp
+  80345a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80345d:	50                   	push   %eax
+  80345e:	ff 77 08             	push   0x8(%edi)
+  803461:	e8 24 e3 ff ff       	call   80178a <fd_lookup>
+  803466:	89 c3                	mov    %eax,%ebx
+  803468:	83 c4 10             	add    $0x10,%esp
+  80346b:	85 c0                	test   %eax,%eax
+  80346d:	78 de                	js     80344d <msync+0x29>
+  80346f:	83 ec 08             	sub    $0x8,%esp
+  803472:	8d 85 58 ff ff ff    	lea    -0xa8(%ebp),%eax
+  803478:	50                   	push   %eax
+  803479:	ff 77 08             	push   0x8(%edi)
+  80347c:	e8 ac e7 ff ff       	call   801c2d <fstat>
+  803481:	89 c3                	mov    %eax,%ebx
+  803483:	83 c4 10             	add    $0x10,%esp
+  803486:	85 c0                	test   %eax,%eax
+  803488:	78 c3                	js     80344d <msync+0x29>
+  saved = fd->fd_offset;
+  80348a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80348d:	8b 40 04             	mov    0x4(%eax),%eax
+  803490:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%ebp)
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE) {
+  803496:	8b 37                	mov    (%edi),%esi
+  803498:	eb 29                	jmp    8034c3 <msync+0x9f>
+    if ((r = sys_page_map(0, (void *) va, 0, (void *) va,
+  80349a:	83 ec 0c             	sub    $0xc,%esp
+  80349d:	6a 07                	push   $0x7
+  80349f:	8b 85 50 ff ff ff    	mov    -0xb0(%ebp),%eax
+  8034a5:	50                   	push   %eax
+  8034a6:	6a 00                	push   $0x0
+  8034a8:	50                   	push   %eax
+  8034a9:	6a 00                	push   $0x0
+  8034ab:	e8 c0 d9 ff ff       	call   800e70 <sys_page_map>
+  8034b0:	89 c3                	mov    %eax,%ebx
+  8034b2:	83 c4 20             	add    $0x20,%esp
+  8034b5:	85 c0                	test   %eax,%eax
+  8034b7:	0f 88 c0 00 00 00    	js     80357d <msync+0x159>
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE) {
+  8034bd:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8034c3:	8b 07                	mov    (%edi),%eax
+  8034c5:	89 85 54 ff ff ff    	mov    %eax,-0xac(%ebp)
+  8034cb:	03 47 04             	add    0x4(%edi),%eax
+  8034ce:	39 c6                	cmp    %eax,%esi
+  8034d0:	0f 83 a7 00 00 00    	jae    80357d <msync+0x159>
+    if (!va_mapped(va) || !(uvpt[PGNUM(va)] & PTE_D))
+  8034d6:	89 f0                	mov    %esi,%eax
+  8034d8:	e8 63 fb ff ff       	call   803040 <va_mapped>
+  8034dd:	84 c0                	test   %al,%al
+  8034df:	74 dc                	je     8034bd <msync+0x99>
+  8034e1:	89 f0                	mov    %esi,%eax
+  8034e3:	c1 e8 0c             	shr    $0xc,%eax
+  8034e6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8034ed:	a8 40                	test   $0x40,%al
+  8034ef:	74 cc                	je     8034bd <msync+0x99>
+    off = m->mm_offset + (va - m->mm_va);
+  8034f1:	8b 47 0c             	mov    0xc(%edi),%eax
+  8034f4:	8b 8d 54 ff ff ff    	mov    -0xac(%ebp),%ecx
+  8034fa:	29 c8                	sub    %ecx,%eax
+  8034fc:	01 f0                	add    %esi,%eax
+    if (off >= st.st_size)
+  8034fe:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  803501:	39 c2                	cmp    %eax,%edx
+  803503:	7e 78                	jle    80357d <msync+0x159>
+    n = MIN(PGSIZE, st.st_size - off);
+  803505:	29 c2                	sub    %eax,%edx
+  803507:	89 d1                	mov    %edx,%ecx
+  803509:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80350e:	39 d1                	cmp    %edx,%ecx
+  803510:	0f 4e d1             	cmovle %ecx,%edx
+  803513:	89 95 54 ff ff ff    	mov    %edx,-0xac(%ebp)
+    if ((r = seek(m->mm_fd, off)) < 0 ||
+  803519:	83 ec 08             	sub    $0x8,%esp
+  80351c:	50                   	push   %eax
+  80351d:	ff 77 08             	push   0x8(%edi)
+  803520:	e8 60 e6 ff ff       	call   801b85 <seek>
+  803525:	89 c3                	mov    %eax,%ebx
+  803527:	83 c4 10             	add    $0x10,%esp
+  80352a:	85 c0                	test   %eax,%eax
+  80352c:	78 4f                	js     80357d <msync+0x159>
+        (r = write(m->mm_fd, (void *) va, n)) < 0)
+  80352e:	89 b5 50 ff ff ff    	mov    %esi,-0xb0(%ebp)
+  803534:	83 ec 04             	sub    $0x4,%esp
+  803537:	ff b5 54 ff ff ff    	push   -0xac(%ebp)
+  80353d:	56                   	push   %esi
+  80353e:	ff 77 08             	push   0x8(%edi)
+  803541:	e8 bd e5 ff ff       	call   801b03 <write>
+  803546:	89 c3                	mov    %eax,%ebx
+    if ((r = seek(m->mm_fd, off)) < 0 ||
+  803548:	83 c4 10             	add    $0x10,%esp
+  80354b:	85 c0                	test   %eax,%eax
+  80354d:	78 2e                	js     80357d <msync+0x159>
+    if (r < n && (r = write(m->mm_fd, (char *) va + r, n - r)) < 0)
+  80354f:	8b 95 54 ff ff ff    	mov    -0xac(%ebp),%edx
+  803555:	39 c2                	cmp    %eax,%edx
+  803557:	0f 8e 3d ff ff ff    	jle    80349a <msync+0x76>
+  80355d:	89 d0                	mov    %edx,%eax
+  80355f:	29 d8                	sub    %ebx,%eax
+  803561:	01 f3                	add    %esi,%ebx
+  803563:	83 ec 04             	sub    $0x4,%esp
+  803566:	50                   	push   %eax
+  803567:	53                   	push   %ebx
+  803568:	ff 77 08             	push   0x8(%edi)
+  80356b:	e8 93 e5 ff ff       	call   801b03 <write>
+  803570:	89 c3                	mov    %eax,%ebx
+  803572:	83 c4 10             	add    $0x10,%esp
+  803575:	85 c0                	test   %eax,%eax
+  803577:	0f 89 1d ff ff ff    	jns    80349a <msync+0x76>
+  fd->fd_offset = saved;
+  80357d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803580:	8b 8d 4c ff ff ff    	mov    -0xb4(%ebp),%ecx
+  803586:	89 48 04             	mov    %ecx,0x4(%eax)
+  return r < 0 ? r : 0;
+  803589:	85 db                	test   %ebx,%ebx
+  80358b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803590:	0f 4f d8             	cmovg  %eax,%ebx
+  803593:	e9 b5 fe ff ff       	jmp    80344d <msync+0x29>
+    return -E_INVAL;
+  803598:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80359d:	e9 ab fe ff ff       	jmp    80344d <msync+0x29>
+
+008035a2 <munmap>:
+// Remove the mapping at 'addr', writing a MAP_SHARED one back first.
+//
+// Returns 0 on success, < 0 on error.
+int
+munmap(void *addr)
+{
+  8035a2:	55                   	push   %ebp
+  8035a3:	89 e5                	mov    %esp,%ebp
+  8035a5:	56                   	push   %esi
+  8035a6:	53                   	push   %ebx
+  8035a7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct Mmap *m;
+  uintptr_t va;
+  int r;
+
+  if ((m = mmap_find((uintptr_t) addr)) == NULL)
+  8035aa:	89 d8                	mov    %ebx,%eax
+  8035ac:	e8 4d fa ff ff       	call   802ffe <mmap_find>
+  8035b1:	85 c0                	test   %eax,%eax
+  8035b3:	74 56                	je     80360b <munmap+0x69>
+  8035b5:	89 c6                	mov    %eax,%esi
+    return -E_INVAL;
+  if ((r = msync(addr)) < 0)
+  8035b7:	83 ec 0c             	sub    $0xc,%esp
+  8035ba:	53                   	push   %ebx
+  8035bb:	e8 64 fe ff ff       	call   803424 <msync>
+  8035c0:	83 c4 10             	add    $0x10,%esp
+  8035c3:	85 c0                	test   %eax,%eax
+  8035c5:	78 3d                	js     803604 <munmap+0x62>
+    return r;
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE)
+  8035c7:	8b 1e                	mov    (%esi),%ebx
+  8035c9:	eb 06                	jmp    8035d1 <munmap+0x2f>
+  8035cb:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8035d1:	8b 46 04             	mov    0x4(%esi),%eax
+  8035d4:	03 06                	add    (%esi),%eax
+  8035d6:	39 c3                	cmp    %eax,%ebx
+  8035d8:	73 1f                	jae    8035f9 <munmap+0x57>
+    if (va_mapped(va) && (r = sys_page_unmap(0, (void *) va)) < 0)
+  8035da:	89 d8                	mov    %ebx,%eax
+  8035dc:	e8 5f fa ff ff       	call   803040 <va_mapped>
+  8035e1:	84 c0                	test   %al,%al
+  8035e3:	74 e6                	je     8035cb <munmap+0x29>
+  8035e5:	83 ec 08             	sub    $0x8,%esp
+  8035e8:	53                   	push   %ebx
+  8035e9:	6a 00                	push   $0x0
+  8035eb:	e8 c2 d8 ff ff       	call   800eb2 <sys_page_unmap>
+  8035f0:	83 c4 10             	add    $0x10,%esp
+  8035f3:	85 c0                	test   %eax,%eax
+  8035f5:	79 d4                	jns    8035cb <munmap+0x29>
+  8035f7:	eb 0b                	jmp    803604 <munmap+0x62>
+      return r;
+  m->mm_va = 0;
+  8035f9:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  return 0;
+  8035ff:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803604:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803607:	5b                   	pop    %ebx
+  803608:	5e                   	pop    %esi
+  803609:	5d                   	pop    %ebp
+  80360a:	c3                   	ret
+    return -E_INVAL;
+  80360b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803610:	eb f2                	jmp    803604 <munmap+0x62>
+
+00803612 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  803612:	b8 00 00 00 00       	mov    $0x0,%eax
+  803617:	c3                   	ret
+
+00803618 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803618:	55                   	push   %ebp
+  803619:	89 e5                	mov    %esp,%ebp
+  80361b:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  80361e:	68 43 42 80 00       	push   $0x804243
+  803623:	ff 75 0c             	push   0xc(%ebp)
+  803626:	e8 d3 d3 ff ff       	call   8009fe <strcpy>
+  return 0;
+}
+  80362b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803630:	c9                   	leave
+  803631:	c3                   	ret
+
+00803632 <devcons_write>:
+{
+  803632:	55                   	push   %ebp
+  803633:	89 e5                	mov    %esp,%ebp
+  803635:	57                   	push   %edi
+  803636:	56                   	push   %esi
+  803637:	53                   	push   %ebx
+  803638:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  80363e:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  803643:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  803649:	eb 2e                	jmp    803679 <devcons_write+0x47>
+    m = n - tot;
+  80364b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80364e:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  803650:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803655:	39 c3                	cmp    %eax,%ebx
+  803657:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  80365a:	83 ec 04             	sub    $0x4,%esp
+  80365d:	53                   	push   %ebx
+  80365e:	89 f0                	mov    %esi,%eax
+  803660:	03 45 0c             	add    0xc(%ebp),%eax
+  803663:	50                   	push   %eax
+  803664:	57                   	push   %edi
+  803665:	e8 1a d5 ff ff       	call   800b84 <memmove>
+    sys_cputs(buf, m);
+  80366a:	83 c4 08             	add    $0x8,%esp
+  80366d:	53                   	push   %ebx
+  80366e:	57                   	push   %edi
+  80366f:	e8 ba d6 ff ff       	call   800d2e <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  803674:	01 de                	add    %ebx,%esi
+  803676:	83 c4 10             	add    $0x10,%esp
+  803679:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80367c:	72 cd                	jb     80364b <devcons_write+0x19>
+}
+  80367e:	89 f0                	mov    %esi,%eax
+  803680:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803683:	5b                   	pop    %ebx
+  803684:	5e                   	pop    %esi
+  803685:	5f                   	pop    %edi
+  803686:	5d                   	pop    %ebp
+  803687:	c3                   	ret
+
+00803688 <devcons_read>:
+{
+  803688:	55                   	push   %ebp
+  803689:	89 e5                	mov    %esp,%ebp
+  80368b:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  80368e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803693:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803697:	75 07                	jne    8036a0 <devcons_read+0x18>
+  803699:	eb 1f                	jmp    8036ba <devcons_read+0x32>
+    sys_yield();
+  80369b:	e8 2b d7 ff ff       	call   800dcb <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  8036a0:	e8 a7 d6 ff ff       	call   800d4c <sys_cgetc>
+  8036a5:	85 c0                	test   %eax,%eax
+  8036a7:	74 f2                	je     80369b <devcons_read+0x13>
+  if (c < 0)
+  8036a9:	78 0f                	js     8036ba <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  8036ab:	83 f8 04             	cmp    $0x4,%eax
+  8036ae:	74 0c                	je     8036bc <devcons_read+0x34>
+  *(char*)vbuf = c;
+  8036b0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8036b3:	88 02                	mov    %al,(%edx)
+  return 1;
+  8036b5:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8036ba:	c9                   	leave
+  8036bb:	c3                   	ret
+    return 0;
+  8036bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036c1:	eb f7                	jmp    8036ba <devcons_read+0x32>
+
+008036c3 <cputchar>:
+{
+  8036c3:	55                   	push   %ebp
+  8036c4:	89 e5                	mov    %esp,%ebp
+  8036c6:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  8036c9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8036cc:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  8036cf:	6a 01                	push   $0x1
+  8036d1:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8036d4:	50                   	push   %eax
+  8036d5:	e8 54 d6 ff ff       	call   800d2e <sys_cputs>
+}
+  8036da:	83 c4 10             	add    $0x10,%esp
+  8036dd:	c9                   	leave
+  8036de:	c3                   	ret
+
+008036df <getchar>:
+{
+  8036df:	55                   	push   %ebp
+  8036e0:	89 e5                	mov    %esp,%ebp
+  8036e2:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  8036e5:	6a 01                	push   $0x1
+  8036e7:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8036ea:	50                   	push   %eax
+  8036eb:	6a 00                	push   $0x0
+  8036ed:	e8 43 e3 ff ff       	call   801a35 <read>
+  if (r < 0)
+  8036f2:	83 c4 10             	add    $0x10,%esp
+  8036f5:	85 c0                	test   %eax,%eax
+  8036f7:	78 06                	js     8036ff <getchar+0x20>
+  if (r < 1)
+  8036f9:	74 06                	je     803701 <getchar+0x22>
+  return c;
+  8036fb:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8036ff:	c9                   	leave
+  803700:	c3                   	ret
+    return -E_EOF;
+  803701:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803706:	eb f7                	jmp    8036ff <getchar+0x20>
+
+00803708 <iscons>:
+{
+  803708:	55                   	push   %ebp
+  803709:	89 e5                	mov    %esp,%ebp
+  80370b:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80370e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803711:	50                   	push   %eax
+  803712:	ff 75 08             	push   0x8(%ebp)
+  803715:	e8 70 e0 ff ff       	call   80178a <fd_lookup>
+  80371a:	83 c4 10             	add    $0x10,%esp
+  80371d:	85 c0                	test   %eax,%eax
+  80371f:	78 11                	js     803732 <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  803721:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803724:	8b 15 3c 50 80 00    	mov    0x80503c,%edx
+  80372a:	39 10                	cmp    %edx,(%eax)
+  80372c:	0f 94 c0             	sete   %al
+  80372f:	0f b6 c0             	movzbl %al,%eax
+}
+  803732:	c9                   	leave
+  803733:	c3                   	ret
+
+00803734 <opencons>:
+{
+  803734:	55                   	push   %ebp
+  803735:	89 e5                	mov    %esp,%ebp
+  803737:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  80373a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80373d:	50                   	push   %eax
+  80373e:	e8 f1 df ff ff       	call   801734 <fd_alloc>
+  803743:	83 c4 10             	add    $0x10,%esp
+  803746:	85 c0                	test   %eax,%eax
+  803748:	78 3a                	js     803784 <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80374a:	83 ec 04             	sub    $0x4,%esp
+  80374d:	68 07 04 00 00       	push   $0x407
+  803752:	ff 75 f4             	push   -0xc(%ebp)
+  803755:	6a 00                	push   $0x0
+  803757:	e8 d1 d6 ff ff       	call   800e2d <sys_page_alloc>
+  80375c:	83 c4 10             	add    $0x10,%esp
+  80375f:	85 c0                	test   %eax,%eax
+  803761:	78 21                	js     803784 <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  803763:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803766:	8b 15 3c 50 80 00    	mov    0x80503c,%edx
+  80376c:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  80376e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803771:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  803778:	83 ec 0c             	sub    $0xc,%esp
+  80377b:	50                   	push   %eax
+  80377c:	e8 8f df ff ff       	call   801710 <fd2num>
+  803781:	83 c4 10             	add    $0x10,%esp
+}
+  803784:	c9                   	leave
+  803785:	c3                   	ret
+
+00803786 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  803786:	55                   	push   %ebp
+  803787:	89 e5                	mov    %esp,%ebp
+  803789:	53                   	push   %ebx
+  80378a:	83 ec 04             	sub    $0x4,%esp
+  int r;
+
+  if (_pgfault_handler == 0) {
+  80378d:	83 3d 00 d0 80 00 00 	cmpl   $0x0,0x80d000
+  803794:	74 0d                	je     8037a3 <set_pgfault_handler+0x1d>
+
+    sys_env_set_pgfault_upcall(id, _pgfault_upcall);
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  803796:	8b 45 08             	mov    0x8(%ebp),%eax
+  803799:	a3 00 d0 80 00       	mov    %eax,0x80d000
+}
+  80379e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8037a1:	c9                   	leave
+  8037a2:	c3                   	ret
+    envid_t id = sys_getenvid();
+  8037a3:	e8 04 d6 ff ff       	call   800dac <sys_getenvid>
+  8037a8:	89 c3                	mov    %eax,%ebx
+    sys_page_alloc(id, (void *) (UXSTACKTOP - PGSIZE), (PTE_P | PTE_U | PTE_W));
+  8037aa:	83 ec 04             	sub    $0x4,%esp
+  8037ad:	6a 07                	push   $0x7
+  8037af:	68 00 f0 bf ee       	push   $0xeebff000
+  8037b4:	50                   	push   %eax
+  8037b5:	e8 73 d6 ff ff       	call   800e2d <sys_page_alloc>
+    sys_env_set_pgfault_upcall(id, _pgfault_upcall);
+  8037ba:	83 c4 08             	add    $0x8,%esp
+  8037bd:	68 cd 37 80 00       	push   $0x8037cd
+  8037c2:	53                   	push   %ebx
+  8037c3:	e8 da d8 ff ff       	call   8010a2 <sys_env_set_pgfault_upcall>
+  8037c8:	83 c4 10             	add    $0x10,%esp
+  8037cb:	eb c9                	jmp    803796 <set_pgfault_handler+0x10>
+
+008037cd <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8037cd:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8037ce:	a1 00 d0 80 00       	mov    0x80d000,%eax
+	call *%eax
+  8037d3:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8037d5:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+  movl 48(%esp), %eax       // move trap time esp to eax
+  8037d8:	8b 44 24 30          	mov    0x30(%esp),%eax
+  subl $4, %eax             // make room for eip on trap time esp
+  8037dc:	83 e8 04             	sub    $0x4,%eax
+  movl %eax, 48(%esp)       // move value to esp
+  8037df:	89 44 24 30          	mov    %eax,0x30(%esp)
+  movl 40(%esp), %ebx       // move trap time eip to ebx
+  8037e3:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+  movl %ebx, 0(%eax)
+  8037e7:	89 18                	mov    %ebx,(%eax)
+
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+  addl $0x08,%esp
+  8037e9:	83 c4 08             	add    $0x8,%esp
+  popal
+  8037ec:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+  addl $4, %esp          // skip tf->eip
+  8037ed:	83 c4 04             	add    $0x4,%esp
+  popf                 // pop stack value into flags register
+  8037f0:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+  popl %esp
+  8037f1:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+  ret
+  8037f2:	c3                   	ret
+
+008037f3 <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  8037f3:	55                   	push   %ebp
+  8037f4:	89 e5                	mov    %esp,%ebp
+  8037f6:	57                   	push   %edi
+  8037f7:	56                   	push   %esi
+  8037f8:	53                   	push   %ebx
+  8037f9:	83 ec 14             	sub    $0x14,%esp
+  8037fc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8037ff:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803802:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803805:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  803808:	85 c0                	test   %eax,%eax
+  80380a:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80380f:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  803812:	ff 33                	push   (%ebx)
+  803814:	50                   	push   %eax
+  803815:	e8 eb d8 ff ff       	call   801105 <sys_ipc_recv>
+  80381a:	83 c4 10             	add    $0x10,%esp
+  80381d:	85 c0                	test   %eax,%eax
+  80381f:	78 39                	js     80385a <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  803821:	85 ff                	test   %edi,%edi
+  803823:	74 0a                	je     80382f <ipc_recv_pages+0x3c>
+  803825:	a1 00 b0 80 00       	mov    0x80b000,%eax
+  80382a:	8b 40 7c             	mov    0x7c(%eax),%eax
+  80382d:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  80382f:	85 f6                	test   %esi,%esi
+  803831:	74 0d                	je     803840 <ipc_recv_pages+0x4d>
+  803833:	a1 00 b0 80 00       	mov    0x80b000,%eax
+  803838:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  80383e:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  803840:	a1 00 b0 80 00       	mov    0x80b000,%eax
+  803845:	8b 40 74             	mov    0x74(%eax),%eax
+  803848:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  80384a:	a1 00 b0 80 00       	mov    0x80b000,%eax
+  80384f:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  803852:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803855:	5b                   	pop    %ebx
+  803856:	5e                   	pop    %esi
+  803857:	5f                   	pop    %edi
+  803858:	5d                   	pop    %ebp
+  803859:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  80385a:	85 ff                	test   %edi,%edi
+  80385c:	74 06                	je     803864 <ipc_recv_pages+0x71>
+  80385e:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  803864:	85 f6                	test   %esi,%esi
+  803866:	74 06                	je     80386e <ipc_recv_pages+0x7b>
+  803868:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  80386e:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  803874:	eb dc                	jmp    803852 <ipc_recv_pages+0x5f>
+
+00803876 <ipc_recv>:
+{
+  803876:	55                   	push   %ebp
+  803877:	89 e5                	mov    %esp,%ebp
+  803879:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  80387c:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  803883:	ff 75 10             	push   0x10(%ebp)
+  803886:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803889:	50                   	push   %eax
+  80388a:	ff 75 0c             	push   0xc(%ebp)
+  80388d:	ff 75 08             	push   0x8(%ebp)
+  803890:	e8 5e ff ff ff       	call   8037f3 <ipc_recv_pages>
+}
+  803895:	c9                   	leave
+  803896:	c3                   	ret
+
+00803897 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  803897:	55                   	push   %ebp
+  803898:	89 e5                	mov    %esp,%ebp
+  80389a:	57                   	push   %edi
+  80389b:	56                   	push   %esi
+  80389c:	53                   	push   %ebx
+  80389d:	83 ec 0c             	sub    $0xc,%esp
+  8038a0:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8038a3:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8038a6:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  8038a9:	89 c3                	mov    %eax,%ebx
+  8038ab:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  8038b1:	85 c0                	test   %eax,%eax
+  8038b3:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8038b8:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  8038bb:	83 ec 0c             	sub    $0xc,%esp
+  8038be:	ff 75 14             	push   0x14(%ebp)
+  8038c1:	ff 75 18             	push   0x18(%ebp)
+  8038c4:	53                   	push   %ebx
+  8038c5:	56                   	push   %esi
+  8038c6:	57                   	push   %edi
+  8038c7:	e8 18 d8 ff ff       	call   8010e4 <sys_ipc_try_send>
+  8038cc:	83 c4 20             	add    $0x20,%esp
+  8038cf:	85 c0                	test   %eax,%eax
+  8038d1:	79 1e                	jns    8038f1 <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  8038d3:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8038d6:	75 07                	jne    8038df <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  8038d8:	e8 ee d4 ff ff       	call   800dcb <sys_yield>
+  8038dd:	eb dc                	jmp    8038bb <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  8038df:	50                   	push   %eax
+  8038e0:	68 4f 42 80 00       	push   $0x80424f
+  8038e5:	6a 5c                	push   $0x5c
+  8038e7:	68 5c 42 80 00       	push   $0x80425c
+  8038ec:	e8 44 ca ff ff       	call   800335 <_panic>
+  }
+}
+  8038f1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8038f4:	5b                   	pop    %ebx
+  8038f5:	5e                   	pop    %esi
+  8038f6:	5f                   	pop    %edi
+  8038f7:	5d                   	pop    %ebp
+  8038f8:	c3                   	ret
+
+008038f9 <ipc_send>:
+{
+  8038f9:	55                   	push   %ebp
+  8038fa:	89 e5                	mov    %esp,%ebp
+  8038fc:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  8038ff:	ff 75 14             	push   0x14(%ebp)
+  803902:	6a 01                	push   $0x1
+  803904:	ff 75 10             	push   0x10(%ebp)
+  803907:	ff 75 0c             	push   0xc(%ebp)
+  80390a:	ff 75 08             	push   0x8(%ebp)
+  80390d:	e8 85 ff ff ff       	call   803897 <ipc_send_pages>
+}
+  803912:	83 c4 20             	add    $0x20,%esp
+  803915:	c9                   	leave
+  803916:	c3                   	ret
+
+00803917 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803917:	55                   	push   %ebp
+  803918:	89 e5                	mov    %esp,%ebp
+  80391a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  80391d:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  803922:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803925:	c1 e0 04             	shl    $0x4,%eax
+  803928:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80392d:	8b 40 50             	mov    0x50(%eax),%eax
+  803930:	39 c8                	cmp    %ecx,%eax
+  803932:	74 12                	je     803946 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  803934:	83 c2 01             	add    $0x1,%edx
+  803937:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  80393d:	75 e3                	jne    803922 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  80393f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803944:	eb 0e                	jmp    803954 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  803946:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803949:	c1 e0 04             	shl    $0x4,%eax
+  80394c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803951:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803954:	5d                   	pop    %ebp
+  803955:	c3                   	ret
+
+00803956 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803956:	55                   	push   %ebp
+  803957:	89 e5                	mov    %esp,%ebp
+  803959:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  80395c:	89 c2                	mov    %eax,%edx
+  80395e:	c1 ea 16             	shr    $0x16,%edx
+  803961:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  803968:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  80396d:	f6 c1 01             	test   $0x1,%cl
+  803970:	74 1c                	je     80398e <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  803972:	c1 e8 0c             	shr    $0xc,%eax
+  803975:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  80397c:	a8 01                	test   $0x1,%al
+  80397e:	74 0e                	je     80398e <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  803980:	c1 e8 0c             	shr    $0xc,%eax
+  803983:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  80398a:	ef 
+  80398b:	0f b7 d2             	movzwl %dx,%edx
+}
+  80398e:	89 d0                	mov    %edx,%eax
+  803990:	5d                   	pop    %ebp
+  803991:	c3                   	ret
+
+00803992 <udivmod>:
+  803992:	55                   	push   %ebp
+  803993:	57                   	push   %edi
+  803994:	56                   	push   %esi
+  803995:	53                   	push   %ebx
+  803996:	83 ec 14             	sub    $0x14,%esp
+  803999:	8b 74 24 28          	mov    0x28(%esp),%esi
+  80399d:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  8039a1:	89 fb                	mov    %edi,%ebx
+  8039a3:	09 f3                	or     %esi,%ebx
+  8039a5:	0f 84 88 00 00 00    	je     803a33 <udivmod+0xa1>
+  8039ab:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8039b0:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8039b7:	00 
+  8039b8:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8039bf:	00 
+  8039c0:	89 cd                	mov    %ecx,%ebp
+  8039c2:	89 34 24             	mov    %esi,(%esp)
+  8039c5:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  8039c9:	eb 08                	jmp    8039d3 <udivmod+0x41>
+  8039cb:	83 ed 01             	sub    $0x1,%ebp
+  8039ce:	83 fd ff             	cmp    $0xffffffff,%ebp
+  8039d1:	74 6c                	je     803a3f <udivmod+0xad>
+  8039d3:	89 c3                	mov    %eax,%ebx
+  8039d5:	89 d6                	mov    %edx,%esi
+  8039d7:	89 e9                	mov    %ebp,%ecx
+  8039d9:	0f ad f3             	shrd   %cl,%esi,%ebx
+  8039dc:	d3 ee                	shr    %cl,%esi
+  8039de:	f6 c1 20             	test   $0x20,%cl
+  8039e1:	74 04                	je     8039e7 <udivmod+0x55>
+  8039e3:	89 f3                	mov    %esi,%ebx
+  8039e5:	31 f6                	xor    %esi,%esi
+  8039e7:	8b 3c 24             	mov    (%esp),%edi
+  8039ea:	39 fb                	cmp    %edi,%ebx
+  8039ec:	89 f7                	mov    %esi,%edi
+  8039ee:	8b 1c 24             	mov    (%esp),%ebx
+  8039f1:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8039f5:	19 f7                	sbb    %esi,%edi
+  8039f7:	72 d2                	jb     8039cb <udivmod+0x39>
+  8039f9:	89 f7                	mov    %esi,%edi
+  8039fb:	89 de                	mov    %ebx,%esi
+  8039fd:	89 e9                	mov    %ebp,%ecx
+  8039ff:	0f a5 f7             	shld   %cl,%esi,%edi
+  803a02:	d3 e6                	shl    %cl,%esi
+  803a04:	f6 c1 20             	test   $0x20,%cl
+  803a07:	74 04                	je     803a0d <udivmod+0x7b>
+  803a09:	89 f7                	mov    %esi,%edi
+  803a0b:	31 f6                	xor    %esi,%esi
+  803a0d:	29 f0                	sub    %esi,%eax
+  803a0f:	19 fa                	sbb    %edi,%edx
+  803a11:	be 01 00 00 00       	mov    $0x1,%esi
+  803a16:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a1b:	0f a5 f7             	shld   %cl,%esi,%edi
+  803a1e:	d3 e6                	shl    %cl,%esi
+  803a20:	f6 c1 20             	test   $0x20,%cl
+  803a23:	74 04                	je     803a29 <udivmod+0x97>
+  803a25:	89 f7                	mov    %esi,%edi
+  803a27:	31 f6                	xor    %esi,%esi
+  803a29:	09 74 24 08          	or     %esi,0x8(%esp)
+  803a2d:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  803a31:	eb 98                	jmp    8039cb <udivmod+0x39>
+  803a33:	89 f0                	mov    %esi,%eax
+  803a35:	89 fa                	mov    %edi,%edx
+  803a37:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803a3b:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  803a3f:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  803a43:	89 01                	mov    %eax,(%ecx)
+  803a45:	89 51 04             	mov    %edx,0x4(%ecx)
+  803a48:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803a4c:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803a50:	83 c4 14             	add    $0x14,%esp
+  803a53:	5b                   	pop    %ebx
+  803a54:	5e                   	pop    %esi
+  803a55:	5f                   	pop    %edi
+  803a56:	5d                   	pop    %ebp
+  803a57:	c3                   	ret
+
+00803a58 <__udivdi3>:
+  803a58:	83 ec 18             	sub    $0x18,%esp
+  803a5b:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803a5f:	50                   	push   %eax
+  803a60:	ff 74 24 2c          	push   0x2c(%esp)
+  803a64:	ff 74 24 2c          	push   0x2c(%esp)
+  803a68:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803a6c:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803a70:	e8 1d ff ff ff       	call   803992 <udivmod>
+  803a75:	83 c4 24             	add    $0x24,%esp
+  803a78:	c3                   	ret
+
+00803a79 <__umoddi3>:
+  803a79:	83 ec 18             	sub    $0x18,%esp
+  803a7c:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803a80:	50                   	push   %eax
+  803a81:	ff 74 24 2c          	push   0x2c(%esp)
+  803a85:	ff 74 24 2c          	push   0x2c(%esp)
+  803a89:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803a8d:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803a91:	e8 fc fe ff ff       	call   803992 <udivmod>
+  803a96:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803a9a:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803a9e:	83 c4 24             	add    $0x24,%esp
+  803aa1:	c3                   	ret
+
+00803aa2 <__divdi3>:
+  803aa2:	56                   	push   %esi
+  803aa3:	53                   	push   %ebx
+  803aa4:	83 ec 14             	sub    $0x14,%esp
+  803aa7:	8b 44 24 20          	mov    0x20(%esp),%eax
+  803aab:	8b 54 24 24          	mov    0x24(%esp),%edx
+  803aaf:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  803ab3:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  803ab7:	85 d2                	test   %edx,%edx
+  803ab9:	78 18                	js     803ad3 <__divdi3+0x31>
+  803abb:	85 db                	test   %ebx,%ebx
+  803abd:	78 3e                	js     803afd <__divdi3+0x5b>
+  803abf:	83 ec 04             	sub    $0x4,%esp
+  803ac2:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803ac6:	56                   	push   %esi
+  803ac7:	53                   	push   %ebx
+  803ac8:	51                   	push   %ecx
+  803ac9:	e8 c4 fe ff ff       	call   803992 <udivmod>
+  803ace:	83 c4 10             	add    $0x10,%esp
+  803ad1:	eb 24                	jmp    803af7 <__divdi3+0x55>
+  803ad3:	f7 d8                	neg    %eax
+  803ad5:	83 d2 00             	adc    $0x0,%edx
+  803ad8:	f7 da                	neg    %edx
+  803ada:	85 db                	test   %ebx,%ebx
+  803adc:	78 3a                	js     803b18 <__divdi3+0x76>
+  803ade:	83 ec 04             	sub    $0x4,%esp
+  803ae1:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803ae5:	56                   	push   %esi
+  803ae6:	53                   	push   %ebx
+  803ae7:	51                   	push   %ecx
+  803ae8:	e8 a5 fe ff ff       	call   803992 <udivmod>
+  803aed:	83 c4 10             	add    $0x10,%esp
+  803af0:	f7 d8                	neg    %eax
+  803af2:	83 d2 00             	adc    $0x0,%edx
+  803af5:	f7 da                	neg    %edx
+  803af7:	83 c4 14             	add    $0x14,%esp
+  803afa:	5b                   	pop    %ebx
+  803afb:	5e                   	pop    %esi
+  803afc:	c3                   	ret
+  803afd:	83 ec 04             	sub    $0x4,%esp
+  803b00:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803b04:	56                   	push   %esi
+  803b05:	f7 d9                	neg    %ecx
+  803b07:	83 d3 00             	adc    $0x0,%ebx
+  803b0a:	f7 db                	neg    %ebx
+  803b0c:	53                   	push   %ebx
+  803b0d:	51                   	push   %ecx
+  803b0e:	e8 7f fe ff ff       	call   803992 <udivmod>
+  803b13:	83 c4 10             	add    $0x10,%esp
+  803b16:	eb d8                	jmp    803af0 <__divdi3+0x4e>
+  803b18:	83 ec 04             	sub    $0x4,%esp
+  803b1b:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803b1f:	56                   	push   %esi
+  803b20:	f7 d9                	neg    %ecx
+  803b22:	83 d3 00             	adc    $0x0,%ebx
+  803b25:	f7 db                	neg    %ebx
+  803b27:	53                   	push   %ebx
+  803b28:	51                   	push   %ecx
+  803b29:	e8 64 fe ff ff       	call   803992 <udivmod>
+  803b2e:	83 c4 10             	add    $0x10,%esp
+  803b31:	eb c4                	jmp    803af7 <__divdi3+0x55>
+
+00803b33 <__moddi3>:
+  803b33:	55                   	push   %ebp
+  803b34:	57                   	push   %edi
+  803b35:	56                   	push   %esi
+  803b36:	53                   	push   %ebx
+  803b37:	83 ec 24             	sub    $0x24,%esp
+  803b3a:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803b3e:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803b42:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  803b46:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  803b4a:	85 d2                	test   %edx,%edx
+  803b4c:	78 3b                	js     803b89 <__moddi3+0x56>
+  803b4e:	83 ec 04             	sub    $0x4,%esp
+  803b51:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803b55:	56                   	push   %esi
+  803b56:	89 ce                	mov    %ecx,%esi
+  803b58:	f7 de                	neg    %esi
+  803b5a:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803b5e:	89 de                	mov    %ebx,%esi
+  803b60:	83 d6 00             	adc    $0x0,%esi
+  803b63:	f7 de                	neg    %esi
+  803b65:	89 74 24 14          	mov    %esi,0x14(%esp)
+  803b69:	8b 74 24 08          	mov    0x8(%esp),%esi
+  803b6d:	0f 48 f1             	cmovs  %ecx,%esi
+  803b70:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  803b75:	53                   	push   %ebx
+  803b76:	56                   	push   %esi
+  803b77:	e8 16 fe ff ff       	call   803992 <udivmod>
+  803b7c:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803b80:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803b84:	83 c4 10             	add    $0x10,%esp
+  803b87:	eb 47                	jmp    803bd0 <__moddi3+0x9d>
+  803b89:	f7 d8                	neg    %eax
+  803b8b:	83 d2 00             	adc    $0x0,%edx
+  803b8e:	f7 da                	neg    %edx
+  803b90:	83 ec 04             	sub    $0x4,%esp
+  803b93:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803b97:	56                   	push   %esi
+  803b98:	89 cf                	mov    %ecx,%edi
+  803b9a:	f7 df                	neg    %edi
+  803b9c:	89 de                	mov    %ebx,%esi
+  803b9e:	83 d6 00             	adc    $0x0,%esi
+  803ba1:	f7 de                	neg    %esi
+  803ba3:	0f 49 cf             	cmovns %edi,%ecx
+  803ba6:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  803baa:	0f 49 de             	cmovns %esi,%ebx
+  803bad:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  803bb1:	ff 74 24 0c          	push   0xc(%esp)
+  803bb5:	ff 74 24 0c          	push   0xc(%esp)
+  803bb9:	e8 d4 fd ff ff       	call   803992 <udivmod>
+  803bbe:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803bc2:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803bc6:	f7 d8                	neg    %eax
+  803bc8:	83 d2 00             	adc    $0x0,%edx
+  803bcb:	f7 da                	neg    %edx
+  803bcd:	83 c4 10             	add    $0x10,%esp
+  803bd0:	83 c4 24             	add    $0x24,%esp
+  803bd3:	5b                   	pop    %ebx
+  803bd4:	5e                   	pop    %esi
+  803bd5:	5f                   	pop    %edi
+  803bd6:	5d                   	pop    %ebp
+  803bd7:	c3                   	ret
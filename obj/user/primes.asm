@@ -0,0 +1,7797 @@
+
+obj/user/primes.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 c3 00 00 00       	call   8000f4 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <primeproc>:
+
+#include <inc/lib.h>
+
+unsigned
+primeproc(void)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 1c             	sub    $0x1c,%esp
+  int i, id, p;
+  envid_t envid;
+
+  // fetch a prime from our left neighbor
+top:
+  p = ipc_recv(&envid, 0, 0);
+  80003c:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  80003f:	83 ec 04             	sub    $0x4,%esp
+  800042:	6a 00                	push   $0x0
+  800044:	6a 00                	push   $0x0
+  800046:	56                   	push   %esi
+  800047:	e8 73 15 00 00       	call   8015bf <ipc_recv>
+  80004c:	89 c3                	mov    %eax,%ebx
+  cprintf("CPU %d: %d ", thisenv->env_cpunum, p);
+  80004e:	a1 a0 58 80 00       	mov    0x8058a0,%eax
+  800053:	8b 40 5c             	mov    0x5c(%eax),%eax
+  800056:	83 c4 0c             	add    $0xc,%esp
+  800059:	53                   	push   %ebx
+  80005a:	50                   	push   %eax
+  80005b:	68 c0 39 80 00       	push   $0x8039c0
+  800060:	e8 d7 01 00 00       	call   80023c <cprintf>
+
+  // fork a right neighbor to continue the chain
+  if ((id = fork()) < 0)
+  800065:	e8 5c 12 00 00       	call   8012c6 <fork>
+  80006a:	89 c7                	mov    %eax,%edi
+  80006c:	83 c4 10             	add    $0x10,%esp
+  80006f:	85 c0                	test   %eax,%eax
+  800071:	78 2e                	js     8000a1 <primeproc+0x6e>
+    panic("fork: %e", id);
+  if (id == 0)
+  800073:	74 ca                	je     80003f <primeproc+0xc>
+    goto top;
+
+  // filter out multiples of our prime
+  while (1) {
+    i = ipc_recv(&envid, 0, 0);
+  800075:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  800078:	83 ec 04             	sub    $0x4,%esp
+  80007b:	6a 00                	push   $0x0
+  80007d:	6a 00                	push   $0x0
+  80007f:	56                   	push   %esi
+  800080:	e8 3a 15 00 00       	call   8015bf <ipc_recv>
+  800085:	89 c1                	mov    %eax,%ecx
+    if (i % p)
+  800087:	99                   	cltd
+  800088:	f7 fb                	idiv   %ebx
+  80008a:	83 c4 10             	add    $0x10,%esp
+  80008d:	85 d2                	test   %edx,%edx
+  80008f:	74 e7                	je     800078 <primeproc+0x45>
+      ipc_send(id, i, 0, 0);
+  800091:	6a 00                	push   $0x0
+  800093:	6a 00                	push   $0x0
+  800095:	51                   	push   %ecx
+  800096:	57                   	push   %edi
+  800097:	e8 a6 15 00 00       	call   801642 <ipc_send>
+  80009c:	83 c4 10             	add    $0x10,%esp
+  80009f:	eb d7                	jmp    800078 <primeproc+0x45>
+    panic("fork: %e", id);
+  8000a1:	50                   	push   %eax
+  8000a2:	68 c3 3d 80 00       	push   $0x803dc3
+  8000a7:	6a 1a                	push   $0x1a
+  8000a9:	68 cc 39 80 00       	push   $0x8039cc
+  8000ae:	e8 ae 00 00 00       	call   800161 <_panic>
+
+008000b3 <umain>:
+  return 0;
+}
+
+void
+umain(int argc, char **argv)
+{
+  8000b3:	55                   	push   %ebp
+  8000b4:	89 e5                	mov    %esp,%ebp
+  8000b6:	56                   	push   %esi
+  8000b7:	53                   	push   %ebx
+  int i, id;
+
+  // fork the first prime process in the chain
+  if ((id = fork()) < 0)
+  8000b8:	e8 09 12 00 00       	call   8012c6 <fork>
+  8000bd:	89 c6                	mov    %eax,%esi
+  8000bf:	85 c0                	test   %eax,%eax
+  8000c1:	78 1a                	js     8000dd <umain+0x2a>
+    panic("fork: %e", id);
+  if (id == 0)
+    primeproc();
+
+  // feed all the integers through
+  for (i = 2;; i++)
+  8000c3:	bb 02 00 00 00       	mov    $0x2,%ebx
+  if (id == 0)
+  8000c8:	74 25                	je     8000ef <umain+0x3c>
+    ipc_send(id, i, 0, 0);
+  8000ca:	6a 00                	push   $0x0
+  8000cc:	6a 00                	push   $0x0
+  8000ce:	53                   	push   %ebx
+  8000cf:	56                   	push   %esi
+  8000d0:	e8 6d 15 00 00       	call   801642 <ipc_send>
+  for (i = 2;; i++)
+  8000d5:	83 c3 01             	add    $0x1,%ebx
+  8000d8:	83 c4 10             	add    $0x10,%esp
+  8000db:	eb ed                	jmp    8000ca <umain+0x17>
+    panic("fork: %e", id);
+  8000dd:	50                   	push   %eax
+  8000de:	68 c3 3d 80 00       	push   $0x803dc3
+  8000e3:	6a 2f                	push   $0x2f
+  8000e5:	68 cc 39 80 00       	push   $0x8039cc
+  8000ea:	e8 72 00 00 00       	call   800161 <_panic>
+    primeproc();
+  8000ef:	e8 3f ff ff ff       	call   800033 <primeproc>
+
+008000f4 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000f4:	55                   	push   %ebp
+  8000f5:	89 e5                	mov    %esp,%ebp
+  8000f7:	56                   	push   %esi
+  8000f8:	53                   	push   %ebx
+  8000f9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000fc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  8000ff:	c7 05 a0 58 80 00 00 	movl   $0x0,0x8058a0
+  800106:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  800109:	e8 ca 0a 00 00       	call   800bd8 <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  80010e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800113:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800116:	c1 e0 04             	shl    $0x4,%eax
+  800119:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80011e:	a3 a0 58 80 00       	mov    %eax,0x8058a0
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800123:	85 db                	test   %ebx,%ebx
+  800125:	7e 07                	jle    80012e <libmain+0x3a>
+    binaryname = argv[0];
+  800127:	8b 06                	mov    (%esi),%eax
+  800129:	a3 00 40 80 00       	mov    %eax,0x804000
+
+  // call user main routine
+  umain(argc, argv);
+  80012e:	83 ec 08             	sub    $0x8,%esp
+  800131:	56                   	push   %esi
+  800132:	53                   	push   %ebx
+  800133:	e8 7b ff ff ff       	call   8000b3 <umain>
+
+  // exit gracefully
+  exit();
+  800138:	e8 0a 00 00 00       	call   800147 <exit>
+}
+  80013d:	83 c4 10             	add    $0x10,%esp
+  800140:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800143:	5b                   	pop    %ebx
+  800144:	5e                   	pop    %esi
+  800145:	5d                   	pop    %ebp
+  800146:	c3                   	ret
+
+00800147 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800147:	55                   	push   %ebp
+  800148:	89 e5                	mov    %esp,%ebp
+  80014a:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  80014d:	e8 17 17 00 00       	call   801869 <close_all>
+  sys_env_destroy(0);
+  800152:	83 ec 0c             	sub    $0xc,%esp
+  800155:	6a 00                	push   $0x0
+  800157:	e8 3b 0a 00 00       	call   800b97 <sys_env_destroy>
+}
+  80015c:	83 c4 10             	add    $0x10,%esp
+  80015f:	c9                   	leave
+  800160:	c3                   	ret
+
+00800161 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800161:	55                   	push   %ebp
+  800162:	89 e5                	mov    %esp,%ebp
+  800164:	56                   	push   %esi
+  800165:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  800166:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  800169:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  80016f:	e8 64 0a 00 00       	call   800bd8 <sys_getenvid>
+  800174:	83 ec 0c             	sub    $0xc,%esp
+  800177:	ff 75 0c             	push   0xc(%ebp)
+  80017a:	ff 75 08             	push   0x8(%ebp)
+  80017d:	56                   	push   %esi
+  80017e:	50                   	push   %eax
+  80017f:	68 e4 39 80 00       	push   $0x8039e4
+  800184:	e8 b3 00 00 00       	call   80023c <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  800189:	83 c4 18             	add    $0x18,%esp
+  80018c:	53                   	push   %ebx
+  80018d:	ff 75 10             	push   0x10(%ebp)
+  800190:	e8 56 00 00 00       	call   8001eb <vcprintf>
+  cprintf("\n");
+  800195:	c7 04 24 44 3f 80 00 	movl   $0x803f44,(%esp)
+  80019c:	e8 9b 00 00 00       	call   80023c <cprintf>
+  8001a1:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  8001a4:	cc                   	int3
+  while (1)
+  8001a5:	eb fd                	jmp    8001a4 <_panic+0x43>
+
+008001a7 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8001a7:	55                   	push   %ebp
+  8001a8:	89 e5                	mov    %esp,%ebp
+  8001aa:	53                   	push   %ebx
+  8001ab:	83 ec 04             	sub    $0x4,%esp
+  8001ae:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  8001b1:	8b 13                	mov    (%ebx),%edx
+  8001b3:	8d 42 01             	lea    0x1(%edx),%eax
+  8001b6:	89 03                	mov    %eax,(%ebx)
+  8001b8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001bb:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  8001bf:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001c4:	74 09                	je     8001cf <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  8001c6:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8001ca:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001cd:	c9                   	leave
+  8001ce:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  8001cf:	83 ec 08             	sub    $0x8,%esp
+  8001d2:	68 ff 00 00 00       	push   $0xff
+  8001d7:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001da:	50                   	push   %eax
+  8001db:	e8 7a 09 00 00       	call   800b5a <sys_cputs>
+    b->idx = 0;
+  8001e0:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001e6:	83 c4 10             	add    $0x10,%esp
+  8001e9:	eb db                	jmp    8001c6 <putch+0x1f>
+
+008001eb <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001eb:	55                   	push   %ebp
+  8001ec:	89 e5                	mov    %esp,%ebp
+  8001ee:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  8001f4:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001fb:	00 00 00 
+  b.cnt = 0;
+  8001fe:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800205:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  800208:	ff 75 0c             	push   0xc(%ebp)
+  80020b:	ff 75 08             	push   0x8(%ebp)
+  80020e:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800214:	50                   	push   %eax
+  800215:	68 a7 01 80 00       	push   $0x8001a7
+  80021a:	e8 14 01 00 00       	call   800333 <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  80021f:	83 c4 08             	add    $0x8,%esp
+  800222:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800228:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80022e:	50                   	push   %eax
+  80022f:	e8 26 09 00 00       	call   800b5a <sys_cputs>
+
+  return b.cnt;
+}
+  800234:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80023a:	c9                   	leave
+  80023b:	c3                   	ret
+
+0080023c <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80023c:	55                   	push   %ebp
+  80023d:	89 e5                	mov    %esp,%ebp
+  80023f:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  800242:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  800245:	50                   	push   %eax
+  800246:	ff 75 08             	push   0x8(%ebp)
+  800249:	e8 9d ff ff ff       	call   8001eb <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  80024e:	c9                   	leave
+  80024f:	c3                   	ret
+
+00800250 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  800250:	55                   	push   %ebp
+  800251:	89 e5                	mov    %esp,%ebp
+  800253:	57                   	push   %edi
+  800254:	56                   	push   %esi
+  800255:	53                   	push   %ebx
+  800256:	83 ec 1c             	sub    $0x1c,%esp
+  800259:	89 c7                	mov    %eax,%edi
+  80025b:	89 d6                	mov    %edx,%esi
+  80025d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800260:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800263:	89 d1                	mov    %edx,%ecx
+  800265:	89 c2                	mov    %eax,%edx
+  800267:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80026a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80026d:	8b 45 10             	mov    0x10(%ebp),%eax
+  800270:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  800273:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800276:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80027d:	39 c2                	cmp    %eax,%edx
+  80027f:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800282:	72 3e                	jb     8002c2 <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  800284:	83 ec 0c             	sub    $0xc,%esp
+  800287:	ff 75 18             	push   0x18(%ebp)
+  80028a:	83 eb 01             	sub    $0x1,%ebx
+  80028d:	53                   	push   %ebx
+  80028e:	50                   	push   %eax
+  80028f:	83 ec 08             	sub    $0x8,%esp
+  800292:	ff 75 e4             	push   -0x1c(%ebp)
+  800295:	ff 75 e0             	push   -0x20(%ebp)
+  800298:	ff 75 dc             	push   -0x24(%ebp)
+  80029b:	ff 75 d8             	push   -0x28(%ebp)
+  80029e:	e8 90 35 00 00       	call   803833 <__udivdi3>
+  8002a3:	83 c4 18             	add    $0x18,%esp
+  8002a6:	52                   	push   %edx
+  8002a7:	50                   	push   %eax
+  8002a8:	89 f2                	mov    %esi,%edx
+  8002aa:	89 f8                	mov    %edi,%eax
+  8002ac:	e8 9f ff ff ff       	call   800250 <printnum>
+  8002b1:	83 c4 20             	add    $0x20,%esp
+  8002b4:	eb 13                	jmp    8002c9 <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  8002b6:	83 ec 08             	sub    $0x8,%esp
+  8002b9:	56                   	push   %esi
+  8002ba:	ff 75 18             	push   0x18(%ebp)
+  8002bd:	ff d7                	call   *%edi
+  8002bf:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  8002c2:	83 eb 01             	sub    $0x1,%ebx
+  8002c5:	85 db                	test   %ebx,%ebx
+  8002c7:	7f ed                	jg     8002b6 <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  8002c9:	83 ec 08             	sub    $0x8,%esp
+  8002cc:	56                   	push   %esi
+  8002cd:	83 ec 04             	sub    $0x4,%esp
+  8002d0:	ff 75 e4             	push   -0x1c(%ebp)
+  8002d3:	ff 75 e0             	push   -0x20(%ebp)
+  8002d6:	ff 75 dc             	push   -0x24(%ebp)
+  8002d9:	ff 75 d8             	push   -0x28(%ebp)
+  8002dc:	e8 73 35 00 00       	call   803854 <__umoddi3>
+  8002e1:	83 c4 14             	add    $0x14,%esp
+  8002e4:	0f be 80 07 3a 80 00 	movsbl 0x803a07(%eax),%eax
+  8002eb:	50                   	push   %eax
+  8002ec:	ff d7                	call   *%edi
+}
+  8002ee:	83 c4 10             	add    $0x10,%esp
+  8002f1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002f4:	5b                   	pop    %ebx
+  8002f5:	5e                   	pop    %esi
+  8002f6:	5f                   	pop    %edi
+  8002f7:	5d                   	pop    %ebp
+  8002f8:	c3                   	ret
+
+008002f9 <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002f9:	55                   	push   %ebp
+  8002fa:	89 e5                	mov    %esp,%ebp
+  8002fc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  8002ff:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  800303:	8b 10                	mov    (%eax),%edx
+  800305:	3b 50 04             	cmp    0x4(%eax),%edx
+  800308:	73 0a                	jae    800314 <sprintputch+0x1b>
+    *b->buf++ = ch;
+  80030a:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80030d:	89 08                	mov    %ecx,(%eax)
+  80030f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800312:	88 02                	mov    %al,(%edx)
+}
+  800314:	5d                   	pop    %ebp
+  800315:	c3                   	ret
+
+00800316 <printfmt>:
+{
+  800316:	55                   	push   %ebp
+  800317:	89 e5                	mov    %esp,%ebp
+  800319:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  80031c:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  80031f:	50                   	push   %eax
+  800320:	ff 75 10             	push   0x10(%ebp)
+  800323:	ff 75 0c             	push   0xc(%ebp)
+  800326:	ff 75 08             	push   0x8(%ebp)
+  800329:	e8 05 00 00 00       	call   800333 <vprintfmt>
+}
+  80032e:	83 c4 10             	add    $0x10,%esp
+  800331:	c9                   	leave
+  800332:	c3                   	ret
+
+00800333 <vprintfmt>:
+{
+  800333:	55                   	push   %ebp
+  800334:	89 e5                	mov    %esp,%ebp
+  800336:	57                   	push   %edi
+  800337:	56                   	push   %esi
+  800338:	53                   	push   %ebx
+  800339:	83 ec 2c             	sub    $0x2c,%esp
+  80033c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80033f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800342:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800345:	eb 0a                	jmp    800351 <vprintfmt+0x1e>
+      putch(ch, putdat);
+  800347:	83 ec 08             	sub    $0x8,%esp
+  80034a:	53                   	push   %ebx
+  80034b:	50                   	push   %eax
+  80034c:	ff d6                	call   *%esi
+  80034e:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  800351:	83 c7 01             	add    $0x1,%edi
+  800354:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800358:	83 f8 25             	cmp    $0x25,%eax
+  80035b:	74 0c                	je     800369 <vprintfmt+0x36>
+      if (ch == '\0')
+  80035d:	85 c0                	test   %eax,%eax
+  80035f:	75 e6                	jne    800347 <vprintfmt+0x14>
+}
+  800361:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800364:	5b                   	pop    %ebx
+  800365:	5e                   	pop    %esi
+  800366:	5f                   	pop    %edi
+  800367:	5d                   	pop    %ebp
+  800368:	c3                   	ret
+    padc = ' ';
+  800369:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  80036d:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  800374:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  80037b:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  800382:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  800387:	8d 47 01             	lea    0x1(%edi),%eax
+  80038a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80038d:	0f b6 17             	movzbl (%edi),%edx
+  800390:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800393:	3c 55                	cmp    $0x55,%al
+  800395:	0f 87 cf 03 00 00    	ja     80076a <vprintfmt+0x437>
+  80039b:	0f b6 c0             	movzbl %al,%eax
+  80039e:	ff 24 85 60 3b 80 00 	jmp    *0x803b60(,%eax,4)
+  8003a5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  8003a8:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8003ac:	eb d9                	jmp    800387 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  8003ae:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8003b1:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8003b5:	eb d0                	jmp    800387 <vprintfmt+0x54>
+  8003b7:	0f b6 d2             	movzbl %dl,%edx
+  8003ba:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  8003bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003c2:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  8003c5:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8003c8:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  8003cc:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  8003cf:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8003d2:	83 f9 09             	cmp    $0x9,%ecx
+  8003d5:	77 55                	ja     80042c <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  8003d7:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  8003da:	eb e9                	jmp    8003c5 <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  8003dc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003df:	8b 00                	mov    (%eax),%eax
+  8003e1:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003e4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003e7:	8d 40 04             	lea    0x4(%eax),%eax
+  8003ea:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  8003ed:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  8003f0:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003f4:	79 91                	jns    800387 <vprintfmt+0x54>
+        width = precision, precision = -1;
+  8003f6:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003f9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003fc:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800403:	eb 82                	jmp    800387 <vprintfmt+0x54>
+      if (width < 0)
+  800405:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800408:	85 d2                	test   %edx,%edx
+  80040a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80040f:	0f 49 c2             	cmovns %edx,%eax
+  800412:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  800415:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  800418:	e9 6a ff ff ff       	jmp    800387 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  80041d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  800420:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  800427:	e9 5b ff ff ff       	jmp    800387 <vprintfmt+0x54>
+  80042c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80042f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800432:	eb bc                	jmp    8003f0 <vprintfmt+0xbd>
+      lflag++;
+  800434:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  800437:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  80043a:	e9 48 ff ff ff       	jmp    800387 <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  80043f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800442:	8d 78 04             	lea    0x4(%eax),%edi
+  800445:	83 ec 08             	sub    $0x8,%esp
+  800448:	53                   	push   %ebx
+  800449:	ff 30                	push   (%eax)
+  80044b:	ff d6                	call   *%esi
+      break;
+  80044d:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  800450:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  800453:	e9 b1 02 00 00       	jmp    800709 <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  800458:	8b 45 14             	mov    0x14(%ebp),%eax
+  80045b:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  80045e:	8b 10                	mov    (%eax),%edx
+  800460:	89 d0                	mov    %edx,%eax
+  800462:	f7 d8                	neg    %eax
+  800464:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800467:	83 f8 10             	cmp    $0x10,%eax
+  80046a:	7f 23                	jg     80048f <vprintfmt+0x15c>
+  80046c:	8b 14 85 c0 3c 80 00 	mov    0x803cc0(,%eax,4),%edx
+  800473:	85 d2                	test   %edx,%edx
+  800475:	74 18                	je     80048f <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  800477:	52                   	push   %edx
+  800478:	68 ee 3e 80 00       	push   $0x803eee
+  80047d:	53                   	push   %ebx
+  80047e:	56                   	push   %esi
+  80047f:	e8 92 fe ff ff       	call   800316 <printfmt>
+  800484:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  800487:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80048a:	e9 7a 02 00 00       	jmp    800709 <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  80048f:	50                   	push   %eax
+  800490:	68 1f 3a 80 00       	push   $0x803a1f
+  800495:	53                   	push   %ebx
+  800496:	56                   	push   %esi
+  800497:	e8 7a fe ff ff       	call   800316 <printfmt>
+  80049c:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  80049f:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  8004a2:	e9 62 02 00 00       	jmp    800709 <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  8004a7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004aa:	83 c0 04             	add    $0x4,%eax
+  8004ad:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8004b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004b3:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  8004b5:	85 c9                	test   %ecx,%ecx
+  8004b7:	b8 18 3a 80 00       	mov    $0x803a18,%eax
+  8004bc:	0f 45 c1             	cmovne %ecx,%eax
+  8004bf:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  8004c2:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004c6:	7e 06                	jle    8004ce <vprintfmt+0x19b>
+  8004c8:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8004cc:	75 0b                	jne    8004d9 <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8004ce:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8004d1:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8004d4:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004d7:	eb 5c                	jmp    800535 <vprintfmt+0x202>
+  8004d9:	83 ec 08             	sub    $0x8,%esp
+  8004dc:	ff 75 d0             	push   -0x30(%ebp)
+  8004df:	ff 75 cc             	push   -0x34(%ebp)
+  8004e2:	e8 20 03 00 00       	call   800807 <strnlen>
+  8004e7:	89 c2                	mov    %eax,%edx
+  8004e9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004ec:	29 d0                	sub    %edx,%eax
+  8004ee:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  8004f1:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8004f5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004f8:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004fb:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8004fd:	eb 0e                	jmp    80050d <vprintfmt+0x1da>
+          putch(padc, putdat);
+  8004ff:	83 ec 08             	sub    $0x8,%esp
+  800502:	53                   	push   %ebx
+  800503:	57                   	push   %edi
+  800504:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800507:	83 ee 01             	sub    $0x1,%esi
+  80050a:	83 c4 10             	add    $0x10,%esp
+  80050d:	85 f6                	test   %esi,%esi
+  80050f:	7f ee                	jg     8004ff <vprintfmt+0x1cc>
+  800511:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800514:	8b 75 08             	mov    0x8(%ebp),%esi
+  800517:	85 c0                	test   %eax,%eax
+  800519:	ba 00 00 00 00       	mov    $0x0,%edx
+  80051e:	0f 49 d0             	cmovns %eax,%edx
+  800521:	29 d0                	sub    %edx,%eax
+  800523:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800526:	eb a6                	jmp    8004ce <vprintfmt+0x19b>
+          putch(ch, putdat);
+  800528:	83 ec 08             	sub    $0x8,%esp
+  80052b:	53                   	push   %ebx
+  80052c:	52                   	push   %edx
+  80052d:	ff 55 08             	call   *0x8(%ebp)
+  800530:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800533:	89 f1                	mov    %esi,%ecx
+  800535:	8d 71 01             	lea    0x1(%ecx),%esi
+  800538:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80053c:	0f be d0             	movsbl %al,%edx
+  80053f:	85 d2                	test   %edx,%edx
+  800541:	74 28                	je     80056b <vprintfmt+0x238>
+  800543:	85 ff                	test   %edi,%edi
+  800545:	78 05                	js     80054c <vprintfmt+0x219>
+  800547:	83 ef 01             	sub    $0x1,%edi
+  80054a:	78 30                	js     80057c <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  80054c:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800550:	74 d6                	je     800528 <vprintfmt+0x1f5>
+  800552:	0f be c0             	movsbl %al,%eax
+  800555:	83 e8 20             	sub    $0x20,%eax
+  800558:	83 f8 5e             	cmp    $0x5e,%eax
+  80055b:	76 cb                	jbe    800528 <vprintfmt+0x1f5>
+          putch('?', putdat);
+  80055d:	83 ec 08             	sub    $0x8,%esp
+  800560:	53                   	push   %ebx
+  800561:	6a 3f                	push   $0x3f
+  800563:	ff 55 08             	call   *0x8(%ebp)
+  800566:	83 c4 10             	add    $0x10,%esp
+  800569:	eb c8                	jmp    800533 <vprintfmt+0x200>
+  80056b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80056e:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800571:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800574:	01 d0                	add    %edx,%eax
+  800576:	29 c8                	sub    %ecx,%eax
+  800578:	89 c7                	mov    %eax,%edi
+  80057a:	eb 13                	jmp    80058f <vprintfmt+0x25c>
+  80057c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80057f:	eb ed                	jmp    80056e <vprintfmt+0x23b>
+        putch(' ', putdat);
+  800581:	83 ec 08             	sub    $0x8,%esp
+  800584:	53                   	push   %ebx
+  800585:	6a 20                	push   $0x20
+  800587:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  800589:	83 ef 01             	sub    $0x1,%edi
+  80058c:	83 c4 10             	add    $0x10,%esp
+  80058f:	85 ff                	test   %edi,%edi
+  800591:	7f ee                	jg     800581 <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  800593:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800596:	89 45 14             	mov    %eax,0x14(%ebp)
+  800599:	e9 6b 01 00 00       	jmp    800709 <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  80059e:	83 f9 01             	cmp    $0x1,%ecx
+  8005a1:	7f 1f                	jg     8005c2 <vprintfmt+0x28f>
+  else if (lflag)
+  8005a3:	85 c9                	test   %ecx,%ecx
+  8005a5:	74 67                	je     80060e <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  8005a7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005aa:	8b 00                	mov    (%eax),%eax
+  8005ac:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005af:	89 c1                	mov    %eax,%ecx
+  8005b1:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005b4:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005b7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ba:	8d 40 04             	lea    0x4(%eax),%eax
+  8005bd:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005c0:	eb 17                	jmp    8005d9 <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  8005c2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c5:	8b 50 04             	mov    0x4(%eax),%edx
+  8005c8:	8b 00                	mov    (%eax),%eax
+  8005ca:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005cd:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005d0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d3:	8d 40 08             	lea    0x8(%eax),%eax
+  8005d6:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  8005d9:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005dc:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  8005df:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  8005e4:	85 c9                	test   %ecx,%ecx
+  8005e6:	0f 89 03 01 00 00    	jns    8006ef <vprintfmt+0x3bc>
+        putch('-', putdat);
+  8005ec:	83 ec 08             	sub    $0x8,%esp
+  8005ef:	53                   	push   %ebx
+  8005f0:	6a 2d                	push   $0x2d
+  8005f2:	ff d6                	call   *%esi
+        num = -(long long)num;
+  8005f4:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005f7:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005fa:	f7 da                	neg    %edx
+  8005fc:	83 d1 00             	adc    $0x0,%ecx
+  8005ff:	f7 d9                	neg    %ecx
+  800601:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  800604:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800609:	e9 e1 00 00 00       	jmp    8006ef <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  80060e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800611:	8b 00                	mov    (%eax),%eax
+  800613:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800616:	89 c1                	mov    %eax,%ecx
+  800618:	c1 f9 1f             	sar    $0x1f,%ecx
+  80061b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80061e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800621:	8d 40 04             	lea    0x4(%eax),%eax
+  800624:	89 45 14             	mov    %eax,0x14(%ebp)
+  800627:	eb b0                	jmp    8005d9 <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  800629:	83 f9 01             	cmp    $0x1,%ecx
+  80062c:	7f 1e                	jg     80064c <vprintfmt+0x319>
+  else if (lflag)
+  80062e:	85 c9                	test   %ecx,%ecx
+  800630:	74 32                	je     800664 <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  800632:	8b 45 14             	mov    0x14(%ebp),%eax
+  800635:	8b 10                	mov    (%eax),%edx
+  800637:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80063c:	8d 40 04             	lea    0x4(%eax),%eax
+  80063f:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800642:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  800647:	e9 a3 00 00 00       	jmp    8006ef <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  80064c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80064f:	8b 10                	mov    (%eax),%edx
+  800651:	8b 48 04             	mov    0x4(%eax),%ecx
+  800654:	8d 40 08             	lea    0x8(%eax),%eax
+  800657:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  80065a:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  80065f:	e9 8b 00 00 00       	jmp    8006ef <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800664:	8b 45 14             	mov    0x14(%ebp),%eax
+  800667:	8b 10                	mov    (%eax),%edx
+  800669:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80066e:	8d 40 04             	lea    0x4(%eax),%eax
+  800671:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800674:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  800679:	eb 74                	jmp    8006ef <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  80067b:	83 f9 01             	cmp    $0x1,%ecx
+  80067e:	7f 1b                	jg     80069b <vprintfmt+0x368>
+  else if (lflag)
+  800680:	85 c9                	test   %ecx,%ecx
+  800682:	74 2c                	je     8006b0 <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  800684:	8b 45 14             	mov    0x14(%ebp),%eax
+  800687:	8b 10                	mov    (%eax),%edx
+  800689:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80068e:	8d 40 04             	lea    0x4(%eax),%eax
+  800691:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800694:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  800699:	eb 54                	jmp    8006ef <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  80069b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069e:	8b 10                	mov    (%eax),%edx
+  8006a0:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006a3:	8d 40 08             	lea    0x8(%eax),%eax
+  8006a6:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8006a9:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  8006ae:	eb 3f                	jmp    8006ef <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8006b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b3:	8b 10                	mov    (%eax),%edx
+  8006b5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006ba:	8d 40 04             	lea    0x4(%eax),%eax
+  8006bd:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8006c0:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  8006c5:	eb 28                	jmp    8006ef <vprintfmt+0x3bc>
+      putch('0', putdat);
+  8006c7:	83 ec 08             	sub    $0x8,%esp
+  8006ca:	53                   	push   %ebx
+  8006cb:	6a 30                	push   $0x30
+  8006cd:	ff d6                	call   *%esi
+      putch('x', putdat);
+  8006cf:	83 c4 08             	add    $0x8,%esp
+  8006d2:	53                   	push   %ebx
+  8006d3:	6a 78                	push   $0x78
+  8006d5:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  8006d7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006da:	8b 10                	mov    (%eax),%edx
+  8006dc:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  8006e1:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  8006e4:	8d 40 04             	lea    0x4(%eax),%eax
+  8006e7:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8006ea:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  8006ef:	83 ec 0c             	sub    $0xc,%esp
+  8006f2:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8006f6:	50                   	push   %eax
+  8006f7:	ff 75 e0             	push   -0x20(%ebp)
+  8006fa:	57                   	push   %edi
+  8006fb:	51                   	push   %ecx
+  8006fc:	52                   	push   %edx
+  8006fd:	89 da                	mov    %ebx,%edx
+  8006ff:	89 f0                	mov    %esi,%eax
+  800701:	e8 4a fb ff ff       	call   800250 <printnum>
+      break;
+  800706:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  800709:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  80070c:	e9 40 fc ff ff       	jmp    800351 <vprintfmt+0x1e>
+  if (lflag >= 2)
+  800711:	83 f9 01             	cmp    $0x1,%ecx
+  800714:	7f 1b                	jg     800731 <vprintfmt+0x3fe>
+  else if (lflag)
+  800716:	85 c9                	test   %ecx,%ecx
+  800718:	74 2c                	je     800746 <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  80071a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071d:	8b 10                	mov    (%eax),%edx
+  80071f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800724:	8d 40 04             	lea    0x4(%eax),%eax
+  800727:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  80072a:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  80072f:	eb be                	jmp    8006ef <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800731:	8b 45 14             	mov    0x14(%ebp),%eax
+  800734:	8b 10                	mov    (%eax),%edx
+  800736:	8b 48 04             	mov    0x4(%eax),%ecx
+  800739:	8d 40 08             	lea    0x8(%eax),%eax
+  80073c:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  80073f:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  800744:	eb a9                	jmp    8006ef <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800746:	8b 45 14             	mov    0x14(%ebp),%eax
+  800749:	8b 10                	mov    (%eax),%edx
+  80074b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800750:	8d 40 04             	lea    0x4(%eax),%eax
+  800753:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800756:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  80075b:	eb 92                	jmp    8006ef <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  80075d:	83 ec 08             	sub    $0x8,%esp
+  800760:	53                   	push   %ebx
+  800761:	6a 25                	push   $0x25
+  800763:	ff d6                	call   *%esi
+      break;
+  800765:	83 c4 10             	add    $0x10,%esp
+  800768:	eb 9f                	jmp    800709 <vprintfmt+0x3d6>
+      putch('%', putdat);
+  80076a:	83 ec 08             	sub    $0x8,%esp
+  80076d:	53                   	push   %ebx
+  80076e:	6a 25                	push   $0x25
+  800770:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  800772:	83 c4 10             	add    $0x10,%esp
+  800775:	89 f8                	mov    %edi,%eax
+  800777:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80077b:	74 05                	je     800782 <vprintfmt+0x44f>
+  80077d:	83 e8 01             	sub    $0x1,%eax
+  800780:	eb f5                	jmp    800777 <vprintfmt+0x444>
+  800782:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800785:	eb 82                	jmp    800709 <vprintfmt+0x3d6>
+
+00800787 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800787:	55                   	push   %ebp
+  800788:	89 e5                	mov    %esp,%ebp
+  80078a:	83 ec 18             	sub    $0x18,%esp
+  80078d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800790:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  800793:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800796:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80079a:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80079d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  8007a4:	85 c0                	test   %eax,%eax
+  8007a6:	74 26                	je     8007ce <vsnprintf+0x47>
+  8007a8:	85 d2                	test   %edx,%edx
+  8007aa:	7e 22                	jle    8007ce <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8007ac:	ff 75 14             	push   0x14(%ebp)
+  8007af:	ff 75 10             	push   0x10(%ebp)
+  8007b2:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8007b5:	50                   	push   %eax
+  8007b6:	68 f9 02 80 00       	push   $0x8002f9
+  8007bb:	e8 73 fb ff ff       	call   800333 <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  8007c0:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8007c3:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  8007c6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8007c9:	83 c4 10             	add    $0x10,%esp
+}
+  8007cc:	c9                   	leave
+  8007cd:	c3                   	ret
+    return -E_INVAL;
+  8007ce:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007d3:	eb f7                	jmp    8007cc <vsnprintf+0x45>
+
+008007d5 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8007d5:	55                   	push   %ebp
+  8007d6:	89 e5                	mov    %esp,%ebp
+  8007d8:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  8007db:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  8007de:	50                   	push   %eax
+  8007df:	ff 75 10             	push   0x10(%ebp)
+  8007e2:	ff 75 0c             	push   0xc(%ebp)
+  8007e5:	ff 75 08             	push   0x8(%ebp)
+  8007e8:	e8 9a ff ff ff       	call   800787 <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  8007ed:	c9                   	leave
+  8007ee:	c3                   	ret
+
+008007ef <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8007ef:	55                   	push   %ebp
+  8007f0:	89 e5                	mov    %esp,%ebp
+  8007f2:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  8007f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fa:	eb 03                	jmp    8007ff <strlen+0x10>
+    n++;
+  8007fc:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  8007ff:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800803:	75 f7                	jne    8007fc <strlen+0xd>
+  return n;
+}
+  800805:	5d                   	pop    %ebp
+  800806:	c3                   	ret
+
+00800807 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800807:	55                   	push   %ebp
+  800808:	89 e5                	mov    %esp,%ebp
+  80080a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80080d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800810:	b8 00 00 00 00       	mov    $0x0,%eax
+  800815:	eb 03                	jmp    80081a <strnlen+0x13>
+    n++;
+  800817:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80081a:	39 d0                	cmp    %edx,%eax
+  80081c:	74 08                	je     800826 <strnlen+0x1f>
+  80081e:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800822:	75 f3                	jne    800817 <strnlen+0x10>
+  800824:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  800826:	89 d0                	mov    %edx,%eax
+  800828:	5d                   	pop    %ebp
+  800829:	c3                   	ret
+
+0080082a <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80082a:	55                   	push   %ebp
+  80082b:	89 e5                	mov    %esp,%ebp
+  80082d:	53                   	push   %ebx
+  80082e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800831:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  800834:	b8 00 00 00 00       	mov    $0x0,%eax
+  800839:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80083d:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800840:	83 c0 01             	add    $0x1,%eax
+  800843:	84 d2                	test   %dl,%dl
+  800845:	75 f2                	jne    800839 <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  800847:	89 c8                	mov    %ecx,%eax
+  800849:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80084c:	c9                   	leave
+  80084d:	c3                   	ret
+
+0080084e <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80084e:	55                   	push   %ebp
+  80084f:	89 e5                	mov    %esp,%ebp
+  800851:	53                   	push   %ebx
+  800852:	83 ec 10             	sub    $0x10,%esp
+  800855:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  800858:	53                   	push   %ebx
+  800859:	e8 91 ff ff ff       	call   8007ef <strlen>
+  80085e:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  800861:	ff 75 0c             	push   0xc(%ebp)
+  800864:	01 d8                	add    %ebx,%eax
+  800866:	50                   	push   %eax
+  800867:	e8 be ff ff ff       	call   80082a <strcpy>
+  return dst;
+}
+  80086c:	89 d8                	mov    %ebx,%eax
+  80086e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800871:	c9                   	leave
+  800872:	c3                   	ret
+
+00800873 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  800873:	55                   	push   %ebp
+  800874:	89 e5                	mov    %esp,%ebp
+  800876:	56                   	push   %esi
+  800877:	53                   	push   %ebx
+  800878:	8b 75 08             	mov    0x8(%ebp),%esi
+  80087b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  80087e:	89 f3                	mov    %esi,%ebx
+  800880:	03 5d 10             	add    0x10(%ebp),%ebx
+  800883:	89 f0                	mov    %esi,%eax
+  800885:	eb 0f                	jmp    800896 <strncpy+0x23>
+    *dst++ = *src;
+  800887:	83 c0 01             	add    $0x1,%eax
+  80088a:	0f b6 0a             	movzbl (%edx),%ecx
+  80088d:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  800890:	80 f9 01             	cmp    $0x1,%cl
+  800893:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  800896:	39 d8                	cmp    %ebx,%eax
+  800898:	75 ed                	jne    800887 <strncpy+0x14>
+  }
+  return ret;
+}
+  80089a:	89 f0                	mov    %esi,%eax
+  80089c:	5b                   	pop    %ebx
+  80089d:	5e                   	pop    %esi
+  80089e:	5d                   	pop    %ebp
+  80089f:	c3                   	ret
+
+008008a0 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8008a0:	55                   	push   %ebp
+  8008a1:	89 e5                	mov    %esp,%ebp
+  8008a3:	56                   	push   %esi
+  8008a4:	53                   	push   %ebx
+  8008a5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008a8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008ab:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  8008ae:	89 f0                	mov    %esi,%eax
+  8008b0:	85 d2                	test   %edx,%edx
+  8008b2:	74 21                	je     8008d5 <strlcpy+0x35>
+  8008b4:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8008b8:	89 f2                	mov    %esi,%edx
+  8008ba:	eb 09                	jmp    8008c5 <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  8008bc:	83 c1 01             	add    $0x1,%ecx
+  8008bf:	83 c2 01             	add    $0x1,%edx
+  8008c2:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  8008c5:	39 c2                	cmp    %eax,%edx
+  8008c7:	74 09                	je     8008d2 <strlcpy+0x32>
+  8008c9:	0f b6 19             	movzbl (%ecx),%ebx
+  8008cc:	84 db                	test   %bl,%bl
+  8008ce:	75 ec                	jne    8008bc <strlcpy+0x1c>
+  8008d0:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  8008d2:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  8008d5:	29 f0                	sub    %esi,%eax
+}
+  8008d7:	5b                   	pop    %ebx
+  8008d8:	5e                   	pop    %esi
+  8008d9:	5d                   	pop    %ebp
+  8008da:	c3                   	ret
+
+008008db <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8008db:	55                   	push   %ebp
+  8008dc:	89 e5                	mov    %esp,%ebp
+  8008de:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008e1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  8008e4:	eb 06                	jmp    8008ec <strcmp+0x11>
+    p++, q++;
+  8008e6:	83 c1 01             	add    $0x1,%ecx
+  8008e9:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  8008ec:	0f b6 01             	movzbl (%ecx),%eax
+  8008ef:	84 c0                	test   %al,%al
+  8008f1:	74 04                	je     8008f7 <strcmp+0x1c>
+  8008f3:	3a 02                	cmp    (%edx),%al
+  8008f5:	74 ef                	je     8008e6 <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  8008f7:	0f b6 c0             	movzbl %al,%eax
+  8008fa:	0f b6 12             	movzbl (%edx),%edx
+  8008fd:	29 d0                	sub    %edx,%eax
+}
+  8008ff:	5d                   	pop    %ebp
+  800900:	c3                   	ret
+
+00800901 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800901:	55                   	push   %ebp
+  800902:	89 e5                	mov    %esp,%ebp
+  800904:	53                   	push   %ebx
+  800905:	8b 45 08             	mov    0x8(%ebp),%eax
+  800908:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80090b:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  80090e:	eb 09                	jmp    800919 <strncmp+0x18>
+    n--, p++, q++;
+  800910:	83 ea 01             	sub    $0x1,%edx
+  800913:	83 c0 01             	add    $0x1,%eax
+  800916:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  800919:	85 d2                	test   %edx,%edx
+  80091b:	74 18                	je     800935 <strncmp+0x34>
+  80091d:	0f b6 18             	movzbl (%eax),%ebx
+  800920:	84 db                	test   %bl,%bl
+  800922:	74 04                	je     800928 <strncmp+0x27>
+  800924:	3a 19                	cmp    (%ecx),%bl
+  800926:	74 e8                	je     800910 <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800928:	0f b6 00             	movzbl (%eax),%eax
+  80092b:	0f b6 11             	movzbl (%ecx),%edx
+  80092e:	29 d0                	sub    %edx,%eax
+}
+  800930:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800933:	c9                   	leave
+  800934:	c3                   	ret
+    return 0;
+  800935:	b8 00 00 00 00       	mov    $0x0,%eax
+  80093a:	eb f4                	jmp    800930 <strncmp+0x2f>
+
+0080093c <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80093c:	55                   	push   %ebp
+  80093d:	89 e5                	mov    %esp,%ebp
+  80093f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800942:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800946:	eb 03                	jmp    80094b <strchr+0xf>
+  800948:	83 c0 01             	add    $0x1,%eax
+  80094b:	0f b6 10             	movzbl (%eax),%edx
+  80094e:	84 d2                	test   %dl,%dl
+  800950:	74 06                	je     800958 <strchr+0x1c>
+    if (*s == c)
+  800952:	38 ca                	cmp    %cl,%dl
+  800954:	75 f2                	jne    800948 <strchr+0xc>
+  800956:	eb 05                	jmp    80095d <strchr+0x21>
+      return (char*)s;
+  return 0;
+  800958:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80095d:	5d                   	pop    %ebp
+  80095e:	c3                   	ret
+
+0080095f <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  80095f:	55                   	push   %ebp
+  800960:	89 e5                	mov    %esp,%ebp
+  800962:	8b 45 08             	mov    0x8(%ebp),%eax
+  800965:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800969:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  80096c:	38 ca                	cmp    %cl,%dl
+  80096e:	74 09                	je     800979 <strfind+0x1a>
+  800970:	84 d2                	test   %dl,%dl
+  800972:	74 05                	je     800979 <strfind+0x1a>
+  for (; *s; s++)
+  800974:	83 c0 01             	add    $0x1,%eax
+  800977:	eb f0                	jmp    800969 <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  800979:	5d                   	pop    %ebp
+  80097a:	c3                   	ret
+
+0080097b <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  80097b:	55                   	push   %ebp
+  80097c:	89 e5                	mov    %esp,%ebp
+  80097e:	57                   	push   %edi
+  80097f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800982:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  800985:	85 c9                	test   %ecx,%ecx
+  800987:	74 20                	je     8009a9 <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  800989:	89 f8                	mov    %edi,%eax
+  80098b:	09 c8                	or     %ecx,%eax
+  80098d:	a8 03                	test   $0x3,%al
+  80098f:	75 12                	jne    8009a3 <memset+0x28>
+    c &= 0xFF;
+  800991:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800995:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  80099b:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  80099e:	fc                   	cld
+  80099f:	f3 ab                	rep stos %eax,%es:(%edi)
+  8009a1:	eb 06                	jmp    8009a9 <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  8009a3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8009a6:	fc                   	cld
+  8009a7:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  8009a9:	89 f8                	mov    %edi,%eax
+  8009ab:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8009ae:	c9                   	leave
+  8009af:	c3                   	ret
+
+008009b0 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8009b0:	55                   	push   %ebp
+  8009b1:	89 e5                	mov    %esp,%ebp
+  8009b3:	57                   	push   %edi
+  8009b4:	56                   	push   %esi
+  8009b5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009b8:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8009bb:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  8009be:	39 c6                	cmp    %eax,%esi
+  8009c0:	73 32                	jae    8009f4 <memmove+0x44>
+  8009c2:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8009c5:	39 d0                	cmp    %edx,%eax
+  8009c7:	73 2b                	jae    8009f4 <memmove+0x44>
+    s += n;
+    d += n;
+  8009c9:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009cc:	89 d6                	mov    %edx,%esi
+  8009ce:	09 fe                	or     %edi,%esi
+  8009d0:	09 ce                	or     %ecx,%esi
+  8009d2:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8009d8:	75 0e                	jne    8009e8 <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8009da:	83 ef 04             	sub    $0x4,%edi
+  8009dd:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8009e0:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  8009e3:	fd                   	std
+  8009e4:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009e6:	eb 09                	jmp    8009f1 <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8009e8:	83 ef 01             	sub    $0x1,%edi
+  8009eb:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  8009ee:	fd                   	std
+  8009ef:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  8009f1:	fc                   	cld
+  8009f2:	eb 1a                	jmp    800a0e <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009f4:	89 f2                	mov    %esi,%edx
+  8009f6:	09 c2                	or     %eax,%edx
+  8009f8:	09 ca                	or     %ecx,%edx
+  8009fa:	f6 c2 03             	test   $0x3,%dl
+  8009fd:	75 0a                	jne    800a09 <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8009ff:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  800a02:	89 c7                	mov    %eax,%edi
+  800a04:	fc                   	cld
+  800a05:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a07:	eb 05                	jmp    800a0e <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  800a09:	89 c7                	mov    %eax,%edi
+  800a0b:	fc                   	cld
+  800a0c:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  800a0e:	5e                   	pop    %esi
+  800a0f:	5f                   	pop    %edi
+  800a10:	5d                   	pop    %ebp
+  800a11:	c3                   	ret
+
+00800a12 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a12:	55                   	push   %ebp
+  800a13:	89 e5                	mov    %esp,%ebp
+  800a15:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  800a18:	ff 75 10             	push   0x10(%ebp)
+  800a1b:	ff 75 0c             	push   0xc(%ebp)
+  800a1e:	ff 75 08             	push   0x8(%ebp)
+  800a21:	e8 8a ff ff ff       	call   8009b0 <memmove>
+}
+  800a26:	c9                   	leave
+  800a27:	c3                   	ret
+
+00800a28 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a28:	55                   	push   %ebp
+  800a29:	89 e5                	mov    %esp,%ebp
+  800a2b:	56                   	push   %esi
+  800a2c:	53                   	push   %ebx
+  800a2d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a30:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  800a33:	89 c6                	mov    %eax,%esi
+  800a35:	03 75 10             	add    0x10(%ebp),%esi
+  800a38:	eb 06                	jmp    800a40 <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  800a3a:	83 c0 01             	add    $0x1,%eax
+  800a3d:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  800a40:	39 f0                	cmp    %esi,%eax
+  800a42:	74 14                	je     800a58 <memcmp+0x30>
+    if (*s1 != *s2)
+  800a44:	0f b6 08             	movzbl (%eax),%ecx
+  800a47:	0f b6 1a             	movzbl (%edx),%ebx
+  800a4a:	38 d9                	cmp    %bl,%cl
+  800a4c:	74 ec                	je     800a3a <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  800a4e:	0f b6 c1             	movzbl %cl,%eax
+  800a51:	0f b6 db             	movzbl %bl,%ebx
+  800a54:	29 d8                	sub    %ebx,%eax
+  800a56:	eb 05                	jmp    800a5d <memcmp+0x35>
+  }
+
+  return 0;
+  800a58:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a5d:	5b                   	pop    %ebx
+  800a5e:	5e                   	pop    %esi
+  800a5f:	5d                   	pop    %ebp
+  800a60:	c3                   	ret
+
+00800a61 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a61:	55                   	push   %ebp
+  800a62:	89 e5                	mov    %esp,%ebp
+  800a64:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a67:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  800a6a:	89 c2                	mov    %eax,%edx
+  800a6c:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  800a6f:	eb 03                	jmp    800a74 <memfind+0x13>
+  800a71:	83 c0 01             	add    $0x1,%eax
+  800a74:	39 d0                	cmp    %edx,%eax
+  800a76:	73 04                	jae    800a7c <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  800a78:	38 08                	cmp    %cl,(%eax)
+  800a7a:	75 f5                	jne    800a71 <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  800a7c:	5d                   	pop    %ebp
+  800a7d:	c3                   	ret
+
+00800a7e <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a7e:	55                   	push   %ebp
+  800a7f:	89 e5                	mov    %esp,%ebp
+  800a81:	57                   	push   %edi
+  800a82:	56                   	push   %esi
+  800a83:	53                   	push   %ebx
+  800a84:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a87:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  800a8a:	eb 03                	jmp    800a8f <strtol+0x11>
+    s++;
+  800a8c:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  800a8f:	0f b6 02             	movzbl (%edx),%eax
+  800a92:	3c 20                	cmp    $0x20,%al
+  800a94:	74 f6                	je     800a8c <strtol+0xe>
+  800a96:	3c 09                	cmp    $0x9,%al
+  800a98:	74 f2                	je     800a8c <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  800a9a:	3c 2b                	cmp    $0x2b,%al
+  800a9c:	74 2a                	je     800ac8 <strtol+0x4a>
+  int neg = 0;
+  800a9e:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  800aa3:	3c 2d                	cmp    $0x2d,%al
+  800aa5:	74 2b                	je     800ad2 <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800aa7:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800aad:	75 0f                	jne    800abe <strtol+0x40>
+  800aaf:	80 3a 30             	cmpb   $0x30,(%edx)
+  800ab2:	74 28                	je     800adc <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  800ab4:	85 db                	test   %ebx,%ebx
+  800ab6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800abb:	0f 44 d8             	cmove  %eax,%ebx
+  800abe:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ac3:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800ac6:	eb 46                	jmp    800b0e <strtol+0x90>
+    s++;
+  800ac8:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  800acb:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ad0:	eb d5                	jmp    800aa7 <strtol+0x29>
+    s++, neg = 1;
+  800ad2:	83 c2 01             	add    $0x1,%edx
+  800ad5:	bf 01 00 00 00       	mov    $0x1,%edi
+  800ada:	eb cb                	jmp    800aa7 <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800adc:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800ae0:	74 0e                	je     800af0 <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  800ae2:	85 db                	test   %ebx,%ebx
+  800ae4:	75 d8                	jne    800abe <strtol+0x40>
+    s++, base = 8;
+  800ae6:	83 c2 01             	add    $0x1,%edx
+  800ae9:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800aee:	eb ce                	jmp    800abe <strtol+0x40>
+    s += 2, base = 16;
+  800af0:	83 c2 02             	add    $0x2,%edx
+  800af3:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800af8:	eb c4                	jmp    800abe <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  800afa:	0f be c0             	movsbl %al,%eax
+  800afd:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  800b00:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800b03:	7d 3a                	jge    800b3f <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  800b05:	83 c2 01             	add    $0x1,%edx
+  800b08:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800b0c:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  800b0e:	0f b6 02             	movzbl (%edx),%eax
+  800b11:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800b14:	89 f3                	mov    %esi,%ebx
+  800b16:	80 fb 09             	cmp    $0x9,%bl
+  800b19:	76 df                	jbe    800afa <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  800b1b:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800b1e:	89 f3                	mov    %esi,%ebx
+  800b20:	80 fb 19             	cmp    $0x19,%bl
+  800b23:	77 08                	ja     800b2d <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  800b25:	0f be c0             	movsbl %al,%eax
+  800b28:	83 e8 57             	sub    $0x57,%eax
+  800b2b:	eb d3                	jmp    800b00 <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  800b2d:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800b30:	89 f3                	mov    %esi,%ebx
+  800b32:	80 fb 19             	cmp    $0x19,%bl
+  800b35:	77 08                	ja     800b3f <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  800b37:	0f be c0             	movsbl %al,%eax
+  800b3a:	83 e8 37             	sub    $0x37,%eax
+  800b3d:	eb c1                	jmp    800b00 <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  800b3f:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b43:	74 05                	je     800b4a <strtol+0xcc>
+    *endptr = (char*)s;
+  800b45:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b48:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  800b4a:	89 c8                	mov    %ecx,%eax
+  800b4c:	f7 d8                	neg    %eax
+  800b4e:	85 ff                	test   %edi,%edi
+  800b50:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b53:	89 c8                	mov    %ecx,%eax
+  800b55:	5b                   	pop    %ebx
+  800b56:	5e                   	pop    %esi
+  800b57:	5f                   	pop    %edi
+  800b58:	5d                   	pop    %ebp
+  800b59:	c3                   	ret
+
+00800b5a <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800b5a:	55                   	push   %ebp
+  800b5b:	89 e5                	mov    %esp,%ebp
+  800b5d:	57                   	push   %edi
+  800b5e:	56                   	push   %esi
+  800b5f:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800b60:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b65:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b68:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b6b:	89 c3                	mov    %eax,%ebx
+  800b6d:	89 c7                	mov    %eax,%edi
+  800b6f:	89 c6                	mov    %eax,%esi
+  800b71:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800b73:	5b                   	pop    %ebx
+  800b74:	5e                   	pop    %esi
+  800b75:	5f                   	pop    %edi
+  800b76:	5d                   	pop    %ebp
+  800b77:	c3                   	ret
+
+00800b78 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800b78:	55                   	push   %ebp
+  800b79:	89 e5                	mov    %esp,%ebp
+  800b7b:	57                   	push   %edi
+  800b7c:	56                   	push   %esi
+  800b7d:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800b7e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b83:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b88:	89 d1                	mov    %edx,%ecx
+  800b8a:	89 d3                	mov    %edx,%ebx
+  800b8c:	89 d7                	mov    %edx,%edi
+  800b8e:	89 d6                	mov    %edx,%esi
+  800b90:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800b92:	5b                   	pop    %ebx
+  800b93:	5e                   	pop    %esi
+  800b94:	5f                   	pop    %edi
+  800b95:	5d                   	pop    %ebp
+  800b96:	c3                   	ret
+
+00800b97 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800b97:	55                   	push   %ebp
+  800b98:	89 e5                	mov    %esp,%ebp
+  800b9a:	57                   	push   %edi
+  800b9b:	56                   	push   %esi
+  800b9c:	53                   	push   %ebx
+  800b9d:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800ba0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ba5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ba8:	b8 03 00 00 00       	mov    $0x3,%eax
+  800bad:	89 cb                	mov    %ecx,%ebx
+  800baf:	89 cf                	mov    %ecx,%edi
+  800bb1:	89 ce                	mov    %ecx,%esi
+  800bb3:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800bb5:	85 c0                	test   %eax,%eax
+  800bb7:	7f 08                	jg     800bc1 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800bb9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bbc:	5b                   	pop    %ebx
+  800bbd:	5e                   	pop    %esi
+  800bbe:	5f                   	pop    %edi
+  800bbf:	5d                   	pop    %ebp
+  800bc0:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800bc1:	83 ec 0c             	sub    $0xc,%esp
+  800bc4:	50                   	push   %eax
+  800bc5:	6a 03                	push   $0x3
+  800bc7:	68 23 3d 80 00       	push   $0x803d23
+  800bcc:	6a 23                	push   $0x23
+  800bce:	68 40 3d 80 00       	push   $0x803d40
+  800bd3:	e8 89 f5 ff ff       	call   800161 <_panic>
+
+00800bd8 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800bd8:	55                   	push   %ebp
+  800bd9:	89 e5                	mov    %esp,%ebp
+  800bdb:	57                   	push   %edi
+  800bdc:	56                   	push   %esi
+  800bdd:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800bde:	ba 00 00 00 00       	mov    $0x0,%edx
+  800be3:	b8 02 00 00 00       	mov    $0x2,%eax
+  800be8:	89 d1                	mov    %edx,%ecx
+  800bea:	89 d3                	mov    %edx,%ebx
+  800bec:	89 d7                	mov    %edx,%edi
+  800bee:	89 d6                	mov    %edx,%esi
+  800bf0:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800bf2:	5b                   	pop    %ebx
+  800bf3:	5e                   	pop    %esi
+  800bf4:	5f                   	pop    %edi
+  800bf5:	5d                   	pop    %ebp
+  800bf6:	c3                   	ret
+
+00800bf7 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800bf7:	55                   	push   %ebp
+  800bf8:	89 e5                	mov    %esp,%ebp
+  800bfa:	57                   	push   %edi
+  800bfb:	56                   	push   %esi
+  800bfc:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800bfd:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c02:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800c07:	89 d1                	mov    %edx,%ecx
+  800c09:	89 d3                	mov    %edx,%ebx
+  800c0b:	89 d7                	mov    %edx,%edi
+  800c0d:	89 d6                	mov    %edx,%esi
+  800c0f:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800c11:	5b                   	pop    %ebx
+  800c12:	5e                   	pop    %esi
+  800c13:	5f                   	pop    %edi
+  800c14:	5d                   	pop    %ebp
+  800c15:	c3                   	ret
+
+00800c16 <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  800c16:	55                   	push   %ebp
+  800c17:	89 e5                	mov    %esp,%ebp
+  800c19:	57                   	push   %edi
+  800c1a:	56                   	push   %esi
+  800c1b:	53                   	push   %ebx
+  800c1c:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  800c1f:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  800c23:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c28:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c2b:	b8 14 00 00 00       	mov    $0x14,%eax
+  800c30:	89 df                	mov    %ebx,%edi
+  800c32:	89 de                	mov    %ebx,%esi
+  800c34:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c36:	85 c0                	test   %eax,%eax
+  800c38:	7f 08                	jg     800c42 <sys_env_set_cow+0x2c>
+}
+  800c3a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c3d:	5b                   	pop    %ebx
+  800c3e:	5e                   	pop    %esi
+  800c3f:	5f                   	pop    %edi
+  800c40:	5d                   	pop    %ebp
+  800c41:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c42:	83 ec 0c             	sub    $0xc,%esp
+  800c45:	50                   	push   %eax
+  800c46:	6a 14                	push   $0x14
+  800c48:	68 23 3d 80 00       	push   $0x803d23
+  800c4d:	6a 23                	push   $0x23
+  800c4f:	68 40 3d 80 00       	push   $0x803d40
+  800c54:	e8 08 f5 ff ff       	call   800161 <_panic>
+
+00800c59 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800c59:	55                   	push   %ebp
+  800c5a:	89 e5                	mov    %esp,%ebp
+  800c5c:	57                   	push   %edi
+  800c5d:	56                   	push   %esi
+  800c5e:	53                   	push   %ebx
+  800c5f:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800c62:	be 00 00 00 00       	mov    $0x0,%esi
+  800c67:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c6a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c6d:	b8 04 00 00 00       	mov    $0x4,%eax
+  800c72:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c75:	89 f7                	mov    %esi,%edi
+  800c77:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c79:	85 c0                	test   %eax,%eax
+  800c7b:	7f 08                	jg     800c85 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  800c7d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c80:	5b                   	pop    %ebx
+  800c81:	5e                   	pop    %esi
+  800c82:	5f                   	pop    %edi
+  800c83:	5d                   	pop    %ebp
+  800c84:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c85:	83 ec 0c             	sub    $0xc,%esp
+  800c88:	50                   	push   %eax
+  800c89:	6a 04                	push   $0x4
+  800c8b:	68 23 3d 80 00       	push   $0x803d23
+  800c90:	6a 23                	push   $0x23
+  800c92:	68 40 3d 80 00       	push   $0x803d40
+  800c97:	e8 c5 f4 ff ff       	call   800161 <_panic>
+
+00800c9c <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800c9c:	55                   	push   %ebp
+  800c9d:	89 e5                	mov    %esp,%ebp
+  800c9f:	57                   	push   %edi
+  800ca0:	56                   	push   %esi
+  800ca1:	53                   	push   %ebx
+  800ca2:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800ca5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ca8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cab:	b8 05 00 00 00       	mov    $0x5,%eax
+  800cb0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cb3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800cb6:	8b 75 18             	mov    0x18(%ebp),%esi
+  800cb9:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800cbb:	85 c0                	test   %eax,%eax
+  800cbd:	7f 08                	jg     800cc7 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  800cbf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cc2:	5b                   	pop    %ebx
+  800cc3:	5e                   	pop    %esi
+  800cc4:	5f                   	pop    %edi
+  800cc5:	5d                   	pop    %ebp
+  800cc6:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800cc7:	83 ec 0c             	sub    $0xc,%esp
+  800cca:	50                   	push   %eax
+  800ccb:	6a 05                	push   $0x5
+  800ccd:	68 23 3d 80 00       	push   $0x803d23
+  800cd2:	6a 23                	push   $0x23
+  800cd4:	68 40 3d 80 00       	push   $0x803d40
+  800cd9:	e8 83 f4 ff ff       	call   800161 <_panic>
+
+00800cde <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800cde:	55                   	push   %ebp
+  800cdf:	89 e5                	mov    %esp,%ebp
+  800ce1:	57                   	push   %edi
+  800ce2:	56                   	push   %esi
+  800ce3:	53                   	push   %ebx
+  800ce4:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800ce7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cec:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cf2:	b8 06 00 00 00       	mov    $0x6,%eax
+  800cf7:	89 df                	mov    %ebx,%edi
+  800cf9:	89 de                	mov    %ebx,%esi
+  800cfb:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800cfd:	85 c0                	test   %eax,%eax
+  800cff:	7f 08                	jg     800d09 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  800d01:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d04:	5b                   	pop    %ebx
+  800d05:	5e                   	pop    %esi
+  800d06:	5f                   	pop    %edi
+  800d07:	5d                   	pop    %ebp
+  800d08:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d09:	83 ec 0c             	sub    $0xc,%esp
+  800d0c:	50                   	push   %eax
+  800d0d:	6a 06                	push   $0x6
+  800d0f:	68 23 3d 80 00       	push   $0x803d23
+  800d14:	6a 23                	push   $0x23
+  800d16:	68 40 3d 80 00       	push   $0x803d40
+  800d1b:	e8 41 f4 ff ff       	call   800161 <_panic>
+
+00800d20 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  800d20:	55                   	push   %ebp
+  800d21:	89 e5                	mov    %esp,%ebp
+  800d23:	57                   	push   %edi
+  800d24:	56                   	push   %esi
+  800d25:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d26:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d29:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d2c:	b8 11 00 00 00       	mov    $0x11,%eax
+  800d31:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d34:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d37:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d3a:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  800d3c:	5b                   	pop    %ebx
+  800d3d:	5e                   	pop    %esi
+  800d3e:	5f                   	pop    %edi
+  800d3f:	5d                   	pop    %ebp
+  800d40:	c3                   	ret
+
+00800d41 <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  800d41:	55                   	push   %ebp
+  800d42:	89 e5                	mov    %esp,%ebp
+  800d44:	57                   	push   %edi
+  800d45:	56                   	push   %esi
+  800d46:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d47:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d4a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d4d:	b8 12 00 00 00       	mov    $0x12,%eax
+  800d52:	be 00 00 00 00       	mov    $0x0,%esi
+  800d57:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d5a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d5d:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  800d5f:	5b                   	pop    %ebx
+  800d60:	5e                   	pop    %esi
+  800d61:	5f                   	pop    %edi
+  800d62:	5d                   	pop    %ebp
+  800d63:	c3                   	ret
+
+00800d64 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  800d64:	55                   	push   %ebp
+  800d65:	89 e5                	mov    %esp,%ebp
+  800d67:	57                   	push   %edi
+  800d68:	56                   	push   %esi
+  800d69:	53                   	push   %ebx
+  800d6a:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800d6d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d72:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d75:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d78:	b8 16 00 00 00       	mov    $0x16,%eax
+  800d7d:	89 df                	mov    %ebx,%edi
+  800d7f:	89 de                	mov    %ebx,%esi
+  800d81:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d83:	85 c0                	test   %eax,%eax
+  800d85:	7f 08                	jg     800d8f <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  800d87:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d8a:	5b                   	pop    %ebx
+  800d8b:	5e                   	pop    %esi
+  800d8c:	5f                   	pop    %edi
+  800d8d:	5d                   	pop    %ebp
+  800d8e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d8f:	83 ec 0c             	sub    $0xc,%esp
+  800d92:	50                   	push   %eax
+  800d93:	6a 16                	push   $0x16
+  800d95:	68 23 3d 80 00       	push   $0x803d23
+  800d9a:	6a 23                	push   $0x23
+  800d9c:	68 40 3d 80 00       	push   $0x803d40
+  800da1:	e8 bb f3 ff ff       	call   800161 <_panic>
+
+00800da6 <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  800da6:	55                   	push   %ebp
+  800da7:	89 e5                	mov    %esp,%ebp
+  800da9:	57                   	push   %edi
+  800daa:	56                   	push   %esi
+  800dab:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800dac:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800db1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800db4:	b8 17 00 00 00       	mov    $0x17,%eax
+  800db9:	89 cb                	mov    %ecx,%ebx
+  800dbb:	89 cf                	mov    %ecx,%edi
+  800dbd:	89 ce                	mov    %ecx,%esi
+  800dbf:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  800dc1:	5b                   	pop    %ebx
+  800dc2:	5e                   	pop    %esi
+  800dc3:	5f                   	pop    %edi
+  800dc4:	5d                   	pop    %ebp
+  800dc5:	c3                   	ret
+
+00800dc6 <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  800dc6:	55                   	push   %ebp
+  800dc7:	89 e5                	mov    %esp,%ebp
+  800dc9:	57                   	push   %edi
+  800dca:	56                   	push   %esi
+  800dcb:	53                   	push   %ebx
+  800dcc:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800dcf:	be 00 00 00 00       	mov    $0x0,%esi
+  800dd4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dd7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dda:	b8 18 00 00 00       	mov    $0x18,%eax
+  800ddf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800de2:	89 f7                	mov    %esi,%edi
+  800de4:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800de6:	85 c0                	test   %eax,%eax
+  800de8:	7f 08                	jg     800df2 <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  800dea:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ded:	5b                   	pop    %ebx
+  800dee:	5e                   	pop    %esi
+  800def:	5f                   	pop    %edi
+  800df0:	5d                   	pop    %ebp
+  800df1:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800df2:	83 ec 0c             	sub    $0xc,%esp
+  800df5:	50                   	push   %eax
+  800df6:	6a 18                	push   $0x18
+  800df8:	68 23 3d 80 00       	push   $0x803d23
+  800dfd:	6a 23                	push   $0x23
+  800dff:	68 40 3d 80 00       	push   $0x803d40
+  800e04:	e8 58 f3 ff ff       	call   800161 <_panic>
+
+00800e09 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  800e09:	55                   	push   %ebp
+  800e0a:	89 e5                	mov    %esp,%ebp
+  800e0c:	57                   	push   %edi
+  800e0d:	56                   	push   %esi
+  800e0e:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e0f:	be 00 00 00 00       	mov    $0x0,%esi
+  800e14:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e17:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e1a:	b8 19 00 00 00       	mov    $0x19,%eax
+  800e1f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e22:	89 f7                	mov    %esi,%edi
+  800e24:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  800e26:	5b                   	pop    %ebx
+  800e27:	5e                   	pop    %esi
+  800e28:	5f                   	pop    %edi
+  800e29:	5d                   	pop    %ebp
+  800e2a:	c3                   	ret
+
+00800e2b <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  800e2b:	55                   	push   %ebp
+  800e2c:	89 e5                	mov    %esp,%ebp
+  800e2e:	57                   	push   %edi
+  800e2f:	56                   	push   %esi
+  800e30:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e31:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e36:	b8 15 00 00 00       	mov    $0x15,%eax
+  800e3b:	89 d1                	mov    %edx,%ecx
+  800e3d:	89 d3                	mov    %edx,%ebx
+  800e3f:	89 d7                	mov    %edx,%edi
+  800e41:	89 d6                	mov    %edx,%esi
+  800e43:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800e45:	5b                   	pop    %ebx
+  800e46:	5e                   	pop    %esi
+  800e47:	5f                   	pop    %edi
+  800e48:	5d                   	pop    %ebp
+  800e49:	c3                   	ret
+
+00800e4a <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800e4a:	55                   	push   %ebp
+  800e4b:	89 e5                	mov    %esp,%ebp
+  800e4d:	57                   	push   %edi
+  800e4e:	56                   	push   %esi
+  800e4f:	53                   	push   %ebx
+  800e50:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e53:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e58:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e5b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e5e:	b8 08 00 00 00       	mov    $0x8,%eax
+  800e63:	89 df                	mov    %ebx,%edi
+  800e65:	89 de                	mov    %ebx,%esi
+  800e67:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e69:	85 c0                	test   %eax,%eax
+  800e6b:	7f 08                	jg     800e75 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800e6d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e70:	5b                   	pop    %ebx
+  800e71:	5e                   	pop    %esi
+  800e72:	5f                   	pop    %edi
+  800e73:	5d                   	pop    %ebp
+  800e74:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e75:	83 ec 0c             	sub    $0xc,%esp
+  800e78:	50                   	push   %eax
+  800e79:	6a 08                	push   $0x8
+  800e7b:	68 23 3d 80 00       	push   $0x803d23
+  800e80:	6a 23                	push   $0x23
+  800e82:	68 40 3d 80 00       	push   $0x803d40
+  800e87:	e8 d5 f2 ff ff       	call   800161 <_panic>
+
+00800e8c <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800e8c:	55                   	push   %ebp
+  800e8d:	89 e5                	mov    %esp,%ebp
+  800e8f:	57                   	push   %edi
+  800e90:	56                   	push   %esi
+  800e91:	53                   	push   %ebx
+  800e92:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e95:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e9a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e9d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ea0:	b8 09 00 00 00       	mov    $0x9,%eax
+  800ea5:	89 df                	mov    %ebx,%edi
+  800ea7:	89 de                	mov    %ebx,%esi
+  800ea9:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800eab:	85 c0                	test   %eax,%eax
+  800ead:	7f 08                	jg     800eb7 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  800eaf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eb2:	5b                   	pop    %ebx
+  800eb3:	5e                   	pop    %esi
+  800eb4:	5f                   	pop    %edi
+  800eb5:	5d                   	pop    %ebp
+  800eb6:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800eb7:	83 ec 0c             	sub    $0xc,%esp
+  800eba:	50                   	push   %eax
+  800ebb:	6a 09                	push   $0x9
+  800ebd:	68 23 3d 80 00       	push   $0x803d23
+  800ec2:	6a 23                	push   $0x23
+  800ec4:	68 40 3d 80 00       	push   $0x803d40
+  800ec9:	e8 93 f2 ff ff       	call   800161 <_panic>
+
+00800ece <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800ece:	55                   	push   %ebp
+  800ecf:	89 e5                	mov    %esp,%ebp
+  800ed1:	57                   	push   %edi
+  800ed2:	56                   	push   %esi
+  800ed3:	53                   	push   %ebx
+  800ed4:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800ed7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800edc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800edf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ee2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ee7:	89 df                	mov    %ebx,%edi
+  800ee9:	89 de                	mov    %ebx,%esi
+  800eeb:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800eed:	85 c0                	test   %eax,%eax
+  800eef:	7f 08                	jg     800ef9 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  800ef1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ef4:	5b                   	pop    %ebx
+  800ef5:	5e                   	pop    %esi
+  800ef6:	5f                   	pop    %edi
+  800ef7:	5d                   	pop    %ebp
+  800ef8:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ef9:	83 ec 0c             	sub    $0xc,%esp
+  800efc:	50                   	push   %eax
+  800efd:	6a 0a                	push   $0xa
+  800eff:	68 23 3d 80 00       	push   $0x803d23
+  800f04:	6a 23                	push   $0x23
+  800f06:	68 40 3d 80 00       	push   $0x803d40
+  800f0b:	e8 51 f2 ff ff       	call   800161 <_panic>
+
+00800f10 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  800f10:	55                   	push   %ebp
+  800f11:	89 e5                	mov    %esp,%ebp
+  800f13:	57                   	push   %edi
+  800f14:	56                   	push   %esi
+  800f15:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f16:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f19:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f1c:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f21:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f24:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f27:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f2a:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  800f2c:	5b                   	pop    %ebx
+  800f2d:	5e                   	pop    %esi
+  800f2e:	5f                   	pop    %edi
+  800f2f:	5d                   	pop    %ebp
+  800f30:	c3                   	ret
+
+00800f31 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  800f31:	55                   	push   %ebp
+  800f32:	89 e5                	mov    %esp,%ebp
+  800f34:	57                   	push   %edi
+  800f35:	56                   	push   %esi
+  800f36:	53                   	push   %ebx
+  800f37:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f3a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f3f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f42:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f45:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f4a:	89 df                	mov    %ebx,%edi
+  800f4c:	89 de                	mov    %ebx,%esi
+  800f4e:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f50:	85 c0                	test   %eax,%eax
+  800f52:	7f 08                	jg     800f5c <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  800f54:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f57:	5b                   	pop    %ebx
+  800f58:	5e                   	pop    %esi
+  800f59:	5f                   	pop    %edi
+  800f5a:	5d                   	pop    %ebp
+  800f5b:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f5c:	83 ec 0c             	sub    $0xc,%esp
+  800f5f:	50                   	push   %eax
+  800f60:	6a 0d                	push   $0xd
+  800f62:	68 23 3d 80 00       	push   $0x803d23
+  800f67:	6a 23                	push   $0x23
+  800f69:	68 40 3d 80 00       	push   $0x803d40
+  800f6e:	e8 ee f1 ff ff       	call   800161 <_panic>
+
+00800f73 <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  800f73:	55                   	push   %ebp
+  800f74:	89 e5                	mov    %esp,%ebp
+  800f76:	57                   	push   %edi
+  800f77:	56                   	push   %esi
+  800f78:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f79:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f7e:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800f83:	89 d1                	mov    %edx,%ecx
+  800f85:	89 d3                	mov    %edx,%ebx
+  800f87:	89 d7                	mov    %edx,%edi
+  800f89:	89 d6                	mov    %edx,%esi
+  800f8b:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800f8d:	5b                   	pop    %ebx
+  800f8e:	5e                   	pop    %esi
+  800f8f:	5f                   	pop    %edi
+  800f90:	5d                   	pop    %ebp
+  800f91:	c3                   	ret
+
+00800f92 <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  800f92:	55                   	push   %ebp
+  800f93:	89 e5                	mov    %esp,%ebp
+  800f95:	57                   	push   %edi
+  800f96:	56                   	push   %esi
+  800f97:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f98:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f9b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f9e:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800fa3:	be 00 00 00 00       	mov    $0x0,%esi
+  800fa8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fab:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fae:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  800fb0:	5b                   	pop    %ebx
+  800fb1:	5e                   	pop    %esi
+  800fb2:	5f                   	pop    %edi
+  800fb3:	5d                   	pop    %ebp
+  800fb4:	c3                   	ret
+
+00800fb5 <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  800fb5:	55                   	push   %ebp
+  800fb6:	89 e5                	mov    %esp,%ebp
+  800fb8:	57                   	push   %edi
+  800fb9:	56                   	push   %esi
+  800fba:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800fbb:	be 00 00 00 00       	mov    $0x0,%esi
+  800fc0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fc3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fc6:	b8 10 00 00 00       	mov    $0x10,%eax
+  800fcb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fce:	89 f7                	mov    %esi,%edi
+  800fd0:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  800fd2:	5b                   	pop    %ebx
+  800fd3:	5e                   	pop    %esi
+  800fd4:	5f                   	pop    %edi
+  800fd5:	5d                   	pop    %ebp
+  800fd6:	c3                   	ret
+
+00800fd7 <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  800fd7:	55                   	push   %ebp
+  800fd8:	89 e5                	mov    %esp,%ebp
+  800fda:	57                   	push   %edi
+  800fdb:	56                   	push   %esi
+  800fdc:	53                   	push   %ebx
+  800fdd:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  800fe0:	80 3d a4 58 80 00 00 	cmpb   $0x0,0x8058a4
+  800fe7:	74 41                	je     80102a <sys_batch+0x53>
+  800fe9:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fec:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  800fef:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  800ff6:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800ff9:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  800ffc:	7d 45                	jge    801043 <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  800ffe:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801001:	8b 06                	mov    (%esi),%eax
+  801003:	8b 56 04             	mov    0x4(%esi),%edx
+  801006:	8b 4e 08             	mov    0x8(%esi),%ecx
+  801009:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  80100c:	8b 7e 10             	mov    0x10(%esi),%edi
+  80100f:	8b 76 14             	mov    0x14(%esi),%esi
+  801012:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  801014:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801017:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  80101a:	83 c6 1c             	add    $0x1c,%esi
+  80101d:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  801020:	85 c0                	test   %eax,%eax
+  801022:	78 1f                	js     801043 <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  801024:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  801028:	eb cc                	jmp    800ff6 <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  80102a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80102f:	b8 13 00 00 00       	mov    $0x13,%eax
+  801034:	8b 55 08             	mov    0x8(%ebp),%edx
+  801037:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80103a:	89 df                	mov    %ebx,%edi
+  80103c:	89 de                	mov    %ebx,%esi
+  80103e:	cd 30                	int    $0x30
+  801040:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  801043:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801046:	83 c4 08             	add    $0x8,%esp
+  801049:	5b                   	pop    %ebx
+  80104a:	5e                   	pop    %esi
+  80104b:	5f                   	pop    %edi
+  80104c:	5d                   	pop    %ebp
+  80104d:	c3                   	ret
+
+0080104e <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  80104e:	55                   	push   %ebp
+  80104f:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  801051:	8b 45 08             	mov    0x8(%ebp),%eax
+  801054:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  80105a:	5d                   	pop    %ebp
+  80105b:	c3                   	ret
+
+0080105c <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  80105c:	55                   	push   %ebp
+  80105d:	89 e5                	mov    %esp,%ebp
+  80105f:	56                   	push   %esi
+  801060:	53                   	push   %ebx
+  801061:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  801064:	8b 1e                	mov    (%esi),%ebx
+  801066:	85 db                	test   %ebx,%ebx
+  801068:	75 09                	jne    801073 <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  80106a:	89 d8                	mov    %ebx,%eax
+  80106c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80106f:	5b                   	pop    %ebx
+  801070:	5e                   	pop    %esi
+  801071:	5d                   	pop    %ebp
+  801072:	c3                   	ret
+  b->sb_n = 0;
+  801073:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  801079:	53                   	push   %ebx
+  80107a:	8d 46 04             	lea    0x4(%esi),%eax
+  80107d:	50                   	push   %eax
+  80107e:	e8 54 ff ff ff       	call   800fd7 <sys_batch>
+  801083:	83 c4 08             	add    $0x8,%esp
+  801086:	85 c0                	test   %eax,%eax
+  801088:	78 1e                	js     8010a8 <sysbatch_flush+0x4c>
+  if (r < n)
+  80108a:	39 c3                	cmp    %eax,%ebx
+  80108c:	7f 07                	jg     801095 <sysbatch_flush+0x39>
+  return 0;
+  80108e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801093:	eb d5                	jmp    80106a <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  801095:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801098:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  80109c:	85 db                	test   %ebx,%ebx
+  80109e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8010a3:	0f 49 d8             	cmovns %eax,%ebx
+  8010a6:	eb c2                	jmp    80106a <sysbatch_flush+0xe>
+    return r;
+  8010a8:	89 c3                	mov    %eax,%ebx
+  8010aa:	eb be                	jmp    80106a <sysbatch_flush+0xe>
+
+008010ac <sysbatch_add>:
+{
+  8010ac:	55                   	push   %ebp
+  8010ad:	89 e5                	mov    %esp,%ebp
+  8010af:	53                   	push   %ebx
+  8010b0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  8010b3:	83 3b 40             	cmpl   $0x40,(%ebx)
+  8010b6:	74 41                	je     8010f9 <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  8010b8:	8b 03                	mov    (%ebx),%eax
+  8010ba:	8d 50 01             	lea    0x1(%eax),%edx
+  8010bd:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  8010bf:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8010c2:	01 d8                	add    %ebx,%eax
+  8010c4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8010c7:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  8010ca:	8b 55 10             	mov    0x10(%ebp),%edx
+  8010cd:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  8010d0:	8b 55 14             	mov    0x14(%ebp),%edx
+  8010d3:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  8010d6:	8b 55 18             	mov    0x18(%ebp),%edx
+  8010d9:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  8010dc:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  8010df:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  8010e2:	8b 55 20             	mov    0x20(%ebp),%edx
+  8010e5:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  8010e8:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  8010ef:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8010f4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8010f7:	c9                   	leave
+  8010f8:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  8010f9:	53                   	push   %ebx
+  8010fa:	e8 5d ff ff ff       	call   80105c <sysbatch_flush>
+  8010ff:	83 c4 04             	add    $0x4,%esp
+  801102:	85 c0                	test   %eax,%eax
+  801104:	79 b2                	jns    8010b8 <sysbatch_add+0xc>
+  801106:	eb ec                	jmp    8010f4 <sysbatch_add+0x48>
+
+00801108 <pgfault>:
+// Custom page fault handler - if faulting page is copy-on-write,
+// map in our own private writable copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  801108:	55                   	push   %ebp
+  801109:	89 e5                	mov    %esp,%ebp
+  80110b:	56                   	push   %esi
+  80110c:	53                   	push   %ebx
+  80110d:	8b 45 08             	mov    0x8(%ebp),%eax
+  void *addr = (void*)utf->utf_fault_va;
+  801110:	8b 18                	mov    (%eax),%ebx
+  uint32_t err = utf->utf_err;
+  801112:	8b 70 04             	mov    0x4(%eax),%esi
+  // Hint:
+  //   Use the read-only page table mappings at uvpt
+  //   (see <inc/memlayout.h>).
+
+  // Faults in file mappings are mmap's to handle.
+  if (mmap_fault(utf))
+  801115:	83 ec 0c             	sub    $0xc,%esp
+  801118:	50                   	push   %eax
+  801119:	e8 17 1f 00 00       	call   803035 <mmap_fault>
+  80111e:	83 c4 10             	add    $0x10,%esp
+  801121:	84 c0                	test   %al,%al
+  801123:	75 7d                	jne    8011a2 <pgfault+0x9a>
+    return;
+
+  // LAB 4: Your code here.
+  if ( !(err & FEC_WR) ) {
+  801125:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  80112b:	74 7c                	je     8011a9 <pgfault+0xa1>
+    panic("user_pgfault: %e", err);
+  }
+
+  if ( !(uvpt[PGNUM(addr)] & PTE_COW) ) {
+  80112d:	89 d8                	mov    %ebx,%eax
+  80112f:	c1 e8 0c             	shr    $0xc,%eax
+  801132:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801139:	f6 c4 08             	test   $0x8,%ah
+  80113c:	74 7d                	je     8011bb <pgfault+0xb3>
+  // page to the old page's address.
+  // Hint:
+  //   You should make three system calls.
+
+  // LAB 4: Your code here.
+  addr = ROUNDDOWN(addr, PGSIZE);
+  80113e:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+
+  // map page to temporary location
+  if ( (r = sys_page_alloc(0, PFTEMP, (PTE_P | PTE_U | PTE_W))) < 0) {
+  801144:	83 ec 04             	sub    $0x4,%esp
+  801147:	6a 07                	push   $0x7
+  801149:	68 00 f0 7f 00       	push   $0x7ff000
+  80114e:	6a 00                	push   $0x0
+  801150:	e8 04 fb ff ff       	call   800c59 <sys_page_alloc>
+  801155:	83 c4 10             	add    $0x10,%esp
+  801158:	85 c0                	test   %eax,%eax
+  80115a:	78 73                	js     8011cf <pgfault+0xc7>
+    panic("sys_page_alloc: %e", r);
+  }
+
+  // copy data from old page to new page
+  memmove(PFTEMP, addr, PGSIZE);
+  80115c:	83 ec 04             	sub    $0x4,%esp
+  80115f:	68 00 10 00 00       	push   $0x1000
+  801164:	53                   	push   %ebx
+  801165:	68 00 f0 7f 00       	push   $0x7ff000
+  80116a:	e8 41 f8 ff ff       	call   8009b0 <memmove>
+
+  // move new page to old page address
+  if ( (r = sys_page_map(0, PFTEMP, 0, addr, (PTE_P | PTE_U | PTE_W))) < 0) {
+  80116f:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801176:	53                   	push   %ebx
+  801177:	6a 00                	push   $0x0
+  801179:	68 00 f0 7f 00       	push   $0x7ff000
+  80117e:	6a 00                	push   $0x0
+  801180:	e8 17 fb ff ff       	call   800c9c <sys_page_map>
+  801185:	83 c4 20             	add    $0x20,%esp
+  801188:	85 c0                	test   %eax,%eax
+  80118a:	78 55                	js     8011e1 <pgfault+0xd9>
+    panic("sys_page_map: %e", r);
+  }
+
+  if ( (r = sys_page_unmap(0, PFTEMP)) < 0) {
+  80118c:	83 ec 08             	sub    $0x8,%esp
+  80118f:	68 00 f0 7f 00       	push   $0x7ff000
+  801194:	6a 00                	push   $0x0
+  801196:	e8 43 fb ff ff       	call   800cde <sys_page_unmap>
+  80119b:	83 c4 10             	add    $0x10,%esp
+  80119e:	85 c0                	test   %eax,%eax
+  8011a0:	78 51                	js     8011f3 <pgfault+0xeb>
+    panic("sys_page_unmap: %e", r);
+  }
+}
+  8011a2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8011a5:	5b                   	pop    %ebx
+  8011a6:	5e                   	pop    %esi
+  8011a7:	5d                   	pop    %ebp
+  8011a8:	c3                   	ret
+    panic("user_pgfault: %e", err);
+  8011a9:	56                   	push   %esi
+  8011aa:	68 4e 3d 80 00       	push   $0x803d4e
+  8011af:	6a 1d                	push   $0x1d
+  8011b1:	68 5f 3d 80 00       	push   $0x803d5f
+  8011b6:	e8 a6 ef ff ff       	call   800161 <_panic>
+    panic("user_pgfault: page not COW");
+  8011bb:	83 ec 04             	sub    $0x4,%esp
+  8011be:	68 6a 3d 80 00       	push   $0x803d6a
+  8011c3:	6a 21                	push   $0x21
+  8011c5:	68 5f 3d 80 00       	push   $0x803d5f
+  8011ca:	e8 92 ef ff ff       	call   800161 <_panic>
+    panic("sys_page_alloc: %e", r);
+  8011cf:	50                   	push   %eax
+  8011d0:	68 85 3d 80 00       	push   $0x803d85
+  8011d5:	6a 2f                	push   $0x2f
+  8011d7:	68 5f 3d 80 00       	push   $0x803d5f
+  8011dc:	e8 80 ef ff ff       	call   800161 <_panic>
+    panic("sys_page_map: %e", r);
+  8011e1:	50                   	push   %eax
+  8011e2:	68 98 3d 80 00       	push   $0x803d98
+  8011e7:	6a 37                	push   $0x37
+  8011e9:	68 5f 3d 80 00       	push   $0x803d5f
+  8011ee:	e8 6e ef ff ff       	call   800161 <_panic>
+    panic("sys_page_unmap: %e", r);
+  8011f3:	50                   	push   %eax
+  8011f4:	68 a9 3d 80 00       	push   $0x803da9
+  8011f9:	6a 3b                	push   $0x3b
+  8011fb:	68 5f 3d 80 00       	push   $0x803d5f
+  801200:	e8 5c ef ff ff       	call   800161 <_panic>
+
+00801205 <shared_pgfault>:
+
+// Challenge!
+//
+static void
+shared_pgfault(struct UTrapframe *utf)
+{
+  801205:	55                   	push   %ebp
+  801206:	89 e5                	mov    %esp,%ebp
+  801208:	53                   	push   %ebx
+  801209:	83 ec 10             	sub    $0x10,%esp
+  80120c:	8b 45 08             	mov    0x8(%ebp),%eax
+  // just has fewer error checks
+  
+  void *addr = (void*)utf->utf_fault_va;
+  80120f:	8b 18                	mov    (%eax),%ebx
+  uint32_t err = utf->utf_err;
+  int r;
+
+  if (mmap_fault(utf))
+  801211:	50                   	push   %eax
+  801212:	e8 1e 1e 00 00       	call   803035 <mmap_fault>
+  801217:	83 c4 10             	add    $0x10,%esp
+  80121a:	84 c0                	test   %al,%al
+  80121c:	74 05                	je     801223 <shared_pgfault+0x1e>
+  }
+
+  if ( (r = sys_page_unmap(0, PFTEMP)) < 0) {
+    panic("sys_page_unmap: %e", r);
+  }
+}
+  80121e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801221:	c9                   	leave
+  801222:	c3                   	ret
+  addr = ROUNDDOWN(addr, PGSIZE);
+  801223:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if ( (r = sys_page_alloc(0, PFTEMP, (PTE_P | PTE_U | PTE_W))) < 0) {
+  801229:	83 ec 04             	sub    $0x4,%esp
+  80122c:	6a 07                	push   $0x7
+  80122e:	68 00 f0 7f 00       	push   $0x7ff000
+  801233:	6a 00                	push   $0x0
+  801235:	e8 1f fa ff ff       	call   800c59 <sys_page_alloc>
+  80123a:	83 c4 10             	add    $0x10,%esp
+  80123d:	85 c0                	test   %eax,%eax
+  80123f:	78 5b                	js     80129c <shared_pgfault+0x97>
+  memmove(PFTEMP, addr, PGSIZE);
+  801241:	83 ec 04             	sub    $0x4,%esp
+  801244:	68 00 10 00 00       	push   $0x1000
+  801249:	53                   	push   %ebx
+  80124a:	68 00 f0 7f 00       	push   $0x7ff000
+  80124f:	e8 5c f7 ff ff       	call   8009b0 <memmove>
+  if ( (r = sys_page_map(0, PFTEMP, 0, addr, (PTE_P | PTE_U | PTE_W))) < 0) {
+  801254:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  80125b:	53                   	push   %ebx
+  80125c:	6a 00                	push   $0x0
+  80125e:	68 00 f0 7f 00       	push   $0x7ff000
+  801263:	6a 00                	push   $0x0
+  801265:	e8 32 fa ff ff       	call   800c9c <sys_page_map>
+  80126a:	83 c4 20             	add    $0x20,%esp
+  80126d:	85 c0                	test   %eax,%eax
+  80126f:	78 40                	js     8012b1 <shared_pgfault+0xac>
+  if ( (r = sys_page_unmap(0, PFTEMP)) < 0) {
+  801271:	83 ec 08             	sub    $0x8,%esp
+  801274:	68 00 f0 7f 00       	push   $0x7ff000
+  801279:	6a 00                	push   $0x0
+  80127b:	e8 5e fa ff ff       	call   800cde <sys_page_unmap>
+  801280:	83 c4 10             	add    $0x10,%esp
+  801283:	85 c0                	test   %eax,%eax
+  801285:	79 97                	jns    80121e <shared_pgfault+0x19>
+    panic("sys_page_unmap: %e", r);
+  801287:	50                   	push   %eax
+  801288:	68 a9 3d 80 00       	push   $0x803da9
+  80128d:	68 b0 00 00 00       	push   $0xb0
+  801292:	68 5f 3d 80 00       	push   $0x803d5f
+  801297:	e8 c5 ee ff ff       	call   800161 <_panic>
+    panic("sys_page_alloc: %e", r);
+  80129c:	50                   	push   %eax
+  80129d:	68 85 3d 80 00       	push   $0x803d85
+  8012a2:	68 a4 00 00 00       	push   $0xa4
+  8012a7:	68 5f 3d 80 00       	push   $0x803d5f
+  8012ac:	e8 b0 ee ff ff       	call   800161 <_panic>
+    panic("sys_page_map: %e", r);
+  8012b1:	50                   	push   %eax
+  8012b2:	68 98 3d 80 00       	push   $0x803d98
+  8012b7:	68 ac 00 00 00       	push   $0xac
+  8012bc:	68 5f 3d 80 00       	push   $0x803d5f
+  8012c1:	e8 9b ee ff ff       	call   800161 <_panic>
+
+008012c6 <fork>:
+{
+  8012c6:	55                   	push   %ebp
+  8012c7:	89 e5                	mov    %esp,%ebp
+  8012c9:	53                   	push   %ebx
+  8012ca:	83 ec 04             	sub    $0x4,%esp
+  parent_id = sys_getenvid();
+  8012cd:	e8 06 f9 ff ff       	call   800bd8 <sys_getenvid>
+  set_pgfault_handler(pgfault);
+  8012d2:	83 ec 0c             	sub    $0xc,%esp
+  8012d5:	68 08 11 80 00       	push   $0x801108
+  8012da:	e8 e5 23 00 00       	call   8036c4 <set_pgfault_handler>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+  envid_t ret;
+  __asm __volatile("int %2"
+  8012df:	b8 07 00 00 00       	mov    $0x7,%eax
+  8012e4:	cd 30                	int    $0x30
+  8012e6:	89 c3                	mov    %eax,%ebx
+  if (envid < 0) {
+  8012e8:	83 c4 10             	add    $0x10,%esp
+  8012eb:	85 c0                	test   %eax,%eax
+  8012ed:	78 66                	js     801355 <fork+0x8f>
+  } else if (envid == 0) {
+  8012ef:	74 76                	je     801367 <fork+0xa1>
+  if ( (error = sys_page_map_range(0, 0, UXSTACKTOP - PGSIZE,
+  8012f1:	83 ec 0c             	sub    $0xc,%esp
+  8012f4:	6a 01                	push   $0x1
+  8012f6:	50                   	push   %eax
+  8012f7:	68 00 f0 bf ee       	push   $0xeebff000
+  8012fc:	6a 00                	push   $0x0
+  8012fe:	6a 00                	push   $0x0
+  801300:	e8 1b fa ff ff       	call   800d20 <sys_page_map_range>
+  801305:	83 c4 20             	add    $0x20,%esp
+  801308:	85 c0                	test   %eax,%eax
+  80130a:	78 77                	js     801383 <fork+0xbd>
+  if ( (error = sys_page_alloc(envid,
+  80130c:	83 ec 04             	sub    $0x4,%esp
+  80130f:	6a 07                	push   $0x7
+  801311:	68 00 f0 bf ee       	push   $0xeebff000
+  801316:	53                   	push   %ebx
+  801317:	e8 3d f9 ff ff       	call   800c59 <sys_page_alloc>
+  80131c:	83 c4 10             	add    $0x10,%esp
+  80131f:	85 c0                	test   %eax,%eax
+  801321:	78 72                	js     801395 <fork+0xcf>
+          thisenv->env_pgfault_upcall)) < 0) {
+  801323:	a1 a0 58 80 00       	mov    0x8058a0,%eax
+  801328:	8b 40 64             	mov    0x64(%eax),%eax
+  if ( (error = sys_env_set_pgfault_upcall(envid,
+  80132b:	83 ec 08             	sub    $0x8,%esp
+  80132e:	50                   	push   %eax
+  80132f:	53                   	push   %ebx
+  801330:	e8 99 fb ff ff       	call   800ece <sys_env_set_pgfault_upcall>
+  801335:	83 c4 10             	add    $0x10,%esp
+  801338:	85 c0                	test   %eax,%eax
+  80133a:	78 6b                	js     8013a7 <fork+0xe1>
+  if ( (error = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+  80133c:	83 ec 08             	sub    $0x8,%esp
+  80133f:	6a 02                	push   $0x2
+  801341:	53                   	push   %ebx
+  801342:	e8 03 fb ff ff       	call   800e4a <sys_env_set_status>
+  801347:	83 c4 10             	add    $0x10,%esp
+  80134a:	85 c0                	test   %eax,%eax
+  80134c:	78 6b                	js     8013b9 <fork+0xf3>
+}
+  80134e:	89 d8                	mov    %ebx,%eax
+  801350:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801353:	c9                   	leave
+  801354:	c3                   	ret
+    panic("sys_exofork: %e", envid);
+  801355:	50                   	push   %eax
+  801356:	68 bc 3d 80 00       	push   $0x803dbc
+  80135b:	6a 5e                	push   $0x5e
+  80135d:	68 5f 3d 80 00       	push   $0x803d5f
+  801362:	e8 fa ed ff ff       	call   800161 <_panic>
+    thisenv = &envs[ENVX(sys_getenvid())];
+  801367:	e8 6c f8 ff ff       	call   800bd8 <sys_getenvid>
+  80136c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801371:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  801374:	c1 e0 04             	shl    $0x4,%eax
+  801377:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80137c:	a3 a0 58 80 00       	mov    %eax,0x8058a0
+    return 0;
+  801381:	eb cb                	jmp    80134e <fork+0x88>
+    panic("sys_page_map_range: %e", error);
+  801383:	50                   	push   %eax
+  801384:	68 cc 3d 80 00       	push   $0x803dcc
+  801389:	6a 69                	push   $0x69
+  80138b:	68 5f 3d 80 00       	push   $0x803d5f
+  801390:	e8 cc ed ff ff       	call   800161 <_panic>
+    panic("sys_page_alloc: %e", error);
+  801395:	50                   	push   %eax
+  801396:	68 85 3d 80 00       	push   $0x803d85
+  80139b:	6a 70                	push   $0x70
+  80139d:	68 5f 3d 80 00       	push   $0x803d5f
+  8013a2:	e8 ba ed ff ff       	call   800161 <_panic>
+    panic("sys_env_set_pgfault_upcall: %e", error);
+  8013a7:	50                   	push   %eax
+  8013a8:	68 fc 3d 80 00       	push   $0x803dfc
+  8013ad:	6a 76                	push   $0x76
+  8013af:	68 5f 3d 80 00       	push   $0x803d5f
+  8013b4:	e8 a8 ed ff ff       	call   800161 <_panic>
+    panic("sys_env_set_status: %e", error);
+  8013b9:	50                   	push   %eax
+  8013ba:	68 e3 3d 80 00       	push   $0x803de3
+  8013bf:	6a 7a                	push   $0x7a
+  8013c1:	68 5f 3d 80 00       	push   $0x803d5f
+  8013c6:	e8 96 ed ff ff       	call   800161 <_panic>
+
+008013cb <kfork>:
+{
+  8013cb:	55                   	push   %ebp
+  8013cc:	89 e5                	mov    %esp,%ebp
+  8013ce:	53                   	push   %ebx
+  8013cf:	83 ec 10             	sub    $0x10,%esp
+  set_pgfault_handler(pgfault);
+  8013d2:	68 08 11 80 00       	push   $0x801108
+  8013d7:	e8 e8 22 00 00       	call   8036c4 <set_pgfault_handler>
+  if ((envid = sys_fork()) == 0)
+  8013dc:	e8 4a fa ff ff       	call   800e2b <sys_fork>
+  8013e1:	89 c3                	mov    %eax,%ebx
+  8013e3:	83 c4 10             	add    $0x10,%esp
+  8013e6:	85 c0                	test   %eax,%eax
+  8013e8:	74 07                	je     8013f1 <kfork+0x26>
+}
+  8013ea:	89 d8                	mov    %ebx,%eax
+  8013ec:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013ef:	c9                   	leave
+  8013f0:	c3                   	ret
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8013f1:	e8 e2 f7 ff ff       	call   800bd8 <sys_getenvid>
+  8013f6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8013fb:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8013fe:	c1 e0 04             	shl    $0x4,%eax
+  801401:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801406:	a3 a0 58 80 00       	mov    %eax,0x8058a0
+  return envid;
+  80140b:	eb dd                	jmp    8013ea <kfork+0x1f>
+
+0080140d <sfork>:
+
+int
+sfork(void)
+{
+  80140d:	55                   	push   %ebp
+  80140e:	89 e5                	mov    %esp,%ebp
+  801410:	53                   	push   %ebx
+  801411:	83 ec 04             	sub    $0x4,%esp
+  envid_t envid, parent_id;
+  int error;
+
+  parent_id = sys_getenvid();
+  801414:	e8 bf f7 ff ff       	call   800bd8 <sys_getenvid>
+
+  // set up page fault handler
+  set_pgfault_handler(shared_pgfault);
+  801419:	83 ec 0c             	sub    $0xc,%esp
+  80141c:	68 05 12 80 00       	push   $0x801205
+  801421:	e8 9e 22 00 00       	call   8036c4 <set_pgfault_handler>
+  801426:	b8 07 00 00 00       	mov    $0x7,%eax
+  80142b:	cd 30                	int    $0x30
+  80142d:	89 c3                	mov    %eax,%ebx
+
+  // create a child with sys_exofork
+  envid = sys_exofork();
+  
+  if (envid < 0) {
+  80142f:	83 c4 10             	add    $0x10,%esp
+  801432:	85 c0                	test   %eax,%eax
+  801434:	78 09                	js     80143f <sfork+0x32>
+    panic("sys_exofork: %e", envid);
+  } else if (envid == 0) {
+  801436:	75 1c                	jne    801454 <sfork+0x47>
+  if ( (error = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+    panic("sys_env_set_status: %e", error);
+  }
+
+  return envid;
+}
+  801438:	89 d8                	mov    %ebx,%eax
+  80143a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80143d:	c9                   	leave
+  80143e:	c3                   	ret
+    panic("sys_exofork: %e", envid);
+  80143f:	50                   	push   %eax
+  801440:	68 bc 3d 80 00       	push   $0x803dbc
+  801445:	68 c3 00 00 00       	push   $0xc3
+  80144a:	68 5f 3d 80 00       	push   $0x803d5f
+  80144f:	e8 0d ed ff ff       	call   800161 <_panic>
+  if ( (error = sys_page_map_range(0, 0, USTACKTOP - PGSIZE,
+  801454:	83 ec 0c             	sub    $0xc,%esp
+  801457:	6a 00                	push   $0x0
+  801459:	50                   	push   %eax
+  80145a:	68 00 d0 bf ee       	push   $0xeebfd000
+  80145f:	6a 00                	push   $0x0
+  801461:	6a 00                	push   $0x0
+  801463:	e8 b8 f8 ff ff       	call   800d20 <sys_page_map_range>
+  801468:	83 c4 20             	add    $0x20,%esp
+  80146b:	85 c0                	test   %eax,%eax
+  80146d:	78 79                	js     8014e8 <sfork+0xdb>
+  if ( (error = sys_page_map_range(0, (void *) (USTACKTOP - PGSIZE), PGSIZE,
+  80146f:	83 ec 0c             	sub    $0xc,%esp
+  801472:	6a 01                	push   $0x1
+  801474:	53                   	push   %ebx
+  801475:	68 00 10 00 00       	push   $0x1000
+  80147a:	68 00 d0 bf ee       	push   $0xeebfd000
+  80147f:	6a 00                	push   $0x0
+  801481:	e8 9a f8 ff ff       	call   800d20 <sys_page_map_range>
+  801486:	83 c4 20             	add    $0x20,%esp
+  801489:	85 c0                	test   %eax,%eax
+  80148b:	78 70                	js     8014fd <sfork+0xf0>
+  if ( (error = sys_page_alloc(envid,
+  80148d:	83 ec 04             	sub    $0x4,%esp
+  801490:	6a 07                	push   $0x7
+  801492:	68 00 f0 bf ee       	push   $0xeebff000
+  801497:	53                   	push   %ebx
+  801498:	e8 bc f7 ff ff       	call   800c59 <sys_page_alloc>
+  80149d:	83 c4 10             	add    $0x10,%esp
+  8014a0:	85 c0                	test   %eax,%eax
+  8014a2:	78 6e                	js     801512 <sfork+0x105>
+          thisenv->env_pgfault_upcall)) < 0) {
+  8014a4:	a1 a0 58 80 00       	mov    0x8058a0,%eax
+  8014a9:	8b 40 64             	mov    0x64(%eax),%eax
+  if ( (error = sys_env_set_pgfault_upcall(envid,
+  8014ac:	83 ec 08             	sub    $0x8,%esp
+  8014af:	50                   	push   %eax
+  8014b0:	53                   	push   %ebx
+  8014b1:	e8 18 fa ff ff       	call   800ece <sys_env_set_pgfault_upcall>
+  8014b6:	83 c4 10             	add    $0x10,%esp
+  8014b9:	85 c0                	test   %eax,%eax
+  8014bb:	78 6a                	js     801527 <sfork+0x11a>
+  if ( (error = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+  8014bd:	83 ec 08             	sub    $0x8,%esp
+  8014c0:	6a 02                	push   $0x2
+  8014c2:	53                   	push   %ebx
+  8014c3:	e8 82 f9 ff ff       	call   800e4a <sys_env_set_status>
+  8014c8:	83 c4 10             	add    $0x10,%esp
+  8014cb:	85 c0                	test   %eax,%eax
+  8014cd:	0f 89 65 ff ff ff    	jns    801438 <sfork+0x2b>
+    panic("sys_env_set_status: %e", error);
+  8014d3:	50                   	push   %eax
+  8014d4:	68 e3 3d 80 00       	push   $0x803de3
+  8014d9:	68 e4 00 00 00       	push   $0xe4
+  8014de:	68 5f 3d 80 00       	push   $0x803d5f
+  8014e3:	e8 79 ec ff ff       	call   800161 <_panic>
+    panic("sys_page_map_range: %e", error);
+  8014e8:	50                   	push   %eax
+  8014e9:	68 cc 3d 80 00       	push   $0x803dcc
+  8014ee:	68 ce 00 00 00       	push   $0xce
+  8014f3:	68 5f 3d 80 00       	push   $0x803d5f
+  8014f8:	e8 64 ec ff ff       	call   800161 <_panic>
+    panic("sys_page_map_range: %e", error);
+  8014fd:	50                   	push   %eax
+  8014fe:	68 cc 3d 80 00       	push   $0x803dcc
+  801503:	68 d3 00 00 00       	push   $0xd3
+  801508:	68 5f 3d 80 00       	push   $0x803d5f
+  80150d:	e8 4f ec ff ff       	call   800161 <_panic>
+    panic("sys_page_alloc: %e", error);
+  801512:	50                   	push   %eax
+  801513:	68 85 3d 80 00       	push   $0x803d85
+  801518:	68 da 00 00 00       	push   $0xda
+  80151d:	68 5f 3d 80 00       	push   $0x803d5f
+  801522:	e8 3a ec ff ff       	call   800161 <_panic>
+    panic("sys_env_set_pgfault_upcall: %e", error);
+  801527:	50                   	push   %eax
+  801528:	68 fc 3d 80 00       	push   $0x803dfc
+  80152d:	68 e0 00 00 00       	push   $0xe0
+  801532:	68 5f 3d 80 00       	push   $0x803d5f
+  801537:	e8 25 ec ff ff       	call   800161 <_panic>
+
+0080153c <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  80153c:	55                   	push   %ebp
+  80153d:	89 e5                	mov    %esp,%ebp
+  80153f:	57                   	push   %edi
+  801540:	56                   	push   %esi
+  801541:	53                   	push   %ebx
+  801542:	83 ec 14             	sub    $0x14,%esp
+  801545:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801548:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80154b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80154e:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  801551:	85 c0                	test   %eax,%eax
+  801553:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  801558:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  80155b:	ff 33                	push   (%ebx)
+  80155d:	50                   	push   %eax
+  80155e:	e8 ce f9 ff ff       	call   800f31 <sys_ipc_recv>
+  801563:	83 c4 10             	add    $0x10,%esp
+  801566:	85 c0                	test   %eax,%eax
+  801568:	78 39                	js     8015a3 <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  80156a:	85 ff                	test   %edi,%edi
+  80156c:	74 0a                	je     801578 <ipc_recv_pages+0x3c>
+  80156e:	a1 a0 58 80 00       	mov    0x8058a0,%eax
+  801573:	8b 40 7c             	mov    0x7c(%eax),%eax
+  801576:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  801578:	85 f6                	test   %esi,%esi
+  80157a:	74 0d                	je     801589 <ipc_recv_pages+0x4d>
+  80157c:	a1 a0 58 80 00       	mov    0x8058a0,%eax
+  801581:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  801587:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  801589:	a1 a0 58 80 00       	mov    0x8058a0,%eax
+  80158e:	8b 40 74             	mov    0x74(%eax),%eax
+  801591:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  801593:	a1 a0 58 80 00       	mov    0x8058a0,%eax
+  801598:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  80159b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80159e:	5b                   	pop    %ebx
+  80159f:	5e                   	pop    %esi
+  8015a0:	5f                   	pop    %edi
+  8015a1:	5d                   	pop    %ebp
+  8015a2:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  8015a3:	85 ff                	test   %edi,%edi
+  8015a5:	74 06                	je     8015ad <ipc_recv_pages+0x71>
+  8015a7:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  8015ad:	85 f6                	test   %esi,%esi
+  8015af:	74 06                	je     8015b7 <ipc_recv_pages+0x7b>
+  8015b1:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  8015b7:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  8015bd:	eb dc                	jmp    80159b <ipc_recv_pages+0x5f>
+
+008015bf <ipc_recv>:
+{
+  8015bf:	55                   	push   %ebp
+  8015c0:	89 e5                	mov    %esp,%ebp
+  8015c2:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  8015c5:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  8015cc:	ff 75 10             	push   0x10(%ebp)
+  8015cf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015d2:	50                   	push   %eax
+  8015d3:	ff 75 0c             	push   0xc(%ebp)
+  8015d6:	ff 75 08             	push   0x8(%ebp)
+  8015d9:	e8 5e ff ff ff       	call   80153c <ipc_recv_pages>
+}
+  8015de:	c9                   	leave
+  8015df:	c3                   	ret
+
+008015e0 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  8015e0:	55                   	push   %ebp
+  8015e1:	89 e5                	mov    %esp,%ebp
+  8015e3:	57                   	push   %edi
+  8015e4:	56                   	push   %esi
+  8015e5:	53                   	push   %ebx
+  8015e6:	83 ec 0c             	sub    $0xc,%esp
+  8015e9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8015ec:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8015ef:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  8015f2:	89 c3                	mov    %eax,%ebx
+  8015f4:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  8015fa:	85 c0                	test   %eax,%eax
+  8015fc:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801601:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  801604:	83 ec 0c             	sub    $0xc,%esp
+  801607:	ff 75 14             	push   0x14(%ebp)
+  80160a:	ff 75 18             	push   0x18(%ebp)
+  80160d:	53                   	push   %ebx
+  80160e:	56                   	push   %esi
+  80160f:	57                   	push   %edi
+  801610:	e8 fb f8 ff ff       	call   800f10 <sys_ipc_try_send>
+  801615:	83 c4 20             	add    $0x20,%esp
+  801618:	85 c0                	test   %eax,%eax
+  80161a:	79 1e                	jns    80163a <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  80161c:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80161f:	75 07                	jne    801628 <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  801621:	e8 d1 f5 ff ff       	call   800bf7 <sys_yield>
+  801626:	eb dc                	jmp    801604 <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  801628:	50                   	push   %eax
+  801629:	68 1b 3e 80 00       	push   $0x803e1b
+  80162e:	6a 5c                	push   $0x5c
+  801630:	68 28 3e 80 00       	push   $0x803e28
+  801635:	e8 27 eb ff ff       	call   800161 <_panic>
+  }
+}
+  80163a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80163d:	5b                   	pop    %ebx
+  80163e:	5e                   	pop    %esi
+  80163f:	5f                   	pop    %edi
+  801640:	5d                   	pop    %ebp
+  801641:	c3                   	ret
+
+00801642 <ipc_send>:
+{
+  801642:	55                   	push   %ebp
+  801643:	89 e5                	mov    %esp,%ebp
+  801645:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  801648:	ff 75 14             	push   0x14(%ebp)
+  80164b:	6a 01                	push   $0x1
+  80164d:	ff 75 10             	push   0x10(%ebp)
+  801650:	ff 75 0c             	push   0xc(%ebp)
+  801653:	ff 75 08             	push   0x8(%ebp)
+  801656:	e8 85 ff ff ff       	call   8015e0 <ipc_send_pages>
+}
+  80165b:	83 c4 20             	add    $0x20,%esp
+  80165e:	c9                   	leave
+  80165f:	c3                   	ret
+
+00801660 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  801660:	55                   	push   %ebp
+  801661:	89 e5                	mov    %esp,%ebp
+  801663:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  801666:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  80166b:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80166e:	c1 e0 04             	shl    $0x4,%eax
+  801671:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801676:	8b 40 50             	mov    0x50(%eax),%eax
+  801679:	39 c8                	cmp    %ecx,%eax
+  80167b:	74 12                	je     80168f <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  80167d:	83 c2 01             	add    $0x1,%edx
+  801680:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  801686:	75 e3                	jne    80166b <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  801688:	b8 00 00 00 00       	mov    $0x0,%eax
+  80168d:	eb 0e                	jmp    80169d <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  80168f:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  801692:	c1 e0 04             	shl    $0x4,%eax
+  801695:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80169a:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  80169d:	5d                   	pop    %ebp
+  80169e:	c3                   	ret
+
+0080169f <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80169f:	55                   	push   %ebp
+  8016a0:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8016a2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016a5:	05 00 00 00 30       	add    $0x30000000,%eax
+  8016aa:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8016ad:	5d                   	pop    %ebp
+  8016ae:	c3                   	ret
+
+008016af <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8016af:	55                   	push   %ebp
+  8016b0:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8016b2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8016b5:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  8016b8:	66 b8 00 00          	mov    $0x0,%ax
+  8016bc:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8016c1:	5d                   	pop    %ebp
+  8016c2:	c3                   	ret
+
+008016c3 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8016c3:	55                   	push   %ebp
+  8016c4:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  8016c6:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8016cb:	eb 02                	jmp    8016cf <fd_alloc+0xc>
+  8016cd:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8016cf:	89 c2                	mov    %eax,%edx
+  8016d1:	c1 ea 16             	shr    $0x16,%edx
+  8016d4:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8016db:	f6 c2 01             	test   $0x1,%dl
+  8016de:	74 2b                	je     80170b <fd_alloc+0x48>
+  8016e0:	89 c2                	mov    %eax,%edx
+  8016e2:	c1 ea 0c             	shr    $0xc,%edx
+  8016e5:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8016ec:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8016f2:	f6 c1 01             	test   $0x1,%cl
+  8016f5:	74 14                	je     80170b <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  8016f7:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8016fd:	75 ce                	jne    8016cd <fd_alloc+0xa>
+  8016ff:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  801704:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801709:	eb 05                	jmp    801710 <fd_alloc+0x4d>
+      return 0;
+  80170b:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  801710:	8b 55 08             	mov    0x8(%ebp),%edx
+  801713:	89 02                	mov    %eax,(%edx)
+}
+  801715:	89 c8                	mov    %ecx,%eax
+  801717:	5d                   	pop    %ebp
+  801718:	c3                   	ret
+
+00801719 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801719:	55                   	push   %ebp
+  80171a:	89 e5                	mov    %esp,%ebp
+  80171c:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  80171f:	83 f8 1f             	cmp    $0x1f,%eax
+  801722:	77 30                	ja     801754 <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  801724:	c1 e0 0c             	shl    $0xc,%eax
+  801727:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80172c:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801732:	f6 c2 01             	test   $0x1,%dl
+  801735:	74 24                	je     80175b <fd_lookup+0x42>
+  801737:	89 c2                	mov    %eax,%edx
+  801739:	c1 ea 0c             	shr    $0xc,%edx
+  80173c:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801743:	f6 c2 01             	test   $0x1,%dl
+  801746:	74 1a                	je     801762 <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  801748:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80174b:	89 02                	mov    %eax,(%edx)
+  return 0;
+  80174d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801752:	5d                   	pop    %ebp
+  801753:	c3                   	ret
+    return -E_INVAL;
+  801754:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801759:	eb f7                	jmp    801752 <fd_lookup+0x39>
+    return -E_INVAL;
+  80175b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801760:	eb f0                	jmp    801752 <fd_lookup+0x39>
+  801762:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801767:	eb e9                	jmp    801752 <fd_lookup+0x39>
+
+00801769 <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801769:	55                   	push   %ebp
+  80176a:	89 e5                	mov    %esp,%ebp
+  80176c:	53                   	push   %ebx
+  80176d:	83 ec 04             	sub    $0x4,%esp
+  801770:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  801773:	b8 b0 3e 80 00       	mov    $0x803eb0,%eax
+  801778:	8b 18                	mov    (%eax),%ebx
+  80177a:	85 db                	test   %ebx,%ebx
+  80177c:	74 0e                	je     80178c <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  80177e:	83 c0 04             	add    $0x4,%eax
+  801781:	39 13                	cmp    %edx,(%ebx)
+  801783:	75 f3                	jne    801778 <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  801785:	b8 00 00 00 00       	mov    $0x0,%eax
+  80178a:	eb 1f                	jmp    8017ab <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80178c:	a1 a0 58 80 00       	mov    0x8058a0,%eax
+  801791:	8b 40 48             	mov    0x48(%eax),%eax
+  801794:	83 ec 04             	sub    $0x4,%esp
+  801797:	52                   	push   %edx
+  801798:	50                   	push   %eax
+  801799:	68 34 3e 80 00       	push   $0x803e34
+  80179e:	e8 99 ea ff ff       	call   80023c <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  8017a3:	83 c4 10             	add    $0x10,%esp
+  8017a6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  8017ab:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8017ae:	89 1a                	mov    %ebx,(%edx)
+}
+  8017b0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017b3:	c9                   	leave
+  8017b4:	c3                   	ret
+
+008017b5 <fd_close>:
+{
+  8017b5:	55                   	push   %ebp
+  8017b6:	89 e5                	mov    %esp,%ebp
+  8017b8:	57                   	push   %edi
+  8017b9:	56                   	push   %esi
+  8017ba:	53                   	push   %ebx
+  8017bb:	83 ec 24             	sub    $0x24,%esp
+  8017be:	8b 75 08             	mov    0x8(%ebp),%esi
+  8017c1:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8017c4:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8017c7:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8017c8:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8017ce:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8017d1:	50                   	push   %eax
+  8017d2:	e8 42 ff ff ff       	call   801719 <fd_lookup>
+  8017d7:	89 c3                	mov    %eax,%ebx
+  8017d9:	83 c4 10             	add    $0x10,%esp
+  8017dc:	85 c0                	test   %eax,%eax
+  8017de:	78 05                	js     8017e5 <fd_close+0x30>
+      || fd != fd2)
+  8017e0:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8017e3:	74 16                	je     8017fb <fd_close+0x46>
+    return must_exist ? r : 0;
+  8017e5:	89 f8                	mov    %edi,%eax
+  8017e7:	84 c0                	test   %al,%al
+  8017e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017ee:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8017f1:	89 d8                	mov    %ebx,%eax
+  8017f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017f6:	5b                   	pop    %ebx
+  8017f7:	5e                   	pop    %esi
+  8017f8:	5f                   	pop    %edi
+  8017f9:	5d                   	pop    %ebp
+  8017fa:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8017fb:	83 ec 08             	sub    $0x8,%esp
+  8017fe:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801801:	50                   	push   %eax
+  801802:	ff 36                	push   (%esi)
+  801804:	e8 60 ff ff ff       	call   801769 <dev_lookup>
+  801809:	89 c3                	mov    %eax,%ebx
+  80180b:	83 c4 10             	add    $0x10,%esp
+  80180e:	85 c0                	test   %eax,%eax
+  801810:	78 1a                	js     80182c <fd_close+0x77>
+    if (dev->dev_close)
+  801812:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801815:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  801818:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  80181d:	85 c0                	test   %eax,%eax
+  80181f:	74 0b                	je     80182c <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  801821:	83 ec 0c             	sub    $0xc,%esp
+  801824:	56                   	push   %esi
+  801825:	ff d0                	call   *%eax
+  801827:	89 c3                	mov    %eax,%ebx
+  801829:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  80182c:	83 ec 08             	sub    $0x8,%esp
+  80182f:	56                   	push   %esi
+  801830:	6a 00                	push   $0x0
+  801832:	e8 a7 f4 ff ff       	call   800cde <sys_page_unmap>
+  return r;
+  801837:	83 c4 10             	add    $0x10,%esp
+  80183a:	eb b5                	jmp    8017f1 <fd_close+0x3c>
+
+0080183c <close>:
+
+int
+close(int fdnum)
+{
+  80183c:	55                   	push   %ebp
+  80183d:	89 e5                	mov    %esp,%ebp
+  80183f:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801842:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801845:	50                   	push   %eax
+  801846:	ff 75 08             	push   0x8(%ebp)
+  801849:	e8 cb fe ff ff       	call   801719 <fd_lookup>
+  80184e:	83 c4 10             	add    $0x10,%esp
+  801851:	85 c0                	test   %eax,%eax
+  801853:	79 02                	jns    801857 <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  801855:	c9                   	leave
+  801856:	c3                   	ret
+    return fd_close(fd, 1);
+  801857:	83 ec 08             	sub    $0x8,%esp
+  80185a:	6a 01                	push   $0x1
+  80185c:	ff 75 f4             	push   -0xc(%ebp)
+  80185f:	e8 51 ff ff ff       	call   8017b5 <fd_close>
+  801864:	83 c4 10             	add    $0x10,%esp
+  801867:	eb ec                	jmp    801855 <close+0x19>
+
+00801869 <close_all>:
+
+void
+close_all(void)
+{
+  801869:	55                   	push   %ebp
+  80186a:	89 e5                	mov    %esp,%ebp
+  80186c:	53                   	push   %ebx
+  80186d:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  801870:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  801875:	83 ec 0c             	sub    $0xc,%esp
+  801878:	53                   	push   %ebx
+  801879:	e8 be ff ff ff       	call   80183c <close>
+  for (i = 0; i < MAXFD; i++)
+  80187e:	83 c3 01             	add    $0x1,%ebx
+  801881:	83 c4 10             	add    $0x10,%esp
+  801884:	83 fb 20             	cmp    $0x20,%ebx
+  801887:	75 ec                	jne    801875 <close_all+0xc>
+}
+  801889:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80188c:	c9                   	leave
+  80188d:	c3                   	ret
+
+0080188e <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80188e:	55                   	push   %ebp
+  80188f:	89 e5                	mov    %esp,%ebp
+  801891:	57                   	push   %edi
+  801892:	56                   	push   %esi
+  801893:	53                   	push   %ebx
+  801894:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801897:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80189a:	50                   	push   %eax
+  80189b:	ff 75 08             	push   0x8(%ebp)
+  80189e:	e8 76 fe ff ff       	call   801719 <fd_lookup>
+  8018a3:	89 c6                	mov    %eax,%esi
+  8018a5:	83 c4 10             	add    $0x10,%esp
+  8018a8:	85 c0                	test   %eax,%eax
+  8018aa:	0f 88 0a 01 00 00    	js     8019ba <dup+0x12c>
+    return r;
+  close(newfdnum);
+  8018b0:	83 ec 0c             	sub    $0xc,%esp
+  8018b3:	ff 75 0c             	push   0xc(%ebp)
+  8018b6:	e8 81 ff ff ff       	call   80183c <close>
+
+  newfd = INDEX2FD(newfdnum);
+  8018bb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8018be:	c1 e0 0c             	shl    $0xc,%eax
+  8018c1:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  8018c7:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  8018ca:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8018cd:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8018d0:	89 04 24             	mov    %eax,(%esp)
+  8018d3:	e8 d7 fd ff ff       	call   8016af <fd2data>
+  8018d8:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  8018da:	89 3c 24             	mov    %edi,(%esp)
+  8018dd:	e8 cd fd ff ff       	call   8016af <fd2data>
+  8018e2:	83 c4 10             	add    $0x10,%esp
+  8018e5:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8018e8:	89 f3                	mov    %esi,%ebx
+  8018ea:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  8018f0:	89 c6                	mov    %eax,%esi
+  8018f2:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8018f5:	89 cf                	mov    %ecx,%edi
+  8018f7:	eb 0c                	jmp    801905 <dup+0x77>
+  8018f9:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8018ff:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801905:	39 fb                	cmp    %edi,%ebx
+  801907:	74 7b                	je     801984 <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  801909:	89 d8                	mov    %ebx,%eax
+  80190b:	c1 e8 16             	shr    $0x16,%eax
+  80190e:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801915:	a8 01                	test   $0x1,%al
+  801917:	74 e0                	je     8018f9 <dup+0x6b>
+  801919:	89 d8                	mov    %ebx,%eax
+  80191b:	c1 e8 0c             	shr    $0xc,%eax
+  80191e:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801925:	f6 c2 01             	test   $0x1,%dl
+  801928:	74 cf                	je     8018f9 <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  80192a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  801931:	83 ec 0c             	sub    $0xc,%esp
+  801934:	25 07 0e 00 00       	and    $0xe07,%eax
+  801939:	50                   	push   %eax
+  80193a:	56                   	push   %esi
+  80193b:	6a 00                	push   $0x0
+  80193d:	53                   	push   %ebx
+  80193e:	6a 00                	push   $0x0
+  801940:	e8 57 f3 ff ff       	call   800c9c <sys_page_map>
+  801945:	83 c4 20             	add    $0x20,%esp
+  801948:	85 c0                	test   %eax,%eax
+  80194a:	79 ad                	jns    8018f9 <dup+0x6b>
+  80194c:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80194f:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  801951:	83 ec 08             	sub    $0x8,%esp
+  801954:	ff 75 d4             	push   -0x2c(%ebp)
+  801957:	6a 00                	push   $0x0
+  801959:	e8 80 f3 ff ff       	call   800cde <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80195e:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  801961:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  801967:	83 c4 10             	add    $0x10,%esp
+  80196a:	39 df                	cmp    %ebx,%edi
+  80196c:	74 4c                	je     8019ba <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  80196e:	83 ec 08             	sub    $0x8,%esp
+  801971:	57                   	push   %edi
+  801972:	6a 00                	push   $0x0
+  801974:	e8 65 f3 ff ff       	call   800cde <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801979:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  80197f:	83 c4 10             	add    $0x10,%esp
+  801982:	eb e6                	jmp    80196a <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801984:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801987:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80198a:	89 c8                	mov    %ecx,%eax
+  80198c:	c1 e8 0c             	shr    $0xc,%eax
+  80198f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801996:	83 ec 0c             	sub    $0xc,%esp
+  801999:	25 07 0e 00 00       	and    $0xe07,%eax
+  80199e:	50                   	push   %eax
+  80199f:	ff 75 d4             	push   -0x2c(%ebp)
+  8019a2:	6a 00                	push   $0x0
+  8019a4:	51                   	push   %ecx
+  8019a5:	6a 00                	push   $0x0
+  8019a7:	e8 f0 f2 ff ff       	call   800c9c <sys_page_map>
+  8019ac:	89 c6                	mov    %eax,%esi
+  8019ae:	83 c4 20             	add    $0x20,%esp
+  8019b1:	85 c0                	test   %eax,%eax
+  8019b3:	78 9c                	js     801951 <dup+0xc3>
+  return newfdnum;
+  8019b5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8019b8:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  8019ba:	89 f0                	mov    %esi,%eax
+  8019bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019bf:	5b                   	pop    %ebx
+  8019c0:	5e                   	pop    %esi
+  8019c1:	5f                   	pop    %edi
+  8019c2:	5d                   	pop    %ebp
+  8019c3:	c3                   	ret
+
+008019c4 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8019c4:	55                   	push   %ebp
+  8019c5:	89 e5                	mov    %esp,%ebp
+  8019c7:	56                   	push   %esi
+  8019c8:	53                   	push   %ebx
+  8019c9:	83 ec 18             	sub    $0x18,%esp
+  8019cc:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  8019cf:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8019d2:	50                   	push   %eax
+  8019d3:	56                   	push   %esi
+  8019d4:	e8 40 fd ff ff       	call   801719 <fd_lookup>
+  8019d9:	83 c4 10             	add    $0x10,%esp
+  8019dc:	85 c0                	test   %eax,%eax
+  8019de:	78 3c                	js     801a1c <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8019e0:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8019e3:	83 ec 08             	sub    $0x8,%esp
+  8019e6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019e9:	50                   	push   %eax
+  8019ea:	ff 33                	push   (%ebx)
+  8019ec:	e8 78 fd ff ff       	call   801769 <dev_lookup>
+  8019f1:	83 c4 10             	add    $0x10,%esp
+  8019f4:	85 c0                	test   %eax,%eax
+  8019f6:	78 24                	js     801a1c <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8019f8:	8b 43 08             	mov    0x8(%ebx),%eax
+  8019fb:	83 e0 03             	and    $0x3,%eax
+  8019fe:	83 f8 01             	cmp    $0x1,%eax
+  801a01:	74 20                	je     801a23 <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  801a03:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a06:	8b 40 08             	mov    0x8(%eax),%eax
+  801a09:	85 c0                	test   %eax,%eax
+  801a0b:	74 37                	je     801a44 <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  801a0d:	83 ec 04             	sub    $0x4,%esp
+  801a10:	ff 75 10             	push   0x10(%ebp)
+  801a13:	ff 75 0c             	push   0xc(%ebp)
+  801a16:	53                   	push   %ebx
+  801a17:	ff d0                	call   *%eax
+  801a19:	83 c4 10             	add    $0x10,%esp
+}
+  801a1c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a1f:	5b                   	pop    %ebx
+  801a20:	5e                   	pop    %esi
+  801a21:	5d                   	pop    %ebp
+  801a22:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801a23:	a1 a0 58 80 00       	mov    0x8058a0,%eax
+  801a28:	8b 40 48             	mov    0x48(%eax),%eax
+  801a2b:	83 ec 04             	sub    $0x4,%esp
+  801a2e:	56                   	push   %esi
+  801a2f:	50                   	push   %eax
+  801a30:	68 75 3e 80 00       	push   $0x803e75
+  801a35:	e8 02 e8 ff ff       	call   80023c <cprintf>
+    return -E_INVAL;
+  801a3a:	83 c4 10             	add    $0x10,%esp
+  801a3d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a42:	eb d8                	jmp    801a1c <read+0x58>
+    return -E_NOT_SUPP;
+  801a44:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a49:	eb d1                	jmp    801a1c <read+0x58>
+
+00801a4b <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801a4b:	55                   	push   %ebp
+  801a4c:	89 e5                	mov    %esp,%ebp
+  801a4e:	57                   	push   %edi
+  801a4f:	56                   	push   %esi
+  801a50:	53                   	push   %ebx
+  801a51:	83 ec 0c             	sub    $0xc,%esp
+  801a54:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801a57:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  801a5a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a5f:	eb 02                	jmp    801a63 <readn+0x18>
+  801a61:	01 c3                	add    %eax,%ebx
+  801a63:	39 f3                	cmp    %esi,%ebx
+  801a65:	73 21                	jae    801a88 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  801a67:	83 ec 04             	sub    $0x4,%esp
+  801a6a:	89 f0                	mov    %esi,%eax
+  801a6c:	29 d8                	sub    %ebx,%eax
+  801a6e:	50                   	push   %eax
+  801a6f:	89 d8                	mov    %ebx,%eax
+  801a71:	03 45 0c             	add    0xc(%ebp),%eax
+  801a74:	50                   	push   %eax
+  801a75:	57                   	push   %edi
+  801a76:	e8 49 ff ff ff       	call   8019c4 <read>
+    if (m < 0)
+  801a7b:	83 c4 10             	add    $0x10,%esp
+  801a7e:	85 c0                	test   %eax,%eax
+  801a80:	78 04                	js     801a86 <readn+0x3b>
+      return m;
+    if (m == 0)
+  801a82:	75 dd                	jne    801a61 <readn+0x16>
+  801a84:	eb 02                	jmp    801a88 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  801a86:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  801a88:	89 d8                	mov    %ebx,%eax
+  801a8a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a8d:	5b                   	pop    %ebx
+  801a8e:	5e                   	pop    %esi
+  801a8f:	5f                   	pop    %edi
+  801a90:	5d                   	pop    %ebp
+  801a91:	c3                   	ret
+
+00801a92 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801a92:	55                   	push   %ebp
+  801a93:	89 e5                	mov    %esp,%ebp
+  801a95:	56                   	push   %esi
+  801a96:	53                   	push   %ebx
+  801a97:	83 ec 18             	sub    $0x18,%esp
+  801a9a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a9d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801aa0:	50                   	push   %eax
+  801aa1:	53                   	push   %ebx
+  801aa2:	e8 72 fc ff ff       	call   801719 <fd_lookup>
+  801aa7:	83 c4 10             	add    $0x10,%esp
+  801aaa:	85 c0                	test   %eax,%eax
+  801aac:	78 37                	js     801ae5 <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801aae:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801ab1:	83 ec 08             	sub    $0x8,%esp
+  801ab4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ab7:	50                   	push   %eax
+  801ab8:	ff 36                	push   (%esi)
+  801aba:	e8 aa fc ff ff       	call   801769 <dev_lookup>
+  801abf:	83 c4 10             	add    $0x10,%esp
+  801ac2:	85 c0                	test   %eax,%eax
+  801ac4:	78 1f                	js     801ae5 <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ac6:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801aca:	74 20                	je     801aec <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  801acc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801acf:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ad2:	85 c0                	test   %eax,%eax
+  801ad4:	74 37                	je     801b0d <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  801ad6:	83 ec 04             	sub    $0x4,%esp
+  801ad9:	ff 75 10             	push   0x10(%ebp)
+  801adc:	ff 75 0c             	push   0xc(%ebp)
+  801adf:	56                   	push   %esi
+  801ae0:	ff d0                	call   *%eax
+  801ae2:	83 c4 10             	add    $0x10,%esp
+}
+  801ae5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ae8:	5b                   	pop    %ebx
+  801ae9:	5e                   	pop    %esi
+  801aea:	5d                   	pop    %ebp
+  801aeb:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801aec:	a1 a0 58 80 00       	mov    0x8058a0,%eax
+  801af1:	8b 40 48             	mov    0x48(%eax),%eax
+  801af4:	83 ec 04             	sub    $0x4,%esp
+  801af7:	53                   	push   %ebx
+  801af8:	50                   	push   %eax
+  801af9:	68 91 3e 80 00       	push   $0x803e91
+  801afe:	e8 39 e7 ff ff       	call   80023c <cprintf>
+    return -E_INVAL;
+  801b03:	83 c4 10             	add    $0x10,%esp
+  801b06:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b0b:	eb d8                	jmp    801ae5 <write+0x53>
+    return -E_NOT_SUPP;
+  801b0d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b12:	eb d1                	jmp    801ae5 <write+0x53>
+
+00801b14 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801b14:	55                   	push   %ebp
+  801b15:	89 e5                	mov    %esp,%ebp
+  801b17:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801b1a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b1d:	50                   	push   %eax
+  801b1e:	ff 75 08             	push   0x8(%ebp)
+  801b21:	e8 f3 fb ff ff       	call   801719 <fd_lookup>
+  801b26:	83 c4 10             	add    $0x10,%esp
+  801b29:	85 c0                	test   %eax,%eax
+  801b2b:	78 0e                	js     801b3b <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  801b2d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801b30:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b33:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  801b36:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b3b:	c9                   	leave
+  801b3c:	c3                   	ret
+
+00801b3d <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801b3d:	55                   	push   %ebp
+  801b3e:	89 e5                	mov    %esp,%ebp
+  801b40:	56                   	push   %esi
+  801b41:	53                   	push   %ebx
+  801b42:	83 ec 18             	sub    $0x18,%esp
+  801b45:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801b48:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b4b:	50                   	push   %eax
+  801b4c:	53                   	push   %ebx
+  801b4d:	e8 c7 fb ff ff       	call   801719 <fd_lookup>
+  801b52:	83 c4 10             	add    $0x10,%esp
+  801b55:	85 c0                	test   %eax,%eax
+  801b57:	78 34                	js     801b8d <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801b59:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b5c:	83 ec 08             	sub    $0x8,%esp
+  801b5f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b62:	50                   	push   %eax
+  801b63:	ff 36                	push   (%esi)
+  801b65:	e8 ff fb ff ff       	call   801769 <dev_lookup>
+  801b6a:	83 c4 10             	add    $0x10,%esp
+  801b6d:	85 c0                	test   %eax,%eax
+  801b6f:	78 1c                	js     801b8d <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801b71:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801b75:	74 1d                	je     801b94 <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  801b77:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b7a:	8b 40 18             	mov    0x18(%eax),%eax
+  801b7d:	85 c0                	test   %eax,%eax
+  801b7f:	74 34                	je     801bb5 <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  801b81:	83 ec 08             	sub    $0x8,%esp
+  801b84:	ff 75 0c             	push   0xc(%ebp)
+  801b87:	56                   	push   %esi
+  801b88:	ff d0                	call   *%eax
+  801b8a:	83 c4 10             	add    $0x10,%esp
+}
+  801b8d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b90:	5b                   	pop    %ebx
+  801b91:	5e                   	pop    %esi
+  801b92:	5d                   	pop    %ebp
+  801b93:	c3                   	ret
+            thisenv->env_id, fdnum);
+  801b94:	a1 a0 58 80 00       	mov    0x8058a0,%eax
+  801b99:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801b9c:	83 ec 04             	sub    $0x4,%esp
+  801b9f:	53                   	push   %ebx
+  801ba0:	50                   	push   %eax
+  801ba1:	68 54 3e 80 00       	push   $0x803e54
+  801ba6:	e8 91 e6 ff ff       	call   80023c <cprintf>
+    return -E_INVAL;
+  801bab:	83 c4 10             	add    $0x10,%esp
+  801bae:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801bb3:	eb d8                	jmp    801b8d <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  801bb5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801bba:	eb d1                	jmp    801b8d <ftruncate+0x50>
+
+00801bbc <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801bbc:	55                   	push   %ebp
+  801bbd:	89 e5                	mov    %esp,%ebp
+  801bbf:	56                   	push   %esi
+  801bc0:	53                   	push   %ebx
+  801bc1:	83 ec 18             	sub    $0x18,%esp
+  801bc4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801bc7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801bca:	50                   	push   %eax
+  801bcb:	ff 75 08             	push   0x8(%ebp)
+  801bce:	e8 46 fb ff ff       	call   801719 <fd_lookup>
+  801bd3:	83 c4 10             	add    $0x10,%esp
+  801bd6:	85 c0                	test   %eax,%eax
+  801bd8:	78 49                	js     801c23 <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801bda:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801bdd:	83 ec 08             	sub    $0x8,%esp
+  801be0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801be3:	50                   	push   %eax
+  801be4:	ff 36                	push   (%esi)
+  801be6:	e8 7e fb ff ff       	call   801769 <dev_lookup>
+  801beb:	83 c4 10             	add    $0x10,%esp
+  801bee:	85 c0                	test   %eax,%eax
+  801bf0:	78 31                	js     801c23 <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  801bf2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bf5:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801bf9:	74 2f                	je     801c2a <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  801bfb:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  801bfe:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801c05:	00 00 00 
+  stat->st_isdir = 0;
+  801c08:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801c0f:	00 00 00 
+  stat->st_dev = dev;
+  801c12:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  801c18:	83 ec 08             	sub    $0x8,%esp
+  801c1b:	53                   	push   %ebx
+  801c1c:	56                   	push   %esi
+  801c1d:	ff 50 14             	call   *0x14(%eax)
+  801c20:	83 c4 10             	add    $0x10,%esp
+}
+  801c23:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c26:	5b                   	pop    %ebx
+  801c27:	5e                   	pop    %esi
+  801c28:	5d                   	pop    %ebp
+  801c29:	c3                   	ret
+    return -E_NOT_SUPP;
+  801c2a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c2f:	eb f2                	jmp    801c23 <fstat+0x67>
+
+00801c31 <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  801c31:	55                   	push   %ebp
+  801c32:	89 e5                	mov    %esp,%ebp
+  801c34:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  801c37:	ff 75 0c             	push   0xc(%ebp)
+  801c3a:	ff 75 08             	push   0x8(%ebp)
+  801c3d:	e8 58 07 00 00       	call   80239a <file_stat>
+}
+  801c42:	c9                   	leave
+  801c43:	c3                   	ret
+
+00801c44 <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  801c44:	55                   	push   %ebp
+  801c45:	89 e5                	mov    %esp,%ebp
+  801c47:	57                   	push   %edi
+  801c48:	56                   	push   %esi
+  801c49:	53                   	push   %ebx
+  801c4a:	83 ec 1c             	sub    $0x1c,%esp
+  801c4d:	89 c7                	mov    %eax,%edi
+  801c4f:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801c52:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801c55:	e9 a2 00 00 00       	jmp    801cfc <fsipc_send+0xb8>
+  nfsenvs = 0;
+  801c5a:	c7 05 00 50 80 00 00 	movl   $0x0,0x805000
+  801c61:	00 00 00 
+  801c64:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c69:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801c6e:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801c73:	be 01 00 00 00       	mov    $0x1,%esi
+  801c78:	eb 0f                	jmp    801c89 <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801c7a:	83 c0 01             	add    $0x1,%eax
+  801c7d:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801c82:	74 49                	je     801ccd <fsipc_send+0x89>
+  801c84:	83 f9 07             	cmp    $0x7,%ecx
+  801c87:	7f 50                	jg     801cd9 <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  801c89:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801c8c:	c1 e2 04             	shl    $0x4,%edx
+  801c8f:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801c95:	8b 52 50             	mov    0x50(%edx),%edx
+  801c98:	83 fa 01             	cmp    $0x1,%edx
+  801c9b:	75 dd                	jne    801c7a <fsipc_send+0x36>
+  801c9d:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801ca0:	c1 e2 04             	shl    $0x4,%edx
+  801ca3:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801ca9:	8b 52 54             	mov    0x54(%edx),%edx
+  801cac:	85 d2                	test   %edx,%edx
+  801cae:	74 ca                	je     801c7a <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801cb0:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801cb3:	c1 e2 04             	shl    $0x4,%edx
+  801cb6:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801cbc:	8b 52 48             	mov    0x48(%edx),%edx
+  801cbf:	89 14 8d 20 50 80 00 	mov    %edx,0x805020(,%ecx,4)
+  801cc6:	8d 49 01             	lea    0x1(%ecx),%ecx
+  801cc9:	89 f3                	mov    %esi,%ebx
+  801ccb:	eb ad                	jmp    801c7a <fsipc_send+0x36>
+  801ccd:	84 db                	test   %bl,%bl
+  801ccf:	74 38                	je     801d09 <fsipc_send+0xc5>
+  801cd1:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  801cd7:	eb 30                	jmp    801d09 <fsipc_send+0xc5>
+  801cd9:	84 db                	test   %bl,%bl
+  801cdb:	74 2c                	je     801d09 <fsipc_send+0xc5>
+  801cdd:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  801ce3:	eb 24                	jmp    801d09 <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  801ce5:	50                   	push   %eax
+  801ce6:	68 c0 3e 80 00       	push   $0x803ec0
+  801ceb:	6a 34                	push   $0x34
+  801ced:	68 ca 3e 80 00       	push   $0x803eca
+  801cf2:	e8 6a e4 ff ff       	call   800161 <_panic>
+    }
+    sys_yield();
+  801cf7:	e8 fb ee ff ff       	call   800bf7 <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  801cfc:	83 3d 00 50 80 00 03 	cmpl   $0x3,0x805000
+  801d03:	0f 8e 51 ff ff ff    	jle    801c5a <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  801d09:	a1 a0 58 80 00       	mov    0x8058a0,%eax
+  801d0e:	8b 70 48             	mov    0x48(%eax),%esi
+  801d11:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  801d17:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d1c:	8b 0d 00 50 80 00    	mov    0x805000,%ecx
+  801d22:	39 d9                	cmp    %ebx,%ecx
+  801d24:	7e d1                	jle    801cf7 <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  801d26:	83 ec 0c             	sub    $0xc,%esp
+  801d29:	ff 75 e0             	push   -0x20(%ebp)
+  801d2c:	6a 07                	push   $0x7
+  801d2e:	ff 75 e4             	push   -0x1c(%ebp)
+  801d31:	57                   	push   %edi
+  801d32:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  801d35:	99                   	cltd
+  801d36:	f7 f9                	idiv   %ecx
+  801d38:	ff 34 95 20 50 80 00 	push   0x805020(,%edx,4)
+  801d3f:	e8 cc f1 ff ff       	call   800f10 <sys_ipc_try_send>
+      if (r == 0)
+  801d44:	83 c4 20             	add    $0x20,%esp
+  801d47:	85 c0                	test   %eax,%eax
+  801d49:	74 0a                	je     801d55 <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  801d4b:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801d4e:	75 95                	jne    801ce5 <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  801d50:	83 c3 01             	add    $0x1,%ebx
+  801d53:	eb c7                	jmp    801d1c <fsipc_send+0xd8>
+  }
+}
+  801d55:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d58:	5b                   	pop    %ebx
+  801d59:	5e                   	pop    %esi
+  801d5a:	5f                   	pop    %edi
+  801d5b:	5d                   	pop    %ebp
+  801d5c:	c3                   	ret
+
+00801d5d <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801d5d:	55                   	push   %ebp
+  801d5e:	89 e5                	mov    %esp,%ebp
+  801d60:	53                   	push   %ebx
+  801d61:	83 ec 14             	sub    $0x14,%esp
+  801d64:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  801d66:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  801d6d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801d72:	ba 00 60 80 00       	mov    $0x806000,%edx
+  801d77:	e8 c8 fe ff ff       	call   801c44 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801d7c:	6a 00                	push   $0x0
+  801d7e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d81:	50                   	push   %eax
+  801d82:	53                   	push   %ebx
+  801d83:	6a 00                	push   $0x0
+  801d85:	e8 b2 f7 ff ff       	call   80153c <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  801d8a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d8d:	c9                   	leave
+  801d8e:	c3                   	ret
+
+00801d8f <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801d8f:	55                   	push   %ebp
+  801d90:	89 e5                	mov    %esp,%ebp
+  801d92:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801d95:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d98:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d9b:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.set_size.req_size = newsize;
+  801da0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801da3:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801da8:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dad:	b8 02 00 00 00       	mov    $0x2,%eax
+  801db2:	e8 a6 ff ff ff       	call   801d5d <fsipc>
+}
+  801db7:	c9                   	leave
+  801db8:	c3                   	ret
+
+00801db9 <devfile_flush>:
+{
+  801db9:	55                   	push   %ebp
+  801dba:	89 e5                	mov    %esp,%ebp
+  801dbc:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801dbf:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dc2:	8b 40 0c             	mov    0xc(%eax),%eax
+  801dc5:	a3 00 60 80 00       	mov    %eax,0x806000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801dca:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dcf:	b8 06 00 00 00       	mov    $0x6,%eax
+  801dd4:	e8 84 ff ff ff       	call   801d5d <fsipc>
+}
+  801dd9:	c9                   	leave
+  801dda:	c3                   	ret
+
+00801ddb <devfile_stat>:
+{
+  801ddb:	55                   	push   %ebp
+  801ddc:	89 e5                	mov    %esp,%ebp
+  801dde:	53                   	push   %ebx
+  801ddf:	83 ec 04             	sub    $0x4,%esp
+  801de2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801de5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801de8:	8b 40 0c             	mov    0xc(%eax),%eax
+  801deb:	a3 00 60 80 00       	mov    %eax,0x806000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801df0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801df5:	b8 05 00 00 00       	mov    $0x5,%eax
+  801dfa:	e8 5e ff ff ff       	call   801d5d <fsipc>
+  801dff:	85 c0                	test   %eax,%eax
+  801e01:	78 2c                	js     801e2f <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801e03:	83 ec 08             	sub    $0x8,%esp
+  801e06:	68 00 60 80 00       	push   $0x806000
+  801e0b:	53                   	push   %ebx
+  801e0c:	e8 19 ea ff ff       	call   80082a <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  801e11:	a1 80 60 80 00       	mov    0x806080,%eax
+  801e16:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801e1c:	a1 84 60 80 00       	mov    0x806084,%eax
+  801e21:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801e27:	83 c4 10             	add    $0x10,%esp
+  801e2a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e2f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e32:	c9                   	leave
+  801e33:	c3                   	ret
+
+00801e34 <fsv_alloc>:
+{
+  801e34:	55                   	push   %ebp
+  801e35:	89 e5                	mov    %esp,%ebp
+  801e37:	56                   	push   %esi
+  801e38:	53                   	push   %ebx
+  801e39:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  801e3b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e40:	eb 22                	jmp    801e64 <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  801e42:	83 ec 04             	sub    $0x4,%esp
+  801e45:	6a 00                	push   $0x0
+  801e47:	6a 00                	push   $0x0
+  801e49:	6a 07                	push   $0x7
+  801e4b:	50                   	push   %eax
+  801e4c:	6a 00                	push   $0x0
+  801e4e:	6a 04                	push   $0x4
+  801e50:	68 40 50 80 00       	push   $0x805040
+  801e55:	e8 52 f2 ff ff       	call   8010ac <sysbatch_add>
+  801e5a:	83 c4 20             	add    $0x20,%esp
+  801e5d:	85 c0                	test   %eax,%eax
+  801e5f:	78 48                	js     801ea9 <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  801e61:	83 c3 01             	add    $0x1,%ebx
+  801e64:	39 f3                	cmp    %esi,%ebx
+  801e66:	74 31                	je     801e99 <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  801e68:	89 d8                	mov    %ebx,%eax
+  801e6a:	c1 e0 0c             	shl    $0xc,%eax
+  801e6d:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801e72:	89 c2                	mov    %eax,%edx
+  801e74:	c1 ea 16             	shr    $0x16,%edx
+  801e77:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801e7e:	f6 c2 01             	test   $0x1,%dl
+  801e81:	74 bf                	je     801e42 <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  801e83:	89 c2                	mov    %eax,%edx
+  801e85:	c1 ea 0c             	shr    $0xc,%edx
+  801e88:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801e8f:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801e92:	83 fa 03             	cmp    $0x3,%edx
+  801e95:	75 ab                	jne    801e42 <fsv_alloc+0xe>
+  801e97:	eb c8                	jmp    801e61 <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  801e99:	83 ec 0c             	sub    $0xc,%esp
+  801e9c:	68 40 50 80 00       	push   $0x805040
+  801ea1:	e8 b6 f1 ff ff       	call   80105c <sysbatch_flush>
+  801ea6:	83 c4 10             	add    $0x10,%esp
+}
+  801ea9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801eac:	5b                   	pop    %ebx
+  801ead:	5e                   	pop    %esi
+  801eae:	5d                   	pop    %ebp
+  801eaf:	c3                   	ret
+
+00801eb0 <devfile_read>:
+{
+  801eb0:	55                   	push   %ebp
+  801eb1:	89 e5                	mov    %esp,%ebp
+  801eb3:	57                   	push   %edi
+  801eb4:	56                   	push   %esi
+  801eb5:	53                   	push   %ebx
+  801eb6:	83 ec 3c             	sub    $0x3c,%esp
+  801eb9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  801ebc:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  801ec2:	77 57                	ja     801f1b <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801ec4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ec7:	8b 40 0c             	mov    0xc(%eax),%eax
+  801eca:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read.req_n = n;
+  801ecf:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801ed5:	ba 00 00 00 00       	mov    $0x0,%edx
+  801eda:	b8 03 00 00 00       	mov    $0x3,%eax
+  801edf:	e8 79 fe ff ff       	call   801d5d <fsipc>
+  801ee4:	89 c6                	mov    %eax,%esi
+  801ee6:	85 c0                	test   %eax,%eax
+  801ee8:	78 27                	js     801f11 <devfile_read+0x61>
+  assert(r <= n);
+  801eea:	39 c3                	cmp    %eax,%ebx
+  801eec:	0f 82 0e 02 00 00    	jb     802100 <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  801ef2:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801ef7:	0f 8f 1c 02 00 00    	jg     802119 <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801efd:	83 ec 04             	sub    $0x4,%esp
+  801f00:	50                   	push   %eax
+  801f01:	68 00 60 80 00       	push   $0x806000
+  801f06:	ff 75 0c             	push   0xc(%ebp)
+  801f09:	e8 a2 ea ff ff       	call   8009b0 <memmove>
+  return r;
+  801f0e:	83 c4 10             	add    $0x10,%esp
+}
+  801f11:	89 f0                	mov    %esi,%eax
+  801f13:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f16:	5b                   	pop    %ebx
+  801f17:	5e                   	pop    %esi
+  801f18:	5f                   	pop    %edi
+  801f19:	5d                   	pop    %ebp
+  801f1a:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  801f1b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f20:	e8 0f ff ff ff       	call   801e34 <fsv_alloc>
+  801f25:	89 c6                	mov    %eax,%esi
+  801f27:	85 c0                	test   %eax,%eax
+  801f29:	78 e6                	js     801f11 <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  801f2b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f2e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f31:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  801f36:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f39:	8b 40 04             	mov    0x4(%eax),%eax
+  801f3c:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  801f41:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  801f47:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801f4e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801f53:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801f58:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801f5d:	e8 e2 fc ff ff       	call   801c44 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801f62:	6a 00                	push   $0x0
+  801f64:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801f67:	50                   	push   %eax
+  801f68:	68 00 10 c0 9f       	push   $0x9fc01000
+  801f6d:	6a 00                	push   $0x0
+  801f6f:	e8 c8 f5 ff ff       	call   80153c <ipc_recv_pages>
+  801f74:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  801f76:	83 c4 10             	add    $0x10,%esp
+  801f79:	85 c0                	test   %eax,%eax
+  801f7b:	7e 94                	jle    801f11 <devfile_read+0x61>
+  assert(r <= n);
+  801f7d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801f80:	39 c3                	cmp    %eax,%ebx
+  801f82:	72 2e                	jb     801fb2 <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801f84:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f87:	8b 40 04             	mov    0x4(%eax),%eax
+  801f8a:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801f8f:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  801f92:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801f95:	c1 e2 0c             	shl    $0xc,%edx
+  801f98:	39 ca                	cmp    %ecx,%edx
+  801f9a:	72 2f                	jb     801fcb <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  801f9c:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  801fa1:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  801fa4:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  801fa8:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801fad:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  801fb0:	eb 52                	jmp    802004 <devfile_read+0x154>
+  assert(r <= n);
+  801fb2:	68 d5 3e 80 00       	push   $0x803ed5
+  801fb7:	68 dc 3e 80 00       	push   $0x803edc
+  801fbc:	68 49 01 00 00       	push   $0x149
+  801fc1:	68 ca 3e 80 00       	push   $0x803eca
+  801fc6:	e8 96 e1 ff ff       	call   800161 <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801fcb:	68 00 3f 80 00       	push   $0x803f00
+  801fd0:	68 dc 3e 80 00       	push   $0x803edc
+  801fd5:	68 4a 01 00 00       	push   $0x14a
+  801fda:	68 ca 3e 80 00       	push   $0x803eca
+  801fdf:	e8 7d e1 ff ff       	call   800161 <_panic>
+      memmove(dst + done, src + done, m);
+  801fe4:	83 ec 04             	sub    $0x4,%esp
+  801fe7:	53                   	push   %ebx
+  801fe8:	56                   	push   %esi
+  801fe9:	89 f8                	mov    %edi,%eax
+  801feb:	03 45 0c             	add    0xc(%ebp),%eax
+  801fee:	50                   	push   %eax
+  801fef:	e8 bc e9 ff ff       	call   8009b0 <memmove>
+  801ff4:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  801ff7:	01 df                	add    %ebx,%edi
+  801ff9:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801ffc:	39 c7                	cmp    %eax,%edi
+  801ffe:	0f 83 c0 00 00 00    	jae    8020c4 <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  802004:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802007:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  80200a:	89 f0                	mov    %esi,%eax
+  80200c:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802011:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  802016:	29 c3                	sub    %eax,%ebx
+  802018:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80201b:	29 f8                	sub    %edi,%eax
+  80201d:	39 c3                	cmp    %eax,%ebx
+  80201f:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  802022:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  802028:	75 ba                	jne    801fe4 <devfile_read+0x134>
+  80202a:	89 f9                	mov    %edi,%ecx
+  80202c:	03 4d 0c             	add    0xc(%ebp),%ecx
+  80202f:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  802032:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  802038:	75 aa                	jne    801fe4 <devfile_read+0x134>
+  80203a:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  802040:	77 a2                	ja     801fe4 <devfile_read+0x134>
+  802042:	89 c8                	mov    %ecx,%eax
+  802044:	c1 e8 16             	shr    $0x16,%eax
+  802047:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80204e:	a8 01                	test   $0x1,%al
+  802050:	74 92                	je     801fe4 <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  802052:	89 c8                	mov    %ecx,%eax
+  802054:	c1 e8 0c             	shr    $0xc,%eax
+  802057:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  80205e:	a8 01                	test   $0x1,%al
+  802060:	74 82                	je     801fe4 <devfile_read+0x134>
+  802062:	a9 02 08 00 00       	test   $0x802,%eax
+  802067:	0f 84 77 ff ff ff    	je     801fe4 <devfile_read+0x134>
+  80206d:	f6 c4 04             	test   $0x4,%ah
+  802070:	0f 85 6e ff ff ff    	jne    801fe4 <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  802076:	a1 a0 58 80 00       	mov    0x8058a0,%eax
+  80207b:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  80207f:	84 c0                	test   %al,%al
+  802081:	75 17                	jne    80209a <devfile_read+0x1ea>
+  802083:	83 ec 08             	sub    $0x8,%esp
+  802086:	6a 01                	push   $0x1
+  802088:	6a 00                	push   $0x0
+  80208a:	e8 87 eb ff ff       	call   800c16 <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  80208f:	83 c4 10             	add    $0x10,%esp
+  802092:	85 c0                	test   %eax,%eax
+  802094:	0f 85 4a ff ff ff    	jne    801fe4 <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  80209a:	83 ec 04             	sub    $0x4,%esp
+  80209d:	68 05 08 00 00       	push   $0x805
+  8020a2:	ff 75 cc             	push   -0x34(%ebp)
+  8020a5:	6a 00                	push   $0x0
+  8020a7:	56                   	push   %esi
+  8020a8:	6a 00                	push   $0x0
+  8020aa:	6a 05                	push   $0x5
+  8020ac:	68 40 50 80 00       	push   $0x805040
+  8020b1:	e8 f6 ef ff ff       	call   8010ac <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  8020b6:	c1 e8 1f             	shr    $0x1f,%eax
+  8020b9:	08 45 cb             	or     %al,-0x35(%ebp)
+  8020bc:	83 c4 20             	add    $0x20,%esp
+  8020bf:	e9 33 ff ff ff       	jmp    801ff7 <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  8020c4:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  8020c7:	83 ec 0c             	sub    $0xc,%esp
+  8020ca:	68 40 50 80 00       	push   $0x805040
+  8020cf:	e8 88 ef ff ff       	call   80105c <sysbatch_flush>
+  8020d4:	83 c4 10             	add    $0x10,%esp
+  8020d7:	85 c0                	test   %eax,%eax
+  8020d9:	78 06                	js     8020e1 <devfile_read+0x231>
+  8020db:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  8020df:	74 14                	je     8020f5 <devfile_read+0x245>
+    memmove(dst, src, r);
+  8020e1:	83 ec 04             	sub    $0x4,%esp
+  8020e4:	ff 75 d4             	push   -0x2c(%ebp)
+  8020e7:	ff 75 d0             	push   -0x30(%ebp)
+  8020ea:	ff 75 0c             	push   0xc(%ebp)
+  8020ed:	e8 be e8 ff ff       	call   8009b0 <memmove>
+  8020f2:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  8020f5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020f8:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  8020fb:	e9 11 fe ff ff       	jmp    801f11 <devfile_read+0x61>
+  assert(r <= n);
+  802100:	68 d5 3e 80 00       	push   $0x803ed5
+  802105:	68 dc 3e 80 00       	push   $0x803edc
+  80210a:	68 1c 01 00 00       	push   $0x11c
+  80210f:	68 ca 3e 80 00       	push   $0x803eca
+  802114:	e8 48 e0 ff ff       	call   800161 <_panic>
+  assert(r <= PGSIZE);
+  802119:	68 f1 3e 80 00       	push   $0x803ef1
+  80211e:	68 dc 3e 80 00       	push   $0x803edc
+  802123:	68 1d 01 00 00       	push   $0x11d
+  802128:	68 ca 3e 80 00       	push   $0x803eca
+  80212d:	e8 2f e0 ff ff       	call   800161 <_panic>
+
+00802132 <devfile_write>:
+{
+  802132:	55                   	push   %ebp
+  802133:	89 e5                	mov    %esp,%ebp
+  802135:	57                   	push   %edi
+  802136:	56                   	push   %esi
+  802137:	53                   	push   %ebx
+  802138:	83 ec 1c             	sub    $0x1c,%esp
+  80213b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80213e:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  802141:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  802146:	77 39                	ja     802181 <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802148:	8b 56 0c             	mov    0xc(%esi),%edx
+  80214b:	89 15 00 60 80 00    	mov    %edx,0x806000
+  fsipcbuf.write.req_n = n;
+  802151:	a3 04 60 80 00       	mov    %eax,0x806004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  802156:	83 ec 04             	sub    $0x4,%esp
+  802159:	50                   	push   %eax
+  80215a:	ff 75 0c             	push   0xc(%ebp)
+  80215d:	68 08 60 80 00       	push   $0x806008
+  802162:	e8 49 e8 ff ff       	call   8009b0 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  802167:	ba 00 00 00 00       	mov    $0x0,%edx
+  80216c:	b8 04 00 00 00       	mov    $0x4,%eax
+  802171:	e8 e7 fb ff ff       	call   801d5d <fsipc>
+  802176:	83 c4 10             	add    $0x10,%esp
+}
+  802179:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80217c:	5b                   	pop    %ebx
+  80217d:	5e                   	pop    %esi
+  80217e:	5f                   	pop    %edi
+  80217f:	5d                   	pop    %ebp
+  802180:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  802181:	ba 00 00 10 00       	mov    $0x100000,%edx
+  802186:	39 d0                	cmp    %edx,%eax
+  802188:	89 d3                	mov    %edx,%ebx
+  80218a:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  80218d:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  802193:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  802196:	83 c7 01             	add    $0x1,%edi
+  802199:	89 f8                	mov    %edi,%eax
+  80219b:	e8 94 fc ff ff       	call   801e34 <fsv_alloc>
+  8021a0:	85 c0                	test   %eax,%eax
+  8021a2:	78 d5                	js     802179 <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  8021a4:	83 ec 04             	sub    $0x4,%esp
+  8021a7:	53                   	push   %ebx
+  8021a8:	ff 75 0c             	push   0xc(%ebp)
+  8021ab:	68 00 10 c0 9f       	push   $0x9fc01000
+  8021b0:	e8 fb e7 ff ff       	call   8009b0 <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  8021b5:	8b 46 0c             	mov    0xc(%esi),%eax
+  8021b8:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  8021bd:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  8021c3:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  8021ca:	89 f9                	mov    %edi,%ecx
+  8021cc:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  8021d1:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8021d6:	e8 69 fa ff ff       	call   801c44 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  8021db:	6a 00                	push   $0x0
+  8021dd:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8021e0:	50                   	push   %eax
+  8021e1:	6a 00                	push   $0x0
+  8021e3:	6a 00                	push   $0x0
+  8021e5:	e8 52 f3 ff ff       	call   80153c <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  8021ea:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  8021ed:	eb 8a                	jmp    802179 <devfile_write+0x47>
+
+008021ef <open>:
+{
+  8021ef:	55                   	push   %ebp
+  8021f0:	89 e5                	mov    %esp,%ebp
+  8021f2:	56                   	push   %esi
+  8021f3:	53                   	push   %ebx
+  8021f4:	83 ec 1c             	sub    $0x1c,%esp
+  8021f7:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  8021fa:	56                   	push   %esi
+  8021fb:	e8 ef e5 ff ff       	call   8007ef <strlen>
+  802200:	83 c4 10             	add    $0x10,%esp
+  802203:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802208:	7f 6c                	jg     802276 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  80220a:	83 ec 0c             	sub    $0xc,%esp
+  80220d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802210:	50                   	push   %eax
+  802211:	e8 ad f4 ff ff       	call   8016c3 <fd_alloc>
+  802216:	89 c3                	mov    %eax,%ebx
+  802218:	83 c4 10             	add    $0x10,%esp
+  80221b:	85 c0                	test   %eax,%eax
+  80221d:	78 3c                	js     80225b <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  80221f:	83 ec 08             	sub    $0x8,%esp
+  802222:	56                   	push   %esi
+  802223:	68 00 60 80 00       	push   $0x806000
+  802228:	e8 fd e5 ff ff       	call   80082a <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  80222d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802230:	a3 00 64 80 00       	mov    %eax,0x806400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802235:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802238:	b8 01 00 00 00       	mov    $0x1,%eax
+  80223d:	e8 1b fb ff ff       	call   801d5d <fsipc>
+  802242:	89 c3                	mov    %eax,%ebx
+  802244:	83 c4 10             	add    $0x10,%esp
+  802247:	85 c0                	test   %eax,%eax
+  802249:	78 19                	js     802264 <open+0x75>
+  return fd2num(fd);
+  80224b:	83 ec 0c             	sub    $0xc,%esp
+  80224e:	ff 75 f4             	push   -0xc(%ebp)
+  802251:	e8 49 f4 ff ff       	call   80169f <fd2num>
+  802256:	89 c3                	mov    %eax,%ebx
+  802258:	83 c4 10             	add    $0x10,%esp
+}
+  80225b:	89 d8                	mov    %ebx,%eax
+  80225d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802260:	5b                   	pop    %ebx
+  802261:	5e                   	pop    %esi
+  802262:	5d                   	pop    %ebp
+  802263:	c3                   	ret
+    fd_close(fd, 0);
+  802264:	83 ec 08             	sub    $0x8,%esp
+  802267:	6a 00                	push   $0x0
+  802269:	ff 75 f4             	push   -0xc(%ebp)
+  80226c:	e8 44 f5 ff ff       	call   8017b5 <fd_close>
+    return r;
+  802271:	83 c4 10             	add    $0x10,%esp
+  802274:	eb e5                	jmp    80225b <open+0x6c>
+    return -E_BAD_PATH;
+  802276:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80227b:	eb de                	jmp    80225b <open+0x6c>
+
+0080227d <open_read>:
+{
+  80227d:	55                   	push   %ebp
+  80227e:	89 e5                	mov    %esp,%ebp
+  802280:	57                   	push   %edi
+  802281:	56                   	push   %esi
+  802282:	53                   	push   %ebx
+  802283:	83 ec 28             	sub    $0x28,%esp
+  802286:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  802289:	57                   	push   %edi
+  80228a:	e8 60 e5 ff ff       	call   8007ef <strlen>
+  80228f:	83 c4 10             	add    $0x10,%esp
+  802292:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802297:	0f 87 f6 00 00 00    	ja     802393 <open_read+0x116>
+  80229d:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  80229f:	83 ec 0c             	sub    $0xc,%esp
+  8022a2:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8022a5:	50                   	push   %eax
+  8022a6:	e8 18 f4 ff ff       	call   8016c3 <fd_alloc>
+  8022ab:	89 c3                	mov    %eax,%ebx
+  8022ad:	83 c4 10             	add    $0x10,%esp
+  8022b0:	85 c0                	test   %eax,%eax
+  8022b2:	0f 88 b2 00 00 00    	js     80236a <open_read+0xed>
+  strcpy(req->req_buf, path);
+  8022b8:	83 ec 08             	sub    $0x8,%esp
+  8022bb:	57                   	push   %edi
+  8022bc:	68 e4 60 80 00       	push   $0x8060e4
+  8022c1:	e8 64 e5 ff ff       	call   80082a <strcpy>
+  req->req_nops = 2;
+  8022c6:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  8022cd:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  8022d0:	c7 05 04 60 80 00 01 	movl   $0x1,0x806004
+  8022d7:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  8022da:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022dd:	a3 10 60 80 00       	mov    %eax,0x806010
+  req->req_ops[0].op_buf = 0;
+  8022e2:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  8022e9:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  8022ec:	c7 05 20 60 80 00 04 	movl   $0x4,0x806020
+  8022f3:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  8022f6:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  8022fd:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  802300:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  802305:	29 f0                	sub    %esi,%eax
+  802307:	3b 45 14             	cmp    0x14(%ebp),%eax
+  80230a:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  80230e:	a3 2c 60 80 00       	mov    %eax,0x80602c
+  req->req_ops[1].op_offset = 0;
+  802313:	c7 05 30 60 80 00 00 	movl   $0x0,0x806030
+  80231a:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  80231d:	83 c6 01             	add    $0x1,%esi
+  802320:	89 35 34 60 80 00    	mov    %esi,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  802326:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802329:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80232e:	e8 2a fa ff ff       	call   801d5d <fsipc>
+  802333:	89 c3                	mov    %eax,%ebx
+  802335:	83 c4 10             	add    $0x10,%esp
+  802338:	83 f8 01             	cmp    $0x1,%eax
+  80233b:	7e 37                	jle    802374 <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  80233d:	a1 38 60 80 00       	mov    0x806038,%eax
+  802342:	8b 55 18             	mov    0x18(%ebp),%edx
+  802345:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  802347:	83 ec 04             	sub    $0x4,%esp
+  80234a:	50                   	push   %eax
+  80234b:	81 c6 e4 60 80 00    	add    $0x8060e4,%esi
+  802351:	56                   	push   %esi
+  802352:	ff 75 10             	push   0x10(%ebp)
+  802355:	e8 56 e6 ff ff       	call   8009b0 <memmove>
+  return fd2num(fd);
+  80235a:	83 c4 04             	add    $0x4,%esp
+  80235d:	ff 75 e4             	push   -0x1c(%ebp)
+  802360:	e8 3a f3 ff ff       	call   80169f <fd2num>
+  802365:	89 c3                	mov    %eax,%ebx
+  802367:	83 c4 10             	add    $0x10,%esp
+}
+  80236a:	89 d8                	mov    %ebx,%eax
+  80236c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80236f:	5b                   	pop    %ebx
+  802370:	5e                   	pop    %esi
+  802371:	5f                   	pop    %edi
+  802372:	5d                   	pop    %ebp
+  802373:	c3                   	ret
+    fd_close(fd, 0);
+  802374:	83 ec 08             	sub    $0x8,%esp
+  802377:	6a 00                	push   $0x0
+  802379:	ff 75 e4             	push   -0x1c(%ebp)
+  80237c:	e8 34 f4 ff ff       	call   8017b5 <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  802381:	83 c4 10             	add    $0x10,%esp
+  802384:	85 db                	test   %ebx,%ebx
+  802386:	78 e2                	js     80236a <open_read+0xed>
+  802388:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  80238b:	8b 9b 1c 60 80 00    	mov    0x80601c(%ebx),%ebx
+  802391:	eb d7                	jmp    80236a <open_read+0xed>
+    return -E_BAD_PATH;
+  802393:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802398:	eb d0                	jmp    80236a <open_read+0xed>
+
+0080239a <file_stat>:
+{
+  80239a:	55                   	push   %ebp
+  80239b:	89 e5                	mov    %esp,%ebp
+  80239d:	57                   	push   %edi
+  80239e:	56                   	push   %esi
+  80239f:	53                   	push   %ebx
+  8023a0:	83 ec 18             	sub    $0x18,%esp
+  8023a3:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8023a6:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  8023a9:	57                   	push   %edi
+  8023aa:	e8 40 e4 ff ff       	call   8007ef <strlen>
+  8023af:	83 c4 10             	add    $0x10,%esp
+  8023b2:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8023b7:	0f 8f c7 00 00 00    	jg     802484 <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  8023bd:	83 ec 0c             	sub    $0xc,%esp
+  8023c0:	57                   	push   %edi
+  8023c1:	e8 29 e4 ff ff       	call   8007ef <strlen>
+  8023c6:	8d 58 04             	lea    0x4(%eax),%ebx
+  8023c9:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  8023cc:	83 c4 08             	add    $0x8,%esp
+  8023cf:	57                   	push   %edi
+  8023d0:	68 e4 60 80 00       	push   $0x8060e4
+  8023d5:	e8 50 e4 ff ff       	call   80082a <strcpy>
+  req->req_nops = 2;
+  8023da:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  8023e1:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  8023e4:	c7 05 04 60 80 00 02 	movl   $0x2,0x806004
+  8023eb:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  8023ee:	c7 05 10 60 80 00 00 	movl   $0x0,0x806010
+  8023f5:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  8023f8:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  8023ff:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  802402:	c7 05 20 60 80 00 03 	movl   $0x3,0x806020
+  802409:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  80240c:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  802413:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  802416:	89 1d 34 60 80 00    	mov    %ebx,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  80241c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802421:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802426:	e8 32 f9 ff ff       	call   801d5d <fsipc>
+  80242b:	83 c4 10             	add    $0x10,%esp
+  80242e:	83 f8 01             	cmp    $0x1,%eax
+  802431:	7e 42                	jle    802475 <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  802433:	81 c3 e4 60 80 00    	add    $0x8060e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  802439:	83 ec 08             	sub    $0x8,%esp
+  80243c:	53                   	push   %ebx
+  80243d:	56                   	push   %esi
+  80243e:	e8 e7 e3 ff ff       	call   80082a <strcpy>
+  st->st_size = ret->ret_size;
+  802443:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  802449:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  80244f:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  802455:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  80245b:	c7 86 88 00 00 00 04 	movl   $0x804004,0x88(%esi)
+  802462:	40 80 00 
+  return 0;
+  802465:	83 c4 10             	add    $0x10,%esp
+  802468:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80246d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802470:	5b                   	pop    %ebx
+  802471:	5e                   	pop    %esi
+  802472:	5f                   	pop    %edi
+  802473:	5d                   	pop    %ebp
+  802474:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  802475:	85 c0                	test   %eax,%eax
+  802477:	78 f4                	js     80246d <file_stat+0xd3>
+  802479:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80247c:	8b 80 1c 60 80 00    	mov    0x80601c(%eax),%eax
+  802482:	eb e9                	jmp    80246d <file_stat+0xd3>
+    return -E_BAD_PATH;
+  802484:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802489:	eb e2                	jmp    80246d <file_stat+0xd3>
+
+0080248b <read_map>:
+{
+  80248b:	55                   	push   %ebp
+  80248c:	89 e5                	mov    %esp,%ebp
+  80248e:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802491:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802494:	50                   	push   %eax
+  802495:	ff 75 08             	push   0x8(%ebp)
+  802498:	e8 7c f2 ff ff       	call   801719 <fd_lookup>
+  80249d:	83 c4 10             	add    $0x10,%esp
+  8024a0:	85 c0                	test   %eax,%eax
+  8024a2:	78 2a                	js     8024ce <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  8024a4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024a7:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  8024ad:	39 08                	cmp    %ecx,(%eax)
+  8024af:	75 1f                	jne    8024d0 <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  8024b1:	8b 40 0c             	mov    0xc(%eax),%eax
+  8024b4:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read_map.req_offset = offset;
+  8024b9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8024bc:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  8024c1:	8b 55 10             	mov    0x10(%ebp),%edx
+  8024c4:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8024c9:	e8 8f f8 ff ff       	call   801d5d <fsipc>
+}
+  8024ce:	c9                   	leave
+  8024cf:	c3                   	ret
+    return -E_INVAL;
+  8024d0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8024d5:	eb f7                	jmp    8024ce <read_map+0x43>
+
+008024d7 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8024d7:	55                   	push   %ebp
+  8024d8:	89 e5                	mov    %esp,%ebp
+  8024da:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  8024dd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024e2:	b8 08 00 00 00       	mov    $0x8,%eax
+  8024e7:	e8 71 f8 ff ff       	call   801d5d <fsipc>
+}
+  8024ec:	c9                   	leave
+  8024ed:	c3                   	ret
+
+008024ee <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  8024ee:	55                   	push   %ebp
+  8024ef:	89 e5                	mov    %esp,%ebp
+  8024f1:	57                   	push   %edi
+  8024f2:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  8024f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024f6:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.stats.req_bio_sched = 0;
+  8024fb:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  802502:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  802505:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  80250c:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  80250f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802514:	b8 09 00 00 00       	mov    $0x9,%eax
+  802519:	e8 3f f8 ff ff       	call   801d5d <fsipc>
+  80251e:	85 c0                	test   %eax,%eax
+  802520:	78 14                	js     802536 <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  802522:	be 00 60 80 00       	mov    $0x806000,%esi
+  802527:	b9 16 00 00 00       	mov    $0x16,%ecx
+  80252c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80252f:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  802531:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802536:	5e                   	pop    %esi
+  802537:	5f                   	pop    %edi
+  802538:	5d                   	pop    %ebp
+  802539:	c3                   	ret
+
+0080253a <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  80253a:	55                   	push   %ebp
+  80253b:	89 e5                	mov    %esp,%ebp
+  80253d:	53                   	push   %ebx
+  80253e:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  802541:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802544:	50                   	push   %eax
+  802545:	6a 00                	push   $0x0
+  802547:	e8 a2 ff ff ff       	call   8024ee <fs_stats>
+  80254c:	83 c4 10             	add    $0x10,%esp
+  80254f:	85 c0                	test   %eax,%eax
+  802551:	78 28                	js     80257b <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  802553:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  802556:	83 ec 08             	sub    $0x8,%esp
+  802559:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  80255c:	50                   	push   %eax
+  80255d:	6a 20                	push   $0x20
+  80255f:	e8 8a ff ff ff       	call   8024ee <fs_stats>
+  802564:	83 c4 10             	add    $0x10,%esp
+  802567:	85 c0                	test   %eax,%eax
+  802569:	78 10                	js     80257b <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  80256b:	83 ec 08             	sub    $0x8,%esp
+  80256e:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802571:	50                   	push   %eax
+  802572:	53                   	push   %ebx
+  802573:	e8 76 ff ff ff       	call   8024ee <fs_stats>
+  802578:	83 c4 10             	add    $0x10,%esp
+}
+  80257b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80257e:	c9                   	leave
+  80257f:	c3                   	ret
+
+00802580 <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  802580:	55                   	push   %ebp
+  802581:	89 e5                	mov    %esp,%ebp
+  802583:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  802586:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  80258d:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  802590:	8b 45 08             	mov    0x8(%ebp),%eax
+  802593:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.stats.req_dcache = 0;
+  802598:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  80259f:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  8025a2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025a7:	b8 09 00 00 00       	mov    $0x9,%eax
+  8025ac:	e8 ac f7 ff ff       	call   801d5d <fsipc>
+}
+  8025b1:	c9                   	leave
+  8025b2:	c3                   	ret
+
+008025b3 <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  8025b3:	55                   	push   %ebp
+  8025b4:	89 e5                	mov    %esp,%ebp
+  8025b6:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  8025b9:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  8025c0:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  8025c3:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  8025ca:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  8025cd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025d0:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_STATS, NULL);
+  8025d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025da:	b8 09 00 00 00       	mov    $0x9,%eax
+  8025df:	e8 79 f7 ff ff       	call   801d5d <fsipc>
+}
+  8025e4:	c9                   	leave
+  8025e5:	c3                   	ret
+
+008025e6 <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  8025e6:	55                   	push   %ebp
+  8025e7:	89 e5                	mov    %esp,%ebp
+  8025e9:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8025ec:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8025ef:	50                   	push   %eax
+  8025f0:	ff 75 08             	push   0x8(%ebp)
+  8025f3:	e8 21 f1 ff ff       	call   801719 <fd_lookup>
+  8025f8:	83 c4 10             	add    $0x10,%esp
+  8025fb:	85 c0                	test   %eax,%eax
+  8025fd:	78 34                	js     802633 <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  8025ff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802602:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  802608:	39 08                	cmp    %ecx,(%eax)
+  80260a:	75 29                	jne    802635 <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  80260c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80260f:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.fallocate.req_offset = offset;
+  802614:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802617:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.fallocate.req_len = len;
+  80261c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80261f:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  802624:	ba 00 00 00 00       	mov    $0x0,%edx
+  802629:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80262e:	e8 2a f7 ff ff       	call   801d5d <fsipc>
+}
+  802633:	c9                   	leave
+  802634:	c3                   	ret
+    return -E_INVAL;
+  802635:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80263a:	eb f7                	jmp    802633 <fallocate+0x4d>
+
+0080263c <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  80263c:	55                   	push   %ebp
+  80263d:	89 e5                	mov    %esp,%ebp
+  80263f:	57                   	push   %edi
+  802640:	56                   	push   %esi
+  802641:	53                   	push   %ebx
+  802642:	83 ec 24             	sub    $0x24,%esp
+  802645:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802648:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80264b:	50                   	push   %eax
+  80264c:	ff 75 08             	push   0x8(%ebp)
+  80264f:	e8 c5 f0 ff ff       	call   801719 <fd_lookup>
+  802654:	83 c4 10             	add    $0x10,%esp
+  802657:	85 c0                	test   %eax,%eax
+  802659:	78 66                	js     8026c1 <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  80265b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80265e:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  802664:	39 08                	cmp    %ecx,(%eax)
+  802666:	75 61                	jne    8026c9 <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  802668:	85 f6                	test   %esi,%esi
+  80266a:	7e 50                	jle    8026bc <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  80266c:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  802671:	39 de                	cmp    %ebx,%esi
+  802673:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  802676:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802679:	8b 40 0c             	mov    0xc(%eax),%eax
+  80267c:	a3 00 60 80 00       	mov    %eax,0x806000
+    fsipcbuf.prefetch.req_n = m;
+  802681:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  802687:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  80268e:	83 ec 04             	sub    $0x4,%esp
+  802691:	57                   	push   %edi
+  802692:	ff 75 0c             	push   0xc(%ebp)
+  802695:	68 08 60 80 00       	push   $0x806008
+  80269a:	e8 11 e3 ff ff       	call   8009b0 <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  80269f:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026a4:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8026a9:	e8 af f6 ff ff       	call   801d5d <fsipc>
+  8026ae:	83 c4 10             	add    $0x10,%esp
+  8026b1:	85 c0                	test   %eax,%eax
+  8026b3:	78 0c                	js     8026c1 <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  8026b5:	01 7d 0c             	add    %edi,0xc(%ebp)
+  8026b8:	29 de                	sub    %ebx,%esi
+  8026ba:	eb ac                	jmp    802668 <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  8026bc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8026c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026c4:	5b                   	pop    %ebx
+  8026c5:	5e                   	pop    %esi
+  8026c6:	5f                   	pop    %edi
+  8026c7:	5d                   	pop    %ebp
+  8026c8:	c3                   	ret
+    return -E_INVAL;
+  8026c9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026ce:	eb f1                	jmp    8026c1 <prefetch+0x85>
+
+008026d0 <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  8026d0:	55                   	push   %ebp
+  8026d1:	89 e5                	mov    %esp,%ebp
+  8026d3:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  8026d6:	50                   	push   %eax
+  8026d7:	e8 d3 ef ff ff       	call   8016af <fd2data>
+  8026dc:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  8026e1:	c9                   	leave
+  8026e2:	c3                   	ret
+
+008026e3 <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8026e3:	55                   	push   %ebp
+  8026e4:	89 e5                	mov    %esp,%ebp
+  8026e6:	56                   	push   %esi
+  8026e7:	53                   	push   %ebx
+  8026e8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  8026eb:	83 ec 0c             	sub    $0xc,%esp
+  8026ee:	ff 75 08             	push   0x8(%ebp)
+  8026f1:	e8 b9 ef ff ff       	call   8016af <fd2data>
+  8026f6:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  8026f8:	83 c4 08             	add    $0x8,%esp
+  8026fb:	68 2c 3f 80 00       	push   $0x803f2c
+  802700:	53                   	push   %ebx
+  802701:	e8 24 e1 ff ff       	call   80082a <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  802706:	8b 46 04             	mov    0x4(%esi),%eax
+  802709:	2b 06                	sub    (%esi),%eax
+  80270b:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  802711:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802718:	00 00 00 
+  stat->st_dev = &devpipe;
+  80271b:	c7 83 88 00 00 00 20 	movl   $0x804020,0x88(%ebx)
+  802722:	40 80 00 
+  return 0;
+}
+  802725:	b8 00 00 00 00       	mov    $0x0,%eax
+  80272a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80272d:	5b                   	pop    %ebx
+  80272e:	5e                   	pop    %esi
+  80272f:	5d                   	pop    %ebp
+  802730:	c3                   	ret
+
+00802731 <pipe_wakeup>:
+{
+  802731:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  802733:	b8 00 00 00 00       	mov    $0x0,%eax
+  802738:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  80273b:	85 c0                	test   %eax,%eax
+  80273d:	75 01                	jne    802740 <pipe_wakeup+0xf>
+  80273f:	c3                   	ret
+{
+  802740:	55                   	push   %ebp
+  802741:	89 e5                	mov    %esp,%ebp
+  802743:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  802746:	6a 00                	push   $0x0
+  802748:	68 00 00 c0 ee       	push   $0xeec00000
+  80274d:	52                   	push   %edx
+  80274e:	e8 62 e8 ff ff       	call   800fb5 <sys_chan_wakeup>
+  802753:	83 c4 10             	add    $0x10,%esp
+}
+  802756:	c9                   	leave
+  802757:	c3                   	ret
+
+00802758 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802758:	55                   	push   %ebp
+  802759:	89 e5                	mov    %esp,%ebp
+  80275b:	57                   	push   %edi
+  80275c:	56                   	push   %esi
+  80275d:	53                   	push   %ebx
+  80275e:	83 ec 18             	sub    $0x18,%esp
+  802761:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  802764:	57                   	push   %edi
+  802765:	e8 45 ef ff ff       	call   8016af <fd2data>
+  80276a:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  80276c:	83 c4 10             	add    $0x10,%esp
+  80276f:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  802773:	74 2a                	je     80279f <devpipe_close+0x47>
+  802775:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  80277a:	89 f8                	mov    %edi,%eax
+  80277c:	e8 4f ff ff ff       	call   8026d0 <pipe_ring>
+  802781:	83 ec 08             	sub    $0x8,%esp
+  802784:	01 d8                	add    %ebx,%eax
+  802786:	50                   	push   %eax
+  802787:	6a 00                	push   $0x0
+  802789:	e8 50 e5 ff ff       	call   800cde <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  80278e:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802794:	83 c4 10             	add    $0x10,%esp
+  802797:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  80279d:	75 db                	jne    80277a <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  80279f:	83 ec 08             	sub    $0x8,%esp
+  8027a2:	57                   	push   %edi
+  8027a3:	6a 00                	push   $0x0
+  8027a5:	e8 34 e5 ff ff       	call   800cde <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  8027aa:	83 c4 10             	add    $0x10,%esp
+  8027ad:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  8027b1:	75 13                	jne    8027c6 <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  8027b3:	83 ec 08             	sub    $0x8,%esp
+  8027b6:	56                   	push   %esi
+  8027b7:	6a 00                	push   $0x0
+  8027b9:	e8 20 e5 ff ff       	call   800cde <sys_page_unmap>
+}
+  8027be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027c1:	5b                   	pop    %ebx
+  8027c2:	5e                   	pop    %esi
+  8027c3:	5f                   	pop    %edi
+  8027c4:	5d                   	pop    %ebp
+  8027c5:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  8027c6:	8d 56 04             	lea    0x4(%esi),%edx
+  8027c9:	8d 46 2c             	lea    0x2c(%esi),%eax
+  8027cc:	e8 60 ff ff ff       	call   802731 <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8027d1:	8d 46 30             	lea    0x30(%esi),%eax
+  8027d4:	89 f2                	mov    %esi,%edx
+  8027d6:	e8 56 ff ff ff       	call   802731 <pipe_wakeup>
+  8027db:	eb d6                	jmp    8027b3 <devpipe_close+0x5b>
+
+008027dd <_pipeisclosed>:
+{
+  8027dd:	55                   	push   %ebp
+  8027de:	89 e5                	mov    %esp,%ebp
+  8027e0:	57                   	push   %edi
+  8027e1:	56                   	push   %esi
+  8027e2:	53                   	push   %ebx
+  8027e3:	83 ec 1c             	sub    $0x1c,%esp
+  8027e6:	89 c7                	mov    %eax,%edi
+  8027e8:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  8027ea:	a1 a0 58 80 00       	mov    0x8058a0,%eax
+  8027ef:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  8027f2:	83 ec 0c             	sub    $0xc,%esp
+  8027f5:	57                   	push   %edi
+  8027f6:	e8 36 0f 00 00       	call   803731 <pageref>
+  8027fb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8027fe:	89 34 24             	mov    %esi,(%esp)
+  802801:	e8 2b 0f 00 00       	call   803731 <pageref>
+    nn = thisenv->env_runs;
+  802806:	8b 15 a0 58 80 00    	mov    0x8058a0,%edx
+  80280c:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  80280f:	83 c4 10             	add    $0x10,%esp
+  802812:	39 cb                	cmp    %ecx,%ebx
+  802814:	74 1b                	je     802831 <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  802816:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802819:	75 cf                	jne    8027ea <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80281b:	8b 42 58             	mov    0x58(%edx),%eax
+  80281e:	6a 01                	push   $0x1
+  802820:	50                   	push   %eax
+  802821:	53                   	push   %ebx
+  802822:	68 33 3f 80 00       	push   $0x803f33
+  802827:	e8 10 da ff ff       	call   80023c <cprintf>
+  80282c:	83 c4 10             	add    $0x10,%esp
+  80282f:	eb b9                	jmp    8027ea <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  802831:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802834:	0f 94 c0             	sete   %al
+  802837:	0f b6 c0             	movzbl %al,%eax
+}
+  80283a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80283d:	5b                   	pop    %ebx
+  80283e:	5e                   	pop    %esi
+  80283f:	5f                   	pop    %edi
+  802840:	5d                   	pop    %ebp
+  802841:	c3                   	ret
+
+00802842 <devpipe_write_bulk>:
+{
+  802842:	55                   	push   %ebp
+  802843:	89 e5                	mov    %esp,%ebp
+  802845:	57                   	push   %edi
+  802846:	56                   	push   %esi
+  802847:	53                   	push   %ebx
+  802848:	83 ec 1c             	sub    $0x1c,%esp
+  80284b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80284e:	89 d6                	mov    %edx,%esi
+  802850:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  802853:	e8 78 fe ff ff       	call   8026d0 <pipe_ring>
+  802858:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  80285b:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802860:	8d 46 04             	lea    0x4(%esi),%eax
+  802863:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  802866:	eb 75                	jmp    8028dd <devpipe_write_bulk+0x9b>
+  802868:	b8 01 00 00 00       	mov    $0x1,%eax
+  80286d:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802871:	6a 64                	push   $0x64
+  802873:	68 00 00 c0 ee       	push   $0xeec00000
+  802878:	53                   	push   %ebx
+  802879:	56                   	push   %esi
+  80287a:	e8 13 e7 ff ff       	call   800f92 <sys_chan_sleep>
+      continue;
+  80287f:	83 c4 10             	add    $0x10,%esp
+  802882:	eb 59                	jmp    8028dd <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  802884:	89 d1                	mov    %edx,%ecx
+  802886:	c1 f9 1f             	sar    $0x1f,%ecx
+  802889:	c1 e9 11             	shr    $0x11,%ecx
+  80288c:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  80288f:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802894:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  802896:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  80289c:	29 d3                	sub    %edx,%ebx
+  80289e:	ba 00 80 00 00       	mov    $0x8000,%edx
+  8028a3:	29 c2                	sub    %eax,%edx
+  8028a5:	39 d3                	cmp    %edx,%ebx
+  8028a7:	0f 47 da             	cmova  %edx,%ebx
+  8028aa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8028ad:	29 fa                	sub    %edi,%edx
+  8028af:	39 d3                	cmp    %edx,%ebx
+  8028b1:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  8028b4:	83 ec 04             	sub    $0x4,%esp
+  8028b7:	53                   	push   %ebx
+  8028b8:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8028bb:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  8028be:	52                   	push   %edx
+  8028bf:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8028c2:	01 c8                	add    %ecx,%eax
+  8028c4:	50                   	push   %eax
+  8028c5:	e8 48 e1 ff ff       	call   800a12 <memcpy>
+    i += m;
+  8028ca:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  8028cc:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  8028cf:	8d 46 2c             	lea    0x2c(%esi),%eax
+  8028d2:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8028d5:	e8 57 fe ff ff       	call   802731 <pipe_wakeup>
+  8028da:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  8028dd:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  8028e0:	73 2b                	jae    80290d <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  8028e2:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  8028e4:	8b 56 04             	mov    0x4(%esi),%edx
+  8028e7:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  8028ed:	39 d0                	cmp    %edx,%eax
+  8028ef:	7d 93                	jge    802884 <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  8028f1:	89 f2                	mov    %esi,%edx
+  8028f3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8028f6:	e8 e2 fe ff ff       	call   8027dd <_pipeisclosed>
+  8028fb:	85 c0                	test   %eax,%eax
+  8028fd:	0f 84 65 ff ff ff    	je     802868 <devpipe_write_bulk+0x26>
+        return i;
+  802903:	89 f8                	mov    %edi,%eax
+}
+  802905:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802908:	5b                   	pop    %ebx
+  802909:	5e                   	pop    %esi
+  80290a:	5f                   	pop    %edi
+  80290b:	5d                   	pop    %ebp
+  80290c:	c3                   	ret
+  return i;
+  80290d:	89 f8                	mov    %edi,%eax
+  80290f:	eb f4                	jmp    802905 <devpipe_write_bulk+0xc3>
+
+00802911 <devpipe_write>:
+{
+  802911:	55                   	push   %ebp
+  802912:	89 e5                	mov    %esp,%ebp
+  802914:	57                   	push   %edi
+  802915:	56                   	push   %esi
+  802916:	53                   	push   %ebx
+  802917:	83 ec 28             	sub    $0x28,%esp
+  80291a:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  80291d:	56                   	push   %esi
+  80291e:	e8 8c ed ff ff       	call   8016af <fd2data>
+  802923:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  802925:	8b 78 28             	mov    0x28(%eax),%edi
+  802928:	83 c4 10             	add    $0x10,%esp
+  80292b:	85 ff                	test   %edi,%edi
+  80292d:	75 25                	jne    802954 <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  80292f:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802932:	74 66                	je     80299a <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802934:	8b 43 04             	mov    0x4(%ebx),%eax
+  802937:	8b 0b                	mov    (%ebx),%ecx
+  802939:	8d 51 20             	lea    0x20(%ecx),%edx
+  80293c:	39 d0                	cmp    %edx,%eax
+  80293e:	72 2b                	jb     80296b <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  802940:	89 da                	mov    %ebx,%edx
+  802942:	89 f0                	mov    %esi,%eax
+  802944:	e8 94 fe ff ff       	call   8027dd <_pipeisclosed>
+  802949:	85 c0                	test   %eax,%eax
+  80294b:	75 51                	jne    80299e <devpipe_write+0x8d>
+      sys_yield();
+  80294d:	e8 a5 e2 ff ff       	call   800bf7 <sys_yield>
+  802952:	eb e0                	jmp    802934 <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  802954:	83 ec 0c             	sub    $0xc,%esp
+  802957:	ff 75 10             	push   0x10(%ebp)
+  80295a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80295d:	89 c2                	mov    %eax,%edx
+  80295f:	89 f0                	mov    %esi,%eax
+  802961:	e8 dc fe ff ff       	call   802842 <devpipe_write_bulk>
+  802966:	83 c4 10             	add    $0x10,%esp
+  802969:	eb 38                	jmp    8029a3 <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80296b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80296e:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802972:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802975:	89 c2                	mov    %eax,%edx
+  802977:	c1 fa 1f             	sar    $0x1f,%edx
+  80297a:	89 d1                	mov    %edx,%ecx
+  80297c:	c1 e9 1b             	shr    $0x1b,%ecx
+  80297f:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802982:	83 e2 1f             	and    $0x1f,%edx
+  802985:	29 ca                	sub    %ecx,%edx
+  802987:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  80298b:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  80298f:	83 c0 01             	add    $0x1,%eax
+  802992:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  802995:	83 c7 01             	add    $0x1,%edi
+  802998:	eb 95                	jmp    80292f <devpipe_write+0x1e>
+  return i;
+  80299a:	89 f8                	mov    %edi,%eax
+  80299c:	eb 05                	jmp    8029a3 <devpipe_write+0x92>
+        return 0;
+  80299e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8029a3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029a6:	5b                   	pop    %ebx
+  8029a7:	5e                   	pop    %esi
+  8029a8:	5f                   	pop    %edi
+  8029a9:	5d                   	pop    %ebp
+  8029aa:	c3                   	ret
+
+008029ab <devpipe_read_bulk>:
+{
+  8029ab:	55                   	push   %ebp
+  8029ac:	89 e5                	mov    %esp,%ebp
+  8029ae:	57                   	push   %edi
+  8029af:	56                   	push   %esi
+  8029b0:	53                   	push   %ebx
+  8029b1:	83 ec 2c             	sub    $0x2c,%esp
+  8029b4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8029b7:	89 d6                	mov    %edx,%esi
+  8029b9:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8029bc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  8029bf:	e8 0c fd ff ff       	call   8026d0 <pipe_ring>
+  8029c4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  8029c7:	85 db                	test   %ebx,%ebx
+  8029c9:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8029ce:	0f 45 c3             	cmovne %ebx,%eax
+  8029d1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8029d4:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8029d9:	8d 46 30             	lea    0x30(%esi),%eax
+  8029dc:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  8029df:	eb 50                	jmp    802a31 <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  8029e1:	89 d1                	mov    %edx,%ecx
+  8029e3:	c1 f9 1f             	sar    $0x1f,%ecx
+  8029e6:	c1 e9 11             	shr    $0x11,%ecx
+  8029e9:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  8029ec:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8029f1:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  8029f3:	29 d3                	sub    %edx,%ebx
+  8029f5:	ba 00 80 00 00       	mov    $0x8000,%edx
+  8029fa:	29 c2                	sub    %eax,%edx
+  8029fc:	39 d3                	cmp    %edx,%ebx
+  8029fe:	0f 47 da             	cmova  %edx,%ebx
+  802a01:	8b 55 08             	mov    0x8(%ebp),%edx
+  802a04:	29 fa                	sub    %edi,%edx
+  802a06:	39 d3                	cmp    %edx,%ebx
+  802a08:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  802a0b:	83 ec 04             	sub    $0x4,%esp
+  802a0e:	53                   	push   %ebx
+  802a0f:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802a12:	01 c8                	add    %ecx,%eax
+  802a14:	50                   	push   %eax
+  802a15:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802a18:	01 f8                	add    %edi,%eax
+  802a1a:	50                   	push   %eax
+  802a1b:	e8 f2 df ff ff       	call   800a12 <memcpy>
+    i += m;
+  802a20:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  802a22:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802a24:	89 f2                	mov    %esi,%edx
+  802a26:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802a29:	e8 03 fd ff ff       	call   802731 <pipe_wakeup>
+  802a2e:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802a31:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802a34:	73 51                	jae    802a87 <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  802a36:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  802a39:	8b 16                	mov    (%esi),%edx
+  802a3b:	39 da                	cmp    %ebx,%edx
+  802a3d:	75 a2                	jne    8029e1 <devpipe_read_bulk+0x36>
+      if (i > 0)
+  802a3f:	85 ff                	test   %edi,%edi
+  802a41:	75 44                	jne    802a87 <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  802a43:	89 f2                	mov    %esi,%edx
+  802a45:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802a48:	e8 90 fd ff ff       	call   8027dd <_pipeisclosed>
+  802a4d:	85 c0                	test   %eax,%eax
+  802a4f:	75 3a                	jne    802a8b <devpipe_read_bulk+0xe0>
+  802a51:	b8 01 00 00 00       	mov    $0x1,%eax
+  802a56:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802a5a:	6a 64                	push   $0x64
+  802a5c:	ff 75 d4             	push   -0x2c(%ebp)
+  802a5f:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  802a60:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802a63:	50                   	push   %eax
+  802a64:	e8 29 e5 ff ff       	call   800f92 <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  802a69:	85 c0                	test   %eax,%eax
+  802a6b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a70:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  802a73:	83 c4 10             	add    $0x10,%esp
+  802a76:	a8 01                	test   $0x1,%al
+  802a78:	74 b7                	je     802a31 <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  802a7a:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  802a7f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a82:	5b                   	pop    %ebx
+  802a83:	5e                   	pop    %esi
+  802a84:	5f                   	pop    %edi
+  802a85:	5d                   	pop    %ebp
+  802a86:	c3                   	ret
+  return i;
+  802a87:	89 f8                	mov    %edi,%eax
+  802a89:	eb f4                	jmp    802a7f <devpipe_read_bulk+0xd4>
+        return 0;
+  802a8b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a90:	eb ed                	jmp    802a7f <devpipe_read_bulk+0xd4>
+
+00802a92 <devpipe_read>:
+{
+  802a92:	55                   	push   %ebp
+  802a93:	89 e5                	mov    %esp,%ebp
+  802a95:	57                   	push   %edi
+  802a96:	56                   	push   %esi
+  802a97:	53                   	push   %ebx
+  802a98:	83 ec 18             	sub    $0x18,%esp
+  802a9b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  802a9e:	57                   	push   %edi
+  802a9f:	e8 0b ec ff ff       	call   8016af <fd2data>
+  802aa4:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  802aa6:	8b 70 28             	mov    0x28(%eax),%esi
+  802aa9:	83 c4 10             	add    $0x10,%esp
+  802aac:	85 f6                	test   %esi,%esi
+  802aae:	75 24                	jne    802ad4 <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  802ab0:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802ab3:	74 60                	je     802b15 <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  802ab5:	8b 03                	mov    (%ebx),%eax
+  802ab7:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802aba:	75 3b                	jne    802af7 <devpipe_read+0x65>
+      if (i > 0)
+  802abc:	85 f6                	test   %esi,%esi
+  802abe:	75 2d                	jne    802aed <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  802ac0:	89 da                	mov    %ebx,%edx
+  802ac2:	89 f8                	mov    %edi,%eax
+  802ac4:	e8 14 fd ff ff       	call   8027dd <_pipeisclosed>
+  802ac9:	85 c0                	test   %eax,%eax
+  802acb:	75 4c                	jne    802b19 <devpipe_read+0x87>
+      sys_yield();
+  802acd:	e8 25 e1 ff ff       	call   800bf7 <sys_yield>
+  802ad2:	eb e1                	jmp    802ab5 <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  802ad4:	83 ec 08             	sub    $0x8,%esp
+  802ad7:	6a 00                	push   $0x0
+  802ad9:	ff 75 10             	push   0x10(%ebp)
+  802adc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802adf:	89 c2                	mov    %eax,%edx
+  802ae1:	89 f8                	mov    %edi,%eax
+  802ae3:	e8 c3 fe ff ff       	call   8029ab <devpipe_read_bulk>
+  802ae8:	83 c4 10             	add    $0x10,%esp
+  802aeb:	eb 02                	jmp    802aef <devpipe_read+0x5d>
+        return i;
+  802aed:	89 f0                	mov    %esi,%eax
+}
+  802aef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802af2:	5b                   	pop    %ebx
+  802af3:	5e                   	pop    %esi
+  802af4:	5f                   	pop    %edi
+  802af5:	5d                   	pop    %ebp
+  802af6:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802af7:	99                   	cltd
+  802af8:	c1 ea 1b             	shr    $0x1b,%edx
+  802afb:	01 d0                	add    %edx,%eax
+  802afd:	83 e0 1f             	and    $0x1f,%eax
+  802b00:	29 d0                	sub    %edx,%eax
+  802b02:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802b07:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802b0a:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  802b0d:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  802b10:	83 c6 01             	add    $0x1,%esi
+  802b13:	eb 9b                	jmp    802ab0 <devpipe_read+0x1e>
+  return i;
+  802b15:	89 f0                	mov    %esi,%eax
+  802b17:	eb d6                	jmp    802aef <devpipe_read+0x5d>
+        return 0;
+  802b19:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b1e:	eb cf                	jmp    802aef <devpipe_read+0x5d>
+
+00802b20 <pipe2>:
+{
+  802b20:	55                   	push   %ebp
+  802b21:	89 e5                	mov    %esp,%ebp
+  802b23:	57                   	push   %edi
+  802b24:	56                   	push   %esi
+  802b25:	53                   	push   %ebx
+  802b26:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  802b29:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802b2c:	50                   	push   %eax
+  802b2d:	e8 91 eb ff ff       	call   8016c3 <fd_alloc>
+  802b32:	89 c3                	mov    %eax,%ebx
+  802b34:	83 c4 10             	add    $0x10,%esp
+  802b37:	85 c0                	test   %eax,%eax
+  802b39:	0f 88 fb 01 00 00    	js     802d3a <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802b3f:	83 ec 04             	sub    $0x4,%esp
+  802b42:	68 07 04 00 00       	push   $0x407
+  802b47:	ff 75 e4             	push   -0x1c(%ebp)
+  802b4a:	6a 00                	push   $0x0
+  802b4c:	e8 08 e1 ff ff       	call   800c59 <sys_page_alloc>
+  802b51:	89 c3                	mov    %eax,%ebx
+  802b53:	83 c4 10             	add    $0x10,%esp
+  802b56:	85 c0                	test   %eax,%eax
+  802b58:	0f 88 dc 01 00 00    	js     802d3a <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  802b5e:	83 ec 0c             	sub    $0xc,%esp
+  802b61:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  802b64:	50                   	push   %eax
+  802b65:	e8 59 eb ff ff       	call   8016c3 <fd_alloc>
+  802b6a:	89 c3                	mov    %eax,%ebx
+  802b6c:	83 c4 10             	add    $0x10,%esp
+  802b6f:	85 c0                	test   %eax,%eax
+  802b71:	0f 88 b3 01 00 00    	js     802d2a <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802b77:	83 ec 04             	sub    $0x4,%esp
+  802b7a:	68 07 04 00 00       	push   $0x407
+  802b7f:	ff 75 e0             	push   -0x20(%ebp)
+  802b82:	6a 00                	push   $0x0
+  802b84:	e8 d0 e0 ff ff       	call   800c59 <sys_page_alloc>
+  802b89:	89 c3                	mov    %eax,%ebx
+  802b8b:	83 c4 10             	add    $0x10,%esp
+  802b8e:	85 c0                	test   %eax,%eax
+  802b90:	0f 88 94 01 00 00    	js     802d2a <pipe2+0x20a>
+  va = fd2data(fd0);
+  802b96:	83 ec 0c             	sub    $0xc,%esp
+  802b99:	ff 75 e4             	push   -0x1c(%ebp)
+  802b9c:	e8 0e eb ff ff       	call   8016af <fd2data>
+  802ba1:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802ba3:	83 c4 0c             	add    $0xc,%esp
+  802ba6:	68 07 04 00 00       	push   $0x407
+  802bab:	50                   	push   %eax
+  802bac:	6a 00                	push   $0x0
+  802bae:	e8 a6 e0 ff ff       	call   800c59 <sys_page_alloc>
+  802bb3:	89 c3                	mov    %eax,%ebx
+  802bb5:	83 c4 10             	add    $0x10,%esp
+  802bb8:	85 c0                	test   %eax,%eax
+  802bba:	0f 88 5a 01 00 00    	js     802d1a <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802bc0:	83 ec 0c             	sub    $0xc,%esp
+  802bc3:	ff 75 e0             	push   -0x20(%ebp)
+  802bc6:	e8 e4 ea ff ff       	call   8016af <fd2data>
+  802bcb:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802bd2:	50                   	push   %eax
+  802bd3:	6a 00                	push   $0x0
+  802bd5:	57                   	push   %edi
+  802bd6:	6a 00                	push   $0x0
+  802bd8:	e8 bf e0 ff ff       	call   800c9c <sys_page_map>
+  802bdd:	89 c3                	mov    %eax,%ebx
+  802bdf:	83 c4 20             	add    $0x20,%esp
+  802be2:	85 c0                	test   %eax,%eax
+  802be4:	0f 88 22 01 00 00    	js     802d0c <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  802bea:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  802bee:	74 72                	je     802c62 <pipe2+0x142>
+  802bf0:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  802bf5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802bf8:	e8 d3 fa ff ff       	call   8026d0 <pipe_ring>
+  802bfd:	83 ec 04             	sub    $0x4,%esp
+  802c00:	68 07 04 00 00       	push   $0x407
+  802c05:	01 f0                	add    %esi,%eax
+  802c07:	50                   	push   %eax
+  802c08:	6a 00                	push   $0x0
+  802c0a:	e8 4a e0 ff ff       	call   800c59 <sys_page_alloc>
+  802c0f:	89 c3                	mov    %eax,%ebx
+  802c11:	83 c4 10             	add    $0x10,%esp
+  802c14:	85 c0                	test   %eax,%eax
+  802c16:	0f 88 97 00 00 00    	js     802cb3 <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  802c1c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802c1f:	e8 ac fa ff ff       	call   8026d0 <pipe_ring>
+  802c24:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  802c27:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802c2a:	e8 a1 fa ff ff       	call   8026d0 <pipe_ring>
+  802c2f:	83 ec 0c             	sub    $0xc,%esp
+  802c32:	68 07 04 00 00       	push   $0x407
+  802c37:	53                   	push   %ebx
+  802c38:	6a 00                	push   $0x0
+  802c3a:	01 f0                	add    %esi,%eax
+  802c3c:	50                   	push   %eax
+  802c3d:	6a 00                	push   $0x0
+  802c3f:	e8 58 e0 ff ff       	call   800c9c <sys_page_map>
+  802c44:	89 c3                	mov    %eax,%ebx
+  802c46:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802c4c:	83 c4 20             	add    $0x20,%esp
+  802c4f:	85 c0                	test   %eax,%eax
+  802c51:	78 60                	js     802cb3 <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  802c53:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802c59:	75 9a                	jne    802bf5 <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  802c5b:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  802c62:	a1 20 40 80 00       	mov    0x804020,%eax
+  802c67:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802c6a:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  802c6c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802c6f:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  802c76:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802c79:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  802c7b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802c7e:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  802c85:	83 ec 0c             	sub    $0xc,%esp
+  802c88:	ff 75 e4             	push   -0x1c(%ebp)
+  802c8b:	e8 0f ea ff ff       	call   80169f <fd2num>
+  802c90:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802c93:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  802c95:	83 c4 04             	add    $0x4,%esp
+  802c98:	ff 75 e0             	push   -0x20(%ebp)
+  802c9b:	e8 ff e9 ff ff       	call   80169f <fd2num>
+  802ca0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802ca3:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  802ca6:	83 c4 10             	add    $0x10,%esp
+  802ca9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802cae:	e9 87 00 00 00       	jmp    802d3a <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802cb3:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  802cb8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802cbb:	e8 10 fa ff ff       	call   8026d0 <pipe_ring>
+  802cc0:	83 ec 08             	sub    $0x8,%esp
+  802cc3:	01 f0                	add    %esi,%eax
+  802cc5:	50                   	push   %eax
+  802cc6:	6a 00                	push   $0x0
+  802cc8:	e8 11 e0 ff ff       	call   800cde <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  802ccd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802cd0:	e8 fb f9 ff ff       	call   8026d0 <pipe_ring>
+  802cd5:	83 c4 08             	add    $0x8,%esp
+  802cd8:	01 f0                	add    %esi,%eax
+  802cda:	50                   	push   %eax
+  802cdb:	6a 00                	push   $0x0
+  802cdd:	e8 fc df ff ff       	call   800cde <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802ce2:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802ce8:	83 c4 10             	add    $0x10,%esp
+  802ceb:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802cf1:	75 c5                	jne    802cb8 <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  802cf3:	83 ec 0c             	sub    $0xc,%esp
+  802cf6:	ff 75 e0             	push   -0x20(%ebp)
+  802cf9:	e8 b1 e9 ff ff       	call   8016af <fd2data>
+  802cfe:	83 c4 08             	add    $0x8,%esp
+  802d01:	50                   	push   %eax
+  802d02:	6a 00                	push   $0x0
+  802d04:	e8 d5 df ff ff       	call   800cde <sys_page_unmap>
+  802d09:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  802d0c:	83 ec 08             	sub    $0x8,%esp
+  802d0f:	57                   	push   %edi
+  802d10:	6a 00                	push   $0x0
+  802d12:	e8 c7 df ff ff       	call   800cde <sys_page_unmap>
+  802d17:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  802d1a:	83 ec 08             	sub    $0x8,%esp
+  802d1d:	ff 75 e0             	push   -0x20(%ebp)
+  802d20:	6a 00                	push   $0x0
+  802d22:	e8 b7 df ff ff       	call   800cde <sys_page_unmap>
+  802d27:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  802d2a:	83 ec 08             	sub    $0x8,%esp
+  802d2d:	ff 75 e4             	push   -0x1c(%ebp)
+  802d30:	6a 00                	push   $0x0
+  802d32:	e8 a7 df ff ff       	call   800cde <sys_page_unmap>
+  802d37:	83 c4 10             	add    $0x10,%esp
+}
+  802d3a:	89 d8                	mov    %ebx,%eax
+  802d3c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d3f:	5b                   	pop    %ebx
+  802d40:	5e                   	pop    %esi
+  802d41:	5f                   	pop    %edi
+  802d42:	5d                   	pop    %ebp
+  802d43:	c3                   	ret
+
+00802d44 <pipe>:
+{
+  802d44:	55                   	push   %ebp
+  802d45:	89 e5                	mov    %esp,%ebp
+  802d47:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  802d4a:	6a 00                	push   $0x0
+  802d4c:	ff 75 08             	push   0x8(%ebp)
+  802d4f:	e8 cc fd ff ff       	call   802b20 <pipe2>
+}
+  802d54:	c9                   	leave
+  802d55:	c3                   	ret
+
+00802d56 <pipeisclosed>:
+{
+  802d56:	55                   	push   %ebp
+  802d57:	89 e5                	mov    %esp,%ebp
+  802d59:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802d5c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802d5f:	50                   	push   %eax
+  802d60:	ff 75 08             	push   0x8(%ebp)
+  802d63:	e8 b1 e9 ff ff       	call   801719 <fd_lookup>
+  802d68:	83 c4 10             	add    $0x10,%esp
+  802d6b:	85 c0                	test   %eax,%eax
+  802d6d:	78 18                	js     802d87 <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  802d6f:	83 ec 0c             	sub    $0xc,%esp
+  802d72:	ff 75 f4             	push   -0xc(%ebp)
+  802d75:	e8 35 e9 ff ff       	call   8016af <fd2data>
+  802d7a:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  802d7c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802d7f:	e8 59 fa ff ff       	call   8027dd <_pipeisclosed>
+  802d84:	83 c4 10             	add    $0x10,%esp
+}
+  802d87:	c9                   	leave
+  802d88:	c3                   	ret
+
+00802d89 <pipe_splice>:
+{
+  802d89:	55                   	push   %ebp
+  802d8a:	89 e5                	mov    %esp,%ebp
+  802d8c:	57                   	push   %edi
+  802d8d:	56                   	push   %esi
+  802d8e:	53                   	push   %ebx
+  802d8f:	83 ec 34             	sub    $0x34,%esp
+  802d92:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802d95:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802d98:	50                   	push   %eax
+  802d99:	ff 75 08             	push   0x8(%ebp)
+  802d9c:	e8 78 e9 ff ff       	call   801719 <fd_lookup>
+  802da1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802da4:	83 c4 10             	add    $0x10,%esp
+  802da7:	85 c0                	test   %eax,%eax
+  802da9:	0f 88 d7 00 00 00    	js     802e86 <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  802daf:	83 ec 0c             	sub    $0xc,%esp
+  802db2:	ff 75 e4             	push   -0x1c(%ebp)
+  802db5:	e8 f5 e8 ff ff       	call   8016af <fd2data>
+  802dba:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802dbc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802dbf:	83 c4 10             	add    $0x10,%esp
+  802dc2:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802dc8:	39 10                	cmp    %edx,(%eax)
+  802dca:	0f 85 c1 00 00 00    	jne    802e91 <pipe_splice+0x108>
+  802dd0:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  802dd4:	0f 84 c0 00 00 00    	je     802e9a <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  802dda:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802dde:	0f 84 bf 00 00 00    	je     802ea3 <pipe_splice+0x11a>
+  802de4:	89 f7                	mov    %esi,%edi
+  802de6:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  802dec:	0f 85 ba 00 00 00    	jne    802eac <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802df2:	8d 43 04             	lea    0x4(%ebx),%eax
+  802df5:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802df8:	eb 38                	jmp    802e32 <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802dfa:	83 ec 0c             	sub    $0xc,%esp
+  802dfd:	68 00 10 00 00       	push   $0x1000
+  802e02:	89 f1                	mov    %esi,%ecx
+  802e04:	89 da                	mov    %ebx,%edx
+  802e06:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802e09:	e8 34 fa ff ff       	call   802842 <devpipe_write_bulk>
+  802e0e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802e11:	83 c4 10             	add    $0x10,%esp
+  802e14:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802e19:	75 53                	jne    802e6e <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  802e1b:	83 ec 08             	sub    $0x8,%esp
+  802e1e:	56                   	push   %esi
+  802e1f:	6a 00                	push   $0x0
+  802e21:	e8 b8 de ff ff       	call   800cde <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  802e26:	83 c7 01             	add    $0x1,%edi
+  802e29:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802e2f:	83 c4 10             	add    $0x10,%esp
+  802e32:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802e35:	74 3a                	je     802e71 <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  802e37:	8b 03                	mov    (%ebx),%eax
+  802e39:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802e3c:	75 bc                	jne    802dfa <pipe_splice+0x71>
+  802e3e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e43:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  802e47:	85 c0                	test   %eax,%eax
+  802e49:	74 af                	je     802dfa <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802e4b:	83 ec 04             	sub    $0x4,%esp
+  802e4e:	6a 07                	push   $0x7
+  802e50:	56                   	push   %esi
+  802e51:	ff 75 d0             	push   -0x30(%ebp)
+  802e54:	e8 5c e1 ff ff       	call   800fb5 <sys_chan_wakeup>
+  802e59:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802e5c:	83 c4 10             	add    $0x10,%esp
+  802e5f:	85 c0                	test   %eax,%eax
+  802e61:	79 b8                	jns    802e1b <pipe_splice+0x92>
+  802e63:	b8 01 00 00 00       	mov    $0x1,%eax
+  802e68:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802e6c:	eb 8c                	jmp    802dfa <pipe_splice+0x71>
+  802e6e:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  802e71:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802e75:	75 06                	jne    802e7d <pipe_splice+0xf4>
+  802e77:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802e7b:	78 09                	js     802e86 <pipe_splice+0xfd>
+  return i * PGSIZE;
+  802e7d:	8b 45 10             	mov    0x10(%ebp),%eax
+  802e80:	c1 e0 0c             	shl    $0xc,%eax
+  802e83:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  802e86:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802e89:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e8c:	5b                   	pop    %ebx
+  802e8d:	5e                   	pop    %esi
+  802e8e:	5f                   	pop    %edi
+  802e8f:	5d                   	pop    %ebp
+  802e90:	c3                   	ret
+    return -E_INVAL;
+  802e91:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802e98:	eb ec                	jmp    802e86 <pipe_splice+0xfd>
+  802e9a:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802ea1:	eb e3                	jmp    802e86 <pipe_splice+0xfd>
+  802ea3:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802eaa:	eb da                	jmp    802e86 <pipe_splice+0xfd>
+  802eac:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802eb3:	eb d1                	jmp    802e86 <pipe_splice+0xfd>
+
+00802eb5 <pipe_splice_read>:
+{
+  802eb5:	55                   	push   %ebp
+  802eb6:	89 e5                	mov    %esp,%ebp
+  802eb8:	53                   	push   %ebx
+  802eb9:	83 ec 1c             	sub    $0x1c,%esp
+  802ebc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802ebf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802ec2:	50                   	push   %eax
+  802ec3:	ff 75 08             	push   0x8(%ebp)
+  802ec6:	e8 4e e8 ff ff       	call   801719 <fd_lookup>
+  802ecb:	83 c4 10             	add    $0x10,%esp
+  802ece:	85 c0                	test   %eax,%eax
+  802ed0:	78 49                	js     802f1b <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  802ed2:	83 ec 0c             	sub    $0xc,%esp
+  802ed5:	ff 75 f4             	push   -0xc(%ebp)
+  802ed8:	e8 d2 e7 ff ff       	call   8016af <fd2data>
+  802edd:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802edf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ee2:	83 c4 10             	add    $0x10,%esp
+  802ee5:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  802eeb:	39 08                	cmp    %ecx,(%eax)
+  802eed:	75 31                	jne    802f20 <pipe_splice_read+0x6b>
+  802eef:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  802ef3:	74 32                	je     802f27 <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  802ef5:	8b 48 08             	mov    0x8(%eax),%ecx
+  802ef8:	83 e1 03             	and    $0x3,%ecx
+  802efb:	83 f9 01             	cmp    $0x1,%ecx
+  802efe:	74 2e                	je     802f2e <pipe_splice_read+0x79>
+  802f00:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  802f06:	75 2d                	jne    802f35 <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  802f08:	83 ec 08             	sub    $0x8,%esp
+  802f0b:	53                   	push   %ebx
+  802f0c:	68 00 10 00 00       	push   $0x1000
+  802f11:	89 d9                	mov    %ebx,%ecx
+  802f13:	e8 93 fa ff ff       	call   8029ab <devpipe_read_bulk>
+  802f18:	83 c4 10             	add    $0x10,%esp
+}
+  802f1b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f1e:	c9                   	leave
+  802f1f:	c3                   	ret
+    return -E_INVAL;
+  802f20:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802f25:	eb f4                	jmp    802f1b <pipe_splice_read+0x66>
+  802f27:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802f2c:	eb ed                	jmp    802f1b <pipe_splice_read+0x66>
+  802f2e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802f33:	eb e6                	jmp    802f1b <pipe_splice_read+0x66>
+  802f35:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802f3a:	eb df                	jmp    802f1b <pipe_splice_read+0x66>
+
+00802f3c <mmap_find>:
+          utf->utf_eip, utf->utf_err);
+}
+
+static struct Mmap *
+mmap_find(uintptr_t va)
+{
+  802f3c:	55                   	push   %ebp
+  802f3d:	89 e5                	mov    %esp,%ebp
+  802f3f:	56                   	push   %esi
+  802f40:	53                   	push   %ebx
+  int i;
+
+  for (i = 0; i < NMMAP; i++)
+  802f41:	ba 60 57 80 00       	mov    $0x805760,%edx
+  802f46:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f4b:	eb 0b                	jmp    802f58 <mmap_find+0x1c>
+  802f4d:	83 c3 01             	add    $0x1,%ebx
+  802f50:	83 c2 14             	add    $0x14,%edx
+  802f53:	83 fb 10             	cmp    $0x10,%ebx
+  802f56:	74 1d                	je     802f75 <mmap_find+0x39>
+    if (mmaps[i].mm_va && va >= mmaps[i].mm_va &&
+  802f58:	8b 0a                	mov    (%edx),%ecx
+  802f5a:	39 c8                	cmp    %ecx,%eax
+  802f5c:	72 ef                	jb     802f4d <mmap_find+0x11>
+  802f5e:	85 c9                	test   %ecx,%ecx
+  802f60:	74 eb                	je     802f4d <mmap_find+0x11>
+        va < mmaps[i].mm_va + mmaps[i].mm_len)
+  802f62:	03 4a 04             	add    0x4(%edx),%ecx
+    if (mmaps[i].mm_va && va >= mmaps[i].mm_va &&
+  802f65:	39 c8                	cmp    %ecx,%eax
+  802f67:	73 e4                	jae    802f4d <mmap_find+0x11>
+      return &mmaps[i];
+  802f69:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802f6c:	8d 04 85 60 57 80 00 	lea    0x805760(,%eax,4),%eax
+  802f73:	eb 05                	jmp    802f7a <mmap_find+0x3e>
+  return NULL;
+  802f75:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802f7a:	5b                   	pop    %ebx
+  802f7b:	5e                   	pop    %esi
+  802f7c:	5d                   	pop    %ebp
+  802f7d:	c3                   	ret
+
+00802f7e <va_mapped>:
+
+static bool
+va_mapped(uintptr_t va)
+{
+  return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+  802f7e:	89 c2                	mov    %eax,%edx
+  802f80:	c1 ea 16             	shr    $0x16,%edx
+  802f83:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802f8a:	f6 c2 01             	test   $0x1,%dl
+  802f8d:	74 11                	je     802fa0 <va_mapped+0x22>
+  802f8f:	c1 e8 0c             	shr    $0xc,%eax
+  802f92:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802f99:	83 e0 01             	and    $0x1,%eax
+  802f9c:	83 e0 01             	and    $0x1,%eax
+}
+  802f9f:	c3                   	ret
+  return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+  802fa0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fa5:	eb f5                	jmp    802f9c <va_mapped+0x1e>
+
+00802fa7 <mmap_copy>:
+
+// Replace the page at 'va' with a copy of its first 'n' bytes, the rest
+// zeroed, mapped with 'perm'.
+static void
+mmap_copy(uintptr_t va, size_t n, int perm)
+{
+  802fa7:	55                   	push   %ebp
+  802fa8:	89 e5                	mov    %esp,%ebp
+  802faa:	57                   	push   %edi
+  802fab:	56                   	push   %esi
+  802fac:	53                   	push   %ebx
+  802fad:	83 ec 10             	sub    $0x10,%esp
+  802fb0:	89 c3                	mov    %eax,%ebx
+  802fb2:	89 d7                	mov    %edx,%edi
+  802fb4:	89 ce                	mov    %ecx,%esi
+  int r;
+
+  if ((r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  802fb6:	6a 07                	push   $0x7
+  802fb8:	68 00 f0 7f 00       	push   $0x7ff000
+  802fbd:	6a 00                	push   $0x0
+  802fbf:	e8 95 dc ff ff       	call   800c59 <sys_page_alloc>
+  802fc4:	83 c4 10             	add    $0x10,%esp
+  802fc7:	85 c0                	test   %eax,%eax
+  802fc9:	78 46                	js     803011 <mmap_copy+0x6a>
+    panic("mmap: %e", r);
+  memmove(PFTEMP, (void *) va, n);
+  802fcb:	83 ec 04             	sub    $0x4,%esp
+  802fce:	57                   	push   %edi
+  802fcf:	53                   	push   %ebx
+  802fd0:	68 00 f0 7f 00       	push   $0x7ff000
+  802fd5:	e8 d6 d9 ff ff       	call   8009b0 <memmove>
+  if ((r = sys_page_map(0, PFTEMP, 0, (void *) va, perm)) < 0 ||
+  802fda:	89 34 24             	mov    %esi,(%esp)
+  802fdd:	53                   	push   %ebx
+  802fde:	6a 00                	push   $0x0
+  802fe0:	68 00 f0 7f 00       	push   $0x7ff000
+  802fe5:	6a 00                	push   $0x0
+  802fe7:	e8 b0 dc ff ff       	call   800c9c <sys_page_map>
+  802fec:	83 c4 20             	add    $0x20,%esp
+  802fef:	85 c0                	test   %eax,%eax
+  802ff1:	78 30                	js     803023 <mmap_copy+0x7c>
+      (r = sys_page_unmap(0, PFTEMP)) < 0)
+  802ff3:	83 ec 08             	sub    $0x8,%esp
+  802ff6:	68 00 f0 7f 00       	push   $0x7ff000
+  802ffb:	6a 00                	push   $0x0
+  802ffd:	e8 dc dc ff ff       	call   800cde <sys_page_unmap>
+  if ((r = sys_page_map(0, PFTEMP, 0, (void *) va, perm)) < 0 ||
+  803002:	83 c4 10             	add    $0x10,%esp
+  803005:	85 c0                	test   %eax,%eax
+  803007:	78 1a                	js     803023 <mmap_copy+0x7c>
+    panic("mmap: %e", r);
+}
+  803009:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80300c:	5b                   	pop    %ebx
+  80300d:	5e                   	pop    %esi
+  80300e:	5f                   	pop    %edi
+  80300f:	5d                   	pop    %ebp
+  803010:	c3                   	ret
+    panic("mmap: %e", r);
+  803011:	50                   	push   %eax
+  803012:	68 4b 3f 80 00       	push   $0x803f4b
+  803017:	6a 3e                	push   $0x3e
+  803019:	68 54 3f 80 00       	push   $0x803f54
+  80301e:	e8 3e d1 ff ff       	call   800161 <_panic>
+    panic("mmap: %e", r);
+  803023:	50                   	push   %eax
+  803024:	68 4b 3f 80 00       	push   $0x803f4b
+  803029:	6a 42                	push   $0x42
+  80302b:	68 54 3f 80 00       	push   $0x803f54
+  803030:	e8 2c d1 ff ff       	call   800161 <_panic>
+
+00803035 <mmap_fault>:
+// Handle a page fault in a mapping, if it is one.  Returns 1 if it was.
+// The fork page fault handlers call this first, so that mappings keep
+// working after a fork.
+bool
+mmap_fault(struct UTrapframe *utf)
+{
+  803035:	55                   	push   %ebp
+  803036:	89 e5                	mov    %esp,%ebp
+  803038:	57                   	push   %edi
+  803039:	56                   	push   %esi
+  80303a:	53                   	push   %ebx
+  80303b:	83 ec 1c             	sub    $0x1c,%esp
+  80303e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Fsreq_read_map saved;
+  struct Mmap *m;
+  uintptr_t va;
+  int perm, r;
+
+  va = ROUNDDOWN(utf->utf_fault_va, PGSIZE);
+  803041:	8b 1f                	mov    (%edi),%ebx
+  803043:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if (va < MMAPBASE || va >= MMAPTOP || (m = mmap_find(va)) == NULL)
+  803049:	8d 83 00 00 00 60    	lea    0x60000000(%ebx),%eax
+  80304f:	3d ff ff ff 2f       	cmp    $0x2fffffff,%eax
+  803054:	0f 87 24 01 00 00    	ja     80317e <mmap_fault+0x149>
+  80305a:	89 d8                	mov    %ebx,%eax
+  80305c:	e8 db fe ff ff       	call   802f3c <mmap_find>
+  803061:	89 c6                	mov    %eax,%esi
+  803063:	85 c0                	test   %eax,%eax
+  803065:	0f 84 20 01 00 00    	je     80318b <mmap_fault+0x156>
+    return 0;
+  if ((utf->utf_err & FEC_WR) && m->mm_perm == MAP_RDONLY)
+  80306b:	f6 47 04 02          	testb  $0x2,0x4(%edi)
+  80306f:	74 13                	je     803084 <mmap_fault+0x4f>
+  803071:	83 78 10 00          	cmpl   $0x0,0x10(%eax)
+  803075:	0f 84 17 01 00 00    	je     803192 <mmap_fault+0x15d>
+    return 0;
+  perm = PTE_P | PTE_U | (m->mm_perm == MAP_RDONLY ? 0 : PTE_W);
+  80307b:	c7 45 e4 07 00 00 00 	movl   $0x7,-0x1c(%ebp)
+  803082:	eb 0f                	jmp    803093 <mmap_fault+0x5e>
+  803084:	83 78 10 01          	cmpl   $0x1,0x10(%eax)
+  803088:	19 c0                	sbb    %eax,%eax
+  80308a:	83 e0 fe             	and    $0xfffffffe,%eax
+  80308d:	83 c0 07             	add    $0x7,%eax
+  803090:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+
+  if (!va_mapped(va)) {
+  803093:	89 d8                	mov    %ebx,%eax
+  803095:	e8 e4 fe ff ff       	call   802f7e <va_mapped>
+  80309a:	84 c0                	test   %al,%al
+  80309c:	74 42                	je     8030e0 <mmap_fault+0xab>
+    }
+  }
+
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+    mmap_copy(va, PGSIZE, perm);
+  return 1;
+  80309e:	b8 01 00 00 00       	mov    $0x1,%eax
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+  8030a3:	f6 47 04 02          	testb  $0x2,0x4(%edi)
+  8030a7:	0f 84 d6 00 00 00    	je     803183 <mmap_fault+0x14e>
+  8030ad:	89 d8                	mov    %ebx,%eax
+  8030af:	c1 e8 0c             	shr    $0xc,%eax
+  8030b2:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  return 1;
+  8030b9:	b8 01 00 00 00       	mov    $0x1,%eax
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+  8030be:	f6 c2 02             	test   $0x2,%dl
+  8030c1:	0f 85 bc 00 00 00    	jne    803183 <mmap_fault+0x14e>
+    mmap_copy(va, PGSIZE, perm);
+  8030c7:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8030ca:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8030cf:	89 d8                	mov    %ebx,%eax
+  8030d1:	e8 d1 fe ff ff       	call   802fa7 <mmap_copy>
+  return 1;
+  8030d6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8030db:	e9 a3 00 00 00       	jmp    803183 <mmap_fault+0x14e>
+    saved = fsipcbuf.read_map;
+  8030e0:	a1 00 60 80 00       	mov    0x806000,%eax
+  8030e5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8030e8:	8b 15 04 60 80 00    	mov    0x806004,%edx
+  8030ee:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    r = read_map(m->mm_fd, m->mm_offset + (va - m->mm_va), (void *) va);
+  8030f1:	83 ec 04             	sub    $0x4,%esp
+  8030f4:	53                   	push   %ebx
+  8030f5:	89 d8                	mov    %ebx,%eax
+  8030f7:	03 46 0c             	add    0xc(%esi),%eax
+  8030fa:	2b 06                	sub    (%esi),%eax
+  8030fc:	50                   	push   %eax
+  8030fd:	ff 76 08             	push   0x8(%esi)
+  803100:	e8 86 f3 ff ff       	call   80248b <read_map>
+    fsipcbuf.read_map = saved;
+  803105:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  803108:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+  80310e:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  803111:	89 15 04 60 80 00    	mov    %edx,0x806004
+    if (r < 0)
+  803117:	83 c4 10             	add    $0x10,%esp
+  80311a:	85 c0                	test   %eax,%eax
+  80311c:	78 20                	js     80313e <mmap_fault+0x109>
+    if (r == 0) {
+  80311e:	74 30                	je     803150 <mmap_fault+0x11b>
+    if (r < PGSIZE) {
+  803120:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  803125:	0f 8f 73 ff ff ff    	jg     80309e <mmap_fault+0x69>
+      mmap_copy(va, r, perm);
+  80312b:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80312e:	89 c2                	mov    %eax,%edx
+  803130:	89 d8                	mov    %ebx,%eax
+  803132:	e8 70 fe ff ff       	call   802fa7 <mmap_copy>
+      return 1;
+  803137:	b8 01 00 00 00       	mov    $0x1,%eax
+  80313c:	eb 45                	jmp    803183 <mmap_fault+0x14e>
+      panic("mmap: read_map: %e", r);
+  80313e:	50                   	push   %eax
+  80313f:	68 5f 3f 80 00       	push   $0x803f5f
+  803144:	6a 5f                	push   $0x5f
+  803146:	68 54 3f 80 00       	push   $0x803f54
+  80314b:	e8 11 d0 ff ff       	call   800161 <_panic>
+      if ((r = sys_page_alloc(0, (void *) va, perm)) < 0)
+  803150:	83 ec 04             	sub    $0x4,%esp
+  803153:	ff 75 e4             	push   -0x1c(%ebp)
+  803156:	53                   	push   %ebx
+  803157:	6a 00                	push   $0x0
+  803159:	e8 fb da ff ff       	call   800c59 <sys_page_alloc>
+  80315e:	83 c4 10             	add    $0x10,%esp
+  803161:	85 c0                	test   %eax,%eax
+  803163:	78 07                	js     80316c <mmap_fault+0x137>
+      return 1;
+  803165:	b8 01 00 00 00       	mov    $0x1,%eax
+  80316a:	eb 17                	jmp    803183 <mmap_fault+0x14e>
+        panic("mmap: %e", r);
+  80316c:	50                   	push   %eax
+  80316d:	68 4b 3f 80 00       	push   $0x803f4b
+  803172:	6a 64                	push   $0x64
+  803174:	68 54 3f 80 00       	push   $0x803f54
+  803179:	e8 e3 cf ff ff       	call   800161 <_panic>
+    return 0;
+  80317e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803183:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803186:	5b                   	pop    %ebx
+  803187:	5e                   	pop    %esi
+  803188:	5f                   	pop    %edi
+  803189:	5d                   	pop    %ebp
+  80318a:	c3                   	ret
+    return 0;
+  80318b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803190:	eb f1                	jmp    803183 <mmap_fault+0x14e>
+    return 0;
+  803192:	b8 00 00 00 00       	mov    $0x0,%eax
+  803197:	eb ea                	jmp    803183 <mmap_fault+0x14e>
+
+00803199 <mmap_pgfault>:
+{
+  803199:	55                   	push   %ebp
+  80319a:	89 e5                	mov    %esp,%ebp
+  80319c:	53                   	push   %ebx
+  80319d:	83 ec 10             	sub    $0x10,%esp
+  8031a0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (!mmap_fault(utf))
+  8031a3:	53                   	push   %ebx
+  8031a4:	e8 8c fe ff ff       	call   803035 <mmap_fault>
+  8031a9:	83 c4 10             	add    $0x10,%esp
+  8031ac:	84 c0                	test   %al,%al
+  8031ae:	74 05                	je     8031b5 <mmap_pgfault+0x1c>
+}
+  8031b0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8031b3:	c9                   	leave
+  8031b4:	c3                   	ret
+    panic("page fault at %08x, eip %08x, err %04x", utf->utf_fault_va,
+  8031b5:	83 ec 08             	sub    $0x8,%esp
+  8031b8:	ff 73 04             	push   0x4(%ebx)
+  8031bb:	ff 73 28             	push   0x28(%ebx)
+  8031be:	ff 33                	push   (%ebx)
+  8031c0:	68 74 3f 80 00       	push   $0x803f74
+  8031c5:	6a 20                	push   $0x20
+  8031c7:	68 54 3f 80 00       	push   $0x803f54
+  8031cc:	e8 90 cf ff ff       	call   800161 <_panic>
+
+008031d1 <mmap>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_INVAL if offset isn't aligned, len is 0, or perm is unknown
+//	-E_NO_MEM if there's no free slot or address space for it
+int
+mmap(int fdnum, off_t offset, size_t len, int perm, void **addr)
+{
+  8031d1:	55                   	push   %ebp
+  8031d2:	89 e5                	mov    %esp,%ebp
+  8031d4:	57                   	push   %edi
+  8031d5:	56                   	push   %esi
+  8031d6:	53                   	push   %ebx
+  8031d7:	83 ec 44             	sub    $0x44,%esp
+  8031da:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  struct Fd *fd;
+  uintptr_t va;
+  int i, j, r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8031dd:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8031e0:	50                   	push   %eax
+  8031e1:	ff 75 08             	push   0x8(%ebp)
+  8031e4:	e8 30 e5 ff ff       	call   801719 <fd_lookup>
+  8031e9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8031ec:	83 c4 10             	add    $0x10,%esp
+  8031ef:	85 c0                	test   %eax,%eax
+  8031f1:	0f 88 3e 01 00 00    	js     803335 <mmap+0x164>
+    return r;
+  if (offset < 0 || PGOFF(offset) || len == 0 ||
+  8031f7:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8031fb:	0f 88 d1 00 00 00    	js     8032d2 <mmap+0x101>
+  803201:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803204:	25 ff 0f 00 00       	and    $0xfff,%eax
+  803209:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80320c:	0f 85 c9 00 00 00    	jne    8032db <mmap+0x10a>
+  803212:	85 db                	test   %ebx,%ebx
+  803214:	0f 84 ca 00 00 00    	je     8032e4 <mmap+0x113>
+  80321a:	83 7d 14 02          	cmpl   $0x2,0x14(%ebp)
+  80321e:	0f 87 c0 00 00 00    	ja     8032e4 <mmap+0x113>
+      (perm != MAP_RDONLY && perm != MAP_PRIVATE && perm != MAP_SHARED))
+    return -E_INVAL;
+  len = ROUNDUP(len, PGSIZE);
+  803224:	81 c3 ff 0f 00 00    	add    $0xfff,%ebx
+  80322a:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  803230:	89 d9                	mov    %ebx,%ecx
+  803232:	89 5d c4             	mov    %ebx,-0x3c(%ebp)
+
+  // First fit: try the start of the region and the end of each
+  // mapping.
+  for (i = -1; i < NMMAP; i++) {
+  803235:	bb 4c 57 80 00       	mov    $0x80574c,%ebx
+  80323a:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+    if (i >= 0 && !mmaps[i].mm_va)
+      continue;
+    va = i < 0 ? MMAPBASE : mmaps[i].mm_va + mmaps[i].mm_len;
+  80323f:	bf 00 00 00 a0       	mov    $0xa0000000,%edi
+  803244:	eb 53                	jmp    803299 <mmap+0xc8>
+  803246:	bf 00 00 00 a0       	mov    $0xa0000000,%edi
+  80324b:	eb 4c                	jmp    803299 <mmap+0xc8>
+    if (len > MMAPTOP - va)
+      continue;
+    for (j = 0; j < NMMAP; j++)
+  80324d:	83 c0 01             	add    $0x1,%eax
+  803250:	83 f8 10             	cmp    $0x10,%eax
+  803253:	0f 84 e7 00 00 00    	je     803340 <mmap+0x16f>
+      if (mmaps[j].mm_va && va < mmaps[j].mm_va + mmaps[j].mm_len &&
+  803259:	8d 34 80             	lea    (%eax,%eax,4),%esi
+  80325c:	8b 14 b5 60 57 80 00 	mov    0x805760(,%esi,4),%edx
+  803263:	85 d2                	test   %edx,%edx
+  803265:	74 e6                	je     80324d <mmap+0x7c>
+  803267:	89 d1                	mov    %edx,%ecx
+  803269:	03 0c b5 64 57 80 00 	add    0x805764(,%esi,4),%ecx
+  803270:	39 cf                	cmp    %ecx,%edi
+  803272:	73 d9                	jae    80324d <mmap+0x7c>
+  803274:	39 da                	cmp    %ebx,%edx
+  803276:	73 d5                	jae    80324d <mmap+0x7c>
+  803278:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80327b:	8b 55 cc             	mov    -0x34(%ebp),%edx
+  80327e:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  for (i = -1; i < NMMAP; i++) {
+  803281:	83 c2 01             	add    $0x1,%edx
+  803284:	83 c3 14             	add    $0x14,%ebx
+  803287:	83 fa 10             	cmp    $0x10,%edx
+  80328a:	74 2b                	je     8032b7 <mmap+0xe6>
+    if (i >= 0 && !mmaps[i].mm_va)
+  80328c:	85 d2                	test   %edx,%edx
+  80328e:	78 b6                	js     803246 <mmap+0x75>
+  803290:	8b 3b                	mov    (%ebx),%edi
+  803292:	85 ff                	test   %edi,%edi
+  803294:	74 eb                	je     803281 <mmap+0xb0>
+    va = i < 0 ? MMAPBASE : mmaps[i].mm_va + mmaps[i].mm_len;
+  803296:	03 7b 04             	add    0x4(%ebx),%edi
+    if (len > MMAPTOP - va)
+  803299:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80329e:	29 f8                	sub    %edi,%eax
+  8032a0:	39 c8                	cmp    %ecx,%eax
+  8032a2:	72 dd                	jb     803281 <mmap+0xb0>
+    for (j = 0; j < NMMAP; j++)
+  8032a4:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+          mmaps[j].mm_va < va + len)
+  8032a7:	8d 34 0f             	lea    (%edi,%ecx,1),%esi
+  8032aa:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  8032ad:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  8032b0:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+  8032b3:	89 f3                	mov    %esi,%ebx
+  8032b5:	eb a2                	jmp    803259 <mmap+0x88>
+        break;
+    if (j == NMMAP)
+      break;
+  }
+  if (i == NMMAP)
+    return -E_NO_MEM;
+  8032b7:	c7 45 d4 fc ff ff ff 	movl   $0xfffffffc,-0x2c(%ebp)
+  8032be:	eb 75                	jmp    803335 <mmap+0x164>
+    ;
+  if (j == NMMAP)
+    return -E_NO_MEM;
+
+  if (_pgfault_handler == 0)
+    set_pgfault_handler(mmap_pgfault);
+  8032c0:	83 ec 0c             	sub    $0xc,%esp
+  8032c3:	68 99 31 80 00       	push   $0x803199
+  8032c8:	e8 f7 03 00 00       	call   8036c4 <set_pgfault_handler>
+  8032cd:	83 c4 10             	add    $0x10,%esp
+  8032d0:	eb 24                	jmp    8032f6 <mmap+0x125>
+    return -E_INVAL;
+  8032d2:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  8032d9:	eb 5a                	jmp    803335 <mmap+0x164>
+  8032db:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  8032e2:	eb 51                	jmp    803335 <mmap+0x164>
+  8032e4:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  8032eb:	eb 48                	jmp    803335 <mmap+0x164>
+  if (_pgfault_handler == 0)
+  8032ed:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  8032f4:	74 ca                	je     8032c0 <mmap+0xef>
+
+  mmaps[j].mm_va = va;
+  8032f6:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  8032fd:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803300:	c1 e2 02             	shl    $0x2,%edx
+  803303:	89 ba 60 57 80 00    	mov    %edi,0x805760(%edx)
+  mmaps[j].mm_len = len;
+  803309:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  80330c:	89 b2 64 57 80 00    	mov    %esi,0x805764(%edx)
+  mmaps[j].mm_fd = fdnum;
+  803312:	8b 75 08             	mov    0x8(%ebp),%esi
+  803315:	89 b2 68 57 80 00    	mov    %esi,0x805768(%edx)
+  mmaps[j].mm_offset = offset;
+  80331b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  80331e:	89 b2 6c 57 80 00    	mov    %esi,0x80576c(%edx)
+  mmaps[j].mm_perm = perm;
+  803324:	01 d8                	add    %ebx,%eax
+  803326:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  803329:	89 1c 85 70 57 80 00 	mov    %ebx,0x805770(,%eax,4)
+  *addr = (void *) va;
+  803330:	8b 45 18             	mov    0x18(%ebp),%eax
+  803333:	89 38                	mov    %edi,(%eax)
+  return 0;
+}
+  803335:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  803338:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80333b:	5b                   	pop    %ebx
+  80333c:	5e                   	pop    %esi
+  80333d:	5f                   	pop    %edi
+  80333e:	5d                   	pop    %ebp
+  80333f:	c3                   	ret
+  if (i == NMMAP)
+  803340:	b8 60 57 80 00       	mov    $0x805760,%eax
+  for (j = 0; j < NMMAP && mmaps[j].mm_va; j++)
+  803345:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+  803348:	83 c0 14             	add    $0x14,%eax
+  80334b:	83 78 ec 00          	cmpl   $0x0,-0x14(%eax)
+  80334f:	74 9c                	je     8032ed <mmap+0x11c>
+  803351:	83 c3 01             	add    $0x1,%ebx
+  803354:	83 fb 10             	cmp    $0x10,%ebx
+  803357:	75 ef                	jne    803348 <mmap+0x177>
+    return -E_NO_MEM;
+  803359:	c7 45 d4 fc ff ff ff 	movl   $0xfffffffc,-0x2c(%ebp)
+  803360:	eb d3                	jmp    803335 <mmap+0x164>
+
+00803362 <msync>:
+// nothing for other kinds of mapping.
+//
+// Returns 0 on success, < 0 on error.
+int
+msync(void *addr)
+{
+  803362:	55                   	push   %ebp
+  803363:	89 e5                	mov    %esp,%ebp
+  803365:	57                   	push   %edi
+  803366:	56                   	push   %esi
+  803367:	53                   	push   %ebx
+  803368:	81 ec ac 00 00 00    	sub    $0xac,%esp
+  struct Stat st;
+  off_t saved, off;
+  uintptr_t va;
+  int n, r;
+
+  if ((m = mmap_find((uintptr_t) addr)) == NULL)
+  80336e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803371:	e8 c6 fb ff ff       	call   802f3c <mmap_find>
+  803376:	85 c0                	test   %eax,%eax
+  803378:	0f 84 58 01 00 00    	je     8034d6 <msync+0x174>
+  80337e:	89 c7                	mov    %eax,%edi
+    return -E_INVAL;
+  if (m->mm_perm != MAP_SHARED)
+    return 0;
+  803380:	bb 00 00 00 00       	mov    $0x0,%ebx
+  if (m->mm_perm != MAP_SHARED)
+  803385:	83 78 10 02          	cmpl   $0x2,0x10(%eax)
+  803389:	74 0a                	je     803395 <msync+0x33>
+                          PTE_P | PTE_U | PTE_W)) < 0)
+      break;
+  }
+  fd->fd_offset = saved;
+  return r < 0 ? r : 0;
+}
+  80338b:	89 d8                	mov    %ebx,%eax
+  80338d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803390:	5b                   	pop    %ebx
+  803391:	5e                   	pop    %esi
+  803392:	5f                   	pop    %edi
+  803393:	5d                   	pop    %ebp
+  803394:	c3                   	ret
+  if ((r = fd_lookup(m->mm_fd, &fd)) < 0 || (r = fstat(m->mm_fd, &st)) < 0)
+  803395:	83 ec 08             	sub    $0x8,%esp
+  803398:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80339b:	50                   	push   %eax
+  80339c:	ff 77 08             	push   0x8(%edi)
+  80339f:	e8 75 e3 ff ff       	call   801719 <fd_lookup>
+  8033a4:	89 c3                	mov    %eax,%ebx
+  8033a6:	83 c4 10             	add    $0x10,%esp
+  8033a9:	85 c0                	test   %eax,%eax
+  8033ab:	78 de                	js     80338b <msync+0x29>
+  8033ad:	83 ec 08             	sub    $0x8,%esp
+  8033b0:	8d 85 58 ff ff ff    	lea    -0xa8(%ebp),%eax
+  8033b6:	50                   	push   %eax
+  8033b7:	ff 77 08             	push   0x8(%edi)
+  8033ba:	e8 fd e7 ff ff       	call   801bbc <fstat>
+  8033bf:	89 c3                	mov    %eax,%ebx
+  8033c1:	83 c4 10             	add    $0x10,%esp
+  8033c4:	85 c0                	test   %eax,%eax
+  8033c6:	78 c3                	js     80338b <msync+0x29>
+  saved = fd->fd_offset;
+  8033c8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8033cb:	8b 40 04             	mov    0x4(%eax),%eax
+  8033ce:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%ebp)
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE) {
+  8033d4:	8b 37                	mov    (%edi),%esi
+  8033d6:	eb 29                	jmp    803401 <msync+0x9f>
+    if ((r = sys_page_map(0, (void *) va, 0, (void *) va,
+  8033d8:	83 ec 0c             	sub    $0xc,%esp
+  8033db:	6a 07                	push   $0x7
+  8033dd:	8b 85 50 ff ff ff    	mov    -0xb0(%ebp),%eax
+  8033e3:	50                   	push   %eax
+  8033e4:	6a 00                	push   $0x0
+  8033e6:	50                   	push   %eax
+  8033e7:	6a 00                	push   $0x0
+  8033e9:	e8 ae d8 ff ff       	call   800c9c <sys_page_map>
+  8033ee:	89 c3                	mov    %eax,%ebx
+  8033f0:	83 c4 20             	add    $0x20,%esp
+  8033f3:	85 c0                	test   %eax,%eax
+  8033f5:	0f 88 c0 00 00 00    	js     8034bb <msync+0x159>
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE) {
+  8033fb:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803401:	8b 07                	mov    (%edi),%eax
+  803403:	89 85 54 ff ff ff    	mov    %eax,-0xac(%ebp)
+  803409:	03 47 04             	add    0x4(%edi),%eax
+  80340c:	39 c6                	cmp    %eax,%esi
+  80340e:	0f 83 a7 00 00 00    	jae    8034bb <msync+0x159>
+    if (!va_mapped(va) || !(uvpt[PGNUM(va)] & PTE_D))
+  803414:	89 f0                	mov    %esi,%eax
+  803416:	e8 63 fb ff ff       	call   802f7e <va_mapped>
+  80341b:	84 c0                	test   %al,%al
+  80341d:	74 dc                	je     8033fb <msync+0x99>
+  80341f:	89 f0                	mov    %esi,%eax
+  803421:	c1 e8 0c             	shr    $0xc,%eax
+  803424:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80342b:	a8 40                	test   $0x40,%al
+  80342d:	74 cc                	je     8033fb <msync+0x99>
+    off = m->mm_offset + (va - m->mm_va);
+  80342f:	8b 47 0c             	mov    0xc(%edi),%eax
+  803432:	8b 8d 54 ff ff ff    	mov    -0xac(%ebp),%ecx
+  803438:	29 c8                	sub    %ecx,%eax
+  80343a:	01 f0                	add    %esi,%eax
+    if (off >= st.st_size)
+  80343c:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80343f:	39 c2                	cmp    %eax,%edx
+  803441:	7e 78                	jle    8034bb <msync+0x159>
+    n = MIN(PGSIZE, st.st_size - off);
+  803443:	29 c2                	sub    %eax,%edx
+  803445:	89 d1                	mov    %edx,%ecx
+  803447:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80344c:	39 d1                	cmp    %edx,%ecx
+  80344e:	0f 4e d1             	cmovle %ecx,%edx
+  803451:	89 95 54 ff ff ff    	mov    %edx,-0xac(%ebp)
+    if ((r = seek(m->mm_fd, off)) < 0 ||
+  803457:	83 ec 08             	sub    $0x8,%esp
+  80345a:	50                   	push   %eax
+  80345b:	ff 77 08             	push   0x8(%edi)
+  80345e:	e8 b1 e6 ff ff       	call   801b14 <seek>
+  803463:	89 c3                	mov    %eax,%ebx
+  803465:	83 c4 10             	add    $0x10,%esp
+  803468:	85 c0                	test   %eax,%eax
+  80346a:	78 4f                	js     8034bb <msync+0x159>
+        (r = write(m->mm_fd, (void *) va, n)) < 0)
+  80346c:	89 b5 50 ff ff ff    	mov    %esi,-0xb0(%ebp)
+  803472:	83 ec 04             	sub    $0x4,%esp
+  803475:	ff b5 54 ff ff ff    	push   -0xac(%ebp)
+  80347b:	56                   	push   %esi
+  80347c:	ff 77 08             	push   0x8(%edi)
+  80347f:	e8 0e e6 ff ff       	call   801a92 <write>
+  803484:	89 c3                	mov    %eax,%ebx
+    if ((r = seek(m->mm_fd, off)) < 0 ||
+  803486:	83 c4 10             	add    $0x10,%esp
+  803489:	85 c0                	test   %eax,%eax
+  80348b:	78 2e                	js     8034bb <msync+0x159>
+    if (r < n && (r = write(m->mm_fd, (char *) va + r, n - r)) < 0)
+  80348d:	8b 95 54 ff ff ff    	mov    -0xac(%ebp),%edx
+  803493:	39 c2                	cmp    %eax,%edx
+  803495:	0f 8e 3d ff ff ff    	jle    8033d8 <msync+0x76>
+  80349b:	89 d0                	mov    %edx,%eax
+  80349d:	29 d8                	sub    %ebx,%eax
+  80349f:	01 f3                	add    %esi,%ebx
+  8034a1:	83 ec 04             	sub    $0x4,%esp
+  8034a4:	50                   	push   %eax
+  8034a5:	53                   	push   %ebx
+  8034a6:	ff 77 08             	push   0x8(%edi)
+  8034a9:	e8 e4 e5 ff ff       	call   801a92 <write>
+  8034ae:	89 c3                	mov    %eax,%ebx
+  8034b0:	83 c4 10             	add    $0x10,%esp
+  8034b3:	85 c0                	test   %eax,%eax
+  8034b5:	0f 89 1d ff ff ff    	jns    8033d8 <msync+0x76>
+  fd->fd_offset = saved;
+  8034bb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8034be:	8b 8d 4c ff ff ff    	mov    -0xb4(%ebp),%ecx
+  8034c4:	89 48 04             	mov    %ecx,0x4(%eax)
+  return r < 0 ? r : 0;
+  8034c7:	85 db                	test   %ebx,%ebx
+  8034c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034ce:	0f 4f d8             	cmovg  %eax,%ebx
+  8034d1:	e9 b5 fe ff ff       	jmp    80338b <msync+0x29>
+    return -E_INVAL;
+  8034d6:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8034db:	e9 ab fe ff ff       	jmp    80338b <msync+0x29>
+
+008034e0 <munmap>:
+// Remove the mapping at 'addr', writing a MAP_SHARED one back first.
+//
+// Returns 0 on success, < 0 on error.
+int
+munmap(void *addr)
+{
+  8034e0:	55                   	push   %ebp
+  8034e1:	89 e5                	mov    %esp,%ebp
+  8034e3:	56                   	push   %esi
+  8034e4:	53                   	push   %ebx
+  8034e5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct Mmap *m;
+  uintptr_t va;
+  int r;
+
+  if ((m = mmap_find((uintptr_t) addr)) == NULL)
+  8034e8:	89 d8                	mov    %ebx,%eax
+  8034ea:	e8 4d fa ff ff       	call   802f3c <mmap_find>
+  8034ef:	85 c0                	test   %eax,%eax
+  8034f1:	74 56                	je     803549 <munmap+0x69>
+  8034f3:	89 c6                	mov    %eax,%esi
+    return -E_INVAL;
+  if ((r = msync(addr)) < 0)
+  8034f5:	83 ec 0c             	sub    $0xc,%esp
+  8034f8:	53                   	push   %ebx
+  8034f9:	e8 64 fe ff ff       	call   803362 <msync>
+  8034fe:	83 c4 10             	add    $0x10,%esp
+  803501:	85 c0                	test   %eax,%eax
+  803503:	78 3d                	js     803542 <munmap+0x62>
+    return r;
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE)
+  803505:	8b 1e                	mov    (%esi),%ebx
+  803507:	eb 06                	jmp    80350f <munmap+0x2f>
+  803509:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80350f:	8b 46 04             	mov    0x4(%esi),%eax
+  803512:	03 06                	add    (%esi),%eax
+  803514:	39 c3                	cmp    %eax,%ebx
+  803516:	73 1f                	jae    803537 <munmap+0x57>
+    if (va_mapped(va) && (r = sys_page_unmap(0, (void *) va)) < 0)
+  803518:	89 d8                	mov    %ebx,%eax
+  80351a:	e8 5f fa ff ff       	call   802f7e <va_mapped>
+  80351f:	84 c0                	test   %al,%al
+  803521:	74 e6                	je     803509 <munmap+0x29>
+  803523:	83 ec 08             	sub    $0x8,%esp
+  803526:	53                   	push   %ebx
+  803527:	6a 00                	push   $0x0
+  803529:	e8 b0 d7 ff ff       	call   800cde <sys_page_unmap>
+  80352e:	83 c4 10             	add    $0x10,%esp
+  803531:	85 c0                	test   %eax,%eax
+  803533:	79 d4                	jns    803509 <munmap+0x29>
+  803535:	eb 0b                	jmp    803542 <munmap+0x62>
+      return r;
+  m->mm_va = 0;
+  803537:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  return 0;
+  80353d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803542:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803545:	5b                   	pop    %ebx
+  803546:	5e                   	pop    %esi
+  803547:	5d                   	pop    %ebp
+  803548:	c3                   	ret
+    return -E_INVAL;
+  803549:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80354e:	eb f2                	jmp    803542 <munmap+0x62>
+
+00803550 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  803550:	b8 00 00 00 00       	mov    $0x0,%eax
+  803555:	c3                   	ret
+
+00803556 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803556:	55                   	push   %ebp
+  803557:	89 e5                	mov    %esp,%ebp
+  803559:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  80355c:	68 9b 3f 80 00       	push   $0x803f9b
+  803561:	ff 75 0c             	push   0xc(%ebp)
+  803564:	e8 c1 d2 ff ff       	call   80082a <strcpy>
+  return 0;
+}
+  803569:	b8 00 00 00 00       	mov    $0x0,%eax
+  80356e:	c9                   	leave
+  80356f:	c3                   	ret
+
+00803570 <devcons_write>:
+{
+  803570:	55                   	push   %ebp
+  803571:	89 e5                	mov    %esp,%ebp
+  803573:	57                   	push   %edi
+  803574:	56                   	push   %esi
+  803575:	53                   	push   %ebx
+  803576:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  80357c:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  803581:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  803587:	eb 2e                	jmp    8035b7 <devcons_write+0x47>
+    m = n - tot;
+  803589:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80358c:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  80358e:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803593:	39 c3                	cmp    %eax,%ebx
+  803595:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  803598:	83 ec 04             	sub    $0x4,%esp
+  80359b:	53                   	push   %ebx
+  80359c:	89 f0                	mov    %esi,%eax
+  80359e:	03 45 0c             	add    0xc(%ebp),%eax
+  8035a1:	50                   	push   %eax
+  8035a2:	57                   	push   %edi
+  8035a3:	e8 08 d4 ff ff       	call   8009b0 <memmove>
+    sys_cputs(buf, m);
+  8035a8:	83 c4 08             	add    $0x8,%esp
+  8035ab:	53                   	push   %ebx
+  8035ac:	57                   	push   %edi
+  8035ad:	e8 a8 d5 ff ff       	call   800b5a <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  8035b2:	01 de                	add    %ebx,%esi
+  8035b4:	83 c4 10             	add    $0x10,%esp
+  8035b7:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8035ba:	72 cd                	jb     803589 <devcons_write+0x19>
+}
+  8035bc:	89 f0                	mov    %esi,%eax
+  8035be:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8035c1:	5b                   	pop    %ebx
+  8035c2:	5e                   	pop    %esi
+  8035c3:	5f                   	pop    %edi
+  8035c4:	5d                   	pop    %ebp
+  8035c5:	c3                   	ret
+
+008035c6 <devcons_read>:
+{
+  8035c6:	55                   	push   %ebp
+  8035c7:	89 e5                	mov    %esp,%ebp
+  8035c9:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  8035cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035d1:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8035d5:	75 07                	jne    8035de <devcons_read+0x18>
+  8035d7:	eb 1f                	jmp    8035f8 <devcons_read+0x32>
+    sys_yield();
+  8035d9:	e8 19 d6 ff ff       	call   800bf7 <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  8035de:	e8 95 d5 ff ff       	call   800b78 <sys_cgetc>
+  8035e3:	85 c0                	test   %eax,%eax
+  8035e5:	74 f2                	je     8035d9 <devcons_read+0x13>
+  if (c < 0)
+  8035e7:	78 0f                	js     8035f8 <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  8035e9:	83 f8 04             	cmp    $0x4,%eax
+  8035ec:	74 0c                	je     8035fa <devcons_read+0x34>
+  *(char*)vbuf = c;
+  8035ee:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8035f1:	88 02                	mov    %al,(%edx)
+  return 1;
+  8035f3:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8035f8:	c9                   	leave
+  8035f9:	c3                   	ret
+    return 0;
+  8035fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035ff:	eb f7                	jmp    8035f8 <devcons_read+0x32>
+
+00803601 <cputchar>:
+{
+  803601:	55                   	push   %ebp
+  803602:	89 e5                	mov    %esp,%ebp
+  803604:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  803607:	8b 45 08             	mov    0x8(%ebp),%eax
+  80360a:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  80360d:	6a 01                	push   $0x1
+  80360f:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803612:	50                   	push   %eax
+  803613:	e8 42 d5 ff ff       	call   800b5a <sys_cputs>
+}
+  803618:	83 c4 10             	add    $0x10,%esp
+  80361b:	c9                   	leave
+  80361c:	c3                   	ret
+
+0080361d <getchar>:
+{
+  80361d:	55                   	push   %ebp
+  80361e:	89 e5                	mov    %esp,%ebp
+  803620:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  803623:	6a 01                	push   $0x1
+  803625:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803628:	50                   	push   %eax
+  803629:	6a 00                	push   $0x0
+  80362b:	e8 94 e3 ff ff       	call   8019c4 <read>
+  if (r < 0)
+  803630:	83 c4 10             	add    $0x10,%esp
+  803633:	85 c0                	test   %eax,%eax
+  803635:	78 06                	js     80363d <getchar+0x20>
+  if (r < 1)
+  803637:	74 06                	je     80363f <getchar+0x22>
+  return c;
+  803639:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80363d:	c9                   	leave
+  80363e:	c3                   	ret
+    return -E_EOF;
+  80363f:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803644:	eb f7                	jmp    80363d <getchar+0x20>
+
+00803646 <iscons>:
+{
+  803646:	55                   	push   %ebp
+  803647:	89 e5                	mov    %esp,%ebp
+  803649:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80364c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80364f:	50                   	push   %eax
+  803650:	ff 75 08             	push   0x8(%ebp)
+  803653:	e8 c1 e0 ff ff       	call   801719 <fd_lookup>
+  803658:	83 c4 10             	add    $0x10,%esp
+  80365b:	85 c0                	test   %eax,%eax
+  80365d:	78 11                	js     803670 <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  80365f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803662:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  803668:	39 10                	cmp    %edx,(%eax)
+  80366a:	0f 94 c0             	sete   %al
+  80366d:	0f b6 c0             	movzbl %al,%eax
+}
+  803670:	c9                   	leave
+  803671:	c3                   	ret
+
+00803672 <opencons>:
+{
+  803672:	55                   	push   %ebp
+  803673:	89 e5                	mov    %esp,%ebp
+  803675:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  803678:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80367b:	50                   	push   %eax
+  80367c:	e8 42 e0 ff ff       	call   8016c3 <fd_alloc>
+  803681:	83 c4 10             	add    $0x10,%esp
+  803684:	85 c0                	test   %eax,%eax
+  803686:	78 3a                	js     8036c2 <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803688:	83 ec 04             	sub    $0x4,%esp
+  80368b:	68 07 04 00 00       	push   $0x407
+  803690:	ff 75 f4             	push   -0xc(%ebp)
+  803693:	6a 00                	push   $0x0
+  803695:	e8 bf d5 ff ff       	call   800c59 <sys_page_alloc>
+  80369a:	83 c4 10             	add    $0x10,%esp
+  80369d:	85 c0                	test   %eax,%eax
+  80369f:	78 21                	js     8036c2 <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  8036a1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8036a4:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  8036aa:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  8036ac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8036af:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  8036b6:	83 ec 0c             	sub    $0xc,%esp
+  8036b9:	50                   	push   %eax
+  8036ba:	e8 e0 df ff ff       	call   80169f <fd2num>
+  8036bf:	83 c4 10             	add    $0x10,%esp
+}
+  8036c2:	c9                   	leave
+  8036c3:	c3                   	ret
+
+008036c4 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8036c4:	55                   	push   %ebp
+  8036c5:	89 e5                	mov    %esp,%ebp
+  8036c7:	53                   	push   %ebx
+  8036c8:	83 ec 04             	sub    $0x4,%esp
+  int r;
+
+  if (_pgfault_handler == 0) {
+  8036cb:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  8036d2:	74 0d                	je     8036e1 <set_pgfault_handler+0x1d>
+
+    sys_env_set_pgfault_upcall(id, _pgfault_upcall);
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  8036d4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8036d7:	a3 00 70 80 00       	mov    %eax,0x807000
+}
+  8036dc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8036df:	c9                   	leave
+  8036e0:	c3                   	ret
+    envid_t id = sys_getenvid();
+  8036e1:	e8 f2 d4 ff ff       	call   800bd8 <sys_getenvid>
+  8036e6:	89 c3                	mov    %eax,%ebx
+    sys_page_alloc(id, (void *) (UXSTACKTOP - PGSIZE), (PTE_P | PTE_U | PTE_W));
+  8036e8:	83 ec 04             	sub    $0x4,%esp
+  8036eb:	6a 07                	push   $0x7
+  8036ed:	68 00 f0 bf ee       	push   $0xeebff000
+  8036f2:	50                   	push   %eax
+  8036f3:	e8 61 d5 ff ff       	call   800c59 <sys_page_alloc>
+    sys_env_set_pgfault_upcall(id, _pgfault_upcall);
+  8036f8:	83 c4 08             	add    $0x8,%esp
+  8036fb:	68 0b 37 80 00       	push   $0x80370b
+  803700:	53                   	push   %ebx
+  803701:	e8 c8 d7 ff ff       	call   800ece <sys_env_set_pgfault_upcall>
+  803706:	83 c4 10             	add    $0x10,%esp
+  803709:	eb c9                	jmp    8036d4 <set_pgfault_handler+0x10>
+
+0080370b <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  80370b:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  80370c:	a1 00 70 80 00       	mov    0x807000,%eax
+	call *%eax
+  803711:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  803713:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+  movl 48(%esp), %eax       // move trap time esp to eax
+  803716:	8b 44 24 30          	mov    0x30(%esp),%eax
+  subl $4, %eax             // make room for eip on trap time esp
+  80371a:	83 e8 04             	sub    $0x4,%eax
+  movl %eax, 48(%esp)       // move value to esp
+  80371d:	89 44 24 30          	mov    %eax,0x30(%esp)
+  movl 40(%esp), %ebx       // move trap time eip to ebx
+  803721:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+  movl %ebx, 0(%eax)
+  803725:	89 18                	mov    %ebx,(%eax)
+
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+  addl $0x08,%esp
+  803727:	83 c4 08             	add    $0x8,%esp
+  popal
+  80372a:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+  addl $4, %esp          // skip tf->eip
+  80372b:	83 c4 04             	add    $0x4,%esp
+  popf                 // pop stack value into flags register
+  80372e:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+  popl %esp
+  80372f:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+  ret
+  803730:	c3                   	ret
+
+00803731 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803731:	55                   	push   %ebp
+  803732:	89 e5                	mov    %esp,%ebp
+  803734:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  803737:	89 c2                	mov    %eax,%edx
+  803739:	c1 ea 16             	shr    $0x16,%edx
+  80373c:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  803743:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  803748:	f6 c1 01             	test   $0x1,%cl
+  80374b:	74 1c                	je     803769 <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  80374d:	c1 e8 0c             	shr    $0xc,%eax
+  803750:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  803757:	a8 01                	test   $0x1,%al
+  803759:	74 0e                	je     803769 <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  80375b:	c1 e8 0c             	shr    $0xc,%eax
+  80375e:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  803765:	ef 
+  803766:	0f b7 d2             	movzwl %dx,%edx
+}
+  803769:	89 d0                	mov    %edx,%eax
+  80376b:	5d                   	pop    %ebp
+  80376c:	c3                   	ret
+
+0080376d <udivmod>:
+  80376d:	55                   	push   %ebp
+  80376e:	57                   	push   %edi
+  80376f:	56                   	push   %esi
+  803770:	53                   	push   %ebx
+  803771:	83 ec 14             	sub    $0x14,%esp
+  803774:	8b 74 24 28          	mov    0x28(%esp),%esi
+  803778:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  80377c:	89 fb                	mov    %edi,%ebx
+  80377e:	09 f3                	or     %esi,%ebx
+  803780:	0f 84 88 00 00 00    	je     80380e <udivmod+0xa1>
+  803786:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80378b:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  803792:	00 
+  803793:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80379a:	00 
+  80379b:	89 cd                	mov    %ecx,%ebp
+  80379d:	89 34 24             	mov    %esi,(%esp)
+  8037a0:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  8037a4:	eb 08                	jmp    8037ae <udivmod+0x41>
+  8037a6:	83 ed 01             	sub    $0x1,%ebp
+  8037a9:	83 fd ff             	cmp    $0xffffffff,%ebp
+  8037ac:	74 6c                	je     80381a <udivmod+0xad>
+  8037ae:	89 c3                	mov    %eax,%ebx
+  8037b0:	89 d6                	mov    %edx,%esi
+  8037b2:	89 e9                	mov    %ebp,%ecx
+  8037b4:	0f ad f3             	shrd   %cl,%esi,%ebx
+  8037b7:	d3 ee                	shr    %cl,%esi
+  8037b9:	f6 c1 20             	test   $0x20,%cl
+  8037bc:	74 04                	je     8037c2 <udivmod+0x55>
+  8037be:	89 f3                	mov    %esi,%ebx
+  8037c0:	31 f6                	xor    %esi,%esi
+  8037c2:	8b 3c 24             	mov    (%esp),%edi
+  8037c5:	39 fb                	cmp    %edi,%ebx
+  8037c7:	89 f7                	mov    %esi,%edi
+  8037c9:	8b 1c 24             	mov    (%esp),%ebx
+  8037cc:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8037d0:	19 f7                	sbb    %esi,%edi
+  8037d2:	72 d2                	jb     8037a6 <udivmod+0x39>
+  8037d4:	89 f7                	mov    %esi,%edi
+  8037d6:	89 de                	mov    %ebx,%esi
+  8037d8:	89 e9                	mov    %ebp,%ecx
+  8037da:	0f a5 f7             	shld   %cl,%esi,%edi
+  8037dd:	d3 e6                	shl    %cl,%esi
+  8037df:	f6 c1 20             	test   $0x20,%cl
+  8037e2:	74 04                	je     8037e8 <udivmod+0x7b>
+  8037e4:	89 f7                	mov    %esi,%edi
+  8037e6:	31 f6                	xor    %esi,%esi
+  8037e8:	29 f0                	sub    %esi,%eax
+  8037ea:	19 fa                	sbb    %edi,%edx
+  8037ec:	be 01 00 00 00       	mov    $0x1,%esi
+  8037f1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037f6:	0f a5 f7             	shld   %cl,%esi,%edi
+  8037f9:	d3 e6                	shl    %cl,%esi
+  8037fb:	f6 c1 20             	test   $0x20,%cl
+  8037fe:	74 04                	je     803804 <udivmod+0x97>
+  803800:	89 f7                	mov    %esi,%edi
+  803802:	31 f6                	xor    %esi,%esi
+  803804:	09 74 24 08          	or     %esi,0x8(%esp)
+  803808:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  80380c:	eb 98                	jmp    8037a6 <udivmod+0x39>
+  80380e:	89 f0                	mov    %esi,%eax
+  803810:	89 fa                	mov    %edi,%edx
+  803812:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803816:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  80381a:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  80381e:	89 01                	mov    %eax,(%ecx)
+  803820:	89 51 04             	mov    %edx,0x4(%ecx)
+  803823:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803827:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80382b:	83 c4 14             	add    $0x14,%esp
+  80382e:	5b                   	pop    %ebx
+  80382f:	5e                   	pop    %esi
+  803830:	5f                   	pop    %edi
+  803831:	5d                   	pop    %ebp
+  803832:	c3                   	ret
+
+00803833 <__udivdi3>:
+  803833:	83 ec 18             	sub    $0x18,%esp
+  803836:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80383a:	50                   	push   %eax
+  80383b:	ff 74 24 2c          	push   0x2c(%esp)
+  80383f:	ff 74 24 2c          	push   0x2c(%esp)
+  803843:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803847:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80384b:	e8 1d ff ff ff       	call   80376d <udivmod>
+  803850:	83 c4 24             	add    $0x24,%esp
+  803853:	c3                   	ret
+
+00803854 <__umoddi3>:
+  803854:	83 ec 18             	sub    $0x18,%esp
+  803857:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80385b:	50                   	push   %eax
+  80385c:	ff 74 24 2c          	push   0x2c(%esp)
+  803860:	ff 74 24 2c          	push   0x2c(%esp)
+  803864:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803868:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80386c:	e8 fc fe ff ff       	call   80376d <udivmod>
+  803871:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803875:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803879:	83 c4 24             	add    $0x24,%esp
+  80387c:	c3                   	ret
+
+0080387d <__divdi3>:
+  80387d:	56                   	push   %esi
+  80387e:	53                   	push   %ebx
+  80387f:	83 ec 14             	sub    $0x14,%esp
+  803882:	8b 44 24 20          	mov    0x20(%esp),%eax
+  803886:	8b 54 24 24          	mov    0x24(%esp),%edx
+  80388a:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  80388e:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  803892:	85 d2                	test   %edx,%edx
+  803894:	78 18                	js     8038ae <__divdi3+0x31>
+  803896:	85 db                	test   %ebx,%ebx
+  803898:	78 3e                	js     8038d8 <__divdi3+0x5b>
+  80389a:	83 ec 04             	sub    $0x4,%esp
+  80389d:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8038a1:	56                   	push   %esi
+  8038a2:	53                   	push   %ebx
+  8038a3:	51                   	push   %ecx
+  8038a4:	e8 c4 fe ff ff       	call   80376d <udivmod>
+  8038a9:	83 c4 10             	add    $0x10,%esp
+  8038ac:	eb 24                	jmp    8038d2 <__divdi3+0x55>
+  8038ae:	f7 d8                	neg    %eax
+  8038b0:	83 d2 00             	adc    $0x0,%edx
+  8038b3:	f7 da                	neg    %edx
+  8038b5:	85 db                	test   %ebx,%ebx
+  8038b7:	78 3a                	js     8038f3 <__divdi3+0x76>
+  8038b9:	83 ec 04             	sub    $0x4,%esp
+  8038bc:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8038c0:	56                   	push   %esi
+  8038c1:	53                   	push   %ebx
+  8038c2:	51                   	push   %ecx
+  8038c3:	e8 a5 fe ff ff       	call   80376d <udivmod>
+  8038c8:	83 c4 10             	add    $0x10,%esp
+  8038cb:	f7 d8                	neg    %eax
+  8038cd:	83 d2 00             	adc    $0x0,%edx
+  8038d0:	f7 da                	neg    %edx
+  8038d2:	83 c4 14             	add    $0x14,%esp
+  8038d5:	5b                   	pop    %ebx
+  8038d6:	5e                   	pop    %esi
+  8038d7:	c3                   	ret
+  8038d8:	83 ec 04             	sub    $0x4,%esp
+  8038db:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8038df:	56                   	push   %esi
+  8038e0:	f7 d9                	neg    %ecx
+  8038e2:	83 d3 00             	adc    $0x0,%ebx
+  8038e5:	f7 db                	neg    %ebx
+  8038e7:	53                   	push   %ebx
+  8038e8:	51                   	push   %ecx
+  8038e9:	e8 7f fe ff ff       	call   80376d <udivmod>
+  8038ee:	83 c4 10             	add    $0x10,%esp
+  8038f1:	eb d8                	jmp    8038cb <__divdi3+0x4e>
+  8038f3:	83 ec 04             	sub    $0x4,%esp
+  8038f6:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8038fa:	56                   	push   %esi
+  8038fb:	f7 d9                	neg    %ecx
+  8038fd:	83 d3 00             	adc    $0x0,%ebx
+  803900:	f7 db                	neg    %ebx
+  803902:	53                   	push   %ebx
+  803903:	51                   	push   %ecx
+  803904:	e8 64 fe ff ff       	call   80376d <udivmod>
+  803909:	83 c4 10             	add    $0x10,%esp
+  80390c:	eb c4                	jmp    8038d2 <__divdi3+0x55>
+
+0080390e <__moddi3>:
+  80390e:	55                   	push   %ebp
+  80390f:	57                   	push   %edi
+  803910:	56                   	push   %esi
+  803911:	53                   	push   %ebx
+  803912:	83 ec 24             	sub    $0x24,%esp
+  803915:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803919:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80391d:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  803921:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  803925:	85 d2                	test   %edx,%edx
+  803927:	78 3b                	js     803964 <__moddi3+0x56>
+  803929:	83 ec 04             	sub    $0x4,%esp
+  80392c:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803930:	56                   	push   %esi
+  803931:	89 ce                	mov    %ecx,%esi
+  803933:	f7 de                	neg    %esi
+  803935:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803939:	89 de                	mov    %ebx,%esi
+  80393b:	83 d6 00             	adc    $0x0,%esi
+  80393e:	f7 de                	neg    %esi
+  803940:	89 74 24 14          	mov    %esi,0x14(%esp)
+  803944:	8b 74 24 08          	mov    0x8(%esp),%esi
+  803948:	0f 48 f1             	cmovs  %ecx,%esi
+  80394b:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  803950:	53                   	push   %ebx
+  803951:	56                   	push   %esi
+  803952:	e8 16 fe ff ff       	call   80376d <udivmod>
+  803957:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80395b:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80395f:	83 c4 10             	add    $0x10,%esp
+  803962:	eb 47                	jmp    8039ab <__moddi3+0x9d>
+  803964:	f7 d8                	neg    %eax
+  803966:	83 d2 00             	adc    $0x0,%edx
+  803969:	f7 da                	neg    %edx
+  80396b:	83 ec 04             	sub    $0x4,%esp
+  80396e:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803972:	56                   	push   %esi
+  803973:	89 cf                	mov    %ecx,%edi
+  803975:	f7 df                	neg    %edi
+  803977:	89 de                	mov    %ebx,%esi
+  803979:	83 d6 00             	adc    $0x0,%esi
+  80397c:	f7 de                	neg    %esi
+  80397e:	0f 49 cf             	cmovns %edi,%ecx
+  803981:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  803985:	0f 49 de             	cmovns %esi,%ebx
+  803988:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  80398c:	ff 74 24 0c          	push   0xc(%esp)
+  803990:	ff 74 24 0c          	push   0xc(%esp)
+  803994:	e8 d4 fd ff ff       	call   80376d <udivmod>
+  803999:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80399d:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8039a1:	f7 d8                	neg    %eax
+  8039a3:	83 d2 00             	adc    $0x0,%edx
+  8039a6:	f7 da                	neg    %edx
+  8039a8:	83 c4 10             	add    $0x10,%esp
+  8039ab:	83 c4 24             	add    $0x24,%esp
+  8039ae:	5b                   	pop    %ebx
+  8039af:	5e                   	pop    %esi
+  8039b0:	5f                   	pop    %edi
+  8039b1:	5d                   	pop    %ebp
+  8039b2:	c3                   	ret
@@ -0,0 +1,7924 @@
+
+obj/user/primespipe.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 06 02 00 00       	call   800237 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <primeproc>:
+
+#include <inc/lib.h>
+
+unsigned
+primeproc(int fd)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 1c             	sub    $0x1c,%esp
+  80003c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int i, id, p, pfd[2], wfd, r;
+
+  // fetch a prime from our left neighbor
+top:
+  if ((r = readn(fd, &p, 4)) != 4)
+  80003f:	8d 75 e0             	lea    -0x20(%ebp),%esi
+    panic("primeproc could not read initial prime: %d, %e", r, r >= 0 ? 0 : r);
+
+  cprintf("%d\n", p);
+
+  // fork a right neighbor to continue the chain
+  if ((i = pipe(pfd)) < 0)
+  800042:	8d 7d d8             	lea    -0x28(%ebp),%edi
+  if ((r = readn(fd, &p, 4)) != 4)
+  800045:	83 ec 04             	sub    $0x4,%esp
+  800048:	6a 04                	push   $0x4
+  80004a:	56                   	push   %esi
+  80004b:	53                   	push   %ebx
+  80004c:	e8 da 19 00 00       	call   801a2b <readn>
+  800051:	83 c4 10             	add    $0x10,%esp
+  800054:	83 f8 04             	cmp    $0x4,%eax
+  800057:	75 49                	jne    8000a2 <primeproc+0x6f>
+  cprintf("%d\n", p);
+  800059:	83 ec 08             	sub    $0x8,%esp
+  80005c:	ff 75 e0             	push   -0x20(%ebp)
+  80005f:	68 41 3b 80 00       	push   $0x803b41
+  800064:	e8 16 03 00 00       	call   80037f <cprintf>
+  if ((i = pipe(pfd)) < 0)
+  800069:	89 3c 24             	mov    %edi,(%esp)
+  80006c:	e8 b3 2c 00 00       	call   802d24 <pipe>
+  800071:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800074:	83 c4 10             	add    $0x10,%esp
+  800077:	85 c0                	test   %eax,%eax
+  800079:	78 47                	js     8000c2 <primeproc+0x8f>
+    panic("pipe: %e", i);
+  if ((id = fork()) < 0)
+  80007b:	e8 89 13 00 00       	call   801409 <fork>
+  800080:	85 c0                	test   %eax,%eax
+  800082:	78 50                	js     8000d4 <primeproc+0xa1>
+    panic("fork: %e", id);
+  if (id == 0) {
+  800084:	75 60                	jne    8000e6 <primeproc+0xb3>
+    close(fd);
+  800086:	83 ec 0c             	sub    $0xc,%esp
+  800089:	53                   	push   %ebx
+  80008a:	e8 8d 17 00 00       	call   80181c <close>
+    close(pfd[1]);
+  80008f:	83 c4 04             	add    $0x4,%esp
+  800092:	ff 75 dc             	push   -0x24(%ebp)
+  800095:	e8 82 17 00 00       	call   80181c <close>
+    fd = pfd[0];
+  80009a:	8b 5d d8             	mov    -0x28(%ebp),%ebx
+    goto top;
+  80009d:	83 c4 10             	add    $0x10,%esp
+  8000a0:	eb a3                	jmp    800045 <primeproc+0x12>
+    panic("primeproc could not read initial prime: %d, %e", r, r >= 0 ? 0 : r);
+  8000a2:	83 ec 0c             	sub    $0xc,%esp
+  8000a5:	85 c0                	test   %eax,%eax
+  8000a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000ac:	0f 4e d0             	cmovle %eax,%edx
+  8000af:	52                   	push   %edx
+  8000b0:	50                   	push   %eax
+  8000b1:	68 00 3b 80 00       	push   $0x803b00
+  8000b6:	6a 15                	push   $0x15
+  8000b8:	68 2f 3b 80 00       	push   $0x803b2f
+  8000bd:	e8 e2 01 00 00       	call   8002a4 <_panic>
+    panic("pipe: %e", i);
+  8000c2:	50                   	push   %eax
+  8000c3:	68 45 3b 80 00       	push   $0x803b45
+  8000c8:	6a 1b                	push   $0x1b
+  8000ca:	68 2f 3b 80 00       	push   $0x803b2f
+  8000cf:	e8 d0 01 00 00       	call   8002a4 <_panic>
+    panic("fork: %e", id);
+  8000d4:	50                   	push   %eax
+  8000d5:	68 83 3f 80 00       	push   $0x803f83
+  8000da:	6a 1d                	push   $0x1d
+  8000dc:	68 2f 3b 80 00       	push   $0x803b2f
+  8000e1:	e8 be 01 00 00       	call   8002a4 <_panic>
+  }
+
+  close(pfd[0]);
+  8000e6:	83 ec 0c             	sub    $0xc,%esp
+  8000e9:	ff 75 d8             	push   -0x28(%ebp)
+  8000ec:	e8 2b 17 00 00       	call   80181c <close>
+  wfd = pfd[1];
+  8000f1:	8b 7d dc             	mov    -0x24(%ebp),%edi
+  8000f4:	83 c4 10             	add    $0x10,%esp
+
+  // filter out multiples of our prime
+  for (;; ) {
+    if ((r = readn(fd, &i, 4)) != 4)
+  8000f7:	8d 75 e4             	lea    -0x1c(%ebp),%esi
+  8000fa:	83 ec 04             	sub    $0x4,%esp
+  8000fd:	6a 04                	push   $0x4
+  8000ff:	56                   	push   %esi
+  800100:	53                   	push   %ebx
+  800101:	e8 25 19 00 00       	call   801a2b <readn>
+  800106:	83 c4 10             	add    $0x10,%esp
+  800109:	83 f8 04             	cmp    $0x4,%eax
+  80010c:	75 45                	jne    800153 <primeproc+0x120>
+      panic("primeproc %d readn %d %d %e", p, fd, r, r >= 0 ? 0 : r);
+    if (i%p)
+  80010e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  800111:	99                   	cltd
+  800112:	f7 7d e0             	idivl  -0x20(%ebp)
+  800115:	85 d2                	test   %edx,%edx
+  800117:	74 e1                	je     8000fa <primeproc+0xc7>
+      if ((r = write(wfd, &i, 4)) != 4)
+  800119:	83 ec 04             	sub    $0x4,%esp
+  80011c:	6a 04                	push   $0x4
+  80011e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800121:	50                   	push   %eax
+  800122:	57                   	push   %edi
+  800123:	e8 4a 19 00 00       	call   801a72 <write>
+  800128:	83 c4 10             	add    $0x10,%esp
+  80012b:	83 f8 04             	cmp    $0x4,%eax
+  80012e:	74 ca                	je     8000fa <primeproc+0xc7>
+        panic("primeproc %d write: %d %e", p, r, r >= 0 ? 0 : r);
+  800130:	83 ec 08             	sub    $0x8,%esp
+  800133:	85 c0                	test   %eax,%eax
+  800135:	ba 00 00 00 00       	mov    $0x0,%edx
+  80013a:	0f 4e d0             	cmovle %eax,%edx
+  80013d:	52                   	push   %edx
+  80013e:	50                   	push   %eax
+  80013f:	ff 75 e0             	push   -0x20(%ebp)
+  800142:	68 6a 3b 80 00       	push   $0x803b6a
+  800147:	6a 2e                	push   $0x2e
+  800149:	68 2f 3b 80 00       	push   $0x803b2f
+  80014e:	e8 51 01 00 00       	call   8002a4 <_panic>
+      panic("primeproc %d readn %d %d %e", p, fd, r, r >= 0 ? 0 : r);
+  800153:	83 ec 04             	sub    $0x4,%esp
+  800156:	85 c0                	test   %eax,%eax
+  800158:	ba 00 00 00 00       	mov    $0x0,%edx
+  80015d:	0f 4e d0             	cmovle %eax,%edx
+  800160:	52                   	push   %edx
+  800161:	50                   	push   %eax
+  800162:	53                   	push   %ebx
+  800163:	ff 75 e0             	push   -0x20(%ebp)
+  800166:	68 4e 3b 80 00       	push   $0x803b4e
+  80016b:	6a 2b                	push   $0x2b
+  80016d:	68 2f 3b 80 00       	push   $0x803b2f
+  800172:	e8 2d 01 00 00       	call   8002a4 <_panic>
+
+00800177 <umain>:
+  }
+}
+
+void
+umain(int argc, char **argv)
+{
+  800177:	55                   	push   %ebp
+  800178:	89 e5                	mov    %esp,%ebp
+  80017a:	53                   	push   %ebx
+  80017b:	83 ec 20             	sub    $0x20,%esp
+  int i, id, p[2], r;
+
+  binaryname = "primespipe";
+  80017e:	c7 05 00 50 80 00 84 	movl   $0x803b84,0x805000
+  800185:	3b 80 00 
+
+  if ((i = pipe(p)) < 0)
+  800188:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80018b:	50                   	push   %eax
+  80018c:	e8 93 2b 00 00       	call   802d24 <pipe>
+  800191:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  800194:	83 c4 10             	add    $0x10,%esp
+  800197:	85 c0                	test   %eax,%eax
+  800199:	78 21                	js     8001bc <umain+0x45>
+    panic("pipe: %e", i);
+
+  // fork the first prime process in the chain
+  if ((id = fork()) < 0)
+  80019b:	e8 69 12 00 00       	call   801409 <fork>
+  8001a0:	85 c0                	test   %eax,%eax
+  8001a2:	78 2a                	js     8001ce <umain+0x57>
+    panic("fork: %e", id);
+
+  if (id == 0) {
+  8001a4:	75 3a                	jne    8001e0 <umain+0x69>
+    close(p[1]);
+  8001a6:	83 ec 0c             	sub    $0xc,%esp
+  8001a9:	ff 75 f0             	push   -0x10(%ebp)
+  8001ac:	e8 6b 16 00 00       	call   80181c <close>
+    primeproc(p[0]);
+  8001b1:	83 c4 04             	add    $0x4,%esp
+  8001b4:	ff 75 ec             	push   -0x14(%ebp)
+  8001b7:	e8 77 fe ff ff       	call   800033 <primeproc>
+    panic("pipe: %e", i);
+  8001bc:	50                   	push   %eax
+  8001bd:	68 45 3b 80 00       	push   $0x803b45
+  8001c2:	6a 3a                	push   $0x3a
+  8001c4:	68 2f 3b 80 00       	push   $0x803b2f
+  8001c9:	e8 d6 00 00 00       	call   8002a4 <_panic>
+    panic("fork: %e", id);
+  8001ce:	50                   	push   %eax
+  8001cf:	68 83 3f 80 00       	push   $0x803f83
+  8001d4:	6a 3e                	push   $0x3e
+  8001d6:	68 2f 3b 80 00       	push   $0x803b2f
+  8001db:	e8 c4 00 00 00       	call   8002a4 <_panic>
+  }
+
+  close(p[0]);
+  8001e0:	83 ec 0c             	sub    $0xc,%esp
+  8001e3:	ff 75 ec             	push   -0x14(%ebp)
+  8001e6:	e8 31 16 00 00       	call   80181c <close>
+  8001eb:	83 c4 10             	add    $0x10,%esp
+  8001ee:	b8 02 00 00 00       	mov    $0x2,%eax
+
+  // feed all the integers through
+  for (i = 2;; i++)
+    if ((r = write(p[1], &i, 4)) != 4)
+  8001f3:	8d 5d f4             	lea    -0xc(%ebp),%ebx
+  8001f6:	eb 06                	jmp    8001fe <umain+0x87>
+  for (i = 2;; i++)
+  8001f8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8001fb:	83 c0 01             	add    $0x1,%eax
+  8001fe:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if ((r = write(p[1], &i, 4)) != 4)
+  800201:	83 ec 04             	sub    $0x4,%esp
+  800204:	6a 04                	push   $0x4
+  800206:	53                   	push   %ebx
+  800207:	ff 75 f0             	push   -0x10(%ebp)
+  80020a:	e8 63 18 00 00       	call   801a72 <write>
+  80020f:	83 c4 10             	add    $0x10,%esp
+  800212:	83 f8 04             	cmp    $0x4,%eax
+  800215:	74 e1                	je     8001f8 <umain+0x81>
+      panic("generator write: %d, %e", r, r >= 0 ? 0 : r);
+  800217:	83 ec 0c             	sub    $0xc,%esp
+  80021a:	85 c0                	test   %eax,%eax
+  80021c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800221:	0f 4e d0             	cmovle %eax,%edx
+  800224:	52                   	push   %edx
+  800225:	50                   	push   %eax
+  800226:	68 8f 3b 80 00       	push   $0x803b8f
+  80022b:	6a 4a                	push   $0x4a
+  80022d:	68 2f 3b 80 00       	push   $0x803b2f
+  800232:	e8 6d 00 00 00       	call   8002a4 <_panic>
+
+00800237 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800237:	55                   	push   %ebp
+  800238:	89 e5                	mov    %esp,%ebp
+  80023a:	56                   	push   %esi
+  80023b:	53                   	push   %ebx
+  80023c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80023f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  800242:	c7 05 a0 68 80 00 00 	movl   $0x0,0x8068a0
+  800249:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  80024c:	e8 ca 0a 00 00       	call   800d1b <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  800251:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800256:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800259:	c1 e0 04             	shl    $0x4,%eax
+  80025c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800261:	a3 a0 68 80 00       	mov    %eax,0x8068a0
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800266:	85 db                	test   %ebx,%ebx
+  800268:	7e 07                	jle    800271 <libmain+0x3a>
+    binaryname = argv[0];
+  80026a:	8b 06                	mov    (%esi),%eax
+  80026c:	a3 00 50 80 00       	mov    %eax,0x805000
+
+  // call user main routine
+  umain(argc, argv);
+  800271:	83 ec 08             	sub    $0x8,%esp
+  800274:	56                   	push   %esi
+  800275:	53                   	push   %ebx
+  800276:	e8 fc fe ff ff       	call   800177 <umain>
+
+  // exit gracefully
+  exit();
+  80027b:	e8 0a 00 00 00       	call   80028a <exit>
+}
+  800280:	83 c4 10             	add    $0x10,%esp
+  800283:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800286:	5b                   	pop    %ebx
+  800287:	5e                   	pop    %esi
+  800288:	5d                   	pop    %ebp
+  800289:	c3                   	ret
+
+0080028a <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80028a:	55                   	push   %ebp
+  80028b:	89 e5                	mov    %esp,%ebp
+  80028d:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  800290:	e8 b4 15 00 00       	call   801849 <close_all>
+  sys_env_destroy(0);
+  800295:	83 ec 0c             	sub    $0xc,%esp
+  800298:	6a 00                	push   $0x0
+  80029a:	e8 3b 0a 00 00       	call   800cda <sys_env_destroy>
+}
+  80029f:	83 c4 10             	add    $0x10,%esp
+  8002a2:	c9                   	leave
+  8002a3:	c3                   	ret
+
+008002a4 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8002a4:	55                   	push   %ebp
+  8002a5:	89 e5                	mov    %esp,%ebp
+  8002a7:	56                   	push   %esi
+  8002a8:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  8002a9:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  8002ac:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  8002b2:	e8 64 0a 00 00       	call   800d1b <sys_getenvid>
+  8002b7:	83 ec 0c             	sub    $0xc,%esp
+  8002ba:	ff 75 0c             	push   0xc(%ebp)
+  8002bd:	ff 75 08             	push   0x8(%ebp)
+  8002c0:	56                   	push   %esi
+  8002c1:	50                   	push   %eax
+  8002c2:	68 b4 3b 80 00       	push   $0x803bb4
+  8002c7:	e8 b3 00 00 00       	call   80037f <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  8002cc:	83 c4 18             	add    $0x18,%esp
+  8002cf:	53                   	push   %ebx
+  8002d0:	ff 75 10             	push   0x10(%ebp)
+  8002d3:	e8 56 00 00 00       	call   80032e <vcprintf>
+  cprintf("\n");
+  8002d8:	c7 04 24 43 3b 80 00 	movl   $0x803b43,(%esp)
+  8002df:	e8 9b 00 00 00       	call   80037f <cprintf>
+  8002e4:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  8002e7:	cc                   	int3
+  while (1)
+  8002e8:	eb fd                	jmp    8002e7 <_panic+0x43>
+
+008002ea <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8002ea:	55                   	push   %ebp
+  8002eb:	89 e5                	mov    %esp,%ebp
+  8002ed:	53                   	push   %ebx
+  8002ee:	83 ec 04             	sub    $0x4,%esp
+  8002f1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  8002f4:	8b 13                	mov    (%ebx),%edx
+  8002f6:	8d 42 01             	lea    0x1(%edx),%eax
+  8002f9:	89 03                	mov    %eax,(%ebx)
+  8002fb:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8002fe:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  800302:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800307:	74 09                	je     800312 <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  800309:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80030d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800310:	c9                   	leave
+  800311:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  800312:	83 ec 08             	sub    $0x8,%esp
+  800315:	68 ff 00 00 00       	push   $0xff
+  80031a:	8d 43 08             	lea    0x8(%ebx),%eax
+  80031d:	50                   	push   %eax
+  80031e:	e8 7a 09 00 00       	call   800c9d <sys_cputs>
+    b->idx = 0;
+  800323:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800329:	83 c4 10             	add    $0x10,%esp
+  80032c:	eb db                	jmp    800309 <putch+0x1f>
+
+0080032e <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80032e:	55                   	push   %ebp
+  80032f:	89 e5                	mov    %esp,%ebp
+  800331:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  800337:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80033e:	00 00 00 
+  b.cnt = 0;
+  800341:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800348:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  80034b:	ff 75 0c             	push   0xc(%ebp)
+  80034e:	ff 75 08             	push   0x8(%ebp)
+  800351:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800357:	50                   	push   %eax
+  800358:	68 ea 02 80 00       	push   $0x8002ea
+  80035d:	e8 14 01 00 00       	call   800476 <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  800362:	83 c4 08             	add    $0x8,%esp
+  800365:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80036b:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800371:	50                   	push   %eax
+  800372:	e8 26 09 00 00       	call   800c9d <sys_cputs>
+
+  return b.cnt;
+}
+  800377:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80037d:	c9                   	leave
+  80037e:	c3                   	ret
+
+0080037f <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80037f:	55                   	push   %ebp
+  800380:	89 e5                	mov    %esp,%ebp
+  800382:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  800385:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  800388:	50                   	push   %eax
+  800389:	ff 75 08             	push   0x8(%ebp)
+  80038c:	e8 9d ff ff ff       	call   80032e <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  800391:	c9                   	leave
+  800392:	c3                   	ret
+
+00800393 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  800393:	55                   	push   %ebp
+  800394:	89 e5                	mov    %esp,%ebp
+  800396:	57                   	push   %edi
+  800397:	56                   	push   %esi
+  800398:	53                   	push   %ebx
+  800399:	83 ec 1c             	sub    $0x1c,%esp
+  80039c:	89 c7                	mov    %eax,%edi
+  80039e:	89 d6                	mov    %edx,%esi
+  8003a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003a3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8003a6:	89 d1                	mov    %edx,%ecx
+  8003a8:	89 c2                	mov    %eax,%edx
+  8003aa:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8003ad:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8003b0:	8b 45 10             	mov    0x10(%ebp),%eax
+  8003b3:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  8003b6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003b9:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8003c0:	39 c2                	cmp    %eax,%edx
+  8003c2:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8003c5:	72 3e                	jb     800405 <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  8003c7:	83 ec 0c             	sub    $0xc,%esp
+  8003ca:	ff 75 18             	push   0x18(%ebp)
+  8003cd:	83 eb 01             	sub    $0x1,%ebx
+  8003d0:	53                   	push   %ebx
+  8003d1:	50                   	push   %eax
+  8003d2:	83 ec 08             	sub    $0x8,%esp
+  8003d5:	ff 75 e4             	push   -0x1c(%ebp)
+  8003d8:	ff 75 e0             	push   -0x20(%ebp)
+  8003db:	ff 75 dc             	push   -0x24(%ebp)
+  8003de:	ff 75 d8             	push   -0x28(%ebp)
+  8003e1:	e8 90 35 00 00       	call   803976 <__udivdi3>
+  8003e6:	83 c4 18             	add    $0x18,%esp
+  8003e9:	52                   	push   %edx
+  8003ea:	50                   	push   %eax
+  8003eb:	89 f2                	mov    %esi,%edx
+  8003ed:	89 f8                	mov    %edi,%eax
+  8003ef:	e8 9f ff ff ff       	call   800393 <printnum>
+  8003f4:	83 c4 20             	add    $0x20,%esp
+  8003f7:	eb 13                	jmp    80040c <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  8003f9:	83 ec 08             	sub    $0x8,%esp
+  8003fc:	56                   	push   %esi
+  8003fd:	ff 75 18             	push   0x18(%ebp)
+  800400:	ff d7                	call   *%edi
+  800402:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  800405:	83 eb 01             	sub    $0x1,%ebx
+  800408:	85 db                	test   %ebx,%ebx
+  80040a:	7f ed                	jg     8003f9 <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  80040c:	83 ec 08             	sub    $0x8,%esp
+  80040f:	56                   	push   %esi
+  800410:	83 ec 04             	sub    $0x4,%esp
+  800413:	ff 75 e4             	push   -0x1c(%ebp)
+  800416:	ff 75 e0             	push   -0x20(%ebp)
+  800419:	ff 75 dc             	push   -0x24(%ebp)
+  80041c:	ff 75 d8             	push   -0x28(%ebp)
+  80041f:	e8 73 35 00 00       	call   803997 <__umoddi3>
+  800424:	83 c4 14             	add    $0x14,%esp
+  800427:	0f be 80 d7 3b 80 00 	movsbl 0x803bd7(%eax),%eax
+  80042e:	50                   	push   %eax
+  80042f:	ff d7                	call   *%edi
+}
+  800431:	83 c4 10             	add    $0x10,%esp
+  800434:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800437:	5b                   	pop    %ebx
+  800438:	5e                   	pop    %esi
+  800439:	5f                   	pop    %edi
+  80043a:	5d                   	pop    %ebp
+  80043b:	c3                   	ret
+
+0080043c <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80043c:	55                   	push   %ebp
+  80043d:	89 e5                	mov    %esp,%ebp
+  80043f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  800442:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  800446:	8b 10                	mov    (%eax),%edx
+  800448:	3b 50 04             	cmp    0x4(%eax),%edx
+  80044b:	73 0a                	jae    800457 <sprintputch+0x1b>
+    *b->buf++ = ch;
+  80044d:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800450:	89 08                	mov    %ecx,(%eax)
+  800452:	8b 45 08             	mov    0x8(%ebp),%eax
+  800455:	88 02                	mov    %al,(%edx)
+}
+  800457:	5d                   	pop    %ebp
+  800458:	c3                   	ret
+
+00800459 <printfmt>:
+{
+  800459:	55                   	push   %ebp
+  80045a:	89 e5                	mov    %esp,%ebp
+  80045c:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  80045f:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  800462:	50                   	push   %eax
+  800463:	ff 75 10             	push   0x10(%ebp)
+  800466:	ff 75 0c             	push   0xc(%ebp)
+  800469:	ff 75 08             	push   0x8(%ebp)
+  80046c:	e8 05 00 00 00       	call   800476 <vprintfmt>
+}
+  800471:	83 c4 10             	add    $0x10,%esp
+  800474:	c9                   	leave
+  800475:	c3                   	ret
+
+00800476 <vprintfmt>:
+{
+  800476:	55                   	push   %ebp
+  800477:	89 e5                	mov    %esp,%ebp
+  800479:	57                   	push   %edi
+  80047a:	56                   	push   %esi
+  80047b:	53                   	push   %ebx
+  80047c:	83 ec 2c             	sub    $0x2c,%esp
+  80047f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800482:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800485:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800488:	eb 0a                	jmp    800494 <vprintfmt+0x1e>
+      putch(ch, putdat);
+  80048a:	83 ec 08             	sub    $0x8,%esp
+  80048d:	53                   	push   %ebx
+  80048e:	50                   	push   %eax
+  80048f:	ff d6                	call   *%esi
+  800491:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  800494:	83 c7 01             	add    $0x1,%edi
+  800497:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80049b:	83 f8 25             	cmp    $0x25,%eax
+  80049e:	74 0c                	je     8004ac <vprintfmt+0x36>
+      if (ch == '\0')
+  8004a0:	85 c0                	test   %eax,%eax
+  8004a2:	75 e6                	jne    80048a <vprintfmt+0x14>
+}
+  8004a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004a7:	5b                   	pop    %ebx
+  8004a8:	5e                   	pop    %esi
+  8004a9:	5f                   	pop    %edi
+  8004aa:	5d                   	pop    %ebp
+  8004ab:	c3                   	ret
+    padc = ' ';
+  8004ac:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  8004b0:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  8004b7:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  8004be:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  8004c5:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  8004ca:	8d 47 01             	lea    0x1(%edi),%eax
+  8004cd:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8004d0:	0f b6 17             	movzbl (%edi),%edx
+  8004d3:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8004d6:	3c 55                	cmp    $0x55,%al
+  8004d8:	0f 87 cf 03 00 00    	ja     8008ad <vprintfmt+0x437>
+  8004de:	0f b6 c0             	movzbl %al,%eax
+  8004e1:	ff 24 85 20 3d 80 00 	jmp    *0x803d20(,%eax,4)
+  8004e8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  8004eb:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8004ef:	eb d9                	jmp    8004ca <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  8004f1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8004f4:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8004f8:	eb d0                	jmp    8004ca <vprintfmt+0x54>
+  8004fa:	0f b6 d2             	movzbl %dl,%edx
+  8004fd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  800500:	b8 00 00 00 00       	mov    $0x0,%eax
+  800505:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  800508:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80050b:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  80050f:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  800512:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800515:	83 f9 09             	cmp    $0x9,%ecx
+  800518:	77 55                	ja     80056f <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  80051a:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  80051d:	eb e9                	jmp    800508 <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  80051f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800522:	8b 00                	mov    (%eax),%eax
+  800524:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800527:	8b 45 14             	mov    0x14(%ebp),%eax
+  80052a:	8d 40 04             	lea    0x4(%eax),%eax
+  80052d:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  800530:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  800533:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800537:	79 91                	jns    8004ca <vprintfmt+0x54>
+        width = precision, precision = -1;
+  800539:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80053c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80053f:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800546:	eb 82                	jmp    8004ca <vprintfmt+0x54>
+      if (width < 0)
+  800548:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80054b:	85 d2                	test   %edx,%edx
+  80054d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800552:	0f 49 c2             	cmovns %edx,%eax
+  800555:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  800558:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  80055b:	e9 6a ff ff ff       	jmp    8004ca <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  800560:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  800563:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  80056a:	e9 5b ff ff ff       	jmp    8004ca <vprintfmt+0x54>
+  80056f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800572:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800575:	eb bc                	jmp    800533 <vprintfmt+0xbd>
+      lflag++;
+  800577:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  80057a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  80057d:	e9 48 ff ff ff       	jmp    8004ca <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  800582:	8b 45 14             	mov    0x14(%ebp),%eax
+  800585:	8d 78 04             	lea    0x4(%eax),%edi
+  800588:	83 ec 08             	sub    $0x8,%esp
+  80058b:	53                   	push   %ebx
+  80058c:	ff 30                	push   (%eax)
+  80058e:	ff d6                	call   *%esi
+      break;
+  800590:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  800593:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  800596:	e9 b1 02 00 00       	jmp    80084c <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  80059b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80059e:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  8005a1:	8b 10                	mov    (%eax),%edx
+  8005a3:	89 d0                	mov    %edx,%eax
+  8005a5:	f7 d8                	neg    %eax
+  8005a7:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8005aa:	83 f8 10             	cmp    $0x10,%eax
+  8005ad:	7f 23                	jg     8005d2 <vprintfmt+0x15c>
+  8005af:	8b 14 85 80 3e 80 00 	mov    0x803e80(,%eax,4),%edx
+  8005b6:	85 d2                	test   %edx,%edx
+  8005b8:	74 18                	je     8005d2 <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  8005ba:	52                   	push   %edx
+  8005bb:	68 96 40 80 00       	push   $0x804096
+  8005c0:	53                   	push   %ebx
+  8005c1:	56                   	push   %esi
+  8005c2:	e8 92 fe ff ff       	call   800459 <printfmt>
+  8005c7:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  8005ca:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8005cd:	e9 7a 02 00 00       	jmp    80084c <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  8005d2:	50                   	push   %eax
+  8005d3:	68 ef 3b 80 00       	push   $0x803bef
+  8005d8:	53                   	push   %ebx
+  8005d9:	56                   	push   %esi
+  8005da:	e8 7a fe ff ff       	call   800459 <printfmt>
+  8005df:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  8005e2:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  8005e5:	e9 62 02 00 00       	jmp    80084c <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  8005ea:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ed:	83 c0 04             	add    $0x4,%eax
+  8005f0:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8005f3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f6:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  8005f8:	85 c9                	test   %ecx,%ecx
+  8005fa:	b8 e8 3b 80 00       	mov    $0x803be8,%eax
+  8005ff:	0f 45 c1             	cmovne %ecx,%eax
+  800602:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  800605:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800609:	7e 06                	jle    800611 <vprintfmt+0x19b>
+  80060b:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80060f:	75 0b                	jne    80061c <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800611:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800614:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800617:	89 75 08             	mov    %esi,0x8(%ebp)
+  80061a:	eb 5c                	jmp    800678 <vprintfmt+0x202>
+  80061c:	83 ec 08             	sub    $0x8,%esp
+  80061f:	ff 75 d0             	push   -0x30(%ebp)
+  800622:	ff 75 cc             	push   -0x34(%ebp)
+  800625:	e8 20 03 00 00       	call   80094a <strnlen>
+  80062a:	89 c2                	mov    %eax,%edx
+  80062c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80062f:	29 d0                	sub    %edx,%eax
+  800631:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  800634:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800638:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80063b:	89 75 08             	mov    %esi,0x8(%ebp)
+  80063e:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800640:	eb 0e                	jmp    800650 <vprintfmt+0x1da>
+          putch(padc, putdat);
+  800642:	83 ec 08             	sub    $0x8,%esp
+  800645:	53                   	push   %ebx
+  800646:	57                   	push   %edi
+  800647:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  80064a:	83 ee 01             	sub    $0x1,%esi
+  80064d:	83 c4 10             	add    $0x10,%esp
+  800650:	85 f6                	test   %esi,%esi
+  800652:	7f ee                	jg     800642 <vprintfmt+0x1cc>
+  800654:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800657:	8b 75 08             	mov    0x8(%ebp),%esi
+  80065a:	85 c0                	test   %eax,%eax
+  80065c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800661:	0f 49 d0             	cmovns %eax,%edx
+  800664:	29 d0                	sub    %edx,%eax
+  800666:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800669:	eb a6                	jmp    800611 <vprintfmt+0x19b>
+          putch(ch, putdat);
+  80066b:	83 ec 08             	sub    $0x8,%esp
+  80066e:	53                   	push   %ebx
+  80066f:	52                   	push   %edx
+  800670:	ff 55 08             	call   *0x8(%ebp)
+  800673:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800676:	89 f1                	mov    %esi,%ecx
+  800678:	8d 71 01             	lea    0x1(%ecx),%esi
+  80067b:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80067f:	0f be d0             	movsbl %al,%edx
+  800682:	85 d2                	test   %edx,%edx
+  800684:	74 28                	je     8006ae <vprintfmt+0x238>
+  800686:	85 ff                	test   %edi,%edi
+  800688:	78 05                	js     80068f <vprintfmt+0x219>
+  80068a:	83 ef 01             	sub    $0x1,%edi
+  80068d:	78 30                	js     8006bf <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  80068f:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800693:	74 d6                	je     80066b <vprintfmt+0x1f5>
+  800695:	0f be c0             	movsbl %al,%eax
+  800698:	83 e8 20             	sub    $0x20,%eax
+  80069b:	83 f8 5e             	cmp    $0x5e,%eax
+  80069e:	76 cb                	jbe    80066b <vprintfmt+0x1f5>
+          putch('?', putdat);
+  8006a0:	83 ec 08             	sub    $0x8,%esp
+  8006a3:	53                   	push   %ebx
+  8006a4:	6a 3f                	push   $0x3f
+  8006a6:	ff 55 08             	call   *0x8(%ebp)
+  8006a9:	83 c4 10             	add    $0x10,%esp
+  8006ac:	eb c8                	jmp    800676 <vprintfmt+0x200>
+  8006ae:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006b1:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8006b4:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8006b7:	01 d0                	add    %edx,%eax
+  8006b9:	29 c8                	sub    %ecx,%eax
+  8006bb:	89 c7                	mov    %eax,%edi
+  8006bd:	eb 13                	jmp    8006d2 <vprintfmt+0x25c>
+  8006bf:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006c2:	eb ed                	jmp    8006b1 <vprintfmt+0x23b>
+        putch(' ', putdat);
+  8006c4:	83 ec 08             	sub    $0x8,%esp
+  8006c7:	53                   	push   %ebx
+  8006c8:	6a 20                	push   $0x20
+  8006ca:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  8006cc:	83 ef 01             	sub    $0x1,%edi
+  8006cf:	83 c4 10             	add    $0x10,%esp
+  8006d2:	85 ff                	test   %edi,%edi
+  8006d4:	7f ee                	jg     8006c4 <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  8006d6:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8006d9:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006dc:	e9 6b 01 00 00       	jmp    80084c <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  8006e1:	83 f9 01             	cmp    $0x1,%ecx
+  8006e4:	7f 1f                	jg     800705 <vprintfmt+0x28f>
+  else if (lflag)
+  8006e6:	85 c9                	test   %ecx,%ecx
+  8006e8:	74 67                	je     800751 <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  8006ea:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ed:	8b 00                	mov    (%eax),%eax
+  8006ef:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006f2:	89 c1                	mov    %eax,%ecx
+  8006f4:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006f7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006fa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006fd:	8d 40 04             	lea    0x4(%eax),%eax
+  800700:	89 45 14             	mov    %eax,0x14(%ebp)
+  800703:	eb 17                	jmp    80071c <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  800705:	8b 45 14             	mov    0x14(%ebp),%eax
+  800708:	8b 50 04             	mov    0x4(%eax),%edx
+  80070b:	8b 00                	mov    (%eax),%eax
+  80070d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800710:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800713:	8b 45 14             	mov    0x14(%ebp),%eax
+  800716:	8d 40 08             	lea    0x8(%eax),%eax
+  800719:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  80071c:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80071f:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  800722:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  800727:	85 c9                	test   %ecx,%ecx
+  800729:	0f 89 03 01 00 00    	jns    800832 <vprintfmt+0x3bc>
+        putch('-', putdat);
+  80072f:	83 ec 08             	sub    $0x8,%esp
+  800732:	53                   	push   %ebx
+  800733:	6a 2d                	push   $0x2d
+  800735:	ff d6                	call   *%esi
+        num = -(long long)num;
+  800737:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80073a:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80073d:	f7 da                	neg    %edx
+  80073f:	83 d1 00             	adc    $0x0,%ecx
+  800742:	f7 d9                	neg    %ecx
+  800744:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  800747:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80074c:	e9 e1 00 00 00       	jmp    800832 <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  800751:	8b 45 14             	mov    0x14(%ebp),%eax
+  800754:	8b 00                	mov    (%eax),%eax
+  800756:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800759:	89 c1                	mov    %eax,%ecx
+  80075b:	c1 f9 1f             	sar    $0x1f,%ecx
+  80075e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800761:	8b 45 14             	mov    0x14(%ebp),%eax
+  800764:	8d 40 04             	lea    0x4(%eax),%eax
+  800767:	89 45 14             	mov    %eax,0x14(%ebp)
+  80076a:	eb b0                	jmp    80071c <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  80076c:	83 f9 01             	cmp    $0x1,%ecx
+  80076f:	7f 1e                	jg     80078f <vprintfmt+0x319>
+  else if (lflag)
+  800771:	85 c9                	test   %ecx,%ecx
+  800773:	74 32                	je     8007a7 <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  800775:	8b 45 14             	mov    0x14(%ebp),%eax
+  800778:	8b 10                	mov    (%eax),%edx
+  80077a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80077f:	8d 40 04             	lea    0x4(%eax),%eax
+  800782:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800785:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  80078a:	e9 a3 00 00 00       	jmp    800832 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  80078f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800792:	8b 10                	mov    (%eax),%edx
+  800794:	8b 48 04             	mov    0x4(%eax),%ecx
+  800797:	8d 40 08             	lea    0x8(%eax),%eax
+  80079a:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  80079d:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  8007a2:	e9 8b 00 00 00       	jmp    800832 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8007a7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007aa:	8b 10                	mov    (%eax),%edx
+  8007ac:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007b1:	8d 40 04             	lea    0x4(%eax),%eax
+  8007b4:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  8007b7:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  8007bc:	eb 74                	jmp    800832 <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  8007be:	83 f9 01             	cmp    $0x1,%ecx
+  8007c1:	7f 1b                	jg     8007de <vprintfmt+0x368>
+  else if (lflag)
+  8007c3:	85 c9                	test   %ecx,%ecx
+  8007c5:	74 2c                	je     8007f3 <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  8007c7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ca:	8b 10                	mov    (%eax),%edx
+  8007cc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007d1:	8d 40 04             	lea    0x4(%eax),%eax
+  8007d4:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8007d7:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  8007dc:	eb 54                	jmp    800832 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  8007de:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e1:	8b 10                	mov    (%eax),%edx
+  8007e3:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007e6:	8d 40 08             	lea    0x8(%eax),%eax
+  8007e9:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8007ec:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  8007f1:	eb 3f                	jmp    800832 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8007f3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007f6:	8b 10                	mov    (%eax),%edx
+  8007f8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007fd:	8d 40 04             	lea    0x4(%eax),%eax
+  800800:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800803:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  800808:	eb 28                	jmp    800832 <vprintfmt+0x3bc>
+      putch('0', putdat);
+  80080a:	83 ec 08             	sub    $0x8,%esp
+  80080d:	53                   	push   %ebx
+  80080e:	6a 30                	push   $0x30
+  800810:	ff d6                	call   *%esi
+      putch('x', putdat);
+  800812:	83 c4 08             	add    $0x8,%esp
+  800815:	53                   	push   %ebx
+  800816:	6a 78                	push   $0x78
+  800818:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  80081a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80081d:	8b 10                	mov    (%eax),%edx
+  80081f:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  800824:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  800827:	8d 40 04             	lea    0x4(%eax),%eax
+  80082a:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  80082d:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  800832:	83 ec 0c             	sub    $0xc,%esp
+  800835:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800839:	50                   	push   %eax
+  80083a:	ff 75 e0             	push   -0x20(%ebp)
+  80083d:	57                   	push   %edi
+  80083e:	51                   	push   %ecx
+  80083f:	52                   	push   %edx
+  800840:	89 da                	mov    %ebx,%edx
+  800842:	89 f0                	mov    %esi,%eax
+  800844:	e8 4a fb ff ff       	call   800393 <printnum>
+      break;
+  800849:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  80084c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  80084f:	e9 40 fc ff ff       	jmp    800494 <vprintfmt+0x1e>
+  if (lflag >= 2)
+  800854:	83 f9 01             	cmp    $0x1,%ecx
+  800857:	7f 1b                	jg     800874 <vprintfmt+0x3fe>
+  else if (lflag)
+  800859:	85 c9                	test   %ecx,%ecx
+  80085b:	74 2c                	je     800889 <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  80085d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800860:	8b 10                	mov    (%eax),%edx
+  800862:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800867:	8d 40 04             	lea    0x4(%eax),%eax
+  80086a:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  80086d:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  800872:	eb be                	jmp    800832 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800874:	8b 45 14             	mov    0x14(%ebp),%eax
+  800877:	8b 10                	mov    (%eax),%edx
+  800879:	8b 48 04             	mov    0x4(%eax),%ecx
+  80087c:	8d 40 08             	lea    0x8(%eax),%eax
+  80087f:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800882:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  800887:	eb a9                	jmp    800832 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800889:	8b 45 14             	mov    0x14(%ebp),%eax
+  80088c:	8b 10                	mov    (%eax),%edx
+  80088e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800893:	8d 40 04             	lea    0x4(%eax),%eax
+  800896:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800899:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  80089e:	eb 92                	jmp    800832 <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  8008a0:	83 ec 08             	sub    $0x8,%esp
+  8008a3:	53                   	push   %ebx
+  8008a4:	6a 25                	push   $0x25
+  8008a6:	ff d6                	call   *%esi
+      break;
+  8008a8:	83 c4 10             	add    $0x10,%esp
+  8008ab:	eb 9f                	jmp    80084c <vprintfmt+0x3d6>
+      putch('%', putdat);
+  8008ad:	83 ec 08             	sub    $0x8,%esp
+  8008b0:	53                   	push   %ebx
+  8008b1:	6a 25                	push   $0x25
+  8008b3:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  8008b5:	83 c4 10             	add    $0x10,%esp
+  8008b8:	89 f8                	mov    %edi,%eax
+  8008ba:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8008be:	74 05                	je     8008c5 <vprintfmt+0x44f>
+  8008c0:	83 e8 01             	sub    $0x1,%eax
+  8008c3:	eb f5                	jmp    8008ba <vprintfmt+0x444>
+  8008c5:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8008c8:	eb 82                	jmp    80084c <vprintfmt+0x3d6>
+
+008008ca <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8008ca:	55                   	push   %ebp
+  8008cb:	89 e5                	mov    %esp,%ebp
+  8008cd:	83 ec 18             	sub    $0x18,%esp
+  8008d0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008d3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  8008d6:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8008d9:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8008dd:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8008e0:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  8008e7:	85 c0                	test   %eax,%eax
+  8008e9:	74 26                	je     800911 <vsnprintf+0x47>
+  8008eb:	85 d2                	test   %edx,%edx
+  8008ed:	7e 22                	jle    800911 <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8008ef:	ff 75 14             	push   0x14(%ebp)
+  8008f2:	ff 75 10             	push   0x10(%ebp)
+  8008f5:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8008f8:	50                   	push   %eax
+  8008f9:	68 3c 04 80 00       	push   $0x80043c
+  8008fe:	e8 73 fb ff ff       	call   800476 <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800903:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800906:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  800909:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80090c:	83 c4 10             	add    $0x10,%esp
+}
+  80090f:	c9                   	leave
+  800910:	c3                   	ret
+    return -E_INVAL;
+  800911:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800916:	eb f7                	jmp    80090f <vsnprintf+0x45>
+
+00800918 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800918:	55                   	push   %ebp
+  800919:	89 e5                	mov    %esp,%ebp
+  80091b:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  80091e:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  800921:	50                   	push   %eax
+  800922:	ff 75 10             	push   0x10(%ebp)
+  800925:	ff 75 0c             	push   0xc(%ebp)
+  800928:	ff 75 08             	push   0x8(%ebp)
+  80092b:	e8 9a ff ff ff       	call   8008ca <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  800930:	c9                   	leave
+  800931:	c3                   	ret
+
+00800932 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800932:	55                   	push   %ebp
+  800933:	89 e5                	mov    %esp,%ebp
+  800935:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  800938:	b8 00 00 00 00       	mov    $0x0,%eax
+  80093d:	eb 03                	jmp    800942 <strlen+0x10>
+    n++;
+  80093f:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  800942:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800946:	75 f7                	jne    80093f <strlen+0xd>
+  return n;
+}
+  800948:	5d                   	pop    %ebp
+  800949:	c3                   	ret
+
+0080094a <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80094a:	55                   	push   %ebp
+  80094b:	89 e5                	mov    %esp,%ebp
+  80094d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800950:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800953:	b8 00 00 00 00       	mov    $0x0,%eax
+  800958:	eb 03                	jmp    80095d <strnlen+0x13>
+    n++;
+  80095a:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80095d:	39 d0                	cmp    %edx,%eax
+  80095f:	74 08                	je     800969 <strnlen+0x1f>
+  800961:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800965:	75 f3                	jne    80095a <strnlen+0x10>
+  800967:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  800969:	89 d0                	mov    %edx,%eax
+  80096b:	5d                   	pop    %ebp
+  80096c:	c3                   	ret
+
+0080096d <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80096d:	55                   	push   %ebp
+  80096e:	89 e5                	mov    %esp,%ebp
+  800970:	53                   	push   %ebx
+  800971:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800974:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  800977:	b8 00 00 00 00       	mov    $0x0,%eax
+  80097c:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800980:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800983:	83 c0 01             	add    $0x1,%eax
+  800986:	84 d2                	test   %dl,%dl
+  800988:	75 f2                	jne    80097c <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  80098a:	89 c8                	mov    %ecx,%eax
+  80098c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80098f:	c9                   	leave
+  800990:	c3                   	ret
+
+00800991 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800991:	55                   	push   %ebp
+  800992:	89 e5                	mov    %esp,%ebp
+  800994:	53                   	push   %ebx
+  800995:	83 ec 10             	sub    $0x10,%esp
+  800998:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  80099b:	53                   	push   %ebx
+  80099c:	e8 91 ff ff ff       	call   800932 <strlen>
+  8009a1:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  8009a4:	ff 75 0c             	push   0xc(%ebp)
+  8009a7:	01 d8                	add    %ebx,%eax
+  8009a9:	50                   	push   %eax
+  8009aa:	e8 be ff ff ff       	call   80096d <strcpy>
+  return dst;
+}
+  8009af:	89 d8                	mov    %ebx,%eax
+  8009b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8009b4:	c9                   	leave
+  8009b5:	c3                   	ret
+
+008009b6 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  8009b6:	55                   	push   %ebp
+  8009b7:	89 e5                	mov    %esp,%ebp
+  8009b9:	56                   	push   %esi
+  8009ba:	53                   	push   %ebx
+  8009bb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009be:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  8009c1:	89 f3                	mov    %esi,%ebx
+  8009c3:	03 5d 10             	add    0x10(%ebp),%ebx
+  8009c6:	89 f0                	mov    %esi,%eax
+  8009c8:	eb 0f                	jmp    8009d9 <strncpy+0x23>
+    *dst++ = *src;
+  8009ca:	83 c0 01             	add    $0x1,%eax
+  8009cd:	0f b6 0a             	movzbl (%edx),%ecx
+  8009d0:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  8009d3:	80 f9 01             	cmp    $0x1,%cl
+  8009d6:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  8009d9:	39 d8                	cmp    %ebx,%eax
+  8009db:	75 ed                	jne    8009ca <strncpy+0x14>
+  }
+  return ret;
+}
+  8009dd:	89 f0                	mov    %esi,%eax
+  8009df:	5b                   	pop    %ebx
+  8009e0:	5e                   	pop    %esi
+  8009e1:	5d                   	pop    %ebp
+  8009e2:	c3                   	ret
+
+008009e3 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8009e3:	55                   	push   %ebp
+  8009e4:	89 e5                	mov    %esp,%ebp
+  8009e6:	56                   	push   %esi
+  8009e7:	53                   	push   %ebx
+  8009e8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8009eb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009ee:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  8009f1:	89 f0                	mov    %esi,%eax
+  8009f3:	85 d2                	test   %edx,%edx
+  8009f5:	74 21                	je     800a18 <strlcpy+0x35>
+  8009f7:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8009fb:	89 f2                	mov    %esi,%edx
+  8009fd:	eb 09                	jmp    800a08 <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  8009ff:	83 c1 01             	add    $0x1,%ecx
+  800a02:	83 c2 01             	add    $0x1,%edx
+  800a05:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  800a08:	39 c2                	cmp    %eax,%edx
+  800a0a:	74 09                	je     800a15 <strlcpy+0x32>
+  800a0c:	0f b6 19             	movzbl (%ecx),%ebx
+  800a0f:	84 db                	test   %bl,%bl
+  800a11:	75 ec                	jne    8009ff <strlcpy+0x1c>
+  800a13:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  800a15:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  800a18:	29 f0                	sub    %esi,%eax
+}
+  800a1a:	5b                   	pop    %ebx
+  800a1b:	5e                   	pop    %esi
+  800a1c:	5d                   	pop    %ebp
+  800a1d:	c3                   	ret
+
+00800a1e <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800a1e:	55                   	push   %ebp
+  800a1f:	89 e5                	mov    %esp,%ebp
+  800a21:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a24:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  800a27:	eb 06                	jmp    800a2f <strcmp+0x11>
+    p++, q++;
+  800a29:	83 c1 01             	add    $0x1,%ecx
+  800a2c:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  800a2f:	0f b6 01             	movzbl (%ecx),%eax
+  800a32:	84 c0                	test   %al,%al
+  800a34:	74 04                	je     800a3a <strcmp+0x1c>
+  800a36:	3a 02                	cmp    (%edx),%al
+  800a38:	74 ef                	je     800a29 <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  800a3a:	0f b6 c0             	movzbl %al,%eax
+  800a3d:	0f b6 12             	movzbl (%edx),%edx
+  800a40:	29 d0                	sub    %edx,%eax
+}
+  800a42:	5d                   	pop    %ebp
+  800a43:	c3                   	ret
+
+00800a44 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800a44:	55                   	push   %ebp
+  800a45:	89 e5                	mov    %esp,%ebp
+  800a47:	53                   	push   %ebx
+  800a48:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a4b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a4e:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  800a51:	eb 09                	jmp    800a5c <strncmp+0x18>
+    n--, p++, q++;
+  800a53:	83 ea 01             	sub    $0x1,%edx
+  800a56:	83 c0 01             	add    $0x1,%eax
+  800a59:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  800a5c:	85 d2                	test   %edx,%edx
+  800a5e:	74 18                	je     800a78 <strncmp+0x34>
+  800a60:	0f b6 18             	movzbl (%eax),%ebx
+  800a63:	84 db                	test   %bl,%bl
+  800a65:	74 04                	je     800a6b <strncmp+0x27>
+  800a67:	3a 19                	cmp    (%ecx),%bl
+  800a69:	74 e8                	je     800a53 <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800a6b:	0f b6 00             	movzbl (%eax),%eax
+  800a6e:	0f b6 11             	movzbl (%ecx),%edx
+  800a71:	29 d0                	sub    %edx,%eax
+}
+  800a73:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a76:	c9                   	leave
+  800a77:	c3                   	ret
+    return 0;
+  800a78:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a7d:	eb f4                	jmp    800a73 <strncmp+0x2f>
+
+00800a7f <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a7f:	55                   	push   %ebp
+  800a80:	89 e5                	mov    %esp,%ebp
+  800a82:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a85:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800a89:	eb 03                	jmp    800a8e <strchr+0xf>
+  800a8b:	83 c0 01             	add    $0x1,%eax
+  800a8e:	0f b6 10             	movzbl (%eax),%edx
+  800a91:	84 d2                	test   %dl,%dl
+  800a93:	74 06                	je     800a9b <strchr+0x1c>
+    if (*s == c)
+  800a95:	38 ca                	cmp    %cl,%dl
+  800a97:	75 f2                	jne    800a8b <strchr+0xc>
+  800a99:	eb 05                	jmp    800aa0 <strchr+0x21>
+      return (char*)s;
+  return 0;
+  800a9b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800aa0:	5d                   	pop    %ebp
+  800aa1:	c3                   	ret
+
+00800aa2 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800aa2:	55                   	push   %ebp
+  800aa3:	89 e5                	mov    %esp,%ebp
+  800aa5:	8b 45 08             	mov    0x8(%ebp),%eax
+  800aa8:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800aac:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  800aaf:	38 ca                	cmp    %cl,%dl
+  800ab1:	74 09                	je     800abc <strfind+0x1a>
+  800ab3:	84 d2                	test   %dl,%dl
+  800ab5:	74 05                	je     800abc <strfind+0x1a>
+  for (; *s; s++)
+  800ab7:	83 c0 01             	add    $0x1,%eax
+  800aba:	eb f0                	jmp    800aac <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  800abc:	5d                   	pop    %ebp
+  800abd:	c3                   	ret
+
+00800abe <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800abe:	55                   	push   %ebp
+  800abf:	89 e5                	mov    %esp,%ebp
+  800ac1:	57                   	push   %edi
+  800ac2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800ac5:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  800ac8:	85 c9                	test   %ecx,%ecx
+  800aca:	74 20                	je     800aec <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  800acc:	89 f8                	mov    %edi,%eax
+  800ace:	09 c8                	or     %ecx,%eax
+  800ad0:	a8 03                	test   $0x3,%al
+  800ad2:	75 12                	jne    800ae6 <memset+0x28>
+    c &= 0xFF;
+  800ad4:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800ad8:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  800ade:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  800ae1:	fc                   	cld
+  800ae2:	f3 ab                	rep stos %eax,%es:(%edi)
+  800ae4:	eb 06                	jmp    800aec <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  800ae6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ae9:	fc                   	cld
+  800aea:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  800aec:	89 f8                	mov    %edi,%eax
+  800aee:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800af1:	c9                   	leave
+  800af2:	c3                   	ret
+
+00800af3 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800af3:	55                   	push   %ebp
+  800af4:	89 e5                	mov    %esp,%ebp
+  800af6:	57                   	push   %edi
+  800af7:	56                   	push   %esi
+  800af8:	8b 45 08             	mov    0x8(%ebp),%eax
+  800afb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800afe:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  800b01:	39 c6                	cmp    %eax,%esi
+  800b03:	73 32                	jae    800b37 <memmove+0x44>
+  800b05:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800b08:	39 d0                	cmp    %edx,%eax
+  800b0a:	73 2b                	jae    800b37 <memmove+0x44>
+    s += n;
+    d += n;
+  800b0c:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b0f:	89 d6                	mov    %edx,%esi
+  800b11:	09 fe                	or     %edi,%esi
+  800b13:	09 ce                	or     %ecx,%esi
+  800b15:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800b1b:	75 0e                	jne    800b2b <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800b1d:	83 ef 04             	sub    $0x4,%edi
+  800b20:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800b23:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  800b26:	fd                   	std
+  800b27:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b29:	eb 09                	jmp    800b34 <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800b2b:	83 ef 01             	sub    $0x1,%edi
+  800b2e:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  800b31:	fd                   	std
+  800b32:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  800b34:	fc                   	cld
+  800b35:	eb 1a                	jmp    800b51 <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800b37:	89 f2                	mov    %esi,%edx
+  800b39:	09 c2                	or     %eax,%edx
+  800b3b:	09 ca                	or     %ecx,%edx
+  800b3d:	f6 c2 03             	test   $0x3,%dl
+  800b40:	75 0a                	jne    800b4c <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800b42:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  800b45:	89 c7                	mov    %eax,%edi
+  800b47:	fc                   	cld
+  800b48:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800b4a:	eb 05                	jmp    800b51 <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  800b4c:	89 c7                	mov    %eax,%edi
+  800b4e:	fc                   	cld
+  800b4f:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  800b51:	5e                   	pop    %esi
+  800b52:	5f                   	pop    %edi
+  800b53:	5d                   	pop    %ebp
+  800b54:	c3                   	ret
+
+00800b55 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800b55:	55                   	push   %ebp
+  800b56:	89 e5                	mov    %esp,%ebp
+  800b58:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  800b5b:	ff 75 10             	push   0x10(%ebp)
+  800b5e:	ff 75 0c             	push   0xc(%ebp)
+  800b61:	ff 75 08             	push   0x8(%ebp)
+  800b64:	e8 8a ff ff ff       	call   800af3 <memmove>
+}
+  800b69:	c9                   	leave
+  800b6a:	c3                   	ret
+
+00800b6b <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800b6b:	55                   	push   %ebp
+  800b6c:	89 e5                	mov    %esp,%ebp
+  800b6e:	56                   	push   %esi
+  800b6f:	53                   	push   %ebx
+  800b70:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b73:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  800b76:	89 c6                	mov    %eax,%esi
+  800b78:	03 75 10             	add    0x10(%ebp),%esi
+  800b7b:	eb 06                	jmp    800b83 <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  800b7d:	83 c0 01             	add    $0x1,%eax
+  800b80:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  800b83:	39 f0                	cmp    %esi,%eax
+  800b85:	74 14                	je     800b9b <memcmp+0x30>
+    if (*s1 != *s2)
+  800b87:	0f b6 08             	movzbl (%eax),%ecx
+  800b8a:	0f b6 1a             	movzbl (%edx),%ebx
+  800b8d:	38 d9                	cmp    %bl,%cl
+  800b8f:	74 ec                	je     800b7d <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  800b91:	0f b6 c1             	movzbl %cl,%eax
+  800b94:	0f b6 db             	movzbl %bl,%ebx
+  800b97:	29 d8                	sub    %ebx,%eax
+  800b99:	eb 05                	jmp    800ba0 <memcmp+0x35>
+  }
+
+  return 0;
+  800b9b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ba0:	5b                   	pop    %ebx
+  800ba1:	5e                   	pop    %esi
+  800ba2:	5d                   	pop    %ebp
+  800ba3:	c3                   	ret
+
+00800ba4 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800ba4:	55                   	push   %ebp
+  800ba5:	89 e5                	mov    %esp,%ebp
+  800ba7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800baa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  800bad:	89 c2                	mov    %eax,%edx
+  800baf:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  800bb2:	eb 03                	jmp    800bb7 <memfind+0x13>
+  800bb4:	83 c0 01             	add    $0x1,%eax
+  800bb7:	39 d0                	cmp    %edx,%eax
+  800bb9:	73 04                	jae    800bbf <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  800bbb:	38 08                	cmp    %cl,(%eax)
+  800bbd:	75 f5                	jne    800bb4 <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  800bbf:	5d                   	pop    %ebp
+  800bc0:	c3                   	ret
+
+00800bc1 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800bc1:	55                   	push   %ebp
+  800bc2:	89 e5                	mov    %esp,%ebp
+  800bc4:	57                   	push   %edi
+  800bc5:	56                   	push   %esi
+  800bc6:	53                   	push   %ebx
+  800bc7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bca:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  800bcd:	eb 03                	jmp    800bd2 <strtol+0x11>
+    s++;
+  800bcf:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  800bd2:	0f b6 02             	movzbl (%edx),%eax
+  800bd5:	3c 20                	cmp    $0x20,%al
+  800bd7:	74 f6                	je     800bcf <strtol+0xe>
+  800bd9:	3c 09                	cmp    $0x9,%al
+  800bdb:	74 f2                	je     800bcf <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  800bdd:	3c 2b                	cmp    $0x2b,%al
+  800bdf:	74 2a                	je     800c0b <strtol+0x4a>
+  int neg = 0;
+  800be1:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  800be6:	3c 2d                	cmp    $0x2d,%al
+  800be8:	74 2b                	je     800c15 <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800bea:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800bf0:	75 0f                	jne    800c01 <strtol+0x40>
+  800bf2:	80 3a 30             	cmpb   $0x30,(%edx)
+  800bf5:	74 28                	je     800c1f <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  800bf7:	85 db                	test   %ebx,%ebx
+  800bf9:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800bfe:	0f 44 d8             	cmove  %eax,%ebx
+  800c01:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c06:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800c09:	eb 46                	jmp    800c51 <strtol+0x90>
+    s++;
+  800c0b:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  800c0e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800c13:	eb d5                	jmp    800bea <strtol+0x29>
+    s++, neg = 1;
+  800c15:	83 c2 01             	add    $0x1,%edx
+  800c18:	bf 01 00 00 00       	mov    $0x1,%edi
+  800c1d:	eb cb                	jmp    800bea <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c1f:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800c23:	74 0e                	je     800c33 <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  800c25:	85 db                	test   %ebx,%ebx
+  800c27:	75 d8                	jne    800c01 <strtol+0x40>
+    s++, base = 8;
+  800c29:	83 c2 01             	add    $0x1,%edx
+  800c2c:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800c31:	eb ce                	jmp    800c01 <strtol+0x40>
+    s += 2, base = 16;
+  800c33:	83 c2 02             	add    $0x2,%edx
+  800c36:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800c3b:	eb c4                	jmp    800c01 <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  800c3d:	0f be c0             	movsbl %al,%eax
+  800c40:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  800c43:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800c46:	7d 3a                	jge    800c82 <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  800c48:	83 c2 01             	add    $0x1,%edx
+  800c4b:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800c4f:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  800c51:	0f b6 02             	movzbl (%edx),%eax
+  800c54:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800c57:	89 f3                	mov    %esi,%ebx
+  800c59:	80 fb 09             	cmp    $0x9,%bl
+  800c5c:	76 df                	jbe    800c3d <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  800c5e:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800c61:	89 f3                	mov    %esi,%ebx
+  800c63:	80 fb 19             	cmp    $0x19,%bl
+  800c66:	77 08                	ja     800c70 <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  800c68:	0f be c0             	movsbl %al,%eax
+  800c6b:	83 e8 57             	sub    $0x57,%eax
+  800c6e:	eb d3                	jmp    800c43 <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  800c70:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800c73:	89 f3                	mov    %esi,%ebx
+  800c75:	80 fb 19             	cmp    $0x19,%bl
+  800c78:	77 08                	ja     800c82 <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  800c7a:	0f be c0             	movsbl %al,%eax
+  800c7d:	83 e8 37             	sub    $0x37,%eax
+  800c80:	eb c1                	jmp    800c43 <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  800c82:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c86:	74 05                	je     800c8d <strtol+0xcc>
+    *endptr = (char*)s;
+  800c88:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c8b:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  800c8d:	89 c8                	mov    %ecx,%eax
+  800c8f:	f7 d8                	neg    %eax
+  800c91:	85 ff                	test   %edi,%edi
+  800c93:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800c96:	89 c8                	mov    %ecx,%eax
+  800c98:	5b                   	pop    %ebx
+  800c99:	5e                   	pop    %esi
+  800c9a:	5f                   	pop    %edi
+  800c9b:	5d                   	pop    %ebp
+  800c9c:	c3                   	ret
+
+00800c9d <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800c9d:	55                   	push   %ebp
+  800c9e:	89 e5                	mov    %esp,%ebp
+  800ca0:	57                   	push   %edi
+  800ca1:	56                   	push   %esi
+  800ca2:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800ca3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ca8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cae:	89 c3                	mov    %eax,%ebx
+  800cb0:	89 c7                	mov    %eax,%edi
+  800cb2:	89 c6                	mov    %eax,%esi
+  800cb4:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800cb6:	5b                   	pop    %ebx
+  800cb7:	5e                   	pop    %esi
+  800cb8:	5f                   	pop    %edi
+  800cb9:	5d                   	pop    %ebp
+  800cba:	c3                   	ret
+
+00800cbb <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800cbb:	55                   	push   %ebp
+  800cbc:	89 e5                	mov    %esp,%ebp
+  800cbe:	57                   	push   %edi
+  800cbf:	56                   	push   %esi
+  800cc0:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800cc1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cc6:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ccb:	89 d1                	mov    %edx,%ecx
+  800ccd:	89 d3                	mov    %edx,%ebx
+  800ccf:	89 d7                	mov    %edx,%edi
+  800cd1:	89 d6                	mov    %edx,%esi
+  800cd3:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800cd5:	5b                   	pop    %ebx
+  800cd6:	5e                   	pop    %esi
+  800cd7:	5f                   	pop    %edi
+  800cd8:	5d                   	pop    %ebp
+  800cd9:	c3                   	ret
+
+00800cda <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800cda:	55                   	push   %ebp
+  800cdb:	89 e5                	mov    %esp,%ebp
+  800cdd:	57                   	push   %edi
+  800cde:	56                   	push   %esi
+  800cdf:	53                   	push   %ebx
+  800ce0:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800ce3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ce8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ceb:	b8 03 00 00 00       	mov    $0x3,%eax
+  800cf0:	89 cb                	mov    %ecx,%ebx
+  800cf2:	89 cf                	mov    %ecx,%edi
+  800cf4:	89 ce                	mov    %ecx,%esi
+  800cf6:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800cf8:	85 c0                	test   %eax,%eax
+  800cfa:	7f 08                	jg     800d04 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800cfc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cff:	5b                   	pop    %ebx
+  800d00:	5e                   	pop    %esi
+  800d01:	5f                   	pop    %edi
+  800d02:	5d                   	pop    %ebp
+  800d03:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d04:	83 ec 0c             	sub    $0xc,%esp
+  800d07:	50                   	push   %eax
+  800d08:	6a 03                	push   $0x3
+  800d0a:	68 e3 3e 80 00       	push   $0x803ee3
+  800d0f:	6a 23                	push   $0x23
+  800d11:	68 00 3f 80 00       	push   $0x803f00
+  800d16:	e8 89 f5 ff ff       	call   8002a4 <_panic>
+
+00800d1b <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800d1b:	55                   	push   %ebp
+  800d1c:	89 e5                	mov    %esp,%ebp
+  800d1e:	57                   	push   %edi
+  800d1f:	56                   	push   %esi
+  800d20:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d21:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d26:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d2b:	89 d1                	mov    %edx,%ecx
+  800d2d:	89 d3                	mov    %edx,%ebx
+  800d2f:	89 d7                	mov    %edx,%edi
+  800d31:	89 d6                	mov    %edx,%esi
+  800d33:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800d35:	5b                   	pop    %ebx
+  800d36:	5e                   	pop    %esi
+  800d37:	5f                   	pop    %edi
+  800d38:	5d                   	pop    %ebp
+  800d39:	c3                   	ret
+
+00800d3a <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800d3a:	55                   	push   %ebp
+  800d3b:	89 e5                	mov    %esp,%ebp
+  800d3d:	57                   	push   %edi
+  800d3e:	56                   	push   %esi
+  800d3f:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d40:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d45:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800d4a:	89 d1                	mov    %edx,%ecx
+  800d4c:	89 d3                	mov    %edx,%ebx
+  800d4e:	89 d7                	mov    %edx,%edi
+  800d50:	89 d6                	mov    %edx,%esi
+  800d52:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800d54:	5b                   	pop    %ebx
+  800d55:	5e                   	pop    %esi
+  800d56:	5f                   	pop    %edi
+  800d57:	5d                   	pop    %ebp
+  800d58:	c3                   	ret
+
+00800d59 <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  800d59:	55                   	push   %ebp
+  800d5a:	89 e5                	mov    %esp,%ebp
+  800d5c:	57                   	push   %edi
+  800d5d:	56                   	push   %esi
+  800d5e:	53                   	push   %ebx
+  800d5f:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  800d62:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  800d66:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d6b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d6e:	b8 14 00 00 00       	mov    $0x14,%eax
+  800d73:	89 df                	mov    %ebx,%edi
+  800d75:	89 de                	mov    %ebx,%esi
+  800d77:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d79:	85 c0                	test   %eax,%eax
+  800d7b:	7f 08                	jg     800d85 <sys_env_set_cow+0x2c>
+}
+  800d7d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d80:	5b                   	pop    %ebx
+  800d81:	5e                   	pop    %esi
+  800d82:	5f                   	pop    %edi
+  800d83:	5d                   	pop    %ebp
+  800d84:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d85:	83 ec 0c             	sub    $0xc,%esp
+  800d88:	50                   	push   %eax
+  800d89:	6a 14                	push   $0x14
+  800d8b:	68 e3 3e 80 00       	push   $0x803ee3
+  800d90:	6a 23                	push   $0x23
+  800d92:	68 00 3f 80 00       	push   $0x803f00
+  800d97:	e8 08 f5 ff ff       	call   8002a4 <_panic>
+
+00800d9c <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800d9c:	55                   	push   %ebp
+  800d9d:	89 e5                	mov    %esp,%ebp
+  800d9f:	57                   	push   %edi
+  800da0:	56                   	push   %esi
+  800da1:	53                   	push   %ebx
+  800da2:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800da5:	be 00 00 00 00       	mov    $0x0,%esi
+  800daa:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800db0:	b8 04 00 00 00       	mov    $0x4,%eax
+  800db5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800db8:	89 f7                	mov    %esi,%edi
+  800dba:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800dbc:	85 c0                	test   %eax,%eax
+  800dbe:	7f 08                	jg     800dc8 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  800dc0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dc3:	5b                   	pop    %ebx
+  800dc4:	5e                   	pop    %esi
+  800dc5:	5f                   	pop    %edi
+  800dc6:	5d                   	pop    %ebp
+  800dc7:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800dc8:	83 ec 0c             	sub    $0xc,%esp
+  800dcb:	50                   	push   %eax
+  800dcc:	6a 04                	push   $0x4
+  800dce:	68 e3 3e 80 00       	push   $0x803ee3
+  800dd3:	6a 23                	push   $0x23
+  800dd5:	68 00 3f 80 00       	push   $0x803f00
+  800dda:	e8 c5 f4 ff ff       	call   8002a4 <_panic>
+
+00800ddf <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800ddf:	55                   	push   %ebp
+  800de0:	89 e5                	mov    %esp,%ebp
+  800de2:	57                   	push   %edi
+  800de3:	56                   	push   %esi
+  800de4:	53                   	push   %ebx
+  800de5:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800de8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800deb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dee:	b8 05 00 00 00       	mov    $0x5,%eax
+  800df3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800df6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800df9:	8b 75 18             	mov    0x18(%ebp),%esi
+  800dfc:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800dfe:	85 c0                	test   %eax,%eax
+  800e00:	7f 08                	jg     800e0a <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  800e02:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e05:	5b                   	pop    %ebx
+  800e06:	5e                   	pop    %esi
+  800e07:	5f                   	pop    %edi
+  800e08:	5d                   	pop    %ebp
+  800e09:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e0a:	83 ec 0c             	sub    $0xc,%esp
+  800e0d:	50                   	push   %eax
+  800e0e:	6a 05                	push   $0x5
+  800e10:	68 e3 3e 80 00       	push   $0x803ee3
+  800e15:	6a 23                	push   $0x23
+  800e17:	68 00 3f 80 00       	push   $0x803f00
+  800e1c:	e8 83 f4 ff ff       	call   8002a4 <_panic>
+
+00800e21 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800e21:	55                   	push   %ebp
+  800e22:	89 e5                	mov    %esp,%ebp
+  800e24:	57                   	push   %edi
+  800e25:	56                   	push   %esi
+  800e26:	53                   	push   %ebx
+  800e27:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e2a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e2f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e32:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e35:	b8 06 00 00 00       	mov    $0x6,%eax
+  800e3a:	89 df                	mov    %ebx,%edi
+  800e3c:	89 de                	mov    %ebx,%esi
+  800e3e:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e40:	85 c0                	test   %eax,%eax
+  800e42:	7f 08                	jg     800e4c <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  800e44:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e47:	5b                   	pop    %ebx
+  800e48:	5e                   	pop    %esi
+  800e49:	5f                   	pop    %edi
+  800e4a:	5d                   	pop    %ebp
+  800e4b:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e4c:	83 ec 0c             	sub    $0xc,%esp
+  800e4f:	50                   	push   %eax
+  800e50:	6a 06                	push   $0x6
+  800e52:	68 e3 3e 80 00       	push   $0x803ee3
+  800e57:	6a 23                	push   $0x23
+  800e59:	68 00 3f 80 00       	push   $0x803f00
+  800e5e:	e8 41 f4 ff ff       	call   8002a4 <_panic>
+
+00800e63 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  800e63:	55                   	push   %ebp
+  800e64:	89 e5                	mov    %esp,%ebp
+  800e66:	57                   	push   %edi
+  800e67:	56                   	push   %esi
+  800e68:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e69:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e6c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e6f:	b8 11 00 00 00       	mov    $0x11,%eax
+  800e74:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e77:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e7a:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e7d:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  800e7f:	5b                   	pop    %ebx
+  800e80:	5e                   	pop    %esi
+  800e81:	5f                   	pop    %edi
+  800e82:	5d                   	pop    %ebp
+  800e83:	c3                   	ret
+
+00800e84 <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  800e84:	55                   	push   %ebp
+  800e85:	89 e5                	mov    %esp,%ebp
+  800e87:	57                   	push   %edi
+  800e88:	56                   	push   %esi
+  800e89:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e8a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e8d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e90:	b8 12 00 00 00       	mov    $0x12,%eax
+  800e95:	be 00 00 00 00       	mov    $0x0,%esi
+  800e9a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e9d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ea0:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  800ea2:	5b                   	pop    %ebx
+  800ea3:	5e                   	pop    %esi
+  800ea4:	5f                   	pop    %edi
+  800ea5:	5d                   	pop    %ebp
+  800ea6:	c3                   	ret
+
+00800ea7 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  800ea7:	55                   	push   %ebp
+  800ea8:	89 e5                	mov    %esp,%ebp
+  800eaa:	57                   	push   %edi
+  800eab:	56                   	push   %esi
+  800eac:	53                   	push   %ebx
+  800ead:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800eb0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eb5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eb8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ebb:	b8 16 00 00 00       	mov    $0x16,%eax
+  800ec0:	89 df                	mov    %ebx,%edi
+  800ec2:	89 de                	mov    %ebx,%esi
+  800ec4:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ec6:	85 c0                	test   %eax,%eax
+  800ec8:	7f 08                	jg     800ed2 <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  800eca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ecd:	5b                   	pop    %ebx
+  800ece:	5e                   	pop    %esi
+  800ecf:	5f                   	pop    %edi
+  800ed0:	5d                   	pop    %ebp
+  800ed1:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ed2:	83 ec 0c             	sub    $0xc,%esp
+  800ed5:	50                   	push   %eax
+  800ed6:	6a 16                	push   $0x16
+  800ed8:	68 e3 3e 80 00       	push   $0x803ee3
+  800edd:	6a 23                	push   $0x23
+  800edf:	68 00 3f 80 00       	push   $0x803f00
+  800ee4:	e8 bb f3 ff ff       	call   8002a4 <_panic>
+
+00800ee9 <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  800ee9:	55                   	push   %ebp
+  800eea:	89 e5                	mov    %esp,%ebp
+  800eec:	57                   	push   %edi
+  800eed:	56                   	push   %esi
+  800eee:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800eef:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ef4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ef7:	b8 17 00 00 00       	mov    $0x17,%eax
+  800efc:	89 cb                	mov    %ecx,%ebx
+  800efe:	89 cf                	mov    %ecx,%edi
+  800f00:	89 ce                	mov    %ecx,%esi
+  800f02:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  800f04:	5b                   	pop    %ebx
+  800f05:	5e                   	pop    %esi
+  800f06:	5f                   	pop    %edi
+  800f07:	5d                   	pop    %ebp
+  800f08:	c3                   	ret
+
+00800f09 <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  800f09:	55                   	push   %ebp
+  800f0a:	89 e5                	mov    %esp,%ebp
+  800f0c:	57                   	push   %edi
+  800f0d:	56                   	push   %esi
+  800f0e:	53                   	push   %ebx
+  800f0f:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f12:	be 00 00 00 00       	mov    $0x0,%esi
+  800f17:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f1a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f1d:	b8 18 00 00 00       	mov    $0x18,%eax
+  800f22:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f25:	89 f7                	mov    %esi,%edi
+  800f27:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f29:	85 c0                	test   %eax,%eax
+  800f2b:	7f 08                	jg     800f35 <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  800f2d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f30:	5b                   	pop    %ebx
+  800f31:	5e                   	pop    %esi
+  800f32:	5f                   	pop    %edi
+  800f33:	5d                   	pop    %ebp
+  800f34:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f35:	83 ec 0c             	sub    $0xc,%esp
+  800f38:	50                   	push   %eax
+  800f39:	6a 18                	push   $0x18
+  800f3b:	68 e3 3e 80 00       	push   $0x803ee3
+  800f40:	6a 23                	push   $0x23
+  800f42:	68 00 3f 80 00       	push   $0x803f00
+  800f47:	e8 58 f3 ff ff       	call   8002a4 <_panic>
+
+00800f4c <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  800f4c:	55                   	push   %ebp
+  800f4d:	89 e5                	mov    %esp,%ebp
+  800f4f:	57                   	push   %edi
+  800f50:	56                   	push   %esi
+  800f51:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f52:	be 00 00 00 00       	mov    $0x0,%esi
+  800f57:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f5a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f5d:	b8 19 00 00 00       	mov    $0x19,%eax
+  800f62:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f65:	89 f7                	mov    %esi,%edi
+  800f67:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  800f69:	5b                   	pop    %ebx
+  800f6a:	5e                   	pop    %esi
+  800f6b:	5f                   	pop    %edi
+  800f6c:	5d                   	pop    %ebp
+  800f6d:	c3                   	ret
+
+00800f6e <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  800f6e:	55                   	push   %ebp
+  800f6f:	89 e5                	mov    %esp,%ebp
+  800f71:	57                   	push   %edi
+  800f72:	56                   	push   %esi
+  800f73:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f74:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f79:	b8 15 00 00 00       	mov    $0x15,%eax
+  800f7e:	89 d1                	mov    %edx,%ecx
+  800f80:	89 d3                	mov    %edx,%ebx
+  800f82:	89 d7                	mov    %edx,%edi
+  800f84:	89 d6                	mov    %edx,%esi
+  800f86:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800f88:	5b                   	pop    %ebx
+  800f89:	5e                   	pop    %esi
+  800f8a:	5f                   	pop    %edi
+  800f8b:	5d                   	pop    %ebp
+  800f8c:	c3                   	ret
+
+00800f8d <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800f8d:	55                   	push   %ebp
+  800f8e:	89 e5                	mov    %esp,%ebp
+  800f90:	57                   	push   %edi
+  800f91:	56                   	push   %esi
+  800f92:	53                   	push   %ebx
+  800f93:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f96:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f9b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f9e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fa1:	b8 08 00 00 00       	mov    $0x8,%eax
+  800fa6:	89 df                	mov    %ebx,%edi
+  800fa8:	89 de                	mov    %ebx,%esi
+  800faa:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800fac:	85 c0                	test   %eax,%eax
+  800fae:	7f 08                	jg     800fb8 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800fb0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fb3:	5b                   	pop    %ebx
+  800fb4:	5e                   	pop    %esi
+  800fb5:	5f                   	pop    %edi
+  800fb6:	5d                   	pop    %ebp
+  800fb7:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800fb8:	83 ec 0c             	sub    $0xc,%esp
+  800fbb:	50                   	push   %eax
+  800fbc:	6a 08                	push   $0x8
+  800fbe:	68 e3 3e 80 00       	push   $0x803ee3
+  800fc3:	6a 23                	push   $0x23
+  800fc5:	68 00 3f 80 00       	push   $0x803f00
+  800fca:	e8 d5 f2 ff ff       	call   8002a4 <_panic>
+
+00800fcf <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800fcf:	55                   	push   %ebp
+  800fd0:	89 e5                	mov    %esp,%ebp
+  800fd2:	57                   	push   %edi
+  800fd3:	56                   	push   %esi
+  800fd4:	53                   	push   %ebx
+  800fd5:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800fd8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fdd:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fe3:	b8 09 00 00 00       	mov    $0x9,%eax
+  800fe8:	89 df                	mov    %ebx,%edi
+  800fea:	89 de                	mov    %ebx,%esi
+  800fec:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800fee:	85 c0                	test   %eax,%eax
+  800ff0:	7f 08                	jg     800ffa <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  800ff2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ff5:	5b                   	pop    %ebx
+  800ff6:	5e                   	pop    %esi
+  800ff7:	5f                   	pop    %edi
+  800ff8:	5d                   	pop    %ebp
+  800ff9:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ffa:	83 ec 0c             	sub    $0xc,%esp
+  800ffd:	50                   	push   %eax
+  800ffe:	6a 09                	push   $0x9
+  801000:	68 e3 3e 80 00       	push   $0x803ee3
+  801005:	6a 23                	push   $0x23
+  801007:	68 00 3f 80 00       	push   $0x803f00
+  80100c:	e8 93 f2 ff ff       	call   8002a4 <_panic>
+
+00801011 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801011:	55                   	push   %ebp
+  801012:	89 e5                	mov    %esp,%ebp
+  801014:	57                   	push   %edi
+  801015:	56                   	push   %esi
+  801016:	53                   	push   %ebx
+  801017:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80101a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80101f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801022:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801025:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80102a:	89 df                	mov    %ebx,%edi
+  80102c:	89 de                	mov    %ebx,%esi
+  80102e:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801030:	85 c0                	test   %eax,%eax
+  801032:	7f 08                	jg     80103c <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  801034:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801037:	5b                   	pop    %ebx
+  801038:	5e                   	pop    %esi
+  801039:	5f                   	pop    %edi
+  80103a:	5d                   	pop    %ebp
+  80103b:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80103c:	83 ec 0c             	sub    $0xc,%esp
+  80103f:	50                   	push   %eax
+  801040:	6a 0a                	push   $0xa
+  801042:	68 e3 3e 80 00       	push   $0x803ee3
+  801047:	6a 23                	push   $0x23
+  801049:	68 00 3f 80 00       	push   $0x803f00
+  80104e:	e8 51 f2 ff ff       	call   8002a4 <_panic>
+
+00801053 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  801053:	55                   	push   %ebp
+  801054:	89 e5                	mov    %esp,%ebp
+  801056:	57                   	push   %edi
+  801057:	56                   	push   %esi
+  801058:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801059:	8b 55 08             	mov    0x8(%ebp),%edx
+  80105c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80105f:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801064:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801067:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80106a:	8b 75 18             	mov    0x18(%ebp),%esi
+  80106d:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  80106f:	5b                   	pop    %ebx
+  801070:	5e                   	pop    %esi
+  801071:	5f                   	pop    %edi
+  801072:	5d                   	pop    %ebp
+  801073:	c3                   	ret
+
+00801074 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  801074:	55                   	push   %ebp
+  801075:	89 e5                	mov    %esp,%ebp
+  801077:	57                   	push   %edi
+  801078:	56                   	push   %esi
+  801079:	53                   	push   %ebx
+  80107a:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80107d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801082:	8b 55 08             	mov    0x8(%ebp),%edx
+  801085:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801088:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80108d:	89 df                	mov    %ebx,%edi
+  80108f:	89 de                	mov    %ebx,%esi
+  801091:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801093:	85 c0                	test   %eax,%eax
+  801095:	7f 08                	jg     80109f <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  801097:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80109a:	5b                   	pop    %ebx
+  80109b:	5e                   	pop    %esi
+  80109c:	5f                   	pop    %edi
+  80109d:	5d                   	pop    %ebp
+  80109e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80109f:	83 ec 0c             	sub    $0xc,%esp
+  8010a2:	50                   	push   %eax
+  8010a3:	6a 0d                	push   $0xd
+  8010a5:	68 e3 3e 80 00       	push   $0x803ee3
+  8010aa:	6a 23                	push   $0x23
+  8010ac:	68 00 3f 80 00       	push   $0x803f00
+  8010b1:	e8 ee f1 ff ff       	call   8002a4 <_panic>
+
+008010b6 <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  8010b6:	55                   	push   %ebp
+  8010b7:	89 e5                	mov    %esp,%ebp
+  8010b9:	57                   	push   %edi
+  8010ba:	56                   	push   %esi
+  8010bb:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8010bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010c1:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8010c6:	89 d1                	mov    %edx,%ecx
+  8010c8:	89 d3                	mov    %edx,%ebx
+  8010ca:	89 d7                	mov    %edx,%edi
+  8010cc:	89 d6                	mov    %edx,%esi
+  8010ce:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8010d0:	5b                   	pop    %ebx
+  8010d1:	5e                   	pop    %esi
+  8010d2:	5f                   	pop    %edi
+  8010d3:	5d                   	pop    %ebp
+  8010d4:	c3                   	ret
+
+008010d5 <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  8010d5:	55                   	push   %ebp
+  8010d6:	89 e5                	mov    %esp,%ebp
+  8010d8:	57                   	push   %edi
+  8010d9:	56                   	push   %esi
+  8010da:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8010db:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010de:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010e1:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8010e6:	be 00 00 00 00       	mov    $0x0,%esi
+  8010eb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010ee:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8010f1:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  8010f3:	5b                   	pop    %ebx
+  8010f4:	5e                   	pop    %esi
+  8010f5:	5f                   	pop    %edi
+  8010f6:	5d                   	pop    %ebp
+  8010f7:	c3                   	ret
+
+008010f8 <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  8010f8:	55                   	push   %ebp
+  8010f9:	89 e5                	mov    %esp,%ebp
+  8010fb:	57                   	push   %edi
+  8010fc:	56                   	push   %esi
+  8010fd:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8010fe:	be 00 00 00 00       	mov    $0x0,%esi
+  801103:	8b 55 08             	mov    0x8(%ebp),%edx
+  801106:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801109:	b8 10 00 00 00       	mov    $0x10,%eax
+  80110e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801111:	89 f7                	mov    %esi,%edi
+  801113:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  801115:	5b                   	pop    %ebx
+  801116:	5e                   	pop    %esi
+  801117:	5f                   	pop    %edi
+  801118:	5d                   	pop    %ebp
+  801119:	c3                   	ret
+
+0080111a <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  80111a:	55                   	push   %ebp
+  80111b:	89 e5                	mov    %esp,%ebp
+  80111d:	57                   	push   %edi
+  80111e:	56                   	push   %esi
+  80111f:	53                   	push   %ebx
+  801120:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  801123:	80 3d a4 68 80 00 00 	cmpb   $0x0,0x8068a4
+  80112a:	74 41                	je     80116d <sys_batch+0x53>
+  80112c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80112f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  801132:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  801139:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80113c:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  80113f:	7d 45                	jge    801186 <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  801141:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801144:	8b 06                	mov    (%esi),%eax
+  801146:	8b 56 04             	mov    0x4(%esi),%edx
+  801149:	8b 4e 08             	mov    0x8(%esi),%ecx
+  80114c:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  80114f:	8b 7e 10             	mov    0x10(%esi),%edi
+  801152:	8b 76 14             	mov    0x14(%esi),%esi
+  801155:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  801157:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80115a:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  80115d:	83 c6 1c             	add    $0x1c,%esi
+  801160:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  801163:	85 c0                	test   %eax,%eax
+  801165:	78 1f                	js     801186 <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  801167:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  80116b:	eb cc                	jmp    801139 <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  80116d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801172:	b8 13 00 00 00       	mov    $0x13,%eax
+  801177:	8b 55 08             	mov    0x8(%ebp),%edx
+  80117a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80117d:	89 df                	mov    %ebx,%edi
+  80117f:	89 de                	mov    %ebx,%esi
+  801181:	cd 30                	int    $0x30
+  801183:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  801186:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801189:	83 c4 08             	add    $0x8,%esp
+  80118c:	5b                   	pop    %ebx
+  80118d:	5e                   	pop    %esi
+  80118e:	5f                   	pop    %edi
+  80118f:	5d                   	pop    %ebp
+  801190:	c3                   	ret
+
+00801191 <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  801191:	55                   	push   %ebp
+  801192:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  801194:	8b 45 08             	mov    0x8(%ebp),%eax
+  801197:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  80119d:	5d                   	pop    %ebp
+  80119e:	c3                   	ret
+
+0080119f <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  80119f:	55                   	push   %ebp
+  8011a0:	89 e5                	mov    %esp,%ebp
+  8011a2:	56                   	push   %esi
+  8011a3:	53                   	push   %ebx
+  8011a4:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  8011a7:	8b 1e                	mov    (%esi),%ebx
+  8011a9:	85 db                	test   %ebx,%ebx
+  8011ab:	75 09                	jne    8011b6 <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  8011ad:	89 d8                	mov    %ebx,%eax
+  8011af:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8011b2:	5b                   	pop    %ebx
+  8011b3:	5e                   	pop    %esi
+  8011b4:	5d                   	pop    %ebp
+  8011b5:	c3                   	ret
+  b->sb_n = 0;
+  8011b6:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  8011bc:	53                   	push   %ebx
+  8011bd:	8d 46 04             	lea    0x4(%esi),%eax
+  8011c0:	50                   	push   %eax
+  8011c1:	e8 54 ff ff ff       	call   80111a <sys_batch>
+  8011c6:	83 c4 08             	add    $0x8,%esp
+  8011c9:	85 c0                	test   %eax,%eax
+  8011cb:	78 1e                	js     8011eb <sysbatch_flush+0x4c>
+  if (r < n)
+  8011cd:	39 c3                	cmp    %eax,%ebx
+  8011cf:	7f 07                	jg     8011d8 <sysbatch_flush+0x39>
+  return 0;
+  8011d1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011d6:	eb d5                	jmp    8011ad <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  8011d8:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8011db:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  8011df:	85 db                	test   %ebx,%ebx
+  8011e1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011e6:	0f 49 d8             	cmovns %eax,%ebx
+  8011e9:	eb c2                	jmp    8011ad <sysbatch_flush+0xe>
+    return r;
+  8011eb:	89 c3                	mov    %eax,%ebx
+  8011ed:	eb be                	jmp    8011ad <sysbatch_flush+0xe>
+
+008011ef <sysbatch_add>:
+{
+  8011ef:	55                   	push   %ebp
+  8011f0:	89 e5                	mov    %esp,%ebp
+  8011f2:	53                   	push   %ebx
+  8011f3:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  8011f6:	83 3b 40             	cmpl   $0x40,(%ebx)
+  8011f9:	74 41                	je     80123c <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  8011fb:	8b 03                	mov    (%ebx),%eax
+  8011fd:	8d 50 01             	lea    0x1(%eax),%edx
+  801200:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  801202:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801205:	01 d8                	add    %ebx,%eax
+  801207:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80120a:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  80120d:	8b 55 10             	mov    0x10(%ebp),%edx
+  801210:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  801213:	8b 55 14             	mov    0x14(%ebp),%edx
+  801216:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  801219:	8b 55 18             	mov    0x18(%ebp),%edx
+  80121c:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  80121f:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  801222:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  801225:	8b 55 20             	mov    0x20(%ebp),%edx
+  801228:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  80122b:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  801232:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801237:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80123a:	c9                   	leave
+  80123b:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  80123c:	53                   	push   %ebx
+  80123d:	e8 5d ff ff ff       	call   80119f <sysbatch_flush>
+  801242:	83 c4 04             	add    $0x4,%esp
+  801245:	85 c0                	test   %eax,%eax
+  801247:	79 b2                	jns    8011fb <sysbatch_add+0xc>
+  801249:	eb ec                	jmp    801237 <sysbatch_add+0x48>
+
+0080124b <pgfault>:
+// Custom page fault handler - if faulting page is copy-on-write,
+// map in our own private writable copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  80124b:	55                   	push   %ebp
+  80124c:	89 e5                	mov    %esp,%ebp
+  80124e:	56                   	push   %esi
+  80124f:	53                   	push   %ebx
+  801250:	8b 45 08             	mov    0x8(%ebp),%eax
+  void *addr = (void*)utf->utf_fault_va;
+  801253:	8b 18                	mov    (%eax),%ebx
+  uint32_t err = utf->utf_err;
+  801255:	8b 70 04             	mov    0x4(%eax),%esi
+  // Hint:
+  //   Use the read-only page table mappings at uvpt
+  //   (see <inc/memlayout.h>).
+
+  // Faults in file mappings are mmap's to handle.
+  if (mmap_fault(utf))
+  801258:	83 ec 0c             	sub    $0xc,%esp
+  80125b:	50                   	push   %eax
+  80125c:	e8 b4 1d 00 00       	call   803015 <mmap_fault>
+  801261:	83 c4 10             	add    $0x10,%esp
+  801264:	84 c0                	test   %al,%al
+  801266:	75 7d                	jne    8012e5 <pgfault+0x9a>
+    return;
+
+  // LAB 4: Your code here.
+  if ( !(err & FEC_WR) ) {
+  801268:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  80126e:	74 7c                	je     8012ec <pgfault+0xa1>
+    panic("user_pgfault: %e", err);
+  }
+
+  if ( !(uvpt[PGNUM(addr)] & PTE_COW) ) {
+  801270:	89 d8                	mov    %ebx,%eax
+  801272:	c1 e8 0c             	shr    $0xc,%eax
+  801275:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80127c:	f6 c4 08             	test   $0x8,%ah
+  80127f:	74 7d                	je     8012fe <pgfault+0xb3>
+  // page to the old page's address.
+  // Hint:
+  //   You should make three system calls.
+
+  // LAB 4: Your code here.
+  addr = ROUNDDOWN(addr, PGSIZE);
+  801281:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+
+  // map page to temporary location
+  if ( (r = sys_page_alloc(0, PFTEMP, (PTE_P | PTE_U | PTE_W))) < 0) {
+  801287:	83 ec 04             	sub    $0x4,%esp
+  80128a:	6a 07                	push   $0x7
+  80128c:	68 00 f0 7f 00       	push   $0x7ff000
+  801291:	6a 00                	push   $0x0
+  801293:	e8 04 fb ff ff       	call   800d9c <sys_page_alloc>
+  801298:	83 c4 10             	add    $0x10,%esp
+  80129b:	85 c0                	test   %eax,%eax
+  80129d:	78 73                	js     801312 <pgfault+0xc7>
+    panic("sys_page_alloc: %e", r);
+  }
+
+  // copy data from old page to new page
+  memmove(PFTEMP, addr, PGSIZE);
+  80129f:	83 ec 04             	sub    $0x4,%esp
+  8012a2:	68 00 10 00 00       	push   $0x1000
+  8012a7:	53                   	push   %ebx
+  8012a8:	68 00 f0 7f 00       	push   $0x7ff000
+  8012ad:	e8 41 f8 ff ff       	call   800af3 <memmove>
+
+  // move new page to old page address
+  if ( (r = sys_page_map(0, PFTEMP, 0, addr, (PTE_P | PTE_U | PTE_W))) < 0) {
+  8012b2:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8012b9:	53                   	push   %ebx
+  8012ba:	6a 00                	push   $0x0
+  8012bc:	68 00 f0 7f 00       	push   $0x7ff000
+  8012c1:	6a 00                	push   $0x0
+  8012c3:	e8 17 fb ff ff       	call   800ddf <sys_page_map>
+  8012c8:	83 c4 20             	add    $0x20,%esp
+  8012cb:	85 c0                	test   %eax,%eax
+  8012cd:	78 55                	js     801324 <pgfault+0xd9>
+    panic("sys_page_map: %e", r);
+  }
+
+  if ( (r = sys_page_unmap(0, PFTEMP)) < 0) {
+  8012cf:	83 ec 08             	sub    $0x8,%esp
+  8012d2:	68 00 f0 7f 00       	push   $0x7ff000
+  8012d7:	6a 00                	push   $0x0
+  8012d9:	e8 43 fb ff ff       	call   800e21 <sys_page_unmap>
+  8012de:	83 c4 10             	add    $0x10,%esp
+  8012e1:	85 c0                	test   %eax,%eax
+  8012e3:	78 51                	js     801336 <pgfault+0xeb>
+    panic("sys_page_unmap: %e", r);
+  }
+}
+  8012e5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8012e8:	5b                   	pop    %ebx
+  8012e9:	5e                   	pop    %esi
+  8012ea:	5d                   	pop    %ebp
+  8012eb:	c3                   	ret
+    panic("user_pgfault: %e", err);
+  8012ec:	56                   	push   %esi
+  8012ed:	68 0e 3f 80 00       	push   $0x803f0e
+  8012f2:	6a 1d                	push   $0x1d
+  8012f4:	68 1f 3f 80 00       	push   $0x803f1f
+  8012f9:	e8 a6 ef ff ff       	call   8002a4 <_panic>
+    panic("user_pgfault: page not COW");
+  8012fe:	83 ec 04             	sub    $0x4,%esp
+  801301:	68 2a 3f 80 00       	push   $0x803f2a
+  801306:	6a 21                	push   $0x21
+  801308:	68 1f 3f 80 00       	push   $0x803f1f
+  80130d:	e8 92 ef ff ff       	call   8002a4 <_panic>
+    panic("sys_page_alloc: %e", r);
+  801312:	50                   	push   %eax
+  801313:	68 45 3f 80 00       	push   $0x803f45
+  801318:	6a 2f                	push   $0x2f
+  80131a:	68 1f 3f 80 00       	push   $0x803f1f
+  80131f:	e8 80 ef ff ff       	call   8002a4 <_panic>
+    panic("sys_page_map: %e", r);
+  801324:	50                   	push   %eax
+  801325:	68 58 3f 80 00       	push   $0x803f58
+  80132a:	6a 37                	push   $0x37
+  80132c:	68 1f 3f 80 00       	push   $0x803f1f
+  801331:	e8 6e ef ff ff       	call   8002a4 <_panic>
+    panic("sys_page_unmap: %e", r);
+  801336:	50                   	push   %eax
+  801337:	68 69 3f 80 00       	push   $0x803f69
+  80133c:	6a 3b                	push   $0x3b
+  80133e:	68 1f 3f 80 00       	push   $0x803f1f
+  801343:	e8 5c ef ff ff       	call   8002a4 <_panic>
+
+00801348 <shared_pgfault>:
+
+// Challenge!
+//
+static void
+shared_pgfault(struct UTrapframe *utf)
+{
+  801348:	55                   	push   %ebp
+  801349:	89 e5                	mov    %esp,%ebp
+  80134b:	53                   	push   %ebx
+  80134c:	83 ec 10             	sub    $0x10,%esp
+  80134f:	8b 45 08             	mov    0x8(%ebp),%eax
+  // just has fewer error checks
+  
+  void *addr = (void*)utf->utf_fault_va;
+  801352:	8b 18                	mov    (%eax),%ebx
+  uint32_t err = utf->utf_err;
+  int r;
+
+  if (mmap_fault(utf))
+  801354:	50                   	push   %eax
+  801355:	e8 bb 1c 00 00       	call   803015 <mmap_fault>
+  80135a:	83 c4 10             	add    $0x10,%esp
+  80135d:	84 c0                	test   %al,%al
+  80135f:	74 05                	je     801366 <shared_pgfault+0x1e>
+  }
+
+  if ( (r = sys_page_unmap(0, PFTEMP)) < 0) {
+    panic("sys_page_unmap: %e", r);
+  }
+}
+  801361:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801364:	c9                   	leave
+  801365:	c3                   	ret
+  addr = ROUNDDOWN(addr, PGSIZE);
+  801366:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if ( (r = sys_page_alloc(0, PFTEMP, (PTE_P | PTE_U | PTE_W))) < 0) {
+  80136c:	83 ec 04             	sub    $0x4,%esp
+  80136f:	6a 07                	push   $0x7
+  801371:	68 00 f0 7f 00       	push   $0x7ff000
+  801376:	6a 00                	push   $0x0
+  801378:	e8 1f fa ff ff       	call   800d9c <sys_page_alloc>
+  80137d:	83 c4 10             	add    $0x10,%esp
+  801380:	85 c0                	test   %eax,%eax
+  801382:	78 5b                	js     8013df <shared_pgfault+0x97>
+  memmove(PFTEMP, addr, PGSIZE);
+  801384:	83 ec 04             	sub    $0x4,%esp
+  801387:	68 00 10 00 00       	push   $0x1000
+  80138c:	53                   	push   %ebx
+  80138d:	68 00 f0 7f 00       	push   $0x7ff000
+  801392:	e8 5c f7 ff ff       	call   800af3 <memmove>
+  if ( (r = sys_page_map(0, PFTEMP, 0, addr, (PTE_P | PTE_U | PTE_W))) < 0) {
+  801397:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  80139e:	53                   	push   %ebx
+  80139f:	6a 00                	push   $0x0
+  8013a1:	68 00 f0 7f 00       	push   $0x7ff000
+  8013a6:	6a 00                	push   $0x0
+  8013a8:	e8 32 fa ff ff       	call   800ddf <sys_page_map>
+  8013ad:	83 c4 20             	add    $0x20,%esp
+  8013b0:	85 c0                	test   %eax,%eax
+  8013b2:	78 40                	js     8013f4 <shared_pgfault+0xac>
+  if ( (r = sys_page_unmap(0, PFTEMP)) < 0) {
+  8013b4:	83 ec 08             	sub    $0x8,%esp
+  8013b7:	68 00 f0 7f 00       	push   $0x7ff000
+  8013bc:	6a 00                	push   $0x0
+  8013be:	e8 5e fa ff ff       	call   800e21 <sys_page_unmap>
+  8013c3:	83 c4 10             	add    $0x10,%esp
+  8013c6:	85 c0                	test   %eax,%eax
+  8013c8:	79 97                	jns    801361 <shared_pgfault+0x19>
+    panic("sys_page_unmap: %e", r);
+  8013ca:	50                   	push   %eax
+  8013cb:	68 69 3f 80 00       	push   $0x803f69
+  8013d0:	68 b0 00 00 00       	push   $0xb0
+  8013d5:	68 1f 3f 80 00       	push   $0x803f1f
+  8013da:	e8 c5 ee ff ff       	call   8002a4 <_panic>
+    panic("sys_page_alloc: %e", r);
+  8013df:	50                   	push   %eax
+  8013e0:	68 45 3f 80 00       	push   $0x803f45
+  8013e5:	68 a4 00 00 00       	push   $0xa4
+  8013ea:	68 1f 3f 80 00       	push   $0x803f1f
+  8013ef:	e8 b0 ee ff ff       	call   8002a4 <_panic>
+    panic("sys_page_map: %e", r);
+  8013f4:	50                   	push   %eax
+  8013f5:	68 58 3f 80 00       	push   $0x803f58
+  8013fa:	68 ac 00 00 00       	push   $0xac
+  8013ff:	68 1f 3f 80 00       	push   $0x803f1f
+  801404:	e8 9b ee ff ff       	call   8002a4 <_panic>
+
+00801409 <fork>:
+{
+  801409:	55                   	push   %ebp
+  80140a:	89 e5                	mov    %esp,%ebp
+  80140c:	53                   	push   %ebx
+  80140d:	83 ec 04             	sub    $0x4,%esp
+  parent_id = sys_getenvid();
+  801410:	e8 06 f9 ff ff       	call   800d1b <sys_getenvid>
+  set_pgfault_handler(pgfault);
+  801415:	83 ec 0c             	sub    $0xc,%esp
+  801418:	68 4b 12 80 00       	push   $0x80124b
+  80141d:	e8 82 22 00 00       	call   8036a4 <set_pgfault_handler>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+  envid_t ret;
+  __asm __volatile("int %2"
+  801422:	b8 07 00 00 00       	mov    $0x7,%eax
+  801427:	cd 30                	int    $0x30
+  801429:	89 c3                	mov    %eax,%ebx
+  if (envid < 0) {
+  80142b:	83 c4 10             	add    $0x10,%esp
+  80142e:	85 c0                	test   %eax,%eax
+  801430:	78 66                	js     801498 <fork+0x8f>
+  } else if (envid == 0) {
+  801432:	74 76                	je     8014aa <fork+0xa1>
+  if ( (error = sys_page_map_range(0, 0, UXSTACKTOP - PGSIZE,
+  801434:	83 ec 0c             	sub    $0xc,%esp
+  801437:	6a 01                	push   $0x1
+  801439:	50                   	push   %eax
+  80143a:	68 00 f0 bf ee       	push   $0xeebff000
+  80143f:	6a 00                	push   $0x0
+  801441:	6a 00                	push   $0x0
+  801443:	e8 1b fa ff ff       	call   800e63 <sys_page_map_range>
+  801448:	83 c4 20             	add    $0x20,%esp
+  80144b:	85 c0                	test   %eax,%eax
+  80144d:	78 77                	js     8014c6 <fork+0xbd>
+  if ( (error = sys_page_alloc(envid,
+  80144f:	83 ec 04             	sub    $0x4,%esp
+  801452:	6a 07                	push   $0x7
+  801454:	68 00 f0 bf ee       	push   $0xeebff000
+  801459:	53                   	push   %ebx
+  80145a:	e8 3d f9 ff ff       	call   800d9c <sys_page_alloc>
+  80145f:	83 c4 10             	add    $0x10,%esp
+  801462:	85 c0                	test   %eax,%eax
+  801464:	78 72                	js     8014d8 <fork+0xcf>
+          thisenv->env_pgfault_upcall)) < 0) {
+  801466:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  80146b:	8b 40 64             	mov    0x64(%eax),%eax
+  if ( (error = sys_env_set_pgfault_upcall(envid,
+  80146e:	83 ec 08             	sub    $0x8,%esp
+  801471:	50                   	push   %eax
+  801472:	53                   	push   %ebx
+  801473:	e8 99 fb ff ff       	call   801011 <sys_env_set_pgfault_upcall>
+  801478:	83 c4 10             	add    $0x10,%esp
+  80147b:	85 c0                	test   %eax,%eax
+  80147d:	78 6b                	js     8014ea <fork+0xe1>
+  if ( (error = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+  80147f:	83 ec 08             	sub    $0x8,%esp
+  801482:	6a 02                	push   $0x2
+  801484:	53                   	push   %ebx
+  801485:	e8 03 fb ff ff       	call   800f8d <sys_env_set_status>
+  80148a:	83 c4 10             	add    $0x10,%esp
+  80148d:	85 c0                	test   %eax,%eax
+  80148f:	78 6b                	js     8014fc <fork+0xf3>
+}
+  801491:	89 d8                	mov    %ebx,%eax
+  801493:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801496:	c9                   	leave
+  801497:	c3                   	ret
+    panic("sys_exofork: %e", envid);
+  801498:	50                   	push   %eax
+  801499:	68 7c 3f 80 00       	push   $0x803f7c
+  80149e:	6a 5e                	push   $0x5e
+  8014a0:	68 1f 3f 80 00       	push   $0x803f1f
+  8014a5:	e8 fa ed ff ff       	call   8002a4 <_panic>
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8014aa:	e8 6c f8 ff ff       	call   800d1b <sys_getenvid>
+  8014af:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8014b4:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8014b7:	c1 e0 04             	shl    $0x4,%eax
+  8014ba:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8014bf:	a3 a0 68 80 00       	mov    %eax,0x8068a0
+    return 0;
+  8014c4:	eb cb                	jmp    801491 <fork+0x88>
+    panic("sys_page_map_range: %e", error);
+  8014c6:	50                   	push   %eax
+  8014c7:	68 8c 3f 80 00       	push   $0x803f8c
+  8014cc:	6a 69                	push   $0x69
+  8014ce:	68 1f 3f 80 00       	push   $0x803f1f
+  8014d3:	e8 cc ed ff ff       	call   8002a4 <_panic>
+    panic("sys_page_alloc: %e", error);
+  8014d8:	50                   	push   %eax
+  8014d9:	68 45 3f 80 00       	push   $0x803f45
+  8014de:	6a 70                	push   $0x70
+  8014e0:	68 1f 3f 80 00       	push   $0x803f1f
+  8014e5:	e8 ba ed ff ff       	call   8002a4 <_panic>
+    panic("sys_env_set_pgfault_upcall: %e", error);
+  8014ea:	50                   	push   %eax
+  8014eb:	68 bc 3f 80 00       	push   $0x803fbc
+  8014f0:	6a 76                	push   $0x76
+  8014f2:	68 1f 3f 80 00       	push   $0x803f1f
+  8014f7:	e8 a8 ed ff ff       	call   8002a4 <_panic>
+    panic("sys_env_set_status: %e", error);
+  8014fc:	50                   	push   %eax
+  8014fd:	68 a3 3f 80 00       	push   $0x803fa3
+  801502:	6a 7a                	push   $0x7a
+  801504:	68 1f 3f 80 00       	push   $0x803f1f
+  801509:	e8 96 ed ff ff       	call   8002a4 <_panic>
+
+0080150e <kfork>:
+{
+  80150e:	55                   	push   %ebp
+  80150f:	89 e5                	mov    %esp,%ebp
+  801511:	53                   	push   %ebx
+  801512:	83 ec 10             	sub    $0x10,%esp
+  set_pgfault_handler(pgfault);
+  801515:	68 4b 12 80 00       	push   $0x80124b
+  80151a:	e8 85 21 00 00       	call   8036a4 <set_pgfault_handler>
+  if ((envid = sys_fork()) == 0)
+  80151f:	e8 4a fa ff ff       	call   800f6e <sys_fork>
+  801524:	89 c3                	mov    %eax,%ebx
+  801526:	83 c4 10             	add    $0x10,%esp
+  801529:	85 c0                	test   %eax,%eax
+  80152b:	74 07                	je     801534 <kfork+0x26>
+}
+  80152d:	89 d8                	mov    %ebx,%eax
+  80152f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801532:	c9                   	leave
+  801533:	c3                   	ret
+    thisenv = &envs[ENVX(sys_getenvid())];
+  801534:	e8 e2 f7 ff ff       	call   800d1b <sys_getenvid>
+  801539:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80153e:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  801541:	c1 e0 04             	shl    $0x4,%eax
+  801544:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801549:	a3 a0 68 80 00       	mov    %eax,0x8068a0
+  return envid;
+  80154e:	eb dd                	jmp    80152d <kfork+0x1f>
+
+00801550 <sfork>:
+
+int
+sfork(void)
+{
+  801550:	55                   	push   %ebp
+  801551:	89 e5                	mov    %esp,%ebp
+  801553:	53                   	push   %ebx
+  801554:	83 ec 04             	sub    $0x4,%esp
+  envid_t envid, parent_id;
+  int error;
+
+  parent_id = sys_getenvid();
+  801557:	e8 bf f7 ff ff       	call   800d1b <sys_getenvid>
+
+  // set up page fault handler
+  set_pgfault_handler(shared_pgfault);
+  80155c:	83 ec 0c             	sub    $0xc,%esp
+  80155f:	68 48 13 80 00       	push   $0x801348
+  801564:	e8 3b 21 00 00       	call   8036a4 <set_pgfault_handler>
+  801569:	b8 07 00 00 00       	mov    $0x7,%eax
+  80156e:	cd 30                	int    $0x30
+  801570:	89 c3                	mov    %eax,%ebx
+
+  // create a child with sys_exofork
+  envid = sys_exofork();
+  
+  if (envid < 0) {
+  801572:	83 c4 10             	add    $0x10,%esp
+  801575:	85 c0                	test   %eax,%eax
+  801577:	78 09                	js     801582 <sfork+0x32>
+    panic("sys_exofork: %e", envid);
+  } else if (envid == 0) {
+  801579:	75 1c                	jne    801597 <sfork+0x47>
+  if ( (error = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+    panic("sys_env_set_status: %e", error);
+  }
+
+  return envid;
+}
+  80157b:	89 d8                	mov    %ebx,%eax
+  80157d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801580:	c9                   	leave
+  801581:	c3                   	ret
+    panic("sys_exofork: %e", envid);
+  801582:	50                   	push   %eax
+  801583:	68 7c 3f 80 00       	push   $0x803f7c
+  801588:	68 c3 00 00 00       	push   $0xc3
+  80158d:	68 1f 3f 80 00       	push   $0x803f1f
+  801592:	e8 0d ed ff ff       	call   8002a4 <_panic>
+  if ( (error = sys_page_map_range(0, 0, USTACKTOP - PGSIZE,
+  801597:	83 ec 0c             	sub    $0xc,%esp
+  80159a:	6a 00                	push   $0x0
+  80159c:	50                   	push   %eax
+  80159d:	68 00 d0 bf ee       	push   $0xeebfd000
+  8015a2:	6a 00                	push   $0x0
+  8015a4:	6a 00                	push   $0x0
+  8015a6:	e8 b8 f8 ff ff       	call   800e63 <sys_page_map_range>
+  8015ab:	83 c4 20             	add    $0x20,%esp
+  8015ae:	85 c0                	test   %eax,%eax
+  8015b0:	78 79                	js     80162b <sfork+0xdb>
+  if ( (error = sys_page_map_range(0, (void *) (USTACKTOP - PGSIZE), PGSIZE,
+  8015b2:	83 ec 0c             	sub    $0xc,%esp
+  8015b5:	6a 01                	push   $0x1
+  8015b7:	53                   	push   %ebx
+  8015b8:	68 00 10 00 00       	push   $0x1000
+  8015bd:	68 00 d0 bf ee       	push   $0xeebfd000
+  8015c2:	6a 00                	push   $0x0
+  8015c4:	e8 9a f8 ff ff       	call   800e63 <sys_page_map_range>
+  8015c9:	83 c4 20             	add    $0x20,%esp
+  8015cc:	85 c0                	test   %eax,%eax
+  8015ce:	78 70                	js     801640 <sfork+0xf0>
+  if ( (error = sys_page_alloc(envid,
+  8015d0:	83 ec 04             	sub    $0x4,%esp
+  8015d3:	6a 07                	push   $0x7
+  8015d5:	68 00 f0 bf ee       	push   $0xeebff000
+  8015da:	53                   	push   %ebx
+  8015db:	e8 bc f7 ff ff       	call   800d9c <sys_page_alloc>
+  8015e0:	83 c4 10             	add    $0x10,%esp
+  8015e3:	85 c0                	test   %eax,%eax
+  8015e5:	78 6e                	js     801655 <sfork+0x105>
+          thisenv->env_pgfault_upcall)) < 0) {
+  8015e7:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  8015ec:	8b 40 64             	mov    0x64(%eax),%eax
+  if ( (error = sys_env_set_pgfault_upcall(envid,
+  8015ef:	83 ec 08             	sub    $0x8,%esp
+  8015f2:	50                   	push   %eax
+  8015f3:	53                   	push   %ebx
+  8015f4:	e8 18 fa ff ff       	call   801011 <sys_env_set_pgfault_upcall>
+  8015f9:	83 c4 10             	add    $0x10,%esp
+  8015fc:	85 c0                	test   %eax,%eax
+  8015fe:	78 6a                	js     80166a <sfork+0x11a>
+  if ( (error = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+  801600:	83 ec 08             	sub    $0x8,%esp
+  801603:	6a 02                	push   $0x2
+  801605:	53                   	push   %ebx
+  801606:	e8 82 f9 ff ff       	call   800f8d <sys_env_set_status>
+  80160b:	83 c4 10             	add    $0x10,%esp
+  80160e:	85 c0                	test   %eax,%eax
+  801610:	0f 89 65 ff ff ff    	jns    80157b <sfork+0x2b>
+    panic("sys_env_set_status: %e", error);
+  801616:	50                   	push   %eax
+  801617:	68 a3 3f 80 00       	push   $0x803fa3
+  80161c:	68 e4 00 00 00       	push   $0xe4
+  801621:	68 1f 3f 80 00       	push   $0x803f1f
+  801626:	e8 79 ec ff ff       	call   8002a4 <_panic>
+    panic("sys_page_map_range: %e", error);
+  80162b:	50                   	push   %eax
+  80162c:	68 8c 3f 80 00       	push   $0x803f8c
+  801631:	68 ce 00 00 00       	push   $0xce
+  801636:	68 1f 3f 80 00       	push   $0x803f1f
+  80163b:	e8 64 ec ff ff       	call   8002a4 <_panic>
+    panic("sys_page_map_range: %e", error);
+  801640:	50                   	push   %eax
+  801641:	68 8c 3f 80 00       	push   $0x803f8c
+  801646:	68 d3 00 00 00       	push   $0xd3
+  80164b:	68 1f 3f 80 00       	push   $0x803f1f
+  801650:	e8 4f ec ff ff       	call   8002a4 <_panic>
+    panic("sys_page_alloc: %e", error);
+  801655:	50                   	push   %eax
+  801656:	68 45 3f 80 00       	push   $0x803f45
+  80165b:	68 da 00 00 00       	push   $0xda
+  801660:	68 1f 3f 80 00       	push   $0x803f1f
+  801665:	e8 3a ec ff ff       	call   8002a4 <_panic>
+    panic("sys_env_set_pgfault_upcall: %e", error);
+  80166a:	50                   	push   %eax
+  80166b:	68 bc 3f 80 00       	push   $0x803fbc
+  801670:	68 e0 00 00 00       	push   $0xe0
+  801675:	68 1f 3f 80 00       	push   $0x803f1f
+  80167a:	e8 25 ec ff ff       	call   8002a4 <_panic>
+
+0080167f <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80167f:	55                   	push   %ebp
+  801680:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801682:	8b 45 08             	mov    0x8(%ebp),%eax
+  801685:	05 00 00 00 30       	add    $0x30000000,%eax
+  80168a:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80168d:	5d                   	pop    %ebp
+  80168e:	c3                   	ret
+
+0080168f <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80168f:	55                   	push   %ebp
+  801690:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801692:	8b 45 08             	mov    0x8(%ebp),%eax
+  801695:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  801698:	66 b8 00 00          	mov    $0x0,%ax
+  80169c:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8016a1:	5d                   	pop    %ebp
+  8016a2:	c3                   	ret
+
+008016a3 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8016a3:	55                   	push   %ebp
+  8016a4:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  8016a6:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8016ab:	eb 02                	jmp    8016af <fd_alloc+0xc>
+  8016ad:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8016af:	89 c2                	mov    %eax,%edx
+  8016b1:	c1 ea 16             	shr    $0x16,%edx
+  8016b4:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8016bb:	f6 c2 01             	test   $0x1,%dl
+  8016be:	74 2b                	je     8016eb <fd_alloc+0x48>
+  8016c0:	89 c2                	mov    %eax,%edx
+  8016c2:	c1 ea 0c             	shr    $0xc,%edx
+  8016c5:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8016cc:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8016d2:	f6 c1 01             	test   $0x1,%cl
+  8016d5:	74 14                	je     8016eb <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  8016d7:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8016dd:	75 ce                	jne    8016ad <fd_alloc+0xa>
+  8016df:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  8016e4:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8016e9:	eb 05                	jmp    8016f0 <fd_alloc+0x4d>
+      return 0;
+  8016eb:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  8016f0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016f3:	89 02                	mov    %eax,(%edx)
+}
+  8016f5:	89 c8                	mov    %ecx,%eax
+  8016f7:	5d                   	pop    %ebp
+  8016f8:	c3                   	ret
+
+008016f9 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8016f9:	55                   	push   %ebp
+  8016fa:	89 e5                	mov    %esp,%ebp
+  8016fc:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  8016ff:	83 f8 1f             	cmp    $0x1f,%eax
+  801702:	77 30                	ja     801734 <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  801704:	c1 e0 0c             	shl    $0xc,%eax
+  801707:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80170c:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801712:	f6 c2 01             	test   $0x1,%dl
+  801715:	74 24                	je     80173b <fd_lookup+0x42>
+  801717:	89 c2                	mov    %eax,%edx
+  801719:	c1 ea 0c             	shr    $0xc,%edx
+  80171c:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801723:	f6 c2 01             	test   $0x1,%dl
+  801726:	74 1a                	je     801742 <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  801728:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80172b:	89 02                	mov    %eax,(%edx)
+  return 0;
+  80172d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801732:	5d                   	pop    %ebp
+  801733:	c3                   	ret
+    return -E_INVAL;
+  801734:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801739:	eb f7                	jmp    801732 <fd_lookup+0x39>
+    return -E_INVAL;
+  80173b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801740:	eb f0                	jmp    801732 <fd_lookup+0x39>
+  801742:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801747:	eb e9                	jmp    801732 <fd_lookup+0x39>
+
+00801749 <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801749:	55                   	push   %ebp
+  80174a:	89 e5                	mov    %esp,%ebp
+  80174c:	53                   	push   %ebx
+  80174d:	83 ec 04             	sub    $0x4,%esp
+  801750:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  801753:	b8 58 40 80 00       	mov    $0x804058,%eax
+  801758:	8b 18                	mov    (%eax),%ebx
+  80175a:	85 db                	test   %ebx,%ebx
+  80175c:	74 0e                	je     80176c <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  80175e:	83 c0 04             	add    $0x4,%eax
+  801761:	39 13                	cmp    %edx,(%ebx)
+  801763:	75 f3                	jne    801758 <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  801765:	b8 00 00 00 00       	mov    $0x0,%eax
+  80176a:	eb 1f                	jmp    80178b <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80176c:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  801771:	8b 40 48             	mov    0x48(%eax),%eax
+  801774:	83 ec 04             	sub    $0x4,%esp
+  801777:	52                   	push   %edx
+  801778:	50                   	push   %eax
+  801779:	68 dc 3f 80 00       	push   $0x803fdc
+  80177e:	e8 fc eb ff ff       	call   80037f <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  801783:	83 c4 10             	add    $0x10,%esp
+  801786:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  80178b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80178e:	89 1a                	mov    %ebx,(%edx)
+}
+  801790:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801793:	c9                   	leave
+  801794:	c3                   	ret
+
+00801795 <fd_close>:
+{
+  801795:	55                   	push   %ebp
+  801796:	89 e5                	mov    %esp,%ebp
+  801798:	57                   	push   %edi
+  801799:	56                   	push   %esi
+  80179a:	53                   	push   %ebx
+  80179b:	83 ec 24             	sub    $0x24,%esp
+  80179e:	8b 75 08             	mov    0x8(%ebp),%esi
+  8017a1:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8017a4:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8017a7:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8017a8:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8017ae:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8017b1:	50                   	push   %eax
+  8017b2:	e8 42 ff ff ff       	call   8016f9 <fd_lookup>
+  8017b7:	89 c3                	mov    %eax,%ebx
+  8017b9:	83 c4 10             	add    $0x10,%esp
+  8017bc:	85 c0                	test   %eax,%eax
+  8017be:	78 05                	js     8017c5 <fd_close+0x30>
+      || fd != fd2)
+  8017c0:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8017c3:	74 16                	je     8017db <fd_close+0x46>
+    return must_exist ? r : 0;
+  8017c5:	89 f8                	mov    %edi,%eax
+  8017c7:	84 c0                	test   %al,%al
+  8017c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017ce:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8017d1:	89 d8                	mov    %ebx,%eax
+  8017d3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017d6:	5b                   	pop    %ebx
+  8017d7:	5e                   	pop    %esi
+  8017d8:	5f                   	pop    %edi
+  8017d9:	5d                   	pop    %ebp
+  8017da:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8017db:	83 ec 08             	sub    $0x8,%esp
+  8017de:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8017e1:	50                   	push   %eax
+  8017e2:	ff 36                	push   (%esi)
+  8017e4:	e8 60 ff ff ff       	call   801749 <dev_lookup>
+  8017e9:	89 c3                	mov    %eax,%ebx
+  8017eb:	83 c4 10             	add    $0x10,%esp
+  8017ee:	85 c0                	test   %eax,%eax
+  8017f0:	78 1a                	js     80180c <fd_close+0x77>
+    if (dev->dev_close)
+  8017f2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8017f5:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  8017f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  8017fd:	85 c0                	test   %eax,%eax
+  8017ff:	74 0b                	je     80180c <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  801801:	83 ec 0c             	sub    $0xc,%esp
+  801804:	56                   	push   %esi
+  801805:	ff d0                	call   *%eax
+  801807:	89 c3                	mov    %eax,%ebx
+  801809:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  80180c:	83 ec 08             	sub    $0x8,%esp
+  80180f:	56                   	push   %esi
+  801810:	6a 00                	push   $0x0
+  801812:	e8 0a f6 ff ff       	call   800e21 <sys_page_unmap>
+  return r;
+  801817:	83 c4 10             	add    $0x10,%esp
+  80181a:	eb b5                	jmp    8017d1 <fd_close+0x3c>
+
+0080181c <close>:
+
+int
+close(int fdnum)
+{
+  80181c:	55                   	push   %ebp
+  80181d:	89 e5                	mov    %esp,%ebp
+  80181f:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801822:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801825:	50                   	push   %eax
+  801826:	ff 75 08             	push   0x8(%ebp)
+  801829:	e8 cb fe ff ff       	call   8016f9 <fd_lookup>
+  80182e:	83 c4 10             	add    $0x10,%esp
+  801831:	85 c0                	test   %eax,%eax
+  801833:	79 02                	jns    801837 <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  801835:	c9                   	leave
+  801836:	c3                   	ret
+    return fd_close(fd, 1);
+  801837:	83 ec 08             	sub    $0x8,%esp
+  80183a:	6a 01                	push   $0x1
+  80183c:	ff 75 f4             	push   -0xc(%ebp)
+  80183f:	e8 51 ff ff ff       	call   801795 <fd_close>
+  801844:	83 c4 10             	add    $0x10,%esp
+  801847:	eb ec                	jmp    801835 <close+0x19>
+
+00801849 <close_all>:
+
+void
+close_all(void)
+{
+  801849:	55                   	push   %ebp
+  80184a:	89 e5                	mov    %esp,%ebp
+  80184c:	53                   	push   %ebx
+  80184d:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  801850:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  801855:	83 ec 0c             	sub    $0xc,%esp
+  801858:	53                   	push   %ebx
+  801859:	e8 be ff ff ff       	call   80181c <close>
+  for (i = 0; i < MAXFD; i++)
+  80185e:	83 c3 01             	add    $0x1,%ebx
+  801861:	83 c4 10             	add    $0x10,%esp
+  801864:	83 fb 20             	cmp    $0x20,%ebx
+  801867:	75 ec                	jne    801855 <close_all+0xc>
+}
+  801869:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80186c:	c9                   	leave
+  80186d:	c3                   	ret
+
+0080186e <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80186e:	55                   	push   %ebp
+  80186f:	89 e5                	mov    %esp,%ebp
+  801871:	57                   	push   %edi
+  801872:	56                   	push   %esi
+  801873:	53                   	push   %ebx
+  801874:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801877:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80187a:	50                   	push   %eax
+  80187b:	ff 75 08             	push   0x8(%ebp)
+  80187e:	e8 76 fe ff ff       	call   8016f9 <fd_lookup>
+  801883:	89 c6                	mov    %eax,%esi
+  801885:	83 c4 10             	add    $0x10,%esp
+  801888:	85 c0                	test   %eax,%eax
+  80188a:	0f 88 0a 01 00 00    	js     80199a <dup+0x12c>
+    return r;
+  close(newfdnum);
+  801890:	83 ec 0c             	sub    $0xc,%esp
+  801893:	ff 75 0c             	push   0xc(%ebp)
+  801896:	e8 81 ff ff ff       	call   80181c <close>
+
+  newfd = INDEX2FD(newfdnum);
+  80189b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80189e:	c1 e0 0c             	shl    $0xc,%eax
+  8018a1:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  8018a7:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  8018aa:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8018ad:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8018b0:	89 04 24             	mov    %eax,(%esp)
+  8018b3:	e8 d7 fd ff ff       	call   80168f <fd2data>
+  8018b8:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  8018ba:	89 3c 24             	mov    %edi,(%esp)
+  8018bd:	e8 cd fd ff ff       	call   80168f <fd2data>
+  8018c2:	83 c4 10             	add    $0x10,%esp
+  8018c5:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8018c8:	89 f3                	mov    %esi,%ebx
+  8018ca:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  8018d0:	89 c6                	mov    %eax,%esi
+  8018d2:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8018d5:	89 cf                	mov    %ecx,%edi
+  8018d7:	eb 0c                	jmp    8018e5 <dup+0x77>
+  8018d9:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8018df:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8018e5:	39 fb                	cmp    %edi,%ebx
+  8018e7:	74 7b                	je     801964 <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  8018e9:	89 d8                	mov    %ebx,%eax
+  8018eb:	c1 e8 16             	shr    $0x16,%eax
+  8018ee:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8018f5:	a8 01                	test   $0x1,%al
+  8018f7:	74 e0                	je     8018d9 <dup+0x6b>
+  8018f9:	89 d8                	mov    %ebx,%eax
+  8018fb:	c1 e8 0c             	shr    $0xc,%eax
+  8018fe:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801905:	f6 c2 01             	test   $0x1,%dl
+  801908:	74 cf                	je     8018d9 <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  80190a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  801911:	83 ec 0c             	sub    $0xc,%esp
+  801914:	25 07 0e 00 00       	and    $0xe07,%eax
+  801919:	50                   	push   %eax
+  80191a:	56                   	push   %esi
+  80191b:	6a 00                	push   $0x0
+  80191d:	53                   	push   %ebx
+  80191e:	6a 00                	push   $0x0
+  801920:	e8 ba f4 ff ff       	call   800ddf <sys_page_map>
+  801925:	83 c4 20             	add    $0x20,%esp
+  801928:	85 c0                	test   %eax,%eax
+  80192a:	79 ad                	jns    8018d9 <dup+0x6b>
+  80192c:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80192f:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  801931:	83 ec 08             	sub    $0x8,%esp
+  801934:	ff 75 d4             	push   -0x2c(%ebp)
+  801937:	6a 00                	push   $0x0
+  801939:	e8 e3 f4 ff ff       	call   800e21 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80193e:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  801941:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  801947:	83 c4 10             	add    $0x10,%esp
+  80194a:	39 df                	cmp    %ebx,%edi
+  80194c:	74 4c                	je     80199a <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  80194e:	83 ec 08             	sub    $0x8,%esp
+  801951:	57                   	push   %edi
+  801952:	6a 00                	push   $0x0
+  801954:	e8 c8 f4 ff ff       	call   800e21 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801959:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  80195f:	83 c4 10             	add    $0x10,%esp
+  801962:	eb e6                	jmp    80194a <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801964:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801967:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80196a:	89 c8                	mov    %ecx,%eax
+  80196c:	c1 e8 0c             	shr    $0xc,%eax
+  80196f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801976:	83 ec 0c             	sub    $0xc,%esp
+  801979:	25 07 0e 00 00       	and    $0xe07,%eax
+  80197e:	50                   	push   %eax
+  80197f:	ff 75 d4             	push   -0x2c(%ebp)
+  801982:	6a 00                	push   $0x0
+  801984:	51                   	push   %ecx
+  801985:	6a 00                	push   $0x0
+  801987:	e8 53 f4 ff ff       	call   800ddf <sys_page_map>
+  80198c:	89 c6                	mov    %eax,%esi
+  80198e:	83 c4 20             	add    $0x20,%esp
+  801991:	85 c0                	test   %eax,%eax
+  801993:	78 9c                	js     801931 <dup+0xc3>
+  return newfdnum;
+  801995:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801998:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  80199a:	89 f0                	mov    %esi,%eax
+  80199c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80199f:	5b                   	pop    %ebx
+  8019a0:	5e                   	pop    %esi
+  8019a1:	5f                   	pop    %edi
+  8019a2:	5d                   	pop    %ebp
+  8019a3:	c3                   	ret
+
+008019a4 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8019a4:	55                   	push   %ebp
+  8019a5:	89 e5                	mov    %esp,%ebp
+  8019a7:	56                   	push   %esi
+  8019a8:	53                   	push   %ebx
+  8019a9:	83 ec 18             	sub    $0x18,%esp
+  8019ac:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  8019af:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8019b2:	50                   	push   %eax
+  8019b3:	56                   	push   %esi
+  8019b4:	e8 40 fd ff ff       	call   8016f9 <fd_lookup>
+  8019b9:	83 c4 10             	add    $0x10,%esp
+  8019bc:	85 c0                	test   %eax,%eax
+  8019be:	78 3c                	js     8019fc <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8019c0:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8019c3:	83 ec 08             	sub    $0x8,%esp
+  8019c6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019c9:	50                   	push   %eax
+  8019ca:	ff 33                	push   (%ebx)
+  8019cc:	e8 78 fd ff ff       	call   801749 <dev_lookup>
+  8019d1:	83 c4 10             	add    $0x10,%esp
+  8019d4:	85 c0                	test   %eax,%eax
+  8019d6:	78 24                	js     8019fc <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8019d8:	8b 43 08             	mov    0x8(%ebx),%eax
+  8019db:	83 e0 03             	and    $0x3,%eax
+  8019de:	83 f8 01             	cmp    $0x1,%eax
+  8019e1:	74 20                	je     801a03 <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  8019e3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019e6:	8b 40 08             	mov    0x8(%eax),%eax
+  8019e9:	85 c0                	test   %eax,%eax
+  8019eb:	74 37                	je     801a24 <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  8019ed:	83 ec 04             	sub    $0x4,%esp
+  8019f0:	ff 75 10             	push   0x10(%ebp)
+  8019f3:	ff 75 0c             	push   0xc(%ebp)
+  8019f6:	53                   	push   %ebx
+  8019f7:	ff d0                	call   *%eax
+  8019f9:	83 c4 10             	add    $0x10,%esp
+}
+  8019fc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019ff:	5b                   	pop    %ebx
+  801a00:	5e                   	pop    %esi
+  801a01:	5d                   	pop    %ebp
+  801a02:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801a03:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  801a08:	8b 40 48             	mov    0x48(%eax),%eax
+  801a0b:	83 ec 04             	sub    $0x4,%esp
+  801a0e:	56                   	push   %esi
+  801a0f:	50                   	push   %eax
+  801a10:	68 1d 40 80 00       	push   $0x80401d
+  801a15:	e8 65 e9 ff ff       	call   80037f <cprintf>
+    return -E_INVAL;
+  801a1a:	83 c4 10             	add    $0x10,%esp
+  801a1d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a22:	eb d8                	jmp    8019fc <read+0x58>
+    return -E_NOT_SUPP;
+  801a24:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a29:	eb d1                	jmp    8019fc <read+0x58>
+
+00801a2b <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801a2b:	55                   	push   %ebp
+  801a2c:	89 e5                	mov    %esp,%ebp
+  801a2e:	57                   	push   %edi
+  801a2f:	56                   	push   %esi
+  801a30:	53                   	push   %ebx
+  801a31:	83 ec 0c             	sub    $0xc,%esp
+  801a34:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801a37:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  801a3a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a3f:	eb 02                	jmp    801a43 <readn+0x18>
+  801a41:	01 c3                	add    %eax,%ebx
+  801a43:	39 f3                	cmp    %esi,%ebx
+  801a45:	73 21                	jae    801a68 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  801a47:	83 ec 04             	sub    $0x4,%esp
+  801a4a:	89 f0                	mov    %esi,%eax
+  801a4c:	29 d8                	sub    %ebx,%eax
+  801a4e:	50                   	push   %eax
+  801a4f:	89 d8                	mov    %ebx,%eax
+  801a51:	03 45 0c             	add    0xc(%ebp),%eax
+  801a54:	50                   	push   %eax
+  801a55:	57                   	push   %edi
+  801a56:	e8 49 ff ff ff       	call   8019a4 <read>
+    if (m < 0)
+  801a5b:	83 c4 10             	add    $0x10,%esp
+  801a5e:	85 c0                	test   %eax,%eax
+  801a60:	78 04                	js     801a66 <readn+0x3b>
+      return m;
+    if (m == 0)
+  801a62:	75 dd                	jne    801a41 <readn+0x16>
+  801a64:	eb 02                	jmp    801a68 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  801a66:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  801a68:	89 d8                	mov    %ebx,%eax
+  801a6a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a6d:	5b                   	pop    %ebx
+  801a6e:	5e                   	pop    %esi
+  801a6f:	5f                   	pop    %edi
+  801a70:	5d                   	pop    %ebp
+  801a71:	c3                   	ret
+
+00801a72 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801a72:	55                   	push   %ebp
+  801a73:	89 e5                	mov    %esp,%ebp
+  801a75:	56                   	push   %esi
+  801a76:	53                   	push   %ebx
+  801a77:	83 ec 18             	sub    $0x18,%esp
+  801a7a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a7d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a80:	50                   	push   %eax
+  801a81:	53                   	push   %ebx
+  801a82:	e8 72 fc ff ff       	call   8016f9 <fd_lookup>
+  801a87:	83 c4 10             	add    $0x10,%esp
+  801a8a:	85 c0                	test   %eax,%eax
+  801a8c:	78 37                	js     801ac5 <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801a8e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801a91:	83 ec 08             	sub    $0x8,%esp
+  801a94:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a97:	50                   	push   %eax
+  801a98:	ff 36                	push   (%esi)
+  801a9a:	e8 aa fc ff ff       	call   801749 <dev_lookup>
+  801a9f:	83 c4 10             	add    $0x10,%esp
+  801aa2:	85 c0                	test   %eax,%eax
+  801aa4:	78 1f                	js     801ac5 <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801aa6:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801aaa:	74 20                	je     801acc <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  801aac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801aaf:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ab2:	85 c0                	test   %eax,%eax
+  801ab4:	74 37                	je     801aed <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  801ab6:	83 ec 04             	sub    $0x4,%esp
+  801ab9:	ff 75 10             	push   0x10(%ebp)
+  801abc:	ff 75 0c             	push   0xc(%ebp)
+  801abf:	56                   	push   %esi
+  801ac0:	ff d0                	call   *%eax
+  801ac2:	83 c4 10             	add    $0x10,%esp
+}
+  801ac5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ac8:	5b                   	pop    %ebx
+  801ac9:	5e                   	pop    %esi
+  801aca:	5d                   	pop    %ebp
+  801acb:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801acc:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  801ad1:	8b 40 48             	mov    0x48(%eax),%eax
+  801ad4:	83 ec 04             	sub    $0x4,%esp
+  801ad7:	53                   	push   %ebx
+  801ad8:	50                   	push   %eax
+  801ad9:	68 39 40 80 00       	push   $0x804039
+  801ade:	e8 9c e8 ff ff       	call   80037f <cprintf>
+    return -E_INVAL;
+  801ae3:	83 c4 10             	add    $0x10,%esp
+  801ae6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801aeb:	eb d8                	jmp    801ac5 <write+0x53>
+    return -E_NOT_SUPP;
+  801aed:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801af2:	eb d1                	jmp    801ac5 <write+0x53>
+
+00801af4 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801af4:	55                   	push   %ebp
+  801af5:	89 e5                	mov    %esp,%ebp
+  801af7:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801afa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801afd:	50                   	push   %eax
+  801afe:	ff 75 08             	push   0x8(%ebp)
+  801b01:	e8 f3 fb ff ff       	call   8016f9 <fd_lookup>
+  801b06:	83 c4 10             	add    $0x10,%esp
+  801b09:	85 c0                	test   %eax,%eax
+  801b0b:	78 0e                	js     801b1b <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  801b0d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801b10:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b13:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  801b16:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b1b:	c9                   	leave
+  801b1c:	c3                   	ret
+
+00801b1d <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801b1d:	55                   	push   %ebp
+  801b1e:	89 e5                	mov    %esp,%ebp
+  801b20:	56                   	push   %esi
+  801b21:	53                   	push   %ebx
+  801b22:	83 ec 18             	sub    $0x18,%esp
+  801b25:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801b28:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b2b:	50                   	push   %eax
+  801b2c:	53                   	push   %ebx
+  801b2d:	e8 c7 fb ff ff       	call   8016f9 <fd_lookup>
+  801b32:	83 c4 10             	add    $0x10,%esp
+  801b35:	85 c0                	test   %eax,%eax
+  801b37:	78 34                	js     801b6d <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801b39:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b3c:	83 ec 08             	sub    $0x8,%esp
+  801b3f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b42:	50                   	push   %eax
+  801b43:	ff 36                	push   (%esi)
+  801b45:	e8 ff fb ff ff       	call   801749 <dev_lookup>
+  801b4a:	83 c4 10             	add    $0x10,%esp
+  801b4d:	85 c0                	test   %eax,%eax
+  801b4f:	78 1c                	js     801b6d <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801b51:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801b55:	74 1d                	je     801b74 <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  801b57:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b5a:	8b 40 18             	mov    0x18(%eax),%eax
+  801b5d:	85 c0                	test   %eax,%eax
+  801b5f:	74 34                	je     801b95 <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  801b61:	83 ec 08             	sub    $0x8,%esp
+  801b64:	ff 75 0c             	push   0xc(%ebp)
+  801b67:	56                   	push   %esi
+  801b68:	ff d0                	call   *%eax
+  801b6a:	83 c4 10             	add    $0x10,%esp
+}
+  801b6d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b70:	5b                   	pop    %ebx
+  801b71:	5e                   	pop    %esi
+  801b72:	5d                   	pop    %ebp
+  801b73:	c3                   	ret
+            thisenv->env_id, fdnum);
+  801b74:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  801b79:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801b7c:	83 ec 04             	sub    $0x4,%esp
+  801b7f:	53                   	push   %ebx
+  801b80:	50                   	push   %eax
+  801b81:	68 fc 3f 80 00       	push   $0x803ffc
+  801b86:	e8 f4 e7 ff ff       	call   80037f <cprintf>
+    return -E_INVAL;
+  801b8b:	83 c4 10             	add    $0x10,%esp
+  801b8e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b93:	eb d8                	jmp    801b6d <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  801b95:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b9a:	eb d1                	jmp    801b6d <ftruncate+0x50>
+
+00801b9c <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801b9c:	55                   	push   %ebp
+  801b9d:	89 e5                	mov    %esp,%ebp
+  801b9f:	56                   	push   %esi
+  801ba0:	53                   	push   %ebx
+  801ba1:	83 ec 18             	sub    $0x18,%esp
+  801ba4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801ba7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801baa:	50                   	push   %eax
+  801bab:	ff 75 08             	push   0x8(%ebp)
+  801bae:	e8 46 fb ff ff       	call   8016f9 <fd_lookup>
+  801bb3:	83 c4 10             	add    $0x10,%esp
+  801bb6:	85 c0                	test   %eax,%eax
+  801bb8:	78 49                	js     801c03 <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801bba:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801bbd:	83 ec 08             	sub    $0x8,%esp
+  801bc0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bc3:	50                   	push   %eax
+  801bc4:	ff 36                	push   (%esi)
+  801bc6:	e8 7e fb ff ff       	call   801749 <dev_lookup>
+  801bcb:	83 c4 10             	add    $0x10,%esp
+  801bce:	85 c0                	test   %eax,%eax
+  801bd0:	78 31                	js     801c03 <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  801bd2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bd5:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801bd9:	74 2f                	je     801c0a <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  801bdb:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  801bde:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801be5:	00 00 00 
+  stat->st_isdir = 0;
+  801be8:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801bef:	00 00 00 
+  stat->st_dev = dev;
+  801bf2:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  801bf8:	83 ec 08             	sub    $0x8,%esp
+  801bfb:	53                   	push   %ebx
+  801bfc:	56                   	push   %esi
+  801bfd:	ff 50 14             	call   *0x14(%eax)
+  801c00:	83 c4 10             	add    $0x10,%esp
+}
+  801c03:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c06:	5b                   	pop    %ebx
+  801c07:	5e                   	pop    %esi
+  801c08:	5d                   	pop    %ebp
+  801c09:	c3                   	ret
+    return -E_NOT_SUPP;
+  801c0a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c0f:	eb f2                	jmp    801c03 <fstat+0x67>
+
+00801c11 <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  801c11:	55                   	push   %ebp
+  801c12:	89 e5                	mov    %esp,%ebp
+  801c14:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  801c17:	ff 75 0c             	push   0xc(%ebp)
+  801c1a:	ff 75 08             	push   0x8(%ebp)
+  801c1d:	e8 58 07 00 00       	call   80237a <file_stat>
+}
+  801c22:	c9                   	leave
+  801c23:	c3                   	ret
+
+00801c24 <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  801c24:	55                   	push   %ebp
+  801c25:	89 e5                	mov    %esp,%ebp
+  801c27:	57                   	push   %edi
+  801c28:	56                   	push   %esi
+  801c29:	53                   	push   %ebx
+  801c2a:	83 ec 1c             	sub    $0x1c,%esp
+  801c2d:	89 c7                	mov    %eax,%edi
+  801c2f:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801c32:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801c35:	e9 a2 00 00 00       	jmp    801cdc <fsipc_send+0xb8>
+  nfsenvs = 0;
+  801c3a:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  801c41:	00 00 00 
+  801c44:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c49:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801c4e:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801c53:	be 01 00 00 00       	mov    $0x1,%esi
+  801c58:	eb 0f                	jmp    801c69 <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801c5a:	83 c0 01             	add    $0x1,%eax
+  801c5d:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801c62:	74 49                	je     801cad <fsipc_send+0x89>
+  801c64:	83 f9 07             	cmp    $0x7,%ecx
+  801c67:	7f 50                	jg     801cb9 <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  801c69:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801c6c:	c1 e2 04             	shl    $0x4,%edx
+  801c6f:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801c75:	8b 52 50             	mov    0x50(%edx),%edx
+  801c78:	83 fa 01             	cmp    $0x1,%edx
+  801c7b:	75 dd                	jne    801c5a <fsipc_send+0x36>
+  801c7d:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801c80:	c1 e2 04             	shl    $0x4,%edx
+  801c83:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801c89:	8b 52 54             	mov    0x54(%edx),%edx
+  801c8c:	85 d2                	test   %edx,%edx
+  801c8e:	74 ca                	je     801c5a <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801c90:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801c93:	c1 e2 04             	shl    $0x4,%edx
+  801c96:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801c9c:	8b 52 48             	mov    0x48(%edx),%edx
+  801c9f:	89 14 8d 20 60 80 00 	mov    %edx,0x806020(,%ecx,4)
+  801ca6:	8d 49 01             	lea    0x1(%ecx),%ecx
+  801ca9:	89 f3                	mov    %esi,%ebx
+  801cab:	eb ad                	jmp    801c5a <fsipc_send+0x36>
+  801cad:	84 db                	test   %bl,%bl
+  801caf:	74 38                	je     801ce9 <fsipc_send+0xc5>
+  801cb1:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+  801cb7:	eb 30                	jmp    801ce9 <fsipc_send+0xc5>
+  801cb9:	84 db                	test   %bl,%bl
+  801cbb:	74 2c                	je     801ce9 <fsipc_send+0xc5>
+  801cbd:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+  801cc3:	eb 24                	jmp    801ce9 <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  801cc5:	50                   	push   %eax
+  801cc6:	68 68 40 80 00       	push   $0x804068
+  801ccb:	6a 34                	push   $0x34
+  801ccd:	68 72 40 80 00       	push   $0x804072
+  801cd2:	e8 cd e5 ff ff       	call   8002a4 <_panic>
+    }
+    sys_yield();
+  801cd7:	e8 5e f0 ff ff       	call   800d3a <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  801cdc:	83 3d 00 60 80 00 03 	cmpl   $0x3,0x806000
+  801ce3:	0f 8e 51 ff ff ff    	jle    801c3a <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  801ce9:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  801cee:	8b 70 48             	mov    0x48(%eax),%esi
+  801cf1:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  801cf7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cfc:	8b 0d 00 60 80 00    	mov    0x806000,%ecx
+  801d02:	39 d9                	cmp    %ebx,%ecx
+  801d04:	7e d1                	jle    801cd7 <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  801d06:	83 ec 0c             	sub    $0xc,%esp
+  801d09:	ff 75 e0             	push   -0x20(%ebp)
+  801d0c:	6a 07                	push   $0x7
+  801d0e:	ff 75 e4             	push   -0x1c(%ebp)
+  801d11:	57                   	push   %edi
+  801d12:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  801d15:	99                   	cltd
+  801d16:	f7 f9                	idiv   %ecx
+  801d18:	ff 34 95 20 60 80 00 	push   0x806020(,%edx,4)
+  801d1f:	e8 2f f3 ff ff       	call   801053 <sys_ipc_try_send>
+      if (r == 0)
+  801d24:	83 c4 20             	add    $0x20,%esp
+  801d27:	85 c0                	test   %eax,%eax
+  801d29:	74 0a                	je     801d35 <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  801d2b:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801d2e:	75 95                	jne    801cc5 <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  801d30:	83 c3 01             	add    $0x1,%ebx
+  801d33:	eb c7                	jmp    801cfc <fsipc_send+0xd8>
+  }
+}
+  801d35:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d38:	5b                   	pop    %ebx
+  801d39:	5e                   	pop    %esi
+  801d3a:	5f                   	pop    %edi
+  801d3b:	5d                   	pop    %ebp
+  801d3c:	c3                   	ret
+
+00801d3d <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801d3d:	55                   	push   %ebp
+  801d3e:	89 e5                	mov    %esp,%ebp
+  801d40:	53                   	push   %ebx
+  801d41:	83 ec 14             	sub    $0x14,%esp
+  801d44:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  801d46:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  801d4d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801d52:	ba 00 70 80 00       	mov    $0x807000,%edx
+  801d57:	e8 c8 fe ff ff       	call   801c24 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801d5c:	6a 00                	push   $0x0
+  801d5e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d61:	50                   	push   %eax
+  801d62:	53                   	push   %ebx
+  801d63:	6a 00                	push   $0x0
+  801d65:	e8 a7 19 00 00       	call   803711 <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  801d6a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d6d:	c9                   	leave
+  801d6e:	c3                   	ret
+
+00801d6f <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801d6f:	55                   	push   %ebp
+  801d70:	89 e5                	mov    %esp,%ebp
+  801d72:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801d75:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d78:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d7b:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.set_size.req_size = newsize;
+  801d80:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d83:	a3 04 70 80 00       	mov    %eax,0x807004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801d88:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d8d:	b8 02 00 00 00       	mov    $0x2,%eax
+  801d92:	e8 a6 ff ff ff       	call   801d3d <fsipc>
+}
+  801d97:	c9                   	leave
+  801d98:	c3                   	ret
+
+00801d99 <devfile_flush>:
+{
+  801d99:	55                   	push   %ebp
+  801d9a:	89 e5                	mov    %esp,%ebp
+  801d9c:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801d9f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801da2:	8b 40 0c             	mov    0xc(%eax),%eax
+  801da5:	a3 00 70 80 00       	mov    %eax,0x807000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801daa:	ba 00 00 00 00       	mov    $0x0,%edx
+  801daf:	b8 06 00 00 00       	mov    $0x6,%eax
+  801db4:	e8 84 ff ff ff       	call   801d3d <fsipc>
+}
+  801db9:	c9                   	leave
+  801dba:	c3                   	ret
+
+00801dbb <devfile_stat>:
+{
+  801dbb:	55                   	push   %ebp
+  801dbc:	89 e5                	mov    %esp,%ebp
+  801dbe:	53                   	push   %ebx
+  801dbf:	83 ec 04             	sub    $0x4,%esp
+  801dc2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801dc5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dc8:	8b 40 0c             	mov    0xc(%eax),%eax
+  801dcb:	a3 00 70 80 00       	mov    %eax,0x807000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801dd0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dd5:	b8 05 00 00 00       	mov    $0x5,%eax
+  801dda:	e8 5e ff ff ff       	call   801d3d <fsipc>
+  801ddf:	85 c0                	test   %eax,%eax
+  801de1:	78 2c                	js     801e0f <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801de3:	83 ec 08             	sub    $0x8,%esp
+  801de6:	68 00 70 80 00       	push   $0x807000
+  801deb:	53                   	push   %ebx
+  801dec:	e8 7c eb ff ff       	call   80096d <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  801df1:	a1 80 70 80 00       	mov    0x807080,%eax
+  801df6:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801dfc:	a1 84 70 80 00       	mov    0x807084,%eax
+  801e01:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801e07:	83 c4 10             	add    $0x10,%esp
+  801e0a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e0f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e12:	c9                   	leave
+  801e13:	c3                   	ret
+
+00801e14 <fsv_alloc>:
+{
+  801e14:	55                   	push   %ebp
+  801e15:	89 e5                	mov    %esp,%ebp
+  801e17:	56                   	push   %esi
+  801e18:	53                   	push   %ebx
+  801e19:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  801e1b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e20:	eb 22                	jmp    801e44 <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  801e22:	83 ec 04             	sub    $0x4,%esp
+  801e25:	6a 00                	push   $0x0
+  801e27:	6a 00                	push   $0x0
+  801e29:	6a 07                	push   $0x7
+  801e2b:	50                   	push   %eax
+  801e2c:	6a 00                	push   $0x0
+  801e2e:	6a 04                	push   $0x4
+  801e30:	68 40 60 80 00       	push   $0x806040
+  801e35:	e8 b5 f3 ff ff       	call   8011ef <sysbatch_add>
+  801e3a:	83 c4 20             	add    $0x20,%esp
+  801e3d:	85 c0                	test   %eax,%eax
+  801e3f:	78 48                	js     801e89 <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  801e41:	83 c3 01             	add    $0x1,%ebx
+  801e44:	39 f3                	cmp    %esi,%ebx
+  801e46:	74 31                	je     801e79 <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  801e48:	89 d8                	mov    %ebx,%eax
+  801e4a:	c1 e0 0c             	shl    $0xc,%eax
+  801e4d:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801e52:	89 c2                	mov    %eax,%edx
+  801e54:	c1 ea 16             	shr    $0x16,%edx
+  801e57:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801e5e:	f6 c2 01             	test   $0x1,%dl
+  801e61:	74 bf                	je     801e22 <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  801e63:	89 c2                	mov    %eax,%edx
+  801e65:	c1 ea 0c             	shr    $0xc,%edx
+  801e68:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801e6f:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801e72:	83 fa 03             	cmp    $0x3,%edx
+  801e75:	75 ab                	jne    801e22 <fsv_alloc+0xe>
+  801e77:	eb c8                	jmp    801e41 <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  801e79:	83 ec 0c             	sub    $0xc,%esp
+  801e7c:	68 40 60 80 00       	push   $0x806040
+  801e81:	e8 19 f3 ff ff       	call   80119f <sysbatch_flush>
+  801e86:	83 c4 10             	add    $0x10,%esp
+}
+  801e89:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e8c:	5b                   	pop    %ebx
+  801e8d:	5e                   	pop    %esi
+  801e8e:	5d                   	pop    %ebp
+  801e8f:	c3                   	ret
+
+00801e90 <devfile_read>:
+{
+  801e90:	55                   	push   %ebp
+  801e91:	89 e5                	mov    %esp,%ebp
+  801e93:	57                   	push   %edi
+  801e94:	56                   	push   %esi
+  801e95:	53                   	push   %ebx
+  801e96:	83 ec 3c             	sub    $0x3c,%esp
+  801e99:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  801e9c:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  801ea2:	77 57                	ja     801efb <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801ea4:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ea7:	8b 40 0c             	mov    0xc(%eax),%eax
+  801eaa:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.read.req_n = n;
+  801eaf:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801eb5:	ba 00 00 00 00       	mov    $0x0,%edx
+  801eba:	b8 03 00 00 00       	mov    $0x3,%eax
+  801ebf:	e8 79 fe ff ff       	call   801d3d <fsipc>
+  801ec4:	89 c6                	mov    %eax,%esi
+  801ec6:	85 c0                	test   %eax,%eax
+  801ec8:	78 27                	js     801ef1 <devfile_read+0x61>
+  assert(r <= n);
+  801eca:	39 c3                	cmp    %eax,%ebx
+  801ecc:	0f 82 0e 02 00 00    	jb     8020e0 <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  801ed2:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801ed7:	0f 8f 1c 02 00 00    	jg     8020f9 <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801edd:	83 ec 04             	sub    $0x4,%esp
+  801ee0:	50                   	push   %eax
+  801ee1:	68 00 70 80 00       	push   $0x807000
+  801ee6:	ff 75 0c             	push   0xc(%ebp)
+  801ee9:	e8 05 ec ff ff       	call   800af3 <memmove>
+  return r;
+  801eee:	83 c4 10             	add    $0x10,%esp
+}
+  801ef1:	89 f0                	mov    %esi,%eax
+  801ef3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ef6:	5b                   	pop    %ebx
+  801ef7:	5e                   	pop    %esi
+  801ef8:	5f                   	pop    %edi
+  801ef9:	5d                   	pop    %ebp
+  801efa:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  801efb:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f00:	e8 0f ff ff ff       	call   801e14 <fsv_alloc>
+  801f05:	89 c6                	mov    %eax,%esi
+  801f07:	85 c0                	test   %eax,%eax
+  801f09:	78 e6                	js     801ef1 <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  801f0b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f0e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f11:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  801f16:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f19:	8b 40 04             	mov    0x4(%eax),%eax
+  801f1c:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  801f21:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  801f27:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801f2e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801f33:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801f38:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801f3d:	e8 e2 fc ff ff       	call   801c24 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801f42:	6a 00                	push   $0x0
+  801f44:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801f47:	50                   	push   %eax
+  801f48:	68 00 10 c0 9f       	push   $0x9fc01000
+  801f4d:	6a 00                	push   $0x0
+  801f4f:	e8 bd 17 00 00       	call   803711 <ipc_recv_pages>
+  801f54:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  801f56:	83 c4 10             	add    $0x10,%esp
+  801f59:	85 c0                	test   %eax,%eax
+  801f5b:	7e 94                	jle    801ef1 <devfile_read+0x61>
+  assert(r <= n);
+  801f5d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801f60:	39 c3                	cmp    %eax,%ebx
+  801f62:	72 2e                	jb     801f92 <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801f64:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f67:	8b 40 04             	mov    0x4(%eax),%eax
+  801f6a:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801f6f:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  801f72:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801f75:	c1 e2 0c             	shl    $0xc,%edx
+  801f78:	39 ca                	cmp    %ecx,%edx
+  801f7a:	72 2f                	jb     801fab <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  801f7c:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  801f81:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  801f84:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  801f88:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801f8d:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  801f90:	eb 52                	jmp    801fe4 <devfile_read+0x154>
+  assert(r <= n);
+  801f92:	68 7d 40 80 00       	push   $0x80407d
+  801f97:	68 84 40 80 00       	push   $0x804084
+  801f9c:	68 49 01 00 00       	push   $0x149
+  801fa1:	68 72 40 80 00       	push   $0x804072
+  801fa6:	e8 f9 e2 ff ff       	call   8002a4 <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801fab:	68 a8 40 80 00       	push   $0x8040a8
+  801fb0:	68 84 40 80 00       	push   $0x804084
+  801fb5:	68 4a 01 00 00       	push   $0x14a
+  801fba:	68 72 40 80 00       	push   $0x804072
+  801fbf:	e8 e0 e2 ff ff       	call   8002a4 <_panic>
+      memmove(dst + done, src + done, m);
+  801fc4:	83 ec 04             	sub    $0x4,%esp
+  801fc7:	53                   	push   %ebx
+  801fc8:	56                   	push   %esi
+  801fc9:	89 f8                	mov    %edi,%eax
+  801fcb:	03 45 0c             	add    0xc(%ebp),%eax
+  801fce:	50                   	push   %eax
+  801fcf:	e8 1f eb ff ff       	call   800af3 <memmove>
+  801fd4:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  801fd7:	01 df                	add    %ebx,%edi
+  801fd9:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801fdc:	39 c7                	cmp    %eax,%edi
+  801fde:	0f 83 c0 00 00 00    	jae    8020a4 <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801fe4:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801fe7:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  801fea:	89 f0                	mov    %esi,%eax
+  801fec:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801ff1:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  801ff6:	29 c3                	sub    %eax,%ebx
+  801ff8:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801ffb:	29 f8                	sub    %edi,%eax
+  801ffd:	39 c3                	cmp    %eax,%ebx
+  801fff:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  802002:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  802008:	75 ba                	jne    801fc4 <devfile_read+0x134>
+  80200a:	89 f9                	mov    %edi,%ecx
+  80200c:	03 4d 0c             	add    0xc(%ebp),%ecx
+  80200f:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  802012:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  802018:	75 aa                	jne    801fc4 <devfile_read+0x134>
+  80201a:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  802020:	77 a2                	ja     801fc4 <devfile_read+0x134>
+  802022:	89 c8                	mov    %ecx,%eax
+  802024:	c1 e8 16             	shr    $0x16,%eax
+  802027:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80202e:	a8 01                	test   $0x1,%al
+  802030:	74 92                	je     801fc4 <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  802032:	89 c8                	mov    %ecx,%eax
+  802034:	c1 e8 0c             	shr    $0xc,%eax
+  802037:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  80203e:	a8 01                	test   $0x1,%al
+  802040:	74 82                	je     801fc4 <devfile_read+0x134>
+  802042:	a9 02 08 00 00       	test   $0x802,%eax
+  802047:	0f 84 77 ff ff ff    	je     801fc4 <devfile_read+0x134>
+  80204d:	f6 c4 04             	test   $0x4,%ah
+  802050:	0f 85 6e ff ff ff    	jne    801fc4 <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  802056:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  80205b:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  80205f:	84 c0                	test   %al,%al
+  802061:	75 17                	jne    80207a <devfile_read+0x1ea>
+  802063:	83 ec 08             	sub    $0x8,%esp
+  802066:	6a 01                	push   $0x1
+  802068:	6a 00                	push   $0x0
+  80206a:	e8 ea ec ff ff       	call   800d59 <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  80206f:	83 c4 10             	add    $0x10,%esp
+  802072:	85 c0                	test   %eax,%eax
+  802074:	0f 85 4a ff ff ff    	jne    801fc4 <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  80207a:	83 ec 04             	sub    $0x4,%esp
+  80207d:	68 05 08 00 00       	push   $0x805
+  802082:	ff 75 cc             	push   -0x34(%ebp)
+  802085:	6a 00                	push   $0x0
+  802087:	56                   	push   %esi
+  802088:	6a 00                	push   $0x0
+  80208a:	6a 05                	push   $0x5
+  80208c:	68 40 60 80 00       	push   $0x806040
+  802091:	e8 59 f1 ff ff       	call   8011ef <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  802096:	c1 e8 1f             	shr    $0x1f,%eax
+  802099:	08 45 cb             	or     %al,-0x35(%ebp)
+  80209c:	83 c4 20             	add    $0x20,%esp
+  80209f:	e9 33 ff ff ff       	jmp    801fd7 <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  8020a4:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  8020a7:	83 ec 0c             	sub    $0xc,%esp
+  8020aa:	68 40 60 80 00       	push   $0x806040
+  8020af:	e8 eb f0 ff ff       	call   80119f <sysbatch_flush>
+  8020b4:	83 c4 10             	add    $0x10,%esp
+  8020b7:	85 c0                	test   %eax,%eax
+  8020b9:	78 06                	js     8020c1 <devfile_read+0x231>
+  8020bb:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  8020bf:	74 14                	je     8020d5 <devfile_read+0x245>
+    memmove(dst, src, r);
+  8020c1:	83 ec 04             	sub    $0x4,%esp
+  8020c4:	ff 75 d4             	push   -0x2c(%ebp)
+  8020c7:	ff 75 d0             	push   -0x30(%ebp)
+  8020ca:	ff 75 0c             	push   0xc(%ebp)
+  8020cd:	e8 21 ea ff ff       	call   800af3 <memmove>
+  8020d2:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  8020d5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020d8:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  8020db:	e9 11 fe ff ff       	jmp    801ef1 <devfile_read+0x61>
+  assert(r <= n);
+  8020e0:	68 7d 40 80 00       	push   $0x80407d
+  8020e5:	68 84 40 80 00       	push   $0x804084
+  8020ea:	68 1c 01 00 00       	push   $0x11c
+  8020ef:	68 72 40 80 00       	push   $0x804072
+  8020f4:	e8 ab e1 ff ff       	call   8002a4 <_panic>
+  assert(r <= PGSIZE);
+  8020f9:	68 99 40 80 00       	push   $0x804099
+  8020fe:	68 84 40 80 00       	push   $0x804084
+  802103:	68 1d 01 00 00       	push   $0x11d
+  802108:	68 72 40 80 00       	push   $0x804072
+  80210d:	e8 92 e1 ff ff       	call   8002a4 <_panic>
+
+00802112 <devfile_write>:
+{
+  802112:	55                   	push   %ebp
+  802113:	89 e5                	mov    %esp,%ebp
+  802115:	57                   	push   %edi
+  802116:	56                   	push   %esi
+  802117:	53                   	push   %ebx
+  802118:	83 ec 1c             	sub    $0x1c,%esp
+  80211b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80211e:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  802121:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  802126:	77 39                	ja     802161 <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802128:	8b 56 0c             	mov    0xc(%esi),%edx
+  80212b:	89 15 00 70 80 00    	mov    %edx,0x807000
+  fsipcbuf.write.req_n = n;
+  802131:	a3 04 70 80 00       	mov    %eax,0x807004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  802136:	83 ec 04             	sub    $0x4,%esp
+  802139:	50                   	push   %eax
+  80213a:	ff 75 0c             	push   0xc(%ebp)
+  80213d:	68 08 70 80 00       	push   $0x807008
+  802142:	e8 ac e9 ff ff       	call   800af3 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  802147:	ba 00 00 00 00       	mov    $0x0,%edx
+  80214c:	b8 04 00 00 00       	mov    $0x4,%eax
+  802151:	e8 e7 fb ff ff       	call   801d3d <fsipc>
+  802156:	83 c4 10             	add    $0x10,%esp
+}
+  802159:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80215c:	5b                   	pop    %ebx
+  80215d:	5e                   	pop    %esi
+  80215e:	5f                   	pop    %edi
+  80215f:	5d                   	pop    %ebp
+  802160:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  802161:	ba 00 00 10 00       	mov    $0x100000,%edx
+  802166:	39 d0                	cmp    %edx,%eax
+  802168:	89 d3                	mov    %edx,%ebx
+  80216a:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  80216d:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  802173:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  802176:	83 c7 01             	add    $0x1,%edi
+  802179:	89 f8                	mov    %edi,%eax
+  80217b:	e8 94 fc ff ff       	call   801e14 <fsv_alloc>
+  802180:	85 c0                	test   %eax,%eax
+  802182:	78 d5                	js     802159 <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  802184:	83 ec 04             	sub    $0x4,%esp
+  802187:	53                   	push   %ebx
+  802188:	ff 75 0c             	push   0xc(%ebp)
+  80218b:	68 00 10 c0 9f       	push   $0x9fc01000
+  802190:	e8 5e e9 ff ff       	call   800af3 <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  802195:	8b 46 0c             	mov    0xc(%esi),%eax
+  802198:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  80219d:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  8021a3:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  8021aa:	89 f9                	mov    %edi,%ecx
+  8021ac:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  8021b1:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8021b6:	e8 69 fa ff ff       	call   801c24 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  8021bb:	6a 00                	push   $0x0
+  8021bd:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8021c0:	50                   	push   %eax
+  8021c1:	6a 00                	push   $0x0
+  8021c3:	6a 00                	push   $0x0
+  8021c5:	e8 47 15 00 00       	call   803711 <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  8021ca:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  8021cd:	eb 8a                	jmp    802159 <devfile_write+0x47>
+
+008021cf <open>:
+{
+  8021cf:	55                   	push   %ebp
+  8021d0:	89 e5                	mov    %esp,%ebp
+  8021d2:	56                   	push   %esi
+  8021d3:	53                   	push   %ebx
+  8021d4:	83 ec 1c             	sub    $0x1c,%esp
+  8021d7:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  8021da:	56                   	push   %esi
+  8021db:	e8 52 e7 ff ff       	call   800932 <strlen>
+  8021e0:	83 c4 10             	add    $0x10,%esp
+  8021e3:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8021e8:	7f 6c                	jg     802256 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  8021ea:	83 ec 0c             	sub    $0xc,%esp
+  8021ed:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8021f0:	50                   	push   %eax
+  8021f1:	e8 ad f4 ff ff       	call   8016a3 <fd_alloc>
+  8021f6:	89 c3                	mov    %eax,%ebx
+  8021f8:	83 c4 10             	add    $0x10,%esp
+  8021fb:	85 c0                	test   %eax,%eax
+  8021fd:	78 3c                	js     80223b <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  8021ff:	83 ec 08             	sub    $0x8,%esp
+  802202:	56                   	push   %esi
+  802203:	68 00 70 80 00       	push   $0x807000
+  802208:	e8 60 e7 ff ff       	call   80096d <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  80220d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802210:	a3 00 74 80 00       	mov    %eax,0x807400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802215:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802218:	b8 01 00 00 00       	mov    $0x1,%eax
+  80221d:	e8 1b fb ff ff       	call   801d3d <fsipc>
+  802222:	89 c3                	mov    %eax,%ebx
+  802224:	83 c4 10             	add    $0x10,%esp
+  802227:	85 c0                	test   %eax,%eax
+  802229:	78 19                	js     802244 <open+0x75>
+  return fd2num(fd);
+  80222b:	83 ec 0c             	sub    $0xc,%esp
+  80222e:	ff 75 f4             	push   -0xc(%ebp)
+  802231:	e8 49 f4 ff ff       	call   80167f <fd2num>
+  802236:	89 c3                	mov    %eax,%ebx
+  802238:	83 c4 10             	add    $0x10,%esp
+}
+  80223b:	89 d8                	mov    %ebx,%eax
+  80223d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802240:	5b                   	pop    %ebx
+  802241:	5e                   	pop    %esi
+  802242:	5d                   	pop    %ebp
+  802243:	c3                   	ret
+    fd_close(fd, 0);
+  802244:	83 ec 08             	sub    $0x8,%esp
+  802247:	6a 00                	push   $0x0
+  802249:	ff 75 f4             	push   -0xc(%ebp)
+  80224c:	e8 44 f5 ff ff       	call   801795 <fd_close>
+    return r;
+  802251:	83 c4 10             	add    $0x10,%esp
+  802254:	eb e5                	jmp    80223b <open+0x6c>
+    return -E_BAD_PATH;
+  802256:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80225b:	eb de                	jmp    80223b <open+0x6c>
+
+0080225d <open_read>:
+{
+  80225d:	55                   	push   %ebp
+  80225e:	89 e5                	mov    %esp,%ebp
+  802260:	57                   	push   %edi
+  802261:	56                   	push   %esi
+  802262:	53                   	push   %ebx
+  802263:	83 ec 28             	sub    $0x28,%esp
+  802266:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  802269:	57                   	push   %edi
+  80226a:	e8 c3 e6 ff ff       	call   800932 <strlen>
+  80226f:	83 c4 10             	add    $0x10,%esp
+  802272:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802277:	0f 87 f6 00 00 00    	ja     802373 <open_read+0x116>
+  80227d:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  80227f:	83 ec 0c             	sub    $0xc,%esp
+  802282:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802285:	50                   	push   %eax
+  802286:	e8 18 f4 ff ff       	call   8016a3 <fd_alloc>
+  80228b:	89 c3                	mov    %eax,%ebx
+  80228d:	83 c4 10             	add    $0x10,%esp
+  802290:	85 c0                	test   %eax,%eax
+  802292:	0f 88 b2 00 00 00    	js     80234a <open_read+0xed>
+  strcpy(req->req_buf, path);
+  802298:	83 ec 08             	sub    $0x8,%esp
+  80229b:	57                   	push   %edi
+  80229c:	68 e4 70 80 00       	push   $0x8070e4
+  8022a1:	e8 c7 e6 ff ff       	call   80096d <strcpy>
+  req->req_nops = 2;
+  8022a6:	c7 05 00 70 80 00 02 	movl   $0x2,0x807000
+  8022ad:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  8022b0:	c7 05 04 70 80 00 01 	movl   $0x1,0x807004
+  8022b7:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  8022ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022bd:	a3 10 70 80 00       	mov    %eax,0x807010
+  req->req_ops[0].op_buf = 0;
+  8022c2:	c7 05 18 70 80 00 00 	movl   $0x0,0x807018
+  8022c9:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  8022cc:	c7 05 20 70 80 00 04 	movl   $0x4,0x807020
+  8022d3:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  8022d6:	c7 05 24 70 80 00 01 	movl   $0x1,0x807024
+  8022dd:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  8022e0:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  8022e5:	29 f0                	sub    %esi,%eax
+  8022e7:	3b 45 14             	cmp    0x14(%ebp),%eax
+  8022ea:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  8022ee:	a3 2c 70 80 00       	mov    %eax,0x80702c
+  req->req_ops[1].op_offset = 0;
+  8022f3:	c7 05 30 70 80 00 00 	movl   $0x0,0x807030
+  8022fa:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  8022fd:	83 c6 01             	add    $0x1,%esi
+  802300:	89 35 34 70 80 00    	mov    %esi,0x807034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  802306:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802309:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80230e:	e8 2a fa ff ff       	call   801d3d <fsipc>
+  802313:	89 c3                	mov    %eax,%ebx
+  802315:	83 c4 10             	add    $0x10,%esp
+  802318:	83 f8 01             	cmp    $0x1,%eax
+  80231b:	7e 37                	jle    802354 <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  80231d:	a1 38 70 80 00       	mov    0x807038,%eax
+  802322:	8b 55 18             	mov    0x18(%ebp),%edx
+  802325:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  802327:	83 ec 04             	sub    $0x4,%esp
+  80232a:	50                   	push   %eax
+  80232b:	81 c6 e4 70 80 00    	add    $0x8070e4,%esi
+  802331:	56                   	push   %esi
+  802332:	ff 75 10             	push   0x10(%ebp)
+  802335:	e8 b9 e7 ff ff       	call   800af3 <memmove>
+  return fd2num(fd);
+  80233a:	83 c4 04             	add    $0x4,%esp
+  80233d:	ff 75 e4             	push   -0x1c(%ebp)
+  802340:	e8 3a f3 ff ff       	call   80167f <fd2num>
+  802345:	89 c3                	mov    %eax,%ebx
+  802347:	83 c4 10             	add    $0x10,%esp
+}
+  80234a:	89 d8                	mov    %ebx,%eax
+  80234c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80234f:	5b                   	pop    %ebx
+  802350:	5e                   	pop    %esi
+  802351:	5f                   	pop    %edi
+  802352:	5d                   	pop    %ebp
+  802353:	c3                   	ret
+    fd_close(fd, 0);
+  802354:	83 ec 08             	sub    $0x8,%esp
+  802357:	6a 00                	push   $0x0
+  802359:	ff 75 e4             	push   -0x1c(%ebp)
+  80235c:	e8 34 f4 ff ff       	call   801795 <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  802361:	83 c4 10             	add    $0x10,%esp
+  802364:	85 db                	test   %ebx,%ebx
+  802366:	78 e2                	js     80234a <open_read+0xed>
+  802368:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  80236b:	8b 9b 1c 70 80 00    	mov    0x80701c(%ebx),%ebx
+  802371:	eb d7                	jmp    80234a <open_read+0xed>
+    return -E_BAD_PATH;
+  802373:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802378:	eb d0                	jmp    80234a <open_read+0xed>
+
+0080237a <file_stat>:
+{
+  80237a:	55                   	push   %ebp
+  80237b:	89 e5                	mov    %esp,%ebp
+  80237d:	57                   	push   %edi
+  80237e:	56                   	push   %esi
+  80237f:	53                   	push   %ebx
+  802380:	83 ec 18             	sub    $0x18,%esp
+  802383:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802386:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  802389:	57                   	push   %edi
+  80238a:	e8 a3 e5 ff ff       	call   800932 <strlen>
+  80238f:	83 c4 10             	add    $0x10,%esp
+  802392:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802397:	0f 8f c7 00 00 00    	jg     802464 <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  80239d:	83 ec 0c             	sub    $0xc,%esp
+  8023a0:	57                   	push   %edi
+  8023a1:	e8 8c e5 ff ff       	call   800932 <strlen>
+  8023a6:	8d 58 04             	lea    0x4(%eax),%ebx
+  8023a9:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  8023ac:	83 c4 08             	add    $0x8,%esp
+  8023af:	57                   	push   %edi
+  8023b0:	68 e4 70 80 00       	push   $0x8070e4
+  8023b5:	e8 b3 e5 ff ff       	call   80096d <strcpy>
+  req->req_nops = 2;
+  8023ba:	c7 05 00 70 80 00 02 	movl   $0x2,0x807000
+  8023c1:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  8023c4:	c7 05 04 70 80 00 02 	movl   $0x2,0x807004
+  8023cb:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  8023ce:	c7 05 10 70 80 00 00 	movl   $0x0,0x807010
+  8023d5:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  8023d8:	c7 05 18 70 80 00 00 	movl   $0x0,0x807018
+  8023df:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  8023e2:	c7 05 20 70 80 00 03 	movl   $0x3,0x807020
+  8023e9:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  8023ec:	c7 05 24 70 80 00 01 	movl   $0x1,0x807024
+  8023f3:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  8023f6:	89 1d 34 70 80 00    	mov    %ebx,0x807034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  8023fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  802401:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802406:	e8 32 f9 ff ff       	call   801d3d <fsipc>
+  80240b:	83 c4 10             	add    $0x10,%esp
+  80240e:	83 f8 01             	cmp    $0x1,%eax
+  802411:	7e 42                	jle    802455 <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  802413:	81 c3 e4 70 80 00    	add    $0x8070e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  802419:	83 ec 08             	sub    $0x8,%esp
+  80241c:	53                   	push   %ebx
+  80241d:	56                   	push   %esi
+  80241e:	e8 4a e5 ff ff       	call   80096d <strcpy>
+  st->st_size = ret->ret_size;
+  802423:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  802429:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  80242f:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  802435:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  80243b:	c7 86 88 00 00 00 04 	movl   $0x805004,0x88(%esi)
+  802442:	50 80 00 
+  return 0;
+  802445:	83 c4 10             	add    $0x10,%esp
+  802448:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80244d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802450:	5b                   	pop    %ebx
+  802451:	5e                   	pop    %esi
+  802452:	5f                   	pop    %edi
+  802453:	5d                   	pop    %ebp
+  802454:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  802455:	85 c0                	test   %eax,%eax
+  802457:	78 f4                	js     80244d <file_stat+0xd3>
+  802459:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80245c:	8b 80 1c 70 80 00    	mov    0x80701c(%eax),%eax
+  802462:	eb e9                	jmp    80244d <file_stat+0xd3>
+    return -E_BAD_PATH;
+  802464:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802469:	eb e2                	jmp    80244d <file_stat+0xd3>
+
+0080246b <read_map>:
+{
+  80246b:	55                   	push   %ebp
+  80246c:	89 e5                	mov    %esp,%ebp
+  80246e:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802471:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802474:	50                   	push   %eax
+  802475:	ff 75 08             	push   0x8(%ebp)
+  802478:	e8 7c f2 ff ff       	call   8016f9 <fd_lookup>
+  80247d:	83 c4 10             	add    $0x10,%esp
+  802480:	85 c0                	test   %eax,%eax
+  802482:	78 2a                	js     8024ae <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  802484:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802487:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  80248d:	39 08                	cmp    %ecx,(%eax)
+  80248f:	75 1f                	jne    8024b0 <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  802491:	8b 40 0c             	mov    0xc(%eax),%eax
+  802494:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.read_map.req_offset = offset;
+  802499:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80249c:	a3 04 70 80 00       	mov    %eax,0x807004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  8024a1:	8b 55 10             	mov    0x10(%ebp),%edx
+  8024a4:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8024a9:	e8 8f f8 ff ff       	call   801d3d <fsipc>
+}
+  8024ae:	c9                   	leave
+  8024af:	c3                   	ret
+    return -E_INVAL;
+  8024b0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8024b5:	eb f7                	jmp    8024ae <read_map+0x43>
+
+008024b7 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8024b7:	55                   	push   %ebp
+  8024b8:	89 e5                	mov    %esp,%ebp
+  8024ba:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  8024bd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024c2:	b8 08 00 00 00       	mov    $0x8,%eax
+  8024c7:	e8 71 f8 ff ff       	call   801d3d <fsipc>
+}
+  8024cc:	c9                   	leave
+  8024cd:	c3                   	ret
+
+008024ce <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  8024ce:	55                   	push   %ebp
+  8024cf:	89 e5                	mov    %esp,%ebp
+  8024d1:	57                   	push   %edi
+  8024d2:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  8024d3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8024d6:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.stats.req_bio_sched = 0;
+  8024db:	c7 05 04 70 80 00 00 	movl   $0x0,0x807004
+  8024e2:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  8024e5:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  8024ec:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  8024ef:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024f4:	b8 09 00 00 00       	mov    $0x9,%eax
+  8024f9:	e8 3f f8 ff ff       	call   801d3d <fsipc>
+  8024fe:	85 c0                	test   %eax,%eax
+  802500:	78 14                	js     802516 <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  802502:	be 00 70 80 00       	mov    $0x807000,%esi
+  802507:	b9 16 00 00 00       	mov    $0x16,%ecx
+  80250c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80250f:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  802511:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802516:	5e                   	pop    %esi
+  802517:	5f                   	pop    %edi
+  802518:	5d                   	pop    %ebp
+  802519:	c3                   	ret
+
+0080251a <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  80251a:	55                   	push   %ebp
+  80251b:	89 e5                	mov    %esp,%ebp
+  80251d:	53                   	push   %ebx
+  80251e:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  802521:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802524:	50                   	push   %eax
+  802525:	6a 00                	push   $0x0
+  802527:	e8 a2 ff ff ff       	call   8024ce <fs_stats>
+  80252c:	83 c4 10             	add    $0x10,%esp
+  80252f:	85 c0                	test   %eax,%eax
+  802531:	78 28                	js     80255b <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  802533:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  802536:	83 ec 08             	sub    $0x8,%esp
+  802539:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  80253c:	50                   	push   %eax
+  80253d:	6a 20                	push   $0x20
+  80253f:	e8 8a ff ff ff       	call   8024ce <fs_stats>
+  802544:	83 c4 10             	add    $0x10,%esp
+  802547:	85 c0                	test   %eax,%eax
+  802549:	78 10                	js     80255b <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  80254b:	83 ec 08             	sub    $0x8,%esp
+  80254e:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802551:	50                   	push   %eax
+  802552:	53                   	push   %ebx
+  802553:	e8 76 ff ff ff       	call   8024ce <fs_stats>
+  802558:	83 c4 10             	add    $0x10,%esp
+}
+  80255b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80255e:	c9                   	leave
+  80255f:	c3                   	ret
+
+00802560 <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  802560:	55                   	push   %ebp
+  802561:	89 e5                	mov    %esp,%ebp
+  802563:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  802566:	c7 05 00 70 80 00 00 	movl   $0x0,0x807000
+  80256d:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  802570:	8b 45 08             	mov    0x8(%ebp),%eax
+  802573:	a3 04 70 80 00       	mov    %eax,0x807004
+  fsipcbuf.stats.req_dcache = 0;
+  802578:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  80257f:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  802582:	ba 00 00 00 00       	mov    $0x0,%edx
+  802587:	b8 09 00 00 00       	mov    $0x9,%eax
+  80258c:	e8 ac f7 ff ff       	call   801d3d <fsipc>
+}
+  802591:	c9                   	leave
+  802592:	c3                   	ret
+
+00802593 <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  802593:	55                   	push   %ebp
+  802594:	89 e5                	mov    %esp,%ebp
+  802596:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  802599:	c7 05 00 70 80 00 00 	movl   $0x0,0x807000
+  8025a0:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  8025a3:	c7 05 04 70 80 00 00 	movl   $0x0,0x807004
+  8025aa:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  8025ad:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025b0:	a3 08 70 80 00       	mov    %eax,0x807008
+  return fsipc(FSREQ_STATS, NULL);
+  8025b5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025ba:	b8 09 00 00 00       	mov    $0x9,%eax
+  8025bf:	e8 79 f7 ff ff       	call   801d3d <fsipc>
+}
+  8025c4:	c9                   	leave
+  8025c5:	c3                   	ret
+
+008025c6 <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  8025c6:	55                   	push   %ebp
+  8025c7:	89 e5                	mov    %esp,%ebp
+  8025c9:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8025cc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8025cf:	50                   	push   %eax
+  8025d0:	ff 75 08             	push   0x8(%ebp)
+  8025d3:	e8 21 f1 ff ff       	call   8016f9 <fd_lookup>
+  8025d8:	83 c4 10             	add    $0x10,%esp
+  8025db:	85 c0                	test   %eax,%eax
+  8025dd:	78 34                	js     802613 <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  8025df:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025e2:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  8025e8:	39 08                	cmp    %ecx,(%eax)
+  8025ea:	75 29                	jne    802615 <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  8025ec:	8b 40 0c             	mov    0xc(%eax),%eax
+  8025ef:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.fallocate.req_offset = offset;
+  8025f4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8025f7:	a3 04 70 80 00       	mov    %eax,0x807004
+  fsipcbuf.fallocate.req_len = len;
+  8025fc:	8b 45 10             	mov    0x10(%ebp),%eax
+  8025ff:	a3 08 70 80 00       	mov    %eax,0x807008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  802604:	ba 00 00 00 00       	mov    $0x0,%edx
+  802609:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80260e:	e8 2a f7 ff ff       	call   801d3d <fsipc>
+}
+  802613:	c9                   	leave
+  802614:	c3                   	ret
+    return -E_INVAL;
+  802615:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80261a:	eb f7                	jmp    802613 <fallocate+0x4d>
+
+0080261c <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  80261c:	55                   	push   %ebp
+  80261d:	89 e5                	mov    %esp,%ebp
+  80261f:	57                   	push   %edi
+  802620:	56                   	push   %esi
+  802621:	53                   	push   %ebx
+  802622:	83 ec 24             	sub    $0x24,%esp
+  802625:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802628:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80262b:	50                   	push   %eax
+  80262c:	ff 75 08             	push   0x8(%ebp)
+  80262f:	e8 c5 f0 ff ff       	call   8016f9 <fd_lookup>
+  802634:	83 c4 10             	add    $0x10,%esp
+  802637:	85 c0                	test   %eax,%eax
+  802639:	78 66                	js     8026a1 <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  80263b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80263e:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  802644:	39 08                	cmp    %ecx,(%eax)
+  802646:	75 61                	jne    8026a9 <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  802648:	85 f6                	test   %esi,%esi
+  80264a:	7e 50                	jle    80269c <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  80264c:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  802651:	39 de                	cmp    %ebx,%esi
+  802653:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  802656:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802659:	8b 40 0c             	mov    0xc(%eax),%eax
+  80265c:	a3 00 70 80 00       	mov    %eax,0x807000
+    fsipcbuf.prefetch.req_n = m;
+  802661:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  802667:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  80266e:	83 ec 04             	sub    $0x4,%esp
+  802671:	57                   	push   %edi
+  802672:	ff 75 0c             	push   0xc(%ebp)
+  802675:	68 08 70 80 00       	push   $0x807008
+  80267a:	e8 74 e4 ff ff       	call   800af3 <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  80267f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802684:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802689:	e8 af f6 ff ff       	call   801d3d <fsipc>
+  80268e:	83 c4 10             	add    $0x10,%esp
+  802691:	85 c0                	test   %eax,%eax
+  802693:	78 0c                	js     8026a1 <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  802695:	01 7d 0c             	add    %edi,0xc(%ebp)
+  802698:	29 de                	sub    %ebx,%esi
+  80269a:	eb ac                	jmp    802648 <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  80269c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8026a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026a4:	5b                   	pop    %ebx
+  8026a5:	5e                   	pop    %esi
+  8026a6:	5f                   	pop    %edi
+  8026a7:	5d                   	pop    %ebp
+  8026a8:	c3                   	ret
+    return -E_INVAL;
+  8026a9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026ae:	eb f1                	jmp    8026a1 <prefetch+0x85>
+
+008026b0 <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  8026b0:	55                   	push   %ebp
+  8026b1:	89 e5                	mov    %esp,%ebp
+  8026b3:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  8026b6:	50                   	push   %eax
+  8026b7:	e8 d3 ef ff ff       	call   80168f <fd2data>
+  8026bc:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  8026c1:	c9                   	leave
+  8026c2:	c3                   	ret
+
+008026c3 <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8026c3:	55                   	push   %ebp
+  8026c4:	89 e5                	mov    %esp,%ebp
+  8026c6:	56                   	push   %esi
+  8026c7:	53                   	push   %ebx
+  8026c8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  8026cb:	83 ec 0c             	sub    $0xc,%esp
+  8026ce:	ff 75 08             	push   0x8(%ebp)
+  8026d1:	e8 b9 ef ff ff       	call   80168f <fd2data>
+  8026d6:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  8026d8:	83 c4 08             	add    $0x8,%esp
+  8026db:	68 d4 40 80 00       	push   $0x8040d4
+  8026e0:	53                   	push   %ebx
+  8026e1:	e8 87 e2 ff ff       	call   80096d <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  8026e6:	8b 46 04             	mov    0x4(%esi),%eax
+  8026e9:	2b 06                	sub    (%esi),%eax
+  8026eb:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  8026f1:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8026f8:	00 00 00 
+  stat->st_dev = &devpipe;
+  8026fb:	c7 83 88 00 00 00 20 	movl   $0x805020,0x88(%ebx)
+  802702:	50 80 00 
+  return 0;
+}
+  802705:	b8 00 00 00 00       	mov    $0x0,%eax
+  80270a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80270d:	5b                   	pop    %ebx
+  80270e:	5e                   	pop    %esi
+  80270f:	5d                   	pop    %ebp
+  802710:	c3                   	ret
+
+00802711 <pipe_wakeup>:
+{
+  802711:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  802713:	b8 00 00 00 00       	mov    $0x0,%eax
+  802718:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  80271b:	85 c0                	test   %eax,%eax
+  80271d:	75 01                	jne    802720 <pipe_wakeup+0xf>
+  80271f:	c3                   	ret
+{
+  802720:	55                   	push   %ebp
+  802721:	89 e5                	mov    %esp,%ebp
+  802723:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  802726:	6a 00                	push   $0x0
+  802728:	68 00 00 c0 ee       	push   $0xeec00000
+  80272d:	52                   	push   %edx
+  80272e:	e8 c5 e9 ff ff       	call   8010f8 <sys_chan_wakeup>
+  802733:	83 c4 10             	add    $0x10,%esp
+}
+  802736:	c9                   	leave
+  802737:	c3                   	ret
+
+00802738 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802738:	55                   	push   %ebp
+  802739:	89 e5                	mov    %esp,%ebp
+  80273b:	57                   	push   %edi
+  80273c:	56                   	push   %esi
+  80273d:	53                   	push   %ebx
+  80273e:	83 ec 18             	sub    $0x18,%esp
+  802741:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  802744:	57                   	push   %edi
+  802745:	e8 45 ef ff ff       	call   80168f <fd2data>
+  80274a:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  80274c:	83 c4 10             	add    $0x10,%esp
+  80274f:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  802753:	74 2a                	je     80277f <devpipe_close+0x47>
+  802755:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  80275a:	89 f8                	mov    %edi,%eax
+  80275c:	e8 4f ff ff ff       	call   8026b0 <pipe_ring>
+  802761:	83 ec 08             	sub    $0x8,%esp
+  802764:	01 d8                	add    %ebx,%eax
+  802766:	50                   	push   %eax
+  802767:	6a 00                	push   $0x0
+  802769:	e8 b3 e6 ff ff       	call   800e21 <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  80276e:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802774:	83 c4 10             	add    $0x10,%esp
+  802777:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  80277d:	75 db                	jne    80275a <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  80277f:	83 ec 08             	sub    $0x8,%esp
+  802782:	57                   	push   %edi
+  802783:	6a 00                	push   $0x0
+  802785:	e8 97 e6 ff ff       	call   800e21 <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  80278a:	83 c4 10             	add    $0x10,%esp
+  80278d:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  802791:	75 13                	jne    8027a6 <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  802793:	83 ec 08             	sub    $0x8,%esp
+  802796:	56                   	push   %esi
+  802797:	6a 00                	push   $0x0
+  802799:	e8 83 e6 ff ff       	call   800e21 <sys_page_unmap>
+}
+  80279e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027a1:	5b                   	pop    %ebx
+  8027a2:	5e                   	pop    %esi
+  8027a3:	5f                   	pop    %edi
+  8027a4:	5d                   	pop    %ebp
+  8027a5:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  8027a6:	8d 56 04             	lea    0x4(%esi),%edx
+  8027a9:	8d 46 2c             	lea    0x2c(%esi),%eax
+  8027ac:	e8 60 ff ff ff       	call   802711 <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8027b1:	8d 46 30             	lea    0x30(%esi),%eax
+  8027b4:	89 f2                	mov    %esi,%edx
+  8027b6:	e8 56 ff ff ff       	call   802711 <pipe_wakeup>
+  8027bb:	eb d6                	jmp    802793 <devpipe_close+0x5b>
+
+008027bd <_pipeisclosed>:
+{
+  8027bd:	55                   	push   %ebp
+  8027be:	89 e5                	mov    %esp,%ebp
+  8027c0:	57                   	push   %edi
+  8027c1:	56                   	push   %esi
+  8027c2:	53                   	push   %ebx
+  8027c3:	83 ec 1c             	sub    $0x1c,%esp
+  8027c6:	89 c7                	mov    %eax,%edi
+  8027c8:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  8027ca:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  8027cf:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  8027d2:	83 ec 0c             	sub    $0xc,%esp
+  8027d5:	57                   	push   %edi
+  8027d6:	e8 99 10 00 00       	call   803874 <pageref>
+  8027db:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8027de:	89 34 24             	mov    %esi,(%esp)
+  8027e1:	e8 8e 10 00 00       	call   803874 <pageref>
+    nn = thisenv->env_runs;
+  8027e6:	8b 15 a0 68 80 00    	mov    0x8068a0,%edx
+  8027ec:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  8027ef:	83 c4 10             	add    $0x10,%esp
+  8027f2:	39 cb                	cmp    %ecx,%ebx
+  8027f4:	74 1b                	je     802811 <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  8027f6:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8027f9:	75 cf                	jne    8027ca <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8027fb:	8b 42 58             	mov    0x58(%edx),%eax
+  8027fe:	6a 01                	push   $0x1
+  802800:	50                   	push   %eax
+  802801:	53                   	push   %ebx
+  802802:	68 db 40 80 00       	push   $0x8040db
+  802807:	e8 73 db ff ff       	call   80037f <cprintf>
+  80280c:	83 c4 10             	add    $0x10,%esp
+  80280f:	eb b9                	jmp    8027ca <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  802811:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802814:	0f 94 c0             	sete   %al
+  802817:	0f b6 c0             	movzbl %al,%eax
+}
+  80281a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80281d:	5b                   	pop    %ebx
+  80281e:	5e                   	pop    %esi
+  80281f:	5f                   	pop    %edi
+  802820:	5d                   	pop    %ebp
+  802821:	c3                   	ret
+
+00802822 <devpipe_write_bulk>:
+{
+  802822:	55                   	push   %ebp
+  802823:	89 e5                	mov    %esp,%ebp
+  802825:	57                   	push   %edi
+  802826:	56                   	push   %esi
+  802827:	53                   	push   %ebx
+  802828:	83 ec 1c             	sub    $0x1c,%esp
+  80282b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80282e:	89 d6                	mov    %edx,%esi
+  802830:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  802833:	e8 78 fe ff ff       	call   8026b0 <pipe_ring>
+  802838:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  80283b:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802840:	8d 46 04             	lea    0x4(%esi),%eax
+  802843:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  802846:	eb 75                	jmp    8028bd <devpipe_write_bulk+0x9b>
+  802848:	b8 01 00 00 00       	mov    $0x1,%eax
+  80284d:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802851:	6a 64                	push   $0x64
+  802853:	68 00 00 c0 ee       	push   $0xeec00000
+  802858:	53                   	push   %ebx
+  802859:	56                   	push   %esi
+  80285a:	e8 76 e8 ff ff       	call   8010d5 <sys_chan_sleep>
+      continue;
+  80285f:	83 c4 10             	add    $0x10,%esp
+  802862:	eb 59                	jmp    8028bd <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  802864:	89 d1                	mov    %edx,%ecx
+  802866:	c1 f9 1f             	sar    $0x1f,%ecx
+  802869:	c1 e9 11             	shr    $0x11,%ecx
+  80286c:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  80286f:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802874:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  802876:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  80287c:	29 d3                	sub    %edx,%ebx
+  80287e:	ba 00 80 00 00       	mov    $0x8000,%edx
+  802883:	29 c2                	sub    %eax,%edx
+  802885:	39 d3                	cmp    %edx,%ebx
+  802887:	0f 47 da             	cmova  %edx,%ebx
+  80288a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80288d:	29 fa                	sub    %edi,%edx
+  80288f:	39 d3                	cmp    %edx,%ebx
+  802891:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  802894:	83 ec 04             	sub    $0x4,%esp
+  802897:	53                   	push   %ebx
+  802898:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80289b:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  80289e:	52                   	push   %edx
+  80289f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8028a2:	01 c8                	add    %ecx,%eax
+  8028a4:	50                   	push   %eax
+  8028a5:	e8 ab e2 ff ff       	call   800b55 <memcpy>
+    i += m;
+  8028aa:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  8028ac:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  8028af:	8d 46 2c             	lea    0x2c(%esi),%eax
+  8028b2:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8028b5:	e8 57 fe ff ff       	call   802711 <pipe_wakeup>
+  8028ba:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  8028bd:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  8028c0:	73 2b                	jae    8028ed <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  8028c2:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  8028c4:	8b 56 04             	mov    0x4(%esi),%edx
+  8028c7:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  8028cd:	39 d0                	cmp    %edx,%eax
+  8028cf:	7d 93                	jge    802864 <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  8028d1:	89 f2                	mov    %esi,%edx
+  8028d3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8028d6:	e8 e2 fe ff ff       	call   8027bd <_pipeisclosed>
+  8028db:	85 c0                	test   %eax,%eax
+  8028dd:	0f 84 65 ff ff ff    	je     802848 <devpipe_write_bulk+0x26>
+        return i;
+  8028e3:	89 f8                	mov    %edi,%eax
+}
+  8028e5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028e8:	5b                   	pop    %ebx
+  8028e9:	5e                   	pop    %esi
+  8028ea:	5f                   	pop    %edi
+  8028eb:	5d                   	pop    %ebp
+  8028ec:	c3                   	ret
+  return i;
+  8028ed:	89 f8                	mov    %edi,%eax
+  8028ef:	eb f4                	jmp    8028e5 <devpipe_write_bulk+0xc3>
+
+008028f1 <devpipe_write>:
+{
+  8028f1:	55                   	push   %ebp
+  8028f2:	89 e5                	mov    %esp,%ebp
+  8028f4:	57                   	push   %edi
+  8028f5:	56                   	push   %esi
+  8028f6:	53                   	push   %ebx
+  8028f7:	83 ec 28             	sub    $0x28,%esp
+  8028fa:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  8028fd:	56                   	push   %esi
+  8028fe:	e8 8c ed ff ff       	call   80168f <fd2data>
+  802903:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  802905:	8b 78 28             	mov    0x28(%eax),%edi
+  802908:	83 c4 10             	add    $0x10,%esp
+  80290b:	85 ff                	test   %edi,%edi
+  80290d:	75 25                	jne    802934 <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  80290f:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802912:	74 66                	je     80297a <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802914:	8b 43 04             	mov    0x4(%ebx),%eax
+  802917:	8b 0b                	mov    (%ebx),%ecx
+  802919:	8d 51 20             	lea    0x20(%ecx),%edx
+  80291c:	39 d0                	cmp    %edx,%eax
+  80291e:	72 2b                	jb     80294b <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  802920:	89 da                	mov    %ebx,%edx
+  802922:	89 f0                	mov    %esi,%eax
+  802924:	e8 94 fe ff ff       	call   8027bd <_pipeisclosed>
+  802929:	85 c0                	test   %eax,%eax
+  80292b:	75 51                	jne    80297e <devpipe_write+0x8d>
+      sys_yield();
+  80292d:	e8 08 e4 ff ff       	call   800d3a <sys_yield>
+  802932:	eb e0                	jmp    802914 <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  802934:	83 ec 0c             	sub    $0xc,%esp
+  802937:	ff 75 10             	push   0x10(%ebp)
+  80293a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80293d:	89 c2                	mov    %eax,%edx
+  80293f:	89 f0                	mov    %esi,%eax
+  802941:	e8 dc fe ff ff       	call   802822 <devpipe_write_bulk>
+  802946:	83 c4 10             	add    $0x10,%esp
+  802949:	eb 38                	jmp    802983 <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80294b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80294e:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802952:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802955:	89 c2                	mov    %eax,%edx
+  802957:	c1 fa 1f             	sar    $0x1f,%edx
+  80295a:	89 d1                	mov    %edx,%ecx
+  80295c:	c1 e9 1b             	shr    $0x1b,%ecx
+  80295f:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802962:	83 e2 1f             	and    $0x1f,%edx
+  802965:	29 ca                	sub    %ecx,%edx
+  802967:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  80296b:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  80296f:	83 c0 01             	add    $0x1,%eax
+  802972:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  802975:	83 c7 01             	add    $0x1,%edi
+  802978:	eb 95                	jmp    80290f <devpipe_write+0x1e>
+  return i;
+  80297a:	89 f8                	mov    %edi,%eax
+  80297c:	eb 05                	jmp    802983 <devpipe_write+0x92>
+        return 0;
+  80297e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802983:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802986:	5b                   	pop    %ebx
+  802987:	5e                   	pop    %esi
+  802988:	5f                   	pop    %edi
+  802989:	5d                   	pop    %ebp
+  80298a:	c3                   	ret
+
+0080298b <devpipe_read_bulk>:
+{
+  80298b:	55                   	push   %ebp
+  80298c:	89 e5                	mov    %esp,%ebp
+  80298e:	57                   	push   %edi
+  80298f:	56                   	push   %esi
+  802990:	53                   	push   %ebx
+  802991:	83 ec 2c             	sub    $0x2c,%esp
+  802994:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802997:	89 d6                	mov    %edx,%esi
+  802999:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80299c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  80299f:	e8 0c fd ff ff       	call   8026b0 <pipe_ring>
+  8029a4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  8029a7:	85 db                	test   %ebx,%ebx
+  8029a9:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8029ae:	0f 45 c3             	cmovne %ebx,%eax
+  8029b1:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8029b4:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8029b9:	8d 46 30             	lea    0x30(%esi),%eax
+  8029bc:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  8029bf:	eb 50                	jmp    802a11 <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  8029c1:	89 d1                	mov    %edx,%ecx
+  8029c3:	c1 f9 1f             	sar    $0x1f,%ecx
+  8029c6:	c1 e9 11             	shr    $0x11,%ecx
+  8029c9:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  8029cc:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8029d1:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  8029d3:	29 d3                	sub    %edx,%ebx
+  8029d5:	ba 00 80 00 00       	mov    $0x8000,%edx
+  8029da:	29 c2                	sub    %eax,%edx
+  8029dc:	39 d3                	cmp    %edx,%ebx
+  8029de:	0f 47 da             	cmova  %edx,%ebx
+  8029e1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8029e4:	29 fa                	sub    %edi,%edx
+  8029e6:	39 d3                	cmp    %edx,%ebx
+  8029e8:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  8029eb:	83 ec 04             	sub    $0x4,%esp
+  8029ee:	53                   	push   %ebx
+  8029ef:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8029f2:	01 c8                	add    %ecx,%eax
+  8029f4:	50                   	push   %eax
+  8029f5:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8029f8:	01 f8                	add    %edi,%eax
+  8029fa:	50                   	push   %eax
+  8029fb:	e8 55 e1 ff ff       	call   800b55 <memcpy>
+    i += m;
+  802a00:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  802a02:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802a04:	89 f2                	mov    %esi,%edx
+  802a06:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802a09:	e8 03 fd ff ff       	call   802711 <pipe_wakeup>
+  802a0e:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802a11:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802a14:	73 51                	jae    802a67 <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  802a16:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  802a19:	8b 16                	mov    (%esi),%edx
+  802a1b:	39 da                	cmp    %ebx,%edx
+  802a1d:	75 a2                	jne    8029c1 <devpipe_read_bulk+0x36>
+      if (i > 0)
+  802a1f:	85 ff                	test   %edi,%edi
+  802a21:	75 44                	jne    802a67 <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  802a23:	89 f2                	mov    %esi,%edx
+  802a25:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802a28:	e8 90 fd ff ff       	call   8027bd <_pipeisclosed>
+  802a2d:	85 c0                	test   %eax,%eax
+  802a2f:	75 3a                	jne    802a6b <devpipe_read_bulk+0xe0>
+  802a31:	b8 01 00 00 00       	mov    $0x1,%eax
+  802a36:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802a3a:	6a 64                	push   $0x64
+  802a3c:	ff 75 d4             	push   -0x2c(%ebp)
+  802a3f:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  802a40:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802a43:	50                   	push   %eax
+  802a44:	e8 8c e6 ff ff       	call   8010d5 <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  802a49:	85 c0                	test   %eax,%eax
+  802a4b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a50:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  802a53:	83 c4 10             	add    $0x10,%esp
+  802a56:	a8 01                	test   $0x1,%al
+  802a58:	74 b7                	je     802a11 <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  802a5a:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  802a5f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a62:	5b                   	pop    %ebx
+  802a63:	5e                   	pop    %esi
+  802a64:	5f                   	pop    %edi
+  802a65:	5d                   	pop    %ebp
+  802a66:	c3                   	ret
+  return i;
+  802a67:	89 f8                	mov    %edi,%eax
+  802a69:	eb f4                	jmp    802a5f <devpipe_read_bulk+0xd4>
+        return 0;
+  802a6b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a70:	eb ed                	jmp    802a5f <devpipe_read_bulk+0xd4>
+
+00802a72 <devpipe_read>:
+{
+  802a72:	55                   	push   %ebp
+  802a73:	89 e5                	mov    %esp,%ebp
+  802a75:	57                   	push   %edi
+  802a76:	56                   	push   %esi
+  802a77:	53                   	push   %ebx
+  802a78:	83 ec 18             	sub    $0x18,%esp
+  802a7b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  802a7e:	57                   	push   %edi
+  802a7f:	e8 0b ec ff ff       	call   80168f <fd2data>
+  802a84:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  802a86:	8b 70 28             	mov    0x28(%eax),%esi
+  802a89:	83 c4 10             	add    $0x10,%esp
+  802a8c:	85 f6                	test   %esi,%esi
+  802a8e:	75 24                	jne    802ab4 <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  802a90:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802a93:	74 60                	je     802af5 <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  802a95:	8b 03                	mov    (%ebx),%eax
+  802a97:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802a9a:	75 3b                	jne    802ad7 <devpipe_read+0x65>
+      if (i > 0)
+  802a9c:	85 f6                	test   %esi,%esi
+  802a9e:	75 2d                	jne    802acd <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  802aa0:	89 da                	mov    %ebx,%edx
+  802aa2:	89 f8                	mov    %edi,%eax
+  802aa4:	e8 14 fd ff ff       	call   8027bd <_pipeisclosed>
+  802aa9:	85 c0                	test   %eax,%eax
+  802aab:	75 4c                	jne    802af9 <devpipe_read+0x87>
+      sys_yield();
+  802aad:	e8 88 e2 ff ff       	call   800d3a <sys_yield>
+  802ab2:	eb e1                	jmp    802a95 <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  802ab4:	83 ec 08             	sub    $0x8,%esp
+  802ab7:	6a 00                	push   $0x0
+  802ab9:	ff 75 10             	push   0x10(%ebp)
+  802abc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802abf:	89 c2                	mov    %eax,%edx
+  802ac1:	89 f8                	mov    %edi,%eax
+  802ac3:	e8 c3 fe ff ff       	call   80298b <devpipe_read_bulk>
+  802ac8:	83 c4 10             	add    $0x10,%esp
+  802acb:	eb 02                	jmp    802acf <devpipe_read+0x5d>
+        return i;
+  802acd:	89 f0                	mov    %esi,%eax
+}
+  802acf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ad2:	5b                   	pop    %ebx
+  802ad3:	5e                   	pop    %esi
+  802ad4:	5f                   	pop    %edi
+  802ad5:	5d                   	pop    %ebp
+  802ad6:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802ad7:	99                   	cltd
+  802ad8:	c1 ea 1b             	shr    $0x1b,%edx
+  802adb:	01 d0                	add    %edx,%eax
+  802add:	83 e0 1f             	and    $0x1f,%eax
+  802ae0:	29 d0                	sub    %edx,%eax
+  802ae2:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802ae7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802aea:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  802aed:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  802af0:	83 c6 01             	add    $0x1,%esi
+  802af3:	eb 9b                	jmp    802a90 <devpipe_read+0x1e>
+  return i;
+  802af5:	89 f0                	mov    %esi,%eax
+  802af7:	eb d6                	jmp    802acf <devpipe_read+0x5d>
+        return 0;
+  802af9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802afe:	eb cf                	jmp    802acf <devpipe_read+0x5d>
+
+00802b00 <pipe2>:
+{
+  802b00:	55                   	push   %ebp
+  802b01:	89 e5                	mov    %esp,%ebp
+  802b03:	57                   	push   %edi
+  802b04:	56                   	push   %esi
+  802b05:	53                   	push   %ebx
+  802b06:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  802b09:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802b0c:	50                   	push   %eax
+  802b0d:	e8 91 eb ff ff       	call   8016a3 <fd_alloc>
+  802b12:	89 c3                	mov    %eax,%ebx
+  802b14:	83 c4 10             	add    $0x10,%esp
+  802b17:	85 c0                	test   %eax,%eax
+  802b19:	0f 88 fb 01 00 00    	js     802d1a <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802b1f:	83 ec 04             	sub    $0x4,%esp
+  802b22:	68 07 04 00 00       	push   $0x407
+  802b27:	ff 75 e4             	push   -0x1c(%ebp)
+  802b2a:	6a 00                	push   $0x0
+  802b2c:	e8 6b e2 ff ff       	call   800d9c <sys_page_alloc>
+  802b31:	89 c3                	mov    %eax,%ebx
+  802b33:	83 c4 10             	add    $0x10,%esp
+  802b36:	85 c0                	test   %eax,%eax
+  802b38:	0f 88 dc 01 00 00    	js     802d1a <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  802b3e:	83 ec 0c             	sub    $0xc,%esp
+  802b41:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  802b44:	50                   	push   %eax
+  802b45:	e8 59 eb ff ff       	call   8016a3 <fd_alloc>
+  802b4a:	89 c3                	mov    %eax,%ebx
+  802b4c:	83 c4 10             	add    $0x10,%esp
+  802b4f:	85 c0                	test   %eax,%eax
+  802b51:	0f 88 b3 01 00 00    	js     802d0a <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802b57:	83 ec 04             	sub    $0x4,%esp
+  802b5a:	68 07 04 00 00       	push   $0x407
+  802b5f:	ff 75 e0             	push   -0x20(%ebp)
+  802b62:	6a 00                	push   $0x0
+  802b64:	e8 33 e2 ff ff       	call   800d9c <sys_page_alloc>
+  802b69:	89 c3                	mov    %eax,%ebx
+  802b6b:	83 c4 10             	add    $0x10,%esp
+  802b6e:	85 c0                	test   %eax,%eax
+  802b70:	0f 88 94 01 00 00    	js     802d0a <pipe2+0x20a>
+  va = fd2data(fd0);
+  802b76:	83 ec 0c             	sub    $0xc,%esp
+  802b79:	ff 75 e4             	push   -0x1c(%ebp)
+  802b7c:	e8 0e eb ff ff       	call   80168f <fd2data>
+  802b81:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802b83:	83 c4 0c             	add    $0xc,%esp
+  802b86:	68 07 04 00 00       	push   $0x407
+  802b8b:	50                   	push   %eax
+  802b8c:	6a 00                	push   $0x0
+  802b8e:	e8 09 e2 ff ff       	call   800d9c <sys_page_alloc>
+  802b93:	89 c3                	mov    %eax,%ebx
+  802b95:	83 c4 10             	add    $0x10,%esp
+  802b98:	85 c0                	test   %eax,%eax
+  802b9a:	0f 88 5a 01 00 00    	js     802cfa <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802ba0:	83 ec 0c             	sub    $0xc,%esp
+  802ba3:	ff 75 e0             	push   -0x20(%ebp)
+  802ba6:	e8 e4 ea ff ff       	call   80168f <fd2data>
+  802bab:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802bb2:	50                   	push   %eax
+  802bb3:	6a 00                	push   $0x0
+  802bb5:	57                   	push   %edi
+  802bb6:	6a 00                	push   $0x0
+  802bb8:	e8 22 e2 ff ff       	call   800ddf <sys_page_map>
+  802bbd:	89 c3                	mov    %eax,%ebx
+  802bbf:	83 c4 20             	add    $0x20,%esp
+  802bc2:	85 c0                	test   %eax,%eax
+  802bc4:	0f 88 22 01 00 00    	js     802cec <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  802bca:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  802bce:	74 72                	je     802c42 <pipe2+0x142>
+  802bd0:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  802bd5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802bd8:	e8 d3 fa ff ff       	call   8026b0 <pipe_ring>
+  802bdd:	83 ec 04             	sub    $0x4,%esp
+  802be0:	68 07 04 00 00       	push   $0x407
+  802be5:	01 f0                	add    %esi,%eax
+  802be7:	50                   	push   %eax
+  802be8:	6a 00                	push   $0x0
+  802bea:	e8 ad e1 ff ff       	call   800d9c <sys_page_alloc>
+  802bef:	89 c3                	mov    %eax,%ebx
+  802bf1:	83 c4 10             	add    $0x10,%esp
+  802bf4:	85 c0                	test   %eax,%eax
+  802bf6:	0f 88 97 00 00 00    	js     802c93 <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  802bfc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802bff:	e8 ac fa ff ff       	call   8026b0 <pipe_ring>
+  802c04:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  802c07:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802c0a:	e8 a1 fa ff ff       	call   8026b0 <pipe_ring>
+  802c0f:	83 ec 0c             	sub    $0xc,%esp
+  802c12:	68 07 04 00 00       	push   $0x407
+  802c17:	53                   	push   %ebx
+  802c18:	6a 00                	push   $0x0
+  802c1a:	01 f0                	add    %esi,%eax
+  802c1c:	50                   	push   %eax
+  802c1d:	6a 00                	push   $0x0
+  802c1f:	e8 bb e1 ff ff       	call   800ddf <sys_page_map>
+  802c24:	89 c3                	mov    %eax,%ebx
+  802c26:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802c2c:	83 c4 20             	add    $0x20,%esp
+  802c2f:	85 c0                	test   %eax,%eax
+  802c31:	78 60                	js     802c93 <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  802c33:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802c39:	75 9a                	jne    802bd5 <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  802c3b:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  802c42:	a1 20 50 80 00       	mov    0x805020,%eax
+  802c47:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802c4a:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  802c4c:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802c4f:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  802c56:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802c59:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  802c5b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802c5e:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  802c65:	83 ec 0c             	sub    $0xc,%esp
+  802c68:	ff 75 e4             	push   -0x1c(%ebp)
+  802c6b:	e8 0f ea ff ff       	call   80167f <fd2num>
+  802c70:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802c73:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  802c75:	83 c4 04             	add    $0x4,%esp
+  802c78:	ff 75 e0             	push   -0x20(%ebp)
+  802c7b:	e8 ff e9 ff ff       	call   80167f <fd2num>
+  802c80:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802c83:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  802c86:	83 c4 10             	add    $0x10,%esp
+  802c89:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c8e:	e9 87 00 00 00       	jmp    802d1a <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802c93:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  802c98:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802c9b:	e8 10 fa ff ff       	call   8026b0 <pipe_ring>
+  802ca0:	83 ec 08             	sub    $0x8,%esp
+  802ca3:	01 f0                	add    %esi,%eax
+  802ca5:	50                   	push   %eax
+  802ca6:	6a 00                	push   $0x0
+  802ca8:	e8 74 e1 ff ff       	call   800e21 <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  802cad:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802cb0:	e8 fb f9 ff ff       	call   8026b0 <pipe_ring>
+  802cb5:	83 c4 08             	add    $0x8,%esp
+  802cb8:	01 f0                	add    %esi,%eax
+  802cba:	50                   	push   %eax
+  802cbb:	6a 00                	push   $0x0
+  802cbd:	e8 5f e1 ff ff       	call   800e21 <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802cc2:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802cc8:	83 c4 10             	add    $0x10,%esp
+  802ccb:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802cd1:	75 c5                	jne    802c98 <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  802cd3:	83 ec 0c             	sub    $0xc,%esp
+  802cd6:	ff 75 e0             	push   -0x20(%ebp)
+  802cd9:	e8 b1 e9 ff ff       	call   80168f <fd2data>
+  802cde:	83 c4 08             	add    $0x8,%esp
+  802ce1:	50                   	push   %eax
+  802ce2:	6a 00                	push   $0x0
+  802ce4:	e8 38 e1 ff ff       	call   800e21 <sys_page_unmap>
+  802ce9:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  802cec:	83 ec 08             	sub    $0x8,%esp
+  802cef:	57                   	push   %edi
+  802cf0:	6a 00                	push   $0x0
+  802cf2:	e8 2a e1 ff ff       	call   800e21 <sys_page_unmap>
+  802cf7:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  802cfa:	83 ec 08             	sub    $0x8,%esp
+  802cfd:	ff 75 e0             	push   -0x20(%ebp)
+  802d00:	6a 00                	push   $0x0
+  802d02:	e8 1a e1 ff ff       	call   800e21 <sys_page_unmap>
+  802d07:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  802d0a:	83 ec 08             	sub    $0x8,%esp
+  802d0d:	ff 75 e4             	push   -0x1c(%ebp)
+  802d10:	6a 00                	push   $0x0
+  802d12:	e8 0a e1 ff ff       	call   800e21 <sys_page_unmap>
+  802d17:	83 c4 10             	add    $0x10,%esp
+}
+  802d1a:	89 d8                	mov    %ebx,%eax
+  802d1c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d1f:	5b                   	pop    %ebx
+  802d20:	5e                   	pop    %esi
+  802d21:	5f                   	pop    %edi
+  802d22:	5d                   	pop    %ebp
+  802d23:	c3                   	ret
+
+00802d24 <pipe>:
+{
+  802d24:	55                   	push   %ebp
+  802d25:	89 e5                	mov    %esp,%ebp
+  802d27:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  802d2a:	6a 00                	push   $0x0
+  802d2c:	ff 75 08             	push   0x8(%ebp)
+  802d2f:	e8 cc fd ff ff       	call   802b00 <pipe2>
+}
+  802d34:	c9                   	leave
+  802d35:	c3                   	ret
+
+00802d36 <pipeisclosed>:
+{
+  802d36:	55                   	push   %ebp
+  802d37:	89 e5                	mov    %esp,%ebp
+  802d39:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802d3c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802d3f:	50                   	push   %eax
+  802d40:	ff 75 08             	push   0x8(%ebp)
+  802d43:	e8 b1 e9 ff ff       	call   8016f9 <fd_lookup>
+  802d48:	83 c4 10             	add    $0x10,%esp
+  802d4b:	85 c0                	test   %eax,%eax
+  802d4d:	78 18                	js     802d67 <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  802d4f:	83 ec 0c             	sub    $0xc,%esp
+  802d52:	ff 75 f4             	push   -0xc(%ebp)
+  802d55:	e8 35 e9 ff ff       	call   80168f <fd2data>
+  802d5a:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  802d5c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802d5f:	e8 59 fa ff ff       	call   8027bd <_pipeisclosed>
+  802d64:	83 c4 10             	add    $0x10,%esp
+}
+  802d67:	c9                   	leave
+  802d68:	c3                   	ret
+
+00802d69 <pipe_splice>:
+{
+  802d69:	55                   	push   %ebp
+  802d6a:	89 e5                	mov    %esp,%ebp
+  802d6c:	57                   	push   %edi
+  802d6d:	56                   	push   %esi
+  802d6e:	53                   	push   %ebx
+  802d6f:	83 ec 34             	sub    $0x34,%esp
+  802d72:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802d75:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802d78:	50                   	push   %eax
+  802d79:	ff 75 08             	push   0x8(%ebp)
+  802d7c:	e8 78 e9 ff ff       	call   8016f9 <fd_lookup>
+  802d81:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802d84:	83 c4 10             	add    $0x10,%esp
+  802d87:	85 c0                	test   %eax,%eax
+  802d89:	0f 88 d7 00 00 00    	js     802e66 <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  802d8f:	83 ec 0c             	sub    $0xc,%esp
+  802d92:	ff 75 e4             	push   -0x1c(%ebp)
+  802d95:	e8 f5 e8 ff ff       	call   80168f <fd2data>
+  802d9a:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802d9c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802d9f:	83 c4 10             	add    $0x10,%esp
+  802da2:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  802da8:	39 10                	cmp    %edx,(%eax)
+  802daa:	0f 85 c1 00 00 00    	jne    802e71 <pipe_splice+0x108>
+  802db0:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  802db4:	0f 84 c0 00 00 00    	je     802e7a <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  802dba:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802dbe:	0f 84 bf 00 00 00    	je     802e83 <pipe_splice+0x11a>
+  802dc4:	89 f7                	mov    %esi,%edi
+  802dc6:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  802dcc:	0f 85 ba 00 00 00    	jne    802e8c <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802dd2:	8d 43 04             	lea    0x4(%ebx),%eax
+  802dd5:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802dd8:	eb 38                	jmp    802e12 <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802dda:	83 ec 0c             	sub    $0xc,%esp
+  802ddd:	68 00 10 00 00       	push   $0x1000
+  802de2:	89 f1                	mov    %esi,%ecx
+  802de4:	89 da                	mov    %ebx,%edx
+  802de6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802de9:	e8 34 fa ff ff       	call   802822 <devpipe_write_bulk>
+  802dee:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802df1:	83 c4 10             	add    $0x10,%esp
+  802df4:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802df9:	75 53                	jne    802e4e <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  802dfb:	83 ec 08             	sub    $0x8,%esp
+  802dfe:	56                   	push   %esi
+  802dff:	6a 00                	push   $0x0
+  802e01:	e8 1b e0 ff ff       	call   800e21 <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  802e06:	83 c7 01             	add    $0x1,%edi
+  802e09:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802e0f:	83 c4 10             	add    $0x10,%esp
+  802e12:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802e15:	74 3a                	je     802e51 <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  802e17:	8b 03                	mov    (%ebx),%eax
+  802e19:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802e1c:	75 bc                	jne    802dda <pipe_splice+0x71>
+  802e1e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e23:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  802e27:	85 c0                	test   %eax,%eax
+  802e29:	74 af                	je     802dda <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802e2b:	83 ec 04             	sub    $0x4,%esp
+  802e2e:	6a 07                	push   $0x7
+  802e30:	56                   	push   %esi
+  802e31:	ff 75 d0             	push   -0x30(%ebp)
+  802e34:	e8 bf e2 ff ff       	call   8010f8 <sys_chan_wakeup>
+  802e39:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802e3c:	83 c4 10             	add    $0x10,%esp
+  802e3f:	85 c0                	test   %eax,%eax
+  802e41:	79 b8                	jns    802dfb <pipe_splice+0x92>
+  802e43:	b8 01 00 00 00       	mov    $0x1,%eax
+  802e48:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802e4c:	eb 8c                	jmp    802dda <pipe_splice+0x71>
+  802e4e:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  802e51:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802e55:	75 06                	jne    802e5d <pipe_splice+0xf4>
+  802e57:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802e5b:	78 09                	js     802e66 <pipe_splice+0xfd>
+  return i * PGSIZE;
+  802e5d:	8b 45 10             	mov    0x10(%ebp),%eax
+  802e60:	c1 e0 0c             	shl    $0xc,%eax
+  802e63:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  802e66:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802e69:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e6c:	5b                   	pop    %ebx
+  802e6d:	5e                   	pop    %esi
+  802e6e:	5f                   	pop    %edi
+  802e6f:	5d                   	pop    %ebp
+  802e70:	c3                   	ret
+    return -E_INVAL;
+  802e71:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802e78:	eb ec                	jmp    802e66 <pipe_splice+0xfd>
+  802e7a:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802e81:	eb e3                	jmp    802e66 <pipe_splice+0xfd>
+  802e83:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802e8a:	eb da                	jmp    802e66 <pipe_splice+0xfd>
+  802e8c:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802e93:	eb d1                	jmp    802e66 <pipe_splice+0xfd>
+
+00802e95 <pipe_splice_read>:
+{
+  802e95:	55                   	push   %ebp
+  802e96:	89 e5                	mov    %esp,%ebp
+  802e98:	53                   	push   %ebx
+  802e99:	83 ec 1c             	sub    $0x1c,%esp
+  802e9c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802e9f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802ea2:	50                   	push   %eax
+  802ea3:	ff 75 08             	push   0x8(%ebp)
+  802ea6:	e8 4e e8 ff ff       	call   8016f9 <fd_lookup>
+  802eab:	83 c4 10             	add    $0x10,%esp
+  802eae:	85 c0                	test   %eax,%eax
+  802eb0:	78 49                	js     802efb <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  802eb2:	83 ec 0c             	sub    $0xc,%esp
+  802eb5:	ff 75 f4             	push   -0xc(%ebp)
+  802eb8:	e8 d2 e7 ff ff       	call   80168f <fd2data>
+  802ebd:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802ebf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ec2:	83 c4 10             	add    $0x10,%esp
+  802ec5:	8b 0d 20 50 80 00    	mov    0x805020,%ecx
+  802ecb:	39 08                	cmp    %ecx,(%eax)
+  802ecd:	75 31                	jne    802f00 <pipe_splice_read+0x6b>
+  802ecf:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  802ed3:	74 32                	je     802f07 <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  802ed5:	8b 48 08             	mov    0x8(%eax),%ecx
+  802ed8:	83 e1 03             	and    $0x3,%ecx
+  802edb:	83 f9 01             	cmp    $0x1,%ecx
+  802ede:	74 2e                	je     802f0e <pipe_splice_read+0x79>
+  802ee0:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  802ee6:	75 2d                	jne    802f15 <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  802ee8:	83 ec 08             	sub    $0x8,%esp
+  802eeb:	53                   	push   %ebx
+  802eec:	68 00 10 00 00       	push   $0x1000
+  802ef1:	89 d9                	mov    %ebx,%ecx
+  802ef3:	e8 93 fa ff ff       	call   80298b <devpipe_read_bulk>
+  802ef8:	83 c4 10             	add    $0x10,%esp
+}
+  802efb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802efe:	c9                   	leave
+  802eff:	c3                   	ret
+    return -E_INVAL;
+  802f00:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802f05:	eb f4                	jmp    802efb <pipe_splice_read+0x66>
+  802f07:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802f0c:	eb ed                	jmp    802efb <pipe_splice_read+0x66>
+  802f0e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802f13:	eb e6                	jmp    802efb <pipe_splice_read+0x66>
+  802f15:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802f1a:	eb df                	jmp    802efb <pipe_splice_read+0x66>
+
+00802f1c <mmap_find>:
+          utf->utf_eip, utf->utf_err);
+}
+
+static struct Mmap *
+mmap_find(uintptr_t va)
+{
+  802f1c:	55                   	push   %ebp
+  802f1d:	89 e5                	mov    %esp,%ebp
+  802f1f:	56                   	push   %esi
+  802f20:	53                   	push   %ebx
+  int i;
+
+  for (i = 0; i < NMMAP; i++)
+  802f21:	ba 60 67 80 00       	mov    $0x806760,%edx
+  802f26:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f2b:	eb 0b                	jmp    802f38 <mmap_find+0x1c>
+  802f2d:	83 c3 01             	add    $0x1,%ebx
+  802f30:	83 c2 14             	add    $0x14,%edx
+  802f33:	83 fb 10             	cmp    $0x10,%ebx
+  802f36:	74 1d                	je     802f55 <mmap_find+0x39>
+    if (mmaps[i].mm_va && va >= mmaps[i].mm_va &&
+  802f38:	8b 0a                	mov    (%edx),%ecx
+  802f3a:	39 c8                	cmp    %ecx,%eax
+  802f3c:	72 ef                	jb     802f2d <mmap_find+0x11>
+  802f3e:	85 c9                	test   %ecx,%ecx
+  802f40:	74 eb                	je     802f2d <mmap_find+0x11>
+        va < mmaps[i].mm_va + mmaps[i].mm_len)
+  802f42:	03 4a 04             	add    0x4(%edx),%ecx
+    if (mmaps[i].mm_va && va >= mmaps[i].mm_va &&
+  802f45:	39 c8                	cmp    %ecx,%eax
+  802f47:	73 e4                	jae    802f2d <mmap_find+0x11>
+      return &mmaps[i];
+  802f49:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802f4c:	8d 04 85 60 67 80 00 	lea    0x806760(,%eax,4),%eax
+  802f53:	eb 05                	jmp    802f5a <mmap_find+0x3e>
+  return NULL;
+  802f55:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802f5a:	5b                   	pop    %ebx
+  802f5b:	5e                   	pop    %esi
+  802f5c:	5d                   	pop    %ebp
+  802f5d:	c3                   	ret
+
+00802f5e <va_mapped>:
+
+static bool
+va_mapped(uintptr_t va)
+{
+  return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+  802f5e:	89 c2                	mov    %eax,%edx
+  802f60:	c1 ea 16             	shr    $0x16,%edx
+  802f63:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802f6a:	f6 c2 01             	test   $0x1,%dl
+  802f6d:	74 11                	je     802f80 <va_mapped+0x22>
+  802f6f:	c1 e8 0c             	shr    $0xc,%eax
+  802f72:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802f79:	83 e0 01             	and    $0x1,%eax
+  802f7c:	83 e0 01             	and    $0x1,%eax
+}
+  802f7f:	c3                   	ret
+  return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+  802f80:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f85:	eb f5                	jmp    802f7c <va_mapped+0x1e>
+
+00802f87 <mmap_copy>:
+
+// Replace the page at 'va' with a copy of its first 'n' bytes, the rest
+// zeroed, mapped with 'perm'.
+static void
+mmap_copy(uintptr_t va, size_t n, int perm)
+{
+  802f87:	55                   	push   %ebp
+  802f88:	89 e5                	mov    %esp,%ebp
+  802f8a:	57                   	push   %edi
+  802f8b:	56                   	push   %esi
+  802f8c:	53                   	push   %ebx
+  802f8d:	83 ec 10             	sub    $0x10,%esp
+  802f90:	89 c3                	mov    %eax,%ebx
+  802f92:	89 d7                	mov    %edx,%edi
+  802f94:	89 ce                	mov    %ecx,%esi
+  int r;
+
+  if ((r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  802f96:	6a 07                	push   $0x7
+  802f98:	68 00 f0 7f 00       	push   $0x7ff000
+  802f9d:	6a 00                	push   $0x0
+  802f9f:	e8 f8 dd ff ff       	call   800d9c <sys_page_alloc>
+  802fa4:	83 c4 10             	add    $0x10,%esp
+  802fa7:	85 c0                	test   %eax,%eax
+  802fa9:	78 46                	js     802ff1 <mmap_copy+0x6a>
+    panic("mmap: %e", r);
+  memmove(PFTEMP, (void *) va, n);
+  802fab:	83 ec 04             	sub    $0x4,%esp
+  802fae:	57                   	push   %edi
+  802faf:	53                   	push   %ebx
+  802fb0:	68 00 f0 7f 00       	push   $0x7ff000
+  802fb5:	e8 39 db ff ff       	call   800af3 <memmove>
+  if ((r = sys_page_map(0, PFTEMP, 0, (void *) va, perm)) < 0 ||
+  802fba:	89 34 24             	mov    %esi,(%esp)
+  802fbd:	53                   	push   %ebx
+  802fbe:	6a 00                	push   $0x0
+  802fc0:	68 00 f0 7f 00       	push   $0x7ff000
+  802fc5:	6a 00                	push   $0x0
+  802fc7:	e8 13 de ff ff       	call   800ddf <sys_page_map>
+  802fcc:	83 c4 20             	add    $0x20,%esp
+  802fcf:	85 c0                	test   %eax,%eax
+  802fd1:	78 30                	js     803003 <mmap_copy+0x7c>
+      (r = sys_page_unmap(0, PFTEMP)) < 0)
+  802fd3:	83 ec 08             	sub    $0x8,%esp
+  802fd6:	68 00 f0 7f 00       	push   $0x7ff000
+  802fdb:	6a 00                	push   $0x0
+  802fdd:	e8 3f de ff ff       	call   800e21 <sys_page_unmap>
+  if ((r = sys_page_map(0, PFTEMP, 0, (void *) va, perm)) < 0 ||
+  802fe2:	83 c4 10             	add    $0x10,%esp
+  802fe5:	85 c0                	test   %eax,%eax
+  802fe7:	78 1a                	js     803003 <mmap_copy+0x7c>
+    panic("mmap: %e", r);
+}
+  802fe9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fec:	5b                   	pop    %ebx
+  802fed:	5e                   	pop    %esi
+  802fee:	5f                   	pop    %edi
+  802fef:	5d                   	pop    %ebp
+  802ff0:	c3                   	ret
+    panic("mmap: %e", r);
+  802ff1:	50                   	push   %eax
+  802ff2:	68 ee 40 80 00       	push   $0x8040ee
+  802ff7:	6a 3e                	push   $0x3e
+  802ff9:	68 f7 40 80 00       	push   $0x8040f7
+  802ffe:	e8 a1 d2 ff ff       	call   8002a4 <_panic>
+    panic("mmap: %e", r);
+  803003:	50                   	push   %eax
+  803004:	68 ee 40 80 00       	push   $0x8040ee
+  803009:	6a 42                	push   $0x42
+  80300b:	68 f7 40 80 00       	push   $0x8040f7
+  803010:	e8 8f d2 ff ff       	call   8002a4 <_panic>
+
+00803015 <mmap_fault>:
+// Handle a page fault in a mapping, if it is one.  Returns 1 if it was.
+// The fork page fault handlers call this first, so that mappings keep
+// working after a fork.
+bool
+mmap_fault(struct UTrapframe *utf)
+{
+  803015:	55                   	push   %ebp
+  803016:	89 e5                	mov    %esp,%ebp
+  803018:	57                   	push   %edi
+  803019:	56                   	push   %esi
+  80301a:	53                   	push   %ebx
+  80301b:	83 ec 1c             	sub    $0x1c,%esp
+  80301e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Fsreq_read_map saved;
+  struct Mmap *m;
+  uintptr_t va;
+  int perm, r;
+
+  va = ROUNDDOWN(utf->utf_fault_va, PGSIZE);
+  803021:	8b 1f                	mov    (%edi),%ebx
+  803023:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if (va < MMAPBASE || va >= MMAPTOP || (m = mmap_find(va)) == NULL)
+  803029:	8d 83 00 00 00 60    	lea    0x60000000(%ebx),%eax
+  80302f:	3d ff ff ff 2f       	cmp    $0x2fffffff,%eax
+  803034:	0f 87 24 01 00 00    	ja     80315e <mmap_fault+0x149>
+  80303a:	89 d8                	mov    %ebx,%eax
+  80303c:	e8 db fe ff ff       	call   802f1c <mmap_find>
+  803041:	89 c6                	mov    %eax,%esi
+  803043:	85 c0                	test   %eax,%eax
+  803045:	0f 84 20 01 00 00    	je     80316b <mmap_fault+0x156>
+    return 0;
+  if ((utf->utf_err & FEC_WR) && m->mm_perm == MAP_RDONLY)
+  80304b:	f6 47 04 02          	testb  $0x2,0x4(%edi)
+  80304f:	74 13                	je     803064 <mmap_fault+0x4f>
+  803051:	83 78 10 00          	cmpl   $0x0,0x10(%eax)
+  803055:	0f 84 17 01 00 00    	je     803172 <mmap_fault+0x15d>
+    return 0;
+  perm = PTE_P | PTE_U | (m->mm_perm == MAP_RDONLY ? 0 : PTE_W);
+  80305b:	c7 45 e4 07 00 00 00 	movl   $0x7,-0x1c(%ebp)
+  803062:	eb 0f                	jmp    803073 <mmap_fault+0x5e>
+  803064:	83 78 10 01          	cmpl   $0x1,0x10(%eax)
+  803068:	19 c0                	sbb    %eax,%eax
+  80306a:	83 e0 fe             	and    $0xfffffffe,%eax
+  80306d:	83 c0 07             	add    $0x7,%eax
+  803070:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+
+  if (!va_mapped(va)) {
+  803073:	89 d8                	mov    %ebx,%eax
+  803075:	e8 e4 fe ff ff       	call   802f5e <va_mapped>
+  80307a:	84 c0                	test   %al,%al
+  80307c:	74 42                	je     8030c0 <mmap_fault+0xab>
+    }
+  }
+
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+    mmap_copy(va, PGSIZE, perm);
+  return 1;
+  80307e:	b8 01 00 00 00       	mov    $0x1,%eax
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+  803083:	f6 47 04 02          	testb  $0x2,0x4(%edi)
+  803087:	0f 84 d6 00 00 00    	je     803163 <mmap_fault+0x14e>
+  80308d:	89 d8                	mov    %ebx,%eax
+  80308f:	c1 e8 0c             	shr    $0xc,%eax
+  803092:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  return 1;
+  803099:	b8 01 00 00 00       	mov    $0x1,%eax
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+  80309e:	f6 c2 02             	test   $0x2,%dl
+  8030a1:	0f 85 bc 00 00 00    	jne    803163 <mmap_fault+0x14e>
+    mmap_copy(va, PGSIZE, perm);
+  8030a7:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8030aa:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8030af:	89 d8                	mov    %ebx,%eax
+  8030b1:	e8 d1 fe ff ff       	call   802f87 <mmap_copy>
+  return 1;
+  8030b6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8030bb:	e9 a3 00 00 00       	jmp    803163 <mmap_fault+0x14e>
+    saved = fsipcbuf.read_map;
+  8030c0:	a1 00 70 80 00       	mov    0x807000,%eax
+  8030c5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8030c8:	8b 15 04 70 80 00    	mov    0x807004,%edx
+  8030ce:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    r = read_map(m->mm_fd, m->mm_offset + (va - m->mm_va), (void *) va);
+  8030d1:	83 ec 04             	sub    $0x4,%esp
+  8030d4:	53                   	push   %ebx
+  8030d5:	89 d8                	mov    %ebx,%eax
+  8030d7:	03 46 0c             	add    0xc(%esi),%eax
+  8030da:	2b 06                	sub    (%esi),%eax
+  8030dc:	50                   	push   %eax
+  8030dd:	ff 76 08             	push   0x8(%esi)
+  8030e0:	e8 86 f3 ff ff       	call   80246b <read_map>
+    fsipcbuf.read_map = saved;
+  8030e5:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8030e8:	89 0d 00 70 80 00    	mov    %ecx,0x807000
+  8030ee:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  8030f1:	89 15 04 70 80 00    	mov    %edx,0x807004
+    if (r < 0)
+  8030f7:	83 c4 10             	add    $0x10,%esp
+  8030fa:	85 c0                	test   %eax,%eax
+  8030fc:	78 20                	js     80311e <mmap_fault+0x109>
+    if (r == 0) {
+  8030fe:	74 30                	je     803130 <mmap_fault+0x11b>
+    if (r < PGSIZE) {
+  803100:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  803105:	0f 8f 73 ff ff ff    	jg     80307e <mmap_fault+0x69>
+      mmap_copy(va, r, perm);
+  80310b:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80310e:	89 c2                	mov    %eax,%edx
+  803110:	89 d8                	mov    %ebx,%eax
+  803112:	e8 70 fe ff ff       	call   802f87 <mmap_copy>
+      return 1;
+  803117:	b8 01 00 00 00       	mov    $0x1,%eax
+  80311c:	eb 45                	jmp    803163 <mmap_fault+0x14e>
+      panic("mmap: read_map: %e", r);
+  80311e:	50                   	push   %eax
+  80311f:	68 02 41 80 00       	push   $0x804102
+  803124:	6a 5f                	push   $0x5f
+  803126:	68 f7 40 80 00       	push   $0x8040f7
+  80312b:	e8 74 d1 ff ff       	call   8002a4 <_panic>
+      if ((r = sys_page_alloc(0, (void *) va, perm)) < 0)
+  803130:	83 ec 04             	sub    $0x4,%esp
+  803133:	ff 75 e4             	push   -0x1c(%ebp)
+  803136:	53                   	push   %ebx
+  803137:	6a 00                	push   $0x0
+  803139:	e8 5e dc ff ff       	call   800d9c <sys_page_alloc>
+  80313e:	83 c4 10             	add    $0x10,%esp
+  803141:	85 c0                	test   %eax,%eax
+  803143:	78 07                	js     80314c <mmap_fault+0x137>
+      return 1;
+  803145:	b8 01 00 00 00       	mov    $0x1,%eax
+  80314a:	eb 17                	jmp    803163 <mmap_fault+0x14e>
+        panic("mmap: %e", r);
+  80314c:	50                   	push   %eax
+  80314d:	68 ee 40 80 00       	push   $0x8040ee
+  803152:	6a 64                	push   $0x64
+  803154:	68 f7 40 80 00       	push   $0x8040f7
+  803159:	e8 46 d1 ff ff       	call   8002a4 <_panic>
+    return 0;
+  80315e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803163:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803166:	5b                   	pop    %ebx
+  803167:	5e                   	pop    %esi
+  803168:	5f                   	pop    %edi
+  803169:	5d                   	pop    %ebp
+  80316a:	c3                   	ret
+    return 0;
+  80316b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803170:	eb f1                	jmp    803163 <mmap_fault+0x14e>
+    return 0;
+  803172:	b8 00 00 00 00       	mov    $0x0,%eax
+  803177:	eb ea                	jmp    803163 <mmap_fault+0x14e>
+
+00803179 <mmap_pgfault>:
+{
+  803179:	55                   	push   %ebp
+  80317a:	89 e5                	mov    %esp,%ebp
+  80317c:	53                   	push   %ebx
+  80317d:	83 ec 10             	sub    $0x10,%esp
+  803180:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (!mmap_fault(utf))
+  803183:	53                   	push   %ebx
+  803184:	e8 8c fe ff ff       	call   803015 <mmap_fault>
+  803189:	83 c4 10             	add    $0x10,%esp
+  80318c:	84 c0                	test   %al,%al
+  80318e:	74 05                	je     803195 <mmap_pgfault+0x1c>
+}
+  803190:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803193:	c9                   	leave
+  803194:	c3                   	ret
+    panic("page fault at %08x, eip %08x, err %04x", utf->utf_fault_va,
+  803195:	83 ec 08             	sub    $0x8,%esp
+  803198:	ff 73 04             	push   0x4(%ebx)
+  80319b:	ff 73 28             	push   0x28(%ebx)
+  80319e:	ff 33                	push   (%ebx)
+  8031a0:	68 18 41 80 00       	push   $0x804118
+  8031a5:	6a 20                	push   $0x20
+  8031a7:	68 f7 40 80 00       	push   $0x8040f7
+  8031ac:	e8 f3 d0 ff ff       	call   8002a4 <_panic>
+
+008031b1 <mmap>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_INVAL if offset isn't aligned, len is 0, or perm is unknown
+//	-E_NO_MEM if there's no free slot or address space for it
+int
+mmap(int fdnum, off_t offset, size_t len, int perm, void **addr)
+{
+  8031b1:	55                   	push   %ebp
+  8031b2:	89 e5                	mov    %esp,%ebp
+  8031b4:	57                   	push   %edi
+  8031b5:	56                   	push   %esi
+  8031b6:	53                   	push   %ebx
+  8031b7:	83 ec 44             	sub    $0x44,%esp
+  8031ba:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  struct Fd *fd;
+  uintptr_t va;
+  int i, j, r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8031bd:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8031c0:	50                   	push   %eax
+  8031c1:	ff 75 08             	push   0x8(%ebp)
+  8031c4:	e8 30 e5 ff ff       	call   8016f9 <fd_lookup>
+  8031c9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8031cc:	83 c4 10             	add    $0x10,%esp
+  8031cf:	85 c0                	test   %eax,%eax
+  8031d1:	0f 88 3e 01 00 00    	js     803315 <mmap+0x164>
+    return r;
+  if (offset < 0 || PGOFF(offset) || len == 0 ||
+  8031d7:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8031db:	0f 88 d1 00 00 00    	js     8032b2 <mmap+0x101>
+  8031e1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8031e4:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8031e9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8031ec:	0f 85 c9 00 00 00    	jne    8032bb <mmap+0x10a>
+  8031f2:	85 db                	test   %ebx,%ebx
+  8031f4:	0f 84 ca 00 00 00    	je     8032c4 <mmap+0x113>
+  8031fa:	83 7d 14 02          	cmpl   $0x2,0x14(%ebp)
+  8031fe:	0f 87 c0 00 00 00    	ja     8032c4 <mmap+0x113>
+      (perm != MAP_RDONLY && perm != MAP_PRIVATE && perm != MAP_SHARED))
+    return -E_INVAL;
+  len = ROUNDUP(len, PGSIZE);
+  803204:	81 c3 ff 0f 00 00    	add    $0xfff,%ebx
+  80320a:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  803210:	89 d9                	mov    %ebx,%ecx
+  803212:	89 5d c4             	mov    %ebx,-0x3c(%ebp)
+
+  // First fit: try the start of the region and the end of each
+  // mapping.
+  for (i = -1; i < NMMAP; i++) {
+  803215:	bb 4c 67 80 00       	mov    $0x80674c,%ebx
+  80321a:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+    if (i >= 0 && !mmaps[i].mm_va)
+      continue;
+    va = i < 0 ? MMAPBASE : mmaps[i].mm_va + mmaps[i].mm_len;
+  80321f:	bf 00 00 00 a0       	mov    $0xa0000000,%edi
+  803224:	eb 53                	jmp    803279 <mmap+0xc8>
+  803226:	bf 00 00 00 a0       	mov    $0xa0000000,%edi
+  80322b:	eb 4c                	jmp    803279 <mmap+0xc8>
+    if (len > MMAPTOP - va)
+      continue;
+    for (j = 0; j < NMMAP; j++)
+  80322d:	83 c0 01             	add    $0x1,%eax
+  803230:	83 f8 10             	cmp    $0x10,%eax
+  803233:	0f 84 e7 00 00 00    	je     803320 <mmap+0x16f>
+      if (mmaps[j].mm_va && va < mmaps[j].mm_va + mmaps[j].mm_len &&
+  803239:	8d 34 80             	lea    (%eax,%eax,4),%esi
+  80323c:	8b 14 b5 60 67 80 00 	mov    0x806760(,%esi,4),%edx
+  803243:	85 d2                	test   %edx,%edx
+  803245:	74 e6                	je     80322d <mmap+0x7c>
+  803247:	89 d1                	mov    %edx,%ecx
+  803249:	03 0c b5 64 67 80 00 	add    0x806764(,%esi,4),%ecx
+  803250:	39 cf                	cmp    %ecx,%edi
+  803252:	73 d9                	jae    80322d <mmap+0x7c>
+  803254:	39 da                	cmp    %ebx,%edx
+  803256:	73 d5                	jae    80322d <mmap+0x7c>
+  803258:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80325b:	8b 55 cc             	mov    -0x34(%ebp),%edx
+  80325e:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  for (i = -1; i < NMMAP; i++) {
+  803261:	83 c2 01             	add    $0x1,%edx
+  803264:	83 c3 14             	add    $0x14,%ebx
+  803267:	83 fa 10             	cmp    $0x10,%edx
+  80326a:	74 2b                	je     803297 <mmap+0xe6>
+    if (i >= 0 && !mmaps[i].mm_va)
+  80326c:	85 d2                	test   %edx,%edx
+  80326e:	78 b6                	js     803226 <mmap+0x75>
+  803270:	8b 3b                	mov    (%ebx),%edi
+  803272:	85 ff                	test   %edi,%edi
+  803274:	74 eb                	je     803261 <mmap+0xb0>
+    va = i < 0 ? MMAPBASE : mmaps[i].mm_va + mmaps[i].mm_len;
+  803276:	03 7b 04             	add    0x4(%ebx),%edi
+    if (len > MMAPTOP - va)
+  803279:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80327e:	29 f8                	sub    %edi,%eax
+  803280:	39 c8                	cmp    %ecx,%eax
+  803282:	72 dd                	jb     803261 <mmap+0xb0>
+    for (j = 0; j < NMMAP; j++)
+  803284:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+          mmaps[j].mm_va < va + len)
+  803287:	8d 34 0f             	lea    (%edi,%ecx,1),%esi
+  80328a:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  80328d:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  803290:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+  803293:	89 f3                	mov    %esi,%ebx
+  803295:	eb a2                	jmp    803239 <mmap+0x88>
+        break;
+    if (j == NMMAP)
+      break;
+  }
+  if (i == NMMAP)
+    return -E_NO_MEM;
+  803297:	c7 45 d4 fc ff ff ff 	movl   $0xfffffffc,-0x2c(%ebp)
+  80329e:	eb 75                	jmp    803315 <mmap+0x164>
+    ;
+  if (j == NMMAP)
+    return -E_NO_MEM;
+
+  if (_pgfault_handler == 0)
+    set_pgfault_handler(mmap_pgfault);
+  8032a0:	83 ec 0c             	sub    $0xc,%esp
+  8032a3:	68 79 31 80 00       	push   $0x803179
+  8032a8:	e8 f7 03 00 00       	call   8036a4 <set_pgfault_handler>
+  8032ad:	83 c4 10             	add    $0x10,%esp
+  8032b0:	eb 24                	jmp    8032d6 <mmap+0x125>
+    return -E_INVAL;
+  8032b2:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  8032b9:	eb 5a                	jmp    803315 <mmap+0x164>
+  8032bb:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  8032c2:	eb 51                	jmp    803315 <mmap+0x164>
+  8032c4:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  8032cb:	eb 48                	jmp    803315 <mmap+0x164>
+  if (_pgfault_handler == 0)
+  8032cd:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  8032d4:	74 ca                	je     8032a0 <mmap+0xef>
+
+  mmaps[j].mm_va = va;
+  8032d6:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  8032dd:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  8032e0:	c1 e2 02             	shl    $0x2,%edx
+  8032e3:	89 ba 60 67 80 00    	mov    %edi,0x806760(%edx)
+  mmaps[j].mm_len = len;
+  8032e9:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  8032ec:	89 b2 64 67 80 00    	mov    %esi,0x806764(%edx)
+  mmaps[j].mm_fd = fdnum;
+  8032f2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8032f5:	89 b2 68 67 80 00    	mov    %esi,0x806768(%edx)
+  mmaps[j].mm_offset = offset;
+  8032fb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8032fe:	89 b2 6c 67 80 00    	mov    %esi,0x80676c(%edx)
+  mmaps[j].mm_perm = perm;
+  803304:	01 d8                	add    %ebx,%eax
+  803306:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  803309:	89 1c 85 70 67 80 00 	mov    %ebx,0x806770(,%eax,4)
+  *addr = (void *) va;
+  803310:	8b 45 18             	mov    0x18(%ebp),%eax
+  803313:	89 38                	mov    %edi,(%eax)
+  return 0;
+}
+  803315:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  803318:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80331b:	5b                   	pop    %ebx
+  80331c:	5e                   	pop    %esi
+  80331d:	5f                   	pop    %edi
+  80331e:	5d                   	pop    %ebp
+  80331f:	c3                   	ret
+  if (i == NMMAP)
+  803320:	b8 60 67 80 00       	mov    $0x806760,%eax
+  for (j = 0; j < NMMAP && mmaps[j].mm_va; j++)
+  803325:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+  803328:	83 c0 14             	add    $0x14,%eax
+  80332b:	83 78 ec 00          	cmpl   $0x0,-0x14(%eax)
+  80332f:	74 9c                	je     8032cd <mmap+0x11c>
+  803331:	83 c3 01             	add    $0x1,%ebx
+  803334:	83 fb 10             	cmp    $0x10,%ebx
+  803337:	75 ef                	jne    803328 <mmap+0x177>
+    return -E_NO_MEM;
+  803339:	c7 45 d4 fc ff ff ff 	movl   $0xfffffffc,-0x2c(%ebp)
+  803340:	eb d3                	jmp    803315 <mmap+0x164>
+
+00803342 <msync>:
+// nothing for other kinds of mapping.
+//
+// Returns 0 on success, < 0 on error.
+int
+msync(void *addr)
+{
+  803342:	55                   	push   %ebp
+  803343:	89 e5                	mov    %esp,%ebp
+  803345:	57                   	push   %edi
+  803346:	56                   	push   %esi
+  803347:	53                   	push   %ebx
+  803348:	81 ec ac 00 00 00    	sub    $0xac,%esp
+  struct Stat st;
+  off_t saved, off;
+  uintptr_t va;
+  int n, r;
+
+  if ((m = mmap_find((uintptr_t) addr)) == NULL)
+  80334e:	8b 45 08             	mov    0x8(%ebp),%eax
+  803351:	e8 c6 fb ff ff       	call   802f1c <mmap_find>
+  803356:	85 c0                	test   %eax,%eax
+  803358:	0f 84 58 01 00 00    	je     8034b6 <msync+0x174>
+  80335e:	89 c7                	mov    %eax,%edi
+    return -E_INVAL;
+  if (m->mm_perm != MAP_SHARED)
+    return 0;
+  803360:	bb 00 00 00 00       	mov    $0x0,%ebx
+  if (m->mm_perm != MAP_SHARED)
+  803365:	83 78 10 02          	cmpl   $0x2,0x10(%eax)
+  803369:	74 0a                	je     803375 <msync+0x33>
+                          PTE_P | PTE_U | PTE_W)) < 0)
+      break;
+  }
+  fd->fd_offset = saved;
+  return r < 0 ? r : 0;
+}
+  80336b:	89 d8                	mov    %ebx,%eax
+  80336d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803370:	5b                   	pop    %ebx
+  803371:	5e                   	pop    %esi
+  803372:	5f                   	pop    %edi
+  803373:	5d                   	pop    %ebp
+  803374:	c3                   	ret
+  if ((r = fd_lookup(m->mm_fd, &fd)) < 0 || (r = fstat(m->mm_fd, &st)) < 0)
+  803375:	83 ec 08             	sub    $0x8,%esp
+  803378:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80337b:	50                   	push   %eax
+  80337c:	ff 77 08             	push   0x8(%edi)
+  80337f:	e8 75 e3 ff ff       	call   8016f9 <fd_lookup>
+  803384:	89 c3                	mov    %eax,%ebx
+  803386:	83 c4 10             	add    $0x10,%esp
+  803389:	85 c0                	test   %eax,%eax
+  80338b:	78 de                	js     80336b <msync+0x29>
+  80338d:	83 ec 08             	sub    $0x8,%esp
+  803390:	8d 85 58 ff ff ff    	lea    -0xa8(%ebp),%eax
+  803396:	50                   	push   %eax
+  803397:	ff 77 08             	push   0x8(%edi)
+  80339a:	e8 fd e7 ff ff       	call   801b9c <fstat>
+  80339f:	89 c3                	mov    %eax,%ebx
+  8033a1:	83 c4 10             	add    $0x10,%esp
+  8033a4:	85 c0                	test   %eax,%eax
+  8033a6:	78 c3                	js     80336b <msync+0x29>
+  saved = fd->fd_offset;
+  8033a8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8033ab:	8b 40 04             	mov    0x4(%eax),%eax
+  8033ae:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%ebp)
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE) {
+  8033b4:	8b 37                	mov    (%edi),%esi
+  8033b6:	eb 29                	jmp    8033e1 <msync+0x9f>
+    if ((r = sys_page_map(0, (void *) va, 0, (void *) va,
+  8033b8:	83 ec 0c             	sub    $0xc,%esp
+  8033bb:	6a 07                	push   $0x7
+  8033bd:	8b 85 50 ff ff ff    	mov    -0xb0(%ebp),%eax
+  8033c3:	50                   	push   %eax
+  8033c4:	6a 00                	push   $0x0
+  8033c6:	50                   	push   %eax
+  8033c7:	6a 00                	push   $0x0
+  8033c9:	e8 11 da ff ff       	call   800ddf <sys_page_map>
+  8033ce:	89 c3                	mov    %eax,%ebx
+  8033d0:	83 c4 20             	add    $0x20,%esp
+  8033d3:	85 c0                	test   %eax,%eax
+  8033d5:	0f 88 c0 00 00 00    	js     80349b <msync+0x159>
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE) {
+  8033db:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8033e1:	8b 07                	mov    (%edi),%eax
+  8033e3:	89 85 54 ff ff ff    	mov    %eax,-0xac(%ebp)
+  8033e9:	03 47 04             	add    0x4(%edi),%eax
+  8033ec:	39 c6                	cmp    %eax,%esi
+  8033ee:	0f 83 a7 00 00 00    	jae    80349b <msync+0x159>
+    if (!va_mapped(va) || !(uvpt[PGNUM(va)] & PTE_D))
+  8033f4:	89 f0                	mov    %esi,%eax
+  8033f6:	e8 63 fb ff ff       	call   802f5e <va_mapped>
+  8033fb:	84 c0                	test   %al,%al
+  8033fd:	74 dc                	je     8033db <msync+0x99>
+  8033ff:	89 f0                	mov    %esi,%eax
+  803401:	c1 e8 0c             	shr    $0xc,%eax
+  803404:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80340b:	a8 40                	test   $0x40,%al
+  80340d:	74 cc                	je     8033db <msync+0x99>
+    off = m->mm_offset + (va - m->mm_va);
+  80340f:	8b 47 0c             	mov    0xc(%edi),%eax
+  803412:	8b 8d 54 ff ff ff    	mov    -0xac(%ebp),%ecx
+  803418:	29 c8                	sub    %ecx,%eax
+  80341a:	01 f0                	add    %esi,%eax
+    if (off >= st.st_size)
+  80341c:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80341f:	39 c2                	cmp    %eax,%edx
+  803421:	7e 78                	jle    80349b <msync+0x159>
+    n = MIN(PGSIZE, st.st_size - off);
+  803423:	29 c2                	sub    %eax,%edx
+  803425:	89 d1                	mov    %edx,%ecx
+  803427:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80342c:	39 d1                	cmp    %edx,%ecx
+  80342e:	0f 4e d1             	cmovle %ecx,%edx
+  803431:	89 95 54 ff ff ff    	mov    %edx,-0xac(%ebp)
+    if ((r = seek(m->mm_fd, off)) < 0 ||
+  803437:	83 ec 08             	sub    $0x8,%esp
+  80343a:	50                   	push   %eax
+  80343b:	ff 77 08             	push   0x8(%edi)
+  80343e:	e8 b1 e6 ff ff       	call   801af4 <seek>
+  803443:	89 c3                	mov    %eax,%ebx
+  803445:	83 c4 10             	add    $0x10,%esp
+  803448:	85 c0                	test   %eax,%eax
+  80344a:	78 4f                	js     80349b <msync+0x159>
+        (r = write(m->mm_fd, (void *) va, n)) < 0)
+  80344c:	89 b5 50 ff ff ff    	mov    %esi,-0xb0(%ebp)
+  803452:	83 ec 04             	sub    $0x4,%esp
+  803455:	ff b5 54 ff ff ff    	push   -0xac(%ebp)
+  80345b:	56                   	push   %esi
+  80345c:	ff 77 08             	push   0x8(%edi)
+  80345f:	e8 0e e6 ff ff       	call   801a72 <write>
+  803464:	89 c3                	mov    %eax,%ebx
+    if ((r = seek(m->mm_fd, off)) < 0 ||
+  803466:	83 c4 10             	add    $0x10,%esp
+  803469:	85 c0                	test   %eax,%eax
+  80346b:	78 2e                	js     80349b <msync+0x159>
+    if (r < n && (r = write(m->mm_fd, (char *) va + r, n - r)) < 0)
+  80346d:	8b 95 54 ff ff ff    	mov    -0xac(%ebp),%edx
+  803473:	39 c2                	cmp    %eax,%edx
+  803475:	0f 8e 3d ff ff ff    	jle    8033b8 <msync+0x76>
+  80347b:	89 d0                	mov    %edx,%eax
+  80347d:	29 d8                	sub    %ebx,%eax
+  80347f:	01 f3                	add    %esi,%ebx
+  803481:	83 ec 04             	sub    $0x4,%esp
+  803484:	50                   	push   %eax
+  803485:	53                   	push   %ebx
+  803486:	ff 77 08             	push   0x8(%edi)
+  803489:	e8 e4 e5 ff ff       	call   801a72 <write>
+  80348e:	89 c3                	mov    %eax,%ebx
+  803490:	83 c4 10             	add    $0x10,%esp
+  803493:	85 c0                	test   %eax,%eax
+  803495:	0f 89 1d ff ff ff    	jns    8033b8 <msync+0x76>
+  fd->fd_offset = saved;
+  80349b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80349e:	8b 8d 4c ff ff ff    	mov    -0xb4(%ebp),%ecx
+  8034a4:	89 48 04             	mov    %ecx,0x4(%eax)
+  return r < 0 ? r : 0;
+  8034a7:	85 db                	test   %ebx,%ebx
+  8034a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034ae:	0f 4f d8             	cmovg  %eax,%ebx
+  8034b1:	e9 b5 fe ff ff       	jmp    80336b <msync+0x29>
+    return -E_INVAL;
+  8034b6:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8034bb:	e9 ab fe ff ff       	jmp    80336b <msync+0x29>
+
+008034c0 <munmap>:
+// Remove the mapping at 'addr', writing a MAP_SHARED one back first.
+//
+// Returns 0 on success, < 0 on error.
+int
+munmap(void *addr)
+{
+  8034c0:	55                   	push   %ebp
+  8034c1:	89 e5                	mov    %esp,%ebp
+  8034c3:	56                   	push   %esi
+  8034c4:	53                   	push   %ebx
+  8034c5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct Mmap *m;
+  uintptr_t va;
+  int r;
+
+  if ((m = mmap_find((uintptr_t) addr)) == NULL)
+  8034c8:	89 d8                	mov    %ebx,%eax
+  8034ca:	e8 4d fa ff ff       	call   802f1c <mmap_find>
+  8034cf:	85 c0                	test   %eax,%eax
+  8034d1:	74 56                	je     803529 <munmap+0x69>
+  8034d3:	89 c6                	mov    %eax,%esi
+    return -E_INVAL;
+  if ((r = msync(addr)) < 0)
+  8034d5:	83 ec 0c             	sub    $0xc,%esp
+  8034d8:	53                   	push   %ebx
+  8034d9:	e8 64 fe ff ff       	call   803342 <msync>
+  8034de:	83 c4 10             	add    $0x10,%esp
+  8034e1:	85 c0                	test   %eax,%eax
+  8034e3:	78 3d                	js     803522 <munmap+0x62>
+    return r;
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE)
+  8034e5:	8b 1e                	mov    (%esi),%ebx
+  8034e7:	eb 06                	jmp    8034ef <munmap+0x2f>
+  8034e9:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8034ef:	8b 46 04             	mov    0x4(%esi),%eax
+  8034f2:	03 06                	add    (%esi),%eax
+  8034f4:	39 c3                	cmp    %eax,%ebx
+  8034f6:	73 1f                	jae    803517 <munmap+0x57>
+    if (va_mapped(va) && (r = sys_page_unmap(0, (void *) va)) < 0)
+  8034f8:	89 d8                	mov    %ebx,%eax
+  8034fa:	e8 5f fa ff ff       	call   802f5e <va_mapped>
+  8034ff:	84 c0                	test   %al,%al
+  803501:	74 e6                	je     8034e9 <munmap+0x29>
+  803503:	83 ec 08             	sub    $0x8,%esp
+  803506:	53                   	push   %ebx
+  803507:	6a 00                	push   $0x0
+  803509:	e8 13 d9 ff ff       	call   800e21 <sys_page_unmap>
+  80350e:	83 c4 10             	add    $0x10,%esp
+  803511:	85 c0                	test   %eax,%eax
+  803513:	79 d4                	jns    8034e9 <munmap+0x29>
+  803515:	eb 0b                	jmp    803522 <munmap+0x62>
+      return r;
+  m->mm_va = 0;
+  803517:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  return 0;
+  80351d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803522:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803525:	5b                   	pop    %ebx
+  803526:	5e                   	pop    %esi
+  803527:	5d                   	pop    %ebp
+  803528:	c3                   	ret
+    return -E_INVAL;
+  803529:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80352e:	eb f2                	jmp    803522 <munmap+0x62>
+
+00803530 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  803530:	b8 00 00 00 00       	mov    $0x0,%eax
+  803535:	c3                   	ret
+
+00803536 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803536:	55                   	push   %ebp
+  803537:	89 e5                	mov    %esp,%ebp
+  803539:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  80353c:	68 3f 41 80 00       	push   $0x80413f
+  803541:	ff 75 0c             	push   0xc(%ebp)
+  803544:	e8 24 d4 ff ff       	call   80096d <strcpy>
+  return 0;
+}
+  803549:	b8 00 00 00 00       	mov    $0x0,%eax
+  80354e:	c9                   	leave
+  80354f:	c3                   	ret
+
+00803550 <devcons_write>:
+{
+  803550:	55                   	push   %ebp
+  803551:	89 e5                	mov    %esp,%ebp
+  803553:	57                   	push   %edi
+  803554:	56                   	push   %esi
+  803555:	53                   	push   %ebx
+  803556:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  80355c:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  803561:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  803567:	eb 2e                	jmp    803597 <devcons_write+0x47>
+    m = n - tot;
+  803569:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80356c:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  80356e:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803573:	39 c3                	cmp    %eax,%ebx
+  803575:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  803578:	83 ec 04             	sub    $0x4,%esp
+  80357b:	53                   	push   %ebx
+  80357c:	89 f0                	mov    %esi,%eax
+  80357e:	03 45 0c             	add    0xc(%ebp),%eax
+  803581:	50                   	push   %eax
+  803582:	57                   	push   %edi
+  803583:	e8 6b d5 ff ff       	call   800af3 <memmove>
+    sys_cputs(buf, m);
+  803588:	83 c4 08             	add    $0x8,%esp
+  80358b:	53                   	push   %ebx
+  80358c:	57                   	push   %edi
+  80358d:	e8 0b d7 ff ff       	call   800c9d <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  803592:	01 de                	add    %ebx,%esi
+  803594:	83 c4 10             	add    $0x10,%esp
+  803597:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80359a:	72 cd                	jb     803569 <devcons_write+0x19>
+}
+  80359c:	89 f0                	mov    %esi,%eax
+  80359e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8035a1:	5b                   	pop    %ebx
+  8035a2:	5e                   	pop    %esi
+  8035a3:	5f                   	pop    %edi
+  8035a4:	5d                   	pop    %ebp
+  8035a5:	c3                   	ret
+
+008035a6 <devcons_read>:
+{
+  8035a6:	55                   	push   %ebp
+  8035a7:	89 e5                	mov    %esp,%ebp
+  8035a9:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  8035ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035b1:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8035b5:	75 07                	jne    8035be <devcons_read+0x18>
+  8035b7:	eb 1f                	jmp    8035d8 <devcons_read+0x32>
+    sys_yield();
+  8035b9:	e8 7c d7 ff ff       	call   800d3a <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  8035be:	e8 f8 d6 ff ff       	call   800cbb <sys_cgetc>
+  8035c3:	85 c0                	test   %eax,%eax
+  8035c5:	74 f2                	je     8035b9 <devcons_read+0x13>
+  if (c < 0)
+  8035c7:	78 0f                	js     8035d8 <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  8035c9:	83 f8 04             	cmp    $0x4,%eax
+  8035cc:	74 0c                	je     8035da <devcons_read+0x34>
+  *(char*)vbuf = c;
+  8035ce:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8035d1:	88 02                	mov    %al,(%edx)
+  return 1;
+  8035d3:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8035d8:	c9                   	leave
+  8035d9:	c3                   	ret
+    return 0;
+  8035da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035df:	eb f7                	jmp    8035d8 <devcons_read+0x32>
+
+008035e1 <cputchar>:
+{
+  8035e1:	55                   	push   %ebp
+  8035e2:	89 e5                	mov    %esp,%ebp
+  8035e4:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  8035e7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035ea:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  8035ed:	6a 01                	push   $0x1
+  8035ef:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8035f2:	50                   	push   %eax
+  8035f3:	e8 a5 d6 ff ff       	call   800c9d <sys_cputs>
+}
+  8035f8:	83 c4 10             	add    $0x10,%esp
+  8035fb:	c9                   	leave
+  8035fc:	c3                   	ret
+
+008035fd <getchar>:
+{
+  8035fd:	55                   	push   %ebp
+  8035fe:	89 e5                	mov    %esp,%ebp
+  803600:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  803603:	6a 01                	push   $0x1
+  803605:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803608:	50                   	push   %eax
+  803609:	6a 00                	push   $0x0
+  80360b:	e8 94 e3 ff ff       	call   8019a4 <read>
+  if (r < 0)
+  803610:	83 c4 10             	add    $0x10,%esp
+  803613:	85 c0                	test   %eax,%eax
+  803615:	78 06                	js     80361d <getchar+0x20>
+  if (r < 1)
+  803617:	74 06                	je     80361f <getchar+0x22>
+  return c;
+  803619:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80361d:	c9                   	leave
+  80361e:	c3                   	ret
+    return -E_EOF;
+  80361f:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803624:	eb f7                	jmp    80361d <getchar+0x20>
+
+00803626 <iscons>:
+{
+  803626:	55                   	push   %ebp
+  803627:	89 e5                	mov    %esp,%ebp
+  803629:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80362c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80362f:	50                   	push   %eax
+  803630:	ff 75 08             	push   0x8(%ebp)
+  803633:	e8 c1 e0 ff ff       	call   8016f9 <fd_lookup>
+  803638:	83 c4 10             	add    $0x10,%esp
+  80363b:	85 c0                	test   %eax,%eax
+  80363d:	78 11                	js     803650 <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  80363f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803642:	8b 15 3c 50 80 00    	mov    0x80503c,%edx
+  803648:	39 10                	cmp    %edx,(%eax)
+  80364a:	0f 94 c0             	sete   %al
+  80364d:	0f b6 c0             	movzbl %al,%eax
+}
+  803650:	c9                   	leave
+  803651:	c3                   	ret
+
+00803652 <opencons>:
+{
+  803652:	55                   	push   %ebp
+  803653:	89 e5                	mov    %esp,%ebp
+  803655:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  803658:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80365b:	50                   	push   %eax
+  80365c:	e8 42 e0 ff ff       	call   8016a3 <fd_alloc>
+  803661:	83 c4 10             	add    $0x10,%esp
+  803664:	85 c0                	test   %eax,%eax
+  803666:	78 3a                	js     8036a2 <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803668:	83 ec 04             	sub    $0x4,%esp
+  80366b:	68 07 04 00 00       	push   $0x407
+  803670:	ff 75 f4             	push   -0xc(%ebp)
+  803673:	6a 00                	push   $0x0
+  803675:	e8 22 d7 ff ff       	call   800d9c <sys_page_alloc>
+  80367a:	83 c4 10             	add    $0x10,%esp
+  80367d:	85 c0                	test   %eax,%eax
+  80367f:	78 21                	js     8036a2 <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  803681:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803684:	8b 15 3c 50 80 00    	mov    0x80503c,%edx
+  80368a:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  80368c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80368f:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  803696:	83 ec 0c             	sub    $0xc,%esp
+  803699:	50                   	push   %eax
+  80369a:	e8 e0 df ff ff       	call   80167f <fd2num>
+  80369f:	83 c4 10             	add    $0x10,%esp
+}
+  8036a2:	c9                   	leave
+  8036a3:	c3                   	ret
+
+008036a4 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  8036a4:	55                   	push   %ebp
+  8036a5:	89 e5                	mov    %esp,%ebp
+  8036a7:	53                   	push   %ebx
+  8036a8:	83 ec 04             	sub    $0x4,%esp
+  int r;
+
+  if (_pgfault_handler == 0) {
+  8036ab:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  8036b2:	74 0d                	je     8036c1 <set_pgfault_handler+0x1d>
+
+    sys_env_set_pgfault_upcall(id, _pgfault_upcall);
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  8036b4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8036b7:	a3 00 80 80 00       	mov    %eax,0x808000
+}
+  8036bc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8036bf:	c9                   	leave
+  8036c0:	c3                   	ret
+    envid_t id = sys_getenvid();
+  8036c1:	e8 55 d6 ff ff       	call   800d1b <sys_getenvid>
+  8036c6:	89 c3                	mov    %eax,%ebx
+    sys_page_alloc(id, (void *) (UXSTACKTOP - PGSIZE), (PTE_P | PTE_U | PTE_W));
+  8036c8:	83 ec 04             	sub    $0x4,%esp
+  8036cb:	6a 07                	push   $0x7
+  8036cd:	68 00 f0 bf ee       	push   $0xeebff000
+  8036d2:	50                   	push   %eax
+  8036d3:	e8 c4 d6 ff ff       	call   800d9c <sys_page_alloc>
+    sys_env_set_pgfault_upcall(id, _pgfault_upcall);
+  8036d8:	83 c4 08             	add    $0x8,%esp
+  8036db:	68 eb 36 80 00       	push   $0x8036eb
+  8036e0:	53                   	push   %ebx
+  8036e1:	e8 2b d9 ff ff       	call   801011 <sys_env_set_pgfault_upcall>
+  8036e6:	83 c4 10             	add    $0x10,%esp
+  8036e9:	eb c9                	jmp    8036b4 <set_pgfault_handler+0x10>
+
+008036eb <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8036eb:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8036ec:	a1 00 80 80 00       	mov    0x808000,%eax
+	call *%eax
+  8036f1:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8036f3:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+  movl 48(%esp), %eax       // move trap time esp to eax
+  8036f6:	8b 44 24 30          	mov    0x30(%esp),%eax
+  subl $4, %eax             // make room for eip on trap time esp
+  8036fa:	83 e8 04             	sub    $0x4,%eax
+  movl %eax, 48(%esp)       // move value to esp
+  8036fd:	89 44 24 30          	mov    %eax,0x30(%esp)
+  movl 40(%esp), %ebx       // move trap time eip to ebx
+  803701:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+  movl %ebx, 0(%eax)
+  803705:	89 18                	mov    %ebx,(%eax)
+
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+  addl $0x08,%esp
+  803707:	83 c4 08             	add    $0x8,%esp
+  popal
+  80370a:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+  addl $4, %esp          // skip tf->eip
+  80370b:	83 c4 04             	add    $0x4,%esp
+  popf                 // pop stack value into flags register
+  80370e:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+  popl %esp
+  80370f:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+  ret
+  803710:	c3                   	ret
+
+00803711 <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  803711:	55                   	push   %ebp
+  803712:	89 e5                	mov    %esp,%ebp
+  803714:	57                   	push   %edi
+  803715:	56                   	push   %esi
+  803716:	53                   	push   %ebx
+  803717:	83 ec 14             	sub    $0x14,%esp
+  80371a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80371d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803720:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803723:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  803726:	85 c0                	test   %eax,%eax
+  803728:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80372d:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  803730:	ff 33                	push   (%ebx)
+  803732:	50                   	push   %eax
+  803733:	e8 3c d9 ff ff       	call   801074 <sys_ipc_recv>
+  803738:	83 c4 10             	add    $0x10,%esp
+  80373b:	85 c0                	test   %eax,%eax
+  80373d:	78 39                	js     803778 <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  80373f:	85 ff                	test   %edi,%edi
+  803741:	74 0a                	je     80374d <ipc_recv_pages+0x3c>
+  803743:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  803748:	8b 40 7c             	mov    0x7c(%eax),%eax
+  80374b:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  80374d:	85 f6                	test   %esi,%esi
+  80374f:	74 0d                	je     80375e <ipc_recv_pages+0x4d>
+  803751:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  803756:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  80375c:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  80375e:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  803763:	8b 40 74             	mov    0x74(%eax),%eax
+  803766:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  803768:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  80376d:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  803770:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803773:	5b                   	pop    %ebx
+  803774:	5e                   	pop    %esi
+  803775:	5f                   	pop    %edi
+  803776:	5d                   	pop    %ebp
+  803777:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  803778:	85 ff                	test   %edi,%edi
+  80377a:	74 06                	je     803782 <ipc_recv_pages+0x71>
+  80377c:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  803782:	85 f6                	test   %esi,%esi
+  803784:	74 06                	je     80378c <ipc_recv_pages+0x7b>
+  803786:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  80378c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  803792:	eb dc                	jmp    803770 <ipc_recv_pages+0x5f>
+
+00803794 <ipc_recv>:
+{
+  803794:	55                   	push   %ebp
+  803795:	89 e5                	mov    %esp,%ebp
+  803797:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  80379a:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  8037a1:	ff 75 10             	push   0x10(%ebp)
+  8037a4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8037a7:	50                   	push   %eax
+  8037a8:	ff 75 0c             	push   0xc(%ebp)
+  8037ab:	ff 75 08             	push   0x8(%ebp)
+  8037ae:	e8 5e ff ff ff       	call   803711 <ipc_recv_pages>
+}
+  8037b3:	c9                   	leave
+  8037b4:	c3                   	ret
+
+008037b5 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  8037b5:	55                   	push   %ebp
+  8037b6:	89 e5                	mov    %esp,%ebp
+  8037b8:	57                   	push   %edi
+  8037b9:	56                   	push   %esi
+  8037ba:	53                   	push   %ebx
+  8037bb:	83 ec 0c             	sub    $0xc,%esp
+  8037be:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8037c1:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8037c4:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  8037c7:	89 c3                	mov    %eax,%ebx
+  8037c9:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  8037cf:	85 c0                	test   %eax,%eax
+  8037d1:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8037d6:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  8037d9:	83 ec 0c             	sub    $0xc,%esp
+  8037dc:	ff 75 14             	push   0x14(%ebp)
+  8037df:	ff 75 18             	push   0x18(%ebp)
+  8037e2:	53                   	push   %ebx
+  8037e3:	56                   	push   %esi
+  8037e4:	57                   	push   %edi
+  8037e5:	e8 69 d8 ff ff       	call   801053 <sys_ipc_try_send>
+  8037ea:	83 c4 20             	add    $0x20,%esp
+  8037ed:	85 c0                	test   %eax,%eax
+  8037ef:	79 1e                	jns    80380f <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  8037f1:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8037f4:	75 07                	jne    8037fd <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  8037f6:	e8 3f d5 ff ff       	call   800d3a <sys_yield>
+  8037fb:	eb dc                	jmp    8037d9 <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  8037fd:	50                   	push   %eax
+  8037fe:	68 4b 41 80 00       	push   $0x80414b
+  803803:	6a 5c                	push   $0x5c
+  803805:	68 58 41 80 00       	push   $0x804158
+  80380a:	e8 95 ca ff ff       	call   8002a4 <_panic>
+  }
+}
+  80380f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803812:	5b                   	pop    %ebx
+  803813:	5e                   	pop    %esi
+  803814:	5f                   	pop    %edi
+  803815:	5d                   	pop    %ebp
+  803816:	c3                   	ret
+
+00803817 <ipc_send>:
+{
+  803817:	55                   	push   %ebp
+  803818:	89 e5                	mov    %esp,%ebp
+  80381a:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  80381d:	ff 75 14             	push   0x14(%ebp)
+  803820:	6a 01                	push   $0x1
+  803822:	ff 75 10             	push   0x10(%ebp)
+  803825:	ff 75 0c             	push   0xc(%ebp)
+  803828:	ff 75 08             	push   0x8(%ebp)
+  80382b:	e8 85 ff ff ff       	call   8037b5 <ipc_send_pages>
+}
+  803830:	83 c4 20             	add    $0x20,%esp
+  803833:	c9                   	leave
+  803834:	c3                   	ret
+
+00803835 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803835:	55                   	push   %ebp
+  803836:	89 e5                	mov    %esp,%ebp
+  803838:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  80383b:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  803840:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803843:	c1 e0 04             	shl    $0x4,%eax
+  803846:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80384b:	8b 40 50             	mov    0x50(%eax),%eax
+  80384e:	39 c8                	cmp    %ecx,%eax
+  803850:	74 12                	je     803864 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  803852:	83 c2 01             	add    $0x1,%edx
+  803855:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  80385b:	75 e3                	jne    803840 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  80385d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803862:	eb 0e                	jmp    803872 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  803864:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803867:	c1 e0 04             	shl    $0x4,%eax
+  80386a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80386f:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803872:	5d                   	pop    %ebp
+  803873:	c3                   	ret
+
+00803874 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803874:	55                   	push   %ebp
+  803875:	89 e5                	mov    %esp,%ebp
+  803877:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  80387a:	89 c2                	mov    %eax,%edx
+  80387c:	c1 ea 16             	shr    $0x16,%edx
+  80387f:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  803886:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  80388b:	f6 c1 01             	test   $0x1,%cl
+  80388e:	74 1c                	je     8038ac <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  803890:	c1 e8 0c             	shr    $0xc,%eax
+  803893:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  80389a:	a8 01                	test   $0x1,%al
+  80389c:	74 0e                	je     8038ac <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  80389e:	c1 e8 0c             	shr    $0xc,%eax
+  8038a1:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  8038a8:	ef 
+  8038a9:	0f b7 d2             	movzwl %dx,%edx
+}
+  8038ac:	89 d0                	mov    %edx,%eax
+  8038ae:	5d                   	pop    %ebp
+  8038af:	c3                   	ret
+
+008038b0 <udivmod>:
+  8038b0:	55                   	push   %ebp
+  8038b1:	57                   	push   %edi
+  8038b2:	56                   	push   %esi
+  8038b3:	53                   	push   %ebx
+  8038b4:	83 ec 14             	sub    $0x14,%esp
+  8038b7:	8b 74 24 28          	mov    0x28(%esp),%esi
+  8038bb:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  8038bf:	89 fb                	mov    %edi,%ebx
+  8038c1:	09 f3                	or     %esi,%ebx
+  8038c3:	0f 84 88 00 00 00    	je     803951 <udivmod+0xa1>
+  8038c9:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8038ce:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8038d5:	00 
+  8038d6:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8038dd:	00 
+  8038de:	89 cd                	mov    %ecx,%ebp
+  8038e0:	89 34 24             	mov    %esi,(%esp)
+  8038e3:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  8038e7:	eb 08                	jmp    8038f1 <udivmod+0x41>
+  8038e9:	83 ed 01             	sub    $0x1,%ebp
+  8038ec:	83 fd ff             	cmp    $0xffffffff,%ebp
+  8038ef:	74 6c                	je     80395d <udivmod+0xad>
+  8038f1:	89 c3                	mov    %eax,%ebx
+  8038f3:	89 d6                	mov    %edx,%esi
+  8038f5:	89 e9                	mov    %ebp,%ecx
+  8038f7:	0f ad f3             	shrd   %cl,%esi,%ebx
+  8038fa:	d3 ee                	shr    %cl,%esi
+  8038fc:	f6 c1 20             	test   $0x20,%cl
+  8038ff:	74 04                	je     803905 <udivmod+0x55>
+  803901:	89 f3                	mov    %esi,%ebx
+  803903:	31 f6                	xor    %esi,%esi
+  803905:	8b 3c 24             	mov    (%esp),%edi
+  803908:	39 fb                	cmp    %edi,%ebx
+  80390a:	89 f7                	mov    %esi,%edi
+  80390c:	8b 1c 24             	mov    (%esp),%ebx
+  80390f:	8b 74 24 04          	mov    0x4(%esp),%esi
+  803913:	19 f7                	sbb    %esi,%edi
+  803915:	72 d2                	jb     8038e9 <udivmod+0x39>
+  803917:	89 f7                	mov    %esi,%edi
+  803919:	89 de                	mov    %ebx,%esi
+  80391b:	89 e9                	mov    %ebp,%ecx
+  80391d:	0f a5 f7             	shld   %cl,%esi,%edi
+  803920:	d3 e6                	shl    %cl,%esi
+  803922:	f6 c1 20             	test   $0x20,%cl
+  803925:	74 04                	je     80392b <udivmod+0x7b>
+  803927:	89 f7                	mov    %esi,%edi
+  803929:	31 f6                	xor    %esi,%esi
+  80392b:	29 f0                	sub    %esi,%eax
+  80392d:	19 fa                	sbb    %edi,%edx
+  80392f:	be 01 00 00 00       	mov    $0x1,%esi
+  803934:	bf 00 00 00 00       	mov    $0x0,%edi
+  803939:	0f a5 f7             	shld   %cl,%esi,%edi
+  80393c:	d3 e6                	shl    %cl,%esi
+  80393e:	f6 c1 20             	test   $0x20,%cl
+  803941:	74 04                	je     803947 <udivmod+0x97>
+  803943:	89 f7                	mov    %esi,%edi
+  803945:	31 f6                	xor    %esi,%esi
+  803947:	09 74 24 08          	or     %esi,0x8(%esp)
+  80394b:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  80394f:	eb 98                	jmp    8038e9 <udivmod+0x39>
+  803951:	89 f0                	mov    %esi,%eax
+  803953:	89 fa                	mov    %edi,%edx
+  803955:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803959:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  80395d:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  803961:	89 01                	mov    %eax,(%ecx)
+  803963:	89 51 04             	mov    %edx,0x4(%ecx)
+  803966:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80396a:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  80396e:	83 c4 14             	add    $0x14,%esp
+  803971:	5b                   	pop    %ebx
+  803972:	5e                   	pop    %esi
+  803973:	5f                   	pop    %edi
+  803974:	5d                   	pop    %ebp
+  803975:	c3                   	ret
+
+00803976 <__udivdi3>:
+  803976:	83 ec 18             	sub    $0x18,%esp
+  803979:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80397d:	50                   	push   %eax
+  80397e:	ff 74 24 2c          	push   0x2c(%esp)
+  803982:	ff 74 24 2c          	push   0x2c(%esp)
+  803986:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80398a:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80398e:	e8 1d ff ff ff       	call   8038b0 <udivmod>
+  803993:	83 c4 24             	add    $0x24,%esp
+  803996:	c3                   	ret
+
+00803997 <__umoddi3>:
+  803997:	83 ec 18             	sub    $0x18,%esp
+  80399a:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80399e:	50                   	push   %eax
+  80399f:	ff 74 24 2c          	push   0x2c(%esp)
+  8039a3:	ff 74 24 2c          	push   0x2c(%esp)
+  8039a7:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8039ab:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8039af:	e8 fc fe ff ff       	call   8038b0 <udivmod>
+  8039b4:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8039b8:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8039bc:	83 c4 24             	add    $0x24,%esp
+  8039bf:	c3                   	ret
+
+008039c0 <__divdi3>:
+  8039c0:	56                   	push   %esi
+  8039c1:	53                   	push   %ebx
+  8039c2:	83 ec 14             	sub    $0x14,%esp
+  8039c5:	8b 44 24 20          	mov    0x20(%esp),%eax
+  8039c9:	8b 54 24 24          	mov    0x24(%esp),%edx
+  8039cd:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  8039d1:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  8039d5:	85 d2                	test   %edx,%edx
+  8039d7:	78 18                	js     8039f1 <__divdi3+0x31>
+  8039d9:	85 db                	test   %ebx,%ebx
+  8039db:	78 3e                	js     803a1b <__divdi3+0x5b>
+  8039dd:	83 ec 04             	sub    $0x4,%esp
+  8039e0:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8039e4:	56                   	push   %esi
+  8039e5:	53                   	push   %ebx
+  8039e6:	51                   	push   %ecx
+  8039e7:	e8 c4 fe ff ff       	call   8038b0 <udivmod>
+  8039ec:	83 c4 10             	add    $0x10,%esp
+  8039ef:	eb 24                	jmp    803a15 <__divdi3+0x55>
+  8039f1:	f7 d8                	neg    %eax
+  8039f3:	83 d2 00             	adc    $0x0,%edx
+  8039f6:	f7 da                	neg    %edx
+  8039f8:	85 db                	test   %ebx,%ebx
+  8039fa:	78 3a                	js     803a36 <__divdi3+0x76>
+  8039fc:	83 ec 04             	sub    $0x4,%esp
+  8039ff:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803a03:	56                   	push   %esi
+  803a04:	53                   	push   %ebx
+  803a05:	51                   	push   %ecx
+  803a06:	e8 a5 fe ff ff       	call   8038b0 <udivmod>
+  803a0b:	83 c4 10             	add    $0x10,%esp
+  803a0e:	f7 d8                	neg    %eax
+  803a10:	83 d2 00             	adc    $0x0,%edx
+  803a13:	f7 da                	neg    %edx
+  803a15:	83 c4 14             	add    $0x14,%esp
+  803a18:	5b                   	pop    %ebx
+  803a19:	5e                   	pop    %esi
+  803a1a:	c3                   	ret
+  803a1b:	83 ec 04             	sub    $0x4,%esp
+  803a1e:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803a22:	56                   	push   %esi
+  803a23:	f7 d9                	neg    %ecx
+  803a25:	83 d3 00             	adc    $0x0,%ebx
+  803a28:	f7 db                	neg    %ebx
+  803a2a:	53                   	push   %ebx
+  803a2b:	51                   	push   %ecx
+  803a2c:	e8 7f fe ff ff       	call   8038b0 <udivmod>
+  803a31:	83 c4 10             	add    $0x10,%esp
+  803a34:	eb d8                	jmp    803a0e <__divdi3+0x4e>
+  803a36:	83 ec 04             	sub    $0x4,%esp
+  803a39:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803a3d:	56                   	push   %esi
+  803a3e:	f7 d9                	neg    %ecx
+  803a40:	83 d3 00             	adc    $0x0,%ebx
+  803a43:	f7 db                	neg    %ebx
+  803a45:	53                   	push   %ebx
+  803a46:	51                   	push   %ecx
+  803a47:	e8 64 fe ff ff       	call   8038b0 <udivmod>
+  803a4c:	83 c4 10             	add    $0x10,%esp
+  803a4f:	eb c4                	jmp    803a15 <__divdi3+0x55>
+
+00803a51 <__moddi3>:
+  803a51:	55                   	push   %ebp
+  803a52:	57                   	push   %edi
+  803a53:	56                   	push   %esi
+  803a54:	53                   	push   %ebx
+  803a55:	83 ec 24             	sub    $0x24,%esp
+  803a58:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803a5c:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803a60:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  803a64:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  803a68:	85 d2                	test   %edx,%edx
+  803a6a:	78 3b                	js     803aa7 <__moddi3+0x56>
+  803a6c:	83 ec 04             	sub    $0x4,%esp
+  803a6f:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803a73:	56                   	push   %esi
+  803a74:	89 ce                	mov    %ecx,%esi
+  803a76:	f7 de                	neg    %esi
+  803a78:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803a7c:	89 de                	mov    %ebx,%esi
+  803a7e:	83 d6 00             	adc    $0x0,%esi
+  803a81:	f7 de                	neg    %esi
+  803a83:	89 74 24 14          	mov    %esi,0x14(%esp)
+  803a87:	8b 74 24 08          	mov    0x8(%esp),%esi
+  803a8b:	0f 48 f1             	cmovs  %ecx,%esi
+  803a8e:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  803a93:	53                   	push   %ebx
+  803a94:	56                   	push   %esi
+  803a95:	e8 16 fe ff ff       	call   8038b0 <udivmod>
+  803a9a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803a9e:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803aa2:	83 c4 10             	add    $0x10,%esp
+  803aa5:	eb 47                	jmp    803aee <__moddi3+0x9d>
+  803aa7:	f7 d8                	neg    %eax
+  803aa9:	83 d2 00             	adc    $0x0,%edx
+  803aac:	f7 da                	neg    %edx
+  803aae:	83 ec 04             	sub    $0x4,%esp
+  803ab1:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803ab5:	56                   	push   %esi
+  803ab6:	89 cf                	mov    %ecx,%edi
+  803ab8:	f7 df                	neg    %edi
+  803aba:	89 de                	mov    %ebx,%esi
+  803abc:	83 d6 00             	adc    $0x0,%esi
+  803abf:	f7 de                	neg    %esi
+  803ac1:	0f 49 cf             	cmovns %edi,%ecx
+  803ac4:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  803ac8:	0f 49 de             	cmovns %esi,%ebx
+  803acb:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  803acf:	ff 74 24 0c          	push   0xc(%esp)
+  803ad3:	ff 74 24 0c          	push   0xc(%esp)
+  803ad7:	e8 d4 fd ff ff       	call   8038b0 <udivmod>
+  803adc:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803ae0:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803ae4:	f7 d8                	neg    %eax
+  803ae6:	83 d2 00             	adc    $0x0,%edx
+  803ae9:	f7 da                	neg    %edx
+  803aeb:	83 c4 10             	add    $0x10,%esp
+  803aee:	83 c4 24             	add    $0x24,%esp
+  803af1:	5b                   	pop    %ebx
+  803af2:	5e                   	pop    %esi
+  803af3:	5f                   	pop    %edi
+  803af4:	5d                   	pop    %ebp
+  803af5:	c3                   	ret
@@ -0,0 +1,6746 @@
+
+obj/user/randbench.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 00 04 00 00       	call   800431 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <run>:
+  return seed >> 8;
+}
+
+static void
+run(const char *name, int sched, bool hint, int fd, int nread, off_t size)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	81 ec e8 00 00 00    	sub    $0xe8,%esp
+  80003f:	89 85 20 ff ff ff    	mov    %eax,-0xe0(%ebp)
+  800045:	8b 75 08             	mov    0x8(%ebp),%esi
+  800048:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80004b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80004e:	88 8d 27 ff ff ff    	mov    %cl,-0xd9(%ebp)
+  struct Fsret_stats before, after;
+  unsigned ms;
+  int i, round, r;
+
+  if ((r = fs_set_sched(sched)) < 0)
+  800054:	52                   	push   %edx
+  800055:	e8 cc 22 00 00       	call   802326 <fs_set_sched>
+  80005a:	83 c4 10             	add    $0x10,%esp
+  80005d:	85 c0                	test   %eax,%eax
+  80005f:	78 37                	js     800098 <run+0x65>
+    panic("fs_set_sched: %e", r);
+
+  seed = 1;
+  800061:	c7 05 00 50 80 00 01 	movl   $0x1,0x805000
+  800068:	00 00 00 
+  ms = 0;
+  for (round = 0; round < ROUNDS; round++) {
+    for (i = 0; i < nread; i++)
+      offsets[i] = rand() % (size / BLKSIZE) * BLKSIZE;
+  80006b:	8d 83 ff 0f 00 00    	lea    0xfff(%ebx),%eax
+  800071:	85 db                	test   %ebx,%ebx
+  800073:	0f 49 c3             	cmovns %ebx,%eax
+  800076:	c1 f8 0c             	sar    $0xc,%eax
+  800079:	89 85 28 ff ff ff    	mov    %eax,-0xd8(%ebp)
+  for (round = 0; round < ROUNDS; round++) {
+  80007f:	c7 85 34 ff ff ff 00 	movl   $0x0,-0xcc(%ebp)
+  800086:	00 00 00 
+  ms = 0;
+  800089:	c7 85 2c ff ff ff 00 	movl   $0x0,-0xd4(%ebp)
+  800090:	00 00 00 
+  800093:	e9 77 01 00 00       	jmp    80020f <run+0x1dc>
+    panic("fs_set_sched: %e", r);
+  800098:	50                   	push   %eax
+  800099:	68 40 32 80 00       	push   $0x803240
+  80009e:	6a 23                	push   $0x23
+  8000a0:	68 51 32 80 00       	push   $0x803251
+  8000a5:	e8 f4 03 00 00       	call   80049e <_panic>
+  seed = seed * 1103515245 + 12345;
+  8000aa:	69 c9 6d 4e c6 41    	imul   $0x41c64e6d,%ecx,%ecx
+  8000b0:	81 c1 39 30 00 00    	add    $0x3039,%ecx
+  return seed >> 8;
+  8000b6:	89 c8                	mov    %ecx,%eax
+  8000b8:	c1 e8 08             	shr    $0x8,%eax
+      offsets[i] = rand() % (size / BLKSIZE) * BLKSIZE;
+  8000bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000c0:	f7 f6                	div    %esi
+  8000c2:	c1 e2 0c             	shl    $0xc,%edx
+  8000c5:	89 14 9d 20 50 80 00 	mov    %edx,0x805020(,%ebx,4)
+    for (i = 0; i < nread; i++)
+  8000cc:	83 c3 01             	add    $0x1,%ebx
+  8000cf:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000d4:	39 fb                	cmp    %edi,%ebx
+  8000d6:	7c d2                	jl     8000aa <run+0x77>
+  8000d8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8000db:	84 c0                	test   %al,%al
+  8000dd:	74 06                	je     8000e5 <run+0xb2>
+  8000df:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+
+    if ((r = fs_dropcache()) < 0)
+  8000e5:	e8 f6 21 00 00       	call   8022e0 <fs_dropcache>
+  8000ea:	85 c0                	test   %eax,%eax
+  8000ec:	78 6f                	js     80015d <run+0x12a>
+      panic("fs_dropcache: %e", r);
+    if (round == 0 && (r = fs_stats(0, &before)) < 0)
+  8000ee:	83 bd 34 ff ff ff 00 	cmpl   $0x0,-0xcc(%ebp)
+  8000f5:	74 78                	je     80016f <run+0x13c>
+      panic("fs_stats: %e", r);
+
+    ms -= sys_time_msec();
+  8000f7:	e8 b4 11 00 00       	call   8012b0 <sys_time_msec>
+  8000fc:	89 85 30 ff ff ff    	mov    %eax,-0xd0(%ebp)
+    if (hint && (r = prefetch(fd, offsets, nread)) < 0)
+  800102:	80 bd 27 ff ff ff 00 	cmpb   $0x0,-0xd9(%ebp)
+  800109:	0f 85 8b 00 00 00    	jne    80019a <run+0x167>
+    for (i = 0; i < nread; i++)
+  80010f:	bb 00 00 00 00       	mov    $0x0,%ebx
+      panic("prefetch: %e", r);
+    for (i = 0; i < nread; i++) {
+  800114:	39 fb                	cmp    %edi,%ebx
+  800116:	0f 8d ce 00 00 00    	jge    8001ea <run+0x1b7>
+      if ((r = seek(fd, offsets[i])) < 0)
+  80011c:	83 ec 08             	sub    $0x8,%esp
+  80011f:	ff 34 9d 20 50 80 00 	push   0x805020(,%ebx,4)
+  800126:	56                   	push   %esi
+  800127:	e8 8e 17 00 00       	call   8018ba <seek>
+  80012c:	83 c4 10             	add    $0x10,%esp
+  80012f:	85 c0                	test   %eax,%eax
+  800131:	0f 88 8f 00 00 00    	js     8001c6 <run+0x193>
+        panic("seek: %e", r);
+      if ((r = readn(fd, buf, BLKSIZE)) != BLKSIZE)
+  800137:	83 ec 04             	sub    $0x4,%esp
+  80013a:	68 00 10 00 00       	push   $0x1000
+  80013f:	68 20 54 80 00       	push   $0x805420
+  800144:	56                   	push   %esi
+  800145:	e8 a7 16 00 00       	call   8017f1 <readn>
+  80014a:	83 c4 10             	add    $0x10,%esp
+  80014d:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800152:	0f 85 80 00 00 00    	jne    8001d8 <run+0x1a5>
+    for (i = 0; i < nread; i++) {
+  800158:	83 c3 01             	add    $0x1,%ebx
+  80015b:	eb b7                	jmp    800114 <run+0xe1>
+      panic("fs_dropcache: %e", r);
+  80015d:	50                   	push   %eax
+  80015e:	68 62 32 80 00       	push   $0x803262
+  800163:	6a 2c                	push   $0x2c
+  800165:	68 51 32 80 00       	push   $0x803251
+  80016a:	e8 2f 03 00 00       	call   80049e <_panic>
+    if (round == 0 && (r = fs_stats(0, &before)) < 0)
+  80016f:	83 ec 08             	sub    $0x8,%esp
+  800172:	8d 45 90             	lea    -0x70(%ebp),%eax
+  800175:	50                   	push   %eax
+  800176:	6a 00                	push   $0x0
+  800178:	e8 17 21 00 00       	call   802294 <fs_stats>
+  80017d:	83 c4 10             	add    $0x10,%esp
+  800180:	85 c0                	test   %eax,%eax
+  800182:	0f 89 6f ff ff ff    	jns    8000f7 <run+0xc4>
+      panic("fs_stats: %e", r);
+  800188:	50                   	push   %eax
+  800189:	68 73 32 80 00       	push   $0x803273
+  80018e:	6a 2e                	push   $0x2e
+  800190:	68 51 32 80 00       	push   $0x803251
+  800195:	e8 04 03 00 00       	call   80049e <_panic>
+    if (hint && (r = prefetch(fd, offsets, nread)) < 0)
+  80019a:	83 ec 04             	sub    $0x4,%esp
+  80019d:	57                   	push   %edi
+  80019e:	68 20 50 80 00       	push   $0x805020
+  8001a3:	56                   	push   %esi
+  8001a4:	e8 39 22 00 00       	call   8023e2 <prefetch>
+  8001a9:	83 c4 10             	add    $0x10,%esp
+  8001ac:	85 c0                	test   %eax,%eax
+  8001ae:	0f 89 5b ff ff ff    	jns    80010f <run+0xdc>
+      panic("prefetch: %e", r);
+  8001b4:	50                   	push   %eax
+  8001b5:	68 80 32 80 00       	push   $0x803280
+  8001ba:	6a 32                	push   $0x32
+  8001bc:	68 51 32 80 00       	push   $0x803251
+  8001c1:	e8 d8 02 00 00       	call   80049e <_panic>
+        panic("seek: %e", r);
+  8001c6:	50                   	push   %eax
+  8001c7:	68 8d 32 80 00       	push   $0x80328d
+  8001cc:	6a 35                	push   $0x35
+  8001ce:	68 51 32 80 00       	push   $0x803251
+  8001d3:	e8 c6 02 00 00       	call   80049e <_panic>
+        panic("read: %e", r);
+  8001d8:	50                   	push   %eax
+  8001d9:	68 96 32 80 00       	push   $0x803296
+  8001de:	6a 37                	push   $0x37
+  8001e0:	68 51 32 80 00       	push   $0x803251
+  8001e5:	e8 b4 02 00 00       	call   80049e <_panic>
+    }
+    ms += sys_time_msec();
+  8001ea:	e8 c1 10 00 00       	call   8012b0 <sys_time_msec>
+  8001ef:	8b 95 30 ff ff ff    	mov    -0xd0(%ebp),%edx
+  8001f5:	29 d0                	sub    %edx,%eax
+  8001f7:	01 85 2c ff ff ff    	add    %eax,-0xd4(%ebp)
+  for (round = 0; round < ROUNDS; round++) {
+  8001fd:	83 85 34 ff ff ff 01 	addl   $0x1,-0xcc(%ebp)
+  800204:	8b 85 34 ff ff ff    	mov    -0xcc(%ebp),%eax
+  80020a:	83 f8 08             	cmp    $0x8,%eax
+  80020d:	74 1e                	je     80022d <run+0x1fa>
+  80020f:	8b 0d 00 50 80 00    	mov    0x805000,%ecx
+{
+  800215:	b8 00 00 00 00       	mov    $0x0,%eax
+    for (i = 0; i < nread; i++)
+  80021a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80021f:	89 75 08             	mov    %esi,0x8(%ebp)
+  800222:	8b b5 28 ff ff ff    	mov    -0xd8(%ebp),%esi
+  800228:	e9 a7 fe ff ff       	jmp    8000d4 <run+0xa1>
+  }
+  if ((r = fs_stats(0, &after)) < 0)
+  80022d:	83 ec 08             	sub    $0x8,%esp
+  800230:	8d 85 38 ff ff ff    	lea    -0xc8(%ebp),%eax
+  800236:	50                   	push   %eax
+  800237:	6a 00                	push   $0x0
+  800239:	e8 56 20 00 00       	call   802294 <fs_stats>
+  80023e:	83 c4 10             	add    $0x10,%esp
+  800241:	85 c0                	test   %eax,%eax
+  800243:	78 42                	js     800287 <run+0x254>
+    panic("fs_stats: %e", r);
+
+  cprintf("randbench: %-8s %4d reads x%d  %5d ms  %5d disk reads  "
+  800245:	8b 85 68 ff ff ff    	mov    -0x98(%ebp),%eax
+  80024b:	2b 45 c0             	sub    -0x40(%ebp),%eax
+  80024e:	50                   	push   %eax
+  80024f:	8b 85 60 ff ff ff    	mov    -0xa0(%ebp),%eax
+  800255:	2b 45 b8             	sub    -0x48(%ebp),%eax
+  800258:	50                   	push   %eax
+  800259:	8b 85 64 ff ff ff    	mov    -0x9c(%ebp),%eax
+  80025f:	2b 45 bc             	sub    -0x44(%ebp),%eax
+  800262:	50                   	push   %eax
+  800263:	ff b5 2c ff ff ff    	push   -0xd4(%ebp)
+  800269:	6a 08                	push   $0x8
+  80026b:	57                   	push   %edi
+  80026c:	ff b5 20 ff ff ff    	push   -0xe0(%ebp)
+  800272:	68 f0 32 80 00       	push   $0x8032f0
+  800277:	e8 fd 02 00 00       	call   800579 <cprintf>
+          "%5d merged  seek %7d blocks\n", name, nread, ROUNDS, ms,
+          after.ret_bio_reads - before.ret_bio_reads,
+          after.ret_bio_merged - before.ret_bio_merged,
+          after.ret_bio_seek - before.ret_bio_seek);
+}
+  80027c:	83 c4 20             	add    $0x20,%esp
+  80027f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800282:	5b                   	pop    %ebx
+  800283:	5e                   	pop    %esi
+  800284:	5f                   	pop    %edi
+  800285:	5d                   	pop    %ebp
+  800286:	c3                   	ret
+    panic("fs_stats: %e", r);
+  800287:	50                   	push   %eax
+  800288:	68 73 32 80 00       	push   $0x803273
+  80028d:	6a 3c                	push   $0x3c
+  80028f:	68 51 32 80 00       	push   $0x803251
+  800294:	e8 05 02 00 00       	call   80049e <_panic>
+
+00800299 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  800299:	55                   	push   %ebp
+  80029a:	89 e5                	mov    %esp,%ebp
+  80029c:	57                   	push   %edi
+  80029d:	56                   	push   %esi
+  80029e:	53                   	push   %ebx
+  80029f:	83 ec 1c             	sub    $0x1c,%esp
+  8002a2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  off_t size, off;
+  int fd, nread, r;
+
+  binaryname = "randbench";
+  8002a5:	c7 05 00 40 80 00 9f 	movl   $0x80329f,0x804000
+  8002ac:	32 80 00 
+  nread = 64;
+  8002af:	c7 45 e4 40 00 00 00 	movl   $0x40,-0x1c(%ebp)
+  size = 1024 * 1024;
+  8002b6:	bf 00 00 10 00       	mov    $0x100000,%edi
+  if (argc > 1)
+  8002bb:	83 fb 01             	cmp    $0x1,%ebx
+  8002be:	7f 22                	jg     8002e2 <umain+0x49>
+    nread = MIN(strtol(argv[1], 0, 0), MAXREAD);
+  if (argc > 2)
+    size = ROUNDUP(strtol(argv[2], 0, 0) * 1024, BLKSIZE);
+
+  if ((fd = open(NAME, O_RDWR | O_CREAT | O_TRUNC)) < 0)
+  8002c0:	83 ec 08             	sub    $0x8,%esp
+  8002c3:	68 02 03 00 00       	push   $0x302
+  8002c8:	68 a9 32 80 00       	push   $0x8032a9
+  8002cd:	e8 c3 1c 00 00       	call   801f95 <open>
+  8002d2:	89 c6                	mov    %eax,%esi
+  8002d4:	83 c4 10             	add    $0x10,%esp
+  8002d7:	85 c0                	test   %eax,%eax
+  8002d9:	78 58                	js     800333 <umain+0x9a>
+    panic("open %s: %e", NAME, fd);
+  for (off = 0; off < size; off += BLKSIZE)
+  8002db:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002e0:	eb 71                	jmp    800353 <umain+0xba>
+    nread = MIN(strtol(argv[1], 0, 0), MAXREAD);
+  8002e2:	83 ec 04             	sub    $0x4,%esp
+  8002e5:	6a 00                	push   $0x0
+  8002e7:	6a 00                	push   $0x0
+  8002e9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8002ec:	ff 70 04             	push   0x4(%eax)
+  8002ef:	e8 c7 0a 00 00       	call   800dbb <strtol>
+  8002f4:	89 c2                	mov    %eax,%edx
+  8002f6:	b8 00 01 00 00       	mov    $0x100,%eax
+  8002fb:	39 c2                	cmp    %eax,%edx
+  8002fd:	0f 4e c2             	cmovle %edx,%eax
+  800300:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if (argc > 2)
+  800303:	83 c4 10             	add    $0x10,%esp
+  800306:	83 fb 02             	cmp    $0x2,%ebx
+  800309:	7e b5                	jle    8002c0 <umain+0x27>
+    size = ROUNDUP(strtol(argv[2], 0, 0) * 1024, BLKSIZE);
+  80030b:	83 ec 04             	sub    $0x4,%esp
+  80030e:	6a 00                	push   $0x0
+  800310:	6a 00                	push   $0x0
+  800312:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800315:	ff 70 08             	push   0x8(%eax)
+  800318:	e8 9e 0a 00 00       	call   800dbb <strtol>
+  80031d:	c1 e0 0a             	shl    $0xa,%eax
+  800320:	89 c7                	mov    %eax,%edi
+  800322:	81 c7 ff 0f 00 00    	add    $0xfff,%edi
+  800328:	81 e7 00 f0 ff ff    	and    $0xfffff000,%edi
+  80032e:	83 c4 10             	add    $0x10,%esp
+  800331:	eb 8d                	jmp    8002c0 <umain+0x27>
+    panic("open %s: %e", NAME, fd);
+  800333:	83 ec 0c             	sub    $0xc,%esp
+  800336:	50                   	push   %eax
+  800337:	68 a9 32 80 00       	push   $0x8032a9
+  80033c:	68 b9 32 80 00       	push   $0x8032b9
+  800341:	6a 54                	push   $0x54
+  800343:	68 51 32 80 00       	push   $0x803251
+  800348:	e8 51 01 00 00       	call   80049e <_panic>
+  for (off = 0; off < size; off += BLKSIZE)
+  80034d:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  800353:	39 df                	cmp    %ebx,%edi
+  800355:	7e 37                	jle    80038e <umain+0xf5>
+    if ((r = write(fd, buf, BLKSIZE)) != BLKSIZE)
+  800357:	83 ec 04             	sub    $0x4,%esp
+  80035a:	68 00 10 00 00       	push   $0x1000
+  80035f:	68 20 54 80 00       	push   $0x805420
+  800364:	56                   	push   %esi
+  800365:	e8 ce 14 00 00       	call   801838 <write>
+  80036a:	83 c4 10             	add    $0x10,%esp
+  80036d:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800372:	74 d9                	je     80034d <umain+0xb4>
+      panic("write %s: %e", NAME, r);
+  800374:	83 ec 0c             	sub    $0xc,%esp
+  800377:	50                   	push   %eax
+  800378:	68 a9 32 80 00       	push   $0x8032a9
+  80037d:	68 c5 32 80 00       	push   $0x8032c5
+  800382:	6a 57                	push   $0x57
+  800384:	68 51 32 80 00       	push   $0x803251
+  800389:	e8 10 01 00 00       	call   80049e <_panic>
+  if ((r = sync()) < 0)
+  80038e:	e8 ea 1e 00 00       	call   80227d <sync>
+  800393:	85 c0                	test   %eax,%eax
+  800395:	78 7a                	js     800411 <umain+0x178>
+    panic("sync: %e", r);
+
+  run("demand", BIO_SCHED_CLOOK, 0, fd, nread, size);
+  800397:	83 ec 04             	sub    $0x4,%esp
+  80039a:	57                   	push   %edi
+  80039b:	8b 5d e4             	mov    -0x1c(%ebp),%ebx
+  80039e:	53                   	push   %ebx
+  80039f:	56                   	push   %esi
+  8003a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8003a5:	ba 01 00 00 00       	mov    $0x1,%edx
+  8003aa:	b8 db 32 80 00       	mov    $0x8032db,%eax
+  8003af:	e8 7f fc ff ff       	call   800033 <run>
+  run("fifo", BIO_SCHED_FIFO, 1, fd, nread, size);
+  8003b4:	83 c4 0c             	add    $0xc,%esp
+  8003b7:	57                   	push   %edi
+  8003b8:	53                   	push   %ebx
+  8003b9:	56                   	push   %esi
+  8003ba:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8003bf:	ba 02 00 00 00       	mov    $0x2,%edx
+  8003c4:	b8 e2 32 80 00       	mov    $0x8032e2,%eax
+  8003c9:	e8 65 fc ff ff       	call   800033 <run>
+  run("c-look", BIO_SCHED_CLOOK, 1, fd, nread, size);
+  8003ce:	83 c4 0c             	add    $0xc,%esp
+  8003d1:	57                   	push   %edi
+  8003d2:	53                   	push   %ebx
+  8003d3:	56                   	push   %esi
+  8003d4:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8003d9:	ba 01 00 00 00       	mov    $0x1,%edx
+  8003de:	b8 e7 32 80 00       	mov    $0x8032e7,%eax
+  8003e3:	e8 4b fc ff ff       	call   800033 <run>
+  close(fd);
+  8003e8:	89 34 24             	mov    %esi,(%esp)
+  8003eb:	e8 f2 11 00 00       	call   8015e2 <close>
+
+  // Give the space back (there is no remove).
+  if ((fd = open(NAME, O_RDWR | O_TRUNC)) >= 0)
+  8003f0:	83 c4 08             	add    $0x8,%esp
+  8003f3:	68 02 02 00 00       	push   $0x202
+  8003f8:	68 a9 32 80 00       	push   $0x8032a9
+  8003fd:	e8 93 1b 00 00       	call   801f95 <open>
+  800402:	83 c4 10             	add    $0x10,%esp
+  800405:	85 c0                	test   %eax,%eax
+  800407:	79 1a                	jns    800423 <umain+0x18a>
+    close(fd);
+}
+  800409:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80040c:	5b                   	pop    %ebx
+  80040d:	5e                   	pop    %esi
+  80040e:	5f                   	pop    %edi
+  80040f:	5d                   	pop    %ebp
+  800410:	c3                   	ret
+    panic("sync: %e", r);
+  800411:	50                   	push   %eax
+  800412:	68 d2 32 80 00       	push   $0x8032d2
+  800417:	6a 59                	push   $0x59
+  800419:	68 51 32 80 00       	push   $0x803251
+  80041e:	e8 7b 00 00 00       	call   80049e <_panic>
+    close(fd);
+  800423:	83 ec 0c             	sub    $0xc,%esp
+  800426:	50                   	push   %eax
+  800427:	e8 b6 11 00 00       	call   8015e2 <close>
+  80042c:	83 c4 10             	add    $0x10,%esp
+}
+  80042f:	eb d8                	jmp    800409 <umain+0x170>
+
+00800431 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800431:	55                   	push   %ebp
+  800432:	89 e5                	mov    %esp,%ebp
+  800434:	56                   	push   %esi
+  800435:	53                   	push   %ebx
+  800436:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800439:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  80043c:	c7 05 64 6b 80 00 00 	movl   $0x0,0x806b64
+  800443:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  800446:	e8 ca 0a 00 00       	call   800f15 <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  80044b:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800450:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800453:	c1 e0 04             	shl    $0x4,%eax
+  800456:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80045b:	a3 64 6b 80 00       	mov    %eax,0x806b64
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800460:	85 db                	test   %ebx,%ebx
+  800462:	7e 07                	jle    80046b <libmain+0x3a>
+    binaryname = argv[0];
+  800464:	8b 06                	mov    (%esi),%eax
+  800466:	a3 00 40 80 00       	mov    %eax,0x804000
+
+  // call user main routine
+  umain(argc, argv);
+  80046b:	83 ec 08             	sub    $0x8,%esp
+  80046e:	56                   	push   %esi
+  80046f:	53                   	push   %ebx
+  800470:	e8 24 fe ff ff       	call   800299 <umain>
+
+  // exit gracefully
+  exit();
+  800475:	e8 0a 00 00 00       	call   800484 <exit>
+}
+  80047a:	83 c4 10             	add    $0x10,%esp
+  80047d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800480:	5b                   	pop    %ebx
+  800481:	5e                   	pop    %esi
+  800482:	5d                   	pop    %ebp
+  800483:	c3                   	ret
+
+00800484 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800484:	55                   	push   %ebp
+  800485:	89 e5                	mov    %esp,%ebp
+  800487:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  80048a:	e8 80 11 00 00       	call   80160f <close_all>
+  sys_env_destroy(0);
+  80048f:	83 ec 0c             	sub    $0xc,%esp
+  800492:	6a 00                	push   $0x0
+  800494:	e8 3b 0a 00 00       	call   800ed4 <sys_env_destroy>
+}
+  800499:	83 c4 10             	add    $0x10,%esp
+  80049c:	c9                   	leave
+  80049d:	c3                   	ret
+
+0080049e <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80049e:	55                   	push   %ebp
+  80049f:	89 e5                	mov    %esp,%ebp
+  8004a1:	56                   	push   %esi
+  8004a2:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  8004a3:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  8004a6:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  8004ac:	e8 64 0a 00 00       	call   800f15 <sys_getenvid>
+  8004b1:	83 ec 0c             	sub    $0xc,%esp
+  8004b4:	ff 75 0c             	push   0xc(%ebp)
+  8004b7:	ff 75 08             	push   0x8(%ebp)
+  8004ba:	56                   	push   %esi
+  8004bb:	50                   	push   %eax
+  8004bc:	68 50 33 80 00       	push   $0x803350
+  8004c1:	e8 b3 00 00 00       	call   800579 <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  8004c6:	83 c4 18             	add    $0x18,%esp
+  8004c9:	53                   	push   %ebx
+  8004ca:	ff 75 10             	push   0x10(%ebp)
+  8004cd:	e8 56 00 00 00       	call   800528 <vcprintf>
+  cprintf("\n");
+  8004d2:	c7 04 24 c0 37 80 00 	movl   $0x8037c0,(%esp)
+  8004d9:	e8 9b 00 00 00       	call   800579 <cprintf>
+  8004de:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  8004e1:	cc                   	int3
+  while (1)
+  8004e2:	eb fd                	jmp    8004e1 <_panic+0x43>
+
+008004e4 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8004e4:	55                   	push   %ebp
+  8004e5:	89 e5                	mov    %esp,%ebp
+  8004e7:	53                   	push   %ebx
+  8004e8:	83 ec 04             	sub    $0x4,%esp
+  8004eb:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  8004ee:	8b 13                	mov    (%ebx),%edx
+  8004f0:	8d 42 01             	lea    0x1(%edx),%eax
+  8004f3:	89 03                	mov    %eax,(%ebx)
+  8004f5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8004f8:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  8004fc:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800501:	74 09                	je     80050c <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  800503:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800507:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80050a:	c9                   	leave
+  80050b:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  80050c:	83 ec 08             	sub    $0x8,%esp
+  80050f:	68 ff 00 00 00       	push   $0xff
+  800514:	8d 43 08             	lea    0x8(%ebx),%eax
+  800517:	50                   	push   %eax
+  800518:	e8 7a 09 00 00       	call   800e97 <sys_cputs>
+    b->idx = 0;
+  80051d:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800523:	83 c4 10             	add    $0x10,%esp
+  800526:	eb db                	jmp    800503 <putch+0x1f>
+
+00800528 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800528:	55                   	push   %ebp
+  800529:	89 e5                	mov    %esp,%ebp
+  80052b:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  800531:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800538:	00 00 00 
+  b.cnt = 0;
+  80053b:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800542:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  800545:	ff 75 0c             	push   0xc(%ebp)
+  800548:	ff 75 08             	push   0x8(%ebp)
+  80054b:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800551:	50                   	push   %eax
+  800552:	68 e4 04 80 00       	push   $0x8004e4
+  800557:	e8 14 01 00 00       	call   800670 <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  80055c:	83 c4 08             	add    $0x8,%esp
+  80055f:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800565:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80056b:	50                   	push   %eax
+  80056c:	e8 26 09 00 00       	call   800e97 <sys_cputs>
+
+  return b.cnt;
+}
+  800571:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800577:	c9                   	leave
+  800578:	c3                   	ret
+
+00800579 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800579:	55                   	push   %ebp
+  80057a:	89 e5                	mov    %esp,%ebp
+  80057c:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  80057f:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  800582:	50                   	push   %eax
+  800583:	ff 75 08             	push   0x8(%ebp)
+  800586:	e8 9d ff ff ff       	call   800528 <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  80058b:	c9                   	leave
+  80058c:	c3                   	ret
+
+0080058d <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  80058d:	55                   	push   %ebp
+  80058e:	89 e5                	mov    %esp,%ebp
+  800590:	57                   	push   %edi
+  800591:	56                   	push   %esi
+  800592:	53                   	push   %ebx
+  800593:	83 ec 1c             	sub    $0x1c,%esp
+  800596:	89 c7                	mov    %eax,%edi
+  800598:	89 d6                	mov    %edx,%esi
+  80059a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80059d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8005a0:	89 d1                	mov    %edx,%ecx
+  8005a2:	89 c2                	mov    %eax,%edx
+  8005a4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005a7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005aa:	8b 45 10             	mov    0x10(%ebp),%eax
+  8005ad:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  8005b0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005b3:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8005ba:	39 c2                	cmp    %eax,%edx
+  8005bc:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8005bf:	72 3e                	jb     8005ff <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  8005c1:	83 ec 0c             	sub    $0xc,%esp
+  8005c4:	ff 75 18             	push   0x18(%ebp)
+  8005c7:	83 eb 01             	sub    $0x1,%ebx
+  8005ca:	53                   	push   %ebx
+  8005cb:	50                   	push   %eax
+  8005cc:	83 ec 08             	sub    $0x8,%esp
+  8005cf:	ff 75 e4             	push   -0x1c(%ebp)
+  8005d2:	ff 75 e0             	push   -0x20(%ebp)
+  8005d5:	ff 75 dc             	push   -0x24(%ebp)
+  8005d8:	ff 75 d8             	push   -0x28(%ebp)
+  8005db:	e8 db 2a 00 00       	call   8030bb <__udivdi3>
+  8005e0:	83 c4 18             	add    $0x18,%esp
+  8005e3:	52                   	push   %edx
+  8005e4:	50                   	push   %eax
+  8005e5:	89 f2                	mov    %esi,%edx
+  8005e7:	89 f8                	mov    %edi,%eax
+  8005e9:	e8 9f ff ff ff       	call   80058d <printnum>
+  8005ee:	83 c4 20             	add    $0x20,%esp
+  8005f1:	eb 13                	jmp    800606 <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  8005f3:	83 ec 08             	sub    $0x8,%esp
+  8005f6:	56                   	push   %esi
+  8005f7:	ff 75 18             	push   0x18(%ebp)
+  8005fa:	ff d7                	call   *%edi
+  8005fc:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  8005ff:	83 eb 01             	sub    $0x1,%ebx
+  800602:	85 db                	test   %ebx,%ebx
+  800604:	7f ed                	jg     8005f3 <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  800606:	83 ec 08             	sub    $0x8,%esp
+  800609:	56                   	push   %esi
+  80060a:	83 ec 04             	sub    $0x4,%esp
+  80060d:	ff 75 e4             	push   -0x1c(%ebp)
+  800610:	ff 75 e0             	push   -0x20(%ebp)
+  800613:	ff 75 dc             	push   -0x24(%ebp)
+  800616:	ff 75 d8             	push   -0x28(%ebp)
+  800619:	e8 be 2a 00 00       	call   8030dc <__umoddi3>
+  80061e:	83 c4 14             	add    $0x14,%esp
+  800621:	0f be 80 73 33 80 00 	movsbl 0x803373(%eax),%eax
+  800628:	50                   	push   %eax
+  800629:	ff d7                	call   *%edi
+}
+  80062b:	83 c4 10             	add    $0x10,%esp
+  80062e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800631:	5b                   	pop    %ebx
+  800632:	5e                   	pop    %esi
+  800633:	5f                   	pop    %edi
+  800634:	5d                   	pop    %ebp
+  800635:	c3                   	ret
+
+00800636 <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800636:	55                   	push   %ebp
+  800637:	89 e5                	mov    %esp,%ebp
+  800639:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  80063c:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  800640:	8b 10                	mov    (%eax),%edx
+  800642:	3b 50 04             	cmp    0x4(%eax),%edx
+  800645:	73 0a                	jae    800651 <sprintputch+0x1b>
+    *b->buf++ = ch;
+  800647:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80064a:	89 08                	mov    %ecx,(%eax)
+  80064c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80064f:	88 02                	mov    %al,(%edx)
+}
+  800651:	5d                   	pop    %ebp
+  800652:	c3                   	ret
+
+00800653 <printfmt>:
+{
+  800653:	55                   	push   %ebp
+  800654:	89 e5                	mov    %esp,%ebp
+  800656:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  800659:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  80065c:	50                   	push   %eax
+  80065d:	ff 75 10             	push   0x10(%ebp)
+  800660:	ff 75 0c             	push   0xc(%ebp)
+  800663:	ff 75 08             	push   0x8(%ebp)
+  800666:	e8 05 00 00 00       	call   800670 <vprintfmt>
+}
+  80066b:	83 c4 10             	add    $0x10,%esp
+  80066e:	c9                   	leave
+  80066f:	c3                   	ret
+
+00800670 <vprintfmt>:
+{
+  800670:	55                   	push   %ebp
+  800671:	89 e5                	mov    %esp,%ebp
+  800673:	57                   	push   %edi
+  800674:	56                   	push   %esi
+  800675:	53                   	push   %ebx
+  800676:	83 ec 2c             	sub    $0x2c,%esp
+  800679:	8b 75 08             	mov    0x8(%ebp),%esi
+  80067c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80067f:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800682:	eb 0a                	jmp    80068e <vprintfmt+0x1e>
+      putch(ch, putdat);
+  800684:	83 ec 08             	sub    $0x8,%esp
+  800687:	53                   	push   %ebx
+  800688:	50                   	push   %eax
+  800689:	ff d6                	call   *%esi
+  80068b:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  80068e:	83 c7 01             	add    $0x1,%edi
+  800691:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800695:	83 f8 25             	cmp    $0x25,%eax
+  800698:	74 0c                	je     8006a6 <vprintfmt+0x36>
+      if (ch == '\0')
+  80069a:	85 c0                	test   %eax,%eax
+  80069c:	75 e6                	jne    800684 <vprintfmt+0x14>
+}
+  80069e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8006a1:	5b                   	pop    %ebx
+  8006a2:	5e                   	pop    %esi
+  8006a3:	5f                   	pop    %edi
+  8006a4:	5d                   	pop    %ebp
+  8006a5:	c3                   	ret
+    padc = ' ';
+  8006a6:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  8006aa:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  8006b1:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  8006b8:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  8006bf:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  8006c4:	8d 47 01             	lea    0x1(%edi),%eax
+  8006c7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8006ca:	0f b6 17             	movzbl (%edi),%edx
+  8006cd:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8006d0:	3c 55                	cmp    $0x55,%al
+  8006d2:	0f 87 cf 03 00 00    	ja     800aa7 <vprintfmt+0x437>
+  8006d8:	0f b6 c0             	movzbl %al,%eax
+  8006db:	ff 24 85 c0 34 80 00 	jmp    *0x8034c0(,%eax,4)
+  8006e2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  8006e5:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8006e9:	eb d9                	jmp    8006c4 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  8006eb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8006ee:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8006f2:	eb d0                	jmp    8006c4 <vprintfmt+0x54>
+  8006f4:	0f b6 d2             	movzbl %dl,%edx
+  8006f7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  8006fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006ff:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  800702:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800705:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  800709:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  80070c:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80070f:	83 f9 09             	cmp    $0x9,%ecx
+  800712:	77 55                	ja     800769 <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  800714:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  800717:	eb e9                	jmp    800702 <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  800719:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071c:	8b 00                	mov    (%eax),%eax
+  80071e:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800721:	8b 45 14             	mov    0x14(%ebp),%eax
+  800724:	8d 40 04             	lea    0x4(%eax),%eax
+  800727:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  80072a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  80072d:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800731:	79 91                	jns    8006c4 <vprintfmt+0x54>
+        width = precision, precision = -1;
+  800733:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800736:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800739:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800740:	eb 82                	jmp    8006c4 <vprintfmt+0x54>
+      if (width < 0)
+  800742:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800745:	85 d2                	test   %edx,%edx
+  800747:	b8 00 00 00 00       	mov    $0x0,%eax
+  80074c:	0f 49 c2             	cmovns %edx,%eax
+  80074f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  800752:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  800755:	e9 6a ff ff ff       	jmp    8006c4 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  80075a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  80075d:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  800764:	e9 5b ff ff ff       	jmp    8006c4 <vprintfmt+0x54>
+  800769:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80076c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80076f:	eb bc                	jmp    80072d <vprintfmt+0xbd>
+      lflag++;
+  800771:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  800774:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  800777:	e9 48 ff ff ff       	jmp    8006c4 <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  80077c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80077f:	8d 78 04             	lea    0x4(%eax),%edi
+  800782:	83 ec 08             	sub    $0x8,%esp
+  800785:	53                   	push   %ebx
+  800786:	ff 30                	push   (%eax)
+  800788:	ff d6                	call   *%esi
+      break;
+  80078a:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  80078d:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  800790:	e9 b1 02 00 00       	jmp    800a46 <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  800795:	8b 45 14             	mov    0x14(%ebp),%eax
+  800798:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  80079b:	8b 10                	mov    (%eax),%edx
+  80079d:	89 d0                	mov    %edx,%eax
+  80079f:	f7 d8                	neg    %eax
+  8007a1:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8007a4:	83 f8 10             	cmp    $0x10,%eax
+  8007a7:	7f 23                	jg     8007cc <vprintfmt+0x15c>
+  8007a9:	8b 14 85 20 36 80 00 	mov    0x803620(,%eax,4),%edx
+  8007b0:	85 d2                	test   %edx,%edx
+  8007b2:	74 18                	je     8007cc <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  8007b4:	52                   	push   %edx
+  8007b5:	68 6a 37 80 00       	push   $0x80376a
+  8007ba:	53                   	push   %ebx
+  8007bb:	56                   	push   %esi
+  8007bc:	e8 92 fe ff ff       	call   800653 <printfmt>
+  8007c1:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  8007c4:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8007c7:	e9 7a 02 00 00       	jmp    800a46 <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  8007cc:	50                   	push   %eax
+  8007cd:	68 8b 33 80 00       	push   $0x80338b
+  8007d2:	53                   	push   %ebx
+  8007d3:	56                   	push   %esi
+  8007d4:	e8 7a fe ff ff       	call   800653 <printfmt>
+  8007d9:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  8007dc:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  8007df:	e9 62 02 00 00       	jmp    800a46 <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  8007e4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e7:	83 c0 04             	add    $0x4,%eax
+  8007ea:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8007ed:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007f0:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  8007f2:	85 c9                	test   %ecx,%ecx
+  8007f4:	b8 84 33 80 00       	mov    $0x803384,%eax
+  8007f9:	0f 45 c1             	cmovne %ecx,%eax
+  8007fc:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  8007ff:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800803:	7e 06                	jle    80080b <vprintfmt+0x19b>
+  800805:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800809:	75 0b                	jne    800816 <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  80080b:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80080e:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800811:	89 75 08             	mov    %esi,0x8(%ebp)
+  800814:	eb 5c                	jmp    800872 <vprintfmt+0x202>
+  800816:	83 ec 08             	sub    $0x8,%esp
+  800819:	ff 75 d0             	push   -0x30(%ebp)
+  80081c:	ff 75 cc             	push   -0x34(%ebp)
+  80081f:	e8 20 03 00 00       	call   800b44 <strnlen>
+  800824:	89 c2                	mov    %eax,%edx
+  800826:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800829:	29 d0                	sub    %edx,%eax
+  80082b:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  80082e:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800832:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800835:	89 75 08             	mov    %esi,0x8(%ebp)
+  800838:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  80083a:	eb 0e                	jmp    80084a <vprintfmt+0x1da>
+          putch(padc, putdat);
+  80083c:	83 ec 08             	sub    $0x8,%esp
+  80083f:	53                   	push   %ebx
+  800840:	57                   	push   %edi
+  800841:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800844:	83 ee 01             	sub    $0x1,%esi
+  800847:	83 c4 10             	add    $0x10,%esp
+  80084a:	85 f6                	test   %esi,%esi
+  80084c:	7f ee                	jg     80083c <vprintfmt+0x1cc>
+  80084e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800851:	8b 75 08             	mov    0x8(%ebp),%esi
+  800854:	85 c0                	test   %eax,%eax
+  800856:	ba 00 00 00 00       	mov    $0x0,%edx
+  80085b:	0f 49 d0             	cmovns %eax,%edx
+  80085e:	29 d0                	sub    %edx,%eax
+  800860:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800863:	eb a6                	jmp    80080b <vprintfmt+0x19b>
+          putch(ch, putdat);
+  800865:	83 ec 08             	sub    $0x8,%esp
+  800868:	53                   	push   %ebx
+  800869:	52                   	push   %edx
+  80086a:	ff 55 08             	call   *0x8(%ebp)
+  80086d:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800870:	89 f1                	mov    %esi,%ecx
+  800872:	8d 71 01             	lea    0x1(%ecx),%esi
+  800875:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800879:	0f be d0             	movsbl %al,%edx
+  80087c:	85 d2                	test   %edx,%edx
+  80087e:	74 28                	je     8008a8 <vprintfmt+0x238>
+  800880:	85 ff                	test   %edi,%edi
+  800882:	78 05                	js     800889 <vprintfmt+0x219>
+  800884:	83 ef 01             	sub    $0x1,%edi
+  800887:	78 30                	js     8008b9 <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  800889:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80088d:	74 d6                	je     800865 <vprintfmt+0x1f5>
+  80088f:	0f be c0             	movsbl %al,%eax
+  800892:	83 e8 20             	sub    $0x20,%eax
+  800895:	83 f8 5e             	cmp    $0x5e,%eax
+  800898:	76 cb                	jbe    800865 <vprintfmt+0x1f5>
+          putch('?', putdat);
+  80089a:	83 ec 08             	sub    $0x8,%esp
+  80089d:	53                   	push   %ebx
+  80089e:	6a 3f                	push   $0x3f
+  8008a0:	ff 55 08             	call   *0x8(%ebp)
+  8008a3:	83 c4 10             	add    $0x10,%esp
+  8008a6:	eb c8                	jmp    800870 <vprintfmt+0x200>
+  8008a8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008ab:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8008ae:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8008b1:	01 d0                	add    %edx,%eax
+  8008b3:	29 c8                	sub    %ecx,%eax
+  8008b5:	89 c7                	mov    %eax,%edi
+  8008b7:	eb 13                	jmp    8008cc <vprintfmt+0x25c>
+  8008b9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008bc:	eb ed                	jmp    8008ab <vprintfmt+0x23b>
+        putch(' ', putdat);
+  8008be:	83 ec 08             	sub    $0x8,%esp
+  8008c1:	53                   	push   %ebx
+  8008c2:	6a 20                	push   $0x20
+  8008c4:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  8008c6:	83 ef 01             	sub    $0x1,%edi
+  8008c9:	83 c4 10             	add    $0x10,%esp
+  8008cc:	85 ff                	test   %edi,%edi
+  8008ce:	7f ee                	jg     8008be <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  8008d0:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8008d3:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008d6:	e9 6b 01 00 00       	jmp    800a46 <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  8008db:	83 f9 01             	cmp    $0x1,%ecx
+  8008de:	7f 1f                	jg     8008ff <vprintfmt+0x28f>
+  else if (lflag)
+  8008e0:	85 c9                	test   %ecx,%ecx
+  8008e2:	74 67                	je     80094b <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  8008e4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008e7:	8b 00                	mov    (%eax),%eax
+  8008e9:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8008ec:	89 c1                	mov    %eax,%ecx
+  8008ee:	c1 f9 1f             	sar    $0x1f,%ecx
+  8008f1:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8008f4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008f7:	8d 40 04             	lea    0x4(%eax),%eax
+  8008fa:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008fd:	eb 17                	jmp    800916 <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  8008ff:	8b 45 14             	mov    0x14(%ebp),%eax
+  800902:	8b 50 04             	mov    0x4(%eax),%edx
+  800905:	8b 00                	mov    (%eax),%eax
+  800907:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80090a:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80090d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800910:	8d 40 08             	lea    0x8(%eax),%eax
+  800913:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  800916:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800919:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  80091c:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  800921:	85 c9                	test   %ecx,%ecx
+  800923:	0f 89 03 01 00 00    	jns    800a2c <vprintfmt+0x3bc>
+        putch('-', putdat);
+  800929:	83 ec 08             	sub    $0x8,%esp
+  80092c:	53                   	push   %ebx
+  80092d:	6a 2d                	push   $0x2d
+  80092f:	ff d6                	call   *%esi
+        num = -(long long)num;
+  800931:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800934:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800937:	f7 da                	neg    %edx
+  800939:	83 d1 00             	adc    $0x0,%ecx
+  80093c:	f7 d9                	neg    %ecx
+  80093e:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  800941:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800946:	e9 e1 00 00 00       	jmp    800a2c <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  80094b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80094e:	8b 00                	mov    (%eax),%eax
+  800950:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800953:	89 c1                	mov    %eax,%ecx
+  800955:	c1 f9 1f             	sar    $0x1f,%ecx
+  800958:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80095b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80095e:	8d 40 04             	lea    0x4(%eax),%eax
+  800961:	89 45 14             	mov    %eax,0x14(%ebp)
+  800964:	eb b0                	jmp    800916 <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  800966:	83 f9 01             	cmp    $0x1,%ecx
+  800969:	7f 1e                	jg     800989 <vprintfmt+0x319>
+  else if (lflag)
+  80096b:	85 c9                	test   %ecx,%ecx
+  80096d:	74 32                	je     8009a1 <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  80096f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800972:	8b 10                	mov    (%eax),%edx
+  800974:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800979:	8d 40 04             	lea    0x4(%eax),%eax
+  80097c:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  80097f:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  800984:	e9 a3 00 00 00       	jmp    800a2c <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800989:	8b 45 14             	mov    0x14(%ebp),%eax
+  80098c:	8b 10                	mov    (%eax),%edx
+  80098e:	8b 48 04             	mov    0x4(%eax),%ecx
+  800991:	8d 40 08             	lea    0x8(%eax),%eax
+  800994:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800997:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  80099c:	e9 8b 00 00 00       	jmp    800a2c <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8009a1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009a4:	8b 10                	mov    (%eax),%edx
+  8009a6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009ab:	8d 40 04             	lea    0x4(%eax),%eax
+  8009ae:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  8009b1:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  8009b6:	eb 74                	jmp    800a2c <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  8009b8:	83 f9 01             	cmp    $0x1,%ecx
+  8009bb:	7f 1b                	jg     8009d8 <vprintfmt+0x368>
+  else if (lflag)
+  8009bd:	85 c9                	test   %ecx,%ecx
+  8009bf:	74 2c                	je     8009ed <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  8009c1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009c4:	8b 10                	mov    (%eax),%edx
+  8009c6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009cb:	8d 40 04             	lea    0x4(%eax),%eax
+  8009ce:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8009d1:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  8009d6:	eb 54                	jmp    800a2c <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  8009d8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009db:	8b 10                	mov    (%eax),%edx
+  8009dd:	8b 48 04             	mov    0x4(%eax),%ecx
+  8009e0:	8d 40 08             	lea    0x8(%eax),%eax
+  8009e3:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8009e6:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  8009eb:	eb 3f                	jmp    800a2c <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8009ed:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009f0:	8b 10                	mov    (%eax),%edx
+  8009f2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009f7:	8d 40 04             	lea    0x4(%eax),%eax
+  8009fa:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8009fd:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  800a02:	eb 28                	jmp    800a2c <vprintfmt+0x3bc>
+      putch('0', putdat);
+  800a04:	83 ec 08             	sub    $0x8,%esp
+  800a07:	53                   	push   %ebx
+  800a08:	6a 30                	push   $0x30
+  800a0a:	ff d6                	call   *%esi
+      putch('x', putdat);
+  800a0c:	83 c4 08             	add    $0x8,%esp
+  800a0f:	53                   	push   %ebx
+  800a10:	6a 78                	push   $0x78
+  800a12:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  800a14:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a17:	8b 10                	mov    (%eax),%edx
+  800a19:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  800a1e:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  800a21:	8d 40 04             	lea    0x4(%eax),%eax
+  800a24:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800a27:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  800a2c:	83 ec 0c             	sub    $0xc,%esp
+  800a2f:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800a33:	50                   	push   %eax
+  800a34:	ff 75 e0             	push   -0x20(%ebp)
+  800a37:	57                   	push   %edi
+  800a38:	51                   	push   %ecx
+  800a39:	52                   	push   %edx
+  800a3a:	89 da                	mov    %ebx,%edx
+  800a3c:	89 f0                	mov    %esi,%eax
+  800a3e:	e8 4a fb ff ff       	call   80058d <printnum>
+      break;
+  800a43:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  800a46:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  800a49:	e9 40 fc ff ff       	jmp    80068e <vprintfmt+0x1e>
+  if (lflag >= 2)
+  800a4e:	83 f9 01             	cmp    $0x1,%ecx
+  800a51:	7f 1b                	jg     800a6e <vprintfmt+0x3fe>
+  else if (lflag)
+  800a53:	85 c9                	test   %ecx,%ecx
+  800a55:	74 2c                	je     800a83 <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  800a57:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a5a:	8b 10                	mov    (%eax),%edx
+  800a5c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a61:	8d 40 04             	lea    0x4(%eax),%eax
+  800a64:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800a67:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  800a6c:	eb be                	jmp    800a2c <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800a6e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a71:	8b 10                	mov    (%eax),%edx
+  800a73:	8b 48 04             	mov    0x4(%eax),%ecx
+  800a76:	8d 40 08             	lea    0x8(%eax),%eax
+  800a79:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800a7c:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  800a81:	eb a9                	jmp    800a2c <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800a83:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a86:	8b 10                	mov    (%eax),%edx
+  800a88:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a8d:	8d 40 04             	lea    0x4(%eax),%eax
+  800a90:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800a93:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  800a98:	eb 92                	jmp    800a2c <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  800a9a:	83 ec 08             	sub    $0x8,%esp
+  800a9d:	53                   	push   %ebx
+  800a9e:	6a 25                	push   $0x25
+  800aa0:	ff d6                	call   *%esi
+      break;
+  800aa2:	83 c4 10             	add    $0x10,%esp
+  800aa5:	eb 9f                	jmp    800a46 <vprintfmt+0x3d6>
+      putch('%', putdat);
+  800aa7:	83 ec 08             	sub    $0x8,%esp
+  800aaa:	53                   	push   %ebx
+  800aab:	6a 25                	push   $0x25
+  800aad:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  800aaf:	83 c4 10             	add    $0x10,%esp
+  800ab2:	89 f8                	mov    %edi,%eax
+  800ab4:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800ab8:	74 05                	je     800abf <vprintfmt+0x44f>
+  800aba:	83 e8 01             	sub    $0x1,%eax
+  800abd:	eb f5                	jmp    800ab4 <vprintfmt+0x444>
+  800abf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800ac2:	eb 82                	jmp    800a46 <vprintfmt+0x3d6>
+
+00800ac4 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800ac4:	55                   	push   %ebp
+  800ac5:	89 e5                	mov    %esp,%ebp
+  800ac7:	83 ec 18             	sub    $0x18,%esp
+  800aca:	8b 45 08             	mov    0x8(%ebp),%eax
+  800acd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  800ad0:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800ad3:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800ad7:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800ada:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  800ae1:	85 c0                	test   %eax,%eax
+  800ae3:	74 26                	je     800b0b <vsnprintf+0x47>
+  800ae5:	85 d2                	test   %edx,%edx
+  800ae7:	7e 22                	jle    800b0b <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800ae9:	ff 75 14             	push   0x14(%ebp)
+  800aec:	ff 75 10             	push   0x10(%ebp)
+  800aef:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800af2:	50                   	push   %eax
+  800af3:	68 36 06 80 00       	push   $0x800636
+  800af8:	e8 73 fb ff ff       	call   800670 <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800afd:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800b00:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  800b03:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b06:	83 c4 10             	add    $0x10,%esp
+}
+  800b09:	c9                   	leave
+  800b0a:	c3                   	ret
+    return -E_INVAL;
+  800b0b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b10:	eb f7                	jmp    800b09 <vsnprintf+0x45>
+
+00800b12 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800b12:	55                   	push   %ebp
+  800b13:	89 e5                	mov    %esp,%ebp
+  800b15:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  800b18:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  800b1b:	50                   	push   %eax
+  800b1c:	ff 75 10             	push   0x10(%ebp)
+  800b1f:	ff 75 0c             	push   0xc(%ebp)
+  800b22:	ff 75 08             	push   0x8(%ebp)
+  800b25:	e8 9a ff ff ff       	call   800ac4 <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  800b2a:	c9                   	leave
+  800b2b:	c3                   	ret
+
+00800b2c <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800b2c:	55                   	push   %ebp
+  800b2d:	89 e5                	mov    %esp,%ebp
+  800b2f:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  800b32:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b37:	eb 03                	jmp    800b3c <strlen+0x10>
+    n++;
+  800b39:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  800b3c:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800b40:	75 f7                	jne    800b39 <strlen+0xd>
+  return n;
+}
+  800b42:	5d                   	pop    %ebp
+  800b43:	c3                   	ret
+
+00800b44 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800b44:	55                   	push   %ebp
+  800b45:	89 e5                	mov    %esp,%ebp
+  800b47:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800b4a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b4d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b52:	eb 03                	jmp    800b57 <strnlen+0x13>
+    n++;
+  800b54:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800b57:	39 d0                	cmp    %edx,%eax
+  800b59:	74 08                	je     800b63 <strnlen+0x1f>
+  800b5b:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800b5f:	75 f3                	jne    800b54 <strnlen+0x10>
+  800b61:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  800b63:	89 d0                	mov    %edx,%eax
+  800b65:	5d                   	pop    %ebp
+  800b66:	c3                   	ret
+
+00800b67 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800b67:	55                   	push   %ebp
+  800b68:	89 e5                	mov    %esp,%ebp
+  800b6a:	53                   	push   %ebx
+  800b6b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b6e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  800b71:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b76:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800b7a:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800b7d:	83 c0 01             	add    $0x1,%eax
+  800b80:	84 d2                	test   %dl,%dl
+  800b82:	75 f2                	jne    800b76 <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  800b84:	89 c8                	mov    %ecx,%eax
+  800b86:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b89:	c9                   	leave
+  800b8a:	c3                   	ret
+
+00800b8b <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800b8b:	55                   	push   %ebp
+  800b8c:	89 e5                	mov    %esp,%ebp
+  800b8e:	53                   	push   %ebx
+  800b8f:	83 ec 10             	sub    $0x10,%esp
+  800b92:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  800b95:	53                   	push   %ebx
+  800b96:	e8 91 ff ff ff       	call   800b2c <strlen>
+  800b9b:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  800b9e:	ff 75 0c             	push   0xc(%ebp)
+  800ba1:	01 d8                	add    %ebx,%eax
+  800ba3:	50                   	push   %eax
+  800ba4:	e8 be ff ff ff       	call   800b67 <strcpy>
+  return dst;
+}
+  800ba9:	89 d8                	mov    %ebx,%eax
+  800bab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800bae:	c9                   	leave
+  800baf:	c3                   	ret
+
+00800bb0 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  800bb0:	55                   	push   %ebp
+  800bb1:	89 e5                	mov    %esp,%ebp
+  800bb3:	56                   	push   %esi
+  800bb4:	53                   	push   %ebx
+  800bb5:	8b 75 08             	mov    0x8(%ebp),%esi
+  800bb8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  800bbb:	89 f3                	mov    %esi,%ebx
+  800bbd:	03 5d 10             	add    0x10(%ebp),%ebx
+  800bc0:	89 f0                	mov    %esi,%eax
+  800bc2:	eb 0f                	jmp    800bd3 <strncpy+0x23>
+    *dst++ = *src;
+  800bc4:	83 c0 01             	add    $0x1,%eax
+  800bc7:	0f b6 0a             	movzbl (%edx),%ecx
+  800bca:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  800bcd:	80 f9 01             	cmp    $0x1,%cl
+  800bd0:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  800bd3:	39 d8                	cmp    %ebx,%eax
+  800bd5:	75 ed                	jne    800bc4 <strncpy+0x14>
+  }
+  return ret;
+}
+  800bd7:	89 f0                	mov    %esi,%eax
+  800bd9:	5b                   	pop    %ebx
+  800bda:	5e                   	pop    %esi
+  800bdb:	5d                   	pop    %ebp
+  800bdc:	c3                   	ret
+
+00800bdd <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800bdd:	55                   	push   %ebp
+  800bde:	89 e5                	mov    %esp,%ebp
+  800be0:	56                   	push   %esi
+  800be1:	53                   	push   %ebx
+  800be2:	8b 75 08             	mov    0x8(%ebp),%esi
+  800be5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800be8:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  800beb:	89 f0                	mov    %esi,%eax
+  800bed:	85 d2                	test   %edx,%edx
+  800bef:	74 21                	je     800c12 <strlcpy+0x35>
+  800bf1:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800bf5:	89 f2                	mov    %esi,%edx
+  800bf7:	eb 09                	jmp    800c02 <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  800bf9:	83 c1 01             	add    $0x1,%ecx
+  800bfc:	83 c2 01             	add    $0x1,%edx
+  800bff:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  800c02:	39 c2                	cmp    %eax,%edx
+  800c04:	74 09                	je     800c0f <strlcpy+0x32>
+  800c06:	0f b6 19             	movzbl (%ecx),%ebx
+  800c09:	84 db                	test   %bl,%bl
+  800c0b:	75 ec                	jne    800bf9 <strlcpy+0x1c>
+  800c0d:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  800c0f:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  800c12:	29 f0                	sub    %esi,%eax
+}
+  800c14:	5b                   	pop    %ebx
+  800c15:	5e                   	pop    %esi
+  800c16:	5d                   	pop    %ebp
+  800c17:	c3                   	ret
+
+00800c18 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800c18:	55                   	push   %ebp
+  800c19:	89 e5                	mov    %esp,%ebp
+  800c1b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800c1e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  800c21:	eb 06                	jmp    800c29 <strcmp+0x11>
+    p++, q++;
+  800c23:	83 c1 01             	add    $0x1,%ecx
+  800c26:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  800c29:	0f b6 01             	movzbl (%ecx),%eax
+  800c2c:	84 c0                	test   %al,%al
+  800c2e:	74 04                	je     800c34 <strcmp+0x1c>
+  800c30:	3a 02                	cmp    (%edx),%al
+  800c32:	74 ef                	je     800c23 <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  800c34:	0f b6 c0             	movzbl %al,%eax
+  800c37:	0f b6 12             	movzbl (%edx),%edx
+  800c3a:	29 d0                	sub    %edx,%eax
+}
+  800c3c:	5d                   	pop    %ebp
+  800c3d:	c3                   	ret
+
+00800c3e <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800c3e:	55                   	push   %ebp
+  800c3f:	89 e5                	mov    %esp,%ebp
+  800c41:	53                   	push   %ebx
+  800c42:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c45:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c48:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  800c4b:	eb 09                	jmp    800c56 <strncmp+0x18>
+    n--, p++, q++;
+  800c4d:	83 ea 01             	sub    $0x1,%edx
+  800c50:	83 c0 01             	add    $0x1,%eax
+  800c53:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  800c56:	85 d2                	test   %edx,%edx
+  800c58:	74 18                	je     800c72 <strncmp+0x34>
+  800c5a:	0f b6 18             	movzbl (%eax),%ebx
+  800c5d:	84 db                	test   %bl,%bl
+  800c5f:	74 04                	je     800c65 <strncmp+0x27>
+  800c61:	3a 19                	cmp    (%ecx),%bl
+  800c63:	74 e8                	je     800c4d <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c65:	0f b6 00             	movzbl (%eax),%eax
+  800c68:	0f b6 11             	movzbl (%ecx),%edx
+  800c6b:	29 d0                	sub    %edx,%eax
+}
+  800c6d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800c70:	c9                   	leave
+  800c71:	c3                   	ret
+    return 0;
+  800c72:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c77:	eb f4                	jmp    800c6d <strncmp+0x2f>
+
+00800c79 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800c79:	55                   	push   %ebp
+  800c7a:	89 e5                	mov    %esp,%ebp
+  800c7c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c7f:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800c83:	eb 03                	jmp    800c88 <strchr+0xf>
+  800c85:	83 c0 01             	add    $0x1,%eax
+  800c88:	0f b6 10             	movzbl (%eax),%edx
+  800c8b:	84 d2                	test   %dl,%dl
+  800c8d:	74 06                	je     800c95 <strchr+0x1c>
+    if (*s == c)
+  800c8f:	38 ca                	cmp    %cl,%dl
+  800c91:	75 f2                	jne    800c85 <strchr+0xc>
+  800c93:	eb 05                	jmp    800c9a <strchr+0x21>
+      return (char*)s;
+  return 0;
+  800c95:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c9a:	5d                   	pop    %ebp
+  800c9b:	c3                   	ret
+
+00800c9c <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800c9c:	55                   	push   %ebp
+  800c9d:	89 e5                	mov    %esp,%ebp
+  800c9f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ca2:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800ca6:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  800ca9:	38 ca                	cmp    %cl,%dl
+  800cab:	74 09                	je     800cb6 <strfind+0x1a>
+  800cad:	84 d2                	test   %dl,%dl
+  800caf:	74 05                	je     800cb6 <strfind+0x1a>
+  for (; *s; s++)
+  800cb1:	83 c0 01             	add    $0x1,%eax
+  800cb4:	eb f0                	jmp    800ca6 <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  800cb6:	5d                   	pop    %ebp
+  800cb7:	c3                   	ret
+
+00800cb8 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800cb8:	55                   	push   %ebp
+  800cb9:	89 e5                	mov    %esp,%ebp
+  800cbb:	57                   	push   %edi
+  800cbc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800cbf:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  800cc2:	85 c9                	test   %ecx,%ecx
+  800cc4:	74 20                	je     800ce6 <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  800cc6:	89 f8                	mov    %edi,%eax
+  800cc8:	09 c8                	or     %ecx,%eax
+  800cca:	a8 03                	test   $0x3,%al
+  800ccc:	75 12                	jne    800ce0 <memset+0x28>
+    c &= 0xFF;
+  800cce:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800cd2:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  800cd8:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  800cdb:	fc                   	cld
+  800cdc:	f3 ab                	rep stos %eax,%es:(%edi)
+  800cde:	eb 06                	jmp    800ce6 <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  800ce0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ce3:	fc                   	cld
+  800ce4:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  800ce6:	89 f8                	mov    %edi,%eax
+  800ce8:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800ceb:	c9                   	leave
+  800cec:	c3                   	ret
+
+00800ced <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800ced:	55                   	push   %ebp
+  800cee:	89 e5                	mov    %esp,%ebp
+  800cf0:	57                   	push   %edi
+  800cf1:	56                   	push   %esi
+  800cf2:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cf5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800cf8:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  800cfb:	39 c6                	cmp    %eax,%esi
+  800cfd:	73 32                	jae    800d31 <memmove+0x44>
+  800cff:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800d02:	39 d0                	cmp    %edx,%eax
+  800d04:	73 2b                	jae    800d31 <memmove+0x44>
+    s += n;
+    d += n;
+  800d06:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800d09:	89 d6                	mov    %edx,%esi
+  800d0b:	09 fe                	or     %edi,%esi
+  800d0d:	09 ce                	or     %ecx,%esi
+  800d0f:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800d15:	75 0e                	jne    800d25 <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800d17:	83 ef 04             	sub    $0x4,%edi
+  800d1a:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800d1d:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  800d20:	fd                   	std
+  800d21:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d23:	eb 09                	jmp    800d2e <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800d25:	83 ef 01             	sub    $0x1,%edi
+  800d28:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  800d2b:	fd                   	std
+  800d2c:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  800d2e:	fc                   	cld
+  800d2f:	eb 1a                	jmp    800d4b <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800d31:	89 f2                	mov    %esi,%edx
+  800d33:	09 c2                	or     %eax,%edx
+  800d35:	09 ca                	or     %ecx,%edx
+  800d37:	f6 c2 03             	test   $0x3,%dl
+  800d3a:	75 0a                	jne    800d46 <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800d3c:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  800d3f:	89 c7                	mov    %eax,%edi
+  800d41:	fc                   	cld
+  800d42:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800d44:	eb 05                	jmp    800d4b <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  800d46:	89 c7                	mov    %eax,%edi
+  800d48:	fc                   	cld
+  800d49:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  800d4b:	5e                   	pop    %esi
+  800d4c:	5f                   	pop    %edi
+  800d4d:	5d                   	pop    %ebp
+  800d4e:	c3                   	ret
+
+00800d4f <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800d4f:	55                   	push   %ebp
+  800d50:	89 e5                	mov    %esp,%ebp
+  800d52:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  800d55:	ff 75 10             	push   0x10(%ebp)
+  800d58:	ff 75 0c             	push   0xc(%ebp)
+  800d5b:	ff 75 08             	push   0x8(%ebp)
+  800d5e:	e8 8a ff ff ff       	call   800ced <memmove>
+}
+  800d63:	c9                   	leave
+  800d64:	c3                   	ret
+
+00800d65 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800d65:	55                   	push   %ebp
+  800d66:	89 e5                	mov    %esp,%ebp
+  800d68:	56                   	push   %esi
+  800d69:	53                   	push   %ebx
+  800d6a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d6d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  800d70:	89 c6                	mov    %eax,%esi
+  800d72:	03 75 10             	add    0x10(%ebp),%esi
+  800d75:	eb 06                	jmp    800d7d <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  800d77:	83 c0 01             	add    $0x1,%eax
+  800d7a:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  800d7d:	39 f0                	cmp    %esi,%eax
+  800d7f:	74 14                	je     800d95 <memcmp+0x30>
+    if (*s1 != *s2)
+  800d81:	0f b6 08             	movzbl (%eax),%ecx
+  800d84:	0f b6 1a             	movzbl (%edx),%ebx
+  800d87:	38 d9                	cmp    %bl,%cl
+  800d89:	74 ec                	je     800d77 <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  800d8b:	0f b6 c1             	movzbl %cl,%eax
+  800d8e:	0f b6 db             	movzbl %bl,%ebx
+  800d91:	29 d8                	sub    %ebx,%eax
+  800d93:	eb 05                	jmp    800d9a <memcmp+0x35>
+  }
+
+  return 0;
+  800d95:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d9a:	5b                   	pop    %ebx
+  800d9b:	5e                   	pop    %esi
+  800d9c:	5d                   	pop    %ebp
+  800d9d:	c3                   	ret
+
+00800d9e <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800d9e:	55                   	push   %ebp
+  800d9f:	89 e5                	mov    %esp,%ebp
+  800da1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800da4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  800da7:	89 c2                	mov    %eax,%edx
+  800da9:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  800dac:	eb 03                	jmp    800db1 <memfind+0x13>
+  800dae:	83 c0 01             	add    $0x1,%eax
+  800db1:	39 d0                	cmp    %edx,%eax
+  800db3:	73 04                	jae    800db9 <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  800db5:	38 08                	cmp    %cl,(%eax)
+  800db7:	75 f5                	jne    800dae <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  800db9:	5d                   	pop    %ebp
+  800dba:	c3                   	ret
+
+00800dbb <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800dbb:	55                   	push   %ebp
+  800dbc:	89 e5                	mov    %esp,%ebp
+  800dbe:	57                   	push   %edi
+  800dbf:	56                   	push   %esi
+  800dc0:	53                   	push   %ebx
+  800dc1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dc4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  800dc7:	eb 03                	jmp    800dcc <strtol+0x11>
+    s++;
+  800dc9:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  800dcc:	0f b6 02             	movzbl (%edx),%eax
+  800dcf:	3c 20                	cmp    $0x20,%al
+  800dd1:	74 f6                	je     800dc9 <strtol+0xe>
+  800dd3:	3c 09                	cmp    $0x9,%al
+  800dd5:	74 f2                	je     800dc9 <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  800dd7:	3c 2b                	cmp    $0x2b,%al
+  800dd9:	74 2a                	je     800e05 <strtol+0x4a>
+  int neg = 0;
+  800ddb:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  800de0:	3c 2d                	cmp    $0x2d,%al
+  800de2:	74 2b                	je     800e0f <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800de4:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800dea:	75 0f                	jne    800dfb <strtol+0x40>
+  800dec:	80 3a 30             	cmpb   $0x30,(%edx)
+  800def:	74 28                	je     800e19 <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  800df1:	85 db                	test   %ebx,%ebx
+  800df3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800df8:	0f 44 d8             	cmove  %eax,%ebx
+  800dfb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e00:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800e03:	eb 46                	jmp    800e4b <strtol+0x90>
+    s++;
+  800e05:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  800e08:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e0d:	eb d5                	jmp    800de4 <strtol+0x29>
+    s++, neg = 1;
+  800e0f:	83 c2 01             	add    $0x1,%edx
+  800e12:	bf 01 00 00 00       	mov    $0x1,%edi
+  800e17:	eb cb                	jmp    800de4 <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800e19:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800e1d:	74 0e                	je     800e2d <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  800e1f:	85 db                	test   %ebx,%ebx
+  800e21:	75 d8                	jne    800dfb <strtol+0x40>
+    s++, base = 8;
+  800e23:	83 c2 01             	add    $0x1,%edx
+  800e26:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800e2b:	eb ce                	jmp    800dfb <strtol+0x40>
+    s += 2, base = 16;
+  800e2d:	83 c2 02             	add    $0x2,%edx
+  800e30:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800e35:	eb c4                	jmp    800dfb <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  800e37:	0f be c0             	movsbl %al,%eax
+  800e3a:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  800e3d:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800e40:	7d 3a                	jge    800e7c <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  800e42:	83 c2 01             	add    $0x1,%edx
+  800e45:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800e49:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  800e4b:	0f b6 02             	movzbl (%edx),%eax
+  800e4e:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800e51:	89 f3                	mov    %esi,%ebx
+  800e53:	80 fb 09             	cmp    $0x9,%bl
+  800e56:	76 df                	jbe    800e37 <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  800e58:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800e5b:	89 f3                	mov    %esi,%ebx
+  800e5d:	80 fb 19             	cmp    $0x19,%bl
+  800e60:	77 08                	ja     800e6a <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  800e62:	0f be c0             	movsbl %al,%eax
+  800e65:	83 e8 57             	sub    $0x57,%eax
+  800e68:	eb d3                	jmp    800e3d <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  800e6a:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800e6d:	89 f3                	mov    %esi,%ebx
+  800e6f:	80 fb 19             	cmp    $0x19,%bl
+  800e72:	77 08                	ja     800e7c <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  800e74:	0f be c0             	movsbl %al,%eax
+  800e77:	83 e8 37             	sub    $0x37,%eax
+  800e7a:	eb c1                	jmp    800e3d <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  800e7c:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800e80:	74 05                	je     800e87 <strtol+0xcc>
+    *endptr = (char*)s;
+  800e82:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800e85:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  800e87:	89 c8                	mov    %ecx,%eax
+  800e89:	f7 d8                	neg    %eax
+  800e8b:	85 ff                	test   %edi,%edi
+  800e8d:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800e90:	89 c8                	mov    %ecx,%eax
+  800e92:	5b                   	pop    %ebx
+  800e93:	5e                   	pop    %esi
+  800e94:	5f                   	pop    %edi
+  800e95:	5d                   	pop    %ebp
+  800e96:	c3                   	ret
+
+00800e97 <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800e97:	55                   	push   %ebp
+  800e98:	89 e5                	mov    %esp,%ebp
+  800e9a:	57                   	push   %edi
+  800e9b:	56                   	push   %esi
+  800e9c:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e9d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ea2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ea5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ea8:	89 c3                	mov    %eax,%ebx
+  800eaa:	89 c7                	mov    %eax,%edi
+  800eac:	89 c6                	mov    %eax,%esi
+  800eae:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800eb0:	5b                   	pop    %ebx
+  800eb1:	5e                   	pop    %esi
+  800eb2:	5f                   	pop    %edi
+  800eb3:	5d                   	pop    %ebp
+  800eb4:	c3                   	ret
+
+00800eb5 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800eb5:	55                   	push   %ebp
+  800eb6:	89 e5                	mov    %esp,%ebp
+  800eb8:	57                   	push   %edi
+  800eb9:	56                   	push   %esi
+  800eba:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800ebb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ec0:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ec5:	89 d1                	mov    %edx,%ecx
+  800ec7:	89 d3                	mov    %edx,%ebx
+  800ec9:	89 d7                	mov    %edx,%edi
+  800ecb:	89 d6                	mov    %edx,%esi
+  800ecd:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800ecf:	5b                   	pop    %ebx
+  800ed0:	5e                   	pop    %esi
+  800ed1:	5f                   	pop    %edi
+  800ed2:	5d                   	pop    %ebp
+  800ed3:	c3                   	ret
+
+00800ed4 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800ed4:	55                   	push   %ebp
+  800ed5:	89 e5                	mov    %esp,%ebp
+  800ed7:	57                   	push   %edi
+  800ed8:	56                   	push   %esi
+  800ed9:	53                   	push   %ebx
+  800eda:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800edd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ee2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee5:	b8 03 00 00 00       	mov    $0x3,%eax
+  800eea:	89 cb                	mov    %ecx,%ebx
+  800eec:	89 cf                	mov    %ecx,%edi
+  800eee:	89 ce                	mov    %ecx,%esi
+  800ef0:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ef2:	85 c0                	test   %eax,%eax
+  800ef4:	7f 08                	jg     800efe <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800ef6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ef9:	5b                   	pop    %ebx
+  800efa:	5e                   	pop    %esi
+  800efb:	5f                   	pop    %edi
+  800efc:	5d                   	pop    %ebp
+  800efd:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800efe:	83 ec 0c             	sub    $0xc,%esp
+  800f01:	50                   	push   %eax
+  800f02:	6a 03                	push   $0x3
+  800f04:	68 83 36 80 00       	push   $0x803683
+  800f09:	6a 23                	push   $0x23
+  800f0b:	68 a0 36 80 00       	push   $0x8036a0
+  800f10:	e8 89 f5 ff ff       	call   80049e <_panic>
+
+00800f15 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800f15:	55                   	push   %ebp
+  800f16:	89 e5                	mov    %esp,%ebp
+  800f18:	57                   	push   %edi
+  800f19:	56                   	push   %esi
+  800f1a:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f1b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f20:	b8 02 00 00 00       	mov    $0x2,%eax
+  800f25:	89 d1                	mov    %edx,%ecx
+  800f27:	89 d3                	mov    %edx,%ebx
+  800f29:	89 d7                	mov    %edx,%edi
+  800f2b:	89 d6                	mov    %edx,%esi
+  800f2d:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800f2f:	5b                   	pop    %ebx
+  800f30:	5e                   	pop    %esi
+  800f31:	5f                   	pop    %edi
+  800f32:	5d                   	pop    %ebp
+  800f33:	c3                   	ret
+
+00800f34 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800f34:	55                   	push   %ebp
+  800f35:	89 e5                	mov    %esp,%ebp
+  800f37:	57                   	push   %edi
+  800f38:	56                   	push   %esi
+  800f39:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f3a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f3f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800f44:	89 d1                	mov    %edx,%ecx
+  800f46:	89 d3                	mov    %edx,%ebx
+  800f48:	89 d7                	mov    %edx,%edi
+  800f4a:	89 d6                	mov    %edx,%esi
+  800f4c:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800f4e:	5b                   	pop    %ebx
+  800f4f:	5e                   	pop    %esi
+  800f50:	5f                   	pop    %edi
+  800f51:	5d                   	pop    %ebp
+  800f52:	c3                   	ret
+
+00800f53 <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  800f53:	55                   	push   %ebp
+  800f54:	89 e5                	mov    %esp,%ebp
+  800f56:	57                   	push   %edi
+  800f57:	56                   	push   %esi
+  800f58:	53                   	push   %ebx
+  800f59:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  800f5c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  800f60:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f65:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f68:	b8 14 00 00 00       	mov    $0x14,%eax
+  800f6d:	89 df                	mov    %ebx,%edi
+  800f6f:	89 de                	mov    %ebx,%esi
+  800f71:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f73:	85 c0                	test   %eax,%eax
+  800f75:	7f 08                	jg     800f7f <sys_env_set_cow+0x2c>
+}
+  800f77:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f7a:	5b                   	pop    %ebx
+  800f7b:	5e                   	pop    %esi
+  800f7c:	5f                   	pop    %edi
+  800f7d:	5d                   	pop    %ebp
+  800f7e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f7f:	83 ec 0c             	sub    $0xc,%esp
+  800f82:	50                   	push   %eax
+  800f83:	6a 14                	push   $0x14
+  800f85:	68 83 36 80 00       	push   $0x803683
+  800f8a:	6a 23                	push   $0x23
+  800f8c:	68 a0 36 80 00       	push   $0x8036a0
+  800f91:	e8 08 f5 ff ff       	call   80049e <_panic>
+
+00800f96 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800f96:	55                   	push   %ebp
+  800f97:	89 e5                	mov    %esp,%ebp
+  800f99:	57                   	push   %edi
+  800f9a:	56                   	push   %esi
+  800f9b:	53                   	push   %ebx
+  800f9c:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f9f:	be 00 00 00 00       	mov    $0x0,%esi
+  800fa4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800faa:	b8 04 00 00 00       	mov    $0x4,%eax
+  800faf:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fb2:	89 f7                	mov    %esi,%edi
+  800fb4:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800fb6:	85 c0                	test   %eax,%eax
+  800fb8:	7f 08                	jg     800fc2 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  800fba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fbd:	5b                   	pop    %ebx
+  800fbe:	5e                   	pop    %esi
+  800fbf:	5f                   	pop    %edi
+  800fc0:	5d                   	pop    %ebp
+  800fc1:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800fc2:	83 ec 0c             	sub    $0xc,%esp
+  800fc5:	50                   	push   %eax
+  800fc6:	6a 04                	push   $0x4
+  800fc8:	68 83 36 80 00       	push   $0x803683
+  800fcd:	6a 23                	push   $0x23
+  800fcf:	68 a0 36 80 00       	push   $0x8036a0
+  800fd4:	e8 c5 f4 ff ff       	call   80049e <_panic>
+
+00800fd9 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800fd9:	55                   	push   %ebp
+  800fda:	89 e5                	mov    %esp,%ebp
+  800fdc:	57                   	push   %edi
+  800fdd:	56                   	push   %esi
+  800fde:	53                   	push   %ebx
+  800fdf:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800fe2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fe5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fe8:	b8 05 00 00 00       	mov    $0x5,%eax
+  800fed:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ff0:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ff3:	8b 75 18             	mov    0x18(%ebp),%esi
+  800ff6:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ff8:	85 c0                	test   %eax,%eax
+  800ffa:	7f 08                	jg     801004 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  800ffc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fff:	5b                   	pop    %ebx
+  801000:	5e                   	pop    %esi
+  801001:	5f                   	pop    %edi
+  801002:	5d                   	pop    %ebp
+  801003:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801004:	83 ec 0c             	sub    $0xc,%esp
+  801007:	50                   	push   %eax
+  801008:	6a 05                	push   $0x5
+  80100a:	68 83 36 80 00       	push   $0x803683
+  80100f:	6a 23                	push   $0x23
+  801011:	68 a0 36 80 00       	push   $0x8036a0
+  801016:	e8 83 f4 ff ff       	call   80049e <_panic>
+
+0080101b <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  80101b:	55                   	push   %ebp
+  80101c:	89 e5                	mov    %esp,%ebp
+  80101e:	57                   	push   %edi
+  80101f:	56                   	push   %esi
+  801020:	53                   	push   %ebx
+  801021:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801024:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801029:	8b 55 08             	mov    0x8(%ebp),%edx
+  80102c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80102f:	b8 06 00 00 00       	mov    $0x6,%eax
+  801034:	89 df                	mov    %ebx,%edi
+  801036:	89 de                	mov    %ebx,%esi
+  801038:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80103a:	85 c0                	test   %eax,%eax
+  80103c:	7f 08                	jg     801046 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  80103e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801041:	5b                   	pop    %ebx
+  801042:	5e                   	pop    %esi
+  801043:	5f                   	pop    %edi
+  801044:	5d                   	pop    %ebp
+  801045:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801046:	83 ec 0c             	sub    $0xc,%esp
+  801049:	50                   	push   %eax
+  80104a:	6a 06                	push   $0x6
+  80104c:	68 83 36 80 00       	push   $0x803683
+  801051:	6a 23                	push   $0x23
+  801053:	68 a0 36 80 00       	push   $0x8036a0
+  801058:	e8 41 f4 ff ff       	call   80049e <_panic>
+
+0080105d <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  80105d:	55                   	push   %ebp
+  80105e:	89 e5                	mov    %esp,%ebp
+  801060:	57                   	push   %edi
+  801061:	56                   	push   %esi
+  801062:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801063:	8b 55 08             	mov    0x8(%ebp),%edx
+  801066:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801069:	b8 11 00 00 00       	mov    $0x11,%eax
+  80106e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801071:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801074:	8b 75 18             	mov    0x18(%ebp),%esi
+  801077:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  801079:	5b                   	pop    %ebx
+  80107a:	5e                   	pop    %esi
+  80107b:	5f                   	pop    %edi
+  80107c:	5d                   	pop    %ebp
+  80107d:	c3                   	ret
+
+0080107e <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  80107e:	55                   	push   %ebp
+  80107f:	89 e5                	mov    %esp,%ebp
+  801081:	57                   	push   %edi
+  801082:	56                   	push   %esi
+  801083:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801084:	8b 55 08             	mov    0x8(%ebp),%edx
+  801087:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80108a:	b8 12 00 00 00       	mov    $0x12,%eax
+  80108f:	be 00 00 00 00       	mov    $0x0,%esi
+  801094:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801097:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80109a:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  80109c:	5b                   	pop    %ebx
+  80109d:	5e                   	pop    %esi
+  80109e:	5f                   	pop    %edi
+  80109f:	5d                   	pop    %ebp
+  8010a0:	c3                   	ret
+
+008010a1 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  8010a1:	55                   	push   %ebp
+  8010a2:	89 e5                	mov    %esp,%ebp
+  8010a4:	57                   	push   %edi
+  8010a5:	56                   	push   %esi
+  8010a6:	53                   	push   %ebx
+  8010a7:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8010aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010af:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010b5:	b8 16 00 00 00       	mov    $0x16,%eax
+  8010ba:	89 df                	mov    %ebx,%edi
+  8010bc:	89 de                	mov    %ebx,%esi
+  8010be:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8010c0:	85 c0                	test   %eax,%eax
+  8010c2:	7f 08                	jg     8010cc <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  8010c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010c7:	5b                   	pop    %ebx
+  8010c8:	5e                   	pop    %esi
+  8010c9:	5f                   	pop    %edi
+  8010ca:	5d                   	pop    %ebp
+  8010cb:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8010cc:	83 ec 0c             	sub    $0xc,%esp
+  8010cf:	50                   	push   %eax
+  8010d0:	6a 16                	push   $0x16
+  8010d2:	68 83 36 80 00       	push   $0x803683
+  8010d7:	6a 23                	push   $0x23
+  8010d9:	68 a0 36 80 00       	push   $0x8036a0
+  8010de:	e8 bb f3 ff ff       	call   80049e <_panic>
+
+008010e3 <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  8010e3:	55                   	push   %ebp
+  8010e4:	89 e5                	mov    %esp,%ebp
+  8010e6:	57                   	push   %edi
+  8010e7:	56                   	push   %esi
+  8010e8:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8010e9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8010ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f1:	b8 17 00 00 00       	mov    $0x17,%eax
+  8010f6:	89 cb                	mov    %ecx,%ebx
+  8010f8:	89 cf                	mov    %ecx,%edi
+  8010fa:	89 ce                	mov    %ecx,%esi
+  8010fc:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  8010fe:	5b                   	pop    %ebx
+  8010ff:	5e                   	pop    %esi
+  801100:	5f                   	pop    %edi
+  801101:	5d                   	pop    %ebp
+  801102:	c3                   	ret
+
+00801103 <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  801103:	55                   	push   %ebp
+  801104:	89 e5                	mov    %esp,%ebp
+  801106:	57                   	push   %edi
+  801107:	56                   	push   %esi
+  801108:	53                   	push   %ebx
+  801109:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80110c:	be 00 00 00 00       	mov    $0x0,%esi
+  801111:	8b 55 08             	mov    0x8(%ebp),%edx
+  801114:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801117:	b8 18 00 00 00       	mov    $0x18,%eax
+  80111c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80111f:	89 f7                	mov    %esi,%edi
+  801121:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801123:	85 c0                	test   %eax,%eax
+  801125:	7f 08                	jg     80112f <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  801127:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80112a:	5b                   	pop    %ebx
+  80112b:	5e                   	pop    %esi
+  80112c:	5f                   	pop    %edi
+  80112d:	5d                   	pop    %ebp
+  80112e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80112f:	83 ec 0c             	sub    $0xc,%esp
+  801132:	50                   	push   %eax
+  801133:	6a 18                	push   $0x18
+  801135:	68 83 36 80 00       	push   $0x803683
+  80113a:	6a 23                	push   $0x23
+  80113c:	68 a0 36 80 00       	push   $0x8036a0
+  801141:	e8 58 f3 ff ff       	call   80049e <_panic>
+
+00801146 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  801146:	55                   	push   %ebp
+  801147:	89 e5                	mov    %esp,%ebp
+  801149:	57                   	push   %edi
+  80114a:	56                   	push   %esi
+  80114b:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80114c:	be 00 00 00 00       	mov    $0x0,%esi
+  801151:	8b 55 08             	mov    0x8(%ebp),%edx
+  801154:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801157:	b8 19 00 00 00       	mov    $0x19,%eax
+  80115c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80115f:	89 f7                	mov    %esi,%edi
+  801161:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  801163:	5b                   	pop    %ebx
+  801164:	5e                   	pop    %esi
+  801165:	5f                   	pop    %edi
+  801166:	5d                   	pop    %ebp
+  801167:	c3                   	ret
+
+00801168 <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  801168:	55                   	push   %ebp
+  801169:	89 e5                	mov    %esp,%ebp
+  80116b:	57                   	push   %edi
+  80116c:	56                   	push   %esi
+  80116d:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80116e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801173:	b8 15 00 00 00       	mov    $0x15,%eax
+  801178:	89 d1                	mov    %edx,%ecx
+  80117a:	89 d3                	mov    %edx,%ebx
+  80117c:	89 d7                	mov    %edx,%edi
+  80117e:	89 d6                	mov    %edx,%esi
+  801180:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  801182:	5b                   	pop    %ebx
+  801183:	5e                   	pop    %esi
+  801184:	5f                   	pop    %edi
+  801185:	5d                   	pop    %ebp
+  801186:	c3                   	ret
+
+00801187 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801187:	55                   	push   %ebp
+  801188:	89 e5                	mov    %esp,%ebp
+  80118a:	57                   	push   %edi
+  80118b:	56                   	push   %esi
+  80118c:	53                   	push   %ebx
+  80118d:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801190:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801195:	8b 55 08             	mov    0x8(%ebp),%edx
+  801198:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80119b:	b8 08 00 00 00       	mov    $0x8,%eax
+  8011a0:	89 df                	mov    %ebx,%edi
+  8011a2:	89 de                	mov    %ebx,%esi
+  8011a4:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8011a6:	85 c0                	test   %eax,%eax
+  8011a8:	7f 08                	jg     8011b2 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8011aa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011ad:	5b                   	pop    %ebx
+  8011ae:	5e                   	pop    %esi
+  8011af:	5f                   	pop    %edi
+  8011b0:	5d                   	pop    %ebp
+  8011b1:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8011b2:	83 ec 0c             	sub    $0xc,%esp
+  8011b5:	50                   	push   %eax
+  8011b6:	6a 08                	push   $0x8
+  8011b8:	68 83 36 80 00       	push   $0x803683
+  8011bd:	6a 23                	push   $0x23
+  8011bf:	68 a0 36 80 00       	push   $0x8036a0
+  8011c4:	e8 d5 f2 ff ff       	call   80049e <_panic>
+
+008011c9 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8011c9:	55                   	push   %ebp
+  8011ca:	89 e5                	mov    %esp,%ebp
+  8011cc:	57                   	push   %edi
+  8011cd:	56                   	push   %esi
+  8011ce:	53                   	push   %ebx
+  8011cf:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8011d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011d7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011da:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011dd:	b8 09 00 00 00       	mov    $0x9,%eax
+  8011e2:	89 df                	mov    %ebx,%edi
+  8011e4:	89 de                	mov    %ebx,%esi
+  8011e6:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8011e8:	85 c0                	test   %eax,%eax
+  8011ea:	7f 08                	jg     8011f4 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  8011ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011ef:	5b                   	pop    %ebx
+  8011f0:	5e                   	pop    %esi
+  8011f1:	5f                   	pop    %edi
+  8011f2:	5d                   	pop    %ebp
+  8011f3:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8011f4:	83 ec 0c             	sub    $0xc,%esp
+  8011f7:	50                   	push   %eax
+  8011f8:	6a 09                	push   $0x9
+  8011fa:	68 83 36 80 00       	push   $0x803683
+  8011ff:	6a 23                	push   $0x23
+  801201:	68 a0 36 80 00       	push   $0x8036a0
+  801206:	e8 93 f2 ff ff       	call   80049e <_panic>
+
+0080120b <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80120b:	55                   	push   %ebp
+  80120c:	89 e5                	mov    %esp,%ebp
+  80120e:	57                   	push   %edi
+  80120f:	56                   	push   %esi
+  801210:	53                   	push   %ebx
+  801211:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801214:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801219:	8b 55 08             	mov    0x8(%ebp),%edx
+  80121c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80121f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801224:	89 df                	mov    %ebx,%edi
+  801226:	89 de                	mov    %ebx,%esi
+  801228:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80122a:	85 c0                	test   %eax,%eax
+  80122c:	7f 08                	jg     801236 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  80122e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801231:	5b                   	pop    %ebx
+  801232:	5e                   	pop    %esi
+  801233:	5f                   	pop    %edi
+  801234:	5d                   	pop    %ebp
+  801235:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801236:	83 ec 0c             	sub    $0xc,%esp
+  801239:	50                   	push   %eax
+  80123a:	6a 0a                	push   $0xa
+  80123c:	68 83 36 80 00       	push   $0x803683
+  801241:	6a 23                	push   $0x23
+  801243:	68 a0 36 80 00       	push   $0x8036a0
+  801248:	e8 51 f2 ff ff       	call   80049e <_panic>
+
+0080124d <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  80124d:	55                   	push   %ebp
+  80124e:	89 e5                	mov    %esp,%ebp
+  801250:	57                   	push   %edi
+  801251:	56                   	push   %esi
+  801252:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801253:	8b 55 08             	mov    0x8(%ebp),%edx
+  801256:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801259:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80125e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801261:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801264:	8b 75 18             	mov    0x18(%ebp),%esi
+  801267:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  801269:	5b                   	pop    %ebx
+  80126a:	5e                   	pop    %esi
+  80126b:	5f                   	pop    %edi
+  80126c:	5d                   	pop    %ebp
+  80126d:	c3                   	ret
+
+0080126e <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  80126e:	55                   	push   %ebp
+  80126f:	89 e5                	mov    %esp,%ebp
+  801271:	57                   	push   %edi
+  801272:	56                   	push   %esi
+  801273:	53                   	push   %ebx
+  801274:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801277:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80127c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80127f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801282:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801287:	89 df                	mov    %ebx,%edi
+  801289:	89 de                	mov    %ebx,%esi
+  80128b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80128d:	85 c0                	test   %eax,%eax
+  80128f:	7f 08                	jg     801299 <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  801291:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801294:	5b                   	pop    %ebx
+  801295:	5e                   	pop    %esi
+  801296:	5f                   	pop    %edi
+  801297:	5d                   	pop    %ebp
+  801298:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801299:	83 ec 0c             	sub    $0xc,%esp
+  80129c:	50                   	push   %eax
+  80129d:	6a 0d                	push   $0xd
+  80129f:	68 83 36 80 00       	push   $0x803683
+  8012a4:	6a 23                	push   $0x23
+  8012a6:	68 a0 36 80 00       	push   $0x8036a0
+  8012ab:	e8 ee f1 ff ff       	call   80049e <_panic>
+
+008012b0 <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  8012b0:	55                   	push   %ebp
+  8012b1:	89 e5                	mov    %esp,%ebp
+  8012b3:	57                   	push   %edi
+  8012b4:	56                   	push   %esi
+  8012b5:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8012b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012bb:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8012c0:	89 d1                	mov    %edx,%ecx
+  8012c2:	89 d3                	mov    %edx,%ebx
+  8012c4:	89 d7                	mov    %edx,%edi
+  8012c6:	89 d6                	mov    %edx,%esi
+  8012c8:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8012ca:	5b                   	pop    %ebx
+  8012cb:	5e                   	pop    %esi
+  8012cc:	5f                   	pop    %edi
+  8012cd:	5d                   	pop    %ebp
+  8012ce:	c3                   	ret
+
+008012cf <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  8012cf:	55                   	push   %ebp
+  8012d0:	89 e5                	mov    %esp,%ebp
+  8012d2:	57                   	push   %edi
+  8012d3:	56                   	push   %esi
+  8012d4:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8012d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012d8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012db:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8012e0:	be 00 00 00 00       	mov    $0x0,%esi
+  8012e5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012e8:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012eb:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  8012ed:	5b                   	pop    %ebx
+  8012ee:	5e                   	pop    %esi
+  8012ef:	5f                   	pop    %edi
+  8012f0:	5d                   	pop    %ebp
+  8012f1:	c3                   	ret
+
+008012f2 <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  8012f2:	55                   	push   %ebp
+  8012f3:	89 e5                	mov    %esp,%ebp
+  8012f5:	57                   	push   %edi
+  8012f6:	56                   	push   %esi
+  8012f7:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8012f8:	be 00 00 00 00       	mov    $0x0,%esi
+  8012fd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801300:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801303:	b8 10 00 00 00       	mov    $0x10,%eax
+  801308:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80130b:	89 f7                	mov    %esi,%edi
+  80130d:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  80130f:	5b                   	pop    %ebx
+  801310:	5e                   	pop    %esi
+  801311:	5f                   	pop    %edi
+  801312:	5d                   	pop    %ebp
+  801313:	c3                   	ret
+
+00801314 <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  801314:	55                   	push   %ebp
+  801315:	89 e5                	mov    %esp,%ebp
+  801317:	57                   	push   %edi
+  801318:	56                   	push   %esi
+  801319:	53                   	push   %ebx
+  80131a:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  80131d:	80 3d 68 6b 80 00 00 	cmpb   $0x0,0x806b68
+  801324:	74 41                	je     801367 <sys_batch+0x53>
+  801326:	8b 45 08             	mov    0x8(%ebp),%eax
+  801329:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  80132c:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  801333:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801336:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  801339:	7d 45                	jge    801380 <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  80133b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80133e:	8b 06                	mov    (%esi),%eax
+  801340:	8b 56 04             	mov    0x4(%esi),%edx
+  801343:	8b 4e 08             	mov    0x8(%esi),%ecx
+  801346:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  801349:	8b 7e 10             	mov    0x10(%esi),%edi
+  80134c:	8b 76 14             	mov    0x14(%esi),%esi
+  80134f:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  801351:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801354:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  801357:	83 c6 1c             	add    $0x1c,%esi
+  80135a:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  80135d:	85 c0                	test   %eax,%eax
+  80135f:	78 1f                	js     801380 <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  801361:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  801365:	eb cc                	jmp    801333 <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  801367:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80136c:	b8 13 00 00 00       	mov    $0x13,%eax
+  801371:	8b 55 08             	mov    0x8(%ebp),%edx
+  801374:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801377:	89 df                	mov    %ebx,%edi
+  801379:	89 de                	mov    %ebx,%esi
+  80137b:	cd 30                	int    $0x30
+  80137d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  801380:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801383:	83 c4 08             	add    $0x8,%esp
+  801386:	5b                   	pop    %ebx
+  801387:	5e                   	pop    %esi
+  801388:	5f                   	pop    %edi
+  801389:	5d                   	pop    %ebp
+  80138a:	c3                   	ret
+
+0080138b <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  80138b:	55                   	push   %ebp
+  80138c:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  80138e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801391:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  801397:	5d                   	pop    %ebp
+  801398:	c3                   	ret
+
+00801399 <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  801399:	55                   	push   %ebp
+  80139a:	89 e5                	mov    %esp,%ebp
+  80139c:	56                   	push   %esi
+  80139d:	53                   	push   %ebx
+  80139e:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  8013a1:	8b 1e                	mov    (%esi),%ebx
+  8013a3:	85 db                	test   %ebx,%ebx
+  8013a5:	75 09                	jne    8013b0 <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  8013a7:	89 d8                	mov    %ebx,%eax
+  8013a9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8013ac:	5b                   	pop    %ebx
+  8013ad:	5e                   	pop    %esi
+  8013ae:	5d                   	pop    %ebp
+  8013af:	c3                   	ret
+  b->sb_n = 0;
+  8013b0:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  8013b6:	53                   	push   %ebx
+  8013b7:	8d 46 04             	lea    0x4(%esi),%eax
+  8013ba:	50                   	push   %eax
+  8013bb:	e8 54 ff ff ff       	call   801314 <sys_batch>
+  8013c0:	83 c4 08             	add    $0x8,%esp
+  8013c3:	85 c0                	test   %eax,%eax
+  8013c5:	78 1e                	js     8013e5 <sysbatch_flush+0x4c>
+  if (r < n)
+  8013c7:	39 c3                	cmp    %eax,%ebx
+  8013c9:	7f 07                	jg     8013d2 <sysbatch_flush+0x39>
+  return 0;
+  8013cb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013d0:	eb d5                	jmp    8013a7 <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  8013d2:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8013d5:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  8013d9:	85 db                	test   %ebx,%ebx
+  8013db:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8013e0:	0f 49 d8             	cmovns %eax,%ebx
+  8013e3:	eb c2                	jmp    8013a7 <sysbatch_flush+0xe>
+    return r;
+  8013e5:	89 c3                	mov    %eax,%ebx
+  8013e7:	eb be                	jmp    8013a7 <sysbatch_flush+0xe>
+
+008013e9 <sysbatch_add>:
+{
+  8013e9:	55                   	push   %ebp
+  8013ea:	89 e5                	mov    %esp,%ebp
+  8013ec:	53                   	push   %ebx
+  8013ed:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  8013f0:	83 3b 40             	cmpl   $0x40,(%ebx)
+  8013f3:	74 41                	je     801436 <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  8013f5:	8b 03                	mov    (%ebx),%eax
+  8013f7:	8d 50 01             	lea    0x1(%eax),%edx
+  8013fa:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  8013fc:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8013ff:	01 d8                	add    %ebx,%eax
+  801401:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801404:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  801407:	8b 55 10             	mov    0x10(%ebp),%edx
+  80140a:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  80140d:	8b 55 14             	mov    0x14(%ebp),%edx
+  801410:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  801413:	8b 55 18             	mov    0x18(%ebp),%edx
+  801416:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  801419:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  80141c:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  80141f:	8b 55 20             	mov    0x20(%ebp),%edx
+  801422:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  801425:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  80142c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801431:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801434:	c9                   	leave
+  801435:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  801436:	53                   	push   %ebx
+  801437:	e8 5d ff ff ff       	call   801399 <sysbatch_flush>
+  80143c:	83 c4 04             	add    $0x4,%esp
+  80143f:	85 c0                	test   %eax,%eax
+  801441:	79 b2                	jns    8013f5 <sysbatch_add+0xc>
+  801443:	eb ec                	jmp    801431 <sysbatch_add+0x48>
+
+00801445 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801445:	55                   	push   %ebp
+  801446:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801448:	8b 45 08             	mov    0x8(%ebp),%eax
+  80144b:	05 00 00 00 30       	add    $0x30000000,%eax
+  801450:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801453:	5d                   	pop    %ebp
+  801454:	c3                   	ret
+
+00801455 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801455:	55                   	push   %ebp
+  801456:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801458:	8b 45 08             	mov    0x8(%ebp),%eax
+  80145b:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  80145e:	66 b8 00 00          	mov    $0x0,%ax
+  801462:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801467:	5d                   	pop    %ebp
+  801468:	c3                   	ret
+
+00801469 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801469:	55                   	push   %ebp
+  80146a:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  80146c:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801471:	eb 02                	jmp    801475 <fd_alloc+0xc>
+  801473:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801475:	89 c2                	mov    %eax,%edx
+  801477:	c1 ea 16             	shr    $0x16,%edx
+  80147a:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801481:	f6 c2 01             	test   $0x1,%dl
+  801484:	74 2b                	je     8014b1 <fd_alloc+0x48>
+  801486:	89 c2                	mov    %eax,%edx
+  801488:	c1 ea 0c             	shr    $0xc,%edx
+  80148b:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801492:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801498:	f6 c1 01             	test   $0x1,%cl
+  80149b:	74 14                	je     8014b1 <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  80149d:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8014a3:	75 ce                	jne    801473 <fd_alloc+0xa>
+  8014a5:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  8014aa:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8014af:	eb 05                	jmp    8014b6 <fd_alloc+0x4d>
+      return 0;
+  8014b1:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  8014b6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014b9:	89 02                	mov    %eax,(%edx)
+}
+  8014bb:	89 c8                	mov    %ecx,%eax
+  8014bd:	5d                   	pop    %ebp
+  8014be:	c3                   	ret
+
+008014bf <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8014bf:	55                   	push   %ebp
+  8014c0:	89 e5                	mov    %esp,%ebp
+  8014c2:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  8014c5:	83 f8 1f             	cmp    $0x1f,%eax
+  8014c8:	77 30                	ja     8014fa <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  8014ca:	c1 e0 0c             	shl    $0xc,%eax
+  8014cd:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8014d2:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8014d8:	f6 c2 01             	test   $0x1,%dl
+  8014db:	74 24                	je     801501 <fd_lookup+0x42>
+  8014dd:	89 c2                	mov    %eax,%edx
+  8014df:	c1 ea 0c             	shr    $0xc,%edx
+  8014e2:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8014e9:	f6 c2 01             	test   $0x1,%dl
+  8014ec:	74 1a                	je     801508 <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  8014ee:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8014f1:	89 02                	mov    %eax,(%edx)
+  return 0;
+  8014f3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8014f8:	5d                   	pop    %ebp
+  8014f9:	c3                   	ret
+    return -E_INVAL;
+  8014fa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014ff:	eb f7                	jmp    8014f8 <fd_lookup+0x39>
+    return -E_INVAL;
+  801501:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801506:	eb f0                	jmp    8014f8 <fd_lookup+0x39>
+  801508:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80150d:	eb e9                	jmp    8014f8 <fd_lookup+0x39>
+
+0080150f <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80150f:	55                   	push   %ebp
+  801510:	89 e5                	mov    %esp,%ebp
+  801512:	53                   	push   %ebx
+  801513:	83 ec 04             	sub    $0x4,%esp
+  801516:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  801519:	b8 2c 37 80 00       	mov    $0x80372c,%eax
+  80151e:	8b 18                	mov    (%eax),%ebx
+  801520:	85 db                	test   %ebx,%ebx
+  801522:	74 0e                	je     801532 <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  801524:	83 c0 04             	add    $0x4,%eax
+  801527:	39 13                	cmp    %edx,(%ebx)
+  801529:	75 f3                	jne    80151e <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  80152b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801530:	eb 1f                	jmp    801551 <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801532:	a1 64 6b 80 00       	mov    0x806b64,%eax
+  801537:	8b 40 48             	mov    0x48(%eax),%eax
+  80153a:	83 ec 04             	sub    $0x4,%esp
+  80153d:	52                   	push   %edx
+  80153e:	50                   	push   %eax
+  80153f:	68 b0 36 80 00       	push   $0x8036b0
+  801544:	e8 30 f0 ff ff       	call   800579 <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  801549:	83 c4 10             	add    $0x10,%esp
+  80154c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  801551:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801554:	89 1a                	mov    %ebx,(%edx)
+}
+  801556:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801559:	c9                   	leave
+  80155a:	c3                   	ret
+
+0080155b <fd_close>:
+{
+  80155b:	55                   	push   %ebp
+  80155c:	89 e5                	mov    %esp,%ebp
+  80155e:	57                   	push   %edi
+  80155f:	56                   	push   %esi
+  801560:	53                   	push   %ebx
+  801561:	83 ec 24             	sub    $0x24,%esp
+  801564:	8b 75 08             	mov    0x8(%ebp),%esi
+  801567:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80156a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80156d:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80156e:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801574:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801577:	50                   	push   %eax
+  801578:	e8 42 ff ff ff       	call   8014bf <fd_lookup>
+  80157d:	89 c3                	mov    %eax,%ebx
+  80157f:	83 c4 10             	add    $0x10,%esp
+  801582:	85 c0                	test   %eax,%eax
+  801584:	78 05                	js     80158b <fd_close+0x30>
+      || fd != fd2)
+  801586:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801589:	74 16                	je     8015a1 <fd_close+0x46>
+    return must_exist ? r : 0;
+  80158b:	89 f8                	mov    %edi,%eax
+  80158d:	84 c0                	test   %al,%al
+  80158f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801594:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801597:	89 d8                	mov    %ebx,%eax
+  801599:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80159c:	5b                   	pop    %ebx
+  80159d:	5e                   	pop    %esi
+  80159e:	5f                   	pop    %edi
+  80159f:	5d                   	pop    %ebp
+  8015a0:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8015a1:	83 ec 08             	sub    $0x8,%esp
+  8015a4:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8015a7:	50                   	push   %eax
+  8015a8:	ff 36                	push   (%esi)
+  8015aa:	e8 60 ff ff ff       	call   80150f <dev_lookup>
+  8015af:	89 c3                	mov    %eax,%ebx
+  8015b1:	83 c4 10             	add    $0x10,%esp
+  8015b4:	85 c0                	test   %eax,%eax
+  8015b6:	78 1a                	js     8015d2 <fd_close+0x77>
+    if (dev->dev_close)
+  8015b8:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8015bb:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  8015be:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  8015c3:	85 c0                	test   %eax,%eax
+  8015c5:	74 0b                	je     8015d2 <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  8015c7:	83 ec 0c             	sub    $0xc,%esp
+  8015ca:	56                   	push   %esi
+  8015cb:	ff d0                	call   *%eax
+  8015cd:	89 c3                	mov    %eax,%ebx
+  8015cf:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  8015d2:	83 ec 08             	sub    $0x8,%esp
+  8015d5:	56                   	push   %esi
+  8015d6:	6a 00                	push   $0x0
+  8015d8:	e8 3e fa ff ff       	call   80101b <sys_page_unmap>
+  return r;
+  8015dd:	83 c4 10             	add    $0x10,%esp
+  8015e0:	eb b5                	jmp    801597 <fd_close+0x3c>
+
+008015e2 <close>:
+
+int
+close(int fdnum)
+{
+  8015e2:	55                   	push   %ebp
+  8015e3:	89 e5                	mov    %esp,%ebp
+  8015e5:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8015e8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015eb:	50                   	push   %eax
+  8015ec:	ff 75 08             	push   0x8(%ebp)
+  8015ef:	e8 cb fe ff ff       	call   8014bf <fd_lookup>
+  8015f4:	83 c4 10             	add    $0x10,%esp
+  8015f7:	85 c0                	test   %eax,%eax
+  8015f9:	79 02                	jns    8015fd <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  8015fb:	c9                   	leave
+  8015fc:	c3                   	ret
+    return fd_close(fd, 1);
+  8015fd:	83 ec 08             	sub    $0x8,%esp
+  801600:	6a 01                	push   $0x1
+  801602:	ff 75 f4             	push   -0xc(%ebp)
+  801605:	e8 51 ff ff ff       	call   80155b <fd_close>
+  80160a:	83 c4 10             	add    $0x10,%esp
+  80160d:	eb ec                	jmp    8015fb <close+0x19>
+
+0080160f <close_all>:
+
+void
+close_all(void)
+{
+  80160f:	55                   	push   %ebp
+  801610:	89 e5                	mov    %esp,%ebp
+  801612:	53                   	push   %ebx
+  801613:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  801616:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  80161b:	83 ec 0c             	sub    $0xc,%esp
+  80161e:	53                   	push   %ebx
+  80161f:	e8 be ff ff ff       	call   8015e2 <close>
+  for (i = 0; i < MAXFD; i++)
+  801624:	83 c3 01             	add    $0x1,%ebx
+  801627:	83 c4 10             	add    $0x10,%esp
+  80162a:	83 fb 20             	cmp    $0x20,%ebx
+  80162d:	75 ec                	jne    80161b <close_all+0xc>
+}
+  80162f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801632:	c9                   	leave
+  801633:	c3                   	ret
+
+00801634 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801634:	55                   	push   %ebp
+  801635:	89 e5                	mov    %esp,%ebp
+  801637:	57                   	push   %edi
+  801638:	56                   	push   %esi
+  801639:	53                   	push   %ebx
+  80163a:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80163d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801640:	50                   	push   %eax
+  801641:	ff 75 08             	push   0x8(%ebp)
+  801644:	e8 76 fe ff ff       	call   8014bf <fd_lookup>
+  801649:	89 c6                	mov    %eax,%esi
+  80164b:	83 c4 10             	add    $0x10,%esp
+  80164e:	85 c0                	test   %eax,%eax
+  801650:	0f 88 0a 01 00 00    	js     801760 <dup+0x12c>
+    return r;
+  close(newfdnum);
+  801656:	83 ec 0c             	sub    $0xc,%esp
+  801659:	ff 75 0c             	push   0xc(%ebp)
+  80165c:	e8 81 ff ff ff       	call   8015e2 <close>
+
+  newfd = INDEX2FD(newfdnum);
+  801661:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801664:	c1 e0 0c             	shl    $0xc,%eax
+  801667:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  80166d:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  801670:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801673:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  801676:	89 04 24             	mov    %eax,(%esp)
+  801679:	e8 d7 fd ff ff       	call   801455 <fd2data>
+  80167e:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  801680:	89 3c 24             	mov    %edi,(%esp)
+  801683:	e8 cd fd ff ff       	call   801455 <fd2data>
+  801688:	83 c4 10             	add    $0x10,%esp
+  80168b:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80168e:	89 f3                	mov    %esi,%ebx
+  801690:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  801696:	89 c6                	mov    %eax,%esi
+  801698:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80169b:	89 cf                	mov    %ecx,%edi
+  80169d:	eb 0c                	jmp    8016ab <dup+0x77>
+  80169f:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8016a5:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8016ab:	39 fb                	cmp    %edi,%ebx
+  8016ad:	74 7b                	je     80172a <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  8016af:	89 d8                	mov    %ebx,%eax
+  8016b1:	c1 e8 16             	shr    $0x16,%eax
+  8016b4:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8016bb:	a8 01                	test   $0x1,%al
+  8016bd:	74 e0                	je     80169f <dup+0x6b>
+  8016bf:	89 d8                	mov    %ebx,%eax
+  8016c1:	c1 e8 0c             	shr    $0xc,%eax
+  8016c4:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8016cb:	f6 c2 01             	test   $0x1,%dl
+  8016ce:	74 cf                	je     80169f <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  8016d0:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  8016d7:	83 ec 0c             	sub    $0xc,%esp
+  8016da:	25 07 0e 00 00       	and    $0xe07,%eax
+  8016df:	50                   	push   %eax
+  8016e0:	56                   	push   %esi
+  8016e1:	6a 00                	push   $0x0
+  8016e3:	53                   	push   %ebx
+  8016e4:	6a 00                	push   $0x0
+  8016e6:	e8 ee f8 ff ff       	call   800fd9 <sys_page_map>
+  8016eb:	83 c4 20             	add    $0x20,%esp
+  8016ee:	85 c0                	test   %eax,%eax
+  8016f0:	79 ad                	jns    80169f <dup+0x6b>
+  8016f2:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8016f5:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  8016f7:	83 ec 08             	sub    $0x8,%esp
+  8016fa:	ff 75 d4             	push   -0x2c(%ebp)
+  8016fd:	6a 00                	push   $0x0
+  8016ff:	e8 17 f9 ff ff       	call   80101b <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801704:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  801707:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  80170d:	83 c4 10             	add    $0x10,%esp
+  801710:	39 df                	cmp    %ebx,%edi
+  801712:	74 4c                	je     801760 <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  801714:	83 ec 08             	sub    $0x8,%esp
+  801717:	57                   	push   %edi
+  801718:	6a 00                	push   $0x0
+  80171a:	e8 fc f8 ff ff       	call   80101b <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80171f:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  801725:	83 c4 10             	add    $0x10,%esp
+  801728:	eb e6                	jmp    801710 <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80172a:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80172d:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  801730:	89 c8                	mov    %ecx,%eax
+  801732:	c1 e8 0c             	shr    $0xc,%eax
+  801735:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80173c:	83 ec 0c             	sub    $0xc,%esp
+  80173f:	25 07 0e 00 00       	and    $0xe07,%eax
+  801744:	50                   	push   %eax
+  801745:	ff 75 d4             	push   -0x2c(%ebp)
+  801748:	6a 00                	push   $0x0
+  80174a:	51                   	push   %ecx
+  80174b:	6a 00                	push   $0x0
+  80174d:	e8 87 f8 ff ff       	call   800fd9 <sys_page_map>
+  801752:	89 c6                	mov    %eax,%esi
+  801754:	83 c4 20             	add    $0x20,%esp
+  801757:	85 c0                	test   %eax,%eax
+  801759:	78 9c                	js     8016f7 <dup+0xc3>
+  return newfdnum;
+  80175b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80175e:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  801760:	89 f0                	mov    %esi,%eax
+  801762:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801765:	5b                   	pop    %ebx
+  801766:	5e                   	pop    %esi
+  801767:	5f                   	pop    %edi
+  801768:	5d                   	pop    %ebp
+  801769:	c3                   	ret
+
+0080176a <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80176a:	55                   	push   %ebp
+  80176b:	89 e5                	mov    %esp,%ebp
+  80176d:	56                   	push   %esi
+  80176e:	53                   	push   %ebx
+  80176f:	83 ec 18             	sub    $0x18,%esp
+  801772:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801775:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801778:	50                   	push   %eax
+  801779:	56                   	push   %esi
+  80177a:	e8 40 fd ff ff       	call   8014bf <fd_lookup>
+  80177f:	83 c4 10             	add    $0x10,%esp
+  801782:	85 c0                	test   %eax,%eax
+  801784:	78 3c                	js     8017c2 <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801786:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801789:	83 ec 08             	sub    $0x8,%esp
+  80178c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80178f:	50                   	push   %eax
+  801790:	ff 33                	push   (%ebx)
+  801792:	e8 78 fd ff ff       	call   80150f <dev_lookup>
+  801797:	83 c4 10             	add    $0x10,%esp
+  80179a:	85 c0                	test   %eax,%eax
+  80179c:	78 24                	js     8017c2 <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80179e:	8b 43 08             	mov    0x8(%ebx),%eax
+  8017a1:	83 e0 03             	and    $0x3,%eax
+  8017a4:	83 f8 01             	cmp    $0x1,%eax
+  8017a7:	74 20                	je     8017c9 <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  8017a9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017ac:	8b 40 08             	mov    0x8(%eax),%eax
+  8017af:	85 c0                	test   %eax,%eax
+  8017b1:	74 37                	je     8017ea <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  8017b3:	83 ec 04             	sub    $0x4,%esp
+  8017b6:	ff 75 10             	push   0x10(%ebp)
+  8017b9:	ff 75 0c             	push   0xc(%ebp)
+  8017bc:	53                   	push   %ebx
+  8017bd:	ff d0                	call   *%eax
+  8017bf:	83 c4 10             	add    $0x10,%esp
+}
+  8017c2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017c5:	5b                   	pop    %ebx
+  8017c6:	5e                   	pop    %esi
+  8017c7:	5d                   	pop    %ebp
+  8017c8:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8017c9:	a1 64 6b 80 00       	mov    0x806b64,%eax
+  8017ce:	8b 40 48             	mov    0x48(%eax),%eax
+  8017d1:	83 ec 04             	sub    $0x4,%esp
+  8017d4:	56                   	push   %esi
+  8017d5:	50                   	push   %eax
+  8017d6:	68 f1 36 80 00       	push   $0x8036f1
+  8017db:	e8 99 ed ff ff       	call   800579 <cprintf>
+    return -E_INVAL;
+  8017e0:	83 c4 10             	add    $0x10,%esp
+  8017e3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017e8:	eb d8                	jmp    8017c2 <read+0x58>
+    return -E_NOT_SUPP;
+  8017ea:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017ef:	eb d1                	jmp    8017c2 <read+0x58>
+
+008017f1 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8017f1:	55                   	push   %ebp
+  8017f2:	89 e5                	mov    %esp,%ebp
+  8017f4:	57                   	push   %edi
+  8017f5:	56                   	push   %esi
+  8017f6:	53                   	push   %ebx
+  8017f7:	83 ec 0c             	sub    $0xc,%esp
+  8017fa:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8017fd:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  801800:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801805:	eb 02                	jmp    801809 <readn+0x18>
+  801807:	01 c3                	add    %eax,%ebx
+  801809:	39 f3                	cmp    %esi,%ebx
+  80180b:	73 21                	jae    80182e <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  80180d:	83 ec 04             	sub    $0x4,%esp
+  801810:	89 f0                	mov    %esi,%eax
+  801812:	29 d8                	sub    %ebx,%eax
+  801814:	50                   	push   %eax
+  801815:	89 d8                	mov    %ebx,%eax
+  801817:	03 45 0c             	add    0xc(%ebp),%eax
+  80181a:	50                   	push   %eax
+  80181b:	57                   	push   %edi
+  80181c:	e8 49 ff ff ff       	call   80176a <read>
+    if (m < 0)
+  801821:	83 c4 10             	add    $0x10,%esp
+  801824:	85 c0                	test   %eax,%eax
+  801826:	78 04                	js     80182c <readn+0x3b>
+      return m;
+    if (m == 0)
+  801828:	75 dd                	jne    801807 <readn+0x16>
+  80182a:	eb 02                	jmp    80182e <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  80182c:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  80182e:	89 d8                	mov    %ebx,%eax
+  801830:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801833:	5b                   	pop    %ebx
+  801834:	5e                   	pop    %esi
+  801835:	5f                   	pop    %edi
+  801836:	5d                   	pop    %ebp
+  801837:	c3                   	ret
+
+00801838 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801838:	55                   	push   %ebp
+  801839:	89 e5                	mov    %esp,%ebp
+  80183b:	56                   	push   %esi
+  80183c:	53                   	push   %ebx
+  80183d:	83 ec 18             	sub    $0x18,%esp
+  801840:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801843:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801846:	50                   	push   %eax
+  801847:	53                   	push   %ebx
+  801848:	e8 72 fc ff ff       	call   8014bf <fd_lookup>
+  80184d:	83 c4 10             	add    $0x10,%esp
+  801850:	85 c0                	test   %eax,%eax
+  801852:	78 37                	js     80188b <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801854:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801857:	83 ec 08             	sub    $0x8,%esp
+  80185a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80185d:	50                   	push   %eax
+  80185e:	ff 36                	push   (%esi)
+  801860:	e8 aa fc ff ff       	call   80150f <dev_lookup>
+  801865:	83 c4 10             	add    $0x10,%esp
+  801868:	85 c0                	test   %eax,%eax
+  80186a:	78 1f                	js     80188b <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80186c:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801870:	74 20                	je     801892 <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  801872:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801875:	8b 40 0c             	mov    0xc(%eax),%eax
+  801878:	85 c0                	test   %eax,%eax
+  80187a:	74 37                	je     8018b3 <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  80187c:	83 ec 04             	sub    $0x4,%esp
+  80187f:	ff 75 10             	push   0x10(%ebp)
+  801882:	ff 75 0c             	push   0xc(%ebp)
+  801885:	56                   	push   %esi
+  801886:	ff d0                	call   *%eax
+  801888:	83 c4 10             	add    $0x10,%esp
+}
+  80188b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80188e:	5b                   	pop    %ebx
+  80188f:	5e                   	pop    %esi
+  801890:	5d                   	pop    %ebp
+  801891:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801892:	a1 64 6b 80 00       	mov    0x806b64,%eax
+  801897:	8b 40 48             	mov    0x48(%eax),%eax
+  80189a:	83 ec 04             	sub    $0x4,%esp
+  80189d:	53                   	push   %ebx
+  80189e:	50                   	push   %eax
+  80189f:	68 0d 37 80 00       	push   $0x80370d
+  8018a4:	e8 d0 ec ff ff       	call   800579 <cprintf>
+    return -E_INVAL;
+  8018a9:	83 c4 10             	add    $0x10,%esp
+  8018ac:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018b1:	eb d8                	jmp    80188b <write+0x53>
+    return -E_NOT_SUPP;
+  8018b3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8018b8:	eb d1                	jmp    80188b <write+0x53>
+
+008018ba <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8018ba:	55                   	push   %ebp
+  8018bb:	89 e5                	mov    %esp,%ebp
+  8018bd:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8018c0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018c3:	50                   	push   %eax
+  8018c4:	ff 75 08             	push   0x8(%ebp)
+  8018c7:	e8 f3 fb ff ff       	call   8014bf <fd_lookup>
+  8018cc:	83 c4 10             	add    $0x10,%esp
+  8018cf:	85 c0                	test   %eax,%eax
+  8018d1:	78 0e                	js     8018e1 <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  8018d3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8018d6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018d9:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  8018dc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018e1:	c9                   	leave
+  8018e2:	c3                   	ret
+
+008018e3 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8018e3:	55                   	push   %ebp
+  8018e4:	89 e5                	mov    %esp,%ebp
+  8018e6:	56                   	push   %esi
+  8018e7:	53                   	push   %ebx
+  8018e8:	83 ec 18             	sub    $0x18,%esp
+  8018eb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  8018ee:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018f1:	50                   	push   %eax
+  8018f2:	53                   	push   %ebx
+  8018f3:	e8 c7 fb ff ff       	call   8014bf <fd_lookup>
+  8018f8:	83 c4 10             	add    $0x10,%esp
+  8018fb:	85 c0                	test   %eax,%eax
+  8018fd:	78 34                	js     801933 <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8018ff:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801902:	83 ec 08             	sub    $0x8,%esp
+  801905:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801908:	50                   	push   %eax
+  801909:	ff 36                	push   (%esi)
+  80190b:	e8 ff fb ff ff       	call   80150f <dev_lookup>
+  801910:	83 c4 10             	add    $0x10,%esp
+  801913:	85 c0                	test   %eax,%eax
+  801915:	78 1c                	js     801933 <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801917:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80191b:	74 1d                	je     80193a <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  80191d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801920:	8b 40 18             	mov    0x18(%eax),%eax
+  801923:	85 c0                	test   %eax,%eax
+  801925:	74 34                	je     80195b <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  801927:	83 ec 08             	sub    $0x8,%esp
+  80192a:	ff 75 0c             	push   0xc(%ebp)
+  80192d:	56                   	push   %esi
+  80192e:	ff d0                	call   *%eax
+  801930:	83 c4 10             	add    $0x10,%esp
+}
+  801933:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801936:	5b                   	pop    %ebx
+  801937:	5e                   	pop    %esi
+  801938:	5d                   	pop    %ebp
+  801939:	c3                   	ret
+            thisenv->env_id, fdnum);
+  80193a:	a1 64 6b 80 00       	mov    0x806b64,%eax
+  80193f:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801942:	83 ec 04             	sub    $0x4,%esp
+  801945:	53                   	push   %ebx
+  801946:	50                   	push   %eax
+  801947:	68 d0 36 80 00       	push   $0x8036d0
+  80194c:	e8 28 ec ff ff       	call   800579 <cprintf>
+    return -E_INVAL;
+  801951:	83 c4 10             	add    $0x10,%esp
+  801954:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801959:	eb d8                	jmp    801933 <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  80195b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801960:	eb d1                	jmp    801933 <ftruncate+0x50>
+
+00801962 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801962:	55                   	push   %ebp
+  801963:	89 e5                	mov    %esp,%ebp
+  801965:	56                   	push   %esi
+  801966:	53                   	push   %ebx
+  801967:	83 ec 18             	sub    $0x18,%esp
+  80196a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  80196d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801970:	50                   	push   %eax
+  801971:	ff 75 08             	push   0x8(%ebp)
+  801974:	e8 46 fb ff ff       	call   8014bf <fd_lookup>
+  801979:	83 c4 10             	add    $0x10,%esp
+  80197c:	85 c0                	test   %eax,%eax
+  80197e:	78 49                	js     8019c9 <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801980:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801983:	83 ec 08             	sub    $0x8,%esp
+  801986:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801989:	50                   	push   %eax
+  80198a:	ff 36                	push   (%esi)
+  80198c:	e8 7e fb ff ff       	call   80150f <dev_lookup>
+  801991:	83 c4 10             	add    $0x10,%esp
+  801994:	85 c0                	test   %eax,%eax
+  801996:	78 31                	js     8019c9 <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  801998:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80199b:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80199f:	74 2f                	je     8019d0 <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  8019a1:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  8019a4:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8019ab:	00 00 00 
+  stat->st_isdir = 0;
+  8019ae:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8019b5:	00 00 00 
+  stat->st_dev = dev;
+  8019b8:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  8019be:	83 ec 08             	sub    $0x8,%esp
+  8019c1:	53                   	push   %ebx
+  8019c2:	56                   	push   %esi
+  8019c3:	ff 50 14             	call   *0x14(%eax)
+  8019c6:	83 c4 10             	add    $0x10,%esp
+}
+  8019c9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019cc:	5b                   	pop    %ebx
+  8019cd:	5e                   	pop    %esi
+  8019ce:	5d                   	pop    %ebp
+  8019cf:	c3                   	ret
+    return -E_NOT_SUPP;
+  8019d0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8019d5:	eb f2                	jmp    8019c9 <fstat+0x67>
+
+008019d7 <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  8019d7:	55                   	push   %ebp
+  8019d8:	89 e5                	mov    %esp,%ebp
+  8019da:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  8019dd:	ff 75 0c             	push   0xc(%ebp)
+  8019e0:	ff 75 08             	push   0x8(%ebp)
+  8019e3:	e8 58 07 00 00       	call   802140 <file_stat>
+}
+  8019e8:	c9                   	leave
+  8019e9:	c3                   	ret
+
+008019ea <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  8019ea:	55                   	push   %ebp
+  8019eb:	89 e5                	mov    %esp,%ebp
+  8019ed:	57                   	push   %edi
+  8019ee:	56                   	push   %esi
+  8019ef:	53                   	push   %ebx
+  8019f0:	83 ec 1c             	sub    $0x1c,%esp
+  8019f3:	89 c7                	mov    %eax,%edi
+  8019f5:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8019f8:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8019fb:	e9 a2 00 00 00       	jmp    801aa2 <fsipc_send+0xb8>
+  nfsenvs = 0;
+  801a00:	c7 05 20 64 80 00 00 	movl   $0x0,0x806420
+  801a07:	00 00 00 
+  801a0a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a0f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801a14:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801a19:	be 01 00 00 00       	mov    $0x1,%esi
+  801a1e:	eb 0f                	jmp    801a2f <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801a20:	83 c0 01             	add    $0x1,%eax
+  801a23:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801a28:	74 49                	je     801a73 <fsipc_send+0x89>
+  801a2a:	83 f9 07             	cmp    $0x7,%ecx
+  801a2d:	7f 50                	jg     801a7f <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  801a2f:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801a32:	c1 e2 04             	shl    $0x4,%edx
+  801a35:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801a3b:	8b 52 50             	mov    0x50(%edx),%edx
+  801a3e:	83 fa 01             	cmp    $0x1,%edx
+  801a41:	75 dd                	jne    801a20 <fsipc_send+0x36>
+  801a43:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801a46:	c1 e2 04             	shl    $0x4,%edx
+  801a49:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801a4f:	8b 52 54             	mov    0x54(%edx),%edx
+  801a52:	85 d2                	test   %edx,%edx
+  801a54:	74 ca                	je     801a20 <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801a56:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801a59:	c1 e2 04             	shl    $0x4,%edx
+  801a5c:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801a62:	8b 52 48             	mov    0x48(%edx),%edx
+  801a65:	89 14 8d 40 64 80 00 	mov    %edx,0x806440(,%ecx,4)
+  801a6c:	8d 49 01             	lea    0x1(%ecx),%ecx
+  801a6f:	89 f3                	mov    %esi,%ebx
+  801a71:	eb ad                	jmp    801a20 <fsipc_send+0x36>
+  801a73:	84 db                	test   %bl,%bl
+  801a75:	74 38                	je     801aaf <fsipc_send+0xc5>
+  801a77:	89 0d 20 64 80 00    	mov    %ecx,0x806420
+  801a7d:	eb 30                	jmp    801aaf <fsipc_send+0xc5>
+  801a7f:	84 db                	test   %bl,%bl
+  801a81:	74 2c                	je     801aaf <fsipc_send+0xc5>
+  801a83:	89 0d 20 64 80 00    	mov    %ecx,0x806420
+  801a89:	eb 24                	jmp    801aaf <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  801a8b:	50                   	push   %eax
+  801a8c:	68 3c 37 80 00       	push   $0x80373c
+  801a91:	6a 34                	push   $0x34
+  801a93:	68 46 37 80 00       	push   $0x803746
+  801a98:	e8 01 ea ff ff       	call   80049e <_panic>
+    }
+    sys_yield();
+  801a9d:	e8 92 f4 ff ff       	call   800f34 <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  801aa2:	83 3d 20 64 80 00 03 	cmpl   $0x3,0x806420
+  801aa9:	0f 8e 51 ff ff ff    	jle    801a00 <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  801aaf:	a1 64 6b 80 00       	mov    0x806b64,%eax
+  801ab4:	8b 70 48             	mov    0x48(%eax),%esi
+  801ab7:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  801abd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ac2:	8b 0d 20 64 80 00    	mov    0x806420,%ecx
+  801ac8:	39 d9                	cmp    %ebx,%ecx
+  801aca:	7e d1                	jle    801a9d <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  801acc:	83 ec 0c             	sub    $0xc,%esp
+  801acf:	ff 75 e0             	push   -0x20(%ebp)
+  801ad2:	6a 07                	push   $0x7
+  801ad4:	ff 75 e4             	push   -0x1c(%ebp)
+  801ad7:	57                   	push   %edi
+  801ad8:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  801adb:	99                   	cltd
+  801adc:	f7 f9                	idiv   %ecx
+  801ade:	ff 34 95 40 64 80 00 	push   0x806440(,%edx,4)
+  801ae5:	e8 63 f7 ff ff       	call   80124d <sys_ipc_try_send>
+      if (r == 0)
+  801aea:	83 c4 20             	add    $0x20,%esp
+  801aed:	85 c0                	test   %eax,%eax
+  801aef:	74 0a                	je     801afb <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  801af1:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801af4:	75 95                	jne    801a8b <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  801af6:	83 c3 01             	add    $0x1,%ebx
+  801af9:	eb c7                	jmp    801ac2 <fsipc_send+0xd8>
+  }
+}
+  801afb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801afe:	5b                   	pop    %ebx
+  801aff:	5e                   	pop    %esi
+  801b00:	5f                   	pop    %edi
+  801b01:	5d                   	pop    %ebp
+  801b02:	c3                   	ret
+
+00801b03 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801b03:	55                   	push   %ebp
+  801b04:	89 e5                	mov    %esp,%ebp
+  801b06:	53                   	push   %ebx
+  801b07:	83 ec 14             	sub    $0x14,%esp
+  801b0a:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  801b0c:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  801b13:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801b18:	ba 00 70 80 00       	mov    $0x807000,%edx
+  801b1d:	e8 c8 fe ff ff       	call   8019ea <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801b22:	6a 00                	push   $0x0
+  801b24:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b27:	50                   	push   %eax
+  801b28:	53                   	push   %ebx
+  801b29:	6a 00                	push   $0x0
+  801b2b:	e8 26 13 00 00       	call   802e56 <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  801b30:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b33:	c9                   	leave
+  801b34:	c3                   	ret
+
+00801b35 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801b35:	55                   	push   %ebp
+  801b36:	89 e5                	mov    %esp,%ebp
+  801b38:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801b3b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b3e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b41:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.set_size.req_size = newsize;
+  801b46:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b49:	a3 04 70 80 00       	mov    %eax,0x807004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801b4e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b53:	b8 02 00 00 00       	mov    $0x2,%eax
+  801b58:	e8 a6 ff ff ff       	call   801b03 <fsipc>
+}
+  801b5d:	c9                   	leave
+  801b5e:	c3                   	ret
+
+00801b5f <devfile_flush>:
+{
+  801b5f:	55                   	push   %ebp
+  801b60:	89 e5                	mov    %esp,%ebp
+  801b62:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801b65:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b68:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b6b:	a3 00 70 80 00       	mov    %eax,0x807000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801b70:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b75:	b8 06 00 00 00       	mov    $0x6,%eax
+  801b7a:	e8 84 ff ff ff       	call   801b03 <fsipc>
+}
+  801b7f:	c9                   	leave
+  801b80:	c3                   	ret
+
+00801b81 <devfile_stat>:
+{
+  801b81:	55                   	push   %ebp
+  801b82:	89 e5                	mov    %esp,%ebp
+  801b84:	53                   	push   %ebx
+  801b85:	83 ec 04             	sub    $0x4,%esp
+  801b88:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801b8b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b8e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b91:	a3 00 70 80 00       	mov    %eax,0x807000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801b96:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b9b:	b8 05 00 00 00       	mov    $0x5,%eax
+  801ba0:	e8 5e ff ff ff       	call   801b03 <fsipc>
+  801ba5:	85 c0                	test   %eax,%eax
+  801ba7:	78 2c                	js     801bd5 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801ba9:	83 ec 08             	sub    $0x8,%esp
+  801bac:	68 00 70 80 00       	push   $0x807000
+  801bb1:	53                   	push   %ebx
+  801bb2:	e8 b0 ef ff ff       	call   800b67 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  801bb7:	a1 80 70 80 00       	mov    0x807080,%eax
+  801bbc:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801bc2:	a1 84 70 80 00       	mov    0x807084,%eax
+  801bc7:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801bcd:	83 c4 10             	add    $0x10,%esp
+  801bd0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801bd5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bd8:	c9                   	leave
+  801bd9:	c3                   	ret
+
+00801bda <fsv_alloc>:
+{
+  801bda:	55                   	push   %ebp
+  801bdb:	89 e5                	mov    %esp,%ebp
+  801bdd:	56                   	push   %esi
+  801bde:	53                   	push   %ebx
+  801bdf:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  801be1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801be6:	eb 22                	jmp    801c0a <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  801be8:	83 ec 04             	sub    $0x4,%esp
+  801beb:	6a 00                	push   $0x0
+  801bed:	6a 00                	push   $0x0
+  801bef:	6a 07                	push   $0x7
+  801bf1:	50                   	push   %eax
+  801bf2:	6a 00                	push   $0x0
+  801bf4:	6a 04                	push   $0x4
+  801bf6:	68 60 64 80 00       	push   $0x806460
+  801bfb:	e8 e9 f7 ff ff       	call   8013e9 <sysbatch_add>
+  801c00:	83 c4 20             	add    $0x20,%esp
+  801c03:	85 c0                	test   %eax,%eax
+  801c05:	78 48                	js     801c4f <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  801c07:	83 c3 01             	add    $0x1,%ebx
+  801c0a:	39 f3                	cmp    %esi,%ebx
+  801c0c:	74 31                	je     801c3f <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  801c0e:	89 d8                	mov    %ebx,%eax
+  801c10:	c1 e0 0c             	shl    $0xc,%eax
+  801c13:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801c18:	89 c2                	mov    %eax,%edx
+  801c1a:	c1 ea 16             	shr    $0x16,%edx
+  801c1d:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801c24:	f6 c2 01             	test   $0x1,%dl
+  801c27:	74 bf                	je     801be8 <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  801c29:	89 c2                	mov    %eax,%edx
+  801c2b:	c1 ea 0c             	shr    $0xc,%edx
+  801c2e:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801c35:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801c38:	83 fa 03             	cmp    $0x3,%edx
+  801c3b:	75 ab                	jne    801be8 <fsv_alloc+0xe>
+  801c3d:	eb c8                	jmp    801c07 <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  801c3f:	83 ec 0c             	sub    $0xc,%esp
+  801c42:	68 60 64 80 00       	push   $0x806460
+  801c47:	e8 4d f7 ff ff       	call   801399 <sysbatch_flush>
+  801c4c:	83 c4 10             	add    $0x10,%esp
+}
+  801c4f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c52:	5b                   	pop    %ebx
+  801c53:	5e                   	pop    %esi
+  801c54:	5d                   	pop    %ebp
+  801c55:	c3                   	ret
+
+00801c56 <devfile_read>:
+{
+  801c56:	55                   	push   %ebp
+  801c57:	89 e5                	mov    %esp,%ebp
+  801c59:	57                   	push   %edi
+  801c5a:	56                   	push   %esi
+  801c5b:	53                   	push   %ebx
+  801c5c:	83 ec 3c             	sub    $0x3c,%esp
+  801c5f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  801c62:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  801c68:	77 57                	ja     801cc1 <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801c6a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c6d:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c70:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.read.req_n = n;
+  801c75:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801c7b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c80:	b8 03 00 00 00       	mov    $0x3,%eax
+  801c85:	e8 79 fe ff ff       	call   801b03 <fsipc>
+  801c8a:	89 c6                	mov    %eax,%esi
+  801c8c:	85 c0                	test   %eax,%eax
+  801c8e:	78 27                	js     801cb7 <devfile_read+0x61>
+  assert(r <= n);
+  801c90:	39 c3                	cmp    %eax,%ebx
+  801c92:	0f 82 0e 02 00 00    	jb     801ea6 <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  801c98:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801c9d:	0f 8f 1c 02 00 00    	jg     801ebf <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801ca3:	83 ec 04             	sub    $0x4,%esp
+  801ca6:	50                   	push   %eax
+  801ca7:	68 00 70 80 00       	push   $0x807000
+  801cac:	ff 75 0c             	push   0xc(%ebp)
+  801caf:	e8 39 f0 ff ff       	call   800ced <memmove>
+  return r;
+  801cb4:	83 c4 10             	add    $0x10,%esp
+}
+  801cb7:	89 f0                	mov    %esi,%eax
+  801cb9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cbc:	5b                   	pop    %ebx
+  801cbd:	5e                   	pop    %esi
+  801cbe:	5f                   	pop    %edi
+  801cbf:	5d                   	pop    %ebp
+  801cc0:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  801cc1:	b8 01 00 00 00       	mov    $0x1,%eax
+  801cc6:	e8 0f ff ff ff       	call   801bda <fsv_alloc>
+  801ccb:	89 c6                	mov    %eax,%esi
+  801ccd:	85 c0                	test   %eax,%eax
+  801ccf:	78 e6                	js     801cb7 <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  801cd1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cd4:	8b 40 0c             	mov    0xc(%eax),%eax
+  801cd7:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  801cdc:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cdf:	8b 40 04             	mov    0x4(%eax),%eax
+  801ce2:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  801ce7:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  801ced:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801cf4:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801cf9:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801cfe:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801d03:	e8 e2 fc ff ff       	call   8019ea <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801d08:	6a 00                	push   $0x0
+  801d0a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801d0d:	50                   	push   %eax
+  801d0e:	68 00 10 c0 9f       	push   $0x9fc01000
+  801d13:	6a 00                	push   $0x0
+  801d15:	e8 3c 11 00 00       	call   802e56 <ipc_recv_pages>
+  801d1a:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  801d1c:	83 c4 10             	add    $0x10,%esp
+  801d1f:	85 c0                	test   %eax,%eax
+  801d21:	7e 94                	jle    801cb7 <devfile_read+0x61>
+  assert(r <= n);
+  801d23:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801d26:	39 c3                	cmp    %eax,%ebx
+  801d28:	72 2e                	jb     801d58 <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801d2a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d2d:	8b 40 04             	mov    0x4(%eax),%eax
+  801d30:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801d35:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  801d38:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801d3b:	c1 e2 0c             	shl    $0xc,%edx
+  801d3e:	39 ca                	cmp    %ecx,%edx
+  801d40:	72 2f                	jb     801d71 <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  801d42:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  801d47:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  801d4a:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  801d4e:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801d53:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  801d56:	eb 52                	jmp    801daa <devfile_read+0x154>
+  assert(r <= n);
+  801d58:	68 51 37 80 00       	push   $0x803751
+  801d5d:	68 58 37 80 00       	push   $0x803758
+  801d62:	68 49 01 00 00       	push   $0x149
+  801d67:	68 46 37 80 00       	push   $0x803746
+  801d6c:	e8 2d e7 ff ff       	call   80049e <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801d71:	68 7c 37 80 00       	push   $0x80377c
+  801d76:	68 58 37 80 00       	push   $0x803758
+  801d7b:	68 4a 01 00 00       	push   $0x14a
+  801d80:	68 46 37 80 00       	push   $0x803746
+  801d85:	e8 14 e7 ff ff       	call   80049e <_panic>
+      memmove(dst + done, src + done, m);
+  801d8a:	83 ec 04             	sub    $0x4,%esp
+  801d8d:	53                   	push   %ebx
+  801d8e:	56                   	push   %esi
+  801d8f:	89 f8                	mov    %edi,%eax
+  801d91:	03 45 0c             	add    0xc(%ebp),%eax
+  801d94:	50                   	push   %eax
+  801d95:	e8 53 ef ff ff       	call   800ced <memmove>
+  801d9a:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  801d9d:	01 df                	add    %ebx,%edi
+  801d9f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801da2:	39 c7                	cmp    %eax,%edi
+  801da4:	0f 83 c0 00 00 00    	jae    801e6a <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801daa:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801dad:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  801db0:	89 f0                	mov    %esi,%eax
+  801db2:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801db7:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  801dbc:	29 c3                	sub    %eax,%ebx
+  801dbe:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801dc1:	29 f8                	sub    %edi,%eax
+  801dc3:	39 c3                	cmp    %eax,%ebx
+  801dc5:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  801dc8:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801dce:	75 ba                	jne    801d8a <devfile_read+0x134>
+  801dd0:	89 f9                	mov    %edi,%ecx
+  801dd2:	03 4d 0c             	add    0xc(%ebp),%ecx
+  801dd5:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  801dd8:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  801dde:	75 aa                	jne    801d8a <devfile_read+0x134>
+  801de0:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  801de6:	77 a2                	ja     801d8a <devfile_read+0x134>
+  801de8:	89 c8                	mov    %ecx,%eax
+  801dea:	c1 e8 16             	shr    $0x16,%eax
+  801ded:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801df4:	a8 01                	test   $0x1,%al
+  801df6:	74 92                	je     801d8a <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  801df8:	89 c8                	mov    %ecx,%eax
+  801dfa:	c1 e8 0c             	shr    $0xc,%eax
+  801dfd:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  801e04:	a8 01                	test   $0x1,%al
+  801e06:	74 82                	je     801d8a <devfile_read+0x134>
+  801e08:	a9 02 08 00 00       	test   $0x802,%eax
+  801e0d:	0f 84 77 ff ff ff    	je     801d8a <devfile_read+0x134>
+  801e13:	f6 c4 04             	test   $0x4,%ah
+  801e16:	0f 85 6e ff ff ff    	jne    801d8a <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  801e1c:	a1 64 6b 80 00       	mov    0x806b64,%eax
+  801e21:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  801e25:	84 c0                	test   %al,%al
+  801e27:	75 17                	jne    801e40 <devfile_read+0x1ea>
+  801e29:	83 ec 08             	sub    $0x8,%esp
+  801e2c:	6a 01                	push   $0x1
+  801e2e:	6a 00                	push   $0x0
+  801e30:	e8 1e f1 ff ff       	call   800f53 <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  801e35:	83 c4 10             	add    $0x10,%esp
+  801e38:	85 c0                	test   %eax,%eax
+  801e3a:	0f 85 4a ff ff ff    	jne    801d8a <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  801e40:	83 ec 04             	sub    $0x4,%esp
+  801e43:	68 05 08 00 00       	push   $0x805
+  801e48:	ff 75 cc             	push   -0x34(%ebp)
+  801e4b:	6a 00                	push   $0x0
+  801e4d:	56                   	push   %esi
+  801e4e:	6a 00                	push   $0x0
+  801e50:	6a 05                	push   $0x5
+  801e52:	68 60 64 80 00       	push   $0x806460
+  801e57:	e8 8d f5 ff ff       	call   8013e9 <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  801e5c:	c1 e8 1f             	shr    $0x1f,%eax
+  801e5f:	08 45 cb             	or     %al,-0x35(%ebp)
+  801e62:	83 c4 20             	add    $0x20,%esp
+  801e65:	e9 33 ff ff ff       	jmp    801d9d <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  801e6a:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  801e6d:	83 ec 0c             	sub    $0xc,%esp
+  801e70:	68 60 64 80 00       	push   $0x806460
+  801e75:	e8 1f f5 ff ff       	call   801399 <sysbatch_flush>
+  801e7a:	83 c4 10             	add    $0x10,%esp
+  801e7d:	85 c0                	test   %eax,%eax
+  801e7f:	78 06                	js     801e87 <devfile_read+0x231>
+  801e81:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  801e85:	74 14                	je     801e9b <devfile_read+0x245>
+    memmove(dst, src, r);
+  801e87:	83 ec 04             	sub    $0x4,%esp
+  801e8a:	ff 75 d4             	push   -0x2c(%ebp)
+  801e8d:	ff 75 d0             	push   -0x30(%ebp)
+  801e90:	ff 75 0c             	push   0xc(%ebp)
+  801e93:	e8 55 ee ff ff       	call   800ced <memmove>
+  801e98:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  801e9b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e9e:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  801ea1:	e9 11 fe ff ff       	jmp    801cb7 <devfile_read+0x61>
+  assert(r <= n);
+  801ea6:	68 51 37 80 00       	push   $0x803751
+  801eab:	68 58 37 80 00       	push   $0x803758
+  801eb0:	68 1c 01 00 00       	push   $0x11c
+  801eb5:	68 46 37 80 00       	push   $0x803746
+  801eba:	e8 df e5 ff ff       	call   80049e <_panic>
+  assert(r <= PGSIZE);
+  801ebf:	68 6d 37 80 00       	push   $0x80376d
+  801ec4:	68 58 37 80 00       	push   $0x803758
+  801ec9:	68 1d 01 00 00       	push   $0x11d
+  801ece:	68 46 37 80 00       	push   $0x803746
+  801ed3:	e8 c6 e5 ff ff       	call   80049e <_panic>
+
+00801ed8 <devfile_write>:
+{
+  801ed8:	55                   	push   %ebp
+  801ed9:	89 e5                	mov    %esp,%ebp
+  801edb:	57                   	push   %edi
+  801edc:	56                   	push   %esi
+  801edd:	53                   	push   %ebx
+  801ede:	83 ec 1c             	sub    $0x1c,%esp
+  801ee1:	8b 75 08             	mov    0x8(%ebp),%esi
+  801ee4:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  801ee7:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  801eec:	77 39                	ja     801f27 <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801eee:	8b 56 0c             	mov    0xc(%esi),%edx
+  801ef1:	89 15 00 70 80 00    	mov    %edx,0x807000
+  fsipcbuf.write.req_n = n;
+  801ef7:	a3 04 70 80 00       	mov    %eax,0x807004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  801efc:	83 ec 04             	sub    $0x4,%esp
+  801eff:	50                   	push   %eax
+  801f00:	ff 75 0c             	push   0xc(%ebp)
+  801f03:	68 08 70 80 00       	push   $0x807008
+  801f08:	e8 e0 ed ff ff       	call   800ced <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801f0d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f12:	b8 04 00 00 00       	mov    $0x4,%eax
+  801f17:	e8 e7 fb ff ff       	call   801b03 <fsipc>
+  801f1c:	83 c4 10             	add    $0x10,%esp
+}
+  801f1f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f22:	5b                   	pop    %ebx
+  801f23:	5e                   	pop    %esi
+  801f24:	5f                   	pop    %edi
+  801f25:	5d                   	pop    %ebp
+  801f26:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  801f27:	ba 00 00 10 00       	mov    $0x100000,%edx
+  801f2c:	39 d0                	cmp    %edx,%eax
+  801f2e:	89 d3                	mov    %edx,%ebx
+  801f30:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  801f33:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  801f39:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  801f3c:	83 c7 01             	add    $0x1,%edi
+  801f3f:	89 f8                	mov    %edi,%eax
+  801f41:	e8 94 fc ff ff       	call   801bda <fsv_alloc>
+  801f46:	85 c0                	test   %eax,%eax
+  801f48:	78 d5                	js     801f1f <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  801f4a:	83 ec 04             	sub    $0x4,%esp
+  801f4d:	53                   	push   %ebx
+  801f4e:	ff 75 0c             	push   0xc(%ebp)
+  801f51:	68 00 10 c0 9f       	push   $0x9fc01000
+  801f56:	e8 92 ed ff ff       	call   800ced <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  801f5b:	8b 46 0c             	mov    0xc(%esi),%eax
+  801f5e:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  801f63:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  801f69:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801f70:	89 f9                	mov    %edi,%ecx
+  801f72:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801f77:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801f7c:	e8 69 fa ff ff       	call   8019ea <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801f81:	6a 00                	push   $0x0
+  801f83:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801f86:	50                   	push   %eax
+  801f87:	6a 00                	push   $0x0
+  801f89:	6a 00                	push   $0x0
+  801f8b:	e8 c6 0e 00 00       	call   802e56 <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  801f90:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  801f93:	eb 8a                	jmp    801f1f <devfile_write+0x47>
+
+00801f95 <open>:
+{
+  801f95:	55                   	push   %ebp
+  801f96:	89 e5                	mov    %esp,%ebp
+  801f98:	56                   	push   %esi
+  801f99:	53                   	push   %ebx
+  801f9a:	83 ec 1c             	sub    $0x1c,%esp
+  801f9d:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801fa0:	56                   	push   %esi
+  801fa1:	e8 86 eb ff ff       	call   800b2c <strlen>
+  801fa6:	83 c4 10             	add    $0x10,%esp
+  801fa9:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801fae:	7f 6c                	jg     80201c <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  801fb0:	83 ec 0c             	sub    $0xc,%esp
+  801fb3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fb6:	50                   	push   %eax
+  801fb7:	e8 ad f4 ff ff       	call   801469 <fd_alloc>
+  801fbc:	89 c3                	mov    %eax,%ebx
+  801fbe:	83 c4 10             	add    $0x10,%esp
+  801fc1:	85 c0                	test   %eax,%eax
+  801fc3:	78 3c                	js     802001 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801fc5:	83 ec 08             	sub    $0x8,%esp
+  801fc8:	56                   	push   %esi
+  801fc9:	68 00 70 80 00       	push   $0x807000
+  801fce:	e8 94 eb ff ff       	call   800b67 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801fd3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801fd6:	a3 00 74 80 00       	mov    %eax,0x807400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801fdb:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801fde:	b8 01 00 00 00       	mov    $0x1,%eax
+  801fe3:	e8 1b fb ff ff       	call   801b03 <fsipc>
+  801fe8:	89 c3                	mov    %eax,%ebx
+  801fea:	83 c4 10             	add    $0x10,%esp
+  801fed:	85 c0                	test   %eax,%eax
+  801fef:	78 19                	js     80200a <open+0x75>
+  return fd2num(fd);
+  801ff1:	83 ec 0c             	sub    $0xc,%esp
+  801ff4:	ff 75 f4             	push   -0xc(%ebp)
+  801ff7:	e8 49 f4 ff ff       	call   801445 <fd2num>
+  801ffc:	89 c3                	mov    %eax,%ebx
+  801ffe:	83 c4 10             	add    $0x10,%esp
+}
+  802001:	89 d8                	mov    %ebx,%eax
+  802003:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802006:	5b                   	pop    %ebx
+  802007:	5e                   	pop    %esi
+  802008:	5d                   	pop    %ebp
+  802009:	c3                   	ret
+    fd_close(fd, 0);
+  80200a:	83 ec 08             	sub    $0x8,%esp
+  80200d:	6a 00                	push   $0x0
+  80200f:	ff 75 f4             	push   -0xc(%ebp)
+  802012:	e8 44 f5 ff ff       	call   80155b <fd_close>
+    return r;
+  802017:	83 c4 10             	add    $0x10,%esp
+  80201a:	eb e5                	jmp    802001 <open+0x6c>
+    return -E_BAD_PATH;
+  80201c:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802021:	eb de                	jmp    802001 <open+0x6c>
+
+00802023 <open_read>:
+{
+  802023:	55                   	push   %ebp
+  802024:	89 e5                	mov    %esp,%ebp
+  802026:	57                   	push   %edi
+  802027:	56                   	push   %esi
+  802028:	53                   	push   %ebx
+  802029:	83 ec 28             	sub    $0x28,%esp
+  80202c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  80202f:	57                   	push   %edi
+  802030:	e8 f7 ea ff ff       	call   800b2c <strlen>
+  802035:	83 c4 10             	add    $0x10,%esp
+  802038:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80203d:	0f 87 f6 00 00 00    	ja     802139 <open_read+0x116>
+  802043:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  802045:	83 ec 0c             	sub    $0xc,%esp
+  802048:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80204b:	50                   	push   %eax
+  80204c:	e8 18 f4 ff ff       	call   801469 <fd_alloc>
+  802051:	89 c3                	mov    %eax,%ebx
+  802053:	83 c4 10             	add    $0x10,%esp
+  802056:	85 c0                	test   %eax,%eax
+  802058:	0f 88 b2 00 00 00    	js     802110 <open_read+0xed>
+  strcpy(req->req_buf, path);
+  80205e:	83 ec 08             	sub    $0x8,%esp
+  802061:	57                   	push   %edi
+  802062:	68 e4 70 80 00       	push   $0x8070e4
+  802067:	e8 fb ea ff ff       	call   800b67 <strcpy>
+  req->req_nops = 2;
+  80206c:	c7 05 00 70 80 00 02 	movl   $0x2,0x807000
+  802073:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  802076:	c7 05 04 70 80 00 01 	movl   $0x1,0x807004
+  80207d:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  802080:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802083:	a3 10 70 80 00       	mov    %eax,0x807010
+  req->req_ops[0].op_buf = 0;
+  802088:	c7 05 18 70 80 00 00 	movl   $0x0,0x807018
+  80208f:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  802092:	c7 05 20 70 80 00 04 	movl   $0x4,0x807020
+  802099:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  80209c:	c7 05 24 70 80 00 01 	movl   $0x1,0x807024
+  8020a3:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  8020a6:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  8020ab:	29 f0                	sub    %esi,%eax
+  8020ad:	3b 45 14             	cmp    0x14(%ebp),%eax
+  8020b0:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  8020b4:	a3 2c 70 80 00       	mov    %eax,0x80702c
+  req->req_ops[1].op_offset = 0;
+  8020b9:	c7 05 30 70 80 00 00 	movl   $0x0,0x807030
+  8020c0:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  8020c3:	83 c6 01             	add    $0x1,%esi
+  8020c6:	89 35 34 70 80 00    	mov    %esi,0x807034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  8020cc:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8020cf:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8020d4:	e8 2a fa ff ff       	call   801b03 <fsipc>
+  8020d9:	89 c3                	mov    %eax,%ebx
+  8020db:	83 c4 10             	add    $0x10,%esp
+  8020de:	83 f8 01             	cmp    $0x1,%eax
+  8020e1:	7e 37                	jle    80211a <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  8020e3:	a1 38 70 80 00       	mov    0x807038,%eax
+  8020e8:	8b 55 18             	mov    0x18(%ebp),%edx
+  8020eb:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  8020ed:	83 ec 04             	sub    $0x4,%esp
+  8020f0:	50                   	push   %eax
+  8020f1:	81 c6 e4 70 80 00    	add    $0x8070e4,%esi
+  8020f7:	56                   	push   %esi
+  8020f8:	ff 75 10             	push   0x10(%ebp)
+  8020fb:	e8 ed eb ff ff       	call   800ced <memmove>
+  return fd2num(fd);
+  802100:	83 c4 04             	add    $0x4,%esp
+  802103:	ff 75 e4             	push   -0x1c(%ebp)
+  802106:	e8 3a f3 ff ff       	call   801445 <fd2num>
+  80210b:	89 c3                	mov    %eax,%ebx
+  80210d:	83 c4 10             	add    $0x10,%esp
+}
+  802110:	89 d8                	mov    %ebx,%eax
+  802112:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802115:	5b                   	pop    %ebx
+  802116:	5e                   	pop    %esi
+  802117:	5f                   	pop    %edi
+  802118:	5d                   	pop    %ebp
+  802119:	c3                   	ret
+    fd_close(fd, 0);
+  80211a:	83 ec 08             	sub    $0x8,%esp
+  80211d:	6a 00                	push   $0x0
+  80211f:	ff 75 e4             	push   -0x1c(%ebp)
+  802122:	e8 34 f4 ff ff       	call   80155b <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  802127:	83 c4 10             	add    $0x10,%esp
+  80212a:	85 db                	test   %ebx,%ebx
+  80212c:	78 e2                	js     802110 <open_read+0xed>
+  80212e:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  802131:	8b 9b 1c 70 80 00    	mov    0x80701c(%ebx),%ebx
+  802137:	eb d7                	jmp    802110 <open_read+0xed>
+    return -E_BAD_PATH;
+  802139:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80213e:	eb d0                	jmp    802110 <open_read+0xed>
+
+00802140 <file_stat>:
+{
+  802140:	55                   	push   %ebp
+  802141:	89 e5                	mov    %esp,%ebp
+  802143:	57                   	push   %edi
+  802144:	56                   	push   %esi
+  802145:	53                   	push   %ebx
+  802146:	83 ec 18             	sub    $0x18,%esp
+  802149:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80214c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  80214f:	57                   	push   %edi
+  802150:	e8 d7 e9 ff ff       	call   800b2c <strlen>
+  802155:	83 c4 10             	add    $0x10,%esp
+  802158:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80215d:	0f 8f c7 00 00 00    	jg     80222a <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  802163:	83 ec 0c             	sub    $0xc,%esp
+  802166:	57                   	push   %edi
+  802167:	e8 c0 e9 ff ff       	call   800b2c <strlen>
+  80216c:	8d 58 04             	lea    0x4(%eax),%ebx
+  80216f:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  802172:	83 c4 08             	add    $0x8,%esp
+  802175:	57                   	push   %edi
+  802176:	68 e4 70 80 00       	push   $0x8070e4
+  80217b:	e8 e7 e9 ff ff       	call   800b67 <strcpy>
+  req->req_nops = 2;
+  802180:	c7 05 00 70 80 00 02 	movl   $0x2,0x807000
+  802187:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  80218a:	c7 05 04 70 80 00 02 	movl   $0x2,0x807004
+  802191:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  802194:	c7 05 10 70 80 00 00 	movl   $0x0,0x807010
+  80219b:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  80219e:	c7 05 18 70 80 00 00 	movl   $0x0,0x807018
+  8021a5:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  8021a8:	c7 05 20 70 80 00 03 	movl   $0x3,0x807020
+  8021af:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  8021b2:	c7 05 24 70 80 00 01 	movl   $0x1,0x807024
+  8021b9:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  8021bc:	89 1d 34 70 80 00    	mov    %ebx,0x807034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  8021c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021c7:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8021cc:	e8 32 f9 ff ff       	call   801b03 <fsipc>
+  8021d1:	83 c4 10             	add    $0x10,%esp
+  8021d4:	83 f8 01             	cmp    $0x1,%eax
+  8021d7:	7e 42                	jle    80221b <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  8021d9:	81 c3 e4 70 80 00    	add    $0x8070e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  8021df:	83 ec 08             	sub    $0x8,%esp
+  8021e2:	53                   	push   %ebx
+  8021e3:	56                   	push   %esi
+  8021e4:	e8 7e e9 ff ff       	call   800b67 <strcpy>
+  st->st_size = ret->ret_size;
+  8021e9:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  8021ef:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  8021f5:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  8021fb:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  802201:	c7 86 88 00 00 00 04 	movl   $0x804004,0x88(%esi)
+  802208:	40 80 00 
+  return 0;
+  80220b:	83 c4 10             	add    $0x10,%esp
+  80220e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802213:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802216:	5b                   	pop    %ebx
+  802217:	5e                   	pop    %esi
+  802218:	5f                   	pop    %edi
+  802219:	5d                   	pop    %ebp
+  80221a:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  80221b:	85 c0                	test   %eax,%eax
+  80221d:	78 f4                	js     802213 <file_stat+0xd3>
+  80221f:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802222:	8b 80 1c 70 80 00    	mov    0x80701c(%eax),%eax
+  802228:	eb e9                	jmp    802213 <file_stat+0xd3>
+    return -E_BAD_PATH;
+  80222a:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  80222f:	eb e2                	jmp    802213 <file_stat+0xd3>
+
+00802231 <read_map>:
+{
+  802231:	55                   	push   %ebp
+  802232:	89 e5                	mov    %esp,%ebp
+  802234:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802237:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80223a:	50                   	push   %eax
+  80223b:	ff 75 08             	push   0x8(%ebp)
+  80223e:	e8 7c f2 ff ff       	call   8014bf <fd_lookup>
+  802243:	83 c4 10             	add    $0x10,%esp
+  802246:	85 c0                	test   %eax,%eax
+  802248:	78 2a                	js     802274 <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  80224a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80224d:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  802253:	39 08                	cmp    %ecx,(%eax)
+  802255:	75 1f                	jne    802276 <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  802257:	8b 40 0c             	mov    0xc(%eax),%eax
+  80225a:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.read_map.req_offset = offset;
+  80225f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802262:	a3 04 70 80 00       	mov    %eax,0x807004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  802267:	8b 55 10             	mov    0x10(%ebp),%edx
+  80226a:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80226f:	e8 8f f8 ff ff       	call   801b03 <fsipc>
+}
+  802274:	c9                   	leave
+  802275:	c3                   	ret
+    return -E_INVAL;
+  802276:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80227b:	eb f7                	jmp    802274 <read_map+0x43>
+
+0080227d <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80227d:	55                   	push   %ebp
+  80227e:	89 e5                	mov    %esp,%ebp
+  802280:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  802283:	ba 00 00 00 00       	mov    $0x0,%edx
+  802288:	b8 08 00 00 00       	mov    $0x8,%eax
+  80228d:	e8 71 f8 ff ff       	call   801b03 <fsipc>
+}
+  802292:	c9                   	leave
+  802293:	c3                   	ret
+
+00802294 <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  802294:	55                   	push   %ebp
+  802295:	89 e5                	mov    %esp,%ebp
+  802297:	57                   	push   %edi
+  802298:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  802299:	8b 45 08             	mov    0x8(%ebp),%eax
+  80229c:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.stats.req_bio_sched = 0;
+  8022a1:	c7 05 04 70 80 00 00 	movl   $0x0,0x807004
+  8022a8:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  8022ab:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  8022b2:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  8022b5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022ba:	b8 09 00 00 00       	mov    $0x9,%eax
+  8022bf:	e8 3f f8 ff ff       	call   801b03 <fsipc>
+  8022c4:	85 c0                	test   %eax,%eax
+  8022c6:	78 14                	js     8022dc <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  8022c8:	be 00 70 80 00       	mov    $0x807000,%esi
+  8022cd:	b9 16 00 00 00       	mov    $0x16,%ecx
+  8022d2:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8022d5:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  8022d7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022dc:	5e                   	pop    %esi
+  8022dd:	5f                   	pop    %edi
+  8022de:	5d                   	pop    %ebp
+  8022df:	c3                   	ret
+
+008022e0 <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  8022e0:	55                   	push   %ebp
+  8022e1:	89 e5                	mov    %esp,%ebp
+  8022e3:	53                   	push   %ebx
+  8022e4:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  8022e7:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8022ea:	50                   	push   %eax
+  8022eb:	6a 00                	push   $0x0
+  8022ed:	e8 a2 ff ff ff       	call   802294 <fs_stats>
+  8022f2:	83 c4 10             	add    $0x10,%esp
+  8022f5:	85 c0                	test   %eax,%eax
+  8022f7:	78 28                	js     802321 <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  8022f9:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  8022fc:	83 ec 08             	sub    $0x8,%esp
+  8022ff:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802302:	50                   	push   %eax
+  802303:	6a 20                	push   $0x20
+  802305:	e8 8a ff ff ff       	call   802294 <fs_stats>
+  80230a:	83 c4 10             	add    $0x10,%esp
+  80230d:	85 c0                	test   %eax,%eax
+  80230f:	78 10                	js     802321 <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  802311:	83 ec 08             	sub    $0x8,%esp
+  802314:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802317:	50                   	push   %eax
+  802318:	53                   	push   %ebx
+  802319:	e8 76 ff ff ff       	call   802294 <fs_stats>
+  80231e:	83 c4 10             	add    $0x10,%esp
+}
+  802321:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802324:	c9                   	leave
+  802325:	c3                   	ret
+
+00802326 <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  802326:	55                   	push   %ebp
+  802327:	89 e5                	mov    %esp,%ebp
+  802329:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  80232c:	c7 05 00 70 80 00 00 	movl   $0x0,0x807000
+  802333:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  802336:	8b 45 08             	mov    0x8(%ebp),%eax
+  802339:	a3 04 70 80 00       	mov    %eax,0x807004
+  fsipcbuf.stats.req_dcache = 0;
+  80233e:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  802345:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  802348:	ba 00 00 00 00       	mov    $0x0,%edx
+  80234d:	b8 09 00 00 00       	mov    $0x9,%eax
+  802352:	e8 ac f7 ff ff       	call   801b03 <fsipc>
+}
+  802357:	c9                   	leave
+  802358:	c3                   	ret
+
+00802359 <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  802359:	55                   	push   %ebp
+  80235a:	89 e5                	mov    %esp,%ebp
+  80235c:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  80235f:	c7 05 00 70 80 00 00 	movl   $0x0,0x807000
+  802366:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  802369:	c7 05 04 70 80 00 00 	movl   $0x0,0x807004
+  802370:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  802373:	8b 45 08             	mov    0x8(%ebp),%eax
+  802376:	a3 08 70 80 00       	mov    %eax,0x807008
+  return fsipc(FSREQ_STATS, NULL);
+  80237b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802380:	b8 09 00 00 00       	mov    $0x9,%eax
+  802385:	e8 79 f7 ff ff       	call   801b03 <fsipc>
+}
+  80238a:	c9                   	leave
+  80238b:	c3                   	ret
+
+0080238c <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  80238c:	55                   	push   %ebp
+  80238d:	89 e5                	mov    %esp,%ebp
+  80238f:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802392:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802395:	50                   	push   %eax
+  802396:	ff 75 08             	push   0x8(%ebp)
+  802399:	e8 21 f1 ff ff       	call   8014bf <fd_lookup>
+  80239e:	83 c4 10             	add    $0x10,%esp
+  8023a1:	85 c0                	test   %eax,%eax
+  8023a3:	78 34                	js     8023d9 <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  8023a5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023a8:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  8023ae:	39 08                	cmp    %ecx,(%eax)
+  8023b0:	75 29                	jne    8023db <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  8023b2:	8b 40 0c             	mov    0xc(%eax),%eax
+  8023b5:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.fallocate.req_offset = offset;
+  8023ba:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8023bd:	a3 04 70 80 00       	mov    %eax,0x807004
+  fsipcbuf.fallocate.req_len = len;
+  8023c2:	8b 45 10             	mov    0x10(%ebp),%eax
+  8023c5:	a3 08 70 80 00       	mov    %eax,0x807008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  8023ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023cf:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8023d4:	e8 2a f7 ff ff       	call   801b03 <fsipc>
+}
+  8023d9:	c9                   	leave
+  8023da:	c3                   	ret
+    return -E_INVAL;
+  8023db:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8023e0:	eb f7                	jmp    8023d9 <fallocate+0x4d>
+
+008023e2 <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  8023e2:	55                   	push   %ebp
+  8023e3:	89 e5                	mov    %esp,%ebp
+  8023e5:	57                   	push   %edi
+  8023e6:	56                   	push   %esi
+  8023e7:	53                   	push   %ebx
+  8023e8:	83 ec 24             	sub    $0x24,%esp
+  8023eb:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8023ee:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8023f1:	50                   	push   %eax
+  8023f2:	ff 75 08             	push   0x8(%ebp)
+  8023f5:	e8 c5 f0 ff ff       	call   8014bf <fd_lookup>
+  8023fa:	83 c4 10             	add    $0x10,%esp
+  8023fd:	85 c0                	test   %eax,%eax
+  8023ff:	78 66                	js     802467 <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  802401:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802404:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  80240a:	39 08                	cmp    %ecx,(%eax)
+  80240c:	75 61                	jne    80246f <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  80240e:	85 f6                	test   %esi,%esi
+  802410:	7e 50                	jle    802462 <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  802412:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  802417:	39 de                	cmp    %ebx,%esi
+  802419:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  80241c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80241f:	8b 40 0c             	mov    0xc(%eax),%eax
+  802422:	a3 00 70 80 00       	mov    %eax,0x807000
+    fsipcbuf.prefetch.req_n = m;
+  802427:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  80242d:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  802434:	83 ec 04             	sub    $0x4,%esp
+  802437:	57                   	push   %edi
+  802438:	ff 75 0c             	push   0xc(%ebp)
+  80243b:	68 08 70 80 00       	push   $0x807008
+  802440:	e8 a8 e8 ff ff       	call   800ced <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  802445:	ba 00 00 00 00       	mov    $0x0,%edx
+  80244a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80244f:	e8 af f6 ff ff       	call   801b03 <fsipc>
+  802454:	83 c4 10             	add    $0x10,%esp
+  802457:	85 c0                	test   %eax,%eax
+  802459:	78 0c                	js     802467 <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  80245b:	01 7d 0c             	add    %edi,0xc(%ebp)
+  80245e:	29 de                	sub    %ebx,%esi
+  802460:	eb ac                	jmp    80240e <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  802462:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802467:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80246a:	5b                   	pop    %ebx
+  80246b:	5e                   	pop    %esi
+  80246c:	5f                   	pop    %edi
+  80246d:	5d                   	pop    %ebp
+  80246e:	c3                   	ret
+    return -E_INVAL;
+  80246f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802474:	eb f1                	jmp    802467 <prefetch+0x85>
+
+00802476 <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  802476:	55                   	push   %ebp
+  802477:	89 e5                	mov    %esp,%ebp
+  802479:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  80247c:	50                   	push   %eax
+  80247d:	e8 d3 ef ff ff       	call   801455 <fd2data>
+  802482:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  802487:	c9                   	leave
+  802488:	c3                   	ret
+
+00802489 <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802489:	55                   	push   %ebp
+  80248a:	89 e5                	mov    %esp,%ebp
+  80248c:	56                   	push   %esi
+  80248d:	53                   	push   %ebx
+  80248e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  802491:	83 ec 0c             	sub    $0xc,%esp
+  802494:	ff 75 08             	push   0x8(%ebp)
+  802497:	e8 b9 ef ff ff       	call   801455 <fd2data>
+  80249c:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  80249e:	83 c4 08             	add    $0x8,%esp
+  8024a1:	68 a8 37 80 00       	push   $0x8037a8
+  8024a6:	53                   	push   %ebx
+  8024a7:	e8 bb e6 ff ff       	call   800b67 <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  8024ac:	8b 46 04             	mov    0x4(%esi),%eax
+  8024af:	2b 06                	sub    (%esi),%eax
+  8024b1:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  8024b7:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8024be:	00 00 00 
+  stat->st_dev = &devpipe;
+  8024c1:	c7 83 88 00 00 00 20 	movl   $0x804020,0x88(%ebx)
+  8024c8:	40 80 00 
+  return 0;
+}
+  8024cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024d0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024d3:	5b                   	pop    %ebx
+  8024d4:	5e                   	pop    %esi
+  8024d5:	5d                   	pop    %ebp
+  8024d6:	c3                   	ret
+
+008024d7 <pipe_wakeup>:
+{
+  8024d7:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  8024d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024de:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  8024e1:	85 c0                	test   %eax,%eax
+  8024e3:	75 01                	jne    8024e6 <pipe_wakeup+0xf>
+  8024e5:	c3                   	ret
+{
+  8024e6:	55                   	push   %ebp
+  8024e7:	89 e5                	mov    %esp,%ebp
+  8024e9:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  8024ec:	6a 00                	push   $0x0
+  8024ee:	68 00 00 c0 ee       	push   $0xeec00000
+  8024f3:	52                   	push   %edx
+  8024f4:	e8 f9 ed ff ff       	call   8012f2 <sys_chan_wakeup>
+  8024f9:	83 c4 10             	add    $0x10,%esp
+}
+  8024fc:	c9                   	leave
+  8024fd:	c3                   	ret
+
+008024fe <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8024fe:	55                   	push   %ebp
+  8024ff:	89 e5                	mov    %esp,%ebp
+  802501:	57                   	push   %edi
+  802502:	56                   	push   %esi
+  802503:	53                   	push   %ebx
+  802504:	83 ec 18             	sub    $0x18,%esp
+  802507:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  80250a:	57                   	push   %edi
+  80250b:	e8 45 ef ff ff       	call   801455 <fd2data>
+  802510:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  802512:	83 c4 10             	add    $0x10,%esp
+  802515:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  802519:	74 2a                	je     802545 <devpipe_close+0x47>
+  80251b:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  802520:	89 f8                	mov    %edi,%eax
+  802522:	e8 4f ff ff ff       	call   802476 <pipe_ring>
+  802527:	83 ec 08             	sub    $0x8,%esp
+  80252a:	01 d8                	add    %ebx,%eax
+  80252c:	50                   	push   %eax
+  80252d:	6a 00                	push   $0x0
+  80252f:	e8 e7 ea ff ff       	call   80101b <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  802534:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80253a:	83 c4 10             	add    $0x10,%esp
+  80253d:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  802543:	75 db                	jne    802520 <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  802545:	83 ec 08             	sub    $0x8,%esp
+  802548:	57                   	push   %edi
+  802549:	6a 00                	push   $0x0
+  80254b:	e8 cb ea ff ff       	call   80101b <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  802550:	83 c4 10             	add    $0x10,%esp
+  802553:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  802557:	75 13                	jne    80256c <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  802559:	83 ec 08             	sub    $0x8,%esp
+  80255c:	56                   	push   %esi
+  80255d:	6a 00                	push   $0x0
+  80255f:	e8 b7 ea ff ff       	call   80101b <sys_page_unmap>
+}
+  802564:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802567:	5b                   	pop    %ebx
+  802568:	5e                   	pop    %esi
+  802569:	5f                   	pop    %edi
+  80256a:	5d                   	pop    %ebp
+  80256b:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  80256c:	8d 56 04             	lea    0x4(%esi),%edx
+  80256f:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802572:	e8 60 ff ff ff       	call   8024d7 <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802577:	8d 46 30             	lea    0x30(%esi),%eax
+  80257a:	89 f2                	mov    %esi,%edx
+  80257c:	e8 56 ff ff ff       	call   8024d7 <pipe_wakeup>
+  802581:	eb d6                	jmp    802559 <devpipe_close+0x5b>
+
+00802583 <_pipeisclosed>:
+{
+  802583:	55                   	push   %ebp
+  802584:	89 e5                	mov    %esp,%ebp
+  802586:	57                   	push   %edi
+  802587:	56                   	push   %esi
+  802588:	53                   	push   %ebx
+  802589:	83 ec 1c             	sub    $0x1c,%esp
+  80258c:	89 c7                	mov    %eax,%edi
+  80258e:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  802590:	a1 64 6b 80 00       	mov    0x806b64,%eax
+  802595:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  802598:	83 ec 0c             	sub    $0xc,%esp
+  80259b:	57                   	push   %edi
+  80259c:	e8 18 0a 00 00       	call   802fb9 <pageref>
+  8025a1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8025a4:	89 34 24             	mov    %esi,(%esp)
+  8025a7:	e8 0d 0a 00 00       	call   802fb9 <pageref>
+    nn = thisenv->env_runs;
+  8025ac:	8b 15 64 6b 80 00    	mov    0x806b64,%edx
+  8025b2:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  8025b5:	83 c4 10             	add    $0x10,%esp
+  8025b8:	39 cb                	cmp    %ecx,%ebx
+  8025ba:	74 1b                	je     8025d7 <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  8025bc:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8025bf:	75 cf                	jne    802590 <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8025c1:	8b 42 58             	mov    0x58(%edx),%eax
+  8025c4:	6a 01                	push   $0x1
+  8025c6:	50                   	push   %eax
+  8025c7:	53                   	push   %ebx
+  8025c8:	68 af 37 80 00       	push   $0x8037af
+  8025cd:	e8 a7 df ff ff       	call   800579 <cprintf>
+  8025d2:	83 c4 10             	add    $0x10,%esp
+  8025d5:	eb b9                	jmp    802590 <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  8025d7:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8025da:	0f 94 c0             	sete   %al
+  8025dd:	0f b6 c0             	movzbl %al,%eax
+}
+  8025e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025e3:	5b                   	pop    %ebx
+  8025e4:	5e                   	pop    %esi
+  8025e5:	5f                   	pop    %edi
+  8025e6:	5d                   	pop    %ebp
+  8025e7:	c3                   	ret
+
+008025e8 <devpipe_write_bulk>:
+{
+  8025e8:	55                   	push   %ebp
+  8025e9:	89 e5                	mov    %esp,%ebp
+  8025eb:	57                   	push   %edi
+  8025ec:	56                   	push   %esi
+  8025ed:	53                   	push   %ebx
+  8025ee:	83 ec 1c             	sub    $0x1c,%esp
+  8025f1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8025f4:	89 d6                	mov    %edx,%esi
+  8025f6:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  8025f9:	e8 78 fe ff ff       	call   802476 <pipe_ring>
+  8025fe:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  802601:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802606:	8d 46 04             	lea    0x4(%esi),%eax
+  802609:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  80260c:	eb 75                	jmp    802683 <devpipe_write_bulk+0x9b>
+  80260e:	b8 01 00 00 00       	mov    $0x1,%eax
+  802613:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802617:	6a 64                	push   $0x64
+  802619:	68 00 00 c0 ee       	push   $0xeec00000
+  80261e:	53                   	push   %ebx
+  80261f:	56                   	push   %esi
+  802620:	e8 aa ec ff ff       	call   8012cf <sys_chan_sleep>
+      continue;
+  802625:	83 c4 10             	add    $0x10,%esp
+  802628:	eb 59                	jmp    802683 <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  80262a:	89 d1                	mov    %edx,%ecx
+  80262c:	c1 f9 1f             	sar    $0x1f,%ecx
+  80262f:	c1 e9 11             	shr    $0x11,%ecx
+  802632:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802635:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  80263a:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  80263c:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  802642:	29 d3                	sub    %edx,%ebx
+  802644:	ba 00 80 00 00       	mov    $0x8000,%edx
+  802649:	29 c2                	sub    %eax,%edx
+  80264b:	39 d3                	cmp    %edx,%ebx
+  80264d:	0f 47 da             	cmova  %edx,%ebx
+  802650:	8b 55 08             	mov    0x8(%ebp),%edx
+  802653:	29 fa                	sub    %edi,%edx
+  802655:	39 d3                	cmp    %edx,%ebx
+  802657:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  80265a:	83 ec 04             	sub    $0x4,%esp
+  80265d:	53                   	push   %ebx
+  80265e:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802661:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  802664:	52                   	push   %edx
+  802665:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802668:	01 c8                	add    %ecx,%eax
+  80266a:	50                   	push   %eax
+  80266b:	e8 df e6 ff ff       	call   800d4f <memcpy>
+    i += m;
+  802670:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  802672:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802675:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802678:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80267b:	e8 57 fe ff ff       	call   8024d7 <pipe_wakeup>
+  802680:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802683:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802686:	73 2b                	jae    8026b3 <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  802688:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  80268a:	8b 56 04             	mov    0x4(%esi),%edx
+  80268d:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  802693:	39 d0                	cmp    %edx,%eax
+  802695:	7d 93                	jge    80262a <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  802697:	89 f2                	mov    %esi,%edx
+  802699:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80269c:	e8 e2 fe ff ff       	call   802583 <_pipeisclosed>
+  8026a1:	85 c0                	test   %eax,%eax
+  8026a3:	0f 84 65 ff ff ff    	je     80260e <devpipe_write_bulk+0x26>
+        return i;
+  8026a9:	89 f8                	mov    %edi,%eax
+}
+  8026ab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026ae:	5b                   	pop    %ebx
+  8026af:	5e                   	pop    %esi
+  8026b0:	5f                   	pop    %edi
+  8026b1:	5d                   	pop    %ebp
+  8026b2:	c3                   	ret
+  return i;
+  8026b3:	89 f8                	mov    %edi,%eax
+  8026b5:	eb f4                	jmp    8026ab <devpipe_write_bulk+0xc3>
+
+008026b7 <devpipe_write>:
+{
+  8026b7:	55                   	push   %ebp
+  8026b8:	89 e5                	mov    %esp,%ebp
+  8026ba:	57                   	push   %edi
+  8026bb:	56                   	push   %esi
+  8026bc:	53                   	push   %ebx
+  8026bd:	83 ec 28             	sub    $0x28,%esp
+  8026c0:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  8026c3:	56                   	push   %esi
+  8026c4:	e8 8c ed ff ff       	call   801455 <fd2data>
+  8026c9:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  8026cb:	8b 78 28             	mov    0x28(%eax),%edi
+  8026ce:	83 c4 10             	add    $0x10,%esp
+  8026d1:	85 ff                	test   %edi,%edi
+  8026d3:	75 25                	jne    8026fa <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  8026d5:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8026d8:	74 66                	je     802740 <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8026da:	8b 43 04             	mov    0x4(%ebx),%eax
+  8026dd:	8b 0b                	mov    (%ebx),%ecx
+  8026df:	8d 51 20             	lea    0x20(%ecx),%edx
+  8026e2:	39 d0                	cmp    %edx,%eax
+  8026e4:	72 2b                	jb     802711 <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  8026e6:	89 da                	mov    %ebx,%edx
+  8026e8:	89 f0                	mov    %esi,%eax
+  8026ea:	e8 94 fe ff ff       	call   802583 <_pipeisclosed>
+  8026ef:	85 c0                	test   %eax,%eax
+  8026f1:	75 51                	jne    802744 <devpipe_write+0x8d>
+      sys_yield();
+  8026f3:	e8 3c e8 ff ff       	call   800f34 <sys_yield>
+  8026f8:	eb e0                	jmp    8026da <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  8026fa:	83 ec 0c             	sub    $0xc,%esp
+  8026fd:	ff 75 10             	push   0x10(%ebp)
+  802700:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802703:	89 c2                	mov    %eax,%edx
+  802705:	89 f0                	mov    %esi,%eax
+  802707:	e8 dc fe ff ff       	call   8025e8 <devpipe_write_bulk>
+  80270c:	83 c4 10             	add    $0x10,%esp
+  80270f:	eb 38                	jmp    802749 <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802711:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802714:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802718:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  80271b:	89 c2                	mov    %eax,%edx
+  80271d:	c1 fa 1f             	sar    $0x1f,%edx
+  802720:	89 d1                	mov    %edx,%ecx
+  802722:	c1 e9 1b             	shr    $0x1b,%ecx
+  802725:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802728:	83 e2 1f             	and    $0x1f,%edx
+  80272b:	29 ca                	sub    %ecx,%edx
+  80272d:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802731:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  802735:	83 c0 01             	add    $0x1,%eax
+  802738:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  80273b:	83 c7 01             	add    $0x1,%edi
+  80273e:	eb 95                	jmp    8026d5 <devpipe_write+0x1e>
+  return i;
+  802740:	89 f8                	mov    %edi,%eax
+  802742:	eb 05                	jmp    802749 <devpipe_write+0x92>
+        return 0;
+  802744:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802749:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80274c:	5b                   	pop    %ebx
+  80274d:	5e                   	pop    %esi
+  80274e:	5f                   	pop    %edi
+  80274f:	5d                   	pop    %ebp
+  802750:	c3                   	ret
+
+00802751 <devpipe_read_bulk>:
+{
+  802751:	55                   	push   %ebp
+  802752:	89 e5                	mov    %esp,%ebp
+  802754:	57                   	push   %edi
+  802755:	56                   	push   %esi
+  802756:	53                   	push   %ebx
+  802757:	83 ec 2c             	sub    $0x2c,%esp
+  80275a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80275d:	89 d6                	mov    %edx,%esi
+  80275f:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802762:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  802765:	e8 0c fd ff ff       	call   802476 <pipe_ring>
+  80276a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  80276d:	85 db                	test   %ebx,%ebx
+  80276f:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802774:	0f 45 c3             	cmovne %ebx,%eax
+  802777:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80277a:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  80277f:	8d 46 30             	lea    0x30(%esi),%eax
+  802782:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  802785:	eb 50                	jmp    8027d7 <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  802787:	89 d1                	mov    %edx,%ecx
+  802789:	c1 f9 1f             	sar    $0x1f,%ecx
+  80278c:	c1 e9 11             	shr    $0x11,%ecx
+  80278f:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802792:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802797:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  802799:	29 d3                	sub    %edx,%ebx
+  80279b:	ba 00 80 00 00       	mov    $0x8000,%edx
+  8027a0:	29 c2                	sub    %eax,%edx
+  8027a2:	39 d3                	cmp    %edx,%ebx
+  8027a4:	0f 47 da             	cmova  %edx,%ebx
+  8027a7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8027aa:	29 fa                	sub    %edi,%edx
+  8027ac:	39 d3                	cmp    %edx,%ebx
+  8027ae:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  8027b1:	83 ec 04             	sub    $0x4,%esp
+  8027b4:	53                   	push   %ebx
+  8027b5:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8027b8:	01 c8                	add    %ecx,%eax
+  8027ba:	50                   	push   %eax
+  8027bb:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8027be:	01 f8                	add    %edi,%eax
+  8027c0:	50                   	push   %eax
+  8027c1:	e8 89 e5 ff ff       	call   800d4f <memcpy>
+    i += m;
+  8027c6:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  8027c8:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8027ca:	89 f2                	mov    %esi,%edx
+  8027cc:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8027cf:	e8 03 fd ff ff       	call   8024d7 <pipe_wakeup>
+  8027d4:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  8027d7:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  8027da:	73 51                	jae    80282d <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  8027dc:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  8027df:	8b 16                	mov    (%esi),%edx
+  8027e1:	39 da                	cmp    %ebx,%edx
+  8027e3:	75 a2                	jne    802787 <devpipe_read_bulk+0x36>
+      if (i > 0)
+  8027e5:	85 ff                	test   %edi,%edi
+  8027e7:	75 44                	jne    80282d <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  8027e9:	89 f2                	mov    %esi,%edx
+  8027eb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8027ee:	e8 90 fd ff ff       	call   802583 <_pipeisclosed>
+  8027f3:	85 c0                	test   %eax,%eax
+  8027f5:	75 3a                	jne    802831 <devpipe_read_bulk+0xe0>
+  8027f7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8027fc:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802800:	6a 64                	push   $0x64
+  802802:	ff 75 d4             	push   -0x2c(%ebp)
+  802805:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  802806:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802809:	50                   	push   %eax
+  80280a:	e8 c0 ea ff ff       	call   8012cf <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  80280f:	85 c0                	test   %eax,%eax
+  802811:	ba 00 00 00 00       	mov    $0x0,%edx
+  802816:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  802819:	83 c4 10             	add    $0x10,%esp
+  80281c:	a8 01                	test   $0x1,%al
+  80281e:	74 b7                	je     8027d7 <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  802820:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  802825:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802828:	5b                   	pop    %ebx
+  802829:	5e                   	pop    %esi
+  80282a:	5f                   	pop    %edi
+  80282b:	5d                   	pop    %ebp
+  80282c:	c3                   	ret
+  return i;
+  80282d:	89 f8                	mov    %edi,%eax
+  80282f:	eb f4                	jmp    802825 <devpipe_read_bulk+0xd4>
+        return 0;
+  802831:	b8 00 00 00 00       	mov    $0x0,%eax
+  802836:	eb ed                	jmp    802825 <devpipe_read_bulk+0xd4>
+
+00802838 <devpipe_read>:
+{
+  802838:	55                   	push   %ebp
+  802839:	89 e5                	mov    %esp,%ebp
+  80283b:	57                   	push   %edi
+  80283c:	56                   	push   %esi
+  80283d:	53                   	push   %ebx
+  80283e:	83 ec 18             	sub    $0x18,%esp
+  802841:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  802844:	57                   	push   %edi
+  802845:	e8 0b ec ff ff       	call   801455 <fd2data>
+  80284a:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  80284c:	8b 70 28             	mov    0x28(%eax),%esi
+  80284f:	83 c4 10             	add    $0x10,%esp
+  802852:	85 f6                	test   %esi,%esi
+  802854:	75 24                	jne    80287a <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  802856:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802859:	74 60                	je     8028bb <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  80285b:	8b 03                	mov    (%ebx),%eax
+  80285d:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802860:	75 3b                	jne    80289d <devpipe_read+0x65>
+      if (i > 0)
+  802862:	85 f6                	test   %esi,%esi
+  802864:	75 2d                	jne    802893 <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  802866:	89 da                	mov    %ebx,%edx
+  802868:	89 f8                	mov    %edi,%eax
+  80286a:	e8 14 fd ff ff       	call   802583 <_pipeisclosed>
+  80286f:	85 c0                	test   %eax,%eax
+  802871:	75 4c                	jne    8028bf <devpipe_read+0x87>
+      sys_yield();
+  802873:	e8 bc e6 ff ff       	call   800f34 <sys_yield>
+  802878:	eb e1                	jmp    80285b <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  80287a:	83 ec 08             	sub    $0x8,%esp
+  80287d:	6a 00                	push   $0x0
+  80287f:	ff 75 10             	push   0x10(%ebp)
+  802882:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802885:	89 c2                	mov    %eax,%edx
+  802887:	89 f8                	mov    %edi,%eax
+  802889:	e8 c3 fe ff ff       	call   802751 <devpipe_read_bulk>
+  80288e:	83 c4 10             	add    $0x10,%esp
+  802891:	eb 02                	jmp    802895 <devpipe_read+0x5d>
+        return i;
+  802893:	89 f0                	mov    %esi,%eax
+}
+  802895:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802898:	5b                   	pop    %ebx
+  802899:	5e                   	pop    %esi
+  80289a:	5f                   	pop    %edi
+  80289b:	5d                   	pop    %ebp
+  80289c:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80289d:	99                   	cltd
+  80289e:	c1 ea 1b             	shr    $0x1b,%edx
+  8028a1:	01 d0                	add    %edx,%eax
+  8028a3:	83 e0 1f             	and    $0x1f,%eax
+  8028a6:	29 d0                	sub    %edx,%eax
+  8028a8:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8028ad:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8028b0:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  8028b3:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  8028b6:	83 c6 01             	add    $0x1,%esi
+  8028b9:	eb 9b                	jmp    802856 <devpipe_read+0x1e>
+  return i;
+  8028bb:	89 f0                	mov    %esi,%eax
+  8028bd:	eb d6                	jmp    802895 <devpipe_read+0x5d>
+        return 0;
+  8028bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028c4:	eb cf                	jmp    802895 <devpipe_read+0x5d>
+
+008028c6 <pipe2>:
+{
+  8028c6:	55                   	push   %ebp
+  8028c7:	89 e5                	mov    %esp,%ebp
+  8028c9:	57                   	push   %edi
+  8028ca:	56                   	push   %esi
+  8028cb:	53                   	push   %ebx
+  8028cc:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  8028cf:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8028d2:	50                   	push   %eax
+  8028d3:	e8 91 eb ff ff       	call   801469 <fd_alloc>
+  8028d8:	89 c3                	mov    %eax,%ebx
+  8028da:	83 c4 10             	add    $0x10,%esp
+  8028dd:	85 c0                	test   %eax,%eax
+  8028df:	0f 88 fb 01 00 00    	js     802ae0 <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8028e5:	83 ec 04             	sub    $0x4,%esp
+  8028e8:	68 07 04 00 00       	push   $0x407
+  8028ed:	ff 75 e4             	push   -0x1c(%ebp)
+  8028f0:	6a 00                	push   $0x0
+  8028f2:	e8 9f e6 ff ff       	call   800f96 <sys_page_alloc>
+  8028f7:	89 c3                	mov    %eax,%ebx
+  8028f9:	83 c4 10             	add    $0x10,%esp
+  8028fc:	85 c0                	test   %eax,%eax
+  8028fe:	0f 88 dc 01 00 00    	js     802ae0 <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  802904:	83 ec 0c             	sub    $0xc,%esp
+  802907:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80290a:	50                   	push   %eax
+  80290b:	e8 59 eb ff ff       	call   801469 <fd_alloc>
+  802910:	89 c3                	mov    %eax,%ebx
+  802912:	83 c4 10             	add    $0x10,%esp
+  802915:	85 c0                	test   %eax,%eax
+  802917:	0f 88 b3 01 00 00    	js     802ad0 <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80291d:	83 ec 04             	sub    $0x4,%esp
+  802920:	68 07 04 00 00       	push   $0x407
+  802925:	ff 75 e0             	push   -0x20(%ebp)
+  802928:	6a 00                	push   $0x0
+  80292a:	e8 67 e6 ff ff       	call   800f96 <sys_page_alloc>
+  80292f:	89 c3                	mov    %eax,%ebx
+  802931:	83 c4 10             	add    $0x10,%esp
+  802934:	85 c0                	test   %eax,%eax
+  802936:	0f 88 94 01 00 00    	js     802ad0 <pipe2+0x20a>
+  va = fd2data(fd0);
+  80293c:	83 ec 0c             	sub    $0xc,%esp
+  80293f:	ff 75 e4             	push   -0x1c(%ebp)
+  802942:	e8 0e eb ff ff       	call   801455 <fd2data>
+  802947:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802949:	83 c4 0c             	add    $0xc,%esp
+  80294c:	68 07 04 00 00       	push   $0x407
+  802951:	50                   	push   %eax
+  802952:	6a 00                	push   $0x0
+  802954:	e8 3d e6 ff ff       	call   800f96 <sys_page_alloc>
+  802959:	89 c3                	mov    %eax,%ebx
+  80295b:	83 c4 10             	add    $0x10,%esp
+  80295e:	85 c0                	test   %eax,%eax
+  802960:	0f 88 5a 01 00 00    	js     802ac0 <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802966:	83 ec 0c             	sub    $0xc,%esp
+  802969:	ff 75 e0             	push   -0x20(%ebp)
+  80296c:	e8 e4 ea ff ff       	call   801455 <fd2data>
+  802971:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802978:	50                   	push   %eax
+  802979:	6a 00                	push   $0x0
+  80297b:	57                   	push   %edi
+  80297c:	6a 00                	push   $0x0
+  80297e:	e8 56 e6 ff ff       	call   800fd9 <sys_page_map>
+  802983:	89 c3                	mov    %eax,%ebx
+  802985:	83 c4 20             	add    $0x20,%esp
+  802988:	85 c0                	test   %eax,%eax
+  80298a:	0f 88 22 01 00 00    	js     802ab2 <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  802990:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  802994:	74 72                	je     802a08 <pipe2+0x142>
+  802996:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  80299b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80299e:	e8 d3 fa ff ff       	call   802476 <pipe_ring>
+  8029a3:	83 ec 04             	sub    $0x4,%esp
+  8029a6:	68 07 04 00 00       	push   $0x407
+  8029ab:	01 f0                	add    %esi,%eax
+  8029ad:	50                   	push   %eax
+  8029ae:	6a 00                	push   $0x0
+  8029b0:	e8 e1 e5 ff ff       	call   800f96 <sys_page_alloc>
+  8029b5:	89 c3                	mov    %eax,%ebx
+  8029b7:	83 c4 10             	add    $0x10,%esp
+  8029ba:	85 c0                	test   %eax,%eax
+  8029bc:	0f 88 97 00 00 00    	js     802a59 <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  8029c2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8029c5:	e8 ac fa ff ff       	call   802476 <pipe_ring>
+  8029ca:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  8029cd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8029d0:	e8 a1 fa ff ff       	call   802476 <pipe_ring>
+  8029d5:	83 ec 0c             	sub    $0xc,%esp
+  8029d8:	68 07 04 00 00       	push   $0x407
+  8029dd:	53                   	push   %ebx
+  8029de:	6a 00                	push   $0x0
+  8029e0:	01 f0                	add    %esi,%eax
+  8029e2:	50                   	push   %eax
+  8029e3:	6a 00                	push   $0x0
+  8029e5:	e8 ef e5 ff ff       	call   800fd9 <sys_page_map>
+  8029ea:	89 c3                	mov    %eax,%ebx
+  8029ec:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8029f2:	83 c4 20             	add    $0x20,%esp
+  8029f5:	85 c0                	test   %eax,%eax
+  8029f7:	78 60                	js     802a59 <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  8029f9:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  8029ff:	75 9a                	jne    80299b <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  802a01:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  802a08:	a1 20 40 80 00       	mov    0x804020,%eax
+  802a0d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802a10:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  802a12:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802a15:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  802a1c:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802a1f:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  802a21:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802a24:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  802a2b:	83 ec 0c             	sub    $0xc,%esp
+  802a2e:	ff 75 e4             	push   -0x1c(%ebp)
+  802a31:	e8 0f ea ff ff       	call   801445 <fd2num>
+  802a36:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802a39:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  802a3b:	83 c4 04             	add    $0x4,%esp
+  802a3e:	ff 75 e0             	push   -0x20(%ebp)
+  802a41:	e8 ff e9 ff ff       	call   801445 <fd2num>
+  802a46:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802a49:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  802a4c:	83 c4 10             	add    $0x10,%esp
+  802a4f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a54:	e9 87 00 00 00       	jmp    802ae0 <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802a59:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  802a5e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802a61:	e8 10 fa ff ff       	call   802476 <pipe_ring>
+  802a66:	83 ec 08             	sub    $0x8,%esp
+  802a69:	01 f0                	add    %esi,%eax
+  802a6b:	50                   	push   %eax
+  802a6c:	6a 00                	push   $0x0
+  802a6e:	e8 a8 e5 ff ff       	call   80101b <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  802a73:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802a76:	e8 fb f9 ff ff       	call   802476 <pipe_ring>
+  802a7b:	83 c4 08             	add    $0x8,%esp
+  802a7e:	01 f0                	add    %esi,%eax
+  802a80:	50                   	push   %eax
+  802a81:	6a 00                	push   $0x0
+  802a83:	e8 93 e5 ff ff       	call   80101b <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802a88:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802a8e:	83 c4 10             	add    $0x10,%esp
+  802a91:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802a97:	75 c5                	jne    802a5e <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  802a99:	83 ec 0c             	sub    $0xc,%esp
+  802a9c:	ff 75 e0             	push   -0x20(%ebp)
+  802a9f:	e8 b1 e9 ff ff       	call   801455 <fd2data>
+  802aa4:	83 c4 08             	add    $0x8,%esp
+  802aa7:	50                   	push   %eax
+  802aa8:	6a 00                	push   $0x0
+  802aaa:	e8 6c e5 ff ff       	call   80101b <sys_page_unmap>
+  802aaf:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  802ab2:	83 ec 08             	sub    $0x8,%esp
+  802ab5:	57                   	push   %edi
+  802ab6:	6a 00                	push   $0x0
+  802ab8:	e8 5e e5 ff ff       	call   80101b <sys_page_unmap>
+  802abd:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  802ac0:	83 ec 08             	sub    $0x8,%esp
+  802ac3:	ff 75 e0             	push   -0x20(%ebp)
+  802ac6:	6a 00                	push   $0x0
+  802ac8:	e8 4e e5 ff ff       	call   80101b <sys_page_unmap>
+  802acd:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  802ad0:	83 ec 08             	sub    $0x8,%esp
+  802ad3:	ff 75 e4             	push   -0x1c(%ebp)
+  802ad6:	6a 00                	push   $0x0
+  802ad8:	e8 3e e5 ff ff       	call   80101b <sys_page_unmap>
+  802add:	83 c4 10             	add    $0x10,%esp
+}
+  802ae0:	89 d8                	mov    %ebx,%eax
+  802ae2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ae5:	5b                   	pop    %ebx
+  802ae6:	5e                   	pop    %esi
+  802ae7:	5f                   	pop    %edi
+  802ae8:	5d                   	pop    %ebp
+  802ae9:	c3                   	ret
+
+00802aea <pipe>:
+{
+  802aea:	55                   	push   %ebp
+  802aeb:	89 e5                	mov    %esp,%ebp
+  802aed:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  802af0:	6a 00                	push   $0x0
+  802af2:	ff 75 08             	push   0x8(%ebp)
+  802af5:	e8 cc fd ff ff       	call   8028c6 <pipe2>
+}
+  802afa:	c9                   	leave
+  802afb:	c3                   	ret
+
+00802afc <pipeisclosed>:
+{
+  802afc:	55                   	push   %ebp
+  802afd:	89 e5                	mov    %esp,%ebp
+  802aff:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802b02:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b05:	50                   	push   %eax
+  802b06:	ff 75 08             	push   0x8(%ebp)
+  802b09:	e8 b1 e9 ff ff       	call   8014bf <fd_lookup>
+  802b0e:	83 c4 10             	add    $0x10,%esp
+  802b11:	85 c0                	test   %eax,%eax
+  802b13:	78 18                	js     802b2d <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  802b15:	83 ec 0c             	sub    $0xc,%esp
+  802b18:	ff 75 f4             	push   -0xc(%ebp)
+  802b1b:	e8 35 e9 ff ff       	call   801455 <fd2data>
+  802b20:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  802b22:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b25:	e8 59 fa ff ff       	call   802583 <_pipeisclosed>
+  802b2a:	83 c4 10             	add    $0x10,%esp
+}
+  802b2d:	c9                   	leave
+  802b2e:	c3                   	ret
+
+00802b2f <pipe_splice>:
+{
+  802b2f:	55                   	push   %ebp
+  802b30:	89 e5                	mov    %esp,%ebp
+  802b32:	57                   	push   %edi
+  802b33:	56                   	push   %esi
+  802b34:	53                   	push   %ebx
+  802b35:	83 ec 34             	sub    $0x34,%esp
+  802b38:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802b3b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802b3e:	50                   	push   %eax
+  802b3f:	ff 75 08             	push   0x8(%ebp)
+  802b42:	e8 78 e9 ff ff       	call   8014bf <fd_lookup>
+  802b47:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802b4a:	83 c4 10             	add    $0x10,%esp
+  802b4d:	85 c0                	test   %eax,%eax
+  802b4f:	0f 88 d7 00 00 00    	js     802c2c <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  802b55:	83 ec 0c             	sub    $0xc,%esp
+  802b58:	ff 75 e4             	push   -0x1c(%ebp)
+  802b5b:	e8 f5 e8 ff ff       	call   801455 <fd2data>
+  802b60:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802b62:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802b65:	83 c4 10             	add    $0x10,%esp
+  802b68:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802b6e:	39 10                	cmp    %edx,(%eax)
+  802b70:	0f 85 c1 00 00 00    	jne    802c37 <pipe_splice+0x108>
+  802b76:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  802b7a:	0f 84 c0 00 00 00    	je     802c40 <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  802b80:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802b84:	0f 84 bf 00 00 00    	je     802c49 <pipe_splice+0x11a>
+  802b8a:	89 f7                	mov    %esi,%edi
+  802b8c:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  802b92:	0f 85 ba 00 00 00    	jne    802c52 <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802b98:	8d 43 04             	lea    0x4(%ebx),%eax
+  802b9b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802b9e:	eb 38                	jmp    802bd8 <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802ba0:	83 ec 0c             	sub    $0xc,%esp
+  802ba3:	68 00 10 00 00       	push   $0x1000
+  802ba8:	89 f1                	mov    %esi,%ecx
+  802baa:	89 da                	mov    %ebx,%edx
+  802bac:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802baf:	e8 34 fa ff ff       	call   8025e8 <devpipe_write_bulk>
+  802bb4:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802bb7:	83 c4 10             	add    $0x10,%esp
+  802bba:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802bbf:	75 53                	jne    802c14 <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  802bc1:	83 ec 08             	sub    $0x8,%esp
+  802bc4:	56                   	push   %esi
+  802bc5:	6a 00                	push   $0x0
+  802bc7:	e8 4f e4 ff ff       	call   80101b <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  802bcc:	83 c7 01             	add    $0x1,%edi
+  802bcf:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802bd5:	83 c4 10             	add    $0x10,%esp
+  802bd8:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802bdb:	74 3a                	je     802c17 <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  802bdd:	8b 03                	mov    (%ebx),%eax
+  802bdf:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802be2:	75 bc                	jne    802ba0 <pipe_splice+0x71>
+  802be4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802be9:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  802bed:	85 c0                	test   %eax,%eax
+  802bef:	74 af                	je     802ba0 <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802bf1:	83 ec 04             	sub    $0x4,%esp
+  802bf4:	6a 07                	push   $0x7
+  802bf6:	56                   	push   %esi
+  802bf7:	ff 75 d0             	push   -0x30(%ebp)
+  802bfa:	e8 f3 e6 ff ff       	call   8012f2 <sys_chan_wakeup>
+  802bff:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802c02:	83 c4 10             	add    $0x10,%esp
+  802c05:	85 c0                	test   %eax,%eax
+  802c07:	79 b8                	jns    802bc1 <pipe_splice+0x92>
+  802c09:	b8 01 00 00 00       	mov    $0x1,%eax
+  802c0e:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802c12:	eb 8c                	jmp    802ba0 <pipe_splice+0x71>
+  802c14:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  802c17:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802c1b:	75 06                	jne    802c23 <pipe_splice+0xf4>
+  802c1d:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802c21:	78 09                	js     802c2c <pipe_splice+0xfd>
+  return i * PGSIZE;
+  802c23:	8b 45 10             	mov    0x10(%ebp),%eax
+  802c26:	c1 e0 0c             	shl    $0xc,%eax
+  802c29:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  802c2c:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802c2f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c32:	5b                   	pop    %ebx
+  802c33:	5e                   	pop    %esi
+  802c34:	5f                   	pop    %edi
+  802c35:	5d                   	pop    %ebp
+  802c36:	c3                   	ret
+    return -E_INVAL;
+  802c37:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802c3e:	eb ec                	jmp    802c2c <pipe_splice+0xfd>
+  802c40:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802c47:	eb e3                	jmp    802c2c <pipe_splice+0xfd>
+  802c49:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802c50:	eb da                	jmp    802c2c <pipe_splice+0xfd>
+  802c52:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802c59:	eb d1                	jmp    802c2c <pipe_splice+0xfd>
+
+00802c5b <pipe_splice_read>:
+{
+  802c5b:	55                   	push   %ebp
+  802c5c:	89 e5                	mov    %esp,%ebp
+  802c5e:	53                   	push   %ebx
+  802c5f:	83 ec 1c             	sub    $0x1c,%esp
+  802c62:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802c65:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802c68:	50                   	push   %eax
+  802c69:	ff 75 08             	push   0x8(%ebp)
+  802c6c:	e8 4e e8 ff ff       	call   8014bf <fd_lookup>
+  802c71:	83 c4 10             	add    $0x10,%esp
+  802c74:	85 c0                	test   %eax,%eax
+  802c76:	78 49                	js     802cc1 <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  802c78:	83 ec 0c             	sub    $0xc,%esp
+  802c7b:	ff 75 f4             	push   -0xc(%ebp)
+  802c7e:	e8 d2 e7 ff ff       	call   801455 <fd2data>
+  802c83:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802c85:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c88:	83 c4 10             	add    $0x10,%esp
+  802c8b:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  802c91:	39 08                	cmp    %ecx,(%eax)
+  802c93:	75 31                	jne    802cc6 <pipe_splice_read+0x6b>
+  802c95:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  802c99:	74 32                	je     802ccd <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  802c9b:	8b 48 08             	mov    0x8(%eax),%ecx
+  802c9e:	83 e1 03             	and    $0x3,%ecx
+  802ca1:	83 f9 01             	cmp    $0x1,%ecx
+  802ca4:	74 2e                	je     802cd4 <pipe_splice_read+0x79>
+  802ca6:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  802cac:	75 2d                	jne    802cdb <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  802cae:	83 ec 08             	sub    $0x8,%esp
+  802cb1:	53                   	push   %ebx
+  802cb2:	68 00 10 00 00       	push   $0x1000
+  802cb7:	89 d9                	mov    %ebx,%ecx
+  802cb9:	e8 93 fa ff ff       	call   802751 <devpipe_read_bulk>
+  802cbe:	83 c4 10             	add    $0x10,%esp
+}
+  802cc1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802cc4:	c9                   	leave
+  802cc5:	c3                   	ret
+    return -E_INVAL;
+  802cc6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ccb:	eb f4                	jmp    802cc1 <pipe_splice_read+0x66>
+  802ccd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802cd2:	eb ed                	jmp    802cc1 <pipe_splice_read+0x66>
+  802cd4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802cd9:	eb e6                	jmp    802cc1 <pipe_splice_read+0x66>
+  802cdb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ce0:	eb df                	jmp    802cc1 <pipe_splice_read+0x66>
+
+00802ce2 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  802ce2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ce7:	c3                   	ret
+
+00802ce8 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802ce8:	55                   	push   %ebp
+  802ce9:	89 e5                	mov    %esp,%ebp
+  802ceb:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  802cee:	68 c7 37 80 00       	push   $0x8037c7
+  802cf3:	ff 75 0c             	push   0xc(%ebp)
+  802cf6:	e8 6c de ff ff       	call   800b67 <strcpy>
+  return 0;
+}
+  802cfb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d00:	c9                   	leave
+  802d01:	c3                   	ret
+
+00802d02 <devcons_write>:
+{
+  802d02:	55                   	push   %ebp
+  802d03:	89 e5                	mov    %esp,%ebp
+  802d05:	57                   	push   %edi
+  802d06:	56                   	push   %esi
+  802d07:	53                   	push   %ebx
+  802d08:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  802d0e:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  802d13:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  802d19:	eb 2e                	jmp    802d49 <devcons_write+0x47>
+    m = n - tot;
+  802d1b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802d1e:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  802d20:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802d25:	39 c3                	cmp    %eax,%ebx
+  802d27:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  802d2a:	83 ec 04             	sub    $0x4,%esp
+  802d2d:	53                   	push   %ebx
+  802d2e:	89 f0                	mov    %esi,%eax
+  802d30:	03 45 0c             	add    0xc(%ebp),%eax
+  802d33:	50                   	push   %eax
+  802d34:	57                   	push   %edi
+  802d35:	e8 b3 df ff ff       	call   800ced <memmove>
+    sys_cputs(buf, m);
+  802d3a:	83 c4 08             	add    $0x8,%esp
+  802d3d:	53                   	push   %ebx
+  802d3e:	57                   	push   %edi
+  802d3f:	e8 53 e1 ff ff       	call   800e97 <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  802d44:	01 de                	add    %ebx,%esi
+  802d46:	83 c4 10             	add    $0x10,%esp
+  802d49:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802d4c:	72 cd                	jb     802d1b <devcons_write+0x19>
+}
+  802d4e:	89 f0                	mov    %esi,%eax
+  802d50:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d53:	5b                   	pop    %ebx
+  802d54:	5e                   	pop    %esi
+  802d55:	5f                   	pop    %edi
+  802d56:	5d                   	pop    %ebp
+  802d57:	c3                   	ret
+
+00802d58 <devcons_read>:
+{
+  802d58:	55                   	push   %ebp
+  802d59:	89 e5                	mov    %esp,%ebp
+  802d5b:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  802d5e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d63:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802d67:	75 07                	jne    802d70 <devcons_read+0x18>
+  802d69:	eb 1f                	jmp    802d8a <devcons_read+0x32>
+    sys_yield();
+  802d6b:	e8 c4 e1 ff ff       	call   800f34 <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  802d70:	e8 40 e1 ff ff       	call   800eb5 <sys_cgetc>
+  802d75:	85 c0                	test   %eax,%eax
+  802d77:	74 f2                	je     802d6b <devcons_read+0x13>
+  if (c < 0)
+  802d79:	78 0f                	js     802d8a <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  802d7b:	83 f8 04             	cmp    $0x4,%eax
+  802d7e:	74 0c                	je     802d8c <devcons_read+0x34>
+  *(char*)vbuf = c;
+  802d80:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802d83:	88 02                	mov    %al,(%edx)
+  return 1;
+  802d85:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802d8a:	c9                   	leave
+  802d8b:	c3                   	ret
+    return 0;
+  802d8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d91:	eb f7                	jmp    802d8a <devcons_read+0x32>
+
+00802d93 <cputchar>:
+{
+  802d93:	55                   	push   %ebp
+  802d94:	89 e5                	mov    %esp,%ebp
+  802d96:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  802d99:	8b 45 08             	mov    0x8(%ebp),%eax
+  802d9c:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  802d9f:	6a 01                	push   $0x1
+  802da1:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802da4:	50                   	push   %eax
+  802da5:	e8 ed e0 ff ff       	call   800e97 <sys_cputs>
+}
+  802daa:	83 c4 10             	add    $0x10,%esp
+  802dad:	c9                   	leave
+  802dae:	c3                   	ret
+
+00802daf <getchar>:
+{
+  802daf:	55                   	push   %ebp
+  802db0:	89 e5                	mov    %esp,%ebp
+  802db2:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  802db5:	6a 01                	push   $0x1
+  802db7:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802dba:	50                   	push   %eax
+  802dbb:	6a 00                	push   $0x0
+  802dbd:	e8 a8 e9 ff ff       	call   80176a <read>
+  if (r < 0)
+  802dc2:	83 c4 10             	add    $0x10,%esp
+  802dc5:	85 c0                	test   %eax,%eax
+  802dc7:	78 06                	js     802dcf <getchar+0x20>
+  if (r < 1)
+  802dc9:	74 06                	je     802dd1 <getchar+0x22>
+  return c;
+  802dcb:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802dcf:	c9                   	leave
+  802dd0:	c3                   	ret
+    return -E_EOF;
+  802dd1:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802dd6:	eb f7                	jmp    802dcf <getchar+0x20>
+
+00802dd8 <iscons>:
+{
+  802dd8:	55                   	push   %ebp
+  802dd9:	89 e5                	mov    %esp,%ebp
+  802ddb:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802dde:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802de1:	50                   	push   %eax
+  802de2:	ff 75 08             	push   0x8(%ebp)
+  802de5:	e8 d5 e6 ff ff       	call   8014bf <fd_lookup>
+  802dea:	83 c4 10             	add    $0x10,%esp
+  802ded:	85 c0                	test   %eax,%eax
+  802def:	78 11                	js     802e02 <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  802df1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802df4:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802dfa:	39 10                	cmp    %edx,(%eax)
+  802dfc:	0f 94 c0             	sete   %al
+  802dff:	0f b6 c0             	movzbl %al,%eax
+}
+  802e02:	c9                   	leave
+  802e03:	c3                   	ret
+
+00802e04 <opencons>:
+{
+  802e04:	55                   	push   %ebp
+  802e05:	89 e5                	mov    %esp,%ebp
+  802e07:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  802e0a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802e0d:	50                   	push   %eax
+  802e0e:	e8 56 e6 ff ff       	call   801469 <fd_alloc>
+  802e13:	83 c4 10             	add    $0x10,%esp
+  802e16:	85 c0                	test   %eax,%eax
+  802e18:	78 3a                	js     802e54 <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802e1a:	83 ec 04             	sub    $0x4,%esp
+  802e1d:	68 07 04 00 00       	push   $0x407
+  802e22:	ff 75 f4             	push   -0xc(%ebp)
+  802e25:	6a 00                	push   $0x0
+  802e27:	e8 6a e1 ff ff       	call   800f96 <sys_page_alloc>
+  802e2c:	83 c4 10             	add    $0x10,%esp
+  802e2f:	85 c0                	test   %eax,%eax
+  802e31:	78 21                	js     802e54 <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  802e33:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802e36:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802e3c:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  802e3e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802e41:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  802e48:	83 ec 0c             	sub    $0xc,%esp
+  802e4b:	50                   	push   %eax
+  802e4c:	e8 f4 e5 ff ff       	call   801445 <fd2num>
+  802e51:	83 c4 10             	add    $0x10,%esp
+}
+  802e54:	c9                   	leave
+  802e55:	c3                   	ret
+
+00802e56 <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  802e56:	55                   	push   %ebp
+  802e57:	89 e5                	mov    %esp,%ebp
+  802e59:	57                   	push   %edi
+  802e5a:	56                   	push   %esi
+  802e5b:	53                   	push   %ebx
+  802e5c:	83 ec 14             	sub    $0x14,%esp
+  802e5f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802e62:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e65:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802e68:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  802e6b:	85 c0                	test   %eax,%eax
+  802e6d:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802e72:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  802e75:	ff 33                	push   (%ebx)
+  802e77:	50                   	push   %eax
+  802e78:	e8 f1 e3 ff ff       	call   80126e <sys_ipc_recv>
+  802e7d:	83 c4 10             	add    $0x10,%esp
+  802e80:	85 c0                	test   %eax,%eax
+  802e82:	78 39                	js     802ebd <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  802e84:	85 ff                	test   %edi,%edi
+  802e86:	74 0a                	je     802e92 <ipc_recv_pages+0x3c>
+  802e88:	a1 64 6b 80 00       	mov    0x806b64,%eax
+  802e8d:	8b 40 7c             	mov    0x7c(%eax),%eax
+  802e90:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  802e92:	85 f6                	test   %esi,%esi
+  802e94:	74 0d                	je     802ea3 <ipc_recv_pages+0x4d>
+  802e96:	a1 64 6b 80 00       	mov    0x806b64,%eax
+  802e9b:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  802ea1:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  802ea3:	a1 64 6b 80 00       	mov    0x806b64,%eax
+  802ea8:	8b 40 74             	mov    0x74(%eax),%eax
+  802eab:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  802ead:	a1 64 6b 80 00       	mov    0x806b64,%eax
+  802eb2:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  802eb5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802eb8:	5b                   	pop    %ebx
+  802eb9:	5e                   	pop    %esi
+  802eba:	5f                   	pop    %edi
+  802ebb:	5d                   	pop    %ebp
+  802ebc:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  802ebd:	85 ff                	test   %edi,%edi
+  802ebf:	74 06                	je     802ec7 <ipc_recv_pages+0x71>
+  802ec1:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  802ec7:	85 f6                	test   %esi,%esi
+  802ec9:	74 06                	je     802ed1 <ipc_recv_pages+0x7b>
+  802ecb:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  802ed1:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  802ed7:	eb dc                	jmp    802eb5 <ipc_recv_pages+0x5f>
+
+00802ed9 <ipc_recv>:
+{
+  802ed9:	55                   	push   %ebp
+  802eda:	89 e5                	mov    %esp,%ebp
+  802edc:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  802edf:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  802ee6:	ff 75 10             	push   0x10(%ebp)
+  802ee9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802eec:	50                   	push   %eax
+  802eed:	ff 75 0c             	push   0xc(%ebp)
+  802ef0:	ff 75 08             	push   0x8(%ebp)
+  802ef3:	e8 5e ff ff ff       	call   802e56 <ipc_recv_pages>
+}
+  802ef8:	c9                   	leave
+  802ef9:	c3                   	ret
+
+00802efa <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  802efa:	55                   	push   %ebp
+  802efb:	89 e5                	mov    %esp,%ebp
+  802efd:	57                   	push   %edi
+  802efe:	56                   	push   %esi
+  802eff:	53                   	push   %ebx
+  802f00:	83 ec 0c             	sub    $0xc,%esp
+  802f03:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802f06:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802f09:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  802f0c:	89 c3                	mov    %eax,%ebx
+  802f0e:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  802f14:	85 c0                	test   %eax,%eax
+  802f16:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802f1b:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  802f1e:	83 ec 0c             	sub    $0xc,%esp
+  802f21:	ff 75 14             	push   0x14(%ebp)
+  802f24:	ff 75 18             	push   0x18(%ebp)
+  802f27:	53                   	push   %ebx
+  802f28:	56                   	push   %esi
+  802f29:	57                   	push   %edi
+  802f2a:	e8 1e e3 ff ff       	call   80124d <sys_ipc_try_send>
+  802f2f:	83 c4 20             	add    $0x20,%esp
+  802f32:	85 c0                	test   %eax,%eax
+  802f34:	79 1e                	jns    802f54 <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  802f36:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802f39:	75 07                	jne    802f42 <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  802f3b:	e8 f4 df ff ff       	call   800f34 <sys_yield>
+  802f40:	eb dc                	jmp    802f1e <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  802f42:	50                   	push   %eax
+  802f43:	68 d3 37 80 00       	push   $0x8037d3
+  802f48:	6a 5c                	push   $0x5c
+  802f4a:	68 e0 37 80 00       	push   $0x8037e0
+  802f4f:	e8 4a d5 ff ff       	call   80049e <_panic>
+  }
+}
+  802f54:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f57:	5b                   	pop    %ebx
+  802f58:	5e                   	pop    %esi
+  802f59:	5f                   	pop    %edi
+  802f5a:	5d                   	pop    %ebp
+  802f5b:	c3                   	ret
+
+00802f5c <ipc_send>:
+{
+  802f5c:	55                   	push   %ebp
+  802f5d:	89 e5                	mov    %esp,%ebp
+  802f5f:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  802f62:	ff 75 14             	push   0x14(%ebp)
+  802f65:	6a 01                	push   $0x1
+  802f67:	ff 75 10             	push   0x10(%ebp)
+  802f6a:	ff 75 0c             	push   0xc(%ebp)
+  802f6d:	ff 75 08             	push   0x8(%ebp)
+  802f70:	e8 85 ff ff ff       	call   802efa <ipc_send_pages>
+}
+  802f75:	83 c4 20             	add    $0x20,%esp
+  802f78:	c9                   	leave
+  802f79:	c3                   	ret
+
+00802f7a <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802f7a:	55                   	push   %ebp
+  802f7b:	89 e5                	mov    %esp,%ebp
+  802f7d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  802f80:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  802f85:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802f88:	c1 e0 04             	shl    $0x4,%eax
+  802f8b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802f90:	8b 40 50             	mov    0x50(%eax),%eax
+  802f93:	39 c8                	cmp    %ecx,%eax
+  802f95:	74 12                	je     802fa9 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  802f97:	83 c2 01             	add    $0x1,%edx
+  802f9a:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802fa0:	75 e3                	jne    802f85 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  802fa2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fa7:	eb 0e                	jmp    802fb7 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  802fa9:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802fac:	c1 e0 04             	shl    $0x4,%eax
+  802faf:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802fb4:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802fb7:	5d                   	pop    %ebp
+  802fb8:	c3                   	ret
+
+00802fb9 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802fb9:	55                   	push   %ebp
+  802fba:	89 e5                	mov    %esp,%ebp
+  802fbc:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802fbf:	89 c2                	mov    %eax,%edx
+  802fc1:	c1 ea 16             	shr    $0x16,%edx
+  802fc4:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  802fcb:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802fd0:	f6 c1 01             	test   $0x1,%cl
+  802fd3:	74 1c                	je     802ff1 <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  802fd5:	c1 e8 0c             	shr    $0xc,%eax
+  802fd8:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  802fdf:	a8 01                	test   $0x1,%al
+  802fe1:	74 0e                	je     802ff1 <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  802fe3:	c1 e8 0c             	shr    $0xc,%eax
+  802fe6:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802fed:	ef 
+  802fee:	0f b7 d2             	movzwl %dx,%edx
+}
+  802ff1:	89 d0                	mov    %edx,%eax
+  802ff3:	5d                   	pop    %ebp
+  802ff4:	c3                   	ret
+
+00802ff5 <udivmod>:
+  802ff5:	55                   	push   %ebp
+  802ff6:	57                   	push   %edi
+  802ff7:	56                   	push   %esi
+  802ff8:	53                   	push   %ebx
+  802ff9:	83 ec 14             	sub    $0x14,%esp
+  802ffc:	8b 74 24 28          	mov    0x28(%esp),%esi
+  803000:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  803004:	89 fb                	mov    %edi,%ebx
+  803006:	09 f3                	or     %esi,%ebx
+  803008:	0f 84 88 00 00 00    	je     803096 <udivmod+0xa1>
+  80300e:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803013:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  80301a:	00 
+  80301b:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  803022:	00 
+  803023:	89 cd                	mov    %ecx,%ebp
+  803025:	89 34 24             	mov    %esi,(%esp)
+  803028:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  80302c:	eb 08                	jmp    803036 <udivmod+0x41>
+  80302e:	83 ed 01             	sub    $0x1,%ebp
+  803031:	83 fd ff             	cmp    $0xffffffff,%ebp
+  803034:	74 6c                	je     8030a2 <udivmod+0xad>
+  803036:	89 c3                	mov    %eax,%ebx
+  803038:	89 d6                	mov    %edx,%esi
+  80303a:	89 e9                	mov    %ebp,%ecx
+  80303c:	0f ad f3             	shrd   %cl,%esi,%ebx
+  80303f:	d3 ee                	shr    %cl,%esi
+  803041:	f6 c1 20             	test   $0x20,%cl
+  803044:	74 04                	je     80304a <udivmod+0x55>
+  803046:	89 f3                	mov    %esi,%ebx
+  803048:	31 f6                	xor    %esi,%esi
+  80304a:	8b 3c 24             	mov    (%esp),%edi
+  80304d:	39 fb                	cmp    %edi,%ebx
+  80304f:	89 f7                	mov    %esi,%edi
+  803051:	8b 1c 24             	mov    (%esp),%ebx
+  803054:	8b 74 24 04          	mov    0x4(%esp),%esi
+  803058:	19 f7                	sbb    %esi,%edi
+  80305a:	72 d2                	jb     80302e <udivmod+0x39>
+  80305c:	89 f7                	mov    %esi,%edi
+  80305e:	89 de                	mov    %ebx,%esi
+  803060:	89 e9                	mov    %ebp,%ecx
+  803062:	0f a5 f7             	shld   %cl,%esi,%edi
+  803065:	d3 e6                	shl    %cl,%esi
+  803067:	f6 c1 20             	test   $0x20,%cl
+  80306a:	74 04                	je     803070 <udivmod+0x7b>
+  80306c:	89 f7                	mov    %esi,%edi
+  80306e:	31 f6                	xor    %esi,%esi
+  803070:	29 f0                	sub    %esi,%eax
+  803072:	19 fa                	sbb    %edi,%edx
+  803074:	be 01 00 00 00       	mov    $0x1,%esi
+  803079:	bf 00 00 00 00       	mov    $0x0,%edi
+  80307e:	0f a5 f7             	shld   %cl,%esi,%edi
+  803081:	d3 e6                	shl    %cl,%esi
+  803083:	f6 c1 20             	test   $0x20,%cl
+  803086:	74 04                	je     80308c <udivmod+0x97>
+  803088:	89 f7                	mov    %esi,%edi
+  80308a:	31 f6                	xor    %esi,%esi
+  80308c:	09 74 24 08          	or     %esi,0x8(%esp)
+  803090:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  803094:	eb 98                	jmp    80302e <udivmod+0x39>
+  803096:	89 f0                	mov    %esi,%eax
+  803098:	89 fa                	mov    %edi,%edx
+  80309a:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80309e:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  8030a2:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  8030a6:	89 01                	mov    %eax,(%ecx)
+  8030a8:	89 51 04             	mov    %edx,0x4(%ecx)
+  8030ab:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8030af:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8030b3:	83 c4 14             	add    $0x14,%esp
+  8030b6:	5b                   	pop    %ebx
+  8030b7:	5e                   	pop    %esi
+  8030b8:	5f                   	pop    %edi
+  8030b9:	5d                   	pop    %ebp
+  8030ba:	c3                   	ret
+
+008030bb <__udivdi3>:
+  8030bb:	83 ec 18             	sub    $0x18,%esp
+  8030be:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8030c2:	50                   	push   %eax
+  8030c3:	ff 74 24 2c          	push   0x2c(%esp)
+  8030c7:	ff 74 24 2c          	push   0x2c(%esp)
+  8030cb:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8030cf:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8030d3:	e8 1d ff ff ff       	call   802ff5 <udivmod>
+  8030d8:	83 c4 24             	add    $0x24,%esp
+  8030db:	c3                   	ret
+
+008030dc <__umoddi3>:
+  8030dc:	83 ec 18             	sub    $0x18,%esp
+  8030df:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8030e3:	50                   	push   %eax
+  8030e4:	ff 74 24 2c          	push   0x2c(%esp)
+  8030e8:	ff 74 24 2c          	push   0x2c(%esp)
+  8030ec:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8030f0:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8030f4:	e8 fc fe ff ff       	call   802ff5 <udivmod>
+  8030f9:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8030fd:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803101:	83 c4 24             	add    $0x24,%esp
+  803104:	c3                   	ret
+
+00803105 <__divdi3>:
+  803105:	56                   	push   %esi
+  803106:	53                   	push   %ebx
+  803107:	83 ec 14             	sub    $0x14,%esp
+  80310a:	8b 44 24 20          	mov    0x20(%esp),%eax
+  80310e:	8b 54 24 24          	mov    0x24(%esp),%edx
+  803112:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  803116:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  80311a:	85 d2                	test   %edx,%edx
+  80311c:	78 18                	js     803136 <__divdi3+0x31>
+  80311e:	85 db                	test   %ebx,%ebx
+  803120:	78 3e                	js     803160 <__divdi3+0x5b>
+  803122:	83 ec 04             	sub    $0x4,%esp
+  803125:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803129:	56                   	push   %esi
+  80312a:	53                   	push   %ebx
+  80312b:	51                   	push   %ecx
+  80312c:	e8 c4 fe ff ff       	call   802ff5 <udivmod>
+  803131:	83 c4 10             	add    $0x10,%esp
+  803134:	eb 24                	jmp    80315a <__divdi3+0x55>
+  803136:	f7 d8                	neg    %eax
+  803138:	83 d2 00             	adc    $0x0,%edx
+  80313b:	f7 da                	neg    %edx
+  80313d:	85 db                	test   %ebx,%ebx
+  80313f:	78 3a                	js     80317b <__divdi3+0x76>
+  803141:	83 ec 04             	sub    $0x4,%esp
+  803144:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803148:	56                   	push   %esi
+  803149:	53                   	push   %ebx
+  80314a:	51                   	push   %ecx
+  80314b:	e8 a5 fe ff ff       	call   802ff5 <udivmod>
+  803150:	83 c4 10             	add    $0x10,%esp
+  803153:	f7 d8                	neg    %eax
+  803155:	83 d2 00             	adc    $0x0,%edx
+  803158:	f7 da                	neg    %edx
+  80315a:	83 c4 14             	add    $0x14,%esp
+  80315d:	5b                   	pop    %ebx
+  80315e:	5e                   	pop    %esi
+  80315f:	c3                   	ret
+  803160:	83 ec 04             	sub    $0x4,%esp
+  803163:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803167:	56                   	push   %esi
+  803168:	f7 d9                	neg    %ecx
+  80316a:	83 d3 00             	adc    $0x0,%ebx
+  80316d:	f7 db                	neg    %ebx
+  80316f:	53                   	push   %ebx
+  803170:	51                   	push   %ecx
+  803171:	e8 7f fe ff ff       	call   802ff5 <udivmod>
+  803176:	83 c4 10             	add    $0x10,%esp
+  803179:	eb d8                	jmp    803153 <__divdi3+0x4e>
+  80317b:	83 ec 04             	sub    $0x4,%esp
+  80317e:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803182:	56                   	push   %esi
+  803183:	f7 d9                	neg    %ecx
+  803185:	83 d3 00             	adc    $0x0,%ebx
+  803188:	f7 db                	neg    %ebx
+  80318a:	53                   	push   %ebx
+  80318b:	51                   	push   %ecx
+  80318c:	e8 64 fe ff ff       	call   802ff5 <udivmod>
+  803191:	83 c4 10             	add    $0x10,%esp
+  803194:	eb c4                	jmp    80315a <__divdi3+0x55>
+
+00803196 <__moddi3>:
+  803196:	55                   	push   %ebp
+  803197:	57                   	push   %edi
+  803198:	56                   	push   %esi
+  803199:	53                   	push   %ebx
+  80319a:	83 ec 24             	sub    $0x24,%esp
+  80319d:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8031a1:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8031a5:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  8031a9:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  8031ad:	85 d2                	test   %edx,%edx
+  8031af:	78 3b                	js     8031ec <__moddi3+0x56>
+  8031b1:	83 ec 04             	sub    $0x4,%esp
+  8031b4:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8031b8:	56                   	push   %esi
+  8031b9:	89 ce                	mov    %ecx,%esi
+  8031bb:	f7 de                	neg    %esi
+  8031bd:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8031c1:	89 de                	mov    %ebx,%esi
+  8031c3:	83 d6 00             	adc    $0x0,%esi
+  8031c6:	f7 de                	neg    %esi
+  8031c8:	89 74 24 14          	mov    %esi,0x14(%esp)
+  8031cc:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8031d0:	0f 48 f1             	cmovs  %ecx,%esi
+  8031d3:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  8031d8:	53                   	push   %ebx
+  8031d9:	56                   	push   %esi
+  8031da:	e8 16 fe ff ff       	call   802ff5 <udivmod>
+  8031df:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8031e3:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8031e7:	83 c4 10             	add    $0x10,%esp
+  8031ea:	eb 47                	jmp    803233 <__moddi3+0x9d>
+  8031ec:	f7 d8                	neg    %eax
+  8031ee:	83 d2 00             	adc    $0x0,%edx
+  8031f1:	f7 da                	neg    %edx
+  8031f3:	83 ec 04             	sub    $0x4,%esp
+  8031f6:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8031fa:	56                   	push   %esi
+  8031fb:	89 cf                	mov    %ecx,%edi
+  8031fd:	f7 df                	neg    %edi
+  8031ff:	89 de                	mov    %ebx,%esi
+  803201:	83 d6 00             	adc    $0x0,%esi
+  803204:	f7 de                	neg    %esi
+  803206:	0f 49 cf             	cmovns %edi,%ecx
+  803209:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  80320d:	0f 49 de             	cmovns %esi,%ebx
+  803210:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  803214:	ff 74 24 0c          	push   0xc(%esp)
+  803218:	ff 74 24 0c          	push   0xc(%esp)
+  80321c:	e8 d4 fd ff ff       	call   802ff5 <udivmod>
+  803221:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803225:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803229:	f7 d8                	neg    %eax
+  80322b:	83 d2 00             	adc    $0x0,%edx
+  80322e:	f7 da                	neg    %edx
+  803230:	83 c4 10             	add    $0x10,%esp
+  803233:	83 c4 24             	add    $0x24,%esp
+  803236:	5b                   	pop    %ebx
+  803237:	5e                   	pop    %esi
+  803238:	5f                   	pop    %edi
+  803239:	5d                   	pop    %ebp
+  80323a:	c3                   	ret
@@ -0,0 +1,6685 @@
+
+obj/user/readbench.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 01 03 00 00       	call   800332 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <readfile>:
+
+// Read 'path' cold, a block at a time, forwards or backwards; return
+// the elapsed ms.
+static unsigned
+readfile(const char *path, off_t size, bool backward)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 2c             	sub    $0x2c,%esp
+  80003c:	89 c3                	mov    %eax,%ebx
+  80003e:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800041:	88 4d db             	mov    %cl,-0x25(%ebp)
+  unsigned start;
+  int fd, r;
+  off_t off, nblocks, i;
+
+  if ((r = fs_dropcache()) < 0)
+  800044:	e8 98 21 00 00       	call   8021e1 <fs_dropcache>
+  800049:	85 c0                	test   %eax,%eax
+  80004b:	0f 88 9b 00 00 00    	js     8000ec <readfile+0xb9>
+    panic("fs_dropcache: %e", r);
+  start = sys_time_msec();
+  800051:	e8 5b 11 00 00       	call   8011b1 <sys_time_msec>
+  800056:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  if ((fd = open(path, O_RDONLY)) < 0)
+  800059:	83 ec 08             	sub    $0x8,%esp
+  80005c:	6a 00                	push   $0x0
+  80005e:	53                   	push   %ebx
+  80005f:	e8 32 1e 00 00       	call   801e96 <open>
+  800064:	89 c1                	mov    %eax,%ecx
+  800066:	83 c4 10             	add    $0x10,%esp
+  800069:	85 c0                	test   %eax,%eax
+  80006b:	0f 88 8d 00 00 00    	js     8000fe <readfile+0xcb>
+    panic("open %s: %e", path, fd);
+  nblocks = ROUNDUP(size, BLKSIZE) / BLKSIZE;
+  800071:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  800074:	05 ff 0f 00 00       	add    $0xfff,%eax
+  800079:	c1 f8 0c             	sar    $0xc,%eax
+  80007c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < nblocks; i++) {
+  80007f:	8d 78 ff             	lea    -0x1(%eax),%edi
+  800082:	c1 e7 0c             	shl    $0xc,%edi
+  800085:	be 00 00 00 00       	mov    $0x0,%esi
+  80008a:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+  80008d:	89 5d d0             	mov    %ebx,-0x30(%ebp)
+  800090:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800093:	39 c6                	cmp    %eax,%esi
+  800095:	0f 8d ab 00 00 00    	jge    800146 <readfile+0x113>
+    off = (backward ? nblocks - 1 - i : i) * BLKSIZE;
+  80009b:	89 f3                	mov    %esi,%ebx
+  80009d:	c1 e3 0c             	shl    $0xc,%ebx
+  8000a0:	80 7d db 00          	cmpb   $0x0,-0x25(%ebp)
+  8000a4:	0f 45 df             	cmovne %edi,%ebx
+    if ((r = seek(fd, off)) < 0)
+  8000a7:	83 ec 08             	sub    $0x8,%esp
+  8000aa:	53                   	push   %ebx
+  8000ab:	ff 75 e4             	push   -0x1c(%ebp)
+  8000ae:	e8 08 17 00 00       	call   8017bb <seek>
+  8000b3:	83 c4 10             	add    $0x10,%esp
+  8000b6:	85 c0                	test   %eax,%eax
+  8000b8:	78 5a                	js     800114 <readfile+0xe1>
+      panic("seek %s: %e", path, r);
+    if ((r = readn(fd, buf, MIN(BLKSIZE, size - off))) < 0)
+  8000ba:	83 ec 04             	sub    $0x4,%esp
+  8000bd:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8000c0:	29 d8                	sub    %ebx,%eax
+  8000c2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8000c7:	39 d0                	cmp    %edx,%eax
+  8000c9:	0f 4f c2             	cmovg  %edx,%eax
+  8000cc:	50                   	push   %eax
+  8000cd:	68 00 50 80 00       	push   $0x805000
+  8000d2:	ff 75 e4             	push   -0x1c(%ebp)
+  8000d5:	e8 18 16 00 00       	call   8016f2 <readn>
+  8000da:	81 ef 00 10 00 00    	sub    $0x1000,%edi
+  8000e0:	83 c4 10             	add    $0x10,%esp
+  8000e3:	85 c0                	test   %eax,%eax
+  8000e5:	78 46                	js     80012d <readfile+0xfa>
+  for (i = 0; i < nblocks; i++) {
+  8000e7:	83 c6 01             	add    $0x1,%esi
+  8000ea:	eb a4                	jmp    800090 <readfile+0x5d>
+    panic("fs_dropcache: %e", r);
+  8000ec:	50                   	push   %eax
+  8000ed:	68 40 31 80 00       	push   $0x803140
+  8000f2:	6a 17                	push   $0x17
+  8000f4:	68 51 31 80 00       	push   $0x803151
+  8000f9:	e8 a1 02 00 00       	call   80039f <_panic>
+    panic("open %s: %e", path, fd);
+  8000fe:	83 ec 0c             	sub    $0xc,%esp
+  800101:	50                   	push   %eax
+  800102:	53                   	push   %ebx
+  800103:	68 62 31 80 00       	push   $0x803162
+  800108:	6a 1a                	push   $0x1a
+  80010a:	68 51 31 80 00       	push   $0x803151
+  80010f:	e8 8b 02 00 00       	call   80039f <_panic>
+      panic("seek %s: %e", path, r);
+  800114:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  800117:	83 ec 0c             	sub    $0xc,%esp
+  80011a:	50                   	push   %eax
+  80011b:	53                   	push   %ebx
+  80011c:	68 6e 31 80 00       	push   $0x80316e
+  800121:	6a 1f                	push   $0x1f
+  800123:	68 51 31 80 00       	push   $0x803151
+  800128:	e8 72 02 00 00       	call   80039f <_panic>
+      panic("read %s: %e", path, r);
+  80012d:	8b 5d d0             	mov    -0x30(%ebp),%ebx
+  800130:	83 ec 0c             	sub    $0xc,%esp
+  800133:	50                   	push   %eax
+  800134:	53                   	push   %ebx
+  800135:	68 7a 31 80 00       	push   $0x80317a
+  80013a:	6a 21                	push   $0x21
+  80013c:	68 51 31 80 00       	push   $0x803151
+  800141:	e8 59 02 00 00       	call   80039f <_panic>
+  }
+  close(fd);
+  800146:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800149:	83 ec 0c             	sub    $0xc,%esp
+  80014c:	51                   	push   %ecx
+  80014d:	e8 91 13 00 00       	call   8014e3 <close>
+  return sys_time_msec() - start;
+  800152:	e8 5a 10 00 00       	call   8011b1 <sys_time_msec>
+  800157:	8b 4d d4             	mov    -0x2c(%ebp),%ecx
+  80015a:	29 c8                	sub    %ecx,%eax
+}
+  80015c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80015f:	5b                   	pop    %ebx
+  800160:	5e                   	pop    %esi
+  800161:	5f                   	pop    %edi
+  800162:	5d                   	pop    %ebp
+  800163:	c3                   	ret
+
+00800164 <run>:
+
+static void
+run(const char *path, off_t size)
+{
+  800164:	55                   	push   %ebp
+  800165:	89 e5                	mov    %esp,%ebp
+  800167:	57                   	push   %edi
+  800168:	56                   	push   %esi
+  800169:	53                   	push   %ebx
+  80016a:	83 ec 1c             	sub    $0x1c,%esp
+  80016d:	89 c6                	mov    %eax,%esi
+  80016f:	89 d7                	mov    %edx,%edi
+  unsigned fwd, bwd;
+
+  fwd = readfile(path, size, 0);
+  800171:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800176:	e8 b8 fe ff ff       	call   800033 <readfile>
+  80017b:	89 c3                	mov    %eax,%ebx
+  bwd = readfile(path, size, 1);
+  80017d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800182:	89 fa                	mov    %edi,%edx
+  800184:	89 75 e0             	mov    %esi,-0x20(%ebp)
+  800187:	89 f0                	mov    %esi,%eax
+  800189:	e8 a5 fe ff ff       	call   800033 <readfile>
+  80018e:	89 c6                	mov    %eax,%esi
+  cprintf("readbench: %-16s %6d KB  sequential %5d ms = %6d KB/s  "
+          "reverse %5d ms = %6d KB/s\n", path, size / 1024,
+          fwd, size / 1024 * 1000 / MAX(fwd, 1),
+          bwd, size / 1024 * 1000 / MAX(bwd, 1));
+  800190:	8d 87 ff 03 00 00    	lea    0x3ff(%edi),%eax
+  800196:	85 ff                	test   %edi,%edi
+  800198:	0f 49 c7             	cmovns %edi,%eax
+  80019b:	89 c1                	mov    %eax,%ecx
+  80019d:	c1 f9 0a             	sar    $0xa,%ecx
+  8001a0:	69 c1 e8 03 00 00    	imul   $0x3e8,%ecx,%eax
+  cprintf("readbench: %-16s %6d KB  sequential %5d ms = %6d KB/s  "
+  8001a6:	83 ec 04             	sub    $0x4,%esp
+          bwd, size / 1024 * 1000 / MAX(bwd, 1));
+  8001a9:	85 f6                	test   %esi,%esi
+  8001ab:	bf 01 00 00 00       	mov    $0x1,%edi
+  8001b0:	0f 45 fe             	cmovne %esi,%edi
+  cprintf("readbench: %-16s %6d KB  sequential %5d ms = %6d KB/s  "
+  8001b3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8001b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001bb:	f7 f7                	div    %edi
+  8001bd:	50                   	push   %eax
+  8001be:	56                   	push   %esi
+          fwd, size / 1024 * 1000 / MAX(fwd, 1),
+  8001bf:	85 db                	test   %ebx,%ebx
+  8001c1:	be 01 00 00 00       	mov    $0x1,%esi
+  8001c6:	0f 45 f3             	cmovne %ebx,%esi
+  cprintf("readbench: %-16s %6d KB  sequential %5d ms = %6d KB/s  "
+  8001c9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8001cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001d1:	f7 f6                	div    %esi
+  8001d3:	50                   	push   %eax
+  8001d4:	53                   	push   %ebx
+  8001d5:	51                   	push   %ecx
+  8001d6:	ff 75 e0             	push   -0x20(%ebp)
+  8001d9:	68 c4 31 80 00       	push   $0x8031c4
+  8001de:	e8 97 02 00 00       	call   80047a <cprintf>
+}
+  8001e3:	83 c4 20             	add    $0x20,%esp
+  8001e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001e9:	5b                   	pop    %ebx
+  8001ea:	5e                   	pop    %esi
+  8001eb:	5f                   	pop    %edi
+  8001ec:	5d                   	pop    %ebp
+  8001ed:	c3                   	ret
+
+008001ee <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8001ee:	55                   	push   %ebp
+  8001ef:	89 e5                	mov    %esp,%ebp
+  8001f1:	57                   	push   %edi
+  8001f2:	56                   	push   %esi
+  8001f3:	53                   	push   %ebx
+  8001f4:	81 ec 9c 00 00 00    	sub    $0x9c,%esp
+  struct Stat st;
+  off_t size, off;
+  int fd, r;
+
+  binaryname = "readbench";
+  8001fa:	c7 05 00 40 80 00 86 	movl   $0x803186,0x804000
+  800201:	31 80 00 
+  size = 1024 * 1024;
+  800204:	bf 00 00 10 00       	mov    $0x100000,%edi
+  if (argc > 1)
+  800209:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+  80020d:	7f 75                	jg     800284 <umain+0x96>
+    size = strtol(argv[1], 0, 0) * 1024;
+
+  if ((r = stat("/lorem", &st)) < 0)
+  80020f:	83 ec 08             	sub    $0x8,%esp
+  800212:	8d 85 5c ff ff ff    	lea    -0xa4(%ebp),%eax
+  800218:	50                   	push   %eax
+  800219:	68 90 31 80 00       	push   $0x803190
+  80021e:	e8 b5 16 00 00       	call   8018d8 <stat>
+  800223:	83 c4 10             	add    $0x10,%esp
+  800226:	85 c0                	test   %eax,%eax
+  800228:	78 79                	js     8002a3 <umain+0xb5>
+    panic("stat /lorem: %e", r);
+  run("/lorem", st.st_size);
+  80022a:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  80022d:	b8 90 31 80 00       	mov    $0x803190,%eax
+  800232:	e8 2d ff ff ff       	call   800164 <run>
+
+  if ((fd = open(BIGNAME, O_RDWR | O_CREAT | O_TRUNC)) < 0)
+  800237:	83 ec 08             	sub    $0x8,%esp
+  80023a:	68 02 03 00 00       	push   $0x302
+  80023f:	68 a7 31 80 00       	push   $0x8031a7
+  800244:	e8 4d 1c 00 00       	call   801e96 <open>
+  800249:	89 c6                	mov    %eax,%esi
+  80024b:	83 c4 10             	add    $0x10,%esp
+  80024e:	85 c0                	test   %eax,%eax
+  800250:	78 63                	js     8002b5 <umain+0xc7>
+    panic("open %s: %e", BIGNAME, fd);
+  for (off = 0; off < size; off += BLKSIZE)
+  800252:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800257:	39 df                	cmp    %ebx,%edi
+  800259:	0f 8e 8a 00 00 00    	jle    8002e9 <umain+0xfb>
+    if ((r = write(fd, buf, BLKSIZE)) != BLKSIZE)
+  80025f:	83 ec 04             	sub    $0x4,%esp
+  800262:	68 00 10 00 00       	push   $0x1000
+  800267:	68 00 50 80 00       	push   $0x805000
+  80026c:	56                   	push   %esi
+  80026d:	e8 c7 14 00 00       	call   801739 <write>
+  800272:	83 c4 10             	add    $0x10,%esp
+  800275:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80027a:	75 53                	jne    8002cf <umain+0xe1>
+  for (off = 0; off < size; off += BLKSIZE)
+  80027c:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  800282:	eb d3                	jmp    800257 <umain+0x69>
+    size = strtol(argv[1], 0, 0) * 1024;
+  800284:	83 ec 04             	sub    $0x4,%esp
+  800287:	6a 00                	push   $0x0
+  800289:	6a 00                	push   $0x0
+  80028b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80028e:	ff 70 04             	push   0x4(%eax)
+  800291:	e8 26 0a 00 00       	call   800cbc <strtol>
+  800296:	c1 e0 0a             	shl    $0xa,%eax
+  800299:	89 c7                	mov    %eax,%edi
+  80029b:	83 c4 10             	add    $0x10,%esp
+  80029e:	e9 6c ff ff ff       	jmp    80020f <umain+0x21>
+    panic("stat /lorem: %e", r);
+  8002a3:	50                   	push   %eax
+  8002a4:	68 97 31 80 00       	push   $0x803197
+  8002a9:	6a 41                	push   $0x41
+  8002ab:	68 51 31 80 00       	push   $0x803151
+  8002b0:	e8 ea 00 00 00       	call   80039f <_panic>
+    panic("open %s: %e", BIGNAME, fd);
+  8002b5:	83 ec 0c             	sub    $0xc,%esp
+  8002b8:	50                   	push   %eax
+  8002b9:	68 a7 31 80 00       	push   $0x8031a7
+  8002be:	68 62 31 80 00       	push   $0x803162
+  8002c3:	6a 45                	push   $0x45
+  8002c5:	68 51 31 80 00       	push   $0x803151
+  8002ca:	e8 d0 00 00 00       	call   80039f <_panic>
+      panic("write %s: %e", BIGNAME, r);
+  8002cf:	83 ec 0c             	sub    $0xc,%esp
+  8002d2:	50                   	push   %eax
+  8002d3:	68 a7 31 80 00       	push   $0x8031a7
+  8002d8:	68 b6 31 80 00       	push   $0x8031b6
+  8002dd:	6a 48                	push   $0x48
+  8002df:	68 51 31 80 00       	push   $0x803151
+  8002e4:	e8 b6 00 00 00       	call   80039f <_panic>
+  close(fd);
+  8002e9:	83 ec 0c             	sub    $0xc,%esp
+  8002ec:	56                   	push   %esi
+  8002ed:	e8 f1 11 00 00       	call   8014e3 <close>
+  sync();
+  8002f2:	e8 87 1e 00 00       	call   80217e <sync>
+
+  run(BIGNAME, size);
+  8002f7:	89 fa                	mov    %edi,%edx
+  8002f9:	b8 a7 31 80 00       	mov    $0x8031a7,%eax
+  8002fe:	e8 61 fe ff ff       	call   800164 <run>
+
+  // Give the space back (there is no remove).
+  if ((fd = open(BIGNAME, O_RDWR | O_TRUNC)) >= 0)
+  800303:	83 c4 08             	add    $0x8,%esp
+  800306:	68 02 02 00 00       	push   $0x202
+  80030b:	68 a7 31 80 00       	push   $0x8031a7
+  800310:	e8 81 1b 00 00       	call   801e96 <open>
+  800315:	83 c4 10             	add    $0x10,%esp
+  800318:	85 c0                	test   %eax,%eax
+  80031a:	79 08                	jns    800324 <umain+0x136>
+    close(fd);
+}
+  80031c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80031f:	5b                   	pop    %ebx
+  800320:	5e                   	pop    %esi
+  800321:	5f                   	pop    %edi
+  800322:	5d                   	pop    %ebp
+  800323:	c3                   	ret
+    close(fd);
+  800324:	83 ec 0c             	sub    $0xc,%esp
+  800327:	50                   	push   %eax
+  800328:	e8 b6 11 00 00       	call   8014e3 <close>
+  80032d:	83 c4 10             	add    $0x10,%esp
+}
+  800330:	eb ea                	jmp    80031c <umain+0x12e>
+
+00800332 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800332:	55                   	push   %ebp
+  800333:	89 e5                	mov    %esp,%ebp
+  800335:	56                   	push   %esi
+  800336:	53                   	push   %ebx
+  800337:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80033a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  80033d:	c7 05 44 67 80 00 00 	movl   $0x0,0x806744
+  800344:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  800347:	e8 ca 0a 00 00       	call   800e16 <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  80034c:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800351:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800354:	c1 e0 04             	shl    $0x4,%eax
+  800357:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80035c:	a3 44 67 80 00       	mov    %eax,0x806744
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800361:	85 db                	test   %ebx,%ebx
+  800363:	7e 07                	jle    80036c <libmain+0x3a>
+    binaryname = argv[0];
+  800365:	8b 06                	mov    (%esi),%eax
+  800367:	a3 00 40 80 00       	mov    %eax,0x804000
+
+  // call user main routine
+  umain(argc, argv);
+  80036c:	83 ec 08             	sub    $0x8,%esp
+  80036f:	56                   	push   %esi
+  800370:	53                   	push   %ebx
+  800371:	e8 78 fe ff ff       	call   8001ee <umain>
+
+  // exit gracefully
+  exit();
+  800376:	e8 0a 00 00 00       	call   800385 <exit>
+}
+  80037b:	83 c4 10             	add    $0x10,%esp
+  80037e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800381:	5b                   	pop    %ebx
+  800382:	5e                   	pop    %esi
+  800383:	5d                   	pop    %ebp
+  800384:	c3                   	ret
+
+00800385 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800385:	55                   	push   %ebp
+  800386:	89 e5                	mov    %esp,%ebp
+  800388:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  80038b:	e8 80 11 00 00       	call   801510 <close_all>
+  sys_env_destroy(0);
+  800390:	83 ec 0c             	sub    $0xc,%esp
+  800393:	6a 00                	push   $0x0
+  800395:	e8 3b 0a 00 00       	call   800dd5 <sys_env_destroy>
+}
+  80039a:	83 c4 10             	add    $0x10,%esp
+  80039d:	c9                   	leave
+  80039e:	c3                   	ret
+
+0080039f <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80039f:	55                   	push   %ebp
+  8003a0:	89 e5                	mov    %esp,%ebp
+  8003a2:	56                   	push   %esi
+  8003a3:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  8003a4:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  8003a7:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  8003ad:	e8 64 0a 00 00       	call   800e16 <sys_getenvid>
+  8003b2:	83 ec 0c             	sub    $0xc,%esp
+  8003b5:	ff 75 0c             	push   0xc(%ebp)
+  8003b8:	ff 75 08             	push   0x8(%ebp)
+  8003bb:	56                   	push   %esi
+  8003bc:	50                   	push   %eax
+  8003bd:	68 20 32 80 00       	push   $0x803220
+  8003c2:	e8 b3 00 00 00       	call   80047a <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  8003c7:	83 c4 18             	add    $0x18,%esp
+  8003ca:	53                   	push   %ebx
+  8003cb:	ff 75 10             	push   0x10(%ebp)
+  8003ce:	e8 56 00 00 00       	call   800429 <vcprintf>
+  cprintf("\n");
+  8003d3:	c7 04 24 80 36 80 00 	movl   $0x803680,(%esp)
+  8003da:	e8 9b 00 00 00       	call   80047a <cprintf>
+  8003df:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  8003e2:	cc                   	int3
+  while (1)
+  8003e3:	eb fd                	jmp    8003e2 <_panic+0x43>
+
+008003e5 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8003e5:	55                   	push   %ebp
+  8003e6:	89 e5                	mov    %esp,%ebp
+  8003e8:	53                   	push   %ebx
+  8003e9:	83 ec 04             	sub    $0x4,%esp
+  8003ec:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  8003ef:	8b 13                	mov    (%ebx),%edx
+  8003f1:	8d 42 01             	lea    0x1(%edx),%eax
+  8003f4:	89 03                	mov    %eax,(%ebx)
+  8003f6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8003f9:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  8003fd:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800402:	74 09                	je     80040d <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  800404:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800408:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80040b:	c9                   	leave
+  80040c:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  80040d:	83 ec 08             	sub    $0x8,%esp
+  800410:	68 ff 00 00 00       	push   $0xff
+  800415:	8d 43 08             	lea    0x8(%ebx),%eax
+  800418:	50                   	push   %eax
+  800419:	e8 7a 09 00 00       	call   800d98 <sys_cputs>
+    b->idx = 0;
+  80041e:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800424:	83 c4 10             	add    $0x10,%esp
+  800427:	eb db                	jmp    800404 <putch+0x1f>
+
+00800429 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800429:	55                   	push   %ebp
+  80042a:	89 e5                	mov    %esp,%ebp
+  80042c:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  800432:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800439:	00 00 00 
+  b.cnt = 0;
+  80043c:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800443:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  800446:	ff 75 0c             	push   0xc(%ebp)
+  800449:	ff 75 08             	push   0x8(%ebp)
+  80044c:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800452:	50                   	push   %eax
+  800453:	68 e5 03 80 00       	push   $0x8003e5
+  800458:	e8 14 01 00 00       	call   800571 <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  80045d:	83 c4 08             	add    $0x8,%esp
+  800460:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800466:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80046c:	50                   	push   %eax
+  80046d:	e8 26 09 00 00       	call   800d98 <sys_cputs>
+
+  return b.cnt;
+}
+  800472:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800478:	c9                   	leave
+  800479:	c3                   	ret
+
+0080047a <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80047a:	55                   	push   %ebp
+  80047b:	89 e5                	mov    %esp,%ebp
+  80047d:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  800480:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  800483:	50                   	push   %eax
+  800484:	ff 75 08             	push   0x8(%ebp)
+  800487:	e8 9d ff ff ff       	call   800429 <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  80048c:	c9                   	leave
+  80048d:	c3                   	ret
+
+0080048e <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  80048e:	55                   	push   %ebp
+  80048f:	89 e5                	mov    %esp,%ebp
+  800491:	57                   	push   %edi
+  800492:	56                   	push   %esi
+  800493:	53                   	push   %ebx
+  800494:	83 ec 1c             	sub    $0x1c,%esp
+  800497:	89 c7                	mov    %eax,%edi
+  800499:	89 d6                	mov    %edx,%esi
+  80049b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80049e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8004a1:	89 d1                	mov    %edx,%ecx
+  8004a3:	89 c2                	mov    %eax,%edx
+  8004a5:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004a8:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8004ab:	8b 45 10             	mov    0x10(%ebp),%eax
+  8004ae:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  8004b1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004b4:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8004bb:	39 c2                	cmp    %eax,%edx
+  8004bd:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8004c0:	72 3e                	jb     800500 <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  8004c2:	83 ec 0c             	sub    $0xc,%esp
+  8004c5:	ff 75 18             	push   0x18(%ebp)
+  8004c8:	83 eb 01             	sub    $0x1,%ebx
+  8004cb:	53                   	push   %ebx
+  8004cc:	50                   	push   %eax
+  8004cd:	83 ec 08             	sub    $0x8,%esp
+  8004d0:	ff 75 e4             	push   -0x1c(%ebp)
+  8004d3:	ff 75 e0             	push   -0x20(%ebp)
+  8004d6:	ff 75 dc             	push   -0x24(%ebp)
+  8004d9:	ff 75 d8             	push   -0x28(%ebp)
+  8004dc:	e8 db 2a 00 00       	call   802fbc <__udivdi3>
+  8004e1:	83 c4 18             	add    $0x18,%esp
+  8004e4:	52                   	push   %edx
+  8004e5:	50                   	push   %eax
+  8004e6:	89 f2                	mov    %esi,%edx
+  8004e8:	89 f8                	mov    %edi,%eax
+  8004ea:	e8 9f ff ff ff       	call   80048e <printnum>
+  8004ef:	83 c4 20             	add    $0x20,%esp
+  8004f2:	eb 13                	jmp    800507 <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  8004f4:	83 ec 08             	sub    $0x8,%esp
+  8004f7:	56                   	push   %esi
+  8004f8:	ff 75 18             	push   0x18(%ebp)
+  8004fb:	ff d7                	call   *%edi
+  8004fd:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  800500:	83 eb 01             	sub    $0x1,%ebx
+  800503:	85 db                	test   %ebx,%ebx
+  800505:	7f ed                	jg     8004f4 <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  800507:	83 ec 08             	sub    $0x8,%esp
+  80050a:	56                   	push   %esi
+  80050b:	83 ec 04             	sub    $0x4,%esp
+  80050e:	ff 75 e4             	push   -0x1c(%ebp)
+  800511:	ff 75 e0             	push   -0x20(%ebp)
+  800514:	ff 75 dc             	push   -0x24(%ebp)
+  800517:	ff 75 d8             	push   -0x28(%ebp)
+  80051a:	e8 be 2a 00 00       	call   802fdd <__umoddi3>
+  80051f:	83 c4 14             	add    $0x14,%esp
+  800522:	0f be 80 43 32 80 00 	movsbl 0x803243(%eax),%eax
+  800529:	50                   	push   %eax
+  80052a:	ff d7                	call   *%edi
+}
+  80052c:	83 c4 10             	add    $0x10,%esp
+  80052f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800532:	5b                   	pop    %ebx
+  800533:	5e                   	pop    %esi
+  800534:	5f                   	pop    %edi
+  800535:	5d                   	pop    %ebp
+  800536:	c3                   	ret
+
+00800537 <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800537:	55                   	push   %ebp
+  800538:	89 e5                	mov    %esp,%ebp
+  80053a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  80053d:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  800541:	8b 10                	mov    (%eax),%edx
+  800543:	3b 50 04             	cmp    0x4(%eax),%edx
+  800546:	73 0a                	jae    800552 <sprintputch+0x1b>
+    *b->buf++ = ch;
+  800548:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80054b:	89 08                	mov    %ecx,(%eax)
+  80054d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800550:	88 02                	mov    %al,(%edx)
+}
+  800552:	5d                   	pop    %ebp
+  800553:	c3                   	ret
+
+00800554 <printfmt>:
+{
+  800554:	55                   	push   %ebp
+  800555:	89 e5                	mov    %esp,%ebp
+  800557:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  80055a:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  80055d:	50                   	push   %eax
+  80055e:	ff 75 10             	push   0x10(%ebp)
+  800561:	ff 75 0c             	push   0xc(%ebp)
+  800564:	ff 75 08             	push   0x8(%ebp)
+  800567:	e8 05 00 00 00       	call   800571 <vprintfmt>
+}
+  80056c:	83 c4 10             	add    $0x10,%esp
+  80056f:	c9                   	leave
+  800570:	c3                   	ret
+
+00800571 <vprintfmt>:
+{
+  800571:	55                   	push   %ebp
+  800572:	89 e5                	mov    %esp,%ebp
+  800574:	57                   	push   %edi
+  800575:	56                   	push   %esi
+  800576:	53                   	push   %ebx
+  800577:	83 ec 2c             	sub    $0x2c,%esp
+  80057a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80057d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800580:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800583:	eb 0a                	jmp    80058f <vprintfmt+0x1e>
+      putch(ch, putdat);
+  800585:	83 ec 08             	sub    $0x8,%esp
+  800588:	53                   	push   %ebx
+  800589:	50                   	push   %eax
+  80058a:	ff d6                	call   *%esi
+  80058c:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  80058f:	83 c7 01             	add    $0x1,%edi
+  800592:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800596:	83 f8 25             	cmp    $0x25,%eax
+  800599:	74 0c                	je     8005a7 <vprintfmt+0x36>
+      if (ch == '\0')
+  80059b:	85 c0                	test   %eax,%eax
+  80059d:	75 e6                	jne    800585 <vprintfmt+0x14>
+}
+  80059f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005a2:	5b                   	pop    %ebx
+  8005a3:	5e                   	pop    %esi
+  8005a4:	5f                   	pop    %edi
+  8005a5:	5d                   	pop    %ebp
+  8005a6:	c3                   	ret
+    padc = ' ';
+  8005a7:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  8005ab:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  8005b2:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  8005b9:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  8005c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  8005c5:	8d 47 01             	lea    0x1(%edi),%eax
+  8005c8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8005cb:	0f b6 17             	movzbl (%edi),%edx
+  8005ce:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8005d1:	3c 55                	cmp    $0x55,%al
+  8005d3:	0f 87 cf 03 00 00    	ja     8009a8 <vprintfmt+0x437>
+  8005d9:	0f b6 c0             	movzbl %al,%eax
+  8005dc:	ff 24 85 80 33 80 00 	jmp    *0x803380(,%eax,4)
+  8005e3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  8005e6:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8005ea:	eb d9                	jmp    8005c5 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  8005ec:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8005ef:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8005f3:	eb d0                	jmp    8005c5 <vprintfmt+0x54>
+  8005f5:	0f b6 d2             	movzbl %dl,%edx
+  8005f8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  8005fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800600:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  800603:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800606:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  80060a:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  80060d:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800610:	83 f9 09             	cmp    $0x9,%ecx
+  800613:	77 55                	ja     80066a <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  800615:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  800618:	eb e9                	jmp    800603 <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  80061a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80061d:	8b 00                	mov    (%eax),%eax
+  80061f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800622:	8b 45 14             	mov    0x14(%ebp),%eax
+  800625:	8d 40 04             	lea    0x4(%eax),%eax
+  800628:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  80062b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  80062e:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800632:	79 91                	jns    8005c5 <vprintfmt+0x54>
+        width = precision, precision = -1;
+  800634:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800637:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80063a:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800641:	eb 82                	jmp    8005c5 <vprintfmt+0x54>
+      if (width < 0)
+  800643:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800646:	85 d2                	test   %edx,%edx
+  800648:	b8 00 00 00 00       	mov    $0x0,%eax
+  80064d:	0f 49 c2             	cmovns %edx,%eax
+  800650:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  800653:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  800656:	e9 6a ff ff ff       	jmp    8005c5 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  80065b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  80065e:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  800665:	e9 5b ff ff ff       	jmp    8005c5 <vprintfmt+0x54>
+  80066a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80066d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800670:	eb bc                	jmp    80062e <vprintfmt+0xbd>
+      lflag++;
+  800672:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  800675:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  800678:	e9 48 ff ff ff       	jmp    8005c5 <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  80067d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800680:	8d 78 04             	lea    0x4(%eax),%edi
+  800683:	83 ec 08             	sub    $0x8,%esp
+  800686:	53                   	push   %ebx
+  800687:	ff 30                	push   (%eax)
+  800689:	ff d6                	call   *%esi
+      break;
+  80068b:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  80068e:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  800691:	e9 b1 02 00 00       	jmp    800947 <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  800696:	8b 45 14             	mov    0x14(%ebp),%eax
+  800699:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  80069c:	8b 10                	mov    (%eax),%edx
+  80069e:	89 d0                	mov    %edx,%eax
+  8006a0:	f7 d8                	neg    %eax
+  8006a2:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8006a5:	83 f8 10             	cmp    $0x10,%eax
+  8006a8:	7f 23                	jg     8006cd <vprintfmt+0x15c>
+  8006aa:	8b 14 85 e0 34 80 00 	mov    0x8034e0(,%eax,4),%edx
+  8006b1:	85 d2                	test   %edx,%edx
+  8006b3:	74 18                	je     8006cd <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  8006b5:	52                   	push   %edx
+  8006b6:	68 2a 36 80 00       	push   $0x80362a
+  8006bb:	53                   	push   %ebx
+  8006bc:	56                   	push   %esi
+  8006bd:	e8 92 fe ff ff       	call   800554 <printfmt>
+  8006c2:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  8006c5:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8006c8:	e9 7a 02 00 00       	jmp    800947 <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  8006cd:	50                   	push   %eax
+  8006ce:	68 5b 32 80 00       	push   $0x80325b
+  8006d3:	53                   	push   %ebx
+  8006d4:	56                   	push   %esi
+  8006d5:	e8 7a fe ff ff       	call   800554 <printfmt>
+  8006da:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  8006dd:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  8006e0:	e9 62 02 00 00       	jmp    800947 <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  8006e5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e8:	83 c0 04             	add    $0x4,%eax
+  8006eb:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8006ee:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f1:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  8006f3:	85 c9                	test   %ecx,%ecx
+  8006f5:	b8 54 32 80 00       	mov    $0x803254,%eax
+  8006fa:	0f 45 c1             	cmovne %ecx,%eax
+  8006fd:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  800700:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800704:	7e 06                	jle    80070c <vprintfmt+0x19b>
+  800706:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80070a:	75 0b                	jne    800717 <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  80070c:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80070f:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800712:	89 75 08             	mov    %esi,0x8(%ebp)
+  800715:	eb 5c                	jmp    800773 <vprintfmt+0x202>
+  800717:	83 ec 08             	sub    $0x8,%esp
+  80071a:	ff 75 d0             	push   -0x30(%ebp)
+  80071d:	ff 75 cc             	push   -0x34(%ebp)
+  800720:	e8 20 03 00 00       	call   800a45 <strnlen>
+  800725:	89 c2                	mov    %eax,%edx
+  800727:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80072a:	29 d0                	sub    %edx,%eax
+  80072c:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  80072f:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800733:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800736:	89 75 08             	mov    %esi,0x8(%ebp)
+  800739:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  80073b:	eb 0e                	jmp    80074b <vprintfmt+0x1da>
+          putch(padc, putdat);
+  80073d:	83 ec 08             	sub    $0x8,%esp
+  800740:	53                   	push   %ebx
+  800741:	57                   	push   %edi
+  800742:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800745:	83 ee 01             	sub    $0x1,%esi
+  800748:	83 c4 10             	add    $0x10,%esp
+  80074b:	85 f6                	test   %esi,%esi
+  80074d:	7f ee                	jg     80073d <vprintfmt+0x1cc>
+  80074f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800752:	8b 75 08             	mov    0x8(%ebp),%esi
+  800755:	85 c0                	test   %eax,%eax
+  800757:	ba 00 00 00 00       	mov    $0x0,%edx
+  80075c:	0f 49 d0             	cmovns %eax,%edx
+  80075f:	29 d0                	sub    %edx,%eax
+  800761:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800764:	eb a6                	jmp    80070c <vprintfmt+0x19b>
+          putch(ch, putdat);
+  800766:	83 ec 08             	sub    $0x8,%esp
+  800769:	53                   	push   %ebx
+  80076a:	52                   	push   %edx
+  80076b:	ff 55 08             	call   *0x8(%ebp)
+  80076e:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800771:	89 f1                	mov    %esi,%ecx
+  800773:	8d 71 01             	lea    0x1(%ecx),%esi
+  800776:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80077a:	0f be d0             	movsbl %al,%edx
+  80077d:	85 d2                	test   %edx,%edx
+  80077f:	74 28                	je     8007a9 <vprintfmt+0x238>
+  800781:	85 ff                	test   %edi,%edi
+  800783:	78 05                	js     80078a <vprintfmt+0x219>
+  800785:	83 ef 01             	sub    $0x1,%edi
+  800788:	78 30                	js     8007ba <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  80078a:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80078e:	74 d6                	je     800766 <vprintfmt+0x1f5>
+  800790:	0f be c0             	movsbl %al,%eax
+  800793:	83 e8 20             	sub    $0x20,%eax
+  800796:	83 f8 5e             	cmp    $0x5e,%eax
+  800799:	76 cb                	jbe    800766 <vprintfmt+0x1f5>
+          putch('?', putdat);
+  80079b:	83 ec 08             	sub    $0x8,%esp
+  80079e:	53                   	push   %ebx
+  80079f:	6a 3f                	push   $0x3f
+  8007a1:	ff 55 08             	call   *0x8(%ebp)
+  8007a4:	83 c4 10             	add    $0x10,%esp
+  8007a7:	eb c8                	jmp    800771 <vprintfmt+0x200>
+  8007a9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007ac:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8007af:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8007b2:	01 d0                	add    %edx,%eax
+  8007b4:	29 c8                	sub    %ecx,%eax
+  8007b6:	89 c7                	mov    %eax,%edi
+  8007b8:	eb 13                	jmp    8007cd <vprintfmt+0x25c>
+  8007ba:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007bd:	eb ed                	jmp    8007ac <vprintfmt+0x23b>
+        putch(' ', putdat);
+  8007bf:	83 ec 08             	sub    $0x8,%esp
+  8007c2:	53                   	push   %ebx
+  8007c3:	6a 20                	push   $0x20
+  8007c5:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  8007c7:	83 ef 01             	sub    $0x1,%edi
+  8007ca:	83 c4 10             	add    $0x10,%esp
+  8007cd:	85 ff                	test   %edi,%edi
+  8007cf:	7f ee                	jg     8007bf <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  8007d1:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8007d4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007d7:	e9 6b 01 00 00       	jmp    800947 <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  8007dc:	83 f9 01             	cmp    $0x1,%ecx
+  8007df:	7f 1f                	jg     800800 <vprintfmt+0x28f>
+  else if (lflag)
+  8007e1:	85 c9                	test   %ecx,%ecx
+  8007e3:	74 67                	je     80084c <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  8007e5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007e8:	8b 00                	mov    (%eax),%eax
+  8007ea:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007ed:	89 c1                	mov    %eax,%ecx
+  8007ef:	c1 f9 1f             	sar    $0x1f,%ecx
+  8007f2:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8007f5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007f8:	8d 40 04             	lea    0x4(%eax),%eax
+  8007fb:	89 45 14             	mov    %eax,0x14(%ebp)
+  8007fe:	eb 17                	jmp    800817 <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  800800:	8b 45 14             	mov    0x14(%ebp),%eax
+  800803:	8b 50 04             	mov    0x4(%eax),%edx
+  800806:	8b 00                	mov    (%eax),%eax
+  800808:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80080b:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80080e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800811:	8d 40 08             	lea    0x8(%eax),%eax
+  800814:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  800817:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80081a:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  80081d:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  800822:	85 c9                	test   %ecx,%ecx
+  800824:	0f 89 03 01 00 00    	jns    80092d <vprintfmt+0x3bc>
+        putch('-', putdat);
+  80082a:	83 ec 08             	sub    $0x8,%esp
+  80082d:	53                   	push   %ebx
+  80082e:	6a 2d                	push   $0x2d
+  800830:	ff d6                	call   *%esi
+        num = -(long long)num;
+  800832:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800835:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800838:	f7 da                	neg    %edx
+  80083a:	83 d1 00             	adc    $0x0,%ecx
+  80083d:	f7 d9                	neg    %ecx
+  80083f:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  800842:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800847:	e9 e1 00 00 00       	jmp    80092d <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  80084c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80084f:	8b 00                	mov    (%eax),%eax
+  800851:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800854:	89 c1                	mov    %eax,%ecx
+  800856:	c1 f9 1f             	sar    $0x1f,%ecx
+  800859:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80085c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80085f:	8d 40 04             	lea    0x4(%eax),%eax
+  800862:	89 45 14             	mov    %eax,0x14(%ebp)
+  800865:	eb b0                	jmp    800817 <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  800867:	83 f9 01             	cmp    $0x1,%ecx
+  80086a:	7f 1e                	jg     80088a <vprintfmt+0x319>
+  else if (lflag)
+  80086c:	85 c9                	test   %ecx,%ecx
+  80086e:	74 32                	je     8008a2 <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  800870:	8b 45 14             	mov    0x14(%ebp),%eax
+  800873:	8b 10                	mov    (%eax),%edx
+  800875:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80087a:	8d 40 04             	lea    0x4(%eax),%eax
+  80087d:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800880:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  800885:	e9 a3 00 00 00       	jmp    80092d <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  80088a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80088d:	8b 10                	mov    (%eax),%edx
+  80088f:	8b 48 04             	mov    0x4(%eax),%ecx
+  800892:	8d 40 08             	lea    0x8(%eax),%eax
+  800895:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800898:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  80089d:	e9 8b 00 00 00       	jmp    80092d <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8008a2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008a5:	8b 10                	mov    (%eax),%edx
+  8008a7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008ac:	8d 40 04             	lea    0x4(%eax),%eax
+  8008af:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  8008b2:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  8008b7:	eb 74                	jmp    80092d <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  8008b9:	83 f9 01             	cmp    $0x1,%ecx
+  8008bc:	7f 1b                	jg     8008d9 <vprintfmt+0x368>
+  else if (lflag)
+  8008be:	85 c9                	test   %ecx,%ecx
+  8008c0:	74 2c                	je     8008ee <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  8008c2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008c5:	8b 10                	mov    (%eax),%edx
+  8008c7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008cc:	8d 40 04             	lea    0x4(%eax),%eax
+  8008cf:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8008d2:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  8008d7:	eb 54                	jmp    80092d <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  8008d9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008dc:	8b 10                	mov    (%eax),%edx
+  8008de:	8b 48 04             	mov    0x4(%eax),%ecx
+  8008e1:	8d 40 08             	lea    0x8(%eax),%eax
+  8008e4:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8008e7:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  8008ec:	eb 3f                	jmp    80092d <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8008ee:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008f1:	8b 10                	mov    (%eax),%edx
+  8008f3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008f8:	8d 40 04             	lea    0x4(%eax),%eax
+  8008fb:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8008fe:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  800903:	eb 28                	jmp    80092d <vprintfmt+0x3bc>
+      putch('0', putdat);
+  800905:	83 ec 08             	sub    $0x8,%esp
+  800908:	53                   	push   %ebx
+  800909:	6a 30                	push   $0x30
+  80090b:	ff d6                	call   *%esi
+      putch('x', putdat);
+  80090d:	83 c4 08             	add    $0x8,%esp
+  800910:	53                   	push   %ebx
+  800911:	6a 78                	push   $0x78
+  800913:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  800915:	8b 45 14             	mov    0x14(%ebp),%eax
+  800918:	8b 10                	mov    (%eax),%edx
+  80091a:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  80091f:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  800922:	8d 40 04             	lea    0x4(%eax),%eax
+  800925:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800928:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  80092d:	83 ec 0c             	sub    $0xc,%esp
+  800930:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800934:	50                   	push   %eax
+  800935:	ff 75 e0             	push   -0x20(%ebp)
+  800938:	57                   	push   %edi
+  800939:	51                   	push   %ecx
+  80093a:	52                   	push   %edx
+  80093b:	89 da                	mov    %ebx,%edx
+  80093d:	89 f0                	mov    %esi,%eax
+  80093f:	e8 4a fb ff ff       	call   80048e <printnum>
+      break;
+  800944:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  800947:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  80094a:	e9 40 fc ff ff       	jmp    80058f <vprintfmt+0x1e>
+  if (lflag >= 2)
+  80094f:	83 f9 01             	cmp    $0x1,%ecx
+  800952:	7f 1b                	jg     80096f <vprintfmt+0x3fe>
+  else if (lflag)
+  800954:	85 c9                	test   %ecx,%ecx
+  800956:	74 2c                	je     800984 <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  800958:	8b 45 14             	mov    0x14(%ebp),%eax
+  80095b:	8b 10                	mov    (%eax),%edx
+  80095d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800962:	8d 40 04             	lea    0x4(%eax),%eax
+  800965:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800968:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  80096d:	eb be                	jmp    80092d <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  80096f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800972:	8b 10                	mov    (%eax),%edx
+  800974:	8b 48 04             	mov    0x4(%eax),%ecx
+  800977:	8d 40 08             	lea    0x8(%eax),%eax
+  80097a:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  80097d:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  800982:	eb a9                	jmp    80092d <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800984:	8b 45 14             	mov    0x14(%ebp),%eax
+  800987:	8b 10                	mov    (%eax),%edx
+  800989:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80098e:	8d 40 04             	lea    0x4(%eax),%eax
+  800991:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800994:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  800999:	eb 92                	jmp    80092d <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  80099b:	83 ec 08             	sub    $0x8,%esp
+  80099e:	53                   	push   %ebx
+  80099f:	6a 25                	push   $0x25
+  8009a1:	ff d6                	call   *%esi
+      break;
+  8009a3:	83 c4 10             	add    $0x10,%esp
+  8009a6:	eb 9f                	jmp    800947 <vprintfmt+0x3d6>
+      putch('%', putdat);
+  8009a8:	83 ec 08             	sub    $0x8,%esp
+  8009ab:	53                   	push   %ebx
+  8009ac:	6a 25                	push   $0x25
+  8009ae:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  8009b0:	83 c4 10             	add    $0x10,%esp
+  8009b3:	89 f8                	mov    %edi,%eax
+  8009b5:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8009b9:	74 05                	je     8009c0 <vprintfmt+0x44f>
+  8009bb:	83 e8 01             	sub    $0x1,%eax
+  8009be:	eb f5                	jmp    8009b5 <vprintfmt+0x444>
+  8009c0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8009c3:	eb 82                	jmp    800947 <vprintfmt+0x3d6>
+
+008009c5 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8009c5:	55                   	push   %ebp
+  8009c6:	89 e5                	mov    %esp,%ebp
+  8009c8:	83 ec 18             	sub    $0x18,%esp
+  8009cb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009ce:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  8009d1:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8009d4:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8009d8:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8009db:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  8009e2:	85 c0                	test   %eax,%eax
+  8009e4:	74 26                	je     800a0c <vsnprintf+0x47>
+  8009e6:	85 d2                	test   %edx,%edx
+  8009e8:	7e 22                	jle    800a0c <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8009ea:	ff 75 14             	push   0x14(%ebp)
+  8009ed:	ff 75 10             	push   0x10(%ebp)
+  8009f0:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8009f3:	50                   	push   %eax
+  8009f4:	68 37 05 80 00       	push   $0x800537
+  8009f9:	e8 73 fb ff ff       	call   800571 <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  8009fe:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800a01:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  800a04:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a07:	83 c4 10             	add    $0x10,%esp
+}
+  800a0a:	c9                   	leave
+  800a0b:	c3                   	ret
+    return -E_INVAL;
+  800a0c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a11:	eb f7                	jmp    800a0a <vsnprintf+0x45>
+
+00800a13 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800a13:	55                   	push   %ebp
+  800a14:	89 e5                	mov    %esp,%ebp
+  800a16:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  800a19:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  800a1c:	50                   	push   %eax
+  800a1d:	ff 75 10             	push   0x10(%ebp)
+  800a20:	ff 75 0c             	push   0xc(%ebp)
+  800a23:	ff 75 08             	push   0x8(%ebp)
+  800a26:	e8 9a ff ff ff       	call   8009c5 <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  800a2b:	c9                   	leave
+  800a2c:	c3                   	ret
+
+00800a2d <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800a2d:	55                   	push   %ebp
+  800a2e:	89 e5                	mov    %esp,%ebp
+  800a30:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  800a33:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a38:	eb 03                	jmp    800a3d <strlen+0x10>
+    n++;
+  800a3a:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  800a3d:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800a41:	75 f7                	jne    800a3a <strlen+0xd>
+  return n;
+}
+  800a43:	5d                   	pop    %ebp
+  800a44:	c3                   	ret
+
+00800a45 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800a45:	55                   	push   %ebp
+  800a46:	89 e5                	mov    %esp,%ebp
+  800a48:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a4b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a4e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a53:	eb 03                	jmp    800a58 <strnlen+0x13>
+    n++;
+  800a55:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a58:	39 d0                	cmp    %edx,%eax
+  800a5a:	74 08                	je     800a64 <strnlen+0x1f>
+  800a5c:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800a60:	75 f3                	jne    800a55 <strnlen+0x10>
+  800a62:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  800a64:	89 d0                	mov    %edx,%eax
+  800a66:	5d                   	pop    %ebp
+  800a67:	c3                   	ret
+
+00800a68 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800a68:	55                   	push   %ebp
+  800a69:	89 e5                	mov    %esp,%ebp
+  800a6b:	53                   	push   %ebx
+  800a6c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a6f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  800a72:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a77:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800a7b:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800a7e:	83 c0 01             	add    $0x1,%eax
+  800a81:	84 d2                	test   %dl,%dl
+  800a83:	75 f2                	jne    800a77 <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  800a85:	89 c8                	mov    %ecx,%eax
+  800a87:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a8a:	c9                   	leave
+  800a8b:	c3                   	ret
+
+00800a8c <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800a8c:	55                   	push   %ebp
+  800a8d:	89 e5                	mov    %esp,%ebp
+  800a8f:	53                   	push   %ebx
+  800a90:	83 ec 10             	sub    $0x10,%esp
+  800a93:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  800a96:	53                   	push   %ebx
+  800a97:	e8 91 ff ff ff       	call   800a2d <strlen>
+  800a9c:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  800a9f:	ff 75 0c             	push   0xc(%ebp)
+  800aa2:	01 d8                	add    %ebx,%eax
+  800aa4:	50                   	push   %eax
+  800aa5:	e8 be ff ff ff       	call   800a68 <strcpy>
+  return dst;
+}
+  800aaa:	89 d8                	mov    %ebx,%eax
+  800aac:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800aaf:	c9                   	leave
+  800ab0:	c3                   	ret
+
+00800ab1 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  800ab1:	55                   	push   %ebp
+  800ab2:	89 e5                	mov    %esp,%ebp
+  800ab4:	56                   	push   %esi
+  800ab5:	53                   	push   %ebx
+  800ab6:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ab9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  800abc:	89 f3                	mov    %esi,%ebx
+  800abe:	03 5d 10             	add    0x10(%ebp),%ebx
+  800ac1:	89 f0                	mov    %esi,%eax
+  800ac3:	eb 0f                	jmp    800ad4 <strncpy+0x23>
+    *dst++ = *src;
+  800ac5:	83 c0 01             	add    $0x1,%eax
+  800ac8:	0f b6 0a             	movzbl (%edx),%ecx
+  800acb:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  800ace:	80 f9 01             	cmp    $0x1,%cl
+  800ad1:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  800ad4:	39 d8                	cmp    %ebx,%eax
+  800ad6:	75 ed                	jne    800ac5 <strncpy+0x14>
+  }
+  return ret;
+}
+  800ad8:	89 f0                	mov    %esi,%eax
+  800ada:	5b                   	pop    %ebx
+  800adb:	5e                   	pop    %esi
+  800adc:	5d                   	pop    %ebp
+  800add:	c3                   	ret
+
+00800ade <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800ade:	55                   	push   %ebp
+  800adf:	89 e5                	mov    %esp,%ebp
+  800ae1:	56                   	push   %esi
+  800ae2:	53                   	push   %ebx
+  800ae3:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ae6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ae9:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  800aec:	89 f0                	mov    %esi,%eax
+  800aee:	85 d2                	test   %edx,%edx
+  800af0:	74 21                	je     800b13 <strlcpy+0x35>
+  800af2:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800af6:	89 f2                	mov    %esi,%edx
+  800af8:	eb 09                	jmp    800b03 <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  800afa:	83 c1 01             	add    $0x1,%ecx
+  800afd:	83 c2 01             	add    $0x1,%edx
+  800b00:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  800b03:	39 c2                	cmp    %eax,%edx
+  800b05:	74 09                	je     800b10 <strlcpy+0x32>
+  800b07:	0f b6 19             	movzbl (%ecx),%ebx
+  800b0a:	84 db                	test   %bl,%bl
+  800b0c:	75 ec                	jne    800afa <strlcpy+0x1c>
+  800b0e:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  800b10:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  800b13:	29 f0                	sub    %esi,%eax
+}
+  800b15:	5b                   	pop    %ebx
+  800b16:	5e                   	pop    %esi
+  800b17:	5d                   	pop    %ebp
+  800b18:	c3                   	ret
+
+00800b19 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800b19:	55                   	push   %ebp
+  800b1a:	89 e5                	mov    %esp,%ebp
+  800b1c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b1f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  800b22:	eb 06                	jmp    800b2a <strcmp+0x11>
+    p++, q++;
+  800b24:	83 c1 01             	add    $0x1,%ecx
+  800b27:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  800b2a:	0f b6 01             	movzbl (%ecx),%eax
+  800b2d:	84 c0                	test   %al,%al
+  800b2f:	74 04                	je     800b35 <strcmp+0x1c>
+  800b31:	3a 02                	cmp    (%edx),%al
+  800b33:	74 ef                	je     800b24 <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  800b35:	0f b6 c0             	movzbl %al,%eax
+  800b38:	0f b6 12             	movzbl (%edx),%edx
+  800b3b:	29 d0                	sub    %edx,%eax
+}
+  800b3d:	5d                   	pop    %ebp
+  800b3e:	c3                   	ret
+
+00800b3f <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800b3f:	55                   	push   %ebp
+  800b40:	89 e5                	mov    %esp,%ebp
+  800b42:	53                   	push   %ebx
+  800b43:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b46:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b49:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  800b4c:	eb 09                	jmp    800b57 <strncmp+0x18>
+    n--, p++, q++;
+  800b4e:	83 ea 01             	sub    $0x1,%edx
+  800b51:	83 c0 01             	add    $0x1,%eax
+  800b54:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  800b57:	85 d2                	test   %edx,%edx
+  800b59:	74 18                	je     800b73 <strncmp+0x34>
+  800b5b:	0f b6 18             	movzbl (%eax),%ebx
+  800b5e:	84 db                	test   %bl,%bl
+  800b60:	74 04                	je     800b66 <strncmp+0x27>
+  800b62:	3a 19                	cmp    (%ecx),%bl
+  800b64:	74 e8                	je     800b4e <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800b66:	0f b6 00             	movzbl (%eax),%eax
+  800b69:	0f b6 11             	movzbl (%ecx),%edx
+  800b6c:	29 d0                	sub    %edx,%eax
+}
+  800b6e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b71:	c9                   	leave
+  800b72:	c3                   	ret
+    return 0;
+  800b73:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b78:	eb f4                	jmp    800b6e <strncmp+0x2f>
+
+00800b7a <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800b7a:	55                   	push   %ebp
+  800b7b:	89 e5                	mov    %esp,%ebp
+  800b7d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b80:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800b84:	eb 03                	jmp    800b89 <strchr+0xf>
+  800b86:	83 c0 01             	add    $0x1,%eax
+  800b89:	0f b6 10             	movzbl (%eax),%edx
+  800b8c:	84 d2                	test   %dl,%dl
+  800b8e:	74 06                	je     800b96 <strchr+0x1c>
+    if (*s == c)
+  800b90:	38 ca                	cmp    %cl,%dl
+  800b92:	75 f2                	jne    800b86 <strchr+0xc>
+  800b94:	eb 05                	jmp    800b9b <strchr+0x21>
+      return (char*)s;
+  return 0;
+  800b96:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b9b:	5d                   	pop    %ebp
+  800b9c:	c3                   	ret
+
+00800b9d <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800b9d:	55                   	push   %ebp
+  800b9e:	89 e5                	mov    %esp,%ebp
+  800ba0:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ba3:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800ba7:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  800baa:	38 ca                	cmp    %cl,%dl
+  800bac:	74 09                	je     800bb7 <strfind+0x1a>
+  800bae:	84 d2                	test   %dl,%dl
+  800bb0:	74 05                	je     800bb7 <strfind+0x1a>
+  for (; *s; s++)
+  800bb2:	83 c0 01             	add    $0x1,%eax
+  800bb5:	eb f0                	jmp    800ba7 <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  800bb7:	5d                   	pop    %ebp
+  800bb8:	c3                   	ret
+
+00800bb9 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800bb9:	55                   	push   %ebp
+  800bba:	89 e5                	mov    %esp,%ebp
+  800bbc:	57                   	push   %edi
+  800bbd:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800bc0:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  800bc3:	85 c9                	test   %ecx,%ecx
+  800bc5:	74 20                	je     800be7 <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  800bc7:	89 f8                	mov    %edi,%eax
+  800bc9:	09 c8                	or     %ecx,%eax
+  800bcb:	a8 03                	test   $0x3,%al
+  800bcd:	75 12                	jne    800be1 <memset+0x28>
+    c &= 0xFF;
+  800bcf:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800bd3:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  800bd9:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  800bdc:	fc                   	cld
+  800bdd:	f3 ab                	rep stos %eax,%es:(%edi)
+  800bdf:	eb 06                	jmp    800be7 <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  800be1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800be4:	fc                   	cld
+  800be5:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  800be7:	89 f8                	mov    %edi,%eax
+  800be9:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800bec:	c9                   	leave
+  800bed:	c3                   	ret
+
+00800bee <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800bee:	55                   	push   %ebp
+  800bef:	89 e5                	mov    %esp,%ebp
+  800bf1:	57                   	push   %edi
+  800bf2:	56                   	push   %esi
+  800bf3:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bf6:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800bf9:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  800bfc:	39 c6                	cmp    %eax,%esi
+  800bfe:	73 32                	jae    800c32 <memmove+0x44>
+  800c00:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800c03:	39 d0                	cmp    %edx,%eax
+  800c05:	73 2b                	jae    800c32 <memmove+0x44>
+    s += n;
+    d += n;
+  800c07:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c0a:	89 d6                	mov    %edx,%esi
+  800c0c:	09 fe                	or     %edi,%esi
+  800c0e:	09 ce                	or     %ecx,%esi
+  800c10:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800c16:	75 0e                	jne    800c26 <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800c18:	83 ef 04             	sub    $0x4,%edi
+  800c1b:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800c1e:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  800c21:	fd                   	std
+  800c22:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c24:	eb 09                	jmp    800c2f <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800c26:	83 ef 01             	sub    $0x1,%edi
+  800c29:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  800c2c:	fd                   	std
+  800c2d:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  800c2f:	fc                   	cld
+  800c30:	eb 1a                	jmp    800c4c <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c32:	89 f2                	mov    %esi,%edx
+  800c34:	09 c2                	or     %eax,%edx
+  800c36:	09 ca                	or     %ecx,%edx
+  800c38:	f6 c2 03             	test   $0x3,%dl
+  800c3b:	75 0a                	jne    800c47 <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800c3d:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  800c40:	89 c7                	mov    %eax,%edi
+  800c42:	fc                   	cld
+  800c43:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c45:	eb 05                	jmp    800c4c <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  800c47:	89 c7                	mov    %eax,%edi
+  800c49:	fc                   	cld
+  800c4a:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  800c4c:	5e                   	pop    %esi
+  800c4d:	5f                   	pop    %edi
+  800c4e:	5d                   	pop    %ebp
+  800c4f:	c3                   	ret
+
+00800c50 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800c50:	55                   	push   %ebp
+  800c51:	89 e5                	mov    %esp,%ebp
+  800c53:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  800c56:	ff 75 10             	push   0x10(%ebp)
+  800c59:	ff 75 0c             	push   0xc(%ebp)
+  800c5c:	ff 75 08             	push   0x8(%ebp)
+  800c5f:	e8 8a ff ff ff       	call   800bee <memmove>
+}
+  800c64:	c9                   	leave
+  800c65:	c3                   	ret
+
+00800c66 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800c66:	55                   	push   %ebp
+  800c67:	89 e5                	mov    %esp,%ebp
+  800c69:	56                   	push   %esi
+  800c6a:	53                   	push   %ebx
+  800c6b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c6e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  800c71:	89 c6                	mov    %eax,%esi
+  800c73:	03 75 10             	add    0x10(%ebp),%esi
+  800c76:	eb 06                	jmp    800c7e <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  800c78:	83 c0 01             	add    $0x1,%eax
+  800c7b:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  800c7e:	39 f0                	cmp    %esi,%eax
+  800c80:	74 14                	je     800c96 <memcmp+0x30>
+    if (*s1 != *s2)
+  800c82:	0f b6 08             	movzbl (%eax),%ecx
+  800c85:	0f b6 1a             	movzbl (%edx),%ebx
+  800c88:	38 d9                	cmp    %bl,%cl
+  800c8a:	74 ec                	je     800c78 <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  800c8c:	0f b6 c1             	movzbl %cl,%eax
+  800c8f:	0f b6 db             	movzbl %bl,%ebx
+  800c92:	29 d8                	sub    %ebx,%eax
+  800c94:	eb 05                	jmp    800c9b <memcmp+0x35>
+  }
+
+  return 0;
+  800c96:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c9b:	5b                   	pop    %ebx
+  800c9c:	5e                   	pop    %esi
+  800c9d:	5d                   	pop    %ebp
+  800c9e:	c3                   	ret
+
+00800c9f <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800c9f:	55                   	push   %ebp
+  800ca0:	89 e5                	mov    %esp,%ebp
+  800ca2:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ca5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  800ca8:	89 c2                	mov    %eax,%edx
+  800caa:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  800cad:	eb 03                	jmp    800cb2 <memfind+0x13>
+  800caf:	83 c0 01             	add    $0x1,%eax
+  800cb2:	39 d0                	cmp    %edx,%eax
+  800cb4:	73 04                	jae    800cba <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  800cb6:	38 08                	cmp    %cl,(%eax)
+  800cb8:	75 f5                	jne    800caf <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  800cba:	5d                   	pop    %ebp
+  800cbb:	c3                   	ret
+
+00800cbc <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800cbc:	55                   	push   %ebp
+  800cbd:	89 e5                	mov    %esp,%ebp
+  800cbf:	57                   	push   %edi
+  800cc0:	56                   	push   %esi
+  800cc1:	53                   	push   %ebx
+  800cc2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cc5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  800cc8:	eb 03                	jmp    800ccd <strtol+0x11>
+    s++;
+  800cca:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  800ccd:	0f b6 02             	movzbl (%edx),%eax
+  800cd0:	3c 20                	cmp    $0x20,%al
+  800cd2:	74 f6                	je     800cca <strtol+0xe>
+  800cd4:	3c 09                	cmp    $0x9,%al
+  800cd6:	74 f2                	je     800cca <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  800cd8:	3c 2b                	cmp    $0x2b,%al
+  800cda:	74 2a                	je     800d06 <strtol+0x4a>
+  int neg = 0;
+  800cdc:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  800ce1:	3c 2d                	cmp    $0x2d,%al
+  800ce3:	74 2b                	je     800d10 <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ce5:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800ceb:	75 0f                	jne    800cfc <strtol+0x40>
+  800ced:	80 3a 30             	cmpb   $0x30,(%edx)
+  800cf0:	74 28                	je     800d1a <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  800cf2:	85 db                	test   %ebx,%ebx
+  800cf4:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800cf9:	0f 44 d8             	cmove  %eax,%ebx
+  800cfc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d01:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800d04:	eb 46                	jmp    800d4c <strtol+0x90>
+    s++;
+  800d06:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  800d09:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d0e:	eb d5                	jmp    800ce5 <strtol+0x29>
+    s++, neg = 1;
+  800d10:	83 c2 01             	add    $0x1,%edx
+  800d13:	bf 01 00 00 00       	mov    $0x1,%edi
+  800d18:	eb cb                	jmp    800ce5 <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d1a:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800d1e:	74 0e                	je     800d2e <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  800d20:	85 db                	test   %ebx,%ebx
+  800d22:	75 d8                	jne    800cfc <strtol+0x40>
+    s++, base = 8;
+  800d24:	83 c2 01             	add    $0x1,%edx
+  800d27:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800d2c:	eb ce                	jmp    800cfc <strtol+0x40>
+    s += 2, base = 16;
+  800d2e:	83 c2 02             	add    $0x2,%edx
+  800d31:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800d36:	eb c4                	jmp    800cfc <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  800d38:	0f be c0             	movsbl %al,%eax
+  800d3b:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  800d3e:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800d41:	7d 3a                	jge    800d7d <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  800d43:	83 c2 01             	add    $0x1,%edx
+  800d46:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800d4a:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  800d4c:	0f b6 02             	movzbl (%edx),%eax
+  800d4f:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800d52:	89 f3                	mov    %esi,%ebx
+  800d54:	80 fb 09             	cmp    $0x9,%bl
+  800d57:	76 df                	jbe    800d38 <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  800d59:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800d5c:	89 f3                	mov    %esi,%ebx
+  800d5e:	80 fb 19             	cmp    $0x19,%bl
+  800d61:	77 08                	ja     800d6b <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  800d63:	0f be c0             	movsbl %al,%eax
+  800d66:	83 e8 57             	sub    $0x57,%eax
+  800d69:	eb d3                	jmp    800d3e <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  800d6b:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800d6e:	89 f3                	mov    %esi,%ebx
+  800d70:	80 fb 19             	cmp    $0x19,%bl
+  800d73:	77 08                	ja     800d7d <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  800d75:	0f be c0             	movsbl %al,%eax
+  800d78:	83 e8 37             	sub    $0x37,%eax
+  800d7b:	eb c1                	jmp    800d3e <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  800d7d:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800d81:	74 05                	je     800d88 <strtol+0xcc>
+    *endptr = (char*)s;
+  800d83:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d86:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  800d88:	89 c8                	mov    %ecx,%eax
+  800d8a:	f7 d8                	neg    %eax
+  800d8c:	85 ff                	test   %edi,%edi
+  800d8e:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800d91:	89 c8                	mov    %ecx,%eax
+  800d93:	5b                   	pop    %ebx
+  800d94:	5e                   	pop    %esi
+  800d95:	5f                   	pop    %edi
+  800d96:	5d                   	pop    %ebp
+  800d97:	c3                   	ret
+
+00800d98 <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800d98:	55                   	push   %ebp
+  800d99:	89 e5                	mov    %esp,%ebp
+  800d9b:	57                   	push   %edi
+  800d9c:	56                   	push   %esi
+  800d9d:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d9e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800da3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800da6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800da9:	89 c3                	mov    %eax,%ebx
+  800dab:	89 c7                	mov    %eax,%edi
+  800dad:	89 c6                	mov    %eax,%esi
+  800daf:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800db1:	5b                   	pop    %ebx
+  800db2:	5e                   	pop    %esi
+  800db3:	5f                   	pop    %edi
+  800db4:	5d                   	pop    %ebp
+  800db5:	c3                   	ret
+
+00800db6 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800db6:	55                   	push   %ebp
+  800db7:	89 e5                	mov    %esp,%ebp
+  800db9:	57                   	push   %edi
+  800dba:	56                   	push   %esi
+  800dbb:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800dbc:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dc1:	b8 01 00 00 00       	mov    $0x1,%eax
+  800dc6:	89 d1                	mov    %edx,%ecx
+  800dc8:	89 d3                	mov    %edx,%ebx
+  800dca:	89 d7                	mov    %edx,%edi
+  800dcc:	89 d6                	mov    %edx,%esi
+  800dce:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800dd0:	5b                   	pop    %ebx
+  800dd1:	5e                   	pop    %esi
+  800dd2:	5f                   	pop    %edi
+  800dd3:	5d                   	pop    %ebp
+  800dd4:	c3                   	ret
+
+00800dd5 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800dd5:	55                   	push   %ebp
+  800dd6:	89 e5                	mov    %esp,%ebp
+  800dd8:	57                   	push   %edi
+  800dd9:	56                   	push   %esi
+  800dda:	53                   	push   %ebx
+  800ddb:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800dde:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800de3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800de6:	b8 03 00 00 00       	mov    $0x3,%eax
+  800deb:	89 cb                	mov    %ecx,%ebx
+  800ded:	89 cf                	mov    %ecx,%edi
+  800def:	89 ce                	mov    %ecx,%esi
+  800df1:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800df3:	85 c0                	test   %eax,%eax
+  800df5:	7f 08                	jg     800dff <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800df7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dfa:	5b                   	pop    %ebx
+  800dfb:	5e                   	pop    %esi
+  800dfc:	5f                   	pop    %edi
+  800dfd:	5d                   	pop    %ebp
+  800dfe:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800dff:	83 ec 0c             	sub    $0xc,%esp
+  800e02:	50                   	push   %eax
+  800e03:	6a 03                	push   $0x3
+  800e05:	68 43 35 80 00       	push   $0x803543
+  800e0a:	6a 23                	push   $0x23
+  800e0c:	68 60 35 80 00       	push   $0x803560
+  800e11:	e8 89 f5 ff ff       	call   80039f <_panic>
+
+00800e16 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800e16:	55                   	push   %ebp
+  800e17:	89 e5                	mov    %esp,%ebp
+  800e19:	57                   	push   %edi
+  800e1a:	56                   	push   %esi
+  800e1b:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e1c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e21:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e26:	89 d1                	mov    %edx,%ecx
+  800e28:	89 d3                	mov    %edx,%ebx
+  800e2a:	89 d7                	mov    %edx,%edi
+  800e2c:	89 d6                	mov    %edx,%esi
+  800e2e:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800e30:	5b                   	pop    %ebx
+  800e31:	5e                   	pop    %esi
+  800e32:	5f                   	pop    %edi
+  800e33:	5d                   	pop    %ebp
+  800e34:	c3                   	ret
+
+00800e35 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800e35:	55                   	push   %ebp
+  800e36:	89 e5                	mov    %esp,%ebp
+  800e38:	57                   	push   %edi
+  800e39:	56                   	push   %esi
+  800e3a:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e3b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e40:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e45:	89 d1                	mov    %edx,%ecx
+  800e47:	89 d3                	mov    %edx,%ebx
+  800e49:	89 d7                	mov    %edx,%edi
+  800e4b:	89 d6                	mov    %edx,%esi
+  800e4d:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800e4f:	5b                   	pop    %ebx
+  800e50:	5e                   	pop    %esi
+  800e51:	5f                   	pop    %edi
+  800e52:	5d                   	pop    %ebp
+  800e53:	c3                   	ret
+
+00800e54 <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  800e54:	55                   	push   %ebp
+  800e55:	89 e5                	mov    %esp,%ebp
+  800e57:	57                   	push   %edi
+  800e58:	56                   	push   %esi
+  800e59:	53                   	push   %ebx
+  800e5a:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  800e5d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  800e61:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e66:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e69:	b8 14 00 00 00       	mov    $0x14,%eax
+  800e6e:	89 df                	mov    %ebx,%edi
+  800e70:	89 de                	mov    %ebx,%esi
+  800e72:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e74:	85 c0                	test   %eax,%eax
+  800e76:	7f 08                	jg     800e80 <sys_env_set_cow+0x2c>
+}
+  800e78:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e7b:	5b                   	pop    %ebx
+  800e7c:	5e                   	pop    %esi
+  800e7d:	5f                   	pop    %edi
+  800e7e:	5d                   	pop    %ebp
+  800e7f:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e80:	83 ec 0c             	sub    $0xc,%esp
+  800e83:	50                   	push   %eax
+  800e84:	6a 14                	push   $0x14
+  800e86:	68 43 35 80 00       	push   $0x803543
+  800e8b:	6a 23                	push   $0x23
+  800e8d:	68 60 35 80 00       	push   $0x803560
+  800e92:	e8 08 f5 ff ff       	call   80039f <_panic>
+
+00800e97 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800e97:	55                   	push   %ebp
+  800e98:	89 e5                	mov    %esp,%ebp
+  800e9a:	57                   	push   %edi
+  800e9b:	56                   	push   %esi
+  800e9c:	53                   	push   %ebx
+  800e9d:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800ea0:	be 00 00 00 00       	mov    $0x0,%esi
+  800ea5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ea8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eab:	b8 04 00 00 00       	mov    $0x4,%eax
+  800eb0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800eb3:	89 f7                	mov    %esi,%edi
+  800eb5:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800eb7:	85 c0                	test   %eax,%eax
+  800eb9:	7f 08                	jg     800ec3 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  800ebb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ebe:	5b                   	pop    %ebx
+  800ebf:	5e                   	pop    %esi
+  800ec0:	5f                   	pop    %edi
+  800ec1:	5d                   	pop    %ebp
+  800ec2:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ec3:	83 ec 0c             	sub    $0xc,%esp
+  800ec6:	50                   	push   %eax
+  800ec7:	6a 04                	push   $0x4
+  800ec9:	68 43 35 80 00       	push   $0x803543
+  800ece:	6a 23                	push   $0x23
+  800ed0:	68 60 35 80 00       	push   $0x803560
+  800ed5:	e8 c5 f4 ff ff       	call   80039f <_panic>
+
+00800eda <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800eda:	55                   	push   %ebp
+  800edb:	89 e5                	mov    %esp,%ebp
+  800edd:	57                   	push   %edi
+  800ede:	56                   	push   %esi
+  800edf:	53                   	push   %ebx
+  800ee0:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800ee3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ee6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ee9:	b8 05 00 00 00       	mov    $0x5,%eax
+  800eee:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ef1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ef4:	8b 75 18             	mov    0x18(%ebp),%esi
+  800ef7:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ef9:	85 c0                	test   %eax,%eax
+  800efb:	7f 08                	jg     800f05 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  800efd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f00:	5b                   	pop    %ebx
+  800f01:	5e                   	pop    %esi
+  800f02:	5f                   	pop    %edi
+  800f03:	5d                   	pop    %ebp
+  800f04:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f05:	83 ec 0c             	sub    $0xc,%esp
+  800f08:	50                   	push   %eax
+  800f09:	6a 05                	push   $0x5
+  800f0b:	68 43 35 80 00       	push   $0x803543
+  800f10:	6a 23                	push   $0x23
+  800f12:	68 60 35 80 00       	push   $0x803560
+  800f17:	e8 83 f4 ff ff       	call   80039f <_panic>
+
+00800f1c <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800f1c:	55                   	push   %ebp
+  800f1d:	89 e5                	mov    %esp,%ebp
+  800f1f:	57                   	push   %edi
+  800f20:	56                   	push   %esi
+  800f21:	53                   	push   %ebx
+  800f22:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f25:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f2a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f2d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f30:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f35:	89 df                	mov    %ebx,%edi
+  800f37:	89 de                	mov    %ebx,%esi
+  800f39:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f3b:	85 c0                	test   %eax,%eax
+  800f3d:	7f 08                	jg     800f47 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  800f3f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f42:	5b                   	pop    %ebx
+  800f43:	5e                   	pop    %esi
+  800f44:	5f                   	pop    %edi
+  800f45:	5d                   	pop    %ebp
+  800f46:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f47:	83 ec 0c             	sub    $0xc,%esp
+  800f4a:	50                   	push   %eax
+  800f4b:	6a 06                	push   $0x6
+  800f4d:	68 43 35 80 00       	push   $0x803543
+  800f52:	6a 23                	push   $0x23
+  800f54:	68 60 35 80 00       	push   $0x803560
+  800f59:	e8 41 f4 ff ff       	call   80039f <_panic>
+
+00800f5e <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  800f5e:	55                   	push   %ebp
+  800f5f:	89 e5                	mov    %esp,%ebp
+  800f61:	57                   	push   %edi
+  800f62:	56                   	push   %esi
+  800f63:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f64:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f67:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f6a:	b8 11 00 00 00       	mov    $0x11,%eax
+  800f6f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f72:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f75:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f78:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  800f7a:	5b                   	pop    %ebx
+  800f7b:	5e                   	pop    %esi
+  800f7c:	5f                   	pop    %edi
+  800f7d:	5d                   	pop    %ebp
+  800f7e:	c3                   	ret
+
+00800f7f <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  800f7f:	55                   	push   %ebp
+  800f80:	89 e5                	mov    %esp,%ebp
+  800f82:	57                   	push   %edi
+  800f83:	56                   	push   %esi
+  800f84:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f85:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f88:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f8b:	b8 12 00 00 00       	mov    $0x12,%eax
+  800f90:	be 00 00 00 00       	mov    $0x0,%esi
+  800f95:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f98:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f9b:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  800f9d:	5b                   	pop    %ebx
+  800f9e:	5e                   	pop    %esi
+  800f9f:	5f                   	pop    %edi
+  800fa0:	5d                   	pop    %ebp
+  800fa1:	c3                   	ret
+
+00800fa2 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  800fa2:	55                   	push   %ebp
+  800fa3:	89 e5                	mov    %esp,%ebp
+  800fa5:	57                   	push   %edi
+  800fa6:	56                   	push   %esi
+  800fa7:	53                   	push   %ebx
+  800fa8:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800fab:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fb0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fb3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fb6:	b8 16 00 00 00       	mov    $0x16,%eax
+  800fbb:	89 df                	mov    %ebx,%edi
+  800fbd:	89 de                	mov    %ebx,%esi
+  800fbf:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800fc1:	85 c0                	test   %eax,%eax
+  800fc3:	7f 08                	jg     800fcd <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  800fc5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fc8:	5b                   	pop    %ebx
+  800fc9:	5e                   	pop    %esi
+  800fca:	5f                   	pop    %edi
+  800fcb:	5d                   	pop    %ebp
+  800fcc:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800fcd:	83 ec 0c             	sub    $0xc,%esp
+  800fd0:	50                   	push   %eax
+  800fd1:	6a 16                	push   $0x16
+  800fd3:	68 43 35 80 00       	push   $0x803543
+  800fd8:	6a 23                	push   $0x23
+  800fda:	68 60 35 80 00       	push   $0x803560
+  800fdf:	e8 bb f3 ff ff       	call   80039f <_panic>
+
+00800fe4 <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  800fe4:	55                   	push   %ebp
+  800fe5:	89 e5                	mov    %esp,%ebp
+  800fe7:	57                   	push   %edi
+  800fe8:	56                   	push   %esi
+  800fe9:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800fea:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fef:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ff2:	b8 17 00 00 00       	mov    $0x17,%eax
+  800ff7:	89 cb                	mov    %ecx,%ebx
+  800ff9:	89 cf                	mov    %ecx,%edi
+  800ffb:	89 ce                	mov    %ecx,%esi
+  800ffd:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  800fff:	5b                   	pop    %ebx
+  801000:	5e                   	pop    %esi
+  801001:	5f                   	pop    %edi
+  801002:	5d                   	pop    %ebp
+  801003:	c3                   	ret
+
+00801004 <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  801004:	55                   	push   %ebp
+  801005:	89 e5                	mov    %esp,%ebp
+  801007:	57                   	push   %edi
+  801008:	56                   	push   %esi
+  801009:	53                   	push   %ebx
+  80100a:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80100d:	be 00 00 00 00       	mov    $0x0,%esi
+  801012:	8b 55 08             	mov    0x8(%ebp),%edx
+  801015:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801018:	b8 18 00 00 00       	mov    $0x18,%eax
+  80101d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801020:	89 f7                	mov    %esi,%edi
+  801022:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801024:	85 c0                	test   %eax,%eax
+  801026:	7f 08                	jg     801030 <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  801028:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80102b:	5b                   	pop    %ebx
+  80102c:	5e                   	pop    %esi
+  80102d:	5f                   	pop    %edi
+  80102e:	5d                   	pop    %ebp
+  80102f:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801030:	83 ec 0c             	sub    $0xc,%esp
+  801033:	50                   	push   %eax
+  801034:	6a 18                	push   $0x18
+  801036:	68 43 35 80 00       	push   $0x803543
+  80103b:	6a 23                	push   $0x23
+  80103d:	68 60 35 80 00       	push   $0x803560
+  801042:	e8 58 f3 ff ff       	call   80039f <_panic>
+
+00801047 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  801047:	55                   	push   %ebp
+  801048:	89 e5                	mov    %esp,%ebp
+  80104a:	57                   	push   %edi
+  80104b:	56                   	push   %esi
+  80104c:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80104d:	be 00 00 00 00       	mov    $0x0,%esi
+  801052:	8b 55 08             	mov    0x8(%ebp),%edx
+  801055:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801058:	b8 19 00 00 00       	mov    $0x19,%eax
+  80105d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801060:	89 f7                	mov    %esi,%edi
+  801062:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  801064:	5b                   	pop    %ebx
+  801065:	5e                   	pop    %esi
+  801066:	5f                   	pop    %edi
+  801067:	5d                   	pop    %ebp
+  801068:	c3                   	ret
+
+00801069 <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  801069:	55                   	push   %ebp
+  80106a:	89 e5                	mov    %esp,%ebp
+  80106c:	57                   	push   %edi
+  80106d:	56                   	push   %esi
+  80106e:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80106f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801074:	b8 15 00 00 00       	mov    $0x15,%eax
+  801079:	89 d1                	mov    %edx,%ecx
+  80107b:	89 d3                	mov    %edx,%ebx
+  80107d:	89 d7                	mov    %edx,%edi
+  80107f:	89 d6                	mov    %edx,%esi
+  801081:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  801083:	5b                   	pop    %ebx
+  801084:	5e                   	pop    %esi
+  801085:	5f                   	pop    %edi
+  801086:	5d                   	pop    %ebp
+  801087:	c3                   	ret
+
+00801088 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801088:	55                   	push   %ebp
+  801089:	89 e5                	mov    %esp,%ebp
+  80108b:	57                   	push   %edi
+  80108c:	56                   	push   %esi
+  80108d:	53                   	push   %ebx
+  80108e:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801091:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801096:	8b 55 08             	mov    0x8(%ebp),%edx
+  801099:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80109c:	b8 08 00 00 00       	mov    $0x8,%eax
+  8010a1:	89 df                	mov    %ebx,%edi
+  8010a3:	89 de                	mov    %ebx,%esi
+  8010a5:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8010a7:	85 c0                	test   %eax,%eax
+  8010a9:	7f 08                	jg     8010b3 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8010ab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010ae:	5b                   	pop    %ebx
+  8010af:	5e                   	pop    %esi
+  8010b0:	5f                   	pop    %edi
+  8010b1:	5d                   	pop    %ebp
+  8010b2:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8010b3:	83 ec 0c             	sub    $0xc,%esp
+  8010b6:	50                   	push   %eax
+  8010b7:	6a 08                	push   $0x8
+  8010b9:	68 43 35 80 00       	push   $0x803543
+  8010be:	6a 23                	push   $0x23
+  8010c0:	68 60 35 80 00       	push   $0x803560
+  8010c5:	e8 d5 f2 ff ff       	call   80039f <_panic>
+
+008010ca <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8010ca:	55                   	push   %ebp
+  8010cb:	89 e5                	mov    %esp,%ebp
+  8010cd:	57                   	push   %edi
+  8010ce:	56                   	push   %esi
+  8010cf:	53                   	push   %ebx
+  8010d0:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8010d3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010d8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010db:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010de:	b8 09 00 00 00       	mov    $0x9,%eax
+  8010e3:	89 df                	mov    %ebx,%edi
+  8010e5:	89 de                	mov    %ebx,%esi
+  8010e7:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8010e9:	85 c0                	test   %eax,%eax
+  8010eb:	7f 08                	jg     8010f5 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  8010ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010f0:	5b                   	pop    %ebx
+  8010f1:	5e                   	pop    %esi
+  8010f2:	5f                   	pop    %edi
+  8010f3:	5d                   	pop    %ebp
+  8010f4:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8010f5:	83 ec 0c             	sub    $0xc,%esp
+  8010f8:	50                   	push   %eax
+  8010f9:	6a 09                	push   $0x9
+  8010fb:	68 43 35 80 00       	push   $0x803543
+  801100:	6a 23                	push   $0x23
+  801102:	68 60 35 80 00       	push   $0x803560
+  801107:	e8 93 f2 ff ff       	call   80039f <_panic>
+
+0080110c <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  80110c:	55                   	push   %ebp
+  80110d:	89 e5                	mov    %esp,%ebp
+  80110f:	57                   	push   %edi
+  801110:	56                   	push   %esi
+  801111:	53                   	push   %ebx
+  801112:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801115:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80111a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80111d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801120:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801125:	89 df                	mov    %ebx,%edi
+  801127:	89 de                	mov    %ebx,%esi
+  801129:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80112b:	85 c0                	test   %eax,%eax
+  80112d:	7f 08                	jg     801137 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  80112f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801132:	5b                   	pop    %ebx
+  801133:	5e                   	pop    %esi
+  801134:	5f                   	pop    %edi
+  801135:	5d                   	pop    %ebp
+  801136:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801137:	83 ec 0c             	sub    $0xc,%esp
+  80113a:	50                   	push   %eax
+  80113b:	6a 0a                	push   $0xa
+  80113d:	68 43 35 80 00       	push   $0x803543
+  801142:	6a 23                	push   $0x23
+  801144:	68 60 35 80 00       	push   $0x803560
+  801149:	e8 51 f2 ff ff       	call   80039f <_panic>
+
+0080114e <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  80114e:	55                   	push   %ebp
+  80114f:	89 e5                	mov    %esp,%ebp
+  801151:	57                   	push   %edi
+  801152:	56                   	push   %esi
+  801153:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801154:	8b 55 08             	mov    0x8(%ebp),%edx
+  801157:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80115a:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80115f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801162:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801165:	8b 75 18             	mov    0x18(%ebp),%esi
+  801168:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  80116a:	5b                   	pop    %ebx
+  80116b:	5e                   	pop    %esi
+  80116c:	5f                   	pop    %edi
+  80116d:	5d                   	pop    %ebp
+  80116e:	c3                   	ret
+
+0080116f <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  80116f:	55                   	push   %ebp
+  801170:	89 e5                	mov    %esp,%ebp
+  801172:	57                   	push   %edi
+  801173:	56                   	push   %esi
+  801174:	53                   	push   %ebx
+  801175:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801178:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80117d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801180:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801183:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801188:	89 df                	mov    %ebx,%edi
+  80118a:	89 de                	mov    %ebx,%esi
+  80118c:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80118e:	85 c0                	test   %eax,%eax
+  801190:	7f 08                	jg     80119a <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  801192:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801195:	5b                   	pop    %ebx
+  801196:	5e                   	pop    %esi
+  801197:	5f                   	pop    %edi
+  801198:	5d                   	pop    %ebp
+  801199:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80119a:	83 ec 0c             	sub    $0xc,%esp
+  80119d:	50                   	push   %eax
+  80119e:	6a 0d                	push   $0xd
+  8011a0:	68 43 35 80 00       	push   $0x803543
+  8011a5:	6a 23                	push   $0x23
+  8011a7:	68 60 35 80 00       	push   $0x803560
+  8011ac:	e8 ee f1 ff ff       	call   80039f <_panic>
+
+008011b1 <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  8011b1:	55                   	push   %ebp
+  8011b2:	89 e5                	mov    %esp,%ebp
+  8011b4:	57                   	push   %edi
+  8011b5:	56                   	push   %esi
+  8011b6:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8011b7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011bc:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011c1:	89 d1                	mov    %edx,%ecx
+  8011c3:	89 d3                	mov    %edx,%ebx
+  8011c5:	89 d7                	mov    %edx,%edi
+  8011c7:	89 d6                	mov    %edx,%esi
+  8011c9:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8011cb:	5b                   	pop    %ebx
+  8011cc:	5e                   	pop    %esi
+  8011cd:	5f                   	pop    %edi
+  8011ce:	5d                   	pop    %ebp
+  8011cf:	c3                   	ret
+
+008011d0 <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  8011d0:	55                   	push   %ebp
+  8011d1:	89 e5                	mov    %esp,%ebp
+  8011d3:	57                   	push   %edi
+  8011d4:	56                   	push   %esi
+  8011d5:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8011d6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011dc:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8011e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8011e6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011e9:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011ec:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  8011ee:	5b                   	pop    %ebx
+  8011ef:	5e                   	pop    %esi
+  8011f0:	5f                   	pop    %edi
+  8011f1:	5d                   	pop    %ebp
+  8011f2:	c3                   	ret
+
+008011f3 <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  8011f3:	55                   	push   %ebp
+  8011f4:	89 e5                	mov    %esp,%ebp
+  8011f6:	57                   	push   %edi
+  8011f7:	56                   	push   %esi
+  8011f8:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8011f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8011fe:	8b 55 08             	mov    0x8(%ebp),%edx
+  801201:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801204:	b8 10 00 00 00       	mov    $0x10,%eax
+  801209:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80120c:	89 f7                	mov    %esi,%edi
+  80120e:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  801210:	5b                   	pop    %ebx
+  801211:	5e                   	pop    %esi
+  801212:	5f                   	pop    %edi
+  801213:	5d                   	pop    %ebp
+  801214:	c3                   	ret
+
+00801215 <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  801215:	55                   	push   %ebp
+  801216:	89 e5                	mov    %esp,%ebp
+  801218:	57                   	push   %edi
+  801219:	56                   	push   %esi
+  80121a:	53                   	push   %ebx
+  80121b:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  80121e:	80 3d 48 67 80 00 00 	cmpb   $0x0,0x806748
+  801225:	74 41                	je     801268 <sys_batch+0x53>
+  801227:	8b 45 08             	mov    0x8(%ebp),%eax
+  80122a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  80122d:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  801234:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801237:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  80123a:	7d 45                	jge    801281 <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  80123c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80123f:	8b 06                	mov    (%esi),%eax
+  801241:	8b 56 04             	mov    0x4(%esi),%edx
+  801244:	8b 4e 08             	mov    0x8(%esi),%ecx
+  801247:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  80124a:	8b 7e 10             	mov    0x10(%esi),%edi
+  80124d:	8b 76 14             	mov    0x14(%esi),%esi
+  801250:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  801252:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801255:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  801258:	83 c6 1c             	add    $0x1c,%esi
+  80125b:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  80125e:	85 c0                	test   %eax,%eax
+  801260:	78 1f                	js     801281 <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  801262:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  801266:	eb cc                	jmp    801234 <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  801268:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80126d:	b8 13 00 00 00       	mov    $0x13,%eax
+  801272:	8b 55 08             	mov    0x8(%ebp),%edx
+  801275:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801278:	89 df                	mov    %ebx,%edi
+  80127a:	89 de                	mov    %ebx,%esi
+  80127c:	cd 30                	int    $0x30
+  80127e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  801281:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801284:	83 c4 08             	add    $0x8,%esp
+  801287:	5b                   	pop    %ebx
+  801288:	5e                   	pop    %esi
+  801289:	5f                   	pop    %edi
+  80128a:	5d                   	pop    %ebp
+  80128b:	c3                   	ret
+
+0080128c <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  80128c:	55                   	push   %ebp
+  80128d:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  80128f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801292:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  801298:	5d                   	pop    %ebp
+  801299:	c3                   	ret
+
+0080129a <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  80129a:	55                   	push   %ebp
+  80129b:	89 e5                	mov    %esp,%ebp
+  80129d:	56                   	push   %esi
+  80129e:	53                   	push   %ebx
+  80129f:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  8012a2:	8b 1e                	mov    (%esi),%ebx
+  8012a4:	85 db                	test   %ebx,%ebx
+  8012a6:	75 09                	jne    8012b1 <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  8012a8:	89 d8                	mov    %ebx,%eax
+  8012aa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8012ad:	5b                   	pop    %ebx
+  8012ae:	5e                   	pop    %esi
+  8012af:	5d                   	pop    %ebp
+  8012b0:	c3                   	ret
+  b->sb_n = 0;
+  8012b1:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  8012b7:	53                   	push   %ebx
+  8012b8:	8d 46 04             	lea    0x4(%esi),%eax
+  8012bb:	50                   	push   %eax
+  8012bc:	e8 54 ff ff ff       	call   801215 <sys_batch>
+  8012c1:	83 c4 08             	add    $0x8,%esp
+  8012c4:	85 c0                	test   %eax,%eax
+  8012c6:	78 1e                	js     8012e6 <sysbatch_flush+0x4c>
+  if (r < n)
+  8012c8:	39 c3                	cmp    %eax,%ebx
+  8012ca:	7f 07                	jg     8012d3 <sysbatch_flush+0x39>
+  return 0;
+  8012cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012d1:	eb d5                	jmp    8012a8 <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  8012d3:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8012d6:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  8012da:	85 db                	test   %ebx,%ebx
+  8012dc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012e1:	0f 49 d8             	cmovns %eax,%ebx
+  8012e4:	eb c2                	jmp    8012a8 <sysbatch_flush+0xe>
+    return r;
+  8012e6:	89 c3                	mov    %eax,%ebx
+  8012e8:	eb be                	jmp    8012a8 <sysbatch_flush+0xe>
+
+008012ea <sysbatch_add>:
+{
+  8012ea:	55                   	push   %ebp
+  8012eb:	89 e5                	mov    %esp,%ebp
+  8012ed:	53                   	push   %ebx
+  8012ee:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  8012f1:	83 3b 40             	cmpl   $0x40,(%ebx)
+  8012f4:	74 41                	je     801337 <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  8012f6:	8b 03                	mov    (%ebx),%eax
+  8012f8:	8d 50 01             	lea    0x1(%eax),%edx
+  8012fb:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  8012fd:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801300:	01 d8                	add    %ebx,%eax
+  801302:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801305:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  801308:	8b 55 10             	mov    0x10(%ebp),%edx
+  80130b:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  80130e:	8b 55 14             	mov    0x14(%ebp),%edx
+  801311:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  801314:	8b 55 18             	mov    0x18(%ebp),%edx
+  801317:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  80131a:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  80131d:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  801320:	8b 55 20             	mov    0x20(%ebp),%edx
+  801323:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  801326:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  80132d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801332:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801335:	c9                   	leave
+  801336:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  801337:	53                   	push   %ebx
+  801338:	e8 5d ff ff ff       	call   80129a <sysbatch_flush>
+  80133d:	83 c4 04             	add    $0x4,%esp
+  801340:	85 c0                	test   %eax,%eax
+  801342:	79 b2                	jns    8012f6 <sysbatch_add+0xc>
+  801344:	eb ec                	jmp    801332 <sysbatch_add+0x48>
+
+00801346 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801346:	55                   	push   %ebp
+  801347:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801349:	8b 45 08             	mov    0x8(%ebp),%eax
+  80134c:	05 00 00 00 30       	add    $0x30000000,%eax
+  801351:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801354:	5d                   	pop    %ebp
+  801355:	c3                   	ret
+
+00801356 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801356:	55                   	push   %ebp
+  801357:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801359:	8b 45 08             	mov    0x8(%ebp),%eax
+  80135c:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  80135f:	66 b8 00 00          	mov    $0x0,%ax
+  801363:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801368:	5d                   	pop    %ebp
+  801369:	c3                   	ret
+
+0080136a <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80136a:	55                   	push   %ebp
+  80136b:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  80136d:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801372:	eb 02                	jmp    801376 <fd_alloc+0xc>
+  801374:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801376:	89 c2                	mov    %eax,%edx
+  801378:	c1 ea 16             	shr    $0x16,%edx
+  80137b:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801382:	f6 c2 01             	test   $0x1,%dl
+  801385:	74 2b                	je     8013b2 <fd_alloc+0x48>
+  801387:	89 c2                	mov    %eax,%edx
+  801389:	c1 ea 0c             	shr    $0xc,%edx
+  80138c:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801393:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801399:	f6 c1 01             	test   $0x1,%cl
+  80139c:	74 14                	je     8013b2 <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  80139e:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8013a4:	75 ce                	jne    801374 <fd_alloc+0xa>
+  8013a6:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  8013ab:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8013b0:	eb 05                	jmp    8013b7 <fd_alloc+0x4d>
+      return 0;
+  8013b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  8013b7:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013ba:	89 02                	mov    %eax,(%edx)
+}
+  8013bc:	89 c8                	mov    %ecx,%eax
+  8013be:	5d                   	pop    %ebp
+  8013bf:	c3                   	ret
+
+008013c0 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8013c0:	55                   	push   %ebp
+  8013c1:	89 e5                	mov    %esp,%ebp
+  8013c3:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  8013c6:	83 f8 1f             	cmp    $0x1f,%eax
+  8013c9:	77 30                	ja     8013fb <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  8013cb:	c1 e0 0c             	shl    $0xc,%eax
+  8013ce:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8013d3:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8013d9:	f6 c2 01             	test   $0x1,%dl
+  8013dc:	74 24                	je     801402 <fd_lookup+0x42>
+  8013de:	89 c2                	mov    %eax,%edx
+  8013e0:	c1 ea 0c             	shr    $0xc,%edx
+  8013e3:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8013ea:	f6 c2 01             	test   $0x1,%dl
+  8013ed:	74 1a                	je     801409 <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  8013ef:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8013f2:	89 02                	mov    %eax,(%edx)
+  return 0;
+  8013f4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013f9:	5d                   	pop    %ebp
+  8013fa:	c3                   	ret
+    return -E_INVAL;
+  8013fb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801400:	eb f7                	jmp    8013f9 <fd_lookup+0x39>
+    return -E_INVAL;
+  801402:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801407:	eb f0                	jmp    8013f9 <fd_lookup+0x39>
+  801409:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80140e:	eb e9                	jmp    8013f9 <fd_lookup+0x39>
+
+00801410 <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801410:	55                   	push   %ebp
+  801411:	89 e5                	mov    %esp,%ebp
+  801413:	53                   	push   %ebx
+  801414:	83 ec 04             	sub    $0x4,%esp
+  801417:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  80141a:	b8 ec 35 80 00       	mov    $0x8035ec,%eax
+  80141f:	8b 18                	mov    (%eax),%ebx
+  801421:	85 db                	test   %ebx,%ebx
+  801423:	74 0e                	je     801433 <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  801425:	83 c0 04             	add    $0x4,%eax
+  801428:	39 13                	cmp    %edx,(%ebx)
+  80142a:	75 f3                	jne    80141f <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  80142c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801431:	eb 1f                	jmp    801452 <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801433:	a1 44 67 80 00       	mov    0x806744,%eax
+  801438:	8b 40 48             	mov    0x48(%eax),%eax
+  80143b:	83 ec 04             	sub    $0x4,%esp
+  80143e:	52                   	push   %edx
+  80143f:	50                   	push   %eax
+  801440:	68 70 35 80 00       	push   $0x803570
+  801445:	e8 30 f0 ff ff       	call   80047a <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  80144a:	83 c4 10             	add    $0x10,%esp
+  80144d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  801452:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801455:	89 1a                	mov    %ebx,(%edx)
+}
+  801457:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80145a:	c9                   	leave
+  80145b:	c3                   	ret
+
+0080145c <fd_close>:
+{
+  80145c:	55                   	push   %ebp
+  80145d:	89 e5                	mov    %esp,%ebp
+  80145f:	57                   	push   %edi
+  801460:	56                   	push   %esi
+  801461:	53                   	push   %ebx
+  801462:	83 ec 24             	sub    $0x24,%esp
+  801465:	8b 75 08             	mov    0x8(%ebp),%esi
+  801468:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80146b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80146e:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80146f:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801475:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801478:	50                   	push   %eax
+  801479:	e8 42 ff ff ff       	call   8013c0 <fd_lookup>
+  80147e:	89 c3                	mov    %eax,%ebx
+  801480:	83 c4 10             	add    $0x10,%esp
+  801483:	85 c0                	test   %eax,%eax
+  801485:	78 05                	js     80148c <fd_close+0x30>
+      || fd != fd2)
+  801487:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80148a:	74 16                	je     8014a2 <fd_close+0x46>
+    return must_exist ? r : 0;
+  80148c:	89 f8                	mov    %edi,%eax
+  80148e:	84 c0                	test   %al,%al
+  801490:	b8 00 00 00 00       	mov    $0x0,%eax
+  801495:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801498:	89 d8                	mov    %ebx,%eax
+  80149a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80149d:	5b                   	pop    %ebx
+  80149e:	5e                   	pop    %esi
+  80149f:	5f                   	pop    %edi
+  8014a0:	5d                   	pop    %ebp
+  8014a1:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8014a2:	83 ec 08             	sub    $0x8,%esp
+  8014a5:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8014a8:	50                   	push   %eax
+  8014a9:	ff 36                	push   (%esi)
+  8014ab:	e8 60 ff ff ff       	call   801410 <dev_lookup>
+  8014b0:	89 c3                	mov    %eax,%ebx
+  8014b2:	83 c4 10             	add    $0x10,%esp
+  8014b5:	85 c0                	test   %eax,%eax
+  8014b7:	78 1a                	js     8014d3 <fd_close+0x77>
+    if (dev->dev_close)
+  8014b9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8014bc:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  8014bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  8014c4:	85 c0                	test   %eax,%eax
+  8014c6:	74 0b                	je     8014d3 <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  8014c8:	83 ec 0c             	sub    $0xc,%esp
+  8014cb:	56                   	push   %esi
+  8014cc:	ff d0                	call   *%eax
+  8014ce:	89 c3                	mov    %eax,%ebx
+  8014d0:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  8014d3:	83 ec 08             	sub    $0x8,%esp
+  8014d6:	56                   	push   %esi
+  8014d7:	6a 00                	push   $0x0
+  8014d9:	e8 3e fa ff ff       	call   800f1c <sys_page_unmap>
+  return r;
+  8014de:	83 c4 10             	add    $0x10,%esp
+  8014e1:	eb b5                	jmp    801498 <fd_close+0x3c>
+
+008014e3 <close>:
+
+int
+close(int fdnum)
+{
+  8014e3:	55                   	push   %ebp
+  8014e4:	89 e5                	mov    %esp,%ebp
+  8014e6:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8014e9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014ec:	50                   	push   %eax
+  8014ed:	ff 75 08             	push   0x8(%ebp)
+  8014f0:	e8 cb fe ff ff       	call   8013c0 <fd_lookup>
+  8014f5:	83 c4 10             	add    $0x10,%esp
+  8014f8:	85 c0                	test   %eax,%eax
+  8014fa:	79 02                	jns    8014fe <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  8014fc:	c9                   	leave
+  8014fd:	c3                   	ret
+    return fd_close(fd, 1);
+  8014fe:	83 ec 08             	sub    $0x8,%esp
+  801501:	6a 01                	push   $0x1
+  801503:	ff 75 f4             	push   -0xc(%ebp)
+  801506:	e8 51 ff ff ff       	call   80145c <fd_close>
+  80150b:	83 c4 10             	add    $0x10,%esp
+  80150e:	eb ec                	jmp    8014fc <close+0x19>
+
+00801510 <close_all>:
+
+void
+close_all(void)
+{
+  801510:	55                   	push   %ebp
+  801511:	89 e5                	mov    %esp,%ebp
+  801513:	53                   	push   %ebx
+  801514:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  801517:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  80151c:	83 ec 0c             	sub    $0xc,%esp
+  80151f:	53                   	push   %ebx
+  801520:	e8 be ff ff ff       	call   8014e3 <close>
+  for (i = 0; i < MAXFD; i++)
+  801525:	83 c3 01             	add    $0x1,%ebx
+  801528:	83 c4 10             	add    $0x10,%esp
+  80152b:	83 fb 20             	cmp    $0x20,%ebx
+  80152e:	75 ec                	jne    80151c <close_all+0xc>
+}
+  801530:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801533:	c9                   	leave
+  801534:	c3                   	ret
+
+00801535 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801535:	55                   	push   %ebp
+  801536:	89 e5                	mov    %esp,%ebp
+  801538:	57                   	push   %edi
+  801539:	56                   	push   %esi
+  80153a:	53                   	push   %ebx
+  80153b:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80153e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801541:	50                   	push   %eax
+  801542:	ff 75 08             	push   0x8(%ebp)
+  801545:	e8 76 fe ff ff       	call   8013c0 <fd_lookup>
+  80154a:	89 c6                	mov    %eax,%esi
+  80154c:	83 c4 10             	add    $0x10,%esp
+  80154f:	85 c0                	test   %eax,%eax
+  801551:	0f 88 0a 01 00 00    	js     801661 <dup+0x12c>
+    return r;
+  close(newfdnum);
+  801557:	83 ec 0c             	sub    $0xc,%esp
+  80155a:	ff 75 0c             	push   0xc(%ebp)
+  80155d:	e8 81 ff ff ff       	call   8014e3 <close>
+
+  newfd = INDEX2FD(newfdnum);
+  801562:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801565:	c1 e0 0c             	shl    $0xc,%eax
+  801568:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  80156e:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  801571:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801574:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  801577:	89 04 24             	mov    %eax,(%esp)
+  80157a:	e8 d7 fd ff ff       	call   801356 <fd2data>
+  80157f:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  801581:	89 3c 24             	mov    %edi,(%esp)
+  801584:	e8 cd fd ff ff       	call   801356 <fd2data>
+  801589:	83 c4 10             	add    $0x10,%esp
+  80158c:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80158f:	89 f3                	mov    %esi,%ebx
+  801591:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  801597:	89 c6                	mov    %eax,%esi
+  801599:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80159c:	89 cf                	mov    %ecx,%edi
+  80159e:	eb 0c                	jmp    8015ac <dup+0x77>
+  8015a0:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8015a6:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8015ac:	39 fb                	cmp    %edi,%ebx
+  8015ae:	74 7b                	je     80162b <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  8015b0:	89 d8                	mov    %ebx,%eax
+  8015b2:	c1 e8 16             	shr    $0x16,%eax
+  8015b5:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8015bc:	a8 01                	test   $0x1,%al
+  8015be:	74 e0                	je     8015a0 <dup+0x6b>
+  8015c0:	89 d8                	mov    %ebx,%eax
+  8015c2:	c1 e8 0c             	shr    $0xc,%eax
+  8015c5:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8015cc:	f6 c2 01             	test   $0x1,%dl
+  8015cf:	74 cf                	je     8015a0 <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  8015d1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  8015d8:	83 ec 0c             	sub    $0xc,%esp
+  8015db:	25 07 0e 00 00       	and    $0xe07,%eax
+  8015e0:	50                   	push   %eax
+  8015e1:	56                   	push   %esi
+  8015e2:	6a 00                	push   $0x0
+  8015e4:	53                   	push   %ebx
+  8015e5:	6a 00                	push   $0x0
+  8015e7:	e8 ee f8 ff ff       	call   800eda <sys_page_map>
+  8015ec:	83 c4 20             	add    $0x20,%esp
+  8015ef:	85 c0                	test   %eax,%eax
+  8015f1:	79 ad                	jns    8015a0 <dup+0x6b>
+  8015f3:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8015f6:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  8015f8:	83 ec 08             	sub    $0x8,%esp
+  8015fb:	ff 75 d4             	push   -0x2c(%ebp)
+  8015fe:	6a 00                	push   $0x0
+  801600:	e8 17 f9 ff ff       	call   800f1c <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801605:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  801608:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  80160e:	83 c4 10             	add    $0x10,%esp
+  801611:	39 df                	cmp    %ebx,%edi
+  801613:	74 4c                	je     801661 <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  801615:	83 ec 08             	sub    $0x8,%esp
+  801618:	57                   	push   %edi
+  801619:	6a 00                	push   $0x0
+  80161b:	e8 fc f8 ff ff       	call   800f1c <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801620:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  801626:	83 c4 10             	add    $0x10,%esp
+  801629:	eb e6                	jmp    801611 <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80162b:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80162e:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  801631:	89 c8                	mov    %ecx,%eax
+  801633:	c1 e8 0c             	shr    $0xc,%eax
+  801636:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80163d:	83 ec 0c             	sub    $0xc,%esp
+  801640:	25 07 0e 00 00       	and    $0xe07,%eax
+  801645:	50                   	push   %eax
+  801646:	ff 75 d4             	push   -0x2c(%ebp)
+  801649:	6a 00                	push   $0x0
+  80164b:	51                   	push   %ecx
+  80164c:	6a 00                	push   $0x0
+  80164e:	e8 87 f8 ff ff       	call   800eda <sys_page_map>
+  801653:	89 c6                	mov    %eax,%esi
+  801655:	83 c4 20             	add    $0x20,%esp
+  801658:	85 c0                	test   %eax,%eax
+  80165a:	78 9c                	js     8015f8 <dup+0xc3>
+  return newfdnum;
+  80165c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80165f:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  801661:	89 f0                	mov    %esi,%eax
+  801663:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801666:	5b                   	pop    %ebx
+  801667:	5e                   	pop    %esi
+  801668:	5f                   	pop    %edi
+  801669:	5d                   	pop    %ebp
+  80166a:	c3                   	ret
+
+0080166b <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80166b:	55                   	push   %ebp
+  80166c:	89 e5                	mov    %esp,%ebp
+  80166e:	56                   	push   %esi
+  80166f:	53                   	push   %ebx
+  801670:	83 ec 18             	sub    $0x18,%esp
+  801673:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801676:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801679:	50                   	push   %eax
+  80167a:	56                   	push   %esi
+  80167b:	e8 40 fd ff ff       	call   8013c0 <fd_lookup>
+  801680:	83 c4 10             	add    $0x10,%esp
+  801683:	85 c0                	test   %eax,%eax
+  801685:	78 3c                	js     8016c3 <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801687:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  80168a:	83 ec 08             	sub    $0x8,%esp
+  80168d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801690:	50                   	push   %eax
+  801691:	ff 33                	push   (%ebx)
+  801693:	e8 78 fd ff ff       	call   801410 <dev_lookup>
+  801698:	83 c4 10             	add    $0x10,%esp
+  80169b:	85 c0                	test   %eax,%eax
+  80169d:	78 24                	js     8016c3 <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80169f:	8b 43 08             	mov    0x8(%ebx),%eax
+  8016a2:	83 e0 03             	and    $0x3,%eax
+  8016a5:	83 f8 01             	cmp    $0x1,%eax
+  8016a8:	74 20                	je     8016ca <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  8016aa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016ad:	8b 40 08             	mov    0x8(%eax),%eax
+  8016b0:	85 c0                	test   %eax,%eax
+  8016b2:	74 37                	je     8016eb <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  8016b4:	83 ec 04             	sub    $0x4,%esp
+  8016b7:	ff 75 10             	push   0x10(%ebp)
+  8016ba:	ff 75 0c             	push   0xc(%ebp)
+  8016bd:	53                   	push   %ebx
+  8016be:	ff d0                	call   *%eax
+  8016c0:	83 c4 10             	add    $0x10,%esp
+}
+  8016c3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016c6:	5b                   	pop    %ebx
+  8016c7:	5e                   	pop    %esi
+  8016c8:	5d                   	pop    %ebp
+  8016c9:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8016ca:	a1 44 67 80 00       	mov    0x806744,%eax
+  8016cf:	8b 40 48             	mov    0x48(%eax),%eax
+  8016d2:	83 ec 04             	sub    $0x4,%esp
+  8016d5:	56                   	push   %esi
+  8016d6:	50                   	push   %eax
+  8016d7:	68 b1 35 80 00       	push   $0x8035b1
+  8016dc:	e8 99 ed ff ff       	call   80047a <cprintf>
+    return -E_INVAL;
+  8016e1:	83 c4 10             	add    $0x10,%esp
+  8016e4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016e9:	eb d8                	jmp    8016c3 <read+0x58>
+    return -E_NOT_SUPP;
+  8016eb:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016f0:	eb d1                	jmp    8016c3 <read+0x58>
+
+008016f2 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8016f2:	55                   	push   %ebp
+  8016f3:	89 e5                	mov    %esp,%ebp
+  8016f5:	57                   	push   %edi
+  8016f6:	56                   	push   %esi
+  8016f7:	53                   	push   %ebx
+  8016f8:	83 ec 0c             	sub    $0xc,%esp
+  8016fb:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8016fe:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  801701:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801706:	eb 02                	jmp    80170a <readn+0x18>
+  801708:	01 c3                	add    %eax,%ebx
+  80170a:	39 f3                	cmp    %esi,%ebx
+  80170c:	73 21                	jae    80172f <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  80170e:	83 ec 04             	sub    $0x4,%esp
+  801711:	89 f0                	mov    %esi,%eax
+  801713:	29 d8                	sub    %ebx,%eax
+  801715:	50                   	push   %eax
+  801716:	89 d8                	mov    %ebx,%eax
+  801718:	03 45 0c             	add    0xc(%ebp),%eax
+  80171b:	50                   	push   %eax
+  80171c:	57                   	push   %edi
+  80171d:	e8 49 ff ff ff       	call   80166b <read>
+    if (m < 0)
+  801722:	83 c4 10             	add    $0x10,%esp
+  801725:	85 c0                	test   %eax,%eax
+  801727:	78 04                	js     80172d <readn+0x3b>
+      return m;
+    if (m == 0)
+  801729:	75 dd                	jne    801708 <readn+0x16>
+  80172b:	eb 02                	jmp    80172f <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  80172d:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  80172f:	89 d8                	mov    %ebx,%eax
+  801731:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801734:	5b                   	pop    %ebx
+  801735:	5e                   	pop    %esi
+  801736:	5f                   	pop    %edi
+  801737:	5d                   	pop    %ebp
+  801738:	c3                   	ret
+
+00801739 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801739:	55                   	push   %ebp
+  80173a:	89 e5                	mov    %esp,%ebp
+  80173c:	56                   	push   %esi
+  80173d:	53                   	push   %ebx
+  80173e:	83 ec 18             	sub    $0x18,%esp
+  801741:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801744:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801747:	50                   	push   %eax
+  801748:	53                   	push   %ebx
+  801749:	e8 72 fc ff ff       	call   8013c0 <fd_lookup>
+  80174e:	83 c4 10             	add    $0x10,%esp
+  801751:	85 c0                	test   %eax,%eax
+  801753:	78 37                	js     80178c <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801755:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801758:	83 ec 08             	sub    $0x8,%esp
+  80175b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80175e:	50                   	push   %eax
+  80175f:	ff 36                	push   (%esi)
+  801761:	e8 aa fc ff ff       	call   801410 <dev_lookup>
+  801766:	83 c4 10             	add    $0x10,%esp
+  801769:	85 c0                	test   %eax,%eax
+  80176b:	78 1f                	js     80178c <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80176d:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801771:	74 20                	je     801793 <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  801773:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801776:	8b 40 0c             	mov    0xc(%eax),%eax
+  801779:	85 c0                	test   %eax,%eax
+  80177b:	74 37                	je     8017b4 <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  80177d:	83 ec 04             	sub    $0x4,%esp
+  801780:	ff 75 10             	push   0x10(%ebp)
+  801783:	ff 75 0c             	push   0xc(%ebp)
+  801786:	56                   	push   %esi
+  801787:	ff d0                	call   *%eax
+  801789:	83 c4 10             	add    $0x10,%esp
+}
+  80178c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80178f:	5b                   	pop    %ebx
+  801790:	5e                   	pop    %esi
+  801791:	5d                   	pop    %ebp
+  801792:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801793:	a1 44 67 80 00       	mov    0x806744,%eax
+  801798:	8b 40 48             	mov    0x48(%eax),%eax
+  80179b:	83 ec 04             	sub    $0x4,%esp
+  80179e:	53                   	push   %ebx
+  80179f:	50                   	push   %eax
+  8017a0:	68 cd 35 80 00       	push   $0x8035cd
+  8017a5:	e8 d0 ec ff ff       	call   80047a <cprintf>
+    return -E_INVAL;
+  8017aa:	83 c4 10             	add    $0x10,%esp
+  8017ad:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017b2:	eb d8                	jmp    80178c <write+0x53>
+    return -E_NOT_SUPP;
+  8017b4:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017b9:	eb d1                	jmp    80178c <write+0x53>
+
+008017bb <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8017bb:	55                   	push   %ebp
+  8017bc:	89 e5                	mov    %esp,%ebp
+  8017be:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8017c1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017c4:	50                   	push   %eax
+  8017c5:	ff 75 08             	push   0x8(%ebp)
+  8017c8:	e8 f3 fb ff ff       	call   8013c0 <fd_lookup>
+  8017cd:	83 c4 10             	add    $0x10,%esp
+  8017d0:	85 c0                	test   %eax,%eax
+  8017d2:	78 0e                	js     8017e2 <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  8017d4:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8017d7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017da:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  8017dd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017e2:	c9                   	leave
+  8017e3:	c3                   	ret
+
+008017e4 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8017e4:	55                   	push   %ebp
+  8017e5:	89 e5                	mov    %esp,%ebp
+  8017e7:	56                   	push   %esi
+  8017e8:	53                   	push   %ebx
+  8017e9:	83 ec 18             	sub    $0x18,%esp
+  8017ec:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017ef:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017f2:	50                   	push   %eax
+  8017f3:	53                   	push   %ebx
+  8017f4:	e8 c7 fb ff ff       	call   8013c0 <fd_lookup>
+  8017f9:	83 c4 10             	add    $0x10,%esp
+  8017fc:	85 c0                	test   %eax,%eax
+  8017fe:	78 34                	js     801834 <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801800:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801803:	83 ec 08             	sub    $0x8,%esp
+  801806:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801809:	50                   	push   %eax
+  80180a:	ff 36                	push   (%esi)
+  80180c:	e8 ff fb ff ff       	call   801410 <dev_lookup>
+  801811:	83 c4 10             	add    $0x10,%esp
+  801814:	85 c0                	test   %eax,%eax
+  801816:	78 1c                	js     801834 <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801818:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80181c:	74 1d                	je     80183b <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  80181e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801821:	8b 40 18             	mov    0x18(%eax),%eax
+  801824:	85 c0                	test   %eax,%eax
+  801826:	74 34                	je     80185c <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  801828:	83 ec 08             	sub    $0x8,%esp
+  80182b:	ff 75 0c             	push   0xc(%ebp)
+  80182e:	56                   	push   %esi
+  80182f:	ff d0                	call   *%eax
+  801831:	83 c4 10             	add    $0x10,%esp
+}
+  801834:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801837:	5b                   	pop    %ebx
+  801838:	5e                   	pop    %esi
+  801839:	5d                   	pop    %ebp
+  80183a:	c3                   	ret
+            thisenv->env_id, fdnum);
+  80183b:	a1 44 67 80 00       	mov    0x806744,%eax
+  801840:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801843:	83 ec 04             	sub    $0x4,%esp
+  801846:	53                   	push   %ebx
+  801847:	50                   	push   %eax
+  801848:	68 90 35 80 00       	push   $0x803590
+  80184d:	e8 28 ec ff ff       	call   80047a <cprintf>
+    return -E_INVAL;
+  801852:	83 c4 10             	add    $0x10,%esp
+  801855:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80185a:	eb d8                	jmp    801834 <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  80185c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801861:	eb d1                	jmp    801834 <ftruncate+0x50>
+
+00801863 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801863:	55                   	push   %ebp
+  801864:	89 e5                	mov    %esp,%ebp
+  801866:	56                   	push   %esi
+  801867:	53                   	push   %ebx
+  801868:	83 ec 18             	sub    $0x18,%esp
+  80186b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  80186e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801871:	50                   	push   %eax
+  801872:	ff 75 08             	push   0x8(%ebp)
+  801875:	e8 46 fb ff ff       	call   8013c0 <fd_lookup>
+  80187a:	83 c4 10             	add    $0x10,%esp
+  80187d:	85 c0                	test   %eax,%eax
+  80187f:	78 49                	js     8018ca <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801881:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801884:	83 ec 08             	sub    $0x8,%esp
+  801887:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80188a:	50                   	push   %eax
+  80188b:	ff 36                	push   (%esi)
+  80188d:	e8 7e fb ff ff       	call   801410 <dev_lookup>
+  801892:	83 c4 10             	add    $0x10,%esp
+  801895:	85 c0                	test   %eax,%eax
+  801897:	78 31                	js     8018ca <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  801899:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80189c:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8018a0:	74 2f                	je     8018d1 <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  8018a2:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  8018a5:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8018ac:	00 00 00 
+  stat->st_isdir = 0;
+  8018af:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8018b6:	00 00 00 
+  stat->st_dev = dev;
+  8018b9:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  8018bf:	83 ec 08             	sub    $0x8,%esp
+  8018c2:	53                   	push   %ebx
+  8018c3:	56                   	push   %esi
+  8018c4:	ff 50 14             	call   *0x14(%eax)
+  8018c7:	83 c4 10             	add    $0x10,%esp
+}
+  8018ca:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018cd:	5b                   	pop    %ebx
+  8018ce:	5e                   	pop    %esi
+  8018cf:	5d                   	pop    %ebp
+  8018d0:	c3                   	ret
+    return -E_NOT_SUPP;
+  8018d1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8018d6:	eb f2                	jmp    8018ca <fstat+0x67>
+
+008018d8 <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  8018d8:	55                   	push   %ebp
+  8018d9:	89 e5                	mov    %esp,%ebp
+  8018db:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  8018de:	ff 75 0c             	push   0xc(%ebp)
+  8018e1:	ff 75 08             	push   0x8(%ebp)
+  8018e4:	e8 58 07 00 00       	call   802041 <file_stat>
+}
+  8018e9:	c9                   	leave
+  8018ea:	c3                   	ret
+
+008018eb <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  8018eb:	55                   	push   %ebp
+  8018ec:	89 e5                	mov    %esp,%ebp
+  8018ee:	57                   	push   %edi
+  8018ef:	56                   	push   %esi
+  8018f0:	53                   	push   %ebx
+  8018f1:	83 ec 1c             	sub    $0x1c,%esp
+  8018f4:	89 c7                	mov    %eax,%edi
+  8018f6:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8018f9:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8018fc:	e9 a2 00 00 00       	jmp    8019a3 <fsipc_send+0xb8>
+  nfsenvs = 0;
+  801901:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  801908:	00 00 00 
+  80190b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801910:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801915:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  80191a:	be 01 00 00 00       	mov    $0x1,%esi
+  80191f:	eb 0f                	jmp    801930 <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801921:	83 c0 01             	add    $0x1,%eax
+  801924:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801929:	74 49                	je     801974 <fsipc_send+0x89>
+  80192b:	83 f9 07             	cmp    $0x7,%ecx
+  80192e:	7f 50                	jg     801980 <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  801930:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801933:	c1 e2 04             	shl    $0x4,%edx
+  801936:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80193c:	8b 52 50             	mov    0x50(%edx),%edx
+  80193f:	83 fa 01             	cmp    $0x1,%edx
+  801942:	75 dd                	jne    801921 <fsipc_send+0x36>
+  801944:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801947:	c1 e2 04             	shl    $0x4,%edx
+  80194a:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801950:	8b 52 54             	mov    0x54(%edx),%edx
+  801953:	85 d2                	test   %edx,%edx
+  801955:	74 ca                	je     801921 <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801957:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  80195a:	c1 e2 04             	shl    $0x4,%edx
+  80195d:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801963:	8b 52 48             	mov    0x48(%edx),%edx
+  801966:	89 14 8d 20 60 80 00 	mov    %edx,0x806020(,%ecx,4)
+  80196d:	8d 49 01             	lea    0x1(%ecx),%ecx
+  801970:	89 f3                	mov    %esi,%ebx
+  801972:	eb ad                	jmp    801921 <fsipc_send+0x36>
+  801974:	84 db                	test   %bl,%bl
+  801976:	74 38                	je     8019b0 <fsipc_send+0xc5>
+  801978:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+  80197e:	eb 30                	jmp    8019b0 <fsipc_send+0xc5>
+  801980:	84 db                	test   %bl,%bl
+  801982:	74 2c                	je     8019b0 <fsipc_send+0xc5>
+  801984:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+  80198a:	eb 24                	jmp    8019b0 <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  80198c:	50                   	push   %eax
+  80198d:	68 fc 35 80 00       	push   $0x8035fc
+  801992:	6a 34                	push   $0x34
+  801994:	68 06 36 80 00       	push   $0x803606
+  801999:	e8 01 ea ff ff       	call   80039f <_panic>
+    }
+    sys_yield();
+  80199e:	e8 92 f4 ff ff       	call   800e35 <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  8019a3:	83 3d 00 60 80 00 03 	cmpl   $0x3,0x806000
+  8019aa:	0f 8e 51 ff ff ff    	jle    801901 <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  8019b0:	a1 44 67 80 00       	mov    0x806744,%eax
+  8019b5:	8b 70 48             	mov    0x48(%eax),%esi
+  8019b8:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  8019be:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019c3:	8b 0d 00 60 80 00    	mov    0x806000,%ecx
+  8019c9:	39 d9                	cmp    %ebx,%ecx
+  8019cb:	7e d1                	jle    80199e <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  8019cd:	83 ec 0c             	sub    $0xc,%esp
+  8019d0:	ff 75 e0             	push   -0x20(%ebp)
+  8019d3:	6a 07                	push   $0x7
+  8019d5:	ff 75 e4             	push   -0x1c(%ebp)
+  8019d8:	57                   	push   %edi
+  8019d9:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  8019dc:	99                   	cltd
+  8019dd:	f7 f9                	idiv   %ecx
+  8019df:	ff 34 95 20 60 80 00 	push   0x806020(,%edx,4)
+  8019e6:	e8 63 f7 ff ff       	call   80114e <sys_ipc_try_send>
+      if (r == 0)
+  8019eb:	83 c4 20             	add    $0x20,%esp
+  8019ee:	85 c0                	test   %eax,%eax
+  8019f0:	74 0a                	je     8019fc <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  8019f2:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8019f5:	75 95                	jne    80198c <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  8019f7:	83 c3 01             	add    $0x1,%ebx
+  8019fa:	eb c7                	jmp    8019c3 <fsipc_send+0xd8>
+  }
+}
+  8019fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019ff:	5b                   	pop    %ebx
+  801a00:	5e                   	pop    %esi
+  801a01:	5f                   	pop    %edi
+  801a02:	5d                   	pop    %ebp
+  801a03:	c3                   	ret
+
+00801a04 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801a04:	55                   	push   %ebp
+  801a05:	89 e5                	mov    %esp,%ebp
+  801a07:	53                   	push   %ebx
+  801a08:	83 ec 14             	sub    $0x14,%esp
+  801a0b:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  801a0d:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  801a14:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801a19:	ba 00 70 80 00       	mov    $0x807000,%edx
+  801a1e:	e8 c8 fe ff ff       	call   8018eb <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801a23:	6a 00                	push   $0x0
+  801a25:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a28:	50                   	push   %eax
+  801a29:	53                   	push   %ebx
+  801a2a:	6a 00                	push   $0x0
+  801a2c:	e8 26 13 00 00       	call   802d57 <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  801a31:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a34:	c9                   	leave
+  801a35:	c3                   	ret
+
+00801a36 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801a36:	55                   	push   %ebp
+  801a37:	89 e5                	mov    %esp,%ebp
+  801a39:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801a3c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a3f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a42:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.set_size.req_size = newsize;
+  801a47:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a4a:	a3 04 70 80 00       	mov    %eax,0x807004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801a4f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a54:	b8 02 00 00 00       	mov    $0x2,%eax
+  801a59:	e8 a6 ff ff ff       	call   801a04 <fsipc>
+}
+  801a5e:	c9                   	leave
+  801a5f:	c3                   	ret
+
+00801a60 <devfile_flush>:
+{
+  801a60:	55                   	push   %ebp
+  801a61:	89 e5                	mov    %esp,%ebp
+  801a63:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801a66:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a69:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a6c:	a3 00 70 80 00       	mov    %eax,0x807000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801a71:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a76:	b8 06 00 00 00       	mov    $0x6,%eax
+  801a7b:	e8 84 ff ff ff       	call   801a04 <fsipc>
+}
+  801a80:	c9                   	leave
+  801a81:	c3                   	ret
+
+00801a82 <devfile_stat>:
+{
+  801a82:	55                   	push   %ebp
+  801a83:	89 e5                	mov    %esp,%ebp
+  801a85:	53                   	push   %ebx
+  801a86:	83 ec 04             	sub    $0x4,%esp
+  801a89:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801a8c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a8f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a92:	a3 00 70 80 00       	mov    %eax,0x807000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801a97:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a9c:	b8 05 00 00 00       	mov    $0x5,%eax
+  801aa1:	e8 5e ff ff ff       	call   801a04 <fsipc>
+  801aa6:	85 c0                	test   %eax,%eax
+  801aa8:	78 2c                	js     801ad6 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801aaa:	83 ec 08             	sub    $0x8,%esp
+  801aad:	68 00 70 80 00       	push   $0x807000
+  801ab2:	53                   	push   %ebx
+  801ab3:	e8 b0 ef ff ff       	call   800a68 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  801ab8:	a1 80 70 80 00       	mov    0x807080,%eax
+  801abd:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801ac3:	a1 84 70 80 00       	mov    0x807084,%eax
+  801ac8:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801ace:	83 c4 10             	add    $0x10,%esp
+  801ad1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ad6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ad9:	c9                   	leave
+  801ada:	c3                   	ret
+
+00801adb <fsv_alloc>:
+{
+  801adb:	55                   	push   %ebp
+  801adc:	89 e5                	mov    %esp,%ebp
+  801ade:	56                   	push   %esi
+  801adf:	53                   	push   %ebx
+  801ae0:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  801ae2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ae7:	eb 22                	jmp    801b0b <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  801ae9:	83 ec 04             	sub    $0x4,%esp
+  801aec:	6a 00                	push   $0x0
+  801aee:	6a 00                	push   $0x0
+  801af0:	6a 07                	push   $0x7
+  801af2:	50                   	push   %eax
+  801af3:	6a 00                	push   $0x0
+  801af5:	6a 04                	push   $0x4
+  801af7:	68 40 60 80 00       	push   $0x806040
+  801afc:	e8 e9 f7 ff ff       	call   8012ea <sysbatch_add>
+  801b01:	83 c4 20             	add    $0x20,%esp
+  801b04:	85 c0                	test   %eax,%eax
+  801b06:	78 48                	js     801b50 <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  801b08:	83 c3 01             	add    $0x1,%ebx
+  801b0b:	39 f3                	cmp    %esi,%ebx
+  801b0d:	74 31                	je     801b40 <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  801b0f:	89 d8                	mov    %ebx,%eax
+  801b11:	c1 e0 0c             	shl    $0xc,%eax
+  801b14:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801b19:	89 c2                	mov    %eax,%edx
+  801b1b:	c1 ea 16             	shr    $0x16,%edx
+  801b1e:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801b25:	f6 c2 01             	test   $0x1,%dl
+  801b28:	74 bf                	je     801ae9 <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  801b2a:	89 c2                	mov    %eax,%edx
+  801b2c:	c1 ea 0c             	shr    $0xc,%edx
+  801b2f:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801b36:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801b39:	83 fa 03             	cmp    $0x3,%edx
+  801b3c:	75 ab                	jne    801ae9 <fsv_alloc+0xe>
+  801b3e:	eb c8                	jmp    801b08 <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  801b40:	83 ec 0c             	sub    $0xc,%esp
+  801b43:	68 40 60 80 00       	push   $0x806040
+  801b48:	e8 4d f7 ff ff       	call   80129a <sysbatch_flush>
+  801b4d:	83 c4 10             	add    $0x10,%esp
+}
+  801b50:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b53:	5b                   	pop    %ebx
+  801b54:	5e                   	pop    %esi
+  801b55:	5d                   	pop    %ebp
+  801b56:	c3                   	ret
+
+00801b57 <devfile_read>:
+{
+  801b57:	55                   	push   %ebp
+  801b58:	89 e5                	mov    %esp,%ebp
+  801b5a:	57                   	push   %edi
+  801b5b:	56                   	push   %esi
+  801b5c:	53                   	push   %ebx
+  801b5d:	83 ec 3c             	sub    $0x3c,%esp
+  801b60:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  801b63:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  801b69:	77 57                	ja     801bc2 <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801b6b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b6e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b71:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.read.req_n = n;
+  801b76:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801b7c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b81:	b8 03 00 00 00       	mov    $0x3,%eax
+  801b86:	e8 79 fe ff ff       	call   801a04 <fsipc>
+  801b8b:	89 c6                	mov    %eax,%esi
+  801b8d:	85 c0                	test   %eax,%eax
+  801b8f:	78 27                	js     801bb8 <devfile_read+0x61>
+  assert(r <= n);
+  801b91:	39 c3                	cmp    %eax,%ebx
+  801b93:	0f 82 0e 02 00 00    	jb     801da7 <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  801b99:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801b9e:	0f 8f 1c 02 00 00    	jg     801dc0 <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801ba4:	83 ec 04             	sub    $0x4,%esp
+  801ba7:	50                   	push   %eax
+  801ba8:	68 00 70 80 00       	push   $0x807000
+  801bad:	ff 75 0c             	push   0xc(%ebp)
+  801bb0:	e8 39 f0 ff ff       	call   800bee <memmove>
+  return r;
+  801bb5:	83 c4 10             	add    $0x10,%esp
+}
+  801bb8:	89 f0                	mov    %esi,%eax
+  801bba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bbd:	5b                   	pop    %ebx
+  801bbe:	5e                   	pop    %esi
+  801bbf:	5f                   	pop    %edi
+  801bc0:	5d                   	pop    %ebp
+  801bc1:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  801bc2:	b8 01 00 00 00       	mov    $0x1,%eax
+  801bc7:	e8 0f ff ff ff       	call   801adb <fsv_alloc>
+  801bcc:	89 c6                	mov    %eax,%esi
+  801bce:	85 c0                	test   %eax,%eax
+  801bd0:	78 e6                	js     801bb8 <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  801bd2:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bd5:	8b 40 0c             	mov    0xc(%eax),%eax
+  801bd8:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  801bdd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801be0:	8b 40 04             	mov    0x4(%eax),%eax
+  801be3:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  801be8:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  801bee:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801bf5:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801bfa:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801bff:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801c04:	e8 e2 fc ff ff       	call   8018eb <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801c09:	6a 00                	push   $0x0
+  801c0b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801c0e:	50                   	push   %eax
+  801c0f:	68 00 10 c0 9f       	push   $0x9fc01000
+  801c14:	6a 00                	push   $0x0
+  801c16:	e8 3c 11 00 00       	call   802d57 <ipc_recv_pages>
+  801c1b:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  801c1d:	83 c4 10             	add    $0x10,%esp
+  801c20:	85 c0                	test   %eax,%eax
+  801c22:	7e 94                	jle    801bb8 <devfile_read+0x61>
+  assert(r <= n);
+  801c24:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801c27:	39 c3                	cmp    %eax,%ebx
+  801c29:	72 2e                	jb     801c59 <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801c2b:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c2e:	8b 40 04             	mov    0x4(%eax),%eax
+  801c31:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801c36:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  801c39:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801c3c:	c1 e2 0c             	shl    $0xc,%edx
+  801c3f:	39 ca                	cmp    %ecx,%edx
+  801c41:	72 2f                	jb     801c72 <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  801c43:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  801c48:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  801c4b:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  801c4f:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801c54:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  801c57:	eb 52                	jmp    801cab <devfile_read+0x154>
+  assert(r <= n);
+  801c59:	68 11 36 80 00       	push   $0x803611
+  801c5e:	68 18 36 80 00       	push   $0x803618
+  801c63:	68 49 01 00 00       	push   $0x149
+  801c68:	68 06 36 80 00       	push   $0x803606
+  801c6d:	e8 2d e7 ff ff       	call   80039f <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801c72:	68 3c 36 80 00       	push   $0x80363c
+  801c77:	68 18 36 80 00       	push   $0x803618
+  801c7c:	68 4a 01 00 00       	push   $0x14a
+  801c81:	68 06 36 80 00       	push   $0x803606
+  801c86:	e8 14 e7 ff ff       	call   80039f <_panic>
+      memmove(dst + done, src + done, m);
+  801c8b:	83 ec 04             	sub    $0x4,%esp
+  801c8e:	53                   	push   %ebx
+  801c8f:	56                   	push   %esi
+  801c90:	89 f8                	mov    %edi,%eax
+  801c92:	03 45 0c             	add    0xc(%ebp),%eax
+  801c95:	50                   	push   %eax
+  801c96:	e8 53 ef ff ff       	call   800bee <memmove>
+  801c9b:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  801c9e:	01 df                	add    %ebx,%edi
+  801ca0:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801ca3:	39 c7                	cmp    %eax,%edi
+  801ca5:	0f 83 c0 00 00 00    	jae    801d6b <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801cab:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801cae:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  801cb1:	89 f0                	mov    %esi,%eax
+  801cb3:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801cb8:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  801cbd:	29 c3                	sub    %eax,%ebx
+  801cbf:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801cc2:	29 f8                	sub    %edi,%eax
+  801cc4:	39 c3                	cmp    %eax,%ebx
+  801cc6:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  801cc9:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801ccf:	75 ba                	jne    801c8b <devfile_read+0x134>
+  801cd1:	89 f9                	mov    %edi,%ecx
+  801cd3:	03 4d 0c             	add    0xc(%ebp),%ecx
+  801cd6:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  801cd9:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  801cdf:	75 aa                	jne    801c8b <devfile_read+0x134>
+  801ce1:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  801ce7:	77 a2                	ja     801c8b <devfile_read+0x134>
+  801ce9:	89 c8                	mov    %ecx,%eax
+  801ceb:	c1 e8 16             	shr    $0x16,%eax
+  801cee:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801cf5:	a8 01                	test   $0x1,%al
+  801cf7:	74 92                	je     801c8b <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  801cf9:	89 c8                	mov    %ecx,%eax
+  801cfb:	c1 e8 0c             	shr    $0xc,%eax
+  801cfe:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  801d05:	a8 01                	test   $0x1,%al
+  801d07:	74 82                	je     801c8b <devfile_read+0x134>
+  801d09:	a9 02 08 00 00       	test   $0x802,%eax
+  801d0e:	0f 84 77 ff ff ff    	je     801c8b <devfile_read+0x134>
+  801d14:	f6 c4 04             	test   $0x4,%ah
+  801d17:	0f 85 6e ff ff ff    	jne    801c8b <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  801d1d:	a1 44 67 80 00       	mov    0x806744,%eax
+  801d22:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  801d26:	84 c0                	test   %al,%al
+  801d28:	75 17                	jne    801d41 <devfile_read+0x1ea>
+  801d2a:	83 ec 08             	sub    $0x8,%esp
+  801d2d:	6a 01                	push   $0x1
+  801d2f:	6a 00                	push   $0x0
+  801d31:	e8 1e f1 ff ff       	call   800e54 <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  801d36:	83 c4 10             	add    $0x10,%esp
+  801d39:	85 c0                	test   %eax,%eax
+  801d3b:	0f 85 4a ff ff ff    	jne    801c8b <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  801d41:	83 ec 04             	sub    $0x4,%esp
+  801d44:	68 05 08 00 00       	push   $0x805
+  801d49:	ff 75 cc             	push   -0x34(%ebp)
+  801d4c:	6a 00                	push   $0x0
+  801d4e:	56                   	push   %esi
+  801d4f:	6a 00                	push   $0x0
+  801d51:	6a 05                	push   $0x5
+  801d53:	68 40 60 80 00       	push   $0x806040
+  801d58:	e8 8d f5 ff ff       	call   8012ea <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  801d5d:	c1 e8 1f             	shr    $0x1f,%eax
+  801d60:	08 45 cb             	or     %al,-0x35(%ebp)
+  801d63:	83 c4 20             	add    $0x20,%esp
+  801d66:	e9 33 ff ff ff       	jmp    801c9e <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  801d6b:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  801d6e:	83 ec 0c             	sub    $0xc,%esp
+  801d71:	68 40 60 80 00       	push   $0x806040
+  801d76:	e8 1f f5 ff ff       	call   80129a <sysbatch_flush>
+  801d7b:	83 c4 10             	add    $0x10,%esp
+  801d7e:	85 c0                	test   %eax,%eax
+  801d80:	78 06                	js     801d88 <devfile_read+0x231>
+  801d82:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  801d86:	74 14                	je     801d9c <devfile_read+0x245>
+    memmove(dst, src, r);
+  801d88:	83 ec 04             	sub    $0x4,%esp
+  801d8b:	ff 75 d4             	push   -0x2c(%ebp)
+  801d8e:	ff 75 d0             	push   -0x30(%ebp)
+  801d91:	ff 75 0c             	push   0xc(%ebp)
+  801d94:	e8 55 ee ff ff       	call   800bee <memmove>
+  801d99:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  801d9c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d9f:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  801da2:	e9 11 fe ff ff       	jmp    801bb8 <devfile_read+0x61>
+  assert(r <= n);
+  801da7:	68 11 36 80 00       	push   $0x803611
+  801dac:	68 18 36 80 00       	push   $0x803618
+  801db1:	68 1c 01 00 00       	push   $0x11c
+  801db6:	68 06 36 80 00       	push   $0x803606
+  801dbb:	e8 df e5 ff ff       	call   80039f <_panic>
+  assert(r <= PGSIZE);
+  801dc0:	68 2d 36 80 00       	push   $0x80362d
+  801dc5:	68 18 36 80 00       	push   $0x803618
+  801dca:	68 1d 01 00 00       	push   $0x11d
+  801dcf:	68 06 36 80 00       	push   $0x803606
+  801dd4:	e8 c6 e5 ff ff       	call   80039f <_panic>
+
+00801dd9 <devfile_write>:
+{
+  801dd9:	55                   	push   %ebp
+  801dda:	89 e5                	mov    %esp,%ebp
+  801ddc:	57                   	push   %edi
+  801ddd:	56                   	push   %esi
+  801dde:	53                   	push   %ebx
+  801ddf:	83 ec 1c             	sub    $0x1c,%esp
+  801de2:	8b 75 08             	mov    0x8(%ebp),%esi
+  801de5:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  801de8:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  801ded:	77 39                	ja     801e28 <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801def:	8b 56 0c             	mov    0xc(%esi),%edx
+  801df2:	89 15 00 70 80 00    	mov    %edx,0x807000
+  fsipcbuf.write.req_n = n;
+  801df8:	a3 04 70 80 00       	mov    %eax,0x807004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  801dfd:	83 ec 04             	sub    $0x4,%esp
+  801e00:	50                   	push   %eax
+  801e01:	ff 75 0c             	push   0xc(%ebp)
+  801e04:	68 08 70 80 00       	push   $0x807008
+  801e09:	e8 e0 ed ff ff       	call   800bee <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801e0e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e13:	b8 04 00 00 00       	mov    $0x4,%eax
+  801e18:	e8 e7 fb ff ff       	call   801a04 <fsipc>
+  801e1d:	83 c4 10             	add    $0x10,%esp
+}
+  801e20:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e23:	5b                   	pop    %ebx
+  801e24:	5e                   	pop    %esi
+  801e25:	5f                   	pop    %edi
+  801e26:	5d                   	pop    %ebp
+  801e27:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  801e28:	ba 00 00 10 00       	mov    $0x100000,%edx
+  801e2d:	39 d0                	cmp    %edx,%eax
+  801e2f:	89 d3                	mov    %edx,%ebx
+  801e31:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  801e34:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  801e3a:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  801e3d:	83 c7 01             	add    $0x1,%edi
+  801e40:	89 f8                	mov    %edi,%eax
+  801e42:	e8 94 fc ff ff       	call   801adb <fsv_alloc>
+  801e47:	85 c0                	test   %eax,%eax
+  801e49:	78 d5                	js     801e20 <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  801e4b:	83 ec 04             	sub    $0x4,%esp
+  801e4e:	53                   	push   %ebx
+  801e4f:	ff 75 0c             	push   0xc(%ebp)
+  801e52:	68 00 10 c0 9f       	push   $0x9fc01000
+  801e57:	e8 92 ed ff ff       	call   800bee <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  801e5c:	8b 46 0c             	mov    0xc(%esi),%eax
+  801e5f:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  801e64:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  801e6a:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801e71:	89 f9                	mov    %edi,%ecx
+  801e73:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801e78:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801e7d:	e8 69 fa ff ff       	call   8018eb <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801e82:	6a 00                	push   $0x0
+  801e84:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801e87:	50                   	push   %eax
+  801e88:	6a 00                	push   $0x0
+  801e8a:	6a 00                	push   $0x0
+  801e8c:	e8 c6 0e 00 00       	call   802d57 <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  801e91:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  801e94:	eb 8a                	jmp    801e20 <devfile_write+0x47>
+
+00801e96 <open>:
+{
+  801e96:	55                   	push   %ebp
+  801e97:	89 e5                	mov    %esp,%ebp
+  801e99:	56                   	push   %esi
+  801e9a:	53                   	push   %ebx
+  801e9b:	83 ec 1c             	sub    $0x1c,%esp
+  801e9e:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801ea1:	56                   	push   %esi
+  801ea2:	e8 86 eb ff ff       	call   800a2d <strlen>
+  801ea7:	83 c4 10             	add    $0x10,%esp
+  801eaa:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801eaf:	7f 6c                	jg     801f1d <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  801eb1:	83 ec 0c             	sub    $0xc,%esp
+  801eb4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801eb7:	50                   	push   %eax
+  801eb8:	e8 ad f4 ff ff       	call   80136a <fd_alloc>
+  801ebd:	89 c3                	mov    %eax,%ebx
+  801ebf:	83 c4 10             	add    $0x10,%esp
+  801ec2:	85 c0                	test   %eax,%eax
+  801ec4:	78 3c                	js     801f02 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801ec6:	83 ec 08             	sub    $0x8,%esp
+  801ec9:	56                   	push   %esi
+  801eca:	68 00 70 80 00       	push   $0x807000
+  801ecf:	e8 94 eb ff ff       	call   800a68 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801ed4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ed7:	a3 00 74 80 00       	mov    %eax,0x807400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801edc:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801edf:	b8 01 00 00 00       	mov    $0x1,%eax
+  801ee4:	e8 1b fb ff ff       	call   801a04 <fsipc>
+  801ee9:	89 c3                	mov    %eax,%ebx
+  801eeb:	83 c4 10             	add    $0x10,%esp
+  801eee:	85 c0                	test   %eax,%eax
+  801ef0:	78 19                	js     801f0b <open+0x75>
+  return fd2num(fd);
+  801ef2:	83 ec 0c             	sub    $0xc,%esp
+  801ef5:	ff 75 f4             	push   -0xc(%ebp)
+  801ef8:	e8 49 f4 ff ff       	call   801346 <fd2num>
+  801efd:	89 c3                	mov    %eax,%ebx
+  801eff:	83 c4 10             	add    $0x10,%esp
+}
+  801f02:	89 d8                	mov    %ebx,%eax
+  801f04:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f07:	5b                   	pop    %ebx
+  801f08:	5e                   	pop    %esi
+  801f09:	5d                   	pop    %ebp
+  801f0a:	c3                   	ret
+    fd_close(fd, 0);
+  801f0b:	83 ec 08             	sub    $0x8,%esp
+  801f0e:	6a 00                	push   $0x0
+  801f10:	ff 75 f4             	push   -0xc(%ebp)
+  801f13:	e8 44 f5 ff ff       	call   80145c <fd_close>
+    return r;
+  801f18:	83 c4 10             	add    $0x10,%esp
+  801f1b:	eb e5                	jmp    801f02 <open+0x6c>
+    return -E_BAD_PATH;
+  801f1d:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801f22:	eb de                	jmp    801f02 <open+0x6c>
+
+00801f24 <open_read>:
+{
+  801f24:	55                   	push   %ebp
+  801f25:	89 e5                	mov    %esp,%ebp
+  801f27:	57                   	push   %edi
+  801f28:	56                   	push   %esi
+  801f29:	53                   	push   %ebx
+  801f2a:	83 ec 28             	sub    $0x28,%esp
+  801f2d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  801f30:	57                   	push   %edi
+  801f31:	e8 f7 ea ff ff       	call   800a2d <strlen>
+  801f36:	83 c4 10             	add    $0x10,%esp
+  801f39:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801f3e:	0f 87 f6 00 00 00    	ja     80203a <open_read+0x116>
+  801f44:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  801f46:	83 ec 0c             	sub    $0xc,%esp
+  801f49:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801f4c:	50                   	push   %eax
+  801f4d:	e8 18 f4 ff ff       	call   80136a <fd_alloc>
+  801f52:	89 c3                	mov    %eax,%ebx
+  801f54:	83 c4 10             	add    $0x10,%esp
+  801f57:	85 c0                	test   %eax,%eax
+  801f59:	0f 88 b2 00 00 00    	js     802011 <open_read+0xed>
+  strcpy(req->req_buf, path);
+  801f5f:	83 ec 08             	sub    $0x8,%esp
+  801f62:	57                   	push   %edi
+  801f63:	68 e4 70 80 00       	push   $0x8070e4
+  801f68:	e8 fb ea ff ff       	call   800a68 <strcpy>
+  req->req_nops = 2;
+  801f6d:	c7 05 00 70 80 00 02 	movl   $0x2,0x807000
+  801f74:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  801f77:	c7 05 04 70 80 00 01 	movl   $0x1,0x807004
+  801f7e:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  801f81:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f84:	a3 10 70 80 00       	mov    %eax,0x807010
+  req->req_ops[0].op_buf = 0;
+  801f89:	c7 05 18 70 80 00 00 	movl   $0x0,0x807018
+  801f90:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  801f93:	c7 05 20 70 80 00 04 	movl   $0x4,0x807020
+  801f9a:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  801f9d:	c7 05 24 70 80 00 01 	movl   $0x1,0x807024
+  801fa4:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  801fa7:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  801fac:	29 f0                	sub    %esi,%eax
+  801fae:	3b 45 14             	cmp    0x14(%ebp),%eax
+  801fb1:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  801fb5:	a3 2c 70 80 00       	mov    %eax,0x80702c
+  req->req_ops[1].op_offset = 0;
+  801fba:	c7 05 30 70 80 00 00 	movl   $0x0,0x807030
+  801fc1:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  801fc4:	83 c6 01             	add    $0x1,%esi
+  801fc7:	89 35 34 70 80 00    	mov    %esi,0x807034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  801fcd:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801fd0:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801fd5:	e8 2a fa ff ff       	call   801a04 <fsipc>
+  801fda:	89 c3                	mov    %eax,%ebx
+  801fdc:	83 c4 10             	add    $0x10,%esp
+  801fdf:	83 f8 01             	cmp    $0x1,%eax
+  801fe2:	7e 37                	jle    80201b <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  801fe4:	a1 38 70 80 00       	mov    0x807038,%eax
+  801fe9:	8b 55 18             	mov    0x18(%ebp),%edx
+  801fec:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  801fee:	83 ec 04             	sub    $0x4,%esp
+  801ff1:	50                   	push   %eax
+  801ff2:	81 c6 e4 70 80 00    	add    $0x8070e4,%esi
+  801ff8:	56                   	push   %esi
+  801ff9:	ff 75 10             	push   0x10(%ebp)
+  801ffc:	e8 ed eb ff ff       	call   800bee <memmove>
+  return fd2num(fd);
+  802001:	83 c4 04             	add    $0x4,%esp
+  802004:	ff 75 e4             	push   -0x1c(%ebp)
+  802007:	e8 3a f3 ff ff       	call   801346 <fd2num>
+  80200c:	89 c3                	mov    %eax,%ebx
+  80200e:	83 c4 10             	add    $0x10,%esp
+}
+  802011:	89 d8                	mov    %ebx,%eax
+  802013:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802016:	5b                   	pop    %ebx
+  802017:	5e                   	pop    %esi
+  802018:	5f                   	pop    %edi
+  802019:	5d                   	pop    %ebp
+  80201a:	c3                   	ret
+    fd_close(fd, 0);
+  80201b:	83 ec 08             	sub    $0x8,%esp
+  80201e:	6a 00                	push   $0x0
+  802020:	ff 75 e4             	push   -0x1c(%ebp)
+  802023:	e8 34 f4 ff ff       	call   80145c <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  802028:	83 c4 10             	add    $0x10,%esp
+  80202b:	85 db                	test   %ebx,%ebx
+  80202d:	78 e2                	js     802011 <open_read+0xed>
+  80202f:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  802032:	8b 9b 1c 70 80 00    	mov    0x80701c(%ebx),%ebx
+  802038:	eb d7                	jmp    802011 <open_read+0xed>
+    return -E_BAD_PATH;
+  80203a:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80203f:	eb d0                	jmp    802011 <open_read+0xed>
+
+00802041 <file_stat>:
+{
+  802041:	55                   	push   %ebp
+  802042:	89 e5                	mov    %esp,%ebp
+  802044:	57                   	push   %edi
+  802045:	56                   	push   %esi
+  802046:	53                   	push   %ebx
+  802047:	83 ec 18             	sub    $0x18,%esp
+  80204a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80204d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  802050:	57                   	push   %edi
+  802051:	e8 d7 e9 ff ff       	call   800a2d <strlen>
+  802056:	83 c4 10             	add    $0x10,%esp
+  802059:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80205e:	0f 8f c7 00 00 00    	jg     80212b <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  802064:	83 ec 0c             	sub    $0xc,%esp
+  802067:	57                   	push   %edi
+  802068:	e8 c0 e9 ff ff       	call   800a2d <strlen>
+  80206d:	8d 58 04             	lea    0x4(%eax),%ebx
+  802070:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  802073:	83 c4 08             	add    $0x8,%esp
+  802076:	57                   	push   %edi
+  802077:	68 e4 70 80 00       	push   $0x8070e4
+  80207c:	e8 e7 e9 ff ff       	call   800a68 <strcpy>
+  req->req_nops = 2;
+  802081:	c7 05 00 70 80 00 02 	movl   $0x2,0x807000
+  802088:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  80208b:	c7 05 04 70 80 00 02 	movl   $0x2,0x807004
+  802092:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  802095:	c7 05 10 70 80 00 00 	movl   $0x0,0x807010
+  80209c:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  80209f:	c7 05 18 70 80 00 00 	movl   $0x0,0x807018
+  8020a6:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  8020a9:	c7 05 20 70 80 00 03 	movl   $0x3,0x807020
+  8020b0:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  8020b3:	c7 05 24 70 80 00 01 	movl   $0x1,0x807024
+  8020ba:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  8020bd:	89 1d 34 70 80 00    	mov    %ebx,0x807034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  8020c3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020c8:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8020cd:	e8 32 f9 ff ff       	call   801a04 <fsipc>
+  8020d2:	83 c4 10             	add    $0x10,%esp
+  8020d5:	83 f8 01             	cmp    $0x1,%eax
+  8020d8:	7e 42                	jle    80211c <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  8020da:	81 c3 e4 70 80 00    	add    $0x8070e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  8020e0:	83 ec 08             	sub    $0x8,%esp
+  8020e3:	53                   	push   %ebx
+  8020e4:	56                   	push   %esi
+  8020e5:	e8 7e e9 ff ff       	call   800a68 <strcpy>
+  st->st_size = ret->ret_size;
+  8020ea:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  8020f0:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  8020f6:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  8020fc:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  802102:	c7 86 88 00 00 00 04 	movl   $0x804004,0x88(%esi)
+  802109:	40 80 00 
+  return 0;
+  80210c:	83 c4 10             	add    $0x10,%esp
+  80210f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802114:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802117:	5b                   	pop    %ebx
+  802118:	5e                   	pop    %esi
+  802119:	5f                   	pop    %edi
+  80211a:	5d                   	pop    %ebp
+  80211b:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  80211c:	85 c0                	test   %eax,%eax
+  80211e:	78 f4                	js     802114 <file_stat+0xd3>
+  802120:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802123:	8b 80 1c 70 80 00    	mov    0x80701c(%eax),%eax
+  802129:	eb e9                	jmp    802114 <file_stat+0xd3>
+    return -E_BAD_PATH;
+  80212b:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802130:	eb e2                	jmp    802114 <file_stat+0xd3>
+
+00802132 <read_map>:
+{
+  802132:	55                   	push   %ebp
+  802133:	89 e5                	mov    %esp,%ebp
+  802135:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802138:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80213b:	50                   	push   %eax
+  80213c:	ff 75 08             	push   0x8(%ebp)
+  80213f:	e8 7c f2 ff ff       	call   8013c0 <fd_lookup>
+  802144:	83 c4 10             	add    $0x10,%esp
+  802147:	85 c0                	test   %eax,%eax
+  802149:	78 2a                	js     802175 <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  80214b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80214e:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  802154:	39 08                	cmp    %ecx,(%eax)
+  802156:	75 1f                	jne    802177 <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  802158:	8b 40 0c             	mov    0xc(%eax),%eax
+  80215b:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.read_map.req_offset = offset;
+  802160:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802163:	a3 04 70 80 00       	mov    %eax,0x807004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  802168:	8b 55 10             	mov    0x10(%ebp),%edx
+  80216b:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802170:	e8 8f f8 ff ff       	call   801a04 <fsipc>
+}
+  802175:	c9                   	leave
+  802176:	c3                   	ret
+    return -E_INVAL;
+  802177:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80217c:	eb f7                	jmp    802175 <read_map+0x43>
+
+0080217e <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80217e:	55                   	push   %ebp
+  80217f:	89 e5                	mov    %esp,%ebp
+  802181:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  802184:	ba 00 00 00 00       	mov    $0x0,%edx
+  802189:	b8 08 00 00 00       	mov    $0x8,%eax
+  80218e:	e8 71 f8 ff ff       	call   801a04 <fsipc>
+}
+  802193:	c9                   	leave
+  802194:	c3                   	ret
+
+00802195 <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  802195:	55                   	push   %ebp
+  802196:	89 e5                	mov    %esp,%ebp
+  802198:	57                   	push   %edi
+  802199:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  80219a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80219d:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.stats.req_bio_sched = 0;
+  8021a2:	c7 05 04 70 80 00 00 	movl   $0x0,0x807004
+  8021a9:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  8021ac:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  8021b3:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  8021b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021bb:	b8 09 00 00 00       	mov    $0x9,%eax
+  8021c0:	e8 3f f8 ff ff       	call   801a04 <fsipc>
+  8021c5:	85 c0                	test   %eax,%eax
+  8021c7:	78 14                	js     8021dd <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  8021c9:	be 00 70 80 00       	mov    $0x807000,%esi
+  8021ce:	b9 16 00 00 00       	mov    $0x16,%ecx
+  8021d3:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8021d6:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  8021d8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021dd:	5e                   	pop    %esi
+  8021de:	5f                   	pop    %edi
+  8021df:	5d                   	pop    %ebp
+  8021e0:	c3                   	ret
+
+008021e1 <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  8021e1:	55                   	push   %ebp
+  8021e2:	89 e5                	mov    %esp,%ebp
+  8021e4:	53                   	push   %ebx
+  8021e5:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  8021e8:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8021eb:	50                   	push   %eax
+  8021ec:	6a 00                	push   $0x0
+  8021ee:	e8 a2 ff ff ff       	call   802195 <fs_stats>
+  8021f3:	83 c4 10             	add    $0x10,%esp
+  8021f6:	85 c0                	test   %eax,%eax
+  8021f8:	78 28                	js     802222 <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  8021fa:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  8021fd:	83 ec 08             	sub    $0x8,%esp
+  802200:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802203:	50                   	push   %eax
+  802204:	6a 20                	push   $0x20
+  802206:	e8 8a ff ff ff       	call   802195 <fs_stats>
+  80220b:	83 c4 10             	add    $0x10,%esp
+  80220e:	85 c0                	test   %eax,%eax
+  802210:	78 10                	js     802222 <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  802212:	83 ec 08             	sub    $0x8,%esp
+  802215:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802218:	50                   	push   %eax
+  802219:	53                   	push   %ebx
+  80221a:	e8 76 ff ff ff       	call   802195 <fs_stats>
+  80221f:	83 c4 10             	add    $0x10,%esp
+}
+  802222:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802225:	c9                   	leave
+  802226:	c3                   	ret
+
+00802227 <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  802227:	55                   	push   %ebp
+  802228:	89 e5                	mov    %esp,%ebp
+  80222a:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  80222d:	c7 05 00 70 80 00 00 	movl   $0x0,0x807000
+  802234:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  802237:	8b 45 08             	mov    0x8(%ebp),%eax
+  80223a:	a3 04 70 80 00       	mov    %eax,0x807004
+  fsipcbuf.stats.req_dcache = 0;
+  80223f:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  802246:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  802249:	ba 00 00 00 00       	mov    $0x0,%edx
+  80224e:	b8 09 00 00 00       	mov    $0x9,%eax
+  802253:	e8 ac f7 ff ff       	call   801a04 <fsipc>
+}
+  802258:	c9                   	leave
+  802259:	c3                   	ret
+
+0080225a <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  80225a:	55                   	push   %ebp
+  80225b:	89 e5                	mov    %esp,%ebp
+  80225d:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  802260:	c7 05 00 70 80 00 00 	movl   $0x0,0x807000
+  802267:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  80226a:	c7 05 04 70 80 00 00 	movl   $0x0,0x807004
+  802271:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  802274:	8b 45 08             	mov    0x8(%ebp),%eax
+  802277:	a3 08 70 80 00       	mov    %eax,0x807008
+  return fsipc(FSREQ_STATS, NULL);
+  80227c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802281:	b8 09 00 00 00       	mov    $0x9,%eax
+  802286:	e8 79 f7 ff ff       	call   801a04 <fsipc>
+}
+  80228b:	c9                   	leave
+  80228c:	c3                   	ret
+
+0080228d <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  80228d:	55                   	push   %ebp
+  80228e:	89 e5                	mov    %esp,%ebp
+  802290:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802293:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802296:	50                   	push   %eax
+  802297:	ff 75 08             	push   0x8(%ebp)
+  80229a:	e8 21 f1 ff ff       	call   8013c0 <fd_lookup>
+  80229f:	83 c4 10             	add    $0x10,%esp
+  8022a2:	85 c0                	test   %eax,%eax
+  8022a4:	78 34                	js     8022da <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  8022a6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022a9:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  8022af:	39 08                	cmp    %ecx,(%eax)
+  8022b1:	75 29                	jne    8022dc <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  8022b3:	8b 40 0c             	mov    0xc(%eax),%eax
+  8022b6:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.fallocate.req_offset = offset;
+  8022bb:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022be:	a3 04 70 80 00       	mov    %eax,0x807004
+  fsipcbuf.fallocate.req_len = len;
+  8022c3:	8b 45 10             	mov    0x10(%ebp),%eax
+  8022c6:	a3 08 70 80 00       	mov    %eax,0x807008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  8022cb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022d0:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8022d5:	e8 2a f7 ff ff       	call   801a04 <fsipc>
+}
+  8022da:	c9                   	leave
+  8022db:	c3                   	ret
+    return -E_INVAL;
+  8022dc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8022e1:	eb f7                	jmp    8022da <fallocate+0x4d>
+
+008022e3 <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  8022e3:	55                   	push   %ebp
+  8022e4:	89 e5                	mov    %esp,%ebp
+  8022e6:	57                   	push   %edi
+  8022e7:	56                   	push   %esi
+  8022e8:	53                   	push   %ebx
+  8022e9:	83 ec 24             	sub    $0x24,%esp
+  8022ec:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8022ef:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8022f2:	50                   	push   %eax
+  8022f3:	ff 75 08             	push   0x8(%ebp)
+  8022f6:	e8 c5 f0 ff ff       	call   8013c0 <fd_lookup>
+  8022fb:	83 c4 10             	add    $0x10,%esp
+  8022fe:	85 c0                	test   %eax,%eax
+  802300:	78 66                	js     802368 <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  802302:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802305:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  80230b:	39 08                	cmp    %ecx,(%eax)
+  80230d:	75 61                	jne    802370 <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  80230f:	85 f6                	test   %esi,%esi
+  802311:	7e 50                	jle    802363 <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  802313:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  802318:	39 de                	cmp    %ebx,%esi
+  80231a:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  80231d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802320:	8b 40 0c             	mov    0xc(%eax),%eax
+  802323:	a3 00 70 80 00       	mov    %eax,0x807000
+    fsipcbuf.prefetch.req_n = m;
+  802328:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  80232e:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  802335:	83 ec 04             	sub    $0x4,%esp
+  802338:	57                   	push   %edi
+  802339:	ff 75 0c             	push   0xc(%ebp)
+  80233c:	68 08 70 80 00       	push   $0x807008
+  802341:	e8 a8 e8 ff ff       	call   800bee <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  802346:	ba 00 00 00 00       	mov    $0x0,%edx
+  80234b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802350:	e8 af f6 ff ff       	call   801a04 <fsipc>
+  802355:	83 c4 10             	add    $0x10,%esp
+  802358:	85 c0                	test   %eax,%eax
+  80235a:	78 0c                	js     802368 <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  80235c:	01 7d 0c             	add    %edi,0xc(%ebp)
+  80235f:	29 de                	sub    %ebx,%esi
+  802361:	eb ac                	jmp    80230f <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  802363:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802368:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80236b:	5b                   	pop    %ebx
+  80236c:	5e                   	pop    %esi
+  80236d:	5f                   	pop    %edi
+  80236e:	5d                   	pop    %ebp
+  80236f:	c3                   	ret
+    return -E_INVAL;
+  802370:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802375:	eb f1                	jmp    802368 <prefetch+0x85>
+
+00802377 <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  802377:	55                   	push   %ebp
+  802378:	89 e5                	mov    %esp,%ebp
+  80237a:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  80237d:	50                   	push   %eax
+  80237e:	e8 d3 ef ff ff       	call   801356 <fd2data>
+  802383:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  802388:	c9                   	leave
+  802389:	c3                   	ret
+
+0080238a <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80238a:	55                   	push   %ebp
+  80238b:	89 e5                	mov    %esp,%ebp
+  80238d:	56                   	push   %esi
+  80238e:	53                   	push   %ebx
+  80238f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  802392:	83 ec 0c             	sub    $0xc,%esp
+  802395:	ff 75 08             	push   0x8(%ebp)
+  802398:	e8 b9 ef ff ff       	call   801356 <fd2data>
+  80239d:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  80239f:	83 c4 08             	add    $0x8,%esp
+  8023a2:	68 68 36 80 00       	push   $0x803668
+  8023a7:	53                   	push   %ebx
+  8023a8:	e8 bb e6 ff ff       	call   800a68 <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  8023ad:	8b 46 04             	mov    0x4(%esi),%eax
+  8023b0:	2b 06                	sub    (%esi),%eax
+  8023b2:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  8023b8:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8023bf:	00 00 00 
+  stat->st_dev = &devpipe;
+  8023c2:	c7 83 88 00 00 00 20 	movl   $0x804020,0x88(%ebx)
+  8023c9:	40 80 00 
+  return 0;
+}
+  8023cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023d1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023d4:	5b                   	pop    %ebx
+  8023d5:	5e                   	pop    %esi
+  8023d6:	5d                   	pop    %ebp
+  8023d7:	c3                   	ret
+
+008023d8 <pipe_wakeup>:
+{
+  8023d8:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  8023da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023df:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  8023e2:	85 c0                	test   %eax,%eax
+  8023e4:	75 01                	jne    8023e7 <pipe_wakeup+0xf>
+  8023e6:	c3                   	ret
+{
+  8023e7:	55                   	push   %ebp
+  8023e8:	89 e5                	mov    %esp,%ebp
+  8023ea:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  8023ed:	6a 00                	push   $0x0
+  8023ef:	68 00 00 c0 ee       	push   $0xeec00000
+  8023f4:	52                   	push   %edx
+  8023f5:	e8 f9 ed ff ff       	call   8011f3 <sys_chan_wakeup>
+  8023fa:	83 c4 10             	add    $0x10,%esp
+}
+  8023fd:	c9                   	leave
+  8023fe:	c3                   	ret
+
+008023ff <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8023ff:	55                   	push   %ebp
+  802400:	89 e5                	mov    %esp,%ebp
+  802402:	57                   	push   %edi
+  802403:	56                   	push   %esi
+  802404:	53                   	push   %ebx
+  802405:	83 ec 18             	sub    $0x18,%esp
+  802408:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  80240b:	57                   	push   %edi
+  80240c:	e8 45 ef ff ff       	call   801356 <fd2data>
+  802411:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  802413:	83 c4 10             	add    $0x10,%esp
+  802416:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  80241a:	74 2a                	je     802446 <devpipe_close+0x47>
+  80241c:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  802421:	89 f8                	mov    %edi,%eax
+  802423:	e8 4f ff ff ff       	call   802377 <pipe_ring>
+  802428:	83 ec 08             	sub    $0x8,%esp
+  80242b:	01 d8                	add    %ebx,%eax
+  80242d:	50                   	push   %eax
+  80242e:	6a 00                	push   $0x0
+  802430:	e8 e7 ea ff ff       	call   800f1c <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  802435:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80243b:	83 c4 10             	add    $0x10,%esp
+  80243e:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  802444:	75 db                	jne    802421 <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  802446:	83 ec 08             	sub    $0x8,%esp
+  802449:	57                   	push   %edi
+  80244a:	6a 00                	push   $0x0
+  80244c:	e8 cb ea ff ff       	call   800f1c <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  802451:	83 c4 10             	add    $0x10,%esp
+  802454:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  802458:	75 13                	jne    80246d <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  80245a:	83 ec 08             	sub    $0x8,%esp
+  80245d:	56                   	push   %esi
+  80245e:	6a 00                	push   $0x0
+  802460:	e8 b7 ea ff ff       	call   800f1c <sys_page_unmap>
+}
+  802465:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802468:	5b                   	pop    %ebx
+  802469:	5e                   	pop    %esi
+  80246a:	5f                   	pop    %edi
+  80246b:	5d                   	pop    %ebp
+  80246c:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  80246d:	8d 56 04             	lea    0x4(%esi),%edx
+  802470:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802473:	e8 60 ff ff ff       	call   8023d8 <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802478:	8d 46 30             	lea    0x30(%esi),%eax
+  80247b:	89 f2                	mov    %esi,%edx
+  80247d:	e8 56 ff ff ff       	call   8023d8 <pipe_wakeup>
+  802482:	eb d6                	jmp    80245a <devpipe_close+0x5b>
+
+00802484 <_pipeisclosed>:
+{
+  802484:	55                   	push   %ebp
+  802485:	89 e5                	mov    %esp,%ebp
+  802487:	57                   	push   %edi
+  802488:	56                   	push   %esi
+  802489:	53                   	push   %ebx
+  80248a:	83 ec 1c             	sub    $0x1c,%esp
+  80248d:	89 c7                	mov    %eax,%edi
+  80248f:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  802491:	a1 44 67 80 00       	mov    0x806744,%eax
+  802496:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  802499:	83 ec 0c             	sub    $0xc,%esp
+  80249c:	57                   	push   %edi
+  80249d:	e8 18 0a 00 00       	call   802eba <pageref>
+  8024a2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8024a5:	89 34 24             	mov    %esi,(%esp)
+  8024a8:	e8 0d 0a 00 00       	call   802eba <pageref>
+    nn = thisenv->env_runs;
+  8024ad:	8b 15 44 67 80 00    	mov    0x806744,%edx
+  8024b3:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  8024b6:	83 c4 10             	add    $0x10,%esp
+  8024b9:	39 cb                	cmp    %ecx,%ebx
+  8024bb:	74 1b                	je     8024d8 <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  8024bd:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8024c0:	75 cf                	jne    802491 <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8024c2:	8b 42 58             	mov    0x58(%edx),%eax
+  8024c5:	6a 01                	push   $0x1
+  8024c7:	50                   	push   %eax
+  8024c8:	53                   	push   %ebx
+  8024c9:	68 6f 36 80 00       	push   $0x80366f
+  8024ce:	e8 a7 df ff ff       	call   80047a <cprintf>
+  8024d3:	83 c4 10             	add    $0x10,%esp
+  8024d6:	eb b9                	jmp    802491 <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  8024d8:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8024db:	0f 94 c0             	sete   %al
+  8024de:	0f b6 c0             	movzbl %al,%eax
+}
+  8024e1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024e4:	5b                   	pop    %ebx
+  8024e5:	5e                   	pop    %esi
+  8024e6:	5f                   	pop    %edi
+  8024e7:	5d                   	pop    %ebp
+  8024e8:	c3                   	ret
+
+008024e9 <devpipe_write_bulk>:
+{
+  8024e9:	55                   	push   %ebp
+  8024ea:	89 e5                	mov    %esp,%ebp
+  8024ec:	57                   	push   %edi
+  8024ed:	56                   	push   %esi
+  8024ee:	53                   	push   %ebx
+  8024ef:	83 ec 1c             	sub    $0x1c,%esp
+  8024f2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8024f5:	89 d6                	mov    %edx,%esi
+  8024f7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  8024fa:	e8 78 fe ff ff       	call   802377 <pipe_ring>
+  8024ff:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  802502:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802507:	8d 46 04             	lea    0x4(%esi),%eax
+  80250a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  80250d:	eb 75                	jmp    802584 <devpipe_write_bulk+0x9b>
+  80250f:	b8 01 00 00 00       	mov    $0x1,%eax
+  802514:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802518:	6a 64                	push   $0x64
+  80251a:	68 00 00 c0 ee       	push   $0xeec00000
+  80251f:	53                   	push   %ebx
+  802520:	56                   	push   %esi
+  802521:	e8 aa ec ff ff       	call   8011d0 <sys_chan_sleep>
+      continue;
+  802526:	83 c4 10             	add    $0x10,%esp
+  802529:	eb 59                	jmp    802584 <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  80252b:	89 d1                	mov    %edx,%ecx
+  80252d:	c1 f9 1f             	sar    $0x1f,%ecx
+  802530:	c1 e9 11             	shr    $0x11,%ecx
+  802533:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802536:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  80253b:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  80253d:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  802543:	29 d3                	sub    %edx,%ebx
+  802545:	ba 00 80 00 00       	mov    $0x8000,%edx
+  80254a:	29 c2                	sub    %eax,%edx
+  80254c:	39 d3                	cmp    %edx,%ebx
+  80254e:	0f 47 da             	cmova  %edx,%ebx
+  802551:	8b 55 08             	mov    0x8(%ebp),%edx
+  802554:	29 fa                	sub    %edi,%edx
+  802556:	39 d3                	cmp    %edx,%ebx
+  802558:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  80255b:	83 ec 04             	sub    $0x4,%esp
+  80255e:	53                   	push   %ebx
+  80255f:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802562:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  802565:	52                   	push   %edx
+  802566:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802569:	01 c8                	add    %ecx,%eax
+  80256b:	50                   	push   %eax
+  80256c:	e8 df e6 ff ff       	call   800c50 <memcpy>
+    i += m;
+  802571:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  802573:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802576:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802579:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80257c:	e8 57 fe ff ff       	call   8023d8 <pipe_wakeup>
+  802581:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802584:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802587:	73 2b                	jae    8025b4 <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  802589:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  80258b:	8b 56 04             	mov    0x4(%esi),%edx
+  80258e:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  802594:	39 d0                	cmp    %edx,%eax
+  802596:	7d 93                	jge    80252b <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  802598:	89 f2                	mov    %esi,%edx
+  80259a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80259d:	e8 e2 fe ff ff       	call   802484 <_pipeisclosed>
+  8025a2:	85 c0                	test   %eax,%eax
+  8025a4:	0f 84 65 ff ff ff    	je     80250f <devpipe_write_bulk+0x26>
+        return i;
+  8025aa:	89 f8                	mov    %edi,%eax
+}
+  8025ac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025af:	5b                   	pop    %ebx
+  8025b0:	5e                   	pop    %esi
+  8025b1:	5f                   	pop    %edi
+  8025b2:	5d                   	pop    %ebp
+  8025b3:	c3                   	ret
+  return i;
+  8025b4:	89 f8                	mov    %edi,%eax
+  8025b6:	eb f4                	jmp    8025ac <devpipe_write_bulk+0xc3>
+
+008025b8 <devpipe_write>:
+{
+  8025b8:	55                   	push   %ebp
+  8025b9:	89 e5                	mov    %esp,%ebp
+  8025bb:	57                   	push   %edi
+  8025bc:	56                   	push   %esi
+  8025bd:	53                   	push   %ebx
+  8025be:	83 ec 28             	sub    $0x28,%esp
+  8025c1:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  8025c4:	56                   	push   %esi
+  8025c5:	e8 8c ed ff ff       	call   801356 <fd2data>
+  8025ca:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  8025cc:	8b 78 28             	mov    0x28(%eax),%edi
+  8025cf:	83 c4 10             	add    $0x10,%esp
+  8025d2:	85 ff                	test   %edi,%edi
+  8025d4:	75 25                	jne    8025fb <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  8025d6:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8025d9:	74 66                	je     802641 <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8025db:	8b 43 04             	mov    0x4(%ebx),%eax
+  8025de:	8b 0b                	mov    (%ebx),%ecx
+  8025e0:	8d 51 20             	lea    0x20(%ecx),%edx
+  8025e3:	39 d0                	cmp    %edx,%eax
+  8025e5:	72 2b                	jb     802612 <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  8025e7:	89 da                	mov    %ebx,%edx
+  8025e9:	89 f0                	mov    %esi,%eax
+  8025eb:	e8 94 fe ff ff       	call   802484 <_pipeisclosed>
+  8025f0:	85 c0                	test   %eax,%eax
+  8025f2:	75 51                	jne    802645 <devpipe_write+0x8d>
+      sys_yield();
+  8025f4:	e8 3c e8 ff ff       	call   800e35 <sys_yield>
+  8025f9:	eb e0                	jmp    8025db <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  8025fb:	83 ec 0c             	sub    $0xc,%esp
+  8025fe:	ff 75 10             	push   0x10(%ebp)
+  802601:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802604:	89 c2                	mov    %eax,%edx
+  802606:	89 f0                	mov    %esi,%eax
+  802608:	e8 dc fe ff ff       	call   8024e9 <devpipe_write_bulk>
+  80260d:	83 c4 10             	add    $0x10,%esp
+  802610:	eb 38                	jmp    80264a <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802612:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802615:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802619:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  80261c:	89 c2                	mov    %eax,%edx
+  80261e:	c1 fa 1f             	sar    $0x1f,%edx
+  802621:	89 d1                	mov    %edx,%ecx
+  802623:	c1 e9 1b             	shr    $0x1b,%ecx
+  802626:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802629:	83 e2 1f             	and    $0x1f,%edx
+  80262c:	29 ca                	sub    %ecx,%edx
+  80262e:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802632:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  802636:	83 c0 01             	add    $0x1,%eax
+  802639:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  80263c:	83 c7 01             	add    $0x1,%edi
+  80263f:	eb 95                	jmp    8025d6 <devpipe_write+0x1e>
+  return i;
+  802641:	89 f8                	mov    %edi,%eax
+  802643:	eb 05                	jmp    80264a <devpipe_write+0x92>
+        return 0;
+  802645:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80264a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80264d:	5b                   	pop    %ebx
+  80264e:	5e                   	pop    %esi
+  80264f:	5f                   	pop    %edi
+  802650:	5d                   	pop    %ebp
+  802651:	c3                   	ret
+
+00802652 <devpipe_read_bulk>:
+{
+  802652:	55                   	push   %ebp
+  802653:	89 e5                	mov    %esp,%ebp
+  802655:	57                   	push   %edi
+  802656:	56                   	push   %esi
+  802657:	53                   	push   %ebx
+  802658:	83 ec 2c             	sub    $0x2c,%esp
+  80265b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80265e:	89 d6                	mov    %edx,%esi
+  802660:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802663:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  802666:	e8 0c fd ff ff       	call   802377 <pipe_ring>
+  80266b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  80266e:	85 db                	test   %ebx,%ebx
+  802670:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802675:	0f 45 c3             	cmovne %ebx,%eax
+  802678:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  80267b:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802680:	8d 46 30             	lea    0x30(%esi),%eax
+  802683:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  802686:	eb 50                	jmp    8026d8 <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  802688:	89 d1                	mov    %edx,%ecx
+  80268a:	c1 f9 1f             	sar    $0x1f,%ecx
+  80268d:	c1 e9 11             	shr    $0x11,%ecx
+  802690:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802693:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802698:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  80269a:	29 d3                	sub    %edx,%ebx
+  80269c:	ba 00 80 00 00       	mov    $0x8000,%edx
+  8026a1:	29 c2                	sub    %eax,%edx
+  8026a3:	39 d3                	cmp    %edx,%ebx
+  8026a5:	0f 47 da             	cmova  %edx,%ebx
+  8026a8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8026ab:	29 fa                	sub    %edi,%edx
+  8026ad:	39 d3                	cmp    %edx,%ebx
+  8026af:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  8026b2:	83 ec 04             	sub    $0x4,%esp
+  8026b5:	53                   	push   %ebx
+  8026b6:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8026b9:	01 c8                	add    %ecx,%eax
+  8026bb:	50                   	push   %eax
+  8026bc:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8026bf:	01 f8                	add    %edi,%eax
+  8026c1:	50                   	push   %eax
+  8026c2:	e8 89 e5 ff ff       	call   800c50 <memcpy>
+    i += m;
+  8026c7:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  8026c9:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8026cb:	89 f2                	mov    %esi,%edx
+  8026cd:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8026d0:	e8 03 fd ff ff       	call   8023d8 <pipe_wakeup>
+  8026d5:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  8026d8:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  8026db:	73 51                	jae    80272e <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  8026dd:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  8026e0:	8b 16                	mov    (%esi),%edx
+  8026e2:	39 da                	cmp    %ebx,%edx
+  8026e4:	75 a2                	jne    802688 <devpipe_read_bulk+0x36>
+      if (i > 0)
+  8026e6:	85 ff                	test   %edi,%edi
+  8026e8:	75 44                	jne    80272e <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  8026ea:	89 f2                	mov    %esi,%edx
+  8026ec:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8026ef:	e8 90 fd ff ff       	call   802484 <_pipeisclosed>
+  8026f4:	85 c0                	test   %eax,%eax
+  8026f6:	75 3a                	jne    802732 <devpipe_read_bulk+0xe0>
+  8026f8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8026fd:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802701:	6a 64                	push   $0x64
+  802703:	ff 75 d4             	push   -0x2c(%ebp)
+  802706:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  802707:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  80270a:	50                   	push   %eax
+  80270b:	e8 c0 ea ff ff       	call   8011d0 <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  802710:	85 c0                	test   %eax,%eax
+  802712:	ba 00 00 00 00       	mov    $0x0,%edx
+  802717:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  80271a:	83 c4 10             	add    $0x10,%esp
+  80271d:	a8 01                	test   $0x1,%al
+  80271f:	74 b7                	je     8026d8 <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  802721:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  802726:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802729:	5b                   	pop    %ebx
+  80272a:	5e                   	pop    %esi
+  80272b:	5f                   	pop    %edi
+  80272c:	5d                   	pop    %ebp
+  80272d:	c3                   	ret
+  return i;
+  80272e:	89 f8                	mov    %edi,%eax
+  802730:	eb f4                	jmp    802726 <devpipe_read_bulk+0xd4>
+        return 0;
+  802732:	b8 00 00 00 00       	mov    $0x0,%eax
+  802737:	eb ed                	jmp    802726 <devpipe_read_bulk+0xd4>
+
+00802739 <devpipe_read>:
+{
+  802739:	55                   	push   %ebp
+  80273a:	89 e5                	mov    %esp,%ebp
+  80273c:	57                   	push   %edi
+  80273d:	56                   	push   %esi
+  80273e:	53                   	push   %ebx
+  80273f:	83 ec 18             	sub    $0x18,%esp
+  802742:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  802745:	57                   	push   %edi
+  802746:	e8 0b ec ff ff       	call   801356 <fd2data>
+  80274b:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  80274d:	8b 70 28             	mov    0x28(%eax),%esi
+  802750:	83 c4 10             	add    $0x10,%esp
+  802753:	85 f6                	test   %esi,%esi
+  802755:	75 24                	jne    80277b <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  802757:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80275a:	74 60                	je     8027bc <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  80275c:	8b 03                	mov    (%ebx),%eax
+  80275e:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802761:	75 3b                	jne    80279e <devpipe_read+0x65>
+      if (i > 0)
+  802763:	85 f6                	test   %esi,%esi
+  802765:	75 2d                	jne    802794 <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  802767:	89 da                	mov    %ebx,%edx
+  802769:	89 f8                	mov    %edi,%eax
+  80276b:	e8 14 fd ff ff       	call   802484 <_pipeisclosed>
+  802770:	85 c0                	test   %eax,%eax
+  802772:	75 4c                	jne    8027c0 <devpipe_read+0x87>
+      sys_yield();
+  802774:	e8 bc e6 ff ff       	call   800e35 <sys_yield>
+  802779:	eb e1                	jmp    80275c <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  80277b:	83 ec 08             	sub    $0x8,%esp
+  80277e:	6a 00                	push   $0x0
+  802780:	ff 75 10             	push   0x10(%ebp)
+  802783:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802786:	89 c2                	mov    %eax,%edx
+  802788:	89 f8                	mov    %edi,%eax
+  80278a:	e8 c3 fe ff ff       	call   802652 <devpipe_read_bulk>
+  80278f:	83 c4 10             	add    $0x10,%esp
+  802792:	eb 02                	jmp    802796 <devpipe_read+0x5d>
+        return i;
+  802794:	89 f0                	mov    %esi,%eax
+}
+  802796:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802799:	5b                   	pop    %ebx
+  80279a:	5e                   	pop    %esi
+  80279b:	5f                   	pop    %edi
+  80279c:	5d                   	pop    %ebp
+  80279d:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80279e:	99                   	cltd
+  80279f:	c1 ea 1b             	shr    $0x1b,%edx
+  8027a2:	01 d0                	add    %edx,%eax
+  8027a4:	83 e0 1f             	and    $0x1f,%eax
+  8027a7:	29 d0                	sub    %edx,%eax
+  8027a9:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8027ae:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8027b1:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  8027b4:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  8027b7:	83 c6 01             	add    $0x1,%esi
+  8027ba:	eb 9b                	jmp    802757 <devpipe_read+0x1e>
+  return i;
+  8027bc:	89 f0                	mov    %esi,%eax
+  8027be:	eb d6                	jmp    802796 <devpipe_read+0x5d>
+        return 0;
+  8027c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027c5:	eb cf                	jmp    802796 <devpipe_read+0x5d>
+
+008027c7 <pipe2>:
+{
+  8027c7:	55                   	push   %ebp
+  8027c8:	89 e5                	mov    %esp,%ebp
+  8027ca:	57                   	push   %edi
+  8027cb:	56                   	push   %esi
+  8027cc:	53                   	push   %ebx
+  8027cd:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  8027d0:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8027d3:	50                   	push   %eax
+  8027d4:	e8 91 eb ff ff       	call   80136a <fd_alloc>
+  8027d9:	89 c3                	mov    %eax,%ebx
+  8027db:	83 c4 10             	add    $0x10,%esp
+  8027de:	85 c0                	test   %eax,%eax
+  8027e0:	0f 88 fb 01 00 00    	js     8029e1 <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8027e6:	83 ec 04             	sub    $0x4,%esp
+  8027e9:	68 07 04 00 00       	push   $0x407
+  8027ee:	ff 75 e4             	push   -0x1c(%ebp)
+  8027f1:	6a 00                	push   $0x0
+  8027f3:	e8 9f e6 ff ff       	call   800e97 <sys_page_alloc>
+  8027f8:	89 c3                	mov    %eax,%ebx
+  8027fa:	83 c4 10             	add    $0x10,%esp
+  8027fd:	85 c0                	test   %eax,%eax
+  8027ff:	0f 88 dc 01 00 00    	js     8029e1 <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  802805:	83 ec 0c             	sub    $0xc,%esp
+  802808:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80280b:	50                   	push   %eax
+  80280c:	e8 59 eb ff ff       	call   80136a <fd_alloc>
+  802811:	89 c3                	mov    %eax,%ebx
+  802813:	83 c4 10             	add    $0x10,%esp
+  802816:	85 c0                	test   %eax,%eax
+  802818:	0f 88 b3 01 00 00    	js     8029d1 <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80281e:	83 ec 04             	sub    $0x4,%esp
+  802821:	68 07 04 00 00       	push   $0x407
+  802826:	ff 75 e0             	push   -0x20(%ebp)
+  802829:	6a 00                	push   $0x0
+  80282b:	e8 67 e6 ff ff       	call   800e97 <sys_page_alloc>
+  802830:	89 c3                	mov    %eax,%ebx
+  802832:	83 c4 10             	add    $0x10,%esp
+  802835:	85 c0                	test   %eax,%eax
+  802837:	0f 88 94 01 00 00    	js     8029d1 <pipe2+0x20a>
+  va = fd2data(fd0);
+  80283d:	83 ec 0c             	sub    $0xc,%esp
+  802840:	ff 75 e4             	push   -0x1c(%ebp)
+  802843:	e8 0e eb ff ff       	call   801356 <fd2data>
+  802848:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80284a:	83 c4 0c             	add    $0xc,%esp
+  80284d:	68 07 04 00 00       	push   $0x407
+  802852:	50                   	push   %eax
+  802853:	6a 00                	push   $0x0
+  802855:	e8 3d e6 ff ff       	call   800e97 <sys_page_alloc>
+  80285a:	89 c3                	mov    %eax,%ebx
+  80285c:	83 c4 10             	add    $0x10,%esp
+  80285f:	85 c0                	test   %eax,%eax
+  802861:	0f 88 5a 01 00 00    	js     8029c1 <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802867:	83 ec 0c             	sub    $0xc,%esp
+  80286a:	ff 75 e0             	push   -0x20(%ebp)
+  80286d:	e8 e4 ea ff ff       	call   801356 <fd2data>
+  802872:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802879:	50                   	push   %eax
+  80287a:	6a 00                	push   $0x0
+  80287c:	57                   	push   %edi
+  80287d:	6a 00                	push   $0x0
+  80287f:	e8 56 e6 ff ff       	call   800eda <sys_page_map>
+  802884:	89 c3                	mov    %eax,%ebx
+  802886:	83 c4 20             	add    $0x20,%esp
+  802889:	85 c0                	test   %eax,%eax
+  80288b:	0f 88 22 01 00 00    	js     8029b3 <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  802891:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  802895:	74 72                	je     802909 <pipe2+0x142>
+  802897:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  80289c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80289f:	e8 d3 fa ff ff       	call   802377 <pipe_ring>
+  8028a4:	83 ec 04             	sub    $0x4,%esp
+  8028a7:	68 07 04 00 00       	push   $0x407
+  8028ac:	01 f0                	add    %esi,%eax
+  8028ae:	50                   	push   %eax
+  8028af:	6a 00                	push   $0x0
+  8028b1:	e8 e1 e5 ff ff       	call   800e97 <sys_page_alloc>
+  8028b6:	89 c3                	mov    %eax,%ebx
+  8028b8:	83 c4 10             	add    $0x10,%esp
+  8028bb:	85 c0                	test   %eax,%eax
+  8028bd:	0f 88 97 00 00 00    	js     80295a <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  8028c3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8028c6:	e8 ac fa ff ff       	call   802377 <pipe_ring>
+  8028cb:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  8028ce:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8028d1:	e8 a1 fa ff ff       	call   802377 <pipe_ring>
+  8028d6:	83 ec 0c             	sub    $0xc,%esp
+  8028d9:	68 07 04 00 00       	push   $0x407
+  8028de:	53                   	push   %ebx
+  8028df:	6a 00                	push   $0x0
+  8028e1:	01 f0                	add    %esi,%eax
+  8028e3:	50                   	push   %eax
+  8028e4:	6a 00                	push   $0x0
+  8028e6:	e8 ef e5 ff ff       	call   800eda <sys_page_map>
+  8028eb:	89 c3                	mov    %eax,%ebx
+  8028ed:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8028f3:	83 c4 20             	add    $0x20,%esp
+  8028f6:	85 c0                	test   %eax,%eax
+  8028f8:	78 60                	js     80295a <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  8028fa:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802900:	75 9a                	jne    80289c <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  802902:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  802909:	a1 20 40 80 00       	mov    0x804020,%eax
+  80290e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802911:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  802913:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802916:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  80291d:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802920:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  802922:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802925:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  80292c:	83 ec 0c             	sub    $0xc,%esp
+  80292f:	ff 75 e4             	push   -0x1c(%ebp)
+  802932:	e8 0f ea ff ff       	call   801346 <fd2num>
+  802937:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80293a:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  80293c:	83 c4 04             	add    $0x4,%esp
+  80293f:	ff 75 e0             	push   -0x20(%ebp)
+  802942:	e8 ff e9 ff ff       	call   801346 <fd2num>
+  802947:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80294a:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  80294d:	83 c4 10             	add    $0x10,%esp
+  802950:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802955:	e9 87 00 00 00       	jmp    8029e1 <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  80295a:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  80295f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802962:	e8 10 fa ff ff       	call   802377 <pipe_ring>
+  802967:	83 ec 08             	sub    $0x8,%esp
+  80296a:	01 f0                	add    %esi,%eax
+  80296c:	50                   	push   %eax
+  80296d:	6a 00                	push   $0x0
+  80296f:	e8 a8 e5 ff ff       	call   800f1c <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  802974:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802977:	e8 fb f9 ff ff       	call   802377 <pipe_ring>
+  80297c:	83 c4 08             	add    $0x8,%esp
+  80297f:	01 f0                	add    %esi,%eax
+  802981:	50                   	push   %eax
+  802982:	6a 00                	push   $0x0
+  802984:	e8 93 e5 ff ff       	call   800f1c <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802989:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80298f:	83 c4 10             	add    $0x10,%esp
+  802992:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802998:	75 c5                	jne    80295f <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  80299a:	83 ec 0c             	sub    $0xc,%esp
+  80299d:	ff 75 e0             	push   -0x20(%ebp)
+  8029a0:	e8 b1 e9 ff ff       	call   801356 <fd2data>
+  8029a5:	83 c4 08             	add    $0x8,%esp
+  8029a8:	50                   	push   %eax
+  8029a9:	6a 00                	push   $0x0
+  8029ab:	e8 6c e5 ff ff       	call   800f1c <sys_page_unmap>
+  8029b0:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  8029b3:	83 ec 08             	sub    $0x8,%esp
+  8029b6:	57                   	push   %edi
+  8029b7:	6a 00                	push   $0x0
+  8029b9:	e8 5e e5 ff ff       	call   800f1c <sys_page_unmap>
+  8029be:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  8029c1:	83 ec 08             	sub    $0x8,%esp
+  8029c4:	ff 75 e0             	push   -0x20(%ebp)
+  8029c7:	6a 00                	push   $0x0
+  8029c9:	e8 4e e5 ff ff       	call   800f1c <sys_page_unmap>
+  8029ce:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  8029d1:	83 ec 08             	sub    $0x8,%esp
+  8029d4:	ff 75 e4             	push   -0x1c(%ebp)
+  8029d7:	6a 00                	push   $0x0
+  8029d9:	e8 3e e5 ff ff       	call   800f1c <sys_page_unmap>
+  8029de:	83 c4 10             	add    $0x10,%esp
+}
+  8029e1:	89 d8                	mov    %ebx,%eax
+  8029e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029e6:	5b                   	pop    %ebx
+  8029e7:	5e                   	pop    %esi
+  8029e8:	5f                   	pop    %edi
+  8029e9:	5d                   	pop    %ebp
+  8029ea:	c3                   	ret
+
+008029eb <pipe>:
+{
+  8029eb:	55                   	push   %ebp
+  8029ec:	89 e5                	mov    %esp,%ebp
+  8029ee:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  8029f1:	6a 00                	push   $0x0
+  8029f3:	ff 75 08             	push   0x8(%ebp)
+  8029f6:	e8 cc fd ff ff       	call   8027c7 <pipe2>
+}
+  8029fb:	c9                   	leave
+  8029fc:	c3                   	ret
+
+008029fd <pipeisclosed>:
+{
+  8029fd:	55                   	push   %ebp
+  8029fe:	89 e5                	mov    %esp,%ebp
+  802a00:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802a03:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a06:	50                   	push   %eax
+  802a07:	ff 75 08             	push   0x8(%ebp)
+  802a0a:	e8 b1 e9 ff ff       	call   8013c0 <fd_lookup>
+  802a0f:	83 c4 10             	add    $0x10,%esp
+  802a12:	85 c0                	test   %eax,%eax
+  802a14:	78 18                	js     802a2e <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  802a16:	83 ec 0c             	sub    $0xc,%esp
+  802a19:	ff 75 f4             	push   -0xc(%ebp)
+  802a1c:	e8 35 e9 ff ff       	call   801356 <fd2data>
+  802a21:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  802a23:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a26:	e8 59 fa ff ff       	call   802484 <_pipeisclosed>
+  802a2b:	83 c4 10             	add    $0x10,%esp
+}
+  802a2e:	c9                   	leave
+  802a2f:	c3                   	ret
+
+00802a30 <pipe_splice>:
+{
+  802a30:	55                   	push   %ebp
+  802a31:	89 e5                	mov    %esp,%ebp
+  802a33:	57                   	push   %edi
+  802a34:	56                   	push   %esi
+  802a35:	53                   	push   %ebx
+  802a36:	83 ec 34             	sub    $0x34,%esp
+  802a39:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802a3c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802a3f:	50                   	push   %eax
+  802a40:	ff 75 08             	push   0x8(%ebp)
+  802a43:	e8 78 e9 ff ff       	call   8013c0 <fd_lookup>
+  802a48:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802a4b:	83 c4 10             	add    $0x10,%esp
+  802a4e:	85 c0                	test   %eax,%eax
+  802a50:	0f 88 d7 00 00 00    	js     802b2d <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  802a56:	83 ec 0c             	sub    $0xc,%esp
+  802a59:	ff 75 e4             	push   -0x1c(%ebp)
+  802a5c:	e8 f5 e8 ff ff       	call   801356 <fd2data>
+  802a61:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802a63:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802a66:	83 c4 10             	add    $0x10,%esp
+  802a69:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802a6f:	39 10                	cmp    %edx,(%eax)
+  802a71:	0f 85 c1 00 00 00    	jne    802b38 <pipe_splice+0x108>
+  802a77:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  802a7b:	0f 84 c0 00 00 00    	je     802b41 <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  802a81:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802a85:	0f 84 bf 00 00 00    	je     802b4a <pipe_splice+0x11a>
+  802a8b:	89 f7                	mov    %esi,%edi
+  802a8d:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  802a93:	0f 85 ba 00 00 00    	jne    802b53 <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802a99:	8d 43 04             	lea    0x4(%ebx),%eax
+  802a9c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802a9f:	eb 38                	jmp    802ad9 <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802aa1:	83 ec 0c             	sub    $0xc,%esp
+  802aa4:	68 00 10 00 00       	push   $0x1000
+  802aa9:	89 f1                	mov    %esi,%ecx
+  802aab:	89 da                	mov    %ebx,%edx
+  802aad:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802ab0:	e8 34 fa ff ff       	call   8024e9 <devpipe_write_bulk>
+  802ab5:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802ab8:	83 c4 10             	add    $0x10,%esp
+  802abb:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802ac0:	75 53                	jne    802b15 <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  802ac2:	83 ec 08             	sub    $0x8,%esp
+  802ac5:	56                   	push   %esi
+  802ac6:	6a 00                	push   $0x0
+  802ac8:	e8 4f e4 ff ff       	call   800f1c <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  802acd:	83 c7 01             	add    $0x1,%edi
+  802ad0:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802ad6:	83 c4 10             	add    $0x10,%esp
+  802ad9:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802adc:	74 3a                	je     802b18 <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  802ade:	8b 03                	mov    (%ebx),%eax
+  802ae0:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802ae3:	75 bc                	jne    802aa1 <pipe_splice+0x71>
+  802ae5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aea:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  802aee:	85 c0                	test   %eax,%eax
+  802af0:	74 af                	je     802aa1 <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802af2:	83 ec 04             	sub    $0x4,%esp
+  802af5:	6a 07                	push   $0x7
+  802af7:	56                   	push   %esi
+  802af8:	ff 75 d0             	push   -0x30(%ebp)
+  802afb:	e8 f3 e6 ff ff       	call   8011f3 <sys_chan_wakeup>
+  802b00:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802b03:	83 c4 10             	add    $0x10,%esp
+  802b06:	85 c0                	test   %eax,%eax
+  802b08:	79 b8                	jns    802ac2 <pipe_splice+0x92>
+  802b0a:	b8 01 00 00 00       	mov    $0x1,%eax
+  802b0f:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802b13:	eb 8c                	jmp    802aa1 <pipe_splice+0x71>
+  802b15:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  802b18:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802b1c:	75 06                	jne    802b24 <pipe_splice+0xf4>
+  802b1e:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802b22:	78 09                	js     802b2d <pipe_splice+0xfd>
+  return i * PGSIZE;
+  802b24:	8b 45 10             	mov    0x10(%ebp),%eax
+  802b27:	c1 e0 0c             	shl    $0xc,%eax
+  802b2a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  802b2d:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802b30:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b33:	5b                   	pop    %ebx
+  802b34:	5e                   	pop    %esi
+  802b35:	5f                   	pop    %edi
+  802b36:	5d                   	pop    %ebp
+  802b37:	c3                   	ret
+    return -E_INVAL;
+  802b38:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802b3f:	eb ec                	jmp    802b2d <pipe_splice+0xfd>
+  802b41:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802b48:	eb e3                	jmp    802b2d <pipe_splice+0xfd>
+  802b4a:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802b51:	eb da                	jmp    802b2d <pipe_splice+0xfd>
+  802b53:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802b5a:	eb d1                	jmp    802b2d <pipe_splice+0xfd>
+
+00802b5c <pipe_splice_read>:
+{
+  802b5c:	55                   	push   %ebp
+  802b5d:	89 e5                	mov    %esp,%ebp
+  802b5f:	53                   	push   %ebx
+  802b60:	83 ec 1c             	sub    $0x1c,%esp
+  802b63:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802b66:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b69:	50                   	push   %eax
+  802b6a:	ff 75 08             	push   0x8(%ebp)
+  802b6d:	e8 4e e8 ff ff       	call   8013c0 <fd_lookup>
+  802b72:	83 c4 10             	add    $0x10,%esp
+  802b75:	85 c0                	test   %eax,%eax
+  802b77:	78 49                	js     802bc2 <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  802b79:	83 ec 0c             	sub    $0xc,%esp
+  802b7c:	ff 75 f4             	push   -0xc(%ebp)
+  802b7f:	e8 d2 e7 ff ff       	call   801356 <fd2data>
+  802b84:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802b86:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b89:	83 c4 10             	add    $0x10,%esp
+  802b8c:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  802b92:	39 08                	cmp    %ecx,(%eax)
+  802b94:	75 31                	jne    802bc7 <pipe_splice_read+0x6b>
+  802b96:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  802b9a:	74 32                	je     802bce <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  802b9c:	8b 48 08             	mov    0x8(%eax),%ecx
+  802b9f:	83 e1 03             	and    $0x3,%ecx
+  802ba2:	83 f9 01             	cmp    $0x1,%ecx
+  802ba5:	74 2e                	je     802bd5 <pipe_splice_read+0x79>
+  802ba7:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  802bad:	75 2d                	jne    802bdc <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  802baf:	83 ec 08             	sub    $0x8,%esp
+  802bb2:	53                   	push   %ebx
+  802bb3:	68 00 10 00 00       	push   $0x1000
+  802bb8:	89 d9                	mov    %ebx,%ecx
+  802bba:	e8 93 fa ff ff       	call   802652 <devpipe_read_bulk>
+  802bbf:	83 c4 10             	add    $0x10,%esp
+}
+  802bc2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802bc5:	c9                   	leave
+  802bc6:	c3                   	ret
+    return -E_INVAL;
+  802bc7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802bcc:	eb f4                	jmp    802bc2 <pipe_splice_read+0x66>
+  802bce:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802bd3:	eb ed                	jmp    802bc2 <pipe_splice_read+0x66>
+  802bd5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802bda:	eb e6                	jmp    802bc2 <pipe_splice_read+0x66>
+  802bdc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802be1:	eb df                	jmp    802bc2 <pipe_splice_read+0x66>
+
+00802be3 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  802be3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802be8:	c3                   	ret
+
+00802be9 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802be9:	55                   	push   %ebp
+  802bea:	89 e5                	mov    %esp,%ebp
+  802bec:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  802bef:	68 87 36 80 00       	push   $0x803687
+  802bf4:	ff 75 0c             	push   0xc(%ebp)
+  802bf7:	e8 6c de ff ff       	call   800a68 <strcpy>
+  return 0;
+}
+  802bfc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c01:	c9                   	leave
+  802c02:	c3                   	ret
+
+00802c03 <devcons_write>:
+{
+  802c03:	55                   	push   %ebp
+  802c04:	89 e5                	mov    %esp,%ebp
+  802c06:	57                   	push   %edi
+  802c07:	56                   	push   %esi
+  802c08:	53                   	push   %ebx
+  802c09:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  802c0f:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  802c14:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  802c1a:	eb 2e                	jmp    802c4a <devcons_write+0x47>
+    m = n - tot;
+  802c1c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802c1f:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  802c21:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  802c26:	39 c3                	cmp    %eax,%ebx
+  802c28:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  802c2b:	83 ec 04             	sub    $0x4,%esp
+  802c2e:	53                   	push   %ebx
+  802c2f:	89 f0                	mov    %esi,%eax
+  802c31:	03 45 0c             	add    0xc(%ebp),%eax
+  802c34:	50                   	push   %eax
+  802c35:	57                   	push   %edi
+  802c36:	e8 b3 df ff ff       	call   800bee <memmove>
+    sys_cputs(buf, m);
+  802c3b:	83 c4 08             	add    $0x8,%esp
+  802c3e:	53                   	push   %ebx
+  802c3f:	57                   	push   %edi
+  802c40:	e8 53 e1 ff ff       	call   800d98 <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  802c45:	01 de                	add    %ebx,%esi
+  802c47:	83 c4 10             	add    $0x10,%esp
+  802c4a:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802c4d:	72 cd                	jb     802c1c <devcons_write+0x19>
+}
+  802c4f:	89 f0                	mov    %esi,%eax
+  802c51:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c54:	5b                   	pop    %ebx
+  802c55:	5e                   	pop    %esi
+  802c56:	5f                   	pop    %edi
+  802c57:	5d                   	pop    %ebp
+  802c58:	c3                   	ret
+
+00802c59 <devcons_read>:
+{
+  802c59:	55                   	push   %ebp
+  802c5a:	89 e5                	mov    %esp,%ebp
+  802c5c:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  802c5f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c64:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802c68:	75 07                	jne    802c71 <devcons_read+0x18>
+  802c6a:	eb 1f                	jmp    802c8b <devcons_read+0x32>
+    sys_yield();
+  802c6c:	e8 c4 e1 ff ff       	call   800e35 <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  802c71:	e8 40 e1 ff ff       	call   800db6 <sys_cgetc>
+  802c76:	85 c0                	test   %eax,%eax
+  802c78:	74 f2                	je     802c6c <devcons_read+0x13>
+  if (c < 0)
+  802c7a:	78 0f                	js     802c8b <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  802c7c:	83 f8 04             	cmp    $0x4,%eax
+  802c7f:	74 0c                	je     802c8d <devcons_read+0x34>
+  *(char*)vbuf = c;
+  802c81:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802c84:	88 02                	mov    %al,(%edx)
+  return 1;
+  802c86:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802c8b:	c9                   	leave
+  802c8c:	c3                   	ret
+    return 0;
+  802c8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c92:	eb f7                	jmp    802c8b <devcons_read+0x32>
+
+00802c94 <cputchar>:
+{
+  802c94:	55                   	push   %ebp
+  802c95:	89 e5                	mov    %esp,%ebp
+  802c97:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  802c9a:	8b 45 08             	mov    0x8(%ebp),%eax
+  802c9d:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  802ca0:	6a 01                	push   $0x1
+  802ca2:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802ca5:	50                   	push   %eax
+  802ca6:	e8 ed e0 ff ff       	call   800d98 <sys_cputs>
+}
+  802cab:	83 c4 10             	add    $0x10,%esp
+  802cae:	c9                   	leave
+  802caf:	c3                   	ret
+
+00802cb0 <getchar>:
+{
+  802cb0:	55                   	push   %ebp
+  802cb1:	89 e5                	mov    %esp,%ebp
+  802cb3:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  802cb6:	6a 01                	push   $0x1
+  802cb8:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802cbb:	50                   	push   %eax
+  802cbc:	6a 00                	push   $0x0
+  802cbe:	e8 a8 e9 ff ff       	call   80166b <read>
+  if (r < 0)
+  802cc3:	83 c4 10             	add    $0x10,%esp
+  802cc6:	85 c0                	test   %eax,%eax
+  802cc8:	78 06                	js     802cd0 <getchar+0x20>
+  if (r < 1)
+  802cca:	74 06                	je     802cd2 <getchar+0x22>
+  return c;
+  802ccc:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802cd0:	c9                   	leave
+  802cd1:	c3                   	ret
+    return -E_EOF;
+  802cd2:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802cd7:	eb f7                	jmp    802cd0 <getchar+0x20>
+
+00802cd9 <iscons>:
+{
+  802cd9:	55                   	push   %ebp
+  802cda:	89 e5                	mov    %esp,%ebp
+  802cdc:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802cdf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802ce2:	50                   	push   %eax
+  802ce3:	ff 75 08             	push   0x8(%ebp)
+  802ce6:	e8 d5 e6 ff ff       	call   8013c0 <fd_lookup>
+  802ceb:	83 c4 10             	add    $0x10,%esp
+  802cee:	85 c0                	test   %eax,%eax
+  802cf0:	78 11                	js     802d03 <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  802cf2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802cf5:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802cfb:	39 10                	cmp    %edx,(%eax)
+  802cfd:	0f 94 c0             	sete   %al
+  802d00:	0f b6 c0             	movzbl %al,%eax
+}
+  802d03:	c9                   	leave
+  802d04:	c3                   	ret
+
+00802d05 <opencons>:
+{
+  802d05:	55                   	push   %ebp
+  802d06:	89 e5                	mov    %esp,%ebp
+  802d08:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  802d0b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802d0e:	50                   	push   %eax
+  802d0f:	e8 56 e6 ff ff       	call   80136a <fd_alloc>
+  802d14:	83 c4 10             	add    $0x10,%esp
+  802d17:	85 c0                	test   %eax,%eax
+  802d19:	78 3a                	js     802d55 <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802d1b:	83 ec 04             	sub    $0x4,%esp
+  802d1e:	68 07 04 00 00       	push   $0x407
+  802d23:	ff 75 f4             	push   -0xc(%ebp)
+  802d26:	6a 00                	push   $0x0
+  802d28:	e8 6a e1 ff ff       	call   800e97 <sys_page_alloc>
+  802d2d:	83 c4 10             	add    $0x10,%esp
+  802d30:	85 c0                	test   %eax,%eax
+  802d32:	78 21                	js     802d55 <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  802d34:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802d37:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802d3d:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  802d3f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802d42:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  802d49:	83 ec 0c             	sub    $0xc,%esp
+  802d4c:	50                   	push   %eax
+  802d4d:	e8 f4 e5 ff ff       	call   801346 <fd2num>
+  802d52:	83 c4 10             	add    $0x10,%esp
+}
+  802d55:	c9                   	leave
+  802d56:	c3                   	ret
+
+00802d57 <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  802d57:	55                   	push   %ebp
+  802d58:	89 e5                	mov    %esp,%ebp
+  802d5a:	57                   	push   %edi
+  802d5b:	56                   	push   %esi
+  802d5c:	53                   	push   %ebx
+  802d5d:	83 ec 14             	sub    $0x14,%esp
+  802d60:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802d63:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d66:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802d69:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  802d6c:	85 c0                	test   %eax,%eax
+  802d6e:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802d73:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  802d76:	ff 33                	push   (%ebx)
+  802d78:	50                   	push   %eax
+  802d79:	e8 f1 e3 ff ff       	call   80116f <sys_ipc_recv>
+  802d7e:	83 c4 10             	add    $0x10,%esp
+  802d81:	85 c0                	test   %eax,%eax
+  802d83:	78 39                	js     802dbe <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  802d85:	85 ff                	test   %edi,%edi
+  802d87:	74 0a                	je     802d93 <ipc_recv_pages+0x3c>
+  802d89:	a1 44 67 80 00       	mov    0x806744,%eax
+  802d8e:	8b 40 7c             	mov    0x7c(%eax),%eax
+  802d91:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  802d93:	85 f6                	test   %esi,%esi
+  802d95:	74 0d                	je     802da4 <ipc_recv_pages+0x4d>
+  802d97:	a1 44 67 80 00       	mov    0x806744,%eax
+  802d9c:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  802da2:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  802da4:	a1 44 67 80 00       	mov    0x806744,%eax
+  802da9:	8b 40 74             	mov    0x74(%eax),%eax
+  802dac:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  802dae:	a1 44 67 80 00       	mov    0x806744,%eax
+  802db3:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  802db6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802db9:	5b                   	pop    %ebx
+  802dba:	5e                   	pop    %esi
+  802dbb:	5f                   	pop    %edi
+  802dbc:	5d                   	pop    %ebp
+  802dbd:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  802dbe:	85 ff                	test   %edi,%edi
+  802dc0:	74 06                	je     802dc8 <ipc_recv_pages+0x71>
+  802dc2:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  802dc8:	85 f6                	test   %esi,%esi
+  802dca:	74 06                	je     802dd2 <ipc_recv_pages+0x7b>
+  802dcc:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  802dd2:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  802dd8:	eb dc                	jmp    802db6 <ipc_recv_pages+0x5f>
+
+00802dda <ipc_recv>:
+{
+  802dda:	55                   	push   %ebp
+  802ddb:	89 e5                	mov    %esp,%ebp
+  802ddd:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  802de0:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  802de7:	ff 75 10             	push   0x10(%ebp)
+  802dea:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802ded:	50                   	push   %eax
+  802dee:	ff 75 0c             	push   0xc(%ebp)
+  802df1:	ff 75 08             	push   0x8(%ebp)
+  802df4:	e8 5e ff ff ff       	call   802d57 <ipc_recv_pages>
+}
+  802df9:	c9                   	leave
+  802dfa:	c3                   	ret
+
+00802dfb <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  802dfb:	55                   	push   %ebp
+  802dfc:	89 e5                	mov    %esp,%ebp
+  802dfe:	57                   	push   %edi
+  802dff:	56                   	push   %esi
+  802e00:	53                   	push   %ebx
+  802e01:	83 ec 0c             	sub    $0xc,%esp
+  802e04:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802e07:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802e0a:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  802e0d:	89 c3                	mov    %eax,%ebx
+  802e0f:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  802e15:	85 c0                	test   %eax,%eax
+  802e17:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802e1c:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  802e1f:	83 ec 0c             	sub    $0xc,%esp
+  802e22:	ff 75 14             	push   0x14(%ebp)
+  802e25:	ff 75 18             	push   0x18(%ebp)
+  802e28:	53                   	push   %ebx
+  802e29:	56                   	push   %esi
+  802e2a:	57                   	push   %edi
+  802e2b:	e8 1e e3 ff ff       	call   80114e <sys_ipc_try_send>
+  802e30:	83 c4 20             	add    $0x20,%esp
+  802e33:	85 c0                	test   %eax,%eax
+  802e35:	79 1e                	jns    802e55 <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  802e37:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802e3a:	75 07                	jne    802e43 <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  802e3c:	e8 f4 df ff ff       	call   800e35 <sys_yield>
+  802e41:	eb dc                	jmp    802e1f <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  802e43:	50                   	push   %eax
+  802e44:	68 93 36 80 00       	push   $0x803693
+  802e49:	6a 5c                	push   $0x5c
+  802e4b:	68 a0 36 80 00       	push   $0x8036a0
+  802e50:	e8 4a d5 ff ff       	call   80039f <_panic>
+  }
+}
+  802e55:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e58:	5b                   	pop    %ebx
+  802e59:	5e                   	pop    %esi
+  802e5a:	5f                   	pop    %edi
+  802e5b:	5d                   	pop    %ebp
+  802e5c:	c3                   	ret
+
+00802e5d <ipc_send>:
+{
+  802e5d:	55                   	push   %ebp
+  802e5e:	89 e5                	mov    %esp,%ebp
+  802e60:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  802e63:	ff 75 14             	push   0x14(%ebp)
+  802e66:	6a 01                	push   $0x1
+  802e68:	ff 75 10             	push   0x10(%ebp)
+  802e6b:	ff 75 0c             	push   0xc(%ebp)
+  802e6e:	ff 75 08             	push   0x8(%ebp)
+  802e71:	e8 85 ff ff ff       	call   802dfb <ipc_send_pages>
+}
+  802e76:	83 c4 20             	add    $0x20,%esp
+  802e79:	c9                   	leave
+  802e7a:	c3                   	ret
+
+00802e7b <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802e7b:	55                   	push   %ebp
+  802e7c:	89 e5                	mov    %esp,%ebp
+  802e7e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  802e81:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  802e86:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802e89:	c1 e0 04             	shl    $0x4,%eax
+  802e8c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802e91:	8b 40 50             	mov    0x50(%eax),%eax
+  802e94:	39 c8                	cmp    %ecx,%eax
+  802e96:	74 12                	je     802eaa <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  802e98:	83 c2 01             	add    $0x1,%edx
+  802e9b:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802ea1:	75 e3                	jne    802e86 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  802ea3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ea8:	eb 0e                	jmp    802eb8 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  802eaa:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802ead:	c1 e0 04             	shl    $0x4,%eax
+  802eb0:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802eb5:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802eb8:	5d                   	pop    %ebp
+  802eb9:	c3                   	ret
+
+00802eba <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802eba:	55                   	push   %ebp
+  802ebb:	89 e5                	mov    %esp,%ebp
+  802ebd:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802ec0:	89 c2                	mov    %eax,%edx
+  802ec2:	c1 ea 16             	shr    $0x16,%edx
+  802ec5:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  802ecc:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802ed1:	f6 c1 01             	test   $0x1,%cl
+  802ed4:	74 1c                	je     802ef2 <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  802ed6:	c1 e8 0c             	shr    $0xc,%eax
+  802ed9:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  802ee0:	a8 01                	test   $0x1,%al
+  802ee2:	74 0e                	je     802ef2 <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  802ee4:	c1 e8 0c             	shr    $0xc,%eax
+  802ee7:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802eee:	ef 
+  802eef:	0f b7 d2             	movzwl %dx,%edx
+}
+  802ef2:	89 d0                	mov    %edx,%eax
+  802ef4:	5d                   	pop    %ebp
+  802ef5:	c3                   	ret
+
+00802ef6 <udivmod>:
+  802ef6:	55                   	push   %ebp
+  802ef7:	57                   	push   %edi
+  802ef8:	56                   	push   %esi
+  802ef9:	53                   	push   %ebx
+  802efa:	83 ec 14             	sub    $0x14,%esp
+  802efd:	8b 74 24 28          	mov    0x28(%esp),%esi
+  802f01:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  802f05:	89 fb                	mov    %edi,%ebx
+  802f07:	09 f3                	or     %esi,%ebx
+  802f09:	0f 84 88 00 00 00    	je     802f97 <udivmod+0xa1>
+  802f0f:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802f14:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802f1b:	00 
+  802f1c:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802f23:	00 
+  802f24:	89 cd                	mov    %ecx,%ebp
+  802f26:	89 34 24             	mov    %esi,(%esp)
+  802f29:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802f2d:	eb 08                	jmp    802f37 <udivmod+0x41>
+  802f2f:	83 ed 01             	sub    $0x1,%ebp
+  802f32:	83 fd ff             	cmp    $0xffffffff,%ebp
+  802f35:	74 6c                	je     802fa3 <udivmod+0xad>
+  802f37:	89 c3                	mov    %eax,%ebx
+  802f39:	89 d6                	mov    %edx,%esi
+  802f3b:	89 e9                	mov    %ebp,%ecx
+  802f3d:	0f ad f3             	shrd   %cl,%esi,%ebx
+  802f40:	d3 ee                	shr    %cl,%esi
+  802f42:	f6 c1 20             	test   $0x20,%cl
+  802f45:	74 04                	je     802f4b <udivmod+0x55>
+  802f47:	89 f3                	mov    %esi,%ebx
+  802f49:	31 f6                	xor    %esi,%esi
+  802f4b:	8b 3c 24             	mov    (%esp),%edi
+  802f4e:	39 fb                	cmp    %edi,%ebx
+  802f50:	89 f7                	mov    %esi,%edi
+  802f52:	8b 1c 24             	mov    (%esp),%ebx
+  802f55:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802f59:	19 f7                	sbb    %esi,%edi
+  802f5b:	72 d2                	jb     802f2f <udivmod+0x39>
+  802f5d:	89 f7                	mov    %esi,%edi
+  802f5f:	89 de                	mov    %ebx,%esi
+  802f61:	89 e9                	mov    %ebp,%ecx
+  802f63:	0f a5 f7             	shld   %cl,%esi,%edi
+  802f66:	d3 e6                	shl    %cl,%esi
+  802f68:	f6 c1 20             	test   $0x20,%cl
+  802f6b:	74 04                	je     802f71 <udivmod+0x7b>
+  802f6d:	89 f7                	mov    %esi,%edi
+  802f6f:	31 f6                	xor    %esi,%esi
+  802f71:	29 f0                	sub    %esi,%eax
+  802f73:	19 fa                	sbb    %edi,%edx
+  802f75:	be 01 00 00 00       	mov    $0x1,%esi
+  802f7a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f7f:	0f a5 f7             	shld   %cl,%esi,%edi
+  802f82:	d3 e6                	shl    %cl,%esi
+  802f84:	f6 c1 20             	test   $0x20,%cl
+  802f87:	74 04                	je     802f8d <udivmod+0x97>
+  802f89:	89 f7                	mov    %esi,%edi
+  802f8b:	31 f6                	xor    %esi,%esi
+  802f8d:	09 74 24 08          	or     %esi,0x8(%esp)
+  802f91:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802f95:	eb 98                	jmp    802f2f <udivmod+0x39>
+  802f97:	89 f0                	mov    %esi,%eax
+  802f99:	89 fa                	mov    %edi,%edx
+  802f9b:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802f9f:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802fa3:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802fa7:	89 01                	mov    %eax,(%ecx)
+  802fa9:	89 51 04             	mov    %edx,0x4(%ecx)
+  802fac:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802fb0:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802fb4:	83 c4 14             	add    $0x14,%esp
+  802fb7:	5b                   	pop    %ebx
+  802fb8:	5e                   	pop    %esi
+  802fb9:	5f                   	pop    %edi
+  802fba:	5d                   	pop    %ebp
+  802fbb:	c3                   	ret
+
+00802fbc <__udivdi3>:
+  802fbc:	83 ec 18             	sub    $0x18,%esp
+  802fbf:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802fc3:	50                   	push   %eax
+  802fc4:	ff 74 24 2c          	push   0x2c(%esp)
+  802fc8:	ff 74 24 2c          	push   0x2c(%esp)
+  802fcc:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802fd0:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802fd4:	e8 1d ff ff ff       	call   802ef6 <udivmod>
+  802fd9:	83 c4 24             	add    $0x24,%esp
+  802fdc:	c3                   	ret
+
+00802fdd <__umoddi3>:
+  802fdd:	83 ec 18             	sub    $0x18,%esp
+  802fe0:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802fe4:	50                   	push   %eax
+  802fe5:	ff 74 24 2c          	push   0x2c(%esp)
+  802fe9:	ff 74 24 2c          	push   0x2c(%esp)
+  802fed:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802ff1:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802ff5:	e8 fc fe ff ff       	call   802ef6 <udivmod>
+  802ffa:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802ffe:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803002:	83 c4 24             	add    $0x24,%esp
+  803005:	c3                   	ret
+
+00803006 <__divdi3>:
+  803006:	56                   	push   %esi
+  803007:	53                   	push   %ebx
+  803008:	83 ec 14             	sub    $0x14,%esp
+  80300b:	8b 44 24 20          	mov    0x20(%esp),%eax
+  80300f:	8b 54 24 24          	mov    0x24(%esp),%edx
+  803013:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  803017:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  80301b:	85 d2                	test   %edx,%edx
+  80301d:	78 18                	js     803037 <__divdi3+0x31>
+  80301f:	85 db                	test   %ebx,%ebx
+  803021:	78 3e                	js     803061 <__divdi3+0x5b>
+  803023:	83 ec 04             	sub    $0x4,%esp
+  803026:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80302a:	56                   	push   %esi
+  80302b:	53                   	push   %ebx
+  80302c:	51                   	push   %ecx
+  80302d:	e8 c4 fe ff ff       	call   802ef6 <udivmod>
+  803032:	83 c4 10             	add    $0x10,%esp
+  803035:	eb 24                	jmp    80305b <__divdi3+0x55>
+  803037:	f7 d8                	neg    %eax
+  803039:	83 d2 00             	adc    $0x0,%edx
+  80303c:	f7 da                	neg    %edx
+  80303e:	85 db                	test   %ebx,%ebx
+  803040:	78 3a                	js     80307c <__divdi3+0x76>
+  803042:	83 ec 04             	sub    $0x4,%esp
+  803045:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803049:	56                   	push   %esi
+  80304a:	53                   	push   %ebx
+  80304b:	51                   	push   %ecx
+  80304c:	e8 a5 fe ff ff       	call   802ef6 <udivmod>
+  803051:	83 c4 10             	add    $0x10,%esp
+  803054:	f7 d8                	neg    %eax
+  803056:	83 d2 00             	adc    $0x0,%edx
+  803059:	f7 da                	neg    %edx
+  80305b:	83 c4 14             	add    $0x14,%esp
+  80305e:	5b                   	pop    %ebx
+  80305f:	5e                   	pop    %esi
+  803060:	c3                   	ret
+  803061:	83 ec 04             	sub    $0x4,%esp
+  803064:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803068:	56                   	push   %esi
+  803069:	f7 d9                	neg    %ecx
+  80306b:	83 d3 00             	adc    $0x0,%ebx
+  80306e:	f7 db                	neg    %ebx
+  803070:	53                   	push   %ebx
+  803071:	51                   	push   %ecx
+  803072:	e8 7f fe ff ff       	call   802ef6 <udivmod>
+  803077:	83 c4 10             	add    $0x10,%esp
+  80307a:	eb d8                	jmp    803054 <__divdi3+0x4e>
+  80307c:	83 ec 04             	sub    $0x4,%esp
+  80307f:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803083:	56                   	push   %esi
+  803084:	f7 d9                	neg    %ecx
+  803086:	83 d3 00             	adc    $0x0,%ebx
+  803089:	f7 db                	neg    %ebx
+  80308b:	53                   	push   %ebx
+  80308c:	51                   	push   %ecx
+  80308d:	e8 64 fe ff ff       	call   802ef6 <udivmod>
+  803092:	83 c4 10             	add    $0x10,%esp
+  803095:	eb c4                	jmp    80305b <__divdi3+0x55>
+
+00803097 <__moddi3>:
+  803097:	55                   	push   %ebp
+  803098:	57                   	push   %edi
+  803099:	56                   	push   %esi
+  80309a:	53                   	push   %ebx
+  80309b:	83 ec 24             	sub    $0x24,%esp
+  80309e:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8030a2:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8030a6:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  8030aa:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  8030ae:	85 d2                	test   %edx,%edx
+  8030b0:	78 3b                	js     8030ed <__moddi3+0x56>
+  8030b2:	83 ec 04             	sub    $0x4,%esp
+  8030b5:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8030b9:	56                   	push   %esi
+  8030ba:	89 ce                	mov    %ecx,%esi
+  8030bc:	f7 de                	neg    %esi
+  8030be:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8030c2:	89 de                	mov    %ebx,%esi
+  8030c4:	83 d6 00             	adc    $0x0,%esi
+  8030c7:	f7 de                	neg    %esi
+  8030c9:	89 74 24 14          	mov    %esi,0x14(%esp)
+  8030cd:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8030d1:	0f 48 f1             	cmovs  %ecx,%esi
+  8030d4:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  8030d9:	53                   	push   %ebx
+  8030da:	56                   	push   %esi
+  8030db:	e8 16 fe ff ff       	call   802ef6 <udivmod>
+  8030e0:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8030e4:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8030e8:	83 c4 10             	add    $0x10,%esp
+  8030eb:	eb 47                	jmp    803134 <__moddi3+0x9d>
+  8030ed:	f7 d8                	neg    %eax
+  8030ef:	83 d2 00             	adc    $0x0,%edx
+  8030f2:	f7 da                	neg    %edx
+  8030f4:	83 ec 04             	sub    $0x4,%esp
+  8030f7:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8030fb:	56                   	push   %esi
+  8030fc:	89 cf                	mov    %ecx,%edi
+  8030fe:	f7 df                	neg    %edi
+  803100:	89 de                	mov    %ebx,%esi
+  803102:	83 d6 00             	adc    $0x0,%esi
+  803105:	f7 de                	neg    %esi
+  803107:	0f 49 cf             	cmovns %edi,%ecx
+  80310a:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  80310e:	0f 49 de             	cmovns %esi,%ebx
+  803111:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  803115:	ff 74 24 0c          	push   0xc(%esp)
+  803119:	ff 74 24 0c          	push   0xc(%esp)
+  80311d:	e8 d4 fd ff ff       	call   802ef6 <udivmod>
+  803122:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803126:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80312a:	f7 d8                	neg    %eax
+  80312c:	83 d2 00             	adc    $0x0,%edx
+  80312f:	f7 da                	neg    %edx
+  803131:	83 c4 10             	add    $0x10,%esp
+  803134:	83 c4 24             	add    $0x24,%esp
+  803137:	5b                   	pop    %ebx
+  803138:	5e                   	pop    %esi
+  803139:	5f                   	pop    %edi
+  80313a:	5d                   	pop    %ebp
+  80313b:	c3                   	ret
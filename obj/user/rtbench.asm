@@ -0,0 +1,7493 @@
+
+obj/user/rtbench.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 55 03 00 00       	call   800386 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <begin>:
+static struct Fsret_stats before;
+static unsigned start;
+
+static void
+begin(void)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+  int r;
+
+  if ((r = fs_stats(0, &before)) < 0)
+  800039:	68 20 50 80 00       	push   $0x805020
+  80003e:	6a 00                	push   $0x0
+  800040:	e8 a4 21 00 00       	call   8021e9 <fs_stats>
+  800045:	83 c4 10             	add    $0x10,%esp
+  800048:	85 c0                	test   %eax,%eax
+  80004a:	78 0c                	js     800058 <begin+0x25>
+    panic("fs_stats: %e", r);
+  start = sys_time_msec();
+  80004c:	e8 b4 11 00 00       	call   801205 <sys_time_msec>
+  800051:	a3 00 50 80 00       	mov    %eax,0x805000
+}
+  800056:	c9                   	leave
+  800057:	c3                   	ret
+    panic("fs_stats: %e", r);
+  800058:	50                   	push   %eax
+  800059:	68 a0 39 80 00       	push   $0x8039a0
+  80005e:	6a 16                	push   $0x16
+  800060:	68 ad 39 80 00       	push   $0x8039ad
+  800065:	e8 89 03 00 00       	call   8003f3 <_panic>
+
+0080006a <end>:
+
+static void
+end(const char *what, int n)
+{
+  80006a:	55                   	push   %ebp
+  80006b:	89 e5                	mov    %esp,%ebp
+  80006d:	57                   	push   %edi
+  80006e:	56                   	push   %esi
+  80006f:	53                   	push   %ebx
+  800070:	83 ec 6c             	sub    $0x6c,%esp
+  800073:	89 c3                	mov    %eax,%ebx
+  800075:	89 d6                	mov    %edx,%esi
+  struct Fsret_stats after;
+  unsigned ms;
+  int r;
+
+  ms = sys_time_msec() - start;
+  800077:	e8 89 11 00 00       	call   801205 <sys_time_msec>
+  80007c:	2b 05 00 50 80 00    	sub    0x805000,%eax
+  800082:	89 c7                	mov    %eax,%edi
+  if ((r = fs_stats(0, &after)) < 0)
+  800084:	83 ec 08             	sub    $0x8,%esp
+  800087:	8d 45 90             	lea    -0x70(%ebp),%eax
+  80008a:	50                   	push   %eax
+  80008b:	6a 00                	push   $0x0
+  80008d:	e8 57 21 00 00       	call   8021e9 <fs_stats>
+  800092:	83 c4 10             	add    $0x10,%esp
+  800095:	85 c0                	test   %eax,%eax
+  800097:	78 38                	js     8000d1 <end+0x67>
+    panic("fs_stats: %e", r);
+  // The second fs_stats counts itself.
+  cprintf("rtbench: %-18s %2d requests  %5d us\n", what,
+          (after.ret_fs_requests - before.ret_fs_requests - 1) / n,
+          ms * 1000 / n);
+  800099:	69 c7 e8 03 00 00    	imul   $0x3e8,%edi,%eax
+  cprintf("rtbench: %-18s %2d requests  %5d us\n", what,
+  80009f:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000a4:	f7 f6                	div    %esi
+  8000a6:	50                   	push   %eax
+          (after.ret_fs_requests - before.ret_fs_requests - 1) / n,
+  8000a7:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8000aa:	83 e8 01             	sub    $0x1,%eax
+  8000ad:	2b 05 60 50 80 00    	sub    0x805060,%eax
+  cprintf("rtbench: %-18s %2d requests  %5d us\n", what,
+  8000b3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000b8:	f7 f6                	div    %esi
+  8000ba:	50                   	push   %eax
+  8000bb:	53                   	push   %ebx
+  8000bc:	68 30 3a 80 00       	push   $0x803a30
+  8000c1:	e8 08 04 00 00       	call   8004ce <cprintf>
+}
+  8000c6:	83 c4 10             	add    $0x10,%esp
+  8000c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000cc:	5b                   	pop    %ebx
+  8000cd:	5e                   	pop    %esi
+  8000ce:	5f                   	pop    %edi
+  8000cf:	5d                   	pop    %ebp
+  8000d0:	c3                   	ret
+    panic("fs_stats: %e", r);
+  8000d1:	50                   	push   %eax
+  8000d2:	68 a0 39 80 00       	push   $0x8039a0
+  8000d7:	6a 23                	push   $0x23
+  8000d9:	68 ad 39 80 00       	push   $0x8039ad
+  8000de:	e8 10 03 00 00       	call   8003f3 <_panic>
+
+008000e3 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8000e3:	55                   	push   %ebp
+  8000e4:	89 e5                	mov    %esp,%ebp
+  8000e6:	57                   	push   %edi
+  8000e7:	56                   	push   %esi
+  8000e8:	53                   	push   %ebx
+  8000e9:	81 ec ac 02 00 00    	sub    $0x2ac,%esp
+  const char *cargv[] = { "rtbench", "child", 0 };
+  8000ef:	c7 45 dc c3 39 80 00 	movl   $0x8039c3,-0x24(%ebp)
+  8000f6:	c7 45 e0 bc 39 80 00 	movl   $0x8039bc,-0x20(%ebp)
+  8000fd:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  struct Stat st;
+  ssize_t nread;
+  envid_t child;
+  int n, i, fd, r;
+
+  binaryname = "rtbench";
+  800104:	c7 05 00 40 80 00 c3 	movl   $0x8039c3,0x804000
+  80010b:	39 80 00 
+  if (argc > 1 && strcmp(argv[1], "child") == 0)
+  80010e:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+  800112:	7e 37                	jle    80014b <umain+0x68>
+  800114:	83 ec 08             	sub    $0x8,%esp
+  800117:	68 bc 39 80 00       	push   $0x8039bc
+  80011c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80011f:	ff 70 04             	push   0x4(%eax)
+  800122:	e8 46 0a 00 00       	call   800b6d <strcmp>
+  800127:	83 c4 10             	add    $0x10,%esp
+  80012a:	85 c0                	test   %eax,%eax
+  80012c:	0f 84 3a 02 00 00    	je     80036c <umain+0x289>
+    return;
+
+  n = 100;
+  if (argc > 1)
+    n = strtol(argv[1], 0, 0);
+  800132:	83 ec 04             	sub    $0x4,%esp
+  800135:	6a 00                	push   $0x0
+  800137:	6a 00                	push   $0x0
+  800139:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80013c:	ff 70 04             	push   0x4(%eax)
+  80013f:	e8 cc 0b 00 00       	call   800d10 <strtol>
+  800144:	89 c6                	mov    %eax,%esi
+  800146:	83 c4 10             	add    $0x10,%esp
+  800149:	eb 05                	jmp    800150 <umain+0x6d>
+  n = 100;
+  80014b:	be 64 00 00 00       	mov    $0x64,%esi
+
+  begin();
+  800150:	e8 de fe ff ff       	call   800033 <begin>
+  for (i = 0; i < n; i++) {
+  800155:	bf 00 00 00 00       	mov    $0x0,%edi
+  80015a:	39 fe                	cmp    %edi,%esi
+  80015c:	7e 5a                	jle    8001b8 <umain+0xd5>
+    if ((fd = open(PROG, O_RDONLY)) < 0 || (r = fstat(fd, &st)) < 0)
+  80015e:	83 ec 08             	sub    $0x8,%esp
+  800161:	6a 00                	push   $0x0
+  800163:	68 c2 39 80 00       	push   $0x8039c2
+  800168:	e8 7d 1d 00 00       	call   801eea <open>
+  80016d:	89 c3                	mov    %eax,%ebx
+  80016f:	83 c4 10             	add    $0x10,%esp
+  800172:	85 c0                	test   %eax,%eax
+  800174:	78 28                	js     80019e <umain+0xbb>
+  800176:	83 ec 08             	sub    $0x8,%esp
+  800179:	8d 85 50 fd ff ff    	lea    -0x2b0(%ebp),%eax
+  80017f:	50                   	push   %eax
+  800180:	53                   	push   %ebx
+  800181:	e8 31 17 00 00       	call   8018b7 <fstat>
+  800186:	83 c4 10             	add    $0x10,%esp
+  800189:	85 c0                	test   %eax,%eax
+  80018b:	78 11                	js     80019e <umain+0xbb>
+      panic("stat %s: %e", PROG, fd < 0 ? fd : r);
+    close(fd);
+  80018d:	83 ec 0c             	sub    $0xc,%esp
+  800190:	53                   	push   %ebx
+  800191:	e8 a1 13 00 00       	call   801537 <close>
+  for (i = 0; i < n; i++) {
+  800196:	83 c7 01             	add    $0x1,%edi
+  800199:	83 c4 10             	add    $0x10,%esp
+  80019c:	eb bc                	jmp    80015a <umain+0x77>
+      panic("stat %s: %e", PROG, fd < 0 ? fd : r);
+  80019e:	83 ec 0c             	sub    $0xc,%esp
+  8001a1:	50                   	push   %eax
+  8001a2:	68 c2 39 80 00       	push   $0x8039c2
+  8001a7:	68 cb 39 80 00       	push   $0x8039cb
+  8001ac:	6a 3f                	push   $0x3f
+  8001ae:	68 ad 39 80 00       	push   $0x8039ad
+  8001b3:	e8 3b 02 00 00       	call   8003f3 <_panic>
+  }
+  end("open+fstat+close", n);
+  8001b8:	89 f2                	mov    %esi,%edx
+  8001ba:	b8 d7 39 80 00       	mov    $0x8039d7,%eax
+  8001bf:	e8 a6 fe ff ff       	call   80006a <end>
+
+  begin();
+  8001c4:	e8 6a fe ff ff       	call   800033 <begin>
+  for (i = 0; i < n; i++)
+  8001c9:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if ((r = stat(PROG, &st)) < 0)
+  8001ce:	8d bd 50 fd ff ff    	lea    -0x2b0(%ebp),%edi
+  for (i = 0; i < n; i++)
+  8001d4:	39 de                	cmp    %ebx,%esi
+  8001d6:	7e 34                	jle    80020c <umain+0x129>
+    if ((r = stat(PROG, &st)) < 0)
+  8001d8:	83 ec 08             	sub    $0x8,%esp
+  8001db:	57                   	push   %edi
+  8001dc:	68 c2 39 80 00       	push   $0x8039c2
+  8001e1:	e8 46 17 00 00       	call   80192c <stat>
+  8001e6:	83 c4 10             	add    $0x10,%esp
+  8001e9:	85 c0                	test   %eax,%eax
+  8001eb:	78 05                	js     8001f2 <umain+0x10f>
+  for (i = 0; i < n; i++)
+  8001ed:	83 c3 01             	add    $0x1,%ebx
+  8001f0:	eb e2                	jmp    8001d4 <umain+0xf1>
+      panic("stat %s: %e", PROG, r);
+  8001f2:	83 ec 0c             	sub    $0xc,%esp
+  8001f5:	50                   	push   %eax
+  8001f6:	68 c2 39 80 00       	push   $0x8039c2
+  8001fb:	68 cb 39 80 00       	push   $0x8039cb
+  800200:	6a 47                	push   $0x47
+  800202:	68 ad 39 80 00       	push   $0x8039ad
+  800207:	e8 e7 01 00 00       	call   8003f3 <_panic>
+  end("stat", n);
+  80020c:	89 f2                	mov    %esi,%edx
+  80020e:	b8 e8 39 80 00       	mov    $0x8039e8,%eax
+  800213:	e8 52 fe ff ff       	call   80006a <end>
+
+  begin();
+  800218:	e8 16 fe ff ff       	call   800033 <begin>
+  for (i = 0; i < n; i++) {
+  80021d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800222:	39 fe                	cmp    %edi,%esi
+  800224:	7e 62                	jle    800288 <umain+0x1a5>
+    if ((fd = open(PROG, O_RDONLY)) < 0 ||
+  800226:	83 ec 08             	sub    $0x8,%esp
+  800229:	6a 00                	push   $0x0
+  80022b:	68 c2 39 80 00       	push   $0x8039c2
+  800230:	e8 b5 1c 00 00       	call   801eea <open>
+  800235:	89 c3                	mov    %eax,%ebx
+  800237:	83 c4 10             	add    $0x10,%esp
+  80023a:	85 c0                	test   %eax,%eax
+  80023c:	78 30                	js     80026e <umain+0x18b>
+        (r = readn(fd, hdr, sizeof(hdr))) != sizeof(hdr))
+  80023e:	83 ec 04             	sub    $0x4,%esp
+  800241:	68 00 02 00 00       	push   $0x200
+  800246:	8d 85 dc fd ff ff    	lea    -0x224(%ebp),%eax
+  80024c:	50                   	push   %eax
+  80024d:	53                   	push   %ebx
+  80024e:	e8 f3 14 00 00       	call   801746 <readn>
+    if ((fd = open(PROG, O_RDONLY)) < 0 ||
+  800253:	83 c4 10             	add    $0x10,%esp
+  800256:	3d 00 02 00 00       	cmp    $0x200,%eax
+  80025b:	75 11                	jne    80026e <umain+0x18b>
+      panic("read %s: %e", PROG, fd < 0 ? fd : r);
+    close(fd);
+  80025d:	83 ec 0c             	sub    $0xc,%esp
+  800260:	53                   	push   %ebx
+  800261:	e8 d1 12 00 00       	call   801537 <close>
+  for (i = 0; i < n; i++) {
+  800266:	83 c7 01             	add    $0x1,%edi
+  800269:	83 c4 10             	add    $0x10,%esp
+  80026c:	eb b4                	jmp    800222 <umain+0x13f>
+      panic("read %s: %e", PROG, fd < 0 ? fd : r);
+  80026e:	83 ec 0c             	sub    $0xc,%esp
+  800271:	50                   	push   %eax
+  800272:	68 c2 39 80 00       	push   $0x8039c2
+  800277:	68 03 3a 80 00       	push   $0x803a03
+  80027c:	6a 4e                	push   $0x4e
+  80027e:	68 ad 39 80 00       	push   $0x8039ad
+  800283:	e8 6b 01 00 00       	call   8003f3 <_panic>
+  }
+  end("open+readn+close", n);
+  800288:	89 f2                	mov    %esi,%edx
+  80028a:	b8 ed 39 80 00       	mov    $0x8039ed,%eax
+  80028f:	e8 d6 fd ff ff       	call   80006a <end>
+
+  begin();
+  800294:	e8 9a fd ff ff       	call   800033 <begin>
+  for (i = 0; i < n; i++) {
+  800299:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if ((fd = open_read(PROG, O_RDONLY, hdr, sizeof(hdr), &nread)) < 0 ||
+  80029e:	8d bd 4c fd ff ff    	lea    -0x2b4(%ebp),%edi
+  for (i = 0; i < n; i++) {
+  8002a4:	eb 0f                	jmp    8002b5 <umain+0x1d2>
+        nread != sizeof(hdr))
+      panic("open_read %s: %e", PROG, fd);
+    close(fd);
+  8002a6:	83 ec 0c             	sub    $0xc,%esp
+  8002a9:	50                   	push   %eax
+  8002aa:	e8 88 12 00 00       	call   801537 <close>
+  for (i = 0; i < n; i++) {
+  8002af:	83 c3 01             	add    $0x1,%ebx
+  8002b2:	83 c4 10             	add    $0x10,%esp
+  8002b5:	39 de                	cmp    %ebx,%esi
+  8002b7:	7e 49                	jle    800302 <umain+0x21f>
+    if ((fd = open_read(PROG, O_RDONLY, hdr, sizeof(hdr), &nread)) < 0 ||
+  8002b9:	83 ec 0c             	sub    $0xc,%esp
+  8002bc:	57                   	push   %edi
+  8002bd:	68 00 02 00 00       	push   $0x200
+  8002c2:	8d 85 dc fd ff ff    	lea    -0x224(%ebp),%eax
+  8002c8:	50                   	push   %eax
+  8002c9:	6a 00                	push   $0x0
+  8002cb:	68 c2 39 80 00       	push   $0x8039c2
+  8002d0:	e8 a3 1c 00 00       	call   801f78 <open_read>
+  8002d5:	83 c4 20             	add    $0x20,%esp
+  8002d8:	85 c0                	test   %eax,%eax
+  8002da:	78 0c                	js     8002e8 <umain+0x205>
+  8002dc:	81 bd 4c fd ff ff 00 	cmpl   $0x200,-0x2b4(%ebp)
+  8002e3:	02 00 00 
+  8002e6:	74 be                	je     8002a6 <umain+0x1c3>
+      panic("open_read %s: %e", PROG, fd);
+  8002e8:	83 ec 0c             	sub    $0xc,%esp
+  8002eb:	50                   	push   %eax
+  8002ec:	68 c2 39 80 00       	push   $0x8039c2
+  8002f1:	68 fe 39 80 00       	push   $0x8039fe
+  8002f6:	6a 57                	push   $0x57
+  8002f8:	68 ad 39 80 00       	push   $0x8039ad
+  8002fd:	e8 f1 00 00 00       	call   8003f3 <_panic>
+  }
+  end("open_read+close", n);
+  800302:	89 f2                	mov    %esi,%edx
+  800304:	b8 0f 3a 80 00       	mov    $0x803a0f,%eax
+  800309:	e8 5c fd ff ff       	call   80006a <end>
+
+  n = MAX(n / 10, 1);
+  80030e:	ba 67 66 66 66       	mov    $0x66666667,%edx
+  800313:	89 f0                	mov    %esi,%eax
+  800315:	f7 ea                	imul   %edx
+  800317:	c1 fa 02             	sar    $0x2,%edx
+  80031a:	c1 fe 1f             	sar    $0x1f,%esi
+  80031d:	29 f2                	sub    %esi,%edx
+  80031f:	89 d7                	mov    %edx,%edi
+  800321:	85 d2                	test   %edx,%edx
+  800323:	b8 01 00 00 00       	mov    $0x1,%eax
+  800328:	0f 4e f8             	cmovle %eax,%edi
+  begin();
+  80032b:	e8 03 fd ff ff       	call   800033 <begin>
+  for (i = 0; i < n; i++) {
+  800330:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if ((child = spawn(PROG, cargv)) < 0)
+  800335:	8d 75 dc             	lea    -0x24(%ebp),%esi
+  800338:	83 ec 08             	sub    $0x8,%esp
+  80033b:	56                   	push   %esi
+  80033c:	68 c2 39 80 00       	push   $0x8039c2
+  800341:	e8 85 20 00 00       	call   8023cb <spawn>
+  800346:	83 c4 10             	add    $0x10,%esp
+  800349:	85 c0                	test   %eax,%eax
+  80034b:	78 27                	js     800374 <umain+0x291>
+      panic("spawn: %e", child);
+    wait(child);
+  80034d:	83 ec 0c             	sub    $0xc,%esp
+  800350:	50                   	push   %eax
+  800351:	e8 88 30 00 00       	call   8033de <wait>
+  for (i = 0; i < n; i++) {
+  800356:	83 c3 01             	add    $0x1,%ebx
+  800359:	83 c4 10             	add    $0x10,%esp
+  80035c:	39 df                	cmp    %ebx,%edi
+  80035e:	75 d8                	jne    800338 <umain+0x255>
+  }
+  end("spawn", n);
+  800360:	89 fa                	mov    %edi,%edx
+  800362:	b8 29 3a 80 00       	mov    $0x803a29,%eax
+  800367:	e8 fe fc ff ff       	call   80006a <end>
+}
+  80036c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80036f:	5b                   	pop    %ebx
+  800370:	5e                   	pop    %esi
+  800371:	5f                   	pop    %edi
+  800372:	5d                   	pop    %ebp
+  800373:	c3                   	ret
+      panic("spawn: %e", child);
+  800374:	50                   	push   %eax
+  800375:	68 1f 3a 80 00       	push   $0x803a1f
+  80037a:	6a 60                	push   $0x60
+  80037c:	68 ad 39 80 00       	push   $0x8039ad
+  800381:	e8 6d 00 00 00       	call   8003f3 <_panic>
+
+00800386 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800386:	55                   	push   %ebp
+  800387:	89 e5                	mov    %esp,%ebp
+  800389:	56                   	push   %esi
+  80038a:	53                   	push   %ebx
+  80038b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80038e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  800391:	c7 05 e4 5e 80 00 00 	movl   $0x0,0x805ee4
+  800398:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  80039b:	e8 ca 0a 00 00       	call   800e6a <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  8003a0:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8003a5:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8003a8:	c1 e0 04             	shl    $0x4,%eax
+  8003ab:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8003b0:	a3 e4 5e 80 00       	mov    %eax,0x805ee4
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8003b5:	85 db                	test   %ebx,%ebx
+  8003b7:	7e 07                	jle    8003c0 <libmain+0x3a>
+    binaryname = argv[0];
+  8003b9:	8b 06                	mov    (%esi),%eax
+  8003bb:	a3 00 40 80 00       	mov    %eax,0x804000
+
+  // call user main routine
+  umain(argc, argv);
+  8003c0:	83 ec 08             	sub    $0x8,%esp
+  8003c3:	56                   	push   %esi
+  8003c4:	53                   	push   %ebx
+  8003c5:	e8 19 fd ff ff       	call   8000e3 <umain>
+
+  // exit gracefully
+  exit();
+  8003ca:	e8 0a 00 00 00       	call   8003d9 <exit>
+}
+  8003cf:	83 c4 10             	add    $0x10,%esp
+  8003d2:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8003d5:	5b                   	pop    %ebx
+  8003d6:	5e                   	pop    %esi
+  8003d7:	5d                   	pop    %ebp
+  8003d8:	c3                   	ret
+
+008003d9 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8003d9:	55                   	push   %ebp
+  8003da:	89 e5                	mov    %esp,%ebp
+  8003dc:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  8003df:	e8 80 11 00 00       	call   801564 <close_all>
+  sys_env_destroy(0);
+  8003e4:	83 ec 0c             	sub    $0xc,%esp
+  8003e7:	6a 00                	push   $0x0
+  8003e9:	e8 3b 0a 00 00       	call   800e29 <sys_env_destroy>
+}
+  8003ee:	83 c4 10             	add    $0x10,%esp
+  8003f1:	c9                   	leave
+  8003f2:	c3                   	ret
+
+008003f3 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8003f3:	55                   	push   %ebp
+  8003f4:	89 e5                	mov    %esp,%ebp
+  8003f6:	56                   	push   %esi
+  8003f7:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  8003f8:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  8003fb:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  800401:	e8 64 0a 00 00       	call   800e6a <sys_getenvid>
+  800406:	83 ec 0c             	sub    $0xc,%esp
+  800409:	ff 75 0c             	push   0xc(%ebp)
+  80040c:	ff 75 08             	push   0x8(%ebp)
+  80040f:	56                   	push   %esi
+  800410:	50                   	push   %eax
+  800411:	68 60 3a 80 00       	push   $0x803a60
+  800416:	e8 b3 00 00 00       	call   8004ce <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  80041b:	83 c4 18             	add    $0x18,%esp
+  80041e:	53                   	push   %ebx
+  80041f:	ff 75 10             	push   0x10(%ebp)
+  800422:	e8 56 00 00 00       	call   80047d <vcprintf>
+  cprintf("\n");
+  800427:	c7 04 24 1d 3f 80 00 	movl   $0x803f1d,(%esp)
+  80042e:	e8 9b 00 00 00       	call   8004ce <cprintf>
+  800433:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  800436:	cc                   	int3
+  while (1)
+  800437:	eb fd                	jmp    800436 <_panic+0x43>
+
+00800439 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800439:	55                   	push   %ebp
+  80043a:	89 e5                	mov    %esp,%ebp
+  80043c:	53                   	push   %ebx
+  80043d:	83 ec 04             	sub    $0x4,%esp
+  800440:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  800443:	8b 13                	mov    (%ebx),%edx
+  800445:	8d 42 01             	lea    0x1(%edx),%eax
+  800448:	89 03                	mov    %eax,(%ebx)
+  80044a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80044d:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  800451:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800456:	74 09                	je     800461 <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  800458:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80045c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80045f:	c9                   	leave
+  800460:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  800461:	83 ec 08             	sub    $0x8,%esp
+  800464:	68 ff 00 00 00       	push   $0xff
+  800469:	8d 43 08             	lea    0x8(%ebx),%eax
+  80046c:	50                   	push   %eax
+  80046d:	e8 7a 09 00 00       	call   800dec <sys_cputs>
+    b->idx = 0;
+  800472:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800478:	83 c4 10             	add    $0x10,%esp
+  80047b:	eb db                	jmp    800458 <putch+0x1f>
+
+0080047d <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80047d:	55                   	push   %ebp
+  80047e:	89 e5                	mov    %esp,%ebp
+  800480:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  800486:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80048d:	00 00 00 
+  b.cnt = 0;
+  800490:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800497:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  80049a:	ff 75 0c             	push   0xc(%ebp)
+  80049d:	ff 75 08             	push   0x8(%ebp)
+  8004a0:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8004a6:	50                   	push   %eax
+  8004a7:	68 39 04 80 00       	push   $0x800439
+  8004ac:	e8 14 01 00 00       	call   8005c5 <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  8004b1:	83 c4 08             	add    $0x8,%esp
+  8004b4:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8004ba:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8004c0:	50                   	push   %eax
+  8004c1:	e8 26 09 00 00       	call   800dec <sys_cputs>
+
+  return b.cnt;
+}
+  8004c6:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8004cc:	c9                   	leave
+  8004cd:	c3                   	ret
+
+008004ce <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8004ce:	55                   	push   %ebp
+  8004cf:	89 e5                	mov    %esp,%ebp
+  8004d1:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  8004d4:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  8004d7:	50                   	push   %eax
+  8004d8:	ff 75 08             	push   0x8(%ebp)
+  8004db:	e8 9d ff ff ff       	call   80047d <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  8004e0:	c9                   	leave
+  8004e1:	c3                   	ret
+
+008004e2 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  8004e2:	55                   	push   %ebp
+  8004e3:	89 e5                	mov    %esp,%ebp
+  8004e5:	57                   	push   %edi
+  8004e6:	56                   	push   %esi
+  8004e7:	53                   	push   %ebx
+  8004e8:	83 ec 1c             	sub    $0x1c,%esp
+  8004eb:	89 c7                	mov    %eax,%edi
+  8004ed:	89 d6                	mov    %edx,%esi
+  8004ef:	8b 45 08             	mov    0x8(%ebp),%eax
+  8004f2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8004f5:	89 d1                	mov    %edx,%ecx
+  8004f7:	89 c2                	mov    %eax,%edx
+  8004f9:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8004fc:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8004ff:	8b 45 10             	mov    0x10(%ebp),%eax
+  800502:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  800505:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800508:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80050f:	39 c2                	cmp    %eax,%edx
+  800511:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800514:	72 3e                	jb     800554 <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  800516:	83 ec 0c             	sub    $0xc,%esp
+  800519:	ff 75 18             	push   0x18(%ebp)
+  80051c:	83 eb 01             	sub    $0x1,%ebx
+  80051f:	53                   	push   %ebx
+  800520:	50                   	push   %eax
+  800521:	83 ec 08             	sub    $0x8,%esp
+  800524:	ff 75 e4             	push   -0x1c(%ebp)
+  800527:	ff 75 e0             	push   -0x20(%ebp)
+  80052a:	ff 75 dc             	push   -0x24(%ebp)
+  80052d:	ff 75 d8             	push   -0x28(%ebp)
+  800530:	e8 d3 32 00 00       	call   803808 <__udivdi3>
+  800535:	83 c4 18             	add    $0x18,%esp
+  800538:	52                   	push   %edx
+  800539:	50                   	push   %eax
+  80053a:	89 f2                	mov    %esi,%edx
+  80053c:	89 f8                	mov    %edi,%eax
+  80053e:	e8 9f ff ff ff       	call   8004e2 <printnum>
+  800543:	83 c4 20             	add    $0x20,%esp
+  800546:	eb 13                	jmp    80055b <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  800548:	83 ec 08             	sub    $0x8,%esp
+  80054b:	56                   	push   %esi
+  80054c:	ff 75 18             	push   0x18(%ebp)
+  80054f:	ff d7                	call   *%edi
+  800551:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  800554:	83 eb 01             	sub    $0x1,%ebx
+  800557:	85 db                	test   %ebx,%ebx
+  800559:	7f ed                	jg     800548 <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  80055b:	83 ec 08             	sub    $0x8,%esp
+  80055e:	56                   	push   %esi
+  80055f:	83 ec 04             	sub    $0x4,%esp
+  800562:	ff 75 e4             	push   -0x1c(%ebp)
+  800565:	ff 75 e0             	push   -0x20(%ebp)
+  800568:	ff 75 dc             	push   -0x24(%ebp)
+  80056b:	ff 75 d8             	push   -0x28(%ebp)
+  80056e:	e8 b6 32 00 00       	call   803829 <__umoddi3>
+  800573:	83 c4 14             	add    $0x14,%esp
+  800576:	0f be 80 83 3a 80 00 	movsbl 0x803a83(%eax),%eax
+  80057d:	50                   	push   %eax
+  80057e:	ff d7                	call   *%edi
+}
+  800580:	83 c4 10             	add    $0x10,%esp
+  800583:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800586:	5b                   	pop    %ebx
+  800587:	5e                   	pop    %esi
+  800588:	5f                   	pop    %edi
+  800589:	5d                   	pop    %ebp
+  80058a:	c3                   	ret
+
+0080058b <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  80058b:	55                   	push   %ebp
+  80058c:	89 e5                	mov    %esp,%ebp
+  80058e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  800591:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  800595:	8b 10                	mov    (%eax),%edx
+  800597:	3b 50 04             	cmp    0x4(%eax),%edx
+  80059a:	73 0a                	jae    8005a6 <sprintputch+0x1b>
+    *b->buf++ = ch;
+  80059c:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80059f:	89 08                	mov    %ecx,(%eax)
+  8005a1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8005a4:	88 02                	mov    %al,(%edx)
+}
+  8005a6:	5d                   	pop    %ebp
+  8005a7:	c3                   	ret
+
+008005a8 <printfmt>:
+{
+  8005a8:	55                   	push   %ebp
+  8005a9:	89 e5                	mov    %esp,%ebp
+  8005ab:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  8005ae:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  8005b1:	50                   	push   %eax
+  8005b2:	ff 75 10             	push   0x10(%ebp)
+  8005b5:	ff 75 0c             	push   0xc(%ebp)
+  8005b8:	ff 75 08             	push   0x8(%ebp)
+  8005bb:	e8 05 00 00 00       	call   8005c5 <vprintfmt>
+}
+  8005c0:	83 c4 10             	add    $0x10,%esp
+  8005c3:	c9                   	leave
+  8005c4:	c3                   	ret
+
+008005c5 <vprintfmt>:
+{
+  8005c5:	55                   	push   %ebp
+  8005c6:	89 e5                	mov    %esp,%ebp
+  8005c8:	57                   	push   %edi
+  8005c9:	56                   	push   %esi
+  8005ca:	53                   	push   %ebx
+  8005cb:	83 ec 2c             	sub    $0x2c,%esp
+  8005ce:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005d1:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8005d4:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8005d7:	eb 0a                	jmp    8005e3 <vprintfmt+0x1e>
+      putch(ch, putdat);
+  8005d9:	83 ec 08             	sub    $0x8,%esp
+  8005dc:	53                   	push   %ebx
+  8005dd:	50                   	push   %eax
+  8005de:	ff d6                	call   *%esi
+  8005e0:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  8005e3:	83 c7 01             	add    $0x1,%edi
+  8005e6:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8005ea:	83 f8 25             	cmp    $0x25,%eax
+  8005ed:	74 0c                	je     8005fb <vprintfmt+0x36>
+      if (ch == '\0')
+  8005ef:	85 c0                	test   %eax,%eax
+  8005f1:	75 e6                	jne    8005d9 <vprintfmt+0x14>
+}
+  8005f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8005f6:	5b                   	pop    %ebx
+  8005f7:	5e                   	pop    %esi
+  8005f8:	5f                   	pop    %edi
+  8005f9:	5d                   	pop    %ebp
+  8005fa:	c3                   	ret
+    padc = ' ';
+  8005fb:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  8005ff:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  800606:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  80060d:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  800614:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  800619:	8d 47 01             	lea    0x1(%edi),%eax
+  80061c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80061f:	0f b6 17             	movzbl (%edi),%edx
+  800622:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800625:	3c 55                	cmp    $0x55,%al
+  800627:	0f 87 cf 03 00 00    	ja     8009fc <vprintfmt+0x437>
+  80062d:	0f b6 c0             	movzbl %al,%eax
+  800630:	ff 24 85 c0 3b 80 00 	jmp    *0x803bc0(,%eax,4)
+  800637:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  80063a:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80063e:	eb d9                	jmp    800619 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  800640:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800643:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800647:	eb d0                	jmp    800619 <vprintfmt+0x54>
+  800649:	0f b6 d2             	movzbl %dl,%edx
+  80064c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  80064f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800654:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  800657:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80065a:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  80065e:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  800661:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800664:	83 f9 09             	cmp    $0x9,%ecx
+  800667:	77 55                	ja     8006be <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  800669:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  80066c:	eb e9                	jmp    800657 <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  80066e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800671:	8b 00                	mov    (%eax),%eax
+  800673:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800676:	8b 45 14             	mov    0x14(%ebp),%eax
+  800679:	8d 40 04             	lea    0x4(%eax),%eax
+  80067c:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  80067f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  800682:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800686:	79 91                	jns    800619 <vprintfmt+0x54>
+        width = precision, precision = -1;
+  800688:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80068b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80068e:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800695:	eb 82                	jmp    800619 <vprintfmt+0x54>
+      if (width < 0)
+  800697:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80069a:	85 d2                	test   %edx,%edx
+  80069c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006a1:	0f 49 c2             	cmovns %edx,%eax
+  8006a4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  8006a7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  8006aa:	e9 6a ff ff ff       	jmp    800619 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  8006af:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  8006b2:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  8006b9:	e9 5b ff ff ff       	jmp    800619 <vprintfmt+0x54>
+  8006be:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8006c1:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8006c4:	eb bc                	jmp    800682 <vprintfmt+0xbd>
+      lflag++;
+  8006c6:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  8006c9:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  8006cc:	e9 48 ff ff ff       	jmp    800619 <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  8006d1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d4:	8d 78 04             	lea    0x4(%eax),%edi
+  8006d7:	83 ec 08             	sub    $0x8,%esp
+  8006da:	53                   	push   %ebx
+  8006db:	ff 30                	push   (%eax)
+  8006dd:	ff d6                	call   *%esi
+      break;
+  8006df:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  8006e2:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  8006e5:	e9 b1 02 00 00       	jmp    80099b <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  8006ea:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006ed:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  8006f0:	8b 10                	mov    (%eax),%edx
+  8006f2:	89 d0                	mov    %edx,%eax
+  8006f4:	f7 d8                	neg    %eax
+  8006f6:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8006f9:	83 f8 10             	cmp    $0x10,%eax
+  8006fc:	7f 23                	jg     800721 <vprintfmt+0x15c>
+  8006fe:	8b 14 85 20 3d 80 00 	mov    0x803d20(,%eax,4),%edx
+  800705:	85 d2                	test   %edx,%edx
+  800707:	74 18                	je     800721 <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  800709:	52                   	push   %edx
+  80070a:	68 6a 3e 80 00       	push   $0x803e6a
+  80070f:	53                   	push   %ebx
+  800710:	56                   	push   %esi
+  800711:	e8 92 fe ff ff       	call   8005a8 <printfmt>
+  800716:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  800719:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80071c:	e9 7a 02 00 00       	jmp    80099b <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  800721:	50                   	push   %eax
+  800722:	68 9b 3a 80 00       	push   $0x803a9b
+  800727:	53                   	push   %ebx
+  800728:	56                   	push   %esi
+  800729:	e8 7a fe ff ff       	call   8005a8 <printfmt>
+  80072e:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  800731:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  800734:	e9 62 02 00 00       	jmp    80099b <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  800739:	8b 45 14             	mov    0x14(%ebp),%eax
+  80073c:	83 c0 04             	add    $0x4,%eax
+  80073f:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800742:	8b 45 14             	mov    0x14(%ebp),%eax
+  800745:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  800747:	85 c9                	test   %ecx,%ecx
+  800749:	b8 94 3a 80 00       	mov    $0x803a94,%eax
+  80074e:	0f 45 c1             	cmovne %ecx,%eax
+  800751:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  800754:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800758:	7e 06                	jle    800760 <vprintfmt+0x19b>
+  80075a:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80075e:	75 0b                	jne    80076b <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800760:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800763:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800766:	89 75 08             	mov    %esi,0x8(%ebp)
+  800769:	eb 5c                	jmp    8007c7 <vprintfmt+0x202>
+  80076b:	83 ec 08             	sub    $0x8,%esp
+  80076e:	ff 75 d0             	push   -0x30(%ebp)
+  800771:	ff 75 cc             	push   -0x34(%ebp)
+  800774:	e8 20 03 00 00       	call   800a99 <strnlen>
+  800779:	89 c2                	mov    %eax,%edx
+  80077b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80077e:	29 d0                	sub    %edx,%eax
+  800780:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  800783:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800787:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80078a:	89 75 08             	mov    %esi,0x8(%ebp)
+  80078d:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  80078f:	eb 0e                	jmp    80079f <vprintfmt+0x1da>
+          putch(padc, putdat);
+  800791:	83 ec 08             	sub    $0x8,%esp
+  800794:	53                   	push   %ebx
+  800795:	57                   	push   %edi
+  800796:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800799:	83 ee 01             	sub    $0x1,%esi
+  80079c:	83 c4 10             	add    $0x10,%esp
+  80079f:	85 f6                	test   %esi,%esi
+  8007a1:	7f ee                	jg     800791 <vprintfmt+0x1cc>
+  8007a3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8007a6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007a9:	85 c0                	test   %eax,%eax
+  8007ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8007b0:	0f 49 d0             	cmovns %eax,%edx
+  8007b3:	29 d0                	sub    %edx,%eax
+  8007b5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8007b8:	eb a6                	jmp    800760 <vprintfmt+0x19b>
+          putch(ch, putdat);
+  8007ba:	83 ec 08             	sub    $0x8,%esp
+  8007bd:	53                   	push   %ebx
+  8007be:	52                   	push   %edx
+  8007bf:	ff 55 08             	call   *0x8(%ebp)
+  8007c2:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8007c5:	89 f1                	mov    %esi,%ecx
+  8007c7:	8d 71 01             	lea    0x1(%ecx),%esi
+  8007ca:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8007ce:	0f be d0             	movsbl %al,%edx
+  8007d1:	85 d2                	test   %edx,%edx
+  8007d3:	74 28                	je     8007fd <vprintfmt+0x238>
+  8007d5:	85 ff                	test   %edi,%edi
+  8007d7:	78 05                	js     8007de <vprintfmt+0x219>
+  8007d9:	83 ef 01             	sub    $0x1,%edi
+  8007dc:	78 30                	js     80080e <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  8007de:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8007e2:	74 d6                	je     8007ba <vprintfmt+0x1f5>
+  8007e4:	0f be c0             	movsbl %al,%eax
+  8007e7:	83 e8 20             	sub    $0x20,%eax
+  8007ea:	83 f8 5e             	cmp    $0x5e,%eax
+  8007ed:	76 cb                	jbe    8007ba <vprintfmt+0x1f5>
+          putch('?', putdat);
+  8007ef:	83 ec 08             	sub    $0x8,%esp
+  8007f2:	53                   	push   %ebx
+  8007f3:	6a 3f                	push   $0x3f
+  8007f5:	ff 55 08             	call   *0x8(%ebp)
+  8007f8:	83 c4 10             	add    $0x10,%esp
+  8007fb:	eb c8                	jmp    8007c5 <vprintfmt+0x200>
+  8007fd:	8b 75 08             	mov    0x8(%ebp),%esi
+  800800:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800803:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800806:	01 d0                	add    %edx,%eax
+  800808:	29 c8                	sub    %ecx,%eax
+  80080a:	89 c7                	mov    %eax,%edi
+  80080c:	eb 13                	jmp    800821 <vprintfmt+0x25c>
+  80080e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800811:	eb ed                	jmp    800800 <vprintfmt+0x23b>
+        putch(' ', putdat);
+  800813:	83 ec 08             	sub    $0x8,%esp
+  800816:	53                   	push   %ebx
+  800817:	6a 20                	push   $0x20
+  800819:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  80081b:	83 ef 01             	sub    $0x1,%edi
+  80081e:	83 c4 10             	add    $0x10,%esp
+  800821:	85 ff                	test   %edi,%edi
+  800823:	7f ee                	jg     800813 <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  800825:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800828:	89 45 14             	mov    %eax,0x14(%ebp)
+  80082b:	e9 6b 01 00 00       	jmp    80099b <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  800830:	83 f9 01             	cmp    $0x1,%ecx
+  800833:	7f 1f                	jg     800854 <vprintfmt+0x28f>
+  else if (lflag)
+  800835:	85 c9                	test   %ecx,%ecx
+  800837:	74 67                	je     8008a0 <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  800839:	8b 45 14             	mov    0x14(%ebp),%eax
+  80083c:	8b 00                	mov    (%eax),%eax
+  80083e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800841:	89 c1                	mov    %eax,%ecx
+  800843:	c1 f9 1f             	sar    $0x1f,%ecx
+  800846:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800849:	8b 45 14             	mov    0x14(%ebp),%eax
+  80084c:	8d 40 04             	lea    0x4(%eax),%eax
+  80084f:	89 45 14             	mov    %eax,0x14(%ebp)
+  800852:	eb 17                	jmp    80086b <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  800854:	8b 45 14             	mov    0x14(%ebp),%eax
+  800857:	8b 50 04             	mov    0x4(%eax),%edx
+  80085a:	8b 00                	mov    (%eax),%eax
+  80085c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80085f:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800862:	8b 45 14             	mov    0x14(%ebp),%eax
+  800865:	8d 40 08             	lea    0x8(%eax),%eax
+  800868:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  80086b:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80086e:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  800871:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  800876:	85 c9                	test   %ecx,%ecx
+  800878:	0f 89 03 01 00 00    	jns    800981 <vprintfmt+0x3bc>
+        putch('-', putdat);
+  80087e:	83 ec 08             	sub    $0x8,%esp
+  800881:	53                   	push   %ebx
+  800882:	6a 2d                	push   $0x2d
+  800884:	ff d6                	call   *%esi
+        num = -(long long)num;
+  800886:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800889:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80088c:	f7 da                	neg    %edx
+  80088e:	83 d1 00             	adc    $0x0,%ecx
+  800891:	f7 d9                	neg    %ecx
+  800893:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  800896:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80089b:	e9 e1 00 00 00       	jmp    800981 <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  8008a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008a3:	8b 00                	mov    (%eax),%eax
+  8008a5:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8008a8:	89 c1                	mov    %eax,%ecx
+  8008aa:	c1 f9 1f             	sar    $0x1f,%ecx
+  8008ad:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8008b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008b3:	8d 40 04             	lea    0x4(%eax),%eax
+  8008b6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8008b9:	eb b0                	jmp    80086b <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  8008bb:	83 f9 01             	cmp    $0x1,%ecx
+  8008be:	7f 1e                	jg     8008de <vprintfmt+0x319>
+  else if (lflag)
+  8008c0:	85 c9                	test   %ecx,%ecx
+  8008c2:	74 32                	je     8008f6 <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  8008c4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008c7:	8b 10                	mov    (%eax),%edx
+  8008c9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008ce:	8d 40 04             	lea    0x4(%eax),%eax
+  8008d1:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  8008d4:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  8008d9:	e9 a3 00 00 00       	jmp    800981 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  8008de:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008e1:	8b 10                	mov    (%eax),%edx
+  8008e3:	8b 48 04             	mov    0x4(%eax),%ecx
+  8008e6:	8d 40 08             	lea    0x8(%eax),%eax
+  8008e9:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  8008ec:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  8008f1:	e9 8b 00 00 00       	jmp    800981 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8008f6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008f9:	8b 10                	mov    (%eax),%edx
+  8008fb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800900:	8d 40 04             	lea    0x4(%eax),%eax
+  800903:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800906:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  80090b:	eb 74                	jmp    800981 <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  80090d:	83 f9 01             	cmp    $0x1,%ecx
+  800910:	7f 1b                	jg     80092d <vprintfmt+0x368>
+  else if (lflag)
+  800912:	85 c9                	test   %ecx,%ecx
+  800914:	74 2c                	je     800942 <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  800916:	8b 45 14             	mov    0x14(%ebp),%eax
+  800919:	8b 10                	mov    (%eax),%edx
+  80091b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800920:	8d 40 04             	lea    0x4(%eax),%eax
+  800923:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800926:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  80092b:	eb 54                	jmp    800981 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  80092d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800930:	8b 10                	mov    (%eax),%edx
+  800932:	8b 48 04             	mov    0x4(%eax),%ecx
+  800935:	8d 40 08             	lea    0x8(%eax),%eax
+  800938:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  80093b:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  800940:	eb 3f                	jmp    800981 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800942:	8b 45 14             	mov    0x14(%ebp),%eax
+  800945:	8b 10                	mov    (%eax),%edx
+  800947:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80094c:	8d 40 04             	lea    0x4(%eax),%eax
+  80094f:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800952:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  800957:	eb 28                	jmp    800981 <vprintfmt+0x3bc>
+      putch('0', putdat);
+  800959:	83 ec 08             	sub    $0x8,%esp
+  80095c:	53                   	push   %ebx
+  80095d:	6a 30                	push   $0x30
+  80095f:	ff d6                	call   *%esi
+      putch('x', putdat);
+  800961:	83 c4 08             	add    $0x8,%esp
+  800964:	53                   	push   %ebx
+  800965:	6a 78                	push   $0x78
+  800967:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  800969:	8b 45 14             	mov    0x14(%ebp),%eax
+  80096c:	8b 10                	mov    (%eax),%edx
+  80096e:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  800973:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  800976:	8d 40 04             	lea    0x4(%eax),%eax
+  800979:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  80097c:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  800981:	83 ec 0c             	sub    $0xc,%esp
+  800984:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800988:	50                   	push   %eax
+  800989:	ff 75 e0             	push   -0x20(%ebp)
+  80098c:	57                   	push   %edi
+  80098d:	51                   	push   %ecx
+  80098e:	52                   	push   %edx
+  80098f:	89 da                	mov    %ebx,%edx
+  800991:	89 f0                	mov    %esi,%eax
+  800993:	e8 4a fb ff ff       	call   8004e2 <printnum>
+      break;
+  800998:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  80099b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  80099e:	e9 40 fc ff ff       	jmp    8005e3 <vprintfmt+0x1e>
+  if (lflag >= 2)
+  8009a3:	83 f9 01             	cmp    $0x1,%ecx
+  8009a6:	7f 1b                	jg     8009c3 <vprintfmt+0x3fe>
+  else if (lflag)
+  8009a8:	85 c9                	test   %ecx,%ecx
+  8009aa:	74 2c                	je     8009d8 <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  8009ac:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009af:	8b 10                	mov    (%eax),%edx
+  8009b1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009b6:	8d 40 04             	lea    0x4(%eax),%eax
+  8009b9:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8009bc:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  8009c1:	eb be                	jmp    800981 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  8009c3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009c6:	8b 10                	mov    (%eax),%edx
+  8009c8:	8b 48 04             	mov    0x4(%eax),%ecx
+  8009cb:	8d 40 08             	lea    0x8(%eax),%eax
+  8009ce:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8009d1:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  8009d6:	eb a9                	jmp    800981 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8009d8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009db:	8b 10                	mov    (%eax),%edx
+  8009dd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8009e2:	8d 40 04             	lea    0x4(%eax),%eax
+  8009e5:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8009e8:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  8009ed:	eb 92                	jmp    800981 <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  8009ef:	83 ec 08             	sub    $0x8,%esp
+  8009f2:	53                   	push   %ebx
+  8009f3:	6a 25                	push   $0x25
+  8009f5:	ff d6                	call   *%esi
+      break;
+  8009f7:	83 c4 10             	add    $0x10,%esp
+  8009fa:	eb 9f                	jmp    80099b <vprintfmt+0x3d6>
+      putch('%', putdat);
+  8009fc:	83 ec 08             	sub    $0x8,%esp
+  8009ff:	53                   	push   %ebx
+  800a00:	6a 25                	push   $0x25
+  800a02:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  800a04:	83 c4 10             	add    $0x10,%esp
+  800a07:	89 f8                	mov    %edi,%eax
+  800a09:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800a0d:	74 05                	je     800a14 <vprintfmt+0x44f>
+  800a0f:	83 e8 01             	sub    $0x1,%eax
+  800a12:	eb f5                	jmp    800a09 <vprintfmt+0x444>
+  800a14:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800a17:	eb 82                	jmp    80099b <vprintfmt+0x3d6>
+
+00800a19 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800a19:	55                   	push   %ebp
+  800a1a:	89 e5                	mov    %esp,%ebp
+  800a1c:	83 ec 18             	sub    $0x18,%esp
+  800a1f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a22:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  800a25:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800a28:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800a2c:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800a2f:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  800a36:	85 c0                	test   %eax,%eax
+  800a38:	74 26                	je     800a60 <vsnprintf+0x47>
+  800a3a:	85 d2                	test   %edx,%edx
+  800a3c:	7e 22                	jle    800a60 <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800a3e:	ff 75 14             	push   0x14(%ebp)
+  800a41:	ff 75 10             	push   0x10(%ebp)
+  800a44:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800a47:	50                   	push   %eax
+  800a48:	68 8b 05 80 00       	push   $0x80058b
+  800a4d:	e8 73 fb ff ff       	call   8005c5 <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800a52:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800a55:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  800a58:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a5b:	83 c4 10             	add    $0x10,%esp
+}
+  800a5e:	c9                   	leave
+  800a5f:	c3                   	ret
+    return -E_INVAL;
+  800a60:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a65:	eb f7                	jmp    800a5e <vsnprintf+0x45>
+
+00800a67 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800a67:	55                   	push   %ebp
+  800a68:	89 e5                	mov    %esp,%ebp
+  800a6a:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  800a6d:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  800a70:	50                   	push   %eax
+  800a71:	ff 75 10             	push   0x10(%ebp)
+  800a74:	ff 75 0c             	push   0xc(%ebp)
+  800a77:	ff 75 08             	push   0x8(%ebp)
+  800a7a:	e8 9a ff ff ff       	call   800a19 <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  800a7f:	c9                   	leave
+  800a80:	c3                   	ret
+
+00800a81 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800a81:	55                   	push   %ebp
+  800a82:	89 e5                	mov    %esp,%ebp
+  800a84:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  800a87:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a8c:	eb 03                	jmp    800a91 <strlen+0x10>
+    n++;
+  800a8e:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  800a91:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800a95:	75 f7                	jne    800a8e <strlen+0xd>
+  return n;
+}
+  800a97:	5d                   	pop    %ebp
+  800a98:	c3                   	ret
+
+00800a99 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800a99:	55                   	push   %ebp
+  800a9a:	89 e5                	mov    %esp,%ebp
+  800a9c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a9f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800aa2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aa7:	eb 03                	jmp    800aac <strnlen+0x13>
+    n++;
+  800aa9:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800aac:	39 d0                	cmp    %edx,%eax
+  800aae:	74 08                	je     800ab8 <strnlen+0x1f>
+  800ab0:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800ab4:	75 f3                	jne    800aa9 <strnlen+0x10>
+  800ab6:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  800ab8:	89 d0                	mov    %edx,%eax
+  800aba:	5d                   	pop    %ebp
+  800abb:	c3                   	ret
+
+00800abc <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800abc:	55                   	push   %ebp
+  800abd:	89 e5                	mov    %esp,%ebp
+  800abf:	53                   	push   %ebx
+  800ac0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800ac3:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  800ac6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800acb:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800acf:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800ad2:	83 c0 01             	add    $0x1,%eax
+  800ad5:	84 d2                	test   %dl,%dl
+  800ad7:	75 f2                	jne    800acb <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  800ad9:	89 c8                	mov    %ecx,%eax
+  800adb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ade:	c9                   	leave
+  800adf:	c3                   	ret
+
+00800ae0 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800ae0:	55                   	push   %ebp
+  800ae1:	89 e5                	mov    %esp,%ebp
+  800ae3:	53                   	push   %ebx
+  800ae4:	83 ec 10             	sub    $0x10,%esp
+  800ae7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  800aea:	53                   	push   %ebx
+  800aeb:	e8 91 ff ff ff       	call   800a81 <strlen>
+  800af0:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  800af3:	ff 75 0c             	push   0xc(%ebp)
+  800af6:	01 d8                	add    %ebx,%eax
+  800af8:	50                   	push   %eax
+  800af9:	e8 be ff ff ff       	call   800abc <strcpy>
+  return dst;
+}
+  800afe:	89 d8                	mov    %ebx,%eax
+  800b00:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b03:	c9                   	leave
+  800b04:	c3                   	ret
+
+00800b05 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  800b05:	55                   	push   %ebp
+  800b06:	89 e5                	mov    %esp,%ebp
+  800b08:	56                   	push   %esi
+  800b09:	53                   	push   %ebx
+  800b0a:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b0d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  800b10:	89 f3                	mov    %esi,%ebx
+  800b12:	03 5d 10             	add    0x10(%ebp),%ebx
+  800b15:	89 f0                	mov    %esi,%eax
+  800b17:	eb 0f                	jmp    800b28 <strncpy+0x23>
+    *dst++ = *src;
+  800b19:	83 c0 01             	add    $0x1,%eax
+  800b1c:	0f b6 0a             	movzbl (%edx),%ecx
+  800b1f:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  800b22:	80 f9 01             	cmp    $0x1,%cl
+  800b25:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  800b28:	39 d8                	cmp    %ebx,%eax
+  800b2a:	75 ed                	jne    800b19 <strncpy+0x14>
+  }
+  return ret;
+}
+  800b2c:	89 f0                	mov    %esi,%eax
+  800b2e:	5b                   	pop    %ebx
+  800b2f:	5e                   	pop    %esi
+  800b30:	5d                   	pop    %ebp
+  800b31:	c3                   	ret
+
+00800b32 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800b32:	55                   	push   %ebp
+  800b33:	89 e5                	mov    %esp,%ebp
+  800b35:	56                   	push   %esi
+  800b36:	53                   	push   %ebx
+  800b37:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b3a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b3d:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  800b40:	89 f0                	mov    %esi,%eax
+  800b42:	85 d2                	test   %edx,%edx
+  800b44:	74 21                	je     800b67 <strlcpy+0x35>
+  800b46:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800b4a:	89 f2                	mov    %esi,%edx
+  800b4c:	eb 09                	jmp    800b57 <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  800b4e:	83 c1 01             	add    $0x1,%ecx
+  800b51:	83 c2 01             	add    $0x1,%edx
+  800b54:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  800b57:	39 c2                	cmp    %eax,%edx
+  800b59:	74 09                	je     800b64 <strlcpy+0x32>
+  800b5b:	0f b6 19             	movzbl (%ecx),%ebx
+  800b5e:	84 db                	test   %bl,%bl
+  800b60:	75 ec                	jne    800b4e <strlcpy+0x1c>
+  800b62:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  800b64:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  800b67:	29 f0                	sub    %esi,%eax
+}
+  800b69:	5b                   	pop    %ebx
+  800b6a:	5e                   	pop    %esi
+  800b6b:	5d                   	pop    %ebp
+  800b6c:	c3                   	ret
+
+00800b6d <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800b6d:	55                   	push   %ebp
+  800b6e:	89 e5                	mov    %esp,%ebp
+  800b70:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b73:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  800b76:	eb 06                	jmp    800b7e <strcmp+0x11>
+    p++, q++;
+  800b78:	83 c1 01             	add    $0x1,%ecx
+  800b7b:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  800b7e:	0f b6 01             	movzbl (%ecx),%eax
+  800b81:	84 c0                	test   %al,%al
+  800b83:	74 04                	je     800b89 <strcmp+0x1c>
+  800b85:	3a 02                	cmp    (%edx),%al
+  800b87:	74 ef                	je     800b78 <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  800b89:	0f b6 c0             	movzbl %al,%eax
+  800b8c:	0f b6 12             	movzbl (%edx),%edx
+  800b8f:	29 d0                	sub    %edx,%eax
+}
+  800b91:	5d                   	pop    %ebp
+  800b92:	c3                   	ret
+
+00800b93 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800b93:	55                   	push   %ebp
+  800b94:	89 e5                	mov    %esp,%ebp
+  800b96:	53                   	push   %ebx
+  800b97:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b9a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b9d:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  800ba0:	eb 09                	jmp    800bab <strncmp+0x18>
+    n--, p++, q++;
+  800ba2:	83 ea 01             	sub    $0x1,%edx
+  800ba5:	83 c0 01             	add    $0x1,%eax
+  800ba8:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  800bab:	85 d2                	test   %edx,%edx
+  800bad:	74 18                	je     800bc7 <strncmp+0x34>
+  800baf:	0f b6 18             	movzbl (%eax),%ebx
+  800bb2:	84 db                	test   %bl,%bl
+  800bb4:	74 04                	je     800bba <strncmp+0x27>
+  800bb6:	3a 19                	cmp    (%ecx),%bl
+  800bb8:	74 e8                	je     800ba2 <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800bba:	0f b6 00             	movzbl (%eax),%eax
+  800bbd:	0f b6 11             	movzbl (%ecx),%edx
+  800bc0:	29 d0                	sub    %edx,%eax
+}
+  800bc2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800bc5:	c9                   	leave
+  800bc6:	c3                   	ret
+    return 0;
+  800bc7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bcc:	eb f4                	jmp    800bc2 <strncmp+0x2f>
+
+00800bce <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800bce:	55                   	push   %ebp
+  800bcf:	89 e5                	mov    %esp,%ebp
+  800bd1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bd4:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800bd8:	eb 03                	jmp    800bdd <strchr+0xf>
+  800bda:	83 c0 01             	add    $0x1,%eax
+  800bdd:	0f b6 10             	movzbl (%eax),%edx
+  800be0:	84 d2                	test   %dl,%dl
+  800be2:	74 06                	je     800bea <strchr+0x1c>
+    if (*s == c)
+  800be4:	38 ca                	cmp    %cl,%dl
+  800be6:	75 f2                	jne    800bda <strchr+0xc>
+  800be8:	eb 05                	jmp    800bef <strchr+0x21>
+      return (char*)s;
+  return 0;
+  800bea:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800bef:	5d                   	pop    %ebp
+  800bf0:	c3                   	ret
+
+00800bf1 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800bf1:	55                   	push   %ebp
+  800bf2:	89 e5                	mov    %esp,%ebp
+  800bf4:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bf7:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800bfb:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  800bfe:	38 ca                	cmp    %cl,%dl
+  800c00:	74 09                	je     800c0b <strfind+0x1a>
+  800c02:	84 d2                	test   %dl,%dl
+  800c04:	74 05                	je     800c0b <strfind+0x1a>
+  for (; *s; s++)
+  800c06:	83 c0 01             	add    $0x1,%eax
+  800c09:	eb f0                	jmp    800bfb <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  800c0b:	5d                   	pop    %ebp
+  800c0c:	c3                   	ret
+
+00800c0d <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800c0d:	55                   	push   %ebp
+  800c0e:	89 e5                	mov    %esp,%ebp
+  800c10:	57                   	push   %edi
+  800c11:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800c14:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  800c17:	85 c9                	test   %ecx,%ecx
+  800c19:	74 20                	je     800c3b <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  800c1b:	89 f8                	mov    %edi,%eax
+  800c1d:	09 c8                	or     %ecx,%eax
+  800c1f:	a8 03                	test   $0x3,%al
+  800c21:	75 12                	jne    800c35 <memset+0x28>
+    c &= 0xFF;
+  800c23:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800c27:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  800c2d:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  800c30:	fc                   	cld
+  800c31:	f3 ab                	rep stos %eax,%es:(%edi)
+  800c33:	eb 06                	jmp    800c3b <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  800c35:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c38:	fc                   	cld
+  800c39:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  800c3b:	89 f8                	mov    %edi,%eax
+  800c3d:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800c40:	c9                   	leave
+  800c41:	c3                   	ret
+
+00800c42 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800c42:	55                   	push   %ebp
+  800c43:	89 e5                	mov    %esp,%ebp
+  800c45:	57                   	push   %edi
+  800c46:	56                   	push   %esi
+  800c47:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c4a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800c4d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  800c50:	39 c6                	cmp    %eax,%esi
+  800c52:	73 32                	jae    800c86 <memmove+0x44>
+  800c54:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800c57:	39 d0                	cmp    %edx,%eax
+  800c59:	73 2b                	jae    800c86 <memmove+0x44>
+    s += n;
+    d += n;
+  800c5b:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c5e:	89 d6                	mov    %edx,%esi
+  800c60:	09 fe                	or     %edi,%esi
+  800c62:	09 ce                	or     %ecx,%esi
+  800c64:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800c6a:	75 0e                	jne    800c7a <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800c6c:	83 ef 04             	sub    $0x4,%edi
+  800c6f:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800c72:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  800c75:	fd                   	std
+  800c76:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c78:	eb 09                	jmp    800c83 <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800c7a:	83 ef 01             	sub    $0x1,%edi
+  800c7d:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  800c80:	fd                   	std
+  800c81:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  800c83:	fc                   	cld
+  800c84:	eb 1a                	jmp    800ca0 <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c86:	89 f2                	mov    %esi,%edx
+  800c88:	09 c2                	or     %eax,%edx
+  800c8a:	09 ca                	or     %ecx,%edx
+  800c8c:	f6 c2 03             	test   $0x3,%dl
+  800c8f:	75 0a                	jne    800c9b <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800c91:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  800c94:	89 c7                	mov    %eax,%edi
+  800c96:	fc                   	cld
+  800c97:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c99:	eb 05                	jmp    800ca0 <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  800c9b:	89 c7                	mov    %eax,%edi
+  800c9d:	fc                   	cld
+  800c9e:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  800ca0:	5e                   	pop    %esi
+  800ca1:	5f                   	pop    %edi
+  800ca2:	5d                   	pop    %ebp
+  800ca3:	c3                   	ret
+
+00800ca4 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800ca4:	55                   	push   %ebp
+  800ca5:	89 e5                	mov    %esp,%ebp
+  800ca7:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  800caa:	ff 75 10             	push   0x10(%ebp)
+  800cad:	ff 75 0c             	push   0xc(%ebp)
+  800cb0:	ff 75 08             	push   0x8(%ebp)
+  800cb3:	e8 8a ff ff ff       	call   800c42 <memmove>
+}
+  800cb8:	c9                   	leave
+  800cb9:	c3                   	ret
+
+00800cba <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800cba:	55                   	push   %ebp
+  800cbb:	89 e5                	mov    %esp,%ebp
+  800cbd:	56                   	push   %esi
+  800cbe:	53                   	push   %ebx
+  800cbf:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cc2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  800cc5:	89 c6                	mov    %eax,%esi
+  800cc7:	03 75 10             	add    0x10(%ebp),%esi
+  800cca:	eb 06                	jmp    800cd2 <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  800ccc:	83 c0 01             	add    $0x1,%eax
+  800ccf:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  800cd2:	39 f0                	cmp    %esi,%eax
+  800cd4:	74 14                	je     800cea <memcmp+0x30>
+    if (*s1 != *s2)
+  800cd6:	0f b6 08             	movzbl (%eax),%ecx
+  800cd9:	0f b6 1a             	movzbl (%edx),%ebx
+  800cdc:	38 d9                	cmp    %bl,%cl
+  800cde:	74 ec                	je     800ccc <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  800ce0:	0f b6 c1             	movzbl %cl,%eax
+  800ce3:	0f b6 db             	movzbl %bl,%ebx
+  800ce6:	29 d8                	sub    %ebx,%eax
+  800ce8:	eb 05                	jmp    800cef <memcmp+0x35>
+  }
+
+  return 0;
+  800cea:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800cef:	5b                   	pop    %ebx
+  800cf0:	5e                   	pop    %esi
+  800cf1:	5d                   	pop    %ebp
+  800cf2:	c3                   	ret
+
+00800cf3 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800cf3:	55                   	push   %ebp
+  800cf4:	89 e5                	mov    %esp,%ebp
+  800cf6:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cf9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  800cfc:	89 c2                	mov    %eax,%edx
+  800cfe:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  800d01:	eb 03                	jmp    800d06 <memfind+0x13>
+  800d03:	83 c0 01             	add    $0x1,%eax
+  800d06:	39 d0                	cmp    %edx,%eax
+  800d08:	73 04                	jae    800d0e <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  800d0a:	38 08                	cmp    %cl,(%eax)
+  800d0c:	75 f5                	jne    800d03 <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  800d0e:	5d                   	pop    %ebp
+  800d0f:	c3                   	ret
+
+00800d10 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800d10:	55                   	push   %ebp
+  800d11:	89 e5                	mov    %esp,%ebp
+  800d13:	57                   	push   %edi
+  800d14:	56                   	push   %esi
+  800d15:	53                   	push   %ebx
+  800d16:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d19:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  800d1c:	eb 03                	jmp    800d21 <strtol+0x11>
+    s++;
+  800d1e:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  800d21:	0f b6 02             	movzbl (%edx),%eax
+  800d24:	3c 20                	cmp    $0x20,%al
+  800d26:	74 f6                	je     800d1e <strtol+0xe>
+  800d28:	3c 09                	cmp    $0x9,%al
+  800d2a:	74 f2                	je     800d1e <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  800d2c:	3c 2b                	cmp    $0x2b,%al
+  800d2e:	74 2a                	je     800d5a <strtol+0x4a>
+  int neg = 0;
+  800d30:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  800d35:	3c 2d                	cmp    $0x2d,%al
+  800d37:	74 2b                	je     800d64 <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d39:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800d3f:	75 0f                	jne    800d50 <strtol+0x40>
+  800d41:	80 3a 30             	cmpb   $0x30,(%edx)
+  800d44:	74 28                	je     800d6e <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  800d46:	85 db                	test   %ebx,%ebx
+  800d48:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d4d:	0f 44 d8             	cmove  %eax,%ebx
+  800d50:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d55:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800d58:	eb 46                	jmp    800da0 <strtol+0x90>
+    s++;
+  800d5a:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  800d5d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d62:	eb d5                	jmp    800d39 <strtol+0x29>
+    s++, neg = 1;
+  800d64:	83 c2 01             	add    $0x1,%edx
+  800d67:	bf 01 00 00 00       	mov    $0x1,%edi
+  800d6c:	eb cb                	jmp    800d39 <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d6e:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800d72:	74 0e                	je     800d82 <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  800d74:	85 db                	test   %ebx,%ebx
+  800d76:	75 d8                	jne    800d50 <strtol+0x40>
+    s++, base = 8;
+  800d78:	83 c2 01             	add    $0x1,%edx
+  800d7b:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800d80:	eb ce                	jmp    800d50 <strtol+0x40>
+    s += 2, base = 16;
+  800d82:	83 c2 02             	add    $0x2,%edx
+  800d85:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800d8a:	eb c4                	jmp    800d50 <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  800d8c:	0f be c0             	movsbl %al,%eax
+  800d8f:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  800d92:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800d95:	7d 3a                	jge    800dd1 <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  800d97:	83 c2 01             	add    $0x1,%edx
+  800d9a:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800d9e:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  800da0:	0f b6 02             	movzbl (%edx),%eax
+  800da3:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800da6:	89 f3                	mov    %esi,%ebx
+  800da8:	80 fb 09             	cmp    $0x9,%bl
+  800dab:	76 df                	jbe    800d8c <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  800dad:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800db0:	89 f3                	mov    %esi,%ebx
+  800db2:	80 fb 19             	cmp    $0x19,%bl
+  800db5:	77 08                	ja     800dbf <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  800db7:	0f be c0             	movsbl %al,%eax
+  800dba:	83 e8 57             	sub    $0x57,%eax
+  800dbd:	eb d3                	jmp    800d92 <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  800dbf:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800dc2:	89 f3                	mov    %esi,%ebx
+  800dc4:	80 fb 19             	cmp    $0x19,%bl
+  800dc7:	77 08                	ja     800dd1 <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  800dc9:	0f be c0             	movsbl %al,%eax
+  800dcc:	83 e8 37             	sub    $0x37,%eax
+  800dcf:	eb c1                	jmp    800d92 <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  800dd1:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800dd5:	74 05                	je     800ddc <strtol+0xcc>
+    *endptr = (char*)s;
+  800dd7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800dda:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  800ddc:	89 c8                	mov    %ecx,%eax
+  800dde:	f7 d8                	neg    %eax
+  800de0:	85 ff                	test   %edi,%edi
+  800de2:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800de5:	89 c8                	mov    %ecx,%eax
+  800de7:	5b                   	pop    %ebx
+  800de8:	5e                   	pop    %esi
+  800de9:	5f                   	pop    %edi
+  800dea:	5d                   	pop    %ebp
+  800deb:	c3                   	ret
+
+00800dec <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800dec:	55                   	push   %ebp
+  800ded:	89 e5                	mov    %esp,%ebp
+  800def:	57                   	push   %edi
+  800df0:	56                   	push   %esi
+  800df1:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800df2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800df7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dfa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dfd:	89 c3                	mov    %eax,%ebx
+  800dff:	89 c7                	mov    %eax,%edi
+  800e01:	89 c6                	mov    %eax,%esi
+  800e03:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800e05:	5b                   	pop    %ebx
+  800e06:	5e                   	pop    %esi
+  800e07:	5f                   	pop    %edi
+  800e08:	5d                   	pop    %ebp
+  800e09:	c3                   	ret
+
+00800e0a <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800e0a:	55                   	push   %ebp
+  800e0b:	89 e5                	mov    %esp,%ebp
+  800e0d:	57                   	push   %edi
+  800e0e:	56                   	push   %esi
+  800e0f:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e10:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e15:	b8 01 00 00 00       	mov    $0x1,%eax
+  800e1a:	89 d1                	mov    %edx,%ecx
+  800e1c:	89 d3                	mov    %edx,%ebx
+  800e1e:	89 d7                	mov    %edx,%edi
+  800e20:	89 d6                	mov    %edx,%esi
+  800e22:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800e24:	5b                   	pop    %ebx
+  800e25:	5e                   	pop    %esi
+  800e26:	5f                   	pop    %edi
+  800e27:	5d                   	pop    %ebp
+  800e28:	c3                   	ret
+
+00800e29 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800e29:	55                   	push   %ebp
+  800e2a:	89 e5                	mov    %esp,%ebp
+  800e2c:	57                   	push   %edi
+  800e2d:	56                   	push   %esi
+  800e2e:	53                   	push   %ebx
+  800e2f:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e32:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e37:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e3a:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e3f:	89 cb                	mov    %ecx,%ebx
+  800e41:	89 cf                	mov    %ecx,%edi
+  800e43:	89 ce                	mov    %ecx,%esi
+  800e45:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e47:	85 c0                	test   %eax,%eax
+  800e49:	7f 08                	jg     800e53 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800e4b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e4e:	5b                   	pop    %ebx
+  800e4f:	5e                   	pop    %esi
+  800e50:	5f                   	pop    %edi
+  800e51:	5d                   	pop    %ebp
+  800e52:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e53:	83 ec 0c             	sub    $0xc,%esp
+  800e56:	50                   	push   %eax
+  800e57:	6a 03                	push   $0x3
+  800e59:	68 83 3d 80 00       	push   $0x803d83
+  800e5e:	6a 23                	push   $0x23
+  800e60:	68 a0 3d 80 00       	push   $0x803da0
+  800e65:	e8 89 f5 ff ff       	call   8003f3 <_panic>
+
+00800e6a <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800e6a:	55                   	push   %ebp
+  800e6b:	89 e5                	mov    %esp,%ebp
+  800e6d:	57                   	push   %edi
+  800e6e:	56                   	push   %esi
+  800e6f:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e70:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e75:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e7a:	89 d1                	mov    %edx,%ecx
+  800e7c:	89 d3                	mov    %edx,%ebx
+  800e7e:	89 d7                	mov    %edx,%edi
+  800e80:	89 d6                	mov    %edx,%esi
+  800e82:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800e84:	5b                   	pop    %ebx
+  800e85:	5e                   	pop    %esi
+  800e86:	5f                   	pop    %edi
+  800e87:	5d                   	pop    %ebp
+  800e88:	c3                   	ret
+
+00800e89 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800e89:	55                   	push   %ebp
+  800e8a:	89 e5                	mov    %esp,%ebp
+  800e8c:	57                   	push   %edi
+  800e8d:	56                   	push   %esi
+  800e8e:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e8f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e94:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e99:	89 d1                	mov    %edx,%ecx
+  800e9b:	89 d3                	mov    %edx,%ebx
+  800e9d:	89 d7                	mov    %edx,%edi
+  800e9f:	89 d6                	mov    %edx,%esi
+  800ea1:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800ea3:	5b                   	pop    %ebx
+  800ea4:	5e                   	pop    %esi
+  800ea5:	5f                   	pop    %edi
+  800ea6:	5d                   	pop    %ebp
+  800ea7:	c3                   	ret
+
+00800ea8 <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  800ea8:	55                   	push   %ebp
+  800ea9:	89 e5                	mov    %esp,%ebp
+  800eab:	57                   	push   %edi
+  800eac:	56                   	push   %esi
+  800ead:	53                   	push   %ebx
+  800eae:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  800eb1:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  800eb5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eba:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ebd:	b8 14 00 00 00       	mov    $0x14,%eax
+  800ec2:	89 df                	mov    %ebx,%edi
+  800ec4:	89 de                	mov    %ebx,%esi
+  800ec6:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ec8:	85 c0                	test   %eax,%eax
+  800eca:	7f 08                	jg     800ed4 <sys_env_set_cow+0x2c>
+}
+  800ecc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ecf:	5b                   	pop    %ebx
+  800ed0:	5e                   	pop    %esi
+  800ed1:	5f                   	pop    %edi
+  800ed2:	5d                   	pop    %ebp
+  800ed3:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ed4:	83 ec 0c             	sub    $0xc,%esp
+  800ed7:	50                   	push   %eax
+  800ed8:	6a 14                	push   $0x14
+  800eda:	68 83 3d 80 00       	push   $0x803d83
+  800edf:	6a 23                	push   $0x23
+  800ee1:	68 a0 3d 80 00       	push   $0x803da0
+  800ee6:	e8 08 f5 ff ff       	call   8003f3 <_panic>
+
+00800eeb <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800eeb:	55                   	push   %ebp
+  800eec:	89 e5                	mov    %esp,%ebp
+  800eee:	57                   	push   %edi
+  800eef:	56                   	push   %esi
+  800ef0:	53                   	push   %ebx
+  800ef1:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800ef4:	be 00 00 00 00       	mov    $0x0,%esi
+  800ef9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800efc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eff:	b8 04 00 00 00       	mov    $0x4,%eax
+  800f04:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f07:	89 f7                	mov    %esi,%edi
+  800f09:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f0b:	85 c0                	test   %eax,%eax
+  800f0d:	7f 08                	jg     800f17 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  800f0f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f12:	5b                   	pop    %ebx
+  800f13:	5e                   	pop    %esi
+  800f14:	5f                   	pop    %edi
+  800f15:	5d                   	pop    %ebp
+  800f16:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f17:	83 ec 0c             	sub    $0xc,%esp
+  800f1a:	50                   	push   %eax
+  800f1b:	6a 04                	push   $0x4
+  800f1d:	68 83 3d 80 00       	push   $0x803d83
+  800f22:	6a 23                	push   $0x23
+  800f24:	68 a0 3d 80 00       	push   $0x803da0
+  800f29:	e8 c5 f4 ff ff       	call   8003f3 <_panic>
+
+00800f2e <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800f2e:	55                   	push   %ebp
+  800f2f:	89 e5                	mov    %esp,%ebp
+  800f31:	57                   	push   %edi
+  800f32:	56                   	push   %esi
+  800f33:	53                   	push   %ebx
+  800f34:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f37:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f3a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f3d:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f42:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f45:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f48:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f4b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f4d:	85 c0                	test   %eax,%eax
+  800f4f:	7f 08                	jg     800f59 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  800f51:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f54:	5b                   	pop    %ebx
+  800f55:	5e                   	pop    %esi
+  800f56:	5f                   	pop    %edi
+  800f57:	5d                   	pop    %ebp
+  800f58:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f59:	83 ec 0c             	sub    $0xc,%esp
+  800f5c:	50                   	push   %eax
+  800f5d:	6a 05                	push   $0x5
+  800f5f:	68 83 3d 80 00       	push   $0x803d83
+  800f64:	6a 23                	push   $0x23
+  800f66:	68 a0 3d 80 00       	push   $0x803da0
+  800f6b:	e8 83 f4 ff ff       	call   8003f3 <_panic>
+
+00800f70 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800f70:	55                   	push   %ebp
+  800f71:	89 e5                	mov    %esp,%ebp
+  800f73:	57                   	push   %edi
+  800f74:	56                   	push   %esi
+  800f75:	53                   	push   %ebx
+  800f76:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f79:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f7e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f81:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f84:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f89:	89 df                	mov    %ebx,%edi
+  800f8b:	89 de                	mov    %ebx,%esi
+  800f8d:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f8f:	85 c0                	test   %eax,%eax
+  800f91:	7f 08                	jg     800f9b <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  800f93:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f96:	5b                   	pop    %ebx
+  800f97:	5e                   	pop    %esi
+  800f98:	5f                   	pop    %edi
+  800f99:	5d                   	pop    %ebp
+  800f9a:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f9b:	83 ec 0c             	sub    $0xc,%esp
+  800f9e:	50                   	push   %eax
+  800f9f:	6a 06                	push   $0x6
+  800fa1:	68 83 3d 80 00       	push   $0x803d83
+  800fa6:	6a 23                	push   $0x23
+  800fa8:	68 a0 3d 80 00       	push   $0x803da0
+  800fad:	e8 41 f4 ff ff       	call   8003f3 <_panic>
+
+00800fb2 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  800fb2:	55                   	push   %ebp
+  800fb3:	89 e5                	mov    %esp,%ebp
+  800fb5:	57                   	push   %edi
+  800fb6:	56                   	push   %esi
+  800fb7:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800fb8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fbb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fbe:	b8 11 00 00 00       	mov    $0x11,%eax
+  800fc3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fc6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fc9:	8b 75 18             	mov    0x18(%ebp),%esi
+  800fcc:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  800fce:	5b                   	pop    %ebx
+  800fcf:	5e                   	pop    %esi
+  800fd0:	5f                   	pop    %edi
+  800fd1:	5d                   	pop    %ebp
+  800fd2:	c3                   	ret
+
+00800fd3 <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  800fd3:	55                   	push   %ebp
+  800fd4:	89 e5                	mov    %esp,%ebp
+  800fd6:	57                   	push   %edi
+  800fd7:	56                   	push   %esi
+  800fd8:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800fd9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fdc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fdf:	b8 12 00 00 00       	mov    $0x12,%eax
+  800fe4:	be 00 00 00 00       	mov    $0x0,%esi
+  800fe9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fec:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fef:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  800ff1:	5b                   	pop    %ebx
+  800ff2:	5e                   	pop    %esi
+  800ff3:	5f                   	pop    %edi
+  800ff4:	5d                   	pop    %ebp
+  800ff5:	c3                   	ret
+
+00800ff6 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  800ff6:	55                   	push   %ebp
+  800ff7:	89 e5                	mov    %esp,%ebp
+  800ff9:	57                   	push   %edi
+  800ffa:	56                   	push   %esi
+  800ffb:	53                   	push   %ebx
+  800ffc:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800fff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801004:	8b 55 08             	mov    0x8(%ebp),%edx
+  801007:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80100a:	b8 16 00 00 00       	mov    $0x16,%eax
+  80100f:	89 df                	mov    %ebx,%edi
+  801011:	89 de                	mov    %ebx,%esi
+  801013:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801015:	85 c0                	test   %eax,%eax
+  801017:	7f 08                	jg     801021 <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  801019:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80101c:	5b                   	pop    %ebx
+  80101d:	5e                   	pop    %esi
+  80101e:	5f                   	pop    %edi
+  80101f:	5d                   	pop    %ebp
+  801020:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801021:	83 ec 0c             	sub    $0xc,%esp
+  801024:	50                   	push   %eax
+  801025:	6a 16                	push   $0x16
+  801027:	68 83 3d 80 00       	push   $0x803d83
+  80102c:	6a 23                	push   $0x23
+  80102e:	68 a0 3d 80 00       	push   $0x803da0
+  801033:	e8 bb f3 ff ff       	call   8003f3 <_panic>
+
+00801038 <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  801038:	55                   	push   %ebp
+  801039:	89 e5                	mov    %esp,%ebp
+  80103b:	57                   	push   %edi
+  80103c:	56                   	push   %esi
+  80103d:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80103e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801043:	8b 55 08             	mov    0x8(%ebp),%edx
+  801046:	b8 17 00 00 00       	mov    $0x17,%eax
+  80104b:	89 cb                	mov    %ecx,%ebx
+  80104d:	89 cf                	mov    %ecx,%edi
+  80104f:	89 ce                	mov    %ecx,%esi
+  801051:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  801053:	5b                   	pop    %ebx
+  801054:	5e                   	pop    %esi
+  801055:	5f                   	pop    %edi
+  801056:	5d                   	pop    %ebp
+  801057:	c3                   	ret
+
+00801058 <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  801058:	55                   	push   %ebp
+  801059:	89 e5                	mov    %esp,%ebp
+  80105b:	57                   	push   %edi
+  80105c:	56                   	push   %esi
+  80105d:	53                   	push   %ebx
+  80105e:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801061:	be 00 00 00 00       	mov    $0x0,%esi
+  801066:	8b 55 08             	mov    0x8(%ebp),%edx
+  801069:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80106c:	b8 18 00 00 00       	mov    $0x18,%eax
+  801071:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801074:	89 f7                	mov    %esi,%edi
+  801076:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801078:	85 c0                	test   %eax,%eax
+  80107a:	7f 08                	jg     801084 <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  80107c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80107f:	5b                   	pop    %ebx
+  801080:	5e                   	pop    %esi
+  801081:	5f                   	pop    %edi
+  801082:	5d                   	pop    %ebp
+  801083:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801084:	83 ec 0c             	sub    $0xc,%esp
+  801087:	50                   	push   %eax
+  801088:	6a 18                	push   $0x18
+  80108a:	68 83 3d 80 00       	push   $0x803d83
+  80108f:	6a 23                	push   $0x23
+  801091:	68 a0 3d 80 00       	push   $0x803da0
+  801096:	e8 58 f3 ff ff       	call   8003f3 <_panic>
+
+0080109b <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  80109b:	55                   	push   %ebp
+  80109c:	89 e5                	mov    %esp,%ebp
+  80109e:	57                   	push   %edi
+  80109f:	56                   	push   %esi
+  8010a0:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8010a1:	be 00 00 00 00       	mov    $0x0,%esi
+  8010a6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010ac:	b8 19 00 00 00       	mov    $0x19,%eax
+  8010b1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010b4:	89 f7                	mov    %esi,%edi
+  8010b6:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  8010b8:	5b                   	pop    %ebx
+  8010b9:	5e                   	pop    %esi
+  8010ba:	5f                   	pop    %edi
+  8010bb:	5d                   	pop    %ebp
+  8010bc:	c3                   	ret
+
+008010bd <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  8010bd:	55                   	push   %ebp
+  8010be:	89 e5                	mov    %esp,%ebp
+  8010c0:	57                   	push   %edi
+  8010c1:	56                   	push   %esi
+  8010c2:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8010c3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010c8:	b8 15 00 00 00       	mov    $0x15,%eax
+  8010cd:	89 d1                	mov    %edx,%ecx
+  8010cf:	89 d3                	mov    %edx,%ebx
+  8010d1:	89 d7                	mov    %edx,%edi
+  8010d3:	89 d6                	mov    %edx,%esi
+  8010d5:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8010d7:	5b                   	pop    %ebx
+  8010d8:	5e                   	pop    %esi
+  8010d9:	5f                   	pop    %edi
+  8010da:	5d                   	pop    %ebp
+  8010db:	c3                   	ret
+
+008010dc <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8010dc:	55                   	push   %ebp
+  8010dd:	89 e5                	mov    %esp,%ebp
+  8010df:	57                   	push   %edi
+  8010e0:	56                   	push   %esi
+  8010e1:	53                   	push   %ebx
+  8010e2:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8010e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010ea:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010ed:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010f0:	b8 08 00 00 00       	mov    $0x8,%eax
+  8010f5:	89 df                	mov    %ebx,%edi
+  8010f7:	89 de                	mov    %ebx,%esi
+  8010f9:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8010fb:	85 c0                	test   %eax,%eax
+  8010fd:	7f 08                	jg     801107 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8010ff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801102:	5b                   	pop    %ebx
+  801103:	5e                   	pop    %esi
+  801104:	5f                   	pop    %edi
+  801105:	5d                   	pop    %ebp
+  801106:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801107:	83 ec 0c             	sub    $0xc,%esp
+  80110a:	50                   	push   %eax
+  80110b:	6a 08                	push   $0x8
+  80110d:	68 83 3d 80 00       	push   $0x803d83
+  801112:	6a 23                	push   $0x23
+  801114:	68 a0 3d 80 00       	push   $0x803da0
+  801119:	e8 d5 f2 ff ff       	call   8003f3 <_panic>
+
+0080111e <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80111e:	55                   	push   %ebp
+  80111f:	89 e5                	mov    %esp,%ebp
+  801121:	57                   	push   %edi
+  801122:	56                   	push   %esi
+  801123:	53                   	push   %ebx
+  801124:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801127:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80112c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80112f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801132:	b8 09 00 00 00       	mov    $0x9,%eax
+  801137:	89 df                	mov    %ebx,%edi
+  801139:	89 de                	mov    %ebx,%esi
+  80113b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80113d:	85 c0                	test   %eax,%eax
+  80113f:	7f 08                	jg     801149 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  801141:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801144:	5b                   	pop    %ebx
+  801145:	5e                   	pop    %esi
+  801146:	5f                   	pop    %edi
+  801147:	5d                   	pop    %ebp
+  801148:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801149:	83 ec 0c             	sub    $0xc,%esp
+  80114c:	50                   	push   %eax
+  80114d:	6a 09                	push   $0x9
+  80114f:	68 83 3d 80 00       	push   $0x803d83
+  801154:	6a 23                	push   $0x23
+  801156:	68 a0 3d 80 00       	push   $0x803da0
+  80115b:	e8 93 f2 ff ff       	call   8003f3 <_panic>
+
+00801160 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801160:	55                   	push   %ebp
+  801161:	89 e5                	mov    %esp,%ebp
+  801163:	57                   	push   %edi
+  801164:	56                   	push   %esi
+  801165:	53                   	push   %ebx
+  801166:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801169:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80116e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801171:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801174:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801179:	89 df                	mov    %ebx,%edi
+  80117b:	89 de                	mov    %ebx,%esi
+  80117d:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80117f:	85 c0                	test   %eax,%eax
+  801181:	7f 08                	jg     80118b <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  801183:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801186:	5b                   	pop    %ebx
+  801187:	5e                   	pop    %esi
+  801188:	5f                   	pop    %edi
+  801189:	5d                   	pop    %ebp
+  80118a:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80118b:	83 ec 0c             	sub    $0xc,%esp
+  80118e:	50                   	push   %eax
+  80118f:	6a 0a                	push   $0xa
+  801191:	68 83 3d 80 00       	push   $0x803d83
+  801196:	6a 23                	push   $0x23
+  801198:	68 a0 3d 80 00       	push   $0x803da0
+  80119d:	e8 51 f2 ff ff       	call   8003f3 <_panic>
+
+008011a2 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  8011a2:	55                   	push   %ebp
+  8011a3:	89 e5                	mov    %esp,%ebp
+  8011a5:	57                   	push   %edi
+  8011a6:	56                   	push   %esi
+  8011a7:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8011a8:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011ab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011ae:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8011b3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011b6:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8011b9:	8b 75 18             	mov    0x18(%ebp),%esi
+  8011bc:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  8011be:	5b                   	pop    %ebx
+  8011bf:	5e                   	pop    %esi
+  8011c0:	5f                   	pop    %edi
+  8011c1:	5d                   	pop    %ebp
+  8011c2:	c3                   	ret
+
+008011c3 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  8011c3:	55                   	push   %ebp
+  8011c4:	89 e5                	mov    %esp,%ebp
+  8011c6:	57                   	push   %edi
+  8011c7:	56                   	push   %esi
+  8011c8:	53                   	push   %ebx
+  8011c9:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8011cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011d1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011d4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011d7:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011dc:	89 df                	mov    %ebx,%edi
+  8011de:	89 de                	mov    %ebx,%esi
+  8011e0:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8011e2:	85 c0                	test   %eax,%eax
+  8011e4:	7f 08                	jg     8011ee <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  8011e6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011e9:	5b                   	pop    %ebx
+  8011ea:	5e                   	pop    %esi
+  8011eb:	5f                   	pop    %edi
+  8011ec:	5d                   	pop    %ebp
+  8011ed:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8011ee:	83 ec 0c             	sub    $0xc,%esp
+  8011f1:	50                   	push   %eax
+  8011f2:	6a 0d                	push   $0xd
+  8011f4:	68 83 3d 80 00       	push   $0x803d83
+  8011f9:	6a 23                	push   $0x23
+  8011fb:	68 a0 3d 80 00       	push   $0x803da0
+  801200:	e8 ee f1 ff ff       	call   8003f3 <_panic>
+
+00801205 <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  801205:	55                   	push   %ebp
+  801206:	89 e5                	mov    %esp,%ebp
+  801208:	57                   	push   %edi
+  801209:	56                   	push   %esi
+  80120a:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80120b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801210:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801215:	89 d1                	mov    %edx,%ecx
+  801217:	89 d3                	mov    %edx,%ebx
+  801219:	89 d7                	mov    %edx,%edi
+  80121b:	89 d6                	mov    %edx,%esi
+  80121d:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  80121f:	5b                   	pop    %ebx
+  801220:	5e                   	pop    %esi
+  801221:	5f                   	pop    %edi
+  801222:	5d                   	pop    %ebp
+  801223:	c3                   	ret
+
+00801224 <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  801224:	55                   	push   %ebp
+  801225:	89 e5                	mov    %esp,%ebp
+  801227:	57                   	push   %edi
+  801228:	56                   	push   %esi
+  801229:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80122a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80122d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801230:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801235:	be 00 00 00 00       	mov    $0x0,%esi
+  80123a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80123d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801240:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  801242:	5b                   	pop    %ebx
+  801243:	5e                   	pop    %esi
+  801244:	5f                   	pop    %edi
+  801245:	5d                   	pop    %ebp
+  801246:	c3                   	ret
+
+00801247 <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  801247:	55                   	push   %ebp
+  801248:	89 e5                	mov    %esp,%ebp
+  80124a:	57                   	push   %edi
+  80124b:	56                   	push   %esi
+  80124c:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80124d:	be 00 00 00 00       	mov    $0x0,%esi
+  801252:	8b 55 08             	mov    0x8(%ebp),%edx
+  801255:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801258:	b8 10 00 00 00       	mov    $0x10,%eax
+  80125d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801260:	89 f7                	mov    %esi,%edi
+  801262:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  801264:	5b                   	pop    %ebx
+  801265:	5e                   	pop    %esi
+  801266:	5f                   	pop    %edi
+  801267:	5d                   	pop    %ebp
+  801268:	c3                   	ret
+
+00801269 <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  801269:	55                   	push   %ebp
+  80126a:	89 e5                	mov    %esp,%ebp
+  80126c:	57                   	push   %edi
+  80126d:	56                   	push   %esi
+  80126e:	53                   	push   %ebx
+  80126f:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  801272:	80 3d e8 5e 80 00 00 	cmpb   $0x0,0x805ee8
+  801279:	74 41                	je     8012bc <sys_batch+0x53>
+  80127b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80127e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  801281:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  801288:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80128b:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  80128e:	7d 45                	jge    8012d5 <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  801290:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801293:	8b 06                	mov    (%esi),%eax
+  801295:	8b 56 04             	mov    0x4(%esi),%edx
+  801298:	8b 4e 08             	mov    0x8(%esi),%ecx
+  80129b:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  80129e:	8b 7e 10             	mov    0x10(%esi),%edi
+  8012a1:	8b 76 14             	mov    0x14(%esi),%esi
+  8012a4:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  8012a6:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8012a9:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  8012ac:	83 c6 1c             	add    $0x1c,%esi
+  8012af:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  8012b2:	85 c0                	test   %eax,%eax
+  8012b4:	78 1f                	js     8012d5 <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  8012b6:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  8012ba:	eb cc                	jmp    801288 <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  8012bc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012c1:	b8 13 00 00 00       	mov    $0x13,%eax
+  8012c6:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012c9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012cc:	89 df                	mov    %ebx,%edi
+  8012ce:	89 de                	mov    %ebx,%esi
+  8012d0:	cd 30                	int    $0x30
+  8012d2:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  8012d5:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8012d8:	83 c4 08             	add    $0x8,%esp
+  8012db:	5b                   	pop    %ebx
+  8012dc:	5e                   	pop    %esi
+  8012dd:	5f                   	pop    %edi
+  8012de:	5d                   	pop    %ebp
+  8012df:	c3                   	ret
+
+008012e0 <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  8012e0:	55                   	push   %ebp
+  8012e1:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  8012e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8012e6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8012ec:	5d                   	pop    %ebp
+  8012ed:	c3                   	ret
+
+008012ee <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  8012ee:	55                   	push   %ebp
+  8012ef:	89 e5                	mov    %esp,%ebp
+  8012f1:	56                   	push   %esi
+  8012f2:	53                   	push   %ebx
+  8012f3:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  8012f6:	8b 1e                	mov    (%esi),%ebx
+  8012f8:	85 db                	test   %ebx,%ebx
+  8012fa:	75 09                	jne    801305 <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  8012fc:	89 d8                	mov    %ebx,%eax
+  8012fe:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801301:	5b                   	pop    %ebx
+  801302:	5e                   	pop    %esi
+  801303:	5d                   	pop    %ebp
+  801304:	c3                   	ret
+  b->sb_n = 0;
+  801305:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  80130b:	53                   	push   %ebx
+  80130c:	8d 46 04             	lea    0x4(%esi),%eax
+  80130f:	50                   	push   %eax
+  801310:	e8 54 ff ff ff       	call   801269 <sys_batch>
+  801315:	83 c4 08             	add    $0x8,%esp
+  801318:	85 c0                	test   %eax,%eax
+  80131a:	78 1e                	js     80133a <sysbatch_flush+0x4c>
+  if (r < n)
+  80131c:	39 c3                	cmp    %eax,%ebx
+  80131e:	7f 07                	jg     801327 <sysbatch_flush+0x39>
+  return 0;
+  801320:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801325:	eb d5                	jmp    8012fc <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  801327:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80132a:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  80132e:	85 db                	test   %ebx,%ebx
+  801330:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801335:	0f 49 d8             	cmovns %eax,%ebx
+  801338:	eb c2                	jmp    8012fc <sysbatch_flush+0xe>
+    return r;
+  80133a:	89 c3                	mov    %eax,%ebx
+  80133c:	eb be                	jmp    8012fc <sysbatch_flush+0xe>
+
+0080133e <sysbatch_add>:
+{
+  80133e:	55                   	push   %ebp
+  80133f:	89 e5                	mov    %esp,%ebp
+  801341:	53                   	push   %ebx
+  801342:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  801345:	83 3b 40             	cmpl   $0x40,(%ebx)
+  801348:	74 41                	je     80138b <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  80134a:	8b 03                	mov    (%ebx),%eax
+  80134c:	8d 50 01             	lea    0x1(%eax),%edx
+  80134f:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  801351:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801354:	01 d8                	add    %ebx,%eax
+  801356:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801359:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  80135c:	8b 55 10             	mov    0x10(%ebp),%edx
+  80135f:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  801362:	8b 55 14             	mov    0x14(%ebp),%edx
+  801365:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  801368:	8b 55 18             	mov    0x18(%ebp),%edx
+  80136b:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  80136e:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  801371:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  801374:	8b 55 20             	mov    0x20(%ebp),%edx
+  801377:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  80137a:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  801381:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801386:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801389:	c9                   	leave
+  80138a:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  80138b:	53                   	push   %ebx
+  80138c:	e8 5d ff ff ff       	call   8012ee <sysbatch_flush>
+  801391:	83 c4 04             	add    $0x4,%esp
+  801394:	85 c0                	test   %eax,%eax
+  801396:	79 b2                	jns    80134a <sysbatch_add+0xc>
+  801398:	eb ec                	jmp    801386 <sysbatch_add+0x48>
+
+0080139a <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80139a:	55                   	push   %ebp
+  80139b:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80139d:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013a0:	05 00 00 00 30       	add    $0x30000000,%eax
+  8013a5:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8013a8:	5d                   	pop    %ebp
+  8013a9:	c3                   	ret
+
+008013aa <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8013aa:	55                   	push   %ebp
+  8013ab:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8013ad:	8b 45 08             	mov    0x8(%ebp),%eax
+  8013b0:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  8013b3:	66 b8 00 00          	mov    $0x0,%ax
+  8013b7:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8013bc:	5d                   	pop    %ebp
+  8013bd:	c3                   	ret
+
+008013be <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8013be:	55                   	push   %ebp
+  8013bf:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  8013c1:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8013c6:	eb 02                	jmp    8013ca <fd_alloc+0xc>
+  8013c8:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8013ca:	89 c2                	mov    %eax,%edx
+  8013cc:	c1 ea 16             	shr    $0x16,%edx
+  8013cf:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8013d6:	f6 c2 01             	test   $0x1,%dl
+  8013d9:	74 2b                	je     801406 <fd_alloc+0x48>
+  8013db:	89 c2                	mov    %eax,%edx
+  8013dd:	c1 ea 0c             	shr    $0xc,%edx
+  8013e0:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8013e7:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8013ed:	f6 c1 01             	test   $0x1,%cl
+  8013f0:	74 14                	je     801406 <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  8013f2:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8013f8:	75 ce                	jne    8013c8 <fd_alloc+0xa>
+  8013fa:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  8013ff:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801404:	eb 05                	jmp    80140b <fd_alloc+0x4d>
+      return 0;
+  801406:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  80140b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80140e:	89 02                	mov    %eax,(%edx)
+}
+  801410:	89 c8                	mov    %ecx,%eax
+  801412:	5d                   	pop    %ebp
+  801413:	c3                   	ret
+
+00801414 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801414:	55                   	push   %ebp
+  801415:	89 e5                	mov    %esp,%ebp
+  801417:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  80141a:	83 f8 1f             	cmp    $0x1f,%eax
+  80141d:	77 30                	ja     80144f <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  80141f:	c1 e0 0c             	shl    $0xc,%eax
+  801422:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801427:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80142d:	f6 c2 01             	test   $0x1,%dl
+  801430:	74 24                	je     801456 <fd_lookup+0x42>
+  801432:	89 c2                	mov    %eax,%edx
+  801434:	c1 ea 0c             	shr    $0xc,%edx
+  801437:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80143e:	f6 c2 01             	test   $0x1,%dl
+  801441:	74 1a                	je     80145d <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  801443:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801446:	89 02                	mov    %eax,(%edx)
+  return 0;
+  801448:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80144d:	5d                   	pop    %ebp
+  80144e:	c3                   	ret
+    return -E_INVAL;
+  80144f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801454:	eb f7                	jmp    80144d <fd_lookup+0x39>
+    return -E_INVAL;
+  801456:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80145b:	eb f0                	jmp    80144d <fd_lookup+0x39>
+  80145d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801462:	eb e9                	jmp    80144d <fd_lookup+0x39>
+
+00801464 <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801464:	55                   	push   %ebp
+  801465:	89 e5                	mov    %esp,%ebp
+  801467:	53                   	push   %ebx
+  801468:	83 ec 04             	sub    $0x4,%esp
+  80146b:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  80146e:	b8 2c 3e 80 00       	mov    $0x803e2c,%eax
+  801473:	8b 18                	mov    (%eax),%ebx
+  801475:	85 db                	test   %ebx,%ebx
+  801477:	74 0e                	je     801487 <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  801479:	83 c0 04             	add    $0x4,%eax
+  80147c:	39 13                	cmp    %edx,(%ebx)
+  80147e:	75 f3                	jne    801473 <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  801480:	b8 00 00 00 00       	mov    $0x0,%eax
+  801485:	eb 1f                	jmp    8014a6 <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801487:	a1 e4 5e 80 00       	mov    0x805ee4,%eax
+  80148c:	8b 40 48             	mov    0x48(%eax),%eax
+  80148f:	83 ec 04             	sub    $0x4,%esp
+  801492:	52                   	push   %edx
+  801493:	50                   	push   %eax
+  801494:	68 b0 3d 80 00       	push   $0x803db0
+  801499:	e8 30 f0 ff ff       	call   8004ce <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  80149e:	83 c4 10             	add    $0x10,%esp
+  8014a1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  8014a6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8014a9:	89 1a                	mov    %ebx,(%edx)
+}
+  8014ab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014ae:	c9                   	leave
+  8014af:	c3                   	ret
+
+008014b0 <fd_close>:
+{
+  8014b0:	55                   	push   %ebp
+  8014b1:	89 e5                	mov    %esp,%ebp
+  8014b3:	57                   	push   %edi
+  8014b4:	56                   	push   %esi
+  8014b5:	53                   	push   %ebx
+  8014b6:	83 ec 24             	sub    $0x24,%esp
+  8014b9:	8b 75 08             	mov    0x8(%ebp),%esi
+  8014bc:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8014bf:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8014c2:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8014c3:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8014c9:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8014cc:	50                   	push   %eax
+  8014cd:	e8 42 ff ff ff       	call   801414 <fd_lookup>
+  8014d2:	89 c3                	mov    %eax,%ebx
+  8014d4:	83 c4 10             	add    $0x10,%esp
+  8014d7:	85 c0                	test   %eax,%eax
+  8014d9:	78 05                	js     8014e0 <fd_close+0x30>
+      || fd != fd2)
+  8014db:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8014de:	74 16                	je     8014f6 <fd_close+0x46>
+    return must_exist ? r : 0;
+  8014e0:	89 f8                	mov    %edi,%eax
+  8014e2:	84 c0                	test   %al,%al
+  8014e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014e9:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8014ec:	89 d8                	mov    %ebx,%eax
+  8014ee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014f1:	5b                   	pop    %ebx
+  8014f2:	5e                   	pop    %esi
+  8014f3:	5f                   	pop    %edi
+  8014f4:	5d                   	pop    %ebp
+  8014f5:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8014f6:	83 ec 08             	sub    $0x8,%esp
+  8014f9:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8014fc:	50                   	push   %eax
+  8014fd:	ff 36                	push   (%esi)
+  8014ff:	e8 60 ff ff ff       	call   801464 <dev_lookup>
+  801504:	89 c3                	mov    %eax,%ebx
+  801506:	83 c4 10             	add    $0x10,%esp
+  801509:	85 c0                	test   %eax,%eax
+  80150b:	78 1a                	js     801527 <fd_close+0x77>
+    if (dev->dev_close)
+  80150d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801510:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  801513:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  801518:	85 c0                	test   %eax,%eax
+  80151a:	74 0b                	je     801527 <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  80151c:	83 ec 0c             	sub    $0xc,%esp
+  80151f:	56                   	push   %esi
+  801520:	ff d0                	call   *%eax
+  801522:	89 c3                	mov    %eax,%ebx
+  801524:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  801527:	83 ec 08             	sub    $0x8,%esp
+  80152a:	56                   	push   %esi
+  80152b:	6a 00                	push   $0x0
+  80152d:	e8 3e fa ff ff       	call   800f70 <sys_page_unmap>
+  return r;
+  801532:	83 c4 10             	add    $0x10,%esp
+  801535:	eb b5                	jmp    8014ec <fd_close+0x3c>
+
+00801537 <close>:
+
+int
+close(int fdnum)
+{
+  801537:	55                   	push   %ebp
+  801538:	89 e5                	mov    %esp,%ebp
+  80153a:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80153d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801540:	50                   	push   %eax
+  801541:	ff 75 08             	push   0x8(%ebp)
+  801544:	e8 cb fe ff ff       	call   801414 <fd_lookup>
+  801549:	83 c4 10             	add    $0x10,%esp
+  80154c:	85 c0                	test   %eax,%eax
+  80154e:	79 02                	jns    801552 <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  801550:	c9                   	leave
+  801551:	c3                   	ret
+    return fd_close(fd, 1);
+  801552:	83 ec 08             	sub    $0x8,%esp
+  801555:	6a 01                	push   $0x1
+  801557:	ff 75 f4             	push   -0xc(%ebp)
+  80155a:	e8 51 ff ff ff       	call   8014b0 <fd_close>
+  80155f:	83 c4 10             	add    $0x10,%esp
+  801562:	eb ec                	jmp    801550 <close+0x19>
+
+00801564 <close_all>:
+
+void
+close_all(void)
+{
+  801564:	55                   	push   %ebp
+  801565:	89 e5                	mov    %esp,%ebp
+  801567:	53                   	push   %ebx
+  801568:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  80156b:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  801570:	83 ec 0c             	sub    $0xc,%esp
+  801573:	53                   	push   %ebx
+  801574:	e8 be ff ff ff       	call   801537 <close>
+  for (i = 0; i < MAXFD; i++)
+  801579:	83 c3 01             	add    $0x1,%ebx
+  80157c:	83 c4 10             	add    $0x10,%esp
+  80157f:	83 fb 20             	cmp    $0x20,%ebx
+  801582:	75 ec                	jne    801570 <close_all+0xc>
+}
+  801584:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801587:	c9                   	leave
+  801588:	c3                   	ret
+
+00801589 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801589:	55                   	push   %ebp
+  80158a:	89 e5                	mov    %esp,%ebp
+  80158c:	57                   	push   %edi
+  80158d:	56                   	push   %esi
+  80158e:	53                   	push   %ebx
+  80158f:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801592:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801595:	50                   	push   %eax
+  801596:	ff 75 08             	push   0x8(%ebp)
+  801599:	e8 76 fe ff ff       	call   801414 <fd_lookup>
+  80159e:	89 c6                	mov    %eax,%esi
+  8015a0:	83 c4 10             	add    $0x10,%esp
+  8015a3:	85 c0                	test   %eax,%eax
+  8015a5:	0f 88 0a 01 00 00    	js     8016b5 <dup+0x12c>
+    return r;
+  close(newfdnum);
+  8015ab:	83 ec 0c             	sub    $0xc,%esp
+  8015ae:	ff 75 0c             	push   0xc(%ebp)
+  8015b1:	e8 81 ff ff ff       	call   801537 <close>
+
+  newfd = INDEX2FD(newfdnum);
+  8015b6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8015b9:	c1 e0 0c             	shl    $0xc,%eax
+  8015bc:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  8015c2:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  8015c5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8015c8:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8015cb:	89 04 24             	mov    %eax,(%esp)
+  8015ce:	e8 d7 fd ff ff       	call   8013aa <fd2data>
+  8015d3:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  8015d5:	89 3c 24             	mov    %edi,(%esp)
+  8015d8:	e8 cd fd ff ff       	call   8013aa <fd2data>
+  8015dd:	83 c4 10             	add    $0x10,%esp
+  8015e0:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8015e3:	89 f3                	mov    %esi,%ebx
+  8015e5:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  8015eb:	89 c6                	mov    %eax,%esi
+  8015ed:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8015f0:	89 cf                	mov    %ecx,%edi
+  8015f2:	eb 0c                	jmp    801600 <dup+0x77>
+  8015f4:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8015fa:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801600:	39 fb                	cmp    %edi,%ebx
+  801602:	74 7b                	je     80167f <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  801604:	89 d8                	mov    %ebx,%eax
+  801606:	c1 e8 16             	shr    $0x16,%eax
+  801609:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801610:	a8 01                	test   $0x1,%al
+  801612:	74 e0                	je     8015f4 <dup+0x6b>
+  801614:	89 d8                	mov    %ebx,%eax
+  801616:	c1 e8 0c             	shr    $0xc,%eax
+  801619:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801620:	f6 c2 01             	test   $0x1,%dl
+  801623:	74 cf                	je     8015f4 <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  801625:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  80162c:	83 ec 0c             	sub    $0xc,%esp
+  80162f:	25 07 0e 00 00       	and    $0xe07,%eax
+  801634:	50                   	push   %eax
+  801635:	56                   	push   %esi
+  801636:	6a 00                	push   $0x0
+  801638:	53                   	push   %ebx
+  801639:	6a 00                	push   $0x0
+  80163b:	e8 ee f8 ff ff       	call   800f2e <sys_page_map>
+  801640:	83 c4 20             	add    $0x20,%esp
+  801643:	85 c0                	test   %eax,%eax
+  801645:	79 ad                	jns    8015f4 <dup+0x6b>
+  801647:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80164a:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  80164c:	83 ec 08             	sub    $0x8,%esp
+  80164f:	ff 75 d4             	push   -0x2c(%ebp)
+  801652:	6a 00                	push   $0x0
+  801654:	e8 17 f9 ff ff       	call   800f70 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801659:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  80165c:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  801662:	83 c4 10             	add    $0x10,%esp
+  801665:	39 df                	cmp    %ebx,%edi
+  801667:	74 4c                	je     8016b5 <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  801669:	83 ec 08             	sub    $0x8,%esp
+  80166c:	57                   	push   %edi
+  80166d:	6a 00                	push   $0x0
+  80166f:	e8 fc f8 ff ff       	call   800f70 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801674:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  80167a:	83 c4 10             	add    $0x10,%esp
+  80167d:	eb e6                	jmp    801665 <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80167f:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801682:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  801685:	89 c8                	mov    %ecx,%eax
+  801687:	c1 e8 0c             	shr    $0xc,%eax
+  80168a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801691:	83 ec 0c             	sub    $0xc,%esp
+  801694:	25 07 0e 00 00       	and    $0xe07,%eax
+  801699:	50                   	push   %eax
+  80169a:	ff 75 d4             	push   -0x2c(%ebp)
+  80169d:	6a 00                	push   $0x0
+  80169f:	51                   	push   %ecx
+  8016a0:	6a 00                	push   $0x0
+  8016a2:	e8 87 f8 ff ff       	call   800f2e <sys_page_map>
+  8016a7:	89 c6                	mov    %eax,%esi
+  8016a9:	83 c4 20             	add    $0x20,%esp
+  8016ac:	85 c0                	test   %eax,%eax
+  8016ae:	78 9c                	js     80164c <dup+0xc3>
+  return newfdnum;
+  8016b0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8016b3:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  8016b5:	89 f0                	mov    %esi,%eax
+  8016b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016ba:	5b                   	pop    %ebx
+  8016bb:	5e                   	pop    %esi
+  8016bc:	5f                   	pop    %edi
+  8016bd:	5d                   	pop    %ebp
+  8016be:	c3                   	ret
+
+008016bf <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8016bf:	55                   	push   %ebp
+  8016c0:	89 e5                	mov    %esp,%ebp
+  8016c2:	56                   	push   %esi
+  8016c3:	53                   	push   %ebx
+  8016c4:	83 ec 18             	sub    $0x18,%esp
+  8016c7:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  8016ca:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8016cd:	50                   	push   %eax
+  8016ce:	56                   	push   %esi
+  8016cf:	e8 40 fd ff ff       	call   801414 <fd_lookup>
+  8016d4:	83 c4 10             	add    $0x10,%esp
+  8016d7:	85 c0                	test   %eax,%eax
+  8016d9:	78 3c                	js     801717 <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8016db:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8016de:	83 ec 08             	sub    $0x8,%esp
+  8016e1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016e4:	50                   	push   %eax
+  8016e5:	ff 33                	push   (%ebx)
+  8016e7:	e8 78 fd ff ff       	call   801464 <dev_lookup>
+  8016ec:	83 c4 10             	add    $0x10,%esp
+  8016ef:	85 c0                	test   %eax,%eax
+  8016f1:	78 24                	js     801717 <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8016f3:	8b 43 08             	mov    0x8(%ebx),%eax
+  8016f6:	83 e0 03             	and    $0x3,%eax
+  8016f9:	83 f8 01             	cmp    $0x1,%eax
+  8016fc:	74 20                	je     80171e <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  8016fe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801701:	8b 40 08             	mov    0x8(%eax),%eax
+  801704:	85 c0                	test   %eax,%eax
+  801706:	74 37                	je     80173f <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  801708:	83 ec 04             	sub    $0x4,%esp
+  80170b:	ff 75 10             	push   0x10(%ebp)
+  80170e:	ff 75 0c             	push   0xc(%ebp)
+  801711:	53                   	push   %ebx
+  801712:	ff d0                	call   *%eax
+  801714:	83 c4 10             	add    $0x10,%esp
+}
+  801717:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80171a:	5b                   	pop    %ebx
+  80171b:	5e                   	pop    %esi
+  80171c:	5d                   	pop    %ebp
+  80171d:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80171e:	a1 e4 5e 80 00       	mov    0x805ee4,%eax
+  801723:	8b 40 48             	mov    0x48(%eax),%eax
+  801726:	83 ec 04             	sub    $0x4,%esp
+  801729:	56                   	push   %esi
+  80172a:	50                   	push   %eax
+  80172b:	68 f1 3d 80 00       	push   $0x803df1
+  801730:	e8 99 ed ff ff       	call   8004ce <cprintf>
+    return -E_INVAL;
+  801735:	83 c4 10             	add    $0x10,%esp
+  801738:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80173d:	eb d8                	jmp    801717 <read+0x58>
+    return -E_NOT_SUPP;
+  80173f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801744:	eb d1                	jmp    801717 <read+0x58>
+
+00801746 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801746:	55                   	push   %ebp
+  801747:	89 e5                	mov    %esp,%ebp
+  801749:	57                   	push   %edi
+  80174a:	56                   	push   %esi
+  80174b:	53                   	push   %ebx
+  80174c:	83 ec 0c             	sub    $0xc,%esp
+  80174f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801752:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  801755:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80175a:	eb 02                	jmp    80175e <readn+0x18>
+  80175c:	01 c3                	add    %eax,%ebx
+  80175e:	39 f3                	cmp    %esi,%ebx
+  801760:	73 21                	jae    801783 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  801762:	83 ec 04             	sub    $0x4,%esp
+  801765:	89 f0                	mov    %esi,%eax
+  801767:	29 d8                	sub    %ebx,%eax
+  801769:	50                   	push   %eax
+  80176a:	89 d8                	mov    %ebx,%eax
+  80176c:	03 45 0c             	add    0xc(%ebp),%eax
+  80176f:	50                   	push   %eax
+  801770:	57                   	push   %edi
+  801771:	e8 49 ff ff ff       	call   8016bf <read>
+    if (m < 0)
+  801776:	83 c4 10             	add    $0x10,%esp
+  801779:	85 c0                	test   %eax,%eax
+  80177b:	78 04                	js     801781 <readn+0x3b>
+      return m;
+    if (m == 0)
+  80177d:	75 dd                	jne    80175c <readn+0x16>
+  80177f:	eb 02                	jmp    801783 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  801781:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  801783:	89 d8                	mov    %ebx,%eax
+  801785:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801788:	5b                   	pop    %ebx
+  801789:	5e                   	pop    %esi
+  80178a:	5f                   	pop    %edi
+  80178b:	5d                   	pop    %ebp
+  80178c:	c3                   	ret
+
+0080178d <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80178d:	55                   	push   %ebp
+  80178e:	89 e5                	mov    %esp,%ebp
+  801790:	56                   	push   %esi
+  801791:	53                   	push   %ebx
+  801792:	83 ec 18             	sub    $0x18,%esp
+  801795:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801798:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80179b:	50                   	push   %eax
+  80179c:	53                   	push   %ebx
+  80179d:	e8 72 fc ff ff       	call   801414 <fd_lookup>
+  8017a2:	83 c4 10             	add    $0x10,%esp
+  8017a5:	85 c0                	test   %eax,%eax
+  8017a7:	78 37                	js     8017e0 <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017a9:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8017ac:	83 ec 08             	sub    $0x8,%esp
+  8017af:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017b2:	50                   	push   %eax
+  8017b3:	ff 36                	push   (%esi)
+  8017b5:	e8 aa fc ff ff       	call   801464 <dev_lookup>
+  8017ba:	83 c4 10             	add    $0x10,%esp
+  8017bd:	85 c0                	test   %eax,%eax
+  8017bf:	78 1f                	js     8017e0 <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8017c1:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8017c5:	74 20                	je     8017e7 <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  8017c7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017ca:	8b 40 0c             	mov    0xc(%eax),%eax
+  8017cd:	85 c0                	test   %eax,%eax
+  8017cf:	74 37                	je     801808 <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  8017d1:	83 ec 04             	sub    $0x4,%esp
+  8017d4:	ff 75 10             	push   0x10(%ebp)
+  8017d7:	ff 75 0c             	push   0xc(%ebp)
+  8017da:	56                   	push   %esi
+  8017db:	ff d0                	call   *%eax
+  8017dd:	83 c4 10             	add    $0x10,%esp
+}
+  8017e0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017e3:	5b                   	pop    %ebx
+  8017e4:	5e                   	pop    %esi
+  8017e5:	5d                   	pop    %ebp
+  8017e6:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8017e7:	a1 e4 5e 80 00       	mov    0x805ee4,%eax
+  8017ec:	8b 40 48             	mov    0x48(%eax),%eax
+  8017ef:	83 ec 04             	sub    $0x4,%esp
+  8017f2:	53                   	push   %ebx
+  8017f3:	50                   	push   %eax
+  8017f4:	68 0d 3e 80 00       	push   $0x803e0d
+  8017f9:	e8 d0 ec ff ff       	call   8004ce <cprintf>
+    return -E_INVAL;
+  8017fe:	83 c4 10             	add    $0x10,%esp
+  801801:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801806:	eb d8                	jmp    8017e0 <write+0x53>
+    return -E_NOT_SUPP;
+  801808:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80180d:	eb d1                	jmp    8017e0 <write+0x53>
+
+0080180f <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80180f:	55                   	push   %ebp
+  801810:	89 e5                	mov    %esp,%ebp
+  801812:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801815:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801818:	50                   	push   %eax
+  801819:	ff 75 08             	push   0x8(%ebp)
+  80181c:	e8 f3 fb ff ff       	call   801414 <fd_lookup>
+  801821:	83 c4 10             	add    $0x10,%esp
+  801824:	85 c0                	test   %eax,%eax
+  801826:	78 0e                	js     801836 <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  801828:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80182b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80182e:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  801831:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801836:	c9                   	leave
+  801837:	c3                   	ret
+
+00801838 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801838:	55                   	push   %ebp
+  801839:	89 e5                	mov    %esp,%ebp
+  80183b:	56                   	push   %esi
+  80183c:	53                   	push   %ebx
+  80183d:	83 ec 18             	sub    $0x18,%esp
+  801840:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801843:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801846:	50                   	push   %eax
+  801847:	53                   	push   %ebx
+  801848:	e8 c7 fb ff ff       	call   801414 <fd_lookup>
+  80184d:	83 c4 10             	add    $0x10,%esp
+  801850:	85 c0                	test   %eax,%eax
+  801852:	78 34                	js     801888 <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801854:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801857:	83 ec 08             	sub    $0x8,%esp
+  80185a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80185d:	50                   	push   %eax
+  80185e:	ff 36                	push   (%esi)
+  801860:	e8 ff fb ff ff       	call   801464 <dev_lookup>
+  801865:	83 c4 10             	add    $0x10,%esp
+  801868:	85 c0                	test   %eax,%eax
+  80186a:	78 1c                	js     801888 <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80186c:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801870:	74 1d                	je     80188f <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  801872:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801875:	8b 40 18             	mov    0x18(%eax),%eax
+  801878:	85 c0                	test   %eax,%eax
+  80187a:	74 34                	je     8018b0 <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  80187c:	83 ec 08             	sub    $0x8,%esp
+  80187f:	ff 75 0c             	push   0xc(%ebp)
+  801882:	56                   	push   %esi
+  801883:	ff d0                	call   *%eax
+  801885:	83 c4 10             	add    $0x10,%esp
+}
+  801888:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80188b:	5b                   	pop    %ebx
+  80188c:	5e                   	pop    %esi
+  80188d:	5d                   	pop    %ebp
+  80188e:	c3                   	ret
+            thisenv->env_id, fdnum);
+  80188f:	a1 e4 5e 80 00       	mov    0x805ee4,%eax
+  801894:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801897:	83 ec 04             	sub    $0x4,%esp
+  80189a:	53                   	push   %ebx
+  80189b:	50                   	push   %eax
+  80189c:	68 d0 3d 80 00       	push   $0x803dd0
+  8018a1:	e8 28 ec ff ff       	call   8004ce <cprintf>
+    return -E_INVAL;
+  8018a6:	83 c4 10             	add    $0x10,%esp
+  8018a9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018ae:	eb d8                	jmp    801888 <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  8018b0:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8018b5:	eb d1                	jmp    801888 <ftruncate+0x50>
+
+008018b7 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8018b7:	55                   	push   %ebp
+  8018b8:	89 e5                	mov    %esp,%ebp
+  8018ba:	56                   	push   %esi
+  8018bb:	53                   	push   %ebx
+  8018bc:	83 ec 18             	sub    $0x18,%esp
+  8018bf:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  8018c2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018c5:	50                   	push   %eax
+  8018c6:	ff 75 08             	push   0x8(%ebp)
+  8018c9:	e8 46 fb ff ff       	call   801414 <fd_lookup>
+  8018ce:	83 c4 10             	add    $0x10,%esp
+  8018d1:	85 c0                	test   %eax,%eax
+  8018d3:	78 49                	js     80191e <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8018d5:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8018d8:	83 ec 08             	sub    $0x8,%esp
+  8018db:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018de:	50                   	push   %eax
+  8018df:	ff 36                	push   (%esi)
+  8018e1:	e8 7e fb ff ff       	call   801464 <dev_lookup>
+  8018e6:	83 c4 10             	add    $0x10,%esp
+  8018e9:	85 c0                	test   %eax,%eax
+  8018eb:	78 31                	js     80191e <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  8018ed:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018f0:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8018f4:	74 2f                	je     801925 <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  8018f6:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  8018f9:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801900:	00 00 00 
+  stat->st_isdir = 0;
+  801903:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80190a:	00 00 00 
+  stat->st_dev = dev;
+  80190d:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  801913:	83 ec 08             	sub    $0x8,%esp
+  801916:	53                   	push   %ebx
+  801917:	56                   	push   %esi
+  801918:	ff 50 14             	call   *0x14(%eax)
+  80191b:	83 c4 10             	add    $0x10,%esp
+}
+  80191e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801921:	5b                   	pop    %ebx
+  801922:	5e                   	pop    %esi
+  801923:	5d                   	pop    %ebp
+  801924:	c3                   	ret
+    return -E_NOT_SUPP;
+  801925:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80192a:	eb f2                	jmp    80191e <fstat+0x67>
+
+0080192c <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  80192c:	55                   	push   %ebp
+  80192d:	89 e5                	mov    %esp,%ebp
+  80192f:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  801932:	ff 75 0c             	push   0xc(%ebp)
+  801935:	ff 75 08             	push   0x8(%ebp)
+  801938:	e8 58 07 00 00       	call   802095 <file_stat>
+}
+  80193d:	c9                   	leave
+  80193e:	c3                   	ret
+
+0080193f <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  80193f:	55                   	push   %ebp
+  801940:	89 e5                	mov    %esp,%ebp
+  801942:	57                   	push   %edi
+  801943:	56                   	push   %esi
+  801944:	53                   	push   %ebx
+  801945:	83 ec 1c             	sub    $0x1c,%esp
+  801948:	89 c7                	mov    %eax,%edi
+  80194a:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  80194d:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801950:	e9 a2 00 00 00       	jmp    8019f7 <fsipc_send+0xb8>
+  nfsenvs = 0;
+  801955:	c7 05 80 50 80 00 00 	movl   $0x0,0x805080
+  80195c:	00 00 00 
+  80195f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801964:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801969:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  80196e:	be 01 00 00 00       	mov    $0x1,%esi
+  801973:	eb 0f                	jmp    801984 <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801975:	83 c0 01             	add    $0x1,%eax
+  801978:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80197d:	74 49                	je     8019c8 <fsipc_send+0x89>
+  80197f:	83 f9 07             	cmp    $0x7,%ecx
+  801982:	7f 50                	jg     8019d4 <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  801984:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801987:	c1 e2 04             	shl    $0x4,%edx
+  80198a:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801990:	8b 52 50             	mov    0x50(%edx),%edx
+  801993:	83 fa 01             	cmp    $0x1,%edx
+  801996:	75 dd                	jne    801975 <fsipc_send+0x36>
+  801998:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  80199b:	c1 e2 04             	shl    $0x4,%edx
+  80199e:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8019a4:	8b 52 54             	mov    0x54(%edx),%edx
+  8019a7:	85 d2                	test   %edx,%edx
+  8019a9:	74 ca                	je     801975 <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  8019ab:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  8019ae:	c1 e2 04             	shl    $0x4,%edx
+  8019b1:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8019b7:	8b 52 48             	mov    0x48(%edx),%edx
+  8019ba:	89 14 8d a0 50 80 00 	mov    %edx,0x8050a0(,%ecx,4)
+  8019c1:	8d 49 01             	lea    0x1(%ecx),%ecx
+  8019c4:	89 f3                	mov    %esi,%ebx
+  8019c6:	eb ad                	jmp    801975 <fsipc_send+0x36>
+  8019c8:	84 db                	test   %bl,%bl
+  8019ca:	74 38                	je     801a04 <fsipc_send+0xc5>
+  8019cc:	89 0d 80 50 80 00    	mov    %ecx,0x805080
+  8019d2:	eb 30                	jmp    801a04 <fsipc_send+0xc5>
+  8019d4:	84 db                	test   %bl,%bl
+  8019d6:	74 2c                	je     801a04 <fsipc_send+0xc5>
+  8019d8:	89 0d 80 50 80 00    	mov    %ecx,0x805080
+  8019de:	eb 24                	jmp    801a04 <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  8019e0:	50                   	push   %eax
+  8019e1:	68 3c 3e 80 00       	push   $0x803e3c
+  8019e6:	6a 34                	push   $0x34
+  8019e8:	68 46 3e 80 00       	push   $0x803e46
+  8019ed:	e8 01 ea ff ff       	call   8003f3 <_panic>
+    }
+    sys_yield();
+  8019f2:	e8 92 f4 ff ff       	call   800e89 <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  8019f7:	83 3d 80 50 80 00 03 	cmpl   $0x3,0x805080
+  8019fe:	0f 8e 51 ff ff ff    	jle    801955 <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  801a04:	a1 e4 5e 80 00       	mov    0x805ee4,%eax
+  801a09:	8b 70 48             	mov    0x48(%eax),%esi
+  801a0c:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  801a12:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a17:	8b 0d 80 50 80 00    	mov    0x805080,%ecx
+  801a1d:	39 d9                	cmp    %ebx,%ecx
+  801a1f:	7e d1                	jle    8019f2 <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  801a21:	83 ec 0c             	sub    $0xc,%esp
+  801a24:	ff 75 e0             	push   -0x20(%ebp)
+  801a27:	6a 07                	push   $0x7
+  801a29:	ff 75 e4             	push   -0x1c(%ebp)
+  801a2c:	57                   	push   %edi
+  801a2d:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  801a30:	99                   	cltd
+  801a31:	f7 f9                	idiv   %ecx
+  801a33:	ff 34 95 a0 50 80 00 	push   0x8050a0(,%edx,4)
+  801a3a:	e8 63 f7 ff ff       	call   8011a2 <sys_ipc_try_send>
+      if (r == 0)
+  801a3f:	83 c4 20             	add    $0x20,%esp
+  801a42:	85 c0                	test   %eax,%eax
+  801a44:	74 0a                	je     801a50 <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  801a46:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801a49:	75 95                	jne    8019e0 <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  801a4b:	83 c3 01             	add    $0x1,%ebx
+  801a4e:	eb c7                	jmp    801a17 <fsipc_send+0xd8>
+  }
+}
+  801a50:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a53:	5b                   	pop    %ebx
+  801a54:	5e                   	pop    %esi
+  801a55:	5f                   	pop    %edi
+  801a56:	5d                   	pop    %ebp
+  801a57:	c3                   	ret
+
+00801a58 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801a58:	55                   	push   %ebp
+  801a59:	89 e5                	mov    %esp,%ebp
+  801a5b:	53                   	push   %ebx
+  801a5c:	83 ec 14             	sub    $0x14,%esp
+  801a5f:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  801a61:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  801a68:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801a6d:	ba 00 60 80 00       	mov    $0x806000,%edx
+  801a72:	e8 c8 fe ff ff       	call   80193f <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801a77:	6a 00                	push   $0x0
+  801a79:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a7c:	50                   	push   %eax
+  801a7d:	53                   	push   %ebx
+  801a7e:	6a 00                	push   $0x0
+  801a80:	e8 1e 1b 00 00       	call   8035a3 <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  801a85:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a88:	c9                   	leave
+  801a89:	c3                   	ret
+
+00801a8a <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801a8a:	55                   	push   %ebp
+  801a8b:	89 e5                	mov    %esp,%ebp
+  801a8d:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801a90:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a93:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a96:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.set_size.req_size = newsize;
+  801a9b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a9e:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801aa3:	ba 00 00 00 00       	mov    $0x0,%edx
+  801aa8:	b8 02 00 00 00       	mov    $0x2,%eax
+  801aad:	e8 a6 ff ff ff       	call   801a58 <fsipc>
+}
+  801ab2:	c9                   	leave
+  801ab3:	c3                   	ret
+
+00801ab4 <devfile_flush>:
+{
+  801ab4:	55                   	push   %ebp
+  801ab5:	89 e5                	mov    %esp,%ebp
+  801ab7:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801aba:	8b 45 08             	mov    0x8(%ebp),%eax
+  801abd:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ac0:	a3 00 60 80 00       	mov    %eax,0x806000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801ac5:	ba 00 00 00 00       	mov    $0x0,%edx
+  801aca:	b8 06 00 00 00       	mov    $0x6,%eax
+  801acf:	e8 84 ff ff ff       	call   801a58 <fsipc>
+}
+  801ad4:	c9                   	leave
+  801ad5:	c3                   	ret
+
+00801ad6 <devfile_stat>:
+{
+  801ad6:	55                   	push   %ebp
+  801ad7:	89 e5                	mov    %esp,%ebp
+  801ad9:	53                   	push   %ebx
+  801ada:	83 ec 04             	sub    $0x4,%esp
+  801add:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801ae0:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ae3:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ae6:	a3 00 60 80 00       	mov    %eax,0x806000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801aeb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801af0:	b8 05 00 00 00       	mov    $0x5,%eax
+  801af5:	e8 5e ff ff ff       	call   801a58 <fsipc>
+  801afa:	85 c0                	test   %eax,%eax
+  801afc:	78 2c                	js     801b2a <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801afe:	83 ec 08             	sub    $0x8,%esp
+  801b01:	68 00 60 80 00       	push   $0x806000
+  801b06:	53                   	push   %ebx
+  801b07:	e8 b0 ef ff ff       	call   800abc <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  801b0c:	a1 80 60 80 00       	mov    0x806080,%eax
+  801b11:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801b17:	a1 84 60 80 00       	mov    0x806084,%eax
+  801b1c:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801b22:	83 c4 10             	add    $0x10,%esp
+  801b25:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b2a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801b2d:	c9                   	leave
+  801b2e:	c3                   	ret
+
+00801b2f <fsv_alloc>:
+{
+  801b2f:	55                   	push   %ebp
+  801b30:	89 e5                	mov    %esp,%ebp
+  801b32:	56                   	push   %esi
+  801b33:	53                   	push   %ebx
+  801b34:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  801b36:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b3b:	eb 22                	jmp    801b5f <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  801b3d:	83 ec 04             	sub    $0x4,%esp
+  801b40:	6a 00                	push   $0x0
+  801b42:	6a 00                	push   $0x0
+  801b44:	6a 07                	push   $0x7
+  801b46:	50                   	push   %eax
+  801b47:	6a 00                	push   $0x0
+  801b49:	6a 04                	push   $0x4
+  801b4b:	68 c0 50 80 00       	push   $0x8050c0
+  801b50:	e8 e9 f7 ff ff       	call   80133e <sysbatch_add>
+  801b55:	83 c4 20             	add    $0x20,%esp
+  801b58:	85 c0                	test   %eax,%eax
+  801b5a:	78 48                	js     801ba4 <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  801b5c:	83 c3 01             	add    $0x1,%ebx
+  801b5f:	39 f3                	cmp    %esi,%ebx
+  801b61:	74 31                	je     801b94 <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  801b63:	89 d8                	mov    %ebx,%eax
+  801b65:	c1 e0 0c             	shl    $0xc,%eax
+  801b68:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801b6d:	89 c2                	mov    %eax,%edx
+  801b6f:	c1 ea 16             	shr    $0x16,%edx
+  801b72:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801b79:	f6 c2 01             	test   $0x1,%dl
+  801b7c:	74 bf                	je     801b3d <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  801b7e:	89 c2                	mov    %eax,%edx
+  801b80:	c1 ea 0c             	shr    $0xc,%edx
+  801b83:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801b8a:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801b8d:	83 fa 03             	cmp    $0x3,%edx
+  801b90:	75 ab                	jne    801b3d <fsv_alloc+0xe>
+  801b92:	eb c8                	jmp    801b5c <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  801b94:	83 ec 0c             	sub    $0xc,%esp
+  801b97:	68 c0 50 80 00       	push   $0x8050c0
+  801b9c:	e8 4d f7 ff ff       	call   8012ee <sysbatch_flush>
+  801ba1:	83 c4 10             	add    $0x10,%esp
+}
+  801ba4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ba7:	5b                   	pop    %ebx
+  801ba8:	5e                   	pop    %esi
+  801ba9:	5d                   	pop    %ebp
+  801baa:	c3                   	ret
+
+00801bab <devfile_read>:
+{
+  801bab:	55                   	push   %ebp
+  801bac:	89 e5                	mov    %esp,%ebp
+  801bae:	57                   	push   %edi
+  801baf:	56                   	push   %esi
+  801bb0:	53                   	push   %ebx
+  801bb1:	83 ec 3c             	sub    $0x3c,%esp
+  801bb4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  801bb7:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  801bbd:	77 57                	ja     801c16 <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801bbf:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bc2:	8b 40 0c             	mov    0xc(%eax),%eax
+  801bc5:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read.req_n = n;
+  801bca:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801bd0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bd5:	b8 03 00 00 00       	mov    $0x3,%eax
+  801bda:	e8 79 fe ff ff       	call   801a58 <fsipc>
+  801bdf:	89 c6                	mov    %eax,%esi
+  801be1:	85 c0                	test   %eax,%eax
+  801be3:	78 27                	js     801c0c <devfile_read+0x61>
+  assert(r <= n);
+  801be5:	39 c3                	cmp    %eax,%ebx
+  801be7:	0f 82 0e 02 00 00    	jb     801dfb <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  801bed:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801bf2:	0f 8f 1c 02 00 00    	jg     801e14 <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801bf8:	83 ec 04             	sub    $0x4,%esp
+  801bfb:	50                   	push   %eax
+  801bfc:	68 00 60 80 00       	push   $0x806000
+  801c01:	ff 75 0c             	push   0xc(%ebp)
+  801c04:	e8 39 f0 ff ff       	call   800c42 <memmove>
+  return r;
+  801c09:	83 c4 10             	add    $0x10,%esp
+}
+  801c0c:	89 f0                	mov    %esi,%eax
+  801c0e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c11:	5b                   	pop    %ebx
+  801c12:	5e                   	pop    %esi
+  801c13:	5f                   	pop    %edi
+  801c14:	5d                   	pop    %ebp
+  801c15:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  801c16:	b8 01 00 00 00       	mov    $0x1,%eax
+  801c1b:	e8 0f ff ff ff       	call   801b2f <fsv_alloc>
+  801c20:	89 c6                	mov    %eax,%esi
+  801c22:	85 c0                	test   %eax,%eax
+  801c24:	78 e6                	js     801c0c <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  801c26:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c29:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c2c:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  801c31:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c34:	8b 40 04             	mov    0x4(%eax),%eax
+  801c37:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  801c3c:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  801c42:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801c49:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801c4e:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801c53:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801c58:	e8 e2 fc ff ff       	call   80193f <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801c5d:	6a 00                	push   $0x0
+  801c5f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801c62:	50                   	push   %eax
+  801c63:	68 00 10 c0 9f       	push   $0x9fc01000
+  801c68:	6a 00                	push   $0x0
+  801c6a:	e8 34 19 00 00       	call   8035a3 <ipc_recv_pages>
+  801c6f:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  801c71:	83 c4 10             	add    $0x10,%esp
+  801c74:	85 c0                	test   %eax,%eax
+  801c76:	7e 94                	jle    801c0c <devfile_read+0x61>
+  assert(r <= n);
+  801c78:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801c7b:	39 c3                	cmp    %eax,%ebx
+  801c7d:	72 2e                	jb     801cad <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801c7f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c82:	8b 40 04             	mov    0x4(%eax),%eax
+  801c85:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801c8a:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  801c8d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801c90:	c1 e2 0c             	shl    $0xc,%edx
+  801c93:	39 ca                	cmp    %ecx,%edx
+  801c95:	72 2f                	jb     801cc6 <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  801c97:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  801c9c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  801c9f:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  801ca3:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801ca8:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  801cab:	eb 52                	jmp    801cff <devfile_read+0x154>
+  assert(r <= n);
+  801cad:	68 51 3e 80 00       	push   $0x803e51
+  801cb2:	68 58 3e 80 00       	push   $0x803e58
+  801cb7:	68 49 01 00 00       	push   $0x149
+  801cbc:	68 46 3e 80 00       	push   $0x803e46
+  801cc1:	e8 2d e7 ff ff       	call   8003f3 <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801cc6:	68 7c 3e 80 00       	push   $0x803e7c
+  801ccb:	68 58 3e 80 00       	push   $0x803e58
+  801cd0:	68 4a 01 00 00       	push   $0x14a
+  801cd5:	68 46 3e 80 00       	push   $0x803e46
+  801cda:	e8 14 e7 ff ff       	call   8003f3 <_panic>
+      memmove(dst + done, src + done, m);
+  801cdf:	83 ec 04             	sub    $0x4,%esp
+  801ce2:	53                   	push   %ebx
+  801ce3:	56                   	push   %esi
+  801ce4:	89 f8                	mov    %edi,%eax
+  801ce6:	03 45 0c             	add    0xc(%ebp),%eax
+  801ce9:	50                   	push   %eax
+  801cea:	e8 53 ef ff ff       	call   800c42 <memmove>
+  801cef:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  801cf2:	01 df                	add    %ebx,%edi
+  801cf4:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801cf7:	39 c7                	cmp    %eax,%edi
+  801cf9:	0f 83 c0 00 00 00    	jae    801dbf <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801cff:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801d02:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  801d05:	89 f0                	mov    %esi,%eax
+  801d07:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801d0c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  801d11:	29 c3                	sub    %eax,%ebx
+  801d13:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801d16:	29 f8                	sub    %edi,%eax
+  801d18:	39 c3                	cmp    %eax,%ebx
+  801d1a:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  801d1d:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801d23:	75 ba                	jne    801cdf <devfile_read+0x134>
+  801d25:	89 f9                	mov    %edi,%ecx
+  801d27:	03 4d 0c             	add    0xc(%ebp),%ecx
+  801d2a:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  801d2d:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  801d33:	75 aa                	jne    801cdf <devfile_read+0x134>
+  801d35:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  801d3b:	77 a2                	ja     801cdf <devfile_read+0x134>
+  801d3d:	89 c8                	mov    %ecx,%eax
+  801d3f:	c1 e8 16             	shr    $0x16,%eax
+  801d42:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801d49:	a8 01                	test   $0x1,%al
+  801d4b:	74 92                	je     801cdf <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  801d4d:	89 c8                	mov    %ecx,%eax
+  801d4f:	c1 e8 0c             	shr    $0xc,%eax
+  801d52:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  801d59:	a8 01                	test   $0x1,%al
+  801d5b:	74 82                	je     801cdf <devfile_read+0x134>
+  801d5d:	a9 02 08 00 00       	test   $0x802,%eax
+  801d62:	0f 84 77 ff ff ff    	je     801cdf <devfile_read+0x134>
+  801d68:	f6 c4 04             	test   $0x4,%ah
+  801d6b:	0f 85 6e ff ff ff    	jne    801cdf <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  801d71:	a1 e4 5e 80 00       	mov    0x805ee4,%eax
+  801d76:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  801d7a:	84 c0                	test   %al,%al
+  801d7c:	75 17                	jne    801d95 <devfile_read+0x1ea>
+  801d7e:	83 ec 08             	sub    $0x8,%esp
+  801d81:	6a 01                	push   $0x1
+  801d83:	6a 00                	push   $0x0
+  801d85:	e8 1e f1 ff ff       	call   800ea8 <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  801d8a:	83 c4 10             	add    $0x10,%esp
+  801d8d:	85 c0                	test   %eax,%eax
+  801d8f:	0f 85 4a ff ff ff    	jne    801cdf <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  801d95:	83 ec 04             	sub    $0x4,%esp
+  801d98:	68 05 08 00 00       	push   $0x805
+  801d9d:	ff 75 cc             	push   -0x34(%ebp)
+  801da0:	6a 00                	push   $0x0
+  801da2:	56                   	push   %esi
+  801da3:	6a 00                	push   $0x0
+  801da5:	6a 05                	push   $0x5
+  801da7:	68 c0 50 80 00       	push   $0x8050c0
+  801dac:	e8 8d f5 ff ff       	call   80133e <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  801db1:	c1 e8 1f             	shr    $0x1f,%eax
+  801db4:	08 45 cb             	or     %al,-0x35(%ebp)
+  801db7:	83 c4 20             	add    $0x20,%esp
+  801dba:	e9 33 ff ff ff       	jmp    801cf2 <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  801dbf:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  801dc2:	83 ec 0c             	sub    $0xc,%esp
+  801dc5:	68 c0 50 80 00       	push   $0x8050c0
+  801dca:	e8 1f f5 ff ff       	call   8012ee <sysbatch_flush>
+  801dcf:	83 c4 10             	add    $0x10,%esp
+  801dd2:	85 c0                	test   %eax,%eax
+  801dd4:	78 06                	js     801ddc <devfile_read+0x231>
+  801dd6:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  801dda:	74 14                	je     801df0 <devfile_read+0x245>
+    memmove(dst, src, r);
+  801ddc:	83 ec 04             	sub    $0x4,%esp
+  801ddf:	ff 75 d4             	push   -0x2c(%ebp)
+  801de2:	ff 75 d0             	push   -0x30(%ebp)
+  801de5:	ff 75 0c             	push   0xc(%ebp)
+  801de8:	e8 55 ee ff ff       	call   800c42 <memmove>
+  801ded:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  801df0:	8b 45 08             	mov    0x8(%ebp),%eax
+  801df3:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  801df6:	e9 11 fe ff ff       	jmp    801c0c <devfile_read+0x61>
+  assert(r <= n);
+  801dfb:	68 51 3e 80 00       	push   $0x803e51
+  801e00:	68 58 3e 80 00       	push   $0x803e58
+  801e05:	68 1c 01 00 00       	push   $0x11c
+  801e0a:	68 46 3e 80 00       	push   $0x803e46
+  801e0f:	e8 df e5 ff ff       	call   8003f3 <_panic>
+  assert(r <= PGSIZE);
+  801e14:	68 6d 3e 80 00       	push   $0x803e6d
+  801e19:	68 58 3e 80 00       	push   $0x803e58
+  801e1e:	68 1d 01 00 00       	push   $0x11d
+  801e23:	68 46 3e 80 00       	push   $0x803e46
+  801e28:	e8 c6 e5 ff ff       	call   8003f3 <_panic>
+
+00801e2d <devfile_write>:
+{
+  801e2d:	55                   	push   %ebp
+  801e2e:	89 e5                	mov    %esp,%ebp
+  801e30:	57                   	push   %edi
+  801e31:	56                   	push   %esi
+  801e32:	53                   	push   %ebx
+  801e33:	83 ec 1c             	sub    $0x1c,%esp
+  801e36:	8b 75 08             	mov    0x8(%ebp),%esi
+  801e39:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  801e3c:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  801e41:	77 39                	ja     801e7c <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801e43:	8b 56 0c             	mov    0xc(%esi),%edx
+  801e46:	89 15 00 60 80 00    	mov    %edx,0x806000
+  fsipcbuf.write.req_n = n;
+  801e4c:	a3 04 60 80 00       	mov    %eax,0x806004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  801e51:	83 ec 04             	sub    $0x4,%esp
+  801e54:	50                   	push   %eax
+  801e55:	ff 75 0c             	push   0xc(%ebp)
+  801e58:	68 08 60 80 00       	push   $0x806008
+  801e5d:	e8 e0 ed ff ff       	call   800c42 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801e62:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e67:	b8 04 00 00 00       	mov    $0x4,%eax
+  801e6c:	e8 e7 fb ff ff       	call   801a58 <fsipc>
+  801e71:	83 c4 10             	add    $0x10,%esp
+}
+  801e74:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e77:	5b                   	pop    %ebx
+  801e78:	5e                   	pop    %esi
+  801e79:	5f                   	pop    %edi
+  801e7a:	5d                   	pop    %ebp
+  801e7b:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  801e7c:	ba 00 00 10 00       	mov    $0x100000,%edx
+  801e81:	39 d0                	cmp    %edx,%eax
+  801e83:	89 d3                	mov    %edx,%ebx
+  801e85:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  801e88:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  801e8e:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  801e91:	83 c7 01             	add    $0x1,%edi
+  801e94:	89 f8                	mov    %edi,%eax
+  801e96:	e8 94 fc ff ff       	call   801b2f <fsv_alloc>
+  801e9b:	85 c0                	test   %eax,%eax
+  801e9d:	78 d5                	js     801e74 <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  801e9f:	83 ec 04             	sub    $0x4,%esp
+  801ea2:	53                   	push   %ebx
+  801ea3:	ff 75 0c             	push   0xc(%ebp)
+  801ea6:	68 00 10 c0 9f       	push   $0x9fc01000
+  801eab:	e8 92 ed ff ff       	call   800c42 <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  801eb0:	8b 46 0c             	mov    0xc(%esi),%eax
+  801eb3:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  801eb8:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  801ebe:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801ec5:	89 f9                	mov    %edi,%ecx
+  801ec7:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801ecc:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801ed1:	e8 69 fa ff ff       	call   80193f <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801ed6:	6a 00                	push   $0x0
+  801ed8:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801edb:	50                   	push   %eax
+  801edc:	6a 00                	push   $0x0
+  801ede:	6a 00                	push   $0x0
+  801ee0:	e8 be 16 00 00       	call   8035a3 <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  801ee5:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  801ee8:	eb 8a                	jmp    801e74 <devfile_write+0x47>
+
+00801eea <open>:
+{
+  801eea:	55                   	push   %ebp
+  801eeb:	89 e5                	mov    %esp,%ebp
+  801eed:	56                   	push   %esi
+  801eee:	53                   	push   %ebx
+  801eef:	83 ec 1c             	sub    $0x1c,%esp
+  801ef2:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801ef5:	56                   	push   %esi
+  801ef6:	e8 86 eb ff ff       	call   800a81 <strlen>
+  801efb:	83 c4 10             	add    $0x10,%esp
+  801efe:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801f03:	7f 6c                	jg     801f71 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  801f05:	83 ec 0c             	sub    $0xc,%esp
+  801f08:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f0b:	50                   	push   %eax
+  801f0c:	e8 ad f4 ff ff       	call   8013be <fd_alloc>
+  801f11:	89 c3                	mov    %eax,%ebx
+  801f13:	83 c4 10             	add    $0x10,%esp
+  801f16:	85 c0                	test   %eax,%eax
+  801f18:	78 3c                	js     801f56 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801f1a:	83 ec 08             	sub    $0x8,%esp
+  801f1d:	56                   	push   %esi
+  801f1e:	68 00 60 80 00       	push   $0x806000
+  801f23:	e8 94 eb ff ff       	call   800abc <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801f28:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f2b:	a3 00 64 80 00       	mov    %eax,0x806400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801f30:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801f33:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f38:	e8 1b fb ff ff       	call   801a58 <fsipc>
+  801f3d:	89 c3                	mov    %eax,%ebx
+  801f3f:	83 c4 10             	add    $0x10,%esp
+  801f42:	85 c0                	test   %eax,%eax
+  801f44:	78 19                	js     801f5f <open+0x75>
+  return fd2num(fd);
+  801f46:	83 ec 0c             	sub    $0xc,%esp
+  801f49:	ff 75 f4             	push   -0xc(%ebp)
+  801f4c:	e8 49 f4 ff ff       	call   80139a <fd2num>
+  801f51:	89 c3                	mov    %eax,%ebx
+  801f53:	83 c4 10             	add    $0x10,%esp
+}
+  801f56:	89 d8                	mov    %ebx,%eax
+  801f58:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f5b:	5b                   	pop    %ebx
+  801f5c:	5e                   	pop    %esi
+  801f5d:	5d                   	pop    %ebp
+  801f5e:	c3                   	ret
+    fd_close(fd, 0);
+  801f5f:	83 ec 08             	sub    $0x8,%esp
+  801f62:	6a 00                	push   $0x0
+  801f64:	ff 75 f4             	push   -0xc(%ebp)
+  801f67:	e8 44 f5 ff ff       	call   8014b0 <fd_close>
+    return r;
+  801f6c:	83 c4 10             	add    $0x10,%esp
+  801f6f:	eb e5                	jmp    801f56 <open+0x6c>
+    return -E_BAD_PATH;
+  801f71:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801f76:	eb de                	jmp    801f56 <open+0x6c>
+
+00801f78 <open_read>:
+{
+  801f78:	55                   	push   %ebp
+  801f79:	89 e5                	mov    %esp,%ebp
+  801f7b:	57                   	push   %edi
+  801f7c:	56                   	push   %esi
+  801f7d:	53                   	push   %ebx
+  801f7e:	83 ec 28             	sub    $0x28,%esp
+  801f81:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  801f84:	57                   	push   %edi
+  801f85:	e8 f7 ea ff ff       	call   800a81 <strlen>
+  801f8a:	83 c4 10             	add    $0x10,%esp
+  801f8d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801f92:	0f 87 f6 00 00 00    	ja     80208e <open_read+0x116>
+  801f98:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  801f9a:	83 ec 0c             	sub    $0xc,%esp
+  801f9d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801fa0:	50                   	push   %eax
+  801fa1:	e8 18 f4 ff ff       	call   8013be <fd_alloc>
+  801fa6:	89 c3                	mov    %eax,%ebx
+  801fa8:	83 c4 10             	add    $0x10,%esp
+  801fab:	85 c0                	test   %eax,%eax
+  801fad:	0f 88 b2 00 00 00    	js     802065 <open_read+0xed>
+  strcpy(req->req_buf, path);
+  801fb3:	83 ec 08             	sub    $0x8,%esp
+  801fb6:	57                   	push   %edi
+  801fb7:	68 e4 60 80 00       	push   $0x8060e4
+  801fbc:	e8 fb ea ff ff       	call   800abc <strcpy>
+  req->req_nops = 2;
+  801fc1:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  801fc8:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  801fcb:	c7 05 04 60 80 00 01 	movl   $0x1,0x806004
+  801fd2:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  801fd5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801fd8:	a3 10 60 80 00       	mov    %eax,0x806010
+  req->req_ops[0].op_buf = 0;
+  801fdd:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  801fe4:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  801fe7:	c7 05 20 60 80 00 04 	movl   $0x4,0x806020
+  801fee:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  801ff1:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  801ff8:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  801ffb:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  802000:	29 f0                	sub    %esi,%eax
+  802002:	3b 45 14             	cmp    0x14(%ebp),%eax
+  802005:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  802009:	a3 2c 60 80 00       	mov    %eax,0x80602c
+  req->req_ops[1].op_offset = 0;
+  80200e:	c7 05 30 60 80 00 00 	movl   $0x0,0x806030
+  802015:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  802018:	83 c6 01             	add    $0x1,%esi
+  80201b:	89 35 34 60 80 00    	mov    %esi,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  802021:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802024:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802029:	e8 2a fa ff ff       	call   801a58 <fsipc>
+  80202e:	89 c3                	mov    %eax,%ebx
+  802030:	83 c4 10             	add    $0x10,%esp
+  802033:	83 f8 01             	cmp    $0x1,%eax
+  802036:	7e 37                	jle    80206f <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  802038:	a1 38 60 80 00       	mov    0x806038,%eax
+  80203d:	8b 55 18             	mov    0x18(%ebp),%edx
+  802040:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  802042:	83 ec 04             	sub    $0x4,%esp
+  802045:	50                   	push   %eax
+  802046:	81 c6 e4 60 80 00    	add    $0x8060e4,%esi
+  80204c:	56                   	push   %esi
+  80204d:	ff 75 10             	push   0x10(%ebp)
+  802050:	e8 ed eb ff ff       	call   800c42 <memmove>
+  return fd2num(fd);
+  802055:	83 c4 04             	add    $0x4,%esp
+  802058:	ff 75 e4             	push   -0x1c(%ebp)
+  80205b:	e8 3a f3 ff ff       	call   80139a <fd2num>
+  802060:	89 c3                	mov    %eax,%ebx
+  802062:	83 c4 10             	add    $0x10,%esp
+}
+  802065:	89 d8                	mov    %ebx,%eax
+  802067:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80206a:	5b                   	pop    %ebx
+  80206b:	5e                   	pop    %esi
+  80206c:	5f                   	pop    %edi
+  80206d:	5d                   	pop    %ebp
+  80206e:	c3                   	ret
+    fd_close(fd, 0);
+  80206f:	83 ec 08             	sub    $0x8,%esp
+  802072:	6a 00                	push   $0x0
+  802074:	ff 75 e4             	push   -0x1c(%ebp)
+  802077:	e8 34 f4 ff ff       	call   8014b0 <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  80207c:	83 c4 10             	add    $0x10,%esp
+  80207f:	85 db                	test   %ebx,%ebx
+  802081:	78 e2                	js     802065 <open_read+0xed>
+  802083:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  802086:	8b 9b 1c 60 80 00    	mov    0x80601c(%ebx),%ebx
+  80208c:	eb d7                	jmp    802065 <open_read+0xed>
+    return -E_BAD_PATH;
+  80208e:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802093:	eb d0                	jmp    802065 <open_read+0xed>
+
+00802095 <file_stat>:
+{
+  802095:	55                   	push   %ebp
+  802096:	89 e5                	mov    %esp,%ebp
+  802098:	57                   	push   %edi
+  802099:	56                   	push   %esi
+  80209a:	53                   	push   %ebx
+  80209b:	83 ec 18             	sub    $0x18,%esp
+  80209e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8020a1:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  8020a4:	57                   	push   %edi
+  8020a5:	e8 d7 e9 ff ff       	call   800a81 <strlen>
+  8020aa:	83 c4 10             	add    $0x10,%esp
+  8020ad:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8020b2:	0f 8f c7 00 00 00    	jg     80217f <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  8020b8:	83 ec 0c             	sub    $0xc,%esp
+  8020bb:	57                   	push   %edi
+  8020bc:	e8 c0 e9 ff ff       	call   800a81 <strlen>
+  8020c1:	8d 58 04             	lea    0x4(%eax),%ebx
+  8020c4:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  8020c7:	83 c4 08             	add    $0x8,%esp
+  8020ca:	57                   	push   %edi
+  8020cb:	68 e4 60 80 00       	push   $0x8060e4
+  8020d0:	e8 e7 e9 ff ff       	call   800abc <strcpy>
+  req->req_nops = 2;
+  8020d5:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  8020dc:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  8020df:	c7 05 04 60 80 00 02 	movl   $0x2,0x806004
+  8020e6:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  8020e9:	c7 05 10 60 80 00 00 	movl   $0x0,0x806010
+  8020f0:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  8020f3:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  8020fa:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  8020fd:	c7 05 20 60 80 00 03 	movl   $0x3,0x806020
+  802104:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  802107:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  80210e:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  802111:	89 1d 34 60 80 00    	mov    %ebx,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  802117:	ba 00 00 00 00       	mov    $0x0,%edx
+  80211c:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802121:	e8 32 f9 ff ff       	call   801a58 <fsipc>
+  802126:	83 c4 10             	add    $0x10,%esp
+  802129:	83 f8 01             	cmp    $0x1,%eax
+  80212c:	7e 42                	jle    802170 <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  80212e:	81 c3 e4 60 80 00    	add    $0x8060e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  802134:	83 ec 08             	sub    $0x8,%esp
+  802137:	53                   	push   %ebx
+  802138:	56                   	push   %esi
+  802139:	e8 7e e9 ff ff       	call   800abc <strcpy>
+  st->st_size = ret->ret_size;
+  80213e:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  802144:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  80214a:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  802150:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  802156:	c7 86 88 00 00 00 04 	movl   $0x804004,0x88(%esi)
+  80215d:	40 80 00 
+  return 0;
+  802160:	83 c4 10             	add    $0x10,%esp
+  802163:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802168:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80216b:	5b                   	pop    %ebx
+  80216c:	5e                   	pop    %esi
+  80216d:	5f                   	pop    %edi
+  80216e:	5d                   	pop    %ebp
+  80216f:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  802170:	85 c0                	test   %eax,%eax
+  802172:	78 f4                	js     802168 <file_stat+0xd3>
+  802174:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802177:	8b 80 1c 60 80 00    	mov    0x80601c(%eax),%eax
+  80217d:	eb e9                	jmp    802168 <file_stat+0xd3>
+    return -E_BAD_PATH;
+  80217f:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802184:	eb e2                	jmp    802168 <file_stat+0xd3>
+
+00802186 <read_map>:
+{
+  802186:	55                   	push   %ebp
+  802187:	89 e5                	mov    %esp,%ebp
+  802189:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80218c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80218f:	50                   	push   %eax
+  802190:	ff 75 08             	push   0x8(%ebp)
+  802193:	e8 7c f2 ff ff       	call   801414 <fd_lookup>
+  802198:	83 c4 10             	add    $0x10,%esp
+  80219b:	85 c0                	test   %eax,%eax
+  80219d:	78 2a                	js     8021c9 <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  80219f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8021a2:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  8021a8:	39 08                	cmp    %ecx,(%eax)
+  8021aa:	75 1f                	jne    8021cb <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  8021ac:	8b 40 0c             	mov    0xc(%eax),%eax
+  8021af:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read_map.req_offset = offset;
+  8021b4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021b7:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  8021bc:	8b 55 10             	mov    0x10(%ebp),%edx
+  8021bf:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8021c4:	e8 8f f8 ff ff       	call   801a58 <fsipc>
+}
+  8021c9:	c9                   	leave
+  8021ca:	c3                   	ret
+    return -E_INVAL;
+  8021cb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021d0:	eb f7                	jmp    8021c9 <read_map+0x43>
+
+008021d2 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8021d2:	55                   	push   %ebp
+  8021d3:	89 e5                	mov    %esp,%ebp
+  8021d5:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  8021d8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021dd:	b8 08 00 00 00       	mov    $0x8,%eax
+  8021e2:	e8 71 f8 ff ff       	call   801a58 <fsipc>
+}
+  8021e7:	c9                   	leave
+  8021e8:	c3                   	ret
+
+008021e9 <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  8021e9:	55                   	push   %ebp
+  8021ea:	89 e5                	mov    %esp,%ebp
+  8021ec:	57                   	push   %edi
+  8021ed:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  8021ee:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021f1:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.stats.req_bio_sched = 0;
+  8021f6:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  8021fd:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  802200:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  802207:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  80220a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80220f:	b8 09 00 00 00       	mov    $0x9,%eax
+  802214:	e8 3f f8 ff ff       	call   801a58 <fsipc>
+  802219:	85 c0                	test   %eax,%eax
+  80221b:	78 14                	js     802231 <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  80221d:	be 00 60 80 00       	mov    $0x806000,%esi
+  802222:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802227:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  80222a:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  80222c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802231:	5e                   	pop    %esi
+  802232:	5f                   	pop    %edi
+  802233:	5d                   	pop    %ebp
+  802234:	c3                   	ret
+
+00802235 <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  802235:	55                   	push   %ebp
+  802236:	89 e5                	mov    %esp,%ebp
+  802238:	53                   	push   %ebx
+  802239:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  80223c:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  80223f:	50                   	push   %eax
+  802240:	6a 00                	push   $0x0
+  802242:	e8 a2 ff ff ff       	call   8021e9 <fs_stats>
+  802247:	83 c4 10             	add    $0x10,%esp
+  80224a:	85 c0                	test   %eax,%eax
+  80224c:	78 28                	js     802276 <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  80224e:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  802251:	83 ec 08             	sub    $0x8,%esp
+  802254:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802257:	50                   	push   %eax
+  802258:	6a 20                	push   $0x20
+  80225a:	e8 8a ff ff ff       	call   8021e9 <fs_stats>
+  80225f:	83 c4 10             	add    $0x10,%esp
+  802262:	85 c0                	test   %eax,%eax
+  802264:	78 10                	js     802276 <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  802266:	83 ec 08             	sub    $0x8,%esp
+  802269:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  80226c:	50                   	push   %eax
+  80226d:	53                   	push   %ebx
+  80226e:	e8 76 ff ff ff       	call   8021e9 <fs_stats>
+  802273:	83 c4 10             	add    $0x10,%esp
+}
+  802276:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802279:	c9                   	leave
+  80227a:	c3                   	ret
+
+0080227b <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  80227b:	55                   	push   %ebp
+  80227c:	89 e5                	mov    %esp,%ebp
+  80227e:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  802281:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  802288:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  80228b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80228e:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.stats.req_dcache = 0;
+  802293:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  80229a:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  80229d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022a2:	b8 09 00 00 00       	mov    $0x9,%eax
+  8022a7:	e8 ac f7 ff ff       	call   801a58 <fsipc>
+}
+  8022ac:	c9                   	leave
+  8022ad:	c3                   	ret
+
+008022ae <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  8022ae:	55                   	push   %ebp
+  8022af:	89 e5                	mov    %esp,%ebp
+  8022b1:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  8022b4:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  8022bb:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  8022be:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  8022c5:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  8022c8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8022cb:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_STATS, NULL);
+  8022d0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022d5:	b8 09 00 00 00       	mov    $0x9,%eax
+  8022da:	e8 79 f7 ff ff       	call   801a58 <fsipc>
+}
+  8022df:	c9                   	leave
+  8022e0:	c3                   	ret
+
+008022e1 <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  8022e1:	55                   	push   %ebp
+  8022e2:	89 e5                	mov    %esp,%ebp
+  8022e4:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8022e7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022ea:	50                   	push   %eax
+  8022eb:	ff 75 08             	push   0x8(%ebp)
+  8022ee:	e8 21 f1 ff ff       	call   801414 <fd_lookup>
+  8022f3:	83 c4 10             	add    $0x10,%esp
+  8022f6:	85 c0                	test   %eax,%eax
+  8022f8:	78 34                	js     80232e <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  8022fa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022fd:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  802303:	39 08                	cmp    %ecx,(%eax)
+  802305:	75 29                	jne    802330 <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  802307:	8b 40 0c             	mov    0xc(%eax),%eax
+  80230a:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.fallocate.req_offset = offset;
+  80230f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802312:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.fallocate.req_len = len;
+  802317:	8b 45 10             	mov    0x10(%ebp),%eax
+  80231a:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  80231f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802324:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802329:	e8 2a f7 ff ff       	call   801a58 <fsipc>
+}
+  80232e:	c9                   	leave
+  80232f:	c3                   	ret
+    return -E_INVAL;
+  802330:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802335:	eb f7                	jmp    80232e <fallocate+0x4d>
+
+00802337 <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  802337:	55                   	push   %ebp
+  802338:	89 e5                	mov    %esp,%ebp
+  80233a:	57                   	push   %edi
+  80233b:	56                   	push   %esi
+  80233c:	53                   	push   %ebx
+  80233d:	83 ec 24             	sub    $0x24,%esp
+  802340:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802343:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802346:	50                   	push   %eax
+  802347:	ff 75 08             	push   0x8(%ebp)
+  80234a:	e8 c5 f0 ff ff       	call   801414 <fd_lookup>
+  80234f:	83 c4 10             	add    $0x10,%esp
+  802352:	85 c0                	test   %eax,%eax
+  802354:	78 66                	js     8023bc <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  802356:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802359:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  80235f:	39 08                	cmp    %ecx,(%eax)
+  802361:	75 61                	jne    8023c4 <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  802363:	85 f6                	test   %esi,%esi
+  802365:	7e 50                	jle    8023b7 <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  802367:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  80236c:	39 de                	cmp    %ebx,%esi
+  80236e:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  802371:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802374:	8b 40 0c             	mov    0xc(%eax),%eax
+  802377:	a3 00 60 80 00       	mov    %eax,0x806000
+    fsipcbuf.prefetch.req_n = m;
+  80237c:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  802382:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  802389:	83 ec 04             	sub    $0x4,%esp
+  80238c:	57                   	push   %edi
+  80238d:	ff 75 0c             	push   0xc(%ebp)
+  802390:	68 08 60 80 00       	push   $0x806008
+  802395:	e8 a8 e8 ff ff       	call   800c42 <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  80239a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80239f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8023a4:	e8 af f6 ff ff       	call   801a58 <fsipc>
+  8023a9:	83 c4 10             	add    $0x10,%esp
+  8023ac:	85 c0                	test   %eax,%eax
+  8023ae:	78 0c                	js     8023bc <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  8023b0:	01 7d 0c             	add    %edi,0xc(%ebp)
+  8023b3:	29 de                	sub    %ebx,%esi
+  8023b5:	eb ac                	jmp    802363 <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  8023b7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023bf:	5b                   	pop    %ebx
+  8023c0:	5e                   	pop    %esi
+  8023c1:	5f                   	pop    %edi
+  8023c2:	5d                   	pop    %ebp
+  8023c3:	c3                   	ret
+    return -E_INVAL;
+  8023c4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8023c9:	eb f1                	jmp    8023bc <prefetch+0x85>
+
+008023cb <spawn>:
+// argv: pointer to null-terminated array of pointers to strings,
+//   which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv)
+{
+  8023cb:	55                   	push   %ebp
+  8023cc:	89 e5                	mov    %esp,%ebp
+  8023ce:	57                   	push   %edi
+  8023cf:	56                   	push   %esi
+  8023d0:	53                   	push   %ebx
+  8023d1:	81 ec a8 02 00 00    	sub    $0x2a8,%esp
+  //     correct initial eip and esp values in the child.
+  //
+  //   - Start the child process running with sys_env_set_status().
+
+  // Open the program and read its ELF header in one round trip.
+  if ((r = open_read(prog, O_RDONLY, elf_buf, sizeof(elf_buf), &n)) < 0)
+  8023d7:	8d 85 a0 fd ff ff    	lea    -0x260(%ebp),%eax
+  8023dd:	50                   	push   %eax
+  8023de:	68 00 02 00 00       	push   $0x200
+  8023e3:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  8023e9:	50                   	push   %eax
+  8023ea:	6a 00                	push   $0x0
+  8023ec:	ff 75 08             	push   0x8(%ebp)
+  8023ef:	e8 84 fb ff ff       	call   801f78 <open_read>
+  8023f4:	89 85 88 fd ff ff    	mov    %eax,-0x278(%ebp)
+  8023fa:	83 c4 20             	add    $0x20,%esp
+  8023fd:	85 c0                	test   %eax,%eax
+  8023ff:	0f 88 66 06 00 00    	js     802a6b <spawn+0x6a0>
+    return r;
+  fd = r;
+
+  elf = (struct Elf*)elf_buf;
+  if (n != sizeof(elf_buf) || elf->e_magic != ELF_MAGIC) {
+  802405:	81 bd a0 fd ff ff 00 	cmpl   $0x200,-0x260(%ebp)
+  80240c:	02 00 00 
+  80240f:	0f 85 92 00 00 00    	jne    8024a7 <spawn+0xdc>
+  802415:	81 bd e8 fd ff ff 7f 	cmpl   $0x464c457f,-0x218(%ebp)
+  80241c:	45 4c 46 
+  80241f:	0f 85 82 00 00 00    	jne    8024a7 <spawn+0xdc>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+  envid_t ret;
+  __asm __volatile("int %2"
+  802425:	b8 07 00 00 00       	mov    $0x7,%eax
+  80242a:	cd 30                	int    $0x30
+  80242c:	89 85 90 fd ff ff    	mov    %eax,-0x270(%ebp)
+  802432:	89 c6                	mov    %eax,%esi
+  802434:	89 85 6c fd ff ff    	mov    %eax,-0x294(%ebp)
+    cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+    return -E_NOT_EXEC;
+  }
+
+  // Create new child environment
+  if ((r = sys_exofork()) < 0)
+  80243a:	85 c0                	test   %eax,%eax
+  80243c:	0f 88 35 06 00 00    	js     802a77 <spawn+0x6ac>
+    return r;
+  child = r;
+  sysbatch_init(&batch);
+  802442:	83 ec 0c             	sub    $0xc,%esp
+  802445:	68 e0 57 80 00       	push   $0x8057e0
+  80244a:	e8 91 ee ff ff       	call   8012e0 <sysbatch_init>
+
+  // Set up trap frame, including initial stack.
+  child_tf = envs[ENVX(child)].env_tf;
+  80244f:	89 f0                	mov    %esi,%eax
+  802451:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802456:	8d 34 c0             	lea    (%eax,%eax,8),%esi
+  802459:	c1 e6 04             	shl    $0x4,%esi
+  80245c:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  802462:	8d bd a4 fd ff ff    	lea    -0x25c(%ebp),%edi
+  802468:	b9 11 00 00 00       	mov    $0x11,%ecx
+  80246d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  child_tf.tf_eip = elf->e_entry;
+  80246f:	8b 85 00 fe ff ff    	mov    -0x200(%ebp),%eax
+  802475:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  uintptr_t *argv_store;
+
+  // Count the number of arguments (argc)
+  // and the total amount of space needed for strings (string_size).
+  string_size = 0;
+  for (argc = 0; argv[argc] != 0; argc++)
+  80247b:	83 c4 10             	add    $0x10,%esp
+  80247e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  string_size = 0;
+  802483:	be 00 00 00 00       	mov    $0x0,%esi
+  802488:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  for (argc = 0; argv[argc] != 0; argc++)
+  80248b:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+  80248e:	85 c0                	test   %eax,%eax
+  802490:	74 4d                	je     8024df <spawn+0x114>
+    string_size += strlen(argv[argc]) + 1;
+  802492:	83 ec 0c             	sub    $0xc,%esp
+  802495:	50                   	push   %eax
+  802496:	e8 e6 e5 ff ff       	call   800a81 <strlen>
+  80249b:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+  for (argc = 0; argv[argc] != 0; argc++)
+  80249f:	83 c3 01             	add    $0x1,%ebx
+  8024a2:	83 c4 10             	add    $0x10,%esp
+  8024a5:	eb e4                	jmp    80248b <spawn+0xc0>
+    close(fd);
+  8024a7:	83 ec 0c             	sub    $0xc,%esp
+  8024aa:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  8024b0:	e8 82 f0 ff ff       	call   801537 <close>
+    cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  8024b5:	83 c4 0c             	add    $0xc,%esp
+  8024b8:	68 7f 45 4c 46       	push   $0x464c457f
+  8024bd:	ff b5 e8 fd ff ff    	push   -0x218(%ebp)
+  8024c3:	68 a8 3e 80 00       	push   $0x803ea8
+  8024c8:	e8 01 e0 ff ff       	call   8004ce <cprintf>
+    return -E_NOT_EXEC;
+  8024cd:	83 c4 10             	add    $0x10,%esp
+  8024d0:	c7 85 6c fd ff ff f2 	movl   $0xfffffff2,-0x294(%ebp)
+  8024d7:	ff ff ff 
+  8024da:	e9 98 05 00 00       	jmp    802a77 <spawn+0x6ac>
+  // Determine where to place the strings and the argv array.
+  // Set up pointers into the temporary page 'UTEMP'; we'll map a page
+  // there later, then remap that page into the child environment
+  // at (USTACKTOP - PGSIZE).
+  // strings is the topmost thing on the stack.
+  string_store = (char*)UTEMP + PGSIZE - string_size;
+  8024df:	89 9d 84 fd ff ff    	mov    %ebx,-0x27c(%ebp)
+  8024e5:	bf 00 10 40 00       	mov    $0x401000,%edi
+  8024ea:	29 f7                	sub    %esi,%edi
+  // argv is below that.  There's one argument pointer per argument, plus
+  // a null pointer.
+  argv_store = (uintptr_t*)(ROUNDDOWN(string_store, 4) - 4 * (argc + 1));
+  8024ec:	89 fa                	mov    %edi,%edx
+  8024ee:	83 e2 fc             	and    $0xfffffffc,%edx
+  8024f1:	8d 04 9d 04 00 00 00 	lea    0x4(,%ebx,4),%eax
+  8024f8:	29 c2                	sub    %eax,%edx
+  8024fa:	89 95 94 fd ff ff    	mov    %edx,-0x26c(%ebp)
+
+  // Make sure that argv, strings, and the 2 words that hold 'argc'
+  // and 'argv' themselves will all fit in a single stack page.
+  if ((void*)(argv_store - 2) < (void*)UTEMP)
+  802500:	8d 42 f8             	lea    -0x8(%edx),%eax
+  802503:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  802508:	0f 86 a8 05 00 00    	jbe    802ab6 <spawn+0x6eb>
+    return -E_NO_MEM;
+
+  // Allocate the single stack page at UTEMP.
+  if ((r = sys_page_alloc(0, (void*)UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  80250e:	83 ec 04             	sub    $0x4,%esp
+  802511:	6a 07                	push   $0x7
+  802513:	68 00 00 40 00       	push   $0x400000
+  802518:	6a 00                	push   $0x0
+  80251a:	e8 cc e9 ff ff       	call   800eeb <sys_page_alloc>
+  80251f:	83 c4 10             	add    $0x10,%esp
+  802522:	85 c0                	test   %eax,%eax
+  802524:	0f 88 91 05 00 00    	js     802abb <spawn+0x6f0>
+  //	  (Again, argv should use an address valid in the child's
+  //	  environment.)
+  //
+  //	* Set *init_esp to the initial stack pointer for the child,
+  //	  (Again, use an address valid in the child's environment.)
+  for (i = 0; i < argc; i++) {
+  80252a:	be 00 00 00 00       	mov    $0x0,%esi
+  80252f:	89 9d 8c fd ff ff    	mov    %ebx,-0x274(%ebp)
+  802535:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802538:	eb 30                	jmp    80256a <spawn+0x19f>
+    argv_store[i] = UTEMP2USTACK(string_store);
+  80253a:	8d 87 00 d0 7f ee    	lea    -0x11803000(%edi),%eax
+  802540:	8b 8d 94 fd ff ff    	mov    -0x26c(%ebp),%ecx
+  802546:	89 04 b1             	mov    %eax,(%ecx,%esi,4)
+    strcpy(string_store, argv[i]);
+  802549:	83 ec 08             	sub    $0x8,%esp
+  80254c:	ff 34 b3             	push   (%ebx,%esi,4)
+  80254f:	57                   	push   %edi
+  802550:	e8 67 e5 ff ff       	call   800abc <strcpy>
+    string_store += strlen(argv[i]) + 1;
+  802555:	83 c4 04             	add    $0x4,%esp
+  802558:	ff 34 b3             	push   (%ebx,%esi,4)
+  80255b:	e8 21 e5 ff ff       	call   800a81 <strlen>
+  802560:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+  for (i = 0; i < argc; i++) {
+  802564:	83 c6 01             	add    $0x1,%esi
+  802567:	83 c4 10             	add    $0x10,%esp
+  80256a:	39 b5 8c fd ff ff    	cmp    %esi,-0x274(%ebp)
+  802570:	7f c8                	jg     80253a <spawn+0x16f>
+  }
+  argv_store[argc] = 0;
+  802572:	8b 85 94 fd ff ff    	mov    -0x26c(%ebp),%eax
+  802578:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  80257e:	c7 04 88 00 00 00 00 	movl   $0x0,(%eax,%ecx,4)
+  assert(string_store == (char*)UTEMP + PGSIZE);
+  802585:	81 ff 00 10 40 00    	cmp    $0x401000,%edi
+  80258b:	0f 85 97 00 00 00    	jne    802628 <spawn+0x25d>
+
+  argv_store[-1] = UTEMP2USTACK(argv_store);
+  802591:	8b 8d 94 fd ff ff    	mov    -0x26c(%ebp),%ecx
+  802597:	8d 81 00 d0 7f ee    	lea    -0x11803000(%ecx),%eax
+  80259d:	89 41 fc             	mov    %eax,-0x4(%ecx)
+  argv_store[-2] = argc;
+  8025a0:	89 c8                	mov    %ecx,%eax
+  8025a2:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  8025a8:	89 48 f8             	mov    %ecx,-0x8(%eax)
+
+  *init_esp = UTEMP2USTACK(&argv_store[-2]);
+  8025ab:	2d 08 30 80 11       	sub    $0x11803008,%eax
+  8025b0:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+
+  // After completing the stack, map it into the child's address space
+  // and unmap it from ours!  Both calls ride along with the first batch
+  // of segment mappings.
+  if ((r = sysbatch_add(&batch, SYS_page_map, 0, (uint32_t) UTEMP, child,
+  8025b6:	83 ec 04             	sub    $0x4,%esp
+  8025b9:	6a 07                	push   $0x7
+  8025bb:	68 00 d0 bf ee       	push   $0xeebfd000
+  8025c0:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  8025c6:	68 00 00 40 00       	push   $0x400000
+  8025cb:	6a 00                	push   $0x0
+  8025cd:	6a 05                	push   $0x5
+  8025cf:	68 e0 57 80 00       	push   $0x8057e0
+  8025d4:	e8 65 ed ff ff       	call   80133e <sysbatch_add>
+  8025d9:	89 c3                	mov    %eax,%ebx
+  8025db:	83 c4 20             	add    $0x20,%esp
+  8025de:	85 c0                	test   %eax,%eax
+  8025e0:	0f 88 dd 04 00 00    	js     802ac3 <spawn+0x6f8>
+                        USTACKTOP - PGSIZE, PTE_P | PTE_U | PTE_W)) < 0)
+    goto error;
+  if ((r = sysbatch_add(&batch, SYS_page_unmap, 0, (uint32_t) UTEMP,
+  8025e6:	83 ec 04             	sub    $0x4,%esp
+  8025e9:	6a 00                	push   $0x0
+  8025eb:	6a 00                	push   $0x0
+  8025ed:	6a 00                	push   $0x0
+  8025ef:	68 00 00 40 00       	push   $0x400000
+  8025f4:	6a 00                	push   $0x0
+  8025f6:	6a 06                	push   $0x6
+  8025f8:	68 e0 57 80 00       	push   $0x8057e0
+  8025fd:	e8 3c ed ff ff       	call   80133e <sysbatch_add>
+  802602:	89 c3                	mov    %eax,%ebx
+  802604:	83 c4 20             	add    $0x20,%esp
+  802607:	85 c0                	test   %eax,%eax
+  802609:	0f 88 b4 04 00 00    	js     802ac3 <spawn+0x6f8>
+  ph = (struct Proghdr*)(elf_buf + elf->e_phoff);
+  80260f:	8b 85 04 fe ff ff    	mov    -0x1fc(%ebp),%eax
+  802615:	8d bc 05 e8 fd ff ff 	lea    -0x218(%ebp,%eax,1),%edi
+  for (i = 0; i < elf->e_phnum; i++, ph++) {
+  80261c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802621:	89 d6                	mov    %edx,%esi
+  802623:	e9 dd 01 00 00       	jmp    802805 <spawn+0x43a>
+  assert(string_store == (char*)UTEMP + PGSIZE);
+  802628:	68 20 3f 80 00       	push   $0x803f20
+  80262d:	68 58 3e 80 00       	push   $0x803e58
+  802632:	68 01 01 00 00       	push   $0x101
+  802637:	68 c2 3e 80 00       	push   $0x803ec2
+  80263c:	e8 b2 dd ff ff       	call   8003f3 <_panic>
+
+  for (i = 0; i < memsz; i += n * PGSIZE) {
+    if (i >= filesz) {
+      // allocate a blank page
+      n = 1;
+      if ((r = sysbatch_add(&batch, SYS_page_alloc, child, va + i,
+  802641:	83 ec 04             	sub    $0x4,%esp
+  802644:	6a 00                	push   $0x0
+  802646:	6a 00                	push   $0x0
+  802648:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  80264e:	8b 85 78 fd ff ff    	mov    -0x288(%ebp),%eax
+  802654:	8b 8d 70 fd ff ff    	mov    -0x290(%ebp),%ecx
+  80265a:	01 c8                	add    %ecx,%eax
+  80265c:	50                   	push   %eax
+  80265d:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  802663:	6a 04                	push   $0x4
+  802665:	68 e0 57 80 00       	push   $0x8057e0
+  80266a:	e8 cf ec ff ff       	call   80133e <sysbatch_add>
+  80266f:	83 c4 20             	add    $0x20,%esp
+  802672:	85 c0                	test   %eax,%eax
+  802674:	0f 88 0b 04 00 00    	js     802a85 <spawn+0x6ba>
+      n = 1;
+  80267a:	bf 01 00 00 00       	mov    $0x1,%edi
+  for (i = 0; i < memsz; i += n * PGSIZE) {
+  80267f:	89 f8                	mov    %edi,%eax
+  802681:	c1 e0 0c             	shl    $0xc,%eax
+  802684:	01 85 84 fd ff ff    	add    %eax,-0x27c(%ebp)
+  80268a:	e9 fc 01 00 00       	jmp    80288b <spawn+0x4c0>
+  80268f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802694:	eb 0e                	jmp    8026a4 <spawn+0x2d9>
+  802696:	8b bd 60 fd ff ff    	mov    -0x2a0(%ebp),%edi
+  80269c:	e9 c1 00 00 00       	jmp    802762 <spawn+0x397>
+          return r;
+        if (r < MIN(PGSIZE, filesz - i - j * PGSIZE))
+          return -E_INVAL;
+      }
+    } else {
+      for (j = 0; j < n; j++)
+  8026a1:	83 c3 01             	add    $0x1,%ebx
+  8026a4:	39 df                	cmp    %ebx,%edi
+  8026a6:	7e 55                	jle    8026fd <spawn+0x332>
+        if ((r = sysbatch_add(&batch, SYS_page_alloc, 0,
+  8026a8:	83 ec 04             	sub    $0x4,%esp
+  8026ab:	6a 00                	push   $0x0
+  8026ad:	6a 00                	push   $0x0
+  8026af:	6a 07                	push   $0x7
+  8026b1:	89 d8                	mov    %ebx,%eax
+  8026b3:	c1 e0 0c             	shl    $0xc,%eax
+  8026b6:	05 00 10 40 00       	add    $0x401000,%eax
+  8026bb:	50                   	push   %eax
+  8026bc:	6a 00                	push   $0x0
+  8026be:	6a 04                	push   $0x4
+  8026c0:	68 e0 57 80 00       	push   $0x8057e0
+  8026c5:	e8 74 ec ff ff       	call   80133e <sysbatch_add>
+  8026ca:	83 c4 20             	add    $0x20,%esp
+  8026cd:	85 c0                	test   %eax,%eax
+  8026cf:	79 d0                	jns    8026a1 <spawn+0x2d6>
+  8026d1:	89 c6                	mov    %eax,%esi
+  sys_env_destroy(child);
+  8026d3:	83 ec 0c             	sub    $0xc,%esp
+  8026d6:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  8026dc:	e8 48 e7 ff ff       	call   800e29 <sys_env_destroy>
+  close(fd);
+  8026e1:	83 c4 04             	add    $0x4,%esp
+  8026e4:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  8026ea:	e8 48 ee ff ff       	call   801537 <close>
+  return r;
+  8026ef:	83 c4 10             	add    $0x10,%esp
+  8026f2:	89 b5 6c fd ff ff    	mov    %esi,-0x294(%ebp)
+  8026f8:	e9 7a 03 00 00       	jmp    802a77 <spawn+0x6ac>
+                              (uint32_t) UTEMP2 + j * PGSIZE,
+                              PTE_P|PTE_U|PTE_W, 0, 0)) < 0)
+          return r;
+      if ((r = sysbatch_flush(&batch)) < 0)
+  8026fd:	83 ec 0c             	sub    $0xc,%esp
+  802700:	68 e0 57 80 00       	push   $0x8057e0
+  802705:	e8 e4 eb ff ff       	call   8012ee <sysbatch_flush>
+  80270a:	83 c4 10             	add    $0x10,%esp
+  80270d:	85 c0                	test   %eax,%eax
+  80270f:	0f 88 85 03 00 00    	js     802a9a <spawn+0x6cf>
+        return r;
+      if ((r = seek(fd, fileoffset + i)) < 0)
+  802715:	83 ec 08             	sub    $0x8,%esp
+  802718:	8b 85 74 fd ff ff    	mov    -0x28c(%ebp),%eax
+  80271e:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  802724:	01 c8                	add    %ecx,%eax
+  802726:	50                   	push   %eax
+  802727:	8b 9d 88 fd ff ff    	mov    -0x278(%ebp),%ebx
+  80272d:	53                   	push   %ebx
+  80272e:	e8 dc f0 ff ff       	call   80180f <seek>
+  802733:	83 c4 10             	add    $0x10,%esp
+  802736:	85 c0                	test   %eax,%eax
+  802738:	0f 88 63 03 00 00    	js     802aa1 <spawn+0x6d6>
+        return r;
+      if ((r = readn(fd, UTEMP2, MIN(n * PGSIZE, filesz - i))) < 0)
+  80273e:	83 ec 04             	sub    $0x4,%esp
+  802741:	89 f8                	mov    %edi,%eax
+  802743:	c1 e0 0c             	shl    $0xc,%eax
+  802746:	39 f0                	cmp    %esi,%eax
+  802748:	0f 47 c6             	cmova  %esi,%eax
+  80274b:	50                   	push   %eax
+  80274c:	68 00 10 40 00       	push   $0x401000
+  802751:	53                   	push   %ebx
+  802752:	e8 ef ef ff ff       	call   801746 <readn>
+  802757:	83 c4 10             	add    $0x10,%esp
+  80275a:	85 c0                	test   %eax,%eax
+  80275c:	0f 88 46 03 00 00    	js     802aa8 <spawn+0x6dd>
+        return r;
+    }
+    for (j = 0; j < n; j++) {
+  802762:	8d b7 01 04 00 00    	lea    0x401(%edi),%esi
+  802768:	c1 e6 0c             	shl    $0xc,%esi
+  80276b:	bb 00 10 40 00       	mov    $0x401000,%ebx
+      if ((r = sysbatch_add(&batch, SYS_page_map, 0,
+  802770:	8b 85 70 fd ff ff    	mov    -0x290(%ebp),%eax
+  802776:	8b 8d 78 fd ff ff    	mov    -0x288(%ebp),%ecx
+  80277c:	8d 84 08 00 f0 bf ff 	lea    -0x401000(%eax,%ecx,1),%eax
+  802783:	89 bd 80 fd ff ff    	mov    %edi,-0x280(%ebp)
+  802789:	89 c7                	mov    %eax,%edi
+    for (j = 0; j < n; j++) {
+  80278b:	39 f3                	cmp    %esi,%ebx
+  80278d:	74 59                	je     8027e8 <spawn+0x41d>
+      if ((r = sysbatch_add(&batch, SYS_page_map, 0,
+  80278f:	83 ec 04             	sub    $0x4,%esp
+  802792:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  802798:	8d 04 1f             	lea    (%edi,%ebx,1),%eax
+  80279b:	50                   	push   %eax
+  80279c:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  8027a2:	53                   	push   %ebx
+  8027a3:	6a 00                	push   $0x0
+  8027a5:	6a 05                	push   $0x5
+  8027a7:	68 e0 57 80 00       	push   $0x8057e0
+  8027ac:	e8 8d eb ff ff       	call   80133e <sysbatch_add>
+  8027b1:	83 c4 20             	add    $0x20,%esp
+  8027b4:	85 c0                	test   %eax,%eax
+  8027b6:	0f 88 f3 02 00 00    	js     802aaf <spawn+0x6e4>
+                            (uint32_t) UTEMP2 + j * PGSIZE, child,
+                            va + i + j * PGSIZE, perm)) < 0)
+        return r;
+      if ((r = sysbatch_add(&batch, SYS_page_unmap, 0,
+  8027bc:	83 ec 04             	sub    $0x4,%esp
+  8027bf:	6a 00                	push   $0x0
+  8027c1:	6a 00                	push   $0x0
+  8027c3:	6a 00                	push   $0x0
+  8027c5:	53                   	push   %ebx
+  8027c6:	6a 00                	push   $0x0
+  8027c8:	6a 06                	push   $0x6
+  8027ca:	68 e0 57 80 00       	push   $0x8057e0
+  8027cf:	e8 6a eb ff ff       	call   80133e <sysbatch_add>
+  8027d4:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8027da:	83 c4 20             	add    $0x20,%esp
+  8027dd:	85 c0                	test   %eax,%eax
+  8027df:	79 aa                	jns    80278b <spawn+0x3c0>
+  8027e1:	89 c6                	mov    %eax,%esi
+  8027e3:	e9 eb fe ff ff       	jmp    8026d3 <spawn+0x308>
+  8027e8:	8b bd 80 fd ff ff    	mov    -0x280(%ebp),%edi
+  8027ee:	e9 8c fe ff ff       	jmp    80267f <spawn+0x2b4>
+  8027f3:	8b b5 68 fd ff ff    	mov    -0x298(%ebp),%esi
+  8027f9:	8b bd 64 fd ff ff    	mov    -0x29c(%ebp),%edi
+  for (i = 0; i < elf->e_phnum; i++, ph++) {
+  8027ff:	83 c6 01             	add    $0x1,%esi
+  802802:	83 c7 20             	add    $0x20,%edi
+  802805:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  80280c:	39 f0                	cmp    %esi,%eax
+  80280e:	0f 8e 9b 01 00 00    	jle    8029af <spawn+0x5e4>
+    if (ph->p_type != ELF_PROG_LOAD)
+  802814:	83 3f 01             	cmpl   $0x1,(%edi)
+  802817:	75 e6                	jne    8027ff <spawn+0x434>
+    if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  802819:	8b 47 18             	mov    0x18(%edi),%eax
+  80281c:	83 e0 02             	and    $0x2,%eax
+    perm = PTE_P | PTE_U;
+  80281f:	83 f8 01             	cmp    $0x1,%eax
+  802822:	19 c0                	sbb    %eax,%eax
+  802824:	83 e0 fe             	and    $0xfffffffe,%eax
+  802827:	83 c0 07             	add    $0x7,%eax
+  80282a:	89 85 94 fd ff ff    	mov    %eax,-0x26c(%ebp)
+    if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  802830:	8b 57 04             	mov    0x4(%edi),%edx
+  802833:	89 95 74 fd ff ff    	mov    %edx,-0x28c(%ebp)
+  802839:	8b 5f 10             	mov    0x10(%edi),%ebx
+  80283c:	89 9d 8c fd ff ff    	mov    %ebx,-0x274(%ebp)
+  802842:	8b 47 14             	mov    0x14(%edi),%eax
+  802845:	89 85 7c fd ff ff    	mov    %eax,-0x284(%ebp)
+  80284b:	8b 4f 08             	mov    0x8(%edi),%ecx
+  if ((i = PGOFF(va))) {
+  80284e:	89 c8                	mov    %ecx,%eax
+  802850:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802855:	74 18                	je     80286f <spawn+0x4a4>
+    va -= i;
+  802857:	29 c1                	sub    %eax,%ecx
+    memsz += i;
+  802859:	01 85 7c fd ff ff    	add    %eax,-0x284(%ebp)
+    filesz += i;
+  80285f:	01 c3                	add    %eax,%ebx
+  802861:	89 9d 8c fd ff ff    	mov    %ebx,-0x274(%ebp)
+    fileoffset -= i;
+  802867:	29 c2                	sub    %eax,%edx
+  802869:	89 95 74 fd ff ff    	mov    %edx,-0x28c(%ebp)
+  for (i = 0; i < memsz; i += n * PGSIZE) {
+  80286f:	c7 85 84 fd ff ff 00 	movl   $0x0,-0x27c(%ebp)
+  802876:	00 00 00 
+  802879:	89 8d 70 fd ff ff    	mov    %ecx,-0x290(%ebp)
+  80287f:	89 b5 68 fd ff ff    	mov    %esi,-0x298(%ebp)
+  802885:	89 bd 64 fd ff ff    	mov    %edi,-0x29c(%ebp)
+  80288b:	8b 85 84 fd ff ff    	mov    -0x27c(%ebp),%eax
+  802891:	89 85 78 fd ff ff    	mov    %eax,-0x288(%ebp)
+  802897:	8b 8d 7c fd ff ff    	mov    -0x284(%ebp),%ecx
+  80289d:	39 c8                	cmp    %ecx,%eax
+  80289f:	0f 83 4e ff ff ff    	jae    8027f3 <spawn+0x428>
+    if (i >= filesz) {
+  8028a5:	8b 8d 8c fd ff ff    	mov    -0x274(%ebp),%ecx
+  8028ab:	39 8d 84 fd ff ff    	cmp    %ecx,-0x27c(%ebp)
+  8028b1:	0f 83 8a fd ff ff    	jae    802641 <spawn+0x276>
+    n = MIN(SEGCHUNK, ROUNDUP(filesz - i, PGSIZE) / PGSIZE);
+  8028b7:	8b b5 8c fd ff ff    	mov    -0x274(%ebp),%esi
+  8028bd:	8b 85 78 fd ff ff    	mov    -0x288(%ebp),%eax
+  8028c3:	29 c6                	sub    %eax,%esi
+  8028c5:	8d 86 ff 0f 00 00    	lea    0xfff(%esi),%eax
+  8028cb:	c1 e8 0c             	shr    $0xc,%eax
+  8028ce:	ba 10 00 00 00       	mov    $0x10,%edx
+  8028d3:	39 d0                	cmp    %edx,%eax
+  8028d5:	0f 47 c2             	cmova  %edx,%eax
+  8028d8:	89 c7                	mov    %eax,%edi
+  if ((perm & PTE_W) || PGOFF(fileoffset))
+  8028da:	8b 9d 94 fd ff ff    	mov    -0x26c(%ebp),%ebx
+  8028e0:	83 e3 02             	and    $0x2,%ebx
+  8028e3:	8b 95 74 fd ff ff    	mov    -0x28c(%ebp),%edx
+  8028e9:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8028ef:	09 d3                	or     %edx,%ebx
+  8028f1:	0f 85 98 fd ff ff    	jne    80268f <spawn+0x2c4>
+    n = MIN(n, (filesz - i) / PGSIZE);
+  8028f7:	89 f2                	mov    %esi,%edx
+  8028f9:	c1 ea 0c             	shr    $0xc,%edx
+  8028fc:	39 c2                	cmp    %eax,%edx
+  8028fe:	0f 47 d0             	cmova  %eax,%edx
+  802901:	8b 8d 7c fd ff ff    	mov    -0x284(%ebp),%ecx
+  802907:	39 8d 8c fd ff ff    	cmp    %ecx,-0x274(%ebp)
+  80290d:	0f 43 d0             	cmovae %eax,%edx
+    if ((m = shared_pages(perm, memsz, filesz, fileoffset, i, n)) > 0) {
+  802910:	89 95 60 fd ff ff    	mov    %edx,-0x2a0(%ebp)
+  802916:	85 d2                	test   %edx,%edx
+  802918:	0f 8e 86 fd ff ff    	jle    8026a4 <spawn+0x2d9>
+      if ((r = sysbatch_flush(&batch)) < 0)
+  80291e:	83 ec 0c             	sub    $0xc,%esp
+  802921:	68 e0 57 80 00       	push   $0x8057e0
+  802926:	e8 c3 e9 ff ff       	call   8012ee <sysbatch_flush>
+  80292b:	83 c4 10             	add    $0x10,%esp
+  80292e:	85 c0                	test   %eax,%eax
+  802930:	0f 88 56 01 00 00    	js     802a8c <spawn+0x6c1>
+  802936:	8b 85 60 fd ff ff    	mov    -0x2a0(%ebp),%eax
+  80293c:	c1 e0 0c             	shl    $0xc,%eax
+  80293f:	89 f1                	mov    %esi,%ecx
+  802941:	29 c1                	sub    %eax,%ecx
+  802943:	89 8d 80 fd ff ff    	mov    %ecx,-0x280(%ebp)
+  802949:	89 f3                	mov    %esi,%ebx
+        if ((r = read_map(fd, fileoffset + i + j * PGSIZE,
+  80294b:	8d be 00 10 40 00    	lea    0x401000(%esi),%edi
+  802951:	8b 8d 74 fd ff ff    	mov    -0x28c(%ebp),%ecx
+  802957:	8b 85 8c fd ff ff    	mov    -0x274(%ebp),%eax
+  80295d:	8d 34 01             	lea    (%ecx,%eax,1),%esi
+      for (j = 0; j < n; j++) {
+  802960:	8b 85 80 fd ff ff    	mov    -0x280(%ebp),%eax
+  802966:	39 c3                	cmp    %eax,%ebx
+  802968:	0f 84 28 fd ff ff    	je     802696 <spawn+0x2cb>
+        if ((r = read_map(fd, fileoffset + i + j * PGSIZE,
+  80296e:	83 ec 04             	sub    $0x4,%esp
+  802971:	89 f8                	mov    %edi,%eax
+  802973:	29 d8                	sub    %ebx,%eax
+  802975:	50                   	push   %eax
+  802976:	89 f0                	mov    %esi,%eax
+  802978:	29 d8                	sub    %ebx,%eax
+  80297a:	50                   	push   %eax
+  80297b:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  802981:	e8 00 f8 ff ff       	call   802186 <read_map>
+  802986:	83 c4 10             	add    $0x10,%esp
+  802989:	85 c0                	test   %eax,%eax
+  80298b:	0f 88 02 01 00 00    	js     802a93 <spawn+0x6c8>
+        if (r < MIN(PGSIZE, filesz - i - j * PGSIZE))
+  802991:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802996:	39 d3                	cmp    %edx,%ebx
+  802998:	0f 46 d3             	cmovbe %ebx,%edx
+  80299b:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  8029a1:	39 d0                	cmp    %edx,%eax
+  8029a3:	73 bb                	jae    802960 <spawn+0x595>
+          return -E_INVAL;
+  8029a5:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+  8029aa:	e9 24 fd ff ff       	jmp    8026d3 <spawn+0x308>
+  close(fd);
+  8029af:	83 ec 0c             	sub    $0xc,%esp
+  8029b2:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  8029b8:	e8 7a eb ff ff       	call   801537 <close>
+// Copy the mappings for shared pages into the child address space.
+static int
+copy_shared_pages(envid_t child)
+{
+  // LAB 5: Your code here.
+  return sysbatch_add(&batch, SYS_page_map_range, 0, 0, UTOP,
+  8029bd:	83 c4 0c             	add    $0xc,%esp
+  8029c0:	6a 02                	push   $0x2
+  8029c2:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  8029c8:	68 00 00 c0 ee       	push   $0xeec00000
+  8029cd:	6a 00                	push   $0x0
+  8029cf:	6a 00                	push   $0x0
+  8029d1:	6a 11                	push   $0x11
+  8029d3:	68 e0 57 80 00       	push   $0x8057e0
+  8029d8:	e8 61 e9 ff ff       	call   80133e <sysbatch_add>
+  if ((r = copy_shared_pages(child)) < 0)
+  8029dd:	83 c4 20             	add    $0x20,%esp
+  8029e0:	85 c0                	test   %eax,%eax
+  8029e2:	78 72                	js     802a56 <spawn+0x68b>
+  if ((r = sysbatch_add(&batch, SYS_env_set_trapframe, child,
+  8029e4:	83 ec 04             	sub    $0x4,%esp
+  8029e7:	6a 00                	push   $0x0
+  8029e9:	6a 00                	push   $0x0
+  8029eb:	6a 00                	push   $0x0
+  8029ed:	8d 85 a4 fd ff ff    	lea    -0x25c(%ebp),%eax
+  8029f3:	50                   	push   %eax
+  8029f4:	8b bd 90 fd ff ff    	mov    -0x270(%ebp),%edi
+  8029fa:	57                   	push   %edi
+  8029fb:	6a 09                	push   $0x9
+  8029fd:	68 e0 57 80 00       	push   $0x8057e0
+  802a02:	e8 37 e9 ff ff       	call   80133e <sysbatch_add>
+  802a07:	83 c4 20             	add    $0x20,%esp
+  802a0a:	85 c0                	test   %eax,%eax
+  802a0c:	78 33                	js     802a41 <spawn+0x676>
+      (r = sysbatch_add(&batch, SYS_env_set_status, child,
+  802a0e:	83 ec 04             	sub    $0x4,%esp
+  802a11:	6a 00                	push   $0x0
+  802a13:	6a 00                	push   $0x0
+  802a15:	6a 00                	push   $0x0
+  802a17:	6a 02                	push   $0x2
+  802a19:	57                   	push   %edi
+  802a1a:	6a 08                	push   $0x8
+  802a1c:	68 e0 57 80 00       	push   $0x8057e0
+  802a21:	e8 18 e9 ff ff       	call   80133e <sysbatch_add>
+                        (uint32_t) &child_tf, 0, 0, 0)) < 0 ||
+  802a26:	83 c4 20             	add    $0x20,%esp
+  802a29:	85 c0                	test   %eax,%eax
+  802a2b:	78 14                	js     802a41 <spawn+0x676>
+      (r = sysbatch_flush(&batch)) < 0)
+  802a2d:	83 ec 0c             	sub    $0xc,%esp
+  802a30:	68 e0 57 80 00       	push   $0x8057e0
+  802a35:	e8 b4 e8 ff ff       	call   8012ee <sysbatch_flush>
+                        ENV_RUNNABLE, 0, 0, 0)) < 0 ||
+  802a3a:	83 c4 10             	add    $0x10,%esp
+  802a3d:	85 c0                	test   %eax,%eax
+  802a3f:	79 36                	jns    802a77 <spawn+0x6ac>
+    panic("spawn: starting child: %e", r);
+  802a41:	50                   	push   %eax
+  802a42:	68 e4 3e 80 00       	push   $0x803ee4
+  802a47:	68 93 00 00 00       	push   $0x93
+  802a4c:	68 c2 3e 80 00       	push   $0x803ec2
+  802a51:	e8 9d d9 ff ff       	call   8003f3 <_panic>
+    panic("copy_shared_pages: %e", r);
+  802a56:	50                   	push   %eax
+  802a57:	68 ce 3e 80 00       	push   $0x803ece
+  802a5c:	68 8c 00 00 00       	push   $0x8c
+  802a61:	68 c2 3e 80 00       	push   $0x803ec2
+  802a66:	e8 88 d9 ff ff       	call   8003f3 <_panic>
+    return r;
+  802a6b:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  802a71:	89 85 6c fd ff ff    	mov    %eax,-0x294(%ebp)
+}
+  802a77:	8b 85 6c fd ff ff    	mov    -0x294(%ebp),%eax
+  802a7d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a80:	5b                   	pop    %ebx
+  802a81:	5e                   	pop    %esi
+  802a82:	5f                   	pop    %edi
+  802a83:	5d                   	pop    %ebp
+  802a84:	c3                   	ret
+  802a85:	89 c6                	mov    %eax,%esi
+  802a87:	e9 47 fc ff ff       	jmp    8026d3 <spawn+0x308>
+  802a8c:	89 c6                	mov    %eax,%esi
+  802a8e:	e9 40 fc ff ff       	jmp    8026d3 <spawn+0x308>
+  802a93:	89 c6                	mov    %eax,%esi
+  802a95:	e9 39 fc ff ff       	jmp    8026d3 <spawn+0x308>
+  802a9a:	89 c6                	mov    %eax,%esi
+  802a9c:	e9 32 fc ff ff       	jmp    8026d3 <spawn+0x308>
+  802aa1:	89 c6                	mov    %eax,%esi
+  802aa3:	e9 2b fc ff ff       	jmp    8026d3 <spawn+0x308>
+  802aa8:	89 c6                	mov    %eax,%esi
+  802aaa:	e9 24 fc ff ff       	jmp    8026d3 <spawn+0x308>
+  802aaf:	89 c6                	mov    %eax,%esi
+  802ab1:	e9 1d fc ff ff       	jmp    8026d3 <spawn+0x308>
+    return -E_NO_MEM;
+  802ab6:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  return r;
+  802abb:	89 85 6c fd ff ff    	mov    %eax,-0x294(%ebp)
+  802ac1:	eb b4                	jmp    802a77 <spawn+0x6ac>
+  sys_page_unmap(0, UTEMP);
+  802ac3:	83 ec 08             	sub    $0x8,%esp
+  802ac6:	68 00 00 40 00       	push   $0x400000
+  802acb:	6a 00                	push   $0x0
+  802acd:	e8 9e e4 ff ff       	call   800f70 <sys_page_unmap>
+  802ad2:	83 c4 10             	add    $0x10,%esp
+  802ad5:	89 9d 6c fd ff ff    	mov    %ebx,-0x294(%ebp)
+  802adb:	eb 9a                	jmp    802a77 <spawn+0x6ac>
+
+00802add <spawnl>:
+{
+  802add:	55                   	push   %ebp
+  802ade:	89 e5                	mov    %esp,%ebp
+  802ae0:	56                   	push   %esi
+  802ae1:	53                   	push   %ebx
+  va_start(vl, arg0);
+  802ae2:	8d 45 10             	lea    0x10(%ebp),%eax
+  int argc = 0;
+  802ae5:	be 00 00 00 00       	mov    $0x0,%esi
+  while (va_arg(vl, void *) != NULL) {
+  802aea:	eb 17                	jmp    802b03 <spawnl+0x26>
+      cprintf("vl: %p saying %s\n", vl, vl);
+  802aec:	83 ec 04             	sub    $0x4,%esp
+  802aef:	53                   	push   %ebx
+  802af0:	53                   	push   %ebx
+  802af1:	68 fe 3e 80 00       	push   $0x803efe
+  802af6:	e8 d3 d9 ff ff       	call   8004ce <cprintf>
+    argc++;
+  802afb:	83 c6 01             	add    $0x1,%esi
+  802afe:	83 c4 10             	add    $0x10,%esp
+  while (va_arg(vl, void *) != NULL) {
+  802b01:	89 d8                	mov    %ebx,%eax
+  802b03:	8d 58 04             	lea    0x4(%eax),%ebx
+  802b06:	83 38 00             	cmpl   $0x0,(%eax)
+  802b09:	75 e1                	jne    802aec <spawnl+0xf>
+  cprintf("argc found %d\n", argc);
+  802b0b:	83 ec 08             	sub    $0x8,%esp
+  802b0e:	56                   	push   %esi
+  802b0f:	68 10 3f 80 00       	push   $0x803f10
+  802b14:	e8 b5 d9 ff ff       	call   8004ce <cprintf>
+  const char *argv[argc+2];
+  802b19:	8d 04 b5 17 00 00 00 	lea    0x17(,%esi,4),%eax
+  802b20:	83 e0 f0             	and    $0xfffffff0,%eax
+  802b23:	83 c4 10             	add    $0x10,%esp
+  802b26:	29 c4                	sub    %eax,%esp
+  802b28:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  802b2c:	89 d8                	mov    %ebx,%eax
+  802b2e:	c1 e8 02             	shr    $0x2,%eax
+  802b31:	83 e3 fc             	and    $0xfffffffc,%ebx
+  argv[0] = arg0;
+  802b34:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802b37:	89 14 85 00 00 00 00 	mov    %edx,0x0(,%eax,4)
+  argv[argc+1] = NULL;
+  802b3e:	c7 44 b3 04 00 00 00 	movl   $0x0,0x4(%ebx,%esi,4)
+  802b45:	00 
+  va_start(vl, arg0);
+  802b46:	8d 55 10             	lea    0x10(%ebp),%edx
+  for (i = 0; i < argc; i++)
+  802b49:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b4e:	eb 0b                	jmp    802b5b <spawnl+0x7e>
+    argv[i+1] = va_arg(vl, const char *);
+  802b50:	83 c0 01             	add    $0x1,%eax
+  802b53:	8b 0a                	mov    (%edx),%ecx
+  802b55:	89 0c 83             	mov    %ecx,(%ebx,%eax,4)
+  802b58:	8d 52 04             	lea    0x4(%edx),%edx
+  for (i = 0; i < argc; i++)
+  802b5b:	39 f0                	cmp    %esi,%eax
+  802b5d:	75 f1                	jne    802b50 <spawnl+0x73>
+  return spawn(prog, argv);
+  802b5f:	83 ec 08             	sub    $0x8,%esp
+  802b62:	53                   	push   %ebx
+  802b63:	ff 75 08             	push   0x8(%ebp)
+  802b66:	e8 60 f8 ff ff       	call   8023cb <spawn>
+}
+  802b6b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802b6e:	5b                   	pop    %ebx
+  802b6f:	5e                   	pop    %esi
+  802b70:	5d                   	pop    %ebp
+  802b71:	c3                   	ret
+
+00802b72 <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  802b72:	55                   	push   %ebp
+  802b73:	89 e5                	mov    %esp,%ebp
+  802b75:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  802b78:	50                   	push   %eax
+  802b79:	e8 2c e8 ff ff       	call   8013aa <fd2data>
+  802b7e:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  802b83:	c9                   	leave
+  802b84:	c3                   	ret
+
+00802b85 <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802b85:	55                   	push   %ebp
+  802b86:	89 e5                	mov    %esp,%ebp
+  802b88:	56                   	push   %esi
+  802b89:	53                   	push   %ebx
+  802b8a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  802b8d:	83 ec 0c             	sub    $0xc,%esp
+  802b90:	ff 75 08             	push   0x8(%ebp)
+  802b93:	e8 12 e8 ff ff       	call   8013aa <fd2data>
+  802b98:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  802b9a:	83 c4 08             	add    $0x8,%esp
+  802b9d:	68 46 3f 80 00       	push   $0x803f46
+  802ba2:	53                   	push   %ebx
+  802ba3:	e8 14 df ff ff       	call   800abc <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  802ba8:	8b 46 04             	mov    0x4(%esi),%eax
+  802bab:	2b 06                	sub    (%esi),%eax
+  802bad:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  802bb3:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802bba:	00 00 00 
+  stat->st_dev = &devpipe;
+  802bbd:	c7 83 88 00 00 00 20 	movl   $0x804020,0x88(%ebx)
+  802bc4:	40 80 00 
+  return 0;
+}
+  802bc7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bcc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802bcf:	5b                   	pop    %ebx
+  802bd0:	5e                   	pop    %esi
+  802bd1:	5d                   	pop    %ebp
+  802bd2:	c3                   	ret
+
+00802bd3 <pipe_wakeup>:
+{
+  802bd3:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  802bd5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bda:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  802bdd:	85 c0                	test   %eax,%eax
+  802bdf:	75 01                	jne    802be2 <pipe_wakeup+0xf>
+  802be1:	c3                   	ret
+{
+  802be2:	55                   	push   %ebp
+  802be3:	89 e5                	mov    %esp,%ebp
+  802be5:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  802be8:	6a 00                	push   $0x0
+  802bea:	68 00 00 c0 ee       	push   $0xeec00000
+  802bef:	52                   	push   %edx
+  802bf0:	e8 52 e6 ff ff       	call   801247 <sys_chan_wakeup>
+  802bf5:	83 c4 10             	add    $0x10,%esp
+}
+  802bf8:	c9                   	leave
+  802bf9:	c3                   	ret
+
+00802bfa <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802bfa:	55                   	push   %ebp
+  802bfb:	89 e5                	mov    %esp,%ebp
+  802bfd:	57                   	push   %edi
+  802bfe:	56                   	push   %esi
+  802bff:	53                   	push   %ebx
+  802c00:	83 ec 18             	sub    $0x18,%esp
+  802c03:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  802c06:	57                   	push   %edi
+  802c07:	e8 9e e7 ff ff       	call   8013aa <fd2data>
+  802c0c:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  802c0e:	83 c4 10             	add    $0x10,%esp
+  802c11:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  802c15:	74 2a                	je     802c41 <devpipe_close+0x47>
+  802c17:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  802c1c:	89 f8                	mov    %edi,%eax
+  802c1e:	e8 4f ff ff ff       	call   802b72 <pipe_ring>
+  802c23:	83 ec 08             	sub    $0x8,%esp
+  802c26:	01 d8                	add    %ebx,%eax
+  802c28:	50                   	push   %eax
+  802c29:	6a 00                	push   $0x0
+  802c2b:	e8 40 e3 ff ff       	call   800f70 <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  802c30:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802c36:	83 c4 10             	add    $0x10,%esp
+  802c39:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  802c3f:	75 db                	jne    802c1c <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  802c41:	83 ec 08             	sub    $0x8,%esp
+  802c44:	57                   	push   %edi
+  802c45:	6a 00                	push   $0x0
+  802c47:	e8 24 e3 ff ff       	call   800f70 <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  802c4c:	83 c4 10             	add    $0x10,%esp
+  802c4f:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  802c53:	75 13                	jne    802c68 <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  802c55:	83 ec 08             	sub    $0x8,%esp
+  802c58:	56                   	push   %esi
+  802c59:	6a 00                	push   $0x0
+  802c5b:	e8 10 e3 ff ff       	call   800f70 <sys_page_unmap>
+}
+  802c60:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c63:	5b                   	pop    %ebx
+  802c64:	5e                   	pop    %esi
+  802c65:	5f                   	pop    %edi
+  802c66:	5d                   	pop    %ebp
+  802c67:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802c68:	8d 56 04             	lea    0x4(%esi),%edx
+  802c6b:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802c6e:	e8 60 ff ff ff       	call   802bd3 <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802c73:	8d 46 30             	lea    0x30(%esi),%eax
+  802c76:	89 f2                	mov    %esi,%edx
+  802c78:	e8 56 ff ff ff       	call   802bd3 <pipe_wakeup>
+  802c7d:	eb d6                	jmp    802c55 <devpipe_close+0x5b>
+
+00802c7f <_pipeisclosed>:
+{
+  802c7f:	55                   	push   %ebp
+  802c80:	89 e5                	mov    %esp,%ebp
+  802c82:	57                   	push   %edi
+  802c83:	56                   	push   %esi
+  802c84:	53                   	push   %ebx
+  802c85:	83 ec 1c             	sub    $0x1c,%esp
+  802c88:	89 c7                	mov    %eax,%edi
+  802c8a:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  802c8c:	a1 e4 5e 80 00       	mov    0x805ee4,%eax
+  802c91:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  802c94:	83 ec 0c             	sub    $0xc,%esp
+  802c97:	57                   	push   %edi
+  802c98:	e8 69 0a 00 00       	call   803706 <pageref>
+  802c9d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802ca0:	89 34 24             	mov    %esi,(%esp)
+  802ca3:	e8 5e 0a 00 00       	call   803706 <pageref>
+    nn = thisenv->env_runs;
+  802ca8:	8b 15 e4 5e 80 00    	mov    0x805ee4,%edx
+  802cae:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  802cb1:	83 c4 10             	add    $0x10,%esp
+  802cb4:	39 cb                	cmp    %ecx,%ebx
+  802cb6:	74 1b                	je     802cd3 <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  802cb8:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802cbb:	75 cf                	jne    802c8c <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802cbd:	8b 42 58             	mov    0x58(%edx),%eax
+  802cc0:	6a 01                	push   $0x1
+  802cc2:	50                   	push   %eax
+  802cc3:	53                   	push   %ebx
+  802cc4:	68 4d 3f 80 00       	push   $0x803f4d
+  802cc9:	e8 00 d8 ff ff       	call   8004ce <cprintf>
+  802cce:	83 c4 10             	add    $0x10,%esp
+  802cd1:	eb b9                	jmp    802c8c <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  802cd3:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802cd6:	0f 94 c0             	sete   %al
+  802cd9:	0f b6 c0             	movzbl %al,%eax
+}
+  802cdc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802cdf:	5b                   	pop    %ebx
+  802ce0:	5e                   	pop    %esi
+  802ce1:	5f                   	pop    %edi
+  802ce2:	5d                   	pop    %ebp
+  802ce3:	c3                   	ret
+
+00802ce4 <devpipe_write_bulk>:
+{
+  802ce4:	55                   	push   %ebp
+  802ce5:	89 e5                	mov    %esp,%ebp
+  802ce7:	57                   	push   %edi
+  802ce8:	56                   	push   %esi
+  802ce9:	53                   	push   %ebx
+  802cea:	83 ec 1c             	sub    $0x1c,%esp
+  802ced:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802cf0:	89 d6                	mov    %edx,%esi
+  802cf2:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  802cf5:	e8 78 fe ff ff       	call   802b72 <pipe_ring>
+  802cfa:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  802cfd:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802d02:	8d 46 04             	lea    0x4(%esi),%eax
+  802d05:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  802d08:	eb 75                	jmp    802d7f <devpipe_write_bulk+0x9b>
+  802d0a:	b8 01 00 00 00       	mov    $0x1,%eax
+  802d0f:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802d13:	6a 64                	push   $0x64
+  802d15:	68 00 00 c0 ee       	push   $0xeec00000
+  802d1a:	53                   	push   %ebx
+  802d1b:	56                   	push   %esi
+  802d1c:	e8 03 e5 ff ff       	call   801224 <sys_chan_sleep>
+      continue;
+  802d21:	83 c4 10             	add    $0x10,%esp
+  802d24:	eb 59                	jmp    802d7f <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  802d26:	89 d1                	mov    %edx,%ecx
+  802d28:	c1 f9 1f             	sar    $0x1f,%ecx
+  802d2b:	c1 e9 11             	shr    $0x11,%ecx
+  802d2e:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802d31:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802d36:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  802d38:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  802d3e:	29 d3                	sub    %edx,%ebx
+  802d40:	ba 00 80 00 00       	mov    $0x8000,%edx
+  802d45:	29 c2                	sub    %eax,%edx
+  802d47:	39 d3                	cmp    %edx,%ebx
+  802d49:	0f 47 da             	cmova  %edx,%ebx
+  802d4c:	8b 55 08             	mov    0x8(%ebp),%edx
+  802d4f:	29 fa                	sub    %edi,%edx
+  802d51:	39 d3                	cmp    %edx,%ebx
+  802d53:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  802d56:	83 ec 04             	sub    $0x4,%esp
+  802d59:	53                   	push   %ebx
+  802d5a:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802d5d:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  802d60:	52                   	push   %edx
+  802d61:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802d64:	01 c8                	add    %ecx,%eax
+  802d66:	50                   	push   %eax
+  802d67:	e8 38 df ff ff       	call   800ca4 <memcpy>
+    i += m;
+  802d6c:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  802d6e:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802d71:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802d74:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802d77:	e8 57 fe ff ff       	call   802bd3 <pipe_wakeup>
+  802d7c:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802d7f:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802d82:	73 2b                	jae    802daf <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  802d84:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  802d86:	8b 56 04             	mov    0x4(%esi),%edx
+  802d89:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  802d8f:	39 d0                	cmp    %edx,%eax
+  802d91:	7d 93                	jge    802d26 <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  802d93:	89 f2                	mov    %esi,%edx
+  802d95:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802d98:	e8 e2 fe ff ff       	call   802c7f <_pipeisclosed>
+  802d9d:	85 c0                	test   %eax,%eax
+  802d9f:	0f 84 65 ff ff ff    	je     802d0a <devpipe_write_bulk+0x26>
+        return i;
+  802da5:	89 f8                	mov    %edi,%eax
+}
+  802da7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802daa:	5b                   	pop    %ebx
+  802dab:	5e                   	pop    %esi
+  802dac:	5f                   	pop    %edi
+  802dad:	5d                   	pop    %ebp
+  802dae:	c3                   	ret
+  return i;
+  802daf:	89 f8                	mov    %edi,%eax
+  802db1:	eb f4                	jmp    802da7 <devpipe_write_bulk+0xc3>
+
+00802db3 <devpipe_write>:
+{
+  802db3:	55                   	push   %ebp
+  802db4:	89 e5                	mov    %esp,%ebp
+  802db6:	57                   	push   %edi
+  802db7:	56                   	push   %esi
+  802db8:	53                   	push   %ebx
+  802db9:	83 ec 28             	sub    $0x28,%esp
+  802dbc:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  802dbf:	56                   	push   %esi
+  802dc0:	e8 e5 e5 ff ff       	call   8013aa <fd2data>
+  802dc5:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  802dc7:	8b 78 28             	mov    0x28(%eax),%edi
+  802dca:	83 c4 10             	add    $0x10,%esp
+  802dcd:	85 ff                	test   %edi,%edi
+  802dcf:	75 25                	jne    802df6 <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  802dd1:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802dd4:	74 66                	je     802e3c <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802dd6:	8b 43 04             	mov    0x4(%ebx),%eax
+  802dd9:	8b 0b                	mov    (%ebx),%ecx
+  802ddb:	8d 51 20             	lea    0x20(%ecx),%edx
+  802dde:	39 d0                	cmp    %edx,%eax
+  802de0:	72 2b                	jb     802e0d <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  802de2:	89 da                	mov    %ebx,%edx
+  802de4:	89 f0                	mov    %esi,%eax
+  802de6:	e8 94 fe ff ff       	call   802c7f <_pipeisclosed>
+  802deb:	85 c0                	test   %eax,%eax
+  802ded:	75 51                	jne    802e40 <devpipe_write+0x8d>
+      sys_yield();
+  802def:	e8 95 e0 ff ff       	call   800e89 <sys_yield>
+  802df4:	eb e0                	jmp    802dd6 <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  802df6:	83 ec 0c             	sub    $0xc,%esp
+  802df9:	ff 75 10             	push   0x10(%ebp)
+  802dfc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802dff:	89 c2                	mov    %eax,%edx
+  802e01:	89 f0                	mov    %esi,%eax
+  802e03:	e8 dc fe ff ff       	call   802ce4 <devpipe_write_bulk>
+  802e08:	83 c4 10             	add    $0x10,%esp
+  802e0b:	eb 38                	jmp    802e45 <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802e0d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802e10:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802e14:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802e17:	89 c2                	mov    %eax,%edx
+  802e19:	c1 fa 1f             	sar    $0x1f,%edx
+  802e1c:	89 d1                	mov    %edx,%ecx
+  802e1e:	c1 e9 1b             	shr    $0x1b,%ecx
+  802e21:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802e24:	83 e2 1f             	and    $0x1f,%edx
+  802e27:	29 ca                	sub    %ecx,%edx
+  802e29:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802e2d:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  802e31:	83 c0 01             	add    $0x1,%eax
+  802e34:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  802e37:	83 c7 01             	add    $0x1,%edi
+  802e3a:	eb 95                	jmp    802dd1 <devpipe_write+0x1e>
+  return i;
+  802e3c:	89 f8                	mov    %edi,%eax
+  802e3e:	eb 05                	jmp    802e45 <devpipe_write+0x92>
+        return 0;
+  802e40:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e45:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e48:	5b                   	pop    %ebx
+  802e49:	5e                   	pop    %esi
+  802e4a:	5f                   	pop    %edi
+  802e4b:	5d                   	pop    %ebp
+  802e4c:	c3                   	ret
+
+00802e4d <devpipe_read_bulk>:
+{
+  802e4d:	55                   	push   %ebp
+  802e4e:	89 e5                	mov    %esp,%ebp
+  802e50:	57                   	push   %edi
+  802e51:	56                   	push   %esi
+  802e52:	53                   	push   %ebx
+  802e53:	83 ec 2c             	sub    $0x2c,%esp
+  802e56:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802e59:	89 d6                	mov    %edx,%esi
+  802e5b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802e5e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  802e61:	e8 0c fd ff ff       	call   802b72 <pipe_ring>
+  802e66:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  802e69:	85 db                	test   %ebx,%ebx
+  802e6b:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802e70:	0f 45 c3             	cmovne %ebx,%eax
+  802e73:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802e76:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802e7b:	8d 46 30             	lea    0x30(%esi),%eax
+  802e7e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  802e81:	eb 50                	jmp    802ed3 <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  802e83:	89 d1                	mov    %edx,%ecx
+  802e85:	c1 f9 1f             	sar    $0x1f,%ecx
+  802e88:	c1 e9 11             	shr    $0x11,%ecx
+  802e8b:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802e8e:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802e93:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  802e95:	29 d3                	sub    %edx,%ebx
+  802e97:	ba 00 80 00 00       	mov    $0x8000,%edx
+  802e9c:	29 c2                	sub    %eax,%edx
+  802e9e:	39 d3                	cmp    %edx,%ebx
+  802ea0:	0f 47 da             	cmova  %edx,%ebx
+  802ea3:	8b 55 08             	mov    0x8(%ebp),%edx
+  802ea6:	29 fa                	sub    %edi,%edx
+  802ea8:	39 d3                	cmp    %edx,%ebx
+  802eaa:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  802ead:	83 ec 04             	sub    $0x4,%esp
+  802eb0:	53                   	push   %ebx
+  802eb1:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802eb4:	01 c8                	add    %ecx,%eax
+  802eb6:	50                   	push   %eax
+  802eb7:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802eba:	01 f8                	add    %edi,%eax
+  802ebc:	50                   	push   %eax
+  802ebd:	e8 e2 dd ff ff       	call   800ca4 <memcpy>
+    i += m;
+  802ec2:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  802ec4:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802ec6:	89 f2                	mov    %esi,%edx
+  802ec8:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802ecb:	e8 03 fd ff ff       	call   802bd3 <pipe_wakeup>
+  802ed0:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802ed3:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802ed6:	73 51                	jae    802f29 <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  802ed8:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  802edb:	8b 16                	mov    (%esi),%edx
+  802edd:	39 da                	cmp    %ebx,%edx
+  802edf:	75 a2                	jne    802e83 <devpipe_read_bulk+0x36>
+      if (i > 0)
+  802ee1:	85 ff                	test   %edi,%edi
+  802ee3:	75 44                	jne    802f29 <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  802ee5:	89 f2                	mov    %esi,%edx
+  802ee7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802eea:	e8 90 fd ff ff       	call   802c7f <_pipeisclosed>
+  802eef:	85 c0                	test   %eax,%eax
+  802ef1:	75 3a                	jne    802f2d <devpipe_read_bulk+0xe0>
+  802ef3:	b8 01 00 00 00       	mov    $0x1,%eax
+  802ef8:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802efc:	6a 64                	push   $0x64
+  802efe:	ff 75 d4             	push   -0x2c(%ebp)
+  802f01:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  802f02:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802f05:	50                   	push   %eax
+  802f06:	e8 19 e3 ff ff       	call   801224 <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  802f0b:	85 c0                	test   %eax,%eax
+  802f0d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f12:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  802f15:	83 c4 10             	add    $0x10,%esp
+  802f18:	a8 01                	test   $0x1,%al
+  802f1a:	74 b7                	je     802ed3 <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  802f1c:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  802f21:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f24:	5b                   	pop    %ebx
+  802f25:	5e                   	pop    %esi
+  802f26:	5f                   	pop    %edi
+  802f27:	5d                   	pop    %ebp
+  802f28:	c3                   	ret
+  return i;
+  802f29:	89 f8                	mov    %edi,%eax
+  802f2b:	eb f4                	jmp    802f21 <devpipe_read_bulk+0xd4>
+        return 0;
+  802f2d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f32:	eb ed                	jmp    802f21 <devpipe_read_bulk+0xd4>
+
+00802f34 <devpipe_read>:
+{
+  802f34:	55                   	push   %ebp
+  802f35:	89 e5                	mov    %esp,%ebp
+  802f37:	57                   	push   %edi
+  802f38:	56                   	push   %esi
+  802f39:	53                   	push   %ebx
+  802f3a:	83 ec 18             	sub    $0x18,%esp
+  802f3d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  802f40:	57                   	push   %edi
+  802f41:	e8 64 e4 ff ff       	call   8013aa <fd2data>
+  802f46:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  802f48:	8b 70 28             	mov    0x28(%eax),%esi
+  802f4b:	83 c4 10             	add    $0x10,%esp
+  802f4e:	85 f6                	test   %esi,%esi
+  802f50:	75 24                	jne    802f76 <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  802f52:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802f55:	74 60                	je     802fb7 <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  802f57:	8b 03                	mov    (%ebx),%eax
+  802f59:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802f5c:	75 3b                	jne    802f99 <devpipe_read+0x65>
+      if (i > 0)
+  802f5e:	85 f6                	test   %esi,%esi
+  802f60:	75 2d                	jne    802f8f <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  802f62:	89 da                	mov    %ebx,%edx
+  802f64:	89 f8                	mov    %edi,%eax
+  802f66:	e8 14 fd ff ff       	call   802c7f <_pipeisclosed>
+  802f6b:	85 c0                	test   %eax,%eax
+  802f6d:	75 4c                	jne    802fbb <devpipe_read+0x87>
+      sys_yield();
+  802f6f:	e8 15 df ff ff       	call   800e89 <sys_yield>
+  802f74:	eb e1                	jmp    802f57 <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  802f76:	83 ec 08             	sub    $0x8,%esp
+  802f79:	6a 00                	push   $0x0
+  802f7b:	ff 75 10             	push   0x10(%ebp)
+  802f7e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802f81:	89 c2                	mov    %eax,%edx
+  802f83:	89 f8                	mov    %edi,%eax
+  802f85:	e8 c3 fe ff ff       	call   802e4d <devpipe_read_bulk>
+  802f8a:	83 c4 10             	add    $0x10,%esp
+  802f8d:	eb 02                	jmp    802f91 <devpipe_read+0x5d>
+        return i;
+  802f8f:	89 f0                	mov    %esi,%eax
+}
+  802f91:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f94:	5b                   	pop    %ebx
+  802f95:	5e                   	pop    %esi
+  802f96:	5f                   	pop    %edi
+  802f97:	5d                   	pop    %ebp
+  802f98:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802f99:	99                   	cltd
+  802f9a:	c1 ea 1b             	shr    $0x1b,%edx
+  802f9d:	01 d0                	add    %edx,%eax
+  802f9f:	83 e0 1f             	and    $0x1f,%eax
+  802fa2:	29 d0                	sub    %edx,%eax
+  802fa4:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802fa9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802fac:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  802faf:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  802fb2:	83 c6 01             	add    $0x1,%esi
+  802fb5:	eb 9b                	jmp    802f52 <devpipe_read+0x1e>
+  return i;
+  802fb7:	89 f0                	mov    %esi,%eax
+  802fb9:	eb d6                	jmp    802f91 <devpipe_read+0x5d>
+        return 0;
+  802fbb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fc0:	eb cf                	jmp    802f91 <devpipe_read+0x5d>
+
+00802fc2 <pipe2>:
+{
+  802fc2:	55                   	push   %ebp
+  802fc3:	89 e5                	mov    %esp,%ebp
+  802fc5:	57                   	push   %edi
+  802fc6:	56                   	push   %esi
+  802fc7:	53                   	push   %ebx
+  802fc8:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  802fcb:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802fce:	50                   	push   %eax
+  802fcf:	e8 ea e3 ff ff       	call   8013be <fd_alloc>
+  802fd4:	89 c3                	mov    %eax,%ebx
+  802fd6:	83 c4 10             	add    $0x10,%esp
+  802fd9:	85 c0                	test   %eax,%eax
+  802fdb:	0f 88 fb 01 00 00    	js     8031dc <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802fe1:	83 ec 04             	sub    $0x4,%esp
+  802fe4:	68 07 04 00 00       	push   $0x407
+  802fe9:	ff 75 e4             	push   -0x1c(%ebp)
+  802fec:	6a 00                	push   $0x0
+  802fee:	e8 f8 de ff ff       	call   800eeb <sys_page_alloc>
+  802ff3:	89 c3                	mov    %eax,%ebx
+  802ff5:	83 c4 10             	add    $0x10,%esp
+  802ff8:	85 c0                	test   %eax,%eax
+  802ffa:	0f 88 dc 01 00 00    	js     8031dc <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  803000:	83 ec 0c             	sub    $0xc,%esp
+  803003:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  803006:	50                   	push   %eax
+  803007:	e8 b2 e3 ff ff       	call   8013be <fd_alloc>
+  80300c:	89 c3                	mov    %eax,%ebx
+  80300e:	83 c4 10             	add    $0x10,%esp
+  803011:	85 c0                	test   %eax,%eax
+  803013:	0f 88 b3 01 00 00    	js     8031cc <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803019:	83 ec 04             	sub    $0x4,%esp
+  80301c:	68 07 04 00 00       	push   $0x407
+  803021:	ff 75 e0             	push   -0x20(%ebp)
+  803024:	6a 00                	push   $0x0
+  803026:	e8 c0 de ff ff       	call   800eeb <sys_page_alloc>
+  80302b:	89 c3                	mov    %eax,%ebx
+  80302d:	83 c4 10             	add    $0x10,%esp
+  803030:	85 c0                	test   %eax,%eax
+  803032:	0f 88 94 01 00 00    	js     8031cc <pipe2+0x20a>
+  va = fd2data(fd0);
+  803038:	83 ec 0c             	sub    $0xc,%esp
+  80303b:	ff 75 e4             	push   -0x1c(%ebp)
+  80303e:	e8 67 e3 ff ff       	call   8013aa <fd2data>
+  803043:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803045:	83 c4 0c             	add    $0xc,%esp
+  803048:	68 07 04 00 00       	push   $0x407
+  80304d:	50                   	push   %eax
+  80304e:	6a 00                	push   $0x0
+  803050:	e8 96 de ff ff       	call   800eeb <sys_page_alloc>
+  803055:	89 c3                	mov    %eax,%ebx
+  803057:	83 c4 10             	add    $0x10,%esp
+  80305a:	85 c0                	test   %eax,%eax
+  80305c:	0f 88 5a 01 00 00    	js     8031bc <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803062:	83 ec 0c             	sub    $0xc,%esp
+  803065:	ff 75 e0             	push   -0x20(%ebp)
+  803068:	e8 3d e3 ff ff       	call   8013aa <fd2data>
+  80306d:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803074:	50                   	push   %eax
+  803075:	6a 00                	push   $0x0
+  803077:	57                   	push   %edi
+  803078:	6a 00                	push   $0x0
+  80307a:	e8 af de ff ff       	call   800f2e <sys_page_map>
+  80307f:	89 c3                	mov    %eax,%ebx
+  803081:	83 c4 20             	add    $0x20,%esp
+  803084:	85 c0                	test   %eax,%eax
+  803086:	0f 88 22 01 00 00    	js     8031ae <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  80308c:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  803090:	74 72                	je     803104 <pipe2+0x142>
+  803092:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  803097:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80309a:	e8 d3 fa ff ff       	call   802b72 <pipe_ring>
+  80309f:	83 ec 04             	sub    $0x4,%esp
+  8030a2:	68 07 04 00 00       	push   $0x407
+  8030a7:	01 f0                	add    %esi,%eax
+  8030a9:	50                   	push   %eax
+  8030aa:	6a 00                	push   $0x0
+  8030ac:	e8 3a de ff ff       	call   800eeb <sys_page_alloc>
+  8030b1:	89 c3                	mov    %eax,%ebx
+  8030b3:	83 c4 10             	add    $0x10,%esp
+  8030b6:	85 c0                	test   %eax,%eax
+  8030b8:	0f 88 97 00 00 00    	js     803155 <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  8030be:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8030c1:	e8 ac fa ff ff       	call   802b72 <pipe_ring>
+  8030c6:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  8030c9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8030cc:	e8 a1 fa ff ff       	call   802b72 <pipe_ring>
+  8030d1:	83 ec 0c             	sub    $0xc,%esp
+  8030d4:	68 07 04 00 00       	push   $0x407
+  8030d9:	53                   	push   %ebx
+  8030da:	6a 00                	push   $0x0
+  8030dc:	01 f0                	add    %esi,%eax
+  8030de:	50                   	push   %eax
+  8030df:	6a 00                	push   $0x0
+  8030e1:	e8 48 de ff ff       	call   800f2e <sys_page_map>
+  8030e6:	89 c3                	mov    %eax,%ebx
+  8030e8:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8030ee:	83 c4 20             	add    $0x20,%esp
+  8030f1:	85 c0                	test   %eax,%eax
+  8030f3:	78 60                	js     803155 <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  8030f5:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  8030fb:	75 9a                	jne    803097 <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  8030fd:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  803104:	a1 20 40 80 00       	mov    0x804020,%eax
+  803109:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80310c:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  80310e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  803111:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  803118:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80311b:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  80311d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803120:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  803127:	83 ec 0c             	sub    $0xc,%esp
+  80312a:	ff 75 e4             	push   -0x1c(%ebp)
+  80312d:	e8 68 e2 ff ff       	call   80139a <fd2num>
+  803132:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803135:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  803137:	83 c4 04             	add    $0x4,%esp
+  80313a:	ff 75 e0             	push   -0x20(%ebp)
+  80313d:	e8 58 e2 ff ff       	call   80139a <fd2num>
+  803142:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803145:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  803148:	83 c4 10             	add    $0x10,%esp
+  80314b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803150:	e9 87 00 00 00       	jmp    8031dc <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  803155:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  80315a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80315d:	e8 10 fa ff ff       	call   802b72 <pipe_ring>
+  803162:	83 ec 08             	sub    $0x8,%esp
+  803165:	01 f0                	add    %esi,%eax
+  803167:	50                   	push   %eax
+  803168:	6a 00                	push   $0x0
+  80316a:	e8 01 de ff ff       	call   800f70 <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  80316f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803172:	e8 fb f9 ff ff       	call   802b72 <pipe_ring>
+  803177:	83 c4 08             	add    $0x8,%esp
+  80317a:	01 f0                	add    %esi,%eax
+  80317c:	50                   	push   %eax
+  80317d:	6a 00                	push   $0x0
+  80317f:	e8 ec dd ff ff       	call   800f70 <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  803184:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80318a:	83 c4 10             	add    $0x10,%esp
+  80318d:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  803193:	75 c5                	jne    80315a <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  803195:	83 ec 0c             	sub    $0xc,%esp
+  803198:	ff 75 e0             	push   -0x20(%ebp)
+  80319b:	e8 0a e2 ff ff       	call   8013aa <fd2data>
+  8031a0:	83 c4 08             	add    $0x8,%esp
+  8031a3:	50                   	push   %eax
+  8031a4:	6a 00                	push   $0x0
+  8031a6:	e8 c5 dd ff ff       	call   800f70 <sys_page_unmap>
+  8031ab:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  8031ae:	83 ec 08             	sub    $0x8,%esp
+  8031b1:	57                   	push   %edi
+  8031b2:	6a 00                	push   $0x0
+  8031b4:	e8 b7 dd ff ff       	call   800f70 <sys_page_unmap>
+  8031b9:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  8031bc:	83 ec 08             	sub    $0x8,%esp
+  8031bf:	ff 75 e0             	push   -0x20(%ebp)
+  8031c2:	6a 00                	push   $0x0
+  8031c4:	e8 a7 dd ff ff       	call   800f70 <sys_page_unmap>
+  8031c9:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  8031cc:	83 ec 08             	sub    $0x8,%esp
+  8031cf:	ff 75 e4             	push   -0x1c(%ebp)
+  8031d2:	6a 00                	push   $0x0
+  8031d4:	e8 97 dd ff ff       	call   800f70 <sys_page_unmap>
+  8031d9:	83 c4 10             	add    $0x10,%esp
+}
+  8031dc:	89 d8                	mov    %ebx,%eax
+  8031de:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8031e1:	5b                   	pop    %ebx
+  8031e2:	5e                   	pop    %esi
+  8031e3:	5f                   	pop    %edi
+  8031e4:	5d                   	pop    %ebp
+  8031e5:	c3                   	ret
+
+008031e6 <pipe>:
+{
+  8031e6:	55                   	push   %ebp
+  8031e7:	89 e5                	mov    %esp,%ebp
+  8031e9:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  8031ec:	6a 00                	push   $0x0
+  8031ee:	ff 75 08             	push   0x8(%ebp)
+  8031f1:	e8 cc fd ff ff       	call   802fc2 <pipe2>
+}
+  8031f6:	c9                   	leave
+  8031f7:	c3                   	ret
+
+008031f8 <pipeisclosed>:
+{
+  8031f8:	55                   	push   %ebp
+  8031f9:	89 e5                	mov    %esp,%ebp
+  8031fb:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8031fe:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803201:	50                   	push   %eax
+  803202:	ff 75 08             	push   0x8(%ebp)
+  803205:	e8 0a e2 ff ff       	call   801414 <fd_lookup>
+  80320a:	83 c4 10             	add    $0x10,%esp
+  80320d:	85 c0                	test   %eax,%eax
+  80320f:	78 18                	js     803229 <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  803211:	83 ec 0c             	sub    $0xc,%esp
+  803214:	ff 75 f4             	push   -0xc(%ebp)
+  803217:	e8 8e e1 ff ff       	call   8013aa <fd2data>
+  80321c:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  80321e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803221:	e8 59 fa ff ff       	call   802c7f <_pipeisclosed>
+  803226:	83 c4 10             	add    $0x10,%esp
+}
+  803229:	c9                   	leave
+  80322a:	c3                   	ret
+
+0080322b <pipe_splice>:
+{
+  80322b:	55                   	push   %ebp
+  80322c:	89 e5                	mov    %esp,%ebp
+  80322e:	57                   	push   %edi
+  80322f:	56                   	push   %esi
+  803230:	53                   	push   %ebx
+  803231:	83 ec 34             	sub    $0x34,%esp
+  803234:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803237:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80323a:	50                   	push   %eax
+  80323b:	ff 75 08             	push   0x8(%ebp)
+  80323e:	e8 d1 e1 ff ff       	call   801414 <fd_lookup>
+  803243:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  803246:	83 c4 10             	add    $0x10,%esp
+  803249:	85 c0                	test   %eax,%eax
+  80324b:	0f 88 d7 00 00 00    	js     803328 <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  803251:	83 ec 0c             	sub    $0xc,%esp
+  803254:	ff 75 e4             	push   -0x1c(%ebp)
+  803257:	e8 4e e1 ff ff       	call   8013aa <fd2data>
+  80325c:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  80325e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803261:	83 c4 10             	add    $0x10,%esp
+  803264:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  80326a:	39 10                	cmp    %edx,(%eax)
+  80326c:	0f 85 c1 00 00 00    	jne    803333 <pipe_splice+0x108>
+  803272:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  803276:	0f 84 c0 00 00 00    	je     80333c <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  80327c:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  803280:	0f 84 bf 00 00 00    	je     803345 <pipe_splice+0x11a>
+  803286:	89 f7                	mov    %esi,%edi
+  803288:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  80328e:	0f 85 ba 00 00 00    	jne    80334e <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  803294:	8d 43 04             	lea    0x4(%ebx),%eax
+  803297:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80329a:	eb 38                	jmp    8032d4 <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  80329c:	83 ec 0c             	sub    $0xc,%esp
+  80329f:	68 00 10 00 00       	push   $0x1000
+  8032a4:	89 f1                	mov    %esi,%ecx
+  8032a6:	89 da                	mov    %ebx,%edx
+  8032a8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8032ab:	e8 34 fa ff ff       	call   802ce4 <devpipe_write_bulk>
+  8032b0:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8032b3:	83 c4 10             	add    $0x10,%esp
+  8032b6:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8032bb:	75 53                	jne    803310 <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  8032bd:	83 ec 08             	sub    $0x8,%esp
+  8032c0:	56                   	push   %esi
+  8032c1:	6a 00                	push   $0x0
+  8032c3:	e8 a8 dc ff ff       	call   800f70 <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  8032c8:	83 c7 01             	add    $0x1,%edi
+  8032cb:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8032d1:	83 c4 10             	add    $0x10,%esp
+  8032d4:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8032d7:	74 3a                	je     803313 <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  8032d9:	8b 03                	mov    (%ebx),%eax
+  8032db:	39 43 04             	cmp    %eax,0x4(%ebx)
+  8032de:	75 bc                	jne    80329c <pipe_splice+0x71>
+  8032e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032e5:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  8032e9:	85 c0                	test   %eax,%eax
+  8032eb:	74 af                	je     80329c <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  8032ed:	83 ec 04             	sub    $0x4,%esp
+  8032f0:	6a 07                	push   $0x7
+  8032f2:	56                   	push   %esi
+  8032f3:	ff 75 d0             	push   -0x30(%ebp)
+  8032f6:	e8 4c df ff ff       	call   801247 <sys_chan_wakeup>
+  8032fb:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8032fe:	83 c4 10             	add    $0x10,%esp
+  803301:	85 c0                	test   %eax,%eax
+  803303:	79 b8                	jns    8032bd <pipe_splice+0x92>
+  803305:	b8 01 00 00 00       	mov    $0x1,%eax
+  80330a:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  80330e:	eb 8c                	jmp    80329c <pipe_splice+0x71>
+  803310:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  803313:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803317:	75 06                	jne    80331f <pipe_splice+0xf4>
+  803319:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  80331d:	78 09                	js     803328 <pipe_splice+0xfd>
+  return i * PGSIZE;
+  80331f:	8b 45 10             	mov    0x10(%ebp),%eax
+  803322:	c1 e0 0c             	shl    $0xc,%eax
+  803325:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  803328:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  80332b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80332e:	5b                   	pop    %ebx
+  80332f:	5e                   	pop    %esi
+  803330:	5f                   	pop    %edi
+  803331:	5d                   	pop    %ebp
+  803332:	c3                   	ret
+    return -E_INVAL;
+  803333:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  80333a:	eb ec                	jmp    803328 <pipe_splice+0xfd>
+  80333c:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  803343:	eb e3                	jmp    803328 <pipe_splice+0xfd>
+  803345:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  80334c:	eb da                	jmp    803328 <pipe_splice+0xfd>
+  80334e:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  803355:	eb d1                	jmp    803328 <pipe_splice+0xfd>
+
+00803357 <pipe_splice_read>:
+{
+  803357:	55                   	push   %ebp
+  803358:	89 e5                	mov    %esp,%ebp
+  80335a:	53                   	push   %ebx
+  80335b:	83 ec 1c             	sub    $0x1c,%esp
+  80335e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803361:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803364:	50                   	push   %eax
+  803365:	ff 75 08             	push   0x8(%ebp)
+  803368:	e8 a7 e0 ff ff       	call   801414 <fd_lookup>
+  80336d:	83 c4 10             	add    $0x10,%esp
+  803370:	85 c0                	test   %eax,%eax
+  803372:	78 49                	js     8033bd <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  803374:	83 ec 0c             	sub    $0xc,%esp
+  803377:	ff 75 f4             	push   -0xc(%ebp)
+  80337a:	e8 2b e0 ff ff       	call   8013aa <fd2data>
+  80337f:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  803381:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803384:	83 c4 10             	add    $0x10,%esp
+  803387:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  80338d:	39 08                	cmp    %ecx,(%eax)
+  80338f:	75 31                	jne    8033c2 <pipe_splice_read+0x6b>
+  803391:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  803395:	74 32                	je     8033c9 <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  803397:	8b 48 08             	mov    0x8(%eax),%ecx
+  80339a:	83 e1 03             	and    $0x3,%ecx
+  80339d:	83 f9 01             	cmp    $0x1,%ecx
+  8033a0:	74 2e                	je     8033d0 <pipe_splice_read+0x79>
+  8033a2:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  8033a8:	75 2d                	jne    8033d7 <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  8033aa:	83 ec 08             	sub    $0x8,%esp
+  8033ad:	53                   	push   %ebx
+  8033ae:	68 00 10 00 00       	push   $0x1000
+  8033b3:	89 d9                	mov    %ebx,%ecx
+  8033b5:	e8 93 fa ff ff       	call   802e4d <devpipe_read_bulk>
+  8033ba:	83 c4 10             	add    $0x10,%esp
+}
+  8033bd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8033c0:	c9                   	leave
+  8033c1:	c3                   	ret
+    return -E_INVAL;
+  8033c2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8033c7:	eb f4                	jmp    8033bd <pipe_splice_read+0x66>
+  8033c9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8033ce:	eb ed                	jmp    8033bd <pipe_splice_read+0x66>
+  8033d0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8033d5:	eb e6                	jmp    8033bd <pipe_splice_read+0x66>
+  8033d7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8033dc:	eb df                	jmp    8033bd <pipe_splice_read+0x66>
+
+008033de <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  8033de:	55                   	push   %ebp
+  8033df:	89 e5                	mov    %esp,%ebp
+  8033e1:	56                   	push   %esi
+  8033e2:	53                   	push   %ebx
+  8033e3:	8b 75 08             	mov    0x8(%ebp),%esi
+  const volatile struct Env *e;
+
+  assert(envid != 0);
+  8033e6:	85 f6                	test   %esi,%esi
+  8033e8:	74 15                	je     8033ff <wait+0x21>
+  e = &envs[ENVX(envid)];
+  8033ea:	89 f0                	mov    %esi,%eax
+  8033ec:	25 ff 03 00 00       	and    $0x3ff,%eax
+  while (e->env_id == envid && e->env_status != ENV_FREE)
+  8033f1:	8d 1c c0             	lea    (%eax,%eax,8),%ebx
+  8033f4:	c1 e3 04             	shl    $0x4,%ebx
+  8033f7:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  8033fd:	eb 1b                	jmp    80341a <wait+0x3c>
+  assert(envid != 0);
+  8033ff:	68 65 3f 80 00       	push   $0x803f65
+  803404:	68 58 3e 80 00       	push   $0x803e58
+  803409:	6a 09                	push   $0x9
+  80340b:	68 70 3f 80 00       	push   $0x803f70
+  803410:	e8 de cf ff ff       	call   8003f3 <_panic>
+    sys_yield();
+  803415:	e8 6f da ff ff       	call   800e89 <sys_yield>
+  while (e->env_id == envid && e->env_status != ENV_FREE)
+  80341a:	8b 43 48             	mov    0x48(%ebx),%eax
+  80341d:	39 f0                	cmp    %esi,%eax
+  80341f:	75 07                	jne    803428 <wait+0x4a>
+  803421:	8b 43 54             	mov    0x54(%ebx),%eax
+  803424:	85 c0                	test   %eax,%eax
+  803426:	75 ed                	jne    803415 <wait+0x37>
+}
+  803428:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80342b:	5b                   	pop    %ebx
+  80342c:	5e                   	pop    %esi
+  80342d:	5d                   	pop    %ebp
+  80342e:	c3                   	ret
+
+0080342f <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  80342f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803434:	c3                   	ret
+
+00803435 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803435:	55                   	push   %ebp
+  803436:	89 e5                	mov    %esp,%ebp
+  803438:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  80343b:	68 7b 3f 80 00       	push   $0x803f7b
+  803440:	ff 75 0c             	push   0xc(%ebp)
+  803443:	e8 74 d6 ff ff       	call   800abc <strcpy>
+  return 0;
+}
+  803448:	b8 00 00 00 00       	mov    $0x0,%eax
+  80344d:	c9                   	leave
+  80344e:	c3                   	ret
+
+0080344f <devcons_write>:
+{
+  80344f:	55                   	push   %ebp
+  803450:	89 e5                	mov    %esp,%ebp
+  803452:	57                   	push   %edi
+  803453:	56                   	push   %esi
+  803454:	53                   	push   %ebx
+  803455:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  80345b:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  803460:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  803466:	eb 2e                	jmp    803496 <devcons_write+0x47>
+    m = n - tot;
+  803468:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80346b:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  80346d:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803472:	39 c3                	cmp    %eax,%ebx
+  803474:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  803477:	83 ec 04             	sub    $0x4,%esp
+  80347a:	53                   	push   %ebx
+  80347b:	89 f0                	mov    %esi,%eax
+  80347d:	03 45 0c             	add    0xc(%ebp),%eax
+  803480:	50                   	push   %eax
+  803481:	57                   	push   %edi
+  803482:	e8 bb d7 ff ff       	call   800c42 <memmove>
+    sys_cputs(buf, m);
+  803487:	83 c4 08             	add    $0x8,%esp
+  80348a:	53                   	push   %ebx
+  80348b:	57                   	push   %edi
+  80348c:	e8 5b d9 ff ff       	call   800dec <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  803491:	01 de                	add    %ebx,%esi
+  803493:	83 c4 10             	add    $0x10,%esp
+  803496:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803499:	72 cd                	jb     803468 <devcons_write+0x19>
+}
+  80349b:	89 f0                	mov    %esi,%eax
+  80349d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8034a0:	5b                   	pop    %ebx
+  8034a1:	5e                   	pop    %esi
+  8034a2:	5f                   	pop    %edi
+  8034a3:	5d                   	pop    %ebp
+  8034a4:	c3                   	ret
+
+008034a5 <devcons_read>:
+{
+  8034a5:	55                   	push   %ebp
+  8034a6:	89 e5                	mov    %esp,%ebp
+  8034a8:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  8034ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034b0:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8034b4:	75 07                	jne    8034bd <devcons_read+0x18>
+  8034b6:	eb 1f                	jmp    8034d7 <devcons_read+0x32>
+    sys_yield();
+  8034b8:	e8 cc d9 ff ff       	call   800e89 <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  8034bd:	e8 48 d9 ff ff       	call   800e0a <sys_cgetc>
+  8034c2:	85 c0                	test   %eax,%eax
+  8034c4:	74 f2                	je     8034b8 <devcons_read+0x13>
+  if (c < 0)
+  8034c6:	78 0f                	js     8034d7 <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  8034c8:	83 f8 04             	cmp    $0x4,%eax
+  8034cb:	74 0c                	je     8034d9 <devcons_read+0x34>
+  *(char*)vbuf = c;
+  8034cd:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8034d0:	88 02                	mov    %al,(%edx)
+  return 1;
+  8034d2:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8034d7:	c9                   	leave
+  8034d8:	c3                   	ret
+    return 0;
+  8034d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034de:	eb f7                	jmp    8034d7 <devcons_read+0x32>
+
+008034e0 <cputchar>:
+{
+  8034e0:	55                   	push   %ebp
+  8034e1:	89 e5                	mov    %esp,%ebp
+  8034e3:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  8034e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8034e9:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  8034ec:	6a 01                	push   $0x1
+  8034ee:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8034f1:	50                   	push   %eax
+  8034f2:	e8 f5 d8 ff ff       	call   800dec <sys_cputs>
+}
+  8034f7:	83 c4 10             	add    $0x10,%esp
+  8034fa:	c9                   	leave
+  8034fb:	c3                   	ret
+
+008034fc <getchar>:
+{
+  8034fc:	55                   	push   %ebp
+  8034fd:	89 e5                	mov    %esp,%ebp
+  8034ff:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  803502:	6a 01                	push   $0x1
+  803504:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803507:	50                   	push   %eax
+  803508:	6a 00                	push   $0x0
+  80350a:	e8 b0 e1 ff ff       	call   8016bf <read>
+  if (r < 0)
+  80350f:	83 c4 10             	add    $0x10,%esp
+  803512:	85 c0                	test   %eax,%eax
+  803514:	78 06                	js     80351c <getchar+0x20>
+  if (r < 1)
+  803516:	74 06                	je     80351e <getchar+0x22>
+  return c;
+  803518:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  80351c:	c9                   	leave
+  80351d:	c3                   	ret
+    return -E_EOF;
+  80351e:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803523:	eb f7                	jmp    80351c <getchar+0x20>
+
+00803525 <iscons>:
+{
+  803525:	55                   	push   %ebp
+  803526:	89 e5                	mov    %esp,%ebp
+  803528:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80352b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80352e:	50                   	push   %eax
+  80352f:	ff 75 08             	push   0x8(%ebp)
+  803532:	e8 dd de ff ff       	call   801414 <fd_lookup>
+  803537:	83 c4 10             	add    $0x10,%esp
+  80353a:	85 c0                	test   %eax,%eax
+  80353c:	78 11                	js     80354f <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  80353e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803541:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  803547:	39 10                	cmp    %edx,(%eax)
+  803549:	0f 94 c0             	sete   %al
+  80354c:	0f b6 c0             	movzbl %al,%eax
+}
+  80354f:	c9                   	leave
+  803550:	c3                   	ret
+
+00803551 <opencons>:
+{
+  803551:	55                   	push   %ebp
+  803552:	89 e5                	mov    %esp,%ebp
+  803554:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  803557:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80355a:	50                   	push   %eax
+  80355b:	e8 5e de ff ff       	call   8013be <fd_alloc>
+  803560:	83 c4 10             	add    $0x10,%esp
+  803563:	85 c0                	test   %eax,%eax
+  803565:	78 3a                	js     8035a1 <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803567:	83 ec 04             	sub    $0x4,%esp
+  80356a:	68 07 04 00 00       	push   $0x407
+  80356f:	ff 75 f4             	push   -0xc(%ebp)
+  803572:	6a 00                	push   $0x0
+  803574:	e8 72 d9 ff ff       	call   800eeb <sys_page_alloc>
+  803579:	83 c4 10             	add    $0x10,%esp
+  80357c:	85 c0                	test   %eax,%eax
+  80357e:	78 21                	js     8035a1 <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  803580:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803583:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  803589:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  80358b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80358e:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  803595:	83 ec 0c             	sub    $0xc,%esp
+  803598:	50                   	push   %eax
+  803599:	e8 fc dd ff ff       	call   80139a <fd2num>
+  80359e:	83 c4 10             	add    $0x10,%esp
+}
+  8035a1:	c9                   	leave
+  8035a2:	c3                   	ret
+
+008035a3 <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  8035a3:	55                   	push   %ebp
+  8035a4:	89 e5                	mov    %esp,%ebp
+  8035a6:	57                   	push   %edi
+  8035a7:	56                   	push   %esi
+  8035a8:	53                   	push   %ebx
+  8035a9:	83 ec 14             	sub    $0x14,%esp
+  8035ac:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8035af:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8035b2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8035b5:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  8035b8:	85 c0                	test   %eax,%eax
+  8035ba:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8035bf:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  8035c2:	ff 33                	push   (%ebx)
+  8035c4:	50                   	push   %eax
+  8035c5:	e8 f9 db ff ff       	call   8011c3 <sys_ipc_recv>
+  8035ca:	83 c4 10             	add    $0x10,%esp
+  8035cd:	85 c0                	test   %eax,%eax
+  8035cf:	78 39                	js     80360a <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  8035d1:	85 ff                	test   %edi,%edi
+  8035d3:	74 0a                	je     8035df <ipc_recv_pages+0x3c>
+  8035d5:	a1 e4 5e 80 00       	mov    0x805ee4,%eax
+  8035da:	8b 40 7c             	mov    0x7c(%eax),%eax
+  8035dd:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  8035df:	85 f6                	test   %esi,%esi
+  8035e1:	74 0d                	je     8035f0 <ipc_recv_pages+0x4d>
+  8035e3:	a1 e4 5e 80 00       	mov    0x805ee4,%eax
+  8035e8:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  8035ee:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  8035f0:	a1 e4 5e 80 00       	mov    0x805ee4,%eax
+  8035f5:	8b 40 74             	mov    0x74(%eax),%eax
+  8035f8:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  8035fa:	a1 e4 5e 80 00       	mov    0x805ee4,%eax
+  8035ff:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  803602:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803605:	5b                   	pop    %ebx
+  803606:	5e                   	pop    %esi
+  803607:	5f                   	pop    %edi
+  803608:	5d                   	pop    %ebp
+  803609:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  80360a:	85 ff                	test   %edi,%edi
+  80360c:	74 06                	je     803614 <ipc_recv_pages+0x71>
+  80360e:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  803614:	85 f6                	test   %esi,%esi
+  803616:	74 06                	je     80361e <ipc_recv_pages+0x7b>
+  803618:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  80361e:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  803624:	eb dc                	jmp    803602 <ipc_recv_pages+0x5f>
+
+00803626 <ipc_recv>:
+{
+  803626:	55                   	push   %ebp
+  803627:	89 e5                	mov    %esp,%ebp
+  803629:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  80362c:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  803633:	ff 75 10             	push   0x10(%ebp)
+  803636:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803639:	50                   	push   %eax
+  80363a:	ff 75 0c             	push   0xc(%ebp)
+  80363d:	ff 75 08             	push   0x8(%ebp)
+  803640:	e8 5e ff ff ff       	call   8035a3 <ipc_recv_pages>
+}
+  803645:	c9                   	leave
+  803646:	c3                   	ret
+
+00803647 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  803647:	55                   	push   %ebp
+  803648:	89 e5                	mov    %esp,%ebp
+  80364a:	57                   	push   %edi
+  80364b:	56                   	push   %esi
+  80364c:	53                   	push   %ebx
+  80364d:	83 ec 0c             	sub    $0xc,%esp
+  803650:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803653:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803656:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  803659:	89 c3                	mov    %eax,%ebx
+  80365b:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  803661:	85 c0                	test   %eax,%eax
+  803663:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  803668:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  80366b:	83 ec 0c             	sub    $0xc,%esp
+  80366e:	ff 75 14             	push   0x14(%ebp)
+  803671:	ff 75 18             	push   0x18(%ebp)
+  803674:	53                   	push   %ebx
+  803675:	56                   	push   %esi
+  803676:	57                   	push   %edi
+  803677:	e8 26 db ff ff       	call   8011a2 <sys_ipc_try_send>
+  80367c:	83 c4 20             	add    $0x20,%esp
+  80367f:	85 c0                	test   %eax,%eax
+  803681:	79 1e                	jns    8036a1 <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  803683:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803686:	75 07                	jne    80368f <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  803688:	e8 fc d7 ff ff       	call   800e89 <sys_yield>
+  80368d:	eb dc                	jmp    80366b <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  80368f:	50                   	push   %eax
+  803690:	68 87 3f 80 00       	push   $0x803f87
+  803695:	6a 5c                	push   $0x5c
+  803697:	68 94 3f 80 00       	push   $0x803f94
+  80369c:	e8 52 cd ff ff       	call   8003f3 <_panic>
+  }
+}
+  8036a1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8036a4:	5b                   	pop    %ebx
+  8036a5:	5e                   	pop    %esi
+  8036a6:	5f                   	pop    %edi
+  8036a7:	5d                   	pop    %ebp
+  8036a8:	c3                   	ret
+
+008036a9 <ipc_send>:
+{
+  8036a9:	55                   	push   %ebp
+  8036aa:	89 e5                	mov    %esp,%ebp
+  8036ac:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  8036af:	ff 75 14             	push   0x14(%ebp)
+  8036b2:	6a 01                	push   $0x1
+  8036b4:	ff 75 10             	push   0x10(%ebp)
+  8036b7:	ff 75 0c             	push   0xc(%ebp)
+  8036ba:	ff 75 08             	push   0x8(%ebp)
+  8036bd:	e8 85 ff ff ff       	call   803647 <ipc_send_pages>
+}
+  8036c2:	83 c4 20             	add    $0x20,%esp
+  8036c5:	c9                   	leave
+  8036c6:	c3                   	ret
+
+008036c7 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8036c7:	55                   	push   %ebp
+  8036c8:	89 e5                	mov    %esp,%ebp
+  8036ca:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  8036cd:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  8036d2:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8036d5:	c1 e0 04             	shl    $0x4,%eax
+  8036d8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8036dd:	8b 40 50             	mov    0x50(%eax),%eax
+  8036e0:	39 c8                	cmp    %ecx,%eax
+  8036e2:	74 12                	je     8036f6 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  8036e4:	83 c2 01             	add    $0x1,%edx
+  8036e7:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  8036ed:	75 e3                	jne    8036d2 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  8036ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036f4:	eb 0e                	jmp    803704 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  8036f6:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8036f9:	c1 e0 04             	shl    $0x4,%eax
+  8036fc:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803701:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803704:	5d                   	pop    %ebp
+  803705:	c3                   	ret
+
+00803706 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803706:	55                   	push   %ebp
+  803707:	89 e5                	mov    %esp,%ebp
+  803709:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  80370c:	89 c2                	mov    %eax,%edx
+  80370e:	c1 ea 16             	shr    $0x16,%edx
+  803711:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  803718:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  80371d:	f6 c1 01             	test   $0x1,%cl
+  803720:	74 1c                	je     80373e <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  803722:	c1 e8 0c             	shr    $0xc,%eax
+  803725:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  80372c:	a8 01                	test   $0x1,%al
+  80372e:	74 0e                	je     80373e <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  803730:	c1 e8 0c             	shr    $0xc,%eax
+  803733:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  80373a:	ef 
+  80373b:	0f b7 d2             	movzwl %dx,%edx
+}
+  80373e:	89 d0                	mov    %edx,%eax
+  803740:	5d                   	pop    %ebp
+  803741:	c3                   	ret
+
+00803742 <udivmod>:
+  803742:	55                   	push   %ebp
+  803743:	57                   	push   %edi
+  803744:	56                   	push   %esi
+  803745:	53                   	push   %ebx
+  803746:	83 ec 14             	sub    $0x14,%esp
+  803749:	8b 74 24 28          	mov    0x28(%esp),%esi
+  80374d:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  803751:	89 fb                	mov    %edi,%ebx
+  803753:	09 f3                	or     %esi,%ebx
+  803755:	0f 84 88 00 00 00    	je     8037e3 <udivmod+0xa1>
+  80375b:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803760:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  803767:	00 
+  803768:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80376f:	00 
+  803770:	89 cd                	mov    %ecx,%ebp
+  803772:	89 34 24             	mov    %esi,(%esp)
+  803775:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  803779:	eb 08                	jmp    803783 <udivmod+0x41>
+  80377b:	83 ed 01             	sub    $0x1,%ebp
+  80377e:	83 fd ff             	cmp    $0xffffffff,%ebp
+  803781:	74 6c                	je     8037ef <udivmod+0xad>
+  803783:	89 c3                	mov    %eax,%ebx
+  803785:	89 d6                	mov    %edx,%esi
+  803787:	89 e9                	mov    %ebp,%ecx
+  803789:	0f ad f3             	shrd   %cl,%esi,%ebx
+  80378c:	d3 ee                	shr    %cl,%esi
+  80378e:	f6 c1 20             	test   $0x20,%cl
+  803791:	74 04                	je     803797 <udivmod+0x55>
+  803793:	89 f3                	mov    %esi,%ebx
+  803795:	31 f6                	xor    %esi,%esi
+  803797:	8b 3c 24             	mov    (%esp),%edi
+  80379a:	39 fb                	cmp    %edi,%ebx
+  80379c:	89 f7                	mov    %esi,%edi
+  80379e:	8b 1c 24             	mov    (%esp),%ebx
+  8037a1:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8037a5:	19 f7                	sbb    %esi,%edi
+  8037a7:	72 d2                	jb     80377b <udivmod+0x39>
+  8037a9:	89 f7                	mov    %esi,%edi
+  8037ab:	89 de                	mov    %ebx,%esi
+  8037ad:	89 e9                	mov    %ebp,%ecx
+  8037af:	0f a5 f7             	shld   %cl,%esi,%edi
+  8037b2:	d3 e6                	shl    %cl,%esi
+  8037b4:	f6 c1 20             	test   $0x20,%cl
+  8037b7:	74 04                	je     8037bd <udivmod+0x7b>
+  8037b9:	89 f7                	mov    %esi,%edi
+  8037bb:	31 f6                	xor    %esi,%esi
+  8037bd:	29 f0                	sub    %esi,%eax
+  8037bf:	19 fa                	sbb    %edi,%edx
+  8037c1:	be 01 00 00 00       	mov    $0x1,%esi
+  8037c6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037cb:	0f a5 f7             	shld   %cl,%esi,%edi
+  8037ce:	d3 e6                	shl    %cl,%esi
+  8037d0:	f6 c1 20             	test   $0x20,%cl
+  8037d3:	74 04                	je     8037d9 <udivmod+0x97>
+  8037d5:	89 f7                	mov    %esi,%edi
+  8037d7:	31 f6                	xor    %esi,%esi
+  8037d9:	09 74 24 08          	or     %esi,0x8(%esp)
+  8037dd:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8037e1:	eb 98                	jmp    80377b <udivmod+0x39>
+  8037e3:	89 f0                	mov    %esi,%eax
+  8037e5:	89 fa                	mov    %edi,%edx
+  8037e7:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8037eb:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  8037ef:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  8037f3:	89 01                	mov    %eax,(%ecx)
+  8037f5:	89 51 04             	mov    %edx,0x4(%ecx)
+  8037f8:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8037fc:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803800:	83 c4 14             	add    $0x14,%esp
+  803803:	5b                   	pop    %ebx
+  803804:	5e                   	pop    %esi
+  803805:	5f                   	pop    %edi
+  803806:	5d                   	pop    %ebp
+  803807:	c3                   	ret
+
+00803808 <__udivdi3>:
+  803808:	83 ec 18             	sub    $0x18,%esp
+  80380b:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80380f:	50                   	push   %eax
+  803810:	ff 74 24 2c          	push   0x2c(%esp)
+  803814:	ff 74 24 2c          	push   0x2c(%esp)
+  803818:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80381c:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803820:	e8 1d ff ff ff       	call   803742 <udivmod>
+  803825:	83 c4 24             	add    $0x24,%esp
+  803828:	c3                   	ret
+
+00803829 <__umoddi3>:
+  803829:	83 ec 18             	sub    $0x18,%esp
+  80382c:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803830:	50                   	push   %eax
+  803831:	ff 74 24 2c          	push   0x2c(%esp)
+  803835:	ff 74 24 2c          	push   0x2c(%esp)
+  803839:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80383d:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803841:	e8 fc fe ff ff       	call   803742 <udivmod>
+  803846:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80384a:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80384e:	83 c4 24             	add    $0x24,%esp
+  803851:	c3                   	ret
+
+00803852 <__divdi3>:
+  803852:	56                   	push   %esi
+  803853:	53                   	push   %ebx
+  803854:	83 ec 14             	sub    $0x14,%esp
+  803857:	8b 44 24 20          	mov    0x20(%esp),%eax
+  80385b:	8b 54 24 24          	mov    0x24(%esp),%edx
+  80385f:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  803863:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  803867:	85 d2                	test   %edx,%edx
+  803869:	78 18                	js     803883 <__divdi3+0x31>
+  80386b:	85 db                	test   %ebx,%ebx
+  80386d:	78 3e                	js     8038ad <__divdi3+0x5b>
+  80386f:	83 ec 04             	sub    $0x4,%esp
+  803872:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803876:	56                   	push   %esi
+  803877:	53                   	push   %ebx
+  803878:	51                   	push   %ecx
+  803879:	e8 c4 fe ff ff       	call   803742 <udivmod>
+  80387e:	83 c4 10             	add    $0x10,%esp
+  803881:	eb 24                	jmp    8038a7 <__divdi3+0x55>
+  803883:	f7 d8                	neg    %eax
+  803885:	83 d2 00             	adc    $0x0,%edx
+  803888:	f7 da                	neg    %edx
+  80388a:	85 db                	test   %ebx,%ebx
+  80388c:	78 3a                	js     8038c8 <__divdi3+0x76>
+  80388e:	83 ec 04             	sub    $0x4,%esp
+  803891:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803895:	56                   	push   %esi
+  803896:	53                   	push   %ebx
+  803897:	51                   	push   %ecx
+  803898:	e8 a5 fe ff ff       	call   803742 <udivmod>
+  80389d:	83 c4 10             	add    $0x10,%esp
+  8038a0:	f7 d8                	neg    %eax
+  8038a2:	83 d2 00             	adc    $0x0,%edx
+  8038a5:	f7 da                	neg    %edx
+  8038a7:	83 c4 14             	add    $0x14,%esp
+  8038aa:	5b                   	pop    %ebx
+  8038ab:	5e                   	pop    %esi
+  8038ac:	c3                   	ret
+  8038ad:	83 ec 04             	sub    $0x4,%esp
+  8038b0:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8038b4:	56                   	push   %esi
+  8038b5:	f7 d9                	neg    %ecx
+  8038b7:	83 d3 00             	adc    $0x0,%ebx
+  8038ba:	f7 db                	neg    %ebx
+  8038bc:	53                   	push   %ebx
+  8038bd:	51                   	push   %ecx
+  8038be:	e8 7f fe ff ff       	call   803742 <udivmod>
+  8038c3:	83 c4 10             	add    $0x10,%esp
+  8038c6:	eb d8                	jmp    8038a0 <__divdi3+0x4e>
+  8038c8:	83 ec 04             	sub    $0x4,%esp
+  8038cb:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8038cf:	56                   	push   %esi
+  8038d0:	f7 d9                	neg    %ecx
+  8038d2:	83 d3 00             	adc    $0x0,%ebx
+  8038d5:	f7 db                	neg    %ebx
+  8038d7:	53                   	push   %ebx
+  8038d8:	51                   	push   %ecx
+  8038d9:	e8 64 fe ff ff       	call   803742 <udivmod>
+  8038de:	83 c4 10             	add    $0x10,%esp
+  8038e1:	eb c4                	jmp    8038a7 <__divdi3+0x55>
+
+008038e3 <__moddi3>:
+  8038e3:	55                   	push   %ebp
+  8038e4:	57                   	push   %edi
+  8038e5:	56                   	push   %esi
+  8038e6:	53                   	push   %ebx
+  8038e7:	83 ec 24             	sub    $0x24,%esp
+  8038ea:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8038ee:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8038f2:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  8038f6:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  8038fa:	85 d2                	test   %edx,%edx
+  8038fc:	78 3b                	js     803939 <__moddi3+0x56>
+  8038fe:	83 ec 04             	sub    $0x4,%esp
+  803901:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803905:	56                   	push   %esi
+  803906:	89 ce                	mov    %ecx,%esi
+  803908:	f7 de                	neg    %esi
+  80390a:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80390e:	89 de                	mov    %ebx,%esi
+  803910:	83 d6 00             	adc    $0x0,%esi
+  803913:	f7 de                	neg    %esi
+  803915:	89 74 24 14          	mov    %esi,0x14(%esp)
+  803919:	8b 74 24 08          	mov    0x8(%esp),%esi
+  80391d:	0f 48 f1             	cmovs  %ecx,%esi
+  803920:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  803925:	53                   	push   %ebx
+  803926:	56                   	push   %esi
+  803927:	e8 16 fe ff ff       	call   803742 <udivmod>
+  80392c:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803930:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803934:	83 c4 10             	add    $0x10,%esp
+  803937:	eb 47                	jmp    803980 <__moddi3+0x9d>
+  803939:	f7 d8                	neg    %eax
+  80393b:	83 d2 00             	adc    $0x0,%edx
+  80393e:	f7 da                	neg    %edx
+  803940:	83 ec 04             	sub    $0x4,%esp
+  803943:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803947:	56                   	push   %esi
+  803948:	89 cf                	mov    %ecx,%edi
+  80394a:	f7 df                	neg    %edi
+  80394c:	89 de                	mov    %ebx,%esi
+  80394e:	83 d6 00             	adc    $0x0,%esi
+  803951:	f7 de                	neg    %esi
+  803953:	0f 49 cf             	cmovns %edi,%ecx
+  803956:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  80395a:	0f 49 de             	cmovns %esi,%ebx
+  80395d:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  803961:	ff 74 24 0c          	push   0xc(%esp)
+  803965:	ff 74 24 0c          	push   0xc(%esp)
+  803969:	e8 d4 fd ff ff       	call   803742 <udivmod>
+  80396e:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803972:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803976:	f7 d8                	neg    %eax
+  803978:	83 d2 00             	adc    $0x0,%edx
+  80397b:	f7 da                	neg    %edx
+  80397d:	83 c4 10             	add    $0x10,%esp
+  803980:	83 c4 24             	add    $0x24,%esp
+  803983:	5b                   	pop    %ebx
+  803984:	5e                   	pop    %esi
+  803985:	5f                   	pop    %edi
+  803986:	5d                   	pop    %ebp
+  803987:	c3                   	ret
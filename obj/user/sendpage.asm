@@ -0,0 +1,7806 @@
+
+obj/user/sendpage.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 73 01 00 00       	call   8001a4 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#define TEMP_ADDR       ((char*)0xa00000)
+#define TEMP_ADDR_CHILD ((char*)0xb00000)
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 18             	sub    $0x18,%esp
+  envid_t who;
+
+  if ((who = fork()) == 0) {
+  800039:	e8 f2 12 00 00       	call   801330 <fork>
+  80003e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  800041:	85 c0                	test   %eax,%eax
+  800043:	0f 84 a5 00 00 00    	je     8000ee <umain+0xbb>
+    ipc_send(who, 0, TEMP_ADDR_CHILD, PTE_P | PTE_W | PTE_U);
+    return;
+  }
+
+  // Parent
+  sys_page_alloc(thisenv->env_id, TEMP_ADDR, PTE_P | PTE_W | PTE_U);
+  800049:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  80004e:	8b 40 48             	mov    0x48(%eax),%eax
+  800051:	83 ec 04             	sub    $0x4,%esp
+  800054:	6a 07                	push   $0x7
+  800056:	68 00 00 a0 00       	push   $0xa00000
+  80005b:	50                   	push   %eax
+  80005c:	e8 62 0c 00 00       	call   800cc3 <sys_page_alloc>
+  memcpy(TEMP_ADDR, str1, strlen(str1) + 1);
+  800061:	83 c4 04             	add    $0x4,%esp
+  800064:	ff 35 04 50 80 00    	push   0x805004
+  80006a:	e8 ea 07 00 00       	call   800859 <strlen>
+  80006f:	83 c4 0c             	add    $0xc,%esp
+  800072:	83 c0 01             	add    $0x1,%eax
+  800075:	50                   	push   %eax
+  800076:	ff 35 04 50 80 00    	push   0x805004
+  80007c:	68 00 00 a0 00       	push   $0xa00000
+  800081:	e8 f6 09 00 00       	call   800a7c <memcpy>
+  ipc_send(who, 0, TEMP_ADDR, PTE_P | PTE_W | PTE_U);
+  800086:	6a 07                	push   $0x7
+  800088:	68 00 00 a0 00       	push   $0xa00000
+  80008d:	6a 00                	push   $0x0
+  80008f:	ff 75 f4             	push   -0xc(%ebp)
+  800092:	e8 15 16 00 00       	call   8016ac <ipc_send>
+
+  ipc_recv(&who, TEMP_ADDR, 0);
+  800097:	83 c4 1c             	add    $0x1c,%esp
+  80009a:	6a 00                	push   $0x0
+  80009c:	68 00 00 a0 00       	push   $0xa00000
+  8000a1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8000a4:	50                   	push   %eax
+  8000a5:	e8 7f 15 00 00       	call   801629 <ipc_recv>
+  cprintf("%x got message: %s\n", who, TEMP_ADDR);
+  8000aa:	83 c4 0c             	add    $0xc,%esp
+  8000ad:	68 00 00 a0 00       	push   $0xa00000
+  8000b2:	ff 75 f4             	push   -0xc(%ebp)
+  8000b5:	68 80 3a 80 00       	push   $0x803a80
+  8000ba:	e8 e7 01 00 00       	call   8002a6 <cprintf>
+  if (strncmp(TEMP_ADDR, str2, strlen(str2)) == 0)
+  8000bf:	83 c4 04             	add    $0x4,%esp
+  8000c2:	ff 35 00 50 80 00    	push   0x805000
+  8000c8:	e8 8c 07 00 00       	call   800859 <strlen>
+  8000cd:	83 c4 0c             	add    $0xc,%esp
+  8000d0:	50                   	push   %eax
+  8000d1:	ff 35 00 50 80 00    	push   0x805000
+  8000d7:	68 00 00 a0 00       	push   $0xa00000
+  8000dc:	e8 8a 08 00 00       	call   80096b <strncmp>
+  8000e1:	83 c4 10             	add    $0x10,%esp
+  8000e4:	85 c0                	test   %eax,%eax
+  8000e6:	0f 84 a3 00 00 00    	je     80018f <umain+0x15c>
+    cprintf("parent received correct message\n");
+  return;
+}
+  8000ec:	c9                   	leave
+  8000ed:	c3                   	ret
+    ipc_recv(&who, TEMP_ADDR_CHILD, 0);
+  8000ee:	83 ec 04             	sub    $0x4,%esp
+  8000f1:	6a 00                	push   $0x0
+  8000f3:	68 00 00 b0 00       	push   $0xb00000
+  8000f8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8000fb:	50                   	push   %eax
+  8000fc:	e8 28 15 00 00       	call   801629 <ipc_recv>
+    cprintf("%x got message: %s\n", who, TEMP_ADDR_CHILD);
+  800101:	83 c4 0c             	add    $0xc,%esp
+  800104:	68 00 00 b0 00       	push   $0xb00000
+  800109:	ff 75 f4             	push   -0xc(%ebp)
+  80010c:	68 80 3a 80 00       	push   $0x803a80
+  800111:	e8 90 01 00 00       	call   8002a6 <cprintf>
+    if (strncmp(TEMP_ADDR_CHILD, str1, strlen(str1)) == 0)
+  800116:	83 c4 04             	add    $0x4,%esp
+  800119:	ff 35 04 50 80 00    	push   0x805004
+  80011f:	e8 35 07 00 00       	call   800859 <strlen>
+  800124:	83 c4 0c             	add    $0xc,%esp
+  800127:	50                   	push   %eax
+  800128:	ff 35 04 50 80 00    	push   0x805004
+  80012e:	68 00 00 b0 00       	push   $0xb00000
+  800133:	e8 33 08 00 00       	call   80096b <strncmp>
+  800138:	83 c4 10             	add    $0x10,%esp
+  80013b:	85 c0                	test   %eax,%eax
+  80013d:	74 3e                	je     80017d <umain+0x14a>
+    memcpy(TEMP_ADDR_CHILD, str2, strlen(str2) + 1);
+  80013f:	83 ec 0c             	sub    $0xc,%esp
+  800142:	ff 35 00 50 80 00    	push   0x805000
+  800148:	e8 0c 07 00 00       	call   800859 <strlen>
+  80014d:	83 c4 0c             	add    $0xc,%esp
+  800150:	83 c0 01             	add    $0x1,%eax
+  800153:	50                   	push   %eax
+  800154:	ff 35 00 50 80 00    	push   0x805000
+  80015a:	68 00 00 b0 00       	push   $0xb00000
+  80015f:	e8 18 09 00 00       	call   800a7c <memcpy>
+    ipc_send(who, 0, TEMP_ADDR_CHILD, PTE_P | PTE_W | PTE_U);
+  800164:	6a 07                	push   $0x7
+  800166:	68 00 00 b0 00       	push   $0xb00000
+  80016b:	6a 00                	push   $0x0
+  80016d:	ff 75 f4             	push   -0xc(%ebp)
+  800170:	e8 37 15 00 00       	call   8016ac <ipc_send>
+    return;
+  800175:	83 c4 20             	add    $0x20,%esp
+  800178:	e9 6f ff ff ff       	jmp    8000ec <umain+0xb9>
+      cprintf("child received correct message\n");
+  80017d:	83 ec 0c             	sub    $0xc,%esp
+  800180:	68 94 3a 80 00       	push   $0x803a94
+  800185:	e8 1c 01 00 00       	call   8002a6 <cprintf>
+  80018a:	83 c4 10             	add    $0x10,%esp
+  80018d:	eb b0                	jmp    80013f <umain+0x10c>
+    cprintf("parent received correct message\n");
+  80018f:	83 ec 0c             	sub    $0xc,%esp
+  800192:	68 b4 3a 80 00       	push   $0x803ab4
+  800197:	e8 0a 01 00 00       	call   8002a6 <cprintf>
+  80019c:	83 c4 10             	add    $0x10,%esp
+  80019f:	e9 48 ff ff ff       	jmp    8000ec <umain+0xb9>
+
+008001a4 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8001a4:	55                   	push   %ebp
+  8001a5:	89 e5                	mov    %esp,%ebp
+  8001a7:	56                   	push   %esi
+  8001a8:	53                   	push   %ebx
+  8001a9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8001ac:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  8001af:	c7 05 a0 68 80 00 00 	movl   $0x0,0x8068a0
+  8001b6:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  8001b9:	e8 84 0a 00 00       	call   800c42 <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  8001be:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001c3:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8001c6:	c1 e0 04             	shl    $0x4,%eax
+  8001c9:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8001ce:	a3 a0 68 80 00       	mov    %eax,0x8068a0
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8001d3:	85 db                	test   %ebx,%ebx
+  8001d5:	7e 07                	jle    8001de <libmain+0x3a>
+    binaryname = argv[0];
+  8001d7:	8b 06                	mov    (%esi),%eax
+  8001d9:	a3 08 50 80 00       	mov    %eax,0x805008
+
+  // call user main routine
+  umain(argc, argv);
+  8001de:	83 ec 08             	sub    $0x8,%esp
+  8001e1:	56                   	push   %esi
+  8001e2:	53                   	push   %ebx
+  8001e3:	e8 4b fe ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  8001e8:	e8 0a 00 00 00       	call   8001f7 <exit>
+}
+  8001ed:	83 c4 10             	add    $0x10,%esp
+  8001f0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8001f3:	5b                   	pop    %ebx
+  8001f4:	5e                   	pop    %esi
+  8001f5:	5d                   	pop    %ebp
+  8001f6:	c3                   	ret
+
+008001f7 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8001f7:	55                   	push   %ebp
+  8001f8:	89 e5                	mov    %esp,%ebp
+  8001fa:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  8001fd:	e8 d1 16 00 00       	call   8018d3 <close_all>
+  sys_env_destroy(0);
+  800202:	83 ec 0c             	sub    $0xc,%esp
+  800205:	6a 00                	push   $0x0
+  800207:	e8 f5 09 00 00       	call   800c01 <sys_env_destroy>
+}
+  80020c:	83 c4 10             	add    $0x10,%esp
+  80020f:	c9                   	leave
+  800210:	c3                   	ret
+
+00800211 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800211:	55                   	push   %ebp
+  800212:	89 e5                	mov    %esp,%ebp
+  800214:	53                   	push   %ebx
+  800215:	83 ec 04             	sub    $0x4,%esp
+  800218:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  80021b:	8b 13                	mov    (%ebx),%edx
+  80021d:	8d 42 01             	lea    0x1(%edx),%eax
+  800220:	89 03                	mov    %eax,(%ebx)
+  800222:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800225:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  800229:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80022e:	74 09                	je     800239 <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  800230:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800234:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800237:	c9                   	leave
+  800238:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  800239:	83 ec 08             	sub    $0x8,%esp
+  80023c:	68 ff 00 00 00       	push   $0xff
+  800241:	8d 43 08             	lea    0x8(%ebx),%eax
+  800244:	50                   	push   %eax
+  800245:	e8 7a 09 00 00       	call   800bc4 <sys_cputs>
+    b->idx = 0;
+  80024a:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800250:	83 c4 10             	add    $0x10,%esp
+  800253:	eb db                	jmp    800230 <putch+0x1f>
+
+00800255 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800255:	55                   	push   %ebp
+  800256:	89 e5                	mov    %esp,%ebp
+  800258:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  80025e:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800265:	00 00 00 
+  b.cnt = 0;
+  800268:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80026f:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  800272:	ff 75 0c             	push   0xc(%ebp)
+  800275:	ff 75 08             	push   0x8(%ebp)
+  800278:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80027e:	50                   	push   %eax
+  80027f:	68 11 02 80 00       	push   $0x800211
+  800284:	e8 14 01 00 00       	call   80039d <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  800289:	83 c4 08             	add    $0x8,%esp
+  80028c:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800292:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800298:	50                   	push   %eax
+  800299:	e8 26 09 00 00       	call   800bc4 <sys_cputs>
+
+  return b.cnt;
+}
+  80029e:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8002a4:	c9                   	leave
+  8002a5:	c3                   	ret
+
+008002a6 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8002a6:	55                   	push   %ebp
+  8002a7:	89 e5                	mov    %esp,%ebp
+  8002a9:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  8002ac:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  8002af:	50                   	push   %eax
+  8002b0:	ff 75 08             	push   0x8(%ebp)
+  8002b3:	e8 9d ff ff ff       	call   800255 <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  8002b8:	c9                   	leave
+  8002b9:	c3                   	ret
+
+008002ba <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  8002ba:	55                   	push   %ebp
+  8002bb:	89 e5                	mov    %esp,%ebp
+  8002bd:	57                   	push   %edi
+  8002be:	56                   	push   %esi
+  8002bf:	53                   	push   %ebx
+  8002c0:	83 ec 1c             	sub    $0x1c,%esp
+  8002c3:	89 c7                	mov    %eax,%edi
+  8002c5:	89 d6                	mov    %edx,%esi
+  8002c7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002ca:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8002cd:	89 d1                	mov    %edx,%ecx
+  8002cf:	89 c2                	mov    %eax,%edx
+  8002d1:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8002d4:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8002d7:	8b 45 10             	mov    0x10(%ebp),%eax
+  8002da:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  8002dd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8002e0:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8002e7:	39 c2                	cmp    %eax,%edx
+  8002e9:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8002ec:	72 3e                	jb     80032c <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  8002ee:	83 ec 0c             	sub    $0xc,%esp
+  8002f1:	ff 75 18             	push   0x18(%ebp)
+  8002f4:	83 eb 01             	sub    $0x1,%ebx
+  8002f7:	53                   	push   %ebx
+  8002f8:	50                   	push   %eax
+  8002f9:	83 ec 08             	sub    $0x8,%esp
+  8002fc:	ff 75 e4             	push   -0x1c(%ebp)
+  8002ff:	ff 75 e0             	push   -0x20(%ebp)
+  800302:	ff 75 dc             	push   -0x24(%ebp)
+  800305:	ff 75 d8             	push   -0x28(%ebp)
+  800308:	e8 d6 35 00 00       	call   8038e3 <__udivdi3>
+  80030d:	83 c4 18             	add    $0x18,%esp
+  800310:	52                   	push   %edx
+  800311:	50                   	push   %eax
+  800312:	89 f2                	mov    %esi,%edx
+  800314:	89 f8                	mov    %edi,%eax
+  800316:	e8 9f ff ff ff       	call   8002ba <printnum>
+  80031b:	83 c4 20             	add    $0x20,%esp
+  80031e:	eb 13                	jmp    800333 <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  800320:	83 ec 08             	sub    $0x8,%esp
+  800323:	56                   	push   %esi
+  800324:	ff 75 18             	push   0x18(%ebp)
+  800327:	ff d7                	call   *%edi
+  800329:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  80032c:	83 eb 01             	sub    $0x1,%ebx
+  80032f:	85 db                	test   %ebx,%ebx
+  800331:	7f ed                	jg     800320 <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  800333:	83 ec 08             	sub    $0x8,%esp
+  800336:	56                   	push   %esi
+  800337:	83 ec 04             	sub    $0x4,%esp
+  80033a:	ff 75 e4             	push   -0x1c(%ebp)
+  80033d:	ff 75 e0             	push   -0x20(%ebp)
+  800340:	ff 75 dc             	push   -0x24(%ebp)
+  800343:	ff 75 d8             	push   -0x28(%ebp)
+  800346:	e8 b9 35 00 00       	call   803904 <__umoddi3>
+  80034b:	83 c4 14             	add    $0x14,%esp
+  80034e:	0f be 80 2c 3b 80 00 	movsbl 0x803b2c(%eax),%eax
+  800355:	50                   	push   %eax
+  800356:	ff d7                	call   *%edi
+}
+  800358:	83 c4 10             	add    $0x10,%esp
+  80035b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80035e:	5b                   	pop    %ebx
+  80035f:	5e                   	pop    %esi
+  800360:	5f                   	pop    %edi
+  800361:	5d                   	pop    %ebp
+  800362:	c3                   	ret
+
+00800363 <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800363:	55                   	push   %ebp
+  800364:	89 e5                	mov    %esp,%ebp
+  800366:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  800369:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  80036d:	8b 10                	mov    (%eax),%edx
+  80036f:	3b 50 04             	cmp    0x4(%eax),%edx
+  800372:	73 0a                	jae    80037e <sprintputch+0x1b>
+    *b->buf++ = ch;
+  800374:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800377:	89 08                	mov    %ecx,(%eax)
+  800379:	8b 45 08             	mov    0x8(%ebp),%eax
+  80037c:	88 02                	mov    %al,(%edx)
+}
+  80037e:	5d                   	pop    %ebp
+  80037f:	c3                   	ret
+
+00800380 <printfmt>:
+{
+  800380:	55                   	push   %ebp
+  800381:	89 e5                	mov    %esp,%ebp
+  800383:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  800386:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  800389:	50                   	push   %eax
+  80038a:	ff 75 10             	push   0x10(%ebp)
+  80038d:	ff 75 0c             	push   0xc(%ebp)
+  800390:	ff 75 08             	push   0x8(%ebp)
+  800393:	e8 05 00 00 00       	call   80039d <vprintfmt>
+}
+  800398:	83 c4 10             	add    $0x10,%esp
+  80039b:	c9                   	leave
+  80039c:	c3                   	ret
+
+0080039d <vprintfmt>:
+{
+  80039d:	55                   	push   %ebp
+  80039e:	89 e5                	mov    %esp,%ebp
+  8003a0:	57                   	push   %edi
+  8003a1:	56                   	push   %esi
+  8003a2:	53                   	push   %ebx
+  8003a3:	83 ec 2c             	sub    $0x2c,%esp
+  8003a6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8003a9:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8003ac:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8003af:	eb 0a                	jmp    8003bb <vprintfmt+0x1e>
+      putch(ch, putdat);
+  8003b1:	83 ec 08             	sub    $0x8,%esp
+  8003b4:	53                   	push   %ebx
+  8003b5:	50                   	push   %eax
+  8003b6:	ff d6                	call   *%esi
+  8003b8:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  8003bb:	83 c7 01             	add    $0x1,%edi
+  8003be:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8003c2:	83 f8 25             	cmp    $0x25,%eax
+  8003c5:	74 0c                	je     8003d3 <vprintfmt+0x36>
+      if (ch == '\0')
+  8003c7:	85 c0                	test   %eax,%eax
+  8003c9:	75 e6                	jne    8003b1 <vprintfmt+0x14>
+}
+  8003cb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003ce:	5b                   	pop    %ebx
+  8003cf:	5e                   	pop    %esi
+  8003d0:	5f                   	pop    %edi
+  8003d1:	5d                   	pop    %ebp
+  8003d2:	c3                   	ret
+    padc = ' ';
+  8003d3:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  8003d7:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  8003de:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  8003e5:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  8003ec:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  8003f1:	8d 47 01             	lea    0x1(%edi),%eax
+  8003f4:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8003f7:	0f b6 17             	movzbl (%edi),%edx
+  8003fa:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8003fd:	3c 55                	cmp    $0x55,%al
+  8003ff:	0f 87 cf 03 00 00    	ja     8007d4 <vprintfmt+0x437>
+  800405:	0f b6 c0             	movzbl %al,%eax
+  800408:	ff 24 85 80 3c 80 00 	jmp    *0x803c80(,%eax,4)
+  80040f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  800412:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800416:	eb d9                	jmp    8003f1 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  800418:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80041b:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80041f:	eb d0                	jmp    8003f1 <vprintfmt+0x54>
+  800421:	0f b6 d2             	movzbl %dl,%edx
+  800424:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  800427:	b8 00 00 00 00       	mov    $0x0,%eax
+  80042c:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  80042f:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800432:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  800436:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  800439:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80043c:	83 f9 09             	cmp    $0x9,%ecx
+  80043f:	77 55                	ja     800496 <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  800441:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  800444:	eb e9                	jmp    80042f <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  800446:	8b 45 14             	mov    0x14(%ebp),%eax
+  800449:	8b 00                	mov    (%eax),%eax
+  80044b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80044e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800451:	8d 40 04             	lea    0x4(%eax),%eax
+  800454:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  800457:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  80045a:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80045e:	79 91                	jns    8003f1 <vprintfmt+0x54>
+        width = precision, precision = -1;
+  800460:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800463:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800466:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80046d:	eb 82                	jmp    8003f1 <vprintfmt+0x54>
+      if (width < 0)
+  80046f:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800472:	85 d2                	test   %edx,%edx
+  800474:	b8 00 00 00 00       	mov    $0x0,%eax
+  800479:	0f 49 c2             	cmovns %edx,%eax
+  80047c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  80047f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  800482:	e9 6a ff ff ff       	jmp    8003f1 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  800487:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  80048a:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  800491:	e9 5b ff ff ff       	jmp    8003f1 <vprintfmt+0x54>
+  800496:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800499:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80049c:	eb bc                	jmp    80045a <vprintfmt+0xbd>
+      lflag++;
+  80049e:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  8004a1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  8004a4:	e9 48 ff ff ff       	jmp    8003f1 <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  8004a9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004ac:	8d 78 04             	lea    0x4(%eax),%edi
+  8004af:	83 ec 08             	sub    $0x8,%esp
+  8004b2:	53                   	push   %ebx
+  8004b3:	ff 30                	push   (%eax)
+  8004b5:	ff d6                	call   *%esi
+      break;
+  8004b7:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  8004ba:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  8004bd:	e9 b1 02 00 00       	jmp    800773 <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  8004c2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004c5:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  8004c8:	8b 10                	mov    (%eax),%edx
+  8004ca:	89 d0                	mov    %edx,%eax
+  8004cc:	f7 d8                	neg    %eax
+  8004ce:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8004d1:	83 f8 10             	cmp    $0x10,%eax
+  8004d4:	7f 23                	jg     8004f9 <vprintfmt+0x15c>
+  8004d6:	8b 14 85 e0 3d 80 00 	mov    0x803de0(,%eax,4),%edx
+  8004dd:	85 d2                	test   %edx,%edx
+  8004df:	74 18                	je     8004f9 <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  8004e1:	52                   	push   %edx
+  8004e2:	68 0e 40 80 00       	push   $0x80400e
+  8004e7:	53                   	push   %ebx
+  8004e8:	56                   	push   %esi
+  8004e9:	e8 92 fe ff ff       	call   800380 <printfmt>
+  8004ee:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  8004f1:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8004f4:	e9 7a 02 00 00       	jmp    800773 <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  8004f9:	50                   	push   %eax
+  8004fa:	68 44 3b 80 00       	push   $0x803b44
+  8004ff:	53                   	push   %ebx
+  800500:	56                   	push   %esi
+  800501:	e8 7a fe ff ff       	call   800380 <printfmt>
+  800506:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  800509:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  80050c:	e9 62 02 00 00       	jmp    800773 <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  800511:	8b 45 14             	mov    0x14(%ebp),%eax
+  800514:	83 c0 04             	add    $0x4,%eax
+  800517:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80051a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80051d:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  80051f:	85 c9                	test   %ecx,%ecx
+  800521:	b8 3d 3b 80 00       	mov    $0x803b3d,%eax
+  800526:	0f 45 c1             	cmovne %ecx,%eax
+  800529:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  80052c:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800530:	7e 06                	jle    800538 <vprintfmt+0x19b>
+  800532:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800536:	75 0b                	jne    800543 <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800538:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80053b:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80053e:	89 75 08             	mov    %esi,0x8(%ebp)
+  800541:	eb 5c                	jmp    80059f <vprintfmt+0x202>
+  800543:	83 ec 08             	sub    $0x8,%esp
+  800546:	ff 75 d0             	push   -0x30(%ebp)
+  800549:	ff 75 cc             	push   -0x34(%ebp)
+  80054c:	e8 20 03 00 00       	call   800871 <strnlen>
+  800551:	89 c2                	mov    %eax,%edx
+  800553:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800556:	29 d0                	sub    %edx,%eax
+  800558:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  80055b:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80055f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800562:	89 75 08             	mov    %esi,0x8(%ebp)
+  800565:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800567:	eb 0e                	jmp    800577 <vprintfmt+0x1da>
+          putch(padc, putdat);
+  800569:	83 ec 08             	sub    $0x8,%esp
+  80056c:	53                   	push   %ebx
+  80056d:	57                   	push   %edi
+  80056e:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800571:	83 ee 01             	sub    $0x1,%esi
+  800574:	83 c4 10             	add    $0x10,%esp
+  800577:	85 f6                	test   %esi,%esi
+  800579:	7f ee                	jg     800569 <vprintfmt+0x1cc>
+  80057b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80057e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800581:	85 c0                	test   %eax,%eax
+  800583:	ba 00 00 00 00       	mov    $0x0,%edx
+  800588:	0f 49 d0             	cmovns %eax,%edx
+  80058b:	29 d0                	sub    %edx,%eax
+  80058d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800590:	eb a6                	jmp    800538 <vprintfmt+0x19b>
+          putch(ch, putdat);
+  800592:	83 ec 08             	sub    $0x8,%esp
+  800595:	53                   	push   %ebx
+  800596:	52                   	push   %edx
+  800597:	ff 55 08             	call   *0x8(%ebp)
+  80059a:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80059d:	89 f1                	mov    %esi,%ecx
+  80059f:	8d 71 01             	lea    0x1(%ecx),%esi
+  8005a2:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8005a6:	0f be d0             	movsbl %al,%edx
+  8005a9:	85 d2                	test   %edx,%edx
+  8005ab:	74 28                	je     8005d5 <vprintfmt+0x238>
+  8005ad:	85 ff                	test   %edi,%edi
+  8005af:	78 05                	js     8005b6 <vprintfmt+0x219>
+  8005b1:	83 ef 01             	sub    $0x1,%edi
+  8005b4:	78 30                	js     8005e6 <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  8005b6:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8005ba:	74 d6                	je     800592 <vprintfmt+0x1f5>
+  8005bc:	0f be c0             	movsbl %al,%eax
+  8005bf:	83 e8 20             	sub    $0x20,%eax
+  8005c2:	83 f8 5e             	cmp    $0x5e,%eax
+  8005c5:	76 cb                	jbe    800592 <vprintfmt+0x1f5>
+          putch('?', putdat);
+  8005c7:	83 ec 08             	sub    $0x8,%esp
+  8005ca:	53                   	push   %ebx
+  8005cb:	6a 3f                	push   $0x3f
+  8005cd:	ff 55 08             	call   *0x8(%ebp)
+  8005d0:	83 c4 10             	add    $0x10,%esp
+  8005d3:	eb c8                	jmp    80059d <vprintfmt+0x200>
+  8005d5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005d8:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8005db:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8005de:	01 d0                	add    %edx,%eax
+  8005e0:	29 c8                	sub    %ecx,%eax
+  8005e2:	89 c7                	mov    %eax,%edi
+  8005e4:	eb 13                	jmp    8005f9 <vprintfmt+0x25c>
+  8005e6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005e9:	eb ed                	jmp    8005d8 <vprintfmt+0x23b>
+        putch(' ', putdat);
+  8005eb:	83 ec 08             	sub    $0x8,%esp
+  8005ee:	53                   	push   %ebx
+  8005ef:	6a 20                	push   $0x20
+  8005f1:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  8005f3:	83 ef 01             	sub    $0x1,%edi
+  8005f6:	83 c4 10             	add    $0x10,%esp
+  8005f9:	85 ff                	test   %edi,%edi
+  8005fb:	7f ee                	jg     8005eb <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  8005fd:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800600:	89 45 14             	mov    %eax,0x14(%ebp)
+  800603:	e9 6b 01 00 00       	jmp    800773 <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  800608:	83 f9 01             	cmp    $0x1,%ecx
+  80060b:	7f 1f                	jg     80062c <vprintfmt+0x28f>
+  else if (lflag)
+  80060d:	85 c9                	test   %ecx,%ecx
+  80060f:	74 67                	je     800678 <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  800611:	8b 45 14             	mov    0x14(%ebp),%eax
+  800614:	8b 00                	mov    (%eax),%eax
+  800616:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800619:	89 c1                	mov    %eax,%ecx
+  80061b:	c1 f9 1f             	sar    $0x1f,%ecx
+  80061e:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800621:	8b 45 14             	mov    0x14(%ebp),%eax
+  800624:	8d 40 04             	lea    0x4(%eax),%eax
+  800627:	89 45 14             	mov    %eax,0x14(%ebp)
+  80062a:	eb 17                	jmp    800643 <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  80062c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80062f:	8b 50 04             	mov    0x4(%eax),%edx
+  800632:	8b 00                	mov    (%eax),%eax
+  800634:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800637:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80063a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80063d:	8d 40 08             	lea    0x8(%eax),%eax
+  800640:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  800643:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800646:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  800649:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  80064e:	85 c9                	test   %ecx,%ecx
+  800650:	0f 89 03 01 00 00    	jns    800759 <vprintfmt+0x3bc>
+        putch('-', putdat);
+  800656:	83 ec 08             	sub    $0x8,%esp
+  800659:	53                   	push   %ebx
+  80065a:	6a 2d                	push   $0x2d
+  80065c:	ff d6                	call   *%esi
+        num = -(long long)num;
+  80065e:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800661:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800664:	f7 da                	neg    %edx
+  800666:	83 d1 00             	adc    $0x0,%ecx
+  800669:	f7 d9                	neg    %ecx
+  80066b:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  80066e:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800673:	e9 e1 00 00 00       	jmp    800759 <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  800678:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067b:	8b 00                	mov    (%eax),%eax
+  80067d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800680:	89 c1                	mov    %eax,%ecx
+  800682:	c1 f9 1f             	sar    $0x1f,%ecx
+  800685:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800688:	8b 45 14             	mov    0x14(%ebp),%eax
+  80068b:	8d 40 04             	lea    0x4(%eax),%eax
+  80068e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800691:	eb b0                	jmp    800643 <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  800693:	83 f9 01             	cmp    $0x1,%ecx
+  800696:	7f 1e                	jg     8006b6 <vprintfmt+0x319>
+  else if (lflag)
+  800698:	85 c9                	test   %ecx,%ecx
+  80069a:	74 32                	je     8006ce <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  80069c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069f:	8b 10                	mov    (%eax),%edx
+  8006a1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006a6:	8d 40 04             	lea    0x4(%eax),%eax
+  8006a9:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  8006ac:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  8006b1:	e9 a3 00 00 00       	jmp    800759 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  8006b6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006b9:	8b 10                	mov    (%eax),%edx
+  8006bb:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006be:	8d 40 08             	lea    0x8(%eax),%eax
+  8006c1:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  8006c4:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  8006c9:	e9 8b 00 00 00       	jmp    800759 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8006ce:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d1:	8b 10                	mov    (%eax),%edx
+  8006d3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006d8:	8d 40 04             	lea    0x4(%eax),%eax
+  8006db:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  8006de:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  8006e3:	eb 74                	jmp    800759 <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  8006e5:	83 f9 01             	cmp    $0x1,%ecx
+  8006e8:	7f 1b                	jg     800705 <vprintfmt+0x368>
+  else if (lflag)
+  8006ea:	85 c9                	test   %ecx,%ecx
+  8006ec:	74 2c                	je     80071a <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  8006ee:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f1:	8b 10                	mov    (%eax),%edx
+  8006f3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006f8:	8d 40 04             	lea    0x4(%eax),%eax
+  8006fb:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8006fe:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  800703:	eb 54                	jmp    800759 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800705:	8b 45 14             	mov    0x14(%ebp),%eax
+  800708:	8b 10                	mov    (%eax),%edx
+  80070a:	8b 48 04             	mov    0x4(%eax),%ecx
+  80070d:	8d 40 08             	lea    0x8(%eax),%eax
+  800710:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800713:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  800718:	eb 3f                	jmp    800759 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  80071a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071d:	8b 10                	mov    (%eax),%edx
+  80071f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800724:	8d 40 04             	lea    0x4(%eax),%eax
+  800727:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  80072a:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  80072f:	eb 28                	jmp    800759 <vprintfmt+0x3bc>
+      putch('0', putdat);
+  800731:	83 ec 08             	sub    $0x8,%esp
+  800734:	53                   	push   %ebx
+  800735:	6a 30                	push   $0x30
+  800737:	ff d6                	call   *%esi
+      putch('x', putdat);
+  800739:	83 c4 08             	add    $0x8,%esp
+  80073c:	53                   	push   %ebx
+  80073d:	6a 78                	push   $0x78
+  80073f:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  800741:	8b 45 14             	mov    0x14(%ebp),%eax
+  800744:	8b 10                	mov    (%eax),%edx
+  800746:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  80074b:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  80074e:	8d 40 04             	lea    0x4(%eax),%eax
+  800751:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800754:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  800759:	83 ec 0c             	sub    $0xc,%esp
+  80075c:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800760:	50                   	push   %eax
+  800761:	ff 75 e0             	push   -0x20(%ebp)
+  800764:	57                   	push   %edi
+  800765:	51                   	push   %ecx
+  800766:	52                   	push   %edx
+  800767:	89 da                	mov    %ebx,%edx
+  800769:	89 f0                	mov    %esi,%eax
+  80076b:	e8 4a fb ff ff       	call   8002ba <printnum>
+      break;
+  800770:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  800773:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  800776:	e9 40 fc ff ff       	jmp    8003bb <vprintfmt+0x1e>
+  if (lflag >= 2)
+  80077b:	83 f9 01             	cmp    $0x1,%ecx
+  80077e:	7f 1b                	jg     80079b <vprintfmt+0x3fe>
+  else if (lflag)
+  800780:	85 c9                	test   %ecx,%ecx
+  800782:	74 2c                	je     8007b0 <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  800784:	8b 45 14             	mov    0x14(%ebp),%eax
+  800787:	8b 10                	mov    (%eax),%edx
+  800789:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80078e:	8d 40 04             	lea    0x4(%eax),%eax
+  800791:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800794:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  800799:	eb be                	jmp    800759 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  80079b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80079e:	8b 10                	mov    (%eax),%edx
+  8007a0:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007a3:	8d 40 08             	lea    0x8(%eax),%eax
+  8007a6:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8007a9:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  8007ae:	eb a9                	jmp    800759 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8007b0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b3:	8b 10                	mov    (%eax),%edx
+  8007b5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007ba:	8d 40 04             	lea    0x4(%eax),%eax
+  8007bd:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8007c0:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  8007c5:	eb 92                	jmp    800759 <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  8007c7:	83 ec 08             	sub    $0x8,%esp
+  8007ca:	53                   	push   %ebx
+  8007cb:	6a 25                	push   $0x25
+  8007cd:	ff d6                	call   *%esi
+      break;
+  8007cf:	83 c4 10             	add    $0x10,%esp
+  8007d2:	eb 9f                	jmp    800773 <vprintfmt+0x3d6>
+      putch('%', putdat);
+  8007d4:	83 ec 08             	sub    $0x8,%esp
+  8007d7:	53                   	push   %ebx
+  8007d8:	6a 25                	push   $0x25
+  8007da:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  8007dc:	83 c4 10             	add    $0x10,%esp
+  8007df:	89 f8                	mov    %edi,%eax
+  8007e1:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8007e5:	74 05                	je     8007ec <vprintfmt+0x44f>
+  8007e7:	83 e8 01             	sub    $0x1,%eax
+  8007ea:	eb f5                	jmp    8007e1 <vprintfmt+0x444>
+  8007ec:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8007ef:	eb 82                	jmp    800773 <vprintfmt+0x3d6>
+
+008007f1 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8007f1:	55                   	push   %ebp
+  8007f2:	89 e5                	mov    %esp,%ebp
+  8007f4:	83 ec 18             	sub    $0x18,%esp
+  8007f7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007fa:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  8007fd:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800800:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800804:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800807:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  80080e:	85 c0                	test   %eax,%eax
+  800810:	74 26                	je     800838 <vsnprintf+0x47>
+  800812:	85 d2                	test   %edx,%edx
+  800814:	7e 22                	jle    800838 <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800816:	ff 75 14             	push   0x14(%ebp)
+  800819:	ff 75 10             	push   0x10(%ebp)
+  80081c:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80081f:	50                   	push   %eax
+  800820:	68 63 03 80 00       	push   $0x800363
+  800825:	e8 73 fb ff ff       	call   80039d <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  80082a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80082d:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  800830:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800833:	83 c4 10             	add    $0x10,%esp
+}
+  800836:	c9                   	leave
+  800837:	c3                   	ret
+    return -E_INVAL;
+  800838:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80083d:	eb f7                	jmp    800836 <vsnprintf+0x45>
+
+0080083f <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80083f:	55                   	push   %ebp
+  800840:	89 e5                	mov    %esp,%ebp
+  800842:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  800845:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  800848:	50                   	push   %eax
+  800849:	ff 75 10             	push   0x10(%ebp)
+  80084c:	ff 75 0c             	push   0xc(%ebp)
+  80084f:	ff 75 08             	push   0x8(%ebp)
+  800852:	e8 9a ff ff ff       	call   8007f1 <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  800857:	c9                   	leave
+  800858:	c3                   	ret
+
+00800859 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800859:	55                   	push   %ebp
+  80085a:	89 e5                	mov    %esp,%ebp
+  80085c:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  80085f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800864:	eb 03                	jmp    800869 <strlen+0x10>
+    n++;
+  800866:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  800869:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80086d:	75 f7                	jne    800866 <strlen+0xd>
+  return n;
+}
+  80086f:	5d                   	pop    %ebp
+  800870:	c3                   	ret
+
+00800871 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800871:	55                   	push   %ebp
+  800872:	89 e5                	mov    %esp,%ebp
+  800874:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800877:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80087a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80087f:	eb 03                	jmp    800884 <strnlen+0x13>
+    n++;
+  800881:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800884:	39 d0                	cmp    %edx,%eax
+  800886:	74 08                	je     800890 <strnlen+0x1f>
+  800888:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80088c:	75 f3                	jne    800881 <strnlen+0x10>
+  80088e:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  800890:	89 d0                	mov    %edx,%eax
+  800892:	5d                   	pop    %ebp
+  800893:	c3                   	ret
+
+00800894 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800894:	55                   	push   %ebp
+  800895:	89 e5                	mov    %esp,%ebp
+  800897:	53                   	push   %ebx
+  800898:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80089b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  80089e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008a3:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8008a7:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8008aa:	83 c0 01             	add    $0x1,%eax
+  8008ad:	84 d2                	test   %dl,%dl
+  8008af:	75 f2                	jne    8008a3 <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  8008b1:	89 c8                	mov    %ecx,%eax
+  8008b3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008b6:	c9                   	leave
+  8008b7:	c3                   	ret
+
+008008b8 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8008b8:	55                   	push   %ebp
+  8008b9:	89 e5                	mov    %esp,%ebp
+  8008bb:	53                   	push   %ebx
+  8008bc:	83 ec 10             	sub    $0x10,%esp
+  8008bf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  8008c2:	53                   	push   %ebx
+  8008c3:	e8 91 ff ff ff       	call   800859 <strlen>
+  8008c8:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  8008cb:	ff 75 0c             	push   0xc(%ebp)
+  8008ce:	01 d8                	add    %ebx,%eax
+  8008d0:	50                   	push   %eax
+  8008d1:	e8 be ff ff ff       	call   800894 <strcpy>
+  return dst;
+}
+  8008d6:	89 d8                	mov    %ebx,%eax
+  8008d8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008db:	c9                   	leave
+  8008dc:	c3                   	ret
+
+008008dd <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  8008dd:	55                   	push   %ebp
+  8008de:	89 e5                	mov    %esp,%ebp
+  8008e0:	56                   	push   %esi
+  8008e1:	53                   	push   %ebx
+  8008e2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008e5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  8008e8:	89 f3                	mov    %esi,%ebx
+  8008ea:	03 5d 10             	add    0x10(%ebp),%ebx
+  8008ed:	89 f0                	mov    %esi,%eax
+  8008ef:	eb 0f                	jmp    800900 <strncpy+0x23>
+    *dst++ = *src;
+  8008f1:	83 c0 01             	add    $0x1,%eax
+  8008f4:	0f b6 0a             	movzbl (%edx),%ecx
+  8008f7:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  8008fa:	80 f9 01             	cmp    $0x1,%cl
+  8008fd:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  800900:	39 d8                	cmp    %ebx,%eax
+  800902:	75 ed                	jne    8008f1 <strncpy+0x14>
+  }
+  return ret;
+}
+  800904:	89 f0                	mov    %esi,%eax
+  800906:	5b                   	pop    %ebx
+  800907:	5e                   	pop    %esi
+  800908:	5d                   	pop    %ebp
+  800909:	c3                   	ret
+
+0080090a <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80090a:	55                   	push   %ebp
+  80090b:	89 e5                	mov    %esp,%ebp
+  80090d:	56                   	push   %esi
+  80090e:	53                   	push   %ebx
+  80090f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800912:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800915:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  800918:	89 f0                	mov    %esi,%eax
+  80091a:	85 d2                	test   %edx,%edx
+  80091c:	74 21                	je     80093f <strlcpy+0x35>
+  80091e:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800922:	89 f2                	mov    %esi,%edx
+  800924:	eb 09                	jmp    80092f <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  800926:	83 c1 01             	add    $0x1,%ecx
+  800929:	83 c2 01             	add    $0x1,%edx
+  80092c:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  80092f:	39 c2                	cmp    %eax,%edx
+  800931:	74 09                	je     80093c <strlcpy+0x32>
+  800933:	0f b6 19             	movzbl (%ecx),%ebx
+  800936:	84 db                	test   %bl,%bl
+  800938:	75 ec                	jne    800926 <strlcpy+0x1c>
+  80093a:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  80093c:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  80093f:	29 f0                	sub    %esi,%eax
+}
+  800941:	5b                   	pop    %ebx
+  800942:	5e                   	pop    %esi
+  800943:	5d                   	pop    %ebp
+  800944:	c3                   	ret
+
+00800945 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800945:	55                   	push   %ebp
+  800946:	89 e5                	mov    %esp,%ebp
+  800948:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80094b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  80094e:	eb 06                	jmp    800956 <strcmp+0x11>
+    p++, q++;
+  800950:	83 c1 01             	add    $0x1,%ecx
+  800953:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  800956:	0f b6 01             	movzbl (%ecx),%eax
+  800959:	84 c0                	test   %al,%al
+  80095b:	74 04                	je     800961 <strcmp+0x1c>
+  80095d:	3a 02                	cmp    (%edx),%al
+  80095f:	74 ef                	je     800950 <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  800961:	0f b6 c0             	movzbl %al,%eax
+  800964:	0f b6 12             	movzbl (%edx),%edx
+  800967:	29 d0                	sub    %edx,%eax
+}
+  800969:	5d                   	pop    %ebp
+  80096a:	c3                   	ret
+
+0080096b <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80096b:	55                   	push   %ebp
+  80096c:	89 e5                	mov    %esp,%ebp
+  80096e:	53                   	push   %ebx
+  80096f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800972:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800975:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  800978:	eb 09                	jmp    800983 <strncmp+0x18>
+    n--, p++, q++;
+  80097a:	83 ea 01             	sub    $0x1,%edx
+  80097d:	83 c0 01             	add    $0x1,%eax
+  800980:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  800983:	85 d2                	test   %edx,%edx
+  800985:	74 18                	je     80099f <strncmp+0x34>
+  800987:	0f b6 18             	movzbl (%eax),%ebx
+  80098a:	84 db                	test   %bl,%bl
+  80098c:	74 04                	je     800992 <strncmp+0x27>
+  80098e:	3a 19                	cmp    (%ecx),%bl
+  800990:	74 e8                	je     80097a <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800992:	0f b6 00             	movzbl (%eax),%eax
+  800995:	0f b6 11             	movzbl (%ecx),%edx
+  800998:	29 d0                	sub    %edx,%eax
+}
+  80099a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80099d:	c9                   	leave
+  80099e:	c3                   	ret
+    return 0;
+  80099f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009a4:	eb f4                	jmp    80099a <strncmp+0x2f>
+
+008009a6 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8009a6:	55                   	push   %ebp
+  8009a7:	89 e5                	mov    %esp,%ebp
+  8009a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009ac:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  8009b0:	eb 03                	jmp    8009b5 <strchr+0xf>
+  8009b2:	83 c0 01             	add    $0x1,%eax
+  8009b5:	0f b6 10             	movzbl (%eax),%edx
+  8009b8:	84 d2                	test   %dl,%dl
+  8009ba:	74 06                	je     8009c2 <strchr+0x1c>
+    if (*s == c)
+  8009bc:	38 ca                	cmp    %cl,%dl
+  8009be:	75 f2                	jne    8009b2 <strchr+0xc>
+  8009c0:	eb 05                	jmp    8009c7 <strchr+0x21>
+      return (char*)s;
+  return 0;
+  8009c2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009c7:	5d                   	pop    %ebp
+  8009c8:	c3                   	ret
+
+008009c9 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8009c9:	55                   	push   %ebp
+  8009ca:	89 e5                	mov    %esp,%ebp
+  8009cc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009cf:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  8009d3:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  8009d6:	38 ca                	cmp    %cl,%dl
+  8009d8:	74 09                	je     8009e3 <strfind+0x1a>
+  8009da:	84 d2                	test   %dl,%dl
+  8009dc:	74 05                	je     8009e3 <strfind+0x1a>
+  for (; *s; s++)
+  8009de:	83 c0 01             	add    $0x1,%eax
+  8009e1:	eb f0                	jmp    8009d3 <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  8009e3:	5d                   	pop    %ebp
+  8009e4:	c3                   	ret
+
+008009e5 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8009e5:	55                   	push   %ebp
+  8009e6:	89 e5                	mov    %esp,%ebp
+  8009e8:	57                   	push   %edi
+  8009e9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8009ec:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  8009ef:	85 c9                	test   %ecx,%ecx
+  8009f1:	74 20                	je     800a13 <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  8009f3:	89 f8                	mov    %edi,%eax
+  8009f5:	09 c8                	or     %ecx,%eax
+  8009f7:	a8 03                	test   $0x3,%al
+  8009f9:	75 12                	jne    800a0d <memset+0x28>
+    c &= 0xFF;
+  8009fb:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8009ff:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  800a05:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  800a08:	fc                   	cld
+  800a09:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a0b:	eb 06                	jmp    800a13 <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  800a0d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a10:	fc                   	cld
+  800a11:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  800a13:	89 f8                	mov    %edi,%eax
+  800a15:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a18:	c9                   	leave
+  800a19:	c3                   	ret
+
+00800a1a <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a1a:	55                   	push   %ebp
+  800a1b:	89 e5                	mov    %esp,%ebp
+  800a1d:	57                   	push   %edi
+  800a1e:	56                   	push   %esi
+  800a1f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a22:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a25:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  800a28:	39 c6                	cmp    %eax,%esi
+  800a2a:	73 32                	jae    800a5e <memmove+0x44>
+  800a2c:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a2f:	39 d0                	cmp    %edx,%eax
+  800a31:	73 2b                	jae    800a5e <memmove+0x44>
+    s += n;
+    d += n;
+  800a33:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a36:	89 d6                	mov    %edx,%esi
+  800a38:	09 fe                	or     %edi,%esi
+  800a3a:	09 ce                	or     %ecx,%esi
+  800a3c:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a42:	75 0e                	jne    800a52 <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a44:	83 ef 04             	sub    $0x4,%edi
+  800a47:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a4a:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  800a4d:	fd                   	std
+  800a4e:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a50:	eb 09                	jmp    800a5b <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a52:	83 ef 01             	sub    $0x1,%edi
+  800a55:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  800a58:	fd                   	std
+  800a59:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  800a5b:	fc                   	cld
+  800a5c:	eb 1a                	jmp    800a78 <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a5e:	89 f2                	mov    %esi,%edx
+  800a60:	09 c2                	or     %eax,%edx
+  800a62:	09 ca                	or     %ecx,%edx
+  800a64:	f6 c2 03             	test   $0x3,%dl
+  800a67:	75 0a                	jne    800a73 <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a69:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  800a6c:	89 c7                	mov    %eax,%edi
+  800a6e:	fc                   	cld
+  800a6f:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a71:	eb 05                	jmp    800a78 <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  800a73:	89 c7                	mov    %eax,%edi
+  800a75:	fc                   	cld
+  800a76:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  800a78:	5e                   	pop    %esi
+  800a79:	5f                   	pop    %edi
+  800a7a:	5d                   	pop    %ebp
+  800a7b:	c3                   	ret
+
+00800a7c <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a7c:	55                   	push   %ebp
+  800a7d:	89 e5                	mov    %esp,%ebp
+  800a7f:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  800a82:	ff 75 10             	push   0x10(%ebp)
+  800a85:	ff 75 0c             	push   0xc(%ebp)
+  800a88:	ff 75 08             	push   0x8(%ebp)
+  800a8b:	e8 8a ff ff ff       	call   800a1a <memmove>
+}
+  800a90:	c9                   	leave
+  800a91:	c3                   	ret
+
+00800a92 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a92:	55                   	push   %ebp
+  800a93:	89 e5                	mov    %esp,%ebp
+  800a95:	56                   	push   %esi
+  800a96:	53                   	push   %ebx
+  800a97:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a9a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  800a9d:	89 c6                	mov    %eax,%esi
+  800a9f:	03 75 10             	add    0x10(%ebp),%esi
+  800aa2:	eb 06                	jmp    800aaa <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  800aa4:	83 c0 01             	add    $0x1,%eax
+  800aa7:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  800aaa:	39 f0                	cmp    %esi,%eax
+  800aac:	74 14                	je     800ac2 <memcmp+0x30>
+    if (*s1 != *s2)
+  800aae:	0f b6 08             	movzbl (%eax),%ecx
+  800ab1:	0f b6 1a             	movzbl (%edx),%ebx
+  800ab4:	38 d9                	cmp    %bl,%cl
+  800ab6:	74 ec                	je     800aa4 <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  800ab8:	0f b6 c1             	movzbl %cl,%eax
+  800abb:	0f b6 db             	movzbl %bl,%ebx
+  800abe:	29 d8                	sub    %ebx,%eax
+  800ac0:	eb 05                	jmp    800ac7 <memcmp+0x35>
+  }
+
+  return 0;
+  800ac2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ac7:	5b                   	pop    %ebx
+  800ac8:	5e                   	pop    %esi
+  800ac9:	5d                   	pop    %ebp
+  800aca:	c3                   	ret
+
+00800acb <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800acb:	55                   	push   %ebp
+  800acc:	89 e5                	mov    %esp,%ebp
+  800ace:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ad1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  800ad4:	89 c2                	mov    %eax,%edx
+  800ad6:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  800ad9:	eb 03                	jmp    800ade <memfind+0x13>
+  800adb:	83 c0 01             	add    $0x1,%eax
+  800ade:	39 d0                	cmp    %edx,%eax
+  800ae0:	73 04                	jae    800ae6 <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  800ae2:	38 08                	cmp    %cl,(%eax)
+  800ae4:	75 f5                	jne    800adb <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  800ae6:	5d                   	pop    %ebp
+  800ae7:	c3                   	ret
+
+00800ae8 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800ae8:	55                   	push   %ebp
+  800ae9:	89 e5                	mov    %esp,%ebp
+  800aeb:	57                   	push   %edi
+  800aec:	56                   	push   %esi
+  800aed:	53                   	push   %ebx
+  800aee:	8b 55 08             	mov    0x8(%ebp),%edx
+  800af1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  800af4:	eb 03                	jmp    800af9 <strtol+0x11>
+    s++;
+  800af6:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  800af9:	0f b6 02             	movzbl (%edx),%eax
+  800afc:	3c 20                	cmp    $0x20,%al
+  800afe:	74 f6                	je     800af6 <strtol+0xe>
+  800b00:	3c 09                	cmp    $0x9,%al
+  800b02:	74 f2                	je     800af6 <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  800b04:	3c 2b                	cmp    $0x2b,%al
+  800b06:	74 2a                	je     800b32 <strtol+0x4a>
+  int neg = 0;
+  800b08:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  800b0d:	3c 2d                	cmp    $0x2d,%al
+  800b0f:	74 2b                	je     800b3c <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b11:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b17:	75 0f                	jne    800b28 <strtol+0x40>
+  800b19:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b1c:	74 28                	je     800b46 <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  800b1e:	85 db                	test   %ebx,%ebx
+  800b20:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b25:	0f 44 d8             	cmove  %eax,%ebx
+  800b28:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b2d:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b30:	eb 46                	jmp    800b78 <strtol+0x90>
+    s++;
+  800b32:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  800b35:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b3a:	eb d5                	jmp    800b11 <strtol+0x29>
+    s++, neg = 1;
+  800b3c:	83 c2 01             	add    $0x1,%edx
+  800b3f:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b44:	eb cb                	jmp    800b11 <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b46:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800b4a:	74 0e                	je     800b5a <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  800b4c:	85 db                	test   %ebx,%ebx
+  800b4e:	75 d8                	jne    800b28 <strtol+0x40>
+    s++, base = 8;
+  800b50:	83 c2 01             	add    $0x1,%edx
+  800b53:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800b58:	eb ce                	jmp    800b28 <strtol+0x40>
+    s += 2, base = 16;
+  800b5a:	83 c2 02             	add    $0x2,%edx
+  800b5d:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800b62:	eb c4                	jmp    800b28 <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  800b64:	0f be c0             	movsbl %al,%eax
+  800b67:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  800b6a:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800b6d:	7d 3a                	jge    800ba9 <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  800b6f:	83 c2 01             	add    $0x1,%edx
+  800b72:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800b76:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  800b78:	0f b6 02             	movzbl (%edx),%eax
+  800b7b:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800b7e:	89 f3                	mov    %esi,%ebx
+  800b80:	80 fb 09             	cmp    $0x9,%bl
+  800b83:	76 df                	jbe    800b64 <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  800b85:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800b88:	89 f3                	mov    %esi,%ebx
+  800b8a:	80 fb 19             	cmp    $0x19,%bl
+  800b8d:	77 08                	ja     800b97 <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  800b8f:	0f be c0             	movsbl %al,%eax
+  800b92:	83 e8 57             	sub    $0x57,%eax
+  800b95:	eb d3                	jmp    800b6a <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  800b97:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800b9a:	89 f3                	mov    %esi,%ebx
+  800b9c:	80 fb 19             	cmp    $0x19,%bl
+  800b9f:	77 08                	ja     800ba9 <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  800ba1:	0f be c0             	movsbl %al,%eax
+  800ba4:	83 e8 37             	sub    $0x37,%eax
+  800ba7:	eb c1                	jmp    800b6a <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  800ba9:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800bad:	74 05                	je     800bb4 <strtol+0xcc>
+    *endptr = (char*)s;
+  800baf:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800bb2:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  800bb4:	89 c8                	mov    %ecx,%eax
+  800bb6:	f7 d8                	neg    %eax
+  800bb8:	85 ff                	test   %edi,%edi
+  800bba:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800bbd:	89 c8                	mov    %ecx,%eax
+  800bbf:	5b                   	pop    %ebx
+  800bc0:	5e                   	pop    %esi
+  800bc1:	5f                   	pop    %edi
+  800bc2:	5d                   	pop    %ebp
+  800bc3:	c3                   	ret
+
+00800bc4 <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800bc4:	55                   	push   %ebp
+  800bc5:	89 e5                	mov    %esp,%ebp
+  800bc7:	57                   	push   %edi
+  800bc8:	56                   	push   %esi
+  800bc9:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800bca:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bcf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bd2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bd5:	89 c3                	mov    %eax,%ebx
+  800bd7:	89 c7                	mov    %eax,%edi
+  800bd9:	89 c6                	mov    %eax,%esi
+  800bdb:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800bdd:	5b                   	pop    %ebx
+  800bde:	5e                   	pop    %esi
+  800bdf:	5f                   	pop    %edi
+  800be0:	5d                   	pop    %ebp
+  800be1:	c3                   	ret
+
+00800be2 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800be2:	55                   	push   %ebp
+  800be3:	89 e5                	mov    %esp,%ebp
+  800be5:	57                   	push   %edi
+  800be6:	56                   	push   %esi
+  800be7:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800be8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bed:	b8 01 00 00 00       	mov    $0x1,%eax
+  800bf2:	89 d1                	mov    %edx,%ecx
+  800bf4:	89 d3                	mov    %edx,%ebx
+  800bf6:	89 d7                	mov    %edx,%edi
+  800bf8:	89 d6                	mov    %edx,%esi
+  800bfa:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800bfc:	5b                   	pop    %ebx
+  800bfd:	5e                   	pop    %esi
+  800bfe:	5f                   	pop    %edi
+  800bff:	5d                   	pop    %ebp
+  800c00:	c3                   	ret
+
+00800c01 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c01:	55                   	push   %ebp
+  800c02:	89 e5                	mov    %esp,%ebp
+  800c04:	57                   	push   %edi
+  800c05:	56                   	push   %esi
+  800c06:	53                   	push   %ebx
+  800c07:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800c0a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c0f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c12:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c17:	89 cb                	mov    %ecx,%ebx
+  800c19:	89 cf                	mov    %ecx,%edi
+  800c1b:	89 ce                	mov    %ecx,%esi
+  800c1d:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c1f:	85 c0                	test   %eax,%eax
+  800c21:	7f 08                	jg     800c2b <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800c23:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c26:	5b                   	pop    %ebx
+  800c27:	5e                   	pop    %esi
+  800c28:	5f                   	pop    %edi
+  800c29:	5d                   	pop    %ebp
+  800c2a:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c2b:	83 ec 0c             	sub    $0xc,%esp
+  800c2e:	50                   	push   %eax
+  800c2f:	6a 03                	push   $0x3
+  800c31:	68 43 3e 80 00       	push   $0x803e43
+  800c36:	6a 23                	push   $0x23
+  800c38:	68 60 3e 80 00       	push   $0x803e60
+  800c3d:	e8 ec 2a 00 00       	call   80372e <_panic>
+
+00800c42 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800c42:	55                   	push   %ebp
+  800c43:	89 e5                	mov    %esp,%ebp
+  800c45:	57                   	push   %edi
+  800c46:	56                   	push   %esi
+  800c47:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800c48:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c4d:	b8 02 00 00 00       	mov    $0x2,%eax
+  800c52:	89 d1                	mov    %edx,%ecx
+  800c54:	89 d3                	mov    %edx,%ebx
+  800c56:	89 d7                	mov    %edx,%edi
+  800c58:	89 d6                	mov    %edx,%esi
+  800c5a:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800c5c:	5b                   	pop    %ebx
+  800c5d:	5e                   	pop    %esi
+  800c5e:	5f                   	pop    %edi
+  800c5f:	5d                   	pop    %ebp
+  800c60:	c3                   	ret
+
+00800c61 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800c61:	55                   	push   %ebp
+  800c62:	89 e5                	mov    %esp,%ebp
+  800c64:	57                   	push   %edi
+  800c65:	56                   	push   %esi
+  800c66:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800c67:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c6c:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800c71:	89 d1                	mov    %edx,%ecx
+  800c73:	89 d3                	mov    %edx,%ebx
+  800c75:	89 d7                	mov    %edx,%edi
+  800c77:	89 d6                	mov    %edx,%esi
+  800c79:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800c7b:	5b                   	pop    %ebx
+  800c7c:	5e                   	pop    %esi
+  800c7d:	5f                   	pop    %edi
+  800c7e:	5d                   	pop    %ebp
+  800c7f:	c3                   	ret
+
+00800c80 <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  800c80:	55                   	push   %ebp
+  800c81:	89 e5                	mov    %esp,%ebp
+  800c83:	57                   	push   %edi
+  800c84:	56                   	push   %esi
+  800c85:	53                   	push   %ebx
+  800c86:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  800c89:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  800c8d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c92:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c95:	b8 14 00 00 00       	mov    $0x14,%eax
+  800c9a:	89 df                	mov    %ebx,%edi
+  800c9c:	89 de                	mov    %ebx,%esi
+  800c9e:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ca0:	85 c0                	test   %eax,%eax
+  800ca2:	7f 08                	jg     800cac <sys_env_set_cow+0x2c>
+}
+  800ca4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ca7:	5b                   	pop    %ebx
+  800ca8:	5e                   	pop    %esi
+  800ca9:	5f                   	pop    %edi
+  800caa:	5d                   	pop    %ebp
+  800cab:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800cac:	83 ec 0c             	sub    $0xc,%esp
+  800caf:	50                   	push   %eax
+  800cb0:	6a 14                	push   $0x14
+  800cb2:	68 43 3e 80 00       	push   $0x803e43
+  800cb7:	6a 23                	push   $0x23
+  800cb9:	68 60 3e 80 00       	push   $0x803e60
+  800cbe:	e8 6b 2a 00 00       	call   80372e <_panic>
+
+00800cc3 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800cc3:	55                   	push   %ebp
+  800cc4:	89 e5                	mov    %esp,%ebp
+  800cc6:	57                   	push   %edi
+  800cc7:	56                   	push   %esi
+  800cc8:	53                   	push   %ebx
+  800cc9:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800ccc:	be 00 00 00 00       	mov    $0x0,%esi
+  800cd1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cd4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cd7:	b8 04 00 00 00       	mov    $0x4,%eax
+  800cdc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cdf:	89 f7                	mov    %esi,%edi
+  800ce1:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ce3:	85 c0                	test   %eax,%eax
+  800ce5:	7f 08                	jg     800cef <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  800ce7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cea:	5b                   	pop    %ebx
+  800ceb:	5e                   	pop    %esi
+  800cec:	5f                   	pop    %edi
+  800ced:	5d                   	pop    %ebp
+  800cee:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800cef:	83 ec 0c             	sub    $0xc,%esp
+  800cf2:	50                   	push   %eax
+  800cf3:	6a 04                	push   $0x4
+  800cf5:	68 43 3e 80 00       	push   $0x803e43
+  800cfa:	6a 23                	push   $0x23
+  800cfc:	68 60 3e 80 00       	push   $0x803e60
+  800d01:	e8 28 2a 00 00       	call   80372e <_panic>
+
+00800d06 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800d06:	55                   	push   %ebp
+  800d07:	89 e5                	mov    %esp,%ebp
+  800d09:	57                   	push   %edi
+  800d0a:	56                   	push   %esi
+  800d0b:	53                   	push   %ebx
+  800d0c:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800d0f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d12:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d15:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d1a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d1d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d20:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d23:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d25:	85 c0                	test   %eax,%eax
+  800d27:	7f 08                	jg     800d31 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  800d29:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d2c:	5b                   	pop    %ebx
+  800d2d:	5e                   	pop    %esi
+  800d2e:	5f                   	pop    %edi
+  800d2f:	5d                   	pop    %ebp
+  800d30:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d31:	83 ec 0c             	sub    $0xc,%esp
+  800d34:	50                   	push   %eax
+  800d35:	6a 05                	push   $0x5
+  800d37:	68 43 3e 80 00       	push   $0x803e43
+  800d3c:	6a 23                	push   $0x23
+  800d3e:	68 60 3e 80 00       	push   $0x803e60
+  800d43:	e8 e6 29 00 00       	call   80372e <_panic>
+
+00800d48 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800d48:	55                   	push   %ebp
+  800d49:	89 e5                	mov    %esp,%ebp
+  800d4b:	57                   	push   %edi
+  800d4c:	56                   	push   %esi
+  800d4d:	53                   	push   %ebx
+  800d4e:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800d51:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d56:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d59:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d5c:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d61:	89 df                	mov    %ebx,%edi
+  800d63:	89 de                	mov    %ebx,%esi
+  800d65:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d67:	85 c0                	test   %eax,%eax
+  800d69:	7f 08                	jg     800d73 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  800d6b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d6e:	5b                   	pop    %ebx
+  800d6f:	5e                   	pop    %esi
+  800d70:	5f                   	pop    %edi
+  800d71:	5d                   	pop    %ebp
+  800d72:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d73:	83 ec 0c             	sub    $0xc,%esp
+  800d76:	50                   	push   %eax
+  800d77:	6a 06                	push   $0x6
+  800d79:	68 43 3e 80 00       	push   $0x803e43
+  800d7e:	6a 23                	push   $0x23
+  800d80:	68 60 3e 80 00       	push   $0x803e60
+  800d85:	e8 a4 29 00 00       	call   80372e <_panic>
+
+00800d8a <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  800d8a:	55                   	push   %ebp
+  800d8b:	89 e5                	mov    %esp,%ebp
+  800d8d:	57                   	push   %edi
+  800d8e:	56                   	push   %esi
+  800d8f:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d90:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d93:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d96:	b8 11 00 00 00       	mov    $0x11,%eax
+  800d9b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d9e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800da1:	8b 75 18             	mov    0x18(%ebp),%esi
+  800da4:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  800da6:	5b                   	pop    %ebx
+  800da7:	5e                   	pop    %esi
+  800da8:	5f                   	pop    %edi
+  800da9:	5d                   	pop    %ebp
+  800daa:	c3                   	ret
+
+00800dab <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  800dab:	55                   	push   %ebp
+  800dac:	89 e5                	mov    %esp,%ebp
+  800dae:	57                   	push   %edi
+  800daf:	56                   	push   %esi
+  800db0:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800db1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800db4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800db7:	b8 12 00 00 00       	mov    $0x12,%eax
+  800dbc:	be 00 00 00 00       	mov    $0x0,%esi
+  800dc1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dc4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dc7:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  800dc9:	5b                   	pop    %ebx
+  800dca:	5e                   	pop    %esi
+  800dcb:	5f                   	pop    %edi
+  800dcc:	5d                   	pop    %ebp
+  800dcd:	c3                   	ret
+
+00800dce <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  800dce:	55                   	push   %ebp
+  800dcf:	89 e5                	mov    %esp,%ebp
+  800dd1:	57                   	push   %edi
+  800dd2:	56                   	push   %esi
+  800dd3:	53                   	push   %ebx
+  800dd4:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800dd7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ddc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ddf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800de2:	b8 16 00 00 00       	mov    $0x16,%eax
+  800de7:	89 df                	mov    %ebx,%edi
+  800de9:	89 de                	mov    %ebx,%esi
+  800deb:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ded:	85 c0                	test   %eax,%eax
+  800def:	7f 08                	jg     800df9 <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  800df1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800df4:	5b                   	pop    %ebx
+  800df5:	5e                   	pop    %esi
+  800df6:	5f                   	pop    %edi
+  800df7:	5d                   	pop    %ebp
+  800df8:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800df9:	83 ec 0c             	sub    $0xc,%esp
+  800dfc:	50                   	push   %eax
+  800dfd:	6a 16                	push   $0x16
+  800dff:	68 43 3e 80 00       	push   $0x803e43
+  800e04:	6a 23                	push   $0x23
+  800e06:	68 60 3e 80 00       	push   $0x803e60
+  800e0b:	e8 1e 29 00 00       	call   80372e <_panic>
+
+00800e10 <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  800e10:	55                   	push   %ebp
+  800e11:	89 e5                	mov    %esp,%ebp
+  800e13:	57                   	push   %edi
+  800e14:	56                   	push   %esi
+  800e15:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e16:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e1b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e1e:	b8 17 00 00 00       	mov    $0x17,%eax
+  800e23:	89 cb                	mov    %ecx,%ebx
+  800e25:	89 cf                	mov    %ecx,%edi
+  800e27:	89 ce                	mov    %ecx,%esi
+  800e29:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  800e2b:	5b                   	pop    %ebx
+  800e2c:	5e                   	pop    %esi
+  800e2d:	5f                   	pop    %edi
+  800e2e:	5d                   	pop    %ebp
+  800e2f:	c3                   	ret
+
+00800e30 <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  800e30:	55                   	push   %ebp
+  800e31:	89 e5                	mov    %esp,%ebp
+  800e33:	57                   	push   %edi
+  800e34:	56                   	push   %esi
+  800e35:	53                   	push   %ebx
+  800e36:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e39:	be 00 00 00 00       	mov    $0x0,%esi
+  800e3e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e41:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e44:	b8 18 00 00 00       	mov    $0x18,%eax
+  800e49:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e4c:	89 f7                	mov    %esi,%edi
+  800e4e:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e50:	85 c0                	test   %eax,%eax
+  800e52:	7f 08                	jg     800e5c <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  800e54:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e57:	5b                   	pop    %ebx
+  800e58:	5e                   	pop    %esi
+  800e59:	5f                   	pop    %edi
+  800e5a:	5d                   	pop    %ebp
+  800e5b:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e5c:	83 ec 0c             	sub    $0xc,%esp
+  800e5f:	50                   	push   %eax
+  800e60:	6a 18                	push   $0x18
+  800e62:	68 43 3e 80 00       	push   $0x803e43
+  800e67:	6a 23                	push   $0x23
+  800e69:	68 60 3e 80 00       	push   $0x803e60
+  800e6e:	e8 bb 28 00 00       	call   80372e <_panic>
+
+00800e73 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  800e73:	55                   	push   %ebp
+  800e74:	89 e5                	mov    %esp,%ebp
+  800e76:	57                   	push   %edi
+  800e77:	56                   	push   %esi
+  800e78:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e79:	be 00 00 00 00       	mov    $0x0,%esi
+  800e7e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e81:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e84:	b8 19 00 00 00       	mov    $0x19,%eax
+  800e89:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e8c:	89 f7                	mov    %esi,%edi
+  800e8e:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  800e90:	5b                   	pop    %ebx
+  800e91:	5e                   	pop    %esi
+  800e92:	5f                   	pop    %edi
+  800e93:	5d                   	pop    %ebp
+  800e94:	c3                   	ret
+
+00800e95 <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  800e95:	55                   	push   %ebp
+  800e96:	89 e5                	mov    %esp,%ebp
+  800e98:	57                   	push   %edi
+  800e99:	56                   	push   %esi
+  800e9a:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e9b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ea0:	b8 15 00 00 00       	mov    $0x15,%eax
+  800ea5:	89 d1                	mov    %edx,%ecx
+  800ea7:	89 d3                	mov    %edx,%ebx
+  800ea9:	89 d7                	mov    %edx,%edi
+  800eab:	89 d6                	mov    %edx,%esi
+  800ead:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800eaf:	5b                   	pop    %ebx
+  800eb0:	5e                   	pop    %esi
+  800eb1:	5f                   	pop    %edi
+  800eb2:	5d                   	pop    %ebp
+  800eb3:	c3                   	ret
+
+00800eb4 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800eb4:	55                   	push   %ebp
+  800eb5:	89 e5                	mov    %esp,%ebp
+  800eb7:	57                   	push   %edi
+  800eb8:	56                   	push   %esi
+  800eb9:	53                   	push   %ebx
+  800eba:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800ebd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ec2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ec8:	b8 08 00 00 00       	mov    $0x8,%eax
+  800ecd:	89 df                	mov    %ebx,%edi
+  800ecf:	89 de                	mov    %ebx,%esi
+  800ed1:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ed3:	85 c0                	test   %eax,%eax
+  800ed5:	7f 08                	jg     800edf <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800ed7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eda:	5b                   	pop    %ebx
+  800edb:	5e                   	pop    %esi
+  800edc:	5f                   	pop    %edi
+  800edd:	5d                   	pop    %ebp
+  800ede:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800edf:	83 ec 0c             	sub    $0xc,%esp
+  800ee2:	50                   	push   %eax
+  800ee3:	6a 08                	push   $0x8
+  800ee5:	68 43 3e 80 00       	push   $0x803e43
+  800eea:	6a 23                	push   $0x23
+  800eec:	68 60 3e 80 00       	push   $0x803e60
+  800ef1:	e8 38 28 00 00       	call   80372e <_panic>
+
+00800ef6 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800ef6:	55                   	push   %ebp
+  800ef7:	89 e5                	mov    %esp,%ebp
+  800ef9:	57                   	push   %edi
+  800efa:	56                   	push   %esi
+  800efb:	53                   	push   %ebx
+  800efc:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800eff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f04:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f07:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f0a:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f0f:	89 df                	mov    %ebx,%edi
+  800f11:	89 de                	mov    %ebx,%esi
+  800f13:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f15:	85 c0                	test   %eax,%eax
+  800f17:	7f 08                	jg     800f21 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  800f19:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f1c:	5b                   	pop    %ebx
+  800f1d:	5e                   	pop    %esi
+  800f1e:	5f                   	pop    %edi
+  800f1f:	5d                   	pop    %ebp
+  800f20:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f21:	83 ec 0c             	sub    $0xc,%esp
+  800f24:	50                   	push   %eax
+  800f25:	6a 09                	push   $0x9
+  800f27:	68 43 3e 80 00       	push   $0x803e43
+  800f2c:	6a 23                	push   $0x23
+  800f2e:	68 60 3e 80 00       	push   $0x803e60
+  800f33:	e8 f6 27 00 00       	call   80372e <_panic>
+
+00800f38 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800f38:	55                   	push   %ebp
+  800f39:	89 e5                	mov    %esp,%ebp
+  800f3b:	57                   	push   %edi
+  800f3c:	56                   	push   %esi
+  800f3d:	53                   	push   %ebx
+  800f3e:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f41:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f46:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f49:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f4c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f51:	89 df                	mov    %ebx,%edi
+  800f53:	89 de                	mov    %ebx,%esi
+  800f55:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f57:	85 c0                	test   %eax,%eax
+  800f59:	7f 08                	jg     800f63 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  800f5b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f5e:	5b                   	pop    %ebx
+  800f5f:	5e                   	pop    %esi
+  800f60:	5f                   	pop    %edi
+  800f61:	5d                   	pop    %ebp
+  800f62:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f63:	83 ec 0c             	sub    $0xc,%esp
+  800f66:	50                   	push   %eax
+  800f67:	6a 0a                	push   $0xa
+  800f69:	68 43 3e 80 00       	push   $0x803e43
+  800f6e:	6a 23                	push   $0x23
+  800f70:	68 60 3e 80 00       	push   $0x803e60
+  800f75:	e8 b4 27 00 00       	call   80372e <_panic>
+
+00800f7a <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  800f7a:	55                   	push   %ebp
+  800f7b:	89 e5                	mov    %esp,%ebp
+  800f7d:	57                   	push   %edi
+  800f7e:	56                   	push   %esi
+  800f7f:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f80:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f83:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f86:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f8b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f8e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f91:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f94:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  800f96:	5b                   	pop    %ebx
+  800f97:	5e                   	pop    %esi
+  800f98:	5f                   	pop    %edi
+  800f99:	5d                   	pop    %ebp
+  800f9a:	c3                   	ret
+
+00800f9b <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  800f9b:	55                   	push   %ebp
+  800f9c:	89 e5                	mov    %esp,%ebp
+  800f9e:	57                   	push   %edi
+  800f9f:	56                   	push   %esi
+  800fa0:	53                   	push   %ebx
+  800fa1:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800fa4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fa9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fac:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800faf:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800fb4:	89 df                	mov    %ebx,%edi
+  800fb6:	89 de                	mov    %ebx,%esi
+  800fb8:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800fba:	85 c0                	test   %eax,%eax
+  800fbc:	7f 08                	jg     800fc6 <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  800fbe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fc1:	5b                   	pop    %ebx
+  800fc2:	5e                   	pop    %esi
+  800fc3:	5f                   	pop    %edi
+  800fc4:	5d                   	pop    %ebp
+  800fc5:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800fc6:	83 ec 0c             	sub    $0xc,%esp
+  800fc9:	50                   	push   %eax
+  800fca:	6a 0d                	push   $0xd
+  800fcc:	68 43 3e 80 00       	push   $0x803e43
+  800fd1:	6a 23                	push   $0x23
+  800fd3:	68 60 3e 80 00       	push   $0x803e60
+  800fd8:	e8 51 27 00 00       	call   80372e <_panic>
+
+00800fdd <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  800fdd:	55                   	push   %ebp
+  800fde:	89 e5                	mov    %esp,%ebp
+  800fe0:	57                   	push   %edi
+  800fe1:	56                   	push   %esi
+  800fe2:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800fe3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fe8:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800fed:	89 d1                	mov    %edx,%ecx
+  800fef:	89 d3                	mov    %edx,%ebx
+  800ff1:	89 d7                	mov    %edx,%edi
+  800ff3:	89 d6                	mov    %edx,%esi
+  800ff5:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800ff7:	5b                   	pop    %ebx
+  800ff8:	5e                   	pop    %esi
+  800ff9:	5f                   	pop    %edi
+  800ffa:	5d                   	pop    %ebp
+  800ffb:	c3                   	ret
+
+00800ffc <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  800ffc:	55                   	push   %ebp
+  800ffd:	89 e5                	mov    %esp,%ebp
+  800fff:	57                   	push   %edi
+  801000:	56                   	push   %esi
+  801001:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801002:	8b 55 08             	mov    0x8(%ebp),%edx
+  801005:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801008:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80100d:	be 00 00 00 00       	mov    $0x0,%esi
+  801012:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801015:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801018:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  80101a:	5b                   	pop    %ebx
+  80101b:	5e                   	pop    %esi
+  80101c:	5f                   	pop    %edi
+  80101d:	5d                   	pop    %ebp
+  80101e:	c3                   	ret
+
+0080101f <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  80101f:	55                   	push   %ebp
+  801020:	89 e5                	mov    %esp,%ebp
+  801022:	57                   	push   %edi
+  801023:	56                   	push   %esi
+  801024:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801025:	be 00 00 00 00       	mov    $0x0,%esi
+  80102a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80102d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801030:	b8 10 00 00 00       	mov    $0x10,%eax
+  801035:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801038:	89 f7                	mov    %esi,%edi
+  80103a:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  80103c:	5b                   	pop    %ebx
+  80103d:	5e                   	pop    %esi
+  80103e:	5f                   	pop    %edi
+  80103f:	5d                   	pop    %ebp
+  801040:	c3                   	ret
+
+00801041 <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  801041:	55                   	push   %ebp
+  801042:	89 e5                	mov    %esp,%ebp
+  801044:	57                   	push   %edi
+  801045:	56                   	push   %esi
+  801046:	53                   	push   %ebx
+  801047:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  80104a:	80 3d a4 68 80 00 00 	cmpb   $0x0,0x8068a4
+  801051:	74 41                	je     801094 <sys_batch+0x53>
+  801053:	8b 45 08             	mov    0x8(%ebp),%eax
+  801056:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  801059:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  801060:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801063:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  801066:	7d 45                	jge    8010ad <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  801068:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80106b:	8b 06                	mov    (%esi),%eax
+  80106d:	8b 56 04             	mov    0x4(%esi),%edx
+  801070:	8b 4e 08             	mov    0x8(%esi),%ecx
+  801073:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  801076:	8b 7e 10             	mov    0x10(%esi),%edi
+  801079:	8b 76 14             	mov    0x14(%esi),%esi
+  80107c:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  80107e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801081:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  801084:	83 c6 1c             	add    $0x1c,%esi
+  801087:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  80108a:	85 c0                	test   %eax,%eax
+  80108c:	78 1f                	js     8010ad <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  80108e:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  801092:	eb cc                	jmp    801060 <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  801094:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801099:	b8 13 00 00 00       	mov    $0x13,%eax
+  80109e:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010a1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010a4:	89 df                	mov    %ebx,%edi
+  8010a6:	89 de                	mov    %ebx,%esi
+  8010a8:	cd 30                	int    $0x30
+  8010aa:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  8010ad:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8010b0:	83 c4 08             	add    $0x8,%esp
+  8010b3:	5b                   	pop    %ebx
+  8010b4:	5e                   	pop    %esi
+  8010b5:	5f                   	pop    %edi
+  8010b6:	5d                   	pop    %ebp
+  8010b7:	c3                   	ret
+
+008010b8 <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  8010b8:	55                   	push   %ebp
+  8010b9:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  8010bb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010be:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8010c4:	5d                   	pop    %ebp
+  8010c5:	c3                   	ret
+
+008010c6 <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  8010c6:	55                   	push   %ebp
+  8010c7:	89 e5                	mov    %esp,%ebp
+  8010c9:	56                   	push   %esi
+  8010ca:	53                   	push   %ebx
+  8010cb:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  8010ce:	8b 1e                	mov    (%esi),%ebx
+  8010d0:	85 db                	test   %ebx,%ebx
+  8010d2:	75 09                	jne    8010dd <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  8010d4:	89 d8                	mov    %ebx,%eax
+  8010d6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8010d9:	5b                   	pop    %ebx
+  8010da:	5e                   	pop    %esi
+  8010db:	5d                   	pop    %ebp
+  8010dc:	c3                   	ret
+  b->sb_n = 0;
+  8010dd:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  8010e3:	53                   	push   %ebx
+  8010e4:	8d 46 04             	lea    0x4(%esi),%eax
+  8010e7:	50                   	push   %eax
+  8010e8:	e8 54 ff ff ff       	call   801041 <sys_batch>
+  8010ed:	83 c4 08             	add    $0x8,%esp
+  8010f0:	85 c0                	test   %eax,%eax
+  8010f2:	78 1e                	js     801112 <sysbatch_flush+0x4c>
+  if (r < n)
+  8010f4:	39 c3                	cmp    %eax,%ebx
+  8010f6:	7f 07                	jg     8010ff <sysbatch_flush+0x39>
+  return 0;
+  8010f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010fd:	eb d5                	jmp    8010d4 <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  8010ff:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801102:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  801106:	85 db                	test   %ebx,%ebx
+  801108:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80110d:	0f 49 d8             	cmovns %eax,%ebx
+  801110:	eb c2                	jmp    8010d4 <sysbatch_flush+0xe>
+    return r;
+  801112:	89 c3                	mov    %eax,%ebx
+  801114:	eb be                	jmp    8010d4 <sysbatch_flush+0xe>
+
+00801116 <sysbatch_add>:
+{
+  801116:	55                   	push   %ebp
+  801117:	89 e5                	mov    %esp,%ebp
+  801119:	53                   	push   %ebx
+  80111a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  80111d:	83 3b 40             	cmpl   $0x40,(%ebx)
+  801120:	74 41                	je     801163 <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  801122:	8b 03                	mov    (%ebx),%eax
+  801124:	8d 50 01             	lea    0x1(%eax),%edx
+  801127:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  801129:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80112c:	01 d8                	add    %ebx,%eax
+  80112e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801131:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  801134:	8b 55 10             	mov    0x10(%ebp),%edx
+  801137:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  80113a:	8b 55 14             	mov    0x14(%ebp),%edx
+  80113d:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  801140:	8b 55 18             	mov    0x18(%ebp),%edx
+  801143:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  801146:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  801149:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  80114c:	8b 55 20             	mov    0x20(%ebp),%edx
+  80114f:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  801152:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  801159:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80115e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801161:	c9                   	leave
+  801162:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  801163:	53                   	push   %ebx
+  801164:	e8 5d ff ff ff       	call   8010c6 <sysbatch_flush>
+  801169:	83 c4 04             	add    $0x4,%esp
+  80116c:	85 c0                	test   %eax,%eax
+  80116e:	79 b2                	jns    801122 <sysbatch_add+0xc>
+  801170:	eb ec                	jmp    80115e <sysbatch_add+0x48>
+
+00801172 <pgfault>:
+// Custom page fault handler - if faulting page is copy-on-write,
+// map in our own private writable copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  801172:	55                   	push   %ebp
+  801173:	89 e5                	mov    %esp,%ebp
+  801175:	56                   	push   %esi
+  801176:	53                   	push   %ebx
+  801177:	8b 45 08             	mov    0x8(%ebp),%eax
+  void *addr = (void*)utf->utf_fault_va;
+  80117a:	8b 18                	mov    (%eax),%ebx
+  uint32_t err = utf->utf_err;
+  80117c:	8b 70 04             	mov    0x4(%eax),%esi
+  // Hint:
+  //   Use the read-only page table mappings at uvpt
+  //   (see <inc/memlayout.h>).
+
+  // Faults in file mappings are mmap's to handle.
+  if (mmap_fault(utf))
+  80117f:	83 ec 0c             	sub    $0xc,%esp
+  801182:	50                   	push   %eax
+  801183:	e8 17 1f 00 00       	call   80309f <mmap_fault>
+  801188:	83 c4 10             	add    $0x10,%esp
+  80118b:	84 c0                	test   %al,%al
+  80118d:	75 7d                	jne    80120c <pgfault+0x9a>
+    return;
+
+  // LAB 4: Your code here.
+  if ( !(err & FEC_WR) ) {
+  80118f:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  801195:	74 7c                	je     801213 <pgfault+0xa1>
+    panic("user_pgfault: %e", err);
+  }
+
+  if ( !(uvpt[PGNUM(addr)] & PTE_COW) ) {
+  801197:	89 d8                	mov    %ebx,%eax
+  801199:	c1 e8 0c             	shr    $0xc,%eax
+  80119c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8011a3:	f6 c4 08             	test   $0x8,%ah
+  8011a6:	74 7d                	je     801225 <pgfault+0xb3>
+  // page to the old page's address.
+  // Hint:
+  //   You should make three system calls.
+
+  // LAB 4: Your code here.
+  addr = ROUNDDOWN(addr, PGSIZE);
+  8011a8:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+
+  // map page to temporary location
+  if ( (r = sys_page_alloc(0, PFTEMP, (PTE_P | PTE_U | PTE_W))) < 0) {
+  8011ae:	83 ec 04             	sub    $0x4,%esp
+  8011b1:	6a 07                	push   $0x7
+  8011b3:	68 00 f0 7f 00       	push   $0x7ff000
+  8011b8:	6a 00                	push   $0x0
+  8011ba:	e8 04 fb ff ff       	call   800cc3 <sys_page_alloc>
+  8011bf:	83 c4 10             	add    $0x10,%esp
+  8011c2:	85 c0                	test   %eax,%eax
+  8011c4:	78 73                	js     801239 <pgfault+0xc7>
+    panic("sys_page_alloc: %e", r);
+  }
+
+  // copy data from old page to new page
+  memmove(PFTEMP, addr, PGSIZE);
+  8011c6:	83 ec 04             	sub    $0x4,%esp
+  8011c9:	68 00 10 00 00       	push   $0x1000
+  8011ce:	53                   	push   %ebx
+  8011cf:	68 00 f0 7f 00       	push   $0x7ff000
+  8011d4:	e8 41 f8 ff ff       	call   800a1a <memmove>
+
+  // move new page to old page address
+  if ( (r = sys_page_map(0, PFTEMP, 0, addr, (PTE_P | PTE_U | PTE_W))) < 0) {
+  8011d9:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8011e0:	53                   	push   %ebx
+  8011e1:	6a 00                	push   $0x0
+  8011e3:	68 00 f0 7f 00       	push   $0x7ff000
+  8011e8:	6a 00                	push   $0x0
+  8011ea:	e8 17 fb ff ff       	call   800d06 <sys_page_map>
+  8011ef:	83 c4 20             	add    $0x20,%esp
+  8011f2:	85 c0                	test   %eax,%eax
+  8011f4:	78 55                	js     80124b <pgfault+0xd9>
+    panic("sys_page_map: %e", r);
+  }
+
+  if ( (r = sys_page_unmap(0, PFTEMP)) < 0) {
+  8011f6:	83 ec 08             	sub    $0x8,%esp
+  8011f9:	68 00 f0 7f 00       	push   $0x7ff000
+  8011fe:	6a 00                	push   $0x0
+  801200:	e8 43 fb ff ff       	call   800d48 <sys_page_unmap>
+  801205:	83 c4 10             	add    $0x10,%esp
+  801208:	85 c0                	test   %eax,%eax
+  80120a:	78 51                	js     80125d <pgfault+0xeb>
+    panic("sys_page_unmap: %e", r);
+  }
+}
+  80120c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80120f:	5b                   	pop    %ebx
+  801210:	5e                   	pop    %esi
+  801211:	5d                   	pop    %ebp
+  801212:	c3                   	ret
+    panic("user_pgfault: %e", err);
+  801213:	56                   	push   %esi
+  801214:	68 6e 3e 80 00       	push   $0x803e6e
+  801219:	6a 1d                	push   $0x1d
+  80121b:	68 7f 3e 80 00       	push   $0x803e7f
+  801220:	e8 09 25 00 00       	call   80372e <_panic>
+    panic("user_pgfault: page not COW");
+  801225:	83 ec 04             	sub    $0x4,%esp
+  801228:	68 8a 3e 80 00       	push   $0x803e8a
+  80122d:	6a 21                	push   $0x21
+  80122f:	68 7f 3e 80 00       	push   $0x803e7f
+  801234:	e8 f5 24 00 00       	call   80372e <_panic>
+    panic("sys_page_alloc: %e", r);
+  801239:	50                   	push   %eax
+  80123a:	68 a5 3e 80 00       	push   $0x803ea5
+  80123f:	6a 2f                	push   $0x2f
+  801241:	68 7f 3e 80 00       	push   $0x803e7f
+  801246:	e8 e3 24 00 00       	call   80372e <_panic>
+    panic("sys_page_map: %e", r);
+  80124b:	50                   	push   %eax
+  80124c:	68 b8 3e 80 00       	push   $0x803eb8
+  801251:	6a 37                	push   $0x37
+  801253:	68 7f 3e 80 00       	push   $0x803e7f
+  801258:	e8 d1 24 00 00       	call   80372e <_panic>
+    panic("sys_page_unmap: %e", r);
+  80125d:	50                   	push   %eax
+  80125e:	68 c9 3e 80 00       	push   $0x803ec9
+  801263:	6a 3b                	push   $0x3b
+  801265:	68 7f 3e 80 00       	push   $0x803e7f
+  80126a:	e8 bf 24 00 00       	call   80372e <_panic>
+
+0080126f <shared_pgfault>:
+
+// Challenge!
+//
+static void
+shared_pgfault(struct UTrapframe *utf)
+{
+  80126f:	55                   	push   %ebp
+  801270:	89 e5                	mov    %esp,%ebp
+  801272:	53                   	push   %ebx
+  801273:	83 ec 10             	sub    $0x10,%esp
+  801276:	8b 45 08             	mov    0x8(%ebp),%eax
+  // just has fewer error checks
+  
+  void *addr = (void*)utf->utf_fault_va;
+  801279:	8b 18                	mov    (%eax),%ebx
+  uint32_t err = utf->utf_err;
+  int r;
+
+  if (mmap_fault(utf))
+  80127b:	50                   	push   %eax
+  80127c:	e8 1e 1e 00 00       	call   80309f <mmap_fault>
+  801281:	83 c4 10             	add    $0x10,%esp
+  801284:	84 c0                	test   %al,%al
+  801286:	74 05                	je     80128d <shared_pgfault+0x1e>
+  }
+
+  if ( (r = sys_page_unmap(0, PFTEMP)) < 0) {
+    panic("sys_page_unmap: %e", r);
+  }
+}
+  801288:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80128b:	c9                   	leave
+  80128c:	c3                   	ret
+  addr = ROUNDDOWN(addr, PGSIZE);
+  80128d:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if ( (r = sys_page_alloc(0, PFTEMP, (PTE_P | PTE_U | PTE_W))) < 0) {
+  801293:	83 ec 04             	sub    $0x4,%esp
+  801296:	6a 07                	push   $0x7
+  801298:	68 00 f0 7f 00       	push   $0x7ff000
+  80129d:	6a 00                	push   $0x0
+  80129f:	e8 1f fa ff ff       	call   800cc3 <sys_page_alloc>
+  8012a4:	83 c4 10             	add    $0x10,%esp
+  8012a7:	85 c0                	test   %eax,%eax
+  8012a9:	78 5b                	js     801306 <shared_pgfault+0x97>
+  memmove(PFTEMP, addr, PGSIZE);
+  8012ab:	83 ec 04             	sub    $0x4,%esp
+  8012ae:	68 00 10 00 00       	push   $0x1000
+  8012b3:	53                   	push   %ebx
+  8012b4:	68 00 f0 7f 00       	push   $0x7ff000
+  8012b9:	e8 5c f7 ff ff       	call   800a1a <memmove>
+  if ( (r = sys_page_map(0, PFTEMP, 0, addr, (PTE_P | PTE_U | PTE_W))) < 0) {
+  8012be:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8012c5:	53                   	push   %ebx
+  8012c6:	6a 00                	push   $0x0
+  8012c8:	68 00 f0 7f 00       	push   $0x7ff000
+  8012cd:	6a 00                	push   $0x0
+  8012cf:	e8 32 fa ff ff       	call   800d06 <sys_page_map>
+  8012d4:	83 c4 20             	add    $0x20,%esp
+  8012d7:	85 c0                	test   %eax,%eax
+  8012d9:	78 40                	js     80131b <shared_pgfault+0xac>
+  if ( (r = sys_page_unmap(0, PFTEMP)) < 0) {
+  8012db:	83 ec 08             	sub    $0x8,%esp
+  8012de:	68 00 f0 7f 00       	push   $0x7ff000
+  8012e3:	6a 00                	push   $0x0
+  8012e5:	e8 5e fa ff ff       	call   800d48 <sys_page_unmap>
+  8012ea:	83 c4 10             	add    $0x10,%esp
+  8012ed:	85 c0                	test   %eax,%eax
+  8012ef:	79 97                	jns    801288 <shared_pgfault+0x19>
+    panic("sys_page_unmap: %e", r);
+  8012f1:	50                   	push   %eax
+  8012f2:	68 c9 3e 80 00       	push   $0x803ec9
+  8012f7:	68 b0 00 00 00       	push   $0xb0
+  8012fc:	68 7f 3e 80 00       	push   $0x803e7f
+  801301:	e8 28 24 00 00       	call   80372e <_panic>
+    panic("sys_page_alloc: %e", r);
+  801306:	50                   	push   %eax
+  801307:	68 a5 3e 80 00       	push   $0x803ea5
+  80130c:	68 a4 00 00 00       	push   $0xa4
+  801311:	68 7f 3e 80 00       	push   $0x803e7f
+  801316:	e8 13 24 00 00       	call   80372e <_panic>
+    panic("sys_page_map: %e", r);
+  80131b:	50                   	push   %eax
+  80131c:	68 b8 3e 80 00       	push   $0x803eb8
+  801321:	68 ac 00 00 00       	push   $0xac
+  801326:	68 7f 3e 80 00       	push   $0x803e7f
+  80132b:	e8 fe 23 00 00       	call   80372e <_panic>
+
+00801330 <fork>:
+{
+  801330:	55                   	push   %ebp
+  801331:	89 e5                	mov    %esp,%ebp
+  801333:	53                   	push   %ebx
+  801334:	83 ec 04             	sub    $0x4,%esp
+  parent_id = sys_getenvid();
+  801337:	e8 06 f9 ff ff       	call   800c42 <sys_getenvid>
+  set_pgfault_handler(pgfault);
+  80133c:	83 ec 0c             	sub    $0xc,%esp
+  80133f:	68 72 11 80 00       	push   $0x801172
+  801344:	e8 2b 24 00 00       	call   803774 <set_pgfault_handler>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+  envid_t ret;
+  __asm __volatile("int %2"
+  801349:	b8 07 00 00 00       	mov    $0x7,%eax
+  80134e:	cd 30                	int    $0x30
+  801350:	89 c3                	mov    %eax,%ebx
+  if (envid < 0) {
+  801352:	83 c4 10             	add    $0x10,%esp
+  801355:	85 c0                	test   %eax,%eax
+  801357:	78 66                	js     8013bf <fork+0x8f>
+  } else if (envid == 0) {
+  801359:	74 76                	je     8013d1 <fork+0xa1>
+  if ( (error = sys_page_map_range(0, 0, UXSTACKTOP - PGSIZE,
+  80135b:	83 ec 0c             	sub    $0xc,%esp
+  80135e:	6a 01                	push   $0x1
+  801360:	50                   	push   %eax
+  801361:	68 00 f0 bf ee       	push   $0xeebff000
+  801366:	6a 00                	push   $0x0
+  801368:	6a 00                	push   $0x0
+  80136a:	e8 1b fa ff ff       	call   800d8a <sys_page_map_range>
+  80136f:	83 c4 20             	add    $0x20,%esp
+  801372:	85 c0                	test   %eax,%eax
+  801374:	78 77                	js     8013ed <fork+0xbd>
+  if ( (error = sys_page_alloc(envid,
+  801376:	83 ec 04             	sub    $0x4,%esp
+  801379:	6a 07                	push   $0x7
+  80137b:	68 00 f0 bf ee       	push   $0xeebff000
+  801380:	53                   	push   %ebx
+  801381:	e8 3d f9 ff ff       	call   800cc3 <sys_page_alloc>
+  801386:	83 c4 10             	add    $0x10,%esp
+  801389:	85 c0                	test   %eax,%eax
+  80138b:	78 72                	js     8013ff <fork+0xcf>
+          thisenv->env_pgfault_upcall)) < 0) {
+  80138d:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  801392:	8b 40 64             	mov    0x64(%eax),%eax
+  if ( (error = sys_env_set_pgfault_upcall(envid,
+  801395:	83 ec 08             	sub    $0x8,%esp
+  801398:	50                   	push   %eax
+  801399:	53                   	push   %ebx
+  80139a:	e8 99 fb ff ff       	call   800f38 <sys_env_set_pgfault_upcall>
+  80139f:	83 c4 10             	add    $0x10,%esp
+  8013a2:	85 c0                	test   %eax,%eax
+  8013a4:	78 6b                	js     801411 <fork+0xe1>
+  if ( (error = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+  8013a6:	83 ec 08             	sub    $0x8,%esp
+  8013a9:	6a 02                	push   $0x2
+  8013ab:	53                   	push   %ebx
+  8013ac:	e8 03 fb ff ff       	call   800eb4 <sys_env_set_status>
+  8013b1:	83 c4 10             	add    $0x10,%esp
+  8013b4:	85 c0                	test   %eax,%eax
+  8013b6:	78 6b                	js     801423 <fork+0xf3>
+}
+  8013b8:	89 d8                	mov    %ebx,%eax
+  8013ba:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013bd:	c9                   	leave
+  8013be:	c3                   	ret
+    panic("sys_exofork: %e", envid);
+  8013bf:	50                   	push   %eax
+  8013c0:	68 dc 3e 80 00       	push   $0x803edc
+  8013c5:	6a 5e                	push   $0x5e
+  8013c7:	68 7f 3e 80 00       	push   $0x803e7f
+  8013cc:	e8 5d 23 00 00       	call   80372e <_panic>
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8013d1:	e8 6c f8 ff ff       	call   800c42 <sys_getenvid>
+  8013d6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8013db:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8013de:	c1 e0 04             	shl    $0x4,%eax
+  8013e1:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8013e6:	a3 a0 68 80 00       	mov    %eax,0x8068a0
+    return 0;
+  8013eb:	eb cb                	jmp    8013b8 <fork+0x88>
+    panic("sys_page_map_range: %e", error);
+  8013ed:	50                   	push   %eax
+  8013ee:	68 ec 3e 80 00       	push   $0x803eec
+  8013f3:	6a 69                	push   $0x69
+  8013f5:	68 7f 3e 80 00       	push   $0x803e7f
+  8013fa:	e8 2f 23 00 00       	call   80372e <_panic>
+    panic("sys_page_alloc: %e", error);
+  8013ff:	50                   	push   %eax
+  801400:	68 a5 3e 80 00       	push   $0x803ea5
+  801405:	6a 70                	push   $0x70
+  801407:	68 7f 3e 80 00       	push   $0x803e7f
+  80140c:	e8 1d 23 00 00       	call   80372e <_panic>
+    panic("sys_env_set_pgfault_upcall: %e", error);
+  801411:	50                   	push   %eax
+  801412:	68 1c 3f 80 00       	push   $0x803f1c
+  801417:	6a 76                	push   $0x76
+  801419:	68 7f 3e 80 00       	push   $0x803e7f
+  80141e:	e8 0b 23 00 00       	call   80372e <_panic>
+    panic("sys_env_set_status: %e", error);
+  801423:	50                   	push   %eax
+  801424:	68 03 3f 80 00       	push   $0x803f03
+  801429:	6a 7a                	push   $0x7a
+  80142b:	68 7f 3e 80 00       	push   $0x803e7f
+  801430:	e8 f9 22 00 00       	call   80372e <_panic>
+
+00801435 <kfork>:
+{
+  801435:	55                   	push   %ebp
+  801436:	89 e5                	mov    %esp,%ebp
+  801438:	53                   	push   %ebx
+  801439:	83 ec 10             	sub    $0x10,%esp
+  set_pgfault_handler(pgfault);
+  80143c:	68 72 11 80 00       	push   $0x801172
+  801441:	e8 2e 23 00 00       	call   803774 <set_pgfault_handler>
+  if ((envid = sys_fork()) == 0)
+  801446:	e8 4a fa ff ff       	call   800e95 <sys_fork>
+  80144b:	89 c3                	mov    %eax,%ebx
+  80144d:	83 c4 10             	add    $0x10,%esp
+  801450:	85 c0                	test   %eax,%eax
+  801452:	74 07                	je     80145b <kfork+0x26>
+}
+  801454:	89 d8                	mov    %ebx,%eax
+  801456:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801459:	c9                   	leave
+  80145a:	c3                   	ret
+    thisenv = &envs[ENVX(sys_getenvid())];
+  80145b:	e8 e2 f7 ff ff       	call   800c42 <sys_getenvid>
+  801460:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801465:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  801468:	c1 e0 04             	shl    $0x4,%eax
+  80146b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801470:	a3 a0 68 80 00       	mov    %eax,0x8068a0
+  return envid;
+  801475:	eb dd                	jmp    801454 <kfork+0x1f>
+
+00801477 <sfork>:
+
+int
+sfork(void)
+{
+  801477:	55                   	push   %ebp
+  801478:	89 e5                	mov    %esp,%ebp
+  80147a:	53                   	push   %ebx
+  80147b:	83 ec 04             	sub    $0x4,%esp
+  envid_t envid, parent_id;
+  int error;
+
+  parent_id = sys_getenvid();
+  80147e:	e8 bf f7 ff ff       	call   800c42 <sys_getenvid>
+
+  // set up page fault handler
+  set_pgfault_handler(shared_pgfault);
+  801483:	83 ec 0c             	sub    $0xc,%esp
+  801486:	68 6f 12 80 00       	push   $0x80126f
+  80148b:	e8 e4 22 00 00       	call   803774 <set_pgfault_handler>
+  801490:	b8 07 00 00 00       	mov    $0x7,%eax
+  801495:	cd 30                	int    $0x30
+  801497:	89 c3                	mov    %eax,%ebx
+
+  // create a child with sys_exofork
+  envid = sys_exofork();
+  
+  if (envid < 0) {
+  801499:	83 c4 10             	add    $0x10,%esp
+  80149c:	85 c0                	test   %eax,%eax
+  80149e:	78 09                	js     8014a9 <sfork+0x32>
+    panic("sys_exofork: %e", envid);
+  } else if (envid == 0) {
+  8014a0:	75 1c                	jne    8014be <sfork+0x47>
+  if ( (error = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+    panic("sys_env_set_status: %e", error);
+  }
+
+  return envid;
+}
+  8014a2:	89 d8                	mov    %ebx,%eax
+  8014a4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014a7:	c9                   	leave
+  8014a8:	c3                   	ret
+    panic("sys_exofork: %e", envid);
+  8014a9:	50                   	push   %eax
+  8014aa:	68 dc 3e 80 00       	push   $0x803edc
+  8014af:	68 c3 00 00 00       	push   $0xc3
+  8014b4:	68 7f 3e 80 00       	push   $0x803e7f
+  8014b9:	e8 70 22 00 00       	call   80372e <_panic>
+  if ( (error = sys_page_map_range(0, 0, USTACKTOP - PGSIZE,
+  8014be:	83 ec 0c             	sub    $0xc,%esp
+  8014c1:	6a 00                	push   $0x0
+  8014c3:	50                   	push   %eax
+  8014c4:	68 00 d0 bf ee       	push   $0xeebfd000
+  8014c9:	6a 00                	push   $0x0
+  8014cb:	6a 00                	push   $0x0
+  8014cd:	e8 b8 f8 ff ff       	call   800d8a <sys_page_map_range>
+  8014d2:	83 c4 20             	add    $0x20,%esp
+  8014d5:	85 c0                	test   %eax,%eax
+  8014d7:	78 79                	js     801552 <sfork+0xdb>
+  if ( (error = sys_page_map_range(0, (void *) (USTACKTOP - PGSIZE), PGSIZE,
+  8014d9:	83 ec 0c             	sub    $0xc,%esp
+  8014dc:	6a 01                	push   $0x1
+  8014de:	53                   	push   %ebx
+  8014df:	68 00 10 00 00       	push   $0x1000
+  8014e4:	68 00 d0 bf ee       	push   $0xeebfd000
+  8014e9:	6a 00                	push   $0x0
+  8014eb:	e8 9a f8 ff ff       	call   800d8a <sys_page_map_range>
+  8014f0:	83 c4 20             	add    $0x20,%esp
+  8014f3:	85 c0                	test   %eax,%eax
+  8014f5:	78 70                	js     801567 <sfork+0xf0>
+  if ( (error = sys_page_alloc(envid,
+  8014f7:	83 ec 04             	sub    $0x4,%esp
+  8014fa:	6a 07                	push   $0x7
+  8014fc:	68 00 f0 bf ee       	push   $0xeebff000
+  801501:	53                   	push   %ebx
+  801502:	e8 bc f7 ff ff       	call   800cc3 <sys_page_alloc>
+  801507:	83 c4 10             	add    $0x10,%esp
+  80150a:	85 c0                	test   %eax,%eax
+  80150c:	78 6e                	js     80157c <sfork+0x105>
+          thisenv->env_pgfault_upcall)) < 0) {
+  80150e:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  801513:	8b 40 64             	mov    0x64(%eax),%eax
+  if ( (error = sys_env_set_pgfault_upcall(envid,
+  801516:	83 ec 08             	sub    $0x8,%esp
+  801519:	50                   	push   %eax
+  80151a:	53                   	push   %ebx
+  80151b:	e8 18 fa ff ff       	call   800f38 <sys_env_set_pgfault_upcall>
+  801520:	83 c4 10             	add    $0x10,%esp
+  801523:	85 c0                	test   %eax,%eax
+  801525:	78 6a                	js     801591 <sfork+0x11a>
+  if ( (error = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+  801527:	83 ec 08             	sub    $0x8,%esp
+  80152a:	6a 02                	push   $0x2
+  80152c:	53                   	push   %ebx
+  80152d:	e8 82 f9 ff ff       	call   800eb4 <sys_env_set_status>
+  801532:	83 c4 10             	add    $0x10,%esp
+  801535:	85 c0                	test   %eax,%eax
+  801537:	0f 89 65 ff ff ff    	jns    8014a2 <sfork+0x2b>
+    panic("sys_env_set_status: %e", error);
+  80153d:	50                   	push   %eax
+  80153e:	68 03 3f 80 00       	push   $0x803f03
+  801543:	68 e4 00 00 00       	push   $0xe4
+  801548:	68 7f 3e 80 00       	push   $0x803e7f
+  80154d:	e8 dc 21 00 00       	call   80372e <_panic>
+    panic("sys_page_map_range: %e", error);
+  801552:	50                   	push   %eax
+  801553:	68 ec 3e 80 00       	push   $0x803eec
+  801558:	68 ce 00 00 00       	push   $0xce
+  80155d:	68 7f 3e 80 00       	push   $0x803e7f
+  801562:	e8 c7 21 00 00       	call   80372e <_panic>
+    panic("sys_page_map_range: %e", error);
+  801567:	50                   	push   %eax
+  801568:	68 ec 3e 80 00       	push   $0x803eec
+  80156d:	68 d3 00 00 00       	push   $0xd3
+  801572:	68 7f 3e 80 00       	push   $0x803e7f
+  801577:	e8 b2 21 00 00       	call   80372e <_panic>
+    panic("sys_page_alloc: %e", error);
+  80157c:	50                   	push   %eax
+  80157d:	68 a5 3e 80 00       	push   $0x803ea5
+  801582:	68 da 00 00 00       	push   $0xda
+  801587:	68 7f 3e 80 00       	push   $0x803e7f
+  80158c:	e8 9d 21 00 00       	call   80372e <_panic>
+    panic("sys_env_set_pgfault_upcall: %e", error);
+  801591:	50                   	push   %eax
+  801592:	68 1c 3f 80 00       	push   $0x803f1c
+  801597:	68 e0 00 00 00       	push   $0xe0
+  80159c:	68 7f 3e 80 00       	push   $0x803e7f
+  8015a1:	e8 88 21 00 00       	call   80372e <_panic>
+
+008015a6 <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  8015a6:	55                   	push   %ebp
+  8015a7:	89 e5                	mov    %esp,%ebp
+  8015a9:	57                   	push   %edi
+  8015aa:	56                   	push   %esi
+  8015ab:	53                   	push   %ebx
+  8015ac:	83 ec 14             	sub    $0x14,%esp
+  8015af:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8015b2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8015b5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8015b8:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  8015bb:	85 c0                	test   %eax,%eax
+  8015bd:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8015c2:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  8015c5:	ff 33                	push   (%ebx)
+  8015c7:	50                   	push   %eax
+  8015c8:	e8 ce f9 ff ff       	call   800f9b <sys_ipc_recv>
+  8015cd:	83 c4 10             	add    $0x10,%esp
+  8015d0:	85 c0                	test   %eax,%eax
+  8015d2:	78 39                	js     80160d <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  8015d4:	85 ff                	test   %edi,%edi
+  8015d6:	74 0a                	je     8015e2 <ipc_recv_pages+0x3c>
+  8015d8:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  8015dd:	8b 40 7c             	mov    0x7c(%eax),%eax
+  8015e0:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  8015e2:	85 f6                	test   %esi,%esi
+  8015e4:	74 0d                	je     8015f3 <ipc_recv_pages+0x4d>
+  8015e6:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  8015eb:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  8015f1:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  8015f3:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  8015f8:	8b 40 74             	mov    0x74(%eax),%eax
+  8015fb:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  8015fd:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  801602:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  801605:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801608:	5b                   	pop    %ebx
+  801609:	5e                   	pop    %esi
+  80160a:	5f                   	pop    %edi
+  80160b:	5d                   	pop    %ebp
+  80160c:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  80160d:	85 ff                	test   %edi,%edi
+  80160f:	74 06                	je     801617 <ipc_recv_pages+0x71>
+  801611:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  801617:	85 f6                	test   %esi,%esi
+  801619:	74 06                	je     801621 <ipc_recv_pages+0x7b>
+  80161b:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  801621:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  801627:	eb dc                	jmp    801605 <ipc_recv_pages+0x5f>
+
+00801629 <ipc_recv>:
+{
+  801629:	55                   	push   %ebp
+  80162a:	89 e5                	mov    %esp,%ebp
+  80162c:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  80162f:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  801636:	ff 75 10             	push   0x10(%ebp)
+  801639:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80163c:	50                   	push   %eax
+  80163d:	ff 75 0c             	push   0xc(%ebp)
+  801640:	ff 75 08             	push   0x8(%ebp)
+  801643:	e8 5e ff ff ff       	call   8015a6 <ipc_recv_pages>
+}
+  801648:	c9                   	leave
+  801649:	c3                   	ret
+
+0080164a <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  80164a:	55                   	push   %ebp
+  80164b:	89 e5                	mov    %esp,%ebp
+  80164d:	57                   	push   %edi
+  80164e:	56                   	push   %esi
+  80164f:	53                   	push   %ebx
+  801650:	83 ec 0c             	sub    $0xc,%esp
+  801653:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801656:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801659:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  80165c:	89 c3                	mov    %eax,%ebx
+  80165e:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  801664:	85 c0                	test   %eax,%eax
+  801666:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80166b:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  80166e:	83 ec 0c             	sub    $0xc,%esp
+  801671:	ff 75 14             	push   0x14(%ebp)
+  801674:	ff 75 18             	push   0x18(%ebp)
+  801677:	53                   	push   %ebx
+  801678:	56                   	push   %esi
+  801679:	57                   	push   %edi
+  80167a:	e8 fb f8 ff ff       	call   800f7a <sys_ipc_try_send>
+  80167f:	83 c4 20             	add    $0x20,%esp
+  801682:	85 c0                	test   %eax,%eax
+  801684:	79 1e                	jns    8016a4 <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  801686:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801689:	75 07                	jne    801692 <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  80168b:	e8 d1 f5 ff ff       	call   800c61 <sys_yield>
+  801690:	eb dc                	jmp    80166e <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  801692:	50                   	push   %eax
+  801693:	68 3b 3f 80 00       	push   $0x803f3b
+  801698:	6a 5c                	push   $0x5c
+  80169a:	68 48 3f 80 00       	push   $0x803f48
+  80169f:	e8 8a 20 00 00       	call   80372e <_panic>
+  }
+}
+  8016a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016a7:	5b                   	pop    %ebx
+  8016a8:	5e                   	pop    %esi
+  8016a9:	5f                   	pop    %edi
+  8016aa:	5d                   	pop    %ebp
+  8016ab:	c3                   	ret
+
+008016ac <ipc_send>:
+{
+  8016ac:	55                   	push   %ebp
+  8016ad:	89 e5                	mov    %esp,%ebp
+  8016af:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  8016b2:	ff 75 14             	push   0x14(%ebp)
+  8016b5:	6a 01                	push   $0x1
+  8016b7:	ff 75 10             	push   0x10(%ebp)
+  8016ba:	ff 75 0c             	push   0xc(%ebp)
+  8016bd:	ff 75 08             	push   0x8(%ebp)
+  8016c0:	e8 85 ff ff ff       	call   80164a <ipc_send_pages>
+}
+  8016c5:	83 c4 20             	add    $0x20,%esp
+  8016c8:	c9                   	leave
+  8016c9:	c3                   	ret
+
+008016ca <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8016ca:	55                   	push   %ebp
+  8016cb:	89 e5                	mov    %esp,%ebp
+  8016cd:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  8016d0:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  8016d5:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8016d8:	c1 e0 04             	shl    $0x4,%eax
+  8016db:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8016e0:	8b 40 50             	mov    0x50(%eax),%eax
+  8016e3:	39 c8                	cmp    %ecx,%eax
+  8016e5:	74 12                	je     8016f9 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  8016e7:	83 c2 01             	add    $0x1,%edx
+  8016ea:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  8016f0:	75 e3                	jne    8016d5 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  8016f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016f7:	eb 0e                	jmp    801707 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  8016f9:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8016fc:	c1 e0 04             	shl    $0x4,%eax
+  8016ff:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801704:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  801707:	5d                   	pop    %ebp
+  801708:	c3                   	ret
+
+00801709 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801709:	55                   	push   %ebp
+  80170a:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80170c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80170f:	05 00 00 00 30       	add    $0x30000000,%eax
+  801714:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801717:	5d                   	pop    %ebp
+  801718:	c3                   	ret
+
+00801719 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801719:	55                   	push   %ebp
+  80171a:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80171c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80171f:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  801722:	66 b8 00 00          	mov    $0x0,%ax
+  801726:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80172b:	5d                   	pop    %ebp
+  80172c:	c3                   	ret
+
+0080172d <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80172d:	55                   	push   %ebp
+  80172e:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  801730:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801735:	eb 02                	jmp    801739 <fd_alloc+0xc>
+  801737:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801739:	89 c2                	mov    %eax,%edx
+  80173b:	c1 ea 16             	shr    $0x16,%edx
+  80173e:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801745:	f6 c2 01             	test   $0x1,%dl
+  801748:	74 2b                	je     801775 <fd_alloc+0x48>
+  80174a:	89 c2                	mov    %eax,%edx
+  80174c:	c1 ea 0c             	shr    $0xc,%edx
+  80174f:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801756:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80175c:	f6 c1 01             	test   $0x1,%cl
+  80175f:	74 14                	je     801775 <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  801761:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801767:	75 ce                	jne    801737 <fd_alloc+0xa>
+  801769:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  80176e:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801773:	eb 05                	jmp    80177a <fd_alloc+0x4d>
+      return 0;
+  801775:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  80177a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80177d:	89 02                	mov    %eax,(%edx)
+}
+  80177f:	89 c8                	mov    %ecx,%eax
+  801781:	5d                   	pop    %ebp
+  801782:	c3                   	ret
+
+00801783 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801783:	55                   	push   %ebp
+  801784:	89 e5                	mov    %esp,%ebp
+  801786:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  801789:	83 f8 1f             	cmp    $0x1f,%eax
+  80178c:	77 30                	ja     8017be <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  80178e:	c1 e0 0c             	shl    $0xc,%eax
+  801791:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801796:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80179c:	f6 c2 01             	test   $0x1,%dl
+  80179f:	74 24                	je     8017c5 <fd_lookup+0x42>
+  8017a1:	89 c2                	mov    %eax,%edx
+  8017a3:	c1 ea 0c             	shr    $0xc,%edx
+  8017a6:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8017ad:	f6 c2 01             	test   $0x1,%dl
+  8017b0:	74 1a                	je     8017cc <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  8017b2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8017b5:	89 02                	mov    %eax,(%edx)
+  return 0;
+  8017b7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017bc:	5d                   	pop    %ebp
+  8017bd:	c3                   	ret
+    return -E_INVAL;
+  8017be:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017c3:	eb f7                	jmp    8017bc <fd_lookup+0x39>
+    return -E_INVAL;
+  8017c5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017ca:	eb f0                	jmp    8017bc <fd_lookup+0x39>
+  8017cc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017d1:	eb e9                	jmp    8017bc <fd_lookup+0x39>
+
+008017d3 <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8017d3:	55                   	push   %ebp
+  8017d4:	89 e5                	mov    %esp,%ebp
+  8017d6:	53                   	push   %ebx
+  8017d7:	83 ec 04             	sub    $0x4,%esp
+  8017da:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  8017dd:	b8 d0 3f 80 00       	mov    $0x803fd0,%eax
+  8017e2:	8b 18                	mov    (%eax),%ebx
+  8017e4:	85 db                	test   %ebx,%ebx
+  8017e6:	74 0e                	je     8017f6 <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  8017e8:	83 c0 04             	add    $0x4,%eax
+  8017eb:	39 13                	cmp    %edx,(%ebx)
+  8017ed:	75 f3                	jne    8017e2 <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  8017ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017f4:	eb 1f                	jmp    801815 <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8017f6:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  8017fb:	8b 40 48             	mov    0x48(%eax),%eax
+  8017fe:	83 ec 04             	sub    $0x4,%esp
+  801801:	52                   	push   %edx
+  801802:	50                   	push   %eax
+  801803:	68 54 3f 80 00       	push   $0x803f54
+  801808:	e8 99 ea ff ff       	call   8002a6 <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  80180d:	83 c4 10             	add    $0x10,%esp
+  801810:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  801815:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801818:	89 1a                	mov    %ebx,(%edx)
+}
+  80181a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80181d:	c9                   	leave
+  80181e:	c3                   	ret
+
+0080181f <fd_close>:
+{
+  80181f:	55                   	push   %ebp
+  801820:	89 e5                	mov    %esp,%ebp
+  801822:	57                   	push   %edi
+  801823:	56                   	push   %esi
+  801824:	53                   	push   %ebx
+  801825:	83 ec 24             	sub    $0x24,%esp
+  801828:	8b 75 08             	mov    0x8(%ebp),%esi
+  80182b:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80182e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801831:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801832:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801838:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80183b:	50                   	push   %eax
+  80183c:	e8 42 ff ff ff       	call   801783 <fd_lookup>
+  801841:	89 c3                	mov    %eax,%ebx
+  801843:	83 c4 10             	add    $0x10,%esp
+  801846:	85 c0                	test   %eax,%eax
+  801848:	78 05                	js     80184f <fd_close+0x30>
+      || fd != fd2)
+  80184a:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80184d:	74 16                	je     801865 <fd_close+0x46>
+    return must_exist ? r : 0;
+  80184f:	89 f8                	mov    %edi,%eax
+  801851:	84 c0                	test   %al,%al
+  801853:	b8 00 00 00 00       	mov    $0x0,%eax
+  801858:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80185b:	89 d8                	mov    %ebx,%eax
+  80185d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801860:	5b                   	pop    %ebx
+  801861:	5e                   	pop    %esi
+  801862:	5f                   	pop    %edi
+  801863:	5d                   	pop    %ebp
+  801864:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801865:	83 ec 08             	sub    $0x8,%esp
+  801868:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80186b:	50                   	push   %eax
+  80186c:	ff 36                	push   (%esi)
+  80186e:	e8 60 ff ff ff       	call   8017d3 <dev_lookup>
+  801873:	89 c3                	mov    %eax,%ebx
+  801875:	83 c4 10             	add    $0x10,%esp
+  801878:	85 c0                	test   %eax,%eax
+  80187a:	78 1a                	js     801896 <fd_close+0x77>
+    if (dev->dev_close)
+  80187c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80187f:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  801882:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  801887:	85 c0                	test   %eax,%eax
+  801889:	74 0b                	je     801896 <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  80188b:	83 ec 0c             	sub    $0xc,%esp
+  80188e:	56                   	push   %esi
+  80188f:	ff d0                	call   *%eax
+  801891:	89 c3                	mov    %eax,%ebx
+  801893:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  801896:	83 ec 08             	sub    $0x8,%esp
+  801899:	56                   	push   %esi
+  80189a:	6a 00                	push   $0x0
+  80189c:	e8 a7 f4 ff ff       	call   800d48 <sys_page_unmap>
+  return r;
+  8018a1:	83 c4 10             	add    $0x10,%esp
+  8018a4:	eb b5                	jmp    80185b <fd_close+0x3c>
+
+008018a6 <close>:
+
+int
+close(int fdnum)
+{
+  8018a6:	55                   	push   %ebp
+  8018a7:	89 e5                	mov    %esp,%ebp
+  8018a9:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8018ac:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018af:	50                   	push   %eax
+  8018b0:	ff 75 08             	push   0x8(%ebp)
+  8018b3:	e8 cb fe ff ff       	call   801783 <fd_lookup>
+  8018b8:	83 c4 10             	add    $0x10,%esp
+  8018bb:	85 c0                	test   %eax,%eax
+  8018bd:	79 02                	jns    8018c1 <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  8018bf:	c9                   	leave
+  8018c0:	c3                   	ret
+    return fd_close(fd, 1);
+  8018c1:	83 ec 08             	sub    $0x8,%esp
+  8018c4:	6a 01                	push   $0x1
+  8018c6:	ff 75 f4             	push   -0xc(%ebp)
+  8018c9:	e8 51 ff ff ff       	call   80181f <fd_close>
+  8018ce:	83 c4 10             	add    $0x10,%esp
+  8018d1:	eb ec                	jmp    8018bf <close+0x19>
+
+008018d3 <close_all>:
+
+void
+close_all(void)
+{
+  8018d3:	55                   	push   %ebp
+  8018d4:	89 e5                	mov    %esp,%ebp
+  8018d6:	53                   	push   %ebx
+  8018d7:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  8018da:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  8018df:	83 ec 0c             	sub    $0xc,%esp
+  8018e2:	53                   	push   %ebx
+  8018e3:	e8 be ff ff ff       	call   8018a6 <close>
+  for (i = 0; i < MAXFD; i++)
+  8018e8:	83 c3 01             	add    $0x1,%ebx
+  8018eb:	83 c4 10             	add    $0x10,%esp
+  8018ee:	83 fb 20             	cmp    $0x20,%ebx
+  8018f1:	75 ec                	jne    8018df <close_all+0xc>
+}
+  8018f3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018f6:	c9                   	leave
+  8018f7:	c3                   	ret
+
+008018f8 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8018f8:	55                   	push   %ebp
+  8018f9:	89 e5                	mov    %esp,%ebp
+  8018fb:	57                   	push   %edi
+  8018fc:	56                   	push   %esi
+  8018fd:	53                   	push   %ebx
+  8018fe:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801901:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801904:	50                   	push   %eax
+  801905:	ff 75 08             	push   0x8(%ebp)
+  801908:	e8 76 fe ff ff       	call   801783 <fd_lookup>
+  80190d:	89 c6                	mov    %eax,%esi
+  80190f:	83 c4 10             	add    $0x10,%esp
+  801912:	85 c0                	test   %eax,%eax
+  801914:	0f 88 0a 01 00 00    	js     801a24 <dup+0x12c>
+    return r;
+  close(newfdnum);
+  80191a:	83 ec 0c             	sub    $0xc,%esp
+  80191d:	ff 75 0c             	push   0xc(%ebp)
+  801920:	e8 81 ff ff ff       	call   8018a6 <close>
+
+  newfd = INDEX2FD(newfdnum);
+  801925:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801928:	c1 e0 0c             	shl    $0xc,%eax
+  80192b:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  801931:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  801934:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801937:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  80193a:	89 04 24             	mov    %eax,(%esp)
+  80193d:	e8 d7 fd ff ff       	call   801719 <fd2data>
+  801942:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  801944:	89 3c 24             	mov    %edi,(%esp)
+  801947:	e8 cd fd ff ff       	call   801719 <fd2data>
+  80194c:	83 c4 10             	add    $0x10,%esp
+  80194f:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801952:	89 f3                	mov    %esi,%ebx
+  801954:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  80195a:	89 c6                	mov    %eax,%esi
+  80195c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80195f:	89 cf                	mov    %ecx,%edi
+  801961:	eb 0c                	jmp    80196f <dup+0x77>
+  801963:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801969:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80196f:	39 fb                	cmp    %edi,%ebx
+  801971:	74 7b                	je     8019ee <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  801973:	89 d8                	mov    %ebx,%eax
+  801975:	c1 e8 16             	shr    $0x16,%eax
+  801978:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80197f:	a8 01                	test   $0x1,%al
+  801981:	74 e0                	je     801963 <dup+0x6b>
+  801983:	89 d8                	mov    %ebx,%eax
+  801985:	c1 e8 0c             	shr    $0xc,%eax
+  801988:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80198f:	f6 c2 01             	test   $0x1,%dl
+  801992:	74 cf                	je     801963 <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  801994:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  80199b:	83 ec 0c             	sub    $0xc,%esp
+  80199e:	25 07 0e 00 00       	and    $0xe07,%eax
+  8019a3:	50                   	push   %eax
+  8019a4:	56                   	push   %esi
+  8019a5:	6a 00                	push   $0x0
+  8019a7:	53                   	push   %ebx
+  8019a8:	6a 00                	push   $0x0
+  8019aa:	e8 57 f3 ff ff       	call   800d06 <sys_page_map>
+  8019af:	83 c4 20             	add    $0x20,%esp
+  8019b2:	85 c0                	test   %eax,%eax
+  8019b4:	79 ad                	jns    801963 <dup+0x6b>
+  8019b6:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8019b9:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  8019bb:	83 ec 08             	sub    $0x8,%esp
+  8019be:	ff 75 d4             	push   -0x2c(%ebp)
+  8019c1:	6a 00                	push   $0x0
+  8019c3:	e8 80 f3 ff ff       	call   800d48 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8019c8:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  8019cb:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  8019d1:	83 c4 10             	add    $0x10,%esp
+  8019d4:	39 df                	cmp    %ebx,%edi
+  8019d6:	74 4c                	je     801a24 <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  8019d8:	83 ec 08             	sub    $0x8,%esp
+  8019db:	57                   	push   %edi
+  8019dc:	6a 00                	push   $0x0
+  8019de:	e8 65 f3 ff ff       	call   800d48 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8019e3:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  8019e9:	83 c4 10             	add    $0x10,%esp
+  8019ec:	eb e6                	jmp    8019d4 <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8019ee:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8019f1:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8019f4:	89 c8                	mov    %ecx,%eax
+  8019f6:	c1 e8 0c             	shr    $0xc,%eax
+  8019f9:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801a00:	83 ec 0c             	sub    $0xc,%esp
+  801a03:	25 07 0e 00 00       	and    $0xe07,%eax
+  801a08:	50                   	push   %eax
+  801a09:	ff 75 d4             	push   -0x2c(%ebp)
+  801a0c:	6a 00                	push   $0x0
+  801a0e:	51                   	push   %ecx
+  801a0f:	6a 00                	push   $0x0
+  801a11:	e8 f0 f2 ff ff       	call   800d06 <sys_page_map>
+  801a16:	89 c6                	mov    %eax,%esi
+  801a18:	83 c4 20             	add    $0x20,%esp
+  801a1b:	85 c0                	test   %eax,%eax
+  801a1d:	78 9c                	js     8019bb <dup+0xc3>
+  return newfdnum;
+  801a1f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a22:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  801a24:	89 f0                	mov    %esi,%eax
+  801a26:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a29:	5b                   	pop    %ebx
+  801a2a:	5e                   	pop    %esi
+  801a2b:	5f                   	pop    %edi
+  801a2c:	5d                   	pop    %ebp
+  801a2d:	c3                   	ret
+
+00801a2e <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801a2e:	55                   	push   %ebp
+  801a2f:	89 e5                	mov    %esp,%ebp
+  801a31:	56                   	push   %esi
+  801a32:	53                   	push   %ebx
+  801a33:	83 ec 18             	sub    $0x18,%esp
+  801a36:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a39:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a3c:	50                   	push   %eax
+  801a3d:	56                   	push   %esi
+  801a3e:	e8 40 fd ff ff       	call   801783 <fd_lookup>
+  801a43:	83 c4 10             	add    $0x10,%esp
+  801a46:	85 c0                	test   %eax,%eax
+  801a48:	78 3c                	js     801a86 <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801a4a:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801a4d:	83 ec 08             	sub    $0x8,%esp
+  801a50:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a53:	50                   	push   %eax
+  801a54:	ff 33                	push   (%ebx)
+  801a56:	e8 78 fd ff ff       	call   8017d3 <dev_lookup>
+  801a5b:	83 c4 10             	add    $0x10,%esp
+  801a5e:	85 c0                	test   %eax,%eax
+  801a60:	78 24                	js     801a86 <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801a62:	8b 43 08             	mov    0x8(%ebx),%eax
+  801a65:	83 e0 03             	and    $0x3,%eax
+  801a68:	83 f8 01             	cmp    $0x1,%eax
+  801a6b:	74 20                	je     801a8d <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  801a6d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a70:	8b 40 08             	mov    0x8(%eax),%eax
+  801a73:	85 c0                	test   %eax,%eax
+  801a75:	74 37                	je     801aae <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  801a77:	83 ec 04             	sub    $0x4,%esp
+  801a7a:	ff 75 10             	push   0x10(%ebp)
+  801a7d:	ff 75 0c             	push   0xc(%ebp)
+  801a80:	53                   	push   %ebx
+  801a81:	ff d0                	call   *%eax
+  801a83:	83 c4 10             	add    $0x10,%esp
+}
+  801a86:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a89:	5b                   	pop    %ebx
+  801a8a:	5e                   	pop    %esi
+  801a8b:	5d                   	pop    %ebp
+  801a8c:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801a8d:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  801a92:	8b 40 48             	mov    0x48(%eax),%eax
+  801a95:	83 ec 04             	sub    $0x4,%esp
+  801a98:	56                   	push   %esi
+  801a99:	50                   	push   %eax
+  801a9a:	68 95 3f 80 00       	push   $0x803f95
+  801a9f:	e8 02 e8 ff ff       	call   8002a6 <cprintf>
+    return -E_INVAL;
+  801aa4:	83 c4 10             	add    $0x10,%esp
+  801aa7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801aac:	eb d8                	jmp    801a86 <read+0x58>
+    return -E_NOT_SUPP;
+  801aae:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ab3:	eb d1                	jmp    801a86 <read+0x58>
+
+00801ab5 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801ab5:	55                   	push   %ebp
+  801ab6:	89 e5                	mov    %esp,%ebp
+  801ab8:	57                   	push   %edi
+  801ab9:	56                   	push   %esi
+  801aba:	53                   	push   %ebx
+  801abb:	83 ec 0c             	sub    $0xc,%esp
+  801abe:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801ac1:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  801ac4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ac9:	eb 02                	jmp    801acd <readn+0x18>
+  801acb:	01 c3                	add    %eax,%ebx
+  801acd:	39 f3                	cmp    %esi,%ebx
+  801acf:	73 21                	jae    801af2 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  801ad1:	83 ec 04             	sub    $0x4,%esp
+  801ad4:	89 f0                	mov    %esi,%eax
+  801ad6:	29 d8                	sub    %ebx,%eax
+  801ad8:	50                   	push   %eax
+  801ad9:	89 d8                	mov    %ebx,%eax
+  801adb:	03 45 0c             	add    0xc(%ebp),%eax
+  801ade:	50                   	push   %eax
+  801adf:	57                   	push   %edi
+  801ae0:	e8 49 ff ff ff       	call   801a2e <read>
+    if (m < 0)
+  801ae5:	83 c4 10             	add    $0x10,%esp
+  801ae8:	85 c0                	test   %eax,%eax
+  801aea:	78 04                	js     801af0 <readn+0x3b>
+      return m;
+    if (m == 0)
+  801aec:	75 dd                	jne    801acb <readn+0x16>
+  801aee:	eb 02                	jmp    801af2 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  801af0:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  801af2:	89 d8                	mov    %ebx,%eax
+  801af4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801af7:	5b                   	pop    %ebx
+  801af8:	5e                   	pop    %esi
+  801af9:	5f                   	pop    %edi
+  801afa:	5d                   	pop    %ebp
+  801afb:	c3                   	ret
+
+00801afc <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801afc:	55                   	push   %ebp
+  801afd:	89 e5                	mov    %esp,%ebp
+  801aff:	56                   	push   %esi
+  801b00:	53                   	push   %ebx
+  801b01:	83 ec 18             	sub    $0x18,%esp
+  801b04:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801b07:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b0a:	50                   	push   %eax
+  801b0b:	53                   	push   %ebx
+  801b0c:	e8 72 fc ff ff       	call   801783 <fd_lookup>
+  801b11:	83 c4 10             	add    $0x10,%esp
+  801b14:	85 c0                	test   %eax,%eax
+  801b16:	78 37                	js     801b4f <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801b18:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b1b:	83 ec 08             	sub    $0x8,%esp
+  801b1e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b21:	50                   	push   %eax
+  801b22:	ff 36                	push   (%esi)
+  801b24:	e8 aa fc ff ff       	call   8017d3 <dev_lookup>
+  801b29:	83 c4 10             	add    $0x10,%esp
+  801b2c:	85 c0                	test   %eax,%eax
+  801b2e:	78 1f                	js     801b4f <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801b30:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801b34:	74 20                	je     801b56 <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  801b36:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b39:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b3c:	85 c0                	test   %eax,%eax
+  801b3e:	74 37                	je     801b77 <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  801b40:	83 ec 04             	sub    $0x4,%esp
+  801b43:	ff 75 10             	push   0x10(%ebp)
+  801b46:	ff 75 0c             	push   0xc(%ebp)
+  801b49:	56                   	push   %esi
+  801b4a:	ff d0                	call   *%eax
+  801b4c:	83 c4 10             	add    $0x10,%esp
+}
+  801b4f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b52:	5b                   	pop    %ebx
+  801b53:	5e                   	pop    %esi
+  801b54:	5d                   	pop    %ebp
+  801b55:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b56:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  801b5b:	8b 40 48             	mov    0x48(%eax),%eax
+  801b5e:	83 ec 04             	sub    $0x4,%esp
+  801b61:	53                   	push   %ebx
+  801b62:	50                   	push   %eax
+  801b63:	68 b1 3f 80 00       	push   $0x803fb1
+  801b68:	e8 39 e7 ff ff       	call   8002a6 <cprintf>
+    return -E_INVAL;
+  801b6d:	83 c4 10             	add    $0x10,%esp
+  801b70:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b75:	eb d8                	jmp    801b4f <write+0x53>
+    return -E_NOT_SUPP;
+  801b77:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b7c:	eb d1                	jmp    801b4f <write+0x53>
+
+00801b7e <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801b7e:	55                   	push   %ebp
+  801b7f:	89 e5                	mov    %esp,%ebp
+  801b81:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801b84:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b87:	50                   	push   %eax
+  801b88:	ff 75 08             	push   0x8(%ebp)
+  801b8b:	e8 f3 fb ff ff       	call   801783 <fd_lookup>
+  801b90:	83 c4 10             	add    $0x10,%esp
+  801b93:	85 c0                	test   %eax,%eax
+  801b95:	78 0e                	js     801ba5 <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  801b97:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801b9a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b9d:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  801ba0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ba5:	c9                   	leave
+  801ba6:	c3                   	ret
+
+00801ba7 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801ba7:	55                   	push   %ebp
+  801ba8:	89 e5                	mov    %esp,%ebp
+  801baa:	56                   	push   %esi
+  801bab:	53                   	push   %ebx
+  801bac:	83 ec 18             	sub    $0x18,%esp
+  801baf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801bb2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801bb5:	50                   	push   %eax
+  801bb6:	53                   	push   %ebx
+  801bb7:	e8 c7 fb ff ff       	call   801783 <fd_lookup>
+  801bbc:	83 c4 10             	add    $0x10,%esp
+  801bbf:	85 c0                	test   %eax,%eax
+  801bc1:	78 34                	js     801bf7 <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801bc3:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801bc6:	83 ec 08             	sub    $0x8,%esp
+  801bc9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bcc:	50                   	push   %eax
+  801bcd:	ff 36                	push   (%esi)
+  801bcf:	e8 ff fb ff ff       	call   8017d3 <dev_lookup>
+  801bd4:	83 c4 10             	add    $0x10,%esp
+  801bd7:	85 c0                	test   %eax,%eax
+  801bd9:	78 1c                	js     801bf7 <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801bdb:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801bdf:	74 1d                	je     801bfe <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  801be1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801be4:	8b 40 18             	mov    0x18(%eax),%eax
+  801be7:	85 c0                	test   %eax,%eax
+  801be9:	74 34                	je     801c1f <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  801beb:	83 ec 08             	sub    $0x8,%esp
+  801bee:	ff 75 0c             	push   0xc(%ebp)
+  801bf1:	56                   	push   %esi
+  801bf2:	ff d0                	call   *%eax
+  801bf4:	83 c4 10             	add    $0x10,%esp
+}
+  801bf7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801bfa:	5b                   	pop    %ebx
+  801bfb:	5e                   	pop    %esi
+  801bfc:	5d                   	pop    %ebp
+  801bfd:	c3                   	ret
+            thisenv->env_id, fdnum);
+  801bfe:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  801c03:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801c06:	83 ec 04             	sub    $0x4,%esp
+  801c09:	53                   	push   %ebx
+  801c0a:	50                   	push   %eax
+  801c0b:	68 74 3f 80 00       	push   $0x803f74
+  801c10:	e8 91 e6 ff ff       	call   8002a6 <cprintf>
+    return -E_INVAL;
+  801c15:	83 c4 10             	add    $0x10,%esp
+  801c18:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c1d:	eb d8                	jmp    801bf7 <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  801c1f:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c24:	eb d1                	jmp    801bf7 <ftruncate+0x50>
+
+00801c26 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801c26:	55                   	push   %ebp
+  801c27:	89 e5                	mov    %esp,%ebp
+  801c29:	56                   	push   %esi
+  801c2a:	53                   	push   %ebx
+  801c2b:	83 ec 18             	sub    $0x18,%esp
+  801c2e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c31:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c34:	50                   	push   %eax
+  801c35:	ff 75 08             	push   0x8(%ebp)
+  801c38:	e8 46 fb ff ff       	call   801783 <fd_lookup>
+  801c3d:	83 c4 10             	add    $0x10,%esp
+  801c40:	85 c0                	test   %eax,%eax
+  801c42:	78 49                	js     801c8d <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c44:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801c47:	83 ec 08             	sub    $0x8,%esp
+  801c4a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c4d:	50                   	push   %eax
+  801c4e:	ff 36                	push   (%esi)
+  801c50:	e8 7e fb ff ff       	call   8017d3 <dev_lookup>
+  801c55:	83 c4 10             	add    $0x10,%esp
+  801c58:	85 c0                	test   %eax,%eax
+  801c5a:	78 31                	js     801c8d <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  801c5c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c5f:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801c63:	74 2f                	je     801c94 <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  801c65:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  801c68:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801c6f:	00 00 00 
+  stat->st_isdir = 0;
+  801c72:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801c79:	00 00 00 
+  stat->st_dev = dev;
+  801c7c:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  801c82:	83 ec 08             	sub    $0x8,%esp
+  801c85:	53                   	push   %ebx
+  801c86:	56                   	push   %esi
+  801c87:	ff 50 14             	call   *0x14(%eax)
+  801c8a:	83 c4 10             	add    $0x10,%esp
+}
+  801c8d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c90:	5b                   	pop    %ebx
+  801c91:	5e                   	pop    %esi
+  801c92:	5d                   	pop    %ebp
+  801c93:	c3                   	ret
+    return -E_NOT_SUPP;
+  801c94:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c99:	eb f2                	jmp    801c8d <fstat+0x67>
+
+00801c9b <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  801c9b:	55                   	push   %ebp
+  801c9c:	89 e5                	mov    %esp,%ebp
+  801c9e:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  801ca1:	ff 75 0c             	push   0xc(%ebp)
+  801ca4:	ff 75 08             	push   0x8(%ebp)
+  801ca7:	e8 58 07 00 00       	call   802404 <file_stat>
+}
+  801cac:	c9                   	leave
+  801cad:	c3                   	ret
+
+00801cae <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  801cae:	55                   	push   %ebp
+  801caf:	89 e5                	mov    %esp,%ebp
+  801cb1:	57                   	push   %edi
+  801cb2:	56                   	push   %esi
+  801cb3:	53                   	push   %ebx
+  801cb4:	83 ec 1c             	sub    $0x1c,%esp
+  801cb7:	89 c7                	mov    %eax,%edi
+  801cb9:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801cbc:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801cbf:	e9 a2 00 00 00       	jmp    801d66 <fsipc_send+0xb8>
+  nfsenvs = 0;
+  801cc4:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  801ccb:	00 00 00 
+  801cce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cd3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801cd8:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801cdd:	be 01 00 00 00       	mov    $0x1,%esi
+  801ce2:	eb 0f                	jmp    801cf3 <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801ce4:	83 c0 01             	add    $0x1,%eax
+  801ce7:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801cec:	74 49                	je     801d37 <fsipc_send+0x89>
+  801cee:	83 f9 07             	cmp    $0x7,%ecx
+  801cf1:	7f 50                	jg     801d43 <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  801cf3:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801cf6:	c1 e2 04             	shl    $0x4,%edx
+  801cf9:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801cff:	8b 52 50             	mov    0x50(%edx),%edx
+  801d02:	83 fa 01             	cmp    $0x1,%edx
+  801d05:	75 dd                	jne    801ce4 <fsipc_send+0x36>
+  801d07:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801d0a:	c1 e2 04             	shl    $0x4,%edx
+  801d0d:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801d13:	8b 52 54             	mov    0x54(%edx),%edx
+  801d16:	85 d2                	test   %edx,%edx
+  801d18:	74 ca                	je     801ce4 <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801d1a:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801d1d:	c1 e2 04             	shl    $0x4,%edx
+  801d20:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801d26:	8b 52 48             	mov    0x48(%edx),%edx
+  801d29:	89 14 8d 20 60 80 00 	mov    %edx,0x806020(,%ecx,4)
+  801d30:	8d 49 01             	lea    0x1(%ecx),%ecx
+  801d33:	89 f3                	mov    %esi,%ebx
+  801d35:	eb ad                	jmp    801ce4 <fsipc_send+0x36>
+  801d37:	84 db                	test   %bl,%bl
+  801d39:	74 38                	je     801d73 <fsipc_send+0xc5>
+  801d3b:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+  801d41:	eb 30                	jmp    801d73 <fsipc_send+0xc5>
+  801d43:	84 db                	test   %bl,%bl
+  801d45:	74 2c                	je     801d73 <fsipc_send+0xc5>
+  801d47:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+  801d4d:	eb 24                	jmp    801d73 <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  801d4f:	50                   	push   %eax
+  801d50:	68 e0 3f 80 00       	push   $0x803fe0
+  801d55:	6a 34                	push   $0x34
+  801d57:	68 ea 3f 80 00       	push   $0x803fea
+  801d5c:	e8 cd 19 00 00       	call   80372e <_panic>
+    }
+    sys_yield();
+  801d61:	e8 fb ee ff ff       	call   800c61 <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  801d66:	83 3d 00 60 80 00 03 	cmpl   $0x3,0x806000
+  801d6d:	0f 8e 51 ff ff ff    	jle    801cc4 <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  801d73:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  801d78:	8b 70 48             	mov    0x48(%eax),%esi
+  801d7b:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  801d81:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d86:	8b 0d 00 60 80 00    	mov    0x806000,%ecx
+  801d8c:	39 d9                	cmp    %ebx,%ecx
+  801d8e:	7e d1                	jle    801d61 <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  801d90:	83 ec 0c             	sub    $0xc,%esp
+  801d93:	ff 75 e0             	push   -0x20(%ebp)
+  801d96:	6a 07                	push   $0x7
+  801d98:	ff 75 e4             	push   -0x1c(%ebp)
+  801d9b:	57                   	push   %edi
+  801d9c:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  801d9f:	99                   	cltd
+  801da0:	f7 f9                	idiv   %ecx
+  801da2:	ff 34 95 20 60 80 00 	push   0x806020(,%edx,4)
+  801da9:	e8 cc f1 ff ff       	call   800f7a <sys_ipc_try_send>
+      if (r == 0)
+  801dae:	83 c4 20             	add    $0x20,%esp
+  801db1:	85 c0                	test   %eax,%eax
+  801db3:	74 0a                	je     801dbf <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  801db5:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801db8:	75 95                	jne    801d4f <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  801dba:	83 c3 01             	add    $0x1,%ebx
+  801dbd:	eb c7                	jmp    801d86 <fsipc_send+0xd8>
+  }
+}
+  801dbf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801dc2:	5b                   	pop    %ebx
+  801dc3:	5e                   	pop    %esi
+  801dc4:	5f                   	pop    %edi
+  801dc5:	5d                   	pop    %ebp
+  801dc6:	c3                   	ret
+
+00801dc7 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801dc7:	55                   	push   %ebp
+  801dc8:	89 e5                	mov    %esp,%ebp
+  801dca:	53                   	push   %ebx
+  801dcb:	83 ec 14             	sub    $0x14,%esp
+  801dce:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  801dd0:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  801dd7:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801ddc:	ba 00 70 80 00       	mov    $0x807000,%edx
+  801de1:	e8 c8 fe ff ff       	call   801cae <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801de6:	6a 00                	push   $0x0
+  801de8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801deb:	50                   	push   %eax
+  801dec:	53                   	push   %ebx
+  801ded:	6a 00                	push   $0x0
+  801def:	e8 b2 f7 ff ff       	call   8015a6 <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  801df4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801df7:	c9                   	leave
+  801df8:	c3                   	ret
+
+00801df9 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801df9:	55                   	push   %ebp
+  801dfa:	89 e5                	mov    %esp,%ebp
+  801dfc:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801dff:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e02:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e05:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.set_size.req_size = newsize;
+  801e0a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e0d:	a3 04 70 80 00       	mov    %eax,0x807004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801e12:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e17:	b8 02 00 00 00       	mov    $0x2,%eax
+  801e1c:	e8 a6 ff ff ff       	call   801dc7 <fsipc>
+}
+  801e21:	c9                   	leave
+  801e22:	c3                   	ret
+
+00801e23 <devfile_flush>:
+{
+  801e23:	55                   	push   %ebp
+  801e24:	89 e5                	mov    %esp,%ebp
+  801e26:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801e29:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e2c:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e2f:	a3 00 70 80 00       	mov    %eax,0x807000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801e34:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e39:	b8 06 00 00 00       	mov    $0x6,%eax
+  801e3e:	e8 84 ff ff ff       	call   801dc7 <fsipc>
+}
+  801e43:	c9                   	leave
+  801e44:	c3                   	ret
+
+00801e45 <devfile_stat>:
+{
+  801e45:	55                   	push   %ebp
+  801e46:	89 e5                	mov    %esp,%ebp
+  801e48:	53                   	push   %ebx
+  801e49:	83 ec 04             	sub    $0x4,%esp
+  801e4c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801e4f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e52:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e55:	a3 00 70 80 00       	mov    %eax,0x807000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801e5a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e5f:	b8 05 00 00 00       	mov    $0x5,%eax
+  801e64:	e8 5e ff ff ff       	call   801dc7 <fsipc>
+  801e69:	85 c0                	test   %eax,%eax
+  801e6b:	78 2c                	js     801e99 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801e6d:	83 ec 08             	sub    $0x8,%esp
+  801e70:	68 00 70 80 00       	push   $0x807000
+  801e75:	53                   	push   %ebx
+  801e76:	e8 19 ea ff ff       	call   800894 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  801e7b:	a1 80 70 80 00       	mov    0x807080,%eax
+  801e80:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801e86:	a1 84 70 80 00       	mov    0x807084,%eax
+  801e8b:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801e91:	83 c4 10             	add    $0x10,%esp
+  801e94:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e99:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e9c:	c9                   	leave
+  801e9d:	c3                   	ret
+
+00801e9e <fsv_alloc>:
+{
+  801e9e:	55                   	push   %ebp
+  801e9f:	89 e5                	mov    %esp,%ebp
+  801ea1:	56                   	push   %esi
+  801ea2:	53                   	push   %ebx
+  801ea3:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  801ea5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801eaa:	eb 22                	jmp    801ece <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  801eac:	83 ec 04             	sub    $0x4,%esp
+  801eaf:	6a 00                	push   $0x0
+  801eb1:	6a 00                	push   $0x0
+  801eb3:	6a 07                	push   $0x7
+  801eb5:	50                   	push   %eax
+  801eb6:	6a 00                	push   $0x0
+  801eb8:	6a 04                	push   $0x4
+  801eba:	68 40 60 80 00       	push   $0x806040
+  801ebf:	e8 52 f2 ff ff       	call   801116 <sysbatch_add>
+  801ec4:	83 c4 20             	add    $0x20,%esp
+  801ec7:	85 c0                	test   %eax,%eax
+  801ec9:	78 48                	js     801f13 <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  801ecb:	83 c3 01             	add    $0x1,%ebx
+  801ece:	39 f3                	cmp    %esi,%ebx
+  801ed0:	74 31                	je     801f03 <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  801ed2:	89 d8                	mov    %ebx,%eax
+  801ed4:	c1 e0 0c             	shl    $0xc,%eax
+  801ed7:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801edc:	89 c2                	mov    %eax,%edx
+  801ede:	c1 ea 16             	shr    $0x16,%edx
+  801ee1:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801ee8:	f6 c2 01             	test   $0x1,%dl
+  801eeb:	74 bf                	je     801eac <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  801eed:	89 c2                	mov    %eax,%edx
+  801eef:	c1 ea 0c             	shr    $0xc,%edx
+  801ef2:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801ef9:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801efc:	83 fa 03             	cmp    $0x3,%edx
+  801eff:	75 ab                	jne    801eac <fsv_alloc+0xe>
+  801f01:	eb c8                	jmp    801ecb <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  801f03:	83 ec 0c             	sub    $0xc,%esp
+  801f06:	68 40 60 80 00       	push   $0x806040
+  801f0b:	e8 b6 f1 ff ff       	call   8010c6 <sysbatch_flush>
+  801f10:	83 c4 10             	add    $0x10,%esp
+}
+  801f13:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f16:	5b                   	pop    %ebx
+  801f17:	5e                   	pop    %esi
+  801f18:	5d                   	pop    %ebp
+  801f19:	c3                   	ret
+
+00801f1a <devfile_read>:
+{
+  801f1a:	55                   	push   %ebp
+  801f1b:	89 e5                	mov    %esp,%ebp
+  801f1d:	57                   	push   %edi
+  801f1e:	56                   	push   %esi
+  801f1f:	53                   	push   %ebx
+  801f20:	83 ec 3c             	sub    $0x3c,%esp
+  801f23:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  801f26:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  801f2c:	77 57                	ja     801f85 <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801f2e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f31:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f34:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.read.req_n = n;
+  801f39:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801f3f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f44:	b8 03 00 00 00       	mov    $0x3,%eax
+  801f49:	e8 79 fe ff ff       	call   801dc7 <fsipc>
+  801f4e:	89 c6                	mov    %eax,%esi
+  801f50:	85 c0                	test   %eax,%eax
+  801f52:	78 27                	js     801f7b <devfile_read+0x61>
+  assert(r <= n);
+  801f54:	39 c3                	cmp    %eax,%ebx
+  801f56:	0f 82 0e 02 00 00    	jb     80216a <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  801f5c:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801f61:	0f 8f 1c 02 00 00    	jg     802183 <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801f67:	83 ec 04             	sub    $0x4,%esp
+  801f6a:	50                   	push   %eax
+  801f6b:	68 00 70 80 00       	push   $0x807000
+  801f70:	ff 75 0c             	push   0xc(%ebp)
+  801f73:	e8 a2 ea ff ff       	call   800a1a <memmove>
+  return r;
+  801f78:	83 c4 10             	add    $0x10,%esp
+}
+  801f7b:	89 f0                	mov    %esi,%eax
+  801f7d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f80:	5b                   	pop    %ebx
+  801f81:	5e                   	pop    %esi
+  801f82:	5f                   	pop    %edi
+  801f83:	5d                   	pop    %ebp
+  801f84:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  801f85:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f8a:	e8 0f ff ff ff       	call   801e9e <fsv_alloc>
+  801f8f:	89 c6                	mov    %eax,%esi
+  801f91:	85 c0                	test   %eax,%eax
+  801f93:	78 e6                	js     801f7b <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  801f95:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f98:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f9b:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  801fa0:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fa3:	8b 40 04             	mov    0x4(%eax),%eax
+  801fa6:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  801fab:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  801fb1:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801fb8:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801fbd:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801fc2:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801fc7:	e8 e2 fc ff ff       	call   801cae <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801fcc:	6a 00                	push   $0x0
+  801fce:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801fd1:	50                   	push   %eax
+  801fd2:	68 00 10 c0 9f       	push   $0x9fc01000
+  801fd7:	6a 00                	push   $0x0
+  801fd9:	e8 c8 f5 ff ff       	call   8015a6 <ipc_recv_pages>
+  801fde:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  801fe0:	83 c4 10             	add    $0x10,%esp
+  801fe3:	85 c0                	test   %eax,%eax
+  801fe5:	7e 94                	jle    801f7b <devfile_read+0x61>
+  assert(r <= n);
+  801fe7:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801fea:	39 c3                	cmp    %eax,%ebx
+  801fec:	72 2e                	jb     80201c <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801fee:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ff1:	8b 40 04             	mov    0x4(%eax),%eax
+  801ff4:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801ff9:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  801ffc:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801fff:	c1 e2 0c             	shl    $0xc,%edx
+  802002:	39 ca                	cmp    %ecx,%edx
+  802004:	72 2f                	jb     802035 <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  802006:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  80200b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  80200e:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  802012:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  802017:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  80201a:	eb 52                	jmp    80206e <devfile_read+0x154>
+  assert(r <= n);
+  80201c:	68 f5 3f 80 00       	push   $0x803ff5
+  802021:	68 fc 3f 80 00       	push   $0x803ffc
+  802026:	68 49 01 00 00       	push   $0x149
+  80202b:	68 ea 3f 80 00       	push   $0x803fea
+  802030:	e8 f9 16 00 00       	call   80372e <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  802035:	68 20 40 80 00       	push   $0x804020
+  80203a:	68 fc 3f 80 00       	push   $0x803ffc
+  80203f:	68 4a 01 00 00       	push   $0x14a
+  802044:	68 ea 3f 80 00       	push   $0x803fea
+  802049:	e8 e0 16 00 00       	call   80372e <_panic>
+      memmove(dst + done, src + done, m);
+  80204e:	83 ec 04             	sub    $0x4,%esp
+  802051:	53                   	push   %ebx
+  802052:	56                   	push   %esi
+  802053:	89 f8                	mov    %edi,%eax
+  802055:	03 45 0c             	add    0xc(%ebp),%eax
+  802058:	50                   	push   %eax
+  802059:	e8 bc e9 ff ff       	call   800a1a <memmove>
+  80205e:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  802061:	01 df                	add    %ebx,%edi
+  802063:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802066:	39 c7                	cmp    %eax,%edi
+  802068:	0f 83 c0 00 00 00    	jae    80212e <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  80206e:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802071:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  802074:	89 f0                	mov    %esi,%eax
+  802076:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80207b:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  802080:	29 c3                	sub    %eax,%ebx
+  802082:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802085:	29 f8                	sub    %edi,%eax
+  802087:	39 c3                	cmp    %eax,%ebx
+  802089:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  80208c:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  802092:	75 ba                	jne    80204e <devfile_read+0x134>
+  802094:	89 f9                	mov    %edi,%ecx
+  802096:	03 4d 0c             	add    0xc(%ebp),%ecx
+  802099:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  80209c:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  8020a2:	75 aa                	jne    80204e <devfile_read+0x134>
+  8020a4:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  8020aa:	77 a2                	ja     80204e <devfile_read+0x134>
+  8020ac:	89 c8                	mov    %ecx,%eax
+  8020ae:	c1 e8 16             	shr    $0x16,%eax
+  8020b1:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8020b8:	a8 01                	test   $0x1,%al
+  8020ba:	74 92                	je     80204e <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  8020bc:	89 c8                	mov    %ecx,%eax
+  8020be:	c1 e8 0c             	shr    $0xc,%eax
+  8020c1:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  8020c8:	a8 01                	test   $0x1,%al
+  8020ca:	74 82                	je     80204e <devfile_read+0x134>
+  8020cc:	a9 02 08 00 00       	test   $0x802,%eax
+  8020d1:	0f 84 77 ff ff ff    	je     80204e <devfile_read+0x134>
+  8020d7:	f6 c4 04             	test   $0x4,%ah
+  8020da:	0f 85 6e ff ff ff    	jne    80204e <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  8020e0:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  8020e5:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  8020e9:	84 c0                	test   %al,%al
+  8020eb:	75 17                	jne    802104 <devfile_read+0x1ea>
+  8020ed:	83 ec 08             	sub    $0x8,%esp
+  8020f0:	6a 01                	push   $0x1
+  8020f2:	6a 00                	push   $0x0
+  8020f4:	e8 87 eb ff ff       	call   800c80 <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  8020f9:	83 c4 10             	add    $0x10,%esp
+  8020fc:	85 c0                	test   %eax,%eax
+  8020fe:	0f 85 4a ff ff ff    	jne    80204e <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  802104:	83 ec 04             	sub    $0x4,%esp
+  802107:	68 05 08 00 00       	push   $0x805
+  80210c:	ff 75 cc             	push   -0x34(%ebp)
+  80210f:	6a 00                	push   $0x0
+  802111:	56                   	push   %esi
+  802112:	6a 00                	push   $0x0
+  802114:	6a 05                	push   $0x5
+  802116:	68 40 60 80 00       	push   $0x806040
+  80211b:	e8 f6 ef ff ff       	call   801116 <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  802120:	c1 e8 1f             	shr    $0x1f,%eax
+  802123:	08 45 cb             	or     %al,-0x35(%ebp)
+  802126:	83 c4 20             	add    $0x20,%esp
+  802129:	e9 33 ff ff ff       	jmp    802061 <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  80212e:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  802131:	83 ec 0c             	sub    $0xc,%esp
+  802134:	68 40 60 80 00       	push   $0x806040
+  802139:	e8 88 ef ff ff       	call   8010c6 <sysbatch_flush>
+  80213e:	83 c4 10             	add    $0x10,%esp
+  802141:	85 c0                	test   %eax,%eax
+  802143:	78 06                	js     80214b <devfile_read+0x231>
+  802145:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  802149:	74 14                	je     80215f <devfile_read+0x245>
+    memmove(dst, src, r);
+  80214b:	83 ec 04             	sub    $0x4,%esp
+  80214e:	ff 75 d4             	push   -0x2c(%ebp)
+  802151:	ff 75 d0             	push   -0x30(%ebp)
+  802154:	ff 75 0c             	push   0xc(%ebp)
+  802157:	e8 be e8 ff ff       	call   800a1a <memmove>
+  80215c:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  80215f:	8b 45 08             	mov    0x8(%ebp),%eax
+  802162:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  802165:	e9 11 fe ff ff       	jmp    801f7b <devfile_read+0x61>
+  assert(r <= n);
+  80216a:	68 f5 3f 80 00       	push   $0x803ff5
+  80216f:	68 fc 3f 80 00       	push   $0x803ffc
+  802174:	68 1c 01 00 00       	push   $0x11c
+  802179:	68 ea 3f 80 00       	push   $0x803fea
+  80217e:	e8 ab 15 00 00       	call   80372e <_panic>
+  assert(r <= PGSIZE);
+  802183:	68 11 40 80 00       	push   $0x804011
+  802188:	68 fc 3f 80 00       	push   $0x803ffc
+  80218d:	68 1d 01 00 00       	push   $0x11d
+  802192:	68 ea 3f 80 00       	push   $0x803fea
+  802197:	e8 92 15 00 00       	call   80372e <_panic>
+
+0080219c <devfile_write>:
+{
+  80219c:	55                   	push   %ebp
+  80219d:	89 e5                	mov    %esp,%ebp
+  80219f:	57                   	push   %edi
+  8021a0:	56                   	push   %esi
+  8021a1:	53                   	push   %ebx
+  8021a2:	83 ec 1c             	sub    $0x1c,%esp
+  8021a5:	8b 75 08             	mov    0x8(%ebp),%esi
+  8021a8:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  8021ab:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  8021b0:	77 39                	ja     8021eb <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8021b2:	8b 56 0c             	mov    0xc(%esi),%edx
+  8021b5:	89 15 00 70 80 00    	mov    %edx,0x807000
+  fsipcbuf.write.req_n = n;
+  8021bb:	a3 04 70 80 00       	mov    %eax,0x807004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  8021c0:	83 ec 04             	sub    $0x4,%esp
+  8021c3:	50                   	push   %eax
+  8021c4:	ff 75 0c             	push   0xc(%ebp)
+  8021c7:	68 08 70 80 00       	push   $0x807008
+  8021cc:	e8 49 e8 ff ff       	call   800a1a <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  8021d1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021d6:	b8 04 00 00 00       	mov    $0x4,%eax
+  8021db:	e8 e7 fb ff ff       	call   801dc7 <fsipc>
+  8021e0:	83 c4 10             	add    $0x10,%esp
+}
+  8021e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021e6:	5b                   	pop    %ebx
+  8021e7:	5e                   	pop    %esi
+  8021e8:	5f                   	pop    %edi
+  8021e9:	5d                   	pop    %ebp
+  8021ea:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  8021eb:	ba 00 00 10 00       	mov    $0x100000,%edx
+  8021f0:	39 d0                	cmp    %edx,%eax
+  8021f2:	89 d3                	mov    %edx,%ebx
+  8021f4:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  8021f7:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  8021fd:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  802200:	83 c7 01             	add    $0x1,%edi
+  802203:	89 f8                	mov    %edi,%eax
+  802205:	e8 94 fc ff ff       	call   801e9e <fsv_alloc>
+  80220a:	85 c0                	test   %eax,%eax
+  80220c:	78 d5                	js     8021e3 <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  80220e:	83 ec 04             	sub    $0x4,%esp
+  802211:	53                   	push   %ebx
+  802212:	ff 75 0c             	push   0xc(%ebp)
+  802215:	68 00 10 c0 9f       	push   $0x9fc01000
+  80221a:	e8 fb e7 ff ff       	call   800a1a <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  80221f:	8b 46 0c             	mov    0xc(%esi),%eax
+  802222:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  802227:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  80222d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  802234:	89 f9                	mov    %edi,%ecx
+  802236:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  80223b:	b8 0d 00 00 00       	mov    $0xd,%eax
+  802240:	e8 69 fa ff ff       	call   801cae <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  802245:	6a 00                	push   $0x0
+  802247:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80224a:	50                   	push   %eax
+  80224b:	6a 00                	push   $0x0
+  80224d:	6a 00                	push   $0x0
+  80224f:	e8 52 f3 ff ff       	call   8015a6 <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  802254:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  802257:	eb 8a                	jmp    8021e3 <devfile_write+0x47>
+
+00802259 <open>:
+{
+  802259:	55                   	push   %ebp
+  80225a:	89 e5                	mov    %esp,%ebp
+  80225c:	56                   	push   %esi
+  80225d:	53                   	push   %ebx
+  80225e:	83 ec 1c             	sub    $0x1c,%esp
+  802261:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  802264:	56                   	push   %esi
+  802265:	e8 ef e5 ff ff       	call   800859 <strlen>
+  80226a:	83 c4 10             	add    $0x10,%esp
+  80226d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802272:	7f 6c                	jg     8022e0 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  802274:	83 ec 0c             	sub    $0xc,%esp
+  802277:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80227a:	50                   	push   %eax
+  80227b:	e8 ad f4 ff ff       	call   80172d <fd_alloc>
+  802280:	89 c3                	mov    %eax,%ebx
+  802282:	83 c4 10             	add    $0x10,%esp
+  802285:	85 c0                	test   %eax,%eax
+  802287:	78 3c                	js     8022c5 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  802289:	83 ec 08             	sub    $0x8,%esp
+  80228c:	56                   	push   %esi
+  80228d:	68 00 70 80 00       	push   $0x807000
+  802292:	e8 fd e5 ff ff       	call   800894 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  802297:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80229a:	a3 00 74 80 00       	mov    %eax,0x807400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80229f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8022a2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022a7:	e8 1b fb ff ff       	call   801dc7 <fsipc>
+  8022ac:	89 c3                	mov    %eax,%ebx
+  8022ae:	83 c4 10             	add    $0x10,%esp
+  8022b1:	85 c0                	test   %eax,%eax
+  8022b3:	78 19                	js     8022ce <open+0x75>
+  return fd2num(fd);
+  8022b5:	83 ec 0c             	sub    $0xc,%esp
+  8022b8:	ff 75 f4             	push   -0xc(%ebp)
+  8022bb:	e8 49 f4 ff ff       	call   801709 <fd2num>
+  8022c0:	89 c3                	mov    %eax,%ebx
+  8022c2:	83 c4 10             	add    $0x10,%esp
+}
+  8022c5:	89 d8                	mov    %ebx,%eax
+  8022c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022ca:	5b                   	pop    %ebx
+  8022cb:	5e                   	pop    %esi
+  8022cc:	5d                   	pop    %ebp
+  8022cd:	c3                   	ret
+    fd_close(fd, 0);
+  8022ce:	83 ec 08             	sub    $0x8,%esp
+  8022d1:	6a 00                	push   $0x0
+  8022d3:	ff 75 f4             	push   -0xc(%ebp)
+  8022d6:	e8 44 f5 ff ff       	call   80181f <fd_close>
+    return r;
+  8022db:	83 c4 10             	add    $0x10,%esp
+  8022de:	eb e5                	jmp    8022c5 <open+0x6c>
+    return -E_BAD_PATH;
+  8022e0:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8022e5:	eb de                	jmp    8022c5 <open+0x6c>
+
+008022e7 <open_read>:
+{
+  8022e7:	55                   	push   %ebp
+  8022e8:	89 e5                	mov    %esp,%ebp
+  8022ea:	57                   	push   %edi
+  8022eb:	56                   	push   %esi
+  8022ec:	53                   	push   %ebx
+  8022ed:	83 ec 28             	sub    $0x28,%esp
+  8022f0:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  8022f3:	57                   	push   %edi
+  8022f4:	e8 60 e5 ff ff       	call   800859 <strlen>
+  8022f9:	83 c4 10             	add    $0x10,%esp
+  8022fc:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802301:	0f 87 f6 00 00 00    	ja     8023fd <open_read+0x116>
+  802307:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  802309:	83 ec 0c             	sub    $0xc,%esp
+  80230c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80230f:	50                   	push   %eax
+  802310:	e8 18 f4 ff ff       	call   80172d <fd_alloc>
+  802315:	89 c3                	mov    %eax,%ebx
+  802317:	83 c4 10             	add    $0x10,%esp
+  80231a:	85 c0                	test   %eax,%eax
+  80231c:	0f 88 b2 00 00 00    	js     8023d4 <open_read+0xed>
+  strcpy(req->req_buf, path);
+  802322:	83 ec 08             	sub    $0x8,%esp
+  802325:	57                   	push   %edi
+  802326:	68 e4 70 80 00       	push   $0x8070e4
+  80232b:	e8 64 e5 ff ff       	call   800894 <strcpy>
+  req->req_nops = 2;
+  802330:	c7 05 00 70 80 00 02 	movl   $0x2,0x807000
+  802337:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  80233a:	c7 05 04 70 80 00 01 	movl   $0x1,0x807004
+  802341:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  802344:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802347:	a3 10 70 80 00       	mov    %eax,0x807010
+  req->req_ops[0].op_buf = 0;
+  80234c:	c7 05 18 70 80 00 00 	movl   $0x0,0x807018
+  802353:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  802356:	c7 05 20 70 80 00 04 	movl   $0x4,0x807020
+  80235d:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  802360:	c7 05 24 70 80 00 01 	movl   $0x1,0x807024
+  802367:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  80236a:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  80236f:	29 f0                	sub    %esi,%eax
+  802371:	3b 45 14             	cmp    0x14(%ebp),%eax
+  802374:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  802378:	a3 2c 70 80 00       	mov    %eax,0x80702c
+  req->req_ops[1].op_offset = 0;
+  80237d:	c7 05 30 70 80 00 00 	movl   $0x0,0x807030
+  802384:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  802387:	83 c6 01             	add    $0x1,%esi
+  80238a:	89 35 34 70 80 00    	mov    %esi,0x807034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  802390:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802393:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802398:	e8 2a fa ff ff       	call   801dc7 <fsipc>
+  80239d:	89 c3                	mov    %eax,%ebx
+  80239f:	83 c4 10             	add    $0x10,%esp
+  8023a2:	83 f8 01             	cmp    $0x1,%eax
+  8023a5:	7e 37                	jle    8023de <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  8023a7:	a1 38 70 80 00       	mov    0x807038,%eax
+  8023ac:	8b 55 18             	mov    0x18(%ebp),%edx
+  8023af:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  8023b1:	83 ec 04             	sub    $0x4,%esp
+  8023b4:	50                   	push   %eax
+  8023b5:	81 c6 e4 70 80 00    	add    $0x8070e4,%esi
+  8023bb:	56                   	push   %esi
+  8023bc:	ff 75 10             	push   0x10(%ebp)
+  8023bf:	e8 56 e6 ff ff       	call   800a1a <memmove>
+  return fd2num(fd);
+  8023c4:	83 c4 04             	add    $0x4,%esp
+  8023c7:	ff 75 e4             	push   -0x1c(%ebp)
+  8023ca:	e8 3a f3 ff ff       	call   801709 <fd2num>
+  8023cf:	89 c3                	mov    %eax,%ebx
+  8023d1:	83 c4 10             	add    $0x10,%esp
+}
+  8023d4:	89 d8                	mov    %ebx,%eax
+  8023d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023d9:	5b                   	pop    %ebx
+  8023da:	5e                   	pop    %esi
+  8023db:	5f                   	pop    %edi
+  8023dc:	5d                   	pop    %ebp
+  8023dd:	c3                   	ret
+    fd_close(fd, 0);
+  8023de:	83 ec 08             	sub    $0x8,%esp
+  8023e1:	6a 00                	push   $0x0
+  8023e3:	ff 75 e4             	push   -0x1c(%ebp)
+  8023e6:	e8 34 f4 ff ff       	call   80181f <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  8023eb:	83 c4 10             	add    $0x10,%esp
+  8023ee:	85 db                	test   %ebx,%ebx
+  8023f0:	78 e2                	js     8023d4 <open_read+0xed>
+  8023f2:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  8023f5:	8b 9b 1c 70 80 00    	mov    0x80701c(%ebx),%ebx
+  8023fb:	eb d7                	jmp    8023d4 <open_read+0xed>
+    return -E_BAD_PATH;
+  8023fd:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802402:	eb d0                	jmp    8023d4 <open_read+0xed>
+
+00802404 <file_stat>:
+{
+  802404:	55                   	push   %ebp
+  802405:	89 e5                	mov    %esp,%ebp
+  802407:	57                   	push   %edi
+  802408:	56                   	push   %esi
+  802409:	53                   	push   %ebx
+  80240a:	83 ec 18             	sub    $0x18,%esp
+  80240d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802410:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  802413:	57                   	push   %edi
+  802414:	e8 40 e4 ff ff       	call   800859 <strlen>
+  802419:	83 c4 10             	add    $0x10,%esp
+  80241c:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802421:	0f 8f c7 00 00 00    	jg     8024ee <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  802427:	83 ec 0c             	sub    $0xc,%esp
+  80242a:	57                   	push   %edi
+  80242b:	e8 29 e4 ff ff       	call   800859 <strlen>
+  802430:	8d 58 04             	lea    0x4(%eax),%ebx
+  802433:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  802436:	83 c4 08             	add    $0x8,%esp
+  802439:	57                   	push   %edi
+  80243a:	68 e4 70 80 00       	push   $0x8070e4
+  80243f:	e8 50 e4 ff ff       	call   800894 <strcpy>
+  req->req_nops = 2;
+  802444:	c7 05 00 70 80 00 02 	movl   $0x2,0x807000
+  80244b:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  80244e:	c7 05 04 70 80 00 02 	movl   $0x2,0x807004
+  802455:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  802458:	c7 05 10 70 80 00 00 	movl   $0x0,0x807010
+  80245f:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  802462:	c7 05 18 70 80 00 00 	movl   $0x0,0x807018
+  802469:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  80246c:	c7 05 20 70 80 00 03 	movl   $0x3,0x807020
+  802473:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  802476:	c7 05 24 70 80 00 01 	movl   $0x1,0x807024
+  80247d:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  802480:	89 1d 34 70 80 00    	mov    %ebx,0x807034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  802486:	ba 00 00 00 00       	mov    $0x0,%edx
+  80248b:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802490:	e8 32 f9 ff ff       	call   801dc7 <fsipc>
+  802495:	83 c4 10             	add    $0x10,%esp
+  802498:	83 f8 01             	cmp    $0x1,%eax
+  80249b:	7e 42                	jle    8024df <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  80249d:	81 c3 e4 70 80 00    	add    $0x8070e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  8024a3:	83 ec 08             	sub    $0x8,%esp
+  8024a6:	53                   	push   %ebx
+  8024a7:	56                   	push   %esi
+  8024a8:	e8 e7 e3 ff ff       	call   800894 <strcpy>
+  st->st_size = ret->ret_size;
+  8024ad:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  8024b3:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  8024b9:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  8024bf:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  8024c5:	c7 86 88 00 00 00 0c 	movl   $0x80500c,0x88(%esi)
+  8024cc:	50 80 00 
+  return 0;
+  8024cf:	83 c4 10             	add    $0x10,%esp
+  8024d2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024d7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024da:	5b                   	pop    %ebx
+  8024db:	5e                   	pop    %esi
+  8024dc:	5f                   	pop    %edi
+  8024dd:	5d                   	pop    %ebp
+  8024de:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  8024df:	85 c0                	test   %eax,%eax
+  8024e1:	78 f4                	js     8024d7 <file_stat+0xd3>
+  8024e3:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8024e6:	8b 80 1c 70 80 00    	mov    0x80701c(%eax),%eax
+  8024ec:	eb e9                	jmp    8024d7 <file_stat+0xd3>
+    return -E_BAD_PATH;
+  8024ee:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8024f3:	eb e2                	jmp    8024d7 <file_stat+0xd3>
+
+008024f5 <read_map>:
+{
+  8024f5:	55                   	push   %ebp
+  8024f6:	89 e5                	mov    %esp,%ebp
+  8024f8:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8024fb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024fe:	50                   	push   %eax
+  8024ff:	ff 75 08             	push   0x8(%ebp)
+  802502:	e8 7c f2 ff ff       	call   801783 <fd_lookup>
+  802507:	83 c4 10             	add    $0x10,%esp
+  80250a:	85 c0                	test   %eax,%eax
+  80250c:	78 2a                	js     802538 <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  80250e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802511:	8b 0d 0c 50 80 00    	mov    0x80500c,%ecx
+  802517:	39 08                	cmp    %ecx,(%eax)
+  802519:	75 1f                	jne    80253a <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  80251b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80251e:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.read_map.req_offset = offset;
+  802523:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802526:	a3 04 70 80 00       	mov    %eax,0x807004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  80252b:	8b 55 10             	mov    0x10(%ebp),%edx
+  80252e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802533:	e8 8f f8 ff ff       	call   801dc7 <fsipc>
+}
+  802538:	c9                   	leave
+  802539:	c3                   	ret
+    return -E_INVAL;
+  80253a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80253f:	eb f7                	jmp    802538 <read_map+0x43>
+
+00802541 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802541:	55                   	push   %ebp
+  802542:	89 e5                	mov    %esp,%ebp
+  802544:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  802547:	ba 00 00 00 00       	mov    $0x0,%edx
+  80254c:	b8 08 00 00 00       	mov    $0x8,%eax
+  802551:	e8 71 f8 ff ff       	call   801dc7 <fsipc>
+}
+  802556:	c9                   	leave
+  802557:	c3                   	ret
+
+00802558 <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  802558:	55                   	push   %ebp
+  802559:	89 e5                	mov    %esp,%ebp
+  80255b:	57                   	push   %edi
+  80255c:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  80255d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802560:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.stats.req_bio_sched = 0;
+  802565:	c7 05 04 70 80 00 00 	movl   $0x0,0x807004
+  80256c:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  80256f:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  802576:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  802579:	ba 00 00 00 00       	mov    $0x0,%edx
+  80257e:	b8 09 00 00 00       	mov    $0x9,%eax
+  802583:	e8 3f f8 ff ff       	call   801dc7 <fsipc>
+  802588:	85 c0                	test   %eax,%eax
+  80258a:	78 14                	js     8025a0 <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  80258c:	be 00 70 80 00       	mov    $0x807000,%esi
+  802591:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802596:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802599:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  80259b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025a0:	5e                   	pop    %esi
+  8025a1:	5f                   	pop    %edi
+  8025a2:	5d                   	pop    %ebp
+  8025a3:	c3                   	ret
+
+008025a4 <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  8025a4:	55                   	push   %ebp
+  8025a5:	89 e5                	mov    %esp,%ebp
+  8025a7:	53                   	push   %ebx
+  8025a8:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  8025ab:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8025ae:	50                   	push   %eax
+  8025af:	6a 00                	push   $0x0
+  8025b1:	e8 a2 ff ff ff       	call   802558 <fs_stats>
+  8025b6:	83 c4 10             	add    $0x10,%esp
+  8025b9:	85 c0                	test   %eax,%eax
+  8025bb:	78 28                	js     8025e5 <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  8025bd:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  8025c0:	83 ec 08             	sub    $0x8,%esp
+  8025c3:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8025c6:	50                   	push   %eax
+  8025c7:	6a 20                	push   $0x20
+  8025c9:	e8 8a ff ff ff       	call   802558 <fs_stats>
+  8025ce:	83 c4 10             	add    $0x10,%esp
+  8025d1:	85 c0                	test   %eax,%eax
+  8025d3:	78 10                	js     8025e5 <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  8025d5:	83 ec 08             	sub    $0x8,%esp
+  8025d8:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8025db:	50                   	push   %eax
+  8025dc:	53                   	push   %ebx
+  8025dd:	e8 76 ff ff ff       	call   802558 <fs_stats>
+  8025e2:	83 c4 10             	add    $0x10,%esp
+}
+  8025e5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025e8:	c9                   	leave
+  8025e9:	c3                   	ret
+
+008025ea <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  8025ea:	55                   	push   %ebp
+  8025eb:	89 e5                	mov    %esp,%ebp
+  8025ed:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  8025f0:	c7 05 00 70 80 00 00 	movl   $0x0,0x807000
+  8025f7:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  8025fa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8025fd:	a3 04 70 80 00       	mov    %eax,0x807004
+  fsipcbuf.stats.req_dcache = 0;
+  802602:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  802609:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  80260c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802611:	b8 09 00 00 00       	mov    $0x9,%eax
+  802616:	e8 ac f7 ff ff       	call   801dc7 <fsipc>
+}
+  80261b:	c9                   	leave
+  80261c:	c3                   	ret
+
+0080261d <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  80261d:	55                   	push   %ebp
+  80261e:	89 e5                	mov    %esp,%ebp
+  802620:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  802623:	c7 05 00 70 80 00 00 	movl   $0x0,0x807000
+  80262a:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  80262d:	c7 05 04 70 80 00 00 	movl   $0x0,0x807004
+  802634:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  802637:	8b 45 08             	mov    0x8(%ebp),%eax
+  80263a:	a3 08 70 80 00       	mov    %eax,0x807008
+  return fsipc(FSREQ_STATS, NULL);
+  80263f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802644:	b8 09 00 00 00       	mov    $0x9,%eax
+  802649:	e8 79 f7 ff ff       	call   801dc7 <fsipc>
+}
+  80264e:	c9                   	leave
+  80264f:	c3                   	ret
+
+00802650 <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  802650:	55                   	push   %ebp
+  802651:	89 e5                	mov    %esp,%ebp
+  802653:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802656:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802659:	50                   	push   %eax
+  80265a:	ff 75 08             	push   0x8(%ebp)
+  80265d:	e8 21 f1 ff ff       	call   801783 <fd_lookup>
+  802662:	83 c4 10             	add    $0x10,%esp
+  802665:	85 c0                	test   %eax,%eax
+  802667:	78 34                	js     80269d <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  802669:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80266c:	8b 0d 0c 50 80 00    	mov    0x80500c,%ecx
+  802672:	39 08                	cmp    %ecx,(%eax)
+  802674:	75 29                	jne    80269f <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  802676:	8b 40 0c             	mov    0xc(%eax),%eax
+  802679:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.fallocate.req_offset = offset;
+  80267e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802681:	a3 04 70 80 00       	mov    %eax,0x807004
+  fsipcbuf.fallocate.req_len = len;
+  802686:	8b 45 10             	mov    0x10(%ebp),%eax
+  802689:	a3 08 70 80 00       	mov    %eax,0x807008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  80268e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802693:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802698:	e8 2a f7 ff ff       	call   801dc7 <fsipc>
+}
+  80269d:	c9                   	leave
+  80269e:	c3                   	ret
+    return -E_INVAL;
+  80269f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026a4:	eb f7                	jmp    80269d <fallocate+0x4d>
+
+008026a6 <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  8026a6:	55                   	push   %ebp
+  8026a7:	89 e5                	mov    %esp,%ebp
+  8026a9:	57                   	push   %edi
+  8026aa:	56                   	push   %esi
+  8026ab:	53                   	push   %ebx
+  8026ac:	83 ec 24             	sub    $0x24,%esp
+  8026af:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8026b2:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8026b5:	50                   	push   %eax
+  8026b6:	ff 75 08             	push   0x8(%ebp)
+  8026b9:	e8 c5 f0 ff ff       	call   801783 <fd_lookup>
+  8026be:	83 c4 10             	add    $0x10,%esp
+  8026c1:	85 c0                	test   %eax,%eax
+  8026c3:	78 66                	js     80272b <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  8026c5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8026c8:	8b 0d 0c 50 80 00    	mov    0x80500c,%ecx
+  8026ce:	39 08                	cmp    %ecx,(%eax)
+  8026d0:	75 61                	jne    802733 <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  8026d2:	85 f6                	test   %esi,%esi
+  8026d4:	7e 50                	jle    802726 <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  8026d6:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  8026db:	39 de                	cmp    %ebx,%esi
+  8026dd:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  8026e0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8026e3:	8b 40 0c             	mov    0xc(%eax),%eax
+  8026e6:	a3 00 70 80 00       	mov    %eax,0x807000
+    fsipcbuf.prefetch.req_n = m;
+  8026eb:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  8026f1:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  8026f8:	83 ec 04             	sub    $0x4,%esp
+  8026fb:	57                   	push   %edi
+  8026fc:	ff 75 0c             	push   0xc(%ebp)
+  8026ff:	68 08 70 80 00       	push   $0x807008
+  802704:	e8 11 e3 ff ff       	call   800a1a <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  802709:	ba 00 00 00 00       	mov    $0x0,%edx
+  80270e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802713:	e8 af f6 ff ff       	call   801dc7 <fsipc>
+  802718:	83 c4 10             	add    $0x10,%esp
+  80271b:	85 c0                	test   %eax,%eax
+  80271d:	78 0c                	js     80272b <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  80271f:	01 7d 0c             	add    %edi,0xc(%ebp)
+  802722:	29 de                	sub    %ebx,%esi
+  802724:	eb ac                	jmp    8026d2 <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  802726:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80272b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80272e:	5b                   	pop    %ebx
+  80272f:	5e                   	pop    %esi
+  802730:	5f                   	pop    %edi
+  802731:	5d                   	pop    %ebp
+  802732:	c3                   	ret
+    return -E_INVAL;
+  802733:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802738:	eb f1                	jmp    80272b <prefetch+0x85>
+
+0080273a <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  80273a:	55                   	push   %ebp
+  80273b:	89 e5                	mov    %esp,%ebp
+  80273d:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  802740:	50                   	push   %eax
+  802741:	e8 d3 ef ff ff       	call   801719 <fd2data>
+  802746:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  80274b:	c9                   	leave
+  80274c:	c3                   	ret
+
+0080274d <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80274d:	55                   	push   %ebp
+  80274e:	89 e5                	mov    %esp,%ebp
+  802750:	56                   	push   %esi
+  802751:	53                   	push   %ebx
+  802752:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  802755:	83 ec 0c             	sub    $0xc,%esp
+  802758:	ff 75 08             	push   0x8(%ebp)
+  80275b:	e8 b9 ef ff ff       	call   801719 <fd2data>
+  802760:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  802762:	83 c4 08             	add    $0x8,%esp
+  802765:	68 4c 40 80 00       	push   $0x80404c
+  80276a:	53                   	push   %ebx
+  80276b:	e8 24 e1 ff ff       	call   800894 <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  802770:	8b 46 04             	mov    0x4(%esi),%eax
+  802773:	2b 06                	sub    (%esi),%eax
+  802775:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  80277b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802782:	00 00 00 
+  stat->st_dev = &devpipe;
+  802785:	c7 83 88 00 00 00 28 	movl   $0x805028,0x88(%ebx)
+  80278c:	50 80 00 
+  return 0;
+}
+  80278f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802794:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802797:	5b                   	pop    %ebx
+  802798:	5e                   	pop    %esi
+  802799:	5d                   	pop    %ebp
+  80279a:	c3                   	ret
+
+0080279b <pipe_wakeup>:
+{
+  80279b:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  80279d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027a2:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  8027a5:	85 c0                	test   %eax,%eax
+  8027a7:	75 01                	jne    8027aa <pipe_wakeup+0xf>
+  8027a9:	c3                   	ret
+{
+  8027aa:	55                   	push   %ebp
+  8027ab:	89 e5                	mov    %esp,%ebp
+  8027ad:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  8027b0:	6a 00                	push   $0x0
+  8027b2:	68 00 00 c0 ee       	push   $0xeec00000
+  8027b7:	52                   	push   %edx
+  8027b8:	e8 62 e8 ff ff       	call   80101f <sys_chan_wakeup>
+  8027bd:	83 c4 10             	add    $0x10,%esp
+}
+  8027c0:	c9                   	leave
+  8027c1:	c3                   	ret
+
+008027c2 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8027c2:	55                   	push   %ebp
+  8027c3:	89 e5                	mov    %esp,%ebp
+  8027c5:	57                   	push   %edi
+  8027c6:	56                   	push   %esi
+  8027c7:	53                   	push   %ebx
+  8027c8:	83 ec 18             	sub    $0x18,%esp
+  8027cb:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  8027ce:	57                   	push   %edi
+  8027cf:	e8 45 ef ff ff       	call   801719 <fd2data>
+  8027d4:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  8027d6:	83 c4 10             	add    $0x10,%esp
+  8027d9:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  8027dd:	74 2a                	je     802809 <devpipe_close+0x47>
+  8027df:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  8027e4:	89 f8                	mov    %edi,%eax
+  8027e6:	e8 4f ff ff ff       	call   80273a <pipe_ring>
+  8027eb:	83 ec 08             	sub    $0x8,%esp
+  8027ee:	01 d8                	add    %ebx,%eax
+  8027f0:	50                   	push   %eax
+  8027f1:	6a 00                	push   $0x0
+  8027f3:	e8 50 e5 ff ff       	call   800d48 <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  8027f8:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8027fe:	83 c4 10             	add    $0x10,%esp
+  802801:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  802807:	75 db                	jne    8027e4 <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  802809:	83 ec 08             	sub    $0x8,%esp
+  80280c:	57                   	push   %edi
+  80280d:	6a 00                	push   $0x0
+  80280f:	e8 34 e5 ff ff       	call   800d48 <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  802814:	83 c4 10             	add    $0x10,%esp
+  802817:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  80281b:	75 13                	jne    802830 <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  80281d:	83 ec 08             	sub    $0x8,%esp
+  802820:	56                   	push   %esi
+  802821:	6a 00                	push   $0x0
+  802823:	e8 20 e5 ff ff       	call   800d48 <sys_page_unmap>
+}
+  802828:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80282b:	5b                   	pop    %ebx
+  80282c:	5e                   	pop    %esi
+  80282d:	5f                   	pop    %edi
+  80282e:	5d                   	pop    %ebp
+  80282f:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802830:	8d 56 04             	lea    0x4(%esi),%edx
+  802833:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802836:	e8 60 ff ff ff       	call   80279b <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  80283b:	8d 46 30             	lea    0x30(%esi),%eax
+  80283e:	89 f2                	mov    %esi,%edx
+  802840:	e8 56 ff ff ff       	call   80279b <pipe_wakeup>
+  802845:	eb d6                	jmp    80281d <devpipe_close+0x5b>
+
+00802847 <_pipeisclosed>:
+{
+  802847:	55                   	push   %ebp
+  802848:	89 e5                	mov    %esp,%ebp
+  80284a:	57                   	push   %edi
+  80284b:	56                   	push   %esi
+  80284c:	53                   	push   %ebx
+  80284d:	83 ec 1c             	sub    $0x1c,%esp
+  802850:	89 c7                	mov    %eax,%edi
+  802852:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  802854:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  802859:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  80285c:	83 ec 0c             	sub    $0xc,%esp
+  80285f:	57                   	push   %edi
+  802860:	e8 7c 0f 00 00       	call   8037e1 <pageref>
+  802865:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802868:	89 34 24             	mov    %esi,(%esp)
+  80286b:	e8 71 0f 00 00       	call   8037e1 <pageref>
+    nn = thisenv->env_runs;
+  802870:	8b 15 a0 68 80 00    	mov    0x8068a0,%edx
+  802876:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  802879:	83 c4 10             	add    $0x10,%esp
+  80287c:	39 cb                	cmp    %ecx,%ebx
+  80287e:	74 1b                	je     80289b <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  802880:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802883:	75 cf                	jne    802854 <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802885:	8b 42 58             	mov    0x58(%edx),%eax
+  802888:	6a 01                	push   $0x1
+  80288a:	50                   	push   %eax
+  80288b:	53                   	push   %ebx
+  80288c:	68 53 40 80 00       	push   $0x804053
+  802891:	e8 10 da ff ff       	call   8002a6 <cprintf>
+  802896:	83 c4 10             	add    $0x10,%esp
+  802899:	eb b9                	jmp    802854 <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  80289b:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80289e:	0f 94 c0             	sete   %al
+  8028a1:	0f b6 c0             	movzbl %al,%eax
+}
+  8028a4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028a7:	5b                   	pop    %ebx
+  8028a8:	5e                   	pop    %esi
+  8028a9:	5f                   	pop    %edi
+  8028aa:	5d                   	pop    %ebp
+  8028ab:	c3                   	ret
+
+008028ac <devpipe_write_bulk>:
+{
+  8028ac:	55                   	push   %ebp
+  8028ad:	89 e5                	mov    %esp,%ebp
+  8028af:	57                   	push   %edi
+  8028b0:	56                   	push   %esi
+  8028b1:	53                   	push   %ebx
+  8028b2:	83 ec 1c             	sub    $0x1c,%esp
+  8028b5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8028b8:	89 d6                	mov    %edx,%esi
+  8028ba:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  8028bd:	e8 78 fe ff ff       	call   80273a <pipe_ring>
+  8028c2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  8028c5:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  8028ca:	8d 46 04             	lea    0x4(%esi),%eax
+  8028cd:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  8028d0:	eb 75                	jmp    802947 <devpipe_write_bulk+0x9b>
+  8028d2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8028d7:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  8028db:	6a 64                	push   $0x64
+  8028dd:	68 00 00 c0 ee       	push   $0xeec00000
+  8028e2:	53                   	push   %ebx
+  8028e3:	56                   	push   %esi
+  8028e4:	e8 13 e7 ff ff       	call   800ffc <sys_chan_sleep>
+      continue;
+  8028e9:	83 c4 10             	add    $0x10,%esp
+  8028ec:	eb 59                	jmp    802947 <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  8028ee:	89 d1                	mov    %edx,%ecx
+  8028f0:	c1 f9 1f             	sar    $0x1f,%ecx
+  8028f3:	c1 e9 11             	shr    $0x11,%ecx
+  8028f6:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  8028f9:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8028fe:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  802900:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  802906:	29 d3                	sub    %edx,%ebx
+  802908:	ba 00 80 00 00       	mov    $0x8000,%edx
+  80290d:	29 c2                	sub    %eax,%edx
+  80290f:	39 d3                	cmp    %edx,%ebx
+  802911:	0f 47 da             	cmova  %edx,%ebx
+  802914:	8b 55 08             	mov    0x8(%ebp),%edx
+  802917:	29 fa                	sub    %edi,%edx
+  802919:	39 d3                	cmp    %edx,%ebx
+  80291b:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  80291e:	83 ec 04             	sub    $0x4,%esp
+  802921:	53                   	push   %ebx
+  802922:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802925:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  802928:	52                   	push   %edx
+  802929:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80292c:	01 c8                	add    %ecx,%eax
+  80292e:	50                   	push   %eax
+  80292f:	e8 48 e1 ff ff       	call   800a7c <memcpy>
+    i += m;
+  802934:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  802936:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802939:	8d 46 2c             	lea    0x2c(%esi),%eax
+  80293c:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80293f:	e8 57 fe ff ff       	call   80279b <pipe_wakeup>
+  802944:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802947:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  80294a:	73 2b                	jae    802977 <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  80294c:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  80294e:	8b 56 04             	mov    0x4(%esi),%edx
+  802951:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  802957:	39 d0                	cmp    %edx,%eax
+  802959:	7d 93                	jge    8028ee <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  80295b:	89 f2                	mov    %esi,%edx
+  80295d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802960:	e8 e2 fe ff ff       	call   802847 <_pipeisclosed>
+  802965:	85 c0                	test   %eax,%eax
+  802967:	0f 84 65 ff ff ff    	je     8028d2 <devpipe_write_bulk+0x26>
+        return i;
+  80296d:	89 f8                	mov    %edi,%eax
+}
+  80296f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802972:	5b                   	pop    %ebx
+  802973:	5e                   	pop    %esi
+  802974:	5f                   	pop    %edi
+  802975:	5d                   	pop    %ebp
+  802976:	c3                   	ret
+  return i;
+  802977:	89 f8                	mov    %edi,%eax
+  802979:	eb f4                	jmp    80296f <devpipe_write_bulk+0xc3>
+
+0080297b <devpipe_write>:
+{
+  80297b:	55                   	push   %ebp
+  80297c:	89 e5                	mov    %esp,%ebp
+  80297e:	57                   	push   %edi
+  80297f:	56                   	push   %esi
+  802980:	53                   	push   %ebx
+  802981:	83 ec 28             	sub    $0x28,%esp
+  802984:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  802987:	56                   	push   %esi
+  802988:	e8 8c ed ff ff       	call   801719 <fd2data>
+  80298d:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  80298f:	8b 78 28             	mov    0x28(%eax),%edi
+  802992:	83 c4 10             	add    $0x10,%esp
+  802995:	85 ff                	test   %edi,%edi
+  802997:	75 25                	jne    8029be <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  802999:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  80299c:	74 66                	je     802a04 <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  80299e:	8b 43 04             	mov    0x4(%ebx),%eax
+  8029a1:	8b 0b                	mov    (%ebx),%ecx
+  8029a3:	8d 51 20             	lea    0x20(%ecx),%edx
+  8029a6:	39 d0                	cmp    %edx,%eax
+  8029a8:	72 2b                	jb     8029d5 <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  8029aa:	89 da                	mov    %ebx,%edx
+  8029ac:	89 f0                	mov    %esi,%eax
+  8029ae:	e8 94 fe ff ff       	call   802847 <_pipeisclosed>
+  8029b3:	85 c0                	test   %eax,%eax
+  8029b5:	75 51                	jne    802a08 <devpipe_write+0x8d>
+      sys_yield();
+  8029b7:	e8 a5 e2 ff ff       	call   800c61 <sys_yield>
+  8029bc:	eb e0                	jmp    80299e <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  8029be:	83 ec 0c             	sub    $0xc,%esp
+  8029c1:	ff 75 10             	push   0x10(%ebp)
+  8029c4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8029c7:	89 c2                	mov    %eax,%edx
+  8029c9:	89 f0                	mov    %esi,%eax
+  8029cb:	e8 dc fe ff ff       	call   8028ac <devpipe_write_bulk>
+  8029d0:	83 c4 10             	add    $0x10,%esp
+  8029d3:	eb 38                	jmp    802a0d <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8029d5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8029d8:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8029dc:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8029df:	89 c2                	mov    %eax,%edx
+  8029e1:	c1 fa 1f             	sar    $0x1f,%edx
+  8029e4:	89 d1                	mov    %edx,%ecx
+  8029e6:	c1 e9 1b             	shr    $0x1b,%ecx
+  8029e9:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8029ec:	83 e2 1f             	and    $0x1f,%edx
+  8029ef:	29 ca                	sub    %ecx,%edx
+  8029f1:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8029f5:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  8029f9:	83 c0 01             	add    $0x1,%eax
+  8029fc:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  8029ff:	83 c7 01             	add    $0x1,%edi
+  802a02:	eb 95                	jmp    802999 <devpipe_write+0x1e>
+  return i;
+  802a04:	89 f8                	mov    %edi,%eax
+  802a06:	eb 05                	jmp    802a0d <devpipe_write+0x92>
+        return 0;
+  802a08:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a0d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a10:	5b                   	pop    %ebx
+  802a11:	5e                   	pop    %esi
+  802a12:	5f                   	pop    %edi
+  802a13:	5d                   	pop    %ebp
+  802a14:	c3                   	ret
+
+00802a15 <devpipe_read_bulk>:
+{
+  802a15:	55                   	push   %ebp
+  802a16:	89 e5                	mov    %esp,%ebp
+  802a18:	57                   	push   %edi
+  802a19:	56                   	push   %esi
+  802a1a:	53                   	push   %ebx
+  802a1b:	83 ec 2c             	sub    $0x2c,%esp
+  802a1e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802a21:	89 d6                	mov    %edx,%esi
+  802a23:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802a26:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  802a29:	e8 0c fd ff ff       	call   80273a <pipe_ring>
+  802a2e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  802a31:	85 db                	test   %ebx,%ebx
+  802a33:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802a38:	0f 45 c3             	cmovne %ebx,%eax
+  802a3b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802a3e:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802a43:	8d 46 30             	lea    0x30(%esi),%eax
+  802a46:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  802a49:	eb 50                	jmp    802a9b <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  802a4b:	89 d1                	mov    %edx,%ecx
+  802a4d:	c1 f9 1f             	sar    $0x1f,%ecx
+  802a50:	c1 e9 11             	shr    $0x11,%ecx
+  802a53:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802a56:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802a5b:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  802a5d:	29 d3                	sub    %edx,%ebx
+  802a5f:	ba 00 80 00 00       	mov    $0x8000,%edx
+  802a64:	29 c2                	sub    %eax,%edx
+  802a66:	39 d3                	cmp    %edx,%ebx
+  802a68:	0f 47 da             	cmova  %edx,%ebx
+  802a6b:	8b 55 08             	mov    0x8(%ebp),%edx
+  802a6e:	29 fa                	sub    %edi,%edx
+  802a70:	39 d3                	cmp    %edx,%ebx
+  802a72:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  802a75:	83 ec 04             	sub    $0x4,%esp
+  802a78:	53                   	push   %ebx
+  802a79:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802a7c:	01 c8                	add    %ecx,%eax
+  802a7e:	50                   	push   %eax
+  802a7f:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802a82:	01 f8                	add    %edi,%eax
+  802a84:	50                   	push   %eax
+  802a85:	e8 f2 df ff ff       	call   800a7c <memcpy>
+    i += m;
+  802a8a:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  802a8c:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802a8e:	89 f2                	mov    %esi,%edx
+  802a90:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802a93:	e8 03 fd ff ff       	call   80279b <pipe_wakeup>
+  802a98:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802a9b:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802a9e:	73 51                	jae    802af1 <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  802aa0:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  802aa3:	8b 16                	mov    (%esi),%edx
+  802aa5:	39 da                	cmp    %ebx,%edx
+  802aa7:	75 a2                	jne    802a4b <devpipe_read_bulk+0x36>
+      if (i > 0)
+  802aa9:	85 ff                	test   %edi,%edi
+  802aab:	75 44                	jne    802af1 <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  802aad:	89 f2                	mov    %esi,%edx
+  802aaf:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802ab2:	e8 90 fd ff ff       	call   802847 <_pipeisclosed>
+  802ab7:	85 c0                	test   %eax,%eax
+  802ab9:	75 3a                	jne    802af5 <devpipe_read_bulk+0xe0>
+  802abb:	b8 01 00 00 00       	mov    $0x1,%eax
+  802ac0:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802ac4:	6a 64                	push   $0x64
+  802ac6:	ff 75 d4             	push   -0x2c(%ebp)
+  802ac9:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  802aca:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802acd:	50                   	push   %eax
+  802ace:	e8 29 e5 ff ff       	call   800ffc <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  802ad3:	85 c0                	test   %eax,%eax
+  802ad5:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ada:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  802add:	83 c4 10             	add    $0x10,%esp
+  802ae0:	a8 01                	test   $0x1,%al
+  802ae2:	74 b7                	je     802a9b <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  802ae4:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  802ae9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802aec:	5b                   	pop    %ebx
+  802aed:	5e                   	pop    %esi
+  802aee:	5f                   	pop    %edi
+  802aef:	5d                   	pop    %ebp
+  802af0:	c3                   	ret
+  return i;
+  802af1:	89 f8                	mov    %edi,%eax
+  802af3:	eb f4                	jmp    802ae9 <devpipe_read_bulk+0xd4>
+        return 0;
+  802af5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802afa:	eb ed                	jmp    802ae9 <devpipe_read_bulk+0xd4>
+
+00802afc <devpipe_read>:
+{
+  802afc:	55                   	push   %ebp
+  802afd:	89 e5                	mov    %esp,%ebp
+  802aff:	57                   	push   %edi
+  802b00:	56                   	push   %esi
+  802b01:	53                   	push   %ebx
+  802b02:	83 ec 18             	sub    $0x18,%esp
+  802b05:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  802b08:	57                   	push   %edi
+  802b09:	e8 0b ec ff ff       	call   801719 <fd2data>
+  802b0e:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  802b10:	8b 70 28             	mov    0x28(%eax),%esi
+  802b13:	83 c4 10             	add    $0x10,%esp
+  802b16:	85 f6                	test   %esi,%esi
+  802b18:	75 24                	jne    802b3e <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  802b1a:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802b1d:	74 60                	je     802b7f <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  802b1f:	8b 03                	mov    (%ebx),%eax
+  802b21:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802b24:	75 3b                	jne    802b61 <devpipe_read+0x65>
+      if (i > 0)
+  802b26:	85 f6                	test   %esi,%esi
+  802b28:	75 2d                	jne    802b57 <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  802b2a:	89 da                	mov    %ebx,%edx
+  802b2c:	89 f8                	mov    %edi,%eax
+  802b2e:	e8 14 fd ff ff       	call   802847 <_pipeisclosed>
+  802b33:	85 c0                	test   %eax,%eax
+  802b35:	75 4c                	jne    802b83 <devpipe_read+0x87>
+      sys_yield();
+  802b37:	e8 25 e1 ff ff       	call   800c61 <sys_yield>
+  802b3c:	eb e1                	jmp    802b1f <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  802b3e:	83 ec 08             	sub    $0x8,%esp
+  802b41:	6a 00                	push   $0x0
+  802b43:	ff 75 10             	push   0x10(%ebp)
+  802b46:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802b49:	89 c2                	mov    %eax,%edx
+  802b4b:	89 f8                	mov    %edi,%eax
+  802b4d:	e8 c3 fe ff ff       	call   802a15 <devpipe_read_bulk>
+  802b52:	83 c4 10             	add    $0x10,%esp
+  802b55:	eb 02                	jmp    802b59 <devpipe_read+0x5d>
+        return i;
+  802b57:	89 f0                	mov    %esi,%eax
+}
+  802b59:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b5c:	5b                   	pop    %ebx
+  802b5d:	5e                   	pop    %esi
+  802b5e:	5f                   	pop    %edi
+  802b5f:	5d                   	pop    %ebp
+  802b60:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802b61:	99                   	cltd
+  802b62:	c1 ea 1b             	shr    $0x1b,%edx
+  802b65:	01 d0                	add    %edx,%eax
+  802b67:	83 e0 1f             	and    $0x1f,%eax
+  802b6a:	29 d0                	sub    %edx,%eax
+  802b6c:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802b71:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802b74:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  802b77:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  802b7a:	83 c6 01             	add    $0x1,%esi
+  802b7d:	eb 9b                	jmp    802b1a <devpipe_read+0x1e>
+  return i;
+  802b7f:	89 f0                	mov    %esi,%eax
+  802b81:	eb d6                	jmp    802b59 <devpipe_read+0x5d>
+        return 0;
+  802b83:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b88:	eb cf                	jmp    802b59 <devpipe_read+0x5d>
+
+00802b8a <pipe2>:
+{
+  802b8a:	55                   	push   %ebp
+  802b8b:	89 e5                	mov    %esp,%ebp
+  802b8d:	57                   	push   %edi
+  802b8e:	56                   	push   %esi
+  802b8f:	53                   	push   %ebx
+  802b90:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  802b93:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802b96:	50                   	push   %eax
+  802b97:	e8 91 eb ff ff       	call   80172d <fd_alloc>
+  802b9c:	89 c3                	mov    %eax,%ebx
+  802b9e:	83 c4 10             	add    $0x10,%esp
+  802ba1:	85 c0                	test   %eax,%eax
+  802ba3:	0f 88 fb 01 00 00    	js     802da4 <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802ba9:	83 ec 04             	sub    $0x4,%esp
+  802bac:	68 07 04 00 00       	push   $0x407
+  802bb1:	ff 75 e4             	push   -0x1c(%ebp)
+  802bb4:	6a 00                	push   $0x0
+  802bb6:	e8 08 e1 ff ff       	call   800cc3 <sys_page_alloc>
+  802bbb:	89 c3                	mov    %eax,%ebx
+  802bbd:	83 c4 10             	add    $0x10,%esp
+  802bc0:	85 c0                	test   %eax,%eax
+  802bc2:	0f 88 dc 01 00 00    	js     802da4 <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  802bc8:	83 ec 0c             	sub    $0xc,%esp
+  802bcb:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  802bce:	50                   	push   %eax
+  802bcf:	e8 59 eb ff ff       	call   80172d <fd_alloc>
+  802bd4:	89 c3                	mov    %eax,%ebx
+  802bd6:	83 c4 10             	add    $0x10,%esp
+  802bd9:	85 c0                	test   %eax,%eax
+  802bdb:	0f 88 b3 01 00 00    	js     802d94 <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802be1:	83 ec 04             	sub    $0x4,%esp
+  802be4:	68 07 04 00 00       	push   $0x407
+  802be9:	ff 75 e0             	push   -0x20(%ebp)
+  802bec:	6a 00                	push   $0x0
+  802bee:	e8 d0 e0 ff ff       	call   800cc3 <sys_page_alloc>
+  802bf3:	89 c3                	mov    %eax,%ebx
+  802bf5:	83 c4 10             	add    $0x10,%esp
+  802bf8:	85 c0                	test   %eax,%eax
+  802bfa:	0f 88 94 01 00 00    	js     802d94 <pipe2+0x20a>
+  va = fd2data(fd0);
+  802c00:	83 ec 0c             	sub    $0xc,%esp
+  802c03:	ff 75 e4             	push   -0x1c(%ebp)
+  802c06:	e8 0e eb ff ff       	call   801719 <fd2data>
+  802c0b:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802c0d:	83 c4 0c             	add    $0xc,%esp
+  802c10:	68 07 04 00 00       	push   $0x407
+  802c15:	50                   	push   %eax
+  802c16:	6a 00                	push   $0x0
+  802c18:	e8 a6 e0 ff ff       	call   800cc3 <sys_page_alloc>
+  802c1d:	89 c3                	mov    %eax,%ebx
+  802c1f:	83 c4 10             	add    $0x10,%esp
+  802c22:	85 c0                	test   %eax,%eax
+  802c24:	0f 88 5a 01 00 00    	js     802d84 <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802c2a:	83 ec 0c             	sub    $0xc,%esp
+  802c2d:	ff 75 e0             	push   -0x20(%ebp)
+  802c30:	e8 e4 ea ff ff       	call   801719 <fd2data>
+  802c35:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802c3c:	50                   	push   %eax
+  802c3d:	6a 00                	push   $0x0
+  802c3f:	57                   	push   %edi
+  802c40:	6a 00                	push   $0x0
+  802c42:	e8 bf e0 ff ff       	call   800d06 <sys_page_map>
+  802c47:	89 c3                	mov    %eax,%ebx
+  802c49:	83 c4 20             	add    $0x20,%esp
+  802c4c:	85 c0                	test   %eax,%eax
+  802c4e:	0f 88 22 01 00 00    	js     802d76 <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  802c54:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  802c58:	74 72                	je     802ccc <pipe2+0x142>
+  802c5a:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  802c5f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802c62:	e8 d3 fa ff ff       	call   80273a <pipe_ring>
+  802c67:	83 ec 04             	sub    $0x4,%esp
+  802c6a:	68 07 04 00 00       	push   $0x407
+  802c6f:	01 f0                	add    %esi,%eax
+  802c71:	50                   	push   %eax
+  802c72:	6a 00                	push   $0x0
+  802c74:	e8 4a e0 ff ff       	call   800cc3 <sys_page_alloc>
+  802c79:	89 c3                	mov    %eax,%ebx
+  802c7b:	83 c4 10             	add    $0x10,%esp
+  802c7e:	85 c0                	test   %eax,%eax
+  802c80:	0f 88 97 00 00 00    	js     802d1d <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  802c86:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802c89:	e8 ac fa ff ff       	call   80273a <pipe_ring>
+  802c8e:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  802c91:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802c94:	e8 a1 fa ff ff       	call   80273a <pipe_ring>
+  802c99:	83 ec 0c             	sub    $0xc,%esp
+  802c9c:	68 07 04 00 00       	push   $0x407
+  802ca1:	53                   	push   %ebx
+  802ca2:	6a 00                	push   $0x0
+  802ca4:	01 f0                	add    %esi,%eax
+  802ca6:	50                   	push   %eax
+  802ca7:	6a 00                	push   $0x0
+  802ca9:	e8 58 e0 ff ff       	call   800d06 <sys_page_map>
+  802cae:	89 c3                	mov    %eax,%ebx
+  802cb0:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802cb6:	83 c4 20             	add    $0x20,%esp
+  802cb9:	85 c0                	test   %eax,%eax
+  802cbb:	78 60                	js     802d1d <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  802cbd:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802cc3:	75 9a                	jne    802c5f <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  802cc5:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  802ccc:	a1 28 50 80 00       	mov    0x805028,%eax
+  802cd1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802cd4:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  802cd6:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802cd9:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  802ce0:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802ce3:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  802ce5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802ce8:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  802cef:	83 ec 0c             	sub    $0xc,%esp
+  802cf2:	ff 75 e4             	push   -0x1c(%ebp)
+  802cf5:	e8 0f ea ff ff       	call   801709 <fd2num>
+  802cfa:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802cfd:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  802cff:	83 c4 04             	add    $0x4,%esp
+  802d02:	ff 75 e0             	push   -0x20(%ebp)
+  802d05:	e8 ff e9 ff ff       	call   801709 <fd2num>
+  802d0a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802d0d:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  802d10:	83 c4 10             	add    $0x10,%esp
+  802d13:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d18:	e9 87 00 00 00       	jmp    802da4 <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802d1d:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  802d22:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802d25:	e8 10 fa ff ff       	call   80273a <pipe_ring>
+  802d2a:	83 ec 08             	sub    $0x8,%esp
+  802d2d:	01 f0                	add    %esi,%eax
+  802d2f:	50                   	push   %eax
+  802d30:	6a 00                	push   $0x0
+  802d32:	e8 11 e0 ff ff       	call   800d48 <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  802d37:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802d3a:	e8 fb f9 ff ff       	call   80273a <pipe_ring>
+  802d3f:	83 c4 08             	add    $0x8,%esp
+  802d42:	01 f0                	add    %esi,%eax
+  802d44:	50                   	push   %eax
+  802d45:	6a 00                	push   $0x0
+  802d47:	e8 fc df ff ff       	call   800d48 <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802d4c:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802d52:	83 c4 10             	add    $0x10,%esp
+  802d55:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802d5b:	75 c5                	jne    802d22 <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  802d5d:	83 ec 0c             	sub    $0xc,%esp
+  802d60:	ff 75 e0             	push   -0x20(%ebp)
+  802d63:	e8 b1 e9 ff ff       	call   801719 <fd2data>
+  802d68:	83 c4 08             	add    $0x8,%esp
+  802d6b:	50                   	push   %eax
+  802d6c:	6a 00                	push   $0x0
+  802d6e:	e8 d5 df ff ff       	call   800d48 <sys_page_unmap>
+  802d73:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  802d76:	83 ec 08             	sub    $0x8,%esp
+  802d79:	57                   	push   %edi
+  802d7a:	6a 00                	push   $0x0
+  802d7c:	e8 c7 df ff ff       	call   800d48 <sys_page_unmap>
+  802d81:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  802d84:	83 ec 08             	sub    $0x8,%esp
+  802d87:	ff 75 e0             	push   -0x20(%ebp)
+  802d8a:	6a 00                	push   $0x0
+  802d8c:	e8 b7 df ff ff       	call   800d48 <sys_page_unmap>
+  802d91:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  802d94:	83 ec 08             	sub    $0x8,%esp
+  802d97:	ff 75 e4             	push   -0x1c(%ebp)
+  802d9a:	6a 00                	push   $0x0
+  802d9c:	e8 a7 df ff ff       	call   800d48 <sys_page_unmap>
+  802da1:	83 c4 10             	add    $0x10,%esp
+}
+  802da4:	89 d8                	mov    %ebx,%eax
+  802da6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802da9:	5b                   	pop    %ebx
+  802daa:	5e                   	pop    %esi
+  802dab:	5f                   	pop    %edi
+  802dac:	5d                   	pop    %ebp
+  802dad:	c3                   	ret
+
+00802dae <pipe>:
+{
+  802dae:	55                   	push   %ebp
+  802daf:	89 e5                	mov    %esp,%ebp
+  802db1:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  802db4:	6a 00                	push   $0x0
+  802db6:	ff 75 08             	push   0x8(%ebp)
+  802db9:	e8 cc fd ff ff       	call   802b8a <pipe2>
+}
+  802dbe:	c9                   	leave
+  802dbf:	c3                   	ret
+
+00802dc0 <pipeisclosed>:
+{
+  802dc0:	55                   	push   %ebp
+  802dc1:	89 e5                	mov    %esp,%ebp
+  802dc3:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802dc6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802dc9:	50                   	push   %eax
+  802dca:	ff 75 08             	push   0x8(%ebp)
+  802dcd:	e8 b1 e9 ff ff       	call   801783 <fd_lookup>
+  802dd2:	83 c4 10             	add    $0x10,%esp
+  802dd5:	85 c0                	test   %eax,%eax
+  802dd7:	78 18                	js     802df1 <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  802dd9:	83 ec 0c             	sub    $0xc,%esp
+  802ddc:	ff 75 f4             	push   -0xc(%ebp)
+  802ddf:	e8 35 e9 ff ff       	call   801719 <fd2data>
+  802de4:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  802de6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802de9:	e8 59 fa ff ff       	call   802847 <_pipeisclosed>
+  802dee:	83 c4 10             	add    $0x10,%esp
+}
+  802df1:	c9                   	leave
+  802df2:	c3                   	ret
+
+00802df3 <pipe_splice>:
+{
+  802df3:	55                   	push   %ebp
+  802df4:	89 e5                	mov    %esp,%ebp
+  802df6:	57                   	push   %edi
+  802df7:	56                   	push   %esi
+  802df8:	53                   	push   %ebx
+  802df9:	83 ec 34             	sub    $0x34,%esp
+  802dfc:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802dff:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802e02:	50                   	push   %eax
+  802e03:	ff 75 08             	push   0x8(%ebp)
+  802e06:	e8 78 e9 ff ff       	call   801783 <fd_lookup>
+  802e0b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802e0e:	83 c4 10             	add    $0x10,%esp
+  802e11:	85 c0                	test   %eax,%eax
+  802e13:	0f 88 d7 00 00 00    	js     802ef0 <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  802e19:	83 ec 0c             	sub    $0xc,%esp
+  802e1c:	ff 75 e4             	push   -0x1c(%ebp)
+  802e1f:	e8 f5 e8 ff ff       	call   801719 <fd2data>
+  802e24:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802e26:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802e29:	83 c4 10             	add    $0x10,%esp
+  802e2c:	8b 15 28 50 80 00    	mov    0x805028,%edx
+  802e32:	39 10                	cmp    %edx,(%eax)
+  802e34:	0f 85 c1 00 00 00    	jne    802efb <pipe_splice+0x108>
+  802e3a:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  802e3e:	0f 84 c0 00 00 00    	je     802f04 <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  802e44:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802e48:	0f 84 bf 00 00 00    	je     802f0d <pipe_splice+0x11a>
+  802e4e:	89 f7                	mov    %esi,%edi
+  802e50:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  802e56:	0f 85 ba 00 00 00    	jne    802f16 <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802e5c:	8d 43 04             	lea    0x4(%ebx),%eax
+  802e5f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802e62:	eb 38                	jmp    802e9c <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802e64:	83 ec 0c             	sub    $0xc,%esp
+  802e67:	68 00 10 00 00       	push   $0x1000
+  802e6c:	89 f1                	mov    %esi,%ecx
+  802e6e:	89 da                	mov    %ebx,%edx
+  802e70:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802e73:	e8 34 fa ff ff       	call   8028ac <devpipe_write_bulk>
+  802e78:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802e7b:	83 c4 10             	add    $0x10,%esp
+  802e7e:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802e83:	75 53                	jne    802ed8 <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  802e85:	83 ec 08             	sub    $0x8,%esp
+  802e88:	56                   	push   %esi
+  802e89:	6a 00                	push   $0x0
+  802e8b:	e8 b8 de ff ff       	call   800d48 <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  802e90:	83 c7 01             	add    $0x1,%edi
+  802e93:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802e99:	83 c4 10             	add    $0x10,%esp
+  802e9c:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802e9f:	74 3a                	je     802edb <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  802ea1:	8b 03                	mov    (%ebx),%eax
+  802ea3:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802ea6:	75 bc                	jne    802e64 <pipe_splice+0x71>
+  802ea8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ead:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  802eb1:	85 c0                	test   %eax,%eax
+  802eb3:	74 af                	je     802e64 <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802eb5:	83 ec 04             	sub    $0x4,%esp
+  802eb8:	6a 07                	push   $0x7
+  802eba:	56                   	push   %esi
+  802ebb:	ff 75 d0             	push   -0x30(%ebp)
+  802ebe:	e8 5c e1 ff ff       	call   80101f <sys_chan_wakeup>
+  802ec3:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802ec6:	83 c4 10             	add    $0x10,%esp
+  802ec9:	85 c0                	test   %eax,%eax
+  802ecb:	79 b8                	jns    802e85 <pipe_splice+0x92>
+  802ecd:	b8 01 00 00 00       	mov    $0x1,%eax
+  802ed2:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802ed6:	eb 8c                	jmp    802e64 <pipe_splice+0x71>
+  802ed8:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  802edb:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802edf:	75 06                	jne    802ee7 <pipe_splice+0xf4>
+  802ee1:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802ee5:	78 09                	js     802ef0 <pipe_splice+0xfd>
+  return i * PGSIZE;
+  802ee7:	8b 45 10             	mov    0x10(%ebp),%eax
+  802eea:	c1 e0 0c             	shl    $0xc,%eax
+  802eed:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  802ef0:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802ef3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ef6:	5b                   	pop    %ebx
+  802ef7:	5e                   	pop    %esi
+  802ef8:	5f                   	pop    %edi
+  802ef9:	5d                   	pop    %ebp
+  802efa:	c3                   	ret
+    return -E_INVAL;
+  802efb:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802f02:	eb ec                	jmp    802ef0 <pipe_splice+0xfd>
+  802f04:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802f0b:	eb e3                	jmp    802ef0 <pipe_splice+0xfd>
+  802f0d:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802f14:	eb da                	jmp    802ef0 <pipe_splice+0xfd>
+  802f16:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802f1d:	eb d1                	jmp    802ef0 <pipe_splice+0xfd>
+
+00802f1f <pipe_splice_read>:
+{
+  802f1f:	55                   	push   %ebp
+  802f20:	89 e5                	mov    %esp,%ebp
+  802f22:	53                   	push   %ebx
+  802f23:	83 ec 1c             	sub    $0x1c,%esp
+  802f26:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802f29:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802f2c:	50                   	push   %eax
+  802f2d:	ff 75 08             	push   0x8(%ebp)
+  802f30:	e8 4e e8 ff ff       	call   801783 <fd_lookup>
+  802f35:	83 c4 10             	add    $0x10,%esp
+  802f38:	85 c0                	test   %eax,%eax
+  802f3a:	78 49                	js     802f85 <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  802f3c:	83 ec 0c             	sub    $0xc,%esp
+  802f3f:	ff 75 f4             	push   -0xc(%ebp)
+  802f42:	e8 d2 e7 ff ff       	call   801719 <fd2data>
+  802f47:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802f49:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802f4c:	83 c4 10             	add    $0x10,%esp
+  802f4f:	8b 0d 28 50 80 00    	mov    0x805028,%ecx
+  802f55:	39 08                	cmp    %ecx,(%eax)
+  802f57:	75 31                	jne    802f8a <pipe_splice_read+0x6b>
+  802f59:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  802f5d:	74 32                	je     802f91 <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  802f5f:	8b 48 08             	mov    0x8(%eax),%ecx
+  802f62:	83 e1 03             	and    $0x3,%ecx
+  802f65:	83 f9 01             	cmp    $0x1,%ecx
+  802f68:	74 2e                	je     802f98 <pipe_splice_read+0x79>
+  802f6a:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  802f70:	75 2d                	jne    802f9f <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  802f72:	83 ec 08             	sub    $0x8,%esp
+  802f75:	53                   	push   %ebx
+  802f76:	68 00 10 00 00       	push   $0x1000
+  802f7b:	89 d9                	mov    %ebx,%ecx
+  802f7d:	e8 93 fa ff ff       	call   802a15 <devpipe_read_bulk>
+  802f82:	83 c4 10             	add    $0x10,%esp
+}
+  802f85:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f88:	c9                   	leave
+  802f89:	c3                   	ret
+    return -E_INVAL;
+  802f8a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802f8f:	eb f4                	jmp    802f85 <pipe_splice_read+0x66>
+  802f91:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802f96:	eb ed                	jmp    802f85 <pipe_splice_read+0x66>
+  802f98:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802f9d:	eb e6                	jmp    802f85 <pipe_splice_read+0x66>
+  802f9f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802fa4:	eb df                	jmp    802f85 <pipe_splice_read+0x66>
+
+00802fa6 <mmap_find>:
+          utf->utf_eip, utf->utf_err);
+}
+
+static struct Mmap *
+mmap_find(uintptr_t va)
+{
+  802fa6:	55                   	push   %ebp
+  802fa7:	89 e5                	mov    %esp,%ebp
+  802fa9:	56                   	push   %esi
+  802faa:	53                   	push   %ebx
+  int i;
+
+  for (i = 0; i < NMMAP; i++)
+  802fab:	ba 60 67 80 00       	mov    $0x806760,%edx
+  802fb0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802fb5:	eb 0b                	jmp    802fc2 <mmap_find+0x1c>
+  802fb7:	83 c3 01             	add    $0x1,%ebx
+  802fba:	83 c2 14             	add    $0x14,%edx
+  802fbd:	83 fb 10             	cmp    $0x10,%ebx
+  802fc0:	74 1d                	je     802fdf <mmap_find+0x39>
+    if (mmaps[i].mm_va && va >= mmaps[i].mm_va &&
+  802fc2:	8b 0a                	mov    (%edx),%ecx
+  802fc4:	39 c8                	cmp    %ecx,%eax
+  802fc6:	72 ef                	jb     802fb7 <mmap_find+0x11>
+  802fc8:	85 c9                	test   %ecx,%ecx
+  802fca:	74 eb                	je     802fb7 <mmap_find+0x11>
+        va < mmaps[i].mm_va + mmaps[i].mm_len)
+  802fcc:	03 4a 04             	add    0x4(%edx),%ecx
+    if (mmaps[i].mm_va && va >= mmaps[i].mm_va &&
+  802fcf:	39 c8                	cmp    %ecx,%eax
+  802fd1:	73 e4                	jae    802fb7 <mmap_find+0x11>
+      return &mmaps[i];
+  802fd3:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802fd6:	8d 04 85 60 67 80 00 	lea    0x806760(,%eax,4),%eax
+  802fdd:	eb 05                	jmp    802fe4 <mmap_find+0x3e>
+  return NULL;
+  802fdf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802fe4:	5b                   	pop    %ebx
+  802fe5:	5e                   	pop    %esi
+  802fe6:	5d                   	pop    %ebp
+  802fe7:	c3                   	ret
+
+00802fe8 <va_mapped>:
+
+static bool
+va_mapped(uintptr_t va)
+{
+  return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+  802fe8:	89 c2                	mov    %eax,%edx
+  802fea:	c1 ea 16             	shr    $0x16,%edx
+  802fed:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802ff4:	f6 c2 01             	test   $0x1,%dl
+  802ff7:	74 11                	je     80300a <va_mapped+0x22>
+  802ff9:	c1 e8 0c             	shr    $0xc,%eax
+  802ffc:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803003:	83 e0 01             	and    $0x1,%eax
+  803006:	83 e0 01             	and    $0x1,%eax
+}
+  803009:	c3                   	ret
+  return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+  80300a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80300f:	eb f5                	jmp    803006 <va_mapped+0x1e>
+
+00803011 <mmap_copy>:
+
+// Replace the page at 'va' with a copy of its first 'n' bytes, the rest
+// zeroed, mapped with 'perm'.
+static void
+mmap_copy(uintptr_t va, size_t n, int perm)
+{
+  803011:	55                   	push   %ebp
+  803012:	89 e5                	mov    %esp,%ebp
+  803014:	57                   	push   %edi
+  803015:	56                   	push   %esi
+  803016:	53                   	push   %ebx
+  803017:	83 ec 10             	sub    $0x10,%esp
+  80301a:	89 c3                	mov    %eax,%ebx
+  80301c:	89 d7                	mov    %edx,%edi
+  80301e:	89 ce                	mov    %ecx,%esi
+  int r;
+
+  if ((r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  803020:	6a 07                	push   $0x7
+  803022:	68 00 f0 7f 00       	push   $0x7ff000
+  803027:	6a 00                	push   $0x0
+  803029:	e8 95 dc ff ff       	call   800cc3 <sys_page_alloc>
+  80302e:	83 c4 10             	add    $0x10,%esp
+  803031:	85 c0                	test   %eax,%eax
+  803033:	78 46                	js     80307b <mmap_copy+0x6a>
+    panic("mmap: %e", r);
+  memmove(PFTEMP, (void *) va, n);
+  803035:	83 ec 04             	sub    $0x4,%esp
+  803038:	57                   	push   %edi
+  803039:	53                   	push   %ebx
+  80303a:	68 00 f0 7f 00       	push   $0x7ff000
+  80303f:	e8 d6 d9 ff ff       	call   800a1a <memmove>
+  if ((r = sys_page_map(0, PFTEMP, 0, (void *) va, perm)) < 0 ||
+  803044:	89 34 24             	mov    %esi,(%esp)
+  803047:	53                   	push   %ebx
+  803048:	6a 00                	push   $0x0
+  80304a:	68 00 f0 7f 00       	push   $0x7ff000
+  80304f:	6a 00                	push   $0x0
+  803051:	e8 b0 dc ff ff       	call   800d06 <sys_page_map>
+  803056:	83 c4 20             	add    $0x20,%esp
+  803059:	85 c0                	test   %eax,%eax
+  80305b:	78 30                	js     80308d <mmap_copy+0x7c>
+      (r = sys_page_unmap(0, PFTEMP)) < 0)
+  80305d:	83 ec 08             	sub    $0x8,%esp
+  803060:	68 00 f0 7f 00       	push   $0x7ff000
+  803065:	6a 00                	push   $0x0
+  803067:	e8 dc dc ff ff       	call   800d48 <sys_page_unmap>
+  if ((r = sys_page_map(0, PFTEMP, 0, (void *) va, perm)) < 0 ||
+  80306c:	83 c4 10             	add    $0x10,%esp
+  80306f:	85 c0                	test   %eax,%eax
+  803071:	78 1a                	js     80308d <mmap_copy+0x7c>
+    panic("mmap: %e", r);
+}
+  803073:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803076:	5b                   	pop    %ebx
+  803077:	5e                   	pop    %esi
+  803078:	5f                   	pop    %edi
+  803079:	5d                   	pop    %ebp
+  80307a:	c3                   	ret
+    panic("mmap: %e", r);
+  80307b:	50                   	push   %eax
+  80307c:	68 6b 40 80 00       	push   $0x80406b
+  803081:	6a 3e                	push   $0x3e
+  803083:	68 74 40 80 00       	push   $0x804074
+  803088:	e8 a1 06 00 00       	call   80372e <_panic>
+    panic("mmap: %e", r);
+  80308d:	50                   	push   %eax
+  80308e:	68 6b 40 80 00       	push   $0x80406b
+  803093:	6a 42                	push   $0x42
+  803095:	68 74 40 80 00       	push   $0x804074
+  80309a:	e8 8f 06 00 00       	call   80372e <_panic>
+
+0080309f <mmap_fault>:
+// Handle a page fault in a mapping, if it is one.  Returns 1 if it was.
+// The fork page fault handlers call this first, so that mappings keep
+// working after a fork.
+bool
+mmap_fault(struct UTrapframe *utf)
+{
+  80309f:	55                   	push   %ebp
+  8030a0:	89 e5                	mov    %esp,%ebp
+  8030a2:	57                   	push   %edi
+  8030a3:	56                   	push   %esi
+  8030a4:	53                   	push   %ebx
+  8030a5:	83 ec 1c             	sub    $0x1c,%esp
+  8030a8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Fsreq_read_map saved;
+  struct Mmap *m;
+  uintptr_t va;
+  int perm, r;
+
+  va = ROUNDDOWN(utf->utf_fault_va, PGSIZE);
+  8030ab:	8b 1f                	mov    (%edi),%ebx
+  8030ad:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if (va < MMAPBASE || va >= MMAPTOP || (m = mmap_find(va)) == NULL)
+  8030b3:	8d 83 00 00 00 60    	lea    0x60000000(%ebx),%eax
+  8030b9:	3d ff ff ff 2f       	cmp    $0x2fffffff,%eax
+  8030be:	0f 87 24 01 00 00    	ja     8031e8 <mmap_fault+0x149>
+  8030c4:	89 d8                	mov    %ebx,%eax
+  8030c6:	e8 db fe ff ff       	call   802fa6 <mmap_find>
+  8030cb:	89 c6                	mov    %eax,%esi
+  8030cd:	85 c0                	test   %eax,%eax
+  8030cf:	0f 84 20 01 00 00    	je     8031f5 <mmap_fault+0x156>
+    return 0;
+  if ((utf->utf_err & FEC_WR) && m->mm_perm == MAP_RDONLY)
+  8030d5:	f6 47 04 02          	testb  $0x2,0x4(%edi)
+  8030d9:	74 13                	je     8030ee <mmap_fault+0x4f>
+  8030db:	83 78 10 00          	cmpl   $0x0,0x10(%eax)
+  8030df:	0f 84 17 01 00 00    	je     8031fc <mmap_fault+0x15d>
+    return 0;
+  perm = PTE_P | PTE_U | (m->mm_perm == MAP_RDONLY ? 0 : PTE_W);
+  8030e5:	c7 45 e4 07 00 00 00 	movl   $0x7,-0x1c(%ebp)
+  8030ec:	eb 0f                	jmp    8030fd <mmap_fault+0x5e>
+  8030ee:	83 78 10 01          	cmpl   $0x1,0x10(%eax)
+  8030f2:	19 c0                	sbb    %eax,%eax
+  8030f4:	83 e0 fe             	and    $0xfffffffe,%eax
+  8030f7:	83 c0 07             	add    $0x7,%eax
+  8030fa:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+
+  if (!va_mapped(va)) {
+  8030fd:	89 d8                	mov    %ebx,%eax
+  8030ff:	e8 e4 fe ff ff       	call   802fe8 <va_mapped>
+  803104:	84 c0                	test   %al,%al
+  803106:	74 42                	je     80314a <mmap_fault+0xab>
+    }
+  }
+
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+    mmap_copy(va, PGSIZE, perm);
+  return 1;
+  803108:	b8 01 00 00 00       	mov    $0x1,%eax
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+  80310d:	f6 47 04 02          	testb  $0x2,0x4(%edi)
+  803111:	0f 84 d6 00 00 00    	je     8031ed <mmap_fault+0x14e>
+  803117:	89 d8                	mov    %ebx,%eax
+  803119:	c1 e8 0c             	shr    $0xc,%eax
+  80311c:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  return 1;
+  803123:	b8 01 00 00 00       	mov    $0x1,%eax
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+  803128:	f6 c2 02             	test   $0x2,%dl
+  80312b:	0f 85 bc 00 00 00    	jne    8031ed <mmap_fault+0x14e>
+    mmap_copy(va, PGSIZE, perm);
+  803131:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803134:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803139:	89 d8                	mov    %ebx,%eax
+  80313b:	e8 d1 fe ff ff       	call   803011 <mmap_copy>
+  return 1;
+  803140:	b8 01 00 00 00       	mov    $0x1,%eax
+  803145:	e9 a3 00 00 00       	jmp    8031ed <mmap_fault+0x14e>
+    saved = fsipcbuf.read_map;
+  80314a:	a1 00 70 80 00       	mov    0x807000,%eax
+  80314f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803152:	8b 15 04 70 80 00    	mov    0x807004,%edx
+  803158:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    r = read_map(m->mm_fd, m->mm_offset + (va - m->mm_va), (void *) va);
+  80315b:	83 ec 04             	sub    $0x4,%esp
+  80315e:	53                   	push   %ebx
+  80315f:	89 d8                	mov    %ebx,%eax
+  803161:	03 46 0c             	add    0xc(%esi),%eax
+  803164:	2b 06                	sub    (%esi),%eax
+  803166:	50                   	push   %eax
+  803167:	ff 76 08             	push   0x8(%esi)
+  80316a:	e8 86 f3 ff ff       	call   8024f5 <read_map>
+    fsipcbuf.read_map = saved;
+  80316f:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  803172:	89 0d 00 70 80 00    	mov    %ecx,0x807000
+  803178:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  80317b:	89 15 04 70 80 00    	mov    %edx,0x807004
+    if (r < 0)
+  803181:	83 c4 10             	add    $0x10,%esp
+  803184:	85 c0                	test   %eax,%eax
+  803186:	78 20                	js     8031a8 <mmap_fault+0x109>
+    if (r == 0) {
+  803188:	74 30                	je     8031ba <mmap_fault+0x11b>
+    if (r < PGSIZE) {
+  80318a:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  80318f:	0f 8f 73 ff ff ff    	jg     803108 <mmap_fault+0x69>
+      mmap_copy(va, r, perm);
+  803195:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803198:	89 c2                	mov    %eax,%edx
+  80319a:	89 d8                	mov    %ebx,%eax
+  80319c:	e8 70 fe ff ff       	call   803011 <mmap_copy>
+      return 1;
+  8031a1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8031a6:	eb 45                	jmp    8031ed <mmap_fault+0x14e>
+      panic("mmap: read_map: %e", r);
+  8031a8:	50                   	push   %eax
+  8031a9:	68 7f 40 80 00       	push   $0x80407f
+  8031ae:	6a 5f                	push   $0x5f
+  8031b0:	68 74 40 80 00       	push   $0x804074
+  8031b5:	e8 74 05 00 00       	call   80372e <_panic>
+      if ((r = sys_page_alloc(0, (void *) va, perm)) < 0)
+  8031ba:	83 ec 04             	sub    $0x4,%esp
+  8031bd:	ff 75 e4             	push   -0x1c(%ebp)
+  8031c0:	53                   	push   %ebx
+  8031c1:	6a 00                	push   $0x0
+  8031c3:	e8 fb da ff ff       	call   800cc3 <sys_page_alloc>
+  8031c8:	83 c4 10             	add    $0x10,%esp
+  8031cb:	85 c0                	test   %eax,%eax
+  8031cd:	78 07                	js     8031d6 <mmap_fault+0x137>
+      return 1;
+  8031cf:	b8 01 00 00 00       	mov    $0x1,%eax
+  8031d4:	eb 17                	jmp    8031ed <mmap_fault+0x14e>
+        panic("mmap: %e", r);
+  8031d6:	50                   	push   %eax
+  8031d7:	68 6b 40 80 00       	push   $0x80406b
+  8031dc:	6a 64                	push   $0x64
+  8031de:	68 74 40 80 00       	push   $0x804074
+  8031e3:	e8 46 05 00 00       	call   80372e <_panic>
+    return 0;
+  8031e8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8031ed:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8031f0:	5b                   	pop    %ebx
+  8031f1:	5e                   	pop    %esi
+  8031f2:	5f                   	pop    %edi
+  8031f3:	5d                   	pop    %ebp
+  8031f4:	c3                   	ret
+    return 0;
+  8031f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031fa:	eb f1                	jmp    8031ed <mmap_fault+0x14e>
+    return 0;
+  8031fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  803201:	eb ea                	jmp    8031ed <mmap_fault+0x14e>
+
+00803203 <mmap_pgfault>:
+{
+  803203:	55                   	push   %ebp
+  803204:	89 e5                	mov    %esp,%ebp
+  803206:	53                   	push   %ebx
+  803207:	83 ec 10             	sub    $0x10,%esp
+  80320a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (!mmap_fault(utf))
+  80320d:	53                   	push   %ebx
+  80320e:	e8 8c fe ff ff       	call   80309f <mmap_fault>
+  803213:	83 c4 10             	add    $0x10,%esp
+  803216:	84 c0                	test   %al,%al
+  803218:	74 05                	je     80321f <mmap_pgfault+0x1c>
+}
+  80321a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80321d:	c9                   	leave
+  80321e:	c3                   	ret
+    panic("page fault at %08x, eip %08x, err %04x", utf->utf_fault_va,
+  80321f:	83 ec 08             	sub    $0x8,%esp
+  803222:	ff 73 04             	push   0x4(%ebx)
+  803225:	ff 73 28             	push   0x28(%ebx)
+  803228:	ff 33                	push   (%ebx)
+  80322a:	68 94 40 80 00       	push   $0x804094
+  80322f:	6a 20                	push   $0x20
+  803231:	68 74 40 80 00       	push   $0x804074
+  803236:	e8 f3 04 00 00       	call   80372e <_panic>
+
+0080323b <mmap>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_INVAL if offset isn't aligned, len is 0, or perm is unknown
+//	-E_NO_MEM if there's no free slot or address space for it
+int
+mmap(int fdnum, off_t offset, size_t len, int perm, void **addr)
+{
+  80323b:	55                   	push   %ebp
+  80323c:	89 e5                	mov    %esp,%ebp
+  80323e:	57                   	push   %edi
+  80323f:	56                   	push   %esi
+  803240:	53                   	push   %ebx
+  803241:	83 ec 44             	sub    $0x44,%esp
+  803244:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  struct Fd *fd;
+  uintptr_t va;
+  int i, j, r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803247:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80324a:	50                   	push   %eax
+  80324b:	ff 75 08             	push   0x8(%ebp)
+  80324e:	e8 30 e5 ff ff       	call   801783 <fd_lookup>
+  803253:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  803256:	83 c4 10             	add    $0x10,%esp
+  803259:	85 c0                	test   %eax,%eax
+  80325b:	0f 88 3e 01 00 00    	js     80339f <mmap+0x164>
+    return r;
+  if (offset < 0 || PGOFF(offset) || len == 0 ||
+  803261:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803265:	0f 88 d1 00 00 00    	js     80333c <mmap+0x101>
+  80326b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80326e:	25 ff 0f 00 00       	and    $0xfff,%eax
+  803273:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  803276:	0f 85 c9 00 00 00    	jne    803345 <mmap+0x10a>
+  80327c:	85 db                	test   %ebx,%ebx
+  80327e:	0f 84 ca 00 00 00    	je     80334e <mmap+0x113>
+  803284:	83 7d 14 02          	cmpl   $0x2,0x14(%ebp)
+  803288:	0f 87 c0 00 00 00    	ja     80334e <mmap+0x113>
+      (perm != MAP_RDONLY && perm != MAP_PRIVATE && perm != MAP_SHARED))
+    return -E_INVAL;
+  len = ROUNDUP(len, PGSIZE);
+  80328e:	81 c3 ff 0f 00 00    	add    $0xfff,%ebx
+  803294:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  80329a:	89 d9                	mov    %ebx,%ecx
+  80329c:	89 5d c4             	mov    %ebx,-0x3c(%ebp)
+
+  // First fit: try the start of the region and the end of each
+  // mapping.
+  for (i = -1; i < NMMAP; i++) {
+  80329f:	bb 4c 67 80 00       	mov    $0x80674c,%ebx
+  8032a4:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+    if (i >= 0 && !mmaps[i].mm_va)
+      continue;
+    va = i < 0 ? MMAPBASE : mmaps[i].mm_va + mmaps[i].mm_len;
+  8032a9:	bf 00 00 00 a0       	mov    $0xa0000000,%edi
+  8032ae:	eb 53                	jmp    803303 <mmap+0xc8>
+  8032b0:	bf 00 00 00 a0       	mov    $0xa0000000,%edi
+  8032b5:	eb 4c                	jmp    803303 <mmap+0xc8>
+    if (len > MMAPTOP - va)
+      continue;
+    for (j = 0; j < NMMAP; j++)
+  8032b7:	83 c0 01             	add    $0x1,%eax
+  8032ba:	83 f8 10             	cmp    $0x10,%eax
+  8032bd:	0f 84 e7 00 00 00    	je     8033aa <mmap+0x16f>
+      if (mmaps[j].mm_va && va < mmaps[j].mm_va + mmaps[j].mm_len &&
+  8032c3:	8d 34 80             	lea    (%eax,%eax,4),%esi
+  8032c6:	8b 14 b5 60 67 80 00 	mov    0x806760(,%esi,4),%edx
+  8032cd:	85 d2                	test   %edx,%edx
+  8032cf:	74 e6                	je     8032b7 <mmap+0x7c>
+  8032d1:	89 d1                	mov    %edx,%ecx
+  8032d3:	03 0c b5 64 67 80 00 	add    0x806764(,%esi,4),%ecx
+  8032da:	39 cf                	cmp    %ecx,%edi
+  8032dc:	73 d9                	jae    8032b7 <mmap+0x7c>
+  8032de:	39 da                	cmp    %ebx,%edx
+  8032e0:	73 d5                	jae    8032b7 <mmap+0x7c>
+  8032e2:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  8032e5:	8b 55 cc             	mov    -0x34(%ebp),%edx
+  8032e8:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  for (i = -1; i < NMMAP; i++) {
+  8032eb:	83 c2 01             	add    $0x1,%edx
+  8032ee:	83 c3 14             	add    $0x14,%ebx
+  8032f1:	83 fa 10             	cmp    $0x10,%edx
+  8032f4:	74 2b                	je     803321 <mmap+0xe6>
+    if (i >= 0 && !mmaps[i].mm_va)
+  8032f6:	85 d2                	test   %edx,%edx
+  8032f8:	78 b6                	js     8032b0 <mmap+0x75>
+  8032fa:	8b 3b                	mov    (%ebx),%edi
+  8032fc:	85 ff                	test   %edi,%edi
+  8032fe:	74 eb                	je     8032eb <mmap+0xb0>
+    va = i < 0 ? MMAPBASE : mmaps[i].mm_va + mmaps[i].mm_len;
+  803300:	03 7b 04             	add    0x4(%ebx),%edi
+    if (len > MMAPTOP - va)
+  803303:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  803308:	29 f8                	sub    %edi,%eax
+  80330a:	39 c8                	cmp    %ecx,%eax
+  80330c:	72 dd                	jb     8032eb <mmap+0xb0>
+    for (j = 0; j < NMMAP; j++)
+  80330e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+          mmaps[j].mm_va < va + len)
+  803311:	8d 34 0f             	lea    (%edi,%ecx,1),%esi
+  803314:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  803317:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  80331a:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+  80331d:	89 f3                	mov    %esi,%ebx
+  80331f:	eb a2                	jmp    8032c3 <mmap+0x88>
+        break;
+    if (j == NMMAP)
+      break;
+  }
+  if (i == NMMAP)
+    return -E_NO_MEM;
+  803321:	c7 45 d4 fc ff ff ff 	movl   $0xfffffffc,-0x2c(%ebp)
+  803328:	eb 75                	jmp    80339f <mmap+0x164>
+    ;
+  if (j == NMMAP)
+    return -E_NO_MEM;
+
+  if (_pgfault_handler == 0)
+    set_pgfault_handler(mmap_pgfault);
+  80332a:	83 ec 0c             	sub    $0xc,%esp
+  80332d:	68 03 32 80 00       	push   $0x803203
+  803332:	e8 3d 04 00 00       	call   803774 <set_pgfault_handler>
+  803337:	83 c4 10             	add    $0x10,%esp
+  80333a:	eb 24                	jmp    803360 <mmap+0x125>
+    return -E_INVAL;
+  80333c:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  803343:	eb 5a                	jmp    80339f <mmap+0x164>
+  803345:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  80334c:	eb 51                	jmp    80339f <mmap+0x164>
+  80334e:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  803355:	eb 48                	jmp    80339f <mmap+0x164>
+  if (_pgfault_handler == 0)
+  803357:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  80335e:	74 ca                	je     80332a <mmap+0xef>
+
+  mmaps[j].mm_va = va;
+  803360:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803367:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  80336a:	c1 e2 02             	shl    $0x2,%edx
+  80336d:	89 ba 60 67 80 00    	mov    %edi,0x806760(%edx)
+  mmaps[j].mm_len = len;
+  803373:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  803376:	89 b2 64 67 80 00    	mov    %esi,0x806764(%edx)
+  mmaps[j].mm_fd = fdnum;
+  80337c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80337f:	89 b2 68 67 80 00    	mov    %esi,0x806768(%edx)
+  mmaps[j].mm_offset = offset;
+  803385:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803388:	89 b2 6c 67 80 00    	mov    %esi,0x80676c(%edx)
+  mmaps[j].mm_perm = perm;
+  80338e:	01 d8                	add    %ebx,%eax
+  803390:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  803393:	89 1c 85 70 67 80 00 	mov    %ebx,0x806770(,%eax,4)
+  *addr = (void *) va;
+  80339a:	8b 45 18             	mov    0x18(%ebp),%eax
+  80339d:	89 38                	mov    %edi,(%eax)
+  return 0;
+}
+  80339f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8033a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033a5:	5b                   	pop    %ebx
+  8033a6:	5e                   	pop    %esi
+  8033a7:	5f                   	pop    %edi
+  8033a8:	5d                   	pop    %ebp
+  8033a9:	c3                   	ret
+  if (i == NMMAP)
+  8033aa:	b8 60 67 80 00       	mov    $0x806760,%eax
+  for (j = 0; j < NMMAP && mmaps[j].mm_va; j++)
+  8033af:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+  8033b2:	83 c0 14             	add    $0x14,%eax
+  8033b5:	83 78 ec 00          	cmpl   $0x0,-0x14(%eax)
+  8033b9:	74 9c                	je     803357 <mmap+0x11c>
+  8033bb:	83 c3 01             	add    $0x1,%ebx
+  8033be:	83 fb 10             	cmp    $0x10,%ebx
+  8033c1:	75 ef                	jne    8033b2 <mmap+0x177>
+    return -E_NO_MEM;
+  8033c3:	c7 45 d4 fc ff ff ff 	movl   $0xfffffffc,-0x2c(%ebp)
+  8033ca:	eb d3                	jmp    80339f <mmap+0x164>
+
+008033cc <msync>:
+// nothing for other kinds of mapping.
+//
+// Returns 0 on success, < 0 on error.
+int
+msync(void *addr)
+{
+  8033cc:	55                   	push   %ebp
+  8033cd:	89 e5                	mov    %esp,%ebp
+  8033cf:	57                   	push   %edi
+  8033d0:	56                   	push   %esi
+  8033d1:	53                   	push   %ebx
+  8033d2:	81 ec ac 00 00 00    	sub    $0xac,%esp
+  struct Stat st;
+  off_t saved, off;
+  uintptr_t va;
+  int n, r;
+
+  if ((m = mmap_find((uintptr_t) addr)) == NULL)
+  8033d8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8033db:	e8 c6 fb ff ff       	call   802fa6 <mmap_find>
+  8033e0:	85 c0                	test   %eax,%eax
+  8033e2:	0f 84 58 01 00 00    	je     803540 <msync+0x174>
+  8033e8:	89 c7                	mov    %eax,%edi
+    return -E_INVAL;
+  if (m->mm_perm != MAP_SHARED)
+    return 0;
+  8033ea:	bb 00 00 00 00       	mov    $0x0,%ebx
+  if (m->mm_perm != MAP_SHARED)
+  8033ef:	83 78 10 02          	cmpl   $0x2,0x10(%eax)
+  8033f3:	74 0a                	je     8033ff <msync+0x33>
+                          PTE_P | PTE_U | PTE_W)) < 0)
+      break;
+  }
+  fd->fd_offset = saved;
+  return r < 0 ? r : 0;
+}
+  8033f5:	89 d8                	mov    %ebx,%eax
+  8033f7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033fa:	5b                   	pop    %ebx
+  8033fb:	5e                   	pop    %esi
+  8033fc:	5f                   	pop    %edi
+  8033fd:	5d                   	pop    %ebp
+  8033fe:	c3                   	ret
+  if ((r = fd_lookup(m->mm_fd, &fd)) < 0 || (r = fstat(m->mm_fd, &st)) < 0)
+  8033ff:	83 ec 08             	sub    $0x8,%esp
+  803402:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  803405:	50                   	push   %eax
+  803406:	ff 77 08             	push   0x8(%edi)
+  803409:	e8 75 e3 ff ff       	call   801783 <fd_lookup>
+  80340e:	89 c3                	mov    %eax,%ebx
+  803410:	83 c4 10             	add    $0x10,%esp
+  803413:	85 c0                	test   %eax,%eax
+  803415:	78 de                	js     8033f5 <msync+0x29>
+  803417:	83 ec 08             	sub    $0x8,%esp
+  80341a:	8d 85 58 ff ff ff    	lea    -0xa8(%ebp),%eax
+  803420:	50                   	push   %eax
+  803421:	ff 77 08             	push   0x8(%edi)
+  803424:	e8 fd e7 ff ff       	call   801c26 <fstat>
+  803429:	89 c3                	mov    %eax,%ebx
+  80342b:	83 c4 10             	add    $0x10,%esp
+  80342e:	85 c0                	test   %eax,%eax
+  803430:	78 c3                	js     8033f5 <msync+0x29>
+  saved = fd->fd_offset;
+  803432:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803435:	8b 40 04             	mov    0x4(%eax),%eax
+  803438:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%ebp)
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE) {
+  80343e:	8b 37                	mov    (%edi),%esi
+  803440:	eb 29                	jmp    80346b <msync+0x9f>
+    if ((r = sys_page_map(0, (void *) va, 0, (void *) va,
+  803442:	83 ec 0c             	sub    $0xc,%esp
+  803445:	6a 07                	push   $0x7
+  803447:	8b 85 50 ff ff ff    	mov    -0xb0(%ebp),%eax
+  80344d:	50                   	push   %eax
+  80344e:	6a 00                	push   $0x0
+  803450:	50                   	push   %eax
+  803451:	6a 00                	push   $0x0
+  803453:	e8 ae d8 ff ff       	call   800d06 <sys_page_map>
+  803458:	89 c3                	mov    %eax,%ebx
+  80345a:	83 c4 20             	add    $0x20,%esp
+  80345d:	85 c0                	test   %eax,%eax
+  80345f:	0f 88 c0 00 00 00    	js     803525 <msync+0x159>
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE) {
+  803465:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80346b:	8b 07                	mov    (%edi),%eax
+  80346d:	89 85 54 ff ff ff    	mov    %eax,-0xac(%ebp)
+  803473:	03 47 04             	add    0x4(%edi),%eax
+  803476:	39 c6                	cmp    %eax,%esi
+  803478:	0f 83 a7 00 00 00    	jae    803525 <msync+0x159>
+    if (!va_mapped(va) || !(uvpt[PGNUM(va)] & PTE_D))
+  80347e:	89 f0                	mov    %esi,%eax
+  803480:	e8 63 fb ff ff       	call   802fe8 <va_mapped>
+  803485:	84 c0                	test   %al,%al
+  803487:	74 dc                	je     803465 <msync+0x99>
+  803489:	89 f0                	mov    %esi,%eax
+  80348b:	c1 e8 0c             	shr    $0xc,%eax
+  80348e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803495:	a8 40                	test   $0x40,%al
+  803497:	74 cc                	je     803465 <msync+0x99>
+    off = m->mm_offset + (va - m->mm_va);
+  803499:	8b 47 0c             	mov    0xc(%edi),%eax
+  80349c:	8b 8d 54 ff ff ff    	mov    -0xac(%ebp),%ecx
+  8034a2:	29 c8                	sub    %ecx,%eax
+  8034a4:	01 f0                	add    %esi,%eax
+    if (off >= st.st_size)
+  8034a6:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8034a9:	39 c2                	cmp    %eax,%edx
+  8034ab:	7e 78                	jle    803525 <msync+0x159>
+    n = MIN(PGSIZE, st.st_size - off);
+  8034ad:	29 c2                	sub    %eax,%edx
+  8034af:	89 d1                	mov    %edx,%ecx
+  8034b1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8034b6:	39 d1                	cmp    %edx,%ecx
+  8034b8:	0f 4e d1             	cmovle %ecx,%edx
+  8034bb:	89 95 54 ff ff ff    	mov    %edx,-0xac(%ebp)
+    if ((r = seek(m->mm_fd, off)) < 0 ||
+  8034c1:	83 ec 08             	sub    $0x8,%esp
+  8034c4:	50                   	push   %eax
+  8034c5:	ff 77 08             	push   0x8(%edi)
+  8034c8:	e8 b1 e6 ff ff       	call   801b7e <seek>
+  8034cd:	89 c3                	mov    %eax,%ebx
+  8034cf:	83 c4 10             	add    $0x10,%esp
+  8034d2:	85 c0                	test   %eax,%eax
+  8034d4:	78 4f                	js     803525 <msync+0x159>
+        (r = write(m->mm_fd, (void *) va, n)) < 0)
+  8034d6:	89 b5 50 ff ff ff    	mov    %esi,-0xb0(%ebp)
+  8034dc:	83 ec 04             	sub    $0x4,%esp
+  8034df:	ff b5 54 ff ff ff    	push   -0xac(%ebp)
+  8034e5:	56                   	push   %esi
+  8034e6:	ff 77 08             	push   0x8(%edi)
+  8034e9:	e8 0e e6 ff ff       	call   801afc <write>
+  8034ee:	89 c3                	mov    %eax,%ebx
+    if ((r = seek(m->mm_fd, off)) < 0 ||
+  8034f0:	83 c4 10             	add    $0x10,%esp
+  8034f3:	85 c0                	test   %eax,%eax
+  8034f5:	78 2e                	js     803525 <msync+0x159>
+    if (r < n && (r = write(m->mm_fd, (char *) va + r, n - r)) < 0)
+  8034f7:	8b 95 54 ff ff ff    	mov    -0xac(%ebp),%edx
+  8034fd:	39 c2                	cmp    %eax,%edx
+  8034ff:	0f 8e 3d ff ff ff    	jle    803442 <msync+0x76>
+  803505:	89 d0                	mov    %edx,%eax
+  803507:	29 d8                	sub    %ebx,%eax
+  803509:	01 f3                	add    %esi,%ebx
+  80350b:	83 ec 04             	sub    $0x4,%esp
+  80350e:	50                   	push   %eax
+  80350f:	53                   	push   %ebx
+  803510:	ff 77 08             	push   0x8(%edi)
+  803513:	e8 e4 e5 ff ff       	call   801afc <write>
+  803518:	89 c3                	mov    %eax,%ebx
+  80351a:	83 c4 10             	add    $0x10,%esp
+  80351d:	85 c0                	test   %eax,%eax
+  80351f:	0f 89 1d ff ff ff    	jns    803442 <msync+0x76>
+  fd->fd_offset = saved;
+  803525:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803528:	8b 8d 4c ff ff ff    	mov    -0xb4(%ebp),%ecx
+  80352e:	89 48 04             	mov    %ecx,0x4(%eax)
+  return r < 0 ? r : 0;
+  803531:	85 db                	test   %ebx,%ebx
+  803533:	b8 00 00 00 00       	mov    $0x0,%eax
+  803538:	0f 4f d8             	cmovg  %eax,%ebx
+  80353b:	e9 b5 fe ff ff       	jmp    8033f5 <msync+0x29>
+    return -E_INVAL;
+  803540:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  803545:	e9 ab fe ff ff       	jmp    8033f5 <msync+0x29>
+
+0080354a <munmap>:
+// Remove the mapping at 'addr', writing a MAP_SHARED one back first.
+//
+// Returns 0 on success, < 0 on error.
+int
+munmap(void *addr)
+{
+  80354a:	55                   	push   %ebp
+  80354b:	89 e5                	mov    %esp,%ebp
+  80354d:	56                   	push   %esi
+  80354e:	53                   	push   %ebx
+  80354f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct Mmap *m;
+  uintptr_t va;
+  int r;
+
+  if ((m = mmap_find((uintptr_t) addr)) == NULL)
+  803552:	89 d8                	mov    %ebx,%eax
+  803554:	e8 4d fa ff ff       	call   802fa6 <mmap_find>
+  803559:	85 c0                	test   %eax,%eax
+  80355b:	74 56                	je     8035b3 <munmap+0x69>
+  80355d:	89 c6                	mov    %eax,%esi
+    return -E_INVAL;
+  if ((r = msync(addr)) < 0)
+  80355f:	83 ec 0c             	sub    $0xc,%esp
+  803562:	53                   	push   %ebx
+  803563:	e8 64 fe ff ff       	call   8033cc <msync>
+  803568:	83 c4 10             	add    $0x10,%esp
+  80356b:	85 c0                	test   %eax,%eax
+  80356d:	78 3d                	js     8035ac <munmap+0x62>
+    return r;
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE)
+  80356f:	8b 1e                	mov    (%esi),%ebx
+  803571:	eb 06                	jmp    803579 <munmap+0x2f>
+  803573:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803579:	8b 46 04             	mov    0x4(%esi),%eax
+  80357c:	03 06                	add    (%esi),%eax
+  80357e:	39 c3                	cmp    %eax,%ebx
+  803580:	73 1f                	jae    8035a1 <munmap+0x57>
+    if (va_mapped(va) && (r = sys_page_unmap(0, (void *) va)) < 0)
+  803582:	89 d8                	mov    %ebx,%eax
+  803584:	e8 5f fa ff ff       	call   802fe8 <va_mapped>
+  803589:	84 c0                	test   %al,%al
+  80358b:	74 e6                	je     803573 <munmap+0x29>
+  80358d:	83 ec 08             	sub    $0x8,%esp
+  803590:	53                   	push   %ebx
+  803591:	6a 00                	push   $0x0
+  803593:	e8 b0 d7 ff ff       	call   800d48 <sys_page_unmap>
+  803598:	83 c4 10             	add    $0x10,%esp
+  80359b:	85 c0                	test   %eax,%eax
+  80359d:	79 d4                	jns    803573 <munmap+0x29>
+  80359f:	eb 0b                	jmp    8035ac <munmap+0x62>
+      return r;
+  m->mm_va = 0;
+  8035a1:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  return 0;
+  8035a7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8035ac:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8035af:	5b                   	pop    %ebx
+  8035b0:	5e                   	pop    %esi
+  8035b1:	5d                   	pop    %ebp
+  8035b2:	c3                   	ret
+    return -E_INVAL;
+  8035b3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8035b8:	eb f2                	jmp    8035ac <munmap+0x62>
+
+008035ba <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  8035ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035bf:	c3                   	ret
+
+008035c0 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8035c0:	55                   	push   %ebp
+  8035c1:	89 e5                	mov    %esp,%ebp
+  8035c3:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  8035c6:	68 bb 40 80 00       	push   $0x8040bb
+  8035cb:	ff 75 0c             	push   0xc(%ebp)
+  8035ce:	e8 c1 d2 ff ff       	call   800894 <strcpy>
+  return 0;
+}
+  8035d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035d8:	c9                   	leave
+  8035d9:	c3                   	ret
+
+008035da <devcons_write>:
+{
+  8035da:	55                   	push   %ebp
+  8035db:	89 e5                	mov    %esp,%ebp
+  8035dd:	57                   	push   %edi
+  8035de:	56                   	push   %esi
+  8035df:	53                   	push   %ebx
+  8035e0:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  8035e6:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  8035eb:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  8035f1:	eb 2e                	jmp    803621 <devcons_write+0x47>
+    m = n - tot;
+  8035f3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8035f6:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  8035f8:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8035fd:	39 c3                	cmp    %eax,%ebx
+  8035ff:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  803602:	83 ec 04             	sub    $0x4,%esp
+  803605:	53                   	push   %ebx
+  803606:	89 f0                	mov    %esi,%eax
+  803608:	03 45 0c             	add    0xc(%ebp),%eax
+  80360b:	50                   	push   %eax
+  80360c:	57                   	push   %edi
+  80360d:	e8 08 d4 ff ff       	call   800a1a <memmove>
+    sys_cputs(buf, m);
+  803612:	83 c4 08             	add    $0x8,%esp
+  803615:	53                   	push   %ebx
+  803616:	57                   	push   %edi
+  803617:	e8 a8 d5 ff ff       	call   800bc4 <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  80361c:	01 de                	add    %ebx,%esi
+  80361e:	83 c4 10             	add    $0x10,%esp
+  803621:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803624:	72 cd                	jb     8035f3 <devcons_write+0x19>
+}
+  803626:	89 f0                	mov    %esi,%eax
+  803628:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80362b:	5b                   	pop    %ebx
+  80362c:	5e                   	pop    %esi
+  80362d:	5f                   	pop    %edi
+  80362e:	5d                   	pop    %ebp
+  80362f:	c3                   	ret
+
+00803630 <devcons_read>:
+{
+  803630:	55                   	push   %ebp
+  803631:	89 e5                	mov    %esp,%ebp
+  803633:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  803636:	b8 00 00 00 00       	mov    $0x0,%eax
+  80363b:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80363f:	75 07                	jne    803648 <devcons_read+0x18>
+  803641:	eb 1f                	jmp    803662 <devcons_read+0x32>
+    sys_yield();
+  803643:	e8 19 d6 ff ff       	call   800c61 <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  803648:	e8 95 d5 ff ff       	call   800be2 <sys_cgetc>
+  80364d:	85 c0                	test   %eax,%eax
+  80364f:	74 f2                	je     803643 <devcons_read+0x13>
+  if (c < 0)
+  803651:	78 0f                	js     803662 <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  803653:	83 f8 04             	cmp    $0x4,%eax
+  803656:	74 0c                	je     803664 <devcons_read+0x34>
+  *(char*)vbuf = c;
+  803658:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80365b:	88 02                	mov    %al,(%edx)
+  return 1;
+  80365d:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803662:	c9                   	leave
+  803663:	c3                   	ret
+    return 0;
+  803664:	b8 00 00 00 00       	mov    $0x0,%eax
+  803669:	eb f7                	jmp    803662 <devcons_read+0x32>
+
+0080366b <cputchar>:
+{
+  80366b:	55                   	push   %ebp
+  80366c:	89 e5                	mov    %esp,%ebp
+  80366e:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  803671:	8b 45 08             	mov    0x8(%ebp),%eax
+  803674:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  803677:	6a 01                	push   $0x1
+  803679:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80367c:	50                   	push   %eax
+  80367d:	e8 42 d5 ff ff       	call   800bc4 <sys_cputs>
+}
+  803682:	83 c4 10             	add    $0x10,%esp
+  803685:	c9                   	leave
+  803686:	c3                   	ret
+
+00803687 <getchar>:
+{
+  803687:	55                   	push   %ebp
+  803688:	89 e5                	mov    %esp,%ebp
+  80368a:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  80368d:	6a 01                	push   $0x1
+  80368f:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803692:	50                   	push   %eax
+  803693:	6a 00                	push   $0x0
+  803695:	e8 94 e3 ff ff       	call   801a2e <read>
+  if (r < 0)
+  80369a:	83 c4 10             	add    $0x10,%esp
+  80369d:	85 c0                	test   %eax,%eax
+  80369f:	78 06                	js     8036a7 <getchar+0x20>
+  if (r < 1)
+  8036a1:	74 06                	je     8036a9 <getchar+0x22>
+  return c;
+  8036a3:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8036a7:	c9                   	leave
+  8036a8:	c3                   	ret
+    return -E_EOF;
+  8036a9:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8036ae:	eb f7                	jmp    8036a7 <getchar+0x20>
+
+008036b0 <iscons>:
+{
+  8036b0:	55                   	push   %ebp
+  8036b1:	89 e5                	mov    %esp,%ebp
+  8036b3:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8036b6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8036b9:	50                   	push   %eax
+  8036ba:	ff 75 08             	push   0x8(%ebp)
+  8036bd:	e8 c1 e0 ff ff       	call   801783 <fd_lookup>
+  8036c2:	83 c4 10             	add    $0x10,%esp
+  8036c5:	85 c0                	test   %eax,%eax
+  8036c7:	78 11                	js     8036da <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  8036c9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8036cc:	8b 15 44 50 80 00    	mov    0x805044,%edx
+  8036d2:	39 10                	cmp    %edx,(%eax)
+  8036d4:	0f 94 c0             	sete   %al
+  8036d7:	0f b6 c0             	movzbl %al,%eax
+}
+  8036da:	c9                   	leave
+  8036db:	c3                   	ret
+
+008036dc <opencons>:
+{
+  8036dc:	55                   	push   %ebp
+  8036dd:	89 e5                	mov    %esp,%ebp
+  8036df:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  8036e2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8036e5:	50                   	push   %eax
+  8036e6:	e8 42 e0 ff ff       	call   80172d <fd_alloc>
+  8036eb:	83 c4 10             	add    $0x10,%esp
+  8036ee:	85 c0                	test   %eax,%eax
+  8036f0:	78 3a                	js     80372c <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8036f2:	83 ec 04             	sub    $0x4,%esp
+  8036f5:	68 07 04 00 00       	push   $0x407
+  8036fa:	ff 75 f4             	push   -0xc(%ebp)
+  8036fd:	6a 00                	push   $0x0
+  8036ff:	e8 bf d5 ff ff       	call   800cc3 <sys_page_alloc>
+  803704:	83 c4 10             	add    $0x10,%esp
+  803707:	85 c0                	test   %eax,%eax
+  803709:	78 21                	js     80372c <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  80370b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80370e:	8b 15 44 50 80 00    	mov    0x805044,%edx
+  803714:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  803716:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803719:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  803720:	83 ec 0c             	sub    $0xc,%esp
+  803723:	50                   	push   %eax
+  803724:	e8 e0 df ff ff       	call   801709 <fd2num>
+  803729:	83 c4 10             	add    $0x10,%esp
+}
+  80372c:	c9                   	leave
+  80372d:	c3                   	ret
+
+0080372e <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80372e:	55                   	push   %ebp
+  80372f:	89 e5                	mov    %esp,%ebp
+  803731:	56                   	push   %esi
+  803732:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  803733:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  803736:	8b 35 08 50 80 00    	mov    0x805008,%esi
+  80373c:	e8 01 d5 ff ff       	call   800c42 <sys_getenvid>
+  803741:	83 ec 0c             	sub    $0xc,%esp
+  803744:	ff 75 0c             	push   0xc(%ebp)
+  803747:	ff 75 08             	push   0x8(%ebp)
+  80374a:	56                   	push   %esi
+  80374b:	50                   	push   %eax
+  80374c:	68 c8 40 80 00       	push   $0x8040c8
+  803751:	e8 50 cb ff ff       	call   8002a6 <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  803756:	83 c4 18             	add    $0x18,%esp
+  803759:	53                   	push   %ebx
+  80375a:	ff 75 10             	push   0x10(%ebp)
+  80375d:	e8 f3 ca ff ff       	call   800255 <vcprintf>
+  cprintf("\n");
+  803762:	c7 04 24 64 40 80 00 	movl   $0x804064,(%esp)
+  803769:	e8 38 cb ff ff       	call   8002a6 <cprintf>
+  80376e:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  803771:	cc                   	int3
+  while (1)
+  803772:	eb fd                	jmp    803771 <_panic+0x43>
+
+00803774 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  803774:	55                   	push   %ebp
+  803775:	89 e5                	mov    %esp,%ebp
+  803777:	53                   	push   %ebx
+  803778:	83 ec 04             	sub    $0x4,%esp
+  int r;
+
+  if (_pgfault_handler == 0) {
+  80377b:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  803782:	74 0d                	je     803791 <set_pgfault_handler+0x1d>
+
+    sys_env_set_pgfault_upcall(id, _pgfault_upcall);
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  803784:	8b 45 08             	mov    0x8(%ebp),%eax
+  803787:	a3 00 80 80 00       	mov    %eax,0x808000
+}
+  80378c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80378f:	c9                   	leave
+  803790:	c3                   	ret
+    envid_t id = sys_getenvid();
+  803791:	e8 ac d4 ff ff       	call   800c42 <sys_getenvid>
+  803796:	89 c3                	mov    %eax,%ebx
+    sys_page_alloc(id, (void *) (UXSTACKTOP - PGSIZE), (PTE_P | PTE_U | PTE_W));
+  803798:	83 ec 04             	sub    $0x4,%esp
+  80379b:	6a 07                	push   $0x7
+  80379d:	68 00 f0 bf ee       	push   $0xeebff000
+  8037a2:	50                   	push   %eax
+  8037a3:	e8 1b d5 ff ff       	call   800cc3 <sys_page_alloc>
+    sys_env_set_pgfault_upcall(id, _pgfault_upcall);
+  8037a8:	83 c4 08             	add    $0x8,%esp
+  8037ab:	68 bb 37 80 00       	push   $0x8037bb
+  8037b0:	53                   	push   %ebx
+  8037b1:	e8 82 d7 ff ff       	call   800f38 <sys_env_set_pgfault_upcall>
+  8037b6:	83 c4 10             	add    $0x10,%esp
+  8037b9:	eb c9                	jmp    803784 <set_pgfault_handler+0x10>
+
+008037bb <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8037bb:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8037bc:	a1 00 80 80 00       	mov    0x808000,%eax
+	call *%eax
+  8037c1:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8037c3:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+  movl 48(%esp), %eax       // move trap time esp to eax
+  8037c6:	8b 44 24 30          	mov    0x30(%esp),%eax
+  subl $4, %eax             // make room for eip on trap time esp
+  8037ca:	83 e8 04             	sub    $0x4,%eax
+  movl %eax, 48(%esp)       // move value to esp
+  8037cd:	89 44 24 30          	mov    %eax,0x30(%esp)
+  movl 40(%esp), %ebx       // move trap time eip to ebx
+  8037d1:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+  movl %ebx, 0(%eax)
+  8037d5:	89 18                	mov    %ebx,(%eax)
+
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+  addl $0x08,%esp
+  8037d7:	83 c4 08             	add    $0x8,%esp
+  popal
+  8037da:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+  addl $4, %esp          // skip tf->eip
+  8037db:	83 c4 04             	add    $0x4,%esp
+  popf                 // pop stack value into flags register
+  8037de:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+  popl %esp
+  8037df:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+  ret
+  8037e0:	c3                   	ret
+
+008037e1 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8037e1:	55                   	push   %ebp
+  8037e2:	89 e5                	mov    %esp,%ebp
+  8037e4:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  8037e7:	89 c2                	mov    %eax,%edx
+  8037e9:	c1 ea 16             	shr    $0x16,%edx
+  8037ec:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  8037f3:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  8037f8:	f6 c1 01             	test   $0x1,%cl
+  8037fb:	74 1c                	je     803819 <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  8037fd:	c1 e8 0c             	shr    $0xc,%eax
+  803800:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  803807:	a8 01                	test   $0x1,%al
+  803809:	74 0e                	je     803819 <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  80380b:	c1 e8 0c             	shr    $0xc,%eax
+  80380e:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  803815:	ef 
+  803816:	0f b7 d2             	movzwl %dx,%edx
+}
+  803819:	89 d0                	mov    %edx,%eax
+  80381b:	5d                   	pop    %ebp
+  80381c:	c3                   	ret
+
+0080381d <udivmod>:
+  80381d:	55                   	push   %ebp
+  80381e:	57                   	push   %edi
+  80381f:	56                   	push   %esi
+  803820:	53                   	push   %ebx
+  803821:	83 ec 14             	sub    $0x14,%esp
+  803824:	8b 74 24 28          	mov    0x28(%esp),%esi
+  803828:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  80382c:	89 fb                	mov    %edi,%ebx
+  80382e:	09 f3                	or     %esi,%ebx
+  803830:	0f 84 88 00 00 00    	je     8038be <udivmod+0xa1>
+  803836:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80383b:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  803842:	00 
+  803843:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80384a:	00 
+  80384b:	89 cd                	mov    %ecx,%ebp
+  80384d:	89 34 24             	mov    %esi,(%esp)
+  803850:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  803854:	eb 08                	jmp    80385e <udivmod+0x41>
+  803856:	83 ed 01             	sub    $0x1,%ebp
+  803859:	83 fd ff             	cmp    $0xffffffff,%ebp
+  80385c:	74 6c                	je     8038ca <udivmod+0xad>
+  80385e:	89 c3                	mov    %eax,%ebx
+  803860:	89 d6                	mov    %edx,%esi
+  803862:	89 e9                	mov    %ebp,%ecx
+  803864:	0f ad f3             	shrd   %cl,%esi,%ebx
+  803867:	d3 ee                	shr    %cl,%esi
+  803869:	f6 c1 20             	test   $0x20,%cl
+  80386c:	74 04                	je     803872 <udivmod+0x55>
+  80386e:	89 f3                	mov    %esi,%ebx
+  803870:	31 f6                	xor    %esi,%esi
+  803872:	8b 3c 24             	mov    (%esp),%edi
+  803875:	39 fb                	cmp    %edi,%ebx
+  803877:	89 f7                	mov    %esi,%edi
+  803879:	8b 1c 24             	mov    (%esp),%ebx
+  80387c:	8b 74 24 04          	mov    0x4(%esp),%esi
+  803880:	19 f7                	sbb    %esi,%edi
+  803882:	72 d2                	jb     803856 <udivmod+0x39>
+  803884:	89 f7                	mov    %esi,%edi
+  803886:	89 de                	mov    %ebx,%esi
+  803888:	89 e9                	mov    %ebp,%ecx
+  80388a:	0f a5 f7             	shld   %cl,%esi,%edi
+  80388d:	d3 e6                	shl    %cl,%esi
+  80388f:	f6 c1 20             	test   $0x20,%cl
+  803892:	74 04                	je     803898 <udivmod+0x7b>
+  803894:	89 f7                	mov    %esi,%edi
+  803896:	31 f6                	xor    %esi,%esi
+  803898:	29 f0                	sub    %esi,%eax
+  80389a:	19 fa                	sbb    %edi,%edx
+  80389c:	be 01 00 00 00       	mov    $0x1,%esi
+  8038a1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038a6:	0f a5 f7             	shld   %cl,%esi,%edi
+  8038a9:	d3 e6                	shl    %cl,%esi
+  8038ab:	f6 c1 20             	test   $0x20,%cl
+  8038ae:	74 04                	je     8038b4 <udivmod+0x97>
+  8038b0:	89 f7                	mov    %esi,%edi
+  8038b2:	31 f6                	xor    %esi,%esi
+  8038b4:	09 74 24 08          	or     %esi,0x8(%esp)
+  8038b8:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8038bc:	eb 98                	jmp    803856 <udivmod+0x39>
+  8038be:	89 f0                	mov    %esi,%eax
+  8038c0:	89 fa                	mov    %edi,%edx
+  8038c2:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8038c6:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  8038ca:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  8038ce:	89 01                	mov    %eax,(%ecx)
+  8038d0:	89 51 04             	mov    %edx,0x4(%ecx)
+  8038d3:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8038d7:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8038db:	83 c4 14             	add    $0x14,%esp
+  8038de:	5b                   	pop    %ebx
+  8038df:	5e                   	pop    %esi
+  8038e0:	5f                   	pop    %edi
+  8038e1:	5d                   	pop    %ebp
+  8038e2:	c3                   	ret
+
+008038e3 <__udivdi3>:
+  8038e3:	83 ec 18             	sub    $0x18,%esp
+  8038e6:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8038ea:	50                   	push   %eax
+  8038eb:	ff 74 24 2c          	push   0x2c(%esp)
+  8038ef:	ff 74 24 2c          	push   0x2c(%esp)
+  8038f3:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8038f7:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8038fb:	e8 1d ff ff ff       	call   80381d <udivmod>
+  803900:	83 c4 24             	add    $0x24,%esp
+  803903:	c3                   	ret
+
+00803904 <__umoddi3>:
+  803904:	83 ec 18             	sub    $0x18,%esp
+  803907:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80390b:	50                   	push   %eax
+  80390c:	ff 74 24 2c          	push   0x2c(%esp)
+  803910:	ff 74 24 2c          	push   0x2c(%esp)
+  803914:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803918:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80391c:	e8 fc fe ff ff       	call   80381d <udivmod>
+  803921:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803925:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803929:	83 c4 24             	add    $0x24,%esp
+  80392c:	c3                   	ret
+
+0080392d <__divdi3>:
+  80392d:	56                   	push   %esi
+  80392e:	53                   	push   %ebx
+  80392f:	83 ec 14             	sub    $0x14,%esp
+  803932:	8b 44 24 20          	mov    0x20(%esp),%eax
+  803936:	8b 54 24 24          	mov    0x24(%esp),%edx
+  80393a:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  80393e:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  803942:	85 d2                	test   %edx,%edx
+  803944:	78 18                	js     80395e <__divdi3+0x31>
+  803946:	85 db                	test   %ebx,%ebx
+  803948:	78 3e                	js     803988 <__divdi3+0x5b>
+  80394a:	83 ec 04             	sub    $0x4,%esp
+  80394d:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803951:	56                   	push   %esi
+  803952:	53                   	push   %ebx
+  803953:	51                   	push   %ecx
+  803954:	e8 c4 fe ff ff       	call   80381d <udivmod>
+  803959:	83 c4 10             	add    $0x10,%esp
+  80395c:	eb 24                	jmp    803982 <__divdi3+0x55>
+  80395e:	f7 d8                	neg    %eax
+  803960:	83 d2 00             	adc    $0x0,%edx
+  803963:	f7 da                	neg    %edx
+  803965:	85 db                	test   %ebx,%ebx
+  803967:	78 3a                	js     8039a3 <__divdi3+0x76>
+  803969:	83 ec 04             	sub    $0x4,%esp
+  80396c:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803970:	56                   	push   %esi
+  803971:	53                   	push   %ebx
+  803972:	51                   	push   %ecx
+  803973:	e8 a5 fe ff ff       	call   80381d <udivmod>
+  803978:	83 c4 10             	add    $0x10,%esp
+  80397b:	f7 d8                	neg    %eax
+  80397d:	83 d2 00             	adc    $0x0,%edx
+  803980:	f7 da                	neg    %edx
+  803982:	83 c4 14             	add    $0x14,%esp
+  803985:	5b                   	pop    %ebx
+  803986:	5e                   	pop    %esi
+  803987:	c3                   	ret
+  803988:	83 ec 04             	sub    $0x4,%esp
+  80398b:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80398f:	56                   	push   %esi
+  803990:	f7 d9                	neg    %ecx
+  803992:	83 d3 00             	adc    $0x0,%ebx
+  803995:	f7 db                	neg    %ebx
+  803997:	53                   	push   %ebx
+  803998:	51                   	push   %ecx
+  803999:	e8 7f fe ff ff       	call   80381d <udivmod>
+  80399e:	83 c4 10             	add    $0x10,%esp
+  8039a1:	eb d8                	jmp    80397b <__divdi3+0x4e>
+  8039a3:	83 ec 04             	sub    $0x4,%esp
+  8039a6:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8039aa:	56                   	push   %esi
+  8039ab:	f7 d9                	neg    %ecx
+  8039ad:	83 d3 00             	adc    $0x0,%ebx
+  8039b0:	f7 db                	neg    %ebx
+  8039b2:	53                   	push   %ebx
+  8039b3:	51                   	push   %ecx
+  8039b4:	e8 64 fe ff ff       	call   80381d <udivmod>
+  8039b9:	83 c4 10             	add    $0x10,%esp
+  8039bc:	eb c4                	jmp    803982 <__divdi3+0x55>
+
+008039be <__moddi3>:
+  8039be:	55                   	push   %ebp
+  8039bf:	57                   	push   %edi
+  8039c0:	56                   	push   %esi
+  8039c1:	53                   	push   %ebx
+  8039c2:	83 ec 24             	sub    $0x24,%esp
+  8039c5:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8039c9:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8039cd:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  8039d1:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  8039d5:	85 d2                	test   %edx,%edx
+  8039d7:	78 3b                	js     803a14 <__moddi3+0x56>
+  8039d9:	83 ec 04             	sub    $0x4,%esp
+  8039dc:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8039e0:	56                   	push   %esi
+  8039e1:	89 ce                	mov    %ecx,%esi
+  8039e3:	f7 de                	neg    %esi
+  8039e5:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8039e9:	89 de                	mov    %ebx,%esi
+  8039eb:	83 d6 00             	adc    $0x0,%esi
+  8039ee:	f7 de                	neg    %esi
+  8039f0:	89 74 24 14          	mov    %esi,0x14(%esp)
+  8039f4:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8039f8:	0f 48 f1             	cmovs  %ecx,%esi
+  8039fb:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  803a00:	53                   	push   %ebx
+  803a01:	56                   	push   %esi
+  803a02:	e8 16 fe ff ff       	call   80381d <udivmod>
+  803a07:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803a0b:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803a0f:	83 c4 10             	add    $0x10,%esp
+  803a12:	eb 47                	jmp    803a5b <__moddi3+0x9d>
+  803a14:	f7 d8                	neg    %eax
+  803a16:	83 d2 00             	adc    $0x0,%edx
+  803a19:	f7 da                	neg    %edx
+  803a1b:	83 ec 04             	sub    $0x4,%esp
+  803a1e:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803a22:	56                   	push   %esi
+  803a23:	89 cf                	mov    %ecx,%edi
+  803a25:	f7 df                	neg    %edi
+  803a27:	89 de                	mov    %ebx,%esi
+  803a29:	83 d6 00             	adc    $0x0,%esi
+  803a2c:	f7 de                	neg    %esi
+  803a2e:	0f 49 cf             	cmovns %edi,%ecx
+  803a31:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  803a35:	0f 49 de             	cmovns %esi,%ebx
+  803a38:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  803a3c:	ff 74 24 0c          	push   0xc(%esp)
+  803a40:	ff 74 24 0c          	push   0xc(%esp)
+  803a44:	e8 d4 fd ff ff       	call   80381d <udivmod>
+  803a49:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803a4d:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803a51:	f7 d8                	neg    %eax
+  803a53:	83 d2 00             	adc    $0x0,%edx
+  803a56:	f7 da                	neg    %edx
+  803a58:	83 c4 10             	add    $0x10,%esp
+  803a5b:	83 c4 24             	add    $0x24,%esp
+  803a5e:	5b                   	pop    %ebx
+  803a5f:	5e                   	pop    %esi
+  803a60:	5f                   	pop    %edi
+  803a61:	5d                   	pop    %ebp
+  803a62:	c3                   	ret
@@ -0,0 +1,9822 @@
+
+obj/user/sh.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 ab 09 00 00       	call   8009dc <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <_gettoken>:
+#define WHITESPACE " \t\r\n"
+#define SYMBOLS "<|>&;()"
+
+int
+_gettoken(char *s, char **p1, char **p2)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 0c             	sub    $0xc,%esp
+  80003c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80003f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  int t;
+
+  if (s == 0) {
+  800042:	85 db                	test   %ebx,%ebx
+  800044:	74 1a                	je     800060 <_gettoken+0x2d>
+    if (debug > 1)
+      cprintf("GETTOKEN NULL\n");
+    return 0;
+  }
+
+  if (debug > 1)
+  800046:	83 3d 00 70 80 00 01 	cmpl   $0x1,0x807000
+  80004d:	7f 31                	jg     800080 <_gettoken+0x4d>
+    cprintf("GETTOKEN: %s\n", s);
+
+  *p1 = 0;
+  80004f:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+  *p2 = 0;
+  800055:	8b 45 10             	mov    0x10(%ebp),%eax
+  800058:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+
+  while (strchr(WHITESPACE, *s))
+  80005e:	eb 3a                	jmp    80009a <_gettoken+0x67>
+    return 0;
+  800060:	be 00 00 00 00       	mov    $0x0,%esi
+    if (debug > 1)
+  800065:	83 3d 00 70 80 00 01 	cmpl   $0x1,0x807000
+  80006c:	7e 59                	jle    8000c7 <_gettoken+0x94>
+      cprintf("GETTOKEN NULL\n");
+  80006e:	83 ec 0c             	sub    $0xc,%esp
+  800071:	68 80 4c 80 00       	push   $0x804c80
+  800076:	e8 a9 0a 00 00       	call   800b24 <cprintf>
+  80007b:	83 c4 10             	add    $0x10,%esp
+  80007e:	eb 47                	jmp    8000c7 <_gettoken+0x94>
+    cprintf("GETTOKEN: %s\n", s);
+  800080:	83 ec 08             	sub    $0x8,%esp
+  800083:	53                   	push   %ebx
+  800084:	68 8f 4c 80 00       	push   $0x804c8f
+  800089:	e8 96 0a 00 00       	call   800b24 <cprintf>
+  80008e:	83 c4 10             	add    $0x10,%esp
+  800091:	eb bc                	jmp    80004f <_gettoken+0x1c>
+    *s++ = 0;
+  800093:	83 c3 01             	add    $0x1,%ebx
+  800096:	c6 43 ff 00          	movb   $0x0,-0x1(%ebx)
+  while (strchr(WHITESPACE, *s))
+  80009a:	83 ec 08             	sub    $0x8,%esp
+  80009d:	0f be 03             	movsbl (%ebx),%eax
+  8000a0:	50                   	push   %eax
+  8000a1:	68 9d 4c 80 00       	push   $0x804c9d
+  8000a6:	e8 69 12 00 00       	call   801314 <strchr>
+  8000ab:	83 c4 10             	add    $0x10,%esp
+  8000ae:	85 c0                	test   %eax,%eax
+  8000b0:	75 e1                	jne    800093 <_gettoken+0x60>
+  if (*s == 0) {
+  8000b2:	0f b6 03             	movzbl (%ebx),%eax
+  8000b5:	84 c0                	test   %al,%al
+  8000b7:	75 2a                	jne    8000e3 <_gettoken+0xb0>
+    if (debug > 1)
+      cprintf("EOL\n");
+    return 0;
+  8000b9:	be 00 00 00 00       	mov    $0x0,%esi
+    if (debug > 1)
+  8000be:	83 3d 00 70 80 00 01 	cmpl   $0x1,0x807000
+  8000c5:	7f 0a                	jg     8000d1 <_gettoken+0x9e>
+    **p2 = 0;
+    cprintf("WORD: %s\n", *p1);
+    **p2 = t;
+  }
+  return 'w';
+}
+  8000c7:	89 f0                	mov    %esi,%eax
+  8000c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000cc:	5b                   	pop    %ebx
+  8000cd:	5e                   	pop    %esi
+  8000ce:	5f                   	pop    %edi
+  8000cf:	5d                   	pop    %ebp
+  8000d0:	c3                   	ret
+      cprintf("EOL\n");
+  8000d1:	83 ec 0c             	sub    $0xc,%esp
+  8000d4:	68 a2 4c 80 00       	push   $0x804ca2
+  8000d9:	e8 46 0a 00 00       	call   800b24 <cprintf>
+  8000de:	83 c4 10             	add    $0x10,%esp
+  8000e1:	eb e4                	jmp    8000c7 <_gettoken+0x94>
+  if (strchr(SYMBOLS, *s)) {
+  8000e3:	83 ec 08             	sub    $0x8,%esp
+  8000e6:	0f be c0             	movsbl %al,%eax
+  8000e9:	50                   	push   %eax
+  8000ea:	68 b3 4c 80 00       	push   $0x804cb3
+  8000ef:	e8 20 12 00 00       	call   801314 <strchr>
+  8000f4:	83 c4 10             	add    $0x10,%esp
+  8000f7:	85 c0                	test   %eax,%eax
+  8000f9:	74 2c                	je     800127 <_gettoken+0xf4>
+    t = *s;
+  8000fb:	0f be 33             	movsbl (%ebx),%esi
+    *p1 = s;
+  8000fe:	89 1f                	mov    %ebx,(%edi)
+    *s++ = 0;
+  800100:	c6 03 00             	movb   $0x0,(%ebx)
+  800103:	83 c3 01             	add    $0x1,%ebx
+  800106:	8b 45 10             	mov    0x10(%ebp),%eax
+  800109:	89 18                	mov    %ebx,(%eax)
+    if (debug > 1)
+  80010b:	83 3d 00 70 80 00 01 	cmpl   $0x1,0x807000
+  800112:	7e b3                	jle    8000c7 <_gettoken+0x94>
+      cprintf("TOK %c\n", t);
+  800114:	83 ec 08             	sub    $0x8,%esp
+  800117:	56                   	push   %esi
+  800118:	68 a7 4c 80 00       	push   $0x804ca7
+  80011d:	e8 02 0a 00 00       	call   800b24 <cprintf>
+  800122:	83 c4 10             	add    $0x10,%esp
+  800125:	eb a0                	jmp    8000c7 <_gettoken+0x94>
+  *p1 = s;
+  800127:	89 1f                	mov    %ebx,(%edi)
+  while (*s && !strchr(WHITESPACE SYMBOLS, *s))
+  800129:	eb 03                	jmp    80012e <_gettoken+0xfb>
+    s++;
+  80012b:	83 c3 01             	add    $0x1,%ebx
+  while (*s && !strchr(WHITESPACE SYMBOLS, *s))
+  80012e:	0f b6 03             	movzbl (%ebx),%eax
+  800131:	84 c0                	test   %al,%al
+  800133:	74 18                	je     80014d <_gettoken+0x11a>
+  800135:	83 ec 08             	sub    $0x8,%esp
+  800138:	0f be c0             	movsbl %al,%eax
+  80013b:	50                   	push   %eax
+  80013c:	68 af 4c 80 00       	push   $0x804caf
+  800141:	e8 ce 11 00 00       	call   801314 <strchr>
+  800146:	83 c4 10             	add    $0x10,%esp
+  800149:	85 c0                	test   %eax,%eax
+  80014b:	74 de                	je     80012b <_gettoken+0xf8>
+  *p2 = s;
+  80014d:	8b 45 10             	mov    0x10(%ebp),%eax
+  800150:	89 18                	mov    %ebx,(%eax)
+  return 'w';
+  800152:	be 77 00 00 00       	mov    $0x77,%esi
+  if (debug > 1) {
+  800157:	83 3d 00 70 80 00 01 	cmpl   $0x1,0x807000
+  80015e:	0f 8e 63 ff ff ff    	jle    8000c7 <_gettoken+0x94>
+    t = **p2;
+  800164:	0f b6 33             	movzbl (%ebx),%esi
+    **p2 = 0;
+  800167:	c6 03 00             	movb   $0x0,(%ebx)
+    cprintf("WORD: %s\n", *p1);
+  80016a:	83 ec 08             	sub    $0x8,%esp
+  80016d:	ff 37                	push   (%edi)
+  80016f:	68 bb 4c 80 00       	push   $0x804cbb
+  800174:	e8 ab 09 00 00       	call   800b24 <cprintf>
+    **p2 = t;
+  800179:	8b 45 10             	mov    0x10(%ebp),%eax
+  80017c:	8b 00                	mov    (%eax),%eax
+  80017e:	89 f2                	mov    %esi,%edx
+  800180:	88 10                	mov    %dl,(%eax)
+  800182:	83 c4 10             	add    $0x10,%esp
+  return 'w';
+  800185:	be 77 00 00 00       	mov    $0x77,%esi
+  80018a:	e9 38 ff ff ff       	jmp    8000c7 <_gettoken+0x94>
+
+0080018f <gettoken>:
+
+int
+gettoken(char *s, char **p1)
+{
+  80018f:	55                   	push   %ebp
+  800190:	89 e5                	mov    %esp,%ebp
+  800192:	83 ec 08             	sub    $0x8,%esp
+  800195:	8b 45 08             	mov    0x8(%ebp),%eax
+  static int c, nc;
+  static char* np1, *np2;
+
+  if (s) {
+  800198:	85 c0                	test   %eax,%eax
+  80019a:	74 22                	je     8001be <gettoken+0x2f>
+    nc = _gettoken(s, &np1, &np2);
+  80019c:	83 ec 04             	sub    $0x4,%esp
+  80019f:	68 0c 70 80 00       	push   $0x80700c
+  8001a4:	68 10 70 80 00       	push   $0x807010
+  8001a9:	50                   	push   %eax
+  8001aa:	e8 84 fe ff ff       	call   800033 <_gettoken>
+  8001af:	a3 08 70 80 00       	mov    %eax,0x807008
+    return 0;
+  8001b4:	83 c4 10             	add    $0x10,%esp
+  8001b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  }
+  c = nc;
+  *p1 = np1;
+  nc = _gettoken(np2, &np1, &np2);
+  return c;
+}
+  8001bc:	c9                   	leave
+  8001bd:	c3                   	ret
+  c = nc;
+  8001be:	a1 08 70 80 00       	mov    0x807008,%eax
+  8001c3:	a3 04 70 80 00       	mov    %eax,0x807004
+  *p1 = np1;
+  8001c8:	8b 15 10 70 80 00    	mov    0x807010,%edx
+  8001ce:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8001d1:	89 10                	mov    %edx,(%eax)
+  nc = _gettoken(np2, &np1, &np2);
+  8001d3:	83 ec 04             	sub    $0x4,%esp
+  8001d6:	68 0c 70 80 00       	push   $0x80700c
+  8001db:	68 10 70 80 00       	push   $0x807010
+  8001e0:	ff 35 0c 70 80 00    	push   0x80700c
+  8001e6:	e8 48 fe ff ff       	call   800033 <_gettoken>
+  8001eb:	a3 08 70 80 00       	mov    %eax,0x807008
+  return c;
+  8001f0:	a1 04 70 80 00       	mov    0x807004,%eax
+  8001f5:	83 c4 10             	add    $0x10,%esp
+  8001f8:	eb c2                	jmp    8001bc <gettoken+0x2d>
+
+008001fa <runcmd>:
+{
+  8001fa:	55                   	push   %ebp
+  8001fb:	89 e5                	mov    %esp,%ebp
+  8001fd:	57                   	push   %edi
+  8001fe:	56                   	push   %esi
+  8001ff:	53                   	push   %ebx
+  800200:	81 ec 74 04 00 00    	sub    $0x474,%esp
+  gettoken(s, 0);
+  800206:	6a 00                	push   $0x0
+  800208:	ff 75 08             	push   0x8(%ebp)
+  80020b:	e8 7f ff ff ff       	call   80018f <gettoken>
+  800210:	83 c4 10             	add    $0x10,%esp
+    switch ((c = gettoken(0, &t))) {
+  800213:	8d 7d a4             	lea    -0x5c(%ebp),%edi
+  argc = 0;
+  800216:	bb 00 00 00 00       	mov    $0x0,%ebx
+    switch ((c = gettoken(0, &t))) {
+  80021b:	83 ec 08             	sub    $0x8,%esp
+  80021e:	57                   	push   %edi
+  80021f:	6a 00                	push   $0x0
+  800221:	e8 69 ff ff ff       	call   80018f <gettoken>
+  800226:	89 c6                	mov    %eax,%esi
+  800228:	83 c4 10             	add    $0x10,%esp
+  80022b:	83 f8 3e             	cmp    $0x3e,%eax
+  80022e:	0f 84 8d 01 00 00    	je     8003c1 <runcmd+0x1c7>
+  800234:	7e 74                	jle    8002aa <runcmd+0xb0>
+  800236:	83 f8 77             	cmp    $0x77,%eax
+  800239:	0f 84 40 01 00 00    	je     80037f <runcmd+0x185>
+  80023f:	83 f8 7c             	cmp    $0x7c,%eax
+  800242:	0f 85 ba 02 00 00    	jne    800502 <runcmd+0x308>
+      if ((r = pipe2(p, PIPE_BULK)) < 0) {
+  800248:	83 ec 08             	sub    $0x8,%esp
+  80024b:	6a 01                	push   $0x1
+  80024d:	8d 85 9c fb ff ff    	lea    -0x464(%ebp),%eax
+  800253:	50                   	push   %eax
+  800254:	e8 46 3b 00 00       	call   803d9f <pipe2>
+  800259:	83 c4 10             	add    $0x10,%esp
+  80025c:	85 c0                	test   %eax,%eax
+  80025e:	0f 88 ec 01 00 00    	js     800450 <runcmd+0x256>
+      if (debug)
+  800264:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  80026b:	0f 85 fa 01 00 00    	jne    80046b <runcmd+0x271>
+      if ((r = fork()) < 0) {
+  800271:	e8 28 1a 00 00       	call   801c9e <fork>
+  800276:	89 c6                	mov    %eax,%esi
+  800278:	85 c0                	test   %eax,%eax
+  80027a:	0f 88 0c 02 00 00    	js     80048c <runcmd+0x292>
+      if (r == 0) {
+  800280:	0f 85 1c 02 00 00    	jne    8004a2 <runcmd+0x2a8>
+        if (p[0] != 0) {
+  800286:	8b 85 9c fb ff ff    	mov    -0x464(%ebp),%eax
+  80028c:	85 c0                	test   %eax,%eax
+  80028e:	0f 85 2f 02 00 00    	jne    8004c3 <runcmd+0x2c9>
+        close(p[1]);
+  800294:	83 ec 0c             	sub    $0xc,%esp
+  800297:	ff b5 a0 fb ff ff    	push   -0x460(%ebp)
+  80029d:	e8 5e 1f 00 00       	call   802200 <close>
+        goto again;
+  8002a2:	83 c4 10             	add    $0x10,%esp
+  8002a5:	e9 6c ff ff ff       	jmp    800216 <runcmd+0x1c>
+    switch ((c = gettoken(0, &t))) {
+  8002aa:	85 c0                	test   %eax,%eax
+  8002ac:	0f 85 9a 00 00 00    	jne    80034c <runcmd+0x152>
+  if (argc == 0) {
+  8002b2:	85 db                	test   %ebx,%ebx
+  8002b4:	0f 84 5a 02 00 00    	je     800514 <runcmd+0x31a>
+  if (argv[0][0] != '/') {
+  8002ba:	8b 45 a8             	mov    -0x58(%ebp),%eax
+  8002bd:	80 38 2f             	cmpb   $0x2f,(%eax)
+  8002c0:	0f 85 70 02 00 00    	jne    800536 <runcmd+0x33c>
+  argv[argc] = 0;
+  8002c6:	c7 44 9d a8 00 00 00 	movl   $0x0,-0x58(%ebp,%ebx,4)
+  8002cd:	00 
+  if (debug) {
+  8002ce:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  8002d5:	0f 85 83 02 00 00    	jne    80055e <runcmd+0x364>
+  if ((r = spawn(argv[0], (const char**)argv)) < 0)
+  8002db:	83 ec 08             	sub    $0x8,%esp
+  8002de:	8d 45 a8             	lea    -0x58(%ebp),%eax
+  8002e1:	50                   	push   %eax
+  8002e2:	ff 75 a8             	push   -0x58(%ebp)
+  8002e5:	e8 be 2e 00 00       	call   8031a8 <spawn>
+  8002ea:	89 c3                	mov    %eax,%ebx
+  8002ec:	83 c4 10             	add    $0x10,%esp
+  8002ef:	85 c0                	test   %eax,%eax
+  8002f1:	0f 88 b5 02 00 00    	js     8005ac <runcmd+0x3b2>
+  close_all();
+  8002f7:	e8 31 1f 00 00       	call   80222d <close_all>
+    if (debug)
+  8002fc:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  800303:	0f 85 f0 02 00 00    	jne    8005f9 <runcmd+0x3ff>
+    wait(r);
+  800309:	83 ec 0c             	sub    $0xc,%esp
+  80030c:	53                   	push   %ebx
+  80030d:	e8 a9 3e 00 00       	call   8041bb <wait>
+    if (debug)
+  800312:	83 c4 10             	add    $0x10,%esp
+  800315:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  80031c:	0f 85 f6 02 00 00    	jne    800618 <runcmd+0x41e>
+  if (pipe_child) {
+  800322:	85 f6                	test   %esi,%esi
+  800324:	74 19                	je     80033f <runcmd+0x145>
+    wait(pipe_child);
+  800326:	83 ec 0c             	sub    $0xc,%esp
+  800329:	56                   	push   %esi
+  80032a:	e8 8c 3e 00 00       	call   8041bb <wait>
+    if (debug)
+  80032f:	83 c4 10             	add    $0x10,%esp
+  800332:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  800339:	0f 85 f4 02 00 00    	jne    800633 <runcmd+0x439>
+  exit();
+  80033f:	e8 eb 06 00 00       	call   800a2f <exit>
+}
+  800344:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800347:	5b                   	pop    %ebx
+  800348:	5e                   	pop    %esi
+  800349:	5f                   	pop    %edi
+  80034a:	5d                   	pop    %ebp
+  80034b:	c3                   	ret
+    switch ((c = gettoken(0, &t))) {
+  80034c:	83 f8 3c             	cmp    $0x3c,%eax
+  80034f:	0f 85 ad 01 00 00    	jne    800502 <runcmd+0x308>
+      if (gettoken(0, &t) != 'w') {
+  800355:	83 ec 08             	sub    $0x8,%esp
+  800358:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+  80035b:	50                   	push   %eax
+  80035c:	6a 00                	push   $0x0
+  80035e:	e8 2c fe ff ff       	call   80018f <gettoken>
+  800363:	83 c4 10             	add    $0x10,%esp
+  800366:	83 f8 77             	cmp    $0x77,%eax
+  800369:	75 3f                	jne    8003aa <runcmd+0x1b0>
+      panic("< redirection not implemented");
+  80036b:	83 ec 04             	sub    $0x4,%esp
+  80036e:	68 d9 4c 80 00       	push   $0x804cd9
+  800373:	6a 3a                	push   $0x3a
+  800375:	68 f7 4c 80 00       	push   $0x804cf7
+  80037a:	e8 ca 06 00 00       	call   800a49 <_panic>
+      if (argc == MAXARGS) {
+  80037f:	83 fb 10             	cmp    $0x10,%ebx
+  800382:	74 0f                	je     800393 <runcmd+0x199>
+      argv[argc++] = t;
+  800384:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  800387:	89 44 9d a8          	mov    %eax,-0x58(%ebp,%ebx,4)
+  80038b:	8d 5b 01             	lea    0x1(%ebx),%ebx
+      break;
+  80038e:	e9 88 fe ff ff       	jmp    80021b <runcmd+0x21>
+        cprintf("too many arguments\n");
+  800393:	83 ec 0c             	sub    $0xc,%esp
+  800396:	68 c5 4c 80 00       	push   $0x804cc5
+  80039b:	e8 84 07 00 00       	call   800b24 <cprintf>
+        exit();
+  8003a0:	e8 8a 06 00 00       	call   800a2f <exit>
+  8003a5:	83 c4 10             	add    $0x10,%esp
+  8003a8:	eb da                	jmp    800384 <runcmd+0x18a>
+        cprintf("syntax error: < not followed by word\n");
+  8003aa:	83 ec 0c             	sub    $0xc,%esp
+  8003ad:	68 18 4e 80 00       	push   $0x804e18
+  8003b2:	e8 6d 07 00 00       	call   800b24 <cprintf>
+        exit();
+  8003b7:	e8 73 06 00 00       	call   800a2f <exit>
+  8003bc:	83 c4 10             	add    $0x10,%esp
+  8003bf:	eb aa                	jmp    80036b <runcmd+0x171>
+      if (gettoken(0, &t) != 'w') {
+  8003c1:	83 ec 08             	sub    $0x8,%esp
+  8003c4:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+  8003c7:	50                   	push   %eax
+  8003c8:	6a 00                	push   $0x0
+  8003ca:	e8 c0 fd ff ff       	call   80018f <gettoken>
+  8003cf:	83 c4 10             	add    $0x10,%esp
+  8003d2:	83 f8 77             	cmp    $0x77,%eax
+  8003d5:	75 2b                	jne    800402 <runcmd+0x208>
+      if ((fd = open(t, O_WRONLY|O_CREAT|O_TRUNC)) < 0) {
+  8003d7:	8b 45 a4             	mov    -0x5c(%ebp),%eax
+  8003da:	89 85 94 fb ff ff    	mov    %eax,-0x46c(%ebp)
+  8003e0:	83 ec 08             	sub    $0x8,%esp
+  8003e3:	68 01 03 00 00       	push   $0x301
+  8003e8:	50                   	push   %eax
+  8003e9:	e8 c5 27 00 00       	call   802bb3 <open>
+  8003ee:	89 c6                	mov    %eax,%esi
+  8003f0:	83 c4 10             	add    $0x10,%esp
+  8003f3:	85 c0                	test   %eax,%eax
+  8003f5:	78 22                	js     800419 <runcmd+0x21f>
+      if (fd != 1) {
+  8003f7:	83 f8 01             	cmp    $0x1,%eax
+  8003fa:	0f 84 1b fe ff ff    	je     80021b <runcmd+0x21>
+  800400:	eb 33                	jmp    800435 <runcmd+0x23b>
+        cprintf("syntax error: > not followed by word\n");
+  800402:	83 ec 0c             	sub    $0xc,%esp
+  800405:	68 40 4e 80 00       	push   $0x804e40
+  80040a:	e8 15 07 00 00       	call   800b24 <cprintf>
+        exit();
+  80040f:	e8 1b 06 00 00       	call   800a2f <exit>
+  800414:	83 c4 10             	add    $0x10,%esp
+  800417:	eb be                	jmp    8003d7 <runcmd+0x1dd>
+        cprintf("open %s for write: %e", t, fd);
+  800419:	83 ec 04             	sub    $0x4,%esp
+  80041c:	50                   	push   %eax
+  80041d:	ff b5 94 fb ff ff    	push   -0x46c(%ebp)
+  800423:	68 01 4d 80 00       	push   $0x804d01
+  800428:	e8 f7 06 00 00       	call   800b24 <cprintf>
+        exit();
+  80042d:	e8 fd 05 00 00       	call   800a2f <exit>
+  800432:	83 c4 10             	add    $0x10,%esp
+        dup(fd, 1);
+  800435:	83 ec 08             	sub    $0x8,%esp
+  800438:	6a 01                	push   $0x1
+  80043a:	56                   	push   %esi
+  80043b:	e8 12 1e 00 00       	call   802252 <dup>
+        close(fd);
+  800440:	89 34 24             	mov    %esi,(%esp)
+  800443:	e8 b8 1d 00 00       	call   802200 <close>
+  800448:	83 c4 10             	add    $0x10,%esp
+  80044b:	e9 cb fd ff ff       	jmp    80021b <runcmd+0x21>
+        cprintf("pipe: %e", r);
+  800450:	83 ec 08             	sub    $0x8,%esp
+  800453:	50                   	push   %eax
+  800454:	68 17 4d 80 00       	push   $0x804d17
+  800459:	e8 c6 06 00 00       	call   800b24 <cprintf>
+        exit();
+  80045e:	e8 cc 05 00 00       	call   800a2f <exit>
+  800463:	83 c4 10             	add    $0x10,%esp
+  800466:	e9 f9 fd ff ff       	jmp    800264 <runcmd+0x6a>
+        cprintf("PIPE: %d %d\n", p[0], p[1]);
+  80046b:	83 ec 04             	sub    $0x4,%esp
+  80046e:	ff b5 a0 fb ff ff    	push   -0x460(%ebp)
+  800474:	ff b5 9c fb ff ff    	push   -0x464(%ebp)
+  80047a:	68 20 4d 80 00       	push   $0x804d20
+  80047f:	e8 a0 06 00 00       	call   800b24 <cprintf>
+  800484:	83 c4 10             	add    $0x10,%esp
+  800487:	e9 e5 fd ff ff       	jmp    800271 <runcmd+0x77>
+        cprintf("fork: %e", r);
+  80048c:	83 ec 08             	sub    $0x8,%esp
+  80048f:	50                   	push   %eax
+  800490:	68 73 52 80 00       	push   $0x805273
+  800495:	e8 8a 06 00 00       	call   800b24 <cprintf>
+        exit();
+  80049a:	e8 90 05 00 00       	call   800a2f <exit>
+  80049f:	83 c4 10             	add    $0x10,%esp
+        if (p[1] != 1) {
+  8004a2:	8b 85 a0 fb ff ff    	mov    -0x460(%ebp),%eax
+  8004a8:	83 f8 01             	cmp    $0x1,%eax
+  8004ab:	75 37                	jne    8004e4 <runcmd+0x2ea>
+        close(p[0]);
+  8004ad:	83 ec 0c             	sub    $0xc,%esp
+  8004b0:	ff b5 9c fb ff ff    	push   -0x464(%ebp)
+  8004b6:	e8 45 1d 00 00       	call   802200 <close>
+        goto runit;
+  8004bb:	83 c4 10             	add    $0x10,%esp
+  8004be:	e9 ef fd ff ff       	jmp    8002b2 <runcmd+0xb8>
+          dup(p[0], 0);
+  8004c3:	83 ec 08             	sub    $0x8,%esp
+  8004c6:	6a 00                	push   $0x0
+  8004c8:	50                   	push   %eax
+  8004c9:	e8 84 1d 00 00       	call   802252 <dup>
+          close(p[0]);
+  8004ce:	83 c4 04             	add    $0x4,%esp
+  8004d1:	ff b5 9c fb ff ff    	push   -0x464(%ebp)
+  8004d7:	e8 24 1d 00 00       	call   802200 <close>
+  8004dc:	83 c4 10             	add    $0x10,%esp
+  8004df:	e9 b0 fd ff ff       	jmp    800294 <runcmd+0x9a>
+          dup(p[1], 1);
+  8004e4:	83 ec 08             	sub    $0x8,%esp
+  8004e7:	6a 01                	push   $0x1
+  8004e9:	50                   	push   %eax
+  8004ea:	e8 63 1d 00 00       	call   802252 <dup>
+          close(p[1]);
+  8004ef:	83 c4 04             	add    $0x4,%esp
+  8004f2:	ff b5 a0 fb ff ff    	push   -0x460(%ebp)
+  8004f8:	e8 03 1d 00 00       	call   802200 <close>
+  8004fd:	83 c4 10             	add    $0x10,%esp
+  800500:	eb ab                	jmp    8004ad <runcmd+0x2b3>
+      panic("bad return %d from gettoken", c);
+  800502:	56                   	push   %esi
+  800503:	68 2d 4d 80 00       	push   $0x804d2d
+  800508:	6a 70                	push   $0x70
+  80050a:	68 f7 4c 80 00       	push   $0x804cf7
+  80050f:	e8 35 05 00 00       	call   800a49 <_panic>
+    if (debug)
+  800514:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  80051b:	0f 84 23 fe ff ff    	je     800344 <runcmd+0x14a>
+      cprintf("EMPTY COMMAND\n");
+  800521:	83 ec 0c             	sub    $0xc,%esp
+  800524:	68 49 4d 80 00       	push   $0x804d49
+  800529:	e8 f6 05 00 00       	call   800b24 <cprintf>
+  80052e:	83 c4 10             	add    $0x10,%esp
+    return;
+  800531:	e9 0e fe ff ff       	jmp    800344 <runcmd+0x14a>
+    argv0buf[0] = '/';
+  800536:	c6 85 a4 fb ff ff 2f 	movb   $0x2f,-0x45c(%ebp)
+    strcpy(argv0buf + 1, argv[0]);
+  80053d:	83 ec 08             	sub    $0x8,%esp
+  800540:	50                   	push   %eax
+  800541:	8d bd a4 fb ff ff    	lea    -0x45c(%ebp),%edi
+  800547:	8d 85 a5 fb ff ff    	lea    -0x45b(%ebp),%eax
+  80054d:	50                   	push   %eax
+  80054e:	e8 af 0c 00 00       	call   801202 <strcpy>
+    argv[0] = argv0buf;
+  800553:	89 7d a8             	mov    %edi,-0x58(%ebp)
+  800556:	83 c4 10             	add    $0x10,%esp
+  800559:	e9 68 fd ff ff       	jmp    8002c6 <runcmd+0xcc>
+    cprintf("[%08x] SPAWN:", thisenv->env_id);
+  80055e:	a1 e0 83 80 00       	mov    0x8083e0,%eax
+  800563:	8b 40 48             	mov    0x48(%eax),%eax
+  800566:	83 ec 08             	sub    $0x8,%esp
+  800569:	50                   	push   %eax
+  80056a:	68 58 4d 80 00       	push   $0x804d58
+  80056f:	e8 b0 05 00 00       	call   800b24 <cprintf>
+    for (i = 0; argv[i]; i++)
+  800574:	8d 5d a8             	lea    -0x58(%ebp),%ebx
+  800577:	83 c4 10             	add    $0x10,%esp
+  80057a:	83 c3 04             	add    $0x4,%ebx
+  80057d:	8b 43 fc             	mov    -0x4(%ebx),%eax
+  800580:	85 c0                	test   %eax,%eax
+  800582:	74 13                	je     800597 <runcmd+0x39d>
+      cprintf(" %s", argv[i]);
+  800584:	83 ec 08             	sub    $0x8,%esp
+  800587:	50                   	push   %eax
+  800588:	68 e0 4d 80 00       	push   $0x804de0
+  80058d:	e8 92 05 00 00       	call   800b24 <cprintf>
+  800592:	83 c4 10             	add    $0x10,%esp
+  800595:	eb e3                	jmp    80057a <runcmd+0x380>
+    cprintf("\n");
+  800597:	83 ec 0c             	sub    $0xc,%esp
+  80059a:	68 a0 4c 80 00       	push   $0x804ca0
+  80059f:	e8 80 05 00 00       	call   800b24 <cprintf>
+  8005a4:	83 c4 10             	add    $0x10,%esp
+  8005a7:	e9 2f fd ff ff       	jmp    8002db <runcmd+0xe1>
+    cprintf("spawn %s: %e\n", argv[0], r);
+  8005ac:	83 ec 04             	sub    $0x4,%esp
+  8005af:	50                   	push   %eax
+  8005b0:	ff 75 a8             	push   -0x58(%ebp)
+  8005b3:	68 66 4d 80 00       	push   $0x804d66
+  8005b8:	e8 67 05 00 00       	call   800b24 <cprintf>
+  close_all();
+  8005bd:	e8 6b 1c 00 00       	call   80222d <close_all>
+  if (r >= 0) {
+  8005c2:	83 c4 10             	add    $0x10,%esp
+  if (pipe_child) {
+  8005c5:	85 f6                	test   %esi,%esi
+  8005c7:	0f 84 72 fd ff ff    	je     80033f <runcmd+0x145>
+    if (debug)
+  8005cd:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  8005d4:	0f 84 4c fd ff ff    	je     800326 <runcmd+0x12c>
+      cprintf("[%08x] WAIT pipe_child %08x\n", thisenv->env_id, pipe_child);
+  8005da:	a1 e0 83 80 00       	mov    0x8083e0,%eax
+  8005df:	8b 40 48             	mov    0x48(%eax),%eax
+  8005e2:	83 ec 04             	sub    $0x4,%esp
+  8005e5:	56                   	push   %esi
+  8005e6:	50                   	push   %eax
+  8005e7:	68 9f 4d 80 00       	push   $0x804d9f
+  8005ec:	e8 33 05 00 00       	call   800b24 <cprintf>
+  8005f1:	83 c4 10             	add    $0x10,%esp
+  8005f4:	e9 2d fd ff ff       	jmp    800326 <runcmd+0x12c>
+      cprintf("[%08x] WAIT %s %08x\n", thisenv->env_id, argv[0], r);
+  8005f9:	a1 e0 83 80 00       	mov    0x8083e0,%eax
+  8005fe:	8b 40 48             	mov    0x48(%eax),%eax
+  800601:	53                   	push   %ebx
+  800602:	ff 75 a8             	push   -0x58(%ebp)
+  800605:	50                   	push   %eax
+  800606:	68 74 4d 80 00       	push   $0x804d74
+  80060b:	e8 14 05 00 00       	call   800b24 <cprintf>
+  800610:	83 c4 10             	add    $0x10,%esp
+  800613:	e9 f1 fc ff ff       	jmp    800309 <runcmd+0x10f>
+      cprintf("[%08x] wait finished\n", thisenv->env_id);
+  800618:	a1 e0 83 80 00       	mov    0x8083e0,%eax
+  80061d:	8b 40 48             	mov    0x48(%eax),%eax
+  800620:	83 ec 08             	sub    $0x8,%esp
+  800623:	50                   	push   %eax
+  800624:	68 89 4d 80 00       	push   $0x804d89
+  800629:	e8 f6 04 00 00       	call   800b24 <cprintf>
+  80062e:	83 c4 10             	add    $0x10,%esp
+  800631:	eb 92                	jmp    8005c5 <runcmd+0x3cb>
+      cprintf("[%08x] wait finished\n", thisenv->env_id);
+  800633:	a1 e0 83 80 00       	mov    0x8083e0,%eax
+  800638:	8b 40 48             	mov    0x48(%eax),%eax
+  80063b:	83 ec 08             	sub    $0x8,%esp
+  80063e:	50                   	push   %eax
+  80063f:	68 89 4d 80 00       	push   $0x804d89
+  800644:	e8 db 04 00 00       	call   800b24 <cprintf>
+  800649:	83 c4 10             	add    $0x10,%esp
+  80064c:	e9 ee fc ff ff       	jmp    80033f <runcmd+0x145>
+
+00800651 <usage>:
+
+
+void
+usage(void)
+{
+  800651:	55                   	push   %ebp
+  800652:	89 e5                	mov    %esp,%ebp
+  800654:	83 ec 14             	sub    $0x14,%esp
+  cprintf("usage: sh [-dix] [command-file]\n");
+  800657:	68 68 4e 80 00       	push   $0x804e68
+  80065c:	e8 c3 04 00 00       	call   800b24 <cprintf>
+  exit();
+  800661:	e8 c9 03 00 00       	call   800a2f <exit>
+}
+  800666:	83 c4 10             	add    $0x10,%esp
+  800669:	c9                   	leave
+  80066a:	c3                   	ret
+
+0080066b <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  80066b:	55                   	push   %ebp
+  80066c:	89 e5                	mov    %esp,%ebp
+  80066e:	57                   	push   %edi
+  80066f:	56                   	push   %esi
+  800670:	53                   	push   %ebx
+  800671:	83 ec 30             	sub    $0x30,%esp
+  int r, interactive, echocmds;
+  struct Argstate args;
+
+  interactive = '?';
+  echocmds = 0;
+  argstart(&argc, argv, &args);
+  800674:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  800677:	50                   	push   %eax
+  800678:	ff 75 0c             	push   0xc(%ebp)
+  80067b:	8d 45 08             	lea    0x8(%ebp),%eax
+  80067e:	50                   	push   %eax
+  80067f:	e8 90 18 00 00       	call   801f14 <argstart>
+  while ((r = argnext(&args)) >= 0)
+  800684:	83 c4 10             	add    $0x10,%esp
+  echocmds = 0;
+  800687:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+  interactive = '?';
+  80068e:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  while ((r = argnext(&args)) >= 0)
+  800693:	8d 5d d8             	lea    -0x28(%ebp),%ebx
+    switch (r) {
+    case 'd':
+      debug++;
+      break;
+    case 'i':
+      interactive = 1;
+  800696:	be 01 00 00 00       	mov    $0x1,%esi
+  while ((r = argnext(&args)) >= 0)
+  80069b:	eb 10                	jmp    8006ad <umain+0x42>
+      debug++;
+  80069d:	83 05 00 70 80 00 01 	addl   $0x1,0x807000
+      break;
+  8006a4:	eb 07                	jmp    8006ad <umain+0x42>
+      interactive = 1;
+  8006a6:	89 f7                	mov    %esi,%edi
+  8006a8:	eb 03                	jmp    8006ad <umain+0x42>
+    switch (r) {
+  8006aa:	89 75 d4             	mov    %esi,-0x2c(%ebp)
+  while ((r = argnext(&args)) >= 0)
+  8006ad:	83 ec 0c             	sub    $0xc,%esp
+  8006b0:	53                   	push   %ebx
+  8006b1:	e8 8e 18 00 00       	call   801f44 <argnext>
+  8006b6:	83 c4 10             	add    $0x10,%esp
+  8006b9:	85 c0                	test   %eax,%eax
+  8006bb:	78 16                	js     8006d3 <umain+0x68>
+    switch (r) {
+  8006bd:	83 f8 69             	cmp    $0x69,%eax
+  8006c0:	74 e4                	je     8006a6 <umain+0x3b>
+  8006c2:	83 f8 78             	cmp    $0x78,%eax
+  8006c5:	74 e3                	je     8006aa <umain+0x3f>
+  8006c7:	83 f8 64             	cmp    $0x64,%eax
+  8006ca:	74 d1                	je     80069d <umain+0x32>
+      break;
+    case 'x':
+      echocmds = 1;
+      break;
+    default:
+      usage();
+  8006cc:	e8 80 ff ff ff       	call   800651 <usage>
+  8006d1:	eb da                	jmp    8006ad <umain+0x42>
+    }
+
+  if (argc > 2)
+  8006d3:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+  8006d7:	7f 1f                	jg     8006f8 <umain+0x8d>
+    usage();
+  if (argc == 2) {
+  8006d9:	83 7d 08 02          	cmpl   $0x2,0x8(%ebp)
+  8006dd:	74 20                	je     8006ff <umain+0x94>
+    close(0);
+    if ((r = open(argv[1], O_RDONLY)) < 0)
+      panic("open %s: %e", argv[1], r);
+    assert(r == 0);
+  }
+  if (interactive == '?')
+  8006df:	83 ff 3f             	cmp    $0x3f,%edi
+  8006e2:	74 75                	je     800759 <umain+0xee>
+  8006e4:	85 ff                	test   %edi,%edi
+  8006e6:	bf e4 4d 80 00       	mov    $0x804de4,%edi
+  8006eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006f0:	0f 44 f8             	cmove  %eax,%edi
+  8006f3:	e9 06 01 00 00       	jmp    8007fe <umain+0x193>
+    usage();
+  8006f8:	e8 54 ff ff ff       	call   800651 <usage>
+  8006fd:	eb da                	jmp    8006d9 <umain+0x6e>
+    close(0);
+  8006ff:	83 ec 0c             	sub    $0xc,%esp
+  800702:	6a 00                	push   $0x0
+  800704:	e8 f7 1a 00 00       	call   802200 <close>
+    if ((r = open(argv[1], O_RDONLY)) < 0)
+  800709:	83 c4 08             	add    $0x8,%esp
+  80070c:	6a 00                	push   $0x0
+  80070e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800711:	ff 70 04             	push   0x4(%eax)
+  800714:	e8 9a 24 00 00       	call   802bb3 <open>
+  800719:	83 c4 10             	add    $0x10,%esp
+  80071c:	85 c0                	test   %eax,%eax
+  80071e:	78 1b                	js     80073b <umain+0xd0>
+    assert(r == 0);
+  800720:	74 bd                	je     8006df <umain+0x74>
+  800722:	68 c8 4d 80 00       	push   $0x804dc8
+  800727:	68 cf 4d 80 00       	push   $0x804dcf
+  80072c:	68 21 01 00 00       	push   $0x121
+  800731:	68 f7 4c 80 00       	push   $0x804cf7
+  800736:	e8 0e 03 00 00       	call   800a49 <_panic>
+      panic("open %s: %e", argv[1], r);
+  80073b:	83 ec 0c             	sub    $0xc,%esp
+  80073e:	50                   	push   %eax
+  80073f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800742:	ff 70 04             	push   0x4(%eax)
+  800745:	68 bc 4d 80 00       	push   $0x804dbc
+  80074a:	68 20 01 00 00       	push   $0x120
+  80074f:	68 f7 4c 80 00       	push   $0x804cf7
+  800754:	e8 f0 02 00 00       	call   800a49 <_panic>
+    interactive = iscons(0);
+  800759:	83 ec 0c             	sub    $0xc,%esp
+  80075c:	6a 00                	push   $0x0
+  80075e:	e8 fb 01 00 00       	call   80095e <iscons>
+  800763:	89 c7                	mov    %eax,%edi
+  800765:	83 c4 10             	add    $0x10,%esp
+  800768:	e9 77 ff ff ff       	jmp    8006e4 <umain+0x79>
+  while (1) {
+    char *buf;
+
+    buf = readline(interactive ? "$ " : NULL);
+    if (buf == NULL) {
+      if (debug)
+  80076d:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  800774:	75 0a                	jne    800780 <umain+0x115>
+        cprintf("EXITING\n");
+      exit();                   // end of file
+  800776:	e8 b4 02 00 00       	call   800a2f <exit>
+  80077b:	e9 94 00 00 00       	jmp    800814 <umain+0x1a9>
+        cprintf("EXITING\n");
+  800780:	83 ec 0c             	sub    $0xc,%esp
+  800783:	68 e7 4d 80 00       	push   $0x804de7
+  800788:	e8 97 03 00 00       	call   800b24 <cprintf>
+  80078d:	83 c4 10             	add    $0x10,%esp
+  800790:	eb e4                	jmp    800776 <umain+0x10b>
+    }
+    if (debug)
+      cprintf("LINE: %s\n", buf);
+  800792:	83 ec 08             	sub    $0x8,%esp
+  800795:	53                   	push   %ebx
+  800796:	68 f0 4d 80 00       	push   $0x804df0
+  80079b:	e8 84 03 00 00       	call   800b24 <cprintf>
+  8007a0:	83 c4 10             	add    $0x10,%esp
+  8007a3:	eb 7c                	jmp    800821 <umain+0x1b6>
+    if (buf[0] == '#')
+      continue;
+    if (echocmds)
+      printf("# %s\n", buf);
+  8007a5:	83 ec 08             	sub    $0x8,%esp
+  8007a8:	53                   	push   %ebx
+  8007a9:	68 fa 4d 80 00       	push   $0x804dfa
+  8007ae:	e8 df 29 00 00       	call   803192 <printf>
+  8007b3:	83 c4 10             	add    $0x10,%esp
+  8007b6:	eb 78                	jmp    800830 <umain+0x1c5>
+    if (debug)
+      cprintf("BEFORE FORK\n");
+  8007b8:	83 ec 0c             	sub    $0xc,%esp
+  8007bb:	68 00 4e 80 00       	push   $0x804e00
+  8007c0:	e8 5f 03 00 00       	call   800b24 <cprintf>
+  8007c5:	83 c4 10             	add    $0x10,%esp
+  8007c8:	eb 73                	jmp    80083d <umain+0x1d2>
+    if ((r = fork()) < 0)
+      panic("fork: %e", r);
+  8007ca:	50                   	push   %eax
+  8007cb:	68 73 52 80 00       	push   $0x805273
+  8007d0:	68 38 01 00 00       	push   $0x138
+  8007d5:	68 f7 4c 80 00       	push   $0x804cf7
+  8007da:	e8 6a 02 00 00       	call   800a49 <_panic>
+    if (debug)
+      cprintf("FORK: %d\n", r);
+  8007df:	83 ec 08             	sub    $0x8,%esp
+  8007e2:	50                   	push   %eax
+  8007e3:	68 0d 4e 80 00       	push   $0x804e0d
+  8007e8:	e8 37 03 00 00       	call   800b24 <cprintf>
+  8007ed:	83 c4 10             	add    $0x10,%esp
+  8007f0:	eb 5f                	jmp    800851 <umain+0x1e6>
+    if (r == 0) {
+      runcmd(buf);
+      exit();
+    } else
+      wait(r);
+  8007f2:	83 ec 0c             	sub    $0xc,%esp
+  8007f5:	56                   	push   %esi
+  8007f6:	e8 c0 39 00 00       	call   8041bb <wait>
+  8007fb:	83 c4 10             	add    $0x10,%esp
+    buf = readline(interactive ? "$ " : NULL);
+  8007fe:	83 ec 0c             	sub    $0xc,%esp
+  800801:	57                   	push   %edi
+  800802:	e8 d0 08 00 00       	call   8010d7 <readline>
+  800807:	89 c3                	mov    %eax,%ebx
+    if (buf == NULL) {
+  800809:	83 c4 10             	add    $0x10,%esp
+  80080c:	85 c0                	test   %eax,%eax
+  80080e:	0f 84 59 ff ff ff    	je     80076d <umain+0x102>
+    if (debug)
+  800814:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  80081b:	0f 85 71 ff ff ff    	jne    800792 <umain+0x127>
+    if (buf[0] == '#')
+  800821:	80 3b 23             	cmpb   $0x23,(%ebx)
+  800824:	74 d8                	je     8007fe <umain+0x193>
+    if (echocmds)
+  800826:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  80082a:	0f 85 75 ff ff ff    	jne    8007a5 <umain+0x13a>
+    if (debug)
+  800830:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  800837:	0f 85 7b ff ff ff    	jne    8007b8 <umain+0x14d>
+    if ((r = fork()) < 0)
+  80083d:	e8 5c 14 00 00       	call   801c9e <fork>
+  800842:	89 c6                	mov    %eax,%esi
+  800844:	85 c0                	test   %eax,%eax
+  800846:	78 82                	js     8007ca <umain+0x15f>
+    if (debug)
+  800848:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  80084f:	75 8e                	jne    8007df <umain+0x174>
+    if (r == 0) {
+  800851:	85 f6                	test   %esi,%esi
+  800853:	75 9d                	jne    8007f2 <umain+0x187>
+      runcmd(buf);
+  800855:	83 ec 0c             	sub    $0xc,%esp
+  800858:	53                   	push   %ebx
+  800859:	e8 9c f9 ff ff       	call   8001fa <runcmd>
+      exit();
+  80085e:	e8 cc 01 00 00       	call   800a2f <exit>
+  800863:	83 c4 10             	add    $0x10,%esp
+  800866:	eb 96                	jmp    8007fe <umain+0x193>
+
+00800868 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  800868:	b8 00 00 00 00       	mov    $0x0,%eax
+  80086d:	c3                   	ret
+
+0080086e <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80086e:	55                   	push   %ebp
+  80086f:	89 e5                	mov    %esp,%ebp
+  800871:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  800874:	68 89 4e 80 00       	push   $0x804e89
+  800879:	ff 75 0c             	push   0xc(%ebp)
+  80087c:	e8 81 09 00 00       	call   801202 <strcpy>
+  return 0;
+}
+  800881:	b8 00 00 00 00       	mov    $0x0,%eax
+  800886:	c9                   	leave
+  800887:	c3                   	ret
+
+00800888 <devcons_write>:
+{
+  800888:	55                   	push   %ebp
+  800889:	89 e5                	mov    %esp,%ebp
+  80088b:	57                   	push   %edi
+  80088c:	56                   	push   %esi
+  80088d:	53                   	push   %ebx
+  80088e:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  800894:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  800899:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  80089f:	eb 2e                	jmp    8008cf <devcons_write+0x47>
+    m = n - tot;
+  8008a1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8008a4:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  8008a6:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8008ab:	39 c3                	cmp    %eax,%ebx
+  8008ad:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  8008b0:	83 ec 04             	sub    $0x4,%esp
+  8008b3:	53                   	push   %ebx
+  8008b4:	89 f0                	mov    %esi,%eax
+  8008b6:	03 45 0c             	add    0xc(%ebp),%eax
+  8008b9:	50                   	push   %eax
+  8008ba:	57                   	push   %edi
+  8008bb:	e8 c8 0a 00 00       	call   801388 <memmove>
+    sys_cputs(buf, m);
+  8008c0:	83 c4 08             	add    $0x8,%esp
+  8008c3:	53                   	push   %ebx
+  8008c4:	57                   	push   %edi
+  8008c5:	e8 68 0c 00 00       	call   801532 <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  8008ca:	01 de                	add    %ebx,%esi
+  8008cc:	83 c4 10             	add    $0x10,%esp
+  8008cf:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8008d2:	72 cd                	jb     8008a1 <devcons_write+0x19>
+}
+  8008d4:	89 f0                	mov    %esi,%eax
+  8008d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8008d9:	5b                   	pop    %ebx
+  8008da:	5e                   	pop    %esi
+  8008db:	5f                   	pop    %edi
+  8008dc:	5d                   	pop    %ebp
+  8008dd:	c3                   	ret
+
+008008de <devcons_read>:
+{
+  8008de:	55                   	push   %ebp
+  8008df:	89 e5                	mov    %esp,%ebp
+  8008e1:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  8008e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008e9:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8008ed:	75 07                	jne    8008f6 <devcons_read+0x18>
+  8008ef:	eb 1f                	jmp    800910 <devcons_read+0x32>
+    sys_yield();
+  8008f1:	e8 d9 0c 00 00       	call   8015cf <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  8008f6:	e8 55 0c 00 00       	call   801550 <sys_cgetc>
+  8008fb:	85 c0                	test   %eax,%eax
+  8008fd:	74 f2                	je     8008f1 <devcons_read+0x13>
+  if (c < 0)
+  8008ff:	78 0f                	js     800910 <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  800901:	83 f8 04             	cmp    $0x4,%eax
+  800904:	74 0c                	je     800912 <devcons_read+0x34>
+  *(char*)vbuf = c;
+  800906:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800909:	88 02                	mov    %al,(%edx)
+  return 1;
+  80090b:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  800910:	c9                   	leave
+  800911:	c3                   	ret
+    return 0;
+  800912:	b8 00 00 00 00       	mov    $0x0,%eax
+  800917:	eb f7                	jmp    800910 <devcons_read+0x32>
+
+00800919 <cputchar>:
+{
+  800919:	55                   	push   %ebp
+  80091a:	89 e5                	mov    %esp,%ebp
+  80091c:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  80091f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800922:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  800925:	6a 01                	push   $0x1
+  800927:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80092a:	50                   	push   %eax
+  80092b:	e8 02 0c 00 00       	call   801532 <sys_cputs>
+}
+  800930:	83 c4 10             	add    $0x10,%esp
+  800933:	c9                   	leave
+  800934:	c3                   	ret
+
+00800935 <getchar>:
+{
+  800935:	55                   	push   %ebp
+  800936:	89 e5                	mov    %esp,%ebp
+  800938:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  80093b:	6a 01                	push   $0x1
+  80093d:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  800940:	50                   	push   %eax
+  800941:	6a 00                	push   $0x0
+  800943:	e8 40 1a 00 00       	call   802388 <read>
+  if (r < 0)
+  800948:	83 c4 10             	add    $0x10,%esp
+  80094b:	85 c0                	test   %eax,%eax
+  80094d:	78 06                	js     800955 <getchar+0x20>
+  if (r < 1)
+  80094f:	74 06                	je     800957 <getchar+0x22>
+  return c;
+  800951:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  800955:	c9                   	leave
+  800956:	c3                   	ret
+    return -E_EOF;
+  800957:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80095c:	eb f7                	jmp    800955 <getchar+0x20>
+
+0080095e <iscons>:
+{
+  80095e:	55                   	push   %ebp
+  80095f:	89 e5                	mov    %esp,%ebp
+  800961:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800964:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800967:	50                   	push   %eax
+  800968:	ff 75 08             	push   0x8(%ebp)
+  80096b:	e8 6d 17 00 00       	call   8020dd <fd_lookup>
+  800970:	83 c4 10             	add    $0x10,%esp
+  800973:	85 c0                	test   %eax,%eax
+  800975:	78 11                	js     800988 <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  800977:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80097a:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  800980:	39 10                	cmp    %edx,(%eax)
+  800982:	0f 94 c0             	sete   %al
+  800985:	0f b6 c0             	movzbl %al,%eax
+}
+  800988:	c9                   	leave
+  800989:	c3                   	ret
+
+0080098a <opencons>:
+{
+  80098a:	55                   	push   %ebp
+  80098b:	89 e5                	mov    %esp,%ebp
+  80098d:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  800990:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800993:	50                   	push   %eax
+  800994:	e8 ee 16 00 00       	call   802087 <fd_alloc>
+  800999:	83 c4 10             	add    $0x10,%esp
+  80099c:	85 c0                	test   %eax,%eax
+  80099e:	78 3a                	js     8009da <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8009a0:	83 ec 04             	sub    $0x4,%esp
+  8009a3:	68 07 04 00 00       	push   $0x407
+  8009a8:	ff 75 f4             	push   -0xc(%ebp)
+  8009ab:	6a 00                	push   $0x0
+  8009ad:	e8 7f 0c 00 00       	call   801631 <sys_page_alloc>
+  8009b2:	83 c4 10             	add    $0x10,%esp
+  8009b5:	85 c0                	test   %eax,%eax
+  8009b7:	78 21                	js     8009da <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  8009b9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009bc:	8b 15 00 60 80 00    	mov    0x806000,%edx
+  8009c2:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  8009c4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009c7:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  8009ce:	83 ec 0c             	sub    $0xc,%esp
+  8009d1:	50                   	push   %eax
+  8009d2:	e8 8c 16 00 00       	call   802063 <fd2num>
+  8009d7:	83 c4 10             	add    $0x10,%esp
+}
+  8009da:	c9                   	leave
+  8009db:	c3                   	ret
+
+008009dc <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8009dc:	55                   	push   %ebp
+  8009dd:	89 e5                	mov    %esp,%ebp
+  8009df:	56                   	push   %esi
+  8009e0:	53                   	push   %ebx
+  8009e1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8009e4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  8009e7:	c7 05 e0 83 80 00 00 	movl   $0x0,0x8083e0
+  8009ee:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  8009f1:	e8 ba 0b 00 00       	call   8015b0 <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  8009f6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8009fb:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8009fe:	c1 e0 04             	shl    $0x4,%eax
+  800a01:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800a06:	a3 e0 83 80 00       	mov    %eax,0x8083e0
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800a0b:	85 db                	test   %ebx,%ebx
+  800a0d:	7e 07                	jle    800a16 <libmain+0x3a>
+    binaryname = argv[0];
+  800a0f:	8b 06                	mov    (%esi),%eax
+  800a11:	a3 1c 60 80 00       	mov    %eax,0x80601c
+
+  // call user main routine
+  umain(argc, argv);
+  800a16:	83 ec 08             	sub    $0x8,%esp
+  800a19:	56                   	push   %esi
+  800a1a:	53                   	push   %ebx
+  800a1b:	e8 4b fc ff ff       	call   80066b <umain>
+
+  // exit gracefully
+  exit();
+  800a20:	e8 0a 00 00 00       	call   800a2f <exit>
+}
+  800a25:	83 c4 10             	add    $0x10,%esp
+  800a28:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800a2b:	5b                   	pop    %ebx
+  800a2c:	5e                   	pop    %esi
+  800a2d:	5d                   	pop    %ebp
+  800a2e:	c3                   	ret
+
+00800a2f <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800a2f:	55                   	push   %ebp
+  800a30:	89 e5                	mov    %esp,%ebp
+  800a32:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  800a35:	e8 f3 17 00 00       	call   80222d <close_all>
+  sys_env_destroy(0);
+  800a3a:	83 ec 0c             	sub    $0xc,%esp
+  800a3d:	6a 00                	push   $0x0
+  800a3f:	e8 2b 0b 00 00       	call   80156f <sys_env_destroy>
+}
+  800a44:	83 c4 10             	add    $0x10,%esp
+  800a47:	c9                   	leave
+  800a48:	c3                   	ret
+
+00800a49 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800a49:	55                   	push   %ebp
+  800a4a:	89 e5                	mov    %esp,%ebp
+  800a4c:	56                   	push   %esi
+  800a4d:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  800a4e:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  800a51:	8b 35 1c 60 80 00    	mov    0x80601c,%esi
+  800a57:	e8 54 0b 00 00       	call   8015b0 <sys_getenvid>
+  800a5c:	83 ec 0c             	sub    $0xc,%esp
+  800a5f:	ff 75 0c             	push   0xc(%ebp)
+  800a62:	ff 75 08             	push   0x8(%ebp)
+  800a65:	56                   	push   %esi
+  800a66:	50                   	push   %eax
+  800a67:	68 a0 4e 80 00       	push   $0x804ea0
+  800a6c:	e8 b3 00 00 00       	call   800b24 <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  800a71:	83 c4 18             	add    $0x18,%esp
+  800a74:	53                   	push   %ebx
+  800a75:	ff 75 10             	push   0x10(%ebp)
+  800a78:	e8 56 00 00 00       	call   800ad3 <vcprintf>
+  cprintf("\n");
+  800a7d:	c7 04 24 a0 4c 80 00 	movl   $0x804ca0,(%esp)
+  800a84:	e8 9b 00 00 00       	call   800b24 <cprintf>
+  800a89:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  800a8c:	cc                   	int3
+  while (1)
+  800a8d:	eb fd                	jmp    800a8c <_panic+0x43>
+
+00800a8f <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800a8f:	55                   	push   %ebp
+  800a90:	89 e5                	mov    %esp,%ebp
+  800a92:	53                   	push   %ebx
+  800a93:	83 ec 04             	sub    $0x4,%esp
+  800a96:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  800a99:	8b 13                	mov    (%ebx),%edx
+  800a9b:	8d 42 01             	lea    0x1(%edx),%eax
+  800a9e:	89 03                	mov    %eax,(%ebx)
+  800aa0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800aa3:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  800aa7:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800aac:	74 09                	je     800ab7 <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  800aae:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800ab2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ab5:	c9                   	leave
+  800ab6:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  800ab7:	83 ec 08             	sub    $0x8,%esp
+  800aba:	68 ff 00 00 00       	push   $0xff
+  800abf:	8d 43 08             	lea    0x8(%ebx),%eax
+  800ac2:	50                   	push   %eax
+  800ac3:	e8 6a 0a 00 00       	call   801532 <sys_cputs>
+    b->idx = 0;
+  800ac8:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800ace:	83 c4 10             	add    $0x10,%esp
+  800ad1:	eb db                	jmp    800aae <putch+0x1f>
+
+00800ad3 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800ad3:	55                   	push   %ebp
+  800ad4:	89 e5                	mov    %esp,%ebp
+  800ad6:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  800adc:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800ae3:	00 00 00 
+  b.cnt = 0;
+  800ae6:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800aed:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  800af0:	ff 75 0c             	push   0xc(%ebp)
+  800af3:	ff 75 08             	push   0x8(%ebp)
+  800af6:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800afc:	50                   	push   %eax
+  800afd:	68 8f 0a 80 00       	push   $0x800a8f
+  800b02:	e8 14 01 00 00       	call   800c1b <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  800b07:	83 c4 08             	add    $0x8,%esp
+  800b0a:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800b10:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800b16:	50                   	push   %eax
+  800b17:	e8 16 0a 00 00       	call   801532 <sys_cputs>
+
+  return b.cnt;
+}
+  800b1c:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800b22:	c9                   	leave
+  800b23:	c3                   	ret
+
+00800b24 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800b24:	55                   	push   %ebp
+  800b25:	89 e5                	mov    %esp,%ebp
+  800b27:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  800b2a:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  800b2d:	50                   	push   %eax
+  800b2e:	ff 75 08             	push   0x8(%ebp)
+  800b31:	e8 9d ff ff ff       	call   800ad3 <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  800b36:	c9                   	leave
+  800b37:	c3                   	ret
+
+00800b38 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  800b38:	55                   	push   %ebp
+  800b39:	89 e5                	mov    %esp,%ebp
+  800b3b:	57                   	push   %edi
+  800b3c:	56                   	push   %esi
+  800b3d:	53                   	push   %ebx
+  800b3e:	83 ec 1c             	sub    $0x1c,%esp
+  800b41:	89 c7                	mov    %eax,%edi
+  800b43:	89 d6                	mov    %edx,%esi
+  800b45:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b48:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800b4b:	89 d1                	mov    %edx,%ecx
+  800b4d:	89 c2                	mov    %eax,%edx
+  800b4f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800b52:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800b55:	8b 45 10             	mov    0x10(%ebp),%eax
+  800b58:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  800b5b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800b5e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800b65:	39 c2                	cmp    %eax,%edx
+  800b67:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800b6a:	72 3e                	jb     800baa <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  800b6c:	83 ec 0c             	sub    $0xc,%esp
+  800b6f:	ff 75 18             	push   0x18(%ebp)
+  800b72:	83 eb 01             	sub    $0x1,%ebx
+  800b75:	53                   	push   %ebx
+  800b76:	50                   	push   %eax
+  800b77:	83 ec 08             	sub    $0x8,%esp
+  800b7a:	ff 75 e4             	push   -0x1c(%ebp)
+  800b7d:	ff 75 e0             	push   -0x20(%ebp)
+  800b80:	ff 75 dc             	push   -0x24(%ebp)
+  800b83:	ff 75 d8             	push   -0x28(%ebp)
+  800b86:	e8 67 3f 00 00       	call   804af2 <__udivdi3>
+  800b8b:	83 c4 18             	add    $0x18,%esp
+  800b8e:	52                   	push   %edx
+  800b8f:	50                   	push   %eax
+  800b90:	89 f2                	mov    %esi,%edx
+  800b92:	89 f8                	mov    %edi,%eax
+  800b94:	e8 9f ff ff ff       	call   800b38 <printnum>
+  800b99:	83 c4 20             	add    $0x20,%esp
+  800b9c:	eb 13                	jmp    800bb1 <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  800b9e:	83 ec 08             	sub    $0x8,%esp
+  800ba1:	56                   	push   %esi
+  800ba2:	ff 75 18             	push   0x18(%ebp)
+  800ba5:	ff d7                	call   *%edi
+  800ba7:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  800baa:	83 eb 01             	sub    $0x1,%ebx
+  800bad:	85 db                	test   %ebx,%ebx
+  800baf:	7f ed                	jg     800b9e <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  800bb1:	83 ec 08             	sub    $0x8,%esp
+  800bb4:	56                   	push   %esi
+  800bb5:	83 ec 04             	sub    $0x4,%esp
+  800bb8:	ff 75 e4             	push   -0x1c(%ebp)
+  800bbb:	ff 75 e0             	push   -0x20(%ebp)
+  800bbe:	ff 75 dc             	push   -0x24(%ebp)
+  800bc1:	ff 75 d8             	push   -0x28(%ebp)
+  800bc4:	e8 4a 3f 00 00       	call   804b13 <__umoddi3>
+  800bc9:	83 c4 14             	add    $0x14,%esp
+  800bcc:	0f be 80 c3 4e 80 00 	movsbl 0x804ec3(%eax),%eax
+  800bd3:	50                   	push   %eax
+  800bd4:	ff d7                	call   *%edi
+}
+  800bd6:	83 c4 10             	add    $0x10,%esp
+  800bd9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bdc:	5b                   	pop    %ebx
+  800bdd:	5e                   	pop    %esi
+  800bde:	5f                   	pop    %edi
+  800bdf:	5d                   	pop    %ebp
+  800be0:	c3                   	ret
+
+00800be1 <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800be1:	55                   	push   %ebp
+  800be2:	89 e5                	mov    %esp,%ebp
+  800be4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  800be7:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  800beb:	8b 10                	mov    (%eax),%edx
+  800bed:	3b 50 04             	cmp    0x4(%eax),%edx
+  800bf0:	73 0a                	jae    800bfc <sprintputch+0x1b>
+    *b->buf++ = ch;
+  800bf2:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800bf5:	89 08                	mov    %ecx,(%eax)
+  800bf7:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bfa:	88 02                	mov    %al,(%edx)
+}
+  800bfc:	5d                   	pop    %ebp
+  800bfd:	c3                   	ret
+
+00800bfe <printfmt>:
+{
+  800bfe:	55                   	push   %ebp
+  800bff:	89 e5                	mov    %esp,%ebp
+  800c01:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  800c04:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  800c07:	50                   	push   %eax
+  800c08:	ff 75 10             	push   0x10(%ebp)
+  800c0b:	ff 75 0c             	push   0xc(%ebp)
+  800c0e:	ff 75 08             	push   0x8(%ebp)
+  800c11:	e8 05 00 00 00       	call   800c1b <vprintfmt>
+}
+  800c16:	83 c4 10             	add    $0x10,%esp
+  800c19:	c9                   	leave
+  800c1a:	c3                   	ret
+
+00800c1b <vprintfmt>:
+{
+  800c1b:	55                   	push   %ebp
+  800c1c:	89 e5                	mov    %esp,%ebp
+  800c1e:	57                   	push   %edi
+  800c1f:	56                   	push   %esi
+  800c20:	53                   	push   %ebx
+  800c21:	83 ec 2c             	sub    $0x2c,%esp
+  800c24:	8b 75 08             	mov    0x8(%ebp),%esi
+  800c27:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800c2a:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800c2d:	eb 0a                	jmp    800c39 <vprintfmt+0x1e>
+      putch(ch, putdat);
+  800c2f:	83 ec 08             	sub    $0x8,%esp
+  800c32:	53                   	push   %ebx
+  800c33:	50                   	push   %eax
+  800c34:	ff d6                	call   *%esi
+  800c36:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  800c39:	83 c7 01             	add    $0x1,%edi
+  800c3c:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800c40:	83 f8 25             	cmp    $0x25,%eax
+  800c43:	74 0c                	je     800c51 <vprintfmt+0x36>
+      if (ch == '\0')
+  800c45:	85 c0                	test   %eax,%eax
+  800c47:	75 e6                	jne    800c2f <vprintfmt+0x14>
+}
+  800c49:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c4c:	5b                   	pop    %ebx
+  800c4d:	5e                   	pop    %esi
+  800c4e:	5f                   	pop    %edi
+  800c4f:	5d                   	pop    %ebp
+  800c50:	c3                   	ret
+    padc = ' ';
+  800c51:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  800c55:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  800c5c:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  800c63:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  800c6a:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  800c6f:	8d 47 01             	lea    0x1(%edi),%eax
+  800c72:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800c75:	0f b6 17             	movzbl (%edi),%edx
+  800c78:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800c7b:	3c 55                	cmp    $0x55,%al
+  800c7d:	0f 87 cf 03 00 00    	ja     801052 <vprintfmt+0x437>
+  800c83:	0f b6 c0             	movzbl %al,%eax
+  800c86:	ff 24 85 00 50 80 00 	jmp    *0x805000(,%eax,4)
+  800c8d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  800c90:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800c94:	eb d9                	jmp    800c6f <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  800c96:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800c99:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800c9d:	eb d0                	jmp    800c6f <vprintfmt+0x54>
+  800c9f:	0f b6 d2             	movzbl %dl,%edx
+  800ca2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  800ca5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800caa:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  800cad:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800cb0:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  800cb4:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  800cb7:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800cba:	83 f9 09             	cmp    $0x9,%ecx
+  800cbd:	77 55                	ja     800d14 <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  800cbf:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  800cc2:	eb e9                	jmp    800cad <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  800cc4:	8b 45 14             	mov    0x14(%ebp),%eax
+  800cc7:	8b 00                	mov    (%eax),%eax
+  800cc9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800ccc:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ccf:	8d 40 04             	lea    0x4(%eax),%eax
+  800cd2:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  800cd5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  800cd8:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800cdc:	79 91                	jns    800c6f <vprintfmt+0x54>
+        width = precision, precision = -1;
+  800cde:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800ce1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800ce4:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800ceb:	eb 82                	jmp    800c6f <vprintfmt+0x54>
+      if (width < 0)
+  800ced:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800cf0:	85 d2                	test   %edx,%edx
+  800cf2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cf7:	0f 49 c2             	cmovns %edx,%eax
+  800cfa:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  800cfd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  800d00:	e9 6a ff ff ff       	jmp    800c6f <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  800d05:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  800d08:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  800d0f:	e9 5b ff ff ff       	jmp    800c6f <vprintfmt+0x54>
+  800d14:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800d17:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800d1a:	eb bc                	jmp    800cd8 <vprintfmt+0xbd>
+      lflag++;
+  800d1c:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  800d1f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  800d22:	e9 48 ff ff ff       	jmp    800c6f <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  800d27:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d2a:	8d 78 04             	lea    0x4(%eax),%edi
+  800d2d:	83 ec 08             	sub    $0x8,%esp
+  800d30:	53                   	push   %ebx
+  800d31:	ff 30                	push   (%eax)
+  800d33:	ff d6                	call   *%esi
+      break;
+  800d35:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  800d38:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  800d3b:	e9 b1 02 00 00       	jmp    800ff1 <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  800d40:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d43:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  800d46:	8b 10                	mov    (%eax),%edx
+  800d48:	89 d0                	mov    %edx,%eax
+  800d4a:	f7 d8                	neg    %eax
+  800d4c:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800d4f:	83 f8 10             	cmp    $0x10,%eax
+  800d52:	7f 23                	jg     800d77 <vprintfmt+0x15c>
+  800d54:	8b 14 85 60 51 80 00 	mov    0x805160(,%eax,4),%edx
+  800d5b:	85 d2                	test   %edx,%edx
+  800d5d:	74 18                	je     800d77 <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  800d5f:	52                   	push   %edx
+  800d60:	68 e1 4d 80 00       	push   $0x804de1
+  800d65:	53                   	push   %ebx
+  800d66:	56                   	push   %esi
+  800d67:	e8 92 fe ff ff       	call   800bfe <printfmt>
+  800d6c:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  800d6f:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800d72:	e9 7a 02 00 00       	jmp    800ff1 <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  800d77:	50                   	push   %eax
+  800d78:	68 db 4e 80 00       	push   $0x804edb
+  800d7d:	53                   	push   %ebx
+  800d7e:	56                   	push   %esi
+  800d7f:	e8 7a fe ff ff       	call   800bfe <printfmt>
+  800d84:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  800d87:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  800d8a:	e9 62 02 00 00       	jmp    800ff1 <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  800d8f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d92:	83 c0 04             	add    $0x4,%eax
+  800d95:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800d98:	8b 45 14             	mov    0x14(%ebp),%eax
+  800d9b:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  800d9d:	85 c9                	test   %ecx,%ecx
+  800d9f:	b8 d4 4e 80 00       	mov    $0x804ed4,%eax
+  800da4:	0f 45 c1             	cmovne %ecx,%eax
+  800da7:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  800daa:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800dae:	7e 06                	jle    800db6 <vprintfmt+0x19b>
+  800db0:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800db4:	75 0b                	jne    800dc1 <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800db6:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800db9:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800dbc:	89 75 08             	mov    %esi,0x8(%ebp)
+  800dbf:	eb 5c                	jmp    800e1d <vprintfmt+0x202>
+  800dc1:	83 ec 08             	sub    $0x8,%esp
+  800dc4:	ff 75 d0             	push   -0x30(%ebp)
+  800dc7:	ff 75 cc             	push   -0x34(%ebp)
+  800dca:	e8 10 04 00 00       	call   8011df <strnlen>
+  800dcf:	89 c2                	mov    %eax,%edx
+  800dd1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800dd4:	29 d0                	sub    %edx,%eax
+  800dd6:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  800dd9:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800ddd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800de0:	89 75 08             	mov    %esi,0x8(%ebp)
+  800de3:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800de5:	eb 0e                	jmp    800df5 <vprintfmt+0x1da>
+          putch(padc, putdat);
+  800de7:	83 ec 08             	sub    $0x8,%esp
+  800dea:	53                   	push   %ebx
+  800deb:	57                   	push   %edi
+  800dec:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800def:	83 ee 01             	sub    $0x1,%esi
+  800df2:	83 c4 10             	add    $0x10,%esp
+  800df5:	85 f6                	test   %esi,%esi
+  800df7:	7f ee                	jg     800de7 <vprintfmt+0x1cc>
+  800df9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800dfc:	8b 75 08             	mov    0x8(%ebp),%esi
+  800dff:	85 c0                	test   %eax,%eax
+  800e01:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e06:	0f 49 d0             	cmovns %eax,%edx
+  800e09:	29 d0                	sub    %edx,%eax
+  800e0b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800e0e:	eb a6                	jmp    800db6 <vprintfmt+0x19b>
+          putch(ch, putdat);
+  800e10:	83 ec 08             	sub    $0x8,%esp
+  800e13:	53                   	push   %ebx
+  800e14:	52                   	push   %edx
+  800e15:	ff 55 08             	call   *0x8(%ebp)
+  800e18:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800e1b:	89 f1                	mov    %esi,%ecx
+  800e1d:	8d 71 01             	lea    0x1(%ecx),%esi
+  800e20:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800e24:	0f be d0             	movsbl %al,%edx
+  800e27:	85 d2                	test   %edx,%edx
+  800e29:	74 28                	je     800e53 <vprintfmt+0x238>
+  800e2b:	85 ff                	test   %edi,%edi
+  800e2d:	78 05                	js     800e34 <vprintfmt+0x219>
+  800e2f:	83 ef 01             	sub    $0x1,%edi
+  800e32:	78 30                	js     800e64 <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  800e34:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800e38:	74 d6                	je     800e10 <vprintfmt+0x1f5>
+  800e3a:	0f be c0             	movsbl %al,%eax
+  800e3d:	83 e8 20             	sub    $0x20,%eax
+  800e40:	83 f8 5e             	cmp    $0x5e,%eax
+  800e43:	76 cb                	jbe    800e10 <vprintfmt+0x1f5>
+          putch('?', putdat);
+  800e45:	83 ec 08             	sub    $0x8,%esp
+  800e48:	53                   	push   %ebx
+  800e49:	6a 3f                	push   $0x3f
+  800e4b:	ff 55 08             	call   *0x8(%ebp)
+  800e4e:	83 c4 10             	add    $0x10,%esp
+  800e51:	eb c8                	jmp    800e1b <vprintfmt+0x200>
+  800e53:	8b 75 08             	mov    0x8(%ebp),%esi
+  800e56:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800e59:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800e5c:	01 d0                	add    %edx,%eax
+  800e5e:	29 c8                	sub    %ecx,%eax
+  800e60:	89 c7                	mov    %eax,%edi
+  800e62:	eb 13                	jmp    800e77 <vprintfmt+0x25c>
+  800e64:	8b 75 08             	mov    0x8(%ebp),%esi
+  800e67:	eb ed                	jmp    800e56 <vprintfmt+0x23b>
+        putch(' ', putdat);
+  800e69:	83 ec 08             	sub    $0x8,%esp
+  800e6c:	53                   	push   %ebx
+  800e6d:	6a 20                	push   $0x20
+  800e6f:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  800e71:	83 ef 01             	sub    $0x1,%edi
+  800e74:	83 c4 10             	add    $0x10,%esp
+  800e77:	85 ff                	test   %edi,%edi
+  800e79:	7f ee                	jg     800e69 <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  800e7b:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800e7e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800e81:	e9 6b 01 00 00       	jmp    800ff1 <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  800e86:	83 f9 01             	cmp    $0x1,%ecx
+  800e89:	7f 1f                	jg     800eaa <vprintfmt+0x28f>
+  else if (lflag)
+  800e8b:	85 c9                	test   %ecx,%ecx
+  800e8d:	74 67                	je     800ef6 <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  800e8f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800e92:	8b 00                	mov    (%eax),%eax
+  800e94:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800e97:	89 c1                	mov    %eax,%ecx
+  800e99:	c1 f9 1f             	sar    $0x1f,%ecx
+  800e9c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800e9f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ea2:	8d 40 04             	lea    0x4(%eax),%eax
+  800ea5:	89 45 14             	mov    %eax,0x14(%ebp)
+  800ea8:	eb 17                	jmp    800ec1 <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  800eaa:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ead:	8b 50 04             	mov    0x4(%eax),%edx
+  800eb0:	8b 00                	mov    (%eax),%eax
+  800eb2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800eb5:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800eb8:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ebb:	8d 40 08             	lea    0x8(%eax),%eax
+  800ebe:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  800ec1:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800ec4:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  800ec7:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  800ecc:	85 c9                	test   %ecx,%ecx
+  800ece:	0f 89 03 01 00 00    	jns    800fd7 <vprintfmt+0x3bc>
+        putch('-', putdat);
+  800ed4:	83 ec 08             	sub    $0x8,%esp
+  800ed7:	53                   	push   %ebx
+  800ed8:	6a 2d                	push   $0x2d
+  800eda:	ff d6                	call   *%esi
+        num = -(long long)num;
+  800edc:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800edf:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800ee2:	f7 da                	neg    %edx
+  800ee4:	83 d1 00             	adc    $0x0,%ecx
+  800ee7:	f7 d9                	neg    %ecx
+  800ee9:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  800eec:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800ef1:	e9 e1 00 00 00       	jmp    800fd7 <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  800ef6:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ef9:	8b 00                	mov    (%eax),%eax
+  800efb:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800efe:	89 c1                	mov    %eax,%ecx
+  800f00:	c1 f9 1f             	sar    $0x1f,%ecx
+  800f03:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800f06:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f09:	8d 40 04             	lea    0x4(%eax),%eax
+  800f0c:	89 45 14             	mov    %eax,0x14(%ebp)
+  800f0f:	eb b0                	jmp    800ec1 <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  800f11:	83 f9 01             	cmp    $0x1,%ecx
+  800f14:	7f 1e                	jg     800f34 <vprintfmt+0x319>
+  else if (lflag)
+  800f16:	85 c9                	test   %ecx,%ecx
+  800f18:	74 32                	je     800f4c <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  800f1a:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f1d:	8b 10                	mov    (%eax),%edx
+  800f1f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f24:	8d 40 04             	lea    0x4(%eax),%eax
+  800f27:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800f2a:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  800f2f:	e9 a3 00 00 00       	jmp    800fd7 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800f34:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f37:	8b 10                	mov    (%eax),%edx
+  800f39:	8b 48 04             	mov    0x4(%eax),%ecx
+  800f3c:	8d 40 08             	lea    0x8(%eax),%eax
+  800f3f:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800f42:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  800f47:	e9 8b 00 00 00       	jmp    800fd7 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800f4c:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f4f:	8b 10                	mov    (%eax),%edx
+  800f51:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f56:	8d 40 04             	lea    0x4(%eax),%eax
+  800f59:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800f5c:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  800f61:	eb 74                	jmp    800fd7 <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  800f63:	83 f9 01             	cmp    $0x1,%ecx
+  800f66:	7f 1b                	jg     800f83 <vprintfmt+0x368>
+  else if (lflag)
+  800f68:	85 c9                	test   %ecx,%ecx
+  800f6a:	74 2c                	je     800f98 <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  800f6c:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f6f:	8b 10                	mov    (%eax),%edx
+  800f71:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f76:	8d 40 04             	lea    0x4(%eax),%eax
+  800f79:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800f7c:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  800f81:	eb 54                	jmp    800fd7 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800f83:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f86:	8b 10                	mov    (%eax),%edx
+  800f88:	8b 48 04             	mov    0x4(%eax),%ecx
+  800f8b:	8d 40 08             	lea    0x8(%eax),%eax
+  800f8e:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800f91:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  800f96:	eb 3f                	jmp    800fd7 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800f98:	8b 45 14             	mov    0x14(%ebp),%eax
+  800f9b:	8b 10                	mov    (%eax),%edx
+  800f9d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fa2:	8d 40 04             	lea    0x4(%eax),%eax
+  800fa5:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800fa8:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  800fad:	eb 28                	jmp    800fd7 <vprintfmt+0x3bc>
+      putch('0', putdat);
+  800faf:	83 ec 08             	sub    $0x8,%esp
+  800fb2:	53                   	push   %ebx
+  800fb3:	6a 30                	push   $0x30
+  800fb5:	ff d6                	call   *%esi
+      putch('x', putdat);
+  800fb7:	83 c4 08             	add    $0x8,%esp
+  800fba:	53                   	push   %ebx
+  800fbb:	6a 78                	push   $0x78
+  800fbd:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  800fbf:	8b 45 14             	mov    0x14(%ebp),%eax
+  800fc2:	8b 10                	mov    (%eax),%edx
+  800fc4:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  800fc9:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  800fcc:	8d 40 04             	lea    0x4(%eax),%eax
+  800fcf:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800fd2:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  800fd7:	83 ec 0c             	sub    $0xc,%esp
+  800fda:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800fde:	50                   	push   %eax
+  800fdf:	ff 75 e0             	push   -0x20(%ebp)
+  800fe2:	57                   	push   %edi
+  800fe3:	51                   	push   %ecx
+  800fe4:	52                   	push   %edx
+  800fe5:	89 da                	mov    %ebx,%edx
+  800fe7:	89 f0                	mov    %esi,%eax
+  800fe9:	e8 4a fb ff ff       	call   800b38 <printnum>
+      break;
+  800fee:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  800ff1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  800ff4:	e9 40 fc ff ff       	jmp    800c39 <vprintfmt+0x1e>
+  if (lflag >= 2)
+  800ff9:	83 f9 01             	cmp    $0x1,%ecx
+  800ffc:	7f 1b                	jg     801019 <vprintfmt+0x3fe>
+  else if (lflag)
+  800ffe:	85 c9                	test   %ecx,%ecx
+  801000:	74 2c                	je     80102e <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  801002:	8b 45 14             	mov    0x14(%ebp),%eax
+  801005:	8b 10                	mov    (%eax),%edx
+  801007:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80100c:	8d 40 04             	lea    0x4(%eax),%eax
+  80100f:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  801012:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  801017:	eb be                	jmp    800fd7 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  801019:	8b 45 14             	mov    0x14(%ebp),%eax
+  80101c:	8b 10                	mov    (%eax),%edx
+  80101e:	8b 48 04             	mov    0x4(%eax),%ecx
+  801021:	8d 40 08             	lea    0x8(%eax),%eax
+  801024:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  801027:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  80102c:	eb a9                	jmp    800fd7 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  80102e:	8b 45 14             	mov    0x14(%ebp),%eax
+  801031:	8b 10                	mov    (%eax),%edx
+  801033:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801038:	8d 40 04             	lea    0x4(%eax),%eax
+  80103b:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  80103e:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  801043:	eb 92                	jmp    800fd7 <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  801045:	83 ec 08             	sub    $0x8,%esp
+  801048:	53                   	push   %ebx
+  801049:	6a 25                	push   $0x25
+  80104b:	ff d6                	call   *%esi
+      break;
+  80104d:	83 c4 10             	add    $0x10,%esp
+  801050:	eb 9f                	jmp    800ff1 <vprintfmt+0x3d6>
+      putch('%', putdat);
+  801052:	83 ec 08             	sub    $0x8,%esp
+  801055:	53                   	push   %ebx
+  801056:	6a 25                	push   $0x25
+  801058:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  80105a:	83 c4 10             	add    $0x10,%esp
+  80105d:	89 f8                	mov    %edi,%eax
+  80105f:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  801063:	74 05                	je     80106a <vprintfmt+0x44f>
+  801065:	83 e8 01             	sub    $0x1,%eax
+  801068:	eb f5                	jmp    80105f <vprintfmt+0x444>
+  80106a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80106d:	eb 82                	jmp    800ff1 <vprintfmt+0x3d6>
+
+0080106f <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80106f:	55                   	push   %ebp
+  801070:	89 e5                	mov    %esp,%ebp
+  801072:	83 ec 18             	sub    $0x18,%esp
+  801075:	8b 45 08             	mov    0x8(%ebp),%eax
+  801078:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  80107b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80107e:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  801082:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  801085:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  80108c:	85 c0                	test   %eax,%eax
+  80108e:	74 26                	je     8010b6 <vsnprintf+0x47>
+  801090:	85 d2                	test   %edx,%edx
+  801092:	7e 22                	jle    8010b6 <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  801094:	ff 75 14             	push   0x14(%ebp)
+  801097:	ff 75 10             	push   0x10(%ebp)
+  80109a:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80109d:	50                   	push   %eax
+  80109e:	68 e1 0b 80 00       	push   $0x800be1
+  8010a3:	e8 73 fb ff ff       	call   800c1b <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  8010a8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8010ab:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  8010ae:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8010b1:	83 c4 10             	add    $0x10,%esp
+}
+  8010b4:	c9                   	leave
+  8010b5:	c3                   	ret
+    return -E_INVAL;
+  8010b6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8010bb:	eb f7                	jmp    8010b4 <vsnprintf+0x45>
+
+008010bd <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8010bd:	55                   	push   %ebp
+  8010be:	89 e5                	mov    %esp,%ebp
+  8010c0:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  8010c3:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  8010c6:	50                   	push   %eax
+  8010c7:	ff 75 10             	push   0x10(%ebp)
+  8010ca:	ff 75 0c             	push   0xc(%ebp)
+  8010cd:	ff 75 08             	push   0x8(%ebp)
+  8010d0:	e8 9a ff ff ff       	call   80106f <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  8010d5:	c9                   	leave
+  8010d6:	c3                   	ret
+
+008010d7 <readline>:
+#define BUFLEN 1024
+static char buf[BUFLEN];
+
+char *
+readline(const char *prompt)
+{
+  8010d7:	55                   	push   %ebp
+  8010d8:	89 e5                	mov    %esp,%ebp
+  8010da:	57                   	push   %edi
+  8010db:	56                   	push   %esi
+  8010dc:	53                   	push   %ebx
+  8010dd:	83 ec 0c             	sub    $0xc,%esp
+  8010e0:	8b 45 08             	mov    0x8(%ebp),%eax
+
+#if JOS_KERNEL
+  if (prompt != NULL)
+    cprintf("%s", prompt);
+#else
+  if (prompt != NULL)
+  8010e3:	85 c0                	test   %eax,%eax
+  8010e5:	74 13                	je     8010fa <readline+0x23>
+    fprintf(1, "%s", prompt);
+  8010e7:	83 ec 04             	sub    $0x4,%esp
+  8010ea:	50                   	push   %eax
+  8010eb:	68 e1 4d 80 00       	push   $0x804de1
+  8010f0:	6a 01                	push   $0x1
+  8010f2:	e8 84 20 00 00       	call   80317b <fprintf>
+  8010f7:	83 c4 10             	add    $0x10,%esp
+#endif
+
+  i = 0;
+  echoing = iscons(0);
+  8010fa:	83 ec 0c             	sub    $0xc,%esp
+  8010fd:	6a 00                	push   $0x0
+  8010ff:	e8 5a f8 ff ff       	call   80095e <iscons>
+  801104:	89 c7                	mov    %eax,%edi
+  801106:	83 c4 10             	add    $0x10,%esp
+  i = 0;
+  801109:	be 00 00 00 00       	mov    $0x0,%esi
+  80110e:	eb 4b                	jmp    80115b <readline+0x84>
+  while (1) {
+    c = getchar();
+    if (c < 0) {
+      if (c != -E_EOF)
+        cprintf("read error: %e\n", c);
+      return NULL;
+  801110:	b8 00 00 00 00       	mov    $0x0,%eax
+      if (c != -E_EOF)
+  801115:	83 fb f8             	cmp    $0xfffffff8,%ebx
+  801118:	75 08                	jne    801122 <readline+0x4b>
+        cputchar('\n');
+      buf[i] = 0;
+      return buf;
+    }
+  }
+}
+  80111a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80111d:	5b                   	pop    %ebx
+  80111e:	5e                   	pop    %esi
+  80111f:	5f                   	pop    %edi
+  801120:	5d                   	pop    %ebp
+  801121:	c3                   	ret
+        cprintf("read error: %e\n", c);
+  801122:	83 ec 08             	sub    $0x8,%esp
+  801125:	53                   	push   %ebx
+  801126:	68 c3 51 80 00       	push   $0x8051c3
+  80112b:	e8 f4 f9 ff ff       	call   800b24 <cprintf>
+  801130:	83 c4 10             	add    $0x10,%esp
+      return NULL;
+  801133:	b8 00 00 00 00       	mov    $0x0,%eax
+  801138:	eb e0                	jmp    80111a <readline+0x43>
+      if (echoing)
+  80113a:	85 ff                	test   %edi,%edi
+  80113c:	75 05                	jne    801143 <readline+0x6c>
+      i--;
+  80113e:	83 ee 01             	sub    $0x1,%esi
+  801141:	eb 18                	jmp    80115b <readline+0x84>
+        cputchar('\b');
+  801143:	83 ec 0c             	sub    $0xc,%esp
+  801146:	6a 08                	push   $0x8
+  801148:	e8 cc f7 ff ff       	call   800919 <cputchar>
+  80114d:	83 c4 10             	add    $0x10,%esp
+  801150:	eb ec                	jmp    80113e <readline+0x67>
+      buf[i++] = c;
+  801152:	88 9e 20 70 80 00    	mov    %bl,0x807020(%esi)
+  801158:	8d 76 01             	lea    0x1(%esi),%esi
+    c = getchar();
+  80115b:	e8 d5 f7 ff ff       	call   800935 <getchar>
+  801160:	89 c3                	mov    %eax,%ebx
+    if (c < 0) {
+  801162:	85 c0                	test   %eax,%eax
+  801164:	78 aa                	js     801110 <readline+0x39>
+    } else if ((c == '\b' || c == '\x7f') && i > 0) {
+  801166:	83 f8 08             	cmp    $0x8,%eax
+  801169:	0f 94 c0             	sete   %al
+  80116c:	83 fb 7f             	cmp    $0x7f,%ebx
+  80116f:	0f 94 c2             	sete   %dl
+  801172:	08 d0                	or     %dl,%al
+  801174:	74 04                	je     80117a <readline+0xa3>
+  801176:	85 f6                	test   %esi,%esi
+  801178:	7f c0                	jg     80113a <readline+0x63>
+    } else if (c >= ' ' && i < BUFLEN-1) {
+  80117a:	83 fb 1f             	cmp    $0x1f,%ebx
+  80117d:	7e 1a                	jle    801199 <readline+0xc2>
+  80117f:	81 fe fe 03 00 00    	cmp    $0x3fe,%esi
+  801185:	7f 12                	jg     801199 <readline+0xc2>
+      if (echoing)
+  801187:	85 ff                	test   %edi,%edi
+  801189:	74 c7                	je     801152 <readline+0x7b>
+        cputchar(c);
+  80118b:	83 ec 0c             	sub    $0xc,%esp
+  80118e:	53                   	push   %ebx
+  80118f:	e8 85 f7 ff ff       	call   800919 <cputchar>
+  801194:	83 c4 10             	add    $0x10,%esp
+  801197:	eb b9                	jmp    801152 <readline+0x7b>
+    } else if (c == '\n' || c == '\r') {
+  801199:	83 fb 0a             	cmp    $0xa,%ebx
+  80119c:	74 05                	je     8011a3 <readline+0xcc>
+  80119e:	83 fb 0d             	cmp    $0xd,%ebx
+  8011a1:	75 b8                	jne    80115b <readline+0x84>
+      if (echoing)
+  8011a3:	85 ff                	test   %edi,%edi
+  8011a5:	75 11                	jne    8011b8 <readline+0xe1>
+      buf[i] = 0;
+  8011a7:	c6 86 20 70 80 00 00 	movb   $0x0,0x807020(%esi)
+      return buf;
+  8011ae:	b8 20 70 80 00       	mov    $0x807020,%eax
+  8011b3:	e9 62 ff ff ff       	jmp    80111a <readline+0x43>
+        cputchar('\n');
+  8011b8:	83 ec 0c             	sub    $0xc,%esp
+  8011bb:	6a 0a                	push   $0xa
+  8011bd:	e8 57 f7 ff ff       	call   800919 <cputchar>
+  8011c2:	83 c4 10             	add    $0x10,%esp
+  8011c5:	eb e0                	jmp    8011a7 <readline+0xd0>
+
+008011c7 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8011c7:	55                   	push   %ebp
+  8011c8:	89 e5                	mov    %esp,%ebp
+  8011ca:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  8011cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011d2:	eb 03                	jmp    8011d7 <strlen+0x10>
+    n++;
+  8011d4:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  8011d7:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8011db:	75 f7                	jne    8011d4 <strlen+0xd>
+  return n;
+}
+  8011dd:	5d                   	pop    %ebp
+  8011de:	c3                   	ret
+
+008011df <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8011df:	55                   	push   %ebp
+  8011e0:	89 e5                	mov    %esp,%ebp
+  8011e2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8011e5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8011e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011ed:	eb 03                	jmp    8011f2 <strnlen+0x13>
+    n++;
+  8011ef:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8011f2:	39 d0                	cmp    %edx,%eax
+  8011f4:	74 08                	je     8011fe <strnlen+0x1f>
+  8011f6:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8011fa:	75 f3                	jne    8011ef <strnlen+0x10>
+  8011fc:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  8011fe:	89 d0                	mov    %edx,%eax
+  801200:	5d                   	pop    %ebp
+  801201:	c3                   	ret
+
+00801202 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  801202:	55                   	push   %ebp
+  801203:	89 e5                	mov    %esp,%ebp
+  801205:	53                   	push   %ebx
+  801206:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801209:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  80120c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801211:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  801215:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  801218:	83 c0 01             	add    $0x1,%eax
+  80121b:	84 d2                	test   %dl,%dl
+  80121d:	75 f2                	jne    801211 <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  80121f:	89 c8                	mov    %ecx,%eax
+  801221:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801224:	c9                   	leave
+  801225:	c3                   	ret
+
+00801226 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  801226:	55                   	push   %ebp
+  801227:	89 e5                	mov    %esp,%ebp
+  801229:	53                   	push   %ebx
+  80122a:	83 ec 10             	sub    $0x10,%esp
+  80122d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  801230:	53                   	push   %ebx
+  801231:	e8 91 ff ff ff       	call   8011c7 <strlen>
+  801236:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  801239:	ff 75 0c             	push   0xc(%ebp)
+  80123c:	01 d8                	add    %ebx,%eax
+  80123e:	50                   	push   %eax
+  80123f:	e8 be ff ff ff       	call   801202 <strcpy>
+  return dst;
+}
+  801244:	89 d8                	mov    %ebx,%eax
+  801246:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801249:	c9                   	leave
+  80124a:	c3                   	ret
+
+0080124b <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  80124b:	55                   	push   %ebp
+  80124c:	89 e5                	mov    %esp,%ebp
+  80124e:	56                   	push   %esi
+  80124f:	53                   	push   %ebx
+  801250:	8b 75 08             	mov    0x8(%ebp),%esi
+  801253:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  801256:	89 f3                	mov    %esi,%ebx
+  801258:	03 5d 10             	add    0x10(%ebp),%ebx
+  80125b:	89 f0                	mov    %esi,%eax
+  80125d:	eb 0f                	jmp    80126e <strncpy+0x23>
+    *dst++ = *src;
+  80125f:	83 c0 01             	add    $0x1,%eax
+  801262:	0f b6 0a             	movzbl (%edx),%ecx
+  801265:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  801268:	80 f9 01             	cmp    $0x1,%cl
+  80126b:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  80126e:	39 d8                	cmp    %ebx,%eax
+  801270:	75 ed                	jne    80125f <strncpy+0x14>
+  }
+  return ret;
+}
+  801272:	89 f0                	mov    %esi,%eax
+  801274:	5b                   	pop    %ebx
+  801275:	5e                   	pop    %esi
+  801276:	5d                   	pop    %ebp
+  801277:	c3                   	ret
+
+00801278 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  801278:	55                   	push   %ebp
+  801279:	89 e5                	mov    %esp,%ebp
+  80127b:	56                   	push   %esi
+  80127c:	53                   	push   %ebx
+  80127d:	8b 75 08             	mov    0x8(%ebp),%esi
+  801280:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801283:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  801286:	89 f0                	mov    %esi,%eax
+  801288:	85 d2                	test   %edx,%edx
+  80128a:	74 21                	je     8012ad <strlcpy+0x35>
+  80128c:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  801290:	89 f2                	mov    %esi,%edx
+  801292:	eb 09                	jmp    80129d <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  801294:	83 c1 01             	add    $0x1,%ecx
+  801297:	83 c2 01             	add    $0x1,%edx
+  80129a:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  80129d:	39 c2                	cmp    %eax,%edx
+  80129f:	74 09                	je     8012aa <strlcpy+0x32>
+  8012a1:	0f b6 19             	movzbl (%ecx),%ebx
+  8012a4:	84 db                	test   %bl,%bl
+  8012a6:	75 ec                	jne    801294 <strlcpy+0x1c>
+  8012a8:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  8012aa:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  8012ad:	29 f0                	sub    %esi,%eax
+}
+  8012af:	5b                   	pop    %ebx
+  8012b0:	5e                   	pop    %esi
+  8012b1:	5d                   	pop    %ebp
+  8012b2:	c3                   	ret
+
+008012b3 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8012b3:	55                   	push   %ebp
+  8012b4:	89 e5                	mov    %esp,%ebp
+  8012b6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8012b9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  8012bc:	eb 06                	jmp    8012c4 <strcmp+0x11>
+    p++, q++;
+  8012be:	83 c1 01             	add    $0x1,%ecx
+  8012c1:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  8012c4:	0f b6 01             	movzbl (%ecx),%eax
+  8012c7:	84 c0                	test   %al,%al
+  8012c9:	74 04                	je     8012cf <strcmp+0x1c>
+  8012cb:	3a 02                	cmp    (%edx),%al
+  8012cd:	74 ef                	je     8012be <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  8012cf:	0f b6 c0             	movzbl %al,%eax
+  8012d2:	0f b6 12             	movzbl (%edx),%edx
+  8012d5:	29 d0                	sub    %edx,%eax
+}
+  8012d7:	5d                   	pop    %ebp
+  8012d8:	c3                   	ret
+
+008012d9 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8012d9:	55                   	push   %ebp
+  8012da:	89 e5                	mov    %esp,%ebp
+  8012dc:	53                   	push   %ebx
+  8012dd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8012e0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012e3:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  8012e6:	eb 09                	jmp    8012f1 <strncmp+0x18>
+    n--, p++, q++;
+  8012e8:	83 ea 01             	sub    $0x1,%edx
+  8012eb:	83 c0 01             	add    $0x1,%eax
+  8012ee:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  8012f1:	85 d2                	test   %edx,%edx
+  8012f3:	74 18                	je     80130d <strncmp+0x34>
+  8012f5:	0f b6 18             	movzbl (%eax),%ebx
+  8012f8:	84 db                	test   %bl,%bl
+  8012fa:	74 04                	je     801300 <strncmp+0x27>
+  8012fc:	3a 19                	cmp    (%ecx),%bl
+  8012fe:	74 e8                	je     8012e8 <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801300:	0f b6 00             	movzbl (%eax),%eax
+  801303:	0f b6 11             	movzbl (%ecx),%edx
+  801306:	29 d0                	sub    %edx,%eax
+}
+  801308:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80130b:	c9                   	leave
+  80130c:	c3                   	ret
+    return 0;
+  80130d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801312:	eb f4                	jmp    801308 <strncmp+0x2f>
+
+00801314 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  801314:	55                   	push   %ebp
+  801315:	89 e5                	mov    %esp,%ebp
+  801317:	8b 45 08             	mov    0x8(%ebp),%eax
+  80131a:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  80131e:	eb 03                	jmp    801323 <strchr+0xf>
+  801320:	83 c0 01             	add    $0x1,%eax
+  801323:	0f b6 10             	movzbl (%eax),%edx
+  801326:	84 d2                	test   %dl,%dl
+  801328:	74 06                	je     801330 <strchr+0x1c>
+    if (*s == c)
+  80132a:	38 ca                	cmp    %cl,%dl
+  80132c:	75 f2                	jne    801320 <strchr+0xc>
+  80132e:	eb 05                	jmp    801335 <strchr+0x21>
+      return (char*)s;
+  return 0;
+  801330:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801335:	5d                   	pop    %ebp
+  801336:	c3                   	ret
+
+00801337 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  801337:	55                   	push   %ebp
+  801338:	89 e5                	mov    %esp,%ebp
+  80133a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80133d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  801341:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  801344:	38 ca                	cmp    %cl,%dl
+  801346:	74 09                	je     801351 <strfind+0x1a>
+  801348:	84 d2                	test   %dl,%dl
+  80134a:	74 05                	je     801351 <strfind+0x1a>
+  for (; *s; s++)
+  80134c:	83 c0 01             	add    $0x1,%eax
+  80134f:	eb f0                	jmp    801341 <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  801351:	5d                   	pop    %ebp
+  801352:	c3                   	ret
+
+00801353 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  801353:	55                   	push   %ebp
+  801354:	89 e5                	mov    %esp,%ebp
+  801356:	57                   	push   %edi
+  801357:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80135a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  80135d:	85 c9                	test   %ecx,%ecx
+  80135f:	74 20                	je     801381 <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  801361:	89 f8                	mov    %edi,%eax
+  801363:	09 c8                	or     %ecx,%eax
+  801365:	a8 03                	test   $0x3,%al
+  801367:	75 12                	jne    80137b <memset+0x28>
+    c &= 0xFF;
+  801369:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80136d:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  801373:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  801376:	fc                   	cld
+  801377:	f3 ab                	rep stos %eax,%es:(%edi)
+  801379:	eb 06                	jmp    801381 <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  80137b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80137e:	fc                   	cld
+  80137f:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  801381:	89 f8                	mov    %edi,%eax
+  801383:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  801386:	c9                   	leave
+  801387:	c3                   	ret
+
+00801388 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  801388:	55                   	push   %ebp
+  801389:	89 e5                	mov    %esp,%ebp
+  80138b:	57                   	push   %edi
+  80138c:	56                   	push   %esi
+  80138d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801390:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801393:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  801396:	39 c6                	cmp    %eax,%esi
+  801398:	73 32                	jae    8013cc <memmove+0x44>
+  80139a:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80139d:	39 d0                	cmp    %edx,%eax
+  80139f:	73 2b                	jae    8013cc <memmove+0x44>
+    s += n;
+    d += n;
+  8013a1:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8013a4:	89 d6                	mov    %edx,%esi
+  8013a6:	09 fe                	or     %edi,%esi
+  8013a8:	09 ce                	or     %ecx,%esi
+  8013aa:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8013b0:	75 0e                	jne    8013c0 <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8013b2:	83 ef 04             	sub    $0x4,%edi
+  8013b5:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8013b8:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  8013bb:	fd                   	std
+  8013bc:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8013be:	eb 09                	jmp    8013c9 <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8013c0:	83 ef 01             	sub    $0x1,%edi
+  8013c3:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  8013c6:	fd                   	std
+  8013c7:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  8013c9:	fc                   	cld
+  8013ca:	eb 1a                	jmp    8013e6 <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8013cc:	89 f2                	mov    %esi,%edx
+  8013ce:	09 c2                	or     %eax,%edx
+  8013d0:	09 ca                	or     %ecx,%edx
+  8013d2:	f6 c2 03             	test   $0x3,%dl
+  8013d5:	75 0a                	jne    8013e1 <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8013d7:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  8013da:	89 c7                	mov    %eax,%edi
+  8013dc:	fc                   	cld
+  8013dd:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8013df:	eb 05                	jmp    8013e6 <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  8013e1:	89 c7                	mov    %eax,%edi
+  8013e3:	fc                   	cld
+  8013e4:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  8013e6:	5e                   	pop    %esi
+  8013e7:	5f                   	pop    %edi
+  8013e8:	5d                   	pop    %ebp
+  8013e9:	c3                   	ret
+
+008013ea <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8013ea:	55                   	push   %ebp
+  8013eb:	89 e5                	mov    %esp,%ebp
+  8013ed:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  8013f0:	ff 75 10             	push   0x10(%ebp)
+  8013f3:	ff 75 0c             	push   0xc(%ebp)
+  8013f6:	ff 75 08             	push   0x8(%ebp)
+  8013f9:	e8 8a ff ff ff       	call   801388 <memmove>
+}
+  8013fe:	c9                   	leave
+  8013ff:	c3                   	ret
+
+00801400 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  801400:	55                   	push   %ebp
+  801401:	89 e5                	mov    %esp,%ebp
+  801403:	56                   	push   %esi
+  801404:	53                   	push   %ebx
+  801405:	8b 45 08             	mov    0x8(%ebp),%eax
+  801408:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  80140b:	89 c6                	mov    %eax,%esi
+  80140d:	03 75 10             	add    0x10(%ebp),%esi
+  801410:	eb 06                	jmp    801418 <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  801412:	83 c0 01             	add    $0x1,%eax
+  801415:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  801418:	39 f0                	cmp    %esi,%eax
+  80141a:	74 14                	je     801430 <memcmp+0x30>
+    if (*s1 != *s2)
+  80141c:	0f b6 08             	movzbl (%eax),%ecx
+  80141f:	0f b6 1a             	movzbl (%edx),%ebx
+  801422:	38 d9                	cmp    %bl,%cl
+  801424:	74 ec                	je     801412 <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  801426:	0f b6 c1             	movzbl %cl,%eax
+  801429:	0f b6 db             	movzbl %bl,%ebx
+  80142c:	29 d8                	sub    %ebx,%eax
+  80142e:	eb 05                	jmp    801435 <memcmp+0x35>
+  }
+
+  return 0;
+  801430:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801435:	5b                   	pop    %ebx
+  801436:	5e                   	pop    %esi
+  801437:	5d                   	pop    %ebp
+  801438:	c3                   	ret
+
+00801439 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  801439:	55                   	push   %ebp
+  80143a:	89 e5                	mov    %esp,%ebp
+  80143c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80143f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  801442:	89 c2                	mov    %eax,%edx
+  801444:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  801447:	eb 03                	jmp    80144c <memfind+0x13>
+  801449:	83 c0 01             	add    $0x1,%eax
+  80144c:	39 d0                	cmp    %edx,%eax
+  80144e:	73 04                	jae    801454 <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  801450:	38 08                	cmp    %cl,(%eax)
+  801452:	75 f5                	jne    801449 <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  801454:	5d                   	pop    %ebp
+  801455:	c3                   	ret
+
+00801456 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  801456:	55                   	push   %ebp
+  801457:	89 e5                	mov    %esp,%ebp
+  801459:	57                   	push   %edi
+  80145a:	56                   	push   %esi
+  80145b:	53                   	push   %ebx
+  80145c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80145f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  801462:	eb 03                	jmp    801467 <strtol+0x11>
+    s++;
+  801464:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  801467:	0f b6 02             	movzbl (%edx),%eax
+  80146a:	3c 20                	cmp    $0x20,%al
+  80146c:	74 f6                	je     801464 <strtol+0xe>
+  80146e:	3c 09                	cmp    $0x9,%al
+  801470:	74 f2                	je     801464 <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  801472:	3c 2b                	cmp    $0x2b,%al
+  801474:	74 2a                	je     8014a0 <strtol+0x4a>
+  int neg = 0;
+  801476:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  80147b:	3c 2d                	cmp    $0x2d,%al
+  80147d:	74 2b                	je     8014aa <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  80147f:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  801485:	75 0f                	jne    801496 <strtol+0x40>
+  801487:	80 3a 30             	cmpb   $0x30,(%edx)
+  80148a:	74 28                	je     8014b4 <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  80148c:	85 db                	test   %ebx,%ebx
+  80148e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801493:	0f 44 d8             	cmove  %eax,%ebx
+  801496:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80149b:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  80149e:	eb 46                	jmp    8014e6 <strtol+0x90>
+    s++;
+  8014a0:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  8014a3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014a8:	eb d5                	jmp    80147f <strtol+0x29>
+    s++, neg = 1;
+  8014aa:	83 c2 01             	add    $0x1,%edx
+  8014ad:	bf 01 00 00 00       	mov    $0x1,%edi
+  8014b2:	eb cb                	jmp    80147f <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8014b4:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8014b8:	74 0e                	je     8014c8 <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  8014ba:	85 db                	test   %ebx,%ebx
+  8014bc:	75 d8                	jne    801496 <strtol+0x40>
+    s++, base = 8;
+  8014be:	83 c2 01             	add    $0x1,%edx
+  8014c1:	bb 08 00 00 00       	mov    $0x8,%ebx
+  8014c6:	eb ce                	jmp    801496 <strtol+0x40>
+    s += 2, base = 16;
+  8014c8:	83 c2 02             	add    $0x2,%edx
+  8014cb:	bb 10 00 00 00       	mov    $0x10,%ebx
+  8014d0:	eb c4                	jmp    801496 <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  8014d2:	0f be c0             	movsbl %al,%eax
+  8014d5:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  8014d8:	3b 45 10             	cmp    0x10(%ebp),%eax
+  8014db:	7d 3a                	jge    801517 <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  8014dd:	83 c2 01             	add    $0x1,%edx
+  8014e0:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  8014e4:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  8014e6:	0f b6 02             	movzbl (%edx),%eax
+  8014e9:	8d 70 d0             	lea    -0x30(%eax),%esi
+  8014ec:	89 f3                	mov    %esi,%ebx
+  8014ee:	80 fb 09             	cmp    $0x9,%bl
+  8014f1:	76 df                	jbe    8014d2 <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  8014f3:	8d 70 9f             	lea    -0x61(%eax),%esi
+  8014f6:	89 f3                	mov    %esi,%ebx
+  8014f8:	80 fb 19             	cmp    $0x19,%bl
+  8014fb:	77 08                	ja     801505 <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  8014fd:	0f be c0             	movsbl %al,%eax
+  801500:	83 e8 57             	sub    $0x57,%eax
+  801503:	eb d3                	jmp    8014d8 <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  801505:	8d 70 bf             	lea    -0x41(%eax),%esi
+  801508:	89 f3                	mov    %esi,%ebx
+  80150a:	80 fb 19             	cmp    $0x19,%bl
+  80150d:	77 08                	ja     801517 <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  80150f:	0f be c0             	movsbl %al,%eax
+  801512:	83 e8 37             	sub    $0x37,%eax
+  801515:	eb c1                	jmp    8014d8 <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  801517:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80151b:	74 05                	je     801522 <strtol+0xcc>
+    *endptr = (char*)s;
+  80151d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801520:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  801522:	89 c8                	mov    %ecx,%eax
+  801524:	f7 d8                	neg    %eax
+  801526:	85 ff                	test   %edi,%edi
+  801528:	0f 45 c8             	cmovne %eax,%ecx
+}
+  80152b:	89 c8                	mov    %ecx,%eax
+  80152d:	5b                   	pop    %ebx
+  80152e:	5e                   	pop    %esi
+  80152f:	5f                   	pop    %edi
+  801530:	5d                   	pop    %ebp
+  801531:	c3                   	ret
+
+00801532 <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  801532:	55                   	push   %ebp
+  801533:	89 e5                	mov    %esp,%ebp
+  801535:	57                   	push   %edi
+  801536:	56                   	push   %esi
+  801537:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801538:	b8 00 00 00 00       	mov    $0x0,%eax
+  80153d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801540:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801543:	89 c3                	mov    %eax,%ebx
+  801545:	89 c7                	mov    %eax,%edi
+  801547:	89 c6                	mov    %eax,%esi
+  801549:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  80154b:	5b                   	pop    %ebx
+  80154c:	5e                   	pop    %esi
+  80154d:	5f                   	pop    %edi
+  80154e:	5d                   	pop    %ebp
+  80154f:	c3                   	ret
+
+00801550 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  801550:	55                   	push   %ebp
+  801551:	89 e5                	mov    %esp,%ebp
+  801553:	57                   	push   %edi
+  801554:	56                   	push   %esi
+  801555:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801556:	ba 00 00 00 00       	mov    $0x0,%edx
+  80155b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801560:	89 d1                	mov    %edx,%ecx
+  801562:	89 d3                	mov    %edx,%ebx
+  801564:	89 d7                	mov    %edx,%edi
+  801566:	89 d6                	mov    %edx,%esi
+  801568:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  80156a:	5b                   	pop    %ebx
+  80156b:	5e                   	pop    %esi
+  80156c:	5f                   	pop    %edi
+  80156d:	5d                   	pop    %ebp
+  80156e:	c3                   	ret
+
+0080156f <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  80156f:	55                   	push   %ebp
+  801570:	89 e5                	mov    %esp,%ebp
+  801572:	57                   	push   %edi
+  801573:	56                   	push   %esi
+  801574:	53                   	push   %ebx
+  801575:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801578:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80157d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801580:	b8 03 00 00 00       	mov    $0x3,%eax
+  801585:	89 cb                	mov    %ecx,%ebx
+  801587:	89 cf                	mov    %ecx,%edi
+  801589:	89 ce                	mov    %ecx,%esi
+  80158b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80158d:	85 c0                	test   %eax,%eax
+  80158f:	7f 08                	jg     801599 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  801591:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801594:	5b                   	pop    %ebx
+  801595:	5e                   	pop    %esi
+  801596:	5f                   	pop    %edi
+  801597:	5d                   	pop    %ebp
+  801598:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801599:	83 ec 0c             	sub    $0xc,%esp
+  80159c:	50                   	push   %eax
+  80159d:	6a 03                	push   $0x3
+  80159f:	68 d3 51 80 00       	push   $0x8051d3
+  8015a4:	6a 23                	push   $0x23
+  8015a6:	68 f0 51 80 00       	push   $0x8051f0
+  8015ab:	e8 99 f4 ff ff       	call   800a49 <_panic>
+
+008015b0 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  8015b0:	55                   	push   %ebp
+  8015b1:	89 e5                	mov    %esp,%ebp
+  8015b3:	57                   	push   %edi
+  8015b4:	56                   	push   %esi
+  8015b5:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8015b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015bb:	b8 02 00 00 00       	mov    $0x2,%eax
+  8015c0:	89 d1                	mov    %edx,%ecx
+  8015c2:	89 d3                	mov    %edx,%ebx
+  8015c4:	89 d7                	mov    %edx,%edi
+  8015c6:	89 d6                	mov    %edx,%esi
+  8015c8:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  8015ca:	5b                   	pop    %ebx
+  8015cb:	5e                   	pop    %esi
+  8015cc:	5f                   	pop    %edi
+  8015cd:	5d                   	pop    %ebp
+  8015ce:	c3                   	ret
+
+008015cf <sys_yield>:
+
+void
+sys_yield(void)
+{
+  8015cf:	55                   	push   %ebp
+  8015d0:	89 e5                	mov    %esp,%ebp
+  8015d2:	57                   	push   %edi
+  8015d3:	56                   	push   %esi
+  8015d4:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8015d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015da:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8015df:	89 d1                	mov    %edx,%ecx
+  8015e1:	89 d3                	mov    %edx,%ebx
+  8015e3:	89 d7                	mov    %edx,%edi
+  8015e5:	89 d6                	mov    %edx,%esi
+  8015e7:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  8015e9:	5b                   	pop    %ebx
+  8015ea:	5e                   	pop    %esi
+  8015eb:	5f                   	pop    %edi
+  8015ec:	5d                   	pop    %ebp
+  8015ed:	c3                   	ret
+
+008015ee <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  8015ee:	55                   	push   %ebp
+  8015ef:	89 e5                	mov    %esp,%ebp
+  8015f1:	57                   	push   %edi
+  8015f2:	56                   	push   %esi
+  8015f3:	53                   	push   %ebx
+  8015f4:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  8015f7:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  8015fb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801600:	8b 55 08             	mov    0x8(%ebp),%edx
+  801603:	b8 14 00 00 00       	mov    $0x14,%eax
+  801608:	89 df                	mov    %ebx,%edi
+  80160a:	89 de                	mov    %ebx,%esi
+  80160c:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80160e:	85 c0                	test   %eax,%eax
+  801610:	7f 08                	jg     80161a <sys_env_set_cow+0x2c>
+}
+  801612:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801615:	5b                   	pop    %ebx
+  801616:	5e                   	pop    %esi
+  801617:	5f                   	pop    %edi
+  801618:	5d                   	pop    %ebp
+  801619:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80161a:	83 ec 0c             	sub    $0xc,%esp
+  80161d:	50                   	push   %eax
+  80161e:	6a 14                	push   $0x14
+  801620:	68 d3 51 80 00       	push   $0x8051d3
+  801625:	6a 23                	push   $0x23
+  801627:	68 f0 51 80 00       	push   $0x8051f0
+  80162c:	e8 18 f4 ff ff       	call   800a49 <_panic>
+
+00801631 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  801631:	55                   	push   %ebp
+  801632:	89 e5                	mov    %esp,%ebp
+  801634:	57                   	push   %edi
+  801635:	56                   	push   %esi
+  801636:	53                   	push   %ebx
+  801637:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80163a:	be 00 00 00 00       	mov    $0x0,%esi
+  80163f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801642:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801645:	b8 04 00 00 00       	mov    $0x4,%eax
+  80164a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80164d:	89 f7                	mov    %esi,%edi
+  80164f:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801651:	85 c0                	test   %eax,%eax
+  801653:	7f 08                	jg     80165d <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  801655:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801658:	5b                   	pop    %ebx
+  801659:	5e                   	pop    %esi
+  80165a:	5f                   	pop    %edi
+  80165b:	5d                   	pop    %ebp
+  80165c:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80165d:	83 ec 0c             	sub    $0xc,%esp
+  801660:	50                   	push   %eax
+  801661:	6a 04                	push   $0x4
+  801663:	68 d3 51 80 00       	push   $0x8051d3
+  801668:	6a 23                	push   $0x23
+  80166a:	68 f0 51 80 00       	push   $0x8051f0
+  80166f:	e8 d5 f3 ff ff       	call   800a49 <_panic>
+
+00801674 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  801674:	55                   	push   %ebp
+  801675:	89 e5                	mov    %esp,%ebp
+  801677:	57                   	push   %edi
+  801678:	56                   	push   %esi
+  801679:	53                   	push   %ebx
+  80167a:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80167d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801680:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801683:	b8 05 00 00 00       	mov    $0x5,%eax
+  801688:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80168b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80168e:	8b 75 18             	mov    0x18(%ebp),%esi
+  801691:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801693:	85 c0                	test   %eax,%eax
+  801695:	7f 08                	jg     80169f <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  801697:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80169a:	5b                   	pop    %ebx
+  80169b:	5e                   	pop    %esi
+  80169c:	5f                   	pop    %edi
+  80169d:	5d                   	pop    %ebp
+  80169e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80169f:	83 ec 0c             	sub    $0xc,%esp
+  8016a2:	50                   	push   %eax
+  8016a3:	6a 05                	push   $0x5
+  8016a5:	68 d3 51 80 00       	push   $0x8051d3
+  8016aa:	6a 23                	push   $0x23
+  8016ac:	68 f0 51 80 00       	push   $0x8051f0
+  8016b1:	e8 93 f3 ff ff       	call   800a49 <_panic>
+
+008016b6 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  8016b6:	55                   	push   %ebp
+  8016b7:	89 e5                	mov    %esp,%ebp
+  8016b9:	57                   	push   %edi
+  8016ba:	56                   	push   %esi
+  8016bb:	53                   	push   %ebx
+  8016bc:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8016bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016c4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8016c7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8016ca:	b8 06 00 00 00       	mov    $0x6,%eax
+  8016cf:	89 df                	mov    %ebx,%edi
+  8016d1:	89 de                	mov    %ebx,%esi
+  8016d3:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8016d5:	85 c0                	test   %eax,%eax
+  8016d7:	7f 08                	jg     8016e1 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  8016d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016dc:	5b                   	pop    %ebx
+  8016dd:	5e                   	pop    %esi
+  8016de:	5f                   	pop    %edi
+  8016df:	5d                   	pop    %ebp
+  8016e0:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8016e1:	83 ec 0c             	sub    $0xc,%esp
+  8016e4:	50                   	push   %eax
+  8016e5:	6a 06                	push   $0x6
+  8016e7:	68 d3 51 80 00       	push   $0x8051d3
+  8016ec:	6a 23                	push   $0x23
+  8016ee:	68 f0 51 80 00       	push   $0x8051f0
+  8016f3:	e8 51 f3 ff ff       	call   800a49 <_panic>
+
+008016f8 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  8016f8:	55                   	push   %ebp
+  8016f9:	89 e5                	mov    %esp,%ebp
+  8016fb:	57                   	push   %edi
+  8016fc:	56                   	push   %esi
+  8016fd:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8016fe:	8b 55 08             	mov    0x8(%ebp),%edx
+  801701:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801704:	b8 11 00 00 00       	mov    $0x11,%eax
+  801709:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80170c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80170f:	8b 75 18             	mov    0x18(%ebp),%esi
+  801712:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  801714:	5b                   	pop    %ebx
+  801715:	5e                   	pop    %esi
+  801716:	5f                   	pop    %edi
+  801717:	5d                   	pop    %ebp
+  801718:	c3                   	ret
+
+00801719 <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  801719:	55                   	push   %ebp
+  80171a:	89 e5                	mov    %esp,%ebp
+  80171c:	57                   	push   %edi
+  80171d:	56                   	push   %esi
+  80171e:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80171f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801722:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801725:	b8 12 00 00 00       	mov    $0x12,%eax
+  80172a:	be 00 00 00 00       	mov    $0x0,%esi
+  80172f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801732:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801735:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  801737:	5b                   	pop    %ebx
+  801738:	5e                   	pop    %esi
+  801739:	5f                   	pop    %edi
+  80173a:	5d                   	pop    %ebp
+  80173b:	c3                   	ret
+
+0080173c <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  80173c:	55                   	push   %ebp
+  80173d:	89 e5                	mov    %esp,%ebp
+  80173f:	57                   	push   %edi
+  801740:	56                   	push   %esi
+  801741:	53                   	push   %ebx
+  801742:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801745:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80174a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80174d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801750:	b8 16 00 00 00       	mov    $0x16,%eax
+  801755:	89 df                	mov    %ebx,%edi
+  801757:	89 de                	mov    %ebx,%esi
+  801759:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80175b:	85 c0                	test   %eax,%eax
+  80175d:	7f 08                	jg     801767 <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  80175f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801762:	5b                   	pop    %ebx
+  801763:	5e                   	pop    %esi
+  801764:	5f                   	pop    %edi
+  801765:	5d                   	pop    %ebp
+  801766:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801767:	83 ec 0c             	sub    $0xc,%esp
+  80176a:	50                   	push   %eax
+  80176b:	6a 16                	push   $0x16
+  80176d:	68 d3 51 80 00       	push   $0x8051d3
+  801772:	6a 23                	push   $0x23
+  801774:	68 f0 51 80 00       	push   $0x8051f0
+  801779:	e8 cb f2 ff ff       	call   800a49 <_panic>
+
+0080177e <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  80177e:	55                   	push   %ebp
+  80177f:	89 e5                	mov    %esp,%ebp
+  801781:	57                   	push   %edi
+  801782:	56                   	push   %esi
+  801783:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801784:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801789:	8b 55 08             	mov    0x8(%ebp),%edx
+  80178c:	b8 17 00 00 00       	mov    $0x17,%eax
+  801791:	89 cb                	mov    %ecx,%ebx
+  801793:	89 cf                	mov    %ecx,%edi
+  801795:	89 ce                	mov    %ecx,%esi
+  801797:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  801799:	5b                   	pop    %ebx
+  80179a:	5e                   	pop    %esi
+  80179b:	5f                   	pop    %edi
+  80179c:	5d                   	pop    %ebp
+  80179d:	c3                   	ret
+
+0080179e <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  80179e:	55                   	push   %ebp
+  80179f:	89 e5                	mov    %esp,%ebp
+  8017a1:	57                   	push   %edi
+  8017a2:	56                   	push   %esi
+  8017a3:	53                   	push   %ebx
+  8017a4:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8017a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8017ac:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017af:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017b2:	b8 18 00 00 00       	mov    $0x18,%eax
+  8017b7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8017ba:	89 f7                	mov    %esi,%edi
+  8017bc:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8017be:	85 c0                	test   %eax,%eax
+  8017c0:	7f 08                	jg     8017ca <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  8017c2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017c5:	5b                   	pop    %ebx
+  8017c6:	5e                   	pop    %esi
+  8017c7:	5f                   	pop    %edi
+  8017c8:	5d                   	pop    %ebp
+  8017c9:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8017ca:	83 ec 0c             	sub    $0xc,%esp
+  8017cd:	50                   	push   %eax
+  8017ce:	6a 18                	push   $0x18
+  8017d0:	68 d3 51 80 00       	push   $0x8051d3
+  8017d5:	6a 23                	push   $0x23
+  8017d7:	68 f0 51 80 00       	push   $0x8051f0
+  8017dc:	e8 68 f2 ff ff       	call   800a49 <_panic>
+
+008017e1 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  8017e1:	55                   	push   %ebp
+  8017e2:	89 e5                	mov    %esp,%ebp
+  8017e4:	57                   	push   %edi
+  8017e5:	56                   	push   %esi
+  8017e6:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8017e7:	be 00 00 00 00       	mov    $0x0,%esi
+  8017ec:	8b 55 08             	mov    0x8(%ebp),%edx
+  8017ef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8017f2:	b8 19 00 00 00       	mov    $0x19,%eax
+  8017f7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8017fa:	89 f7                	mov    %esi,%edi
+  8017fc:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  8017fe:	5b                   	pop    %ebx
+  8017ff:	5e                   	pop    %esi
+  801800:	5f                   	pop    %edi
+  801801:	5d                   	pop    %ebp
+  801802:	c3                   	ret
+
+00801803 <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  801803:	55                   	push   %ebp
+  801804:	89 e5                	mov    %esp,%ebp
+  801806:	57                   	push   %edi
+  801807:	56                   	push   %esi
+  801808:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801809:	ba 00 00 00 00       	mov    $0x0,%edx
+  80180e:	b8 15 00 00 00       	mov    $0x15,%eax
+  801813:	89 d1                	mov    %edx,%ecx
+  801815:	89 d3                	mov    %edx,%ebx
+  801817:	89 d7                	mov    %edx,%edi
+  801819:	89 d6                	mov    %edx,%esi
+  80181b:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  80181d:	5b                   	pop    %ebx
+  80181e:	5e                   	pop    %esi
+  80181f:	5f                   	pop    %edi
+  801820:	5d                   	pop    %ebp
+  801821:	c3                   	ret
+
+00801822 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801822:	55                   	push   %ebp
+  801823:	89 e5                	mov    %esp,%ebp
+  801825:	57                   	push   %edi
+  801826:	56                   	push   %esi
+  801827:	53                   	push   %ebx
+  801828:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80182b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801830:	8b 55 08             	mov    0x8(%ebp),%edx
+  801833:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801836:	b8 08 00 00 00       	mov    $0x8,%eax
+  80183b:	89 df                	mov    %ebx,%edi
+  80183d:	89 de                	mov    %ebx,%esi
+  80183f:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801841:	85 c0                	test   %eax,%eax
+  801843:	7f 08                	jg     80184d <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  801845:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801848:	5b                   	pop    %ebx
+  801849:	5e                   	pop    %esi
+  80184a:	5f                   	pop    %edi
+  80184b:	5d                   	pop    %ebp
+  80184c:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80184d:	83 ec 0c             	sub    $0xc,%esp
+  801850:	50                   	push   %eax
+  801851:	6a 08                	push   $0x8
+  801853:	68 d3 51 80 00       	push   $0x8051d3
+  801858:	6a 23                	push   $0x23
+  80185a:	68 f0 51 80 00       	push   $0x8051f0
+  80185f:	e8 e5 f1 ff ff       	call   800a49 <_panic>
+
+00801864 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801864:	55                   	push   %ebp
+  801865:	89 e5                	mov    %esp,%ebp
+  801867:	57                   	push   %edi
+  801868:	56                   	push   %esi
+  801869:	53                   	push   %ebx
+  80186a:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80186d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801872:	8b 55 08             	mov    0x8(%ebp),%edx
+  801875:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801878:	b8 09 00 00 00       	mov    $0x9,%eax
+  80187d:	89 df                	mov    %ebx,%edi
+  80187f:	89 de                	mov    %ebx,%esi
+  801881:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801883:	85 c0                	test   %eax,%eax
+  801885:	7f 08                	jg     80188f <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  801887:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80188a:	5b                   	pop    %ebx
+  80188b:	5e                   	pop    %esi
+  80188c:	5f                   	pop    %edi
+  80188d:	5d                   	pop    %ebp
+  80188e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80188f:	83 ec 0c             	sub    $0xc,%esp
+  801892:	50                   	push   %eax
+  801893:	6a 09                	push   $0x9
+  801895:	68 d3 51 80 00       	push   $0x8051d3
+  80189a:	6a 23                	push   $0x23
+  80189c:	68 f0 51 80 00       	push   $0x8051f0
+  8018a1:	e8 a3 f1 ff ff       	call   800a49 <_panic>
+
+008018a6 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8018a6:	55                   	push   %ebp
+  8018a7:	89 e5                	mov    %esp,%ebp
+  8018a9:	57                   	push   %edi
+  8018aa:	56                   	push   %esi
+  8018ab:	53                   	push   %ebx
+  8018ac:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8018af:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018b4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018b7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018ba:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8018bf:	89 df                	mov    %ebx,%edi
+  8018c1:	89 de                	mov    %ebx,%esi
+  8018c3:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8018c5:	85 c0                	test   %eax,%eax
+  8018c7:	7f 08                	jg     8018d1 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  8018c9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018cc:	5b                   	pop    %ebx
+  8018cd:	5e                   	pop    %esi
+  8018ce:	5f                   	pop    %edi
+  8018cf:	5d                   	pop    %ebp
+  8018d0:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8018d1:	83 ec 0c             	sub    $0xc,%esp
+  8018d4:	50                   	push   %eax
+  8018d5:	6a 0a                	push   $0xa
+  8018d7:	68 d3 51 80 00       	push   $0x8051d3
+  8018dc:	6a 23                	push   $0x23
+  8018de:	68 f0 51 80 00       	push   $0x8051f0
+  8018e3:	e8 61 f1 ff ff       	call   800a49 <_panic>
+
+008018e8 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  8018e8:	55                   	push   %ebp
+  8018e9:	89 e5                	mov    %esp,%ebp
+  8018eb:	57                   	push   %edi
+  8018ec:	56                   	push   %esi
+  8018ed:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8018ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8018f1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8018f4:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8018f9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8018fc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8018ff:	8b 75 18             	mov    0x18(%ebp),%esi
+  801902:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  801904:	5b                   	pop    %ebx
+  801905:	5e                   	pop    %esi
+  801906:	5f                   	pop    %edi
+  801907:	5d                   	pop    %ebp
+  801908:	c3                   	ret
+
+00801909 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  801909:	55                   	push   %ebp
+  80190a:	89 e5                	mov    %esp,%ebp
+  80190c:	57                   	push   %edi
+  80190d:	56                   	push   %esi
+  80190e:	53                   	push   %ebx
+  80190f:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801912:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801917:	8b 55 08             	mov    0x8(%ebp),%edx
+  80191a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80191d:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801922:	89 df                	mov    %ebx,%edi
+  801924:	89 de                	mov    %ebx,%esi
+  801926:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801928:	85 c0                	test   %eax,%eax
+  80192a:	7f 08                	jg     801934 <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  80192c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80192f:	5b                   	pop    %ebx
+  801930:	5e                   	pop    %esi
+  801931:	5f                   	pop    %edi
+  801932:	5d                   	pop    %ebp
+  801933:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801934:	83 ec 0c             	sub    $0xc,%esp
+  801937:	50                   	push   %eax
+  801938:	6a 0d                	push   $0xd
+  80193a:	68 d3 51 80 00       	push   $0x8051d3
+  80193f:	6a 23                	push   $0x23
+  801941:	68 f0 51 80 00       	push   $0x8051f0
+  801946:	e8 fe f0 ff ff       	call   800a49 <_panic>
+
+0080194b <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  80194b:	55                   	push   %ebp
+  80194c:	89 e5                	mov    %esp,%ebp
+  80194e:	57                   	push   %edi
+  80194f:	56                   	push   %esi
+  801950:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801951:	ba 00 00 00 00       	mov    $0x0,%edx
+  801956:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80195b:	89 d1                	mov    %edx,%ecx
+  80195d:	89 d3                	mov    %edx,%ebx
+  80195f:	89 d7                	mov    %edx,%edi
+  801961:	89 d6                	mov    %edx,%esi
+  801963:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801965:	5b                   	pop    %ebx
+  801966:	5e                   	pop    %esi
+  801967:	5f                   	pop    %edi
+  801968:	5d                   	pop    %ebp
+  801969:	c3                   	ret
+
+0080196a <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  80196a:	55                   	push   %ebp
+  80196b:	89 e5                	mov    %esp,%ebp
+  80196d:	57                   	push   %edi
+  80196e:	56                   	push   %esi
+  80196f:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801970:	8b 55 08             	mov    0x8(%ebp),%edx
+  801973:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801976:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80197b:	be 00 00 00 00       	mov    $0x0,%esi
+  801980:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801983:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801986:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  801988:	5b                   	pop    %ebx
+  801989:	5e                   	pop    %esi
+  80198a:	5f                   	pop    %edi
+  80198b:	5d                   	pop    %ebp
+  80198c:	c3                   	ret
+
+0080198d <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  80198d:	55                   	push   %ebp
+  80198e:	89 e5                	mov    %esp,%ebp
+  801990:	57                   	push   %edi
+  801991:	56                   	push   %esi
+  801992:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801993:	be 00 00 00 00       	mov    $0x0,%esi
+  801998:	8b 55 08             	mov    0x8(%ebp),%edx
+  80199b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80199e:	b8 10 00 00 00       	mov    $0x10,%eax
+  8019a3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8019a6:	89 f7                	mov    %esi,%edi
+  8019a8:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  8019aa:	5b                   	pop    %ebx
+  8019ab:	5e                   	pop    %esi
+  8019ac:	5f                   	pop    %edi
+  8019ad:	5d                   	pop    %ebp
+  8019ae:	c3                   	ret
+
+008019af <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  8019af:	55                   	push   %ebp
+  8019b0:	89 e5                	mov    %esp,%ebp
+  8019b2:	57                   	push   %edi
+  8019b3:	56                   	push   %esi
+  8019b4:	53                   	push   %ebx
+  8019b5:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  8019b8:	80 3d e4 83 80 00 00 	cmpb   $0x0,0x8083e4
+  8019bf:	74 41                	je     801a02 <sys_batch+0x53>
+  8019c1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019c4:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  8019c7:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  8019ce:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8019d1:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  8019d4:	7d 45                	jge    801a1b <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  8019d6:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8019d9:	8b 06                	mov    (%esi),%eax
+  8019db:	8b 56 04             	mov    0x4(%esi),%edx
+  8019de:	8b 4e 08             	mov    0x8(%esi),%ecx
+  8019e1:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  8019e4:	8b 7e 10             	mov    0x10(%esi),%edi
+  8019e7:	8b 76 14             	mov    0x14(%esi),%esi
+  8019ea:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  8019ec:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8019ef:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  8019f2:	83 c6 1c             	add    $0x1c,%esi
+  8019f5:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  8019f8:	85 c0                	test   %eax,%eax
+  8019fa:	78 1f                	js     801a1b <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  8019fc:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  801a00:	eb cc                	jmp    8019ce <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  801a02:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a07:	b8 13 00 00 00       	mov    $0x13,%eax
+  801a0c:	8b 55 08             	mov    0x8(%ebp),%edx
+  801a0f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a12:	89 df                	mov    %ebx,%edi
+  801a14:	89 de                	mov    %ebx,%esi
+  801a16:	cd 30                	int    $0x30
+  801a18:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  801a1b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801a1e:	83 c4 08             	add    $0x8,%esp
+  801a21:	5b                   	pop    %ebx
+  801a22:	5e                   	pop    %esi
+  801a23:	5f                   	pop    %edi
+  801a24:	5d                   	pop    %ebp
+  801a25:	c3                   	ret
+
+00801a26 <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  801a26:	55                   	push   %ebp
+  801a27:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  801a29:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a2c:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  801a32:	5d                   	pop    %ebp
+  801a33:	c3                   	ret
+
+00801a34 <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  801a34:	55                   	push   %ebp
+  801a35:	89 e5                	mov    %esp,%ebp
+  801a37:	56                   	push   %esi
+  801a38:	53                   	push   %ebx
+  801a39:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  801a3c:	8b 1e                	mov    (%esi),%ebx
+  801a3e:	85 db                	test   %ebx,%ebx
+  801a40:	75 09                	jne    801a4b <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  801a42:	89 d8                	mov    %ebx,%eax
+  801a44:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a47:	5b                   	pop    %ebx
+  801a48:	5e                   	pop    %esi
+  801a49:	5d                   	pop    %ebp
+  801a4a:	c3                   	ret
+  b->sb_n = 0;
+  801a4b:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  801a51:	53                   	push   %ebx
+  801a52:	8d 46 04             	lea    0x4(%esi),%eax
+  801a55:	50                   	push   %eax
+  801a56:	e8 54 ff ff ff       	call   8019af <sys_batch>
+  801a5b:	83 c4 08             	add    $0x8,%esp
+  801a5e:	85 c0                	test   %eax,%eax
+  801a60:	78 1e                	js     801a80 <sysbatch_flush+0x4c>
+  if (r < n)
+  801a62:	39 c3                	cmp    %eax,%ebx
+  801a64:	7f 07                	jg     801a6d <sysbatch_flush+0x39>
+  return 0;
+  801a66:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a6b:	eb d5                	jmp    801a42 <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  801a6d:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801a70:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  801a74:	85 db                	test   %ebx,%ebx
+  801a76:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a7b:	0f 49 d8             	cmovns %eax,%ebx
+  801a7e:	eb c2                	jmp    801a42 <sysbatch_flush+0xe>
+    return r;
+  801a80:	89 c3                	mov    %eax,%ebx
+  801a82:	eb be                	jmp    801a42 <sysbatch_flush+0xe>
+
+00801a84 <sysbatch_add>:
+{
+  801a84:	55                   	push   %ebp
+  801a85:	89 e5                	mov    %esp,%ebp
+  801a87:	53                   	push   %ebx
+  801a88:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  801a8b:	83 3b 40             	cmpl   $0x40,(%ebx)
+  801a8e:	74 41                	je     801ad1 <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  801a90:	8b 03                	mov    (%ebx),%eax
+  801a92:	8d 50 01             	lea    0x1(%eax),%edx
+  801a95:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  801a97:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801a9a:	01 d8                	add    %ebx,%eax
+  801a9c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801a9f:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  801aa2:	8b 55 10             	mov    0x10(%ebp),%edx
+  801aa5:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  801aa8:	8b 55 14             	mov    0x14(%ebp),%edx
+  801aab:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  801aae:	8b 55 18             	mov    0x18(%ebp),%edx
+  801ab1:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  801ab4:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  801ab7:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  801aba:	8b 55 20             	mov    0x20(%ebp),%edx
+  801abd:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  801ac0:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  801ac7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801acc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801acf:	c9                   	leave
+  801ad0:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  801ad1:	53                   	push   %ebx
+  801ad2:	e8 5d ff ff ff       	call   801a34 <sysbatch_flush>
+  801ad7:	83 c4 04             	add    $0x4,%esp
+  801ada:	85 c0                	test   %eax,%eax
+  801adc:	79 b2                	jns    801a90 <sysbatch_add+0xc>
+  801ade:	eb ec                	jmp    801acc <sysbatch_add+0x48>
+
+00801ae0 <pgfault>:
+// Custom page fault handler - if faulting page is copy-on-write,
+// map in our own private writable copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  801ae0:	55                   	push   %ebp
+  801ae1:	89 e5                	mov    %esp,%ebp
+  801ae3:	56                   	push   %esi
+  801ae4:	53                   	push   %ebx
+  801ae5:	8b 45 08             	mov    0x8(%ebp),%eax
+  void *addr = (void*)utf->utf_fault_va;
+  801ae8:	8b 18                	mov    (%eax),%ebx
+  uint32_t err = utf->utf_err;
+  801aea:	8b 70 04             	mov    0x4(%eax),%esi
+  // Hint:
+  //   Use the read-only page table mappings at uvpt
+  //   (see <inc/memlayout.h>).
+
+  // Faults in file mappings are mmap's to handle.
+  if (mmap_fault(utf))
+  801aed:	83 ec 0c             	sub    $0xc,%esp
+  801af0:	50                   	push   %eax
+  801af1:	e8 0f 28 00 00       	call   804305 <mmap_fault>
+  801af6:	83 c4 10             	add    $0x10,%esp
+  801af9:	84 c0                	test   %al,%al
+  801afb:	75 7d                	jne    801b7a <pgfault+0x9a>
+    return;
+
+  // LAB 4: Your code here.
+  if ( !(err & FEC_WR) ) {
+  801afd:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  801b03:	74 7c                	je     801b81 <pgfault+0xa1>
+    panic("user_pgfault: %e", err);
+  }
+
+  if ( !(uvpt[PGNUM(addr)] & PTE_COW) ) {
+  801b05:	89 d8                	mov    %ebx,%eax
+  801b07:	c1 e8 0c             	shr    $0xc,%eax
+  801b0a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801b11:	f6 c4 08             	test   $0x8,%ah
+  801b14:	74 7d                	je     801b93 <pgfault+0xb3>
+  // page to the old page's address.
+  // Hint:
+  //   You should make three system calls.
+
+  // LAB 4: Your code here.
+  addr = ROUNDDOWN(addr, PGSIZE);
+  801b16:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+
+  // map page to temporary location
+  if ( (r = sys_page_alloc(0, PFTEMP, (PTE_P | PTE_U | PTE_W))) < 0) {
+  801b1c:	83 ec 04             	sub    $0x4,%esp
+  801b1f:	6a 07                	push   $0x7
+  801b21:	68 00 f0 7f 00       	push   $0x7ff000
+  801b26:	6a 00                	push   $0x0
+  801b28:	e8 04 fb ff ff       	call   801631 <sys_page_alloc>
+  801b2d:	83 c4 10             	add    $0x10,%esp
+  801b30:	85 c0                	test   %eax,%eax
+  801b32:	78 73                	js     801ba7 <pgfault+0xc7>
+    panic("sys_page_alloc: %e", r);
+  }
+
+  // copy data from old page to new page
+  memmove(PFTEMP, addr, PGSIZE);
+  801b34:	83 ec 04             	sub    $0x4,%esp
+  801b37:	68 00 10 00 00       	push   $0x1000
+  801b3c:	53                   	push   %ebx
+  801b3d:	68 00 f0 7f 00       	push   $0x7ff000
+  801b42:	e8 41 f8 ff ff       	call   801388 <memmove>
+
+  // move new page to old page address
+  if ( (r = sys_page_map(0, PFTEMP, 0, addr, (PTE_P | PTE_U | PTE_W))) < 0) {
+  801b47:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801b4e:	53                   	push   %ebx
+  801b4f:	6a 00                	push   $0x0
+  801b51:	68 00 f0 7f 00       	push   $0x7ff000
+  801b56:	6a 00                	push   $0x0
+  801b58:	e8 17 fb ff ff       	call   801674 <sys_page_map>
+  801b5d:	83 c4 20             	add    $0x20,%esp
+  801b60:	85 c0                	test   %eax,%eax
+  801b62:	78 55                	js     801bb9 <pgfault+0xd9>
+    panic("sys_page_map: %e", r);
+  }
+
+  if ( (r = sys_page_unmap(0, PFTEMP)) < 0) {
+  801b64:	83 ec 08             	sub    $0x8,%esp
+  801b67:	68 00 f0 7f 00       	push   $0x7ff000
+  801b6c:	6a 00                	push   $0x0
+  801b6e:	e8 43 fb ff ff       	call   8016b6 <sys_page_unmap>
+  801b73:	83 c4 10             	add    $0x10,%esp
+  801b76:	85 c0                	test   %eax,%eax
+  801b78:	78 51                	js     801bcb <pgfault+0xeb>
+    panic("sys_page_unmap: %e", r);
+  }
+}
+  801b7a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b7d:	5b                   	pop    %ebx
+  801b7e:	5e                   	pop    %esi
+  801b7f:	5d                   	pop    %ebp
+  801b80:	c3                   	ret
+    panic("user_pgfault: %e", err);
+  801b81:	56                   	push   %esi
+  801b82:	68 fe 51 80 00       	push   $0x8051fe
+  801b87:	6a 1d                	push   $0x1d
+  801b89:	68 0f 52 80 00       	push   $0x80520f
+  801b8e:	e8 b6 ee ff ff       	call   800a49 <_panic>
+    panic("user_pgfault: page not COW");
+  801b93:	83 ec 04             	sub    $0x4,%esp
+  801b96:	68 1a 52 80 00       	push   $0x80521a
+  801b9b:	6a 21                	push   $0x21
+  801b9d:	68 0f 52 80 00       	push   $0x80520f
+  801ba2:	e8 a2 ee ff ff       	call   800a49 <_panic>
+    panic("sys_page_alloc: %e", r);
+  801ba7:	50                   	push   %eax
+  801ba8:	68 35 52 80 00       	push   $0x805235
+  801bad:	6a 2f                	push   $0x2f
+  801baf:	68 0f 52 80 00       	push   $0x80520f
+  801bb4:	e8 90 ee ff ff       	call   800a49 <_panic>
+    panic("sys_page_map: %e", r);
+  801bb9:	50                   	push   %eax
+  801bba:	68 48 52 80 00       	push   $0x805248
+  801bbf:	6a 37                	push   $0x37
+  801bc1:	68 0f 52 80 00       	push   $0x80520f
+  801bc6:	e8 7e ee ff ff       	call   800a49 <_panic>
+    panic("sys_page_unmap: %e", r);
+  801bcb:	50                   	push   %eax
+  801bcc:	68 59 52 80 00       	push   $0x805259
+  801bd1:	6a 3b                	push   $0x3b
+  801bd3:	68 0f 52 80 00       	push   $0x80520f
+  801bd8:	e8 6c ee ff ff       	call   800a49 <_panic>
+
+00801bdd <shared_pgfault>:
+
+// Challenge!
+//
+static void
+shared_pgfault(struct UTrapframe *utf)
+{
+  801bdd:	55                   	push   %ebp
+  801bde:	89 e5                	mov    %esp,%ebp
+  801be0:	53                   	push   %ebx
+  801be1:	83 ec 10             	sub    $0x10,%esp
+  801be4:	8b 45 08             	mov    0x8(%ebp),%eax
+  // just has fewer error checks
+  
+  void *addr = (void*)utf->utf_fault_va;
+  801be7:	8b 18                	mov    (%eax),%ebx
+  uint32_t err = utf->utf_err;
+  int r;
+
+  if (mmap_fault(utf))
+  801be9:	50                   	push   %eax
+  801bea:	e8 16 27 00 00       	call   804305 <mmap_fault>
+  801bef:	83 c4 10             	add    $0x10,%esp
+  801bf2:	84 c0                	test   %al,%al
+  801bf4:	74 05                	je     801bfb <shared_pgfault+0x1e>
+  }
+
+  if ( (r = sys_page_unmap(0, PFTEMP)) < 0) {
+    panic("sys_page_unmap: %e", r);
+  }
+}
+  801bf6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801bf9:	c9                   	leave
+  801bfa:	c3                   	ret
+  addr = ROUNDDOWN(addr, PGSIZE);
+  801bfb:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if ( (r = sys_page_alloc(0, PFTEMP, (PTE_P | PTE_U | PTE_W))) < 0) {
+  801c01:	83 ec 04             	sub    $0x4,%esp
+  801c04:	6a 07                	push   $0x7
+  801c06:	68 00 f0 7f 00       	push   $0x7ff000
+  801c0b:	6a 00                	push   $0x0
+  801c0d:	e8 1f fa ff ff       	call   801631 <sys_page_alloc>
+  801c12:	83 c4 10             	add    $0x10,%esp
+  801c15:	85 c0                	test   %eax,%eax
+  801c17:	78 5b                	js     801c74 <shared_pgfault+0x97>
+  memmove(PFTEMP, addr, PGSIZE);
+  801c19:	83 ec 04             	sub    $0x4,%esp
+  801c1c:	68 00 10 00 00       	push   $0x1000
+  801c21:	53                   	push   %ebx
+  801c22:	68 00 f0 7f 00       	push   $0x7ff000
+  801c27:	e8 5c f7 ff ff       	call   801388 <memmove>
+  if ( (r = sys_page_map(0, PFTEMP, 0, addr, (PTE_P | PTE_U | PTE_W))) < 0) {
+  801c2c:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801c33:	53                   	push   %ebx
+  801c34:	6a 00                	push   $0x0
+  801c36:	68 00 f0 7f 00       	push   $0x7ff000
+  801c3b:	6a 00                	push   $0x0
+  801c3d:	e8 32 fa ff ff       	call   801674 <sys_page_map>
+  801c42:	83 c4 20             	add    $0x20,%esp
+  801c45:	85 c0                	test   %eax,%eax
+  801c47:	78 40                	js     801c89 <shared_pgfault+0xac>
+  if ( (r = sys_page_unmap(0, PFTEMP)) < 0) {
+  801c49:	83 ec 08             	sub    $0x8,%esp
+  801c4c:	68 00 f0 7f 00       	push   $0x7ff000
+  801c51:	6a 00                	push   $0x0
+  801c53:	e8 5e fa ff ff       	call   8016b6 <sys_page_unmap>
+  801c58:	83 c4 10             	add    $0x10,%esp
+  801c5b:	85 c0                	test   %eax,%eax
+  801c5d:	79 97                	jns    801bf6 <shared_pgfault+0x19>
+    panic("sys_page_unmap: %e", r);
+  801c5f:	50                   	push   %eax
+  801c60:	68 59 52 80 00       	push   $0x805259
+  801c65:	68 b0 00 00 00       	push   $0xb0
+  801c6a:	68 0f 52 80 00       	push   $0x80520f
+  801c6f:	e8 d5 ed ff ff       	call   800a49 <_panic>
+    panic("sys_page_alloc: %e", r);
+  801c74:	50                   	push   %eax
+  801c75:	68 35 52 80 00       	push   $0x805235
+  801c7a:	68 a4 00 00 00       	push   $0xa4
+  801c7f:	68 0f 52 80 00       	push   $0x80520f
+  801c84:	e8 c0 ed ff ff       	call   800a49 <_panic>
+    panic("sys_page_map: %e", r);
+  801c89:	50                   	push   %eax
+  801c8a:	68 48 52 80 00       	push   $0x805248
+  801c8f:	68 ac 00 00 00       	push   $0xac
+  801c94:	68 0f 52 80 00       	push   $0x80520f
+  801c99:	e8 ab ed ff ff       	call   800a49 <_panic>
+
+00801c9e <fork>:
+{
+  801c9e:	55                   	push   %ebp
+  801c9f:	89 e5                	mov    %esp,%ebp
+  801ca1:	53                   	push   %ebx
+  801ca2:	83 ec 04             	sub    $0x4,%esp
+  parent_id = sys_getenvid();
+  801ca5:	e8 06 f9 ff ff       	call   8015b0 <sys_getenvid>
+  set_pgfault_handler(pgfault);
+  801caa:	83 ec 0c             	sub    $0xc,%esp
+  801cad:	68 e0 1a 80 00       	push   $0x801ae0
+  801cb2:	e8 69 2b 00 00       	call   804820 <set_pgfault_handler>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+  envid_t ret;
+  __asm __volatile("int %2"
+  801cb7:	b8 07 00 00 00       	mov    $0x7,%eax
+  801cbc:	cd 30                	int    $0x30
+  801cbe:	89 c3                	mov    %eax,%ebx
+  if (envid < 0) {
+  801cc0:	83 c4 10             	add    $0x10,%esp
+  801cc3:	85 c0                	test   %eax,%eax
+  801cc5:	78 66                	js     801d2d <fork+0x8f>
+  } else if (envid == 0) {
+  801cc7:	74 76                	je     801d3f <fork+0xa1>
+  if ( (error = sys_page_map_range(0, 0, UXSTACKTOP - PGSIZE,
+  801cc9:	83 ec 0c             	sub    $0xc,%esp
+  801ccc:	6a 01                	push   $0x1
+  801cce:	50                   	push   %eax
+  801ccf:	68 00 f0 bf ee       	push   $0xeebff000
+  801cd4:	6a 00                	push   $0x0
+  801cd6:	6a 00                	push   $0x0
+  801cd8:	e8 1b fa ff ff       	call   8016f8 <sys_page_map_range>
+  801cdd:	83 c4 20             	add    $0x20,%esp
+  801ce0:	85 c0                	test   %eax,%eax
+  801ce2:	78 77                	js     801d5b <fork+0xbd>
+  if ( (error = sys_page_alloc(envid,
+  801ce4:	83 ec 04             	sub    $0x4,%esp
+  801ce7:	6a 07                	push   $0x7
+  801ce9:	68 00 f0 bf ee       	push   $0xeebff000
+  801cee:	53                   	push   %ebx
+  801cef:	e8 3d f9 ff ff       	call   801631 <sys_page_alloc>
+  801cf4:	83 c4 10             	add    $0x10,%esp
+  801cf7:	85 c0                	test   %eax,%eax
+  801cf9:	78 72                	js     801d6d <fork+0xcf>
+          thisenv->env_pgfault_upcall)) < 0) {
+  801cfb:	a1 e0 83 80 00       	mov    0x8083e0,%eax
+  801d00:	8b 40 64             	mov    0x64(%eax),%eax
+  if ( (error = sys_env_set_pgfault_upcall(envid,
+  801d03:	83 ec 08             	sub    $0x8,%esp
+  801d06:	50                   	push   %eax
+  801d07:	53                   	push   %ebx
+  801d08:	e8 99 fb ff ff       	call   8018a6 <sys_env_set_pgfault_upcall>
+  801d0d:	83 c4 10             	add    $0x10,%esp
+  801d10:	85 c0                	test   %eax,%eax
+  801d12:	78 6b                	js     801d7f <fork+0xe1>
+  if ( (error = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+  801d14:	83 ec 08             	sub    $0x8,%esp
+  801d17:	6a 02                	push   $0x2
+  801d19:	53                   	push   %ebx
+  801d1a:	e8 03 fb ff ff       	call   801822 <sys_env_set_status>
+  801d1f:	83 c4 10             	add    $0x10,%esp
+  801d22:	85 c0                	test   %eax,%eax
+  801d24:	78 6b                	js     801d91 <fork+0xf3>
+}
+  801d26:	89 d8                	mov    %ebx,%eax
+  801d28:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d2b:	c9                   	leave
+  801d2c:	c3                   	ret
+    panic("sys_exofork: %e", envid);
+  801d2d:	50                   	push   %eax
+  801d2e:	68 6c 52 80 00       	push   $0x80526c
+  801d33:	6a 5e                	push   $0x5e
+  801d35:	68 0f 52 80 00       	push   $0x80520f
+  801d3a:	e8 0a ed ff ff       	call   800a49 <_panic>
+    thisenv = &envs[ENVX(sys_getenvid())];
+  801d3f:	e8 6c f8 ff ff       	call   8015b0 <sys_getenvid>
+  801d44:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801d49:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  801d4c:	c1 e0 04             	shl    $0x4,%eax
+  801d4f:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801d54:	a3 e0 83 80 00       	mov    %eax,0x8083e0
+    return 0;
+  801d59:	eb cb                	jmp    801d26 <fork+0x88>
+    panic("sys_page_map_range: %e", error);
+  801d5b:	50                   	push   %eax
+  801d5c:	68 7c 52 80 00       	push   $0x80527c
+  801d61:	6a 69                	push   $0x69
+  801d63:	68 0f 52 80 00       	push   $0x80520f
+  801d68:	e8 dc ec ff ff       	call   800a49 <_panic>
+    panic("sys_page_alloc: %e", error);
+  801d6d:	50                   	push   %eax
+  801d6e:	68 35 52 80 00       	push   $0x805235
+  801d73:	6a 70                	push   $0x70
+  801d75:	68 0f 52 80 00       	push   $0x80520f
+  801d7a:	e8 ca ec ff ff       	call   800a49 <_panic>
+    panic("sys_env_set_pgfault_upcall: %e", error);
+  801d7f:	50                   	push   %eax
+  801d80:	68 ac 52 80 00       	push   $0x8052ac
+  801d85:	6a 76                	push   $0x76
+  801d87:	68 0f 52 80 00       	push   $0x80520f
+  801d8c:	e8 b8 ec ff ff       	call   800a49 <_panic>
+    panic("sys_env_set_status: %e", error);
+  801d91:	50                   	push   %eax
+  801d92:	68 93 52 80 00       	push   $0x805293
+  801d97:	6a 7a                	push   $0x7a
+  801d99:	68 0f 52 80 00       	push   $0x80520f
+  801d9e:	e8 a6 ec ff ff       	call   800a49 <_panic>
+
+00801da3 <kfork>:
+{
+  801da3:	55                   	push   %ebp
+  801da4:	89 e5                	mov    %esp,%ebp
+  801da6:	53                   	push   %ebx
+  801da7:	83 ec 10             	sub    $0x10,%esp
+  set_pgfault_handler(pgfault);
+  801daa:	68 e0 1a 80 00       	push   $0x801ae0
+  801daf:	e8 6c 2a 00 00       	call   804820 <set_pgfault_handler>
+  if ((envid = sys_fork()) == 0)
+  801db4:	e8 4a fa ff ff       	call   801803 <sys_fork>
+  801db9:	89 c3                	mov    %eax,%ebx
+  801dbb:	83 c4 10             	add    $0x10,%esp
+  801dbe:	85 c0                	test   %eax,%eax
+  801dc0:	74 07                	je     801dc9 <kfork+0x26>
+}
+  801dc2:	89 d8                	mov    %ebx,%eax
+  801dc4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801dc7:	c9                   	leave
+  801dc8:	c3                   	ret
+    thisenv = &envs[ENVX(sys_getenvid())];
+  801dc9:	e8 e2 f7 ff ff       	call   8015b0 <sys_getenvid>
+  801dce:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801dd3:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  801dd6:	c1 e0 04             	shl    $0x4,%eax
+  801dd9:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801dde:	a3 e0 83 80 00       	mov    %eax,0x8083e0
+  return envid;
+  801de3:	eb dd                	jmp    801dc2 <kfork+0x1f>
+
+00801de5 <sfork>:
+
+int
+sfork(void)
+{
+  801de5:	55                   	push   %ebp
+  801de6:	89 e5                	mov    %esp,%ebp
+  801de8:	53                   	push   %ebx
+  801de9:	83 ec 04             	sub    $0x4,%esp
+  envid_t envid, parent_id;
+  int error;
+
+  parent_id = sys_getenvid();
+  801dec:	e8 bf f7 ff ff       	call   8015b0 <sys_getenvid>
+
+  // set up page fault handler
+  set_pgfault_handler(shared_pgfault);
+  801df1:	83 ec 0c             	sub    $0xc,%esp
+  801df4:	68 dd 1b 80 00       	push   $0x801bdd
+  801df9:	e8 22 2a 00 00       	call   804820 <set_pgfault_handler>
+  801dfe:	b8 07 00 00 00       	mov    $0x7,%eax
+  801e03:	cd 30                	int    $0x30
+  801e05:	89 c3                	mov    %eax,%ebx
+
+  // create a child with sys_exofork
+  envid = sys_exofork();
+  
+  if (envid < 0) {
+  801e07:	83 c4 10             	add    $0x10,%esp
+  801e0a:	85 c0                	test   %eax,%eax
+  801e0c:	78 09                	js     801e17 <sfork+0x32>
+    panic("sys_exofork: %e", envid);
+  } else if (envid == 0) {
+  801e0e:	75 1c                	jne    801e2c <sfork+0x47>
+  if ( (error = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+    panic("sys_env_set_status: %e", error);
+  }
+
+  return envid;
+}
+  801e10:	89 d8                	mov    %ebx,%eax
+  801e12:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e15:	c9                   	leave
+  801e16:	c3                   	ret
+    panic("sys_exofork: %e", envid);
+  801e17:	50                   	push   %eax
+  801e18:	68 6c 52 80 00       	push   $0x80526c
+  801e1d:	68 c3 00 00 00       	push   $0xc3
+  801e22:	68 0f 52 80 00       	push   $0x80520f
+  801e27:	e8 1d ec ff ff       	call   800a49 <_panic>
+  if ( (error = sys_page_map_range(0, 0, USTACKTOP - PGSIZE,
+  801e2c:	83 ec 0c             	sub    $0xc,%esp
+  801e2f:	6a 00                	push   $0x0
+  801e31:	50                   	push   %eax
+  801e32:	68 00 d0 bf ee       	push   $0xeebfd000
+  801e37:	6a 00                	push   $0x0
+  801e39:	6a 00                	push   $0x0
+  801e3b:	e8 b8 f8 ff ff       	call   8016f8 <sys_page_map_range>
+  801e40:	83 c4 20             	add    $0x20,%esp
+  801e43:	85 c0                	test   %eax,%eax
+  801e45:	78 79                	js     801ec0 <sfork+0xdb>
+  if ( (error = sys_page_map_range(0, (void *) (USTACKTOP - PGSIZE), PGSIZE,
+  801e47:	83 ec 0c             	sub    $0xc,%esp
+  801e4a:	6a 01                	push   $0x1
+  801e4c:	53                   	push   %ebx
+  801e4d:	68 00 10 00 00       	push   $0x1000
+  801e52:	68 00 d0 bf ee       	push   $0xeebfd000
+  801e57:	6a 00                	push   $0x0
+  801e59:	e8 9a f8 ff ff       	call   8016f8 <sys_page_map_range>
+  801e5e:	83 c4 20             	add    $0x20,%esp
+  801e61:	85 c0                	test   %eax,%eax
+  801e63:	78 70                	js     801ed5 <sfork+0xf0>
+  if ( (error = sys_page_alloc(envid,
+  801e65:	83 ec 04             	sub    $0x4,%esp
+  801e68:	6a 07                	push   $0x7
+  801e6a:	68 00 f0 bf ee       	push   $0xeebff000
+  801e6f:	53                   	push   %ebx
+  801e70:	e8 bc f7 ff ff       	call   801631 <sys_page_alloc>
+  801e75:	83 c4 10             	add    $0x10,%esp
+  801e78:	85 c0                	test   %eax,%eax
+  801e7a:	78 6e                	js     801eea <sfork+0x105>
+          thisenv->env_pgfault_upcall)) < 0) {
+  801e7c:	a1 e0 83 80 00       	mov    0x8083e0,%eax
+  801e81:	8b 40 64             	mov    0x64(%eax),%eax
+  if ( (error = sys_env_set_pgfault_upcall(envid,
+  801e84:	83 ec 08             	sub    $0x8,%esp
+  801e87:	50                   	push   %eax
+  801e88:	53                   	push   %ebx
+  801e89:	e8 18 fa ff ff       	call   8018a6 <sys_env_set_pgfault_upcall>
+  801e8e:	83 c4 10             	add    $0x10,%esp
+  801e91:	85 c0                	test   %eax,%eax
+  801e93:	78 6a                	js     801eff <sfork+0x11a>
+  if ( (error = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+  801e95:	83 ec 08             	sub    $0x8,%esp
+  801e98:	6a 02                	push   $0x2
+  801e9a:	53                   	push   %ebx
+  801e9b:	e8 82 f9 ff ff       	call   801822 <sys_env_set_status>
+  801ea0:	83 c4 10             	add    $0x10,%esp
+  801ea3:	85 c0                	test   %eax,%eax
+  801ea5:	0f 89 65 ff ff ff    	jns    801e10 <sfork+0x2b>
+    panic("sys_env_set_status: %e", error);
+  801eab:	50                   	push   %eax
+  801eac:	68 93 52 80 00       	push   $0x805293
+  801eb1:	68 e4 00 00 00       	push   $0xe4
+  801eb6:	68 0f 52 80 00       	push   $0x80520f
+  801ebb:	e8 89 eb ff ff       	call   800a49 <_panic>
+    panic("sys_page_map_range: %e", error);
+  801ec0:	50                   	push   %eax
+  801ec1:	68 7c 52 80 00       	push   $0x80527c
+  801ec6:	68 ce 00 00 00       	push   $0xce
+  801ecb:	68 0f 52 80 00       	push   $0x80520f
+  801ed0:	e8 74 eb ff ff       	call   800a49 <_panic>
+    panic("sys_page_map_range: %e", error);
+  801ed5:	50                   	push   %eax
+  801ed6:	68 7c 52 80 00       	push   $0x80527c
+  801edb:	68 d3 00 00 00       	push   $0xd3
+  801ee0:	68 0f 52 80 00       	push   $0x80520f
+  801ee5:	e8 5f eb ff ff       	call   800a49 <_panic>
+    panic("sys_page_alloc: %e", error);
+  801eea:	50                   	push   %eax
+  801eeb:	68 35 52 80 00       	push   $0x805235
+  801ef0:	68 da 00 00 00       	push   $0xda
+  801ef5:	68 0f 52 80 00       	push   $0x80520f
+  801efa:	e8 4a eb ff ff       	call   800a49 <_panic>
+    panic("sys_env_set_pgfault_upcall: %e", error);
+  801eff:	50                   	push   %eax
+  801f00:	68 ac 52 80 00       	push   $0x8052ac
+  801f05:	68 e0 00 00 00       	push   $0xe0
+  801f0a:	68 0f 52 80 00       	push   $0x80520f
+  801f0f:	e8 35 eb ff ff       	call   800a49 <_panic>
+
+00801f14 <argstart>:
+#include <inc/args.h>
+#include <inc/string.h>
+
+void
+argstart(int *argc, char **argv, struct Argstate *args)
+{
+  801f14:	55                   	push   %ebp
+  801f15:	89 e5                	mov    %esp,%ebp
+  801f17:	8b 55 08             	mov    0x8(%ebp),%edx
+  801f1a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801f1d:	8b 45 10             	mov    0x10(%ebp),%eax
+  args->argc = argc;
+  801f20:	89 10                	mov    %edx,(%eax)
+  args->argv = (const char**)argv;
+  801f22:	89 48 04             	mov    %ecx,0x4(%eax)
+  args->curarg = (*argc > 1 && argv ? "" : 0);
+  801f25:	83 3a 01             	cmpl   $0x1,(%edx)
+  801f28:	7e 09                	jle    801f33 <argstart+0x1f>
+  801f2a:	ba a1 4c 80 00       	mov    $0x804ca1,%edx
+  801f2f:	85 c9                	test   %ecx,%ecx
+  801f31:	75 05                	jne    801f38 <argstart+0x24>
+  801f33:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f38:	89 50 08             	mov    %edx,0x8(%eax)
+  args->argvalue = 0;
+  801f3b:	c7 40 0c 00 00 00 00 	movl   $0x0,0xc(%eax)
+}
+  801f42:	5d                   	pop    %ebp
+  801f43:	c3                   	ret
+
+00801f44 <argnext>:
+
+int
+argnext(struct Argstate *args)
+{
+  801f44:	55                   	push   %ebp
+  801f45:	89 e5                	mov    %esp,%ebp
+  801f47:	53                   	push   %ebx
+  801f48:	83 ec 04             	sub    $0x4,%esp
+  801f4b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int arg;
+
+  args->argvalue = 0;
+  801f4e:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+
+  // Done processing arguments if args->curarg == 0
+  if (args->curarg == 0)
+  801f55:	8b 43 08             	mov    0x8(%ebx),%eax
+  801f58:	85 c0                	test   %eax,%eax
+  801f5a:	74 74                	je     801fd0 <argnext+0x8c>
+    return -1;
+
+  if (!*args->curarg) {
+  801f5c:	80 38 00             	cmpb   $0x0,(%eax)
+  801f5f:	75 48                	jne    801fa9 <argnext+0x65>
+    // Need to process the next argument
+    // Check for end of argument list
+    if (*args->argc == 1
+  801f61:	8b 0b                	mov    (%ebx),%ecx
+  801f63:	83 39 01             	cmpl   $0x1,(%ecx)
+  801f66:	74 5a                	je     801fc2 <argnext+0x7e>
+        || args->argv[1][0] != '-'
+  801f68:	8b 53 04             	mov    0x4(%ebx),%edx
+  801f6b:	8b 42 04             	mov    0x4(%edx),%eax
+  801f6e:	80 38 2d             	cmpb   $0x2d,(%eax)
+  801f71:	75 4f                	jne    801fc2 <argnext+0x7e>
+        || args->argv[1][1] == '\0')
+  801f73:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  801f77:	74 49                	je     801fc2 <argnext+0x7e>
+      goto endofargs;
+    // Shift arguments down one
+    args->curarg = args->argv[1] + 1;
+  801f79:	83 c0 01             	add    $0x1,%eax
+  801f7c:	89 43 08             	mov    %eax,0x8(%ebx)
+    memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  801f7f:	83 ec 04             	sub    $0x4,%esp
+  801f82:	8b 01                	mov    (%ecx),%eax
+  801f84:	8d 04 85 fc ff ff ff 	lea    -0x4(,%eax,4),%eax
+  801f8b:	50                   	push   %eax
+  801f8c:	8d 42 08             	lea    0x8(%edx),%eax
+  801f8f:	50                   	push   %eax
+  801f90:	83 c2 04             	add    $0x4,%edx
+  801f93:	52                   	push   %edx
+  801f94:	e8 ef f3 ff ff       	call   801388 <memmove>
+    (*args->argc)--;
+  801f99:	8b 03                	mov    (%ebx),%eax
+  801f9b:	83 28 01             	subl   $0x1,(%eax)
+    // Check for "--": end of argument list
+    if (args->curarg[0] == '-' && args->curarg[1] == '\0')
+  801f9e:	8b 43 08             	mov    0x8(%ebx),%eax
+  801fa1:	83 c4 10             	add    $0x10,%esp
+  801fa4:	80 38 2d             	cmpb   $0x2d,(%eax)
+  801fa7:	74 13                	je     801fbc <argnext+0x78>
+      goto endofargs;
+  }
+
+  arg = (unsigned char)*args->curarg;
+  801fa9:	8b 43 08             	mov    0x8(%ebx),%eax
+  801fac:	0f b6 10             	movzbl (%eax),%edx
+  args->curarg++;
+  801faf:	83 c0 01             	add    $0x1,%eax
+  801fb2:	89 43 08             	mov    %eax,0x8(%ebx)
+  return arg;
+
+endofargs:
+  args->curarg = 0;
+  return -1;
+}
+  801fb5:	89 d0                	mov    %edx,%eax
+  801fb7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fba:	c9                   	leave
+  801fbb:	c3                   	ret
+    if (args->curarg[0] == '-' && args->curarg[1] == '\0')
+  801fbc:	80 78 01 00          	cmpb   $0x0,0x1(%eax)
+  801fc0:	75 e7                	jne    801fa9 <argnext+0x65>
+  args->curarg = 0;
+  801fc2:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  return -1;
+  801fc9:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  801fce:	eb e5                	jmp    801fb5 <argnext+0x71>
+    return -1;
+  801fd0:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  801fd5:	eb de                	jmp    801fb5 <argnext+0x71>
+
+00801fd7 <argnextvalue>:
+  return (char*)(args->argvalue ? args->argvalue : argnextvalue(args));
+}
+
+char *
+argnextvalue(struct Argstate *args)
+{
+  801fd7:	55                   	push   %ebp
+  801fd8:	89 e5                	mov    %esp,%ebp
+  801fda:	53                   	push   %ebx
+  801fdb:	83 ec 04             	sub    $0x4,%esp
+  801fde:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (!args->curarg)
+  801fe1:	8b 43 08             	mov    0x8(%ebx),%eax
+  801fe4:	85 c0                	test   %eax,%eax
+  801fe6:	74 12                	je     801ffa <argnextvalue+0x23>
+    return 0;
+  if (*args->curarg) {
+  801fe8:	80 38 00             	cmpb   $0x0,(%eax)
+  801feb:	74 12                	je     801fff <argnextvalue+0x28>
+    args->argvalue = args->curarg;
+  801fed:	89 43 0c             	mov    %eax,0xc(%ebx)
+    args->curarg = "";
+  801ff0:	c7 43 08 a1 4c 80 00 	movl   $0x804ca1,0x8(%ebx)
+    (*args->argc)--;
+  } else {
+    args->argvalue = 0;
+    args->curarg = 0;
+  }
+  return (char*)args->argvalue;
+  801ff7:	8b 43 0c             	mov    0xc(%ebx),%eax
+}
+  801ffa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ffd:	c9                   	leave
+  801ffe:	c3                   	ret
+  } else if (*args->argc > 1) {
+  801fff:	8b 13                	mov    (%ebx),%edx
+  802001:	83 3a 01             	cmpl   $0x1,(%edx)
+  802004:	7f 10                	jg     802016 <argnextvalue+0x3f>
+    args->argvalue = 0;
+  802006:	c7 43 0c 00 00 00 00 	movl   $0x0,0xc(%ebx)
+    args->curarg = 0;
+  80200d:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%ebx)
+  802014:	eb e1                	jmp    801ff7 <argnextvalue+0x20>
+    args->argvalue = args->argv[1];
+  802016:	8b 43 04             	mov    0x4(%ebx),%eax
+  802019:	8b 48 04             	mov    0x4(%eax),%ecx
+  80201c:	89 4b 0c             	mov    %ecx,0xc(%ebx)
+    memmove(args->argv + 1, args->argv + 2, sizeof(const char *) * (*args->argc - 1));
+  80201f:	83 ec 04             	sub    $0x4,%esp
+  802022:	8b 12                	mov    (%edx),%edx
+  802024:	8d 14 95 fc ff ff ff 	lea    -0x4(,%edx,4),%edx
+  80202b:	52                   	push   %edx
+  80202c:	8d 50 08             	lea    0x8(%eax),%edx
+  80202f:	52                   	push   %edx
+  802030:	83 c0 04             	add    $0x4,%eax
+  802033:	50                   	push   %eax
+  802034:	e8 4f f3 ff ff       	call   801388 <memmove>
+    (*args->argc)--;
+  802039:	8b 03                	mov    (%ebx),%eax
+  80203b:	83 28 01             	subl   $0x1,(%eax)
+  80203e:	83 c4 10             	add    $0x10,%esp
+  802041:	eb b4                	jmp    801ff7 <argnextvalue+0x20>
+
+00802043 <argvalue>:
+{
+  802043:	55                   	push   %ebp
+  802044:	89 e5                	mov    %esp,%ebp
+  802046:	83 ec 08             	sub    $0x8,%esp
+  802049:	8b 55 08             	mov    0x8(%ebp),%edx
+  return (char*)(args->argvalue ? args->argvalue : argnextvalue(args));
+  80204c:	8b 42 0c             	mov    0xc(%edx),%eax
+  80204f:	85 c0                	test   %eax,%eax
+  802051:	74 02                	je     802055 <argvalue+0x12>
+}
+  802053:	c9                   	leave
+  802054:	c3                   	ret
+  return (char*)(args->argvalue ? args->argvalue : argnextvalue(args));
+  802055:	83 ec 0c             	sub    $0xc,%esp
+  802058:	52                   	push   %edx
+  802059:	e8 79 ff ff ff       	call   801fd7 <argnextvalue>
+  80205e:	83 c4 10             	add    $0x10,%esp
+  802061:	eb f0                	jmp    802053 <argvalue+0x10>
+
+00802063 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  802063:	55                   	push   %ebp
+  802064:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  802066:	8b 45 08             	mov    0x8(%ebp),%eax
+  802069:	05 00 00 00 30       	add    $0x30000000,%eax
+  80206e:	c1 e8 0c             	shr    $0xc,%eax
+}
+  802071:	5d                   	pop    %ebp
+  802072:	c3                   	ret
+
+00802073 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  802073:	55                   	push   %ebp
+  802074:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  802076:	8b 45 08             	mov    0x8(%ebp),%eax
+  802079:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  80207c:	66 b8 00 00          	mov    $0x0,%ax
+  802080:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  802085:	5d                   	pop    %ebp
+  802086:	c3                   	ret
+
+00802087 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  802087:	55                   	push   %ebp
+  802088:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  80208a:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80208f:	eb 02                	jmp    802093 <fd_alloc+0xc>
+  802091:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  802093:	89 c2                	mov    %eax,%edx
+  802095:	c1 ea 16             	shr    $0x16,%edx
+  802098:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80209f:	f6 c2 01             	test   $0x1,%dl
+  8020a2:	74 2b                	je     8020cf <fd_alloc+0x48>
+  8020a4:	89 c2                	mov    %eax,%edx
+  8020a6:	c1 ea 0c             	shr    $0xc,%edx
+  8020a9:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8020b0:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8020b6:	f6 c1 01             	test   $0x1,%cl
+  8020b9:	74 14                	je     8020cf <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  8020bb:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8020c1:	75 ce                	jne    802091 <fd_alloc+0xa>
+  8020c3:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  8020c8:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8020cd:	eb 05                	jmp    8020d4 <fd_alloc+0x4d>
+      return 0;
+  8020cf:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  8020d4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8020d7:	89 02                	mov    %eax,(%edx)
+}
+  8020d9:	89 c8                	mov    %ecx,%eax
+  8020db:	5d                   	pop    %ebp
+  8020dc:	c3                   	ret
+
+008020dd <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8020dd:	55                   	push   %ebp
+  8020de:	89 e5                	mov    %esp,%ebp
+  8020e0:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  8020e3:	83 f8 1f             	cmp    $0x1f,%eax
+  8020e6:	77 30                	ja     802118 <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  8020e8:	c1 e0 0c             	shl    $0xc,%eax
+  8020eb:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8020f0:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8020f6:	f6 c2 01             	test   $0x1,%dl
+  8020f9:	74 24                	je     80211f <fd_lookup+0x42>
+  8020fb:	89 c2                	mov    %eax,%edx
+  8020fd:	c1 ea 0c             	shr    $0xc,%edx
+  802100:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802107:	f6 c2 01             	test   $0x1,%dl
+  80210a:	74 1a                	je     802126 <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  80210c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80210f:	89 02                	mov    %eax,(%edx)
+  return 0;
+  802111:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802116:	5d                   	pop    %ebp
+  802117:	c3                   	ret
+    return -E_INVAL;
+  802118:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80211d:	eb f7                	jmp    802116 <fd_lookup+0x39>
+    return -E_INVAL;
+  80211f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802124:	eb f0                	jmp    802116 <fd_lookup+0x39>
+  802126:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80212b:	eb e9                	jmp    802116 <fd_lookup+0x39>
+
+0080212d <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80212d:	55                   	push   %ebp
+  80212e:	89 e5                	mov    %esp,%ebp
+  802130:	53                   	push   %ebx
+  802131:	83 ec 04             	sub    $0x4,%esp
+  802134:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  802137:	b8 48 53 80 00       	mov    $0x805348,%eax
+  80213c:	8b 18                	mov    (%eax),%ebx
+  80213e:	85 db                	test   %ebx,%ebx
+  802140:	74 0e                	je     802150 <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  802142:	83 c0 04             	add    $0x4,%eax
+  802145:	39 13                	cmp    %edx,(%ebx)
+  802147:	75 f3                	jne    80213c <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  802149:	b8 00 00 00 00       	mov    $0x0,%eax
+  80214e:	eb 1f                	jmp    80216f <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  802150:	a1 e0 83 80 00       	mov    0x8083e0,%eax
+  802155:	8b 40 48             	mov    0x48(%eax),%eax
+  802158:	83 ec 04             	sub    $0x4,%esp
+  80215b:	52                   	push   %edx
+  80215c:	50                   	push   %eax
+  80215d:	68 cc 52 80 00       	push   $0x8052cc
+  802162:	e8 bd e9 ff ff       	call   800b24 <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  802167:	83 c4 10             	add    $0x10,%esp
+  80216a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  80216f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802172:	89 1a                	mov    %ebx,(%edx)
+}
+  802174:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802177:	c9                   	leave
+  802178:	c3                   	ret
+
+00802179 <fd_close>:
+{
+  802179:	55                   	push   %ebp
+  80217a:	89 e5                	mov    %esp,%ebp
+  80217c:	57                   	push   %edi
+  80217d:	56                   	push   %esi
+  80217e:	53                   	push   %ebx
+  80217f:	83 ec 24             	sub    $0x24,%esp
+  802182:	8b 75 08             	mov    0x8(%ebp),%esi
+  802185:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  802188:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80218b:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80218c:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  802192:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  802195:	50                   	push   %eax
+  802196:	e8 42 ff ff ff       	call   8020dd <fd_lookup>
+  80219b:	89 c3                	mov    %eax,%ebx
+  80219d:	83 c4 10             	add    $0x10,%esp
+  8021a0:	85 c0                	test   %eax,%eax
+  8021a2:	78 05                	js     8021a9 <fd_close+0x30>
+      || fd != fd2)
+  8021a4:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8021a7:	74 16                	je     8021bf <fd_close+0x46>
+    return must_exist ? r : 0;
+  8021a9:	89 f8                	mov    %edi,%eax
+  8021ab:	84 c0                	test   %al,%al
+  8021ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021b2:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8021b5:	89 d8                	mov    %ebx,%eax
+  8021b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021ba:	5b                   	pop    %ebx
+  8021bb:	5e                   	pop    %esi
+  8021bc:	5f                   	pop    %edi
+  8021bd:	5d                   	pop    %ebp
+  8021be:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8021bf:	83 ec 08             	sub    $0x8,%esp
+  8021c2:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8021c5:	50                   	push   %eax
+  8021c6:	ff 36                	push   (%esi)
+  8021c8:	e8 60 ff ff ff       	call   80212d <dev_lookup>
+  8021cd:	89 c3                	mov    %eax,%ebx
+  8021cf:	83 c4 10             	add    $0x10,%esp
+  8021d2:	85 c0                	test   %eax,%eax
+  8021d4:	78 1a                	js     8021f0 <fd_close+0x77>
+    if (dev->dev_close)
+  8021d6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8021d9:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  8021dc:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  8021e1:	85 c0                	test   %eax,%eax
+  8021e3:	74 0b                	je     8021f0 <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  8021e5:	83 ec 0c             	sub    $0xc,%esp
+  8021e8:	56                   	push   %esi
+  8021e9:	ff d0                	call   *%eax
+  8021eb:	89 c3                	mov    %eax,%ebx
+  8021ed:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  8021f0:	83 ec 08             	sub    $0x8,%esp
+  8021f3:	56                   	push   %esi
+  8021f4:	6a 00                	push   $0x0
+  8021f6:	e8 bb f4 ff ff       	call   8016b6 <sys_page_unmap>
+  return r;
+  8021fb:	83 c4 10             	add    $0x10,%esp
+  8021fe:	eb b5                	jmp    8021b5 <fd_close+0x3c>
+
+00802200 <close>:
+
+int
+close(int fdnum)
+{
+  802200:	55                   	push   %ebp
+  802201:	89 e5                	mov    %esp,%ebp
+  802203:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802206:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802209:	50                   	push   %eax
+  80220a:	ff 75 08             	push   0x8(%ebp)
+  80220d:	e8 cb fe ff ff       	call   8020dd <fd_lookup>
+  802212:	83 c4 10             	add    $0x10,%esp
+  802215:	85 c0                	test   %eax,%eax
+  802217:	79 02                	jns    80221b <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  802219:	c9                   	leave
+  80221a:	c3                   	ret
+    return fd_close(fd, 1);
+  80221b:	83 ec 08             	sub    $0x8,%esp
+  80221e:	6a 01                	push   $0x1
+  802220:	ff 75 f4             	push   -0xc(%ebp)
+  802223:	e8 51 ff ff ff       	call   802179 <fd_close>
+  802228:	83 c4 10             	add    $0x10,%esp
+  80222b:	eb ec                	jmp    802219 <close+0x19>
+
+0080222d <close_all>:
+
+void
+close_all(void)
+{
+  80222d:	55                   	push   %ebp
+  80222e:	89 e5                	mov    %esp,%ebp
+  802230:	53                   	push   %ebx
+  802231:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  802234:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  802239:	83 ec 0c             	sub    $0xc,%esp
+  80223c:	53                   	push   %ebx
+  80223d:	e8 be ff ff ff       	call   802200 <close>
+  for (i = 0; i < MAXFD; i++)
+  802242:	83 c3 01             	add    $0x1,%ebx
+  802245:	83 c4 10             	add    $0x10,%esp
+  802248:	83 fb 20             	cmp    $0x20,%ebx
+  80224b:	75 ec                	jne    802239 <close_all+0xc>
+}
+  80224d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802250:	c9                   	leave
+  802251:	c3                   	ret
+
+00802252 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  802252:	55                   	push   %ebp
+  802253:	89 e5                	mov    %esp,%ebp
+  802255:	57                   	push   %edi
+  802256:	56                   	push   %esi
+  802257:	53                   	push   %ebx
+  802258:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80225b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80225e:	50                   	push   %eax
+  80225f:	ff 75 08             	push   0x8(%ebp)
+  802262:	e8 76 fe ff ff       	call   8020dd <fd_lookup>
+  802267:	89 c6                	mov    %eax,%esi
+  802269:	83 c4 10             	add    $0x10,%esp
+  80226c:	85 c0                	test   %eax,%eax
+  80226e:	0f 88 0a 01 00 00    	js     80237e <dup+0x12c>
+    return r;
+  close(newfdnum);
+  802274:	83 ec 0c             	sub    $0xc,%esp
+  802277:	ff 75 0c             	push   0xc(%ebp)
+  80227a:	e8 81 ff ff ff       	call   802200 <close>
+
+  newfd = INDEX2FD(newfdnum);
+  80227f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802282:	c1 e0 0c             	shl    $0xc,%eax
+  802285:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  80228b:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  80228e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802291:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  802294:	89 04 24             	mov    %eax,(%esp)
+  802297:	e8 d7 fd ff ff       	call   802073 <fd2data>
+  80229c:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  80229e:	89 3c 24             	mov    %edi,(%esp)
+  8022a1:	e8 cd fd ff ff       	call   802073 <fd2data>
+  8022a6:	83 c4 10             	add    $0x10,%esp
+  8022a9:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8022ac:	89 f3                	mov    %esi,%ebx
+  8022ae:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  8022b4:	89 c6                	mov    %eax,%esi
+  8022b6:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8022b9:	89 cf                	mov    %ecx,%edi
+  8022bb:	eb 0c                	jmp    8022c9 <dup+0x77>
+  8022bd:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8022c3:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8022c9:	39 fb                	cmp    %edi,%ebx
+  8022cb:	74 7b                	je     802348 <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  8022cd:	89 d8                	mov    %ebx,%eax
+  8022cf:	c1 e8 16             	shr    $0x16,%eax
+  8022d2:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8022d9:	a8 01                	test   $0x1,%al
+  8022db:	74 e0                	je     8022bd <dup+0x6b>
+  8022dd:	89 d8                	mov    %ebx,%eax
+  8022df:	c1 e8 0c             	shr    $0xc,%eax
+  8022e2:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8022e9:	f6 c2 01             	test   $0x1,%dl
+  8022ec:	74 cf                	je     8022bd <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  8022ee:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  8022f5:	83 ec 0c             	sub    $0xc,%esp
+  8022f8:	25 07 0e 00 00       	and    $0xe07,%eax
+  8022fd:	50                   	push   %eax
+  8022fe:	56                   	push   %esi
+  8022ff:	6a 00                	push   $0x0
+  802301:	53                   	push   %ebx
+  802302:	6a 00                	push   $0x0
+  802304:	e8 6b f3 ff ff       	call   801674 <sys_page_map>
+  802309:	83 c4 20             	add    $0x20,%esp
+  80230c:	85 c0                	test   %eax,%eax
+  80230e:	79 ad                	jns    8022bd <dup+0x6b>
+  802310:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  802313:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  802315:	83 ec 08             	sub    $0x8,%esp
+  802318:	ff 75 d4             	push   -0x2c(%ebp)
+  80231b:	6a 00                	push   $0x0
+  80231d:	e8 94 f3 ff ff       	call   8016b6 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  802322:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  802325:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  80232b:	83 c4 10             	add    $0x10,%esp
+  80232e:	39 df                	cmp    %ebx,%edi
+  802330:	74 4c                	je     80237e <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  802332:	83 ec 08             	sub    $0x8,%esp
+  802335:	57                   	push   %edi
+  802336:	6a 00                	push   $0x0
+  802338:	e8 79 f3 ff ff       	call   8016b6 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80233d:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  802343:	83 c4 10             	add    $0x10,%esp
+  802346:	eb e6                	jmp    80232e <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  802348:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80234b:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80234e:	89 c8                	mov    %ecx,%eax
+  802350:	c1 e8 0c             	shr    $0xc,%eax
+  802353:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80235a:	83 ec 0c             	sub    $0xc,%esp
+  80235d:	25 07 0e 00 00       	and    $0xe07,%eax
+  802362:	50                   	push   %eax
+  802363:	ff 75 d4             	push   -0x2c(%ebp)
+  802366:	6a 00                	push   $0x0
+  802368:	51                   	push   %ecx
+  802369:	6a 00                	push   $0x0
+  80236b:	e8 04 f3 ff ff       	call   801674 <sys_page_map>
+  802370:	89 c6                	mov    %eax,%esi
+  802372:	83 c4 20             	add    $0x20,%esp
+  802375:	85 c0                	test   %eax,%eax
+  802377:	78 9c                	js     802315 <dup+0xc3>
+  return newfdnum;
+  802379:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80237c:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  80237e:	89 f0                	mov    %esi,%eax
+  802380:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802383:	5b                   	pop    %ebx
+  802384:	5e                   	pop    %esi
+  802385:	5f                   	pop    %edi
+  802386:	5d                   	pop    %ebp
+  802387:	c3                   	ret
+
+00802388 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  802388:	55                   	push   %ebp
+  802389:	89 e5                	mov    %esp,%ebp
+  80238b:	56                   	push   %esi
+  80238c:	53                   	push   %ebx
+  80238d:	83 ec 18             	sub    $0x18,%esp
+  802390:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  802393:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802396:	50                   	push   %eax
+  802397:	56                   	push   %esi
+  802398:	e8 40 fd ff ff       	call   8020dd <fd_lookup>
+  80239d:	83 c4 10             	add    $0x10,%esp
+  8023a0:	85 c0                	test   %eax,%eax
+  8023a2:	78 3c                	js     8023e0 <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8023a4:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8023a7:	83 ec 08             	sub    $0x8,%esp
+  8023aa:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8023ad:	50                   	push   %eax
+  8023ae:	ff 33                	push   (%ebx)
+  8023b0:	e8 78 fd ff ff       	call   80212d <dev_lookup>
+  8023b5:	83 c4 10             	add    $0x10,%esp
+  8023b8:	85 c0                	test   %eax,%eax
+  8023ba:	78 24                	js     8023e0 <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8023bc:	8b 43 08             	mov    0x8(%ebx),%eax
+  8023bf:	83 e0 03             	and    $0x3,%eax
+  8023c2:	83 f8 01             	cmp    $0x1,%eax
+  8023c5:	74 20                	je     8023e7 <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  8023c7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8023ca:	8b 40 08             	mov    0x8(%eax),%eax
+  8023cd:	85 c0                	test   %eax,%eax
+  8023cf:	74 37                	je     802408 <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  8023d1:	83 ec 04             	sub    $0x4,%esp
+  8023d4:	ff 75 10             	push   0x10(%ebp)
+  8023d7:	ff 75 0c             	push   0xc(%ebp)
+  8023da:	53                   	push   %ebx
+  8023db:	ff d0                	call   *%eax
+  8023dd:	83 c4 10             	add    $0x10,%esp
+}
+  8023e0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023e3:	5b                   	pop    %ebx
+  8023e4:	5e                   	pop    %esi
+  8023e5:	5d                   	pop    %ebp
+  8023e6:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8023e7:	a1 e0 83 80 00       	mov    0x8083e0,%eax
+  8023ec:	8b 40 48             	mov    0x48(%eax),%eax
+  8023ef:	83 ec 04             	sub    $0x4,%esp
+  8023f2:	56                   	push   %esi
+  8023f3:	50                   	push   %eax
+  8023f4:	68 0d 53 80 00       	push   $0x80530d
+  8023f9:	e8 26 e7 ff ff       	call   800b24 <cprintf>
+    return -E_INVAL;
+  8023fe:	83 c4 10             	add    $0x10,%esp
+  802401:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802406:	eb d8                	jmp    8023e0 <read+0x58>
+    return -E_NOT_SUPP;
+  802408:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80240d:	eb d1                	jmp    8023e0 <read+0x58>
+
+0080240f <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80240f:	55                   	push   %ebp
+  802410:	89 e5                	mov    %esp,%ebp
+  802412:	57                   	push   %edi
+  802413:	56                   	push   %esi
+  802414:	53                   	push   %ebx
+  802415:	83 ec 0c             	sub    $0xc,%esp
+  802418:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80241b:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  80241e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802423:	eb 02                	jmp    802427 <readn+0x18>
+  802425:	01 c3                	add    %eax,%ebx
+  802427:	39 f3                	cmp    %esi,%ebx
+  802429:	73 21                	jae    80244c <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  80242b:	83 ec 04             	sub    $0x4,%esp
+  80242e:	89 f0                	mov    %esi,%eax
+  802430:	29 d8                	sub    %ebx,%eax
+  802432:	50                   	push   %eax
+  802433:	89 d8                	mov    %ebx,%eax
+  802435:	03 45 0c             	add    0xc(%ebp),%eax
+  802438:	50                   	push   %eax
+  802439:	57                   	push   %edi
+  80243a:	e8 49 ff ff ff       	call   802388 <read>
+    if (m < 0)
+  80243f:	83 c4 10             	add    $0x10,%esp
+  802442:	85 c0                	test   %eax,%eax
+  802444:	78 04                	js     80244a <readn+0x3b>
+      return m;
+    if (m == 0)
+  802446:	75 dd                	jne    802425 <readn+0x16>
+  802448:	eb 02                	jmp    80244c <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  80244a:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  80244c:	89 d8                	mov    %ebx,%eax
+  80244e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802451:	5b                   	pop    %ebx
+  802452:	5e                   	pop    %esi
+  802453:	5f                   	pop    %edi
+  802454:	5d                   	pop    %ebp
+  802455:	c3                   	ret
+
+00802456 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  802456:	55                   	push   %ebp
+  802457:	89 e5                	mov    %esp,%ebp
+  802459:	56                   	push   %esi
+  80245a:	53                   	push   %ebx
+  80245b:	83 ec 18             	sub    $0x18,%esp
+  80245e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  802461:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  802464:	50                   	push   %eax
+  802465:	53                   	push   %ebx
+  802466:	e8 72 fc ff ff       	call   8020dd <fd_lookup>
+  80246b:	83 c4 10             	add    $0x10,%esp
+  80246e:	85 c0                	test   %eax,%eax
+  802470:	78 37                	js     8024a9 <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  802472:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802475:	83 ec 08             	sub    $0x8,%esp
+  802478:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80247b:	50                   	push   %eax
+  80247c:	ff 36                	push   (%esi)
+  80247e:	e8 aa fc ff ff       	call   80212d <dev_lookup>
+  802483:	83 c4 10             	add    $0x10,%esp
+  802486:	85 c0                	test   %eax,%eax
+  802488:	78 1f                	js     8024a9 <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80248a:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80248e:	74 20                	je     8024b0 <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  802490:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802493:	8b 40 0c             	mov    0xc(%eax),%eax
+  802496:	85 c0                	test   %eax,%eax
+  802498:	74 37                	je     8024d1 <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  80249a:	83 ec 04             	sub    $0x4,%esp
+  80249d:	ff 75 10             	push   0x10(%ebp)
+  8024a0:	ff 75 0c             	push   0xc(%ebp)
+  8024a3:	56                   	push   %esi
+  8024a4:	ff d0                	call   *%eax
+  8024a6:	83 c4 10             	add    $0x10,%esp
+}
+  8024a9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8024ac:	5b                   	pop    %ebx
+  8024ad:	5e                   	pop    %esi
+  8024ae:	5d                   	pop    %ebp
+  8024af:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8024b0:	a1 e0 83 80 00       	mov    0x8083e0,%eax
+  8024b5:	8b 40 48             	mov    0x48(%eax),%eax
+  8024b8:	83 ec 04             	sub    $0x4,%esp
+  8024bb:	53                   	push   %ebx
+  8024bc:	50                   	push   %eax
+  8024bd:	68 29 53 80 00       	push   $0x805329
+  8024c2:	e8 5d e6 ff ff       	call   800b24 <cprintf>
+    return -E_INVAL;
+  8024c7:	83 c4 10             	add    $0x10,%esp
+  8024ca:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8024cf:	eb d8                	jmp    8024a9 <write+0x53>
+    return -E_NOT_SUPP;
+  8024d1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8024d6:	eb d1                	jmp    8024a9 <write+0x53>
+
+008024d8 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8024d8:	55                   	push   %ebp
+  8024d9:	89 e5                	mov    %esp,%ebp
+  8024db:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8024de:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8024e1:	50                   	push   %eax
+  8024e2:	ff 75 08             	push   0x8(%ebp)
+  8024e5:	e8 f3 fb ff ff       	call   8020dd <fd_lookup>
+  8024ea:	83 c4 10             	add    $0x10,%esp
+  8024ed:	85 c0                	test   %eax,%eax
+  8024ef:	78 0e                	js     8024ff <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  8024f1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8024f4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8024f7:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  8024fa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024ff:	c9                   	leave
+  802500:	c3                   	ret
+
+00802501 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  802501:	55                   	push   %ebp
+  802502:	89 e5                	mov    %esp,%ebp
+  802504:	56                   	push   %esi
+  802505:	53                   	push   %ebx
+  802506:	83 ec 18             	sub    $0x18,%esp
+  802509:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  80250c:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80250f:	50                   	push   %eax
+  802510:	53                   	push   %ebx
+  802511:	e8 c7 fb ff ff       	call   8020dd <fd_lookup>
+  802516:	83 c4 10             	add    $0x10,%esp
+  802519:	85 c0                	test   %eax,%eax
+  80251b:	78 34                	js     802551 <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80251d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  802520:	83 ec 08             	sub    $0x8,%esp
+  802523:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802526:	50                   	push   %eax
+  802527:	ff 36                	push   (%esi)
+  802529:	e8 ff fb ff ff       	call   80212d <dev_lookup>
+  80252e:	83 c4 10             	add    $0x10,%esp
+  802531:	85 c0                	test   %eax,%eax
+  802533:	78 1c                	js     802551 <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802535:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  802539:	74 1d                	je     802558 <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  80253b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80253e:	8b 40 18             	mov    0x18(%eax),%eax
+  802541:	85 c0                	test   %eax,%eax
+  802543:	74 34                	je     802579 <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  802545:	83 ec 08             	sub    $0x8,%esp
+  802548:	ff 75 0c             	push   0xc(%ebp)
+  80254b:	56                   	push   %esi
+  80254c:	ff d0                	call   *%eax
+  80254e:	83 c4 10             	add    $0x10,%esp
+}
+  802551:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802554:	5b                   	pop    %ebx
+  802555:	5e                   	pop    %esi
+  802556:	5d                   	pop    %ebp
+  802557:	c3                   	ret
+            thisenv->env_id, fdnum);
+  802558:	a1 e0 83 80 00       	mov    0x8083e0,%eax
+  80255d:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802560:	83 ec 04             	sub    $0x4,%esp
+  802563:	53                   	push   %ebx
+  802564:	50                   	push   %eax
+  802565:	68 ec 52 80 00       	push   $0x8052ec
+  80256a:	e8 b5 e5 ff ff       	call   800b24 <cprintf>
+    return -E_INVAL;
+  80256f:	83 c4 10             	add    $0x10,%esp
+  802572:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802577:	eb d8                	jmp    802551 <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  802579:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80257e:	eb d1                	jmp    802551 <ftruncate+0x50>
+
+00802580 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  802580:	55                   	push   %ebp
+  802581:	89 e5                	mov    %esp,%ebp
+  802583:	56                   	push   %esi
+  802584:	53                   	push   %ebx
+  802585:	83 ec 18             	sub    $0x18,%esp
+  802588:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  80258b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80258e:	50                   	push   %eax
+  80258f:	ff 75 08             	push   0x8(%ebp)
+  802592:	e8 46 fb ff ff       	call   8020dd <fd_lookup>
+  802597:	83 c4 10             	add    $0x10,%esp
+  80259a:	85 c0                	test   %eax,%eax
+  80259c:	78 49                	js     8025e7 <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80259e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8025a1:	83 ec 08             	sub    $0x8,%esp
+  8025a4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8025a7:	50                   	push   %eax
+  8025a8:	ff 36                	push   (%esi)
+  8025aa:	e8 7e fb ff ff       	call   80212d <dev_lookup>
+  8025af:	83 c4 10             	add    $0x10,%esp
+  8025b2:	85 c0                	test   %eax,%eax
+  8025b4:	78 31                	js     8025e7 <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  8025b6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025b9:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8025bd:	74 2f                	je     8025ee <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  8025bf:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  8025c2:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8025c9:	00 00 00 
+  stat->st_isdir = 0;
+  8025cc:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8025d3:	00 00 00 
+  stat->st_dev = dev;
+  8025d6:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  8025dc:	83 ec 08             	sub    $0x8,%esp
+  8025df:	53                   	push   %ebx
+  8025e0:	56                   	push   %esi
+  8025e1:	ff 50 14             	call   *0x14(%eax)
+  8025e4:	83 c4 10             	add    $0x10,%esp
+}
+  8025e7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025ea:	5b                   	pop    %ebx
+  8025eb:	5e                   	pop    %esi
+  8025ec:	5d                   	pop    %ebp
+  8025ed:	c3                   	ret
+    return -E_NOT_SUPP;
+  8025ee:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8025f3:	eb f2                	jmp    8025e7 <fstat+0x67>
+
+008025f5 <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  8025f5:	55                   	push   %ebp
+  8025f6:	89 e5                	mov    %esp,%ebp
+  8025f8:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  8025fb:	ff 75 0c             	push   0xc(%ebp)
+  8025fe:	ff 75 08             	push   0x8(%ebp)
+  802601:	e8 58 07 00 00       	call   802d5e <file_stat>
+}
+  802606:	c9                   	leave
+  802607:	c3                   	ret
+
+00802608 <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  802608:	55                   	push   %ebp
+  802609:	89 e5                	mov    %esp,%ebp
+  80260b:	57                   	push   %edi
+  80260c:	56                   	push   %esi
+  80260d:	53                   	push   %ebx
+  80260e:	83 ec 1c             	sub    $0x1c,%esp
+  802611:	89 c7                	mov    %eax,%edi
+  802613:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  802616:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  802619:	e9 a2 00 00 00       	jmp    8026c0 <fsipc_send+0xb8>
+  nfsenvs = 0;
+  80261e:	c7 05 20 74 80 00 00 	movl   $0x0,0x807420
+  802625:	00 00 00 
+  802628:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80262d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  802632:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  802637:	be 01 00 00 00       	mov    $0x1,%esi
+  80263c:	eb 0f                	jmp    80264d <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  80263e:	83 c0 01             	add    $0x1,%eax
+  802641:	3d 00 04 00 00       	cmp    $0x400,%eax
+  802646:	74 49                	je     802691 <fsipc_send+0x89>
+  802648:	83 f9 07             	cmp    $0x7,%ecx
+  80264b:	7f 50                	jg     80269d <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  80264d:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  802650:	c1 e2 04             	shl    $0x4,%edx
+  802653:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802659:	8b 52 50             	mov    0x50(%edx),%edx
+  80265c:	83 fa 01             	cmp    $0x1,%edx
+  80265f:	75 dd                	jne    80263e <fsipc_send+0x36>
+  802661:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  802664:	c1 e2 04             	shl    $0x4,%edx
+  802667:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80266d:	8b 52 54             	mov    0x54(%edx),%edx
+  802670:	85 d2                	test   %edx,%edx
+  802672:	74 ca                	je     80263e <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  802674:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  802677:	c1 e2 04             	shl    $0x4,%edx
+  80267a:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  802680:	8b 52 48             	mov    0x48(%edx),%edx
+  802683:	89 14 8d 40 74 80 00 	mov    %edx,0x807440(,%ecx,4)
+  80268a:	8d 49 01             	lea    0x1(%ecx),%ecx
+  80268d:	89 f3                	mov    %esi,%ebx
+  80268f:	eb ad                	jmp    80263e <fsipc_send+0x36>
+  802691:	84 db                	test   %bl,%bl
+  802693:	74 38                	je     8026cd <fsipc_send+0xc5>
+  802695:	89 0d 20 74 80 00    	mov    %ecx,0x807420
+  80269b:	eb 30                	jmp    8026cd <fsipc_send+0xc5>
+  80269d:	84 db                	test   %bl,%bl
+  80269f:	74 2c                	je     8026cd <fsipc_send+0xc5>
+  8026a1:	89 0d 20 74 80 00    	mov    %ecx,0x807420
+  8026a7:	eb 24                	jmp    8026cd <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  8026a9:	50                   	push   %eax
+  8026aa:	68 58 53 80 00       	push   $0x805358
+  8026af:	6a 34                	push   $0x34
+  8026b1:	68 62 53 80 00       	push   $0x805362
+  8026b6:	e8 8e e3 ff ff       	call   800a49 <_panic>
+    }
+    sys_yield();
+  8026bb:	e8 0f ef ff ff       	call   8015cf <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  8026c0:	83 3d 20 74 80 00 03 	cmpl   $0x3,0x807420
+  8026c7:	0f 8e 51 ff ff ff    	jle    80261e <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  8026cd:	a1 e0 83 80 00       	mov    0x8083e0,%eax
+  8026d2:	8b 70 48             	mov    0x48(%eax),%esi
+  8026d5:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  8026db:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8026e0:	8b 0d 20 74 80 00    	mov    0x807420,%ecx
+  8026e6:	39 d9                	cmp    %ebx,%ecx
+  8026e8:	7e d1                	jle    8026bb <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  8026ea:	83 ec 0c             	sub    $0xc,%esp
+  8026ed:	ff 75 e0             	push   -0x20(%ebp)
+  8026f0:	6a 07                	push   $0x7
+  8026f2:	ff 75 e4             	push   -0x1c(%ebp)
+  8026f5:	57                   	push   %edi
+  8026f6:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  8026f9:	99                   	cltd
+  8026fa:	f7 f9                	idiv   %ecx
+  8026fc:	ff 34 95 40 74 80 00 	push   0x807440(,%edx,4)
+  802703:	e8 e0 f1 ff ff       	call   8018e8 <sys_ipc_try_send>
+      if (r == 0)
+  802708:	83 c4 20             	add    $0x20,%esp
+  80270b:	85 c0                	test   %eax,%eax
+  80270d:	74 0a                	je     802719 <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  80270f:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802712:	75 95                	jne    8026a9 <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  802714:	83 c3 01             	add    $0x1,%ebx
+  802717:	eb c7                	jmp    8026e0 <fsipc_send+0xd8>
+  }
+}
+  802719:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80271c:	5b                   	pop    %ebx
+  80271d:	5e                   	pop    %esi
+  80271e:	5f                   	pop    %edi
+  80271f:	5d                   	pop    %ebp
+  802720:	c3                   	ret
+
+00802721 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  802721:	55                   	push   %ebp
+  802722:	89 e5                	mov    %esp,%ebp
+  802724:	53                   	push   %ebx
+  802725:	83 ec 14             	sub    $0x14,%esp
+  802728:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  80272a:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  802731:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802736:	ba 00 90 80 00       	mov    $0x809000,%edx
+  80273b:	e8 c8 fe ff ff       	call   802608 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  802740:	6a 00                	push   $0x0
+  802742:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802745:	50                   	push   %eax
+  802746:	53                   	push   %ebx
+  802747:	6a 00                	push   $0x0
+  802749:	e8 3f 21 00 00       	call   80488d <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  80274e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802751:	c9                   	leave
+  802752:	c3                   	ret
+
+00802753 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  802753:	55                   	push   %ebp
+  802754:	89 e5                	mov    %esp,%ebp
+  802756:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802759:	8b 45 08             	mov    0x8(%ebp),%eax
+  80275c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80275f:	a3 00 90 80 00       	mov    %eax,0x809000
+  fsipcbuf.set_size.req_size = newsize;
+  802764:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802767:	a3 04 90 80 00       	mov    %eax,0x809004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  80276c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802771:	b8 02 00 00 00       	mov    $0x2,%eax
+  802776:	e8 a6 ff ff ff       	call   802721 <fsipc>
+}
+  80277b:	c9                   	leave
+  80277c:	c3                   	ret
+
+0080277d <devfile_flush>:
+{
+  80277d:	55                   	push   %ebp
+  80277e:	89 e5                	mov    %esp,%ebp
+  802780:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802783:	8b 45 08             	mov    0x8(%ebp),%eax
+  802786:	8b 40 0c             	mov    0xc(%eax),%eax
+  802789:	a3 00 90 80 00       	mov    %eax,0x809000
+  return fsipc(FSREQ_FLUSH, NULL);
+  80278e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802793:	b8 06 00 00 00       	mov    $0x6,%eax
+  802798:	e8 84 ff ff ff       	call   802721 <fsipc>
+}
+  80279d:	c9                   	leave
+  80279e:	c3                   	ret
+
+0080279f <devfile_stat>:
+{
+  80279f:	55                   	push   %ebp
+  8027a0:	89 e5                	mov    %esp,%ebp
+  8027a2:	53                   	push   %ebx
+  8027a3:	83 ec 04             	sub    $0x4,%esp
+  8027a6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8027a9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8027ac:	8b 40 0c             	mov    0xc(%eax),%eax
+  8027af:	a3 00 90 80 00       	mov    %eax,0x809000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8027b4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027b9:	b8 05 00 00 00       	mov    $0x5,%eax
+  8027be:	e8 5e ff ff ff       	call   802721 <fsipc>
+  8027c3:	85 c0                	test   %eax,%eax
+  8027c5:	78 2c                	js     8027f3 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8027c7:	83 ec 08             	sub    $0x8,%esp
+  8027ca:	68 00 90 80 00       	push   $0x809000
+  8027cf:	53                   	push   %ebx
+  8027d0:	e8 2d ea ff ff       	call   801202 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  8027d5:	a1 80 90 80 00       	mov    0x809080,%eax
+  8027da:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8027e0:	a1 84 90 80 00       	mov    0x809084,%eax
+  8027e5:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  8027eb:	83 c4 10             	add    $0x10,%esp
+  8027ee:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8027f3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8027f6:	c9                   	leave
+  8027f7:	c3                   	ret
+
+008027f8 <fsv_alloc>:
+{
+  8027f8:	55                   	push   %ebp
+  8027f9:	89 e5                	mov    %esp,%ebp
+  8027fb:	56                   	push   %esi
+  8027fc:	53                   	push   %ebx
+  8027fd:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  8027ff:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802804:	eb 22                	jmp    802828 <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  802806:	83 ec 04             	sub    $0x4,%esp
+  802809:	6a 00                	push   $0x0
+  80280b:	6a 00                	push   $0x0
+  80280d:	6a 07                	push   $0x7
+  80280f:	50                   	push   %eax
+  802810:	6a 00                	push   $0x0
+  802812:	6a 04                	push   $0x4
+  802814:	68 60 74 80 00       	push   $0x807460
+  802819:	e8 66 f2 ff ff       	call   801a84 <sysbatch_add>
+  80281e:	83 c4 20             	add    $0x20,%esp
+  802821:	85 c0                	test   %eax,%eax
+  802823:	78 48                	js     80286d <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  802825:	83 c3 01             	add    $0x1,%ebx
+  802828:	39 f3                	cmp    %esi,%ebx
+  80282a:	74 31                	je     80285d <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  80282c:	89 d8                	mov    %ebx,%eax
+  80282e:	c1 e0 0c             	shl    $0xc,%eax
+  802831:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  802836:	89 c2                	mov    %eax,%edx
+  802838:	c1 ea 16             	shr    $0x16,%edx
+  80283b:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802842:	f6 c2 01             	test   $0x1,%dl
+  802845:	74 bf                	je     802806 <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  802847:	89 c2                	mov    %eax,%edx
+  802849:	c1 ea 0c             	shr    $0xc,%edx
+  80284c:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  802853:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  802856:	83 fa 03             	cmp    $0x3,%edx
+  802859:	75 ab                	jne    802806 <fsv_alloc+0xe>
+  80285b:	eb c8                	jmp    802825 <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  80285d:	83 ec 0c             	sub    $0xc,%esp
+  802860:	68 60 74 80 00       	push   $0x807460
+  802865:	e8 ca f1 ff ff       	call   801a34 <sysbatch_flush>
+  80286a:	83 c4 10             	add    $0x10,%esp
+}
+  80286d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802870:	5b                   	pop    %ebx
+  802871:	5e                   	pop    %esi
+  802872:	5d                   	pop    %ebp
+  802873:	c3                   	ret
+
+00802874 <devfile_read>:
+{
+  802874:	55                   	push   %ebp
+  802875:	89 e5                	mov    %esp,%ebp
+  802877:	57                   	push   %edi
+  802878:	56                   	push   %esi
+  802879:	53                   	push   %ebx
+  80287a:	83 ec 3c             	sub    $0x3c,%esp
+  80287d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  802880:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  802886:	77 57                	ja     8028df <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802888:	8b 45 08             	mov    0x8(%ebp),%eax
+  80288b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80288e:	a3 00 90 80 00       	mov    %eax,0x809000
+  fsipcbuf.read.req_n = n;
+  802893:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  802899:	ba 00 00 00 00       	mov    $0x0,%edx
+  80289e:	b8 03 00 00 00       	mov    $0x3,%eax
+  8028a3:	e8 79 fe ff ff       	call   802721 <fsipc>
+  8028a8:	89 c6                	mov    %eax,%esi
+  8028aa:	85 c0                	test   %eax,%eax
+  8028ac:	78 27                	js     8028d5 <devfile_read+0x61>
+  assert(r <= n);
+  8028ae:	39 c3                	cmp    %eax,%ebx
+  8028b0:	0f 82 0e 02 00 00    	jb     802ac4 <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  8028b6:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8028bb:	0f 8f 1c 02 00 00    	jg     802add <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8028c1:	83 ec 04             	sub    $0x4,%esp
+  8028c4:	50                   	push   %eax
+  8028c5:	68 00 90 80 00       	push   $0x809000
+  8028ca:	ff 75 0c             	push   0xc(%ebp)
+  8028cd:	e8 b6 ea ff ff       	call   801388 <memmove>
+  return r;
+  8028d2:	83 c4 10             	add    $0x10,%esp
+}
+  8028d5:	89 f0                	mov    %esi,%eax
+  8028d7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028da:	5b                   	pop    %ebx
+  8028db:	5e                   	pop    %esi
+  8028dc:	5f                   	pop    %edi
+  8028dd:	5d                   	pop    %ebp
+  8028de:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  8028df:	b8 01 00 00 00       	mov    $0x1,%eax
+  8028e4:	e8 0f ff ff ff       	call   8027f8 <fsv_alloc>
+  8028e9:	89 c6                	mov    %eax,%esi
+  8028eb:	85 c0                	test   %eax,%eax
+  8028ed:	78 e6                	js     8028d5 <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  8028ef:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028f2:	8b 40 0c             	mov    0xc(%eax),%eax
+  8028f5:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  8028fa:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028fd:	8b 40 04             	mov    0x4(%eax),%eax
+  802900:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  802905:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  80290b:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  802912:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802917:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  80291c:	b8 0c 00 00 00       	mov    $0xc,%eax
+  802921:	e8 e2 fc ff ff       	call   802608 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  802926:	6a 00                	push   $0x0
+  802928:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80292b:	50                   	push   %eax
+  80292c:	68 00 10 c0 9f       	push   $0x9fc01000
+  802931:	6a 00                	push   $0x0
+  802933:	e8 55 1f 00 00       	call   80488d <ipc_recv_pages>
+  802938:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  80293a:	83 c4 10             	add    $0x10,%esp
+  80293d:	85 c0                	test   %eax,%eax
+  80293f:	7e 94                	jle    8028d5 <devfile_read+0x61>
+  assert(r <= n);
+  802941:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802944:	39 c3                	cmp    %eax,%ebx
+  802946:	72 2e                	jb     802976 <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  802948:	8b 45 08             	mov    0x8(%ebp),%eax
+  80294b:	8b 40 04             	mov    0x4(%eax),%eax
+  80294e:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802953:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  802956:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802959:	c1 e2 0c             	shl    $0xc,%edx
+  80295c:	39 ca                	cmp    %ecx,%edx
+  80295e:	72 2f                	jb     80298f <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  802960:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  802965:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  802968:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  80296c:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  802971:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  802974:	eb 52                	jmp    8029c8 <devfile_read+0x154>
+  assert(r <= n);
+  802976:	68 6d 53 80 00       	push   $0x80536d
+  80297b:	68 cf 4d 80 00       	push   $0x804dcf
+  802980:	68 49 01 00 00       	push   $0x149
+  802985:	68 62 53 80 00       	push   $0x805362
+  80298a:	e8 ba e0 ff ff       	call   800a49 <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  80298f:	68 80 53 80 00       	push   $0x805380
+  802994:	68 cf 4d 80 00       	push   $0x804dcf
+  802999:	68 4a 01 00 00       	push   $0x14a
+  80299e:	68 62 53 80 00       	push   $0x805362
+  8029a3:	e8 a1 e0 ff ff       	call   800a49 <_panic>
+      memmove(dst + done, src + done, m);
+  8029a8:	83 ec 04             	sub    $0x4,%esp
+  8029ab:	53                   	push   %ebx
+  8029ac:	56                   	push   %esi
+  8029ad:	89 f8                	mov    %edi,%eax
+  8029af:	03 45 0c             	add    0xc(%ebp),%eax
+  8029b2:	50                   	push   %eax
+  8029b3:	e8 d0 e9 ff ff       	call   801388 <memmove>
+  8029b8:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  8029bb:	01 df                	add    %ebx,%edi
+  8029bd:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8029c0:	39 c7                	cmp    %eax,%edi
+  8029c2:	0f 83 c0 00 00 00    	jae    802a88 <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  8029c8:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8029cb:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  8029ce:	89 f0                	mov    %esi,%eax
+  8029d0:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8029d5:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  8029da:	29 c3                	sub    %eax,%ebx
+  8029dc:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8029df:	29 f8                	sub    %edi,%eax
+  8029e1:	39 c3                	cmp    %eax,%ebx
+  8029e3:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  8029e6:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  8029ec:	75 ba                	jne    8029a8 <devfile_read+0x134>
+  8029ee:	89 f9                	mov    %edi,%ecx
+  8029f0:	03 4d 0c             	add    0xc(%ebp),%ecx
+  8029f3:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  8029f6:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  8029fc:	75 aa                	jne    8029a8 <devfile_read+0x134>
+  8029fe:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  802a04:	77 a2                	ja     8029a8 <devfile_read+0x134>
+  802a06:	89 c8                	mov    %ecx,%eax
+  802a08:	c1 e8 16             	shr    $0x16,%eax
+  802a0b:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  802a12:	a8 01                	test   $0x1,%al
+  802a14:	74 92                	je     8029a8 <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  802a16:	89 c8                	mov    %ecx,%eax
+  802a18:	c1 e8 0c             	shr    $0xc,%eax
+  802a1b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  802a22:	a8 01                	test   $0x1,%al
+  802a24:	74 82                	je     8029a8 <devfile_read+0x134>
+  802a26:	a9 02 08 00 00       	test   $0x802,%eax
+  802a2b:	0f 84 77 ff ff ff    	je     8029a8 <devfile_read+0x134>
+  802a31:	f6 c4 04             	test   $0x4,%ah
+  802a34:	0f 85 6e ff ff ff    	jne    8029a8 <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  802a3a:	a1 e0 83 80 00       	mov    0x8083e0,%eax
+  802a3f:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  802a43:	84 c0                	test   %al,%al
+  802a45:	75 17                	jne    802a5e <devfile_read+0x1ea>
+  802a47:	83 ec 08             	sub    $0x8,%esp
+  802a4a:	6a 01                	push   $0x1
+  802a4c:	6a 00                	push   $0x0
+  802a4e:	e8 9b eb ff ff       	call   8015ee <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  802a53:	83 c4 10             	add    $0x10,%esp
+  802a56:	85 c0                	test   %eax,%eax
+  802a58:	0f 85 4a ff ff ff    	jne    8029a8 <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  802a5e:	83 ec 04             	sub    $0x4,%esp
+  802a61:	68 05 08 00 00       	push   $0x805
+  802a66:	ff 75 cc             	push   -0x34(%ebp)
+  802a69:	6a 00                	push   $0x0
+  802a6b:	56                   	push   %esi
+  802a6c:	6a 00                	push   $0x0
+  802a6e:	6a 05                	push   $0x5
+  802a70:	68 60 74 80 00       	push   $0x807460
+  802a75:	e8 0a f0 ff ff       	call   801a84 <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  802a7a:	c1 e8 1f             	shr    $0x1f,%eax
+  802a7d:	08 45 cb             	or     %al,-0x35(%ebp)
+  802a80:	83 c4 20             	add    $0x20,%esp
+  802a83:	e9 33 ff ff ff       	jmp    8029bb <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  802a88:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  802a8b:	83 ec 0c             	sub    $0xc,%esp
+  802a8e:	68 60 74 80 00       	push   $0x807460
+  802a93:	e8 9c ef ff ff       	call   801a34 <sysbatch_flush>
+  802a98:	83 c4 10             	add    $0x10,%esp
+  802a9b:	85 c0                	test   %eax,%eax
+  802a9d:	78 06                	js     802aa5 <devfile_read+0x231>
+  802a9f:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  802aa3:	74 14                	je     802ab9 <devfile_read+0x245>
+    memmove(dst, src, r);
+  802aa5:	83 ec 04             	sub    $0x4,%esp
+  802aa8:	ff 75 d4             	push   -0x2c(%ebp)
+  802aab:	ff 75 d0             	push   -0x30(%ebp)
+  802aae:	ff 75 0c             	push   0xc(%ebp)
+  802ab1:	e8 d2 e8 ff ff       	call   801388 <memmove>
+  802ab6:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  802ab9:	8b 45 08             	mov    0x8(%ebp),%eax
+  802abc:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  802abf:	e9 11 fe ff ff       	jmp    8028d5 <devfile_read+0x61>
+  assert(r <= n);
+  802ac4:	68 6d 53 80 00       	push   $0x80536d
+  802ac9:	68 cf 4d 80 00       	push   $0x804dcf
+  802ace:	68 1c 01 00 00       	push   $0x11c
+  802ad3:	68 62 53 80 00       	push   $0x805362
+  802ad8:	e8 6c df ff ff       	call   800a49 <_panic>
+  assert(r <= PGSIZE);
+  802add:	68 74 53 80 00       	push   $0x805374
+  802ae2:	68 cf 4d 80 00       	push   $0x804dcf
+  802ae7:	68 1d 01 00 00       	push   $0x11d
+  802aec:	68 62 53 80 00       	push   $0x805362
+  802af1:	e8 53 df ff ff       	call   800a49 <_panic>
+
+00802af6 <devfile_write>:
+{
+  802af6:	55                   	push   %ebp
+  802af7:	89 e5                	mov    %esp,%ebp
+  802af9:	57                   	push   %edi
+  802afa:	56                   	push   %esi
+  802afb:	53                   	push   %ebx
+  802afc:	83 ec 1c             	sub    $0x1c,%esp
+  802aff:	8b 75 08             	mov    0x8(%ebp),%esi
+  802b02:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  802b05:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  802b0a:	77 39                	ja     802b45 <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802b0c:	8b 56 0c             	mov    0xc(%esi),%edx
+  802b0f:	89 15 00 90 80 00    	mov    %edx,0x809000
+  fsipcbuf.write.req_n = n;
+  802b15:	a3 04 90 80 00       	mov    %eax,0x809004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  802b1a:	83 ec 04             	sub    $0x4,%esp
+  802b1d:	50                   	push   %eax
+  802b1e:	ff 75 0c             	push   0xc(%ebp)
+  802b21:	68 08 90 80 00       	push   $0x809008
+  802b26:	e8 5d e8 ff ff       	call   801388 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  802b2b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b30:	b8 04 00 00 00       	mov    $0x4,%eax
+  802b35:	e8 e7 fb ff ff       	call   802721 <fsipc>
+  802b3a:	83 c4 10             	add    $0x10,%esp
+}
+  802b3d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b40:	5b                   	pop    %ebx
+  802b41:	5e                   	pop    %esi
+  802b42:	5f                   	pop    %edi
+  802b43:	5d                   	pop    %ebp
+  802b44:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  802b45:	ba 00 00 10 00       	mov    $0x100000,%edx
+  802b4a:	39 d0                	cmp    %edx,%eax
+  802b4c:	89 d3                	mov    %edx,%ebx
+  802b4e:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  802b51:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  802b57:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  802b5a:	83 c7 01             	add    $0x1,%edi
+  802b5d:	89 f8                	mov    %edi,%eax
+  802b5f:	e8 94 fc ff ff       	call   8027f8 <fsv_alloc>
+  802b64:	85 c0                	test   %eax,%eax
+  802b66:	78 d5                	js     802b3d <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  802b68:	83 ec 04             	sub    $0x4,%esp
+  802b6b:	53                   	push   %ebx
+  802b6c:	ff 75 0c             	push   0xc(%ebp)
+  802b6f:	68 00 10 c0 9f       	push   $0x9fc01000
+  802b74:	e8 0f e8 ff ff       	call   801388 <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  802b79:	8b 46 0c             	mov    0xc(%esi),%eax
+  802b7c:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  802b81:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  802b87:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  802b8e:	89 f9                	mov    %edi,%ecx
+  802b90:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  802b95:	b8 0d 00 00 00       	mov    $0xd,%eax
+  802b9a:	e8 69 fa ff ff       	call   802608 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  802b9f:	6a 00                	push   $0x0
+  802ba1:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802ba4:	50                   	push   %eax
+  802ba5:	6a 00                	push   $0x0
+  802ba7:	6a 00                	push   $0x0
+  802ba9:	e8 df 1c 00 00       	call   80488d <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  802bae:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  802bb1:	eb 8a                	jmp    802b3d <devfile_write+0x47>
+
+00802bb3 <open>:
+{
+  802bb3:	55                   	push   %ebp
+  802bb4:	89 e5                	mov    %esp,%ebp
+  802bb6:	56                   	push   %esi
+  802bb7:	53                   	push   %ebx
+  802bb8:	83 ec 1c             	sub    $0x1c,%esp
+  802bbb:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  802bbe:	56                   	push   %esi
+  802bbf:	e8 03 e6 ff ff       	call   8011c7 <strlen>
+  802bc4:	83 c4 10             	add    $0x10,%esp
+  802bc7:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802bcc:	7f 6c                	jg     802c3a <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  802bce:	83 ec 0c             	sub    $0xc,%esp
+  802bd1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802bd4:	50                   	push   %eax
+  802bd5:	e8 ad f4 ff ff       	call   802087 <fd_alloc>
+  802bda:	89 c3                	mov    %eax,%ebx
+  802bdc:	83 c4 10             	add    $0x10,%esp
+  802bdf:	85 c0                	test   %eax,%eax
+  802be1:	78 3c                	js     802c1f <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  802be3:	83 ec 08             	sub    $0x8,%esp
+  802be6:	56                   	push   %esi
+  802be7:	68 00 90 80 00       	push   $0x809000
+  802bec:	e8 11 e6 ff ff       	call   801202 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  802bf1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802bf4:	a3 00 94 80 00       	mov    %eax,0x809400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  802bf9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802bfc:	b8 01 00 00 00       	mov    $0x1,%eax
+  802c01:	e8 1b fb ff ff       	call   802721 <fsipc>
+  802c06:	89 c3                	mov    %eax,%ebx
+  802c08:	83 c4 10             	add    $0x10,%esp
+  802c0b:	85 c0                	test   %eax,%eax
+  802c0d:	78 19                	js     802c28 <open+0x75>
+  return fd2num(fd);
+  802c0f:	83 ec 0c             	sub    $0xc,%esp
+  802c12:	ff 75 f4             	push   -0xc(%ebp)
+  802c15:	e8 49 f4 ff ff       	call   802063 <fd2num>
+  802c1a:	89 c3                	mov    %eax,%ebx
+  802c1c:	83 c4 10             	add    $0x10,%esp
+}
+  802c1f:	89 d8                	mov    %ebx,%eax
+  802c21:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802c24:	5b                   	pop    %ebx
+  802c25:	5e                   	pop    %esi
+  802c26:	5d                   	pop    %ebp
+  802c27:	c3                   	ret
+    fd_close(fd, 0);
+  802c28:	83 ec 08             	sub    $0x8,%esp
+  802c2b:	6a 00                	push   $0x0
+  802c2d:	ff 75 f4             	push   -0xc(%ebp)
+  802c30:	e8 44 f5 ff ff       	call   802179 <fd_close>
+    return r;
+  802c35:	83 c4 10             	add    $0x10,%esp
+  802c38:	eb e5                	jmp    802c1f <open+0x6c>
+    return -E_BAD_PATH;
+  802c3a:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802c3f:	eb de                	jmp    802c1f <open+0x6c>
+
+00802c41 <open_read>:
+{
+  802c41:	55                   	push   %ebp
+  802c42:	89 e5                	mov    %esp,%ebp
+  802c44:	57                   	push   %edi
+  802c45:	56                   	push   %esi
+  802c46:	53                   	push   %ebx
+  802c47:	83 ec 28             	sub    $0x28,%esp
+  802c4a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  802c4d:	57                   	push   %edi
+  802c4e:	e8 74 e5 ff ff       	call   8011c7 <strlen>
+  802c53:	83 c4 10             	add    $0x10,%esp
+  802c56:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802c5b:	0f 87 f6 00 00 00    	ja     802d57 <open_read+0x116>
+  802c61:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  802c63:	83 ec 0c             	sub    $0xc,%esp
+  802c66:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802c69:	50                   	push   %eax
+  802c6a:	e8 18 f4 ff ff       	call   802087 <fd_alloc>
+  802c6f:	89 c3                	mov    %eax,%ebx
+  802c71:	83 c4 10             	add    $0x10,%esp
+  802c74:	85 c0                	test   %eax,%eax
+  802c76:	0f 88 b2 00 00 00    	js     802d2e <open_read+0xed>
+  strcpy(req->req_buf, path);
+  802c7c:	83 ec 08             	sub    $0x8,%esp
+  802c7f:	57                   	push   %edi
+  802c80:	68 e4 90 80 00       	push   $0x8090e4
+  802c85:	e8 78 e5 ff ff       	call   801202 <strcpy>
+  req->req_nops = 2;
+  802c8a:	c7 05 00 90 80 00 02 	movl   $0x2,0x809000
+  802c91:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  802c94:	c7 05 04 90 80 00 01 	movl   $0x1,0x809004
+  802c9b:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  802c9e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802ca1:	a3 10 90 80 00       	mov    %eax,0x809010
+  req->req_ops[0].op_buf = 0;
+  802ca6:	c7 05 18 90 80 00 00 	movl   $0x0,0x809018
+  802cad:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  802cb0:	c7 05 20 90 80 00 04 	movl   $0x4,0x809020
+  802cb7:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  802cba:	c7 05 24 90 80 00 01 	movl   $0x1,0x809024
+  802cc1:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  802cc4:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  802cc9:	29 f0                	sub    %esi,%eax
+  802ccb:	3b 45 14             	cmp    0x14(%ebp),%eax
+  802cce:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  802cd2:	a3 2c 90 80 00       	mov    %eax,0x80902c
+  req->req_ops[1].op_offset = 0;
+  802cd7:	c7 05 30 90 80 00 00 	movl   $0x0,0x809030
+  802cde:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  802ce1:	83 c6 01             	add    $0x1,%esi
+  802ce4:	89 35 34 90 80 00    	mov    %esi,0x809034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  802cea:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802ced:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802cf2:	e8 2a fa ff ff       	call   802721 <fsipc>
+  802cf7:	89 c3                	mov    %eax,%ebx
+  802cf9:	83 c4 10             	add    $0x10,%esp
+  802cfc:	83 f8 01             	cmp    $0x1,%eax
+  802cff:	7e 37                	jle    802d38 <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  802d01:	a1 38 90 80 00       	mov    0x809038,%eax
+  802d06:	8b 55 18             	mov    0x18(%ebp),%edx
+  802d09:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  802d0b:	83 ec 04             	sub    $0x4,%esp
+  802d0e:	50                   	push   %eax
+  802d0f:	81 c6 e4 90 80 00    	add    $0x8090e4,%esi
+  802d15:	56                   	push   %esi
+  802d16:	ff 75 10             	push   0x10(%ebp)
+  802d19:	e8 6a e6 ff ff       	call   801388 <memmove>
+  return fd2num(fd);
+  802d1e:	83 c4 04             	add    $0x4,%esp
+  802d21:	ff 75 e4             	push   -0x1c(%ebp)
+  802d24:	e8 3a f3 ff ff       	call   802063 <fd2num>
+  802d29:	89 c3                	mov    %eax,%ebx
+  802d2b:	83 c4 10             	add    $0x10,%esp
+}
+  802d2e:	89 d8                	mov    %ebx,%eax
+  802d30:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d33:	5b                   	pop    %ebx
+  802d34:	5e                   	pop    %esi
+  802d35:	5f                   	pop    %edi
+  802d36:	5d                   	pop    %ebp
+  802d37:	c3                   	ret
+    fd_close(fd, 0);
+  802d38:	83 ec 08             	sub    $0x8,%esp
+  802d3b:	6a 00                	push   $0x0
+  802d3d:	ff 75 e4             	push   -0x1c(%ebp)
+  802d40:	e8 34 f4 ff ff       	call   802179 <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  802d45:	83 c4 10             	add    $0x10,%esp
+  802d48:	85 db                	test   %ebx,%ebx
+  802d4a:	78 e2                	js     802d2e <open_read+0xed>
+  802d4c:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  802d4f:	8b 9b 1c 90 80 00    	mov    0x80901c(%ebx),%ebx
+  802d55:	eb d7                	jmp    802d2e <open_read+0xed>
+    return -E_BAD_PATH;
+  802d57:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802d5c:	eb d0                	jmp    802d2e <open_read+0xed>
+
+00802d5e <file_stat>:
+{
+  802d5e:	55                   	push   %ebp
+  802d5f:	89 e5                	mov    %esp,%ebp
+  802d61:	57                   	push   %edi
+  802d62:	56                   	push   %esi
+  802d63:	53                   	push   %ebx
+  802d64:	83 ec 18             	sub    $0x18,%esp
+  802d67:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802d6a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  802d6d:	57                   	push   %edi
+  802d6e:	e8 54 e4 ff ff       	call   8011c7 <strlen>
+  802d73:	83 c4 10             	add    $0x10,%esp
+  802d76:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802d7b:	0f 8f c7 00 00 00    	jg     802e48 <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  802d81:	83 ec 0c             	sub    $0xc,%esp
+  802d84:	57                   	push   %edi
+  802d85:	e8 3d e4 ff ff       	call   8011c7 <strlen>
+  802d8a:	8d 58 04             	lea    0x4(%eax),%ebx
+  802d8d:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  802d90:	83 c4 08             	add    $0x8,%esp
+  802d93:	57                   	push   %edi
+  802d94:	68 e4 90 80 00       	push   $0x8090e4
+  802d99:	e8 64 e4 ff ff       	call   801202 <strcpy>
+  req->req_nops = 2;
+  802d9e:	c7 05 00 90 80 00 02 	movl   $0x2,0x809000
+  802da5:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  802da8:	c7 05 04 90 80 00 02 	movl   $0x2,0x809004
+  802daf:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  802db2:	c7 05 10 90 80 00 00 	movl   $0x0,0x809010
+  802db9:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  802dbc:	c7 05 18 90 80 00 00 	movl   $0x0,0x809018
+  802dc3:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  802dc6:	c7 05 20 90 80 00 03 	movl   $0x3,0x809020
+  802dcd:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  802dd0:	c7 05 24 90 80 00 01 	movl   $0x1,0x809024
+  802dd7:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  802dda:	89 1d 34 90 80 00    	mov    %ebx,0x809034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  802de0:	ba 00 00 00 00       	mov    $0x0,%edx
+  802de5:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802dea:	e8 32 f9 ff ff       	call   802721 <fsipc>
+  802def:	83 c4 10             	add    $0x10,%esp
+  802df2:	83 f8 01             	cmp    $0x1,%eax
+  802df5:	7e 42                	jle    802e39 <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  802df7:	81 c3 e4 90 80 00    	add    $0x8090e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  802dfd:	83 ec 08             	sub    $0x8,%esp
+  802e00:	53                   	push   %ebx
+  802e01:	56                   	push   %esi
+  802e02:	e8 fb e3 ff ff       	call   801202 <strcpy>
+  st->st_size = ret->ret_size;
+  802e07:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  802e0d:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  802e13:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  802e19:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  802e1f:	c7 86 88 00 00 00 20 	movl   $0x806020,0x88(%esi)
+  802e26:	60 80 00 
+  return 0;
+  802e29:	83 c4 10             	add    $0x10,%esp
+  802e2c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e31:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e34:	5b                   	pop    %ebx
+  802e35:	5e                   	pop    %esi
+  802e36:	5f                   	pop    %edi
+  802e37:	5d                   	pop    %ebp
+  802e38:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  802e39:	85 c0                	test   %eax,%eax
+  802e3b:	78 f4                	js     802e31 <file_stat+0xd3>
+  802e3d:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802e40:	8b 80 1c 90 80 00    	mov    0x80901c(%eax),%eax
+  802e46:	eb e9                	jmp    802e31 <file_stat+0xd3>
+    return -E_BAD_PATH;
+  802e48:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802e4d:	eb e2                	jmp    802e31 <file_stat+0xd3>
+
+00802e4f <read_map>:
+{
+  802e4f:	55                   	push   %ebp
+  802e50:	89 e5                	mov    %esp,%ebp
+  802e52:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802e55:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802e58:	50                   	push   %eax
+  802e59:	ff 75 08             	push   0x8(%ebp)
+  802e5c:	e8 7c f2 ff ff       	call   8020dd <fd_lookup>
+  802e61:	83 c4 10             	add    $0x10,%esp
+  802e64:	85 c0                	test   %eax,%eax
+  802e66:	78 2a                	js     802e92 <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  802e68:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802e6b:	8b 0d 20 60 80 00    	mov    0x806020,%ecx
+  802e71:	39 08                	cmp    %ecx,(%eax)
+  802e73:	75 1f                	jne    802e94 <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  802e75:	8b 40 0c             	mov    0xc(%eax),%eax
+  802e78:	a3 00 90 80 00       	mov    %eax,0x809000
+  fsipcbuf.read_map.req_offset = offset;
+  802e7d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802e80:	a3 04 90 80 00       	mov    %eax,0x809004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  802e85:	8b 55 10             	mov    0x10(%ebp),%edx
+  802e88:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802e8d:	e8 8f f8 ff ff       	call   802721 <fsipc>
+}
+  802e92:	c9                   	leave
+  802e93:	c3                   	ret
+    return -E_INVAL;
+  802e94:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e99:	eb f7                	jmp    802e92 <read_map+0x43>
+
+00802e9b <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802e9b:	55                   	push   %ebp
+  802e9c:	89 e5                	mov    %esp,%ebp
+  802e9e:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  802ea1:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ea6:	b8 08 00 00 00       	mov    $0x8,%eax
+  802eab:	e8 71 f8 ff ff       	call   802721 <fsipc>
+}
+  802eb0:	c9                   	leave
+  802eb1:	c3                   	ret
+
+00802eb2 <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  802eb2:	55                   	push   %ebp
+  802eb3:	89 e5                	mov    %esp,%ebp
+  802eb5:	57                   	push   %edi
+  802eb6:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  802eb7:	8b 45 08             	mov    0x8(%ebp),%eax
+  802eba:	a3 00 90 80 00       	mov    %eax,0x809000
+  fsipcbuf.stats.req_bio_sched = 0;
+  802ebf:	c7 05 04 90 80 00 00 	movl   $0x0,0x809004
+  802ec6:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  802ec9:	c7 05 08 90 80 00 00 	movl   $0x0,0x809008
+  802ed0:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  802ed3:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ed8:	b8 09 00 00 00       	mov    $0x9,%eax
+  802edd:	e8 3f f8 ff ff       	call   802721 <fsipc>
+  802ee2:	85 c0                	test   %eax,%eax
+  802ee4:	78 14                	js     802efa <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  802ee6:	be 00 90 80 00       	mov    $0x809000,%esi
+  802eeb:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802ef0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802ef3:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  802ef5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802efa:	5e                   	pop    %esi
+  802efb:	5f                   	pop    %edi
+  802efc:	5d                   	pop    %ebp
+  802efd:	c3                   	ret
+
+00802efe <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  802efe:	55                   	push   %ebp
+  802eff:	89 e5                	mov    %esp,%ebp
+  802f01:	53                   	push   %ebx
+  802f02:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  802f05:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802f08:	50                   	push   %eax
+  802f09:	6a 00                	push   $0x0
+  802f0b:	e8 a2 ff ff ff       	call   802eb2 <fs_stats>
+  802f10:	83 c4 10             	add    $0x10,%esp
+  802f13:	85 c0                	test   %eax,%eax
+  802f15:	78 28                	js     802f3f <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  802f17:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  802f1a:	83 ec 08             	sub    $0x8,%esp
+  802f1d:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802f20:	50                   	push   %eax
+  802f21:	6a 20                	push   $0x20
+  802f23:	e8 8a ff ff ff       	call   802eb2 <fs_stats>
+  802f28:	83 c4 10             	add    $0x10,%esp
+  802f2b:	85 c0                	test   %eax,%eax
+  802f2d:	78 10                	js     802f3f <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  802f2f:	83 ec 08             	sub    $0x8,%esp
+  802f32:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802f35:	50                   	push   %eax
+  802f36:	53                   	push   %ebx
+  802f37:	e8 76 ff ff ff       	call   802eb2 <fs_stats>
+  802f3c:	83 c4 10             	add    $0x10,%esp
+}
+  802f3f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f42:	c9                   	leave
+  802f43:	c3                   	ret
+
+00802f44 <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  802f44:	55                   	push   %ebp
+  802f45:	89 e5                	mov    %esp,%ebp
+  802f47:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  802f4a:	c7 05 00 90 80 00 00 	movl   $0x0,0x809000
+  802f51:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  802f54:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f57:	a3 04 90 80 00       	mov    %eax,0x809004
+  fsipcbuf.stats.req_dcache = 0;
+  802f5c:	c7 05 08 90 80 00 00 	movl   $0x0,0x809008
+  802f63:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  802f66:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f6b:	b8 09 00 00 00       	mov    $0x9,%eax
+  802f70:	e8 ac f7 ff ff       	call   802721 <fsipc>
+}
+  802f75:	c9                   	leave
+  802f76:	c3                   	ret
+
+00802f77 <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  802f77:	55                   	push   %ebp
+  802f78:	89 e5                	mov    %esp,%ebp
+  802f7a:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  802f7d:	c7 05 00 90 80 00 00 	movl   $0x0,0x809000
+  802f84:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  802f87:	c7 05 04 90 80 00 00 	movl   $0x0,0x809004
+  802f8e:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  802f91:	8b 45 08             	mov    0x8(%ebp),%eax
+  802f94:	a3 08 90 80 00       	mov    %eax,0x809008
+  return fsipc(FSREQ_STATS, NULL);
+  802f99:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f9e:	b8 09 00 00 00       	mov    $0x9,%eax
+  802fa3:	e8 79 f7 ff ff       	call   802721 <fsipc>
+}
+  802fa8:	c9                   	leave
+  802fa9:	c3                   	ret
+
+00802faa <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  802faa:	55                   	push   %ebp
+  802fab:	89 e5                	mov    %esp,%ebp
+  802fad:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802fb0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802fb3:	50                   	push   %eax
+  802fb4:	ff 75 08             	push   0x8(%ebp)
+  802fb7:	e8 21 f1 ff ff       	call   8020dd <fd_lookup>
+  802fbc:	83 c4 10             	add    $0x10,%esp
+  802fbf:	85 c0                	test   %eax,%eax
+  802fc1:	78 34                	js     802ff7 <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  802fc3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802fc6:	8b 0d 20 60 80 00    	mov    0x806020,%ecx
+  802fcc:	39 08                	cmp    %ecx,(%eax)
+  802fce:	75 29                	jne    802ff9 <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  802fd0:	8b 40 0c             	mov    0xc(%eax),%eax
+  802fd3:	a3 00 90 80 00       	mov    %eax,0x809000
+  fsipcbuf.fallocate.req_offset = offset;
+  802fd8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802fdb:	a3 04 90 80 00       	mov    %eax,0x809004
+  fsipcbuf.fallocate.req_len = len;
+  802fe0:	8b 45 10             	mov    0x10(%ebp),%eax
+  802fe3:	a3 08 90 80 00       	mov    %eax,0x809008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  802fe8:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fed:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802ff2:	e8 2a f7 ff ff       	call   802721 <fsipc>
+}
+  802ff7:	c9                   	leave
+  802ff8:	c3                   	ret
+    return -E_INVAL;
+  802ff9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ffe:	eb f7                	jmp    802ff7 <fallocate+0x4d>
+
+00803000 <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  803000:	55                   	push   %ebp
+  803001:	89 e5                	mov    %esp,%ebp
+  803003:	57                   	push   %edi
+  803004:	56                   	push   %esi
+  803005:	53                   	push   %ebx
+  803006:	83 ec 24             	sub    $0x24,%esp
+  803009:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80300c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80300f:	50                   	push   %eax
+  803010:	ff 75 08             	push   0x8(%ebp)
+  803013:	e8 c5 f0 ff ff       	call   8020dd <fd_lookup>
+  803018:	83 c4 10             	add    $0x10,%esp
+  80301b:	85 c0                	test   %eax,%eax
+  80301d:	78 66                	js     803085 <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  80301f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803022:	8b 0d 20 60 80 00    	mov    0x806020,%ecx
+  803028:	39 08                	cmp    %ecx,(%eax)
+  80302a:	75 61                	jne    80308d <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  80302c:	85 f6                	test   %esi,%esi
+  80302e:	7e 50                	jle    803080 <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  803030:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  803035:	39 de                	cmp    %ebx,%esi
+  803037:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  80303a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80303d:	8b 40 0c             	mov    0xc(%eax),%eax
+  803040:	a3 00 90 80 00       	mov    %eax,0x809000
+    fsipcbuf.prefetch.req_n = m;
+  803045:	89 1d 04 90 80 00    	mov    %ebx,0x809004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  80304b:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  803052:	83 ec 04             	sub    $0x4,%esp
+  803055:	57                   	push   %edi
+  803056:	ff 75 0c             	push   0xc(%ebp)
+  803059:	68 08 90 80 00       	push   $0x809008
+  80305e:	e8 25 e3 ff ff       	call   801388 <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  803063:	ba 00 00 00 00       	mov    $0x0,%edx
+  803068:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80306d:	e8 af f6 ff ff       	call   802721 <fsipc>
+  803072:	83 c4 10             	add    $0x10,%esp
+  803075:	85 c0                	test   %eax,%eax
+  803077:	78 0c                	js     803085 <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  803079:	01 7d 0c             	add    %edi,0xc(%ebp)
+  80307c:	29 de                	sub    %ebx,%esi
+  80307e:	eb ac                	jmp    80302c <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  803080:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803085:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803088:	5b                   	pop    %ebx
+  803089:	5e                   	pop    %esi
+  80308a:	5f                   	pop    %edi
+  80308b:	5d                   	pop    %ebp
+  80308c:	c3                   	ret
+    return -E_INVAL;
+  80308d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803092:	eb f1                	jmp    803085 <prefetch+0x85>
+
+00803094 <writebuf>:
+
+
+static void
+writebuf(struct printbuf *b)
+{
+  if (b->error > 0) {
+  803094:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  803098:	7f 01                	jg     80309b <writebuf+0x7>
+  80309a:	c3                   	ret
+{
+  80309b:	55                   	push   %ebp
+  80309c:	89 e5                	mov    %esp,%ebp
+  80309e:	53                   	push   %ebx
+  80309f:	83 ec 08             	sub    $0x8,%esp
+  8030a2:	89 c3                	mov    %eax,%ebx
+    ssize_t result = write(b->fd, b->buf, b->idx);
+  8030a4:	ff 70 04             	push   0x4(%eax)
+  8030a7:	8d 40 10             	lea    0x10(%eax),%eax
+  8030aa:	50                   	push   %eax
+  8030ab:	ff 33                	push   (%ebx)
+  8030ad:	e8 a4 f3 ff ff       	call   802456 <write>
+    if (result > 0)
+  8030b2:	83 c4 10             	add    $0x10,%esp
+  8030b5:	85 c0                	test   %eax,%eax
+  8030b7:	7e 03                	jle    8030bc <writebuf+0x28>
+      b->result += result;
+  8030b9:	01 43 08             	add    %eax,0x8(%ebx)
+    if (result != b->idx)             // error, or wrote less than supplied
+  8030bc:	39 43 04             	cmp    %eax,0x4(%ebx)
+  8030bf:	74 0d                	je     8030ce <writebuf+0x3a>
+      b->error = (result < 0 ? result : 0);
+  8030c1:	85 c0                	test   %eax,%eax
+  8030c3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030c8:	0f 4f c2             	cmovg  %edx,%eax
+  8030cb:	89 43 0c             	mov    %eax,0xc(%ebx)
+  }
+}
+  8030ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8030d1:	c9                   	leave
+  8030d2:	c3                   	ret
+
+008030d3 <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  8030d3:	55                   	push   %ebp
+  8030d4:	89 e5                	mov    %esp,%ebp
+  8030d6:	53                   	push   %ebx
+  8030d7:	83 ec 04             	sub    $0x4,%esp
+  8030da:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct printbuf *b = (struct printbuf *)thunk;
+
+  b->buf[b->idx++] = ch;
+  8030dd:	8b 53 04             	mov    0x4(%ebx),%edx
+  8030e0:	8d 42 01             	lea    0x1(%edx),%eax
+  8030e3:	89 43 04             	mov    %eax,0x4(%ebx)
+  8030e6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8030e9:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+  if (b->idx == 256) {
+  8030ed:	3d 00 01 00 00       	cmp    $0x100,%eax
+  8030f2:	74 05                	je     8030f9 <putch+0x26>
+    writebuf(b);
+    b->idx = 0;
+  }
+}
+  8030f4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8030f7:	c9                   	leave
+  8030f8:	c3                   	ret
+    writebuf(b);
+  8030f9:	89 d8                	mov    %ebx,%eax
+  8030fb:	e8 94 ff ff ff       	call   803094 <writebuf>
+    b->idx = 0;
+  803100:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+  803107:	eb eb                	jmp    8030f4 <putch+0x21>
+
+00803109 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap)
+{
+  803109:	55                   	push   %ebp
+  80310a:	89 e5                	mov    %esp,%ebp
+  80310c:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.fd = fd;
+  803112:	8b 45 08             	mov    0x8(%ebp),%eax
+  803115:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+  b.idx = 0;
+  80311b:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  803122:	00 00 00 
+  b.result = 0;
+  803125:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80312c:	00 00 00 
+  b.error = 1;
+  80312f:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  803136:	00 00 00 
+  vprintfmt(putch, &b, fmt, ap);
+  803139:	ff 75 10             	push   0x10(%ebp)
+  80313c:	ff 75 0c             	push   0xc(%ebp)
+  80313f:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  803145:	50                   	push   %eax
+  803146:	68 d3 30 80 00       	push   $0x8030d3
+  80314b:	e8 cb da ff ff       	call   800c1b <vprintfmt>
+  if (b.idx > 0)
+  803150:	83 c4 10             	add    $0x10,%esp
+  803153:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  80315a:	7f 12                	jg     80316e <vfprintf+0x65>
+    writebuf(&b);
+
+  return b.result ? b.result : b.error;
+  80315c:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  803162:	85 c0                	test   %eax,%eax
+  803164:	75 06                	jne    80316c <vfprintf+0x63>
+  803166:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+}
+  80316c:	c9                   	leave
+  80316d:	c3                   	ret
+    writebuf(&b);
+  80316e:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  803174:	e8 1b ff ff ff       	call   803094 <writebuf>
+  803179:	eb e1                	jmp    80315c <vfprintf+0x53>
+
+0080317b <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...)
+{
+  80317b:	55                   	push   %ebp
+  80317c:	89 e5                	mov    %esp,%ebp
+  80317e:	83 ec 0c             	sub    $0xc,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  803181:	8d 45 10             	lea    0x10(%ebp),%eax
+  cnt = vfprintf(fd, fmt, ap);
+  803184:	50                   	push   %eax
+  803185:	ff 75 0c             	push   0xc(%ebp)
+  803188:	ff 75 08             	push   0x8(%ebp)
+  80318b:	e8 79 ff ff ff       	call   803109 <vfprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  803190:	c9                   	leave
+  803191:	c3                   	ret
+
+00803192 <printf>:
+
+int
+printf(const char *fmt, ...)
+{
+  803192:	55                   	push   %ebp
+  803193:	89 e5                	mov    %esp,%ebp
+  803195:	83 ec 0c             	sub    $0xc,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  803198:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vfprintf(1, fmt, ap);
+  80319b:	50                   	push   %eax
+  80319c:	ff 75 08             	push   0x8(%ebp)
+  80319f:	6a 01                	push   $0x1
+  8031a1:	e8 63 ff ff ff       	call   803109 <vfprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  8031a6:	c9                   	leave
+  8031a7:	c3                   	ret
+
+008031a8 <spawn>:
+// argv: pointer to null-terminated array of pointers to strings,
+//   which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv)
+{
+  8031a8:	55                   	push   %ebp
+  8031a9:	89 e5                	mov    %esp,%ebp
+  8031ab:	57                   	push   %edi
+  8031ac:	56                   	push   %esi
+  8031ad:	53                   	push   %ebx
+  8031ae:	81 ec a8 02 00 00    	sub    $0x2a8,%esp
+  //     correct initial eip and esp values in the child.
+  //
+  //   - Start the child process running with sys_env_set_status().
+
+  // Open the program and read its ELF header in one round trip.
+  if ((r = open_read(prog, O_RDONLY, elf_buf, sizeof(elf_buf), &n)) < 0)
+  8031b4:	8d 85 a0 fd ff ff    	lea    -0x260(%ebp),%eax
+  8031ba:	50                   	push   %eax
+  8031bb:	68 00 02 00 00       	push   $0x200
+  8031c0:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  8031c6:	50                   	push   %eax
+  8031c7:	6a 00                	push   $0x0
+  8031c9:	ff 75 08             	push   0x8(%ebp)
+  8031cc:	e8 70 fa ff ff       	call   802c41 <open_read>
+  8031d1:	89 85 88 fd ff ff    	mov    %eax,-0x278(%ebp)
+  8031d7:	83 c4 20             	add    $0x20,%esp
+  8031da:	85 c0                	test   %eax,%eax
+  8031dc:	0f 88 66 06 00 00    	js     803848 <spawn+0x6a0>
+    return r;
+  fd = r;
+
+  elf = (struct Elf*)elf_buf;
+  if (n != sizeof(elf_buf) || elf->e_magic != ELF_MAGIC) {
+  8031e2:	81 bd a0 fd ff ff 00 	cmpl   $0x200,-0x260(%ebp)
+  8031e9:	02 00 00 
+  8031ec:	0f 85 92 00 00 00    	jne    803284 <spawn+0xdc>
+  8031f2:	81 bd e8 fd ff ff 7f 	cmpl   $0x464c457f,-0x218(%ebp)
+  8031f9:	45 4c 46 
+  8031fc:	0f 85 82 00 00 00    	jne    803284 <spawn+0xdc>
+  803202:	b8 07 00 00 00       	mov    $0x7,%eax
+  803207:	cd 30                	int    $0x30
+  803209:	89 85 90 fd ff ff    	mov    %eax,-0x270(%ebp)
+  80320f:	89 c6                	mov    %eax,%esi
+  803211:	89 85 6c fd ff ff    	mov    %eax,-0x294(%ebp)
+    cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+    return -E_NOT_EXEC;
+  }
+
+  // Create new child environment
+  if ((r = sys_exofork()) < 0)
+  803217:	85 c0                	test   %eax,%eax
+  803219:	0f 88 35 06 00 00    	js     803854 <spawn+0x6ac>
+    return r;
+  child = r;
+  sysbatch_init(&batch);
+  80321f:	83 ec 0c             	sub    $0xc,%esp
+  803222:	68 80 7b 80 00       	push   $0x807b80
+  803227:	e8 fa e7 ff ff       	call   801a26 <sysbatch_init>
+
+  // Set up trap frame, including initial stack.
+  child_tf = envs[ENVX(child)].env_tf;
+  80322c:	89 f0                	mov    %esi,%eax
+  80322e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  803233:	8d 34 c0             	lea    (%eax,%eax,8),%esi
+  803236:	c1 e6 04             	shl    $0x4,%esi
+  803239:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  80323f:	8d bd a4 fd ff ff    	lea    -0x25c(%ebp),%edi
+  803245:	b9 11 00 00 00       	mov    $0x11,%ecx
+  80324a:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  child_tf.tf_eip = elf->e_entry;
+  80324c:	8b 85 00 fe ff ff    	mov    -0x200(%ebp),%eax
+  803252:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  uintptr_t *argv_store;
+
+  // Count the number of arguments (argc)
+  // and the total amount of space needed for strings (string_size).
+  string_size = 0;
+  for (argc = 0; argv[argc] != 0; argc++)
+  803258:	83 c4 10             	add    $0x10,%esp
+  80325b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  string_size = 0;
+  803260:	be 00 00 00 00       	mov    $0x0,%esi
+  803265:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  for (argc = 0; argv[argc] != 0; argc++)
+  803268:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+  80326b:	85 c0                	test   %eax,%eax
+  80326d:	74 4d                	je     8032bc <spawn+0x114>
+    string_size += strlen(argv[argc]) + 1;
+  80326f:	83 ec 0c             	sub    $0xc,%esp
+  803272:	50                   	push   %eax
+  803273:	e8 4f df ff ff       	call   8011c7 <strlen>
+  803278:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+  for (argc = 0; argv[argc] != 0; argc++)
+  80327c:	83 c3 01             	add    $0x1,%ebx
+  80327f:	83 c4 10             	add    $0x10,%esp
+  803282:	eb e4                	jmp    803268 <spawn+0xc0>
+    close(fd);
+  803284:	83 ec 0c             	sub    $0xc,%esp
+  803287:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  80328d:	e8 6e ef ff ff       	call   802200 <close>
+    cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  803292:	83 c4 0c             	add    $0xc,%esp
+  803295:	68 7f 45 4c 46       	push   $0x464c457f
+  80329a:	ff b5 e8 fd ff ff    	push   -0x218(%ebp)
+  8032a0:	68 ac 53 80 00       	push   $0x8053ac
+  8032a5:	e8 7a d8 ff ff       	call   800b24 <cprintf>
+    return -E_NOT_EXEC;
+  8032aa:	83 c4 10             	add    $0x10,%esp
+  8032ad:	c7 85 6c fd ff ff f2 	movl   $0xfffffff2,-0x294(%ebp)
+  8032b4:	ff ff ff 
+  8032b7:	e9 98 05 00 00       	jmp    803854 <spawn+0x6ac>
+  // Determine where to place the strings and the argv array.
+  // Set up pointers into the temporary page 'UTEMP'; we'll map a page
+  // there later, then remap that page into the child environment
+  // at (USTACKTOP - PGSIZE).
+  // strings is the topmost thing on the stack.
+  string_store = (char*)UTEMP + PGSIZE - string_size;
+  8032bc:	89 9d 84 fd ff ff    	mov    %ebx,-0x27c(%ebp)
+  8032c2:	bf 00 10 40 00       	mov    $0x401000,%edi
+  8032c7:	29 f7                	sub    %esi,%edi
+  // argv is below that.  There's one argument pointer per argument, plus
+  // a null pointer.
+  argv_store = (uintptr_t*)(ROUNDDOWN(string_store, 4) - 4 * (argc + 1));
+  8032c9:	89 fa                	mov    %edi,%edx
+  8032cb:	83 e2 fc             	and    $0xfffffffc,%edx
+  8032ce:	8d 04 9d 04 00 00 00 	lea    0x4(,%ebx,4),%eax
+  8032d5:	29 c2                	sub    %eax,%edx
+  8032d7:	89 95 94 fd ff ff    	mov    %edx,-0x26c(%ebp)
+
+  // Make sure that argv, strings, and the 2 words that hold 'argc'
+  // and 'argv' themselves will all fit in a single stack page.
+  if ((void*)(argv_store - 2) < (void*)UTEMP)
+  8032dd:	8d 42 f8             	lea    -0x8(%edx),%eax
+  8032e0:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  8032e5:	0f 86 a8 05 00 00    	jbe    803893 <spawn+0x6eb>
+    return -E_NO_MEM;
+
+  // Allocate the single stack page at UTEMP.
+  if ((r = sys_page_alloc(0, (void*)UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  8032eb:	83 ec 04             	sub    $0x4,%esp
+  8032ee:	6a 07                	push   $0x7
+  8032f0:	68 00 00 40 00       	push   $0x400000
+  8032f5:	6a 00                	push   $0x0
+  8032f7:	e8 35 e3 ff ff       	call   801631 <sys_page_alloc>
+  8032fc:	83 c4 10             	add    $0x10,%esp
+  8032ff:	85 c0                	test   %eax,%eax
+  803301:	0f 88 91 05 00 00    	js     803898 <spawn+0x6f0>
+  //	  (Again, argv should use an address valid in the child's
+  //	  environment.)
+  //
+  //	* Set *init_esp to the initial stack pointer for the child,
+  //	  (Again, use an address valid in the child's environment.)
+  for (i = 0; i < argc; i++) {
+  803307:	be 00 00 00 00       	mov    $0x0,%esi
+  80330c:	89 9d 8c fd ff ff    	mov    %ebx,-0x274(%ebp)
+  803312:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  803315:	eb 30                	jmp    803347 <spawn+0x19f>
+    argv_store[i] = UTEMP2USTACK(string_store);
+  803317:	8d 87 00 d0 7f ee    	lea    -0x11803000(%edi),%eax
+  80331d:	8b 8d 94 fd ff ff    	mov    -0x26c(%ebp),%ecx
+  803323:	89 04 b1             	mov    %eax,(%ecx,%esi,4)
+    strcpy(string_store, argv[i]);
+  803326:	83 ec 08             	sub    $0x8,%esp
+  803329:	ff 34 b3             	push   (%ebx,%esi,4)
+  80332c:	57                   	push   %edi
+  80332d:	e8 d0 de ff ff       	call   801202 <strcpy>
+    string_store += strlen(argv[i]) + 1;
+  803332:	83 c4 04             	add    $0x4,%esp
+  803335:	ff 34 b3             	push   (%ebx,%esi,4)
+  803338:	e8 8a de ff ff       	call   8011c7 <strlen>
+  80333d:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+  for (i = 0; i < argc; i++) {
+  803341:	83 c6 01             	add    $0x1,%esi
+  803344:	83 c4 10             	add    $0x10,%esp
+  803347:	39 b5 8c fd ff ff    	cmp    %esi,-0x274(%ebp)
+  80334d:	7f c8                	jg     803317 <spawn+0x16f>
+  }
+  argv_store[argc] = 0;
+  80334f:	8b 85 94 fd ff ff    	mov    -0x26c(%ebp),%eax
+  803355:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  80335b:	c7 04 88 00 00 00 00 	movl   $0x0,(%eax,%ecx,4)
+  assert(string_store == (char*)UTEMP + PGSIZE);
+  803362:	81 ff 00 10 40 00    	cmp    $0x401000,%edi
+  803368:	0f 85 97 00 00 00    	jne    803405 <spawn+0x25d>
+
+  argv_store[-1] = UTEMP2USTACK(argv_store);
+  80336e:	8b 8d 94 fd ff ff    	mov    -0x26c(%ebp),%ecx
+  803374:	8d 81 00 d0 7f ee    	lea    -0x11803000(%ecx),%eax
+  80337a:	89 41 fc             	mov    %eax,-0x4(%ecx)
+  argv_store[-2] = argc;
+  80337d:	89 c8                	mov    %ecx,%eax
+  80337f:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  803385:	89 48 f8             	mov    %ecx,-0x8(%eax)
+
+  *init_esp = UTEMP2USTACK(&argv_store[-2]);
+  803388:	2d 08 30 80 11       	sub    $0x11803008,%eax
+  80338d:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+
+  // After completing the stack, map it into the child's address space
+  // and unmap it from ours!  Both calls ride along with the first batch
+  // of segment mappings.
+  if ((r = sysbatch_add(&batch, SYS_page_map, 0, (uint32_t) UTEMP, child,
+  803393:	83 ec 04             	sub    $0x4,%esp
+  803396:	6a 07                	push   $0x7
+  803398:	68 00 d0 bf ee       	push   $0xeebfd000
+  80339d:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  8033a3:	68 00 00 40 00       	push   $0x400000
+  8033a8:	6a 00                	push   $0x0
+  8033aa:	6a 05                	push   $0x5
+  8033ac:	68 80 7b 80 00       	push   $0x807b80
+  8033b1:	e8 ce e6 ff ff       	call   801a84 <sysbatch_add>
+  8033b6:	89 c3                	mov    %eax,%ebx
+  8033b8:	83 c4 20             	add    $0x20,%esp
+  8033bb:	85 c0                	test   %eax,%eax
+  8033bd:	0f 88 dd 04 00 00    	js     8038a0 <spawn+0x6f8>
+                        USTACKTOP - PGSIZE, PTE_P | PTE_U | PTE_W)) < 0)
+    goto error;
+  if ((r = sysbatch_add(&batch, SYS_page_unmap, 0, (uint32_t) UTEMP,
+  8033c3:	83 ec 04             	sub    $0x4,%esp
+  8033c6:	6a 00                	push   $0x0
+  8033c8:	6a 00                	push   $0x0
+  8033ca:	6a 00                	push   $0x0
+  8033cc:	68 00 00 40 00       	push   $0x400000
+  8033d1:	6a 00                	push   $0x0
+  8033d3:	6a 06                	push   $0x6
+  8033d5:	68 80 7b 80 00       	push   $0x807b80
+  8033da:	e8 a5 e6 ff ff       	call   801a84 <sysbatch_add>
+  8033df:	89 c3                	mov    %eax,%ebx
+  8033e1:	83 c4 20             	add    $0x20,%esp
+  8033e4:	85 c0                	test   %eax,%eax
+  8033e6:	0f 88 b4 04 00 00    	js     8038a0 <spawn+0x6f8>
+  ph = (struct Proghdr*)(elf_buf + elf->e_phoff);
+  8033ec:	8b 85 04 fe ff ff    	mov    -0x1fc(%ebp),%eax
+  8033f2:	8d bc 05 e8 fd ff ff 	lea    -0x218(%ebp,%eax,1),%edi
+  for (i = 0; i < elf->e_phnum; i++, ph++) {
+  8033f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8033fe:	89 d6                	mov    %edx,%esi
+  803400:	e9 dd 01 00 00       	jmp    8035e2 <spawn+0x43a>
+  assert(string_store == (char*)UTEMP + PGSIZE);
+  803405:	68 24 54 80 00       	push   $0x805424
+  80340a:	68 cf 4d 80 00       	push   $0x804dcf
+  80340f:	68 01 01 00 00       	push   $0x101
+  803414:	68 c6 53 80 00       	push   $0x8053c6
+  803419:	e8 2b d6 ff ff       	call   800a49 <_panic>
+
+  for (i = 0; i < memsz; i += n * PGSIZE) {
+    if (i >= filesz) {
+      // allocate a blank page
+      n = 1;
+      if ((r = sysbatch_add(&batch, SYS_page_alloc, child, va + i,
+  80341e:	83 ec 04             	sub    $0x4,%esp
+  803421:	6a 00                	push   $0x0
+  803423:	6a 00                	push   $0x0
+  803425:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  80342b:	8b 85 78 fd ff ff    	mov    -0x288(%ebp),%eax
+  803431:	8b 8d 70 fd ff ff    	mov    -0x290(%ebp),%ecx
+  803437:	01 c8                	add    %ecx,%eax
+  803439:	50                   	push   %eax
+  80343a:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  803440:	6a 04                	push   $0x4
+  803442:	68 80 7b 80 00       	push   $0x807b80
+  803447:	e8 38 e6 ff ff       	call   801a84 <sysbatch_add>
+  80344c:	83 c4 20             	add    $0x20,%esp
+  80344f:	85 c0                	test   %eax,%eax
+  803451:	0f 88 0b 04 00 00    	js     803862 <spawn+0x6ba>
+      n = 1;
+  803457:	bf 01 00 00 00       	mov    $0x1,%edi
+  for (i = 0; i < memsz; i += n * PGSIZE) {
+  80345c:	89 f8                	mov    %edi,%eax
+  80345e:	c1 e0 0c             	shl    $0xc,%eax
+  803461:	01 85 84 fd ff ff    	add    %eax,-0x27c(%ebp)
+  803467:	e9 fc 01 00 00       	jmp    803668 <spawn+0x4c0>
+  80346c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803471:	eb 0e                	jmp    803481 <spawn+0x2d9>
+  803473:	8b bd 60 fd ff ff    	mov    -0x2a0(%ebp),%edi
+  803479:	e9 c1 00 00 00       	jmp    80353f <spawn+0x397>
+          return r;
+        if (r < MIN(PGSIZE, filesz - i - j * PGSIZE))
+          return -E_INVAL;
+      }
+    } else {
+      for (j = 0; j < n; j++)
+  80347e:	83 c3 01             	add    $0x1,%ebx
+  803481:	39 df                	cmp    %ebx,%edi
+  803483:	7e 55                	jle    8034da <spawn+0x332>
+        if ((r = sysbatch_add(&batch, SYS_page_alloc, 0,
+  803485:	83 ec 04             	sub    $0x4,%esp
+  803488:	6a 00                	push   $0x0
+  80348a:	6a 00                	push   $0x0
+  80348c:	6a 07                	push   $0x7
+  80348e:	89 d8                	mov    %ebx,%eax
+  803490:	c1 e0 0c             	shl    $0xc,%eax
+  803493:	05 00 10 40 00       	add    $0x401000,%eax
+  803498:	50                   	push   %eax
+  803499:	6a 00                	push   $0x0
+  80349b:	6a 04                	push   $0x4
+  80349d:	68 80 7b 80 00       	push   $0x807b80
+  8034a2:	e8 dd e5 ff ff       	call   801a84 <sysbatch_add>
+  8034a7:	83 c4 20             	add    $0x20,%esp
+  8034aa:	85 c0                	test   %eax,%eax
+  8034ac:	79 d0                	jns    80347e <spawn+0x2d6>
+  8034ae:	89 c6                	mov    %eax,%esi
+  sys_env_destroy(child);
+  8034b0:	83 ec 0c             	sub    $0xc,%esp
+  8034b3:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  8034b9:	e8 b1 e0 ff ff       	call   80156f <sys_env_destroy>
+  close(fd);
+  8034be:	83 c4 04             	add    $0x4,%esp
+  8034c1:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  8034c7:	e8 34 ed ff ff       	call   802200 <close>
+  return r;
+  8034cc:	83 c4 10             	add    $0x10,%esp
+  8034cf:	89 b5 6c fd ff ff    	mov    %esi,-0x294(%ebp)
+  8034d5:	e9 7a 03 00 00       	jmp    803854 <spawn+0x6ac>
+                              (uint32_t) UTEMP2 + j * PGSIZE,
+                              PTE_P|PTE_U|PTE_W, 0, 0)) < 0)
+          return r;
+      if ((r = sysbatch_flush(&batch)) < 0)
+  8034da:	83 ec 0c             	sub    $0xc,%esp
+  8034dd:	68 80 7b 80 00       	push   $0x807b80
+  8034e2:	e8 4d e5 ff ff       	call   801a34 <sysbatch_flush>
+  8034e7:	83 c4 10             	add    $0x10,%esp
+  8034ea:	85 c0                	test   %eax,%eax
+  8034ec:	0f 88 85 03 00 00    	js     803877 <spawn+0x6cf>
+        return r;
+      if ((r = seek(fd, fileoffset + i)) < 0)
+  8034f2:	83 ec 08             	sub    $0x8,%esp
+  8034f5:	8b 85 74 fd ff ff    	mov    -0x28c(%ebp),%eax
+  8034fb:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  803501:	01 c8                	add    %ecx,%eax
+  803503:	50                   	push   %eax
+  803504:	8b 9d 88 fd ff ff    	mov    -0x278(%ebp),%ebx
+  80350a:	53                   	push   %ebx
+  80350b:	e8 c8 ef ff ff       	call   8024d8 <seek>
+  803510:	83 c4 10             	add    $0x10,%esp
+  803513:	85 c0                	test   %eax,%eax
+  803515:	0f 88 63 03 00 00    	js     80387e <spawn+0x6d6>
+        return r;
+      if ((r = readn(fd, UTEMP2, MIN(n * PGSIZE, filesz - i))) < 0)
+  80351b:	83 ec 04             	sub    $0x4,%esp
+  80351e:	89 f8                	mov    %edi,%eax
+  803520:	c1 e0 0c             	shl    $0xc,%eax
+  803523:	39 f0                	cmp    %esi,%eax
+  803525:	0f 47 c6             	cmova  %esi,%eax
+  803528:	50                   	push   %eax
+  803529:	68 00 10 40 00       	push   $0x401000
+  80352e:	53                   	push   %ebx
+  80352f:	e8 db ee ff ff       	call   80240f <readn>
+  803534:	83 c4 10             	add    $0x10,%esp
+  803537:	85 c0                	test   %eax,%eax
+  803539:	0f 88 46 03 00 00    	js     803885 <spawn+0x6dd>
+        return r;
+    }
+    for (j = 0; j < n; j++) {
+  80353f:	8d b7 01 04 00 00    	lea    0x401(%edi),%esi
+  803545:	c1 e6 0c             	shl    $0xc,%esi
+  803548:	bb 00 10 40 00       	mov    $0x401000,%ebx
+      if ((r = sysbatch_add(&batch, SYS_page_map, 0,
+  80354d:	8b 85 70 fd ff ff    	mov    -0x290(%ebp),%eax
+  803553:	8b 8d 78 fd ff ff    	mov    -0x288(%ebp),%ecx
+  803559:	8d 84 08 00 f0 bf ff 	lea    -0x401000(%eax,%ecx,1),%eax
+  803560:	89 bd 80 fd ff ff    	mov    %edi,-0x280(%ebp)
+  803566:	89 c7                	mov    %eax,%edi
+    for (j = 0; j < n; j++) {
+  803568:	39 f3                	cmp    %esi,%ebx
+  80356a:	74 59                	je     8035c5 <spawn+0x41d>
+      if ((r = sysbatch_add(&batch, SYS_page_map, 0,
+  80356c:	83 ec 04             	sub    $0x4,%esp
+  80356f:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  803575:	8d 04 1f             	lea    (%edi,%ebx,1),%eax
+  803578:	50                   	push   %eax
+  803579:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  80357f:	53                   	push   %ebx
+  803580:	6a 00                	push   $0x0
+  803582:	6a 05                	push   $0x5
+  803584:	68 80 7b 80 00       	push   $0x807b80
+  803589:	e8 f6 e4 ff ff       	call   801a84 <sysbatch_add>
+  80358e:	83 c4 20             	add    $0x20,%esp
+  803591:	85 c0                	test   %eax,%eax
+  803593:	0f 88 f3 02 00 00    	js     80388c <spawn+0x6e4>
+                            (uint32_t) UTEMP2 + j * PGSIZE, child,
+                            va + i + j * PGSIZE, perm)) < 0)
+        return r;
+      if ((r = sysbatch_add(&batch, SYS_page_unmap, 0,
+  803599:	83 ec 04             	sub    $0x4,%esp
+  80359c:	6a 00                	push   $0x0
+  80359e:	6a 00                	push   $0x0
+  8035a0:	6a 00                	push   $0x0
+  8035a2:	53                   	push   %ebx
+  8035a3:	6a 00                	push   $0x0
+  8035a5:	6a 06                	push   $0x6
+  8035a7:	68 80 7b 80 00       	push   $0x807b80
+  8035ac:	e8 d3 e4 ff ff       	call   801a84 <sysbatch_add>
+  8035b1:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8035b7:	83 c4 20             	add    $0x20,%esp
+  8035ba:	85 c0                	test   %eax,%eax
+  8035bc:	79 aa                	jns    803568 <spawn+0x3c0>
+  8035be:	89 c6                	mov    %eax,%esi
+  8035c0:	e9 eb fe ff ff       	jmp    8034b0 <spawn+0x308>
+  8035c5:	8b bd 80 fd ff ff    	mov    -0x280(%ebp),%edi
+  8035cb:	e9 8c fe ff ff       	jmp    80345c <spawn+0x2b4>
+  8035d0:	8b b5 68 fd ff ff    	mov    -0x298(%ebp),%esi
+  8035d6:	8b bd 64 fd ff ff    	mov    -0x29c(%ebp),%edi
+  for (i = 0; i < elf->e_phnum; i++, ph++) {
+  8035dc:	83 c6 01             	add    $0x1,%esi
+  8035df:	83 c7 20             	add    $0x20,%edi
+  8035e2:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  8035e9:	39 f0                	cmp    %esi,%eax
+  8035eb:	0f 8e 9b 01 00 00    	jle    80378c <spawn+0x5e4>
+    if (ph->p_type != ELF_PROG_LOAD)
+  8035f1:	83 3f 01             	cmpl   $0x1,(%edi)
+  8035f4:	75 e6                	jne    8035dc <spawn+0x434>
+    if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  8035f6:	8b 47 18             	mov    0x18(%edi),%eax
+  8035f9:	83 e0 02             	and    $0x2,%eax
+    perm = PTE_P | PTE_U;
+  8035fc:	83 f8 01             	cmp    $0x1,%eax
+  8035ff:	19 c0                	sbb    %eax,%eax
+  803601:	83 e0 fe             	and    $0xfffffffe,%eax
+  803604:	83 c0 07             	add    $0x7,%eax
+  803607:	89 85 94 fd ff ff    	mov    %eax,-0x26c(%ebp)
+    if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  80360d:	8b 57 04             	mov    0x4(%edi),%edx
+  803610:	89 95 74 fd ff ff    	mov    %edx,-0x28c(%ebp)
+  803616:	8b 5f 10             	mov    0x10(%edi),%ebx
+  803619:	89 9d 8c fd ff ff    	mov    %ebx,-0x274(%ebp)
+  80361f:	8b 47 14             	mov    0x14(%edi),%eax
+  803622:	89 85 7c fd ff ff    	mov    %eax,-0x284(%ebp)
+  803628:	8b 4f 08             	mov    0x8(%edi),%ecx
+  if ((i = PGOFF(va))) {
+  80362b:	89 c8                	mov    %ecx,%eax
+  80362d:	25 ff 0f 00 00       	and    $0xfff,%eax
+  803632:	74 18                	je     80364c <spawn+0x4a4>
+    va -= i;
+  803634:	29 c1                	sub    %eax,%ecx
+    memsz += i;
+  803636:	01 85 7c fd ff ff    	add    %eax,-0x284(%ebp)
+    filesz += i;
+  80363c:	01 c3                	add    %eax,%ebx
+  80363e:	89 9d 8c fd ff ff    	mov    %ebx,-0x274(%ebp)
+    fileoffset -= i;
+  803644:	29 c2                	sub    %eax,%edx
+  803646:	89 95 74 fd ff ff    	mov    %edx,-0x28c(%ebp)
+  for (i = 0; i < memsz; i += n * PGSIZE) {
+  80364c:	c7 85 84 fd ff ff 00 	movl   $0x0,-0x27c(%ebp)
+  803653:	00 00 00 
+  803656:	89 8d 70 fd ff ff    	mov    %ecx,-0x290(%ebp)
+  80365c:	89 b5 68 fd ff ff    	mov    %esi,-0x298(%ebp)
+  803662:	89 bd 64 fd ff ff    	mov    %edi,-0x29c(%ebp)
+  803668:	8b 85 84 fd ff ff    	mov    -0x27c(%ebp),%eax
+  80366e:	89 85 78 fd ff ff    	mov    %eax,-0x288(%ebp)
+  803674:	8b 8d 7c fd ff ff    	mov    -0x284(%ebp),%ecx
+  80367a:	39 c8                	cmp    %ecx,%eax
+  80367c:	0f 83 4e ff ff ff    	jae    8035d0 <spawn+0x428>
+    if (i >= filesz) {
+  803682:	8b 8d 8c fd ff ff    	mov    -0x274(%ebp),%ecx
+  803688:	39 8d 84 fd ff ff    	cmp    %ecx,-0x27c(%ebp)
+  80368e:	0f 83 8a fd ff ff    	jae    80341e <spawn+0x276>
+    n = MIN(SEGCHUNK, ROUNDUP(filesz - i, PGSIZE) / PGSIZE);
+  803694:	8b b5 8c fd ff ff    	mov    -0x274(%ebp),%esi
+  80369a:	8b 85 78 fd ff ff    	mov    -0x288(%ebp),%eax
+  8036a0:	29 c6                	sub    %eax,%esi
+  8036a2:	8d 86 ff 0f 00 00    	lea    0xfff(%esi),%eax
+  8036a8:	c1 e8 0c             	shr    $0xc,%eax
+  8036ab:	ba 10 00 00 00       	mov    $0x10,%edx
+  8036b0:	39 d0                	cmp    %edx,%eax
+  8036b2:	0f 47 c2             	cmova  %edx,%eax
+  8036b5:	89 c7                	mov    %eax,%edi
+  if ((perm & PTE_W) || PGOFF(fileoffset))
+  8036b7:	8b 9d 94 fd ff ff    	mov    -0x26c(%ebp),%ebx
+  8036bd:	83 e3 02             	and    $0x2,%ebx
+  8036c0:	8b 95 74 fd ff ff    	mov    -0x28c(%ebp),%edx
+  8036c6:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8036cc:	09 d3                	or     %edx,%ebx
+  8036ce:	0f 85 98 fd ff ff    	jne    80346c <spawn+0x2c4>
+    n = MIN(n, (filesz - i) / PGSIZE);
+  8036d4:	89 f2                	mov    %esi,%edx
+  8036d6:	c1 ea 0c             	shr    $0xc,%edx
+  8036d9:	39 c2                	cmp    %eax,%edx
+  8036db:	0f 47 d0             	cmova  %eax,%edx
+  8036de:	8b 8d 7c fd ff ff    	mov    -0x284(%ebp),%ecx
+  8036e4:	39 8d 8c fd ff ff    	cmp    %ecx,-0x274(%ebp)
+  8036ea:	0f 43 d0             	cmovae %eax,%edx
+    if ((m = shared_pages(perm, memsz, filesz, fileoffset, i, n)) > 0) {
+  8036ed:	89 95 60 fd ff ff    	mov    %edx,-0x2a0(%ebp)
+  8036f3:	85 d2                	test   %edx,%edx
+  8036f5:	0f 8e 86 fd ff ff    	jle    803481 <spawn+0x2d9>
+      if ((r = sysbatch_flush(&batch)) < 0)
+  8036fb:	83 ec 0c             	sub    $0xc,%esp
+  8036fe:	68 80 7b 80 00       	push   $0x807b80
+  803703:	e8 2c e3 ff ff       	call   801a34 <sysbatch_flush>
+  803708:	83 c4 10             	add    $0x10,%esp
+  80370b:	85 c0                	test   %eax,%eax
+  80370d:	0f 88 56 01 00 00    	js     803869 <spawn+0x6c1>
+  803713:	8b 85 60 fd ff ff    	mov    -0x2a0(%ebp),%eax
+  803719:	c1 e0 0c             	shl    $0xc,%eax
+  80371c:	89 f1                	mov    %esi,%ecx
+  80371e:	29 c1                	sub    %eax,%ecx
+  803720:	89 8d 80 fd ff ff    	mov    %ecx,-0x280(%ebp)
+  803726:	89 f3                	mov    %esi,%ebx
+        if ((r = read_map(fd, fileoffset + i + j * PGSIZE,
+  803728:	8d be 00 10 40 00    	lea    0x401000(%esi),%edi
+  80372e:	8b 8d 74 fd ff ff    	mov    -0x28c(%ebp),%ecx
+  803734:	8b 85 8c fd ff ff    	mov    -0x274(%ebp),%eax
+  80373a:	8d 34 01             	lea    (%ecx,%eax,1),%esi
+      for (j = 0; j < n; j++) {
+  80373d:	8b 85 80 fd ff ff    	mov    -0x280(%ebp),%eax
+  803743:	39 c3                	cmp    %eax,%ebx
+  803745:	0f 84 28 fd ff ff    	je     803473 <spawn+0x2cb>
+        if ((r = read_map(fd, fileoffset + i + j * PGSIZE,
+  80374b:	83 ec 04             	sub    $0x4,%esp
+  80374e:	89 f8                	mov    %edi,%eax
+  803750:	29 d8                	sub    %ebx,%eax
+  803752:	50                   	push   %eax
+  803753:	89 f0                	mov    %esi,%eax
+  803755:	29 d8                	sub    %ebx,%eax
+  803757:	50                   	push   %eax
+  803758:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  80375e:	e8 ec f6 ff ff       	call   802e4f <read_map>
+  803763:	83 c4 10             	add    $0x10,%esp
+  803766:	85 c0                	test   %eax,%eax
+  803768:	0f 88 02 01 00 00    	js     803870 <spawn+0x6c8>
+        if (r < MIN(PGSIZE, filesz - i - j * PGSIZE))
+  80376e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803773:	39 d3                	cmp    %edx,%ebx
+  803775:	0f 46 d3             	cmovbe %ebx,%edx
+  803778:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  80377e:	39 d0                	cmp    %edx,%eax
+  803780:	73 bb                	jae    80373d <spawn+0x595>
+          return -E_INVAL;
+  803782:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+  803787:	e9 24 fd ff ff       	jmp    8034b0 <spawn+0x308>
+  close(fd);
+  80378c:	83 ec 0c             	sub    $0xc,%esp
+  80378f:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  803795:	e8 66 ea ff ff       	call   802200 <close>
+// Copy the mappings for shared pages into the child address space.
+static int
+copy_shared_pages(envid_t child)
+{
+  // LAB 5: Your code here.
+  return sysbatch_add(&batch, SYS_page_map_range, 0, 0, UTOP,
+  80379a:	83 c4 0c             	add    $0xc,%esp
+  80379d:	6a 02                	push   $0x2
+  80379f:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  8037a5:	68 00 00 c0 ee       	push   $0xeec00000
+  8037aa:	6a 00                	push   $0x0
+  8037ac:	6a 00                	push   $0x0
+  8037ae:	6a 11                	push   $0x11
+  8037b0:	68 80 7b 80 00       	push   $0x807b80
+  8037b5:	e8 ca e2 ff ff       	call   801a84 <sysbatch_add>
+  if ((r = copy_shared_pages(child)) < 0)
+  8037ba:	83 c4 20             	add    $0x20,%esp
+  8037bd:	85 c0                	test   %eax,%eax
+  8037bf:	78 72                	js     803833 <spawn+0x68b>
+  if ((r = sysbatch_add(&batch, SYS_env_set_trapframe, child,
+  8037c1:	83 ec 04             	sub    $0x4,%esp
+  8037c4:	6a 00                	push   $0x0
+  8037c6:	6a 00                	push   $0x0
+  8037c8:	6a 00                	push   $0x0
+  8037ca:	8d 85 a4 fd ff ff    	lea    -0x25c(%ebp),%eax
+  8037d0:	50                   	push   %eax
+  8037d1:	8b bd 90 fd ff ff    	mov    -0x270(%ebp),%edi
+  8037d7:	57                   	push   %edi
+  8037d8:	6a 09                	push   $0x9
+  8037da:	68 80 7b 80 00       	push   $0x807b80
+  8037df:	e8 a0 e2 ff ff       	call   801a84 <sysbatch_add>
+  8037e4:	83 c4 20             	add    $0x20,%esp
+  8037e7:	85 c0                	test   %eax,%eax
+  8037e9:	78 33                	js     80381e <spawn+0x676>
+      (r = sysbatch_add(&batch, SYS_env_set_status, child,
+  8037eb:	83 ec 04             	sub    $0x4,%esp
+  8037ee:	6a 00                	push   $0x0
+  8037f0:	6a 00                	push   $0x0
+  8037f2:	6a 00                	push   $0x0
+  8037f4:	6a 02                	push   $0x2
+  8037f6:	57                   	push   %edi
+  8037f7:	6a 08                	push   $0x8
+  8037f9:	68 80 7b 80 00       	push   $0x807b80
+  8037fe:	e8 81 e2 ff ff       	call   801a84 <sysbatch_add>
+                        (uint32_t) &child_tf, 0, 0, 0)) < 0 ||
+  803803:	83 c4 20             	add    $0x20,%esp
+  803806:	85 c0                	test   %eax,%eax
+  803808:	78 14                	js     80381e <spawn+0x676>
+      (r = sysbatch_flush(&batch)) < 0)
+  80380a:	83 ec 0c             	sub    $0xc,%esp
+  80380d:	68 80 7b 80 00       	push   $0x807b80
+  803812:	e8 1d e2 ff ff       	call   801a34 <sysbatch_flush>
+                        ENV_RUNNABLE, 0, 0, 0)) < 0 ||
+  803817:	83 c4 10             	add    $0x10,%esp
+  80381a:	85 c0                	test   %eax,%eax
+  80381c:	79 36                	jns    803854 <spawn+0x6ac>
+    panic("spawn: starting child: %e", r);
+  80381e:	50                   	push   %eax
+  80381f:	68 e8 53 80 00       	push   $0x8053e8
+  803824:	68 93 00 00 00       	push   $0x93
+  803829:	68 c6 53 80 00       	push   $0x8053c6
+  80382e:	e8 16 d2 ff ff       	call   800a49 <_panic>
+    panic("copy_shared_pages: %e", r);
+  803833:	50                   	push   %eax
+  803834:	68 d2 53 80 00       	push   $0x8053d2
+  803839:	68 8c 00 00 00       	push   $0x8c
+  80383e:	68 c6 53 80 00       	push   $0x8053c6
+  803843:	e8 01 d2 ff ff       	call   800a49 <_panic>
+    return r;
+  803848:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  80384e:	89 85 6c fd ff ff    	mov    %eax,-0x294(%ebp)
+}
+  803854:	8b 85 6c fd ff ff    	mov    -0x294(%ebp),%eax
+  80385a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80385d:	5b                   	pop    %ebx
+  80385e:	5e                   	pop    %esi
+  80385f:	5f                   	pop    %edi
+  803860:	5d                   	pop    %ebp
+  803861:	c3                   	ret
+  803862:	89 c6                	mov    %eax,%esi
+  803864:	e9 47 fc ff ff       	jmp    8034b0 <spawn+0x308>
+  803869:	89 c6                	mov    %eax,%esi
+  80386b:	e9 40 fc ff ff       	jmp    8034b0 <spawn+0x308>
+  803870:	89 c6                	mov    %eax,%esi
+  803872:	e9 39 fc ff ff       	jmp    8034b0 <spawn+0x308>
+  803877:	89 c6                	mov    %eax,%esi
+  803879:	e9 32 fc ff ff       	jmp    8034b0 <spawn+0x308>
+  80387e:	89 c6                	mov    %eax,%esi
+  803880:	e9 2b fc ff ff       	jmp    8034b0 <spawn+0x308>
+  803885:	89 c6                	mov    %eax,%esi
+  803887:	e9 24 fc ff ff       	jmp    8034b0 <spawn+0x308>
+  80388c:	89 c6                	mov    %eax,%esi
+  80388e:	e9 1d fc ff ff       	jmp    8034b0 <spawn+0x308>
+    return -E_NO_MEM;
+  803893:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  return r;
+  803898:	89 85 6c fd ff ff    	mov    %eax,-0x294(%ebp)
+  80389e:	eb b4                	jmp    803854 <spawn+0x6ac>
+  sys_page_unmap(0, UTEMP);
+  8038a0:	83 ec 08             	sub    $0x8,%esp
+  8038a3:	68 00 00 40 00       	push   $0x400000
+  8038a8:	6a 00                	push   $0x0
+  8038aa:	e8 07 de ff ff       	call   8016b6 <sys_page_unmap>
+  8038af:	83 c4 10             	add    $0x10,%esp
+  8038b2:	89 9d 6c fd ff ff    	mov    %ebx,-0x294(%ebp)
+  8038b8:	eb 9a                	jmp    803854 <spawn+0x6ac>
+
+008038ba <spawnl>:
+{
+  8038ba:	55                   	push   %ebp
+  8038bb:	89 e5                	mov    %esp,%ebp
+  8038bd:	56                   	push   %esi
+  8038be:	53                   	push   %ebx
+  va_start(vl, arg0);
+  8038bf:	8d 45 10             	lea    0x10(%ebp),%eax
+  int argc = 0;
+  8038c2:	be 00 00 00 00       	mov    $0x0,%esi
+  while (va_arg(vl, void *) != NULL) {
+  8038c7:	eb 17                	jmp    8038e0 <spawnl+0x26>
+      cprintf("vl: %p saying %s\n", vl, vl);
+  8038c9:	83 ec 04             	sub    $0x4,%esp
+  8038cc:	53                   	push   %ebx
+  8038cd:	53                   	push   %ebx
+  8038ce:	68 02 54 80 00       	push   $0x805402
+  8038d3:	e8 4c d2 ff ff       	call   800b24 <cprintf>
+    argc++;
+  8038d8:	83 c6 01             	add    $0x1,%esi
+  8038db:	83 c4 10             	add    $0x10,%esp
+  while (va_arg(vl, void *) != NULL) {
+  8038de:	89 d8                	mov    %ebx,%eax
+  8038e0:	8d 58 04             	lea    0x4(%eax),%ebx
+  8038e3:	83 38 00             	cmpl   $0x0,(%eax)
+  8038e6:	75 e1                	jne    8038c9 <spawnl+0xf>
+  cprintf("argc found %d\n", argc);
+  8038e8:	83 ec 08             	sub    $0x8,%esp
+  8038eb:	56                   	push   %esi
+  8038ec:	68 14 54 80 00       	push   $0x805414
+  8038f1:	e8 2e d2 ff ff       	call   800b24 <cprintf>
+  const char *argv[argc+2];
+  8038f6:	8d 04 b5 17 00 00 00 	lea    0x17(,%esi,4),%eax
+  8038fd:	83 e0 f0             	and    $0xfffffff0,%eax
+  803900:	83 c4 10             	add    $0x10,%esp
+  803903:	29 c4                	sub    %eax,%esp
+  803905:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  803909:	89 d8                	mov    %ebx,%eax
+  80390b:	c1 e8 02             	shr    $0x2,%eax
+  80390e:	83 e3 fc             	and    $0xfffffffc,%ebx
+  argv[0] = arg0;
+  803911:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803914:	89 14 85 00 00 00 00 	mov    %edx,0x0(,%eax,4)
+  argv[argc+1] = NULL;
+  80391b:	c7 44 b3 04 00 00 00 	movl   $0x0,0x4(%ebx,%esi,4)
+  803922:	00 
+  va_start(vl, arg0);
+  803923:	8d 55 10             	lea    0x10(%ebp),%edx
+  for (i = 0; i < argc; i++)
+  803926:	b8 00 00 00 00       	mov    $0x0,%eax
+  80392b:	eb 0b                	jmp    803938 <spawnl+0x7e>
+    argv[i+1] = va_arg(vl, const char *);
+  80392d:	83 c0 01             	add    $0x1,%eax
+  803930:	8b 0a                	mov    (%edx),%ecx
+  803932:	89 0c 83             	mov    %ecx,(%ebx,%eax,4)
+  803935:	8d 52 04             	lea    0x4(%edx),%edx
+  for (i = 0; i < argc; i++)
+  803938:	39 f0                	cmp    %esi,%eax
+  80393a:	75 f1                	jne    80392d <spawnl+0x73>
+  return spawn(prog, argv);
+  80393c:	83 ec 08             	sub    $0x8,%esp
+  80393f:	53                   	push   %ebx
+  803940:	ff 75 08             	push   0x8(%ebp)
+  803943:	e8 60 f8 ff ff       	call   8031a8 <spawn>
+}
+  803948:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80394b:	5b                   	pop    %ebx
+  80394c:	5e                   	pop    %esi
+  80394d:	5d                   	pop    %ebp
+  80394e:	c3                   	ret
+
+0080394f <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  80394f:	55                   	push   %ebp
+  803950:	89 e5                	mov    %esp,%ebp
+  803952:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  803955:	50                   	push   %eax
+  803956:	e8 18 e7 ff ff       	call   802073 <fd2data>
+  80395b:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  803960:	c9                   	leave
+  803961:	c3                   	ret
+
+00803962 <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  803962:	55                   	push   %ebp
+  803963:	89 e5                	mov    %esp,%ebp
+  803965:	56                   	push   %esi
+  803966:	53                   	push   %ebx
+  803967:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  80396a:	83 ec 0c             	sub    $0xc,%esp
+  80396d:	ff 75 08             	push   0x8(%ebp)
+  803970:	e8 fe e6 ff ff       	call   802073 <fd2data>
+  803975:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  803977:	83 c4 08             	add    $0x8,%esp
+  80397a:	68 4a 54 80 00       	push   $0x80544a
+  80397f:	53                   	push   %ebx
+  803980:	e8 7d d8 ff ff       	call   801202 <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  803985:	8b 46 04             	mov    0x4(%esi),%eax
+  803988:	2b 06                	sub    (%esi),%eax
+  80398a:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  803990:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  803997:	00 00 00 
+  stat->st_dev = &devpipe;
+  80399a:	c7 83 88 00 00 00 3c 	movl   $0x80603c,0x88(%ebx)
+  8039a1:	60 80 00 
+  return 0;
+}
+  8039a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039a9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8039ac:	5b                   	pop    %ebx
+  8039ad:	5e                   	pop    %esi
+  8039ae:	5d                   	pop    %ebp
+  8039af:	c3                   	ret
+
+008039b0 <pipe_wakeup>:
+{
+  8039b0:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  8039b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039b7:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  8039ba:	85 c0                	test   %eax,%eax
+  8039bc:	75 01                	jne    8039bf <pipe_wakeup+0xf>
+  8039be:	c3                   	ret
+{
+  8039bf:	55                   	push   %ebp
+  8039c0:	89 e5                	mov    %esp,%ebp
+  8039c2:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  8039c5:	6a 00                	push   $0x0
+  8039c7:	68 00 00 c0 ee       	push   $0xeec00000
+  8039cc:	52                   	push   %edx
+  8039cd:	e8 bb df ff ff       	call   80198d <sys_chan_wakeup>
+  8039d2:	83 c4 10             	add    $0x10,%esp
+}
+  8039d5:	c9                   	leave
+  8039d6:	c3                   	ret
+
+008039d7 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8039d7:	55                   	push   %ebp
+  8039d8:	89 e5                	mov    %esp,%ebp
+  8039da:	57                   	push   %edi
+  8039db:	56                   	push   %esi
+  8039dc:	53                   	push   %ebx
+  8039dd:	83 ec 18             	sub    $0x18,%esp
+  8039e0:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  8039e3:	57                   	push   %edi
+  8039e4:	e8 8a e6 ff ff       	call   802073 <fd2data>
+  8039e9:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  8039eb:	83 c4 10             	add    $0x10,%esp
+  8039ee:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  8039f2:	74 2a                	je     803a1e <devpipe_close+0x47>
+  8039f4:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  8039f9:	89 f8                	mov    %edi,%eax
+  8039fb:	e8 4f ff ff ff       	call   80394f <pipe_ring>
+  803a00:	83 ec 08             	sub    $0x8,%esp
+  803a03:	01 d8                	add    %ebx,%eax
+  803a05:	50                   	push   %eax
+  803a06:	6a 00                	push   $0x0
+  803a08:	e8 a9 dc ff ff       	call   8016b6 <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  803a0d:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803a13:	83 c4 10             	add    $0x10,%esp
+  803a16:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  803a1c:	75 db                	jne    8039f9 <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  803a1e:	83 ec 08             	sub    $0x8,%esp
+  803a21:	57                   	push   %edi
+  803a22:	6a 00                	push   $0x0
+  803a24:	e8 8d dc ff ff       	call   8016b6 <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  803a29:	83 c4 10             	add    $0x10,%esp
+  803a2c:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  803a30:	75 13                	jne    803a45 <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  803a32:	83 ec 08             	sub    $0x8,%esp
+  803a35:	56                   	push   %esi
+  803a36:	6a 00                	push   $0x0
+  803a38:	e8 79 dc ff ff       	call   8016b6 <sys_page_unmap>
+}
+  803a3d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803a40:	5b                   	pop    %ebx
+  803a41:	5e                   	pop    %esi
+  803a42:	5f                   	pop    %edi
+  803a43:	5d                   	pop    %ebp
+  803a44:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  803a45:	8d 56 04             	lea    0x4(%esi),%edx
+  803a48:	8d 46 2c             	lea    0x2c(%esi),%eax
+  803a4b:	e8 60 ff ff ff       	call   8039b0 <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  803a50:	8d 46 30             	lea    0x30(%esi),%eax
+  803a53:	89 f2                	mov    %esi,%edx
+  803a55:	e8 56 ff ff ff       	call   8039b0 <pipe_wakeup>
+  803a5a:	eb d6                	jmp    803a32 <devpipe_close+0x5b>
+
+00803a5c <_pipeisclosed>:
+{
+  803a5c:	55                   	push   %ebp
+  803a5d:	89 e5                	mov    %esp,%ebp
+  803a5f:	57                   	push   %edi
+  803a60:	56                   	push   %esi
+  803a61:	53                   	push   %ebx
+  803a62:	83 ec 1c             	sub    $0x1c,%esp
+  803a65:	89 c7                	mov    %eax,%edi
+  803a67:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  803a69:	a1 e0 83 80 00       	mov    0x8083e0,%eax
+  803a6e:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  803a71:	83 ec 0c             	sub    $0xc,%esp
+  803a74:	57                   	push   %edi
+  803a75:	e8 76 0f 00 00       	call   8049f0 <pageref>
+  803a7a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803a7d:	89 34 24             	mov    %esi,(%esp)
+  803a80:	e8 6b 0f 00 00       	call   8049f0 <pageref>
+    nn = thisenv->env_runs;
+  803a85:	8b 15 e0 83 80 00    	mov    0x8083e0,%edx
+  803a8b:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  803a8e:	83 c4 10             	add    $0x10,%esp
+  803a91:	39 cb                	cmp    %ecx,%ebx
+  803a93:	74 1b                	je     803ab0 <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  803a95:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803a98:	75 cf                	jne    803a69 <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  803a9a:	8b 42 58             	mov    0x58(%edx),%eax
+  803a9d:	6a 01                	push   $0x1
+  803a9f:	50                   	push   %eax
+  803aa0:	53                   	push   %ebx
+  803aa1:	68 51 54 80 00       	push   $0x805451
+  803aa6:	e8 79 d0 ff ff       	call   800b24 <cprintf>
+  803aab:	83 c4 10             	add    $0x10,%esp
+  803aae:	eb b9                	jmp    803a69 <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  803ab0:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  803ab3:	0f 94 c0             	sete   %al
+  803ab6:	0f b6 c0             	movzbl %al,%eax
+}
+  803ab9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803abc:	5b                   	pop    %ebx
+  803abd:	5e                   	pop    %esi
+  803abe:	5f                   	pop    %edi
+  803abf:	5d                   	pop    %ebp
+  803ac0:	c3                   	ret
+
+00803ac1 <devpipe_write_bulk>:
+{
+  803ac1:	55                   	push   %ebp
+  803ac2:	89 e5                	mov    %esp,%ebp
+  803ac4:	57                   	push   %edi
+  803ac5:	56                   	push   %esi
+  803ac6:	53                   	push   %ebx
+  803ac7:	83 ec 1c             	sub    $0x1c,%esp
+  803aca:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  803acd:	89 d6                	mov    %edx,%esi
+  803acf:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  803ad2:	e8 78 fe ff ff       	call   80394f <pipe_ring>
+  803ad7:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  803ada:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  803adf:	8d 46 04             	lea    0x4(%esi),%eax
+  803ae2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  803ae5:	eb 75                	jmp    803b5c <devpipe_write_bulk+0x9b>
+  803ae7:	b8 01 00 00 00       	mov    $0x1,%eax
+  803aec:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  803af0:	6a 64                	push   $0x64
+  803af2:	68 00 00 c0 ee       	push   $0xeec00000
+  803af7:	53                   	push   %ebx
+  803af8:	56                   	push   %esi
+  803af9:	e8 6c de ff ff       	call   80196a <sys_chan_sleep>
+      continue;
+  803afe:	83 c4 10             	add    $0x10,%esp
+  803b01:	eb 59                	jmp    803b5c <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  803b03:	89 d1                	mov    %edx,%ecx
+  803b05:	c1 f9 1f             	sar    $0x1f,%ecx
+  803b08:	c1 e9 11             	shr    $0x11,%ecx
+  803b0b:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  803b0e:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  803b13:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  803b15:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  803b1b:	29 d3                	sub    %edx,%ebx
+  803b1d:	ba 00 80 00 00       	mov    $0x8000,%edx
+  803b22:	29 c2                	sub    %eax,%edx
+  803b24:	39 d3                	cmp    %edx,%ebx
+  803b26:	0f 47 da             	cmova  %edx,%ebx
+  803b29:	8b 55 08             	mov    0x8(%ebp),%edx
+  803b2c:	29 fa                	sub    %edi,%edx
+  803b2e:	39 d3                	cmp    %edx,%ebx
+  803b30:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  803b33:	83 ec 04             	sub    $0x4,%esp
+  803b36:	53                   	push   %ebx
+  803b37:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  803b3a:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  803b3d:	52                   	push   %edx
+  803b3e:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803b41:	01 c8                	add    %ecx,%eax
+  803b43:	50                   	push   %eax
+  803b44:	e8 a1 d8 ff ff       	call   8013ea <memcpy>
+    i += m;
+  803b49:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  803b4b:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  803b4e:	8d 46 2c             	lea    0x2c(%esi),%eax
+  803b51:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  803b54:	e8 57 fe ff ff       	call   8039b0 <pipe_wakeup>
+  803b59:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  803b5c:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  803b5f:	73 2b                	jae    803b8c <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  803b61:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  803b63:	8b 56 04             	mov    0x4(%esi),%edx
+  803b66:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  803b6c:	39 d0                	cmp    %edx,%eax
+  803b6e:	7d 93                	jge    803b03 <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  803b70:	89 f2                	mov    %esi,%edx
+  803b72:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803b75:	e8 e2 fe ff ff       	call   803a5c <_pipeisclosed>
+  803b7a:	85 c0                	test   %eax,%eax
+  803b7c:	0f 84 65 ff ff ff    	je     803ae7 <devpipe_write_bulk+0x26>
+        return i;
+  803b82:	89 f8                	mov    %edi,%eax
+}
+  803b84:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803b87:	5b                   	pop    %ebx
+  803b88:	5e                   	pop    %esi
+  803b89:	5f                   	pop    %edi
+  803b8a:	5d                   	pop    %ebp
+  803b8b:	c3                   	ret
+  return i;
+  803b8c:	89 f8                	mov    %edi,%eax
+  803b8e:	eb f4                	jmp    803b84 <devpipe_write_bulk+0xc3>
+
+00803b90 <devpipe_write>:
+{
+  803b90:	55                   	push   %ebp
+  803b91:	89 e5                	mov    %esp,%ebp
+  803b93:	57                   	push   %edi
+  803b94:	56                   	push   %esi
+  803b95:	53                   	push   %ebx
+  803b96:	83 ec 28             	sub    $0x28,%esp
+  803b99:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  803b9c:	56                   	push   %esi
+  803b9d:	e8 d1 e4 ff ff       	call   802073 <fd2data>
+  803ba2:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  803ba4:	8b 78 28             	mov    0x28(%eax),%edi
+  803ba7:	83 c4 10             	add    $0x10,%esp
+  803baa:	85 ff                	test   %edi,%edi
+  803bac:	75 25                	jne    803bd3 <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  803bae:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  803bb1:	74 66                	je     803c19 <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  803bb3:	8b 43 04             	mov    0x4(%ebx),%eax
+  803bb6:	8b 0b                	mov    (%ebx),%ecx
+  803bb8:	8d 51 20             	lea    0x20(%ecx),%edx
+  803bbb:	39 d0                	cmp    %edx,%eax
+  803bbd:	72 2b                	jb     803bea <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  803bbf:	89 da                	mov    %ebx,%edx
+  803bc1:	89 f0                	mov    %esi,%eax
+  803bc3:	e8 94 fe ff ff       	call   803a5c <_pipeisclosed>
+  803bc8:	85 c0                	test   %eax,%eax
+  803bca:	75 51                	jne    803c1d <devpipe_write+0x8d>
+      sys_yield();
+  803bcc:	e8 fe d9 ff ff       	call   8015cf <sys_yield>
+  803bd1:	eb e0                	jmp    803bb3 <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  803bd3:	83 ec 0c             	sub    $0xc,%esp
+  803bd6:	ff 75 10             	push   0x10(%ebp)
+  803bd9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803bdc:	89 c2                	mov    %eax,%edx
+  803bde:	89 f0                	mov    %esi,%eax
+  803be0:	e8 dc fe ff ff       	call   803ac1 <devpipe_write_bulk>
+  803be5:	83 c4 10             	add    $0x10,%esp
+  803be8:	eb 38                	jmp    803c22 <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803bea:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803bed:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  803bf1:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  803bf4:	89 c2                	mov    %eax,%edx
+  803bf6:	c1 fa 1f             	sar    $0x1f,%edx
+  803bf9:	89 d1                	mov    %edx,%ecx
+  803bfb:	c1 e9 1b             	shr    $0x1b,%ecx
+  803bfe:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  803c01:	83 e2 1f             	and    $0x1f,%edx
+  803c04:	29 ca                	sub    %ecx,%edx
+  803c06:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  803c0a:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  803c0e:	83 c0 01             	add    $0x1,%eax
+  803c11:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  803c14:	83 c7 01             	add    $0x1,%edi
+  803c17:	eb 95                	jmp    803bae <devpipe_write+0x1e>
+  return i;
+  803c19:	89 f8                	mov    %edi,%eax
+  803c1b:	eb 05                	jmp    803c22 <devpipe_write+0x92>
+        return 0;
+  803c1d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803c22:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803c25:	5b                   	pop    %ebx
+  803c26:	5e                   	pop    %esi
+  803c27:	5f                   	pop    %edi
+  803c28:	5d                   	pop    %ebp
+  803c29:	c3                   	ret
+
+00803c2a <devpipe_read_bulk>:
+{
+  803c2a:	55                   	push   %ebp
+  803c2b:	89 e5                	mov    %esp,%ebp
+  803c2d:	57                   	push   %edi
+  803c2e:	56                   	push   %esi
+  803c2f:	53                   	push   %ebx
+  803c30:	83 ec 2c             	sub    $0x2c,%esp
+  803c33:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  803c36:	89 d6                	mov    %edx,%esi
+  803c38:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  803c3b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  803c3e:	e8 0c fd ff ff       	call   80394f <pipe_ring>
+  803c43:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  803c46:	85 db                	test   %ebx,%ebx
+  803c48:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  803c4d:	0f 45 c3             	cmovne %ebx,%eax
+  803c50:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  803c53:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  803c58:	8d 46 30             	lea    0x30(%esi),%eax
+  803c5b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  803c5e:	eb 50                	jmp    803cb0 <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  803c60:	89 d1                	mov    %edx,%ecx
+  803c62:	c1 f9 1f             	sar    $0x1f,%ecx
+  803c65:	c1 e9 11             	shr    $0x11,%ecx
+  803c68:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  803c6b:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  803c70:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  803c72:	29 d3                	sub    %edx,%ebx
+  803c74:	ba 00 80 00 00       	mov    $0x8000,%edx
+  803c79:	29 c2                	sub    %eax,%edx
+  803c7b:	39 d3                	cmp    %edx,%ebx
+  803c7d:	0f 47 da             	cmova  %edx,%ebx
+  803c80:	8b 55 08             	mov    0x8(%ebp),%edx
+  803c83:	29 fa                	sub    %edi,%edx
+  803c85:	39 d3                	cmp    %edx,%ebx
+  803c87:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  803c8a:	83 ec 04             	sub    $0x4,%esp
+  803c8d:	53                   	push   %ebx
+  803c8e:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  803c91:	01 c8                	add    %ecx,%eax
+  803c93:	50                   	push   %eax
+  803c94:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  803c97:	01 f8                	add    %edi,%eax
+  803c99:	50                   	push   %eax
+  803c9a:	e8 4b d7 ff ff       	call   8013ea <memcpy>
+    i += m;
+  803c9f:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  803ca1:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  803ca3:	89 f2                	mov    %esi,%edx
+  803ca5:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  803ca8:	e8 03 fd ff ff       	call   8039b0 <pipe_wakeup>
+  803cad:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  803cb0:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  803cb3:	73 51                	jae    803d06 <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  803cb5:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  803cb8:	8b 16                	mov    (%esi),%edx
+  803cba:	39 da                	cmp    %ebx,%edx
+  803cbc:	75 a2                	jne    803c60 <devpipe_read_bulk+0x36>
+      if (i > 0)
+  803cbe:	85 ff                	test   %edi,%edi
+  803cc0:	75 44                	jne    803d06 <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  803cc2:	89 f2                	mov    %esi,%edx
+  803cc4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803cc7:	e8 90 fd ff ff       	call   803a5c <_pipeisclosed>
+  803ccc:	85 c0                	test   %eax,%eax
+  803cce:	75 3a                	jne    803d0a <devpipe_read_bulk+0xe0>
+  803cd0:	b8 01 00 00 00       	mov    $0x1,%eax
+  803cd5:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  803cd9:	6a 64                	push   $0x64
+  803cdb:	ff 75 d4             	push   -0x2c(%ebp)
+  803cde:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  803cdf:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  803ce2:	50                   	push   %eax
+  803ce3:	e8 82 dc ff ff       	call   80196a <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  803ce8:	85 c0                	test   %eax,%eax
+  803cea:	ba 00 00 00 00       	mov    $0x0,%edx
+  803cef:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  803cf2:	83 c4 10             	add    $0x10,%esp
+  803cf5:	a8 01                	test   $0x1,%al
+  803cf7:	74 b7                	je     803cb0 <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  803cf9:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  803cfe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803d01:	5b                   	pop    %ebx
+  803d02:	5e                   	pop    %esi
+  803d03:	5f                   	pop    %edi
+  803d04:	5d                   	pop    %ebp
+  803d05:	c3                   	ret
+  return i;
+  803d06:	89 f8                	mov    %edi,%eax
+  803d08:	eb f4                	jmp    803cfe <devpipe_read_bulk+0xd4>
+        return 0;
+  803d0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d0f:	eb ed                	jmp    803cfe <devpipe_read_bulk+0xd4>
+
+00803d11 <devpipe_read>:
+{
+  803d11:	55                   	push   %ebp
+  803d12:	89 e5                	mov    %esp,%ebp
+  803d14:	57                   	push   %edi
+  803d15:	56                   	push   %esi
+  803d16:	53                   	push   %ebx
+  803d17:	83 ec 18             	sub    $0x18,%esp
+  803d1a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  803d1d:	57                   	push   %edi
+  803d1e:	e8 50 e3 ff ff       	call   802073 <fd2data>
+  803d23:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  803d25:	8b 70 28             	mov    0x28(%eax),%esi
+  803d28:	83 c4 10             	add    $0x10,%esp
+  803d2b:	85 f6                	test   %esi,%esi
+  803d2d:	75 24                	jne    803d53 <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  803d2f:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803d32:	74 60                	je     803d94 <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  803d34:	8b 03                	mov    (%ebx),%eax
+  803d36:	3b 43 04             	cmp    0x4(%ebx),%eax
+  803d39:	75 3b                	jne    803d76 <devpipe_read+0x65>
+      if (i > 0)
+  803d3b:	85 f6                	test   %esi,%esi
+  803d3d:	75 2d                	jne    803d6c <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  803d3f:	89 da                	mov    %ebx,%edx
+  803d41:	89 f8                	mov    %edi,%eax
+  803d43:	e8 14 fd ff ff       	call   803a5c <_pipeisclosed>
+  803d48:	85 c0                	test   %eax,%eax
+  803d4a:	75 4c                	jne    803d98 <devpipe_read+0x87>
+      sys_yield();
+  803d4c:	e8 7e d8 ff ff       	call   8015cf <sys_yield>
+  803d51:	eb e1                	jmp    803d34 <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  803d53:	83 ec 08             	sub    $0x8,%esp
+  803d56:	6a 00                	push   $0x0
+  803d58:	ff 75 10             	push   0x10(%ebp)
+  803d5b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803d5e:	89 c2                	mov    %eax,%edx
+  803d60:	89 f8                	mov    %edi,%eax
+  803d62:	e8 c3 fe ff ff       	call   803c2a <devpipe_read_bulk>
+  803d67:	83 c4 10             	add    $0x10,%esp
+  803d6a:	eb 02                	jmp    803d6e <devpipe_read+0x5d>
+        return i;
+  803d6c:	89 f0                	mov    %esi,%eax
+}
+  803d6e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803d71:	5b                   	pop    %ebx
+  803d72:	5e                   	pop    %esi
+  803d73:	5f                   	pop    %edi
+  803d74:	5d                   	pop    %ebp
+  803d75:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803d76:	99                   	cltd
+  803d77:	c1 ea 1b             	shr    $0x1b,%edx
+  803d7a:	01 d0                	add    %edx,%eax
+  803d7c:	83 e0 1f             	and    $0x1f,%eax
+  803d7f:	29 d0                	sub    %edx,%eax
+  803d81:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  803d86:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  803d89:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  803d8c:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  803d8f:	83 c6 01             	add    $0x1,%esi
+  803d92:	eb 9b                	jmp    803d2f <devpipe_read+0x1e>
+  return i;
+  803d94:	89 f0                	mov    %esi,%eax
+  803d96:	eb d6                	jmp    803d6e <devpipe_read+0x5d>
+        return 0;
+  803d98:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d9d:	eb cf                	jmp    803d6e <devpipe_read+0x5d>
+
+00803d9f <pipe2>:
+{
+  803d9f:	55                   	push   %ebp
+  803da0:	89 e5                	mov    %esp,%ebp
+  803da2:	57                   	push   %edi
+  803da3:	56                   	push   %esi
+  803da4:	53                   	push   %ebx
+  803da5:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  803da8:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  803dab:	50                   	push   %eax
+  803dac:	e8 d6 e2 ff ff       	call   802087 <fd_alloc>
+  803db1:	89 c3                	mov    %eax,%ebx
+  803db3:	83 c4 10             	add    $0x10,%esp
+  803db6:	85 c0                	test   %eax,%eax
+  803db8:	0f 88 fb 01 00 00    	js     803fb9 <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803dbe:	83 ec 04             	sub    $0x4,%esp
+  803dc1:	68 07 04 00 00       	push   $0x407
+  803dc6:	ff 75 e4             	push   -0x1c(%ebp)
+  803dc9:	6a 00                	push   $0x0
+  803dcb:	e8 61 d8 ff ff       	call   801631 <sys_page_alloc>
+  803dd0:	89 c3                	mov    %eax,%ebx
+  803dd2:	83 c4 10             	add    $0x10,%esp
+  803dd5:	85 c0                	test   %eax,%eax
+  803dd7:	0f 88 dc 01 00 00    	js     803fb9 <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  803ddd:	83 ec 0c             	sub    $0xc,%esp
+  803de0:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  803de3:	50                   	push   %eax
+  803de4:	e8 9e e2 ff ff       	call   802087 <fd_alloc>
+  803de9:	89 c3                	mov    %eax,%ebx
+  803deb:	83 c4 10             	add    $0x10,%esp
+  803dee:	85 c0                	test   %eax,%eax
+  803df0:	0f 88 b3 01 00 00    	js     803fa9 <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803df6:	83 ec 04             	sub    $0x4,%esp
+  803df9:	68 07 04 00 00       	push   $0x407
+  803dfe:	ff 75 e0             	push   -0x20(%ebp)
+  803e01:	6a 00                	push   $0x0
+  803e03:	e8 29 d8 ff ff       	call   801631 <sys_page_alloc>
+  803e08:	89 c3                	mov    %eax,%ebx
+  803e0a:	83 c4 10             	add    $0x10,%esp
+  803e0d:	85 c0                	test   %eax,%eax
+  803e0f:	0f 88 94 01 00 00    	js     803fa9 <pipe2+0x20a>
+  va = fd2data(fd0);
+  803e15:	83 ec 0c             	sub    $0xc,%esp
+  803e18:	ff 75 e4             	push   -0x1c(%ebp)
+  803e1b:	e8 53 e2 ff ff       	call   802073 <fd2data>
+  803e20:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803e22:	83 c4 0c             	add    $0xc,%esp
+  803e25:	68 07 04 00 00       	push   $0x407
+  803e2a:	50                   	push   %eax
+  803e2b:	6a 00                	push   $0x0
+  803e2d:	e8 ff d7 ff ff       	call   801631 <sys_page_alloc>
+  803e32:	89 c3                	mov    %eax,%ebx
+  803e34:	83 c4 10             	add    $0x10,%esp
+  803e37:	85 c0                	test   %eax,%eax
+  803e39:	0f 88 5a 01 00 00    	js     803f99 <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  803e3f:	83 ec 0c             	sub    $0xc,%esp
+  803e42:	ff 75 e0             	push   -0x20(%ebp)
+  803e45:	e8 29 e2 ff ff       	call   802073 <fd2data>
+  803e4a:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  803e51:	50                   	push   %eax
+  803e52:	6a 00                	push   $0x0
+  803e54:	57                   	push   %edi
+  803e55:	6a 00                	push   $0x0
+  803e57:	e8 18 d8 ff ff       	call   801674 <sys_page_map>
+  803e5c:	89 c3                	mov    %eax,%ebx
+  803e5e:	83 c4 20             	add    $0x20,%esp
+  803e61:	85 c0                	test   %eax,%eax
+  803e63:	0f 88 22 01 00 00    	js     803f8b <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  803e69:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  803e6d:	74 72                	je     803ee1 <pipe2+0x142>
+  803e6f:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  803e74:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803e77:	e8 d3 fa ff ff       	call   80394f <pipe_ring>
+  803e7c:	83 ec 04             	sub    $0x4,%esp
+  803e7f:	68 07 04 00 00       	push   $0x407
+  803e84:	01 f0                	add    %esi,%eax
+  803e86:	50                   	push   %eax
+  803e87:	6a 00                	push   $0x0
+  803e89:	e8 a3 d7 ff ff       	call   801631 <sys_page_alloc>
+  803e8e:	89 c3                	mov    %eax,%ebx
+  803e90:	83 c4 10             	add    $0x10,%esp
+  803e93:	85 c0                	test   %eax,%eax
+  803e95:	0f 88 97 00 00 00    	js     803f32 <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  803e9b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803e9e:	e8 ac fa ff ff       	call   80394f <pipe_ring>
+  803ea3:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  803ea6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803ea9:	e8 a1 fa ff ff       	call   80394f <pipe_ring>
+  803eae:	83 ec 0c             	sub    $0xc,%esp
+  803eb1:	68 07 04 00 00       	push   $0x407
+  803eb6:	53                   	push   %ebx
+  803eb7:	6a 00                	push   $0x0
+  803eb9:	01 f0                	add    %esi,%eax
+  803ebb:	50                   	push   %eax
+  803ebc:	6a 00                	push   $0x0
+  803ebe:	e8 b1 d7 ff ff       	call   801674 <sys_page_map>
+  803ec3:	89 c3                	mov    %eax,%ebx
+  803ec5:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803ecb:	83 c4 20             	add    $0x20,%esp
+  803ece:	85 c0                	test   %eax,%eax
+  803ed0:	78 60                	js     803f32 <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  803ed2:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  803ed8:	75 9a                	jne    803e74 <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  803eda:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  803ee1:	a1 3c 60 80 00       	mov    0x80603c,%eax
+  803ee6:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  803ee9:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  803eeb:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  803eee:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  803ef5:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  803ef8:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  803efa:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803efd:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  803f04:	83 ec 0c             	sub    $0xc,%esp
+  803f07:	ff 75 e4             	push   -0x1c(%ebp)
+  803f0a:	e8 54 e1 ff ff       	call   802063 <fd2num>
+  803f0f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803f12:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  803f14:	83 c4 04             	add    $0x4,%esp
+  803f17:	ff 75 e0             	push   -0x20(%ebp)
+  803f1a:	e8 44 e1 ff ff       	call   802063 <fd2num>
+  803f1f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  803f22:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  803f25:	83 c4 10             	add    $0x10,%esp
+  803f28:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803f2d:	e9 87 00 00 00       	jmp    803fb9 <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  803f32:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  803f37:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803f3a:	e8 10 fa ff ff       	call   80394f <pipe_ring>
+  803f3f:	83 ec 08             	sub    $0x8,%esp
+  803f42:	01 f0                	add    %esi,%eax
+  803f44:	50                   	push   %eax
+  803f45:	6a 00                	push   $0x0
+  803f47:	e8 6a d7 ff ff       	call   8016b6 <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  803f4c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  803f4f:	e8 fb f9 ff ff       	call   80394f <pipe_ring>
+  803f54:	83 c4 08             	add    $0x8,%esp
+  803f57:	01 f0                	add    %esi,%eax
+  803f59:	50                   	push   %eax
+  803f5a:	6a 00                	push   $0x0
+  803f5c:	e8 55 d7 ff ff       	call   8016b6 <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  803f61:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803f67:	83 c4 10             	add    $0x10,%esp
+  803f6a:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  803f70:	75 c5                	jne    803f37 <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  803f72:	83 ec 0c             	sub    $0xc,%esp
+  803f75:	ff 75 e0             	push   -0x20(%ebp)
+  803f78:	e8 f6 e0 ff ff       	call   802073 <fd2data>
+  803f7d:	83 c4 08             	add    $0x8,%esp
+  803f80:	50                   	push   %eax
+  803f81:	6a 00                	push   $0x0
+  803f83:	e8 2e d7 ff ff       	call   8016b6 <sys_page_unmap>
+  803f88:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  803f8b:	83 ec 08             	sub    $0x8,%esp
+  803f8e:	57                   	push   %edi
+  803f8f:	6a 00                	push   $0x0
+  803f91:	e8 20 d7 ff ff       	call   8016b6 <sys_page_unmap>
+  803f96:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  803f99:	83 ec 08             	sub    $0x8,%esp
+  803f9c:	ff 75 e0             	push   -0x20(%ebp)
+  803f9f:	6a 00                	push   $0x0
+  803fa1:	e8 10 d7 ff ff       	call   8016b6 <sys_page_unmap>
+  803fa6:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  803fa9:	83 ec 08             	sub    $0x8,%esp
+  803fac:	ff 75 e4             	push   -0x1c(%ebp)
+  803faf:	6a 00                	push   $0x0
+  803fb1:	e8 00 d7 ff ff       	call   8016b6 <sys_page_unmap>
+  803fb6:	83 c4 10             	add    $0x10,%esp
+}
+  803fb9:	89 d8                	mov    %ebx,%eax
+  803fbb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803fbe:	5b                   	pop    %ebx
+  803fbf:	5e                   	pop    %esi
+  803fc0:	5f                   	pop    %edi
+  803fc1:	5d                   	pop    %ebp
+  803fc2:	c3                   	ret
+
+00803fc3 <pipe>:
+{
+  803fc3:	55                   	push   %ebp
+  803fc4:	89 e5                	mov    %esp,%ebp
+  803fc6:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  803fc9:	6a 00                	push   $0x0
+  803fcb:	ff 75 08             	push   0x8(%ebp)
+  803fce:	e8 cc fd ff ff       	call   803d9f <pipe2>
+}
+  803fd3:	c9                   	leave
+  803fd4:	c3                   	ret
+
+00803fd5 <pipeisclosed>:
+{
+  803fd5:	55                   	push   %ebp
+  803fd6:	89 e5                	mov    %esp,%ebp
+  803fd8:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803fdb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803fde:	50                   	push   %eax
+  803fdf:	ff 75 08             	push   0x8(%ebp)
+  803fe2:	e8 f6 e0 ff ff       	call   8020dd <fd_lookup>
+  803fe7:	83 c4 10             	add    $0x10,%esp
+  803fea:	85 c0                	test   %eax,%eax
+  803fec:	78 18                	js     804006 <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  803fee:	83 ec 0c             	sub    $0xc,%esp
+  803ff1:	ff 75 f4             	push   -0xc(%ebp)
+  803ff4:	e8 7a e0 ff ff       	call   802073 <fd2data>
+  803ff9:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  803ffb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803ffe:	e8 59 fa ff ff       	call   803a5c <_pipeisclosed>
+  804003:	83 c4 10             	add    $0x10,%esp
+}
+  804006:	c9                   	leave
+  804007:	c3                   	ret
+
+00804008 <pipe_splice>:
+{
+  804008:	55                   	push   %ebp
+  804009:	89 e5                	mov    %esp,%ebp
+  80400b:	57                   	push   %edi
+  80400c:	56                   	push   %esi
+  80400d:	53                   	push   %ebx
+  80400e:	83 ec 34             	sub    $0x34,%esp
+  804011:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  804014:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  804017:	50                   	push   %eax
+  804018:	ff 75 08             	push   0x8(%ebp)
+  80401b:	e8 bd e0 ff ff       	call   8020dd <fd_lookup>
+  804020:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  804023:	83 c4 10             	add    $0x10,%esp
+  804026:	85 c0                	test   %eax,%eax
+  804028:	0f 88 d7 00 00 00    	js     804105 <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  80402e:	83 ec 0c             	sub    $0xc,%esp
+  804031:	ff 75 e4             	push   -0x1c(%ebp)
+  804034:	e8 3a e0 ff ff       	call   802073 <fd2data>
+  804039:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  80403b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80403e:	83 c4 10             	add    $0x10,%esp
+  804041:	8b 15 3c 60 80 00    	mov    0x80603c,%edx
+  804047:	39 10                	cmp    %edx,(%eax)
+  804049:	0f 85 c1 00 00 00    	jne    804110 <pipe_splice+0x108>
+  80404f:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  804053:	0f 84 c0 00 00 00    	je     804119 <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  804059:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  80405d:	0f 84 bf 00 00 00    	je     804122 <pipe_splice+0x11a>
+  804063:	89 f7                	mov    %esi,%edi
+  804065:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  80406b:	0f 85 ba 00 00 00    	jne    80412b <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  804071:	8d 43 04             	lea    0x4(%ebx),%eax
+  804074:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  804077:	eb 38                	jmp    8040b1 <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  804079:	83 ec 0c             	sub    $0xc,%esp
+  80407c:	68 00 10 00 00       	push   $0x1000
+  804081:	89 f1                	mov    %esi,%ecx
+  804083:	89 da                	mov    %ebx,%edx
+  804085:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  804088:	e8 34 fa ff ff       	call   803ac1 <devpipe_write_bulk>
+  80408d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  804090:	83 c4 10             	add    $0x10,%esp
+  804093:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  804098:	75 53                	jne    8040ed <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  80409a:	83 ec 08             	sub    $0x8,%esp
+  80409d:	56                   	push   %esi
+  80409e:	6a 00                	push   $0x0
+  8040a0:	e8 11 d6 ff ff       	call   8016b6 <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  8040a5:	83 c7 01             	add    $0x1,%edi
+  8040a8:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8040ae:	83 c4 10             	add    $0x10,%esp
+  8040b1:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8040b4:	74 3a                	je     8040f0 <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  8040b6:	8b 03                	mov    (%ebx),%eax
+  8040b8:	39 43 04             	cmp    %eax,0x4(%ebx)
+  8040bb:	75 bc                	jne    804079 <pipe_splice+0x71>
+  8040bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040c2:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  8040c6:	85 c0                	test   %eax,%eax
+  8040c8:	74 af                	je     804079 <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  8040ca:	83 ec 04             	sub    $0x4,%esp
+  8040cd:	6a 07                	push   $0x7
+  8040cf:	56                   	push   %esi
+  8040d0:	ff 75 d0             	push   -0x30(%ebp)
+  8040d3:	e8 b5 d8 ff ff       	call   80198d <sys_chan_wakeup>
+  8040d8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8040db:	83 c4 10             	add    $0x10,%esp
+  8040de:	85 c0                	test   %eax,%eax
+  8040e0:	79 b8                	jns    80409a <pipe_splice+0x92>
+  8040e2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8040e7:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  8040eb:	eb 8c                	jmp    804079 <pipe_splice+0x71>
+  8040ed:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  8040f0:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8040f4:	75 06                	jne    8040fc <pipe_splice+0xf4>
+  8040f6:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  8040fa:	78 09                	js     804105 <pipe_splice+0xfd>
+  return i * PGSIZE;
+  8040fc:	8b 45 10             	mov    0x10(%ebp),%eax
+  8040ff:	c1 e0 0c             	shl    $0xc,%eax
+  804102:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  804105:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  804108:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80410b:	5b                   	pop    %ebx
+  80410c:	5e                   	pop    %esi
+  80410d:	5f                   	pop    %edi
+  80410e:	5d                   	pop    %ebp
+  80410f:	c3                   	ret
+    return -E_INVAL;
+  804110:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  804117:	eb ec                	jmp    804105 <pipe_splice+0xfd>
+  804119:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  804120:	eb e3                	jmp    804105 <pipe_splice+0xfd>
+  804122:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  804129:	eb da                	jmp    804105 <pipe_splice+0xfd>
+  80412b:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  804132:	eb d1                	jmp    804105 <pipe_splice+0xfd>
+
+00804134 <pipe_splice_read>:
+{
+  804134:	55                   	push   %ebp
+  804135:	89 e5                	mov    %esp,%ebp
+  804137:	53                   	push   %ebx
+  804138:	83 ec 1c             	sub    $0x1c,%esp
+  80413b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80413e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804141:	50                   	push   %eax
+  804142:	ff 75 08             	push   0x8(%ebp)
+  804145:	e8 93 df ff ff       	call   8020dd <fd_lookup>
+  80414a:	83 c4 10             	add    $0x10,%esp
+  80414d:	85 c0                	test   %eax,%eax
+  80414f:	78 49                	js     80419a <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  804151:	83 ec 0c             	sub    $0xc,%esp
+  804154:	ff 75 f4             	push   -0xc(%ebp)
+  804157:	e8 17 df ff ff       	call   802073 <fd2data>
+  80415c:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  80415e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  804161:	83 c4 10             	add    $0x10,%esp
+  804164:	8b 0d 3c 60 80 00    	mov    0x80603c,%ecx
+  80416a:	39 08                	cmp    %ecx,(%eax)
+  80416c:	75 31                	jne    80419f <pipe_splice_read+0x6b>
+  80416e:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  804172:	74 32                	je     8041a6 <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  804174:	8b 48 08             	mov    0x8(%eax),%ecx
+  804177:	83 e1 03             	and    $0x3,%ecx
+  80417a:	83 f9 01             	cmp    $0x1,%ecx
+  80417d:	74 2e                	je     8041ad <pipe_splice_read+0x79>
+  80417f:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  804185:	75 2d                	jne    8041b4 <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  804187:	83 ec 08             	sub    $0x8,%esp
+  80418a:	53                   	push   %ebx
+  80418b:	68 00 10 00 00       	push   $0x1000
+  804190:	89 d9                	mov    %ebx,%ecx
+  804192:	e8 93 fa ff ff       	call   803c2a <devpipe_read_bulk>
+  804197:	83 c4 10             	add    $0x10,%esp
+}
+  80419a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80419d:	c9                   	leave
+  80419e:	c3                   	ret
+    return -E_INVAL;
+  80419f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8041a4:	eb f4                	jmp    80419a <pipe_splice_read+0x66>
+  8041a6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8041ab:	eb ed                	jmp    80419a <pipe_splice_read+0x66>
+  8041ad:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8041b2:	eb e6                	jmp    80419a <pipe_splice_read+0x66>
+  8041b4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8041b9:	eb df                	jmp    80419a <pipe_splice_read+0x66>
+
+008041bb <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  8041bb:	55                   	push   %ebp
+  8041bc:	89 e5                	mov    %esp,%ebp
+  8041be:	56                   	push   %esi
+  8041bf:	53                   	push   %ebx
+  8041c0:	8b 75 08             	mov    0x8(%ebp),%esi
+  const volatile struct Env *e;
+
+  assert(envid != 0);
+  8041c3:	85 f6                	test   %esi,%esi
+  8041c5:	74 15                	je     8041dc <wait+0x21>
+  e = &envs[ENVX(envid)];
+  8041c7:	89 f0                	mov    %esi,%eax
+  8041c9:	25 ff 03 00 00       	and    $0x3ff,%eax
+  while (e->env_id == envid && e->env_status != ENV_FREE)
+  8041ce:	8d 1c c0             	lea    (%eax,%eax,8),%ebx
+  8041d1:	c1 e3 04             	shl    $0x4,%ebx
+  8041d4:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  8041da:	eb 1b                	jmp    8041f7 <wait+0x3c>
+  assert(envid != 0);
+  8041dc:	68 69 54 80 00       	push   $0x805469
+  8041e1:	68 cf 4d 80 00       	push   $0x804dcf
+  8041e6:	6a 09                	push   $0x9
+  8041e8:	68 74 54 80 00       	push   $0x805474
+  8041ed:	e8 57 c8 ff ff       	call   800a49 <_panic>
+    sys_yield();
+  8041f2:	e8 d8 d3 ff ff       	call   8015cf <sys_yield>
+  while (e->env_id == envid && e->env_status != ENV_FREE)
+  8041f7:	8b 43 48             	mov    0x48(%ebx),%eax
+  8041fa:	39 f0                	cmp    %esi,%eax
+  8041fc:	75 07                	jne    804205 <wait+0x4a>
+  8041fe:	8b 43 54             	mov    0x54(%ebx),%eax
+  804201:	85 c0                	test   %eax,%eax
+  804203:	75 ed                	jne    8041f2 <wait+0x37>
+}
+  804205:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804208:	5b                   	pop    %ebx
+  804209:	5e                   	pop    %esi
+  80420a:	5d                   	pop    %ebp
+  80420b:	c3                   	ret
+
+0080420c <mmap_find>:
+          utf->utf_eip, utf->utf_err);
+}
+
+static struct Mmap *
+mmap_find(uintptr_t va)
+{
+  80420c:	55                   	push   %ebp
+  80420d:	89 e5                	mov    %esp,%ebp
+  80420f:	56                   	push   %esi
+  804210:	53                   	push   %ebx
+  int i;
+
+  for (i = 0; i < NMMAP; i++)
+  804211:	ba a0 82 80 00       	mov    $0x8082a0,%edx
+  804216:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80421b:	eb 0b                	jmp    804228 <mmap_find+0x1c>
+  80421d:	83 c3 01             	add    $0x1,%ebx
+  804220:	83 c2 14             	add    $0x14,%edx
+  804223:	83 fb 10             	cmp    $0x10,%ebx
+  804226:	74 1d                	je     804245 <mmap_find+0x39>
+    if (mmaps[i].mm_va && va >= mmaps[i].mm_va &&
+  804228:	8b 0a                	mov    (%edx),%ecx
+  80422a:	39 c8                	cmp    %ecx,%eax
+  80422c:	72 ef                	jb     80421d <mmap_find+0x11>
+  80422e:	85 c9                	test   %ecx,%ecx
+  804230:	74 eb                	je     80421d <mmap_find+0x11>
+        va < mmaps[i].mm_va + mmaps[i].mm_len)
+  804232:	03 4a 04             	add    0x4(%edx),%ecx
+    if (mmaps[i].mm_va && va >= mmaps[i].mm_va &&
+  804235:	39 c8                	cmp    %ecx,%eax
+  804237:	73 e4                	jae    80421d <mmap_find+0x11>
+      return &mmaps[i];
+  804239:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  80423c:	8d 04 85 a0 82 80 00 	lea    0x8082a0(,%eax,4),%eax
+  804243:	eb 05                	jmp    80424a <mmap_find+0x3e>
+  return NULL;
+  804245:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80424a:	5b                   	pop    %ebx
+  80424b:	5e                   	pop    %esi
+  80424c:	5d                   	pop    %ebp
+  80424d:	c3                   	ret
+
+0080424e <va_mapped>:
+
+static bool
+va_mapped(uintptr_t va)
+{
+  return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+  80424e:	89 c2                	mov    %eax,%edx
+  804250:	c1 ea 16             	shr    $0x16,%edx
+  804253:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80425a:	f6 c2 01             	test   $0x1,%dl
+  80425d:	74 11                	je     804270 <va_mapped+0x22>
+  80425f:	c1 e8 0c             	shr    $0xc,%eax
+  804262:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  804269:	83 e0 01             	and    $0x1,%eax
+  80426c:	83 e0 01             	and    $0x1,%eax
+}
+  80426f:	c3                   	ret
+  return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+  804270:	b8 00 00 00 00       	mov    $0x0,%eax
+  804275:	eb f5                	jmp    80426c <va_mapped+0x1e>
+
+00804277 <mmap_copy>:
+
+// Replace the page at 'va' with a copy of its first 'n' bytes, the rest
+// zeroed, mapped with 'perm'.
+static void
+mmap_copy(uintptr_t va, size_t n, int perm)
+{
+  804277:	55                   	push   %ebp
+  804278:	89 e5                	mov    %esp,%ebp
+  80427a:	57                   	push   %edi
+  80427b:	56                   	push   %esi
+  80427c:	53                   	push   %ebx
+  80427d:	83 ec 10             	sub    $0x10,%esp
+  804280:	89 c3                	mov    %eax,%ebx
+  804282:	89 d7                	mov    %edx,%edi
+  804284:	89 ce                	mov    %ecx,%esi
+  int r;
+
+  if ((r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  804286:	6a 07                	push   $0x7
+  804288:	68 00 f0 7f 00       	push   $0x7ff000
+  80428d:	6a 00                	push   $0x0
+  80428f:	e8 9d d3 ff ff       	call   801631 <sys_page_alloc>
+  804294:	83 c4 10             	add    $0x10,%esp
+  804297:	85 c0                	test   %eax,%eax
+  804299:	78 46                	js     8042e1 <mmap_copy+0x6a>
+    panic("mmap: %e", r);
+  memmove(PFTEMP, (void *) va, n);
+  80429b:	83 ec 04             	sub    $0x4,%esp
+  80429e:	57                   	push   %edi
+  80429f:	53                   	push   %ebx
+  8042a0:	68 00 f0 7f 00       	push   $0x7ff000
+  8042a5:	e8 de d0 ff ff       	call   801388 <memmove>
+  if ((r = sys_page_map(0, PFTEMP, 0, (void *) va, perm)) < 0 ||
+  8042aa:	89 34 24             	mov    %esi,(%esp)
+  8042ad:	53                   	push   %ebx
+  8042ae:	6a 00                	push   $0x0
+  8042b0:	68 00 f0 7f 00       	push   $0x7ff000
+  8042b5:	6a 00                	push   $0x0
+  8042b7:	e8 b8 d3 ff ff       	call   801674 <sys_page_map>
+  8042bc:	83 c4 20             	add    $0x20,%esp
+  8042bf:	85 c0                	test   %eax,%eax
+  8042c1:	78 30                	js     8042f3 <mmap_copy+0x7c>
+      (r = sys_page_unmap(0, PFTEMP)) < 0)
+  8042c3:	83 ec 08             	sub    $0x8,%esp
+  8042c6:	68 00 f0 7f 00       	push   $0x7ff000
+  8042cb:	6a 00                	push   $0x0
+  8042cd:	e8 e4 d3 ff ff       	call   8016b6 <sys_page_unmap>
+  if ((r = sys_page_map(0, PFTEMP, 0, (void *) va, perm)) < 0 ||
+  8042d2:	83 c4 10             	add    $0x10,%esp
+  8042d5:	85 c0                	test   %eax,%eax
+  8042d7:	78 1a                	js     8042f3 <mmap_copy+0x7c>
+    panic("mmap: %e", r);
+}
+  8042d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8042dc:	5b                   	pop    %ebx
+  8042dd:	5e                   	pop    %esi
+  8042de:	5f                   	pop    %edi
+  8042df:	5d                   	pop    %ebp
+  8042e0:	c3                   	ret
+    panic("mmap: %e", r);
+  8042e1:	50                   	push   %eax
+  8042e2:	68 7f 54 80 00       	push   $0x80547f
+  8042e7:	6a 3e                	push   $0x3e
+  8042e9:	68 88 54 80 00       	push   $0x805488
+  8042ee:	e8 56 c7 ff ff       	call   800a49 <_panic>
+    panic("mmap: %e", r);
+  8042f3:	50                   	push   %eax
+  8042f4:	68 7f 54 80 00       	push   $0x80547f
+  8042f9:	6a 42                	push   $0x42
+  8042fb:	68 88 54 80 00       	push   $0x805488
+  804300:	e8 44 c7 ff ff       	call   800a49 <_panic>
+
+00804305 <mmap_fault>:
+// Handle a page fault in a mapping, if it is one.  Returns 1 if it was.
+// The fork page fault handlers call this first, so that mappings keep
+// working after a fork.
+bool
+mmap_fault(struct UTrapframe *utf)
+{
+  804305:	55                   	push   %ebp
+  804306:	89 e5                	mov    %esp,%ebp
+  804308:	57                   	push   %edi
+  804309:	56                   	push   %esi
+  80430a:	53                   	push   %ebx
+  80430b:	83 ec 1c             	sub    $0x1c,%esp
+  80430e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Fsreq_read_map saved;
+  struct Mmap *m;
+  uintptr_t va;
+  int perm, r;
+
+  va = ROUNDDOWN(utf->utf_fault_va, PGSIZE);
+  804311:	8b 1f                	mov    (%edi),%ebx
+  804313:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if (va < MMAPBASE || va >= MMAPTOP || (m = mmap_find(va)) == NULL)
+  804319:	8d 83 00 00 00 60    	lea    0x60000000(%ebx),%eax
+  80431f:	3d ff ff ff 2f       	cmp    $0x2fffffff,%eax
+  804324:	0f 87 24 01 00 00    	ja     80444e <mmap_fault+0x149>
+  80432a:	89 d8                	mov    %ebx,%eax
+  80432c:	e8 db fe ff ff       	call   80420c <mmap_find>
+  804331:	89 c6                	mov    %eax,%esi
+  804333:	85 c0                	test   %eax,%eax
+  804335:	0f 84 20 01 00 00    	je     80445b <mmap_fault+0x156>
+    return 0;
+  if ((utf->utf_err & FEC_WR) && m->mm_perm == MAP_RDONLY)
+  80433b:	f6 47 04 02          	testb  $0x2,0x4(%edi)
+  80433f:	74 13                	je     804354 <mmap_fault+0x4f>
+  804341:	83 78 10 00          	cmpl   $0x0,0x10(%eax)
+  804345:	0f 84 17 01 00 00    	je     804462 <mmap_fault+0x15d>
+    return 0;
+  perm = PTE_P | PTE_U | (m->mm_perm == MAP_RDONLY ? 0 : PTE_W);
+  80434b:	c7 45 e4 07 00 00 00 	movl   $0x7,-0x1c(%ebp)
+  804352:	eb 0f                	jmp    804363 <mmap_fault+0x5e>
+  804354:	83 78 10 01          	cmpl   $0x1,0x10(%eax)
+  804358:	19 c0                	sbb    %eax,%eax
+  80435a:	83 e0 fe             	and    $0xfffffffe,%eax
+  80435d:	83 c0 07             	add    $0x7,%eax
+  804360:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+
+  if (!va_mapped(va)) {
+  804363:	89 d8                	mov    %ebx,%eax
+  804365:	e8 e4 fe ff ff       	call   80424e <va_mapped>
+  80436a:	84 c0                	test   %al,%al
+  80436c:	74 42                	je     8043b0 <mmap_fault+0xab>
+    }
+  }
+
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+    mmap_copy(va, PGSIZE, perm);
+  return 1;
+  80436e:	b8 01 00 00 00       	mov    $0x1,%eax
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+  804373:	f6 47 04 02          	testb  $0x2,0x4(%edi)
+  804377:	0f 84 d6 00 00 00    	je     804453 <mmap_fault+0x14e>
+  80437d:	89 d8                	mov    %ebx,%eax
+  80437f:	c1 e8 0c             	shr    $0xc,%eax
+  804382:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  return 1;
+  804389:	b8 01 00 00 00       	mov    $0x1,%eax
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+  80438e:	f6 c2 02             	test   $0x2,%dl
+  804391:	0f 85 bc 00 00 00    	jne    804453 <mmap_fault+0x14e>
+    mmap_copy(va, PGSIZE, perm);
+  804397:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80439a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80439f:	89 d8                	mov    %ebx,%eax
+  8043a1:	e8 d1 fe ff ff       	call   804277 <mmap_copy>
+  return 1;
+  8043a6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8043ab:	e9 a3 00 00 00       	jmp    804453 <mmap_fault+0x14e>
+    saved = fsipcbuf.read_map;
+  8043b0:	a1 00 90 80 00       	mov    0x809000,%eax
+  8043b5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8043b8:	8b 15 04 90 80 00    	mov    0x809004,%edx
+  8043be:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    r = read_map(m->mm_fd, m->mm_offset + (va - m->mm_va), (void *) va);
+  8043c1:	83 ec 04             	sub    $0x4,%esp
+  8043c4:	53                   	push   %ebx
+  8043c5:	89 d8                	mov    %ebx,%eax
+  8043c7:	03 46 0c             	add    0xc(%esi),%eax
+  8043ca:	2b 06                	sub    (%esi),%eax
+  8043cc:	50                   	push   %eax
+  8043cd:	ff 76 08             	push   0x8(%esi)
+  8043d0:	e8 7a ea ff ff       	call   802e4f <read_map>
+    fsipcbuf.read_map = saved;
+  8043d5:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8043d8:	89 0d 00 90 80 00    	mov    %ecx,0x809000
+  8043de:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  8043e1:	89 15 04 90 80 00    	mov    %edx,0x809004
+    if (r < 0)
+  8043e7:	83 c4 10             	add    $0x10,%esp
+  8043ea:	85 c0                	test   %eax,%eax
+  8043ec:	78 20                	js     80440e <mmap_fault+0x109>
+    if (r == 0) {
+  8043ee:	74 30                	je     804420 <mmap_fault+0x11b>
+    if (r < PGSIZE) {
+  8043f0:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  8043f5:	0f 8f 73 ff ff ff    	jg     80436e <mmap_fault+0x69>
+      mmap_copy(va, r, perm);
+  8043fb:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8043fe:	89 c2                	mov    %eax,%edx
+  804400:	89 d8                	mov    %ebx,%eax
+  804402:	e8 70 fe ff ff       	call   804277 <mmap_copy>
+      return 1;
+  804407:	b8 01 00 00 00       	mov    $0x1,%eax
+  80440c:	eb 45                	jmp    804453 <mmap_fault+0x14e>
+      panic("mmap: read_map: %e", r);
+  80440e:	50                   	push   %eax
+  80440f:	68 93 54 80 00       	push   $0x805493
+  804414:	6a 5f                	push   $0x5f
+  804416:	68 88 54 80 00       	push   $0x805488
+  80441b:	e8 29 c6 ff ff       	call   800a49 <_panic>
+      if ((r = sys_page_alloc(0, (void *) va, perm)) < 0)
+  804420:	83 ec 04             	sub    $0x4,%esp
+  804423:	ff 75 e4             	push   -0x1c(%ebp)
+  804426:	53                   	push   %ebx
+  804427:	6a 00                	push   $0x0
+  804429:	e8 03 d2 ff ff       	call   801631 <sys_page_alloc>
+  80442e:	83 c4 10             	add    $0x10,%esp
+  804431:	85 c0                	test   %eax,%eax
+  804433:	78 07                	js     80443c <mmap_fault+0x137>
+      return 1;
+  804435:	b8 01 00 00 00       	mov    $0x1,%eax
+  80443a:	eb 17                	jmp    804453 <mmap_fault+0x14e>
+        panic("mmap: %e", r);
+  80443c:	50                   	push   %eax
+  80443d:	68 7f 54 80 00       	push   $0x80547f
+  804442:	6a 64                	push   $0x64
+  804444:	68 88 54 80 00       	push   $0x805488
+  804449:	e8 fb c5 ff ff       	call   800a49 <_panic>
+    return 0;
+  80444e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804453:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804456:	5b                   	pop    %ebx
+  804457:	5e                   	pop    %esi
+  804458:	5f                   	pop    %edi
+  804459:	5d                   	pop    %ebp
+  80445a:	c3                   	ret
+    return 0;
+  80445b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804460:	eb f1                	jmp    804453 <mmap_fault+0x14e>
+    return 0;
+  804462:	b8 00 00 00 00       	mov    $0x0,%eax
+  804467:	eb ea                	jmp    804453 <mmap_fault+0x14e>
+
+00804469 <mmap_pgfault>:
+{
+  804469:	55                   	push   %ebp
+  80446a:	89 e5                	mov    %esp,%ebp
+  80446c:	53                   	push   %ebx
+  80446d:	83 ec 10             	sub    $0x10,%esp
+  804470:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (!mmap_fault(utf))
+  804473:	53                   	push   %ebx
+  804474:	e8 8c fe ff ff       	call   804305 <mmap_fault>
+  804479:	83 c4 10             	add    $0x10,%esp
+  80447c:	84 c0                	test   %al,%al
+  80447e:	74 05                	je     804485 <mmap_pgfault+0x1c>
+}
+  804480:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  804483:	c9                   	leave
+  804484:	c3                   	ret
+    panic("page fault at %08x, eip %08x, err %04x", utf->utf_fault_va,
+  804485:	83 ec 08             	sub    $0x8,%esp
+  804488:	ff 73 04             	push   0x4(%ebx)
+  80448b:	ff 73 28             	push   0x28(%ebx)
+  80448e:	ff 33                	push   (%ebx)
+  804490:	68 a8 54 80 00       	push   $0x8054a8
+  804495:	6a 20                	push   $0x20
+  804497:	68 88 54 80 00       	push   $0x805488
+  80449c:	e8 a8 c5 ff ff       	call   800a49 <_panic>
+
+008044a1 <mmap>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_INVAL if offset isn't aligned, len is 0, or perm is unknown
+//	-E_NO_MEM if there's no free slot or address space for it
+int
+mmap(int fdnum, off_t offset, size_t len, int perm, void **addr)
+{
+  8044a1:	55                   	push   %ebp
+  8044a2:	89 e5                	mov    %esp,%ebp
+  8044a4:	57                   	push   %edi
+  8044a5:	56                   	push   %esi
+  8044a6:	53                   	push   %ebx
+  8044a7:	83 ec 44             	sub    $0x44,%esp
+  8044aa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  struct Fd *fd;
+  uintptr_t va;
+  int i, j, r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8044ad:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8044b0:	50                   	push   %eax
+  8044b1:	ff 75 08             	push   0x8(%ebp)
+  8044b4:	e8 24 dc ff ff       	call   8020dd <fd_lookup>
+  8044b9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8044bc:	83 c4 10             	add    $0x10,%esp
+  8044bf:	85 c0                	test   %eax,%eax
+  8044c1:	0f 88 3e 01 00 00    	js     804605 <mmap+0x164>
+    return r;
+  if (offset < 0 || PGOFF(offset) || len == 0 ||
+  8044c7:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8044cb:	0f 88 d1 00 00 00    	js     8045a2 <mmap+0x101>
+  8044d1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8044d4:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8044d9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8044dc:	0f 85 c9 00 00 00    	jne    8045ab <mmap+0x10a>
+  8044e2:	85 db                	test   %ebx,%ebx
+  8044e4:	0f 84 ca 00 00 00    	je     8045b4 <mmap+0x113>
+  8044ea:	83 7d 14 02          	cmpl   $0x2,0x14(%ebp)
+  8044ee:	0f 87 c0 00 00 00    	ja     8045b4 <mmap+0x113>
+      (perm != MAP_RDONLY && perm != MAP_PRIVATE && perm != MAP_SHARED))
+    return -E_INVAL;
+  len = ROUNDUP(len, PGSIZE);
+  8044f4:	81 c3 ff 0f 00 00    	add    $0xfff,%ebx
+  8044fa:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  804500:	89 d9                	mov    %ebx,%ecx
+  804502:	89 5d c4             	mov    %ebx,-0x3c(%ebp)
+
+  // First fit: try the start of the region and the end of each
+  // mapping.
+  for (i = -1; i < NMMAP; i++) {
+  804505:	bb 8c 82 80 00       	mov    $0x80828c,%ebx
+  80450a:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+    if (i >= 0 && !mmaps[i].mm_va)
+      continue;
+    va = i < 0 ? MMAPBASE : mmaps[i].mm_va + mmaps[i].mm_len;
+  80450f:	bf 00 00 00 a0       	mov    $0xa0000000,%edi
+  804514:	eb 53                	jmp    804569 <mmap+0xc8>
+  804516:	bf 00 00 00 a0       	mov    $0xa0000000,%edi
+  80451b:	eb 4c                	jmp    804569 <mmap+0xc8>
+    if (len > MMAPTOP - va)
+      continue;
+    for (j = 0; j < NMMAP; j++)
+  80451d:	83 c0 01             	add    $0x1,%eax
+  804520:	83 f8 10             	cmp    $0x10,%eax
+  804523:	0f 84 e7 00 00 00    	je     804610 <mmap+0x16f>
+      if (mmaps[j].mm_va && va < mmaps[j].mm_va + mmaps[j].mm_len &&
+  804529:	8d 34 80             	lea    (%eax,%eax,4),%esi
+  80452c:	8b 14 b5 a0 82 80 00 	mov    0x8082a0(,%esi,4),%edx
+  804533:	85 d2                	test   %edx,%edx
+  804535:	74 e6                	je     80451d <mmap+0x7c>
+  804537:	89 d1                	mov    %edx,%ecx
+  804539:	03 0c b5 a4 82 80 00 	add    0x8082a4(,%esi,4),%ecx
+  804540:	39 cf                	cmp    %ecx,%edi
+  804542:	73 d9                	jae    80451d <mmap+0x7c>
+  804544:	39 da                	cmp    %ebx,%edx
+  804546:	73 d5                	jae    80451d <mmap+0x7c>
+  804548:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80454b:	8b 55 cc             	mov    -0x34(%ebp),%edx
+  80454e:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  for (i = -1; i < NMMAP; i++) {
+  804551:	83 c2 01             	add    $0x1,%edx
+  804554:	83 c3 14             	add    $0x14,%ebx
+  804557:	83 fa 10             	cmp    $0x10,%edx
+  80455a:	74 2b                	je     804587 <mmap+0xe6>
+    if (i >= 0 && !mmaps[i].mm_va)
+  80455c:	85 d2                	test   %edx,%edx
+  80455e:	78 b6                	js     804516 <mmap+0x75>
+  804560:	8b 3b                	mov    (%ebx),%edi
+  804562:	85 ff                	test   %edi,%edi
+  804564:	74 eb                	je     804551 <mmap+0xb0>
+    va = i < 0 ? MMAPBASE : mmaps[i].mm_va + mmaps[i].mm_len;
+  804566:	03 7b 04             	add    0x4(%ebx),%edi
+    if (len > MMAPTOP - va)
+  804569:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80456e:	29 f8                	sub    %edi,%eax
+  804570:	39 c8                	cmp    %ecx,%eax
+  804572:	72 dd                	jb     804551 <mmap+0xb0>
+    for (j = 0; j < NMMAP; j++)
+  804574:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+          mmaps[j].mm_va < va + len)
+  804577:	8d 34 0f             	lea    (%edi,%ecx,1),%esi
+  80457a:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  80457d:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  804580:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+  804583:	89 f3                	mov    %esi,%ebx
+  804585:	eb a2                	jmp    804529 <mmap+0x88>
+        break;
+    if (j == NMMAP)
+      break;
+  }
+  if (i == NMMAP)
+    return -E_NO_MEM;
+  804587:	c7 45 d4 fc ff ff ff 	movl   $0xfffffffc,-0x2c(%ebp)
+  80458e:	eb 75                	jmp    804605 <mmap+0x164>
+    ;
+  if (j == NMMAP)
+    return -E_NO_MEM;
+
+  if (_pgfault_handler == 0)
+    set_pgfault_handler(mmap_pgfault);
+  804590:	83 ec 0c             	sub    $0xc,%esp
+  804593:	68 69 44 80 00       	push   $0x804469
+  804598:	e8 83 02 00 00       	call   804820 <set_pgfault_handler>
+  80459d:	83 c4 10             	add    $0x10,%esp
+  8045a0:	eb 24                	jmp    8045c6 <mmap+0x125>
+    return -E_INVAL;
+  8045a2:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  8045a9:	eb 5a                	jmp    804605 <mmap+0x164>
+  8045ab:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  8045b2:	eb 51                	jmp    804605 <mmap+0x164>
+  8045b4:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  8045bb:	eb 48                	jmp    804605 <mmap+0x164>
+  if (_pgfault_handler == 0)
+  8045bd:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  8045c4:	74 ca                	je     804590 <mmap+0xef>
+
+  mmaps[j].mm_va = va;
+  8045c6:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  8045cd:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  8045d0:	c1 e2 02             	shl    $0x2,%edx
+  8045d3:	89 ba a0 82 80 00    	mov    %edi,0x8082a0(%edx)
+  mmaps[j].mm_len = len;
+  8045d9:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  8045dc:	89 b2 a4 82 80 00    	mov    %esi,0x8082a4(%edx)
+  mmaps[j].mm_fd = fdnum;
+  8045e2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8045e5:	89 b2 a8 82 80 00    	mov    %esi,0x8082a8(%edx)
+  mmaps[j].mm_offset = offset;
+  8045eb:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8045ee:	89 b2 ac 82 80 00    	mov    %esi,0x8082ac(%edx)
+  mmaps[j].mm_perm = perm;
+  8045f4:	01 d8                	add    %ebx,%eax
+  8045f6:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  8045f9:	89 1c 85 b0 82 80 00 	mov    %ebx,0x8082b0(,%eax,4)
+  *addr = (void *) va;
+  804600:	8b 45 18             	mov    0x18(%ebp),%eax
+  804603:	89 38                	mov    %edi,(%eax)
+  return 0;
+}
+  804605:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  804608:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80460b:	5b                   	pop    %ebx
+  80460c:	5e                   	pop    %esi
+  80460d:	5f                   	pop    %edi
+  80460e:	5d                   	pop    %ebp
+  80460f:	c3                   	ret
+  if (i == NMMAP)
+  804610:	b8 a0 82 80 00       	mov    $0x8082a0,%eax
+  for (j = 0; j < NMMAP && mmaps[j].mm_va; j++)
+  804615:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+  804618:	83 c0 14             	add    $0x14,%eax
+  80461b:	83 78 ec 00          	cmpl   $0x0,-0x14(%eax)
+  80461f:	74 9c                	je     8045bd <mmap+0x11c>
+  804621:	83 c3 01             	add    $0x1,%ebx
+  804624:	83 fb 10             	cmp    $0x10,%ebx
+  804627:	75 ef                	jne    804618 <mmap+0x177>
+    return -E_NO_MEM;
+  804629:	c7 45 d4 fc ff ff ff 	movl   $0xfffffffc,-0x2c(%ebp)
+  804630:	eb d3                	jmp    804605 <mmap+0x164>
+
+00804632 <msync>:
+// nothing for other kinds of mapping.
+//
+// Returns 0 on success, < 0 on error.
+int
+msync(void *addr)
+{
+  804632:	55                   	push   %ebp
+  804633:	89 e5                	mov    %esp,%ebp
+  804635:	57                   	push   %edi
+  804636:	56                   	push   %esi
+  804637:	53                   	push   %ebx
+  804638:	81 ec ac 00 00 00    	sub    $0xac,%esp
+  struct Stat st;
+  off_t saved, off;
+  uintptr_t va;
+  int n, r;
+
+  if ((m = mmap_find((uintptr_t) addr)) == NULL)
+  80463e:	8b 45 08             	mov    0x8(%ebp),%eax
+  804641:	e8 c6 fb ff ff       	call   80420c <mmap_find>
+  804646:	85 c0                	test   %eax,%eax
+  804648:	0f 84 58 01 00 00    	je     8047a6 <msync+0x174>
+  80464e:	89 c7                	mov    %eax,%edi
+    return -E_INVAL;
+  if (m->mm_perm != MAP_SHARED)
+    return 0;
+  804650:	bb 00 00 00 00       	mov    $0x0,%ebx
+  if (m->mm_perm != MAP_SHARED)
+  804655:	83 78 10 02          	cmpl   $0x2,0x10(%eax)
+  804659:	74 0a                	je     804665 <msync+0x33>
+                          PTE_P | PTE_U | PTE_W)) < 0)
+      break;
+  }
+  fd->fd_offset = saved;
+  return r < 0 ? r : 0;
+}
+  80465b:	89 d8                	mov    %ebx,%eax
+  80465d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  804660:	5b                   	pop    %ebx
+  804661:	5e                   	pop    %esi
+  804662:	5f                   	pop    %edi
+  804663:	5d                   	pop    %ebp
+  804664:	c3                   	ret
+  if ((r = fd_lookup(m->mm_fd, &fd)) < 0 || (r = fstat(m->mm_fd, &st)) < 0)
+  804665:	83 ec 08             	sub    $0x8,%esp
+  804668:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80466b:	50                   	push   %eax
+  80466c:	ff 77 08             	push   0x8(%edi)
+  80466f:	e8 69 da ff ff       	call   8020dd <fd_lookup>
+  804674:	89 c3                	mov    %eax,%ebx
+  804676:	83 c4 10             	add    $0x10,%esp
+  804679:	85 c0                	test   %eax,%eax
+  80467b:	78 de                	js     80465b <msync+0x29>
+  80467d:	83 ec 08             	sub    $0x8,%esp
+  804680:	8d 85 58 ff ff ff    	lea    -0xa8(%ebp),%eax
+  804686:	50                   	push   %eax
+  804687:	ff 77 08             	push   0x8(%edi)
+  80468a:	e8 f1 de ff ff       	call   802580 <fstat>
+  80468f:	89 c3                	mov    %eax,%ebx
+  804691:	83 c4 10             	add    $0x10,%esp
+  804694:	85 c0                	test   %eax,%eax
+  804696:	78 c3                	js     80465b <msync+0x29>
+  saved = fd->fd_offset;
+  804698:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80469b:	8b 40 04             	mov    0x4(%eax),%eax
+  80469e:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%ebp)
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE) {
+  8046a4:	8b 37                	mov    (%edi),%esi
+  8046a6:	eb 29                	jmp    8046d1 <msync+0x9f>
+    if ((r = sys_page_map(0, (void *) va, 0, (void *) va,
+  8046a8:	83 ec 0c             	sub    $0xc,%esp
+  8046ab:	6a 07                	push   $0x7
+  8046ad:	8b 85 50 ff ff ff    	mov    -0xb0(%ebp),%eax
+  8046b3:	50                   	push   %eax
+  8046b4:	6a 00                	push   $0x0
+  8046b6:	50                   	push   %eax
+  8046b7:	6a 00                	push   $0x0
+  8046b9:	e8 b6 cf ff ff       	call   801674 <sys_page_map>
+  8046be:	89 c3                	mov    %eax,%ebx
+  8046c0:	83 c4 20             	add    $0x20,%esp
+  8046c3:	85 c0                	test   %eax,%eax
+  8046c5:	0f 88 c0 00 00 00    	js     80478b <msync+0x159>
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE) {
+  8046cb:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8046d1:	8b 07                	mov    (%edi),%eax
+  8046d3:	89 85 54 ff ff ff    	mov    %eax,-0xac(%ebp)
+  8046d9:	03 47 04             	add    0x4(%edi),%eax
+  8046dc:	39 c6                	cmp    %eax,%esi
+  8046de:	0f 83 a7 00 00 00    	jae    80478b <msync+0x159>
+    if (!va_mapped(va) || !(uvpt[PGNUM(va)] & PTE_D))
+  8046e4:	89 f0                	mov    %esi,%eax
+  8046e6:	e8 63 fb ff ff       	call   80424e <va_mapped>
+  8046eb:	84 c0                	test   %al,%al
+  8046ed:	74 dc                	je     8046cb <msync+0x99>
+  8046ef:	89 f0                	mov    %esi,%eax
+  8046f1:	c1 e8 0c             	shr    $0xc,%eax
+  8046f4:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8046fb:	a8 40                	test   $0x40,%al
+  8046fd:	74 cc                	je     8046cb <msync+0x99>
+    off = m->mm_offset + (va - m->mm_va);
+  8046ff:	8b 47 0c             	mov    0xc(%edi),%eax
+  804702:	8b 8d 54 ff ff ff    	mov    -0xac(%ebp),%ecx
+  804708:	29 c8                	sub    %ecx,%eax
+  80470a:	01 f0                	add    %esi,%eax
+    if (off >= st.st_size)
+  80470c:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80470f:	39 c2                	cmp    %eax,%edx
+  804711:	7e 78                	jle    80478b <msync+0x159>
+    n = MIN(PGSIZE, st.st_size - off);
+  804713:	29 c2                	sub    %eax,%edx
+  804715:	89 d1                	mov    %edx,%ecx
+  804717:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80471c:	39 d1                	cmp    %edx,%ecx
+  80471e:	0f 4e d1             	cmovle %ecx,%edx
+  804721:	89 95 54 ff ff ff    	mov    %edx,-0xac(%ebp)
+    if ((r = seek(m->mm_fd, off)) < 0 ||
+  804727:	83 ec 08             	sub    $0x8,%esp
+  80472a:	50                   	push   %eax
+  80472b:	ff 77 08             	push   0x8(%edi)
+  80472e:	e8 a5 dd ff ff       	call   8024d8 <seek>
+  804733:	89 c3                	mov    %eax,%ebx
+  804735:	83 c4 10             	add    $0x10,%esp
+  804738:	85 c0                	test   %eax,%eax
+  80473a:	78 4f                	js     80478b <msync+0x159>
+        (r = write(m->mm_fd, (void *) va, n)) < 0)
+  80473c:	89 b5 50 ff ff ff    	mov    %esi,-0xb0(%ebp)
+  804742:	83 ec 04             	sub    $0x4,%esp
+  804745:	ff b5 54 ff ff ff    	push   -0xac(%ebp)
+  80474b:	56                   	push   %esi
+  80474c:	ff 77 08             	push   0x8(%edi)
+  80474f:	e8 02 dd ff ff       	call   802456 <write>
+  804754:	89 c3                	mov    %eax,%ebx
+    if ((r = seek(m->mm_fd, off)) < 0 ||
+  804756:	83 c4 10             	add    $0x10,%esp
+  804759:	85 c0                	test   %eax,%eax
+  80475b:	78 2e                	js     80478b <msync+0x159>
+    if (r < n && (r = write(m->mm_fd, (char *) va + r, n - r)) < 0)
+  80475d:	8b 95 54 ff ff ff    	mov    -0xac(%ebp),%edx
+  804763:	39 c2                	cmp    %eax,%edx
+  804765:	0f 8e 3d ff ff ff    	jle    8046a8 <msync+0x76>
+  80476b:	89 d0                	mov    %edx,%eax
+  80476d:	29 d8                	sub    %ebx,%eax
+  80476f:	01 f3                	add    %esi,%ebx
+  804771:	83 ec 04             	sub    $0x4,%esp
+  804774:	50                   	push   %eax
+  804775:	53                   	push   %ebx
+  804776:	ff 77 08             	push   0x8(%edi)
+  804779:	e8 d8 dc ff ff       	call   802456 <write>
+  80477e:	89 c3                	mov    %eax,%ebx
+  804780:	83 c4 10             	add    $0x10,%esp
+  804783:	85 c0                	test   %eax,%eax
+  804785:	0f 89 1d ff ff ff    	jns    8046a8 <msync+0x76>
+  fd->fd_offset = saved;
+  80478b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80478e:	8b 8d 4c ff ff ff    	mov    -0xb4(%ebp),%ecx
+  804794:	89 48 04             	mov    %ecx,0x4(%eax)
+  return r < 0 ? r : 0;
+  804797:	85 db                	test   %ebx,%ebx
+  804799:	b8 00 00 00 00       	mov    $0x0,%eax
+  80479e:	0f 4f d8             	cmovg  %eax,%ebx
+  8047a1:	e9 b5 fe ff ff       	jmp    80465b <msync+0x29>
+    return -E_INVAL;
+  8047a6:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8047ab:	e9 ab fe ff ff       	jmp    80465b <msync+0x29>
+
+008047b0 <munmap>:
+// Remove the mapping at 'addr', writing a MAP_SHARED one back first.
+//
+// Returns 0 on success, < 0 on error.
+int
+munmap(void *addr)
+{
+  8047b0:	55                   	push   %ebp
+  8047b1:	89 e5                	mov    %esp,%ebp
+  8047b3:	56                   	push   %esi
+  8047b4:	53                   	push   %ebx
+  8047b5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct Mmap *m;
+  uintptr_t va;
+  int r;
+
+  if ((m = mmap_find((uintptr_t) addr)) == NULL)
+  8047b8:	89 d8                	mov    %ebx,%eax
+  8047ba:	e8 4d fa ff ff       	call   80420c <mmap_find>
+  8047bf:	85 c0                	test   %eax,%eax
+  8047c1:	74 56                	je     804819 <munmap+0x69>
+  8047c3:	89 c6                	mov    %eax,%esi
+    return -E_INVAL;
+  if ((r = msync(addr)) < 0)
+  8047c5:	83 ec 0c             	sub    $0xc,%esp
+  8047c8:	53                   	push   %ebx
+  8047c9:	e8 64 fe ff ff       	call   804632 <msync>
+  8047ce:	83 c4 10             	add    $0x10,%esp
+  8047d1:	85 c0                	test   %eax,%eax
+  8047d3:	78 3d                	js     804812 <munmap+0x62>
+    return r;
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE)
+  8047d5:	8b 1e                	mov    (%esi),%ebx
+  8047d7:	eb 06                	jmp    8047df <munmap+0x2f>
+  8047d9:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8047df:	8b 46 04             	mov    0x4(%esi),%eax
+  8047e2:	03 06                	add    (%esi),%eax
+  8047e4:	39 c3                	cmp    %eax,%ebx
+  8047e6:	73 1f                	jae    804807 <munmap+0x57>
+    if (va_mapped(va) && (r = sys_page_unmap(0, (void *) va)) < 0)
+  8047e8:	89 d8                	mov    %ebx,%eax
+  8047ea:	e8 5f fa ff ff       	call   80424e <va_mapped>
+  8047ef:	84 c0                	test   %al,%al
+  8047f1:	74 e6                	je     8047d9 <munmap+0x29>
+  8047f3:	83 ec 08             	sub    $0x8,%esp
+  8047f6:	53                   	push   %ebx
+  8047f7:	6a 00                	push   $0x0
+  8047f9:	e8 b8 ce ff ff       	call   8016b6 <sys_page_unmap>
+  8047fe:	83 c4 10             	add    $0x10,%esp
+  804801:	85 c0                	test   %eax,%eax
+  804803:	79 d4                	jns    8047d9 <munmap+0x29>
+  804805:	eb 0b                	jmp    804812 <munmap+0x62>
+      return r;
+  m->mm_va = 0;
+  804807:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  return 0;
+  80480d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804812:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  804815:	5b                   	pop    %ebx
+  804816:	5e                   	pop    %esi
+  804817:	5d                   	pop    %ebp
+  804818:	c3                   	ret
+    return -E_INVAL;
+  804819:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80481e:	eb f2                	jmp    804812 <munmap+0x62>
+
+00804820 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  804820:	55                   	push   %ebp
+  804821:	89 e5                	mov    %esp,%ebp
+  804823:	53                   	push   %ebx
+  804824:	83 ec 04             	sub    $0x4,%esp
+  int r;
+
+  if (_pgfault_handler == 0) {
+  804827:	83 3d 00 a0 80 00 00 	cmpl   $0x0,0x80a000
+  80482e:	74 0d                	je     80483d <set_pgfault_handler+0x1d>
+
+    sys_env_set_pgfault_upcall(id, _pgfault_upcall);
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  804830:	8b 45 08             	mov    0x8(%ebp),%eax
+  804833:	a3 00 a0 80 00       	mov    %eax,0x80a000
+}
+  804838:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80483b:	c9                   	leave
+  80483c:	c3                   	ret
+    envid_t id = sys_getenvid();
+  80483d:	e8 6e cd ff ff       	call   8015b0 <sys_getenvid>
+  804842:	89 c3                	mov    %eax,%ebx
+    sys_page_alloc(id, (void *) (UXSTACKTOP - PGSIZE), (PTE_P | PTE_U | PTE_W));
+  804844:	83 ec 04             	sub    $0x4,%esp
+  804847:	6a 07                	push   $0x7
+  804849:	68 00 f0 bf ee       	push   $0xeebff000
+  80484e:	50                   	push   %eax
+  80484f:	e8 dd cd ff ff       	call   801631 <sys_page_alloc>
+    sys_env_set_pgfault_upcall(id, _pgfault_upcall);
+  804854:	83 c4 08             	add    $0x8,%esp
+  804857:	68 67 48 80 00       	push   $0x804867
+  80485c:	53                   	push   %ebx
+  80485d:	e8 44 d0 ff ff       	call   8018a6 <sys_env_set_pgfault_upcall>
+  804862:	83 c4 10             	add    $0x10,%esp
+  804865:	eb c9                	jmp    804830 <set_pgfault_handler+0x10>
+
+00804867 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  804867:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  804868:	a1 00 a0 80 00       	mov    0x80a000,%eax
+	call *%eax
+  80486d:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  80486f:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+  movl 48(%esp), %eax       // move trap time esp to eax
+  804872:	8b 44 24 30          	mov    0x30(%esp),%eax
+  subl $4, %eax             // make room for eip on trap time esp
+  804876:	83 e8 04             	sub    $0x4,%eax
+  movl %eax, 48(%esp)       // move value to esp
+  804879:	89 44 24 30          	mov    %eax,0x30(%esp)
+  movl 40(%esp), %ebx       // move trap time eip to ebx
+  80487d:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+  movl %ebx, 0(%eax)
+  804881:	89 18                	mov    %ebx,(%eax)
+
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+  addl $0x08,%esp
+  804883:	83 c4 08             	add    $0x8,%esp
+  popal
+  804886:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+  addl $4, %esp          // skip tf->eip
+  804887:	83 c4 04             	add    $0x4,%esp
+  popf                 // pop stack value into flags register
+  80488a:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+  popl %esp
+  80488b:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+  ret
+  80488c:	c3                   	ret
+
+0080488d <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  80488d:	55                   	push   %ebp
+  80488e:	89 e5                	mov    %esp,%ebp
+  804890:	57                   	push   %edi
+  804891:	56                   	push   %esi
+  804892:	53                   	push   %ebx
+  804893:	83 ec 14             	sub    $0x14,%esp
+  804896:	8b 7d 08             	mov    0x8(%ebp),%edi
+  804899:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80489c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80489f:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  8048a2:	85 c0                	test   %eax,%eax
+  8048a4:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8048a9:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  8048ac:	ff 33                	push   (%ebx)
+  8048ae:	50                   	push   %eax
+  8048af:	e8 55 d0 ff ff       	call   801909 <sys_ipc_recv>
+  8048b4:	83 c4 10             	add    $0x10,%esp
+  8048b7:	85 c0                	test   %eax,%eax
+  8048b9:	78 39                	js     8048f4 <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  8048bb:	85 ff                	test   %edi,%edi
+  8048bd:	74 0a                	je     8048c9 <ipc_recv_pages+0x3c>
+  8048bf:	a1 e0 83 80 00       	mov    0x8083e0,%eax
+  8048c4:	8b 40 7c             	mov    0x7c(%eax),%eax
+  8048c7:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  8048c9:	85 f6                	test   %esi,%esi
+  8048cb:	74 0d                	je     8048da <ipc_recv_pages+0x4d>
+  8048cd:	a1 e0 83 80 00       	mov    0x8083e0,%eax
+  8048d2:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  8048d8:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  8048da:	a1 e0 83 80 00       	mov    0x8083e0,%eax
+  8048df:	8b 40 74             	mov    0x74(%eax),%eax
+  8048e2:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  8048e4:	a1 e0 83 80 00       	mov    0x8083e0,%eax
+  8048e9:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  8048ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8048ef:	5b                   	pop    %ebx
+  8048f0:	5e                   	pop    %esi
+  8048f1:	5f                   	pop    %edi
+  8048f2:	5d                   	pop    %ebp
+  8048f3:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  8048f4:	85 ff                	test   %edi,%edi
+  8048f6:	74 06                	je     8048fe <ipc_recv_pages+0x71>
+  8048f8:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  8048fe:	85 f6                	test   %esi,%esi
+  804900:	74 06                	je     804908 <ipc_recv_pages+0x7b>
+  804902:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  804908:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  80490e:	eb dc                	jmp    8048ec <ipc_recv_pages+0x5f>
+
+00804910 <ipc_recv>:
+{
+  804910:	55                   	push   %ebp
+  804911:	89 e5                	mov    %esp,%ebp
+  804913:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  804916:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  80491d:	ff 75 10             	push   0x10(%ebp)
+  804920:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  804923:	50                   	push   %eax
+  804924:	ff 75 0c             	push   0xc(%ebp)
+  804927:	ff 75 08             	push   0x8(%ebp)
+  80492a:	e8 5e ff ff ff       	call   80488d <ipc_recv_pages>
+}
+  80492f:	c9                   	leave
+  804930:	c3                   	ret
+
+00804931 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  804931:	55                   	push   %ebp
+  804932:	89 e5                	mov    %esp,%ebp
+  804934:	57                   	push   %edi
+  804935:	56                   	push   %esi
+  804936:	53                   	push   %ebx
+  804937:	83 ec 0c             	sub    $0xc,%esp
+  80493a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80493d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  804940:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  804943:	89 c3                	mov    %eax,%ebx
+  804945:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  80494b:	85 c0                	test   %eax,%eax
+  80494d:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  804952:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  804955:	83 ec 0c             	sub    $0xc,%esp
+  804958:	ff 75 14             	push   0x14(%ebp)
+  80495b:	ff 75 18             	push   0x18(%ebp)
+  80495e:	53                   	push   %ebx
+  80495f:	56                   	push   %esi
+  804960:	57                   	push   %edi
+  804961:	e8 82 cf ff ff       	call   8018e8 <sys_ipc_try_send>
+  804966:	83 c4 20             	add    $0x20,%esp
+  804969:	85 c0                	test   %eax,%eax
+  80496b:	79 1e                	jns    80498b <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  80496d:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  804970:	75 07                	jne    804979 <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  804972:	e8 58 cc ff ff       	call   8015cf <sys_yield>
+  804977:	eb dc                	jmp    804955 <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  804979:	50                   	push   %eax
+  80497a:	68 cf 54 80 00       	push   $0x8054cf
+  80497f:	6a 5c                	push   $0x5c
+  804981:	68 dc 54 80 00       	push   $0x8054dc
+  804986:	e8 be c0 ff ff       	call   800a49 <_panic>
+  }
+}
+  80498b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80498e:	5b                   	pop    %ebx
+  80498f:	5e                   	pop    %esi
+  804990:	5f                   	pop    %edi
+  804991:	5d                   	pop    %ebp
+  804992:	c3                   	ret
+
+00804993 <ipc_send>:
+{
+  804993:	55                   	push   %ebp
+  804994:	89 e5                	mov    %esp,%ebp
+  804996:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  804999:	ff 75 14             	push   0x14(%ebp)
+  80499c:	6a 01                	push   $0x1
+  80499e:	ff 75 10             	push   0x10(%ebp)
+  8049a1:	ff 75 0c             	push   0xc(%ebp)
+  8049a4:	ff 75 08             	push   0x8(%ebp)
+  8049a7:	e8 85 ff ff ff       	call   804931 <ipc_send_pages>
+}
+  8049ac:	83 c4 20             	add    $0x20,%esp
+  8049af:	c9                   	leave
+  8049b0:	c3                   	ret
+
+008049b1 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8049b1:	55                   	push   %ebp
+  8049b2:	89 e5                	mov    %esp,%ebp
+  8049b4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  8049b7:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  8049bc:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8049bf:	c1 e0 04             	shl    $0x4,%eax
+  8049c2:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8049c7:	8b 40 50             	mov    0x50(%eax),%eax
+  8049ca:	39 c8                	cmp    %ecx,%eax
+  8049cc:	74 12                	je     8049e0 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  8049ce:	83 c2 01             	add    $0x1,%edx
+  8049d1:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  8049d7:	75 e3                	jne    8049bc <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  8049d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049de:	eb 0e                	jmp    8049ee <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  8049e0:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8049e3:	c1 e0 04             	shl    $0x4,%eax
+  8049e6:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8049eb:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8049ee:	5d                   	pop    %ebp
+  8049ef:	c3                   	ret
+
+008049f0 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8049f0:	55                   	push   %ebp
+  8049f1:	89 e5                	mov    %esp,%ebp
+  8049f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  8049f6:	89 c2                	mov    %eax,%edx
+  8049f8:	c1 ea 16             	shr    $0x16,%edx
+  8049fb:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  804a02:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  804a07:	f6 c1 01             	test   $0x1,%cl
+  804a0a:	74 1c                	je     804a28 <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  804a0c:	c1 e8 0c             	shr    $0xc,%eax
+  804a0f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  804a16:	a8 01                	test   $0x1,%al
+  804a18:	74 0e                	je     804a28 <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  804a1a:	c1 e8 0c             	shr    $0xc,%eax
+  804a1d:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  804a24:	ef 
+  804a25:	0f b7 d2             	movzwl %dx,%edx
+}
+  804a28:	89 d0                	mov    %edx,%eax
+  804a2a:	5d                   	pop    %ebp
+  804a2b:	c3                   	ret
+
+00804a2c <udivmod>:
+  804a2c:	55                   	push   %ebp
+  804a2d:	57                   	push   %edi
+  804a2e:	56                   	push   %esi
+  804a2f:	53                   	push   %ebx
+  804a30:	83 ec 14             	sub    $0x14,%esp
+  804a33:	8b 74 24 28          	mov    0x28(%esp),%esi
+  804a37:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  804a3b:	89 fb                	mov    %edi,%ebx
+  804a3d:	09 f3                	or     %esi,%ebx
+  804a3f:	0f 84 88 00 00 00    	je     804acd <udivmod+0xa1>
+  804a45:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  804a4a:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  804a51:	00 
+  804a52:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  804a59:	00 
+  804a5a:	89 cd                	mov    %ecx,%ebp
+  804a5c:	89 34 24             	mov    %esi,(%esp)
+  804a5f:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  804a63:	eb 08                	jmp    804a6d <udivmod+0x41>
+  804a65:	83 ed 01             	sub    $0x1,%ebp
+  804a68:	83 fd ff             	cmp    $0xffffffff,%ebp
+  804a6b:	74 6c                	je     804ad9 <udivmod+0xad>
+  804a6d:	89 c3                	mov    %eax,%ebx
+  804a6f:	89 d6                	mov    %edx,%esi
+  804a71:	89 e9                	mov    %ebp,%ecx
+  804a73:	0f ad f3             	shrd   %cl,%esi,%ebx
+  804a76:	d3 ee                	shr    %cl,%esi
+  804a78:	f6 c1 20             	test   $0x20,%cl
+  804a7b:	74 04                	je     804a81 <udivmod+0x55>
+  804a7d:	89 f3                	mov    %esi,%ebx
+  804a7f:	31 f6                	xor    %esi,%esi
+  804a81:	8b 3c 24             	mov    (%esp),%edi
+  804a84:	39 fb                	cmp    %edi,%ebx
+  804a86:	89 f7                	mov    %esi,%edi
+  804a88:	8b 1c 24             	mov    (%esp),%ebx
+  804a8b:	8b 74 24 04          	mov    0x4(%esp),%esi
+  804a8f:	19 f7                	sbb    %esi,%edi
+  804a91:	72 d2                	jb     804a65 <udivmod+0x39>
+  804a93:	89 f7                	mov    %esi,%edi
+  804a95:	89 de                	mov    %ebx,%esi
+  804a97:	89 e9                	mov    %ebp,%ecx
+  804a99:	0f a5 f7             	shld   %cl,%esi,%edi
+  804a9c:	d3 e6                	shl    %cl,%esi
+  804a9e:	f6 c1 20             	test   $0x20,%cl
+  804aa1:	74 04                	je     804aa7 <udivmod+0x7b>
+  804aa3:	89 f7                	mov    %esi,%edi
+  804aa5:	31 f6                	xor    %esi,%esi
+  804aa7:	29 f0                	sub    %esi,%eax
+  804aa9:	19 fa                	sbb    %edi,%edx
+  804aab:	be 01 00 00 00       	mov    $0x1,%esi
+  804ab0:	bf 00 00 00 00       	mov    $0x0,%edi
+  804ab5:	0f a5 f7             	shld   %cl,%esi,%edi
+  804ab8:	d3 e6                	shl    %cl,%esi
+  804aba:	f6 c1 20             	test   $0x20,%cl
+  804abd:	74 04                	je     804ac3 <udivmod+0x97>
+  804abf:	89 f7                	mov    %esi,%edi
+  804ac1:	31 f6                	xor    %esi,%esi
+  804ac3:	09 74 24 08          	or     %esi,0x8(%esp)
+  804ac7:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  804acb:	eb 98                	jmp    804a65 <udivmod+0x39>
+  804acd:	89 f0                	mov    %esi,%eax
+  804acf:	89 fa                	mov    %edi,%edx
+  804ad1:	89 74 24 08          	mov    %esi,0x8(%esp)
+  804ad5:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  804ad9:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  804add:	89 01                	mov    %eax,(%ecx)
+  804adf:	89 51 04             	mov    %edx,0x4(%ecx)
+  804ae2:	8b 44 24 08          	mov    0x8(%esp),%eax
+  804ae6:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  804aea:	83 c4 14             	add    $0x14,%esp
+  804aed:	5b                   	pop    %ebx
+  804aee:	5e                   	pop    %esi
+  804aef:	5f                   	pop    %edi
+  804af0:	5d                   	pop    %ebp
+  804af1:	c3                   	ret
+
+00804af2 <__udivdi3>:
+  804af2:	83 ec 18             	sub    $0x18,%esp
+  804af5:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804af9:	50                   	push   %eax
+  804afa:	ff 74 24 2c          	push   0x2c(%esp)
+  804afe:	ff 74 24 2c          	push   0x2c(%esp)
+  804b02:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804b06:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804b0a:	e8 1d ff ff ff       	call   804a2c <udivmod>
+  804b0f:	83 c4 24             	add    $0x24,%esp
+  804b12:	c3                   	ret
+
+00804b13 <__umoddi3>:
+  804b13:	83 ec 18             	sub    $0x18,%esp
+  804b16:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  804b1a:	50                   	push   %eax
+  804b1b:	ff 74 24 2c          	push   0x2c(%esp)
+  804b1f:	ff 74 24 2c          	push   0x2c(%esp)
+  804b23:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804b27:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804b2b:	e8 fc fe ff ff       	call   804a2c <udivmod>
+  804b30:	8b 44 24 18          	mov    0x18(%esp),%eax
+  804b34:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  804b38:	83 c4 24             	add    $0x24,%esp
+  804b3b:	c3                   	ret
+
+00804b3c <__divdi3>:
+  804b3c:	56                   	push   %esi
+  804b3d:	53                   	push   %ebx
+  804b3e:	83 ec 14             	sub    $0x14,%esp
+  804b41:	8b 44 24 20          	mov    0x20(%esp),%eax
+  804b45:	8b 54 24 24          	mov    0x24(%esp),%edx
+  804b49:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  804b4d:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  804b51:	85 d2                	test   %edx,%edx
+  804b53:	78 18                	js     804b6d <__divdi3+0x31>
+  804b55:	85 db                	test   %ebx,%ebx
+  804b57:	78 3e                	js     804b97 <__divdi3+0x5b>
+  804b59:	83 ec 04             	sub    $0x4,%esp
+  804b5c:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804b60:	56                   	push   %esi
+  804b61:	53                   	push   %ebx
+  804b62:	51                   	push   %ecx
+  804b63:	e8 c4 fe ff ff       	call   804a2c <udivmod>
+  804b68:	83 c4 10             	add    $0x10,%esp
+  804b6b:	eb 24                	jmp    804b91 <__divdi3+0x55>
+  804b6d:	f7 d8                	neg    %eax
+  804b6f:	83 d2 00             	adc    $0x0,%edx
+  804b72:	f7 da                	neg    %edx
+  804b74:	85 db                	test   %ebx,%ebx
+  804b76:	78 3a                	js     804bb2 <__divdi3+0x76>
+  804b78:	83 ec 04             	sub    $0x4,%esp
+  804b7b:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804b7f:	56                   	push   %esi
+  804b80:	53                   	push   %ebx
+  804b81:	51                   	push   %ecx
+  804b82:	e8 a5 fe ff ff       	call   804a2c <udivmod>
+  804b87:	83 c4 10             	add    $0x10,%esp
+  804b8a:	f7 d8                	neg    %eax
+  804b8c:	83 d2 00             	adc    $0x0,%edx
+  804b8f:	f7 da                	neg    %edx
+  804b91:	83 c4 14             	add    $0x14,%esp
+  804b94:	5b                   	pop    %ebx
+  804b95:	5e                   	pop    %esi
+  804b96:	c3                   	ret
+  804b97:	83 ec 04             	sub    $0x4,%esp
+  804b9a:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804b9e:	56                   	push   %esi
+  804b9f:	f7 d9                	neg    %ecx
+  804ba1:	83 d3 00             	adc    $0x0,%ebx
+  804ba4:	f7 db                	neg    %ebx
+  804ba6:	53                   	push   %ebx
+  804ba7:	51                   	push   %ecx
+  804ba8:	e8 7f fe ff ff       	call   804a2c <udivmod>
+  804bad:	83 c4 10             	add    $0x10,%esp
+  804bb0:	eb d8                	jmp    804b8a <__divdi3+0x4e>
+  804bb2:	83 ec 04             	sub    $0x4,%esp
+  804bb5:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  804bb9:	56                   	push   %esi
+  804bba:	f7 d9                	neg    %ecx
+  804bbc:	83 d3 00             	adc    $0x0,%ebx
+  804bbf:	f7 db                	neg    %ebx
+  804bc1:	53                   	push   %ebx
+  804bc2:	51                   	push   %ecx
+  804bc3:	e8 64 fe ff ff       	call   804a2c <udivmod>
+  804bc8:	83 c4 10             	add    $0x10,%esp
+  804bcb:	eb c4                	jmp    804b91 <__divdi3+0x55>
+
+00804bcd <__moddi3>:
+  804bcd:	55                   	push   %ebp
+  804bce:	57                   	push   %edi
+  804bcf:	56                   	push   %esi
+  804bd0:	53                   	push   %ebx
+  804bd1:	83 ec 24             	sub    $0x24,%esp
+  804bd4:	8b 44 24 38          	mov    0x38(%esp),%eax
+  804bd8:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  804bdc:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  804be0:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  804be4:	85 d2                	test   %edx,%edx
+  804be6:	78 3b                	js     804c23 <__moddi3+0x56>
+  804be8:	83 ec 04             	sub    $0x4,%esp
+  804beb:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804bef:	56                   	push   %esi
+  804bf0:	89 ce                	mov    %ecx,%esi
+  804bf2:	f7 de                	neg    %esi
+  804bf4:	89 74 24 08          	mov    %esi,0x8(%esp)
+  804bf8:	89 de                	mov    %ebx,%esi
+  804bfa:	83 d6 00             	adc    $0x0,%esi
+  804bfd:	f7 de                	neg    %esi
+  804bff:	89 74 24 14          	mov    %esi,0x14(%esp)
+  804c03:	8b 74 24 08          	mov    0x8(%esp),%esi
+  804c07:	0f 48 f1             	cmovs  %ecx,%esi
+  804c0a:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  804c0f:	53                   	push   %ebx
+  804c10:	56                   	push   %esi
+  804c11:	e8 16 fe ff ff       	call   804a2c <udivmod>
+  804c16:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804c1a:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804c1e:	83 c4 10             	add    $0x10,%esp
+  804c21:	eb 47                	jmp    804c6a <__moddi3+0x9d>
+  804c23:	f7 d8                	neg    %eax
+  804c25:	83 d2 00             	adc    $0x0,%edx
+  804c28:	f7 da                	neg    %edx
+  804c2a:	83 ec 04             	sub    $0x4,%esp
+  804c2d:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  804c31:	56                   	push   %esi
+  804c32:	89 cf                	mov    %ecx,%edi
+  804c34:	f7 df                	neg    %edi
+  804c36:	89 de                	mov    %ebx,%esi
+  804c38:	83 d6 00             	adc    $0x0,%esi
+  804c3b:	f7 de                	neg    %esi
+  804c3d:	0f 49 cf             	cmovns %edi,%ecx
+  804c40:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  804c44:	0f 49 de             	cmovns %esi,%ebx
+  804c47:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  804c4b:	ff 74 24 0c          	push   0xc(%esp)
+  804c4f:	ff 74 24 0c          	push   0xc(%esp)
+  804c53:	e8 d4 fd ff ff       	call   804a2c <udivmod>
+  804c58:	8b 44 24 28          	mov    0x28(%esp),%eax
+  804c5c:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  804c60:	f7 d8                	neg    %eax
+  804c62:	83 d2 00             	adc    $0x0,%edx
+  804c65:	f7 da                	neg    %edx
+  804c67:	83 c4 10             	add    $0x10,%esp
+  804c6a:	83 c4 24             	add    $0x24,%esp
+  804c6d:	5b                   	pop    %ebx
+  804c6e:	5e                   	pop    %esi
+  804c6f:	5f                   	pop    %edi
+  804c70:	5d                   	pop    %ebp
+  804c71:	c3                   	ret
@@ -0,0 +1,6355 @@
+
+obj/user/softint.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 05 00 00 00       	call   800036 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  asm volatile ("int $14");             // page fault
+  800033:	cd 0e                	int    $0xe
+}
+  800035:	c3                   	ret
+
+00800036 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800036:	55                   	push   %ebp
+  800037:	89 e5                	mov    %esp,%ebp
+  800039:	56                   	push   %esi
+  80003a:	53                   	push   %ebx
+  80003b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80003e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  800041:	c7 05 44 57 80 00 00 	movl   $0x0,0x805744
+  800048:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  80004b:	e8 d1 00 00 00       	call   800121 <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  800050:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800055:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800058:	c1 e0 04             	shl    $0x4,%eax
+  80005b:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800060:	a3 44 57 80 00       	mov    %eax,0x805744
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800065:	85 db                	test   %ebx,%ebx
+  800067:	7e 07                	jle    800070 <libmain+0x3a>
+    binaryname = argv[0];
+  800069:	8b 06                	mov    (%esi),%eax
+  80006b:	a3 00 40 80 00       	mov    %eax,0x804000
+
+  // call user main routine
+  umain(argc, argv);
+  800070:	83 ec 08             	sub    $0x8,%esp
+  800073:	56                   	push   %esi
+  800074:	53                   	push   %ebx
+  800075:	e8 b9 ff ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  80007a:	e8 0a 00 00 00       	call   800089 <exit>
+}
+  80007f:	83 c4 10             	add    $0x10,%esp
+  800082:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800085:	5b                   	pop    %ebx
+  800086:	5e                   	pop    %esi
+  800087:	5d                   	pop    %ebp
+  800088:	c3                   	ret
+
+00800089 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800089:	55                   	push   %ebp
+  80008a:	89 e5                	mov    %esp,%ebp
+  80008c:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  80008f:	e8 87 07 00 00       	call   80081b <close_all>
+  sys_env_destroy(0);
+  800094:	83 ec 0c             	sub    $0xc,%esp
+  800097:	6a 00                	push   $0x0
+  800099:	e8 42 00 00 00       	call   8000e0 <sys_env_destroy>
+}
+  80009e:	83 c4 10             	add    $0x10,%esp
+  8000a1:	c9                   	leave
+  8000a2:	c3                   	ret
+
+008000a3 <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8000a3:	55                   	push   %ebp
+  8000a4:	89 e5                	mov    %esp,%ebp
+  8000a6:	57                   	push   %edi
+  8000a7:	56                   	push   %esi
+  8000a8:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8000a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ae:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000b1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8000b4:	89 c3                	mov    %eax,%ebx
+  8000b6:	89 c7                	mov    %eax,%edi
+  8000b8:	89 c6                	mov    %eax,%esi
+  8000ba:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  8000bc:	5b                   	pop    %ebx
+  8000bd:	5e                   	pop    %esi
+  8000be:	5f                   	pop    %edi
+  8000bf:	5d                   	pop    %ebp
+  8000c0:	c3                   	ret
+
+008000c1 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  8000c1:	55                   	push   %ebp
+  8000c2:	89 e5                	mov    %esp,%ebp
+  8000c4:	57                   	push   %edi
+  8000c5:	56                   	push   %esi
+  8000c6:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8000c7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000cc:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000d1:	89 d1                	mov    %edx,%ecx
+  8000d3:	89 d3                	mov    %edx,%ebx
+  8000d5:	89 d7                	mov    %edx,%edi
+  8000d7:	89 d6                	mov    %edx,%esi
+  8000d9:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  8000db:	5b                   	pop    %ebx
+  8000dc:	5e                   	pop    %esi
+  8000dd:	5f                   	pop    %edi
+  8000de:	5d                   	pop    %ebp
+  8000df:	c3                   	ret
+
+008000e0 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  8000e0:	55                   	push   %ebp
+  8000e1:	89 e5                	mov    %esp,%ebp
+  8000e3:	57                   	push   %edi
+  8000e4:	56                   	push   %esi
+  8000e5:	53                   	push   %ebx
+  8000e6:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8000e9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8000f1:	b8 03 00 00 00       	mov    $0x3,%eax
+  8000f6:	89 cb                	mov    %ecx,%ebx
+  8000f8:	89 cf                	mov    %ecx,%edi
+  8000fa:	89 ce                	mov    %ecx,%esi
+  8000fc:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8000fe:	85 c0                	test   %eax,%eax
+  800100:	7f 08                	jg     80010a <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800102:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800105:	5b                   	pop    %ebx
+  800106:	5e                   	pop    %esi
+  800107:	5f                   	pop    %edi
+  800108:	5d                   	pop    %ebp
+  800109:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80010a:	83 ec 0c             	sub    $0xc,%esp
+  80010d:	50                   	push   %eax
+  80010e:	6a 03                	push   $0x3
+  800110:	68 4a 2e 80 00       	push   $0x802e4a
+  800115:	6a 23                	push   $0x23
+  800117:	68 67 2e 80 00       	push   $0x802e67
+  80011c:	e8 41 1f 00 00       	call   802062 <_panic>
+
+00800121 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800121:	55                   	push   %ebp
+  800122:	89 e5                	mov    %esp,%ebp
+  800124:	57                   	push   %edi
+  800125:	56                   	push   %esi
+  800126:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800127:	ba 00 00 00 00       	mov    $0x0,%edx
+  80012c:	b8 02 00 00 00       	mov    $0x2,%eax
+  800131:	89 d1                	mov    %edx,%ecx
+  800133:	89 d3                	mov    %edx,%ebx
+  800135:	89 d7                	mov    %edx,%edi
+  800137:	89 d6                	mov    %edx,%esi
+  800139:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  80013b:	5b                   	pop    %ebx
+  80013c:	5e                   	pop    %esi
+  80013d:	5f                   	pop    %edi
+  80013e:	5d                   	pop    %ebp
+  80013f:	c3                   	ret
+
+00800140 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800140:	55                   	push   %ebp
+  800141:	89 e5                	mov    %esp,%ebp
+  800143:	57                   	push   %edi
+  800144:	56                   	push   %esi
+  800145:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800146:	ba 00 00 00 00       	mov    $0x0,%edx
+  80014b:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800150:	89 d1                	mov    %edx,%ecx
+  800152:	89 d3                	mov    %edx,%ebx
+  800154:	89 d7                	mov    %edx,%edi
+  800156:	89 d6                	mov    %edx,%esi
+  800158:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  80015a:	5b                   	pop    %ebx
+  80015b:	5e                   	pop    %esi
+  80015c:	5f                   	pop    %edi
+  80015d:	5d                   	pop    %ebp
+  80015e:	c3                   	ret
+
+0080015f <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  80015f:	55                   	push   %ebp
+  800160:	89 e5                	mov    %esp,%ebp
+  800162:	57                   	push   %edi
+  800163:	56                   	push   %esi
+  800164:	53                   	push   %ebx
+  800165:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  800168:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  80016c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800171:	8b 55 08             	mov    0x8(%ebp),%edx
+  800174:	b8 14 00 00 00       	mov    $0x14,%eax
+  800179:	89 df                	mov    %ebx,%edi
+  80017b:	89 de                	mov    %ebx,%esi
+  80017d:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80017f:	85 c0                	test   %eax,%eax
+  800181:	7f 08                	jg     80018b <sys_env_set_cow+0x2c>
+}
+  800183:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800186:	5b                   	pop    %ebx
+  800187:	5e                   	pop    %esi
+  800188:	5f                   	pop    %edi
+  800189:	5d                   	pop    %ebp
+  80018a:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80018b:	83 ec 0c             	sub    $0xc,%esp
+  80018e:	50                   	push   %eax
+  80018f:	6a 14                	push   $0x14
+  800191:	68 4a 2e 80 00       	push   $0x802e4a
+  800196:	6a 23                	push   $0x23
+  800198:	68 67 2e 80 00       	push   $0x802e67
+  80019d:	e8 c0 1e 00 00       	call   802062 <_panic>
+
+008001a2 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8001a2:	55                   	push   %ebp
+  8001a3:	89 e5                	mov    %esp,%ebp
+  8001a5:	57                   	push   %edi
+  8001a6:	56                   	push   %esi
+  8001a7:	53                   	push   %ebx
+  8001a8:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8001ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8001b0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001b3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001b6:	b8 04 00 00 00       	mov    $0x4,%eax
+  8001bb:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001be:	89 f7                	mov    %esi,%edi
+  8001c0:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8001c2:	85 c0                	test   %eax,%eax
+  8001c4:	7f 08                	jg     8001ce <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  8001c6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8001c9:	5b                   	pop    %ebx
+  8001ca:	5e                   	pop    %esi
+  8001cb:	5f                   	pop    %edi
+  8001cc:	5d                   	pop    %ebp
+  8001cd:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8001ce:	83 ec 0c             	sub    $0xc,%esp
+  8001d1:	50                   	push   %eax
+  8001d2:	6a 04                	push   $0x4
+  8001d4:	68 4a 2e 80 00       	push   $0x802e4a
+  8001d9:	6a 23                	push   $0x23
+  8001db:	68 67 2e 80 00       	push   $0x802e67
+  8001e0:	e8 7d 1e 00 00       	call   802062 <_panic>
+
+008001e5 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  8001e5:	55                   	push   %ebp
+  8001e6:	89 e5                	mov    %esp,%ebp
+  8001e8:	57                   	push   %edi
+  8001e9:	56                   	push   %esi
+  8001ea:	53                   	push   %ebx
+  8001eb:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8001ee:	8b 55 08             	mov    0x8(%ebp),%edx
+  8001f1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8001f4:	b8 05 00 00 00       	mov    $0x5,%eax
+  8001f9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8001fc:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8001ff:	8b 75 18             	mov    0x18(%ebp),%esi
+  800202:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800204:	85 c0                	test   %eax,%eax
+  800206:	7f 08                	jg     800210 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  800208:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80020b:	5b                   	pop    %ebx
+  80020c:	5e                   	pop    %esi
+  80020d:	5f                   	pop    %edi
+  80020e:	5d                   	pop    %ebp
+  80020f:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800210:	83 ec 0c             	sub    $0xc,%esp
+  800213:	50                   	push   %eax
+  800214:	6a 05                	push   $0x5
+  800216:	68 4a 2e 80 00       	push   $0x802e4a
+  80021b:	6a 23                	push   $0x23
+  80021d:	68 67 2e 80 00       	push   $0x802e67
+  800222:	e8 3b 1e 00 00       	call   802062 <_panic>
+
+00800227 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800227:	55                   	push   %ebp
+  800228:	89 e5                	mov    %esp,%ebp
+  80022a:	57                   	push   %edi
+  80022b:	56                   	push   %esi
+  80022c:	53                   	push   %ebx
+  80022d:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800230:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800235:	8b 55 08             	mov    0x8(%ebp),%edx
+  800238:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80023b:	b8 06 00 00 00       	mov    $0x6,%eax
+  800240:	89 df                	mov    %ebx,%edi
+  800242:	89 de                	mov    %ebx,%esi
+  800244:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800246:	85 c0                	test   %eax,%eax
+  800248:	7f 08                	jg     800252 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  80024a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80024d:	5b                   	pop    %ebx
+  80024e:	5e                   	pop    %esi
+  80024f:	5f                   	pop    %edi
+  800250:	5d                   	pop    %ebp
+  800251:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800252:	83 ec 0c             	sub    $0xc,%esp
+  800255:	50                   	push   %eax
+  800256:	6a 06                	push   $0x6
+  800258:	68 4a 2e 80 00       	push   $0x802e4a
+  80025d:	6a 23                	push   $0x23
+  80025f:	68 67 2e 80 00       	push   $0x802e67
+  800264:	e8 f9 1d 00 00       	call   802062 <_panic>
+
+00800269 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  800269:	55                   	push   %ebp
+  80026a:	89 e5                	mov    %esp,%ebp
+  80026c:	57                   	push   %edi
+  80026d:	56                   	push   %esi
+  80026e:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80026f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800272:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800275:	b8 11 00 00 00       	mov    $0x11,%eax
+  80027a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80027d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800280:	8b 75 18             	mov    0x18(%ebp),%esi
+  800283:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  800285:	5b                   	pop    %ebx
+  800286:	5e                   	pop    %esi
+  800287:	5f                   	pop    %edi
+  800288:	5d                   	pop    %ebp
+  800289:	c3                   	ret
+
+0080028a <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  80028a:	55                   	push   %ebp
+  80028b:	89 e5                	mov    %esp,%ebp
+  80028d:	57                   	push   %edi
+  80028e:	56                   	push   %esi
+  80028f:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800290:	8b 55 08             	mov    0x8(%ebp),%edx
+  800293:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800296:	b8 12 00 00 00       	mov    $0x12,%eax
+  80029b:	be 00 00 00 00       	mov    $0x0,%esi
+  8002a0:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8002a3:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8002a6:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  8002a8:	5b                   	pop    %ebx
+  8002a9:	5e                   	pop    %esi
+  8002aa:	5f                   	pop    %edi
+  8002ab:	5d                   	pop    %ebp
+  8002ac:	c3                   	ret
+
+008002ad <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  8002ad:	55                   	push   %ebp
+  8002ae:	89 e5                	mov    %esp,%ebp
+  8002b0:	57                   	push   %edi
+  8002b1:	56                   	push   %esi
+  8002b2:	53                   	push   %ebx
+  8002b3:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8002b6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8002bb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002be:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8002c1:	b8 16 00 00 00       	mov    $0x16,%eax
+  8002c6:	89 df                	mov    %ebx,%edi
+  8002c8:	89 de                	mov    %ebx,%esi
+  8002ca:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8002cc:	85 c0                	test   %eax,%eax
+  8002ce:	7f 08                	jg     8002d8 <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  8002d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002d3:	5b                   	pop    %ebx
+  8002d4:	5e                   	pop    %esi
+  8002d5:	5f                   	pop    %edi
+  8002d6:	5d                   	pop    %ebp
+  8002d7:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8002d8:	83 ec 0c             	sub    $0xc,%esp
+  8002db:	50                   	push   %eax
+  8002dc:	6a 16                	push   $0x16
+  8002de:	68 4a 2e 80 00       	push   $0x802e4a
+  8002e3:	6a 23                	push   $0x23
+  8002e5:	68 67 2e 80 00       	push   $0x802e67
+  8002ea:	e8 73 1d 00 00       	call   802062 <_panic>
+
+008002ef <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  8002ef:	55                   	push   %ebp
+  8002f0:	89 e5                	mov    %esp,%ebp
+  8002f2:	57                   	push   %edi
+  8002f3:	56                   	push   %esi
+  8002f4:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8002f5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8002fa:	8b 55 08             	mov    0x8(%ebp),%edx
+  8002fd:	b8 17 00 00 00       	mov    $0x17,%eax
+  800302:	89 cb                	mov    %ecx,%ebx
+  800304:	89 cf                	mov    %ecx,%edi
+  800306:	89 ce                	mov    %ecx,%esi
+  800308:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  80030a:	5b                   	pop    %ebx
+  80030b:	5e                   	pop    %esi
+  80030c:	5f                   	pop    %edi
+  80030d:	5d                   	pop    %ebp
+  80030e:	c3                   	ret
+
+0080030f <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  80030f:	55                   	push   %ebp
+  800310:	89 e5                	mov    %esp,%ebp
+  800312:	57                   	push   %edi
+  800313:	56                   	push   %esi
+  800314:	53                   	push   %ebx
+  800315:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800318:	be 00 00 00 00       	mov    $0x0,%esi
+  80031d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800320:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800323:	b8 18 00 00 00       	mov    $0x18,%eax
+  800328:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80032b:	89 f7                	mov    %esi,%edi
+  80032d:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80032f:	85 c0                	test   %eax,%eax
+  800331:	7f 08                	jg     80033b <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  800333:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800336:	5b                   	pop    %ebx
+  800337:	5e                   	pop    %esi
+  800338:	5f                   	pop    %edi
+  800339:	5d                   	pop    %ebp
+  80033a:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80033b:	83 ec 0c             	sub    $0xc,%esp
+  80033e:	50                   	push   %eax
+  80033f:	6a 18                	push   $0x18
+  800341:	68 4a 2e 80 00       	push   $0x802e4a
+  800346:	6a 23                	push   $0x23
+  800348:	68 67 2e 80 00       	push   $0x802e67
+  80034d:	e8 10 1d 00 00       	call   802062 <_panic>
+
+00800352 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  800352:	55                   	push   %ebp
+  800353:	89 e5                	mov    %esp,%ebp
+  800355:	57                   	push   %edi
+  800356:	56                   	push   %esi
+  800357:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800358:	be 00 00 00 00       	mov    $0x0,%esi
+  80035d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800360:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800363:	b8 19 00 00 00       	mov    $0x19,%eax
+  800368:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80036b:	89 f7                	mov    %esi,%edi
+  80036d:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  80036f:	5b                   	pop    %ebx
+  800370:	5e                   	pop    %esi
+  800371:	5f                   	pop    %edi
+  800372:	5d                   	pop    %ebp
+  800373:	c3                   	ret
+
+00800374 <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  800374:	55                   	push   %ebp
+  800375:	89 e5                	mov    %esp,%ebp
+  800377:	57                   	push   %edi
+  800378:	56                   	push   %esi
+  800379:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80037a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80037f:	b8 15 00 00 00       	mov    $0x15,%eax
+  800384:	89 d1                	mov    %edx,%ecx
+  800386:	89 d3                	mov    %edx,%ebx
+  800388:	89 d7                	mov    %edx,%edi
+  80038a:	89 d6                	mov    %edx,%esi
+  80038c:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  80038e:	5b                   	pop    %ebx
+  80038f:	5e                   	pop    %esi
+  800390:	5f                   	pop    %edi
+  800391:	5d                   	pop    %ebp
+  800392:	c3                   	ret
+
+00800393 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800393:	55                   	push   %ebp
+  800394:	89 e5                	mov    %esp,%ebp
+  800396:	57                   	push   %edi
+  800397:	56                   	push   %esi
+  800398:	53                   	push   %ebx
+  800399:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80039c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003a1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003a4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003a7:	b8 08 00 00 00       	mov    $0x8,%eax
+  8003ac:	89 df                	mov    %ebx,%edi
+  8003ae:	89 de                	mov    %ebx,%esi
+  8003b0:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8003b2:	85 c0                	test   %eax,%eax
+  8003b4:	7f 08                	jg     8003be <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8003b6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003b9:	5b                   	pop    %ebx
+  8003ba:	5e                   	pop    %esi
+  8003bb:	5f                   	pop    %edi
+  8003bc:	5d                   	pop    %ebp
+  8003bd:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8003be:	83 ec 0c             	sub    $0xc,%esp
+  8003c1:	50                   	push   %eax
+  8003c2:	6a 08                	push   $0x8
+  8003c4:	68 4a 2e 80 00       	push   $0x802e4a
+  8003c9:	6a 23                	push   $0x23
+  8003cb:	68 67 2e 80 00       	push   $0x802e67
+  8003d0:	e8 8d 1c 00 00       	call   802062 <_panic>
+
+008003d5 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8003d5:	55                   	push   %ebp
+  8003d6:	89 e5                	mov    %esp,%ebp
+  8003d8:	57                   	push   %edi
+  8003d9:	56                   	push   %esi
+  8003da:	53                   	push   %ebx
+  8003db:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8003de:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8003e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8003e6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8003e9:	b8 09 00 00 00       	mov    $0x9,%eax
+  8003ee:	89 df                	mov    %ebx,%edi
+  8003f0:	89 de                	mov    %ebx,%esi
+  8003f2:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8003f4:	85 c0                	test   %eax,%eax
+  8003f6:	7f 08                	jg     800400 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  8003f8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003fb:	5b                   	pop    %ebx
+  8003fc:	5e                   	pop    %esi
+  8003fd:	5f                   	pop    %edi
+  8003fe:	5d                   	pop    %ebp
+  8003ff:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800400:	83 ec 0c             	sub    $0xc,%esp
+  800403:	50                   	push   %eax
+  800404:	6a 09                	push   $0x9
+  800406:	68 4a 2e 80 00       	push   $0x802e4a
+  80040b:	6a 23                	push   $0x23
+  80040d:	68 67 2e 80 00       	push   $0x802e67
+  800412:	e8 4b 1c 00 00       	call   802062 <_panic>
+
+00800417 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800417:	55                   	push   %ebp
+  800418:	89 e5                	mov    %esp,%ebp
+  80041a:	57                   	push   %edi
+  80041b:	56                   	push   %esi
+  80041c:	53                   	push   %ebx
+  80041d:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800420:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800425:	8b 55 08             	mov    0x8(%ebp),%edx
+  800428:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80042b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800430:	89 df                	mov    %ebx,%edi
+  800432:	89 de                	mov    %ebx,%esi
+  800434:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800436:	85 c0                	test   %eax,%eax
+  800438:	7f 08                	jg     800442 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  80043a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80043d:	5b                   	pop    %ebx
+  80043e:	5e                   	pop    %esi
+  80043f:	5f                   	pop    %edi
+  800440:	5d                   	pop    %ebp
+  800441:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800442:	83 ec 0c             	sub    $0xc,%esp
+  800445:	50                   	push   %eax
+  800446:	6a 0a                	push   $0xa
+  800448:	68 4a 2e 80 00       	push   $0x802e4a
+  80044d:	6a 23                	push   $0x23
+  80044f:	68 67 2e 80 00       	push   $0x802e67
+  800454:	e8 09 1c 00 00       	call   802062 <_panic>
+
+00800459 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  800459:	55                   	push   %ebp
+  80045a:	89 e5                	mov    %esp,%ebp
+  80045c:	57                   	push   %edi
+  80045d:	56                   	push   %esi
+  80045e:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80045f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800462:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800465:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80046a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80046d:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800470:	8b 75 18             	mov    0x18(%ebp),%esi
+  800473:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  800475:	5b                   	pop    %ebx
+  800476:	5e                   	pop    %esi
+  800477:	5f                   	pop    %edi
+  800478:	5d                   	pop    %ebp
+  800479:	c3                   	ret
+
+0080047a <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  80047a:	55                   	push   %ebp
+  80047b:	89 e5                	mov    %esp,%ebp
+  80047d:	57                   	push   %edi
+  80047e:	56                   	push   %esi
+  80047f:	53                   	push   %ebx
+  800480:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800483:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800488:	8b 55 08             	mov    0x8(%ebp),%edx
+  80048b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80048e:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800493:	89 df                	mov    %ebx,%edi
+  800495:	89 de                	mov    %ebx,%esi
+  800497:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800499:	85 c0                	test   %eax,%eax
+  80049b:	7f 08                	jg     8004a5 <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  80049d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004a0:	5b                   	pop    %ebx
+  8004a1:	5e                   	pop    %esi
+  8004a2:	5f                   	pop    %edi
+  8004a3:	5d                   	pop    %ebp
+  8004a4:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8004a5:	83 ec 0c             	sub    $0xc,%esp
+  8004a8:	50                   	push   %eax
+  8004a9:	6a 0d                	push   $0xd
+  8004ab:	68 4a 2e 80 00       	push   $0x802e4a
+  8004b0:	6a 23                	push   $0x23
+  8004b2:	68 67 2e 80 00       	push   $0x802e67
+  8004b7:	e8 a6 1b 00 00       	call   802062 <_panic>
+
+008004bc <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  8004bc:	55                   	push   %ebp
+  8004bd:	89 e5                	mov    %esp,%ebp
+  8004bf:	57                   	push   %edi
+  8004c0:	56                   	push   %esi
+  8004c1:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8004c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004c7:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8004cc:	89 d1                	mov    %edx,%ecx
+  8004ce:	89 d3                	mov    %edx,%ebx
+  8004d0:	89 d7                	mov    %edx,%edi
+  8004d2:	89 d6                	mov    %edx,%esi
+  8004d4:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8004d6:	5b                   	pop    %ebx
+  8004d7:	5e                   	pop    %esi
+  8004d8:	5f                   	pop    %edi
+  8004d9:	5d                   	pop    %ebp
+  8004da:	c3                   	ret
+
+008004db <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  8004db:	55                   	push   %ebp
+  8004dc:	89 e5                	mov    %esp,%ebp
+  8004de:	57                   	push   %edi
+  8004df:	56                   	push   %esi
+  8004e0:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8004e1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8004e4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8004e7:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8004ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8004f1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8004f4:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8004f7:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  8004f9:	5b                   	pop    %ebx
+  8004fa:	5e                   	pop    %esi
+  8004fb:	5f                   	pop    %edi
+  8004fc:	5d                   	pop    %ebp
+  8004fd:	c3                   	ret
+
+008004fe <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  8004fe:	55                   	push   %ebp
+  8004ff:	89 e5                	mov    %esp,%ebp
+  800501:	57                   	push   %edi
+  800502:	56                   	push   %esi
+  800503:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800504:	be 00 00 00 00       	mov    $0x0,%esi
+  800509:	8b 55 08             	mov    0x8(%ebp),%edx
+  80050c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80050f:	b8 10 00 00 00       	mov    $0x10,%eax
+  800514:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800517:	89 f7                	mov    %esi,%edi
+  800519:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  80051b:	5b                   	pop    %ebx
+  80051c:	5e                   	pop    %esi
+  80051d:	5f                   	pop    %edi
+  80051e:	5d                   	pop    %ebp
+  80051f:	c3                   	ret
+
+00800520 <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  800520:	55                   	push   %ebp
+  800521:	89 e5                	mov    %esp,%ebp
+  800523:	57                   	push   %edi
+  800524:	56                   	push   %esi
+  800525:	53                   	push   %ebx
+  800526:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  800529:	80 3d 48 57 80 00 00 	cmpb   $0x0,0x805748
+  800530:	74 41                	je     800573 <sys_batch+0x53>
+  800532:	8b 45 08             	mov    0x8(%ebp),%eax
+  800535:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  800538:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  80053f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800542:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  800545:	7d 45                	jge    80058c <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  800547:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80054a:	8b 06                	mov    (%esi),%eax
+  80054c:	8b 56 04             	mov    0x4(%esi),%edx
+  80054f:	8b 4e 08             	mov    0x8(%esi),%ecx
+  800552:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  800555:	8b 7e 10             	mov    0x10(%esi),%edi
+  800558:	8b 76 14             	mov    0x14(%esi),%esi
+  80055b:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  80055d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800560:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  800563:	83 c6 1c             	add    $0x1c,%esi
+  800566:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  800569:	85 c0                	test   %eax,%eax
+  80056b:	78 1f                	js     80058c <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  80056d:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  800571:	eb cc                	jmp    80053f <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  800573:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800578:	b8 13 00 00 00       	mov    $0x13,%eax
+  80057d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800580:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800583:	89 df                	mov    %ebx,%edi
+  800585:	89 de                	mov    %ebx,%esi
+  800587:	cd 30                	int    $0x30
+  800589:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  80058c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80058f:	83 c4 08             	add    $0x8,%esp
+  800592:	5b                   	pop    %ebx
+  800593:	5e                   	pop    %esi
+  800594:	5f                   	pop    %edi
+  800595:	5d                   	pop    %ebp
+  800596:	c3                   	ret
+
+00800597 <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  800597:	55                   	push   %ebp
+  800598:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  80059a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80059d:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8005a3:	5d                   	pop    %ebp
+  8005a4:	c3                   	ret
+
+008005a5 <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  8005a5:	55                   	push   %ebp
+  8005a6:	89 e5                	mov    %esp,%ebp
+  8005a8:	56                   	push   %esi
+  8005a9:	53                   	push   %ebx
+  8005aa:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  8005ad:	8b 1e                	mov    (%esi),%ebx
+  8005af:	85 db                	test   %ebx,%ebx
+  8005b1:	75 09                	jne    8005bc <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  8005b3:	89 d8                	mov    %ebx,%eax
+  8005b5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8005b8:	5b                   	pop    %ebx
+  8005b9:	5e                   	pop    %esi
+  8005ba:	5d                   	pop    %ebp
+  8005bb:	c3                   	ret
+  b->sb_n = 0;
+  8005bc:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  8005c2:	53                   	push   %ebx
+  8005c3:	8d 46 04             	lea    0x4(%esi),%eax
+  8005c6:	50                   	push   %eax
+  8005c7:	e8 54 ff ff ff       	call   800520 <sys_batch>
+  8005cc:	83 c4 08             	add    $0x8,%esp
+  8005cf:	85 c0                	test   %eax,%eax
+  8005d1:	78 1e                	js     8005f1 <sysbatch_flush+0x4c>
+  if (r < n)
+  8005d3:	39 c3                	cmp    %eax,%ebx
+  8005d5:	7f 07                	jg     8005de <sysbatch_flush+0x39>
+  return 0;
+  8005d7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8005dc:	eb d5                	jmp    8005b3 <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  8005de:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8005e1:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  8005e5:	85 db                	test   %ebx,%ebx
+  8005e7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8005ec:	0f 49 d8             	cmovns %eax,%ebx
+  8005ef:	eb c2                	jmp    8005b3 <sysbatch_flush+0xe>
+    return r;
+  8005f1:	89 c3                	mov    %eax,%ebx
+  8005f3:	eb be                	jmp    8005b3 <sysbatch_flush+0xe>
+
+008005f5 <sysbatch_add>:
+{
+  8005f5:	55                   	push   %ebp
+  8005f6:	89 e5                	mov    %esp,%ebp
+  8005f8:	53                   	push   %ebx
+  8005f9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  8005fc:	83 3b 40             	cmpl   $0x40,(%ebx)
+  8005ff:	74 41                	je     800642 <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  800601:	8b 03                	mov    (%ebx),%eax
+  800603:	8d 50 01             	lea    0x1(%eax),%edx
+  800606:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  800608:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80060b:	01 d8                	add    %ebx,%eax
+  80060d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800610:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  800613:	8b 55 10             	mov    0x10(%ebp),%edx
+  800616:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  800619:	8b 55 14             	mov    0x14(%ebp),%edx
+  80061c:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  80061f:	8b 55 18             	mov    0x18(%ebp),%edx
+  800622:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  800625:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  800628:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  80062b:	8b 55 20             	mov    0x20(%ebp),%edx
+  80062e:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  800631:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  800638:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80063d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800640:	c9                   	leave
+  800641:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  800642:	53                   	push   %ebx
+  800643:	e8 5d ff ff ff       	call   8005a5 <sysbatch_flush>
+  800648:	83 c4 04             	add    $0x4,%esp
+  80064b:	85 c0                	test   %eax,%eax
+  80064d:	79 b2                	jns    800601 <sysbatch_add+0xc>
+  80064f:	eb ec                	jmp    80063d <sysbatch_add+0x48>
+
+00800651 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  800651:	55                   	push   %ebp
+  800652:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  800654:	8b 45 08             	mov    0x8(%ebp),%eax
+  800657:	05 00 00 00 30       	add    $0x30000000,%eax
+  80065c:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80065f:	5d                   	pop    %ebp
+  800660:	c3                   	ret
+
+00800661 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  800661:	55                   	push   %ebp
+  800662:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  800664:	8b 45 08             	mov    0x8(%ebp),%eax
+  800667:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  80066a:	66 b8 00 00          	mov    $0x0,%ax
+  80066e:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  800673:	5d                   	pop    %ebp
+  800674:	c3                   	ret
+
+00800675 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  800675:	55                   	push   %ebp
+  800676:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  800678:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80067d:	eb 02                	jmp    800681 <fd_alloc+0xc>
+  80067f:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  800681:	89 c2                	mov    %eax,%edx
+  800683:	c1 ea 16             	shr    $0x16,%edx
+  800686:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80068d:	f6 c2 01             	test   $0x1,%dl
+  800690:	74 2b                	je     8006bd <fd_alloc+0x48>
+  800692:	89 c2                	mov    %eax,%edx
+  800694:	c1 ea 0c             	shr    $0xc,%edx
+  800697:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80069e:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8006a4:	f6 c1 01             	test   $0x1,%cl
+  8006a7:	74 14                	je     8006bd <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  8006a9:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8006af:	75 ce                	jne    80067f <fd_alloc+0xa>
+  8006b1:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  8006b6:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8006bb:	eb 05                	jmp    8006c2 <fd_alloc+0x4d>
+      return 0;
+  8006bd:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  8006c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8006c5:	89 02                	mov    %eax,(%edx)
+}
+  8006c7:	89 c8                	mov    %ecx,%eax
+  8006c9:	5d                   	pop    %ebp
+  8006ca:	c3                   	ret
+
+008006cb <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8006cb:	55                   	push   %ebp
+  8006cc:	89 e5                	mov    %esp,%ebp
+  8006ce:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  8006d1:	83 f8 1f             	cmp    $0x1f,%eax
+  8006d4:	77 30                	ja     800706 <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  8006d6:	c1 e0 0c             	shl    $0xc,%eax
+  8006d9:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8006de:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8006e4:	f6 c2 01             	test   $0x1,%dl
+  8006e7:	74 24                	je     80070d <fd_lookup+0x42>
+  8006e9:	89 c2                	mov    %eax,%edx
+  8006eb:	c1 ea 0c             	shr    $0xc,%edx
+  8006ee:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8006f5:	f6 c2 01             	test   $0x1,%dl
+  8006f8:	74 1a                	je     800714 <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  8006fa:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8006fd:	89 02                	mov    %eax,(%edx)
+  return 0;
+  8006ff:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800704:	5d                   	pop    %ebp
+  800705:	c3                   	ret
+    return -E_INVAL;
+  800706:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80070b:	eb f7                	jmp    800704 <fd_lookup+0x39>
+    return -E_INVAL;
+  80070d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800712:	eb f0                	jmp    800704 <fd_lookup+0x39>
+  800714:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800719:	eb e9                	jmp    800704 <fd_lookup+0x39>
+
+0080071b <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  80071b:	55                   	push   %ebp
+  80071c:	89 e5                	mov    %esp,%ebp
+  80071e:	53                   	push   %ebx
+  80071f:	83 ec 04             	sub    $0x4,%esp
+  800722:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  800725:	b8 f4 2e 80 00       	mov    $0x802ef4,%eax
+  80072a:	8b 18                	mov    (%eax),%ebx
+  80072c:	85 db                	test   %ebx,%ebx
+  80072e:	74 0e                	je     80073e <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  800730:	83 c0 04             	add    $0x4,%eax
+  800733:	39 13                	cmp    %edx,(%ebx)
+  800735:	75 f3                	jne    80072a <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  800737:	b8 00 00 00 00       	mov    $0x0,%eax
+  80073c:	eb 1f                	jmp    80075d <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80073e:	a1 44 57 80 00       	mov    0x805744,%eax
+  800743:	8b 40 48             	mov    0x48(%eax),%eax
+  800746:	83 ec 04             	sub    $0x4,%esp
+  800749:	52                   	push   %edx
+  80074a:	50                   	push   %eax
+  80074b:	68 78 2e 80 00       	push   $0x802e78
+  800750:	e8 e8 19 00 00       	call   80213d <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  800755:	83 c4 10             	add    $0x10,%esp
+  800758:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  80075d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800760:	89 1a                	mov    %ebx,(%edx)
+}
+  800762:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800765:	c9                   	leave
+  800766:	c3                   	ret
+
+00800767 <fd_close>:
+{
+  800767:	55                   	push   %ebp
+  800768:	89 e5                	mov    %esp,%ebp
+  80076a:	57                   	push   %edi
+  80076b:	56                   	push   %esi
+  80076c:	53                   	push   %ebx
+  80076d:	83 ec 24             	sub    $0x24,%esp
+  800770:	8b 75 08             	mov    0x8(%ebp),%esi
+  800773:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800776:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800779:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80077a:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  800780:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  800783:	50                   	push   %eax
+  800784:	e8 42 ff ff ff       	call   8006cb <fd_lookup>
+  800789:	89 c3                	mov    %eax,%ebx
+  80078b:	83 c4 10             	add    $0x10,%esp
+  80078e:	85 c0                	test   %eax,%eax
+  800790:	78 05                	js     800797 <fd_close+0x30>
+      || fd != fd2)
+  800792:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  800795:	74 16                	je     8007ad <fd_close+0x46>
+    return must_exist ? r : 0;
+  800797:	89 f8                	mov    %edi,%eax
+  800799:	84 c0                	test   %al,%al
+  80079b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007a0:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8007a3:	89 d8                	mov    %ebx,%eax
+  8007a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8007a8:	5b                   	pop    %ebx
+  8007a9:	5e                   	pop    %esi
+  8007aa:	5f                   	pop    %edi
+  8007ab:	5d                   	pop    %ebp
+  8007ac:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8007ad:	83 ec 08             	sub    $0x8,%esp
+  8007b0:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8007b3:	50                   	push   %eax
+  8007b4:	ff 36                	push   (%esi)
+  8007b6:	e8 60 ff ff ff       	call   80071b <dev_lookup>
+  8007bb:	89 c3                	mov    %eax,%ebx
+  8007bd:	83 c4 10             	add    $0x10,%esp
+  8007c0:	85 c0                	test   %eax,%eax
+  8007c2:	78 1a                	js     8007de <fd_close+0x77>
+    if (dev->dev_close)
+  8007c4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8007c7:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  8007ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  8007cf:	85 c0                	test   %eax,%eax
+  8007d1:	74 0b                	je     8007de <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  8007d3:	83 ec 0c             	sub    $0xc,%esp
+  8007d6:	56                   	push   %esi
+  8007d7:	ff d0                	call   *%eax
+  8007d9:	89 c3                	mov    %eax,%ebx
+  8007db:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  8007de:	83 ec 08             	sub    $0x8,%esp
+  8007e1:	56                   	push   %esi
+  8007e2:	6a 00                	push   $0x0
+  8007e4:	e8 3e fa ff ff       	call   800227 <sys_page_unmap>
+  return r;
+  8007e9:	83 c4 10             	add    $0x10,%esp
+  8007ec:	eb b5                	jmp    8007a3 <fd_close+0x3c>
+
+008007ee <close>:
+
+int
+close(int fdnum)
+{
+  8007ee:	55                   	push   %ebp
+  8007ef:	89 e5                	mov    %esp,%ebp
+  8007f1:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8007f4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8007f7:	50                   	push   %eax
+  8007f8:	ff 75 08             	push   0x8(%ebp)
+  8007fb:	e8 cb fe ff ff       	call   8006cb <fd_lookup>
+  800800:	83 c4 10             	add    $0x10,%esp
+  800803:	85 c0                	test   %eax,%eax
+  800805:	79 02                	jns    800809 <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  800807:	c9                   	leave
+  800808:	c3                   	ret
+    return fd_close(fd, 1);
+  800809:	83 ec 08             	sub    $0x8,%esp
+  80080c:	6a 01                	push   $0x1
+  80080e:	ff 75 f4             	push   -0xc(%ebp)
+  800811:	e8 51 ff ff ff       	call   800767 <fd_close>
+  800816:	83 c4 10             	add    $0x10,%esp
+  800819:	eb ec                	jmp    800807 <close+0x19>
+
+0080081b <close_all>:
+
+void
+close_all(void)
+{
+  80081b:	55                   	push   %ebp
+  80081c:	89 e5                	mov    %esp,%ebp
+  80081e:	53                   	push   %ebx
+  80081f:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  800822:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  800827:	83 ec 0c             	sub    $0xc,%esp
+  80082a:	53                   	push   %ebx
+  80082b:	e8 be ff ff ff       	call   8007ee <close>
+  for (i = 0; i < MAXFD; i++)
+  800830:	83 c3 01             	add    $0x1,%ebx
+  800833:	83 c4 10             	add    $0x10,%esp
+  800836:	83 fb 20             	cmp    $0x20,%ebx
+  800839:	75 ec                	jne    800827 <close_all+0xc>
+}
+  80083b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80083e:	c9                   	leave
+  80083f:	c3                   	ret
+
+00800840 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  800840:	55                   	push   %ebp
+  800841:	89 e5                	mov    %esp,%ebp
+  800843:	57                   	push   %edi
+  800844:	56                   	push   %esi
+  800845:	53                   	push   %ebx
+  800846:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  800849:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80084c:	50                   	push   %eax
+  80084d:	ff 75 08             	push   0x8(%ebp)
+  800850:	e8 76 fe ff ff       	call   8006cb <fd_lookup>
+  800855:	89 c6                	mov    %eax,%esi
+  800857:	83 c4 10             	add    $0x10,%esp
+  80085a:	85 c0                	test   %eax,%eax
+  80085c:	0f 88 0a 01 00 00    	js     80096c <dup+0x12c>
+    return r;
+  close(newfdnum);
+  800862:	83 ec 0c             	sub    $0xc,%esp
+  800865:	ff 75 0c             	push   0xc(%ebp)
+  800868:	e8 81 ff ff ff       	call   8007ee <close>
+
+  newfd = INDEX2FD(newfdnum);
+  80086d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800870:	c1 e0 0c             	shl    $0xc,%eax
+  800873:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  800879:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  80087c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80087f:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  800882:	89 04 24             	mov    %eax,(%esp)
+  800885:	e8 d7 fd ff ff       	call   800661 <fd2data>
+  80088a:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  80088c:	89 3c 24             	mov    %edi,(%esp)
+  80088f:	e8 cd fd ff ff       	call   800661 <fd2data>
+  800894:	83 c4 10             	add    $0x10,%esp
+  800897:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80089a:	89 f3                	mov    %esi,%ebx
+  80089c:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  8008a2:	89 c6                	mov    %eax,%esi
+  8008a4:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8008a7:	89 cf                	mov    %ecx,%edi
+  8008a9:	eb 0c                	jmp    8008b7 <dup+0x77>
+  8008ab:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8008b1:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8008b7:	39 fb                	cmp    %edi,%ebx
+  8008b9:	74 7b                	je     800936 <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  8008bb:	89 d8                	mov    %ebx,%eax
+  8008bd:	c1 e8 16             	shr    $0x16,%eax
+  8008c0:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8008c7:	a8 01                	test   $0x1,%al
+  8008c9:	74 e0                	je     8008ab <dup+0x6b>
+  8008cb:	89 d8                	mov    %ebx,%eax
+  8008cd:	c1 e8 0c             	shr    $0xc,%eax
+  8008d0:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8008d7:	f6 c2 01             	test   $0x1,%dl
+  8008da:	74 cf                	je     8008ab <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  8008dc:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  8008e3:	83 ec 0c             	sub    $0xc,%esp
+  8008e6:	25 07 0e 00 00       	and    $0xe07,%eax
+  8008eb:	50                   	push   %eax
+  8008ec:	56                   	push   %esi
+  8008ed:	6a 00                	push   $0x0
+  8008ef:	53                   	push   %ebx
+  8008f0:	6a 00                	push   $0x0
+  8008f2:	e8 ee f8 ff ff       	call   8001e5 <sys_page_map>
+  8008f7:	83 c4 20             	add    $0x20,%esp
+  8008fa:	85 c0                	test   %eax,%eax
+  8008fc:	79 ad                	jns    8008ab <dup+0x6b>
+  8008fe:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800901:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  800903:	83 ec 08             	sub    $0x8,%esp
+  800906:	ff 75 d4             	push   -0x2c(%ebp)
+  800909:	6a 00                	push   $0x0
+  80090b:	e8 17 f9 ff ff       	call   800227 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  800910:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  800913:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  800919:	83 c4 10             	add    $0x10,%esp
+  80091c:	39 df                	cmp    %ebx,%edi
+  80091e:	74 4c                	je     80096c <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  800920:	83 ec 08             	sub    $0x8,%esp
+  800923:	57                   	push   %edi
+  800924:	6a 00                	push   $0x0
+  800926:	e8 fc f8 ff ff       	call   800227 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80092b:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  800931:	83 c4 10             	add    $0x10,%esp
+  800934:	eb e6                	jmp    80091c <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  800936:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800939:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80093c:	89 c8                	mov    %ecx,%eax
+  80093e:	c1 e8 0c             	shr    $0xc,%eax
+  800941:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  800948:	83 ec 0c             	sub    $0xc,%esp
+  80094b:	25 07 0e 00 00       	and    $0xe07,%eax
+  800950:	50                   	push   %eax
+  800951:	ff 75 d4             	push   -0x2c(%ebp)
+  800954:	6a 00                	push   $0x0
+  800956:	51                   	push   %ecx
+  800957:	6a 00                	push   $0x0
+  800959:	e8 87 f8 ff ff       	call   8001e5 <sys_page_map>
+  80095e:	89 c6                	mov    %eax,%esi
+  800960:	83 c4 20             	add    $0x20,%esp
+  800963:	85 c0                	test   %eax,%eax
+  800965:	78 9c                	js     800903 <dup+0xc3>
+  return newfdnum;
+  800967:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80096a:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  80096c:	89 f0                	mov    %esi,%eax
+  80096e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800971:	5b                   	pop    %ebx
+  800972:	5e                   	pop    %esi
+  800973:	5f                   	pop    %edi
+  800974:	5d                   	pop    %ebp
+  800975:	c3                   	ret
+
+00800976 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  800976:	55                   	push   %ebp
+  800977:	89 e5                	mov    %esp,%ebp
+  800979:	56                   	push   %esi
+  80097a:	53                   	push   %ebx
+  80097b:	83 ec 18             	sub    $0x18,%esp
+  80097e:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  800981:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800984:	50                   	push   %eax
+  800985:	56                   	push   %esi
+  800986:	e8 40 fd ff ff       	call   8006cb <fd_lookup>
+  80098b:	83 c4 10             	add    $0x10,%esp
+  80098e:	85 c0                	test   %eax,%eax
+  800990:	78 3c                	js     8009ce <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800992:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  800995:	83 ec 08             	sub    $0x8,%esp
+  800998:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80099b:	50                   	push   %eax
+  80099c:	ff 33                	push   (%ebx)
+  80099e:	e8 78 fd ff ff       	call   80071b <dev_lookup>
+  8009a3:	83 c4 10             	add    $0x10,%esp
+  8009a6:	85 c0                	test   %eax,%eax
+  8009a8:	78 24                	js     8009ce <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8009aa:	8b 43 08             	mov    0x8(%ebx),%eax
+  8009ad:	83 e0 03             	and    $0x3,%eax
+  8009b0:	83 f8 01             	cmp    $0x1,%eax
+  8009b3:	74 20                	je     8009d5 <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  8009b5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009b8:	8b 40 08             	mov    0x8(%eax),%eax
+  8009bb:	85 c0                	test   %eax,%eax
+  8009bd:	74 37                	je     8009f6 <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  8009bf:	83 ec 04             	sub    $0x4,%esp
+  8009c2:	ff 75 10             	push   0x10(%ebp)
+  8009c5:	ff 75 0c             	push   0xc(%ebp)
+  8009c8:	53                   	push   %ebx
+  8009c9:	ff d0                	call   *%eax
+  8009cb:	83 c4 10             	add    $0x10,%esp
+}
+  8009ce:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8009d1:	5b                   	pop    %ebx
+  8009d2:	5e                   	pop    %esi
+  8009d3:	5d                   	pop    %ebp
+  8009d4:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8009d5:	a1 44 57 80 00       	mov    0x805744,%eax
+  8009da:	8b 40 48             	mov    0x48(%eax),%eax
+  8009dd:	83 ec 04             	sub    $0x4,%esp
+  8009e0:	56                   	push   %esi
+  8009e1:	50                   	push   %eax
+  8009e2:	68 b9 2e 80 00       	push   $0x802eb9
+  8009e7:	e8 51 17 00 00       	call   80213d <cprintf>
+    return -E_INVAL;
+  8009ec:	83 c4 10             	add    $0x10,%esp
+  8009ef:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8009f4:	eb d8                	jmp    8009ce <read+0x58>
+    return -E_NOT_SUPP;
+  8009f6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8009fb:	eb d1                	jmp    8009ce <read+0x58>
+
+008009fd <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8009fd:	55                   	push   %ebp
+  8009fe:	89 e5                	mov    %esp,%ebp
+  800a00:	57                   	push   %edi
+  800a01:	56                   	push   %esi
+  800a02:	53                   	push   %ebx
+  800a03:	83 ec 0c             	sub    $0xc,%esp
+  800a06:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a09:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  800a0c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800a11:	eb 02                	jmp    800a15 <readn+0x18>
+  800a13:	01 c3                	add    %eax,%ebx
+  800a15:	39 f3                	cmp    %esi,%ebx
+  800a17:	73 21                	jae    800a3a <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  800a19:	83 ec 04             	sub    $0x4,%esp
+  800a1c:	89 f0                	mov    %esi,%eax
+  800a1e:	29 d8                	sub    %ebx,%eax
+  800a20:	50                   	push   %eax
+  800a21:	89 d8                	mov    %ebx,%eax
+  800a23:	03 45 0c             	add    0xc(%ebp),%eax
+  800a26:	50                   	push   %eax
+  800a27:	57                   	push   %edi
+  800a28:	e8 49 ff ff ff       	call   800976 <read>
+    if (m < 0)
+  800a2d:	83 c4 10             	add    $0x10,%esp
+  800a30:	85 c0                	test   %eax,%eax
+  800a32:	78 04                	js     800a38 <readn+0x3b>
+      return m;
+    if (m == 0)
+  800a34:	75 dd                	jne    800a13 <readn+0x16>
+  800a36:	eb 02                	jmp    800a3a <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  800a38:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  800a3a:	89 d8                	mov    %ebx,%eax
+  800a3c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800a3f:	5b                   	pop    %ebx
+  800a40:	5e                   	pop    %esi
+  800a41:	5f                   	pop    %edi
+  800a42:	5d                   	pop    %ebp
+  800a43:	c3                   	ret
+
+00800a44 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  800a44:	55                   	push   %ebp
+  800a45:	89 e5                	mov    %esp,%ebp
+  800a47:	56                   	push   %esi
+  800a48:	53                   	push   %ebx
+  800a49:	83 ec 18             	sub    $0x18,%esp
+  800a4c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  800a4f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800a52:	50                   	push   %eax
+  800a53:	53                   	push   %ebx
+  800a54:	e8 72 fc ff ff       	call   8006cb <fd_lookup>
+  800a59:	83 c4 10             	add    $0x10,%esp
+  800a5c:	85 c0                	test   %eax,%eax
+  800a5e:	78 37                	js     800a97 <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800a60:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800a63:	83 ec 08             	sub    $0x8,%esp
+  800a66:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800a69:	50                   	push   %eax
+  800a6a:	ff 36                	push   (%esi)
+  800a6c:	e8 aa fc ff ff       	call   80071b <dev_lookup>
+  800a71:	83 c4 10             	add    $0x10,%esp
+  800a74:	85 c0                	test   %eax,%eax
+  800a76:	78 1f                	js     800a97 <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800a78:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800a7c:	74 20                	je     800a9e <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  800a7e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800a81:	8b 40 0c             	mov    0xc(%eax),%eax
+  800a84:	85 c0                	test   %eax,%eax
+  800a86:	74 37                	je     800abf <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  800a88:	83 ec 04             	sub    $0x4,%esp
+  800a8b:	ff 75 10             	push   0x10(%ebp)
+  800a8e:	ff 75 0c             	push   0xc(%ebp)
+  800a91:	56                   	push   %esi
+  800a92:	ff d0                	call   *%eax
+  800a94:	83 c4 10             	add    $0x10,%esp
+}
+  800a97:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800a9a:	5b                   	pop    %ebx
+  800a9b:	5e                   	pop    %esi
+  800a9c:	5d                   	pop    %ebp
+  800a9d:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800a9e:	a1 44 57 80 00       	mov    0x805744,%eax
+  800aa3:	8b 40 48             	mov    0x48(%eax),%eax
+  800aa6:	83 ec 04             	sub    $0x4,%esp
+  800aa9:	53                   	push   %ebx
+  800aaa:	50                   	push   %eax
+  800aab:	68 d5 2e 80 00       	push   $0x802ed5
+  800ab0:	e8 88 16 00 00       	call   80213d <cprintf>
+    return -E_INVAL;
+  800ab5:	83 c4 10             	add    $0x10,%esp
+  800ab8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800abd:	eb d8                	jmp    800a97 <write+0x53>
+    return -E_NOT_SUPP;
+  800abf:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800ac4:	eb d1                	jmp    800a97 <write+0x53>
+
+00800ac6 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  800ac6:	55                   	push   %ebp
+  800ac7:	89 e5                	mov    %esp,%ebp
+  800ac9:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  800acc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800acf:	50                   	push   %eax
+  800ad0:	ff 75 08             	push   0x8(%ebp)
+  800ad3:	e8 f3 fb ff ff       	call   8006cb <fd_lookup>
+  800ad8:	83 c4 10             	add    $0x10,%esp
+  800adb:	85 c0                	test   %eax,%eax
+  800add:	78 0e                	js     800aed <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  800adf:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800ae2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ae5:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  800ae8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800aed:	c9                   	leave
+  800aee:	c3                   	ret
+
+00800aef <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  800aef:	55                   	push   %ebp
+  800af0:	89 e5                	mov    %esp,%ebp
+  800af2:	56                   	push   %esi
+  800af3:	53                   	push   %ebx
+  800af4:	83 ec 18             	sub    $0x18,%esp
+  800af7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  800afa:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800afd:	50                   	push   %eax
+  800afe:	53                   	push   %ebx
+  800aff:	e8 c7 fb ff ff       	call   8006cb <fd_lookup>
+  800b04:	83 c4 10             	add    $0x10,%esp
+  800b07:	85 c0                	test   %eax,%eax
+  800b09:	78 34                	js     800b3f <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800b0b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800b0e:	83 ec 08             	sub    $0x8,%esp
+  800b11:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b14:	50                   	push   %eax
+  800b15:	ff 36                	push   (%esi)
+  800b17:	e8 ff fb ff ff       	call   80071b <dev_lookup>
+  800b1c:	83 c4 10             	add    $0x10,%esp
+  800b1f:	85 c0                	test   %eax,%eax
+  800b21:	78 1c                	js     800b3f <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800b23:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  800b27:	74 1d                	je     800b46 <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  800b29:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800b2c:	8b 40 18             	mov    0x18(%eax),%eax
+  800b2f:	85 c0                	test   %eax,%eax
+  800b31:	74 34                	je     800b67 <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  800b33:	83 ec 08             	sub    $0x8,%esp
+  800b36:	ff 75 0c             	push   0xc(%ebp)
+  800b39:	56                   	push   %esi
+  800b3a:	ff d0                	call   *%eax
+  800b3c:	83 c4 10             	add    $0x10,%esp
+}
+  800b3f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800b42:	5b                   	pop    %ebx
+  800b43:	5e                   	pop    %esi
+  800b44:	5d                   	pop    %ebp
+  800b45:	c3                   	ret
+            thisenv->env_id, fdnum);
+  800b46:	a1 44 57 80 00       	mov    0x805744,%eax
+  800b4b:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800b4e:	83 ec 04             	sub    $0x4,%esp
+  800b51:	53                   	push   %ebx
+  800b52:	50                   	push   %eax
+  800b53:	68 98 2e 80 00       	push   $0x802e98
+  800b58:	e8 e0 15 00 00       	call   80213d <cprintf>
+    return -E_INVAL;
+  800b5d:	83 c4 10             	add    $0x10,%esp
+  800b60:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b65:	eb d8                	jmp    800b3f <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  800b67:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800b6c:	eb d1                	jmp    800b3f <ftruncate+0x50>
+
+00800b6e <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  800b6e:	55                   	push   %ebp
+  800b6f:	89 e5                	mov    %esp,%ebp
+  800b71:	56                   	push   %esi
+  800b72:	53                   	push   %ebx
+  800b73:	83 ec 18             	sub    $0x18,%esp
+  800b76:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  800b79:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  800b7c:	50                   	push   %eax
+  800b7d:	ff 75 08             	push   0x8(%ebp)
+  800b80:	e8 46 fb ff ff       	call   8006cb <fd_lookup>
+  800b85:	83 c4 10             	add    $0x10,%esp
+  800b88:	85 c0                	test   %eax,%eax
+  800b8a:	78 49                	js     800bd5 <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  800b8c:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800b8f:	83 ec 08             	sub    $0x8,%esp
+  800b92:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800b95:	50                   	push   %eax
+  800b96:	ff 36                	push   (%esi)
+  800b98:	e8 7e fb ff ff       	call   80071b <dev_lookup>
+  800b9d:	83 c4 10             	add    $0x10,%esp
+  800ba0:	85 c0                	test   %eax,%eax
+  800ba2:	78 31                	js     800bd5 <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  800ba4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800ba7:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  800bab:	74 2f                	je     800bdc <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  800bad:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  800bb0:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  800bb7:	00 00 00 
+  stat->st_isdir = 0;
+  800bba:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  800bc1:	00 00 00 
+  stat->st_dev = dev;
+  800bc4:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  800bca:	83 ec 08             	sub    $0x8,%esp
+  800bcd:	53                   	push   %ebx
+  800bce:	56                   	push   %esi
+  800bcf:	ff 50 14             	call   *0x14(%eax)
+  800bd2:	83 c4 10             	add    $0x10,%esp
+}
+  800bd5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800bd8:	5b                   	pop    %ebx
+  800bd9:	5e                   	pop    %esi
+  800bda:	5d                   	pop    %ebp
+  800bdb:	c3                   	ret
+    return -E_NOT_SUPP;
+  800bdc:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  800be1:	eb f2                	jmp    800bd5 <fstat+0x67>
+
+00800be3 <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  800be3:	55                   	push   %ebp
+  800be4:	89 e5                	mov    %esp,%ebp
+  800be6:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  800be9:	ff 75 0c             	push   0xc(%ebp)
+  800bec:	ff 75 08             	push   0x8(%ebp)
+  800bef:	e8 58 07 00 00       	call   80134c <file_stat>
+}
+  800bf4:	c9                   	leave
+  800bf5:	c3                   	ret
+
+00800bf6 <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  800bf6:	55                   	push   %ebp
+  800bf7:	89 e5                	mov    %esp,%ebp
+  800bf9:	57                   	push   %edi
+  800bfa:	56                   	push   %esi
+  800bfb:	53                   	push   %ebx
+  800bfc:	83 ec 1c             	sub    $0x1c,%esp
+  800bff:	89 c7                	mov    %eax,%edi
+  800c01:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  800c04:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  800c07:	e9 a2 00 00 00       	jmp    800cae <fsipc_send+0xb8>
+  nfsenvs = 0;
+  800c0c:	c7 05 00 50 80 00 00 	movl   $0x0,0x805000
+  800c13:	00 00 00 
+  800c16:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c1b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  800c20:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  800c25:	be 01 00 00 00       	mov    $0x1,%esi
+  800c2a:	eb 0f                	jmp    800c3b <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  800c2c:	83 c0 01             	add    $0x1,%eax
+  800c2f:	3d 00 04 00 00       	cmp    $0x400,%eax
+  800c34:	74 49                	je     800c7f <fsipc_send+0x89>
+  800c36:	83 f9 07             	cmp    $0x7,%ecx
+  800c39:	7f 50                	jg     800c8b <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  800c3b:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  800c3e:	c1 e2 04             	shl    $0x4,%edx
+  800c41:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800c47:	8b 52 50             	mov    0x50(%edx),%edx
+  800c4a:	83 fa 01             	cmp    $0x1,%edx
+  800c4d:	75 dd                	jne    800c2c <fsipc_send+0x36>
+  800c4f:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  800c52:	c1 e2 04             	shl    $0x4,%edx
+  800c55:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800c5b:	8b 52 54             	mov    0x54(%edx),%edx
+  800c5e:	85 d2                	test   %edx,%edx
+  800c60:	74 ca                	je     800c2c <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  800c62:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  800c65:	c1 e2 04             	shl    $0x4,%edx
+  800c68:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  800c6e:	8b 52 48             	mov    0x48(%edx),%edx
+  800c71:	89 14 8d 20 50 80 00 	mov    %edx,0x805020(,%ecx,4)
+  800c78:	8d 49 01             	lea    0x1(%ecx),%ecx
+  800c7b:	89 f3                	mov    %esi,%ebx
+  800c7d:	eb ad                	jmp    800c2c <fsipc_send+0x36>
+  800c7f:	84 db                	test   %bl,%bl
+  800c81:	74 38                	je     800cbb <fsipc_send+0xc5>
+  800c83:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  800c89:	eb 30                	jmp    800cbb <fsipc_send+0xc5>
+  800c8b:	84 db                	test   %bl,%bl
+  800c8d:	74 2c                	je     800cbb <fsipc_send+0xc5>
+  800c8f:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  800c95:	eb 24                	jmp    800cbb <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  800c97:	50                   	push   %eax
+  800c98:	68 04 2f 80 00       	push   $0x802f04
+  800c9d:	6a 34                	push   $0x34
+  800c9f:	68 0e 2f 80 00       	push   $0x802f0e
+  800ca4:	e8 b9 13 00 00       	call   802062 <_panic>
+    }
+    sys_yield();
+  800ca9:	e8 92 f4 ff ff       	call   800140 <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  800cae:	83 3d 00 50 80 00 03 	cmpl   $0x3,0x805000
+  800cb5:	0f 8e 51 ff ff ff    	jle    800c0c <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  800cbb:	a1 44 57 80 00       	mov    0x805744,%eax
+  800cc0:	8b 70 48             	mov    0x48(%eax),%esi
+  800cc3:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  800cc9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cce:	8b 0d 00 50 80 00    	mov    0x805000,%ecx
+  800cd4:	39 d9                	cmp    %ebx,%ecx
+  800cd6:	7e d1                	jle    800ca9 <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  800cd8:	83 ec 0c             	sub    $0xc,%esp
+  800cdb:	ff 75 e0             	push   -0x20(%ebp)
+  800cde:	6a 07                	push   $0x7
+  800ce0:	ff 75 e4             	push   -0x1c(%ebp)
+  800ce3:	57                   	push   %edi
+  800ce4:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  800ce7:	99                   	cltd
+  800ce8:	f7 f9                	idiv   %ecx
+  800cea:	ff 34 95 20 50 80 00 	push   0x805020(,%edx,4)
+  800cf1:	e8 63 f7 ff ff       	call   800459 <sys_ipc_try_send>
+      if (r == 0)
+  800cf6:	83 c4 20             	add    $0x20,%esp
+  800cf9:	85 c0                	test   %eax,%eax
+  800cfb:	74 0a                	je     800d07 <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  800cfd:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  800d00:	75 95                	jne    800c97 <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  800d02:	83 c3 01             	add    $0x1,%ebx
+  800d05:	eb c7                	jmp    800cce <fsipc_send+0xd8>
+  }
+}
+  800d07:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d0a:	5b                   	pop    %ebx
+  800d0b:	5e                   	pop    %esi
+  800d0c:	5f                   	pop    %edi
+  800d0d:	5d                   	pop    %ebp
+  800d0e:	c3                   	ret
+
+00800d0f <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  800d0f:	55                   	push   %ebp
+  800d10:	89 e5                	mov    %esp,%ebp
+  800d12:	53                   	push   %ebx
+  800d13:	83 ec 14             	sub    $0x14,%esp
+  800d16:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  800d18:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  800d1f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800d24:	ba 00 60 80 00       	mov    $0x806000,%edx
+  800d29:	e8 c8 fe ff ff       	call   800bf6 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  800d2e:	6a 00                	push   $0x0
+  800d30:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800d33:	50                   	push   %eax
+  800d34:	53                   	push   %ebx
+  800d35:	6a 00                	push   $0x0
+  800d37:	e8 1f 1d 00 00       	call   802a5b <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  800d3c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800d3f:	c9                   	leave
+  800d40:	c3                   	ret
+
+00800d41 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  800d41:	55                   	push   %ebp
+  800d42:	89 e5                	mov    %esp,%ebp
+  800d44:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  800d47:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d4a:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d4d:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.set_size.req_size = newsize;
+  800d52:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d55:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  800d5a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d5f:	b8 02 00 00 00       	mov    $0x2,%eax
+  800d64:	e8 a6 ff ff ff       	call   800d0f <fsipc>
+}
+  800d69:	c9                   	leave
+  800d6a:	c3                   	ret
+
+00800d6b <devfile_flush>:
+{
+  800d6b:	55                   	push   %ebp
+  800d6c:	89 e5                	mov    %esp,%ebp
+  800d6e:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  800d71:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d74:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d77:	a3 00 60 80 00       	mov    %eax,0x806000
+  return fsipc(FSREQ_FLUSH, NULL);
+  800d7c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d81:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d86:	e8 84 ff ff ff       	call   800d0f <fsipc>
+}
+  800d8b:	c9                   	leave
+  800d8c:	c3                   	ret
+
+00800d8d <devfile_stat>:
+{
+  800d8d:	55                   	push   %ebp
+  800d8e:	89 e5                	mov    %esp,%ebp
+  800d90:	53                   	push   %ebx
+  800d91:	83 ec 04             	sub    $0x4,%esp
+  800d94:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  800d97:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d9a:	8b 40 0c             	mov    0xc(%eax),%eax
+  800d9d:	a3 00 60 80 00       	mov    %eax,0x806000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  800da2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800da7:	b8 05 00 00 00       	mov    $0x5,%eax
+  800dac:	e8 5e ff ff ff       	call   800d0f <fsipc>
+  800db1:	85 c0                	test   %eax,%eax
+  800db3:	78 2c                	js     800de1 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  800db5:	83 ec 08             	sub    $0x8,%esp
+  800db8:	68 00 60 80 00       	push   $0x806000
+  800dbd:	53                   	push   %ebx
+  800dbe:	e8 68 19 00 00       	call   80272b <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  800dc3:	a1 80 60 80 00       	mov    0x806080,%eax
+  800dc8:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  800dce:	a1 84 60 80 00       	mov    0x806084,%eax
+  800dd3:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  800dd9:	83 c4 10             	add    $0x10,%esp
+  800ddc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800de1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800de4:	c9                   	leave
+  800de5:	c3                   	ret
+
+00800de6 <fsv_alloc>:
+{
+  800de6:	55                   	push   %ebp
+  800de7:	89 e5                	mov    %esp,%ebp
+  800de9:	56                   	push   %esi
+  800dea:	53                   	push   %ebx
+  800deb:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  800ded:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800df2:	eb 22                	jmp    800e16 <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  800df4:	83 ec 04             	sub    $0x4,%esp
+  800df7:	6a 00                	push   $0x0
+  800df9:	6a 00                	push   $0x0
+  800dfb:	6a 07                	push   $0x7
+  800dfd:	50                   	push   %eax
+  800dfe:	6a 00                	push   $0x0
+  800e00:	6a 04                	push   $0x4
+  800e02:	68 40 50 80 00       	push   $0x805040
+  800e07:	e8 e9 f7 ff ff       	call   8005f5 <sysbatch_add>
+  800e0c:	83 c4 20             	add    $0x20,%esp
+  800e0f:	85 c0                	test   %eax,%eax
+  800e11:	78 48                	js     800e5b <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  800e13:	83 c3 01             	add    $0x1,%ebx
+  800e16:	39 f3                	cmp    %esi,%ebx
+  800e18:	74 31                	je     800e4b <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  800e1a:	89 d8                	mov    %ebx,%eax
+  800e1c:	c1 e0 0c             	shl    $0xc,%eax
+  800e1f:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  800e24:	89 c2                	mov    %eax,%edx
+  800e26:	c1 ea 16             	shr    $0x16,%edx
+  800e29:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  800e30:	f6 c2 01             	test   $0x1,%dl
+  800e33:	74 bf                	je     800df4 <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  800e35:	89 c2                	mov    %eax,%edx
+  800e37:	c1 ea 0c             	shr    $0xc,%edx
+  800e3a:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  800e41:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  800e44:	83 fa 03             	cmp    $0x3,%edx
+  800e47:	75 ab                	jne    800df4 <fsv_alloc+0xe>
+  800e49:	eb c8                	jmp    800e13 <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  800e4b:	83 ec 0c             	sub    $0xc,%esp
+  800e4e:	68 40 50 80 00       	push   $0x805040
+  800e53:	e8 4d f7 ff ff       	call   8005a5 <sysbatch_flush>
+  800e58:	83 c4 10             	add    $0x10,%esp
+}
+  800e5b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800e5e:	5b                   	pop    %ebx
+  800e5f:	5e                   	pop    %esi
+  800e60:	5d                   	pop    %ebp
+  800e61:	c3                   	ret
+
+00800e62 <devfile_read>:
+{
+  800e62:	55                   	push   %ebp
+  800e63:	89 e5                	mov    %esp,%ebp
+  800e65:	57                   	push   %edi
+  800e66:	56                   	push   %esi
+  800e67:	53                   	push   %ebx
+  800e68:	83 ec 3c             	sub    $0x3c,%esp
+  800e6b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  800e6e:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  800e74:	77 57                	ja     800ecd <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  800e76:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e79:	8b 40 0c             	mov    0xc(%eax),%eax
+  800e7c:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read.req_n = n;
+  800e81:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  800e87:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e8c:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e91:	e8 79 fe ff ff       	call   800d0f <fsipc>
+  800e96:	89 c6                	mov    %eax,%esi
+  800e98:	85 c0                	test   %eax,%eax
+  800e9a:	78 27                	js     800ec3 <devfile_read+0x61>
+  assert(r <= n);
+  800e9c:	39 c3                	cmp    %eax,%ebx
+  800e9e:	0f 82 0e 02 00 00    	jb     8010b2 <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  800ea4:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800ea9:	0f 8f 1c 02 00 00    	jg     8010cb <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  800eaf:	83 ec 04             	sub    $0x4,%esp
+  800eb2:	50                   	push   %eax
+  800eb3:	68 00 60 80 00       	push   $0x806000
+  800eb8:	ff 75 0c             	push   0xc(%ebp)
+  800ebb:	e8 f1 19 00 00       	call   8028b1 <memmove>
+  return r;
+  800ec0:	83 c4 10             	add    $0x10,%esp
+}
+  800ec3:	89 f0                	mov    %esi,%eax
+  800ec5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ec8:	5b                   	pop    %ebx
+  800ec9:	5e                   	pop    %esi
+  800eca:	5f                   	pop    %edi
+  800ecb:	5d                   	pop    %ebp
+  800ecc:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  800ecd:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ed2:	e8 0f ff ff ff       	call   800de6 <fsv_alloc>
+  800ed7:	89 c6                	mov    %eax,%esi
+  800ed9:	85 c0                	test   %eax,%eax
+  800edb:	78 e6                	js     800ec3 <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  800edd:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ee0:	8b 40 0c             	mov    0xc(%eax),%eax
+  800ee3:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  800ee8:	8b 45 08             	mov    0x8(%ebp),%eax
+  800eeb:	8b 40 04             	mov    0x4(%eax),%eax
+  800eee:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  800ef3:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  800ef9:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  800f00:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800f05:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  800f0a:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f0f:	e8 e2 fc ff ff       	call   800bf6 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  800f14:	6a 00                	push   $0x0
+  800f16:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  800f19:	50                   	push   %eax
+  800f1a:	68 00 10 c0 9f       	push   $0x9fc01000
+  800f1f:	6a 00                	push   $0x0
+  800f21:	e8 35 1b 00 00       	call   802a5b <ipc_recv_pages>
+  800f26:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  800f28:	83 c4 10             	add    $0x10,%esp
+  800f2b:	85 c0                	test   %eax,%eax
+  800f2d:	7e 94                	jle    800ec3 <devfile_read+0x61>
+  assert(r <= n);
+  800f2f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  800f32:	39 c3                	cmp    %eax,%ebx
+  800f34:	72 2e                	jb     800f64 <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  800f36:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f39:	8b 40 04             	mov    0x4(%eax),%eax
+  800f3c:	25 ff 0f 00 00       	and    $0xfff,%eax
+  800f41:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  800f44:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  800f47:	c1 e2 0c             	shl    $0xc,%edx
+  800f4a:	39 ca                	cmp    %ecx,%edx
+  800f4c:	72 2f                	jb     800f7d <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  800f4e:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  800f53:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  800f56:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  800f5a:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  800f5f:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  800f62:	eb 52                	jmp    800fb6 <devfile_read+0x154>
+  assert(r <= n);
+  800f64:	68 19 2f 80 00       	push   $0x802f19
+  800f69:	68 20 2f 80 00       	push   $0x802f20
+  800f6e:	68 49 01 00 00       	push   $0x149
+  800f73:	68 0e 2f 80 00       	push   $0x802f0e
+  800f78:	e8 e5 10 00 00       	call   802062 <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  800f7d:	68 44 2f 80 00       	push   $0x802f44
+  800f82:	68 20 2f 80 00       	push   $0x802f20
+  800f87:	68 4a 01 00 00       	push   $0x14a
+  800f8c:	68 0e 2f 80 00       	push   $0x802f0e
+  800f91:	e8 cc 10 00 00       	call   802062 <_panic>
+      memmove(dst + done, src + done, m);
+  800f96:	83 ec 04             	sub    $0x4,%esp
+  800f99:	53                   	push   %ebx
+  800f9a:	56                   	push   %esi
+  800f9b:	89 f8                	mov    %edi,%eax
+  800f9d:	03 45 0c             	add    0xc(%ebp),%eax
+  800fa0:	50                   	push   %eax
+  800fa1:	e8 0b 19 00 00       	call   8028b1 <memmove>
+  800fa6:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  800fa9:	01 df                	add    %ebx,%edi
+  800fab:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800fae:	39 c7                	cmp    %eax,%edi
+  800fb0:	0f 83 c0 00 00 00    	jae    801076 <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  800fb6:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800fb9:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  800fbc:	89 f0                	mov    %esi,%eax
+  800fbe:	25 ff 0f 00 00       	and    $0xfff,%eax
+  800fc3:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  800fc8:	29 c3                	sub    %eax,%ebx
+  800fca:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  800fcd:	29 f8                	sub    %edi,%eax
+  800fcf:	39 c3                	cmp    %eax,%ebx
+  800fd1:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  800fd4:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  800fda:	75 ba                	jne    800f96 <devfile_read+0x134>
+  800fdc:	89 f9                	mov    %edi,%ecx
+  800fde:	03 4d 0c             	add    0xc(%ebp),%ecx
+  800fe1:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  800fe4:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  800fea:	75 aa                	jne    800f96 <devfile_read+0x134>
+  800fec:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  800ff2:	77 a2                	ja     800f96 <devfile_read+0x134>
+  800ff4:	89 c8                	mov    %ecx,%eax
+  800ff6:	c1 e8 16             	shr    $0x16,%eax
+  800ff9:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801000:	a8 01                	test   $0x1,%al
+  801002:	74 92                	je     800f96 <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  801004:	89 c8                	mov    %ecx,%eax
+  801006:	c1 e8 0c             	shr    $0xc,%eax
+  801009:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  801010:	a8 01                	test   $0x1,%al
+  801012:	74 82                	je     800f96 <devfile_read+0x134>
+  801014:	a9 02 08 00 00       	test   $0x802,%eax
+  801019:	0f 84 77 ff ff ff    	je     800f96 <devfile_read+0x134>
+  80101f:	f6 c4 04             	test   $0x4,%ah
+  801022:	0f 85 6e ff ff ff    	jne    800f96 <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  801028:	a1 44 57 80 00       	mov    0x805744,%eax
+  80102d:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  801031:	84 c0                	test   %al,%al
+  801033:	75 17                	jne    80104c <devfile_read+0x1ea>
+  801035:	83 ec 08             	sub    $0x8,%esp
+  801038:	6a 01                	push   $0x1
+  80103a:	6a 00                	push   $0x0
+  80103c:	e8 1e f1 ff ff       	call   80015f <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  801041:	83 c4 10             	add    $0x10,%esp
+  801044:	85 c0                	test   %eax,%eax
+  801046:	0f 85 4a ff ff ff    	jne    800f96 <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  80104c:	83 ec 04             	sub    $0x4,%esp
+  80104f:	68 05 08 00 00       	push   $0x805
+  801054:	ff 75 cc             	push   -0x34(%ebp)
+  801057:	6a 00                	push   $0x0
+  801059:	56                   	push   %esi
+  80105a:	6a 00                	push   $0x0
+  80105c:	6a 05                	push   $0x5
+  80105e:	68 40 50 80 00       	push   $0x805040
+  801063:	e8 8d f5 ff ff       	call   8005f5 <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  801068:	c1 e8 1f             	shr    $0x1f,%eax
+  80106b:	08 45 cb             	or     %al,-0x35(%ebp)
+  80106e:	83 c4 20             	add    $0x20,%esp
+  801071:	e9 33 ff ff ff       	jmp    800fa9 <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  801076:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  801079:	83 ec 0c             	sub    $0xc,%esp
+  80107c:	68 40 50 80 00       	push   $0x805040
+  801081:	e8 1f f5 ff ff       	call   8005a5 <sysbatch_flush>
+  801086:	83 c4 10             	add    $0x10,%esp
+  801089:	85 c0                	test   %eax,%eax
+  80108b:	78 06                	js     801093 <devfile_read+0x231>
+  80108d:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  801091:	74 14                	je     8010a7 <devfile_read+0x245>
+    memmove(dst, src, r);
+  801093:	83 ec 04             	sub    $0x4,%esp
+  801096:	ff 75 d4             	push   -0x2c(%ebp)
+  801099:	ff 75 d0             	push   -0x30(%ebp)
+  80109c:	ff 75 0c             	push   0xc(%ebp)
+  80109f:	e8 0d 18 00 00       	call   8028b1 <memmove>
+  8010a4:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  8010a7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010aa:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  8010ad:	e9 11 fe ff ff       	jmp    800ec3 <devfile_read+0x61>
+  assert(r <= n);
+  8010b2:	68 19 2f 80 00       	push   $0x802f19
+  8010b7:	68 20 2f 80 00       	push   $0x802f20
+  8010bc:	68 1c 01 00 00       	push   $0x11c
+  8010c1:	68 0e 2f 80 00       	push   $0x802f0e
+  8010c6:	e8 97 0f 00 00       	call   802062 <_panic>
+  assert(r <= PGSIZE);
+  8010cb:	68 35 2f 80 00       	push   $0x802f35
+  8010d0:	68 20 2f 80 00       	push   $0x802f20
+  8010d5:	68 1d 01 00 00       	push   $0x11d
+  8010da:	68 0e 2f 80 00       	push   $0x802f0e
+  8010df:	e8 7e 0f 00 00       	call   802062 <_panic>
+
+008010e4 <devfile_write>:
+{
+  8010e4:	55                   	push   %ebp
+  8010e5:	89 e5                	mov    %esp,%ebp
+  8010e7:	57                   	push   %edi
+  8010e8:	56                   	push   %esi
+  8010e9:	53                   	push   %ebx
+  8010ea:	83 ec 1c             	sub    $0x1c,%esp
+  8010ed:	8b 75 08             	mov    0x8(%ebp),%esi
+  8010f0:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  8010f3:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  8010f8:	77 39                	ja     801133 <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8010fa:	8b 56 0c             	mov    0xc(%esi),%edx
+  8010fd:	89 15 00 60 80 00    	mov    %edx,0x806000
+  fsipcbuf.write.req_n = n;
+  801103:	a3 04 60 80 00       	mov    %eax,0x806004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  801108:	83 ec 04             	sub    $0x4,%esp
+  80110b:	50                   	push   %eax
+  80110c:	ff 75 0c             	push   0xc(%ebp)
+  80110f:	68 08 60 80 00       	push   $0x806008
+  801114:	e8 98 17 00 00       	call   8028b1 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801119:	ba 00 00 00 00       	mov    $0x0,%edx
+  80111e:	b8 04 00 00 00       	mov    $0x4,%eax
+  801123:	e8 e7 fb ff ff       	call   800d0f <fsipc>
+  801128:	83 c4 10             	add    $0x10,%esp
+}
+  80112b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80112e:	5b                   	pop    %ebx
+  80112f:	5e                   	pop    %esi
+  801130:	5f                   	pop    %edi
+  801131:	5d                   	pop    %ebp
+  801132:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  801133:	ba 00 00 10 00       	mov    $0x100000,%edx
+  801138:	39 d0                	cmp    %edx,%eax
+  80113a:	89 d3                	mov    %edx,%ebx
+  80113c:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  80113f:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  801145:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  801148:	83 c7 01             	add    $0x1,%edi
+  80114b:	89 f8                	mov    %edi,%eax
+  80114d:	e8 94 fc ff ff       	call   800de6 <fsv_alloc>
+  801152:	85 c0                	test   %eax,%eax
+  801154:	78 d5                	js     80112b <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  801156:	83 ec 04             	sub    $0x4,%esp
+  801159:	53                   	push   %ebx
+  80115a:	ff 75 0c             	push   0xc(%ebp)
+  80115d:	68 00 10 c0 9f       	push   $0x9fc01000
+  801162:	e8 4a 17 00 00       	call   8028b1 <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  801167:	8b 46 0c             	mov    0xc(%esi),%eax
+  80116a:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  80116f:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  801175:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  80117c:	89 f9                	mov    %edi,%ecx
+  80117e:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801183:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801188:	e8 69 fa ff ff       	call   800bf6 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  80118d:	6a 00                	push   $0x0
+  80118f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801192:	50                   	push   %eax
+  801193:	6a 00                	push   $0x0
+  801195:	6a 00                	push   $0x0
+  801197:	e8 bf 18 00 00       	call   802a5b <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  80119c:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  80119f:	eb 8a                	jmp    80112b <devfile_write+0x47>
+
+008011a1 <open>:
+{
+  8011a1:	55                   	push   %ebp
+  8011a2:	89 e5                	mov    %esp,%ebp
+  8011a4:	56                   	push   %esi
+  8011a5:	53                   	push   %ebx
+  8011a6:	83 ec 1c             	sub    $0x1c,%esp
+  8011a9:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  8011ac:	56                   	push   %esi
+  8011ad:	e8 3e 15 00 00       	call   8026f0 <strlen>
+  8011b2:	83 c4 10             	add    $0x10,%esp
+  8011b5:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8011ba:	7f 6c                	jg     801228 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  8011bc:	83 ec 0c             	sub    $0xc,%esp
+  8011bf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8011c2:	50                   	push   %eax
+  8011c3:	e8 ad f4 ff ff       	call   800675 <fd_alloc>
+  8011c8:	89 c3                	mov    %eax,%ebx
+  8011ca:	83 c4 10             	add    $0x10,%esp
+  8011cd:	85 c0                	test   %eax,%eax
+  8011cf:	78 3c                	js     80120d <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  8011d1:	83 ec 08             	sub    $0x8,%esp
+  8011d4:	56                   	push   %esi
+  8011d5:	68 00 60 80 00       	push   $0x806000
+  8011da:	e8 4c 15 00 00       	call   80272b <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  8011df:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8011e2:	a3 00 64 80 00       	mov    %eax,0x806400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8011e7:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8011ea:	b8 01 00 00 00       	mov    $0x1,%eax
+  8011ef:	e8 1b fb ff ff       	call   800d0f <fsipc>
+  8011f4:	89 c3                	mov    %eax,%ebx
+  8011f6:	83 c4 10             	add    $0x10,%esp
+  8011f9:	85 c0                	test   %eax,%eax
+  8011fb:	78 19                	js     801216 <open+0x75>
+  return fd2num(fd);
+  8011fd:	83 ec 0c             	sub    $0xc,%esp
+  801200:	ff 75 f4             	push   -0xc(%ebp)
+  801203:	e8 49 f4 ff ff       	call   800651 <fd2num>
+  801208:	89 c3                	mov    %eax,%ebx
+  80120a:	83 c4 10             	add    $0x10,%esp
+}
+  80120d:	89 d8                	mov    %ebx,%eax
+  80120f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801212:	5b                   	pop    %ebx
+  801213:	5e                   	pop    %esi
+  801214:	5d                   	pop    %ebp
+  801215:	c3                   	ret
+    fd_close(fd, 0);
+  801216:	83 ec 08             	sub    $0x8,%esp
+  801219:	6a 00                	push   $0x0
+  80121b:	ff 75 f4             	push   -0xc(%ebp)
+  80121e:	e8 44 f5 ff ff       	call   800767 <fd_close>
+    return r;
+  801223:	83 c4 10             	add    $0x10,%esp
+  801226:	eb e5                	jmp    80120d <open+0x6c>
+    return -E_BAD_PATH;
+  801228:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80122d:	eb de                	jmp    80120d <open+0x6c>
+
+0080122f <open_read>:
+{
+  80122f:	55                   	push   %ebp
+  801230:	89 e5                	mov    %esp,%ebp
+  801232:	57                   	push   %edi
+  801233:	56                   	push   %esi
+  801234:	53                   	push   %ebx
+  801235:	83 ec 28             	sub    $0x28,%esp
+  801238:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  80123b:	57                   	push   %edi
+  80123c:	e8 af 14 00 00       	call   8026f0 <strlen>
+  801241:	83 c4 10             	add    $0x10,%esp
+  801244:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801249:	0f 87 f6 00 00 00    	ja     801345 <open_read+0x116>
+  80124f:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  801251:	83 ec 0c             	sub    $0xc,%esp
+  801254:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801257:	50                   	push   %eax
+  801258:	e8 18 f4 ff ff       	call   800675 <fd_alloc>
+  80125d:	89 c3                	mov    %eax,%ebx
+  80125f:	83 c4 10             	add    $0x10,%esp
+  801262:	85 c0                	test   %eax,%eax
+  801264:	0f 88 b2 00 00 00    	js     80131c <open_read+0xed>
+  strcpy(req->req_buf, path);
+  80126a:	83 ec 08             	sub    $0x8,%esp
+  80126d:	57                   	push   %edi
+  80126e:	68 e4 60 80 00       	push   $0x8060e4
+  801273:	e8 b3 14 00 00       	call   80272b <strcpy>
+  req->req_nops = 2;
+  801278:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  80127f:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  801282:	c7 05 04 60 80 00 01 	movl   $0x1,0x806004
+  801289:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  80128c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80128f:	a3 10 60 80 00       	mov    %eax,0x806010
+  req->req_ops[0].op_buf = 0;
+  801294:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  80129b:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  80129e:	c7 05 20 60 80 00 04 	movl   $0x4,0x806020
+  8012a5:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  8012a8:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  8012af:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  8012b2:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  8012b7:	29 f0                	sub    %esi,%eax
+  8012b9:	3b 45 14             	cmp    0x14(%ebp),%eax
+  8012bc:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  8012c0:	a3 2c 60 80 00       	mov    %eax,0x80602c
+  req->req_ops[1].op_offset = 0;
+  8012c5:	c7 05 30 60 80 00 00 	movl   $0x0,0x806030
+  8012cc:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  8012cf:	83 c6 01             	add    $0x1,%esi
+  8012d2:	89 35 34 60 80 00    	mov    %esi,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  8012d8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8012db:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8012e0:	e8 2a fa ff ff       	call   800d0f <fsipc>
+  8012e5:	89 c3                	mov    %eax,%ebx
+  8012e7:	83 c4 10             	add    $0x10,%esp
+  8012ea:	83 f8 01             	cmp    $0x1,%eax
+  8012ed:	7e 37                	jle    801326 <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  8012ef:	a1 38 60 80 00       	mov    0x806038,%eax
+  8012f4:	8b 55 18             	mov    0x18(%ebp),%edx
+  8012f7:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  8012f9:	83 ec 04             	sub    $0x4,%esp
+  8012fc:	50                   	push   %eax
+  8012fd:	81 c6 e4 60 80 00    	add    $0x8060e4,%esi
+  801303:	56                   	push   %esi
+  801304:	ff 75 10             	push   0x10(%ebp)
+  801307:	e8 a5 15 00 00       	call   8028b1 <memmove>
+  return fd2num(fd);
+  80130c:	83 c4 04             	add    $0x4,%esp
+  80130f:	ff 75 e4             	push   -0x1c(%ebp)
+  801312:	e8 3a f3 ff ff       	call   800651 <fd2num>
+  801317:	89 c3                	mov    %eax,%ebx
+  801319:	83 c4 10             	add    $0x10,%esp
+}
+  80131c:	89 d8                	mov    %ebx,%eax
+  80131e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801321:	5b                   	pop    %ebx
+  801322:	5e                   	pop    %esi
+  801323:	5f                   	pop    %edi
+  801324:	5d                   	pop    %ebp
+  801325:	c3                   	ret
+    fd_close(fd, 0);
+  801326:	83 ec 08             	sub    $0x8,%esp
+  801329:	6a 00                	push   $0x0
+  80132b:	ff 75 e4             	push   -0x1c(%ebp)
+  80132e:	e8 34 f4 ff ff       	call   800767 <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  801333:	83 c4 10             	add    $0x10,%esp
+  801336:	85 db                	test   %ebx,%ebx
+  801338:	78 e2                	js     80131c <open_read+0xed>
+  80133a:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  80133d:	8b 9b 1c 60 80 00    	mov    0x80601c(%ebx),%ebx
+  801343:	eb d7                	jmp    80131c <open_read+0xed>
+    return -E_BAD_PATH;
+  801345:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80134a:	eb d0                	jmp    80131c <open_read+0xed>
+
+0080134c <file_stat>:
+{
+  80134c:	55                   	push   %ebp
+  80134d:	89 e5                	mov    %esp,%ebp
+  80134f:	57                   	push   %edi
+  801350:	56                   	push   %esi
+  801351:	53                   	push   %ebx
+  801352:	83 ec 18             	sub    $0x18,%esp
+  801355:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801358:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  80135b:	57                   	push   %edi
+  80135c:	e8 8f 13 00 00       	call   8026f0 <strlen>
+  801361:	83 c4 10             	add    $0x10,%esp
+  801364:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801369:	0f 8f c7 00 00 00    	jg     801436 <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  80136f:	83 ec 0c             	sub    $0xc,%esp
+  801372:	57                   	push   %edi
+  801373:	e8 78 13 00 00       	call   8026f0 <strlen>
+  801378:	8d 58 04             	lea    0x4(%eax),%ebx
+  80137b:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  80137e:	83 c4 08             	add    $0x8,%esp
+  801381:	57                   	push   %edi
+  801382:	68 e4 60 80 00       	push   $0x8060e4
+  801387:	e8 9f 13 00 00       	call   80272b <strcpy>
+  req->req_nops = 2;
+  80138c:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  801393:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  801396:	c7 05 04 60 80 00 02 	movl   $0x2,0x806004
+  80139d:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  8013a0:	c7 05 10 60 80 00 00 	movl   $0x0,0x806010
+  8013a7:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  8013aa:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  8013b1:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  8013b4:	c7 05 20 60 80 00 03 	movl   $0x3,0x806020
+  8013bb:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  8013be:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  8013c5:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  8013c8:	89 1d 34 60 80 00    	mov    %ebx,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  8013ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013d3:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8013d8:	e8 32 f9 ff ff       	call   800d0f <fsipc>
+  8013dd:	83 c4 10             	add    $0x10,%esp
+  8013e0:	83 f8 01             	cmp    $0x1,%eax
+  8013e3:	7e 42                	jle    801427 <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  8013e5:	81 c3 e4 60 80 00    	add    $0x8060e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  8013eb:	83 ec 08             	sub    $0x8,%esp
+  8013ee:	53                   	push   %ebx
+  8013ef:	56                   	push   %esi
+  8013f0:	e8 36 13 00 00       	call   80272b <strcpy>
+  st->st_size = ret->ret_size;
+  8013f5:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  8013fb:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  801401:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  801407:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  80140d:	c7 86 88 00 00 00 04 	movl   $0x804004,0x88(%esi)
+  801414:	40 80 00 
+  return 0;
+  801417:	83 c4 10             	add    $0x10,%esp
+  80141a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80141f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801422:	5b                   	pop    %ebx
+  801423:	5e                   	pop    %esi
+  801424:	5f                   	pop    %edi
+  801425:	5d                   	pop    %ebp
+  801426:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  801427:	85 c0                	test   %eax,%eax
+  801429:	78 f4                	js     80141f <file_stat+0xd3>
+  80142b:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80142e:	8b 80 1c 60 80 00    	mov    0x80601c(%eax),%eax
+  801434:	eb e9                	jmp    80141f <file_stat+0xd3>
+    return -E_BAD_PATH;
+  801436:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  80143b:	eb e2                	jmp    80141f <file_stat+0xd3>
+
+0080143d <read_map>:
+{
+  80143d:	55                   	push   %ebp
+  80143e:	89 e5                	mov    %esp,%ebp
+  801440:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801443:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801446:	50                   	push   %eax
+  801447:	ff 75 08             	push   0x8(%ebp)
+  80144a:	e8 7c f2 ff ff       	call   8006cb <fd_lookup>
+  80144f:	83 c4 10             	add    $0x10,%esp
+  801452:	85 c0                	test   %eax,%eax
+  801454:	78 2a                	js     801480 <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  801456:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801459:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  80145f:	39 08                	cmp    %ecx,(%eax)
+  801461:	75 1f                	jne    801482 <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  801463:	8b 40 0c             	mov    0xc(%eax),%eax
+  801466:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read_map.req_offset = offset;
+  80146b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80146e:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  801473:	8b 55 10             	mov    0x10(%ebp),%edx
+  801476:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80147b:	e8 8f f8 ff ff       	call   800d0f <fsipc>
+}
+  801480:	c9                   	leave
+  801481:	c3                   	ret
+    return -E_INVAL;
+  801482:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801487:	eb f7                	jmp    801480 <read_map+0x43>
+
+00801489 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801489:	55                   	push   %ebp
+  80148a:	89 e5                	mov    %esp,%ebp
+  80148c:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  80148f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801494:	b8 08 00 00 00       	mov    $0x8,%eax
+  801499:	e8 71 f8 ff ff       	call   800d0f <fsipc>
+}
+  80149e:	c9                   	leave
+  80149f:	c3                   	ret
+
+008014a0 <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  8014a0:	55                   	push   %ebp
+  8014a1:	89 e5                	mov    %esp,%ebp
+  8014a3:	57                   	push   %edi
+  8014a4:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  8014a5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014a8:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.stats.req_bio_sched = 0;
+  8014ad:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  8014b4:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  8014b7:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  8014be:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  8014c1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014c6:	b8 09 00 00 00       	mov    $0x9,%eax
+  8014cb:	e8 3f f8 ff ff       	call   800d0f <fsipc>
+  8014d0:	85 c0                	test   %eax,%eax
+  8014d2:	78 14                	js     8014e8 <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  8014d4:	be 00 60 80 00       	mov    $0x806000,%esi
+  8014d9:	b9 16 00 00 00       	mov    $0x16,%ecx
+  8014de:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8014e1:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  8014e3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8014e8:	5e                   	pop    %esi
+  8014e9:	5f                   	pop    %edi
+  8014ea:	5d                   	pop    %ebp
+  8014eb:	c3                   	ret
+
+008014ec <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  8014ec:	55                   	push   %ebp
+  8014ed:	89 e5                	mov    %esp,%ebp
+  8014ef:	53                   	push   %ebx
+  8014f0:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  8014f3:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8014f6:	50                   	push   %eax
+  8014f7:	6a 00                	push   $0x0
+  8014f9:	e8 a2 ff ff ff       	call   8014a0 <fs_stats>
+  8014fe:	83 c4 10             	add    $0x10,%esp
+  801501:	85 c0                	test   %eax,%eax
+  801503:	78 28                	js     80152d <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  801505:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  801508:	83 ec 08             	sub    $0x8,%esp
+  80150b:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  80150e:	50                   	push   %eax
+  80150f:	6a 20                	push   $0x20
+  801511:	e8 8a ff ff ff       	call   8014a0 <fs_stats>
+  801516:	83 c4 10             	add    $0x10,%esp
+  801519:	85 c0                	test   %eax,%eax
+  80151b:	78 10                	js     80152d <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  80151d:	83 ec 08             	sub    $0x8,%esp
+  801520:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801523:	50                   	push   %eax
+  801524:	53                   	push   %ebx
+  801525:	e8 76 ff ff ff       	call   8014a0 <fs_stats>
+  80152a:	83 c4 10             	add    $0x10,%esp
+}
+  80152d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801530:	c9                   	leave
+  801531:	c3                   	ret
+
+00801532 <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  801532:	55                   	push   %ebp
+  801533:	89 e5                	mov    %esp,%ebp
+  801535:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  801538:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  80153f:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  801542:	8b 45 08             	mov    0x8(%ebp),%eax
+  801545:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.stats.req_dcache = 0;
+  80154a:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  801551:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  801554:	ba 00 00 00 00       	mov    $0x0,%edx
+  801559:	b8 09 00 00 00       	mov    $0x9,%eax
+  80155e:	e8 ac f7 ff ff       	call   800d0f <fsipc>
+}
+  801563:	c9                   	leave
+  801564:	c3                   	ret
+
+00801565 <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  801565:	55                   	push   %ebp
+  801566:	89 e5                	mov    %esp,%ebp
+  801568:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  80156b:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  801572:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  801575:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  80157c:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  80157f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801582:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_STATS, NULL);
+  801587:	ba 00 00 00 00       	mov    $0x0,%edx
+  80158c:	b8 09 00 00 00       	mov    $0x9,%eax
+  801591:	e8 79 f7 ff ff       	call   800d0f <fsipc>
+}
+  801596:	c9                   	leave
+  801597:	c3                   	ret
+
+00801598 <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  801598:	55                   	push   %ebp
+  801599:	89 e5                	mov    %esp,%ebp
+  80159b:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80159e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015a1:	50                   	push   %eax
+  8015a2:	ff 75 08             	push   0x8(%ebp)
+  8015a5:	e8 21 f1 ff ff       	call   8006cb <fd_lookup>
+  8015aa:	83 c4 10             	add    $0x10,%esp
+  8015ad:	85 c0                	test   %eax,%eax
+  8015af:	78 34                	js     8015e5 <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  8015b1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015b4:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  8015ba:	39 08                	cmp    %ecx,(%eax)
+  8015bc:	75 29                	jne    8015e7 <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  8015be:	8b 40 0c             	mov    0xc(%eax),%eax
+  8015c1:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.fallocate.req_offset = offset;
+  8015c6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8015c9:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.fallocate.req_len = len;
+  8015ce:	8b 45 10             	mov    0x10(%ebp),%eax
+  8015d1:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  8015d6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015db:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8015e0:	e8 2a f7 ff ff       	call   800d0f <fsipc>
+}
+  8015e5:	c9                   	leave
+  8015e6:	c3                   	ret
+    return -E_INVAL;
+  8015e7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015ec:	eb f7                	jmp    8015e5 <fallocate+0x4d>
+
+008015ee <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  8015ee:	55                   	push   %ebp
+  8015ef:	89 e5                	mov    %esp,%ebp
+  8015f1:	57                   	push   %edi
+  8015f2:	56                   	push   %esi
+  8015f3:	53                   	push   %ebx
+  8015f4:	83 ec 24             	sub    $0x24,%esp
+  8015f7:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8015fa:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8015fd:	50                   	push   %eax
+  8015fe:	ff 75 08             	push   0x8(%ebp)
+  801601:	e8 c5 f0 ff ff       	call   8006cb <fd_lookup>
+  801606:	83 c4 10             	add    $0x10,%esp
+  801609:	85 c0                	test   %eax,%eax
+  80160b:	78 66                	js     801673 <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  80160d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801610:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  801616:	39 08                	cmp    %ecx,(%eax)
+  801618:	75 61                	jne    80167b <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  80161a:	85 f6                	test   %esi,%esi
+  80161c:	7e 50                	jle    80166e <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  80161e:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  801623:	39 de                	cmp    %ebx,%esi
+  801625:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  801628:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80162b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80162e:	a3 00 60 80 00       	mov    %eax,0x806000
+    fsipcbuf.prefetch.req_n = m;
+  801633:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  801639:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  801640:	83 ec 04             	sub    $0x4,%esp
+  801643:	57                   	push   %edi
+  801644:	ff 75 0c             	push   0xc(%ebp)
+  801647:	68 08 60 80 00       	push   $0x806008
+  80164c:	e8 60 12 00 00       	call   8028b1 <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  801651:	ba 00 00 00 00       	mov    $0x0,%edx
+  801656:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80165b:	e8 af f6 ff ff       	call   800d0f <fsipc>
+  801660:	83 c4 10             	add    $0x10,%esp
+  801663:	85 c0                	test   %eax,%eax
+  801665:	78 0c                	js     801673 <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  801667:	01 7d 0c             	add    %edi,0xc(%ebp)
+  80166a:	29 de                	sub    %ebx,%esi
+  80166c:	eb ac                	jmp    80161a <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  80166e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801673:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801676:	5b                   	pop    %ebx
+  801677:	5e                   	pop    %esi
+  801678:	5f                   	pop    %edi
+  801679:	5d                   	pop    %ebp
+  80167a:	c3                   	ret
+    return -E_INVAL;
+  80167b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801680:	eb f1                	jmp    801673 <prefetch+0x85>
+
+00801682 <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  801682:	55                   	push   %ebp
+  801683:	89 e5                	mov    %esp,%ebp
+  801685:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  801688:	50                   	push   %eax
+  801689:	e8 d3 ef ff ff       	call   800661 <fd2data>
+  80168e:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  801693:	c9                   	leave
+  801694:	c3                   	ret
+
+00801695 <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  801695:	55                   	push   %ebp
+  801696:	89 e5                	mov    %esp,%ebp
+  801698:	56                   	push   %esi
+  801699:	53                   	push   %ebx
+  80169a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  80169d:	83 ec 0c             	sub    $0xc,%esp
+  8016a0:	ff 75 08             	push   0x8(%ebp)
+  8016a3:	e8 b9 ef ff ff       	call   800661 <fd2data>
+  8016a8:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  8016aa:	83 c4 08             	add    $0x8,%esp
+  8016ad:	68 70 2f 80 00       	push   $0x802f70
+  8016b2:	53                   	push   %ebx
+  8016b3:	e8 73 10 00 00       	call   80272b <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  8016b8:	8b 46 04             	mov    0x4(%esi),%eax
+  8016bb:	2b 06                	sub    (%esi),%eax
+  8016bd:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  8016c3:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8016ca:	00 00 00 
+  stat->st_dev = &devpipe;
+  8016cd:	c7 83 88 00 00 00 20 	movl   $0x804020,0x88(%ebx)
+  8016d4:	40 80 00 
+  return 0;
+}
+  8016d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016dc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016df:	5b                   	pop    %ebx
+  8016e0:	5e                   	pop    %esi
+  8016e1:	5d                   	pop    %ebp
+  8016e2:	c3                   	ret
+
+008016e3 <pipe_wakeup>:
+{
+  8016e3:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  8016e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016ea:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  8016ed:	85 c0                	test   %eax,%eax
+  8016ef:	75 01                	jne    8016f2 <pipe_wakeup+0xf>
+  8016f1:	c3                   	ret
+{
+  8016f2:	55                   	push   %ebp
+  8016f3:	89 e5                	mov    %esp,%ebp
+  8016f5:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  8016f8:	6a 00                	push   $0x0
+  8016fa:	68 00 00 c0 ee       	push   $0xeec00000
+  8016ff:	52                   	push   %edx
+  801700:	e8 f9 ed ff ff       	call   8004fe <sys_chan_wakeup>
+  801705:	83 c4 10             	add    $0x10,%esp
+}
+  801708:	c9                   	leave
+  801709:	c3                   	ret
+
+0080170a <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80170a:	55                   	push   %ebp
+  80170b:	89 e5                	mov    %esp,%ebp
+  80170d:	57                   	push   %edi
+  80170e:	56                   	push   %esi
+  80170f:	53                   	push   %ebx
+  801710:	83 ec 18             	sub    $0x18,%esp
+  801713:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  801716:	57                   	push   %edi
+  801717:	e8 45 ef ff ff       	call   800661 <fd2data>
+  80171c:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  80171e:	83 c4 10             	add    $0x10,%esp
+  801721:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  801725:	74 2a                	je     801751 <devpipe_close+0x47>
+  801727:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  80172c:	89 f8                	mov    %edi,%eax
+  80172e:	e8 4f ff ff ff       	call   801682 <pipe_ring>
+  801733:	83 ec 08             	sub    $0x8,%esp
+  801736:	01 d8                	add    %ebx,%eax
+  801738:	50                   	push   %eax
+  801739:	6a 00                	push   $0x0
+  80173b:	e8 e7 ea ff ff       	call   800227 <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  801740:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801746:	83 c4 10             	add    $0x10,%esp
+  801749:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  80174f:	75 db                	jne    80172c <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  801751:	83 ec 08             	sub    $0x8,%esp
+  801754:	57                   	push   %edi
+  801755:	6a 00                	push   $0x0
+  801757:	e8 cb ea ff ff       	call   800227 <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  80175c:	83 c4 10             	add    $0x10,%esp
+  80175f:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  801763:	75 13                	jne    801778 <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  801765:	83 ec 08             	sub    $0x8,%esp
+  801768:	56                   	push   %esi
+  801769:	6a 00                	push   $0x0
+  80176b:	e8 b7 ea ff ff       	call   800227 <sys_page_unmap>
+}
+  801770:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801773:	5b                   	pop    %ebx
+  801774:	5e                   	pop    %esi
+  801775:	5f                   	pop    %edi
+  801776:	5d                   	pop    %ebp
+  801777:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  801778:	8d 56 04             	lea    0x4(%esi),%edx
+  80177b:	8d 46 2c             	lea    0x2c(%esi),%eax
+  80177e:	e8 60 ff ff ff       	call   8016e3 <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  801783:	8d 46 30             	lea    0x30(%esi),%eax
+  801786:	89 f2                	mov    %esi,%edx
+  801788:	e8 56 ff ff ff       	call   8016e3 <pipe_wakeup>
+  80178d:	eb d6                	jmp    801765 <devpipe_close+0x5b>
+
+0080178f <_pipeisclosed>:
+{
+  80178f:	55                   	push   %ebp
+  801790:	89 e5                	mov    %esp,%ebp
+  801792:	57                   	push   %edi
+  801793:	56                   	push   %esi
+  801794:	53                   	push   %ebx
+  801795:	83 ec 1c             	sub    $0x1c,%esp
+  801798:	89 c7                	mov    %eax,%edi
+  80179a:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  80179c:	a1 44 57 80 00       	mov    0x805744,%eax
+  8017a1:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  8017a4:	83 ec 0c             	sub    $0xc,%esp
+  8017a7:	57                   	push   %edi
+  8017a8:	e8 11 14 00 00       	call   802bbe <pageref>
+  8017ad:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8017b0:	89 34 24             	mov    %esi,(%esp)
+  8017b3:	e8 06 14 00 00       	call   802bbe <pageref>
+    nn = thisenv->env_runs;
+  8017b8:	8b 15 44 57 80 00    	mov    0x805744,%edx
+  8017be:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  8017c1:	83 c4 10             	add    $0x10,%esp
+  8017c4:	39 cb                	cmp    %ecx,%ebx
+  8017c6:	74 1b                	je     8017e3 <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  8017c8:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8017cb:	75 cf                	jne    80179c <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8017cd:	8b 42 58             	mov    0x58(%edx),%eax
+  8017d0:	6a 01                	push   $0x1
+  8017d2:	50                   	push   %eax
+  8017d3:	53                   	push   %ebx
+  8017d4:	68 77 2f 80 00       	push   $0x802f77
+  8017d9:	e8 5f 09 00 00       	call   80213d <cprintf>
+  8017de:	83 c4 10             	add    $0x10,%esp
+  8017e1:	eb b9                	jmp    80179c <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  8017e3:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8017e6:	0f 94 c0             	sete   %al
+  8017e9:	0f b6 c0             	movzbl %al,%eax
+}
+  8017ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017ef:	5b                   	pop    %ebx
+  8017f0:	5e                   	pop    %esi
+  8017f1:	5f                   	pop    %edi
+  8017f2:	5d                   	pop    %ebp
+  8017f3:	c3                   	ret
+
+008017f4 <devpipe_write_bulk>:
+{
+  8017f4:	55                   	push   %ebp
+  8017f5:	89 e5                	mov    %esp,%ebp
+  8017f7:	57                   	push   %edi
+  8017f8:	56                   	push   %esi
+  8017f9:	53                   	push   %ebx
+  8017fa:	83 ec 1c             	sub    $0x1c,%esp
+  8017fd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  801800:	89 d6                	mov    %edx,%esi
+  801802:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  801805:	e8 78 fe ff ff       	call   801682 <pipe_ring>
+  80180a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  80180d:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  801812:	8d 46 04             	lea    0x4(%esi),%eax
+  801815:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  801818:	eb 75                	jmp    80188f <devpipe_write_bulk+0x9b>
+  80181a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80181f:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  801823:	6a 64                	push   $0x64
+  801825:	68 00 00 c0 ee       	push   $0xeec00000
+  80182a:	53                   	push   %ebx
+  80182b:	56                   	push   %esi
+  80182c:	e8 aa ec ff ff       	call   8004db <sys_chan_sleep>
+      continue;
+  801831:	83 c4 10             	add    $0x10,%esp
+  801834:	eb 59                	jmp    80188f <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  801836:	89 d1                	mov    %edx,%ecx
+  801838:	c1 f9 1f             	sar    $0x1f,%ecx
+  80183b:	c1 e9 11             	shr    $0x11,%ecx
+  80183e:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  801841:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  801846:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  801848:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  80184e:	29 d3                	sub    %edx,%ebx
+  801850:	ba 00 80 00 00       	mov    $0x8000,%edx
+  801855:	29 c2                	sub    %eax,%edx
+  801857:	39 d3                	cmp    %edx,%ebx
+  801859:	0f 47 da             	cmova  %edx,%ebx
+  80185c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80185f:	29 fa                	sub    %edi,%edx
+  801861:	39 d3                	cmp    %edx,%ebx
+  801863:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  801866:	83 ec 04             	sub    $0x4,%esp
+  801869:	53                   	push   %ebx
+  80186a:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80186d:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  801870:	52                   	push   %edx
+  801871:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  801874:	01 c8                	add    %ecx,%eax
+  801876:	50                   	push   %eax
+  801877:	e8 97 10 00 00       	call   802913 <memcpy>
+    i += m;
+  80187c:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  80187e:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  801881:	8d 46 2c             	lea    0x2c(%esi),%eax
+  801884:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  801887:	e8 57 fe ff ff       	call   8016e3 <pipe_wakeup>
+  80188c:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  80188f:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  801892:	73 2b                	jae    8018bf <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  801894:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  801896:	8b 56 04             	mov    0x4(%esi),%edx
+  801899:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  80189f:	39 d0                	cmp    %edx,%eax
+  8018a1:	7d 93                	jge    801836 <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  8018a3:	89 f2                	mov    %esi,%edx
+  8018a5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8018a8:	e8 e2 fe ff ff       	call   80178f <_pipeisclosed>
+  8018ad:	85 c0                	test   %eax,%eax
+  8018af:	0f 84 65 ff ff ff    	je     80181a <devpipe_write_bulk+0x26>
+        return i;
+  8018b5:	89 f8                	mov    %edi,%eax
+}
+  8018b7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018ba:	5b                   	pop    %ebx
+  8018bb:	5e                   	pop    %esi
+  8018bc:	5f                   	pop    %edi
+  8018bd:	5d                   	pop    %ebp
+  8018be:	c3                   	ret
+  return i;
+  8018bf:	89 f8                	mov    %edi,%eax
+  8018c1:	eb f4                	jmp    8018b7 <devpipe_write_bulk+0xc3>
+
+008018c3 <devpipe_write>:
+{
+  8018c3:	55                   	push   %ebp
+  8018c4:	89 e5                	mov    %esp,%ebp
+  8018c6:	57                   	push   %edi
+  8018c7:	56                   	push   %esi
+  8018c8:	53                   	push   %ebx
+  8018c9:	83 ec 28             	sub    $0x28,%esp
+  8018cc:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  8018cf:	56                   	push   %esi
+  8018d0:	e8 8c ed ff ff       	call   800661 <fd2data>
+  8018d5:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  8018d7:	8b 78 28             	mov    0x28(%eax),%edi
+  8018da:	83 c4 10             	add    $0x10,%esp
+  8018dd:	85 ff                	test   %edi,%edi
+  8018df:	75 25                	jne    801906 <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  8018e1:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8018e4:	74 66                	je     80194c <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8018e6:	8b 43 04             	mov    0x4(%ebx),%eax
+  8018e9:	8b 0b                	mov    (%ebx),%ecx
+  8018eb:	8d 51 20             	lea    0x20(%ecx),%edx
+  8018ee:	39 d0                	cmp    %edx,%eax
+  8018f0:	72 2b                	jb     80191d <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  8018f2:	89 da                	mov    %ebx,%edx
+  8018f4:	89 f0                	mov    %esi,%eax
+  8018f6:	e8 94 fe ff ff       	call   80178f <_pipeisclosed>
+  8018fb:	85 c0                	test   %eax,%eax
+  8018fd:	75 51                	jne    801950 <devpipe_write+0x8d>
+      sys_yield();
+  8018ff:	e8 3c e8 ff ff       	call   800140 <sys_yield>
+  801904:	eb e0                	jmp    8018e6 <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  801906:	83 ec 0c             	sub    $0xc,%esp
+  801909:	ff 75 10             	push   0x10(%ebp)
+  80190c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80190f:	89 c2                	mov    %eax,%edx
+  801911:	89 f0                	mov    %esi,%eax
+  801913:	e8 dc fe ff ff       	call   8017f4 <devpipe_write_bulk>
+  801918:	83 c4 10             	add    $0x10,%esp
+  80191b:	eb 38                	jmp    801955 <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80191d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801920:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  801924:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  801927:	89 c2                	mov    %eax,%edx
+  801929:	c1 fa 1f             	sar    $0x1f,%edx
+  80192c:	89 d1                	mov    %edx,%ecx
+  80192e:	c1 e9 1b             	shr    $0x1b,%ecx
+  801931:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  801934:	83 e2 1f             	and    $0x1f,%edx
+  801937:	29 ca                	sub    %ecx,%edx
+  801939:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  80193d:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  801941:	83 c0 01             	add    $0x1,%eax
+  801944:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  801947:	83 c7 01             	add    $0x1,%edi
+  80194a:	eb 95                	jmp    8018e1 <devpipe_write+0x1e>
+  return i;
+  80194c:	89 f8                	mov    %edi,%eax
+  80194e:	eb 05                	jmp    801955 <devpipe_write+0x92>
+        return 0;
+  801950:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801955:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801958:	5b                   	pop    %ebx
+  801959:	5e                   	pop    %esi
+  80195a:	5f                   	pop    %edi
+  80195b:	5d                   	pop    %ebp
+  80195c:	c3                   	ret
+
+0080195d <devpipe_read_bulk>:
+{
+  80195d:	55                   	push   %ebp
+  80195e:	89 e5                	mov    %esp,%ebp
+  801960:	57                   	push   %edi
+  801961:	56                   	push   %esi
+  801962:	53                   	push   %ebx
+  801963:	83 ec 2c             	sub    $0x2c,%esp
+  801966:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  801969:	89 d6                	mov    %edx,%esi
+  80196b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80196e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  801971:	e8 0c fd ff ff       	call   801682 <pipe_ring>
+  801976:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  801979:	85 db                	test   %ebx,%ebx
+  80197b:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801980:	0f 45 c3             	cmovne %ebx,%eax
+  801983:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801986:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  80198b:	8d 46 30             	lea    0x30(%esi),%eax
+  80198e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  801991:	eb 50                	jmp    8019e3 <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  801993:	89 d1                	mov    %edx,%ecx
+  801995:	c1 f9 1f             	sar    $0x1f,%ecx
+  801998:	c1 e9 11             	shr    $0x11,%ecx
+  80199b:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  80199e:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8019a3:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  8019a5:	29 d3                	sub    %edx,%ebx
+  8019a7:	ba 00 80 00 00       	mov    $0x8000,%edx
+  8019ac:	29 c2                	sub    %eax,%edx
+  8019ae:	39 d3                	cmp    %edx,%ebx
+  8019b0:	0f 47 da             	cmova  %edx,%ebx
+  8019b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8019b6:	29 fa                	sub    %edi,%edx
+  8019b8:	39 d3                	cmp    %edx,%ebx
+  8019ba:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  8019bd:	83 ec 04             	sub    $0x4,%esp
+  8019c0:	53                   	push   %ebx
+  8019c1:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8019c4:	01 c8                	add    %ecx,%eax
+  8019c6:	50                   	push   %eax
+  8019c7:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8019ca:	01 f8                	add    %edi,%eax
+  8019cc:	50                   	push   %eax
+  8019cd:	e8 41 0f 00 00       	call   802913 <memcpy>
+    i += m;
+  8019d2:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  8019d4:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8019d6:	89 f2                	mov    %esi,%edx
+  8019d8:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8019db:	e8 03 fd ff ff       	call   8016e3 <pipe_wakeup>
+  8019e0:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  8019e3:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  8019e6:	73 51                	jae    801a39 <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  8019e8:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  8019eb:	8b 16                	mov    (%esi),%edx
+  8019ed:	39 da                	cmp    %ebx,%edx
+  8019ef:	75 a2                	jne    801993 <devpipe_read_bulk+0x36>
+      if (i > 0)
+  8019f1:	85 ff                	test   %edi,%edi
+  8019f3:	75 44                	jne    801a39 <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  8019f5:	89 f2                	mov    %esi,%edx
+  8019f7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8019fa:	e8 90 fd ff ff       	call   80178f <_pipeisclosed>
+  8019ff:	85 c0                	test   %eax,%eax
+  801a01:	75 3a                	jne    801a3d <devpipe_read_bulk+0xe0>
+  801a03:	b8 01 00 00 00       	mov    $0x1,%eax
+  801a08:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  801a0c:	6a 64                	push   $0x64
+  801a0e:	ff 75 d4             	push   -0x2c(%ebp)
+  801a11:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  801a12:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  801a15:	50                   	push   %eax
+  801a16:	e8 c0 ea ff ff       	call   8004db <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  801a1b:	85 c0                	test   %eax,%eax
+  801a1d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a22:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  801a25:	83 c4 10             	add    $0x10,%esp
+  801a28:	a8 01                	test   $0x1,%al
+  801a2a:	74 b7                	je     8019e3 <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  801a2c:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  801a31:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a34:	5b                   	pop    %ebx
+  801a35:	5e                   	pop    %esi
+  801a36:	5f                   	pop    %edi
+  801a37:	5d                   	pop    %ebp
+  801a38:	c3                   	ret
+  return i;
+  801a39:	89 f8                	mov    %edi,%eax
+  801a3b:	eb f4                	jmp    801a31 <devpipe_read_bulk+0xd4>
+        return 0;
+  801a3d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a42:	eb ed                	jmp    801a31 <devpipe_read_bulk+0xd4>
+
+00801a44 <devpipe_read>:
+{
+  801a44:	55                   	push   %ebp
+  801a45:	89 e5                	mov    %esp,%ebp
+  801a47:	57                   	push   %edi
+  801a48:	56                   	push   %esi
+  801a49:	53                   	push   %ebx
+  801a4a:	83 ec 18             	sub    $0x18,%esp
+  801a4d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  801a50:	57                   	push   %edi
+  801a51:	e8 0b ec ff ff       	call   800661 <fd2data>
+  801a56:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  801a58:	8b 70 28             	mov    0x28(%eax),%esi
+  801a5b:	83 c4 10             	add    $0x10,%esp
+  801a5e:	85 f6                	test   %esi,%esi
+  801a60:	75 24                	jne    801a86 <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  801a62:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801a65:	74 60                	je     801ac7 <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  801a67:	8b 03                	mov    (%ebx),%eax
+  801a69:	3b 43 04             	cmp    0x4(%ebx),%eax
+  801a6c:	75 3b                	jne    801aa9 <devpipe_read+0x65>
+      if (i > 0)
+  801a6e:	85 f6                	test   %esi,%esi
+  801a70:	75 2d                	jne    801a9f <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  801a72:	89 da                	mov    %ebx,%edx
+  801a74:	89 f8                	mov    %edi,%eax
+  801a76:	e8 14 fd ff ff       	call   80178f <_pipeisclosed>
+  801a7b:	85 c0                	test   %eax,%eax
+  801a7d:	75 4c                	jne    801acb <devpipe_read+0x87>
+      sys_yield();
+  801a7f:	e8 bc e6 ff ff       	call   800140 <sys_yield>
+  801a84:	eb e1                	jmp    801a67 <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  801a86:	83 ec 08             	sub    $0x8,%esp
+  801a89:	6a 00                	push   $0x0
+  801a8b:	ff 75 10             	push   0x10(%ebp)
+  801a8e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801a91:	89 c2                	mov    %eax,%edx
+  801a93:	89 f8                	mov    %edi,%eax
+  801a95:	e8 c3 fe ff ff       	call   80195d <devpipe_read_bulk>
+  801a9a:	83 c4 10             	add    $0x10,%esp
+  801a9d:	eb 02                	jmp    801aa1 <devpipe_read+0x5d>
+        return i;
+  801a9f:	89 f0                	mov    %esi,%eax
+}
+  801aa1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801aa4:	5b                   	pop    %ebx
+  801aa5:	5e                   	pop    %esi
+  801aa6:	5f                   	pop    %edi
+  801aa7:	5d                   	pop    %ebp
+  801aa8:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  801aa9:	99                   	cltd
+  801aaa:	c1 ea 1b             	shr    $0x1b,%edx
+  801aad:	01 d0                	add    %edx,%eax
+  801aaf:	83 e0 1f             	and    $0x1f,%eax
+  801ab2:	29 d0                	sub    %edx,%eax
+  801ab4:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  801ab9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801abc:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  801abf:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  801ac2:	83 c6 01             	add    $0x1,%esi
+  801ac5:	eb 9b                	jmp    801a62 <devpipe_read+0x1e>
+  return i;
+  801ac7:	89 f0                	mov    %esi,%eax
+  801ac9:	eb d6                	jmp    801aa1 <devpipe_read+0x5d>
+        return 0;
+  801acb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ad0:	eb cf                	jmp    801aa1 <devpipe_read+0x5d>
+
+00801ad2 <pipe2>:
+{
+  801ad2:	55                   	push   %ebp
+  801ad3:	89 e5                	mov    %esp,%ebp
+  801ad5:	57                   	push   %edi
+  801ad6:	56                   	push   %esi
+  801ad7:	53                   	push   %ebx
+  801ad8:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  801adb:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801ade:	50                   	push   %eax
+  801adf:	e8 91 eb ff ff       	call   800675 <fd_alloc>
+  801ae4:	89 c3                	mov    %eax,%ebx
+  801ae6:	83 c4 10             	add    $0x10,%esp
+  801ae9:	85 c0                	test   %eax,%eax
+  801aeb:	0f 88 fb 01 00 00    	js     801cec <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801af1:	83 ec 04             	sub    $0x4,%esp
+  801af4:	68 07 04 00 00       	push   $0x407
+  801af9:	ff 75 e4             	push   -0x1c(%ebp)
+  801afc:	6a 00                	push   $0x0
+  801afe:	e8 9f e6 ff ff       	call   8001a2 <sys_page_alloc>
+  801b03:	89 c3                	mov    %eax,%ebx
+  801b05:	83 c4 10             	add    $0x10,%esp
+  801b08:	85 c0                	test   %eax,%eax
+  801b0a:	0f 88 dc 01 00 00    	js     801cec <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  801b10:	83 ec 0c             	sub    $0xc,%esp
+  801b13:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801b16:	50                   	push   %eax
+  801b17:	e8 59 eb ff ff       	call   800675 <fd_alloc>
+  801b1c:	89 c3                	mov    %eax,%ebx
+  801b1e:	83 c4 10             	add    $0x10,%esp
+  801b21:	85 c0                	test   %eax,%eax
+  801b23:	0f 88 b3 01 00 00    	js     801cdc <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801b29:	83 ec 04             	sub    $0x4,%esp
+  801b2c:	68 07 04 00 00       	push   $0x407
+  801b31:	ff 75 e0             	push   -0x20(%ebp)
+  801b34:	6a 00                	push   $0x0
+  801b36:	e8 67 e6 ff ff       	call   8001a2 <sys_page_alloc>
+  801b3b:	89 c3                	mov    %eax,%ebx
+  801b3d:	83 c4 10             	add    $0x10,%esp
+  801b40:	85 c0                	test   %eax,%eax
+  801b42:	0f 88 94 01 00 00    	js     801cdc <pipe2+0x20a>
+  va = fd2data(fd0);
+  801b48:	83 ec 0c             	sub    $0xc,%esp
+  801b4b:	ff 75 e4             	push   -0x1c(%ebp)
+  801b4e:	e8 0e eb ff ff       	call   800661 <fd2data>
+  801b53:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801b55:	83 c4 0c             	add    $0xc,%esp
+  801b58:	68 07 04 00 00       	push   $0x407
+  801b5d:	50                   	push   %eax
+  801b5e:	6a 00                	push   $0x0
+  801b60:	e8 3d e6 ff ff       	call   8001a2 <sys_page_alloc>
+  801b65:	89 c3                	mov    %eax,%ebx
+  801b67:	83 c4 10             	add    $0x10,%esp
+  801b6a:	85 c0                	test   %eax,%eax
+  801b6c:	0f 88 5a 01 00 00    	js     801ccc <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  801b72:	83 ec 0c             	sub    $0xc,%esp
+  801b75:	ff 75 e0             	push   -0x20(%ebp)
+  801b78:	e8 e4 ea ff ff       	call   800661 <fd2data>
+  801b7d:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  801b84:	50                   	push   %eax
+  801b85:	6a 00                	push   $0x0
+  801b87:	57                   	push   %edi
+  801b88:	6a 00                	push   $0x0
+  801b8a:	e8 56 e6 ff ff       	call   8001e5 <sys_page_map>
+  801b8f:	89 c3                	mov    %eax,%ebx
+  801b91:	83 c4 20             	add    $0x20,%esp
+  801b94:	85 c0                	test   %eax,%eax
+  801b96:	0f 88 22 01 00 00    	js     801cbe <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  801b9c:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  801ba0:	74 72                	je     801c14 <pipe2+0x142>
+  801ba2:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  801ba7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801baa:	e8 d3 fa ff ff       	call   801682 <pipe_ring>
+  801baf:	83 ec 04             	sub    $0x4,%esp
+  801bb2:	68 07 04 00 00       	push   $0x407
+  801bb7:	01 f0                	add    %esi,%eax
+  801bb9:	50                   	push   %eax
+  801bba:	6a 00                	push   $0x0
+  801bbc:	e8 e1 e5 ff ff       	call   8001a2 <sys_page_alloc>
+  801bc1:	89 c3                	mov    %eax,%ebx
+  801bc3:	83 c4 10             	add    $0x10,%esp
+  801bc6:	85 c0                	test   %eax,%eax
+  801bc8:	0f 88 97 00 00 00    	js     801c65 <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  801bce:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801bd1:	e8 ac fa ff ff       	call   801682 <pipe_ring>
+  801bd6:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  801bd9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801bdc:	e8 a1 fa ff ff       	call   801682 <pipe_ring>
+  801be1:	83 ec 0c             	sub    $0xc,%esp
+  801be4:	68 07 04 00 00       	push   $0x407
+  801be9:	53                   	push   %ebx
+  801bea:	6a 00                	push   $0x0
+  801bec:	01 f0                	add    %esi,%eax
+  801bee:	50                   	push   %eax
+  801bef:	6a 00                	push   $0x0
+  801bf1:	e8 ef e5 ff ff       	call   8001e5 <sys_page_map>
+  801bf6:	89 c3                	mov    %eax,%ebx
+  801bf8:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801bfe:	83 c4 20             	add    $0x20,%esp
+  801c01:	85 c0                	test   %eax,%eax
+  801c03:	78 60                	js     801c65 <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  801c05:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  801c0b:	75 9a                	jne    801ba7 <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  801c0d:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  801c14:	a1 20 40 80 00       	mov    0x804020,%eax
+  801c19:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801c1c:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  801c1e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801c21:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  801c28:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  801c2b:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  801c2d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801c30:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  801c37:	83 ec 0c             	sub    $0xc,%esp
+  801c3a:	ff 75 e4             	push   -0x1c(%ebp)
+  801c3d:	e8 0f ea ff ff       	call   800651 <fd2num>
+  801c42:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801c45:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  801c47:	83 c4 04             	add    $0x4,%esp
+  801c4a:	ff 75 e0             	push   -0x20(%ebp)
+  801c4d:	e8 ff e9 ff ff       	call   800651 <fd2num>
+  801c52:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  801c55:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  801c58:	83 c4 10             	add    $0x10,%esp
+  801c5b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c60:	e9 87 00 00 00       	jmp    801cec <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  801c65:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  801c6a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801c6d:	e8 10 fa ff ff       	call   801682 <pipe_ring>
+  801c72:	83 ec 08             	sub    $0x8,%esp
+  801c75:	01 f0                	add    %esi,%eax
+  801c77:	50                   	push   %eax
+  801c78:	6a 00                	push   $0x0
+  801c7a:	e8 a8 e5 ff ff       	call   800227 <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  801c7f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801c82:	e8 fb f9 ff ff       	call   801682 <pipe_ring>
+  801c87:	83 c4 08             	add    $0x8,%esp
+  801c8a:	01 f0                	add    %esi,%eax
+  801c8c:	50                   	push   %eax
+  801c8d:	6a 00                	push   $0x0
+  801c8f:	e8 93 e5 ff ff       	call   800227 <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  801c94:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801c9a:	83 c4 10             	add    $0x10,%esp
+  801c9d:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  801ca3:	75 c5                	jne    801c6a <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  801ca5:	83 ec 0c             	sub    $0xc,%esp
+  801ca8:	ff 75 e0             	push   -0x20(%ebp)
+  801cab:	e8 b1 e9 ff ff       	call   800661 <fd2data>
+  801cb0:	83 c4 08             	add    $0x8,%esp
+  801cb3:	50                   	push   %eax
+  801cb4:	6a 00                	push   $0x0
+  801cb6:	e8 6c e5 ff ff       	call   800227 <sys_page_unmap>
+  801cbb:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  801cbe:	83 ec 08             	sub    $0x8,%esp
+  801cc1:	57                   	push   %edi
+  801cc2:	6a 00                	push   $0x0
+  801cc4:	e8 5e e5 ff ff       	call   800227 <sys_page_unmap>
+  801cc9:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  801ccc:	83 ec 08             	sub    $0x8,%esp
+  801ccf:	ff 75 e0             	push   -0x20(%ebp)
+  801cd2:	6a 00                	push   $0x0
+  801cd4:	e8 4e e5 ff ff       	call   800227 <sys_page_unmap>
+  801cd9:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  801cdc:	83 ec 08             	sub    $0x8,%esp
+  801cdf:	ff 75 e4             	push   -0x1c(%ebp)
+  801ce2:	6a 00                	push   $0x0
+  801ce4:	e8 3e e5 ff ff       	call   800227 <sys_page_unmap>
+  801ce9:	83 c4 10             	add    $0x10,%esp
+}
+  801cec:	89 d8                	mov    %ebx,%eax
+  801cee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801cf1:	5b                   	pop    %ebx
+  801cf2:	5e                   	pop    %esi
+  801cf3:	5f                   	pop    %edi
+  801cf4:	5d                   	pop    %ebp
+  801cf5:	c3                   	ret
+
+00801cf6 <pipe>:
+{
+  801cf6:	55                   	push   %ebp
+  801cf7:	89 e5                	mov    %esp,%ebp
+  801cf9:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  801cfc:	6a 00                	push   $0x0
+  801cfe:	ff 75 08             	push   0x8(%ebp)
+  801d01:	e8 cc fd ff ff       	call   801ad2 <pipe2>
+}
+  801d06:	c9                   	leave
+  801d07:	c3                   	ret
+
+00801d08 <pipeisclosed>:
+{
+  801d08:	55                   	push   %ebp
+  801d09:	89 e5                	mov    %esp,%ebp
+  801d0b:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801d0e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d11:	50                   	push   %eax
+  801d12:	ff 75 08             	push   0x8(%ebp)
+  801d15:	e8 b1 e9 ff ff       	call   8006cb <fd_lookup>
+  801d1a:	83 c4 10             	add    $0x10,%esp
+  801d1d:	85 c0                	test   %eax,%eax
+  801d1f:	78 18                	js     801d39 <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  801d21:	83 ec 0c             	sub    $0xc,%esp
+  801d24:	ff 75 f4             	push   -0xc(%ebp)
+  801d27:	e8 35 e9 ff ff       	call   800661 <fd2data>
+  801d2c:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  801d2e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d31:	e8 59 fa ff ff       	call   80178f <_pipeisclosed>
+  801d36:	83 c4 10             	add    $0x10,%esp
+}
+  801d39:	c9                   	leave
+  801d3a:	c3                   	ret
+
+00801d3b <pipe_splice>:
+{
+  801d3b:	55                   	push   %ebp
+  801d3c:	89 e5                	mov    %esp,%ebp
+  801d3e:	57                   	push   %edi
+  801d3f:	56                   	push   %esi
+  801d40:	53                   	push   %ebx
+  801d41:	83 ec 34             	sub    $0x34,%esp
+  801d44:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801d47:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801d4a:	50                   	push   %eax
+  801d4b:	ff 75 08             	push   0x8(%ebp)
+  801d4e:	e8 78 e9 ff ff       	call   8006cb <fd_lookup>
+  801d53:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801d56:	83 c4 10             	add    $0x10,%esp
+  801d59:	85 c0                	test   %eax,%eax
+  801d5b:	0f 88 d7 00 00 00    	js     801e38 <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  801d61:	83 ec 0c             	sub    $0xc,%esp
+  801d64:	ff 75 e4             	push   -0x1c(%ebp)
+  801d67:	e8 f5 e8 ff ff       	call   800661 <fd2data>
+  801d6c:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  801d6e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801d71:	83 c4 10             	add    $0x10,%esp
+  801d74:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  801d7a:	39 10                	cmp    %edx,(%eax)
+  801d7c:	0f 85 c1 00 00 00    	jne    801e43 <pipe_splice+0x108>
+  801d82:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  801d86:	0f 84 c0 00 00 00    	je     801e4c <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  801d8c:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  801d90:	0f 84 bf 00 00 00    	je     801e55 <pipe_splice+0x11a>
+  801d96:	89 f7                	mov    %esi,%edi
+  801d98:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  801d9e:	0f 85 ba 00 00 00    	jne    801e5e <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  801da4:	8d 43 04             	lea    0x4(%ebx),%eax
+  801da7:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801daa:	eb 38                	jmp    801de4 <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  801dac:	83 ec 0c             	sub    $0xc,%esp
+  801daf:	68 00 10 00 00       	push   $0x1000
+  801db4:	89 f1                	mov    %esi,%ecx
+  801db6:	89 da                	mov    %ebx,%edx
+  801db8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801dbb:	e8 34 fa ff ff       	call   8017f4 <devpipe_write_bulk>
+  801dc0:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801dc3:	83 c4 10             	add    $0x10,%esp
+  801dc6:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801dcb:	75 53                	jne    801e20 <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  801dcd:	83 ec 08             	sub    $0x8,%esp
+  801dd0:	56                   	push   %esi
+  801dd1:	6a 00                	push   $0x0
+  801dd3:	e8 4f e4 ff ff       	call   800227 <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  801dd8:	83 c7 01             	add    $0x1,%edi
+  801ddb:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801de1:	83 c4 10             	add    $0x10,%esp
+  801de4:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  801de7:	74 3a                	je     801e23 <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  801de9:	8b 03                	mov    (%ebx),%eax
+  801deb:	39 43 04             	cmp    %eax,0x4(%ebx)
+  801dee:	75 bc                	jne    801dac <pipe_splice+0x71>
+  801df0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801df5:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  801df9:	85 c0                	test   %eax,%eax
+  801dfb:	74 af                	je     801dac <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  801dfd:	83 ec 04             	sub    $0x4,%esp
+  801e00:	6a 07                	push   $0x7
+  801e02:	56                   	push   %esi
+  801e03:	ff 75 d0             	push   -0x30(%ebp)
+  801e06:	e8 f3 e6 ff ff       	call   8004fe <sys_chan_wakeup>
+  801e0b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801e0e:	83 c4 10             	add    $0x10,%esp
+  801e11:	85 c0                	test   %eax,%eax
+  801e13:	79 b8                	jns    801dcd <pipe_splice+0x92>
+  801e15:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e1a:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  801e1e:	eb 8c                	jmp    801dac <pipe_splice+0x71>
+  801e20:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  801e23:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801e27:	75 06                	jne    801e2f <pipe_splice+0xf4>
+  801e29:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  801e2d:	78 09                	js     801e38 <pipe_splice+0xfd>
+  return i * PGSIZE;
+  801e2f:	8b 45 10             	mov    0x10(%ebp),%eax
+  801e32:	c1 e0 0c             	shl    $0xc,%eax
+  801e35:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  801e38:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801e3b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e3e:	5b                   	pop    %ebx
+  801e3f:	5e                   	pop    %esi
+  801e40:	5f                   	pop    %edi
+  801e41:	5d                   	pop    %ebp
+  801e42:	c3                   	ret
+    return -E_INVAL;
+  801e43:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  801e4a:	eb ec                	jmp    801e38 <pipe_splice+0xfd>
+  801e4c:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  801e53:	eb e3                	jmp    801e38 <pipe_splice+0xfd>
+  801e55:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  801e5c:	eb da                	jmp    801e38 <pipe_splice+0xfd>
+  801e5e:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  801e65:	eb d1                	jmp    801e38 <pipe_splice+0xfd>
+
+00801e67 <pipe_splice_read>:
+{
+  801e67:	55                   	push   %ebp
+  801e68:	89 e5                	mov    %esp,%ebp
+  801e6a:	53                   	push   %ebx
+  801e6b:	83 ec 1c             	sub    $0x1c,%esp
+  801e6e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801e71:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e74:	50                   	push   %eax
+  801e75:	ff 75 08             	push   0x8(%ebp)
+  801e78:	e8 4e e8 ff ff       	call   8006cb <fd_lookup>
+  801e7d:	83 c4 10             	add    $0x10,%esp
+  801e80:	85 c0                	test   %eax,%eax
+  801e82:	78 49                	js     801ecd <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  801e84:	83 ec 0c             	sub    $0xc,%esp
+  801e87:	ff 75 f4             	push   -0xc(%ebp)
+  801e8a:	e8 d2 e7 ff ff       	call   800661 <fd2data>
+  801e8f:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  801e91:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e94:	83 c4 10             	add    $0x10,%esp
+  801e97:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  801e9d:	39 08                	cmp    %ecx,(%eax)
+  801e9f:	75 31                	jne    801ed2 <pipe_splice_read+0x6b>
+  801ea1:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  801ea5:	74 32                	je     801ed9 <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  801ea7:	8b 48 08             	mov    0x8(%eax),%ecx
+  801eaa:	83 e1 03             	and    $0x3,%ecx
+  801ead:	83 f9 01             	cmp    $0x1,%ecx
+  801eb0:	74 2e                	je     801ee0 <pipe_splice_read+0x79>
+  801eb2:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  801eb8:	75 2d                	jne    801ee7 <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  801eba:	83 ec 08             	sub    $0x8,%esp
+  801ebd:	53                   	push   %ebx
+  801ebe:	68 00 10 00 00       	push   $0x1000
+  801ec3:	89 d9                	mov    %ebx,%ecx
+  801ec5:	e8 93 fa ff ff       	call   80195d <devpipe_read_bulk>
+  801eca:	83 c4 10             	add    $0x10,%esp
+}
+  801ecd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ed0:	c9                   	leave
+  801ed1:	c3                   	ret
+    return -E_INVAL;
+  801ed2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ed7:	eb f4                	jmp    801ecd <pipe_splice_read+0x66>
+  801ed9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ede:	eb ed                	jmp    801ecd <pipe_splice_read+0x66>
+  801ee0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ee5:	eb e6                	jmp    801ecd <pipe_splice_read+0x66>
+  801ee7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801eec:	eb df                	jmp    801ecd <pipe_splice_read+0x66>
+
+00801eee <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  801eee:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ef3:	c3                   	ret
+
+00801ef4 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  801ef4:	55                   	push   %ebp
+  801ef5:	89 e5                	mov    %esp,%ebp
+  801ef7:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  801efa:	68 8f 2f 80 00       	push   $0x802f8f
+  801eff:	ff 75 0c             	push   0xc(%ebp)
+  801f02:	e8 24 08 00 00       	call   80272b <strcpy>
+  return 0;
+}
+  801f07:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f0c:	c9                   	leave
+  801f0d:	c3                   	ret
+
+00801f0e <devcons_write>:
+{
+  801f0e:	55                   	push   %ebp
+  801f0f:	89 e5                	mov    %esp,%ebp
+  801f11:	57                   	push   %edi
+  801f12:	56                   	push   %esi
+  801f13:	53                   	push   %ebx
+  801f14:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  801f1a:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  801f1f:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  801f25:	eb 2e                	jmp    801f55 <devcons_write+0x47>
+    m = n - tot;
+  801f27:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801f2a:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  801f2c:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  801f31:	39 c3                	cmp    %eax,%ebx
+  801f33:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  801f36:	83 ec 04             	sub    $0x4,%esp
+  801f39:	53                   	push   %ebx
+  801f3a:	89 f0                	mov    %esi,%eax
+  801f3c:	03 45 0c             	add    0xc(%ebp),%eax
+  801f3f:	50                   	push   %eax
+  801f40:	57                   	push   %edi
+  801f41:	e8 6b 09 00 00       	call   8028b1 <memmove>
+    sys_cputs(buf, m);
+  801f46:	83 c4 08             	add    $0x8,%esp
+  801f49:	53                   	push   %ebx
+  801f4a:	57                   	push   %edi
+  801f4b:	e8 53 e1 ff ff       	call   8000a3 <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  801f50:	01 de                	add    %ebx,%esi
+  801f52:	83 c4 10             	add    $0x10,%esp
+  801f55:	3b 75 10             	cmp    0x10(%ebp),%esi
+  801f58:	72 cd                	jb     801f27 <devcons_write+0x19>
+}
+  801f5a:	89 f0                	mov    %esi,%eax
+  801f5c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f5f:	5b                   	pop    %ebx
+  801f60:	5e                   	pop    %esi
+  801f61:	5f                   	pop    %edi
+  801f62:	5d                   	pop    %ebp
+  801f63:	c3                   	ret
+
+00801f64 <devcons_read>:
+{
+  801f64:	55                   	push   %ebp
+  801f65:	89 e5                	mov    %esp,%ebp
+  801f67:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  801f6a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f6f:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  801f73:	75 07                	jne    801f7c <devcons_read+0x18>
+  801f75:	eb 1f                	jmp    801f96 <devcons_read+0x32>
+    sys_yield();
+  801f77:	e8 c4 e1 ff ff       	call   800140 <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  801f7c:	e8 40 e1 ff ff       	call   8000c1 <sys_cgetc>
+  801f81:	85 c0                	test   %eax,%eax
+  801f83:	74 f2                	je     801f77 <devcons_read+0x13>
+  if (c < 0)
+  801f85:	78 0f                	js     801f96 <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  801f87:	83 f8 04             	cmp    $0x4,%eax
+  801f8a:	74 0c                	je     801f98 <devcons_read+0x34>
+  *(char*)vbuf = c;
+  801f8c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801f8f:	88 02                	mov    %al,(%edx)
+  return 1;
+  801f91:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  801f96:	c9                   	leave
+  801f97:	c3                   	ret
+    return 0;
+  801f98:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f9d:	eb f7                	jmp    801f96 <devcons_read+0x32>
+
+00801f9f <cputchar>:
+{
+  801f9f:	55                   	push   %ebp
+  801fa0:	89 e5                	mov    %esp,%ebp
+  801fa2:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  801fa5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fa8:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  801fab:	6a 01                	push   $0x1
+  801fad:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801fb0:	50                   	push   %eax
+  801fb1:	e8 ed e0 ff ff       	call   8000a3 <sys_cputs>
+}
+  801fb6:	83 c4 10             	add    $0x10,%esp
+  801fb9:	c9                   	leave
+  801fba:	c3                   	ret
+
+00801fbb <getchar>:
+{
+  801fbb:	55                   	push   %ebp
+  801fbc:	89 e5                	mov    %esp,%ebp
+  801fbe:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  801fc1:	6a 01                	push   $0x1
+  801fc3:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  801fc6:	50                   	push   %eax
+  801fc7:	6a 00                	push   $0x0
+  801fc9:	e8 a8 e9 ff ff       	call   800976 <read>
+  if (r < 0)
+  801fce:	83 c4 10             	add    $0x10,%esp
+  801fd1:	85 c0                	test   %eax,%eax
+  801fd3:	78 06                	js     801fdb <getchar+0x20>
+  if (r < 1)
+  801fd5:	74 06                	je     801fdd <getchar+0x22>
+  return c;
+  801fd7:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  801fdb:	c9                   	leave
+  801fdc:	c3                   	ret
+    return -E_EOF;
+  801fdd:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  801fe2:	eb f7                	jmp    801fdb <getchar+0x20>
+
+00801fe4 <iscons>:
+{
+  801fe4:	55                   	push   %ebp
+  801fe5:	89 e5                	mov    %esp,%ebp
+  801fe7:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801fea:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fed:	50                   	push   %eax
+  801fee:	ff 75 08             	push   0x8(%ebp)
+  801ff1:	e8 d5 e6 ff ff       	call   8006cb <fd_lookup>
+  801ff6:	83 c4 10             	add    $0x10,%esp
+  801ff9:	85 c0                	test   %eax,%eax
+  801ffb:	78 11                	js     80200e <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  801ffd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802000:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802006:	39 10                	cmp    %edx,(%eax)
+  802008:	0f 94 c0             	sete   %al
+  80200b:	0f b6 c0             	movzbl %al,%eax
+}
+  80200e:	c9                   	leave
+  80200f:	c3                   	ret
+
+00802010 <opencons>:
+{
+  802010:	55                   	push   %ebp
+  802011:	89 e5                	mov    %esp,%ebp
+  802013:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  802016:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802019:	50                   	push   %eax
+  80201a:	e8 56 e6 ff ff       	call   800675 <fd_alloc>
+  80201f:	83 c4 10             	add    $0x10,%esp
+  802022:	85 c0                	test   %eax,%eax
+  802024:	78 3a                	js     802060 <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802026:	83 ec 04             	sub    $0x4,%esp
+  802029:	68 07 04 00 00       	push   $0x407
+  80202e:	ff 75 f4             	push   -0xc(%ebp)
+  802031:	6a 00                	push   $0x0
+  802033:	e8 6a e1 ff ff       	call   8001a2 <sys_page_alloc>
+  802038:	83 c4 10             	add    $0x10,%esp
+  80203b:	85 c0                	test   %eax,%eax
+  80203d:	78 21                	js     802060 <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  80203f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802042:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802048:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  80204a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80204d:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  802054:	83 ec 0c             	sub    $0xc,%esp
+  802057:	50                   	push   %eax
+  802058:	e8 f4 e5 ff ff       	call   800651 <fd2num>
+  80205d:	83 c4 10             	add    $0x10,%esp
+}
+  802060:	c9                   	leave
+  802061:	c3                   	ret
+
+00802062 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  802062:	55                   	push   %ebp
+  802063:	89 e5                	mov    %esp,%ebp
+  802065:	56                   	push   %esi
+  802066:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  802067:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  80206a:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  802070:	e8 ac e0 ff ff       	call   800121 <sys_getenvid>
+  802075:	83 ec 0c             	sub    $0xc,%esp
+  802078:	ff 75 0c             	push   0xc(%ebp)
+  80207b:	ff 75 08             	push   0x8(%ebp)
+  80207e:	56                   	push   %esi
+  80207f:	50                   	push   %eax
+  802080:	68 9c 2f 80 00       	push   $0x802f9c
+  802085:	e8 b3 00 00 00       	call   80213d <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  80208a:	83 c4 18             	add    $0x18,%esp
+  80208d:	53                   	push   %ebx
+  80208e:	ff 75 10             	push   0x10(%ebp)
+  802091:	e8 56 00 00 00       	call   8020ec <vcprintf>
+  cprintf("\n");
+  802096:	c7 04 24 88 2f 80 00 	movl   $0x802f88,(%esp)
+  80209d:	e8 9b 00 00 00       	call   80213d <cprintf>
+  8020a2:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  8020a5:	cc                   	int3
+  while (1)
+  8020a6:	eb fd                	jmp    8020a5 <_panic+0x43>
+
+008020a8 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  8020a8:	55                   	push   %ebp
+  8020a9:	89 e5                	mov    %esp,%ebp
+  8020ab:	53                   	push   %ebx
+  8020ac:	83 ec 04             	sub    $0x4,%esp
+  8020af:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  8020b2:	8b 13                	mov    (%ebx),%edx
+  8020b4:	8d 42 01             	lea    0x1(%edx),%eax
+  8020b7:	89 03                	mov    %eax,(%ebx)
+  8020b9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8020bc:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  8020c0:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8020c5:	74 09                	je     8020d0 <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  8020c7:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8020cb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8020ce:	c9                   	leave
+  8020cf:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  8020d0:	83 ec 08             	sub    $0x8,%esp
+  8020d3:	68 ff 00 00 00       	push   $0xff
+  8020d8:	8d 43 08             	lea    0x8(%ebx),%eax
+  8020db:	50                   	push   %eax
+  8020dc:	e8 c2 df ff ff       	call   8000a3 <sys_cputs>
+    b->idx = 0;
+  8020e1:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8020e7:	83 c4 10             	add    $0x10,%esp
+  8020ea:	eb db                	jmp    8020c7 <putch+0x1f>
+
+008020ec <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8020ec:	55                   	push   %ebp
+  8020ed:	89 e5                	mov    %esp,%ebp
+  8020ef:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  8020f5:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8020fc:	00 00 00 
+  b.cnt = 0;
+  8020ff:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  802106:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  802109:	ff 75 0c             	push   0xc(%ebp)
+  80210c:	ff 75 08             	push   0x8(%ebp)
+  80210f:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  802115:	50                   	push   %eax
+  802116:	68 a8 20 80 00       	push   $0x8020a8
+  80211b:	e8 14 01 00 00       	call   802234 <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  802120:	83 c4 08             	add    $0x8,%esp
+  802123:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  802129:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80212f:	50                   	push   %eax
+  802130:	e8 6e df ff ff       	call   8000a3 <sys_cputs>
+
+  return b.cnt;
+}
+  802135:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80213b:	c9                   	leave
+  80213c:	c3                   	ret
+
+0080213d <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80213d:	55                   	push   %ebp
+  80213e:	89 e5                	mov    %esp,%ebp
+  802140:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  802143:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  802146:	50                   	push   %eax
+  802147:	ff 75 08             	push   0x8(%ebp)
+  80214a:	e8 9d ff ff ff       	call   8020ec <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  80214f:	c9                   	leave
+  802150:	c3                   	ret
+
+00802151 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  802151:	55                   	push   %ebp
+  802152:	89 e5                	mov    %esp,%ebp
+  802154:	57                   	push   %edi
+  802155:	56                   	push   %esi
+  802156:	53                   	push   %ebx
+  802157:	83 ec 1c             	sub    $0x1c,%esp
+  80215a:	89 c7                	mov    %eax,%edi
+  80215c:	89 d6                	mov    %edx,%esi
+  80215e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802161:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802164:	89 d1                	mov    %edx,%ecx
+  802166:	89 c2                	mov    %eax,%edx
+  802168:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80216b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80216e:	8b 45 10             	mov    0x10(%ebp),%eax
+  802171:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  802174:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802177:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80217e:	39 c2                	cmp    %eax,%edx
+  802180:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  802183:	72 3e                	jb     8021c3 <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  802185:	83 ec 0c             	sub    $0xc,%esp
+  802188:	ff 75 18             	push   0x18(%ebp)
+  80218b:	83 eb 01             	sub    $0x1,%ebx
+  80218e:	53                   	push   %ebx
+  80218f:	50                   	push   %eax
+  802190:	83 ec 08             	sub    $0x8,%esp
+  802193:	ff 75 e4             	push   -0x1c(%ebp)
+  802196:	ff 75 e0             	push   -0x20(%ebp)
+  802199:	ff 75 dc             	push   -0x24(%ebp)
+  80219c:	ff 75 d8             	push   -0x28(%ebp)
+  80219f:	e8 1c 0b 00 00       	call   802cc0 <__udivdi3>
+  8021a4:	83 c4 18             	add    $0x18,%esp
+  8021a7:	52                   	push   %edx
+  8021a8:	50                   	push   %eax
+  8021a9:	89 f2                	mov    %esi,%edx
+  8021ab:	89 f8                	mov    %edi,%eax
+  8021ad:	e8 9f ff ff ff       	call   802151 <printnum>
+  8021b2:	83 c4 20             	add    $0x20,%esp
+  8021b5:	eb 13                	jmp    8021ca <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  8021b7:	83 ec 08             	sub    $0x8,%esp
+  8021ba:	56                   	push   %esi
+  8021bb:	ff 75 18             	push   0x18(%ebp)
+  8021be:	ff d7                	call   *%edi
+  8021c0:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  8021c3:	83 eb 01             	sub    $0x1,%ebx
+  8021c6:	85 db                	test   %ebx,%ebx
+  8021c8:	7f ed                	jg     8021b7 <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  8021ca:	83 ec 08             	sub    $0x8,%esp
+  8021cd:	56                   	push   %esi
+  8021ce:	83 ec 04             	sub    $0x4,%esp
+  8021d1:	ff 75 e4             	push   -0x1c(%ebp)
+  8021d4:	ff 75 e0             	push   -0x20(%ebp)
+  8021d7:	ff 75 dc             	push   -0x24(%ebp)
+  8021da:	ff 75 d8             	push   -0x28(%ebp)
+  8021dd:	e8 ff 0a 00 00       	call   802ce1 <__umoddi3>
+  8021e2:	83 c4 14             	add    $0x14,%esp
+  8021e5:	0f be 80 bf 2f 80 00 	movsbl 0x802fbf(%eax),%eax
+  8021ec:	50                   	push   %eax
+  8021ed:	ff d7                	call   *%edi
+}
+  8021ef:	83 c4 10             	add    $0x10,%esp
+  8021f2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021f5:	5b                   	pop    %ebx
+  8021f6:	5e                   	pop    %esi
+  8021f7:	5f                   	pop    %edi
+  8021f8:	5d                   	pop    %ebp
+  8021f9:	c3                   	ret
+
+008021fa <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8021fa:	55                   	push   %ebp
+  8021fb:	89 e5                	mov    %esp,%ebp
+  8021fd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  802200:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  802204:	8b 10                	mov    (%eax),%edx
+  802206:	3b 50 04             	cmp    0x4(%eax),%edx
+  802209:	73 0a                	jae    802215 <sprintputch+0x1b>
+    *b->buf++ = ch;
+  80220b:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80220e:	89 08                	mov    %ecx,(%eax)
+  802210:	8b 45 08             	mov    0x8(%ebp),%eax
+  802213:	88 02                	mov    %al,(%edx)
+}
+  802215:	5d                   	pop    %ebp
+  802216:	c3                   	ret
+
+00802217 <printfmt>:
+{
+  802217:	55                   	push   %ebp
+  802218:	89 e5                	mov    %esp,%ebp
+  80221a:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  80221d:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  802220:	50                   	push   %eax
+  802221:	ff 75 10             	push   0x10(%ebp)
+  802224:	ff 75 0c             	push   0xc(%ebp)
+  802227:	ff 75 08             	push   0x8(%ebp)
+  80222a:	e8 05 00 00 00       	call   802234 <vprintfmt>
+}
+  80222f:	83 c4 10             	add    $0x10,%esp
+  802232:	c9                   	leave
+  802233:	c3                   	ret
+
+00802234 <vprintfmt>:
+{
+  802234:	55                   	push   %ebp
+  802235:	89 e5                	mov    %esp,%ebp
+  802237:	57                   	push   %edi
+  802238:	56                   	push   %esi
+  802239:	53                   	push   %ebx
+  80223a:	83 ec 2c             	sub    $0x2c,%esp
+  80223d:	8b 75 08             	mov    0x8(%ebp),%esi
+  802240:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802243:	8b 7d 10             	mov    0x10(%ebp),%edi
+  802246:	eb 0a                	jmp    802252 <vprintfmt+0x1e>
+      putch(ch, putdat);
+  802248:	83 ec 08             	sub    $0x8,%esp
+  80224b:	53                   	push   %ebx
+  80224c:	50                   	push   %eax
+  80224d:	ff d6                	call   *%esi
+  80224f:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  802252:	83 c7 01             	add    $0x1,%edi
+  802255:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  802259:	83 f8 25             	cmp    $0x25,%eax
+  80225c:	74 0c                	je     80226a <vprintfmt+0x36>
+      if (ch == '\0')
+  80225e:	85 c0                	test   %eax,%eax
+  802260:	75 e6                	jne    802248 <vprintfmt+0x14>
+}
+  802262:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802265:	5b                   	pop    %ebx
+  802266:	5e                   	pop    %esi
+  802267:	5f                   	pop    %edi
+  802268:	5d                   	pop    %ebp
+  802269:	c3                   	ret
+    padc = ' ';
+  80226a:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  80226e:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  802275:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  80227c:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  802283:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  802288:	8d 47 01             	lea    0x1(%edi),%eax
+  80228b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80228e:	0f b6 17             	movzbl (%edi),%edx
+  802291:	8d 42 dd             	lea    -0x23(%edx),%eax
+  802294:	3c 55                	cmp    $0x55,%al
+  802296:	0f 87 cf 03 00 00    	ja     80266b <vprintfmt+0x437>
+  80229c:	0f b6 c0             	movzbl %al,%eax
+  80229f:	ff 24 85 00 31 80 00 	jmp    *0x803100(,%eax,4)
+  8022a6:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  8022a9:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8022ad:	eb d9                	jmp    802288 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  8022af:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8022b2:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8022b6:	eb d0                	jmp    802288 <vprintfmt+0x54>
+  8022b8:	0f b6 d2             	movzbl %dl,%edx
+  8022bb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  8022be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022c3:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  8022c6:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8022c9:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  8022cd:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  8022d0:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8022d3:	83 f9 09             	cmp    $0x9,%ecx
+  8022d6:	77 55                	ja     80232d <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  8022d8:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  8022db:	eb e9                	jmp    8022c6 <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  8022dd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8022e0:	8b 00                	mov    (%eax),%eax
+  8022e2:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8022e5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8022e8:	8d 40 04             	lea    0x4(%eax),%eax
+  8022eb:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  8022ee:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  8022f1:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8022f5:	79 91                	jns    802288 <vprintfmt+0x54>
+        width = precision, precision = -1;
+  8022f7:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8022fa:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8022fd:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  802304:	eb 82                	jmp    802288 <vprintfmt+0x54>
+      if (width < 0)
+  802306:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802309:	85 d2                	test   %edx,%edx
+  80230b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802310:	0f 49 c2             	cmovns %edx,%eax
+  802313:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  802316:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  802319:	e9 6a ff ff ff       	jmp    802288 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  80231e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  802321:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  802328:	e9 5b ff ff ff       	jmp    802288 <vprintfmt+0x54>
+  80232d:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802330:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802333:	eb bc                	jmp    8022f1 <vprintfmt+0xbd>
+      lflag++;
+  802335:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  802338:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  80233b:	e9 48 ff ff ff       	jmp    802288 <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  802340:	8b 45 14             	mov    0x14(%ebp),%eax
+  802343:	8d 78 04             	lea    0x4(%eax),%edi
+  802346:	83 ec 08             	sub    $0x8,%esp
+  802349:	53                   	push   %ebx
+  80234a:	ff 30                	push   (%eax)
+  80234c:	ff d6                	call   *%esi
+      break;
+  80234e:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  802351:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  802354:	e9 b1 02 00 00       	jmp    80260a <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  802359:	8b 45 14             	mov    0x14(%ebp),%eax
+  80235c:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  80235f:	8b 10                	mov    (%eax),%edx
+  802361:	89 d0                	mov    %edx,%eax
+  802363:	f7 d8                	neg    %eax
+  802365:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  802368:	83 f8 10             	cmp    $0x10,%eax
+  80236b:	7f 23                	jg     802390 <vprintfmt+0x15c>
+  80236d:	8b 14 85 60 32 80 00 	mov    0x803260(,%eax,4),%edx
+  802374:	85 d2                	test   %edx,%edx
+  802376:	74 18                	je     802390 <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  802378:	52                   	push   %edx
+  802379:	68 32 2f 80 00       	push   $0x802f32
+  80237e:	53                   	push   %ebx
+  80237f:	56                   	push   %esi
+  802380:	e8 92 fe ff ff       	call   802217 <printfmt>
+  802385:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  802388:	89 7d 14             	mov    %edi,0x14(%ebp)
+  80238b:	e9 7a 02 00 00       	jmp    80260a <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  802390:	50                   	push   %eax
+  802391:	68 d7 2f 80 00       	push   $0x802fd7
+  802396:	53                   	push   %ebx
+  802397:	56                   	push   %esi
+  802398:	e8 7a fe ff ff       	call   802217 <printfmt>
+  80239d:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  8023a0:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  8023a3:	e9 62 02 00 00       	jmp    80260a <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  8023a8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8023ab:	83 c0 04             	add    $0x4,%eax
+  8023ae:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8023b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8023b4:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  8023b6:	85 c9                	test   %ecx,%ecx
+  8023b8:	b8 d0 2f 80 00       	mov    $0x802fd0,%eax
+  8023bd:	0f 45 c1             	cmovne %ecx,%eax
+  8023c0:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  8023c3:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8023c7:	7e 06                	jle    8023cf <vprintfmt+0x19b>
+  8023c9:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8023cd:	75 0b                	jne    8023da <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8023cf:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8023d2:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8023d5:	89 75 08             	mov    %esi,0x8(%ebp)
+  8023d8:	eb 5c                	jmp    802436 <vprintfmt+0x202>
+  8023da:	83 ec 08             	sub    $0x8,%esp
+  8023dd:	ff 75 d0             	push   -0x30(%ebp)
+  8023e0:	ff 75 cc             	push   -0x34(%ebp)
+  8023e3:	e8 20 03 00 00       	call   802708 <strnlen>
+  8023e8:	89 c2                	mov    %eax,%edx
+  8023ea:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8023ed:	29 d0                	sub    %edx,%eax
+  8023ef:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  8023f2:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8023f6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8023f9:	89 75 08             	mov    %esi,0x8(%ebp)
+  8023fc:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8023fe:	eb 0e                	jmp    80240e <vprintfmt+0x1da>
+          putch(padc, putdat);
+  802400:	83 ec 08             	sub    $0x8,%esp
+  802403:	53                   	push   %ebx
+  802404:	57                   	push   %edi
+  802405:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  802408:	83 ee 01             	sub    $0x1,%esi
+  80240b:	83 c4 10             	add    $0x10,%esp
+  80240e:	85 f6                	test   %esi,%esi
+  802410:	7f ee                	jg     802400 <vprintfmt+0x1cc>
+  802412:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802415:	8b 75 08             	mov    0x8(%ebp),%esi
+  802418:	85 c0                	test   %eax,%eax
+  80241a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80241f:	0f 49 d0             	cmovns %eax,%edx
+  802422:	29 d0                	sub    %edx,%eax
+  802424:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802427:	eb a6                	jmp    8023cf <vprintfmt+0x19b>
+          putch(ch, putdat);
+  802429:	83 ec 08             	sub    $0x8,%esp
+  80242c:	53                   	push   %ebx
+  80242d:	52                   	push   %edx
+  80242e:	ff 55 08             	call   *0x8(%ebp)
+  802431:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  802434:	89 f1                	mov    %esi,%ecx
+  802436:	8d 71 01             	lea    0x1(%ecx),%esi
+  802439:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80243d:	0f be d0             	movsbl %al,%edx
+  802440:	85 d2                	test   %edx,%edx
+  802442:	74 28                	je     80246c <vprintfmt+0x238>
+  802444:	85 ff                	test   %edi,%edi
+  802446:	78 05                	js     80244d <vprintfmt+0x219>
+  802448:	83 ef 01             	sub    $0x1,%edi
+  80244b:	78 30                	js     80247d <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  80244d:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  802451:	74 d6                	je     802429 <vprintfmt+0x1f5>
+  802453:	0f be c0             	movsbl %al,%eax
+  802456:	83 e8 20             	sub    $0x20,%eax
+  802459:	83 f8 5e             	cmp    $0x5e,%eax
+  80245c:	76 cb                	jbe    802429 <vprintfmt+0x1f5>
+          putch('?', putdat);
+  80245e:	83 ec 08             	sub    $0x8,%esp
+  802461:	53                   	push   %ebx
+  802462:	6a 3f                	push   $0x3f
+  802464:	ff 55 08             	call   *0x8(%ebp)
+  802467:	83 c4 10             	add    $0x10,%esp
+  80246a:	eb c8                	jmp    802434 <vprintfmt+0x200>
+  80246c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80246f:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  802472:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802475:	01 d0                	add    %edx,%eax
+  802477:	29 c8                	sub    %ecx,%eax
+  802479:	89 c7                	mov    %eax,%edi
+  80247b:	eb 13                	jmp    802490 <vprintfmt+0x25c>
+  80247d:	8b 75 08             	mov    0x8(%ebp),%esi
+  802480:	eb ed                	jmp    80246f <vprintfmt+0x23b>
+        putch(' ', putdat);
+  802482:	83 ec 08             	sub    $0x8,%esp
+  802485:	53                   	push   %ebx
+  802486:	6a 20                	push   $0x20
+  802488:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  80248a:	83 ef 01             	sub    $0x1,%edi
+  80248d:	83 c4 10             	add    $0x10,%esp
+  802490:	85 ff                	test   %edi,%edi
+  802492:	7f ee                	jg     802482 <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  802494:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  802497:	89 45 14             	mov    %eax,0x14(%ebp)
+  80249a:	e9 6b 01 00 00       	jmp    80260a <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  80249f:	83 f9 01             	cmp    $0x1,%ecx
+  8024a2:	7f 1f                	jg     8024c3 <vprintfmt+0x28f>
+  else if (lflag)
+  8024a4:	85 c9                	test   %ecx,%ecx
+  8024a6:	74 67                	je     80250f <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  8024a8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024ab:	8b 00                	mov    (%eax),%eax
+  8024ad:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8024b0:	89 c1                	mov    %eax,%ecx
+  8024b2:	c1 f9 1f             	sar    $0x1f,%ecx
+  8024b5:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8024b8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024bb:	8d 40 04             	lea    0x4(%eax),%eax
+  8024be:	89 45 14             	mov    %eax,0x14(%ebp)
+  8024c1:	eb 17                	jmp    8024da <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  8024c3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024c6:	8b 50 04             	mov    0x4(%eax),%edx
+  8024c9:	8b 00                	mov    (%eax),%eax
+  8024cb:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8024ce:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8024d1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8024d4:	8d 40 08             	lea    0x8(%eax),%eax
+  8024d7:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  8024da:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8024dd:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  8024e0:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  8024e5:	85 c9                	test   %ecx,%ecx
+  8024e7:	0f 89 03 01 00 00    	jns    8025f0 <vprintfmt+0x3bc>
+        putch('-', putdat);
+  8024ed:	83 ec 08             	sub    $0x8,%esp
+  8024f0:	53                   	push   %ebx
+  8024f1:	6a 2d                	push   $0x2d
+  8024f3:	ff d6                	call   *%esi
+        num = -(long long)num;
+  8024f5:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8024f8:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8024fb:	f7 da                	neg    %edx
+  8024fd:	83 d1 00             	adc    $0x0,%ecx
+  802500:	f7 d9                	neg    %ecx
+  802502:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  802505:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80250a:	e9 e1 00 00 00       	jmp    8025f0 <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  80250f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802512:	8b 00                	mov    (%eax),%eax
+  802514:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  802517:	89 c1                	mov    %eax,%ecx
+  802519:	c1 f9 1f             	sar    $0x1f,%ecx
+  80251c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80251f:	8b 45 14             	mov    0x14(%ebp),%eax
+  802522:	8d 40 04             	lea    0x4(%eax),%eax
+  802525:	89 45 14             	mov    %eax,0x14(%ebp)
+  802528:	eb b0                	jmp    8024da <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  80252a:	83 f9 01             	cmp    $0x1,%ecx
+  80252d:	7f 1e                	jg     80254d <vprintfmt+0x319>
+  else if (lflag)
+  80252f:	85 c9                	test   %ecx,%ecx
+  802531:	74 32                	je     802565 <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  802533:	8b 45 14             	mov    0x14(%ebp),%eax
+  802536:	8b 10                	mov    (%eax),%edx
+  802538:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80253d:	8d 40 04             	lea    0x4(%eax),%eax
+  802540:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  802543:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  802548:	e9 a3 00 00 00       	jmp    8025f0 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  80254d:	8b 45 14             	mov    0x14(%ebp),%eax
+  802550:	8b 10                	mov    (%eax),%edx
+  802552:	8b 48 04             	mov    0x4(%eax),%ecx
+  802555:	8d 40 08             	lea    0x8(%eax),%eax
+  802558:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  80255b:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  802560:	e9 8b 00 00 00       	jmp    8025f0 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  802565:	8b 45 14             	mov    0x14(%ebp),%eax
+  802568:	8b 10                	mov    (%eax),%edx
+  80256a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80256f:	8d 40 04             	lea    0x4(%eax),%eax
+  802572:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  802575:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  80257a:	eb 74                	jmp    8025f0 <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  80257c:	83 f9 01             	cmp    $0x1,%ecx
+  80257f:	7f 1b                	jg     80259c <vprintfmt+0x368>
+  else if (lflag)
+  802581:	85 c9                	test   %ecx,%ecx
+  802583:	74 2c                	je     8025b1 <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  802585:	8b 45 14             	mov    0x14(%ebp),%eax
+  802588:	8b 10                	mov    (%eax),%edx
+  80258a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80258f:	8d 40 04             	lea    0x4(%eax),%eax
+  802592:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  802595:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  80259a:	eb 54                	jmp    8025f0 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  80259c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80259f:	8b 10                	mov    (%eax),%edx
+  8025a1:	8b 48 04             	mov    0x4(%eax),%ecx
+  8025a4:	8d 40 08             	lea    0x8(%eax),%eax
+  8025a7:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8025aa:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  8025af:	eb 3f                	jmp    8025f0 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8025b1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8025b4:	8b 10                	mov    (%eax),%edx
+  8025b6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025bb:	8d 40 04             	lea    0x4(%eax),%eax
+  8025be:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8025c1:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  8025c6:	eb 28                	jmp    8025f0 <vprintfmt+0x3bc>
+      putch('0', putdat);
+  8025c8:	83 ec 08             	sub    $0x8,%esp
+  8025cb:	53                   	push   %ebx
+  8025cc:	6a 30                	push   $0x30
+  8025ce:	ff d6                	call   *%esi
+      putch('x', putdat);
+  8025d0:	83 c4 08             	add    $0x8,%esp
+  8025d3:	53                   	push   %ebx
+  8025d4:	6a 78                	push   $0x78
+  8025d6:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  8025d8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8025db:	8b 10                	mov    (%eax),%edx
+  8025dd:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  8025e2:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  8025e5:	8d 40 04             	lea    0x4(%eax),%eax
+  8025e8:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8025eb:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  8025f0:	83 ec 0c             	sub    $0xc,%esp
+  8025f3:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8025f7:	50                   	push   %eax
+  8025f8:	ff 75 e0             	push   -0x20(%ebp)
+  8025fb:	57                   	push   %edi
+  8025fc:	51                   	push   %ecx
+  8025fd:	52                   	push   %edx
+  8025fe:	89 da                	mov    %ebx,%edx
+  802600:	89 f0                	mov    %esi,%eax
+  802602:	e8 4a fb ff ff       	call   802151 <printnum>
+      break;
+  802607:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  80260a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  80260d:	e9 40 fc ff ff       	jmp    802252 <vprintfmt+0x1e>
+  if (lflag >= 2)
+  802612:	83 f9 01             	cmp    $0x1,%ecx
+  802615:	7f 1b                	jg     802632 <vprintfmt+0x3fe>
+  else if (lflag)
+  802617:	85 c9                	test   %ecx,%ecx
+  802619:	74 2c                	je     802647 <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  80261b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80261e:	8b 10                	mov    (%eax),%edx
+  802620:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802625:	8d 40 04             	lea    0x4(%eax),%eax
+  802628:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  80262b:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  802630:	eb be                	jmp    8025f0 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  802632:	8b 45 14             	mov    0x14(%ebp),%eax
+  802635:	8b 10                	mov    (%eax),%edx
+  802637:	8b 48 04             	mov    0x4(%eax),%ecx
+  80263a:	8d 40 08             	lea    0x8(%eax),%eax
+  80263d:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  802640:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  802645:	eb a9                	jmp    8025f0 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  802647:	8b 45 14             	mov    0x14(%ebp),%eax
+  80264a:	8b 10                	mov    (%eax),%edx
+  80264c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802651:	8d 40 04             	lea    0x4(%eax),%eax
+  802654:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  802657:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  80265c:	eb 92                	jmp    8025f0 <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  80265e:	83 ec 08             	sub    $0x8,%esp
+  802661:	53                   	push   %ebx
+  802662:	6a 25                	push   $0x25
+  802664:	ff d6                	call   *%esi
+      break;
+  802666:	83 c4 10             	add    $0x10,%esp
+  802669:	eb 9f                	jmp    80260a <vprintfmt+0x3d6>
+      putch('%', putdat);
+  80266b:	83 ec 08             	sub    $0x8,%esp
+  80266e:	53                   	push   %ebx
+  80266f:	6a 25                	push   $0x25
+  802671:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  802673:	83 c4 10             	add    $0x10,%esp
+  802676:	89 f8                	mov    %edi,%eax
+  802678:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  80267c:	74 05                	je     802683 <vprintfmt+0x44f>
+  80267e:	83 e8 01             	sub    $0x1,%eax
+  802681:	eb f5                	jmp    802678 <vprintfmt+0x444>
+  802683:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802686:	eb 82                	jmp    80260a <vprintfmt+0x3d6>
+
+00802688 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  802688:	55                   	push   %ebp
+  802689:	89 e5                	mov    %esp,%ebp
+  80268b:	83 ec 18             	sub    $0x18,%esp
+  80268e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802691:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  802694:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  802697:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  80269b:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80269e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  8026a5:	85 c0                	test   %eax,%eax
+  8026a7:	74 26                	je     8026cf <vsnprintf+0x47>
+  8026a9:	85 d2                	test   %edx,%edx
+  8026ab:	7e 22                	jle    8026cf <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8026ad:	ff 75 14             	push   0x14(%ebp)
+  8026b0:	ff 75 10             	push   0x10(%ebp)
+  8026b3:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8026b6:	50                   	push   %eax
+  8026b7:	68 fa 21 80 00       	push   $0x8021fa
+  8026bc:	e8 73 fb ff ff       	call   802234 <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  8026c1:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8026c4:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  8026c7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8026ca:	83 c4 10             	add    $0x10,%esp
+}
+  8026cd:	c9                   	leave
+  8026ce:	c3                   	ret
+    return -E_INVAL;
+  8026cf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026d4:	eb f7                	jmp    8026cd <vsnprintf+0x45>
+
+008026d6 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8026d6:	55                   	push   %ebp
+  8026d7:	89 e5                	mov    %esp,%ebp
+  8026d9:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  8026dc:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  8026df:	50                   	push   %eax
+  8026e0:	ff 75 10             	push   0x10(%ebp)
+  8026e3:	ff 75 0c             	push   0xc(%ebp)
+  8026e6:	ff 75 08             	push   0x8(%ebp)
+  8026e9:	e8 9a ff ff ff       	call   802688 <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  8026ee:	c9                   	leave
+  8026ef:	c3                   	ret
+
+008026f0 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8026f0:	55                   	push   %ebp
+  8026f1:	89 e5                	mov    %esp,%ebp
+  8026f3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  8026f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026fb:	eb 03                	jmp    802700 <strlen+0x10>
+    n++;
+  8026fd:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  802700:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  802704:	75 f7                	jne    8026fd <strlen+0xd>
+  return n;
+}
+  802706:	5d                   	pop    %ebp
+  802707:	c3                   	ret
+
+00802708 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  802708:	55                   	push   %ebp
+  802709:	89 e5                	mov    %esp,%ebp
+  80270b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80270e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802711:	b8 00 00 00 00       	mov    $0x0,%eax
+  802716:	eb 03                	jmp    80271b <strnlen+0x13>
+    n++;
+  802718:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80271b:	39 d0                	cmp    %edx,%eax
+  80271d:	74 08                	je     802727 <strnlen+0x1f>
+  80271f:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  802723:	75 f3                	jne    802718 <strnlen+0x10>
+  802725:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  802727:	89 d0                	mov    %edx,%eax
+  802729:	5d                   	pop    %ebp
+  80272a:	c3                   	ret
+
+0080272b <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80272b:	55                   	push   %ebp
+  80272c:	89 e5                	mov    %esp,%ebp
+  80272e:	53                   	push   %ebx
+  80272f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802732:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  802735:	b8 00 00 00 00       	mov    $0x0,%eax
+  80273a:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80273e:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  802741:	83 c0 01             	add    $0x1,%eax
+  802744:	84 d2                	test   %dl,%dl
+  802746:	75 f2                	jne    80273a <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  802748:	89 c8                	mov    %ecx,%eax
+  80274a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80274d:	c9                   	leave
+  80274e:	c3                   	ret
+
+0080274f <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  80274f:	55                   	push   %ebp
+  802750:	89 e5                	mov    %esp,%ebp
+  802752:	53                   	push   %ebx
+  802753:	83 ec 10             	sub    $0x10,%esp
+  802756:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  802759:	53                   	push   %ebx
+  80275a:	e8 91 ff ff ff       	call   8026f0 <strlen>
+  80275f:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  802762:	ff 75 0c             	push   0xc(%ebp)
+  802765:	01 d8                	add    %ebx,%eax
+  802767:	50                   	push   %eax
+  802768:	e8 be ff ff ff       	call   80272b <strcpy>
+  return dst;
+}
+  80276d:	89 d8                	mov    %ebx,%eax
+  80276f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802772:	c9                   	leave
+  802773:	c3                   	ret
+
+00802774 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  802774:	55                   	push   %ebp
+  802775:	89 e5                	mov    %esp,%ebp
+  802777:	56                   	push   %esi
+  802778:	53                   	push   %ebx
+  802779:	8b 75 08             	mov    0x8(%ebp),%esi
+  80277c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  80277f:	89 f3                	mov    %esi,%ebx
+  802781:	03 5d 10             	add    0x10(%ebp),%ebx
+  802784:	89 f0                	mov    %esi,%eax
+  802786:	eb 0f                	jmp    802797 <strncpy+0x23>
+    *dst++ = *src;
+  802788:	83 c0 01             	add    $0x1,%eax
+  80278b:	0f b6 0a             	movzbl (%edx),%ecx
+  80278e:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  802791:	80 f9 01             	cmp    $0x1,%cl
+  802794:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  802797:	39 d8                	cmp    %ebx,%eax
+  802799:	75 ed                	jne    802788 <strncpy+0x14>
+  }
+  return ret;
+}
+  80279b:	89 f0                	mov    %esi,%eax
+  80279d:	5b                   	pop    %ebx
+  80279e:	5e                   	pop    %esi
+  80279f:	5d                   	pop    %ebp
+  8027a0:	c3                   	ret
+
+008027a1 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  8027a1:	55                   	push   %ebp
+  8027a2:	89 e5                	mov    %esp,%ebp
+  8027a4:	56                   	push   %esi
+  8027a5:	53                   	push   %ebx
+  8027a6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8027a9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8027ac:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  8027af:	89 f0                	mov    %esi,%eax
+  8027b1:	85 d2                	test   %edx,%edx
+  8027b3:	74 21                	je     8027d6 <strlcpy+0x35>
+  8027b5:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8027b9:	89 f2                	mov    %esi,%edx
+  8027bb:	eb 09                	jmp    8027c6 <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  8027bd:	83 c1 01             	add    $0x1,%ecx
+  8027c0:	83 c2 01             	add    $0x1,%edx
+  8027c3:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  8027c6:	39 c2                	cmp    %eax,%edx
+  8027c8:	74 09                	je     8027d3 <strlcpy+0x32>
+  8027ca:	0f b6 19             	movzbl (%ecx),%ebx
+  8027cd:	84 db                	test   %bl,%bl
+  8027cf:	75 ec                	jne    8027bd <strlcpy+0x1c>
+  8027d1:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  8027d3:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  8027d6:	29 f0                	sub    %esi,%eax
+}
+  8027d8:	5b                   	pop    %ebx
+  8027d9:	5e                   	pop    %esi
+  8027da:	5d                   	pop    %ebp
+  8027db:	c3                   	ret
+
+008027dc <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8027dc:	55                   	push   %ebp
+  8027dd:	89 e5                	mov    %esp,%ebp
+  8027df:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8027e2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  8027e5:	eb 06                	jmp    8027ed <strcmp+0x11>
+    p++, q++;
+  8027e7:	83 c1 01             	add    $0x1,%ecx
+  8027ea:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  8027ed:	0f b6 01             	movzbl (%ecx),%eax
+  8027f0:	84 c0                	test   %al,%al
+  8027f2:	74 04                	je     8027f8 <strcmp+0x1c>
+  8027f4:	3a 02                	cmp    (%edx),%al
+  8027f6:	74 ef                	je     8027e7 <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  8027f8:	0f b6 c0             	movzbl %al,%eax
+  8027fb:	0f b6 12             	movzbl (%edx),%edx
+  8027fe:	29 d0                	sub    %edx,%eax
+}
+  802800:	5d                   	pop    %ebp
+  802801:	c3                   	ret
+
+00802802 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  802802:	55                   	push   %ebp
+  802803:	89 e5                	mov    %esp,%ebp
+  802805:	53                   	push   %ebx
+  802806:	8b 45 08             	mov    0x8(%ebp),%eax
+  802809:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80280c:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  80280f:	eb 09                	jmp    80281a <strncmp+0x18>
+    n--, p++, q++;
+  802811:	83 ea 01             	sub    $0x1,%edx
+  802814:	83 c0 01             	add    $0x1,%eax
+  802817:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  80281a:	85 d2                	test   %edx,%edx
+  80281c:	74 18                	je     802836 <strncmp+0x34>
+  80281e:	0f b6 18             	movzbl (%eax),%ebx
+  802821:	84 db                	test   %bl,%bl
+  802823:	74 04                	je     802829 <strncmp+0x27>
+  802825:	3a 19                	cmp    (%ecx),%bl
+  802827:	74 e8                	je     802811 <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  802829:	0f b6 00             	movzbl (%eax),%eax
+  80282c:	0f b6 11             	movzbl (%ecx),%edx
+  80282f:	29 d0                	sub    %edx,%eax
+}
+  802831:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802834:	c9                   	leave
+  802835:	c3                   	ret
+    return 0;
+  802836:	b8 00 00 00 00       	mov    $0x0,%eax
+  80283b:	eb f4                	jmp    802831 <strncmp+0x2f>
+
+0080283d <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80283d:	55                   	push   %ebp
+  80283e:	89 e5                	mov    %esp,%ebp
+  802840:	8b 45 08             	mov    0x8(%ebp),%eax
+  802843:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  802847:	eb 03                	jmp    80284c <strchr+0xf>
+  802849:	83 c0 01             	add    $0x1,%eax
+  80284c:	0f b6 10             	movzbl (%eax),%edx
+  80284f:	84 d2                	test   %dl,%dl
+  802851:	74 06                	je     802859 <strchr+0x1c>
+    if (*s == c)
+  802853:	38 ca                	cmp    %cl,%dl
+  802855:	75 f2                	jne    802849 <strchr+0xc>
+  802857:	eb 05                	jmp    80285e <strchr+0x21>
+      return (char*)s;
+  return 0;
+  802859:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80285e:	5d                   	pop    %ebp
+  80285f:	c3                   	ret
+
+00802860 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  802860:	55                   	push   %ebp
+  802861:	89 e5                	mov    %esp,%ebp
+  802863:	8b 45 08             	mov    0x8(%ebp),%eax
+  802866:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  80286a:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  80286d:	38 ca                	cmp    %cl,%dl
+  80286f:	74 09                	je     80287a <strfind+0x1a>
+  802871:	84 d2                	test   %dl,%dl
+  802873:	74 05                	je     80287a <strfind+0x1a>
+  for (; *s; s++)
+  802875:	83 c0 01             	add    $0x1,%eax
+  802878:	eb f0                	jmp    80286a <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  80287a:	5d                   	pop    %ebp
+  80287b:	c3                   	ret
+
+0080287c <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  80287c:	55                   	push   %ebp
+  80287d:	89 e5                	mov    %esp,%ebp
+  80287f:	57                   	push   %edi
+  802880:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802883:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  802886:	85 c9                	test   %ecx,%ecx
+  802888:	74 20                	je     8028aa <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  80288a:	89 f8                	mov    %edi,%eax
+  80288c:	09 c8                	or     %ecx,%eax
+  80288e:	a8 03                	test   $0x3,%al
+  802890:	75 12                	jne    8028a4 <memset+0x28>
+    c &= 0xFF;
+  802892:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  802896:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  80289c:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  80289f:	fc                   	cld
+  8028a0:	f3 ab                	rep stos %eax,%es:(%edi)
+  8028a2:	eb 06                	jmp    8028aa <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  8028a4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8028a7:	fc                   	cld
+  8028a8:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  8028aa:	89 f8                	mov    %edi,%eax
+  8028ac:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8028af:	c9                   	leave
+  8028b0:	c3                   	ret
+
+008028b1 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8028b1:	55                   	push   %ebp
+  8028b2:	89 e5                	mov    %esp,%ebp
+  8028b4:	57                   	push   %edi
+  8028b5:	56                   	push   %esi
+  8028b6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8028b9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8028bc:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  8028bf:	39 c6                	cmp    %eax,%esi
+  8028c1:	73 32                	jae    8028f5 <memmove+0x44>
+  8028c3:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8028c6:	39 d0                	cmp    %edx,%eax
+  8028c8:	73 2b                	jae    8028f5 <memmove+0x44>
+    s += n;
+    d += n;
+  8028ca:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8028cd:	89 d6                	mov    %edx,%esi
+  8028cf:	09 fe                	or     %edi,%esi
+  8028d1:	09 ce                	or     %ecx,%esi
+  8028d3:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8028d9:	75 0e                	jne    8028e9 <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8028db:	83 ef 04             	sub    $0x4,%edi
+  8028de:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8028e1:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  8028e4:	fd                   	std
+  8028e5:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8028e7:	eb 09                	jmp    8028f2 <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8028e9:	83 ef 01             	sub    $0x1,%edi
+  8028ec:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  8028ef:	fd                   	std
+  8028f0:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  8028f2:	fc                   	cld
+  8028f3:	eb 1a                	jmp    80290f <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8028f5:	89 f2                	mov    %esi,%edx
+  8028f7:	09 c2                	or     %eax,%edx
+  8028f9:	09 ca                	or     %ecx,%edx
+  8028fb:	f6 c2 03             	test   $0x3,%dl
+  8028fe:	75 0a                	jne    80290a <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  802900:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  802903:	89 c7                	mov    %eax,%edi
+  802905:	fc                   	cld
+  802906:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  802908:	eb 05                	jmp    80290f <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  80290a:	89 c7                	mov    %eax,%edi
+  80290c:	fc                   	cld
+  80290d:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  80290f:	5e                   	pop    %esi
+  802910:	5f                   	pop    %edi
+  802911:	5d                   	pop    %ebp
+  802912:	c3                   	ret
+
+00802913 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  802913:	55                   	push   %ebp
+  802914:	89 e5                	mov    %esp,%ebp
+  802916:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  802919:	ff 75 10             	push   0x10(%ebp)
+  80291c:	ff 75 0c             	push   0xc(%ebp)
+  80291f:	ff 75 08             	push   0x8(%ebp)
+  802922:	e8 8a ff ff ff       	call   8028b1 <memmove>
+}
+  802927:	c9                   	leave
+  802928:	c3                   	ret
+
+00802929 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  802929:	55                   	push   %ebp
+  80292a:	89 e5                	mov    %esp,%ebp
+  80292c:	56                   	push   %esi
+  80292d:	53                   	push   %ebx
+  80292e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802931:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  802934:	89 c6                	mov    %eax,%esi
+  802936:	03 75 10             	add    0x10(%ebp),%esi
+  802939:	eb 06                	jmp    802941 <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  80293b:	83 c0 01             	add    $0x1,%eax
+  80293e:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  802941:	39 f0                	cmp    %esi,%eax
+  802943:	74 14                	je     802959 <memcmp+0x30>
+    if (*s1 != *s2)
+  802945:	0f b6 08             	movzbl (%eax),%ecx
+  802948:	0f b6 1a             	movzbl (%edx),%ebx
+  80294b:	38 d9                	cmp    %bl,%cl
+  80294d:	74 ec                	je     80293b <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  80294f:	0f b6 c1             	movzbl %cl,%eax
+  802952:	0f b6 db             	movzbl %bl,%ebx
+  802955:	29 d8                	sub    %ebx,%eax
+  802957:	eb 05                	jmp    80295e <memcmp+0x35>
+  }
+
+  return 0;
+  802959:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80295e:	5b                   	pop    %ebx
+  80295f:	5e                   	pop    %esi
+  802960:	5d                   	pop    %ebp
+  802961:	c3                   	ret
+
+00802962 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  802962:	55                   	push   %ebp
+  802963:	89 e5                	mov    %esp,%ebp
+  802965:	8b 45 08             	mov    0x8(%ebp),%eax
+  802968:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  80296b:	89 c2                	mov    %eax,%edx
+  80296d:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  802970:	eb 03                	jmp    802975 <memfind+0x13>
+  802972:	83 c0 01             	add    $0x1,%eax
+  802975:	39 d0                	cmp    %edx,%eax
+  802977:	73 04                	jae    80297d <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  802979:	38 08                	cmp    %cl,(%eax)
+  80297b:	75 f5                	jne    802972 <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  80297d:	5d                   	pop    %ebp
+  80297e:	c3                   	ret
+
+0080297f <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  80297f:	55                   	push   %ebp
+  802980:	89 e5                	mov    %esp,%ebp
+  802982:	57                   	push   %edi
+  802983:	56                   	push   %esi
+  802984:	53                   	push   %ebx
+  802985:	8b 55 08             	mov    0x8(%ebp),%edx
+  802988:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  80298b:	eb 03                	jmp    802990 <strtol+0x11>
+    s++;
+  80298d:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  802990:	0f b6 02             	movzbl (%edx),%eax
+  802993:	3c 20                	cmp    $0x20,%al
+  802995:	74 f6                	je     80298d <strtol+0xe>
+  802997:	3c 09                	cmp    $0x9,%al
+  802999:	74 f2                	je     80298d <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  80299b:	3c 2b                	cmp    $0x2b,%al
+  80299d:	74 2a                	je     8029c9 <strtol+0x4a>
+  int neg = 0;
+  80299f:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  8029a4:	3c 2d                	cmp    $0x2d,%al
+  8029a6:	74 2b                	je     8029d3 <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8029a8:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  8029ae:	75 0f                	jne    8029bf <strtol+0x40>
+  8029b0:	80 3a 30             	cmpb   $0x30,(%edx)
+  8029b3:	74 28                	je     8029dd <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  8029b5:	85 db                	test   %ebx,%ebx
+  8029b7:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8029bc:	0f 44 d8             	cmove  %eax,%ebx
+  8029bf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8029c4:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  8029c7:	eb 46                	jmp    802a0f <strtol+0x90>
+    s++;
+  8029c9:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  8029cc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029d1:	eb d5                	jmp    8029a8 <strtol+0x29>
+    s++, neg = 1;
+  8029d3:	83 c2 01             	add    $0x1,%edx
+  8029d6:	bf 01 00 00 00       	mov    $0x1,%edi
+  8029db:	eb cb                	jmp    8029a8 <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  8029dd:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  8029e1:	74 0e                	je     8029f1 <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  8029e3:	85 db                	test   %ebx,%ebx
+  8029e5:	75 d8                	jne    8029bf <strtol+0x40>
+    s++, base = 8;
+  8029e7:	83 c2 01             	add    $0x1,%edx
+  8029ea:	bb 08 00 00 00       	mov    $0x8,%ebx
+  8029ef:	eb ce                	jmp    8029bf <strtol+0x40>
+    s += 2, base = 16;
+  8029f1:	83 c2 02             	add    $0x2,%edx
+  8029f4:	bb 10 00 00 00       	mov    $0x10,%ebx
+  8029f9:	eb c4                	jmp    8029bf <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  8029fb:	0f be c0             	movsbl %al,%eax
+  8029fe:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  802a01:	3b 45 10             	cmp    0x10(%ebp),%eax
+  802a04:	7d 3a                	jge    802a40 <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  802a06:	83 c2 01             	add    $0x1,%edx
+  802a09:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  802a0d:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  802a0f:	0f b6 02             	movzbl (%edx),%eax
+  802a12:	8d 70 d0             	lea    -0x30(%eax),%esi
+  802a15:	89 f3                	mov    %esi,%ebx
+  802a17:	80 fb 09             	cmp    $0x9,%bl
+  802a1a:	76 df                	jbe    8029fb <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  802a1c:	8d 70 9f             	lea    -0x61(%eax),%esi
+  802a1f:	89 f3                	mov    %esi,%ebx
+  802a21:	80 fb 19             	cmp    $0x19,%bl
+  802a24:	77 08                	ja     802a2e <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  802a26:	0f be c0             	movsbl %al,%eax
+  802a29:	83 e8 57             	sub    $0x57,%eax
+  802a2c:	eb d3                	jmp    802a01 <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  802a2e:	8d 70 bf             	lea    -0x41(%eax),%esi
+  802a31:	89 f3                	mov    %esi,%ebx
+  802a33:	80 fb 19             	cmp    $0x19,%bl
+  802a36:	77 08                	ja     802a40 <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  802a38:	0f be c0             	movsbl %al,%eax
+  802a3b:	83 e8 37             	sub    $0x37,%eax
+  802a3e:	eb c1                	jmp    802a01 <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  802a40:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  802a44:	74 05                	je     802a4b <strtol+0xcc>
+    *endptr = (char*)s;
+  802a46:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a49:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  802a4b:	89 c8                	mov    %ecx,%eax
+  802a4d:	f7 d8                	neg    %eax
+  802a4f:	85 ff                	test   %edi,%edi
+  802a51:	0f 45 c8             	cmovne %eax,%ecx
+}
+  802a54:	89 c8                	mov    %ecx,%eax
+  802a56:	5b                   	pop    %ebx
+  802a57:	5e                   	pop    %esi
+  802a58:	5f                   	pop    %edi
+  802a59:	5d                   	pop    %ebp
+  802a5a:	c3                   	ret
+
+00802a5b <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  802a5b:	55                   	push   %ebp
+  802a5c:	89 e5                	mov    %esp,%ebp
+  802a5e:	57                   	push   %edi
+  802a5f:	56                   	push   %esi
+  802a60:	53                   	push   %ebx
+  802a61:	83 ec 14             	sub    $0x14,%esp
+  802a64:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802a67:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802a6a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802a6d:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  802a70:	85 c0                	test   %eax,%eax
+  802a72:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802a77:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  802a7a:	ff 33                	push   (%ebx)
+  802a7c:	50                   	push   %eax
+  802a7d:	e8 f8 d9 ff ff       	call   80047a <sys_ipc_recv>
+  802a82:	83 c4 10             	add    $0x10,%esp
+  802a85:	85 c0                	test   %eax,%eax
+  802a87:	78 39                	js     802ac2 <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  802a89:	85 ff                	test   %edi,%edi
+  802a8b:	74 0a                	je     802a97 <ipc_recv_pages+0x3c>
+  802a8d:	a1 44 57 80 00       	mov    0x805744,%eax
+  802a92:	8b 40 7c             	mov    0x7c(%eax),%eax
+  802a95:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  802a97:	85 f6                	test   %esi,%esi
+  802a99:	74 0d                	je     802aa8 <ipc_recv_pages+0x4d>
+  802a9b:	a1 44 57 80 00       	mov    0x805744,%eax
+  802aa0:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  802aa6:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  802aa8:	a1 44 57 80 00       	mov    0x805744,%eax
+  802aad:	8b 40 74             	mov    0x74(%eax),%eax
+  802ab0:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  802ab2:	a1 44 57 80 00       	mov    0x805744,%eax
+  802ab7:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  802aba:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802abd:	5b                   	pop    %ebx
+  802abe:	5e                   	pop    %esi
+  802abf:	5f                   	pop    %edi
+  802ac0:	5d                   	pop    %ebp
+  802ac1:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  802ac2:	85 ff                	test   %edi,%edi
+  802ac4:	74 06                	je     802acc <ipc_recv_pages+0x71>
+  802ac6:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  802acc:	85 f6                	test   %esi,%esi
+  802ace:	74 06                	je     802ad6 <ipc_recv_pages+0x7b>
+  802ad0:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  802ad6:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  802adc:	eb dc                	jmp    802aba <ipc_recv_pages+0x5f>
+
+00802ade <ipc_recv>:
+{
+  802ade:	55                   	push   %ebp
+  802adf:	89 e5                	mov    %esp,%ebp
+  802ae1:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  802ae4:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  802aeb:	ff 75 10             	push   0x10(%ebp)
+  802aee:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802af1:	50                   	push   %eax
+  802af2:	ff 75 0c             	push   0xc(%ebp)
+  802af5:	ff 75 08             	push   0x8(%ebp)
+  802af8:	e8 5e ff ff ff       	call   802a5b <ipc_recv_pages>
+}
+  802afd:	c9                   	leave
+  802afe:	c3                   	ret
+
+00802aff <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  802aff:	55                   	push   %ebp
+  802b00:	89 e5                	mov    %esp,%ebp
+  802b02:	57                   	push   %edi
+  802b03:	56                   	push   %esi
+  802b04:	53                   	push   %ebx
+  802b05:	83 ec 0c             	sub    $0xc,%esp
+  802b08:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802b0b:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802b0e:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  802b11:	89 c3                	mov    %eax,%ebx
+  802b13:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  802b19:	85 c0                	test   %eax,%eax
+  802b1b:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802b20:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  802b23:	83 ec 0c             	sub    $0xc,%esp
+  802b26:	ff 75 14             	push   0x14(%ebp)
+  802b29:	ff 75 18             	push   0x18(%ebp)
+  802b2c:	53                   	push   %ebx
+  802b2d:	56                   	push   %esi
+  802b2e:	57                   	push   %edi
+  802b2f:	e8 25 d9 ff ff       	call   800459 <sys_ipc_try_send>
+  802b34:	83 c4 20             	add    $0x20,%esp
+  802b37:	85 c0                	test   %eax,%eax
+  802b39:	79 1e                	jns    802b59 <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  802b3b:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802b3e:	75 07                	jne    802b47 <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  802b40:	e8 fb d5 ff ff       	call   800140 <sys_yield>
+  802b45:	eb dc                	jmp    802b23 <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  802b47:	50                   	push   %eax
+  802b48:	68 c3 32 80 00       	push   $0x8032c3
+  802b4d:	6a 5c                	push   $0x5c
+  802b4f:	68 d0 32 80 00       	push   $0x8032d0
+  802b54:	e8 09 f5 ff ff       	call   802062 <_panic>
+  }
+}
+  802b59:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b5c:	5b                   	pop    %ebx
+  802b5d:	5e                   	pop    %esi
+  802b5e:	5f                   	pop    %edi
+  802b5f:	5d                   	pop    %ebp
+  802b60:	c3                   	ret
+
+00802b61 <ipc_send>:
+{
+  802b61:	55                   	push   %ebp
+  802b62:	89 e5                	mov    %esp,%ebp
+  802b64:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  802b67:	ff 75 14             	push   0x14(%ebp)
+  802b6a:	6a 01                	push   $0x1
+  802b6c:	ff 75 10             	push   0x10(%ebp)
+  802b6f:	ff 75 0c             	push   0xc(%ebp)
+  802b72:	ff 75 08             	push   0x8(%ebp)
+  802b75:	e8 85 ff ff ff       	call   802aff <ipc_send_pages>
+}
+  802b7a:	83 c4 20             	add    $0x20,%esp
+  802b7d:	c9                   	leave
+  802b7e:	c3                   	ret
+
+00802b7f <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802b7f:	55                   	push   %ebp
+  802b80:	89 e5                	mov    %esp,%ebp
+  802b82:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  802b85:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  802b8a:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802b8d:	c1 e0 04             	shl    $0x4,%eax
+  802b90:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802b95:	8b 40 50             	mov    0x50(%eax),%eax
+  802b98:	39 c8                	cmp    %ecx,%eax
+  802b9a:	74 12                	je     802bae <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  802b9c:	83 c2 01             	add    $0x1,%edx
+  802b9f:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802ba5:	75 e3                	jne    802b8a <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  802ba7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bac:	eb 0e                	jmp    802bbc <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  802bae:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802bb1:	c1 e0 04             	shl    $0x4,%eax
+  802bb4:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802bb9:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802bbc:	5d                   	pop    %ebp
+  802bbd:	c3                   	ret
+
+00802bbe <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802bbe:	55                   	push   %ebp
+  802bbf:	89 e5                	mov    %esp,%ebp
+  802bc1:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802bc4:	89 c2                	mov    %eax,%edx
+  802bc6:	c1 ea 16             	shr    $0x16,%edx
+  802bc9:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  802bd0:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802bd5:	f6 c1 01             	test   $0x1,%cl
+  802bd8:	74 1c                	je     802bf6 <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  802bda:	c1 e8 0c             	shr    $0xc,%eax
+  802bdd:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  802be4:	a8 01                	test   $0x1,%al
+  802be6:	74 0e                	je     802bf6 <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  802be8:	c1 e8 0c             	shr    $0xc,%eax
+  802beb:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802bf2:	ef 
+  802bf3:	0f b7 d2             	movzwl %dx,%edx
+}
+  802bf6:	89 d0                	mov    %edx,%eax
+  802bf8:	5d                   	pop    %ebp
+  802bf9:	c3                   	ret
+
+00802bfa <udivmod>:
+  802bfa:	55                   	push   %ebp
+  802bfb:	57                   	push   %edi
+  802bfc:	56                   	push   %esi
+  802bfd:	53                   	push   %ebx
+  802bfe:	83 ec 14             	sub    $0x14,%esp
+  802c01:	8b 74 24 28          	mov    0x28(%esp),%esi
+  802c05:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  802c09:	89 fb                	mov    %edi,%ebx
+  802c0b:	09 f3                	or     %esi,%ebx
+  802c0d:	0f 84 88 00 00 00    	je     802c9b <udivmod+0xa1>
+  802c13:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802c18:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802c1f:	00 
+  802c20:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802c27:	00 
+  802c28:	89 cd                	mov    %ecx,%ebp
+  802c2a:	89 34 24             	mov    %esi,(%esp)
+  802c2d:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802c31:	eb 08                	jmp    802c3b <udivmod+0x41>
+  802c33:	83 ed 01             	sub    $0x1,%ebp
+  802c36:	83 fd ff             	cmp    $0xffffffff,%ebp
+  802c39:	74 6c                	je     802ca7 <udivmod+0xad>
+  802c3b:	89 c3                	mov    %eax,%ebx
+  802c3d:	89 d6                	mov    %edx,%esi
+  802c3f:	89 e9                	mov    %ebp,%ecx
+  802c41:	0f ad f3             	shrd   %cl,%esi,%ebx
+  802c44:	d3 ee                	shr    %cl,%esi
+  802c46:	f6 c1 20             	test   $0x20,%cl
+  802c49:	74 04                	je     802c4f <udivmod+0x55>
+  802c4b:	89 f3                	mov    %esi,%ebx
+  802c4d:	31 f6                	xor    %esi,%esi
+  802c4f:	8b 3c 24             	mov    (%esp),%edi
+  802c52:	39 fb                	cmp    %edi,%ebx
+  802c54:	89 f7                	mov    %esi,%edi
+  802c56:	8b 1c 24             	mov    (%esp),%ebx
+  802c59:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802c5d:	19 f7                	sbb    %esi,%edi
+  802c5f:	72 d2                	jb     802c33 <udivmod+0x39>
+  802c61:	89 f7                	mov    %esi,%edi
+  802c63:	89 de                	mov    %ebx,%esi
+  802c65:	89 e9                	mov    %ebp,%ecx
+  802c67:	0f a5 f7             	shld   %cl,%esi,%edi
+  802c6a:	d3 e6                	shl    %cl,%esi
+  802c6c:	f6 c1 20             	test   $0x20,%cl
+  802c6f:	74 04                	je     802c75 <udivmod+0x7b>
+  802c71:	89 f7                	mov    %esi,%edi
+  802c73:	31 f6                	xor    %esi,%esi
+  802c75:	29 f0                	sub    %esi,%eax
+  802c77:	19 fa                	sbb    %edi,%edx
+  802c79:	be 01 00 00 00       	mov    $0x1,%esi
+  802c7e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c83:	0f a5 f7             	shld   %cl,%esi,%edi
+  802c86:	d3 e6                	shl    %cl,%esi
+  802c88:	f6 c1 20             	test   $0x20,%cl
+  802c8b:	74 04                	je     802c91 <udivmod+0x97>
+  802c8d:	89 f7                	mov    %esi,%edi
+  802c8f:	31 f6                	xor    %esi,%esi
+  802c91:	09 74 24 08          	or     %esi,0x8(%esp)
+  802c95:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802c99:	eb 98                	jmp    802c33 <udivmod+0x39>
+  802c9b:	89 f0                	mov    %esi,%eax
+  802c9d:	89 fa                	mov    %edi,%edx
+  802c9f:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802ca3:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802ca7:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802cab:	89 01                	mov    %eax,(%ecx)
+  802cad:	89 51 04             	mov    %edx,0x4(%ecx)
+  802cb0:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802cb4:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802cb8:	83 c4 14             	add    $0x14,%esp
+  802cbb:	5b                   	pop    %ebx
+  802cbc:	5e                   	pop    %esi
+  802cbd:	5f                   	pop    %edi
+  802cbe:	5d                   	pop    %ebp
+  802cbf:	c3                   	ret
+
+00802cc0 <__udivdi3>:
+  802cc0:	83 ec 18             	sub    $0x18,%esp
+  802cc3:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802cc7:	50                   	push   %eax
+  802cc8:	ff 74 24 2c          	push   0x2c(%esp)
+  802ccc:	ff 74 24 2c          	push   0x2c(%esp)
+  802cd0:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802cd4:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802cd8:	e8 1d ff ff ff       	call   802bfa <udivmod>
+  802cdd:	83 c4 24             	add    $0x24,%esp
+  802ce0:	c3                   	ret
+
+00802ce1 <__umoddi3>:
+  802ce1:	83 ec 18             	sub    $0x18,%esp
+  802ce4:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802ce8:	50                   	push   %eax
+  802ce9:	ff 74 24 2c          	push   0x2c(%esp)
+  802ced:	ff 74 24 2c          	push   0x2c(%esp)
+  802cf1:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802cf5:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802cf9:	e8 fc fe ff ff       	call   802bfa <udivmod>
+  802cfe:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802d02:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802d06:	83 c4 24             	add    $0x24,%esp
+  802d09:	c3                   	ret
+
+00802d0a <__divdi3>:
+  802d0a:	56                   	push   %esi
+  802d0b:	53                   	push   %ebx
+  802d0c:	83 ec 14             	sub    $0x14,%esp
+  802d0f:	8b 44 24 20          	mov    0x20(%esp),%eax
+  802d13:	8b 54 24 24          	mov    0x24(%esp),%edx
+  802d17:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  802d1b:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  802d1f:	85 d2                	test   %edx,%edx
+  802d21:	78 18                	js     802d3b <__divdi3+0x31>
+  802d23:	85 db                	test   %ebx,%ebx
+  802d25:	78 3e                	js     802d65 <__divdi3+0x5b>
+  802d27:	83 ec 04             	sub    $0x4,%esp
+  802d2a:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802d2e:	56                   	push   %esi
+  802d2f:	53                   	push   %ebx
+  802d30:	51                   	push   %ecx
+  802d31:	e8 c4 fe ff ff       	call   802bfa <udivmod>
+  802d36:	83 c4 10             	add    $0x10,%esp
+  802d39:	eb 24                	jmp    802d5f <__divdi3+0x55>
+  802d3b:	f7 d8                	neg    %eax
+  802d3d:	83 d2 00             	adc    $0x0,%edx
+  802d40:	f7 da                	neg    %edx
+  802d42:	85 db                	test   %ebx,%ebx
+  802d44:	78 3a                	js     802d80 <__divdi3+0x76>
+  802d46:	83 ec 04             	sub    $0x4,%esp
+  802d49:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802d4d:	56                   	push   %esi
+  802d4e:	53                   	push   %ebx
+  802d4f:	51                   	push   %ecx
+  802d50:	e8 a5 fe ff ff       	call   802bfa <udivmod>
+  802d55:	83 c4 10             	add    $0x10,%esp
+  802d58:	f7 d8                	neg    %eax
+  802d5a:	83 d2 00             	adc    $0x0,%edx
+  802d5d:	f7 da                	neg    %edx
+  802d5f:	83 c4 14             	add    $0x14,%esp
+  802d62:	5b                   	pop    %ebx
+  802d63:	5e                   	pop    %esi
+  802d64:	c3                   	ret
+  802d65:	83 ec 04             	sub    $0x4,%esp
+  802d68:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802d6c:	56                   	push   %esi
+  802d6d:	f7 d9                	neg    %ecx
+  802d6f:	83 d3 00             	adc    $0x0,%ebx
+  802d72:	f7 db                	neg    %ebx
+  802d74:	53                   	push   %ebx
+  802d75:	51                   	push   %ecx
+  802d76:	e8 7f fe ff ff       	call   802bfa <udivmod>
+  802d7b:	83 c4 10             	add    $0x10,%esp
+  802d7e:	eb d8                	jmp    802d58 <__divdi3+0x4e>
+  802d80:	83 ec 04             	sub    $0x4,%esp
+  802d83:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802d87:	56                   	push   %esi
+  802d88:	f7 d9                	neg    %ecx
+  802d8a:	83 d3 00             	adc    $0x0,%ebx
+  802d8d:	f7 db                	neg    %ebx
+  802d8f:	53                   	push   %ebx
+  802d90:	51                   	push   %ecx
+  802d91:	e8 64 fe ff ff       	call   802bfa <udivmod>
+  802d96:	83 c4 10             	add    $0x10,%esp
+  802d99:	eb c4                	jmp    802d5f <__divdi3+0x55>
+
+00802d9b <__moddi3>:
+  802d9b:	55                   	push   %ebp
+  802d9c:	57                   	push   %edi
+  802d9d:	56                   	push   %esi
+  802d9e:	53                   	push   %ebx
+  802d9f:	83 ec 24             	sub    $0x24,%esp
+  802da2:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802da6:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802daa:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  802dae:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  802db2:	85 d2                	test   %edx,%edx
+  802db4:	78 3b                	js     802df1 <__moddi3+0x56>
+  802db6:	83 ec 04             	sub    $0x4,%esp
+  802db9:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  802dbd:	56                   	push   %esi
+  802dbe:	89 ce                	mov    %ecx,%esi
+  802dc0:	f7 de                	neg    %esi
+  802dc2:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802dc6:	89 de                	mov    %ebx,%esi
+  802dc8:	83 d6 00             	adc    $0x0,%esi
+  802dcb:	f7 de                	neg    %esi
+  802dcd:	89 74 24 14          	mov    %esi,0x14(%esp)
+  802dd1:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802dd5:	0f 48 f1             	cmovs  %ecx,%esi
+  802dd8:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  802ddd:	53                   	push   %ebx
+  802dde:	56                   	push   %esi
+  802ddf:	e8 16 fe ff ff       	call   802bfa <udivmod>
+  802de4:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802de8:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802dec:	83 c4 10             	add    $0x10,%esp
+  802def:	eb 47                	jmp    802e38 <__moddi3+0x9d>
+  802df1:	f7 d8                	neg    %eax
+  802df3:	83 d2 00             	adc    $0x0,%edx
+  802df6:	f7 da                	neg    %edx
+  802df8:	83 ec 04             	sub    $0x4,%esp
+  802dfb:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  802dff:	56                   	push   %esi
+  802e00:	89 cf                	mov    %ecx,%edi
+  802e02:	f7 df                	neg    %edi
+  802e04:	89 de                	mov    %ebx,%esi
+  802e06:	83 d6 00             	adc    $0x0,%esi
+  802e09:	f7 de                	neg    %esi
+  802e0b:	0f 49 cf             	cmovns %edi,%ecx
+  802e0e:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802e12:	0f 49 de             	cmovns %esi,%ebx
+  802e15:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  802e19:	ff 74 24 0c          	push   0xc(%esp)
+  802e1d:	ff 74 24 0c          	push   0xc(%esp)
+  802e21:	e8 d4 fd ff ff       	call   802bfa <udivmod>
+  802e26:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802e2a:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802e2e:	f7 d8                	neg    %eax
+  802e30:	83 d2 00             	adc    $0x0,%edx
+  802e33:	f7 da                	neg    %edx
+  802e35:	83 c4 10             	add    $0x10,%esp
+  802e38:	83 c4 24             	add    $0x24,%esp
+  802e3b:	5b                   	pop    %ebx
+  802e3c:	5e                   	pop    %esi
+  802e3d:	5f                   	pop    %edi
+  802e3e:	5d                   	pop    %ebp
+  802e3f:	c3                   	ret
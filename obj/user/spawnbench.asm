@@ -0,0 +1,7263 @@
+
+obj/user/spawnbench.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 23 01 00 00       	call   800154 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <run>:
+
+#include <inc/lib.h>
+
+static unsigned
+run(int n)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 2c             	sub    $0x2c,%esp
+  80003c:	89 c6                	mov    %eax,%esi
+  const char *argv[] = { "spawnbench", "child", 0 };
+  80003e:	c7 45 dc 60 37 80 00 	movl   $0x803760,-0x24(%ebp)
+  800045:	c7 45 e0 6b 37 80 00 	movl   $0x80376b,-0x20(%ebp)
+  80004c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  unsigned start;
+  envid_t child;
+  int i;
+
+  start = sys_time_msec();
+  800053:	e8 7b 0f 00 00       	call   800fd3 <sys_time_msec>
+  800058:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  for (i = 0; i < n; i++) {
+  80005b:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if ((child = spawn("spawnbench", argv)) < 0)
+  800060:	8d 7d dc             	lea    -0x24(%ebp),%edi
+  for (i = 0; i < n; i++) {
+  800063:	39 f3                	cmp    %esi,%ebx
+  800065:	7d 38                	jge    80009f <run+0x6c>
+    if ((child = spawn("spawnbench", argv)) < 0)
+  800067:	83 ec 08             	sub    $0x8,%esp
+  80006a:	57                   	push   %edi
+  80006b:	68 60 37 80 00       	push   $0x803760
+  800070:	e8 24 21 00 00       	call   802199 <spawn>
+  800075:	83 c4 10             	add    $0x10,%esp
+  800078:	85 c0                	test   %eax,%eax
+  80007a:	78 11                	js     80008d <run+0x5a>
+      panic("spawn: %e", child);
+    wait(child);
+  80007c:	83 ec 0c             	sub    $0xc,%esp
+  80007f:	50                   	push   %eax
+  800080:	e8 27 31 00 00       	call   8031ac <wait>
+  for (i = 0; i < n; i++) {
+  800085:	83 c3 01             	add    $0x1,%ebx
+  800088:	83 c4 10             	add    $0x10,%esp
+  80008b:	eb d6                	jmp    800063 <run+0x30>
+      panic("spawn: %e", child);
+  80008d:	50                   	push   %eax
+  80008e:	68 71 37 80 00       	push   $0x803771
+  800093:	6a 13                	push   $0x13
+  800095:	68 7b 37 80 00       	push   $0x80377b
+  80009a:	e8 22 01 00 00       	call   8001c1 <_panic>
+  }
+  return sys_time_msec() - start;
+  80009f:	e8 2f 0f 00 00       	call   800fd3 <sys_time_msec>
+  8000a4:	8b 55 d4             	mov    -0x2c(%ebp),%edx
+  8000a7:	29 d0                	sub    %edx,%eax
+}
+  8000a9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8000ac:	5b                   	pop    %ebx
+  8000ad:	5e                   	pop    %esi
+  8000ae:	5f                   	pop    %edi
+  8000af:	5d                   	pop    %ebp
+  8000b0:	c3                   	ret
+
+008000b1 <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  8000b1:	55                   	push   %ebp
+  8000b2:	89 e5                	mov    %esp,%ebp
+  8000b4:	56                   	push   %esi
+  8000b5:	53                   	push   %ebx
+  unsigned batched, serial;
+  int n;
+
+  binaryname = "spawnbench";
+  8000b6:	c7 05 00 40 80 00 60 	movl   $0x803760,0x804000
+  8000bd:	37 80 00 
+  if (argc > 1 && strcmp(argv[1], "child") == 0)
+  8000c0:	83 7d 08 01          	cmpl   $0x1,0x8(%ebp)
+  8000c4:	7e 33                	jle    8000f9 <umain+0x48>
+  8000c6:	83 ec 08             	sub    $0x8,%esp
+  8000c9:	68 6b 37 80 00       	push   $0x80376b
+  8000ce:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8000d1:	ff 70 04             	push   0x4(%eax)
+  8000d4:	e8 62 08 00 00       	call   80093b <strcmp>
+  8000d9:	83 c4 10             	add    $0x10,%esp
+  8000dc:	85 c0                	test   %eax,%eax
+  8000de:	74 6d                	je     80014d <umain+0x9c>
+    return;
+
+  n = 20;
+  if (argc > 1)
+    n = strtol(argv[1], 0, 0);
+  8000e0:	83 ec 04             	sub    $0x4,%esp
+  8000e3:	6a 00                	push   $0x0
+  8000e5:	6a 00                	push   $0x0
+  8000e7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8000ea:	ff 70 04             	push   0x4(%eax)
+  8000ed:	e8 ec 09 00 00       	call   800ade <strtol>
+  8000f2:	89 c6                	mov    %eax,%esi
+  8000f4:	83 c4 10             	add    $0x10,%esp
+  8000f7:	eb 05                	jmp    8000fe <umain+0x4d>
+  n = 20;
+  8000f9:	be 14 00 00 00       	mov    $0x14,%esi
+
+  sysbatch_serial = 0;
+  8000fe:	c6 05 68 5e 80 00 00 	movb   $0x0,0x805e68
+  batched = run(n);
+  800105:	89 f0                	mov    %esi,%eax
+  800107:	e8 27 ff ff ff       	call   800033 <run>
+  80010c:	89 c3                	mov    %eax,%ebx
+  sysbatch_serial = 1;
+  80010e:	c6 05 68 5e 80 00 01 	movb   $0x1,0x805e68
+  serial = run(n);
+  800115:	89 f0                	mov    %esi,%eax
+  800117:	e8 17 ff ff ff       	call   800033 <run>
+  sysbatch_serial = 0;
+  80011c:	c6 05 68 5e 80 00 00 	movb   $0x0,0x805e68
+
+  cprintf("spawnbench: %d spawns  batched %d us/spawn  unbatched %d us/spawn\n",
+          n, batched * 1000 / n, serial * 1000 / n);
+  800123:	69 c0 e8 03 00 00    	imul   $0x3e8,%eax,%eax
+  cprintf("spawnbench: %d spawns  batched %d us/spawn  unbatched %d us/spawn\n",
+  800129:	ba 00 00 00 00       	mov    $0x0,%edx
+  80012e:	f7 f6                	div    %esi
+  800130:	50                   	push   %eax
+          n, batched * 1000 / n, serial * 1000 / n);
+  800131:	69 c3 e8 03 00 00    	imul   $0x3e8,%ebx,%eax
+  cprintf("spawnbench: %d spawns  batched %d us/spawn  unbatched %d us/spawn\n",
+  800137:	ba 00 00 00 00       	mov    $0x0,%edx
+  80013c:	f7 f6                	div    %esi
+  80013e:	50                   	push   %eax
+  80013f:	56                   	push   %esi
+  800140:	68 90 37 80 00       	push   $0x803790
+  800145:	e8 52 01 00 00       	call   80029c <cprintf>
+  80014a:	83 c4 10             	add    $0x10,%esp
+}
+  80014d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800150:	5b                   	pop    %ebx
+  800151:	5e                   	pop    %esi
+  800152:	5d                   	pop    %ebp
+  800153:	c3                   	ret
+
+00800154 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  800154:	55                   	push   %ebp
+  800155:	89 e5                	mov    %esp,%ebp
+  800157:	56                   	push   %esi
+  800158:	53                   	push   %ebx
+  800159:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  80015c:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  80015f:	c7 05 64 5e 80 00 00 	movl   $0x0,0x805e64
+  800166:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  800169:	e8 ca 0a 00 00       	call   800c38 <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  80016e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800173:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  800176:	c1 e0 04             	shl    $0x4,%eax
+  800179:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80017e:	a3 64 5e 80 00       	mov    %eax,0x805e64
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800183:	85 db                	test   %ebx,%ebx
+  800185:	7e 07                	jle    80018e <libmain+0x3a>
+    binaryname = argv[0];
+  800187:	8b 06                	mov    (%esi),%eax
+  800189:	a3 00 40 80 00       	mov    %eax,0x804000
+
+  // call user main routine
+  umain(argc, argv);
+  80018e:	83 ec 08             	sub    $0x8,%esp
+  800191:	56                   	push   %esi
+  800192:	53                   	push   %ebx
+  800193:	e8 19 ff ff ff       	call   8000b1 <umain>
+
+  // exit gracefully
+  exit();
+  800198:	e8 0a 00 00 00       	call   8001a7 <exit>
+}
+  80019d:	83 c4 10             	add    $0x10,%esp
+  8001a0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8001a3:	5b                   	pop    %ebx
+  8001a4:	5e                   	pop    %esi
+  8001a5:	5d                   	pop    %ebp
+  8001a6:	c3                   	ret
+
+008001a7 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8001a7:	55                   	push   %ebp
+  8001a8:	89 e5                	mov    %esp,%ebp
+  8001aa:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  8001ad:	e8 80 11 00 00       	call   801332 <close_all>
+  sys_env_destroy(0);
+  8001b2:	83 ec 0c             	sub    $0xc,%esp
+  8001b5:	6a 00                	push   $0x0
+  8001b7:	e8 3b 0a 00 00       	call   800bf7 <sys_env_destroy>
+}
+  8001bc:	83 c4 10             	add    $0x10,%esp
+  8001bf:	c9                   	leave
+  8001c0:	c3                   	ret
+
+008001c1 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8001c1:	55                   	push   %ebp
+  8001c2:	89 e5                	mov    %esp,%ebp
+  8001c4:	56                   	push   %esi
+  8001c5:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  8001c6:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  8001c9:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  8001cf:	e8 64 0a 00 00       	call   800c38 <sys_getenvid>
+  8001d4:	83 ec 0c             	sub    $0xc,%esp
+  8001d7:	ff 75 0c             	push   0xc(%ebp)
+  8001da:	ff 75 08             	push   0x8(%ebp)
+  8001dd:	56                   	push   %esi
+  8001de:	50                   	push   %eax
+  8001df:	68 e0 37 80 00       	push   $0x8037e0
+  8001e4:	e8 b3 00 00 00       	call   80029c <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  8001e9:	83 c4 18             	add    $0x18,%esp
+  8001ec:	53                   	push   %ebx
+  8001ed:	ff 75 10             	push   0x10(%ebp)
+  8001f0:	e8 56 00 00 00       	call   80024b <vcprintf>
+  cprintf("\n");
+  8001f5:	c7 04 24 9d 3c 80 00 	movl   $0x803c9d,(%esp)
+  8001fc:	e8 9b 00 00 00       	call   80029c <cprintf>
+  800201:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  800204:	cc                   	int3
+  while (1)
+  800205:	eb fd                	jmp    800204 <_panic+0x43>
+
+00800207 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800207:	55                   	push   %ebp
+  800208:	89 e5                	mov    %esp,%ebp
+  80020a:	53                   	push   %ebx
+  80020b:	83 ec 04             	sub    $0x4,%esp
+  80020e:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  800211:	8b 13                	mov    (%ebx),%edx
+  800213:	8d 42 01             	lea    0x1(%edx),%eax
+  800216:	89 03                	mov    %eax,(%ebx)
+  800218:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80021b:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  80021f:	3d ff 00 00 00       	cmp    $0xff,%eax
+  800224:	74 09                	je     80022f <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  800226:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  80022a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80022d:	c9                   	leave
+  80022e:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  80022f:	83 ec 08             	sub    $0x8,%esp
+  800232:	68 ff 00 00 00       	push   $0xff
+  800237:	8d 43 08             	lea    0x8(%ebx),%eax
+  80023a:	50                   	push   %eax
+  80023b:	e8 7a 09 00 00       	call   800bba <sys_cputs>
+    b->idx = 0;
+  800240:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800246:	83 c4 10             	add    $0x10,%esp
+  800249:	eb db                	jmp    800226 <putch+0x1f>
+
+0080024b <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  80024b:	55                   	push   %ebp
+  80024c:	89 e5                	mov    %esp,%ebp
+  80024e:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  800254:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  80025b:	00 00 00 
+  b.cnt = 0;
+  80025e:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800265:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  800268:	ff 75 0c             	push   0xc(%ebp)
+  80026b:	ff 75 08             	push   0x8(%ebp)
+  80026e:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  800274:	50                   	push   %eax
+  800275:	68 07 02 80 00       	push   $0x800207
+  80027a:	e8 14 01 00 00       	call   800393 <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  80027f:	83 c4 08             	add    $0x8,%esp
+  800282:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800288:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80028e:	50                   	push   %eax
+  80028f:	e8 26 09 00 00       	call   800bba <sys_cputs>
+
+  return b.cnt;
+}
+  800294:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  80029a:	c9                   	leave
+  80029b:	c3                   	ret
+
+0080029c <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80029c:	55                   	push   %ebp
+  80029d:	89 e5                	mov    %esp,%ebp
+  80029f:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  8002a2:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  8002a5:	50                   	push   %eax
+  8002a6:	ff 75 08             	push   0x8(%ebp)
+  8002a9:	e8 9d ff ff ff       	call   80024b <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  8002ae:	c9                   	leave
+  8002af:	c3                   	ret
+
+008002b0 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  8002b0:	55                   	push   %ebp
+  8002b1:	89 e5                	mov    %esp,%ebp
+  8002b3:	57                   	push   %edi
+  8002b4:	56                   	push   %esi
+  8002b5:	53                   	push   %ebx
+  8002b6:	83 ec 1c             	sub    $0x1c,%esp
+  8002b9:	89 c7                	mov    %eax,%edi
+  8002bb:	89 d6                	mov    %edx,%esi
+  8002bd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002c0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8002c3:	89 d1                	mov    %edx,%ecx
+  8002c5:	89 c2                	mov    %eax,%edx
+  8002c7:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8002ca:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8002cd:	8b 45 10             	mov    0x10(%ebp),%eax
+  8002d0:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  8002d3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8002d6:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8002dd:	39 c2                	cmp    %eax,%edx
+  8002df:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8002e2:	72 3e                	jb     800322 <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  8002e4:	83 ec 0c             	sub    $0xc,%esp
+  8002e7:	ff 75 18             	push   0x18(%ebp)
+  8002ea:	83 eb 01             	sub    $0x1,%ebx
+  8002ed:	53                   	push   %ebx
+  8002ee:	50                   	push   %eax
+  8002ef:	83 ec 08             	sub    $0x8,%esp
+  8002f2:	ff 75 e4             	push   -0x1c(%ebp)
+  8002f5:	ff 75 e0             	push   -0x20(%ebp)
+  8002f8:	ff 75 dc             	push   -0x24(%ebp)
+  8002fb:	ff 75 d8             	push   -0x28(%ebp)
+  8002fe:	e8 d3 32 00 00       	call   8035d6 <__udivdi3>
+  800303:	83 c4 18             	add    $0x18,%esp
+  800306:	52                   	push   %edx
+  800307:	50                   	push   %eax
+  800308:	89 f2                	mov    %esi,%edx
+  80030a:	89 f8                	mov    %edi,%eax
+  80030c:	e8 9f ff ff ff       	call   8002b0 <printnum>
+  800311:	83 c4 20             	add    $0x20,%esp
+  800314:	eb 13                	jmp    800329 <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  800316:	83 ec 08             	sub    $0x8,%esp
+  800319:	56                   	push   %esi
+  80031a:	ff 75 18             	push   0x18(%ebp)
+  80031d:	ff d7                	call   *%edi
+  80031f:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  800322:	83 eb 01             	sub    $0x1,%ebx
+  800325:	85 db                	test   %ebx,%ebx
+  800327:	7f ed                	jg     800316 <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  800329:	83 ec 08             	sub    $0x8,%esp
+  80032c:	56                   	push   %esi
+  80032d:	83 ec 04             	sub    $0x4,%esp
+  800330:	ff 75 e4             	push   -0x1c(%ebp)
+  800333:	ff 75 e0             	push   -0x20(%ebp)
+  800336:	ff 75 dc             	push   -0x24(%ebp)
+  800339:	ff 75 d8             	push   -0x28(%ebp)
+  80033c:	e8 b6 32 00 00       	call   8035f7 <__umoddi3>
+  800341:	83 c4 14             	add    $0x14,%esp
+  800344:	0f be 80 03 38 80 00 	movsbl 0x803803(%eax),%eax
+  80034b:	50                   	push   %eax
+  80034c:	ff d7                	call   *%edi
+}
+  80034e:	83 c4 10             	add    $0x10,%esp
+  800351:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800354:	5b                   	pop    %ebx
+  800355:	5e                   	pop    %esi
+  800356:	5f                   	pop    %edi
+  800357:	5d                   	pop    %ebp
+  800358:	c3                   	ret
+
+00800359 <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800359:	55                   	push   %ebp
+  80035a:	89 e5                	mov    %esp,%ebp
+  80035c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  80035f:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  800363:	8b 10                	mov    (%eax),%edx
+  800365:	3b 50 04             	cmp    0x4(%eax),%edx
+  800368:	73 0a                	jae    800374 <sprintputch+0x1b>
+    *b->buf++ = ch;
+  80036a:	8d 4a 01             	lea    0x1(%edx),%ecx
+  80036d:	89 08                	mov    %ecx,(%eax)
+  80036f:	8b 45 08             	mov    0x8(%ebp),%eax
+  800372:	88 02                	mov    %al,(%edx)
+}
+  800374:	5d                   	pop    %ebp
+  800375:	c3                   	ret
+
+00800376 <printfmt>:
+{
+  800376:	55                   	push   %ebp
+  800377:	89 e5                	mov    %esp,%ebp
+  800379:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  80037c:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  80037f:	50                   	push   %eax
+  800380:	ff 75 10             	push   0x10(%ebp)
+  800383:	ff 75 0c             	push   0xc(%ebp)
+  800386:	ff 75 08             	push   0x8(%ebp)
+  800389:	e8 05 00 00 00       	call   800393 <vprintfmt>
+}
+  80038e:	83 c4 10             	add    $0x10,%esp
+  800391:	c9                   	leave
+  800392:	c3                   	ret
+
+00800393 <vprintfmt>:
+{
+  800393:	55                   	push   %ebp
+  800394:	89 e5                	mov    %esp,%ebp
+  800396:	57                   	push   %edi
+  800397:	56                   	push   %esi
+  800398:	53                   	push   %ebx
+  800399:	83 ec 2c             	sub    $0x2c,%esp
+  80039c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80039f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8003a2:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8003a5:	eb 0a                	jmp    8003b1 <vprintfmt+0x1e>
+      putch(ch, putdat);
+  8003a7:	83 ec 08             	sub    $0x8,%esp
+  8003aa:	53                   	push   %ebx
+  8003ab:	50                   	push   %eax
+  8003ac:	ff d6                	call   *%esi
+  8003ae:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  8003b1:	83 c7 01             	add    $0x1,%edi
+  8003b4:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8003b8:	83 f8 25             	cmp    $0x25,%eax
+  8003bb:	74 0c                	je     8003c9 <vprintfmt+0x36>
+      if (ch == '\0')
+  8003bd:	85 c0                	test   %eax,%eax
+  8003bf:	75 e6                	jne    8003a7 <vprintfmt+0x14>
+}
+  8003c1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003c4:	5b                   	pop    %ebx
+  8003c5:	5e                   	pop    %esi
+  8003c6:	5f                   	pop    %edi
+  8003c7:	5d                   	pop    %ebp
+  8003c8:	c3                   	ret
+    padc = ' ';
+  8003c9:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  8003cd:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  8003d4:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  8003db:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  8003e2:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  8003e7:	8d 47 01             	lea    0x1(%edi),%eax
+  8003ea:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8003ed:	0f b6 17             	movzbl (%edi),%edx
+  8003f0:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8003f3:	3c 55                	cmp    $0x55,%al
+  8003f5:	0f 87 cf 03 00 00    	ja     8007ca <vprintfmt+0x437>
+  8003fb:	0f b6 c0             	movzbl %al,%eax
+  8003fe:	ff 24 85 40 39 80 00 	jmp    *0x803940(,%eax,4)
+  800405:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  800408:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80040c:	eb d9                	jmp    8003e7 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  80040e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800411:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800415:	eb d0                	jmp    8003e7 <vprintfmt+0x54>
+  800417:	0f b6 d2             	movzbl %dl,%edx
+  80041a:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  80041d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800422:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  800425:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800428:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  80042c:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  80042f:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800432:	83 f9 09             	cmp    $0x9,%ecx
+  800435:	77 55                	ja     80048c <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  800437:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  80043a:	eb e9                	jmp    800425 <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  80043c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80043f:	8b 00                	mov    (%eax),%eax
+  800441:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800444:	8b 45 14             	mov    0x14(%ebp),%eax
+  800447:	8d 40 04             	lea    0x4(%eax),%eax
+  80044a:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  80044d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  800450:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800454:	79 91                	jns    8003e7 <vprintfmt+0x54>
+        width = precision, precision = -1;
+  800456:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800459:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80045c:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  800463:	eb 82                	jmp    8003e7 <vprintfmt+0x54>
+      if (width < 0)
+  800465:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800468:	85 d2                	test   %edx,%edx
+  80046a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80046f:	0f 49 c2             	cmovns %edx,%eax
+  800472:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  800475:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  800478:	e9 6a ff ff ff       	jmp    8003e7 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  80047d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  800480:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  800487:	e9 5b ff ff ff       	jmp    8003e7 <vprintfmt+0x54>
+  80048c:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80048f:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800492:	eb bc                	jmp    800450 <vprintfmt+0xbd>
+      lflag++;
+  800494:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  800497:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  80049a:	e9 48 ff ff ff       	jmp    8003e7 <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  80049f:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004a2:	8d 78 04             	lea    0x4(%eax),%edi
+  8004a5:	83 ec 08             	sub    $0x8,%esp
+  8004a8:	53                   	push   %ebx
+  8004a9:	ff 30                	push   (%eax)
+  8004ab:	ff d6                	call   *%esi
+      break;
+  8004ad:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  8004b0:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  8004b3:	e9 b1 02 00 00       	jmp    800769 <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  8004b8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004bb:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  8004be:	8b 10                	mov    (%eax),%edx
+  8004c0:	89 d0                	mov    %edx,%eax
+  8004c2:	f7 d8                	neg    %eax
+  8004c4:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8004c7:	83 f8 10             	cmp    $0x10,%eax
+  8004ca:	7f 23                	jg     8004ef <vprintfmt+0x15c>
+  8004cc:	8b 14 85 a0 3a 80 00 	mov    0x803aa0(,%eax,4),%edx
+  8004d3:	85 d2                	test   %edx,%edx
+  8004d5:	74 18                	je     8004ef <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  8004d7:	52                   	push   %edx
+  8004d8:	68 ea 3b 80 00       	push   $0x803bea
+  8004dd:	53                   	push   %ebx
+  8004de:	56                   	push   %esi
+  8004df:	e8 92 fe ff ff       	call   800376 <printfmt>
+  8004e4:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  8004e7:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8004ea:	e9 7a 02 00 00       	jmp    800769 <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  8004ef:	50                   	push   %eax
+  8004f0:	68 1b 38 80 00       	push   $0x80381b
+  8004f5:	53                   	push   %ebx
+  8004f6:	56                   	push   %esi
+  8004f7:	e8 7a fe ff ff       	call   800376 <printfmt>
+  8004fc:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  8004ff:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  800502:	e9 62 02 00 00       	jmp    800769 <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  800507:	8b 45 14             	mov    0x14(%ebp),%eax
+  80050a:	83 c0 04             	add    $0x4,%eax
+  80050d:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800510:	8b 45 14             	mov    0x14(%ebp),%eax
+  800513:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  800515:	85 c9                	test   %ecx,%ecx
+  800517:	b8 14 38 80 00       	mov    $0x803814,%eax
+  80051c:	0f 45 c1             	cmovne %ecx,%eax
+  80051f:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  800522:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800526:	7e 06                	jle    80052e <vprintfmt+0x19b>
+  800528:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  80052c:	75 0b                	jne    800539 <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  80052e:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800531:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800534:	89 75 08             	mov    %esi,0x8(%ebp)
+  800537:	eb 5c                	jmp    800595 <vprintfmt+0x202>
+  800539:	83 ec 08             	sub    $0x8,%esp
+  80053c:	ff 75 d0             	push   -0x30(%ebp)
+  80053f:	ff 75 cc             	push   -0x34(%ebp)
+  800542:	e8 20 03 00 00       	call   800867 <strnlen>
+  800547:	89 c2                	mov    %eax,%edx
+  800549:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80054c:	29 d0                	sub    %edx,%eax
+  80054e:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  800551:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800555:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800558:	89 75 08             	mov    %esi,0x8(%ebp)
+  80055b:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  80055d:	eb 0e                	jmp    80056d <vprintfmt+0x1da>
+          putch(padc, putdat);
+  80055f:	83 ec 08             	sub    $0x8,%esp
+  800562:	53                   	push   %ebx
+  800563:	57                   	push   %edi
+  800564:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800567:	83 ee 01             	sub    $0x1,%esi
+  80056a:	83 c4 10             	add    $0x10,%esp
+  80056d:	85 f6                	test   %esi,%esi
+  80056f:	7f ee                	jg     80055f <vprintfmt+0x1cc>
+  800571:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800574:	8b 75 08             	mov    0x8(%ebp),%esi
+  800577:	85 c0                	test   %eax,%eax
+  800579:	ba 00 00 00 00       	mov    $0x0,%edx
+  80057e:	0f 49 d0             	cmovns %eax,%edx
+  800581:	29 d0                	sub    %edx,%eax
+  800583:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800586:	eb a6                	jmp    80052e <vprintfmt+0x19b>
+          putch(ch, putdat);
+  800588:	83 ec 08             	sub    $0x8,%esp
+  80058b:	53                   	push   %ebx
+  80058c:	52                   	push   %edx
+  80058d:	ff 55 08             	call   *0x8(%ebp)
+  800590:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800593:	89 f1                	mov    %esi,%ecx
+  800595:	8d 71 01             	lea    0x1(%ecx),%esi
+  800598:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80059c:	0f be d0             	movsbl %al,%edx
+  80059f:	85 d2                	test   %edx,%edx
+  8005a1:	74 28                	je     8005cb <vprintfmt+0x238>
+  8005a3:	85 ff                	test   %edi,%edi
+  8005a5:	78 05                	js     8005ac <vprintfmt+0x219>
+  8005a7:	83 ef 01             	sub    $0x1,%edi
+  8005aa:	78 30                	js     8005dc <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  8005ac:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8005b0:	74 d6                	je     800588 <vprintfmt+0x1f5>
+  8005b2:	0f be c0             	movsbl %al,%eax
+  8005b5:	83 e8 20             	sub    $0x20,%eax
+  8005b8:	83 f8 5e             	cmp    $0x5e,%eax
+  8005bb:	76 cb                	jbe    800588 <vprintfmt+0x1f5>
+          putch('?', putdat);
+  8005bd:	83 ec 08             	sub    $0x8,%esp
+  8005c0:	53                   	push   %ebx
+  8005c1:	6a 3f                	push   $0x3f
+  8005c3:	ff 55 08             	call   *0x8(%ebp)
+  8005c6:	83 c4 10             	add    $0x10,%esp
+  8005c9:	eb c8                	jmp    800593 <vprintfmt+0x200>
+  8005cb:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005ce:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8005d1:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8005d4:	01 d0                	add    %edx,%eax
+  8005d6:	29 c8                	sub    %ecx,%eax
+  8005d8:	89 c7                	mov    %eax,%edi
+  8005da:	eb 13                	jmp    8005ef <vprintfmt+0x25c>
+  8005dc:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005df:	eb ed                	jmp    8005ce <vprintfmt+0x23b>
+        putch(' ', putdat);
+  8005e1:	83 ec 08             	sub    $0x8,%esp
+  8005e4:	53                   	push   %ebx
+  8005e5:	6a 20                	push   $0x20
+  8005e7:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  8005e9:	83 ef 01             	sub    $0x1,%edi
+  8005ec:	83 c4 10             	add    $0x10,%esp
+  8005ef:	85 ff                	test   %edi,%edi
+  8005f1:	7f ee                	jg     8005e1 <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  8005f3:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8005f6:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005f9:	e9 6b 01 00 00       	jmp    800769 <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  8005fe:	83 f9 01             	cmp    $0x1,%ecx
+  800601:	7f 1f                	jg     800622 <vprintfmt+0x28f>
+  else if (lflag)
+  800603:	85 c9                	test   %ecx,%ecx
+  800605:	74 67                	je     80066e <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  800607:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060a:	8b 00                	mov    (%eax),%eax
+  80060c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80060f:	89 c1                	mov    %eax,%ecx
+  800611:	c1 f9 1f             	sar    $0x1f,%ecx
+  800614:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800617:	8b 45 14             	mov    0x14(%ebp),%eax
+  80061a:	8d 40 04             	lea    0x4(%eax),%eax
+  80061d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800620:	eb 17                	jmp    800639 <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  800622:	8b 45 14             	mov    0x14(%ebp),%eax
+  800625:	8b 50 04             	mov    0x4(%eax),%edx
+  800628:	8b 00                	mov    (%eax),%eax
+  80062a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80062d:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800630:	8b 45 14             	mov    0x14(%ebp),%eax
+  800633:	8d 40 08             	lea    0x8(%eax),%eax
+  800636:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  800639:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80063c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  80063f:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  800644:	85 c9                	test   %ecx,%ecx
+  800646:	0f 89 03 01 00 00    	jns    80074f <vprintfmt+0x3bc>
+        putch('-', putdat);
+  80064c:	83 ec 08             	sub    $0x8,%esp
+  80064f:	53                   	push   %ebx
+  800650:	6a 2d                	push   $0x2d
+  800652:	ff d6                	call   *%esi
+        num = -(long long)num;
+  800654:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800657:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80065a:	f7 da                	neg    %edx
+  80065c:	83 d1 00             	adc    $0x0,%ecx
+  80065f:	f7 d9                	neg    %ecx
+  800661:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  800664:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800669:	e9 e1 00 00 00       	jmp    80074f <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  80066e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800671:	8b 00                	mov    (%eax),%eax
+  800673:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800676:	89 c1                	mov    %eax,%ecx
+  800678:	c1 f9 1f             	sar    $0x1f,%ecx
+  80067b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80067e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800681:	8d 40 04             	lea    0x4(%eax),%eax
+  800684:	89 45 14             	mov    %eax,0x14(%ebp)
+  800687:	eb b0                	jmp    800639 <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  800689:	83 f9 01             	cmp    $0x1,%ecx
+  80068c:	7f 1e                	jg     8006ac <vprintfmt+0x319>
+  else if (lflag)
+  80068e:	85 c9                	test   %ecx,%ecx
+  800690:	74 32                	je     8006c4 <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  800692:	8b 45 14             	mov    0x14(%ebp),%eax
+  800695:	8b 10                	mov    (%eax),%edx
+  800697:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80069c:	8d 40 04             	lea    0x4(%eax),%eax
+  80069f:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  8006a2:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  8006a7:	e9 a3 00 00 00       	jmp    80074f <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  8006ac:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006af:	8b 10                	mov    (%eax),%edx
+  8006b1:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006b4:	8d 40 08             	lea    0x8(%eax),%eax
+  8006b7:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  8006ba:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  8006bf:	e9 8b 00 00 00       	jmp    80074f <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8006c4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c7:	8b 10                	mov    (%eax),%edx
+  8006c9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006ce:	8d 40 04             	lea    0x4(%eax),%eax
+  8006d1:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  8006d4:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  8006d9:	eb 74                	jmp    80074f <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  8006db:	83 f9 01             	cmp    $0x1,%ecx
+  8006de:	7f 1b                	jg     8006fb <vprintfmt+0x368>
+  else if (lflag)
+  8006e0:	85 c9                	test   %ecx,%ecx
+  8006e2:	74 2c                	je     800710 <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  8006e4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e7:	8b 10                	mov    (%eax),%edx
+  8006e9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006ee:	8d 40 04             	lea    0x4(%eax),%eax
+  8006f1:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8006f4:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  8006f9:	eb 54                	jmp    80074f <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  8006fb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006fe:	8b 10                	mov    (%eax),%edx
+  800700:	8b 48 04             	mov    0x4(%eax),%ecx
+  800703:	8d 40 08             	lea    0x8(%eax),%eax
+  800706:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800709:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  80070e:	eb 3f                	jmp    80074f <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800710:	8b 45 14             	mov    0x14(%ebp),%eax
+  800713:	8b 10                	mov    (%eax),%edx
+  800715:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80071a:	8d 40 04             	lea    0x4(%eax),%eax
+  80071d:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800720:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  800725:	eb 28                	jmp    80074f <vprintfmt+0x3bc>
+      putch('0', putdat);
+  800727:	83 ec 08             	sub    $0x8,%esp
+  80072a:	53                   	push   %ebx
+  80072b:	6a 30                	push   $0x30
+  80072d:	ff d6                	call   *%esi
+      putch('x', putdat);
+  80072f:	83 c4 08             	add    $0x8,%esp
+  800732:	53                   	push   %ebx
+  800733:	6a 78                	push   $0x78
+  800735:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  800737:	8b 45 14             	mov    0x14(%ebp),%eax
+  80073a:	8b 10                	mov    (%eax),%edx
+  80073c:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  800741:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  800744:	8d 40 04             	lea    0x4(%eax),%eax
+  800747:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  80074a:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  80074f:	83 ec 0c             	sub    $0xc,%esp
+  800752:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800756:	50                   	push   %eax
+  800757:	ff 75 e0             	push   -0x20(%ebp)
+  80075a:	57                   	push   %edi
+  80075b:	51                   	push   %ecx
+  80075c:	52                   	push   %edx
+  80075d:	89 da                	mov    %ebx,%edx
+  80075f:	89 f0                	mov    %esi,%eax
+  800761:	e8 4a fb ff ff       	call   8002b0 <printnum>
+      break;
+  800766:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  800769:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  80076c:	e9 40 fc ff ff       	jmp    8003b1 <vprintfmt+0x1e>
+  if (lflag >= 2)
+  800771:	83 f9 01             	cmp    $0x1,%ecx
+  800774:	7f 1b                	jg     800791 <vprintfmt+0x3fe>
+  else if (lflag)
+  800776:	85 c9                	test   %ecx,%ecx
+  800778:	74 2c                	je     8007a6 <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  80077a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80077d:	8b 10                	mov    (%eax),%edx
+  80077f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800784:	8d 40 04             	lea    0x4(%eax),%eax
+  800787:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  80078a:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  80078f:	eb be                	jmp    80074f <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800791:	8b 45 14             	mov    0x14(%ebp),%eax
+  800794:	8b 10                	mov    (%eax),%edx
+  800796:	8b 48 04             	mov    0x4(%eax),%ecx
+  800799:	8d 40 08             	lea    0x8(%eax),%eax
+  80079c:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  80079f:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  8007a4:	eb a9                	jmp    80074f <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8007a6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a9:	8b 10                	mov    (%eax),%edx
+  8007ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007b0:	8d 40 04             	lea    0x4(%eax),%eax
+  8007b3:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8007b6:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  8007bb:	eb 92                	jmp    80074f <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  8007bd:	83 ec 08             	sub    $0x8,%esp
+  8007c0:	53                   	push   %ebx
+  8007c1:	6a 25                	push   $0x25
+  8007c3:	ff d6                	call   *%esi
+      break;
+  8007c5:	83 c4 10             	add    $0x10,%esp
+  8007c8:	eb 9f                	jmp    800769 <vprintfmt+0x3d6>
+      putch('%', putdat);
+  8007ca:	83 ec 08             	sub    $0x8,%esp
+  8007cd:	53                   	push   %ebx
+  8007ce:	6a 25                	push   $0x25
+  8007d0:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  8007d2:	83 c4 10             	add    $0x10,%esp
+  8007d5:	89 f8                	mov    %edi,%eax
+  8007d7:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8007db:	74 05                	je     8007e2 <vprintfmt+0x44f>
+  8007dd:	83 e8 01             	sub    $0x1,%eax
+  8007e0:	eb f5                	jmp    8007d7 <vprintfmt+0x444>
+  8007e2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8007e5:	eb 82                	jmp    800769 <vprintfmt+0x3d6>
+
+008007e7 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8007e7:	55                   	push   %ebp
+  8007e8:	89 e5                	mov    %esp,%ebp
+  8007ea:	83 ec 18             	sub    $0x18,%esp
+  8007ed:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007f0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  8007f3:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8007f6:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  8007fa:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  8007fd:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  800804:	85 c0                	test   %eax,%eax
+  800806:	74 26                	je     80082e <vsnprintf+0x47>
+  800808:	85 d2                	test   %edx,%edx
+  80080a:	7e 22                	jle    80082e <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80080c:	ff 75 14             	push   0x14(%ebp)
+  80080f:	ff 75 10             	push   0x10(%ebp)
+  800812:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800815:	50                   	push   %eax
+  800816:	68 59 03 80 00       	push   $0x800359
+  80081b:	e8 73 fb ff ff       	call   800393 <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800820:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800823:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  800826:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800829:	83 c4 10             	add    $0x10,%esp
+}
+  80082c:	c9                   	leave
+  80082d:	c3                   	ret
+    return -E_INVAL;
+  80082e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800833:	eb f7                	jmp    80082c <vsnprintf+0x45>
+
+00800835 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800835:	55                   	push   %ebp
+  800836:	89 e5                	mov    %esp,%ebp
+  800838:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  80083b:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  80083e:	50                   	push   %eax
+  80083f:	ff 75 10             	push   0x10(%ebp)
+  800842:	ff 75 0c             	push   0xc(%ebp)
+  800845:	ff 75 08             	push   0x8(%ebp)
+  800848:	e8 9a ff ff ff       	call   8007e7 <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  80084d:	c9                   	leave
+  80084e:	c3                   	ret
+
+0080084f <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80084f:	55                   	push   %ebp
+  800850:	89 e5                	mov    %esp,%ebp
+  800852:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  800855:	b8 00 00 00 00       	mov    $0x0,%eax
+  80085a:	eb 03                	jmp    80085f <strlen+0x10>
+    n++;
+  80085c:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  80085f:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800863:	75 f7                	jne    80085c <strlen+0xd>
+  return n;
+}
+  800865:	5d                   	pop    %ebp
+  800866:	c3                   	ret
+
+00800867 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800867:	55                   	push   %ebp
+  800868:	89 e5                	mov    %esp,%ebp
+  80086a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80086d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800870:	b8 00 00 00 00       	mov    $0x0,%eax
+  800875:	eb 03                	jmp    80087a <strnlen+0x13>
+    n++;
+  800877:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  80087a:	39 d0                	cmp    %edx,%eax
+  80087c:	74 08                	je     800886 <strnlen+0x1f>
+  80087e:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800882:	75 f3                	jne    800877 <strnlen+0x10>
+  800884:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  800886:	89 d0                	mov    %edx,%eax
+  800888:	5d                   	pop    %ebp
+  800889:	c3                   	ret
+
+0080088a <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  80088a:	55                   	push   %ebp
+  80088b:	89 e5                	mov    %esp,%ebp
+  80088d:	53                   	push   %ebx
+  80088e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800891:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  800894:	b8 00 00 00 00       	mov    $0x0,%eax
+  800899:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  80089d:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8008a0:	83 c0 01             	add    $0x1,%eax
+  8008a3:	84 d2                	test   %dl,%dl
+  8008a5:	75 f2                	jne    800899 <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  8008a7:	89 c8                	mov    %ecx,%eax
+  8008a9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008ac:	c9                   	leave
+  8008ad:	c3                   	ret
+
+008008ae <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8008ae:	55                   	push   %ebp
+  8008af:	89 e5                	mov    %esp,%ebp
+  8008b1:	53                   	push   %ebx
+  8008b2:	83 ec 10             	sub    $0x10,%esp
+  8008b5:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  8008b8:	53                   	push   %ebx
+  8008b9:	e8 91 ff ff ff       	call   80084f <strlen>
+  8008be:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  8008c1:	ff 75 0c             	push   0xc(%ebp)
+  8008c4:	01 d8                	add    %ebx,%eax
+  8008c6:	50                   	push   %eax
+  8008c7:	e8 be ff ff ff       	call   80088a <strcpy>
+  return dst;
+}
+  8008cc:	89 d8                	mov    %ebx,%eax
+  8008ce:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008d1:	c9                   	leave
+  8008d2:	c3                   	ret
+
+008008d3 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  8008d3:	55                   	push   %ebp
+  8008d4:	89 e5                	mov    %esp,%ebp
+  8008d6:	56                   	push   %esi
+  8008d7:	53                   	push   %ebx
+  8008d8:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008db:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  8008de:	89 f3                	mov    %esi,%ebx
+  8008e0:	03 5d 10             	add    0x10(%ebp),%ebx
+  8008e3:	89 f0                	mov    %esi,%eax
+  8008e5:	eb 0f                	jmp    8008f6 <strncpy+0x23>
+    *dst++ = *src;
+  8008e7:	83 c0 01             	add    $0x1,%eax
+  8008ea:	0f b6 0a             	movzbl (%edx),%ecx
+  8008ed:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  8008f0:	80 f9 01             	cmp    $0x1,%cl
+  8008f3:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  8008f6:	39 d8                	cmp    %ebx,%eax
+  8008f8:	75 ed                	jne    8008e7 <strncpy+0x14>
+  }
+  return ret;
+}
+  8008fa:	89 f0                	mov    %esi,%eax
+  8008fc:	5b                   	pop    %ebx
+  8008fd:	5e                   	pop    %esi
+  8008fe:	5d                   	pop    %ebp
+  8008ff:	c3                   	ret
+
+00800900 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800900:	55                   	push   %ebp
+  800901:	89 e5                	mov    %esp,%ebp
+  800903:	56                   	push   %esi
+  800904:	53                   	push   %ebx
+  800905:	8b 75 08             	mov    0x8(%ebp),%esi
+  800908:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80090b:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  80090e:	89 f0                	mov    %esi,%eax
+  800910:	85 d2                	test   %edx,%edx
+  800912:	74 21                	je     800935 <strlcpy+0x35>
+  800914:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800918:	89 f2                	mov    %esi,%edx
+  80091a:	eb 09                	jmp    800925 <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  80091c:	83 c1 01             	add    $0x1,%ecx
+  80091f:	83 c2 01             	add    $0x1,%edx
+  800922:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  800925:	39 c2                	cmp    %eax,%edx
+  800927:	74 09                	je     800932 <strlcpy+0x32>
+  800929:	0f b6 19             	movzbl (%ecx),%ebx
+  80092c:	84 db                	test   %bl,%bl
+  80092e:	75 ec                	jne    80091c <strlcpy+0x1c>
+  800930:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  800932:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  800935:	29 f0                	sub    %esi,%eax
+}
+  800937:	5b                   	pop    %ebx
+  800938:	5e                   	pop    %esi
+  800939:	5d                   	pop    %ebp
+  80093a:	c3                   	ret
+
+0080093b <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  80093b:	55                   	push   %ebp
+  80093c:	89 e5                	mov    %esp,%ebp
+  80093e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800941:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  800944:	eb 06                	jmp    80094c <strcmp+0x11>
+    p++, q++;
+  800946:	83 c1 01             	add    $0x1,%ecx
+  800949:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  80094c:	0f b6 01             	movzbl (%ecx),%eax
+  80094f:	84 c0                	test   %al,%al
+  800951:	74 04                	je     800957 <strcmp+0x1c>
+  800953:	3a 02                	cmp    (%edx),%al
+  800955:	74 ef                	je     800946 <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  800957:	0f b6 c0             	movzbl %al,%eax
+  80095a:	0f b6 12             	movzbl (%edx),%edx
+  80095d:	29 d0                	sub    %edx,%eax
+}
+  80095f:	5d                   	pop    %ebp
+  800960:	c3                   	ret
+
+00800961 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800961:	55                   	push   %ebp
+  800962:	89 e5                	mov    %esp,%ebp
+  800964:	53                   	push   %ebx
+  800965:	8b 45 08             	mov    0x8(%ebp),%eax
+  800968:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80096b:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  80096e:	eb 09                	jmp    800979 <strncmp+0x18>
+    n--, p++, q++;
+  800970:	83 ea 01             	sub    $0x1,%edx
+  800973:	83 c0 01             	add    $0x1,%eax
+  800976:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  800979:	85 d2                	test   %edx,%edx
+  80097b:	74 18                	je     800995 <strncmp+0x34>
+  80097d:	0f b6 18             	movzbl (%eax),%ebx
+  800980:	84 db                	test   %bl,%bl
+  800982:	74 04                	je     800988 <strncmp+0x27>
+  800984:	3a 19                	cmp    (%ecx),%bl
+  800986:	74 e8                	je     800970 <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800988:	0f b6 00             	movzbl (%eax),%eax
+  80098b:	0f b6 11             	movzbl (%ecx),%edx
+  80098e:	29 d0                	sub    %edx,%eax
+}
+  800990:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800993:	c9                   	leave
+  800994:	c3                   	ret
+    return 0;
+  800995:	b8 00 00 00 00       	mov    $0x0,%eax
+  80099a:	eb f4                	jmp    800990 <strncmp+0x2f>
+
+0080099c <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  80099c:	55                   	push   %ebp
+  80099d:	89 e5                	mov    %esp,%ebp
+  80099f:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009a2:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  8009a6:	eb 03                	jmp    8009ab <strchr+0xf>
+  8009a8:	83 c0 01             	add    $0x1,%eax
+  8009ab:	0f b6 10             	movzbl (%eax),%edx
+  8009ae:	84 d2                	test   %dl,%dl
+  8009b0:	74 06                	je     8009b8 <strchr+0x1c>
+    if (*s == c)
+  8009b2:	38 ca                	cmp    %cl,%dl
+  8009b4:	75 f2                	jne    8009a8 <strchr+0xc>
+  8009b6:	eb 05                	jmp    8009bd <strchr+0x21>
+      return (char*)s;
+  return 0;
+  8009b8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009bd:	5d                   	pop    %ebp
+  8009be:	c3                   	ret
+
+008009bf <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8009bf:	55                   	push   %ebp
+  8009c0:	89 e5                	mov    %esp,%ebp
+  8009c2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009c5:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  8009c9:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  8009cc:	38 ca                	cmp    %cl,%dl
+  8009ce:	74 09                	je     8009d9 <strfind+0x1a>
+  8009d0:	84 d2                	test   %dl,%dl
+  8009d2:	74 05                	je     8009d9 <strfind+0x1a>
+  for (; *s; s++)
+  8009d4:	83 c0 01             	add    $0x1,%eax
+  8009d7:	eb f0                	jmp    8009c9 <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  8009d9:	5d                   	pop    %ebp
+  8009da:	c3                   	ret
+
+008009db <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8009db:	55                   	push   %ebp
+  8009dc:	89 e5                	mov    %esp,%ebp
+  8009de:	57                   	push   %edi
+  8009df:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8009e2:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  8009e5:	85 c9                	test   %ecx,%ecx
+  8009e7:	74 20                	je     800a09 <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  8009e9:	89 f8                	mov    %edi,%eax
+  8009eb:	09 c8                	or     %ecx,%eax
+  8009ed:	a8 03                	test   $0x3,%al
+  8009ef:	75 12                	jne    800a03 <memset+0x28>
+    c &= 0xFF;
+  8009f1:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  8009f5:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  8009fb:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  8009fe:	fc                   	cld
+  8009ff:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a01:	eb 06                	jmp    800a09 <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  800a03:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a06:	fc                   	cld
+  800a07:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  800a09:	89 f8                	mov    %edi,%eax
+  800a0b:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a0e:	c9                   	leave
+  800a0f:	c3                   	ret
+
+00800a10 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a10:	55                   	push   %ebp
+  800a11:	89 e5                	mov    %esp,%ebp
+  800a13:	57                   	push   %edi
+  800a14:	56                   	push   %esi
+  800a15:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a18:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a1b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  800a1e:	39 c6                	cmp    %eax,%esi
+  800a20:	73 32                	jae    800a54 <memmove+0x44>
+  800a22:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a25:	39 d0                	cmp    %edx,%eax
+  800a27:	73 2b                	jae    800a54 <memmove+0x44>
+    s += n;
+    d += n;
+  800a29:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a2c:	89 d6                	mov    %edx,%esi
+  800a2e:	09 fe                	or     %edi,%esi
+  800a30:	09 ce                	or     %ecx,%esi
+  800a32:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800a38:	75 0e                	jne    800a48 <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800a3a:	83 ef 04             	sub    $0x4,%edi
+  800a3d:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800a40:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  800a43:	fd                   	std
+  800a44:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a46:	eb 09                	jmp    800a51 <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800a48:	83 ef 01             	sub    $0x1,%edi
+  800a4b:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  800a4e:	fd                   	std
+  800a4f:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  800a51:	fc                   	cld
+  800a52:	eb 1a                	jmp    800a6e <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800a54:	89 f2                	mov    %esi,%edx
+  800a56:	09 c2                	or     %eax,%edx
+  800a58:	09 ca                	or     %ecx,%edx
+  800a5a:	f6 c2 03             	test   $0x3,%dl
+  800a5d:	75 0a                	jne    800a69 <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800a5f:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  800a62:	89 c7                	mov    %eax,%edi
+  800a64:	fc                   	cld
+  800a65:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800a67:	eb 05                	jmp    800a6e <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  800a69:	89 c7                	mov    %eax,%edi
+  800a6b:	fc                   	cld
+  800a6c:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  800a6e:	5e                   	pop    %esi
+  800a6f:	5f                   	pop    %edi
+  800a70:	5d                   	pop    %ebp
+  800a71:	c3                   	ret
+
+00800a72 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a72:	55                   	push   %ebp
+  800a73:	89 e5                	mov    %esp,%ebp
+  800a75:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  800a78:	ff 75 10             	push   0x10(%ebp)
+  800a7b:	ff 75 0c             	push   0xc(%ebp)
+  800a7e:	ff 75 08             	push   0x8(%ebp)
+  800a81:	e8 8a ff ff ff       	call   800a10 <memmove>
+}
+  800a86:	c9                   	leave
+  800a87:	c3                   	ret
+
+00800a88 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a88:	55                   	push   %ebp
+  800a89:	89 e5                	mov    %esp,%ebp
+  800a8b:	56                   	push   %esi
+  800a8c:	53                   	push   %ebx
+  800a8d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a90:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  800a93:	89 c6                	mov    %eax,%esi
+  800a95:	03 75 10             	add    0x10(%ebp),%esi
+  800a98:	eb 06                	jmp    800aa0 <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  800a9a:	83 c0 01             	add    $0x1,%eax
+  800a9d:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  800aa0:	39 f0                	cmp    %esi,%eax
+  800aa2:	74 14                	je     800ab8 <memcmp+0x30>
+    if (*s1 != *s2)
+  800aa4:	0f b6 08             	movzbl (%eax),%ecx
+  800aa7:	0f b6 1a             	movzbl (%edx),%ebx
+  800aaa:	38 d9                	cmp    %bl,%cl
+  800aac:	74 ec                	je     800a9a <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  800aae:	0f b6 c1             	movzbl %cl,%eax
+  800ab1:	0f b6 db             	movzbl %bl,%ebx
+  800ab4:	29 d8                	sub    %ebx,%eax
+  800ab6:	eb 05                	jmp    800abd <memcmp+0x35>
+  }
+
+  return 0;
+  800ab8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800abd:	5b                   	pop    %ebx
+  800abe:	5e                   	pop    %esi
+  800abf:	5d                   	pop    %ebp
+  800ac0:	c3                   	ret
+
+00800ac1 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800ac1:	55                   	push   %ebp
+  800ac2:	89 e5                	mov    %esp,%ebp
+  800ac4:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ac7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  800aca:	89 c2                	mov    %eax,%edx
+  800acc:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  800acf:	eb 03                	jmp    800ad4 <memfind+0x13>
+  800ad1:	83 c0 01             	add    $0x1,%eax
+  800ad4:	39 d0                	cmp    %edx,%eax
+  800ad6:	73 04                	jae    800adc <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  800ad8:	38 08                	cmp    %cl,(%eax)
+  800ada:	75 f5                	jne    800ad1 <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  800adc:	5d                   	pop    %ebp
+  800add:	c3                   	ret
+
+00800ade <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800ade:	55                   	push   %ebp
+  800adf:	89 e5                	mov    %esp,%ebp
+  800ae1:	57                   	push   %edi
+  800ae2:	56                   	push   %esi
+  800ae3:	53                   	push   %ebx
+  800ae4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ae7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  800aea:	eb 03                	jmp    800aef <strtol+0x11>
+    s++;
+  800aec:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  800aef:	0f b6 02             	movzbl (%edx),%eax
+  800af2:	3c 20                	cmp    $0x20,%al
+  800af4:	74 f6                	je     800aec <strtol+0xe>
+  800af6:	3c 09                	cmp    $0x9,%al
+  800af8:	74 f2                	je     800aec <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  800afa:	3c 2b                	cmp    $0x2b,%al
+  800afc:	74 2a                	je     800b28 <strtol+0x4a>
+  int neg = 0;
+  800afe:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  800b03:	3c 2d                	cmp    $0x2d,%al
+  800b05:	74 2b                	je     800b32 <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b07:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b0d:	75 0f                	jne    800b1e <strtol+0x40>
+  800b0f:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b12:	74 28                	je     800b3c <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  800b14:	85 db                	test   %ebx,%ebx
+  800b16:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b1b:	0f 44 d8             	cmove  %eax,%ebx
+  800b1e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b23:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b26:	eb 46                	jmp    800b6e <strtol+0x90>
+    s++;
+  800b28:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  800b2b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b30:	eb d5                	jmp    800b07 <strtol+0x29>
+    s++, neg = 1;
+  800b32:	83 c2 01             	add    $0x1,%edx
+  800b35:	bf 01 00 00 00       	mov    $0x1,%edi
+  800b3a:	eb cb                	jmp    800b07 <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b3c:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800b40:	74 0e                	je     800b50 <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  800b42:	85 db                	test   %ebx,%ebx
+  800b44:	75 d8                	jne    800b1e <strtol+0x40>
+    s++, base = 8;
+  800b46:	83 c2 01             	add    $0x1,%edx
+  800b49:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800b4e:	eb ce                	jmp    800b1e <strtol+0x40>
+    s += 2, base = 16;
+  800b50:	83 c2 02             	add    $0x2,%edx
+  800b53:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800b58:	eb c4                	jmp    800b1e <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  800b5a:	0f be c0             	movsbl %al,%eax
+  800b5d:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  800b60:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800b63:	7d 3a                	jge    800b9f <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  800b65:	83 c2 01             	add    $0x1,%edx
+  800b68:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800b6c:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  800b6e:	0f b6 02             	movzbl (%edx),%eax
+  800b71:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800b74:	89 f3                	mov    %esi,%ebx
+  800b76:	80 fb 09             	cmp    $0x9,%bl
+  800b79:	76 df                	jbe    800b5a <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  800b7b:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800b7e:	89 f3                	mov    %esi,%ebx
+  800b80:	80 fb 19             	cmp    $0x19,%bl
+  800b83:	77 08                	ja     800b8d <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  800b85:	0f be c0             	movsbl %al,%eax
+  800b88:	83 e8 57             	sub    $0x57,%eax
+  800b8b:	eb d3                	jmp    800b60 <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  800b8d:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800b90:	89 f3                	mov    %esi,%ebx
+  800b92:	80 fb 19             	cmp    $0x19,%bl
+  800b95:	77 08                	ja     800b9f <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  800b97:	0f be c0             	movsbl %al,%eax
+  800b9a:	83 e8 37             	sub    $0x37,%eax
+  800b9d:	eb c1                	jmp    800b60 <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  800b9f:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800ba3:	74 05                	je     800baa <strtol+0xcc>
+    *endptr = (char*)s;
+  800ba5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ba8:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  800baa:	89 c8                	mov    %ecx,%eax
+  800bac:	f7 d8                	neg    %eax
+  800bae:	85 ff                	test   %edi,%edi
+  800bb0:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800bb3:	89 c8                	mov    %ecx,%eax
+  800bb5:	5b                   	pop    %ebx
+  800bb6:	5e                   	pop    %esi
+  800bb7:	5f                   	pop    %edi
+  800bb8:	5d                   	pop    %ebp
+  800bb9:	c3                   	ret
+
+00800bba <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800bba:	55                   	push   %ebp
+  800bbb:	89 e5                	mov    %esp,%ebp
+  800bbd:	57                   	push   %edi
+  800bbe:	56                   	push   %esi
+  800bbf:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800bc0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bc5:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bc8:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bcb:	89 c3                	mov    %eax,%ebx
+  800bcd:	89 c7                	mov    %eax,%edi
+  800bcf:	89 c6                	mov    %eax,%esi
+  800bd1:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800bd3:	5b                   	pop    %ebx
+  800bd4:	5e                   	pop    %esi
+  800bd5:	5f                   	pop    %edi
+  800bd6:	5d                   	pop    %ebp
+  800bd7:	c3                   	ret
+
+00800bd8 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800bd8:	55                   	push   %ebp
+  800bd9:	89 e5                	mov    %esp,%ebp
+  800bdb:	57                   	push   %edi
+  800bdc:	56                   	push   %esi
+  800bdd:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800bde:	ba 00 00 00 00       	mov    $0x0,%edx
+  800be3:	b8 01 00 00 00       	mov    $0x1,%eax
+  800be8:	89 d1                	mov    %edx,%ecx
+  800bea:	89 d3                	mov    %edx,%ebx
+  800bec:	89 d7                	mov    %edx,%edi
+  800bee:	89 d6                	mov    %edx,%esi
+  800bf0:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800bf2:	5b                   	pop    %ebx
+  800bf3:	5e                   	pop    %esi
+  800bf4:	5f                   	pop    %edi
+  800bf5:	5d                   	pop    %ebp
+  800bf6:	c3                   	ret
+
+00800bf7 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800bf7:	55                   	push   %ebp
+  800bf8:	89 e5                	mov    %esp,%ebp
+  800bfa:	57                   	push   %edi
+  800bfb:	56                   	push   %esi
+  800bfc:	53                   	push   %ebx
+  800bfd:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800c00:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c05:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c08:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c0d:	89 cb                	mov    %ecx,%ebx
+  800c0f:	89 cf                	mov    %ecx,%edi
+  800c11:	89 ce                	mov    %ecx,%esi
+  800c13:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c15:	85 c0                	test   %eax,%eax
+  800c17:	7f 08                	jg     800c21 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800c19:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c1c:	5b                   	pop    %ebx
+  800c1d:	5e                   	pop    %esi
+  800c1e:	5f                   	pop    %edi
+  800c1f:	5d                   	pop    %ebp
+  800c20:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c21:	83 ec 0c             	sub    $0xc,%esp
+  800c24:	50                   	push   %eax
+  800c25:	6a 03                	push   $0x3
+  800c27:	68 03 3b 80 00       	push   $0x803b03
+  800c2c:	6a 23                	push   $0x23
+  800c2e:	68 20 3b 80 00       	push   $0x803b20
+  800c33:	e8 89 f5 ff ff       	call   8001c1 <_panic>
+
+00800c38 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800c38:	55                   	push   %ebp
+  800c39:	89 e5                	mov    %esp,%ebp
+  800c3b:	57                   	push   %edi
+  800c3c:	56                   	push   %esi
+  800c3d:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800c3e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c43:	b8 02 00 00 00       	mov    $0x2,%eax
+  800c48:	89 d1                	mov    %edx,%ecx
+  800c4a:	89 d3                	mov    %edx,%ebx
+  800c4c:	89 d7                	mov    %edx,%edi
+  800c4e:	89 d6                	mov    %edx,%esi
+  800c50:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800c52:	5b                   	pop    %ebx
+  800c53:	5e                   	pop    %esi
+  800c54:	5f                   	pop    %edi
+  800c55:	5d                   	pop    %ebp
+  800c56:	c3                   	ret
+
+00800c57 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800c57:	55                   	push   %ebp
+  800c58:	89 e5                	mov    %esp,%ebp
+  800c5a:	57                   	push   %edi
+  800c5b:	56                   	push   %esi
+  800c5c:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800c5d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c62:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800c67:	89 d1                	mov    %edx,%ecx
+  800c69:	89 d3                	mov    %edx,%ebx
+  800c6b:	89 d7                	mov    %edx,%edi
+  800c6d:	89 d6                	mov    %edx,%esi
+  800c6f:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800c71:	5b                   	pop    %ebx
+  800c72:	5e                   	pop    %esi
+  800c73:	5f                   	pop    %edi
+  800c74:	5d                   	pop    %ebp
+  800c75:	c3                   	ret
+
+00800c76 <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  800c76:	55                   	push   %ebp
+  800c77:	89 e5                	mov    %esp,%ebp
+  800c79:	57                   	push   %edi
+  800c7a:	56                   	push   %esi
+  800c7b:	53                   	push   %ebx
+  800c7c:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  800c7f:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  800c83:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c88:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c8b:	b8 14 00 00 00       	mov    $0x14,%eax
+  800c90:	89 df                	mov    %ebx,%edi
+  800c92:	89 de                	mov    %ebx,%esi
+  800c94:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c96:	85 c0                	test   %eax,%eax
+  800c98:	7f 08                	jg     800ca2 <sys_env_set_cow+0x2c>
+}
+  800c9a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c9d:	5b                   	pop    %ebx
+  800c9e:	5e                   	pop    %esi
+  800c9f:	5f                   	pop    %edi
+  800ca0:	5d                   	pop    %ebp
+  800ca1:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ca2:	83 ec 0c             	sub    $0xc,%esp
+  800ca5:	50                   	push   %eax
+  800ca6:	6a 14                	push   $0x14
+  800ca8:	68 03 3b 80 00       	push   $0x803b03
+  800cad:	6a 23                	push   $0x23
+  800caf:	68 20 3b 80 00       	push   $0x803b20
+  800cb4:	e8 08 f5 ff ff       	call   8001c1 <_panic>
+
+00800cb9 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800cb9:	55                   	push   %ebp
+  800cba:	89 e5                	mov    %esp,%ebp
+  800cbc:	57                   	push   %edi
+  800cbd:	56                   	push   %esi
+  800cbe:	53                   	push   %ebx
+  800cbf:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800cc2:	be 00 00 00 00       	mov    $0x0,%esi
+  800cc7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ccd:	b8 04 00 00 00       	mov    $0x4,%eax
+  800cd2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cd5:	89 f7                	mov    %esi,%edi
+  800cd7:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800cd9:	85 c0                	test   %eax,%eax
+  800cdb:	7f 08                	jg     800ce5 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  800cdd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ce0:	5b                   	pop    %ebx
+  800ce1:	5e                   	pop    %esi
+  800ce2:	5f                   	pop    %edi
+  800ce3:	5d                   	pop    %ebp
+  800ce4:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ce5:	83 ec 0c             	sub    $0xc,%esp
+  800ce8:	50                   	push   %eax
+  800ce9:	6a 04                	push   $0x4
+  800ceb:	68 03 3b 80 00       	push   $0x803b03
+  800cf0:	6a 23                	push   $0x23
+  800cf2:	68 20 3b 80 00       	push   $0x803b20
+  800cf7:	e8 c5 f4 ff ff       	call   8001c1 <_panic>
+
+00800cfc <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800cfc:	55                   	push   %ebp
+  800cfd:	89 e5                	mov    %esp,%ebp
+  800cff:	57                   	push   %edi
+  800d00:	56                   	push   %esi
+  800d01:	53                   	push   %ebx
+  800d02:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800d05:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d08:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d0b:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d10:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d13:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d16:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d19:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d1b:	85 c0                	test   %eax,%eax
+  800d1d:	7f 08                	jg     800d27 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  800d1f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d22:	5b                   	pop    %ebx
+  800d23:	5e                   	pop    %esi
+  800d24:	5f                   	pop    %edi
+  800d25:	5d                   	pop    %ebp
+  800d26:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d27:	83 ec 0c             	sub    $0xc,%esp
+  800d2a:	50                   	push   %eax
+  800d2b:	6a 05                	push   $0x5
+  800d2d:	68 03 3b 80 00       	push   $0x803b03
+  800d32:	6a 23                	push   $0x23
+  800d34:	68 20 3b 80 00       	push   $0x803b20
+  800d39:	e8 83 f4 ff ff       	call   8001c1 <_panic>
+
+00800d3e <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800d3e:	55                   	push   %ebp
+  800d3f:	89 e5                	mov    %esp,%ebp
+  800d41:	57                   	push   %edi
+  800d42:	56                   	push   %esi
+  800d43:	53                   	push   %ebx
+  800d44:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800d47:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d4c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d4f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d52:	b8 06 00 00 00       	mov    $0x6,%eax
+  800d57:	89 df                	mov    %ebx,%edi
+  800d59:	89 de                	mov    %ebx,%esi
+  800d5b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d5d:	85 c0                	test   %eax,%eax
+  800d5f:	7f 08                	jg     800d69 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  800d61:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d64:	5b                   	pop    %ebx
+  800d65:	5e                   	pop    %esi
+  800d66:	5f                   	pop    %edi
+  800d67:	5d                   	pop    %ebp
+  800d68:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d69:	83 ec 0c             	sub    $0xc,%esp
+  800d6c:	50                   	push   %eax
+  800d6d:	6a 06                	push   $0x6
+  800d6f:	68 03 3b 80 00       	push   $0x803b03
+  800d74:	6a 23                	push   $0x23
+  800d76:	68 20 3b 80 00       	push   $0x803b20
+  800d7b:	e8 41 f4 ff ff       	call   8001c1 <_panic>
+
+00800d80 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  800d80:	55                   	push   %ebp
+  800d81:	89 e5                	mov    %esp,%ebp
+  800d83:	57                   	push   %edi
+  800d84:	56                   	push   %esi
+  800d85:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d86:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d89:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d8c:	b8 11 00 00 00       	mov    $0x11,%eax
+  800d91:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d94:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d97:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d9a:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  800d9c:	5b                   	pop    %ebx
+  800d9d:	5e                   	pop    %esi
+  800d9e:	5f                   	pop    %edi
+  800d9f:	5d                   	pop    %ebp
+  800da0:	c3                   	ret
+
+00800da1 <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  800da1:	55                   	push   %ebp
+  800da2:	89 e5                	mov    %esp,%ebp
+  800da4:	57                   	push   %edi
+  800da5:	56                   	push   %esi
+  800da6:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800da7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800daa:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dad:	b8 12 00 00 00       	mov    $0x12,%eax
+  800db2:	be 00 00 00 00       	mov    $0x0,%esi
+  800db7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dba:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800dbd:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  800dbf:	5b                   	pop    %ebx
+  800dc0:	5e                   	pop    %esi
+  800dc1:	5f                   	pop    %edi
+  800dc2:	5d                   	pop    %ebp
+  800dc3:	c3                   	ret
+
+00800dc4 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  800dc4:	55                   	push   %ebp
+  800dc5:	89 e5                	mov    %esp,%ebp
+  800dc7:	57                   	push   %edi
+  800dc8:	56                   	push   %esi
+  800dc9:	53                   	push   %ebx
+  800dca:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800dcd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dd2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dd5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dd8:	b8 16 00 00 00       	mov    $0x16,%eax
+  800ddd:	89 df                	mov    %ebx,%edi
+  800ddf:	89 de                	mov    %ebx,%esi
+  800de1:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800de3:	85 c0                	test   %eax,%eax
+  800de5:	7f 08                	jg     800def <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  800de7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dea:	5b                   	pop    %ebx
+  800deb:	5e                   	pop    %esi
+  800dec:	5f                   	pop    %edi
+  800ded:	5d                   	pop    %ebp
+  800dee:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800def:	83 ec 0c             	sub    $0xc,%esp
+  800df2:	50                   	push   %eax
+  800df3:	6a 16                	push   $0x16
+  800df5:	68 03 3b 80 00       	push   $0x803b03
+  800dfa:	6a 23                	push   $0x23
+  800dfc:	68 20 3b 80 00       	push   $0x803b20
+  800e01:	e8 bb f3 ff ff       	call   8001c1 <_panic>
+
+00800e06 <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  800e06:	55                   	push   %ebp
+  800e07:	89 e5                	mov    %esp,%ebp
+  800e09:	57                   	push   %edi
+  800e0a:	56                   	push   %esi
+  800e0b:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e0c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e11:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e14:	b8 17 00 00 00       	mov    $0x17,%eax
+  800e19:	89 cb                	mov    %ecx,%ebx
+  800e1b:	89 cf                	mov    %ecx,%edi
+  800e1d:	89 ce                	mov    %ecx,%esi
+  800e1f:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  800e21:	5b                   	pop    %ebx
+  800e22:	5e                   	pop    %esi
+  800e23:	5f                   	pop    %edi
+  800e24:	5d                   	pop    %ebp
+  800e25:	c3                   	ret
+
+00800e26 <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  800e26:	55                   	push   %ebp
+  800e27:	89 e5                	mov    %esp,%ebp
+  800e29:	57                   	push   %edi
+  800e2a:	56                   	push   %esi
+  800e2b:	53                   	push   %ebx
+  800e2c:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e2f:	be 00 00 00 00       	mov    $0x0,%esi
+  800e34:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e37:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e3a:	b8 18 00 00 00       	mov    $0x18,%eax
+  800e3f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e42:	89 f7                	mov    %esi,%edi
+  800e44:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e46:	85 c0                	test   %eax,%eax
+  800e48:	7f 08                	jg     800e52 <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  800e4a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e4d:	5b                   	pop    %ebx
+  800e4e:	5e                   	pop    %esi
+  800e4f:	5f                   	pop    %edi
+  800e50:	5d                   	pop    %ebp
+  800e51:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e52:	83 ec 0c             	sub    $0xc,%esp
+  800e55:	50                   	push   %eax
+  800e56:	6a 18                	push   $0x18
+  800e58:	68 03 3b 80 00       	push   $0x803b03
+  800e5d:	6a 23                	push   $0x23
+  800e5f:	68 20 3b 80 00       	push   $0x803b20
+  800e64:	e8 58 f3 ff ff       	call   8001c1 <_panic>
+
+00800e69 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  800e69:	55                   	push   %ebp
+  800e6a:	89 e5                	mov    %esp,%ebp
+  800e6c:	57                   	push   %edi
+  800e6d:	56                   	push   %esi
+  800e6e:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e6f:	be 00 00 00 00       	mov    $0x0,%esi
+  800e74:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e77:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e7a:	b8 19 00 00 00       	mov    $0x19,%eax
+  800e7f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e82:	89 f7                	mov    %esi,%edi
+  800e84:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  800e86:	5b                   	pop    %ebx
+  800e87:	5e                   	pop    %esi
+  800e88:	5f                   	pop    %edi
+  800e89:	5d                   	pop    %ebp
+  800e8a:	c3                   	ret
+
+00800e8b <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  800e8b:	55                   	push   %ebp
+  800e8c:	89 e5                	mov    %esp,%ebp
+  800e8e:	57                   	push   %edi
+  800e8f:	56                   	push   %esi
+  800e90:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e91:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e96:	b8 15 00 00 00       	mov    $0x15,%eax
+  800e9b:	89 d1                	mov    %edx,%ecx
+  800e9d:	89 d3                	mov    %edx,%ebx
+  800e9f:	89 d7                	mov    %edx,%edi
+  800ea1:	89 d6                	mov    %edx,%esi
+  800ea3:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800ea5:	5b                   	pop    %ebx
+  800ea6:	5e                   	pop    %esi
+  800ea7:	5f                   	pop    %edi
+  800ea8:	5d                   	pop    %ebp
+  800ea9:	c3                   	ret
+
+00800eaa <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800eaa:	55                   	push   %ebp
+  800eab:	89 e5                	mov    %esp,%ebp
+  800ead:	57                   	push   %edi
+  800eae:	56                   	push   %esi
+  800eaf:	53                   	push   %ebx
+  800eb0:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800eb3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eb8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ebb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ebe:	b8 08 00 00 00       	mov    $0x8,%eax
+  800ec3:	89 df                	mov    %ebx,%edi
+  800ec5:	89 de                	mov    %ebx,%esi
+  800ec7:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ec9:	85 c0                	test   %eax,%eax
+  800ecb:	7f 08                	jg     800ed5 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800ecd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ed0:	5b                   	pop    %ebx
+  800ed1:	5e                   	pop    %esi
+  800ed2:	5f                   	pop    %edi
+  800ed3:	5d                   	pop    %ebp
+  800ed4:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ed5:	83 ec 0c             	sub    $0xc,%esp
+  800ed8:	50                   	push   %eax
+  800ed9:	6a 08                	push   $0x8
+  800edb:	68 03 3b 80 00       	push   $0x803b03
+  800ee0:	6a 23                	push   $0x23
+  800ee2:	68 20 3b 80 00       	push   $0x803b20
+  800ee7:	e8 d5 f2 ff ff       	call   8001c1 <_panic>
+
+00800eec <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800eec:	55                   	push   %ebp
+  800eed:	89 e5                	mov    %esp,%ebp
+  800eef:	57                   	push   %edi
+  800ef0:	56                   	push   %esi
+  800ef1:	53                   	push   %ebx
+  800ef2:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800ef5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800efa:	8b 55 08             	mov    0x8(%ebp),%edx
+  800efd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f00:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f05:	89 df                	mov    %ebx,%edi
+  800f07:	89 de                	mov    %ebx,%esi
+  800f09:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f0b:	85 c0                	test   %eax,%eax
+  800f0d:	7f 08                	jg     800f17 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  800f0f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f12:	5b                   	pop    %ebx
+  800f13:	5e                   	pop    %esi
+  800f14:	5f                   	pop    %edi
+  800f15:	5d                   	pop    %ebp
+  800f16:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f17:	83 ec 0c             	sub    $0xc,%esp
+  800f1a:	50                   	push   %eax
+  800f1b:	6a 09                	push   $0x9
+  800f1d:	68 03 3b 80 00       	push   $0x803b03
+  800f22:	6a 23                	push   $0x23
+  800f24:	68 20 3b 80 00       	push   $0x803b20
+  800f29:	e8 93 f2 ff ff       	call   8001c1 <_panic>
+
+00800f2e <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800f2e:	55                   	push   %ebp
+  800f2f:	89 e5                	mov    %esp,%ebp
+  800f31:	57                   	push   %edi
+  800f32:	56                   	push   %esi
+  800f33:	53                   	push   %ebx
+  800f34:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f37:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f3c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f3f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f42:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f47:	89 df                	mov    %ebx,%edi
+  800f49:	89 de                	mov    %ebx,%esi
+  800f4b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f4d:	85 c0                	test   %eax,%eax
+  800f4f:	7f 08                	jg     800f59 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  800f51:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f54:	5b                   	pop    %ebx
+  800f55:	5e                   	pop    %esi
+  800f56:	5f                   	pop    %edi
+  800f57:	5d                   	pop    %ebp
+  800f58:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f59:	83 ec 0c             	sub    $0xc,%esp
+  800f5c:	50                   	push   %eax
+  800f5d:	6a 0a                	push   $0xa
+  800f5f:	68 03 3b 80 00       	push   $0x803b03
+  800f64:	6a 23                	push   $0x23
+  800f66:	68 20 3b 80 00       	push   $0x803b20
+  800f6b:	e8 51 f2 ff ff       	call   8001c1 <_panic>
+
+00800f70 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  800f70:	55                   	push   %ebp
+  800f71:	89 e5                	mov    %esp,%ebp
+  800f73:	57                   	push   %edi
+  800f74:	56                   	push   %esi
+  800f75:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f76:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f79:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f7c:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f81:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f84:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f87:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f8a:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  800f8c:	5b                   	pop    %ebx
+  800f8d:	5e                   	pop    %esi
+  800f8e:	5f                   	pop    %edi
+  800f8f:	5d                   	pop    %ebp
+  800f90:	c3                   	ret
+
+00800f91 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  800f91:	55                   	push   %ebp
+  800f92:	89 e5                	mov    %esp,%ebp
+  800f94:	57                   	push   %edi
+  800f95:	56                   	push   %esi
+  800f96:	53                   	push   %ebx
+  800f97:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f9a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f9f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fa5:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800faa:	89 df                	mov    %ebx,%edi
+  800fac:	89 de                	mov    %ebx,%esi
+  800fae:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800fb0:	85 c0                	test   %eax,%eax
+  800fb2:	7f 08                	jg     800fbc <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  800fb4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fb7:	5b                   	pop    %ebx
+  800fb8:	5e                   	pop    %esi
+  800fb9:	5f                   	pop    %edi
+  800fba:	5d                   	pop    %ebp
+  800fbb:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800fbc:	83 ec 0c             	sub    $0xc,%esp
+  800fbf:	50                   	push   %eax
+  800fc0:	6a 0d                	push   $0xd
+  800fc2:	68 03 3b 80 00       	push   $0x803b03
+  800fc7:	6a 23                	push   $0x23
+  800fc9:	68 20 3b 80 00       	push   $0x803b20
+  800fce:	e8 ee f1 ff ff       	call   8001c1 <_panic>
+
+00800fd3 <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  800fd3:	55                   	push   %ebp
+  800fd4:	89 e5                	mov    %esp,%ebp
+  800fd6:	57                   	push   %edi
+  800fd7:	56                   	push   %esi
+  800fd8:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800fd9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fde:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800fe3:	89 d1                	mov    %edx,%ecx
+  800fe5:	89 d3                	mov    %edx,%ebx
+  800fe7:	89 d7                	mov    %edx,%edi
+  800fe9:	89 d6                	mov    %edx,%esi
+  800feb:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800fed:	5b                   	pop    %ebx
+  800fee:	5e                   	pop    %esi
+  800fef:	5f                   	pop    %edi
+  800ff0:	5d                   	pop    %ebp
+  800ff1:	c3                   	ret
+
+00800ff2 <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  800ff2:	55                   	push   %ebp
+  800ff3:	89 e5                	mov    %esp,%ebp
+  800ff5:	57                   	push   %edi
+  800ff6:	56                   	push   %esi
+  800ff7:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800ff8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ffb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ffe:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801003:	be 00 00 00 00       	mov    $0x0,%esi
+  801008:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80100b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80100e:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  801010:	5b                   	pop    %ebx
+  801011:	5e                   	pop    %esi
+  801012:	5f                   	pop    %edi
+  801013:	5d                   	pop    %ebp
+  801014:	c3                   	ret
+
+00801015 <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  801015:	55                   	push   %ebp
+  801016:	89 e5                	mov    %esp,%ebp
+  801018:	57                   	push   %edi
+  801019:	56                   	push   %esi
+  80101a:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80101b:	be 00 00 00 00       	mov    $0x0,%esi
+  801020:	8b 55 08             	mov    0x8(%ebp),%edx
+  801023:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801026:	b8 10 00 00 00       	mov    $0x10,%eax
+  80102b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80102e:	89 f7                	mov    %esi,%edi
+  801030:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  801032:	5b                   	pop    %ebx
+  801033:	5e                   	pop    %esi
+  801034:	5f                   	pop    %edi
+  801035:	5d                   	pop    %ebp
+  801036:	c3                   	ret
+
+00801037 <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  801037:	55                   	push   %ebp
+  801038:	89 e5                	mov    %esp,%ebp
+  80103a:	57                   	push   %edi
+  80103b:	56                   	push   %esi
+  80103c:	53                   	push   %ebx
+  80103d:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  801040:	80 3d 68 5e 80 00 00 	cmpb   $0x0,0x805e68
+  801047:	74 41                	je     80108a <sys_batch+0x53>
+  801049:	8b 45 08             	mov    0x8(%ebp),%eax
+  80104c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  80104f:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  801056:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801059:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  80105c:	7d 45                	jge    8010a3 <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  80105e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801061:	8b 06                	mov    (%esi),%eax
+  801063:	8b 56 04             	mov    0x4(%esi),%edx
+  801066:	8b 4e 08             	mov    0x8(%esi),%ecx
+  801069:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  80106c:	8b 7e 10             	mov    0x10(%esi),%edi
+  80106f:	8b 76 14             	mov    0x14(%esi),%esi
+  801072:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  801074:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801077:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  80107a:	83 c6 1c             	add    $0x1c,%esi
+  80107d:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  801080:	85 c0                	test   %eax,%eax
+  801082:	78 1f                	js     8010a3 <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  801084:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  801088:	eb cc                	jmp    801056 <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  80108a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80108f:	b8 13 00 00 00       	mov    $0x13,%eax
+  801094:	8b 55 08             	mov    0x8(%ebp),%edx
+  801097:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80109a:	89 df                	mov    %ebx,%edi
+  80109c:	89 de                	mov    %ebx,%esi
+  80109e:	cd 30                	int    $0x30
+  8010a0:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  8010a3:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8010a6:	83 c4 08             	add    $0x8,%esp
+  8010a9:	5b                   	pop    %ebx
+  8010aa:	5e                   	pop    %esi
+  8010ab:	5f                   	pop    %edi
+  8010ac:	5d                   	pop    %ebp
+  8010ad:	c3                   	ret
+
+008010ae <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  8010ae:	55                   	push   %ebp
+  8010af:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  8010b1:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010b4:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8010ba:	5d                   	pop    %ebp
+  8010bb:	c3                   	ret
+
+008010bc <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  8010bc:	55                   	push   %ebp
+  8010bd:	89 e5                	mov    %esp,%ebp
+  8010bf:	56                   	push   %esi
+  8010c0:	53                   	push   %ebx
+  8010c1:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  8010c4:	8b 1e                	mov    (%esi),%ebx
+  8010c6:	85 db                	test   %ebx,%ebx
+  8010c8:	75 09                	jne    8010d3 <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  8010ca:	89 d8                	mov    %ebx,%eax
+  8010cc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8010cf:	5b                   	pop    %ebx
+  8010d0:	5e                   	pop    %esi
+  8010d1:	5d                   	pop    %ebp
+  8010d2:	c3                   	ret
+  b->sb_n = 0;
+  8010d3:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  8010d9:	53                   	push   %ebx
+  8010da:	8d 46 04             	lea    0x4(%esi),%eax
+  8010dd:	50                   	push   %eax
+  8010de:	e8 54 ff ff ff       	call   801037 <sys_batch>
+  8010e3:	83 c4 08             	add    $0x8,%esp
+  8010e6:	85 c0                	test   %eax,%eax
+  8010e8:	78 1e                	js     801108 <sysbatch_flush+0x4c>
+  if (r < n)
+  8010ea:	39 c3                	cmp    %eax,%ebx
+  8010ec:	7f 07                	jg     8010f5 <sysbatch_flush+0x39>
+  return 0;
+  8010ee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010f3:	eb d5                	jmp    8010ca <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  8010f5:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8010f8:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  8010fc:	85 db                	test   %ebx,%ebx
+  8010fe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801103:	0f 49 d8             	cmovns %eax,%ebx
+  801106:	eb c2                	jmp    8010ca <sysbatch_flush+0xe>
+    return r;
+  801108:	89 c3                	mov    %eax,%ebx
+  80110a:	eb be                	jmp    8010ca <sysbatch_flush+0xe>
+
+0080110c <sysbatch_add>:
+{
+  80110c:	55                   	push   %ebp
+  80110d:	89 e5                	mov    %esp,%ebp
+  80110f:	53                   	push   %ebx
+  801110:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  801113:	83 3b 40             	cmpl   $0x40,(%ebx)
+  801116:	74 41                	je     801159 <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  801118:	8b 03                	mov    (%ebx),%eax
+  80111a:	8d 50 01             	lea    0x1(%eax),%edx
+  80111d:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  80111f:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801122:	01 d8                	add    %ebx,%eax
+  801124:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801127:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  80112a:	8b 55 10             	mov    0x10(%ebp),%edx
+  80112d:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  801130:	8b 55 14             	mov    0x14(%ebp),%edx
+  801133:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  801136:	8b 55 18             	mov    0x18(%ebp),%edx
+  801139:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  80113c:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  80113f:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  801142:	8b 55 20             	mov    0x20(%ebp),%edx
+  801145:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  801148:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  80114f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801154:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801157:	c9                   	leave
+  801158:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  801159:	53                   	push   %ebx
+  80115a:	e8 5d ff ff ff       	call   8010bc <sysbatch_flush>
+  80115f:	83 c4 04             	add    $0x4,%esp
+  801162:	85 c0                	test   %eax,%eax
+  801164:	79 b2                	jns    801118 <sysbatch_add+0xc>
+  801166:	eb ec                	jmp    801154 <sysbatch_add+0x48>
+
+00801168 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801168:	55                   	push   %ebp
+  801169:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80116b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80116e:	05 00 00 00 30       	add    $0x30000000,%eax
+  801173:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801176:	5d                   	pop    %ebp
+  801177:	c3                   	ret
+
+00801178 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801178:	55                   	push   %ebp
+  801179:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80117b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80117e:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  801181:	66 b8 00 00          	mov    $0x0,%ax
+  801185:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80118a:	5d                   	pop    %ebp
+  80118b:	c3                   	ret
+
+0080118c <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80118c:	55                   	push   %ebp
+  80118d:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  80118f:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801194:	eb 02                	jmp    801198 <fd_alloc+0xc>
+  801196:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801198:	89 c2                	mov    %eax,%edx
+  80119a:	c1 ea 16             	shr    $0x16,%edx
+  80119d:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8011a4:	f6 c2 01             	test   $0x1,%dl
+  8011a7:	74 2b                	je     8011d4 <fd_alloc+0x48>
+  8011a9:	89 c2                	mov    %eax,%edx
+  8011ab:	c1 ea 0c             	shr    $0xc,%edx
+  8011ae:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8011b5:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8011bb:	f6 c1 01             	test   $0x1,%cl
+  8011be:	74 14                	je     8011d4 <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  8011c0:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8011c6:	75 ce                	jne    801196 <fd_alloc+0xa>
+  8011c8:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  8011cd:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8011d2:	eb 05                	jmp    8011d9 <fd_alloc+0x4d>
+      return 0;
+  8011d4:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  8011d9:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011dc:	89 02                	mov    %eax,(%edx)
+}
+  8011de:	89 c8                	mov    %ecx,%eax
+  8011e0:	5d                   	pop    %ebp
+  8011e1:	c3                   	ret
+
+008011e2 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8011e2:	55                   	push   %ebp
+  8011e3:	89 e5                	mov    %esp,%ebp
+  8011e5:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  8011e8:	83 f8 1f             	cmp    $0x1f,%eax
+  8011eb:	77 30                	ja     80121d <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  8011ed:	c1 e0 0c             	shl    $0xc,%eax
+  8011f0:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8011f5:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8011fb:	f6 c2 01             	test   $0x1,%dl
+  8011fe:	74 24                	je     801224 <fd_lookup+0x42>
+  801200:	89 c2                	mov    %eax,%edx
+  801202:	c1 ea 0c             	shr    $0xc,%edx
+  801205:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80120c:	f6 c2 01             	test   $0x1,%dl
+  80120f:	74 1a                	je     80122b <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  801211:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801214:	89 02                	mov    %eax,(%edx)
+  return 0;
+  801216:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80121b:	5d                   	pop    %ebp
+  80121c:	c3                   	ret
+    return -E_INVAL;
+  80121d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801222:	eb f7                	jmp    80121b <fd_lookup+0x39>
+    return -E_INVAL;
+  801224:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801229:	eb f0                	jmp    80121b <fd_lookup+0x39>
+  80122b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801230:	eb e9                	jmp    80121b <fd_lookup+0x39>
+
+00801232 <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801232:	55                   	push   %ebp
+  801233:	89 e5                	mov    %esp,%ebp
+  801235:	53                   	push   %ebx
+  801236:	83 ec 04             	sub    $0x4,%esp
+  801239:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  80123c:	b8 ac 3b 80 00       	mov    $0x803bac,%eax
+  801241:	8b 18                	mov    (%eax),%ebx
+  801243:	85 db                	test   %ebx,%ebx
+  801245:	74 0e                	je     801255 <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  801247:	83 c0 04             	add    $0x4,%eax
+  80124a:	39 13                	cmp    %edx,(%ebx)
+  80124c:	75 f3                	jne    801241 <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  80124e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801253:	eb 1f                	jmp    801274 <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801255:	a1 64 5e 80 00       	mov    0x805e64,%eax
+  80125a:	8b 40 48             	mov    0x48(%eax),%eax
+  80125d:	83 ec 04             	sub    $0x4,%esp
+  801260:	52                   	push   %edx
+  801261:	50                   	push   %eax
+  801262:	68 30 3b 80 00       	push   $0x803b30
+  801267:	e8 30 f0 ff ff       	call   80029c <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  80126c:	83 c4 10             	add    $0x10,%esp
+  80126f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  801274:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801277:	89 1a                	mov    %ebx,(%edx)
+}
+  801279:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80127c:	c9                   	leave
+  80127d:	c3                   	ret
+
+0080127e <fd_close>:
+{
+  80127e:	55                   	push   %ebp
+  80127f:	89 e5                	mov    %esp,%ebp
+  801281:	57                   	push   %edi
+  801282:	56                   	push   %esi
+  801283:	53                   	push   %ebx
+  801284:	83 ec 24             	sub    $0x24,%esp
+  801287:	8b 75 08             	mov    0x8(%ebp),%esi
+  80128a:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80128d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801290:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801291:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801297:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80129a:	50                   	push   %eax
+  80129b:	e8 42 ff ff ff       	call   8011e2 <fd_lookup>
+  8012a0:	89 c3                	mov    %eax,%ebx
+  8012a2:	83 c4 10             	add    $0x10,%esp
+  8012a5:	85 c0                	test   %eax,%eax
+  8012a7:	78 05                	js     8012ae <fd_close+0x30>
+      || fd != fd2)
+  8012a9:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8012ac:	74 16                	je     8012c4 <fd_close+0x46>
+    return must_exist ? r : 0;
+  8012ae:	89 f8                	mov    %edi,%eax
+  8012b0:	84 c0                	test   %al,%al
+  8012b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012b7:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8012ba:	89 d8                	mov    %ebx,%eax
+  8012bc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8012bf:	5b                   	pop    %ebx
+  8012c0:	5e                   	pop    %esi
+  8012c1:	5f                   	pop    %edi
+  8012c2:	5d                   	pop    %ebp
+  8012c3:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8012c4:	83 ec 08             	sub    $0x8,%esp
+  8012c7:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8012ca:	50                   	push   %eax
+  8012cb:	ff 36                	push   (%esi)
+  8012cd:	e8 60 ff ff ff       	call   801232 <dev_lookup>
+  8012d2:	89 c3                	mov    %eax,%ebx
+  8012d4:	83 c4 10             	add    $0x10,%esp
+  8012d7:	85 c0                	test   %eax,%eax
+  8012d9:	78 1a                	js     8012f5 <fd_close+0x77>
+    if (dev->dev_close)
+  8012db:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8012de:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  8012e1:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  8012e6:	85 c0                	test   %eax,%eax
+  8012e8:	74 0b                	je     8012f5 <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  8012ea:	83 ec 0c             	sub    $0xc,%esp
+  8012ed:	56                   	push   %esi
+  8012ee:	ff d0                	call   *%eax
+  8012f0:	89 c3                	mov    %eax,%ebx
+  8012f2:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  8012f5:	83 ec 08             	sub    $0x8,%esp
+  8012f8:	56                   	push   %esi
+  8012f9:	6a 00                	push   $0x0
+  8012fb:	e8 3e fa ff ff       	call   800d3e <sys_page_unmap>
+  return r;
+  801300:	83 c4 10             	add    $0x10,%esp
+  801303:	eb b5                	jmp    8012ba <fd_close+0x3c>
+
+00801305 <close>:
+
+int
+close(int fdnum)
+{
+  801305:	55                   	push   %ebp
+  801306:	89 e5                	mov    %esp,%ebp
+  801308:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80130b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80130e:	50                   	push   %eax
+  80130f:	ff 75 08             	push   0x8(%ebp)
+  801312:	e8 cb fe ff ff       	call   8011e2 <fd_lookup>
+  801317:	83 c4 10             	add    $0x10,%esp
+  80131a:	85 c0                	test   %eax,%eax
+  80131c:	79 02                	jns    801320 <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  80131e:	c9                   	leave
+  80131f:	c3                   	ret
+    return fd_close(fd, 1);
+  801320:	83 ec 08             	sub    $0x8,%esp
+  801323:	6a 01                	push   $0x1
+  801325:	ff 75 f4             	push   -0xc(%ebp)
+  801328:	e8 51 ff ff ff       	call   80127e <fd_close>
+  80132d:	83 c4 10             	add    $0x10,%esp
+  801330:	eb ec                	jmp    80131e <close+0x19>
+
+00801332 <close_all>:
+
+void
+close_all(void)
+{
+  801332:	55                   	push   %ebp
+  801333:	89 e5                	mov    %esp,%ebp
+  801335:	53                   	push   %ebx
+  801336:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  801339:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  80133e:	83 ec 0c             	sub    $0xc,%esp
+  801341:	53                   	push   %ebx
+  801342:	e8 be ff ff ff       	call   801305 <close>
+  for (i = 0; i < MAXFD; i++)
+  801347:	83 c3 01             	add    $0x1,%ebx
+  80134a:	83 c4 10             	add    $0x10,%esp
+  80134d:	83 fb 20             	cmp    $0x20,%ebx
+  801350:	75 ec                	jne    80133e <close_all+0xc>
+}
+  801352:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801355:	c9                   	leave
+  801356:	c3                   	ret
+
+00801357 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801357:	55                   	push   %ebp
+  801358:	89 e5                	mov    %esp,%ebp
+  80135a:	57                   	push   %edi
+  80135b:	56                   	push   %esi
+  80135c:	53                   	push   %ebx
+  80135d:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801360:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801363:	50                   	push   %eax
+  801364:	ff 75 08             	push   0x8(%ebp)
+  801367:	e8 76 fe ff ff       	call   8011e2 <fd_lookup>
+  80136c:	89 c6                	mov    %eax,%esi
+  80136e:	83 c4 10             	add    $0x10,%esp
+  801371:	85 c0                	test   %eax,%eax
+  801373:	0f 88 0a 01 00 00    	js     801483 <dup+0x12c>
+    return r;
+  close(newfdnum);
+  801379:	83 ec 0c             	sub    $0xc,%esp
+  80137c:	ff 75 0c             	push   0xc(%ebp)
+  80137f:	e8 81 ff ff ff       	call   801305 <close>
+
+  newfd = INDEX2FD(newfdnum);
+  801384:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801387:	c1 e0 0c             	shl    $0xc,%eax
+  80138a:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  801390:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  801393:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801396:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  801399:	89 04 24             	mov    %eax,(%esp)
+  80139c:	e8 d7 fd ff ff       	call   801178 <fd2data>
+  8013a1:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  8013a3:	89 3c 24             	mov    %edi,(%esp)
+  8013a6:	e8 cd fd ff ff       	call   801178 <fd2data>
+  8013ab:	83 c4 10             	add    $0x10,%esp
+  8013ae:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8013b1:	89 f3                	mov    %esi,%ebx
+  8013b3:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  8013b9:	89 c6                	mov    %eax,%esi
+  8013bb:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8013be:	89 cf                	mov    %ecx,%edi
+  8013c0:	eb 0c                	jmp    8013ce <dup+0x77>
+  8013c2:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8013c8:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8013ce:	39 fb                	cmp    %edi,%ebx
+  8013d0:	74 7b                	je     80144d <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  8013d2:	89 d8                	mov    %ebx,%eax
+  8013d4:	c1 e8 16             	shr    $0x16,%eax
+  8013d7:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8013de:	a8 01                	test   $0x1,%al
+  8013e0:	74 e0                	je     8013c2 <dup+0x6b>
+  8013e2:	89 d8                	mov    %ebx,%eax
+  8013e4:	c1 e8 0c             	shr    $0xc,%eax
+  8013e7:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8013ee:	f6 c2 01             	test   $0x1,%dl
+  8013f1:	74 cf                	je     8013c2 <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  8013f3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  8013fa:	83 ec 0c             	sub    $0xc,%esp
+  8013fd:	25 07 0e 00 00       	and    $0xe07,%eax
+  801402:	50                   	push   %eax
+  801403:	56                   	push   %esi
+  801404:	6a 00                	push   $0x0
+  801406:	53                   	push   %ebx
+  801407:	6a 00                	push   $0x0
+  801409:	e8 ee f8 ff ff       	call   800cfc <sys_page_map>
+  80140e:	83 c4 20             	add    $0x20,%esp
+  801411:	85 c0                	test   %eax,%eax
+  801413:	79 ad                	jns    8013c2 <dup+0x6b>
+  801415:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801418:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  80141a:	83 ec 08             	sub    $0x8,%esp
+  80141d:	ff 75 d4             	push   -0x2c(%ebp)
+  801420:	6a 00                	push   $0x0
+  801422:	e8 17 f9 ff ff       	call   800d3e <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801427:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  80142a:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  801430:	83 c4 10             	add    $0x10,%esp
+  801433:	39 df                	cmp    %ebx,%edi
+  801435:	74 4c                	je     801483 <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  801437:	83 ec 08             	sub    $0x8,%esp
+  80143a:	57                   	push   %edi
+  80143b:	6a 00                	push   $0x0
+  80143d:	e8 fc f8 ff ff       	call   800d3e <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801442:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  801448:	83 c4 10             	add    $0x10,%esp
+  80144b:	eb e6                	jmp    801433 <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80144d:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801450:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  801453:	89 c8                	mov    %ecx,%eax
+  801455:	c1 e8 0c             	shr    $0xc,%eax
+  801458:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80145f:	83 ec 0c             	sub    $0xc,%esp
+  801462:	25 07 0e 00 00       	and    $0xe07,%eax
+  801467:	50                   	push   %eax
+  801468:	ff 75 d4             	push   -0x2c(%ebp)
+  80146b:	6a 00                	push   $0x0
+  80146d:	51                   	push   %ecx
+  80146e:	6a 00                	push   $0x0
+  801470:	e8 87 f8 ff ff       	call   800cfc <sys_page_map>
+  801475:	89 c6                	mov    %eax,%esi
+  801477:	83 c4 20             	add    $0x20,%esp
+  80147a:	85 c0                	test   %eax,%eax
+  80147c:	78 9c                	js     80141a <dup+0xc3>
+  return newfdnum;
+  80147e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801481:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  801483:	89 f0                	mov    %esi,%eax
+  801485:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801488:	5b                   	pop    %ebx
+  801489:	5e                   	pop    %esi
+  80148a:	5f                   	pop    %edi
+  80148b:	5d                   	pop    %ebp
+  80148c:	c3                   	ret
+
+0080148d <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  80148d:	55                   	push   %ebp
+  80148e:	89 e5                	mov    %esp,%ebp
+  801490:	56                   	push   %esi
+  801491:	53                   	push   %ebx
+  801492:	83 ec 18             	sub    $0x18,%esp
+  801495:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801498:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80149b:	50                   	push   %eax
+  80149c:	56                   	push   %esi
+  80149d:	e8 40 fd ff ff       	call   8011e2 <fd_lookup>
+  8014a2:	83 c4 10             	add    $0x10,%esp
+  8014a5:	85 c0                	test   %eax,%eax
+  8014a7:	78 3c                	js     8014e5 <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8014a9:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8014ac:	83 ec 08             	sub    $0x8,%esp
+  8014af:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014b2:	50                   	push   %eax
+  8014b3:	ff 33                	push   (%ebx)
+  8014b5:	e8 78 fd ff ff       	call   801232 <dev_lookup>
+  8014ba:	83 c4 10             	add    $0x10,%esp
+  8014bd:	85 c0                	test   %eax,%eax
+  8014bf:	78 24                	js     8014e5 <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8014c1:	8b 43 08             	mov    0x8(%ebx),%eax
+  8014c4:	83 e0 03             	and    $0x3,%eax
+  8014c7:	83 f8 01             	cmp    $0x1,%eax
+  8014ca:	74 20                	je     8014ec <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  8014cc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014cf:	8b 40 08             	mov    0x8(%eax),%eax
+  8014d2:	85 c0                	test   %eax,%eax
+  8014d4:	74 37                	je     80150d <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  8014d6:	83 ec 04             	sub    $0x4,%esp
+  8014d9:	ff 75 10             	push   0x10(%ebp)
+  8014dc:	ff 75 0c             	push   0xc(%ebp)
+  8014df:	53                   	push   %ebx
+  8014e0:	ff d0                	call   *%eax
+  8014e2:	83 c4 10             	add    $0x10,%esp
+}
+  8014e5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014e8:	5b                   	pop    %ebx
+  8014e9:	5e                   	pop    %esi
+  8014ea:	5d                   	pop    %ebp
+  8014eb:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8014ec:	a1 64 5e 80 00       	mov    0x805e64,%eax
+  8014f1:	8b 40 48             	mov    0x48(%eax),%eax
+  8014f4:	83 ec 04             	sub    $0x4,%esp
+  8014f7:	56                   	push   %esi
+  8014f8:	50                   	push   %eax
+  8014f9:	68 71 3b 80 00       	push   $0x803b71
+  8014fe:	e8 99 ed ff ff       	call   80029c <cprintf>
+    return -E_INVAL;
+  801503:	83 c4 10             	add    $0x10,%esp
+  801506:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80150b:	eb d8                	jmp    8014e5 <read+0x58>
+    return -E_NOT_SUPP;
+  80150d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801512:	eb d1                	jmp    8014e5 <read+0x58>
+
+00801514 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801514:	55                   	push   %ebp
+  801515:	89 e5                	mov    %esp,%ebp
+  801517:	57                   	push   %edi
+  801518:	56                   	push   %esi
+  801519:	53                   	push   %ebx
+  80151a:	83 ec 0c             	sub    $0xc,%esp
+  80151d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801520:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  801523:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801528:	eb 02                	jmp    80152c <readn+0x18>
+  80152a:	01 c3                	add    %eax,%ebx
+  80152c:	39 f3                	cmp    %esi,%ebx
+  80152e:	73 21                	jae    801551 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  801530:	83 ec 04             	sub    $0x4,%esp
+  801533:	89 f0                	mov    %esi,%eax
+  801535:	29 d8                	sub    %ebx,%eax
+  801537:	50                   	push   %eax
+  801538:	89 d8                	mov    %ebx,%eax
+  80153a:	03 45 0c             	add    0xc(%ebp),%eax
+  80153d:	50                   	push   %eax
+  80153e:	57                   	push   %edi
+  80153f:	e8 49 ff ff ff       	call   80148d <read>
+    if (m < 0)
+  801544:	83 c4 10             	add    $0x10,%esp
+  801547:	85 c0                	test   %eax,%eax
+  801549:	78 04                	js     80154f <readn+0x3b>
+      return m;
+    if (m == 0)
+  80154b:	75 dd                	jne    80152a <readn+0x16>
+  80154d:	eb 02                	jmp    801551 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  80154f:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  801551:	89 d8                	mov    %ebx,%eax
+  801553:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801556:	5b                   	pop    %ebx
+  801557:	5e                   	pop    %esi
+  801558:	5f                   	pop    %edi
+  801559:	5d                   	pop    %ebp
+  80155a:	c3                   	ret
+
+0080155b <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  80155b:	55                   	push   %ebp
+  80155c:	89 e5                	mov    %esp,%ebp
+  80155e:	56                   	push   %esi
+  80155f:	53                   	push   %ebx
+  801560:	83 ec 18             	sub    $0x18,%esp
+  801563:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801566:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801569:	50                   	push   %eax
+  80156a:	53                   	push   %ebx
+  80156b:	e8 72 fc ff ff       	call   8011e2 <fd_lookup>
+  801570:	83 c4 10             	add    $0x10,%esp
+  801573:	85 c0                	test   %eax,%eax
+  801575:	78 37                	js     8015ae <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801577:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80157a:	83 ec 08             	sub    $0x8,%esp
+  80157d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801580:	50                   	push   %eax
+  801581:	ff 36                	push   (%esi)
+  801583:	e8 aa fc ff ff       	call   801232 <dev_lookup>
+  801588:	83 c4 10             	add    $0x10,%esp
+  80158b:	85 c0                	test   %eax,%eax
+  80158d:	78 1f                	js     8015ae <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80158f:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801593:	74 20                	je     8015b5 <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  801595:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801598:	8b 40 0c             	mov    0xc(%eax),%eax
+  80159b:	85 c0                	test   %eax,%eax
+  80159d:	74 37                	je     8015d6 <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  80159f:	83 ec 04             	sub    $0x4,%esp
+  8015a2:	ff 75 10             	push   0x10(%ebp)
+  8015a5:	ff 75 0c             	push   0xc(%ebp)
+  8015a8:	56                   	push   %esi
+  8015a9:	ff d0                	call   *%eax
+  8015ab:	83 c4 10             	add    $0x10,%esp
+}
+  8015ae:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015b1:	5b                   	pop    %ebx
+  8015b2:	5e                   	pop    %esi
+  8015b3:	5d                   	pop    %ebp
+  8015b4:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8015b5:	a1 64 5e 80 00       	mov    0x805e64,%eax
+  8015ba:	8b 40 48             	mov    0x48(%eax),%eax
+  8015bd:	83 ec 04             	sub    $0x4,%esp
+  8015c0:	53                   	push   %ebx
+  8015c1:	50                   	push   %eax
+  8015c2:	68 8d 3b 80 00       	push   $0x803b8d
+  8015c7:	e8 d0 ec ff ff       	call   80029c <cprintf>
+    return -E_INVAL;
+  8015cc:	83 c4 10             	add    $0x10,%esp
+  8015cf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015d4:	eb d8                	jmp    8015ae <write+0x53>
+    return -E_NOT_SUPP;
+  8015d6:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015db:	eb d1                	jmp    8015ae <write+0x53>
+
+008015dd <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8015dd:	55                   	push   %ebp
+  8015de:	89 e5                	mov    %esp,%ebp
+  8015e0:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8015e3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015e6:	50                   	push   %eax
+  8015e7:	ff 75 08             	push   0x8(%ebp)
+  8015ea:	e8 f3 fb ff ff       	call   8011e2 <fd_lookup>
+  8015ef:	83 c4 10             	add    $0x10,%esp
+  8015f2:	85 c0                	test   %eax,%eax
+  8015f4:	78 0e                	js     801604 <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  8015f6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8015f9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015fc:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  8015ff:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801604:	c9                   	leave
+  801605:	c3                   	ret
+
+00801606 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801606:	55                   	push   %ebp
+  801607:	89 e5                	mov    %esp,%ebp
+  801609:	56                   	push   %esi
+  80160a:	53                   	push   %ebx
+  80160b:	83 ec 18             	sub    $0x18,%esp
+  80160e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801611:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801614:	50                   	push   %eax
+  801615:	53                   	push   %ebx
+  801616:	e8 c7 fb ff ff       	call   8011e2 <fd_lookup>
+  80161b:	83 c4 10             	add    $0x10,%esp
+  80161e:	85 c0                	test   %eax,%eax
+  801620:	78 34                	js     801656 <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801622:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801625:	83 ec 08             	sub    $0x8,%esp
+  801628:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80162b:	50                   	push   %eax
+  80162c:	ff 36                	push   (%esi)
+  80162e:	e8 ff fb ff ff       	call   801232 <dev_lookup>
+  801633:	83 c4 10             	add    $0x10,%esp
+  801636:	85 c0                	test   %eax,%eax
+  801638:	78 1c                	js     801656 <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80163a:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80163e:	74 1d                	je     80165d <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  801640:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801643:	8b 40 18             	mov    0x18(%eax),%eax
+  801646:	85 c0                	test   %eax,%eax
+  801648:	74 34                	je     80167e <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  80164a:	83 ec 08             	sub    $0x8,%esp
+  80164d:	ff 75 0c             	push   0xc(%ebp)
+  801650:	56                   	push   %esi
+  801651:	ff d0                	call   *%eax
+  801653:	83 c4 10             	add    $0x10,%esp
+}
+  801656:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801659:	5b                   	pop    %ebx
+  80165a:	5e                   	pop    %esi
+  80165b:	5d                   	pop    %ebp
+  80165c:	c3                   	ret
+            thisenv->env_id, fdnum);
+  80165d:	a1 64 5e 80 00       	mov    0x805e64,%eax
+  801662:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801665:	83 ec 04             	sub    $0x4,%esp
+  801668:	53                   	push   %ebx
+  801669:	50                   	push   %eax
+  80166a:	68 50 3b 80 00       	push   $0x803b50
+  80166f:	e8 28 ec ff ff       	call   80029c <cprintf>
+    return -E_INVAL;
+  801674:	83 c4 10             	add    $0x10,%esp
+  801677:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80167c:	eb d8                	jmp    801656 <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  80167e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801683:	eb d1                	jmp    801656 <ftruncate+0x50>
+
+00801685 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801685:	55                   	push   %ebp
+  801686:	89 e5                	mov    %esp,%ebp
+  801688:	56                   	push   %esi
+  801689:	53                   	push   %ebx
+  80168a:	83 ec 18             	sub    $0x18,%esp
+  80168d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801690:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801693:	50                   	push   %eax
+  801694:	ff 75 08             	push   0x8(%ebp)
+  801697:	e8 46 fb ff ff       	call   8011e2 <fd_lookup>
+  80169c:	83 c4 10             	add    $0x10,%esp
+  80169f:	85 c0                	test   %eax,%eax
+  8016a1:	78 49                	js     8016ec <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8016a3:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8016a6:	83 ec 08             	sub    $0x8,%esp
+  8016a9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016ac:	50                   	push   %eax
+  8016ad:	ff 36                	push   (%esi)
+  8016af:	e8 7e fb ff ff       	call   801232 <dev_lookup>
+  8016b4:	83 c4 10             	add    $0x10,%esp
+  8016b7:	85 c0                	test   %eax,%eax
+  8016b9:	78 31                	js     8016ec <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  8016bb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016be:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8016c2:	74 2f                	je     8016f3 <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  8016c4:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  8016c7:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8016ce:	00 00 00 
+  stat->st_isdir = 0;
+  8016d1:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8016d8:	00 00 00 
+  stat->st_dev = dev;
+  8016db:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  8016e1:	83 ec 08             	sub    $0x8,%esp
+  8016e4:	53                   	push   %ebx
+  8016e5:	56                   	push   %esi
+  8016e6:	ff 50 14             	call   *0x14(%eax)
+  8016e9:	83 c4 10             	add    $0x10,%esp
+}
+  8016ec:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016ef:	5b                   	pop    %ebx
+  8016f0:	5e                   	pop    %esi
+  8016f1:	5d                   	pop    %ebp
+  8016f2:	c3                   	ret
+    return -E_NOT_SUPP;
+  8016f3:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8016f8:	eb f2                	jmp    8016ec <fstat+0x67>
+
+008016fa <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  8016fa:	55                   	push   %ebp
+  8016fb:	89 e5                	mov    %esp,%ebp
+  8016fd:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  801700:	ff 75 0c             	push   0xc(%ebp)
+  801703:	ff 75 08             	push   0x8(%ebp)
+  801706:	e8 58 07 00 00       	call   801e63 <file_stat>
+}
+  80170b:	c9                   	leave
+  80170c:	c3                   	ret
+
+0080170d <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  80170d:	55                   	push   %ebp
+  80170e:	89 e5                	mov    %esp,%ebp
+  801710:	57                   	push   %edi
+  801711:	56                   	push   %esi
+  801712:	53                   	push   %ebx
+  801713:	83 ec 1c             	sub    $0x1c,%esp
+  801716:	89 c7                	mov    %eax,%edi
+  801718:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  80171b:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  80171e:	e9 a2 00 00 00       	jmp    8017c5 <fsipc_send+0xb8>
+  nfsenvs = 0;
+  801723:	c7 05 00 50 80 00 00 	movl   $0x0,0x805000
+  80172a:	00 00 00 
+  80172d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801732:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801737:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  80173c:	be 01 00 00 00       	mov    $0x1,%esi
+  801741:	eb 0f                	jmp    801752 <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801743:	83 c0 01             	add    $0x1,%eax
+  801746:	3d 00 04 00 00       	cmp    $0x400,%eax
+  80174b:	74 49                	je     801796 <fsipc_send+0x89>
+  80174d:	83 f9 07             	cmp    $0x7,%ecx
+  801750:	7f 50                	jg     8017a2 <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  801752:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801755:	c1 e2 04             	shl    $0x4,%edx
+  801758:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80175e:	8b 52 50             	mov    0x50(%edx),%edx
+  801761:	83 fa 01             	cmp    $0x1,%edx
+  801764:	75 dd                	jne    801743 <fsipc_send+0x36>
+  801766:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801769:	c1 e2 04             	shl    $0x4,%edx
+  80176c:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801772:	8b 52 54             	mov    0x54(%edx),%edx
+  801775:	85 d2                	test   %edx,%edx
+  801777:	74 ca                	je     801743 <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801779:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  80177c:	c1 e2 04             	shl    $0x4,%edx
+  80177f:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801785:	8b 52 48             	mov    0x48(%edx),%edx
+  801788:	89 14 8d 20 50 80 00 	mov    %edx,0x805020(,%ecx,4)
+  80178f:	8d 49 01             	lea    0x1(%ecx),%ecx
+  801792:	89 f3                	mov    %esi,%ebx
+  801794:	eb ad                	jmp    801743 <fsipc_send+0x36>
+  801796:	84 db                	test   %bl,%bl
+  801798:	74 38                	je     8017d2 <fsipc_send+0xc5>
+  80179a:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  8017a0:	eb 30                	jmp    8017d2 <fsipc_send+0xc5>
+  8017a2:	84 db                	test   %bl,%bl
+  8017a4:	74 2c                	je     8017d2 <fsipc_send+0xc5>
+  8017a6:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  8017ac:	eb 24                	jmp    8017d2 <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  8017ae:	50                   	push   %eax
+  8017af:	68 bc 3b 80 00       	push   $0x803bbc
+  8017b4:	6a 34                	push   $0x34
+  8017b6:	68 c6 3b 80 00       	push   $0x803bc6
+  8017bb:	e8 01 ea ff ff       	call   8001c1 <_panic>
+    }
+    sys_yield();
+  8017c0:	e8 92 f4 ff ff       	call   800c57 <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  8017c5:	83 3d 00 50 80 00 03 	cmpl   $0x3,0x805000
+  8017cc:	0f 8e 51 ff ff ff    	jle    801723 <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  8017d2:	a1 64 5e 80 00       	mov    0x805e64,%eax
+  8017d7:	8b 70 48             	mov    0x48(%eax),%esi
+  8017da:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  8017e0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8017e5:	8b 0d 00 50 80 00    	mov    0x805000,%ecx
+  8017eb:	39 d9                	cmp    %ebx,%ecx
+  8017ed:	7e d1                	jle    8017c0 <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  8017ef:	83 ec 0c             	sub    $0xc,%esp
+  8017f2:	ff 75 e0             	push   -0x20(%ebp)
+  8017f5:	6a 07                	push   $0x7
+  8017f7:	ff 75 e4             	push   -0x1c(%ebp)
+  8017fa:	57                   	push   %edi
+  8017fb:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  8017fe:	99                   	cltd
+  8017ff:	f7 f9                	idiv   %ecx
+  801801:	ff 34 95 20 50 80 00 	push   0x805020(,%edx,4)
+  801808:	e8 63 f7 ff ff       	call   800f70 <sys_ipc_try_send>
+      if (r == 0)
+  80180d:	83 c4 20             	add    $0x20,%esp
+  801810:	85 c0                	test   %eax,%eax
+  801812:	74 0a                	je     80181e <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  801814:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801817:	75 95                	jne    8017ae <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  801819:	83 c3 01             	add    $0x1,%ebx
+  80181c:	eb c7                	jmp    8017e5 <fsipc_send+0xd8>
+  }
+}
+  80181e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801821:	5b                   	pop    %ebx
+  801822:	5e                   	pop    %esi
+  801823:	5f                   	pop    %edi
+  801824:	5d                   	pop    %ebp
+  801825:	c3                   	ret
+
+00801826 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801826:	55                   	push   %ebp
+  801827:	89 e5                	mov    %esp,%ebp
+  801829:	53                   	push   %ebx
+  80182a:	83 ec 14             	sub    $0x14,%esp
+  80182d:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  80182f:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  801836:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80183b:	ba 00 60 80 00       	mov    $0x806000,%edx
+  801840:	e8 c8 fe ff ff       	call   80170d <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801845:	6a 00                	push   $0x0
+  801847:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80184a:	50                   	push   %eax
+  80184b:	53                   	push   %ebx
+  80184c:	6a 00                	push   $0x0
+  80184e:	e8 1e 1b 00 00       	call   803371 <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  801853:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801856:	c9                   	leave
+  801857:	c3                   	ret
+
+00801858 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801858:	55                   	push   %ebp
+  801859:	89 e5                	mov    %esp,%ebp
+  80185b:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80185e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801861:	8b 40 0c             	mov    0xc(%eax),%eax
+  801864:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.set_size.req_size = newsize;
+  801869:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80186c:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801871:	ba 00 00 00 00       	mov    $0x0,%edx
+  801876:	b8 02 00 00 00       	mov    $0x2,%eax
+  80187b:	e8 a6 ff ff ff       	call   801826 <fsipc>
+}
+  801880:	c9                   	leave
+  801881:	c3                   	ret
+
+00801882 <devfile_flush>:
+{
+  801882:	55                   	push   %ebp
+  801883:	89 e5                	mov    %esp,%ebp
+  801885:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801888:	8b 45 08             	mov    0x8(%ebp),%eax
+  80188b:	8b 40 0c             	mov    0xc(%eax),%eax
+  80188e:	a3 00 60 80 00       	mov    %eax,0x806000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801893:	ba 00 00 00 00       	mov    $0x0,%edx
+  801898:	b8 06 00 00 00       	mov    $0x6,%eax
+  80189d:	e8 84 ff ff ff       	call   801826 <fsipc>
+}
+  8018a2:	c9                   	leave
+  8018a3:	c3                   	ret
+
+008018a4 <devfile_stat>:
+{
+  8018a4:	55                   	push   %ebp
+  8018a5:	89 e5                	mov    %esp,%ebp
+  8018a7:	53                   	push   %ebx
+  8018a8:	83 ec 04             	sub    $0x4,%esp
+  8018ab:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8018ae:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018b1:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018b4:	a3 00 60 80 00       	mov    %eax,0x806000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8018b9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018be:	b8 05 00 00 00       	mov    $0x5,%eax
+  8018c3:	e8 5e ff ff ff       	call   801826 <fsipc>
+  8018c8:	85 c0                	test   %eax,%eax
+  8018ca:	78 2c                	js     8018f8 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8018cc:	83 ec 08             	sub    $0x8,%esp
+  8018cf:	68 00 60 80 00       	push   $0x806000
+  8018d4:	53                   	push   %ebx
+  8018d5:	e8 b0 ef ff ff       	call   80088a <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  8018da:	a1 80 60 80 00       	mov    0x806080,%eax
+  8018df:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8018e5:	a1 84 60 80 00       	mov    0x806084,%eax
+  8018ea:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  8018f0:	83 c4 10             	add    $0x10,%esp
+  8018f3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018f8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8018fb:	c9                   	leave
+  8018fc:	c3                   	ret
+
+008018fd <fsv_alloc>:
+{
+  8018fd:	55                   	push   %ebp
+  8018fe:	89 e5                	mov    %esp,%ebp
+  801900:	56                   	push   %esi
+  801901:	53                   	push   %ebx
+  801902:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  801904:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801909:	eb 22                	jmp    80192d <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  80190b:	83 ec 04             	sub    $0x4,%esp
+  80190e:	6a 00                	push   $0x0
+  801910:	6a 00                	push   $0x0
+  801912:	6a 07                	push   $0x7
+  801914:	50                   	push   %eax
+  801915:	6a 00                	push   $0x0
+  801917:	6a 04                	push   $0x4
+  801919:	68 40 50 80 00       	push   $0x805040
+  80191e:	e8 e9 f7 ff ff       	call   80110c <sysbatch_add>
+  801923:	83 c4 20             	add    $0x20,%esp
+  801926:	85 c0                	test   %eax,%eax
+  801928:	78 48                	js     801972 <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  80192a:	83 c3 01             	add    $0x1,%ebx
+  80192d:	39 f3                	cmp    %esi,%ebx
+  80192f:	74 31                	je     801962 <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  801931:	89 d8                	mov    %ebx,%eax
+  801933:	c1 e0 0c             	shl    $0xc,%eax
+  801936:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  80193b:	89 c2                	mov    %eax,%edx
+  80193d:	c1 ea 16             	shr    $0x16,%edx
+  801940:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801947:	f6 c2 01             	test   $0x1,%dl
+  80194a:	74 bf                	je     80190b <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  80194c:	89 c2                	mov    %eax,%edx
+  80194e:	c1 ea 0c             	shr    $0xc,%edx
+  801951:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801958:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  80195b:	83 fa 03             	cmp    $0x3,%edx
+  80195e:	75 ab                	jne    80190b <fsv_alloc+0xe>
+  801960:	eb c8                	jmp    80192a <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  801962:	83 ec 0c             	sub    $0xc,%esp
+  801965:	68 40 50 80 00       	push   $0x805040
+  80196a:	e8 4d f7 ff ff       	call   8010bc <sysbatch_flush>
+  80196f:	83 c4 10             	add    $0x10,%esp
+}
+  801972:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801975:	5b                   	pop    %ebx
+  801976:	5e                   	pop    %esi
+  801977:	5d                   	pop    %ebp
+  801978:	c3                   	ret
+
+00801979 <devfile_read>:
+{
+  801979:	55                   	push   %ebp
+  80197a:	89 e5                	mov    %esp,%ebp
+  80197c:	57                   	push   %edi
+  80197d:	56                   	push   %esi
+  80197e:	53                   	push   %ebx
+  80197f:	83 ec 3c             	sub    $0x3c,%esp
+  801982:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  801985:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  80198b:	77 57                	ja     8019e4 <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80198d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801990:	8b 40 0c             	mov    0xc(%eax),%eax
+  801993:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read.req_n = n;
+  801998:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  80199e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019a3:	b8 03 00 00 00       	mov    $0x3,%eax
+  8019a8:	e8 79 fe ff ff       	call   801826 <fsipc>
+  8019ad:	89 c6                	mov    %eax,%esi
+  8019af:	85 c0                	test   %eax,%eax
+  8019b1:	78 27                	js     8019da <devfile_read+0x61>
+  assert(r <= n);
+  8019b3:	39 c3                	cmp    %eax,%ebx
+  8019b5:	0f 82 0e 02 00 00    	jb     801bc9 <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  8019bb:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8019c0:	0f 8f 1c 02 00 00    	jg     801be2 <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8019c6:	83 ec 04             	sub    $0x4,%esp
+  8019c9:	50                   	push   %eax
+  8019ca:	68 00 60 80 00       	push   $0x806000
+  8019cf:	ff 75 0c             	push   0xc(%ebp)
+  8019d2:	e8 39 f0 ff ff       	call   800a10 <memmove>
+  return r;
+  8019d7:	83 c4 10             	add    $0x10,%esp
+}
+  8019da:	89 f0                	mov    %esi,%eax
+  8019dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8019df:	5b                   	pop    %ebx
+  8019e0:	5e                   	pop    %esi
+  8019e1:	5f                   	pop    %edi
+  8019e2:	5d                   	pop    %ebp
+  8019e3:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  8019e4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8019e9:	e8 0f ff ff ff       	call   8018fd <fsv_alloc>
+  8019ee:	89 c6                	mov    %eax,%esi
+  8019f0:	85 c0                	test   %eax,%eax
+  8019f2:	78 e6                	js     8019da <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  8019f4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019f7:	8b 40 0c             	mov    0xc(%eax),%eax
+  8019fa:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  8019ff:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a02:	8b 40 04             	mov    0x4(%eax),%eax
+  801a05:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  801a0a:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  801a10:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801a17:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801a1c:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801a21:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801a26:	e8 e2 fc ff ff       	call   80170d <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801a2b:	6a 00                	push   $0x0
+  801a2d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801a30:	50                   	push   %eax
+  801a31:	68 00 10 c0 9f       	push   $0x9fc01000
+  801a36:	6a 00                	push   $0x0
+  801a38:	e8 34 19 00 00       	call   803371 <ipc_recv_pages>
+  801a3d:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  801a3f:	83 c4 10             	add    $0x10,%esp
+  801a42:	85 c0                	test   %eax,%eax
+  801a44:	7e 94                	jle    8019da <devfile_read+0x61>
+  assert(r <= n);
+  801a46:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801a49:	39 c3                	cmp    %eax,%ebx
+  801a4b:	72 2e                	jb     801a7b <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801a4d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a50:	8b 40 04             	mov    0x4(%eax),%eax
+  801a53:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801a58:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  801a5b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801a5e:	c1 e2 0c             	shl    $0xc,%edx
+  801a61:	39 ca                	cmp    %ecx,%edx
+  801a63:	72 2f                	jb     801a94 <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  801a65:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  801a6a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  801a6d:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  801a71:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801a76:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  801a79:	eb 52                	jmp    801acd <devfile_read+0x154>
+  assert(r <= n);
+  801a7b:	68 d1 3b 80 00       	push   $0x803bd1
+  801a80:	68 d8 3b 80 00       	push   $0x803bd8
+  801a85:	68 49 01 00 00       	push   $0x149
+  801a8a:	68 c6 3b 80 00       	push   $0x803bc6
+  801a8f:	e8 2d e7 ff ff       	call   8001c1 <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801a94:	68 fc 3b 80 00       	push   $0x803bfc
+  801a99:	68 d8 3b 80 00       	push   $0x803bd8
+  801a9e:	68 4a 01 00 00       	push   $0x14a
+  801aa3:	68 c6 3b 80 00       	push   $0x803bc6
+  801aa8:	e8 14 e7 ff ff       	call   8001c1 <_panic>
+      memmove(dst + done, src + done, m);
+  801aad:	83 ec 04             	sub    $0x4,%esp
+  801ab0:	53                   	push   %ebx
+  801ab1:	56                   	push   %esi
+  801ab2:	89 f8                	mov    %edi,%eax
+  801ab4:	03 45 0c             	add    0xc(%ebp),%eax
+  801ab7:	50                   	push   %eax
+  801ab8:	e8 53 ef ff ff       	call   800a10 <memmove>
+  801abd:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  801ac0:	01 df                	add    %ebx,%edi
+  801ac2:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801ac5:	39 c7                	cmp    %eax,%edi
+  801ac7:	0f 83 c0 00 00 00    	jae    801b8d <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801acd:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801ad0:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  801ad3:	89 f0                	mov    %esi,%eax
+  801ad5:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801ada:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  801adf:	29 c3                	sub    %eax,%ebx
+  801ae1:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801ae4:	29 f8                	sub    %edi,%eax
+  801ae6:	39 c3                	cmp    %eax,%ebx
+  801ae8:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  801aeb:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801af1:	75 ba                	jne    801aad <devfile_read+0x134>
+  801af3:	89 f9                	mov    %edi,%ecx
+  801af5:	03 4d 0c             	add    0xc(%ebp),%ecx
+  801af8:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  801afb:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  801b01:	75 aa                	jne    801aad <devfile_read+0x134>
+  801b03:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  801b09:	77 a2                	ja     801aad <devfile_read+0x134>
+  801b0b:	89 c8                	mov    %ecx,%eax
+  801b0d:	c1 e8 16             	shr    $0x16,%eax
+  801b10:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801b17:	a8 01                	test   $0x1,%al
+  801b19:	74 92                	je     801aad <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  801b1b:	89 c8                	mov    %ecx,%eax
+  801b1d:	c1 e8 0c             	shr    $0xc,%eax
+  801b20:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  801b27:	a8 01                	test   $0x1,%al
+  801b29:	74 82                	je     801aad <devfile_read+0x134>
+  801b2b:	a9 02 08 00 00       	test   $0x802,%eax
+  801b30:	0f 84 77 ff ff ff    	je     801aad <devfile_read+0x134>
+  801b36:	f6 c4 04             	test   $0x4,%ah
+  801b39:	0f 85 6e ff ff ff    	jne    801aad <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  801b3f:	a1 64 5e 80 00       	mov    0x805e64,%eax
+  801b44:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  801b48:	84 c0                	test   %al,%al
+  801b4a:	75 17                	jne    801b63 <devfile_read+0x1ea>
+  801b4c:	83 ec 08             	sub    $0x8,%esp
+  801b4f:	6a 01                	push   $0x1
+  801b51:	6a 00                	push   $0x0
+  801b53:	e8 1e f1 ff ff       	call   800c76 <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  801b58:	83 c4 10             	add    $0x10,%esp
+  801b5b:	85 c0                	test   %eax,%eax
+  801b5d:	0f 85 4a ff ff ff    	jne    801aad <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  801b63:	83 ec 04             	sub    $0x4,%esp
+  801b66:	68 05 08 00 00       	push   $0x805
+  801b6b:	ff 75 cc             	push   -0x34(%ebp)
+  801b6e:	6a 00                	push   $0x0
+  801b70:	56                   	push   %esi
+  801b71:	6a 00                	push   $0x0
+  801b73:	6a 05                	push   $0x5
+  801b75:	68 40 50 80 00       	push   $0x805040
+  801b7a:	e8 8d f5 ff ff       	call   80110c <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  801b7f:	c1 e8 1f             	shr    $0x1f,%eax
+  801b82:	08 45 cb             	or     %al,-0x35(%ebp)
+  801b85:	83 c4 20             	add    $0x20,%esp
+  801b88:	e9 33 ff ff ff       	jmp    801ac0 <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  801b8d:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  801b90:	83 ec 0c             	sub    $0xc,%esp
+  801b93:	68 40 50 80 00       	push   $0x805040
+  801b98:	e8 1f f5 ff ff       	call   8010bc <sysbatch_flush>
+  801b9d:	83 c4 10             	add    $0x10,%esp
+  801ba0:	85 c0                	test   %eax,%eax
+  801ba2:	78 06                	js     801baa <devfile_read+0x231>
+  801ba4:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  801ba8:	74 14                	je     801bbe <devfile_read+0x245>
+    memmove(dst, src, r);
+  801baa:	83 ec 04             	sub    $0x4,%esp
+  801bad:	ff 75 d4             	push   -0x2c(%ebp)
+  801bb0:	ff 75 d0             	push   -0x30(%ebp)
+  801bb3:	ff 75 0c             	push   0xc(%ebp)
+  801bb6:	e8 55 ee ff ff       	call   800a10 <memmove>
+  801bbb:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  801bbe:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bc1:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  801bc4:	e9 11 fe ff ff       	jmp    8019da <devfile_read+0x61>
+  assert(r <= n);
+  801bc9:	68 d1 3b 80 00       	push   $0x803bd1
+  801bce:	68 d8 3b 80 00       	push   $0x803bd8
+  801bd3:	68 1c 01 00 00       	push   $0x11c
+  801bd8:	68 c6 3b 80 00       	push   $0x803bc6
+  801bdd:	e8 df e5 ff ff       	call   8001c1 <_panic>
+  assert(r <= PGSIZE);
+  801be2:	68 ed 3b 80 00       	push   $0x803bed
+  801be7:	68 d8 3b 80 00       	push   $0x803bd8
+  801bec:	68 1d 01 00 00       	push   $0x11d
+  801bf1:	68 c6 3b 80 00       	push   $0x803bc6
+  801bf6:	e8 c6 e5 ff ff       	call   8001c1 <_panic>
+
+00801bfb <devfile_write>:
+{
+  801bfb:	55                   	push   %ebp
+  801bfc:	89 e5                	mov    %esp,%ebp
+  801bfe:	57                   	push   %edi
+  801bff:	56                   	push   %esi
+  801c00:	53                   	push   %ebx
+  801c01:	83 ec 1c             	sub    $0x1c,%esp
+  801c04:	8b 75 08             	mov    0x8(%ebp),%esi
+  801c07:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  801c0a:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  801c0f:	77 39                	ja     801c4a <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801c11:	8b 56 0c             	mov    0xc(%esi),%edx
+  801c14:	89 15 00 60 80 00    	mov    %edx,0x806000
+  fsipcbuf.write.req_n = n;
+  801c1a:	a3 04 60 80 00       	mov    %eax,0x806004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  801c1f:	83 ec 04             	sub    $0x4,%esp
+  801c22:	50                   	push   %eax
+  801c23:	ff 75 0c             	push   0xc(%ebp)
+  801c26:	68 08 60 80 00       	push   $0x806008
+  801c2b:	e8 e0 ed ff ff       	call   800a10 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801c30:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c35:	b8 04 00 00 00       	mov    $0x4,%eax
+  801c3a:	e8 e7 fb ff ff       	call   801826 <fsipc>
+  801c3f:	83 c4 10             	add    $0x10,%esp
+}
+  801c42:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801c45:	5b                   	pop    %ebx
+  801c46:	5e                   	pop    %esi
+  801c47:	5f                   	pop    %edi
+  801c48:	5d                   	pop    %ebp
+  801c49:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  801c4a:	ba 00 00 10 00       	mov    $0x100000,%edx
+  801c4f:	39 d0                	cmp    %edx,%eax
+  801c51:	89 d3                	mov    %edx,%ebx
+  801c53:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  801c56:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  801c5c:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  801c5f:	83 c7 01             	add    $0x1,%edi
+  801c62:	89 f8                	mov    %edi,%eax
+  801c64:	e8 94 fc ff ff       	call   8018fd <fsv_alloc>
+  801c69:	85 c0                	test   %eax,%eax
+  801c6b:	78 d5                	js     801c42 <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  801c6d:	83 ec 04             	sub    $0x4,%esp
+  801c70:	53                   	push   %ebx
+  801c71:	ff 75 0c             	push   0xc(%ebp)
+  801c74:	68 00 10 c0 9f       	push   $0x9fc01000
+  801c79:	e8 92 ed ff ff       	call   800a10 <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  801c7e:	8b 46 0c             	mov    0xc(%esi),%eax
+  801c81:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  801c86:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  801c8c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801c93:	89 f9                	mov    %edi,%ecx
+  801c95:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801c9a:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801c9f:	e8 69 fa ff ff       	call   80170d <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801ca4:	6a 00                	push   $0x0
+  801ca6:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801ca9:	50                   	push   %eax
+  801caa:	6a 00                	push   $0x0
+  801cac:	6a 00                	push   $0x0
+  801cae:	e8 be 16 00 00       	call   803371 <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  801cb3:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  801cb6:	eb 8a                	jmp    801c42 <devfile_write+0x47>
+
+00801cb8 <open>:
+{
+  801cb8:	55                   	push   %ebp
+  801cb9:	89 e5                	mov    %esp,%ebp
+  801cbb:	56                   	push   %esi
+  801cbc:	53                   	push   %ebx
+  801cbd:	83 ec 1c             	sub    $0x1c,%esp
+  801cc0:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801cc3:	56                   	push   %esi
+  801cc4:	e8 86 eb ff ff       	call   80084f <strlen>
+  801cc9:	83 c4 10             	add    $0x10,%esp
+  801ccc:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801cd1:	7f 6c                	jg     801d3f <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  801cd3:	83 ec 0c             	sub    $0xc,%esp
+  801cd6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cd9:	50                   	push   %eax
+  801cda:	e8 ad f4 ff ff       	call   80118c <fd_alloc>
+  801cdf:	89 c3                	mov    %eax,%ebx
+  801ce1:	83 c4 10             	add    $0x10,%esp
+  801ce4:	85 c0                	test   %eax,%eax
+  801ce6:	78 3c                	js     801d24 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801ce8:	83 ec 08             	sub    $0x8,%esp
+  801ceb:	56                   	push   %esi
+  801cec:	68 00 60 80 00       	push   $0x806000
+  801cf1:	e8 94 eb ff ff       	call   80088a <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801cf6:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801cf9:	a3 00 64 80 00       	mov    %eax,0x806400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801cfe:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801d01:	b8 01 00 00 00       	mov    $0x1,%eax
+  801d06:	e8 1b fb ff ff       	call   801826 <fsipc>
+  801d0b:	89 c3                	mov    %eax,%ebx
+  801d0d:	83 c4 10             	add    $0x10,%esp
+  801d10:	85 c0                	test   %eax,%eax
+  801d12:	78 19                	js     801d2d <open+0x75>
+  return fd2num(fd);
+  801d14:	83 ec 0c             	sub    $0xc,%esp
+  801d17:	ff 75 f4             	push   -0xc(%ebp)
+  801d1a:	e8 49 f4 ff ff       	call   801168 <fd2num>
+  801d1f:	89 c3                	mov    %eax,%ebx
+  801d21:	83 c4 10             	add    $0x10,%esp
+}
+  801d24:	89 d8                	mov    %ebx,%eax
+  801d26:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d29:	5b                   	pop    %ebx
+  801d2a:	5e                   	pop    %esi
+  801d2b:	5d                   	pop    %ebp
+  801d2c:	c3                   	ret
+    fd_close(fd, 0);
+  801d2d:	83 ec 08             	sub    $0x8,%esp
+  801d30:	6a 00                	push   $0x0
+  801d32:	ff 75 f4             	push   -0xc(%ebp)
+  801d35:	e8 44 f5 ff ff       	call   80127e <fd_close>
+    return r;
+  801d3a:	83 c4 10             	add    $0x10,%esp
+  801d3d:	eb e5                	jmp    801d24 <open+0x6c>
+    return -E_BAD_PATH;
+  801d3f:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801d44:	eb de                	jmp    801d24 <open+0x6c>
+
+00801d46 <open_read>:
+{
+  801d46:	55                   	push   %ebp
+  801d47:	89 e5                	mov    %esp,%ebp
+  801d49:	57                   	push   %edi
+  801d4a:	56                   	push   %esi
+  801d4b:	53                   	push   %ebx
+  801d4c:	83 ec 28             	sub    $0x28,%esp
+  801d4f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  801d52:	57                   	push   %edi
+  801d53:	e8 f7 ea ff ff       	call   80084f <strlen>
+  801d58:	83 c4 10             	add    $0x10,%esp
+  801d5b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801d60:	0f 87 f6 00 00 00    	ja     801e5c <open_read+0x116>
+  801d66:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  801d68:	83 ec 0c             	sub    $0xc,%esp
+  801d6b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801d6e:	50                   	push   %eax
+  801d6f:	e8 18 f4 ff ff       	call   80118c <fd_alloc>
+  801d74:	89 c3                	mov    %eax,%ebx
+  801d76:	83 c4 10             	add    $0x10,%esp
+  801d79:	85 c0                	test   %eax,%eax
+  801d7b:	0f 88 b2 00 00 00    	js     801e33 <open_read+0xed>
+  strcpy(req->req_buf, path);
+  801d81:	83 ec 08             	sub    $0x8,%esp
+  801d84:	57                   	push   %edi
+  801d85:	68 e4 60 80 00       	push   $0x8060e4
+  801d8a:	e8 fb ea ff ff       	call   80088a <strcpy>
+  req->req_nops = 2;
+  801d8f:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  801d96:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  801d99:	c7 05 04 60 80 00 01 	movl   $0x1,0x806004
+  801da0:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  801da3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801da6:	a3 10 60 80 00       	mov    %eax,0x806010
+  req->req_ops[0].op_buf = 0;
+  801dab:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  801db2:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  801db5:	c7 05 20 60 80 00 04 	movl   $0x4,0x806020
+  801dbc:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  801dbf:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  801dc6:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  801dc9:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  801dce:	29 f0                	sub    %esi,%eax
+  801dd0:	3b 45 14             	cmp    0x14(%ebp),%eax
+  801dd3:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  801dd7:	a3 2c 60 80 00       	mov    %eax,0x80602c
+  req->req_ops[1].op_offset = 0;
+  801ddc:	c7 05 30 60 80 00 00 	movl   $0x0,0x806030
+  801de3:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  801de6:	83 c6 01             	add    $0x1,%esi
+  801de9:	89 35 34 60 80 00    	mov    %esi,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  801def:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801df2:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801df7:	e8 2a fa ff ff       	call   801826 <fsipc>
+  801dfc:	89 c3                	mov    %eax,%ebx
+  801dfe:	83 c4 10             	add    $0x10,%esp
+  801e01:	83 f8 01             	cmp    $0x1,%eax
+  801e04:	7e 37                	jle    801e3d <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  801e06:	a1 38 60 80 00       	mov    0x806038,%eax
+  801e0b:	8b 55 18             	mov    0x18(%ebp),%edx
+  801e0e:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  801e10:	83 ec 04             	sub    $0x4,%esp
+  801e13:	50                   	push   %eax
+  801e14:	81 c6 e4 60 80 00    	add    $0x8060e4,%esi
+  801e1a:	56                   	push   %esi
+  801e1b:	ff 75 10             	push   0x10(%ebp)
+  801e1e:	e8 ed eb ff ff       	call   800a10 <memmove>
+  return fd2num(fd);
+  801e23:	83 c4 04             	add    $0x4,%esp
+  801e26:	ff 75 e4             	push   -0x1c(%ebp)
+  801e29:	e8 3a f3 ff ff       	call   801168 <fd2num>
+  801e2e:	89 c3                	mov    %eax,%ebx
+  801e30:	83 c4 10             	add    $0x10,%esp
+}
+  801e33:	89 d8                	mov    %ebx,%eax
+  801e35:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e38:	5b                   	pop    %ebx
+  801e39:	5e                   	pop    %esi
+  801e3a:	5f                   	pop    %edi
+  801e3b:	5d                   	pop    %ebp
+  801e3c:	c3                   	ret
+    fd_close(fd, 0);
+  801e3d:	83 ec 08             	sub    $0x8,%esp
+  801e40:	6a 00                	push   $0x0
+  801e42:	ff 75 e4             	push   -0x1c(%ebp)
+  801e45:	e8 34 f4 ff ff       	call   80127e <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  801e4a:	83 c4 10             	add    $0x10,%esp
+  801e4d:	85 db                	test   %ebx,%ebx
+  801e4f:	78 e2                	js     801e33 <open_read+0xed>
+  801e51:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  801e54:	8b 9b 1c 60 80 00    	mov    0x80601c(%ebx),%ebx
+  801e5a:	eb d7                	jmp    801e33 <open_read+0xed>
+    return -E_BAD_PATH;
+  801e5c:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801e61:	eb d0                	jmp    801e33 <open_read+0xed>
+
+00801e63 <file_stat>:
+{
+  801e63:	55                   	push   %ebp
+  801e64:	89 e5                	mov    %esp,%ebp
+  801e66:	57                   	push   %edi
+  801e67:	56                   	push   %esi
+  801e68:	53                   	push   %ebx
+  801e69:	83 ec 18             	sub    $0x18,%esp
+  801e6c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801e6f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801e72:	57                   	push   %edi
+  801e73:	e8 d7 e9 ff ff       	call   80084f <strlen>
+  801e78:	83 c4 10             	add    $0x10,%esp
+  801e7b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801e80:	0f 8f c7 00 00 00    	jg     801f4d <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  801e86:	83 ec 0c             	sub    $0xc,%esp
+  801e89:	57                   	push   %edi
+  801e8a:	e8 c0 e9 ff ff       	call   80084f <strlen>
+  801e8f:	8d 58 04             	lea    0x4(%eax),%ebx
+  801e92:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  801e95:	83 c4 08             	add    $0x8,%esp
+  801e98:	57                   	push   %edi
+  801e99:	68 e4 60 80 00       	push   $0x8060e4
+  801e9e:	e8 e7 e9 ff ff       	call   80088a <strcpy>
+  req->req_nops = 2;
+  801ea3:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  801eaa:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  801ead:	c7 05 04 60 80 00 02 	movl   $0x2,0x806004
+  801eb4:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  801eb7:	c7 05 10 60 80 00 00 	movl   $0x0,0x806010
+  801ebe:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  801ec1:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  801ec8:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  801ecb:	c7 05 20 60 80 00 03 	movl   $0x3,0x806020
+  801ed2:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  801ed5:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  801edc:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  801edf:	89 1d 34 60 80 00    	mov    %ebx,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  801ee5:	ba 00 00 00 00       	mov    $0x0,%edx
+  801eea:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801eef:	e8 32 f9 ff ff       	call   801826 <fsipc>
+  801ef4:	83 c4 10             	add    $0x10,%esp
+  801ef7:	83 f8 01             	cmp    $0x1,%eax
+  801efa:	7e 42                	jle    801f3e <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  801efc:	81 c3 e4 60 80 00    	add    $0x8060e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  801f02:	83 ec 08             	sub    $0x8,%esp
+  801f05:	53                   	push   %ebx
+  801f06:	56                   	push   %esi
+  801f07:	e8 7e e9 ff ff       	call   80088a <strcpy>
+  st->st_size = ret->ret_size;
+  801f0c:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  801f12:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  801f18:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  801f1e:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  801f24:	c7 86 88 00 00 00 04 	movl   $0x804004,0x88(%esi)
+  801f2b:	40 80 00 
+  return 0;
+  801f2e:	83 c4 10             	add    $0x10,%esp
+  801f31:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f36:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f39:	5b                   	pop    %ebx
+  801f3a:	5e                   	pop    %esi
+  801f3b:	5f                   	pop    %edi
+  801f3c:	5d                   	pop    %ebp
+  801f3d:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  801f3e:	85 c0                	test   %eax,%eax
+  801f40:	78 f4                	js     801f36 <file_stat+0xd3>
+  801f42:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801f45:	8b 80 1c 60 80 00    	mov    0x80601c(%eax),%eax
+  801f4b:	eb e9                	jmp    801f36 <file_stat+0xd3>
+    return -E_BAD_PATH;
+  801f4d:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801f52:	eb e2                	jmp    801f36 <file_stat+0xd3>
+
+00801f54 <read_map>:
+{
+  801f54:	55                   	push   %ebp
+  801f55:	89 e5                	mov    %esp,%ebp
+  801f57:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801f5a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801f5d:	50                   	push   %eax
+  801f5e:	ff 75 08             	push   0x8(%ebp)
+  801f61:	e8 7c f2 ff ff       	call   8011e2 <fd_lookup>
+  801f66:	83 c4 10             	add    $0x10,%esp
+  801f69:	85 c0                	test   %eax,%eax
+  801f6b:	78 2a                	js     801f97 <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  801f6d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801f70:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  801f76:	39 08                	cmp    %ecx,(%eax)
+  801f78:	75 1f                	jne    801f99 <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  801f7a:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f7d:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read_map.req_offset = offset;
+  801f82:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f85:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  801f8a:	8b 55 10             	mov    0x10(%ebp),%edx
+  801f8d:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801f92:	e8 8f f8 ff ff       	call   801826 <fsipc>
+}
+  801f97:	c9                   	leave
+  801f98:	c3                   	ret
+    return -E_INVAL;
+  801f99:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f9e:	eb f7                	jmp    801f97 <read_map+0x43>
+
+00801fa0 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801fa0:	55                   	push   %ebp
+  801fa1:	89 e5                	mov    %esp,%ebp
+  801fa3:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  801fa6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fab:	b8 08 00 00 00       	mov    $0x8,%eax
+  801fb0:	e8 71 f8 ff ff       	call   801826 <fsipc>
+}
+  801fb5:	c9                   	leave
+  801fb6:	c3                   	ret
+
+00801fb7 <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  801fb7:	55                   	push   %ebp
+  801fb8:	89 e5                	mov    %esp,%ebp
+  801fba:	57                   	push   %edi
+  801fbb:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  801fbc:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fbf:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.stats.req_bio_sched = 0;
+  801fc4:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  801fcb:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  801fce:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  801fd5:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  801fd8:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fdd:	b8 09 00 00 00       	mov    $0x9,%eax
+  801fe2:	e8 3f f8 ff ff       	call   801826 <fsipc>
+  801fe7:	85 c0                	test   %eax,%eax
+  801fe9:	78 14                	js     801fff <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  801feb:	be 00 60 80 00       	mov    $0x806000,%esi
+  801ff0:	b9 16 00 00 00       	mov    $0x16,%ecx
+  801ff5:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801ff8:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  801ffa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801fff:	5e                   	pop    %esi
+  802000:	5f                   	pop    %edi
+  802001:	5d                   	pop    %ebp
+  802002:	c3                   	ret
+
+00802003 <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  802003:	55                   	push   %ebp
+  802004:	89 e5                	mov    %esp,%ebp
+  802006:	53                   	push   %ebx
+  802007:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  80200a:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  80200d:	50                   	push   %eax
+  80200e:	6a 00                	push   $0x0
+  802010:	e8 a2 ff ff ff       	call   801fb7 <fs_stats>
+  802015:	83 c4 10             	add    $0x10,%esp
+  802018:	85 c0                	test   %eax,%eax
+  80201a:	78 28                	js     802044 <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  80201c:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  80201f:	83 ec 08             	sub    $0x8,%esp
+  802022:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802025:	50                   	push   %eax
+  802026:	6a 20                	push   $0x20
+  802028:	e8 8a ff ff ff       	call   801fb7 <fs_stats>
+  80202d:	83 c4 10             	add    $0x10,%esp
+  802030:	85 c0                	test   %eax,%eax
+  802032:	78 10                	js     802044 <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  802034:	83 ec 08             	sub    $0x8,%esp
+  802037:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  80203a:	50                   	push   %eax
+  80203b:	53                   	push   %ebx
+  80203c:	e8 76 ff ff ff       	call   801fb7 <fs_stats>
+  802041:	83 c4 10             	add    $0x10,%esp
+}
+  802044:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802047:	c9                   	leave
+  802048:	c3                   	ret
+
+00802049 <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  802049:	55                   	push   %ebp
+  80204a:	89 e5                	mov    %esp,%ebp
+  80204c:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  80204f:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  802056:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  802059:	8b 45 08             	mov    0x8(%ebp),%eax
+  80205c:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.stats.req_dcache = 0;
+  802061:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  802068:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  80206b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802070:	b8 09 00 00 00       	mov    $0x9,%eax
+  802075:	e8 ac f7 ff ff       	call   801826 <fsipc>
+}
+  80207a:	c9                   	leave
+  80207b:	c3                   	ret
+
+0080207c <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  80207c:	55                   	push   %ebp
+  80207d:	89 e5                	mov    %esp,%ebp
+  80207f:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  802082:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  802089:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  80208c:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  802093:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  802096:	8b 45 08             	mov    0x8(%ebp),%eax
+  802099:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_STATS, NULL);
+  80209e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020a3:	b8 09 00 00 00       	mov    $0x9,%eax
+  8020a8:	e8 79 f7 ff ff       	call   801826 <fsipc>
+}
+  8020ad:	c9                   	leave
+  8020ae:	c3                   	ret
+
+008020af <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  8020af:	55                   	push   %ebp
+  8020b0:	89 e5                	mov    %esp,%ebp
+  8020b2:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8020b5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020b8:	50                   	push   %eax
+  8020b9:	ff 75 08             	push   0x8(%ebp)
+  8020bc:	e8 21 f1 ff ff       	call   8011e2 <fd_lookup>
+  8020c1:	83 c4 10             	add    $0x10,%esp
+  8020c4:	85 c0                	test   %eax,%eax
+  8020c6:	78 34                	js     8020fc <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  8020c8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8020cb:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  8020d1:	39 08                	cmp    %ecx,(%eax)
+  8020d3:	75 29                	jne    8020fe <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  8020d5:	8b 40 0c             	mov    0xc(%eax),%eax
+  8020d8:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.fallocate.req_offset = offset;
+  8020dd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020e0:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.fallocate.req_len = len;
+  8020e5:	8b 45 10             	mov    0x10(%ebp),%eax
+  8020e8:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  8020ed:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020f2:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8020f7:	e8 2a f7 ff ff       	call   801826 <fsipc>
+}
+  8020fc:	c9                   	leave
+  8020fd:	c3                   	ret
+    return -E_INVAL;
+  8020fe:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802103:	eb f7                	jmp    8020fc <fallocate+0x4d>
+
+00802105 <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  802105:	55                   	push   %ebp
+  802106:	89 e5                	mov    %esp,%ebp
+  802108:	57                   	push   %edi
+  802109:	56                   	push   %esi
+  80210a:	53                   	push   %ebx
+  80210b:	83 ec 24             	sub    $0x24,%esp
+  80210e:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802111:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802114:	50                   	push   %eax
+  802115:	ff 75 08             	push   0x8(%ebp)
+  802118:	e8 c5 f0 ff ff       	call   8011e2 <fd_lookup>
+  80211d:	83 c4 10             	add    $0x10,%esp
+  802120:	85 c0                	test   %eax,%eax
+  802122:	78 66                	js     80218a <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  802124:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802127:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  80212d:	39 08                	cmp    %ecx,(%eax)
+  80212f:	75 61                	jne    802192 <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  802131:	85 f6                	test   %esi,%esi
+  802133:	7e 50                	jle    802185 <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  802135:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  80213a:	39 de                	cmp    %ebx,%esi
+  80213c:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  80213f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802142:	8b 40 0c             	mov    0xc(%eax),%eax
+  802145:	a3 00 60 80 00       	mov    %eax,0x806000
+    fsipcbuf.prefetch.req_n = m;
+  80214a:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  802150:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  802157:	83 ec 04             	sub    $0x4,%esp
+  80215a:	57                   	push   %edi
+  80215b:	ff 75 0c             	push   0xc(%ebp)
+  80215e:	68 08 60 80 00       	push   $0x806008
+  802163:	e8 a8 e8 ff ff       	call   800a10 <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  802168:	ba 00 00 00 00       	mov    $0x0,%edx
+  80216d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802172:	e8 af f6 ff ff       	call   801826 <fsipc>
+  802177:	83 c4 10             	add    $0x10,%esp
+  80217a:	85 c0                	test   %eax,%eax
+  80217c:	78 0c                	js     80218a <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  80217e:	01 7d 0c             	add    %edi,0xc(%ebp)
+  802181:	29 de                	sub    %ebx,%esi
+  802183:	eb ac                	jmp    802131 <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  802185:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80218a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80218d:	5b                   	pop    %ebx
+  80218e:	5e                   	pop    %esi
+  80218f:	5f                   	pop    %edi
+  802190:	5d                   	pop    %ebp
+  802191:	c3                   	ret
+    return -E_INVAL;
+  802192:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802197:	eb f1                	jmp    80218a <prefetch+0x85>
+
+00802199 <spawn>:
+// argv: pointer to null-terminated array of pointers to strings,
+//   which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv)
+{
+  802199:	55                   	push   %ebp
+  80219a:	89 e5                	mov    %esp,%ebp
+  80219c:	57                   	push   %edi
+  80219d:	56                   	push   %esi
+  80219e:	53                   	push   %ebx
+  80219f:	81 ec a8 02 00 00    	sub    $0x2a8,%esp
+  //     correct initial eip and esp values in the child.
+  //
+  //   - Start the child process running with sys_env_set_status().
+
+  // Open the program and read its ELF header in one round trip.
+  if ((r = open_read(prog, O_RDONLY, elf_buf, sizeof(elf_buf), &n)) < 0)
+  8021a5:	8d 85 a0 fd ff ff    	lea    -0x260(%ebp),%eax
+  8021ab:	50                   	push   %eax
+  8021ac:	68 00 02 00 00       	push   $0x200
+  8021b1:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  8021b7:	50                   	push   %eax
+  8021b8:	6a 00                	push   $0x0
+  8021ba:	ff 75 08             	push   0x8(%ebp)
+  8021bd:	e8 84 fb ff ff       	call   801d46 <open_read>
+  8021c2:	89 85 88 fd ff ff    	mov    %eax,-0x278(%ebp)
+  8021c8:	83 c4 20             	add    $0x20,%esp
+  8021cb:	85 c0                	test   %eax,%eax
+  8021cd:	0f 88 66 06 00 00    	js     802839 <spawn+0x6a0>
+    return r;
+  fd = r;
+
+  elf = (struct Elf*)elf_buf;
+  if (n != sizeof(elf_buf) || elf->e_magic != ELF_MAGIC) {
+  8021d3:	81 bd a0 fd ff ff 00 	cmpl   $0x200,-0x260(%ebp)
+  8021da:	02 00 00 
+  8021dd:	0f 85 92 00 00 00    	jne    802275 <spawn+0xdc>
+  8021e3:	81 bd e8 fd ff ff 7f 	cmpl   $0x464c457f,-0x218(%ebp)
+  8021ea:	45 4c 46 
+  8021ed:	0f 85 82 00 00 00    	jne    802275 <spawn+0xdc>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+  envid_t ret;
+  __asm __volatile("int %2"
+  8021f3:	b8 07 00 00 00       	mov    $0x7,%eax
+  8021f8:	cd 30                	int    $0x30
+  8021fa:	89 85 90 fd ff ff    	mov    %eax,-0x270(%ebp)
+  802200:	89 c6                	mov    %eax,%esi
+  802202:	89 85 6c fd ff ff    	mov    %eax,-0x294(%ebp)
+    cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+    return -E_NOT_EXEC;
+  }
+
+  // Create new child environment
+  if ((r = sys_exofork()) < 0)
+  802208:	85 c0                	test   %eax,%eax
+  80220a:	0f 88 35 06 00 00    	js     802845 <spawn+0x6ac>
+    return r;
+  child = r;
+  sysbatch_init(&batch);
+  802210:	83 ec 0c             	sub    $0xc,%esp
+  802213:	68 60 57 80 00       	push   $0x805760
+  802218:	e8 91 ee ff ff       	call   8010ae <sysbatch_init>
+
+  // Set up trap frame, including initial stack.
+  child_tf = envs[ENVX(child)].env_tf;
+  80221d:	89 f0                	mov    %esi,%eax
+  80221f:	25 ff 03 00 00       	and    $0x3ff,%eax
+  802224:	8d 34 c0             	lea    (%eax,%eax,8),%esi
+  802227:	c1 e6 04             	shl    $0x4,%esi
+  80222a:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  802230:	8d bd a4 fd ff ff    	lea    -0x25c(%ebp),%edi
+  802236:	b9 11 00 00 00       	mov    $0x11,%ecx
+  80223b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  child_tf.tf_eip = elf->e_entry;
+  80223d:	8b 85 00 fe ff ff    	mov    -0x200(%ebp),%eax
+  802243:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  uintptr_t *argv_store;
+
+  // Count the number of arguments (argc)
+  // and the total amount of space needed for strings (string_size).
+  string_size = 0;
+  for (argc = 0; argv[argc] != 0; argc++)
+  802249:	83 c4 10             	add    $0x10,%esp
+  80224c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  string_size = 0;
+  802251:	be 00 00 00 00       	mov    $0x0,%esi
+  802256:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  for (argc = 0; argv[argc] != 0; argc++)
+  802259:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+  80225c:	85 c0                	test   %eax,%eax
+  80225e:	74 4d                	je     8022ad <spawn+0x114>
+    string_size += strlen(argv[argc]) + 1;
+  802260:	83 ec 0c             	sub    $0xc,%esp
+  802263:	50                   	push   %eax
+  802264:	e8 e6 e5 ff ff       	call   80084f <strlen>
+  802269:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+  for (argc = 0; argv[argc] != 0; argc++)
+  80226d:	83 c3 01             	add    $0x1,%ebx
+  802270:	83 c4 10             	add    $0x10,%esp
+  802273:	eb e4                	jmp    802259 <spawn+0xc0>
+    close(fd);
+  802275:	83 ec 0c             	sub    $0xc,%esp
+  802278:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  80227e:	e8 82 f0 ff ff       	call   801305 <close>
+    cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  802283:	83 c4 0c             	add    $0xc,%esp
+  802286:	68 7f 45 4c 46       	push   $0x464c457f
+  80228b:	ff b5 e8 fd ff ff    	push   -0x218(%ebp)
+  802291:	68 28 3c 80 00       	push   $0x803c28
+  802296:	e8 01 e0 ff ff       	call   80029c <cprintf>
+    return -E_NOT_EXEC;
+  80229b:	83 c4 10             	add    $0x10,%esp
+  80229e:	c7 85 6c fd ff ff f2 	movl   $0xfffffff2,-0x294(%ebp)
+  8022a5:	ff ff ff 
+  8022a8:	e9 98 05 00 00       	jmp    802845 <spawn+0x6ac>
+  // Determine where to place the strings and the argv array.
+  // Set up pointers into the temporary page 'UTEMP'; we'll map a page
+  // there later, then remap that page into the child environment
+  // at (USTACKTOP - PGSIZE).
+  // strings is the topmost thing on the stack.
+  string_store = (char*)UTEMP + PGSIZE - string_size;
+  8022ad:	89 9d 84 fd ff ff    	mov    %ebx,-0x27c(%ebp)
+  8022b3:	bf 00 10 40 00       	mov    $0x401000,%edi
+  8022b8:	29 f7                	sub    %esi,%edi
+  // argv is below that.  There's one argument pointer per argument, plus
+  // a null pointer.
+  argv_store = (uintptr_t*)(ROUNDDOWN(string_store, 4) - 4 * (argc + 1));
+  8022ba:	89 fa                	mov    %edi,%edx
+  8022bc:	83 e2 fc             	and    $0xfffffffc,%edx
+  8022bf:	8d 04 9d 04 00 00 00 	lea    0x4(,%ebx,4),%eax
+  8022c6:	29 c2                	sub    %eax,%edx
+  8022c8:	89 95 94 fd ff ff    	mov    %edx,-0x26c(%ebp)
+
+  // Make sure that argv, strings, and the 2 words that hold 'argc'
+  // and 'argv' themselves will all fit in a single stack page.
+  if ((void*)(argv_store - 2) < (void*)UTEMP)
+  8022ce:	8d 42 f8             	lea    -0x8(%edx),%eax
+  8022d1:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  8022d6:	0f 86 a8 05 00 00    	jbe    802884 <spawn+0x6eb>
+    return -E_NO_MEM;
+
+  // Allocate the single stack page at UTEMP.
+  if ((r = sys_page_alloc(0, (void*)UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  8022dc:	83 ec 04             	sub    $0x4,%esp
+  8022df:	6a 07                	push   $0x7
+  8022e1:	68 00 00 40 00       	push   $0x400000
+  8022e6:	6a 00                	push   $0x0
+  8022e8:	e8 cc e9 ff ff       	call   800cb9 <sys_page_alloc>
+  8022ed:	83 c4 10             	add    $0x10,%esp
+  8022f0:	85 c0                	test   %eax,%eax
+  8022f2:	0f 88 91 05 00 00    	js     802889 <spawn+0x6f0>
+  //	  (Again, argv should use an address valid in the child's
+  //	  environment.)
+  //
+  //	* Set *init_esp to the initial stack pointer for the child,
+  //	  (Again, use an address valid in the child's environment.)
+  for (i = 0; i < argc; i++) {
+  8022f8:	be 00 00 00 00       	mov    $0x0,%esi
+  8022fd:	89 9d 8c fd ff ff    	mov    %ebx,-0x274(%ebp)
+  802303:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  802306:	eb 30                	jmp    802338 <spawn+0x19f>
+    argv_store[i] = UTEMP2USTACK(string_store);
+  802308:	8d 87 00 d0 7f ee    	lea    -0x11803000(%edi),%eax
+  80230e:	8b 8d 94 fd ff ff    	mov    -0x26c(%ebp),%ecx
+  802314:	89 04 b1             	mov    %eax,(%ecx,%esi,4)
+    strcpy(string_store, argv[i]);
+  802317:	83 ec 08             	sub    $0x8,%esp
+  80231a:	ff 34 b3             	push   (%ebx,%esi,4)
+  80231d:	57                   	push   %edi
+  80231e:	e8 67 e5 ff ff       	call   80088a <strcpy>
+    string_store += strlen(argv[i]) + 1;
+  802323:	83 c4 04             	add    $0x4,%esp
+  802326:	ff 34 b3             	push   (%ebx,%esi,4)
+  802329:	e8 21 e5 ff ff       	call   80084f <strlen>
+  80232e:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+  for (i = 0; i < argc; i++) {
+  802332:	83 c6 01             	add    $0x1,%esi
+  802335:	83 c4 10             	add    $0x10,%esp
+  802338:	39 b5 8c fd ff ff    	cmp    %esi,-0x274(%ebp)
+  80233e:	7f c8                	jg     802308 <spawn+0x16f>
+  }
+  argv_store[argc] = 0;
+  802340:	8b 85 94 fd ff ff    	mov    -0x26c(%ebp),%eax
+  802346:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  80234c:	c7 04 88 00 00 00 00 	movl   $0x0,(%eax,%ecx,4)
+  assert(string_store == (char*)UTEMP + PGSIZE);
+  802353:	81 ff 00 10 40 00    	cmp    $0x401000,%edi
+  802359:	0f 85 97 00 00 00    	jne    8023f6 <spawn+0x25d>
+
+  argv_store[-1] = UTEMP2USTACK(argv_store);
+  80235f:	8b 8d 94 fd ff ff    	mov    -0x26c(%ebp),%ecx
+  802365:	8d 81 00 d0 7f ee    	lea    -0x11803000(%ecx),%eax
+  80236b:	89 41 fc             	mov    %eax,-0x4(%ecx)
+  argv_store[-2] = argc;
+  80236e:	89 c8                	mov    %ecx,%eax
+  802370:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  802376:	89 48 f8             	mov    %ecx,-0x8(%eax)
+
+  *init_esp = UTEMP2USTACK(&argv_store[-2]);
+  802379:	2d 08 30 80 11       	sub    $0x11803008,%eax
+  80237e:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+
+  // After completing the stack, map it into the child's address space
+  // and unmap it from ours!  Both calls ride along with the first batch
+  // of segment mappings.
+  if ((r = sysbatch_add(&batch, SYS_page_map, 0, (uint32_t) UTEMP, child,
+  802384:	83 ec 04             	sub    $0x4,%esp
+  802387:	6a 07                	push   $0x7
+  802389:	68 00 d0 bf ee       	push   $0xeebfd000
+  80238e:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  802394:	68 00 00 40 00       	push   $0x400000
+  802399:	6a 00                	push   $0x0
+  80239b:	6a 05                	push   $0x5
+  80239d:	68 60 57 80 00       	push   $0x805760
+  8023a2:	e8 65 ed ff ff       	call   80110c <sysbatch_add>
+  8023a7:	89 c3                	mov    %eax,%ebx
+  8023a9:	83 c4 20             	add    $0x20,%esp
+  8023ac:	85 c0                	test   %eax,%eax
+  8023ae:	0f 88 dd 04 00 00    	js     802891 <spawn+0x6f8>
+                        USTACKTOP - PGSIZE, PTE_P | PTE_U | PTE_W)) < 0)
+    goto error;
+  if ((r = sysbatch_add(&batch, SYS_page_unmap, 0, (uint32_t) UTEMP,
+  8023b4:	83 ec 04             	sub    $0x4,%esp
+  8023b7:	6a 00                	push   $0x0
+  8023b9:	6a 00                	push   $0x0
+  8023bb:	6a 00                	push   $0x0
+  8023bd:	68 00 00 40 00       	push   $0x400000
+  8023c2:	6a 00                	push   $0x0
+  8023c4:	6a 06                	push   $0x6
+  8023c6:	68 60 57 80 00       	push   $0x805760
+  8023cb:	e8 3c ed ff ff       	call   80110c <sysbatch_add>
+  8023d0:	89 c3                	mov    %eax,%ebx
+  8023d2:	83 c4 20             	add    $0x20,%esp
+  8023d5:	85 c0                	test   %eax,%eax
+  8023d7:	0f 88 b4 04 00 00    	js     802891 <spawn+0x6f8>
+  ph = (struct Proghdr*)(elf_buf + elf->e_phoff);
+  8023dd:	8b 85 04 fe ff ff    	mov    -0x1fc(%ebp),%eax
+  8023e3:	8d bc 05 e8 fd ff ff 	lea    -0x218(%ebp,%eax,1),%edi
+  for (i = 0; i < elf->e_phnum; i++, ph++) {
+  8023ea:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023ef:	89 d6                	mov    %edx,%esi
+  8023f1:	e9 dd 01 00 00       	jmp    8025d3 <spawn+0x43a>
+  assert(string_store == (char*)UTEMP + PGSIZE);
+  8023f6:	68 a0 3c 80 00       	push   $0x803ca0
+  8023fb:	68 d8 3b 80 00       	push   $0x803bd8
+  802400:	68 01 01 00 00       	push   $0x101
+  802405:	68 42 3c 80 00       	push   $0x803c42
+  80240a:	e8 b2 dd ff ff       	call   8001c1 <_panic>
+
+  for (i = 0; i < memsz; i += n * PGSIZE) {
+    if (i >= filesz) {
+      // allocate a blank page
+      n = 1;
+      if ((r = sysbatch_add(&batch, SYS_page_alloc, child, va + i,
+  80240f:	83 ec 04             	sub    $0x4,%esp
+  802412:	6a 00                	push   $0x0
+  802414:	6a 00                	push   $0x0
+  802416:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  80241c:	8b 85 78 fd ff ff    	mov    -0x288(%ebp),%eax
+  802422:	8b 8d 70 fd ff ff    	mov    -0x290(%ebp),%ecx
+  802428:	01 c8                	add    %ecx,%eax
+  80242a:	50                   	push   %eax
+  80242b:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  802431:	6a 04                	push   $0x4
+  802433:	68 60 57 80 00       	push   $0x805760
+  802438:	e8 cf ec ff ff       	call   80110c <sysbatch_add>
+  80243d:	83 c4 20             	add    $0x20,%esp
+  802440:	85 c0                	test   %eax,%eax
+  802442:	0f 88 0b 04 00 00    	js     802853 <spawn+0x6ba>
+      n = 1;
+  802448:	bf 01 00 00 00       	mov    $0x1,%edi
+  for (i = 0; i < memsz; i += n * PGSIZE) {
+  80244d:	89 f8                	mov    %edi,%eax
+  80244f:	c1 e0 0c             	shl    $0xc,%eax
+  802452:	01 85 84 fd ff ff    	add    %eax,-0x27c(%ebp)
+  802458:	e9 fc 01 00 00       	jmp    802659 <spawn+0x4c0>
+  80245d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802462:	eb 0e                	jmp    802472 <spawn+0x2d9>
+  802464:	8b bd 60 fd ff ff    	mov    -0x2a0(%ebp),%edi
+  80246a:	e9 c1 00 00 00       	jmp    802530 <spawn+0x397>
+          return r;
+        if (r < MIN(PGSIZE, filesz - i - j * PGSIZE))
+          return -E_INVAL;
+      }
+    } else {
+      for (j = 0; j < n; j++)
+  80246f:	83 c3 01             	add    $0x1,%ebx
+  802472:	39 df                	cmp    %ebx,%edi
+  802474:	7e 55                	jle    8024cb <spawn+0x332>
+        if ((r = sysbatch_add(&batch, SYS_page_alloc, 0,
+  802476:	83 ec 04             	sub    $0x4,%esp
+  802479:	6a 00                	push   $0x0
+  80247b:	6a 00                	push   $0x0
+  80247d:	6a 07                	push   $0x7
+  80247f:	89 d8                	mov    %ebx,%eax
+  802481:	c1 e0 0c             	shl    $0xc,%eax
+  802484:	05 00 10 40 00       	add    $0x401000,%eax
+  802489:	50                   	push   %eax
+  80248a:	6a 00                	push   $0x0
+  80248c:	6a 04                	push   $0x4
+  80248e:	68 60 57 80 00       	push   $0x805760
+  802493:	e8 74 ec ff ff       	call   80110c <sysbatch_add>
+  802498:	83 c4 20             	add    $0x20,%esp
+  80249b:	85 c0                	test   %eax,%eax
+  80249d:	79 d0                	jns    80246f <spawn+0x2d6>
+  80249f:	89 c6                	mov    %eax,%esi
+  sys_env_destroy(child);
+  8024a1:	83 ec 0c             	sub    $0xc,%esp
+  8024a4:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  8024aa:	e8 48 e7 ff ff       	call   800bf7 <sys_env_destroy>
+  close(fd);
+  8024af:	83 c4 04             	add    $0x4,%esp
+  8024b2:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  8024b8:	e8 48 ee ff ff       	call   801305 <close>
+  return r;
+  8024bd:	83 c4 10             	add    $0x10,%esp
+  8024c0:	89 b5 6c fd ff ff    	mov    %esi,-0x294(%ebp)
+  8024c6:	e9 7a 03 00 00       	jmp    802845 <spawn+0x6ac>
+                              (uint32_t) UTEMP2 + j * PGSIZE,
+                              PTE_P|PTE_U|PTE_W, 0, 0)) < 0)
+          return r;
+      if ((r = sysbatch_flush(&batch)) < 0)
+  8024cb:	83 ec 0c             	sub    $0xc,%esp
+  8024ce:	68 60 57 80 00       	push   $0x805760
+  8024d3:	e8 e4 eb ff ff       	call   8010bc <sysbatch_flush>
+  8024d8:	83 c4 10             	add    $0x10,%esp
+  8024db:	85 c0                	test   %eax,%eax
+  8024dd:	0f 88 85 03 00 00    	js     802868 <spawn+0x6cf>
+        return r;
+      if ((r = seek(fd, fileoffset + i)) < 0)
+  8024e3:	83 ec 08             	sub    $0x8,%esp
+  8024e6:	8b 85 74 fd ff ff    	mov    -0x28c(%ebp),%eax
+  8024ec:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  8024f2:	01 c8                	add    %ecx,%eax
+  8024f4:	50                   	push   %eax
+  8024f5:	8b 9d 88 fd ff ff    	mov    -0x278(%ebp),%ebx
+  8024fb:	53                   	push   %ebx
+  8024fc:	e8 dc f0 ff ff       	call   8015dd <seek>
+  802501:	83 c4 10             	add    $0x10,%esp
+  802504:	85 c0                	test   %eax,%eax
+  802506:	0f 88 63 03 00 00    	js     80286f <spawn+0x6d6>
+        return r;
+      if ((r = readn(fd, UTEMP2, MIN(n * PGSIZE, filesz - i))) < 0)
+  80250c:	83 ec 04             	sub    $0x4,%esp
+  80250f:	89 f8                	mov    %edi,%eax
+  802511:	c1 e0 0c             	shl    $0xc,%eax
+  802514:	39 f0                	cmp    %esi,%eax
+  802516:	0f 47 c6             	cmova  %esi,%eax
+  802519:	50                   	push   %eax
+  80251a:	68 00 10 40 00       	push   $0x401000
+  80251f:	53                   	push   %ebx
+  802520:	e8 ef ef ff ff       	call   801514 <readn>
+  802525:	83 c4 10             	add    $0x10,%esp
+  802528:	85 c0                	test   %eax,%eax
+  80252a:	0f 88 46 03 00 00    	js     802876 <spawn+0x6dd>
+        return r;
+    }
+    for (j = 0; j < n; j++) {
+  802530:	8d b7 01 04 00 00    	lea    0x401(%edi),%esi
+  802536:	c1 e6 0c             	shl    $0xc,%esi
+  802539:	bb 00 10 40 00       	mov    $0x401000,%ebx
+      if ((r = sysbatch_add(&batch, SYS_page_map, 0,
+  80253e:	8b 85 70 fd ff ff    	mov    -0x290(%ebp),%eax
+  802544:	8b 8d 78 fd ff ff    	mov    -0x288(%ebp),%ecx
+  80254a:	8d 84 08 00 f0 bf ff 	lea    -0x401000(%eax,%ecx,1),%eax
+  802551:	89 bd 80 fd ff ff    	mov    %edi,-0x280(%ebp)
+  802557:	89 c7                	mov    %eax,%edi
+    for (j = 0; j < n; j++) {
+  802559:	39 f3                	cmp    %esi,%ebx
+  80255b:	74 59                	je     8025b6 <spawn+0x41d>
+      if ((r = sysbatch_add(&batch, SYS_page_map, 0,
+  80255d:	83 ec 04             	sub    $0x4,%esp
+  802560:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  802566:	8d 04 1f             	lea    (%edi,%ebx,1),%eax
+  802569:	50                   	push   %eax
+  80256a:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  802570:	53                   	push   %ebx
+  802571:	6a 00                	push   $0x0
+  802573:	6a 05                	push   $0x5
+  802575:	68 60 57 80 00       	push   $0x805760
+  80257a:	e8 8d eb ff ff       	call   80110c <sysbatch_add>
+  80257f:	83 c4 20             	add    $0x20,%esp
+  802582:	85 c0                	test   %eax,%eax
+  802584:	0f 88 f3 02 00 00    	js     80287d <spawn+0x6e4>
+                            (uint32_t) UTEMP2 + j * PGSIZE, child,
+                            va + i + j * PGSIZE, perm)) < 0)
+        return r;
+      if ((r = sysbatch_add(&batch, SYS_page_unmap, 0,
+  80258a:	83 ec 04             	sub    $0x4,%esp
+  80258d:	6a 00                	push   $0x0
+  80258f:	6a 00                	push   $0x0
+  802591:	6a 00                	push   $0x0
+  802593:	53                   	push   %ebx
+  802594:	6a 00                	push   $0x0
+  802596:	6a 06                	push   $0x6
+  802598:	68 60 57 80 00       	push   $0x805760
+  80259d:	e8 6a eb ff ff       	call   80110c <sysbatch_add>
+  8025a2:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8025a8:	83 c4 20             	add    $0x20,%esp
+  8025ab:	85 c0                	test   %eax,%eax
+  8025ad:	79 aa                	jns    802559 <spawn+0x3c0>
+  8025af:	89 c6                	mov    %eax,%esi
+  8025b1:	e9 eb fe ff ff       	jmp    8024a1 <spawn+0x308>
+  8025b6:	8b bd 80 fd ff ff    	mov    -0x280(%ebp),%edi
+  8025bc:	e9 8c fe ff ff       	jmp    80244d <spawn+0x2b4>
+  8025c1:	8b b5 68 fd ff ff    	mov    -0x298(%ebp),%esi
+  8025c7:	8b bd 64 fd ff ff    	mov    -0x29c(%ebp),%edi
+  for (i = 0; i < elf->e_phnum; i++, ph++) {
+  8025cd:	83 c6 01             	add    $0x1,%esi
+  8025d0:	83 c7 20             	add    $0x20,%edi
+  8025d3:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  8025da:	39 f0                	cmp    %esi,%eax
+  8025dc:	0f 8e 9b 01 00 00    	jle    80277d <spawn+0x5e4>
+    if (ph->p_type != ELF_PROG_LOAD)
+  8025e2:	83 3f 01             	cmpl   $0x1,(%edi)
+  8025e5:	75 e6                	jne    8025cd <spawn+0x434>
+    if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  8025e7:	8b 47 18             	mov    0x18(%edi),%eax
+  8025ea:	83 e0 02             	and    $0x2,%eax
+    perm = PTE_P | PTE_U;
+  8025ed:	83 f8 01             	cmp    $0x1,%eax
+  8025f0:	19 c0                	sbb    %eax,%eax
+  8025f2:	83 e0 fe             	and    $0xfffffffe,%eax
+  8025f5:	83 c0 07             	add    $0x7,%eax
+  8025f8:	89 85 94 fd ff ff    	mov    %eax,-0x26c(%ebp)
+    if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  8025fe:	8b 57 04             	mov    0x4(%edi),%edx
+  802601:	89 95 74 fd ff ff    	mov    %edx,-0x28c(%ebp)
+  802607:	8b 5f 10             	mov    0x10(%edi),%ebx
+  80260a:	89 9d 8c fd ff ff    	mov    %ebx,-0x274(%ebp)
+  802610:	8b 47 14             	mov    0x14(%edi),%eax
+  802613:	89 85 7c fd ff ff    	mov    %eax,-0x284(%ebp)
+  802619:	8b 4f 08             	mov    0x8(%edi),%ecx
+  if ((i = PGOFF(va))) {
+  80261c:	89 c8                	mov    %ecx,%eax
+  80261e:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802623:	74 18                	je     80263d <spawn+0x4a4>
+    va -= i;
+  802625:	29 c1                	sub    %eax,%ecx
+    memsz += i;
+  802627:	01 85 7c fd ff ff    	add    %eax,-0x284(%ebp)
+    filesz += i;
+  80262d:	01 c3                	add    %eax,%ebx
+  80262f:	89 9d 8c fd ff ff    	mov    %ebx,-0x274(%ebp)
+    fileoffset -= i;
+  802635:	29 c2                	sub    %eax,%edx
+  802637:	89 95 74 fd ff ff    	mov    %edx,-0x28c(%ebp)
+  for (i = 0; i < memsz; i += n * PGSIZE) {
+  80263d:	c7 85 84 fd ff ff 00 	movl   $0x0,-0x27c(%ebp)
+  802644:	00 00 00 
+  802647:	89 8d 70 fd ff ff    	mov    %ecx,-0x290(%ebp)
+  80264d:	89 b5 68 fd ff ff    	mov    %esi,-0x298(%ebp)
+  802653:	89 bd 64 fd ff ff    	mov    %edi,-0x29c(%ebp)
+  802659:	8b 85 84 fd ff ff    	mov    -0x27c(%ebp),%eax
+  80265f:	89 85 78 fd ff ff    	mov    %eax,-0x288(%ebp)
+  802665:	8b 8d 7c fd ff ff    	mov    -0x284(%ebp),%ecx
+  80266b:	39 c8                	cmp    %ecx,%eax
+  80266d:	0f 83 4e ff ff ff    	jae    8025c1 <spawn+0x428>
+    if (i >= filesz) {
+  802673:	8b 8d 8c fd ff ff    	mov    -0x274(%ebp),%ecx
+  802679:	39 8d 84 fd ff ff    	cmp    %ecx,-0x27c(%ebp)
+  80267f:	0f 83 8a fd ff ff    	jae    80240f <spawn+0x276>
+    n = MIN(SEGCHUNK, ROUNDUP(filesz - i, PGSIZE) / PGSIZE);
+  802685:	8b b5 8c fd ff ff    	mov    -0x274(%ebp),%esi
+  80268b:	8b 85 78 fd ff ff    	mov    -0x288(%ebp),%eax
+  802691:	29 c6                	sub    %eax,%esi
+  802693:	8d 86 ff 0f 00 00    	lea    0xfff(%esi),%eax
+  802699:	c1 e8 0c             	shr    $0xc,%eax
+  80269c:	ba 10 00 00 00       	mov    $0x10,%edx
+  8026a1:	39 d0                	cmp    %edx,%eax
+  8026a3:	0f 47 c2             	cmova  %edx,%eax
+  8026a6:	89 c7                	mov    %eax,%edi
+  if ((perm & PTE_W) || PGOFF(fileoffset))
+  8026a8:	8b 9d 94 fd ff ff    	mov    -0x26c(%ebp),%ebx
+  8026ae:	83 e3 02             	and    $0x2,%ebx
+  8026b1:	8b 95 74 fd ff ff    	mov    -0x28c(%ebp),%edx
+  8026b7:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8026bd:	09 d3                	or     %edx,%ebx
+  8026bf:	0f 85 98 fd ff ff    	jne    80245d <spawn+0x2c4>
+    n = MIN(n, (filesz - i) / PGSIZE);
+  8026c5:	89 f2                	mov    %esi,%edx
+  8026c7:	c1 ea 0c             	shr    $0xc,%edx
+  8026ca:	39 c2                	cmp    %eax,%edx
+  8026cc:	0f 47 d0             	cmova  %eax,%edx
+  8026cf:	8b 8d 7c fd ff ff    	mov    -0x284(%ebp),%ecx
+  8026d5:	39 8d 8c fd ff ff    	cmp    %ecx,-0x274(%ebp)
+  8026db:	0f 43 d0             	cmovae %eax,%edx
+    if ((m = shared_pages(perm, memsz, filesz, fileoffset, i, n)) > 0) {
+  8026de:	89 95 60 fd ff ff    	mov    %edx,-0x2a0(%ebp)
+  8026e4:	85 d2                	test   %edx,%edx
+  8026e6:	0f 8e 86 fd ff ff    	jle    802472 <spawn+0x2d9>
+      if ((r = sysbatch_flush(&batch)) < 0)
+  8026ec:	83 ec 0c             	sub    $0xc,%esp
+  8026ef:	68 60 57 80 00       	push   $0x805760
+  8026f4:	e8 c3 e9 ff ff       	call   8010bc <sysbatch_flush>
+  8026f9:	83 c4 10             	add    $0x10,%esp
+  8026fc:	85 c0                	test   %eax,%eax
+  8026fe:	0f 88 56 01 00 00    	js     80285a <spawn+0x6c1>
+  802704:	8b 85 60 fd ff ff    	mov    -0x2a0(%ebp),%eax
+  80270a:	c1 e0 0c             	shl    $0xc,%eax
+  80270d:	89 f1                	mov    %esi,%ecx
+  80270f:	29 c1                	sub    %eax,%ecx
+  802711:	89 8d 80 fd ff ff    	mov    %ecx,-0x280(%ebp)
+  802717:	89 f3                	mov    %esi,%ebx
+        if ((r = read_map(fd, fileoffset + i + j * PGSIZE,
+  802719:	8d be 00 10 40 00    	lea    0x401000(%esi),%edi
+  80271f:	8b 8d 74 fd ff ff    	mov    -0x28c(%ebp),%ecx
+  802725:	8b 85 8c fd ff ff    	mov    -0x274(%ebp),%eax
+  80272b:	8d 34 01             	lea    (%ecx,%eax,1),%esi
+      for (j = 0; j < n; j++) {
+  80272e:	8b 85 80 fd ff ff    	mov    -0x280(%ebp),%eax
+  802734:	39 c3                	cmp    %eax,%ebx
+  802736:	0f 84 28 fd ff ff    	je     802464 <spawn+0x2cb>
+        if ((r = read_map(fd, fileoffset + i + j * PGSIZE,
+  80273c:	83 ec 04             	sub    $0x4,%esp
+  80273f:	89 f8                	mov    %edi,%eax
+  802741:	29 d8                	sub    %ebx,%eax
+  802743:	50                   	push   %eax
+  802744:	89 f0                	mov    %esi,%eax
+  802746:	29 d8                	sub    %ebx,%eax
+  802748:	50                   	push   %eax
+  802749:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  80274f:	e8 00 f8 ff ff       	call   801f54 <read_map>
+  802754:	83 c4 10             	add    $0x10,%esp
+  802757:	85 c0                	test   %eax,%eax
+  802759:	0f 88 02 01 00 00    	js     802861 <spawn+0x6c8>
+        if (r < MIN(PGSIZE, filesz - i - j * PGSIZE))
+  80275f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802764:	39 d3                	cmp    %edx,%ebx
+  802766:	0f 46 d3             	cmovbe %ebx,%edx
+  802769:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  80276f:	39 d0                	cmp    %edx,%eax
+  802771:	73 bb                	jae    80272e <spawn+0x595>
+          return -E_INVAL;
+  802773:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+  802778:	e9 24 fd ff ff       	jmp    8024a1 <spawn+0x308>
+  close(fd);
+  80277d:	83 ec 0c             	sub    $0xc,%esp
+  802780:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  802786:	e8 7a eb ff ff       	call   801305 <close>
+// Copy the mappings for shared pages into the child address space.
+static int
+copy_shared_pages(envid_t child)
+{
+  // LAB 5: Your code here.
+  return sysbatch_add(&batch, SYS_page_map_range, 0, 0, UTOP,
+  80278b:	83 c4 0c             	add    $0xc,%esp
+  80278e:	6a 02                	push   $0x2
+  802790:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  802796:	68 00 00 c0 ee       	push   $0xeec00000
+  80279b:	6a 00                	push   $0x0
+  80279d:	6a 00                	push   $0x0
+  80279f:	6a 11                	push   $0x11
+  8027a1:	68 60 57 80 00       	push   $0x805760
+  8027a6:	e8 61 e9 ff ff       	call   80110c <sysbatch_add>
+  if ((r = copy_shared_pages(child)) < 0)
+  8027ab:	83 c4 20             	add    $0x20,%esp
+  8027ae:	85 c0                	test   %eax,%eax
+  8027b0:	78 72                	js     802824 <spawn+0x68b>
+  if ((r = sysbatch_add(&batch, SYS_env_set_trapframe, child,
+  8027b2:	83 ec 04             	sub    $0x4,%esp
+  8027b5:	6a 00                	push   $0x0
+  8027b7:	6a 00                	push   $0x0
+  8027b9:	6a 00                	push   $0x0
+  8027bb:	8d 85 a4 fd ff ff    	lea    -0x25c(%ebp),%eax
+  8027c1:	50                   	push   %eax
+  8027c2:	8b bd 90 fd ff ff    	mov    -0x270(%ebp),%edi
+  8027c8:	57                   	push   %edi
+  8027c9:	6a 09                	push   $0x9
+  8027cb:	68 60 57 80 00       	push   $0x805760
+  8027d0:	e8 37 e9 ff ff       	call   80110c <sysbatch_add>
+  8027d5:	83 c4 20             	add    $0x20,%esp
+  8027d8:	85 c0                	test   %eax,%eax
+  8027da:	78 33                	js     80280f <spawn+0x676>
+      (r = sysbatch_add(&batch, SYS_env_set_status, child,
+  8027dc:	83 ec 04             	sub    $0x4,%esp
+  8027df:	6a 00                	push   $0x0
+  8027e1:	6a 00                	push   $0x0
+  8027e3:	6a 00                	push   $0x0
+  8027e5:	6a 02                	push   $0x2
+  8027e7:	57                   	push   %edi
+  8027e8:	6a 08                	push   $0x8
+  8027ea:	68 60 57 80 00       	push   $0x805760
+  8027ef:	e8 18 e9 ff ff       	call   80110c <sysbatch_add>
+                        (uint32_t) &child_tf, 0, 0, 0)) < 0 ||
+  8027f4:	83 c4 20             	add    $0x20,%esp
+  8027f7:	85 c0                	test   %eax,%eax
+  8027f9:	78 14                	js     80280f <spawn+0x676>
+      (r = sysbatch_flush(&batch)) < 0)
+  8027fb:	83 ec 0c             	sub    $0xc,%esp
+  8027fe:	68 60 57 80 00       	push   $0x805760
+  802803:	e8 b4 e8 ff ff       	call   8010bc <sysbatch_flush>
+                        ENV_RUNNABLE, 0, 0, 0)) < 0 ||
+  802808:	83 c4 10             	add    $0x10,%esp
+  80280b:	85 c0                	test   %eax,%eax
+  80280d:	79 36                	jns    802845 <spawn+0x6ac>
+    panic("spawn: starting child: %e", r);
+  80280f:	50                   	push   %eax
+  802810:	68 64 3c 80 00       	push   $0x803c64
+  802815:	68 93 00 00 00       	push   $0x93
+  80281a:	68 42 3c 80 00       	push   $0x803c42
+  80281f:	e8 9d d9 ff ff       	call   8001c1 <_panic>
+    panic("copy_shared_pages: %e", r);
+  802824:	50                   	push   %eax
+  802825:	68 4e 3c 80 00       	push   $0x803c4e
+  80282a:	68 8c 00 00 00       	push   $0x8c
+  80282f:	68 42 3c 80 00       	push   $0x803c42
+  802834:	e8 88 d9 ff ff       	call   8001c1 <_panic>
+    return r;
+  802839:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  80283f:	89 85 6c fd ff ff    	mov    %eax,-0x294(%ebp)
+}
+  802845:	8b 85 6c fd ff ff    	mov    -0x294(%ebp),%eax
+  80284b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80284e:	5b                   	pop    %ebx
+  80284f:	5e                   	pop    %esi
+  802850:	5f                   	pop    %edi
+  802851:	5d                   	pop    %ebp
+  802852:	c3                   	ret
+  802853:	89 c6                	mov    %eax,%esi
+  802855:	e9 47 fc ff ff       	jmp    8024a1 <spawn+0x308>
+  80285a:	89 c6                	mov    %eax,%esi
+  80285c:	e9 40 fc ff ff       	jmp    8024a1 <spawn+0x308>
+  802861:	89 c6                	mov    %eax,%esi
+  802863:	e9 39 fc ff ff       	jmp    8024a1 <spawn+0x308>
+  802868:	89 c6                	mov    %eax,%esi
+  80286a:	e9 32 fc ff ff       	jmp    8024a1 <spawn+0x308>
+  80286f:	89 c6                	mov    %eax,%esi
+  802871:	e9 2b fc ff ff       	jmp    8024a1 <spawn+0x308>
+  802876:	89 c6                	mov    %eax,%esi
+  802878:	e9 24 fc ff ff       	jmp    8024a1 <spawn+0x308>
+  80287d:	89 c6                	mov    %eax,%esi
+  80287f:	e9 1d fc ff ff       	jmp    8024a1 <spawn+0x308>
+    return -E_NO_MEM;
+  802884:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  return r;
+  802889:	89 85 6c fd ff ff    	mov    %eax,-0x294(%ebp)
+  80288f:	eb b4                	jmp    802845 <spawn+0x6ac>
+  sys_page_unmap(0, UTEMP);
+  802891:	83 ec 08             	sub    $0x8,%esp
+  802894:	68 00 00 40 00       	push   $0x400000
+  802899:	6a 00                	push   $0x0
+  80289b:	e8 9e e4 ff ff       	call   800d3e <sys_page_unmap>
+  8028a0:	83 c4 10             	add    $0x10,%esp
+  8028a3:	89 9d 6c fd ff ff    	mov    %ebx,-0x294(%ebp)
+  8028a9:	eb 9a                	jmp    802845 <spawn+0x6ac>
+
+008028ab <spawnl>:
+{
+  8028ab:	55                   	push   %ebp
+  8028ac:	89 e5                	mov    %esp,%ebp
+  8028ae:	56                   	push   %esi
+  8028af:	53                   	push   %ebx
+  va_start(vl, arg0);
+  8028b0:	8d 45 10             	lea    0x10(%ebp),%eax
+  int argc = 0;
+  8028b3:	be 00 00 00 00       	mov    $0x0,%esi
+  while (va_arg(vl, void *) != NULL) {
+  8028b8:	eb 17                	jmp    8028d1 <spawnl+0x26>
+      cprintf("vl: %p saying %s\n", vl, vl);
+  8028ba:	83 ec 04             	sub    $0x4,%esp
+  8028bd:	53                   	push   %ebx
+  8028be:	53                   	push   %ebx
+  8028bf:	68 7e 3c 80 00       	push   $0x803c7e
+  8028c4:	e8 d3 d9 ff ff       	call   80029c <cprintf>
+    argc++;
+  8028c9:	83 c6 01             	add    $0x1,%esi
+  8028cc:	83 c4 10             	add    $0x10,%esp
+  while (va_arg(vl, void *) != NULL) {
+  8028cf:	89 d8                	mov    %ebx,%eax
+  8028d1:	8d 58 04             	lea    0x4(%eax),%ebx
+  8028d4:	83 38 00             	cmpl   $0x0,(%eax)
+  8028d7:	75 e1                	jne    8028ba <spawnl+0xf>
+  cprintf("argc found %d\n", argc);
+  8028d9:	83 ec 08             	sub    $0x8,%esp
+  8028dc:	56                   	push   %esi
+  8028dd:	68 90 3c 80 00       	push   $0x803c90
+  8028e2:	e8 b5 d9 ff ff       	call   80029c <cprintf>
+  const char *argv[argc+2];
+  8028e7:	8d 04 b5 17 00 00 00 	lea    0x17(,%esi,4),%eax
+  8028ee:	83 e0 f0             	and    $0xfffffff0,%eax
+  8028f1:	83 c4 10             	add    $0x10,%esp
+  8028f4:	29 c4                	sub    %eax,%esp
+  8028f6:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  8028fa:	89 d8                	mov    %ebx,%eax
+  8028fc:	c1 e8 02             	shr    $0x2,%eax
+  8028ff:	83 e3 fc             	and    $0xfffffffc,%ebx
+  argv[0] = arg0;
+  802902:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802905:	89 14 85 00 00 00 00 	mov    %edx,0x0(,%eax,4)
+  argv[argc+1] = NULL;
+  80290c:	c7 44 b3 04 00 00 00 	movl   $0x0,0x4(%ebx,%esi,4)
+  802913:	00 
+  va_start(vl, arg0);
+  802914:	8d 55 10             	lea    0x10(%ebp),%edx
+  for (i = 0; i < argc; i++)
+  802917:	b8 00 00 00 00       	mov    $0x0,%eax
+  80291c:	eb 0b                	jmp    802929 <spawnl+0x7e>
+    argv[i+1] = va_arg(vl, const char *);
+  80291e:	83 c0 01             	add    $0x1,%eax
+  802921:	8b 0a                	mov    (%edx),%ecx
+  802923:	89 0c 83             	mov    %ecx,(%ebx,%eax,4)
+  802926:	8d 52 04             	lea    0x4(%edx),%edx
+  for (i = 0; i < argc; i++)
+  802929:	39 f0                	cmp    %esi,%eax
+  80292b:	75 f1                	jne    80291e <spawnl+0x73>
+  return spawn(prog, argv);
+  80292d:	83 ec 08             	sub    $0x8,%esp
+  802930:	53                   	push   %ebx
+  802931:	ff 75 08             	push   0x8(%ebp)
+  802934:	e8 60 f8 ff ff       	call   802199 <spawn>
+}
+  802939:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80293c:	5b                   	pop    %ebx
+  80293d:	5e                   	pop    %esi
+  80293e:	5d                   	pop    %ebp
+  80293f:	c3                   	ret
+
+00802940 <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  802940:	55                   	push   %ebp
+  802941:	89 e5                	mov    %esp,%ebp
+  802943:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  802946:	50                   	push   %eax
+  802947:	e8 2c e8 ff ff       	call   801178 <fd2data>
+  80294c:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  802951:	c9                   	leave
+  802952:	c3                   	ret
+
+00802953 <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802953:	55                   	push   %ebp
+  802954:	89 e5                	mov    %esp,%ebp
+  802956:	56                   	push   %esi
+  802957:	53                   	push   %ebx
+  802958:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  80295b:	83 ec 0c             	sub    $0xc,%esp
+  80295e:	ff 75 08             	push   0x8(%ebp)
+  802961:	e8 12 e8 ff ff       	call   801178 <fd2data>
+  802966:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  802968:	83 c4 08             	add    $0x8,%esp
+  80296b:	68 c6 3c 80 00       	push   $0x803cc6
+  802970:	53                   	push   %ebx
+  802971:	e8 14 df ff ff       	call   80088a <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  802976:	8b 46 04             	mov    0x4(%esi),%eax
+  802979:	2b 06                	sub    (%esi),%eax
+  80297b:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  802981:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802988:	00 00 00 
+  stat->st_dev = &devpipe;
+  80298b:	c7 83 88 00 00 00 20 	movl   $0x804020,0x88(%ebx)
+  802992:	40 80 00 
+  return 0;
+}
+  802995:	b8 00 00 00 00       	mov    $0x0,%eax
+  80299a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80299d:	5b                   	pop    %ebx
+  80299e:	5e                   	pop    %esi
+  80299f:	5d                   	pop    %ebp
+  8029a0:	c3                   	ret
+
+008029a1 <pipe_wakeup>:
+{
+  8029a1:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  8029a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029a8:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  8029ab:	85 c0                	test   %eax,%eax
+  8029ad:	75 01                	jne    8029b0 <pipe_wakeup+0xf>
+  8029af:	c3                   	ret
+{
+  8029b0:	55                   	push   %ebp
+  8029b1:	89 e5                	mov    %esp,%ebp
+  8029b3:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  8029b6:	6a 00                	push   $0x0
+  8029b8:	68 00 00 c0 ee       	push   $0xeec00000
+  8029bd:	52                   	push   %edx
+  8029be:	e8 52 e6 ff ff       	call   801015 <sys_chan_wakeup>
+  8029c3:	83 c4 10             	add    $0x10,%esp
+}
+  8029c6:	c9                   	leave
+  8029c7:	c3                   	ret
+
+008029c8 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8029c8:	55                   	push   %ebp
+  8029c9:	89 e5                	mov    %esp,%ebp
+  8029cb:	57                   	push   %edi
+  8029cc:	56                   	push   %esi
+  8029cd:	53                   	push   %ebx
+  8029ce:	83 ec 18             	sub    $0x18,%esp
+  8029d1:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  8029d4:	57                   	push   %edi
+  8029d5:	e8 9e e7 ff ff       	call   801178 <fd2data>
+  8029da:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  8029dc:	83 c4 10             	add    $0x10,%esp
+  8029df:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  8029e3:	74 2a                	je     802a0f <devpipe_close+0x47>
+  8029e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  8029ea:	89 f8                	mov    %edi,%eax
+  8029ec:	e8 4f ff ff ff       	call   802940 <pipe_ring>
+  8029f1:	83 ec 08             	sub    $0x8,%esp
+  8029f4:	01 d8                	add    %ebx,%eax
+  8029f6:	50                   	push   %eax
+  8029f7:	6a 00                	push   $0x0
+  8029f9:	e8 40 e3 ff ff       	call   800d3e <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  8029fe:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802a04:	83 c4 10             	add    $0x10,%esp
+  802a07:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  802a0d:	75 db                	jne    8029ea <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  802a0f:	83 ec 08             	sub    $0x8,%esp
+  802a12:	57                   	push   %edi
+  802a13:	6a 00                	push   $0x0
+  802a15:	e8 24 e3 ff ff       	call   800d3e <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  802a1a:	83 c4 10             	add    $0x10,%esp
+  802a1d:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  802a21:	75 13                	jne    802a36 <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  802a23:	83 ec 08             	sub    $0x8,%esp
+  802a26:	56                   	push   %esi
+  802a27:	6a 00                	push   $0x0
+  802a29:	e8 10 e3 ff ff       	call   800d3e <sys_page_unmap>
+}
+  802a2e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a31:	5b                   	pop    %ebx
+  802a32:	5e                   	pop    %esi
+  802a33:	5f                   	pop    %edi
+  802a34:	5d                   	pop    %ebp
+  802a35:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802a36:	8d 56 04             	lea    0x4(%esi),%edx
+  802a39:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802a3c:	e8 60 ff ff ff       	call   8029a1 <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802a41:	8d 46 30             	lea    0x30(%esi),%eax
+  802a44:	89 f2                	mov    %esi,%edx
+  802a46:	e8 56 ff ff ff       	call   8029a1 <pipe_wakeup>
+  802a4b:	eb d6                	jmp    802a23 <devpipe_close+0x5b>
+
+00802a4d <_pipeisclosed>:
+{
+  802a4d:	55                   	push   %ebp
+  802a4e:	89 e5                	mov    %esp,%ebp
+  802a50:	57                   	push   %edi
+  802a51:	56                   	push   %esi
+  802a52:	53                   	push   %ebx
+  802a53:	83 ec 1c             	sub    $0x1c,%esp
+  802a56:	89 c7                	mov    %eax,%edi
+  802a58:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  802a5a:	a1 64 5e 80 00       	mov    0x805e64,%eax
+  802a5f:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  802a62:	83 ec 0c             	sub    $0xc,%esp
+  802a65:	57                   	push   %edi
+  802a66:	e8 69 0a 00 00       	call   8034d4 <pageref>
+  802a6b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802a6e:	89 34 24             	mov    %esi,(%esp)
+  802a71:	e8 5e 0a 00 00       	call   8034d4 <pageref>
+    nn = thisenv->env_runs;
+  802a76:	8b 15 64 5e 80 00    	mov    0x805e64,%edx
+  802a7c:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  802a7f:	83 c4 10             	add    $0x10,%esp
+  802a82:	39 cb                	cmp    %ecx,%ebx
+  802a84:	74 1b                	je     802aa1 <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  802a86:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802a89:	75 cf                	jne    802a5a <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802a8b:	8b 42 58             	mov    0x58(%edx),%eax
+  802a8e:	6a 01                	push   $0x1
+  802a90:	50                   	push   %eax
+  802a91:	53                   	push   %ebx
+  802a92:	68 cd 3c 80 00       	push   $0x803ccd
+  802a97:	e8 00 d8 ff ff       	call   80029c <cprintf>
+  802a9c:	83 c4 10             	add    $0x10,%esp
+  802a9f:	eb b9                	jmp    802a5a <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  802aa1:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802aa4:	0f 94 c0             	sete   %al
+  802aa7:	0f b6 c0             	movzbl %al,%eax
+}
+  802aaa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802aad:	5b                   	pop    %ebx
+  802aae:	5e                   	pop    %esi
+  802aaf:	5f                   	pop    %edi
+  802ab0:	5d                   	pop    %ebp
+  802ab1:	c3                   	ret
+
+00802ab2 <devpipe_write_bulk>:
+{
+  802ab2:	55                   	push   %ebp
+  802ab3:	89 e5                	mov    %esp,%ebp
+  802ab5:	57                   	push   %edi
+  802ab6:	56                   	push   %esi
+  802ab7:	53                   	push   %ebx
+  802ab8:	83 ec 1c             	sub    $0x1c,%esp
+  802abb:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802abe:	89 d6                	mov    %edx,%esi
+  802ac0:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  802ac3:	e8 78 fe ff ff       	call   802940 <pipe_ring>
+  802ac8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  802acb:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802ad0:	8d 46 04             	lea    0x4(%esi),%eax
+  802ad3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  802ad6:	eb 75                	jmp    802b4d <devpipe_write_bulk+0x9b>
+  802ad8:	b8 01 00 00 00       	mov    $0x1,%eax
+  802add:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802ae1:	6a 64                	push   $0x64
+  802ae3:	68 00 00 c0 ee       	push   $0xeec00000
+  802ae8:	53                   	push   %ebx
+  802ae9:	56                   	push   %esi
+  802aea:	e8 03 e5 ff ff       	call   800ff2 <sys_chan_sleep>
+      continue;
+  802aef:	83 c4 10             	add    $0x10,%esp
+  802af2:	eb 59                	jmp    802b4d <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  802af4:	89 d1                	mov    %edx,%ecx
+  802af6:	c1 f9 1f             	sar    $0x1f,%ecx
+  802af9:	c1 e9 11             	shr    $0x11,%ecx
+  802afc:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802aff:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802b04:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  802b06:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  802b0c:	29 d3                	sub    %edx,%ebx
+  802b0e:	ba 00 80 00 00       	mov    $0x8000,%edx
+  802b13:	29 c2                	sub    %eax,%edx
+  802b15:	39 d3                	cmp    %edx,%ebx
+  802b17:	0f 47 da             	cmova  %edx,%ebx
+  802b1a:	8b 55 08             	mov    0x8(%ebp),%edx
+  802b1d:	29 fa                	sub    %edi,%edx
+  802b1f:	39 d3                	cmp    %edx,%ebx
+  802b21:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  802b24:	83 ec 04             	sub    $0x4,%esp
+  802b27:	53                   	push   %ebx
+  802b28:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802b2b:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  802b2e:	52                   	push   %edx
+  802b2f:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802b32:	01 c8                	add    %ecx,%eax
+  802b34:	50                   	push   %eax
+  802b35:	e8 38 df ff ff       	call   800a72 <memcpy>
+    i += m;
+  802b3a:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  802b3c:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802b3f:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802b42:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802b45:	e8 57 fe ff ff       	call   8029a1 <pipe_wakeup>
+  802b4a:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802b4d:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802b50:	73 2b                	jae    802b7d <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  802b52:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  802b54:	8b 56 04             	mov    0x4(%esi),%edx
+  802b57:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  802b5d:	39 d0                	cmp    %edx,%eax
+  802b5f:	7d 93                	jge    802af4 <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  802b61:	89 f2                	mov    %esi,%edx
+  802b63:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802b66:	e8 e2 fe ff ff       	call   802a4d <_pipeisclosed>
+  802b6b:	85 c0                	test   %eax,%eax
+  802b6d:	0f 84 65 ff ff ff    	je     802ad8 <devpipe_write_bulk+0x26>
+        return i;
+  802b73:	89 f8                	mov    %edi,%eax
+}
+  802b75:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b78:	5b                   	pop    %ebx
+  802b79:	5e                   	pop    %esi
+  802b7a:	5f                   	pop    %edi
+  802b7b:	5d                   	pop    %ebp
+  802b7c:	c3                   	ret
+  return i;
+  802b7d:	89 f8                	mov    %edi,%eax
+  802b7f:	eb f4                	jmp    802b75 <devpipe_write_bulk+0xc3>
+
+00802b81 <devpipe_write>:
+{
+  802b81:	55                   	push   %ebp
+  802b82:	89 e5                	mov    %esp,%ebp
+  802b84:	57                   	push   %edi
+  802b85:	56                   	push   %esi
+  802b86:	53                   	push   %ebx
+  802b87:	83 ec 28             	sub    $0x28,%esp
+  802b8a:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  802b8d:	56                   	push   %esi
+  802b8e:	e8 e5 e5 ff ff       	call   801178 <fd2data>
+  802b93:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  802b95:	8b 78 28             	mov    0x28(%eax),%edi
+  802b98:	83 c4 10             	add    $0x10,%esp
+  802b9b:	85 ff                	test   %edi,%edi
+  802b9d:	75 25                	jne    802bc4 <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  802b9f:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802ba2:	74 66                	je     802c0a <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802ba4:	8b 43 04             	mov    0x4(%ebx),%eax
+  802ba7:	8b 0b                	mov    (%ebx),%ecx
+  802ba9:	8d 51 20             	lea    0x20(%ecx),%edx
+  802bac:	39 d0                	cmp    %edx,%eax
+  802bae:	72 2b                	jb     802bdb <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  802bb0:	89 da                	mov    %ebx,%edx
+  802bb2:	89 f0                	mov    %esi,%eax
+  802bb4:	e8 94 fe ff ff       	call   802a4d <_pipeisclosed>
+  802bb9:	85 c0                	test   %eax,%eax
+  802bbb:	75 51                	jne    802c0e <devpipe_write+0x8d>
+      sys_yield();
+  802bbd:	e8 95 e0 ff ff       	call   800c57 <sys_yield>
+  802bc2:	eb e0                	jmp    802ba4 <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  802bc4:	83 ec 0c             	sub    $0xc,%esp
+  802bc7:	ff 75 10             	push   0x10(%ebp)
+  802bca:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802bcd:	89 c2                	mov    %eax,%edx
+  802bcf:	89 f0                	mov    %esi,%eax
+  802bd1:	e8 dc fe ff ff       	call   802ab2 <devpipe_write_bulk>
+  802bd6:	83 c4 10             	add    $0x10,%esp
+  802bd9:	eb 38                	jmp    802c13 <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802bdb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802bde:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802be2:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802be5:	89 c2                	mov    %eax,%edx
+  802be7:	c1 fa 1f             	sar    $0x1f,%edx
+  802bea:	89 d1                	mov    %edx,%ecx
+  802bec:	c1 e9 1b             	shr    $0x1b,%ecx
+  802bef:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802bf2:	83 e2 1f             	and    $0x1f,%edx
+  802bf5:	29 ca                	sub    %ecx,%edx
+  802bf7:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802bfb:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  802bff:	83 c0 01             	add    $0x1,%eax
+  802c02:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  802c05:	83 c7 01             	add    $0x1,%edi
+  802c08:	eb 95                	jmp    802b9f <devpipe_write+0x1e>
+  return i;
+  802c0a:	89 f8                	mov    %edi,%eax
+  802c0c:	eb 05                	jmp    802c13 <devpipe_write+0x92>
+        return 0;
+  802c0e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c13:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c16:	5b                   	pop    %ebx
+  802c17:	5e                   	pop    %esi
+  802c18:	5f                   	pop    %edi
+  802c19:	5d                   	pop    %ebp
+  802c1a:	c3                   	ret
+
+00802c1b <devpipe_read_bulk>:
+{
+  802c1b:	55                   	push   %ebp
+  802c1c:	89 e5                	mov    %esp,%ebp
+  802c1e:	57                   	push   %edi
+  802c1f:	56                   	push   %esi
+  802c20:	53                   	push   %ebx
+  802c21:	83 ec 2c             	sub    $0x2c,%esp
+  802c24:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802c27:	89 d6                	mov    %edx,%esi
+  802c29:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802c2c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  802c2f:	e8 0c fd ff ff       	call   802940 <pipe_ring>
+  802c34:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  802c37:	85 db                	test   %ebx,%ebx
+  802c39:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802c3e:	0f 45 c3             	cmovne %ebx,%eax
+  802c41:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802c44:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802c49:	8d 46 30             	lea    0x30(%esi),%eax
+  802c4c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  802c4f:	eb 50                	jmp    802ca1 <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  802c51:	89 d1                	mov    %edx,%ecx
+  802c53:	c1 f9 1f             	sar    $0x1f,%ecx
+  802c56:	c1 e9 11             	shr    $0x11,%ecx
+  802c59:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802c5c:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802c61:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  802c63:	29 d3                	sub    %edx,%ebx
+  802c65:	ba 00 80 00 00       	mov    $0x8000,%edx
+  802c6a:	29 c2                	sub    %eax,%edx
+  802c6c:	39 d3                	cmp    %edx,%ebx
+  802c6e:	0f 47 da             	cmova  %edx,%ebx
+  802c71:	8b 55 08             	mov    0x8(%ebp),%edx
+  802c74:	29 fa                	sub    %edi,%edx
+  802c76:	39 d3                	cmp    %edx,%ebx
+  802c78:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  802c7b:	83 ec 04             	sub    $0x4,%esp
+  802c7e:	53                   	push   %ebx
+  802c7f:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802c82:	01 c8                	add    %ecx,%eax
+  802c84:	50                   	push   %eax
+  802c85:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802c88:	01 f8                	add    %edi,%eax
+  802c8a:	50                   	push   %eax
+  802c8b:	e8 e2 dd ff ff       	call   800a72 <memcpy>
+    i += m;
+  802c90:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  802c92:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802c94:	89 f2                	mov    %esi,%edx
+  802c96:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802c99:	e8 03 fd ff ff       	call   8029a1 <pipe_wakeup>
+  802c9e:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802ca1:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802ca4:	73 51                	jae    802cf7 <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  802ca6:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  802ca9:	8b 16                	mov    (%esi),%edx
+  802cab:	39 da                	cmp    %ebx,%edx
+  802cad:	75 a2                	jne    802c51 <devpipe_read_bulk+0x36>
+      if (i > 0)
+  802caf:	85 ff                	test   %edi,%edi
+  802cb1:	75 44                	jne    802cf7 <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  802cb3:	89 f2                	mov    %esi,%edx
+  802cb5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802cb8:	e8 90 fd ff ff       	call   802a4d <_pipeisclosed>
+  802cbd:	85 c0                	test   %eax,%eax
+  802cbf:	75 3a                	jne    802cfb <devpipe_read_bulk+0xe0>
+  802cc1:	b8 01 00 00 00       	mov    $0x1,%eax
+  802cc6:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802cca:	6a 64                	push   $0x64
+  802ccc:	ff 75 d4             	push   -0x2c(%ebp)
+  802ccf:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  802cd0:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802cd3:	50                   	push   %eax
+  802cd4:	e8 19 e3 ff ff       	call   800ff2 <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  802cd9:	85 c0                	test   %eax,%eax
+  802cdb:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ce0:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  802ce3:	83 c4 10             	add    $0x10,%esp
+  802ce6:	a8 01                	test   $0x1,%al
+  802ce8:	74 b7                	je     802ca1 <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  802cea:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  802cef:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802cf2:	5b                   	pop    %ebx
+  802cf3:	5e                   	pop    %esi
+  802cf4:	5f                   	pop    %edi
+  802cf5:	5d                   	pop    %ebp
+  802cf6:	c3                   	ret
+  return i;
+  802cf7:	89 f8                	mov    %edi,%eax
+  802cf9:	eb f4                	jmp    802cef <devpipe_read_bulk+0xd4>
+        return 0;
+  802cfb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d00:	eb ed                	jmp    802cef <devpipe_read_bulk+0xd4>
+
+00802d02 <devpipe_read>:
+{
+  802d02:	55                   	push   %ebp
+  802d03:	89 e5                	mov    %esp,%ebp
+  802d05:	57                   	push   %edi
+  802d06:	56                   	push   %esi
+  802d07:	53                   	push   %ebx
+  802d08:	83 ec 18             	sub    $0x18,%esp
+  802d0b:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  802d0e:	57                   	push   %edi
+  802d0f:	e8 64 e4 ff ff       	call   801178 <fd2data>
+  802d14:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  802d16:	8b 70 28             	mov    0x28(%eax),%esi
+  802d19:	83 c4 10             	add    $0x10,%esp
+  802d1c:	85 f6                	test   %esi,%esi
+  802d1e:	75 24                	jne    802d44 <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  802d20:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802d23:	74 60                	je     802d85 <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  802d25:	8b 03                	mov    (%ebx),%eax
+  802d27:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802d2a:	75 3b                	jne    802d67 <devpipe_read+0x65>
+      if (i > 0)
+  802d2c:	85 f6                	test   %esi,%esi
+  802d2e:	75 2d                	jne    802d5d <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  802d30:	89 da                	mov    %ebx,%edx
+  802d32:	89 f8                	mov    %edi,%eax
+  802d34:	e8 14 fd ff ff       	call   802a4d <_pipeisclosed>
+  802d39:	85 c0                	test   %eax,%eax
+  802d3b:	75 4c                	jne    802d89 <devpipe_read+0x87>
+      sys_yield();
+  802d3d:	e8 15 df ff ff       	call   800c57 <sys_yield>
+  802d42:	eb e1                	jmp    802d25 <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  802d44:	83 ec 08             	sub    $0x8,%esp
+  802d47:	6a 00                	push   $0x0
+  802d49:	ff 75 10             	push   0x10(%ebp)
+  802d4c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802d4f:	89 c2                	mov    %eax,%edx
+  802d51:	89 f8                	mov    %edi,%eax
+  802d53:	e8 c3 fe ff ff       	call   802c1b <devpipe_read_bulk>
+  802d58:	83 c4 10             	add    $0x10,%esp
+  802d5b:	eb 02                	jmp    802d5f <devpipe_read+0x5d>
+        return i;
+  802d5d:	89 f0                	mov    %esi,%eax
+}
+  802d5f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d62:	5b                   	pop    %ebx
+  802d63:	5e                   	pop    %esi
+  802d64:	5f                   	pop    %edi
+  802d65:	5d                   	pop    %ebp
+  802d66:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802d67:	99                   	cltd
+  802d68:	c1 ea 1b             	shr    $0x1b,%edx
+  802d6b:	01 d0                	add    %edx,%eax
+  802d6d:	83 e0 1f             	and    $0x1f,%eax
+  802d70:	29 d0                	sub    %edx,%eax
+  802d72:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802d77:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802d7a:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  802d7d:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  802d80:	83 c6 01             	add    $0x1,%esi
+  802d83:	eb 9b                	jmp    802d20 <devpipe_read+0x1e>
+  return i;
+  802d85:	89 f0                	mov    %esi,%eax
+  802d87:	eb d6                	jmp    802d5f <devpipe_read+0x5d>
+        return 0;
+  802d89:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d8e:	eb cf                	jmp    802d5f <devpipe_read+0x5d>
+
+00802d90 <pipe2>:
+{
+  802d90:	55                   	push   %ebp
+  802d91:	89 e5                	mov    %esp,%ebp
+  802d93:	57                   	push   %edi
+  802d94:	56                   	push   %esi
+  802d95:	53                   	push   %ebx
+  802d96:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  802d99:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802d9c:	50                   	push   %eax
+  802d9d:	e8 ea e3 ff ff       	call   80118c <fd_alloc>
+  802da2:	89 c3                	mov    %eax,%ebx
+  802da4:	83 c4 10             	add    $0x10,%esp
+  802da7:	85 c0                	test   %eax,%eax
+  802da9:	0f 88 fb 01 00 00    	js     802faa <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802daf:	83 ec 04             	sub    $0x4,%esp
+  802db2:	68 07 04 00 00       	push   $0x407
+  802db7:	ff 75 e4             	push   -0x1c(%ebp)
+  802dba:	6a 00                	push   $0x0
+  802dbc:	e8 f8 de ff ff       	call   800cb9 <sys_page_alloc>
+  802dc1:	89 c3                	mov    %eax,%ebx
+  802dc3:	83 c4 10             	add    $0x10,%esp
+  802dc6:	85 c0                	test   %eax,%eax
+  802dc8:	0f 88 dc 01 00 00    	js     802faa <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  802dce:	83 ec 0c             	sub    $0xc,%esp
+  802dd1:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  802dd4:	50                   	push   %eax
+  802dd5:	e8 b2 e3 ff ff       	call   80118c <fd_alloc>
+  802dda:	89 c3                	mov    %eax,%ebx
+  802ddc:	83 c4 10             	add    $0x10,%esp
+  802ddf:	85 c0                	test   %eax,%eax
+  802de1:	0f 88 b3 01 00 00    	js     802f9a <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802de7:	83 ec 04             	sub    $0x4,%esp
+  802dea:	68 07 04 00 00       	push   $0x407
+  802def:	ff 75 e0             	push   -0x20(%ebp)
+  802df2:	6a 00                	push   $0x0
+  802df4:	e8 c0 de ff ff       	call   800cb9 <sys_page_alloc>
+  802df9:	89 c3                	mov    %eax,%ebx
+  802dfb:	83 c4 10             	add    $0x10,%esp
+  802dfe:	85 c0                	test   %eax,%eax
+  802e00:	0f 88 94 01 00 00    	js     802f9a <pipe2+0x20a>
+  va = fd2data(fd0);
+  802e06:	83 ec 0c             	sub    $0xc,%esp
+  802e09:	ff 75 e4             	push   -0x1c(%ebp)
+  802e0c:	e8 67 e3 ff ff       	call   801178 <fd2data>
+  802e11:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802e13:	83 c4 0c             	add    $0xc,%esp
+  802e16:	68 07 04 00 00       	push   $0x407
+  802e1b:	50                   	push   %eax
+  802e1c:	6a 00                	push   $0x0
+  802e1e:	e8 96 de ff ff       	call   800cb9 <sys_page_alloc>
+  802e23:	89 c3                	mov    %eax,%ebx
+  802e25:	83 c4 10             	add    $0x10,%esp
+  802e28:	85 c0                	test   %eax,%eax
+  802e2a:	0f 88 5a 01 00 00    	js     802f8a <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802e30:	83 ec 0c             	sub    $0xc,%esp
+  802e33:	ff 75 e0             	push   -0x20(%ebp)
+  802e36:	e8 3d e3 ff ff       	call   801178 <fd2data>
+  802e3b:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802e42:	50                   	push   %eax
+  802e43:	6a 00                	push   $0x0
+  802e45:	57                   	push   %edi
+  802e46:	6a 00                	push   $0x0
+  802e48:	e8 af de ff ff       	call   800cfc <sys_page_map>
+  802e4d:	89 c3                	mov    %eax,%ebx
+  802e4f:	83 c4 20             	add    $0x20,%esp
+  802e52:	85 c0                	test   %eax,%eax
+  802e54:	0f 88 22 01 00 00    	js     802f7c <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  802e5a:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  802e5e:	74 72                	je     802ed2 <pipe2+0x142>
+  802e60:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  802e65:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802e68:	e8 d3 fa ff ff       	call   802940 <pipe_ring>
+  802e6d:	83 ec 04             	sub    $0x4,%esp
+  802e70:	68 07 04 00 00       	push   $0x407
+  802e75:	01 f0                	add    %esi,%eax
+  802e77:	50                   	push   %eax
+  802e78:	6a 00                	push   $0x0
+  802e7a:	e8 3a de ff ff       	call   800cb9 <sys_page_alloc>
+  802e7f:	89 c3                	mov    %eax,%ebx
+  802e81:	83 c4 10             	add    $0x10,%esp
+  802e84:	85 c0                	test   %eax,%eax
+  802e86:	0f 88 97 00 00 00    	js     802f23 <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  802e8c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802e8f:	e8 ac fa ff ff       	call   802940 <pipe_ring>
+  802e94:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  802e97:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802e9a:	e8 a1 fa ff ff       	call   802940 <pipe_ring>
+  802e9f:	83 ec 0c             	sub    $0xc,%esp
+  802ea2:	68 07 04 00 00       	push   $0x407
+  802ea7:	53                   	push   %ebx
+  802ea8:	6a 00                	push   $0x0
+  802eaa:	01 f0                	add    %esi,%eax
+  802eac:	50                   	push   %eax
+  802ead:	6a 00                	push   $0x0
+  802eaf:	e8 48 de ff ff       	call   800cfc <sys_page_map>
+  802eb4:	89 c3                	mov    %eax,%ebx
+  802eb6:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802ebc:	83 c4 20             	add    $0x20,%esp
+  802ebf:	85 c0                	test   %eax,%eax
+  802ec1:	78 60                	js     802f23 <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  802ec3:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802ec9:	75 9a                	jne    802e65 <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  802ecb:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  802ed2:	a1 20 40 80 00       	mov    0x804020,%eax
+  802ed7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802eda:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  802edc:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802edf:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  802ee6:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802ee9:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  802eeb:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802eee:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  802ef5:	83 ec 0c             	sub    $0xc,%esp
+  802ef8:	ff 75 e4             	push   -0x1c(%ebp)
+  802efb:	e8 68 e2 ff ff       	call   801168 <fd2num>
+  802f00:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802f03:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  802f05:	83 c4 04             	add    $0x4,%esp
+  802f08:	ff 75 e0             	push   -0x20(%ebp)
+  802f0b:	e8 58 e2 ff ff       	call   801168 <fd2num>
+  802f10:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802f13:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  802f16:	83 c4 10             	add    $0x10,%esp
+  802f19:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f1e:	e9 87 00 00 00       	jmp    802faa <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802f23:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  802f28:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802f2b:	e8 10 fa ff ff       	call   802940 <pipe_ring>
+  802f30:	83 ec 08             	sub    $0x8,%esp
+  802f33:	01 f0                	add    %esi,%eax
+  802f35:	50                   	push   %eax
+  802f36:	6a 00                	push   $0x0
+  802f38:	e8 01 de ff ff       	call   800d3e <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  802f3d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802f40:	e8 fb f9 ff ff       	call   802940 <pipe_ring>
+  802f45:	83 c4 08             	add    $0x8,%esp
+  802f48:	01 f0                	add    %esi,%eax
+  802f4a:	50                   	push   %eax
+  802f4b:	6a 00                	push   $0x0
+  802f4d:	e8 ec dd ff ff       	call   800d3e <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802f52:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802f58:	83 c4 10             	add    $0x10,%esp
+  802f5b:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802f61:	75 c5                	jne    802f28 <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  802f63:	83 ec 0c             	sub    $0xc,%esp
+  802f66:	ff 75 e0             	push   -0x20(%ebp)
+  802f69:	e8 0a e2 ff ff       	call   801178 <fd2data>
+  802f6e:	83 c4 08             	add    $0x8,%esp
+  802f71:	50                   	push   %eax
+  802f72:	6a 00                	push   $0x0
+  802f74:	e8 c5 dd ff ff       	call   800d3e <sys_page_unmap>
+  802f79:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  802f7c:	83 ec 08             	sub    $0x8,%esp
+  802f7f:	57                   	push   %edi
+  802f80:	6a 00                	push   $0x0
+  802f82:	e8 b7 dd ff ff       	call   800d3e <sys_page_unmap>
+  802f87:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  802f8a:	83 ec 08             	sub    $0x8,%esp
+  802f8d:	ff 75 e0             	push   -0x20(%ebp)
+  802f90:	6a 00                	push   $0x0
+  802f92:	e8 a7 dd ff ff       	call   800d3e <sys_page_unmap>
+  802f97:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  802f9a:	83 ec 08             	sub    $0x8,%esp
+  802f9d:	ff 75 e4             	push   -0x1c(%ebp)
+  802fa0:	6a 00                	push   $0x0
+  802fa2:	e8 97 dd ff ff       	call   800d3e <sys_page_unmap>
+  802fa7:	83 c4 10             	add    $0x10,%esp
+}
+  802faa:	89 d8                	mov    %ebx,%eax
+  802fac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802faf:	5b                   	pop    %ebx
+  802fb0:	5e                   	pop    %esi
+  802fb1:	5f                   	pop    %edi
+  802fb2:	5d                   	pop    %ebp
+  802fb3:	c3                   	ret
+
+00802fb4 <pipe>:
+{
+  802fb4:	55                   	push   %ebp
+  802fb5:	89 e5                	mov    %esp,%ebp
+  802fb7:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  802fba:	6a 00                	push   $0x0
+  802fbc:	ff 75 08             	push   0x8(%ebp)
+  802fbf:	e8 cc fd ff ff       	call   802d90 <pipe2>
+}
+  802fc4:	c9                   	leave
+  802fc5:	c3                   	ret
+
+00802fc6 <pipeisclosed>:
+{
+  802fc6:	55                   	push   %ebp
+  802fc7:	89 e5                	mov    %esp,%ebp
+  802fc9:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802fcc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802fcf:	50                   	push   %eax
+  802fd0:	ff 75 08             	push   0x8(%ebp)
+  802fd3:	e8 0a e2 ff ff       	call   8011e2 <fd_lookup>
+  802fd8:	83 c4 10             	add    $0x10,%esp
+  802fdb:	85 c0                	test   %eax,%eax
+  802fdd:	78 18                	js     802ff7 <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  802fdf:	83 ec 0c             	sub    $0xc,%esp
+  802fe2:	ff 75 f4             	push   -0xc(%ebp)
+  802fe5:	e8 8e e1 ff ff       	call   801178 <fd2data>
+  802fea:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  802fec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802fef:	e8 59 fa ff ff       	call   802a4d <_pipeisclosed>
+  802ff4:	83 c4 10             	add    $0x10,%esp
+}
+  802ff7:	c9                   	leave
+  802ff8:	c3                   	ret
+
+00802ff9 <pipe_splice>:
+{
+  802ff9:	55                   	push   %ebp
+  802ffa:	89 e5                	mov    %esp,%ebp
+  802ffc:	57                   	push   %edi
+  802ffd:	56                   	push   %esi
+  802ffe:	53                   	push   %ebx
+  802fff:	83 ec 34             	sub    $0x34,%esp
+  803002:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803005:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  803008:	50                   	push   %eax
+  803009:	ff 75 08             	push   0x8(%ebp)
+  80300c:	e8 d1 e1 ff ff       	call   8011e2 <fd_lookup>
+  803011:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  803014:	83 c4 10             	add    $0x10,%esp
+  803017:	85 c0                	test   %eax,%eax
+  803019:	0f 88 d7 00 00 00    	js     8030f6 <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  80301f:	83 ec 0c             	sub    $0xc,%esp
+  803022:	ff 75 e4             	push   -0x1c(%ebp)
+  803025:	e8 4e e1 ff ff       	call   801178 <fd2data>
+  80302a:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  80302c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80302f:	83 c4 10             	add    $0x10,%esp
+  803032:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  803038:	39 10                	cmp    %edx,(%eax)
+  80303a:	0f 85 c1 00 00 00    	jne    803101 <pipe_splice+0x108>
+  803040:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  803044:	0f 84 c0 00 00 00    	je     80310a <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  80304a:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  80304e:	0f 84 bf 00 00 00    	je     803113 <pipe_splice+0x11a>
+  803054:	89 f7                	mov    %esi,%edi
+  803056:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  80305c:	0f 85 ba 00 00 00    	jne    80311c <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  803062:	8d 43 04             	lea    0x4(%ebx),%eax
+  803065:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  803068:	eb 38                	jmp    8030a2 <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  80306a:	83 ec 0c             	sub    $0xc,%esp
+  80306d:	68 00 10 00 00       	push   $0x1000
+  803072:	89 f1                	mov    %esi,%ecx
+  803074:	89 da                	mov    %ebx,%edx
+  803076:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803079:	e8 34 fa ff ff       	call   802ab2 <devpipe_write_bulk>
+  80307e:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  803081:	83 c4 10             	add    $0x10,%esp
+  803084:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  803089:	75 53                	jne    8030de <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  80308b:	83 ec 08             	sub    $0x8,%esp
+  80308e:	56                   	push   %esi
+  80308f:	6a 00                	push   $0x0
+  803091:	e8 a8 dc ff ff       	call   800d3e <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  803096:	83 c7 01             	add    $0x1,%edi
+  803099:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80309f:	83 c4 10             	add    $0x10,%esp
+  8030a2:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8030a5:	74 3a                	je     8030e1 <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  8030a7:	8b 03                	mov    (%ebx),%eax
+  8030a9:	39 43 04             	cmp    %eax,0x4(%ebx)
+  8030ac:	75 bc                	jne    80306a <pipe_splice+0x71>
+  8030ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030b3:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  8030b7:	85 c0                	test   %eax,%eax
+  8030b9:	74 af                	je     80306a <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  8030bb:	83 ec 04             	sub    $0x4,%esp
+  8030be:	6a 07                	push   $0x7
+  8030c0:	56                   	push   %esi
+  8030c1:	ff 75 d0             	push   -0x30(%ebp)
+  8030c4:	e8 4c df ff ff       	call   801015 <sys_chan_wakeup>
+  8030c9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8030cc:	83 c4 10             	add    $0x10,%esp
+  8030cf:	85 c0                	test   %eax,%eax
+  8030d1:	79 b8                	jns    80308b <pipe_splice+0x92>
+  8030d3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8030d8:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  8030dc:	eb 8c                	jmp    80306a <pipe_splice+0x71>
+  8030de:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  8030e1:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8030e5:	75 06                	jne    8030ed <pipe_splice+0xf4>
+  8030e7:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  8030eb:	78 09                	js     8030f6 <pipe_splice+0xfd>
+  return i * PGSIZE;
+  8030ed:	8b 45 10             	mov    0x10(%ebp),%eax
+  8030f0:	c1 e0 0c             	shl    $0xc,%eax
+  8030f3:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  8030f6:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8030f9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030fc:	5b                   	pop    %ebx
+  8030fd:	5e                   	pop    %esi
+  8030fe:	5f                   	pop    %edi
+  8030ff:	5d                   	pop    %ebp
+  803100:	c3                   	ret
+    return -E_INVAL;
+  803101:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  803108:	eb ec                	jmp    8030f6 <pipe_splice+0xfd>
+  80310a:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  803111:	eb e3                	jmp    8030f6 <pipe_splice+0xfd>
+  803113:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  80311a:	eb da                	jmp    8030f6 <pipe_splice+0xfd>
+  80311c:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  803123:	eb d1                	jmp    8030f6 <pipe_splice+0xfd>
+
+00803125 <pipe_splice_read>:
+{
+  803125:	55                   	push   %ebp
+  803126:	89 e5                	mov    %esp,%ebp
+  803128:	53                   	push   %ebx
+  803129:	83 ec 1c             	sub    $0x1c,%esp
+  80312c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80312f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803132:	50                   	push   %eax
+  803133:	ff 75 08             	push   0x8(%ebp)
+  803136:	e8 a7 e0 ff ff       	call   8011e2 <fd_lookup>
+  80313b:	83 c4 10             	add    $0x10,%esp
+  80313e:	85 c0                	test   %eax,%eax
+  803140:	78 49                	js     80318b <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  803142:	83 ec 0c             	sub    $0xc,%esp
+  803145:	ff 75 f4             	push   -0xc(%ebp)
+  803148:	e8 2b e0 ff ff       	call   801178 <fd2data>
+  80314d:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  80314f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803152:	83 c4 10             	add    $0x10,%esp
+  803155:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  80315b:	39 08                	cmp    %ecx,(%eax)
+  80315d:	75 31                	jne    803190 <pipe_splice_read+0x6b>
+  80315f:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  803163:	74 32                	je     803197 <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  803165:	8b 48 08             	mov    0x8(%eax),%ecx
+  803168:	83 e1 03             	and    $0x3,%ecx
+  80316b:	83 f9 01             	cmp    $0x1,%ecx
+  80316e:	74 2e                	je     80319e <pipe_splice_read+0x79>
+  803170:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  803176:	75 2d                	jne    8031a5 <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  803178:	83 ec 08             	sub    $0x8,%esp
+  80317b:	53                   	push   %ebx
+  80317c:	68 00 10 00 00       	push   $0x1000
+  803181:	89 d9                	mov    %ebx,%ecx
+  803183:	e8 93 fa ff ff       	call   802c1b <devpipe_read_bulk>
+  803188:	83 c4 10             	add    $0x10,%esp
+}
+  80318b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80318e:	c9                   	leave
+  80318f:	c3                   	ret
+    return -E_INVAL;
+  803190:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803195:	eb f4                	jmp    80318b <pipe_splice_read+0x66>
+  803197:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80319c:	eb ed                	jmp    80318b <pipe_splice_read+0x66>
+  80319e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8031a3:	eb e6                	jmp    80318b <pipe_splice_read+0x66>
+  8031a5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8031aa:	eb df                	jmp    80318b <pipe_splice_read+0x66>
+
+008031ac <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  8031ac:	55                   	push   %ebp
+  8031ad:	89 e5                	mov    %esp,%ebp
+  8031af:	56                   	push   %esi
+  8031b0:	53                   	push   %ebx
+  8031b1:	8b 75 08             	mov    0x8(%ebp),%esi
+  const volatile struct Env *e;
+
+  assert(envid != 0);
+  8031b4:	85 f6                	test   %esi,%esi
+  8031b6:	74 15                	je     8031cd <wait+0x21>
+  e = &envs[ENVX(envid)];
+  8031b8:	89 f0                	mov    %esi,%eax
+  8031ba:	25 ff 03 00 00       	and    $0x3ff,%eax
+  while (e->env_id == envid && e->env_status != ENV_FREE)
+  8031bf:	8d 1c c0             	lea    (%eax,%eax,8),%ebx
+  8031c2:	c1 e3 04             	shl    $0x4,%ebx
+  8031c5:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  8031cb:	eb 1b                	jmp    8031e8 <wait+0x3c>
+  assert(envid != 0);
+  8031cd:	68 e5 3c 80 00       	push   $0x803ce5
+  8031d2:	68 d8 3b 80 00       	push   $0x803bd8
+  8031d7:	6a 09                	push   $0x9
+  8031d9:	68 f0 3c 80 00       	push   $0x803cf0
+  8031de:	e8 de cf ff ff       	call   8001c1 <_panic>
+    sys_yield();
+  8031e3:	e8 6f da ff ff       	call   800c57 <sys_yield>
+  while (e->env_id == envid && e->env_status != ENV_FREE)
+  8031e8:	8b 43 48             	mov    0x48(%ebx),%eax
+  8031eb:	39 f0                	cmp    %esi,%eax
+  8031ed:	75 07                	jne    8031f6 <wait+0x4a>
+  8031ef:	8b 43 54             	mov    0x54(%ebx),%eax
+  8031f2:	85 c0                	test   %eax,%eax
+  8031f4:	75 ed                	jne    8031e3 <wait+0x37>
+}
+  8031f6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8031f9:	5b                   	pop    %ebx
+  8031fa:	5e                   	pop    %esi
+  8031fb:	5d                   	pop    %ebp
+  8031fc:	c3                   	ret
+
+008031fd <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  8031fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  803202:	c3                   	ret
+
+00803203 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803203:	55                   	push   %ebp
+  803204:	89 e5                	mov    %esp,%ebp
+  803206:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  803209:	68 fb 3c 80 00       	push   $0x803cfb
+  80320e:	ff 75 0c             	push   0xc(%ebp)
+  803211:	e8 74 d6 ff ff       	call   80088a <strcpy>
+  return 0;
+}
+  803216:	b8 00 00 00 00       	mov    $0x0,%eax
+  80321b:	c9                   	leave
+  80321c:	c3                   	ret
+
+0080321d <devcons_write>:
+{
+  80321d:	55                   	push   %ebp
+  80321e:	89 e5                	mov    %esp,%ebp
+  803220:	57                   	push   %edi
+  803221:	56                   	push   %esi
+  803222:	53                   	push   %ebx
+  803223:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  803229:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  80322e:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  803234:	eb 2e                	jmp    803264 <devcons_write+0x47>
+    m = n - tot;
+  803236:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803239:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  80323b:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803240:	39 c3                	cmp    %eax,%ebx
+  803242:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  803245:	83 ec 04             	sub    $0x4,%esp
+  803248:	53                   	push   %ebx
+  803249:	89 f0                	mov    %esi,%eax
+  80324b:	03 45 0c             	add    0xc(%ebp),%eax
+  80324e:	50                   	push   %eax
+  80324f:	57                   	push   %edi
+  803250:	e8 bb d7 ff ff       	call   800a10 <memmove>
+    sys_cputs(buf, m);
+  803255:	83 c4 08             	add    $0x8,%esp
+  803258:	53                   	push   %ebx
+  803259:	57                   	push   %edi
+  80325a:	e8 5b d9 ff ff       	call   800bba <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  80325f:	01 de                	add    %ebx,%esi
+  803261:	83 c4 10             	add    $0x10,%esp
+  803264:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803267:	72 cd                	jb     803236 <devcons_write+0x19>
+}
+  803269:	89 f0                	mov    %esi,%eax
+  80326b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80326e:	5b                   	pop    %ebx
+  80326f:	5e                   	pop    %esi
+  803270:	5f                   	pop    %edi
+  803271:	5d                   	pop    %ebp
+  803272:	c3                   	ret
+
+00803273 <devcons_read>:
+{
+  803273:	55                   	push   %ebp
+  803274:	89 e5                	mov    %esp,%ebp
+  803276:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  803279:	b8 00 00 00 00       	mov    $0x0,%eax
+  80327e:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803282:	75 07                	jne    80328b <devcons_read+0x18>
+  803284:	eb 1f                	jmp    8032a5 <devcons_read+0x32>
+    sys_yield();
+  803286:	e8 cc d9 ff ff       	call   800c57 <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  80328b:	e8 48 d9 ff ff       	call   800bd8 <sys_cgetc>
+  803290:	85 c0                	test   %eax,%eax
+  803292:	74 f2                	je     803286 <devcons_read+0x13>
+  if (c < 0)
+  803294:	78 0f                	js     8032a5 <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  803296:	83 f8 04             	cmp    $0x4,%eax
+  803299:	74 0c                	je     8032a7 <devcons_read+0x34>
+  *(char*)vbuf = c;
+  80329b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80329e:	88 02                	mov    %al,(%edx)
+  return 1;
+  8032a0:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8032a5:	c9                   	leave
+  8032a6:	c3                   	ret
+    return 0;
+  8032a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032ac:	eb f7                	jmp    8032a5 <devcons_read+0x32>
+
+008032ae <cputchar>:
+{
+  8032ae:	55                   	push   %ebp
+  8032af:	89 e5                	mov    %esp,%ebp
+  8032b1:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  8032b4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8032b7:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  8032ba:	6a 01                	push   $0x1
+  8032bc:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8032bf:	50                   	push   %eax
+  8032c0:	e8 f5 d8 ff ff       	call   800bba <sys_cputs>
+}
+  8032c5:	83 c4 10             	add    $0x10,%esp
+  8032c8:	c9                   	leave
+  8032c9:	c3                   	ret
+
+008032ca <getchar>:
+{
+  8032ca:	55                   	push   %ebp
+  8032cb:	89 e5                	mov    %esp,%ebp
+  8032cd:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  8032d0:	6a 01                	push   $0x1
+  8032d2:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8032d5:	50                   	push   %eax
+  8032d6:	6a 00                	push   $0x0
+  8032d8:	e8 b0 e1 ff ff       	call   80148d <read>
+  if (r < 0)
+  8032dd:	83 c4 10             	add    $0x10,%esp
+  8032e0:	85 c0                	test   %eax,%eax
+  8032e2:	78 06                	js     8032ea <getchar+0x20>
+  if (r < 1)
+  8032e4:	74 06                	je     8032ec <getchar+0x22>
+  return c;
+  8032e6:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8032ea:	c9                   	leave
+  8032eb:	c3                   	ret
+    return -E_EOF;
+  8032ec:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8032f1:	eb f7                	jmp    8032ea <getchar+0x20>
+
+008032f3 <iscons>:
+{
+  8032f3:	55                   	push   %ebp
+  8032f4:	89 e5                	mov    %esp,%ebp
+  8032f6:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8032f9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8032fc:	50                   	push   %eax
+  8032fd:	ff 75 08             	push   0x8(%ebp)
+  803300:	e8 dd de ff ff       	call   8011e2 <fd_lookup>
+  803305:	83 c4 10             	add    $0x10,%esp
+  803308:	85 c0                	test   %eax,%eax
+  80330a:	78 11                	js     80331d <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  80330c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80330f:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  803315:	39 10                	cmp    %edx,(%eax)
+  803317:	0f 94 c0             	sete   %al
+  80331a:	0f b6 c0             	movzbl %al,%eax
+}
+  80331d:	c9                   	leave
+  80331e:	c3                   	ret
+
+0080331f <opencons>:
+{
+  80331f:	55                   	push   %ebp
+  803320:	89 e5                	mov    %esp,%ebp
+  803322:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  803325:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803328:	50                   	push   %eax
+  803329:	e8 5e de ff ff       	call   80118c <fd_alloc>
+  80332e:	83 c4 10             	add    $0x10,%esp
+  803331:	85 c0                	test   %eax,%eax
+  803333:	78 3a                	js     80336f <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803335:	83 ec 04             	sub    $0x4,%esp
+  803338:	68 07 04 00 00       	push   $0x407
+  80333d:	ff 75 f4             	push   -0xc(%ebp)
+  803340:	6a 00                	push   $0x0
+  803342:	e8 72 d9 ff ff       	call   800cb9 <sys_page_alloc>
+  803347:	83 c4 10             	add    $0x10,%esp
+  80334a:	85 c0                	test   %eax,%eax
+  80334c:	78 21                	js     80336f <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  80334e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803351:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  803357:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  803359:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80335c:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  803363:	83 ec 0c             	sub    $0xc,%esp
+  803366:	50                   	push   %eax
+  803367:	e8 fc dd ff ff       	call   801168 <fd2num>
+  80336c:	83 c4 10             	add    $0x10,%esp
+}
+  80336f:	c9                   	leave
+  803370:	c3                   	ret
+
+00803371 <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  803371:	55                   	push   %ebp
+  803372:	89 e5                	mov    %esp,%ebp
+  803374:	57                   	push   %edi
+  803375:	56                   	push   %esi
+  803376:	53                   	push   %ebx
+  803377:	83 ec 14             	sub    $0x14,%esp
+  80337a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80337d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803380:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803383:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  803386:	85 c0                	test   %eax,%eax
+  803388:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  80338d:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  803390:	ff 33                	push   (%ebx)
+  803392:	50                   	push   %eax
+  803393:	e8 f9 db ff ff       	call   800f91 <sys_ipc_recv>
+  803398:	83 c4 10             	add    $0x10,%esp
+  80339b:	85 c0                	test   %eax,%eax
+  80339d:	78 39                	js     8033d8 <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  80339f:	85 ff                	test   %edi,%edi
+  8033a1:	74 0a                	je     8033ad <ipc_recv_pages+0x3c>
+  8033a3:	a1 64 5e 80 00       	mov    0x805e64,%eax
+  8033a8:	8b 40 7c             	mov    0x7c(%eax),%eax
+  8033ab:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  8033ad:	85 f6                	test   %esi,%esi
+  8033af:	74 0d                	je     8033be <ipc_recv_pages+0x4d>
+  8033b1:	a1 64 5e 80 00       	mov    0x805e64,%eax
+  8033b6:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  8033bc:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  8033be:	a1 64 5e 80 00       	mov    0x805e64,%eax
+  8033c3:	8b 40 74             	mov    0x74(%eax),%eax
+  8033c6:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  8033c8:	a1 64 5e 80 00       	mov    0x805e64,%eax
+  8033cd:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  8033d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033d3:	5b                   	pop    %ebx
+  8033d4:	5e                   	pop    %esi
+  8033d5:	5f                   	pop    %edi
+  8033d6:	5d                   	pop    %ebp
+  8033d7:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  8033d8:	85 ff                	test   %edi,%edi
+  8033da:	74 06                	je     8033e2 <ipc_recv_pages+0x71>
+  8033dc:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  8033e2:	85 f6                	test   %esi,%esi
+  8033e4:	74 06                	je     8033ec <ipc_recv_pages+0x7b>
+  8033e6:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  8033ec:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  8033f2:	eb dc                	jmp    8033d0 <ipc_recv_pages+0x5f>
+
+008033f4 <ipc_recv>:
+{
+  8033f4:	55                   	push   %ebp
+  8033f5:	89 e5                	mov    %esp,%ebp
+  8033f7:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  8033fa:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  803401:	ff 75 10             	push   0x10(%ebp)
+  803404:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803407:	50                   	push   %eax
+  803408:	ff 75 0c             	push   0xc(%ebp)
+  80340b:	ff 75 08             	push   0x8(%ebp)
+  80340e:	e8 5e ff ff ff       	call   803371 <ipc_recv_pages>
+}
+  803413:	c9                   	leave
+  803414:	c3                   	ret
+
+00803415 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  803415:	55                   	push   %ebp
+  803416:	89 e5                	mov    %esp,%ebp
+  803418:	57                   	push   %edi
+  803419:	56                   	push   %esi
+  80341a:	53                   	push   %ebx
+  80341b:	83 ec 0c             	sub    $0xc,%esp
+  80341e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803421:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803424:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  803427:	89 c3                	mov    %eax,%ebx
+  803429:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  80342f:	85 c0                	test   %eax,%eax
+  803431:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  803436:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  803439:	83 ec 0c             	sub    $0xc,%esp
+  80343c:	ff 75 14             	push   0x14(%ebp)
+  80343f:	ff 75 18             	push   0x18(%ebp)
+  803442:	53                   	push   %ebx
+  803443:	56                   	push   %esi
+  803444:	57                   	push   %edi
+  803445:	e8 26 db ff ff       	call   800f70 <sys_ipc_try_send>
+  80344a:	83 c4 20             	add    $0x20,%esp
+  80344d:	85 c0                	test   %eax,%eax
+  80344f:	79 1e                	jns    80346f <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  803451:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803454:	75 07                	jne    80345d <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  803456:	e8 fc d7 ff ff       	call   800c57 <sys_yield>
+  80345b:	eb dc                	jmp    803439 <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  80345d:	50                   	push   %eax
+  80345e:	68 07 3d 80 00       	push   $0x803d07
+  803463:	6a 5c                	push   $0x5c
+  803465:	68 14 3d 80 00       	push   $0x803d14
+  80346a:	e8 52 cd ff ff       	call   8001c1 <_panic>
+  }
+}
+  80346f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803472:	5b                   	pop    %ebx
+  803473:	5e                   	pop    %esi
+  803474:	5f                   	pop    %edi
+  803475:	5d                   	pop    %ebp
+  803476:	c3                   	ret
+
+00803477 <ipc_send>:
+{
+  803477:	55                   	push   %ebp
+  803478:	89 e5                	mov    %esp,%ebp
+  80347a:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  80347d:	ff 75 14             	push   0x14(%ebp)
+  803480:	6a 01                	push   $0x1
+  803482:	ff 75 10             	push   0x10(%ebp)
+  803485:	ff 75 0c             	push   0xc(%ebp)
+  803488:	ff 75 08             	push   0x8(%ebp)
+  80348b:	e8 85 ff ff ff       	call   803415 <ipc_send_pages>
+}
+  803490:	83 c4 20             	add    $0x20,%esp
+  803493:	c9                   	leave
+  803494:	c3                   	ret
+
+00803495 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803495:	55                   	push   %ebp
+  803496:	89 e5                	mov    %esp,%ebp
+  803498:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  80349b:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  8034a0:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8034a3:	c1 e0 04             	shl    $0x4,%eax
+  8034a6:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8034ab:	8b 40 50             	mov    0x50(%eax),%eax
+  8034ae:	39 c8                	cmp    %ecx,%eax
+  8034b0:	74 12                	je     8034c4 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  8034b2:	83 c2 01             	add    $0x1,%edx
+  8034b5:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  8034bb:	75 e3                	jne    8034a0 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  8034bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034c2:	eb 0e                	jmp    8034d2 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  8034c4:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8034c7:	c1 e0 04             	shl    $0x4,%eax
+  8034ca:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8034cf:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8034d2:	5d                   	pop    %ebp
+  8034d3:	c3                   	ret
+
+008034d4 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8034d4:	55                   	push   %ebp
+  8034d5:	89 e5                	mov    %esp,%ebp
+  8034d7:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  8034da:	89 c2                	mov    %eax,%edx
+  8034dc:	c1 ea 16             	shr    $0x16,%edx
+  8034df:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  8034e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  8034eb:	f6 c1 01             	test   $0x1,%cl
+  8034ee:	74 1c                	je     80350c <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  8034f0:	c1 e8 0c             	shr    $0xc,%eax
+  8034f3:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  8034fa:	a8 01                	test   $0x1,%al
+  8034fc:	74 0e                	je     80350c <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  8034fe:	c1 e8 0c             	shr    $0xc,%eax
+  803501:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  803508:	ef 
+  803509:	0f b7 d2             	movzwl %dx,%edx
+}
+  80350c:	89 d0                	mov    %edx,%eax
+  80350e:	5d                   	pop    %ebp
+  80350f:	c3                   	ret
+
+00803510 <udivmod>:
+  803510:	55                   	push   %ebp
+  803511:	57                   	push   %edi
+  803512:	56                   	push   %esi
+  803513:	53                   	push   %ebx
+  803514:	83 ec 14             	sub    $0x14,%esp
+  803517:	8b 74 24 28          	mov    0x28(%esp),%esi
+  80351b:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  80351f:	89 fb                	mov    %edi,%ebx
+  803521:	09 f3                	or     %esi,%ebx
+  803523:	0f 84 88 00 00 00    	je     8035b1 <udivmod+0xa1>
+  803529:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80352e:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  803535:	00 
+  803536:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80353d:	00 
+  80353e:	89 cd                	mov    %ecx,%ebp
+  803540:	89 34 24             	mov    %esi,(%esp)
+  803543:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  803547:	eb 08                	jmp    803551 <udivmod+0x41>
+  803549:	83 ed 01             	sub    $0x1,%ebp
+  80354c:	83 fd ff             	cmp    $0xffffffff,%ebp
+  80354f:	74 6c                	je     8035bd <udivmod+0xad>
+  803551:	89 c3                	mov    %eax,%ebx
+  803553:	89 d6                	mov    %edx,%esi
+  803555:	89 e9                	mov    %ebp,%ecx
+  803557:	0f ad f3             	shrd   %cl,%esi,%ebx
+  80355a:	d3 ee                	shr    %cl,%esi
+  80355c:	f6 c1 20             	test   $0x20,%cl
+  80355f:	74 04                	je     803565 <udivmod+0x55>
+  803561:	89 f3                	mov    %esi,%ebx
+  803563:	31 f6                	xor    %esi,%esi
+  803565:	8b 3c 24             	mov    (%esp),%edi
+  803568:	39 fb                	cmp    %edi,%ebx
+  80356a:	89 f7                	mov    %esi,%edi
+  80356c:	8b 1c 24             	mov    (%esp),%ebx
+  80356f:	8b 74 24 04          	mov    0x4(%esp),%esi
+  803573:	19 f7                	sbb    %esi,%edi
+  803575:	72 d2                	jb     803549 <udivmod+0x39>
+  803577:	89 f7                	mov    %esi,%edi
+  803579:	89 de                	mov    %ebx,%esi
+  80357b:	89 e9                	mov    %ebp,%ecx
+  80357d:	0f a5 f7             	shld   %cl,%esi,%edi
+  803580:	d3 e6                	shl    %cl,%esi
+  803582:	f6 c1 20             	test   $0x20,%cl
+  803585:	74 04                	je     80358b <udivmod+0x7b>
+  803587:	89 f7                	mov    %esi,%edi
+  803589:	31 f6                	xor    %esi,%esi
+  80358b:	29 f0                	sub    %esi,%eax
+  80358d:	19 fa                	sbb    %edi,%edx
+  80358f:	be 01 00 00 00       	mov    $0x1,%esi
+  803594:	bf 00 00 00 00       	mov    $0x0,%edi
+  803599:	0f a5 f7             	shld   %cl,%esi,%edi
+  80359c:	d3 e6                	shl    %cl,%esi
+  80359e:	f6 c1 20             	test   $0x20,%cl
+  8035a1:	74 04                	je     8035a7 <udivmod+0x97>
+  8035a3:	89 f7                	mov    %esi,%edi
+  8035a5:	31 f6                	xor    %esi,%esi
+  8035a7:	09 74 24 08          	or     %esi,0x8(%esp)
+  8035ab:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8035af:	eb 98                	jmp    803549 <udivmod+0x39>
+  8035b1:	89 f0                	mov    %esi,%eax
+  8035b3:	89 fa                	mov    %edi,%edx
+  8035b5:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8035b9:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  8035bd:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  8035c1:	89 01                	mov    %eax,(%ecx)
+  8035c3:	89 51 04             	mov    %edx,0x4(%ecx)
+  8035c6:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8035ca:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8035ce:	83 c4 14             	add    $0x14,%esp
+  8035d1:	5b                   	pop    %ebx
+  8035d2:	5e                   	pop    %esi
+  8035d3:	5f                   	pop    %edi
+  8035d4:	5d                   	pop    %ebp
+  8035d5:	c3                   	ret
+
+008035d6 <__udivdi3>:
+  8035d6:	83 ec 18             	sub    $0x18,%esp
+  8035d9:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8035dd:	50                   	push   %eax
+  8035de:	ff 74 24 2c          	push   0x2c(%esp)
+  8035e2:	ff 74 24 2c          	push   0x2c(%esp)
+  8035e6:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8035ea:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8035ee:	e8 1d ff ff ff       	call   803510 <udivmod>
+  8035f3:	83 c4 24             	add    $0x24,%esp
+  8035f6:	c3                   	ret
+
+008035f7 <__umoddi3>:
+  8035f7:	83 ec 18             	sub    $0x18,%esp
+  8035fa:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8035fe:	50                   	push   %eax
+  8035ff:	ff 74 24 2c          	push   0x2c(%esp)
+  803603:	ff 74 24 2c          	push   0x2c(%esp)
+  803607:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80360b:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80360f:	e8 fc fe ff ff       	call   803510 <udivmod>
+  803614:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803618:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80361c:	83 c4 24             	add    $0x24,%esp
+  80361f:	c3                   	ret
+
+00803620 <__divdi3>:
+  803620:	56                   	push   %esi
+  803621:	53                   	push   %ebx
+  803622:	83 ec 14             	sub    $0x14,%esp
+  803625:	8b 44 24 20          	mov    0x20(%esp),%eax
+  803629:	8b 54 24 24          	mov    0x24(%esp),%edx
+  80362d:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  803631:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  803635:	85 d2                	test   %edx,%edx
+  803637:	78 18                	js     803651 <__divdi3+0x31>
+  803639:	85 db                	test   %ebx,%ebx
+  80363b:	78 3e                	js     80367b <__divdi3+0x5b>
+  80363d:	83 ec 04             	sub    $0x4,%esp
+  803640:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803644:	56                   	push   %esi
+  803645:	53                   	push   %ebx
+  803646:	51                   	push   %ecx
+  803647:	e8 c4 fe ff ff       	call   803510 <udivmod>
+  80364c:	83 c4 10             	add    $0x10,%esp
+  80364f:	eb 24                	jmp    803675 <__divdi3+0x55>
+  803651:	f7 d8                	neg    %eax
+  803653:	83 d2 00             	adc    $0x0,%edx
+  803656:	f7 da                	neg    %edx
+  803658:	85 db                	test   %ebx,%ebx
+  80365a:	78 3a                	js     803696 <__divdi3+0x76>
+  80365c:	83 ec 04             	sub    $0x4,%esp
+  80365f:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803663:	56                   	push   %esi
+  803664:	53                   	push   %ebx
+  803665:	51                   	push   %ecx
+  803666:	e8 a5 fe ff ff       	call   803510 <udivmod>
+  80366b:	83 c4 10             	add    $0x10,%esp
+  80366e:	f7 d8                	neg    %eax
+  803670:	83 d2 00             	adc    $0x0,%edx
+  803673:	f7 da                	neg    %edx
+  803675:	83 c4 14             	add    $0x14,%esp
+  803678:	5b                   	pop    %ebx
+  803679:	5e                   	pop    %esi
+  80367a:	c3                   	ret
+  80367b:	83 ec 04             	sub    $0x4,%esp
+  80367e:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803682:	56                   	push   %esi
+  803683:	f7 d9                	neg    %ecx
+  803685:	83 d3 00             	adc    $0x0,%ebx
+  803688:	f7 db                	neg    %ebx
+  80368a:	53                   	push   %ebx
+  80368b:	51                   	push   %ecx
+  80368c:	e8 7f fe ff ff       	call   803510 <udivmod>
+  803691:	83 c4 10             	add    $0x10,%esp
+  803694:	eb d8                	jmp    80366e <__divdi3+0x4e>
+  803696:	83 ec 04             	sub    $0x4,%esp
+  803699:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80369d:	56                   	push   %esi
+  80369e:	f7 d9                	neg    %ecx
+  8036a0:	83 d3 00             	adc    $0x0,%ebx
+  8036a3:	f7 db                	neg    %ebx
+  8036a5:	53                   	push   %ebx
+  8036a6:	51                   	push   %ecx
+  8036a7:	e8 64 fe ff ff       	call   803510 <udivmod>
+  8036ac:	83 c4 10             	add    $0x10,%esp
+  8036af:	eb c4                	jmp    803675 <__divdi3+0x55>
+
+008036b1 <__moddi3>:
+  8036b1:	55                   	push   %ebp
+  8036b2:	57                   	push   %edi
+  8036b3:	56                   	push   %esi
+  8036b4:	53                   	push   %ebx
+  8036b5:	83 ec 24             	sub    $0x24,%esp
+  8036b8:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8036bc:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8036c0:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  8036c4:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  8036c8:	85 d2                	test   %edx,%edx
+  8036ca:	78 3b                	js     803707 <__moddi3+0x56>
+  8036cc:	83 ec 04             	sub    $0x4,%esp
+  8036cf:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8036d3:	56                   	push   %esi
+  8036d4:	89 ce                	mov    %ecx,%esi
+  8036d6:	f7 de                	neg    %esi
+  8036d8:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8036dc:	89 de                	mov    %ebx,%esi
+  8036de:	83 d6 00             	adc    $0x0,%esi
+  8036e1:	f7 de                	neg    %esi
+  8036e3:	89 74 24 14          	mov    %esi,0x14(%esp)
+  8036e7:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8036eb:	0f 48 f1             	cmovs  %ecx,%esi
+  8036ee:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  8036f3:	53                   	push   %ebx
+  8036f4:	56                   	push   %esi
+  8036f5:	e8 16 fe ff ff       	call   803510 <udivmod>
+  8036fa:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8036fe:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803702:	83 c4 10             	add    $0x10,%esp
+  803705:	eb 47                	jmp    80374e <__moddi3+0x9d>
+  803707:	f7 d8                	neg    %eax
+  803709:	83 d2 00             	adc    $0x0,%edx
+  80370c:	f7 da                	neg    %edx
+  80370e:	83 ec 04             	sub    $0x4,%esp
+  803711:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803715:	56                   	push   %esi
+  803716:	89 cf                	mov    %ecx,%edi
+  803718:	f7 df                	neg    %edi
+  80371a:	89 de                	mov    %ebx,%esi
+  80371c:	83 d6 00             	adc    $0x0,%esi
+  80371f:	f7 de                	neg    %esi
+  803721:	0f 49 cf             	cmovns %edi,%ecx
+  803724:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  803728:	0f 49 de             	cmovns %esi,%ebx
+  80372b:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  80372f:	ff 74 24 0c          	push   0xc(%esp)
+  803733:	ff 74 24 0c          	push   0xc(%esp)
+  803737:	e8 d4 fd ff ff       	call   803510 <udivmod>
+  80373c:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803740:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803744:	f7 d8                	neg    %eax
+  803746:	83 d2 00             	adc    $0x0,%edx
+  803749:	f7 da                	neg    %edx
+  80374b:	83 c4 10             	add    $0x10,%esp
+  80374e:	83 c4 24             	add    $0x24,%esp
+  803751:	5b                   	pop    %ebx
+  803752:	5e                   	pop    %esi
+  803753:	5f                   	pop    %edi
+  803754:	5d                   	pop    %ebp
+  803755:	c3                   	ret
@@ -0,0 +1,7104 @@
+
+obj/user/spawnhello.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 4a 00 00 00       	call   80007b <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 10             	sub    $0x10,%esp
+  int r;
+
+  cprintf("i am parent environment %08x\n", thisenv->env_id);
+  800039:	a1 64 5e 80 00       	mov    0x805e64,%eax
+  80003e:	8b 40 48             	mov    0x48(%eax),%eax
+  800041:	50                   	push   %eax
+  800042:	68 40 36 80 00       	push   $0x803640
+  800047:	e8 77 01 00 00       	call   8001c3 <cprintf>
+  if ((r = spawnl("hello", "hello", 0)) < 0)
+  80004c:	83 c4 0c             	add    $0xc,%esp
+  80004f:	6a 00                	push   $0x0
+  800051:	68 5e 36 80 00       	push   $0x80365e
+  800056:	68 5e 36 80 00       	push   $0x80365e
+  80005b:	e8 72 27 00 00       	call   8027d2 <spawnl>
+  800060:	83 c4 10             	add    $0x10,%esp
+  800063:	85 c0                	test   %eax,%eax
+  800065:	78 02                	js     800069 <umain+0x36>
+    panic("spawn(hello) failed: %e", r);
+}
+  800067:	c9                   	leave
+  800068:	c3                   	ret
+    panic("spawn(hello) failed: %e", r);
+  800069:	50                   	push   %eax
+  80006a:	68 64 36 80 00       	push   $0x803664
+  80006f:	6a 0a                	push   $0xa
+  800071:	68 7c 36 80 00       	push   $0x80367c
+  800076:	e8 6d 00 00 00       	call   8000e8 <_panic>
+
+0080007b <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80007b:	55                   	push   %ebp
+  80007c:	89 e5                	mov    %esp,%ebp
+  80007e:	56                   	push   %esi
+  80007f:	53                   	push   %ebx
+  800080:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800083:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  800086:	c7 05 64 5e 80 00 00 	movl   $0x0,0x805e64
+  80008d:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  800090:	e8 ca 0a 00 00       	call   800b5f <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  800095:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80009a:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80009d:	c1 e0 04             	shl    $0x4,%eax
+  8000a0:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000a5:	a3 64 5e 80 00       	mov    %eax,0x805e64
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8000aa:	85 db                	test   %ebx,%ebx
+  8000ac:	7e 07                	jle    8000b5 <libmain+0x3a>
+    binaryname = argv[0];
+  8000ae:	8b 06                	mov    (%esi),%eax
+  8000b0:	a3 00 40 80 00       	mov    %eax,0x804000
+
+  // call user main routine
+  umain(argc, argv);
+  8000b5:	83 ec 08             	sub    $0x8,%esp
+  8000b8:	56                   	push   %esi
+  8000b9:	53                   	push   %ebx
+  8000ba:	e8 74 ff ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  8000bf:	e8 0a 00 00 00       	call   8000ce <exit>
+}
+  8000c4:	83 c4 10             	add    $0x10,%esp
+  8000c7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000ca:	5b                   	pop    %ebx
+  8000cb:	5e                   	pop    %esi
+  8000cc:	5d                   	pop    %ebp
+  8000cd:	c3                   	ret
+
+008000ce <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8000ce:	55                   	push   %ebp
+  8000cf:	89 e5                	mov    %esp,%ebp
+  8000d1:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  8000d4:	e8 80 11 00 00       	call   801259 <close_all>
+  sys_env_destroy(0);
+  8000d9:	83 ec 0c             	sub    $0xc,%esp
+  8000dc:	6a 00                	push   $0x0
+  8000de:	e8 3b 0a 00 00       	call   800b1e <sys_env_destroy>
+}
+  8000e3:	83 c4 10             	add    $0x10,%esp
+  8000e6:	c9                   	leave
+  8000e7:	c3                   	ret
+
+008000e8 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8000e8:	55                   	push   %ebp
+  8000e9:	89 e5                	mov    %esp,%ebp
+  8000eb:	56                   	push   %esi
+  8000ec:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  8000ed:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  8000f0:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  8000f6:	e8 64 0a 00 00       	call   800b5f <sys_getenvid>
+  8000fb:	83 ec 0c             	sub    $0xc,%esp
+  8000fe:	ff 75 0c             	push   0xc(%ebp)
+  800101:	ff 75 08             	push   0x8(%ebp)
+  800104:	56                   	push   %esi
+  800105:	50                   	push   %eax
+  800106:	68 98 36 80 00       	push   $0x803698
+  80010b:	e8 b3 00 00 00       	call   8001c3 <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  800110:	83 c4 18             	add    $0x18,%esp
+  800113:	53                   	push   %ebx
+  800114:	ff 75 10             	push   0x10(%ebp)
+  800117:	e8 56 00 00 00       	call   800172 <vcprintf>
+  cprintf("\n");
+  80011c:	c7 04 24 5d 3b 80 00 	movl   $0x803b5d,(%esp)
+  800123:	e8 9b 00 00 00       	call   8001c3 <cprintf>
+  800128:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  80012b:	cc                   	int3
+  while (1)
+  80012c:	eb fd                	jmp    80012b <_panic+0x43>
+
+0080012e <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80012e:	55                   	push   %ebp
+  80012f:	89 e5                	mov    %esp,%ebp
+  800131:	53                   	push   %ebx
+  800132:	83 ec 04             	sub    $0x4,%esp
+  800135:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  800138:	8b 13                	mov    (%ebx),%edx
+  80013a:	8d 42 01             	lea    0x1(%edx),%eax
+  80013d:	89 03                	mov    %eax,(%ebx)
+  80013f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800142:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  800146:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80014b:	74 09                	je     800156 <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  80014d:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800151:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800154:	c9                   	leave
+  800155:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  800156:	83 ec 08             	sub    $0x8,%esp
+  800159:	68 ff 00 00 00       	push   $0xff
+  80015e:	8d 43 08             	lea    0x8(%ebx),%eax
+  800161:	50                   	push   %eax
+  800162:	e8 7a 09 00 00       	call   800ae1 <sys_cputs>
+    b->idx = 0;
+  800167:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80016d:	83 c4 10             	add    $0x10,%esp
+  800170:	eb db                	jmp    80014d <putch+0x1f>
+
+00800172 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800172:	55                   	push   %ebp
+  800173:	89 e5                	mov    %esp,%ebp
+  800175:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  80017b:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800182:	00 00 00 
+  b.cnt = 0;
+  800185:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80018c:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  80018f:	ff 75 0c             	push   0xc(%ebp)
+  800192:	ff 75 08             	push   0x8(%ebp)
+  800195:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80019b:	50                   	push   %eax
+  80019c:	68 2e 01 80 00       	push   $0x80012e
+  8001a1:	e8 14 01 00 00       	call   8002ba <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  8001a6:	83 c4 08             	add    $0x8,%esp
+  8001a9:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001af:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001b5:	50                   	push   %eax
+  8001b6:	e8 26 09 00 00       	call   800ae1 <sys_cputs>
+
+  return b.cnt;
+}
+  8001bb:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001c1:	c9                   	leave
+  8001c2:	c3                   	ret
+
+008001c3 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8001c3:	55                   	push   %ebp
+  8001c4:	89 e5                	mov    %esp,%ebp
+  8001c6:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  8001c9:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  8001cc:	50                   	push   %eax
+  8001cd:	ff 75 08             	push   0x8(%ebp)
+  8001d0:	e8 9d ff ff ff       	call   800172 <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  8001d5:	c9                   	leave
+  8001d6:	c3                   	ret
+
+008001d7 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  8001d7:	55                   	push   %ebp
+  8001d8:	89 e5                	mov    %esp,%ebp
+  8001da:	57                   	push   %edi
+  8001db:	56                   	push   %esi
+  8001dc:	53                   	push   %ebx
+  8001dd:	83 ec 1c             	sub    $0x1c,%esp
+  8001e0:	89 c7                	mov    %eax,%edi
+  8001e2:	89 d6                	mov    %edx,%esi
+  8001e4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001e7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8001ea:	89 d1                	mov    %edx,%ecx
+  8001ec:	89 c2                	mov    %eax,%edx
+  8001ee:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001f1:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001f4:	8b 45 10             	mov    0x10(%ebp),%eax
+  8001f7:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  8001fa:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001fd:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800204:	39 c2                	cmp    %eax,%edx
+  800206:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800209:	72 3e                	jb     800249 <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  80020b:	83 ec 0c             	sub    $0xc,%esp
+  80020e:	ff 75 18             	push   0x18(%ebp)
+  800211:	83 eb 01             	sub    $0x1,%ebx
+  800214:	53                   	push   %ebx
+  800215:	50                   	push   %eax
+  800216:	83 ec 08             	sub    $0x8,%esp
+  800219:	ff 75 e4             	push   -0x1c(%ebp)
+  80021c:	ff 75 e0             	push   -0x20(%ebp)
+  80021f:	ff 75 dc             	push   -0x24(%ebp)
+  800222:	ff 75 d8             	push   -0x28(%ebp)
+  800225:	e8 82 32 00 00       	call   8034ac <__udivdi3>
+  80022a:	83 c4 18             	add    $0x18,%esp
+  80022d:	52                   	push   %edx
+  80022e:	50                   	push   %eax
+  80022f:	89 f2                	mov    %esi,%edx
+  800231:	89 f8                	mov    %edi,%eax
+  800233:	e8 9f ff ff ff       	call   8001d7 <printnum>
+  800238:	83 c4 20             	add    $0x20,%esp
+  80023b:	eb 13                	jmp    800250 <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  80023d:	83 ec 08             	sub    $0x8,%esp
+  800240:	56                   	push   %esi
+  800241:	ff 75 18             	push   0x18(%ebp)
+  800244:	ff d7                	call   *%edi
+  800246:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  800249:	83 eb 01             	sub    $0x1,%ebx
+  80024c:	85 db                	test   %ebx,%ebx
+  80024e:	7f ed                	jg     80023d <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  800250:	83 ec 08             	sub    $0x8,%esp
+  800253:	56                   	push   %esi
+  800254:	83 ec 04             	sub    $0x4,%esp
+  800257:	ff 75 e4             	push   -0x1c(%ebp)
+  80025a:	ff 75 e0             	push   -0x20(%ebp)
+  80025d:	ff 75 dc             	push   -0x24(%ebp)
+  800260:	ff 75 d8             	push   -0x28(%ebp)
+  800263:	e8 65 32 00 00       	call   8034cd <__umoddi3>
+  800268:	83 c4 14             	add    $0x14,%esp
+  80026b:	0f be 80 bb 36 80 00 	movsbl 0x8036bb(%eax),%eax
+  800272:	50                   	push   %eax
+  800273:	ff d7                	call   *%edi
+}
+  800275:	83 c4 10             	add    $0x10,%esp
+  800278:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80027b:	5b                   	pop    %ebx
+  80027c:	5e                   	pop    %esi
+  80027d:	5f                   	pop    %edi
+  80027e:	5d                   	pop    %ebp
+  80027f:	c3                   	ret
+
+00800280 <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800280:	55                   	push   %ebp
+  800281:	89 e5                	mov    %esp,%ebp
+  800283:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  800286:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  80028a:	8b 10                	mov    (%eax),%edx
+  80028c:	3b 50 04             	cmp    0x4(%eax),%edx
+  80028f:	73 0a                	jae    80029b <sprintputch+0x1b>
+    *b->buf++ = ch;
+  800291:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800294:	89 08                	mov    %ecx,(%eax)
+  800296:	8b 45 08             	mov    0x8(%ebp),%eax
+  800299:	88 02                	mov    %al,(%edx)
+}
+  80029b:	5d                   	pop    %ebp
+  80029c:	c3                   	ret
+
+0080029d <printfmt>:
+{
+  80029d:	55                   	push   %ebp
+  80029e:	89 e5                	mov    %esp,%ebp
+  8002a0:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  8002a3:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  8002a6:	50                   	push   %eax
+  8002a7:	ff 75 10             	push   0x10(%ebp)
+  8002aa:	ff 75 0c             	push   0xc(%ebp)
+  8002ad:	ff 75 08             	push   0x8(%ebp)
+  8002b0:	e8 05 00 00 00       	call   8002ba <vprintfmt>
+}
+  8002b5:	83 c4 10             	add    $0x10,%esp
+  8002b8:	c9                   	leave
+  8002b9:	c3                   	ret
+
+008002ba <vprintfmt>:
+{
+  8002ba:	55                   	push   %ebp
+  8002bb:	89 e5                	mov    %esp,%ebp
+  8002bd:	57                   	push   %edi
+  8002be:	56                   	push   %esi
+  8002bf:	53                   	push   %ebx
+  8002c0:	83 ec 2c             	sub    $0x2c,%esp
+  8002c3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8002c6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8002c9:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8002cc:	eb 0a                	jmp    8002d8 <vprintfmt+0x1e>
+      putch(ch, putdat);
+  8002ce:	83 ec 08             	sub    $0x8,%esp
+  8002d1:	53                   	push   %ebx
+  8002d2:	50                   	push   %eax
+  8002d3:	ff d6                	call   *%esi
+  8002d5:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  8002d8:	83 c7 01             	add    $0x1,%edi
+  8002db:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8002df:	83 f8 25             	cmp    $0x25,%eax
+  8002e2:	74 0c                	je     8002f0 <vprintfmt+0x36>
+      if (ch == '\0')
+  8002e4:	85 c0                	test   %eax,%eax
+  8002e6:	75 e6                	jne    8002ce <vprintfmt+0x14>
+}
+  8002e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002eb:	5b                   	pop    %ebx
+  8002ec:	5e                   	pop    %esi
+  8002ed:	5f                   	pop    %edi
+  8002ee:	5d                   	pop    %ebp
+  8002ef:	c3                   	ret
+    padc = ' ';
+  8002f0:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  8002f4:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  8002fb:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  800302:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  800309:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  80030e:	8d 47 01             	lea    0x1(%edi),%eax
+  800311:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800314:	0f b6 17             	movzbl (%edi),%edx
+  800317:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80031a:	3c 55                	cmp    $0x55,%al
+  80031c:	0f 87 cf 03 00 00    	ja     8006f1 <vprintfmt+0x437>
+  800322:	0f b6 c0             	movzbl %al,%eax
+  800325:	ff 24 85 00 38 80 00 	jmp    *0x803800(,%eax,4)
+  80032c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  80032f:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800333:	eb d9                	jmp    80030e <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  800335:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800338:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80033c:	eb d0                	jmp    80030e <vprintfmt+0x54>
+  80033e:	0f b6 d2             	movzbl %dl,%edx
+  800341:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  800344:	b8 00 00 00 00       	mov    $0x0,%eax
+  800349:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  80034c:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80034f:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  800353:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  800356:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800359:	83 f9 09             	cmp    $0x9,%ecx
+  80035c:	77 55                	ja     8003b3 <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  80035e:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  800361:	eb e9                	jmp    80034c <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  800363:	8b 45 14             	mov    0x14(%ebp),%eax
+  800366:	8b 00                	mov    (%eax),%eax
+  800368:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80036b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80036e:	8d 40 04             	lea    0x4(%eax),%eax
+  800371:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  800374:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  800377:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80037b:	79 91                	jns    80030e <vprintfmt+0x54>
+        width = precision, precision = -1;
+  80037d:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800380:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800383:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80038a:	eb 82                	jmp    80030e <vprintfmt+0x54>
+      if (width < 0)
+  80038c:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80038f:	85 d2                	test   %edx,%edx
+  800391:	b8 00 00 00 00       	mov    $0x0,%eax
+  800396:	0f 49 c2             	cmovns %edx,%eax
+  800399:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  80039c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  80039f:	e9 6a ff ff ff       	jmp    80030e <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  8003a4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  8003a7:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  8003ae:	e9 5b ff ff ff       	jmp    80030e <vprintfmt+0x54>
+  8003b3:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003b6:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003b9:	eb bc                	jmp    800377 <vprintfmt+0xbd>
+      lflag++;
+  8003bb:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  8003be:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  8003c1:	e9 48 ff ff ff       	jmp    80030e <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  8003c6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003c9:	8d 78 04             	lea    0x4(%eax),%edi
+  8003cc:	83 ec 08             	sub    $0x8,%esp
+  8003cf:	53                   	push   %ebx
+  8003d0:	ff 30                	push   (%eax)
+  8003d2:	ff d6                	call   *%esi
+      break;
+  8003d4:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  8003d7:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  8003da:	e9 b1 02 00 00       	jmp    800690 <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  8003df:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003e2:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  8003e5:	8b 10                	mov    (%eax),%edx
+  8003e7:	89 d0                	mov    %edx,%eax
+  8003e9:	f7 d8                	neg    %eax
+  8003eb:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8003ee:	83 f8 10             	cmp    $0x10,%eax
+  8003f1:	7f 23                	jg     800416 <vprintfmt+0x15c>
+  8003f3:	8b 14 85 60 39 80 00 	mov    0x803960(,%eax,4),%edx
+  8003fa:	85 d2                	test   %edx,%edx
+  8003fc:	74 18                	je     800416 <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  8003fe:	52                   	push   %edx
+  8003ff:	68 aa 3a 80 00       	push   $0x803aaa
+  800404:	53                   	push   %ebx
+  800405:	56                   	push   %esi
+  800406:	e8 92 fe ff ff       	call   80029d <printfmt>
+  80040b:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  80040e:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800411:	e9 7a 02 00 00       	jmp    800690 <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  800416:	50                   	push   %eax
+  800417:	68 d3 36 80 00       	push   $0x8036d3
+  80041c:	53                   	push   %ebx
+  80041d:	56                   	push   %esi
+  80041e:	e8 7a fe ff ff       	call   80029d <printfmt>
+  800423:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  800426:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  800429:	e9 62 02 00 00       	jmp    800690 <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  80042e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800431:	83 c0 04             	add    $0x4,%eax
+  800434:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800437:	8b 45 14             	mov    0x14(%ebp),%eax
+  80043a:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  80043c:	85 c9                	test   %ecx,%ecx
+  80043e:	b8 cc 36 80 00       	mov    $0x8036cc,%eax
+  800443:	0f 45 c1             	cmovne %ecx,%eax
+  800446:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  800449:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80044d:	7e 06                	jle    800455 <vprintfmt+0x19b>
+  80044f:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800453:	75 0b                	jne    800460 <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800455:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800458:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80045b:	89 75 08             	mov    %esi,0x8(%ebp)
+  80045e:	eb 5c                	jmp    8004bc <vprintfmt+0x202>
+  800460:	83 ec 08             	sub    $0x8,%esp
+  800463:	ff 75 d0             	push   -0x30(%ebp)
+  800466:	ff 75 cc             	push   -0x34(%ebp)
+  800469:	e8 20 03 00 00       	call   80078e <strnlen>
+  80046e:	89 c2                	mov    %eax,%edx
+  800470:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800473:	29 d0                	sub    %edx,%eax
+  800475:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  800478:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80047c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80047f:	89 75 08             	mov    %esi,0x8(%ebp)
+  800482:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800484:	eb 0e                	jmp    800494 <vprintfmt+0x1da>
+          putch(padc, putdat);
+  800486:	83 ec 08             	sub    $0x8,%esp
+  800489:	53                   	push   %ebx
+  80048a:	57                   	push   %edi
+  80048b:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  80048e:	83 ee 01             	sub    $0x1,%esi
+  800491:	83 c4 10             	add    $0x10,%esp
+  800494:	85 f6                	test   %esi,%esi
+  800496:	7f ee                	jg     800486 <vprintfmt+0x1cc>
+  800498:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80049b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80049e:	85 c0                	test   %eax,%eax
+  8004a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004a5:	0f 49 d0             	cmovns %eax,%edx
+  8004a8:	29 d0                	sub    %edx,%eax
+  8004aa:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004ad:	eb a6                	jmp    800455 <vprintfmt+0x19b>
+          putch(ch, putdat);
+  8004af:	83 ec 08             	sub    $0x8,%esp
+  8004b2:	53                   	push   %ebx
+  8004b3:	52                   	push   %edx
+  8004b4:	ff 55 08             	call   *0x8(%ebp)
+  8004b7:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8004ba:	89 f1                	mov    %esi,%ecx
+  8004bc:	8d 71 01             	lea    0x1(%ecx),%esi
+  8004bf:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004c3:	0f be d0             	movsbl %al,%edx
+  8004c6:	85 d2                	test   %edx,%edx
+  8004c8:	74 28                	je     8004f2 <vprintfmt+0x238>
+  8004ca:	85 ff                	test   %edi,%edi
+  8004cc:	78 05                	js     8004d3 <vprintfmt+0x219>
+  8004ce:	83 ef 01             	sub    $0x1,%edi
+  8004d1:	78 30                	js     800503 <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  8004d3:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8004d7:	74 d6                	je     8004af <vprintfmt+0x1f5>
+  8004d9:	0f be c0             	movsbl %al,%eax
+  8004dc:	83 e8 20             	sub    $0x20,%eax
+  8004df:	83 f8 5e             	cmp    $0x5e,%eax
+  8004e2:	76 cb                	jbe    8004af <vprintfmt+0x1f5>
+          putch('?', putdat);
+  8004e4:	83 ec 08             	sub    $0x8,%esp
+  8004e7:	53                   	push   %ebx
+  8004e8:	6a 3f                	push   $0x3f
+  8004ea:	ff 55 08             	call   *0x8(%ebp)
+  8004ed:	83 c4 10             	add    $0x10,%esp
+  8004f0:	eb c8                	jmp    8004ba <vprintfmt+0x200>
+  8004f2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004f5:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8004f8:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004fb:	01 d0                	add    %edx,%eax
+  8004fd:	29 c8                	sub    %ecx,%eax
+  8004ff:	89 c7                	mov    %eax,%edi
+  800501:	eb 13                	jmp    800516 <vprintfmt+0x25c>
+  800503:	8b 75 08             	mov    0x8(%ebp),%esi
+  800506:	eb ed                	jmp    8004f5 <vprintfmt+0x23b>
+        putch(' ', putdat);
+  800508:	83 ec 08             	sub    $0x8,%esp
+  80050b:	53                   	push   %ebx
+  80050c:	6a 20                	push   $0x20
+  80050e:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  800510:	83 ef 01             	sub    $0x1,%edi
+  800513:	83 c4 10             	add    $0x10,%esp
+  800516:	85 ff                	test   %edi,%edi
+  800518:	7f ee                	jg     800508 <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  80051a:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80051d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800520:	e9 6b 01 00 00       	jmp    800690 <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  800525:	83 f9 01             	cmp    $0x1,%ecx
+  800528:	7f 1f                	jg     800549 <vprintfmt+0x28f>
+  else if (lflag)
+  80052a:	85 c9                	test   %ecx,%ecx
+  80052c:	74 67                	je     800595 <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  80052e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800531:	8b 00                	mov    (%eax),%eax
+  800533:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800536:	89 c1                	mov    %eax,%ecx
+  800538:	c1 f9 1f             	sar    $0x1f,%ecx
+  80053b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80053e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800541:	8d 40 04             	lea    0x4(%eax),%eax
+  800544:	89 45 14             	mov    %eax,0x14(%ebp)
+  800547:	eb 17                	jmp    800560 <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  800549:	8b 45 14             	mov    0x14(%ebp),%eax
+  80054c:	8b 50 04             	mov    0x4(%eax),%edx
+  80054f:	8b 00                	mov    (%eax),%eax
+  800551:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800554:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800557:	8b 45 14             	mov    0x14(%ebp),%eax
+  80055a:	8d 40 08             	lea    0x8(%eax),%eax
+  80055d:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  800560:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800563:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  800566:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  80056b:	85 c9                	test   %ecx,%ecx
+  80056d:	0f 89 03 01 00 00    	jns    800676 <vprintfmt+0x3bc>
+        putch('-', putdat);
+  800573:	83 ec 08             	sub    $0x8,%esp
+  800576:	53                   	push   %ebx
+  800577:	6a 2d                	push   $0x2d
+  800579:	ff d6                	call   *%esi
+        num = -(long long)num;
+  80057b:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80057e:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800581:	f7 da                	neg    %edx
+  800583:	83 d1 00             	adc    $0x0,%ecx
+  800586:	f7 d9                	neg    %ecx
+  800588:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  80058b:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800590:	e9 e1 00 00 00       	jmp    800676 <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  800595:	8b 45 14             	mov    0x14(%ebp),%eax
+  800598:	8b 00                	mov    (%eax),%eax
+  80059a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80059d:	89 c1                	mov    %eax,%ecx
+  80059f:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005a2:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005a5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a8:	8d 40 04             	lea    0x4(%eax),%eax
+  8005ab:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005ae:	eb b0                	jmp    800560 <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  8005b0:	83 f9 01             	cmp    $0x1,%ecx
+  8005b3:	7f 1e                	jg     8005d3 <vprintfmt+0x319>
+  else if (lflag)
+  8005b5:	85 c9                	test   %ecx,%ecx
+  8005b7:	74 32                	je     8005eb <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  8005b9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005bc:	8b 10                	mov    (%eax),%edx
+  8005be:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005c3:	8d 40 04             	lea    0x4(%eax),%eax
+  8005c6:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  8005c9:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  8005ce:	e9 a3 00 00 00       	jmp    800676 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  8005d3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005d6:	8b 10                	mov    (%eax),%edx
+  8005d8:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005db:	8d 40 08             	lea    0x8(%eax),%eax
+  8005de:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  8005e1:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  8005e6:	e9 8b 00 00 00       	jmp    800676 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8005eb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ee:	8b 10                	mov    (%eax),%edx
+  8005f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005f5:	8d 40 04             	lea    0x4(%eax),%eax
+  8005f8:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  8005fb:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  800600:	eb 74                	jmp    800676 <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  800602:	83 f9 01             	cmp    $0x1,%ecx
+  800605:	7f 1b                	jg     800622 <vprintfmt+0x368>
+  else if (lflag)
+  800607:	85 c9                	test   %ecx,%ecx
+  800609:	74 2c                	je     800637 <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  80060b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80060e:	8b 10                	mov    (%eax),%edx
+  800610:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800615:	8d 40 04             	lea    0x4(%eax),%eax
+  800618:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  80061b:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  800620:	eb 54                	jmp    800676 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800622:	8b 45 14             	mov    0x14(%ebp),%eax
+  800625:	8b 10                	mov    (%eax),%edx
+  800627:	8b 48 04             	mov    0x4(%eax),%ecx
+  80062a:	8d 40 08             	lea    0x8(%eax),%eax
+  80062d:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800630:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  800635:	eb 3f                	jmp    800676 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800637:	8b 45 14             	mov    0x14(%ebp),%eax
+  80063a:	8b 10                	mov    (%eax),%edx
+  80063c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800641:	8d 40 04             	lea    0x4(%eax),%eax
+  800644:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800647:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  80064c:	eb 28                	jmp    800676 <vprintfmt+0x3bc>
+      putch('0', putdat);
+  80064e:	83 ec 08             	sub    $0x8,%esp
+  800651:	53                   	push   %ebx
+  800652:	6a 30                	push   $0x30
+  800654:	ff d6                	call   *%esi
+      putch('x', putdat);
+  800656:	83 c4 08             	add    $0x8,%esp
+  800659:	53                   	push   %ebx
+  80065a:	6a 78                	push   $0x78
+  80065c:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  80065e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800661:	8b 10                	mov    (%eax),%edx
+  800663:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  800668:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  80066b:	8d 40 04             	lea    0x4(%eax),%eax
+  80066e:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800671:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  800676:	83 ec 0c             	sub    $0xc,%esp
+  800679:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80067d:	50                   	push   %eax
+  80067e:	ff 75 e0             	push   -0x20(%ebp)
+  800681:	57                   	push   %edi
+  800682:	51                   	push   %ecx
+  800683:	52                   	push   %edx
+  800684:	89 da                	mov    %ebx,%edx
+  800686:	89 f0                	mov    %esi,%eax
+  800688:	e8 4a fb ff ff       	call   8001d7 <printnum>
+      break;
+  80068d:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  800690:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  800693:	e9 40 fc ff ff       	jmp    8002d8 <vprintfmt+0x1e>
+  if (lflag >= 2)
+  800698:	83 f9 01             	cmp    $0x1,%ecx
+  80069b:	7f 1b                	jg     8006b8 <vprintfmt+0x3fe>
+  else if (lflag)
+  80069d:	85 c9                	test   %ecx,%ecx
+  80069f:	74 2c                	je     8006cd <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  8006a1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a4:	8b 10                	mov    (%eax),%edx
+  8006a6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006ab:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ae:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8006b1:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  8006b6:	eb be                	jmp    800676 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  8006b8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006bb:	8b 10                	mov    (%eax),%edx
+  8006bd:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006c0:	8d 40 08             	lea    0x8(%eax),%eax
+  8006c3:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8006c6:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  8006cb:	eb a9                	jmp    800676 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8006cd:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d0:	8b 10                	mov    (%eax),%edx
+  8006d2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006d7:	8d 40 04             	lea    0x4(%eax),%eax
+  8006da:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8006dd:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  8006e2:	eb 92                	jmp    800676 <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  8006e4:	83 ec 08             	sub    $0x8,%esp
+  8006e7:	53                   	push   %ebx
+  8006e8:	6a 25                	push   $0x25
+  8006ea:	ff d6                	call   *%esi
+      break;
+  8006ec:	83 c4 10             	add    $0x10,%esp
+  8006ef:	eb 9f                	jmp    800690 <vprintfmt+0x3d6>
+      putch('%', putdat);
+  8006f1:	83 ec 08             	sub    $0x8,%esp
+  8006f4:	53                   	push   %ebx
+  8006f5:	6a 25                	push   $0x25
+  8006f7:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  8006f9:	83 c4 10             	add    $0x10,%esp
+  8006fc:	89 f8                	mov    %edi,%eax
+  8006fe:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800702:	74 05                	je     800709 <vprintfmt+0x44f>
+  800704:	83 e8 01             	sub    $0x1,%eax
+  800707:	eb f5                	jmp    8006fe <vprintfmt+0x444>
+  800709:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80070c:	eb 82                	jmp    800690 <vprintfmt+0x3d6>
+
+0080070e <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80070e:	55                   	push   %ebp
+  80070f:	89 e5                	mov    %esp,%ebp
+  800711:	83 ec 18             	sub    $0x18,%esp
+  800714:	8b 45 08             	mov    0x8(%ebp),%eax
+  800717:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  80071a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80071d:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800721:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800724:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  80072b:	85 c0                	test   %eax,%eax
+  80072d:	74 26                	je     800755 <vsnprintf+0x47>
+  80072f:	85 d2                	test   %edx,%edx
+  800731:	7e 22                	jle    800755 <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800733:	ff 75 14             	push   0x14(%ebp)
+  800736:	ff 75 10             	push   0x10(%ebp)
+  800739:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80073c:	50                   	push   %eax
+  80073d:	68 80 02 80 00       	push   $0x800280
+  800742:	e8 73 fb ff ff       	call   8002ba <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800747:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80074a:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  80074d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800750:	83 c4 10             	add    $0x10,%esp
+}
+  800753:	c9                   	leave
+  800754:	c3                   	ret
+    return -E_INVAL;
+  800755:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80075a:	eb f7                	jmp    800753 <vsnprintf+0x45>
+
+0080075c <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80075c:	55                   	push   %ebp
+  80075d:	89 e5                	mov    %esp,%ebp
+  80075f:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  800762:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  800765:	50                   	push   %eax
+  800766:	ff 75 10             	push   0x10(%ebp)
+  800769:	ff 75 0c             	push   0xc(%ebp)
+  80076c:	ff 75 08             	push   0x8(%ebp)
+  80076f:	e8 9a ff ff ff       	call   80070e <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  800774:	c9                   	leave
+  800775:	c3                   	ret
+
+00800776 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800776:	55                   	push   %ebp
+  800777:	89 e5                	mov    %esp,%ebp
+  800779:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  80077c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800781:	eb 03                	jmp    800786 <strlen+0x10>
+    n++;
+  800783:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  800786:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80078a:	75 f7                	jne    800783 <strlen+0xd>
+  return n;
+}
+  80078c:	5d                   	pop    %ebp
+  80078d:	c3                   	ret
+
+0080078e <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  80078e:	55                   	push   %ebp
+  80078f:	89 e5                	mov    %esp,%ebp
+  800791:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800794:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800797:	b8 00 00 00 00       	mov    $0x0,%eax
+  80079c:	eb 03                	jmp    8007a1 <strnlen+0x13>
+    n++;
+  80079e:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007a1:	39 d0                	cmp    %edx,%eax
+  8007a3:	74 08                	je     8007ad <strnlen+0x1f>
+  8007a5:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8007a9:	75 f3                	jne    80079e <strnlen+0x10>
+  8007ab:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  8007ad:	89 d0                	mov    %edx,%eax
+  8007af:	5d                   	pop    %ebp
+  8007b0:	c3                   	ret
+
+008007b1 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8007b1:	55                   	push   %ebp
+  8007b2:	89 e5                	mov    %esp,%ebp
+  8007b4:	53                   	push   %ebx
+  8007b5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007b8:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  8007bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007c0:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8007c4:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8007c7:	83 c0 01             	add    $0x1,%eax
+  8007ca:	84 d2                	test   %dl,%dl
+  8007cc:	75 f2                	jne    8007c0 <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  8007ce:	89 c8                	mov    %ecx,%eax
+  8007d0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007d3:	c9                   	leave
+  8007d4:	c3                   	ret
+
+008007d5 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8007d5:	55                   	push   %ebp
+  8007d6:	89 e5                	mov    %esp,%ebp
+  8007d8:	53                   	push   %ebx
+  8007d9:	83 ec 10             	sub    $0x10,%esp
+  8007dc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  8007df:	53                   	push   %ebx
+  8007e0:	e8 91 ff ff ff       	call   800776 <strlen>
+  8007e5:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  8007e8:	ff 75 0c             	push   0xc(%ebp)
+  8007eb:	01 d8                	add    %ebx,%eax
+  8007ed:	50                   	push   %eax
+  8007ee:	e8 be ff ff ff       	call   8007b1 <strcpy>
+  return dst;
+}
+  8007f3:	89 d8                	mov    %ebx,%eax
+  8007f5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007f8:	c9                   	leave
+  8007f9:	c3                   	ret
+
+008007fa <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  8007fa:	55                   	push   %ebp
+  8007fb:	89 e5                	mov    %esp,%ebp
+  8007fd:	56                   	push   %esi
+  8007fe:	53                   	push   %ebx
+  8007ff:	8b 75 08             	mov    0x8(%ebp),%esi
+  800802:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  800805:	89 f3                	mov    %esi,%ebx
+  800807:	03 5d 10             	add    0x10(%ebp),%ebx
+  80080a:	89 f0                	mov    %esi,%eax
+  80080c:	eb 0f                	jmp    80081d <strncpy+0x23>
+    *dst++ = *src;
+  80080e:	83 c0 01             	add    $0x1,%eax
+  800811:	0f b6 0a             	movzbl (%edx),%ecx
+  800814:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  800817:	80 f9 01             	cmp    $0x1,%cl
+  80081a:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  80081d:	39 d8                	cmp    %ebx,%eax
+  80081f:	75 ed                	jne    80080e <strncpy+0x14>
+  }
+  return ret;
+}
+  800821:	89 f0                	mov    %esi,%eax
+  800823:	5b                   	pop    %ebx
+  800824:	5e                   	pop    %esi
+  800825:	5d                   	pop    %ebp
+  800826:	c3                   	ret
+
+00800827 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800827:	55                   	push   %ebp
+  800828:	89 e5                	mov    %esp,%ebp
+  80082a:	56                   	push   %esi
+  80082b:	53                   	push   %ebx
+  80082c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80082f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800832:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  800835:	89 f0                	mov    %esi,%eax
+  800837:	85 d2                	test   %edx,%edx
+  800839:	74 21                	je     80085c <strlcpy+0x35>
+  80083b:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80083f:	89 f2                	mov    %esi,%edx
+  800841:	eb 09                	jmp    80084c <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  800843:	83 c1 01             	add    $0x1,%ecx
+  800846:	83 c2 01             	add    $0x1,%edx
+  800849:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  80084c:	39 c2                	cmp    %eax,%edx
+  80084e:	74 09                	je     800859 <strlcpy+0x32>
+  800850:	0f b6 19             	movzbl (%ecx),%ebx
+  800853:	84 db                	test   %bl,%bl
+  800855:	75 ec                	jne    800843 <strlcpy+0x1c>
+  800857:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  800859:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  80085c:	29 f0                	sub    %esi,%eax
+}
+  80085e:	5b                   	pop    %ebx
+  80085f:	5e                   	pop    %esi
+  800860:	5d                   	pop    %ebp
+  800861:	c3                   	ret
+
+00800862 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800862:	55                   	push   %ebp
+  800863:	89 e5                	mov    %esp,%ebp
+  800865:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800868:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  80086b:	eb 06                	jmp    800873 <strcmp+0x11>
+    p++, q++;
+  80086d:	83 c1 01             	add    $0x1,%ecx
+  800870:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  800873:	0f b6 01             	movzbl (%ecx),%eax
+  800876:	84 c0                	test   %al,%al
+  800878:	74 04                	je     80087e <strcmp+0x1c>
+  80087a:	3a 02                	cmp    (%edx),%al
+  80087c:	74 ef                	je     80086d <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  80087e:	0f b6 c0             	movzbl %al,%eax
+  800881:	0f b6 12             	movzbl (%edx),%edx
+  800884:	29 d0                	sub    %edx,%eax
+}
+  800886:	5d                   	pop    %ebp
+  800887:	c3                   	ret
+
+00800888 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800888:	55                   	push   %ebp
+  800889:	89 e5                	mov    %esp,%ebp
+  80088b:	53                   	push   %ebx
+  80088c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80088f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800892:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  800895:	eb 09                	jmp    8008a0 <strncmp+0x18>
+    n--, p++, q++;
+  800897:	83 ea 01             	sub    $0x1,%edx
+  80089a:	83 c0 01             	add    $0x1,%eax
+  80089d:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  8008a0:	85 d2                	test   %edx,%edx
+  8008a2:	74 18                	je     8008bc <strncmp+0x34>
+  8008a4:	0f b6 18             	movzbl (%eax),%ebx
+  8008a7:	84 db                	test   %bl,%bl
+  8008a9:	74 04                	je     8008af <strncmp+0x27>
+  8008ab:	3a 19                	cmp    (%ecx),%bl
+  8008ad:	74 e8                	je     800897 <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8008af:	0f b6 00             	movzbl (%eax),%eax
+  8008b2:	0f b6 11             	movzbl (%ecx),%edx
+  8008b5:	29 d0                	sub    %edx,%eax
+}
+  8008b7:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008ba:	c9                   	leave
+  8008bb:	c3                   	ret
+    return 0;
+  8008bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008c1:	eb f4                	jmp    8008b7 <strncmp+0x2f>
+
+008008c3 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8008c3:	55                   	push   %ebp
+  8008c4:	89 e5                	mov    %esp,%ebp
+  8008c6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008c9:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  8008cd:	eb 03                	jmp    8008d2 <strchr+0xf>
+  8008cf:	83 c0 01             	add    $0x1,%eax
+  8008d2:	0f b6 10             	movzbl (%eax),%edx
+  8008d5:	84 d2                	test   %dl,%dl
+  8008d7:	74 06                	je     8008df <strchr+0x1c>
+    if (*s == c)
+  8008d9:	38 ca                	cmp    %cl,%dl
+  8008db:	75 f2                	jne    8008cf <strchr+0xc>
+  8008dd:	eb 05                	jmp    8008e4 <strchr+0x21>
+      return (char*)s;
+  return 0;
+  8008df:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008e4:	5d                   	pop    %ebp
+  8008e5:	c3                   	ret
+
+008008e6 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8008e6:	55                   	push   %ebp
+  8008e7:	89 e5                	mov    %esp,%ebp
+  8008e9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008ec:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  8008f0:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  8008f3:	38 ca                	cmp    %cl,%dl
+  8008f5:	74 09                	je     800900 <strfind+0x1a>
+  8008f7:	84 d2                	test   %dl,%dl
+  8008f9:	74 05                	je     800900 <strfind+0x1a>
+  for (; *s; s++)
+  8008fb:	83 c0 01             	add    $0x1,%eax
+  8008fe:	eb f0                	jmp    8008f0 <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  800900:	5d                   	pop    %ebp
+  800901:	c3                   	ret
+
+00800902 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800902:	55                   	push   %ebp
+  800903:	89 e5                	mov    %esp,%ebp
+  800905:	57                   	push   %edi
+  800906:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800909:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  80090c:	85 c9                	test   %ecx,%ecx
+  80090e:	74 20                	je     800930 <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  800910:	89 f8                	mov    %edi,%eax
+  800912:	09 c8                	or     %ecx,%eax
+  800914:	a8 03                	test   $0x3,%al
+  800916:	75 12                	jne    80092a <memset+0x28>
+    c &= 0xFF;
+  800918:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80091c:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  800922:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  800925:	fc                   	cld
+  800926:	f3 ab                	rep stos %eax,%es:(%edi)
+  800928:	eb 06                	jmp    800930 <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  80092a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80092d:	fc                   	cld
+  80092e:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  800930:	89 f8                	mov    %edi,%eax
+  800932:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800935:	c9                   	leave
+  800936:	c3                   	ret
+
+00800937 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800937:	55                   	push   %ebp
+  800938:	89 e5                	mov    %esp,%ebp
+  80093a:	57                   	push   %edi
+  80093b:	56                   	push   %esi
+  80093c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80093f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800942:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  800945:	39 c6                	cmp    %eax,%esi
+  800947:	73 32                	jae    80097b <memmove+0x44>
+  800949:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  80094c:	39 d0                	cmp    %edx,%eax
+  80094e:	73 2b                	jae    80097b <memmove+0x44>
+    s += n;
+    d += n;
+  800950:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800953:	89 d6                	mov    %edx,%esi
+  800955:	09 fe                	or     %edi,%esi
+  800957:	09 ce                	or     %ecx,%esi
+  800959:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  80095f:	75 0e                	jne    80096f <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800961:	83 ef 04             	sub    $0x4,%edi
+  800964:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800967:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  80096a:	fd                   	std
+  80096b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80096d:	eb 09                	jmp    800978 <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  80096f:	83 ef 01             	sub    $0x1,%edi
+  800972:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  800975:	fd                   	std
+  800976:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  800978:	fc                   	cld
+  800979:	eb 1a                	jmp    800995 <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80097b:	89 f2                	mov    %esi,%edx
+  80097d:	09 c2                	or     %eax,%edx
+  80097f:	09 ca                	or     %ecx,%edx
+  800981:	f6 c2 03             	test   $0x3,%dl
+  800984:	75 0a                	jne    800990 <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800986:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  800989:	89 c7                	mov    %eax,%edi
+  80098b:	fc                   	cld
+  80098c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  80098e:	eb 05                	jmp    800995 <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  800990:	89 c7                	mov    %eax,%edi
+  800992:	fc                   	cld
+  800993:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  800995:	5e                   	pop    %esi
+  800996:	5f                   	pop    %edi
+  800997:	5d                   	pop    %ebp
+  800998:	c3                   	ret
+
+00800999 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800999:	55                   	push   %ebp
+  80099a:	89 e5                	mov    %esp,%ebp
+  80099c:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  80099f:	ff 75 10             	push   0x10(%ebp)
+  8009a2:	ff 75 0c             	push   0xc(%ebp)
+  8009a5:	ff 75 08             	push   0x8(%ebp)
+  8009a8:	e8 8a ff ff ff       	call   800937 <memmove>
+}
+  8009ad:	c9                   	leave
+  8009ae:	c3                   	ret
+
+008009af <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8009af:	55                   	push   %ebp
+  8009b0:	89 e5                	mov    %esp,%ebp
+  8009b2:	56                   	push   %esi
+  8009b3:	53                   	push   %ebx
+  8009b4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009b7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  8009ba:	89 c6                	mov    %eax,%esi
+  8009bc:	03 75 10             	add    0x10(%ebp),%esi
+  8009bf:	eb 06                	jmp    8009c7 <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  8009c1:	83 c0 01             	add    $0x1,%eax
+  8009c4:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  8009c7:	39 f0                	cmp    %esi,%eax
+  8009c9:	74 14                	je     8009df <memcmp+0x30>
+    if (*s1 != *s2)
+  8009cb:	0f b6 08             	movzbl (%eax),%ecx
+  8009ce:	0f b6 1a             	movzbl (%edx),%ebx
+  8009d1:	38 d9                	cmp    %bl,%cl
+  8009d3:	74 ec                	je     8009c1 <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  8009d5:	0f b6 c1             	movzbl %cl,%eax
+  8009d8:	0f b6 db             	movzbl %bl,%ebx
+  8009db:	29 d8                	sub    %ebx,%eax
+  8009dd:	eb 05                	jmp    8009e4 <memcmp+0x35>
+  }
+
+  return 0;
+  8009df:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009e4:	5b                   	pop    %ebx
+  8009e5:	5e                   	pop    %esi
+  8009e6:	5d                   	pop    %ebp
+  8009e7:	c3                   	ret
+
+008009e8 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8009e8:	55                   	push   %ebp
+  8009e9:	89 e5                	mov    %esp,%ebp
+  8009eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009ee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  8009f1:	89 c2                	mov    %eax,%edx
+  8009f3:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  8009f6:	eb 03                	jmp    8009fb <memfind+0x13>
+  8009f8:	83 c0 01             	add    $0x1,%eax
+  8009fb:	39 d0                	cmp    %edx,%eax
+  8009fd:	73 04                	jae    800a03 <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  8009ff:	38 08                	cmp    %cl,(%eax)
+  800a01:	75 f5                	jne    8009f8 <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  800a03:	5d                   	pop    %ebp
+  800a04:	c3                   	ret
+
+00800a05 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a05:	55                   	push   %ebp
+  800a06:	89 e5                	mov    %esp,%ebp
+  800a08:	57                   	push   %edi
+  800a09:	56                   	push   %esi
+  800a0a:	53                   	push   %ebx
+  800a0b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a0e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  800a11:	eb 03                	jmp    800a16 <strtol+0x11>
+    s++;
+  800a13:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  800a16:	0f b6 02             	movzbl (%edx),%eax
+  800a19:	3c 20                	cmp    $0x20,%al
+  800a1b:	74 f6                	je     800a13 <strtol+0xe>
+  800a1d:	3c 09                	cmp    $0x9,%al
+  800a1f:	74 f2                	je     800a13 <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  800a21:	3c 2b                	cmp    $0x2b,%al
+  800a23:	74 2a                	je     800a4f <strtol+0x4a>
+  int neg = 0;
+  800a25:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  800a2a:	3c 2d                	cmp    $0x2d,%al
+  800a2c:	74 2b                	je     800a59 <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a2e:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a34:	75 0f                	jne    800a45 <strtol+0x40>
+  800a36:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a39:	74 28                	je     800a63 <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  800a3b:	85 db                	test   %ebx,%ebx
+  800a3d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a42:	0f 44 d8             	cmove  %eax,%ebx
+  800a45:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a4a:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a4d:	eb 46                	jmp    800a95 <strtol+0x90>
+    s++;
+  800a4f:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  800a52:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a57:	eb d5                	jmp    800a2e <strtol+0x29>
+    s++, neg = 1;
+  800a59:	83 c2 01             	add    $0x1,%edx
+  800a5c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a61:	eb cb                	jmp    800a2e <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a63:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a67:	74 0e                	je     800a77 <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  800a69:	85 db                	test   %ebx,%ebx
+  800a6b:	75 d8                	jne    800a45 <strtol+0x40>
+    s++, base = 8;
+  800a6d:	83 c2 01             	add    $0x1,%edx
+  800a70:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a75:	eb ce                	jmp    800a45 <strtol+0x40>
+    s += 2, base = 16;
+  800a77:	83 c2 02             	add    $0x2,%edx
+  800a7a:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a7f:	eb c4                	jmp    800a45 <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  800a81:	0f be c0             	movsbl %al,%eax
+  800a84:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  800a87:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a8a:	7d 3a                	jge    800ac6 <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  800a8c:	83 c2 01             	add    $0x1,%edx
+  800a8f:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a93:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  800a95:	0f b6 02             	movzbl (%edx),%eax
+  800a98:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a9b:	89 f3                	mov    %esi,%ebx
+  800a9d:	80 fb 09             	cmp    $0x9,%bl
+  800aa0:	76 df                	jbe    800a81 <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  800aa2:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800aa5:	89 f3                	mov    %esi,%ebx
+  800aa7:	80 fb 19             	cmp    $0x19,%bl
+  800aaa:	77 08                	ja     800ab4 <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  800aac:	0f be c0             	movsbl %al,%eax
+  800aaf:	83 e8 57             	sub    $0x57,%eax
+  800ab2:	eb d3                	jmp    800a87 <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  800ab4:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800ab7:	89 f3                	mov    %esi,%ebx
+  800ab9:	80 fb 19             	cmp    $0x19,%bl
+  800abc:	77 08                	ja     800ac6 <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  800abe:	0f be c0             	movsbl %al,%eax
+  800ac1:	83 e8 37             	sub    $0x37,%eax
+  800ac4:	eb c1                	jmp    800a87 <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  800ac6:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800aca:	74 05                	je     800ad1 <strtol+0xcc>
+    *endptr = (char*)s;
+  800acc:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800acf:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  800ad1:	89 c8                	mov    %ecx,%eax
+  800ad3:	f7 d8                	neg    %eax
+  800ad5:	85 ff                	test   %edi,%edi
+  800ad7:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800ada:	89 c8                	mov    %ecx,%eax
+  800adc:	5b                   	pop    %ebx
+  800add:	5e                   	pop    %esi
+  800ade:	5f                   	pop    %edi
+  800adf:	5d                   	pop    %ebp
+  800ae0:	c3                   	ret
+
+00800ae1 <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800ae1:	55                   	push   %ebp
+  800ae2:	89 e5                	mov    %esp,%ebp
+  800ae4:	57                   	push   %edi
+  800ae5:	56                   	push   %esi
+  800ae6:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800ae7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aec:	8b 55 08             	mov    0x8(%ebp),%edx
+  800aef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800af2:	89 c3                	mov    %eax,%ebx
+  800af4:	89 c7                	mov    %eax,%edi
+  800af6:	89 c6                	mov    %eax,%esi
+  800af8:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800afa:	5b                   	pop    %ebx
+  800afb:	5e                   	pop    %esi
+  800afc:	5f                   	pop    %edi
+  800afd:	5d                   	pop    %ebp
+  800afe:	c3                   	ret
+
+00800aff <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800aff:	55                   	push   %ebp
+  800b00:	89 e5                	mov    %esp,%ebp
+  800b02:	57                   	push   %edi
+  800b03:	56                   	push   %esi
+  800b04:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800b05:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b0a:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b0f:	89 d1                	mov    %edx,%ecx
+  800b11:	89 d3                	mov    %edx,%ebx
+  800b13:	89 d7                	mov    %edx,%edi
+  800b15:	89 d6                	mov    %edx,%esi
+  800b17:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800b19:	5b                   	pop    %ebx
+  800b1a:	5e                   	pop    %esi
+  800b1b:	5f                   	pop    %edi
+  800b1c:	5d                   	pop    %ebp
+  800b1d:	c3                   	ret
+
+00800b1e <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800b1e:	55                   	push   %ebp
+  800b1f:	89 e5                	mov    %esp,%ebp
+  800b21:	57                   	push   %edi
+  800b22:	56                   	push   %esi
+  800b23:	53                   	push   %ebx
+  800b24:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800b27:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b2c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b2f:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b34:	89 cb                	mov    %ecx,%ebx
+  800b36:	89 cf                	mov    %ecx,%edi
+  800b38:	89 ce                	mov    %ecx,%esi
+  800b3a:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800b3c:	85 c0                	test   %eax,%eax
+  800b3e:	7f 08                	jg     800b48 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800b40:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b43:	5b                   	pop    %ebx
+  800b44:	5e                   	pop    %esi
+  800b45:	5f                   	pop    %edi
+  800b46:	5d                   	pop    %ebp
+  800b47:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800b48:	83 ec 0c             	sub    $0xc,%esp
+  800b4b:	50                   	push   %eax
+  800b4c:	6a 03                	push   $0x3
+  800b4e:	68 c3 39 80 00       	push   $0x8039c3
+  800b53:	6a 23                	push   $0x23
+  800b55:	68 e0 39 80 00       	push   $0x8039e0
+  800b5a:	e8 89 f5 ff ff       	call   8000e8 <_panic>
+
+00800b5f <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800b5f:	55                   	push   %ebp
+  800b60:	89 e5                	mov    %esp,%ebp
+  800b62:	57                   	push   %edi
+  800b63:	56                   	push   %esi
+  800b64:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800b65:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b6a:	b8 02 00 00 00       	mov    $0x2,%eax
+  800b6f:	89 d1                	mov    %edx,%ecx
+  800b71:	89 d3                	mov    %edx,%ebx
+  800b73:	89 d7                	mov    %edx,%edi
+  800b75:	89 d6                	mov    %edx,%esi
+  800b77:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800b79:	5b                   	pop    %ebx
+  800b7a:	5e                   	pop    %esi
+  800b7b:	5f                   	pop    %edi
+  800b7c:	5d                   	pop    %ebp
+  800b7d:	c3                   	ret
+
+00800b7e <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800b7e:	55                   	push   %ebp
+  800b7f:	89 e5                	mov    %esp,%ebp
+  800b81:	57                   	push   %edi
+  800b82:	56                   	push   %esi
+  800b83:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800b84:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b89:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800b8e:	89 d1                	mov    %edx,%ecx
+  800b90:	89 d3                	mov    %edx,%ebx
+  800b92:	89 d7                	mov    %edx,%edi
+  800b94:	89 d6                	mov    %edx,%esi
+  800b96:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800b98:	5b                   	pop    %ebx
+  800b99:	5e                   	pop    %esi
+  800b9a:	5f                   	pop    %edi
+  800b9b:	5d                   	pop    %ebp
+  800b9c:	c3                   	ret
+
+00800b9d <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  800b9d:	55                   	push   %ebp
+  800b9e:	89 e5                	mov    %esp,%ebp
+  800ba0:	57                   	push   %edi
+  800ba1:	56                   	push   %esi
+  800ba2:	53                   	push   %ebx
+  800ba3:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  800ba6:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  800baa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800baf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bb2:	b8 14 00 00 00       	mov    $0x14,%eax
+  800bb7:	89 df                	mov    %ebx,%edi
+  800bb9:	89 de                	mov    %ebx,%esi
+  800bbb:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800bbd:	85 c0                	test   %eax,%eax
+  800bbf:	7f 08                	jg     800bc9 <sys_env_set_cow+0x2c>
+}
+  800bc1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bc4:	5b                   	pop    %ebx
+  800bc5:	5e                   	pop    %esi
+  800bc6:	5f                   	pop    %edi
+  800bc7:	5d                   	pop    %ebp
+  800bc8:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800bc9:	83 ec 0c             	sub    $0xc,%esp
+  800bcc:	50                   	push   %eax
+  800bcd:	6a 14                	push   $0x14
+  800bcf:	68 c3 39 80 00       	push   $0x8039c3
+  800bd4:	6a 23                	push   $0x23
+  800bd6:	68 e0 39 80 00       	push   $0x8039e0
+  800bdb:	e8 08 f5 ff ff       	call   8000e8 <_panic>
+
+00800be0 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800be0:	55                   	push   %ebp
+  800be1:	89 e5                	mov    %esp,%ebp
+  800be3:	57                   	push   %edi
+  800be4:	56                   	push   %esi
+  800be5:	53                   	push   %ebx
+  800be6:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800be9:	be 00 00 00 00       	mov    $0x0,%esi
+  800bee:	8b 55 08             	mov    0x8(%ebp),%edx
+  800bf1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800bf4:	b8 04 00 00 00       	mov    $0x4,%eax
+  800bf9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800bfc:	89 f7                	mov    %esi,%edi
+  800bfe:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c00:	85 c0                	test   %eax,%eax
+  800c02:	7f 08                	jg     800c0c <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  800c04:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c07:	5b                   	pop    %ebx
+  800c08:	5e                   	pop    %esi
+  800c09:	5f                   	pop    %edi
+  800c0a:	5d                   	pop    %ebp
+  800c0b:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c0c:	83 ec 0c             	sub    $0xc,%esp
+  800c0f:	50                   	push   %eax
+  800c10:	6a 04                	push   $0x4
+  800c12:	68 c3 39 80 00       	push   $0x8039c3
+  800c17:	6a 23                	push   $0x23
+  800c19:	68 e0 39 80 00       	push   $0x8039e0
+  800c1e:	e8 c5 f4 ff ff       	call   8000e8 <_panic>
+
+00800c23 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800c23:	55                   	push   %ebp
+  800c24:	89 e5                	mov    %esp,%ebp
+  800c26:	57                   	push   %edi
+  800c27:	56                   	push   %esi
+  800c28:	53                   	push   %ebx
+  800c29:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800c2c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c2f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c32:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c37:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c3a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c3d:	8b 75 18             	mov    0x18(%ebp),%esi
+  800c40:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c42:	85 c0                	test   %eax,%eax
+  800c44:	7f 08                	jg     800c4e <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  800c46:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c49:	5b                   	pop    %ebx
+  800c4a:	5e                   	pop    %esi
+  800c4b:	5f                   	pop    %edi
+  800c4c:	5d                   	pop    %ebp
+  800c4d:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c4e:	83 ec 0c             	sub    $0xc,%esp
+  800c51:	50                   	push   %eax
+  800c52:	6a 05                	push   $0x5
+  800c54:	68 c3 39 80 00       	push   $0x8039c3
+  800c59:	6a 23                	push   $0x23
+  800c5b:	68 e0 39 80 00       	push   $0x8039e0
+  800c60:	e8 83 f4 ff ff       	call   8000e8 <_panic>
+
+00800c65 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800c65:	55                   	push   %ebp
+  800c66:	89 e5                	mov    %esp,%ebp
+  800c68:	57                   	push   %edi
+  800c69:	56                   	push   %esi
+  800c6a:	53                   	push   %ebx
+  800c6b:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800c6e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c73:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c76:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c79:	b8 06 00 00 00       	mov    $0x6,%eax
+  800c7e:	89 df                	mov    %ebx,%edi
+  800c80:	89 de                	mov    %ebx,%esi
+  800c82:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c84:	85 c0                	test   %eax,%eax
+  800c86:	7f 08                	jg     800c90 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  800c88:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c8b:	5b                   	pop    %ebx
+  800c8c:	5e                   	pop    %esi
+  800c8d:	5f                   	pop    %edi
+  800c8e:	5d                   	pop    %ebp
+  800c8f:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c90:	83 ec 0c             	sub    $0xc,%esp
+  800c93:	50                   	push   %eax
+  800c94:	6a 06                	push   $0x6
+  800c96:	68 c3 39 80 00       	push   $0x8039c3
+  800c9b:	6a 23                	push   $0x23
+  800c9d:	68 e0 39 80 00       	push   $0x8039e0
+  800ca2:	e8 41 f4 ff ff       	call   8000e8 <_panic>
+
+00800ca7 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  800ca7:	55                   	push   %ebp
+  800ca8:	89 e5                	mov    %esp,%ebp
+  800caa:	57                   	push   %edi
+  800cab:	56                   	push   %esi
+  800cac:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800cad:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cb0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cb3:	b8 11 00 00 00       	mov    $0x11,%eax
+  800cb8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cbb:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800cbe:	8b 75 18             	mov    0x18(%ebp),%esi
+  800cc1:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  800cc3:	5b                   	pop    %ebx
+  800cc4:	5e                   	pop    %esi
+  800cc5:	5f                   	pop    %edi
+  800cc6:	5d                   	pop    %ebp
+  800cc7:	c3                   	ret
+
+00800cc8 <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  800cc8:	55                   	push   %ebp
+  800cc9:	89 e5                	mov    %esp,%ebp
+  800ccb:	57                   	push   %edi
+  800ccc:	56                   	push   %esi
+  800ccd:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800cce:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cd1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cd4:	b8 12 00 00 00       	mov    $0x12,%eax
+  800cd9:	be 00 00 00 00       	mov    $0x0,%esi
+  800cde:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ce1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ce4:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  800ce6:	5b                   	pop    %ebx
+  800ce7:	5e                   	pop    %esi
+  800ce8:	5f                   	pop    %edi
+  800ce9:	5d                   	pop    %ebp
+  800cea:	c3                   	ret
+
+00800ceb <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  800ceb:	55                   	push   %ebp
+  800cec:	89 e5                	mov    %esp,%ebp
+  800cee:	57                   	push   %edi
+  800cef:	56                   	push   %esi
+  800cf0:	53                   	push   %ebx
+  800cf1:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800cf4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cf9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cfc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cff:	b8 16 00 00 00       	mov    $0x16,%eax
+  800d04:	89 df                	mov    %ebx,%edi
+  800d06:	89 de                	mov    %ebx,%esi
+  800d08:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d0a:	85 c0                	test   %eax,%eax
+  800d0c:	7f 08                	jg     800d16 <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  800d0e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d11:	5b                   	pop    %ebx
+  800d12:	5e                   	pop    %esi
+  800d13:	5f                   	pop    %edi
+  800d14:	5d                   	pop    %ebp
+  800d15:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d16:	83 ec 0c             	sub    $0xc,%esp
+  800d19:	50                   	push   %eax
+  800d1a:	6a 16                	push   $0x16
+  800d1c:	68 c3 39 80 00       	push   $0x8039c3
+  800d21:	6a 23                	push   $0x23
+  800d23:	68 e0 39 80 00       	push   $0x8039e0
+  800d28:	e8 bb f3 ff ff       	call   8000e8 <_panic>
+
+00800d2d <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  800d2d:	55                   	push   %ebp
+  800d2e:	89 e5                	mov    %esp,%ebp
+  800d30:	57                   	push   %edi
+  800d31:	56                   	push   %esi
+  800d32:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d33:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d38:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d3b:	b8 17 00 00 00       	mov    $0x17,%eax
+  800d40:	89 cb                	mov    %ecx,%ebx
+  800d42:	89 cf                	mov    %ecx,%edi
+  800d44:	89 ce                	mov    %ecx,%esi
+  800d46:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  800d48:	5b                   	pop    %ebx
+  800d49:	5e                   	pop    %esi
+  800d4a:	5f                   	pop    %edi
+  800d4b:	5d                   	pop    %ebp
+  800d4c:	c3                   	ret
+
+00800d4d <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  800d4d:	55                   	push   %ebp
+  800d4e:	89 e5                	mov    %esp,%ebp
+  800d50:	57                   	push   %edi
+  800d51:	56                   	push   %esi
+  800d52:	53                   	push   %ebx
+  800d53:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800d56:	be 00 00 00 00       	mov    $0x0,%esi
+  800d5b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d5e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d61:	b8 18 00 00 00       	mov    $0x18,%eax
+  800d66:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d69:	89 f7                	mov    %esi,%edi
+  800d6b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d6d:	85 c0                	test   %eax,%eax
+  800d6f:	7f 08                	jg     800d79 <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  800d71:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d74:	5b                   	pop    %ebx
+  800d75:	5e                   	pop    %esi
+  800d76:	5f                   	pop    %edi
+  800d77:	5d                   	pop    %ebp
+  800d78:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d79:	83 ec 0c             	sub    $0xc,%esp
+  800d7c:	50                   	push   %eax
+  800d7d:	6a 18                	push   $0x18
+  800d7f:	68 c3 39 80 00       	push   $0x8039c3
+  800d84:	6a 23                	push   $0x23
+  800d86:	68 e0 39 80 00       	push   $0x8039e0
+  800d8b:	e8 58 f3 ff ff       	call   8000e8 <_panic>
+
+00800d90 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  800d90:	55                   	push   %ebp
+  800d91:	89 e5                	mov    %esp,%ebp
+  800d93:	57                   	push   %edi
+  800d94:	56                   	push   %esi
+  800d95:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d96:	be 00 00 00 00       	mov    $0x0,%esi
+  800d9b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d9e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800da1:	b8 19 00 00 00       	mov    $0x19,%eax
+  800da6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800da9:	89 f7                	mov    %esi,%edi
+  800dab:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  800dad:	5b                   	pop    %ebx
+  800dae:	5e                   	pop    %esi
+  800daf:	5f                   	pop    %edi
+  800db0:	5d                   	pop    %ebp
+  800db1:	c3                   	ret
+
+00800db2 <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  800db2:	55                   	push   %ebp
+  800db3:	89 e5                	mov    %esp,%ebp
+  800db5:	57                   	push   %edi
+  800db6:	56                   	push   %esi
+  800db7:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800db8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dbd:	b8 15 00 00 00       	mov    $0x15,%eax
+  800dc2:	89 d1                	mov    %edx,%ecx
+  800dc4:	89 d3                	mov    %edx,%ebx
+  800dc6:	89 d7                	mov    %edx,%edi
+  800dc8:	89 d6                	mov    %edx,%esi
+  800dca:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800dcc:	5b                   	pop    %ebx
+  800dcd:	5e                   	pop    %esi
+  800dce:	5f                   	pop    %edi
+  800dcf:	5d                   	pop    %ebp
+  800dd0:	c3                   	ret
+
+00800dd1 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800dd1:	55                   	push   %ebp
+  800dd2:	89 e5                	mov    %esp,%ebp
+  800dd4:	57                   	push   %edi
+  800dd5:	56                   	push   %esi
+  800dd6:	53                   	push   %ebx
+  800dd7:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800dda:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ddf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800de2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800de5:	b8 08 00 00 00       	mov    $0x8,%eax
+  800dea:	89 df                	mov    %ebx,%edi
+  800dec:	89 de                	mov    %ebx,%esi
+  800dee:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800df0:	85 c0                	test   %eax,%eax
+  800df2:	7f 08                	jg     800dfc <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800df4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800df7:	5b                   	pop    %ebx
+  800df8:	5e                   	pop    %esi
+  800df9:	5f                   	pop    %edi
+  800dfa:	5d                   	pop    %ebp
+  800dfb:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800dfc:	83 ec 0c             	sub    $0xc,%esp
+  800dff:	50                   	push   %eax
+  800e00:	6a 08                	push   $0x8
+  800e02:	68 c3 39 80 00       	push   $0x8039c3
+  800e07:	6a 23                	push   $0x23
+  800e09:	68 e0 39 80 00       	push   $0x8039e0
+  800e0e:	e8 d5 f2 ff ff       	call   8000e8 <_panic>
+
+00800e13 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800e13:	55                   	push   %ebp
+  800e14:	89 e5                	mov    %esp,%ebp
+  800e16:	57                   	push   %edi
+  800e17:	56                   	push   %esi
+  800e18:	53                   	push   %ebx
+  800e19:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e1c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e21:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e24:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e27:	b8 09 00 00 00       	mov    $0x9,%eax
+  800e2c:	89 df                	mov    %ebx,%edi
+  800e2e:	89 de                	mov    %ebx,%esi
+  800e30:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e32:	85 c0                	test   %eax,%eax
+  800e34:	7f 08                	jg     800e3e <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  800e36:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e39:	5b                   	pop    %ebx
+  800e3a:	5e                   	pop    %esi
+  800e3b:	5f                   	pop    %edi
+  800e3c:	5d                   	pop    %ebp
+  800e3d:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e3e:	83 ec 0c             	sub    $0xc,%esp
+  800e41:	50                   	push   %eax
+  800e42:	6a 09                	push   $0x9
+  800e44:	68 c3 39 80 00       	push   $0x8039c3
+  800e49:	6a 23                	push   $0x23
+  800e4b:	68 e0 39 80 00       	push   $0x8039e0
+  800e50:	e8 93 f2 ff ff       	call   8000e8 <_panic>
+
+00800e55 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800e55:	55                   	push   %ebp
+  800e56:	89 e5                	mov    %esp,%ebp
+  800e58:	57                   	push   %edi
+  800e59:	56                   	push   %esi
+  800e5a:	53                   	push   %ebx
+  800e5b:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e5e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e63:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e66:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e69:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e6e:	89 df                	mov    %ebx,%edi
+  800e70:	89 de                	mov    %ebx,%esi
+  800e72:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e74:	85 c0                	test   %eax,%eax
+  800e76:	7f 08                	jg     800e80 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  800e78:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e7b:	5b                   	pop    %ebx
+  800e7c:	5e                   	pop    %esi
+  800e7d:	5f                   	pop    %edi
+  800e7e:	5d                   	pop    %ebp
+  800e7f:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e80:	83 ec 0c             	sub    $0xc,%esp
+  800e83:	50                   	push   %eax
+  800e84:	6a 0a                	push   $0xa
+  800e86:	68 c3 39 80 00       	push   $0x8039c3
+  800e8b:	6a 23                	push   $0x23
+  800e8d:	68 e0 39 80 00       	push   $0x8039e0
+  800e92:	e8 51 f2 ff ff       	call   8000e8 <_panic>
+
+00800e97 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  800e97:	55                   	push   %ebp
+  800e98:	89 e5                	mov    %esp,%ebp
+  800e9a:	57                   	push   %edi
+  800e9b:	56                   	push   %esi
+  800e9c:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e9d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ea0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ea3:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800ea8:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800eab:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800eae:	8b 75 18             	mov    0x18(%ebp),%esi
+  800eb1:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  800eb3:	5b                   	pop    %ebx
+  800eb4:	5e                   	pop    %esi
+  800eb5:	5f                   	pop    %edi
+  800eb6:	5d                   	pop    %ebp
+  800eb7:	c3                   	ret
+
+00800eb8 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  800eb8:	55                   	push   %ebp
+  800eb9:	89 e5                	mov    %esp,%ebp
+  800ebb:	57                   	push   %edi
+  800ebc:	56                   	push   %esi
+  800ebd:	53                   	push   %ebx
+  800ebe:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800ec1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ec6:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ecc:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800ed1:	89 df                	mov    %ebx,%edi
+  800ed3:	89 de                	mov    %ebx,%esi
+  800ed5:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ed7:	85 c0                	test   %eax,%eax
+  800ed9:	7f 08                	jg     800ee3 <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  800edb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ede:	5b                   	pop    %ebx
+  800edf:	5e                   	pop    %esi
+  800ee0:	5f                   	pop    %edi
+  800ee1:	5d                   	pop    %ebp
+  800ee2:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ee3:	83 ec 0c             	sub    $0xc,%esp
+  800ee6:	50                   	push   %eax
+  800ee7:	6a 0d                	push   $0xd
+  800ee9:	68 c3 39 80 00       	push   $0x8039c3
+  800eee:	6a 23                	push   $0x23
+  800ef0:	68 e0 39 80 00       	push   $0x8039e0
+  800ef5:	e8 ee f1 ff ff       	call   8000e8 <_panic>
+
+00800efa <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  800efa:	55                   	push   %ebp
+  800efb:	89 e5                	mov    %esp,%ebp
+  800efd:	57                   	push   %edi
+  800efe:	56                   	push   %esi
+  800eff:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f00:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f05:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800f0a:	89 d1                	mov    %edx,%ecx
+  800f0c:	89 d3                	mov    %edx,%ebx
+  800f0e:	89 d7                	mov    %edx,%edi
+  800f10:	89 d6                	mov    %edx,%esi
+  800f12:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800f14:	5b                   	pop    %ebx
+  800f15:	5e                   	pop    %esi
+  800f16:	5f                   	pop    %edi
+  800f17:	5d                   	pop    %ebp
+  800f18:	c3                   	ret
+
+00800f19 <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  800f19:	55                   	push   %ebp
+  800f1a:	89 e5                	mov    %esp,%ebp
+  800f1c:	57                   	push   %edi
+  800f1d:	56                   	push   %esi
+  800f1e:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f1f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f22:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f25:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f2a:	be 00 00 00 00       	mov    $0x0,%esi
+  800f2f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f32:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f35:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  800f37:	5b                   	pop    %ebx
+  800f38:	5e                   	pop    %esi
+  800f39:	5f                   	pop    %edi
+  800f3a:	5d                   	pop    %ebp
+  800f3b:	c3                   	ret
+
+00800f3c <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  800f3c:	55                   	push   %ebp
+  800f3d:	89 e5                	mov    %esp,%ebp
+  800f3f:	57                   	push   %edi
+  800f40:	56                   	push   %esi
+  800f41:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f42:	be 00 00 00 00       	mov    $0x0,%esi
+  800f47:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f4a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f4d:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f52:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f55:	89 f7                	mov    %esi,%edi
+  800f57:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  800f59:	5b                   	pop    %ebx
+  800f5a:	5e                   	pop    %esi
+  800f5b:	5f                   	pop    %edi
+  800f5c:	5d                   	pop    %ebp
+  800f5d:	c3                   	ret
+
+00800f5e <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  800f5e:	55                   	push   %ebp
+  800f5f:	89 e5                	mov    %esp,%ebp
+  800f61:	57                   	push   %edi
+  800f62:	56                   	push   %esi
+  800f63:	53                   	push   %ebx
+  800f64:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  800f67:	80 3d 68 5e 80 00 00 	cmpb   $0x0,0x805e68
+  800f6e:	74 41                	je     800fb1 <sys_batch+0x53>
+  800f70:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f73:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  800f76:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  800f7d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800f80:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  800f83:	7d 45                	jge    800fca <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  800f85:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800f88:	8b 06                	mov    (%esi),%eax
+  800f8a:	8b 56 04             	mov    0x4(%esi),%edx
+  800f8d:	8b 4e 08             	mov    0x8(%esi),%ecx
+  800f90:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  800f93:	8b 7e 10             	mov    0x10(%esi),%edi
+  800f96:	8b 76 14             	mov    0x14(%esi),%esi
+  800f99:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  800f9b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800f9e:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  800fa1:	83 c6 1c             	add    $0x1c,%esi
+  800fa4:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  800fa7:	85 c0                	test   %eax,%eax
+  800fa9:	78 1f                	js     800fca <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  800fab:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  800faf:	eb cc                	jmp    800f7d <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  800fb1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fb6:	b8 13 00 00 00       	mov    $0x13,%eax
+  800fbb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fbe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fc1:	89 df                	mov    %ebx,%edi
+  800fc3:	89 de                	mov    %ebx,%esi
+  800fc5:	cd 30                	int    $0x30
+  800fc7:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  800fca:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800fcd:	83 c4 08             	add    $0x8,%esp
+  800fd0:	5b                   	pop    %ebx
+  800fd1:	5e                   	pop    %esi
+  800fd2:	5f                   	pop    %edi
+  800fd3:	5d                   	pop    %ebp
+  800fd4:	c3                   	ret
+
+00800fd5 <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  800fd5:	55                   	push   %ebp
+  800fd6:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  800fd8:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fdb:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  800fe1:	5d                   	pop    %ebp
+  800fe2:	c3                   	ret
+
+00800fe3 <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  800fe3:	55                   	push   %ebp
+  800fe4:	89 e5                	mov    %esp,%ebp
+  800fe6:	56                   	push   %esi
+  800fe7:	53                   	push   %ebx
+  800fe8:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  800feb:	8b 1e                	mov    (%esi),%ebx
+  800fed:	85 db                	test   %ebx,%ebx
+  800fef:	75 09                	jne    800ffa <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  800ff1:	89 d8                	mov    %ebx,%eax
+  800ff3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800ff6:	5b                   	pop    %ebx
+  800ff7:	5e                   	pop    %esi
+  800ff8:	5d                   	pop    %ebp
+  800ff9:	c3                   	ret
+  b->sb_n = 0;
+  800ffa:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  801000:	53                   	push   %ebx
+  801001:	8d 46 04             	lea    0x4(%esi),%eax
+  801004:	50                   	push   %eax
+  801005:	e8 54 ff ff ff       	call   800f5e <sys_batch>
+  80100a:	83 c4 08             	add    $0x8,%esp
+  80100d:	85 c0                	test   %eax,%eax
+  80100f:	78 1e                	js     80102f <sysbatch_flush+0x4c>
+  if (r < n)
+  801011:	39 c3                	cmp    %eax,%ebx
+  801013:	7f 07                	jg     80101c <sysbatch_flush+0x39>
+  return 0;
+  801015:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80101a:	eb d5                	jmp    800ff1 <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  80101c:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80101f:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  801023:	85 db                	test   %ebx,%ebx
+  801025:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80102a:	0f 49 d8             	cmovns %eax,%ebx
+  80102d:	eb c2                	jmp    800ff1 <sysbatch_flush+0xe>
+    return r;
+  80102f:	89 c3                	mov    %eax,%ebx
+  801031:	eb be                	jmp    800ff1 <sysbatch_flush+0xe>
+
+00801033 <sysbatch_add>:
+{
+  801033:	55                   	push   %ebp
+  801034:	89 e5                	mov    %esp,%ebp
+  801036:	53                   	push   %ebx
+  801037:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  80103a:	83 3b 40             	cmpl   $0x40,(%ebx)
+  80103d:	74 41                	je     801080 <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  80103f:	8b 03                	mov    (%ebx),%eax
+  801041:	8d 50 01             	lea    0x1(%eax),%edx
+  801044:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  801046:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801049:	01 d8                	add    %ebx,%eax
+  80104b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80104e:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  801051:	8b 55 10             	mov    0x10(%ebp),%edx
+  801054:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  801057:	8b 55 14             	mov    0x14(%ebp),%edx
+  80105a:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  80105d:	8b 55 18             	mov    0x18(%ebp),%edx
+  801060:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  801063:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  801066:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  801069:	8b 55 20             	mov    0x20(%ebp),%edx
+  80106c:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  80106f:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  801076:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80107b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80107e:	c9                   	leave
+  80107f:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  801080:	53                   	push   %ebx
+  801081:	e8 5d ff ff ff       	call   800fe3 <sysbatch_flush>
+  801086:	83 c4 04             	add    $0x4,%esp
+  801089:	85 c0                	test   %eax,%eax
+  80108b:	79 b2                	jns    80103f <sysbatch_add+0xc>
+  80108d:	eb ec                	jmp    80107b <sysbatch_add+0x48>
+
+0080108f <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80108f:	55                   	push   %ebp
+  801090:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801092:	8b 45 08             	mov    0x8(%ebp),%eax
+  801095:	05 00 00 00 30       	add    $0x30000000,%eax
+  80109a:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80109d:	5d                   	pop    %ebp
+  80109e:	c3                   	ret
+
+0080109f <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80109f:	55                   	push   %ebp
+  8010a0:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8010a2:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010a5:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  8010a8:	66 b8 00 00          	mov    $0x0,%ax
+  8010ac:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8010b1:	5d                   	pop    %ebp
+  8010b2:	c3                   	ret
+
+008010b3 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8010b3:	55                   	push   %ebp
+  8010b4:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  8010b6:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8010bb:	eb 02                	jmp    8010bf <fd_alloc+0xc>
+  8010bd:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8010bf:	89 c2                	mov    %eax,%edx
+  8010c1:	c1 ea 16             	shr    $0x16,%edx
+  8010c4:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8010cb:	f6 c2 01             	test   $0x1,%dl
+  8010ce:	74 2b                	je     8010fb <fd_alloc+0x48>
+  8010d0:	89 c2                	mov    %eax,%edx
+  8010d2:	c1 ea 0c             	shr    $0xc,%edx
+  8010d5:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8010dc:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8010e2:	f6 c1 01             	test   $0x1,%cl
+  8010e5:	74 14                	je     8010fb <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  8010e7:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8010ed:	75 ce                	jne    8010bd <fd_alloc+0xa>
+  8010ef:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  8010f4:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8010f9:	eb 05                	jmp    801100 <fd_alloc+0x4d>
+      return 0;
+  8010fb:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  801100:	8b 55 08             	mov    0x8(%ebp),%edx
+  801103:	89 02                	mov    %eax,(%edx)
+}
+  801105:	89 c8                	mov    %ecx,%eax
+  801107:	5d                   	pop    %ebp
+  801108:	c3                   	ret
+
+00801109 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801109:	55                   	push   %ebp
+  80110a:	89 e5                	mov    %esp,%ebp
+  80110c:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  80110f:	83 f8 1f             	cmp    $0x1f,%eax
+  801112:	77 30                	ja     801144 <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  801114:	c1 e0 0c             	shl    $0xc,%eax
+  801117:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80111c:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801122:	f6 c2 01             	test   $0x1,%dl
+  801125:	74 24                	je     80114b <fd_lookup+0x42>
+  801127:	89 c2                	mov    %eax,%edx
+  801129:	c1 ea 0c             	shr    $0xc,%edx
+  80112c:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801133:	f6 c2 01             	test   $0x1,%dl
+  801136:	74 1a                	je     801152 <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  801138:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80113b:	89 02                	mov    %eax,(%edx)
+  return 0;
+  80113d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801142:	5d                   	pop    %ebp
+  801143:	c3                   	ret
+    return -E_INVAL;
+  801144:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801149:	eb f7                	jmp    801142 <fd_lookup+0x39>
+    return -E_INVAL;
+  80114b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801150:	eb f0                	jmp    801142 <fd_lookup+0x39>
+  801152:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801157:	eb e9                	jmp    801142 <fd_lookup+0x39>
+
+00801159 <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801159:	55                   	push   %ebp
+  80115a:	89 e5                	mov    %esp,%ebp
+  80115c:	53                   	push   %ebx
+  80115d:	83 ec 04             	sub    $0x4,%esp
+  801160:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  801163:	b8 6c 3a 80 00       	mov    $0x803a6c,%eax
+  801168:	8b 18                	mov    (%eax),%ebx
+  80116a:	85 db                	test   %ebx,%ebx
+  80116c:	74 0e                	je     80117c <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  80116e:	83 c0 04             	add    $0x4,%eax
+  801171:	39 13                	cmp    %edx,(%ebx)
+  801173:	75 f3                	jne    801168 <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  801175:	b8 00 00 00 00       	mov    $0x0,%eax
+  80117a:	eb 1f                	jmp    80119b <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80117c:	a1 64 5e 80 00       	mov    0x805e64,%eax
+  801181:	8b 40 48             	mov    0x48(%eax),%eax
+  801184:	83 ec 04             	sub    $0x4,%esp
+  801187:	52                   	push   %edx
+  801188:	50                   	push   %eax
+  801189:	68 f0 39 80 00       	push   $0x8039f0
+  80118e:	e8 30 f0 ff ff       	call   8001c3 <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  801193:	83 c4 10             	add    $0x10,%esp
+  801196:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  80119b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80119e:	89 1a                	mov    %ebx,(%edx)
+}
+  8011a0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8011a3:	c9                   	leave
+  8011a4:	c3                   	ret
+
+008011a5 <fd_close>:
+{
+  8011a5:	55                   	push   %ebp
+  8011a6:	89 e5                	mov    %esp,%ebp
+  8011a8:	57                   	push   %edi
+  8011a9:	56                   	push   %esi
+  8011aa:	53                   	push   %ebx
+  8011ab:	83 ec 24             	sub    $0x24,%esp
+  8011ae:	8b 75 08             	mov    0x8(%ebp),%esi
+  8011b1:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8011b4:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8011b7:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8011b8:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8011be:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8011c1:	50                   	push   %eax
+  8011c2:	e8 42 ff ff ff       	call   801109 <fd_lookup>
+  8011c7:	89 c3                	mov    %eax,%ebx
+  8011c9:	83 c4 10             	add    $0x10,%esp
+  8011cc:	85 c0                	test   %eax,%eax
+  8011ce:	78 05                	js     8011d5 <fd_close+0x30>
+      || fd != fd2)
+  8011d0:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8011d3:	74 16                	je     8011eb <fd_close+0x46>
+    return must_exist ? r : 0;
+  8011d5:	89 f8                	mov    %edi,%eax
+  8011d7:	84 c0                	test   %al,%al
+  8011d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011de:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8011e1:	89 d8                	mov    %ebx,%eax
+  8011e3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011e6:	5b                   	pop    %ebx
+  8011e7:	5e                   	pop    %esi
+  8011e8:	5f                   	pop    %edi
+  8011e9:	5d                   	pop    %ebp
+  8011ea:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8011eb:	83 ec 08             	sub    $0x8,%esp
+  8011ee:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8011f1:	50                   	push   %eax
+  8011f2:	ff 36                	push   (%esi)
+  8011f4:	e8 60 ff ff ff       	call   801159 <dev_lookup>
+  8011f9:	89 c3                	mov    %eax,%ebx
+  8011fb:	83 c4 10             	add    $0x10,%esp
+  8011fe:	85 c0                	test   %eax,%eax
+  801200:	78 1a                	js     80121c <fd_close+0x77>
+    if (dev->dev_close)
+  801202:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801205:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  801208:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  80120d:	85 c0                	test   %eax,%eax
+  80120f:	74 0b                	je     80121c <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  801211:	83 ec 0c             	sub    $0xc,%esp
+  801214:	56                   	push   %esi
+  801215:	ff d0                	call   *%eax
+  801217:	89 c3                	mov    %eax,%ebx
+  801219:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  80121c:	83 ec 08             	sub    $0x8,%esp
+  80121f:	56                   	push   %esi
+  801220:	6a 00                	push   $0x0
+  801222:	e8 3e fa ff ff       	call   800c65 <sys_page_unmap>
+  return r;
+  801227:	83 c4 10             	add    $0x10,%esp
+  80122a:	eb b5                	jmp    8011e1 <fd_close+0x3c>
+
+0080122c <close>:
+
+int
+close(int fdnum)
+{
+  80122c:	55                   	push   %ebp
+  80122d:	89 e5                	mov    %esp,%ebp
+  80122f:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801232:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801235:	50                   	push   %eax
+  801236:	ff 75 08             	push   0x8(%ebp)
+  801239:	e8 cb fe ff ff       	call   801109 <fd_lookup>
+  80123e:	83 c4 10             	add    $0x10,%esp
+  801241:	85 c0                	test   %eax,%eax
+  801243:	79 02                	jns    801247 <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  801245:	c9                   	leave
+  801246:	c3                   	ret
+    return fd_close(fd, 1);
+  801247:	83 ec 08             	sub    $0x8,%esp
+  80124a:	6a 01                	push   $0x1
+  80124c:	ff 75 f4             	push   -0xc(%ebp)
+  80124f:	e8 51 ff ff ff       	call   8011a5 <fd_close>
+  801254:	83 c4 10             	add    $0x10,%esp
+  801257:	eb ec                	jmp    801245 <close+0x19>
+
+00801259 <close_all>:
+
+void
+close_all(void)
+{
+  801259:	55                   	push   %ebp
+  80125a:	89 e5                	mov    %esp,%ebp
+  80125c:	53                   	push   %ebx
+  80125d:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  801260:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  801265:	83 ec 0c             	sub    $0xc,%esp
+  801268:	53                   	push   %ebx
+  801269:	e8 be ff ff ff       	call   80122c <close>
+  for (i = 0; i < MAXFD; i++)
+  80126e:	83 c3 01             	add    $0x1,%ebx
+  801271:	83 c4 10             	add    $0x10,%esp
+  801274:	83 fb 20             	cmp    $0x20,%ebx
+  801277:	75 ec                	jne    801265 <close_all+0xc>
+}
+  801279:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80127c:	c9                   	leave
+  80127d:	c3                   	ret
+
+0080127e <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80127e:	55                   	push   %ebp
+  80127f:	89 e5                	mov    %esp,%ebp
+  801281:	57                   	push   %edi
+  801282:	56                   	push   %esi
+  801283:	53                   	push   %ebx
+  801284:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801287:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80128a:	50                   	push   %eax
+  80128b:	ff 75 08             	push   0x8(%ebp)
+  80128e:	e8 76 fe ff ff       	call   801109 <fd_lookup>
+  801293:	89 c6                	mov    %eax,%esi
+  801295:	83 c4 10             	add    $0x10,%esp
+  801298:	85 c0                	test   %eax,%eax
+  80129a:	0f 88 0a 01 00 00    	js     8013aa <dup+0x12c>
+    return r;
+  close(newfdnum);
+  8012a0:	83 ec 0c             	sub    $0xc,%esp
+  8012a3:	ff 75 0c             	push   0xc(%ebp)
+  8012a6:	e8 81 ff ff ff       	call   80122c <close>
+
+  newfd = INDEX2FD(newfdnum);
+  8012ab:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8012ae:	c1 e0 0c             	shl    $0xc,%eax
+  8012b1:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  8012b7:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  8012ba:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8012bd:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8012c0:	89 04 24             	mov    %eax,(%esp)
+  8012c3:	e8 d7 fd ff ff       	call   80109f <fd2data>
+  8012c8:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  8012ca:	89 3c 24             	mov    %edi,(%esp)
+  8012cd:	e8 cd fd ff ff       	call   80109f <fd2data>
+  8012d2:	83 c4 10             	add    $0x10,%esp
+  8012d5:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8012d8:	89 f3                	mov    %esi,%ebx
+  8012da:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  8012e0:	89 c6                	mov    %eax,%esi
+  8012e2:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8012e5:	89 cf                	mov    %ecx,%edi
+  8012e7:	eb 0c                	jmp    8012f5 <dup+0x77>
+  8012e9:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8012ef:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8012f5:	39 fb                	cmp    %edi,%ebx
+  8012f7:	74 7b                	je     801374 <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  8012f9:	89 d8                	mov    %ebx,%eax
+  8012fb:	c1 e8 16             	shr    $0x16,%eax
+  8012fe:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801305:	a8 01                	test   $0x1,%al
+  801307:	74 e0                	je     8012e9 <dup+0x6b>
+  801309:	89 d8                	mov    %ebx,%eax
+  80130b:	c1 e8 0c             	shr    $0xc,%eax
+  80130e:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801315:	f6 c2 01             	test   $0x1,%dl
+  801318:	74 cf                	je     8012e9 <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  80131a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  801321:	83 ec 0c             	sub    $0xc,%esp
+  801324:	25 07 0e 00 00       	and    $0xe07,%eax
+  801329:	50                   	push   %eax
+  80132a:	56                   	push   %esi
+  80132b:	6a 00                	push   $0x0
+  80132d:	53                   	push   %ebx
+  80132e:	6a 00                	push   $0x0
+  801330:	e8 ee f8 ff ff       	call   800c23 <sys_page_map>
+  801335:	83 c4 20             	add    $0x20,%esp
+  801338:	85 c0                	test   %eax,%eax
+  80133a:	79 ad                	jns    8012e9 <dup+0x6b>
+  80133c:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80133f:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  801341:	83 ec 08             	sub    $0x8,%esp
+  801344:	ff 75 d4             	push   -0x2c(%ebp)
+  801347:	6a 00                	push   $0x0
+  801349:	e8 17 f9 ff ff       	call   800c65 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80134e:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  801351:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  801357:	83 c4 10             	add    $0x10,%esp
+  80135a:	39 df                	cmp    %ebx,%edi
+  80135c:	74 4c                	je     8013aa <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  80135e:	83 ec 08             	sub    $0x8,%esp
+  801361:	57                   	push   %edi
+  801362:	6a 00                	push   $0x0
+  801364:	e8 fc f8 ff ff       	call   800c65 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801369:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  80136f:	83 c4 10             	add    $0x10,%esp
+  801372:	eb e6                	jmp    80135a <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801374:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801377:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80137a:	89 c8                	mov    %ecx,%eax
+  80137c:	c1 e8 0c             	shr    $0xc,%eax
+  80137f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801386:	83 ec 0c             	sub    $0xc,%esp
+  801389:	25 07 0e 00 00       	and    $0xe07,%eax
+  80138e:	50                   	push   %eax
+  80138f:	ff 75 d4             	push   -0x2c(%ebp)
+  801392:	6a 00                	push   $0x0
+  801394:	51                   	push   %ecx
+  801395:	6a 00                	push   $0x0
+  801397:	e8 87 f8 ff ff       	call   800c23 <sys_page_map>
+  80139c:	89 c6                	mov    %eax,%esi
+  80139e:	83 c4 20             	add    $0x20,%esp
+  8013a1:	85 c0                	test   %eax,%eax
+  8013a3:	78 9c                	js     801341 <dup+0xc3>
+  return newfdnum;
+  8013a5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8013a8:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  8013aa:	89 f0                	mov    %esi,%eax
+  8013ac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013af:	5b                   	pop    %ebx
+  8013b0:	5e                   	pop    %esi
+  8013b1:	5f                   	pop    %edi
+  8013b2:	5d                   	pop    %ebp
+  8013b3:	c3                   	ret
+
+008013b4 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8013b4:	55                   	push   %ebp
+  8013b5:	89 e5                	mov    %esp,%ebp
+  8013b7:	56                   	push   %esi
+  8013b8:	53                   	push   %ebx
+  8013b9:	83 ec 18             	sub    $0x18,%esp
+  8013bc:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  8013bf:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8013c2:	50                   	push   %eax
+  8013c3:	56                   	push   %esi
+  8013c4:	e8 40 fd ff ff       	call   801109 <fd_lookup>
+  8013c9:	83 c4 10             	add    $0x10,%esp
+  8013cc:	85 c0                	test   %eax,%eax
+  8013ce:	78 3c                	js     80140c <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8013d0:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8013d3:	83 ec 08             	sub    $0x8,%esp
+  8013d6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8013d9:	50                   	push   %eax
+  8013da:	ff 33                	push   (%ebx)
+  8013dc:	e8 78 fd ff ff       	call   801159 <dev_lookup>
+  8013e1:	83 c4 10             	add    $0x10,%esp
+  8013e4:	85 c0                	test   %eax,%eax
+  8013e6:	78 24                	js     80140c <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8013e8:	8b 43 08             	mov    0x8(%ebx),%eax
+  8013eb:	83 e0 03             	and    $0x3,%eax
+  8013ee:	83 f8 01             	cmp    $0x1,%eax
+  8013f1:	74 20                	je     801413 <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  8013f3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8013f6:	8b 40 08             	mov    0x8(%eax),%eax
+  8013f9:	85 c0                	test   %eax,%eax
+  8013fb:	74 37                	je     801434 <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  8013fd:	83 ec 04             	sub    $0x4,%esp
+  801400:	ff 75 10             	push   0x10(%ebp)
+  801403:	ff 75 0c             	push   0xc(%ebp)
+  801406:	53                   	push   %ebx
+  801407:	ff d0                	call   *%eax
+  801409:	83 c4 10             	add    $0x10,%esp
+}
+  80140c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80140f:	5b                   	pop    %ebx
+  801410:	5e                   	pop    %esi
+  801411:	5d                   	pop    %ebp
+  801412:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801413:	a1 64 5e 80 00       	mov    0x805e64,%eax
+  801418:	8b 40 48             	mov    0x48(%eax),%eax
+  80141b:	83 ec 04             	sub    $0x4,%esp
+  80141e:	56                   	push   %esi
+  80141f:	50                   	push   %eax
+  801420:	68 31 3a 80 00       	push   $0x803a31
+  801425:	e8 99 ed ff ff       	call   8001c3 <cprintf>
+    return -E_INVAL;
+  80142a:	83 c4 10             	add    $0x10,%esp
+  80142d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801432:	eb d8                	jmp    80140c <read+0x58>
+    return -E_NOT_SUPP;
+  801434:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801439:	eb d1                	jmp    80140c <read+0x58>
+
+0080143b <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80143b:	55                   	push   %ebp
+  80143c:	89 e5                	mov    %esp,%ebp
+  80143e:	57                   	push   %edi
+  80143f:	56                   	push   %esi
+  801440:	53                   	push   %ebx
+  801441:	83 ec 0c             	sub    $0xc,%esp
+  801444:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801447:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  80144a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80144f:	eb 02                	jmp    801453 <readn+0x18>
+  801451:	01 c3                	add    %eax,%ebx
+  801453:	39 f3                	cmp    %esi,%ebx
+  801455:	73 21                	jae    801478 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  801457:	83 ec 04             	sub    $0x4,%esp
+  80145a:	89 f0                	mov    %esi,%eax
+  80145c:	29 d8                	sub    %ebx,%eax
+  80145e:	50                   	push   %eax
+  80145f:	89 d8                	mov    %ebx,%eax
+  801461:	03 45 0c             	add    0xc(%ebp),%eax
+  801464:	50                   	push   %eax
+  801465:	57                   	push   %edi
+  801466:	e8 49 ff ff ff       	call   8013b4 <read>
+    if (m < 0)
+  80146b:	83 c4 10             	add    $0x10,%esp
+  80146e:	85 c0                	test   %eax,%eax
+  801470:	78 04                	js     801476 <readn+0x3b>
+      return m;
+    if (m == 0)
+  801472:	75 dd                	jne    801451 <readn+0x16>
+  801474:	eb 02                	jmp    801478 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  801476:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  801478:	89 d8                	mov    %ebx,%eax
+  80147a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80147d:	5b                   	pop    %ebx
+  80147e:	5e                   	pop    %esi
+  80147f:	5f                   	pop    %edi
+  801480:	5d                   	pop    %ebp
+  801481:	c3                   	ret
+
+00801482 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801482:	55                   	push   %ebp
+  801483:	89 e5                	mov    %esp,%ebp
+  801485:	56                   	push   %esi
+  801486:	53                   	push   %ebx
+  801487:	83 ec 18             	sub    $0x18,%esp
+  80148a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  80148d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801490:	50                   	push   %eax
+  801491:	53                   	push   %ebx
+  801492:	e8 72 fc ff ff       	call   801109 <fd_lookup>
+  801497:	83 c4 10             	add    $0x10,%esp
+  80149a:	85 c0                	test   %eax,%eax
+  80149c:	78 37                	js     8014d5 <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80149e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8014a1:	83 ec 08             	sub    $0x8,%esp
+  8014a4:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8014a7:	50                   	push   %eax
+  8014a8:	ff 36                	push   (%esi)
+  8014aa:	e8 aa fc ff ff       	call   801159 <dev_lookup>
+  8014af:	83 c4 10             	add    $0x10,%esp
+  8014b2:	85 c0                	test   %eax,%eax
+  8014b4:	78 1f                	js     8014d5 <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8014b6:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8014ba:	74 20                	je     8014dc <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  8014bc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8014bf:	8b 40 0c             	mov    0xc(%eax),%eax
+  8014c2:	85 c0                	test   %eax,%eax
+  8014c4:	74 37                	je     8014fd <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  8014c6:	83 ec 04             	sub    $0x4,%esp
+  8014c9:	ff 75 10             	push   0x10(%ebp)
+  8014cc:	ff 75 0c             	push   0xc(%ebp)
+  8014cf:	56                   	push   %esi
+  8014d0:	ff d0                	call   *%eax
+  8014d2:	83 c4 10             	add    $0x10,%esp
+}
+  8014d5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8014d8:	5b                   	pop    %ebx
+  8014d9:	5e                   	pop    %esi
+  8014da:	5d                   	pop    %ebp
+  8014db:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8014dc:	a1 64 5e 80 00       	mov    0x805e64,%eax
+  8014e1:	8b 40 48             	mov    0x48(%eax),%eax
+  8014e4:	83 ec 04             	sub    $0x4,%esp
+  8014e7:	53                   	push   %ebx
+  8014e8:	50                   	push   %eax
+  8014e9:	68 4d 3a 80 00       	push   $0x803a4d
+  8014ee:	e8 d0 ec ff ff       	call   8001c3 <cprintf>
+    return -E_INVAL;
+  8014f3:	83 c4 10             	add    $0x10,%esp
+  8014f6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8014fb:	eb d8                	jmp    8014d5 <write+0x53>
+    return -E_NOT_SUPP;
+  8014fd:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801502:	eb d1                	jmp    8014d5 <write+0x53>
+
+00801504 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801504:	55                   	push   %ebp
+  801505:	89 e5                	mov    %esp,%ebp
+  801507:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80150a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80150d:	50                   	push   %eax
+  80150e:	ff 75 08             	push   0x8(%ebp)
+  801511:	e8 f3 fb ff ff       	call   801109 <fd_lookup>
+  801516:	83 c4 10             	add    $0x10,%esp
+  801519:	85 c0                	test   %eax,%eax
+  80151b:	78 0e                	js     80152b <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  80151d:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801520:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801523:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  801526:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80152b:	c9                   	leave
+  80152c:	c3                   	ret
+
+0080152d <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80152d:	55                   	push   %ebp
+  80152e:	89 e5                	mov    %esp,%ebp
+  801530:	56                   	push   %esi
+  801531:	53                   	push   %ebx
+  801532:	83 ec 18             	sub    $0x18,%esp
+  801535:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801538:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80153b:	50                   	push   %eax
+  80153c:	53                   	push   %ebx
+  80153d:	e8 c7 fb ff ff       	call   801109 <fd_lookup>
+  801542:	83 c4 10             	add    $0x10,%esp
+  801545:	85 c0                	test   %eax,%eax
+  801547:	78 34                	js     80157d <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801549:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80154c:	83 ec 08             	sub    $0x8,%esp
+  80154f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801552:	50                   	push   %eax
+  801553:	ff 36                	push   (%esi)
+  801555:	e8 ff fb ff ff       	call   801159 <dev_lookup>
+  80155a:	83 c4 10             	add    $0x10,%esp
+  80155d:	85 c0                	test   %eax,%eax
+  80155f:	78 1c                	js     80157d <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801561:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801565:	74 1d                	je     801584 <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  801567:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80156a:	8b 40 18             	mov    0x18(%eax),%eax
+  80156d:	85 c0                	test   %eax,%eax
+  80156f:	74 34                	je     8015a5 <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  801571:	83 ec 08             	sub    $0x8,%esp
+  801574:	ff 75 0c             	push   0xc(%ebp)
+  801577:	56                   	push   %esi
+  801578:	ff d0                	call   *%eax
+  80157a:	83 c4 10             	add    $0x10,%esp
+}
+  80157d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801580:	5b                   	pop    %ebx
+  801581:	5e                   	pop    %esi
+  801582:	5d                   	pop    %ebp
+  801583:	c3                   	ret
+            thisenv->env_id, fdnum);
+  801584:	a1 64 5e 80 00       	mov    0x805e64,%eax
+  801589:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80158c:	83 ec 04             	sub    $0x4,%esp
+  80158f:	53                   	push   %ebx
+  801590:	50                   	push   %eax
+  801591:	68 10 3a 80 00       	push   $0x803a10
+  801596:	e8 28 ec ff ff       	call   8001c3 <cprintf>
+    return -E_INVAL;
+  80159b:	83 c4 10             	add    $0x10,%esp
+  80159e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015a3:	eb d8                	jmp    80157d <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  8015a5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8015aa:	eb d1                	jmp    80157d <ftruncate+0x50>
+
+008015ac <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8015ac:	55                   	push   %ebp
+  8015ad:	89 e5                	mov    %esp,%ebp
+  8015af:	56                   	push   %esi
+  8015b0:	53                   	push   %ebx
+  8015b1:	83 ec 18             	sub    $0x18,%esp
+  8015b4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  8015b7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8015ba:	50                   	push   %eax
+  8015bb:	ff 75 08             	push   0x8(%ebp)
+  8015be:	e8 46 fb ff ff       	call   801109 <fd_lookup>
+  8015c3:	83 c4 10             	add    $0x10,%esp
+  8015c6:	85 c0                	test   %eax,%eax
+  8015c8:	78 49                	js     801613 <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8015ca:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8015cd:	83 ec 08             	sub    $0x8,%esp
+  8015d0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015d3:	50                   	push   %eax
+  8015d4:	ff 36                	push   (%esi)
+  8015d6:	e8 7e fb ff ff       	call   801159 <dev_lookup>
+  8015db:	83 c4 10             	add    $0x10,%esp
+  8015de:	85 c0                	test   %eax,%eax
+  8015e0:	78 31                	js     801613 <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  8015e2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015e5:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8015e9:	74 2f                	je     80161a <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  8015eb:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  8015ee:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8015f5:	00 00 00 
+  stat->st_isdir = 0;
+  8015f8:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8015ff:	00 00 00 
+  stat->st_dev = dev;
+  801602:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  801608:	83 ec 08             	sub    $0x8,%esp
+  80160b:	53                   	push   %ebx
+  80160c:	56                   	push   %esi
+  80160d:	ff 50 14             	call   *0x14(%eax)
+  801610:	83 c4 10             	add    $0x10,%esp
+}
+  801613:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801616:	5b                   	pop    %ebx
+  801617:	5e                   	pop    %esi
+  801618:	5d                   	pop    %ebp
+  801619:	c3                   	ret
+    return -E_NOT_SUPP;
+  80161a:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80161f:	eb f2                	jmp    801613 <fstat+0x67>
+
+00801621 <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  801621:	55                   	push   %ebp
+  801622:	89 e5                	mov    %esp,%ebp
+  801624:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  801627:	ff 75 0c             	push   0xc(%ebp)
+  80162a:	ff 75 08             	push   0x8(%ebp)
+  80162d:	e8 58 07 00 00       	call   801d8a <file_stat>
+}
+  801632:	c9                   	leave
+  801633:	c3                   	ret
+
+00801634 <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  801634:	55                   	push   %ebp
+  801635:	89 e5                	mov    %esp,%ebp
+  801637:	57                   	push   %edi
+  801638:	56                   	push   %esi
+  801639:	53                   	push   %ebx
+  80163a:	83 ec 1c             	sub    $0x1c,%esp
+  80163d:	89 c7                	mov    %eax,%edi
+  80163f:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801642:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801645:	e9 a2 00 00 00       	jmp    8016ec <fsipc_send+0xb8>
+  nfsenvs = 0;
+  80164a:	c7 05 00 50 80 00 00 	movl   $0x0,0x805000
+  801651:	00 00 00 
+  801654:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801659:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  80165e:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801663:	be 01 00 00 00       	mov    $0x1,%esi
+  801668:	eb 0f                	jmp    801679 <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  80166a:	83 c0 01             	add    $0x1,%eax
+  80166d:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801672:	74 49                	je     8016bd <fsipc_send+0x89>
+  801674:	83 f9 07             	cmp    $0x7,%ecx
+  801677:	7f 50                	jg     8016c9 <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  801679:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  80167c:	c1 e2 04             	shl    $0x4,%edx
+  80167f:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801685:	8b 52 50             	mov    0x50(%edx),%edx
+  801688:	83 fa 01             	cmp    $0x1,%edx
+  80168b:	75 dd                	jne    80166a <fsipc_send+0x36>
+  80168d:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801690:	c1 e2 04             	shl    $0x4,%edx
+  801693:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801699:	8b 52 54             	mov    0x54(%edx),%edx
+  80169c:	85 d2                	test   %edx,%edx
+  80169e:	74 ca                	je     80166a <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  8016a0:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  8016a3:	c1 e2 04             	shl    $0x4,%edx
+  8016a6:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8016ac:	8b 52 48             	mov    0x48(%edx),%edx
+  8016af:	89 14 8d 20 50 80 00 	mov    %edx,0x805020(,%ecx,4)
+  8016b6:	8d 49 01             	lea    0x1(%ecx),%ecx
+  8016b9:	89 f3                	mov    %esi,%ebx
+  8016bb:	eb ad                	jmp    80166a <fsipc_send+0x36>
+  8016bd:	84 db                	test   %bl,%bl
+  8016bf:	74 38                	je     8016f9 <fsipc_send+0xc5>
+  8016c1:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  8016c7:	eb 30                	jmp    8016f9 <fsipc_send+0xc5>
+  8016c9:	84 db                	test   %bl,%bl
+  8016cb:	74 2c                	je     8016f9 <fsipc_send+0xc5>
+  8016cd:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  8016d3:	eb 24                	jmp    8016f9 <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  8016d5:	50                   	push   %eax
+  8016d6:	68 7c 3a 80 00       	push   $0x803a7c
+  8016db:	6a 34                	push   $0x34
+  8016dd:	68 86 3a 80 00       	push   $0x803a86
+  8016e2:	e8 01 ea ff ff       	call   8000e8 <_panic>
+    }
+    sys_yield();
+  8016e7:	e8 92 f4 ff ff       	call   800b7e <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  8016ec:	83 3d 00 50 80 00 03 	cmpl   $0x3,0x805000
+  8016f3:	0f 8e 51 ff ff ff    	jle    80164a <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  8016f9:	a1 64 5e 80 00       	mov    0x805e64,%eax
+  8016fe:	8b 70 48             	mov    0x48(%eax),%esi
+  801701:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  801707:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80170c:	8b 0d 00 50 80 00    	mov    0x805000,%ecx
+  801712:	39 d9                	cmp    %ebx,%ecx
+  801714:	7e d1                	jle    8016e7 <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  801716:	83 ec 0c             	sub    $0xc,%esp
+  801719:	ff 75 e0             	push   -0x20(%ebp)
+  80171c:	6a 07                	push   $0x7
+  80171e:	ff 75 e4             	push   -0x1c(%ebp)
+  801721:	57                   	push   %edi
+  801722:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  801725:	99                   	cltd
+  801726:	f7 f9                	idiv   %ecx
+  801728:	ff 34 95 20 50 80 00 	push   0x805020(,%edx,4)
+  80172f:	e8 63 f7 ff ff       	call   800e97 <sys_ipc_try_send>
+      if (r == 0)
+  801734:	83 c4 20             	add    $0x20,%esp
+  801737:	85 c0                	test   %eax,%eax
+  801739:	74 0a                	je     801745 <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  80173b:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80173e:	75 95                	jne    8016d5 <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  801740:	83 c3 01             	add    $0x1,%ebx
+  801743:	eb c7                	jmp    80170c <fsipc_send+0xd8>
+  }
+}
+  801745:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801748:	5b                   	pop    %ebx
+  801749:	5e                   	pop    %esi
+  80174a:	5f                   	pop    %edi
+  80174b:	5d                   	pop    %ebp
+  80174c:	c3                   	ret
+
+0080174d <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  80174d:	55                   	push   %ebp
+  80174e:	89 e5                	mov    %esp,%ebp
+  801750:	53                   	push   %ebx
+  801751:	83 ec 14             	sub    $0x14,%esp
+  801754:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  801756:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  80175d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801762:	ba 00 60 80 00       	mov    $0x806000,%edx
+  801767:	e8 c8 fe ff ff       	call   801634 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  80176c:	6a 00                	push   $0x0
+  80176e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801771:	50                   	push   %eax
+  801772:	53                   	push   %ebx
+  801773:	6a 00                	push   $0x0
+  801775:	e8 cd 1a 00 00       	call   803247 <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  80177a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80177d:	c9                   	leave
+  80177e:	c3                   	ret
+
+0080177f <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  80177f:	55                   	push   %ebp
+  801780:	89 e5                	mov    %esp,%ebp
+  801782:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801785:	8b 45 08             	mov    0x8(%ebp),%eax
+  801788:	8b 40 0c             	mov    0xc(%eax),%eax
+  80178b:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.set_size.req_size = newsize;
+  801790:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801793:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801798:	ba 00 00 00 00       	mov    $0x0,%edx
+  80179d:	b8 02 00 00 00       	mov    $0x2,%eax
+  8017a2:	e8 a6 ff ff ff       	call   80174d <fsipc>
+}
+  8017a7:	c9                   	leave
+  8017a8:	c3                   	ret
+
+008017a9 <devfile_flush>:
+{
+  8017a9:	55                   	push   %ebp
+  8017aa:	89 e5                	mov    %esp,%ebp
+  8017ac:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8017af:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017b2:	8b 40 0c             	mov    0xc(%eax),%eax
+  8017b5:	a3 00 60 80 00       	mov    %eax,0x806000
+  return fsipc(FSREQ_FLUSH, NULL);
+  8017ba:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017bf:	b8 06 00 00 00       	mov    $0x6,%eax
+  8017c4:	e8 84 ff ff ff       	call   80174d <fsipc>
+}
+  8017c9:	c9                   	leave
+  8017ca:	c3                   	ret
+
+008017cb <devfile_stat>:
+{
+  8017cb:	55                   	push   %ebp
+  8017cc:	89 e5                	mov    %esp,%ebp
+  8017ce:	53                   	push   %ebx
+  8017cf:	83 ec 04             	sub    $0x4,%esp
+  8017d2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8017d5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017d8:	8b 40 0c             	mov    0xc(%eax),%eax
+  8017db:	a3 00 60 80 00       	mov    %eax,0x806000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  8017e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017e5:	b8 05 00 00 00       	mov    $0x5,%eax
+  8017ea:	e8 5e ff ff ff       	call   80174d <fsipc>
+  8017ef:	85 c0                	test   %eax,%eax
+  8017f1:	78 2c                	js     80181f <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8017f3:	83 ec 08             	sub    $0x8,%esp
+  8017f6:	68 00 60 80 00       	push   $0x806000
+  8017fb:	53                   	push   %ebx
+  8017fc:	e8 b0 ef ff ff       	call   8007b1 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  801801:	a1 80 60 80 00       	mov    0x806080,%eax
+  801806:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80180c:	a1 84 60 80 00       	mov    0x806084,%eax
+  801811:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801817:	83 c4 10             	add    $0x10,%esp
+  80181a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80181f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801822:	c9                   	leave
+  801823:	c3                   	ret
+
+00801824 <fsv_alloc>:
+{
+  801824:	55                   	push   %ebp
+  801825:	89 e5                	mov    %esp,%ebp
+  801827:	56                   	push   %esi
+  801828:	53                   	push   %ebx
+  801829:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  80182b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801830:	eb 22                	jmp    801854 <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  801832:	83 ec 04             	sub    $0x4,%esp
+  801835:	6a 00                	push   $0x0
+  801837:	6a 00                	push   $0x0
+  801839:	6a 07                	push   $0x7
+  80183b:	50                   	push   %eax
+  80183c:	6a 00                	push   $0x0
+  80183e:	6a 04                	push   $0x4
+  801840:	68 40 50 80 00       	push   $0x805040
+  801845:	e8 e9 f7 ff ff       	call   801033 <sysbatch_add>
+  80184a:	83 c4 20             	add    $0x20,%esp
+  80184d:	85 c0                	test   %eax,%eax
+  80184f:	78 48                	js     801899 <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  801851:	83 c3 01             	add    $0x1,%ebx
+  801854:	39 f3                	cmp    %esi,%ebx
+  801856:	74 31                	je     801889 <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  801858:	89 d8                	mov    %ebx,%eax
+  80185a:	c1 e0 0c             	shl    $0xc,%eax
+  80185d:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801862:	89 c2                	mov    %eax,%edx
+  801864:	c1 ea 16             	shr    $0x16,%edx
+  801867:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80186e:	f6 c2 01             	test   $0x1,%dl
+  801871:	74 bf                	je     801832 <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  801873:	89 c2                	mov    %eax,%edx
+  801875:	c1 ea 0c             	shr    $0xc,%edx
+  801878:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80187f:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801882:	83 fa 03             	cmp    $0x3,%edx
+  801885:	75 ab                	jne    801832 <fsv_alloc+0xe>
+  801887:	eb c8                	jmp    801851 <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  801889:	83 ec 0c             	sub    $0xc,%esp
+  80188c:	68 40 50 80 00       	push   $0x805040
+  801891:	e8 4d f7 ff ff       	call   800fe3 <sysbatch_flush>
+  801896:	83 c4 10             	add    $0x10,%esp
+}
+  801899:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80189c:	5b                   	pop    %ebx
+  80189d:	5e                   	pop    %esi
+  80189e:	5d                   	pop    %ebp
+  80189f:	c3                   	ret
+
+008018a0 <devfile_read>:
+{
+  8018a0:	55                   	push   %ebp
+  8018a1:	89 e5                	mov    %esp,%ebp
+  8018a3:	57                   	push   %edi
+  8018a4:	56                   	push   %esi
+  8018a5:	53                   	push   %ebx
+  8018a6:	83 ec 3c             	sub    $0x3c,%esp
+  8018a9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  8018ac:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  8018b2:	77 57                	ja     80190b <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8018b4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8018b7:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018ba:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read.req_n = n;
+  8018bf:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  8018c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018ca:	b8 03 00 00 00       	mov    $0x3,%eax
+  8018cf:	e8 79 fe ff ff       	call   80174d <fsipc>
+  8018d4:	89 c6                	mov    %eax,%esi
+  8018d6:	85 c0                	test   %eax,%eax
+  8018d8:	78 27                	js     801901 <devfile_read+0x61>
+  assert(r <= n);
+  8018da:	39 c3                	cmp    %eax,%ebx
+  8018dc:	0f 82 0e 02 00 00    	jb     801af0 <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  8018e2:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  8018e7:	0f 8f 1c 02 00 00    	jg     801b09 <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  8018ed:	83 ec 04             	sub    $0x4,%esp
+  8018f0:	50                   	push   %eax
+  8018f1:	68 00 60 80 00       	push   $0x806000
+  8018f6:	ff 75 0c             	push   0xc(%ebp)
+  8018f9:	e8 39 f0 ff ff       	call   800937 <memmove>
+  return r;
+  8018fe:	83 c4 10             	add    $0x10,%esp
+}
+  801901:	89 f0                	mov    %esi,%eax
+  801903:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801906:	5b                   	pop    %ebx
+  801907:	5e                   	pop    %esi
+  801908:	5f                   	pop    %edi
+  801909:	5d                   	pop    %ebp
+  80190a:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  80190b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801910:	e8 0f ff ff ff       	call   801824 <fsv_alloc>
+  801915:	89 c6                	mov    %eax,%esi
+  801917:	85 c0                	test   %eax,%eax
+  801919:	78 e6                	js     801901 <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  80191b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80191e:	8b 40 0c             	mov    0xc(%eax),%eax
+  801921:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  801926:	8b 45 08             	mov    0x8(%ebp),%eax
+  801929:	8b 40 04             	mov    0x4(%eax),%eax
+  80192c:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  801931:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  801937:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  80193e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801943:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801948:	b8 0c 00 00 00       	mov    $0xc,%eax
+  80194d:	e8 e2 fc ff ff       	call   801634 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801952:	6a 00                	push   $0x0
+  801954:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801957:	50                   	push   %eax
+  801958:	68 00 10 c0 9f       	push   $0x9fc01000
+  80195d:	6a 00                	push   $0x0
+  80195f:	e8 e3 18 00 00       	call   803247 <ipc_recv_pages>
+  801964:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  801966:	83 c4 10             	add    $0x10,%esp
+  801969:	85 c0                	test   %eax,%eax
+  80196b:	7e 94                	jle    801901 <devfile_read+0x61>
+  assert(r <= n);
+  80196d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801970:	39 c3                	cmp    %eax,%ebx
+  801972:	72 2e                	jb     8019a2 <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801974:	8b 45 08             	mov    0x8(%ebp),%eax
+  801977:	8b 40 04             	mov    0x4(%eax),%eax
+  80197a:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80197f:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  801982:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801985:	c1 e2 0c             	shl    $0xc,%edx
+  801988:	39 ca                	cmp    %ecx,%edx
+  80198a:	72 2f                	jb     8019bb <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  80198c:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  801991:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  801994:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  801998:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  80199d:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  8019a0:	eb 52                	jmp    8019f4 <devfile_read+0x154>
+  assert(r <= n);
+  8019a2:	68 91 3a 80 00       	push   $0x803a91
+  8019a7:	68 98 3a 80 00       	push   $0x803a98
+  8019ac:	68 49 01 00 00       	push   $0x149
+  8019b1:	68 86 3a 80 00       	push   $0x803a86
+  8019b6:	e8 2d e7 ff ff       	call   8000e8 <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  8019bb:	68 bc 3a 80 00       	push   $0x803abc
+  8019c0:	68 98 3a 80 00       	push   $0x803a98
+  8019c5:	68 4a 01 00 00       	push   $0x14a
+  8019ca:	68 86 3a 80 00       	push   $0x803a86
+  8019cf:	e8 14 e7 ff ff       	call   8000e8 <_panic>
+      memmove(dst + done, src + done, m);
+  8019d4:	83 ec 04             	sub    $0x4,%esp
+  8019d7:	53                   	push   %ebx
+  8019d8:	56                   	push   %esi
+  8019d9:	89 f8                	mov    %edi,%eax
+  8019db:	03 45 0c             	add    0xc(%ebp),%eax
+  8019de:	50                   	push   %eax
+  8019df:	e8 53 ef ff ff       	call   800937 <memmove>
+  8019e4:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  8019e7:	01 df                	add    %ebx,%edi
+  8019e9:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8019ec:	39 c7                	cmp    %eax,%edi
+  8019ee:	0f 83 c0 00 00 00    	jae    801ab4 <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  8019f4:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8019f7:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  8019fa:	89 f0                	mov    %esi,%eax
+  8019fc:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801a01:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  801a06:	29 c3                	sub    %eax,%ebx
+  801a08:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801a0b:	29 f8                	sub    %edi,%eax
+  801a0d:	39 c3                	cmp    %eax,%ebx
+  801a0f:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  801a12:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801a18:	75 ba                	jne    8019d4 <devfile_read+0x134>
+  801a1a:	89 f9                	mov    %edi,%ecx
+  801a1c:	03 4d 0c             	add    0xc(%ebp),%ecx
+  801a1f:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  801a22:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  801a28:	75 aa                	jne    8019d4 <devfile_read+0x134>
+  801a2a:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  801a30:	77 a2                	ja     8019d4 <devfile_read+0x134>
+  801a32:	89 c8                	mov    %ecx,%eax
+  801a34:	c1 e8 16             	shr    $0x16,%eax
+  801a37:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801a3e:	a8 01                	test   $0x1,%al
+  801a40:	74 92                	je     8019d4 <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  801a42:	89 c8                	mov    %ecx,%eax
+  801a44:	c1 e8 0c             	shr    $0xc,%eax
+  801a47:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  801a4e:	a8 01                	test   $0x1,%al
+  801a50:	74 82                	je     8019d4 <devfile_read+0x134>
+  801a52:	a9 02 08 00 00       	test   $0x802,%eax
+  801a57:	0f 84 77 ff ff ff    	je     8019d4 <devfile_read+0x134>
+  801a5d:	f6 c4 04             	test   $0x4,%ah
+  801a60:	0f 85 6e ff ff ff    	jne    8019d4 <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  801a66:	a1 64 5e 80 00       	mov    0x805e64,%eax
+  801a6b:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  801a6f:	84 c0                	test   %al,%al
+  801a71:	75 17                	jne    801a8a <devfile_read+0x1ea>
+  801a73:	83 ec 08             	sub    $0x8,%esp
+  801a76:	6a 01                	push   $0x1
+  801a78:	6a 00                	push   $0x0
+  801a7a:	e8 1e f1 ff ff       	call   800b9d <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  801a7f:	83 c4 10             	add    $0x10,%esp
+  801a82:	85 c0                	test   %eax,%eax
+  801a84:	0f 85 4a ff ff ff    	jne    8019d4 <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  801a8a:	83 ec 04             	sub    $0x4,%esp
+  801a8d:	68 05 08 00 00       	push   $0x805
+  801a92:	ff 75 cc             	push   -0x34(%ebp)
+  801a95:	6a 00                	push   $0x0
+  801a97:	56                   	push   %esi
+  801a98:	6a 00                	push   $0x0
+  801a9a:	6a 05                	push   $0x5
+  801a9c:	68 40 50 80 00       	push   $0x805040
+  801aa1:	e8 8d f5 ff ff       	call   801033 <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  801aa6:	c1 e8 1f             	shr    $0x1f,%eax
+  801aa9:	08 45 cb             	or     %al,-0x35(%ebp)
+  801aac:	83 c4 20             	add    $0x20,%esp
+  801aaf:	e9 33 ff ff ff       	jmp    8019e7 <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  801ab4:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  801ab7:	83 ec 0c             	sub    $0xc,%esp
+  801aba:	68 40 50 80 00       	push   $0x805040
+  801abf:	e8 1f f5 ff ff       	call   800fe3 <sysbatch_flush>
+  801ac4:	83 c4 10             	add    $0x10,%esp
+  801ac7:	85 c0                	test   %eax,%eax
+  801ac9:	78 06                	js     801ad1 <devfile_read+0x231>
+  801acb:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  801acf:	74 14                	je     801ae5 <devfile_read+0x245>
+    memmove(dst, src, r);
+  801ad1:	83 ec 04             	sub    $0x4,%esp
+  801ad4:	ff 75 d4             	push   -0x2c(%ebp)
+  801ad7:	ff 75 d0             	push   -0x30(%ebp)
+  801ada:	ff 75 0c             	push   0xc(%ebp)
+  801add:	e8 55 ee ff ff       	call   800937 <memmove>
+  801ae2:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  801ae5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ae8:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  801aeb:	e9 11 fe ff ff       	jmp    801901 <devfile_read+0x61>
+  assert(r <= n);
+  801af0:	68 91 3a 80 00       	push   $0x803a91
+  801af5:	68 98 3a 80 00       	push   $0x803a98
+  801afa:	68 1c 01 00 00       	push   $0x11c
+  801aff:	68 86 3a 80 00       	push   $0x803a86
+  801b04:	e8 df e5 ff ff       	call   8000e8 <_panic>
+  assert(r <= PGSIZE);
+  801b09:	68 ad 3a 80 00       	push   $0x803aad
+  801b0e:	68 98 3a 80 00       	push   $0x803a98
+  801b13:	68 1d 01 00 00       	push   $0x11d
+  801b18:	68 86 3a 80 00       	push   $0x803a86
+  801b1d:	e8 c6 e5 ff ff       	call   8000e8 <_panic>
+
+00801b22 <devfile_write>:
+{
+  801b22:	55                   	push   %ebp
+  801b23:	89 e5                	mov    %esp,%ebp
+  801b25:	57                   	push   %edi
+  801b26:	56                   	push   %esi
+  801b27:	53                   	push   %ebx
+  801b28:	83 ec 1c             	sub    $0x1c,%esp
+  801b2b:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b2e:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  801b31:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  801b36:	77 39                	ja     801b71 <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801b38:	8b 56 0c             	mov    0xc(%esi),%edx
+  801b3b:	89 15 00 60 80 00    	mov    %edx,0x806000
+  fsipcbuf.write.req_n = n;
+  801b41:	a3 04 60 80 00       	mov    %eax,0x806004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  801b46:	83 ec 04             	sub    $0x4,%esp
+  801b49:	50                   	push   %eax
+  801b4a:	ff 75 0c             	push   0xc(%ebp)
+  801b4d:	68 08 60 80 00       	push   $0x806008
+  801b52:	e8 e0 ed ff ff       	call   800937 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801b57:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b5c:	b8 04 00 00 00       	mov    $0x4,%eax
+  801b61:	e8 e7 fb ff ff       	call   80174d <fsipc>
+  801b66:	83 c4 10             	add    $0x10,%esp
+}
+  801b69:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b6c:	5b                   	pop    %ebx
+  801b6d:	5e                   	pop    %esi
+  801b6e:	5f                   	pop    %edi
+  801b6f:	5d                   	pop    %ebp
+  801b70:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  801b71:	ba 00 00 10 00       	mov    $0x100000,%edx
+  801b76:	39 d0                	cmp    %edx,%eax
+  801b78:	89 d3                	mov    %edx,%ebx
+  801b7a:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  801b7d:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  801b83:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  801b86:	83 c7 01             	add    $0x1,%edi
+  801b89:	89 f8                	mov    %edi,%eax
+  801b8b:	e8 94 fc ff ff       	call   801824 <fsv_alloc>
+  801b90:	85 c0                	test   %eax,%eax
+  801b92:	78 d5                	js     801b69 <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  801b94:	83 ec 04             	sub    $0x4,%esp
+  801b97:	53                   	push   %ebx
+  801b98:	ff 75 0c             	push   0xc(%ebp)
+  801b9b:	68 00 10 c0 9f       	push   $0x9fc01000
+  801ba0:	e8 92 ed ff ff       	call   800937 <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  801ba5:	8b 46 0c             	mov    0xc(%esi),%eax
+  801ba8:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  801bad:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  801bb3:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801bba:	89 f9                	mov    %edi,%ecx
+  801bbc:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801bc1:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801bc6:	e8 69 fa ff ff       	call   801634 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801bcb:	6a 00                	push   $0x0
+  801bcd:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801bd0:	50                   	push   %eax
+  801bd1:	6a 00                	push   $0x0
+  801bd3:	6a 00                	push   $0x0
+  801bd5:	e8 6d 16 00 00       	call   803247 <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  801bda:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  801bdd:	eb 8a                	jmp    801b69 <devfile_write+0x47>
+
+00801bdf <open>:
+{
+  801bdf:	55                   	push   %ebp
+  801be0:	89 e5                	mov    %esp,%ebp
+  801be2:	56                   	push   %esi
+  801be3:	53                   	push   %ebx
+  801be4:	83 ec 1c             	sub    $0x1c,%esp
+  801be7:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801bea:	56                   	push   %esi
+  801beb:	e8 86 eb ff ff       	call   800776 <strlen>
+  801bf0:	83 c4 10             	add    $0x10,%esp
+  801bf3:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801bf8:	7f 6c                	jg     801c66 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  801bfa:	83 ec 0c             	sub    $0xc,%esp
+  801bfd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c00:	50                   	push   %eax
+  801c01:	e8 ad f4 ff ff       	call   8010b3 <fd_alloc>
+  801c06:	89 c3                	mov    %eax,%ebx
+  801c08:	83 c4 10             	add    $0x10,%esp
+  801c0b:	85 c0                	test   %eax,%eax
+  801c0d:	78 3c                	js     801c4b <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801c0f:	83 ec 08             	sub    $0x8,%esp
+  801c12:	56                   	push   %esi
+  801c13:	68 00 60 80 00       	push   $0x806000
+  801c18:	e8 94 eb ff ff       	call   8007b1 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801c1d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c20:	a3 00 64 80 00       	mov    %eax,0x806400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801c25:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801c28:	b8 01 00 00 00       	mov    $0x1,%eax
+  801c2d:	e8 1b fb ff ff       	call   80174d <fsipc>
+  801c32:	89 c3                	mov    %eax,%ebx
+  801c34:	83 c4 10             	add    $0x10,%esp
+  801c37:	85 c0                	test   %eax,%eax
+  801c39:	78 19                	js     801c54 <open+0x75>
+  return fd2num(fd);
+  801c3b:	83 ec 0c             	sub    $0xc,%esp
+  801c3e:	ff 75 f4             	push   -0xc(%ebp)
+  801c41:	e8 49 f4 ff ff       	call   80108f <fd2num>
+  801c46:	89 c3                	mov    %eax,%ebx
+  801c48:	83 c4 10             	add    $0x10,%esp
+}
+  801c4b:	89 d8                	mov    %ebx,%eax
+  801c4d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c50:	5b                   	pop    %ebx
+  801c51:	5e                   	pop    %esi
+  801c52:	5d                   	pop    %ebp
+  801c53:	c3                   	ret
+    fd_close(fd, 0);
+  801c54:	83 ec 08             	sub    $0x8,%esp
+  801c57:	6a 00                	push   $0x0
+  801c59:	ff 75 f4             	push   -0xc(%ebp)
+  801c5c:	e8 44 f5 ff ff       	call   8011a5 <fd_close>
+    return r;
+  801c61:	83 c4 10             	add    $0x10,%esp
+  801c64:	eb e5                	jmp    801c4b <open+0x6c>
+    return -E_BAD_PATH;
+  801c66:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801c6b:	eb de                	jmp    801c4b <open+0x6c>
+
+00801c6d <open_read>:
+{
+  801c6d:	55                   	push   %ebp
+  801c6e:	89 e5                	mov    %esp,%ebp
+  801c70:	57                   	push   %edi
+  801c71:	56                   	push   %esi
+  801c72:	53                   	push   %ebx
+  801c73:	83 ec 28             	sub    $0x28,%esp
+  801c76:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  801c79:	57                   	push   %edi
+  801c7a:	e8 f7 ea ff ff       	call   800776 <strlen>
+  801c7f:	83 c4 10             	add    $0x10,%esp
+  801c82:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801c87:	0f 87 f6 00 00 00    	ja     801d83 <open_read+0x116>
+  801c8d:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  801c8f:	83 ec 0c             	sub    $0xc,%esp
+  801c92:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801c95:	50                   	push   %eax
+  801c96:	e8 18 f4 ff ff       	call   8010b3 <fd_alloc>
+  801c9b:	89 c3                	mov    %eax,%ebx
+  801c9d:	83 c4 10             	add    $0x10,%esp
+  801ca0:	85 c0                	test   %eax,%eax
+  801ca2:	0f 88 b2 00 00 00    	js     801d5a <open_read+0xed>
+  strcpy(req->req_buf, path);
+  801ca8:	83 ec 08             	sub    $0x8,%esp
+  801cab:	57                   	push   %edi
+  801cac:	68 e4 60 80 00       	push   $0x8060e4
+  801cb1:	e8 fb ea ff ff       	call   8007b1 <strcpy>
+  req->req_nops = 2;
+  801cb6:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  801cbd:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  801cc0:	c7 05 04 60 80 00 01 	movl   $0x1,0x806004
+  801cc7:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  801cca:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ccd:	a3 10 60 80 00       	mov    %eax,0x806010
+  req->req_ops[0].op_buf = 0;
+  801cd2:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  801cd9:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  801cdc:	c7 05 20 60 80 00 04 	movl   $0x4,0x806020
+  801ce3:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  801ce6:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  801ced:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  801cf0:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  801cf5:	29 f0                	sub    %esi,%eax
+  801cf7:	3b 45 14             	cmp    0x14(%ebp),%eax
+  801cfa:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  801cfe:	a3 2c 60 80 00       	mov    %eax,0x80602c
+  req->req_ops[1].op_offset = 0;
+  801d03:	c7 05 30 60 80 00 00 	movl   $0x0,0x806030
+  801d0a:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  801d0d:	83 c6 01             	add    $0x1,%esi
+  801d10:	89 35 34 60 80 00    	mov    %esi,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  801d16:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801d19:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801d1e:	e8 2a fa ff ff       	call   80174d <fsipc>
+  801d23:	89 c3                	mov    %eax,%ebx
+  801d25:	83 c4 10             	add    $0x10,%esp
+  801d28:	83 f8 01             	cmp    $0x1,%eax
+  801d2b:	7e 37                	jle    801d64 <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  801d2d:	a1 38 60 80 00       	mov    0x806038,%eax
+  801d32:	8b 55 18             	mov    0x18(%ebp),%edx
+  801d35:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  801d37:	83 ec 04             	sub    $0x4,%esp
+  801d3a:	50                   	push   %eax
+  801d3b:	81 c6 e4 60 80 00    	add    $0x8060e4,%esi
+  801d41:	56                   	push   %esi
+  801d42:	ff 75 10             	push   0x10(%ebp)
+  801d45:	e8 ed eb ff ff       	call   800937 <memmove>
+  return fd2num(fd);
+  801d4a:	83 c4 04             	add    $0x4,%esp
+  801d4d:	ff 75 e4             	push   -0x1c(%ebp)
+  801d50:	e8 3a f3 ff ff       	call   80108f <fd2num>
+  801d55:	89 c3                	mov    %eax,%ebx
+  801d57:	83 c4 10             	add    $0x10,%esp
+}
+  801d5a:	89 d8                	mov    %ebx,%eax
+  801d5c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d5f:	5b                   	pop    %ebx
+  801d60:	5e                   	pop    %esi
+  801d61:	5f                   	pop    %edi
+  801d62:	5d                   	pop    %ebp
+  801d63:	c3                   	ret
+    fd_close(fd, 0);
+  801d64:	83 ec 08             	sub    $0x8,%esp
+  801d67:	6a 00                	push   $0x0
+  801d69:	ff 75 e4             	push   -0x1c(%ebp)
+  801d6c:	e8 34 f4 ff ff       	call   8011a5 <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  801d71:	83 c4 10             	add    $0x10,%esp
+  801d74:	85 db                	test   %ebx,%ebx
+  801d76:	78 e2                	js     801d5a <open_read+0xed>
+  801d78:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  801d7b:	8b 9b 1c 60 80 00    	mov    0x80601c(%ebx),%ebx
+  801d81:	eb d7                	jmp    801d5a <open_read+0xed>
+    return -E_BAD_PATH;
+  801d83:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801d88:	eb d0                	jmp    801d5a <open_read+0xed>
+
+00801d8a <file_stat>:
+{
+  801d8a:	55                   	push   %ebp
+  801d8b:	89 e5                	mov    %esp,%ebp
+  801d8d:	57                   	push   %edi
+  801d8e:	56                   	push   %esi
+  801d8f:	53                   	push   %ebx
+  801d90:	83 ec 18             	sub    $0x18,%esp
+  801d93:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801d96:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801d99:	57                   	push   %edi
+  801d9a:	e8 d7 e9 ff ff       	call   800776 <strlen>
+  801d9f:	83 c4 10             	add    $0x10,%esp
+  801da2:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801da7:	0f 8f c7 00 00 00    	jg     801e74 <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  801dad:	83 ec 0c             	sub    $0xc,%esp
+  801db0:	57                   	push   %edi
+  801db1:	e8 c0 e9 ff ff       	call   800776 <strlen>
+  801db6:	8d 58 04             	lea    0x4(%eax),%ebx
+  801db9:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  801dbc:	83 c4 08             	add    $0x8,%esp
+  801dbf:	57                   	push   %edi
+  801dc0:	68 e4 60 80 00       	push   $0x8060e4
+  801dc5:	e8 e7 e9 ff ff       	call   8007b1 <strcpy>
+  req->req_nops = 2;
+  801dca:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  801dd1:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  801dd4:	c7 05 04 60 80 00 02 	movl   $0x2,0x806004
+  801ddb:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  801dde:	c7 05 10 60 80 00 00 	movl   $0x0,0x806010
+  801de5:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  801de8:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  801def:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  801df2:	c7 05 20 60 80 00 03 	movl   $0x3,0x806020
+  801df9:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  801dfc:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  801e03:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  801e06:	89 1d 34 60 80 00    	mov    %ebx,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  801e0c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e11:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801e16:	e8 32 f9 ff ff       	call   80174d <fsipc>
+  801e1b:	83 c4 10             	add    $0x10,%esp
+  801e1e:	83 f8 01             	cmp    $0x1,%eax
+  801e21:	7e 42                	jle    801e65 <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  801e23:	81 c3 e4 60 80 00    	add    $0x8060e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  801e29:	83 ec 08             	sub    $0x8,%esp
+  801e2c:	53                   	push   %ebx
+  801e2d:	56                   	push   %esi
+  801e2e:	e8 7e e9 ff ff       	call   8007b1 <strcpy>
+  st->st_size = ret->ret_size;
+  801e33:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  801e39:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  801e3f:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  801e45:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  801e4b:	c7 86 88 00 00 00 04 	movl   $0x804004,0x88(%esi)
+  801e52:	40 80 00 
+  return 0;
+  801e55:	83 c4 10             	add    $0x10,%esp
+  801e58:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e5d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e60:	5b                   	pop    %ebx
+  801e61:	5e                   	pop    %esi
+  801e62:	5f                   	pop    %edi
+  801e63:	5d                   	pop    %ebp
+  801e64:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  801e65:	85 c0                	test   %eax,%eax
+  801e67:	78 f4                	js     801e5d <file_stat+0xd3>
+  801e69:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801e6c:	8b 80 1c 60 80 00    	mov    0x80601c(%eax),%eax
+  801e72:	eb e9                	jmp    801e5d <file_stat+0xd3>
+    return -E_BAD_PATH;
+  801e74:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801e79:	eb e2                	jmp    801e5d <file_stat+0xd3>
+
+00801e7b <read_map>:
+{
+  801e7b:	55                   	push   %ebp
+  801e7c:	89 e5                	mov    %esp,%ebp
+  801e7e:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801e81:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801e84:	50                   	push   %eax
+  801e85:	ff 75 08             	push   0x8(%ebp)
+  801e88:	e8 7c f2 ff ff       	call   801109 <fd_lookup>
+  801e8d:	83 c4 10             	add    $0x10,%esp
+  801e90:	85 c0                	test   %eax,%eax
+  801e92:	78 2a                	js     801ebe <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  801e94:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801e97:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  801e9d:	39 08                	cmp    %ecx,(%eax)
+  801e9f:	75 1f                	jne    801ec0 <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  801ea1:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ea4:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read_map.req_offset = offset;
+  801ea9:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801eac:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  801eb1:	8b 55 10             	mov    0x10(%ebp),%edx
+  801eb4:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801eb9:	e8 8f f8 ff ff       	call   80174d <fsipc>
+}
+  801ebe:	c9                   	leave
+  801ebf:	c3                   	ret
+    return -E_INVAL;
+  801ec0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ec5:	eb f7                	jmp    801ebe <read_map+0x43>
+
+00801ec7 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801ec7:	55                   	push   %ebp
+  801ec8:	89 e5                	mov    %esp,%ebp
+  801eca:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  801ecd:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ed2:	b8 08 00 00 00       	mov    $0x8,%eax
+  801ed7:	e8 71 f8 ff ff       	call   80174d <fsipc>
+}
+  801edc:	c9                   	leave
+  801edd:	c3                   	ret
+
+00801ede <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  801ede:	55                   	push   %ebp
+  801edf:	89 e5                	mov    %esp,%ebp
+  801ee1:	57                   	push   %edi
+  801ee2:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  801ee3:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ee6:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.stats.req_bio_sched = 0;
+  801eeb:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  801ef2:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  801ef5:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  801efc:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  801eff:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f04:	b8 09 00 00 00       	mov    $0x9,%eax
+  801f09:	e8 3f f8 ff ff       	call   80174d <fsipc>
+  801f0e:	85 c0                	test   %eax,%eax
+  801f10:	78 14                	js     801f26 <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  801f12:	be 00 60 80 00       	mov    $0x806000,%esi
+  801f17:	b9 16 00 00 00       	mov    $0x16,%ecx
+  801f1c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801f1f:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  801f21:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f26:	5e                   	pop    %esi
+  801f27:	5f                   	pop    %edi
+  801f28:	5d                   	pop    %ebp
+  801f29:	c3                   	ret
+
+00801f2a <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  801f2a:	55                   	push   %ebp
+  801f2b:	89 e5                	mov    %esp,%ebp
+  801f2d:	53                   	push   %ebx
+  801f2e:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  801f31:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801f34:	50                   	push   %eax
+  801f35:	6a 00                	push   $0x0
+  801f37:	e8 a2 ff ff ff       	call   801ede <fs_stats>
+  801f3c:	83 c4 10             	add    $0x10,%esp
+  801f3f:	85 c0                	test   %eax,%eax
+  801f41:	78 28                	js     801f6b <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  801f43:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  801f46:	83 ec 08             	sub    $0x8,%esp
+  801f49:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801f4c:	50                   	push   %eax
+  801f4d:	6a 20                	push   $0x20
+  801f4f:	e8 8a ff ff ff       	call   801ede <fs_stats>
+  801f54:	83 c4 10             	add    $0x10,%esp
+  801f57:	85 c0                	test   %eax,%eax
+  801f59:	78 10                	js     801f6b <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  801f5b:	83 ec 08             	sub    $0x8,%esp
+  801f5e:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801f61:	50                   	push   %eax
+  801f62:	53                   	push   %ebx
+  801f63:	e8 76 ff ff ff       	call   801ede <fs_stats>
+  801f68:	83 c4 10             	add    $0x10,%esp
+}
+  801f6b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f6e:	c9                   	leave
+  801f6f:	c3                   	ret
+
+00801f70 <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  801f70:	55                   	push   %ebp
+  801f71:	89 e5                	mov    %esp,%ebp
+  801f73:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  801f76:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  801f7d:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  801f80:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f83:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.stats.req_dcache = 0;
+  801f88:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  801f8f:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  801f92:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f97:	b8 09 00 00 00       	mov    $0x9,%eax
+  801f9c:	e8 ac f7 ff ff       	call   80174d <fsipc>
+}
+  801fa1:	c9                   	leave
+  801fa2:	c3                   	ret
+
+00801fa3 <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  801fa3:	55                   	push   %ebp
+  801fa4:	89 e5                	mov    %esp,%ebp
+  801fa6:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  801fa9:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  801fb0:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  801fb3:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  801fba:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  801fbd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fc0:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_STATS, NULL);
+  801fc5:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fca:	b8 09 00 00 00       	mov    $0x9,%eax
+  801fcf:	e8 79 f7 ff ff       	call   80174d <fsipc>
+}
+  801fd4:	c9                   	leave
+  801fd5:	c3                   	ret
+
+00801fd6 <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  801fd6:	55                   	push   %ebp
+  801fd7:	89 e5                	mov    %esp,%ebp
+  801fd9:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801fdc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801fdf:	50                   	push   %eax
+  801fe0:	ff 75 08             	push   0x8(%ebp)
+  801fe3:	e8 21 f1 ff ff       	call   801109 <fd_lookup>
+  801fe8:	83 c4 10             	add    $0x10,%esp
+  801feb:	85 c0                	test   %eax,%eax
+  801fed:	78 34                	js     802023 <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  801fef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ff2:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  801ff8:	39 08                	cmp    %ecx,(%eax)
+  801ffa:	75 29                	jne    802025 <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  801ffc:	8b 40 0c             	mov    0xc(%eax),%eax
+  801fff:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.fallocate.req_offset = offset;
+  802004:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802007:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.fallocate.req_len = len;
+  80200c:	8b 45 10             	mov    0x10(%ebp),%eax
+  80200f:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  802014:	ba 00 00 00 00       	mov    $0x0,%edx
+  802019:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80201e:	e8 2a f7 ff ff       	call   80174d <fsipc>
+}
+  802023:	c9                   	leave
+  802024:	c3                   	ret
+    return -E_INVAL;
+  802025:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80202a:	eb f7                	jmp    802023 <fallocate+0x4d>
+
+0080202c <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  80202c:	55                   	push   %ebp
+  80202d:	89 e5                	mov    %esp,%ebp
+  80202f:	57                   	push   %edi
+  802030:	56                   	push   %esi
+  802031:	53                   	push   %ebx
+  802032:	83 ec 24             	sub    $0x24,%esp
+  802035:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802038:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80203b:	50                   	push   %eax
+  80203c:	ff 75 08             	push   0x8(%ebp)
+  80203f:	e8 c5 f0 ff ff       	call   801109 <fd_lookup>
+  802044:	83 c4 10             	add    $0x10,%esp
+  802047:	85 c0                	test   %eax,%eax
+  802049:	78 66                	js     8020b1 <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  80204b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80204e:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  802054:	39 08                	cmp    %ecx,(%eax)
+  802056:	75 61                	jne    8020b9 <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  802058:	85 f6                	test   %esi,%esi
+  80205a:	7e 50                	jle    8020ac <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  80205c:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  802061:	39 de                	cmp    %ebx,%esi
+  802063:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  802066:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802069:	8b 40 0c             	mov    0xc(%eax),%eax
+  80206c:	a3 00 60 80 00       	mov    %eax,0x806000
+    fsipcbuf.prefetch.req_n = m;
+  802071:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  802077:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  80207e:	83 ec 04             	sub    $0x4,%esp
+  802081:	57                   	push   %edi
+  802082:	ff 75 0c             	push   0xc(%ebp)
+  802085:	68 08 60 80 00       	push   $0x806008
+  80208a:	e8 a8 e8 ff ff       	call   800937 <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  80208f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802094:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802099:	e8 af f6 ff ff       	call   80174d <fsipc>
+  80209e:	83 c4 10             	add    $0x10,%esp
+  8020a1:	85 c0                	test   %eax,%eax
+  8020a3:	78 0c                	js     8020b1 <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  8020a5:	01 7d 0c             	add    %edi,0xc(%ebp)
+  8020a8:	29 de                	sub    %ebx,%esi
+  8020aa:	eb ac                	jmp    802058 <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  8020ac:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020b1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020b4:	5b                   	pop    %ebx
+  8020b5:	5e                   	pop    %esi
+  8020b6:	5f                   	pop    %edi
+  8020b7:	5d                   	pop    %ebp
+  8020b8:	c3                   	ret
+    return -E_INVAL;
+  8020b9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020be:	eb f1                	jmp    8020b1 <prefetch+0x85>
+
+008020c0 <spawn>:
+// argv: pointer to null-terminated array of pointers to strings,
+//   which will be passed to the child as its command-line arguments.
+// Returns child envid on success, < 0 on failure.
+int
+spawn(const char *prog, const char **argv)
+{
+  8020c0:	55                   	push   %ebp
+  8020c1:	89 e5                	mov    %esp,%ebp
+  8020c3:	57                   	push   %edi
+  8020c4:	56                   	push   %esi
+  8020c5:	53                   	push   %ebx
+  8020c6:	81 ec a8 02 00 00    	sub    $0x2a8,%esp
+  //     correct initial eip and esp values in the child.
+  //
+  //   - Start the child process running with sys_env_set_status().
+
+  // Open the program and read its ELF header in one round trip.
+  if ((r = open_read(prog, O_RDONLY, elf_buf, sizeof(elf_buf), &n)) < 0)
+  8020cc:	8d 85 a0 fd ff ff    	lea    -0x260(%ebp),%eax
+  8020d2:	50                   	push   %eax
+  8020d3:	68 00 02 00 00       	push   $0x200
+  8020d8:	8d 85 e8 fd ff ff    	lea    -0x218(%ebp),%eax
+  8020de:	50                   	push   %eax
+  8020df:	6a 00                	push   $0x0
+  8020e1:	ff 75 08             	push   0x8(%ebp)
+  8020e4:	e8 84 fb ff ff       	call   801c6d <open_read>
+  8020e9:	89 85 88 fd ff ff    	mov    %eax,-0x278(%ebp)
+  8020ef:	83 c4 20             	add    $0x20,%esp
+  8020f2:	85 c0                	test   %eax,%eax
+  8020f4:	0f 88 66 06 00 00    	js     802760 <spawn+0x6a0>
+    return r;
+  fd = r;
+
+  elf = (struct Elf*)elf_buf;
+  if (n != sizeof(elf_buf) || elf->e_magic != ELF_MAGIC) {
+  8020fa:	81 bd a0 fd ff ff 00 	cmpl   $0x200,-0x260(%ebp)
+  802101:	02 00 00 
+  802104:	0f 85 92 00 00 00    	jne    80219c <spawn+0xdc>
+  80210a:	81 bd e8 fd ff ff 7f 	cmpl   $0x464c457f,-0x218(%ebp)
+  802111:	45 4c 46 
+  802114:	0f 85 82 00 00 00    	jne    80219c <spawn+0xdc>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+  envid_t ret;
+  __asm __volatile("int %2"
+  80211a:	b8 07 00 00 00       	mov    $0x7,%eax
+  80211f:	cd 30                	int    $0x30
+  802121:	89 85 90 fd ff ff    	mov    %eax,-0x270(%ebp)
+  802127:	89 c6                	mov    %eax,%esi
+  802129:	89 85 6c fd ff ff    	mov    %eax,-0x294(%ebp)
+    cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+    return -E_NOT_EXEC;
+  }
+
+  // Create new child environment
+  if ((r = sys_exofork()) < 0)
+  80212f:	85 c0                	test   %eax,%eax
+  802131:	0f 88 35 06 00 00    	js     80276c <spawn+0x6ac>
+    return r;
+  child = r;
+  sysbatch_init(&batch);
+  802137:	83 ec 0c             	sub    $0xc,%esp
+  80213a:	68 60 57 80 00       	push   $0x805760
+  80213f:	e8 91 ee ff ff       	call   800fd5 <sysbatch_init>
+
+  // Set up trap frame, including initial stack.
+  child_tf = envs[ENVX(child)].env_tf;
+  802144:	89 f0                	mov    %esi,%eax
+  802146:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80214b:	8d 34 c0             	lea    (%eax,%eax,8),%esi
+  80214e:	c1 e6 04             	shl    $0x4,%esi
+  802151:	81 c6 00 00 c0 ee    	add    $0xeec00000,%esi
+  802157:	8d bd a4 fd ff ff    	lea    -0x25c(%ebp),%edi
+  80215d:	b9 11 00 00 00       	mov    $0x11,%ecx
+  802162:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  child_tf.tf_eip = elf->e_entry;
+  802164:	8b 85 00 fe ff ff    	mov    -0x200(%ebp),%eax
+  80216a:	89 85 d4 fd ff ff    	mov    %eax,-0x22c(%ebp)
+  uintptr_t *argv_store;
+
+  // Count the number of arguments (argc)
+  // and the total amount of space needed for strings (string_size).
+  string_size = 0;
+  for (argc = 0; argv[argc] != 0; argc++)
+  802170:	83 c4 10             	add    $0x10,%esp
+  802173:	bb 00 00 00 00       	mov    $0x0,%ebx
+  string_size = 0;
+  802178:	be 00 00 00 00       	mov    $0x0,%esi
+  80217d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  for (argc = 0; argv[argc] != 0; argc++)
+  802180:	8b 04 9f             	mov    (%edi,%ebx,4),%eax
+  802183:	85 c0                	test   %eax,%eax
+  802185:	74 4d                	je     8021d4 <spawn+0x114>
+    string_size += strlen(argv[argc]) + 1;
+  802187:	83 ec 0c             	sub    $0xc,%esp
+  80218a:	50                   	push   %eax
+  80218b:	e8 e6 e5 ff ff       	call   800776 <strlen>
+  802190:	8d 74 06 01          	lea    0x1(%esi,%eax,1),%esi
+  for (argc = 0; argv[argc] != 0; argc++)
+  802194:	83 c3 01             	add    $0x1,%ebx
+  802197:	83 c4 10             	add    $0x10,%esp
+  80219a:	eb e4                	jmp    802180 <spawn+0xc0>
+    close(fd);
+  80219c:	83 ec 0c             	sub    $0xc,%esp
+  80219f:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  8021a5:	e8 82 f0 ff ff       	call   80122c <close>
+    cprintf("elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  8021aa:	83 c4 0c             	add    $0xc,%esp
+  8021ad:	68 7f 45 4c 46       	push   $0x464c457f
+  8021b2:	ff b5 e8 fd ff ff    	push   -0x218(%ebp)
+  8021b8:	68 e8 3a 80 00       	push   $0x803ae8
+  8021bd:	e8 01 e0 ff ff       	call   8001c3 <cprintf>
+    return -E_NOT_EXEC;
+  8021c2:	83 c4 10             	add    $0x10,%esp
+  8021c5:	c7 85 6c fd ff ff f2 	movl   $0xfffffff2,-0x294(%ebp)
+  8021cc:	ff ff ff 
+  8021cf:	e9 98 05 00 00       	jmp    80276c <spawn+0x6ac>
+  // Determine where to place the strings and the argv array.
+  // Set up pointers into the temporary page 'UTEMP'; we'll map a page
+  // there later, then remap that page into the child environment
+  // at (USTACKTOP - PGSIZE).
+  // strings is the topmost thing on the stack.
+  string_store = (char*)UTEMP + PGSIZE - string_size;
+  8021d4:	89 9d 84 fd ff ff    	mov    %ebx,-0x27c(%ebp)
+  8021da:	bf 00 10 40 00       	mov    $0x401000,%edi
+  8021df:	29 f7                	sub    %esi,%edi
+  // argv is below that.  There's one argument pointer per argument, plus
+  // a null pointer.
+  argv_store = (uintptr_t*)(ROUNDDOWN(string_store, 4) - 4 * (argc + 1));
+  8021e1:	89 fa                	mov    %edi,%edx
+  8021e3:	83 e2 fc             	and    $0xfffffffc,%edx
+  8021e6:	8d 04 9d 04 00 00 00 	lea    0x4(,%ebx,4),%eax
+  8021ed:	29 c2                	sub    %eax,%edx
+  8021ef:	89 95 94 fd ff ff    	mov    %edx,-0x26c(%ebp)
+
+  // Make sure that argv, strings, and the 2 words that hold 'argc'
+  // and 'argv' themselves will all fit in a single stack page.
+  if ((void*)(argv_store - 2) < (void*)UTEMP)
+  8021f5:	8d 42 f8             	lea    -0x8(%edx),%eax
+  8021f8:	3d ff ff 3f 00       	cmp    $0x3fffff,%eax
+  8021fd:	0f 86 a8 05 00 00    	jbe    8027ab <spawn+0x6eb>
+    return -E_NO_MEM;
+
+  // Allocate the single stack page at UTEMP.
+  if ((r = sys_page_alloc(0, (void*)UTEMP, PTE_P|PTE_U|PTE_W)) < 0)
+  802203:	83 ec 04             	sub    $0x4,%esp
+  802206:	6a 07                	push   $0x7
+  802208:	68 00 00 40 00       	push   $0x400000
+  80220d:	6a 00                	push   $0x0
+  80220f:	e8 cc e9 ff ff       	call   800be0 <sys_page_alloc>
+  802214:	83 c4 10             	add    $0x10,%esp
+  802217:	85 c0                	test   %eax,%eax
+  802219:	0f 88 91 05 00 00    	js     8027b0 <spawn+0x6f0>
+  //	  (Again, argv should use an address valid in the child's
+  //	  environment.)
+  //
+  //	* Set *init_esp to the initial stack pointer for the child,
+  //	  (Again, use an address valid in the child's environment.)
+  for (i = 0; i < argc; i++) {
+  80221f:	be 00 00 00 00       	mov    $0x0,%esi
+  802224:	89 9d 8c fd ff ff    	mov    %ebx,-0x274(%ebp)
+  80222a:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80222d:	eb 30                	jmp    80225f <spawn+0x19f>
+    argv_store[i] = UTEMP2USTACK(string_store);
+  80222f:	8d 87 00 d0 7f ee    	lea    -0x11803000(%edi),%eax
+  802235:	8b 8d 94 fd ff ff    	mov    -0x26c(%ebp),%ecx
+  80223b:	89 04 b1             	mov    %eax,(%ecx,%esi,4)
+    strcpy(string_store, argv[i]);
+  80223e:	83 ec 08             	sub    $0x8,%esp
+  802241:	ff 34 b3             	push   (%ebx,%esi,4)
+  802244:	57                   	push   %edi
+  802245:	e8 67 e5 ff ff       	call   8007b1 <strcpy>
+    string_store += strlen(argv[i]) + 1;
+  80224a:	83 c4 04             	add    $0x4,%esp
+  80224d:	ff 34 b3             	push   (%ebx,%esi,4)
+  802250:	e8 21 e5 ff ff       	call   800776 <strlen>
+  802255:	8d 7c 07 01          	lea    0x1(%edi,%eax,1),%edi
+  for (i = 0; i < argc; i++) {
+  802259:	83 c6 01             	add    $0x1,%esi
+  80225c:	83 c4 10             	add    $0x10,%esp
+  80225f:	39 b5 8c fd ff ff    	cmp    %esi,-0x274(%ebp)
+  802265:	7f c8                	jg     80222f <spawn+0x16f>
+  }
+  argv_store[argc] = 0;
+  802267:	8b 85 94 fd ff ff    	mov    -0x26c(%ebp),%eax
+  80226d:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  802273:	c7 04 88 00 00 00 00 	movl   $0x0,(%eax,%ecx,4)
+  assert(string_store == (char*)UTEMP + PGSIZE);
+  80227a:	81 ff 00 10 40 00    	cmp    $0x401000,%edi
+  802280:	0f 85 97 00 00 00    	jne    80231d <spawn+0x25d>
+
+  argv_store[-1] = UTEMP2USTACK(argv_store);
+  802286:	8b 8d 94 fd ff ff    	mov    -0x26c(%ebp),%ecx
+  80228c:	8d 81 00 d0 7f ee    	lea    -0x11803000(%ecx),%eax
+  802292:	89 41 fc             	mov    %eax,-0x4(%ecx)
+  argv_store[-2] = argc;
+  802295:	89 c8                	mov    %ecx,%eax
+  802297:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  80229d:	89 48 f8             	mov    %ecx,-0x8(%eax)
+
+  *init_esp = UTEMP2USTACK(&argv_store[-2]);
+  8022a0:	2d 08 30 80 11       	sub    $0x11803008,%eax
+  8022a5:	89 85 e0 fd ff ff    	mov    %eax,-0x220(%ebp)
+
+  // After completing the stack, map it into the child's address space
+  // and unmap it from ours!  Both calls ride along with the first batch
+  // of segment mappings.
+  if ((r = sysbatch_add(&batch, SYS_page_map, 0, (uint32_t) UTEMP, child,
+  8022ab:	83 ec 04             	sub    $0x4,%esp
+  8022ae:	6a 07                	push   $0x7
+  8022b0:	68 00 d0 bf ee       	push   $0xeebfd000
+  8022b5:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  8022bb:	68 00 00 40 00       	push   $0x400000
+  8022c0:	6a 00                	push   $0x0
+  8022c2:	6a 05                	push   $0x5
+  8022c4:	68 60 57 80 00       	push   $0x805760
+  8022c9:	e8 65 ed ff ff       	call   801033 <sysbatch_add>
+  8022ce:	89 c3                	mov    %eax,%ebx
+  8022d0:	83 c4 20             	add    $0x20,%esp
+  8022d3:	85 c0                	test   %eax,%eax
+  8022d5:	0f 88 dd 04 00 00    	js     8027b8 <spawn+0x6f8>
+                        USTACKTOP - PGSIZE, PTE_P | PTE_U | PTE_W)) < 0)
+    goto error;
+  if ((r = sysbatch_add(&batch, SYS_page_unmap, 0, (uint32_t) UTEMP,
+  8022db:	83 ec 04             	sub    $0x4,%esp
+  8022de:	6a 00                	push   $0x0
+  8022e0:	6a 00                	push   $0x0
+  8022e2:	6a 00                	push   $0x0
+  8022e4:	68 00 00 40 00       	push   $0x400000
+  8022e9:	6a 00                	push   $0x0
+  8022eb:	6a 06                	push   $0x6
+  8022ed:	68 60 57 80 00       	push   $0x805760
+  8022f2:	e8 3c ed ff ff       	call   801033 <sysbatch_add>
+  8022f7:	89 c3                	mov    %eax,%ebx
+  8022f9:	83 c4 20             	add    $0x20,%esp
+  8022fc:	85 c0                	test   %eax,%eax
+  8022fe:	0f 88 b4 04 00 00    	js     8027b8 <spawn+0x6f8>
+  ph = (struct Proghdr*)(elf_buf + elf->e_phoff);
+  802304:	8b 85 04 fe ff ff    	mov    -0x1fc(%ebp),%eax
+  80230a:	8d bc 05 e8 fd ff ff 	lea    -0x218(%ebp,%eax,1),%edi
+  for (i = 0; i < elf->e_phnum; i++, ph++) {
+  802311:	ba 00 00 00 00       	mov    $0x0,%edx
+  802316:	89 d6                	mov    %edx,%esi
+  802318:	e9 dd 01 00 00       	jmp    8024fa <spawn+0x43a>
+  assert(string_store == (char*)UTEMP + PGSIZE);
+  80231d:	68 60 3b 80 00       	push   $0x803b60
+  802322:	68 98 3a 80 00       	push   $0x803a98
+  802327:	68 01 01 00 00       	push   $0x101
+  80232c:	68 02 3b 80 00       	push   $0x803b02
+  802331:	e8 b2 dd ff ff       	call   8000e8 <_panic>
+
+  for (i = 0; i < memsz; i += n * PGSIZE) {
+    if (i >= filesz) {
+      // allocate a blank page
+      n = 1;
+      if ((r = sysbatch_add(&batch, SYS_page_alloc, child, va + i,
+  802336:	83 ec 04             	sub    $0x4,%esp
+  802339:	6a 00                	push   $0x0
+  80233b:	6a 00                	push   $0x0
+  80233d:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  802343:	8b 85 78 fd ff ff    	mov    -0x288(%ebp),%eax
+  802349:	8b 8d 70 fd ff ff    	mov    -0x290(%ebp),%ecx
+  80234f:	01 c8                	add    %ecx,%eax
+  802351:	50                   	push   %eax
+  802352:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  802358:	6a 04                	push   $0x4
+  80235a:	68 60 57 80 00       	push   $0x805760
+  80235f:	e8 cf ec ff ff       	call   801033 <sysbatch_add>
+  802364:	83 c4 20             	add    $0x20,%esp
+  802367:	85 c0                	test   %eax,%eax
+  802369:	0f 88 0b 04 00 00    	js     80277a <spawn+0x6ba>
+      n = 1;
+  80236f:	bf 01 00 00 00       	mov    $0x1,%edi
+  for (i = 0; i < memsz; i += n * PGSIZE) {
+  802374:	89 f8                	mov    %edi,%eax
+  802376:	c1 e0 0c             	shl    $0xc,%eax
+  802379:	01 85 84 fd ff ff    	add    %eax,-0x27c(%ebp)
+  80237f:	e9 fc 01 00 00       	jmp    802580 <spawn+0x4c0>
+  802384:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802389:	eb 0e                	jmp    802399 <spawn+0x2d9>
+  80238b:	8b bd 60 fd ff ff    	mov    -0x2a0(%ebp),%edi
+  802391:	e9 c1 00 00 00       	jmp    802457 <spawn+0x397>
+          return r;
+        if (r < MIN(PGSIZE, filesz - i - j * PGSIZE))
+          return -E_INVAL;
+      }
+    } else {
+      for (j = 0; j < n; j++)
+  802396:	83 c3 01             	add    $0x1,%ebx
+  802399:	39 df                	cmp    %ebx,%edi
+  80239b:	7e 55                	jle    8023f2 <spawn+0x332>
+        if ((r = sysbatch_add(&batch, SYS_page_alloc, 0,
+  80239d:	83 ec 04             	sub    $0x4,%esp
+  8023a0:	6a 00                	push   $0x0
+  8023a2:	6a 00                	push   $0x0
+  8023a4:	6a 07                	push   $0x7
+  8023a6:	89 d8                	mov    %ebx,%eax
+  8023a8:	c1 e0 0c             	shl    $0xc,%eax
+  8023ab:	05 00 10 40 00       	add    $0x401000,%eax
+  8023b0:	50                   	push   %eax
+  8023b1:	6a 00                	push   $0x0
+  8023b3:	6a 04                	push   $0x4
+  8023b5:	68 60 57 80 00       	push   $0x805760
+  8023ba:	e8 74 ec ff ff       	call   801033 <sysbatch_add>
+  8023bf:	83 c4 20             	add    $0x20,%esp
+  8023c2:	85 c0                	test   %eax,%eax
+  8023c4:	79 d0                	jns    802396 <spawn+0x2d6>
+  8023c6:	89 c6                	mov    %eax,%esi
+  sys_env_destroy(child);
+  8023c8:	83 ec 0c             	sub    $0xc,%esp
+  8023cb:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  8023d1:	e8 48 e7 ff ff       	call   800b1e <sys_env_destroy>
+  close(fd);
+  8023d6:	83 c4 04             	add    $0x4,%esp
+  8023d9:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  8023df:	e8 48 ee ff ff       	call   80122c <close>
+  return r;
+  8023e4:	83 c4 10             	add    $0x10,%esp
+  8023e7:	89 b5 6c fd ff ff    	mov    %esi,-0x294(%ebp)
+  8023ed:	e9 7a 03 00 00       	jmp    80276c <spawn+0x6ac>
+                              (uint32_t) UTEMP2 + j * PGSIZE,
+                              PTE_P|PTE_U|PTE_W, 0, 0)) < 0)
+          return r;
+      if ((r = sysbatch_flush(&batch)) < 0)
+  8023f2:	83 ec 0c             	sub    $0xc,%esp
+  8023f5:	68 60 57 80 00       	push   $0x805760
+  8023fa:	e8 e4 eb ff ff       	call   800fe3 <sysbatch_flush>
+  8023ff:	83 c4 10             	add    $0x10,%esp
+  802402:	85 c0                	test   %eax,%eax
+  802404:	0f 88 85 03 00 00    	js     80278f <spawn+0x6cf>
+        return r;
+      if ((r = seek(fd, fileoffset + i)) < 0)
+  80240a:	83 ec 08             	sub    $0x8,%esp
+  80240d:	8b 85 74 fd ff ff    	mov    -0x28c(%ebp),%eax
+  802413:	8b 8d 84 fd ff ff    	mov    -0x27c(%ebp),%ecx
+  802419:	01 c8                	add    %ecx,%eax
+  80241b:	50                   	push   %eax
+  80241c:	8b 9d 88 fd ff ff    	mov    -0x278(%ebp),%ebx
+  802422:	53                   	push   %ebx
+  802423:	e8 dc f0 ff ff       	call   801504 <seek>
+  802428:	83 c4 10             	add    $0x10,%esp
+  80242b:	85 c0                	test   %eax,%eax
+  80242d:	0f 88 63 03 00 00    	js     802796 <spawn+0x6d6>
+        return r;
+      if ((r = readn(fd, UTEMP2, MIN(n * PGSIZE, filesz - i))) < 0)
+  802433:	83 ec 04             	sub    $0x4,%esp
+  802436:	89 f8                	mov    %edi,%eax
+  802438:	c1 e0 0c             	shl    $0xc,%eax
+  80243b:	39 f0                	cmp    %esi,%eax
+  80243d:	0f 47 c6             	cmova  %esi,%eax
+  802440:	50                   	push   %eax
+  802441:	68 00 10 40 00       	push   $0x401000
+  802446:	53                   	push   %ebx
+  802447:	e8 ef ef ff ff       	call   80143b <readn>
+  80244c:	83 c4 10             	add    $0x10,%esp
+  80244f:	85 c0                	test   %eax,%eax
+  802451:	0f 88 46 03 00 00    	js     80279d <spawn+0x6dd>
+        return r;
+    }
+    for (j = 0; j < n; j++) {
+  802457:	8d b7 01 04 00 00    	lea    0x401(%edi),%esi
+  80245d:	c1 e6 0c             	shl    $0xc,%esi
+  802460:	bb 00 10 40 00       	mov    $0x401000,%ebx
+      if ((r = sysbatch_add(&batch, SYS_page_map, 0,
+  802465:	8b 85 70 fd ff ff    	mov    -0x290(%ebp),%eax
+  80246b:	8b 8d 78 fd ff ff    	mov    -0x288(%ebp),%ecx
+  802471:	8d 84 08 00 f0 bf ff 	lea    -0x401000(%eax,%ecx,1),%eax
+  802478:	89 bd 80 fd ff ff    	mov    %edi,-0x280(%ebp)
+  80247e:	89 c7                	mov    %eax,%edi
+    for (j = 0; j < n; j++) {
+  802480:	39 f3                	cmp    %esi,%ebx
+  802482:	74 59                	je     8024dd <spawn+0x41d>
+      if ((r = sysbatch_add(&batch, SYS_page_map, 0,
+  802484:	83 ec 04             	sub    $0x4,%esp
+  802487:	ff b5 94 fd ff ff    	push   -0x26c(%ebp)
+  80248d:	8d 04 1f             	lea    (%edi,%ebx,1),%eax
+  802490:	50                   	push   %eax
+  802491:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  802497:	53                   	push   %ebx
+  802498:	6a 00                	push   $0x0
+  80249a:	6a 05                	push   $0x5
+  80249c:	68 60 57 80 00       	push   $0x805760
+  8024a1:	e8 8d eb ff ff       	call   801033 <sysbatch_add>
+  8024a6:	83 c4 20             	add    $0x20,%esp
+  8024a9:	85 c0                	test   %eax,%eax
+  8024ab:	0f 88 f3 02 00 00    	js     8027a4 <spawn+0x6e4>
+                            (uint32_t) UTEMP2 + j * PGSIZE, child,
+                            va + i + j * PGSIZE, perm)) < 0)
+        return r;
+      if ((r = sysbatch_add(&batch, SYS_page_unmap, 0,
+  8024b1:	83 ec 04             	sub    $0x4,%esp
+  8024b4:	6a 00                	push   $0x0
+  8024b6:	6a 00                	push   $0x0
+  8024b8:	6a 00                	push   $0x0
+  8024ba:	53                   	push   %ebx
+  8024bb:	6a 00                	push   $0x0
+  8024bd:	6a 06                	push   $0x6
+  8024bf:	68 60 57 80 00       	push   $0x805760
+  8024c4:	e8 6a eb ff ff       	call   801033 <sysbatch_add>
+  8024c9:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8024cf:	83 c4 20             	add    $0x20,%esp
+  8024d2:	85 c0                	test   %eax,%eax
+  8024d4:	79 aa                	jns    802480 <spawn+0x3c0>
+  8024d6:	89 c6                	mov    %eax,%esi
+  8024d8:	e9 eb fe ff ff       	jmp    8023c8 <spawn+0x308>
+  8024dd:	8b bd 80 fd ff ff    	mov    -0x280(%ebp),%edi
+  8024e3:	e9 8c fe ff ff       	jmp    802374 <spawn+0x2b4>
+  8024e8:	8b b5 68 fd ff ff    	mov    -0x298(%ebp),%esi
+  8024ee:	8b bd 64 fd ff ff    	mov    -0x29c(%ebp),%edi
+  for (i = 0; i < elf->e_phnum; i++, ph++) {
+  8024f4:	83 c6 01             	add    $0x1,%esi
+  8024f7:	83 c7 20             	add    $0x20,%edi
+  8024fa:	0f b7 85 14 fe ff ff 	movzwl -0x1ec(%ebp),%eax
+  802501:	39 f0                	cmp    %esi,%eax
+  802503:	0f 8e 9b 01 00 00    	jle    8026a4 <spawn+0x5e4>
+    if (ph->p_type != ELF_PROG_LOAD)
+  802509:	83 3f 01             	cmpl   $0x1,(%edi)
+  80250c:	75 e6                	jne    8024f4 <spawn+0x434>
+    if (ph->p_flags & ELF_PROG_FLAG_WRITE)
+  80250e:	8b 47 18             	mov    0x18(%edi),%eax
+  802511:	83 e0 02             	and    $0x2,%eax
+    perm = PTE_P | PTE_U;
+  802514:	83 f8 01             	cmp    $0x1,%eax
+  802517:	19 c0                	sbb    %eax,%eax
+  802519:	83 e0 fe             	and    $0xfffffffe,%eax
+  80251c:	83 c0 07             	add    $0x7,%eax
+  80251f:	89 85 94 fd ff ff    	mov    %eax,-0x26c(%ebp)
+    if ((r = map_segment(child, ph->p_va, ph->p_memsz,
+  802525:	8b 57 04             	mov    0x4(%edi),%edx
+  802528:	89 95 74 fd ff ff    	mov    %edx,-0x28c(%ebp)
+  80252e:	8b 5f 10             	mov    0x10(%edi),%ebx
+  802531:	89 9d 8c fd ff ff    	mov    %ebx,-0x274(%ebp)
+  802537:	8b 47 14             	mov    0x14(%edi),%eax
+  80253a:	89 85 7c fd ff ff    	mov    %eax,-0x284(%ebp)
+  802540:	8b 4f 08             	mov    0x8(%edi),%ecx
+  if ((i = PGOFF(va))) {
+  802543:	89 c8                	mov    %ecx,%eax
+  802545:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80254a:	74 18                	je     802564 <spawn+0x4a4>
+    va -= i;
+  80254c:	29 c1                	sub    %eax,%ecx
+    memsz += i;
+  80254e:	01 85 7c fd ff ff    	add    %eax,-0x284(%ebp)
+    filesz += i;
+  802554:	01 c3                	add    %eax,%ebx
+  802556:	89 9d 8c fd ff ff    	mov    %ebx,-0x274(%ebp)
+    fileoffset -= i;
+  80255c:	29 c2                	sub    %eax,%edx
+  80255e:	89 95 74 fd ff ff    	mov    %edx,-0x28c(%ebp)
+  for (i = 0; i < memsz; i += n * PGSIZE) {
+  802564:	c7 85 84 fd ff ff 00 	movl   $0x0,-0x27c(%ebp)
+  80256b:	00 00 00 
+  80256e:	89 8d 70 fd ff ff    	mov    %ecx,-0x290(%ebp)
+  802574:	89 b5 68 fd ff ff    	mov    %esi,-0x298(%ebp)
+  80257a:	89 bd 64 fd ff ff    	mov    %edi,-0x29c(%ebp)
+  802580:	8b 85 84 fd ff ff    	mov    -0x27c(%ebp),%eax
+  802586:	89 85 78 fd ff ff    	mov    %eax,-0x288(%ebp)
+  80258c:	8b 8d 7c fd ff ff    	mov    -0x284(%ebp),%ecx
+  802592:	39 c8                	cmp    %ecx,%eax
+  802594:	0f 83 4e ff ff ff    	jae    8024e8 <spawn+0x428>
+    if (i >= filesz) {
+  80259a:	8b 8d 8c fd ff ff    	mov    -0x274(%ebp),%ecx
+  8025a0:	39 8d 84 fd ff ff    	cmp    %ecx,-0x27c(%ebp)
+  8025a6:	0f 83 8a fd ff ff    	jae    802336 <spawn+0x276>
+    n = MIN(SEGCHUNK, ROUNDUP(filesz - i, PGSIZE) / PGSIZE);
+  8025ac:	8b b5 8c fd ff ff    	mov    -0x274(%ebp),%esi
+  8025b2:	8b 85 78 fd ff ff    	mov    -0x288(%ebp),%eax
+  8025b8:	29 c6                	sub    %eax,%esi
+  8025ba:	8d 86 ff 0f 00 00    	lea    0xfff(%esi),%eax
+  8025c0:	c1 e8 0c             	shr    $0xc,%eax
+  8025c3:	ba 10 00 00 00       	mov    $0x10,%edx
+  8025c8:	39 d0                	cmp    %edx,%eax
+  8025ca:	0f 47 c2             	cmova  %edx,%eax
+  8025cd:	89 c7                	mov    %eax,%edi
+  if ((perm & PTE_W) || PGOFF(fileoffset))
+  8025cf:	8b 9d 94 fd ff ff    	mov    -0x26c(%ebp),%ebx
+  8025d5:	83 e3 02             	and    $0x2,%ebx
+  8025d8:	8b 95 74 fd ff ff    	mov    -0x28c(%ebp),%edx
+  8025de:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  8025e4:	09 d3                	or     %edx,%ebx
+  8025e6:	0f 85 98 fd ff ff    	jne    802384 <spawn+0x2c4>
+    n = MIN(n, (filesz - i) / PGSIZE);
+  8025ec:	89 f2                	mov    %esi,%edx
+  8025ee:	c1 ea 0c             	shr    $0xc,%edx
+  8025f1:	39 c2                	cmp    %eax,%edx
+  8025f3:	0f 47 d0             	cmova  %eax,%edx
+  8025f6:	8b 8d 7c fd ff ff    	mov    -0x284(%ebp),%ecx
+  8025fc:	39 8d 8c fd ff ff    	cmp    %ecx,-0x274(%ebp)
+  802602:	0f 43 d0             	cmovae %eax,%edx
+    if ((m = shared_pages(perm, memsz, filesz, fileoffset, i, n)) > 0) {
+  802605:	89 95 60 fd ff ff    	mov    %edx,-0x2a0(%ebp)
+  80260b:	85 d2                	test   %edx,%edx
+  80260d:	0f 8e 86 fd ff ff    	jle    802399 <spawn+0x2d9>
+      if ((r = sysbatch_flush(&batch)) < 0)
+  802613:	83 ec 0c             	sub    $0xc,%esp
+  802616:	68 60 57 80 00       	push   $0x805760
+  80261b:	e8 c3 e9 ff ff       	call   800fe3 <sysbatch_flush>
+  802620:	83 c4 10             	add    $0x10,%esp
+  802623:	85 c0                	test   %eax,%eax
+  802625:	0f 88 56 01 00 00    	js     802781 <spawn+0x6c1>
+  80262b:	8b 85 60 fd ff ff    	mov    -0x2a0(%ebp),%eax
+  802631:	c1 e0 0c             	shl    $0xc,%eax
+  802634:	89 f1                	mov    %esi,%ecx
+  802636:	29 c1                	sub    %eax,%ecx
+  802638:	89 8d 80 fd ff ff    	mov    %ecx,-0x280(%ebp)
+  80263e:	89 f3                	mov    %esi,%ebx
+        if ((r = read_map(fd, fileoffset + i + j * PGSIZE,
+  802640:	8d be 00 10 40 00    	lea    0x401000(%esi),%edi
+  802646:	8b 8d 74 fd ff ff    	mov    -0x28c(%ebp),%ecx
+  80264c:	8b 85 8c fd ff ff    	mov    -0x274(%ebp),%eax
+  802652:	8d 34 01             	lea    (%ecx,%eax,1),%esi
+      for (j = 0; j < n; j++) {
+  802655:	8b 85 80 fd ff ff    	mov    -0x280(%ebp),%eax
+  80265b:	39 c3                	cmp    %eax,%ebx
+  80265d:	0f 84 28 fd ff ff    	je     80238b <spawn+0x2cb>
+        if ((r = read_map(fd, fileoffset + i + j * PGSIZE,
+  802663:	83 ec 04             	sub    $0x4,%esp
+  802666:	89 f8                	mov    %edi,%eax
+  802668:	29 d8                	sub    %ebx,%eax
+  80266a:	50                   	push   %eax
+  80266b:	89 f0                	mov    %esi,%eax
+  80266d:	29 d8                	sub    %ebx,%eax
+  80266f:	50                   	push   %eax
+  802670:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  802676:	e8 00 f8 ff ff       	call   801e7b <read_map>
+  80267b:	83 c4 10             	add    $0x10,%esp
+  80267e:	85 c0                	test   %eax,%eax
+  802680:	0f 88 02 01 00 00    	js     802788 <spawn+0x6c8>
+        if (r < MIN(PGSIZE, filesz - i - j * PGSIZE))
+  802686:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80268b:	39 d3                	cmp    %edx,%ebx
+  80268d:	0f 46 d3             	cmovbe %ebx,%edx
+  802690:	81 eb 00 10 00 00    	sub    $0x1000,%ebx
+  802696:	39 d0                	cmp    %edx,%eax
+  802698:	73 bb                	jae    802655 <spawn+0x595>
+          return -E_INVAL;
+  80269a:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+  80269f:	e9 24 fd ff ff       	jmp    8023c8 <spawn+0x308>
+  close(fd);
+  8026a4:	83 ec 0c             	sub    $0xc,%esp
+  8026a7:	ff b5 88 fd ff ff    	push   -0x278(%ebp)
+  8026ad:	e8 7a eb ff ff       	call   80122c <close>
+// Copy the mappings for shared pages into the child address space.
+static int
+copy_shared_pages(envid_t child)
+{
+  // LAB 5: Your code here.
+  return sysbatch_add(&batch, SYS_page_map_range, 0, 0, UTOP,
+  8026b2:	83 c4 0c             	add    $0xc,%esp
+  8026b5:	6a 02                	push   $0x2
+  8026b7:	ff b5 90 fd ff ff    	push   -0x270(%ebp)
+  8026bd:	68 00 00 c0 ee       	push   $0xeec00000
+  8026c2:	6a 00                	push   $0x0
+  8026c4:	6a 00                	push   $0x0
+  8026c6:	6a 11                	push   $0x11
+  8026c8:	68 60 57 80 00       	push   $0x805760
+  8026cd:	e8 61 e9 ff ff       	call   801033 <sysbatch_add>
+  if ((r = copy_shared_pages(child)) < 0)
+  8026d2:	83 c4 20             	add    $0x20,%esp
+  8026d5:	85 c0                	test   %eax,%eax
+  8026d7:	78 72                	js     80274b <spawn+0x68b>
+  if ((r = sysbatch_add(&batch, SYS_env_set_trapframe, child,
+  8026d9:	83 ec 04             	sub    $0x4,%esp
+  8026dc:	6a 00                	push   $0x0
+  8026de:	6a 00                	push   $0x0
+  8026e0:	6a 00                	push   $0x0
+  8026e2:	8d 85 a4 fd ff ff    	lea    -0x25c(%ebp),%eax
+  8026e8:	50                   	push   %eax
+  8026e9:	8b bd 90 fd ff ff    	mov    -0x270(%ebp),%edi
+  8026ef:	57                   	push   %edi
+  8026f0:	6a 09                	push   $0x9
+  8026f2:	68 60 57 80 00       	push   $0x805760
+  8026f7:	e8 37 e9 ff ff       	call   801033 <sysbatch_add>
+  8026fc:	83 c4 20             	add    $0x20,%esp
+  8026ff:	85 c0                	test   %eax,%eax
+  802701:	78 33                	js     802736 <spawn+0x676>
+      (r = sysbatch_add(&batch, SYS_env_set_status, child,
+  802703:	83 ec 04             	sub    $0x4,%esp
+  802706:	6a 00                	push   $0x0
+  802708:	6a 00                	push   $0x0
+  80270a:	6a 00                	push   $0x0
+  80270c:	6a 02                	push   $0x2
+  80270e:	57                   	push   %edi
+  80270f:	6a 08                	push   $0x8
+  802711:	68 60 57 80 00       	push   $0x805760
+  802716:	e8 18 e9 ff ff       	call   801033 <sysbatch_add>
+                        (uint32_t) &child_tf, 0, 0, 0)) < 0 ||
+  80271b:	83 c4 20             	add    $0x20,%esp
+  80271e:	85 c0                	test   %eax,%eax
+  802720:	78 14                	js     802736 <spawn+0x676>
+      (r = sysbatch_flush(&batch)) < 0)
+  802722:	83 ec 0c             	sub    $0xc,%esp
+  802725:	68 60 57 80 00       	push   $0x805760
+  80272a:	e8 b4 e8 ff ff       	call   800fe3 <sysbatch_flush>
+                        ENV_RUNNABLE, 0, 0, 0)) < 0 ||
+  80272f:	83 c4 10             	add    $0x10,%esp
+  802732:	85 c0                	test   %eax,%eax
+  802734:	79 36                	jns    80276c <spawn+0x6ac>
+    panic("spawn: starting child: %e", r);
+  802736:	50                   	push   %eax
+  802737:	68 24 3b 80 00       	push   $0x803b24
+  80273c:	68 93 00 00 00       	push   $0x93
+  802741:	68 02 3b 80 00       	push   $0x803b02
+  802746:	e8 9d d9 ff ff       	call   8000e8 <_panic>
+    panic("copy_shared_pages: %e", r);
+  80274b:	50                   	push   %eax
+  80274c:	68 0e 3b 80 00       	push   $0x803b0e
+  802751:	68 8c 00 00 00       	push   $0x8c
+  802756:	68 02 3b 80 00       	push   $0x803b02
+  80275b:	e8 88 d9 ff ff       	call   8000e8 <_panic>
+    return r;
+  802760:	8b 85 88 fd ff ff    	mov    -0x278(%ebp),%eax
+  802766:	89 85 6c fd ff ff    	mov    %eax,-0x294(%ebp)
+}
+  80276c:	8b 85 6c fd ff ff    	mov    -0x294(%ebp),%eax
+  802772:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802775:	5b                   	pop    %ebx
+  802776:	5e                   	pop    %esi
+  802777:	5f                   	pop    %edi
+  802778:	5d                   	pop    %ebp
+  802779:	c3                   	ret
+  80277a:	89 c6                	mov    %eax,%esi
+  80277c:	e9 47 fc ff ff       	jmp    8023c8 <spawn+0x308>
+  802781:	89 c6                	mov    %eax,%esi
+  802783:	e9 40 fc ff ff       	jmp    8023c8 <spawn+0x308>
+  802788:	89 c6                	mov    %eax,%esi
+  80278a:	e9 39 fc ff ff       	jmp    8023c8 <spawn+0x308>
+  80278f:	89 c6                	mov    %eax,%esi
+  802791:	e9 32 fc ff ff       	jmp    8023c8 <spawn+0x308>
+  802796:	89 c6                	mov    %eax,%esi
+  802798:	e9 2b fc ff ff       	jmp    8023c8 <spawn+0x308>
+  80279d:	89 c6                	mov    %eax,%esi
+  80279f:	e9 24 fc ff ff       	jmp    8023c8 <spawn+0x308>
+  8027a4:	89 c6                	mov    %eax,%esi
+  8027a6:	e9 1d fc ff ff       	jmp    8023c8 <spawn+0x308>
+    return -E_NO_MEM;
+  8027ab:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  return r;
+  8027b0:	89 85 6c fd ff ff    	mov    %eax,-0x294(%ebp)
+  8027b6:	eb b4                	jmp    80276c <spawn+0x6ac>
+  sys_page_unmap(0, UTEMP);
+  8027b8:	83 ec 08             	sub    $0x8,%esp
+  8027bb:	68 00 00 40 00       	push   $0x400000
+  8027c0:	6a 00                	push   $0x0
+  8027c2:	e8 9e e4 ff ff       	call   800c65 <sys_page_unmap>
+  8027c7:	83 c4 10             	add    $0x10,%esp
+  8027ca:	89 9d 6c fd ff ff    	mov    %ebx,-0x294(%ebp)
+  8027d0:	eb 9a                	jmp    80276c <spawn+0x6ac>
+
+008027d2 <spawnl>:
+{
+  8027d2:	55                   	push   %ebp
+  8027d3:	89 e5                	mov    %esp,%ebp
+  8027d5:	56                   	push   %esi
+  8027d6:	53                   	push   %ebx
+  va_start(vl, arg0);
+  8027d7:	8d 45 10             	lea    0x10(%ebp),%eax
+  int argc = 0;
+  8027da:	be 00 00 00 00       	mov    $0x0,%esi
+  while (va_arg(vl, void *) != NULL) {
+  8027df:	eb 17                	jmp    8027f8 <spawnl+0x26>
+      cprintf("vl: %p saying %s\n", vl, vl);
+  8027e1:	83 ec 04             	sub    $0x4,%esp
+  8027e4:	53                   	push   %ebx
+  8027e5:	53                   	push   %ebx
+  8027e6:	68 3e 3b 80 00       	push   $0x803b3e
+  8027eb:	e8 d3 d9 ff ff       	call   8001c3 <cprintf>
+    argc++;
+  8027f0:	83 c6 01             	add    $0x1,%esi
+  8027f3:	83 c4 10             	add    $0x10,%esp
+  while (va_arg(vl, void *) != NULL) {
+  8027f6:	89 d8                	mov    %ebx,%eax
+  8027f8:	8d 58 04             	lea    0x4(%eax),%ebx
+  8027fb:	83 38 00             	cmpl   $0x0,(%eax)
+  8027fe:	75 e1                	jne    8027e1 <spawnl+0xf>
+  cprintf("argc found %d\n", argc);
+  802800:	83 ec 08             	sub    $0x8,%esp
+  802803:	56                   	push   %esi
+  802804:	68 50 3b 80 00       	push   $0x803b50
+  802809:	e8 b5 d9 ff ff       	call   8001c3 <cprintf>
+  const char *argv[argc+2];
+  80280e:	8d 04 b5 17 00 00 00 	lea    0x17(,%esi,4),%eax
+  802815:	83 e0 f0             	and    $0xfffffff0,%eax
+  802818:	83 c4 10             	add    $0x10,%esp
+  80281b:	29 c4                	sub    %eax,%esp
+  80281d:	8d 5c 24 03          	lea    0x3(%esp),%ebx
+  802821:	89 d8                	mov    %ebx,%eax
+  802823:	c1 e8 02             	shr    $0x2,%eax
+  802826:	83 e3 fc             	and    $0xfffffffc,%ebx
+  argv[0] = arg0;
+  802829:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80282c:	89 14 85 00 00 00 00 	mov    %edx,0x0(,%eax,4)
+  argv[argc+1] = NULL;
+  802833:	c7 44 b3 04 00 00 00 	movl   $0x0,0x4(%ebx,%esi,4)
+  80283a:	00 
+  va_start(vl, arg0);
+  80283b:	8d 55 10             	lea    0x10(%ebp),%edx
+  for (i = 0; i < argc; i++)
+  80283e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802843:	eb 0b                	jmp    802850 <spawnl+0x7e>
+    argv[i+1] = va_arg(vl, const char *);
+  802845:	83 c0 01             	add    $0x1,%eax
+  802848:	8b 0a                	mov    (%edx),%ecx
+  80284a:	89 0c 83             	mov    %ecx,(%ebx,%eax,4)
+  80284d:	8d 52 04             	lea    0x4(%edx),%edx
+  for (i = 0; i < argc; i++)
+  802850:	39 f0                	cmp    %esi,%eax
+  802852:	75 f1                	jne    802845 <spawnl+0x73>
+  return spawn(prog, argv);
+  802854:	83 ec 08             	sub    $0x8,%esp
+  802857:	53                   	push   %ebx
+  802858:	ff 75 08             	push   0x8(%ebp)
+  80285b:	e8 60 f8 ff ff       	call   8020c0 <spawn>
+}
+  802860:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802863:	5b                   	pop    %ebx
+  802864:	5e                   	pop    %esi
+  802865:	5d                   	pop    %ebp
+  802866:	c3                   	ret
+
+00802867 <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  802867:	55                   	push   %ebp
+  802868:	89 e5                	mov    %esp,%ebp
+  80286a:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  80286d:	50                   	push   %eax
+  80286e:	e8 2c e8 ff ff       	call   80109f <fd2data>
+  802873:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  802878:	c9                   	leave
+  802879:	c3                   	ret
+
+0080287a <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80287a:	55                   	push   %ebp
+  80287b:	89 e5                	mov    %esp,%ebp
+  80287d:	56                   	push   %esi
+  80287e:	53                   	push   %ebx
+  80287f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  802882:	83 ec 0c             	sub    $0xc,%esp
+  802885:	ff 75 08             	push   0x8(%ebp)
+  802888:	e8 12 e8 ff ff       	call   80109f <fd2data>
+  80288d:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  80288f:	83 c4 08             	add    $0x8,%esp
+  802892:	68 86 3b 80 00       	push   $0x803b86
+  802897:	53                   	push   %ebx
+  802898:	e8 14 df ff ff       	call   8007b1 <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  80289d:	8b 46 04             	mov    0x4(%esi),%eax
+  8028a0:	2b 06                	sub    (%esi),%eax
+  8028a2:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  8028a8:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8028af:	00 00 00 
+  stat->st_dev = &devpipe;
+  8028b2:	c7 83 88 00 00 00 20 	movl   $0x804020,0x88(%ebx)
+  8028b9:	40 80 00 
+  return 0;
+}
+  8028bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028c1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8028c4:	5b                   	pop    %ebx
+  8028c5:	5e                   	pop    %esi
+  8028c6:	5d                   	pop    %ebp
+  8028c7:	c3                   	ret
+
+008028c8 <pipe_wakeup>:
+{
+  8028c8:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  8028ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028cf:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  8028d2:	85 c0                	test   %eax,%eax
+  8028d4:	75 01                	jne    8028d7 <pipe_wakeup+0xf>
+  8028d6:	c3                   	ret
+{
+  8028d7:	55                   	push   %ebp
+  8028d8:	89 e5                	mov    %esp,%ebp
+  8028da:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  8028dd:	6a 00                	push   $0x0
+  8028df:	68 00 00 c0 ee       	push   $0xeec00000
+  8028e4:	52                   	push   %edx
+  8028e5:	e8 52 e6 ff ff       	call   800f3c <sys_chan_wakeup>
+  8028ea:	83 c4 10             	add    $0x10,%esp
+}
+  8028ed:	c9                   	leave
+  8028ee:	c3                   	ret
+
+008028ef <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8028ef:	55                   	push   %ebp
+  8028f0:	89 e5                	mov    %esp,%ebp
+  8028f2:	57                   	push   %edi
+  8028f3:	56                   	push   %esi
+  8028f4:	53                   	push   %ebx
+  8028f5:	83 ec 18             	sub    $0x18,%esp
+  8028f8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  8028fb:	57                   	push   %edi
+  8028fc:	e8 9e e7 ff ff       	call   80109f <fd2data>
+  802901:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  802903:	83 c4 10             	add    $0x10,%esp
+  802906:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  80290a:	74 2a                	je     802936 <devpipe_close+0x47>
+  80290c:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  802911:	89 f8                	mov    %edi,%eax
+  802913:	e8 4f ff ff ff       	call   802867 <pipe_ring>
+  802918:	83 ec 08             	sub    $0x8,%esp
+  80291b:	01 d8                	add    %ebx,%eax
+  80291d:	50                   	push   %eax
+  80291e:	6a 00                	push   $0x0
+  802920:	e8 40 e3 ff ff       	call   800c65 <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  802925:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80292b:	83 c4 10             	add    $0x10,%esp
+  80292e:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  802934:	75 db                	jne    802911 <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  802936:	83 ec 08             	sub    $0x8,%esp
+  802939:	57                   	push   %edi
+  80293a:	6a 00                	push   $0x0
+  80293c:	e8 24 e3 ff ff       	call   800c65 <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  802941:	83 c4 10             	add    $0x10,%esp
+  802944:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  802948:	75 13                	jne    80295d <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  80294a:	83 ec 08             	sub    $0x8,%esp
+  80294d:	56                   	push   %esi
+  80294e:	6a 00                	push   $0x0
+  802950:	e8 10 e3 ff ff       	call   800c65 <sys_page_unmap>
+}
+  802955:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802958:	5b                   	pop    %ebx
+  802959:	5e                   	pop    %esi
+  80295a:	5f                   	pop    %edi
+  80295b:	5d                   	pop    %ebp
+  80295c:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  80295d:	8d 56 04             	lea    0x4(%esi),%edx
+  802960:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802963:	e8 60 ff ff ff       	call   8028c8 <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802968:	8d 46 30             	lea    0x30(%esi),%eax
+  80296b:	89 f2                	mov    %esi,%edx
+  80296d:	e8 56 ff ff ff       	call   8028c8 <pipe_wakeup>
+  802972:	eb d6                	jmp    80294a <devpipe_close+0x5b>
+
+00802974 <_pipeisclosed>:
+{
+  802974:	55                   	push   %ebp
+  802975:	89 e5                	mov    %esp,%ebp
+  802977:	57                   	push   %edi
+  802978:	56                   	push   %esi
+  802979:	53                   	push   %ebx
+  80297a:	83 ec 1c             	sub    $0x1c,%esp
+  80297d:	89 c7                	mov    %eax,%edi
+  80297f:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  802981:	a1 64 5e 80 00       	mov    0x805e64,%eax
+  802986:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  802989:	83 ec 0c             	sub    $0xc,%esp
+  80298c:	57                   	push   %edi
+  80298d:	e8 18 0a 00 00       	call   8033aa <pageref>
+  802992:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802995:	89 34 24             	mov    %esi,(%esp)
+  802998:	e8 0d 0a 00 00       	call   8033aa <pageref>
+    nn = thisenv->env_runs;
+  80299d:	8b 15 64 5e 80 00    	mov    0x805e64,%edx
+  8029a3:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  8029a6:	83 c4 10             	add    $0x10,%esp
+  8029a9:	39 cb                	cmp    %ecx,%ebx
+  8029ab:	74 1b                	je     8029c8 <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  8029ad:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8029b0:	75 cf                	jne    802981 <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8029b2:	8b 42 58             	mov    0x58(%edx),%eax
+  8029b5:	6a 01                	push   $0x1
+  8029b7:	50                   	push   %eax
+  8029b8:	53                   	push   %ebx
+  8029b9:	68 8d 3b 80 00       	push   $0x803b8d
+  8029be:	e8 00 d8 ff ff       	call   8001c3 <cprintf>
+  8029c3:	83 c4 10             	add    $0x10,%esp
+  8029c6:	eb b9                	jmp    802981 <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  8029c8:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8029cb:	0f 94 c0             	sete   %al
+  8029ce:	0f b6 c0             	movzbl %al,%eax
+}
+  8029d1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029d4:	5b                   	pop    %ebx
+  8029d5:	5e                   	pop    %esi
+  8029d6:	5f                   	pop    %edi
+  8029d7:	5d                   	pop    %ebp
+  8029d8:	c3                   	ret
+
+008029d9 <devpipe_write_bulk>:
+{
+  8029d9:	55                   	push   %ebp
+  8029da:	89 e5                	mov    %esp,%ebp
+  8029dc:	57                   	push   %edi
+  8029dd:	56                   	push   %esi
+  8029de:	53                   	push   %ebx
+  8029df:	83 ec 1c             	sub    $0x1c,%esp
+  8029e2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8029e5:	89 d6                	mov    %edx,%esi
+  8029e7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  8029ea:	e8 78 fe ff ff       	call   802867 <pipe_ring>
+  8029ef:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  8029f2:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  8029f7:	8d 46 04             	lea    0x4(%esi),%eax
+  8029fa:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  8029fd:	eb 75                	jmp    802a74 <devpipe_write_bulk+0x9b>
+  8029ff:	b8 01 00 00 00       	mov    $0x1,%eax
+  802a04:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802a08:	6a 64                	push   $0x64
+  802a0a:	68 00 00 c0 ee       	push   $0xeec00000
+  802a0f:	53                   	push   %ebx
+  802a10:	56                   	push   %esi
+  802a11:	e8 03 e5 ff ff       	call   800f19 <sys_chan_sleep>
+      continue;
+  802a16:	83 c4 10             	add    $0x10,%esp
+  802a19:	eb 59                	jmp    802a74 <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  802a1b:	89 d1                	mov    %edx,%ecx
+  802a1d:	c1 f9 1f             	sar    $0x1f,%ecx
+  802a20:	c1 e9 11             	shr    $0x11,%ecx
+  802a23:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802a26:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802a2b:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  802a2d:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  802a33:	29 d3                	sub    %edx,%ebx
+  802a35:	ba 00 80 00 00       	mov    $0x8000,%edx
+  802a3a:	29 c2                	sub    %eax,%edx
+  802a3c:	39 d3                	cmp    %edx,%ebx
+  802a3e:	0f 47 da             	cmova  %edx,%ebx
+  802a41:	8b 55 08             	mov    0x8(%ebp),%edx
+  802a44:	29 fa                	sub    %edi,%edx
+  802a46:	39 d3                	cmp    %edx,%ebx
+  802a48:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  802a4b:	83 ec 04             	sub    $0x4,%esp
+  802a4e:	53                   	push   %ebx
+  802a4f:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802a52:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  802a55:	52                   	push   %edx
+  802a56:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802a59:	01 c8                	add    %ecx,%eax
+  802a5b:	50                   	push   %eax
+  802a5c:	e8 38 df ff ff       	call   800999 <memcpy>
+    i += m;
+  802a61:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  802a63:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802a66:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802a69:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802a6c:	e8 57 fe ff ff       	call   8028c8 <pipe_wakeup>
+  802a71:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802a74:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802a77:	73 2b                	jae    802aa4 <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  802a79:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  802a7b:	8b 56 04             	mov    0x4(%esi),%edx
+  802a7e:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  802a84:	39 d0                	cmp    %edx,%eax
+  802a86:	7d 93                	jge    802a1b <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  802a88:	89 f2                	mov    %esi,%edx
+  802a8a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802a8d:	e8 e2 fe ff ff       	call   802974 <_pipeisclosed>
+  802a92:	85 c0                	test   %eax,%eax
+  802a94:	0f 84 65 ff ff ff    	je     8029ff <devpipe_write_bulk+0x26>
+        return i;
+  802a9a:	89 f8                	mov    %edi,%eax
+}
+  802a9c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a9f:	5b                   	pop    %ebx
+  802aa0:	5e                   	pop    %esi
+  802aa1:	5f                   	pop    %edi
+  802aa2:	5d                   	pop    %ebp
+  802aa3:	c3                   	ret
+  return i;
+  802aa4:	89 f8                	mov    %edi,%eax
+  802aa6:	eb f4                	jmp    802a9c <devpipe_write_bulk+0xc3>
+
+00802aa8 <devpipe_write>:
+{
+  802aa8:	55                   	push   %ebp
+  802aa9:	89 e5                	mov    %esp,%ebp
+  802aab:	57                   	push   %edi
+  802aac:	56                   	push   %esi
+  802aad:	53                   	push   %ebx
+  802aae:	83 ec 28             	sub    $0x28,%esp
+  802ab1:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  802ab4:	56                   	push   %esi
+  802ab5:	e8 e5 e5 ff ff       	call   80109f <fd2data>
+  802aba:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  802abc:	8b 78 28             	mov    0x28(%eax),%edi
+  802abf:	83 c4 10             	add    $0x10,%esp
+  802ac2:	85 ff                	test   %edi,%edi
+  802ac4:	75 25                	jne    802aeb <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  802ac6:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802ac9:	74 66                	je     802b31 <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802acb:	8b 43 04             	mov    0x4(%ebx),%eax
+  802ace:	8b 0b                	mov    (%ebx),%ecx
+  802ad0:	8d 51 20             	lea    0x20(%ecx),%edx
+  802ad3:	39 d0                	cmp    %edx,%eax
+  802ad5:	72 2b                	jb     802b02 <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  802ad7:	89 da                	mov    %ebx,%edx
+  802ad9:	89 f0                	mov    %esi,%eax
+  802adb:	e8 94 fe ff ff       	call   802974 <_pipeisclosed>
+  802ae0:	85 c0                	test   %eax,%eax
+  802ae2:	75 51                	jne    802b35 <devpipe_write+0x8d>
+      sys_yield();
+  802ae4:	e8 95 e0 ff ff       	call   800b7e <sys_yield>
+  802ae9:	eb e0                	jmp    802acb <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  802aeb:	83 ec 0c             	sub    $0xc,%esp
+  802aee:	ff 75 10             	push   0x10(%ebp)
+  802af1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802af4:	89 c2                	mov    %eax,%edx
+  802af6:	89 f0                	mov    %esi,%eax
+  802af8:	e8 dc fe ff ff       	call   8029d9 <devpipe_write_bulk>
+  802afd:	83 c4 10             	add    $0x10,%esp
+  802b00:	eb 38                	jmp    802b3a <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802b02:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802b05:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802b09:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802b0c:	89 c2                	mov    %eax,%edx
+  802b0e:	c1 fa 1f             	sar    $0x1f,%edx
+  802b11:	89 d1                	mov    %edx,%ecx
+  802b13:	c1 e9 1b             	shr    $0x1b,%ecx
+  802b16:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802b19:	83 e2 1f             	and    $0x1f,%edx
+  802b1c:	29 ca                	sub    %ecx,%edx
+  802b1e:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802b22:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  802b26:	83 c0 01             	add    $0x1,%eax
+  802b29:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  802b2c:	83 c7 01             	add    $0x1,%edi
+  802b2f:	eb 95                	jmp    802ac6 <devpipe_write+0x1e>
+  return i;
+  802b31:	89 f8                	mov    %edi,%eax
+  802b33:	eb 05                	jmp    802b3a <devpipe_write+0x92>
+        return 0;
+  802b35:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802b3a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b3d:	5b                   	pop    %ebx
+  802b3e:	5e                   	pop    %esi
+  802b3f:	5f                   	pop    %edi
+  802b40:	5d                   	pop    %ebp
+  802b41:	c3                   	ret
+
+00802b42 <devpipe_read_bulk>:
+{
+  802b42:	55                   	push   %ebp
+  802b43:	89 e5                	mov    %esp,%ebp
+  802b45:	57                   	push   %edi
+  802b46:	56                   	push   %esi
+  802b47:	53                   	push   %ebx
+  802b48:	83 ec 2c             	sub    $0x2c,%esp
+  802b4b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802b4e:	89 d6                	mov    %edx,%esi
+  802b50:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802b53:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  802b56:	e8 0c fd ff ff       	call   802867 <pipe_ring>
+  802b5b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  802b5e:	85 db                	test   %ebx,%ebx
+  802b60:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802b65:	0f 45 c3             	cmovne %ebx,%eax
+  802b68:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802b6b:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802b70:	8d 46 30             	lea    0x30(%esi),%eax
+  802b73:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  802b76:	eb 50                	jmp    802bc8 <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  802b78:	89 d1                	mov    %edx,%ecx
+  802b7a:	c1 f9 1f             	sar    $0x1f,%ecx
+  802b7d:	c1 e9 11             	shr    $0x11,%ecx
+  802b80:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802b83:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802b88:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  802b8a:	29 d3                	sub    %edx,%ebx
+  802b8c:	ba 00 80 00 00       	mov    $0x8000,%edx
+  802b91:	29 c2                	sub    %eax,%edx
+  802b93:	39 d3                	cmp    %edx,%ebx
+  802b95:	0f 47 da             	cmova  %edx,%ebx
+  802b98:	8b 55 08             	mov    0x8(%ebp),%edx
+  802b9b:	29 fa                	sub    %edi,%edx
+  802b9d:	39 d3                	cmp    %edx,%ebx
+  802b9f:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  802ba2:	83 ec 04             	sub    $0x4,%esp
+  802ba5:	53                   	push   %ebx
+  802ba6:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802ba9:	01 c8                	add    %ecx,%eax
+  802bab:	50                   	push   %eax
+  802bac:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802baf:	01 f8                	add    %edi,%eax
+  802bb1:	50                   	push   %eax
+  802bb2:	e8 e2 dd ff ff       	call   800999 <memcpy>
+    i += m;
+  802bb7:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  802bb9:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802bbb:	89 f2                	mov    %esi,%edx
+  802bbd:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802bc0:	e8 03 fd ff ff       	call   8028c8 <pipe_wakeup>
+  802bc5:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802bc8:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802bcb:	73 51                	jae    802c1e <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  802bcd:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  802bd0:	8b 16                	mov    (%esi),%edx
+  802bd2:	39 da                	cmp    %ebx,%edx
+  802bd4:	75 a2                	jne    802b78 <devpipe_read_bulk+0x36>
+      if (i > 0)
+  802bd6:	85 ff                	test   %edi,%edi
+  802bd8:	75 44                	jne    802c1e <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  802bda:	89 f2                	mov    %esi,%edx
+  802bdc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802bdf:	e8 90 fd ff ff       	call   802974 <_pipeisclosed>
+  802be4:	85 c0                	test   %eax,%eax
+  802be6:	75 3a                	jne    802c22 <devpipe_read_bulk+0xe0>
+  802be8:	b8 01 00 00 00       	mov    $0x1,%eax
+  802bed:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802bf1:	6a 64                	push   $0x64
+  802bf3:	ff 75 d4             	push   -0x2c(%ebp)
+  802bf6:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  802bf7:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802bfa:	50                   	push   %eax
+  802bfb:	e8 19 e3 ff ff       	call   800f19 <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  802c00:	85 c0                	test   %eax,%eax
+  802c02:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c07:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  802c0a:	83 c4 10             	add    $0x10,%esp
+  802c0d:	a8 01                	test   $0x1,%al
+  802c0f:	74 b7                	je     802bc8 <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  802c11:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  802c16:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c19:	5b                   	pop    %ebx
+  802c1a:	5e                   	pop    %esi
+  802c1b:	5f                   	pop    %edi
+  802c1c:	5d                   	pop    %ebp
+  802c1d:	c3                   	ret
+  return i;
+  802c1e:	89 f8                	mov    %edi,%eax
+  802c20:	eb f4                	jmp    802c16 <devpipe_read_bulk+0xd4>
+        return 0;
+  802c22:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c27:	eb ed                	jmp    802c16 <devpipe_read_bulk+0xd4>
+
+00802c29 <devpipe_read>:
+{
+  802c29:	55                   	push   %ebp
+  802c2a:	89 e5                	mov    %esp,%ebp
+  802c2c:	57                   	push   %edi
+  802c2d:	56                   	push   %esi
+  802c2e:	53                   	push   %ebx
+  802c2f:	83 ec 18             	sub    $0x18,%esp
+  802c32:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  802c35:	57                   	push   %edi
+  802c36:	e8 64 e4 ff ff       	call   80109f <fd2data>
+  802c3b:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  802c3d:	8b 70 28             	mov    0x28(%eax),%esi
+  802c40:	83 c4 10             	add    $0x10,%esp
+  802c43:	85 f6                	test   %esi,%esi
+  802c45:	75 24                	jne    802c6b <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  802c47:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802c4a:	74 60                	je     802cac <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  802c4c:	8b 03                	mov    (%ebx),%eax
+  802c4e:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802c51:	75 3b                	jne    802c8e <devpipe_read+0x65>
+      if (i > 0)
+  802c53:	85 f6                	test   %esi,%esi
+  802c55:	75 2d                	jne    802c84 <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  802c57:	89 da                	mov    %ebx,%edx
+  802c59:	89 f8                	mov    %edi,%eax
+  802c5b:	e8 14 fd ff ff       	call   802974 <_pipeisclosed>
+  802c60:	85 c0                	test   %eax,%eax
+  802c62:	75 4c                	jne    802cb0 <devpipe_read+0x87>
+      sys_yield();
+  802c64:	e8 15 df ff ff       	call   800b7e <sys_yield>
+  802c69:	eb e1                	jmp    802c4c <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  802c6b:	83 ec 08             	sub    $0x8,%esp
+  802c6e:	6a 00                	push   $0x0
+  802c70:	ff 75 10             	push   0x10(%ebp)
+  802c73:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802c76:	89 c2                	mov    %eax,%edx
+  802c78:	89 f8                	mov    %edi,%eax
+  802c7a:	e8 c3 fe ff ff       	call   802b42 <devpipe_read_bulk>
+  802c7f:	83 c4 10             	add    $0x10,%esp
+  802c82:	eb 02                	jmp    802c86 <devpipe_read+0x5d>
+        return i;
+  802c84:	89 f0                	mov    %esi,%eax
+}
+  802c86:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c89:	5b                   	pop    %ebx
+  802c8a:	5e                   	pop    %esi
+  802c8b:	5f                   	pop    %edi
+  802c8c:	5d                   	pop    %ebp
+  802c8d:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802c8e:	99                   	cltd
+  802c8f:	c1 ea 1b             	shr    $0x1b,%edx
+  802c92:	01 d0                	add    %edx,%eax
+  802c94:	83 e0 1f             	and    $0x1f,%eax
+  802c97:	29 d0                	sub    %edx,%eax
+  802c99:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802c9e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802ca1:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  802ca4:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  802ca7:	83 c6 01             	add    $0x1,%esi
+  802caa:	eb 9b                	jmp    802c47 <devpipe_read+0x1e>
+  return i;
+  802cac:	89 f0                	mov    %esi,%eax
+  802cae:	eb d6                	jmp    802c86 <devpipe_read+0x5d>
+        return 0;
+  802cb0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cb5:	eb cf                	jmp    802c86 <devpipe_read+0x5d>
+
+00802cb7 <pipe2>:
+{
+  802cb7:	55                   	push   %ebp
+  802cb8:	89 e5                	mov    %esp,%ebp
+  802cba:	57                   	push   %edi
+  802cbb:	56                   	push   %esi
+  802cbc:	53                   	push   %ebx
+  802cbd:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  802cc0:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802cc3:	50                   	push   %eax
+  802cc4:	e8 ea e3 ff ff       	call   8010b3 <fd_alloc>
+  802cc9:	89 c3                	mov    %eax,%ebx
+  802ccb:	83 c4 10             	add    $0x10,%esp
+  802cce:	85 c0                	test   %eax,%eax
+  802cd0:	0f 88 fb 01 00 00    	js     802ed1 <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802cd6:	83 ec 04             	sub    $0x4,%esp
+  802cd9:	68 07 04 00 00       	push   $0x407
+  802cde:	ff 75 e4             	push   -0x1c(%ebp)
+  802ce1:	6a 00                	push   $0x0
+  802ce3:	e8 f8 de ff ff       	call   800be0 <sys_page_alloc>
+  802ce8:	89 c3                	mov    %eax,%ebx
+  802cea:	83 c4 10             	add    $0x10,%esp
+  802ced:	85 c0                	test   %eax,%eax
+  802cef:	0f 88 dc 01 00 00    	js     802ed1 <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  802cf5:	83 ec 0c             	sub    $0xc,%esp
+  802cf8:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  802cfb:	50                   	push   %eax
+  802cfc:	e8 b2 e3 ff ff       	call   8010b3 <fd_alloc>
+  802d01:	89 c3                	mov    %eax,%ebx
+  802d03:	83 c4 10             	add    $0x10,%esp
+  802d06:	85 c0                	test   %eax,%eax
+  802d08:	0f 88 b3 01 00 00    	js     802ec1 <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802d0e:	83 ec 04             	sub    $0x4,%esp
+  802d11:	68 07 04 00 00       	push   $0x407
+  802d16:	ff 75 e0             	push   -0x20(%ebp)
+  802d19:	6a 00                	push   $0x0
+  802d1b:	e8 c0 de ff ff       	call   800be0 <sys_page_alloc>
+  802d20:	89 c3                	mov    %eax,%ebx
+  802d22:	83 c4 10             	add    $0x10,%esp
+  802d25:	85 c0                	test   %eax,%eax
+  802d27:	0f 88 94 01 00 00    	js     802ec1 <pipe2+0x20a>
+  va = fd2data(fd0);
+  802d2d:	83 ec 0c             	sub    $0xc,%esp
+  802d30:	ff 75 e4             	push   -0x1c(%ebp)
+  802d33:	e8 67 e3 ff ff       	call   80109f <fd2data>
+  802d38:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802d3a:	83 c4 0c             	add    $0xc,%esp
+  802d3d:	68 07 04 00 00       	push   $0x407
+  802d42:	50                   	push   %eax
+  802d43:	6a 00                	push   $0x0
+  802d45:	e8 96 de ff ff       	call   800be0 <sys_page_alloc>
+  802d4a:	89 c3                	mov    %eax,%ebx
+  802d4c:	83 c4 10             	add    $0x10,%esp
+  802d4f:	85 c0                	test   %eax,%eax
+  802d51:	0f 88 5a 01 00 00    	js     802eb1 <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802d57:	83 ec 0c             	sub    $0xc,%esp
+  802d5a:	ff 75 e0             	push   -0x20(%ebp)
+  802d5d:	e8 3d e3 ff ff       	call   80109f <fd2data>
+  802d62:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802d69:	50                   	push   %eax
+  802d6a:	6a 00                	push   $0x0
+  802d6c:	57                   	push   %edi
+  802d6d:	6a 00                	push   $0x0
+  802d6f:	e8 af de ff ff       	call   800c23 <sys_page_map>
+  802d74:	89 c3                	mov    %eax,%ebx
+  802d76:	83 c4 20             	add    $0x20,%esp
+  802d79:	85 c0                	test   %eax,%eax
+  802d7b:	0f 88 22 01 00 00    	js     802ea3 <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  802d81:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  802d85:	74 72                	je     802df9 <pipe2+0x142>
+  802d87:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  802d8c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802d8f:	e8 d3 fa ff ff       	call   802867 <pipe_ring>
+  802d94:	83 ec 04             	sub    $0x4,%esp
+  802d97:	68 07 04 00 00       	push   $0x407
+  802d9c:	01 f0                	add    %esi,%eax
+  802d9e:	50                   	push   %eax
+  802d9f:	6a 00                	push   $0x0
+  802da1:	e8 3a de ff ff       	call   800be0 <sys_page_alloc>
+  802da6:	89 c3                	mov    %eax,%ebx
+  802da8:	83 c4 10             	add    $0x10,%esp
+  802dab:	85 c0                	test   %eax,%eax
+  802dad:	0f 88 97 00 00 00    	js     802e4a <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  802db3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802db6:	e8 ac fa ff ff       	call   802867 <pipe_ring>
+  802dbb:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  802dbe:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802dc1:	e8 a1 fa ff ff       	call   802867 <pipe_ring>
+  802dc6:	83 ec 0c             	sub    $0xc,%esp
+  802dc9:	68 07 04 00 00       	push   $0x407
+  802dce:	53                   	push   %ebx
+  802dcf:	6a 00                	push   $0x0
+  802dd1:	01 f0                	add    %esi,%eax
+  802dd3:	50                   	push   %eax
+  802dd4:	6a 00                	push   $0x0
+  802dd6:	e8 48 de ff ff       	call   800c23 <sys_page_map>
+  802ddb:	89 c3                	mov    %eax,%ebx
+  802ddd:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802de3:	83 c4 20             	add    $0x20,%esp
+  802de6:	85 c0                	test   %eax,%eax
+  802de8:	78 60                	js     802e4a <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  802dea:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802df0:	75 9a                	jne    802d8c <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  802df2:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  802df9:	a1 20 40 80 00       	mov    0x804020,%eax
+  802dfe:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802e01:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  802e03:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802e06:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  802e0d:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802e10:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  802e12:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802e15:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  802e1c:	83 ec 0c             	sub    $0xc,%esp
+  802e1f:	ff 75 e4             	push   -0x1c(%ebp)
+  802e22:	e8 68 e2 ff ff       	call   80108f <fd2num>
+  802e27:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802e2a:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  802e2c:	83 c4 04             	add    $0x4,%esp
+  802e2f:	ff 75 e0             	push   -0x20(%ebp)
+  802e32:	e8 58 e2 ff ff       	call   80108f <fd2num>
+  802e37:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802e3a:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  802e3d:	83 c4 10             	add    $0x10,%esp
+  802e40:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e45:	e9 87 00 00 00       	jmp    802ed1 <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802e4a:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  802e4f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802e52:	e8 10 fa ff ff       	call   802867 <pipe_ring>
+  802e57:	83 ec 08             	sub    $0x8,%esp
+  802e5a:	01 f0                	add    %esi,%eax
+  802e5c:	50                   	push   %eax
+  802e5d:	6a 00                	push   $0x0
+  802e5f:	e8 01 de ff ff       	call   800c65 <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  802e64:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802e67:	e8 fb f9 ff ff       	call   802867 <pipe_ring>
+  802e6c:	83 c4 08             	add    $0x8,%esp
+  802e6f:	01 f0                	add    %esi,%eax
+  802e71:	50                   	push   %eax
+  802e72:	6a 00                	push   $0x0
+  802e74:	e8 ec dd ff ff       	call   800c65 <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802e79:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802e7f:	83 c4 10             	add    $0x10,%esp
+  802e82:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802e88:	75 c5                	jne    802e4f <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  802e8a:	83 ec 0c             	sub    $0xc,%esp
+  802e8d:	ff 75 e0             	push   -0x20(%ebp)
+  802e90:	e8 0a e2 ff ff       	call   80109f <fd2data>
+  802e95:	83 c4 08             	add    $0x8,%esp
+  802e98:	50                   	push   %eax
+  802e99:	6a 00                	push   $0x0
+  802e9b:	e8 c5 dd ff ff       	call   800c65 <sys_page_unmap>
+  802ea0:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  802ea3:	83 ec 08             	sub    $0x8,%esp
+  802ea6:	57                   	push   %edi
+  802ea7:	6a 00                	push   $0x0
+  802ea9:	e8 b7 dd ff ff       	call   800c65 <sys_page_unmap>
+  802eae:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  802eb1:	83 ec 08             	sub    $0x8,%esp
+  802eb4:	ff 75 e0             	push   -0x20(%ebp)
+  802eb7:	6a 00                	push   $0x0
+  802eb9:	e8 a7 dd ff ff       	call   800c65 <sys_page_unmap>
+  802ebe:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  802ec1:	83 ec 08             	sub    $0x8,%esp
+  802ec4:	ff 75 e4             	push   -0x1c(%ebp)
+  802ec7:	6a 00                	push   $0x0
+  802ec9:	e8 97 dd ff ff       	call   800c65 <sys_page_unmap>
+  802ece:	83 c4 10             	add    $0x10,%esp
+}
+  802ed1:	89 d8                	mov    %ebx,%eax
+  802ed3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ed6:	5b                   	pop    %ebx
+  802ed7:	5e                   	pop    %esi
+  802ed8:	5f                   	pop    %edi
+  802ed9:	5d                   	pop    %ebp
+  802eda:	c3                   	ret
+
+00802edb <pipe>:
+{
+  802edb:	55                   	push   %ebp
+  802edc:	89 e5                	mov    %esp,%ebp
+  802ede:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  802ee1:	6a 00                	push   $0x0
+  802ee3:	ff 75 08             	push   0x8(%ebp)
+  802ee6:	e8 cc fd ff ff       	call   802cb7 <pipe2>
+}
+  802eeb:	c9                   	leave
+  802eec:	c3                   	ret
+
+00802eed <pipeisclosed>:
+{
+  802eed:	55                   	push   %ebp
+  802eee:	89 e5                	mov    %esp,%ebp
+  802ef0:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802ef3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802ef6:	50                   	push   %eax
+  802ef7:	ff 75 08             	push   0x8(%ebp)
+  802efa:	e8 0a e2 ff ff       	call   801109 <fd_lookup>
+  802eff:	83 c4 10             	add    $0x10,%esp
+  802f02:	85 c0                	test   %eax,%eax
+  802f04:	78 18                	js     802f1e <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  802f06:	83 ec 0c             	sub    $0xc,%esp
+  802f09:	ff 75 f4             	push   -0xc(%ebp)
+  802f0c:	e8 8e e1 ff ff       	call   80109f <fd2data>
+  802f11:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  802f13:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802f16:	e8 59 fa ff ff       	call   802974 <_pipeisclosed>
+  802f1b:	83 c4 10             	add    $0x10,%esp
+}
+  802f1e:	c9                   	leave
+  802f1f:	c3                   	ret
+
+00802f20 <pipe_splice>:
+{
+  802f20:	55                   	push   %ebp
+  802f21:	89 e5                	mov    %esp,%ebp
+  802f23:	57                   	push   %edi
+  802f24:	56                   	push   %esi
+  802f25:	53                   	push   %ebx
+  802f26:	83 ec 34             	sub    $0x34,%esp
+  802f29:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802f2c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802f2f:	50                   	push   %eax
+  802f30:	ff 75 08             	push   0x8(%ebp)
+  802f33:	e8 d1 e1 ff ff       	call   801109 <fd_lookup>
+  802f38:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802f3b:	83 c4 10             	add    $0x10,%esp
+  802f3e:	85 c0                	test   %eax,%eax
+  802f40:	0f 88 d7 00 00 00    	js     80301d <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  802f46:	83 ec 0c             	sub    $0xc,%esp
+  802f49:	ff 75 e4             	push   -0x1c(%ebp)
+  802f4c:	e8 4e e1 ff ff       	call   80109f <fd2data>
+  802f51:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802f53:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802f56:	83 c4 10             	add    $0x10,%esp
+  802f59:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802f5f:	39 10                	cmp    %edx,(%eax)
+  802f61:	0f 85 c1 00 00 00    	jne    803028 <pipe_splice+0x108>
+  802f67:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  802f6b:	0f 84 c0 00 00 00    	je     803031 <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  802f71:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802f75:	0f 84 bf 00 00 00    	je     80303a <pipe_splice+0x11a>
+  802f7b:	89 f7                	mov    %esi,%edi
+  802f7d:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  802f83:	0f 85 ba 00 00 00    	jne    803043 <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802f89:	8d 43 04             	lea    0x4(%ebx),%eax
+  802f8c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802f8f:	eb 38                	jmp    802fc9 <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802f91:	83 ec 0c             	sub    $0xc,%esp
+  802f94:	68 00 10 00 00       	push   $0x1000
+  802f99:	89 f1                	mov    %esi,%ecx
+  802f9b:	89 da                	mov    %ebx,%edx
+  802f9d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802fa0:	e8 34 fa ff ff       	call   8029d9 <devpipe_write_bulk>
+  802fa5:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802fa8:	83 c4 10             	add    $0x10,%esp
+  802fab:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802fb0:	75 53                	jne    803005 <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  802fb2:	83 ec 08             	sub    $0x8,%esp
+  802fb5:	56                   	push   %esi
+  802fb6:	6a 00                	push   $0x0
+  802fb8:	e8 a8 dc ff ff       	call   800c65 <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  802fbd:	83 c7 01             	add    $0x1,%edi
+  802fc0:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802fc6:	83 c4 10             	add    $0x10,%esp
+  802fc9:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802fcc:	74 3a                	je     803008 <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  802fce:	8b 03                	mov    (%ebx),%eax
+  802fd0:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802fd3:	75 bc                	jne    802f91 <pipe_splice+0x71>
+  802fd5:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fda:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  802fde:	85 c0                	test   %eax,%eax
+  802fe0:	74 af                	je     802f91 <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802fe2:	83 ec 04             	sub    $0x4,%esp
+  802fe5:	6a 07                	push   $0x7
+  802fe7:	56                   	push   %esi
+  802fe8:	ff 75 d0             	push   -0x30(%ebp)
+  802feb:	e8 4c df ff ff       	call   800f3c <sys_chan_wakeup>
+  802ff0:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802ff3:	83 c4 10             	add    $0x10,%esp
+  802ff6:	85 c0                	test   %eax,%eax
+  802ff8:	79 b8                	jns    802fb2 <pipe_splice+0x92>
+  802ffa:	b8 01 00 00 00       	mov    $0x1,%eax
+  802fff:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  803003:	eb 8c                	jmp    802f91 <pipe_splice+0x71>
+  803005:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  803008:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80300c:	75 06                	jne    803014 <pipe_splice+0xf4>
+  80300e:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  803012:	78 09                	js     80301d <pipe_splice+0xfd>
+  return i * PGSIZE;
+  803014:	8b 45 10             	mov    0x10(%ebp),%eax
+  803017:	c1 e0 0c             	shl    $0xc,%eax
+  80301a:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  80301d:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  803020:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803023:	5b                   	pop    %ebx
+  803024:	5e                   	pop    %esi
+  803025:	5f                   	pop    %edi
+  803026:	5d                   	pop    %ebp
+  803027:	c3                   	ret
+    return -E_INVAL;
+  803028:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  80302f:	eb ec                	jmp    80301d <pipe_splice+0xfd>
+  803031:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  803038:	eb e3                	jmp    80301d <pipe_splice+0xfd>
+  80303a:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  803041:	eb da                	jmp    80301d <pipe_splice+0xfd>
+  803043:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  80304a:	eb d1                	jmp    80301d <pipe_splice+0xfd>
+
+0080304c <pipe_splice_read>:
+{
+  80304c:	55                   	push   %ebp
+  80304d:	89 e5                	mov    %esp,%ebp
+  80304f:	53                   	push   %ebx
+  803050:	83 ec 1c             	sub    $0x1c,%esp
+  803053:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803056:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803059:	50                   	push   %eax
+  80305a:	ff 75 08             	push   0x8(%ebp)
+  80305d:	e8 a7 e0 ff ff       	call   801109 <fd_lookup>
+  803062:	83 c4 10             	add    $0x10,%esp
+  803065:	85 c0                	test   %eax,%eax
+  803067:	78 49                	js     8030b2 <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  803069:	83 ec 0c             	sub    $0xc,%esp
+  80306c:	ff 75 f4             	push   -0xc(%ebp)
+  80306f:	e8 2b e0 ff ff       	call   80109f <fd2data>
+  803074:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  803076:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803079:	83 c4 10             	add    $0x10,%esp
+  80307c:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  803082:	39 08                	cmp    %ecx,(%eax)
+  803084:	75 31                	jne    8030b7 <pipe_splice_read+0x6b>
+  803086:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  80308a:	74 32                	je     8030be <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  80308c:	8b 48 08             	mov    0x8(%eax),%ecx
+  80308f:	83 e1 03             	and    $0x3,%ecx
+  803092:	83 f9 01             	cmp    $0x1,%ecx
+  803095:	74 2e                	je     8030c5 <pipe_splice_read+0x79>
+  803097:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  80309d:	75 2d                	jne    8030cc <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  80309f:	83 ec 08             	sub    $0x8,%esp
+  8030a2:	53                   	push   %ebx
+  8030a3:	68 00 10 00 00       	push   $0x1000
+  8030a8:	89 d9                	mov    %ebx,%ecx
+  8030aa:	e8 93 fa ff ff       	call   802b42 <devpipe_read_bulk>
+  8030af:	83 c4 10             	add    $0x10,%esp
+}
+  8030b2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8030b5:	c9                   	leave
+  8030b6:	c3                   	ret
+    return -E_INVAL;
+  8030b7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8030bc:	eb f4                	jmp    8030b2 <pipe_splice_read+0x66>
+  8030be:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8030c3:	eb ed                	jmp    8030b2 <pipe_splice_read+0x66>
+  8030c5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8030ca:	eb e6                	jmp    8030b2 <pipe_splice_read+0x66>
+  8030cc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8030d1:	eb df                	jmp    8030b2 <pipe_splice_read+0x66>
+
+008030d3 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  8030d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030d8:	c3                   	ret
+
+008030d9 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8030d9:	55                   	push   %ebp
+  8030da:	89 e5                	mov    %esp,%ebp
+  8030dc:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  8030df:	68 a5 3b 80 00       	push   $0x803ba5
+  8030e4:	ff 75 0c             	push   0xc(%ebp)
+  8030e7:	e8 c5 d6 ff ff       	call   8007b1 <strcpy>
+  return 0;
+}
+  8030ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030f1:	c9                   	leave
+  8030f2:	c3                   	ret
+
+008030f3 <devcons_write>:
+{
+  8030f3:	55                   	push   %ebp
+  8030f4:	89 e5                	mov    %esp,%ebp
+  8030f6:	57                   	push   %edi
+  8030f7:	56                   	push   %esi
+  8030f8:	53                   	push   %ebx
+  8030f9:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  8030ff:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  803104:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  80310a:	eb 2e                	jmp    80313a <devcons_write+0x47>
+    m = n - tot;
+  80310c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80310f:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  803111:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803116:	39 c3                	cmp    %eax,%ebx
+  803118:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  80311b:	83 ec 04             	sub    $0x4,%esp
+  80311e:	53                   	push   %ebx
+  80311f:	89 f0                	mov    %esi,%eax
+  803121:	03 45 0c             	add    0xc(%ebp),%eax
+  803124:	50                   	push   %eax
+  803125:	57                   	push   %edi
+  803126:	e8 0c d8 ff ff       	call   800937 <memmove>
+    sys_cputs(buf, m);
+  80312b:	83 c4 08             	add    $0x8,%esp
+  80312e:	53                   	push   %ebx
+  80312f:	57                   	push   %edi
+  803130:	e8 ac d9 ff ff       	call   800ae1 <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  803135:	01 de                	add    %ebx,%esi
+  803137:	83 c4 10             	add    $0x10,%esp
+  80313a:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80313d:	72 cd                	jb     80310c <devcons_write+0x19>
+}
+  80313f:	89 f0                	mov    %esi,%eax
+  803141:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803144:	5b                   	pop    %ebx
+  803145:	5e                   	pop    %esi
+  803146:	5f                   	pop    %edi
+  803147:	5d                   	pop    %ebp
+  803148:	c3                   	ret
+
+00803149 <devcons_read>:
+{
+  803149:	55                   	push   %ebp
+  80314a:	89 e5                	mov    %esp,%ebp
+  80314c:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  80314f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803154:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803158:	75 07                	jne    803161 <devcons_read+0x18>
+  80315a:	eb 1f                	jmp    80317b <devcons_read+0x32>
+    sys_yield();
+  80315c:	e8 1d da ff ff       	call   800b7e <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  803161:	e8 99 d9 ff ff       	call   800aff <sys_cgetc>
+  803166:	85 c0                	test   %eax,%eax
+  803168:	74 f2                	je     80315c <devcons_read+0x13>
+  if (c < 0)
+  80316a:	78 0f                	js     80317b <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  80316c:	83 f8 04             	cmp    $0x4,%eax
+  80316f:	74 0c                	je     80317d <devcons_read+0x34>
+  *(char*)vbuf = c;
+  803171:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803174:	88 02                	mov    %al,(%edx)
+  return 1;
+  803176:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80317b:	c9                   	leave
+  80317c:	c3                   	ret
+    return 0;
+  80317d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803182:	eb f7                	jmp    80317b <devcons_read+0x32>
+
+00803184 <cputchar>:
+{
+  803184:	55                   	push   %ebp
+  803185:	89 e5                	mov    %esp,%ebp
+  803187:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  80318a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80318d:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  803190:	6a 01                	push   $0x1
+  803192:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803195:	50                   	push   %eax
+  803196:	e8 46 d9 ff ff       	call   800ae1 <sys_cputs>
+}
+  80319b:	83 c4 10             	add    $0x10,%esp
+  80319e:	c9                   	leave
+  80319f:	c3                   	ret
+
+008031a0 <getchar>:
+{
+  8031a0:	55                   	push   %ebp
+  8031a1:	89 e5                	mov    %esp,%ebp
+  8031a3:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  8031a6:	6a 01                	push   $0x1
+  8031a8:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8031ab:	50                   	push   %eax
+  8031ac:	6a 00                	push   $0x0
+  8031ae:	e8 01 e2 ff ff       	call   8013b4 <read>
+  if (r < 0)
+  8031b3:	83 c4 10             	add    $0x10,%esp
+  8031b6:	85 c0                	test   %eax,%eax
+  8031b8:	78 06                	js     8031c0 <getchar+0x20>
+  if (r < 1)
+  8031ba:	74 06                	je     8031c2 <getchar+0x22>
+  return c;
+  8031bc:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8031c0:	c9                   	leave
+  8031c1:	c3                   	ret
+    return -E_EOF;
+  8031c2:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8031c7:	eb f7                	jmp    8031c0 <getchar+0x20>
+
+008031c9 <iscons>:
+{
+  8031c9:	55                   	push   %ebp
+  8031ca:	89 e5                	mov    %esp,%ebp
+  8031cc:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8031cf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8031d2:	50                   	push   %eax
+  8031d3:	ff 75 08             	push   0x8(%ebp)
+  8031d6:	e8 2e df ff ff       	call   801109 <fd_lookup>
+  8031db:	83 c4 10             	add    $0x10,%esp
+  8031de:	85 c0                	test   %eax,%eax
+  8031e0:	78 11                	js     8031f3 <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  8031e2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8031e5:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  8031eb:	39 10                	cmp    %edx,(%eax)
+  8031ed:	0f 94 c0             	sete   %al
+  8031f0:	0f b6 c0             	movzbl %al,%eax
+}
+  8031f3:	c9                   	leave
+  8031f4:	c3                   	ret
+
+008031f5 <opencons>:
+{
+  8031f5:	55                   	push   %ebp
+  8031f6:	89 e5                	mov    %esp,%ebp
+  8031f8:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  8031fb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8031fe:	50                   	push   %eax
+  8031ff:	e8 af de ff ff       	call   8010b3 <fd_alloc>
+  803204:	83 c4 10             	add    $0x10,%esp
+  803207:	85 c0                	test   %eax,%eax
+  803209:	78 3a                	js     803245 <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80320b:	83 ec 04             	sub    $0x4,%esp
+  80320e:	68 07 04 00 00       	push   $0x407
+  803213:	ff 75 f4             	push   -0xc(%ebp)
+  803216:	6a 00                	push   $0x0
+  803218:	e8 c3 d9 ff ff       	call   800be0 <sys_page_alloc>
+  80321d:	83 c4 10             	add    $0x10,%esp
+  803220:	85 c0                	test   %eax,%eax
+  803222:	78 21                	js     803245 <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  803224:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803227:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  80322d:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  80322f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803232:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  803239:	83 ec 0c             	sub    $0xc,%esp
+  80323c:	50                   	push   %eax
+  80323d:	e8 4d de ff ff       	call   80108f <fd2num>
+  803242:	83 c4 10             	add    $0x10,%esp
+}
+  803245:	c9                   	leave
+  803246:	c3                   	ret
+
+00803247 <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  803247:	55                   	push   %ebp
+  803248:	89 e5                	mov    %esp,%ebp
+  80324a:	57                   	push   %edi
+  80324b:	56                   	push   %esi
+  80324c:	53                   	push   %ebx
+  80324d:	83 ec 14             	sub    $0x14,%esp
+  803250:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803253:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803256:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803259:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  80325c:	85 c0                	test   %eax,%eax
+  80325e:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803263:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  803266:	ff 33                	push   (%ebx)
+  803268:	50                   	push   %eax
+  803269:	e8 4a dc ff ff       	call   800eb8 <sys_ipc_recv>
+  80326e:	83 c4 10             	add    $0x10,%esp
+  803271:	85 c0                	test   %eax,%eax
+  803273:	78 39                	js     8032ae <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  803275:	85 ff                	test   %edi,%edi
+  803277:	74 0a                	je     803283 <ipc_recv_pages+0x3c>
+  803279:	a1 64 5e 80 00       	mov    0x805e64,%eax
+  80327e:	8b 40 7c             	mov    0x7c(%eax),%eax
+  803281:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803283:	85 f6                	test   %esi,%esi
+  803285:	74 0d                	je     803294 <ipc_recv_pages+0x4d>
+  803287:	a1 64 5e 80 00       	mov    0x805e64,%eax
+  80328c:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  803292:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  803294:	a1 64 5e 80 00       	mov    0x805e64,%eax
+  803299:	8b 40 74             	mov    0x74(%eax),%eax
+  80329c:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  80329e:	a1 64 5e 80 00       	mov    0x805e64,%eax
+  8032a3:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  8032a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8032a9:	5b                   	pop    %ebx
+  8032aa:	5e                   	pop    %esi
+  8032ab:	5f                   	pop    %edi
+  8032ac:	5d                   	pop    %ebp
+  8032ad:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  8032ae:	85 ff                	test   %edi,%edi
+  8032b0:	74 06                	je     8032b8 <ipc_recv_pages+0x71>
+  8032b2:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  8032b8:	85 f6                	test   %esi,%esi
+  8032ba:	74 06                	je     8032c2 <ipc_recv_pages+0x7b>
+  8032bc:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  8032c2:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  8032c8:	eb dc                	jmp    8032a6 <ipc_recv_pages+0x5f>
+
+008032ca <ipc_recv>:
+{
+  8032ca:	55                   	push   %ebp
+  8032cb:	89 e5                	mov    %esp,%ebp
+  8032cd:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  8032d0:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  8032d7:	ff 75 10             	push   0x10(%ebp)
+  8032da:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8032dd:	50                   	push   %eax
+  8032de:	ff 75 0c             	push   0xc(%ebp)
+  8032e1:	ff 75 08             	push   0x8(%ebp)
+  8032e4:	e8 5e ff ff ff       	call   803247 <ipc_recv_pages>
+}
+  8032e9:	c9                   	leave
+  8032ea:	c3                   	ret
+
+008032eb <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  8032eb:	55                   	push   %ebp
+  8032ec:	89 e5                	mov    %esp,%ebp
+  8032ee:	57                   	push   %edi
+  8032ef:	56                   	push   %esi
+  8032f0:	53                   	push   %ebx
+  8032f1:	83 ec 0c             	sub    $0xc,%esp
+  8032f4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8032f7:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8032fa:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  8032fd:	89 c3                	mov    %eax,%ebx
+  8032ff:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  803305:	85 c0                	test   %eax,%eax
+  803307:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80330c:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  80330f:	83 ec 0c             	sub    $0xc,%esp
+  803312:	ff 75 14             	push   0x14(%ebp)
+  803315:	ff 75 18             	push   0x18(%ebp)
+  803318:	53                   	push   %ebx
+  803319:	56                   	push   %esi
+  80331a:	57                   	push   %edi
+  80331b:	e8 77 db ff ff       	call   800e97 <sys_ipc_try_send>
+  803320:	83 c4 20             	add    $0x20,%esp
+  803323:	85 c0                	test   %eax,%eax
+  803325:	79 1e                	jns    803345 <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  803327:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80332a:	75 07                	jne    803333 <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  80332c:	e8 4d d8 ff ff       	call   800b7e <sys_yield>
+  803331:	eb dc                	jmp    80330f <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  803333:	50                   	push   %eax
+  803334:	68 b1 3b 80 00       	push   $0x803bb1
+  803339:	6a 5c                	push   $0x5c
+  80333b:	68 be 3b 80 00       	push   $0x803bbe
+  803340:	e8 a3 cd ff ff       	call   8000e8 <_panic>
+  }
+}
+  803345:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803348:	5b                   	pop    %ebx
+  803349:	5e                   	pop    %esi
+  80334a:	5f                   	pop    %edi
+  80334b:	5d                   	pop    %ebp
+  80334c:	c3                   	ret
+
+0080334d <ipc_send>:
+{
+  80334d:	55                   	push   %ebp
+  80334e:	89 e5                	mov    %esp,%ebp
+  803350:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  803353:	ff 75 14             	push   0x14(%ebp)
+  803356:	6a 01                	push   $0x1
+  803358:	ff 75 10             	push   0x10(%ebp)
+  80335b:	ff 75 0c             	push   0xc(%ebp)
+  80335e:	ff 75 08             	push   0x8(%ebp)
+  803361:	e8 85 ff ff ff       	call   8032eb <ipc_send_pages>
+}
+  803366:	83 c4 20             	add    $0x20,%esp
+  803369:	c9                   	leave
+  80336a:	c3                   	ret
+
+0080336b <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  80336b:	55                   	push   %ebp
+  80336c:	89 e5                	mov    %esp,%ebp
+  80336e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  803371:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  803376:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803379:	c1 e0 04             	shl    $0x4,%eax
+  80337c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803381:	8b 40 50             	mov    0x50(%eax),%eax
+  803384:	39 c8                	cmp    %ecx,%eax
+  803386:	74 12                	je     80339a <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  803388:	83 c2 01             	add    $0x1,%edx
+  80338b:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  803391:	75 e3                	jne    803376 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  803393:	b8 00 00 00 00       	mov    $0x0,%eax
+  803398:	eb 0e                	jmp    8033a8 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  80339a:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80339d:	c1 e0 04             	shl    $0x4,%eax
+  8033a0:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8033a5:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8033a8:	5d                   	pop    %ebp
+  8033a9:	c3                   	ret
+
+008033aa <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8033aa:	55                   	push   %ebp
+  8033ab:	89 e5                	mov    %esp,%ebp
+  8033ad:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  8033b0:	89 c2                	mov    %eax,%edx
+  8033b2:	c1 ea 16             	shr    $0x16,%edx
+  8033b5:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  8033bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  8033c1:	f6 c1 01             	test   $0x1,%cl
+  8033c4:	74 1c                	je     8033e2 <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  8033c6:	c1 e8 0c             	shr    $0xc,%eax
+  8033c9:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  8033d0:	a8 01                	test   $0x1,%al
+  8033d2:	74 0e                	je     8033e2 <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  8033d4:	c1 e8 0c             	shr    $0xc,%eax
+  8033d7:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  8033de:	ef 
+  8033df:	0f b7 d2             	movzwl %dx,%edx
+}
+  8033e2:	89 d0                	mov    %edx,%eax
+  8033e4:	5d                   	pop    %ebp
+  8033e5:	c3                   	ret
+
+008033e6 <udivmod>:
+  8033e6:	55                   	push   %ebp
+  8033e7:	57                   	push   %edi
+  8033e8:	56                   	push   %esi
+  8033e9:	53                   	push   %ebx
+  8033ea:	83 ec 14             	sub    $0x14,%esp
+  8033ed:	8b 74 24 28          	mov    0x28(%esp),%esi
+  8033f1:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  8033f5:	89 fb                	mov    %edi,%ebx
+  8033f7:	09 f3                	or     %esi,%ebx
+  8033f9:	0f 84 88 00 00 00    	je     803487 <udivmod+0xa1>
+  8033ff:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803404:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  80340b:	00 
+  80340c:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  803413:	00 
+  803414:	89 cd                	mov    %ecx,%ebp
+  803416:	89 34 24             	mov    %esi,(%esp)
+  803419:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  80341d:	eb 08                	jmp    803427 <udivmod+0x41>
+  80341f:	83 ed 01             	sub    $0x1,%ebp
+  803422:	83 fd ff             	cmp    $0xffffffff,%ebp
+  803425:	74 6c                	je     803493 <udivmod+0xad>
+  803427:	89 c3                	mov    %eax,%ebx
+  803429:	89 d6                	mov    %edx,%esi
+  80342b:	89 e9                	mov    %ebp,%ecx
+  80342d:	0f ad f3             	shrd   %cl,%esi,%ebx
+  803430:	d3 ee                	shr    %cl,%esi
+  803432:	f6 c1 20             	test   $0x20,%cl
+  803435:	74 04                	je     80343b <udivmod+0x55>
+  803437:	89 f3                	mov    %esi,%ebx
+  803439:	31 f6                	xor    %esi,%esi
+  80343b:	8b 3c 24             	mov    (%esp),%edi
+  80343e:	39 fb                	cmp    %edi,%ebx
+  803440:	89 f7                	mov    %esi,%edi
+  803442:	8b 1c 24             	mov    (%esp),%ebx
+  803445:	8b 74 24 04          	mov    0x4(%esp),%esi
+  803449:	19 f7                	sbb    %esi,%edi
+  80344b:	72 d2                	jb     80341f <udivmod+0x39>
+  80344d:	89 f7                	mov    %esi,%edi
+  80344f:	89 de                	mov    %ebx,%esi
+  803451:	89 e9                	mov    %ebp,%ecx
+  803453:	0f a5 f7             	shld   %cl,%esi,%edi
+  803456:	d3 e6                	shl    %cl,%esi
+  803458:	f6 c1 20             	test   $0x20,%cl
+  80345b:	74 04                	je     803461 <udivmod+0x7b>
+  80345d:	89 f7                	mov    %esi,%edi
+  80345f:	31 f6                	xor    %esi,%esi
+  803461:	29 f0                	sub    %esi,%eax
+  803463:	19 fa                	sbb    %edi,%edx
+  803465:	be 01 00 00 00       	mov    $0x1,%esi
+  80346a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80346f:	0f a5 f7             	shld   %cl,%esi,%edi
+  803472:	d3 e6                	shl    %cl,%esi
+  803474:	f6 c1 20             	test   $0x20,%cl
+  803477:	74 04                	je     80347d <udivmod+0x97>
+  803479:	89 f7                	mov    %esi,%edi
+  80347b:	31 f6                	xor    %esi,%esi
+  80347d:	09 74 24 08          	or     %esi,0x8(%esp)
+  803481:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  803485:	eb 98                	jmp    80341f <udivmod+0x39>
+  803487:	89 f0                	mov    %esi,%eax
+  803489:	89 fa                	mov    %edi,%edx
+  80348b:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80348f:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  803493:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  803497:	89 01                	mov    %eax,(%ecx)
+  803499:	89 51 04             	mov    %edx,0x4(%ecx)
+  80349c:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8034a0:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8034a4:	83 c4 14             	add    $0x14,%esp
+  8034a7:	5b                   	pop    %ebx
+  8034a8:	5e                   	pop    %esi
+  8034a9:	5f                   	pop    %edi
+  8034aa:	5d                   	pop    %ebp
+  8034ab:	c3                   	ret
+
+008034ac <__udivdi3>:
+  8034ac:	83 ec 18             	sub    $0x18,%esp
+  8034af:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8034b3:	50                   	push   %eax
+  8034b4:	ff 74 24 2c          	push   0x2c(%esp)
+  8034b8:	ff 74 24 2c          	push   0x2c(%esp)
+  8034bc:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8034c0:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8034c4:	e8 1d ff ff ff       	call   8033e6 <udivmod>
+  8034c9:	83 c4 24             	add    $0x24,%esp
+  8034cc:	c3                   	ret
+
+008034cd <__umoddi3>:
+  8034cd:	83 ec 18             	sub    $0x18,%esp
+  8034d0:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8034d4:	50                   	push   %eax
+  8034d5:	ff 74 24 2c          	push   0x2c(%esp)
+  8034d9:	ff 74 24 2c          	push   0x2c(%esp)
+  8034dd:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8034e1:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8034e5:	e8 fc fe ff ff       	call   8033e6 <udivmod>
+  8034ea:	8b 44 24 18          	mov    0x18(%esp),%eax
+  8034ee:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8034f2:	83 c4 24             	add    $0x24,%esp
+  8034f5:	c3                   	ret
+
+008034f6 <__divdi3>:
+  8034f6:	56                   	push   %esi
+  8034f7:	53                   	push   %ebx
+  8034f8:	83 ec 14             	sub    $0x14,%esp
+  8034fb:	8b 44 24 20          	mov    0x20(%esp),%eax
+  8034ff:	8b 54 24 24          	mov    0x24(%esp),%edx
+  803503:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  803507:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  80350b:	85 d2                	test   %edx,%edx
+  80350d:	78 18                	js     803527 <__divdi3+0x31>
+  80350f:	85 db                	test   %ebx,%ebx
+  803511:	78 3e                	js     803551 <__divdi3+0x5b>
+  803513:	83 ec 04             	sub    $0x4,%esp
+  803516:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80351a:	56                   	push   %esi
+  80351b:	53                   	push   %ebx
+  80351c:	51                   	push   %ecx
+  80351d:	e8 c4 fe ff ff       	call   8033e6 <udivmod>
+  803522:	83 c4 10             	add    $0x10,%esp
+  803525:	eb 24                	jmp    80354b <__divdi3+0x55>
+  803527:	f7 d8                	neg    %eax
+  803529:	83 d2 00             	adc    $0x0,%edx
+  80352c:	f7 da                	neg    %edx
+  80352e:	85 db                	test   %ebx,%ebx
+  803530:	78 3a                	js     80356c <__divdi3+0x76>
+  803532:	83 ec 04             	sub    $0x4,%esp
+  803535:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803539:	56                   	push   %esi
+  80353a:	53                   	push   %ebx
+  80353b:	51                   	push   %ecx
+  80353c:	e8 a5 fe ff ff       	call   8033e6 <udivmod>
+  803541:	83 c4 10             	add    $0x10,%esp
+  803544:	f7 d8                	neg    %eax
+  803546:	83 d2 00             	adc    $0x0,%edx
+  803549:	f7 da                	neg    %edx
+  80354b:	83 c4 14             	add    $0x14,%esp
+  80354e:	5b                   	pop    %ebx
+  80354f:	5e                   	pop    %esi
+  803550:	c3                   	ret
+  803551:	83 ec 04             	sub    $0x4,%esp
+  803554:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803558:	56                   	push   %esi
+  803559:	f7 d9                	neg    %ecx
+  80355b:	83 d3 00             	adc    $0x0,%ebx
+  80355e:	f7 db                	neg    %ebx
+  803560:	53                   	push   %ebx
+  803561:	51                   	push   %ecx
+  803562:	e8 7f fe ff ff       	call   8033e6 <udivmod>
+  803567:	83 c4 10             	add    $0x10,%esp
+  80356a:	eb d8                	jmp    803544 <__divdi3+0x4e>
+  80356c:	83 ec 04             	sub    $0x4,%esp
+  80356f:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803573:	56                   	push   %esi
+  803574:	f7 d9                	neg    %ecx
+  803576:	83 d3 00             	adc    $0x0,%ebx
+  803579:	f7 db                	neg    %ebx
+  80357b:	53                   	push   %ebx
+  80357c:	51                   	push   %ecx
+  80357d:	e8 64 fe ff ff       	call   8033e6 <udivmod>
+  803582:	83 c4 10             	add    $0x10,%esp
+  803585:	eb c4                	jmp    80354b <__divdi3+0x55>
+
+00803587 <__moddi3>:
+  803587:	55                   	push   %ebp
+  803588:	57                   	push   %edi
+  803589:	56                   	push   %esi
+  80358a:	53                   	push   %ebx
+  80358b:	83 ec 24             	sub    $0x24,%esp
+  80358e:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803592:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803596:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  80359a:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  80359e:	85 d2                	test   %edx,%edx
+  8035a0:	78 3b                	js     8035dd <__moddi3+0x56>
+  8035a2:	83 ec 04             	sub    $0x4,%esp
+  8035a5:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8035a9:	56                   	push   %esi
+  8035aa:	89 ce                	mov    %ecx,%esi
+  8035ac:	f7 de                	neg    %esi
+  8035ae:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8035b2:	89 de                	mov    %ebx,%esi
+  8035b4:	83 d6 00             	adc    $0x0,%esi
+  8035b7:	f7 de                	neg    %esi
+  8035b9:	89 74 24 14          	mov    %esi,0x14(%esp)
+  8035bd:	8b 74 24 08          	mov    0x8(%esp),%esi
+  8035c1:	0f 48 f1             	cmovs  %ecx,%esi
+  8035c4:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  8035c9:	53                   	push   %ebx
+  8035ca:	56                   	push   %esi
+  8035cb:	e8 16 fe ff ff       	call   8033e6 <udivmod>
+  8035d0:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8035d4:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8035d8:	83 c4 10             	add    $0x10,%esp
+  8035db:	eb 47                	jmp    803624 <__moddi3+0x9d>
+  8035dd:	f7 d8                	neg    %eax
+  8035df:	83 d2 00             	adc    $0x0,%edx
+  8035e2:	f7 da                	neg    %edx
+  8035e4:	83 ec 04             	sub    $0x4,%esp
+  8035e7:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8035eb:	56                   	push   %esi
+  8035ec:	89 cf                	mov    %ecx,%edi
+  8035ee:	f7 df                	neg    %edi
+  8035f0:	89 de                	mov    %ebx,%esi
+  8035f2:	83 d6 00             	adc    $0x0,%esi
+  8035f5:	f7 de                	neg    %esi
+  8035f7:	0f 49 cf             	cmovns %edi,%ecx
+  8035fa:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  8035fe:	0f 49 de             	cmovns %esi,%ebx
+  803601:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  803605:	ff 74 24 0c          	push   0xc(%esp)
+  803609:	ff 74 24 0c          	push   0xc(%esp)
+  80360d:	e8 d4 fd ff ff       	call   8033e6 <udivmod>
+  803612:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803616:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80361a:	f7 d8                	neg    %eax
+  80361c:	83 d2 00             	adc    $0x0,%edx
+  80361f:	f7 da                	neg    %edx
+  803621:	83 c4 10             	add    $0x10,%esp
+  803624:	83 c4 24             	add    $0x24,%esp
+  803627:	5b                   	pop    %ebx
+  803628:	5e                   	pop    %esi
+  803629:	5f                   	pop    %edi
+  80362a:	5d                   	pop    %ebp
+  80362b:	c3                   	ret
@@ -0,0 +1,7737 @@
+
+obj/user/spin.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 84 00 00 00       	call   8000b5 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 10             	sub    $0x10,%esp
+  envid_t env;
+
+  cprintf("I am the parent.  Forking the child...\n");
+  80003a:	68 80 39 80 00       	push   $0x803980
+  80003f:	e8 73 01 00 00       	call   8001b7 <cprintf>
+  if ((env = fork()) == 0) {
+  800044:	e8 f8 11 00 00       	call   801241 <fork>
+  800049:	83 c4 10             	add    $0x10,%esp
+  80004c:	85 c0                	test   %eax,%eax
+  80004e:	75 12                	jne    800062 <umain+0x2f>
+    cprintf("I am the child.  Spinning...\n");
+  800050:	83 ec 0c             	sub    $0xc,%esp
+  800053:	68 f8 39 80 00       	push   $0x8039f8
+  800058:	e8 5a 01 00 00       	call   8001b7 <cprintf>
+  80005d:	83 c4 10             	add    $0x10,%esp
+    while (1)
+  800060:	eb fe                	jmp    800060 <umain+0x2d>
+  800062:	89 c3                	mov    %eax,%ebx
+      /* do nothing */;
+  }
+
+  cprintf("I am the parent.  Running the child...\n");
+  800064:	83 ec 0c             	sub    $0xc,%esp
+  800067:	68 a8 39 80 00       	push   $0x8039a8
+  80006c:	e8 46 01 00 00       	call   8001b7 <cprintf>
+  sys_yield();
+  800071:	e8 fc 0a 00 00       	call   800b72 <sys_yield>
+  sys_yield();
+  800076:	e8 f7 0a 00 00       	call   800b72 <sys_yield>
+  sys_yield();
+  80007b:	e8 f2 0a 00 00       	call   800b72 <sys_yield>
+  sys_yield();
+  800080:	e8 ed 0a 00 00       	call   800b72 <sys_yield>
+  sys_yield();
+  800085:	e8 e8 0a 00 00       	call   800b72 <sys_yield>
+  sys_yield();
+  80008a:	e8 e3 0a 00 00       	call   800b72 <sys_yield>
+  sys_yield();
+  80008f:	e8 de 0a 00 00       	call   800b72 <sys_yield>
+  sys_yield();
+  800094:	e8 d9 0a 00 00       	call   800b72 <sys_yield>
+
+  cprintf("I am the parent.  Killing the child...\n");
+  800099:	c7 04 24 d0 39 80 00 	movl   $0x8039d0,(%esp)
+  8000a0:	e8 12 01 00 00       	call   8001b7 <cprintf>
+  sys_env_destroy(env);
+  8000a5:	89 1c 24             	mov    %ebx,(%esp)
+  8000a8:	e8 65 0a 00 00       	call   800b12 <sys_env_destroy>
+}
+  8000ad:	83 c4 10             	add    $0x10,%esp
+  8000b0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8000b3:	c9                   	leave
+  8000b4:	c3                   	ret
+
+008000b5 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000b5:	55                   	push   %ebp
+  8000b6:	89 e5                	mov    %esp,%ebp
+  8000b8:	56                   	push   %esi
+  8000b9:	53                   	push   %ebx
+  8000ba:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000bd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  8000c0:	c7 05 a0 58 80 00 00 	movl   $0x0,0x8058a0
+  8000c7:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  8000ca:	e8 84 0a 00 00       	call   800b53 <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  8000cf:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000d4:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8000d7:	c1 e0 04             	shl    $0x4,%eax
+  8000da:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8000df:	a3 a0 58 80 00       	mov    %eax,0x8058a0
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8000e4:	85 db                	test   %ebx,%ebx
+  8000e6:	7e 07                	jle    8000ef <libmain+0x3a>
+    binaryname = argv[0];
+  8000e8:	8b 06                	mov    (%esi),%eax
+  8000ea:	a3 00 40 80 00       	mov    %eax,0x804000
+
+  // call user main routine
+  umain(argc, argv);
+  8000ef:	83 ec 08             	sub    $0x8,%esp
+  8000f2:	56                   	push   %esi
+  8000f3:	53                   	push   %ebx
+  8000f4:	e8 3a ff ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  8000f9:	e8 0a 00 00 00       	call   800108 <exit>
+}
+  8000fe:	83 c4 10             	add    $0x10,%esp
+  800101:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800104:	5b                   	pop    %ebx
+  800105:	5e                   	pop    %esi
+  800106:	5d                   	pop    %ebp
+  800107:	c3                   	ret
+
+00800108 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800108:	55                   	push   %ebp
+  800109:	89 e5                	mov    %esp,%ebp
+  80010b:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  80010e:	e8 6e 15 00 00       	call   801681 <close_all>
+  sys_env_destroy(0);
+  800113:	83 ec 0c             	sub    $0xc,%esp
+  800116:	6a 00                	push   $0x0
+  800118:	e8 f5 09 00 00       	call   800b12 <sys_env_destroy>
+}
+  80011d:	83 c4 10             	add    $0x10,%esp
+  800120:	c9                   	leave
+  800121:	c3                   	ret
+
+00800122 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800122:	55                   	push   %ebp
+  800123:	89 e5                	mov    %esp,%ebp
+  800125:	53                   	push   %ebx
+  800126:	83 ec 04             	sub    $0x4,%esp
+  800129:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  80012c:	8b 13                	mov    (%ebx),%edx
+  80012e:	8d 42 01             	lea    0x1(%edx),%eax
+  800131:	89 03                	mov    %eax,(%ebx)
+  800133:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800136:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  80013a:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80013f:	74 09                	je     80014a <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  800141:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800145:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800148:	c9                   	leave
+  800149:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  80014a:	83 ec 08             	sub    $0x8,%esp
+  80014d:	68 ff 00 00 00       	push   $0xff
+  800152:	8d 43 08             	lea    0x8(%ebx),%eax
+  800155:	50                   	push   %eax
+  800156:	e8 7a 09 00 00       	call   800ad5 <sys_cputs>
+    b->idx = 0;
+  80015b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800161:	83 c4 10             	add    $0x10,%esp
+  800164:	eb db                	jmp    800141 <putch+0x1f>
+
+00800166 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800166:	55                   	push   %ebp
+  800167:	89 e5                	mov    %esp,%ebp
+  800169:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  80016f:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800176:	00 00 00 
+  b.cnt = 0;
+  800179:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800180:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  800183:	ff 75 0c             	push   0xc(%ebp)
+  800186:	ff 75 08             	push   0x8(%ebp)
+  800189:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80018f:	50                   	push   %eax
+  800190:	68 22 01 80 00       	push   $0x800122
+  800195:	e8 14 01 00 00       	call   8002ae <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  80019a:	83 c4 08             	add    $0x8,%esp
+  80019d:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8001a3:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8001a9:	50                   	push   %eax
+  8001aa:	e8 26 09 00 00       	call   800ad5 <sys_cputs>
+
+  return b.cnt;
+}
+  8001af:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8001b5:	c9                   	leave
+  8001b6:	c3                   	ret
+
+008001b7 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8001b7:	55                   	push   %ebp
+  8001b8:	89 e5                	mov    %esp,%ebp
+  8001ba:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  8001bd:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  8001c0:	50                   	push   %eax
+  8001c1:	ff 75 08             	push   0x8(%ebp)
+  8001c4:	e8 9d ff ff ff       	call   800166 <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  8001c9:	c9                   	leave
+  8001ca:	c3                   	ret
+
+008001cb <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  8001cb:	55                   	push   %ebp
+  8001cc:	89 e5                	mov    %esp,%ebp
+  8001ce:	57                   	push   %edi
+  8001cf:	56                   	push   %esi
+  8001d0:	53                   	push   %ebx
+  8001d1:	83 ec 1c             	sub    $0x1c,%esp
+  8001d4:	89 c7                	mov    %eax,%edi
+  8001d6:	89 d6                	mov    %edx,%esi
+  8001d8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001db:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8001de:	89 d1                	mov    %edx,%ecx
+  8001e0:	89 c2                	mov    %eax,%edx
+  8001e2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001e5:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8001e8:	8b 45 10             	mov    0x10(%ebp),%eax
+  8001eb:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  8001ee:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001f1:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8001f8:	39 c2                	cmp    %eax,%edx
+  8001fa:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8001fd:	72 3e                	jb     80023d <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  8001ff:	83 ec 0c             	sub    $0xc,%esp
+  800202:	ff 75 18             	push   0x18(%ebp)
+  800205:	83 eb 01             	sub    $0x1,%ebx
+  800208:	53                   	push   %ebx
+  800209:	50                   	push   %eax
+  80020a:	83 ec 08             	sub    $0x8,%esp
+  80020d:	ff 75 e4             	push   -0x1c(%ebp)
+  800210:	ff 75 e0             	push   -0x20(%ebp)
+  800213:	ff 75 dc             	push   -0x24(%ebp)
+  800216:	ff 75 d8             	push   -0x28(%ebp)
+  800219:	e8 d6 35 00 00       	call   8037f4 <__udivdi3>
+  80021e:	83 c4 18             	add    $0x18,%esp
+  800221:	52                   	push   %edx
+  800222:	50                   	push   %eax
+  800223:	89 f2                	mov    %esi,%edx
+  800225:	89 f8                	mov    %edi,%eax
+  800227:	e8 9f ff ff ff       	call   8001cb <printnum>
+  80022c:	83 c4 20             	add    $0x20,%esp
+  80022f:	eb 13                	jmp    800244 <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  800231:	83 ec 08             	sub    $0x8,%esp
+  800234:	56                   	push   %esi
+  800235:	ff 75 18             	push   0x18(%ebp)
+  800238:	ff d7                	call   *%edi
+  80023a:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  80023d:	83 eb 01             	sub    $0x1,%ebx
+  800240:	85 db                	test   %ebx,%ebx
+  800242:	7f ed                	jg     800231 <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  800244:	83 ec 08             	sub    $0x8,%esp
+  800247:	56                   	push   %esi
+  800248:	83 ec 04             	sub    $0x4,%esp
+  80024b:	ff 75 e4             	push   -0x1c(%ebp)
+  80024e:	ff 75 e0             	push   -0x20(%ebp)
+  800251:	ff 75 dc             	push   -0x24(%ebp)
+  800254:	ff 75 d8             	push   -0x28(%ebp)
+  800257:	e8 b9 35 00 00       	call   803815 <__umoddi3>
+  80025c:	83 c4 14             	add    $0x14,%esp
+  80025f:	0f be 80 20 3a 80 00 	movsbl 0x803a20(%eax),%eax
+  800266:	50                   	push   %eax
+  800267:	ff d7                	call   *%edi
+}
+  800269:	83 c4 10             	add    $0x10,%esp
+  80026c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80026f:	5b                   	pop    %ebx
+  800270:	5e                   	pop    %esi
+  800271:	5f                   	pop    %edi
+  800272:	5d                   	pop    %ebp
+  800273:	c3                   	ret
+
+00800274 <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800274:	55                   	push   %ebp
+  800275:	89 e5                	mov    %esp,%ebp
+  800277:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  80027a:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  80027e:	8b 10                	mov    (%eax),%edx
+  800280:	3b 50 04             	cmp    0x4(%eax),%edx
+  800283:	73 0a                	jae    80028f <sprintputch+0x1b>
+    *b->buf++ = ch;
+  800285:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800288:	89 08                	mov    %ecx,(%eax)
+  80028a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80028d:	88 02                	mov    %al,(%edx)
+}
+  80028f:	5d                   	pop    %ebp
+  800290:	c3                   	ret
+
+00800291 <printfmt>:
+{
+  800291:	55                   	push   %ebp
+  800292:	89 e5                	mov    %esp,%ebp
+  800294:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  800297:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  80029a:	50                   	push   %eax
+  80029b:	ff 75 10             	push   0x10(%ebp)
+  80029e:	ff 75 0c             	push   0xc(%ebp)
+  8002a1:	ff 75 08             	push   0x8(%ebp)
+  8002a4:	e8 05 00 00 00       	call   8002ae <vprintfmt>
+}
+  8002a9:	83 c4 10             	add    $0x10,%esp
+  8002ac:	c9                   	leave
+  8002ad:	c3                   	ret
+
+008002ae <vprintfmt>:
+{
+  8002ae:	55                   	push   %ebp
+  8002af:	89 e5                	mov    %esp,%ebp
+  8002b1:	57                   	push   %edi
+  8002b2:	56                   	push   %esi
+  8002b3:	53                   	push   %ebx
+  8002b4:	83 ec 2c             	sub    $0x2c,%esp
+  8002b7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8002ba:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8002bd:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8002c0:	eb 0a                	jmp    8002cc <vprintfmt+0x1e>
+      putch(ch, putdat);
+  8002c2:	83 ec 08             	sub    $0x8,%esp
+  8002c5:	53                   	push   %ebx
+  8002c6:	50                   	push   %eax
+  8002c7:	ff d6                	call   *%esi
+  8002c9:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  8002cc:	83 c7 01             	add    $0x1,%edi
+  8002cf:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8002d3:	83 f8 25             	cmp    $0x25,%eax
+  8002d6:	74 0c                	je     8002e4 <vprintfmt+0x36>
+      if (ch == '\0')
+  8002d8:	85 c0                	test   %eax,%eax
+  8002da:	75 e6                	jne    8002c2 <vprintfmt+0x14>
+}
+  8002dc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002df:	5b                   	pop    %ebx
+  8002e0:	5e                   	pop    %esi
+  8002e1:	5f                   	pop    %edi
+  8002e2:	5d                   	pop    %ebp
+  8002e3:	c3                   	ret
+    padc = ' ';
+  8002e4:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  8002e8:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  8002ef:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  8002f6:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  8002fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  800302:	8d 47 01             	lea    0x1(%edi),%eax
+  800305:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800308:	0f b6 17             	movzbl (%edi),%edx
+  80030b:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80030e:	3c 55                	cmp    $0x55,%al
+  800310:	0f 87 cf 03 00 00    	ja     8006e5 <vprintfmt+0x437>
+  800316:	0f b6 c0             	movzbl %al,%eax
+  800319:	ff 24 85 60 3b 80 00 	jmp    *0x803b60(,%eax,4)
+  800320:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  800323:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800327:	eb d9                	jmp    800302 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  800329:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80032c:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800330:	eb d0                	jmp    800302 <vprintfmt+0x54>
+  800332:	0f b6 d2             	movzbl %dl,%edx
+  800335:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  800338:	b8 00 00 00 00       	mov    $0x0,%eax
+  80033d:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  800340:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800343:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  800347:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  80034a:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80034d:	83 f9 09             	cmp    $0x9,%ecx
+  800350:	77 55                	ja     8003a7 <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  800352:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  800355:	eb e9                	jmp    800340 <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  800357:	8b 45 14             	mov    0x14(%ebp),%eax
+  80035a:	8b 00                	mov    (%eax),%eax
+  80035c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80035f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800362:	8d 40 04             	lea    0x4(%eax),%eax
+  800365:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  800368:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  80036b:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80036f:	79 91                	jns    800302 <vprintfmt+0x54>
+        width = precision, precision = -1;
+  800371:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800374:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800377:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80037e:	eb 82                	jmp    800302 <vprintfmt+0x54>
+      if (width < 0)
+  800380:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800383:	85 d2                	test   %edx,%edx
+  800385:	b8 00 00 00 00       	mov    $0x0,%eax
+  80038a:	0f 49 c2             	cmovns %edx,%eax
+  80038d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  800390:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  800393:	e9 6a ff ff ff       	jmp    800302 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  800398:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  80039b:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  8003a2:	e9 5b ff ff ff       	jmp    800302 <vprintfmt+0x54>
+  8003a7:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8003aa:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003ad:	eb bc                	jmp    80036b <vprintfmt+0xbd>
+      lflag++;
+  8003af:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  8003b2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  8003b5:	e9 48 ff ff ff       	jmp    800302 <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  8003ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003bd:	8d 78 04             	lea    0x4(%eax),%edi
+  8003c0:	83 ec 08             	sub    $0x8,%esp
+  8003c3:	53                   	push   %ebx
+  8003c4:	ff 30                	push   (%eax)
+  8003c6:	ff d6                	call   *%esi
+      break;
+  8003c8:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  8003cb:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  8003ce:	e9 b1 02 00 00       	jmp    800684 <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  8003d3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003d6:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  8003d9:	8b 10                	mov    (%eax),%edx
+  8003db:	89 d0                	mov    %edx,%eax
+  8003dd:	f7 d8                	neg    %eax
+  8003df:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8003e2:	83 f8 10             	cmp    $0x10,%eax
+  8003e5:	7f 23                	jg     80040a <vprintfmt+0x15c>
+  8003e7:	8b 14 85 c0 3c 80 00 	mov    0x803cc0(,%eax,4),%edx
+  8003ee:	85 d2                	test   %edx,%edx
+  8003f0:	74 18                	je     80040a <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  8003f2:	52                   	push   %edx
+  8003f3:	68 d6 3e 80 00       	push   $0x803ed6
+  8003f8:	53                   	push   %ebx
+  8003f9:	56                   	push   %esi
+  8003fa:	e8 92 fe ff ff       	call   800291 <printfmt>
+  8003ff:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  800402:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800405:	e9 7a 02 00 00       	jmp    800684 <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  80040a:	50                   	push   %eax
+  80040b:	68 38 3a 80 00       	push   $0x803a38
+  800410:	53                   	push   %ebx
+  800411:	56                   	push   %esi
+  800412:	e8 7a fe ff ff       	call   800291 <printfmt>
+  800417:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  80041a:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  80041d:	e9 62 02 00 00       	jmp    800684 <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  800422:	8b 45 14             	mov    0x14(%ebp),%eax
+  800425:	83 c0 04             	add    $0x4,%eax
+  800428:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80042b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80042e:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  800430:	85 c9                	test   %ecx,%ecx
+  800432:	b8 31 3a 80 00       	mov    $0x803a31,%eax
+  800437:	0f 45 c1             	cmovne %ecx,%eax
+  80043a:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  80043d:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800441:	7e 06                	jle    800449 <vprintfmt+0x19b>
+  800443:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800447:	75 0b                	jne    800454 <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800449:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80044c:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80044f:	89 75 08             	mov    %esi,0x8(%ebp)
+  800452:	eb 5c                	jmp    8004b0 <vprintfmt+0x202>
+  800454:	83 ec 08             	sub    $0x8,%esp
+  800457:	ff 75 d0             	push   -0x30(%ebp)
+  80045a:	ff 75 cc             	push   -0x34(%ebp)
+  80045d:	e8 20 03 00 00       	call   800782 <strnlen>
+  800462:	89 c2                	mov    %eax,%edx
+  800464:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800467:	29 d0                	sub    %edx,%eax
+  800469:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  80046c:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800470:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800473:	89 75 08             	mov    %esi,0x8(%ebp)
+  800476:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800478:	eb 0e                	jmp    800488 <vprintfmt+0x1da>
+          putch(padc, putdat);
+  80047a:	83 ec 08             	sub    $0x8,%esp
+  80047d:	53                   	push   %ebx
+  80047e:	57                   	push   %edi
+  80047f:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800482:	83 ee 01             	sub    $0x1,%esi
+  800485:	83 c4 10             	add    $0x10,%esp
+  800488:	85 f6                	test   %esi,%esi
+  80048a:	7f ee                	jg     80047a <vprintfmt+0x1cc>
+  80048c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80048f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800492:	85 c0                	test   %eax,%eax
+  800494:	ba 00 00 00 00       	mov    $0x0,%edx
+  800499:	0f 49 d0             	cmovns %eax,%edx
+  80049c:	29 d0                	sub    %edx,%eax
+  80049e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004a1:	eb a6                	jmp    800449 <vprintfmt+0x19b>
+          putch(ch, putdat);
+  8004a3:	83 ec 08             	sub    $0x8,%esp
+  8004a6:	53                   	push   %ebx
+  8004a7:	52                   	push   %edx
+  8004a8:	ff 55 08             	call   *0x8(%ebp)
+  8004ab:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  8004ae:	89 f1                	mov    %esi,%ecx
+  8004b0:	8d 71 01             	lea    0x1(%ecx),%esi
+  8004b3:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8004b7:	0f be d0             	movsbl %al,%edx
+  8004ba:	85 d2                	test   %edx,%edx
+  8004bc:	74 28                	je     8004e6 <vprintfmt+0x238>
+  8004be:	85 ff                	test   %edi,%edi
+  8004c0:	78 05                	js     8004c7 <vprintfmt+0x219>
+  8004c2:	83 ef 01             	sub    $0x1,%edi
+  8004c5:	78 30                	js     8004f7 <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  8004c7:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8004cb:	74 d6                	je     8004a3 <vprintfmt+0x1f5>
+  8004cd:	0f be c0             	movsbl %al,%eax
+  8004d0:	83 e8 20             	sub    $0x20,%eax
+  8004d3:	83 f8 5e             	cmp    $0x5e,%eax
+  8004d6:	76 cb                	jbe    8004a3 <vprintfmt+0x1f5>
+          putch('?', putdat);
+  8004d8:	83 ec 08             	sub    $0x8,%esp
+  8004db:	53                   	push   %ebx
+  8004dc:	6a 3f                	push   $0x3f
+  8004de:	ff 55 08             	call   *0x8(%ebp)
+  8004e1:	83 c4 10             	add    $0x10,%esp
+  8004e4:	eb c8                	jmp    8004ae <vprintfmt+0x200>
+  8004e6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004e9:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8004ec:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004ef:	01 d0                	add    %edx,%eax
+  8004f1:	29 c8                	sub    %ecx,%eax
+  8004f3:	89 c7                	mov    %eax,%edi
+  8004f5:	eb 13                	jmp    80050a <vprintfmt+0x25c>
+  8004f7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004fa:	eb ed                	jmp    8004e9 <vprintfmt+0x23b>
+        putch(' ', putdat);
+  8004fc:	83 ec 08             	sub    $0x8,%esp
+  8004ff:	53                   	push   %ebx
+  800500:	6a 20                	push   $0x20
+  800502:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  800504:	83 ef 01             	sub    $0x1,%edi
+  800507:	83 c4 10             	add    $0x10,%esp
+  80050a:	85 ff                	test   %edi,%edi
+  80050c:	7f ee                	jg     8004fc <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  80050e:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800511:	89 45 14             	mov    %eax,0x14(%ebp)
+  800514:	e9 6b 01 00 00       	jmp    800684 <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  800519:	83 f9 01             	cmp    $0x1,%ecx
+  80051c:	7f 1f                	jg     80053d <vprintfmt+0x28f>
+  else if (lflag)
+  80051e:	85 c9                	test   %ecx,%ecx
+  800520:	74 67                	je     800589 <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  800522:	8b 45 14             	mov    0x14(%ebp),%eax
+  800525:	8b 00                	mov    (%eax),%eax
+  800527:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80052a:	89 c1                	mov    %eax,%ecx
+  80052c:	c1 f9 1f             	sar    $0x1f,%ecx
+  80052f:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800532:	8b 45 14             	mov    0x14(%ebp),%eax
+  800535:	8d 40 04             	lea    0x4(%eax),%eax
+  800538:	89 45 14             	mov    %eax,0x14(%ebp)
+  80053b:	eb 17                	jmp    800554 <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  80053d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800540:	8b 50 04             	mov    0x4(%eax),%edx
+  800543:	8b 00                	mov    (%eax),%eax
+  800545:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800548:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  80054b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80054e:	8d 40 08             	lea    0x8(%eax),%eax
+  800551:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  800554:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800557:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  80055a:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  80055f:	85 c9                	test   %ecx,%ecx
+  800561:	0f 89 03 01 00 00    	jns    80066a <vprintfmt+0x3bc>
+        putch('-', putdat);
+  800567:	83 ec 08             	sub    $0x8,%esp
+  80056a:	53                   	push   %ebx
+  80056b:	6a 2d                	push   $0x2d
+  80056d:	ff d6                	call   *%esi
+        num = -(long long)num;
+  80056f:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800572:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800575:	f7 da                	neg    %edx
+  800577:	83 d1 00             	adc    $0x0,%ecx
+  80057a:	f7 d9                	neg    %ecx
+  80057c:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  80057f:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800584:	e9 e1 00 00 00       	jmp    80066a <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  800589:	8b 45 14             	mov    0x14(%ebp),%eax
+  80058c:	8b 00                	mov    (%eax),%eax
+  80058e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800591:	89 c1                	mov    %eax,%ecx
+  800593:	c1 f9 1f             	sar    $0x1f,%ecx
+  800596:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800599:	8b 45 14             	mov    0x14(%ebp),%eax
+  80059c:	8d 40 04             	lea    0x4(%eax),%eax
+  80059f:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005a2:	eb b0                	jmp    800554 <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  8005a4:	83 f9 01             	cmp    $0x1,%ecx
+  8005a7:	7f 1e                	jg     8005c7 <vprintfmt+0x319>
+  else if (lflag)
+  8005a9:	85 c9                	test   %ecx,%ecx
+  8005ab:	74 32                	je     8005df <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  8005ad:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b0:	8b 10                	mov    (%eax),%edx
+  8005b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005b7:	8d 40 04             	lea    0x4(%eax),%eax
+  8005ba:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  8005bd:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  8005c2:	e9 a3 00 00 00       	jmp    80066a <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  8005c7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ca:	8b 10                	mov    (%eax),%edx
+  8005cc:	8b 48 04             	mov    0x4(%eax),%ecx
+  8005cf:	8d 40 08             	lea    0x8(%eax),%eax
+  8005d2:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  8005d5:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  8005da:	e9 8b 00 00 00       	jmp    80066a <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8005df:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005e2:	8b 10                	mov    (%eax),%edx
+  8005e4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8005e9:	8d 40 04             	lea    0x4(%eax),%eax
+  8005ec:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  8005ef:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  8005f4:	eb 74                	jmp    80066a <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  8005f6:	83 f9 01             	cmp    $0x1,%ecx
+  8005f9:	7f 1b                	jg     800616 <vprintfmt+0x368>
+  else if (lflag)
+  8005fb:	85 c9                	test   %ecx,%ecx
+  8005fd:	74 2c                	je     80062b <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  8005ff:	8b 45 14             	mov    0x14(%ebp),%eax
+  800602:	8b 10                	mov    (%eax),%edx
+  800604:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800609:	8d 40 04             	lea    0x4(%eax),%eax
+  80060c:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  80060f:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  800614:	eb 54                	jmp    80066a <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800616:	8b 45 14             	mov    0x14(%ebp),%eax
+  800619:	8b 10                	mov    (%eax),%edx
+  80061b:	8b 48 04             	mov    0x4(%eax),%ecx
+  80061e:	8d 40 08             	lea    0x8(%eax),%eax
+  800621:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800624:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  800629:	eb 3f                	jmp    80066a <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  80062b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80062e:	8b 10                	mov    (%eax),%edx
+  800630:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800635:	8d 40 04             	lea    0x4(%eax),%eax
+  800638:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  80063b:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  800640:	eb 28                	jmp    80066a <vprintfmt+0x3bc>
+      putch('0', putdat);
+  800642:	83 ec 08             	sub    $0x8,%esp
+  800645:	53                   	push   %ebx
+  800646:	6a 30                	push   $0x30
+  800648:	ff d6                	call   *%esi
+      putch('x', putdat);
+  80064a:	83 c4 08             	add    $0x8,%esp
+  80064d:	53                   	push   %ebx
+  80064e:	6a 78                	push   $0x78
+  800650:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  800652:	8b 45 14             	mov    0x14(%ebp),%eax
+  800655:	8b 10                	mov    (%eax),%edx
+  800657:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  80065c:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  80065f:	8d 40 04             	lea    0x4(%eax),%eax
+  800662:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800665:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  80066a:	83 ec 0c             	sub    $0xc,%esp
+  80066d:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800671:	50                   	push   %eax
+  800672:	ff 75 e0             	push   -0x20(%ebp)
+  800675:	57                   	push   %edi
+  800676:	51                   	push   %ecx
+  800677:	52                   	push   %edx
+  800678:	89 da                	mov    %ebx,%edx
+  80067a:	89 f0                	mov    %esi,%eax
+  80067c:	e8 4a fb ff ff       	call   8001cb <printnum>
+      break;
+  800681:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  800684:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  800687:	e9 40 fc ff ff       	jmp    8002cc <vprintfmt+0x1e>
+  if (lflag >= 2)
+  80068c:	83 f9 01             	cmp    $0x1,%ecx
+  80068f:	7f 1b                	jg     8006ac <vprintfmt+0x3fe>
+  else if (lflag)
+  800691:	85 c9                	test   %ecx,%ecx
+  800693:	74 2c                	je     8006c1 <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  800695:	8b 45 14             	mov    0x14(%ebp),%eax
+  800698:	8b 10                	mov    (%eax),%edx
+  80069a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80069f:	8d 40 04             	lea    0x4(%eax),%eax
+  8006a2:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8006a5:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  8006aa:	eb be                	jmp    80066a <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  8006ac:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006af:	8b 10                	mov    (%eax),%edx
+  8006b1:	8b 48 04             	mov    0x4(%eax),%ecx
+  8006b4:	8d 40 08             	lea    0x8(%eax),%eax
+  8006b7:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8006ba:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  8006bf:	eb a9                	jmp    80066a <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8006c1:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c4:	8b 10                	mov    (%eax),%edx
+  8006c6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006cb:	8d 40 04             	lea    0x4(%eax),%eax
+  8006ce:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8006d1:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  8006d6:	eb 92                	jmp    80066a <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  8006d8:	83 ec 08             	sub    $0x8,%esp
+  8006db:	53                   	push   %ebx
+  8006dc:	6a 25                	push   $0x25
+  8006de:	ff d6                	call   *%esi
+      break;
+  8006e0:	83 c4 10             	add    $0x10,%esp
+  8006e3:	eb 9f                	jmp    800684 <vprintfmt+0x3d6>
+      putch('%', putdat);
+  8006e5:	83 ec 08             	sub    $0x8,%esp
+  8006e8:	53                   	push   %ebx
+  8006e9:	6a 25                	push   $0x25
+  8006eb:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  8006ed:	83 c4 10             	add    $0x10,%esp
+  8006f0:	89 f8                	mov    %edi,%eax
+  8006f2:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8006f6:	74 05                	je     8006fd <vprintfmt+0x44f>
+  8006f8:	83 e8 01             	sub    $0x1,%eax
+  8006fb:	eb f5                	jmp    8006f2 <vprintfmt+0x444>
+  8006fd:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800700:	eb 82                	jmp    800684 <vprintfmt+0x3d6>
+
+00800702 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800702:	55                   	push   %ebp
+  800703:	89 e5                	mov    %esp,%ebp
+  800705:	83 ec 18             	sub    $0x18,%esp
+  800708:	8b 45 08             	mov    0x8(%ebp),%eax
+  80070b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  80070e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800711:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800715:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800718:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  80071f:	85 c0                	test   %eax,%eax
+  800721:	74 26                	je     800749 <vsnprintf+0x47>
+  800723:	85 d2                	test   %edx,%edx
+  800725:	7e 22                	jle    800749 <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800727:	ff 75 14             	push   0x14(%ebp)
+  80072a:	ff 75 10             	push   0x10(%ebp)
+  80072d:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800730:	50                   	push   %eax
+  800731:	68 74 02 80 00       	push   $0x800274
+  800736:	e8 73 fb ff ff       	call   8002ae <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  80073b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80073e:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  800741:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800744:	83 c4 10             	add    $0x10,%esp
+}
+  800747:	c9                   	leave
+  800748:	c3                   	ret
+    return -E_INVAL;
+  800749:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80074e:	eb f7                	jmp    800747 <vsnprintf+0x45>
+
+00800750 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800750:	55                   	push   %ebp
+  800751:	89 e5                	mov    %esp,%ebp
+  800753:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  800756:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  800759:	50                   	push   %eax
+  80075a:	ff 75 10             	push   0x10(%ebp)
+  80075d:	ff 75 0c             	push   0xc(%ebp)
+  800760:	ff 75 08             	push   0x8(%ebp)
+  800763:	e8 9a ff ff ff       	call   800702 <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  800768:	c9                   	leave
+  800769:	c3                   	ret
+
+0080076a <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  80076a:	55                   	push   %ebp
+  80076b:	89 e5                	mov    %esp,%ebp
+  80076d:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  800770:	b8 00 00 00 00       	mov    $0x0,%eax
+  800775:	eb 03                	jmp    80077a <strlen+0x10>
+    n++;
+  800777:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  80077a:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  80077e:	75 f7                	jne    800777 <strlen+0xd>
+  return n;
+}
+  800780:	5d                   	pop    %ebp
+  800781:	c3                   	ret
+
+00800782 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800782:	55                   	push   %ebp
+  800783:	89 e5                	mov    %esp,%ebp
+  800785:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800788:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80078b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800790:	eb 03                	jmp    800795 <strnlen+0x13>
+    n++;
+  800792:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800795:	39 d0                	cmp    %edx,%eax
+  800797:	74 08                	je     8007a1 <strnlen+0x1f>
+  800799:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80079d:	75 f3                	jne    800792 <strnlen+0x10>
+  80079f:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  8007a1:	89 d0                	mov    %edx,%eax
+  8007a3:	5d                   	pop    %ebp
+  8007a4:	c3                   	ret
+
+008007a5 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  8007a5:	55                   	push   %ebp
+  8007a6:	89 e5                	mov    %esp,%ebp
+  8007a8:	53                   	push   %ebx
+  8007a9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8007ac:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  8007af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007b4:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  8007b8:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  8007bb:	83 c0 01             	add    $0x1,%eax
+  8007be:	84 d2                	test   %dl,%dl
+  8007c0:	75 f2                	jne    8007b4 <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  8007c2:	89 c8                	mov    %ecx,%eax
+  8007c4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007c7:	c9                   	leave
+  8007c8:	c3                   	ret
+
+008007c9 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  8007c9:	55                   	push   %ebp
+  8007ca:	89 e5                	mov    %esp,%ebp
+  8007cc:	53                   	push   %ebx
+  8007cd:	83 ec 10             	sub    $0x10,%esp
+  8007d0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  8007d3:	53                   	push   %ebx
+  8007d4:	e8 91 ff ff ff       	call   80076a <strlen>
+  8007d9:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  8007dc:	ff 75 0c             	push   0xc(%ebp)
+  8007df:	01 d8                	add    %ebx,%eax
+  8007e1:	50                   	push   %eax
+  8007e2:	e8 be ff ff ff       	call   8007a5 <strcpy>
+  return dst;
+}
+  8007e7:	89 d8                	mov    %ebx,%eax
+  8007e9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8007ec:	c9                   	leave
+  8007ed:	c3                   	ret
+
+008007ee <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  8007ee:	55                   	push   %ebp
+  8007ef:	89 e5                	mov    %esp,%ebp
+  8007f1:	56                   	push   %esi
+  8007f2:	53                   	push   %ebx
+  8007f3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8007f6:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  8007f9:	89 f3                	mov    %esi,%ebx
+  8007fb:	03 5d 10             	add    0x10(%ebp),%ebx
+  8007fe:	89 f0                	mov    %esi,%eax
+  800800:	eb 0f                	jmp    800811 <strncpy+0x23>
+    *dst++ = *src;
+  800802:	83 c0 01             	add    $0x1,%eax
+  800805:	0f b6 0a             	movzbl (%edx),%ecx
+  800808:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  80080b:	80 f9 01             	cmp    $0x1,%cl
+  80080e:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  800811:	39 d8                	cmp    %ebx,%eax
+  800813:	75 ed                	jne    800802 <strncpy+0x14>
+  }
+  return ret;
+}
+  800815:	89 f0                	mov    %esi,%eax
+  800817:	5b                   	pop    %ebx
+  800818:	5e                   	pop    %esi
+  800819:	5d                   	pop    %ebp
+  80081a:	c3                   	ret
+
+0080081b <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  80081b:	55                   	push   %ebp
+  80081c:	89 e5                	mov    %esp,%ebp
+  80081e:	56                   	push   %esi
+  80081f:	53                   	push   %ebx
+  800820:	8b 75 08             	mov    0x8(%ebp),%esi
+  800823:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800826:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  800829:	89 f0                	mov    %esi,%eax
+  80082b:	85 d2                	test   %edx,%edx
+  80082d:	74 21                	je     800850 <strlcpy+0x35>
+  80082f:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800833:	89 f2                	mov    %esi,%edx
+  800835:	eb 09                	jmp    800840 <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  800837:	83 c1 01             	add    $0x1,%ecx
+  80083a:	83 c2 01             	add    $0x1,%edx
+  80083d:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  800840:	39 c2                	cmp    %eax,%edx
+  800842:	74 09                	je     80084d <strlcpy+0x32>
+  800844:	0f b6 19             	movzbl (%ecx),%ebx
+  800847:	84 db                	test   %bl,%bl
+  800849:	75 ec                	jne    800837 <strlcpy+0x1c>
+  80084b:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  80084d:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  800850:	29 f0                	sub    %esi,%eax
+}
+  800852:	5b                   	pop    %ebx
+  800853:	5e                   	pop    %esi
+  800854:	5d                   	pop    %ebp
+  800855:	c3                   	ret
+
+00800856 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800856:	55                   	push   %ebp
+  800857:	89 e5                	mov    %esp,%ebp
+  800859:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  80085c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  80085f:	eb 06                	jmp    800867 <strcmp+0x11>
+    p++, q++;
+  800861:	83 c1 01             	add    $0x1,%ecx
+  800864:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  800867:	0f b6 01             	movzbl (%ecx),%eax
+  80086a:	84 c0                	test   %al,%al
+  80086c:	74 04                	je     800872 <strcmp+0x1c>
+  80086e:	3a 02                	cmp    (%edx),%al
+  800870:	74 ef                	je     800861 <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  800872:	0f b6 c0             	movzbl %al,%eax
+  800875:	0f b6 12             	movzbl (%edx),%edx
+  800878:	29 d0                	sub    %edx,%eax
+}
+  80087a:	5d                   	pop    %ebp
+  80087b:	c3                   	ret
+
+0080087c <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  80087c:	55                   	push   %ebp
+  80087d:	89 e5                	mov    %esp,%ebp
+  80087f:	53                   	push   %ebx
+  800880:	8b 45 08             	mov    0x8(%ebp),%eax
+  800883:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800886:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  800889:	eb 09                	jmp    800894 <strncmp+0x18>
+    n--, p++, q++;
+  80088b:	83 ea 01             	sub    $0x1,%edx
+  80088e:	83 c0 01             	add    $0x1,%eax
+  800891:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  800894:	85 d2                	test   %edx,%edx
+  800896:	74 18                	je     8008b0 <strncmp+0x34>
+  800898:	0f b6 18             	movzbl (%eax),%ebx
+  80089b:	84 db                	test   %bl,%bl
+  80089d:	74 04                	je     8008a3 <strncmp+0x27>
+  80089f:	3a 19                	cmp    (%ecx),%bl
+  8008a1:	74 e8                	je     80088b <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8008a3:	0f b6 00             	movzbl (%eax),%eax
+  8008a6:	0f b6 11             	movzbl (%ecx),%edx
+  8008a9:	29 d0                	sub    %edx,%eax
+}
+  8008ab:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8008ae:	c9                   	leave
+  8008af:	c3                   	ret
+    return 0;
+  8008b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008b5:	eb f4                	jmp    8008ab <strncmp+0x2f>
+
+008008b7 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  8008b7:	55                   	push   %ebp
+  8008b8:	89 e5                	mov    %esp,%ebp
+  8008ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008bd:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  8008c1:	eb 03                	jmp    8008c6 <strchr+0xf>
+  8008c3:	83 c0 01             	add    $0x1,%eax
+  8008c6:	0f b6 10             	movzbl (%eax),%edx
+  8008c9:	84 d2                	test   %dl,%dl
+  8008cb:	74 06                	je     8008d3 <strchr+0x1c>
+    if (*s == c)
+  8008cd:	38 ca                	cmp    %cl,%dl
+  8008cf:	75 f2                	jne    8008c3 <strchr+0xc>
+  8008d1:	eb 05                	jmp    8008d8 <strchr+0x21>
+      return (char*)s;
+  return 0;
+  8008d3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8008d8:	5d                   	pop    %ebp
+  8008d9:	c3                   	ret
+
+008008da <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  8008da:	55                   	push   %ebp
+  8008db:	89 e5                	mov    %esp,%ebp
+  8008dd:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008e0:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  8008e4:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  8008e7:	38 ca                	cmp    %cl,%dl
+  8008e9:	74 09                	je     8008f4 <strfind+0x1a>
+  8008eb:	84 d2                	test   %dl,%dl
+  8008ed:	74 05                	je     8008f4 <strfind+0x1a>
+  for (; *s; s++)
+  8008ef:	83 c0 01             	add    $0x1,%eax
+  8008f2:	eb f0                	jmp    8008e4 <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  8008f4:	5d                   	pop    %ebp
+  8008f5:	c3                   	ret
+
+008008f6 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  8008f6:	55                   	push   %ebp
+  8008f7:	89 e5                	mov    %esp,%ebp
+  8008f9:	57                   	push   %edi
+  8008fa:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8008fd:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  800900:	85 c9                	test   %ecx,%ecx
+  800902:	74 20                	je     800924 <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  800904:	89 f8                	mov    %edi,%eax
+  800906:	09 c8                	or     %ecx,%eax
+  800908:	a8 03                	test   $0x3,%al
+  80090a:	75 12                	jne    80091e <memset+0x28>
+    c &= 0xFF;
+  80090c:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800910:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  800916:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  800919:	fc                   	cld
+  80091a:	f3 ab                	rep stos %eax,%es:(%edi)
+  80091c:	eb 06                	jmp    800924 <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  80091e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800921:	fc                   	cld
+  800922:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  800924:	89 f8                	mov    %edi,%eax
+  800926:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800929:	c9                   	leave
+  80092a:	c3                   	ret
+
+0080092b <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  80092b:	55                   	push   %ebp
+  80092c:	89 e5                	mov    %esp,%ebp
+  80092e:	57                   	push   %edi
+  80092f:	56                   	push   %esi
+  800930:	8b 45 08             	mov    0x8(%ebp),%eax
+  800933:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800936:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  800939:	39 c6                	cmp    %eax,%esi
+  80093b:	73 32                	jae    80096f <memmove+0x44>
+  80093d:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800940:	39 d0                	cmp    %edx,%eax
+  800942:	73 2b                	jae    80096f <memmove+0x44>
+    s += n;
+    d += n;
+  800944:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800947:	89 d6                	mov    %edx,%esi
+  800949:	09 fe                	or     %edi,%esi
+  80094b:	09 ce                	or     %ecx,%esi
+  80094d:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800953:	75 0e                	jne    800963 <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800955:	83 ef 04             	sub    $0x4,%edi
+  800958:	8d 72 fc             	lea    -0x4(%edx),%esi
+  80095b:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  80095e:	fd                   	std
+  80095f:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800961:	eb 09                	jmp    80096c <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800963:	83 ef 01             	sub    $0x1,%edi
+  800966:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  800969:	fd                   	std
+  80096a:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  80096c:	fc                   	cld
+  80096d:	eb 1a                	jmp    800989 <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  80096f:	89 f2                	mov    %esi,%edx
+  800971:	09 c2                	or     %eax,%edx
+  800973:	09 ca                	or     %ecx,%edx
+  800975:	f6 c2 03             	test   $0x3,%dl
+  800978:	75 0a                	jne    800984 <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  80097a:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  80097d:	89 c7                	mov    %eax,%edi
+  80097f:	fc                   	cld
+  800980:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800982:	eb 05                	jmp    800989 <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  800984:	89 c7                	mov    %eax,%edi
+  800986:	fc                   	cld
+  800987:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  800989:	5e                   	pop    %esi
+  80098a:	5f                   	pop    %edi
+  80098b:	5d                   	pop    %ebp
+  80098c:	c3                   	ret
+
+0080098d <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  80098d:	55                   	push   %ebp
+  80098e:	89 e5                	mov    %esp,%ebp
+  800990:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  800993:	ff 75 10             	push   0x10(%ebp)
+  800996:	ff 75 0c             	push   0xc(%ebp)
+  800999:	ff 75 08             	push   0x8(%ebp)
+  80099c:	e8 8a ff ff ff       	call   80092b <memmove>
+}
+  8009a1:	c9                   	leave
+  8009a2:	c3                   	ret
+
+008009a3 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  8009a3:	55                   	push   %ebp
+  8009a4:	89 e5                	mov    %esp,%ebp
+  8009a6:	56                   	push   %esi
+  8009a7:	53                   	push   %ebx
+  8009a8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009ab:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  8009ae:	89 c6                	mov    %eax,%esi
+  8009b0:	03 75 10             	add    0x10(%ebp),%esi
+  8009b3:	eb 06                	jmp    8009bb <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  8009b5:	83 c0 01             	add    $0x1,%eax
+  8009b8:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  8009bb:	39 f0                	cmp    %esi,%eax
+  8009bd:	74 14                	je     8009d3 <memcmp+0x30>
+    if (*s1 != *s2)
+  8009bf:	0f b6 08             	movzbl (%eax),%ecx
+  8009c2:	0f b6 1a             	movzbl (%edx),%ebx
+  8009c5:	38 d9                	cmp    %bl,%cl
+  8009c7:	74 ec                	je     8009b5 <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  8009c9:	0f b6 c1             	movzbl %cl,%eax
+  8009cc:	0f b6 db             	movzbl %bl,%ebx
+  8009cf:	29 d8                	sub    %ebx,%eax
+  8009d1:	eb 05                	jmp    8009d8 <memcmp+0x35>
+  }
+
+  return 0;
+  8009d3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8009d8:	5b                   	pop    %ebx
+  8009d9:	5e                   	pop    %esi
+  8009da:	5d                   	pop    %ebp
+  8009db:	c3                   	ret
+
+008009dc <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  8009dc:	55                   	push   %ebp
+  8009dd:	89 e5                	mov    %esp,%ebp
+  8009df:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009e2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  8009e5:	89 c2                	mov    %eax,%edx
+  8009e7:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  8009ea:	eb 03                	jmp    8009ef <memfind+0x13>
+  8009ec:	83 c0 01             	add    $0x1,%eax
+  8009ef:	39 d0                	cmp    %edx,%eax
+  8009f1:	73 04                	jae    8009f7 <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  8009f3:	38 08                	cmp    %cl,(%eax)
+  8009f5:	75 f5                	jne    8009ec <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  8009f7:	5d                   	pop    %ebp
+  8009f8:	c3                   	ret
+
+008009f9 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  8009f9:	55                   	push   %ebp
+  8009fa:	89 e5                	mov    %esp,%ebp
+  8009fc:	57                   	push   %edi
+  8009fd:	56                   	push   %esi
+  8009fe:	53                   	push   %ebx
+  8009ff:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a02:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  800a05:	eb 03                	jmp    800a0a <strtol+0x11>
+    s++;
+  800a07:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  800a0a:	0f b6 02             	movzbl (%edx),%eax
+  800a0d:	3c 20                	cmp    $0x20,%al
+  800a0f:	74 f6                	je     800a07 <strtol+0xe>
+  800a11:	3c 09                	cmp    $0x9,%al
+  800a13:	74 f2                	je     800a07 <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  800a15:	3c 2b                	cmp    $0x2b,%al
+  800a17:	74 2a                	je     800a43 <strtol+0x4a>
+  int neg = 0;
+  800a19:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  800a1e:	3c 2d                	cmp    $0x2d,%al
+  800a20:	74 2b                	je     800a4d <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a22:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a28:	75 0f                	jne    800a39 <strtol+0x40>
+  800a2a:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a2d:	74 28                	je     800a57 <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  800a2f:	85 db                	test   %ebx,%ebx
+  800a31:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800a36:	0f 44 d8             	cmove  %eax,%ebx
+  800a39:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a3e:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800a41:	eb 46                	jmp    800a89 <strtol+0x90>
+    s++;
+  800a43:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  800a46:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a4b:	eb d5                	jmp    800a22 <strtol+0x29>
+    s++, neg = 1;
+  800a4d:	83 c2 01             	add    $0x1,%edx
+  800a50:	bf 01 00 00 00       	mov    $0x1,%edi
+  800a55:	eb cb                	jmp    800a22 <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a57:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800a5b:	74 0e                	je     800a6b <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  800a5d:	85 db                	test   %ebx,%ebx
+  800a5f:	75 d8                	jne    800a39 <strtol+0x40>
+    s++, base = 8;
+  800a61:	83 c2 01             	add    $0x1,%edx
+  800a64:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800a69:	eb ce                	jmp    800a39 <strtol+0x40>
+    s += 2, base = 16;
+  800a6b:	83 c2 02             	add    $0x2,%edx
+  800a6e:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800a73:	eb c4                	jmp    800a39 <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  800a75:	0f be c0             	movsbl %al,%eax
+  800a78:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  800a7b:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800a7e:	7d 3a                	jge    800aba <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  800a80:	83 c2 01             	add    $0x1,%edx
+  800a83:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800a87:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  800a89:	0f b6 02             	movzbl (%edx),%eax
+  800a8c:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800a8f:	89 f3                	mov    %esi,%ebx
+  800a91:	80 fb 09             	cmp    $0x9,%bl
+  800a94:	76 df                	jbe    800a75 <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  800a96:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800a99:	89 f3                	mov    %esi,%ebx
+  800a9b:	80 fb 19             	cmp    $0x19,%bl
+  800a9e:	77 08                	ja     800aa8 <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  800aa0:	0f be c0             	movsbl %al,%eax
+  800aa3:	83 e8 57             	sub    $0x57,%eax
+  800aa6:	eb d3                	jmp    800a7b <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  800aa8:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800aab:	89 f3                	mov    %esi,%ebx
+  800aad:	80 fb 19             	cmp    $0x19,%bl
+  800ab0:	77 08                	ja     800aba <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  800ab2:	0f be c0             	movsbl %al,%eax
+  800ab5:	83 e8 37             	sub    $0x37,%eax
+  800ab8:	eb c1                	jmp    800a7b <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  800aba:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800abe:	74 05                	je     800ac5 <strtol+0xcc>
+    *endptr = (char*)s;
+  800ac0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800ac3:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  800ac5:	89 c8                	mov    %ecx,%eax
+  800ac7:	f7 d8                	neg    %eax
+  800ac9:	85 ff                	test   %edi,%edi
+  800acb:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800ace:	89 c8                	mov    %ecx,%eax
+  800ad0:	5b                   	pop    %ebx
+  800ad1:	5e                   	pop    %esi
+  800ad2:	5f                   	pop    %edi
+  800ad3:	5d                   	pop    %ebp
+  800ad4:	c3                   	ret
+
+00800ad5 <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800ad5:	55                   	push   %ebp
+  800ad6:	89 e5                	mov    %esp,%ebp
+  800ad8:	57                   	push   %edi
+  800ad9:	56                   	push   %esi
+  800ada:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800adb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ae0:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ae3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ae6:	89 c3                	mov    %eax,%ebx
+  800ae8:	89 c7                	mov    %eax,%edi
+  800aea:	89 c6                	mov    %eax,%esi
+  800aec:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800aee:	5b                   	pop    %ebx
+  800aef:	5e                   	pop    %esi
+  800af0:	5f                   	pop    %edi
+  800af1:	5d                   	pop    %ebp
+  800af2:	c3                   	ret
+
+00800af3 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800af3:	55                   	push   %ebp
+  800af4:	89 e5                	mov    %esp,%ebp
+  800af6:	57                   	push   %edi
+  800af7:	56                   	push   %esi
+  800af8:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800af9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800afe:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b03:	89 d1                	mov    %edx,%ecx
+  800b05:	89 d3                	mov    %edx,%ebx
+  800b07:	89 d7                	mov    %edx,%edi
+  800b09:	89 d6                	mov    %edx,%esi
+  800b0b:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800b0d:	5b                   	pop    %ebx
+  800b0e:	5e                   	pop    %esi
+  800b0f:	5f                   	pop    %edi
+  800b10:	5d                   	pop    %ebp
+  800b11:	c3                   	ret
+
+00800b12 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800b12:	55                   	push   %ebp
+  800b13:	89 e5                	mov    %esp,%ebp
+  800b15:	57                   	push   %edi
+  800b16:	56                   	push   %esi
+  800b17:	53                   	push   %ebx
+  800b18:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800b1b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b20:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b23:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b28:	89 cb                	mov    %ecx,%ebx
+  800b2a:	89 cf                	mov    %ecx,%edi
+  800b2c:	89 ce                	mov    %ecx,%esi
+  800b2e:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800b30:	85 c0                	test   %eax,%eax
+  800b32:	7f 08                	jg     800b3c <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800b34:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800b37:	5b                   	pop    %ebx
+  800b38:	5e                   	pop    %esi
+  800b39:	5f                   	pop    %edi
+  800b3a:	5d                   	pop    %ebp
+  800b3b:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800b3c:	83 ec 0c             	sub    $0xc,%esp
+  800b3f:	50                   	push   %eax
+  800b40:	6a 03                	push   $0x3
+  800b42:	68 23 3d 80 00       	push   $0x803d23
+  800b47:	6a 23                	push   $0x23
+  800b49:	68 40 3d 80 00       	push   $0x803d40
+  800b4e:	e8 89 29 00 00       	call   8034dc <_panic>
+
+00800b53 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800b53:	55                   	push   %ebp
+  800b54:	89 e5                	mov    %esp,%ebp
+  800b56:	57                   	push   %edi
+  800b57:	56                   	push   %esi
+  800b58:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800b59:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b5e:	b8 02 00 00 00       	mov    $0x2,%eax
+  800b63:	89 d1                	mov    %edx,%ecx
+  800b65:	89 d3                	mov    %edx,%ebx
+  800b67:	89 d7                	mov    %edx,%edi
+  800b69:	89 d6                	mov    %edx,%esi
+  800b6b:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800b6d:	5b                   	pop    %ebx
+  800b6e:	5e                   	pop    %esi
+  800b6f:	5f                   	pop    %edi
+  800b70:	5d                   	pop    %ebp
+  800b71:	c3                   	ret
+
+00800b72 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800b72:	55                   	push   %ebp
+  800b73:	89 e5                	mov    %esp,%ebp
+  800b75:	57                   	push   %edi
+  800b76:	56                   	push   %esi
+  800b77:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800b78:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b7d:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800b82:	89 d1                	mov    %edx,%ecx
+  800b84:	89 d3                	mov    %edx,%ebx
+  800b86:	89 d7                	mov    %edx,%edi
+  800b88:	89 d6                	mov    %edx,%esi
+  800b8a:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800b8c:	5b                   	pop    %ebx
+  800b8d:	5e                   	pop    %esi
+  800b8e:	5f                   	pop    %edi
+  800b8f:	5d                   	pop    %ebp
+  800b90:	c3                   	ret
+
+00800b91 <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  800b91:	55                   	push   %ebp
+  800b92:	89 e5                	mov    %esp,%ebp
+  800b94:	57                   	push   %edi
+  800b95:	56                   	push   %esi
+  800b96:	53                   	push   %ebx
+  800b97:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  800b9a:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  800b9e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ba3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ba6:	b8 14 00 00 00       	mov    $0x14,%eax
+  800bab:	89 df                	mov    %ebx,%edi
+  800bad:	89 de                	mov    %ebx,%esi
+  800baf:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800bb1:	85 c0                	test   %eax,%eax
+  800bb3:	7f 08                	jg     800bbd <sys_env_set_cow+0x2c>
+}
+  800bb5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bb8:	5b                   	pop    %ebx
+  800bb9:	5e                   	pop    %esi
+  800bba:	5f                   	pop    %edi
+  800bbb:	5d                   	pop    %ebp
+  800bbc:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800bbd:	83 ec 0c             	sub    $0xc,%esp
+  800bc0:	50                   	push   %eax
+  800bc1:	6a 14                	push   $0x14
+  800bc3:	68 23 3d 80 00       	push   $0x803d23
+  800bc8:	6a 23                	push   $0x23
+  800bca:	68 40 3d 80 00       	push   $0x803d40
+  800bcf:	e8 08 29 00 00       	call   8034dc <_panic>
+
+00800bd4 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800bd4:	55                   	push   %ebp
+  800bd5:	89 e5                	mov    %esp,%ebp
+  800bd7:	57                   	push   %edi
+  800bd8:	56                   	push   %esi
+  800bd9:	53                   	push   %ebx
+  800bda:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800bdd:	be 00 00 00 00       	mov    $0x0,%esi
+  800be2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800be5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800be8:	b8 04 00 00 00       	mov    $0x4,%eax
+  800bed:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800bf0:	89 f7                	mov    %esi,%edi
+  800bf2:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800bf4:	85 c0                	test   %eax,%eax
+  800bf6:	7f 08                	jg     800c00 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  800bf8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bfb:	5b                   	pop    %ebx
+  800bfc:	5e                   	pop    %esi
+  800bfd:	5f                   	pop    %edi
+  800bfe:	5d                   	pop    %ebp
+  800bff:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c00:	83 ec 0c             	sub    $0xc,%esp
+  800c03:	50                   	push   %eax
+  800c04:	6a 04                	push   $0x4
+  800c06:	68 23 3d 80 00       	push   $0x803d23
+  800c0b:	6a 23                	push   $0x23
+  800c0d:	68 40 3d 80 00       	push   $0x803d40
+  800c12:	e8 c5 28 00 00       	call   8034dc <_panic>
+
+00800c17 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800c17:	55                   	push   %ebp
+  800c18:	89 e5                	mov    %esp,%ebp
+  800c1a:	57                   	push   %edi
+  800c1b:	56                   	push   %esi
+  800c1c:	53                   	push   %ebx
+  800c1d:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800c20:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c23:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c26:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c2b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c2e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c31:	8b 75 18             	mov    0x18(%ebp),%esi
+  800c34:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c36:	85 c0                	test   %eax,%eax
+  800c38:	7f 08                	jg     800c42 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  800c3a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c3d:	5b                   	pop    %ebx
+  800c3e:	5e                   	pop    %esi
+  800c3f:	5f                   	pop    %edi
+  800c40:	5d                   	pop    %ebp
+  800c41:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c42:	83 ec 0c             	sub    $0xc,%esp
+  800c45:	50                   	push   %eax
+  800c46:	6a 05                	push   $0x5
+  800c48:	68 23 3d 80 00       	push   $0x803d23
+  800c4d:	6a 23                	push   $0x23
+  800c4f:	68 40 3d 80 00       	push   $0x803d40
+  800c54:	e8 83 28 00 00       	call   8034dc <_panic>
+
+00800c59 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800c59:	55                   	push   %ebp
+  800c5a:	89 e5                	mov    %esp,%ebp
+  800c5c:	57                   	push   %edi
+  800c5d:	56                   	push   %esi
+  800c5e:	53                   	push   %ebx
+  800c5f:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800c62:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c67:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c6a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c6d:	b8 06 00 00 00       	mov    $0x6,%eax
+  800c72:	89 df                	mov    %ebx,%edi
+  800c74:	89 de                	mov    %ebx,%esi
+  800c76:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c78:	85 c0                	test   %eax,%eax
+  800c7a:	7f 08                	jg     800c84 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  800c7c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c7f:	5b                   	pop    %ebx
+  800c80:	5e                   	pop    %esi
+  800c81:	5f                   	pop    %edi
+  800c82:	5d                   	pop    %ebp
+  800c83:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c84:	83 ec 0c             	sub    $0xc,%esp
+  800c87:	50                   	push   %eax
+  800c88:	6a 06                	push   $0x6
+  800c8a:	68 23 3d 80 00       	push   $0x803d23
+  800c8f:	6a 23                	push   $0x23
+  800c91:	68 40 3d 80 00       	push   $0x803d40
+  800c96:	e8 41 28 00 00       	call   8034dc <_panic>
+
+00800c9b <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  800c9b:	55                   	push   %ebp
+  800c9c:	89 e5                	mov    %esp,%ebp
+  800c9e:	57                   	push   %edi
+  800c9f:	56                   	push   %esi
+  800ca0:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800ca1:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ca4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ca7:	b8 11 00 00 00       	mov    $0x11,%eax
+  800cac:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800caf:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800cb2:	8b 75 18             	mov    0x18(%ebp),%esi
+  800cb5:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  800cb7:	5b                   	pop    %ebx
+  800cb8:	5e                   	pop    %esi
+  800cb9:	5f                   	pop    %edi
+  800cba:	5d                   	pop    %ebp
+  800cbb:	c3                   	ret
+
+00800cbc <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  800cbc:	55                   	push   %ebp
+  800cbd:	89 e5                	mov    %esp,%ebp
+  800cbf:	57                   	push   %edi
+  800cc0:	56                   	push   %esi
+  800cc1:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800cc2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cc5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cc8:	b8 12 00 00 00       	mov    $0x12,%eax
+  800ccd:	be 00 00 00 00       	mov    $0x0,%esi
+  800cd2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800cd5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800cd8:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  800cda:	5b                   	pop    %ebx
+  800cdb:	5e                   	pop    %esi
+  800cdc:	5f                   	pop    %edi
+  800cdd:	5d                   	pop    %ebp
+  800cde:	c3                   	ret
+
+00800cdf <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  800cdf:	55                   	push   %ebp
+  800ce0:	89 e5                	mov    %esp,%ebp
+  800ce2:	57                   	push   %edi
+  800ce3:	56                   	push   %esi
+  800ce4:	53                   	push   %ebx
+  800ce5:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800ce8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ced:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cf0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cf3:	b8 16 00 00 00       	mov    $0x16,%eax
+  800cf8:	89 df                	mov    %ebx,%edi
+  800cfa:	89 de                	mov    %ebx,%esi
+  800cfc:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800cfe:	85 c0                	test   %eax,%eax
+  800d00:	7f 08                	jg     800d0a <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  800d02:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d05:	5b                   	pop    %ebx
+  800d06:	5e                   	pop    %esi
+  800d07:	5f                   	pop    %edi
+  800d08:	5d                   	pop    %ebp
+  800d09:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d0a:	83 ec 0c             	sub    $0xc,%esp
+  800d0d:	50                   	push   %eax
+  800d0e:	6a 16                	push   $0x16
+  800d10:	68 23 3d 80 00       	push   $0x803d23
+  800d15:	6a 23                	push   $0x23
+  800d17:	68 40 3d 80 00       	push   $0x803d40
+  800d1c:	e8 bb 27 00 00       	call   8034dc <_panic>
+
+00800d21 <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  800d21:	55                   	push   %ebp
+  800d22:	89 e5                	mov    %esp,%ebp
+  800d24:	57                   	push   %edi
+  800d25:	56                   	push   %esi
+  800d26:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d27:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d2c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d2f:	b8 17 00 00 00       	mov    $0x17,%eax
+  800d34:	89 cb                	mov    %ecx,%ebx
+  800d36:	89 cf                	mov    %ecx,%edi
+  800d38:	89 ce                	mov    %ecx,%esi
+  800d3a:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  800d3c:	5b                   	pop    %ebx
+  800d3d:	5e                   	pop    %esi
+  800d3e:	5f                   	pop    %edi
+  800d3f:	5d                   	pop    %ebp
+  800d40:	c3                   	ret
+
+00800d41 <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  800d41:	55                   	push   %ebp
+  800d42:	89 e5                	mov    %esp,%ebp
+  800d44:	57                   	push   %edi
+  800d45:	56                   	push   %esi
+  800d46:	53                   	push   %ebx
+  800d47:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800d4a:	be 00 00 00 00       	mov    $0x0,%esi
+  800d4f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d52:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d55:	b8 18 00 00 00       	mov    $0x18,%eax
+  800d5a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d5d:	89 f7                	mov    %esi,%edi
+  800d5f:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d61:	85 c0                	test   %eax,%eax
+  800d63:	7f 08                	jg     800d6d <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  800d65:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d68:	5b                   	pop    %ebx
+  800d69:	5e                   	pop    %esi
+  800d6a:	5f                   	pop    %edi
+  800d6b:	5d                   	pop    %ebp
+  800d6c:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d6d:	83 ec 0c             	sub    $0xc,%esp
+  800d70:	50                   	push   %eax
+  800d71:	6a 18                	push   $0x18
+  800d73:	68 23 3d 80 00       	push   $0x803d23
+  800d78:	6a 23                	push   $0x23
+  800d7a:	68 40 3d 80 00       	push   $0x803d40
+  800d7f:	e8 58 27 00 00       	call   8034dc <_panic>
+
+00800d84 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  800d84:	55                   	push   %ebp
+  800d85:	89 e5                	mov    %esp,%ebp
+  800d87:	57                   	push   %edi
+  800d88:	56                   	push   %esi
+  800d89:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d8a:	be 00 00 00 00       	mov    $0x0,%esi
+  800d8f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d92:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d95:	b8 19 00 00 00       	mov    $0x19,%eax
+  800d9a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d9d:	89 f7                	mov    %esi,%edi
+  800d9f:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  800da1:	5b                   	pop    %ebx
+  800da2:	5e                   	pop    %esi
+  800da3:	5f                   	pop    %edi
+  800da4:	5d                   	pop    %ebp
+  800da5:	c3                   	ret
+
+00800da6 <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  800da6:	55                   	push   %ebp
+  800da7:	89 e5                	mov    %esp,%ebp
+  800da9:	57                   	push   %edi
+  800daa:	56                   	push   %esi
+  800dab:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800dac:	ba 00 00 00 00       	mov    $0x0,%edx
+  800db1:	b8 15 00 00 00       	mov    $0x15,%eax
+  800db6:	89 d1                	mov    %edx,%ecx
+  800db8:	89 d3                	mov    %edx,%ebx
+  800dba:	89 d7                	mov    %edx,%edi
+  800dbc:	89 d6                	mov    %edx,%esi
+  800dbe:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800dc0:	5b                   	pop    %ebx
+  800dc1:	5e                   	pop    %esi
+  800dc2:	5f                   	pop    %edi
+  800dc3:	5d                   	pop    %ebp
+  800dc4:	c3                   	ret
+
+00800dc5 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800dc5:	55                   	push   %ebp
+  800dc6:	89 e5                	mov    %esp,%ebp
+  800dc8:	57                   	push   %edi
+  800dc9:	56                   	push   %esi
+  800dca:	53                   	push   %ebx
+  800dcb:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800dce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dd3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dd6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dd9:	b8 08 00 00 00       	mov    $0x8,%eax
+  800dde:	89 df                	mov    %ebx,%edi
+  800de0:	89 de                	mov    %ebx,%esi
+  800de2:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800de4:	85 c0                	test   %eax,%eax
+  800de6:	7f 08                	jg     800df0 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800de8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800deb:	5b                   	pop    %ebx
+  800dec:	5e                   	pop    %esi
+  800ded:	5f                   	pop    %edi
+  800dee:	5d                   	pop    %ebp
+  800def:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800df0:	83 ec 0c             	sub    $0xc,%esp
+  800df3:	50                   	push   %eax
+  800df4:	6a 08                	push   $0x8
+  800df6:	68 23 3d 80 00       	push   $0x803d23
+  800dfb:	6a 23                	push   $0x23
+  800dfd:	68 40 3d 80 00       	push   $0x803d40
+  800e02:	e8 d5 26 00 00       	call   8034dc <_panic>
+
+00800e07 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800e07:	55                   	push   %ebp
+  800e08:	89 e5                	mov    %esp,%ebp
+  800e0a:	57                   	push   %edi
+  800e0b:	56                   	push   %esi
+  800e0c:	53                   	push   %ebx
+  800e0d:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e10:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e15:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e18:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e1b:	b8 09 00 00 00       	mov    $0x9,%eax
+  800e20:	89 df                	mov    %ebx,%edi
+  800e22:	89 de                	mov    %ebx,%esi
+  800e24:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e26:	85 c0                	test   %eax,%eax
+  800e28:	7f 08                	jg     800e32 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  800e2a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e2d:	5b                   	pop    %ebx
+  800e2e:	5e                   	pop    %esi
+  800e2f:	5f                   	pop    %edi
+  800e30:	5d                   	pop    %ebp
+  800e31:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e32:	83 ec 0c             	sub    $0xc,%esp
+  800e35:	50                   	push   %eax
+  800e36:	6a 09                	push   $0x9
+  800e38:	68 23 3d 80 00       	push   $0x803d23
+  800e3d:	6a 23                	push   $0x23
+  800e3f:	68 40 3d 80 00       	push   $0x803d40
+  800e44:	e8 93 26 00 00       	call   8034dc <_panic>
+
+00800e49 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800e49:	55                   	push   %ebp
+  800e4a:	89 e5                	mov    %esp,%ebp
+  800e4c:	57                   	push   %edi
+  800e4d:	56                   	push   %esi
+  800e4e:	53                   	push   %ebx
+  800e4f:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e52:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e57:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e5a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e5d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800e62:	89 df                	mov    %ebx,%edi
+  800e64:	89 de                	mov    %ebx,%esi
+  800e66:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e68:	85 c0                	test   %eax,%eax
+  800e6a:	7f 08                	jg     800e74 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  800e6c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e6f:	5b                   	pop    %ebx
+  800e70:	5e                   	pop    %esi
+  800e71:	5f                   	pop    %edi
+  800e72:	5d                   	pop    %ebp
+  800e73:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e74:	83 ec 0c             	sub    $0xc,%esp
+  800e77:	50                   	push   %eax
+  800e78:	6a 0a                	push   $0xa
+  800e7a:	68 23 3d 80 00       	push   $0x803d23
+  800e7f:	6a 23                	push   $0x23
+  800e81:	68 40 3d 80 00       	push   $0x803d40
+  800e86:	e8 51 26 00 00       	call   8034dc <_panic>
+
+00800e8b <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  800e8b:	55                   	push   %ebp
+  800e8c:	89 e5                	mov    %esp,%ebp
+  800e8e:	57                   	push   %edi
+  800e8f:	56                   	push   %esi
+  800e90:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e91:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e94:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e97:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800e9c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e9f:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ea2:	8b 75 18             	mov    0x18(%ebp),%esi
+  800ea5:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  800ea7:	5b                   	pop    %ebx
+  800ea8:	5e                   	pop    %esi
+  800ea9:	5f                   	pop    %edi
+  800eaa:	5d                   	pop    %ebp
+  800eab:	c3                   	ret
+
+00800eac <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  800eac:	55                   	push   %ebp
+  800ead:	89 e5                	mov    %esp,%ebp
+  800eaf:	57                   	push   %edi
+  800eb0:	56                   	push   %esi
+  800eb1:	53                   	push   %ebx
+  800eb2:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800eb5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eba:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ebd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ec0:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800ec5:	89 df                	mov    %ebx,%edi
+  800ec7:	89 de                	mov    %ebx,%esi
+  800ec9:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ecb:	85 c0                	test   %eax,%eax
+  800ecd:	7f 08                	jg     800ed7 <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  800ecf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ed2:	5b                   	pop    %ebx
+  800ed3:	5e                   	pop    %esi
+  800ed4:	5f                   	pop    %edi
+  800ed5:	5d                   	pop    %ebp
+  800ed6:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ed7:	83 ec 0c             	sub    $0xc,%esp
+  800eda:	50                   	push   %eax
+  800edb:	6a 0d                	push   $0xd
+  800edd:	68 23 3d 80 00       	push   $0x803d23
+  800ee2:	6a 23                	push   $0x23
+  800ee4:	68 40 3d 80 00       	push   $0x803d40
+  800ee9:	e8 ee 25 00 00       	call   8034dc <_panic>
+
+00800eee <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  800eee:	55                   	push   %ebp
+  800eef:	89 e5                	mov    %esp,%ebp
+  800ef1:	57                   	push   %edi
+  800ef2:	56                   	push   %esi
+  800ef3:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800ef4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ef9:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800efe:	89 d1                	mov    %edx,%ecx
+  800f00:	89 d3                	mov    %edx,%ebx
+  800f02:	89 d7                	mov    %edx,%edi
+  800f04:	89 d6                	mov    %edx,%esi
+  800f06:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800f08:	5b                   	pop    %ebx
+  800f09:	5e                   	pop    %esi
+  800f0a:	5f                   	pop    %edi
+  800f0b:	5d                   	pop    %ebp
+  800f0c:	c3                   	ret
+
+00800f0d <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  800f0d:	55                   	push   %ebp
+  800f0e:	89 e5                	mov    %esp,%ebp
+  800f10:	57                   	push   %edi
+  800f11:	56                   	push   %esi
+  800f12:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f13:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f16:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f19:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f1e:	be 00 00 00 00       	mov    $0x0,%esi
+  800f23:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f26:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f29:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  800f2b:	5b                   	pop    %ebx
+  800f2c:	5e                   	pop    %esi
+  800f2d:	5f                   	pop    %edi
+  800f2e:	5d                   	pop    %ebp
+  800f2f:	c3                   	ret
+
+00800f30 <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  800f30:	55                   	push   %ebp
+  800f31:	89 e5                	mov    %esp,%ebp
+  800f33:	57                   	push   %edi
+  800f34:	56                   	push   %esi
+  800f35:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f36:	be 00 00 00 00       	mov    $0x0,%esi
+  800f3b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f3e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f41:	b8 10 00 00 00       	mov    $0x10,%eax
+  800f46:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f49:	89 f7                	mov    %esi,%edi
+  800f4b:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  800f4d:	5b                   	pop    %ebx
+  800f4e:	5e                   	pop    %esi
+  800f4f:	5f                   	pop    %edi
+  800f50:	5d                   	pop    %ebp
+  800f51:	c3                   	ret
+
+00800f52 <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  800f52:	55                   	push   %ebp
+  800f53:	89 e5                	mov    %esp,%ebp
+  800f55:	57                   	push   %edi
+  800f56:	56                   	push   %esi
+  800f57:	53                   	push   %ebx
+  800f58:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  800f5b:	80 3d a4 58 80 00 00 	cmpb   $0x0,0x8058a4
+  800f62:	74 41                	je     800fa5 <sys_batch+0x53>
+  800f64:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f67:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  800f6a:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  800f71:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800f74:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  800f77:	7d 45                	jge    800fbe <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  800f79:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800f7c:	8b 06                	mov    (%esi),%eax
+  800f7e:	8b 56 04             	mov    0x4(%esi),%edx
+  800f81:	8b 4e 08             	mov    0x8(%esi),%ecx
+  800f84:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  800f87:	8b 7e 10             	mov    0x10(%esi),%edi
+  800f8a:	8b 76 14             	mov    0x14(%esi),%esi
+  800f8d:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  800f8f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800f92:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  800f95:	83 c6 1c             	add    $0x1c,%esi
+  800f98:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  800f9b:	85 c0                	test   %eax,%eax
+  800f9d:	78 1f                	js     800fbe <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  800f9f:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  800fa3:	eb cc                	jmp    800f71 <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  800fa5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800faa:	b8 13 00 00 00       	mov    $0x13,%eax
+  800faf:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fb2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fb5:	89 df                	mov    %ebx,%edi
+  800fb7:	89 de                	mov    %ebx,%esi
+  800fb9:	cd 30                	int    $0x30
+  800fbb:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  800fbe:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800fc1:	83 c4 08             	add    $0x8,%esp
+  800fc4:	5b                   	pop    %ebx
+  800fc5:	5e                   	pop    %esi
+  800fc6:	5f                   	pop    %edi
+  800fc7:	5d                   	pop    %ebp
+  800fc8:	c3                   	ret
+
+00800fc9 <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  800fc9:	55                   	push   %ebp
+  800fca:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  800fcc:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fcf:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  800fd5:	5d                   	pop    %ebp
+  800fd6:	c3                   	ret
+
+00800fd7 <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  800fd7:	55                   	push   %ebp
+  800fd8:	89 e5                	mov    %esp,%ebp
+  800fda:	56                   	push   %esi
+  800fdb:	53                   	push   %ebx
+  800fdc:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  800fdf:	8b 1e                	mov    (%esi),%ebx
+  800fe1:	85 db                	test   %ebx,%ebx
+  800fe3:	75 09                	jne    800fee <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  800fe5:	89 d8                	mov    %ebx,%eax
+  800fe7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800fea:	5b                   	pop    %ebx
+  800feb:	5e                   	pop    %esi
+  800fec:	5d                   	pop    %ebp
+  800fed:	c3                   	ret
+  b->sb_n = 0;
+  800fee:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  800ff4:	53                   	push   %ebx
+  800ff5:	8d 46 04             	lea    0x4(%esi),%eax
+  800ff8:	50                   	push   %eax
+  800ff9:	e8 54 ff ff ff       	call   800f52 <sys_batch>
+  800ffe:	83 c4 08             	add    $0x8,%esp
+  801001:	85 c0                	test   %eax,%eax
+  801003:	78 1e                	js     801023 <sysbatch_flush+0x4c>
+  if (r < n)
+  801005:	39 c3                	cmp    %eax,%ebx
+  801007:	7f 07                	jg     801010 <sysbatch_flush+0x39>
+  return 0;
+  801009:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80100e:	eb d5                	jmp    800fe5 <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  801010:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801013:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  801017:	85 db                	test   %ebx,%ebx
+  801019:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80101e:	0f 49 d8             	cmovns %eax,%ebx
+  801021:	eb c2                	jmp    800fe5 <sysbatch_flush+0xe>
+    return r;
+  801023:	89 c3                	mov    %eax,%ebx
+  801025:	eb be                	jmp    800fe5 <sysbatch_flush+0xe>
+
+00801027 <sysbatch_add>:
+{
+  801027:	55                   	push   %ebp
+  801028:	89 e5                	mov    %esp,%ebp
+  80102a:	53                   	push   %ebx
+  80102b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  80102e:	83 3b 40             	cmpl   $0x40,(%ebx)
+  801031:	74 41                	je     801074 <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  801033:	8b 03                	mov    (%ebx),%eax
+  801035:	8d 50 01             	lea    0x1(%eax),%edx
+  801038:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  80103a:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80103d:	01 d8                	add    %ebx,%eax
+  80103f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801042:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  801045:	8b 55 10             	mov    0x10(%ebp),%edx
+  801048:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  80104b:	8b 55 14             	mov    0x14(%ebp),%edx
+  80104e:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  801051:	8b 55 18             	mov    0x18(%ebp),%edx
+  801054:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  801057:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  80105a:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  80105d:	8b 55 20             	mov    0x20(%ebp),%edx
+  801060:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  801063:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  80106a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80106f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801072:	c9                   	leave
+  801073:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  801074:	53                   	push   %ebx
+  801075:	e8 5d ff ff ff       	call   800fd7 <sysbatch_flush>
+  80107a:	83 c4 04             	add    $0x4,%esp
+  80107d:	85 c0                	test   %eax,%eax
+  80107f:	79 b2                	jns    801033 <sysbatch_add+0xc>
+  801081:	eb ec                	jmp    80106f <sysbatch_add+0x48>
+
+00801083 <pgfault>:
+// Custom page fault handler - if faulting page is copy-on-write,
+// map in our own private writable copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  801083:	55                   	push   %ebp
+  801084:	89 e5                	mov    %esp,%ebp
+  801086:	56                   	push   %esi
+  801087:	53                   	push   %ebx
+  801088:	8b 45 08             	mov    0x8(%ebp),%eax
+  void *addr = (void*)utf->utf_fault_va;
+  80108b:	8b 18                	mov    (%eax),%ebx
+  uint32_t err = utf->utf_err;
+  80108d:	8b 70 04             	mov    0x4(%eax),%esi
+  // Hint:
+  //   Use the read-only page table mappings at uvpt
+  //   (see <inc/memlayout.h>).
+
+  // Faults in file mappings are mmap's to handle.
+  if (mmap_fault(utf))
+  801090:	83 ec 0c             	sub    $0xc,%esp
+  801093:	50                   	push   %eax
+  801094:	e8 b4 1d 00 00       	call   802e4d <mmap_fault>
+  801099:	83 c4 10             	add    $0x10,%esp
+  80109c:	84 c0                	test   %al,%al
+  80109e:	75 7d                	jne    80111d <pgfault+0x9a>
+    return;
+
+  // LAB 4: Your code here.
+  if ( !(err & FEC_WR) ) {
+  8010a0:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  8010a6:	74 7c                	je     801124 <pgfault+0xa1>
+    panic("user_pgfault: %e", err);
+  }
+
+  if ( !(uvpt[PGNUM(addr)] & PTE_COW) ) {
+  8010a8:	89 d8                	mov    %ebx,%eax
+  8010aa:	c1 e8 0c             	shr    $0xc,%eax
+  8010ad:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8010b4:	f6 c4 08             	test   $0x8,%ah
+  8010b7:	74 7d                	je     801136 <pgfault+0xb3>
+  // page to the old page's address.
+  // Hint:
+  //   You should make three system calls.
+
+  // LAB 4: Your code here.
+  addr = ROUNDDOWN(addr, PGSIZE);
+  8010b9:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+
+  // map page to temporary location
+  if ( (r = sys_page_alloc(0, PFTEMP, (PTE_P | PTE_U | PTE_W))) < 0) {
+  8010bf:	83 ec 04             	sub    $0x4,%esp
+  8010c2:	6a 07                	push   $0x7
+  8010c4:	68 00 f0 7f 00       	push   $0x7ff000
+  8010c9:	6a 00                	push   $0x0
+  8010cb:	e8 04 fb ff ff       	call   800bd4 <sys_page_alloc>
+  8010d0:	83 c4 10             	add    $0x10,%esp
+  8010d3:	85 c0                	test   %eax,%eax
+  8010d5:	78 73                	js     80114a <pgfault+0xc7>
+    panic("sys_page_alloc: %e", r);
+  }
+
+  // copy data from old page to new page
+  memmove(PFTEMP, addr, PGSIZE);
+  8010d7:	83 ec 04             	sub    $0x4,%esp
+  8010da:	68 00 10 00 00       	push   $0x1000
+  8010df:	53                   	push   %ebx
+  8010e0:	68 00 f0 7f 00       	push   $0x7ff000
+  8010e5:	e8 41 f8 ff ff       	call   80092b <memmove>
+
+  // move new page to old page address
+  if ( (r = sys_page_map(0, PFTEMP, 0, addr, (PTE_P | PTE_U | PTE_W))) < 0) {
+  8010ea:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8010f1:	53                   	push   %ebx
+  8010f2:	6a 00                	push   $0x0
+  8010f4:	68 00 f0 7f 00       	push   $0x7ff000
+  8010f9:	6a 00                	push   $0x0
+  8010fb:	e8 17 fb ff ff       	call   800c17 <sys_page_map>
+  801100:	83 c4 20             	add    $0x20,%esp
+  801103:	85 c0                	test   %eax,%eax
+  801105:	78 55                	js     80115c <pgfault+0xd9>
+    panic("sys_page_map: %e", r);
+  }
+
+  if ( (r = sys_page_unmap(0, PFTEMP)) < 0) {
+  801107:	83 ec 08             	sub    $0x8,%esp
+  80110a:	68 00 f0 7f 00       	push   $0x7ff000
+  80110f:	6a 00                	push   $0x0
+  801111:	e8 43 fb ff ff       	call   800c59 <sys_page_unmap>
+  801116:	83 c4 10             	add    $0x10,%esp
+  801119:	85 c0                	test   %eax,%eax
+  80111b:	78 51                	js     80116e <pgfault+0xeb>
+    panic("sys_page_unmap: %e", r);
+  }
+}
+  80111d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801120:	5b                   	pop    %ebx
+  801121:	5e                   	pop    %esi
+  801122:	5d                   	pop    %ebp
+  801123:	c3                   	ret
+    panic("user_pgfault: %e", err);
+  801124:	56                   	push   %esi
+  801125:	68 4e 3d 80 00       	push   $0x803d4e
+  80112a:	6a 1d                	push   $0x1d
+  80112c:	68 5f 3d 80 00       	push   $0x803d5f
+  801131:	e8 a6 23 00 00       	call   8034dc <_panic>
+    panic("user_pgfault: page not COW");
+  801136:	83 ec 04             	sub    $0x4,%esp
+  801139:	68 6a 3d 80 00       	push   $0x803d6a
+  80113e:	6a 21                	push   $0x21
+  801140:	68 5f 3d 80 00       	push   $0x803d5f
+  801145:	e8 92 23 00 00       	call   8034dc <_panic>
+    panic("sys_page_alloc: %e", r);
+  80114a:	50                   	push   %eax
+  80114b:	68 85 3d 80 00       	push   $0x803d85
+  801150:	6a 2f                	push   $0x2f
+  801152:	68 5f 3d 80 00       	push   $0x803d5f
+  801157:	e8 80 23 00 00       	call   8034dc <_panic>
+    panic("sys_page_map: %e", r);
+  80115c:	50                   	push   %eax
+  80115d:	68 98 3d 80 00       	push   $0x803d98
+  801162:	6a 37                	push   $0x37
+  801164:	68 5f 3d 80 00       	push   $0x803d5f
+  801169:	e8 6e 23 00 00       	call   8034dc <_panic>
+    panic("sys_page_unmap: %e", r);
+  80116e:	50                   	push   %eax
+  80116f:	68 a9 3d 80 00       	push   $0x803da9
+  801174:	6a 3b                	push   $0x3b
+  801176:	68 5f 3d 80 00       	push   $0x803d5f
+  80117b:	e8 5c 23 00 00       	call   8034dc <_panic>
+
+00801180 <shared_pgfault>:
+
+// Challenge!
+//
+static void
+shared_pgfault(struct UTrapframe *utf)
+{
+  801180:	55                   	push   %ebp
+  801181:	89 e5                	mov    %esp,%ebp
+  801183:	53                   	push   %ebx
+  801184:	83 ec 10             	sub    $0x10,%esp
+  801187:	8b 45 08             	mov    0x8(%ebp),%eax
+  // just has fewer error checks
+  
+  void *addr = (void*)utf->utf_fault_va;
+  80118a:	8b 18                	mov    (%eax),%ebx
+  uint32_t err = utf->utf_err;
+  int r;
+
+  if (mmap_fault(utf))
+  80118c:	50                   	push   %eax
+  80118d:	e8 bb 1c 00 00       	call   802e4d <mmap_fault>
+  801192:	83 c4 10             	add    $0x10,%esp
+  801195:	84 c0                	test   %al,%al
+  801197:	74 05                	je     80119e <shared_pgfault+0x1e>
+  }
+
+  if ( (r = sys_page_unmap(0, PFTEMP)) < 0) {
+    panic("sys_page_unmap: %e", r);
+  }
+}
+  801199:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80119c:	c9                   	leave
+  80119d:	c3                   	ret
+  addr = ROUNDDOWN(addr, PGSIZE);
+  80119e:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if ( (r = sys_page_alloc(0, PFTEMP, (PTE_P | PTE_U | PTE_W))) < 0) {
+  8011a4:	83 ec 04             	sub    $0x4,%esp
+  8011a7:	6a 07                	push   $0x7
+  8011a9:	68 00 f0 7f 00       	push   $0x7ff000
+  8011ae:	6a 00                	push   $0x0
+  8011b0:	e8 1f fa ff ff       	call   800bd4 <sys_page_alloc>
+  8011b5:	83 c4 10             	add    $0x10,%esp
+  8011b8:	85 c0                	test   %eax,%eax
+  8011ba:	78 5b                	js     801217 <shared_pgfault+0x97>
+  memmove(PFTEMP, addr, PGSIZE);
+  8011bc:	83 ec 04             	sub    $0x4,%esp
+  8011bf:	68 00 10 00 00       	push   $0x1000
+  8011c4:	53                   	push   %ebx
+  8011c5:	68 00 f0 7f 00       	push   $0x7ff000
+  8011ca:	e8 5c f7 ff ff       	call   80092b <memmove>
+  if ( (r = sys_page_map(0, PFTEMP, 0, addr, (PTE_P | PTE_U | PTE_W))) < 0) {
+  8011cf:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  8011d6:	53                   	push   %ebx
+  8011d7:	6a 00                	push   $0x0
+  8011d9:	68 00 f0 7f 00       	push   $0x7ff000
+  8011de:	6a 00                	push   $0x0
+  8011e0:	e8 32 fa ff ff       	call   800c17 <sys_page_map>
+  8011e5:	83 c4 20             	add    $0x20,%esp
+  8011e8:	85 c0                	test   %eax,%eax
+  8011ea:	78 40                	js     80122c <shared_pgfault+0xac>
+  if ( (r = sys_page_unmap(0, PFTEMP)) < 0) {
+  8011ec:	83 ec 08             	sub    $0x8,%esp
+  8011ef:	68 00 f0 7f 00       	push   $0x7ff000
+  8011f4:	6a 00                	push   $0x0
+  8011f6:	e8 5e fa ff ff       	call   800c59 <sys_page_unmap>
+  8011fb:	83 c4 10             	add    $0x10,%esp
+  8011fe:	85 c0                	test   %eax,%eax
+  801200:	79 97                	jns    801199 <shared_pgfault+0x19>
+    panic("sys_page_unmap: %e", r);
+  801202:	50                   	push   %eax
+  801203:	68 a9 3d 80 00       	push   $0x803da9
+  801208:	68 b0 00 00 00       	push   $0xb0
+  80120d:	68 5f 3d 80 00       	push   $0x803d5f
+  801212:	e8 c5 22 00 00       	call   8034dc <_panic>
+    panic("sys_page_alloc: %e", r);
+  801217:	50                   	push   %eax
+  801218:	68 85 3d 80 00       	push   $0x803d85
+  80121d:	68 a4 00 00 00       	push   $0xa4
+  801222:	68 5f 3d 80 00       	push   $0x803d5f
+  801227:	e8 b0 22 00 00       	call   8034dc <_panic>
+    panic("sys_page_map: %e", r);
+  80122c:	50                   	push   %eax
+  80122d:	68 98 3d 80 00       	push   $0x803d98
+  801232:	68 ac 00 00 00       	push   $0xac
+  801237:	68 5f 3d 80 00       	push   $0x803d5f
+  80123c:	e8 9b 22 00 00       	call   8034dc <_panic>
+
+00801241 <fork>:
+{
+  801241:	55                   	push   %ebp
+  801242:	89 e5                	mov    %esp,%ebp
+  801244:	53                   	push   %ebx
+  801245:	83 ec 04             	sub    $0x4,%esp
+  parent_id = sys_getenvid();
+  801248:	e8 06 f9 ff ff       	call   800b53 <sys_getenvid>
+  set_pgfault_handler(pgfault);
+  80124d:	83 ec 0c             	sub    $0xc,%esp
+  801250:	68 83 10 80 00       	push   $0x801083
+  801255:	e8 c8 22 00 00       	call   803522 <set_pgfault_handler>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+  envid_t ret;
+  __asm __volatile("int %2"
+  80125a:	b8 07 00 00 00       	mov    $0x7,%eax
+  80125f:	cd 30                	int    $0x30
+  801261:	89 c3                	mov    %eax,%ebx
+  if (envid < 0) {
+  801263:	83 c4 10             	add    $0x10,%esp
+  801266:	85 c0                	test   %eax,%eax
+  801268:	78 66                	js     8012d0 <fork+0x8f>
+  } else if (envid == 0) {
+  80126a:	74 76                	je     8012e2 <fork+0xa1>
+  if ( (error = sys_page_map_range(0, 0, UXSTACKTOP - PGSIZE,
+  80126c:	83 ec 0c             	sub    $0xc,%esp
+  80126f:	6a 01                	push   $0x1
+  801271:	50                   	push   %eax
+  801272:	68 00 f0 bf ee       	push   $0xeebff000
+  801277:	6a 00                	push   $0x0
+  801279:	6a 00                	push   $0x0
+  80127b:	e8 1b fa ff ff       	call   800c9b <sys_page_map_range>
+  801280:	83 c4 20             	add    $0x20,%esp
+  801283:	85 c0                	test   %eax,%eax
+  801285:	78 77                	js     8012fe <fork+0xbd>
+  if ( (error = sys_page_alloc(envid,
+  801287:	83 ec 04             	sub    $0x4,%esp
+  80128a:	6a 07                	push   $0x7
+  80128c:	68 00 f0 bf ee       	push   $0xeebff000
+  801291:	53                   	push   %ebx
+  801292:	e8 3d f9 ff ff       	call   800bd4 <sys_page_alloc>
+  801297:	83 c4 10             	add    $0x10,%esp
+  80129a:	85 c0                	test   %eax,%eax
+  80129c:	78 72                	js     801310 <fork+0xcf>
+          thisenv->env_pgfault_upcall)) < 0) {
+  80129e:	a1 a0 58 80 00       	mov    0x8058a0,%eax
+  8012a3:	8b 40 64             	mov    0x64(%eax),%eax
+  if ( (error = sys_env_set_pgfault_upcall(envid,
+  8012a6:	83 ec 08             	sub    $0x8,%esp
+  8012a9:	50                   	push   %eax
+  8012aa:	53                   	push   %ebx
+  8012ab:	e8 99 fb ff ff       	call   800e49 <sys_env_set_pgfault_upcall>
+  8012b0:	83 c4 10             	add    $0x10,%esp
+  8012b3:	85 c0                	test   %eax,%eax
+  8012b5:	78 6b                	js     801322 <fork+0xe1>
+  if ( (error = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+  8012b7:	83 ec 08             	sub    $0x8,%esp
+  8012ba:	6a 02                	push   $0x2
+  8012bc:	53                   	push   %ebx
+  8012bd:	e8 03 fb ff ff       	call   800dc5 <sys_env_set_status>
+  8012c2:	83 c4 10             	add    $0x10,%esp
+  8012c5:	85 c0                	test   %eax,%eax
+  8012c7:	78 6b                	js     801334 <fork+0xf3>
+}
+  8012c9:	89 d8                	mov    %ebx,%eax
+  8012cb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012ce:	c9                   	leave
+  8012cf:	c3                   	ret
+    panic("sys_exofork: %e", envid);
+  8012d0:	50                   	push   %eax
+  8012d1:	68 bc 3d 80 00       	push   $0x803dbc
+  8012d6:	6a 5e                	push   $0x5e
+  8012d8:	68 5f 3d 80 00       	push   $0x803d5f
+  8012dd:	e8 fa 21 00 00       	call   8034dc <_panic>
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8012e2:	e8 6c f8 ff ff       	call   800b53 <sys_getenvid>
+  8012e7:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8012ec:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8012ef:	c1 e0 04             	shl    $0x4,%eax
+  8012f2:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8012f7:	a3 a0 58 80 00       	mov    %eax,0x8058a0
+    return 0;
+  8012fc:	eb cb                	jmp    8012c9 <fork+0x88>
+    panic("sys_page_map_range: %e", error);
+  8012fe:	50                   	push   %eax
+  8012ff:	68 cc 3d 80 00       	push   $0x803dcc
+  801304:	6a 69                	push   $0x69
+  801306:	68 5f 3d 80 00       	push   $0x803d5f
+  80130b:	e8 cc 21 00 00       	call   8034dc <_panic>
+    panic("sys_page_alloc: %e", error);
+  801310:	50                   	push   %eax
+  801311:	68 85 3d 80 00       	push   $0x803d85
+  801316:	6a 70                	push   $0x70
+  801318:	68 5f 3d 80 00       	push   $0x803d5f
+  80131d:	e8 ba 21 00 00       	call   8034dc <_panic>
+    panic("sys_env_set_pgfault_upcall: %e", error);
+  801322:	50                   	push   %eax
+  801323:	68 fc 3d 80 00       	push   $0x803dfc
+  801328:	6a 76                	push   $0x76
+  80132a:	68 5f 3d 80 00       	push   $0x803d5f
+  80132f:	e8 a8 21 00 00       	call   8034dc <_panic>
+    panic("sys_env_set_status: %e", error);
+  801334:	50                   	push   %eax
+  801335:	68 e3 3d 80 00       	push   $0x803de3
+  80133a:	6a 7a                	push   $0x7a
+  80133c:	68 5f 3d 80 00       	push   $0x803d5f
+  801341:	e8 96 21 00 00       	call   8034dc <_panic>
+
+00801346 <kfork>:
+{
+  801346:	55                   	push   %ebp
+  801347:	89 e5                	mov    %esp,%ebp
+  801349:	53                   	push   %ebx
+  80134a:	83 ec 10             	sub    $0x10,%esp
+  set_pgfault_handler(pgfault);
+  80134d:	68 83 10 80 00       	push   $0x801083
+  801352:	e8 cb 21 00 00       	call   803522 <set_pgfault_handler>
+  if ((envid = sys_fork()) == 0)
+  801357:	e8 4a fa ff ff       	call   800da6 <sys_fork>
+  80135c:	89 c3                	mov    %eax,%ebx
+  80135e:	83 c4 10             	add    $0x10,%esp
+  801361:	85 c0                	test   %eax,%eax
+  801363:	74 07                	je     80136c <kfork+0x26>
+}
+  801365:	89 d8                	mov    %ebx,%eax
+  801367:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80136a:	c9                   	leave
+  80136b:	c3                   	ret
+    thisenv = &envs[ENVX(sys_getenvid())];
+  80136c:	e8 e2 f7 ff ff       	call   800b53 <sys_getenvid>
+  801371:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801376:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  801379:	c1 e0 04             	shl    $0x4,%eax
+  80137c:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801381:	a3 a0 58 80 00       	mov    %eax,0x8058a0
+  return envid;
+  801386:	eb dd                	jmp    801365 <kfork+0x1f>
+
+00801388 <sfork>:
+
+int
+sfork(void)
+{
+  801388:	55                   	push   %ebp
+  801389:	89 e5                	mov    %esp,%ebp
+  80138b:	53                   	push   %ebx
+  80138c:	83 ec 04             	sub    $0x4,%esp
+  envid_t envid, parent_id;
+  int error;
+
+  parent_id = sys_getenvid();
+  80138f:	e8 bf f7 ff ff       	call   800b53 <sys_getenvid>
+
+  // set up page fault handler
+  set_pgfault_handler(shared_pgfault);
+  801394:	83 ec 0c             	sub    $0xc,%esp
+  801397:	68 80 11 80 00       	push   $0x801180
+  80139c:	e8 81 21 00 00       	call   803522 <set_pgfault_handler>
+  8013a1:	b8 07 00 00 00       	mov    $0x7,%eax
+  8013a6:	cd 30                	int    $0x30
+  8013a8:	89 c3                	mov    %eax,%ebx
+
+  // create a child with sys_exofork
+  envid = sys_exofork();
+  
+  if (envid < 0) {
+  8013aa:	83 c4 10             	add    $0x10,%esp
+  8013ad:	85 c0                	test   %eax,%eax
+  8013af:	78 09                	js     8013ba <sfork+0x32>
+    panic("sys_exofork: %e", envid);
+  } else if (envid == 0) {
+  8013b1:	75 1c                	jne    8013cf <sfork+0x47>
+  if ( (error = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+    panic("sys_env_set_status: %e", error);
+  }
+
+  return envid;
+}
+  8013b3:	89 d8                	mov    %ebx,%eax
+  8013b5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013b8:	c9                   	leave
+  8013b9:	c3                   	ret
+    panic("sys_exofork: %e", envid);
+  8013ba:	50                   	push   %eax
+  8013bb:	68 bc 3d 80 00       	push   $0x803dbc
+  8013c0:	68 c3 00 00 00       	push   $0xc3
+  8013c5:	68 5f 3d 80 00       	push   $0x803d5f
+  8013ca:	e8 0d 21 00 00       	call   8034dc <_panic>
+  if ( (error = sys_page_map_range(0, 0, USTACKTOP - PGSIZE,
+  8013cf:	83 ec 0c             	sub    $0xc,%esp
+  8013d2:	6a 00                	push   $0x0
+  8013d4:	50                   	push   %eax
+  8013d5:	68 00 d0 bf ee       	push   $0xeebfd000
+  8013da:	6a 00                	push   $0x0
+  8013dc:	6a 00                	push   $0x0
+  8013de:	e8 b8 f8 ff ff       	call   800c9b <sys_page_map_range>
+  8013e3:	83 c4 20             	add    $0x20,%esp
+  8013e6:	85 c0                	test   %eax,%eax
+  8013e8:	78 79                	js     801463 <sfork+0xdb>
+  if ( (error = sys_page_map_range(0, (void *) (USTACKTOP - PGSIZE), PGSIZE,
+  8013ea:	83 ec 0c             	sub    $0xc,%esp
+  8013ed:	6a 01                	push   $0x1
+  8013ef:	53                   	push   %ebx
+  8013f0:	68 00 10 00 00       	push   $0x1000
+  8013f5:	68 00 d0 bf ee       	push   $0xeebfd000
+  8013fa:	6a 00                	push   $0x0
+  8013fc:	e8 9a f8 ff ff       	call   800c9b <sys_page_map_range>
+  801401:	83 c4 20             	add    $0x20,%esp
+  801404:	85 c0                	test   %eax,%eax
+  801406:	78 70                	js     801478 <sfork+0xf0>
+  if ( (error = sys_page_alloc(envid,
+  801408:	83 ec 04             	sub    $0x4,%esp
+  80140b:	6a 07                	push   $0x7
+  80140d:	68 00 f0 bf ee       	push   $0xeebff000
+  801412:	53                   	push   %ebx
+  801413:	e8 bc f7 ff ff       	call   800bd4 <sys_page_alloc>
+  801418:	83 c4 10             	add    $0x10,%esp
+  80141b:	85 c0                	test   %eax,%eax
+  80141d:	78 6e                	js     80148d <sfork+0x105>
+          thisenv->env_pgfault_upcall)) < 0) {
+  80141f:	a1 a0 58 80 00       	mov    0x8058a0,%eax
+  801424:	8b 40 64             	mov    0x64(%eax),%eax
+  if ( (error = sys_env_set_pgfault_upcall(envid,
+  801427:	83 ec 08             	sub    $0x8,%esp
+  80142a:	50                   	push   %eax
+  80142b:	53                   	push   %ebx
+  80142c:	e8 18 fa ff ff       	call   800e49 <sys_env_set_pgfault_upcall>
+  801431:	83 c4 10             	add    $0x10,%esp
+  801434:	85 c0                	test   %eax,%eax
+  801436:	78 6a                	js     8014a2 <sfork+0x11a>
+  if ( (error = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+  801438:	83 ec 08             	sub    $0x8,%esp
+  80143b:	6a 02                	push   $0x2
+  80143d:	53                   	push   %ebx
+  80143e:	e8 82 f9 ff ff       	call   800dc5 <sys_env_set_status>
+  801443:	83 c4 10             	add    $0x10,%esp
+  801446:	85 c0                	test   %eax,%eax
+  801448:	0f 89 65 ff ff ff    	jns    8013b3 <sfork+0x2b>
+    panic("sys_env_set_status: %e", error);
+  80144e:	50                   	push   %eax
+  80144f:	68 e3 3d 80 00       	push   $0x803de3
+  801454:	68 e4 00 00 00       	push   $0xe4
+  801459:	68 5f 3d 80 00       	push   $0x803d5f
+  80145e:	e8 79 20 00 00       	call   8034dc <_panic>
+    panic("sys_page_map_range: %e", error);
+  801463:	50                   	push   %eax
+  801464:	68 cc 3d 80 00       	push   $0x803dcc
+  801469:	68 ce 00 00 00       	push   $0xce
+  80146e:	68 5f 3d 80 00       	push   $0x803d5f
+  801473:	e8 64 20 00 00       	call   8034dc <_panic>
+    panic("sys_page_map_range: %e", error);
+  801478:	50                   	push   %eax
+  801479:	68 cc 3d 80 00       	push   $0x803dcc
+  80147e:	68 d3 00 00 00       	push   $0xd3
+  801483:	68 5f 3d 80 00       	push   $0x803d5f
+  801488:	e8 4f 20 00 00       	call   8034dc <_panic>
+    panic("sys_page_alloc: %e", error);
+  80148d:	50                   	push   %eax
+  80148e:	68 85 3d 80 00       	push   $0x803d85
+  801493:	68 da 00 00 00       	push   $0xda
+  801498:	68 5f 3d 80 00       	push   $0x803d5f
+  80149d:	e8 3a 20 00 00       	call   8034dc <_panic>
+    panic("sys_env_set_pgfault_upcall: %e", error);
+  8014a2:	50                   	push   %eax
+  8014a3:	68 fc 3d 80 00       	push   $0x803dfc
+  8014a8:	68 e0 00 00 00       	push   $0xe0
+  8014ad:	68 5f 3d 80 00       	push   $0x803d5f
+  8014b2:	e8 25 20 00 00       	call   8034dc <_panic>
+
+008014b7 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8014b7:	55                   	push   %ebp
+  8014b8:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8014ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014bd:	05 00 00 00 30       	add    $0x30000000,%eax
+  8014c2:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8014c5:	5d                   	pop    %ebp
+  8014c6:	c3                   	ret
+
+008014c7 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  8014c7:	55                   	push   %ebp
+  8014c8:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8014ca:	8b 45 08             	mov    0x8(%ebp),%eax
+  8014cd:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  8014d0:	66 b8 00 00          	mov    $0x0,%ax
+  8014d4:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  8014d9:	5d                   	pop    %ebp
+  8014da:	c3                   	ret
+
+008014db <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  8014db:	55                   	push   %ebp
+  8014dc:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  8014de:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8014e3:	eb 02                	jmp    8014e7 <fd_alloc+0xc>
+  8014e5:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  8014e7:	89 c2                	mov    %eax,%edx
+  8014e9:	c1 ea 16             	shr    $0x16,%edx
+  8014ec:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8014f3:	f6 c2 01             	test   $0x1,%dl
+  8014f6:	74 2b                	je     801523 <fd_alloc+0x48>
+  8014f8:	89 c2                	mov    %eax,%edx
+  8014fa:	c1 ea 0c             	shr    $0xc,%edx
+  8014fd:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801504:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80150a:	f6 c1 01             	test   $0x1,%cl
+  80150d:	74 14                	je     801523 <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  80150f:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801515:	75 ce                	jne    8014e5 <fd_alloc+0xa>
+  801517:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  80151c:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801521:	eb 05                	jmp    801528 <fd_alloc+0x4d>
+      return 0;
+  801523:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  801528:	8b 55 08             	mov    0x8(%ebp),%edx
+  80152b:	89 02                	mov    %eax,(%edx)
+}
+  80152d:	89 c8                	mov    %ecx,%eax
+  80152f:	5d                   	pop    %ebp
+  801530:	c3                   	ret
+
+00801531 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801531:	55                   	push   %ebp
+  801532:	89 e5                	mov    %esp,%ebp
+  801534:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  801537:	83 f8 1f             	cmp    $0x1f,%eax
+  80153a:	77 30                	ja     80156c <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  80153c:	c1 e0 0c             	shl    $0xc,%eax
+  80153f:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801544:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  80154a:	f6 c2 01             	test   $0x1,%dl
+  80154d:	74 24                	je     801573 <fd_lookup+0x42>
+  80154f:	89 c2                	mov    %eax,%edx
+  801551:	c1 ea 0c             	shr    $0xc,%edx
+  801554:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80155b:	f6 c2 01             	test   $0x1,%dl
+  80155e:	74 1a                	je     80157a <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  801560:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801563:	89 02                	mov    %eax,(%edx)
+  return 0;
+  801565:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80156a:	5d                   	pop    %ebp
+  80156b:	c3                   	ret
+    return -E_INVAL;
+  80156c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801571:	eb f7                	jmp    80156a <fd_lookup+0x39>
+    return -E_INVAL;
+  801573:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801578:	eb f0                	jmp    80156a <fd_lookup+0x39>
+  80157a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80157f:	eb e9                	jmp    80156a <fd_lookup+0x39>
+
+00801581 <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801581:	55                   	push   %ebp
+  801582:	89 e5                	mov    %esp,%ebp
+  801584:	53                   	push   %ebx
+  801585:	83 ec 04             	sub    $0x4,%esp
+  801588:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  80158b:	b8 98 3e 80 00       	mov    $0x803e98,%eax
+  801590:	8b 18                	mov    (%eax),%ebx
+  801592:	85 db                	test   %ebx,%ebx
+  801594:	74 0e                	je     8015a4 <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  801596:	83 c0 04             	add    $0x4,%eax
+  801599:	39 13                	cmp    %edx,(%ebx)
+  80159b:	75 f3                	jne    801590 <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  80159d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015a2:	eb 1f                	jmp    8015c3 <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8015a4:	a1 a0 58 80 00       	mov    0x8058a0,%eax
+  8015a9:	8b 40 48             	mov    0x48(%eax),%eax
+  8015ac:	83 ec 04             	sub    $0x4,%esp
+  8015af:	52                   	push   %edx
+  8015b0:	50                   	push   %eax
+  8015b1:	68 1c 3e 80 00       	push   $0x803e1c
+  8015b6:	e8 fc eb ff ff       	call   8001b7 <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  8015bb:	83 c4 10             	add    $0x10,%esp
+  8015be:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  8015c3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8015c6:	89 1a                	mov    %ebx,(%edx)
+}
+  8015c8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015cb:	c9                   	leave
+  8015cc:	c3                   	ret
+
+008015cd <fd_close>:
+{
+  8015cd:	55                   	push   %ebp
+  8015ce:	89 e5                	mov    %esp,%ebp
+  8015d0:	57                   	push   %edi
+  8015d1:	56                   	push   %esi
+  8015d2:	53                   	push   %ebx
+  8015d3:	83 ec 24             	sub    $0x24,%esp
+  8015d6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8015d9:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8015dc:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8015df:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8015e0:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  8015e6:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  8015e9:	50                   	push   %eax
+  8015ea:	e8 42 ff ff ff       	call   801531 <fd_lookup>
+  8015ef:	89 c3                	mov    %eax,%ebx
+  8015f1:	83 c4 10             	add    $0x10,%esp
+  8015f4:	85 c0                	test   %eax,%eax
+  8015f6:	78 05                	js     8015fd <fd_close+0x30>
+      || fd != fd2)
+  8015f8:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8015fb:	74 16                	je     801613 <fd_close+0x46>
+    return must_exist ? r : 0;
+  8015fd:	89 f8                	mov    %edi,%eax
+  8015ff:	84 c0                	test   %al,%al
+  801601:	b8 00 00 00 00       	mov    $0x0,%eax
+  801606:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801609:	89 d8                	mov    %ebx,%eax
+  80160b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80160e:	5b                   	pop    %ebx
+  80160f:	5e                   	pop    %esi
+  801610:	5f                   	pop    %edi
+  801611:	5d                   	pop    %ebp
+  801612:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801613:	83 ec 08             	sub    $0x8,%esp
+  801616:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801619:	50                   	push   %eax
+  80161a:	ff 36                	push   (%esi)
+  80161c:	e8 60 ff ff ff       	call   801581 <dev_lookup>
+  801621:	89 c3                	mov    %eax,%ebx
+  801623:	83 c4 10             	add    $0x10,%esp
+  801626:	85 c0                	test   %eax,%eax
+  801628:	78 1a                	js     801644 <fd_close+0x77>
+    if (dev->dev_close)
+  80162a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80162d:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  801630:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  801635:	85 c0                	test   %eax,%eax
+  801637:	74 0b                	je     801644 <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  801639:	83 ec 0c             	sub    $0xc,%esp
+  80163c:	56                   	push   %esi
+  80163d:	ff d0                	call   *%eax
+  80163f:	89 c3                	mov    %eax,%ebx
+  801641:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  801644:	83 ec 08             	sub    $0x8,%esp
+  801647:	56                   	push   %esi
+  801648:	6a 00                	push   $0x0
+  80164a:	e8 0a f6 ff ff       	call   800c59 <sys_page_unmap>
+  return r;
+  80164f:	83 c4 10             	add    $0x10,%esp
+  801652:	eb b5                	jmp    801609 <fd_close+0x3c>
+
+00801654 <close>:
+
+int
+close(int fdnum)
+{
+  801654:	55                   	push   %ebp
+  801655:	89 e5                	mov    %esp,%ebp
+  801657:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80165a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80165d:	50                   	push   %eax
+  80165e:	ff 75 08             	push   0x8(%ebp)
+  801661:	e8 cb fe ff ff       	call   801531 <fd_lookup>
+  801666:	83 c4 10             	add    $0x10,%esp
+  801669:	85 c0                	test   %eax,%eax
+  80166b:	79 02                	jns    80166f <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  80166d:	c9                   	leave
+  80166e:	c3                   	ret
+    return fd_close(fd, 1);
+  80166f:	83 ec 08             	sub    $0x8,%esp
+  801672:	6a 01                	push   $0x1
+  801674:	ff 75 f4             	push   -0xc(%ebp)
+  801677:	e8 51 ff ff ff       	call   8015cd <fd_close>
+  80167c:	83 c4 10             	add    $0x10,%esp
+  80167f:	eb ec                	jmp    80166d <close+0x19>
+
+00801681 <close_all>:
+
+void
+close_all(void)
+{
+  801681:	55                   	push   %ebp
+  801682:	89 e5                	mov    %esp,%ebp
+  801684:	53                   	push   %ebx
+  801685:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  801688:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  80168d:	83 ec 0c             	sub    $0xc,%esp
+  801690:	53                   	push   %ebx
+  801691:	e8 be ff ff ff       	call   801654 <close>
+  for (i = 0; i < MAXFD; i++)
+  801696:	83 c3 01             	add    $0x1,%ebx
+  801699:	83 c4 10             	add    $0x10,%esp
+  80169c:	83 fb 20             	cmp    $0x20,%ebx
+  80169f:	75 ec                	jne    80168d <close_all+0xc>
+}
+  8016a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8016a4:	c9                   	leave
+  8016a5:	c3                   	ret
+
+008016a6 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8016a6:	55                   	push   %ebp
+  8016a7:	89 e5                	mov    %esp,%ebp
+  8016a9:	57                   	push   %edi
+  8016aa:	56                   	push   %esi
+  8016ab:	53                   	push   %ebx
+  8016ac:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8016af:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8016b2:	50                   	push   %eax
+  8016b3:	ff 75 08             	push   0x8(%ebp)
+  8016b6:	e8 76 fe ff ff       	call   801531 <fd_lookup>
+  8016bb:	89 c6                	mov    %eax,%esi
+  8016bd:	83 c4 10             	add    $0x10,%esp
+  8016c0:	85 c0                	test   %eax,%eax
+  8016c2:	0f 88 0a 01 00 00    	js     8017d2 <dup+0x12c>
+    return r;
+  close(newfdnum);
+  8016c8:	83 ec 0c             	sub    $0xc,%esp
+  8016cb:	ff 75 0c             	push   0xc(%ebp)
+  8016ce:	e8 81 ff ff ff       	call   801654 <close>
+
+  newfd = INDEX2FD(newfdnum);
+  8016d3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8016d6:	c1 e0 0c             	shl    $0xc,%eax
+  8016d9:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  8016df:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  8016e2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8016e5:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  8016e8:	89 04 24             	mov    %eax,(%esp)
+  8016eb:	e8 d7 fd ff ff       	call   8014c7 <fd2data>
+  8016f0:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  8016f2:	89 3c 24             	mov    %edi,(%esp)
+  8016f5:	e8 cd fd ff ff       	call   8014c7 <fd2data>
+  8016fa:	83 c4 10             	add    $0x10,%esp
+  8016fd:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801700:	89 f3                	mov    %esi,%ebx
+  801702:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  801708:	89 c6                	mov    %eax,%esi
+  80170a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80170d:	89 cf                	mov    %ecx,%edi
+  80170f:	eb 0c                	jmp    80171d <dup+0x77>
+  801711:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801717:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80171d:	39 fb                	cmp    %edi,%ebx
+  80171f:	74 7b                	je     80179c <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  801721:	89 d8                	mov    %ebx,%eax
+  801723:	c1 e8 16             	shr    $0x16,%eax
+  801726:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  80172d:	a8 01                	test   $0x1,%al
+  80172f:	74 e0                	je     801711 <dup+0x6b>
+  801731:	89 d8                	mov    %ebx,%eax
+  801733:	c1 e8 0c             	shr    $0xc,%eax
+  801736:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  80173d:	f6 c2 01             	test   $0x1,%dl
+  801740:	74 cf                	je     801711 <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  801742:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  801749:	83 ec 0c             	sub    $0xc,%esp
+  80174c:	25 07 0e 00 00       	and    $0xe07,%eax
+  801751:	50                   	push   %eax
+  801752:	56                   	push   %esi
+  801753:	6a 00                	push   $0x0
+  801755:	53                   	push   %ebx
+  801756:	6a 00                	push   $0x0
+  801758:	e8 ba f4 ff ff       	call   800c17 <sys_page_map>
+  80175d:	83 c4 20             	add    $0x20,%esp
+  801760:	85 c0                	test   %eax,%eax
+  801762:	79 ad                	jns    801711 <dup+0x6b>
+  801764:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801767:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  801769:	83 ec 08             	sub    $0x8,%esp
+  80176c:	ff 75 d4             	push   -0x2c(%ebp)
+  80176f:	6a 00                	push   $0x0
+  801771:	e8 e3 f4 ff ff       	call   800c59 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801776:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  801779:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  80177f:	83 c4 10             	add    $0x10,%esp
+  801782:	39 df                	cmp    %ebx,%edi
+  801784:	74 4c                	je     8017d2 <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  801786:	83 ec 08             	sub    $0x8,%esp
+  801789:	57                   	push   %edi
+  80178a:	6a 00                	push   $0x0
+  80178c:	e8 c8 f4 ff ff       	call   800c59 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801791:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  801797:	83 c4 10             	add    $0x10,%esp
+  80179a:	eb e6                	jmp    801782 <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  80179c:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80179f:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8017a2:	89 c8                	mov    %ecx,%eax
+  8017a4:	c1 e8 0c             	shr    $0xc,%eax
+  8017a7:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8017ae:	83 ec 0c             	sub    $0xc,%esp
+  8017b1:	25 07 0e 00 00       	and    $0xe07,%eax
+  8017b6:	50                   	push   %eax
+  8017b7:	ff 75 d4             	push   -0x2c(%ebp)
+  8017ba:	6a 00                	push   $0x0
+  8017bc:	51                   	push   %ecx
+  8017bd:	6a 00                	push   $0x0
+  8017bf:	e8 53 f4 ff ff       	call   800c17 <sys_page_map>
+  8017c4:	89 c6                	mov    %eax,%esi
+  8017c6:	83 c4 20             	add    $0x20,%esp
+  8017c9:	85 c0                	test   %eax,%eax
+  8017cb:	78 9c                	js     801769 <dup+0xc3>
+  return newfdnum;
+  8017cd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8017d0:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  8017d2:	89 f0                	mov    %esi,%eax
+  8017d4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017d7:	5b                   	pop    %ebx
+  8017d8:	5e                   	pop    %esi
+  8017d9:	5f                   	pop    %edi
+  8017da:	5d                   	pop    %ebp
+  8017db:	c3                   	ret
+
+008017dc <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  8017dc:	55                   	push   %ebp
+  8017dd:	89 e5                	mov    %esp,%ebp
+  8017df:	56                   	push   %esi
+  8017e0:	53                   	push   %ebx
+  8017e1:	83 ec 18             	sub    $0x18,%esp
+  8017e4:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  8017e7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8017ea:	50                   	push   %eax
+  8017eb:	56                   	push   %esi
+  8017ec:	e8 40 fd ff ff       	call   801531 <fd_lookup>
+  8017f1:	83 c4 10             	add    $0x10,%esp
+  8017f4:	85 c0                	test   %eax,%eax
+  8017f6:	78 3c                	js     801834 <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8017f8:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8017fb:	83 ec 08             	sub    $0x8,%esp
+  8017fe:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801801:	50                   	push   %eax
+  801802:	ff 33                	push   (%ebx)
+  801804:	e8 78 fd ff ff       	call   801581 <dev_lookup>
+  801809:	83 c4 10             	add    $0x10,%esp
+  80180c:	85 c0                	test   %eax,%eax
+  80180e:	78 24                	js     801834 <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801810:	8b 43 08             	mov    0x8(%ebx),%eax
+  801813:	83 e0 03             	and    $0x3,%eax
+  801816:	83 f8 01             	cmp    $0x1,%eax
+  801819:	74 20                	je     80183b <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  80181b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80181e:	8b 40 08             	mov    0x8(%eax),%eax
+  801821:	85 c0                	test   %eax,%eax
+  801823:	74 37                	je     80185c <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  801825:	83 ec 04             	sub    $0x4,%esp
+  801828:	ff 75 10             	push   0x10(%ebp)
+  80182b:	ff 75 0c             	push   0xc(%ebp)
+  80182e:	53                   	push   %ebx
+  80182f:	ff d0                	call   *%eax
+  801831:	83 c4 10             	add    $0x10,%esp
+}
+  801834:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801837:	5b                   	pop    %ebx
+  801838:	5e                   	pop    %esi
+  801839:	5d                   	pop    %ebp
+  80183a:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80183b:	a1 a0 58 80 00       	mov    0x8058a0,%eax
+  801840:	8b 40 48             	mov    0x48(%eax),%eax
+  801843:	83 ec 04             	sub    $0x4,%esp
+  801846:	56                   	push   %esi
+  801847:	50                   	push   %eax
+  801848:	68 5d 3e 80 00       	push   $0x803e5d
+  80184d:	e8 65 e9 ff ff       	call   8001b7 <cprintf>
+    return -E_INVAL;
+  801852:	83 c4 10             	add    $0x10,%esp
+  801855:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80185a:	eb d8                	jmp    801834 <read+0x58>
+    return -E_NOT_SUPP;
+  80185c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801861:	eb d1                	jmp    801834 <read+0x58>
+
+00801863 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801863:	55                   	push   %ebp
+  801864:	89 e5                	mov    %esp,%ebp
+  801866:	57                   	push   %edi
+  801867:	56                   	push   %esi
+  801868:	53                   	push   %ebx
+  801869:	83 ec 0c             	sub    $0xc,%esp
+  80186c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80186f:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  801872:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801877:	eb 02                	jmp    80187b <readn+0x18>
+  801879:	01 c3                	add    %eax,%ebx
+  80187b:	39 f3                	cmp    %esi,%ebx
+  80187d:	73 21                	jae    8018a0 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  80187f:	83 ec 04             	sub    $0x4,%esp
+  801882:	89 f0                	mov    %esi,%eax
+  801884:	29 d8                	sub    %ebx,%eax
+  801886:	50                   	push   %eax
+  801887:	89 d8                	mov    %ebx,%eax
+  801889:	03 45 0c             	add    0xc(%ebp),%eax
+  80188c:	50                   	push   %eax
+  80188d:	57                   	push   %edi
+  80188e:	e8 49 ff ff ff       	call   8017dc <read>
+    if (m < 0)
+  801893:	83 c4 10             	add    $0x10,%esp
+  801896:	85 c0                	test   %eax,%eax
+  801898:	78 04                	js     80189e <readn+0x3b>
+      return m;
+    if (m == 0)
+  80189a:	75 dd                	jne    801879 <readn+0x16>
+  80189c:	eb 02                	jmp    8018a0 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  80189e:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  8018a0:	89 d8                	mov    %ebx,%eax
+  8018a2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8018a5:	5b                   	pop    %ebx
+  8018a6:	5e                   	pop    %esi
+  8018a7:	5f                   	pop    %edi
+  8018a8:	5d                   	pop    %ebp
+  8018a9:	c3                   	ret
+
+008018aa <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8018aa:	55                   	push   %ebp
+  8018ab:	89 e5                	mov    %esp,%ebp
+  8018ad:	56                   	push   %esi
+  8018ae:	53                   	push   %ebx
+  8018af:	83 ec 18             	sub    $0x18,%esp
+  8018b2:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  8018b5:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8018b8:	50                   	push   %eax
+  8018b9:	53                   	push   %ebx
+  8018ba:	e8 72 fc ff ff       	call   801531 <fd_lookup>
+  8018bf:	83 c4 10             	add    $0x10,%esp
+  8018c2:	85 c0                	test   %eax,%eax
+  8018c4:	78 37                	js     8018fd <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8018c6:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8018c9:	83 ec 08             	sub    $0x8,%esp
+  8018cc:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018cf:	50                   	push   %eax
+  8018d0:	ff 36                	push   (%esi)
+  8018d2:	e8 aa fc ff ff       	call   801581 <dev_lookup>
+  8018d7:	83 c4 10             	add    $0x10,%esp
+  8018da:	85 c0                	test   %eax,%eax
+  8018dc:	78 1f                	js     8018fd <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8018de:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8018e2:	74 20                	je     801904 <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  8018e4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018e7:	8b 40 0c             	mov    0xc(%eax),%eax
+  8018ea:	85 c0                	test   %eax,%eax
+  8018ec:	74 37                	je     801925 <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  8018ee:	83 ec 04             	sub    $0x4,%esp
+  8018f1:	ff 75 10             	push   0x10(%ebp)
+  8018f4:	ff 75 0c             	push   0xc(%ebp)
+  8018f7:	56                   	push   %esi
+  8018f8:	ff d0                	call   *%eax
+  8018fa:	83 c4 10             	add    $0x10,%esp
+}
+  8018fd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801900:	5b                   	pop    %ebx
+  801901:	5e                   	pop    %esi
+  801902:	5d                   	pop    %ebp
+  801903:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801904:	a1 a0 58 80 00       	mov    0x8058a0,%eax
+  801909:	8b 40 48             	mov    0x48(%eax),%eax
+  80190c:	83 ec 04             	sub    $0x4,%esp
+  80190f:	53                   	push   %ebx
+  801910:	50                   	push   %eax
+  801911:	68 79 3e 80 00       	push   $0x803e79
+  801916:	e8 9c e8 ff ff       	call   8001b7 <cprintf>
+    return -E_INVAL;
+  80191b:	83 c4 10             	add    $0x10,%esp
+  80191e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801923:	eb d8                	jmp    8018fd <write+0x53>
+    return -E_NOT_SUPP;
+  801925:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80192a:	eb d1                	jmp    8018fd <write+0x53>
+
+0080192c <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  80192c:	55                   	push   %ebp
+  80192d:	89 e5                	mov    %esp,%ebp
+  80192f:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801932:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801935:	50                   	push   %eax
+  801936:	ff 75 08             	push   0x8(%ebp)
+  801939:	e8 f3 fb ff ff       	call   801531 <fd_lookup>
+  80193e:	83 c4 10             	add    $0x10,%esp
+  801941:	85 c0                	test   %eax,%eax
+  801943:	78 0e                	js     801953 <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  801945:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801948:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80194b:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  80194e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801953:	c9                   	leave
+  801954:	c3                   	ret
+
+00801955 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801955:	55                   	push   %ebp
+  801956:	89 e5                	mov    %esp,%ebp
+  801958:	56                   	push   %esi
+  801959:	53                   	push   %ebx
+  80195a:	83 ec 18             	sub    $0x18,%esp
+  80195d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801960:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801963:	50                   	push   %eax
+  801964:	53                   	push   %ebx
+  801965:	e8 c7 fb ff ff       	call   801531 <fd_lookup>
+  80196a:	83 c4 10             	add    $0x10,%esp
+  80196d:	85 c0                	test   %eax,%eax
+  80196f:	78 34                	js     8019a5 <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801971:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801974:	83 ec 08             	sub    $0x8,%esp
+  801977:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80197a:	50                   	push   %eax
+  80197b:	ff 36                	push   (%esi)
+  80197d:	e8 ff fb ff ff       	call   801581 <dev_lookup>
+  801982:	83 c4 10             	add    $0x10,%esp
+  801985:	85 c0                	test   %eax,%eax
+  801987:	78 1c                	js     8019a5 <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801989:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80198d:	74 1d                	je     8019ac <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  80198f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801992:	8b 40 18             	mov    0x18(%eax),%eax
+  801995:	85 c0                	test   %eax,%eax
+  801997:	74 34                	je     8019cd <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  801999:	83 ec 08             	sub    $0x8,%esp
+  80199c:	ff 75 0c             	push   0xc(%ebp)
+  80199f:	56                   	push   %esi
+  8019a0:	ff d0                	call   *%eax
+  8019a2:	83 c4 10             	add    $0x10,%esp
+}
+  8019a5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8019a8:	5b                   	pop    %ebx
+  8019a9:	5e                   	pop    %esi
+  8019aa:	5d                   	pop    %ebp
+  8019ab:	c3                   	ret
+            thisenv->env_id, fdnum);
+  8019ac:	a1 a0 58 80 00       	mov    0x8058a0,%eax
+  8019b1:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8019b4:	83 ec 04             	sub    $0x4,%esp
+  8019b7:	53                   	push   %ebx
+  8019b8:	50                   	push   %eax
+  8019b9:	68 3c 3e 80 00       	push   $0x803e3c
+  8019be:	e8 f4 e7 ff ff       	call   8001b7 <cprintf>
+    return -E_INVAL;
+  8019c3:	83 c4 10             	add    $0x10,%esp
+  8019c6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019cb:	eb d8                	jmp    8019a5 <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  8019cd:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8019d2:	eb d1                	jmp    8019a5 <ftruncate+0x50>
+
+008019d4 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  8019d4:	55                   	push   %ebp
+  8019d5:	89 e5                	mov    %esp,%ebp
+  8019d7:	56                   	push   %esi
+  8019d8:	53                   	push   %ebx
+  8019d9:	83 ec 18             	sub    $0x18,%esp
+  8019dc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  8019df:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8019e2:	50                   	push   %eax
+  8019e3:	ff 75 08             	push   0x8(%ebp)
+  8019e6:	e8 46 fb ff ff       	call   801531 <fd_lookup>
+  8019eb:	83 c4 10             	add    $0x10,%esp
+  8019ee:	85 c0                	test   %eax,%eax
+  8019f0:	78 49                	js     801a3b <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8019f2:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8019f5:	83 ec 08             	sub    $0x8,%esp
+  8019f8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019fb:	50                   	push   %eax
+  8019fc:	ff 36                	push   (%esi)
+  8019fe:	e8 7e fb ff ff       	call   801581 <dev_lookup>
+  801a03:	83 c4 10             	add    $0x10,%esp
+  801a06:	85 c0                	test   %eax,%eax
+  801a08:	78 31                	js     801a3b <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  801a0a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a0d:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801a11:	74 2f                	je     801a42 <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  801a13:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  801a16:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801a1d:	00 00 00 
+  stat->st_isdir = 0;
+  801a20:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801a27:	00 00 00 
+  stat->st_dev = dev;
+  801a2a:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  801a30:	83 ec 08             	sub    $0x8,%esp
+  801a33:	53                   	push   %ebx
+  801a34:	56                   	push   %esi
+  801a35:	ff 50 14             	call   *0x14(%eax)
+  801a38:	83 c4 10             	add    $0x10,%esp
+}
+  801a3b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a3e:	5b                   	pop    %ebx
+  801a3f:	5e                   	pop    %esi
+  801a40:	5d                   	pop    %ebp
+  801a41:	c3                   	ret
+    return -E_NOT_SUPP;
+  801a42:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a47:	eb f2                	jmp    801a3b <fstat+0x67>
+
+00801a49 <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  801a49:	55                   	push   %ebp
+  801a4a:	89 e5                	mov    %esp,%ebp
+  801a4c:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  801a4f:	ff 75 0c             	push   0xc(%ebp)
+  801a52:	ff 75 08             	push   0x8(%ebp)
+  801a55:	e8 58 07 00 00       	call   8021b2 <file_stat>
+}
+  801a5a:	c9                   	leave
+  801a5b:	c3                   	ret
+
+00801a5c <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  801a5c:	55                   	push   %ebp
+  801a5d:	89 e5                	mov    %esp,%ebp
+  801a5f:	57                   	push   %edi
+  801a60:	56                   	push   %esi
+  801a61:	53                   	push   %ebx
+  801a62:	83 ec 1c             	sub    $0x1c,%esp
+  801a65:	89 c7                	mov    %eax,%edi
+  801a67:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801a6a:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801a6d:	e9 a2 00 00 00       	jmp    801b14 <fsipc_send+0xb8>
+  nfsenvs = 0;
+  801a72:	c7 05 00 50 80 00 00 	movl   $0x0,0x805000
+  801a79:	00 00 00 
+  801a7c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a81:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801a86:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801a8b:	be 01 00 00 00       	mov    $0x1,%esi
+  801a90:	eb 0f                	jmp    801aa1 <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801a92:	83 c0 01             	add    $0x1,%eax
+  801a95:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801a9a:	74 49                	je     801ae5 <fsipc_send+0x89>
+  801a9c:	83 f9 07             	cmp    $0x7,%ecx
+  801a9f:	7f 50                	jg     801af1 <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  801aa1:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801aa4:	c1 e2 04             	shl    $0x4,%edx
+  801aa7:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801aad:	8b 52 50             	mov    0x50(%edx),%edx
+  801ab0:	83 fa 01             	cmp    $0x1,%edx
+  801ab3:	75 dd                	jne    801a92 <fsipc_send+0x36>
+  801ab5:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801ab8:	c1 e2 04             	shl    $0x4,%edx
+  801abb:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801ac1:	8b 52 54             	mov    0x54(%edx),%edx
+  801ac4:	85 d2                	test   %edx,%edx
+  801ac6:	74 ca                	je     801a92 <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801ac8:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801acb:	c1 e2 04             	shl    $0x4,%edx
+  801ace:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801ad4:	8b 52 48             	mov    0x48(%edx),%edx
+  801ad7:	89 14 8d 20 50 80 00 	mov    %edx,0x805020(,%ecx,4)
+  801ade:	8d 49 01             	lea    0x1(%ecx),%ecx
+  801ae1:	89 f3                	mov    %esi,%ebx
+  801ae3:	eb ad                	jmp    801a92 <fsipc_send+0x36>
+  801ae5:	84 db                	test   %bl,%bl
+  801ae7:	74 38                	je     801b21 <fsipc_send+0xc5>
+  801ae9:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  801aef:	eb 30                	jmp    801b21 <fsipc_send+0xc5>
+  801af1:	84 db                	test   %bl,%bl
+  801af3:	74 2c                	je     801b21 <fsipc_send+0xc5>
+  801af5:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  801afb:	eb 24                	jmp    801b21 <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  801afd:	50                   	push   %eax
+  801afe:	68 a8 3e 80 00       	push   $0x803ea8
+  801b03:	6a 34                	push   $0x34
+  801b05:	68 b2 3e 80 00       	push   $0x803eb2
+  801b0a:	e8 cd 19 00 00       	call   8034dc <_panic>
+    }
+    sys_yield();
+  801b0f:	e8 5e f0 ff ff       	call   800b72 <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  801b14:	83 3d 00 50 80 00 03 	cmpl   $0x3,0x805000
+  801b1b:	0f 8e 51 ff ff ff    	jle    801a72 <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  801b21:	a1 a0 58 80 00       	mov    0x8058a0,%eax
+  801b26:	8b 70 48             	mov    0x48(%eax),%esi
+  801b29:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  801b2f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b34:	8b 0d 00 50 80 00    	mov    0x805000,%ecx
+  801b3a:	39 d9                	cmp    %ebx,%ecx
+  801b3c:	7e d1                	jle    801b0f <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  801b3e:	83 ec 0c             	sub    $0xc,%esp
+  801b41:	ff 75 e0             	push   -0x20(%ebp)
+  801b44:	6a 07                	push   $0x7
+  801b46:	ff 75 e4             	push   -0x1c(%ebp)
+  801b49:	57                   	push   %edi
+  801b4a:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  801b4d:	99                   	cltd
+  801b4e:	f7 f9                	idiv   %ecx
+  801b50:	ff 34 95 20 50 80 00 	push   0x805020(,%edx,4)
+  801b57:	e8 2f f3 ff ff       	call   800e8b <sys_ipc_try_send>
+      if (r == 0)
+  801b5c:	83 c4 20             	add    $0x20,%esp
+  801b5f:	85 c0                	test   %eax,%eax
+  801b61:	74 0a                	je     801b6d <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  801b63:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801b66:	75 95                	jne    801afd <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  801b68:	83 c3 01             	add    $0x1,%ebx
+  801b6b:	eb c7                	jmp    801b34 <fsipc_send+0xd8>
+  }
+}
+  801b6d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b70:	5b                   	pop    %ebx
+  801b71:	5e                   	pop    %esi
+  801b72:	5f                   	pop    %edi
+  801b73:	5d                   	pop    %ebp
+  801b74:	c3                   	ret
+
+00801b75 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801b75:	55                   	push   %ebp
+  801b76:	89 e5                	mov    %esp,%ebp
+  801b78:	53                   	push   %ebx
+  801b79:	83 ec 14             	sub    $0x14,%esp
+  801b7c:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  801b7e:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  801b85:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801b8a:	ba 00 60 80 00       	mov    $0x806000,%edx
+  801b8f:	e8 c8 fe ff ff       	call   801a5c <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801b94:	6a 00                	push   $0x0
+  801b96:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b99:	50                   	push   %eax
+  801b9a:	53                   	push   %ebx
+  801b9b:	6a 00                	push   $0x0
+  801b9d:	e8 ed 19 00 00       	call   80358f <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  801ba2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ba5:	c9                   	leave
+  801ba6:	c3                   	ret
+
+00801ba7 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801ba7:	55                   	push   %ebp
+  801ba8:	89 e5                	mov    %esp,%ebp
+  801baa:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801bad:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bb0:	8b 40 0c             	mov    0xc(%eax),%eax
+  801bb3:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.set_size.req_size = newsize;
+  801bb8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801bbb:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801bc0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bc5:	b8 02 00 00 00       	mov    $0x2,%eax
+  801bca:	e8 a6 ff ff ff       	call   801b75 <fsipc>
+}
+  801bcf:	c9                   	leave
+  801bd0:	c3                   	ret
+
+00801bd1 <devfile_flush>:
+{
+  801bd1:	55                   	push   %ebp
+  801bd2:	89 e5                	mov    %esp,%ebp
+  801bd4:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801bd7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bda:	8b 40 0c             	mov    0xc(%eax),%eax
+  801bdd:	a3 00 60 80 00       	mov    %eax,0x806000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801be2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801be7:	b8 06 00 00 00       	mov    $0x6,%eax
+  801bec:	e8 84 ff ff ff       	call   801b75 <fsipc>
+}
+  801bf1:	c9                   	leave
+  801bf2:	c3                   	ret
+
+00801bf3 <devfile_stat>:
+{
+  801bf3:	55                   	push   %ebp
+  801bf4:	89 e5                	mov    %esp,%ebp
+  801bf6:	53                   	push   %ebx
+  801bf7:	83 ec 04             	sub    $0x4,%esp
+  801bfa:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801bfd:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c00:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c03:	a3 00 60 80 00       	mov    %eax,0x806000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801c08:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c0d:	b8 05 00 00 00       	mov    $0x5,%eax
+  801c12:	e8 5e ff ff ff       	call   801b75 <fsipc>
+  801c17:	85 c0                	test   %eax,%eax
+  801c19:	78 2c                	js     801c47 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801c1b:	83 ec 08             	sub    $0x8,%esp
+  801c1e:	68 00 60 80 00       	push   $0x806000
+  801c23:	53                   	push   %ebx
+  801c24:	e8 7c eb ff ff       	call   8007a5 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  801c29:	a1 80 60 80 00       	mov    0x806080,%eax
+  801c2e:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801c34:	a1 84 60 80 00       	mov    0x806084,%eax
+  801c39:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801c3f:	83 c4 10             	add    $0x10,%esp
+  801c42:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c47:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c4a:	c9                   	leave
+  801c4b:	c3                   	ret
+
+00801c4c <fsv_alloc>:
+{
+  801c4c:	55                   	push   %ebp
+  801c4d:	89 e5                	mov    %esp,%ebp
+  801c4f:	56                   	push   %esi
+  801c50:	53                   	push   %ebx
+  801c51:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  801c53:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c58:	eb 22                	jmp    801c7c <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  801c5a:	83 ec 04             	sub    $0x4,%esp
+  801c5d:	6a 00                	push   $0x0
+  801c5f:	6a 00                	push   $0x0
+  801c61:	6a 07                	push   $0x7
+  801c63:	50                   	push   %eax
+  801c64:	6a 00                	push   $0x0
+  801c66:	6a 04                	push   $0x4
+  801c68:	68 40 50 80 00       	push   $0x805040
+  801c6d:	e8 b5 f3 ff ff       	call   801027 <sysbatch_add>
+  801c72:	83 c4 20             	add    $0x20,%esp
+  801c75:	85 c0                	test   %eax,%eax
+  801c77:	78 48                	js     801cc1 <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  801c79:	83 c3 01             	add    $0x1,%ebx
+  801c7c:	39 f3                	cmp    %esi,%ebx
+  801c7e:	74 31                	je     801cb1 <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  801c80:	89 d8                	mov    %ebx,%eax
+  801c82:	c1 e0 0c             	shl    $0xc,%eax
+  801c85:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801c8a:	89 c2                	mov    %eax,%edx
+  801c8c:	c1 ea 16             	shr    $0x16,%edx
+  801c8f:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801c96:	f6 c2 01             	test   $0x1,%dl
+  801c99:	74 bf                	je     801c5a <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  801c9b:	89 c2                	mov    %eax,%edx
+  801c9d:	c1 ea 0c             	shr    $0xc,%edx
+  801ca0:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801ca7:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801caa:	83 fa 03             	cmp    $0x3,%edx
+  801cad:	75 ab                	jne    801c5a <fsv_alloc+0xe>
+  801caf:	eb c8                	jmp    801c79 <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  801cb1:	83 ec 0c             	sub    $0xc,%esp
+  801cb4:	68 40 50 80 00       	push   $0x805040
+  801cb9:	e8 19 f3 ff ff       	call   800fd7 <sysbatch_flush>
+  801cbe:	83 c4 10             	add    $0x10,%esp
+}
+  801cc1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cc4:	5b                   	pop    %ebx
+  801cc5:	5e                   	pop    %esi
+  801cc6:	5d                   	pop    %ebp
+  801cc7:	c3                   	ret
+
+00801cc8 <devfile_read>:
+{
+  801cc8:	55                   	push   %ebp
+  801cc9:	89 e5                	mov    %esp,%ebp
+  801ccb:	57                   	push   %edi
+  801ccc:	56                   	push   %esi
+  801ccd:	53                   	push   %ebx
+  801cce:	83 ec 3c             	sub    $0x3c,%esp
+  801cd1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  801cd4:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  801cda:	77 57                	ja     801d33 <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801cdc:	8b 45 08             	mov    0x8(%ebp),%eax
+  801cdf:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ce2:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read.req_n = n;
+  801ce7:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801ced:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cf2:	b8 03 00 00 00       	mov    $0x3,%eax
+  801cf7:	e8 79 fe ff ff       	call   801b75 <fsipc>
+  801cfc:	89 c6                	mov    %eax,%esi
+  801cfe:	85 c0                	test   %eax,%eax
+  801d00:	78 27                	js     801d29 <devfile_read+0x61>
+  assert(r <= n);
+  801d02:	39 c3                	cmp    %eax,%ebx
+  801d04:	0f 82 0e 02 00 00    	jb     801f18 <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  801d0a:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801d0f:	0f 8f 1c 02 00 00    	jg     801f31 <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801d15:	83 ec 04             	sub    $0x4,%esp
+  801d18:	50                   	push   %eax
+  801d19:	68 00 60 80 00       	push   $0x806000
+  801d1e:	ff 75 0c             	push   0xc(%ebp)
+  801d21:	e8 05 ec ff ff       	call   80092b <memmove>
+  return r;
+  801d26:	83 c4 10             	add    $0x10,%esp
+}
+  801d29:	89 f0                	mov    %esi,%eax
+  801d2b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801d2e:	5b                   	pop    %ebx
+  801d2f:	5e                   	pop    %esi
+  801d30:	5f                   	pop    %edi
+  801d31:	5d                   	pop    %ebp
+  801d32:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  801d33:	b8 01 00 00 00       	mov    $0x1,%eax
+  801d38:	e8 0f ff ff ff       	call   801c4c <fsv_alloc>
+  801d3d:	89 c6                	mov    %eax,%esi
+  801d3f:	85 c0                	test   %eax,%eax
+  801d41:	78 e6                	js     801d29 <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  801d43:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d46:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d49:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  801d4e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d51:	8b 40 04             	mov    0x4(%eax),%eax
+  801d54:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  801d59:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  801d5f:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801d66:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801d6b:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801d70:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801d75:	e8 e2 fc ff ff       	call   801a5c <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801d7a:	6a 00                	push   $0x0
+  801d7c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801d7f:	50                   	push   %eax
+  801d80:	68 00 10 c0 9f       	push   $0x9fc01000
+  801d85:	6a 00                	push   $0x0
+  801d87:	e8 03 18 00 00       	call   80358f <ipc_recv_pages>
+  801d8c:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  801d8e:	83 c4 10             	add    $0x10,%esp
+  801d91:	85 c0                	test   %eax,%eax
+  801d93:	7e 94                	jle    801d29 <devfile_read+0x61>
+  assert(r <= n);
+  801d95:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801d98:	39 c3                	cmp    %eax,%ebx
+  801d9a:	72 2e                	jb     801dca <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801d9c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d9f:	8b 40 04             	mov    0x4(%eax),%eax
+  801da2:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801da7:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  801daa:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801dad:	c1 e2 0c             	shl    $0xc,%edx
+  801db0:	39 ca                	cmp    %ecx,%edx
+  801db2:	72 2f                	jb     801de3 <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  801db4:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  801db9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  801dbc:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  801dc0:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801dc5:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  801dc8:	eb 52                	jmp    801e1c <devfile_read+0x154>
+  assert(r <= n);
+  801dca:	68 bd 3e 80 00       	push   $0x803ebd
+  801dcf:	68 c4 3e 80 00       	push   $0x803ec4
+  801dd4:	68 49 01 00 00       	push   $0x149
+  801dd9:	68 b2 3e 80 00       	push   $0x803eb2
+  801dde:	e8 f9 16 00 00       	call   8034dc <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801de3:	68 e8 3e 80 00       	push   $0x803ee8
+  801de8:	68 c4 3e 80 00       	push   $0x803ec4
+  801ded:	68 4a 01 00 00       	push   $0x14a
+  801df2:	68 b2 3e 80 00       	push   $0x803eb2
+  801df7:	e8 e0 16 00 00       	call   8034dc <_panic>
+      memmove(dst + done, src + done, m);
+  801dfc:	83 ec 04             	sub    $0x4,%esp
+  801dff:	53                   	push   %ebx
+  801e00:	56                   	push   %esi
+  801e01:	89 f8                	mov    %edi,%eax
+  801e03:	03 45 0c             	add    0xc(%ebp),%eax
+  801e06:	50                   	push   %eax
+  801e07:	e8 1f eb ff ff       	call   80092b <memmove>
+  801e0c:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  801e0f:	01 df                	add    %ebx,%edi
+  801e11:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801e14:	39 c7                	cmp    %eax,%edi
+  801e16:	0f 83 c0 00 00 00    	jae    801edc <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801e1c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801e1f:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  801e22:	89 f0                	mov    %esi,%eax
+  801e24:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801e29:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  801e2e:	29 c3                	sub    %eax,%ebx
+  801e30:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801e33:	29 f8                	sub    %edi,%eax
+  801e35:	39 c3                	cmp    %eax,%ebx
+  801e37:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  801e3a:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801e40:	75 ba                	jne    801dfc <devfile_read+0x134>
+  801e42:	89 f9                	mov    %edi,%ecx
+  801e44:	03 4d 0c             	add    0xc(%ebp),%ecx
+  801e47:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  801e4a:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  801e50:	75 aa                	jne    801dfc <devfile_read+0x134>
+  801e52:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  801e58:	77 a2                	ja     801dfc <devfile_read+0x134>
+  801e5a:	89 c8                	mov    %ecx,%eax
+  801e5c:	c1 e8 16             	shr    $0x16,%eax
+  801e5f:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801e66:	a8 01                	test   $0x1,%al
+  801e68:	74 92                	je     801dfc <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  801e6a:	89 c8                	mov    %ecx,%eax
+  801e6c:	c1 e8 0c             	shr    $0xc,%eax
+  801e6f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  801e76:	a8 01                	test   $0x1,%al
+  801e78:	74 82                	je     801dfc <devfile_read+0x134>
+  801e7a:	a9 02 08 00 00       	test   $0x802,%eax
+  801e7f:	0f 84 77 ff ff ff    	je     801dfc <devfile_read+0x134>
+  801e85:	f6 c4 04             	test   $0x4,%ah
+  801e88:	0f 85 6e ff ff ff    	jne    801dfc <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  801e8e:	a1 a0 58 80 00       	mov    0x8058a0,%eax
+  801e93:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  801e97:	84 c0                	test   %al,%al
+  801e99:	75 17                	jne    801eb2 <devfile_read+0x1ea>
+  801e9b:	83 ec 08             	sub    $0x8,%esp
+  801e9e:	6a 01                	push   $0x1
+  801ea0:	6a 00                	push   $0x0
+  801ea2:	e8 ea ec ff ff       	call   800b91 <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  801ea7:	83 c4 10             	add    $0x10,%esp
+  801eaa:	85 c0                	test   %eax,%eax
+  801eac:	0f 85 4a ff ff ff    	jne    801dfc <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  801eb2:	83 ec 04             	sub    $0x4,%esp
+  801eb5:	68 05 08 00 00       	push   $0x805
+  801eba:	ff 75 cc             	push   -0x34(%ebp)
+  801ebd:	6a 00                	push   $0x0
+  801ebf:	56                   	push   %esi
+  801ec0:	6a 00                	push   $0x0
+  801ec2:	6a 05                	push   $0x5
+  801ec4:	68 40 50 80 00       	push   $0x805040
+  801ec9:	e8 59 f1 ff ff       	call   801027 <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  801ece:	c1 e8 1f             	shr    $0x1f,%eax
+  801ed1:	08 45 cb             	or     %al,-0x35(%ebp)
+  801ed4:	83 c4 20             	add    $0x20,%esp
+  801ed7:	e9 33 ff ff ff       	jmp    801e0f <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  801edc:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  801edf:	83 ec 0c             	sub    $0xc,%esp
+  801ee2:	68 40 50 80 00       	push   $0x805040
+  801ee7:	e8 eb f0 ff ff       	call   800fd7 <sysbatch_flush>
+  801eec:	83 c4 10             	add    $0x10,%esp
+  801eef:	85 c0                	test   %eax,%eax
+  801ef1:	78 06                	js     801ef9 <devfile_read+0x231>
+  801ef3:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  801ef7:	74 14                	je     801f0d <devfile_read+0x245>
+    memmove(dst, src, r);
+  801ef9:	83 ec 04             	sub    $0x4,%esp
+  801efc:	ff 75 d4             	push   -0x2c(%ebp)
+  801eff:	ff 75 d0             	push   -0x30(%ebp)
+  801f02:	ff 75 0c             	push   0xc(%ebp)
+  801f05:	e8 21 ea ff ff       	call   80092b <memmove>
+  801f0a:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  801f0d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f10:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  801f13:	e9 11 fe ff ff       	jmp    801d29 <devfile_read+0x61>
+  assert(r <= n);
+  801f18:	68 bd 3e 80 00       	push   $0x803ebd
+  801f1d:	68 c4 3e 80 00       	push   $0x803ec4
+  801f22:	68 1c 01 00 00       	push   $0x11c
+  801f27:	68 b2 3e 80 00       	push   $0x803eb2
+  801f2c:	e8 ab 15 00 00       	call   8034dc <_panic>
+  assert(r <= PGSIZE);
+  801f31:	68 d9 3e 80 00       	push   $0x803ed9
+  801f36:	68 c4 3e 80 00       	push   $0x803ec4
+  801f3b:	68 1d 01 00 00       	push   $0x11d
+  801f40:	68 b2 3e 80 00       	push   $0x803eb2
+  801f45:	e8 92 15 00 00       	call   8034dc <_panic>
+
+00801f4a <devfile_write>:
+{
+  801f4a:	55                   	push   %ebp
+  801f4b:	89 e5                	mov    %esp,%ebp
+  801f4d:	57                   	push   %edi
+  801f4e:	56                   	push   %esi
+  801f4f:	53                   	push   %ebx
+  801f50:	83 ec 1c             	sub    $0x1c,%esp
+  801f53:	8b 75 08             	mov    0x8(%ebp),%esi
+  801f56:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  801f59:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  801f5e:	77 39                	ja     801f99 <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801f60:	8b 56 0c             	mov    0xc(%esi),%edx
+  801f63:	89 15 00 60 80 00    	mov    %edx,0x806000
+  fsipcbuf.write.req_n = n;
+  801f69:	a3 04 60 80 00       	mov    %eax,0x806004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  801f6e:	83 ec 04             	sub    $0x4,%esp
+  801f71:	50                   	push   %eax
+  801f72:	ff 75 0c             	push   0xc(%ebp)
+  801f75:	68 08 60 80 00       	push   $0x806008
+  801f7a:	e8 ac e9 ff ff       	call   80092b <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801f7f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f84:	b8 04 00 00 00       	mov    $0x4,%eax
+  801f89:	e8 e7 fb ff ff       	call   801b75 <fsipc>
+  801f8e:	83 c4 10             	add    $0x10,%esp
+}
+  801f91:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f94:	5b                   	pop    %ebx
+  801f95:	5e                   	pop    %esi
+  801f96:	5f                   	pop    %edi
+  801f97:	5d                   	pop    %ebp
+  801f98:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  801f99:	ba 00 00 10 00       	mov    $0x100000,%edx
+  801f9e:	39 d0                	cmp    %edx,%eax
+  801fa0:	89 d3                	mov    %edx,%ebx
+  801fa2:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  801fa5:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  801fab:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  801fae:	83 c7 01             	add    $0x1,%edi
+  801fb1:	89 f8                	mov    %edi,%eax
+  801fb3:	e8 94 fc ff ff       	call   801c4c <fsv_alloc>
+  801fb8:	85 c0                	test   %eax,%eax
+  801fba:	78 d5                	js     801f91 <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  801fbc:	83 ec 04             	sub    $0x4,%esp
+  801fbf:	53                   	push   %ebx
+  801fc0:	ff 75 0c             	push   0xc(%ebp)
+  801fc3:	68 00 10 c0 9f       	push   $0x9fc01000
+  801fc8:	e8 5e e9 ff ff       	call   80092b <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  801fcd:	8b 46 0c             	mov    0xc(%esi),%eax
+  801fd0:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  801fd5:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  801fdb:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801fe2:	89 f9                	mov    %edi,%ecx
+  801fe4:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801fe9:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801fee:	e8 69 fa ff ff       	call   801a5c <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801ff3:	6a 00                	push   $0x0
+  801ff5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801ff8:	50                   	push   %eax
+  801ff9:	6a 00                	push   $0x0
+  801ffb:	6a 00                	push   $0x0
+  801ffd:	e8 8d 15 00 00       	call   80358f <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  802002:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  802005:	eb 8a                	jmp    801f91 <devfile_write+0x47>
+
+00802007 <open>:
+{
+  802007:	55                   	push   %ebp
+  802008:	89 e5                	mov    %esp,%ebp
+  80200a:	56                   	push   %esi
+  80200b:	53                   	push   %ebx
+  80200c:	83 ec 1c             	sub    $0x1c,%esp
+  80200f:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  802012:	56                   	push   %esi
+  802013:	e8 52 e7 ff ff       	call   80076a <strlen>
+  802018:	83 c4 10             	add    $0x10,%esp
+  80201b:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802020:	7f 6c                	jg     80208e <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  802022:	83 ec 0c             	sub    $0xc,%esp
+  802025:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802028:	50                   	push   %eax
+  802029:	e8 ad f4 ff ff       	call   8014db <fd_alloc>
+  80202e:	89 c3                	mov    %eax,%ebx
+  802030:	83 c4 10             	add    $0x10,%esp
+  802033:	85 c0                	test   %eax,%eax
+  802035:	78 3c                	js     802073 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  802037:	83 ec 08             	sub    $0x8,%esp
+  80203a:	56                   	push   %esi
+  80203b:	68 00 60 80 00       	push   $0x806000
+  802040:	e8 60 e7 ff ff       	call   8007a5 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  802045:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802048:	a3 00 64 80 00       	mov    %eax,0x806400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80204d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  802050:	b8 01 00 00 00       	mov    $0x1,%eax
+  802055:	e8 1b fb ff ff       	call   801b75 <fsipc>
+  80205a:	89 c3                	mov    %eax,%ebx
+  80205c:	83 c4 10             	add    $0x10,%esp
+  80205f:	85 c0                	test   %eax,%eax
+  802061:	78 19                	js     80207c <open+0x75>
+  return fd2num(fd);
+  802063:	83 ec 0c             	sub    $0xc,%esp
+  802066:	ff 75 f4             	push   -0xc(%ebp)
+  802069:	e8 49 f4 ff ff       	call   8014b7 <fd2num>
+  80206e:	89 c3                	mov    %eax,%ebx
+  802070:	83 c4 10             	add    $0x10,%esp
+}
+  802073:	89 d8                	mov    %ebx,%eax
+  802075:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802078:	5b                   	pop    %ebx
+  802079:	5e                   	pop    %esi
+  80207a:	5d                   	pop    %ebp
+  80207b:	c3                   	ret
+    fd_close(fd, 0);
+  80207c:	83 ec 08             	sub    $0x8,%esp
+  80207f:	6a 00                	push   $0x0
+  802081:	ff 75 f4             	push   -0xc(%ebp)
+  802084:	e8 44 f5 ff ff       	call   8015cd <fd_close>
+    return r;
+  802089:	83 c4 10             	add    $0x10,%esp
+  80208c:	eb e5                	jmp    802073 <open+0x6c>
+    return -E_BAD_PATH;
+  80208e:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802093:	eb de                	jmp    802073 <open+0x6c>
+
+00802095 <open_read>:
+{
+  802095:	55                   	push   %ebp
+  802096:	89 e5                	mov    %esp,%ebp
+  802098:	57                   	push   %edi
+  802099:	56                   	push   %esi
+  80209a:	53                   	push   %ebx
+  80209b:	83 ec 28             	sub    $0x28,%esp
+  80209e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  8020a1:	57                   	push   %edi
+  8020a2:	e8 c3 e6 ff ff       	call   80076a <strlen>
+  8020a7:	83 c4 10             	add    $0x10,%esp
+  8020aa:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8020af:	0f 87 f6 00 00 00    	ja     8021ab <open_read+0x116>
+  8020b5:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  8020b7:	83 ec 0c             	sub    $0xc,%esp
+  8020ba:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8020bd:	50                   	push   %eax
+  8020be:	e8 18 f4 ff ff       	call   8014db <fd_alloc>
+  8020c3:	89 c3                	mov    %eax,%ebx
+  8020c5:	83 c4 10             	add    $0x10,%esp
+  8020c8:	85 c0                	test   %eax,%eax
+  8020ca:	0f 88 b2 00 00 00    	js     802182 <open_read+0xed>
+  strcpy(req->req_buf, path);
+  8020d0:	83 ec 08             	sub    $0x8,%esp
+  8020d3:	57                   	push   %edi
+  8020d4:	68 e4 60 80 00       	push   $0x8060e4
+  8020d9:	e8 c7 e6 ff ff       	call   8007a5 <strcpy>
+  req->req_nops = 2;
+  8020de:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  8020e5:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  8020e8:	c7 05 04 60 80 00 01 	movl   $0x1,0x806004
+  8020ef:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  8020f2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020f5:	a3 10 60 80 00       	mov    %eax,0x806010
+  req->req_ops[0].op_buf = 0;
+  8020fa:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  802101:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  802104:	c7 05 20 60 80 00 04 	movl   $0x4,0x806020
+  80210b:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  80210e:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  802115:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  802118:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  80211d:	29 f0                	sub    %esi,%eax
+  80211f:	3b 45 14             	cmp    0x14(%ebp),%eax
+  802122:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  802126:	a3 2c 60 80 00       	mov    %eax,0x80602c
+  req->req_ops[1].op_offset = 0;
+  80212b:	c7 05 30 60 80 00 00 	movl   $0x0,0x806030
+  802132:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  802135:	83 c6 01             	add    $0x1,%esi
+  802138:	89 35 34 60 80 00    	mov    %esi,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  80213e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802141:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802146:	e8 2a fa ff ff       	call   801b75 <fsipc>
+  80214b:	89 c3                	mov    %eax,%ebx
+  80214d:	83 c4 10             	add    $0x10,%esp
+  802150:	83 f8 01             	cmp    $0x1,%eax
+  802153:	7e 37                	jle    80218c <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  802155:	a1 38 60 80 00       	mov    0x806038,%eax
+  80215a:	8b 55 18             	mov    0x18(%ebp),%edx
+  80215d:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  80215f:	83 ec 04             	sub    $0x4,%esp
+  802162:	50                   	push   %eax
+  802163:	81 c6 e4 60 80 00    	add    $0x8060e4,%esi
+  802169:	56                   	push   %esi
+  80216a:	ff 75 10             	push   0x10(%ebp)
+  80216d:	e8 b9 e7 ff ff       	call   80092b <memmove>
+  return fd2num(fd);
+  802172:	83 c4 04             	add    $0x4,%esp
+  802175:	ff 75 e4             	push   -0x1c(%ebp)
+  802178:	e8 3a f3 ff ff       	call   8014b7 <fd2num>
+  80217d:	89 c3                	mov    %eax,%ebx
+  80217f:	83 c4 10             	add    $0x10,%esp
+}
+  802182:	89 d8                	mov    %ebx,%eax
+  802184:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802187:	5b                   	pop    %ebx
+  802188:	5e                   	pop    %esi
+  802189:	5f                   	pop    %edi
+  80218a:	5d                   	pop    %ebp
+  80218b:	c3                   	ret
+    fd_close(fd, 0);
+  80218c:	83 ec 08             	sub    $0x8,%esp
+  80218f:	6a 00                	push   $0x0
+  802191:	ff 75 e4             	push   -0x1c(%ebp)
+  802194:	e8 34 f4 ff ff       	call   8015cd <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  802199:	83 c4 10             	add    $0x10,%esp
+  80219c:	85 db                	test   %ebx,%ebx
+  80219e:	78 e2                	js     802182 <open_read+0xed>
+  8021a0:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  8021a3:	8b 9b 1c 60 80 00    	mov    0x80601c(%ebx),%ebx
+  8021a9:	eb d7                	jmp    802182 <open_read+0xed>
+    return -E_BAD_PATH;
+  8021ab:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8021b0:	eb d0                	jmp    802182 <open_read+0xed>
+
+008021b2 <file_stat>:
+{
+  8021b2:	55                   	push   %ebp
+  8021b3:	89 e5                	mov    %esp,%ebp
+  8021b5:	57                   	push   %edi
+  8021b6:	56                   	push   %esi
+  8021b7:	53                   	push   %ebx
+  8021b8:	83 ec 18             	sub    $0x18,%esp
+  8021bb:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8021be:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  8021c1:	57                   	push   %edi
+  8021c2:	e8 a3 e5 ff ff       	call   80076a <strlen>
+  8021c7:	83 c4 10             	add    $0x10,%esp
+  8021ca:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8021cf:	0f 8f c7 00 00 00    	jg     80229c <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  8021d5:	83 ec 0c             	sub    $0xc,%esp
+  8021d8:	57                   	push   %edi
+  8021d9:	e8 8c e5 ff ff       	call   80076a <strlen>
+  8021de:	8d 58 04             	lea    0x4(%eax),%ebx
+  8021e1:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  8021e4:	83 c4 08             	add    $0x8,%esp
+  8021e7:	57                   	push   %edi
+  8021e8:	68 e4 60 80 00       	push   $0x8060e4
+  8021ed:	e8 b3 e5 ff ff       	call   8007a5 <strcpy>
+  req->req_nops = 2;
+  8021f2:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  8021f9:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  8021fc:	c7 05 04 60 80 00 02 	movl   $0x2,0x806004
+  802203:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  802206:	c7 05 10 60 80 00 00 	movl   $0x0,0x806010
+  80220d:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  802210:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  802217:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  80221a:	c7 05 20 60 80 00 03 	movl   $0x3,0x806020
+  802221:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  802224:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  80222b:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  80222e:	89 1d 34 60 80 00    	mov    %ebx,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  802234:	ba 00 00 00 00       	mov    $0x0,%edx
+  802239:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80223e:	e8 32 f9 ff ff       	call   801b75 <fsipc>
+  802243:	83 c4 10             	add    $0x10,%esp
+  802246:	83 f8 01             	cmp    $0x1,%eax
+  802249:	7e 42                	jle    80228d <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  80224b:	81 c3 e4 60 80 00    	add    $0x8060e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  802251:	83 ec 08             	sub    $0x8,%esp
+  802254:	53                   	push   %ebx
+  802255:	56                   	push   %esi
+  802256:	e8 4a e5 ff ff       	call   8007a5 <strcpy>
+  st->st_size = ret->ret_size;
+  80225b:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  802261:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  802267:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  80226d:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  802273:	c7 86 88 00 00 00 04 	movl   $0x804004,0x88(%esi)
+  80227a:	40 80 00 
+  return 0;
+  80227d:	83 c4 10             	add    $0x10,%esp
+  802280:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802285:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802288:	5b                   	pop    %ebx
+  802289:	5e                   	pop    %esi
+  80228a:	5f                   	pop    %edi
+  80228b:	5d                   	pop    %ebp
+  80228c:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  80228d:	85 c0                	test   %eax,%eax
+  80228f:	78 f4                	js     802285 <file_stat+0xd3>
+  802291:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802294:	8b 80 1c 60 80 00    	mov    0x80601c(%eax),%eax
+  80229a:	eb e9                	jmp    802285 <file_stat+0xd3>
+    return -E_BAD_PATH;
+  80229c:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8022a1:	eb e2                	jmp    802285 <file_stat+0xd3>
+
+008022a3 <read_map>:
+{
+  8022a3:	55                   	push   %ebp
+  8022a4:	89 e5                	mov    %esp,%ebp
+  8022a6:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8022a9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022ac:	50                   	push   %eax
+  8022ad:	ff 75 08             	push   0x8(%ebp)
+  8022b0:	e8 7c f2 ff ff       	call   801531 <fd_lookup>
+  8022b5:	83 c4 10             	add    $0x10,%esp
+  8022b8:	85 c0                	test   %eax,%eax
+  8022ba:	78 2a                	js     8022e6 <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  8022bc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022bf:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  8022c5:	39 08                	cmp    %ecx,(%eax)
+  8022c7:	75 1f                	jne    8022e8 <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  8022c9:	8b 40 0c             	mov    0xc(%eax),%eax
+  8022cc:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read_map.req_offset = offset;
+  8022d1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022d4:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  8022d9:	8b 55 10             	mov    0x10(%ebp),%edx
+  8022dc:	b8 0b 00 00 00       	mov    $0xb,%eax
+  8022e1:	e8 8f f8 ff ff       	call   801b75 <fsipc>
+}
+  8022e6:	c9                   	leave
+  8022e7:	c3                   	ret
+    return -E_INVAL;
+  8022e8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8022ed:	eb f7                	jmp    8022e6 <read_map+0x43>
+
+008022ef <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  8022ef:	55                   	push   %ebp
+  8022f0:	89 e5                	mov    %esp,%ebp
+  8022f2:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  8022f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022fa:	b8 08 00 00 00       	mov    $0x8,%eax
+  8022ff:	e8 71 f8 ff ff       	call   801b75 <fsipc>
+}
+  802304:	c9                   	leave
+  802305:	c3                   	ret
+
+00802306 <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  802306:	55                   	push   %ebp
+  802307:	89 e5                	mov    %esp,%ebp
+  802309:	57                   	push   %edi
+  80230a:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  80230b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80230e:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.stats.req_bio_sched = 0;
+  802313:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  80231a:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  80231d:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  802324:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  802327:	ba 00 00 00 00       	mov    $0x0,%edx
+  80232c:	b8 09 00 00 00       	mov    $0x9,%eax
+  802331:	e8 3f f8 ff ff       	call   801b75 <fsipc>
+  802336:	85 c0                	test   %eax,%eax
+  802338:	78 14                	js     80234e <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  80233a:	be 00 60 80 00       	mov    $0x806000,%esi
+  80233f:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802344:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802347:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  802349:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80234e:	5e                   	pop    %esi
+  80234f:	5f                   	pop    %edi
+  802350:	5d                   	pop    %ebp
+  802351:	c3                   	ret
+
+00802352 <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  802352:	55                   	push   %ebp
+  802353:	89 e5                	mov    %esp,%ebp
+  802355:	53                   	push   %ebx
+  802356:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  802359:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  80235c:	50                   	push   %eax
+  80235d:	6a 00                	push   $0x0
+  80235f:	e8 a2 ff ff ff       	call   802306 <fs_stats>
+  802364:	83 c4 10             	add    $0x10,%esp
+  802367:	85 c0                	test   %eax,%eax
+  802369:	78 28                	js     802393 <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  80236b:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  80236e:	83 ec 08             	sub    $0x8,%esp
+  802371:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802374:	50                   	push   %eax
+  802375:	6a 20                	push   $0x20
+  802377:	e8 8a ff ff ff       	call   802306 <fs_stats>
+  80237c:	83 c4 10             	add    $0x10,%esp
+  80237f:	85 c0                	test   %eax,%eax
+  802381:	78 10                	js     802393 <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  802383:	83 ec 08             	sub    $0x8,%esp
+  802386:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802389:	50                   	push   %eax
+  80238a:	53                   	push   %ebx
+  80238b:	e8 76 ff ff ff       	call   802306 <fs_stats>
+  802390:	83 c4 10             	add    $0x10,%esp
+}
+  802393:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802396:	c9                   	leave
+  802397:	c3                   	ret
+
+00802398 <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  802398:	55                   	push   %ebp
+  802399:	89 e5                	mov    %esp,%ebp
+  80239b:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  80239e:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  8023a5:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  8023a8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023ab:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.stats.req_dcache = 0;
+  8023b0:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  8023b7:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  8023ba:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023bf:	b8 09 00 00 00       	mov    $0x9,%eax
+  8023c4:	e8 ac f7 ff ff       	call   801b75 <fsipc>
+}
+  8023c9:	c9                   	leave
+  8023ca:	c3                   	ret
+
+008023cb <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  8023cb:	55                   	push   %ebp
+  8023cc:	89 e5                	mov    %esp,%ebp
+  8023ce:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  8023d1:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  8023d8:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  8023db:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  8023e2:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  8023e5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8023e8:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_STATS, NULL);
+  8023ed:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023f2:	b8 09 00 00 00       	mov    $0x9,%eax
+  8023f7:	e8 79 f7 ff ff       	call   801b75 <fsipc>
+}
+  8023fc:	c9                   	leave
+  8023fd:	c3                   	ret
+
+008023fe <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  8023fe:	55                   	push   %ebp
+  8023ff:	89 e5                	mov    %esp,%ebp
+  802401:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802404:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802407:	50                   	push   %eax
+  802408:	ff 75 08             	push   0x8(%ebp)
+  80240b:	e8 21 f1 ff ff       	call   801531 <fd_lookup>
+  802410:	83 c4 10             	add    $0x10,%esp
+  802413:	85 c0                	test   %eax,%eax
+  802415:	78 34                	js     80244b <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  802417:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80241a:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  802420:	39 08                	cmp    %ecx,(%eax)
+  802422:	75 29                	jne    80244d <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  802424:	8b 40 0c             	mov    0xc(%eax),%eax
+  802427:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.fallocate.req_offset = offset;
+  80242c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80242f:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.fallocate.req_len = len;
+  802434:	8b 45 10             	mov    0x10(%ebp),%eax
+  802437:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  80243c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802441:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802446:	e8 2a f7 ff ff       	call   801b75 <fsipc>
+}
+  80244b:	c9                   	leave
+  80244c:	c3                   	ret
+    return -E_INVAL;
+  80244d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802452:	eb f7                	jmp    80244b <fallocate+0x4d>
+
+00802454 <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  802454:	55                   	push   %ebp
+  802455:	89 e5                	mov    %esp,%ebp
+  802457:	57                   	push   %edi
+  802458:	56                   	push   %esi
+  802459:	53                   	push   %ebx
+  80245a:	83 ec 24             	sub    $0x24,%esp
+  80245d:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802460:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802463:	50                   	push   %eax
+  802464:	ff 75 08             	push   0x8(%ebp)
+  802467:	e8 c5 f0 ff ff       	call   801531 <fd_lookup>
+  80246c:	83 c4 10             	add    $0x10,%esp
+  80246f:	85 c0                	test   %eax,%eax
+  802471:	78 66                	js     8024d9 <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  802473:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802476:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  80247c:	39 08                	cmp    %ecx,(%eax)
+  80247e:	75 61                	jne    8024e1 <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  802480:	85 f6                	test   %esi,%esi
+  802482:	7e 50                	jle    8024d4 <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  802484:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  802489:	39 de                	cmp    %ebx,%esi
+  80248b:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  80248e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802491:	8b 40 0c             	mov    0xc(%eax),%eax
+  802494:	a3 00 60 80 00       	mov    %eax,0x806000
+    fsipcbuf.prefetch.req_n = m;
+  802499:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  80249f:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  8024a6:	83 ec 04             	sub    $0x4,%esp
+  8024a9:	57                   	push   %edi
+  8024aa:	ff 75 0c             	push   0xc(%ebp)
+  8024ad:	68 08 60 80 00       	push   $0x806008
+  8024b2:	e8 74 e4 ff ff       	call   80092b <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  8024b7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024bc:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8024c1:	e8 af f6 ff ff       	call   801b75 <fsipc>
+  8024c6:	83 c4 10             	add    $0x10,%esp
+  8024c9:	85 c0                	test   %eax,%eax
+  8024cb:	78 0c                	js     8024d9 <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  8024cd:	01 7d 0c             	add    %edi,0xc(%ebp)
+  8024d0:	29 de                	sub    %ebx,%esi
+  8024d2:	eb ac                	jmp    802480 <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  8024d4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024dc:	5b                   	pop    %ebx
+  8024dd:	5e                   	pop    %esi
+  8024de:	5f                   	pop    %edi
+  8024df:	5d                   	pop    %ebp
+  8024e0:	c3                   	ret
+    return -E_INVAL;
+  8024e1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8024e6:	eb f1                	jmp    8024d9 <prefetch+0x85>
+
+008024e8 <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  8024e8:	55                   	push   %ebp
+  8024e9:	89 e5                	mov    %esp,%ebp
+  8024eb:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  8024ee:	50                   	push   %eax
+  8024ef:	e8 d3 ef ff ff       	call   8014c7 <fd2data>
+  8024f4:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  8024f9:	c9                   	leave
+  8024fa:	c3                   	ret
+
+008024fb <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8024fb:	55                   	push   %ebp
+  8024fc:	89 e5                	mov    %esp,%ebp
+  8024fe:	56                   	push   %esi
+  8024ff:	53                   	push   %ebx
+  802500:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  802503:	83 ec 0c             	sub    $0xc,%esp
+  802506:	ff 75 08             	push   0x8(%ebp)
+  802509:	e8 b9 ef ff ff       	call   8014c7 <fd2data>
+  80250e:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  802510:	83 c4 08             	add    $0x8,%esp
+  802513:	68 14 3f 80 00       	push   $0x803f14
+  802518:	53                   	push   %ebx
+  802519:	e8 87 e2 ff ff       	call   8007a5 <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  80251e:	8b 46 04             	mov    0x4(%esi),%eax
+  802521:	2b 06                	sub    (%esi),%eax
+  802523:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  802529:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802530:	00 00 00 
+  stat->st_dev = &devpipe;
+  802533:	c7 83 88 00 00 00 20 	movl   $0x804020,0x88(%ebx)
+  80253a:	40 80 00 
+  return 0;
+}
+  80253d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802542:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802545:	5b                   	pop    %ebx
+  802546:	5e                   	pop    %esi
+  802547:	5d                   	pop    %ebp
+  802548:	c3                   	ret
+
+00802549 <pipe_wakeup>:
+{
+  802549:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  80254b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802550:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  802553:	85 c0                	test   %eax,%eax
+  802555:	75 01                	jne    802558 <pipe_wakeup+0xf>
+  802557:	c3                   	ret
+{
+  802558:	55                   	push   %ebp
+  802559:	89 e5                	mov    %esp,%ebp
+  80255b:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  80255e:	6a 00                	push   $0x0
+  802560:	68 00 00 c0 ee       	push   $0xeec00000
+  802565:	52                   	push   %edx
+  802566:	e8 c5 e9 ff ff       	call   800f30 <sys_chan_wakeup>
+  80256b:	83 c4 10             	add    $0x10,%esp
+}
+  80256e:	c9                   	leave
+  80256f:	c3                   	ret
+
+00802570 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  802570:	55                   	push   %ebp
+  802571:	89 e5                	mov    %esp,%ebp
+  802573:	57                   	push   %edi
+  802574:	56                   	push   %esi
+  802575:	53                   	push   %ebx
+  802576:	83 ec 18             	sub    $0x18,%esp
+  802579:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  80257c:	57                   	push   %edi
+  80257d:	e8 45 ef ff ff       	call   8014c7 <fd2data>
+  802582:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  802584:	83 c4 10             	add    $0x10,%esp
+  802587:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  80258b:	74 2a                	je     8025b7 <devpipe_close+0x47>
+  80258d:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  802592:	89 f8                	mov    %edi,%eax
+  802594:	e8 4f ff ff ff       	call   8024e8 <pipe_ring>
+  802599:	83 ec 08             	sub    $0x8,%esp
+  80259c:	01 d8                	add    %ebx,%eax
+  80259e:	50                   	push   %eax
+  80259f:	6a 00                	push   $0x0
+  8025a1:	e8 b3 e6 ff ff       	call   800c59 <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  8025a6:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8025ac:	83 c4 10             	add    $0x10,%esp
+  8025af:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  8025b5:	75 db                	jne    802592 <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  8025b7:	83 ec 08             	sub    $0x8,%esp
+  8025ba:	57                   	push   %edi
+  8025bb:	6a 00                	push   $0x0
+  8025bd:	e8 97 e6 ff ff       	call   800c59 <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  8025c2:	83 c4 10             	add    $0x10,%esp
+  8025c5:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  8025c9:	75 13                	jne    8025de <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  8025cb:	83 ec 08             	sub    $0x8,%esp
+  8025ce:	56                   	push   %esi
+  8025cf:	6a 00                	push   $0x0
+  8025d1:	e8 83 e6 ff ff       	call   800c59 <sys_page_unmap>
+}
+  8025d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025d9:	5b                   	pop    %ebx
+  8025da:	5e                   	pop    %esi
+  8025db:	5f                   	pop    %edi
+  8025dc:	5d                   	pop    %ebp
+  8025dd:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  8025de:	8d 56 04             	lea    0x4(%esi),%edx
+  8025e1:	8d 46 2c             	lea    0x2c(%esi),%eax
+  8025e4:	e8 60 ff ff ff       	call   802549 <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8025e9:	8d 46 30             	lea    0x30(%esi),%eax
+  8025ec:	89 f2                	mov    %esi,%edx
+  8025ee:	e8 56 ff ff ff       	call   802549 <pipe_wakeup>
+  8025f3:	eb d6                	jmp    8025cb <devpipe_close+0x5b>
+
+008025f5 <_pipeisclosed>:
+{
+  8025f5:	55                   	push   %ebp
+  8025f6:	89 e5                	mov    %esp,%ebp
+  8025f8:	57                   	push   %edi
+  8025f9:	56                   	push   %esi
+  8025fa:	53                   	push   %ebx
+  8025fb:	83 ec 1c             	sub    $0x1c,%esp
+  8025fe:	89 c7                	mov    %eax,%edi
+  802600:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  802602:	a1 a0 58 80 00       	mov    0x8058a0,%eax
+  802607:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  80260a:	83 ec 0c             	sub    $0xc,%esp
+  80260d:	57                   	push   %edi
+  80260e:	e8 df 10 00 00       	call   8036f2 <pageref>
+  802613:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802616:	89 34 24             	mov    %esi,(%esp)
+  802619:	e8 d4 10 00 00       	call   8036f2 <pageref>
+    nn = thisenv->env_runs;
+  80261e:	8b 15 a0 58 80 00    	mov    0x8058a0,%edx
+  802624:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  802627:	83 c4 10             	add    $0x10,%esp
+  80262a:	39 cb                	cmp    %ecx,%ebx
+  80262c:	74 1b                	je     802649 <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  80262e:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802631:	75 cf                	jne    802602 <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802633:	8b 42 58             	mov    0x58(%edx),%eax
+  802636:	6a 01                	push   $0x1
+  802638:	50                   	push   %eax
+  802639:	53                   	push   %ebx
+  80263a:	68 1b 3f 80 00       	push   $0x803f1b
+  80263f:	e8 73 db ff ff       	call   8001b7 <cprintf>
+  802644:	83 c4 10             	add    $0x10,%esp
+  802647:	eb b9                	jmp    802602 <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  802649:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80264c:	0f 94 c0             	sete   %al
+  80264f:	0f b6 c0             	movzbl %al,%eax
+}
+  802652:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802655:	5b                   	pop    %ebx
+  802656:	5e                   	pop    %esi
+  802657:	5f                   	pop    %edi
+  802658:	5d                   	pop    %ebp
+  802659:	c3                   	ret
+
+0080265a <devpipe_write_bulk>:
+{
+  80265a:	55                   	push   %ebp
+  80265b:	89 e5                	mov    %esp,%ebp
+  80265d:	57                   	push   %edi
+  80265e:	56                   	push   %esi
+  80265f:	53                   	push   %ebx
+  802660:	83 ec 1c             	sub    $0x1c,%esp
+  802663:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802666:	89 d6                	mov    %edx,%esi
+  802668:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  80266b:	e8 78 fe ff ff       	call   8024e8 <pipe_ring>
+  802670:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  802673:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802678:	8d 46 04             	lea    0x4(%esi),%eax
+  80267b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  80267e:	eb 75                	jmp    8026f5 <devpipe_write_bulk+0x9b>
+  802680:	b8 01 00 00 00       	mov    $0x1,%eax
+  802685:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802689:	6a 64                	push   $0x64
+  80268b:	68 00 00 c0 ee       	push   $0xeec00000
+  802690:	53                   	push   %ebx
+  802691:	56                   	push   %esi
+  802692:	e8 76 e8 ff ff       	call   800f0d <sys_chan_sleep>
+      continue;
+  802697:	83 c4 10             	add    $0x10,%esp
+  80269a:	eb 59                	jmp    8026f5 <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  80269c:	89 d1                	mov    %edx,%ecx
+  80269e:	c1 f9 1f             	sar    $0x1f,%ecx
+  8026a1:	c1 e9 11             	shr    $0x11,%ecx
+  8026a4:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  8026a7:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8026ac:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  8026ae:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  8026b4:	29 d3                	sub    %edx,%ebx
+  8026b6:	ba 00 80 00 00       	mov    $0x8000,%edx
+  8026bb:	29 c2                	sub    %eax,%edx
+  8026bd:	39 d3                	cmp    %edx,%ebx
+  8026bf:	0f 47 da             	cmova  %edx,%ebx
+  8026c2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8026c5:	29 fa                	sub    %edi,%edx
+  8026c7:	39 d3                	cmp    %edx,%ebx
+  8026c9:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  8026cc:	83 ec 04             	sub    $0x4,%esp
+  8026cf:	53                   	push   %ebx
+  8026d0:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8026d3:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  8026d6:	52                   	push   %edx
+  8026d7:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8026da:	01 c8                	add    %ecx,%eax
+  8026dc:	50                   	push   %eax
+  8026dd:	e8 ab e2 ff ff       	call   80098d <memcpy>
+    i += m;
+  8026e2:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  8026e4:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  8026e7:	8d 46 2c             	lea    0x2c(%esi),%eax
+  8026ea:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8026ed:	e8 57 fe ff ff       	call   802549 <pipe_wakeup>
+  8026f2:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  8026f5:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  8026f8:	73 2b                	jae    802725 <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  8026fa:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  8026fc:	8b 56 04             	mov    0x4(%esi),%edx
+  8026ff:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  802705:	39 d0                	cmp    %edx,%eax
+  802707:	7d 93                	jge    80269c <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  802709:	89 f2                	mov    %esi,%edx
+  80270b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80270e:	e8 e2 fe ff ff       	call   8025f5 <_pipeisclosed>
+  802713:	85 c0                	test   %eax,%eax
+  802715:	0f 84 65 ff ff ff    	je     802680 <devpipe_write_bulk+0x26>
+        return i;
+  80271b:	89 f8                	mov    %edi,%eax
+}
+  80271d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802720:	5b                   	pop    %ebx
+  802721:	5e                   	pop    %esi
+  802722:	5f                   	pop    %edi
+  802723:	5d                   	pop    %ebp
+  802724:	c3                   	ret
+  return i;
+  802725:	89 f8                	mov    %edi,%eax
+  802727:	eb f4                	jmp    80271d <devpipe_write_bulk+0xc3>
+
+00802729 <devpipe_write>:
+{
+  802729:	55                   	push   %ebp
+  80272a:	89 e5                	mov    %esp,%ebp
+  80272c:	57                   	push   %edi
+  80272d:	56                   	push   %esi
+  80272e:	53                   	push   %ebx
+  80272f:	83 ec 28             	sub    $0x28,%esp
+  802732:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  802735:	56                   	push   %esi
+  802736:	e8 8c ed ff ff       	call   8014c7 <fd2data>
+  80273b:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  80273d:	8b 78 28             	mov    0x28(%eax),%edi
+  802740:	83 c4 10             	add    $0x10,%esp
+  802743:	85 ff                	test   %edi,%edi
+  802745:	75 25                	jne    80276c <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  802747:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  80274a:	74 66                	je     8027b2 <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  80274c:	8b 43 04             	mov    0x4(%ebx),%eax
+  80274f:	8b 0b                	mov    (%ebx),%ecx
+  802751:	8d 51 20             	lea    0x20(%ecx),%edx
+  802754:	39 d0                	cmp    %edx,%eax
+  802756:	72 2b                	jb     802783 <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  802758:	89 da                	mov    %ebx,%edx
+  80275a:	89 f0                	mov    %esi,%eax
+  80275c:	e8 94 fe ff ff       	call   8025f5 <_pipeisclosed>
+  802761:	85 c0                	test   %eax,%eax
+  802763:	75 51                	jne    8027b6 <devpipe_write+0x8d>
+      sys_yield();
+  802765:	e8 08 e4 ff ff       	call   800b72 <sys_yield>
+  80276a:	eb e0                	jmp    80274c <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  80276c:	83 ec 0c             	sub    $0xc,%esp
+  80276f:	ff 75 10             	push   0x10(%ebp)
+  802772:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802775:	89 c2                	mov    %eax,%edx
+  802777:	89 f0                	mov    %esi,%eax
+  802779:	e8 dc fe ff ff       	call   80265a <devpipe_write_bulk>
+  80277e:	83 c4 10             	add    $0x10,%esp
+  802781:	eb 38                	jmp    8027bb <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802783:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802786:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  80278a:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  80278d:	89 c2                	mov    %eax,%edx
+  80278f:	c1 fa 1f             	sar    $0x1f,%edx
+  802792:	89 d1                	mov    %edx,%ecx
+  802794:	c1 e9 1b             	shr    $0x1b,%ecx
+  802797:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  80279a:	83 e2 1f             	and    $0x1f,%edx
+  80279d:	29 ca                	sub    %ecx,%edx
+  80279f:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8027a3:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  8027a7:	83 c0 01             	add    $0x1,%eax
+  8027aa:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  8027ad:	83 c7 01             	add    $0x1,%edi
+  8027b0:	eb 95                	jmp    802747 <devpipe_write+0x1e>
+  return i;
+  8027b2:	89 f8                	mov    %edi,%eax
+  8027b4:	eb 05                	jmp    8027bb <devpipe_write+0x92>
+        return 0;
+  8027b6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8027bb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027be:	5b                   	pop    %ebx
+  8027bf:	5e                   	pop    %esi
+  8027c0:	5f                   	pop    %edi
+  8027c1:	5d                   	pop    %ebp
+  8027c2:	c3                   	ret
+
+008027c3 <devpipe_read_bulk>:
+{
+  8027c3:	55                   	push   %ebp
+  8027c4:	89 e5                	mov    %esp,%ebp
+  8027c6:	57                   	push   %edi
+  8027c7:	56                   	push   %esi
+  8027c8:	53                   	push   %ebx
+  8027c9:	83 ec 2c             	sub    $0x2c,%esp
+  8027cc:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8027cf:	89 d6                	mov    %edx,%esi
+  8027d1:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8027d4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  8027d7:	e8 0c fd ff ff       	call   8024e8 <pipe_ring>
+  8027dc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  8027df:	85 db                	test   %ebx,%ebx
+  8027e1:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8027e6:	0f 45 c3             	cmovne %ebx,%eax
+  8027e9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8027ec:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8027f1:	8d 46 30             	lea    0x30(%esi),%eax
+  8027f4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  8027f7:	eb 50                	jmp    802849 <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  8027f9:	89 d1                	mov    %edx,%ecx
+  8027fb:	c1 f9 1f             	sar    $0x1f,%ecx
+  8027fe:	c1 e9 11             	shr    $0x11,%ecx
+  802801:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802804:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802809:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  80280b:	29 d3                	sub    %edx,%ebx
+  80280d:	ba 00 80 00 00       	mov    $0x8000,%edx
+  802812:	29 c2                	sub    %eax,%edx
+  802814:	39 d3                	cmp    %edx,%ebx
+  802816:	0f 47 da             	cmova  %edx,%ebx
+  802819:	8b 55 08             	mov    0x8(%ebp),%edx
+  80281c:	29 fa                	sub    %edi,%edx
+  80281e:	39 d3                	cmp    %edx,%ebx
+  802820:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  802823:	83 ec 04             	sub    $0x4,%esp
+  802826:	53                   	push   %ebx
+  802827:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  80282a:	01 c8                	add    %ecx,%eax
+  80282c:	50                   	push   %eax
+  80282d:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802830:	01 f8                	add    %edi,%eax
+  802832:	50                   	push   %eax
+  802833:	e8 55 e1 ff ff       	call   80098d <memcpy>
+    i += m;
+  802838:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  80283a:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  80283c:	89 f2                	mov    %esi,%edx
+  80283e:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802841:	e8 03 fd ff ff       	call   802549 <pipe_wakeup>
+  802846:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802849:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  80284c:	73 51                	jae    80289f <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  80284e:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  802851:	8b 16                	mov    (%esi),%edx
+  802853:	39 da                	cmp    %ebx,%edx
+  802855:	75 a2                	jne    8027f9 <devpipe_read_bulk+0x36>
+      if (i > 0)
+  802857:	85 ff                	test   %edi,%edi
+  802859:	75 44                	jne    80289f <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  80285b:	89 f2                	mov    %esi,%edx
+  80285d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802860:	e8 90 fd ff ff       	call   8025f5 <_pipeisclosed>
+  802865:	85 c0                	test   %eax,%eax
+  802867:	75 3a                	jne    8028a3 <devpipe_read_bulk+0xe0>
+  802869:	b8 01 00 00 00       	mov    $0x1,%eax
+  80286e:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802872:	6a 64                	push   $0x64
+  802874:	ff 75 d4             	push   -0x2c(%ebp)
+  802877:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  802878:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  80287b:	50                   	push   %eax
+  80287c:	e8 8c e6 ff ff       	call   800f0d <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  802881:	85 c0                	test   %eax,%eax
+  802883:	ba 00 00 00 00       	mov    $0x0,%edx
+  802888:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  80288b:	83 c4 10             	add    $0x10,%esp
+  80288e:	a8 01                	test   $0x1,%al
+  802890:	74 b7                	je     802849 <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  802892:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  802897:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80289a:	5b                   	pop    %ebx
+  80289b:	5e                   	pop    %esi
+  80289c:	5f                   	pop    %edi
+  80289d:	5d                   	pop    %ebp
+  80289e:	c3                   	ret
+  return i;
+  80289f:	89 f8                	mov    %edi,%eax
+  8028a1:	eb f4                	jmp    802897 <devpipe_read_bulk+0xd4>
+        return 0;
+  8028a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028a8:	eb ed                	jmp    802897 <devpipe_read_bulk+0xd4>
+
+008028aa <devpipe_read>:
+{
+  8028aa:	55                   	push   %ebp
+  8028ab:	89 e5                	mov    %esp,%ebp
+  8028ad:	57                   	push   %edi
+  8028ae:	56                   	push   %esi
+  8028af:	53                   	push   %ebx
+  8028b0:	83 ec 18             	sub    $0x18,%esp
+  8028b3:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  8028b6:	57                   	push   %edi
+  8028b7:	e8 0b ec ff ff       	call   8014c7 <fd2data>
+  8028bc:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  8028be:	8b 70 28             	mov    0x28(%eax),%esi
+  8028c1:	83 c4 10             	add    $0x10,%esp
+  8028c4:	85 f6                	test   %esi,%esi
+  8028c6:	75 24                	jne    8028ec <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  8028c8:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8028cb:	74 60                	je     80292d <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  8028cd:	8b 03                	mov    (%ebx),%eax
+  8028cf:	3b 43 04             	cmp    0x4(%ebx),%eax
+  8028d2:	75 3b                	jne    80290f <devpipe_read+0x65>
+      if (i > 0)
+  8028d4:	85 f6                	test   %esi,%esi
+  8028d6:	75 2d                	jne    802905 <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  8028d8:	89 da                	mov    %ebx,%edx
+  8028da:	89 f8                	mov    %edi,%eax
+  8028dc:	e8 14 fd ff ff       	call   8025f5 <_pipeisclosed>
+  8028e1:	85 c0                	test   %eax,%eax
+  8028e3:	75 4c                	jne    802931 <devpipe_read+0x87>
+      sys_yield();
+  8028e5:	e8 88 e2 ff ff       	call   800b72 <sys_yield>
+  8028ea:	eb e1                	jmp    8028cd <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  8028ec:	83 ec 08             	sub    $0x8,%esp
+  8028ef:	6a 00                	push   $0x0
+  8028f1:	ff 75 10             	push   0x10(%ebp)
+  8028f4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8028f7:	89 c2                	mov    %eax,%edx
+  8028f9:	89 f8                	mov    %edi,%eax
+  8028fb:	e8 c3 fe ff ff       	call   8027c3 <devpipe_read_bulk>
+  802900:	83 c4 10             	add    $0x10,%esp
+  802903:	eb 02                	jmp    802907 <devpipe_read+0x5d>
+        return i;
+  802905:	89 f0                	mov    %esi,%eax
+}
+  802907:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80290a:	5b                   	pop    %ebx
+  80290b:	5e                   	pop    %esi
+  80290c:	5f                   	pop    %edi
+  80290d:	5d                   	pop    %ebp
+  80290e:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80290f:	99                   	cltd
+  802910:	c1 ea 1b             	shr    $0x1b,%edx
+  802913:	01 d0                	add    %edx,%eax
+  802915:	83 e0 1f             	and    $0x1f,%eax
+  802918:	29 d0                	sub    %edx,%eax
+  80291a:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  80291f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802922:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  802925:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  802928:	83 c6 01             	add    $0x1,%esi
+  80292b:	eb 9b                	jmp    8028c8 <devpipe_read+0x1e>
+  return i;
+  80292d:	89 f0                	mov    %esi,%eax
+  80292f:	eb d6                	jmp    802907 <devpipe_read+0x5d>
+        return 0;
+  802931:	b8 00 00 00 00       	mov    $0x0,%eax
+  802936:	eb cf                	jmp    802907 <devpipe_read+0x5d>
+
+00802938 <pipe2>:
+{
+  802938:	55                   	push   %ebp
+  802939:	89 e5                	mov    %esp,%ebp
+  80293b:	57                   	push   %edi
+  80293c:	56                   	push   %esi
+  80293d:	53                   	push   %ebx
+  80293e:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  802941:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802944:	50                   	push   %eax
+  802945:	e8 91 eb ff ff       	call   8014db <fd_alloc>
+  80294a:	89 c3                	mov    %eax,%ebx
+  80294c:	83 c4 10             	add    $0x10,%esp
+  80294f:	85 c0                	test   %eax,%eax
+  802951:	0f 88 fb 01 00 00    	js     802b52 <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802957:	83 ec 04             	sub    $0x4,%esp
+  80295a:	68 07 04 00 00       	push   $0x407
+  80295f:	ff 75 e4             	push   -0x1c(%ebp)
+  802962:	6a 00                	push   $0x0
+  802964:	e8 6b e2 ff ff       	call   800bd4 <sys_page_alloc>
+  802969:	89 c3                	mov    %eax,%ebx
+  80296b:	83 c4 10             	add    $0x10,%esp
+  80296e:	85 c0                	test   %eax,%eax
+  802970:	0f 88 dc 01 00 00    	js     802b52 <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  802976:	83 ec 0c             	sub    $0xc,%esp
+  802979:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80297c:	50                   	push   %eax
+  80297d:	e8 59 eb ff ff       	call   8014db <fd_alloc>
+  802982:	89 c3                	mov    %eax,%ebx
+  802984:	83 c4 10             	add    $0x10,%esp
+  802987:	85 c0                	test   %eax,%eax
+  802989:	0f 88 b3 01 00 00    	js     802b42 <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80298f:	83 ec 04             	sub    $0x4,%esp
+  802992:	68 07 04 00 00       	push   $0x407
+  802997:	ff 75 e0             	push   -0x20(%ebp)
+  80299a:	6a 00                	push   $0x0
+  80299c:	e8 33 e2 ff ff       	call   800bd4 <sys_page_alloc>
+  8029a1:	89 c3                	mov    %eax,%ebx
+  8029a3:	83 c4 10             	add    $0x10,%esp
+  8029a6:	85 c0                	test   %eax,%eax
+  8029a8:	0f 88 94 01 00 00    	js     802b42 <pipe2+0x20a>
+  va = fd2data(fd0);
+  8029ae:	83 ec 0c             	sub    $0xc,%esp
+  8029b1:	ff 75 e4             	push   -0x1c(%ebp)
+  8029b4:	e8 0e eb ff ff       	call   8014c7 <fd2data>
+  8029b9:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8029bb:	83 c4 0c             	add    $0xc,%esp
+  8029be:	68 07 04 00 00       	push   $0x407
+  8029c3:	50                   	push   %eax
+  8029c4:	6a 00                	push   $0x0
+  8029c6:	e8 09 e2 ff ff       	call   800bd4 <sys_page_alloc>
+  8029cb:	89 c3                	mov    %eax,%ebx
+  8029cd:	83 c4 10             	add    $0x10,%esp
+  8029d0:	85 c0                	test   %eax,%eax
+  8029d2:	0f 88 5a 01 00 00    	js     802b32 <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8029d8:	83 ec 0c             	sub    $0xc,%esp
+  8029db:	ff 75 e0             	push   -0x20(%ebp)
+  8029de:	e8 e4 ea ff ff       	call   8014c7 <fd2data>
+  8029e3:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8029ea:	50                   	push   %eax
+  8029eb:	6a 00                	push   $0x0
+  8029ed:	57                   	push   %edi
+  8029ee:	6a 00                	push   $0x0
+  8029f0:	e8 22 e2 ff ff       	call   800c17 <sys_page_map>
+  8029f5:	89 c3                	mov    %eax,%ebx
+  8029f7:	83 c4 20             	add    $0x20,%esp
+  8029fa:	85 c0                	test   %eax,%eax
+  8029fc:	0f 88 22 01 00 00    	js     802b24 <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  802a02:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  802a06:	74 72                	je     802a7a <pipe2+0x142>
+  802a08:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  802a0d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802a10:	e8 d3 fa ff ff       	call   8024e8 <pipe_ring>
+  802a15:	83 ec 04             	sub    $0x4,%esp
+  802a18:	68 07 04 00 00       	push   $0x407
+  802a1d:	01 f0                	add    %esi,%eax
+  802a1f:	50                   	push   %eax
+  802a20:	6a 00                	push   $0x0
+  802a22:	e8 ad e1 ff ff       	call   800bd4 <sys_page_alloc>
+  802a27:	89 c3                	mov    %eax,%ebx
+  802a29:	83 c4 10             	add    $0x10,%esp
+  802a2c:	85 c0                	test   %eax,%eax
+  802a2e:	0f 88 97 00 00 00    	js     802acb <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  802a34:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802a37:	e8 ac fa ff ff       	call   8024e8 <pipe_ring>
+  802a3c:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  802a3f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802a42:	e8 a1 fa ff ff       	call   8024e8 <pipe_ring>
+  802a47:	83 ec 0c             	sub    $0xc,%esp
+  802a4a:	68 07 04 00 00       	push   $0x407
+  802a4f:	53                   	push   %ebx
+  802a50:	6a 00                	push   $0x0
+  802a52:	01 f0                	add    %esi,%eax
+  802a54:	50                   	push   %eax
+  802a55:	6a 00                	push   $0x0
+  802a57:	e8 bb e1 ff ff       	call   800c17 <sys_page_map>
+  802a5c:	89 c3                	mov    %eax,%ebx
+  802a5e:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802a64:	83 c4 20             	add    $0x20,%esp
+  802a67:	85 c0                	test   %eax,%eax
+  802a69:	78 60                	js     802acb <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  802a6b:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802a71:	75 9a                	jne    802a0d <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  802a73:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  802a7a:	a1 20 40 80 00       	mov    0x804020,%eax
+  802a7f:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802a82:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  802a84:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802a87:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  802a8e:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802a91:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  802a93:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802a96:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  802a9d:	83 ec 0c             	sub    $0xc,%esp
+  802aa0:	ff 75 e4             	push   -0x1c(%ebp)
+  802aa3:	e8 0f ea ff ff       	call   8014b7 <fd2num>
+  802aa8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802aab:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  802aad:	83 c4 04             	add    $0x4,%esp
+  802ab0:	ff 75 e0             	push   -0x20(%ebp)
+  802ab3:	e8 ff e9 ff ff       	call   8014b7 <fd2num>
+  802ab8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802abb:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  802abe:	83 c4 10             	add    $0x10,%esp
+  802ac1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ac6:	e9 87 00 00 00       	jmp    802b52 <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802acb:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  802ad0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802ad3:	e8 10 fa ff ff       	call   8024e8 <pipe_ring>
+  802ad8:	83 ec 08             	sub    $0x8,%esp
+  802adb:	01 f0                	add    %esi,%eax
+  802add:	50                   	push   %eax
+  802ade:	6a 00                	push   $0x0
+  802ae0:	e8 74 e1 ff ff       	call   800c59 <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  802ae5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802ae8:	e8 fb f9 ff ff       	call   8024e8 <pipe_ring>
+  802aed:	83 c4 08             	add    $0x8,%esp
+  802af0:	01 f0                	add    %esi,%eax
+  802af2:	50                   	push   %eax
+  802af3:	6a 00                	push   $0x0
+  802af5:	e8 5f e1 ff ff       	call   800c59 <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802afa:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802b00:	83 c4 10             	add    $0x10,%esp
+  802b03:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802b09:	75 c5                	jne    802ad0 <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  802b0b:	83 ec 0c             	sub    $0xc,%esp
+  802b0e:	ff 75 e0             	push   -0x20(%ebp)
+  802b11:	e8 b1 e9 ff ff       	call   8014c7 <fd2data>
+  802b16:	83 c4 08             	add    $0x8,%esp
+  802b19:	50                   	push   %eax
+  802b1a:	6a 00                	push   $0x0
+  802b1c:	e8 38 e1 ff ff       	call   800c59 <sys_page_unmap>
+  802b21:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  802b24:	83 ec 08             	sub    $0x8,%esp
+  802b27:	57                   	push   %edi
+  802b28:	6a 00                	push   $0x0
+  802b2a:	e8 2a e1 ff ff       	call   800c59 <sys_page_unmap>
+  802b2f:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  802b32:	83 ec 08             	sub    $0x8,%esp
+  802b35:	ff 75 e0             	push   -0x20(%ebp)
+  802b38:	6a 00                	push   $0x0
+  802b3a:	e8 1a e1 ff ff       	call   800c59 <sys_page_unmap>
+  802b3f:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  802b42:	83 ec 08             	sub    $0x8,%esp
+  802b45:	ff 75 e4             	push   -0x1c(%ebp)
+  802b48:	6a 00                	push   $0x0
+  802b4a:	e8 0a e1 ff ff       	call   800c59 <sys_page_unmap>
+  802b4f:	83 c4 10             	add    $0x10,%esp
+}
+  802b52:	89 d8                	mov    %ebx,%eax
+  802b54:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b57:	5b                   	pop    %ebx
+  802b58:	5e                   	pop    %esi
+  802b59:	5f                   	pop    %edi
+  802b5a:	5d                   	pop    %ebp
+  802b5b:	c3                   	ret
+
+00802b5c <pipe>:
+{
+  802b5c:	55                   	push   %ebp
+  802b5d:	89 e5                	mov    %esp,%ebp
+  802b5f:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  802b62:	6a 00                	push   $0x0
+  802b64:	ff 75 08             	push   0x8(%ebp)
+  802b67:	e8 cc fd ff ff       	call   802938 <pipe2>
+}
+  802b6c:	c9                   	leave
+  802b6d:	c3                   	ret
+
+00802b6e <pipeisclosed>:
+{
+  802b6e:	55                   	push   %ebp
+  802b6f:	89 e5                	mov    %esp,%ebp
+  802b71:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802b74:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b77:	50                   	push   %eax
+  802b78:	ff 75 08             	push   0x8(%ebp)
+  802b7b:	e8 b1 e9 ff ff       	call   801531 <fd_lookup>
+  802b80:	83 c4 10             	add    $0x10,%esp
+  802b83:	85 c0                	test   %eax,%eax
+  802b85:	78 18                	js     802b9f <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  802b87:	83 ec 0c             	sub    $0xc,%esp
+  802b8a:	ff 75 f4             	push   -0xc(%ebp)
+  802b8d:	e8 35 e9 ff ff       	call   8014c7 <fd2data>
+  802b92:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  802b94:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b97:	e8 59 fa ff ff       	call   8025f5 <_pipeisclosed>
+  802b9c:	83 c4 10             	add    $0x10,%esp
+}
+  802b9f:	c9                   	leave
+  802ba0:	c3                   	ret
+
+00802ba1 <pipe_splice>:
+{
+  802ba1:	55                   	push   %ebp
+  802ba2:	89 e5                	mov    %esp,%ebp
+  802ba4:	57                   	push   %edi
+  802ba5:	56                   	push   %esi
+  802ba6:	53                   	push   %ebx
+  802ba7:	83 ec 34             	sub    $0x34,%esp
+  802baa:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802bad:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802bb0:	50                   	push   %eax
+  802bb1:	ff 75 08             	push   0x8(%ebp)
+  802bb4:	e8 78 e9 ff ff       	call   801531 <fd_lookup>
+  802bb9:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802bbc:	83 c4 10             	add    $0x10,%esp
+  802bbf:	85 c0                	test   %eax,%eax
+  802bc1:	0f 88 d7 00 00 00    	js     802c9e <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  802bc7:	83 ec 0c             	sub    $0xc,%esp
+  802bca:	ff 75 e4             	push   -0x1c(%ebp)
+  802bcd:	e8 f5 e8 ff ff       	call   8014c7 <fd2data>
+  802bd2:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802bd4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802bd7:	83 c4 10             	add    $0x10,%esp
+  802bda:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802be0:	39 10                	cmp    %edx,(%eax)
+  802be2:	0f 85 c1 00 00 00    	jne    802ca9 <pipe_splice+0x108>
+  802be8:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  802bec:	0f 84 c0 00 00 00    	je     802cb2 <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  802bf2:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802bf6:	0f 84 bf 00 00 00    	je     802cbb <pipe_splice+0x11a>
+  802bfc:	89 f7                	mov    %esi,%edi
+  802bfe:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  802c04:	0f 85 ba 00 00 00    	jne    802cc4 <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802c0a:	8d 43 04             	lea    0x4(%ebx),%eax
+  802c0d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802c10:	eb 38                	jmp    802c4a <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802c12:	83 ec 0c             	sub    $0xc,%esp
+  802c15:	68 00 10 00 00       	push   $0x1000
+  802c1a:	89 f1                	mov    %esi,%ecx
+  802c1c:	89 da                	mov    %ebx,%edx
+  802c1e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802c21:	e8 34 fa ff ff       	call   80265a <devpipe_write_bulk>
+  802c26:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802c29:	83 c4 10             	add    $0x10,%esp
+  802c2c:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802c31:	75 53                	jne    802c86 <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  802c33:	83 ec 08             	sub    $0x8,%esp
+  802c36:	56                   	push   %esi
+  802c37:	6a 00                	push   $0x0
+  802c39:	e8 1b e0 ff ff       	call   800c59 <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  802c3e:	83 c7 01             	add    $0x1,%edi
+  802c41:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802c47:	83 c4 10             	add    $0x10,%esp
+  802c4a:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802c4d:	74 3a                	je     802c89 <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  802c4f:	8b 03                	mov    (%ebx),%eax
+  802c51:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802c54:	75 bc                	jne    802c12 <pipe_splice+0x71>
+  802c56:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c5b:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  802c5f:	85 c0                	test   %eax,%eax
+  802c61:	74 af                	je     802c12 <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802c63:	83 ec 04             	sub    $0x4,%esp
+  802c66:	6a 07                	push   $0x7
+  802c68:	56                   	push   %esi
+  802c69:	ff 75 d0             	push   -0x30(%ebp)
+  802c6c:	e8 bf e2 ff ff       	call   800f30 <sys_chan_wakeup>
+  802c71:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802c74:	83 c4 10             	add    $0x10,%esp
+  802c77:	85 c0                	test   %eax,%eax
+  802c79:	79 b8                	jns    802c33 <pipe_splice+0x92>
+  802c7b:	b8 01 00 00 00       	mov    $0x1,%eax
+  802c80:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802c84:	eb 8c                	jmp    802c12 <pipe_splice+0x71>
+  802c86:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  802c89:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802c8d:	75 06                	jne    802c95 <pipe_splice+0xf4>
+  802c8f:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802c93:	78 09                	js     802c9e <pipe_splice+0xfd>
+  return i * PGSIZE;
+  802c95:	8b 45 10             	mov    0x10(%ebp),%eax
+  802c98:	c1 e0 0c             	shl    $0xc,%eax
+  802c9b:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  802c9e:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802ca1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ca4:	5b                   	pop    %ebx
+  802ca5:	5e                   	pop    %esi
+  802ca6:	5f                   	pop    %edi
+  802ca7:	5d                   	pop    %ebp
+  802ca8:	c3                   	ret
+    return -E_INVAL;
+  802ca9:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802cb0:	eb ec                	jmp    802c9e <pipe_splice+0xfd>
+  802cb2:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802cb9:	eb e3                	jmp    802c9e <pipe_splice+0xfd>
+  802cbb:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802cc2:	eb da                	jmp    802c9e <pipe_splice+0xfd>
+  802cc4:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802ccb:	eb d1                	jmp    802c9e <pipe_splice+0xfd>
+
+00802ccd <pipe_splice_read>:
+{
+  802ccd:	55                   	push   %ebp
+  802cce:	89 e5                	mov    %esp,%ebp
+  802cd0:	53                   	push   %ebx
+  802cd1:	83 ec 1c             	sub    $0x1c,%esp
+  802cd4:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802cd7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802cda:	50                   	push   %eax
+  802cdb:	ff 75 08             	push   0x8(%ebp)
+  802cde:	e8 4e e8 ff ff       	call   801531 <fd_lookup>
+  802ce3:	83 c4 10             	add    $0x10,%esp
+  802ce6:	85 c0                	test   %eax,%eax
+  802ce8:	78 49                	js     802d33 <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  802cea:	83 ec 0c             	sub    $0xc,%esp
+  802ced:	ff 75 f4             	push   -0xc(%ebp)
+  802cf0:	e8 d2 e7 ff ff       	call   8014c7 <fd2data>
+  802cf5:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802cf7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802cfa:	83 c4 10             	add    $0x10,%esp
+  802cfd:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  802d03:	39 08                	cmp    %ecx,(%eax)
+  802d05:	75 31                	jne    802d38 <pipe_splice_read+0x6b>
+  802d07:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  802d0b:	74 32                	je     802d3f <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  802d0d:	8b 48 08             	mov    0x8(%eax),%ecx
+  802d10:	83 e1 03             	and    $0x3,%ecx
+  802d13:	83 f9 01             	cmp    $0x1,%ecx
+  802d16:	74 2e                	je     802d46 <pipe_splice_read+0x79>
+  802d18:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  802d1e:	75 2d                	jne    802d4d <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  802d20:	83 ec 08             	sub    $0x8,%esp
+  802d23:	53                   	push   %ebx
+  802d24:	68 00 10 00 00       	push   $0x1000
+  802d29:	89 d9                	mov    %ebx,%ecx
+  802d2b:	e8 93 fa ff ff       	call   8027c3 <devpipe_read_bulk>
+  802d30:	83 c4 10             	add    $0x10,%esp
+}
+  802d33:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802d36:	c9                   	leave
+  802d37:	c3                   	ret
+    return -E_INVAL;
+  802d38:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d3d:	eb f4                	jmp    802d33 <pipe_splice_read+0x66>
+  802d3f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d44:	eb ed                	jmp    802d33 <pipe_splice_read+0x66>
+  802d46:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d4b:	eb e6                	jmp    802d33 <pipe_splice_read+0x66>
+  802d4d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d52:	eb df                	jmp    802d33 <pipe_splice_read+0x66>
+
+00802d54 <mmap_find>:
+          utf->utf_eip, utf->utf_err);
+}
+
+static struct Mmap *
+mmap_find(uintptr_t va)
+{
+  802d54:	55                   	push   %ebp
+  802d55:	89 e5                	mov    %esp,%ebp
+  802d57:	56                   	push   %esi
+  802d58:	53                   	push   %ebx
+  int i;
+
+  for (i = 0; i < NMMAP; i++)
+  802d59:	ba 60 57 80 00       	mov    $0x805760,%edx
+  802d5e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d63:	eb 0b                	jmp    802d70 <mmap_find+0x1c>
+  802d65:	83 c3 01             	add    $0x1,%ebx
+  802d68:	83 c2 14             	add    $0x14,%edx
+  802d6b:	83 fb 10             	cmp    $0x10,%ebx
+  802d6e:	74 1d                	je     802d8d <mmap_find+0x39>
+    if (mmaps[i].mm_va && va >= mmaps[i].mm_va &&
+  802d70:	8b 0a                	mov    (%edx),%ecx
+  802d72:	39 c8                	cmp    %ecx,%eax
+  802d74:	72 ef                	jb     802d65 <mmap_find+0x11>
+  802d76:	85 c9                	test   %ecx,%ecx
+  802d78:	74 eb                	je     802d65 <mmap_find+0x11>
+        va < mmaps[i].mm_va + mmaps[i].mm_len)
+  802d7a:	03 4a 04             	add    0x4(%edx),%ecx
+    if (mmaps[i].mm_va && va >= mmaps[i].mm_va &&
+  802d7d:	39 c8                	cmp    %ecx,%eax
+  802d7f:	73 e4                	jae    802d65 <mmap_find+0x11>
+      return &mmaps[i];
+  802d81:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802d84:	8d 04 85 60 57 80 00 	lea    0x805760(,%eax,4),%eax
+  802d8b:	eb 05                	jmp    802d92 <mmap_find+0x3e>
+  return NULL;
+  802d8d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802d92:	5b                   	pop    %ebx
+  802d93:	5e                   	pop    %esi
+  802d94:	5d                   	pop    %ebp
+  802d95:	c3                   	ret
+
+00802d96 <va_mapped>:
+
+static bool
+va_mapped(uintptr_t va)
+{
+  return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+  802d96:	89 c2                	mov    %eax,%edx
+  802d98:	c1 ea 16             	shr    $0x16,%edx
+  802d9b:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802da2:	f6 c2 01             	test   $0x1,%dl
+  802da5:	74 11                	je     802db8 <va_mapped+0x22>
+  802da7:	c1 e8 0c             	shr    $0xc,%eax
+  802daa:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802db1:	83 e0 01             	and    $0x1,%eax
+  802db4:	83 e0 01             	and    $0x1,%eax
+}
+  802db7:	c3                   	ret
+  return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+  802db8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802dbd:	eb f5                	jmp    802db4 <va_mapped+0x1e>
+
+00802dbf <mmap_copy>:
+
+// Replace the page at 'va' with a copy of its first 'n' bytes, the rest
+// zeroed, mapped with 'perm'.
+static void
+mmap_copy(uintptr_t va, size_t n, int perm)
+{
+  802dbf:	55                   	push   %ebp
+  802dc0:	89 e5                	mov    %esp,%ebp
+  802dc2:	57                   	push   %edi
+  802dc3:	56                   	push   %esi
+  802dc4:	53                   	push   %ebx
+  802dc5:	83 ec 10             	sub    $0x10,%esp
+  802dc8:	89 c3                	mov    %eax,%ebx
+  802dca:	89 d7                	mov    %edx,%edi
+  802dcc:	89 ce                	mov    %ecx,%esi
+  int r;
+
+  if ((r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  802dce:	6a 07                	push   $0x7
+  802dd0:	68 00 f0 7f 00       	push   $0x7ff000
+  802dd5:	6a 00                	push   $0x0
+  802dd7:	e8 f8 dd ff ff       	call   800bd4 <sys_page_alloc>
+  802ddc:	83 c4 10             	add    $0x10,%esp
+  802ddf:	85 c0                	test   %eax,%eax
+  802de1:	78 46                	js     802e29 <mmap_copy+0x6a>
+    panic("mmap: %e", r);
+  memmove(PFTEMP, (void *) va, n);
+  802de3:	83 ec 04             	sub    $0x4,%esp
+  802de6:	57                   	push   %edi
+  802de7:	53                   	push   %ebx
+  802de8:	68 00 f0 7f 00       	push   $0x7ff000
+  802ded:	e8 39 db ff ff       	call   80092b <memmove>
+  if ((r = sys_page_map(0, PFTEMP, 0, (void *) va, perm)) < 0 ||
+  802df2:	89 34 24             	mov    %esi,(%esp)
+  802df5:	53                   	push   %ebx
+  802df6:	6a 00                	push   $0x0
+  802df8:	68 00 f0 7f 00       	push   $0x7ff000
+  802dfd:	6a 00                	push   $0x0
+  802dff:	e8 13 de ff ff       	call   800c17 <sys_page_map>
+  802e04:	83 c4 20             	add    $0x20,%esp
+  802e07:	85 c0                	test   %eax,%eax
+  802e09:	78 30                	js     802e3b <mmap_copy+0x7c>
+      (r = sys_page_unmap(0, PFTEMP)) < 0)
+  802e0b:	83 ec 08             	sub    $0x8,%esp
+  802e0e:	68 00 f0 7f 00       	push   $0x7ff000
+  802e13:	6a 00                	push   $0x0
+  802e15:	e8 3f de ff ff       	call   800c59 <sys_page_unmap>
+  if ((r = sys_page_map(0, PFTEMP, 0, (void *) va, perm)) < 0 ||
+  802e1a:	83 c4 10             	add    $0x10,%esp
+  802e1d:	85 c0                	test   %eax,%eax
+  802e1f:	78 1a                	js     802e3b <mmap_copy+0x7c>
+    panic("mmap: %e", r);
+}
+  802e21:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e24:	5b                   	pop    %ebx
+  802e25:	5e                   	pop    %esi
+  802e26:	5f                   	pop    %edi
+  802e27:	5d                   	pop    %ebp
+  802e28:	c3                   	ret
+    panic("mmap: %e", r);
+  802e29:	50                   	push   %eax
+  802e2a:	68 33 3f 80 00       	push   $0x803f33
+  802e2f:	6a 3e                	push   $0x3e
+  802e31:	68 3c 3f 80 00       	push   $0x803f3c
+  802e36:	e8 a1 06 00 00       	call   8034dc <_panic>
+    panic("mmap: %e", r);
+  802e3b:	50                   	push   %eax
+  802e3c:	68 33 3f 80 00       	push   $0x803f33
+  802e41:	6a 42                	push   $0x42
+  802e43:	68 3c 3f 80 00       	push   $0x803f3c
+  802e48:	e8 8f 06 00 00       	call   8034dc <_panic>
+
+00802e4d <mmap_fault>:
+// Handle a page fault in a mapping, if it is one.  Returns 1 if it was.
+// The fork page fault handlers call this first, so that mappings keep
+// working after a fork.
+bool
+mmap_fault(struct UTrapframe *utf)
+{
+  802e4d:	55                   	push   %ebp
+  802e4e:	89 e5                	mov    %esp,%ebp
+  802e50:	57                   	push   %edi
+  802e51:	56                   	push   %esi
+  802e52:	53                   	push   %ebx
+  802e53:	83 ec 1c             	sub    $0x1c,%esp
+  802e56:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Fsreq_read_map saved;
+  struct Mmap *m;
+  uintptr_t va;
+  int perm, r;
+
+  va = ROUNDDOWN(utf->utf_fault_va, PGSIZE);
+  802e59:	8b 1f                	mov    (%edi),%ebx
+  802e5b:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if (va < MMAPBASE || va >= MMAPTOP || (m = mmap_find(va)) == NULL)
+  802e61:	8d 83 00 00 00 60    	lea    0x60000000(%ebx),%eax
+  802e67:	3d ff ff ff 2f       	cmp    $0x2fffffff,%eax
+  802e6c:	0f 87 24 01 00 00    	ja     802f96 <mmap_fault+0x149>
+  802e72:	89 d8                	mov    %ebx,%eax
+  802e74:	e8 db fe ff ff       	call   802d54 <mmap_find>
+  802e79:	89 c6                	mov    %eax,%esi
+  802e7b:	85 c0                	test   %eax,%eax
+  802e7d:	0f 84 20 01 00 00    	je     802fa3 <mmap_fault+0x156>
+    return 0;
+  if ((utf->utf_err & FEC_WR) && m->mm_perm == MAP_RDONLY)
+  802e83:	f6 47 04 02          	testb  $0x2,0x4(%edi)
+  802e87:	74 13                	je     802e9c <mmap_fault+0x4f>
+  802e89:	83 78 10 00          	cmpl   $0x0,0x10(%eax)
+  802e8d:	0f 84 17 01 00 00    	je     802faa <mmap_fault+0x15d>
+    return 0;
+  perm = PTE_P | PTE_U | (m->mm_perm == MAP_RDONLY ? 0 : PTE_W);
+  802e93:	c7 45 e4 07 00 00 00 	movl   $0x7,-0x1c(%ebp)
+  802e9a:	eb 0f                	jmp    802eab <mmap_fault+0x5e>
+  802e9c:	83 78 10 01          	cmpl   $0x1,0x10(%eax)
+  802ea0:	19 c0                	sbb    %eax,%eax
+  802ea2:	83 e0 fe             	and    $0xfffffffe,%eax
+  802ea5:	83 c0 07             	add    $0x7,%eax
+  802ea8:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+
+  if (!va_mapped(va)) {
+  802eab:	89 d8                	mov    %ebx,%eax
+  802ead:	e8 e4 fe ff ff       	call   802d96 <va_mapped>
+  802eb2:	84 c0                	test   %al,%al
+  802eb4:	74 42                	je     802ef8 <mmap_fault+0xab>
+    }
+  }
+
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+    mmap_copy(va, PGSIZE, perm);
+  return 1;
+  802eb6:	b8 01 00 00 00       	mov    $0x1,%eax
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+  802ebb:	f6 47 04 02          	testb  $0x2,0x4(%edi)
+  802ebf:	0f 84 d6 00 00 00    	je     802f9b <mmap_fault+0x14e>
+  802ec5:	89 d8                	mov    %ebx,%eax
+  802ec7:	c1 e8 0c             	shr    $0xc,%eax
+  802eca:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  return 1;
+  802ed1:	b8 01 00 00 00       	mov    $0x1,%eax
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+  802ed6:	f6 c2 02             	test   $0x2,%dl
+  802ed9:	0f 85 bc 00 00 00    	jne    802f9b <mmap_fault+0x14e>
+    mmap_copy(va, PGSIZE, perm);
+  802edf:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802ee2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802ee7:	89 d8                	mov    %ebx,%eax
+  802ee9:	e8 d1 fe ff ff       	call   802dbf <mmap_copy>
+  return 1;
+  802eee:	b8 01 00 00 00       	mov    $0x1,%eax
+  802ef3:	e9 a3 00 00 00       	jmp    802f9b <mmap_fault+0x14e>
+    saved = fsipcbuf.read_map;
+  802ef8:	a1 00 60 80 00       	mov    0x806000,%eax
+  802efd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802f00:	8b 15 04 60 80 00    	mov    0x806004,%edx
+  802f06:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    r = read_map(m->mm_fd, m->mm_offset + (va - m->mm_va), (void *) va);
+  802f09:	83 ec 04             	sub    $0x4,%esp
+  802f0c:	53                   	push   %ebx
+  802f0d:	89 d8                	mov    %ebx,%eax
+  802f0f:	03 46 0c             	add    0xc(%esi),%eax
+  802f12:	2b 06                	sub    (%esi),%eax
+  802f14:	50                   	push   %eax
+  802f15:	ff 76 08             	push   0x8(%esi)
+  802f18:	e8 86 f3 ff ff       	call   8022a3 <read_map>
+    fsipcbuf.read_map = saved;
+  802f1d:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802f20:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+  802f26:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  802f29:	89 15 04 60 80 00    	mov    %edx,0x806004
+    if (r < 0)
+  802f2f:	83 c4 10             	add    $0x10,%esp
+  802f32:	85 c0                	test   %eax,%eax
+  802f34:	78 20                	js     802f56 <mmap_fault+0x109>
+    if (r == 0) {
+  802f36:	74 30                	je     802f68 <mmap_fault+0x11b>
+    if (r < PGSIZE) {
+  802f38:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  802f3d:	0f 8f 73 ff ff ff    	jg     802eb6 <mmap_fault+0x69>
+      mmap_copy(va, r, perm);
+  802f43:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802f46:	89 c2                	mov    %eax,%edx
+  802f48:	89 d8                	mov    %ebx,%eax
+  802f4a:	e8 70 fe ff ff       	call   802dbf <mmap_copy>
+      return 1;
+  802f4f:	b8 01 00 00 00       	mov    $0x1,%eax
+  802f54:	eb 45                	jmp    802f9b <mmap_fault+0x14e>
+      panic("mmap: read_map: %e", r);
+  802f56:	50                   	push   %eax
+  802f57:	68 47 3f 80 00       	push   $0x803f47
+  802f5c:	6a 5f                	push   $0x5f
+  802f5e:	68 3c 3f 80 00       	push   $0x803f3c
+  802f63:	e8 74 05 00 00       	call   8034dc <_panic>
+      if ((r = sys_page_alloc(0, (void *) va, perm)) < 0)
+  802f68:	83 ec 04             	sub    $0x4,%esp
+  802f6b:	ff 75 e4             	push   -0x1c(%ebp)
+  802f6e:	53                   	push   %ebx
+  802f6f:	6a 00                	push   $0x0
+  802f71:	e8 5e dc ff ff       	call   800bd4 <sys_page_alloc>
+  802f76:	83 c4 10             	add    $0x10,%esp
+  802f79:	85 c0                	test   %eax,%eax
+  802f7b:	78 07                	js     802f84 <mmap_fault+0x137>
+      return 1;
+  802f7d:	b8 01 00 00 00       	mov    $0x1,%eax
+  802f82:	eb 17                	jmp    802f9b <mmap_fault+0x14e>
+        panic("mmap: %e", r);
+  802f84:	50                   	push   %eax
+  802f85:	68 33 3f 80 00       	push   $0x803f33
+  802f8a:	6a 64                	push   $0x64
+  802f8c:	68 3c 3f 80 00       	push   $0x803f3c
+  802f91:	e8 46 05 00 00       	call   8034dc <_panic>
+    return 0;
+  802f96:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802f9b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f9e:	5b                   	pop    %ebx
+  802f9f:	5e                   	pop    %esi
+  802fa0:	5f                   	pop    %edi
+  802fa1:	5d                   	pop    %ebp
+  802fa2:	c3                   	ret
+    return 0;
+  802fa3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fa8:	eb f1                	jmp    802f9b <mmap_fault+0x14e>
+    return 0;
+  802faa:	b8 00 00 00 00       	mov    $0x0,%eax
+  802faf:	eb ea                	jmp    802f9b <mmap_fault+0x14e>
+
+00802fb1 <mmap_pgfault>:
+{
+  802fb1:	55                   	push   %ebp
+  802fb2:	89 e5                	mov    %esp,%ebp
+  802fb4:	53                   	push   %ebx
+  802fb5:	83 ec 10             	sub    $0x10,%esp
+  802fb8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (!mmap_fault(utf))
+  802fbb:	53                   	push   %ebx
+  802fbc:	e8 8c fe ff ff       	call   802e4d <mmap_fault>
+  802fc1:	83 c4 10             	add    $0x10,%esp
+  802fc4:	84 c0                	test   %al,%al
+  802fc6:	74 05                	je     802fcd <mmap_pgfault+0x1c>
+}
+  802fc8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802fcb:	c9                   	leave
+  802fcc:	c3                   	ret
+    panic("page fault at %08x, eip %08x, err %04x", utf->utf_fault_va,
+  802fcd:	83 ec 08             	sub    $0x8,%esp
+  802fd0:	ff 73 04             	push   0x4(%ebx)
+  802fd3:	ff 73 28             	push   0x28(%ebx)
+  802fd6:	ff 33                	push   (%ebx)
+  802fd8:	68 5c 3f 80 00       	push   $0x803f5c
+  802fdd:	6a 20                	push   $0x20
+  802fdf:	68 3c 3f 80 00       	push   $0x803f3c
+  802fe4:	e8 f3 04 00 00       	call   8034dc <_panic>
+
+00802fe9 <mmap>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_INVAL if offset isn't aligned, len is 0, or perm is unknown
+//	-E_NO_MEM if there's no free slot or address space for it
+int
+mmap(int fdnum, off_t offset, size_t len, int perm, void **addr)
+{
+  802fe9:	55                   	push   %ebp
+  802fea:	89 e5                	mov    %esp,%ebp
+  802fec:	57                   	push   %edi
+  802fed:	56                   	push   %esi
+  802fee:	53                   	push   %ebx
+  802fef:	83 ec 44             	sub    $0x44,%esp
+  802ff2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  struct Fd *fd;
+  uintptr_t va;
+  int i, j, r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802ff5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802ff8:	50                   	push   %eax
+  802ff9:	ff 75 08             	push   0x8(%ebp)
+  802ffc:	e8 30 e5 ff ff       	call   801531 <fd_lookup>
+  803001:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  803004:	83 c4 10             	add    $0x10,%esp
+  803007:	85 c0                	test   %eax,%eax
+  803009:	0f 88 3e 01 00 00    	js     80314d <mmap+0x164>
+    return r;
+  if (offset < 0 || PGOFF(offset) || len == 0 ||
+  80300f:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  803013:	0f 88 d1 00 00 00    	js     8030ea <mmap+0x101>
+  803019:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80301c:	25 ff 0f 00 00       	and    $0xfff,%eax
+  803021:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  803024:	0f 85 c9 00 00 00    	jne    8030f3 <mmap+0x10a>
+  80302a:	85 db                	test   %ebx,%ebx
+  80302c:	0f 84 ca 00 00 00    	je     8030fc <mmap+0x113>
+  803032:	83 7d 14 02          	cmpl   $0x2,0x14(%ebp)
+  803036:	0f 87 c0 00 00 00    	ja     8030fc <mmap+0x113>
+      (perm != MAP_RDONLY && perm != MAP_PRIVATE && perm != MAP_SHARED))
+    return -E_INVAL;
+  len = ROUNDUP(len, PGSIZE);
+  80303c:	81 c3 ff 0f 00 00    	add    $0xfff,%ebx
+  803042:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  803048:	89 d9                	mov    %ebx,%ecx
+  80304a:	89 5d c4             	mov    %ebx,-0x3c(%ebp)
+
+  // First fit: try the start of the region and the end of each
+  // mapping.
+  for (i = -1; i < NMMAP; i++) {
+  80304d:	bb 4c 57 80 00       	mov    $0x80574c,%ebx
+  803052:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+    if (i >= 0 && !mmaps[i].mm_va)
+      continue;
+    va = i < 0 ? MMAPBASE : mmaps[i].mm_va + mmaps[i].mm_len;
+  803057:	bf 00 00 00 a0       	mov    $0xa0000000,%edi
+  80305c:	eb 53                	jmp    8030b1 <mmap+0xc8>
+  80305e:	bf 00 00 00 a0       	mov    $0xa0000000,%edi
+  803063:	eb 4c                	jmp    8030b1 <mmap+0xc8>
+    if (len > MMAPTOP - va)
+      continue;
+    for (j = 0; j < NMMAP; j++)
+  803065:	83 c0 01             	add    $0x1,%eax
+  803068:	83 f8 10             	cmp    $0x10,%eax
+  80306b:	0f 84 e7 00 00 00    	je     803158 <mmap+0x16f>
+      if (mmaps[j].mm_va && va < mmaps[j].mm_va + mmaps[j].mm_len &&
+  803071:	8d 34 80             	lea    (%eax,%eax,4),%esi
+  803074:	8b 14 b5 60 57 80 00 	mov    0x805760(,%esi,4),%edx
+  80307b:	85 d2                	test   %edx,%edx
+  80307d:	74 e6                	je     803065 <mmap+0x7c>
+  80307f:	89 d1                	mov    %edx,%ecx
+  803081:	03 0c b5 64 57 80 00 	add    0x805764(,%esi,4),%ecx
+  803088:	39 cf                	cmp    %ecx,%edi
+  80308a:	73 d9                	jae    803065 <mmap+0x7c>
+  80308c:	39 da                	cmp    %ebx,%edx
+  80308e:	73 d5                	jae    803065 <mmap+0x7c>
+  803090:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  803093:	8b 55 cc             	mov    -0x34(%ebp),%edx
+  803096:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  for (i = -1; i < NMMAP; i++) {
+  803099:	83 c2 01             	add    $0x1,%edx
+  80309c:	83 c3 14             	add    $0x14,%ebx
+  80309f:	83 fa 10             	cmp    $0x10,%edx
+  8030a2:	74 2b                	je     8030cf <mmap+0xe6>
+    if (i >= 0 && !mmaps[i].mm_va)
+  8030a4:	85 d2                	test   %edx,%edx
+  8030a6:	78 b6                	js     80305e <mmap+0x75>
+  8030a8:	8b 3b                	mov    (%ebx),%edi
+  8030aa:	85 ff                	test   %edi,%edi
+  8030ac:	74 eb                	je     803099 <mmap+0xb0>
+    va = i < 0 ? MMAPBASE : mmaps[i].mm_va + mmaps[i].mm_len;
+  8030ae:	03 7b 04             	add    0x4(%ebx),%edi
+    if (len > MMAPTOP - va)
+  8030b1:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  8030b6:	29 f8                	sub    %edi,%eax
+  8030b8:	39 c8                	cmp    %ecx,%eax
+  8030ba:	72 dd                	jb     803099 <mmap+0xb0>
+    for (j = 0; j < NMMAP; j++)
+  8030bc:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+          mmaps[j].mm_va < va + len)
+  8030bf:	8d 34 0f             	lea    (%edi,%ecx,1),%esi
+  8030c2:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  8030c5:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  8030c8:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+  8030cb:	89 f3                	mov    %esi,%ebx
+  8030cd:	eb a2                	jmp    803071 <mmap+0x88>
+        break;
+    if (j == NMMAP)
+      break;
+  }
+  if (i == NMMAP)
+    return -E_NO_MEM;
+  8030cf:	c7 45 d4 fc ff ff ff 	movl   $0xfffffffc,-0x2c(%ebp)
+  8030d6:	eb 75                	jmp    80314d <mmap+0x164>
+    ;
+  if (j == NMMAP)
+    return -E_NO_MEM;
+
+  if (_pgfault_handler == 0)
+    set_pgfault_handler(mmap_pgfault);
+  8030d8:	83 ec 0c             	sub    $0xc,%esp
+  8030db:	68 b1 2f 80 00       	push   $0x802fb1
+  8030e0:	e8 3d 04 00 00       	call   803522 <set_pgfault_handler>
+  8030e5:	83 c4 10             	add    $0x10,%esp
+  8030e8:	eb 24                	jmp    80310e <mmap+0x125>
+    return -E_INVAL;
+  8030ea:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  8030f1:	eb 5a                	jmp    80314d <mmap+0x164>
+  8030f3:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  8030fa:	eb 51                	jmp    80314d <mmap+0x164>
+  8030fc:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  803103:	eb 48                	jmp    80314d <mmap+0x164>
+  if (_pgfault_handler == 0)
+  803105:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  80310c:	74 ca                	je     8030d8 <mmap+0xef>
+
+  mmaps[j].mm_va = va;
+  80310e:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803115:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803118:	c1 e2 02             	shl    $0x2,%edx
+  80311b:	89 ba 60 57 80 00    	mov    %edi,0x805760(%edx)
+  mmaps[j].mm_len = len;
+  803121:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  803124:	89 b2 64 57 80 00    	mov    %esi,0x805764(%edx)
+  mmaps[j].mm_fd = fdnum;
+  80312a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80312d:	89 b2 68 57 80 00    	mov    %esi,0x805768(%edx)
+  mmaps[j].mm_offset = offset;
+  803133:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803136:	89 b2 6c 57 80 00    	mov    %esi,0x80576c(%edx)
+  mmaps[j].mm_perm = perm;
+  80313c:	01 d8                	add    %ebx,%eax
+  80313e:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  803141:	89 1c 85 70 57 80 00 	mov    %ebx,0x805770(,%eax,4)
+  *addr = (void *) va;
+  803148:	8b 45 18             	mov    0x18(%ebp),%eax
+  80314b:	89 38                	mov    %edi,(%eax)
+  return 0;
+}
+  80314d:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  803150:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803153:	5b                   	pop    %ebx
+  803154:	5e                   	pop    %esi
+  803155:	5f                   	pop    %edi
+  803156:	5d                   	pop    %ebp
+  803157:	c3                   	ret
+  if (i == NMMAP)
+  803158:	b8 60 57 80 00       	mov    $0x805760,%eax
+  for (j = 0; j < NMMAP && mmaps[j].mm_va; j++)
+  80315d:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+  803160:	83 c0 14             	add    $0x14,%eax
+  803163:	83 78 ec 00          	cmpl   $0x0,-0x14(%eax)
+  803167:	74 9c                	je     803105 <mmap+0x11c>
+  803169:	83 c3 01             	add    $0x1,%ebx
+  80316c:	83 fb 10             	cmp    $0x10,%ebx
+  80316f:	75 ef                	jne    803160 <mmap+0x177>
+    return -E_NO_MEM;
+  803171:	c7 45 d4 fc ff ff ff 	movl   $0xfffffffc,-0x2c(%ebp)
+  803178:	eb d3                	jmp    80314d <mmap+0x164>
+
+0080317a <msync>:
+// nothing for other kinds of mapping.
+//
+// Returns 0 on success, < 0 on error.
+int
+msync(void *addr)
+{
+  80317a:	55                   	push   %ebp
+  80317b:	89 e5                	mov    %esp,%ebp
+  80317d:	57                   	push   %edi
+  80317e:	56                   	push   %esi
+  80317f:	53                   	push   %ebx
+  803180:	81 ec ac 00 00 00    	sub    $0xac,%esp
+  struct Stat st;
+  off_t saved, off;
+  uintptr_t va;
+  int n, r;
+
+  if ((m = mmap_find((uintptr_t) addr)) == NULL)
+  803186:	8b 45 08             	mov    0x8(%ebp),%eax
+  803189:	e8 c6 fb ff ff       	call   802d54 <mmap_find>
+  80318e:	85 c0                	test   %eax,%eax
+  803190:	0f 84 58 01 00 00    	je     8032ee <msync+0x174>
+  803196:	89 c7                	mov    %eax,%edi
+    return -E_INVAL;
+  if (m->mm_perm != MAP_SHARED)
+    return 0;
+  803198:	bb 00 00 00 00       	mov    $0x0,%ebx
+  if (m->mm_perm != MAP_SHARED)
+  80319d:	83 78 10 02          	cmpl   $0x2,0x10(%eax)
+  8031a1:	74 0a                	je     8031ad <msync+0x33>
+                          PTE_P | PTE_U | PTE_W)) < 0)
+      break;
+  }
+  fd->fd_offset = saved;
+  return r < 0 ? r : 0;
+}
+  8031a3:	89 d8                	mov    %ebx,%eax
+  8031a5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8031a8:	5b                   	pop    %ebx
+  8031a9:	5e                   	pop    %esi
+  8031aa:	5f                   	pop    %edi
+  8031ab:	5d                   	pop    %ebp
+  8031ac:	c3                   	ret
+  if ((r = fd_lookup(m->mm_fd, &fd)) < 0 || (r = fstat(m->mm_fd, &st)) < 0)
+  8031ad:	83 ec 08             	sub    $0x8,%esp
+  8031b0:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8031b3:	50                   	push   %eax
+  8031b4:	ff 77 08             	push   0x8(%edi)
+  8031b7:	e8 75 e3 ff ff       	call   801531 <fd_lookup>
+  8031bc:	89 c3                	mov    %eax,%ebx
+  8031be:	83 c4 10             	add    $0x10,%esp
+  8031c1:	85 c0                	test   %eax,%eax
+  8031c3:	78 de                	js     8031a3 <msync+0x29>
+  8031c5:	83 ec 08             	sub    $0x8,%esp
+  8031c8:	8d 85 58 ff ff ff    	lea    -0xa8(%ebp),%eax
+  8031ce:	50                   	push   %eax
+  8031cf:	ff 77 08             	push   0x8(%edi)
+  8031d2:	e8 fd e7 ff ff       	call   8019d4 <fstat>
+  8031d7:	89 c3                	mov    %eax,%ebx
+  8031d9:	83 c4 10             	add    $0x10,%esp
+  8031dc:	85 c0                	test   %eax,%eax
+  8031de:	78 c3                	js     8031a3 <msync+0x29>
+  saved = fd->fd_offset;
+  8031e0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8031e3:	8b 40 04             	mov    0x4(%eax),%eax
+  8031e6:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%ebp)
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE) {
+  8031ec:	8b 37                	mov    (%edi),%esi
+  8031ee:	eb 29                	jmp    803219 <msync+0x9f>
+    if ((r = sys_page_map(0, (void *) va, 0, (void *) va,
+  8031f0:	83 ec 0c             	sub    $0xc,%esp
+  8031f3:	6a 07                	push   $0x7
+  8031f5:	8b 85 50 ff ff ff    	mov    -0xb0(%ebp),%eax
+  8031fb:	50                   	push   %eax
+  8031fc:	6a 00                	push   $0x0
+  8031fe:	50                   	push   %eax
+  8031ff:	6a 00                	push   $0x0
+  803201:	e8 11 da ff ff       	call   800c17 <sys_page_map>
+  803206:	89 c3                	mov    %eax,%ebx
+  803208:	83 c4 20             	add    $0x20,%esp
+  80320b:	85 c0                	test   %eax,%eax
+  80320d:	0f 88 c0 00 00 00    	js     8032d3 <msync+0x159>
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE) {
+  803213:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803219:	8b 07                	mov    (%edi),%eax
+  80321b:	89 85 54 ff ff ff    	mov    %eax,-0xac(%ebp)
+  803221:	03 47 04             	add    0x4(%edi),%eax
+  803224:	39 c6                	cmp    %eax,%esi
+  803226:	0f 83 a7 00 00 00    	jae    8032d3 <msync+0x159>
+    if (!va_mapped(va) || !(uvpt[PGNUM(va)] & PTE_D))
+  80322c:	89 f0                	mov    %esi,%eax
+  80322e:	e8 63 fb ff ff       	call   802d96 <va_mapped>
+  803233:	84 c0                	test   %al,%al
+  803235:	74 dc                	je     803213 <msync+0x99>
+  803237:	89 f0                	mov    %esi,%eax
+  803239:	c1 e8 0c             	shr    $0xc,%eax
+  80323c:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803243:	a8 40                	test   $0x40,%al
+  803245:	74 cc                	je     803213 <msync+0x99>
+    off = m->mm_offset + (va - m->mm_va);
+  803247:	8b 47 0c             	mov    0xc(%edi),%eax
+  80324a:	8b 8d 54 ff ff ff    	mov    -0xac(%ebp),%ecx
+  803250:	29 c8                	sub    %ecx,%eax
+  803252:	01 f0                	add    %esi,%eax
+    if (off >= st.st_size)
+  803254:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  803257:	39 c2                	cmp    %eax,%edx
+  803259:	7e 78                	jle    8032d3 <msync+0x159>
+    n = MIN(PGSIZE, st.st_size - off);
+  80325b:	29 c2                	sub    %eax,%edx
+  80325d:	89 d1                	mov    %edx,%ecx
+  80325f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803264:	39 d1                	cmp    %edx,%ecx
+  803266:	0f 4e d1             	cmovle %ecx,%edx
+  803269:	89 95 54 ff ff ff    	mov    %edx,-0xac(%ebp)
+    if ((r = seek(m->mm_fd, off)) < 0 ||
+  80326f:	83 ec 08             	sub    $0x8,%esp
+  803272:	50                   	push   %eax
+  803273:	ff 77 08             	push   0x8(%edi)
+  803276:	e8 b1 e6 ff ff       	call   80192c <seek>
+  80327b:	89 c3                	mov    %eax,%ebx
+  80327d:	83 c4 10             	add    $0x10,%esp
+  803280:	85 c0                	test   %eax,%eax
+  803282:	78 4f                	js     8032d3 <msync+0x159>
+        (r = write(m->mm_fd, (void *) va, n)) < 0)
+  803284:	89 b5 50 ff ff ff    	mov    %esi,-0xb0(%ebp)
+  80328a:	83 ec 04             	sub    $0x4,%esp
+  80328d:	ff b5 54 ff ff ff    	push   -0xac(%ebp)
+  803293:	56                   	push   %esi
+  803294:	ff 77 08             	push   0x8(%edi)
+  803297:	e8 0e e6 ff ff       	call   8018aa <write>
+  80329c:	89 c3                	mov    %eax,%ebx
+    if ((r = seek(m->mm_fd, off)) < 0 ||
+  80329e:	83 c4 10             	add    $0x10,%esp
+  8032a1:	85 c0                	test   %eax,%eax
+  8032a3:	78 2e                	js     8032d3 <msync+0x159>
+    if (r < n && (r = write(m->mm_fd, (char *) va + r, n - r)) < 0)
+  8032a5:	8b 95 54 ff ff ff    	mov    -0xac(%ebp),%edx
+  8032ab:	39 c2                	cmp    %eax,%edx
+  8032ad:	0f 8e 3d ff ff ff    	jle    8031f0 <msync+0x76>
+  8032b3:	89 d0                	mov    %edx,%eax
+  8032b5:	29 d8                	sub    %ebx,%eax
+  8032b7:	01 f3                	add    %esi,%ebx
+  8032b9:	83 ec 04             	sub    $0x4,%esp
+  8032bc:	50                   	push   %eax
+  8032bd:	53                   	push   %ebx
+  8032be:	ff 77 08             	push   0x8(%edi)
+  8032c1:	e8 e4 e5 ff ff       	call   8018aa <write>
+  8032c6:	89 c3                	mov    %eax,%ebx
+  8032c8:	83 c4 10             	add    $0x10,%esp
+  8032cb:	85 c0                	test   %eax,%eax
+  8032cd:	0f 89 1d ff ff ff    	jns    8031f0 <msync+0x76>
+  fd->fd_offset = saved;
+  8032d3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8032d6:	8b 8d 4c ff ff ff    	mov    -0xb4(%ebp),%ecx
+  8032dc:	89 48 04             	mov    %ecx,0x4(%eax)
+  return r < 0 ? r : 0;
+  8032df:	85 db                	test   %ebx,%ebx
+  8032e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8032e6:	0f 4f d8             	cmovg  %eax,%ebx
+  8032e9:	e9 b5 fe ff ff       	jmp    8031a3 <msync+0x29>
+    return -E_INVAL;
+  8032ee:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8032f3:	e9 ab fe ff ff       	jmp    8031a3 <msync+0x29>
+
+008032f8 <munmap>:
+// Remove the mapping at 'addr', writing a MAP_SHARED one back first.
+//
+// Returns 0 on success, < 0 on error.
+int
+munmap(void *addr)
+{
+  8032f8:	55                   	push   %ebp
+  8032f9:	89 e5                	mov    %esp,%ebp
+  8032fb:	56                   	push   %esi
+  8032fc:	53                   	push   %ebx
+  8032fd:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct Mmap *m;
+  uintptr_t va;
+  int r;
+
+  if ((m = mmap_find((uintptr_t) addr)) == NULL)
+  803300:	89 d8                	mov    %ebx,%eax
+  803302:	e8 4d fa ff ff       	call   802d54 <mmap_find>
+  803307:	85 c0                	test   %eax,%eax
+  803309:	74 56                	je     803361 <munmap+0x69>
+  80330b:	89 c6                	mov    %eax,%esi
+    return -E_INVAL;
+  if ((r = msync(addr)) < 0)
+  80330d:	83 ec 0c             	sub    $0xc,%esp
+  803310:	53                   	push   %ebx
+  803311:	e8 64 fe ff ff       	call   80317a <msync>
+  803316:	83 c4 10             	add    $0x10,%esp
+  803319:	85 c0                	test   %eax,%eax
+  80331b:	78 3d                	js     80335a <munmap+0x62>
+    return r;
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE)
+  80331d:	8b 1e                	mov    (%esi),%ebx
+  80331f:	eb 06                	jmp    803327 <munmap+0x2f>
+  803321:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  803327:	8b 46 04             	mov    0x4(%esi),%eax
+  80332a:	03 06                	add    (%esi),%eax
+  80332c:	39 c3                	cmp    %eax,%ebx
+  80332e:	73 1f                	jae    80334f <munmap+0x57>
+    if (va_mapped(va) && (r = sys_page_unmap(0, (void *) va)) < 0)
+  803330:	89 d8                	mov    %ebx,%eax
+  803332:	e8 5f fa ff ff       	call   802d96 <va_mapped>
+  803337:	84 c0                	test   %al,%al
+  803339:	74 e6                	je     803321 <munmap+0x29>
+  80333b:	83 ec 08             	sub    $0x8,%esp
+  80333e:	53                   	push   %ebx
+  80333f:	6a 00                	push   $0x0
+  803341:	e8 13 d9 ff ff       	call   800c59 <sys_page_unmap>
+  803346:	83 c4 10             	add    $0x10,%esp
+  803349:	85 c0                	test   %eax,%eax
+  80334b:	79 d4                	jns    803321 <munmap+0x29>
+  80334d:	eb 0b                	jmp    80335a <munmap+0x62>
+      return r;
+  m->mm_va = 0;
+  80334f:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  return 0;
+  803355:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80335a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80335d:	5b                   	pop    %ebx
+  80335e:	5e                   	pop    %esi
+  80335f:	5d                   	pop    %ebp
+  803360:	c3                   	ret
+    return -E_INVAL;
+  803361:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803366:	eb f2                	jmp    80335a <munmap+0x62>
+
+00803368 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  803368:	b8 00 00 00 00       	mov    $0x0,%eax
+  80336d:	c3                   	ret
+
+0080336e <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80336e:	55                   	push   %ebp
+  80336f:	89 e5                	mov    %esp,%ebp
+  803371:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  803374:	68 83 3f 80 00       	push   $0x803f83
+  803379:	ff 75 0c             	push   0xc(%ebp)
+  80337c:	e8 24 d4 ff ff       	call   8007a5 <strcpy>
+  return 0;
+}
+  803381:	b8 00 00 00 00       	mov    $0x0,%eax
+  803386:	c9                   	leave
+  803387:	c3                   	ret
+
+00803388 <devcons_write>:
+{
+  803388:	55                   	push   %ebp
+  803389:	89 e5                	mov    %esp,%ebp
+  80338b:	57                   	push   %edi
+  80338c:	56                   	push   %esi
+  80338d:	53                   	push   %ebx
+  80338e:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  803394:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  803399:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  80339f:	eb 2e                	jmp    8033cf <devcons_write+0x47>
+    m = n - tot;
+  8033a1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8033a4:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  8033a6:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8033ab:	39 c3                	cmp    %eax,%ebx
+  8033ad:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  8033b0:	83 ec 04             	sub    $0x4,%esp
+  8033b3:	53                   	push   %ebx
+  8033b4:	89 f0                	mov    %esi,%eax
+  8033b6:	03 45 0c             	add    0xc(%ebp),%eax
+  8033b9:	50                   	push   %eax
+  8033ba:	57                   	push   %edi
+  8033bb:	e8 6b d5 ff ff       	call   80092b <memmove>
+    sys_cputs(buf, m);
+  8033c0:	83 c4 08             	add    $0x8,%esp
+  8033c3:	53                   	push   %ebx
+  8033c4:	57                   	push   %edi
+  8033c5:	e8 0b d7 ff ff       	call   800ad5 <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  8033ca:	01 de                	add    %ebx,%esi
+  8033cc:	83 c4 10             	add    $0x10,%esp
+  8033cf:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8033d2:	72 cd                	jb     8033a1 <devcons_write+0x19>
+}
+  8033d4:	89 f0                	mov    %esi,%eax
+  8033d6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8033d9:	5b                   	pop    %ebx
+  8033da:	5e                   	pop    %esi
+  8033db:	5f                   	pop    %edi
+  8033dc:	5d                   	pop    %ebp
+  8033dd:	c3                   	ret
+
+008033de <devcons_read>:
+{
+  8033de:	55                   	push   %ebp
+  8033df:	89 e5                	mov    %esp,%ebp
+  8033e1:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  8033e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033e9:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8033ed:	75 07                	jne    8033f6 <devcons_read+0x18>
+  8033ef:	eb 1f                	jmp    803410 <devcons_read+0x32>
+    sys_yield();
+  8033f1:	e8 7c d7 ff ff       	call   800b72 <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  8033f6:	e8 f8 d6 ff ff       	call   800af3 <sys_cgetc>
+  8033fb:	85 c0                	test   %eax,%eax
+  8033fd:	74 f2                	je     8033f1 <devcons_read+0x13>
+  if (c < 0)
+  8033ff:	78 0f                	js     803410 <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  803401:	83 f8 04             	cmp    $0x4,%eax
+  803404:	74 0c                	je     803412 <devcons_read+0x34>
+  *(char*)vbuf = c;
+  803406:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803409:	88 02                	mov    %al,(%edx)
+  return 1;
+  80340b:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  803410:	c9                   	leave
+  803411:	c3                   	ret
+    return 0;
+  803412:	b8 00 00 00 00       	mov    $0x0,%eax
+  803417:	eb f7                	jmp    803410 <devcons_read+0x32>
+
+00803419 <cputchar>:
+{
+  803419:	55                   	push   %ebp
+  80341a:	89 e5                	mov    %esp,%ebp
+  80341c:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  80341f:	8b 45 08             	mov    0x8(%ebp),%eax
+  803422:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  803425:	6a 01                	push   $0x1
+  803427:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80342a:	50                   	push   %eax
+  80342b:	e8 a5 d6 ff ff       	call   800ad5 <sys_cputs>
+}
+  803430:	83 c4 10             	add    $0x10,%esp
+  803433:	c9                   	leave
+  803434:	c3                   	ret
+
+00803435 <getchar>:
+{
+  803435:	55                   	push   %ebp
+  803436:	89 e5                	mov    %esp,%ebp
+  803438:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  80343b:	6a 01                	push   $0x1
+  80343d:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803440:	50                   	push   %eax
+  803441:	6a 00                	push   $0x0
+  803443:	e8 94 e3 ff ff       	call   8017dc <read>
+  if (r < 0)
+  803448:	83 c4 10             	add    $0x10,%esp
+  80344b:	85 c0                	test   %eax,%eax
+  80344d:	78 06                	js     803455 <getchar+0x20>
+  if (r < 1)
+  80344f:	74 06                	je     803457 <getchar+0x22>
+  return c;
+  803451:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803455:	c9                   	leave
+  803456:	c3                   	ret
+    return -E_EOF;
+  803457:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  80345c:	eb f7                	jmp    803455 <getchar+0x20>
+
+0080345e <iscons>:
+{
+  80345e:	55                   	push   %ebp
+  80345f:	89 e5                	mov    %esp,%ebp
+  803461:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803464:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803467:	50                   	push   %eax
+  803468:	ff 75 08             	push   0x8(%ebp)
+  80346b:	e8 c1 e0 ff ff       	call   801531 <fd_lookup>
+  803470:	83 c4 10             	add    $0x10,%esp
+  803473:	85 c0                	test   %eax,%eax
+  803475:	78 11                	js     803488 <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  803477:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80347a:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  803480:	39 10                	cmp    %edx,(%eax)
+  803482:	0f 94 c0             	sete   %al
+  803485:	0f b6 c0             	movzbl %al,%eax
+}
+  803488:	c9                   	leave
+  803489:	c3                   	ret
+
+0080348a <opencons>:
+{
+  80348a:	55                   	push   %ebp
+  80348b:	89 e5                	mov    %esp,%ebp
+  80348d:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  803490:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803493:	50                   	push   %eax
+  803494:	e8 42 e0 ff ff       	call   8014db <fd_alloc>
+  803499:	83 c4 10             	add    $0x10,%esp
+  80349c:	85 c0                	test   %eax,%eax
+  80349e:	78 3a                	js     8034da <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8034a0:	83 ec 04             	sub    $0x4,%esp
+  8034a3:	68 07 04 00 00       	push   $0x407
+  8034a8:	ff 75 f4             	push   -0xc(%ebp)
+  8034ab:	6a 00                	push   $0x0
+  8034ad:	e8 22 d7 ff ff       	call   800bd4 <sys_page_alloc>
+  8034b2:	83 c4 10             	add    $0x10,%esp
+  8034b5:	85 c0                	test   %eax,%eax
+  8034b7:	78 21                	js     8034da <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  8034b9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8034bc:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  8034c2:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  8034c4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8034c7:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  8034ce:	83 ec 0c             	sub    $0xc,%esp
+  8034d1:	50                   	push   %eax
+  8034d2:	e8 e0 df ff ff       	call   8014b7 <fd2num>
+  8034d7:	83 c4 10             	add    $0x10,%esp
+}
+  8034da:	c9                   	leave
+  8034db:	c3                   	ret
+
+008034dc <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8034dc:	55                   	push   %ebp
+  8034dd:	89 e5                	mov    %esp,%ebp
+  8034df:	56                   	push   %esi
+  8034e0:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  8034e1:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  8034e4:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  8034ea:	e8 64 d6 ff ff       	call   800b53 <sys_getenvid>
+  8034ef:	83 ec 0c             	sub    $0xc,%esp
+  8034f2:	ff 75 0c             	push   0xc(%ebp)
+  8034f5:	ff 75 08             	push   0x8(%ebp)
+  8034f8:	56                   	push   %esi
+  8034f9:	50                   	push   %eax
+  8034fa:	68 90 3f 80 00       	push   $0x803f90
+  8034ff:	e8 b3 cc ff ff       	call   8001b7 <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  803504:	83 c4 18             	add    $0x18,%esp
+  803507:	53                   	push   %ebx
+  803508:	ff 75 10             	push   0x10(%ebp)
+  80350b:	e8 56 cc ff ff       	call   800166 <vcprintf>
+  cprintf("\n");
+  803510:	c7 04 24 14 3a 80 00 	movl   $0x803a14,(%esp)
+  803517:	e8 9b cc ff ff       	call   8001b7 <cprintf>
+  80351c:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  80351f:	cc                   	int3
+  while (1)
+  803520:	eb fd                	jmp    80351f <_panic+0x43>
+
+00803522 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  803522:	55                   	push   %ebp
+  803523:	89 e5                	mov    %esp,%ebp
+  803525:	53                   	push   %ebx
+  803526:	83 ec 04             	sub    $0x4,%esp
+  int r;
+
+  if (_pgfault_handler == 0) {
+  803529:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  803530:	74 0d                	je     80353f <set_pgfault_handler+0x1d>
+
+    sys_env_set_pgfault_upcall(id, _pgfault_upcall);
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  803532:	8b 45 08             	mov    0x8(%ebp),%eax
+  803535:	a3 00 70 80 00       	mov    %eax,0x807000
+}
+  80353a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80353d:	c9                   	leave
+  80353e:	c3                   	ret
+    envid_t id = sys_getenvid();
+  80353f:	e8 0f d6 ff ff       	call   800b53 <sys_getenvid>
+  803544:	89 c3                	mov    %eax,%ebx
+    sys_page_alloc(id, (void *) (UXSTACKTOP - PGSIZE), (PTE_P | PTE_U | PTE_W));
+  803546:	83 ec 04             	sub    $0x4,%esp
+  803549:	6a 07                	push   $0x7
+  80354b:	68 00 f0 bf ee       	push   $0xeebff000
+  803550:	50                   	push   %eax
+  803551:	e8 7e d6 ff ff       	call   800bd4 <sys_page_alloc>
+    sys_env_set_pgfault_upcall(id, _pgfault_upcall);
+  803556:	83 c4 08             	add    $0x8,%esp
+  803559:	68 69 35 80 00       	push   $0x803569
+  80355e:	53                   	push   %ebx
+  80355f:	e8 e5 d8 ff ff       	call   800e49 <sys_env_set_pgfault_upcall>
+  803564:	83 c4 10             	add    $0x10,%esp
+  803567:	eb c9                	jmp    803532 <set_pgfault_handler+0x10>
+
+00803569 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  803569:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  80356a:	a1 00 70 80 00       	mov    0x807000,%eax
+	call *%eax
+  80356f:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  803571:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+  movl 48(%esp), %eax       // move trap time esp to eax
+  803574:	8b 44 24 30          	mov    0x30(%esp),%eax
+  subl $4, %eax             // make room for eip on trap time esp
+  803578:	83 e8 04             	sub    $0x4,%eax
+  movl %eax, 48(%esp)       // move value to esp
+  80357b:	89 44 24 30          	mov    %eax,0x30(%esp)
+  movl 40(%esp), %ebx       // move trap time eip to ebx
+  80357f:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+  movl %ebx, 0(%eax)
+  803583:	89 18                	mov    %ebx,(%eax)
+
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+  addl $0x08,%esp
+  803585:	83 c4 08             	add    $0x8,%esp
+  popal
+  803588:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+  addl $4, %esp          // skip tf->eip
+  803589:	83 c4 04             	add    $0x4,%esp
+  popf                 // pop stack value into flags register
+  80358c:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+  popl %esp
+  80358d:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+  ret
+  80358e:	c3                   	ret
+
+0080358f <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  80358f:	55                   	push   %ebp
+  803590:	89 e5                	mov    %esp,%ebp
+  803592:	57                   	push   %edi
+  803593:	56                   	push   %esi
+  803594:	53                   	push   %ebx
+  803595:	83 ec 14             	sub    $0x14,%esp
+  803598:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80359b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80359e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8035a1:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  8035a4:	85 c0                	test   %eax,%eax
+  8035a6:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8035ab:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  8035ae:	ff 33                	push   (%ebx)
+  8035b0:	50                   	push   %eax
+  8035b1:	e8 f6 d8 ff ff       	call   800eac <sys_ipc_recv>
+  8035b6:	83 c4 10             	add    $0x10,%esp
+  8035b9:	85 c0                	test   %eax,%eax
+  8035bb:	78 39                	js     8035f6 <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  8035bd:	85 ff                	test   %edi,%edi
+  8035bf:	74 0a                	je     8035cb <ipc_recv_pages+0x3c>
+  8035c1:	a1 a0 58 80 00       	mov    0x8058a0,%eax
+  8035c6:	8b 40 7c             	mov    0x7c(%eax),%eax
+  8035c9:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  8035cb:	85 f6                	test   %esi,%esi
+  8035cd:	74 0d                	je     8035dc <ipc_recv_pages+0x4d>
+  8035cf:	a1 a0 58 80 00       	mov    0x8058a0,%eax
+  8035d4:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  8035da:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  8035dc:	a1 a0 58 80 00       	mov    0x8058a0,%eax
+  8035e1:	8b 40 74             	mov    0x74(%eax),%eax
+  8035e4:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  8035e6:	a1 a0 58 80 00       	mov    0x8058a0,%eax
+  8035eb:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  8035ee:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8035f1:	5b                   	pop    %ebx
+  8035f2:	5e                   	pop    %esi
+  8035f3:	5f                   	pop    %edi
+  8035f4:	5d                   	pop    %ebp
+  8035f5:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  8035f6:	85 ff                	test   %edi,%edi
+  8035f8:	74 06                	je     803600 <ipc_recv_pages+0x71>
+  8035fa:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  803600:	85 f6                	test   %esi,%esi
+  803602:	74 06                	je     80360a <ipc_recv_pages+0x7b>
+  803604:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  80360a:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  803610:	eb dc                	jmp    8035ee <ipc_recv_pages+0x5f>
+
+00803612 <ipc_recv>:
+{
+  803612:	55                   	push   %ebp
+  803613:	89 e5                	mov    %esp,%ebp
+  803615:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  803618:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  80361f:	ff 75 10             	push   0x10(%ebp)
+  803622:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803625:	50                   	push   %eax
+  803626:	ff 75 0c             	push   0xc(%ebp)
+  803629:	ff 75 08             	push   0x8(%ebp)
+  80362c:	e8 5e ff ff ff       	call   80358f <ipc_recv_pages>
+}
+  803631:	c9                   	leave
+  803632:	c3                   	ret
+
+00803633 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  803633:	55                   	push   %ebp
+  803634:	89 e5                	mov    %esp,%ebp
+  803636:	57                   	push   %edi
+  803637:	56                   	push   %esi
+  803638:	53                   	push   %ebx
+  803639:	83 ec 0c             	sub    $0xc,%esp
+  80363c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80363f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803642:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  803645:	89 c3                	mov    %eax,%ebx
+  803647:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  80364d:	85 c0                	test   %eax,%eax
+  80364f:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  803654:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  803657:	83 ec 0c             	sub    $0xc,%esp
+  80365a:	ff 75 14             	push   0x14(%ebp)
+  80365d:	ff 75 18             	push   0x18(%ebp)
+  803660:	53                   	push   %ebx
+  803661:	56                   	push   %esi
+  803662:	57                   	push   %edi
+  803663:	e8 23 d8 ff ff       	call   800e8b <sys_ipc_try_send>
+  803668:	83 c4 20             	add    $0x20,%esp
+  80366b:	85 c0                	test   %eax,%eax
+  80366d:	79 1e                	jns    80368d <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  80366f:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  803672:	75 07                	jne    80367b <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  803674:	e8 f9 d4 ff ff       	call   800b72 <sys_yield>
+  803679:	eb dc                	jmp    803657 <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  80367b:	50                   	push   %eax
+  80367c:	68 b3 3f 80 00       	push   $0x803fb3
+  803681:	6a 5c                	push   $0x5c
+  803683:	68 c0 3f 80 00       	push   $0x803fc0
+  803688:	e8 4f fe ff ff       	call   8034dc <_panic>
+  }
+}
+  80368d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803690:	5b                   	pop    %ebx
+  803691:	5e                   	pop    %esi
+  803692:	5f                   	pop    %edi
+  803693:	5d                   	pop    %ebp
+  803694:	c3                   	ret
+
+00803695 <ipc_send>:
+{
+  803695:	55                   	push   %ebp
+  803696:	89 e5                	mov    %esp,%ebp
+  803698:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  80369b:	ff 75 14             	push   0x14(%ebp)
+  80369e:	6a 01                	push   $0x1
+  8036a0:	ff 75 10             	push   0x10(%ebp)
+  8036a3:	ff 75 0c             	push   0xc(%ebp)
+  8036a6:	ff 75 08             	push   0x8(%ebp)
+  8036a9:	e8 85 ff ff ff       	call   803633 <ipc_send_pages>
+}
+  8036ae:	83 c4 20             	add    $0x20,%esp
+  8036b1:	c9                   	leave
+  8036b2:	c3                   	ret
+
+008036b3 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8036b3:	55                   	push   %ebp
+  8036b4:	89 e5                	mov    %esp,%ebp
+  8036b6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  8036b9:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  8036be:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8036c1:	c1 e0 04             	shl    $0x4,%eax
+  8036c4:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8036c9:	8b 40 50             	mov    0x50(%eax),%eax
+  8036cc:	39 c8                	cmp    %ecx,%eax
+  8036ce:	74 12                	je     8036e2 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  8036d0:	83 c2 01             	add    $0x1,%edx
+  8036d3:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  8036d9:	75 e3                	jne    8036be <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  8036db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036e0:	eb 0e                	jmp    8036f0 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  8036e2:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8036e5:	c1 e0 04             	shl    $0x4,%eax
+  8036e8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8036ed:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8036f0:	5d                   	pop    %ebp
+  8036f1:	c3                   	ret
+
+008036f2 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  8036f2:	55                   	push   %ebp
+  8036f3:	89 e5                	mov    %esp,%ebp
+  8036f5:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  8036f8:	89 c2                	mov    %eax,%edx
+  8036fa:	c1 ea 16             	shr    $0x16,%edx
+  8036fd:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  803704:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  803709:	f6 c1 01             	test   $0x1,%cl
+  80370c:	74 1c                	je     80372a <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  80370e:	c1 e8 0c             	shr    $0xc,%eax
+  803711:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  803718:	a8 01                	test   $0x1,%al
+  80371a:	74 0e                	je     80372a <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  80371c:	c1 e8 0c             	shr    $0xc,%eax
+  80371f:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  803726:	ef 
+  803727:	0f b7 d2             	movzwl %dx,%edx
+}
+  80372a:	89 d0                	mov    %edx,%eax
+  80372c:	5d                   	pop    %ebp
+  80372d:	c3                   	ret
+
+0080372e <udivmod>:
+  80372e:	55                   	push   %ebp
+  80372f:	57                   	push   %edi
+  803730:	56                   	push   %esi
+  803731:	53                   	push   %ebx
+  803732:	83 ec 14             	sub    $0x14,%esp
+  803735:	8b 74 24 28          	mov    0x28(%esp),%esi
+  803739:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  80373d:	89 fb                	mov    %edi,%ebx
+  80373f:	09 f3                	or     %esi,%ebx
+  803741:	0f 84 88 00 00 00    	je     8037cf <udivmod+0xa1>
+  803747:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  80374c:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  803753:	00 
+  803754:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  80375b:	00 
+  80375c:	89 cd                	mov    %ecx,%ebp
+  80375e:	89 34 24             	mov    %esi,(%esp)
+  803761:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  803765:	eb 08                	jmp    80376f <udivmod+0x41>
+  803767:	83 ed 01             	sub    $0x1,%ebp
+  80376a:	83 fd ff             	cmp    $0xffffffff,%ebp
+  80376d:	74 6c                	je     8037db <udivmod+0xad>
+  80376f:	89 c3                	mov    %eax,%ebx
+  803771:	89 d6                	mov    %edx,%esi
+  803773:	89 e9                	mov    %ebp,%ecx
+  803775:	0f ad f3             	shrd   %cl,%esi,%ebx
+  803778:	d3 ee                	shr    %cl,%esi
+  80377a:	f6 c1 20             	test   $0x20,%cl
+  80377d:	74 04                	je     803783 <udivmod+0x55>
+  80377f:	89 f3                	mov    %esi,%ebx
+  803781:	31 f6                	xor    %esi,%esi
+  803783:	8b 3c 24             	mov    (%esp),%edi
+  803786:	39 fb                	cmp    %edi,%ebx
+  803788:	89 f7                	mov    %esi,%edi
+  80378a:	8b 1c 24             	mov    (%esp),%ebx
+  80378d:	8b 74 24 04          	mov    0x4(%esp),%esi
+  803791:	19 f7                	sbb    %esi,%edi
+  803793:	72 d2                	jb     803767 <udivmod+0x39>
+  803795:	89 f7                	mov    %esi,%edi
+  803797:	89 de                	mov    %ebx,%esi
+  803799:	89 e9                	mov    %ebp,%ecx
+  80379b:	0f a5 f7             	shld   %cl,%esi,%edi
+  80379e:	d3 e6                	shl    %cl,%esi
+  8037a0:	f6 c1 20             	test   $0x20,%cl
+  8037a3:	74 04                	je     8037a9 <udivmod+0x7b>
+  8037a5:	89 f7                	mov    %esi,%edi
+  8037a7:	31 f6                	xor    %esi,%esi
+  8037a9:	29 f0                	sub    %esi,%eax
+  8037ab:	19 fa                	sbb    %edi,%edx
+  8037ad:	be 01 00 00 00       	mov    $0x1,%esi
+  8037b2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037b7:	0f a5 f7             	shld   %cl,%esi,%edi
+  8037ba:	d3 e6                	shl    %cl,%esi
+  8037bc:	f6 c1 20             	test   $0x20,%cl
+  8037bf:	74 04                	je     8037c5 <udivmod+0x97>
+  8037c1:	89 f7                	mov    %esi,%edi
+  8037c3:	31 f6                	xor    %esi,%esi
+  8037c5:	09 74 24 08          	or     %esi,0x8(%esp)
+  8037c9:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8037cd:	eb 98                	jmp    803767 <udivmod+0x39>
+  8037cf:	89 f0                	mov    %esi,%eax
+  8037d1:	89 fa                	mov    %edi,%edx
+  8037d3:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8037d7:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  8037db:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  8037df:	89 01                	mov    %eax,(%ecx)
+  8037e1:	89 51 04             	mov    %edx,0x4(%ecx)
+  8037e4:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8037e8:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  8037ec:	83 c4 14             	add    $0x14,%esp
+  8037ef:	5b                   	pop    %ebx
+  8037f0:	5e                   	pop    %esi
+  8037f1:	5f                   	pop    %edi
+  8037f2:	5d                   	pop    %ebp
+  8037f3:	c3                   	ret
+
+008037f4 <__udivdi3>:
+  8037f4:	83 ec 18             	sub    $0x18,%esp
+  8037f7:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  8037fb:	50                   	push   %eax
+  8037fc:	ff 74 24 2c          	push   0x2c(%esp)
+  803800:	ff 74 24 2c          	push   0x2c(%esp)
+  803804:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803808:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80380c:	e8 1d ff ff ff       	call   80372e <udivmod>
+  803811:	83 c4 24             	add    $0x24,%esp
+  803814:	c3                   	ret
+
+00803815 <__umoddi3>:
+  803815:	83 ec 18             	sub    $0x18,%esp
+  803818:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  80381c:	50                   	push   %eax
+  80381d:	ff 74 24 2c          	push   0x2c(%esp)
+  803821:	ff 74 24 2c          	push   0x2c(%esp)
+  803825:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803829:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  80382d:	e8 fc fe ff ff       	call   80372e <udivmod>
+  803832:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803836:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80383a:	83 c4 24             	add    $0x24,%esp
+  80383d:	c3                   	ret
+
+0080383e <__divdi3>:
+  80383e:	56                   	push   %esi
+  80383f:	53                   	push   %ebx
+  803840:	83 ec 14             	sub    $0x14,%esp
+  803843:	8b 44 24 20          	mov    0x20(%esp),%eax
+  803847:	8b 54 24 24          	mov    0x24(%esp),%edx
+  80384b:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  80384f:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  803853:	85 d2                	test   %edx,%edx
+  803855:	78 18                	js     80386f <__divdi3+0x31>
+  803857:	85 db                	test   %ebx,%ebx
+  803859:	78 3e                	js     803899 <__divdi3+0x5b>
+  80385b:	83 ec 04             	sub    $0x4,%esp
+  80385e:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803862:	56                   	push   %esi
+  803863:	53                   	push   %ebx
+  803864:	51                   	push   %ecx
+  803865:	e8 c4 fe ff ff       	call   80372e <udivmod>
+  80386a:	83 c4 10             	add    $0x10,%esp
+  80386d:	eb 24                	jmp    803893 <__divdi3+0x55>
+  80386f:	f7 d8                	neg    %eax
+  803871:	83 d2 00             	adc    $0x0,%edx
+  803874:	f7 da                	neg    %edx
+  803876:	85 db                	test   %ebx,%ebx
+  803878:	78 3a                	js     8038b4 <__divdi3+0x76>
+  80387a:	83 ec 04             	sub    $0x4,%esp
+  80387d:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803881:	56                   	push   %esi
+  803882:	53                   	push   %ebx
+  803883:	51                   	push   %ecx
+  803884:	e8 a5 fe ff ff       	call   80372e <udivmod>
+  803889:	83 c4 10             	add    $0x10,%esp
+  80388c:	f7 d8                	neg    %eax
+  80388e:	83 d2 00             	adc    $0x0,%edx
+  803891:	f7 da                	neg    %edx
+  803893:	83 c4 14             	add    $0x14,%esp
+  803896:	5b                   	pop    %ebx
+  803897:	5e                   	pop    %esi
+  803898:	c3                   	ret
+  803899:	83 ec 04             	sub    $0x4,%esp
+  80389c:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8038a0:	56                   	push   %esi
+  8038a1:	f7 d9                	neg    %ecx
+  8038a3:	83 d3 00             	adc    $0x0,%ebx
+  8038a6:	f7 db                	neg    %ebx
+  8038a8:	53                   	push   %ebx
+  8038a9:	51                   	push   %ecx
+  8038aa:	e8 7f fe ff ff       	call   80372e <udivmod>
+  8038af:	83 c4 10             	add    $0x10,%esp
+  8038b2:	eb d8                	jmp    80388c <__divdi3+0x4e>
+  8038b4:	83 ec 04             	sub    $0x4,%esp
+  8038b7:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8038bb:	56                   	push   %esi
+  8038bc:	f7 d9                	neg    %ecx
+  8038be:	83 d3 00             	adc    $0x0,%ebx
+  8038c1:	f7 db                	neg    %ebx
+  8038c3:	53                   	push   %ebx
+  8038c4:	51                   	push   %ecx
+  8038c5:	e8 64 fe ff ff       	call   80372e <udivmod>
+  8038ca:	83 c4 10             	add    $0x10,%esp
+  8038cd:	eb c4                	jmp    803893 <__divdi3+0x55>
+
+008038cf <__moddi3>:
+  8038cf:	55                   	push   %ebp
+  8038d0:	57                   	push   %edi
+  8038d1:	56                   	push   %esi
+  8038d2:	53                   	push   %ebx
+  8038d3:	83 ec 24             	sub    $0x24,%esp
+  8038d6:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8038da:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8038de:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  8038e2:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  8038e6:	85 d2                	test   %edx,%edx
+  8038e8:	78 3b                	js     803925 <__moddi3+0x56>
+  8038ea:	83 ec 04             	sub    $0x4,%esp
+  8038ed:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8038f1:	56                   	push   %esi
+  8038f2:	89 ce                	mov    %ecx,%esi
+  8038f4:	f7 de                	neg    %esi
+  8038f6:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8038fa:	89 de                	mov    %ebx,%esi
+  8038fc:	83 d6 00             	adc    $0x0,%esi
+  8038ff:	f7 de                	neg    %esi
+  803901:	89 74 24 14          	mov    %esi,0x14(%esp)
+  803905:	8b 74 24 08          	mov    0x8(%esp),%esi
+  803909:	0f 48 f1             	cmovs  %ecx,%esi
+  80390c:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  803911:	53                   	push   %ebx
+  803912:	56                   	push   %esi
+  803913:	e8 16 fe ff ff       	call   80372e <udivmod>
+  803918:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80391c:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803920:	83 c4 10             	add    $0x10,%esp
+  803923:	eb 47                	jmp    80396c <__moddi3+0x9d>
+  803925:	f7 d8                	neg    %eax
+  803927:	83 d2 00             	adc    $0x0,%edx
+  80392a:	f7 da                	neg    %edx
+  80392c:	83 ec 04             	sub    $0x4,%esp
+  80392f:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803933:	56                   	push   %esi
+  803934:	89 cf                	mov    %ecx,%edi
+  803936:	f7 df                	neg    %edi
+  803938:	89 de                	mov    %ebx,%esi
+  80393a:	83 d6 00             	adc    $0x0,%esi
+  80393d:	f7 de                	neg    %esi
+  80393f:	0f 49 cf             	cmovns %edi,%ecx
+  803942:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  803946:	0f 49 de             	cmovns %esi,%ebx
+  803949:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  80394d:	ff 74 24 0c          	push   0xc(%esp)
+  803951:	ff 74 24 0c          	push   0xc(%esp)
+  803955:	e8 d4 fd ff ff       	call   80372e <udivmod>
+  80395a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80395e:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803962:	f7 d8                	neg    %eax
+  803964:	83 d2 00             	adc    $0x0,%edx
+  803967:	f7 da                	neg    %edx
+  803969:	83 c4 10             	add    $0x10,%esp
+  80396c:	83 c4 24             	add    $0x24,%esp
+  80396f:	5b                   	pop    %ebx
+  803970:	5e                   	pop    %esi
+  803971:	5f                   	pop    %edi
+  803972:	5d                   	pop    %ebp
+  803973:	c3                   	ret
@@ -0,0 +1,7778 @@
+
+obj/user/stresssched.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 ba 00 00 00       	call   8000eb <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+volatile int counter;
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  int i, j;
+  int seen;
+  envid_t parent = sys_getenvid();
+  800038:	e8 92 0b 00 00       	call   800bcf <sys_getenvid>
+  80003d:	89 c6                	mov    %eax,%esi
+
+  // Fork several environments
+  for (i = 0; i < 20; i++)
+  80003f:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (fork() == 0)
+  800044:	e8 74 12 00 00       	call   8012bd <fork>
+  800049:	85 c0                	test   %eax,%eax
+  80004b:	74 0f                	je     80005c <umain+0x29>
+  for (i = 0; i < 20; i++)
+  80004d:	83 c3 01             	add    $0x1,%ebx
+  800050:	83 fb 14             	cmp    $0x14,%ebx
+  800053:	75 ef                	jne    800044 <umain+0x11>
+      break;
+  if (i == 20) {
+    sys_yield();
+  800055:	e8 94 0b 00 00       	call   800bee <sys_yield>
+    return;
+  80005a:	eb 71                	jmp    8000cd <umain+0x9a>
+  }
+
+  // Wait for the parent to finish forking
+  while (envs[ENVX(parent)].env_status != ENV_FREE)
+  80005c:	89 f0                	mov    %esi,%eax
+  80005e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800063:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  800066:	c1 e2 04             	shl    $0x4,%edx
+  800069:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80006f:	eb 02                	jmp    800073 <umain+0x40>
+    asm volatile ("pause");
+  800071:	f3 90                	pause
+  while (envs[ENVX(parent)].env_status != ENV_FREE)
+  800073:	8b 42 54             	mov    0x54(%edx),%eax
+  800076:	85 c0                	test   %eax,%eax
+  800078:	75 f7                	jne    800071 <umain+0x3e>
+  80007a:	bb 0b 00 00 00       	mov    $0xb,%ebx
+  80007f:	eb 12                	jmp    800093 <umain+0x60>
+
+  // Check that one environment doesn't run on two CPUs at once
+  for (i = 0; i < 10; i++) {
+    sys_yield();
+    for (j = 0; j < 10000; j++)
+      counter++;
+  800081:	a1 a0 58 80 00       	mov    0x8058a0,%eax
+  800086:	83 c0 01             	add    $0x1,%eax
+  800089:	a3 a0 58 80 00       	mov    %eax,0x8058a0
+    for (j = 0; j < 10000; j++)
+  80008e:	83 ea 01             	sub    $0x1,%edx
+  800091:	75 ee                	jne    800081 <umain+0x4e>
+  for (i = 0; i < 10; i++) {
+  800093:	83 eb 01             	sub    $0x1,%ebx
+  800096:	74 0c                	je     8000a4 <umain+0x71>
+    sys_yield();
+  800098:	e8 51 0b 00 00       	call   800bee <sys_yield>
+    for (j = 0; j < 10000; j++)
+  80009d:	ba 11 27 00 00       	mov    $0x2711,%edx
+  8000a2:	eb ea                	jmp    80008e <umain+0x5b>
+  }
+
+  if (counter != 10*10000)
+  8000a4:	a1 a0 58 80 00       	mov    0x8058a0,%eax
+  8000a9:	3d a0 86 01 00       	cmp    $0x186a0,%eax
+  8000ae:	75 24                	jne    8000d4 <umain+0xa1>
+    panic("ran on two CPUs at once (counter is %d)", counter);
+
+  // Check that we see environments running on different CPUs
+  cprintf("[%08x] stresssched on CPU %d\n", thisenv->env_id, thisenv->env_cpunum);
+  8000b0:	a1 a4 58 80 00       	mov    0x8058a4,%eax
+  8000b5:	8b 50 5c             	mov    0x5c(%eax),%edx
+  8000b8:	8b 40 48             	mov    0x48(%eax),%eax
+  8000bb:	83 ec 04             	sub    $0x4,%esp
+  8000be:	52                   	push   %edx
+  8000bf:	50                   	push   %eax
+  8000c0:	68 fb 39 80 00       	push   $0x8039fb
+  8000c5:	e8 69 01 00 00       	call   800233 <cprintf>
+  8000ca:	83 c4 10             	add    $0x10,%esp
+
+}
+  8000cd:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8000d0:	5b                   	pop    %ebx
+  8000d1:	5e                   	pop    %esi
+  8000d2:	5d                   	pop    %ebp
+  8000d3:	c3                   	ret
+    panic("ran on two CPUs at once (counter is %d)", counter);
+  8000d4:	a1 a0 58 80 00       	mov    0x8058a0,%eax
+  8000d9:	50                   	push   %eax
+  8000da:	68 c0 39 80 00       	push   $0x8039c0
+  8000df:	6a 21                	push   $0x21
+  8000e1:	68 e8 39 80 00       	push   $0x8039e8
+  8000e6:	e8 6d 00 00 00       	call   800158 <_panic>
+
+008000eb <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000eb:	55                   	push   %ebp
+  8000ec:	89 e5                	mov    %esp,%ebp
+  8000ee:	56                   	push   %esi
+  8000ef:	53                   	push   %ebx
+  8000f0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000f3:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  8000f6:	c7 05 a4 58 80 00 00 	movl   $0x0,0x8058a4
+  8000fd:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  800100:	e8 ca 0a 00 00       	call   800bcf <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  800105:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80010a:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80010d:	c1 e0 04             	shl    $0x4,%eax
+  800110:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800115:	a3 a4 58 80 00       	mov    %eax,0x8058a4
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  80011a:	85 db                	test   %ebx,%ebx
+  80011c:	7e 07                	jle    800125 <libmain+0x3a>
+    binaryname = argv[0];
+  80011e:	8b 06                	mov    (%esi),%eax
+  800120:	a3 00 40 80 00       	mov    %eax,0x804000
+
+  // call user main routine
+  umain(argc, argv);
+  800125:	83 ec 08             	sub    $0x8,%esp
+  800128:	56                   	push   %esi
+  800129:	53                   	push   %ebx
+  80012a:	e8 04 ff ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  80012f:	e8 0a 00 00 00       	call   80013e <exit>
+}
+  800134:	83 c4 10             	add    $0x10,%esp
+  800137:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80013a:	5b                   	pop    %ebx
+  80013b:	5e                   	pop    %esi
+  80013c:	5d                   	pop    %ebp
+  80013d:	c3                   	ret
+
+0080013e <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80013e:	55                   	push   %ebp
+  80013f:	89 e5                	mov    %esp,%ebp
+  800141:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  800144:	e8 b4 15 00 00       	call   8016fd <close_all>
+  sys_env_destroy(0);
+  800149:	83 ec 0c             	sub    $0xc,%esp
+  80014c:	6a 00                	push   $0x0
+  80014e:	e8 3b 0a 00 00       	call   800b8e <sys_env_destroy>
+}
+  800153:	83 c4 10             	add    $0x10,%esp
+  800156:	c9                   	leave
+  800157:	c3                   	ret
+
+00800158 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800158:	55                   	push   %ebp
+  800159:	89 e5                	mov    %esp,%ebp
+  80015b:	56                   	push   %esi
+  80015c:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  80015d:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  800160:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  800166:	e8 64 0a 00 00       	call   800bcf <sys_getenvid>
+  80016b:	83 ec 0c             	sub    $0xc,%esp
+  80016e:	ff 75 0c             	push   0xc(%ebp)
+  800171:	ff 75 08             	push   0x8(%ebp)
+  800174:	56                   	push   %esi
+  800175:	50                   	push   %eax
+  800176:	68 24 3a 80 00       	push   $0x803a24
+  80017b:	e8 b3 00 00 00       	call   800233 <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  800180:	83 c4 18             	add    $0x18,%esp
+  800183:	53                   	push   %ebx
+  800184:	ff 75 10             	push   0x10(%ebp)
+  800187:	e8 56 00 00 00       	call   8001e2 <vcprintf>
+  cprintf("\n");
+  80018c:	c7 04 24 17 3a 80 00 	movl   $0x803a17,(%esp)
+  800193:	e8 9b 00 00 00       	call   800233 <cprintf>
+  800198:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  80019b:	cc                   	int3
+  while (1)
+  80019c:	eb fd                	jmp    80019b <_panic+0x43>
+
+0080019e <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80019e:	55                   	push   %ebp
+  80019f:	89 e5                	mov    %esp,%ebp
+  8001a1:	53                   	push   %ebx
+  8001a2:	83 ec 04             	sub    $0x4,%esp
+  8001a5:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  8001a8:	8b 13                	mov    (%ebx),%edx
+  8001aa:	8d 42 01             	lea    0x1(%edx),%eax
+  8001ad:	89 03                	mov    %eax,(%ebx)
+  8001af:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001b2:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  8001b6:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001bb:	74 09                	je     8001c6 <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  8001bd:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8001c1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001c4:	c9                   	leave
+  8001c5:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  8001c6:	83 ec 08             	sub    $0x8,%esp
+  8001c9:	68 ff 00 00 00       	push   $0xff
+  8001ce:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001d1:	50                   	push   %eax
+  8001d2:	e8 7a 09 00 00       	call   800b51 <sys_cputs>
+    b->idx = 0;
+  8001d7:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001dd:	83 c4 10             	add    $0x10,%esp
+  8001e0:	eb db                	jmp    8001bd <putch+0x1f>
+
+008001e2 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001e2:	55                   	push   %ebp
+  8001e3:	89 e5                	mov    %esp,%ebp
+  8001e5:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  8001eb:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001f2:	00 00 00 
+  b.cnt = 0;
+  8001f5:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001fc:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  8001ff:	ff 75 0c             	push   0xc(%ebp)
+  800202:	ff 75 08             	push   0x8(%ebp)
+  800205:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80020b:	50                   	push   %eax
+  80020c:	68 9e 01 80 00       	push   $0x80019e
+  800211:	e8 14 01 00 00       	call   80032a <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  800216:	83 c4 08             	add    $0x8,%esp
+  800219:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80021f:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800225:	50                   	push   %eax
+  800226:	e8 26 09 00 00       	call   800b51 <sys_cputs>
+
+  return b.cnt;
+}
+  80022b:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800231:	c9                   	leave
+  800232:	c3                   	ret
+
+00800233 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800233:	55                   	push   %ebp
+  800234:	89 e5                	mov    %esp,%ebp
+  800236:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  800239:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  80023c:	50                   	push   %eax
+  80023d:	ff 75 08             	push   0x8(%ebp)
+  800240:	e8 9d ff ff ff       	call   8001e2 <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  800245:	c9                   	leave
+  800246:	c3                   	ret
+
+00800247 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  800247:	55                   	push   %ebp
+  800248:	89 e5                	mov    %esp,%ebp
+  80024a:	57                   	push   %edi
+  80024b:	56                   	push   %esi
+  80024c:	53                   	push   %ebx
+  80024d:	83 ec 1c             	sub    $0x1c,%esp
+  800250:	89 c7                	mov    %eax,%edi
+  800252:	89 d6                	mov    %edx,%esi
+  800254:	8b 45 08             	mov    0x8(%ebp),%eax
+  800257:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80025a:	89 d1                	mov    %edx,%ecx
+  80025c:	89 c2                	mov    %eax,%edx
+  80025e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800261:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800264:	8b 45 10             	mov    0x10(%ebp),%eax
+  800267:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  80026a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80026d:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800274:	39 c2                	cmp    %eax,%edx
+  800276:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800279:	72 3e                	jb     8002b9 <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  80027b:	83 ec 0c             	sub    $0xc,%esp
+  80027e:	ff 75 18             	push   0x18(%ebp)
+  800281:	83 eb 01             	sub    $0x1,%ebx
+  800284:	53                   	push   %ebx
+  800285:	50                   	push   %eax
+  800286:	83 ec 08             	sub    $0x8,%esp
+  800289:	ff 75 e4             	push   -0x1c(%ebp)
+  80028c:	ff 75 e0             	push   -0x20(%ebp)
+  80028f:	ff 75 dc             	push   -0x24(%ebp)
+  800292:	ff 75 d8             	push   -0x28(%ebp)
+  800295:	e8 90 35 00 00       	call   80382a <__udivdi3>
+  80029a:	83 c4 18             	add    $0x18,%esp
+  80029d:	52                   	push   %edx
+  80029e:	50                   	push   %eax
+  80029f:	89 f2                	mov    %esi,%edx
+  8002a1:	89 f8                	mov    %edi,%eax
+  8002a3:	e8 9f ff ff ff       	call   800247 <printnum>
+  8002a8:	83 c4 20             	add    $0x20,%esp
+  8002ab:	eb 13                	jmp    8002c0 <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  8002ad:	83 ec 08             	sub    $0x8,%esp
+  8002b0:	56                   	push   %esi
+  8002b1:	ff 75 18             	push   0x18(%ebp)
+  8002b4:	ff d7                	call   *%edi
+  8002b6:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  8002b9:	83 eb 01             	sub    $0x1,%ebx
+  8002bc:	85 db                	test   %ebx,%ebx
+  8002be:	7f ed                	jg     8002ad <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  8002c0:	83 ec 08             	sub    $0x8,%esp
+  8002c3:	56                   	push   %esi
+  8002c4:	83 ec 04             	sub    $0x4,%esp
+  8002c7:	ff 75 e4             	push   -0x1c(%ebp)
+  8002ca:	ff 75 e0             	push   -0x20(%ebp)
+  8002cd:	ff 75 dc             	push   -0x24(%ebp)
+  8002d0:	ff 75 d8             	push   -0x28(%ebp)
+  8002d3:	e8 73 35 00 00       	call   80384b <__umoddi3>
+  8002d8:	83 c4 14             	add    $0x14,%esp
+  8002db:	0f be 80 47 3a 80 00 	movsbl 0x803a47(%eax),%eax
+  8002e2:	50                   	push   %eax
+  8002e3:	ff d7                	call   *%edi
+}
+  8002e5:	83 c4 10             	add    $0x10,%esp
+  8002e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002eb:	5b                   	pop    %ebx
+  8002ec:	5e                   	pop    %esi
+  8002ed:	5f                   	pop    %edi
+  8002ee:	5d                   	pop    %ebp
+  8002ef:	c3                   	ret
+
+008002f0 <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002f0:	55                   	push   %ebp
+  8002f1:	89 e5                	mov    %esp,%ebp
+  8002f3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  8002f6:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  8002fa:	8b 10                	mov    (%eax),%edx
+  8002fc:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002ff:	73 0a                	jae    80030b <sprintputch+0x1b>
+    *b->buf++ = ch;
+  800301:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800304:	89 08                	mov    %ecx,(%eax)
+  800306:	8b 45 08             	mov    0x8(%ebp),%eax
+  800309:	88 02                	mov    %al,(%edx)
+}
+  80030b:	5d                   	pop    %ebp
+  80030c:	c3                   	ret
+
+0080030d <printfmt>:
+{
+  80030d:	55                   	push   %ebp
+  80030e:	89 e5                	mov    %esp,%ebp
+  800310:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  800313:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  800316:	50                   	push   %eax
+  800317:	ff 75 10             	push   0x10(%ebp)
+  80031a:	ff 75 0c             	push   0xc(%ebp)
+  80031d:	ff 75 08             	push   0x8(%ebp)
+  800320:	e8 05 00 00 00       	call   80032a <vprintfmt>
+}
+  800325:	83 c4 10             	add    $0x10,%esp
+  800328:	c9                   	leave
+  800329:	c3                   	ret
+
+0080032a <vprintfmt>:
+{
+  80032a:	55                   	push   %ebp
+  80032b:	89 e5                	mov    %esp,%ebp
+  80032d:	57                   	push   %edi
+  80032e:	56                   	push   %esi
+  80032f:	53                   	push   %ebx
+  800330:	83 ec 2c             	sub    $0x2c,%esp
+  800333:	8b 75 08             	mov    0x8(%ebp),%esi
+  800336:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800339:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80033c:	eb 0a                	jmp    800348 <vprintfmt+0x1e>
+      putch(ch, putdat);
+  80033e:	83 ec 08             	sub    $0x8,%esp
+  800341:	53                   	push   %ebx
+  800342:	50                   	push   %eax
+  800343:	ff d6                	call   *%esi
+  800345:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  800348:	83 c7 01             	add    $0x1,%edi
+  80034b:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80034f:	83 f8 25             	cmp    $0x25,%eax
+  800352:	74 0c                	je     800360 <vprintfmt+0x36>
+      if (ch == '\0')
+  800354:	85 c0                	test   %eax,%eax
+  800356:	75 e6                	jne    80033e <vprintfmt+0x14>
+}
+  800358:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80035b:	5b                   	pop    %ebx
+  80035c:	5e                   	pop    %esi
+  80035d:	5f                   	pop    %edi
+  80035e:	5d                   	pop    %ebp
+  80035f:	c3                   	ret
+    padc = ' ';
+  800360:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  800364:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  80036b:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  800372:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  800379:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  80037e:	8d 47 01             	lea    0x1(%edi),%eax
+  800381:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800384:	0f b6 17             	movzbl (%edi),%edx
+  800387:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80038a:	3c 55                	cmp    $0x55,%al
+  80038c:	0f 87 cf 03 00 00    	ja     800761 <vprintfmt+0x437>
+  800392:	0f b6 c0             	movzbl %al,%eax
+  800395:	ff 24 85 a0 3b 80 00 	jmp    *0x803ba0(,%eax,4)
+  80039c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  80039f:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  8003a3:	eb d9                	jmp    80037e <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  8003a5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  8003a8:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  8003ac:	eb d0                	jmp    80037e <vprintfmt+0x54>
+  8003ae:	0f b6 d2             	movzbl %dl,%edx
+  8003b1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  8003b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003b9:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  8003bc:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8003bf:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  8003c3:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  8003c6:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8003c9:	83 f9 09             	cmp    $0x9,%ecx
+  8003cc:	77 55                	ja     800423 <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  8003ce:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  8003d1:	eb e9                	jmp    8003bc <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  8003d3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003d6:	8b 00                	mov    (%eax),%eax
+  8003d8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003db:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003de:	8d 40 04             	lea    0x4(%eax),%eax
+  8003e1:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  8003e4:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  8003e7:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003eb:	79 91                	jns    80037e <vprintfmt+0x54>
+        width = precision, precision = -1;
+  8003ed:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003f0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003f3:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003fa:	eb 82                	jmp    80037e <vprintfmt+0x54>
+      if (width < 0)
+  8003fc:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8003ff:	85 d2                	test   %edx,%edx
+  800401:	b8 00 00 00 00       	mov    $0x0,%eax
+  800406:	0f 49 c2             	cmovns %edx,%eax
+  800409:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  80040c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  80040f:	e9 6a ff ff ff       	jmp    80037e <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  800414:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  800417:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  80041e:	e9 5b ff ff ff       	jmp    80037e <vprintfmt+0x54>
+  800423:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800426:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800429:	eb bc                	jmp    8003e7 <vprintfmt+0xbd>
+      lflag++;
+  80042b:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  80042e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  800431:	e9 48 ff ff ff       	jmp    80037e <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  800436:	8b 45 14             	mov    0x14(%ebp),%eax
+  800439:	8d 78 04             	lea    0x4(%eax),%edi
+  80043c:	83 ec 08             	sub    $0x8,%esp
+  80043f:	53                   	push   %ebx
+  800440:	ff 30                	push   (%eax)
+  800442:	ff d6                	call   *%esi
+      break;
+  800444:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  800447:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  80044a:	e9 b1 02 00 00       	jmp    800700 <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  80044f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800452:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  800455:	8b 10                	mov    (%eax),%edx
+  800457:	89 d0                	mov    %edx,%eax
+  800459:	f7 d8                	neg    %eax
+  80045b:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80045e:	83 f8 10             	cmp    $0x10,%eax
+  800461:	7f 23                	jg     800486 <vprintfmt+0x15c>
+  800463:	8b 14 85 00 3d 80 00 	mov    0x803d00(,%eax,4),%edx
+  80046a:	85 d2                	test   %edx,%edx
+  80046c:	74 18                	je     800486 <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  80046e:	52                   	push   %edx
+  80046f:	68 16 3f 80 00       	push   $0x803f16
+  800474:	53                   	push   %ebx
+  800475:	56                   	push   %esi
+  800476:	e8 92 fe ff ff       	call   80030d <printfmt>
+  80047b:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  80047e:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800481:	e9 7a 02 00 00       	jmp    800700 <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  800486:	50                   	push   %eax
+  800487:	68 5f 3a 80 00       	push   $0x803a5f
+  80048c:	53                   	push   %ebx
+  80048d:	56                   	push   %esi
+  80048e:	e8 7a fe ff ff       	call   80030d <printfmt>
+  800493:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  800496:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  800499:	e9 62 02 00 00       	jmp    800700 <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  80049e:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004a1:	83 c0 04             	add    $0x4,%eax
+  8004a4:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  8004a7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004aa:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  8004ac:	85 c9                	test   %ecx,%ecx
+  8004ae:	b8 58 3a 80 00       	mov    $0x803a58,%eax
+  8004b3:	0f 45 c1             	cmovne %ecx,%eax
+  8004b6:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  8004b9:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004bd:	7e 06                	jle    8004c5 <vprintfmt+0x19b>
+  8004bf:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8004c3:	75 0b                	jne    8004d0 <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8004c5:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8004c8:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8004cb:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004ce:	eb 5c                	jmp    80052c <vprintfmt+0x202>
+  8004d0:	83 ec 08             	sub    $0x8,%esp
+  8004d3:	ff 75 d0             	push   -0x30(%ebp)
+  8004d6:	ff 75 cc             	push   -0x34(%ebp)
+  8004d9:	e8 20 03 00 00       	call   8007fe <strnlen>
+  8004de:	89 c2                	mov    %eax,%edx
+  8004e0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004e3:	29 d0                	sub    %edx,%eax
+  8004e5:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  8004e8:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8004ec:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004ef:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004f2:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8004f4:	eb 0e                	jmp    800504 <vprintfmt+0x1da>
+          putch(padc, putdat);
+  8004f6:	83 ec 08             	sub    $0x8,%esp
+  8004f9:	53                   	push   %ebx
+  8004fa:	57                   	push   %edi
+  8004fb:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8004fe:	83 ee 01             	sub    $0x1,%esi
+  800501:	83 c4 10             	add    $0x10,%esp
+  800504:	85 f6                	test   %esi,%esi
+  800506:	7f ee                	jg     8004f6 <vprintfmt+0x1cc>
+  800508:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80050b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80050e:	85 c0                	test   %eax,%eax
+  800510:	ba 00 00 00 00       	mov    $0x0,%edx
+  800515:	0f 49 d0             	cmovns %eax,%edx
+  800518:	29 d0                	sub    %edx,%eax
+  80051a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80051d:	eb a6                	jmp    8004c5 <vprintfmt+0x19b>
+          putch(ch, putdat);
+  80051f:	83 ec 08             	sub    $0x8,%esp
+  800522:	53                   	push   %ebx
+  800523:	52                   	push   %edx
+  800524:	ff 55 08             	call   *0x8(%ebp)
+  800527:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80052a:	89 f1                	mov    %esi,%ecx
+  80052c:	8d 71 01             	lea    0x1(%ecx),%esi
+  80052f:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800533:	0f be d0             	movsbl %al,%edx
+  800536:	85 d2                	test   %edx,%edx
+  800538:	74 28                	je     800562 <vprintfmt+0x238>
+  80053a:	85 ff                	test   %edi,%edi
+  80053c:	78 05                	js     800543 <vprintfmt+0x219>
+  80053e:	83 ef 01             	sub    $0x1,%edi
+  800541:	78 30                	js     800573 <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  800543:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800547:	74 d6                	je     80051f <vprintfmt+0x1f5>
+  800549:	0f be c0             	movsbl %al,%eax
+  80054c:	83 e8 20             	sub    $0x20,%eax
+  80054f:	83 f8 5e             	cmp    $0x5e,%eax
+  800552:	76 cb                	jbe    80051f <vprintfmt+0x1f5>
+          putch('?', putdat);
+  800554:	83 ec 08             	sub    $0x8,%esp
+  800557:	53                   	push   %ebx
+  800558:	6a 3f                	push   $0x3f
+  80055a:	ff 55 08             	call   *0x8(%ebp)
+  80055d:	83 c4 10             	add    $0x10,%esp
+  800560:	eb c8                	jmp    80052a <vprintfmt+0x200>
+  800562:	8b 75 08             	mov    0x8(%ebp),%esi
+  800565:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800568:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80056b:	01 d0                	add    %edx,%eax
+  80056d:	29 c8                	sub    %ecx,%eax
+  80056f:	89 c7                	mov    %eax,%edi
+  800571:	eb 13                	jmp    800586 <vprintfmt+0x25c>
+  800573:	8b 75 08             	mov    0x8(%ebp),%esi
+  800576:	eb ed                	jmp    800565 <vprintfmt+0x23b>
+        putch(' ', putdat);
+  800578:	83 ec 08             	sub    $0x8,%esp
+  80057b:	53                   	push   %ebx
+  80057c:	6a 20                	push   $0x20
+  80057e:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  800580:	83 ef 01             	sub    $0x1,%edi
+  800583:	83 c4 10             	add    $0x10,%esp
+  800586:	85 ff                	test   %edi,%edi
+  800588:	7f ee                	jg     800578 <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  80058a:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80058d:	89 45 14             	mov    %eax,0x14(%ebp)
+  800590:	e9 6b 01 00 00       	jmp    800700 <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  800595:	83 f9 01             	cmp    $0x1,%ecx
+  800598:	7f 1f                	jg     8005b9 <vprintfmt+0x28f>
+  else if (lflag)
+  80059a:	85 c9                	test   %ecx,%ecx
+  80059c:	74 67                	je     800605 <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  80059e:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a1:	8b 00                	mov    (%eax),%eax
+  8005a3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005a6:	89 c1                	mov    %eax,%ecx
+  8005a8:	c1 f9 1f             	sar    $0x1f,%ecx
+  8005ab:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8005ae:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005b1:	8d 40 04             	lea    0x4(%eax),%eax
+  8005b4:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005b7:	eb 17                	jmp    8005d0 <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  8005b9:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005bc:	8b 50 04             	mov    0x4(%eax),%edx
+  8005bf:	8b 00                	mov    (%eax),%eax
+  8005c1:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005c4:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005c7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ca:	8d 40 08             	lea    0x8(%eax),%eax
+  8005cd:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  8005d0:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005d3:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  8005d6:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  8005db:	85 c9                	test   %ecx,%ecx
+  8005dd:	0f 89 03 01 00 00    	jns    8006e6 <vprintfmt+0x3bc>
+        putch('-', putdat);
+  8005e3:	83 ec 08             	sub    $0x8,%esp
+  8005e6:	53                   	push   %ebx
+  8005e7:	6a 2d                	push   $0x2d
+  8005e9:	ff d6                	call   *%esi
+        num = -(long long)num;
+  8005eb:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005ee:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005f1:	f7 da                	neg    %edx
+  8005f3:	83 d1 00             	adc    $0x0,%ecx
+  8005f6:	f7 d9                	neg    %ecx
+  8005f8:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  8005fb:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800600:	e9 e1 00 00 00       	jmp    8006e6 <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  800605:	8b 45 14             	mov    0x14(%ebp),%eax
+  800608:	8b 00                	mov    (%eax),%eax
+  80060a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80060d:	89 c1                	mov    %eax,%ecx
+  80060f:	c1 f9 1f             	sar    $0x1f,%ecx
+  800612:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800615:	8b 45 14             	mov    0x14(%ebp),%eax
+  800618:	8d 40 04             	lea    0x4(%eax),%eax
+  80061b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80061e:	eb b0                	jmp    8005d0 <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  800620:	83 f9 01             	cmp    $0x1,%ecx
+  800623:	7f 1e                	jg     800643 <vprintfmt+0x319>
+  else if (lflag)
+  800625:	85 c9                	test   %ecx,%ecx
+  800627:	74 32                	je     80065b <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  800629:	8b 45 14             	mov    0x14(%ebp),%eax
+  80062c:	8b 10                	mov    (%eax),%edx
+  80062e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800633:	8d 40 04             	lea    0x4(%eax),%eax
+  800636:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800639:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  80063e:	e9 a3 00 00 00       	jmp    8006e6 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800643:	8b 45 14             	mov    0x14(%ebp),%eax
+  800646:	8b 10                	mov    (%eax),%edx
+  800648:	8b 48 04             	mov    0x4(%eax),%ecx
+  80064b:	8d 40 08             	lea    0x8(%eax),%eax
+  80064e:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800651:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  800656:	e9 8b 00 00 00       	jmp    8006e6 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  80065b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80065e:	8b 10                	mov    (%eax),%edx
+  800660:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800665:	8d 40 04             	lea    0x4(%eax),%eax
+  800668:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  80066b:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  800670:	eb 74                	jmp    8006e6 <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  800672:	83 f9 01             	cmp    $0x1,%ecx
+  800675:	7f 1b                	jg     800692 <vprintfmt+0x368>
+  else if (lflag)
+  800677:	85 c9                	test   %ecx,%ecx
+  800679:	74 2c                	je     8006a7 <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  80067b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80067e:	8b 10                	mov    (%eax),%edx
+  800680:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800685:	8d 40 04             	lea    0x4(%eax),%eax
+  800688:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  80068b:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  800690:	eb 54                	jmp    8006e6 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800692:	8b 45 14             	mov    0x14(%ebp),%eax
+  800695:	8b 10                	mov    (%eax),%edx
+  800697:	8b 48 04             	mov    0x4(%eax),%ecx
+  80069a:	8d 40 08             	lea    0x8(%eax),%eax
+  80069d:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8006a0:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  8006a5:	eb 3f                	jmp    8006e6 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8006a7:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006aa:	8b 10                	mov    (%eax),%edx
+  8006ac:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006b1:	8d 40 04             	lea    0x4(%eax),%eax
+  8006b4:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8006b7:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  8006bc:	eb 28                	jmp    8006e6 <vprintfmt+0x3bc>
+      putch('0', putdat);
+  8006be:	83 ec 08             	sub    $0x8,%esp
+  8006c1:	53                   	push   %ebx
+  8006c2:	6a 30                	push   $0x30
+  8006c4:	ff d6                	call   *%esi
+      putch('x', putdat);
+  8006c6:	83 c4 08             	add    $0x8,%esp
+  8006c9:	53                   	push   %ebx
+  8006ca:	6a 78                	push   $0x78
+  8006cc:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  8006ce:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006d1:	8b 10                	mov    (%eax),%edx
+  8006d3:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  8006d8:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  8006db:	8d 40 04             	lea    0x4(%eax),%eax
+  8006de:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8006e1:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  8006e6:	83 ec 0c             	sub    $0xc,%esp
+  8006e9:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8006ed:	50                   	push   %eax
+  8006ee:	ff 75 e0             	push   -0x20(%ebp)
+  8006f1:	57                   	push   %edi
+  8006f2:	51                   	push   %ecx
+  8006f3:	52                   	push   %edx
+  8006f4:	89 da                	mov    %ebx,%edx
+  8006f6:	89 f0                	mov    %esi,%eax
+  8006f8:	e8 4a fb ff ff       	call   800247 <printnum>
+      break;
+  8006fd:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  800700:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  800703:	e9 40 fc ff ff       	jmp    800348 <vprintfmt+0x1e>
+  if (lflag >= 2)
+  800708:	83 f9 01             	cmp    $0x1,%ecx
+  80070b:	7f 1b                	jg     800728 <vprintfmt+0x3fe>
+  else if (lflag)
+  80070d:	85 c9                	test   %ecx,%ecx
+  80070f:	74 2c                	je     80073d <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  800711:	8b 45 14             	mov    0x14(%ebp),%eax
+  800714:	8b 10                	mov    (%eax),%edx
+  800716:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80071b:	8d 40 04             	lea    0x4(%eax),%eax
+  80071e:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800721:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  800726:	eb be                	jmp    8006e6 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800728:	8b 45 14             	mov    0x14(%ebp),%eax
+  80072b:	8b 10                	mov    (%eax),%edx
+  80072d:	8b 48 04             	mov    0x4(%eax),%ecx
+  800730:	8d 40 08             	lea    0x8(%eax),%eax
+  800733:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800736:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  80073b:	eb a9                	jmp    8006e6 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  80073d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800740:	8b 10                	mov    (%eax),%edx
+  800742:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800747:	8d 40 04             	lea    0x4(%eax),%eax
+  80074a:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  80074d:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  800752:	eb 92                	jmp    8006e6 <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  800754:	83 ec 08             	sub    $0x8,%esp
+  800757:	53                   	push   %ebx
+  800758:	6a 25                	push   $0x25
+  80075a:	ff d6                	call   *%esi
+      break;
+  80075c:	83 c4 10             	add    $0x10,%esp
+  80075f:	eb 9f                	jmp    800700 <vprintfmt+0x3d6>
+      putch('%', putdat);
+  800761:	83 ec 08             	sub    $0x8,%esp
+  800764:	53                   	push   %ebx
+  800765:	6a 25                	push   $0x25
+  800767:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  800769:	83 c4 10             	add    $0x10,%esp
+  80076c:	89 f8                	mov    %edi,%eax
+  80076e:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800772:	74 05                	je     800779 <vprintfmt+0x44f>
+  800774:	83 e8 01             	sub    $0x1,%eax
+  800777:	eb f5                	jmp    80076e <vprintfmt+0x444>
+  800779:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80077c:	eb 82                	jmp    800700 <vprintfmt+0x3d6>
+
+0080077e <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80077e:	55                   	push   %ebp
+  80077f:	89 e5                	mov    %esp,%ebp
+  800781:	83 ec 18             	sub    $0x18,%esp
+  800784:	8b 45 08             	mov    0x8(%ebp),%eax
+  800787:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  80078a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80078d:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800791:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800794:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  80079b:	85 c0                	test   %eax,%eax
+  80079d:	74 26                	je     8007c5 <vsnprintf+0x47>
+  80079f:	85 d2                	test   %edx,%edx
+  8007a1:	7e 22                	jle    8007c5 <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  8007a3:	ff 75 14             	push   0x14(%ebp)
+  8007a6:	ff 75 10             	push   0x10(%ebp)
+  8007a9:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  8007ac:	50                   	push   %eax
+  8007ad:	68 f0 02 80 00       	push   $0x8002f0
+  8007b2:	e8 73 fb ff ff       	call   80032a <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  8007b7:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8007ba:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  8007bd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8007c0:	83 c4 10             	add    $0x10,%esp
+}
+  8007c3:	c9                   	leave
+  8007c4:	c3                   	ret
+    return -E_INVAL;
+  8007c5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007ca:	eb f7                	jmp    8007c3 <vsnprintf+0x45>
+
+008007cc <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8007cc:	55                   	push   %ebp
+  8007cd:	89 e5                	mov    %esp,%ebp
+  8007cf:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  8007d2:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  8007d5:	50                   	push   %eax
+  8007d6:	ff 75 10             	push   0x10(%ebp)
+  8007d9:	ff 75 0c             	push   0xc(%ebp)
+  8007dc:	ff 75 08             	push   0x8(%ebp)
+  8007df:	e8 9a ff ff ff       	call   80077e <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  8007e4:	c9                   	leave
+  8007e5:	c3                   	ret
+
+008007e6 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8007e6:	55                   	push   %ebp
+  8007e7:	89 e5                	mov    %esp,%ebp
+  8007e9:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  8007ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007f1:	eb 03                	jmp    8007f6 <strlen+0x10>
+    n++;
+  8007f3:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  8007f6:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8007fa:	75 f7                	jne    8007f3 <strlen+0xd>
+  return n;
+}
+  8007fc:	5d                   	pop    %ebp
+  8007fd:	c3                   	ret
+
+008007fe <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8007fe:	55                   	push   %ebp
+  8007ff:	89 e5                	mov    %esp,%ebp
+  800801:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800804:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800807:	b8 00 00 00 00       	mov    $0x0,%eax
+  80080c:	eb 03                	jmp    800811 <strnlen+0x13>
+    n++;
+  80080e:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800811:	39 d0                	cmp    %edx,%eax
+  800813:	74 08                	je     80081d <strnlen+0x1f>
+  800815:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800819:	75 f3                	jne    80080e <strnlen+0x10>
+  80081b:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  80081d:	89 d0                	mov    %edx,%eax
+  80081f:	5d                   	pop    %ebp
+  800820:	c3                   	ret
+
+00800821 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800821:	55                   	push   %ebp
+  800822:	89 e5                	mov    %esp,%ebp
+  800824:	53                   	push   %ebx
+  800825:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800828:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  80082b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800830:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800834:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800837:	83 c0 01             	add    $0x1,%eax
+  80083a:	84 d2                	test   %dl,%dl
+  80083c:	75 f2                	jne    800830 <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  80083e:	89 c8                	mov    %ecx,%eax
+  800840:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800843:	c9                   	leave
+  800844:	c3                   	ret
+
+00800845 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800845:	55                   	push   %ebp
+  800846:	89 e5                	mov    %esp,%ebp
+  800848:	53                   	push   %ebx
+  800849:	83 ec 10             	sub    $0x10,%esp
+  80084c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  80084f:	53                   	push   %ebx
+  800850:	e8 91 ff ff ff       	call   8007e6 <strlen>
+  800855:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  800858:	ff 75 0c             	push   0xc(%ebp)
+  80085b:	01 d8                	add    %ebx,%eax
+  80085d:	50                   	push   %eax
+  80085e:	e8 be ff ff ff       	call   800821 <strcpy>
+  return dst;
+}
+  800863:	89 d8                	mov    %ebx,%eax
+  800865:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800868:	c9                   	leave
+  800869:	c3                   	ret
+
+0080086a <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  80086a:	55                   	push   %ebp
+  80086b:	89 e5                	mov    %esp,%ebp
+  80086d:	56                   	push   %esi
+  80086e:	53                   	push   %ebx
+  80086f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800872:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  800875:	89 f3                	mov    %esi,%ebx
+  800877:	03 5d 10             	add    0x10(%ebp),%ebx
+  80087a:	89 f0                	mov    %esi,%eax
+  80087c:	eb 0f                	jmp    80088d <strncpy+0x23>
+    *dst++ = *src;
+  80087e:	83 c0 01             	add    $0x1,%eax
+  800881:	0f b6 0a             	movzbl (%edx),%ecx
+  800884:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  800887:	80 f9 01             	cmp    $0x1,%cl
+  80088a:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  80088d:	39 d8                	cmp    %ebx,%eax
+  80088f:	75 ed                	jne    80087e <strncpy+0x14>
+  }
+  return ret;
+}
+  800891:	89 f0                	mov    %esi,%eax
+  800893:	5b                   	pop    %ebx
+  800894:	5e                   	pop    %esi
+  800895:	5d                   	pop    %ebp
+  800896:	c3                   	ret
+
+00800897 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800897:	55                   	push   %ebp
+  800898:	89 e5                	mov    %esp,%ebp
+  80089a:	56                   	push   %esi
+  80089b:	53                   	push   %ebx
+  80089c:	8b 75 08             	mov    0x8(%ebp),%esi
+  80089f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008a2:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  8008a5:	89 f0                	mov    %esi,%eax
+  8008a7:	85 d2                	test   %edx,%edx
+  8008a9:	74 21                	je     8008cc <strlcpy+0x35>
+  8008ab:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8008af:	89 f2                	mov    %esi,%edx
+  8008b1:	eb 09                	jmp    8008bc <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  8008b3:	83 c1 01             	add    $0x1,%ecx
+  8008b6:	83 c2 01             	add    $0x1,%edx
+  8008b9:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  8008bc:	39 c2                	cmp    %eax,%edx
+  8008be:	74 09                	je     8008c9 <strlcpy+0x32>
+  8008c0:	0f b6 19             	movzbl (%ecx),%ebx
+  8008c3:	84 db                	test   %bl,%bl
+  8008c5:	75 ec                	jne    8008b3 <strlcpy+0x1c>
+  8008c7:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  8008c9:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  8008cc:	29 f0                	sub    %esi,%eax
+}
+  8008ce:	5b                   	pop    %ebx
+  8008cf:	5e                   	pop    %esi
+  8008d0:	5d                   	pop    %ebp
+  8008d1:	c3                   	ret
+
+008008d2 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8008d2:	55                   	push   %ebp
+  8008d3:	89 e5                	mov    %esp,%ebp
+  8008d5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008d8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  8008db:	eb 06                	jmp    8008e3 <strcmp+0x11>
+    p++, q++;
+  8008dd:	83 c1 01             	add    $0x1,%ecx
+  8008e0:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  8008e3:	0f b6 01             	movzbl (%ecx),%eax
+  8008e6:	84 c0                	test   %al,%al
+  8008e8:	74 04                	je     8008ee <strcmp+0x1c>
+  8008ea:	3a 02                	cmp    (%edx),%al
+  8008ec:	74 ef                	je     8008dd <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  8008ee:	0f b6 c0             	movzbl %al,%eax
+  8008f1:	0f b6 12             	movzbl (%edx),%edx
+  8008f4:	29 d0                	sub    %edx,%eax
+}
+  8008f6:	5d                   	pop    %ebp
+  8008f7:	c3                   	ret
+
+008008f8 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8008f8:	55                   	push   %ebp
+  8008f9:	89 e5                	mov    %esp,%ebp
+  8008fb:	53                   	push   %ebx
+  8008fc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008ff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800902:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  800905:	eb 09                	jmp    800910 <strncmp+0x18>
+    n--, p++, q++;
+  800907:	83 ea 01             	sub    $0x1,%edx
+  80090a:	83 c0 01             	add    $0x1,%eax
+  80090d:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  800910:	85 d2                	test   %edx,%edx
+  800912:	74 18                	je     80092c <strncmp+0x34>
+  800914:	0f b6 18             	movzbl (%eax),%ebx
+  800917:	84 db                	test   %bl,%bl
+  800919:	74 04                	je     80091f <strncmp+0x27>
+  80091b:	3a 19                	cmp    (%ecx),%bl
+  80091d:	74 e8                	je     800907 <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80091f:	0f b6 00             	movzbl (%eax),%eax
+  800922:	0f b6 11             	movzbl (%ecx),%edx
+  800925:	29 d0                	sub    %edx,%eax
+}
+  800927:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80092a:	c9                   	leave
+  80092b:	c3                   	ret
+    return 0;
+  80092c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800931:	eb f4                	jmp    800927 <strncmp+0x2f>
+
+00800933 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800933:	55                   	push   %ebp
+  800934:	89 e5                	mov    %esp,%ebp
+  800936:	8b 45 08             	mov    0x8(%ebp),%eax
+  800939:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  80093d:	eb 03                	jmp    800942 <strchr+0xf>
+  80093f:	83 c0 01             	add    $0x1,%eax
+  800942:	0f b6 10             	movzbl (%eax),%edx
+  800945:	84 d2                	test   %dl,%dl
+  800947:	74 06                	je     80094f <strchr+0x1c>
+    if (*s == c)
+  800949:	38 ca                	cmp    %cl,%dl
+  80094b:	75 f2                	jne    80093f <strchr+0xc>
+  80094d:	eb 05                	jmp    800954 <strchr+0x21>
+      return (char*)s;
+  return 0;
+  80094f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800954:	5d                   	pop    %ebp
+  800955:	c3                   	ret
+
+00800956 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800956:	55                   	push   %ebp
+  800957:	89 e5                	mov    %esp,%ebp
+  800959:	8b 45 08             	mov    0x8(%ebp),%eax
+  80095c:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800960:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  800963:	38 ca                	cmp    %cl,%dl
+  800965:	74 09                	je     800970 <strfind+0x1a>
+  800967:	84 d2                	test   %dl,%dl
+  800969:	74 05                	je     800970 <strfind+0x1a>
+  for (; *s; s++)
+  80096b:	83 c0 01             	add    $0x1,%eax
+  80096e:	eb f0                	jmp    800960 <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  800970:	5d                   	pop    %ebp
+  800971:	c3                   	ret
+
+00800972 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800972:	55                   	push   %ebp
+  800973:	89 e5                	mov    %esp,%ebp
+  800975:	57                   	push   %edi
+  800976:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800979:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  80097c:	85 c9                	test   %ecx,%ecx
+  80097e:	74 20                	je     8009a0 <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  800980:	89 f8                	mov    %edi,%eax
+  800982:	09 c8                	or     %ecx,%eax
+  800984:	a8 03                	test   $0x3,%al
+  800986:	75 12                	jne    80099a <memset+0x28>
+    c &= 0xFF;
+  800988:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80098c:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  800992:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  800995:	fc                   	cld
+  800996:	f3 ab                	rep stos %eax,%es:(%edi)
+  800998:	eb 06                	jmp    8009a0 <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  80099a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80099d:	fc                   	cld
+  80099e:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  8009a0:	89 f8                	mov    %edi,%eax
+  8009a2:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  8009a5:	c9                   	leave
+  8009a6:	c3                   	ret
+
+008009a7 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  8009a7:	55                   	push   %ebp
+  8009a8:	89 e5                	mov    %esp,%ebp
+  8009aa:	57                   	push   %edi
+  8009ab:	56                   	push   %esi
+  8009ac:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009af:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8009b2:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  8009b5:	39 c6                	cmp    %eax,%esi
+  8009b7:	73 32                	jae    8009eb <memmove+0x44>
+  8009b9:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8009bc:	39 d0                	cmp    %edx,%eax
+  8009be:	73 2b                	jae    8009eb <memmove+0x44>
+    s += n;
+    d += n;
+  8009c0:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009c3:	89 d6                	mov    %edx,%esi
+  8009c5:	09 fe                	or     %edi,%esi
+  8009c7:	09 ce                	or     %ecx,%esi
+  8009c9:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8009cf:	75 0e                	jne    8009df <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8009d1:	83 ef 04             	sub    $0x4,%edi
+  8009d4:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8009d7:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  8009da:	fd                   	std
+  8009db:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009dd:	eb 09                	jmp    8009e8 <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8009df:	83 ef 01             	sub    $0x1,%edi
+  8009e2:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  8009e5:	fd                   	std
+  8009e6:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  8009e8:	fc                   	cld
+  8009e9:	eb 1a                	jmp    800a05 <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009eb:	89 f2                	mov    %esi,%edx
+  8009ed:	09 c2                	or     %eax,%edx
+  8009ef:	09 ca                	or     %ecx,%edx
+  8009f1:	f6 c2 03             	test   $0x3,%dl
+  8009f4:	75 0a                	jne    800a00 <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8009f6:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  8009f9:	89 c7                	mov    %eax,%edi
+  8009fb:	fc                   	cld
+  8009fc:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009fe:	eb 05                	jmp    800a05 <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  800a00:	89 c7                	mov    %eax,%edi
+  800a02:	fc                   	cld
+  800a03:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  800a05:	5e                   	pop    %esi
+  800a06:	5f                   	pop    %edi
+  800a07:	5d                   	pop    %ebp
+  800a08:	c3                   	ret
+
+00800a09 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800a09:	55                   	push   %ebp
+  800a0a:	89 e5                	mov    %esp,%ebp
+  800a0c:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  800a0f:	ff 75 10             	push   0x10(%ebp)
+  800a12:	ff 75 0c             	push   0xc(%ebp)
+  800a15:	ff 75 08             	push   0x8(%ebp)
+  800a18:	e8 8a ff ff ff       	call   8009a7 <memmove>
+}
+  800a1d:	c9                   	leave
+  800a1e:	c3                   	ret
+
+00800a1f <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a1f:	55                   	push   %ebp
+  800a20:	89 e5                	mov    %esp,%ebp
+  800a22:	56                   	push   %esi
+  800a23:	53                   	push   %ebx
+  800a24:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a27:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  800a2a:	89 c6                	mov    %eax,%esi
+  800a2c:	03 75 10             	add    0x10(%ebp),%esi
+  800a2f:	eb 06                	jmp    800a37 <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  800a31:	83 c0 01             	add    $0x1,%eax
+  800a34:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  800a37:	39 f0                	cmp    %esi,%eax
+  800a39:	74 14                	je     800a4f <memcmp+0x30>
+    if (*s1 != *s2)
+  800a3b:	0f b6 08             	movzbl (%eax),%ecx
+  800a3e:	0f b6 1a             	movzbl (%edx),%ebx
+  800a41:	38 d9                	cmp    %bl,%cl
+  800a43:	74 ec                	je     800a31 <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  800a45:	0f b6 c1             	movzbl %cl,%eax
+  800a48:	0f b6 db             	movzbl %bl,%ebx
+  800a4b:	29 d8                	sub    %ebx,%eax
+  800a4d:	eb 05                	jmp    800a54 <memcmp+0x35>
+  }
+
+  return 0;
+  800a4f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a54:	5b                   	pop    %ebx
+  800a55:	5e                   	pop    %esi
+  800a56:	5d                   	pop    %ebp
+  800a57:	c3                   	ret
+
+00800a58 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a58:	55                   	push   %ebp
+  800a59:	89 e5                	mov    %esp,%ebp
+  800a5b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a5e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  800a61:	89 c2                	mov    %eax,%edx
+  800a63:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  800a66:	eb 03                	jmp    800a6b <memfind+0x13>
+  800a68:	83 c0 01             	add    $0x1,%eax
+  800a6b:	39 d0                	cmp    %edx,%eax
+  800a6d:	73 04                	jae    800a73 <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  800a6f:	38 08                	cmp    %cl,(%eax)
+  800a71:	75 f5                	jne    800a68 <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  800a73:	5d                   	pop    %ebp
+  800a74:	c3                   	ret
+
+00800a75 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a75:	55                   	push   %ebp
+  800a76:	89 e5                	mov    %esp,%ebp
+  800a78:	57                   	push   %edi
+  800a79:	56                   	push   %esi
+  800a7a:	53                   	push   %ebx
+  800a7b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a7e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  800a81:	eb 03                	jmp    800a86 <strtol+0x11>
+    s++;
+  800a83:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  800a86:	0f b6 02             	movzbl (%edx),%eax
+  800a89:	3c 20                	cmp    $0x20,%al
+  800a8b:	74 f6                	je     800a83 <strtol+0xe>
+  800a8d:	3c 09                	cmp    $0x9,%al
+  800a8f:	74 f2                	je     800a83 <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  800a91:	3c 2b                	cmp    $0x2b,%al
+  800a93:	74 2a                	je     800abf <strtol+0x4a>
+  int neg = 0;
+  800a95:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  800a9a:	3c 2d                	cmp    $0x2d,%al
+  800a9c:	74 2b                	je     800ac9 <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a9e:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800aa4:	75 0f                	jne    800ab5 <strtol+0x40>
+  800aa6:	80 3a 30             	cmpb   $0x30,(%edx)
+  800aa9:	74 28                	je     800ad3 <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  800aab:	85 db                	test   %ebx,%ebx
+  800aad:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ab2:	0f 44 d8             	cmove  %eax,%ebx
+  800ab5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800aba:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800abd:	eb 46                	jmp    800b05 <strtol+0x90>
+    s++;
+  800abf:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  800ac2:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ac7:	eb d5                	jmp    800a9e <strtol+0x29>
+    s++, neg = 1;
+  800ac9:	83 c2 01             	add    $0x1,%edx
+  800acc:	bf 01 00 00 00       	mov    $0x1,%edi
+  800ad1:	eb cb                	jmp    800a9e <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ad3:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800ad7:	74 0e                	je     800ae7 <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  800ad9:	85 db                	test   %ebx,%ebx
+  800adb:	75 d8                	jne    800ab5 <strtol+0x40>
+    s++, base = 8;
+  800add:	83 c2 01             	add    $0x1,%edx
+  800ae0:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800ae5:	eb ce                	jmp    800ab5 <strtol+0x40>
+    s += 2, base = 16;
+  800ae7:	83 c2 02             	add    $0x2,%edx
+  800aea:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800aef:	eb c4                	jmp    800ab5 <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  800af1:	0f be c0             	movsbl %al,%eax
+  800af4:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  800af7:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800afa:	7d 3a                	jge    800b36 <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  800afc:	83 c2 01             	add    $0x1,%edx
+  800aff:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800b03:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  800b05:	0f b6 02             	movzbl (%edx),%eax
+  800b08:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800b0b:	89 f3                	mov    %esi,%ebx
+  800b0d:	80 fb 09             	cmp    $0x9,%bl
+  800b10:	76 df                	jbe    800af1 <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  800b12:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800b15:	89 f3                	mov    %esi,%ebx
+  800b17:	80 fb 19             	cmp    $0x19,%bl
+  800b1a:	77 08                	ja     800b24 <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  800b1c:	0f be c0             	movsbl %al,%eax
+  800b1f:	83 e8 57             	sub    $0x57,%eax
+  800b22:	eb d3                	jmp    800af7 <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  800b24:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800b27:	89 f3                	mov    %esi,%ebx
+  800b29:	80 fb 19             	cmp    $0x19,%bl
+  800b2c:	77 08                	ja     800b36 <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  800b2e:	0f be c0             	movsbl %al,%eax
+  800b31:	83 e8 37             	sub    $0x37,%eax
+  800b34:	eb c1                	jmp    800af7 <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  800b36:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b3a:	74 05                	je     800b41 <strtol+0xcc>
+    *endptr = (char*)s;
+  800b3c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b3f:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  800b41:	89 c8                	mov    %ecx,%eax
+  800b43:	f7 d8                	neg    %eax
+  800b45:	85 ff                	test   %edi,%edi
+  800b47:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b4a:	89 c8                	mov    %ecx,%eax
+  800b4c:	5b                   	pop    %ebx
+  800b4d:	5e                   	pop    %esi
+  800b4e:	5f                   	pop    %edi
+  800b4f:	5d                   	pop    %ebp
+  800b50:	c3                   	ret
+
+00800b51 <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800b51:	55                   	push   %ebp
+  800b52:	89 e5                	mov    %esp,%ebp
+  800b54:	57                   	push   %edi
+  800b55:	56                   	push   %esi
+  800b56:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800b57:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b5c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b5f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b62:	89 c3                	mov    %eax,%ebx
+  800b64:	89 c7                	mov    %eax,%edi
+  800b66:	89 c6                	mov    %eax,%esi
+  800b68:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800b6a:	5b                   	pop    %ebx
+  800b6b:	5e                   	pop    %esi
+  800b6c:	5f                   	pop    %edi
+  800b6d:	5d                   	pop    %ebp
+  800b6e:	c3                   	ret
+
+00800b6f <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800b6f:	55                   	push   %ebp
+  800b70:	89 e5                	mov    %esp,%ebp
+  800b72:	57                   	push   %edi
+  800b73:	56                   	push   %esi
+  800b74:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800b75:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b7a:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b7f:	89 d1                	mov    %edx,%ecx
+  800b81:	89 d3                	mov    %edx,%ebx
+  800b83:	89 d7                	mov    %edx,%edi
+  800b85:	89 d6                	mov    %edx,%esi
+  800b87:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800b89:	5b                   	pop    %ebx
+  800b8a:	5e                   	pop    %esi
+  800b8b:	5f                   	pop    %edi
+  800b8c:	5d                   	pop    %ebp
+  800b8d:	c3                   	ret
+
+00800b8e <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800b8e:	55                   	push   %ebp
+  800b8f:	89 e5                	mov    %esp,%ebp
+  800b91:	57                   	push   %edi
+  800b92:	56                   	push   %esi
+  800b93:	53                   	push   %ebx
+  800b94:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800b97:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b9c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b9f:	b8 03 00 00 00       	mov    $0x3,%eax
+  800ba4:	89 cb                	mov    %ecx,%ebx
+  800ba6:	89 cf                	mov    %ecx,%edi
+  800ba8:	89 ce                	mov    %ecx,%esi
+  800baa:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800bac:	85 c0                	test   %eax,%eax
+  800bae:	7f 08                	jg     800bb8 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800bb0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800bb3:	5b                   	pop    %ebx
+  800bb4:	5e                   	pop    %esi
+  800bb5:	5f                   	pop    %edi
+  800bb6:	5d                   	pop    %ebp
+  800bb7:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800bb8:	83 ec 0c             	sub    $0xc,%esp
+  800bbb:	50                   	push   %eax
+  800bbc:	6a 03                	push   $0x3
+  800bbe:	68 63 3d 80 00       	push   $0x803d63
+  800bc3:	6a 23                	push   $0x23
+  800bc5:	68 80 3d 80 00       	push   $0x803d80
+  800bca:	e8 89 f5 ff ff       	call   800158 <_panic>
+
+00800bcf <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800bcf:	55                   	push   %ebp
+  800bd0:	89 e5                	mov    %esp,%ebp
+  800bd2:	57                   	push   %edi
+  800bd3:	56                   	push   %esi
+  800bd4:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800bd5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bda:	b8 02 00 00 00       	mov    $0x2,%eax
+  800bdf:	89 d1                	mov    %edx,%ecx
+  800be1:	89 d3                	mov    %edx,%ebx
+  800be3:	89 d7                	mov    %edx,%edi
+  800be5:	89 d6                	mov    %edx,%esi
+  800be7:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800be9:	5b                   	pop    %ebx
+  800bea:	5e                   	pop    %esi
+  800beb:	5f                   	pop    %edi
+  800bec:	5d                   	pop    %ebp
+  800bed:	c3                   	ret
+
+00800bee <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800bee:	55                   	push   %ebp
+  800bef:	89 e5                	mov    %esp,%ebp
+  800bf1:	57                   	push   %edi
+  800bf2:	56                   	push   %esi
+  800bf3:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800bf4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bf9:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800bfe:	89 d1                	mov    %edx,%ecx
+  800c00:	89 d3                	mov    %edx,%ebx
+  800c02:	89 d7                	mov    %edx,%edi
+  800c04:	89 d6                	mov    %edx,%esi
+  800c06:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800c08:	5b                   	pop    %ebx
+  800c09:	5e                   	pop    %esi
+  800c0a:	5f                   	pop    %edi
+  800c0b:	5d                   	pop    %ebp
+  800c0c:	c3                   	ret
+
+00800c0d <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  800c0d:	55                   	push   %ebp
+  800c0e:	89 e5                	mov    %esp,%ebp
+  800c10:	57                   	push   %edi
+  800c11:	56                   	push   %esi
+  800c12:	53                   	push   %ebx
+  800c13:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  800c16:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  800c1a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c1f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c22:	b8 14 00 00 00       	mov    $0x14,%eax
+  800c27:	89 df                	mov    %ebx,%edi
+  800c29:	89 de                	mov    %ebx,%esi
+  800c2b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c2d:	85 c0                	test   %eax,%eax
+  800c2f:	7f 08                	jg     800c39 <sys_env_set_cow+0x2c>
+}
+  800c31:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c34:	5b                   	pop    %ebx
+  800c35:	5e                   	pop    %esi
+  800c36:	5f                   	pop    %edi
+  800c37:	5d                   	pop    %ebp
+  800c38:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c39:	83 ec 0c             	sub    $0xc,%esp
+  800c3c:	50                   	push   %eax
+  800c3d:	6a 14                	push   $0x14
+  800c3f:	68 63 3d 80 00       	push   $0x803d63
+  800c44:	6a 23                	push   $0x23
+  800c46:	68 80 3d 80 00       	push   $0x803d80
+  800c4b:	e8 08 f5 ff ff       	call   800158 <_panic>
+
+00800c50 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800c50:	55                   	push   %ebp
+  800c51:	89 e5                	mov    %esp,%ebp
+  800c53:	57                   	push   %edi
+  800c54:	56                   	push   %esi
+  800c55:	53                   	push   %ebx
+  800c56:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800c59:	be 00 00 00 00       	mov    $0x0,%esi
+  800c5e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c61:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c64:	b8 04 00 00 00       	mov    $0x4,%eax
+  800c69:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c6c:	89 f7                	mov    %esi,%edi
+  800c6e:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c70:	85 c0                	test   %eax,%eax
+  800c72:	7f 08                	jg     800c7c <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  800c74:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c77:	5b                   	pop    %ebx
+  800c78:	5e                   	pop    %esi
+  800c79:	5f                   	pop    %edi
+  800c7a:	5d                   	pop    %ebp
+  800c7b:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c7c:	83 ec 0c             	sub    $0xc,%esp
+  800c7f:	50                   	push   %eax
+  800c80:	6a 04                	push   $0x4
+  800c82:	68 63 3d 80 00       	push   $0x803d63
+  800c87:	6a 23                	push   $0x23
+  800c89:	68 80 3d 80 00       	push   $0x803d80
+  800c8e:	e8 c5 f4 ff ff       	call   800158 <_panic>
+
+00800c93 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800c93:	55                   	push   %ebp
+  800c94:	89 e5                	mov    %esp,%ebp
+  800c96:	57                   	push   %edi
+  800c97:	56                   	push   %esi
+  800c98:	53                   	push   %ebx
+  800c99:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800c9c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c9f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ca2:	b8 05 00 00 00       	mov    $0x5,%eax
+  800ca7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800caa:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800cad:	8b 75 18             	mov    0x18(%ebp),%esi
+  800cb0:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800cb2:	85 c0                	test   %eax,%eax
+  800cb4:	7f 08                	jg     800cbe <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  800cb6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cb9:	5b                   	pop    %ebx
+  800cba:	5e                   	pop    %esi
+  800cbb:	5f                   	pop    %edi
+  800cbc:	5d                   	pop    %ebp
+  800cbd:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800cbe:	83 ec 0c             	sub    $0xc,%esp
+  800cc1:	50                   	push   %eax
+  800cc2:	6a 05                	push   $0x5
+  800cc4:	68 63 3d 80 00       	push   $0x803d63
+  800cc9:	6a 23                	push   $0x23
+  800ccb:	68 80 3d 80 00       	push   $0x803d80
+  800cd0:	e8 83 f4 ff ff       	call   800158 <_panic>
+
+00800cd5 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800cd5:	55                   	push   %ebp
+  800cd6:	89 e5                	mov    %esp,%ebp
+  800cd8:	57                   	push   %edi
+  800cd9:	56                   	push   %esi
+  800cda:	53                   	push   %ebx
+  800cdb:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800cde:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ce3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ce6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ce9:	b8 06 00 00 00       	mov    $0x6,%eax
+  800cee:	89 df                	mov    %ebx,%edi
+  800cf0:	89 de                	mov    %ebx,%esi
+  800cf2:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800cf4:	85 c0                	test   %eax,%eax
+  800cf6:	7f 08                	jg     800d00 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  800cf8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cfb:	5b                   	pop    %ebx
+  800cfc:	5e                   	pop    %esi
+  800cfd:	5f                   	pop    %edi
+  800cfe:	5d                   	pop    %ebp
+  800cff:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d00:	83 ec 0c             	sub    $0xc,%esp
+  800d03:	50                   	push   %eax
+  800d04:	6a 06                	push   $0x6
+  800d06:	68 63 3d 80 00       	push   $0x803d63
+  800d0b:	6a 23                	push   $0x23
+  800d0d:	68 80 3d 80 00       	push   $0x803d80
+  800d12:	e8 41 f4 ff ff       	call   800158 <_panic>
+
+00800d17 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  800d17:	55                   	push   %ebp
+  800d18:	89 e5                	mov    %esp,%ebp
+  800d1a:	57                   	push   %edi
+  800d1b:	56                   	push   %esi
+  800d1c:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d1d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d20:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d23:	b8 11 00 00 00       	mov    $0x11,%eax
+  800d28:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d2b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d2e:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d31:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  800d33:	5b                   	pop    %ebx
+  800d34:	5e                   	pop    %esi
+  800d35:	5f                   	pop    %edi
+  800d36:	5d                   	pop    %ebp
+  800d37:	c3                   	ret
+
+00800d38 <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  800d38:	55                   	push   %ebp
+  800d39:	89 e5                	mov    %esp,%ebp
+  800d3b:	57                   	push   %edi
+  800d3c:	56                   	push   %esi
+  800d3d:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d3e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d41:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d44:	b8 12 00 00 00       	mov    $0x12,%eax
+  800d49:	be 00 00 00 00       	mov    $0x0,%esi
+  800d4e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d51:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d54:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  800d56:	5b                   	pop    %ebx
+  800d57:	5e                   	pop    %esi
+  800d58:	5f                   	pop    %edi
+  800d59:	5d                   	pop    %ebp
+  800d5a:	c3                   	ret
+
+00800d5b <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  800d5b:	55                   	push   %ebp
+  800d5c:	89 e5                	mov    %esp,%ebp
+  800d5e:	57                   	push   %edi
+  800d5f:	56                   	push   %esi
+  800d60:	53                   	push   %ebx
+  800d61:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800d64:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d69:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d6c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d6f:	b8 16 00 00 00       	mov    $0x16,%eax
+  800d74:	89 df                	mov    %ebx,%edi
+  800d76:	89 de                	mov    %ebx,%esi
+  800d78:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d7a:	85 c0                	test   %eax,%eax
+  800d7c:	7f 08                	jg     800d86 <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  800d7e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d81:	5b                   	pop    %ebx
+  800d82:	5e                   	pop    %esi
+  800d83:	5f                   	pop    %edi
+  800d84:	5d                   	pop    %ebp
+  800d85:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d86:	83 ec 0c             	sub    $0xc,%esp
+  800d89:	50                   	push   %eax
+  800d8a:	6a 16                	push   $0x16
+  800d8c:	68 63 3d 80 00       	push   $0x803d63
+  800d91:	6a 23                	push   $0x23
+  800d93:	68 80 3d 80 00       	push   $0x803d80
+  800d98:	e8 bb f3 ff ff       	call   800158 <_panic>
+
+00800d9d <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  800d9d:	55                   	push   %ebp
+  800d9e:	89 e5                	mov    %esp,%ebp
+  800da0:	57                   	push   %edi
+  800da1:	56                   	push   %esi
+  800da2:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800da3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800da8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dab:	b8 17 00 00 00       	mov    $0x17,%eax
+  800db0:	89 cb                	mov    %ecx,%ebx
+  800db2:	89 cf                	mov    %ecx,%edi
+  800db4:	89 ce                	mov    %ecx,%esi
+  800db6:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  800db8:	5b                   	pop    %ebx
+  800db9:	5e                   	pop    %esi
+  800dba:	5f                   	pop    %edi
+  800dbb:	5d                   	pop    %ebp
+  800dbc:	c3                   	ret
+
+00800dbd <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  800dbd:	55                   	push   %ebp
+  800dbe:	89 e5                	mov    %esp,%ebp
+  800dc0:	57                   	push   %edi
+  800dc1:	56                   	push   %esi
+  800dc2:	53                   	push   %ebx
+  800dc3:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800dc6:	be 00 00 00 00       	mov    $0x0,%esi
+  800dcb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dce:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dd1:	b8 18 00 00 00       	mov    $0x18,%eax
+  800dd6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dd9:	89 f7                	mov    %esi,%edi
+  800ddb:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ddd:	85 c0                	test   %eax,%eax
+  800ddf:	7f 08                	jg     800de9 <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  800de1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800de4:	5b                   	pop    %ebx
+  800de5:	5e                   	pop    %esi
+  800de6:	5f                   	pop    %edi
+  800de7:	5d                   	pop    %ebp
+  800de8:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800de9:	83 ec 0c             	sub    $0xc,%esp
+  800dec:	50                   	push   %eax
+  800ded:	6a 18                	push   $0x18
+  800def:	68 63 3d 80 00       	push   $0x803d63
+  800df4:	6a 23                	push   $0x23
+  800df6:	68 80 3d 80 00       	push   $0x803d80
+  800dfb:	e8 58 f3 ff ff       	call   800158 <_panic>
+
+00800e00 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  800e00:	55                   	push   %ebp
+  800e01:	89 e5                	mov    %esp,%ebp
+  800e03:	57                   	push   %edi
+  800e04:	56                   	push   %esi
+  800e05:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e06:	be 00 00 00 00       	mov    $0x0,%esi
+  800e0b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e0e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e11:	b8 19 00 00 00       	mov    $0x19,%eax
+  800e16:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e19:	89 f7                	mov    %esi,%edi
+  800e1b:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  800e1d:	5b                   	pop    %ebx
+  800e1e:	5e                   	pop    %esi
+  800e1f:	5f                   	pop    %edi
+  800e20:	5d                   	pop    %ebp
+  800e21:	c3                   	ret
+
+00800e22 <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  800e22:	55                   	push   %ebp
+  800e23:	89 e5                	mov    %esp,%ebp
+  800e25:	57                   	push   %edi
+  800e26:	56                   	push   %esi
+  800e27:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e28:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e2d:	b8 15 00 00 00       	mov    $0x15,%eax
+  800e32:	89 d1                	mov    %edx,%ecx
+  800e34:	89 d3                	mov    %edx,%ebx
+  800e36:	89 d7                	mov    %edx,%edi
+  800e38:	89 d6                	mov    %edx,%esi
+  800e3a:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800e3c:	5b                   	pop    %ebx
+  800e3d:	5e                   	pop    %esi
+  800e3e:	5f                   	pop    %edi
+  800e3f:	5d                   	pop    %ebp
+  800e40:	c3                   	ret
+
+00800e41 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800e41:	55                   	push   %ebp
+  800e42:	89 e5                	mov    %esp,%ebp
+  800e44:	57                   	push   %edi
+  800e45:	56                   	push   %esi
+  800e46:	53                   	push   %ebx
+  800e47:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e4a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e4f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e52:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e55:	b8 08 00 00 00       	mov    $0x8,%eax
+  800e5a:	89 df                	mov    %ebx,%edi
+  800e5c:	89 de                	mov    %ebx,%esi
+  800e5e:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e60:	85 c0                	test   %eax,%eax
+  800e62:	7f 08                	jg     800e6c <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800e64:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e67:	5b                   	pop    %ebx
+  800e68:	5e                   	pop    %esi
+  800e69:	5f                   	pop    %edi
+  800e6a:	5d                   	pop    %ebp
+  800e6b:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e6c:	83 ec 0c             	sub    $0xc,%esp
+  800e6f:	50                   	push   %eax
+  800e70:	6a 08                	push   $0x8
+  800e72:	68 63 3d 80 00       	push   $0x803d63
+  800e77:	6a 23                	push   $0x23
+  800e79:	68 80 3d 80 00       	push   $0x803d80
+  800e7e:	e8 d5 f2 ff ff       	call   800158 <_panic>
+
+00800e83 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800e83:	55                   	push   %ebp
+  800e84:	89 e5                	mov    %esp,%ebp
+  800e86:	57                   	push   %edi
+  800e87:	56                   	push   %esi
+  800e88:	53                   	push   %ebx
+  800e89:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e8c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e91:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e94:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e97:	b8 09 00 00 00       	mov    $0x9,%eax
+  800e9c:	89 df                	mov    %ebx,%edi
+  800e9e:	89 de                	mov    %ebx,%esi
+  800ea0:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ea2:	85 c0                	test   %eax,%eax
+  800ea4:	7f 08                	jg     800eae <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  800ea6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ea9:	5b                   	pop    %ebx
+  800eaa:	5e                   	pop    %esi
+  800eab:	5f                   	pop    %edi
+  800eac:	5d                   	pop    %ebp
+  800ead:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800eae:	83 ec 0c             	sub    $0xc,%esp
+  800eb1:	50                   	push   %eax
+  800eb2:	6a 09                	push   $0x9
+  800eb4:	68 63 3d 80 00       	push   $0x803d63
+  800eb9:	6a 23                	push   $0x23
+  800ebb:	68 80 3d 80 00       	push   $0x803d80
+  800ec0:	e8 93 f2 ff ff       	call   800158 <_panic>
+
+00800ec5 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800ec5:	55                   	push   %ebp
+  800ec6:	89 e5                	mov    %esp,%ebp
+  800ec8:	57                   	push   %edi
+  800ec9:	56                   	push   %esi
+  800eca:	53                   	push   %ebx
+  800ecb:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800ece:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ed3:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ed6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ed9:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ede:	89 df                	mov    %ebx,%edi
+  800ee0:	89 de                	mov    %ebx,%esi
+  800ee2:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ee4:	85 c0                	test   %eax,%eax
+  800ee6:	7f 08                	jg     800ef0 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  800ee8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800eeb:	5b                   	pop    %ebx
+  800eec:	5e                   	pop    %esi
+  800eed:	5f                   	pop    %edi
+  800eee:	5d                   	pop    %ebp
+  800eef:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ef0:	83 ec 0c             	sub    $0xc,%esp
+  800ef3:	50                   	push   %eax
+  800ef4:	6a 0a                	push   $0xa
+  800ef6:	68 63 3d 80 00       	push   $0x803d63
+  800efb:	6a 23                	push   $0x23
+  800efd:	68 80 3d 80 00       	push   $0x803d80
+  800f02:	e8 51 f2 ff ff       	call   800158 <_panic>
+
+00800f07 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  800f07:	55                   	push   %ebp
+  800f08:	89 e5                	mov    %esp,%ebp
+  800f0a:	57                   	push   %edi
+  800f0b:	56                   	push   %esi
+  800f0c:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f0d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f10:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f13:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f18:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f1b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f1e:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f21:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  800f23:	5b                   	pop    %ebx
+  800f24:	5e                   	pop    %esi
+  800f25:	5f                   	pop    %edi
+  800f26:	5d                   	pop    %ebp
+  800f27:	c3                   	ret
+
+00800f28 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  800f28:	55                   	push   %ebp
+  800f29:	89 e5                	mov    %esp,%ebp
+  800f2b:	57                   	push   %edi
+  800f2c:	56                   	push   %esi
+  800f2d:	53                   	push   %ebx
+  800f2e:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f31:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f36:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f39:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f3c:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f41:	89 df                	mov    %ebx,%edi
+  800f43:	89 de                	mov    %ebx,%esi
+  800f45:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f47:	85 c0                	test   %eax,%eax
+  800f49:	7f 08                	jg     800f53 <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  800f4b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f4e:	5b                   	pop    %ebx
+  800f4f:	5e                   	pop    %esi
+  800f50:	5f                   	pop    %edi
+  800f51:	5d                   	pop    %ebp
+  800f52:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f53:	83 ec 0c             	sub    $0xc,%esp
+  800f56:	50                   	push   %eax
+  800f57:	6a 0d                	push   $0xd
+  800f59:	68 63 3d 80 00       	push   $0x803d63
+  800f5e:	6a 23                	push   $0x23
+  800f60:	68 80 3d 80 00       	push   $0x803d80
+  800f65:	e8 ee f1 ff ff       	call   800158 <_panic>
+
+00800f6a <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  800f6a:	55                   	push   %ebp
+  800f6b:	89 e5                	mov    %esp,%ebp
+  800f6d:	57                   	push   %edi
+  800f6e:	56                   	push   %esi
+  800f6f:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f70:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f75:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800f7a:	89 d1                	mov    %edx,%ecx
+  800f7c:	89 d3                	mov    %edx,%ebx
+  800f7e:	89 d7                	mov    %edx,%edi
+  800f80:	89 d6                	mov    %edx,%esi
+  800f82:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800f84:	5b                   	pop    %ebx
+  800f85:	5e                   	pop    %esi
+  800f86:	5f                   	pop    %edi
+  800f87:	5d                   	pop    %ebp
+  800f88:	c3                   	ret
+
+00800f89 <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  800f89:	55                   	push   %ebp
+  800f8a:	89 e5                	mov    %esp,%ebp
+  800f8c:	57                   	push   %edi
+  800f8d:	56                   	push   %esi
+  800f8e:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f8f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f92:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f95:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f9a:	be 00 00 00 00       	mov    $0x0,%esi
+  800f9f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fa2:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fa5:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  800fa7:	5b                   	pop    %ebx
+  800fa8:	5e                   	pop    %esi
+  800fa9:	5f                   	pop    %edi
+  800faa:	5d                   	pop    %ebp
+  800fab:	c3                   	ret
+
+00800fac <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  800fac:	55                   	push   %ebp
+  800fad:	89 e5                	mov    %esp,%ebp
+  800faf:	57                   	push   %edi
+  800fb0:	56                   	push   %esi
+  800fb1:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800fb2:	be 00 00 00 00       	mov    $0x0,%esi
+  800fb7:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fba:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fbd:	b8 10 00 00 00       	mov    $0x10,%eax
+  800fc2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fc5:	89 f7                	mov    %esi,%edi
+  800fc7:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  800fc9:	5b                   	pop    %ebx
+  800fca:	5e                   	pop    %esi
+  800fcb:	5f                   	pop    %edi
+  800fcc:	5d                   	pop    %ebp
+  800fcd:	c3                   	ret
+
+00800fce <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  800fce:	55                   	push   %ebp
+  800fcf:	89 e5                	mov    %esp,%ebp
+  800fd1:	57                   	push   %edi
+  800fd2:	56                   	push   %esi
+  800fd3:	53                   	push   %ebx
+  800fd4:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  800fd7:	80 3d a8 58 80 00 00 	cmpb   $0x0,0x8058a8
+  800fde:	74 41                	je     801021 <sys_batch+0x53>
+  800fe0:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fe3:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  800fe6:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  800fed:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800ff0:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  800ff3:	7d 45                	jge    80103a <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  800ff5:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800ff8:	8b 06                	mov    (%esi),%eax
+  800ffa:	8b 56 04             	mov    0x4(%esi),%edx
+  800ffd:	8b 4e 08             	mov    0x8(%esi),%ecx
+  801000:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  801003:	8b 7e 10             	mov    0x10(%esi),%edi
+  801006:	8b 76 14             	mov    0x14(%esi),%esi
+  801009:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  80100b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80100e:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  801011:	83 c6 1c             	add    $0x1c,%esi
+  801014:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  801017:	85 c0                	test   %eax,%eax
+  801019:	78 1f                	js     80103a <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  80101b:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  80101f:	eb cc                	jmp    800fed <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  801021:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801026:	b8 13 00 00 00       	mov    $0x13,%eax
+  80102b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80102e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801031:	89 df                	mov    %ebx,%edi
+  801033:	89 de                	mov    %ebx,%esi
+  801035:	cd 30                	int    $0x30
+  801037:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  80103a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80103d:	83 c4 08             	add    $0x8,%esp
+  801040:	5b                   	pop    %ebx
+  801041:	5e                   	pop    %esi
+  801042:	5f                   	pop    %edi
+  801043:	5d                   	pop    %ebp
+  801044:	c3                   	ret
+
+00801045 <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  801045:	55                   	push   %ebp
+  801046:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  801048:	8b 45 08             	mov    0x8(%ebp),%eax
+  80104b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  801051:	5d                   	pop    %ebp
+  801052:	c3                   	ret
+
+00801053 <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  801053:	55                   	push   %ebp
+  801054:	89 e5                	mov    %esp,%ebp
+  801056:	56                   	push   %esi
+  801057:	53                   	push   %ebx
+  801058:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  80105b:	8b 1e                	mov    (%esi),%ebx
+  80105d:	85 db                	test   %ebx,%ebx
+  80105f:	75 09                	jne    80106a <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  801061:	89 d8                	mov    %ebx,%eax
+  801063:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801066:	5b                   	pop    %ebx
+  801067:	5e                   	pop    %esi
+  801068:	5d                   	pop    %ebp
+  801069:	c3                   	ret
+  b->sb_n = 0;
+  80106a:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  801070:	53                   	push   %ebx
+  801071:	8d 46 04             	lea    0x4(%esi),%eax
+  801074:	50                   	push   %eax
+  801075:	e8 54 ff ff ff       	call   800fce <sys_batch>
+  80107a:	83 c4 08             	add    $0x8,%esp
+  80107d:	85 c0                	test   %eax,%eax
+  80107f:	78 1e                	js     80109f <sysbatch_flush+0x4c>
+  if (r < n)
+  801081:	39 c3                	cmp    %eax,%ebx
+  801083:	7f 07                	jg     80108c <sysbatch_flush+0x39>
+  return 0;
+  801085:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80108a:	eb d5                	jmp    801061 <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  80108c:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80108f:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  801093:	85 db                	test   %ebx,%ebx
+  801095:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80109a:	0f 49 d8             	cmovns %eax,%ebx
+  80109d:	eb c2                	jmp    801061 <sysbatch_flush+0xe>
+    return r;
+  80109f:	89 c3                	mov    %eax,%ebx
+  8010a1:	eb be                	jmp    801061 <sysbatch_flush+0xe>
+
+008010a3 <sysbatch_add>:
+{
+  8010a3:	55                   	push   %ebp
+  8010a4:	89 e5                	mov    %esp,%ebp
+  8010a6:	53                   	push   %ebx
+  8010a7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  8010aa:	83 3b 40             	cmpl   $0x40,(%ebx)
+  8010ad:	74 41                	je     8010f0 <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  8010af:	8b 03                	mov    (%ebx),%eax
+  8010b1:	8d 50 01             	lea    0x1(%eax),%edx
+  8010b4:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  8010b6:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8010b9:	01 d8                	add    %ebx,%eax
+  8010bb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8010be:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  8010c1:	8b 55 10             	mov    0x10(%ebp),%edx
+  8010c4:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  8010c7:	8b 55 14             	mov    0x14(%ebp),%edx
+  8010ca:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  8010cd:	8b 55 18             	mov    0x18(%ebp),%edx
+  8010d0:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  8010d3:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  8010d6:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  8010d9:	8b 55 20             	mov    0x20(%ebp),%edx
+  8010dc:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  8010df:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  8010e6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8010eb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8010ee:	c9                   	leave
+  8010ef:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  8010f0:	53                   	push   %ebx
+  8010f1:	e8 5d ff ff ff       	call   801053 <sysbatch_flush>
+  8010f6:	83 c4 04             	add    $0x4,%esp
+  8010f9:	85 c0                	test   %eax,%eax
+  8010fb:	79 b2                	jns    8010af <sysbatch_add+0xc>
+  8010fd:	eb ec                	jmp    8010eb <sysbatch_add+0x48>
+
+008010ff <pgfault>:
+// Custom page fault handler - if faulting page is copy-on-write,
+// map in our own private writable copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  8010ff:	55                   	push   %ebp
+  801100:	89 e5                	mov    %esp,%ebp
+  801102:	56                   	push   %esi
+  801103:	53                   	push   %ebx
+  801104:	8b 45 08             	mov    0x8(%ebp),%eax
+  void *addr = (void*)utf->utf_fault_va;
+  801107:	8b 18                	mov    (%eax),%ebx
+  uint32_t err = utf->utf_err;
+  801109:	8b 70 04             	mov    0x4(%eax),%esi
+  // Hint:
+  //   Use the read-only page table mappings at uvpt
+  //   (see <inc/memlayout.h>).
+
+  // Faults in file mappings are mmap's to handle.
+  if (mmap_fault(utf))
+  80110c:	83 ec 0c             	sub    $0xc,%esp
+  80110f:	50                   	push   %eax
+  801110:	e8 b4 1d 00 00       	call   802ec9 <mmap_fault>
+  801115:	83 c4 10             	add    $0x10,%esp
+  801118:	84 c0                	test   %al,%al
+  80111a:	75 7d                	jne    801199 <pgfault+0x9a>
+    return;
+
+  // LAB 4: Your code here.
+  if ( !(err & FEC_WR) ) {
+  80111c:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  801122:	74 7c                	je     8011a0 <pgfault+0xa1>
+    panic("user_pgfault: %e", err);
+  }
+
+  if ( !(uvpt[PGNUM(addr)] & PTE_COW) ) {
+  801124:	89 d8                	mov    %ebx,%eax
+  801126:	c1 e8 0c             	shr    $0xc,%eax
+  801129:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801130:	f6 c4 08             	test   $0x8,%ah
+  801133:	74 7d                	je     8011b2 <pgfault+0xb3>
+  // page to the old page's address.
+  // Hint:
+  //   You should make three system calls.
+
+  // LAB 4: Your code here.
+  addr = ROUNDDOWN(addr, PGSIZE);
+  801135:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+
+  // map page to temporary location
+  if ( (r = sys_page_alloc(0, PFTEMP, (PTE_P | PTE_U | PTE_W))) < 0) {
+  80113b:	83 ec 04             	sub    $0x4,%esp
+  80113e:	6a 07                	push   $0x7
+  801140:	68 00 f0 7f 00       	push   $0x7ff000
+  801145:	6a 00                	push   $0x0
+  801147:	e8 04 fb ff ff       	call   800c50 <sys_page_alloc>
+  80114c:	83 c4 10             	add    $0x10,%esp
+  80114f:	85 c0                	test   %eax,%eax
+  801151:	78 73                	js     8011c6 <pgfault+0xc7>
+    panic("sys_page_alloc: %e", r);
+  }
+
+  // copy data from old page to new page
+  memmove(PFTEMP, addr, PGSIZE);
+  801153:	83 ec 04             	sub    $0x4,%esp
+  801156:	68 00 10 00 00       	push   $0x1000
+  80115b:	53                   	push   %ebx
+  80115c:	68 00 f0 7f 00       	push   $0x7ff000
+  801161:	e8 41 f8 ff ff       	call   8009a7 <memmove>
+
+  // move new page to old page address
+  if ( (r = sys_page_map(0, PFTEMP, 0, addr, (PTE_P | PTE_U | PTE_W))) < 0) {
+  801166:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  80116d:	53                   	push   %ebx
+  80116e:	6a 00                	push   $0x0
+  801170:	68 00 f0 7f 00       	push   $0x7ff000
+  801175:	6a 00                	push   $0x0
+  801177:	e8 17 fb ff ff       	call   800c93 <sys_page_map>
+  80117c:	83 c4 20             	add    $0x20,%esp
+  80117f:	85 c0                	test   %eax,%eax
+  801181:	78 55                	js     8011d8 <pgfault+0xd9>
+    panic("sys_page_map: %e", r);
+  }
+
+  if ( (r = sys_page_unmap(0, PFTEMP)) < 0) {
+  801183:	83 ec 08             	sub    $0x8,%esp
+  801186:	68 00 f0 7f 00       	push   $0x7ff000
+  80118b:	6a 00                	push   $0x0
+  80118d:	e8 43 fb ff ff       	call   800cd5 <sys_page_unmap>
+  801192:	83 c4 10             	add    $0x10,%esp
+  801195:	85 c0                	test   %eax,%eax
+  801197:	78 51                	js     8011ea <pgfault+0xeb>
+    panic("sys_page_unmap: %e", r);
+  }
+}
+  801199:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80119c:	5b                   	pop    %ebx
+  80119d:	5e                   	pop    %esi
+  80119e:	5d                   	pop    %ebp
+  80119f:	c3                   	ret
+    panic("user_pgfault: %e", err);
+  8011a0:	56                   	push   %esi
+  8011a1:	68 8e 3d 80 00       	push   $0x803d8e
+  8011a6:	6a 1d                	push   $0x1d
+  8011a8:	68 9f 3d 80 00       	push   $0x803d9f
+  8011ad:	e8 a6 ef ff ff       	call   800158 <_panic>
+    panic("user_pgfault: page not COW");
+  8011b2:	83 ec 04             	sub    $0x4,%esp
+  8011b5:	68 aa 3d 80 00       	push   $0x803daa
+  8011ba:	6a 21                	push   $0x21
+  8011bc:	68 9f 3d 80 00       	push   $0x803d9f
+  8011c1:	e8 92 ef ff ff       	call   800158 <_panic>
+    panic("sys_page_alloc: %e", r);
+  8011c6:	50                   	push   %eax
+  8011c7:	68 c5 3d 80 00       	push   $0x803dc5
+  8011cc:	6a 2f                	push   $0x2f
+  8011ce:	68 9f 3d 80 00       	push   $0x803d9f
+  8011d3:	e8 80 ef ff ff       	call   800158 <_panic>
+    panic("sys_page_map: %e", r);
+  8011d8:	50                   	push   %eax
+  8011d9:	68 d8 3d 80 00       	push   $0x803dd8
+  8011de:	6a 37                	push   $0x37
+  8011e0:	68 9f 3d 80 00       	push   $0x803d9f
+  8011e5:	e8 6e ef ff ff       	call   800158 <_panic>
+    panic("sys_page_unmap: %e", r);
+  8011ea:	50                   	push   %eax
+  8011eb:	68 e9 3d 80 00       	push   $0x803de9
+  8011f0:	6a 3b                	push   $0x3b
+  8011f2:	68 9f 3d 80 00       	push   $0x803d9f
+  8011f7:	e8 5c ef ff ff       	call   800158 <_panic>
+
+008011fc <shared_pgfault>:
+
+// Challenge!
+//
+static void
+shared_pgfault(struct UTrapframe *utf)
+{
+  8011fc:	55                   	push   %ebp
+  8011fd:	89 e5                	mov    %esp,%ebp
+  8011ff:	53                   	push   %ebx
+  801200:	83 ec 10             	sub    $0x10,%esp
+  801203:	8b 45 08             	mov    0x8(%ebp),%eax
+  // just has fewer error checks
+  
+  void *addr = (void*)utf->utf_fault_va;
+  801206:	8b 18                	mov    (%eax),%ebx
+  uint32_t err = utf->utf_err;
+  int r;
+
+  if (mmap_fault(utf))
+  801208:	50                   	push   %eax
+  801209:	e8 bb 1c 00 00       	call   802ec9 <mmap_fault>
+  80120e:	83 c4 10             	add    $0x10,%esp
+  801211:	84 c0                	test   %al,%al
+  801213:	74 05                	je     80121a <shared_pgfault+0x1e>
+  }
+
+  if ( (r = sys_page_unmap(0, PFTEMP)) < 0) {
+    panic("sys_page_unmap: %e", r);
+  }
+}
+  801215:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801218:	c9                   	leave
+  801219:	c3                   	ret
+  addr = ROUNDDOWN(addr, PGSIZE);
+  80121a:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if ( (r = sys_page_alloc(0, PFTEMP, (PTE_P | PTE_U | PTE_W))) < 0) {
+  801220:	83 ec 04             	sub    $0x4,%esp
+  801223:	6a 07                	push   $0x7
+  801225:	68 00 f0 7f 00       	push   $0x7ff000
+  80122a:	6a 00                	push   $0x0
+  80122c:	e8 1f fa ff ff       	call   800c50 <sys_page_alloc>
+  801231:	83 c4 10             	add    $0x10,%esp
+  801234:	85 c0                	test   %eax,%eax
+  801236:	78 5b                	js     801293 <shared_pgfault+0x97>
+  memmove(PFTEMP, addr, PGSIZE);
+  801238:	83 ec 04             	sub    $0x4,%esp
+  80123b:	68 00 10 00 00       	push   $0x1000
+  801240:	53                   	push   %ebx
+  801241:	68 00 f0 7f 00       	push   $0x7ff000
+  801246:	e8 5c f7 ff ff       	call   8009a7 <memmove>
+  if ( (r = sys_page_map(0, PFTEMP, 0, addr, (PTE_P | PTE_U | PTE_W))) < 0) {
+  80124b:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801252:	53                   	push   %ebx
+  801253:	6a 00                	push   $0x0
+  801255:	68 00 f0 7f 00       	push   $0x7ff000
+  80125a:	6a 00                	push   $0x0
+  80125c:	e8 32 fa ff ff       	call   800c93 <sys_page_map>
+  801261:	83 c4 20             	add    $0x20,%esp
+  801264:	85 c0                	test   %eax,%eax
+  801266:	78 40                	js     8012a8 <shared_pgfault+0xac>
+  if ( (r = sys_page_unmap(0, PFTEMP)) < 0) {
+  801268:	83 ec 08             	sub    $0x8,%esp
+  80126b:	68 00 f0 7f 00       	push   $0x7ff000
+  801270:	6a 00                	push   $0x0
+  801272:	e8 5e fa ff ff       	call   800cd5 <sys_page_unmap>
+  801277:	83 c4 10             	add    $0x10,%esp
+  80127a:	85 c0                	test   %eax,%eax
+  80127c:	79 97                	jns    801215 <shared_pgfault+0x19>
+    panic("sys_page_unmap: %e", r);
+  80127e:	50                   	push   %eax
+  80127f:	68 e9 3d 80 00       	push   $0x803de9
+  801284:	68 b0 00 00 00       	push   $0xb0
+  801289:	68 9f 3d 80 00       	push   $0x803d9f
+  80128e:	e8 c5 ee ff ff       	call   800158 <_panic>
+    panic("sys_page_alloc: %e", r);
+  801293:	50                   	push   %eax
+  801294:	68 c5 3d 80 00       	push   $0x803dc5
+  801299:	68 a4 00 00 00       	push   $0xa4
+  80129e:	68 9f 3d 80 00       	push   $0x803d9f
+  8012a3:	e8 b0 ee ff ff       	call   800158 <_panic>
+    panic("sys_page_map: %e", r);
+  8012a8:	50                   	push   %eax
+  8012a9:	68 d8 3d 80 00       	push   $0x803dd8
+  8012ae:	68 ac 00 00 00       	push   $0xac
+  8012b3:	68 9f 3d 80 00       	push   $0x803d9f
+  8012b8:	e8 9b ee ff ff       	call   800158 <_panic>
+
+008012bd <fork>:
+{
+  8012bd:	55                   	push   %ebp
+  8012be:	89 e5                	mov    %esp,%ebp
+  8012c0:	53                   	push   %ebx
+  8012c1:	83 ec 04             	sub    $0x4,%esp
+  parent_id = sys_getenvid();
+  8012c4:	e8 06 f9 ff ff       	call   800bcf <sys_getenvid>
+  set_pgfault_handler(pgfault);
+  8012c9:	83 ec 0c             	sub    $0xc,%esp
+  8012cc:	68 ff 10 80 00       	push   $0x8010ff
+  8012d1:	e8 82 22 00 00       	call   803558 <set_pgfault_handler>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+  envid_t ret;
+  __asm __volatile("int %2"
+  8012d6:	b8 07 00 00 00       	mov    $0x7,%eax
+  8012db:	cd 30                	int    $0x30
+  8012dd:	89 c3                	mov    %eax,%ebx
+  if (envid < 0) {
+  8012df:	83 c4 10             	add    $0x10,%esp
+  8012e2:	85 c0                	test   %eax,%eax
+  8012e4:	78 66                	js     80134c <fork+0x8f>
+  } else if (envid == 0) {
+  8012e6:	74 76                	je     80135e <fork+0xa1>
+  if ( (error = sys_page_map_range(0, 0, UXSTACKTOP - PGSIZE,
+  8012e8:	83 ec 0c             	sub    $0xc,%esp
+  8012eb:	6a 01                	push   $0x1
+  8012ed:	50                   	push   %eax
+  8012ee:	68 00 f0 bf ee       	push   $0xeebff000
+  8012f3:	6a 00                	push   $0x0
+  8012f5:	6a 00                	push   $0x0
+  8012f7:	e8 1b fa ff ff       	call   800d17 <sys_page_map_range>
+  8012fc:	83 c4 20             	add    $0x20,%esp
+  8012ff:	85 c0                	test   %eax,%eax
+  801301:	78 77                	js     80137a <fork+0xbd>
+  if ( (error = sys_page_alloc(envid,
+  801303:	83 ec 04             	sub    $0x4,%esp
+  801306:	6a 07                	push   $0x7
+  801308:	68 00 f0 bf ee       	push   $0xeebff000
+  80130d:	53                   	push   %ebx
+  80130e:	e8 3d f9 ff ff       	call   800c50 <sys_page_alloc>
+  801313:	83 c4 10             	add    $0x10,%esp
+  801316:	85 c0                	test   %eax,%eax
+  801318:	78 72                	js     80138c <fork+0xcf>
+          thisenv->env_pgfault_upcall)) < 0) {
+  80131a:	a1 a4 58 80 00       	mov    0x8058a4,%eax
+  80131f:	8b 40 64             	mov    0x64(%eax),%eax
+  if ( (error = sys_env_set_pgfault_upcall(envid,
+  801322:	83 ec 08             	sub    $0x8,%esp
+  801325:	50                   	push   %eax
+  801326:	53                   	push   %ebx
+  801327:	e8 99 fb ff ff       	call   800ec5 <sys_env_set_pgfault_upcall>
+  80132c:	83 c4 10             	add    $0x10,%esp
+  80132f:	85 c0                	test   %eax,%eax
+  801331:	78 6b                	js     80139e <fork+0xe1>
+  if ( (error = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+  801333:	83 ec 08             	sub    $0x8,%esp
+  801336:	6a 02                	push   $0x2
+  801338:	53                   	push   %ebx
+  801339:	e8 03 fb ff ff       	call   800e41 <sys_env_set_status>
+  80133e:	83 c4 10             	add    $0x10,%esp
+  801341:	85 c0                	test   %eax,%eax
+  801343:	78 6b                	js     8013b0 <fork+0xf3>
+}
+  801345:	89 d8                	mov    %ebx,%eax
+  801347:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80134a:	c9                   	leave
+  80134b:	c3                   	ret
+    panic("sys_exofork: %e", envid);
+  80134c:	50                   	push   %eax
+  80134d:	68 fc 3d 80 00       	push   $0x803dfc
+  801352:	6a 5e                	push   $0x5e
+  801354:	68 9f 3d 80 00       	push   $0x803d9f
+  801359:	e8 fa ed ff ff       	call   800158 <_panic>
+    thisenv = &envs[ENVX(sys_getenvid())];
+  80135e:	e8 6c f8 ff ff       	call   800bcf <sys_getenvid>
+  801363:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801368:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80136b:	c1 e0 04             	shl    $0x4,%eax
+  80136e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801373:	a3 a4 58 80 00       	mov    %eax,0x8058a4
+    return 0;
+  801378:	eb cb                	jmp    801345 <fork+0x88>
+    panic("sys_page_map_range: %e", error);
+  80137a:	50                   	push   %eax
+  80137b:	68 0c 3e 80 00       	push   $0x803e0c
+  801380:	6a 69                	push   $0x69
+  801382:	68 9f 3d 80 00       	push   $0x803d9f
+  801387:	e8 cc ed ff ff       	call   800158 <_panic>
+    panic("sys_page_alloc: %e", error);
+  80138c:	50                   	push   %eax
+  80138d:	68 c5 3d 80 00       	push   $0x803dc5
+  801392:	6a 70                	push   $0x70
+  801394:	68 9f 3d 80 00       	push   $0x803d9f
+  801399:	e8 ba ed ff ff       	call   800158 <_panic>
+    panic("sys_env_set_pgfault_upcall: %e", error);
+  80139e:	50                   	push   %eax
+  80139f:	68 3c 3e 80 00       	push   $0x803e3c
+  8013a4:	6a 76                	push   $0x76
+  8013a6:	68 9f 3d 80 00       	push   $0x803d9f
+  8013ab:	e8 a8 ed ff ff       	call   800158 <_panic>
+    panic("sys_env_set_status: %e", error);
+  8013b0:	50                   	push   %eax
+  8013b1:	68 23 3e 80 00       	push   $0x803e23
+  8013b6:	6a 7a                	push   $0x7a
+  8013b8:	68 9f 3d 80 00       	push   $0x803d9f
+  8013bd:	e8 96 ed ff ff       	call   800158 <_panic>
+
+008013c2 <kfork>:
+{
+  8013c2:	55                   	push   %ebp
+  8013c3:	89 e5                	mov    %esp,%ebp
+  8013c5:	53                   	push   %ebx
+  8013c6:	83 ec 10             	sub    $0x10,%esp
+  set_pgfault_handler(pgfault);
+  8013c9:	68 ff 10 80 00       	push   $0x8010ff
+  8013ce:	e8 85 21 00 00       	call   803558 <set_pgfault_handler>
+  if ((envid = sys_fork()) == 0)
+  8013d3:	e8 4a fa ff ff       	call   800e22 <sys_fork>
+  8013d8:	89 c3                	mov    %eax,%ebx
+  8013da:	83 c4 10             	add    $0x10,%esp
+  8013dd:	85 c0                	test   %eax,%eax
+  8013df:	74 07                	je     8013e8 <kfork+0x26>
+}
+  8013e1:	89 d8                	mov    %ebx,%eax
+  8013e3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013e6:	c9                   	leave
+  8013e7:	c3                   	ret
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8013e8:	e8 e2 f7 ff ff       	call   800bcf <sys_getenvid>
+  8013ed:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8013f2:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8013f5:	c1 e0 04             	shl    $0x4,%eax
+  8013f8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8013fd:	a3 a4 58 80 00       	mov    %eax,0x8058a4
+  return envid;
+  801402:	eb dd                	jmp    8013e1 <kfork+0x1f>
+
+00801404 <sfork>:
+
+int
+sfork(void)
+{
+  801404:	55                   	push   %ebp
+  801405:	89 e5                	mov    %esp,%ebp
+  801407:	53                   	push   %ebx
+  801408:	83 ec 04             	sub    $0x4,%esp
+  envid_t envid, parent_id;
+  int error;
+
+  parent_id = sys_getenvid();
+  80140b:	e8 bf f7 ff ff       	call   800bcf <sys_getenvid>
+
+  // set up page fault handler
+  set_pgfault_handler(shared_pgfault);
+  801410:	83 ec 0c             	sub    $0xc,%esp
+  801413:	68 fc 11 80 00       	push   $0x8011fc
+  801418:	e8 3b 21 00 00       	call   803558 <set_pgfault_handler>
+  80141d:	b8 07 00 00 00       	mov    $0x7,%eax
+  801422:	cd 30                	int    $0x30
+  801424:	89 c3                	mov    %eax,%ebx
+
+  // create a child with sys_exofork
+  envid = sys_exofork();
+  
+  if (envid < 0) {
+  801426:	83 c4 10             	add    $0x10,%esp
+  801429:	85 c0                	test   %eax,%eax
+  80142b:	78 09                	js     801436 <sfork+0x32>
+    panic("sys_exofork: %e", envid);
+  } else if (envid == 0) {
+  80142d:	75 1c                	jne    80144b <sfork+0x47>
+  if ( (error = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+    panic("sys_env_set_status: %e", error);
+  }
+
+  return envid;
+}
+  80142f:	89 d8                	mov    %ebx,%eax
+  801431:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801434:	c9                   	leave
+  801435:	c3                   	ret
+    panic("sys_exofork: %e", envid);
+  801436:	50                   	push   %eax
+  801437:	68 fc 3d 80 00       	push   $0x803dfc
+  80143c:	68 c3 00 00 00       	push   $0xc3
+  801441:	68 9f 3d 80 00       	push   $0x803d9f
+  801446:	e8 0d ed ff ff       	call   800158 <_panic>
+  if ( (error = sys_page_map_range(0, 0, USTACKTOP - PGSIZE,
+  80144b:	83 ec 0c             	sub    $0xc,%esp
+  80144e:	6a 00                	push   $0x0
+  801450:	50                   	push   %eax
+  801451:	68 00 d0 bf ee       	push   $0xeebfd000
+  801456:	6a 00                	push   $0x0
+  801458:	6a 00                	push   $0x0
+  80145a:	e8 b8 f8 ff ff       	call   800d17 <sys_page_map_range>
+  80145f:	83 c4 20             	add    $0x20,%esp
+  801462:	85 c0                	test   %eax,%eax
+  801464:	78 79                	js     8014df <sfork+0xdb>
+  if ( (error = sys_page_map_range(0, (void *) (USTACKTOP - PGSIZE), PGSIZE,
+  801466:	83 ec 0c             	sub    $0xc,%esp
+  801469:	6a 01                	push   $0x1
+  80146b:	53                   	push   %ebx
+  80146c:	68 00 10 00 00       	push   $0x1000
+  801471:	68 00 d0 bf ee       	push   $0xeebfd000
+  801476:	6a 00                	push   $0x0
+  801478:	e8 9a f8 ff ff       	call   800d17 <sys_page_map_range>
+  80147d:	83 c4 20             	add    $0x20,%esp
+  801480:	85 c0                	test   %eax,%eax
+  801482:	78 70                	js     8014f4 <sfork+0xf0>
+  if ( (error = sys_page_alloc(envid,
+  801484:	83 ec 04             	sub    $0x4,%esp
+  801487:	6a 07                	push   $0x7
+  801489:	68 00 f0 bf ee       	push   $0xeebff000
+  80148e:	53                   	push   %ebx
+  80148f:	e8 bc f7 ff ff       	call   800c50 <sys_page_alloc>
+  801494:	83 c4 10             	add    $0x10,%esp
+  801497:	85 c0                	test   %eax,%eax
+  801499:	78 6e                	js     801509 <sfork+0x105>
+          thisenv->env_pgfault_upcall)) < 0) {
+  80149b:	a1 a4 58 80 00       	mov    0x8058a4,%eax
+  8014a0:	8b 40 64             	mov    0x64(%eax),%eax
+  if ( (error = sys_env_set_pgfault_upcall(envid,
+  8014a3:	83 ec 08             	sub    $0x8,%esp
+  8014a6:	50                   	push   %eax
+  8014a7:	53                   	push   %ebx
+  8014a8:	e8 18 fa ff ff       	call   800ec5 <sys_env_set_pgfault_upcall>
+  8014ad:	83 c4 10             	add    $0x10,%esp
+  8014b0:	85 c0                	test   %eax,%eax
+  8014b2:	78 6a                	js     80151e <sfork+0x11a>
+  if ( (error = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+  8014b4:	83 ec 08             	sub    $0x8,%esp
+  8014b7:	6a 02                	push   $0x2
+  8014b9:	53                   	push   %ebx
+  8014ba:	e8 82 f9 ff ff       	call   800e41 <sys_env_set_status>
+  8014bf:	83 c4 10             	add    $0x10,%esp
+  8014c2:	85 c0                	test   %eax,%eax
+  8014c4:	0f 89 65 ff ff ff    	jns    80142f <sfork+0x2b>
+    panic("sys_env_set_status: %e", error);
+  8014ca:	50                   	push   %eax
+  8014cb:	68 23 3e 80 00       	push   $0x803e23
+  8014d0:	68 e4 00 00 00       	push   $0xe4
+  8014d5:	68 9f 3d 80 00       	push   $0x803d9f
+  8014da:	e8 79 ec ff ff       	call   800158 <_panic>
+    panic("sys_page_map_range: %e", error);
+  8014df:	50                   	push   %eax
+  8014e0:	68 0c 3e 80 00       	push   $0x803e0c
+  8014e5:	68 ce 00 00 00       	push   $0xce
+  8014ea:	68 9f 3d 80 00       	push   $0x803d9f
+  8014ef:	e8 64 ec ff ff       	call   800158 <_panic>
+    panic("sys_page_map_range: %e", error);
+  8014f4:	50                   	push   %eax
+  8014f5:	68 0c 3e 80 00       	push   $0x803e0c
+  8014fa:	68 d3 00 00 00       	push   $0xd3
+  8014ff:	68 9f 3d 80 00       	push   $0x803d9f
+  801504:	e8 4f ec ff ff       	call   800158 <_panic>
+    panic("sys_page_alloc: %e", error);
+  801509:	50                   	push   %eax
+  80150a:	68 c5 3d 80 00       	push   $0x803dc5
+  80150f:	68 da 00 00 00       	push   $0xda
+  801514:	68 9f 3d 80 00       	push   $0x803d9f
+  801519:	e8 3a ec ff ff       	call   800158 <_panic>
+    panic("sys_env_set_pgfault_upcall: %e", error);
+  80151e:	50                   	push   %eax
+  80151f:	68 3c 3e 80 00       	push   $0x803e3c
+  801524:	68 e0 00 00 00       	push   $0xe0
+  801529:	68 9f 3d 80 00       	push   $0x803d9f
+  80152e:	e8 25 ec ff ff       	call   800158 <_panic>
+
+00801533 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801533:	55                   	push   %ebp
+  801534:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801536:	8b 45 08             	mov    0x8(%ebp),%eax
+  801539:	05 00 00 00 30       	add    $0x30000000,%eax
+  80153e:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801541:	5d                   	pop    %ebp
+  801542:	c3                   	ret
+
+00801543 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801543:	55                   	push   %ebp
+  801544:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801546:	8b 45 08             	mov    0x8(%ebp),%eax
+  801549:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  80154c:	66 b8 00 00          	mov    $0x0,%ax
+  801550:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801555:	5d                   	pop    %ebp
+  801556:	c3                   	ret
+
+00801557 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801557:	55                   	push   %ebp
+  801558:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  80155a:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80155f:	eb 02                	jmp    801563 <fd_alloc+0xc>
+  801561:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801563:	89 c2                	mov    %eax,%edx
+  801565:	c1 ea 16             	shr    $0x16,%edx
+  801568:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80156f:	f6 c2 01             	test   $0x1,%dl
+  801572:	74 2b                	je     80159f <fd_alloc+0x48>
+  801574:	89 c2                	mov    %eax,%edx
+  801576:	c1 ea 0c             	shr    $0xc,%edx
+  801579:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801580:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801586:	f6 c1 01             	test   $0x1,%cl
+  801589:	74 14                	je     80159f <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  80158b:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801591:	75 ce                	jne    801561 <fd_alloc+0xa>
+  801593:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  801598:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80159d:	eb 05                	jmp    8015a4 <fd_alloc+0x4d>
+      return 0;
+  80159f:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  8015a4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015a7:	89 02                	mov    %eax,(%edx)
+}
+  8015a9:	89 c8                	mov    %ecx,%eax
+  8015ab:	5d                   	pop    %ebp
+  8015ac:	c3                   	ret
+
+008015ad <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8015ad:	55                   	push   %ebp
+  8015ae:	89 e5                	mov    %esp,%ebp
+  8015b0:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  8015b3:	83 f8 1f             	cmp    $0x1f,%eax
+  8015b6:	77 30                	ja     8015e8 <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  8015b8:	c1 e0 0c             	shl    $0xc,%eax
+  8015bb:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8015c0:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8015c6:	f6 c2 01             	test   $0x1,%dl
+  8015c9:	74 24                	je     8015ef <fd_lookup+0x42>
+  8015cb:	89 c2                	mov    %eax,%edx
+  8015cd:	c1 ea 0c             	shr    $0xc,%edx
+  8015d0:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8015d7:	f6 c2 01             	test   $0x1,%dl
+  8015da:	74 1a                	je     8015f6 <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  8015dc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8015df:	89 02                	mov    %eax,(%edx)
+  return 0;
+  8015e1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015e6:	5d                   	pop    %ebp
+  8015e7:	c3                   	ret
+    return -E_INVAL;
+  8015e8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015ed:	eb f7                	jmp    8015e6 <fd_lookup+0x39>
+    return -E_INVAL;
+  8015ef:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015f4:	eb f0                	jmp    8015e6 <fd_lookup+0x39>
+  8015f6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8015fb:	eb e9                	jmp    8015e6 <fd_lookup+0x39>
+
+008015fd <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8015fd:	55                   	push   %ebp
+  8015fe:	89 e5                	mov    %esp,%ebp
+  801600:	53                   	push   %ebx
+  801601:	83 ec 04             	sub    $0x4,%esp
+  801604:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  801607:	b8 d8 3e 80 00       	mov    $0x803ed8,%eax
+  80160c:	8b 18                	mov    (%eax),%ebx
+  80160e:	85 db                	test   %ebx,%ebx
+  801610:	74 0e                	je     801620 <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  801612:	83 c0 04             	add    $0x4,%eax
+  801615:	39 13                	cmp    %edx,(%ebx)
+  801617:	75 f3                	jne    80160c <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  801619:	b8 00 00 00 00       	mov    $0x0,%eax
+  80161e:	eb 1f                	jmp    80163f <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801620:	a1 a4 58 80 00       	mov    0x8058a4,%eax
+  801625:	8b 40 48             	mov    0x48(%eax),%eax
+  801628:	83 ec 04             	sub    $0x4,%esp
+  80162b:	52                   	push   %edx
+  80162c:	50                   	push   %eax
+  80162d:	68 5c 3e 80 00       	push   $0x803e5c
+  801632:	e8 fc eb ff ff       	call   800233 <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  801637:	83 c4 10             	add    $0x10,%esp
+  80163a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  80163f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801642:	89 1a                	mov    %ebx,(%edx)
+}
+  801644:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801647:	c9                   	leave
+  801648:	c3                   	ret
+
+00801649 <fd_close>:
+{
+  801649:	55                   	push   %ebp
+  80164a:	89 e5                	mov    %esp,%ebp
+  80164c:	57                   	push   %edi
+  80164d:	56                   	push   %esi
+  80164e:	53                   	push   %ebx
+  80164f:	83 ec 24             	sub    $0x24,%esp
+  801652:	8b 75 08             	mov    0x8(%ebp),%esi
+  801655:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801658:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80165b:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80165c:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801662:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801665:	50                   	push   %eax
+  801666:	e8 42 ff ff ff       	call   8015ad <fd_lookup>
+  80166b:	89 c3                	mov    %eax,%ebx
+  80166d:	83 c4 10             	add    $0x10,%esp
+  801670:	85 c0                	test   %eax,%eax
+  801672:	78 05                	js     801679 <fd_close+0x30>
+      || fd != fd2)
+  801674:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801677:	74 16                	je     80168f <fd_close+0x46>
+    return must_exist ? r : 0;
+  801679:	89 f8                	mov    %edi,%eax
+  80167b:	84 c0                	test   %al,%al
+  80167d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801682:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801685:	89 d8                	mov    %ebx,%eax
+  801687:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80168a:	5b                   	pop    %ebx
+  80168b:	5e                   	pop    %esi
+  80168c:	5f                   	pop    %edi
+  80168d:	5d                   	pop    %ebp
+  80168e:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80168f:	83 ec 08             	sub    $0x8,%esp
+  801692:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801695:	50                   	push   %eax
+  801696:	ff 36                	push   (%esi)
+  801698:	e8 60 ff ff ff       	call   8015fd <dev_lookup>
+  80169d:	89 c3                	mov    %eax,%ebx
+  80169f:	83 c4 10             	add    $0x10,%esp
+  8016a2:	85 c0                	test   %eax,%eax
+  8016a4:	78 1a                	js     8016c0 <fd_close+0x77>
+    if (dev->dev_close)
+  8016a6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8016a9:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  8016ac:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  8016b1:	85 c0                	test   %eax,%eax
+  8016b3:	74 0b                	je     8016c0 <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  8016b5:	83 ec 0c             	sub    $0xc,%esp
+  8016b8:	56                   	push   %esi
+  8016b9:	ff d0                	call   *%eax
+  8016bb:	89 c3                	mov    %eax,%ebx
+  8016bd:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  8016c0:	83 ec 08             	sub    $0x8,%esp
+  8016c3:	56                   	push   %esi
+  8016c4:	6a 00                	push   $0x0
+  8016c6:	e8 0a f6 ff ff       	call   800cd5 <sys_page_unmap>
+  return r;
+  8016cb:	83 c4 10             	add    $0x10,%esp
+  8016ce:	eb b5                	jmp    801685 <fd_close+0x3c>
+
+008016d0 <close>:
+
+int
+close(int fdnum)
+{
+  8016d0:	55                   	push   %ebp
+  8016d1:	89 e5                	mov    %esp,%ebp
+  8016d3:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8016d6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016d9:	50                   	push   %eax
+  8016da:	ff 75 08             	push   0x8(%ebp)
+  8016dd:	e8 cb fe ff ff       	call   8015ad <fd_lookup>
+  8016e2:	83 c4 10             	add    $0x10,%esp
+  8016e5:	85 c0                	test   %eax,%eax
+  8016e7:	79 02                	jns    8016eb <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  8016e9:	c9                   	leave
+  8016ea:	c3                   	ret
+    return fd_close(fd, 1);
+  8016eb:	83 ec 08             	sub    $0x8,%esp
+  8016ee:	6a 01                	push   $0x1
+  8016f0:	ff 75 f4             	push   -0xc(%ebp)
+  8016f3:	e8 51 ff ff ff       	call   801649 <fd_close>
+  8016f8:	83 c4 10             	add    $0x10,%esp
+  8016fb:	eb ec                	jmp    8016e9 <close+0x19>
+
+008016fd <close_all>:
+
+void
+close_all(void)
+{
+  8016fd:	55                   	push   %ebp
+  8016fe:	89 e5                	mov    %esp,%ebp
+  801700:	53                   	push   %ebx
+  801701:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  801704:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  801709:	83 ec 0c             	sub    $0xc,%esp
+  80170c:	53                   	push   %ebx
+  80170d:	e8 be ff ff ff       	call   8016d0 <close>
+  for (i = 0; i < MAXFD; i++)
+  801712:	83 c3 01             	add    $0x1,%ebx
+  801715:	83 c4 10             	add    $0x10,%esp
+  801718:	83 fb 20             	cmp    $0x20,%ebx
+  80171b:	75 ec                	jne    801709 <close_all+0xc>
+}
+  80171d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801720:	c9                   	leave
+  801721:	c3                   	ret
+
+00801722 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801722:	55                   	push   %ebp
+  801723:	89 e5                	mov    %esp,%ebp
+  801725:	57                   	push   %edi
+  801726:	56                   	push   %esi
+  801727:	53                   	push   %ebx
+  801728:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80172b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80172e:	50                   	push   %eax
+  80172f:	ff 75 08             	push   0x8(%ebp)
+  801732:	e8 76 fe ff ff       	call   8015ad <fd_lookup>
+  801737:	89 c6                	mov    %eax,%esi
+  801739:	83 c4 10             	add    $0x10,%esp
+  80173c:	85 c0                	test   %eax,%eax
+  80173e:	0f 88 0a 01 00 00    	js     80184e <dup+0x12c>
+    return r;
+  close(newfdnum);
+  801744:	83 ec 0c             	sub    $0xc,%esp
+  801747:	ff 75 0c             	push   0xc(%ebp)
+  80174a:	e8 81 ff ff ff       	call   8016d0 <close>
+
+  newfd = INDEX2FD(newfdnum);
+  80174f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801752:	c1 e0 0c             	shl    $0xc,%eax
+  801755:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  80175b:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  80175e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801761:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  801764:	89 04 24             	mov    %eax,(%esp)
+  801767:	e8 d7 fd ff ff       	call   801543 <fd2data>
+  80176c:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  80176e:	89 3c 24             	mov    %edi,(%esp)
+  801771:	e8 cd fd ff ff       	call   801543 <fd2data>
+  801776:	83 c4 10             	add    $0x10,%esp
+  801779:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80177c:	89 f3                	mov    %esi,%ebx
+  80177e:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  801784:	89 c6                	mov    %eax,%esi
+  801786:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801789:	89 cf                	mov    %ecx,%edi
+  80178b:	eb 0c                	jmp    801799 <dup+0x77>
+  80178d:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801793:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801799:	39 fb                	cmp    %edi,%ebx
+  80179b:	74 7b                	je     801818 <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  80179d:	89 d8                	mov    %ebx,%eax
+  80179f:	c1 e8 16             	shr    $0x16,%eax
+  8017a2:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8017a9:	a8 01                	test   $0x1,%al
+  8017ab:	74 e0                	je     80178d <dup+0x6b>
+  8017ad:	89 d8                	mov    %ebx,%eax
+  8017af:	c1 e8 0c             	shr    $0xc,%eax
+  8017b2:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8017b9:	f6 c2 01             	test   $0x1,%dl
+  8017bc:	74 cf                	je     80178d <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  8017be:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  8017c5:	83 ec 0c             	sub    $0xc,%esp
+  8017c8:	25 07 0e 00 00       	and    $0xe07,%eax
+  8017cd:	50                   	push   %eax
+  8017ce:	56                   	push   %esi
+  8017cf:	6a 00                	push   $0x0
+  8017d1:	53                   	push   %ebx
+  8017d2:	6a 00                	push   $0x0
+  8017d4:	e8 ba f4 ff ff       	call   800c93 <sys_page_map>
+  8017d9:	83 c4 20             	add    $0x20,%esp
+  8017dc:	85 c0                	test   %eax,%eax
+  8017de:	79 ad                	jns    80178d <dup+0x6b>
+  8017e0:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8017e3:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  8017e5:	83 ec 08             	sub    $0x8,%esp
+  8017e8:	ff 75 d4             	push   -0x2c(%ebp)
+  8017eb:	6a 00                	push   $0x0
+  8017ed:	e8 e3 f4 ff ff       	call   800cd5 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8017f2:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  8017f5:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  8017fb:	83 c4 10             	add    $0x10,%esp
+  8017fe:	39 df                	cmp    %ebx,%edi
+  801800:	74 4c                	je     80184e <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  801802:	83 ec 08             	sub    $0x8,%esp
+  801805:	57                   	push   %edi
+  801806:	6a 00                	push   $0x0
+  801808:	e8 c8 f4 ff ff       	call   800cd5 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80180d:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  801813:	83 c4 10             	add    $0x10,%esp
+  801816:	eb e6                	jmp    8017fe <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801818:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80181b:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80181e:	89 c8                	mov    %ecx,%eax
+  801820:	c1 e8 0c             	shr    $0xc,%eax
+  801823:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80182a:	83 ec 0c             	sub    $0xc,%esp
+  80182d:	25 07 0e 00 00       	and    $0xe07,%eax
+  801832:	50                   	push   %eax
+  801833:	ff 75 d4             	push   -0x2c(%ebp)
+  801836:	6a 00                	push   $0x0
+  801838:	51                   	push   %ecx
+  801839:	6a 00                	push   $0x0
+  80183b:	e8 53 f4 ff ff       	call   800c93 <sys_page_map>
+  801840:	89 c6                	mov    %eax,%esi
+  801842:	83 c4 20             	add    $0x20,%esp
+  801845:	85 c0                	test   %eax,%eax
+  801847:	78 9c                	js     8017e5 <dup+0xc3>
+  return newfdnum;
+  801849:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80184c:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  80184e:	89 f0                	mov    %esi,%eax
+  801850:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801853:	5b                   	pop    %ebx
+  801854:	5e                   	pop    %esi
+  801855:	5f                   	pop    %edi
+  801856:	5d                   	pop    %ebp
+  801857:	c3                   	ret
+
+00801858 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801858:	55                   	push   %ebp
+  801859:	89 e5                	mov    %esp,%ebp
+  80185b:	56                   	push   %esi
+  80185c:	53                   	push   %ebx
+  80185d:	83 ec 18             	sub    $0x18,%esp
+  801860:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801863:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801866:	50                   	push   %eax
+  801867:	56                   	push   %esi
+  801868:	e8 40 fd ff ff       	call   8015ad <fd_lookup>
+  80186d:	83 c4 10             	add    $0x10,%esp
+  801870:	85 c0                	test   %eax,%eax
+  801872:	78 3c                	js     8018b0 <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801874:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801877:	83 ec 08             	sub    $0x8,%esp
+  80187a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80187d:	50                   	push   %eax
+  80187e:	ff 33                	push   (%ebx)
+  801880:	e8 78 fd ff ff       	call   8015fd <dev_lookup>
+  801885:	83 c4 10             	add    $0x10,%esp
+  801888:	85 c0                	test   %eax,%eax
+  80188a:	78 24                	js     8018b0 <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80188c:	8b 43 08             	mov    0x8(%ebx),%eax
+  80188f:	83 e0 03             	and    $0x3,%eax
+  801892:	83 f8 01             	cmp    $0x1,%eax
+  801895:	74 20                	je     8018b7 <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  801897:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80189a:	8b 40 08             	mov    0x8(%eax),%eax
+  80189d:	85 c0                	test   %eax,%eax
+  80189f:	74 37                	je     8018d8 <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  8018a1:	83 ec 04             	sub    $0x4,%esp
+  8018a4:	ff 75 10             	push   0x10(%ebp)
+  8018a7:	ff 75 0c             	push   0xc(%ebp)
+  8018aa:	53                   	push   %ebx
+  8018ab:	ff d0                	call   *%eax
+  8018ad:	83 c4 10             	add    $0x10,%esp
+}
+  8018b0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018b3:	5b                   	pop    %ebx
+  8018b4:	5e                   	pop    %esi
+  8018b5:	5d                   	pop    %ebp
+  8018b6:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8018b7:	a1 a4 58 80 00       	mov    0x8058a4,%eax
+  8018bc:	8b 40 48             	mov    0x48(%eax),%eax
+  8018bf:	83 ec 04             	sub    $0x4,%esp
+  8018c2:	56                   	push   %esi
+  8018c3:	50                   	push   %eax
+  8018c4:	68 9d 3e 80 00       	push   $0x803e9d
+  8018c9:	e8 65 e9 ff ff       	call   800233 <cprintf>
+    return -E_INVAL;
+  8018ce:	83 c4 10             	add    $0x10,%esp
+  8018d1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018d6:	eb d8                	jmp    8018b0 <read+0x58>
+    return -E_NOT_SUPP;
+  8018d8:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8018dd:	eb d1                	jmp    8018b0 <read+0x58>
+
+008018df <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8018df:	55                   	push   %ebp
+  8018e0:	89 e5                	mov    %esp,%ebp
+  8018e2:	57                   	push   %edi
+  8018e3:	56                   	push   %esi
+  8018e4:	53                   	push   %ebx
+  8018e5:	83 ec 0c             	sub    $0xc,%esp
+  8018e8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8018eb:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  8018ee:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018f3:	eb 02                	jmp    8018f7 <readn+0x18>
+  8018f5:	01 c3                	add    %eax,%ebx
+  8018f7:	39 f3                	cmp    %esi,%ebx
+  8018f9:	73 21                	jae    80191c <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  8018fb:	83 ec 04             	sub    $0x4,%esp
+  8018fe:	89 f0                	mov    %esi,%eax
+  801900:	29 d8                	sub    %ebx,%eax
+  801902:	50                   	push   %eax
+  801903:	89 d8                	mov    %ebx,%eax
+  801905:	03 45 0c             	add    0xc(%ebp),%eax
+  801908:	50                   	push   %eax
+  801909:	57                   	push   %edi
+  80190a:	e8 49 ff ff ff       	call   801858 <read>
+    if (m < 0)
+  80190f:	83 c4 10             	add    $0x10,%esp
+  801912:	85 c0                	test   %eax,%eax
+  801914:	78 04                	js     80191a <readn+0x3b>
+      return m;
+    if (m == 0)
+  801916:	75 dd                	jne    8018f5 <readn+0x16>
+  801918:	eb 02                	jmp    80191c <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  80191a:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  80191c:	89 d8                	mov    %ebx,%eax
+  80191e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801921:	5b                   	pop    %ebx
+  801922:	5e                   	pop    %esi
+  801923:	5f                   	pop    %edi
+  801924:	5d                   	pop    %ebp
+  801925:	c3                   	ret
+
+00801926 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801926:	55                   	push   %ebp
+  801927:	89 e5                	mov    %esp,%ebp
+  801929:	56                   	push   %esi
+  80192a:	53                   	push   %ebx
+  80192b:	83 ec 18             	sub    $0x18,%esp
+  80192e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801931:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801934:	50                   	push   %eax
+  801935:	53                   	push   %ebx
+  801936:	e8 72 fc ff ff       	call   8015ad <fd_lookup>
+  80193b:	83 c4 10             	add    $0x10,%esp
+  80193e:	85 c0                	test   %eax,%eax
+  801940:	78 37                	js     801979 <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801942:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801945:	83 ec 08             	sub    $0x8,%esp
+  801948:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80194b:	50                   	push   %eax
+  80194c:	ff 36                	push   (%esi)
+  80194e:	e8 aa fc ff ff       	call   8015fd <dev_lookup>
+  801953:	83 c4 10             	add    $0x10,%esp
+  801956:	85 c0                	test   %eax,%eax
+  801958:	78 1f                	js     801979 <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80195a:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80195e:	74 20                	je     801980 <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  801960:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801963:	8b 40 0c             	mov    0xc(%eax),%eax
+  801966:	85 c0                	test   %eax,%eax
+  801968:	74 37                	je     8019a1 <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  80196a:	83 ec 04             	sub    $0x4,%esp
+  80196d:	ff 75 10             	push   0x10(%ebp)
+  801970:	ff 75 0c             	push   0xc(%ebp)
+  801973:	56                   	push   %esi
+  801974:	ff d0                	call   *%eax
+  801976:	83 c4 10             	add    $0x10,%esp
+}
+  801979:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80197c:	5b                   	pop    %ebx
+  80197d:	5e                   	pop    %esi
+  80197e:	5d                   	pop    %ebp
+  80197f:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801980:	a1 a4 58 80 00       	mov    0x8058a4,%eax
+  801985:	8b 40 48             	mov    0x48(%eax),%eax
+  801988:	83 ec 04             	sub    $0x4,%esp
+  80198b:	53                   	push   %ebx
+  80198c:	50                   	push   %eax
+  80198d:	68 b9 3e 80 00       	push   $0x803eb9
+  801992:	e8 9c e8 ff ff       	call   800233 <cprintf>
+    return -E_INVAL;
+  801997:	83 c4 10             	add    $0x10,%esp
+  80199a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80199f:	eb d8                	jmp    801979 <write+0x53>
+    return -E_NOT_SUPP;
+  8019a1:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8019a6:	eb d1                	jmp    801979 <write+0x53>
+
+008019a8 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8019a8:	55                   	push   %ebp
+  8019a9:	89 e5                	mov    %esp,%ebp
+  8019ab:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8019ae:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019b1:	50                   	push   %eax
+  8019b2:	ff 75 08             	push   0x8(%ebp)
+  8019b5:	e8 f3 fb ff ff       	call   8015ad <fd_lookup>
+  8019ba:	83 c4 10             	add    $0x10,%esp
+  8019bd:	85 c0                	test   %eax,%eax
+  8019bf:	78 0e                	js     8019cf <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  8019c1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8019c4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8019c7:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  8019ca:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019cf:	c9                   	leave
+  8019d0:	c3                   	ret
+
+008019d1 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8019d1:	55                   	push   %ebp
+  8019d2:	89 e5                	mov    %esp,%ebp
+  8019d4:	56                   	push   %esi
+  8019d5:	53                   	push   %ebx
+  8019d6:	83 ec 18             	sub    $0x18,%esp
+  8019d9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  8019dc:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8019df:	50                   	push   %eax
+  8019e0:	53                   	push   %ebx
+  8019e1:	e8 c7 fb ff ff       	call   8015ad <fd_lookup>
+  8019e6:	83 c4 10             	add    $0x10,%esp
+  8019e9:	85 c0                	test   %eax,%eax
+  8019eb:	78 34                	js     801a21 <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8019ed:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8019f0:	83 ec 08             	sub    $0x8,%esp
+  8019f3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8019f6:	50                   	push   %eax
+  8019f7:	ff 36                	push   (%esi)
+  8019f9:	e8 ff fb ff ff       	call   8015fd <dev_lookup>
+  8019fe:	83 c4 10             	add    $0x10,%esp
+  801a01:	85 c0                	test   %eax,%eax
+  801a03:	78 1c                	js     801a21 <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801a05:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801a09:	74 1d                	je     801a28 <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  801a0b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a0e:	8b 40 18             	mov    0x18(%eax),%eax
+  801a11:	85 c0                	test   %eax,%eax
+  801a13:	74 34                	je     801a49 <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  801a15:	83 ec 08             	sub    $0x8,%esp
+  801a18:	ff 75 0c             	push   0xc(%ebp)
+  801a1b:	56                   	push   %esi
+  801a1c:	ff d0                	call   *%eax
+  801a1e:	83 c4 10             	add    $0x10,%esp
+}
+  801a21:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a24:	5b                   	pop    %ebx
+  801a25:	5e                   	pop    %esi
+  801a26:	5d                   	pop    %ebp
+  801a27:	c3                   	ret
+            thisenv->env_id, fdnum);
+  801a28:	a1 a4 58 80 00       	mov    0x8058a4,%eax
+  801a2d:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801a30:	83 ec 04             	sub    $0x4,%esp
+  801a33:	53                   	push   %ebx
+  801a34:	50                   	push   %eax
+  801a35:	68 7c 3e 80 00       	push   $0x803e7c
+  801a3a:	e8 f4 e7 ff ff       	call   800233 <cprintf>
+    return -E_INVAL;
+  801a3f:	83 c4 10             	add    $0x10,%esp
+  801a42:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a47:	eb d8                	jmp    801a21 <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  801a49:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a4e:	eb d1                	jmp    801a21 <ftruncate+0x50>
+
+00801a50 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801a50:	55                   	push   %ebp
+  801a51:	89 e5                	mov    %esp,%ebp
+  801a53:	56                   	push   %esi
+  801a54:	53                   	push   %ebx
+  801a55:	83 ec 18             	sub    $0x18,%esp
+  801a58:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a5b:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a5e:	50                   	push   %eax
+  801a5f:	ff 75 08             	push   0x8(%ebp)
+  801a62:	e8 46 fb ff ff       	call   8015ad <fd_lookup>
+  801a67:	83 c4 10             	add    $0x10,%esp
+  801a6a:	85 c0                	test   %eax,%eax
+  801a6c:	78 49                	js     801ab7 <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801a6e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801a71:	83 ec 08             	sub    $0x8,%esp
+  801a74:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a77:	50                   	push   %eax
+  801a78:	ff 36                	push   (%esi)
+  801a7a:	e8 7e fb ff ff       	call   8015fd <dev_lookup>
+  801a7f:	83 c4 10             	add    $0x10,%esp
+  801a82:	85 c0                	test   %eax,%eax
+  801a84:	78 31                	js     801ab7 <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  801a86:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a89:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801a8d:	74 2f                	je     801abe <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  801a8f:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  801a92:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801a99:	00 00 00 
+  stat->st_isdir = 0;
+  801a9c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801aa3:	00 00 00 
+  stat->st_dev = dev;
+  801aa6:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  801aac:	83 ec 08             	sub    $0x8,%esp
+  801aaf:	53                   	push   %ebx
+  801ab0:	56                   	push   %esi
+  801ab1:	ff 50 14             	call   *0x14(%eax)
+  801ab4:	83 c4 10             	add    $0x10,%esp
+}
+  801ab7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801aba:	5b                   	pop    %ebx
+  801abb:	5e                   	pop    %esi
+  801abc:	5d                   	pop    %ebp
+  801abd:	c3                   	ret
+    return -E_NOT_SUPP;
+  801abe:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ac3:	eb f2                	jmp    801ab7 <fstat+0x67>
+
+00801ac5 <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  801ac5:	55                   	push   %ebp
+  801ac6:	89 e5                	mov    %esp,%ebp
+  801ac8:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  801acb:	ff 75 0c             	push   0xc(%ebp)
+  801ace:	ff 75 08             	push   0x8(%ebp)
+  801ad1:	e8 58 07 00 00       	call   80222e <file_stat>
+}
+  801ad6:	c9                   	leave
+  801ad7:	c3                   	ret
+
+00801ad8 <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  801ad8:	55                   	push   %ebp
+  801ad9:	89 e5                	mov    %esp,%ebp
+  801adb:	57                   	push   %edi
+  801adc:	56                   	push   %esi
+  801add:	53                   	push   %ebx
+  801ade:	83 ec 1c             	sub    $0x1c,%esp
+  801ae1:	89 c7                	mov    %eax,%edi
+  801ae3:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801ae6:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801ae9:	e9 a2 00 00 00       	jmp    801b90 <fsipc_send+0xb8>
+  nfsenvs = 0;
+  801aee:	c7 05 00 50 80 00 00 	movl   $0x0,0x805000
+  801af5:	00 00 00 
+  801af8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801afd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801b02:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801b07:	be 01 00 00 00       	mov    $0x1,%esi
+  801b0c:	eb 0f                	jmp    801b1d <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801b0e:	83 c0 01             	add    $0x1,%eax
+  801b11:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801b16:	74 49                	je     801b61 <fsipc_send+0x89>
+  801b18:	83 f9 07             	cmp    $0x7,%ecx
+  801b1b:	7f 50                	jg     801b6d <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  801b1d:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801b20:	c1 e2 04             	shl    $0x4,%edx
+  801b23:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801b29:	8b 52 50             	mov    0x50(%edx),%edx
+  801b2c:	83 fa 01             	cmp    $0x1,%edx
+  801b2f:	75 dd                	jne    801b0e <fsipc_send+0x36>
+  801b31:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801b34:	c1 e2 04             	shl    $0x4,%edx
+  801b37:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801b3d:	8b 52 54             	mov    0x54(%edx),%edx
+  801b40:	85 d2                	test   %edx,%edx
+  801b42:	74 ca                	je     801b0e <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801b44:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801b47:	c1 e2 04             	shl    $0x4,%edx
+  801b4a:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801b50:	8b 52 48             	mov    0x48(%edx),%edx
+  801b53:	89 14 8d 20 50 80 00 	mov    %edx,0x805020(,%ecx,4)
+  801b5a:	8d 49 01             	lea    0x1(%ecx),%ecx
+  801b5d:	89 f3                	mov    %esi,%ebx
+  801b5f:	eb ad                	jmp    801b0e <fsipc_send+0x36>
+  801b61:	84 db                	test   %bl,%bl
+  801b63:	74 38                	je     801b9d <fsipc_send+0xc5>
+  801b65:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  801b6b:	eb 30                	jmp    801b9d <fsipc_send+0xc5>
+  801b6d:	84 db                	test   %bl,%bl
+  801b6f:	74 2c                	je     801b9d <fsipc_send+0xc5>
+  801b71:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  801b77:	eb 24                	jmp    801b9d <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  801b79:	50                   	push   %eax
+  801b7a:	68 e8 3e 80 00       	push   $0x803ee8
+  801b7f:	6a 34                	push   $0x34
+  801b81:	68 f2 3e 80 00       	push   $0x803ef2
+  801b86:	e8 cd e5 ff ff       	call   800158 <_panic>
+    }
+    sys_yield();
+  801b8b:	e8 5e f0 ff ff       	call   800bee <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  801b90:	83 3d 00 50 80 00 03 	cmpl   $0x3,0x805000
+  801b97:	0f 8e 51 ff ff ff    	jle    801aee <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  801b9d:	a1 a4 58 80 00       	mov    0x8058a4,%eax
+  801ba2:	8b 70 48             	mov    0x48(%eax),%esi
+  801ba5:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  801bab:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bb0:	8b 0d 00 50 80 00    	mov    0x805000,%ecx
+  801bb6:	39 d9                	cmp    %ebx,%ecx
+  801bb8:	7e d1                	jle    801b8b <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  801bba:	83 ec 0c             	sub    $0xc,%esp
+  801bbd:	ff 75 e0             	push   -0x20(%ebp)
+  801bc0:	6a 07                	push   $0x7
+  801bc2:	ff 75 e4             	push   -0x1c(%ebp)
+  801bc5:	57                   	push   %edi
+  801bc6:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  801bc9:	99                   	cltd
+  801bca:	f7 f9                	idiv   %ecx
+  801bcc:	ff 34 95 20 50 80 00 	push   0x805020(,%edx,4)
+  801bd3:	e8 2f f3 ff ff       	call   800f07 <sys_ipc_try_send>
+      if (r == 0)
+  801bd8:	83 c4 20             	add    $0x20,%esp
+  801bdb:	85 c0                	test   %eax,%eax
+  801bdd:	74 0a                	je     801be9 <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  801bdf:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801be2:	75 95                	jne    801b79 <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  801be4:	83 c3 01             	add    $0x1,%ebx
+  801be7:	eb c7                	jmp    801bb0 <fsipc_send+0xd8>
+  }
+}
+  801be9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bec:	5b                   	pop    %ebx
+  801bed:	5e                   	pop    %esi
+  801bee:	5f                   	pop    %edi
+  801bef:	5d                   	pop    %ebp
+  801bf0:	c3                   	ret
+
+00801bf1 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801bf1:	55                   	push   %ebp
+  801bf2:	89 e5                	mov    %esp,%ebp
+  801bf4:	53                   	push   %ebx
+  801bf5:	83 ec 14             	sub    $0x14,%esp
+  801bf8:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  801bfa:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  801c01:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801c06:	ba 00 60 80 00       	mov    $0x806000,%edx
+  801c0b:	e8 c8 fe ff ff       	call   801ad8 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801c10:	6a 00                	push   $0x0
+  801c12:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c15:	50                   	push   %eax
+  801c16:	53                   	push   %ebx
+  801c17:	6a 00                	push   $0x0
+  801c19:	e8 a7 19 00 00       	call   8035c5 <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  801c1e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801c21:	c9                   	leave
+  801c22:	c3                   	ret
+
+00801c23 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801c23:	55                   	push   %ebp
+  801c24:	89 e5                	mov    %esp,%ebp
+  801c26:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801c29:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c2c:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c2f:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.set_size.req_size = newsize;
+  801c34:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c37:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801c3c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c41:	b8 02 00 00 00       	mov    $0x2,%eax
+  801c46:	e8 a6 ff ff ff       	call   801bf1 <fsipc>
+}
+  801c4b:	c9                   	leave
+  801c4c:	c3                   	ret
+
+00801c4d <devfile_flush>:
+{
+  801c4d:	55                   	push   %ebp
+  801c4e:	89 e5                	mov    %esp,%ebp
+  801c50:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801c53:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c56:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c59:	a3 00 60 80 00       	mov    %eax,0x806000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801c5e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c63:	b8 06 00 00 00       	mov    $0x6,%eax
+  801c68:	e8 84 ff ff ff       	call   801bf1 <fsipc>
+}
+  801c6d:	c9                   	leave
+  801c6e:	c3                   	ret
+
+00801c6f <devfile_stat>:
+{
+  801c6f:	55                   	push   %ebp
+  801c70:	89 e5                	mov    %esp,%ebp
+  801c72:	53                   	push   %ebx
+  801c73:	83 ec 04             	sub    $0x4,%esp
+  801c76:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801c79:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c7c:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c7f:	a3 00 60 80 00       	mov    %eax,0x806000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801c84:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c89:	b8 05 00 00 00       	mov    $0x5,%eax
+  801c8e:	e8 5e ff ff ff       	call   801bf1 <fsipc>
+  801c93:	85 c0                	test   %eax,%eax
+  801c95:	78 2c                	js     801cc3 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801c97:	83 ec 08             	sub    $0x8,%esp
+  801c9a:	68 00 60 80 00       	push   $0x806000
+  801c9f:	53                   	push   %ebx
+  801ca0:	e8 7c eb ff ff       	call   800821 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  801ca5:	a1 80 60 80 00       	mov    0x806080,%eax
+  801caa:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801cb0:	a1 84 60 80 00       	mov    0x806084,%eax
+  801cb5:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801cbb:	83 c4 10             	add    $0x10,%esp
+  801cbe:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801cc3:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801cc6:	c9                   	leave
+  801cc7:	c3                   	ret
+
+00801cc8 <fsv_alloc>:
+{
+  801cc8:	55                   	push   %ebp
+  801cc9:	89 e5                	mov    %esp,%ebp
+  801ccb:	56                   	push   %esi
+  801ccc:	53                   	push   %ebx
+  801ccd:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  801ccf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cd4:	eb 22                	jmp    801cf8 <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  801cd6:	83 ec 04             	sub    $0x4,%esp
+  801cd9:	6a 00                	push   $0x0
+  801cdb:	6a 00                	push   $0x0
+  801cdd:	6a 07                	push   $0x7
+  801cdf:	50                   	push   %eax
+  801ce0:	6a 00                	push   $0x0
+  801ce2:	6a 04                	push   $0x4
+  801ce4:	68 40 50 80 00       	push   $0x805040
+  801ce9:	e8 b5 f3 ff ff       	call   8010a3 <sysbatch_add>
+  801cee:	83 c4 20             	add    $0x20,%esp
+  801cf1:	85 c0                	test   %eax,%eax
+  801cf3:	78 48                	js     801d3d <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  801cf5:	83 c3 01             	add    $0x1,%ebx
+  801cf8:	39 f3                	cmp    %esi,%ebx
+  801cfa:	74 31                	je     801d2d <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  801cfc:	89 d8                	mov    %ebx,%eax
+  801cfe:	c1 e0 0c             	shl    $0xc,%eax
+  801d01:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801d06:	89 c2                	mov    %eax,%edx
+  801d08:	c1 ea 16             	shr    $0x16,%edx
+  801d0b:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801d12:	f6 c2 01             	test   $0x1,%dl
+  801d15:	74 bf                	je     801cd6 <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  801d17:	89 c2                	mov    %eax,%edx
+  801d19:	c1 ea 0c             	shr    $0xc,%edx
+  801d1c:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801d23:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801d26:	83 fa 03             	cmp    $0x3,%edx
+  801d29:	75 ab                	jne    801cd6 <fsv_alloc+0xe>
+  801d2b:	eb c8                	jmp    801cf5 <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  801d2d:	83 ec 0c             	sub    $0xc,%esp
+  801d30:	68 40 50 80 00       	push   $0x805040
+  801d35:	e8 19 f3 ff ff       	call   801053 <sysbatch_flush>
+  801d3a:	83 c4 10             	add    $0x10,%esp
+}
+  801d3d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d40:	5b                   	pop    %ebx
+  801d41:	5e                   	pop    %esi
+  801d42:	5d                   	pop    %ebp
+  801d43:	c3                   	ret
+
+00801d44 <devfile_read>:
+{
+  801d44:	55                   	push   %ebp
+  801d45:	89 e5                	mov    %esp,%ebp
+  801d47:	57                   	push   %edi
+  801d48:	56                   	push   %esi
+  801d49:	53                   	push   %ebx
+  801d4a:	83 ec 3c             	sub    $0x3c,%esp
+  801d4d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  801d50:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  801d56:	77 57                	ja     801daf <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801d58:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d5b:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d5e:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read.req_n = n;
+  801d63:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801d69:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d6e:	b8 03 00 00 00       	mov    $0x3,%eax
+  801d73:	e8 79 fe ff ff       	call   801bf1 <fsipc>
+  801d78:	89 c6                	mov    %eax,%esi
+  801d7a:	85 c0                	test   %eax,%eax
+  801d7c:	78 27                	js     801da5 <devfile_read+0x61>
+  assert(r <= n);
+  801d7e:	39 c3                	cmp    %eax,%ebx
+  801d80:	0f 82 0e 02 00 00    	jb     801f94 <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  801d86:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801d8b:	0f 8f 1c 02 00 00    	jg     801fad <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801d91:	83 ec 04             	sub    $0x4,%esp
+  801d94:	50                   	push   %eax
+  801d95:	68 00 60 80 00       	push   $0x806000
+  801d9a:	ff 75 0c             	push   0xc(%ebp)
+  801d9d:	e8 05 ec ff ff       	call   8009a7 <memmove>
+  return r;
+  801da2:	83 c4 10             	add    $0x10,%esp
+}
+  801da5:	89 f0                	mov    %esi,%eax
+  801da7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801daa:	5b                   	pop    %ebx
+  801dab:	5e                   	pop    %esi
+  801dac:	5f                   	pop    %edi
+  801dad:	5d                   	pop    %ebp
+  801dae:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  801daf:	b8 01 00 00 00       	mov    $0x1,%eax
+  801db4:	e8 0f ff ff ff       	call   801cc8 <fsv_alloc>
+  801db9:	89 c6                	mov    %eax,%esi
+  801dbb:	85 c0                	test   %eax,%eax
+  801dbd:	78 e6                	js     801da5 <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  801dbf:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dc2:	8b 40 0c             	mov    0xc(%eax),%eax
+  801dc5:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  801dca:	8b 45 08             	mov    0x8(%ebp),%eax
+  801dcd:	8b 40 04             	mov    0x4(%eax),%eax
+  801dd0:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  801dd5:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  801ddb:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801de2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801de7:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801dec:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801df1:	e8 e2 fc ff ff       	call   801ad8 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801df6:	6a 00                	push   $0x0
+  801df8:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801dfb:	50                   	push   %eax
+  801dfc:	68 00 10 c0 9f       	push   $0x9fc01000
+  801e01:	6a 00                	push   $0x0
+  801e03:	e8 bd 17 00 00       	call   8035c5 <ipc_recv_pages>
+  801e08:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  801e0a:	83 c4 10             	add    $0x10,%esp
+  801e0d:	85 c0                	test   %eax,%eax
+  801e0f:	7e 94                	jle    801da5 <devfile_read+0x61>
+  assert(r <= n);
+  801e11:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801e14:	39 c3                	cmp    %eax,%ebx
+  801e16:	72 2e                	jb     801e46 <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801e18:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e1b:	8b 40 04             	mov    0x4(%eax),%eax
+  801e1e:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801e23:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  801e26:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801e29:	c1 e2 0c             	shl    $0xc,%edx
+  801e2c:	39 ca                	cmp    %ecx,%edx
+  801e2e:	72 2f                	jb     801e5f <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  801e30:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  801e35:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  801e38:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  801e3c:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801e41:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  801e44:	eb 52                	jmp    801e98 <devfile_read+0x154>
+  assert(r <= n);
+  801e46:	68 fd 3e 80 00       	push   $0x803efd
+  801e4b:	68 04 3f 80 00       	push   $0x803f04
+  801e50:	68 49 01 00 00       	push   $0x149
+  801e55:	68 f2 3e 80 00       	push   $0x803ef2
+  801e5a:	e8 f9 e2 ff ff       	call   800158 <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801e5f:	68 28 3f 80 00       	push   $0x803f28
+  801e64:	68 04 3f 80 00       	push   $0x803f04
+  801e69:	68 4a 01 00 00       	push   $0x14a
+  801e6e:	68 f2 3e 80 00       	push   $0x803ef2
+  801e73:	e8 e0 e2 ff ff       	call   800158 <_panic>
+      memmove(dst + done, src + done, m);
+  801e78:	83 ec 04             	sub    $0x4,%esp
+  801e7b:	53                   	push   %ebx
+  801e7c:	56                   	push   %esi
+  801e7d:	89 f8                	mov    %edi,%eax
+  801e7f:	03 45 0c             	add    0xc(%ebp),%eax
+  801e82:	50                   	push   %eax
+  801e83:	e8 1f eb ff ff       	call   8009a7 <memmove>
+  801e88:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  801e8b:	01 df                	add    %ebx,%edi
+  801e8d:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801e90:	39 c7                	cmp    %eax,%edi
+  801e92:	0f 83 c0 00 00 00    	jae    801f58 <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801e98:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801e9b:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  801e9e:	89 f0                	mov    %esi,%eax
+  801ea0:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801ea5:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  801eaa:	29 c3                	sub    %eax,%ebx
+  801eac:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801eaf:	29 f8                	sub    %edi,%eax
+  801eb1:	39 c3                	cmp    %eax,%ebx
+  801eb3:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  801eb6:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801ebc:	75 ba                	jne    801e78 <devfile_read+0x134>
+  801ebe:	89 f9                	mov    %edi,%ecx
+  801ec0:	03 4d 0c             	add    0xc(%ebp),%ecx
+  801ec3:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  801ec6:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  801ecc:	75 aa                	jne    801e78 <devfile_read+0x134>
+  801ece:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  801ed4:	77 a2                	ja     801e78 <devfile_read+0x134>
+  801ed6:	89 c8                	mov    %ecx,%eax
+  801ed8:	c1 e8 16             	shr    $0x16,%eax
+  801edb:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801ee2:	a8 01                	test   $0x1,%al
+  801ee4:	74 92                	je     801e78 <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  801ee6:	89 c8                	mov    %ecx,%eax
+  801ee8:	c1 e8 0c             	shr    $0xc,%eax
+  801eeb:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  801ef2:	a8 01                	test   $0x1,%al
+  801ef4:	74 82                	je     801e78 <devfile_read+0x134>
+  801ef6:	a9 02 08 00 00       	test   $0x802,%eax
+  801efb:	0f 84 77 ff ff ff    	je     801e78 <devfile_read+0x134>
+  801f01:	f6 c4 04             	test   $0x4,%ah
+  801f04:	0f 85 6e ff ff ff    	jne    801e78 <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  801f0a:	a1 a4 58 80 00       	mov    0x8058a4,%eax
+  801f0f:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  801f13:	84 c0                	test   %al,%al
+  801f15:	75 17                	jne    801f2e <devfile_read+0x1ea>
+  801f17:	83 ec 08             	sub    $0x8,%esp
+  801f1a:	6a 01                	push   $0x1
+  801f1c:	6a 00                	push   $0x0
+  801f1e:	e8 ea ec ff ff       	call   800c0d <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  801f23:	83 c4 10             	add    $0x10,%esp
+  801f26:	85 c0                	test   %eax,%eax
+  801f28:	0f 85 4a ff ff ff    	jne    801e78 <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  801f2e:	83 ec 04             	sub    $0x4,%esp
+  801f31:	68 05 08 00 00       	push   $0x805
+  801f36:	ff 75 cc             	push   -0x34(%ebp)
+  801f39:	6a 00                	push   $0x0
+  801f3b:	56                   	push   %esi
+  801f3c:	6a 00                	push   $0x0
+  801f3e:	6a 05                	push   $0x5
+  801f40:	68 40 50 80 00       	push   $0x805040
+  801f45:	e8 59 f1 ff ff       	call   8010a3 <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  801f4a:	c1 e8 1f             	shr    $0x1f,%eax
+  801f4d:	08 45 cb             	or     %al,-0x35(%ebp)
+  801f50:	83 c4 20             	add    $0x20,%esp
+  801f53:	e9 33 ff ff ff       	jmp    801e8b <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  801f58:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  801f5b:	83 ec 0c             	sub    $0xc,%esp
+  801f5e:	68 40 50 80 00       	push   $0x805040
+  801f63:	e8 eb f0 ff ff       	call   801053 <sysbatch_flush>
+  801f68:	83 c4 10             	add    $0x10,%esp
+  801f6b:	85 c0                	test   %eax,%eax
+  801f6d:	78 06                	js     801f75 <devfile_read+0x231>
+  801f6f:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  801f73:	74 14                	je     801f89 <devfile_read+0x245>
+    memmove(dst, src, r);
+  801f75:	83 ec 04             	sub    $0x4,%esp
+  801f78:	ff 75 d4             	push   -0x2c(%ebp)
+  801f7b:	ff 75 d0             	push   -0x30(%ebp)
+  801f7e:	ff 75 0c             	push   0xc(%ebp)
+  801f81:	e8 21 ea ff ff       	call   8009a7 <memmove>
+  801f86:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  801f89:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f8c:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  801f8f:	e9 11 fe ff ff       	jmp    801da5 <devfile_read+0x61>
+  assert(r <= n);
+  801f94:	68 fd 3e 80 00       	push   $0x803efd
+  801f99:	68 04 3f 80 00       	push   $0x803f04
+  801f9e:	68 1c 01 00 00       	push   $0x11c
+  801fa3:	68 f2 3e 80 00       	push   $0x803ef2
+  801fa8:	e8 ab e1 ff ff       	call   800158 <_panic>
+  assert(r <= PGSIZE);
+  801fad:	68 19 3f 80 00       	push   $0x803f19
+  801fb2:	68 04 3f 80 00       	push   $0x803f04
+  801fb7:	68 1d 01 00 00       	push   $0x11d
+  801fbc:	68 f2 3e 80 00       	push   $0x803ef2
+  801fc1:	e8 92 e1 ff ff       	call   800158 <_panic>
+
+00801fc6 <devfile_write>:
+{
+  801fc6:	55                   	push   %ebp
+  801fc7:	89 e5                	mov    %esp,%ebp
+  801fc9:	57                   	push   %edi
+  801fca:	56                   	push   %esi
+  801fcb:	53                   	push   %ebx
+  801fcc:	83 ec 1c             	sub    $0x1c,%esp
+  801fcf:	8b 75 08             	mov    0x8(%ebp),%esi
+  801fd2:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  801fd5:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  801fda:	77 39                	ja     802015 <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801fdc:	8b 56 0c             	mov    0xc(%esi),%edx
+  801fdf:	89 15 00 60 80 00    	mov    %edx,0x806000
+  fsipcbuf.write.req_n = n;
+  801fe5:	a3 04 60 80 00       	mov    %eax,0x806004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  801fea:	83 ec 04             	sub    $0x4,%esp
+  801fed:	50                   	push   %eax
+  801fee:	ff 75 0c             	push   0xc(%ebp)
+  801ff1:	68 08 60 80 00       	push   $0x806008
+  801ff6:	e8 ac e9 ff ff       	call   8009a7 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801ffb:	ba 00 00 00 00       	mov    $0x0,%edx
+  802000:	b8 04 00 00 00       	mov    $0x4,%eax
+  802005:	e8 e7 fb ff ff       	call   801bf1 <fsipc>
+  80200a:	83 c4 10             	add    $0x10,%esp
+}
+  80200d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802010:	5b                   	pop    %ebx
+  802011:	5e                   	pop    %esi
+  802012:	5f                   	pop    %edi
+  802013:	5d                   	pop    %ebp
+  802014:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  802015:	ba 00 00 10 00       	mov    $0x100000,%edx
+  80201a:	39 d0                	cmp    %edx,%eax
+  80201c:	89 d3                	mov    %edx,%ebx
+  80201e:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  802021:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  802027:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  80202a:	83 c7 01             	add    $0x1,%edi
+  80202d:	89 f8                	mov    %edi,%eax
+  80202f:	e8 94 fc ff ff       	call   801cc8 <fsv_alloc>
+  802034:	85 c0                	test   %eax,%eax
+  802036:	78 d5                	js     80200d <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  802038:	83 ec 04             	sub    $0x4,%esp
+  80203b:	53                   	push   %ebx
+  80203c:	ff 75 0c             	push   0xc(%ebp)
+  80203f:	68 00 10 c0 9f       	push   $0x9fc01000
+  802044:	e8 5e e9 ff ff       	call   8009a7 <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  802049:	8b 46 0c             	mov    0xc(%esi),%eax
+  80204c:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  802051:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  802057:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  80205e:	89 f9                	mov    %edi,%ecx
+  802060:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  802065:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80206a:	e8 69 fa ff ff       	call   801ad8 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  80206f:	6a 00                	push   $0x0
+  802071:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802074:	50                   	push   %eax
+  802075:	6a 00                	push   $0x0
+  802077:	6a 00                	push   $0x0
+  802079:	e8 47 15 00 00       	call   8035c5 <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  80207e:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  802081:	eb 8a                	jmp    80200d <devfile_write+0x47>
+
+00802083 <open>:
+{
+  802083:	55                   	push   %ebp
+  802084:	89 e5                	mov    %esp,%ebp
+  802086:	56                   	push   %esi
+  802087:	53                   	push   %ebx
+  802088:	83 ec 1c             	sub    $0x1c,%esp
+  80208b:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  80208e:	56                   	push   %esi
+  80208f:	e8 52 e7 ff ff       	call   8007e6 <strlen>
+  802094:	83 c4 10             	add    $0x10,%esp
+  802097:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80209c:	7f 6c                	jg     80210a <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  80209e:	83 ec 0c             	sub    $0xc,%esp
+  8020a1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8020a4:	50                   	push   %eax
+  8020a5:	e8 ad f4 ff ff       	call   801557 <fd_alloc>
+  8020aa:	89 c3                	mov    %eax,%ebx
+  8020ac:	83 c4 10             	add    $0x10,%esp
+  8020af:	85 c0                	test   %eax,%eax
+  8020b1:	78 3c                	js     8020ef <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  8020b3:	83 ec 08             	sub    $0x8,%esp
+  8020b6:	56                   	push   %esi
+  8020b7:	68 00 60 80 00       	push   $0x806000
+  8020bc:	e8 60 e7 ff ff       	call   800821 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  8020c1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8020c4:	a3 00 64 80 00       	mov    %eax,0x806400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8020c9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8020cc:	b8 01 00 00 00       	mov    $0x1,%eax
+  8020d1:	e8 1b fb ff ff       	call   801bf1 <fsipc>
+  8020d6:	89 c3                	mov    %eax,%ebx
+  8020d8:	83 c4 10             	add    $0x10,%esp
+  8020db:	85 c0                	test   %eax,%eax
+  8020dd:	78 19                	js     8020f8 <open+0x75>
+  return fd2num(fd);
+  8020df:	83 ec 0c             	sub    $0xc,%esp
+  8020e2:	ff 75 f4             	push   -0xc(%ebp)
+  8020e5:	e8 49 f4 ff ff       	call   801533 <fd2num>
+  8020ea:	89 c3                	mov    %eax,%ebx
+  8020ec:	83 c4 10             	add    $0x10,%esp
+}
+  8020ef:	89 d8                	mov    %ebx,%eax
+  8020f1:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8020f4:	5b                   	pop    %ebx
+  8020f5:	5e                   	pop    %esi
+  8020f6:	5d                   	pop    %ebp
+  8020f7:	c3                   	ret
+    fd_close(fd, 0);
+  8020f8:	83 ec 08             	sub    $0x8,%esp
+  8020fb:	6a 00                	push   $0x0
+  8020fd:	ff 75 f4             	push   -0xc(%ebp)
+  802100:	e8 44 f5 ff ff       	call   801649 <fd_close>
+    return r;
+  802105:	83 c4 10             	add    $0x10,%esp
+  802108:	eb e5                	jmp    8020ef <open+0x6c>
+    return -E_BAD_PATH;
+  80210a:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80210f:	eb de                	jmp    8020ef <open+0x6c>
+
+00802111 <open_read>:
+{
+  802111:	55                   	push   %ebp
+  802112:	89 e5                	mov    %esp,%ebp
+  802114:	57                   	push   %edi
+  802115:	56                   	push   %esi
+  802116:	53                   	push   %ebx
+  802117:	83 ec 28             	sub    $0x28,%esp
+  80211a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  80211d:	57                   	push   %edi
+  80211e:	e8 c3 e6 ff ff       	call   8007e6 <strlen>
+  802123:	83 c4 10             	add    $0x10,%esp
+  802126:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80212b:	0f 87 f6 00 00 00    	ja     802227 <open_read+0x116>
+  802131:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  802133:	83 ec 0c             	sub    $0xc,%esp
+  802136:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802139:	50                   	push   %eax
+  80213a:	e8 18 f4 ff ff       	call   801557 <fd_alloc>
+  80213f:	89 c3                	mov    %eax,%ebx
+  802141:	83 c4 10             	add    $0x10,%esp
+  802144:	85 c0                	test   %eax,%eax
+  802146:	0f 88 b2 00 00 00    	js     8021fe <open_read+0xed>
+  strcpy(req->req_buf, path);
+  80214c:	83 ec 08             	sub    $0x8,%esp
+  80214f:	57                   	push   %edi
+  802150:	68 e4 60 80 00       	push   $0x8060e4
+  802155:	e8 c7 e6 ff ff       	call   800821 <strcpy>
+  req->req_nops = 2;
+  80215a:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  802161:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  802164:	c7 05 04 60 80 00 01 	movl   $0x1,0x806004
+  80216b:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  80216e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802171:	a3 10 60 80 00       	mov    %eax,0x806010
+  req->req_ops[0].op_buf = 0;
+  802176:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  80217d:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  802180:	c7 05 20 60 80 00 04 	movl   $0x4,0x806020
+  802187:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  80218a:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  802191:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  802194:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  802199:	29 f0                	sub    %esi,%eax
+  80219b:	3b 45 14             	cmp    0x14(%ebp),%eax
+  80219e:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  8021a2:	a3 2c 60 80 00       	mov    %eax,0x80602c
+  req->req_ops[1].op_offset = 0;
+  8021a7:	c7 05 30 60 80 00 00 	movl   $0x0,0x806030
+  8021ae:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  8021b1:	83 c6 01             	add    $0x1,%esi
+  8021b4:	89 35 34 60 80 00    	mov    %esi,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  8021ba:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8021bd:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8021c2:	e8 2a fa ff ff       	call   801bf1 <fsipc>
+  8021c7:	89 c3                	mov    %eax,%ebx
+  8021c9:	83 c4 10             	add    $0x10,%esp
+  8021cc:	83 f8 01             	cmp    $0x1,%eax
+  8021cf:	7e 37                	jle    802208 <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  8021d1:	a1 38 60 80 00       	mov    0x806038,%eax
+  8021d6:	8b 55 18             	mov    0x18(%ebp),%edx
+  8021d9:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  8021db:	83 ec 04             	sub    $0x4,%esp
+  8021de:	50                   	push   %eax
+  8021df:	81 c6 e4 60 80 00    	add    $0x8060e4,%esi
+  8021e5:	56                   	push   %esi
+  8021e6:	ff 75 10             	push   0x10(%ebp)
+  8021e9:	e8 b9 e7 ff ff       	call   8009a7 <memmove>
+  return fd2num(fd);
+  8021ee:	83 c4 04             	add    $0x4,%esp
+  8021f1:	ff 75 e4             	push   -0x1c(%ebp)
+  8021f4:	e8 3a f3 ff ff       	call   801533 <fd2num>
+  8021f9:	89 c3                	mov    %eax,%ebx
+  8021fb:	83 c4 10             	add    $0x10,%esp
+}
+  8021fe:	89 d8                	mov    %ebx,%eax
+  802200:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802203:	5b                   	pop    %ebx
+  802204:	5e                   	pop    %esi
+  802205:	5f                   	pop    %edi
+  802206:	5d                   	pop    %ebp
+  802207:	c3                   	ret
+    fd_close(fd, 0);
+  802208:	83 ec 08             	sub    $0x8,%esp
+  80220b:	6a 00                	push   $0x0
+  80220d:	ff 75 e4             	push   -0x1c(%ebp)
+  802210:	e8 34 f4 ff ff       	call   801649 <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  802215:	83 c4 10             	add    $0x10,%esp
+  802218:	85 db                	test   %ebx,%ebx
+  80221a:	78 e2                	js     8021fe <open_read+0xed>
+  80221c:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  80221f:	8b 9b 1c 60 80 00    	mov    0x80601c(%ebx),%ebx
+  802225:	eb d7                	jmp    8021fe <open_read+0xed>
+    return -E_BAD_PATH;
+  802227:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80222c:	eb d0                	jmp    8021fe <open_read+0xed>
+
+0080222e <file_stat>:
+{
+  80222e:	55                   	push   %ebp
+  80222f:	89 e5                	mov    %esp,%ebp
+  802231:	57                   	push   %edi
+  802232:	56                   	push   %esi
+  802233:	53                   	push   %ebx
+  802234:	83 ec 18             	sub    $0x18,%esp
+  802237:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80223a:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  80223d:	57                   	push   %edi
+  80223e:	e8 a3 e5 ff ff       	call   8007e6 <strlen>
+  802243:	83 c4 10             	add    $0x10,%esp
+  802246:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80224b:	0f 8f c7 00 00 00    	jg     802318 <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  802251:	83 ec 0c             	sub    $0xc,%esp
+  802254:	57                   	push   %edi
+  802255:	e8 8c e5 ff ff       	call   8007e6 <strlen>
+  80225a:	8d 58 04             	lea    0x4(%eax),%ebx
+  80225d:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  802260:	83 c4 08             	add    $0x8,%esp
+  802263:	57                   	push   %edi
+  802264:	68 e4 60 80 00       	push   $0x8060e4
+  802269:	e8 b3 e5 ff ff       	call   800821 <strcpy>
+  req->req_nops = 2;
+  80226e:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  802275:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  802278:	c7 05 04 60 80 00 02 	movl   $0x2,0x806004
+  80227f:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  802282:	c7 05 10 60 80 00 00 	movl   $0x0,0x806010
+  802289:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  80228c:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  802293:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  802296:	c7 05 20 60 80 00 03 	movl   $0x3,0x806020
+  80229d:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  8022a0:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  8022a7:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  8022aa:	89 1d 34 60 80 00    	mov    %ebx,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  8022b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022b5:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8022ba:	e8 32 f9 ff ff       	call   801bf1 <fsipc>
+  8022bf:	83 c4 10             	add    $0x10,%esp
+  8022c2:	83 f8 01             	cmp    $0x1,%eax
+  8022c5:	7e 42                	jle    802309 <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  8022c7:	81 c3 e4 60 80 00    	add    $0x8060e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  8022cd:	83 ec 08             	sub    $0x8,%esp
+  8022d0:	53                   	push   %ebx
+  8022d1:	56                   	push   %esi
+  8022d2:	e8 4a e5 ff ff       	call   800821 <strcpy>
+  st->st_size = ret->ret_size;
+  8022d7:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  8022dd:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  8022e3:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  8022e9:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  8022ef:	c7 86 88 00 00 00 04 	movl   $0x804004,0x88(%esi)
+  8022f6:	40 80 00 
+  return 0;
+  8022f9:	83 c4 10             	add    $0x10,%esp
+  8022fc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802301:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802304:	5b                   	pop    %ebx
+  802305:	5e                   	pop    %esi
+  802306:	5f                   	pop    %edi
+  802307:	5d                   	pop    %ebp
+  802308:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  802309:	85 c0                	test   %eax,%eax
+  80230b:	78 f4                	js     802301 <file_stat+0xd3>
+  80230d:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  802310:	8b 80 1c 60 80 00    	mov    0x80601c(%eax),%eax
+  802316:	eb e9                	jmp    802301 <file_stat+0xd3>
+    return -E_BAD_PATH;
+  802318:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  80231d:	eb e2                	jmp    802301 <file_stat+0xd3>
+
+0080231f <read_map>:
+{
+  80231f:	55                   	push   %ebp
+  802320:	89 e5                	mov    %esp,%ebp
+  802322:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802325:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802328:	50                   	push   %eax
+  802329:	ff 75 08             	push   0x8(%ebp)
+  80232c:	e8 7c f2 ff ff       	call   8015ad <fd_lookup>
+  802331:	83 c4 10             	add    $0x10,%esp
+  802334:	85 c0                	test   %eax,%eax
+  802336:	78 2a                	js     802362 <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  802338:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80233b:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  802341:	39 08                	cmp    %ecx,(%eax)
+  802343:	75 1f                	jne    802364 <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  802345:	8b 40 0c             	mov    0xc(%eax),%eax
+  802348:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read_map.req_offset = offset;
+  80234d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802350:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  802355:	8b 55 10             	mov    0x10(%ebp),%edx
+  802358:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80235d:	e8 8f f8 ff ff       	call   801bf1 <fsipc>
+}
+  802362:	c9                   	leave
+  802363:	c3                   	ret
+    return -E_INVAL;
+  802364:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802369:	eb f7                	jmp    802362 <read_map+0x43>
+
+0080236b <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80236b:	55                   	push   %ebp
+  80236c:	89 e5                	mov    %esp,%ebp
+  80236e:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  802371:	ba 00 00 00 00       	mov    $0x0,%edx
+  802376:	b8 08 00 00 00       	mov    $0x8,%eax
+  80237b:	e8 71 f8 ff ff       	call   801bf1 <fsipc>
+}
+  802380:	c9                   	leave
+  802381:	c3                   	ret
+
+00802382 <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  802382:	55                   	push   %ebp
+  802383:	89 e5                	mov    %esp,%ebp
+  802385:	57                   	push   %edi
+  802386:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  802387:	8b 45 08             	mov    0x8(%ebp),%eax
+  80238a:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.stats.req_bio_sched = 0;
+  80238f:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  802396:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  802399:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  8023a0:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  8023a3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023a8:	b8 09 00 00 00       	mov    $0x9,%eax
+  8023ad:	e8 3f f8 ff ff       	call   801bf1 <fsipc>
+  8023b2:	85 c0                	test   %eax,%eax
+  8023b4:	78 14                	js     8023ca <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  8023b6:	be 00 60 80 00       	mov    $0x806000,%esi
+  8023bb:	b9 16 00 00 00       	mov    $0x16,%ecx
+  8023c0:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8023c3:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  8023c5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023ca:	5e                   	pop    %esi
+  8023cb:	5f                   	pop    %edi
+  8023cc:	5d                   	pop    %ebp
+  8023cd:	c3                   	ret
+
+008023ce <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  8023ce:	55                   	push   %ebp
+  8023cf:	89 e5                	mov    %esp,%ebp
+  8023d1:	53                   	push   %ebx
+  8023d2:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  8023d5:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8023d8:	50                   	push   %eax
+  8023d9:	6a 00                	push   $0x0
+  8023db:	e8 a2 ff ff ff       	call   802382 <fs_stats>
+  8023e0:	83 c4 10             	add    $0x10,%esp
+  8023e3:	85 c0                	test   %eax,%eax
+  8023e5:	78 28                	js     80240f <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  8023e7:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  8023ea:	83 ec 08             	sub    $0x8,%esp
+  8023ed:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8023f0:	50                   	push   %eax
+  8023f1:	6a 20                	push   $0x20
+  8023f3:	e8 8a ff ff ff       	call   802382 <fs_stats>
+  8023f8:	83 c4 10             	add    $0x10,%esp
+  8023fb:	85 c0                	test   %eax,%eax
+  8023fd:	78 10                	js     80240f <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  8023ff:	83 ec 08             	sub    $0x8,%esp
+  802402:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802405:	50                   	push   %eax
+  802406:	53                   	push   %ebx
+  802407:	e8 76 ff ff ff       	call   802382 <fs_stats>
+  80240c:	83 c4 10             	add    $0x10,%esp
+}
+  80240f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802412:	c9                   	leave
+  802413:	c3                   	ret
+
+00802414 <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  802414:	55                   	push   %ebp
+  802415:	89 e5                	mov    %esp,%ebp
+  802417:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  80241a:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  802421:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  802424:	8b 45 08             	mov    0x8(%ebp),%eax
+  802427:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.stats.req_dcache = 0;
+  80242c:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  802433:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  802436:	ba 00 00 00 00       	mov    $0x0,%edx
+  80243b:	b8 09 00 00 00       	mov    $0x9,%eax
+  802440:	e8 ac f7 ff ff       	call   801bf1 <fsipc>
+}
+  802445:	c9                   	leave
+  802446:	c3                   	ret
+
+00802447 <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  802447:	55                   	push   %ebp
+  802448:	89 e5                	mov    %esp,%ebp
+  80244a:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  80244d:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  802454:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  802457:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  80245e:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  802461:	8b 45 08             	mov    0x8(%ebp),%eax
+  802464:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_STATS, NULL);
+  802469:	ba 00 00 00 00       	mov    $0x0,%edx
+  80246e:	b8 09 00 00 00       	mov    $0x9,%eax
+  802473:	e8 79 f7 ff ff       	call   801bf1 <fsipc>
+}
+  802478:	c9                   	leave
+  802479:	c3                   	ret
+
+0080247a <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  80247a:	55                   	push   %ebp
+  80247b:	89 e5                	mov    %esp,%ebp
+  80247d:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802480:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802483:	50                   	push   %eax
+  802484:	ff 75 08             	push   0x8(%ebp)
+  802487:	e8 21 f1 ff ff       	call   8015ad <fd_lookup>
+  80248c:	83 c4 10             	add    $0x10,%esp
+  80248f:	85 c0                	test   %eax,%eax
+  802491:	78 34                	js     8024c7 <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  802493:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802496:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  80249c:	39 08                	cmp    %ecx,(%eax)
+  80249e:	75 29                	jne    8024c9 <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  8024a0:	8b 40 0c             	mov    0xc(%eax),%eax
+  8024a3:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.fallocate.req_offset = offset;
+  8024a8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8024ab:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.fallocate.req_len = len;
+  8024b0:	8b 45 10             	mov    0x10(%ebp),%eax
+  8024b3:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  8024b8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024bd:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8024c2:	e8 2a f7 ff ff       	call   801bf1 <fsipc>
+}
+  8024c7:	c9                   	leave
+  8024c8:	c3                   	ret
+    return -E_INVAL;
+  8024c9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8024ce:	eb f7                	jmp    8024c7 <fallocate+0x4d>
+
+008024d0 <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  8024d0:	55                   	push   %ebp
+  8024d1:	89 e5                	mov    %esp,%ebp
+  8024d3:	57                   	push   %edi
+  8024d4:	56                   	push   %esi
+  8024d5:	53                   	push   %ebx
+  8024d6:	83 ec 24             	sub    $0x24,%esp
+  8024d9:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8024dc:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8024df:	50                   	push   %eax
+  8024e0:	ff 75 08             	push   0x8(%ebp)
+  8024e3:	e8 c5 f0 ff ff       	call   8015ad <fd_lookup>
+  8024e8:	83 c4 10             	add    $0x10,%esp
+  8024eb:	85 c0                	test   %eax,%eax
+  8024ed:	78 66                	js     802555 <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  8024ef:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8024f2:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  8024f8:	39 08                	cmp    %ecx,(%eax)
+  8024fa:	75 61                	jne    80255d <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  8024fc:	85 f6                	test   %esi,%esi
+  8024fe:	7e 50                	jle    802550 <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  802500:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  802505:	39 de                	cmp    %ebx,%esi
+  802507:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  80250a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80250d:	8b 40 0c             	mov    0xc(%eax),%eax
+  802510:	a3 00 60 80 00       	mov    %eax,0x806000
+    fsipcbuf.prefetch.req_n = m;
+  802515:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  80251b:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  802522:	83 ec 04             	sub    $0x4,%esp
+  802525:	57                   	push   %edi
+  802526:	ff 75 0c             	push   0xc(%ebp)
+  802529:	68 08 60 80 00       	push   $0x806008
+  80252e:	e8 74 e4 ff ff       	call   8009a7 <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  802533:	ba 00 00 00 00       	mov    $0x0,%edx
+  802538:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80253d:	e8 af f6 ff ff       	call   801bf1 <fsipc>
+  802542:	83 c4 10             	add    $0x10,%esp
+  802545:	85 c0                	test   %eax,%eax
+  802547:	78 0c                	js     802555 <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  802549:	01 7d 0c             	add    %edi,0xc(%ebp)
+  80254c:	29 de                	sub    %ebx,%esi
+  80254e:	eb ac                	jmp    8024fc <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  802550:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802555:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802558:	5b                   	pop    %ebx
+  802559:	5e                   	pop    %esi
+  80255a:	5f                   	pop    %edi
+  80255b:	5d                   	pop    %ebp
+  80255c:	c3                   	ret
+    return -E_INVAL;
+  80255d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802562:	eb f1                	jmp    802555 <prefetch+0x85>
+
+00802564 <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  802564:	55                   	push   %ebp
+  802565:	89 e5                	mov    %esp,%ebp
+  802567:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  80256a:	50                   	push   %eax
+  80256b:	e8 d3 ef ff ff       	call   801543 <fd2data>
+  802570:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  802575:	c9                   	leave
+  802576:	c3                   	ret
+
+00802577 <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802577:	55                   	push   %ebp
+  802578:	89 e5                	mov    %esp,%ebp
+  80257a:	56                   	push   %esi
+  80257b:	53                   	push   %ebx
+  80257c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  80257f:	83 ec 0c             	sub    $0xc,%esp
+  802582:	ff 75 08             	push   0x8(%ebp)
+  802585:	e8 b9 ef ff ff       	call   801543 <fd2data>
+  80258a:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  80258c:	83 c4 08             	add    $0x8,%esp
+  80258f:	68 54 3f 80 00       	push   $0x803f54
+  802594:	53                   	push   %ebx
+  802595:	e8 87 e2 ff ff       	call   800821 <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  80259a:	8b 46 04             	mov    0x4(%esi),%eax
+  80259d:	2b 06                	sub    (%esi),%eax
+  80259f:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  8025a5:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8025ac:	00 00 00 
+  stat->st_dev = &devpipe;
+  8025af:	c7 83 88 00 00 00 20 	movl   $0x804020,0x88(%ebx)
+  8025b6:	40 80 00 
+  return 0;
+}
+  8025b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025be:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8025c1:	5b                   	pop    %ebx
+  8025c2:	5e                   	pop    %esi
+  8025c3:	5d                   	pop    %ebp
+  8025c4:	c3                   	ret
+
+008025c5 <pipe_wakeup>:
+{
+  8025c5:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  8025c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025cc:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  8025cf:	85 c0                	test   %eax,%eax
+  8025d1:	75 01                	jne    8025d4 <pipe_wakeup+0xf>
+  8025d3:	c3                   	ret
+{
+  8025d4:	55                   	push   %ebp
+  8025d5:	89 e5                	mov    %esp,%ebp
+  8025d7:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  8025da:	6a 00                	push   $0x0
+  8025dc:	68 00 00 c0 ee       	push   $0xeec00000
+  8025e1:	52                   	push   %edx
+  8025e2:	e8 c5 e9 ff ff       	call   800fac <sys_chan_wakeup>
+  8025e7:	83 c4 10             	add    $0x10,%esp
+}
+  8025ea:	c9                   	leave
+  8025eb:	c3                   	ret
+
+008025ec <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8025ec:	55                   	push   %ebp
+  8025ed:	89 e5                	mov    %esp,%ebp
+  8025ef:	57                   	push   %edi
+  8025f0:	56                   	push   %esi
+  8025f1:	53                   	push   %ebx
+  8025f2:	83 ec 18             	sub    $0x18,%esp
+  8025f5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  8025f8:	57                   	push   %edi
+  8025f9:	e8 45 ef ff ff       	call   801543 <fd2data>
+  8025fe:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  802600:	83 c4 10             	add    $0x10,%esp
+  802603:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  802607:	74 2a                	je     802633 <devpipe_close+0x47>
+  802609:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  80260e:	89 f8                	mov    %edi,%eax
+  802610:	e8 4f ff ff ff       	call   802564 <pipe_ring>
+  802615:	83 ec 08             	sub    $0x8,%esp
+  802618:	01 d8                	add    %ebx,%eax
+  80261a:	50                   	push   %eax
+  80261b:	6a 00                	push   $0x0
+  80261d:	e8 b3 e6 ff ff       	call   800cd5 <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  802622:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802628:	83 c4 10             	add    $0x10,%esp
+  80262b:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  802631:	75 db                	jne    80260e <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  802633:	83 ec 08             	sub    $0x8,%esp
+  802636:	57                   	push   %edi
+  802637:	6a 00                	push   $0x0
+  802639:	e8 97 e6 ff ff       	call   800cd5 <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  80263e:	83 c4 10             	add    $0x10,%esp
+  802641:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  802645:	75 13                	jne    80265a <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  802647:	83 ec 08             	sub    $0x8,%esp
+  80264a:	56                   	push   %esi
+  80264b:	6a 00                	push   $0x0
+  80264d:	e8 83 e6 ff ff       	call   800cd5 <sys_page_unmap>
+}
+  802652:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802655:	5b                   	pop    %ebx
+  802656:	5e                   	pop    %esi
+  802657:	5f                   	pop    %edi
+  802658:	5d                   	pop    %ebp
+  802659:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  80265a:	8d 56 04             	lea    0x4(%esi),%edx
+  80265d:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802660:	e8 60 ff ff ff       	call   8025c5 <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802665:	8d 46 30             	lea    0x30(%esi),%eax
+  802668:	89 f2                	mov    %esi,%edx
+  80266a:	e8 56 ff ff ff       	call   8025c5 <pipe_wakeup>
+  80266f:	eb d6                	jmp    802647 <devpipe_close+0x5b>
+
+00802671 <_pipeisclosed>:
+{
+  802671:	55                   	push   %ebp
+  802672:	89 e5                	mov    %esp,%ebp
+  802674:	57                   	push   %edi
+  802675:	56                   	push   %esi
+  802676:	53                   	push   %ebx
+  802677:	83 ec 1c             	sub    $0x1c,%esp
+  80267a:	89 c7                	mov    %eax,%edi
+  80267c:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  80267e:	a1 a4 58 80 00       	mov    0x8058a4,%eax
+  802683:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  802686:	83 ec 0c             	sub    $0xc,%esp
+  802689:	57                   	push   %edi
+  80268a:	e8 99 10 00 00       	call   803728 <pageref>
+  80268f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802692:	89 34 24             	mov    %esi,(%esp)
+  802695:	e8 8e 10 00 00       	call   803728 <pageref>
+    nn = thisenv->env_runs;
+  80269a:	8b 15 a4 58 80 00    	mov    0x8058a4,%edx
+  8026a0:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  8026a3:	83 c4 10             	add    $0x10,%esp
+  8026a6:	39 cb                	cmp    %ecx,%ebx
+  8026a8:	74 1b                	je     8026c5 <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  8026aa:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8026ad:	75 cf                	jne    80267e <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8026af:	8b 42 58             	mov    0x58(%edx),%eax
+  8026b2:	6a 01                	push   $0x1
+  8026b4:	50                   	push   %eax
+  8026b5:	53                   	push   %ebx
+  8026b6:	68 5b 3f 80 00       	push   $0x803f5b
+  8026bb:	e8 73 db ff ff       	call   800233 <cprintf>
+  8026c0:	83 c4 10             	add    $0x10,%esp
+  8026c3:	eb b9                	jmp    80267e <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  8026c5:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8026c8:	0f 94 c0             	sete   %al
+  8026cb:	0f b6 c0             	movzbl %al,%eax
+}
+  8026ce:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026d1:	5b                   	pop    %ebx
+  8026d2:	5e                   	pop    %esi
+  8026d3:	5f                   	pop    %edi
+  8026d4:	5d                   	pop    %ebp
+  8026d5:	c3                   	ret
+
+008026d6 <devpipe_write_bulk>:
+{
+  8026d6:	55                   	push   %ebp
+  8026d7:	89 e5                	mov    %esp,%ebp
+  8026d9:	57                   	push   %edi
+  8026da:	56                   	push   %esi
+  8026db:	53                   	push   %ebx
+  8026dc:	83 ec 1c             	sub    $0x1c,%esp
+  8026df:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8026e2:	89 d6                	mov    %edx,%esi
+  8026e4:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  8026e7:	e8 78 fe ff ff       	call   802564 <pipe_ring>
+  8026ec:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  8026ef:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  8026f4:	8d 46 04             	lea    0x4(%esi),%eax
+  8026f7:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  8026fa:	eb 75                	jmp    802771 <devpipe_write_bulk+0x9b>
+  8026fc:	b8 01 00 00 00       	mov    $0x1,%eax
+  802701:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802705:	6a 64                	push   $0x64
+  802707:	68 00 00 c0 ee       	push   $0xeec00000
+  80270c:	53                   	push   %ebx
+  80270d:	56                   	push   %esi
+  80270e:	e8 76 e8 ff ff       	call   800f89 <sys_chan_sleep>
+      continue;
+  802713:	83 c4 10             	add    $0x10,%esp
+  802716:	eb 59                	jmp    802771 <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  802718:	89 d1                	mov    %edx,%ecx
+  80271a:	c1 f9 1f             	sar    $0x1f,%ecx
+  80271d:	c1 e9 11             	shr    $0x11,%ecx
+  802720:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802723:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802728:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  80272a:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  802730:	29 d3                	sub    %edx,%ebx
+  802732:	ba 00 80 00 00       	mov    $0x8000,%edx
+  802737:	29 c2                	sub    %eax,%edx
+  802739:	39 d3                	cmp    %edx,%ebx
+  80273b:	0f 47 da             	cmova  %edx,%ebx
+  80273e:	8b 55 08             	mov    0x8(%ebp),%edx
+  802741:	29 fa                	sub    %edi,%edx
+  802743:	39 d3                	cmp    %edx,%ebx
+  802745:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  802748:	83 ec 04             	sub    $0x4,%esp
+  80274b:	53                   	push   %ebx
+  80274c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80274f:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  802752:	52                   	push   %edx
+  802753:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802756:	01 c8                	add    %ecx,%eax
+  802758:	50                   	push   %eax
+  802759:	e8 ab e2 ff ff       	call   800a09 <memcpy>
+    i += m;
+  80275e:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  802760:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802763:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802766:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802769:	e8 57 fe ff ff       	call   8025c5 <pipe_wakeup>
+  80276e:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802771:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802774:	73 2b                	jae    8027a1 <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  802776:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  802778:	8b 56 04             	mov    0x4(%esi),%edx
+  80277b:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  802781:	39 d0                	cmp    %edx,%eax
+  802783:	7d 93                	jge    802718 <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  802785:	89 f2                	mov    %esi,%edx
+  802787:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80278a:	e8 e2 fe ff ff       	call   802671 <_pipeisclosed>
+  80278f:	85 c0                	test   %eax,%eax
+  802791:	0f 84 65 ff ff ff    	je     8026fc <devpipe_write_bulk+0x26>
+        return i;
+  802797:	89 f8                	mov    %edi,%eax
+}
+  802799:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80279c:	5b                   	pop    %ebx
+  80279d:	5e                   	pop    %esi
+  80279e:	5f                   	pop    %edi
+  80279f:	5d                   	pop    %ebp
+  8027a0:	c3                   	ret
+  return i;
+  8027a1:	89 f8                	mov    %edi,%eax
+  8027a3:	eb f4                	jmp    802799 <devpipe_write_bulk+0xc3>
+
+008027a5 <devpipe_write>:
+{
+  8027a5:	55                   	push   %ebp
+  8027a6:	89 e5                	mov    %esp,%ebp
+  8027a8:	57                   	push   %edi
+  8027a9:	56                   	push   %esi
+  8027aa:	53                   	push   %ebx
+  8027ab:	83 ec 28             	sub    $0x28,%esp
+  8027ae:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  8027b1:	56                   	push   %esi
+  8027b2:	e8 8c ed ff ff       	call   801543 <fd2data>
+  8027b7:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  8027b9:	8b 78 28             	mov    0x28(%eax),%edi
+  8027bc:	83 c4 10             	add    $0x10,%esp
+  8027bf:	85 ff                	test   %edi,%edi
+  8027c1:	75 25                	jne    8027e8 <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  8027c3:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8027c6:	74 66                	je     80282e <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8027c8:	8b 43 04             	mov    0x4(%ebx),%eax
+  8027cb:	8b 0b                	mov    (%ebx),%ecx
+  8027cd:	8d 51 20             	lea    0x20(%ecx),%edx
+  8027d0:	39 d0                	cmp    %edx,%eax
+  8027d2:	72 2b                	jb     8027ff <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  8027d4:	89 da                	mov    %ebx,%edx
+  8027d6:	89 f0                	mov    %esi,%eax
+  8027d8:	e8 94 fe ff ff       	call   802671 <_pipeisclosed>
+  8027dd:	85 c0                	test   %eax,%eax
+  8027df:	75 51                	jne    802832 <devpipe_write+0x8d>
+      sys_yield();
+  8027e1:	e8 08 e4 ff ff       	call   800bee <sys_yield>
+  8027e6:	eb e0                	jmp    8027c8 <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  8027e8:	83 ec 0c             	sub    $0xc,%esp
+  8027eb:	ff 75 10             	push   0x10(%ebp)
+  8027ee:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8027f1:	89 c2                	mov    %eax,%edx
+  8027f3:	89 f0                	mov    %esi,%eax
+  8027f5:	e8 dc fe ff ff       	call   8026d6 <devpipe_write_bulk>
+  8027fa:	83 c4 10             	add    $0x10,%esp
+  8027fd:	eb 38                	jmp    802837 <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8027ff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802802:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802806:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802809:	89 c2                	mov    %eax,%edx
+  80280b:	c1 fa 1f             	sar    $0x1f,%edx
+  80280e:	89 d1                	mov    %edx,%ecx
+  802810:	c1 e9 1b             	shr    $0x1b,%ecx
+  802813:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802816:	83 e2 1f             	and    $0x1f,%edx
+  802819:	29 ca                	sub    %ecx,%edx
+  80281b:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  80281f:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  802823:	83 c0 01             	add    $0x1,%eax
+  802826:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  802829:	83 c7 01             	add    $0x1,%edi
+  80282c:	eb 95                	jmp    8027c3 <devpipe_write+0x1e>
+  return i;
+  80282e:	89 f8                	mov    %edi,%eax
+  802830:	eb 05                	jmp    802837 <devpipe_write+0x92>
+        return 0;
+  802832:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802837:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80283a:	5b                   	pop    %ebx
+  80283b:	5e                   	pop    %esi
+  80283c:	5f                   	pop    %edi
+  80283d:	5d                   	pop    %ebp
+  80283e:	c3                   	ret
+
+0080283f <devpipe_read_bulk>:
+{
+  80283f:	55                   	push   %ebp
+  802840:	89 e5                	mov    %esp,%ebp
+  802842:	57                   	push   %edi
+  802843:	56                   	push   %esi
+  802844:	53                   	push   %ebx
+  802845:	83 ec 2c             	sub    $0x2c,%esp
+  802848:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80284b:	89 d6                	mov    %edx,%esi
+  80284d:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802850:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  802853:	e8 0c fd ff ff       	call   802564 <pipe_ring>
+  802858:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  80285b:	85 db                	test   %ebx,%ebx
+  80285d:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802862:	0f 45 c3             	cmovne %ebx,%eax
+  802865:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802868:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  80286d:	8d 46 30             	lea    0x30(%esi),%eax
+  802870:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  802873:	eb 50                	jmp    8028c5 <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  802875:	89 d1                	mov    %edx,%ecx
+  802877:	c1 f9 1f             	sar    $0x1f,%ecx
+  80287a:	c1 e9 11             	shr    $0x11,%ecx
+  80287d:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802880:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802885:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  802887:	29 d3                	sub    %edx,%ebx
+  802889:	ba 00 80 00 00       	mov    $0x8000,%edx
+  80288e:	29 c2                	sub    %eax,%edx
+  802890:	39 d3                	cmp    %edx,%ebx
+  802892:	0f 47 da             	cmova  %edx,%ebx
+  802895:	8b 55 08             	mov    0x8(%ebp),%edx
+  802898:	29 fa                	sub    %edi,%edx
+  80289a:	39 d3                	cmp    %edx,%ebx
+  80289c:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  80289f:	83 ec 04             	sub    $0x4,%esp
+  8028a2:	53                   	push   %ebx
+  8028a3:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8028a6:	01 c8                	add    %ecx,%eax
+  8028a8:	50                   	push   %eax
+  8028a9:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8028ac:	01 f8                	add    %edi,%eax
+  8028ae:	50                   	push   %eax
+  8028af:	e8 55 e1 ff ff       	call   800a09 <memcpy>
+    i += m;
+  8028b4:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  8028b6:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8028b8:	89 f2                	mov    %esi,%edx
+  8028ba:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8028bd:	e8 03 fd ff ff       	call   8025c5 <pipe_wakeup>
+  8028c2:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  8028c5:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  8028c8:	73 51                	jae    80291b <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  8028ca:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  8028cd:	8b 16                	mov    (%esi),%edx
+  8028cf:	39 da                	cmp    %ebx,%edx
+  8028d1:	75 a2                	jne    802875 <devpipe_read_bulk+0x36>
+      if (i > 0)
+  8028d3:	85 ff                	test   %edi,%edi
+  8028d5:	75 44                	jne    80291b <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  8028d7:	89 f2                	mov    %esi,%edx
+  8028d9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8028dc:	e8 90 fd ff ff       	call   802671 <_pipeisclosed>
+  8028e1:	85 c0                	test   %eax,%eax
+  8028e3:	75 3a                	jne    80291f <devpipe_read_bulk+0xe0>
+  8028e5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8028ea:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  8028ee:	6a 64                	push   $0x64
+  8028f0:	ff 75 d4             	push   -0x2c(%ebp)
+  8028f3:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  8028f4:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  8028f7:	50                   	push   %eax
+  8028f8:	e8 8c e6 ff ff       	call   800f89 <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  8028fd:	85 c0                	test   %eax,%eax
+  8028ff:	ba 00 00 00 00       	mov    $0x0,%edx
+  802904:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  802907:	83 c4 10             	add    $0x10,%esp
+  80290a:	a8 01                	test   $0x1,%al
+  80290c:	74 b7                	je     8028c5 <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  80290e:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  802913:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802916:	5b                   	pop    %ebx
+  802917:	5e                   	pop    %esi
+  802918:	5f                   	pop    %edi
+  802919:	5d                   	pop    %ebp
+  80291a:	c3                   	ret
+  return i;
+  80291b:	89 f8                	mov    %edi,%eax
+  80291d:	eb f4                	jmp    802913 <devpipe_read_bulk+0xd4>
+        return 0;
+  80291f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802924:	eb ed                	jmp    802913 <devpipe_read_bulk+0xd4>
+
+00802926 <devpipe_read>:
+{
+  802926:	55                   	push   %ebp
+  802927:	89 e5                	mov    %esp,%ebp
+  802929:	57                   	push   %edi
+  80292a:	56                   	push   %esi
+  80292b:	53                   	push   %ebx
+  80292c:	83 ec 18             	sub    $0x18,%esp
+  80292f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  802932:	57                   	push   %edi
+  802933:	e8 0b ec ff ff       	call   801543 <fd2data>
+  802938:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  80293a:	8b 70 28             	mov    0x28(%eax),%esi
+  80293d:	83 c4 10             	add    $0x10,%esp
+  802940:	85 f6                	test   %esi,%esi
+  802942:	75 24                	jne    802968 <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  802944:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802947:	74 60                	je     8029a9 <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  802949:	8b 03                	mov    (%ebx),%eax
+  80294b:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80294e:	75 3b                	jne    80298b <devpipe_read+0x65>
+      if (i > 0)
+  802950:	85 f6                	test   %esi,%esi
+  802952:	75 2d                	jne    802981 <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  802954:	89 da                	mov    %ebx,%edx
+  802956:	89 f8                	mov    %edi,%eax
+  802958:	e8 14 fd ff ff       	call   802671 <_pipeisclosed>
+  80295d:	85 c0                	test   %eax,%eax
+  80295f:	75 4c                	jne    8029ad <devpipe_read+0x87>
+      sys_yield();
+  802961:	e8 88 e2 ff ff       	call   800bee <sys_yield>
+  802966:	eb e1                	jmp    802949 <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  802968:	83 ec 08             	sub    $0x8,%esp
+  80296b:	6a 00                	push   $0x0
+  80296d:	ff 75 10             	push   0x10(%ebp)
+  802970:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802973:	89 c2                	mov    %eax,%edx
+  802975:	89 f8                	mov    %edi,%eax
+  802977:	e8 c3 fe ff ff       	call   80283f <devpipe_read_bulk>
+  80297c:	83 c4 10             	add    $0x10,%esp
+  80297f:	eb 02                	jmp    802983 <devpipe_read+0x5d>
+        return i;
+  802981:	89 f0                	mov    %esi,%eax
+}
+  802983:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802986:	5b                   	pop    %ebx
+  802987:	5e                   	pop    %esi
+  802988:	5f                   	pop    %edi
+  802989:	5d                   	pop    %ebp
+  80298a:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80298b:	99                   	cltd
+  80298c:	c1 ea 1b             	shr    $0x1b,%edx
+  80298f:	01 d0                	add    %edx,%eax
+  802991:	83 e0 1f             	and    $0x1f,%eax
+  802994:	29 d0                	sub    %edx,%eax
+  802996:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  80299b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80299e:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  8029a1:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  8029a4:	83 c6 01             	add    $0x1,%esi
+  8029a7:	eb 9b                	jmp    802944 <devpipe_read+0x1e>
+  return i;
+  8029a9:	89 f0                	mov    %esi,%eax
+  8029ab:	eb d6                	jmp    802983 <devpipe_read+0x5d>
+        return 0;
+  8029ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029b2:	eb cf                	jmp    802983 <devpipe_read+0x5d>
+
+008029b4 <pipe2>:
+{
+  8029b4:	55                   	push   %ebp
+  8029b5:	89 e5                	mov    %esp,%ebp
+  8029b7:	57                   	push   %edi
+  8029b8:	56                   	push   %esi
+  8029b9:	53                   	push   %ebx
+  8029ba:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  8029bd:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8029c0:	50                   	push   %eax
+  8029c1:	e8 91 eb ff ff       	call   801557 <fd_alloc>
+  8029c6:	89 c3                	mov    %eax,%ebx
+  8029c8:	83 c4 10             	add    $0x10,%esp
+  8029cb:	85 c0                	test   %eax,%eax
+  8029cd:	0f 88 fb 01 00 00    	js     802bce <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8029d3:	83 ec 04             	sub    $0x4,%esp
+  8029d6:	68 07 04 00 00       	push   $0x407
+  8029db:	ff 75 e4             	push   -0x1c(%ebp)
+  8029de:	6a 00                	push   $0x0
+  8029e0:	e8 6b e2 ff ff       	call   800c50 <sys_page_alloc>
+  8029e5:	89 c3                	mov    %eax,%ebx
+  8029e7:	83 c4 10             	add    $0x10,%esp
+  8029ea:	85 c0                	test   %eax,%eax
+  8029ec:	0f 88 dc 01 00 00    	js     802bce <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  8029f2:	83 ec 0c             	sub    $0xc,%esp
+  8029f5:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8029f8:	50                   	push   %eax
+  8029f9:	e8 59 eb ff ff       	call   801557 <fd_alloc>
+  8029fe:	89 c3                	mov    %eax,%ebx
+  802a00:	83 c4 10             	add    $0x10,%esp
+  802a03:	85 c0                	test   %eax,%eax
+  802a05:	0f 88 b3 01 00 00    	js     802bbe <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802a0b:	83 ec 04             	sub    $0x4,%esp
+  802a0e:	68 07 04 00 00       	push   $0x407
+  802a13:	ff 75 e0             	push   -0x20(%ebp)
+  802a16:	6a 00                	push   $0x0
+  802a18:	e8 33 e2 ff ff       	call   800c50 <sys_page_alloc>
+  802a1d:	89 c3                	mov    %eax,%ebx
+  802a1f:	83 c4 10             	add    $0x10,%esp
+  802a22:	85 c0                	test   %eax,%eax
+  802a24:	0f 88 94 01 00 00    	js     802bbe <pipe2+0x20a>
+  va = fd2data(fd0);
+  802a2a:	83 ec 0c             	sub    $0xc,%esp
+  802a2d:	ff 75 e4             	push   -0x1c(%ebp)
+  802a30:	e8 0e eb ff ff       	call   801543 <fd2data>
+  802a35:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802a37:	83 c4 0c             	add    $0xc,%esp
+  802a3a:	68 07 04 00 00       	push   $0x407
+  802a3f:	50                   	push   %eax
+  802a40:	6a 00                	push   $0x0
+  802a42:	e8 09 e2 ff ff       	call   800c50 <sys_page_alloc>
+  802a47:	89 c3                	mov    %eax,%ebx
+  802a49:	83 c4 10             	add    $0x10,%esp
+  802a4c:	85 c0                	test   %eax,%eax
+  802a4e:	0f 88 5a 01 00 00    	js     802bae <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802a54:	83 ec 0c             	sub    $0xc,%esp
+  802a57:	ff 75 e0             	push   -0x20(%ebp)
+  802a5a:	e8 e4 ea ff ff       	call   801543 <fd2data>
+  802a5f:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802a66:	50                   	push   %eax
+  802a67:	6a 00                	push   $0x0
+  802a69:	57                   	push   %edi
+  802a6a:	6a 00                	push   $0x0
+  802a6c:	e8 22 e2 ff ff       	call   800c93 <sys_page_map>
+  802a71:	89 c3                	mov    %eax,%ebx
+  802a73:	83 c4 20             	add    $0x20,%esp
+  802a76:	85 c0                	test   %eax,%eax
+  802a78:	0f 88 22 01 00 00    	js     802ba0 <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  802a7e:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  802a82:	74 72                	je     802af6 <pipe2+0x142>
+  802a84:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  802a89:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802a8c:	e8 d3 fa ff ff       	call   802564 <pipe_ring>
+  802a91:	83 ec 04             	sub    $0x4,%esp
+  802a94:	68 07 04 00 00       	push   $0x407
+  802a99:	01 f0                	add    %esi,%eax
+  802a9b:	50                   	push   %eax
+  802a9c:	6a 00                	push   $0x0
+  802a9e:	e8 ad e1 ff ff       	call   800c50 <sys_page_alloc>
+  802aa3:	89 c3                	mov    %eax,%ebx
+  802aa5:	83 c4 10             	add    $0x10,%esp
+  802aa8:	85 c0                	test   %eax,%eax
+  802aaa:	0f 88 97 00 00 00    	js     802b47 <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  802ab0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802ab3:	e8 ac fa ff ff       	call   802564 <pipe_ring>
+  802ab8:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  802abb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802abe:	e8 a1 fa ff ff       	call   802564 <pipe_ring>
+  802ac3:	83 ec 0c             	sub    $0xc,%esp
+  802ac6:	68 07 04 00 00       	push   $0x407
+  802acb:	53                   	push   %ebx
+  802acc:	6a 00                	push   $0x0
+  802ace:	01 f0                	add    %esi,%eax
+  802ad0:	50                   	push   %eax
+  802ad1:	6a 00                	push   $0x0
+  802ad3:	e8 bb e1 ff ff       	call   800c93 <sys_page_map>
+  802ad8:	89 c3                	mov    %eax,%ebx
+  802ada:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802ae0:	83 c4 20             	add    $0x20,%esp
+  802ae3:	85 c0                	test   %eax,%eax
+  802ae5:	78 60                	js     802b47 <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  802ae7:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802aed:	75 9a                	jne    802a89 <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  802aef:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  802af6:	a1 20 40 80 00       	mov    0x804020,%eax
+  802afb:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802afe:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  802b00:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802b03:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  802b0a:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802b0d:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  802b0f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802b12:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  802b19:	83 ec 0c             	sub    $0xc,%esp
+  802b1c:	ff 75 e4             	push   -0x1c(%ebp)
+  802b1f:	e8 0f ea ff ff       	call   801533 <fd2num>
+  802b24:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802b27:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  802b29:	83 c4 04             	add    $0x4,%esp
+  802b2c:	ff 75 e0             	push   -0x20(%ebp)
+  802b2f:	e8 ff e9 ff ff       	call   801533 <fd2num>
+  802b34:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802b37:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  802b3a:	83 c4 10             	add    $0x10,%esp
+  802b3d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b42:	e9 87 00 00 00       	jmp    802bce <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802b47:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  802b4c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802b4f:	e8 10 fa ff ff       	call   802564 <pipe_ring>
+  802b54:	83 ec 08             	sub    $0x8,%esp
+  802b57:	01 f0                	add    %esi,%eax
+  802b59:	50                   	push   %eax
+  802b5a:	6a 00                	push   $0x0
+  802b5c:	e8 74 e1 ff ff       	call   800cd5 <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  802b61:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802b64:	e8 fb f9 ff ff       	call   802564 <pipe_ring>
+  802b69:	83 c4 08             	add    $0x8,%esp
+  802b6c:	01 f0                	add    %esi,%eax
+  802b6e:	50                   	push   %eax
+  802b6f:	6a 00                	push   $0x0
+  802b71:	e8 5f e1 ff ff       	call   800cd5 <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802b76:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802b7c:	83 c4 10             	add    $0x10,%esp
+  802b7f:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802b85:	75 c5                	jne    802b4c <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  802b87:	83 ec 0c             	sub    $0xc,%esp
+  802b8a:	ff 75 e0             	push   -0x20(%ebp)
+  802b8d:	e8 b1 e9 ff ff       	call   801543 <fd2data>
+  802b92:	83 c4 08             	add    $0x8,%esp
+  802b95:	50                   	push   %eax
+  802b96:	6a 00                	push   $0x0
+  802b98:	e8 38 e1 ff ff       	call   800cd5 <sys_page_unmap>
+  802b9d:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  802ba0:	83 ec 08             	sub    $0x8,%esp
+  802ba3:	57                   	push   %edi
+  802ba4:	6a 00                	push   $0x0
+  802ba6:	e8 2a e1 ff ff       	call   800cd5 <sys_page_unmap>
+  802bab:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  802bae:	83 ec 08             	sub    $0x8,%esp
+  802bb1:	ff 75 e0             	push   -0x20(%ebp)
+  802bb4:	6a 00                	push   $0x0
+  802bb6:	e8 1a e1 ff ff       	call   800cd5 <sys_page_unmap>
+  802bbb:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  802bbe:	83 ec 08             	sub    $0x8,%esp
+  802bc1:	ff 75 e4             	push   -0x1c(%ebp)
+  802bc4:	6a 00                	push   $0x0
+  802bc6:	e8 0a e1 ff ff       	call   800cd5 <sys_page_unmap>
+  802bcb:	83 c4 10             	add    $0x10,%esp
+}
+  802bce:	89 d8                	mov    %ebx,%eax
+  802bd0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802bd3:	5b                   	pop    %ebx
+  802bd4:	5e                   	pop    %esi
+  802bd5:	5f                   	pop    %edi
+  802bd6:	5d                   	pop    %ebp
+  802bd7:	c3                   	ret
+
+00802bd8 <pipe>:
+{
+  802bd8:	55                   	push   %ebp
+  802bd9:	89 e5                	mov    %esp,%ebp
+  802bdb:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  802bde:	6a 00                	push   $0x0
+  802be0:	ff 75 08             	push   0x8(%ebp)
+  802be3:	e8 cc fd ff ff       	call   8029b4 <pipe2>
+}
+  802be8:	c9                   	leave
+  802be9:	c3                   	ret
+
+00802bea <pipeisclosed>:
+{
+  802bea:	55                   	push   %ebp
+  802beb:	89 e5                	mov    %esp,%ebp
+  802bed:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802bf0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802bf3:	50                   	push   %eax
+  802bf4:	ff 75 08             	push   0x8(%ebp)
+  802bf7:	e8 b1 e9 ff ff       	call   8015ad <fd_lookup>
+  802bfc:	83 c4 10             	add    $0x10,%esp
+  802bff:	85 c0                	test   %eax,%eax
+  802c01:	78 18                	js     802c1b <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  802c03:	83 ec 0c             	sub    $0xc,%esp
+  802c06:	ff 75 f4             	push   -0xc(%ebp)
+  802c09:	e8 35 e9 ff ff       	call   801543 <fd2data>
+  802c0e:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  802c10:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802c13:	e8 59 fa ff ff       	call   802671 <_pipeisclosed>
+  802c18:	83 c4 10             	add    $0x10,%esp
+}
+  802c1b:	c9                   	leave
+  802c1c:	c3                   	ret
+
+00802c1d <pipe_splice>:
+{
+  802c1d:	55                   	push   %ebp
+  802c1e:	89 e5                	mov    %esp,%ebp
+  802c20:	57                   	push   %edi
+  802c21:	56                   	push   %esi
+  802c22:	53                   	push   %ebx
+  802c23:	83 ec 34             	sub    $0x34,%esp
+  802c26:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802c29:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802c2c:	50                   	push   %eax
+  802c2d:	ff 75 08             	push   0x8(%ebp)
+  802c30:	e8 78 e9 ff ff       	call   8015ad <fd_lookup>
+  802c35:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802c38:	83 c4 10             	add    $0x10,%esp
+  802c3b:	85 c0                	test   %eax,%eax
+  802c3d:	0f 88 d7 00 00 00    	js     802d1a <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  802c43:	83 ec 0c             	sub    $0xc,%esp
+  802c46:	ff 75 e4             	push   -0x1c(%ebp)
+  802c49:	e8 f5 e8 ff ff       	call   801543 <fd2data>
+  802c4e:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802c50:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802c53:	83 c4 10             	add    $0x10,%esp
+  802c56:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802c5c:	39 10                	cmp    %edx,(%eax)
+  802c5e:	0f 85 c1 00 00 00    	jne    802d25 <pipe_splice+0x108>
+  802c64:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  802c68:	0f 84 c0 00 00 00    	je     802d2e <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  802c6e:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802c72:	0f 84 bf 00 00 00    	je     802d37 <pipe_splice+0x11a>
+  802c78:	89 f7                	mov    %esi,%edi
+  802c7a:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  802c80:	0f 85 ba 00 00 00    	jne    802d40 <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802c86:	8d 43 04             	lea    0x4(%ebx),%eax
+  802c89:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802c8c:	eb 38                	jmp    802cc6 <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802c8e:	83 ec 0c             	sub    $0xc,%esp
+  802c91:	68 00 10 00 00       	push   $0x1000
+  802c96:	89 f1                	mov    %esi,%ecx
+  802c98:	89 da                	mov    %ebx,%edx
+  802c9a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802c9d:	e8 34 fa ff ff       	call   8026d6 <devpipe_write_bulk>
+  802ca2:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802ca5:	83 c4 10             	add    $0x10,%esp
+  802ca8:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802cad:	75 53                	jne    802d02 <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  802caf:	83 ec 08             	sub    $0x8,%esp
+  802cb2:	56                   	push   %esi
+  802cb3:	6a 00                	push   $0x0
+  802cb5:	e8 1b e0 ff ff       	call   800cd5 <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  802cba:	83 c7 01             	add    $0x1,%edi
+  802cbd:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802cc3:	83 c4 10             	add    $0x10,%esp
+  802cc6:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802cc9:	74 3a                	je     802d05 <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  802ccb:	8b 03                	mov    (%ebx),%eax
+  802ccd:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802cd0:	75 bc                	jne    802c8e <pipe_splice+0x71>
+  802cd2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802cd7:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  802cdb:	85 c0                	test   %eax,%eax
+  802cdd:	74 af                	je     802c8e <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802cdf:	83 ec 04             	sub    $0x4,%esp
+  802ce2:	6a 07                	push   $0x7
+  802ce4:	56                   	push   %esi
+  802ce5:	ff 75 d0             	push   -0x30(%ebp)
+  802ce8:	e8 bf e2 ff ff       	call   800fac <sys_chan_wakeup>
+  802ced:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802cf0:	83 c4 10             	add    $0x10,%esp
+  802cf3:	85 c0                	test   %eax,%eax
+  802cf5:	79 b8                	jns    802caf <pipe_splice+0x92>
+  802cf7:	b8 01 00 00 00       	mov    $0x1,%eax
+  802cfc:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802d00:	eb 8c                	jmp    802c8e <pipe_splice+0x71>
+  802d02:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  802d05:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802d09:	75 06                	jne    802d11 <pipe_splice+0xf4>
+  802d0b:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802d0f:	78 09                	js     802d1a <pipe_splice+0xfd>
+  return i * PGSIZE;
+  802d11:	8b 45 10             	mov    0x10(%ebp),%eax
+  802d14:	c1 e0 0c             	shl    $0xc,%eax
+  802d17:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  802d1a:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802d1d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d20:	5b                   	pop    %ebx
+  802d21:	5e                   	pop    %esi
+  802d22:	5f                   	pop    %edi
+  802d23:	5d                   	pop    %ebp
+  802d24:	c3                   	ret
+    return -E_INVAL;
+  802d25:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802d2c:	eb ec                	jmp    802d1a <pipe_splice+0xfd>
+  802d2e:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802d35:	eb e3                	jmp    802d1a <pipe_splice+0xfd>
+  802d37:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802d3e:	eb da                	jmp    802d1a <pipe_splice+0xfd>
+  802d40:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802d47:	eb d1                	jmp    802d1a <pipe_splice+0xfd>
+
+00802d49 <pipe_splice_read>:
+{
+  802d49:	55                   	push   %ebp
+  802d4a:	89 e5                	mov    %esp,%ebp
+  802d4c:	53                   	push   %ebx
+  802d4d:	83 ec 1c             	sub    $0x1c,%esp
+  802d50:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802d53:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802d56:	50                   	push   %eax
+  802d57:	ff 75 08             	push   0x8(%ebp)
+  802d5a:	e8 4e e8 ff ff       	call   8015ad <fd_lookup>
+  802d5f:	83 c4 10             	add    $0x10,%esp
+  802d62:	85 c0                	test   %eax,%eax
+  802d64:	78 49                	js     802daf <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  802d66:	83 ec 0c             	sub    $0xc,%esp
+  802d69:	ff 75 f4             	push   -0xc(%ebp)
+  802d6c:	e8 d2 e7 ff ff       	call   801543 <fd2data>
+  802d71:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802d73:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802d76:	83 c4 10             	add    $0x10,%esp
+  802d79:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  802d7f:	39 08                	cmp    %ecx,(%eax)
+  802d81:	75 31                	jne    802db4 <pipe_splice_read+0x6b>
+  802d83:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  802d87:	74 32                	je     802dbb <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  802d89:	8b 48 08             	mov    0x8(%eax),%ecx
+  802d8c:	83 e1 03             	and    $0x3,%ecx
+  802d8f:	83 f9 01             	cmp    $0x1,%ecx
+  802d92:	74 2e                	je     802dc2 <pipe_splice_read+0x79>
+  802d94:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  802d9a:	75 2d                	jne    802dc9 <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  802d9c:	83 ec 08             	sub    $0x8,%esp
+  802d9f:	53                   	push   %ebx
+  802da0:	68 00 10 00 00       	push   $0x1000
+  802da5:	89 d9                	mov    %ebx,%ecx
+  802da7:	e8 93 fa ff ff       	call   80283f <devpipe_read_bulk>
+  802dac:	83 c4 10             	add    $0x10,%esp
+}
+  802daf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802db2:	c9                   	leave
+  802db3:	c3                   	ret
+    return -E_INVAL;
+  802db4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802db9:	eb f4                	jmp    802daf <pipe_splice_read+0x66>
+  802dbb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802dc0:	eb ed                	jmp    802daf <pipe_splice_read+0x66>
+  802dc2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802dc7:	eb e6                	jmp    802daf <pipe_splice_read+0x66>
+  802dc9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802dce:	eb df                	jmp    802daf <pipe_splice_read+0x66>
+
+00802dd0 <mmap_find>:
+          utf->utf_eip, utf->utf_err);
+}
+
+static struct Mmap *
+mmap_find(uintptr_t va)
+{
+  802dd0:	55                   	push   %ebp
+  802dd1:	89 e5                	mov    %esp,%ebp
+  802dd3:	56                   	push   %esi
+  802dd4:	53                   	push   %ebx
+  int i;
+
+  for (i = 0; i < NMMAP; i++)
+  802dd5:	ba 60 57 80 00       	mov    $0x805760,%edx
+  802dda:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ddf:	eb 0b                	jmp    802dec <mmap_find+0x1c>
+  802de1:	83 c3 01             	add    $0x1,%ebx
+  802de4:	83 c2 14             	add    $0x14,%edx
+  802de7:	83 fb 10             	cmp    $0x10,%ebx
+  802dea:	74 1d                	je     802e09 <mmap_find+0x39>
+    if (mmaps[i].mm_va && va >= mmaps[i].mm_va &&
+  802dec:	8b 0a                	mov    (%edx),%ecx
+  802dee:	39 c8                	cmp    %ecx,%eax
+  802df0:	72 ef                	jb     802de1 <mmap_find+0x11>
+  802df2:	85 c9                	test   %ecx,%ecx
+  802df4:	74 eb                	je     802de1 <mmap_find+0x11>
+        va < mmaps[i].mm_va + mmaps[i].mm_len)
+  802df6:	03 4a 04             	add    0x4(%edx),%ecx
+    if (mmaps[i].mm_va && va >= mmaps[i].mm_va &&
+  802df9:	39 c8                	cmp    %ecx,%eax
+  802dfb:	73 e4                	jae    802de1 <mmap_find+0x11>
+      return &mmaps[i];
+  802dfd:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802e00:	8d 04 85 60 57 80 00 	lea    0x805760(,%eax,4),%eax
+  802e07:	eb 05                	jmp    802e0e <mmap_find+0x3e>
+  return NULL;
+  802e09:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802e0e:	5b                   	pop    %ebx
+  802e0f:	5e                   	pop    %esi
+  802e10:	5d                   	pop    %ebp
+  802e11:	c3                   	ret
+
+00802e12 <va_mapped>:
+
+static bool
+va_mapped(uintptr_t va)
+{
+  return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+  802e12:	89 c2                	mov    %eax,%edx
+  802e14:	c1 ea 16             	shr    $0x16,%edx
+  802e17:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802e1e:	f6 c2 01             	test   $0x1,%dl
+  802e21:	74 11                	je     802e34 <va_mapped+0x22>
+  802e23:	c1 e8 0c             	shr    $0xc,%eax
+  802e26:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802e2d:	83 e0 01             	and    $0x1,%eax
+  802e30:	83 e0 01             	and    $0x1,%eax
+}
+  802e33:	c3                   	ret
+  return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+  802e34:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e39:	eb f5                	jmp    802e30 <va_mapped+0x1e>
+
+00802e3b <mmap_copy>:
+
+// Replace the page at 'va' with a copy of its first 'n' bytes, the rest
+// zeroed, mapped with 'perm'.
+static void
+mmap_copy(uintptr_t va, size_t n, int perm)
+{
+  802e3b:	55                   	push   %ebp
+  802e3c:	89 e5                	mov    %esp,%ebp
+  802e3e:	57                   	push   %edi
+  802e3f:	56                   	push   %esi
+  802e40:	53                   	push   %ebx
+  802e41:	83 ec 10             	sub    $0x10,%esp
+  802e44:	89 c3                	mov    %eax,%ebx
+  802e46:	89 d7                	mov    %edx,%edi
+  802e48:	89 ce                	mov    %ecx,%esi
+  int r;
+
+  if ((r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  802e4a:	6a 07                	push   $0x7
+  802e4c:	68 00 f0 7f 00       	push   $0x7ff000
+  802e51:	6a 00                	push   $0x0
+  802e53:	e8 f8 dd ff ff       	call   800c50 <sys_page_alloc>
+  802e58:	83 c4 10             	add    $0x10,%esp
+  802e5b:	85 c0                	test   %eax,%eax
+  802e5d:	78 46                	js     802ea5 <mmap_copy+0x6a>
+    panic("mmap: %e", r);
+  memmove(PFTEMP, (void *) va, n);
+  802e5f:	83 ec 04             	sub    $0x4,%esp
+  802e62:	57                   	push   %edi
+  802e63:	53                   	push   %ebx
+  802e64:	68 00 f0 7f 00       	push   $0x7ff000
+  802e69:	e8 39 db ff ff       	call   8009a7 <memmove>
+  if ((r = sys_page_map(0, PFTEMP, 0, (void *) va, perm)) < 0 ||
+  802e6e:	89 34 24             	mov    %esi,(%esp)
+  802e71:	53                   	push   %ebx
+  802e72:	6a 00                	push   $0x0
+  802e74:	68 00 f0 7f 00       	push   $0x7ff000
+  802e79:	6a 00                	push   $0x0
+  802e7b:	e8 13 de ff ff       	call   800c93 <sys_page_map>
+  802e80:	83 c4 20             	add    $0x20,%esp
+  802e83:	85 c0                	test   %eax,%eax
+  802e85:	78 30                	js     802eb7 <mmap_copy+0x7c>
+      (r = sys_page_unmap(0, PFTEMP)) < 0)
+  802e87:	83 ec 08             	sub    $0x8,%esp
+  802e8a:	68 00 f0 7f 00       	push   $0x7ff000
+  802e8f:	6a 00                	push   $0x0
+  802e91:	e8 3f de ff ff       	call   800cd5 <sys_page_unmap>
+  if ((r = sys_page_map(0, PFTEMP, 0, (void *) va, perm)) < 0 ||
+  802e96:	83 c4 10             	add    $0x10,%esp
+  802e99:	85 c0                	test   %eax,%eax
+  802e9b:	78 1a                	js     802eb7 <mmap_copy+0x7c>
+    panic("mmap: %e", r);
+}
+  802e9d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802ea0:	5b                   	pop    %ebx
+  802ea1:	5e                   	pop    %esi
+  802ea2:	5f                   	pop    %edi
+  802ea3:	5d                   	pop    %ebp
+  802ea4:	c3                   	ret
+    panic("mmap: %e", r);
+  802ea5:	50                   	push   %eax
+  802ea6:	68 73 3f 80 00       	push   $0x803f73
+  802eab:	6a 3e                	push   $0x3e
+  802ead:	68 7c 3f 80 00       	push   $0x803f7c
+  802eb2:	e8 a1 d2 ff ff       	call   800158 <_panic>
+    panic("mmap: %e", r);
+  802eb7:	50                   	push   %eax
+  802eb8:	68 73 3f 80 00       	push   $0x803f73
+  802ebd:	6a 42                	push   $0x42
+  802ebf:	68 7c 3f 80 00       	push   $0x803f7c
+  802ec4:	e8 8f d2 ff ff       	call   800158 <_panic>
+
+00802ec9 <mmap_fault>:
+// Handle a page fault in a mapping, if it is one.  Returns 1 if it was.
+// The fork page fault handlers call this first, so that mappings keep
+// working after a fork.
+bool
+mmap_fault(struct UTrapframe *utf)
+{
+  802ec9:	55                   	push   %ebp
+  802eca:	89 e5                	mov    %esp,%ebp
+  802ecc:	57                   	push   %edi
+  802ecd:	56                   	push   %esi
+  802ece:	53                   	push   %ebx
+  802ecf:	83 ec 1c             	sub    $0x1c,%esp
+  802ed2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Fsreq_read_map saved;
+  struct Mmap *m;
+  uintptr_t va;
+  int perm, r;
+
+  va = ROUNDDOWN(utf->utf_fault_va, PGSIZE);
+  802ed5:	8b 1f                	mov    (%edi),%ebx
+  802ed7:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if (va < MMAPBASE || va >= MMAPTOP || (m = mmap_find(va)) == NULL)
+  802edd:	8d 83 00 00 00 60    	lea    0x60000000(%ebx),%eax
+  802ee3:	3d ff ff ff 2f       	cmp    $0x2fffffff,%eax
+  802ee8:	0f 87 24 01 00 00    	ja     803012 <mmap_fault+0x149>
+  802eee:	89 d8                	mov    %ebx,%eax
+  802ef0:	e8 db fe ff ff       	call   802dd0 <mmap_find>
+  802ef5:	89 c6                	mov    %eax,%esi
+  802ef7:	85 c0                	test   %eax,%eax
+  802ef9:	0f 84 20 01 00 00    	je     80301f <mmap_fault+0x156>
+    return 0;
+  if ((utf->utf_err & FEC_WR) && m->mm_perm == MAP_RDONLY)
+  802eff:	f6 47 04 02          	testb  $0x2,0x4(%edi)
+  802f03:	74 13                	je     802f18 <mmap_fault+0x4f>
+  802f05:	83 78 10 00          	cmpl   $0x0,0x10(%eax)
+  802f09:	0f 84 17 01 00 00    	je     803026 <mmap_fault+0x15d>
+    return 0;
+  perm = PTE_P | PTE_U | (m->mm_perm == MAP_RDONLY ? 0 : PTE_W);
+  802f0f:	c7 45 e4 07 00 00 00 	movl   $0x7,-0x1c(%ebp)
+  802f16:	eb 0f                	jmp    802f27 <mmap_fault+0x5e>
+  802f18:	83 78 10 01          	cmpl   $0x1,0x10(%eax)
+  802f1c:	19 c0                	sbb    %eax,%eax
+  802f1e:	83 e0 fe             	and    $0xfffffffe,%eax
+  802f21:	83 c0 07             	add    $0x7,%eax
+  802f24:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+
+  if (!va_mapped(va)) {
+  802f27:	89 d8                	mov    %ebx,%eax
+  802f29:	e8 e4 fe ff ff       	call   802e12 <va_mapped>
+  802f2e:	84 c0                	test   %al,%al
+  802f30:	74 42                	je     802f74 <mmap_fault+0xab>
+    }
+  }
+
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+    mmap_copy(va, PGSIZE, perm);
+  return 1;
+  802f32:	b8 01 00 00 00       	mov    $0x1,%eax
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+  802f37:	f6 47 04 02          	testb  $0x2,0x4(%edi)
+  802f3b:	0f 84 d6 00 00 00    	je     803017 <mmap_fault+0x14e>
+  802f41:	89 d8                	mov    %ebx,%eax
+  802f43:	c1 e8 0c             	shr    $0xc,%eax
+  802f46:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  return 1;
+  802f4d:	b8 01 00 00 00       	mov    $0x1,%eax
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+  802f52:	f6 c2 02             	test   $0x2,%dl
+  802f55:	0f 85 bc 00 00 00    	jne    803017 <mmap_fault+0x14e>
+    mmap_copy(va, PGSIZE, perm);
+  802f5b:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802f5e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802f63:	89 d8                	mov    %ebx,%eax
+  802f65:	e8 d1 fe ff ff       	call   802e3b <mmap_copy>
+  return 1;
+  802f6a:	b8 01 00 00 00       	mov    $0x1,%eax
+  802f6f:	e9 a3 00 00 00       	jmp    803017 <mmap_fault+0x14e>
+    saved = fsipcbuf.read_map;
+  802f74:	a1 00 60 80 00       	mov    0x806000,%eax
+  802f79:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802f7c:	8b 15 04 60 80 00    	mov    0x806004,%edx
+  802f82:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    r = read_map(m->mm_fd, m->mm_offset + (va - m->mm_va), (void *) va);
+  802f85:	83 ec 04             	sub    $0x4,%esp
+  802f88:	53                   	push   %ebx
+  802f89:	89 d8                	mov    %ebx,%eax
+  802f8b:	03 46 0c             	add    0xc(%esi),%eax
+  802f8e:	2b 06                	sub    (%esi),%eax
+  802f90:	50                   	push   %eax
+  802f91:	ff 76 08             	push   0x8(%esi)
+  802f94:	e8 86 f3 ff ff       	call   80231f <read_map>
+    fsipcbuf.read_map = saved;
+  802f99:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802f9c:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+  802fa2:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  802fa5:	89 15 04 60 80 00    	mov    %edx,0x806004
+    if (r < 0)
+  802fab:	83 c4 10             	add    $0x10,%esp
+  802fae:	85 c0                	test   %eax,%eax
+  802fb0:	78 20                	js     802fd2 <mmap_fault+0x109>
+    if (r == 0) {
+  802fb2:	74 30                	je     802fe4 <mmap_fault+0x11b>
+    if (r < PGSIZE) {
+  802fb4:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  802fb9:	0f 8f 73 ff ff ff    	jg     802f32 <mmap_fault+0x69>
+      mmap_copy(va, r, perm);
+  802fbf:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802fc2:	89 c2                	mov    %eax,%edx
+  802fc4:	89 d8                	mov    %ebx,%eax
+  802fc6:	e8 70 fe ff ff       	call   802e3b <mmap_copy>
+      return 1;
+  802fcb:	b8 01 00 00 00       	mov    $0x1,%eax
+  802fd0:	eb 45                	jmp    803017 <mmap_fault+0x14e>
+      panic("mmap: read_map: %e", r);
+  802fd2:	50                   	push   %eax
+  802fd3:	68 87 3f 80 00       	push   $0x803f87
+  802fd8:	6a 5f                	push   $0x5f
+  802fda:	68 7c 3f 80 00       	push   $0x803f7c
+  802fdf:	e8 74 d1 ff ff       	call   800158 <_panic>
+      if ((r = sys_page_alloc(0, (void *) va, perm)) < 0)
+  802fe4:	83 ec 04             	sub    $0x4,%esp
+  802fe7:	ff 75 e4             	push   -0x1c(%ebp)
+  802fea:	53                   	push   %ebx
+  802feb:	6a 00                	push   $0x0
+  802fed:	e8 5e dc ff ff       	call   800c50 <sys_page_alloc>
+  802ff2:	83 c4 10             	add    $0x10,%esp
+  802ff5:	85 c0                	test   %eax,%eax
+  802ff7:	78 07                	js     803000 <mmap_fault+0x137>
+      return 1;
+  802ff9:	b8 01 00 00 00       	mov    $0x1,%eax
+  802ffe:	eb 17                	jmp    803017 <mmap_fault+0x14e>
+        panic("mmap: %e", r);
+  803000:	50                   	push   %eax
+  803001:	68 73 3f 80 00       	push   $0x803f73
+  803006:	6a 64                	push   $0x64
+  803008:	68 7c 3f 80 00       	push   $0x803f7c
+  80300d:	e8 46 d1 ff ff       	call   800158 <_panic>
+    return 0;
+  803012:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803017:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80301a:	5b                   	pop    %ebx
+  80301b:	5e                   	pop    %esi
+  80301c:	5f                   	pop    %edi
+  80301d:	5d                   	pop    %ebp
+  80301e:	c3                   	ret
+    return 0;
+  80301f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803024:	eb f1                	jmp    803017 <mmap_fault+0x14e>
+    return 0;
+  803026:	b8 00 00 00 00       	mov    $0x0,%eax
+  80302b:	eb ea                	jmp    803017 <mmap_fault+0x14e>
+
+0080302d <mmap_pgfault>:
+{
+  80302d:	55                   	push   %ebp
+  80302e:	89 e5                	mov    %esp,%ebp
+  803030:	53                   	push   %ebx
+  803031:	83 ec 10             	sub    $0x10,%esp
+  803034:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (!mmap_fault(utf))
+  803037:	53                   	push   %ebx
+  803038:	e8 8c fe ff ff       	call   802ec9 <mmap_fault>
+  80303d:	83 c4 10             	add    $0x10,%esp
+  803040:	84 c0                	test   %al,%al
+  803042:	74 05                	je     803049 <mmap_pgfault+0x1c>
+}
+  803044:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803047:	c9                   	leave
+  803048:	c3                   	ret
+    panic("page fault at %08x, eip %08x, err %04x", utf->utf_fault_va,
+  803049:	83 ec 08             	sub    $0x8,%esp
+  80304c:	ff 73 04             	push   0x4(%ebx)
+  80304f:	ff 73 28             	push   0x28(%ebx)
+  803052:	ff 33                	push   (%ebx)
+  803054:	68 9c 3f 80 00       	push   $0x803f9c
+  803059:	6a 20                	push   $0x20
+  80305b:	68 7c 3f 80 00       	push   $0x803f7c
+  803060:	e8 f3 d0 ff ff       	call   800158 <_panic>
+
+00803065 <mmap>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_INVAL if offset isn't aligned, len is 0, or perm is unknown
+//	-E_NO_MEM if there's no free slot or address space for it
+int
+mmap(int fdnum, off_t offset, size_t len, int perm, void **addr)
+{
+  803065:	55                   	push   %ebp
+  803066:	89 e5                	mov    %esp,%ebp
+  803068:	57                   	push   %edi
+  803069:	56                   	push   %esi
+  80306a:	53                   	push   %ebx
+  80306b:	83 ec 44             	sub    $0x44,%esp
+  80306e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  struct Fd *fd;
+  uintptr_t va;
+  int i, j, r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803071:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  803074:	50                   	push   %eax
+  803075:	ff 75 08             	push   0x8(%ebp)
+  803078:	e8 30 e5 ff ff       	call   8015ad <fd_lookup>
+  80307d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  803080:	83 c4 10             	add    $0x10,%esp
+  803083:	85 c0                	test   %eax,%eax
+  803085:	0f 88 3e 01 00 00    	js     8031c9 <mmap+0x164>
+    return r;
+  if (offset < 0 || PGOFF(offset) || len == 0 ||
+  80308b:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  80308f:	0f 88 d1 00 00 00    	js     803166 <mmap+0x101>
+  803095:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803098:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80309d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8030a0:	0f 85 c9 00 00 00    	jne    80316f <mmap+0x10a>
+  8030a6:	85 db                	test   %ebx,%ebx
+  8030a8:	0f 84 ca 00 00 00    	je     803178 <mmap+0x113>
+  8030ae:	83 7d 14 02          	cmpl   $0x2,0x14(%ebp)
+  8030b2:	0f 87 c0 00 00 00    	ja     803178 <mmap+0x113>
+      (perm != MAP_RDONLY && perm != MAP_PRIVATE && perm != MAP_SHARED))
+    return -E_INVAL;
+  len = ROUNDUP(len, PGSIZE);
+  8030b8:	81 c3 ff 0f 00 00    	add    $0xfff,%ebx
+  8030be:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  8030c4:	89 d9                	mov    %ebx,%ecx
+  8030c6:	89 5d c4             	mov    %ebx,-0x3c(%ebp)
+
+  // First fit: try the start of the region and the end of each
+  // mapping.
+  for (i = -1; i < NMMAP; i++) {
+  8030c9:	bb 4c 57 80 00       	mov    $0x80574c,%ebx
+  8030ce:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+    if (i >= 0 && !mmaps[i].mm_va)
+      continue;
+    va = i < 0 ? MMAPBASE : mmaps[i].mm_va + mmaps[i].mm_len;
+  8030d3:	bf 00 00 00 a0       	mov    $0xa0000000,%edi
+  8030d8:	eb 53                	jmp    80312d <mmap+0xc8>
+  8030da:	bf 00 00 00 a0       	mov    $0xa0000000,%edi
+  8030df:	eb 4c                	jmp    80312d <mmap+0xc8>
+    if (len > MMAPTOP - va)
+      continue;
+    for (j = 0; j < NMMAP; j++)
+  8030e1:	83 c0 01             	add    $0x1,%eax
+  8030e4:	83 f8 10             	cmp    $0x10,%eax
+  8030e7:	0f 84 e7 00 00 00    	je     8031d4 <mmap+0x16f>
+      if (mmaps[j].mm_va && va < mmaps[j].mm_va + mmaps[j].mm_len &&
+  8030ed:	8d 34 80             	lea    (%eax,%eax,4),%esi
+  8030f0:	8b 14 b5 60 57 80 00 	mov    0x805760(,%esi,4),%edx
+  8030f7:	85 d2                	test   %edx,%edx
+  8030f9:	74 e6                	je     8030e1 <mmap+0x7c>
+  8030fb:	89 d1                	mov    %edx,%ecx
+  8030fd:	03 0c b5 64 57 80 00 	add    0x805764(,%esi,4),%ecx
+  803104:	39 cf                	cmp    %ecx,%edi
+  803106:	73 d9                	jae    8030e1 <mmap+0x7c>
+  803108:	39 da                	cmp    %ebx,%edx
+  80310a:	73 d5                	jae    8030e1 <mmap+0x7c>
+  80310c:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80310f:	8b 55 cc             	mov    -0x34(%ebp),%edx
+  803112:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  for (i = -1; i < NMMAP; i++) {
+  803115:	83 c2 01             	add    $0x1,%edx
+  803118:	83 c3 14             	add    $0x14,%ebx
+  80311b:	83 fa 10             	cmp    $0x10,%edx
+  80311e:	74 2b                	je     80314b <mmap+0xe6>
+    if (i >= 0 && !mmaps[i].mm_va)
+  803120:	85 d2                	test   %edx,%edx
+  803122:	78 b6                	js     8030da <mmap+0x75>
+  803124:	8b 3b                	mov    (%ebx),%edi
+  803126:	85 ff                	test   %edi,%edi
+  803128:	74 eb                	je     803115 <mmap+0xb0>
+    va = i < 0 ? MMAPBASE : mmaps[i].mm_va + mmaps[i].mm_len;
+  80312a:	03 7b 04             	add    0x4(%ebx),%edi
+    if (len > MMAPTOP - va)
+  80312d:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  803132:	29 f8                	sub    %edi,%eax
+  803134:	39 c8                	cmp    %ecx,%eax
+  803136:	72 dd                	jb     803115 <mmap+0xb0>
+    for (j = 0; j < NMMAP; j++)
+  803138:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+          mmaps[j].mm_va < va + len)
+  80313b:	8d 34 0f             	lea    (%edi,%ecx,1),%esi
+  80313e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  803141:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  803144:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+  803147:	89 f3                	mov    %esi,%ebx
+  803149:	eb a2                	jmp    8030ed <mmap+0x88>
+        break;
+    if (j == NMMAP)
+      break;
+  }
+  if (i == NMMAP)
+    return -E_NO_MEM;
+  80314b:	c7 45 d4 fc ff ff ff 	movl   $0xfffffffc,-0x2c(%ebp)
+  803152:	eb 75                	jmp    8031c9 <mmap+0x164>
+    ;
+  if (j == NMMAP)
+    return -E_NO_MEM;
+
+  if (_pgfault_handler == 0)
+    set_pgfault_handler(mmap_pgfault);
+  803154:	83 ec 0c             	sub    $0xc,%esp
+  803157:	68 2d 30 80 00       	push   $0x80302d
+  80315c:	e8 f7 03 00 00       	call   803558 <set_pgfault_handler>
+  803161:	83 c4 10             	add    $0x10,%esp
+  803164:	eb 24                	jmp    80318a <mmap+0x125>
+    return -E_INVAL;
+  803166:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  80316d:	eb 5a                	jmp    8031c9 <mmap+0x164>
+  80316f:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  803176:	eb 51                	jmp    8031c9 <mmap+0x164>
+  803178:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  80317f:	eb 48                	jmp    8031c9 <mmap+0x164>
+  if (_pgfault_handler == 0)
+  803181:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  803188:	74 ca                	je     803154 <mmap+0xef>
+
+  mmaps[j].mm_va = va;
+  80318a:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  803191:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  803194:	c1 e2 02             	shl    $0x2,%edx
+  803197:	89 ba 60 57 80 00    	mov    %edi,0x805760(%edx)
+  mmaps[j].mm_len = len;
+  80319d:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  8031a0:	89 b2 64 57 80 00    	mov    %esi,0x805764(%edx)
+  mmaps[j].mm_fd = fdnum;
+  8031a6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8031a9:	89 b2 68 57 80 00    	mov    %esi,0x805768(%edx)
+  mmaps[j].mm_offset = offset;
+  8031af:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8031b2:	89 b2 6c 57 80 00    	mov    %esi,0x80576c(%edx)
+  mmaps[j].mm_perm = perm;
+  8031b8:	01 d8                	add    %ebx,%eax
+  8031ba:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  8031bd:	89 1c 85 70 57 80 00 	mov    %ebx,0x805770(,%eax,4)
+  *addr = (void *) va;
+  8031c4:	8b 45 18             	mov    0x18(%ebp),%eax
+  8031c7:	89 38                	mov    %edi,(%eax)
+  return 0;
+}
+  8031c9:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8031cc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8031cf:	5b                   	pop    %ebx
+  8031d0:	5e                   	pop    %esi
+  8031d1:	5f                   	pop    %edi
+  8031d2:	5d                   	pop    %ebp
+  8031d3:	c3                   	ret
+  if (i == NMMAP)
+  8031d4:	b8 60 57 80 00       	mov    $0x805760,%eax
+  for (j = 0; j < NMMAP && mmaps[j].mm_va; j++)
+  8031d9:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+  8031dc:	83 c0 14             	add    $0x14,%eax
+  8031df:	83 78 ec 00          	cmpl   $0x0,-0x14(%eax)
+  8031e3:	74 9c                	je     803181 <mmap+0x11c>
+  8031e5:	83 c3 01             	add    $0x1,%ebx
+  8031e8:	83 fb 10             	cmp    $0x10,%ebx
+  8031eb:	75 ef                	jne    8031dc <mmap+0x177>
+    return -E_NO_MEM;
+  8031ed:	c7 45 d4 fc ff ff ff 	movl   $0xfffffffc,-0x2c(%ebp)
+  8031f4:	eb d3                	jmp    8031c9 <mmap+0x164>
+
+008031f6 <msync>:
+// nothing for other kinds of mapping.
+//
+// Returns 0 on success, < 0 on error.
+int
+msync(void *addr)
+{
+  8031f6:	55                   	push   %ebp
+  8031f7:	89 e5                	mov    %esp,%ebp
+  8031f9:	57                   	push   %edi
+  8031fa:	56                   	push   %esi
+  8031fb:	53                   	push   %ebx
+  8031fc:	81 ec ac 00 00 00    	sub    $0xac,%esp
+  struct Stat st;
+  off_t saved, off;
+  uintptr_t va;
+  int n, r;
+
+  if ((m = mmap_find((uintptr_t) addr)) == NULL)
+  803202:	8b 45 08             	mov    0x8(%ebp),%eax
+  803205:	e8 c6 fb ff ff       	call   802dd0 <mmap_find>
+  80320a:	85 c0                	test   %eax,%eax
+  80320c:	0f 84 58 01 00 00    	je     80336a <msync+0x174>
+  803212:	89 c7                	mov    %eax,%edi
+    return -E_INVAL;
+  if (m->mm_perm != MAP_SHARED)
+    return 0;
+  803214:	bb 00 00 00 00       	mov    $0x0,%ebx
+  if (m->mm_perm != MAP_SHARED)
+  803219:	83 78 10 02          	cmpl   $0x2,0x10(%eax)
+  80321d:	74 0a                	je     803229 <msync+0x33>
+                          PTE_P | PTE_U | PTE_W)) < 0)
+      break;
+  }
+  fd->fd_offset = saved;
+  return r < 0 ? r : 0;
+}
+  80321f:	89 d8                	mov    %ebx,%eax
+  803221:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803224:	5b                   	pop    %ebx
+  803225:	5e                   	pop    %esi
+  803226:	5f                   	pop    %edi
+  803227:	5d                   	pop    %ebp
+  803228:	c3                   	ret
+  if ((r = fd_lookup(m->mm_fd, &fd)) < 0 || (r = fstat(m->mm_fd, &st)) < 0)
+  803229:	83 ec 08             	sub    $0x8,%esp
+  80322c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80322f:	50                   	push   %eax
+  803230:	ff 77 08             	push   0x8(%edi)
+  803233:	e8 75 e3 ff ff       	call   8015ad <fd_lookup>
+  803238:	89 c3                	mov    %eax,%ebx
+  80323a:	83 c4 10             	add    $0x10,%esp
+  80323d:	85 c0                	test   %eax,%eax
+  80323f:	78 de                	js     80321f <msync+0x29>
+  803241:	83 ec 08             	sub    $0x8,%esp
+  803244:	8d 85 58 ff ff ff    	lea    -0xa8(%ebp),%eax
+  80324a:	50                   	push   %eax
+  80324b:	ff 77 08             	push   0x8(%edi)
+  80324e:	e8 fd e7 ff ff       	call   801a50 <fstat>
+  803253:	89 c3                	mov    %eax,%ebx
+  803255:	83 c4 10             	add    $0x10,%esp
+  803258:	85 c0                	test   %eax,%eax
+  80325a:	78 c3                	js     80321f <msync+0x29>
+  saved = fd->fd_offset;
+  80325c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80325f:	8b 40 04             	mov    0x4(%eax),%eax
+  803262:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%ebp)
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE) {
+  803268:	8b 37                	mov    (%edi),%esi
+  80326a:	eb 29                	jmp    803295 <msync+0x9f>
+    if ((r = sys_page_map(0, (void *) va, 0, (void *) va,
+  80326c:	83 ec 0c             	sub    $0xc,%esp
+  80326f:	6a 07                	push   $0x7
+  803271:	8b 85 50 ff ff ff    	mov    -0xb0(%ebp),%eax
+  803277:	50                   	push   %eax
+  803278:	6a 00                	push   $0x0
+  80327a:	50                   	push   %eax
+  80327b:	6a 00                	push   $0x0
+  80327d:	e8 11 da ff ff       	call   800c93 <sys_page_map>
+  803282:	89 c3                	mov    %eax,%ebx
+  803284:	83 c4 20             	add    $0x20,%esp
+  803287:	85 c0                	test   %eax,%eax
+  803289:	0f 88 c0 00 00 00    	js     80334f <msync+0x159>
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE) {
+  80328f:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  803295:	8b 07                	mov    (%edi),%eax
+  803297:	89 85 54 ff ff ff    	mov    %eax,-0xac(%ebp)
+  80329d:	03 47 04             	add    0x4(%edi),%eax
+  8032a0:	39 c6                	cmp    %eax,%esi
+  8032a2:	0f 83 a7 00 00 00    	jae    80334f <msync+0x159>
+    if (!va_mapped(va) || !(uvpt[PGNUM(va)] & PTE_D))
+  8032a8:	89 f0                	mov    %esi,%eax
+  8032aa:	e8 63 fb ff ff       	call   802e12 <va_mapped>
+  8032af:	84 c0                	test   %al,%al
+  8032b1:	74 dc                	je     80328f <msync+0x99>
+  8032b3:	89 f0                	mov    %esi,%eax
+  8032b5:	c1 e8 0c             	shr    $0xc,%eax
+  8032b8:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8032bf:	a8 40                	test   $0x40,%al
+  8032c1:	74 cc                	je     80328f <msync+0x99>
+    off = m->mm_offset + (va - m->mm_va);
+  8032c3:	8b 47 0c             	mov    0xc(%edi),%eax
+  8032c6:	8b 8d 54 ff ff ff    	mov    -0xac(%ebp),%ecx
+  8032cc:	29 c8                	sub    %ecx,%eax
+  8032ce:	01 f0                	add    %esi,%eax
+    if (off >= st.st_size)
+  8032d0:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8032d3:	39 c2                	cmp    %eax,%edx
+  8032d5:	7e 78                	jle    80334f <msync+0x159>
+    n = MIN(PGSIZE, st.st_size - off);
+  8032d7:	29 c2                	sub    %eax,%edx
+  8032d9:	89 d1                	mov    %edx,%ecx
+  8032db:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8032e0:	39 d1                	cmp    %edx,%ecx
+  8032e2:	0f 4e d1             	cmovle %ecx,%edx
+  8032e5:	89 95 54 ff ff ff    	mov    %edx,-0xac(%ebp)
+    if ((r = seek(m->mm_fd, off)) < 0 ||
+  8032eb:	83 ec 08             	sub    $0x8,%esp
+  8032ee:	50                   	push   %eax
+  8032ef:	ff 77 08             	push   0x8(%edi)
+  8032f2:	e8 b1 e6 ff ff       	call   8019a8 <seek>
+  8032f7:	89 c3                	mov    %eax,%ebx
+  8032f9:	83 c4 10             	add    $0x10,%esp
+  8032fc:	85 c0                	test   %eax,%eax
+  8032fe:	78 4f                	js     80334f <msync+0x159>
+        (r = write(m->mm_fd, (void *) va, n)) < 0)
+  803300:	89 b5 50 ff ff ff    	mov    %esi,-0xb0(%ebp)
+  803306:	83 ec 04             	sub    $0x4,%esp
+  803309:	ff b5 54 ff ff ff    	push   -0xac(%ebp)
+  80330f:	56                   	push   %esi
+  803310:	ff 77 08             	push   0x8(%edi)
+  803313:	e8 0e e6 ff ff       	call   801926 <write>
+  803318:	89 c3                	mov    %eax,%ebx
+    if ((r = seek(m->mm_fd, off)) < 0 ||
+  80331a:	83 c4 10             	add    $0x10,%esp
+  80331d:	85 c0                	test   %eax,%eax
+  80331f:	78 2e                	js     80334f <msync+0x159>
+    if (r < n && (r = write(m->mm_fd, (char *) va + r, n - r)) < 0)
+  803321:	8b 95 54 ff ff ff    	mov    -0xac(%ebp),%edx
+  803327:	39 c2                	cmp    %eax,%edx
+  803329:	0f 8e 3d ff ff ff    	jle    80326c <msync+0x76>
+  80332f:	89 d0                	mov    %edx,%eax
+  803331:	29 d8                	sub    %ebx,%eax
+  803333:	01 f3                	add    %esi,%ebx
+  803335:	83 ec 04             	sub    $0x4,%esp
+  803338:	50                   	push   %eax
+  803339:	53                   	push   %ebx
+  80333a:	ff 77 08             	push   0x8(%edi)
+  80333d:	e8 e4 e5 ff ff       	call   801926 <write>
+  803342:	89 c3                	mov    %eax,%ebx
+  803344:	83 c4 10             	add    $0x10,%esp
+  803347:	85 c0                	test   %eax,%eax
+  803349:	0f 89 1d ff ff ff    	jns    80326c <msync+0x76>
+  fd->fd_offset = saved;
+  80334f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803352:	8b 8d 4c ff ff ff    	mov    -0xb4(%ebp),%ecx
+  803358:	89 48 04             	mov    %ecx,0x4(%eax)
+  return r < 0 ? r : 0;
+  80335b:	85 db                	test   %ebx,%ebx
+  80335d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803362:	0f 4f d8             	cmovg  %eax,%ebx
+  803365:	e9 b5 fe ff ff       	jmp    80321f <msync+0x29>
+    return -E_INVAL;
+  80336a:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80336f:	e9 ab fe ff ff       	jmp    80321f <msync+0x29>
+
+00803374 <munmap>:
+// Remove the mapping at 'addr', writing a MAP_SHARED one back first.
+//
+// Returns 0 on success, < 0 on error.
+int
+munmap(void *addr)
+{
+  803374:	55                   	push   %ebp
+  803375:	89 e5                	mov    %esp,%ebp
+  803377:	56                   	push   %esi
+  803378:	53                   	push   %ebx
+  803379:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct Mmap *m;
+  uintptr_t va;
+  int r;
+
+  if ((m = mmap_find((uintptr_t) addr)) == NULL)
+  80337c:	89 d8                	mov    %ebx,%eax
+  80337e:	e8 4d fa ff ff       	call   802dd0 <mmap_find>
+  803383:	85 c0                	test   %eax,%eax
+  803385:	74 56                	je     8033dd <munmap+0x69>
+  803387:	89 c6                	mov    %eax,%esi
+    return -E_INVAL;
+  if ((r = msync(addr)) < 0)
+  803389:	83 ec 0c             	sub    $0xc,%esp
+  80338c:	53                   	push   %ebx
+  80338d:	e8 64 fe ff ff       	call   8031f6 <msync>
+  803392:	83 c4 10             	add    $0x10,%esp
+  803395:	85 c0                	test   %eax,%eax
+  803397:	78 3d                	js     8033d6 <munmap+0x62>
+    return r;
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE)
+  803399:	8b 1e                	mov    (%esi),%ebx
+  80339b:	eb 06                	jmp    8033a3 <munmap+0x2f>
+  80339d:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8033a3:	8b 46 04             	mov    0x4(%esi),%eax
+  8033a6:	03 06                	add    (%esi),%eax
+  8033a8:	39 c3                	cmp    %eax,%ebx
+  8033aa:	73 1f                	jae    8033cb <munmap+0x57>
+    if (va_mapped(va) && (r = sys_page_unmap(0, (void *) va)) < 0)
+  8033ac:	89 d8                	mov    %ebx,%eax
+  8033ae:	e8 5f fa ff ff       	call   802e12 <va_mapped>
+  8033b3:	84 c0                	test   %al,%al
+  8033b5:	74 e6                	je     80339d <munmap+0x29>
+  8033b7:	83 ec 08             	sub    $0x8,%esp
+  8033ba:	53                   	push   %ebx
+  8033bb:	6a 00                	push   $0x0
+  8033bd:	e8 13 d9 ff ff       	call   800cd5 <sys_page_unmap>
+  8033c2:	83 c4 10             	add    $0x10,%esp
+  8033c5:	85 c0                	test   %eax,%eax
+  8033c7:	79 d4                	jns    80339d <munmap+0x29>
+  8033c9:	eb 0b                	jmp    8033d6 <munmap+0x62>
+      return r;
+  m->mm_va = 0;
+  8033cb:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  return 0;
+  8033d1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8033d6:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8033d9:	5b                   	pop    %ebx
+  8033da:	5e                   	pop    %esi
+  8033db:	5d                   	pop    %ebp
+  8033dc:	c3                   	ret
+    return -E_INVAL;
+  8033dd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8033e2:	eb f2                	jmp    8033d6 <munmap+0x62>
+
+008033e4 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  8033e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033e9:	c3                   	ret
+
+008033ea <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8033ea:	55                   	push   %ebp
+  8033eb:	89 e5                	mov    %esp,%ebp
+  8033ed:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  8033f0:	68 c3 3f 80 00       	push   $0x803fc3
+  8033f5:	ff 75 0c             	push   0xc(%ebp)
+  8033f8:	e8 24 d4 ff ff       	call   800821 <strcpy>
+  return 0;
+}
+  8033fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  803402:	c9                   	leave
+  803403:	c3                   	ret
+
+00803404 <devcons_write>:
+{
+  803404:	55                   	push   %ebp
+  803405:	89 e5                	mov    %esp,%ebp
+  803407:	57                   	push   %edi
+  803408:	56                   	push   %esi
+  803409:	53                   	push   %ebx
+  80340a:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  803410:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  803415:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  80341b:	eb 2e                	jmp    80344b <devcons_write+0x47>
+    m = n - tot;
+  80341d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803420:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  803422:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803427:	39 c3                	cmp    %eax,%ebx
+  803429:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  80342c:	83 ec 04             	sub    $0x4,%esp
+  80342f:	53                   	push   %ebx
+  803430:	89 f0                	mov    %esi,%eax
+  803432:	03 45 0c             	add    0xc(%ebp),%eax
+  803435:	50                   	push   %eax
+  803436:	57                   	push   %edi
+  803437:	e8 6b d5 ff ff       	call   8009a7 <memmove>
+    sys_cputs(buf, m);
+  80343c:	83 c4 08             	add    $0x8,%esp
+  80343f:	53                   	push   %ebx
+  803440:	57                   	push   %edi
+  803441:	e8 0b d7 ff ff       	call   800b51 <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  803446:	01 de                	add    %ebx,%esi
+  803448:	83 c4 10             	add    $0x10,%esp
+  80344b:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80344e:	72 cd                	jb     80341d <devcons_write+0x19>
+}
+  803450:	89 f0                	mov    %esi,%eax
+  803452:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803455:	5b                   	pop    %ebx
+  803456:	5e                   	pop    %esi
+  803457:	5f                   	pop    %edi
+  803458:	5d                   	pop    %ebp
+  803459:	c3                   	ret
+
+0080345a <devcons_read>:
+{
+  80345a:	55                   	push   %ebp
+  80345b:	89 e5                	mov    %esp,%ebp
+  80345d:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  803460:	b8 00 00 00 00       	mov    $0x0,%eax
+  803465:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803469:	75 07                	jne    803472 <devcons_read+0x18>
+  80346b:	eb 1f                	jmp    80348c <devcons_read+0x32>
+    sys_yield();
+  80346d:	e8 7c d7 ff ff       	call   800bee <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  803472:	e8 f8 d6 ff ff       	call   800b6f <sys_cgetc>
+  803477:	85 c0                	test   %eax,%eax
+  803479:	74 f2                	je     80346d <devcons_read+0x13>
+  if (c < 0)
+  80347b:	78 0f                	js     80348c <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  80347d:	83 f8 04             	cmp    $0x4,%eax
+  803480:	74 0c                	je     80348e <devcons_read+0x34>
+  *(char*)vbuf = c;
+  803482:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803485:	88 02                	mov    %al,(%edx)
+  return 1;
+  803487:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80348c:	c9                   	leave
+  80348d:	c3                   	ret
+    return 0;
+  80348e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803493:	eb f7                	jmp    80348c <devcons_read+0x32>
+
+00803495 <cputchar>:
+{
+  803495:	55                   	push   %ebp
+  803496:	89 e5                	mov    %esp,%ebp
+  803498:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  80349b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80349e:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  8034a1:	6a 01                	push   $0x1
+  8034a3:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8034a6:	50                   	push   %eax
+  8034a7:	e8 a5 d6 ff ff       	call   800b51 <sys_cputs>
+}
+  8034ac:	83 c4 10             	add    $0x10,%esp
+  8034af:	c9                   	leave
+  8034b0:	c3                   	ret
+
+008034b1 <getchar>:
+{
+  8034b1:	55                   	push   %ebp
+  8034b2:	89 e5                	mov    %esp,%ebp
+  8034b4:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  8034b7:	6a 01                	push   $0x1
+  8034b9:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8034bc:	50                   	push   %eax
+  8034bd:	6a 00                	push   $0x0
+  8034bf:	e8 94 e3 ff ff       	call   801858 <read>
+  if (r < 0)
+  8034c4:	83 c4 10             	add    $0x10,%esp
+  8034c7:	85 c0                	test   %eax,%eax
+  8034c9:	78 06                	js     8034d1 <getchar+0x20>
+  if (r < 1)
+  8034cb:	74 06                	je     8034d3 <getchar+0x22>
+  return c;
+  8034cd:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8034d1:	c9                   	leave
+  8034d2:	c3                   	ret
+    return -E_EOF;
+  8034d3:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8034d8:	eb f7                	jmp    8034d1 <getchar+0x20>
+
+008034da <iscons>:
+{
+  8034da:	55                   	push   %ebp
+  8034db:	89 e5                	mov    %esp,%ebp
+  8034dd:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8034e0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8034e3:	50                   	push   %eax
+  8034e4:	ff 75 08             	push   0x8(%ebp)
+  8034e7:	e8 c1 e0 ff ff       	call   8015ad <fd_lookup>
+  8034ec:	83 c4 10             	add    $0x10,%esp
+  8034ef:	85 c0                	test   %eax,%eax
+  8034f1:	78 11                	js     803504 <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  8034f3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8034f6:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  8034fc:	39 10                	cmp    %edx,(%eax)
+  8034fe:	0f 94 c0             	sete   %al
+  803501:	0f b6 c0             	movzbl %al,%eax
+}
+  803504:	c9                   	leave
+  803505:	c3                   	ret
+
+00803506 <opencons>:
+{
+  803506:	55                   	push   %ebp
+  803507:	89 e5                	mov    %esp,%ebp
+  803509:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  80350c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80350f:	50                   	push   %eax
+  803510:	e8 42 e0 ff ff       	call   801557 <fd_alloc>
+  803515:	83 c4 10             	add    $0x10,%esp
+  803518:	85 c0                	test   %eax,%eax
+  80351a:	78 3a                	js     803556 <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80351c:	83 ec 04             	sub    $0x4,%esp
+  80351f:	68 07 04 00 00       	push   $0x407
+  803524:	ff 75 f4             	push   -0xc(%ebp)
+  803527:	6a 00                	push   $0x0
+  803529:	e8 22 d7 ff ff       	call   800c50 <sys_page_alloc>
+  80352e:	83 c4 10             	add    $0x10,%esp
+  803531:	85 c0                	test   %eax,%eax
+  803533:	78 21                	js     803556 <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  803535:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803538:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  80353e:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  803540:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803543:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  80354a:	83 ec 0c             	sub    $0xc,%esp
+  80354d:	50                   	push   %eax
+  80354e:	e8 e0 df ff ff       	call   801533 <fd2num>
+  803553:	83 c4 10             	add    $0x10,%esp
+}
+  803556:	c9                   	leave
+  803557:	c3                   	ret
+
+00803558 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  803558:	55                   	push   %ebp
+  803559:	89 e5                	mov    %esp,%ebp
+  80355b:	53                   	push   %ebx
+  80355c:	83 ec 04             	sub    $0x4,%esp
+  int r;
+
+  if (_pgfault_handler == 0) {
+  80355f:	83 3d 00 70 80 00 00 	cmpl   $0x0,0x807000
+  803566:	74 0d                	je     803575 <set_pgfault_handler+0x1d>
+
+    sys_env_set_pgfault_upcall(id, _pgfault_upcall);
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  803568:	8b 45 08             	mov    0x8(%ebp),%eax
+  80356b:	a3 00 70 80 00       	mov    %eax,0x807000
+}
+  803570:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803573:	c9                   	leave
+  803574:	c3                   	ret
+    envid_t id = sys_getenvid();
+  803575:	e8 55 d6 ff ff       	call   800bcf <sys_getenvid>
+  80357a:	89 c3                	mov    %eax,%ebx
+    sys_page_alloc(id, (void *) (UXSTACKTOP - PGSIZE), (PTE_P | PTE_U | PTE_W));
+  80357c:	83 ec 04             	sub    $0x4,%esp
+  80357f:	6a 07                	push   $0x7
+  803581:	68 00 f0 bf ee       	push   $0xeebff000
+  803586:	50                   	push   %eax
+  803587:	e8 c4 d6 ff ff       	call   800c50 <sys_page_alloc>
+    sys_env_set_pgfault_upcall(id, _pgfault_upcall);
+  80358c:	83 c4 08             	add    $0x8,%esp
+  80358f:	68 9f 35 80 00       	push   $0x80359f
+  803594:	53                   	push   %ebx
+  803595:	e8 2b d9 ff ff       	call   800ec5 <sys_env_set_pgfault_upcall>
+  80359a:	83 c4 10             	add    $0x10,%esp
+  80359d:	eb c9                	jmp    803568 <set_pgfault_handler+0x10>
+
+0080359f <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  80359f:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8035a0:	a1 00 70 80 00       	mov    0x807000,%eax
+	call *%eax
+  8035a5:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8035a7:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+  movl 48(%esp), %eax       // move trap time esp to eax
+  8035aa:	8b 44 24 30          	mov    0x30(%esp),%eax
+  subl $4, %eax             // make room for eip on trap time esp
+  8035ae:	83 e8 04             	sub    $0x4,%eax
+  movl %eax, 48(%esp)       // move value to esp
+  8035b1:	89 44 24 30          	mov    %eax,0x30(%esp)
+  movl 40(%esp), %ebx       // move trap time eip to ebx
+  8035b5:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+  movl %ebx, 0(%eax)
+  8035b9:	89 18                	mov    %ebx,(%eax)
+
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+  addl $0x08,%esp
+  8035bb:	83 c4 08             	add    $0x8,%esp
+  popal
+  8035be:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+  addl $4, %esp          // skip tf->eip
+  8035bf:	83 c4 04             	add    $0x4,%esp
+  popf                 // pop stack value into flags register
+  8035c2:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+  popl %esp
+  8035c3:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+  ret
+  8035c4:	c3                   	ret
+
+008035c5 <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  8035c5:	55                   	push   %ebp
+  8035c6:	89 e5                	mov    %esp,%ebp
+  8035c8:	57                   	push   %edi
+  8035c9:	56                   	push   %esi
+  8035ca:	53                   	push   %ebx
+  8035cb:	83 ec 14             	sub    $0x14,%esp
+  8035ce:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8035d1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8035d4:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8035d7:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  8035da:	85 c0                	test   %eax,%eax
+  8035dc:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8035e1:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  8035e4:	ff 33                	push   (%ebx)
+  8035e6:	50                   	push   %eax
+  8035e7:	e8 3c d9 ff ff       	call   800f28 <sys_ipc_recv>
+  8035ec:	83 c4 10             	add    $0x10,%esp
+  8035ef:	85 c0                	test   %eax,%eax
+  8035f1:	78 39                	js     80362c <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  8035f3:	85 ff                	test   %edi,%edi
+  8035f5:	74 0a                	je     803601 <ipc_recv_pages+0x3c>
+  8035f7:	a1 a4 58 80 00       	mov    0x8058a4,%eax
+  8035fc:	8b 40 7c             	mov    0x7c(%eax),%eax
+  8035ff:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803601:	85 f6                	test   %esi,%esi
+  803603:	74 0d                	je     803612 <ipc_recv_pages+0x4d>
+  803605:	a1 a4 58 80 00       	mov    0x8058a4,%eax
+  80360a:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  803610:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  803612:	a1 a4 58 80 00       	mov    0x8058a4,%eax
+  803617:	8b 40 74             	mov    0x74(%eax),%eax
+  80361a:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  80361c:	a1 a4 58 80 00       	mov    0x8058a4,%eax
+  803621:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  803624:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803627:	5b                   	pop    %ebx
+  803628:	5e                   	pop    %esi
+  803629:	5f                   	pop    %edi
+  80362a:	5d                   	pop    %ebp
+  80362b:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  80362c:	85 ff                	test   %edi,%edi
+  80362e:	74 06                	je     803636 <ipc_recv_pages+0x71>
+  803630:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  803636:	85 f6                	test   %esi,%esi
+  803638:	74 06                	je     803640 <ipc_recv_pages+0x7b>
+  80363a:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  803640:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  803646:	eb dc                	jmp    803624 <ipc_recv_pages+0x5f>
+
+00803648 <ipc_recv>:
+{
+  803648:	55                   	push   %ebp
+  803649:	89 e5                	mov    %esp,%ebp
+  80364b:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  80364e:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  803655:	ff 75 10             	push   0x10(%ebp)
+  803658:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80365b:	50                   	push   %eax
+  80365c:	ff 75 0c             	push   0xc(%ebp)
+  80365f:	ff 75 08             	push   0x8(%ebp)
+  803662:	e8 5e ff ff ff       	call   8035c5 <ipc_recv_pages>
+}
+  803667:	c9                   	leave
+  803668:	c3                   	ret
+
+00803669 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  803669:	55                   	push   %ebp
+  80366a:	89 e5                	mov    %esp,%ebp
+  80366c:	57                   	push   %edi
+  80366d:	56                   	push   %esi
+  80366e:	53                   	push   %ebx
+  80366f:	83 ec 0c             	sub    $0xc,%esp
+  803672:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803675:	8b 75 0c             	mov    0xc(%ebp),%esi
+  803678:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  80367b:	89 c3                	mov    %eax,%ebx
+  80367d:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  803683:	85 c0                	test   %eax,%eax
+  803685:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80368a:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  80368d:	83 ec 0c             	sub    $0xc,%esp
+  803690:	ff 75 14             	push   0x14(%ebp)
+  803693:	ff 75 18             	push   0x18(%ebp)
+  803696:	53                   	push   %ebx
+  803697:	56                   	push   %esi
+  803698:	57                   	push   %edi
+  803699:	e8 69 d8 ff ff       	call   800f07 <sys_ipc_try_send>
+  80369e:	83 c4 20             	add    $0x20,%esp
+  8036a1:	85 c0                	test   %eax,%eax
+  8036a3:	79 1e                	jns    8036c3 <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  8036a5:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8036a8:	75 07                	jne    8036b1 <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  8036aa:	e8 3f d5 ff ff       	call   800bee <sys_yield>
+  8036af:	eb dc                	jmp    80368d <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  8036b1:	50                   	push   %eax
+  8036b2:	68 cf 3f 80 00       	push   $0x803fcf
+  8036b7:	6a 5c                	push   $0x5c
+  8036b9:	68 dc 3f 80 00       	push   $0x803fdc
+  8036be:	e8 95 ca ff ff       	call   800158 <_panic>
+  }
+}
+  8036c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8036c6:	5b                   	pop    %ebx
+  8036c7:	5e                   	pop    %esi
+  8036c8:	5f                   	pop    %edi
+  8036c9:	5d                   	pop    %ebp
+  8036ca:	c3                   	ret
+
+008036cb <ipc_send>:
+{
+  8036cb:	55                   	push   %ebp
+  8036cc:	89 e5                	mov    %esp,%ebp
+  8036ce:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  8036d1:	ff 75 14             	push   0x14(%ebp)
+  8036d4:	6a 01                	push   $0x1
+  8036d6:	ff 75 10             	push   0x10(%ebp)
+  8036d9:	ff 75 0c             	push   0xc(%ebp)
+  8036dc:	ff 75 08             	push   0x8(%ebp)
+  8036df:	e8 85 ff ff ff       	call   803669 <ipc_send_pages>
+}
+  8036e4:	83 c4 20             	add    $0x20,%esp
+  8036e7:	c9                   	leave
+  8036e8:	c3                   	ret
+
+008036e9 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8036e9:	55                   	push   %ebp
+  8036ea:	89 e5                	mov    %esp,%ebp
+  8036ec:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  8036ef:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  8036f4:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8036f7:	c1 e0 04             	shl    $0x4,%eax
+  8036fa:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8036ff:	8b 40 50             	mov    0x50(%eax),%eax
+  803702:	39 c8                	cmp    %ecx,%eax
+  803704:	74 12                	je     803718 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  803706:	83 c2 01             	add    $0x1,%edx
+  803709:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  80370f:	75 e3                	jne    8036f4 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  803711:	b8 00 00 00 00       	mov    $0x0,%eax
+  803716:	eb 0e                	jmp    803726 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  803718:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80371b:	c1 e0 04             	shl    $0x4,%eax
+  80371e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803723:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803726:	5d                   	pop    %ebp
+  803727:	c3                   	ret
+
+00803728 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803728:	55                   	push   %ebp
+  803729:	89 e5                	mov    %esp,%ebp
+  80372b:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  80372e:	89 c2                	mov    %eax,%edx
+  803730:	c1 ea 16             	shr    $0x16,%edx
+  803733:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  80373a:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  80373f:	f6 c1 01             	test   $0x1,%cl
+  803742:	74 1c                	je     803760 <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  803744:	c1 e8 0c             	shr    $0xc,%eax
+  803747:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  80374e:	a8 01                	test   $0x1,%al
+  803750:	74 0e                	je     803760 <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  803752:	c1 e8 0c             	shr    $0xc,%eax
+  803755:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  80375c:	ef 
+  80375d:	0f b7 d2             	movzwl %dx,%edx
+}
+  803760:	89 d0                	mov    %edx,%eax
+  803762:	5d                   	pop    %ebp
+  803763:	c3                   	ret
+
+00803764 <udivmod>:
+  803764:	55                   	push   %ebp
+  803765:	57                   	push   %edi
+  803766:	56                   	push   %esi
+  803767:	53                   	push   %ebx
+  803768:	83 ec 14             	sub    $0x14,%esp
+  80376b:	8b 74 24 28          	mov    0x28(%esp),%esi
+  80376f:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  803773:	89 fb                	mov    %edi,%ebx
+  803775:	09 f3                	or     %esi,%ebx
+  803777:	0f 84 88 00 00 00    	je     803805 <udivmod+0xa1>
+  80377d:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803782:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  803789:	00 
+  80378a:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  803791:	00 
+  803792:	89 cd                	mov    %ecx,%ebp
+  803794:	89 34 24             	mov    %esi,(%esp)
+  803797:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  80379b:	eb 08                	jmp    8037a5 <udivmod+0x41>
+  80379d:	83 ed 01             	sub    $0x1,%ebp
+  8037a0:	83 fd ff             	cmp    $0xffffffff,%ebp
+  8037a3:	74 6c                	je     803811 <udivmod+0xad>
+  8037a5:	89 c3                	mov    %eax,%ebx
+  8037a7:	89 d6                	mov    %edx,%esi
+  8037a9:	89 e9                	mov    %ebp,%ecx
+  8037ab:	0f ad f3             	shrd   %cl,%esi,%ebx
+  8037ae:	d3 ee                	shr    %cl,%esi
+  8037b0:	f6 c1 20             	test   $0x20,%cl
+  8037b3:	74 04                	je     8037b9 <udivmod+0x55>
+  8037b5:	89 f3                	mov    %esi,%ebx
+  8037b7:	31 f6                	xor    %esi,%esi
+  8037b9:	8b 3c 24             	mov    (%esp),%edi
+  8037bc:	39 fb                	cmp    %edi,%ebx
+  8037be:	89 f7                	mov    %esi,%edi
+  8037c0:	8b 1c 24             	mov    (%esp),%ebx
+  8037c3:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8037c7:	19 f7                	sbb    %esi,%edi
+  8037c9:	72 d2                	jb     80379d <udivmod+0x39>
+  8037cb:	89 f7                	mov    %esi,%edi
+  8037cd:	89 de                	mov    %ebx,%esi
+  8037cf:	89 e9                	mov    %ebp,%ecx
+  8037d1:	0f a5 f7             	shld   %cl,%esi,%edi
+  8037d4:	d3 e6                	shl    %cl,%esi
+  8037d6:	f6 c1 20             	test   $0x20,%cl
+  8037d9:	74 04                	je     8037df <udivmod+0x7b>
+  8037db:	89 f7                	mov    %esi,%edi
+  8037dd:	31 f6                	xor    %esi,%esi
+  8037df:	29 f0                	sub    %esi,%eax
+  8037e1:	19 fa                	sbb    %edi,%edx
+  8037e3:	be 01 00 00 00       	mov    $0x1,%esi
+  8037e8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037ed:	0f a5 f7             	shld   %cl,%esi,%edi
+  8037f0:	d3 e6                	shl    %cl,%esi
+  8037f2:	f6 c1 20             	test   $0x20,%cl
+  8037f5:	74 04                	je     8037fb <udivmod+0x97>
+  8037f7:	89 f7                	mov    %esi,%edi
+  8037f9:	31 f6                	xor    %esi,%esi
+  8037fb:	09 74 24 08          	or     %esi,0x8(%esp)
+  8037ff:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  803803:	eb 98                	jmp    80379d <udivmod+0x39>
+  803805:	89 f0                	mov    %esi,%eax
+  803807:	89 fa                	mov    %edi,%edx
+  803809:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80380d:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  803811:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  803815:	89 01                	mov    %eax,(%ecx)
+  803817:	89 51 04             	mov    %edx,0x4(%ecx)
+  80381a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80381e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803822:	83 c4 14             	add    $0x14,%esp
+  803825:	5b                   	pop    %ebx
+  803826:	5e                   	pop    %esi
+  803827:	5f                   	pop    %edi
+  803828:	5d                   	pop    %ebp
+  803829:	c3                   	ret
+
+0080382a <__udivdi3>:
+  80382a:	83 ec 18             	sub    $0x18,%esp
+  80382d:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803831:	50                   	push   %eax
+  803832:	ff 74 24 2c          	push   0x2c(%esp)
+  803836:	ff 74 24 2c          	push   0x2c(%esp)
+  80383a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80383e:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803842:	e8 1d ff ff ff       	call   803764 <udivmod>
+  803847:	83 c4 24             	add    $0x24,%esp
+  80384a:	c3                   	ret
+
+0080384b <__umoddi3>:
+  80384b:	83 ec 18             	sub    $0x18,%esp
+  80384e:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803852:	50                   	push   %eax
+  803853:	ff 74 24 2c          	push   0x2c(%esp)
+  803857:	ff 74 24 2c          	push   0x2c(%esp)
+  80385b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80385f:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803863:	e8 fc fe ff ff       	call   803764 <udivmod>
+  803868:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80386c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803870:	83 c4 24             	add    $0x24,%esp
+  803873:	c3                   	ret
+
+00803874 <__divdi3>:
+  803874:	56                   	push   %esi
+  803875:	53                   	push   %ebx
+  803876:	83 ec 14             	sub    $0x14,%esp
+  803879:	8b 44 24 20          	mov    0x20(%esp),%eax
+  80387d:	8b 54 24 24          	mov    0x24(%esp),%edx
+  803881:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  803885:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  803889:	85 d2                	test   %edx,%edx
+  80388b:	78 18                	js     8038a5 <__divdi3+0x31>
+  80388d:	85 db                	test   %ebx,%ebx
+  80388f:	78 3e                	js     8038cf <__divdi3+0x5b>
+  803891:	83 ec 04             	sub    $0x4,%esp
+  803894:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803898:	56                   	push   %esi
+  803899:	53                   	push   %ebx
+  80389a:	51                   	push   %ecx
+  80389b:	e8 c4 fe ff ff       	call   803764 <udivmod>
+  8038a0:	83 c4 10             	add    $0x10,%esp
+  8038a3:	eb 24                	jmp    8038c9 <__divdi3+0x55>
+  8038a5:	f7 d8                	neg    %eax
+  8038a7:	83 d2 00             	adc    $0x0,%edx
+  8038aa:	f7 da                	neg    %edx
+  8038ac:	85 db                	test   %ebx,%ebx
+  8038ae:	78 3a                	js     8038ea <__divdi3+0x76>
+  8038b0:	83 ec 04             	sub    $0x4,%esp
+  8038b3:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8038b7:	56                   	push   %esi
+  8038b8:	53                   	push   %ebx
+  8038b9:	51                   	push   %ecx
+  8038ba:	e8 a5 fe ff ff       	call   803764 <udivmod>
+  8038bf:	83 c4 10             	add    $0x10,%esp
+  8038c2:	f7 d8                	neg    %eax
+  8038c4:	83 d2 00             	adc    $0x0,%edx
+  8038c7:	f7 da                	neg    %edx
+  8038c9:	83 c4 14             	add    $0x14,%esp
+  8038cc:	5b                   	pop    %ebx
+  8038cd:	5e                   	pop    %esi
+  8038ce:	c3                   	ret
+  8038cf:	83 ec 04             	sub    $0x4,%esp
+  8038d2:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8038d6:	56                   	push   %esi
+  8038d7:	f7 d9                	neg    %ecx
+  8038d9:	83 d3 00             	adc    $0x0,%ebx
+  8038dc:	f7 db                	neg    %ebx
+  8038de:	53                   	push   %ebx
+  8038df:	51                   	push   %ecx
+  8038e0:	e8 7f fe ff ff       	call   803764 <udivmod>
+  8038e5:	83 c4 10             	add    $0x10,%esp
+  8038e8:	eb d8                	jmp    8038c2 <__divdi3+0x4e>
+  8038ea:	83 ec 04             	sub    $0x4,%esp
+  8038ed:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8038f1:	56                   	push   %esi
+  8038f2:	f7 d9                	neg    %ecx
+  8038f4:	83 d3 00             	adc    $0x0,%ebx
+  8038f7:	f7 db                	neg    %ebx
+  8038f9:	53                   	push   %ebx
+  8038fa:	51                   	push   %ecx
+  8038fb:	e8 64 fe ff ff       	call   803764 <udivmod>
+  803900:	83 c4 10             	add    $0x10,%esp
+  803903:	eb c4                	jmp    8038c9 <__divdi3+0x55>
+
+00803905 <__moddi3>:
+  803905:	55                   	push   %ebp
+  803906:	57                   	push   %edi
+  803907:	56                   	push   %esi
+  803908:	53                   	push   %ebx
+  803909:	83 ec 24             	sub    $0x24,%esp
+  80390c:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803910:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803914:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  803918:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  80391c:	85 d2                	test   %edx,%edx
+  80391e:	78 3b                	js     80395b <__moddi3+0x56>
+  803920:	83 ec 04             	sub    $0x4,%esp
+  803923:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803927:	56                   	push   %esi
+  803928:	89 ce                	mov    %ecx,%esi
+  80392a:	f7 de                	neg    %esi
+  80392c:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803930:	89 de                	mov    %ebx,%esi
+  803932:	83 d6 00             	adc    $0x0,%esi
+  803935:	f7 de                	neg    %esi
+  803937:	89 74 24 14          	mov    %esi,0x14(%esp)
+  80393b:	8b 74 24 08          	mov    0x8(%esp),%esi
+  80393f:	0f 48 f1             	cmovs  %ecx,%esi
+  803942:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  803947:	53                   	push   %ebx
+  803948:	56                   	push   %esi
+  803949:	e8 16 fe ff ff       	call   803764 <udivmod>
+  80394e:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803952:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803956:	83 c4 10             	add    $0x10,%esp
+  803959:	eb 47                	jmp    8039a2 <__moddi3+0x9d>
+  80395b:	f7 d8                	neg    %eax
+  80395d:	83 d2 00             	adc    $0x0,%edx
+  803960:	f7 da                	neg    %edx
+  803962:	83 ec 04             	sub    $0x4,%esp
+  803965:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803969:	56                   	push   %esi
+  80396a:	89 cf                	mov    %ecx,%edi
+  80396c:	f7 df                	neg    %edi
+  80396e:	89 de                	mov    %ebx,%esi
+  803970:	83 d6 00             	adc    $0x0,%esi
+  803973:	f7 de                	neg    %esi
+  803975:	0f 49 cf             	cmovns %edi,%ecx
+  803978:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  80397c:	0f 49 de             	cmovns %esi,%ebx
+  80397f:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  803983:	ff 74 24 0c          	push   0xc(%esp)
+  803987:	ff 74 24 0c          	push   0xc(%esp)
+  80398b:	e8 d4 fd ff ff       	call   803764 <udivmod>
+  803990:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803994:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803998:	f7 d8                	neg    %eax
+  80399a:	83 d2 00             	adc    $0x0,%edx
+  80399d:	f7 da                	neg    %edx
+  80399f:	83 c4 10             	add    $0x10,%esp
+  8039a2:	83 c4 24             	add    $0x24,%esp
+  8039a5:	5b                   	pop    %ebx
+  8039a6:	5e                   	pop    %esi
+  8039a7:	5f                   	pop    %edi
+  8039a8:	5d                   	pop    %ebp
+  8039a9:	c3                   	ret
@@ -0,0 +1,6416 @@
+
+obj/user/testbss.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 ab 00 00 00       	call   8000dc <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+uint32_t bigarray[ARRAYSIZE];
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	83 ec 14             	sub    $0x14,%esp
+  int i;
+
+  cprintf("Making sure bss works right...\n");
+  800039:	68 00 2f 80 00       	push   $0x802f00
+  80003e:	e8 e1 01 00 00       	call   800224 <cprintf>
+  800043:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < ARRAYSIZE; i++)
+  800046:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (bigarray[i] != 0)
+  80004b:	83 3c 85 60 57 80 00 	cmpl   $0x0,0x805760(,%eax,4)
+  800052:	00 
+  800053:	75 63                	jne    8000b8 <umain+0x85>
+  for (i = 0; i < ARRAYSIZE; i++)
+  800055:	83 c0 01             	add    $0x1,%eax
+  800058:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80005d:	75 ec                	jne    80004b <umain+0x18>
+      panic("bigarray[%d] isn't cleared!\n", i);
+  for (i = 0; i < ARRAYSIZE; i++)
+  80005f:	b8 00 00 00 00       	mov    $0x0,%eax
+    bigarray[i] = i;
+  800064:	89 04 85 60 57 80 00 	mov    %eax,0x805760(,%eax,4)
+  for (i = 0; i < ARRAYSIZE; i++)
+  80006b:	83 c0 01             	add    $0x1,%eax
+  80006e:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  800073:	75 ef                	jne    800064 <umain+0x31>
+  for (i = 0; i < ARRAYSIZE; i++)
+  800075:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (bigarray[i] != i)
+  80007a:	39 04 85 60 57 80 00 	cmp    %eax,0x805760(,%eax,4)
+  800081:	75 47                	jne    8000ca <umain+0x97>
+  for (i = 0; i < ARRAYSIZE; i++)
+  800083:	83 c0 01             	add    $0x1,%eax
+  800086:	3d 00 00 10 00       	cmp    $0x100000,%eax
+  80008b:	75 ed                	jne    80007a <umain+0x47>
+      panic("bigarray[%d] didn't hold its value!\n", i);
+
+  cprintf("Yes, good.  Now doing a wild write off the end...\n");
+  80008d:	83 ec 0c             	sub    $0xc,%esp
+  800090:	68 48 2f 80 00       	push   $0x802f48
+  800095:	e8 8a 01 00 00       	call   800224 <cprintf>
+  bigarray[ARRAYSIZE+1024] = 0;
+  80009a:	c7 05 60 67 c0 00 00 	movl   $0x0,0xc06760
+  8000a1:	00 00 00 
+  panic("SHOULD HAVE TRAPPED!!!");
+  8000a4:	83 c4 0c             	add    $0xc,%esp
+  8000a7:	68 a7 2f 80 00       	push   $0x802fa7
+  8000ac:	6a 1a                	push   $0x1a
+  8000ae:	68 98 2f 80 00       	push   $0x802f98
+  8000b3:	e8 91 00 00 00       	call   800149 <_panic>
+      panic("bigarray[%d] isn't cleared!\n", i);
+  8000b8:	50                   	push   %eax
+  8000b9:	68 7b 2f 80 00       	push   $0x802f7b
+  8000be:	6a 11                	push   $0x11
+  8000c0:	68 98 2f 80 00       	push   $0x802f98
+  8000c5:	e8 7f 00 00 00       	call   800149 <_panic>
+      panic("bigarray[%d] didn't hold its value!\n", i);
+  8000ca:	50                   	push   %eax
+  8000cb:	68 20 2f 80 00       	push   $0x802f20
+  8000d0:	6a 16                	push   $0x16
+  8000d2:	68 98 2f 80 00       	push   $0x802f98
+  8000d7:	e8 6d 00 00 00       	call   800149 <_panic>
+
+008000dc <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8000dc:	55                   	push   %ebp
+  8000dd:	89 e5                	mov    %esp,%ebp
+  8000df:	56                   	push   %esi
+  8000e0:	53                   	push   %ebx
+  8000e1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8000e4:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  8000e7:	c7 05 60 57 c0 00 00 	movl   $0x0,0xc05760
+  8000ee:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  8000f1:	e8 ca 0a 00 00       	call   800bc0 <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  8000f6:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8000fb:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8000fe:	c1 e0 04             	shl    $0x4,%eax
+  800101:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800106:	a3 60 57 c0 00       	mov    %eax,0xc05760
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  80010b:	85 db                	test   %ebx,%ebx
+  80010d:	7e 07                	jle    800116 <libmain+0x3a>
+    binaryname = argv[0];
+  80010f:	8b 06                	mov    (%esi),%eax
+  800111:	a3 00 40 80 00       	mov    %eax,0x804000
+
+  // call user main routine
+  umain(argc, argv);
+  800116:	83 ec 08             	sub    $0x8,%esp
+  800119:	56                   	push   %esi
+  80011a:	53                   	push   %ebx
+  80011b:	e8 13 ff ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  800120:	e8 0a 00 00 00       	call   80012f <exit>
+}
+  800125:	83 c4 10             	add    $0x10,%esp
+  800128:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80012b:	5b                   	pop    %ebx
+  80012c:	5e                   	pop    %esi
+  80012d:	5d                   	pop    %ebp
+  80012e:	c3                   	ret
+
+0080012f <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80012f:	55                   	push   %ebp
+  800130:	89 e5                	mov    %esp,%ebp
+  800132:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  800135:	e8 80 11 00 00       	call   8012ba <close_all>
+  sys_env_destroy(0);
+  80013a:	83 ec 0c             	sub    $0xc,%esp
+  80013d:	6a 00                	push   $0x0
+  80013f:	e8 3b 0a 00 00       	call   800b7f <sys_env_destroy>
+}
+  800144:	83 c4 10             	add    $0x10,%esp
+  800147:	c9                   	leave
+  800148:	c3                   	ret
+
+00800149 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800149:	55                   	push   %ebp
+  80014a:	89 e5                	mov    %esp,%ebp
+  80014c:	56                   	push   %esi
+  80014d:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  80014e:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  800151:	8b 35 00 40 80 00    	mov    0x804000,%esi
+  800157:	e8 64 0a 00 00       	call   800bc0 <sys_getenvid>
+  80015c:	83 ec 0c             	sub    $0xc,%esp
+  80015f:	ff 75 0c             	push   0xc(%ebp)
+  800162:	ff 75 08             	push   0x8(%ebp)
+  800165:	56                   	push   %esi
+  800166:	50                   	push   %eax
+  800167:	68 c8 2f 80 00       	push   $0x802fc8
+  80016c:	e8 b3 00 00 00       	call   800224 <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  800171:	83 c4 18             	add    $0x18,%esp
+  800174:	53                   	push   %ebx
+  800175:	ff 75 10             	push   0x10(%ebp)
+  800178:	e8 56 00 00 00       	call   8001d3 <vcprintf>
+  cprintf("\n");
+  80017d:	c7 04 24 96 2f 80 00 	movl   $0x802f96,(%esp)
+  800184:	e8 9b 00 00 00       	call   800224 <cprintf>
+  800189:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  80018c:	cc                   	int3
+  while (1)
+  80018d:	eb fd                	jmp    80018c <_panic+0x43>
+
+0080018f <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80018f:	55                   	push   %ebp
+  800190:	89 e5                	mov    %esp,%ebp
+  800192:	53                   	push   %ebx
+  800193:	83 ec 04             	sub    $0x4,%esp
+  800196:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  800199:	8b 13                	mov    (%ebx),%edx
+  80019b:	8d 42 01             	lea    0x1(%edx),%eax
+  80019e:	89 03                	mov    %eax,(%ebx)
+  8001a0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8001a3:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  8001a7:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8001ac:	74 09                	je     8001b7 <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  8001ae:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8001b2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8001b5:	c9                   	leave
+  8001b6:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  8001b7:	83 ec 08             	sub    $0x8,%esp
+  8001ba:	68 ff 00 00 00       	push   $0xff
+  8001bf:	8d 43 08             	lea    0x8(%ebx),%eax
+  8001c2:	50                   	push   %eax
+  8001c3:	e8 7a 09 00 00       	call   800b42 <sys_cputs>
+    b->idx = 0;
+  8001c8:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8001ce:	83 c4 10             	add    $0x10,%esp
+  8001d1:	eb db                	jmp    8001ae <putch+0x1f>
+
+008001d3 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8001d3:	55                   	push   %ebp
+  8001d4:	89 e5                	mov    %esp,%ebp
+  8001d6:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  8001dc:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8001e3:	00 00 00 
+  b.cnt = 0;
+  8001e6:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8001ed:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  8001f0:	ff 75 0c             	push   0xc(%ebp)
+  8001f3:	ff 75 08             	push   0x8(%ebp)
+  8001f6:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8001fc:	50                   	push   %eax
+  8001fd:	68 8f 01 80 00       	push   $0x80018f
+  800202:	e8 14 01 00 00       	call   80031b <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  800207:	83 c4 08             	add    $0x8,%esp
+  80020a:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800210:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800216:	50                   	push   %eax
+  800217:	e8 26 09 00 00       	call   800b42 <sys_cputs>
+
+  return b.cnt;
+}
+  80021c:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800222:	c9                   	leave
+  800223:	c3                   	ret
+
+00800224 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800224:	55                   	push   %ebp
+  800225:	89 e5                	mov    %esp,%ebp
+  800227:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  80022a:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  80022d:	50                   	push   %eax
+  80022e:	ff 75 08             	push   0x8(%ebp)
+  800231:	e8 9d ff ff ff       	call   8001d3 <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  800236:	c9                   	leave
+  800237:	c3                   	ret
+
+00800238 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  800238:	55                   	push   %ebp
+  800239:	89 e5                	mov    %esp,%ebp
+  80023b:	57                   	push   %edi
+  80023c:	56                   	push   %esi
+  80023d:	53                   	push   %ebx
+  80023e:	83 ec 1c             	sub    $0x1c,%esp
+  800241:	89 c7                	mov    %eax,%edi
+  800243:	89 d6                	mov    %edx,%esi
+  800245:	8b 45 08             	mov    0x8(%ebp),%eax
+  800248:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80024b:	89 d1                	mov    %edx,%ecx
+  80024d:	89 c2                	mov    %eax,%edx
+  80024f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800252:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800255:	8b 45 10             	mov    0x10(%ebp),%eax
+  800258:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  80025b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80025e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800265:	39 c2                	cmp    %eax,%edx
+  800267:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80026a:	72 3e                	jb     8002aa <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  80026c:	83 ec 0c             	sub    $0xc,%esp
+  80026f:	ff 75 18             	push   0x18(%ebp)
+  800272:	83 eb 01             	sub    $0x1,%ebx
+  800275:	53                   	push   %ebx
+  800276:	50                   	push   %eax
+  800277:	83 ec 08             	sub    $0x8,%esp
+  80027a:	ff 75 e4             	push   -0x1c(%ebp)
+  80027d:	ff 75 e0             	push   -0x20(%ebp)
+  800280:	ff 75 dc             	push   -0x24(%ebp)
+  800283:	ff 75 d8             	push   -0x28(%ebp)
+  800286:	e8 db 2a 00 00       	call   802d66 <__udivdi3>
+  80028b:	83 c4 18             	add    $0x18,%esp
+  80028e:	52                   	push   %edx
+  80028f:	50                   	push   %eax
+  800290:	89 f2                	mov    %esi,%edx
+  800292:	89 f8                	mov    %edi,%eax
+  800294:	e8 9f ff ff ff       	call   800238 <printnum>
+  800299:	83 c4 20             	add    $0x20,%esp
+  80029c:	eb 13                	jmp    8002b1 <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  80029e:	83 ec 08             	sub    $0x8,%esp
+  8002a1:	56                   	push   %esi
+  8002a2:	ff 75 18             	push   0x18(%ebp)
+  8002a5:	ff d7                	call   *%edi
+  8002a7:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  8002aa:	83 eb 01             	sub    $0x1,%ebx
+  8002ad:	85 db                	test   %ebx,%ebx
+  8002af:	7f ed                	jg     80029e <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  8002b1:	83 ec 08             	sub    $0x8,%esp
+  8002b4:	56                   	push   %esi
+  8002b5:	83 ec 04             	sub    $0x4,%esp
+  8002b8:	ff 75 e4             	push   -0x1c(%ebp)
+  8002bb:	ff 75 e0             	push   -0x20(%ebp)
+  8002be:	ff 75 dc             	push   -0x24(%ebp)
+  8002c1:	ff 75 d8             	push   -0x28(%ebp)
+  8002c4:	e8 be 2a 00 00       	call   802d87 <__umoddi3>
+  8002c9:	83 c4 14             	add    $0x14,%esp
+  8002cc:	0f be 80 eb 2f 80 00 	movsbl 0x802feb(%eax),%eax
+  8002d3:	50                   	push   %eax
+  8002d4:	ff d7                	call   *%edi
+}
+  8002d6:	83 c4 10             	add    $0x10,%esp
+  8002d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8002dc:	5b                   	pop    %ebx
+  8002dd:	5e                   	pop    %esi
+  8002de:	5f                   	pop    %edi
+  8002df:	5d                   	pop    %ebp
+  8002e0:	c3                   	ret
+
+008002e1 <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8002e1:	55                   	push   %ebp
+  8002e2:	89 e5                	mov    %esp,%ebp
+  8002e4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  8002e7:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  8002eb:	8b 10                	mov    (%eax),%edx
+  8002ed:	3b 50 04             	cmp    0x4(%eax),%edx
+  8002f0:	73 0a                	jae    8002fc <sprintputch+0x1b>
+    *b->buf++ = ch;
+  8002f2:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8002f5:	89 08                	mov    %ecx,(%eax)
+  8002f7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8002fa:	88 02                	mov    %al,(%edx)
+}
+  8002fc:	5d                   	pop    %ebp
+  8002fd:	c3                   	ret
+
+008002fe <printfmt>:
+{
+  8002fe:	55                   	push   %ebp
+  8002ff:	89 e5                	mov    %esp,%ebp
+  800301:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  800304:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  800307:	50                   	push   %eax
+  800308:	ff 75 10             	push   0x10(%ebp)
+  80030b:	ff 75 0c             	push   0xc(%ebp)
+  80030e:	ff 75 08             	push   0x8(%ebp)
+  800311:	e8 05 00 00 00       	call   80031b <vprintfmt>
+}
+  800316:	83 c4 10             	add    $0x10,%esp
+  800319:	c9                   	leave
+  80031a:	c3                   	ret
+
+0080031b <vprintfmt>:
+{
+  80031b:	55                   	push   %ebp
+  80031c:	89 e5                	mov    %esp,%ebp
+  80031e:	57                   	push   %edi
+  80031f:	56                   	push   %esi
+  800320:	53                   	push   %ebx
+  800321:	83 ec 2c             	sub    $0x2c,%esp
+  800324:	8b 75 08             	mov    0x8(%ebp),%esi
+  800327:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  80032a:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80032d:	eb 0a                	jmp    800339 <vprintfmt+0x1e>
+      putch(ch, putdat);
+  80032f:	83 ec 08             	sub    $0x8,%esp
+  800332:	53                   	push   %ebx
+  800333:	50                   	push   %eax
+  800334:	ff d6                	call   *%esi
+  800336:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  800339:	83 c7 01             	add    $0x1,%edi
+  80033c:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800340:	83 f8 25             	cmp    $0x25,%eax
+  800343:	74 0c                	je     800351 <vprintfmt+0x36>
+      if (ch == '\0')
+  800345:	85 c0                	test   %eax,%eax
+  800347:	75 e6                	jne    80032f <vprintfmt+0x14>
+}
+  800349:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80034c:	5b                   	pop    %ebx
+  80034d:	5e                   	pop    %esi
+  80034e:	5f                   	pop    %edi
+  80034f:	5d                   	pop    %ebp
+  800350:	c3                   	ret
+    padc = ' ';
+  800351:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  800355:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  80035c:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  800363:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  80036a:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  80036f:	8d 47 01             	lea    0x1(%edi),%eax
+  800372:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800375:	0f b6 17             	movzbl (%edi),%edx
+  800378:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80037b:	3c 55                	cmp    $0x55,%al
+  80037d:	0f 87 cf 03 00 00    	ja     800752 <vprintfmt+0x437>
+  800383:	0f b6 c0             	movzbl %al,%eax
+  800386:	ff 24 85 40 31 80 00 	jmp    *0x803140(,%eax,4)
+  80038d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  800390:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800394:	eb d9                	jmp    80036f <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  800396:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800399:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80039d:	eb d0                	jmp    80036f <vprintfmt+0x54>
+  80039f:	0f b6 d2             	movzbl %dl,%edx
+  8003a2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  8003a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003aa:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  8003ad:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8003b0:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  8003b4:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  8003b7:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8003ba:	83 f9 09             	cmp    $0x9,%ecx
+  8003bd:	77 55                	ja     800414 <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  8003bf:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  8003c2:	eb e9                	jmp    8003ad <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  8003c4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003c7:	8b 00                	mov    (%eax),%eax
+  8003c9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8003cc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8003cf:	8d 40 04             	lea    0x4(%eax),%eax
+  8003d2:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  8003d5:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  8003d8:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8003dc:	79 91                	jns    80036f <vprintfmt+0x54>
+        width = precision, precision = -1;
+  8003de:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8003e1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003e4:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8003eb:	eb 82                	jmp    80036f <vprintfmt+0x54>
+      if (width < 0)
+  8003ed:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8003f0:	85 d2                	test   %edx,%edx
+  8003f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003f7:	0f 49 c2             	cmovns %edx,%eax
+  8003fa:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  8003fd:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  800400:	e9 6a ff ff ff       	jmp    80036f <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  800405:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  800408:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  80040f:	e9 5b ff ff ff       	jmp    80036f <vprintfmt+0x54>
+  800414:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800417:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80041a:	eb bc                	jmp    8003d8 <vprintfmt+0xbd>
+      lflag++;
+  80041c:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  80041f:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  800422:	e9 48 ff ff ff       	jmp    80036f <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  800427:	8b 45 14             	mov    0x14(%ebp),%eax
+  80042a:	8d 78 04             	lea    0x4(%eax),%edi
+  80042d:	83 ec 08             	sub    $0x8,%esp
+  800430:	53                   	push   %ebx
+  800431:	ff 30                	push   (%eax)
+  800433:	ff d6                	call   *%esi
+      break;
+  800435:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  800438:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  80043b:	e9 b1 02 00 00       	jmp    8006f1 <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  800440:	8b 45 14             	mov    0x14(%ebp),%eax
+  800443:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  800446:	8b 10                	mov    (%eax),%edx
+  800448:	89 d0                	mov    %edx,%eax
+  80044a:	f7 d8                	neg    %eax
+  80044c:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80044f:	83 f8 10             	cmp    $0x10,%eax
+  800452:	7f 23                	jg     800477 <vprintfmt+0x15c>
+  800454:	8b 14 85 a0 32 80 00 	mov    0x8032a0(,%eax,4),%edx
+  80045b:	85 d2                	test   %edx,%edx
+  80045d:	74 18                	je     800477 <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  80045f:	52                   	push   %edx
+  800460:	68 ea 33 80 00       	push   $0x8033ea
+  800465:	53                   	push   %ebx
+  800466:	56                   	push   %esi
+  800467:	e8 92 fe ff ff       	call   8002fe <printfmt>
+  80046c:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  80046f:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800472:	e9 7a 02 00 00       	jmp    8006f1 <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  800477:	50                   	push   %eax
+  800478:	68 03 30 80 00       	push   $0x803003
+  80047d:	53                   	push   %ebx
+  80047e:	56                   	push   %esi
+  80047f:	e8 7a fe ff ff       	call   8002fe <printfmt>
+  800484:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  800487:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  80048a:	e9 62 02 00 00       	jmp    8006f1 <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  80048f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800492:	83 c0 04             	add    $0x4,%eax
+  800495:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800498:	8b 45 14             	mov    0x14(%ebp),%eax
+  80049b:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  80049d:	85 c9                	test   %ecx,%ecx
+  80049f:	b8 fc 2f 80 00       	mov    $0x802ffc,%eax
+  8004a4:	0f 45 c1             	cmovne %ecx,%eax
+  8004a7:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  8004aa:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004ae:	7e 06                	jle    8004b6 <vprintfmt+0x19b>
+  8004b0:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8004b4:	75 0b                	jne    8004c1 <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8004b6:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8004b9:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8004bc:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004bf:	eb 5c                	jmp    80051d <vprintfmt+0x202>
+  8004c1:	83 ec 08             	sub    $0x8,%esp
+  8004c4:	ff 75 d0             	push   -0x30(%ebp)
+  8004c7:	ff 75 cc             	push   -0x34(%ebp)
+  8004ca:	e8 20 03 00 00       	call   8007ef <strnlen>
+  8004cf:	89 c2                	mov    %eax,%edx
+  8004d1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004d4:	29 d0                	sub    %edx,%eax
+  8004d6:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  8004d9:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8004dd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004e0:	89 75 08             	mov    %esi,0x8(%ebp)
+  8004e3:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8004e5:	eb 0e                	jmp    8004f5 <vprintfmt+0x1da>
+          putch(padc, putdat);
+  8004e7:	83 ec 08             	sub    $0x8,%esp
+  8004ea:	53                   	push   %ebx
+  8004eb:	57                   	push   %edi
+  8004ec:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8004ef:	83 ee 01             	sub    $0x1,%esi
+  8004f2:	83 c4 10             	add    $0x10,%esp
+  8004f5:	85 f6                	test   %esi,%esi
+  8004f7:	7f ee                	jg     8004e7 <vprintfmt+0x1cc>
+  8004f9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8004fc:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004ff:	85 c0                	test   %eax,%eax
+  800501:	ba 00 00 00 00       	mov    $0x0,%edx
+  800506:	0f 49 d0             	cmovns %eax,%edx
+  800509:	29 d0                	sub    %edx,%eax
+  80050b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80050e:	eb a6                	jmp    8004b6 <vprintfmt+0x19b>
+          putch(ch, putdat);
+  800510:	83 ec 08             	sub    $0x8,%esp
+  800513:	53                   	push   %ebx
+  800514:	52                   	push   %edx
+  800515:	ff 55 08             	call   *0x8(%ebp)
+  800518:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80051b:	89 f1                	mov    %esi,%ecx
+  80051d:	8d 71 01             	lea    0x1(%ecx),%esi
+  800520:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800524:	0f be d0             	movsbl %al,%edx
+  800527:	85 d2                	test   %edx,%edx
+  800529:	74 28                	je     800553 <vprintfmt+0x238>
+  80052b:	85 ff                	test   %edi,%edi
+  80052d:	78 05                	js     800534 <vprintfmt+0x219>
+  80052f:	83 ef 01             	sub    $0x1,%edi
+  800532:	78 30                	js     800564 <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  800534:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800538:	74 d6                	je     800510 <vprintfmt+0x1f5>
+  80053a:	0f be c0             	movsbl %al,%eax
+  80053d:	83 e8 20             	sub    $0x20,%eax
+  800540:	83 f8 5e             	cmp    $0x5e,%eax
+  800543:	76 cb                	jbe    800510 <vprintfmt+0x1f5>
+          putch('?', putdat);
+  800545:	83 ec 08             	sub    $0x8,%esp
+  800548:	53                   	push   %ebx
+  800549:	6a 3f                	push   $0x3f
+  80054b:	ff 55 08             	call   *0x8(%ebp)
+  80054e:	83 c4 10             	add    $0x10,%esp
+  800551:	eb c8                	jmp    80051b <vprintfmt+0x200>
+  800553:	8b 75 08             	mov    0x8(%ebp),%esi
+  800556:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800559:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80055c:	01 d0                	add    %edx,%eax
+  80055e:	29 c8                	sub    %ecx,%eax
+  800560:	89 c7                	mov    %eax,%edi
+  800562:	eb 13                	jmp    800577 <vprintfmt+0x25c>
+  800564:	8b 75 08             	mov    0x8(%ebp),%esi
+  800567:	eb ed                	jmp    800556 <vprintfmt+0x23b>
+        putch(' ', putdat);
+  800569:	83 ec 08             	sub    $0x8,%esp
+  80056c:	53                   	push   %ebx
+  80056d:	6a 20                	push   $0x20
+  80056f:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  800571:	83 ef 01             	sub    $0x1,%edi
+  800574:	83 c4 10             	add    $0x10,%esp
+  800577:	85 ff                	test   %edi,%edi
+  800579:	7f ee                	jg     800569 <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  80057b:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80057e:	89 45 14             	mov    %eax,0x14(%ebp)
+  800581:	e9 6b 01 00 00       	jmp    8006f1 <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  800586:	83 f9 01             	cmp    $0x1,%ecx
+  800589:	7f 1f                	jg     8005aa <vprintfmt+0x28f>
+  else if (lflag)
+  80058b:	85 c9                	test   %ecx,%ecx
+  80058d:	74 67                	je     8005f6 <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  80058f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800592:	8b 00                	mov    (%eax),%eax
+  800594:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800597:	89 c1                	mov    %eax,%ecx
+  800599:	c1 f9 1f             	sar    $0x1f,%ecx
+  80059c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80059f:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a2:	8d 40 04             	lea    0x4(%eax),%eax
+  8005a5:	89 45 14             	mov    %eax,0x14(%ebp)
+  8005a8:	eb 17                	jmp    8005c1 <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  8005aa:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005ad:	8b 50 04             	mov    0x4(%eax),%edx
+  8005b0:	8b 00                	mov    (%eax),%eax
+  8005b2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005b5:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8005b8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005bb:	8d 40 08             	lea    0x8(%eax),%eax
+  8005be:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  8005c1:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005c4:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  8005c7:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  8005cc:	85 c9                	test   %ecx,%ecx
+  8005ce:	0f 89 03 01 00 00    	jns    8006d7 <vprintfmt+0x3bc>
+        putch('-', putdat);
+  8005d4:	83 ec 08             	sub    $0x8,%esp
+  8005d7:	53                   	push   %ebx
+  8005d8:	6a 2d                	push   $0x2d
+  8005da:	ff d6                	call   *%esi
+        num = -(long long)num;
+  8005dc:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8005df:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8005e2:	f7 da                	neg    %edx
+  8005e4:	83 d1 00             	adc    $0x0,%ecx
+  8005e7:	f7 d9                	neg    %ecx
+  8005e9:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  8005ec:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8005f1:	e9 e1 00 00 00       	jmp    8006d7 <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  8005f6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005f9:	8b 00                	mov    (%eax),%eax
+  8005fb:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8005fe:	89 c1                	mov    %eax,%ecx
+  800600:	c1 f9 1f             	sar    $0x1f,%ecx
+  800603:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800606:	8b 45 14             	mov    0x14(%ebp),%eax
+  800609:	8d 40 04             	lea    0x4(%eax),%eax
+  80060c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80060f:	eb b0                	jmp    8005c1 <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  800611:	83 f9 01             	cmp    $0x1,%ecx
+  800614:	7f 1e                	jg     800634 <vprintfmt+0x319>
+  else if (lflag)
+  800616:	85 c9                	test   %ecx,%ecx
+  800618:	74 32                	je     80064c <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  80061a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80061d:	8b 10                	mov    (%eax),%edx
+  80061f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800624:	8d 40 04             	lea    0x4(%eax),%eax
+  800627:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  80062a:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  80062f:	e9 a3 00 00 00       	jmp    8006d7 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800634:	8b 45 14             	mov    0x14(%ebp),%eax
+  800637:	8b 10                	mov    (%eax),%edx
+  800639:	8b 48 04             	mov    0x4(%eax),%ecx
+  80063c:	8d 40 08             	lea    0x8(%eax),%eax
+  80063f:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800642:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  800647:	e9 8b 00 00 00       	jmp    8006d7 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  80064c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80064f:	8b 10                	mov    (%eax),%edx
+  800651:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800656:	8d 40 04             	lea    0x4(%eax),%eax
+  800659:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  80065c:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  800661:	eb 74                	jmp    8006d7 <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  800663:	83 f9 01             	cmp    $0x1,%ecx
+  800666:	7f 1b                	jg     800683 <vprintfmt+0x368>
+  else if (lflag)
+  800668:	85 c9                	test   %ecx,%ecx
+  80066a:	74 2c                	je     800698 <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  80066c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80066f:	8b 10                	mov    (%eax),%edx
+  800671:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800676:	8d 40 04             	lea    0x4(%eax),%eax
+  800679:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  80067c:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  800681:	eb 54                	jmp    8006d7 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800683:	8b 45 14             	mov    0x14(%ebp),%eax
+  800686:	8b 10                	mov    (%eax),%edx
+  800688:	8b 48 04             	mov    0x4(%eax),%ecx
+  80068b:	8d 40 08             	lea    0x8(%eax),%eax
+  80068e:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800691:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  800696:	eb 3f                	jmp    8006d7 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800698:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069b:	8b 10                	mov    (%eax),%edx
+  80069d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006a2:	8d 40 04             	lea    0x4(%eax),%eax
+  8006a5:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8006a8:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  8006ad:	eb 28                	jmp    8006d7 <vprintfmt+0x3bc>
+      putch('0', putdat);
+  8006af:	83 ec 08             	sub    $0x8,%esp
+  8006b2:	53                   	push   %ebx
+  8006b3:	6a 30                	push   $0x30
+  8006b5:	ff d6                	call   *%esi
+      putch('x', putdat);
+  8006b7:	83 c4 08             	add    $0x8,%esp
+  8006ba:	53                   	push   %ebx
+  8006bb:	6a 78                	push   $0x78
+  8006bd:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  8006bf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006c2:	8b 10                	mov    (%eax),%edx
+  8006c4:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  8006c9:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  8006cc:	8d 40 04             	lea    0x4(%eax),%eax
+  8006cf:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8006d2:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  8006d7:	83 ec 0c             	sub    $0xc,%esp
+  8006da:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8006de:	50                   	push   %eax
+  8006df:	ff 75 e0             	push   -0x20(%ebp)
+  8006e2:	57                   	push   %edi
+  8006e3:	51                   	push   %ecx
+  8006e4:	52                   	push   %edx
+  8006e5:	89 da                	mov    %ebx,%edx
+  8006e7:	89 f0                	mov    %esi,%eax
+  8006e9:	e8 4a fb ff ff       	call   800238 <printnum>
+      break;
+  8006ee:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  8006f1:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  8006f4:	e9 40 fc ff ff       	jmp    800339 <vprintfmt+0x1e>
+  if (lflag >= 2)
+  8006f9:	83 f9 01             	cmp    $0x1,%ecx
+  8006fc:	7f 1b                	jg     800719 <vprintfmt+0x3fe>
+  else if (lflag)
+  8006fe:	85 c9                	test   %ecx,%ecx
+  800700:	74 2c                	je     80072e <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  800702:	8b 45 14             	mov    0x14(%ebp),%eax
+  800705:	8b 10                	mov    (%eax),%edx
+  800707:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80070c:	8d 40 04             	lea    0x4(%eax),%eax
+  80070f:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800712:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  800717:	eb be                	jmp    8006d7 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800719:	8b 45 14             	mov    0x14(%ebp),%eax
+  80071c:	8b 10                	mov    (%eax),%edx
+  80071e:	8b 48 04             	mov    0x4(%eax),%ecx
+  800721:	8d 40 08             	lea    0x8(%eax),%eax
+  800724:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800727:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  80072c:	eb a9                	jmp    8006d7 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  80072e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800731:	8b 10                	mov    (%eax),%edx
+  800733:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800738:	8d 40 04             	lea    0x4(%eax),%eax
+  80073b:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  80073e:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  800743:	eb 92                	jmp    8006d7 <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  800745:	83 ec 08             	sub    $0x8,%esp
+  800748:	53                   	push   %ebx
+  800749:	6a 25                	push   $0x25
+  80074b:	ff d6                	call   *%esi
+      break;
+  80074d:	83 c4 10             	add    $0x10,%esp
+  800750:	eb 9f                	jmp    8006f1 <vprintfmt+0x3d6>
+      putch('%', putdat);
+  800752:	83 ec 08             	sub    $0x8,%esp
+  800755:	53                   	push   %ebx
+  800756:	6a 25                	push   $0x25
+  800758:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  80075a:	83 c4 10             	add    $0x10,%esp
+  80075d:	89 f8                	mov    %edi,%eax
+  80075f:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800763:	74 05                	je     80076a <vprintfmt+0x44f>
+  800765:	83 e8 01             	sub    $0x1,%eax
+  800768:	eb f5                	jmp    80075f <vprintfmt+0x444>
+  80076a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80076d:	eb 82                	jmp    8006f1 <vprintfmt+0x3d6>
+
+0080076f <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80076f:	55                   	push   %ebp
+  800770:	89 e5                	mov    %esp,%ebp
+  800772:	83 ec 18             	sub    $0x18,%esp
+  800775:	8b 45 08             	mov    0x8(%ebp),%eax
+  800778:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  80077b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80077e:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800782:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800785:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  80078c:	85 c0                	test   %eax,%eax
+  80078e:	74 26                	je     8007b6 <vsnprintf+0x47>
+  800790:	85 d2                	test   %edx,%edx
+  800792:	7e 22                	jle    8007b6 <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800794:	ff 75 14             	push   0x14(%ebp)
+  800797:	ff 75 10             	push   0x10(%ebp)
+  80079a:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80079d:	50                   	push   %eax
+  80079e:	68 e1 02 80 00       	push   $0x8002e1
+  8007a3:	e8 73 fb ff ff       	call   80031b <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  8007a8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8007ab:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  8007ae:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8007b1:	83 c4 10             	add    $0x10,%esp
+}
+  8007b4:	c9                   	leave
+  8007b5:	c3                   	ret
+    return -E_INVAL;
+  8007b6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007bb:	eb f7                	jmp    8007b4 <vsnprintf+0x45>
+
+008007bd <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8007bd:	55                   	push   %ebp
+  8007be:	89 e5                	mov    %esp,%ebp
+  8007c0:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  8007c3:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  8007c6:	50                   	push   %eax
+  8007c7:	ff 75 10             	push   0x10(%ebp)
+  8007ca:	ff 75 0c             	push   0xc(%ebp)
+  8007cd:	ff 75 08             	push   0x8(%ebp)
+  8007d0:	e8 9a ff ff ff       	call   80076f <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  8007d5:	c9                   	leave
+  8007d6:	c3                   	ret
+
+008007d7 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8007d7:	55                   	push   %ebp
+  8007d8:	89 e5                	mov    %esp,%ebp
+  8007da:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  8007dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007e2:	eb 03                	jmp    8007e7 <strlen+0x10>
+    n++;
+  8007e4:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  8007e7:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8007eb:	75 f7                	jne    8007e4 <strlen+0xd>
+  return n;
+}
+  8007ed:	5d                   	pop    %ebp
+  8007ee:	c3                   	ret
+
+008007ef <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8007ef:	55                   	push   %ebp
+  8007f0:	89 e5                	mov    %esp,%ebp
+  8007f2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8007f5:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fd:	eb 03                	jmp    800802 <strnlen+0x13>
+    n++;
+  8007ff:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800802:	39 d0                	cmp    %edx,%eax
+  800804:	74 08                	je     80080e <strnlen+0x1f>
+  800806:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  80080a:	75 f3                	jne    8007ff <strnlen+0x10>
+  80080c:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  80080e:	89 d0                	mov    %edx,%eax
+  800810:	5d                   	pop    %ebp
+  800811:	c3                   	ret
+
+00800812 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800812:	55                   	push   %ebp
+  800813:	89 e5                	mov    %esp,%ebp
+  800815:	53                   	push   %ebx
+  800816:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800819:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  80081c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800821:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800825:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800828:	83 c0 01             	add    $0x1,%eax
+  80082b:	84 d2                	test   %dl,%dl
+  80082d:	75 f2                	jne    800821 <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  80082f:	89 c8                	mov    %ecx,%eax
+  800831:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800834:	c9                   	leave
+  800835:	c3                   	ret
+
+00800836 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800836:	55                   	push   %ebp
+  800837:	89 e5                	mov    %esp,%ebp
+  800839:	53                   	push   %ebx
+  80083a:	83 ec 10             	sub    $0x10,%esp
+  80083d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  800840:	53                   	push   %ebx
+  800841:	e8 91 ff ff ff       	call   8007d7 <strlen>
+  800846:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  800849:	ff 75 0c             	push   0xc(%ebp)
+  80084c:	01 d8                	add    %ebx,%eax
+  80084e:	50                   	push   %eax
+  80084f:	e8 be ff ff ff       	call   800812 <strcpy>
+  return dst;
+}
+  800854:	89 d8                	mov    %ebx,%eax
+  800856:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800859:	c9                   	leave
+  80085a:	c3                   	ret
+
+0080085b <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  80085b:	55                   	push   %ebp
+  80085c:	89 e5                	mov    %esp,%ebp
+  80085e:	56                   	push   %esi
+  80085f:	53                   	push   %ebx
+  800860:	8b 75 08             	mov    0x8(%ebp),%esi
+  800863:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  800866:	89 f3                	mov    %esi,%ebx
+  800868:	03 5d 10             	add    0x10(%ebp),%ebx
+  80086b:	89 f0                	mov    %esi,%eax
+  80086d:	eb 0f                	jmp    80087e <strncpy+0x23>
+    *dst++ = *src;
+  80086f:	83 c0 01             	add    $0x1,%eax
+  800872:	0f b6 0a             	movzbl (%edx),%ecx
+  800875:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  800878:	80 f9 01             	cmp    $0x1,%cl
+  80087b:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  80087e:	39 d8                	cmp    %ebx,%eax
+  800880:	75 ed                	jne    80086f <strncpy+0x14>
+  }
+  return ret;
+}
+  800882:	89 f0                	mov    %esi,%eax
+  800884:	5b                   	pop    %ebx
+  800885:	5e                   	pop    %esi
+  800886:	5d                   	pop    %ebp
+  800887:	c3                   	ret
+
+00800888 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800888:	55                   	push   %ebp
+  800889:	89 e5                	mov    %esp,%ebp
+  80088b:	56                   	push   %esi
+  80088c:	53                   	push   %ebx
+  80088d:	8b 75 08             	mov    0x8(%ebp),%esi
+  800890:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800893:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  800896:	89 f0                	mov    %esi,%eax
+  800898:	85 d2                	test   %edx,%edx
+  80089a:	74 21                	je     8008bd <strlcpy+0x35>
+  80089c:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  8008a0:	89 f2                	mov    %esi,%edx
+  8008a2:	eb 09                	jmp    8008ad <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  8008a4:	83 c1 01             	add    $0x1,%ecx
+  8008a7:	83 c2 01             	add    $0x1,%edx
+  8008aa:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  8008ad:	39 c2                	cmp    %eax,%edx
+  8008af:	74 09                	je     8008ba <strlcpy+0x32>
+  8008b1:	0f b6 19             	movzbl (%ecx),%ebx
+  8008b4:	84 db                	test   %bl,%bl
+  8008b6:	75 ec                	jne    8008a4 <strlcpy+0x1c>
+  8008b8:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  8008ba:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  8008bd:	29 f0                	sub    %esi,%eax
+}
+  8008bf:	5b                   	pop    %ebx
+  8008c0:	5e                   	pop    %esi
+  8008c1:	5d                   	pop    %ebp
+  8008c2:	c3                   	ret
+
+008008c3 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8008c3:	55                   	push   %ebp
+  8008c4:	89 e5                	mov    %esp,%ebp
+  8008c6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8008c9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  8008cc:	eb 06                	jmp    8008d4 <strcmp+0x11>
+    p++, q++;
+  8008ce:	83 c1 01             	add    $0x1,%ecx
+  8008d1:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  8008d4:	0f b6 01             	movzbl (%ecx),%eax
+  8008d7:	84 c0                	test   %al,%al
+  8008d9:	74 04                	je     8008df <strcmp+0x1c>
+  8008db:	3a 02                	cmp    (%edx),%al
+  8008dd:	74 ef                	je     8008ce <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  8008df:	0f b6 c0             	movzbl %al,%eax
+  8008e2:	0f b6 12             	movzbl (%edx),%edx
+  8008e5:	29 d0                	sub    %edx,%eax
+}
+  8008e7:	5d                   	pop    %ebp
+  8008e8:	c3                   	ret
+
+008008e9 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8008e9:	55                   	push   %ebp
+  8008ea:	89 e5                	mov    %esp,%ebp
+  8008ec:	53                   	push   %ebx
+  8008ed:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008f0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8008f3:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  8008f6:	eb 09                	jmp    800901 <strncmp+0x18>
+    n--, p++, q++;
+  8008f8:	83 ea 01             	sub    $0x1,%edx
+  8008fb:	83 c0 01             	add    $0x1,%eax
+  8008fe:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  800901:	85 d2                	test   %edx,%edx
+  800903:	74 18                	je     80091d <strncmp+0x34>
+  800905:	0f b6 18             	movzbl (%eax),%ebx
+  800908:	84 db                	test   %bl,%bl
+  80090a:	74 04                	je     800910 <strncmp+0x27>
+  80090c:	3a 19                	cmp    (%ecx),%bl
+  80090e:	74 e8                	je     8008f8 <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800910:	0f b6 00             	movzbl (%eax),%eax
+  800913:	0f b6 11             	movzbl (%ecx),%edx
+  800916:	29 d0                	sub    %edx,%eax
+}
+  800918:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80091b:	c9                   	leave
+  80091c:	c3                   	ret
+    return 0;
+  80091d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800922:	eb f4                	jmp    800918 <strncmp+0x2f>
+
+00800924 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800924:	55                   	push   %ebp
+  800925:	89 e5                	mov    %esp,%ebp
+  800927:	8b 45 08             	mov    0x8(%ebp),%eax
+  80092a:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  80092e:	eb 03                	jmp    800933 <strchr+0xf>
+  800930:	83 c0 01             	add    $0x1,%eax
+  800933:	0f b6 10             	movzbl (%eax),%edx
+  800936:	84 d2                	test   %dl,%dl
+  800938:	74 06                	je     800940 <strchr+0x1c>
+    if (*s == c)
+  80093a:	38 ca                	cmp    %cl,%dl
+  80093c:	75 f2                	jne    800930 <strchr+0xc>
+  80093e:	eb 05                	jmp    800945 <strchr+0x21>
+      return (char*)s;
+  return 0;
+  800940:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800945:	5d                   	pop    %ebp
+  800946:	c3                   	ret
+
+00800947 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800947:	55                   	push   %ebp
+  800948:	89 e5                	mov    %esp,%ebp
+  80094a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80094d:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800951:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  800954:	38 ca                	cmp    %cl,%dl
+  800956:	74 09                	je     800961 <strfind+0x1a>
+  800958:	84 d2                	test   %dl,%dl
+  80095a:	74 05                	je     800961 <strfind+0x1a>
+  for (; *s; s++)
+  80095c:	83 c0 01             	add    $0x1,%eax
+  80095f:	eb f0                	jmp    800951 <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  800961:	5d                   	pop    %ebp
+  800962:	c3                   	ret
+
+00800963 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800963:	55                   	push   %ebp
+  800964:	89 e5                	mov    %esp,%ebp
+  800966:	57                   	push   %edi
+  800967:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80096a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  80096d:	85 c9                	test   %ecx,%ecx
+  80096f:	74 20                	je     800991 <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  800971:	89 f8                	mov    %edi,%eax
+  800973:	09 c8                	or     %ecx,%eax
+  800975:	a8 03                	test   $0x3,%al
+  800977:	75 12                	jne    80098b <memset+0x28>
+    c &= 0xFF;
+  800979:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  80097d:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  800983:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  800986:	fc                   	cld
+  800987:	f3 ab                	rep stos %eax,%es:(%edi)
+  800989:	eb 06                	jmp    800991 <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  80098b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80098e:	fc                   	cld
+  80098f:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  800991:	89 f8                	mov    %edi,%eax
+  800993:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800996:	c9                   	leave
+  800997:	c3                   	ret
+
+00800998 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800998:	55                   	push   %ebp
+  800999:	89 e5                	mov    %esp,%ebp
+  80099b:	57                   	push   %edi
+  80099c:	56                   	push   %esi
+  80099d:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009a0:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8009a3:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  8009a6:	39 c6                	cmp    %eax,%esi
+  8009a8:	73 32                	jae    8009dc <memmove+0x44>
+  8009aa:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  8009ad:	39 d0                	cmp    %edx,%eax
+  8009af:	73 2b                	jae    8009dc <memmove+0x44>
+    s += n;
+    d += n;
+  8009b1:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009b4:	89 d6                	mov    %edx,%esi
+  8009b6:	09 fe                	or     %edi,%esi
+  8009b8:	09 ce                	or     %ecx,%esi
+  8009ba:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  8009c0:	75 0e                	jne    8009d0 <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  8009c2:	83 ef 04             	sub    $0x4,%edi
+  8009c5:	8d 72 fc             	lea    -0x4(%edx),%esi
+  8009c8:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  8009cb:	fd                   	std
+  8009cc:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009ce:	eb 09                	jmp    8009d9 <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  8009d0:	83 ef 01             	sub    $0x1,%edi
+  8009d3:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  8009d6:	fd                   	std
+  8009d7:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  8009d9:	fc                   	cld
+  8009da:	eb 1a                	jmp    8009f6 <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  8009dc:	89 f2                	mov    %esi,%edx
+  8009de:	09 c2                	or     %eax,%edx
+  8009e0:	09 ca                	or     %ecx,%edx
+  8009e2:	f6 c2 03             	test   $0x3,%dl
+  8009e5:	75 0a                	jne    8009f1 <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  8009e7:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  8009ea:	89 c7                	mov    %eax,%edi
+  8009ec:	fc                   	cld
+  8009ed:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  8009ef:	eb 05                	jmp    8009f6 <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  8009f1:	89 c7                	mov    %eax,%edi
+  8009f3:	fc                   	cld
+  8009f4:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  8009f6:	5e                   	pop    %esi
+  8009f7:	5f                   	pop    %edi
+  8009f8:	5d                   	pop    %ebp
+  8009f9:	c3                   	ret
+
+008009fa <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  8009fa:	55                   	push   %ebp
+  8009fb:	89 e5                	mov    %esp,%ebp
+  8009fd:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  800a00:	ff 75 10             	push   0x10(%ebp)
+  800a03:	ff 75 0c             	push   0xc(%ebp)
+  800a06:	ff 75 08             	push   0x8(%ebp)
+  800a09:	e8 8a ff ff ff       	call   800998 <memmove>
+}
+  800a0e:	c9                   	leave
+  800a0f:	c3                   	ret
+
+00800a10 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800a10:	55                   	push   %ebp
+  800a11:	89 e5                	mov    %esp,%ebp
+  800a13:	56                   	push   %esi
+  800a14:	53                   	push   %ebx
+  800a15:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a18:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  800a1b:	89 c6                	mov    %eax,%esi
+  800a1d:	03 75 10             	add    0x10(%ebp),%esi
+  800a20:	eb 06                	jmp    800a28 <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  800a22:	83 c0 01             	add    $0x1,%eax
+  800a25:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  800a28:	39 f0                	cmp    %esi,%eax
+  800a2a:	74 14                	je     800a40 <memcmp+0x30>
+    if (*s1 != *s2)
+  800a2c:	0f b6 08             	movzbl (%eax),%ecx
+  800a2f:	0f b6 1a             	movzbl (%edx),%ebx
+  800a32:	38 d9                	cmp    %bl,%cl
+  800a34:	74 ec                	je     800a22 <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  800a36:	0f b6 c1             	movzbl %cl,%eax
+  800a39:	0f b6 db             	movzbl %bl,%ebx
+  800a3c:	29 d8                	sub    %ebx,%eax
+  800a3e:	eb 05                	jmp    800a45 <memcmp+0x35>
+  }
+
+  return 0;
+  800a40:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a45:	5b                   	pop    %ebx
+  800a46:	5e                   	pop    %esi
+  800a47:	5d                   	pop    %ebp
+  800a48:	c3                   	ret
+
+00800a49 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800a49:	55                   	push   %ebp
+  800a4a:	89 e5                	mov    %esp,%ebp
+  800a4c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a4f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  800a52:	89 c2                	mov    %eax,%edx
+  800a54:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  800a57:	eb 03                	jmp    800a5c <memfind+0x13>
+  800a59:	83 c0 01             	add    $0x1,%eax
+  800a5c:	39 d0                	cmp    %edx,%eax
+  800a5e:	73 04                	jae    800a64 <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  800a60:	38 08                	cmp    %cl,(%eax)
+  800a62:	75 f5                	jne    800a59 <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  800a64:	5d                   	pop    %ebp
+  800a65:	c3                   	ret
+
+00800a66 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800a66:	55                   	push   %ebp
+  800a67:	89 e5                	mov    %esp,%ebp
+  800a69:	57                   	push   %edi
+  800a6a:	56                   	push   %esi
+  800a6b:	53                   	push   %ebx
+  800a6c:	8b 55 08             	mov    0x8(%ebp),%edx
+  800a6f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  800a72:	eb 03                	jmp    800a77 <strtol+0x11>
+    s++;
+  800a74:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  800a77:	0f b6 02             	movzbl (%edx),%eax
+  800a7a:	3c 20                	cmp    $0x20,%al
+  800a7c:	74 f6                	je     800a74 <strtol+0xe>
+  800a7e:	3c 09                	cmp    $0x9,%al
+  800a80:	74 f2                	je     800a74 <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  800a82:	3c 2b                	cmp    $0x2b,%al
+  800a84:	74 2a                	je     800ab0 <strtol+0x4a>
+  int neg = 0;
+  800a86:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  800a8b:	3c 2d                	cmp    $0x2d,%al
+  800a8d:	74 2b                	je     800aba <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800a8f:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800a95:	75 0f                	jne    800aa6 <strtol+0x40>
+  800a97:	80 3a 30             	cmpb   $0x30,(%edx)
+  800a9a:	74 28                	je     800ac4 <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  800a9c:	85 db                	test   %ebx,%ebx
+  800a9e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800aa3:	0f 44 d8             	cmove  %eax,%ebx
+  800aa6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800aab:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800aae:	eb 46                	jmp    800af6 <strtol+0x90>
+    s++;
+  800ab0:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  800ab3:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ab8:	eb d5                	jmp    800a8f <strtol+0x29>
+    s++, neg = 1;
+  800aba:	83 c2 01             	add    $0x1,%edx
+  800abd:	bf 01 00 00 00       	mov    $0x1,%edi
+  800ac2:	eb cb                	jmp    800a8f <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800ac4:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800ac8:	74 0e                	je     800ad8 <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  800aca:	85 db                	test   %ebx,%ebx
+  800acc:	75 d8                	jne    800aa6 <strtol+0x40>
+    s++, base = 8;
+  800ace:	83 c2 01             	add    $0x1,%edx
+  800ad1:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800ad6:	eb ce                	jmp    800aa6 <strtol+0x40>
+    s += 2, base = 16;
+  800ad8:	83 c2 02             	add    $0x2,%edx
+  800adb:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800ae0:	eb c4                	jmp    800aa6 <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  800ae2:	0f be c0             	movsbl %al,%eax
+  800ae5:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  800ae8:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800aeb:	7d 3a                	jge    800b27 <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  800aed:	83 c2 01             	add    $0x1,%edx
+  800af0:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800af4:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  800af6:	0f b6 02             	movzbl (%edx),%eax
+  800af9:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800afc:	89 f3                	mov    %esi,%ebx
+  800afe:	80 fb 09             	cmp    $0x9,%bl
+  800b01:	76 df                	jbe    800ae2 <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  800b03:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800b06:	89 f3                	mov    %esi,%ebx
+  800b08:	80 fb 19             	cmp    $0x19,%bl
+  800b0b:	77 08                	ja     800b15 <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  800b0d:	0f be c0             	movsbl %al,%eax
+  800b10:	83 e8 57             	sub    $0x57,%eax
+  800b13:	eb d3                	jmp    800ae8 <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  800b15:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800b18:	89 f3                	mov    %esi,%ebx
+  800b1a:	80 fb 19             	cmp    $0x19,%bl
+  800b1d:	77 08                	ja     800b27 <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  800b1f:	0f be c0             	movsbl %al,%eax
+  800b22:	83 e8 37             	sub    $0x37,%eax
+  800b25:	eb c1                	jmp    800ae8 <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  800b27:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800b2b:	74 05                	je     800b32 <strtol+0xcc>
+    *endptr = (char*)s;
+  800b2d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b30:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  800b32:	89 c8                	mov    %ecx,%eax
+  800b34:	f7 d8                	neg    %eax
+  800b36:	85 ff                	test   %edi,%edi
+  800b38:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800b3b:	89 c8                	mov    %ecx,%eax
+  800b3d:	5b                   	pop    %ebx
+  800b3e:	5e                   	pop    %esi
+  800b3f:	5f                   	pop    %edi
+  800b40:	5d                   	pop    %ebp
+  800b41:	c3                   	ret
+
+00800b42 <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800b42:	55                   	push   %ebp
+  800b43:	89 e5                	mov    %esp,%ebp
+  800b45:	57                   	push   %edi
+  800b46:	56                   	push   %esi
+  800b47:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800b48:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b4d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b50:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b53:	89 c3                	mov    %eax,%ebx
+  800b55:	89 c7                	mov    %eax,%edi
+  800b57:	89 c6                	mov    %eax,%esi
+  800b59:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800b5b:	5b                   	pop    %ebx
+  800b5c:	5e                   	pop    %esi
+  800b5d:	5f                   	pop    %edi
+  800b5e:	5d                   	pop    %ebp
+  800b5f:	c3                   	ret
+
+00800b60 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800b60:	55                   	push   %ebp
+  800b61:	89 e5                	mov    %esp,%ebp
+  800b63:	57                   	push   %edi
+  800b64:	56                   	push   %esi
+  800b65:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800b66:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b6b:	b8 01 00 00 00       	mov    $0x1,%eax
+  800b70:	89 d1                	mov    %edx,%ecx
+  800b72:	89 d3                	mov    %edx,%ebx
+  800b74:	89 d7                	mov    %edx,%edi
+  800b76:	89 d6                	mov    %edx,%esi
+  800b78:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800b7a:	5b                   	pop    %ebx
+  800b7b:	5e                   	pop    %esi
+  800b7c:	5f                   	pop    %edi
+  800b7d:	5d                   	pop    %ebp
+  800b7e:	c3                   	ret
+
+00800b7f <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800b7f:	55                   	push   %ebp
+  800b80:	89 e5                	mov    %esp,%ebp
+  800b82:	57                   	push   %edi
+  800b83:	56                   	push   %esi
+  800b84:	53                   	push   %ebx
+  800b85:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800b88:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b8d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b90:	b8 03 00 00 00       	mov    $0x3,%eax
+  800b95:	89 cb                	mov    %ecx,%ebx
+  800b97:	89 cf                	mov    %ecx,%edi
+  800b99:	89 ce                	mov    %ecx,%esi
+  800b9b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800b9d:	85 c0                	test   %eax,%eax
+  800b9f:	7f 08                	jg     800ba9 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800ba1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ba4:	5b                   	pop    %ebx
+  800ba5:	5e                   	pop    %esi
+  800ba6:	5f                   	pop    %edi
+  800ba7:	5d                   	pop    %ebp
+  800ba8:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ba9:	83 ec 0c             	sub    $0xc,%esp
+  800bac:	50                   	push   %eax
+  800bad:	6a 03                	push   $0x3
+  800baf:	68 03 33 80 00       	push   $0x803303
+  800bb4:	6a 23                	push   $0x23
+  800bb6:	68 20 33 80 00       	push   $0x803320
+  800bbb:	e8 89 f5 ff ff       	call   800149 <_panic>
+
+00800bc0 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800bc0:	55                   	push   %ebp
+  800bc1:	89 e5                	mov    %esp,%ebp
+  800bc3:	57                   	push   %edi
+  800bc4:	56                   	push   %esi
+  800bc5:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800bc6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bcb:	b8 02 00 00 00       	mov    $0x2,%eax
+  800bd0:	89 d1                	mov    %edx,%ecx
+  800bd2:	89 d3                	mov    %edx,%ebx
+  800bd4:	89 d7                	mov    %edx,%edi
+  800bd6:	89 d6                	mov    %edx,%esi
+  800bd8:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800bda:	5b                   	pop    %ebx
+  800bdb:	5e                   	pop    %esi
+  800bdc:	5f                   	pop    %edi
+  800bdd:	5d                   	pop    %ebp
+  800bde:	c3                   	ret
+
+00800bdf <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800bdf:	55                   	push   %ebp
+  800be0:	89 e5                	mov    %esp,%ebp
+  800be2:	57                   	push   %edi
+  800be3:	56                   	push   %esi
+  800be4:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800be5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bea:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800bef:	89 d1                	mov    %edx,%ecx
+  800bf1:	89 d3                	mov    %edx,%ebx
+  800bf3:	89 d7                	mov    %edx,%edi
+  800bf5:	89 d6                	mov    %edx,%esi
+  800bf7:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800bf9:	5b                   	pop    %ebx
+  800bfa:	5e                   	pop    %esi
+  800bfb:	5f                   	pop    %edi
+  800bfc:	5d                   	pop    %ebp
+  800bfd:	c3                   	ret
+
+00800bfe <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  800bfe:	55                   	push   %ebp
+  800bff:	89 e5                	mov    %esp,%ebp
+  800c01:	57                   	push   %edi
+  800c02:	56                   	push   %esi
+  800c03:	53                   	push   %ebx
+  800c04:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  800c07:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  800c0b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800c10:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c13:	b8 14 00 00 00       	mov    $0x14,%eax
+  800c18:	89 df                	mov    %ebx,%edi
+  800c1a:	89 de                	mov    %ebx,%esi
+  800c1c:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c1e:	85 c0                	test   %eax,%eax
+  800c20:	7f 08                	jg     800c2a <sys_env_set_cow+0x2c>
+}
+  800c22:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c25:	5b                   	pop    %ebx
+  800c26:	5e                   	pop    %esi
+  800c27:	5f                   	pop    %edi
+  800c28:	5d                   	pop    %ebp
+  800c29:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c2a:	83 ec 0c             	sub    $0xc,%esp
+  800c2d:	50                   	push   %eax
+  800c2e:	6a 14                	push   $0x14
+  800c30:	68 03 33 80 00       	push   $0x803303
+  800c35:	6a 23                	push   $0x23
+  800c37:	68 20 33 80 00       	push   $0x803320
+  800c3c:	e8 08 f5 ff ff       	call   800149 <_panic>
+
+00800c41 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800c41:	55                   	push   %ebp
+  800c42:	89 e5                	mov    %esp,%ebp
+  800c44:	57                   	push   %edi
+  800c45:	56                   	push   %esi
+  800c46:	53                   	push   %ebx
+  800c47:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800c4a:	be 00 00 00 00       	mov    $0x0,%esi
+  800c4f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c52:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c55:	b8 04 00 00 00       	mov    $0x4,%eax
+  800c5a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c5d:	89 f7                	mov    %esi,%edi
+  800c5f:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c61:	85 c0                	test   %eax,%eax
+  800c63:	7f 08                	jg     800c6d <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  800c65:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c68:	5b                   	pop    %ebx
+  800c69:	5e                   	pop    %esi
+  800c6a:	5f                   	pop    %edi
+  800c6b:	5d                   	pop    %ebp
+  800c6c:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c6d:	83 ec 0c             	sub    $0xc,%esp
+  800c70:	50                   	push   %eax
+  800c71:	6a 04                	push   $0x4
+  800c73:	68 03 33 80 00       	push   $0x803303
+  800c78:	6a 23                	push   $0x23
+  800c7a:	68 20 33 80 00       	push   $0x803320
+  800c7f:	e8 c5 f4 ff ff       	call   800149 <_panic>
+
+00800c84 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800c84:	55                   	push   %ebp
+  800c85:	89 e5                	mov    %esp,%ebp
+  800c87:	57                   	push   %edi
+  800c88:	56                   	push   %esi
+  800c89:	53                   	push   %ebx
+  800c8a:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800c8d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c90:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c93:	b8 05 00 00 00       	mov    $0x5,%eax
+  800c98:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800c9b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800c9e:	8b 75 18             	mov    0x18(%ebp),%esi
+  800ca1:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ca3:	85 c0                	test   %eax,%eax
+  800ca5:	7f 08                	jg     800caf <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  800ca7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800caa:	5b                   	pop    %ebx
+  800cab:	5e                   	pop    %esi
+  800cac:	5f                   	pop    %edi
+  800cad:	5d                   	pop    %ebp
+  800cae:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800caf:	83 ec 0c             	sub    $0xc,%esp
+  800cb2:	50                   	push   %eax
+  800cb3:	6a 05                	push   $0x5
+  800cb5:	68 03 33 80 00       	push   $0x803303
+  800cba:	6a 23                	push   $0x23
+  800cbc:	68 20 33 80 00       	push   $0x803320
+  800cc1:	e8 83 f4 ff ff       	call   800149 <_panic>
+
+00800cc6 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800cc6:	55                   	push   %ebp
+  800cc7:	89 e5                	mov    %esp,%ebp
+  800cc9:	57                   	push   %edi
+  800cca:	56                   	push   %esi
+  800ccb:	53                   	push   %ebx
+  800ccc:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800ccf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cd4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cd7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800cda:	b8 06 00 00 00       	mov    $0x6,%eax
+  800cdf:	89 df                	mov    %ebx,%edi
+  800ce1:	89 de                	mov    %ebx,%esi
+  800ce3:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ce5:	85 c0                	test   %eax,%eax
+  800ce7:	7f 08                	jg     800cf1 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  800ce9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800cec:	5b                   	pop    %ebx
+  800ced:	5e                   	pop    %esi
+  800cee:	5f                   	pop    %edi
+  800cef:	5d                   	pop    %ebp
+  800cf0:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800cf1:	83 ec 0c             	sub    $0xc,%esp
+  800cf4:	50                   	push   %eax
+  800cf5:	6a 06                	push   $0x6
+  800cf7:	68 03 33 80 00       	push   $0x803303
+  800cfc:	6a 23                	push   $0x23
+  800cfe:	68 20 33 80 00       	push   $0x803320
+  800d03:	e8 41 f4 ff ff       	call   800149 <_panic>
+
+00800d08 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  800d08:	55                   	push   %ebp
+  800d09:	89 e5                	mov    %esp,%ebp
+  800d0b:	57                   	push   %edi
+  800d0c:	56                   	push   %esi
+  800d0d:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d0e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d11:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d14:	b8 11 00 00 00       	mov    $0x11,%eax
+  800d19:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d1c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d1f:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d22:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  800d24:	5b                   	pop    %ebx
+  800d25:	5e                   	pop    %esi
+  800d26:	5f                   	pop    %edi
+  800d27:	5d                   	pop    %ebp
+  800d28:	c3                   	ret
+
+00800d29 <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  800d29:	55                   	push   %ebp
+  800d2a:	89 e5                	mov    %esp,%ebp
+  800d2c:	57                   	push   %edi
+  800d2d:	56                   	push   %esi
+  800d2e:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d2f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d32:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d35:	b8 12 00 00 00       	mov    $0x12,%eax
+  800d3a:	be 00 00 00 00       	mov    $0x0,%esi
+  800d3f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d42:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d45:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  800d47:	5b                   	pop    %ebx
+  800d48:	5e                   	pop    %esi
+  800d49:	5f                   	pop    %edi
+  800d4a:	5d                   	pop    %ebp
+  800d4b:	c3                   	ret
+
+00800d4c <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  800d4c:	55                   	push   %ebp
+  800d4d:	89 e5                	mov    %esp,%ebp
+  800d4f:	57                   	push   %edi
+  800d50:	56                   	push   %esi
+  800d51:	53                   	push   %ebx
+  800d52:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800d55:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800d5a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d5d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d60:	b8 16 00 00 00       	mov    $0x16,%eax
+  800d65:	89 df                	mov    %ebx,%edi
+  800d67:	89 de                	mov    %ebx,%esi
+  800d69:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d6b:	85 c0                	test   %eax,%eax
+  800d6d:	7f 08                	jg     800d77 <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  800d6f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d72:	5b                   	pop    %ebx
+  800d73:	5e                   	pop    %esi
+  800d74:	5f                   	pop    %edi
+  800d75:	5d                   	pop    %ebp
+  800d76:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d77:	83 ec 0c             	sub    $0xc,%esp
+  800d7a:	50                   	push   %eax
+  800d7b:	6a 16                	push   $0x16
+  800d7d:	68 03 33 80 00       	push   $0x803303
+  800d82:	6a 23                	push   $0x23
+  800d84:	68 20 33 80 00       	push   $0x803320
+  800d89:	e8 bb f3 ff ff       	call   800149 <_panic>
+
+00800d8e <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  800d8e:	55                   	push   %ebp
+  800d8f:	89 e5                	mov    %esp,%ebp
+  800d91:	57                   	push   %edi
+  800d92:	56                   	push   %esi
+  800d93:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d94:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d99:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d9c:	b8 17 00 00 00       	mov    $0x17,%eax
+  800da1:	89 cb                	mov    %ecx,%ebx
+  800da3:	89 cf                	mov    %ecx,%edi
+  800da5:	89 ce                	mov    %ecx,%esi
+  800da7:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  800da9:	5b                   	pop    %ebx
+  800daa:	5e                   	pop    %esi
+  800dab:	5f                   	pop    %edi
+  800dac:	5d                   	pop    %ebp
+  800dad:	c3                   	ret
+
+00800dae <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  800dae:	55                   	push   %ebp
+  800daf:	89 e5                	mov    %esp,%ebp
+  800db1:	57                   	push   %edi
+  800db2:	56                   	push   %esi
+  800db3:	53                   	push   %ebx
+  800db4:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800db7:	be 00 00 00 00       	mov    $0x0,%esi
+  800dbc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dbf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dc2:	b8 18 00 00 00       	mov    $0x18,%eax
+  800dc7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800dca:	89 f7                	mov    %esi,%edi
+  800dcc:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800dce:	85 c0                	test   %eax,%eax
+  800dd0:	7f 08                	jg     800dda <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  800dd2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dd5:	5b                   	pop    %ebx
+  800dd6:	5e                   	pop    %esi
+  800dd7:	5f                   	pop    %edi
+  800dd8:	5d                   	pop    %ebp
+  800dd9:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800dda:	83 ec 0c             	sub    $0xc,%esp
+  800ddd:	50                   	push   %eax
+  800dde:	6a 18                	push   $0x18
+  800de0:	68 03 33 80 00       	push   $0x803303
+  800de5:	6a 23                	push   $0x23
+  800de7:	68 20 33 80 00       	push   $0x803320
+  800dec:	e8 58 f3 ff ff       	call   800149 <_panic>
+
+00800df1 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  800df1:	55                   	push   %ebp
+  800df2:	89 e5                	mov    %esp,%ebp
+  800df4:	57                   	push   %edi
+  800df5:	56                   	push   %esi
+  800df6:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800df7:	be 00 00 00 00       	mov    $0x0,%esi
+  800dfc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e02:	b8 19 00 00 00       	mov    $0x19,%eax
+  800e07:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e0a:	89 f7                	mov    %esi,%edi
+  800e0c:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  800e0e:	5b                   	pop    %ebx
+  800e0f:	5e                   	pop    %esi
+  800e10:	5f                   	pop    %edi
+  800e11:	5d                   	pop    %ebp
+  800e12:	c3                   	ret
+
+00800e13 <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  800e13:	55                   	push   %ebp
+  800e14:	89 e5                	mov    %esp,%ebp
+  800e16:	57                   	push   %edi
+  800e17:	56                   	push   %esi
+  800e18:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e19:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e1e:	b8 15 00 00 00       	mov    $0x15,%eax
+  800e23:	89 d1                	mov    %edx,%ecx
+  800e25:	89 d3                	mov    %edx,%ebx
+  800e27:	89 d7                	mov    %edx,%edi
+  800e29:	89 d6                	mov    %edx,%esi
+  800e2b:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800e2d:	5b                   	pop    %ebx
+  800e2e:	5e                   	pop    %esi
+  800e2f:	5f                   	pop    %edi
+  800e30:	5d                   	pop    %ebp
+  800e31:	c3                   	ret
+
+00800e32 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800e32:	55                   	push   %ebp
+  800e33:	89 e5                	mov    %esp,%ebp
+  800e35:	57                   	push   %edi
+  800e36:	56                   	push   %esi
+  800e37:	53                   	push   %ebx
+  800e38:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e3b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e40:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e43:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e46:	b8 08 00 00 00       	mov    $0x8,%eax
+  800e4b:	89 df                	mov    %ebx,%edi
+  800e4d:	89 de                	mov    %ebx,%esi
+  800e4f:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e51:	85 c0                	test   %eax,%eax
+  800e53:	7f 08                	jg     800e5d <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800e55:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e58:	5b                   	pop    %ebx
+  800e59:	5e                   	pop    %esi
+  800e5a:	5f                   	pop    %edi
+  800e5b:	5d                   	pop    %ebp
+  800e5c:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e5d:	83 ec 0c             	sub    $0xc,%esp
+  800e60:	50                   	push   %eax
+  800e61:	6a 08                	push   $0x8
+  800e63:	68 03 33 80 00       	push   $0x803303
+  800e68:	6a 23                	push   $0x23
+  800e6a:	68 20 33 80 00       	push   $0x803320
+  800e6f:	e8 d5 f2 ff ff       	call   800149 <_panic>
+
+00800e74 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800e74:	55                   	push   %ebp
+  800e75:	89 e5                	mov    %esp,%ebp
+  800e77:	57                   	push   %edi
+  800e78:	56                   	push   %esi
+  800e79:	53                   	push   %ebx
+  800e7a:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e7d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e82:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e85:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e88:	b8 09 00 00 00       	mov    $0x9,%eax
+  800e8d:	89 df                	mov    %ebx,%edi
+  800e8f:	89 de                	mov    %ebx,%esi
+  800e91:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e93:	85 c0                	test   %eax,%eax
+  800e95:	7f 08                	jg     800e9f <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  800e97:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e9a:	5b                   	pop    %ebx
+  800e9b:	5e                   	pop    %esi
+  800e9c:	5f                   	pop    %edi
+  800e9d:	5d                   	pop    %ebp
+  800e9e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e9f:	83 ec 0c             	sub    $0xc,%esp
+  800ea2:	50                   	push   %eax
+  800ea3:	6a 09                	push   $0x9
+  800ea5:	68 03 33 80 00       	push   $0x803303
+  800eaa:	6a 23                	push   $0x23
+  800eac:	68 20 33 80 00       	push   $0x803320
+  800eb1:	e8 93 f2 ff ff       	call   800149 <_panic>
+
+00800eb6 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800eb6:	55                   	push   %ebp
+  800eb7:	89 e5                	mov    %esp,%ebp
+  800eb9:	57                   	push   %edi
+  800eba:	56                   	push   %esi
+  800ebb:	53                   	push   %ebx
+  800ebc:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800ebf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800ec4:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eca:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ecf:	89 df                	mov    %ebx,%edi
+  800ed1:	89 de                	mov    %ebx,%esi
+  800ed3:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ed5:	85 c0                	test   %eax,%eax
+  800ed7:	7f 08                	jg     800ee1 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  800ed9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800edc:	5b                   	pop    %ebx
+  800edd:	5e                   	pop    %esi
+  800ede:	5f                   	pop    %edi
+  800edf:	5d                   	pop    %ebp
+  800ee0:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ee1:	83 ec 0c             	sub    $0xc,%esp
+  800ee4:	50                   	push   %eax
+  800ee5:	6a 0a                	push   $0xa
+  800ee7:	68 03 33 80 00       	push   $0x803303
+  800eec:	6a 23                	push   $0x23
+  800eee:	68 20 33 80 00       	push   $0x803320
+  800ef3:	e8 51 f2 ff ff       	call   800149 <_panic>
+
+00800ef8 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  800ef8:	55                   	push   %ebp
+  800ef9:	89 e5                	mov    %esp,%ebp
+  800efb:	57                   	push   %edi
+  800efc:	56                   	push   %esi
+  800efd:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800efe:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f01:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f04:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800f09:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f0c:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f0f:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f12:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  800f14:	5b                   	pop    %ebx
+  800f15:	5e                   	pop    %esi
+  800f16:	5f                   	pop    %edi
+  800f17:	5d                   	pop    %ebp
+  800f18:	c3                   	ret
+
+00800f19 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  800f19:	55                   	push   %ebp
+  800f1a:	89 e5                	mov    %esp,%ebp
+  800f1c:	57                   	push   %edi
+  800f1d:	56                   	push   %esi
+  800f1e:	53                   	push   %ebx
+  800f1f:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f22:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f27:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f2a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f2d:	b8 0d 00 00 00       	mov    $0xd,%eax
+  800f32:	89 df                	mov    %ebx,%edi
+  800f34:	89 de                	mov    %ebx,%esi
+  800f36:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f38:	85 c0                	test   %eax,%eax
+  800f3a:	7f 08                	jg     800f44 <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  800f3c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f3f:	5b                   	pop    %ebx
+  800f40:	5e                   	pop    %esi
+  800f41:	5f                   	pop    %edi
+  800f42:	5d                   	pop    %ebp
+  800f43:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f44:	83 ec 0c             	sub    $0xc,%esp
+  800f47:	50                   	push   %eax
+  800f48:	6a 0d                	push   $0xd
+  800f4a:	68 03 33 80 00       	push   $0x803303
+  800f4f:	6a 23                	push   $0x23
+  800f51:	68 20 33 80 00       	push   $0x803320
+  800f56:	e8 ee f1 ff ff       	call   800149 <_panic>
+
+00800f5b <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  800f5b:	55                   	push   %ebp
+  800f5c:	89 e5                	mov    %esp,%ebp
+  800f5e:	57                   	push   %edi
+  800f5f:	56                   	push   %esi
+  800f60:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f61:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f66:	b8 0e 00 00 00       	mov    $0xe,%eax
+  800f6b:	89 d1                	mov    %edx,%ecx
+  800f6d:	89 d3                	mov    %edx,%ebx
+  800f6f:	89 d7                	mov    %edx,%edi
+  800f71:	89 d6                	mov    %edx,%esi
+  800f73:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  800f75:	5b                   	pop    %ebx
+  800f76:	5e                   	pop    %esi
+  800f77:	5f                   	pop    %edi
+  800f78:	5d                   	pop    %ebp
+  800f79:	c3                   	ret
+
+00800f7a <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  800f7a:	55                   	push   %ebp
+  800f7b:	89 e5                	mov    %esp,%ebp
+  800f7d:	57                   	push   %edi
+  800f7e:	56                   	push   %esi
+  800f7f:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f80:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f83:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f86:	b8 0f 00 00 00       	mov    $0xf,%eax
+  800f8b:	be 00 00 00 00       	mov    $0x0,%esi
+  800f90:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f93:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f96:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  800f98:	5b                   	pop    %ebx
+  800f99:	5e                   	pop    %esi
+  800f9a:	5f                   	pop    %edi
+  800f9b:	5d                   	pop    %ebp
+  800f9c:	c3                   	ret
+
+00800f9d <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  800f9d:	55                   	push   %ebp
+  800f9e:	89 e5                	mov    %esp,%ebp
+  800fa0:	57                   	push   %edi
+  800fa1:	56                   	push   %esi
+  800fa2:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800fa3:	be 00 00 00 00       	mov    $0x0,%esi
+  800fa8:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fae:	b8 10 00 00 00       	mov    $0x10,%eax
+  800fb3:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fb6:	89 f7                	mov    %esi,%edi
+  800fb8:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  800fba:	5b                   	pop    %ebx
+  800fbb:	5e                   	pop    %esi
+  800fbc:	5f                   	pop    %edi
+  800fbd:	5d                   	pop    %ebp
+  800fbe:	c3                   	ret
+
+00800fbf <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  800fbf:	55                   	push   %ebp
+  800fc0:	89 e5                	mov    %esp,%ebp
+  800fc2:	57                   	push   %edi
+  800fc3:	56                   	push   %esi
+  800fc4:	53                   	push   %ebx
+  800fc5:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  800fc8:	80 3d 64 57 c0 00 00 	cmpb   $0x0,0xc05764
+  800fcf:	74 41                	je     801012 <sys_batch+0x53>
+  800fd1:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fd4:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  800fd7:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  800fde:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800fe1:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  800fe4:	7d 45                	jge    80102b <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  800fe6:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800fe9:	8b 06                	mov    (%esi),%eax
+  800feb:	8b 56 04             	mov    0x4(%esi),%edx
+  800fee:	8b 4e 08             	mov    0x8(%esi),%ecx
+  800ff1:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  800ff4:	8b 7e 10             	mov    0x10(%esi),%edi
+  800ff7:	8b 76 14             	mov    0x14(%esi),%esi
+  800ffa:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  800ffc:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  800fff:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  801002:	83 c6 1c             	add    $0x1c,%esi
+  801005:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  801008:	85 c0                	test   %eax,%eax
+  80100a:	78 1f                	js     80102b <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  80100c:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  801010:	eb cc                	jmp    800fde <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  801012:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801017:	b8 13 00 00 00       	mov    $0x13,%eax
+  80101c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80101f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801022:	89 df                	mov    %ebx,%edi
+  801024:	89 de                	mov    %ebx,%esi
+  801026:	cd 30                	int    $0x30
+  801028:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  80102b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80102e:	83 c4 08             	add    $0x8,%esp
+  801031:	5b                   	pop    %ebx
+  801032:	5e                   	pop    %esi
+  801033:	5f                   	pop    %edi
+  801034:	5d                   	pop    %ebp
+  801035:	c3                   	ret
+
+00801036 <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  801036:	55                   	push   %ebp
+  801037:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  801039:	8b 45 08             	mov    0x8(%ebp),%eax
+  80103c:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  801042:	5d                   	pop    %ebp
+  801043:	c3                   	ret
+
+00801044 <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  801044:	55                   	push   %ebp
+  801045:	89 e5                	mov    %esp,%ebp
+  801047:	56                   	push   %esi
+  801048:	53                   	push   %ebx
+  801049:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  80104c:	8b 1e                	mov    (%esi),%ebx
+  80104e:	85 db                	test   %ebx,%ebx
+  801050:	75 09                	jne    80105b <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  801052:	89 d8                	mov    %ebx,%eax
+  801054:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801057:	5b                   	pop    %ebx
+  801058:	5e                   	pop    %esi
+  801059:	5d                   	pop    %ebp
+  80105a:	c3                   	ret
+  b->sb_n = 0;
+  80105b:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  801061:	53                   	push   %ebx
+  801062:	8d 46 04             	lea    0x4(%esi),%eax
+  801065:	50                   	push   %eax
+  801066:	e8 54 ff ff ff       	call   800fbf <sys_batch>
+  80106b:	83 c4 08             	add    $0x8,%esp
+  80106e:	85 c0                	test   %eax,%eax
+  801070:	78 1e                	js     801090 <sysbatch_flush+0x4c>
+  if (r < n)
+  801072:	39 c3                	cmp    %eax,%ebx
+  801074:	7f 07                	jg     80107d <sysbatch_flush+0x39>
+  return 0;
+  801076:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80107b:	eb d5                	jmp    801052 <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  80107d:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801080:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  801084:	85 db                	test   %ebx,%ebx
+  801086:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80108b:	0f 49 d8             	cmovns %eax,%ebx
+  80108e:	eb c2                	jmp    801052 <sysbatch_flush+0xe>
+    return r;
+  801090:	89 c3                	mov    %eax,%ebx
+  801092:	eb be                	jmp    801052 <sysbatch_flush+0xe>
+
+00801094 <sysbatch_add>:
+{
+  801094:	55                   	push   %ebp
+  801095:	89 e5                	mov    %esp,%ebp
+  801097:	53                   	push   %ebx
+  801098:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  80109b:	83 3b 40             	cmpl   $0x40,(%ebx)
+  80109e:	74 41                	je     8010e1 <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  8010a0:	8b 03                	mov    (%ebx),%eax
+  8010a2:	8d 50 01             	lea    0x1(%eax),%edx
+  8010a5:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  8010a7:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8010aa:	01 d8                	add    %ebx,%eax
+  8010ac:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8010af:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  8010b2:	8b 55 10             	mov    0x10(%ebp),%edx
+  8010b5:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  8010b8:	8b 55 14             	mov    0x14(%ebp),%edx
+  8010bb:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  8010be:	8b 55 18             	mov    0x18(%ebp),%edx
+  8010c1:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  8010c4:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  8010c7:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  8010ca:	8b 55 20             	mov    0x20(%ebp),%edx
+  8010cd:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  8010d0:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  8010d7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8010dc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8010df:	c9                   	leave
+  8010e0:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  8010e1:	53                   	push   %ebx
+  8010e2:	e8 5d ff ff ff       	call   801044 <sysbatch_flush>
+  8010e7:	83 c4 04             	add    $0x4,%esp
+  8010ea:	85 c0                	test   %eax,%eax
+  8010ec:	79 b2                	jns    8010a0 <sysbatch_add+0xc>
+  8010ee:	eb ec                	jmp    8010dc <sysbatch_add+0x48>
+
+008010f0 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8010f0:	55                   	push   %ebp
+  8010f1:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8010f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010f6:	05 00 00 00 30       	add    $0x30000000,%eax
+  8010fb:	c1 e8 0c             	shr    $0xc,%eax
+}
+  8010fe:	5d                   	pop    %ebp
+  8010ff:	c3                   	ret
+
+00801100 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801100:	55                   	push   %ebp
+  801101:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801103:	8b 45 08             	mov    0x8(%ebp),%eax
+  801106:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  801109:	66 b8 00 00          	mov    $0x0,%ax
+  80110d:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801112:	5d                   	pop    %ebp
+  801113:	c3                   	ret
+
+00801114 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801114:	55                   	push   %ebp
+  801115:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  801117:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80111c:	eb 02                	jmp    801120 <fd_alloc+0xc>
+  80111e:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801120:	89 c2                	mov    %eax,%edx
+  801122:	c1 ea 16             	shr    $0x16,%edx
+  801125:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80112c:	f6 c2 01             	test   $0x1,%dl
+  80112f:	74 2b                	je     80115c <fd_alloc+0x48>
+  801131:	89 c2                	mov    %eax,%edx
+  801133:	c1 ea 0c             	shr    $0xc,%edx
+  801136:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80113d:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801143:	f6 c1 01             	test   $0x1,%cl
+  801146:	74 14                	je     80115c <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  801148:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  80114e:	75 ce                	jne    80111e <fd_alloc+0xa>
+  801150:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  801155:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80115a:	eb 05                	jmp    801161 <fd_alloc+0x4d>
+      return 0;
+  80115c:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  801161:	8b 55 08             	mov    0x8(%ebp),%edx
+  801164:	89 02                	mov    %eax,(%edx)
+}
+  801166:	89 c8                	mov    %ecx,%eax
+  801168:	5d                   	pop    %ebp
+  801169:	c3                   	ret
+
+0080116a <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80116a:	55                   	push   %ebp
+  80116b:	89 e5                	mov    %esp,%ebp
+  80116d:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  801170:	83 f8 1f             	cmp    $0x1f,%eax
+  801173:	77 30                	ja     8011a5 <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  801175:	c1 e0 0c             	shl    $0xc,%eax
+  801178:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80117d:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801183:	f6 c2 01             	test   $0x1,%dl
+  801186:	74 24                	je     8011ac <fd_lookup+0x42>
+  801188:	89 c2                	mov    %eax,%edx
+  80118a:	c1 ea 0c             	shr    $0xc,%edx
+  80118d:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801194:	f6 c2 01             	test   $0x1,%dl
+  801197:	74 1a                	je     8011b3 <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  801199:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80119c:	89 02                	mov    %eax,(%edx)
+  return 0;
+  80119e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011a3:	5d                   	pop    %ebp
+  8011a4:	c3                   	ret
+    return -E_INVAL;
+  8011a5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011aa:	eb f7                	jmp    8011a3 <fd_lookup+0x39>
+    return -E_INVAL;
+  8011ac:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011b1:	eb f0                	jmp    8011a3 <fd_lookup+0x39>
+  8011b3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011b8:	eb e9                	jmp    8011a3 <fd_lookup+0x39>
+
+008011ba <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8011ba:	55                   	push   %ebp
+  8011bb:	89 e5                	mov    %esp,%ebp
+  8011bd:	53                   	push   %ebx
+  8011be:	83 ec 04             	sub    $0x4,%esp
+  8011c1:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  8011c4:	b8 ac 33 80 00       	mov    $0x8033ac,%eax
+  8011c9:	8b 18                	mov    (%eax),%ebx
+  8011cb:	85 db                	test   %ebx,%ebx
+  8011cd:	74 0e                	je     8011dd <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  8011cf:	83 c0 04             	add    $0x4,%eax
+  8011d2:	39 13                	cmp    %edx,(%ebx)
+  8011d4:	75 f3                	jne    8011c9 <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  8011d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011db:	eb 1f                	jmp    8011fc <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8011dd:	a1 60 57 c0 00       	mov    0xc05760,%eax
+  8011e2:	8b 40 48             	mov    0x48(%eax),%eax
+  8011e5:	83 ec 04             	sub    $0x4,%esp
+  8011e8:	52                   	push   %edx
+  8011e9:	50                   	push   %eax
+  8011ea:	68 30 33 80 00       	push   $0x803330
+  8011ef:	e8 30 f0 ff ff       	call   800224 <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  8011f4:	83 c4 10             	add    $0x10,%esp
+  8011f7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  8011fc:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8011ff:	89 1a                	mov    %ebx,(%edx)
+}
+  801201:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801204:	c9                   	leave
+  801205:	c3                   	ret
+
+00801206 <fd_close>:
+{
+  801206:	55                   	push   %ebp
+  801207:	89 e5                	mov    %esp,%ebp
+  801209:	57                   	push   %edi
+  80120a:	56                   	push   %esi
+  80120b:	53                   	push   %ebx
+  80120c:	83 ec 24             	sub    $0x24,%esp
+  80120f:	8b 75 08             	mov    0x8(%ebp),%esi
+  801212:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801215:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801218:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801219:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80121f:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801222:	50                   	push   %eax
+  801223:	e8 42 ff ff ff       	call   80116a <fd_lookup>
+  801228:	89 c3                	mov    %eax,%ebx
+  80122a:	83 c4 10             	add    $0x10,%esp
+  80122d:	85 c0                	test   %eax,%eax
+  80122f:	78 05                	js     801236 <fd_close+0x30>
+      || fd != fd2)
+  801231:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801234:	74 16                	je     80124c <fd_close+0x46>
+    return must_exist ? r : 0;
+  801236:	89 f8                	mov    %edi,%eax
+  801238:	84 c0                	test   %al,%al
+  80123a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80123f:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801242:	89 d8                	mov    %ebx,%eax
+  801244:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801247:	5b                   	pop    %ebx
+  801248:	5e                   	pop    %esi
+  801249:	5f                   	pop    %edi
+  80124a:	5d                   	pop    %ebp
+  80124b:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80124c:	83 ec 08             	sub    $0x8,%esp
+  80124f:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801252:	50                   	push   %eax
+  801253:	ff 36                	push   (%esi)
+  801255:	e8 60 ff ff ff       	call   8011ba <dev_lookup>
+  80125a:	89 c3                	mov    %eax,%ebx
+  80125c:	83 c4 10             	add    $0x10,%esp
+  80125f:	85 c0                	test   %eax,%eax
+  801261:	78 1a                	js     80127d <fd_close+0x77>
+    if (dev->dev_close)
+  801263:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801266:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  801269:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  80126e:	85 c0                	test   %eax,%eax
+  801270:	74 0b                	je     80127d <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  801272:	83 ec 0c             	sub    $0xc,%esp
+  801275:	56                   	push   %esi
+  801276:	ff d0                	call   *%eax
+  801278:	89 c3                	mov    %eax,%ebx
+  80127a:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  80127d:	83 ec 08             	sub    $0x8,%esp
+  801280:	56                   	push   %esi
+  801281:	6a 00                	push   $0x0
+  801283:	e8 3e fa ff ff       	call   800cc6 <sys_page_unmap>
+  return r;
+  801288:	83 c4 10             	add    $0x10,%esp
+  80128b:	eb b5                	jmp    801242 <fd_close+0x3c>
+
+0080128d <close>:
+
+int
+close(int fdnum)
+{
+  80128d:	55                   	push   %ebp
+  80128e:	89 e5                	mov    %esp,%ebp
+  801290:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801293:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801296:	50                   	push   %eax
+  801297:	ff 75 08             	push   0x8(%ebp)
+  80129a:	e8 cb fe ff ff       	call   80116a <fd_lookup>
+  80129f:	83 c4 10             	add    $0x10,%esp
+  8012a2:	85 c0                	test   %eax,%eax
+  8012a4:	79 02                	jns    8012a8 <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  8012a6:	c9                   	leave
+  8012a7:	c3                   	ret
+    return fd_close(fd, 1);
+  8012a8:	83 ec 08             	sub    $0x8,%esp
+  8012ab:	6a 01                	push   $0x1
+  8012ad:	ff 75 f4             	push   -0xc(%ebp)
+  8012b0:	e8 51 ff ff ff       	call   801206 <fd_close>
+  8012b5:	83 c4 10             	add    $0x10,%esp
+  8012b8:	eb ec                	jmp    8012a6 <close+0x19>
+
+008012ba <close_all>:
+
+void
+close_all(void)
+{
+  8012ba:	55                   	push   %ebp
+  8012bb:	89 e5                	mov    %esp,%ebp
+  8012bd:	53                   	push   %ebx
+  8012be:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  8012c1:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  8012c6:	83 ec 0c             	sub    $0xc,%esp
+  8012c9:	53                   	push   %ebx
+  8012ca:	e8 be ff ff ff       	call   80128d <close>
+  for (i = 0; i < MAXFD; i++)
+  8012cf:	83 c3 01             	add    $0x1,%ebx
+  8012d2:	83 c4 10             	add    $0x10,%esp
+  8012d5:	83 fb 20             	cmp    $0x20,%ebx
+  8012d8:	75 ec                	jne    8012c6 <close_all+0xc>
+}
+  8012da:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012dd:	c9                   	leave
+  8012de:	c3                   	ret
+
+008012df <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8012df:	55                   	push   %ebp
+  8012e0:	89 e5                	mov    %esp,%ebp
+  8012e2:	57                   	push   %edi
+  8012e3:	56                   	push   %esi
+  8012e4:	53                   	push   %ebx
+  8012e5:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8012e8:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8012eb:	50                   	push   %eax
+  8012ec:	ff 75 08             	push   0x8(%ebp)
+  8012ef:	e8 76 fe ff ff       	call   80116a <fd_lookup>
+  8012f4:	89 c6                	mov    %eax,%esi
+  8012f6:	83 c4 10             	add    $0x10,%esp
+  8012f9:	85 c0                	test   %eax,%eax
+  8012fb:	0f 88 0a 01 00 00    	js     80140b <dup+0x12c>
+    return r;
+  close(newfdnum);
+  801301:	83 ec 0c             	sub    $0xc,%esp
+  801304:	ff 75 0c             	push   0xc(%ebp)
+  801307:	e8 81 ff ff ff       	call   80128d <close>
+
+  newfd = INDEX2FD(newfdnum);
+  80130c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80130f:	c1 e0 0c             	shl    $0xc,%eax
+  801312:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  801318:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  80131b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80131e:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  801321:	89 04 24             	mov    %eax,(%esp)
+  801324:	e8 d7 fd ff ff       	call   801100 <fd2data>
+  801329:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  80132b:	89 3c 24             	mov    %edi,(%esp)
+  80132e:	e8 cd fd ff ff       	call   801100 <fd2data>
+  801333:	83 c4 10             	add    $0x10,%esp
+  801336:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801339:	89 f3                	mov    %esi,%ebx
+  80133b:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  801341:	89 c6                	mov    %eax,%esi
+  801343:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801346:	89 cf                	mov    %ecx,%edi
+  801348:	eb 0c                	jmp    801356 <dup+0x77>
+  80134a:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801350:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801356:	39 fb                	cmp    %edi,%ebx
+  801358:	74 7b                	je     8013d5 <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  80135a:	89 d8                	mov    %ebx,%eax
+  80135c:	c1 e8 16             	shr    $0x16,%eax
+  80135f:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801366:	a8 01                	test   $0x1,%al
+  801368:	74 e0                	je     80134a <dup+0x6b>
+  80136a:	89 d8                	mov    %ebx,%eax
+  80136c:	c1 e8 0c             	shr    $0xc,%eax
+  80136f:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801376:	f6 c2 01             	test   $0x1,%dl
+  801379:	74 cf                	je     80134a <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  80137b:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  801382:	83 ec 0c             	sub    $0xc,%esp
+  801385:	25 07 0e 00 00       	and    $0xe07,%eax
+  80138a:	50                   	push   %eax
+  80138b:	56                   	push   %esi
+  80138c:	6a 00                	push   $0x0
+  80138e:	53                   	push   %ebx
+  80138f:	6a 00                	push   $0x0
+  801391:	e8 ee f8 ff ff       	call   800c84 <sys_page_map>
+  801396:	83 c4 20             	add    $0x20,%esp
+  801399:	85 c0                	test   %eax,%eax
+  80139b:	79 ad                	jns    80134a <dup+0x6b>
+  80139d:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8013a0:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  8013a2:	83 ec 08             	sub    $0x8,%esp
+  8013a5:	ff 75 d4             	push   -0x2c(%ebp)
+  8013a8:	6a 00                	push   $0x0
+  8013aa:	e8 17 f9 ff ff       	call   800cc6 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8013af:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  8013b2:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  8013b8:	83 c4 10             	add    $0x10,%esp
+  8013bb:	39 df                	cmp    %ebx,%edi
+  8013bd:	74 4c                	je     80140b <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  8013bf:	83 ec 08             	sub    $0x8,%esp
+  8013c2:	57                   	push   %edi
+  8013c3:	6a 00                	push   $0x0
+  8013c5:	e8 fc f8 ff ff       	call   800cc6 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8013ca:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  8013d0:	83 c4 10             	add    $0x10,%esp
+  8013d3:	eb e6                	jmp    8013bb <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8013d5:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8013d8:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8013db:	89 c8                	mov    %ecx,%eax
+  8013dd:	c1 e8 0c             	shr    $0xc,%eax
+  8013e0:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8013e7:	83 ec 0c             	sub    $0xc,%esp
+  8013ea:	25 07 0e 00 00       	and    $0xe07,%eax
+  8013ef:	50                   	push   %eax
+  8013f0:	ff 75 d4             	push   -0x2c(%ebp)
+  8013f3:	6a 00                	push   $0x0
+  8013f5:	51                   	push   %ecx
+  8013f6:	6a 00                	push   $0x0
+  8013f8:	e8 87 f8 ff ff       	call   800c84 <sys_page_map>
+  8013fd:	89 c6                	mov    %eax,%esi
+  8013ff:	83 c4 20             	add    $0x20,%esp
+  801402:	85 c0                	test   %eax,%eax
+  801404:	78 9c                	js     8013a2 <dup+0xc3>
+  return newfdnum;
+  801406:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801409:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  80140b:	89 f0                	mov    %esi,%eax
+  80140d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801410:	5b                   	pop    %ebx
+  801411:	5e                   	pop    %esi
+  801412:	5f                   	pop    %edi
+  801413:	5d                   	pop    %ebp
+  801414:	c3                   	ret
+
+00801415 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801415:	55                   	push   %ebp
+  801416:	89 e5                	mov    %esp,%ebp
+  801418:	56                   	push   %esi
+  801419:	53                   	push   %ebx
+  80141a:	83 ec 18             	sub    $0x18,%esp
+  80141d:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801420:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801423:	50                   	push   %eax
+  801424:	56                   	push   %esi
+  801425:	e8 40 fd ff ff       	call   80116a <fd_lookup>
+  80142a:	83 c4 10             	add    $0x10,%esp
+  80142d:	85 c0                	test   %eax,%eax
+  80142f:	78 3c                	js     80146d <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801431:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801434:	83 ec 08             	sub    $0x8,%esp
+  801437:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80143a:	50                   	push   %eax
+  80143b:	ff 33                	push   (%ebx)
+  80143d:	e8 78 fd ff ff       	call   8011ba <dev_lookup>
+  801442:	83 c4 10             	add    $0x10,%esp
+  801445:	85 c0                	test   %eax,%eax
+  801447:	78 24                	js     80146d <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801449:	8b 43 08             	mov    0x8(%ebx),%eax
+  80144c:	83 e0 03             	and    $0x3,%eax
+  80144f:	83 f8 01             	cmp    $0x1,%eax
+  801452:	74 20                	je     801474 <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  801454:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801457:	8b 40 08             	mov    0x8(%eax),%eax
+  80145a:	85 c0                	test   %eax,%eax
+  80145c:	74 37                	je     801495 <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  80145e:	83 ec 04             	sub    $0x4,%esp
+  801461:	ff 75 10             	push   0x10(%ebp)
+  801464:	ff 75 0c             	push   0xc(%ebp)
+  801467:	53                   	push   %ebx
+  801468:	ff d0                	call   *%eax
+  80146a:	83 c4 10             	add    $0x10,%esp
+}
+  80146d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801470:	5b                   	pop    %ebx
+  801471:	5e                   	pop    %esi
+  801472:	5d                   	pop    %ebp
+  801473:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801474:	a1 60 57 c0 00       	mov    0xc05760,%eax
+  801479:	8b 40 48             	mov    0x48(%eax),%eax
+  80147c:	83 ec 04             	sub    $0x4,%esp
+  80147f:	56                   	push   %esi
+  801480:	50                   	push   %eax
+  801481:	68 71 33 80 00       	push   $0x803371
+  801486:	e8 99 ed ff ff       	call   800224 <cprintf>
+    return -E_INVAL;
+  80148b:	83 c4 10             	add    $0x10,%esp
+  80148e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801493:	eb d8                	jmp    80146d <read+0x58>
+    return -E_NOT_SUPP;
+  801495:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80149a:	eb d1                	jmp    80146d <read+0x58>
+
+0080149c <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80149c:	55                   	push   %ebp
+  80149d:	89 e5                	mov    %esp,%ebp
+  80149f:	57                   	push   %edi
+  8014a0:	56                   	push   %esi
+  8014a1:	53                   	push   %ebx
+  8014a2:	83 ec 0c             	sub    $0xc,%esp
+  8014a5:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8014a8:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  8014ab:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014b0:	eb 02                	jmp    8014b4 <readn+0x18>
+  8014b2:	01 c3                	add    %eax,%ebx
+  8014b4:	39 f3                	cmp    %esi,%ebx
+  8014b6:	73 21                	jae    8014d9 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  8014b8:	83 ec 04             	sub    $0x4,%esp
+  8014bb:	89 f0                	mov    %esi,%eax
+  8014bd:	29 d8                	sub    %ebx,%eax
+  8014bf:	50                   	push   %eax
+  8014c0:	89 d8                	mov    %ebx,%eax
+  8014c2:	03 45 0c             	add    0xc(%ebp),%eax
+  8014c5:	50                   	push   %eax
+  8014c6:	57                   	push   %edi
+  8014c7:	e8 49 ff ff ff       	call   801415 <read>
+    if (m < 0)
+  8014cc:	83 c4 10             	add    $0x10,%esp
+  8014cf:	85 c0                	test   %eax,%eax
+  8014d1:	78 04                	js     8014d7 <readn+0x3b>
+      return m;
+    if (m == 0)
+  8014d3:	75 dd                	jne    8014b2 <readn+0x16>
+  8014d5:	eb 02                	jmp    8014d9 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  8014d7:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  8014d9:	89 d8                	mov    %ebx,%eax
+  8014db:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014de:	5b                   	pop    %ebx
+  8014df:	5e                   	pop    %esi
+  8014e0:	5f                   	pop    %edi
+  8014e1:	5d                   	pop    %ebp
+  8014e2:	c3                   	ret
+
+008014e3 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  8014e3:	55                   	push   %ebp
+  8014e4:	89 e5                	mov    %esp,%ebp
+  8014e6:	56                   	push   %esi
+  8014e7:	53                   	push   %ebx
+  8014e8:	83 ec 18             	sub    $0x18,%esp
+  8014eb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  8014ee:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  8014f1:	50                   	push   %eax
+  8014f2:	53                   	push   %ebx
+  8014f3:	e8 72 fc ff ff       	call   80116a <fd_lookup>
+  8014f8:	83 c4 10             	add    $0x10,%esp
+  8014fb:	85 c0                	test   %eax,%eax
+  8014fd:	78 37                	js     801536 <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8014ff:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801502:	83 ec 08             	sub    $0x8,%esp
+  801505:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801508:	50                   	push   %eax
+  801509:	ff 36                	push   (%esi)
+  80150b:	e8 aa fc ff ff       	call   8011ba <dev_lookup>
+  801510:	83 c4 10             	add    $0x10,%esp
+  801513:	85 c0                	test   %eax,%eax
+  801515:	78 1f                	js     801536 <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801517:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80151b:	74 20                	je     80153d <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  80151d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801520:	8b 40 0c             	mov    0xc(%eax),%eax
+  801523:	85 c0                	test   %eax,%eax
+  801525:	74 37                	je     80155e <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  801527:	83 ec 04             	sub    $0x4,%esp
+  80152a:	ff 75 10             	push   0x10(%ebp)
+  80152d:	ff 75 0c             	push   0xc(%ebp)
+  801530:	56                   	push   %esi
+  801531:	ff d0                	call   *%eax
+  801533:	83 c4 10             	add    $0x10,%esp
+}
+  801536:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801539:	5b                   	pop    %ebx
+  80153a:	5e                   	pop    %esi
+  80153b:	5d                   	pop    %ebp
+  80153c:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  80153d:	a1 60 57 c0 00       	mov    0xc05760,%eax
+  801542:	8b 40 48             	mov    0x48(%eax),%eax
+  801545:	83 ec 04             	sub    $0x4,%esp
+  801548:	53                   	push   %ebx
+  801549:	50                   	push   %eax
+  80154a:	68 8d 33 80 00       	push   $0x80338d
+  80154f:	e8 d0 ec ff ff       	call   800224 <cprintf>
+    return -E_INVAL;
+  801554:	83 c4 10             	add    $0x10,%esp
+  801557:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80155c:	eb d8                	jmp    801536 <write+0x53>
+    return -E_NOT_SUPP;
+  80155e:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801563:	eb d1                	jmp    801536 <write+0x53>
+
+00801565 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801565:	55                   	push   %ebp
+  801566:	89 e5                	mov    %esp,%ebp
+  801568:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80156b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80156e:	50                   	push   %eax
+  80156f:	ff 75 08             	push   0x8(%ebp)
+  801572:	e8 f3 fb ff ff       	call   80116a <fd_lookup>
+  801577:	83 c4 10             	add    $0x10,%esp
+  80157a:	85 c0                	test   %eax,%eax
+  80157c:	78 0e                	js     80158c <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  80157e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801581:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801584:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  801587:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80158c:	c9                   	leave
+  80158d:	c3                   	ret
+
+0080158e <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  80158e:	55                   	push   %ebp
+  80158f:	89 e5                	mov    %esp,%ebp
+  801591:	56                   	push   %esi
+  801592:	53                   	push   %ebx
+  801593:	83 ec 18             	sub    $0x18,%esp
+  801596:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801599:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80159c:	50                   	push   %eax
+  80159d:	53                   	push   %ebx
+  80159e:	e8 c7 fb ff ff       	call   80116a <fd_lookup>
+  8015a3:	83 c4 10             	add    $0x10,%esp
+  8015a6:	85 c0                	test   %eax,%eax
+  8015a8:	78 34                	js     8015de <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8015aa:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8015ad:	83 ec 08             	sub    $0x8,%esp
+  8015b0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8015b3:	50                   	push   %eax
+  8015b4:	ff 36                	push   (%esi)
+  8015b6:	e8 ff fb ff ff       	call   8011ba <dev_lookup>
+  8015bb:	83 c4 10             	add    $0x10,%esp
+  8015be:	85 c0                	test   %eax,%eax
+  8015c0:	78 1c                	js     8015de <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8015c2:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  8015c6:	74 1d                	je     8015e5 <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  8015c8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8015cb:	8b 40 18             	mov    0x18(%eax),%eax
+  8015ce:	85 c0                	test   %eax,%eax
+  8015d0:	74 34                	je     801606 <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  8015d2:	83 ec 08             	sub    $0x8,%esp
+  8015d5:	ff 75 0c             	push   0xc(%ebp)
+  8015d8:	56                   	push   %esi
+  8015d9:	ff d0                	call   *%eax
+  8015db:	83 c4 10             	add    $0x10,%esp
+}
+  8015de:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015e1:	5b                   	pop    %ebx
+  8015e2:	5e                   	pop    %esi
+  8015e3:	5d                   	pop    %ebp
+  8015e4:	c3                   	ret
+            thisenv->env_id, fdnum);
+  8015e5:	a1 60 57 c0 00       	mov    0xc05760,%eax
+  8015ea:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8015ed:	83 ec 04             	sub    $0x4,%esp
+  8015f0:	53                   	push   %ebx
+  8015f1:	50                   	push   %eax
+  8015f2:	68 50 33 80 00       	push   $0x803350
+  8015f7:	e8 28 ec ff ff       	call   800224 <cprintf>
+    return -E_INVAL;
+  8015fc:	83 c4 10             	add    $0x10,%esp
+  8015ff:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801604:	eb d8                	jmp    8015de <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  801606:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80160b:	eb d1                	jmp    8015de <ftruncate+0x50>
+
+0080160d <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80160d:	55                   	push   %ebp
+  80160e:	89 e5                	mov    %esp,%ebp
+  801610:	56                   	push   %esi
+  801611:	53                   	push   %ebx
+  801612:	83 ec 18             	sub    $0x18,%esp
+  801615:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801618:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80161b:	50                   	push   %eax
+  80161c:	ff 75 08             	push   0x8(%ebp)
+  80161f:	e8 46 fb ff ff       	call   80116a <fd_lookup>
+  801624:	83 c4 10             	add    $0x10,%esp
+  801627:	85 c0                	test   %eax,%eax
+  801629:	78 49                	js     801674 <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80162b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80162e:	83 ec 08             	sub    $0x8,%esp
+  801631:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801634:	50                   	push   %eax
+  801635:	ff 36                	push   (%esi)
+  801637:	e8 7e fb ff ff       	call   8011ba <dev_lookup>
+  80163c:	83 c4 10             	add    $0x10,%esp
+  80163f:	85 c0                	test   %eax,%eax
+  801641:	78 31                	js     801674 <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  801643:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801646:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  80164a:	74 2f                	je     80167b <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  80164c:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  80164f:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801656:	00 00 00 
+  stat->st_isdir = 0;
+  801659:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801660:	00 00 00 
+  stat->st_dev = dev;
+  801663:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  801669:	83 ec 08             	sub    $0x8,%esp
+  80166c:	53                   	push   %ebx
+  80166d:	56                   	push   %esi
+  80166e:	ff 50 14             	call   *0x14(%eax)
+  801671:	83 c4 10             	add    $0x10,%esp
+}
+  801674:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801677:	5b                   	pop    %ebx
+  801678:	5e                   	pop    %esi
+  801679:	5d                   	pop    %ebp
+  80167a:	c3                   	ret
+    return -E_NOT_SUPP;
+  80167b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801680:	eb f2                	jmp    801674 <fstat+0x67>
+
+00801682 <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  801682:	55                   	push   %ebp
+  801683:	89 e5                	mov    %esp,%ebp
+  801685:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  801688:	ff 75 0c             	push   0xc(%ebp)
+  80168b:	ff 75 08             	push   0x8(%ebp)
+  80168e:	e8 58 07 00 00       	call   801deb <file_stat>
+}
+  801693:	c9                   	leave
+  801694:	c3                   	ret
+
+00801695 <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  801695:	55                   	push   %ebp
+  801696:	89 e5                	mov    %esp,%ebp
+  801698:	57                   	push   %edi
+  801699:	56                   	push   %esi
+  80169a:	53                   	push   %ebx
+  80169b:	83 ec 1c             	sub    $0x1c,%esp
+  80169e:	89 c7                	mov    %eax,%edi
+  8016a0:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  8016a3:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  8016a6:	e9 a2 00 00 00       	jmp    80174d <fsipc_send+0xb8>
+  nfsenvs = 0;
+  8016ab:	c7 05 00 50 80 00 00 	movl   $0x0,0x805000
+  8016b2:	00 00 00 
+  8016b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016ba:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  8016bf:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  8016c4:	be 01 00 00 00       	mov    $0x1,%esi
+  8016c9:	eb 0f                	jmp    8016da <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  8016cb:	83 c0 01             	add    $0x1,%eax
+  8016ce:	3d 00 04 00 00       	cmp    $0x400,%eax
+  8016d3:	74 49                	je     80171e <fsipc_send+0x89>
+  8016d5:	83 f9 07             	cmp    $0x7,%ecx
+  8016d8:	7f 50                	jg     80172a <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  8016da:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  8016dd:	c1 e2 04             	shl    $0x4,%edx
+  8016e0:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8016e6:	8b 52 50             	mov    0x50(%edx),%edx
+  8016e9:	83 fa 01             	cmp    $0x1,%edx
+  8016ec:	75 dd                	jne    8016cb <fsipc_send+0x36>
+  8016ee:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  8016f1:	c1 e2 04             	shl    $0x4,%edx
+  8016f4:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  8016fa:	8b 52 54             	mov    0x54(%edx),%edx
+  8016fd:	85 d2                	test   %edx,%edx
+  8016ff:	74 ca                	je     8016cb <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801701:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801704:	c1 e2 04             	shl    $0x4,%edx
+  801707:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80170d:	8b 52 48             	mov    0x48(%edx),%edx
+  801710:	89 14 8d 20 50 80 00 	mov    %edx,0x805020(,%ecx,4)
+  801717:	8d 49 01             	lea    0x1(%ecx),%ecx
+  80171a:	89 f3                	mov    %esi,%ebx
+  80171c:	eb ad                	jmp    8016cb <fsipc_send+0x36>
+  80171e:	84 db                	test   %bl,%bl
+  801720:	74 38                	je     80175a <fsipc_send+0xc5>
+  801722:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  801728:	eb 30                	jmp    80175a <fsipc_send+0xc5>
+  80172a:	84 db                	test   %bl,%bl
+  80172c:	74 2c                	je     80175a <fsipc_send+0xc5>
+  80172e:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  801734:	eb 24                	jmp    80175a <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  801736:	50                   	push   %eax
+  801737:	68 bc 33 80 00       	push   $0x8033bc
+  80173c:	6a 34                	push   $0x34
+  80173e:	68 c6 33 80 00       	push   $0x8033c6
+  801743:	e8 01 ea ff ff       	call   800149 <_panic>
+    }
+    sys_yield();
+  801748:	e8 92 f4 ff ff       	call   800bdf <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  80174d:	83 3d 00 50 80 00 03 	cmpl   $0x3,0x805000
+  801754:	0f 8e 51 ff ff ff    	jle    8016ab <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  80175a:	a1 60 57 c0 00       	mov    0xc05760,%eax
+  80175f:	8b 70 48             	mov    0x48(%eax),%esi
+  801762:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  801768:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80176d:	8b 0d 00 50 80 00    	mov    0x805000,%ecx
+  801773:	39 d9                	cmp    %ebx,%ecx
+  801775:	7e d1                	jle    801748 <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  801777:	83 ec 0c             	sub    $0xc,%esp
+  80177a:	ff 75 e0             	push   -0x20(%ebp)
+  80177d:	6a 07                	push   $0x7
+  80177f:	ff 75 e4             	push   -0x1c(%ebp)
+  801782:	57                   	push   %edi
+  801783:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  801786:	99                   	cltd
+  801787:	f7 f9                	idiv   %ecx
+  801789:	ff 34 95 20 50 80 00 	push   0x805020(,%edx,4)
+  801790:	e8 63 f7 ff ff       	call   800ef8 <sys_ipc_try_send>
+      if (r == 0)
+  801795:	83 c4 20             	add    $0x20,%esp
+  801798:	85 c0                	test   %eax,%eax
+  80179a:	74 0a                	je     8017a6 <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  80179c:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  80179f:	75 95                	jne    801736 <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  8017a1:	83 c3 01             	add    $0x1,%ebx
+  8017a4:	eb c7                	jmp    80176d <fsipc_send+0xd8>
+  }
+}
+  8017a6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8017a9:	5b                   	pop    %ebx
+  8017aa:	5e                   	pop    %esi
+  8017ab:	5f                   	pop    %edi
+  8017ac:	5d                   	pop    %ebp
+  8017ad:	c3                   	ret
+
+008017ae <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  8017ae:	55                   	push   %ebp
+  8017af:	89 e5                	mov    %esp,%ebp
+  8017b1:	53                   	push   %ebx
+  8017b2:	83 ec 14             	sub    $0x14,%esp
+  8017b5:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  8017b7:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  8017be:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8017c3:	ba 00 60 c0 00       	mov    $0xc06000,%edx
+  8017c8:	e8 c8 fe ff ff       	call   801695 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  8017cd:	6a 00                	push   $0x0
+  8017cf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017d2:	50                   	push   %eax
+  8017d3:	53                   	push   %ebx
+  8017d4:	6a 00                	push   $0x0
+  8017d6:	e8 26 13 00 00       	call   802b01 <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  8017db:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017de:	c9                   	leave
+  8017df:	c3                   	ret
+
+008017e0 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  8017e0:	55                   	push   %ebp
+  8017e1:	89 e5                	mov    %esp,%ebp
+  8017e3:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8017e6:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017e9:	8b 40 0c             	mov    0xc(%eax),%eax
+  8017ec:	a3 00 60 c0 00       	mov    %eax,0xc06000
+  fsipcbuf.set_size.req_size = newsize;
+  8017f1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8017f4:	a3 04 60 c0 00       	mov    %eax,0xc06004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  8017f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017fe:	b8 02 00 00 00       	mov    $0x2,%eax
+  801803:	e8 a6 ff ff ff       	call   8017ae <fsipc>
+}
+  801808:	c9                   	leave
+  801809:	c3                   	ret
+
+0080180a <devfile_flush>:
+{
+  80180a:	55                   	push   %ebp
+  80180b:	89 e5                	mov    %esp,%ebp
+  80180d:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801810:	8b 45 08             	mov    0x8(%ebp),%eax
+  801813:	8b 40 0c             	mov    0xc(%eax),%eax
+  801816:	a3 00 60 c0 00       	mov    %eax,0xc06000
+  return fsipc(FSREQ_FLUSH, NULL);
+  80181b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801820:	b8 06 00 00 00       	mov    $0x6,%eax
+  801825:	e8 84 ff ff ff       	call   8017ae <fsipc>
+}
+  80182a:	c9                   	leave
+  80182b:	c3                   	ret
+
+0080182c <devfile_stat>:
+{
+  80182c:	55                   	push   %ebp
+  80182d:	89 e5                	mov    %esp,%ebp
+  80182f:	53                   	push   %ebx
+  801830:	83 ec 04             	sub    $0x4,%esp
+  801833:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801836:	8b 45 08             	mov    0x8(%ebp),%eax
+  801839:	8b 40 0c             	mov    0xc(%eax),%eax
+  80183c:	a3 00 60 c0 00       	mov    %eax,0xc06000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801841:	ba 00 00 00 00       	mov    $0x0,%edx
+  801846:	b8 05 00 00 00       	mov    $0x5,%eax
+  80184b:	e8 5e ff ff ff       	call   8017ae <fsipc>
+  801850:	85 c0                	test   %eax,%eax
+  801852:	78 2c                	js     801880 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801854:	83 ec 08             	sub    $0x8,%esp
+  801857:	68 00 60 c0 00       	push   $0xc06000
+  80185c:	53                   	push   %ebx
+  80185d:	e8 b0 ef ff ff       	call   800812 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  801862:	a1 80 60 c0 00       	mov    0xc06080,%eax
+  801867:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80186d:	a1 84 60 c0 00       	mov    0xc06084,%eax
+  801872:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801878:	83 c4 10             	add    $0x10,%esp
+  80187b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801880:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801883:	c9                   	leave
+  801884:	c3                   	ret
+
+00801885 <fsv_alloc>:
+{
+  801885:	55                   	push   %ebp
+  801886:	89 e5                	mov    %esp,%ebp
+  801888:	56                   	push   %esi
+  801889:	53                   	push   %ebx
+  80188a:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  80188c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801891:	eb 22                	jmp    8018b5 <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  801893:	83 ec 04             	sub    $0x4,%esp
+  801896:	6a 00                	push   $0x0
+  801898:	6a 00                	push   $0x0
+  80189a:	6a 07                	push   $0x7
+  80189c:	50                   	push   %eax
+  80189d:	6a 00                	push   $0x0
+  80189f:	6a 04                	push   $0x4
+  8018a1:	68 40 50 80 00       	push   $0x805040
+  8018a6:	e8 e9 f7 ff ff       	call   801094 <sysbatch_add>
+  8018ab:	83 c4 20             	add    $0x20,%esp
+  8018ae:	85 c0                	test   %eax,%eax
+  8018b0:	78 48                	js     8018fa <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  8018b2:	83 c3 01             	add    $0x1,%ebx
+  8018b5:	39 f3                	cmp    %esi,%ebx
+  8018b7:	74 31                	je     8018ea <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  8018b9:	89 d8                	mov    %ebx,%eax
+  8018bb:	c1 e0 0c             	shl    $0xc,%eax
+  8018be:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  8018c3:	89 c2                	mov    %eax,%edx
+  8018c5:	c1 ea 16             	shr    $0x16,%edx
+  8018c8:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  8018cf:	f6 c2 01             	test   $0x1,%dl
+  8018d2:	74 bf                	je     801893 <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  8018d4:	89 c2                	mov    %eax,%edx
+  8018d6:	c1 ea 0c             	shr    $0xc,%edx
+  8018d9:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8018e0:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  8018e3:	83 fa 03             	cmp    $0x3,%edx
+  8018e6:	75 ab                	jne    801893 <fsv_alloc+0xe>
+  8018e8:	eb c8                	jmp    8018b2 <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  8018ea:	83 ec 0c             	sub    $0xc,%esp
+  8018ed:	68 40 50 80 00       	push   $0x805040
+  8018f2:	e8 4d f7 ff ff       	call   801044 <sysbatch_flush>
+  8018f7:	83 c4 10             	add    $0x10,%esp
+}
+  8018fa:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018fd:	5b                   	pop    %ebx
+  8018fe:	5e                   	pop    %esi
+  8018ff:	5d                   	pop    %ebp
+  801900:	c3                   	ret
+
+00801901 <devfile_read>:
+{
+  801901:	55                   	push   %ebp
+  801902:	89 e5                	mov    %esp,%ebp
+  801904:	57                   	push   %edi
+  801905:	56                   	push   %esi
+  801906:	53                   	push   %ebx
+  801907:	83 ec 3c             	sub    $0x3c,%esp
+  80190a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  80190d:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  801913:	77 57                	ja     80196c <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801915:	8b 45 08             	mov    0x8(%ebp),%eax
+  801918:	8b 40 0c             	mov    0xc(%eax),%eax
+  80191b:	a3 00 60 c0 00       	mov    %eax,0xc06000
+  fsipcbuf.read.req_n = n;
+  801920:	89 1d 04 60 c0 00    	mov    %ebx,0xc06004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801926:	ba 00 00 00 00       	mov    $0x0,%edx
+  80192b:	b8 03 00 00 00       	mov    $0x3,%eax
+  801930:	e8 79 fe ff ff       	call   8017ae <fsipc>
+  801935:	89 c6                	mov    %eax,%esi
+  801937:	85 c0                	test   %eax,%eax
+  801939:	78 27                	js     801962 <devfile_read+0x61>
+  assert(r <= n);
+  80193b:	39 c3                	cmp    %eax,%ebx
+  80193d:	0f 82 0e 02 00 00    	jb     801b51 <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  801943:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801948:	0f 8f 1c 02 00 00    	jg     801b6a <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  80194e:	83 ec 04             	sub    $0x4,%esp
+  801951:	50                   	push   %eax
+  801952:	68 00 60 c0 00       	push   $0xc06000
+  801957:	ff 75 0c             	push   0xc(%ebp)
+  80195a:	e8 39 f0 ff ff       	call   800998 <memmove>
+  return r;
+  80195f:	83 c4 10             	add    $0x10,%esp
+}
+  801962:	89 f0                	mov    %esi,%eax
+  801964:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801967:	5b                   	pop    %ebx
+  801968:	5e                   	pop    %esi
+  801969:	5f                   	pop    %edi
+  80196a:	5d                   	pop    %ebp
+  80196b:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  80196c:	b8 01 00 00 00       	mov    $0x1,%eax
+  801971:	e8 0f ff ff ff       	call   801885 <fsv_alloc>
+  801976:	89 c6                	mov    %eax,%esi
+  801978:	85 c0                	test   %eax,%eax
+  80197a:	78 e6                	js     801962 <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  80197c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80197f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801982:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  801987:	8b 45 08             	mov    0x8(%ebp),%eax
+  80198a:	8b 40 04             	mov    0x4(%eax),%eax
+  80198d:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  801992:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  801998:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  80199f:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8019a4:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  8019a9:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8019ae:	e8 e2 fc ff ff       	call   801695 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  8019b3:	6a 00                	push   $0x0
+  8019b5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8019b8:	50                   	push   %eax
+  8019b9:	68 00 10 c0 9f       	push   $0x9fc01000
+  8019be:	6a 00                	push   $0x0
+  8019c0:	e8 3c 11 00 00       	call   802b01 <ipc_recv_pages>
+  8019c5:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  8019c7:	83 c4 10             	add    $0x10,%esp
+  8019ca:	85 c0                	test   %eax,%eax
+  8019cc:	7e 94                	jle    801962 <devfile_read+0x61>
+  assert(r <= n);
+  8019ce:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8019d1:	39 c3                	cmp    %eax,%ebx
+  8019d3:	72 2e                	jb     801a03 <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  8019d5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8019d8:	8b 40 04             	mov    0x4(%eax),%eax
+  8019db:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8019e0:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  8019e3:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8019e6:	c1 e2 0c             	shl    $0xc,%edx
+  8019e9:	39 ca                	cmp    %ecx,%edx
+  8019eb:	72 2f                	jb     801a1c <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  8019ed:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  8019f2:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  8019f5:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  8019f9:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  8019fe:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  801a01:	eb 52                	jmp    801a55 <devfile_read+0x154>
+  assert(r <= n);
+  801a03:	68 d1 33 80 00       	push   $0x8033d1
+  801a08:	68 d8 33 80 00       	push   $0x8033d8
+  801a0d:	68 49 01 00 00       	push   $0x149
+  801a12:	68 c6 33 80 00       	push   $0x8033c6
+  801a17:	e8 2d e7 ff ff       	call   800149 <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801a1c:	68 fc 33 80 00       	push   $0x8033fc
+  801a21:	68 d8 33 80 00       	push   $0x8033d8
+  801a26:	68 4a 01 00 00       	push   $0x14a
+  801a2b:	68 c6 33 80 00       	push   $0x8033c6
+  801a30:	e8 14 e7 ff ff       	call   800149 <_panic>
+      memmove(dst + done, src + done, m);
+  801a35:	83 ec 04             	sub    $0x4,%esp
+  801a38:	53                   	push   %ebx
+  801a39:	56                   	push   %esi
+  801a3a:	89 f8                	mov    %edi,%eax
+  801a3c:	03 45 0c             	add    0xc(%ebp),%eax
+  801a3f:	50                   	push   %eax
+  801a40:	e8 53 ef ff ff       	call   800998 <memmove>
+  801a45:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  801a48:	01 df                	add    %ebx,%edi
+  801a4a:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801a4d:	39 c7                	cmp    %eax,%edi
+  801a4f:	0f 83 c0 00 00 00    	jae    801b15 <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801a55:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801a58:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  801a5b:	89 f0                	mov    %esi,%eax
+  801a5d:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801a62:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  801a67:	29 c3                	sub    %eax,%ebx
+  801a69:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801a6c:	29 f8                	sub    %edi,%eax
+  801a6e:	39 c3                	cmp    %eax,%ebx
+  801a70:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  801a73:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801a79:	75 ba                	jne    801a35 <devfile_read+0x134>
+  801a7b:	89 f9                	mov    %edi,%ecx
+  801a7d:	03 4d 0c             	add    0xc(%ebp),%ecx
+  801a80:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  801a83:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  801a89:	75 aa                	jne    801a35 <devfile_read+0x134>
+  801a8b:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  801a91:	77 a2                	ja     801a35 <devfile_read+0x134>
+  801a93:	89 c8                	mov    %ecx,%eax
+  801a95:	c1 e8 16             	shr    $0x16,%eax
+  801a98:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801a9f:	a8 01                	test   $0x1,%al
+  801aa1:	74 92                	je     801a35 <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  801aa3:	89 c8                	mov    %ecx,%eax
+  801aa5:	c1 e8 0c             	shr    $0xc,%eax
+  801aa8:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  801aaf:	a8 01                	test   $0x1,%al
+  801ab1:	74 82                	je     801a35 <devfile_read+0x134>
+  801ab3:	a9 02 08 00 00       	test   $0x802,%eax
+  801ab8:	0f 84 77 ff ff ff    	je     801a35 <devfile_read+0x134>
+  801abe:	f6 c4 04             	test   $0x4,%ah
+  801ac1:	0f 85 6e ff ff ff    	jne    801a35 <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  801ac7:	a1 60 57 c0 00       	mov    0xc05760,%eax
+  801acc:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  801ad0:	84 c0                	test   %al,%al
+  801ad2:	75 17                	jne    801aeb <devfile_read+0x1ea>
+  801ad4:	83 ec 08             	sub    $0x8,%esp
+  801ad7:	6a 01                	push   $0x1
+  801ad9:	6a 00                	push   $0x0
+  801adb:	e8 1e f1 ff ff       	call   800bfe <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  801ae0:	83 c4 10             	add    $0x10,%esp
+  801ae3:	85 c0                	test   %eax,%eax
+  801ae5:	0f 85 4a ff ff ff    	jne    801a35 <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  801aeb:	83 ec 04             	sub    $0x4,%esp
+  801aee:	68 05 08 00 00       	push   $0x805
+  801af3:	ff 75 cc             	push   -0x34(%ebp)
+  801af6:	6a 00                	push   $0x0
+  801af8:	56                   	push   %esi
+  801af9:	6a 00                	push   $0x0
+  801afb:	6a 05                	push   $0x5
+  801afd:	68 40 50 80 00       	push   $0x805040
+  801b02:	e8 8d f5 ff ff       	call   801094 <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  801b07:	c1 e8 1f             	shr    $0x1f,%eax
+  801b0a:	08 45 cb             	or     %al,-0x35(%ebp)
+  801b0d:	83 c4 20             	add    $0x20,%esp
+  801b10:	e9 33 ff ff ff       	jmp    801a48 <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  801b15:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  801b18:	83 ec 0c             	sub    $0xc,%esp
+  801b1b:	68 40 50 80 00       	push   $0x805040
+  801b20:	e8 1f f5 ff ff       	call   801044 <sysbatch_flush>
+  801b25:	83 c4 10             	add    $0x10,%esp
+  801b28:	85 c0                	test   %eax,%eax
+  801b2a:	78 06                	js     801b32 <devfile_read+0x231>
+  801b2c:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  801b30:	74 14                	je     801b46 <devfile_read+0x245>
+    memmove(dst, src, r);
+  801b32:	83 ec 04             	sub    $0x4,%esp
+  801b35:	ff 75 d4             	push   -0x2c(%ebp)
+  801b38:	ff 75 d0             	push   -0x30(%ebp)
+  801b3b:	ff 75 0c             	push   0xc(%ebp)
+  801b3e:	e8 55 ee ff ff       	call   800998 <memmove>
+  801b43:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  801b46:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b49:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  801b4c:	e9 11 fe ff ff       	jmp    801962 <devfile_read+0x61>
+  assert(r <= n);
+  801b51:	68 d1 33 80 00       	push   $0x8033d1
+  801b56:	68 d8 33 80 00       	push   $0x8033d8
+  801b5b:	68 1c 01 00 00       	push   $0x11c
+  801b60:	68 c6 33 80 00       	push   $0x8033c6
+  801b65:	e8 df e5 ff ff       	call   800149 <_panic>
+  assert(r <= PGSIZE);
+  801b6a:	68 ed 33 80 00       	push   $0x8033ed
+  801b6f:	68 d8 33 80 00       	push   $0x8033d8
+  801b74:	68 1d 01 00 00       	push   $0x11d
+  801b79:	68 c6 33 80 00       	push   $0x8033c6
+  801b7e:	e8 c6 e5 ff ff       	call   800149 <_panic>
+
+00801b83 <devfile_write>:
+{
+  801b83:	55                   	push   %ebp
+  801b84:	89 e5                	mov    %esp,%ebp
+  801b86:	57                   	push   %edi
+  801b87:	56                   	push   %esi
+  801b88:	53                   	push   %ebx
+  801b89:	83 ec 1c             	sub    $0x1c,%esp
+  801b8c:	8b 75 08             	mov    0x8(%ebp),%esi
+  801b8f:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  801b92:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  801b97:	77 39                	ja     801bd2 <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801b99:	8b 56 0c             	mov    0xc(%esi),%edx
+  801b9c:	89 15 00 60 c0 00    	mov    %edx,0xc06000
+  fsipcbuf.write.req_n = n;
+  801ba2:	a3 04 60 c0 00       	mov    %eax,0xc06004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  801ba7:	83 ec 04             	sub    $0x4,%esp
+  801baa:	50                   	push   %eax
+  801bab:	ff 75 0c             	push   0xc(%ebp)
+  801bae:	68 08 60 c0 00       	push   $0xc06008
+  801bb3:	e8 e0 ed ff ff       	call   800998 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801bb8:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bbd:	b8 04 00 00 00       	mov    $0x4,%eax
+  801bc2:	e8 e7 fb ff ff       	call   8017ae <fsipc>
+  801bc7:	83 c4 10             	add    $0x10,%esp
+}
+  801bca:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bcd:	5b                   	pop    %ebx
+  801bce:	5e                   	pop    %esi
+  801bcf:	5f                   	pop    %edi
+  801bd0:	5d                   	pop    %ebp
+  801bd1:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  801bd2:	ba 00 00 10 00       	mov    $0x100000,%edx
+  801bd7:	39 d0                	cmp    %edx,%eax
+  801bd9:	89 d3                	mov    %edx,%ebx
+  801bdb:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  801bde:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  801be4:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  801be7:	83 c7 01             	add    $0x1,%edi
+  801bea:	89 f8                	mov    %edi,%eax
+  801bec:	e8 94 fc ff ff       	call   801885 <fsv_alloc>
+  801bf1:	85 c0                	test   %eax,%eax
+  801bf3:	78 d5                	js     801bca <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  801bf5:	83 ec 04             	sub    $0x4,%esp
+  801bf8:	53                   	push   %ebx
+  801bf9:	ff 75 0c             	push   0xc(%ebp)
+  801bfc:	68 00 10 c0 9f       	push   $0x9fc01000
+  801c01:	e8 92 ed ff ff       	call   800998 <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  801c06:	8b 46 0c             	mov    0xc(%esi),%eax
+  801c09:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  801c0e:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  801c14:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801c1b:	89 f9                	mov    %edi,%ecx
+  801c1d:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801c22:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801c27:	e8 69 fa ff ff       	call   801695 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801c2c:	6a 00                	push   $0x0
+  801c2e:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801c31:	50                   	push   %eax
+  801c32:	6a 00                	push   $0x0
+  801c34:	6a 00                	push   $0x0
+  801c36:	e8 c6 0e 00 00       	call   802b01 <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  801c3b:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  801c3e:	eb 8a                	jmp    801bca <devfile_write+0x47>
+
+00801c40 <open>:
+{
+  801c40:	55                   	push   %ebp
+  801c41:	89 e5                	mov    %esp,%ebp
+  801c43:	56                   	push   %esi
+  801c44:	53                   	push   %ebx
+  801c45:	83 ec 1c             	sub    $0x1c,%esp
+  801c48:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801c4b:	56                   	push   %esi
+  801c4c:	e8 86 eb ff ff       	call   8007d7 <strlen>
+  801c51:	83 c4 10             	add    $0x10,%esp
+  801c54:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801c59:	7f 6c                	jg     801cc7 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  801c5b:	83 ec 0c             	sub    $0xc,%esp
+  801c5e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c61:	50                   	push   %eax
+  801c62:	e8 ad f4 ff ff       	call   801114 <fd_alloc>
+  801c67:	89 c3                	mov    %eax,%ebx
+  801c69:	83 c4 10             	add    $0x10,%esp
+  801c6c:	85 c0                	test   %eax,%eax
+  801c6e:	78 3c                	js     801cac <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801c70:	83 ec 08             	sub    $0x8,%esp
+  801c73:	56                   	push   %esi
+  801c74:	68 00 60 c0 00       	push   $0xc06000
+  801c79:	e8 94 eb ff ff       	call   800812 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801c7e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801c81:	a3 00 64 c0 00       	mov    %eax,0xc06400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801c86:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801c89:	b8 01 00 00 00       	mov    $0x1,%eax
+  801c8e:	e8 1b fb ff ff       	call   8017ae <fsipc>
+  801c93:	89 c3                	mov    %eax,%ebx
+  801c95:	83 c4 10             	add    $0x10,%esp
+  801c98:	85 c0                	test   %eax,%eax
+  801c9a:	78 19                	js     801cb5 <open+0x75>
+  return fd2num(fd);
+  801c9c:	83 ec 0c             	sub    $0xc,%esp
+  801c9f:	ff 75 f4             	push   -0xc(%ebp)
+  801ca2:	e8 49 f4 ff ff       	call   8010f0 <fd2num>
+  801ca7:	89 c3                	mov    %eax,%ebx
+  801ca9:	83 c4 10             	add    $0x10,%esp
+}
+  801cac:	89 d8                	mov    %ebx,%eax
+  801cae:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801cb1:	5b                   	pop    %ebx
+  801cb2:	5e                   	pop    %esi
+  801cb3:	5d                   	pop    %ebp
+  801cb4:	c3                   	ret
+    fd_close(fd, 0);
+  801cb5:	83 ec 08             	sub    $0x8,%esp
+  801cb8:	6a 00                	push   $0x0
+  801cba:	ff 75 f4             	push   -0xc(%ebp)
+  801cbd:	e8 44 f5 ff ff       	call   801206 <fd_close>
+    return r;
+  801cc2:	83 c4 10             	add    $0x10,%esp
+  801cc5:	eb e5                	jmp    801cac <open+0x6c>
+    return -E_BAD_PATH;
+  801cc7:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801ccc:	eb de                	jmp    801cac <open+0x6c>
+
+00801cce <open_read>:
+{
+  801cce:	55                   	push   %ebp
+  801ccf:	89 e5                	mov    %esp,%ebp
+  801cd1:	57                   	push   %edi
+  801cd2:	56                   	push   %esi
+  801cd3:	53                   	push   %ebx
+  801cd4:	83 ec 28             	sub    $0x28,%esp
+  801cd7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  801cda:	57                   	push   %edi
+  801cdb:	e8 f7 ea ff ff       	call   8007d7 <strlen>
+  801ce0:	83 c4 10             	add    $0x10,%esp
+  801ce3:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801ce8:	0f 87 f6 00 00 00    	ja     801de4 <open_read+0x116>
+  801cee:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  801cf0:	83 ec 0c             	sub    $0xc,%esp
+  801cf3:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801cf6:	50                   	push   %eax
+  801cf7:	e8 18 f4 ff ff       	call   801114 <fd_alloc>
+  801cfc:	89 c3                	mov    %eax,%ebx
+  801cfe:	83 c4 10             	add    $0x10,%esp
+  801d01:	85 c0                	test   %eax,%eax
+  801d03:	0f 88 b2 00 00 00    	js     801dbb <open_read+0xed>
+  strcpy(req->req_buf, path);
+  801d09:	83 ec 08             	sub    $0x8,%esp
+  801d0c:	57                   	push   %edi
+  801d0d:	68 e4 60 c0 00       	push   $0xc060e4
+  801d12:	e8 fb ea ff ff       	call   800812 <strcpy>
+  req->req_nops = 2;
+  801d17:	c7 05 00 60 c0 00 02 	movl   $0x2,0xc06000
+  801d1e:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  801d21:	c7 05 04 60 c0 00 01 	movl   $0x1,0xc06004
+  801d28:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  801d2b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d2e:	a3 10 60 c0 00       	mov    %eax,0xc06010
+  req->req_ops[0].op_buf = 0;
+  801d33:	c7 05 18 60 c0 00 00 	movl   $0x0,0xc06018
+  801d3a:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  801d3d:	c7 05 20 60 c0 00 04 	movl   $0x4,0xc06020
+  801d44:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  801d47:	c7 05 24 60 c0 00 01 	movl   $0x1,0xc06024
+  801d4e:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  801d51:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  801d56:	29 f0                	sub    %esi,%eax
+  801d58:	3b 45 14             	cmp    0x14(%ebp),%eax
+  801d5b:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  801d5f:	a3 2c 60 c0 00       	mov    %eax,0xc0602c
+  req->req_ops[1].op_offset = 0;
+  801d64:	c7 05 30 60 c0 00 00 	movl   $0x0,0xc06030
+  801d6b:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  801d6e:	83 c6 01             	add    $0x1,%esi
+  801d71:	89 35 34 60 c0 00    	mov    %esi,0xc06034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  801d77:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801d7a:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801d7f:	e8 2a fa ff ff       	call   8017ae <fsipc>
+  801d84:	89 c3                	mov    %eax,%ebx
+  801d86:	83 c4 10             	add    $0x10,%esp
+  801d89:	83 f8 01             	cmp    $0x1,%eax
+  801d8c:	7e 37                	jle    801dc5 <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  801d8e:	a1 38 60 c0 00       	mov    0xc06038,%eax
+  801d93:	8b 55 18             	mov    0x18(%ebp),%edx
+  801d96:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  801d98:	83 ec 04             	sub    $0x4,%esp
+  801d9b:	50                   	push   %eax
+  801d9c:	81 c6 e4 60 c0 00    	add    $0xc060e4,%esi
+  801da2:	56                   	push   %esi
+  801da3:	ff 75 10             	push   0x10(%ebp)
+  801da6:	e8 ed eb ff ff       	call   800998 <memmove>
+  return fd2num(fd);
+  801dab:	83 c4 04             	add    $0x4,%esp
+  801dae:	ff 75 e4             	push   -0x1c(%ebp)
+  801db1:	e8 3a f3 ff ff       	call   8010f0 <fd2num>
+  801db6:	89 c3                	mov    %eax,%ebx
+  801db8:	83 c4 10             	add    $0x10,%esp
+}
+  801dbb:	89 d8                	mov    %ebx,%eax
+  801dbd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801dc0:	5b                   	pop    %ebx
+  801dc1:	5e                   	pop    %esi
+  801dc2:	5f                   	pop    %edi
+  801dc3:	5d                   	pop    %ebp
+  801dc4:	c3                   	ret
+    fd_close(fd, 0);
+  801dc5:	83 ec 08             	sub    $0x8,%esp
+  801dc8:	6a 00                	push   $0x0
+  801dca:	ff 75 e4             	push   -0x1c(%ebp)
+  801dcd:	e8 34 f4 ff ff       	call   801206 <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  801dd2:	83 c4 10             	add    $0x10,%esp
+  801dd5:	85 db                	test   %ebx,%ebx
+  801dd7:	78 e2                	js     801dbb <open_read+0xed>
+  801dd9:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  801ddc:	8b 9b 1c 60 c0 00    	mov    0xc0601c(%ebx),%ebx
+  801de2:	eb d7                	jmp    801dbb <open_read+0xed>
+    return -E_BAD_PATH;
+  801de4:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801de9:	eb d0                	jmp    801dbb <open_read+0xed>
+
+00801deb <file_stat>:
+{
+  801deb:	55                   	push   %ebp
+  801dec:	89 e5                	mov    %esp,%ebp
+  801dee:	57                   	push   %edi
+  801def:	56                   	push   %esi
+  801df0:	53                   	push   %ebx
+  801df1:	83 ec 18             	sub    $0x18,%esp
+  801df4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801df7:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801dfa:	57                   	push   %edi
+  801dfb:	e8 d7 e9 ff ff       	call   8007d7 <strlen>
+  801e00:	83 c4 10             	add    $0x10,%esp
+  801e03:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801e08:	0f 8f c7 00 00 00    	jg     801ed5 <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  801e0e:	83 ec 0c             	sub    $0xc,%esp
+  801e11:	57                   	push   %edi
+  801e12:	e8 c0 e9 ff ff       	call   8007d7 <strlen>
+  801e17:	8d 58 04             	lea    0x4(%eax),%ebx
+  801e1a:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  801e1d:	83 c4 08             	add    $0x8,%esp
+  801e20:	57                   	push   %edi
+  801e21:	68 e4 60 c0 00       	push   $0xc060e4
+  801e26:	e8 e7 e9 ff ff       	call   800812 <strcpy>
+  req->req_nops = 2;
+  801e2b:	c7 05 00 60 c0 00 02 	movl   $0x2,0xc06000
+  801e32:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  801e35:	c7 05 04 60 c0 00 02 	movl   $0x2,0xc06004
+  801e3c:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  801e3f:	c7 05 10 60 c0 00 00 	movl   $0x0,0xc06010
+  801e46:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  801e49:	c7 05 18 60 c0 00 00 	movl   $0x0,0xc06018
+  801e50:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  801e53:	c7 05 20 60 c0 00 03 	movl   $0x3,0xc06020
+  801e5a:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  801e5d:	c7 05 24 60 c0 00 01 	movl   $0x1,0xc06024
+  801e64:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  801e67:	89 1d 34 60 c0 00    	mov    %ebx,0xc06034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  801e6d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e72:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801e77:	e8 32 f9 ff ff       	call   8017ae <fsipc>
+  801e7c:	83 c4 10             	add    $0x10,%esp
+  801e7f:	83 f8 01             	cmp    $0x1,%eax
+  801e82:	7e 42                	jle    801ec6 <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  801e84:	81 c3 e4 60 c0 00    	add    $0xc060e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  801e8a:	83 ec 08             	sub    $0x8,%esp
+  801e8d:	53                   	push   %ebx
+  801e8e:	56                   	push   %esi
+  801e8f:	e8 7e e9 ff ff       	call   800812 <strcpy>
+  st->st_size = ret->ret_size;
+  801e94:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  801e9a:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  801ea0:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  801ea6:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  801eac:	c7 86 88 00 00 00 04 	movl   $0x804004,0x88(%esi)
+  801eb3:	40 80 00 
+  return 0;
+  801eb6:	83 c4 10             	add    $0x10,%esp
+  801eb9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ebe:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ec1:	5b                   	pop    %ebx
+  801ec2:	5e                   	pop    %esi
+  801ec3:	5f                   	pop    %edi
+  801ec4:	5d                   	pop    %ebp
+  801ec5:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  801ec6:	85 c0                	test   %eax,%eax
+  801ec8:	78 f4                	js     801ebe <file_stat+0xd3>
+  801eca:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801ecd:	8b 80 1c 60 c0 00    	mov    0xc0601c(%eax),%eax
+  801ed3:	eb e9                	jmp    801ebe <file_stat+0xd3>
+    return -E_BAD_PATH;
+  801ed5:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  801eda:	eb e2                	jmp    801ebe <file_stat+0xd3>
+
+00801edc <read_map>:
+{
+  801edc:	55                   	push   %ebp
+  801edd:	89 e5                	mov    %esp,%ebp
+  801edf:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801ee2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ee5:	50                   	push   %eax
+  801ee6:	ff 75 08             	push   0x8(%ebp)
+  801ee9:	e8 7c f2 ff ff       	call   80116a <fd_lookup>
+  801eee:	83 c4 10             	add    $0x10,%esp
+  801ef1:	85 c0                	test   %eax,%eax
+  801ef3:	78 2a                	js     801f1f <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  801ef5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801ef8:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  801efe:	39 08                	cmp    %ecx,(%eax)
+  801f00:	75 1f                	jne    801f21 <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  801f02:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f05:	a3 00 60 c0 00       	mov    %eax,0xc06000
+  fsipcbuf.read_map.req_offset = offset;
+  801f0a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f0d:	a3 04 60 c0 00       	mov    %eax,0xc06004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  801f12:	8b 55 10             	mov    0x10(%ebp),%edx
+  801f15:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801f1a:	e8 8f f8 ff ff       	call   8017ae <fsipc>
+}
+  801f1f:	c9                   	leave
+  801f20:	c3                   	ret
+    return -E_INVAL;
+  801f21:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f26:	eb f7                	jmp    801f1f <read_map+0x43>
+
+00801f28 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  801f28:	55                   	push   %ebp
+  801f29:	89 e5                	mov    %esp,%ebp
+  801f2b:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  801f2e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f33:	b8 08 00 00 00       	mov    $0x8,%eax
+  801f38:	e8 71 f8 ff ff       	call   8017ae <fsipc>
+}
+  801f3d:	c9                   	leave
+  801f3e:	c3                   	ret
+
+00801f3f <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  801f3f:	55                   	push   %ebp
+  801f40:	89 e5                	mov    %esp,%ebp
+  801f42:	57                   	push   %edi
+  801f43:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  801f44:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f47:	a3 00 60 c0 00       	mov    %eax,0xc06000
+  fsipcbuf.stats.req_bio_sched = 0;
+  801f4c:	c7 05 04 60 c0 00 00 	movl   $0x0,0xc06004
+  801f53:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  801f56:	c7 05 08 60 c0 00 00 	movl   $0x0,0xc06008
+  801f5d:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  801f60:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f65:	b8 09 00 00 00       	mov    $0x9,%eax
+  801f6a:	e8 3f f8 ff ff       	call   8017ae <fsipc>
+  801f6f:	85 c0                	test   %eax,%eax
+  801f71:	78 14                	js     801f87 <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  801f73:	be 00 60 c0 00       	mov    $0xc06000,%esi
+  801f78:	b9 16 00 00 00       	mov    $0x16,%ecx
+  801f7d:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  801f80:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  801f82:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f87:	5e                   	pop    %esi
+  801f88:	5f                   	pop    %edi
+  801f89:	5d                   	pop    %ebp
+  801f8a:	c3                   	ret
+
+00801f8b <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  801f8b:	55                   	push   %ebp
+  801f8c:	89 e5                	mov    %esp,%ebp
+  801f8e:	53                   	push   %ebx
+  801f8f:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  801f92:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801f95:	50                   	push   %eax
+  801f96:	6a 00                	push   $0x0
+  801f98:	e8 a2 ff ff ff       	call   801f3f <fs_stats>
+  801f9d:	83 c4 10             	add    $0x10,%esp
+  801fa0:	85 c0                	test   %eax,%eax
+  801fa2:	78 28                	js     801fcc <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  801fa4:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  801fa7:	83 ec 08             	sub    $0x8,%esp
+  801faa:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801fad:	50                   	push   %eax
+  801fae:	6a 20                	push   $0x20
+  801fb0:	e8 8a ff ff ff       	call   801f3f <fs_stats>
+  801fb5:	83 c4 10             	add    $0x10,%esp
+  801fb8:	85 c0                	test   %eax,%eax
+  801fba:	78 10                	js     801fcc <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  801fbc:	83 ec 08             	sub    $0x8,%esp
+  801fbf:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  801fc2:	50                   	push   %eax
+  801fc3:	53                   	push   %ebx
+  801fc4:	e8 76 ff ff ff       	call   801f3f <fs_stats>
+  801fc9:	83 c4 10             	add    $0x10,%esp
+}
+  801fcc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801fcf:	c9                   	leave
+  801fd0:	c3                   	ret
+
+00801fd1 <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  801fd1:	55                   	push   %ebp
+  801fd2:	89 e5                	mov    %esp,%ebp
+  801fd4:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  801fd7:	c7 05 00 60 c0 00 00 	movl   $0x0,0xc06000
+  801fde:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  801fe1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fe4:	a3 04 60 c0 00       	mov    %eax,0xc06004
+  fsipcbuf.stats.req_dcache = 0;
+  801fe9:	c7 05 08 60 c0 00 00 	movl   $0x0,0xc06008
+  801ff0:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  801ff3:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ff8:	b8 09 00 00 00       	mov    $0x9,%eax
+  801ffd:	e8 ac f7 ff ff       	call   8017ae <fsipc>
+}
+  802002:	c9                   	leave
+  802003:	c3                   	ret
+
+00802004 <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  802004:	55                   	push   %ebp
+  802005:	89 e5                	mov    %esp,%ebp
+  802007:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  80200a:	c7 05 00 60 c0 00 00 	movl   $0x0,0xc06000
+  802011:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  802014:	c7 05 04 60 c0 00 00 	movl   $0x0,0xc06004
+  80201b:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  80201e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802021:	a3 08 60 c0 00       	mov    %eax,0xc06008
+  return fsipc(FSREQ_STATS, NULL);
+  802026:	ba 00 00 00 00       	mov    $0x0,%edx
+  80202b:	b8 09 00 00 00       	mov    $0x9,%eax
+  802030:	e8 79 f7 ff ff       	call   8017ae <fsipc>
+}
+  802035:	c9                   	leave
+  802036:	c3                   	ret
+
+00802037 <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  802037:	55                   	push   %ebp
+  802038:	89 e5                	mov    %esp,%ebp
+  80203a:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80203d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802040:	50                   	push   %eax
+  802041:	ff 75 08             	push   0x8(%ebp)
+  802044:	e8 21 f1 ff ff       	call   80116a <fd_lookup>
+  802049:	83 c4 10             	add    $0x10,%esp
+  80204c:	85 c0                	test   %eax,%eax
+  80204e:	78 34                	js     802084 <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  802050:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802053:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  802059:	39 08                	cmp    %ecx,(%eax)
+  80205b:	75 29                	jne    802086 <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  80205d:	8b 40 0c             	mov    0xc(%eax),%eax
+  802060:	a3 00 60 c0 00       	mov    %eax,0xc06000
+  fsipcbuf.fallocate.req_offset = offset;
+  802065:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802068:	a3 04 60 c0 00       	mov    %eax,0xc06004
+  fsipcbuf.fallocate.req_len = len;
+  80206d:	8b 45 10             	mov    0x10(%ebp),%eax
+  802070:	a3 08 60 c0 00       	mov    %eax,0xc06008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  802075:	ba 00 00 00 00       	mov    $0x0,%edx
+  80207a:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80207f:	e8 2a f7 ff ff       	call   8017ae <fsipc>
+}
+  802084:	c9                   	leave
+  802085:	c3                   	ret
+    return -E_INVAL;
+  802086:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80208b:	eb f7                	jmp    802084 <fallocate+0x4d>
+
+0080208d <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  80208d:	55                   	push   %ebp
+  80208e:	89 e5                	mov    %esp,%ebp
+  802090:	57                   	push   %edi
+  802091:	56                   	push   %esi
+  802092:	53                   	push   %ebx
+  802093:	83 ec 24             	sub    $0x24,%esp
+  802096:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802099:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80209c:	50                   	push   %eax
+  80209d:	ff 75 08             	push   0x8(%ebp)
+  8020a0:	e8 c5 f0 ff ff       	call   80116a <fd_lookup>
+  8020a5:	83 c4 10             	add    $0x10,%esp
+  8020a8:	85 c0                	test   %eax,%eax
+  8020aa:	78 66                	js     802112 <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  8020ac:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8020af:	8b 0d 04 40 80 00    	mov    0x804004,%ecx
+  8020b5:	39 08                	cmp    %ecx,(%eax)
+  8020b7:	75 61                	jne    80211a <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  8020b9:	85 f6                	test   %esi,%esi
+  8020bb:	7e 50                	jle    80210d <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  8020bd:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  8020c2:	39 de                	cmp    %ebx,%esi
+  8020c4:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  8020c7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8020ca:	8b 40 0c             	mov    0xc(%eax),%eax
+  8020cd:	a3 00 60 c0 00       	mov    %eax,0xc06000
+    fsipcbuf.prefetch.req_n = m;
+  8020d2:	89 1d 04 60 c0 00    	mov    %ebx,0xc06004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  8020d8:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  8020df:	83 ec 04             	sub    $0x4,%esp
+  8020e2:	57                   	push   %edi
+  8020e3:	ff 75 0c             	push   0xc(%ebp)
+  8020e6:	68 08 60 c0 00       	push   $0xc06008
+  8020eb:	e8 a8 e8 ff ff       	call   800998 <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  8020f0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020f5:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8020fa:	e8 af f6 ff ff       	call   8017ae <fsipc>
+  8020ff:	83 c4 10             	add    $0x10,%esp
+  802102:	85 c0                	test   %eax,%eax
+  802104:	78 0c                	js     802112 <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  802106:	01 7d 0c             	add    %edi,0xc(%ebp)
+  802109:	29 de                	sub    %ebx,%esi
+  80210b:	eb ac                	jmp    8020b9 <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  80210d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802112:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802115:	5b                   	pop    %ebx
+  802116:	5e                   	pop    %esi
+  802117:	5f                   	pop    %edi
+  802118:	5d                   	pop    %ebp
+  802119:	c3                   	ret
+    return -E_INVAL;
+  80211a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80211f:	eb f1                	jmp    802112 <prefetch+0x85>
+
+00802121 <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  802121:	55                   	push   %ebp
+  802122:	89 e5                	mov    %esp,%ebp
+  802124:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  802127:	50                   	push   %eax
+  802128:	e8 d3 ef ff ff       	call   801100 <fd2data>
+  80212d:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  802132:	c9                   	leave
+  802133:	c3                   	ret
+
+00802134 <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802134:	55                   	push   %ebp
+  802135:	89 e5                	mov    %esp,%ebp
+  802137:	56                   	push   %esi
+  802138:	53                   	push   %ebx
+  802139:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  80213c:	83 ec 0c             	sub    $0xc,%esp
+  80213f:	ff 75 08             	push   0x8(%ebp)
+  802142:	e8 b9 ef ff ff       	call   801100 <fd2data>
+  802147:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  802149:	83 c4 08             	add    $0x8,%esp
+  80214c:	68 28 34 80 00       	push   $0x803428
+  802151:	53                   	push   %ebx
+  802152:	e8 bb e6 ff ff       	call   800812 <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  802157:	8b 46 04             	mov    0x4(%esi),%eax
+  80215a:	2b 06                	sub    (%esi),%eax
+  80215c:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  802162:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802169:	00 00 00 
+  stat->st_dev = &devpipe;
+  80216c:	c7 83 88 00 00 00 20 	movl   $0x804020,0x88(%ebx)
+  802173:	40 80 00 
+  return 0;
+}
+  802176:	b8 00 00 00 00       	mov    $0x0,%eax
+  80217b:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80217e:	5b                   	pop    %ebx
+  80217f:	5e                   	pop    %esi
+  802180:	5d                   	pop    %ebp
+  802181:	c3                   	ret
+
+00802182 <pipe_wakeup>:
+{
+  802182:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  802184:	b8 00 00 00 00       	mov    $0x0,%eax
+  802189:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  80218c:	85 c0                	test   %eax,%eax
+  80218e:	75 01                	jne    802191 <pipe_wakeup+0xf>
+  802190:	c3                   	ret
+{
+  802191:	55                   	push   %ebp
+  802192:	89 e5                	mov    %esp,%ebp
+  802194:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  802197:	6a 00                	push   $0x0
+  802199:	68 00 00 c0 ee       	push   $0xeec00000
+  80219e:	52                   	push   %edx
+  80219f:	e8 f9 ed ff ff       	call   800f9d <sys_chan_wakeup>
+  8021a4:	83 c4 10             	add    $0x10,%esp
+}
+  8021a7:	c9                   	leave
+  8021a8:	c3                   	ret
+
+008021a9 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8021a9:	55                   	push   %ebp
+  8021aa:	89 e5                	mov    %esp,%ebp
+  8021ac:	57                   	push   %edi
+  8021ad:	56                   	push   %esi
+  8021ae:	53                   	push   %ebx
+  8021af:	83 ec 18             	sub    $0x18,%esp
+  8021b2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  8021b5:	57                   	push   %edi
+  8021b6:	e8 45 ef ff ff       	call   801100 <fd2data>
+  8021bb:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  8021bd:	83 c4 10             	add    $0x10,%esp
+  8021c0:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  8021c4:	74 2a                	je     8021f0 <devpipe_close+0x47>
+  8021c6:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  8021cb:	89 f8                	mov    %edi,%eax
+  8021cd:	e8 4f ff ff ff       	call   802121 <pipe_ring>
+  8021d2:	83 ec 08             	sub    $0x8,%esp
+  8021d5:	01 d8                	add    %ebx,%eax
+  8021d7:	50                   	push   %eax
+  8021d8:	6a 00                	push   $0x0
+  8021da:	e8 e7 ea ff ff       	call   800cc6 <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  8021df:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8021e5:	83 c4 10             	add    $0x10,%esp
+  8021e8:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  8021ee:	75 db                	jne    8021cb <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  8021f0:	83 ec 08             	sub    $0x8,%esp
+  8021f3:	57                   	push   %edi
+  8021f4:	6a 00                	push   $0x0
+  8021f6:	e8 cb ea ff ff       	call   800cc6 <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  8021fb:	83 c4 10             	add    $0x10,%esp
+  8021fe:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  802202:	75 13                	jne    802217 <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  802204:	83 ec 08             	sub    $0x8,%esp
+  802207:	56                   	push   %esi
+  802208:	6a 00                	push   $0x0
+  80220a:	e8 b7 ea ff ff       	call   800cc6 <sys_page_unmap>
+}
+  80220f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802212:	5b                   	pop    %ebx
+  802213:	5e                   	pop    %esi
+  802214:	5f                   	pop    %edi
+  802215:	5d                   	pop    %ebp
+  802216:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802217:	8d 56 04             	lea    0x4(%esi),%edx
+  80221a:	8d 46 2c             	lea    0x2c(%esi),%eax
+  80221d:	e8 60 ff ff ff       	call   802182 <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802222:	8d 46 30             	lea    0x30(%esi),%eax
+  802225:	89 f2                	mov    %esi,%edx
+  802227:	e8 56 ff ff ff       	call   802182 <pipe_wakeup>
+  80222c:	eb d6                	jmp    802204 <devpipe_close+0x5b>
+
+0080222e <_pipeisclosed>:
+{
+  80222e:	55                   	push   %ebp
+  80222f:	89 e5                	mov    %esp,%ebp
+  802231:	57                   	push   %edi
+  802232:	56                   	push   %esi
+  802233:	53                   	push   %ebx
+  802234:	83 ec 1c             	sub    $0x1c,%esp
+  802237:	89 c7                	mov    %eax,%edi
+  802239:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  80223b:	a1 60 57 c0 00       	mov    0xc05760,%eax
+  802240:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  802243:	83 ec 0c             	sub    $0xc,%esp
+  802246:	57                   	push   %edi
+  802247:	e8 18 0a 00 00       	call   802c64 <pageref>
+  80224c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80224f:	89 34 24             	mov    %esi,(%esp)
+  802252:	e8 0d 0a 00 00       	call   802c64 <pageref>
+    nn = thisenv->env_runs;
+  802257:	8b 15 60 57 c0 00    	mov    0xc05760,%edx
+  80225d:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  802260:	83 c4 10             	add    $0x10,%esp
+  802263:	39 cb                	cmp    %ecx,%ebx
+  802265:	74 1b                	je     802282 <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  802267:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80226a:	75 cf                	jne    80223b <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80226c:	8b 42 58             	mov    0x58(%edx),%eax
+  80226f:	6a 01                	push   $0x1
+  802271:	50                   	push   %eax
+  802272:	53                   	push   %ebx
+  802273:	68 2f 34 80 00       	push   $0x80342f
+  802278:	e8 a7 df ff ff       	call   800224 <cprintf>
+  80227d:	83 c4 10             	add    $0x10,%esp
+  802280:	eb b9                	jmp    80223b <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  802282:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802285:	0f 94 c0             	sete   %al
+  802288:	0f b6 c0             	movzbl %al,%eax
+}
+  80228b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80228e:	5b                   	pop    %ebx
+  80228f:	5e                   	pop    %esi
+  802290:	5f                   	pop    %edi
+  802291:	5d                   	pop    %ebp
+  802292:	c3                   	ret
+
+00802293 <devpipe_write_bulk>:
+{
+  802293:	55                   	push   %ebp
+  802294:	89 e5                	mov    %esp,%ebp
+  802296:	57                   	push   %edi
+  802297:	56                   	push   %esi
+  802298:	53                   	push   %ebx
+  802299:	83 ec 1c             	sub    $0x1c,%esp
+  80229c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80229f:	89 d6                	mov    %edx,%esi
+  8022a1:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  8022a4:	e8 78 fe ff ff       	call   802121 <pipe_ring>
+  8022a9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  8022ac:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  8022b1:	8d 46 04             	lea    0x4(%esi),%eax
+  8022b4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  8022b7:	eb 75                	jmp    80232e <devpipe_write_bulk+0x9b>
+  8022b9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022be:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  8022c2:	6a 64                	push   $0x64
+  8022c4:	68 00 00 c0 ee       	push   $0xeec00000
+  8022c9:	53                   	push   %ebx
+  8022ca:	56                   	push   %esi
+  8022cb:	e8 aa ec ff ff       	call   800f7a <sys_chan_sleep>
+      continue;
+  8022d0:	83 c4 10             	add    $0x10,%esp
+  8022d3:	eb 59                	jmp    80232e <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  8022d5:	89 d1                	mov    %edx,%ecx
+  8022d7:	c1 f9 1f             	sar    $0x1f,%ecx
+  8022da:	c1 e9 11             	shr    $0x11,%ecx
+  8022dd:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  8022e0:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8022e5:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  8022e7:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  8022ed:	29 d3                	sub    %edx,%ebx
+  8022ef:	ba 00 80 00 00       	mov    $0x8000,%edx
+  8022f4:	29 c2                	sub    %eax,%edx
+  8022f6:	39 d3                	cmp    %edx,%ebx
+  8022f8:	0f 47 da             	cmova  %edx,%ebx
+  8022fb:	8b 55 08             	mov    0x8(%ebp),%edx
+  8022fe:	29 fa                	sub    %edi,%edx
+  802300:	39 d3                	cmp    %edx,%ebx
+  802302:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  802305:	83 ec 04             	sub    $0x4,%esp
+  802308:	53                   	push   %ebx
+  802309:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80230c:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  80230f:	52                   	push   %edx
+  802310:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802313:	01 c8                	add    %ecx,%eax
+  802315:	50                   	push   %eax
+  802316:	e8 df e6 ff ff       	call   8009fa <memcpy>
+    i += m;
+  80231b:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  80231d:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802320:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802323:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802326:	e8 57 fe ff ff       	call   802182 <pipe_wakeup>
+  80232b:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  80232e:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802331:	73 2b                	jae    80235e <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  802333:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  802335:	8b 56 04             	mov    0x4(%esi),%edx
+  802338:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  80233e:	39 d0                	cmp    %edx,%eax
+  802340:	7d 93                	jge    8022d5 <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  802342:	89 f2                	mov    %esi,%edx
+  802344:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802347:	e8 e2 fe ff ff       	call   80222e <_pipeisclosed>
+  80234c:	85 c0                	test   %eax,%eax
+  80234e:	0f 84 65 ff ff ff    	je     8022b9 <devpipe_write_bulk+0x26>
+        return i;
+  802354:	89 f8                	mov    %edi,%eax
+}
+  802356:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802359:	5b                   	pop    %ebx
+  80235a:	5e                   	pop    %esi
+  80235b:	5f                   	pop    %edi
+  80235c:	5d                   	pop    %ebp
+  80235d:	c3                   	ret
+  return i;
+  80235e:	89 f8                	mov    %edi,%eax
+  802360:	eb f4                	jmp    802356 <devpipe_write_bulk+0xc3>
+
+00802362 <devpipe_write>:
+{
+  802362:	55                   	push   %ebp
+  802363:	89 e5                	mov    %esp,%ebp
+  802365:	57                   	push   %edi
+  802366:	56                   	push   %esi
+  802367:	53                   	push   %ebx
+  802368:	83 ec 28             	sub    $0x28,%esp
+  80236b:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  80236e:	56                   	push   %esi
+  80236f:	e8 8c ed ff ff       	call   801100 <fd2data>
+  802374:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  802376:	8b 78 28             	mov    0x28(%eax),%edi
+  802379:	83 c4 10             	add    $0x10,%esp
+  80237c:	85 ff                	test   %edi,%edi
+  80237e:	75 25                	jne    8023a5 <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  802380:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802383:	74 66                	je     8023eb <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802385:	8b 43 04             	mov    0x4(%ebx),%eax
+  802388:	8b 0b                	mov    (%ebx),%ecx
+  80238a:	8d 51 20             	lea    0x20(%ecx),%edx
+  80238d:	39 d0                	cmp    %edx,%eax
+  80238f:	72 2b                	jb     8023bc <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  802391:	89 da                	mov    %ebx,%edx
+  802393:	89 f0                	mov    %esi,%eax
+  802395:	e8 94 fe ff ff       	call   80222e <_pipeisclosed>
+  80239a:	85 c0                	test   %eax,%eax
+  80239c:	75 51                	jne    8023ef <devpipe_write+0x8d>
+      sys_yield();
+  80239e:	e8 3c e8 ff ff       	call   800bdf <sys_yield>
+  8023a3:	eb e0                	jmp    802385 <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  8023a5:	83 ec 0c             	sub    $0xc,%esp
+  8023a8:	ff 75 10             	push   0x10(%ebp)
+  8023ab:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8023ae:	89 c2                	mov    %eax,%edx
+  8023b0:	89 f0                	mov    %esi,%eax
+  8023b2:	e8 dc fe ff ff       	call   802293 <devpipe_write_bulk>
+  8023b7:	83 c4 10             	add    $0x10,%esp
+  8023ba:	eb 38                	jmp    8023f4 <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8023bc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8023bf:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8023c3:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8023c6:	89 c2                	mov    %eax,%edx
+  8023c8:	c1 fa 1f             	sar    $0x1f,%edx
+  8023cb:	89 d1                	mov    %edx,%ecx
+  8023cd:	c1 e9 1b             	shr    $0x1b,%ecx
+  8023d0:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8023d3:	83 e2 1f             	and    $0x1f,%edx
+  8023d6:	29 ca                	sub    %ecx,%edx
+  8023d8:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8023dc:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  8023e0:	83 c0 01             	add    $0x1,%eax
+  8023e3:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  8023e6:	83 c7 01             	add    $0x1,%edi
+  8023e9:	eb 95                	jmp    802380 <devpipe_write+0x1e>
+  return i;
+  8023eb:	89 f8                	mov    %edi,%eax
+  8023ed:	eb 05                	jmp    8023f4 <devpipe_write+0x92>
+        return 0;
+  8023ef:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023f7:	5b                   	pop    %ebx
+  8023f8:	5e                   	pop    %esi
+  8023f9:	5f                   	pop    %edi
+  8023fa:	5d                   	pop    %ebp
+  8023fb:	c3                   	ret
+
+008023fc <devpipe_read_bulk>:
+{
+  8023fc:	55                   	push   %ebp
+  8023fd:	89 e5                	mov    %esp,%ebp
+  8023ff:	57                   	push   %edi
+  802400:	56                   	push   %esi
+  802401:	53                   	push   %ebx
+  802402:	83 ec 2c             	sub    $0x2c,%esp
+  802405:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802408:	89 d6                	mov    %edx,%esi
+  80240a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80240d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  802410:	e8 0c fd ff ff       	call   802121 <pipe_ring>
+  802415:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  802418:	85 db                	test   %ebx,%ebx
+  80241a:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  80241f:	0f 45 c3             	cmovne %ebx,%eax
+  802422:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802425:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  80242a:	8d 46 30             	lea    0x30(%esi),%eax
+  80242d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  802430:	eb 50                	jmp    802482 <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  802432:	89 d1                	mov    %edx,%ecx
+  802434:	c1 f9 1f             	sar    $0x1f,%ecx
+  802437:	c1 e9 11             	shr    $0x11,%ecx
+  80243a:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  80243d:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802442:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  802444:	29 d3                	sub    %edx,%ebx
+  802446:	ba 00 80 00 00       	mov    $0x8000,%edx
+  80244b:	29 c2                	sub    %eax,%edx
+  80244d:	39 d3                	cmp    %edx,%ebx
+  80244f:	0f 47 da             	cmova  %edx,%ebx
+  802452:	8b 55 08             	mov    0x8(%ebp),%edx
+  802455:	29 fa                	sub    %edi,%edx
+  802457:	39 d3                	cmp    %edx,%ebx
+  802459:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  80245c:	83 ec 04             	sub    $0x4,%esp
+  80245f:	53                   	push   %ebx
+  802460:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802463:	01 c8                	add    %ecx,%eax
+  802465:	50                   	push   %eax
+  802466:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802469:	01 f8                	add    %edi,%eax
+  80246b:	50                   	push   %eax
+  80246c:	e8 89 e5 ff ff       	call   8009fa <memcpy>
+    i += m;
+  802471:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  802473:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802475:	89 f2                	mov    %esi,%edx
+  802477:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80247a:	e8 03 fd ff ff       	call   802182 <pipe_wakeup>
+  80247f:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802482:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802485:	73 51                	jae    8024d8 <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  802487:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  80248a:	8b 16                	mov    (%esi),%edx
+  80248c:	39 da                	cmp    %ebx,%edx
+  80248e:	75 a2                	jne    802432 <devpipe_read_bulk+0x36>
+      if (i > 0)
+  802490:	85 ff                	test   %edi,%edi
+  802492:	75 44                	jne    8024d8 <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  802494:	89 f2                	mov    %esi,%edx
+  802496:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802499:	e8 90 fd ff ff       	call   80222e <_pipeisclosed>
+  80249e:	85 c0                	test   %eax,%eax
+  8024a0:	75 3a                	jne    8024dc <devpipe_read_bulk+0xe0>
+  8024a2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8024a7:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  8024ab:	6a 64                	push   $0x64
+  8024ad:	ff 75 d4             	push   -0x2c(%ebp)
+  8024b0:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  8024b1:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  8024b4:	50                   	push   %eax
+  8024b5:	e8 c0 ea ff ff       	call   800f7a <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  8024ba:	85 c0                	test   %eax,%eax
+  8024bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024c1:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  8024c4:	83 c4 10             	add    $0x10,%esp
+  8024c7:	a8 01                	test   $0x1,%al
+  8024c9:	74 b7                	je     802482 <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  8024cb:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  8024d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024d3:	5b                   	pop    %ebx
+  8024d4:	5e                   	pop    %esi
+  8024d5:	5f                   	pop    %edi
+  8024d6:	5d                   	pop    %ebp
+  8024d7:	c3                   	ret
+  return i;
+  8024d8:	89 f8                	mov    %edi,%eax
+  8024da:	eb f4                	jmp    8024d0 <devpipe_read_bulk+0xd4>
+        return 0;
+  8024dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024e1:	eb ed                	jmp    8024d0 <devpipe_read_bulk+0xd4>
+
+008024e3 <devpipe_read>:
+{
+  8024e3:	55                   	push   %ebp
+  8024e4:	89 e5                	mov    %esp,%ebp
+  8024e6:	57                   	push   %edi
+  8024e7:	56                   	push   %esi
+  8024e8:	53                   	push   %ebx
+  8024e9:	83 ec 18             	sub    $0x18,%esp
+  8024ec:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  8024ef:	57                   	push   %edi
+  8024f0:	e8 0b ec ff ff       	call   801100 <fd2data>
+  8024f5:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  8024f7:	8b 70 28             	mov    0x28(%eax),%esi
+  8024fa:	83 c4 10             	add    $0x10,%esp
+  8024fd:	85 f6                	test   %esi,%esi
+  8024ff:	75 24                	jne    802525 <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  802501:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802504:	74 60                	je     802566 <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  802506:	8b 03                	mov    (%ebx),%eax
+  802508:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80250b:	75 3b                	jne    802548 <devpipe_read+0x65>
+      if (i > 0)
+  80250d:	85 f6                	test   %esi,%esi
+  80250f:	75 2d                	jne    80253e <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  802511:	89 da                	mov    %ebx,%edx
+  802513:	89 f8                	mov    %edi,%eax
+  802515:	e8 14 fd ff ff       	call   80222e <_pipeisclosed>
+  80251a:	85 c0                	test   %eax,%eax
+  80251c:	75 4c                	jne    80256a <devpipe_read+0x87>
+      sys_yield();
+  80251e:	e8 bc e6 ff ff       	call   800bdf <sys_yield>
+  802523:	eb e1                	jmp    802506 <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  802525:	83 ec 08             	sub    $0x8,%esp
+  802528:	6a 00                	push   $0x0
+  80252a:	ff 75 10             	push   0x10(%ebp)
+  80252d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802530:	89 c2                	mov    %eax,%edx
+  802532:	89 f8                	mov    %edi,%eax
+  802534:	e8 c3 fe ff ff       	call   8023fc <devpipe_read_bulk>
+  802539:	83 c4 10             	add    $0x10,%esp
+  80253c:	eb 02                	jmp    802540 <devpipe_read+0x5d>
+        return i;
+  80253e:	89 f0                	mov    %esi,%eax
+}
+  802540:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802543:	5b                   	pop    %ebx
+  802544:	5e                   	pop    %esi
+  802545:	5f                   	pop    %edi
+  802546:	5d                   	pop    %ebp
+  802547:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802548:	99                   	cltd
+  802549:	c1 ea 1b             	shr    $0x1b,%edx
+  80254c:	01 d0                	add    %edx,%eax
+  80254e:	83 e0 1f             	and    $0x1f,%eax
+  802551:	29 d0                	sub    %edx,%eax
+  802553:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802558:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80255b:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  80255e:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  802561:	83 c6 01             	add    $0x1,%esi
+  802564:	eb 9b                	jmp    802501 <devpipe_read+0x1e>
+  return i;
+  802566:	89 f0                	mov    %esi,%eax
+  802568:	eb d6                	jmp    802540 <devpipe_read+0x5d>
+        return 0;
+  80256a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80256f:	eb cf                	jmp    802540 <devpipe_read+0x5d>
+
+00802571 <pipe2>:
+{
+  802571:	55                   	push   %ebp
+  802572:	89 e5                	mov    %esp,%ebp
+  802574:	57                   	push   %edi
+  802575:	56                   	push   %esi
+  802576:	53                   	push   %ebx
+  802577:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  80257a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80257d:	50                   	push   %eax
+  80257e:	e8 91 eb ff ff       	call   801114 <fd_alloc>
+  802583:	89 c3                	mov    %eax,%ebx
+  802585:	83 c4 10             	add    $0x10,%esp
+  802588:	85 c0                	test   %eax,%eax
+  80258a:	0f 88 fb 01 00 00    	js     80278b <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802590:	83 ec 04             	sub    $0x4,%esp
+  802593:	68 07 04 00 00       	push   $0x407
+  802598:	ff 75 e4             	push   -0x1c(%ebp)
+  80259b:	6a 00                	push   $0x0
+  80259d:	e8 9f e6 ff ff       	call   800c41 <sys_page_alloc>
+  8025a2:	89 c3                	mov    %eax,%ebx
+  8025a4:	83 c4 10             	add    $0x10,%esp
+  8025a7:	85 c0                	test   %eax,%eax
+  8025a9:	0f 88 dc 01 00 00    	js     80278b <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  8025af:	83 ec 0c             	sub    $0xc,%esp
+  8025b2:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8025b5:	50                   	push   %eax
+  8025b6:	e8 59 eb ff ff       	call   801114 <fd_alloc>
+  8025bb:	89 c3                	mov    %eax,%ebx
+  8025bd:	83 c4 10             	add    $0x10,%esp
+  8025c0:	85 c0                	test   %eax,%eax
+  8025c2:	0f 88 b3 01 00 00    	js     80277b <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8025c8:	83 ec 04             	sub    $0x4,%esp
+  8025cb:	68 07 04 00 00       	push   $0x407
+  8025d0:	ff 75 e0             	push   -0x20(%ebp)
+  8025d3:	6a 00                	push   $0x0
+  8025d5:	e8 67 e6 ff ff       	call   800c41 <sys_page_alloc>
+  8025da:	89 c3                	mov    %eax,%ebx
+  8025dc:	83 c4 10             	add    $0x10,%esp
+  8025df:	85 c0                	test   %eax,%eax
+  8025e1:	0f 88 94 01 00 00    	js     80277b <pipe2+0x20a>
+  va = fd2data(fd0);
+  8025e7:	83 ec 0c             	sub    $0xc,%esp
+  8025ea:	ff 75 e4             	push   -0x1c(%ebp)
+  8025ed:	e8 0e eb ff ff       	call   801100 <fd2data>
+  8025f2:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  8025f4:	83 c4 0c             	add    $0xc,%esp
+  8025f7:	68 07 04 00 00       	push   $0x407
+  8025fc:	50                   	push   %eax
+  8025fd:	6a 00                	push   $0x0
+  8025ff:	e8 3d e6 ff ff       	call   800c41 <sys_page_alloc>
+  802604:	89 c3                	mov    %eax,%ebx
+  802606:	83 c4 10             	add    $0x10,%esp
+  802609:	85 c0                	test   %eax,%eax
+  80260b:	0f 88 5a 01 00 00    	js     80276b <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802611:	83 ec 0c             	sub    $0xc,%esp
+  802614:	ff 75 e0             	push   -0x20(%ebp)
+  802617:	e8 e4 ea ff ff       	call   801100 <fd2data>
+  80261c:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802623:	50                   	push   %eax
+  802624:	6a 00                	push   $0x0
+  802626:	57                   	push   %edi
+  802627:	6a 00                	push   $0x0
+  802629:	e8 56 e6 ff ff       	call   800c84 <sys_page_map>
+  80262e:	89 c3                	mov    %eax,%ebx
+  802630:	83 c4 20             	add    $0x20,%esp
+  802633:	85 c0                	test   %eax,%eax
+  802635:	0f 88 22 01 00 00    	js     80275d <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  80263b:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  80263f:	74 72                	je     8026b3 <pipe2+0x142>
+  802641:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  802646:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802649:	e8 d3 fa ff ff       	call   802121 <pipe_ring>
+  80264e:	83 ec 04             	sub    $0x4,%esp
+  802651:	68 07 04 00 00       	push   $0x407
+  802656:	01 f0                	add    %esi,%eax
+  802658:	50                   	push   %eax
+  802659:	6a 00                	push   $0x0
+  80265b:	e8 e1 e5 ff ff       	call   800c41 <sys_page_alloc>
+  802660:	89 c3                	mov    %eax,%ebx
+  802662:	83 c4 10             	add    $0x10,%esp
+  802665:	85 c0                	test   %eax,%eax
+  802667:	0f 88 97 00 00 00    	js     802704 <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  80266d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802670:	e8 ac fa ff ff       	call   802121 <pipe_ring>
+  802675:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  802678:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80267b:	e8 a1 fa ff ff       	call   802121 <pipe_ring>
+  802680:	83 ec 0c             	sub    $0xc,%esp
+  802683:	68 07 04 00 00       	push   $0x407
+  802688:	53                   	push   %ebx
+  802689:	6a 00                	push   $0x0
+  80268b:	01 f0                	add    %esi,%eax
+  80268d:	50                   	push   %eax
+  80268e:	6a 00                	push   $0x0
+  802690:	e8 ef e5 ff ff       	call   800c84 <sys_page_map>
+  802695:	89 c3                	mov    %eax,%ebx
+  802697:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  80269d:	83 c4 20             	add    $0x20,%esp
+  8026a0:	85 c0                	test   %eax,%eax
+  8026a2:	78 60                	js     802704 <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  8026a4:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  8026aa:	75 9a                	jne    802646 <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  8026ac:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  8026b3:	a1 20 40 80 00       	mov    0x804020,%eax
+  8026b8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8026bb:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  8026bd:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8026c0:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  8026c7:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8026ca:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  8026cc:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8026cf:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  8026d6:	83 ec 0c             	sub    $0xc,%esp
+  8026d9:	ff 75 e4             	push   -0x1c(%ebp)
+  8026dc:	e8 0f ea ff ff       	call   8010f0 <fd2num>
+  8026e1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8026e4:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  8026e6:	83 c4 04             	add    $0x4,%esp
+  8026e9:	ff 75 e0             	push   -0x20(%ebp)
+  8026ec:	e8 ff e9 ff ff       	call   8010f0 <fd2num>
+  8026f1:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8026f4:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  8026f7:	83 c4 10             	add    $0x10,%esp
+  8026fa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8026ff:	e9 87 00 00 00       	jmp    80278b <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802704:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  802709:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80270c:	e8 10 fa ff ff       	call   802121 <pipe_ring>
+  802711:	83 ec 08             	sub    $0x8,%esp
+  802714:	01 f0                	add    %esi,%eax
+  802716:	50                   	push   %eax
+  802717:	6a 00                	push   $0x0
+  802719:	e8 a8 e5 ff ff       	call   800cc6 <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  80271e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802721:	e8 fb f9 ff ff       	call   802121 <pipe_ring>
+  802726:	83 c4 08             	add    $0x8,%esp
+  802729:	01 f0                	add    %esi,%eax
+  80272b:	50                   	push   %eax
+  80272c:	6a 00                	push   $0x0
+  80272e:	e8 93 e5 ff ff       	call   800cc6 <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802733:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802739:	83 c4 10             	add    $0x10,%esp
+  80273c:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802742:	75 c5                	jne    802709 <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  802744:	83 ec 0c             	sub    $0xc,%esp
+  802747:	ff 75 e0             	push   -0x20(%ebp)
+  80274a:	e8 b1 e9 ff ff       	call   801100 <fd2data>
+  80274f:	83 c4 08             	add    $0x8,%esp
+  802752:	50                   	push   %eax
+  802753:	6a 00                	push   $0x0
+  802755:	e8 6c e5 ff ff       	call   800cc6 <sys_page_unmap>
+  80275a:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  80275d:	83 ec 08             	sub    $0x8,%esp
+  802760:	57                   	push   %edi
+  802761:	6a 00                	push   $0x0
+  802763:	e8 5e e5 ff ff       	call   800cc6 <sys_page_unmap>
+  802768:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  80276b:	83 ec 08             	sub    $0x8,%esp
+  80276e:	ff 75 e0             	push   -0x20(%ebp)
+  802771:	6a 00                	push   $0x0
+  802773:	e8 4e e5 ff ff       	call   800cc6 <sys_page_unmap>
+  802778:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  80277b:	83 ec 08             	sub    $0x8,%esp
+  80277e:	ff 75 e4             	push   -0x1c(%ebp)
+  802781:	6a 00                	push   $0x0
+  802783:	e8 3e e5 ff ff       	call   800cc6 <sys_page_unmap>
+  802788:	83 c4 10             	add    $0x10,%esp
+}
+  80278b:	89 d8                	mov    %ebx,%eax
+  80278d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802790:	5b                   	pop    %ebx
+  802791:	5e                   	pop    %esi
+  802792:	5f                   	pop    %edi
+  802793:	5d                   	pop    %ebp
+  802794:	c3                   	ret
+
+00802795 <pipe>:
+{
+  802795:	55                   	push   %ebp
+  802796:	89 e5                	mov    %esp,%ebp
+  802798:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  80279b:	6a 00                	push   $0x0
+  80279d:	ff 75 08             	push   0x8(%ebp)
+  8027a0:	e8 cc fd ff ff       	call   802571 <pipe2>
+}
+  8027a5:	c9                   	leave
+  8027a6:	c3                   	ret
+
+008027a7 <pipeisclosed>:
+{
+  8027a7:	55                   	push   %ebp
+  8027a8:	89 e5                	mov    %esp,%ebp
+  8027aa:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8027ad:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8027b0:	50                   	push   %eax
+  8027b1:	ff 75 08             	push   0x8(%ebp)
+  8027b4:	e8 b1 e9 ff ff       	call   80116a <fd_lookup>
+  8027b9:	83 c4 10             	add    $0x10,%esp
+  8027bc:	85 c0                	test   %eax,%eax
+  8027be:	78 18                	js     8027d8 <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  8027c0:	83 ec 0c             	sub    $0xc,%esp
+  8027c3:	ff 75 f4             	push   -0xc(%ebp)
+  8027c6:	e8 35 e9 ff ff       	call   801100 <fd2data>
+  8027cb:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  8027cd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8027d0:	e8 59 fa ff ff       	call   80222e <_pipeisclosed>
+  8027d5:	83 c4 10             	add    $0x10,%esp
+}
+  8027d8:	c9                   	leave
+  8027d9:	c3                   	ret
+
+008027da <pipe_splice>:
+{
+  8027da:	55                   	push   %ebp
+  8027db:	89 e5                	mov    %esp,%ebp
+  8027dd:	57                   	push   %edi
+  8027de:	56                   	push   %esi
+  8027df:	53                   	push   %ebx
+  8027e0:	83 ec 34             	sub    $0x34,%esp
+  8027e3:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8027e6:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8027e9:	50                   	push   %eax
+  8027ea:	ff 75 08             	push   0x8(%ebp)
+  8027ed:	e8 78 e9 ff ff       	call   80116a <fd_lookup>
+  8027f2:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8027f5:	83 c4 10             	add    $0x10,%esp
+  8027f8:	85 c0                	test   %eax,%eax
+  8027fa:	0f 88 d7 00 00 00    	js     8028d7 <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  802800:	83 ec 0c             	sub    $0xc,%esp
+  802803:	ff 75 e4             	push   -0x1c(%ebp)
+  802806:	e8 f5 e8 ff ff       	call   801100 <fd2data>
+  80280b:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  80280d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802810:	83 c4 10             	add    $0x10,%esp
+  802813:	8b 15 20 40 80 00    	mov    0x804020,%edx
+  802819:	39 10                	cmp    %edx,(%eax)
+  80281b:	0f 85 c1 00 00 00    	jne    8028e2 <pipe_splice+0x108>
+  802821:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  802825:	0f 84 c0 00 00 00    	je     8028eb <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  80282b:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  80282f:	0f 84 bf 00 00 00    	je     8028f4 <pipe_splice+0x11a>
+  802835:	89 f7                	mov    %esi,%edi
+  802837:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  80283d:	0f 85 ba 00 00 00    	jne    8028fd <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802843:	8d 43 04             	lea    0x4(%ebx),%eax
+  802846:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802849:	eb 38                	jmp    802883 <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  80284b:	83 ec 0c             	sub    $0xc,%esp
+  80284e:	68 00 10 00 00       	push   $0x1000
+  802853:	89 f1                	mov    %esi,%ecx
+  802855:	89 da                	mov    %ebx,%edx
+  802857:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80285a:	e8 34 fa ff ff       	call   802293 <devpipe_write_bulk>
+  80285f:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802862:	83 c4 10             	add    $0x10,%esp
+  802865:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80286a:	75 53                	jne    8028bf <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  80286c:	83 ec 08             	sub    $0x8,%esp
+  80286f:	56                   	push   %esi
+  802870:	6a 00                	push   $0x0
+  802872:	e8 4f e4 ff ff       	call   800cc6 <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  802877:	83 c7 01             	add    $0x1,%edi
+  80287a:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802880:	83 c4 10             	add    $0x10,%esp
+  802883:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802886:	74 3a                	je     8028c2 <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  802888:	8b 03                	mov    (%ebx),%eax
+  80288a:	39 43 04             	cmp    %eax,0x4(%ebx)
+  80288d:	75 bc                	jne    80284b <pipe_splice+0x71>
+  80288f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802894:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  802898:	85 c0                	test   %eax,%eax
+  80289a:	74 af                	je     80284b <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  80289c:	83 ec 04             	sub    $0x4,%esp
+  80289f:	6a 07                	push   $0x7
+  8028a1:	56                   	push   %esi
+  8028a2:	ff 75 d0             	push   -0x30(%ebp)
+  8028a5:	e8 f3 e6 ff ff       	call   800f9d <sys_chan_wakeup>
+  8028aa:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8028ad:	83 c4 10             	add    $0x10,%esp
+  8028b0:	85 c0                	test   %eax,%eax
+  8028b2:	79 b8                	jns    80286c <pipe_splice+0x92>
+  8028b4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8028b9:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  8028bd:	eb 8c                	jmp    80284b <pipe_splice+0x71>
+  8028bf:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  8028c2:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8028c6:	75 06                	jne    8028ce <pipe_splice+0xf4>
+  8028c8:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  8028cc:	78 09                	js     8028d7 <pipe_splice+0xfd>
+  return i * PGSIZE;
+  8028ce:	8b 45 10             	mov    0x10(%ebp),%eax
+  8028d1:	c1 e0 0c             	shl    $0xc,%eax
+  8028d4:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  8028d7:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8028da:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028dd:	5b                   	pop    %ebx
+  8028de:	5e                   	pop    %esi
+  8028df:	5f                   	pop    %edi
+  8028e0:	5d                   	pop    %ebp
+  8028e1:	c3                   	ret
+    return -E_INVAL;
+  8028e2:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  8028e9:	eb ec                	jmp    8028d7 <pipe_splice+0xfd>
+  8028eb:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  8028f2:	eb e3                	jmp    8028d7 <pipe_splice+0xfd>
+  8028f4:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  8028fb:	eb da                	jmp    8028d7 <pipe_splice+0xfd>
+  8028fd:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802904:	eb d1                	jmp    8028d7 <pipe_splice+0xfd>
+
+00802906 <pipe_splice_read>:
+{
+  802906:	55                   	push   %ebp
+  802907:	89 e5                	mov    %esp,%ebp
+  802909:	53                   	push   %ebx
+  80290a:	83 ec 1c             	sub    $0x1c,%esp
+  80290d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802910:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802913:	50                   	push   %eax
+  802914:	ff 75 08             	push   0x8(%ebp)
+  802917:	e8 4e e8 ff ff       	call   80116a <fd_lookup>
+  80291c:	83 c4 10             	add    $0x10,%esp
+  80291f:	85 c0                	test   %eax,%eax
+  802921:	78 49                	js     80296c <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  802923:	83 ec 0c             	sub    $0xc,%esp
+  802926:	ff 75 f4             	push   -0xc(%ebp)
+  802929:	e8 d2 e7 ff ff       	call   801100 <fd2data>
+  80292e:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802930:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802933:	83 c4 10             	add    $0x10,%esp
+  802936:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  80293c:	39 08                	cmp    %ecx,(%eax)
+  80293e:	75 31                	jne    802971 <pipe_splice_read+0x6b>
+  802940:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  802944:	74 32                	je     802978 <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  802946:	8b 48 08             	mov    0x8(%eax),%ecx
+  802949:	83 e1 03             	and    $0x3,%ecx
+  80294c:	83 f9 01             	cmp    $0x1,%ecx
+  80294f:	74 2e                	je     80297f <pipe_splice_read+0x79>
+  802951:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  802957:	75 2d                	jne    802986 <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  802959:	83 ec 08             	sub    $0x8,%esp
+  80295c:	53                   	push   %ebx
+  80295d:	68 00 10 00 00       	push   $0x1000
+  802962:	89 d9                	mov    %ebx,%ecx
+  802964:	e8 93 fa ff ff       	call   8023fc <devpipe_read_bulk>
+  802969:	83 c4 10             	add    $0x10,%esp
+}
+  80296c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80296f:	c9                   	leave
+  802970:	c3                   	ret
+    return -E_INVAL;
+  802971:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802976:	eb f4                	jmp    80296c <pipe_splice_read+0x66>
+  802978:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80297d:	eb ed                	jmp    80296c <pipe_splice_read+0x66>
+  80297f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802984:	eb e6                	jmp    80296c <pipe_splice_read+0x66>
+  802986:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80298b:	eb df                	jmp    80296c <pipe_splice_read+0x66>
+
+0080298d <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  80298d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802992:	c3                   	ret
+
+00802993 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  802993:	55                   	push   %ebp
+  802994:	89 e5                	mov    %esp,%ebp
+  802996:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  802999:	68 47 34 80 00       	push   $0x803447
+  80299e:	ff 75 0c             	push   0xc(%ebp)
+  8029a1:	e8 6c de ff ff       	call   800812 <strcpy>
+  return 0;
+}
+  8029a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029ab:	c9                   	leave
+  8029ac:	c3                   	ret
+
+008029ad <devcons_write>:
+{
+  8029ad:	55                   	push   %ebp
+  8029ae:	89 e5                	mov    %esp,%ebp
+  8029b0:	57                   	push   %edi
+  8029b1:	56                   	push   %esi
+  8029b2:	53                   	push   %ebx
+  8029b3:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  8029b9:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  8029be:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  8029c4:	eb 2e                	jmp    8029f4 <devcons_write+0x47>
+    m = n - tot;
+  8029c6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8029c9:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  8029cb:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8029d0:	39 c3                	cmp    %eax,%ebx
+  8029d2:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  8029d5:	83 ec 04             	sub    $0x4,%esp
+  8029d8:	53                   	push   %ebx
+  8029d9:	89 f0                	mov    %esi,%eax
+  8029db:	03 45 0c             	add    0xc(%ebp),%eax
+  8029de:	50                   	push   %eax
+  8029df:	57                   	push   %edi
+  8029e0:	e8 b3 df ff ff       	call   800998 <memmove>
+    sys_cputs(buf, m);
+  8029e5:	83 c4 08             	add    $0x8,%esp
+  8029e8:	53                   	push   %ebx
+  8029e9:	57                   	push   %edi
+  8029ea:	e8 53 e1 ff ff       	call   800b42 <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  8029ef:	01 de                	add    %ebx,%esi
+  8029f1:	83 c4 10             	add    $0x10,%esp
+  8029f4:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8029f7:	72 cd                	jb     8029c6 <devcons_write+0x19>
+}
+  8029f9:	89 f0                	mov    %esi,%eax
+  8029fb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029fe:	5b                   	pop    %ebx
+  8029ff:	5e                   	pop    %esi
+  802a00:	5f                   	pop    %edi
+  802a01:	5d                   	pop    %ebp
+  802a02:	c3                   	ret
+
+00802a03 <devcons_read>:
+{
+  802a03:	55                   	push   %ebp
+  802a04:	89 e5                	mov    %esp,%ebp
+  802a06:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  802a09:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a0e:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802a12:	75 07                	jne    802a1b <devcons_read+0x18>
+  802a14:	eb 1f                	jmp    802a35 <devcons_read+0x32>
+    sys_yield();
+  802a16:	e8 c4 e1 ff ff       	call   800bdf <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  802a1b:	e8 40 e1 ff ff       	call   800b60 <sys_cgetc>
+  802a20:	85 c0                	test   %eax,%eax
+  802a22:	74 f2                	je     802a16 <devcons_read+0x13>
+  if (c < 0)
+  802a24:	78 0f                	js     802a35 <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  802a26:	83 f8 04             	cmp    $0x4,%eax
+  802a29:	74 0c                	je     802a37 <devcons_read+0x34>
+  *(char*)vbuf = c;
+  802a2b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  802a2e:	88 02                	mov    %al,(%edx)
+  return 1;
+  802a30:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  802a35:	c9                   	leave
+  802a36:	c3                   	ret
+    return 0;
+  802a37:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a3c:	eb f7                	jmp    802a35 <devcons_read+0x32>
+
+00802a3e <cputchar>:
+{
+  802a3e:	55                   	push   %ebp
+  802a3f:	89 e5                	mov    %esp,%ebp
+  802a41:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  802a44:	8b 45 08             	mov    0x8(%ebp),%eax
+  802a47:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  802a4a:	6a 01                	push   $0x1
+  802a4c:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802a4f:	50                   	push   %eax
+  802a50:	e8 ed e0 ff ff       	call   800b42 <sys_cputs>
+}
+  802a55:	83 c4 10             	add    $0x10,%esp
+  802a58:	c9                   	leave
+  802a59:	c3                   	ret
+
+00802a5a <getchar>:
+{
+  802a5a:	55                   	push   %ebp
+  802a5b:	89 e5                	mov    %esp,%ebp
+  802a5d:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  802a60:	6a 01                	push   $0x1
+  802a62:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  802a65:	50                   	push   %eax
+  802a66:	6a 00                	push   $0x0
+  802a68:	e8 a8 e9 ff ff       	call   801415 <read>
+  if (r < 0)
+  802a6d:	83 c4 10             	add    $0x10,%esp
+  802a70:	85 c0                	test   %eax,%eax
+  802a72:	78 06                	js     802a7a <getchar+0x20>
+  if (r < 1)
+  802a74:	74 06                	je     802a7c <getchar+0x22>
+  return c;
+  802a76:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  802a7a:	c9                   	leave
+  802a7b:	c3                   	ret
+    return -E_EOF;
+  802a7c:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  802a81:	eb f7                	jmp    802a7a <getchar+0x20>
+
+00802a83 <iscons>:
+{
+  802a83:	55                   	push   %ebp
+  802a84:	89 e5                	mov    %esp,%ebp
+  802a86:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802a89:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802a8c:	50                   	push   %eax
+  802a8d:	ff 75 08             	push   0x8(%ebp)
+  802a90:	e8 d5 e6 ff ff       	call   80116a <fd_lookup>
+  802a95:	83 c4 10             	add    $0x10,%esp
+  802a98:	85 c0                	test   %eax,%eax
+  802a9a:	78 11                	js     802aad <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  802a9c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802a9f:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802aa5:	39 10                	cmp    %edx,(%eax)
+  802aa7:	0f 94 c0             	sete   %al
+  802aaa:	0f b6 c0             	movzbl %al,%eax
+}
+  802aad:	c9                   	leave
+  802aae:	c3                   	ret
+
+00802aaf <opencons>:
+{
+  802aaf:	55                   	push   %ebp
+  802ab0:	89 e5                	mov    %esp,%ebp
+  802ab2:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  802ab5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802ab8:	50                   	push   %eax
+  802ab9:	e8 56 e6 ff ff       	call   801114 <fd_alloc>
+  802abe:	83 c4 10             	add    $0x10,%esp
+  802ac1:	85 c0                	test   %eax,%eax
+  802ac3:	78 3a                	js     802aff <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  802ac5:	83 ec 04             	sub    $0x4,%esp
+  802ac8:	68 07 04 00 00       	push   $0x407
+  802acd:	ff 75 f4             	push   -0xc(%ebp)
+  802ad0:	6a 00                	push   $0x0
+  802ad2:	e8 6a e1 ff ff       	call   800c41 <sys_page_alloc>
+  802ad7:	83 c4 10             	add    $0x10,%esp
+  802ada:	85 c0                	test   %eax,%eax
+  802adc:	78 21                	js     802aff <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  802ade:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ae1:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802ae7:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  802ae9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802aec:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  802af3:	83 ec 0c             	sub    $0xc,%esp
+  802af6:	50                   	push   %eax
+  802af7:	e8 f4 e5 ff ff       	call   8010f0 <fd2num>
+  802afc:	83 c4 10             	add    $0x10,%esp
+}
+  802aff:	c9                   	leave
+  802b00:	c3                   	ret
+
+00802b01 <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  802b01:	55                   	push   %ebp
+  802b02:	89 e5                	mov    %esp,%ebp
+  802b04:	57                   	push   %edi
+  802b05:	56                   	push   %esi
+  802b06:	53                   	push   %ebx
+  802b07:	83 ec 14             	sub    $0x14,%esp
+  802b0a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802b0d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802b10:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802b13:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  802b16:	85 c0                	test   %eax,%eax
+  802b18:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802b1d:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  802b20:	ff 33                	push   (%ebx)
+  802b22:	50                   	push   %eax
+  802b23:	e8 f1 e3 ff ff       	call   800f19 <sys_ipc_recv>
+  802b28:	83 c4 10             	add    $0x10,%esp
+  802b2b:	85 c0                	test   %eax,%eax
+  802b2d:	78 39                	js     802b68 <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  802b2f:	85 ff                	test   %edi,%edi
+  802b31:	74 0a                	je     802b3d <ipc_recv_pages+0x3c>
+  802b33:	a1 60 57 c0 00       	mov    0xc05760,%eax
+  802b38:	8b 40 7c             	mov    0x7c(%eax),%eax
+  802b3b:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  802b3d:	85 f6                	test   %esi,%esi
+  802b3f:	74 0d                	je     802b4e <ipc_recv_pages+0x4d>
+  802b41:	a1 60 57 c0 00       	mov    0xc05760,%eax
+  802b46:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  802b4c:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  802b4e:	a1 60 57 c0 00       	mov    0xc05760,%eax
+  802b53:	8b 40 74             	mov    0x74(%eax),%eax
+  802b56:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  802b58:	a1 60 57 c0 00       	mov    0xc05760,%eax
+  802b5d:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  802b60:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b63:	5b                   	pop    %ebx
+  802b64:	5e                   	pop    %esi
+  802b65:	5f                   	pop    %edi
+  802b66:	5d                   	pop    %ebp
+  802b67:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  802b68:	85 ff                	test   %edi,%edi
+  802b6a:	74 06                	je     802b72 <ipc_recv_pages+0x71>
+  802b6c:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  802b72:	85 f6                	test   %esi,%esi
+  802b74:	74 06                	je     802b7c <ipc_recv_pages+0x7b>
+  802b76:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  802b7c:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  802b82:	eb dc                	jmp    802b60 <ipc_recv_pages+0x5f>
+
+00802b84 <ipc_recv>:
+{
+  802b84:	55                   	push   %ebp
+  802b85:	89 e5                	mov    %esp,%ebp
+  802b87:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  802b8a:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  802b91:	ff 75 10             	push   0x10(%ebp)
+  802b94:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b97:	50                   	push   %eax
+  802b98:	ff 75 0c             	push   0xc(%ebp)
+  802b9b:	ff 75 08             	push   0x8(%ebp)
+  802b9e:	e8 5e ff ff ff       	call   802b01 <ipc_recv_pages>
+}
+  802ba3:	c9                   	leave
+  802ba4:	c3                   	ret
+
+00802ba5 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  802ba5:	55                   	push   %ebp
+  802ba6:	89 e5                	mov    %esp,%ebp
+  802ba8:	57                   	push   %edi
+  802ba9:	56                   	push   %esi
+  802baa:	53                   	push   %ebx
+  802bab:	83 ec 0c             	sub    $0xc,%esp
+  802bae:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802bb1:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802bb4:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  802bb7:	89 c3                	mov    %eax,%ebx
+  802bb9:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  802bbf:	85 c0                	test   %eax,%eax
+  802bc1:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802bc6:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  802bc9:	83 ec 0c             	sub    $0xc,%esp
+  802bcc:	ff 75 14             	push   0x14(%ebp)
+  802bcf:	ff 75 18             	push   0x18(%ebp)
+  802bd2:	53                   	push   %ebx
+  802bd3:	56                   	push   %esi
+  802bd4:	57                   	push   %edi
+  802bd5:	e8 1e e3 ff ff       	call   800ef8 <sys_ipc_try_send>
+  802bda:	83 c4 20             	add    $0x20,%esp
+  802bdd:	85 c0                	test   %eax,%eax
+  802bdf:	79 1e                	jns    802bff <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  802be1:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802be4:	75 07                	jne    802bed <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  802be6:	e8 f4 df ff ff       	call   800bdf <sys_yield>
+  802beb:	eb dc                	jmp    802bc9 <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  802bed:	50                   	push   %eax
+  802bee:	68 53 34 80 00       	push   $0x803453
+  802bf3:	6a 5c                	push   $0x5c
+  802bf5:	68 60 34 80 00       	push   $0x803460
+  802bfa:	e8 4a d5 ff ff       	call   800149 <_panic>
+  }
+}
+  802bff:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c02:	5b                   	pop    %ebx
+  802c03:	5e                   	pop    %esi
+  802c04:	5f                   	pop    %edi
+  802c05:	5d                   	pop    %ebp
+  802c06:	c3                   	ret
+
+00802c07 <ipc_send>:
+{
+  802c07:	55                   	push   %ebp
+  802c08:	89 e5                	mov    %esp,%ebp
+  802c0a:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  802c0d:	ff 75 14             	push   0x14(%ebp)
+  802c10:	6a 01                	push   $0x1
+  802c12:	ff 75 10             	push   0x10(%ebp)
+  802c15:	ff 75 0c             	push   0xc(%ebp)
+  802c18:	ff 75 08             	push   0x8(%ebp)
+  802c1b:	e8 85 ff ff ff       	call   802ba5 <ipc_send_pages>
+}
+  802c20:	83 c4 20             	add    $0x20,%esp
+  802c23:	c9                   	leave
+  802c24:	c3                   	ret
+
+00802c25 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802c25:	55                   	push   %ebp
+  802c26:	89 e5                	mov    %esp,%ebp
+  802c28:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  802c2b:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  802c30:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802c33:	c1 e0 04             	shl    $0x4,%eax
+  802c36:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802c3b:	8b 40 50             	mov    0x50(%eax),%eax
+  802c3e:	39 c8                	cmp    %ecx,%eax
+  802c40:	74 12                	je     802c54 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  802c42:	83 c2 01             	add    $0x1,%edx
+  802c45:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802c4b:	75 e3                	jne    802c30 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  802c4d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c52:	eb 0e                	jmp    802c62 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  802c54:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802c57:	c1 e0 04             	shl    $0x4,%eax
+  802c5a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802c5f:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802c62:	5d                   	pop    %ebp
+  802c63:	c3                   	ret
+
+00802c64 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802c64:	55                   	push   %ebp
+  802c65:	89 e5                	mov    %esp,%ebp
+  802c67:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802c6a:	89 c2                	mov    %eax,%edx
+  802c6c:	c1 ea 16             	shr    $0x16,%edx
+  802c6f:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  802c76:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802c7b:	f6 c1 01             	test   $0x1,%cl
+  802c7e:	74 1c                	je     802c9c <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  802c80:	c1 e8 0c             	shr    $0xc,%eax
+  802c83:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  802c8a:	a8 01                	test   $0x1,%al
+  802c8c:	74 0e                	je     802c9c <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  802c8e:	c1 e8 0c             	shr    $0xc,%eax
+  802c91:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802c98:	ef 
+  802c99:	0f b7 d2             	movzwl %dx,%edx
+}
+  802c9c:	89 d0                	mov    %edx,%eax
+  802c9e:	5d                   	pop    %ebp
+  802c9f:	c3                   	ret
+
+00802ca0 <udivmod>:
+  802ca0:	55                   	push   %ebp
+  802ca1:	57                   	push   %edi
+  802ca2:	56                   	push   %esi
+  802ca3:	53                   	push   %ebx
+  802ca4:	83 ec 14             	sub    $0x14,%esp
+  802ca7:	8b 74 24 28          	mov    0x28(%esp),%esi
+  802cab:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  802caf:	89 fb                	mov    %edi,%ebx
+  802cb1:	09 f3                	or     %esi,%ebx
+  802cb3:	0f 84 88 00 00 00    	je     802d41 <udivmod+0xa1>
+  802cb9:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802cbe:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802cc5:	00 
+  802cc6:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802ccd:	00 
+  802cce:	89 cd                	mov    %ecx,%ebp
+  802cd0:	89 34 24             	mov    %esi,(%esp)
+  802cd3:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802cd7:	eb 08                	jmp    802ce1 <udivmod+0x41>
+  802cd9:	83 ed 01             	sub    $0x1,%ebp
+  802cdc:	83 fd ff             	cmp    $0xffffffff,%ebp
+  802cdf:	74 6c                	je     802d4d <udivmod+0xad>
+  802ce1:	89 c3                	mov    %eax,%ebx
+  802ce3:	89 d6                	mov    %edx,%esi
+  802ce5:	89 e9                	mov    %ebp,%ecx
+  802ce7:	0f ad f3             	shrd   %cl,%esi,%ebx
+  802cea:	d3 ee                	shr    %cl,%esi
+  802cec:	f6 c1 20             	test   $0x20,%cl
+  802cef:	74 04                	je     802cf5 <udivmod+0x55>
+  802cf1:	89 f3                	mov    %esi,%ebx
+  802cf3:	31 f6                	xor    %esi,%esi
+  802cf5:	8b 3c 24             	mov    (%esp),%edi
+  802cf8:	39 fb                	cmp    %edi,%ebx
+  802cfa:	89 f7                	mov    %esi,%edi
+  802cfc:	8b 1c 24             	mov    (%esp),%ebx
+  802cff:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802d03:	19 f7                	sbb    %esi,%edi
+  802d05:	72 d2                	jb     802cd9 <udivmod+0x39>
+  802d07:	89 f7                	mov    %esi,%edi
+  802d09:	89 de                	mov    %ebx,%esi
+  802d0b:	89 e9                	mov    %ebp,%ecx
+  802d0d:	0f a5 f7             	shld   %cl,%esi,%edi
+  802d10:	d3 e6                	shl    %cl,%esi
+  802d12:	f6 c1 20             	test   $0x20,%cl
+  802d15:	74 04                	je     802d1b <udivmod+0x7b>
+  802d17:	89 f7                	mov    %esi,%edi
+  802d19:	31 f6                	xor    %esi,%esi
+  802d1b:	29 f0                	sub    %esi,%eax
+  802d1d:	19 fa                	sbb    %edi,%edx
+  802d1f:	be 01 00 00 00       	mov    $0x1,%esi
+  802d24:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d29:	0f a5 f7             	shld   %cl,%esi,%edi
+  802d2c:	d3 e6                	shl    %cl,%esi
+  802d2e:	f6 c1 20             	test   $0x20,%cl
+  802d31:	74 04                	je     802d37 <udivmod+0x97>
+  802d33:	89 f7                	mov    %esi,%edi
+  802d35:	31 f6                	xor    %esi,%esi
+  802d37:	09 74 24 08          	or     %esi,0x8(%esp)
+  802d3b:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802d3f:	eb 98                	jmp    802cd9 <udivmod+0x39>
+  802d41:	89 f0                	mov    %esi,%eax
+  802d43:	89 fa                	mov    %edi,%edx
+  802d45:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802d49:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802d4d:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802d51:	89 01                	mov    %eax,(%ecx)
+  802d53:	89 51 04             	mov    %edx,0x4(%ecx)
+  802d56:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802d5a:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802d5e:	83 c4 14             	add    $0x14,%esp
+  802d61:	5b                   	pop    %ebx
+  802d62:	5e                   	pop    %esi
+  802d63:	5f                   	pop    %edi
+  802d64:	5d                   	pop    %ebp
+  802d65:	c3                   	ret
+
+00802d66 <__udivdi3>:
+  802d66:	83 ec 18             	sub    $0x18,%esp
+  802d69:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802d6d:	50                   	push   %eax
+  802d6e:	ff 74 24 2c          	push   0x2c(%esp)
+  802d72:	ff 74 24 2c          	push   0x2c(%esp)
+  802d76:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802d7a:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802d7e:	e8 1d ff ff ff       	call   802ca0 <udivmod>
+  802d83:	83 c4 24             	add    $0x24,%esp
+  802d86:	c3                   	ret
+
+00802d87 <__umoddi3>:
+  802d87:	83 ec 18             	sub    $0x18,%esp
+  802d8a:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802d8e:	50                   	push   %eax
+  802d8f:	ff 74 24 2c          	push   0x2c(%esp)
+  802d93:	ff 74 24 2c          	push   0x2c(%esp)
+  802d97:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802d9b:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802d9f:	e8 fc fe ff ff       	call   802ca0 <udivmod>
+  802da4:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802da8:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802dac:	83 c4 24             	add    $0x24,%esp
+  802daf:	c3                   	ret
+
+00802db0 <__divdi3>:
+  802db0:	56                   	push   %esi
+  802db1:	53                   	push   %ebx
+  802db2:	83 ec 14             	sub    $0x14,%esp
+  802db5:	8b 44 24 20          	mov    0x20(%esp),%eax
+  802db9:	8b 54 24 24          	mov    0x24(%esp),%edx
+  802dbd:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  802dc1:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  802dc5:	85 d2                	test   %edx,%edx
+  802dc7:	78 18                	js     802de1 <__divdi3+0x31>
+  802dc9:	85 db                	test   %ebx,%ebx
+  802dcb:	78 3e                	js     802e0b <__divdi3+0x5b>
+  802dcd:	83 ec 04             	sub    $0x4,%esp
+  802dd0:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802dd4:	56                   	push   %esi
+  802dd5:	53                   	push   %ebx
+  802dd6:	51                   	push   %ecx
+  802dd7:	e8 c4 fe ff ff       	call   802ca0 <udivmod>
+  802ddc:	83 c4 10             	add    $0x10,%esp
+  802ddf:	eb 24                	jmp    802e05 <__divdi3+0x55>
+  802de1:	f7 d8                	neg    %eax
+  802de3:	83 d2 00             	adc    $0x0,%edx
+  802de6:	f7 da                	neg    %edx
+  802de8:	85 db                	test   %ebx,%ebx
+  802dea:	78 3a                	js     802e26 <__divdi3+0x76>
+  802dec:	83 ec 04             	sub    $0x4,%esp
+  802def:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802df3:	56                   	push   %esi
+  802df4:	53                   	push   %ebx
+  802df5:	51                   	push   %ecx
+  802df6:	e8 a5 fe ff ff       	call   802ca0 <udivmod>
+  802dfb:	83 c4 10             	add    $0x10,%esp
+  802dfe:	f7 d8                	neg    %eax
+  802e00:	83 d2 00             	adc    $0x0,%edx
+  802e03:	f7 da                	neg    %edx
+  802e05:	83 c4 14             	add    $0x14,%esp
+  802e08:	5b                   	pop    %ebx
+  802e09:	5e                   	pop    %esi
+  802e0a:	c3                   	ret
+  802e0b:	83 ec 04             	sub    $0x4,%esp
+  802e0e:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802e12:	56                   	push   %esi
+  802e13:	f7 d9                	neg    %ecx
+  802e15:	83 d3 00             	adc    $0x0,%ebx
+  802e18:	f7 db                	neg    %ebx
+  802e1a:	53                   	push   %ebx
+  802e1b:	51                   	push   %ecx
+  802e1c:	e8 7f fe ff ff       	call   802ca0 <udivmod>
+  802e21:	83 c4 10             	add    $0x10,%esp
+  802e24:	eb d8                	jmp    802dfe <__divdi3+0x4e>
+  802e26:	83 ec 04             	sub    $0x4,%esp
+  802e29:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802e2d:	56                   	push   %esi
+  802e2e:	f7 d9                	neg    %ecx
+  802e30:	83 d3 00             	adc    $0x0,%ebx
+  802e33:	f7 db                	neg    %ebx
+  802e35:	53                   	push   %ebx
+  802e36:	51                   	push   %ecx
+  802e37:	e8 64 fe ff ff       	call   802ca0 <udivmod>
+  802e3c:	83 c4 10             	add    $0x10,%esp
+  802e3f:	eb c4                	jmp    802e05 <__divdi3+0x55>
+
+00802e41 <__moddi3>:
+  802e41:	55                   	push   %ebp
+  802e42:	57                   	push   %edi
+  802e43:	56                   	push   %esi
+  802e44:	53                   	push   %ebx
+  802e45:	83 ec 24             	sub    $0x24,%esp
+  802e48:	8b 44 24 38          	mov    0x38(%esp),%eax
+  802e4c:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  802e50:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  802e54:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  802e58:	85 d2                	test   %edx,%edx
+  802e5a:	78 3b                	js     802e97 <__moddi3+0x56>
+  802e5c:	83 ec 04             	sub    $0x4,%esp
+  802e5f:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  802e63:	56                   	push   %esi
+  802e64:	89 ce                	mov    %ecx,%esi
+  802e66:	f7 de                	neg    %esi
+  802e68:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802e6c:	89 de                	mov    %ebx,%esi
+  802e6e:	83 d6 00             	adc    $0x0,%esi
+  802e71:	f7 de                	neg    %esi
+  802e73:	89 74 24 14          	mov    %esi,0x14(%esp)
+  802e77:	8b 74 24 08          	mov    0x8(%esp),%esi
+  802e7b:	0f 48 f1             	cmovs  %ecx,%esi
+  802e7e:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  802e83:	53                   	push   %ebx
+  802e84:	56                   	push   %esi
+  802e85:	e8 16 fe ff ff       	call   802ca0 <udivmod>
+  802e8a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802e8e:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802e92:	83 c4 10             	add    $0x10,%esp
+  802e95:	eb 47                	jmp    802ede <__moddi3+0x9d>
+  802e97:	f7 d8                	neg    %eax
+  802e99:	83 d2 00             	adc    $0x0,%edx
+  802e9c:	f7 da                	neg    %edx
+  802e9e:	83 ec 04             	sub    $0x4,%esp
+  802ea1:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  802ea5:	56                   	push   %esi
+  802ea6:	89 cf                	mov    %ecx,%edi
+  802ea8:	f7 df                	neg    %edi
+  802eaa:	89 de                	mov    %ebx,%esi
+  802eac:	83 d6 00             	adc    $0x0,%esi
+  802eaf:	f7 de                	neg    %esi
+  802eb1:	0f 49 cf             	cmovns %edi,%ecx
+  802eb4:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  802eb8:	0f 49 de             	cmovns %esi,%ebx
+  802ebb:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  802ebf:	ff 74 24 0c          	push   0xc(%esp)
+  802ec3:	ff 74 24 0c          	push   0xc(%esp)
+  802ec7:	e8 d4 fd ff ff       	call   802ca0 <udivmod>
+  802ecc:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802ed0:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802ed4:	f7 d8                	neg    %eax
+  802ed6:	83 d2 00             	adc    $0x0,%edx
+  802ed9:	f7 da                	neg    %edx
+  802edb:	83 c4 10             	add    $0x10,%esp
+  802ede:	83 c4 24             	add    $0x24,%esp
+  802ee1:	5b                   	pop    %ebx
+  802ee2:	5e                   	pop    %esi
+  802ee3:	5f                   	pop    %edi
+  802ee4:	5d                   	pop    %ebp
+  802ee5:	c3                   	ret
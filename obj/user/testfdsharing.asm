@@ -0,0 +1,7891 @@
+
+obj/user/testfdsharing.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 99 01 00 00       	call   8001ca <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+char buf[512], buf2[512];
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	57                   	push   %edi
+  800037:	56                   	push   %esi
+  800038:	53                   	push   %ebx
+  800039:	83 ec 14             	sub    $0x14,%esp
+  int fd, r, n, n2;
+
+  if ((fd = open("motd", O_RDONLY)) < 0)
+  80003c:	6a 00                	push   $0x0
+  80003e:	68 e0 3a 80 00       	push   $0x803ae0
+  800043:	e8 1a 21 00 00       	call   802162 <open>
+  800048:	89 c3                	mov    %eax,%ebx
+  80004a:	83 c4 10             	add    $0x10,%esp
+  80004d:	85 c0                	test   %eax,%eax
+  80004f:	0f 88 ff 00 00 00    	js     800154 <umain+0x121>
+    panic("open motd: %e", fd);
+  seek(fd, 0);
+  800055:	83 ec 08             	sub    $0x8,%esp
+  800058:	6a 00                	push   $0x0
+  80005a:	50                   	push   %eax
+  80005b:	e8 27 1a 00 00       	call   801a87 <seek>
+  if ((n = readn(fd, buf, sizeof buf)) <= 0)
+  800060:	83 c4 0c             	add    $0xc,%esp
+  800063:	68 00 02 00 00       	push   $0x200
+  800068:	68 a0 6a 80 00       	push   $0x806aa0
+  80006d:	53                   	push   %ebx
+  80006e:	e8 4b 19 00 00       	call   8019be <readn>
+  800073:	89 c6                	mov    %eax,%esi
+  800075:	83 c4 10             	add    $0x10,%esp
+  800078:	85 c0                	test   %eax,%eax
+  80007a:	0f 8e e6 00 00 00    	jle    800166 <umain+0x133>
+    panic("readn: %e", n);
+
+  if ((r = fork()) < 0)
+  800080:	e8 17 13 00 00       	call   80139c <fork>
+  800085:	89 c7                	mov    %eax,%edi
+  800087:	85 c0                	test   %eax,%eax
+  800089:	0f 88 e9 00 00 00    	js     800178 <umain+0x145>
+    panic("fork: %e", r);
+  if (r == 0) {
+  80008f:	75 7b                	jne    80010c <umain+0xd9>
+    seek(fd, 0);
+  800091:	83 ec 08             	sub    $0x8,%esp
+  800094:	6a 00                	push   $0x0
+  800096:	53                   	push   %ebx
+  800097:	e8 eb 19 00 00       	call   801a87 <seek>
+    cprintf("going to read in child (might page fault if your sharing is buggy)\n");
+  80009c:	c7 04 24 48 3b 80 00 	movl   $0x803b48,(%esp)
+  8000a3:	e8 6a 02 00 00       	call   800312 <cprintf>
+    if ((n2 = readn(fd, buf2, sizeof buf2)) != n)
+  8000a8:	83 c4 0c             	add    $0xc,%esp
+  8000ab:	68 00 02 00 00       	push   $0x200
+  8000b0:	68 a0 68 80 00       	push   $0x8068a0
+  8000b5:	53                   	push   %ebx
+  8000b6:	e8 03 19 00 00       	call   8019be <readn>
+  8000bb:	83 c4 10             	add    $0x10,%esp
+  8000be:	39 c6                	cmp    %eax,%esi
+  8000c0:	0f 85 c4 00 00 00    	jne    80018a <umain+0x157>
+      panic("read in parent got %d, read in child got %d", n, n2);
+    if (memcmp(buf, buf2, n) != 0)
+  8000c6:	83 ec 04             	sub    $0x4,%esp
+  8000c9:	56                   	push   %esi
+  8000ca:	68 a0 68 80 00       	push   $0x8068a0
+  8000cf:	68 a0 6a 80 00       	push   $0x806aa0
+  8000d4:	e8 25 0a 00 00       	call   800afe <memcmp>
+  8000d9:	83 c4 10             	add    $0x10,%esp
+  8000dc:	85 c0                	test   %eax,%eax
+  8000de:	0f 85 bc 00 00 00    	jne    8001a0 <umain+0x16d>
+      panic("read in parent got different bytes from read in child");
+    cprintf("read in child succeeded\n");
+  8000e4:	83 ec 0c             	sub    $0xc,%esp
+  8000e7:	68 12 3b 80 00       	push   $0x803b12
+  8000ec:	e8 21 02 00 00       	call   800312 <cprintf>
+    seek(fd, 0);
+  8000f1:	83 c4 08             	add    $0x8,%esp
+  8000f4:	6a 00                	push   $0x0
+  8000f6:	53                   	push   %ebx
+  8000f7:	e8 8b 19 00 00       	call   801a87 <seek>
+    close(fd);
+  8000fc:	89 1c 24             	mov    %ebx,(%esp)
+  8000ff:	e8 ab 16 00 00       	call   8017af <close>
+    exit();
+  800104:	e8 14 01 00 00       	call   80021d <exit>
+  800109:	83 c4 10             	add    $0x10,%esp
+  }
+  wait(r);
+  80010c:	83 ec 0c             	sub    $0xc,%esp
+  80010f:	57                   	push   %edi
+  800110:	e8 9a 2d 00 00       	call   802eaf <wait>
+  if ((n2 = readn(fd, buf2, sizeof buf2)) != n)
+  800115:	83 c4 0c             	add    $0xc,%esp
+  800118:	68 00 02 00 00       	push   $0x200
+  80011d:	68 a0 68 80 00       	push   $0x8068a0
+  800122:	53                   	push   %ebx
+  800123:	e8 96 18 00 00       	call   8019be <readn>
+  800128:	83 c4 10             	add    $0x10,%esp
+  80012b:	39 c6                	cmp    %eax,%esi
+  80012d:	0f 85 81 00 00 00    	jne    8001b4 <umain+0x181>
+    panic("read in parent got %d, then got %d", n, n2);
+  cprintf("read in parent succeeded\n");
+  800133:	83 ec 0c             	sub    $0xc,%esp
+  800136:	68 2b 3b 80 00       	push   $0x803b2b
+  80013b:	e8 d2 01 00 00       	call   800312 <cprintf>
+  close(fd);
+  800140:	89 1c 24             	mov    %ebx,(%esp)
+  800143:	e8 67 16 00 00       	call   8017af <close>
+static __inline uint64_t read_tsc(void) __attribute__((always_inline));
+
+static __inline void
+breakpoint(void)
+{
+  __asm __volatile("int3");
+  800148:	cc                   	int3
+
+  breakpoint();
+}
+  800149:	83 c4 10             	add    $0x10,%esp
+  80014c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80014f:	5b                   	pop    %ebx
+  800150:	5e                   	pop    %esi
+  800151:	5f                   	pop    %edi
+  800152:	5d                   	pop    %ebp
+  800153:	c3                   	ret
+    panic("open motd: %e", fd);
+  800154:	50                   	push   %eax
+  800155:	68 e5 3a 80 00       	push   $0x803ae5
+  80015a:	6a 0c                	push   $0xc
+  80015c:	68 f3 3a 80 00       	push   $0x803af3
+  800161:	e8 d1 00 00 00       	call   800237 <_panic>
+    panic("readn: %e", n);
+  800166:	50                   	push   %eax
+  800167:	68 08 3b 80 00       	push   $0x803b08
+  80016c:	6a 0f                	push   $0xf
+  80016e:	68 f3 3a 80 00       	push   $0x803af3
+  800173:	e8 bf 00 00 00       	call   800237 <_panic>
+    panic("fork: %e", r);
+  800178:	50                   	push   %eax
+  800179:	68 e3 3f 80 00       	push   $0x803fe3
+  80017e:	6a 12                	push   $0x12
+  800180:	68 f3 3a 80 00       	push   $0x803af3
+  800185:	e8 ad 00 00 00       	call   800237 <_panic>
+      panic("read in parent got %d, read in child got %d", n, n2);
+  80018a:	83 ec 0c             	sub    $0xc,%esp
+  80018d:	50                   	push   %eax
+  80018e:	56                   	push   %esi
+  80018f:	68 8c 3b 80 00       	push   $0x803b8c
+  800194:	6a 17                	push   $0x17
+  800196:	68 f3 3a 80 00       	push   $0x803af3
+  80019b:	e8 97 00 00 00       	call   800237 <_panic>
+      panic("read in parent got different bytes from read in child");
+  8001a0:	83 ec 04             	sub    $0x4,%esp
+  8001a3:	68 b8 3b 80 00       	push   $0x803bb8
+  8001a8:	6a 19                	push   $0x19
+  8001aa:	68 f3 3a 80 00       	push   $0x803af3
+  8001af:	e8 83 00 00 00       	call   800237 <_panic>
+    panic("read in parent got %d, then got %d", n, n2);
+  8001b4:	83 ec 0c             	sub    $0xc,%esp
+  8001b7:	50                   	push   %eax
+  8001b8:	56                   	push   %esi
+  8001b9:	68 f0 3b 80 00       	push   $0x803bf0
+  8001be:	6a 21                	push   $0x21
+  8001c0:	68 f3 3a 80 00       	push   $0x803af3
+  8001c5:	e8 6d 00 00 00       	call   800237 <_panic>
+
+008001ca <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8001ca:	55                   	push   %ebp
+  8001cb:	89 e5                	mov    %esp,%ebp
+  8001cd:	56                   	push   %esi
+  8001ce:	53                   	push   %ebx
+  8001cf:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8001d2:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  8001d5:	c7 05 a0 6c 80 00 00 	movl   $0x0,0x806ca0
+  8001dc:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  8001df:	e8 ca 0a 00 00       	call   800cae <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  8001e4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8001e9:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8001ec:	c1 e0 04             	shl    $0x4,%eax
+  8001ef:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8001f4:	a3 a0 6c 80 00       	mov    %eax,0x806ca0
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8001f9:	85 db                	test   %ebx,%ebx
+  8001fb:	7e 07                	jle    800204 <libmain+0x3a>
+    binaryname = argv[0];
+  8001fd:	8b 06                	mov    (%esi),%eax
+  8001ff:	a3 00 50 80 00       	mov    %eax,0x805000
+
+  // call user main routine
+  umain(argc, argv);
+  800204:	83 ec 08             	sub    $0x8,%esp
+  800207:	56                   	push   %esi
+  800208:	53                   	push   %ebx
+  800209:	e8 25 fe ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  80020e:	e8 0a 00 00 00       	call   80021d <exit>
+}
+  800213:	83 c4 10             	add    $0x10,%esp
+  800216:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800219:	5b                   	pop    %ebx
+  80021a:	5e                   	pop    %esi
+  80021b:	5d                   	pop    %ebp
+  80021c:	c3                   	ret
+
+0080021d <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  80021d:	55                   	push   %ebp
+  80021e:	89 e5                	mov    %esp,%ebp
+  800220:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  800223:	e8 b4 15 00 00       	call   8017dc <close_all>
+  sys_env_destroy(0);
+  800228:	83 ec 0c             	sub    $0xc,%esp
+  80022b:	6a 00                	push   $0x0
+  80022d:	e8 3b 0a 00 00       	call   800c6d <sys_env_destroy>
+}
+  800232:	83 c4 10             	add    $0x10,%esp
+  800235:	c9                   	leave
+  800236:	c3                   	ret
+
+00800237 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  800237:	55                   	push   %ebp
+  800238:	89 e5                	mov    %esp,%ebp
+  80023a:	56                   	push   %esi
+  80023b:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  80023c:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  80023f:	8b 35 00 50 80 00    	mov    0x805000,%esi
+  800245:	e8 64 0a 00 00       	call   800cae <sys_getenvid>
+  80024a:	83 ec 0c             	sub    $0xc,%esp
+  80024d:	ff 75 0c             	push   0xc(%ebp)
+  800250:	ff 75 08             	push   0x8(%ebp)
+  800253:	56                   	push   %esi
+  800254:	50                   	push   %eax
+  800255:	68 20 3c 80 00       	push   $0x803c20
+  80025a:	e8 b3 00 00 00       	call   800312 <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  80025f:	83 c4 18             	add    $0x18,%esp
+  800262:	53                   	push   %ebx
+  800263:	ff 75 10             	push   0x10(%ebp)
+  800266:	e8 56 00 00 00       	call   8002c1 <vcprintf>
+  cprintf("\n");
+  80026b:	c7 04 24 29 3b 80 00 	movl   $0x803b29,(%esp)
+  800272:	e8 9b 00 00 00       	call   800312 <cprintf>
+  800277:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  80027a:	cc                   	int3
+  while (1)
+  80027b:	eb fd                	jmp    80027a <_panic+0x43>
+
+0080027d <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80027d:	55                   	push   %ebp
+  80027e:	89 e5                	mov    %esp,%ebp
+  800280:	53                   	push   %ebx
+  800281:	83 ec 04             	sub    $0x4,%esp
+  800284:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  800287:	8b 13                	mov    (%ebx),%edx
+  800289:	8d 42 01             	lea    0x1(%edx),%eax
+  80028c:	89 03                	mov    %eax,(%ebx)
+  80028e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800291:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  800295:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80029a:	74 09                	je     8002a5 <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  80029c:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8002a0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8002a3:	c9                   	leave
+  8002a4:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  8002a5:	83 ec 08             	sub    $0x8,%esp
+  8002a8:	68 ff 00 00 00       	push   $0xff
+  8002ad:	8d 43 08             	lea    0x8(%ebx),%eax
+  8002b0:	50                   	push   %eax
+  8002b1:	e8 7a 09 00 00       	call   800c30 <sys_cputs>
+    b->idx = 0;
+  8002b6:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8002bc:	83 c4 10             	add    $0x10,%esp
+  8002bf:	eb db                	jmp    80029c <putch+0x1f>
+
+008002c1 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8002c1:	55                   	push   %ebp
+  8002c2:	89 e5                	mov    %esp,%ebp
+  8002c4:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  8002ca:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8002d1:	00 00 00 
+  b.cnt = 0;
+  8002d4:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8002db:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  8002de:	ff 75 0c             	push   0xc(%ebp)
+  8002e1:	ff 75 08             	push   0x8(%ebp)
+  8002e4:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8002ea:	50                   	push   %eax
+  8002eb:	68 7d 02 80 00       	push   $0x80027d
+  8002f0:	e8 14 01 00 00       	call   800409 <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  8002f5:	83 c4 08             	add    $0x8,%esp
+  8002f8:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8002fe:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800304:	50                   	push   %eax
+  800305:	e8 26 09 00 00       	call   800c30 <sys_cputs>
+
+  return b.cnt;
+}
+  80030a:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800310:	c9                   	leave
+  800311:	c3                   	ret
+
+00800312 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  800312:	55                   	push   %ebp
+  800313:	89 e5                	mov    %esp,%ebp
+  800315:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  800318:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  80031b:	50                   	push   %eax
+  80031c:	ff 75 08             	push   0x8(%ebp)
+  80031f:	e8 9d ff ff ff       	call   8002c1 <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  800324:	c9                   	leave
+  800325:	c3                   	ret
+
+00800326 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  800326:	55                   	push   %ebp
+  800327:	89 e5                	mov    %esp,%ebp
+  800329:	57                   	push   %edi
+  80032a:	56                   	push   %esi
+  80032b:	53                   	push   %ebx
+  80032c:	83 ec 1c             	sub    $0x1c,%esp
+  80032f:	89 c7                	mov    %eax,%edi
+  800331:	89 d6                	mov    %edx,%esi
+  800333:	8b 45 08             	mov    0x8(%ebp),%eax
+  800336:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800339:	89 d1                	mov    %edx,%ecx
+  80033b:	89 c2                	mov    %eax,%edx
+  80033d:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800340:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800343:	8b 45 10             	mov    0x10(%ebp),%eax
+  800346:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  800349:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80034c:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800353:	39 c2                	cmp    %eax,%edx
+  800355:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800358:	72 3e                	jb     800398 <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  80035a:	83 ec 0c             	sub    $0xc,%esp
+  80035d:	ff 75 18             	push   0x18(%ebp)
+  800360:	83 eb 01             	sub    $0x1,%ebx
+  800363:	53                   	push   %ebx
+  800364:	50                   	push   %eax
+  800365:	83 ec 08             	sub    $0x8,%esp
+  800368:	ff 75 e4             	push   -0x1c(%ebp)
+  80036b:	ff 75 e0             	push   -0x20(%ebp)
+  80036e:	ff 75 dc             	push   -0x24(%ebp)
+  800371:	ff 75 d8             	push   -0x28(%ebp)
+  800374:	e8 e1 35 00 00       	call   80395a <__udivdi3>
+  800379:	83 c4 18             	add    $0x18,%esp
+  80037c:	52                   	push   %edx
+  80037d:	50                   	push   %eax
+  80037e:	89 f2                	mov    %esi,%edx
+  800380:	89 f8                	mov    %edi,%eax
+  800382:	e8 9f ff ff ff       	call   800326 <printnum>
+  800387:	83 c4 20             	add    $0x20,%esp
+  80038a:	eb 13                	jmp    80039f <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  80038c:	83 ec 08             	sub    $0x8,%esp
+  80038f:	56                   	push   %esi
+  800390:	ff 75 18             	push   0x18(%ebp)
+  800393:	ff d7                	call   *%edi
+  800395:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  800398:	83 eb 01             	sub    $0x1,%ebx
+  80039b:	85 db                	test   %ebx,%ebx
+  80039d:	7f ed                	jg     80038c <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  80039f:	83 ec 08             	sub    $0x8,%esp
+  8003a2:	56                   	push   %esi
+  8003a3:	83 ec 04             	sub    $0x4,%esp
+  8003a6:	ff 75 e4             	push   -0x1c(%ebp)
+  8003a9:	ff 75 e0             	push   -0x20(%ebp)
+  8003ac:	ff 75 dc             	push   -0x24(%ebp)
+  8003af:	ff 75 d8             	push   -0x28(%ebp)
+  8003b2:	e8 c4 35 00 00       	call   80397b <__umoddi3>
+  8003b7:	83 c4 14             	add    $0x14,%esp
+  8003ba:	0f be 80 43 3c 80 00 	movsbl 0x803c43(%eax),%eax
+  8003c1:	50                   	push   %eax
+  8003c2:	ff d7                	call   *%edi
+}
+  8003c4:	83 c4 10             	add    $0x10,%esp
+  8003c7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8003ca:	5b                   	pop    %ebx
+  8003cb:	5e                   	pop    %esi
+  8003cc:	5f                   	pop    %edi
+  8003cd:	5d                   	pop    %ebp
+  8003ce:	c3                   	ret
+
+008003cf <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8003cf:	55                   	push   %ebp
+  8003d0:	89 e5                	mov    %esp,%ebp
+  8003d2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  8003d5:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  8003d9:	8b 10                	mov    (%eax),%edx
+  8003db:	3b 50 04             	cmp    0x4(%eax),%edx
+  8003de:	73 0a                	jae    8003ea <sprintputch+0x1b>
+    *b->buf++ = ch;
+  8003e0:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8003e3:	89 08                	mov    %ecx,(%eax)
+  8003e5:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003e8:	88 02                	mov    %al,(%edx)
+}
+  8003ea:	5d                   	pop    %ebp
+  8003eb:	c3                   	ret
+
+008003ec <printfmt>:
+{
+  8003ec:	55                   	push   %ebp
+  8003ed:	89 e5                	mov    %esp,%ebp
+  8003ef:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  8003f2:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  8003f5:	50                   	push   %eax
+  8003f6:	ff 75 10             	push   0x10(%ebp)
+  8003f9:	ff 75 0c             	push   0xc(%ebp)
+  8003fc:	ff 75 08             	push   0x8(%ebp)
+  8003ff:	e8 05 00 00 00       	call   800409 <vprintfmt>
+}
+  800404:	83 c4 10             	add    $0x10,%esp
+  800407:	c9                   	leave
+  800408:	c3                   	ret
+
+00800409 <vprintfmt>:
+{
+  800409:	55                   	push   %ebp
+  80040a:	89 e5                	mov    %esp,%ebp
+  80040c:	57                   	push   %edi
+  80040d:	56                   	push   %esi
+  80040e:	53                   	push   %ebx
+  80040f:	83 ec 2c             	sub    $0x2c,%esp
+  800412:	8b 75 08             	mov    0x8(%ebp),%esi
+  800415:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800418:	8b 7d 10             	mov    0x10(%ebp),%edi
+  80041b:	eb 0a                	jmp    800427 <vprintfmt+0x1e>
+      putch(ch, putdat);
+  80041d:	83 ec 08             	sub    $0x8,%esp
+  800420:	53                   	push   %ebx
+  800421:	50                   	push   %eax
+  800422:	ff d6                	call   *%esi
+  800424:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  800427:	83 c7 01             	add    $0x1,%edi
+  80042a:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  80042e:	83 f8 25             	cmp    $0x25,%eax
+  800431:	74 0c                	je     80043f <vprintfmt+0x36>
+      if (ch == '\0')
+  800433:	85 c0                	test   %eax,%eax
+  800435:	75 e6                	jne    80041d <vprintfmt+0x14>
+}
+  800437:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80043a:	5b                   	pop    %ebx
+  80043b:	5e                   	pop    %esi
+  80043c:	5f                   	pop    %edi
+  80043d:	5d                   	pop    %ebp
+  80043e:	c3                   	ret
+    padc = ' ';
+  80043f:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  800443:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  80044a:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  800451:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  800458:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  80045d:	8d 47 01             	lea    0x1(%edi),%eax
+  800460:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800463:	0f b6 17             	movzbl (%edi),%edx
+  800466:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800469:	3c 55                	cmp    $0x55,%al
+  80046b:	0f 87 cf 03 00 00    	ja     800840 <vprintfmt+0x437>
+  800471:	0f b6 c0             	movzbl %al,%eax
+  800474:	ff 24 85 80 3d 80 00 	jmp    *0x803d80(,%eax,4)
+  80047b:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  80047e:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800482:	eb d9                	jmp    80045d <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  800484:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800487:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80048b:	eb d0                	jmp    80045d <vprintfmt+0x54>
+  80048d:	0f b6 d2             	movzbl %dl,%edx
+  800490:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  800493:	b8 00 00 00 00       	mov    $0x0,%eax
+  800498:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  80049b:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80049e:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  8004a2:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  8004a5:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8004a8:	83 f9 09             	cmp    $0x9,%ecx
+  8004ab:	77 55                	ja     800502 <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  8004ad:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  8004b0:	eb e9                	jmp    80049b <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  8004b2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004b5:	8b 00                	mov    (%eax),%eax
+  8004b7:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8004ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8004bd:	8d 40 04             	lea    0x4(%eax),%eax
+  8004c0:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  8004c3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  8004c6:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8004ca:	79 91                	jns    80045d <vprintfmt+0x54>
+        width = precision, precision = -1;
+  8004cc:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8004cf:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8004d2:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8004d9:	eb 82                	jmp    80045d <vprintfmt+0x54>
+      if (width < 0)
+  8004db:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8004de:	85 d2                	test   %edx,%edx
+  8004e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004e5:	0f 49 c2             	cmovns %edx,%eax
+  8004e8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  8004eb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  8004ee:	e9 6a ff ff ff       	jmp    80045d <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  8004f3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  8004f6:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  8004fd:	e9 5b ff ff ff       	jmp    80045d <vprintfmt+0x54>
+  800502:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800505:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800508:	eb bc                	jmp    8004c6 <vprintfmt+0xbd>
+      lflag++;
+  80050a:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  80050d:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  800510:	e9 48 ff ff ff       	jmp    80045d <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  800515:	8b 45 14             	mov    0x14(%ebp),%eax
+  800518:	8d 78 04             	lea    0x4(%eax),%edi
+  80051b:	83 ec 08             	sub    $0x8,%esp
+  80051e:	53                   	push   %ebx
+  80051f:	ff 30                	push   (%eax)
+  800521:	ff d6                	call   *%esi
+      break;
+  800523:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  800526:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  800529:	e9 b1 02 00 00       	jmp    8007df <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  80052e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800531:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  800534:	8b 10                	mov    (%eax),%edx
+  800536:	89 d0                	mov    %edx,%eax
+  800538:	f7 d8                	neg    %eax
+  80053a:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  80053d:	83 f8 10             	cmp    $0x10,%eax
+  800540:	7f 23                	jg     800565 <vprintfmt+0x15c>
+  800542:	8b 14 85 e0 3e 80 00 	mov    0x803ee0(,%eax,4),%edx
+  800549:	85 d2                	test   %edx,%edx
+  80054b:	74 18                	je     800565 <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  80054d:	52                   	push   %edx
+  80054e:	68 f6 40 80 00       	push   $0x8040f6
+  800553:	53                   	push   %ebx
+  800554:	56                   	push   %esi
+  800555:	e8 92 fe ff ff       	call   8003ec <printfmt>
+  80055a:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  80055d:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800560:	e9 7a 02 00 00       	jmp    8007df <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  800565:	50                   	push   %eax
+  800566:	68 5b 3c 80 00       	push   $0x803c5b
+  80056b:	53                   	push   %ebx
+  80056c:	56                   	push   %esi
+  80056d:	e8 7a fe ff ff       	call   8003ec <printfmt>
+  800572:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  800575:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  800578:	e9 62 02 00 00       	jmp    8007df <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  80057d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800580:	83 c0 04             	add    $0x4,%eax
+  800583:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800586:	8b 45 14             	mov    0x14(%ebp),%eax
+  800589:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  80058b:	85 c9                	test   %ecx,%ecx
+  80058d:	b8 54 3c 80 00       	mov    $0x803c54,%eax
+  800592:	0f 45 c1             	cmovne %ecx,%eax
+  800595:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  800598:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80059c:	7e 06                	jle    8005a4 <vprintfmt+0x19b>
+  80059e:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8005a2:	75 0b                	jne    8005af <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8005a4:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8005a7:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8005aa:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005ad:	eb 5c                	jmp    80060b <vprintfmt+0x202>
+  8005af:	83 ec 08             	sub    $0x8,%esp
+  8005b2:	ff 75 d0             	push   -0x30(%ebp)
+  8005b5:	ff 75 cc             	push   -0x34(%ebp)
+  8005b8:	e8 20 03 00 00       	call   8008dd <strnlen>
+  8005bd:	89 c2                	mov    %eax,%edx
+  8005bf:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005c2:	29 d0                	sub    %edx,%eax
+  8005c4:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  8005c7:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8005cb:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005ce:	89 75 08             	mov    %esi,0x8(%ebp)
+  8005d1:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8005d3:	eb 0e                	jmp    8005e3 <vprintfmt+0x1da>
+          putch(padc, putdat);
+  8005d5:	83 ec 08             	sub    $0x8,%esp
+  8005d8:	53                   	push   %ebx
+  8005d9:	57                   	push   %edi
+  8005da:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8005dd:	83 ee 01             	sub    $0x1,%esi
+  8005e0:	83 c4 10             	add    $0x10,%esp
+  8005e3:	85 f6                	test   %esi,%esi
+  8005e5:	7f ee                	jg     8005d5 <vprintfmt+0x1cc>
+  8005e7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8005ea:	8b 75 08             	mov    0x8(%ebp),%esi
+  8005ed:	85 c0                	test   %eax,%eax
+  8005ef:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005f4:	0f 49 d0             	cmovns %eax,%edx
+  8005f7:	29 d0                	sub    %edx,%eax
+  8005f9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005fc:	eb a6                	jmp    8005a4 <vprintfmt+0x19b>
+          putch(ch, putdat);
+  8005fe:	83 ec 08             	sub    $0x8,%esp
+  800601:	53                   	push   %ebx
+  800602:	52                   	push   %edx
+  800603:	ff 55 08             	call   *0x8(%ebp)
+  800606:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800609:	89 f1                	mov    %esi,%ecx
+  80060b:	8d 71 01             	lea    0x1(%ecx),%esi
+  80060e:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800612:	0f be d0             	movsbl %al,%edx
+  800615:	85 d2                	test   %edx,%edx
+  800617:	74 28                	je     800641 <vprintfmt+0x238>
+  800619:	85 ff                	test   %edi,%edi
+  80061b:	78 05                	js     800622 <vprintfmt+0x219>
+  80061d:	83 ef 01             	sub    $0x1,%edi
+  800620:	78 30                	js     800652 <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  800622:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800626:	74 d6                	je     8005fe <vprintfmt+0x1f5>
+  800628:	0f be c0             	movsbl %al,%eax
+  80062b:	83 e8 20             	sub    $0x20,%eax
+  80062e:	83 f8 5e             	cmp    $0x5e,%eax
+  800631:	76 cb                	jbe    8005fe <vprintfmt+0x1f5>
+          putch('?', putdat);
+  800633:	83 ec 08             	sub    $0x8,%esp
+  800636:	53                   	push   %ebx
+  800637:	6a 3f                	push   $0x3f
+  800639:	ff 55 08             	call   *0x8(%ebp)
+  80063c:	83 c4 10             	add    $0x10,%esp
+  80063f:	eb c8                	jmp    800609 <vprintfmt+0x200>
+  800641:	8b 75 08             	mov    0x8(%ebp),%esi
+  800644:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800647:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80064a:	01 d0                	add    %edx,%eax
+  80064c:	29 c8                	sub    %ecx,%eax
+  80064e:	89 c7                	mov    %eax,%edi
+  800650:	eb 13                	jmp    800665 <vprintfmt+0x25c>
+  800652:	8b 75 08             	mov    0x8(%ebp),%esi
+  800655:	eb ed                	jmp    800644 <vprintfmt+0x23b>
+        putch(' ', putdat);
+  800657:	83 ec 08             	sub    $0x8,%esp
+  80065a:	53                   	push   %ebx
+  80065b:	6a 20                	push   $0x20
+  80065d:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  80065f:	83 ef 01             	sub    $0x1,%edi
+  800662:	83 c4 10             	add    $0x10,%esp
+  800665:	85 ff                	test   %edi,%edi
+  800667:	7f ee                	jg     800657 <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  800669:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  80066c:	89 45 14             	mov    %eax,0x14(%ebp)
+  80066f:	e9 6b 01 00 00       	jmp    8007df <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  800674:	83 f9 01             	cmp    $0x1,%ecx
+  800677:	7f 1f                	jg     800698 <vprintfmt+0x28f>
+  else if (lflag)
+  800679:	85 c9                	test   %ecx,%ecx
+  80067b:	74 67                	je     8006e4 <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  80067d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800680:	8b 00                	mov    (%eax),%eax
+  800682:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800685:	89 c1                	mov    %eax,%ecx
+  800687:	c1 f9 1f             	sar    $0x1f,%ecx
+  80068a:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80068d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800690:	8d 40 04             	lea    0x4(%eax),%eax
+  800693:	89 45 14             	mov    %eax,0x14(%ebp)
+  800696:	eb 17                	jmp    8006af <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  800698:	8b 45 14             	mov    0x14(%ebp),%eax
+  80069b:	8b 50 04             	mov    0x4(%eax),%edx
+  80069e:	8b 00                	mov    (%eax),%eax
+  8006a0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006a3:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8006a6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006a9:	8d 40 08             	lea    0x8(%eax),%eax
+  8006ac:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  8006af:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006b2:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  8006b5:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  8006ba:	85 c9                	test   %ecx,%ecx
+  8006bc:	0f 89 03 01 00 00    	jns    8007c5 <vprintfmt+0x3bc>
+        putch('-', putdat);
+  8006c2:	83 ec 08             	sub    $0x8,%esp
+  8006c5:	53                   	push   %ebx
+  8006c6:	6a 2d                	push   $0x2d
+  8006c8:	ff d6                	call   *%esi
+        num = -(long long)num;
+  8006ca:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8006cd:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8006d0:	f7 da                	neg    %edx
+  8006d2:	83 d1 00             	adc    $0x0,%ecx
+  8006d5:	f7 d9                	neg    %ecx
+  8006d7:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  8006da:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8006df:	e9 e1 00 00 00       	jmp    8007c5 <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  8006e4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006e7:	8b 00                	mov    (%eax),%eax
+  8006e9:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8006ec:	89 c1                	mov    %eax,%ecx
+  8006ee:	c1 f9 1f             	sar    $0x1f,%ecx
+  8006f1:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8006f4:	8b 45 14             	mov    0x14(%ebp),%eax
+  8006f7:	8d 40 04             	lea    0x4(%eax),%eax
+  8006fa:	89 45 14             	mov    %eax,0x14(%ebp)
+  8006fd:	eb b0                	jmp    8006af <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  8006ff:	83 f9 01             	cmp    $0x1,%ecx
+  800702:	7f 1e                	jg     800722 <vprintfmt+0x319>
+  else if (lflag)
+  800704:	85 c9                	test   %ecx,%ecx
+  800706:	74 32                	je     80073a <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  800708:	8b 45 14             	mov    0x14(%ebp),%eax
+  80070b:	8b 10                	mov    (%eax),%edx
+  80070d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800712:	8d 40 04             	lea    0x4(%eax),%eax
+  800715:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800718:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  80071d:	e9 a3 00 00 00       	jmp    8007c5 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800722:	8b 45 14             	mov    0x14(%ebp),%eax
+  800725:	8b 10                	mov    (%eax),%edx
+  800727:	8b 48 04             	mov    0x4(%eax),%ecx
+  80072a:	8d 40 08             	lea    0x8(%eax),%eax
+  80072d:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800730:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  800735:	e9 8b 00 00 00       	jmp    8007c5 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  80073a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80073d:	8b 10                	mov    (%eax),%edx
+  80073f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800744:	8d 40 04             	lea    0x4(%eax),%eax
+  800747:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  80074a:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  80074f:	eb 74                	jmp    8007c5 <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  800751:	83 f9 01             	cmp    $0x1,%ecx
+  800754:	7f 1b                	jg     800771 <vprintfmt+0x368>
+  else if (lflag)
+  800756:	85 c9                	test   %ecx,%ecx
+  800758:	74 2c                	je     800786 <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  80075a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80075d:	8b 10                	mov    (%eax),%edx
+  80075f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800764:	8d 40 04             	lea    0x4(%eax),%eax
+  800767:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  80076a:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  80076f:	eb 54                	jmp    8007c5 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800771:	8b 45 14             	mov    0x14(%ebp),%eax
+  800774:	8b 10                	mov    (%eax),%edx
+  800776:	8b 48 04             	mov    0x4(%eax),%ecx
+  800779:	8d 40 08             	lea    0x8(%eax),%eax
+  80077c:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  80077f:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  800784:	eb 3f                	jmp    8007c5 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800786:	8b 45 14             	mov    0x14(%ebp),%eax
+  800789:	8b 10                	mov    (%eax),%edx
+  80078b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800790:	8d 40 04             	lea    0x4(%eax),%eax
+  800793:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800796:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  80079b:	eb 28                	jmp    8007c5 <vprintfmt+0x3bc>
+      putch('0', putdat);
+  80079d:	83 ec 08             	sub    $0x8,%esp
+  8007a0:	53                   	push   %ebx
+  8007a1:	6a 30                	push   $0x30
+  8007a3:	ff d6                	call   *%esi
+      putch('x', putdat);
+  8007a5:	83 c4 08             	add    $0x8,%esp
+  8007a8:	53                   	push   %ebx
+  8007a9:	6a 78                	push   $0x78
+  8007ab:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  8007ad:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b0:	8b 10                	mov    (%eax),%edx
+  8007b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  8007b7:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  8007ba:	8d 40 04             	lea    0x4(%eax),%eax
+  8007bd:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8007c0:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  8007c5:	83 ec 0c             	sub    $0xc,%esp
+  8007c8:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8007cc:	50                   	push   %eax
+  8007cd:	ff 75 e0             	push   -0x20(%ebp)
+  8007d0:	57                   	push   %edi
+  8007d1:	51                   	push   %ecx
+  8007d2:	52                   	push   %edx
+  8007d3:	89 da                	mov    %ebx,%edx
+  8007d5:	89 f0                	mov    %esi,%eax
+  8007d7:	e8 4a fb ff ff       	call   800326 <printnum>
+      break;
+  8007dc:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  8007df:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  8007e2:	e9 40 fc ff ff       	jmp    800427 <vprintfmt+0x1e>
+  if (lflag >= 2)
+  8007e7:	83 f9 01             	cmp    $0x1,%ecx
+  8007ea:	7f 1b                	jg     800807 <vprintfmt+0x3fe>
+  else if (lflag)
+  8007ec:	85 c9                	test   %ecx,%ecx
+  8007ee:	74 2c                	je     80081c <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  8007f0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007f3:	8b 10                	mov    (%eax),%edx
+  8007f5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007fa:	8d 40 04             	lea    0x4(%eax),%eax
+  8007fd:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800800:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  800805:	eb be                	jmp    8007c5 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800807:	8b 45 14             	mov    0x14(%ebp),%eax
+  80080a:	8b 10                	mov    (%eax),%edx
+  80080c:	8b 48 04             	mov    0x4(%eax),%ecx
+  80080f:	8d 40 08             	lea    0x8(%eax),%eax
+  800812:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800815:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  80081a:	eb a9                	jmp    8007c5 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  80081c:	8b 45 14             	mov    0x14(%ebp),%eax
+  80081f:	8b 10                	mov    (%eax),%edx
+  800821:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800826:	8d 40 04             	lea    0x4(%eax),%eax
+  800829:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  80082c:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  800831:	eb 92                	jmp    8007c5 <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  800833:	83 ec 08             	sub    $0x8,%esp
+  800836:	53                   	push   %ebx
+  800837:	6a 25                	push   $0x25
+  800839:	ff d6                	call   *%esi
+      break;
+  80083b:	83 c4 10             	add    $0x10,%esp
+  80083e:	eb 9f                	jmp    8007df <vprintfmt+0x3d6>
+      putch('%', putdat);
+  800840:	83 ec 08             	sub    $0x8,%esp
+  800843:	53                   	push   %ebx
+  800844:	6a 25                	push   $0x25
+  800846:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  800848:	83 c4 10             	add    $0x10,%esp
+  80084b:	89 f8                	mov    %edi,%eax
+  80084d:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800851:	74 05                	je     800858 <vprintfmt+0x44f>
+  800853:	83 e8 01             	sub    $0x1,%eax
+  800856:	eb f5                	jmp    80084d <vprintfmt+0x444>
+  800858:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80085b:	eb 82                	jmp    8007df <vprintfmt+0x3d6>
+
+0080085d <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  80085d:	55                   	push   %ebp
+  80085e:	89 e5                	mov    %esp,%ebp
+  800860:	83 ec 18             	sub    $0x18,%esp
+  800863:	8b 45 08             	mov    0x8(%ebp),%eax
+  800866:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  800869:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  80086c:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800870:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800873:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  80087a:	85 c0                	test   %eax,%eax
+  80087c:	74 26                	je     8008a4 <vsnprintf+0x47>
+  80087e:	85 d2                	test   %edx,%edx
+  800880:	7e 22                	jle    8008a4 <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800882:	ff 75 14             	push   0x14(%ebp)
+  800885:	ff 75 10             	push   0x10(%ebp)
+  800888:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80088b:	50                   	push   %eax
+  80088c:	68 cf 03 80 00       	push   $0x8003cf
+  800891:	e8 73 fb ff ff       	call   800409 <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800896:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800899:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  80089c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80089f:	83 c4 10             	add    $0x10,%esp
+}
+  8008a2:	c9                   	leave
+  8008a3:	c3                   	ret
+    return -E_INVAL;
+  8008a4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8008a9:	eb f7                	jmp    8008a2 <vsnprintf+0x45>
+
+008008ab <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8008ab:	55                   	push   %ebp
+  8008ac:	89 e5                	mov    %esp,%ebp
+  8008ae:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  8008b1:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  8008b4:	50                   	push   %eax
+  8008b5:	ff 75 10             	push   0x10(%ebp)
+  8008b8:	ff 75 0c             	push   0xc(%ebp)
+  8008bb:	ff 75 08             	push   0x8(%ebp)
+  8008be:	e8 9a ff ff ff       	call   80085d <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  8008c3:	c9                   	leave
+  8008c4:	c3                   	ret
+
+008008c5 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8008c5:	55                   	push   %ebp
+  8008c6:	89 e5                	mov    %esp,%ebp
+  8008c8:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  8008cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d0:	eb 03                	jmp    8008d5 <strlen+0x10>
+    n++;
+  8008d2:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  8008d5:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8008d9:	75 f7                	jne    8008d2 <strlen+0xd>
+  return n;
+}
+  8008db:	5d                   	pop    %ebp
+  8008dc:	c3                   	ret
+
+008008dd <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8008dd:	55                   	push   %ebp
+  8008de:	89 e5                	mov    %esp,%ebp
+  8008e0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008e3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8008e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008eb:	eb 03                	jmp    8008f0 <strnlen+0x13>
+    n++;
+  8008ed:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8008f0:	39 d0                	cmp    %edx,%eax
+  8008f2:	74 08                	je     8008fc <strnlen+0x1f>
+  8008f4:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  8008f8:	75 f3                	jne    8008ed <strnlen+0x10>
+  8008fa:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  8008fc:	89 d0                	mov    %edx,%eax
+  8008fe:	5d                   	pop    %ebp
+  8008ff:	c3                   	ret
+
+00800900 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800900:	55                   	push   %ebp
+  800901:	89 e5                	mov    %esp,%ebp
+  800903:	53                   	push   %ebx
+  800904:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800907:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  80090a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80090f:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800913:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800916:	83 c0 01             	add    $0x1,%eax
+  800919:	84 d2                	test   %dl,%dl
+  80091b:	75 f2                	jne    80090f <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  80091d:	89 c8                	mov    %ecx,%eax
+  80091f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800922:	c9                   	leave
+  800923:	c3                   	ret
+
+00800924 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800924:	55                   	push   %ebp
+  800925:	89 e5                	mov    %esp,%ebp
+  800927:	53                   	push   %ebx
+  800928:	83 ec 10             	sub    $0x10,%esp
+  80092b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  80092e:	53                   	push   %ebx
+  80092f:	e8 91 ff ff ff       	call   8008c5 <strlen>
+  800934:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  800937:	ff 75 0c             	push   0xc(%ebp)
+  80093a:	01 d8                	add    %ebx,%eax
+  80093c:	50                   	push   %eax
+  80093d:	e8 be ff ff ff       	call   800900 <strcpy>
+  return dst;
+}
+  800942:	89 d8                	mov    %ebx,%eax
+  800944:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800947:	c9                   	leave
+  800948:	c3                   	ret
+
+00800949 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  800949:	55                   	push   %ebp
+  80094a:	89 e5                	mov    %esp,%ebp
+  80094c:	56                   	push   %esi
+  80094d:	53                   	push   %ebx
+  80094e:	8b 75 08             	mov    0x8(%ebp),%esi
+  800951:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  800954:	89 f3                	mov    %esi,%ebx
+  800956:	03 5d 10             	add    0x10(%ebp),%ebx
+  800959:	89 f0                	mov    %esi,%eax
+  80095b:	eb 0f                	jmp    80096c <strncpy+0x23>
+    *dst++ = *src;
+  80095d:	83 c0 01             	add    $0x1,%eax
+  800960:	0f b6 0a             	movzbl (%edx),%ecx
+  800963:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  800966:	80 f9 01             	cmp    $0x1,%cl
+  800969:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  80096c:	39 d8                	cmp    %ebx,%eax
+  80096e:	75 ed                	jne    80095d <strncpy+0x14>
+  }
+  return ret;
+}
+  800970:	89 f0                	mov    %esi,%eax
+  800972:	5b                   	pop    %ebx
+  800973:	5e                   	pop    %esi
+  800974:	5d                   	pop    %ebp
+  800975:	c3                   	ret
+
+00800976 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800976:	55                   	push   %ebp
+  800977:	89 e5                	mov    %esp,%ebp
+  800979:	56                   	push   %esi
+  80097a:	53                   	push   %ebx
+  80097b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80097e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800981:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  800984:	89 f0                	mov    %esi,%eax
+  800986:	85 d2                	test   %edx,%edx
+  800988:	74 21                	je     8009ab <strlcpy+0x35>
+  80098a:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  80098e:	89 f2                	mov    %esi,%edx
+  800990:	eb 09                	jmp    80099b <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  800992:	83 c1 01             	add    $0x1,%ecx
+  800995:	83 c2 01             	add    $0x1,%edx
+  800998:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  80099b:	39 c2                	cmp    %eax,%edx
+  80099d:	74 09                	je     8009a8 <strlcpy+0x32>
+  80099f:	0f b6 19             	movzbl (%ecx),%ebx
+  8009a2:	84 db                	test   %bl,%bl
+  8009a4:	75 ec                	jne    800992 <strlcpy+0x1c>
+  8009a6:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  8009a8:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  8009ab:	29 f0                	sub    %esi,%eax
+}
+  8009ad:	5b                   	pop    %ebx
+  8009ae:	5e                   	pop    %esi
+  8009af:	5d                   	pop    %ebp
+  8009b0:	c3                   	ret
+
+008009b1 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  8009b1:	55                   	push   %ebp
+  8009b2:	89 e5                	mov    %esp,%ebp
+  8009b4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8009b7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  8009ba:	eb 06                	jmp    8009c2 <strcmp+0x11>
+    p++, q++;
+  8009bc:	83 c1 01             	add    $0x1,%ecx
+  8009bf:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  8009c2:	0f b6 01             	movzbl (%ecx),%eax
+  8009c5:	84 c0                	test   %al,%al
+  8009c7:	74 04                	je     8009cd <strcmp+0x1c>
+  8009c9:	3a 02                	cmp    (%edx),%al
+  8009cb:	74 ef                	je     8009bc <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  8009cd:	0f b6 c0             	movzbl %al,%eax
+  8009d0:	0f b6 12             	movzbl (%edx),%edx
+  8009d3:	29 d0                	sub    %edx,%eax
+}
+  8009d5:	5d                   	pop    %ebp
+  8009d6:	c3                   	ret
+
+008009d7 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  8009d7:	55                   	push   %ebp
+  8009d8:	89 e5                	mov    %esp,%ebp
+  8009da:	53                   	push   %ebx
+  8009db:	8b 45 08             	mov    0x8(%ebp),%eax
+  8009de:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8009e1:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  8009e4:	eb 09                	jmp    8009ef <strncmp+0x18>
+    n--, p++, q++;
+  8009e6:	83 ea 01             	sub    $0x1,%edx
+  8009e9:	83 c0 01             	add    $0x1,%eax
+  8009ec:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  8009ef:	85 d2                	test   %edx,%edx
+  8009f1:	74 18                	je     800a0b <strncmp+0x34>
+  8009f3:	0f b6 18             	movzbl (%eax),%ebx
+  8009f6:	84 db                	test   %bl,%bl
+  8009f8:	74 04                	je     8009fe <strncmp+0x27>
+  8009fa:	3a 19                	cmp    (%ecx),%bl
+  8009fc:	74 e8                	je     8009e6 <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8009fe:	0f b6 00             	movzbl (%eax),%eax
+  800a01:	0f b6 11             	movzbl (%ecx),%edx
+  800a04:	29 d0                	sub    %edx,%eax
+}
+  800a06:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a09:	c9                   	leave
+  800a0a:	c3                   	ret
+    return 0;
+  800a0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a10:	eb f4                	jmp    800a06 <strncmp+0x2f>
+
+00800a12 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800a12:	55                   	push   %ebp
+  800a13:	89 e5                	mov    %esp,%ebp
+  800a15:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a18:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800a1c:	eb 03                	jmp    800a21 <strchr+0xf>
+  800a1e:	83 c0 01             	add    $0x1,%eax
+  800a21:	0f b6 10             	movzbl (%eax),%edx
+  800a24:	84 d2                	test   %dl,%dl
+  800a26:	74 06                	je     800a2e <strchr+0x1c>
+    if (*s == c)
+  800a28:	38 ca                	cmp    %cl,%dl
+  800a2a:	75 f2                	jne    800a1e <strchr+0xc>
+  800a2c:	eb 05                	jmp    800a33 <strchr+0x21>
+      return (char*)s;
+  return 0;
+  800a2e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800a33:	5d                   	pop    %ebp
+  800a34:	c3                   	ret
+
+00800a35 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800a35:	55                   	push   %ebp
+  800a36:	89 e5                	mov    %esp,%ebp
+  800a38:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a3b:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800a3f:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  800a42:	38 ca                	cmp    %cl,%dl
+  800a44:	74 09                	je     800a4f <strfind+0x1a>
+  800a46:	84 d2                	test   %dl,%dl
+  800a48:	74 05                	je     800a4f <strfind+0x1a>
+  for (; *s; s++)
+  800a4a:	83 c0 01             	add    $0x1,%eax
+  800a4d:	eb f0                	jmp    800a3f <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  800a4f:	5d                   	pop    %ebp
+  800a50:	c3                   	ret
+
+00800a51 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800a51:	55                   	push   %ebp
+  800a52:	89 e5                	mov    %esp,%ebp
+  800a54:	57                   	push   %edi
+  800a55:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800a58:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  800a5b:	85 c9                	test   %ecx,%ecx
+  800a5d:	74 20                	je     800a7f <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  800a5f:	89 f8                	mov    %edi,%eax
+  800a61:	09 c8                	or     %ecx,%eax
+  800a63:	a8 03                	test   $0x3,%al
+  800a65:	75 12                	jne    800a79 <memset+0x28>
+    c &= 0xFF;
+  800a67:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800a6b:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  800a71:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  800a74:	fc                   	cld
+  800a75:	f3 ab                	rep stos %eax,%es:(%edi)
+  800a77:	eb 06                	jmp    800a7f <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  800a79:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800a7c:	fc                   	cld
+  800a7d:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  800a7f:	89 f8                	mov    %edi,%eax
+  800a81:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800a84:	c9                   	leave
+  800a85:	c3                   	ret
+
+00800a86 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800a86:	55                   	push   %ebp
+  800a87:	89 e5                	mov    %esp,%ebp
+  800a89:	57                   	push   %edi
+  800a8a:	56                   	push   %esi
+  800a8b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800a8e:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800a91:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  800a94:	39 c6                	cmp    %eax,%esi
+  800a96:	73 32                	jae    800aca <memmove+0x44>
+  800a98:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800a9b:	39 d0                	cmp    %edx,%eax
+  800a9d:	73 2b                	jae    800aca <memmove+0x44>
+    s += n;
+    d += n;
+  800a9f:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800aa2:	89 d6                	mov    %edx,%esi
+  800aa4:	09 fe                	or     %edi,%esi
+  800aa6:	09 ce                	or     %ecx,%esi
+  800aa8:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800aae:	75 0e                	jne    800abe <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800ab0:	83 ef 04             	sub    $0x4,%edi
+  800ab3:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800ab6:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  800ab9:	fd                   	std
+  800aba:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800abc:	eb 09                	jmp    800ac7 <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800abe:	83 ef 01             	sub    $0x1,%edi
+  800ac1:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  800ac4:	fd                   	std
+  800ac5:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  800ac7:	fc                   	cld
+  800ac8:	eb 1a                	jmp    800ae4 <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800aca:	89 f2                	mov    %esi,%edx
+  800acc:	09 c2                	or     %eax,%edx
+  800ace:	09 ca                	or     %ecx,%edx
+  800ad0:	f6 c2 03             	test   $0x3,%dl
+  800ad3:	75 0a                	jne    800adf <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800ad5:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  800ad8:	89 c7                	mov    %eax,%edi
+  800ada:	fc                   	cld
+  800adb:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800add:	eb 05                	jmp    800ae4 <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  800adf:	89 c7                	mov    %eax,%edi
+  800ae1:	fc                   	cld
+  800ae2:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  800ae4:	5e                   	pop    %esi
+  800ae5:	5f                   	pop    %edi
+  800ae6:	5d                   	pop    %ebp
+  800ae7:	c3                   	ret
+
+00800ae8 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800ae8:	55                   	push   %ebp
+  800ae9:	89 e5                	mov    %esp,%ebp
+  800aeb:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  800aee:	ff 75 10             	push   0x10(%ebp)
+  800af1:	ff 75 0c             	push   0xc(%ebp)
+  800af4:	ff 75 08             	push   0x8(%ebp)
+  800af7:	e8 8a ff ff ff       	call   800a86 <memmove>
+}
+  800afc:	c9                   	leave
+  800afd:	c3                   	ret
+
+00800afe <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800afe:	55                   	push   %ebp
+  800aff:	89 e5                	mov    %esp,%ebp
+  800b01:	56                   	push   %esi
+  800b02:	53                   	push   %ebx
+  800b03:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b06:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  800b09:	89 c6                	mov    %eax,%esi
+  800b0b:	03 75 10             	add    0x10(%ebp),%esi
+  800b0e:	eb 06                	jmp    800b16 <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  800b10:	83 c0 01             	add    $0x1,%eax
+  800b13:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  800b16:	39 f0                	cmp    %esi,%eax
+  800b18:	74 14                	je     800b2e <memcmp+0x30>
+    if (*s1 != *s2)
+  800b1a:	0f b6 08             	movzbl (%eax),%ecx
+  800b1d:	0f b6 1a             	movzbl (%edx),%ebx
+  800b20:	38 d9                	cmp    %bl,%cl
+  800b22:	74 ec                	je     800b10 <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  800b24:	0f b6 c1             	movzbl %cl,%eax
+  800b27:	0f b6 db             	movzbl %bl,%ebx
+  800b2a:	29 d8                	sub    %ebx,%eax
+  800b2c:	eb 05                	jmp    800b33 <memcmp+0x35>
+  }
+
+  return 0;
+  800b2e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b33:	5b                   	pop    %ebx
+  800b34:	5e                   	pop    %esi
+  800b35:	5d                   	pop    %ebp
+  800b36:	c3                   	ret
+
+00800b37 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800b37:	55                   	push   %ebp
+  800b38:	89 e5                	mov    %esp,%ebp
+  800b3a:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b3d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  800b40:	89 c2                	mov    %eax,%edx
+  800b42:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  800b45:	eb 03                	jmp    800b4a <memfind+0x13>
+  800b47:	83 c0 01             	add    $0x1,%eax
+  800b4a:	39 d0                	cmp    %edx,%eax
+  800b4c:	73 04                	jae    800b52 <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  800b4e:	38 08                	cmp    %cl,(%eax)
+  800b50:	75 f5                	jne    800b47 <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  800b52:	5d                   	pop    %ebp
+  800b53:	c3                   	ret
+
+00800b54 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800b54:	55                   	push   %ebp
+  800b55:	89 e5                	mov    %esp,%ebp
+  800b57:	57                   	push   %edi
+  800b58:	56                   	push   %esi
+  800b59:	53                   	push   %ebx
+  800b5a:	8b 55 08             	mov    0x8(%ebp),%edx
+  800b5d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  800b60:	eb 03                	jmp    800b65 <strtol+0x11>
+    s++;
+  800b62:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  800b65:	0f b6 02             	movzbl (%edx),%eax
+  800b68:	3c 20                	cmp    $0x20,%al
+  800b6a:	74 f6                	je     800b62 <strtol+0xe>
+  800b6c:	3c 09                	cmp    $0x9,%al
+  800b6e:	74 f2                	je     800b62 <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  800b70:	3c 2b                	cmp    $0x2b,%al
+  800b72:	74 2a                	je     800b9e <strtol+0x4a>
+  int neg = 0;
+  800b74:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  800b79:	3c 2d                	cmp    $0x2d,%al
+  800b7b:	74 2b                	je     800ba8 <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800b7d:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800b83:	75 0f                	jne    800b94 <strtol+0x40>
+  800b85:	80 3a 30             	cmpb   $0x30,(%edx)
+  800b88:	74 28                	je     800bb2 <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  800b8a:	85 db                	test   %ebx,%ebx
+  800b8c:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800b91:	0f 44 d8             	cmove  %eax,%ebx
+  800b94:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800b99:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800b9c:	eb 46                	jmp    800be4 <strtol+0x90>
+    s++;
+  800b9e:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  800ba1:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ba6:	eb d5                	jmp    800b7d <strtol+0x29>
+    s++, neg = 1;
+  800ba8:	83 c2 01             	add    $0x1,%edx
+  800bab:	bf 01 00 00 00       	mov    $0x1,%edi
+  800bb0:	eb cb                	jmp    800b7d <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800bb2:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800bb6:	74 0e                	je     800bc6 <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  800bb8:	85 db                	test   %ebx,%ebx
+  800bba:	75 d8                	jne    800b94 <strtol+0x40>
+    s++, base = 8;
+  800bbc:	83 c2 01             	add    $0x1,%edx
+  800bbf:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800bc4:	eb ce                	jmp    800b94 <strtol+0x40>
+    s += 2, base = 16;
+  800bc6:	83 c2 02             	add    $0x2,%edx
+  800bc9:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800bce:	eb c4                	jmp    800b94 <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  800bd0:	0f be c0             	movsbl %al,%eax
+  800bd3:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  800bd6:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800bd9:	7d 3a                	jge    800c15 <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  800bdb:	83 c2 01             	add    $0x1,%edx
+  800bde:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800be2:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  800be4:	0f b6 02             	movzbl (%edx),%eax
+  800be7:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800bea:	89 f3                	mov    %esi,%ebx
+  800bec:	80 fb 09             	cmp    $0x9,%bl
+  800bef:	76 df                	jbe    800bd0 <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  800bf1:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800bf4:	89 f3                	mov    %esi,%ebx
+  800bf6:	80 fb 19             	cmp    $0x19,%bl
+  800bf9:	77 08                	ja     800c03 <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  800bfb:	0f be c0             	movsbl %al,%eax
+  800bfe:	83 e8 57             	sub    $0x57,%eax
+  800c01:	eb d3                	jmp    800bd6 <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  800c03:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800c06:	89 f3                	mov    %esi,%ebx
+  800c08:	80 fb 19             	cmp    $0x19,%bl
+  800c0b:	77 08                	ja     800c15 <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  800c0d:	0f be c0             	movsbl %al,%eax
+  800c10:	83 e8 37             	sub    $0x37,%eax
+  800c13:	eb c1                	jmp    800bd6 <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  800c15:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800c19:	74 05                	je     800c20 <strtol+0xcc>
+    *endptr = (char*)s;
+  800c1b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800c1e:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  800c20:	89 c8                	mov    %ecx,%eax
+  800c22:	f7 d8                	neg    %eax
+  800c24:	85 ff                	test   %edi,%edi
+  800c26:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800c29:	89 c8                	mov    %ecx,%eax
+  800c2b:	5b                   	pop    %ebx
+  800c2c:	5e                   	pop    %esi
+  800c2d:	5f                   	pop    %edi
+  800c2e:	5d                   	pop    %ebp
+  800c2f:	c3                   	ret
+
+00800c30 <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800c30:	55                   	push   %ebp
+  800c31:	89 e5                	mov    %esp,%ebp
+  800c33:	57                   	push   %edi
+  800c34:	56                   	push   %esi
+  800c35:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800c36:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c3b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c3e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800c41:	89 c3                	mov    %eax,%ebx
+  800c43:	89 c7                	mov    %eax,%edi
+  800c45:	89 c6                	mov    %eax,%esi
+  800c47:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800c49:	5b                   	pop    %ebx
+  800c4a:	5e                   	pop    %esi
+  800c4b:	5f                   	pop    %edi
+  800c4c:	5d                   	pop    %ebp
+  800c4d:	c3                   	ret
+
+00800c4e <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800c4e:	55                   	push   %ebp
+  800c4f:	89 e5                	mov    %esp,%ebp
+  800c51:	57                   	push   %edi
+  800c52:	56                   	push   %esi
+  800c53:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800c54:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c59:	b8 01 00 00 00       	mov    $0x1,%eax
+  800c5e:	89 d1                	mov    %edx,%ecx
+  800c60:	89 d3                	mov    %edx,%ebx
+  800c62:	89 d7                	mov    %edx,%edi
+  800c64:	89 d6                	mov    %edx,%esi
+  800c66:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800c68:	5b                   	pop    %ebx
+  800c69:	5e                   	pop    %esi
+  800c6a:	5f                   	pop    %edi
+  800c6b:	5d                   	pop    %ebp
+  800c6c:	c3                   	ret
+
+00800c6d <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800c6d:	55                   	push   %ebp
+  800c6e:	89 e5                	mov    %esp,%ebp
+  800c70:	57                   	push   %edi
+  800c71:	56                   	push   %esi
+  800c72:	53                   	push   %ebx
+  800c73:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800c76:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c7b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c7e:	b8 03 00 00 00       	mov    $0x3,%eax
+  800c83:	89 cb                	mov    %ecx,%ebx
+  800c85:	89 cf                	mov    %ecx,%edi
+  800c87:	89 ce                	mov    %ecx,%esi
+  800c89:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800c8b:	85 c0                	test   %eax,%eax
+  800c8d:	7f 08                	jg     800c97 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800c8f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800c92:	5b                   	pop    %ebx
+  800c93:	5e                   	pop    %esi
+  800c94:	5f                   	pop    %edi
+  800c95:	5d                   	pop    %ebp
+  800c96:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800c97:	83 ec 0c             	sub    $0xc,%esp
+  800c9a:	50                   	push   %eax
+  800c9b:	6a 03                	push   $0x3
+  800c9d:	68 43 3f 80 00       	push   $0x803f43
+  800ca2:	6a 23                	push   $0x23
+  800ca4:	68 60 3f 80 00       	push   $0x803f60
+  800ca9:	e8 89 f5 ff ff       	call   800237 <_panic>
+
+00800cae <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800cae:	55                   	push   %ebp
+  800caf:	89 e5                	mov    %esp,%ebp
+  800cb1:	57                   	push   %edi
+  800cb2:	56                   	push   %esi
+  800cb3:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800cb4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cb9:	b8 02 00 00 00       	mov    $0x2,%eax
+  800cbe:	89 d1                	mov    %edx,%ecx
+  800cc0:	89 d3                	mov    %edx,%ebx
+  800cc2:	89 d7                	mov    %edx,%edi
+  800cc4:	89 d6                	mov    %edx,%esi
+  800cc6:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800cc8:	5b                   	pop    %ebx
+  800cc9:	5e                   	pop    %esi
+  800cca:	5f                   	pop    %edi
+  800ccb:	5d                   	pop    %ebp
+  800ccc:	c3                   	ret
+
+00800ccd <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800ccd:	55                   	push   %ebp
+  800cce:	89 e5                	mov    %esp,%ebp
+  800cd0:	57                   	push   %edi
+  800cd1:	56                   	push   %esi
+  800cd2:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800cd3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cd8:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800cdd:	89 d1                	mov    %edx,%ecx
+  800cdf:	89 d3                	mov    %edx,%ebx
+  800ce1:	89 d7                	mov    %edx,%edi
+  800ce3:	89 d6                	mov    %edx,%esi
+  800ce5:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800ce7:	5b                   	pop    %ebx
+  800ce8:	5e                   	pop    %esi
+  800ce9:	5f                   	pop    %edi
+  800cea:	5d                   	pop    %ebp
+  800ceb:	c3                   	ret
+
+00800cec <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  800cec:	55                   	push   %ebp
+  800ced:	89 e5                	mov    %esp,%ebp
+  800cef:	57                   	push   %edi
+  800cf0:	56                   	push   %esi
+  800cf1:	53                   	push   %ebx
+  800cf2:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  800cf5:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  800cf9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800cfe:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d01:	b8 14 00 00 00       	mov    $0x14,%eax
+  800d06:	89 df                	mov    %ebx,%edi
+  800d08:	89 de                	mov    %ebx,%esi
+  800d0a:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d0c:	85 c0                	test   %eax,%eax
+  800d0e:	7f 08                	jg     800d18 <sys_env_set_cow+0x2c>
+}
+  800d10:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d13:	5b                   	pop    %ebx
+  800d14:	5e                   	pop    %esi
+  800d15:	5f                   	pop    %edi
+  800d16:	5d                   	pop    %ebp
+  800d17:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d18:	83 ec 0c             	sub    $0xc,%esp
+  800d1b:	50                   	push   %eax
+  800d1c:	6a 14                	push   $0x14
+  800d1e:	68 43 3f 80 00       	push   $0x803f43
+  800d23:	6a 23                	push   $0x23
+  800d25:	68 60 3f 80 00       	push   $0x803f60
+  800d2a:	e8 08 f5 ff ff       	call   800237 <_panic>
+
+00800d2f <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800d2f:	55                   	push   %ebp
+  800d30:	89 e5                	mov    %esp,%ebp
+  800d32:	57                   	push   %edi
+  800d33:	56                   	push   %esi
+  800d34:	53                   	push   %ebx
+  800d35:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800d38:	be 00 00 00 00       	mov    $0x0,%esi
+  800d3d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d40:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d43:	b8 04 00 00 00       	mov    $0x4,%eax
+  800d48:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d4b:	89 f7                	mov    %esi,%edi
+  800d4d:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d4f:	85 c0                	test   %eax,%eax
+  800d51:	7f 08                	jg     800d5b <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  800d53:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d56:	5b                   	pop    %ebx
+  800d57:	5e                   	pop    %esi
+  800d58:	5f                   	pop    %edi
+  800d59:	5d                   	pop    %ebp
+  800d5a:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d5b:	83 ec 0c             	sub    $0xc,%esp
+  800d5e:	50                   	push   %eax
+  800d5f:	6a 04                	push   $0x4
+  800d61:	68 43 3f 80 00       	push   $0x803f43
+  800d66:	6a 23                	push   $0x23
+  800d68:	68 60 3f 80 00       	push   $0x803f60
+  800d6d:	e8 c5 f4 ff ff       	call   800237 <_panic>
+
+00800d72 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800d72:	55                   	push   %ebp
+  800d73:	89 e5                	mov    %esp,%ebp
+  800d75:	57                   	push   %edi
+  800d76:	56                   	push   %esi
+  800d77:	53                   	push   %ebx
+  800d78:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800d7b:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d7e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d81:	b8 05 00 00 00       	mov    $0x5,%eax
+  800d86:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800d89:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800d8c:	8b 75 18             	mov    0x18(%ebp),%esi
+  800d8f:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d91:	85 c0                	test   %eax,%eax
+  800d93:	7f 08                	jg     800d9d <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  800d95:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d98:	5b                   	pop    %ebx
+  800d99:	5e                   	pop    %esi
+  800d9a:	5f                   	pop    %edi
+  800d9b:	5d                   	pop    %ebp
+  800d9c:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d9d:	83 ec 0c             	sub    $0xc,%esp
+  800da0:	50                   	push   %eax
+  800da1:	6a 05                	push   $0x5
+  800da3:	68 43 3f 80 00       	push   $0x803f43
+  800da8:	6a 23                	push   $0x23
+  800daa:	68 60 3f 80 00       	push   $0x803f60
+  800daf:	e8 83 f4 ff ff       	call   800237 <_panic>
+
+00800db4 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800db4:	55                   	push   %ebp
+  800db5:	89 e5                	mov    %esp,%ebp
+  800db7:	57                   	push   %edi
+  800db8:	56                   	push   %esi
+  800db9:	53                   	push   %ebx
+  800dba:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800dbd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800dc2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dc5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dc8:	b8 06 00 00 00       	mov    $0x6,%eax
+  800dcd:	89 df                	mov    %ebx,%edi
+  800dcf:	89 de                	mov    %ebx,%esi
+  800dd1:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800dd3:	85 c0                	test   %eax,%eax
+  800dd5:	7f 08                	jg     800ddf <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  800dd7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800dda:	5b                   	pop    %ebx
+  800ddb:	5e                   	pop    %esi
+  800ddc:	5f                   	pop    %edi
+  800ddd:	5d                   	pop    %ebp
+  800dde:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ddf:	83 ec 0c             	sub    $0xc,%esp
+  800de2:	50                   	push   %eax
+  800de3:	6a 06                	push   $0x6
+  800de5:	68 43 3f 80 00       	push   $0x803f43
+  800dea:	6a 23                	push   $0x23
+  800dec:	68 60 3f 80 00       	push   $0x803f60
+  800df1:	e8 41 f4 ff ff       	call   800237 <_panic>
+
+00800df6 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  800df6:	55                   	push   %ebp
+  800df7:	89 e5                	mov    %esp,%ebp
+  800df9:	57                   	push   %edi
+  800dfa:	56                   	push   %esi
+  800dfb:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800dfc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e02:	b8 11 00 00 00       	mov    $0x11,%eax
+  800e07:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e0a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e0d:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e10:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  800e12:	5b                   	pop    %ebx
+  800e13:	5e                   	pop    %esi
+  800e14:	5f                   	pop    %edi
+  800e15:	5d                   	pop    %ebp
+  800e16:	c3                   	ret
+
+00800e17 <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  800e17:	55                   	push   %ebp
+  800e18:	89 e5                	mov    %esp,%ebp
+  800e1a:	57                   	push   %edi
+  800e1b:	56                   	push   %esi
+  800e1c:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e1d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e20:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e23:	b8 12 00 00 00       	mov    $0x12,%eax
+  800e28:	be 00 00 00 00       	mov    $0x0,%esi
+  800e2d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e30:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e33:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  800e35:	5b                   	pop    %ebx
+  800e36:	5e                   	pop    %esi
+  800e37:	5f                   	pop    %edi
+  800e38:	5d                   	pop    %ebp
+  800e39:	c3                   	ret
+
+00800e3a <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  800e3a:	55                   	push   %ebp
+  800e3b:	89 e5                	mov    %esp,%ebp
+  800e3d:	57                   	push   %edi
+  800e3e:	56                   	push   %esi
+  800e3f:	53                   	push   %ebx
+  800e40:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e43:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e48:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e4b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e4e:	b8 16 00 00 00       	mov    $0x16,%eax
+  800e53:	89 df                	mov    %ebx,%edi
+  800e55:	89 de                	mov    %ebx,%esi
+  800e57:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e59:	85 c0                	test   %eax,%eax
+  800e5b:	7f 08                	jg     800e65 <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  800e5d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e60:	5b                   	pop    %ebx
+  800e61:	5e                   	pop    %esi
+  800e62:	5f                   	pop    %edi
+  800e63:	5d                   	pop    %ebp
+  800e64:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e65:	83 ec 0c             	sub    $0xc,%esp
+  800e68:	50                   	push   %eax
+  800e69:	6a 16                	push   $0x16
+  800e6b:	68 43 3f 80 00       	push   $0x803f43
+  800e70:	6a 23                	push   $0x23
+  800e72:	68 60 3f 80 00       	push   $0x803f60
+  800e77:	e8 bb f3 ff ff       	call   800237 <_panic>
+
+00800e7c <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  800e7c:	55                   	push   %ebp
+  800e7d:	89 e5                	mov    %esp,%ebp
+  800e7f:	57                   	push   %edi
+  800e80:	56                   	push   %esi
+  800e81:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e82:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e87:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e8a:	b8 17 00 00 00       	mov    $0x17,%eax
+  800e8f:	89 cb                	mov    %ecx,%ebx
+  800e91:	89 cf                	mov    %ecx,%edi
+  800e93:	89 ce                	mov    %ecx,%esi
+  800e95:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  800e97:	5b                   	pop    %ebx
+  800e98:	5e                   	pop    %esi
+  800e99:	5f                   	pop    %edi
+  800e9a:	5d                   	pop    %ebp
+  800e9b:	c3                   	ret
+
+00800e9c <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  800e9c:	55                   	push   %ebp
+  800e9d:	89 e5                	mov    %esp,%ebp
+  800e9f:	57                   	push   %edi
+  800ea0:	56                   	push   %esi
+  800ea1:	53                   	push   %ebx
+  800ea2:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800ea5:	be 00 00 00 00       	mov    $0x0,%esi
+  800eaa:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ead:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800eb0:	b8 18 00 00 00       	mov    $0x18,%eax
+  800eb5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800eb8:	89 f7                	mov    %esi,%edi
+  800eba:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ebc:	85 c0                	test   %eax,%eax
+  800ebe:	7f 08                	jg     800ec8 <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  800ec0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ec3:	5b                   	pop    %ebx
+  800ec4:	5e                   	pop    %esi
+  800ec5:	5f                   	pop    %edi
+  800ec6:	5d                   	pop    %ebp
+  800ec7:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ec8:	83 ec 0c             	sub    $0xc,%esp
+  800ecb:	50                   	push   %eax
+  800ecc:	6a 18                	push   $0x18
+  800ece:	68 43 3f 80 00       	push   $0x803f43
+  800ed3:	6a 23                	push   $0x23
+  800ed5:	68 60 3f 80 00       	push   $0x803f60
+  800eda:	e8 58 f3 ff ff       	call   800237 <_panic>
+
+00800edf <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  800edf:	55                   	push   %ebp
+  800ee0:	89 e5                	mov    %esp,%ebp
+  800ee2:	57                   	push   %edi
+  800ee3:	56                   	push   %esi
+  800ee4:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800ee5:	be 00 00 00 00       	mov    $0x0,%esi
+  800eea:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eed:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ef0:	b8 19 00 00 00       	mov    $0x19,%eax
+  800ef5:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ef8:	89 f7                	mov    %esi,%edi
+  800efa:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  800efc:	5b                   	pop    %ebx
+  800efd:	5e                   	pop    %esi
+  800efe:	5f                   	pop    %edi
+  800eff:	5d                   	pop    %ebp
+  800f00:	c3                   	ret
+
+00800f01 <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  800f01:	55                   	push   %ebp
+  800f02:	89 e5                	mov    %esp,%ebp
+  800f04:	57                   	push   %edi
+  800f05:	56                   	push   %esi
+  800f06:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f07:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f0c:	b8 15 00 00 00       	mov    $0x15,%eax
+  800f11:	89 d1                	mov    %edx,%ecx
+  800f13:	89 d3                	mov    %edx,%ebx
+  800f15:	89 d7                	mov    %edx,%edi
+  800f17:	89 d6                	mov    %edx,%esi
+  800f19:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  800f1b:	5b                   	pop    %ebx
+  800f1c:	5e                   	pop    %esi
+  800f1d:	5f                   	pop    %edi
+  800f1e:	5d                   	pop    %ebp
+  800f1f:	c3                   	ret
+
+00800f20 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  800f20:	55                   	push   %ebp
+  800f21:	89 e5                	mov    %esp,%ebp
+  800f23:	57                   	push   %edi
+  800f24:	56                   	push   %esi
+  800f25:	53                   	push   %ebx
+  800f26:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f29:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f2e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f31:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f34:	b8 08 00 00 00       	mov    $0x8,%eax
+  800f39:	89 df                	mov    %ebx,%edi
+  800f3b:	89 de                	mov    %ebx,%esi
+  800f3d:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f3f:	85 c0                	test   %eax,%eax
+  800f41:	7f 08                	jg     800f4b <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  800f43:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f46:	5b                   	pop    %ebx
+  800f47:	5e                   	pop    %esi
+  800f48:	5f                   	pop    %edi
+  800f49:	5d                   	pop    %ebp
+  800f4a:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f4b:	83 ec 0c             	sub    $0xc,%esp
+  800f4e:	50                   	push   %eax
+  800f4f:	6a 08                	push   $0x8
+  800f51:	68 43 3f 80 00       	push   $0x803f43
+  800f56:	6a 23                	push   $0x23
+  800f58:	68 60 3f 80 00       	push   $0x803f60
+  800f5d:	e8 d5 f2 ff ff       	call   800237 <_panic>
+
+00800f62 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  800f62:	55                   	push   %ebp
+  800f63:	89 e5                	mov    %esp,%ebp
+  800f65:	57                   	push   %edi
+  800f66:	56                   	push   %esi
+  800f67:	53                   	push   %ebx
+  800f68:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f6b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f70:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f73:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f76:	b8 09 00 00 00       	mov    $0x9,%eax
+  800f7b:	89 df                	mov    %ebx,%edi
+  800f7d:	89 de                	mov    %ebx,%esi
+  800f7f:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f81:	85 c0                	test   %eax,%eax
+  800f83:	7f 08                	jg     800f8d <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  800f85:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f88:	5b                   	pop    %ebx
+  800f89:	5e                   	pop    %esi
+  800f8a:	5f                   	pop    %edi
+  800f8b:	5d                   	pop    %ebp
+  800f8c:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f8d:	83 ec 0c             	sub    $0xc,%esp
+  800f90:	50                   	push   %eax
+  800f91:	6a 09                	push   $0x9
+  800f93:	68 43 3f 80 00       	push   $0x803f43
+  800f98:	6a 23                	push   $0x23
+  800f9a:	68 60 3f 80 00       	push   $0x803f60
+  800f9f:	e8 93 f2 ff ff       	call   800237 <_panic>
+
+00800fa4 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  800fa4:	55                   	push   %ebp
+  800fa5:	89 e5                	mov    %esp,%ebp
+  800fa7:	57                   	push   %edi
+  800fa8:	56                   	push   %esi
+  800fa9:	53                   	push   %ebx
+  800faa:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800fad:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fb2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fb5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fb8:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800fbd:	89 df                	mov    %ebx,%edi
+  800fbf:	89 de                	mov    %ebx,%esi
+  800fc1:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800fc3:	85 c0                	test   %eax,%eax
+  800fc5:	7f 08                	jg     800fcf <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  800fc7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fca:	5b                   	pop    %ebx
+  800fcb:	5e                   	pop    %esi
+  800fcc:	5f                   	pop    %edi
+  800fcd:	5d                   	pop    %ebp
+  800fce:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800fcf:	83 ec 0c             	sub    $0xc,%esp
+  800fd2:	50                   	push   %eax
+  800fd3:	6a 0a                	push   $0xa
+  800fd5:	68 43 3f 80 00       	push   $0x803f43
+  800fda:	6a 23                	push   $0x23
+  800fdc:	68 60 3f 80 00       	push   $0x803f60
+  800fe1:	e8 51 f2 ff ff       	call   800237 <_panic>
+
+00800fe6 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  800fe6:	55                   	push   %ebp
+  800fe7:	89 e5                	mov    %esp,%ebp
+  800fe9:	57                   	push   %edi
+  800fea:	56                   	push   %esi
+  800feb:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800fec:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fef:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ff2:	b8 0c 00 00 00       	mov    $0xc,%eax
+  800ff7:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ffa:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800ffd:	8b 75 18             	mov    0x18(%ebp),%esi
+  801000:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  801002:	5b                   	pop    %ebx
+  801003:	5e                   	pop    %esi
+  801004:	5f                   	pop    %edi
+  801005:	5d                   	pop    %ebp
+  801006:	c3                   	ret
+
+00801007 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  801007:	55                   	push   %ebp
+  801008:	89 e5                	mov    %esp,%ebp
+  80100a:	57                   	push   %edi
+  80100b:	56                   	push   %esi
+  80100c:	53                   	push   %ebx
+  80100d:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801010:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801015:	8b 55 08             	mov    0x8(%ebp),%edx
+  801018:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80101b:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801020:	89 df                	mov    %ebx,%edi
+  801022:	89 de                	mov    %ebx,%esi
+  801024:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801026:	85 c0                	test   %eax,%eax
+  801028:	7f 08                	jg     801032 <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  80102a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80102d:	5b                   	pop    %ebx
+  80102e:	5e                   	pop    %esi
+  80102f:	5f                   	pop    %edi
+  801030:	5d                   	pop    %ebp
+  801031:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801032:	83 ec 0c             	sub    $0xc,%esp
+  801035:	50                   	push   %eax
+  801036:	6a 0d                	push   $0xd
+  801038:	68 43 3f 80 00       	push   $0x803f43
+  80103d:	6a 23                	push   $0x23
+  80103f:	68 60 3f 80 00       	push   $0x803f60
+  801044:	e8 ee f1 ff ff       	call   800237 <_panic>
+
+00801049 <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  801049:	55                   	push   %ebp
+  80104a:	89 e5                	mov    %esp,%ebp
+  80104c:	57                   	push   %edi
+  80104d:	56                   	push   %esi
+  80104e:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80104f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801054:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801059:	89 d1                	mov    %edx,%ecx
+  80105b:	89 d3                	mov    %edx,%ebx
+  80105d:	89 d7                	mov    %edx,%edi
+  80105f:	89 d6                	mov    %edx,%esi
+  801061:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801063:	5b                   	pop    %ebx
+  801064:	5e                   	pop    %esi
+  801065:	5f                   	pop    %edi
+  801066:	5d                   	pop    %ebp
+  801067:	c3                   	ret
+
+00801068 <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  801068:	55                   	push   %ebp
+  801069:	89 e5                	mov    %esp,%ebp
+  80106b:	57                   	push   %edi
+  80106c:	56                   	push   %esi
+  80106d:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80106e:	8b 55 08             	mov    0x8(%ebp),%edx
+  801071:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801074:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801079:	be 00 00 00 00       	mov    $0x0,%esi
+  80107e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801081:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801084:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  801086:	5b                   	pop    %ebx
+  801087:	5e                   	pop    %esi
+  801088:	5f                   	pop    %edi
+  801089:	5d                   	pop    %ebp
+  80108a:	c3                   	ret
+
+0080108b <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  80108b:	55                   	push   %ebp
+  80108c:	89 e5                	mov    %esp,%ebp
+  80108e:	57                   	push   %edi
+  80108f:	56                   	push   %esi
+  801090:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801091:	be 00 00 00 00       	mov    $0x0,%esi
+  801096:	8b 55 08             	mov    0x8(%ebp),%edx
+  801099:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80109c:	b8 10 00 00 00       	mov    $0x10,%eax
+  8010a1:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8010a4:	89 f7                	mov    %esi,%edi
+  8010a6:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  8010a8:	5b                   	pop    %ebx
+  8010a9:	5e                   	pop    %esi
+  8010aa:	5f                   	pop    %edi
+  8010ab:	5d                   	pop    %ebp
+  8010ac:	c3                   	ret
+
+008010ad <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  8010ad:	55                   	push   %ebp
+  8010ae:	89 e5                	mov    %esp,%ebp
+  8010b0:	57                   	push   %edi
+  8010b1:	56                   	push   %esi
+  8010b2:	53                   	push   %ebx
+  8010b3:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  8010b6:	80 3d a4 6c 80 00 00 	cmpb   $0x0,0x806ca4
+  8010bd:	74 41                	je     801100 <sys_batch+0x53>
+  8010bf:	8b 45 08             	mov    0x8(%ebp),%eax
+  8010c2:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  8010c5:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  8010cc:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8010cf:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  8010d2:	7d 45                	jge    801119 <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  8010d4:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8010d7:	8b 06                	mov    (%esi),%eax
+  8010d9:	8b 56 04             	mov    0x4(%esi),%edx
+  8010dc:	8b 4e 08             	mov    0x8(%esi),%ecx
+  8010df:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  8010e2:	8b 7e 10             	mov    0x10(%esi),%edi
+  8010e5:	8b 76 14             	mov    0x14(%esi),%esi
+  8010e8:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  8010ea:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8010ed:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  8010f0:	83 c6 1c             	add    $0x1c,%esi
+  8010f3:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  8010f6:	85 c0                	test   %eax,%eax
+  8010f8:	78 1f                	js     801119 <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  8010fa:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  8010fe:	eb cc                	jmp    8010cc <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  801100:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801105:	b8 13 00 00 00       	mov    $0x13,%eax
+  80110a:	8b 55 08             	mov    0x8(%ebp),%edx
+  80110d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801110:	89 df                	mov    %ebx,%edi
+  801112:	89 de                	mov    %ebx,%esi
+  801114:	cd 30                	int    $0x30
+  801116:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  801119:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80111c:	83 c4 08             	add    $0x8,%esp
+  80111f:	5b                   	pop    %ebx
+  801120:	5e                   	pop    %esi
+  801121:	5f                   	pop    %edi
+  801122:	5d                   	pop    %ebp
+  801123:	c3                   	ret
+
+00801124 <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  801124:	55                   	push   %ebp
+  801125:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  801127:	8b 45 08             	mov    0x8(%ebp),%eax
+  80112a:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  801130:	5d                   	pop    %ebp
+  801131:	c3                   	ret
+
+00801132 <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  801132:	55                   	push   %ebp
+  801133:	89 e5                	mov    %esp,%ebp
+  801135:	56                   	push   %esi
+  801136:	53                   	push   %ebx
+  801137:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  80113a:	8b 1e                	mov    (%esi),%ebx
+  80113c:	85 db                	test   %ebx,%ebx
+  80113e:	75 09                	jne    801149 <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  801140:	89 d8                	mov    %ebx,%eax
+  801142:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801145:	5b                   	pop    %ebx
+  801146:	5e                   	pop    %esi
+  801147:	5d                   	pop    %ebp
+  801148:	c3                   	ret
+  b->sb_n = 0;
+  801149:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  80114f:	53                   	push   %ebx
+  801150:	8d 46 04             	lea    0x4(%esi),%eax
+  801153:	50                   	push   %eax
+  801154:	e8 54 ff ff ff       	call   8010ad <sys_batch>
+  801159:	83 c4 08             	add    $0x8,%esp
+  80115c:	85 c0                	test   %eax,%eax
+  80115e:	78 1e                	js     80117e <sysbatch_flush+0x4c>
+  if (r < n)
+  801160:	39 c3                	cmp    %eax,%ebx
+  801162:	7f 07                	jg     80116b <sysbatch_flush+0x39>
+  return 0;
+  801164:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801169:	eb d5                	jmp    801140 <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  80116b:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80116e:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  801172:	85 db                	test   %ebx,%ebx
+  801174:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801179:	0f 49 d8             	cmovns %eax,%ebx
+  80117c:	eb c2                	jmp    801140 <sysbatch_flush+0xe>
+    return r;
+  80117e:	89 c3                	mov    %eax,%ebx
+  801180:	eb be                	jmp    801140 <sysbatch_flush+0xe>
+
+00801182 <sysbatch_add>:
+{
+  801182:	55                   	push   %ebp
+  801183:	89 e5                	mov    %esp,%ebp
+  801185:	53                   	push   %ebx
+  801186:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  801189:	83 3b 40             	cmpl   $0x40,(%ebx)
+  80118c:	74 41                	je     8011cf <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  80118e:	8b 03                	mov    (%ebx),%eax
+  801190:	8d 50 01             	lea    0x1(%eax),%edx
+  801193:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  801195:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801198:	01 d8                	add    %ebx,%eax
+  80119a:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80119d:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  8011a0:	8b 55 10             	mov    0x10(%ebp),%edx
+  8011a3:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  8011a6:	8b 55 14             	mov    0x14(%ebp),%edx
+  8011a9:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  8011ac:	8b 55 18             	mov    0x18(%ebp),%edx
+  8011af:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  8011b2:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  8011b5:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  8011b8:	8b 55 20             	mov    0x20(%ebp),%edx
+  8011bb:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  8011be:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  8011c5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011ca:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8011cd:	c9                   	leave
+  8011ce:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  8011cf:	53                   	push   %ebx
+  8011d0:	e8 5d ff ff ff       	call   801132 <sysbatch_flush>
+  8011d5:	83 c4 04             	add    $0x4,%esp
+  8011d8:	85 c0                	test   %eax,%eax
+  8011da:	79 b2                	jns    80118e <sysbatch_add+0xc>
+  8011dc:	eb ec                	jmp    8011ca <sysbatch_add+0x48>
+
+008011de <pgfault>:
+// Custom page fault handler - if faulting page is copy-on-write,
+// map in our own private writable copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  8011de:	55                   	push   %ebp
+  8011df:	89 e5                	mov    %esp,%ebp
+  8011e1:	56                   	push   %esi
+  8011e2:	53                   	push   %ebx
+  8011e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  void *addr = (void*)utf->utf_fault_va;
+  8011e6:	8b 18                	mov    (%eax),%ebx
+  uint32_t err = utf->utf_err;
+  8011e8:	8b 70 04             	mov    0x4(%eax),%esi
+  // Hint:
+  //   Use the read-only page table mappings at uvpt
+  //   (see <inc/memlayout.h>).
+
+  // Faults in file mappings are mmap's to handle.
+  if (mmap_fault(utf))
+  8011eb:	83 ec 0c             	sub    $0xc,%esp
+  8011ee:	50                   	push   %eax
+  8011ef:	e8 05 1e 00 00       	call   802ff9 <mmap_fault>
+  8011f4:	83 c4 10             	add    $0x10,%esp
+  8011f7:	84 c0                	test   %al,%al
+  8011f9:	75 7d                	jne    801278 <pgfault+0x9a>
+    return;
+
+  // LAB 4: Your code here.
+  if ( !(err & FEC_WR) ) {
+  8011fb:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  801201:	74 7c                	je     80127f <pgfault+0xa1>
+    panic("user_pgfault: %e", err);
+  }
+
+  if ( !(uvpt[PGNUM(addr)] & PTE_COW) ) {
+  801203:	89 d8                	mov    %ebx,%eax
+  801205:	c1 e8 0c             	shr    $0xc,%eax
+  801208:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  80120f:	f6 c4 08             	test   $0x8,%ah
+  801212:	74 7d                	je     801291 <pgfault+0xb3>
+  // page to the old page's address.
+  // Hint:
+  //   You should make three system calls.
+
+  // LAB 4: Your code here.
+  addr = ROUNDDOWN(addr, PGSIZE);
+  801214:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+
+  // map page to temporary location
+  if ( (r = sys_page_alloc(0, PFTEMP, (PTE_P | PTE_U | PTE_W))) < 0) {
+  80121a:	83 ec 04             	sub    $0x4,%esp
+  80121d:	6a 07                	push   $0x7
+  80121f:	68 00 f0 7f 00       	push   $0x7ff000
+  801224:	6a 00                	push   $0x0
+  801226:	e8 04 fb ff ff       	call   800d2f <sys_page_alloc>
+  80122b:	83 c4 10             	add    $0x10,%esp
+  80122e:	85 c0                	test   %eax,%eax
+  801230:	78 73                	js     8012a5 <pgfault+0xc7>
+    panic("sys_page_alloc: %e", r);
+  }
+
+  // copy data from old page to new page
+  memmove(PFTEMP, addr, PGSIZE);
+  801232:	83 ec 04             	sub    $0x4,%esp
+  801235:	68 00 10 00 00       	push   $0x1000
+  80123a:	53                   	push   %ebx
+  80123b:	68 00 f0 7f 00       	push   $0x7ff000
+  801240:	e8 41 f8 ff ff       	call   800a86 <memmove>
+
+  // move new page to old page address
+  if ( (r = sys_page_map(0, PFTEMP, 0, addr, (PTE_P | PTE_U | PTE_W))) < 0) {
+  801245:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  80124c:	53                   	push   %ebx
+  80124d:	6a 00                	push   $0x0
+  80124f:	68 00 f0 7f 00       	push   $0x7ff000
+  801254:	6a 00                	push   $0x0
+  801256:	e8 17 fb ff ff       	call   800d72 <sys_page_map>
+  80125b:	83 c4 20             	add    $0x20,%esp
+  80125e:	85 c0                	test   %eax,%eax
+  801260:	78 55                	js     8012b7 <pgfault+0xd9>
+    panic("sys_page_map: %e", r);
+  }
+
+  if ( (r = sys_page_unmap(0, PFTEMP)) < 0) {
+  801262:	83 ec 08             	sub    $0x8,%esp
+  801265:	68 00 f0 7f 00       	push   $0x7ff000
+  80126a:	6a 00                	push   $0x0
+  80126c:	e8 43 fb ff ff       	call   800db4 <sys_page_unmap>
+  801271:	83 c4 10             	add    $0x10,%esp
+  801274:	85 c0                	test   %eax,%eax
+  801276:	78 51                	js     8012c9 <pgfault+0xeb>
+    panic("sys_page_unmap: %e", r);
+  }
+}
+  801278:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80127b:	5b                   	pop    %ebx
+  80127c:	5e                   	pop    %esi
+  80127d:	5d                   	pop    %ebp
+  80127e:	c3                   	ret
+    panic("user_pgfault: %e", err);
+  80127f:	56                   	push   %esi
+  801280:	68 6e 3f 80 00       	push   $0x803f6e
+  801285:	6a 1d                	push   $0x1d
+  801287:	68 7f 3f 80 00       	push   $0x803f7f
+  80128c:	e8 a6 ef ff ff       	call   800237 <_panic>
+    panic("user_pgfault: page not COW");
+  801291:	83 ec 04             	sub    $0x4,%esp
+  801294:	68 8a 3f 80 00       	push   $0x803f8a
+  801299:	6a 21                	push   $0x21
+  80129b:	68 7f 3f 80 00       	push   $0x803f7f
+  8012a0:	e8 92 ef ff ff       	call   800237 <_panic>
+    panic("sys_page_alloc: %e", r);
+  8012a5:	50                   	push   %eax
+  8012a6:	68 a5 3f 80 00       	push   $0x803fa5
+  8012ab:	6a 2f                	push   $0x2f
+  8012ad:	68 7f 3f 80 00       	push   $0x803f7f
+  8012b2:	e8 80 ef ff ff       	call   800237 <_panic>
+    panic("sys_page_map: %e", r);
+  8012b7:	50                   	push   %eax
+  8012b8:	68 b8 3f 80 00       	push   $0x803fb8
+  8012bd:	6a 37                	push   $0x37
+  8012bf:	68 7f 3f 80 00       	push   $0x803f7f
+  8012c4:	e8 6e ef ff ff       	call   800237 <_panic>
+    panic("sys_page_unmap: %e", r);
+  8012c9:	50                   	push   %eax
+  8012ca:	68 c9 3f 80 00       	push   $0x803fc9
+  8012cf:	6a 3b                	push   $0x3b
+  8012d1:	68 7f 3f 80 00       	push   $0x803f7f
+  8012d6:	e8 5c ef ff ff       	call   800237 <_panic>
+
+008012db <shared_pgfault>:
+
+// Challenge!
+//
+static void
+shared_pgfault(struct UTrapframe *utf)
+{
+  8012db:	55                   	push   %ebp
+  8012dc:	89 e5                	mov    %esp,%ebp
+  8012de:	53                   	push   %ebx
+  8012df:	83 ec 10             	sub    $0x10,%esp
+  8012e2:	8b 45 08             	mov    0x8(%ebp),%eax
+  // just has fewer error checks
+  
+  void *addr = (void*)utf->utf_fault_va;
+  8012e5:	8b 18                	mov    (%eax),%ebx
+  uint32_t err = utf->utf_err;
+  int r;
+
+  if (mmap_fault(utf))
+  8012e7:	50                   	push   %eax
+  8012e8:	e8 0c 1d 00 00       	call   802ff9 <mmap_fault>
+  8012ed:	83 c4 10             	add    $0x10,%esp
+  8012f0:	84 c0                	test   %al,%al
+  8012f2:	74 05                	je     8012f9 <shared_pgfault+0x1e>
+  }
+
+  if ( (r = sys_page_unmap(0, PFTEMP)) < 0) {
+    panic("sys_page_unmap: %e", r);
+  }
+}
+  8012f4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012f7:	c9                   	leave
+  8012f8:	c3                   	ret
+  addr = ROUNDDOWN(addr, PGSIZE);
+  8012f9:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if ( (r = sys_page_alloc(0, PFTEMP, (PTE_P | PTE_U | PTE_W))) < 0) {
+  8012ff:	83 ec 04             	sub    $0x4,%esp
+  801302:	6a 07                	push   $0x7
+  801304:	68 00 f0 7f 00       	push   $0x7ff000
+  801309:	6a 00                	push   $0x0
+  80130b:	e8 1f fa ff ff       	call   800d2f <sys_page_alloc>
+  801310:	83 c4 10             	add    $0x10,%esp
+  801313:	85 c0                	test   %eax,%eax
+  801315:	78 5b                	js     801372 <shared_pgfault+0x97>
+  memmove(PFTEMP, addr, PGSIZE);
+  801317:	83 ec 04             	sub    $0x4,%esp
+  80131a:	68 00 10 00 00       	push   $0x1000
+  80131f:	53                   	push   %ebx
+  801320:	68 00 f0 7f 00       	push   $0x7ff000
+  801325:	e8 5c f7 ff ff       	call   800a86 <memmove>
+  if ( (r = sys_page_map(0, PFTEMP, 0, addr, (PTE_P | PTE_U | PTE_W))) < 0) {
+  80132a:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801331:	53                   	push   %ebx
+  801332:	6a 00                	push   $0x0
+  801334:	68 00 f0 7f 00       	push   $0x7ff000
+  801339:	6a 00                	push   $0x0
+  80133b:	e8 32 fa ff ff       	call   800d72 <sys_page_map>
+  801340:	83 c4 20             	add    $0x20,%esp
+  801343:	85 c0                	test   %eax,%eax
+  801345:	78 40                	js     801387 <shared_pgfault+0xac>
+  if ( (r = sys_page_unmap(0, PFTEMP)) < 0) {
+  801347:	83 ec 08             	sub    $0x8,%esp
+  80134a:	68 00 f0 7f 00       	push   $0x7ff000
+  80134f:	6a 00                	push   $0x0
+  801351:	e8 5e fa ff ff       	call   800db4 <sys_page_unmap>
+  801356:	83 c4 10             	add    $0x10,%esp
+  801359:	85 c0                	test   %eax,%eax
+  80135b:	79 97                	jns    8012f4 <shared_pgfault+0x19>
+    panic("sys_page_unmap: %e", r);
+  80135d:	50                   	push   %eax
+  80135e:	68 c9 3f 80 00       	push   $0x803fc9
+  801363:	68 b0 00 00 00       	push   $0xb0
+  801368:	68 7f 3f 80 00       	push   $0x803f7f
+  80136d:	e8 c5 ee ff ff       	call   800237 <_panic>
+    panic("sys_page_alloc: %e", r);
+  801372:	50                   	push   %eax
+  801373:	68 a5 3f 80 00       	push   $0x803fa5
+  801378:	68 a4 00 00 00       	push   $0xa4
+  80137d:	68 7f 3f 80 00       	push   $0x803f7f
+  801382:	e8 b0 ee ff ff       	call   800237 <_panic>
+    panic("sys_page_map: %e", r);
+  801387:	50                   	push   %eax
+  801388:	68 b8 3f 80 00       	push   $0x803fb8
+  80138d:	68 ac 00 00 00       	push   $0xac
+  801392:	68 7f 3f 80 00       	push   $0x803f7f
+  801397:	e8 9b ee ff ff       	call   800237 <_panic>
+
+0080139c <fork>:
+{
+  80139c:	55                   	push   %ebp
+  80139d:	89 e5                	mov    %esp,%ebp
+  80139f:	53                   	push   %ebx
+  8013a0:	83 ec 04             	sub    $0x4,%esp
+  parent_id = sys_getenvid();
+  8013a3:	e8 06 f9 ff ff       	call   800cae <sys_getenvid>
+  set_pgfault_handler(pgfault);
+  8013a8:	83 ec 0c             	sub    $0xc,%esp
+  8013ab:	68 de 11 80 00       	push   $0x8011de
+  8013b0:	e8 d3 22 00 00       	call   803688 <set_pgfault_handler>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+  envid_t ret;
+  __asm __volatile("int %2"
+  8013b5:	b8 07 00 00 00       	mov    $0x7,%eax
+  8013ba:	cd 30                	int    $0x30
+  8013bc:	89 c3                	mov    %eax,%ebx
+  if (envid < 0) {
+  8013be:	83 c4 10             	add    $0x10,%esp
+  8013c1:	85 c0                	test   %eax,%eax
+  8013c3:	78 66                	js     80142b <fork+0x8f>
+  } else if (envid == 0) {
+  8013c5:	74 76                	je     80143d <fork+0xa1>
+  if ( (error = sys_page_map_range(0, 0, UXSTACKTOP - PGSIZE,
+  8013c7:	83 ec 0c             	sub    $0xc,%esp
+  8013ca:	6a 01                	push   $0x1
+  8013cc:	50                   	push   %eax
+  8013cd:	68 00 f0 bf ee       	push   $0xeebff000
+  8013d2:	6a 00                	push   $0x0
+  8013d4:	6a 00                	push   $0x0
+  8013d6:	e8 1b fa ff ff       	call   800df6 <sys_page_map_range>
+  8013db:	83 c4 20             	add    $0x20,%esp
+  8013de:	85 c0                	test   %eax,%eax
+  8013e0:	78 77                	js     801459 <fork+0xbd>
+  if ( (error = sys_page_alloc(envid,
+  8013e2:	83 ec 04             	sub    $0x4,%esp
+  8013e5:	6a 07                	push   $0x7
+  8013e7:	68 00 f0 bf ee       	push   $0xeebff000
+  8013ec:	53                   	push   %ebx
+  8013ed:	e8 3d f9 ff ff       	call   800d2f <sys_page_alloc>
+  8013f2:	83 c4 10             	add    $0x10,%esp
+  8013f5:	85 c0                	test   %eax,%eax
+  8013f7:	78 72                	js     80146b <fork+0xcf>
+          thisenv->env_pgfault_upcall)) < 0) {
+  8013f9:	a1 a0 6c 80 00       	mov    0x806ca0,%eax
+  8013fe:	8b 40 64             	mov    0x64(%eax),%eax
+  if ( (error = sys_env_set_pgfault_upcall(envid,
+  801401:	83 ec 08             	sub    $0x8,%esp
+  801404:	50                   	push   %eax
+  801405:	53                   	push   %ebx
+  801406:	e8 99 fb ff ff       	call   800fa4 <sys_env_set_pgfault_upcall>
+  80140b:	83 c4 10             	add    $0x10,%esp
+  80140e:	85 c0                	test   %eax,%eax
+  801410:	78 6b                	js     80147d <fork+0xe1>
+  if ( (error = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+  801412:	83 ec 08             	sub    $0x8,%esp
+  801415:	6a 02                	push   $0x2
+  801417:	53                   	push   %ebx
+  801418:	e8 03 fb ff ff       	call   800f20 <sys_env_set_status>
+  80141d:	83 c4 10             	add    $0x10,%esp
+  801420:	85 c0                	test   %eax,%eax
+  801422:	78 6b                	js     80148f <fork+0xf3>
+}
+  801424:	89 d8                	mov    %ebx,%eax
+  801426:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801429:	c9                   	leave
+  80142a:	c3                   	ret
+    panic("sys_exofork: %e", envid);
+  80142b:	50                   	push   %eax
+  80142c:	68 dc 3f 80 00       	push   $0x803fdc
+  801431:	6a 5e                	push   $0x5e
+  801433:	68 7f 3f 80 00       	push   $0x803f7f
+  801438:	e8 fa ed ff ff       	call   800237 <_panic>
+    thisenv = &envs[ENVX(sys_getenvid())];
+  80143d:	e8 6c f8 ff ff       	call   800cae <sys_getenvid>
+  801442:	25 ff 03 00 00       	and    $0x3ff,%eax
+  801447:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80144a:	c1 e0 04             	shl    $0x4,%eax
+  80144d:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  801452:	a3 a0 6c 80 00       	mov    %eax,0x806ca0
+    return 0;
+  801457:	eb cb                	jmp    801424 <fork+0x88>
+    panic("sys_page_map_range: %e", error);
+  801459:	50                   	push   %eax
+  80145a:	68 ec 3f 80 00       	push   $0x803fec
+  80145f:	6a 69                	push   $0x69
+  801461:	68 7f 3f 80 00       	push   $0x803f7f
+  801466:	e8 cc ed ff ff       	call   800237 <_panic>
+    panic("sys_page_alloc: %e", error);
+  80146b:	50                   	push   %eax
+  80146c:	68 a5 3f 80 00       	push   $0x803fa5
+  801471:	6a 70                	push   $0x70
+  801473:	68 7f 3f 80 00       	push   $0x803f7f
+  801478:	e8 ba ed ff ff       	call   800237 <_panic>
+    panic("sys_env_set_pgfault_upcall: %e", error);
+  80147d:	50                   	push   %eax
+  80147e:	68 1c 40 80 00       	push   $0x80401c
+  801483:	6a 76                	push   $0x76
+  801485:	68 7f 3f 80 00       	push   $0x803f7f
+  80148a:	e8 a8 ed ff ff       	call   800237 <_panic>
+    panic("sys_env_set_status: %e", error);
+  80148f:	50                   	push   %eax
+  801490:	68 03 40 80 00       	push   $0x804003
+  801495:	6a 7a                	push   $0x7a
+  801497:	68 7f 3f 80 00       	push   $0x803f7f
+  80149c:	e8 96 ed ff ff       	call   800237 <_panic>
+
+008014a1 <kfork>:
+{
+  8014a1:	55                   	push   %ebp
+  8014a2:	89 e5                	mov    %esp,%ebp
+  8014a4:	53                   	push   %ebx
+  8014a5:	83 ec 10             	sub    $0x10,%esp
+  set_pgfault_handler(pgfault);
+  8014a8:	68 de 11 80 00       	push   $0x8011de
+  8014ad:	e8 d6 21 00 00       	call   803688 <set_pgfault_handler>
+  if ((envid = sys_fork()) == 0)
+  8014b2:	e8 4a fa ff ff       	call   800f01 <sys_fork>
+  8014b7:	89 c3                	mov    %eax,%ebx
+  8014b9:	83 c4 10             	add    $0x10,%esp
+  8014bc:	85 c0                	test   %eax,%eax
+  8014be:	74 07                	je     8014c7 <kfork+0x26>
+}
+  8014c0:	89 d8                	mov    %ebx,%eax
+  8014c2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8014c5:	c9                   	leave
+  8014c6:	c3                   	ret
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8014c7:	e8 e2 f7 ff ff       	call   800cae <sys_getenvid>
+  8014cc:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8014d1:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8014d4:	c1 e0 04             	shl    $0x4,%eax
+  8014d7:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8014dc:	a3 a0 6c 80 00       	mov    %eax,0x806ca0
+  return envid;
+  8014e1:	eb dd                	jmp    8014c0 <kfork+0x1f>
+
+008014e3 <sfork>:
+
+int
+sfork(void)
+{
+  8014e3:	55                   	push   %ebp
+  8014e4:	89 e5                	mov    %esp,%ebp
+  8014e6:	53                   	push   %ebx
+  8014e7:	83 ec 04             	sub    $0x4,%esp
+  envid_t envid, parent_id;
+  int error;
+
+  parent_id = sys_getenvid();
+  8014ea:	e8 bf f7 ff ff       	call   800cae <sys_getenvid>
+
+  // set up page fault handler
+  set_pgfault_handler(shared_pgfault);
+  8014ef:	83 ec 0c             	sub    $0xc,%esp
+  8014f2:	68 db 12 80 00       	push   $0x8012db
+  8014f7:	e8 8c 21 00 00       	call   803688 <set_pgfault_handler>
+  8014fc:	b8 07 00 00 00       	mov    $0x7,%eax
+  801501:	cd 30                	int    $0x30
+  801503:	89 c3                	mov    %eax,%ebx
+
+  // create a child with sys_exofork
+  envid = sys_exofork();
+  
+  if (envid < 0) {
+  801505:	83 c4 10             	add    $0x10,%esp
+  801508:	85 c0                	test   %eax,%eax
+  80150a:	78 09                	js     801515 <sfork+0x32>
+    panic("sys_exofork: %e", envid);
+  } else if (envid == 0) {
+  80150c:	75 1c                	jne    80152a <sfork+0x47>
+  if ( (error = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+    panic("sys_env_set_status: %e", error);
+  }
+
+  return envid;
+}
+  80150e:	89 d8                	mov    %ebx,%eax
+  801510:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801513:	c9                   	leave
+  801514:	c3                   	ret
+    panic("sys_exofork: %e", envid);
+  801515:	50                   	push   %eax
+  801516:	68 dc 3f 80 00       	push   $0x803fdc
+  80151b:	68 c3 00 00 00       	push   $0xc3
+  801520:	68 7f 3f 80 00       	push   $0x803f7f
+  801525:	e8 0d ed ff ff       	call   800237 <_panic>
+  if ( (error = sys_page_map_range(0, 0, USTACKTOP - PGSIZE,
+  80152a:	83 ec 0c             	sub    $0xc,%esp
+  80152d:	6a 00                	push   $0x0
+  80152f:	50                   	push   %eax
+  801530:	68 00 d0 bf ee       	push   $0xeebfd000
+  801535:	6a 00                	push   $0x0
+  801537:	6a 00                	push   $0x0
+  801539:	e8 b8 f8 ff ff       	call   800df6 <sys_page_map_range>
+  80153e:	83 c4 20             	add    $0x20,%esp
+  801541:	85 c0                	test   %eax,%eax
+  801543:	78 79                	js     8015be <sfork+0xdb>
+  if ( (error = sys_page_map_range(0, (void *) (USTACKTOP - PGSIZE), PGSIZE,
+  801545:	83 ec 0c             	sub    $0xc,%esp
+  801548:	6a 01                	push   $0x1
+  80154a:	53                   	push   %ebx
+  80154b:	68 00 10 00 00       	push   $0x1000
+  801550:	68 00 d0 bf ee       	push   $0xeebfd000
+  801555:	6a 00                	push   $0x0
+  801557:	e8 9a f8 ff ff       	call   800df6 <sys_page_map_range>
+  80155c:	83 c4 20             	add    $0x20,%esp
+  80155f:	85 c0                	test   %eax,%eax
+  801561:	78 70                	js     8015d3 <sfork+0xf0>
+  if ( (error = sys_page_alloc(envid,
+  801563:	83 ec 04             	sub    $0x4,%esp
+  801566:	6a 07                	push   $0x7
+  801568:	68 00 f0 bf ee       	push   $0xeebff000
+  80156d:	53                   	push   %ebx
+  80156e:	e8 bc f7 ff ff       	call   800d2f <sys_page_alloc>
+  801573:	83 c4 10             	add    $0x10,%esp
+  801576:	85 c0                	test   %eax,%eax
+  801578:	78 6e                	js     8015e8 <sfork+0x105>
+          thisenv->env_pgfault_upcall)) < 0) {
+  80157a:	a1 a0 6c 80 00       	mov    0x806ca0,%eax
+  80157f:	8b 40 64             	mov    0x64(%eax),%eax
+  if ( (error = sys_env_set_pgfault_upcall(envid,
+  801582:	83 ec 08             	sub    $0x8,%esp
+  801585:	50                   	push   %eax
+  801586:	53                   	push   %ebx
+  801587:	e8 18 fa ff ff       	call   800fa4 <sys_env_set_pgfault_upcall>
+  80158c:	83 c4 10             	add    $0x10,%esp
+  80158f:	85 c0                	test   %eax,%eax
+  801591:	78 6a                	js     8015fd <sfork+0x11a>
+  if ( (error = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+  801593:	83 ec 08             	sub    $0x8,%esp
+  801596:	6a 02                	push   $0x2
+  801598:	53                   	push   %ebx
+  801599:	e8 82 f9 ff ff       	call   800f20 <sys_env_set_status>
+  80159e:	83 c4 10             	add    $0x10,%esp
+  8015a1:	85 c0                	test   %eax,%eax
+  8015a3:	0f 89 65 ff ff ff    	jns    80150e <sfork+0x2b>
+    panic("sys_env_set_status: %e", error);
+  8015a9:	50                   	push   %eax
+  8015aa:	68 03 40 80 00       	push   $0x804003
+  8015af:	68 e4 00 00 00       	push   $0xe4
+  8015b4:	68 7f 3f 80 00       	push   $0x803f7f
+  8015b9:	e8 79 ec ff ff       	call   800237 <_panic>
+    panic("sys_page_map_range: %e", error);
+  8015be:	50                   	push   %eax
+  8015bf:	68 ec 3f 80 00       	push   $0x803fec
+  8015c4:	68 ce 00 00 00       	push   $0xce
+  8015c9:	68 7f 3f 80 00       	push   $0x803f7f
+  8015ce:	e8 64 ec ff ff       	call   800237 <_panic>
+    panic("sys_page_map_range: %e", error);
+  8015d3:	50                   	push   %eax
+  8015d4:	68 ec 3f 80 00       	push   $0x803fec
+  8015d9:	68 d3 00 00 00       	push   $0xd3
+  8015de:	68 7f 3f 80 00       	push   $0x803f7f
+  8015e3:	e8 4f ec ff ff       	call   800237 <_panic>
+    panic("sys_page_alloc: %e", error);
+  8015e8:	50                   	push   %eax
+  8015e9:	68 a5 3f 80 00       	push   $0x803fa5
+  8015ee:	68 da 00 00 00       	push   $0xda
+  8015f3:	68 7f 3f 80 00       	push   $0x803f7f
+  8015f8:	e8 3a ec ff ff       	call   800237 <_panic>
+    panic("sys_env_set_pgfault_upcall: %e", error);
+  8015fd:	50                   	push   %eax
+  8015fe:	68 1c 40 80 00       	push   $0x80401c
+  801603:	68 e0 00 00 00       	push   $0xe0
+  801608:	68 7f 3f 80 00       	push   $0x803f7f
+  80160d:	e8 25 ec ff ff       	call   800237 <_panic>
+
+00801612 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  801612:	55                   	push   %ebp
+  801613:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801615:	8b 45 08             	mov    0x8(%ebp),%eax
+  801618:	05 00 00 00 30       	add    $0x30000000,%eax
+  80161d:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801620:	5d                   	pop    %ebp
+  801621:	c3                   	ret
+
+00801622 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801622:	55                   	push   %ebp
+  801623:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801625:	8b 45 08             	mov    0x8(%ebp),%eax
+  801628:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  80162b:	66 b8 00 00          	mov    $0x0,%ax
+  80162f:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801634:	5d                   	pop    %ebp
+  801635:	c3                   	ret
+
+00801636 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801636:	55                   	push   %ebp
+  801637:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  801639:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80163e:	eb 02                	jmp    801642 <fd_alloc+0xc>
+  801640:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801642:	89 c2                	mov    %eax,%edx
+  801644:	c1 ea 16             	shr    $0x16,%edx
+  801647:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80164e:	f6 c2 01             	test   $0x1,%dl
+  801651:	74 2b                	je     80167e <fd_alloc+0x48>
+  801653:	89 c2                	mov    %eax,%edx
+  801655:	c1 ea 0c             	shr    $0xc,%edx
+  801658:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  80165f:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801665:	f6 c1 01             	test   $0x1,%cl
+  801668:	74 14                	je     80167e <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  80166a:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801670:	75 ce                	jne    801640 <fd_alloc+0xa>
+  801672:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  801677:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  80167c:	eb 05                	jmp    801683 <fd_alloc+0x4d>
+      return 0;
+  80167e:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  801683:	8b 55 08             	mov    0x8(%ebp),%edx
+  801686:	89 02                	mov    %eax,(%edx)
+}
+  801688:	89 c8                	mov    %ecx,%eax
+  80168a:	5d                   	pop    %ebp
+  80168b:	c3                   	ret
+
+0080168c <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  80168c:	55                   	push   %ebp
+  80168d:	89 e5                	mov    %esp,%ebp
+  80168f:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  801692:	83 f8 1f             	cmp    $0x1f,%eax
+  801695:	77 30                	ja     8016c7 <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  801697:	c1 e0 0c             	shl    $0xc,%eax
+  80169a:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  80169f:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8016a5:	f6 c2 01             	test   $0x1,%dl
+  8016a8:	74 24                	je     8016ce <fd_lookup+0x42>
+  8016aa:	89 c2                	mov    %eax,%edx
+  8016ac:	c1 ea 0c             	shr    $0xc,%edx
+  8016af:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8016b6:	f6 c2 01             	test   $0x1,%dl
+  8016b9:	74 1a                	je     8016d5 <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  8016bb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8016be:	89 02                	mov    %eax,(%edx)
+  return 0;
+  8016c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8016c5:	5d                   	pop    %ebp
+  8016c6:	c3                   	ret
+    return -E_INVAL;
+  8016c7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016cc:	eb f7                	jmp    8016c5 <fd_lookup+0x39>
+    return -E_INVAL;
+  8016ce:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016d3:	eb f0                	jmp    8016c5 <fd_lookup+0x39>
+  8016d5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8016da:	eb e9                	jmp    8016c5 <fd_lookup+0x39>
+
+008016dc <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8016dc:	55                   	push   %ebp
+  8016dd:	89 e5                	mov    %esp,%ebp
+  8016df:	53                   	push   %ebx
+  8016e0:	83 ec 04             	sub    $0x4,%esp
+  8016e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  8016e6:	b8 b8 40 80 00       	mov    $0x8040b8,%eax
+  8016eb:	8b 18                	mov    (%eax),%ebx
+  8016ed:	85 db                	test   %ebx,%ebx
+  8016ef:	74 0e                	je     8016ff <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  8016f1:	83 c0 04             	add    $0x4,%eax
+  8016f4:	39 13                	cmp    %edx,(%ebx)
+  8016f6:	75 f3                	jne    8016eb <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  8016f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016fd:	eb 1f                	jmp    80171e <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8016ff:	a1 a0 6c 80 00       	mov    0x806ca0,%eax
+  801704:	8b 40 48             	mov    0x48(%eax),%eax
+  801707:	83 ec 04             	sub    $0x4,%esp
+  80170a:	52                   	push   %edx
+  80170b:	50                   	push   %eax
+  80170c:	68 3c 40 80 00       	push   $0x80403c
+  801711:	e8 fc eb ff ff       	call   800312 <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  801716:	83 c4 10             	add    $0x10,%esp
+  801719:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  80171e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801721:	89 1a                	mov    %ebx,(%edx)
+}
+  801723:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801726:	c9                   	leave
+  801727:	c3                   	ret
+
+00801728 <fd_close>:
+{
+  801728:	55                   	push   %ebp
+  801729:	89 e5                	mov    %esp,%ebp
+  80172b:	57                   	push   %edi
+  80172c:	56                   	push   %esi
+  80172d:	53                   	push   %ebx
+  80172e:	83 ec 24             	sub    $0x24,%esp
+  801731:	8b 75 08             	mov    0x8(%ebp),%esi
+  801734:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801737:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80173a:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80173b:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801741:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801744:	50                   	push   %eax
+  801745:	e8 42 ff ff ff       	call   80168c <fd_lookup>
+  80174a:	89 c3                	mov    %eax,%ebx
+  80174c:	83 c4 10             	add    $0x10,%esp
+  80174f:	85 c0                	test   %eax,%eax
+  801751:	78 05                	js     801758 <fd_close+0x30>
+      || fd != fd2)
+  801753:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  801756:	74 16                	je     80176e <fd_close+0x46>
+    return must_exist ? r : 0;
+  801758:	89 f8                	mov    %edi,%eax
+  80175a:	84 c0                	test   %al,%al
+  80175c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801761:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801764:	89 d8                	mov    %ebx,%eax
+  801766:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801769:	5b                   	pop    %ebx
+  80176a:	5e                   	pop    %esi
+  80176b:	5f                   	pop    %edi
+  80176c:	5d                   	pop    %ebp
+  80176d:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80176e:	83 ec 08             	sub    $0x8,%esp
+  801771:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801774:	50                   	push   %eax
+  801775:	ff 36                	push   (%esi)
+  801777:	e8 60 ff ff ff       	call   8016dc <dev_lookup>
+  80177c:	89 c3                	mov    %eax,%ebx
+  80177e:	83 c4 10             	add    $0x10,%esp
+  801781:	85 c0                	test   %eax,%eax
+  801783:	78 1a                	js     80179f <fd_close+0x77>
+    if (dev->dev_close)
+  801785:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801788:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  80178b:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  801790:	85 c0                	test   %eax,%eax
+  801792:	74 0b                	je     80179f <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  801794:	83 ec 0c             	sub    $0xc,%esp
+  801797:	56                   	push   %esi
+  801798:	ff d0                	call   *%eax
+  80179a:	89 c3                	mov    %eax,%ebx
+  80179c:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  80179f:	83 ec 08             	sub    $0x8,%esp
+  8017a2:	56                   	push   %esi
+  8017a3:	6a 00                	push   $0x0
+  8017a5:	e8 0a f6 ff ff       	call   800db4 <sys_page_unmap>
+  return r;
+  8017aa:	83 c4 10             	add    $0x10,%esp
+  8017ad:	eb b5                	jmp    801764 <fd_close+0x3c>
+
+008017af <close>:
+
+int
+close(int fdnum)
+{
+  8017af:	55                   	push   %ebp
+  8017b0:	89 e5                	mov    %esp,%ebp
+  8017b2:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8017b5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017b8:	50                   	push   %eax
+  8017b9:	ff 75 08             	push   0x8(%ebp)
+  8017bc:	e8 cb fe ff ff       	call   80168c <fd_lookup>
+  8017c1:	83 c4 10             	add    $0x10,%esp
+  8017c4:	85 c0                	test   %eax,%eax
+  8017c6:	79 02                	jns    8017ca <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  8017c8:	c9                   	leave
+  8017c9:	c3                   	ret
+    return fd_close(fd, 1);
+  8017ca:	83 ec 08             	sub    $0x8,%esp
+  8017cd:	6a 01                	push   $0x1
+  8017cf:	ff 75 f4             	push   -0xc(%ebp)
+  8017d2:	e8 51 ff ff ff       	call   801728 <fd_close>
+  8017d7:	83 c4 10             	add    $0x10,%esp
+  8017da:	eb ec                	jmp    8017c8 <close+0x19>
+
+008017dc <close_all>:
+
+void
+close_all(void)
+{
+  8017dc:	55                   	push   %ebp
+  8017dd:	89 e5                	mov    %esp,%ebp
+  8017df:	53                   	push   %ebx
+  8017e0:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  8017e3:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  8017e8:	83 ec 0c             	sub    $0xc,%esp
+  8017eb:	53                   	push   %ebx
+  8017ec:	e8 be ff ff ff       	call   8017af <close>
+  for (i = 0; i < MAXFD; i++)
+  8017f1:	83 c3 01             	add    $0x1,%ebx
+  8017f4:	83 c4 10             	add    $0x10,%esp
+  8017f7:	83 fb 20             	cmp    $0x20,%ebx
+  8017fa:	75 ec                	jne    8017e8 <close_all+0xc>
+}
+  8017fc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8017ff:	c9                   	leave
+  801800:	c3                   	ret
+
+00801801 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801801:	55                   	push   %ebp
+  801802:	89 e5                	mov    %esp,%ebp
+  801804:	57                   	push   %edi
+  801805:	56                   	push   %esi
+  801806:	53                   	push   %ebx
+  801807:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  80180a:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80180d:	50                   	push   %eax
+  80180e:	ff 75 08             	push   0x8(%ebp)
+  801811:	e8 76 fe ff ff       	call   80168c <fd_lookup>
+  801816:	89 c6                	mov    %eax,%esi
+  801818:	83 c4 10             	add    $0x10,%esp
+  80181b:	85 c0                	test   %eax,%eax
+  80181d:	0f 88 0a 01 00 00    	js     80192d <dup+0x12c>
+    return r;
+  close(newfdnum);
+  801823:	83 ec 0c             	sub    $0xc,%esp
+  801826:	ff 75 0c             	push   0xc(%ebp)
+  801829:	e8 81 ff ff ff       	call   8017af <close>
+
+  newfd = INDEX2FD(newfdnum);
+  80182e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801831:	c1 e0 0c             	shl    $0xc,%eax
+  801834:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  80183a:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  80183d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801840:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  801843:	89 04 24             	mov    %eax,(%esp)
+  801846:	e8 d7 fd ff ff       	call   801622 <fd2data>
+  80184b:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  80184d:	89 3c 24             	mov    %edi,(%esp)
+  801850:	e8 cd fd ff ff       	call   801622 <fd2data>
+  801855:	83 c4 10             	add    $0x10,%esp
+  801858:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80185b:	89 f3                	mov    %esi,%ebx
+  80185d:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  801863:	89 c6                	mov    %eax,%esi
+  801865:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801868:	89 cf                	mov    %ecx,%edi
+  80186a:	eb 0c                	jmp    801878 <dup+0x77>
+  80186c:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801872:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801878:	39 fb                	cmp    %edi,%ebx
+  80187a:	74 7b                	je     8018f7 <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  80187c:	89 d8                	mov    %ebx,%eax
+  80187e:	c1 e8 16             	shr    $0x16,%eax
+  801881:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801888:	a8 01                	test   $0x1,%al
+  80188a:	74 e0                	je     80186c <dup+0x6b>
+  80188c:	89 d8                	mov    %ebx,%eax
+  80188e:	c1 e8 0c             	shr    $0xc,%eax
+  801891:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801898:	f6 c2 01             	test   $0x1,%dl
+  80189b:	74 cf                	je     80186c <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  80189d:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  8018a4:	83 ec 0c             	sub    $0xc,%esp
+  8018a7:	25 07 0e 00 00       	and    $0xe07,%eax
+  8018ac:	50                   	push   %eax
+  8018ad:	56                   	push   %esi
+  8018ae:	6a 00                	push   $0x0
+  8018b0:	53                   	push   %ebx
+  8018b1:	6a 00                	push   $0x0
+  8018b3:	e8 ba f4 ff ff       	call   800d72 <sys_page_map>
+  8018b8:	83 c4 20             	add    $0x20,%esp
+  8018bb:	85 c0                	test   %eax,%eax
+  8018bd:	79 ad                	jns    80186c <dup+0x6b>
+  8018bf:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8018c2:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  8018c4:	83 ec 08             	sub    $0x8,%esp
+  8018c7:	ff 75 d4             	push   -0x2c(%ebp)
+  8018ca:	6a 00                	push   $0x0
+  8018cc:	e8 e3 f4 ff ff       	call   800db4 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8018d1:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  8018d4:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  8018da:	83 c4 10             	add    $0x10,%esp
+  8018dd:	39 df                	cmp    %ebx,%edi
+  8018df:	74 4c                	je     80192d <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  8018e1:	83 ec 08             	sub    $0x8,%esp
+  8018e4:	57                   	push   %edi
+  8018e5:	6a 00                	push   $0x0
+  8018e7:	e8 c8 f4 ff ff       	call   800db4 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8018ec:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  8018f2:	83 c4 10             	add    $0x10,%esp
+  8018f5:	eb e6                	jmp    8018dd <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8018f7:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8018fa:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8018fd:	89 c8                	mov    %ecx,%eax
+  8018ff:	c1 e8 0c             	shr    $0xc,%eax
+  801902:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801909:	83 ec 0c             	sub    $0xc,%esp
+  80190c:	25 07 0e 00 00       	and    $0xe07,%eax
+  801911:	50                   	push   %eax
+  801912:	ff 75 d4             	push   -0x2c(%ebp)
+  801915:	6a 00                	push   $0x0
+  801917:	51                   	push   %ecx
+  801918:	6a 00                	push   $0x0
+  80191a:	e8 53 f4 ff ff       	call   800d72 <sys_page_map>
+  80191f:	89 c6                	mov    %eax,%esi
+  801921:	83 c4 20             	add    $0x20,%esp
+  801924:	85 c0                	test   %eax,%eax
+  801926:	78 9c                	js     8018c4 <dup+0xc3>
+  return newfdnum;
+  801928:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80192b:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  80192d:	89 f0                	mov    %esi,%eax
+  80192f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801932:	5b                   	pop    %ebx
+  801933:	5e                   	pop    %esi
+  801934:	5f                   	pop    %edi
+  801935:	5d                   	pop    %ebp
+  801936:	c3                   	ret
+
+00801937 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801937:	55                   	push   %ebp
+  801938:	89 e5                	mov    %esp,%ebp
+  80193a:	56                   	push   %esi
+  80193b:	53                   	push   %ebx
+  80193c:	83 ec 18             	sub    $0x18,%esp
+  80193f:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801942:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801945:	50                   	push   %eax
+  801946:	56                   	push   %esi
+  801947:	e8 40 fd ff ff       	call   80168c <fd_lookup>
+  80194c:	83 c4 10             	add    $0x10,%esp
+  80194f:	85 c0                	test   %eax,%eax
+  801951:	78 3c                	js     80198f <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801953:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801956:	83 ec 08             	sub    $0x8,%esp
+  801959:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80195c:	50                   	push   %eax
+  80195d:	ff 33                	push   (%ebx)
+  80195f:	e8 78 fd ff ff       	call   8016dc <dev_lookup>
+  801964:	83 c4 10             	add    $0x10,%esp
+  801967:	85 c0                	test   %eax,%eax
+  801969:	78 24                	js     80198f <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80196b:	8b 43 08             	mov    0x8(%ebx),%eax
+  80196e:	83 e0 03             	and    $0x3,%eax
+  801971:	83 f8 01             	cmp    $0x1,%eax
+  801974:	74 20                	je     801996 <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  801976:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801979:	8b 40 08             	mov    0x8(%eax),%eax
+  80197c:	85 c0                	test   %eax,%eax
+  80197e:	74 37                	je     8019b7 <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  801980:	83 ec 04             	sub    $0x4,%esp
+  801983:	ff 75 10             	push   0x10(%ebp)
+  801986:	ff 75 0c             	push   0xc(%ebp)
+  801989:	53                   	push   %ebx
+  80198a:	ff d0                	call   *%eax
+  80198c:	83 c4 10             	add    $0x10,%esp
+}
+  80198f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801992:	5b                   	pop    %ebx
+  801993:	5e                   	pop    %esi
+  801994:	5d                   	pop    %ebp
+  801995:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801996:	a1 a0 6c 80 00       	mov    0x806ca0,%eax
+  80199b:	8b 40 48             	mov    0x48(%eax),%eax
+  80199e:	83 ec 04             	sub    $0x4,%esp
+  8019a1:	56                   	push   %esi
+  8019a2:	50                   	push   %eax
+  8019a3:	68 7d 40 80 00       	push   $0x80407d
+  8019a8:	e8 65 e9 ff ff       	call   800312 <cprintf>
+    return -E_INVAL;
+  8019ad:	83 c4 10             	add    $0x10,%esp
+  8019b0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019b5:	eb d8                	jmp    80198f <read+0x58>
+    return -E_NOT_SUPP;
+  8019b7:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8019bc:	eb d1                	jmp    80198f <read+0x58>
+
+008019be <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  8019be:	55                   	push   %ebp
+  8019bf:	89 e5                	mov    %esp,%ebp
+  8019c1:	57                   	push   %edi
+  8019c2:	56                   	push   %esi
+  8019c3:	53                   	push   %ebx
+  8019c4:	83 ec 0c             	sub    $0xc,%esp
+  8019c7:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8019ca:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  8019cd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019d2:	eb 02                	jmp    8019d6 <readn+0x18>
+  8019d4:	01 c3                	add    %eax,%ebx
+  8019d6:	39 f3                	cmp    %esi,%ebx
+  8019d8:	73 21                	jae    8019fb <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  8019da:	83 ec 04             	sub    $0x4,%esp
+  8019dd:	89 f0                	mov    %esi,%eax
+  8019df:	29 d8                	sub    %ebx,%eax
+  8019e1:	50                   	push   %eax
+  8019e2:	89 d8                	mov    %ebx,%eax
+  8019e4:	03 45 0c             	add    0xc(%ebp),%eax
+  8019e7:	50                   	push   %eax
+  8019e8:	57                   	push   %edi
+  8019e9:	e8 49 ff ff ff       	call   801937 <read>
+    if (m < 0)
+  8019ee:	83 c4 10             	add    $0x10,%esp
+  8019f1:	85 c0                	test   %eax,%eax
+  8019f3:	78 04                	js     8019f9 <readn+0x3b>
+      return m;
+    if (m == 0)
+  8019f5:	75 dd                	jne    8019d4 <readn+0x16>
+  8019f7:	eb 02                	jmp    8019fb <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  8019f9:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  8019fb:	89 d8                	mov    %ebx,%eax
+  8019fd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a00:	5b                   	pop    %ebx
+  801a01:	5e                   	pop    %esi
+  801a02:	5f                   	pop    %edi
+  801a03:	5d                   	pop    %ebp
+  801a04:	c3                   	ret
+
+00801a05 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801a05:	55                   	push   %ebp
+  801a06:	89 e5                	mov    %esp,%ebp
+  801a08:	56                   	push   %esi
+  801a09:	53                   	push   %ebx
+  801a0a:	83 ec 18             	sub    $0x18,%esp
+  801a0d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a10:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a13:	50                   	push   %eax
+  801a14:	53                   	push   %ebx
+  801a15:	e8 72 fc ff ff       	call   80168c <fd_lookup>
+  801a1a:	83 c4 10             	add    $0x10,%esp
+  801a1d:	85 c0                	test   %eax,%eax
+  801a1f:	78 37                	js     801a58 <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801a21:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801a24:	83 ec 08             	sub    $0x8,%esp
+  801a27:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a2a:	50                   	push   %eax
+  801a2b:	ff 36                	push   (%esi)
+  801a2d:	e8 aa fc ff ff       	call   8016dc <dev_lookup>
+  801a32:	83 c4 10             	add    $0x10,%esp
+  801a35:	85 c0                	test   %eax,%eax
+  801a37:	78 1f                	js     801a58 <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801a39:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801a3d:	74 20                	je     801a5f <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  801a3f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a42:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a45:	85 c0                	test   %eax,%eax
+  801a47:	74 37                	je     801a80 <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  801a49:	83 ec 04             	sub    $0x4,%esp
+  801a4c:	ff 75 10             	push   0x10(%ebp)
+  801a4f:	ff 75 0c             	push   0xc(%ebp)
+  801a52:	56                   	push   %esi
+  801a53:	ff d0                	call   *%eax
+  801a55:	83 c4 10             	add    $0x10,%esp
+}
+  801a58:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a5b:	5b                   	pop    %ebx
+  801a5c:	5e                   	pop    %esi
+  801a5d:	5d                   	pop    %ebp
+  801a5e:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801a5f:	a1 a0 6c 80 00       	mov    0x806ca0,%eax
+  801a64:	8b 40 48             	mov    0x48(%eax),%eax
+  801a67:	83 ec 04             	sub    $0x4,%esp
+  801a6a:	53                   	push   %ebx
+  801a6b:	50                   	push   %eax
+  801a6c:	68 99 40 80 00       	push   $0x804099
+  801a71:	e8 9c e8 ff ff       	call   800312 <cprintf>
+    return -E_INVAL;
+  801a76:	83 c4 10             	add    $0x10,%esp
+  801a79:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a7e:	eb d8                	jmp    801a58 <write+0x53>
+    return -E_NOT_SUPP;
+  801a80:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801a85:	eb d1                	jmp    801a58 <write+0x53>
+
+00801a87 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801a87:	55                   	push   %ebp
+  801a88:	89 e5                	mov    %esp,%ebp
+  801a8a:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801a8d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a90:	50                   	push   %eax
+  801a91:	ff 75 08             	push   0x8(%ebp)
+  801a94:	e8 f3 fb ff ff       	call   80168c <fd_lookup>
+  801a99:	83 c4 10             	add    $0x10,%esp
+  801a9c:	85 c0                	test   %eax,%eax
+  801a9e:	78 0e                	js     801aae <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  801aa0:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801aa3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801aa6:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  801aa9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801aae:	c9                   	leave
+  801aaf:	c3                   	ret
+
+00801ab0 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801ab0:	55                   	push   %ebp
+  801ab1:	89 e5                	mov    %esp,%ebp
+  801ab3:	56                   	push   %esi
+  801ab4:	53                   	push   %ebx
+  801ab5:	83 ec 18             	sub    $0x18,%esp
+  801ab8:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801abb:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801abe:	50                   	push   %eax
+  801abf:	53                   	push   %ebx
+  801ac0:	e8 c7 fb ff ff       	call   80168c <fd_lookup>
+  801ac5:	83 c4 10             	add    $0x10,%esp
+  801ac8:	85 c0                	test   %eax,%eax
+  801aca:	78 34                	js     801b00 <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801acc:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801acf:	83 ec 08             	sub    $0x8,%esp
+  801ad2:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ad5:	50                   	push   %eax
+  801ad6:	ff 36                	push   (%esi)
+  801ad8:	e8 ff fb ff ff       	call   8016dc <dev_lookup>
+  801add:	83 c4 10             	add    $0x10,%esp
+  801ae0:	85 c0                	test   %eax,%eax
+  801ae2:	78 1c                	js     801b00 <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ae4:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801ae8:	74 1d                	je     801b07 <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  801aea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801aed:	8b 40 18             	mov    0x18(%eax),%eax
+  801af0:	85 c0                	test   %eax,%eax
+  801af2:	74 34                	je     801b28 <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  801af4:	83 ec 08             	sub    $0x8,%esp
+  801af7:	ff 75 0c             	push   0xc(%ebp)
+  801afa:	56                   	push   %esi
+  801afb:	ff d0                	call   *%eax
+  801afd:	83 c4 10             	add    $0x10,%esp
+}
+  801b00:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b03:	5b                   	pop    %ebx
+  801b04:	5e                   	pop    %esi
+  801b05:	5d                   	pop    %ebp
+  801b06:	c3                   	ret
+            thisenv->env_id, fdnum);
+  801b07:	a1 a0 6c 80 00       	mov    0x806ca0,%eax
+  801b0c:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801b0f:	83 ec 04             	sub    $0x4,%esp
+  801b12:	53                   	push   %ebx
+  801b13:	50                   	push   %eax
+  801b14:	68 5c 40 80 00       	push   $0x80405c
+  801b19:	e8 f4 e7 ff ff       	call   800312 <cprintf>
+    return -E_INVAL;
+  801b1e:	83 c4 10             	add    $0x10,%esp
+  801b21:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b26:	eb d8                	jmp    801b00 <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  801b28:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b2d:	eb d1                	jmp    801b00 <ftruncate+0x50>
+
+00801b2f <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801b2f:	55                   	push   %ebp
+  801b30:	89 e5                	mov    %esp,%ebp
+  801b32:	56                   	push   %esi
+  801b33:	53                   	push   %ebx
+  801b34:	83 ec 18             	sub    $0x18,%esp
+  801b37:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801b3a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b3d:	50                   	push   %eax
+  801b3e:	ff 75 08             	push   0x8(%ebp)
+  801b41:	e8 46 fb ff ff       	call   80168c <fd_lookup>
+  801b46:	83 c4 10             	add    $0x10,%esp
+  801b49:	85 c0                	test   %eax,%eax
+  801b4b:	78 49                	js     801b96 <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801b4d:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b50:	83 ec 08             	sub    $0x8,%esp
+  801b53:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b56:	50                   	push   %eax
+  801b57:	ff 36                	push   (%esi)
+  801b59:	e8 7e fb ff ff       	call   8016dc <dev_lookup>
+  801b5e:	83 c4 10             	add    $0x10,%esp
+  801b61:	85 c0                	test   %eax,%eax
+  801b63:	78 31                	js     801b96 <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  801b65:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b68:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801b6c:	74 2f                	je     801b9d <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  801b6e:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  801b71:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801b78:	00 00 00 
+  stat->st_isdir = 0;
+  801b7b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801b82:	00 00 00 
+  stat->st_dev = dev;
+  801b85:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  801b8b:	83 ec 08             	sub    $0x8,%esp
+  801b8e:	53                   	push   %ebx
+  801b8f:	56                   	push   %esi
+  801b90:	ff 50 14             	call   *0x14(%eax)
+  801b93:	83 c4 10             	add    $0x10,%esp
+}
+  801b96:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b99:	5b                   	pop    %ebx
+  801b9a:	5e                   	pop    %esi
+  801b9b:	5d                   	pop    %ebp
+  801b9c:	c3                   	ret
+    return -E_NOT_SUPP;
+  801b9d:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ba2:	eb f2                	jmp    801b96 <fstat+0x67>
+
+00801ba4 <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  801ba4:	55                   	push   %ebp
+  801ba5:	89 e5                	mov    %esp,%ebp
+  801ba7:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  801baa:	ff 75 0c             	push   0xc(%ebp)
+  801bad:	ff 75 08             	push   0x8(%ebp)
+  801bb0:	e8 58 07 00 00       	call   80230d <file_stat>
+}
+  801bb5:	c9                   	leave
+  801bb6:	c3                   	ret
+
+00801bb7 <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  801bb7:	55                   	push   %ebp
+  801bb8:	89 e5                	mov    %esp,%ebp
+  801bba:	57                   	push   %edi
+  801bbb:	56                   	push   %esi
+  801bbc:	53                   	push   %ebx
+  801bbd:	83 ec 1c             	sub    $0x1c,%esp
+  801bc0:	89 c7                	mov    %eax,%edi
+  801bc2:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801bc5:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801bc8:	e9 a2 00 00 00       	jmp    801c6f <fsipc_send+0xb8>
+  nfsenvs = 0;
+  801bcd:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  801bd4:	00 00 00 
+  801bd7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bdc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801be1:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801be6:	be 01 00 00 00       	mov    $0x1,%esi
+  801beb:	eb 0f                	jmp    801bfc <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801bed:	83 c0 01             	add    $0x1,%eax
+  801bf0:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801bf5:	74 49                	je     801c40 <fsipc_send+0x89>
+  801bf7:	83 f9 07             	cmp    $0x7,%ecx
+  801bfa:	7f 50                	jg     801c4c <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  801bfc:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801bff:	c1 e2 04             	shl    $0x4,%edx
+  801c02:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801c08:	8b 52 50             	mov    0x50(%edx),%edx
+  801c0b:	83 fa 01             	cmp    $0x1,%edx
+  801c0e:	75 dd                	jne    801bed <fsipc_send+0x36>
+  801c10:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801c13:	c1 e2 04             	shl    $0x4,%edx
+  801c16:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801c1c:	8b 52 54             	mov    0x54(%edx),%edx
+  801c1f:	85 d2                	test   %edx,%edx
+  801c21:	74 ca                	je     801bed <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801c23:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801c26:	c1 e2 04             	shl    $0x4,%edx
+  801c29:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801c2f:	8b 52 48             	mov    0x48(%edx),%edx
+  801c32:	89 14 8d 20 60 80 00 	mov    %edx,0x806020(,%ecx,4)
+  801c39:	8d 49 01             	lea    0x1(%ecx),%ecx
+  801c3c:	89 f3                	mov    %esi,%ebx
+  801c3e:	eb ad                	jmp    801bed <fsipc_send+0x36>
+  801c40:	84 db                	test   %bl,%bl
+  801c42:	74 38                	je     801c7c <fsipc_send+0xc5>
+  801c44:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+  801c4a:	eb 30                	jmp    801c7c <fsipc_send+0xc5>
+  801c4c:	84 db                	test   %bl,%bl
+  801c4e:	74 2c                	je     801c7c <fsipc_send+0xc5>
+  801c50:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+  801c56:	eb 24                	jmp    801c7c <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  801c58:	50                   	push   %eax
+  801c59:	68 c8 40 80 00       	push   $0x8040c8
+  801c5e:	6a 34                	push   $0x34
+  801c60:	68 d2 40 80 00       	push   $0x8040d2
+  801c65:	e8 cd e5 ff ff       	call   800237 <_panic>
+    }
+    sys_yield();
+  801c6a:	e8 5e f0 ff ff       	call   800ccd <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  801c6f:	83 3d 00 60 80 00 03 	cmpl   $0x3,0x806000
+  801c76:	0f 8e 51 ff ff ff    	jle    801bcd <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  801c7c:	a1 a0 6c 80 00       	mov    0x806ca0,%eax
+  801c81:	8b 70 48             	mov    0x48(%eax),%esi
+  801c84:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  801c8a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c8f:	8b 0d 00 60 80 00    	mov    0x806000,%ecx
+  801c95:	39 d9                	cmp    %ebx,%ecx
+  801c97:	7e d1                	jle    801c6a <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  801c99:	83 ec 0c             	sub    $0xc,%esp
+  801c9c:	ff 75 e0             	push   -0x20(%ebp)
+  801c9f:	6a 07                	push   $0x7
+  801ca1:	ff 75 e4             	push   -0x1c(%ebp)
+  801ca4:	57                   	push   %edi
+  801ca5:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  801ca8:	99                   	cltd
+  801ca9:	f7 f9                	idiv   %ecx
+  801cab:	ff 34 95 20 60 80 00 	push   0x806020(,%edx,4)
+  801cb2:	e8 2f f3 ff ff       	call   800fe6 <sys_ipc_try_send>
+      if (r == 0)
+  801cb7:	83 c4 20             	add    $0x20,%esp
+  801cba:	85 c0                	test   %eax,%eax
+  801cbc:	74 0a                	je     801cc8 <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  801cbe:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801cc1:	75 95                	jne    801c58 <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  801cc3:	83 c3 01             	add    $0x1,%ebx
+  801cc6:	eb c7                	jmp    801c8f <fsipc_send+0xd8>
+  }
+}
+  801cc8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801ccb:	5b                   	pop    %ebx
+  801ccc:	5e                   	pop    %esi
+  801ccd:	5f                   	pop    %edi
+  801cce:	5d                   	pop    %ebp
+  801ccf:	c3                   	ret
+
+00801cd0 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801cd0:	55                   	push   %ebp
+  801cd1:	89 e5                	mov    %esp,%ebp
+  801cd3:	53                   	push   %ebx
+  801cd4:	83 ec 14             	sub    $0x14,%esp
+  801cd7:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  801cd9:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  801ce0:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801ce5:	ba 00 70 80 00       	mov    $0x807000,%edx
+  801cea:	e8 c8 fe ff ff       	call   801bb7 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801cef:	6a 00                	push   $0x0
+  801cf1:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cf4:	50                   	push   %eax
+  801cf5:	53                   	push   %ebx
+  801cf6:	6a 00                	push   $0x0
+  801cf8:	e8 f8 19 00 00       	call   8036f5 <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  801cfd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801d00:	c9                   	leave
+  801d01:	c3                   	ret
+
+00801d02 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801d02:	55                   	push   %ebp
+  801d03:	89 e5                	mov    %esp,%ebp
+  801d05:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801d08:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d0b:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d0e:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.set_size.req_size = newsize;
+  801d13:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801d16:	a3 04 70 80 00       	mov    %eax,0x807004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801d1b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d20:	b8 02 00 00 00       	mov    $0x2,%eax
+  801d25:	e8 a6 ff ff ff       	call   801cd0 <fsipc>
+}
+  801d2a:	c9                   	leave
+  801d2b:	c3                   	ret
+
+00801d2c <devfile_flush>:
+{
+  801d2c:	55                   	push   %ebp
+  801d2d:	89 e5                	mov    %esp,%ebp
+  801d2f:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801d32:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d35:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d38:	a3 00 70 80 00       	mov    %eax,0x807000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801d3d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d42:	b8 06 00 00 00       	mov    $0x6,%eax
+  801d47:	e8 84 ff ff ff       	call   801cd0 <fsipc>
+}
+  801d4c:	c9                   	leave
+  801d4d:	c3                   	ret
+
+00801d4e <devfile_stat>:
+{
+  801d4e:	55                   	push   %ebp
+  801d4f:	89 e5                	mov    %esp,%ebp
+  801d51:	53                   	push   %ebx
+  801d52:	83 ec 04             	sub    $0x4,%esp
+  801d55:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801d58:	8b 45 08             	mov    0x8(%ebp),%eax
+  801d5b:	8b 40 0c             	mov    0xc(%eax),%eax
+  801d5e:	a3 00 70 80 00       	mov    %eax,0x807000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801d63:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d68:	b8 05 00 00 00       	mov    $0x5,%eax
+  801d6d:	e8 5e ff ff ff       	call   801cd0 <fsipc>
+  801d72:	85 c0                	test   %eax,%eax
+  801d74:	78 2c                	js     801da2 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801d76:	83 ec 08             	sub    $0x8,%esp
+  801d79:	68 00 70 80 00       	push   $0x807000
+  801d7e:	53                   	push   %ebx
+  801d7f:	e8 7c eb ff ff       	call   800900 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  801d84:	a1 80 70 80 00       	mov    0x807080,%eax
+  801d89:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801d8f:	a1 84 70 80 00       	mov    0x807084,%eax
+  801d94:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801d9a:	83 c4 10             	add    $0x10,%esp
+  801d9d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801da2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801da5:	c9                   	leave
+  801da6:	c3                   	ret
+
+00801da7 <fsv_alloc>:
+{
+  801da7:	55                   	push   %ebp
+  801da8:	89 e5                	mov    %esp,%ebp
+  801daa:	56                   	push   %esi
+  801dab:	53                   	push   %ebx
+  801dac:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  801dae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801db3:	eb 22                	jmp    801dd7 <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  801db5:	83 ec 04             	sub    $0x4,%esp
+  801db8:	6a 00                	push   $0x0
+  801dba:	6a 00                	push   $0x0
+  801dbc:	6a 07                	push   $0x7
+  801dbe:	50                   	push   %eax
+  801dbf:	6a 00                	push   $0x0
+  801dc1:	6a 04                	push   $0x4
+  801dc3:	68 40 60 80 00       	push   $0x806040
+  801dc8:	e8 b5 f3 ff ff       	call   801182 <sysbatch_add>
+  801dcd:	83 c4 20             	add    $0x20,%esp
+  801dd0:	85 c0                	test   %eax,%eax
+  801dd2:	78 48                	js     801e1c <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  801dd4:	83 c3 01             	add    $0x1,%ebx
+  801dd7:	39 f3                	cmp    %esi,%ebx
+  801dd9:	74 31                	je     801e0c <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  801ddb:	89 d8                	mov    %ebx,%eax
+  801ddd:	c1 e0 0c             	shl    $0xc,%eax
+  801de0:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801de5:	89 c2                	mov    %eax,%edx
+  801de7:	c1 ea 16             	shr    $0x16,%edx
+  801dea:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801df1:	f6 c2 01             	test   $0x1,%dl
+  801df4:	74 bf                	je     801db5 <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  801df6:	89 c2                	mov    %eax,%edx
+  801df8:	c1 ea 0c             	shr    $0xc,%edx
+  801dfb:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801e02:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801e05:	83 fa 03             	cmp    $0x3,%edx
+  801e08:	75 ab                	jne    801db5 <fsv_alloc+0xe>
+  801e0a:	eb c8                	jmp    801dd4 <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  801e0c:	83 ec 0c             	sub    $0xc,%esp
+  801e0f:	68 40 60 80 00       	push   $0x806040
+  801e14:	e8 19 f3 ff ff       	call   801132 <sysbatch_flush>
+  801e19:	83 c4 10             	add    $0x10,%esp
+}
+  801e1c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801e1f:	5b                   	pop    %ebx
+  801e20:	5e                   	pop    %esi
+  801e21:	5d                   	pop    %ebp
+  801e22:	c3                   	ret
+
+00801e23 <devfile_read>:
+{
+  801e23:	55                   	push   %ebp
+  801e24:	89 e5                	mov    %esp,%ebp
+  801e26:	57                   	push   %edi
+  801e27:	56                   	push   %esi
+  801e28:	53                   	push   %ebx
+  801e29:	83 ec 3c             	sub    $0x3c,%esp
+  801e2c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  801e2f:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  801e35:	77 57                	ja     801e8e <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801e37:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e3a:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e3d:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.read.req_n = n;
+  801e42:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801e48:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e4d:	b8 03 00 00 00       	mov    $0x3,%eax
+  801e52:	e8 79 fe ff ff       	call   801cd0 <fsipc>
+  801e57:	89 c6                	mov    %eax,%esi
+  801e59:	85 c0                	test   %eax,%eax
+  801e5b:	78 27                	js     801e84 <devfile_read+0x61>
+  assert(r <= n);
+  801e5d:	39 c3                	cmp    %eax,%ebx
+  801e5f:	0f 82 0e 02 00 00    	jb     802073 <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  801e65:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801e6a:	0f 8f 1c 02 00 00    	jg     80208c <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801e70:	83 ec 04             	sub    $0x4,%esp
+  801e73:	50                   	push   %eax
+  801e74:	68 00 70 80 00       	push   $0x807000
+  801e79:	ff 75 0c             	push   0xc(%ebp)
+  801e7c:	e8 05 ec ff ff       	call   800a86 <memmove>
+  return r;
+  801e81:	83 c4 10             	add    $0x10,%esp
+}
+  801e84:	89 f0                	mov    %esi,%eax
+  801e86:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e89:	5b                   	pop    %ebx
+  801e8a:	5e                   	pop    %esi
+  801e8b:	5f                   	pop    %edi
+  801e8c:	5d                   	pop    %ebp
+  801e8d:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  801e8e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e93:	e8 0f ff ff ff       	call   801da7 <fsv_alloc>
+  801e98:	89 c6                	mov    %eax,%esi
+  801e9a:	85 c0                	test   %eax,%eax
+  801e9c:	78 e6                	js     801e84 <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  801e9e:	8b 45 08             	mov    0x8(%ebp),%eax
+  801ea1:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ea4:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  801ea9:	8b 45 08             	mov    0x8(%ebp),%eax
+  801eac:	8b 40 04             	mov    0x4(%eax),%eax
+  801eaf:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  801eb4:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  801eba:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801ec1:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801ec6:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801ecb:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801ed0:	e8 e2 fc ff ff       	call   801bb7 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801ed5:	6a 00                	push   $0x0
+  801ed7:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801eda:	50                   	push   %eax
+  801edb:	68 00 10 c0 9f       	push   $0x9fc01000
+  801ee0:	6a 00                	push   $0x0
+  801ee2:	e8 0e 18 00 00       	call   8036f5 <ipc_recv_pages>
+  801ee7:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  801ee9:	83 c4 10             	add    $0x10,%esp
+  801eec:	85 c0                	test   %eax,%eax
+  801eee:	7e 94                	jle    801e84 <devfile_read+0x61>
+  assert(r <= n);
+  801ef0:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801ef3:	39 c3                	cmp    %eax,%ebx
+  801ef5:	72 2e                	jb     801f25 <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801ef7:	8b 45 08             	mov    0x8(%ebp),%eax
+  801efa:	8b 40 04             	mov    0x4(%eax),%eax
+  801efd:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801f02:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  801f05:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801f08:	c1 e2 0c             	shl    $0xc,%edx
+  801f0b:	39 ca                	cmp    %ecx,%edx
+  801f0d:	72 2f                	jb     801f3e <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  801f0f:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  801f14:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  801f17:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  801f1b:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801f20:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  801f23:	eb 52                	jmp    801f77 <devfile_read+0x154>
+  assert(r <= n);
+  801f25:	68 dd 40 80 00       	push   $0x8040dd
+  801f2a:	68 e4 40 80 00       	push   $0x8040e4
+  801f2f:	68 49 01 00 00       	push   $0x149
+  801f34:	68 d2 40 80 00       	push   $0x8040d2
+  801f39:	e8 f9 e2 ff ff       	call   800237 <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801f3e:	68 08 41 80 00       	push   $0x804108
+  801f43:	68 e4 40 80 00       	push   $0x8040e4
+  801f48:	68 4a 01 00 00       	push   $0x14a
+  801f4d:	68 d2 40 80 00       	push   $0x8040d2
+  801f52:	e8 e0 e2 ff ff       	call   800237 <_panic>
+      memmove(dst + done, src + done, m);
+  801f57:	83 ec 04             	sub    $0x4,%esp
+  801f5a:	53                   	push   %ebx
+  801f5b:	56                   	push   %esi
+  801f5c:	89 f8                	mov    %edi,%eax
+  801f5e:	03 45 0c             	add    0xc(%ebp),%eax
+  801f61:	50                   	push   %eax
+  801f62:	e8 1f eb ff ff       	call   800a86 <memmove>
+  801f67:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  801f6a:	01 df                	add    %ebx,%edi
+  801f6c:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801f6f:	39 c7                	cmp    %eax,%edi
+  801f71:	0f 83 c0 00 00 00    	jae    802037 <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801f77:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801f7a:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  801f7d:	89 f0                	mov    %esi,%eax
+  801f7f:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801f84:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  801f89:	29 c3                	sub    %eax,%ebx
+  801f8b:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801f8e:	29 f8                	sub    %edi,%eax
+  801f90:	39 c3                	cmp    %eax,%ebx
+  801f92:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  801f95:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801f9b:	75 ba                	jne    801f57 <devfile_read+0x134>
+  801f9d:	89 f9                	mov    %edi,%ecx
+  801f9f:	03 4d 0c             	add    0xc(%ebp),%ecx
+  801fa2:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  801fa5:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  801fab:	75 aa                	jne    801f57 <devfile_read+0x134>
+  801fad:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  801fb3:	77 a2                	ja     801f57 <devfile_read+0x134>
+  801fb5:	89 c8                	mov    %ecx,%eax
+  801fb7:	c1 e8 16             	shr    $0x16,%eax
+  801fba:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801fc1:	a8 01                	test   $0x1,%al
+  801fc3:	74 92                	je     801f57 <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  801fc5:	89 c8                	mov    %ecx,%eax
+  801fc7:	c1 e8 0c             	shr    $0xc,%eax
+  801fca:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  801fd1:	a8 01                	test   $0x1,%al
+  801fd3:	74 82                	je     801f57 <devfile_read+0x134>
+  801fd5:	a9 02 08 00 00       	test   $0x802,%eax
+  801fda:	0f 84 77 ff ff ff    	je     801f57 <devfile_read+0x134>
+  801fe0:	f6 c4 04             	test   $0x4,%ah
+  801fe3:	0f 85 6e ff ff ff    	jne    801f57 <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  801fe9:	a1 a0 6c 80 00       	mov    0x806ca0,%eax
+  801fee:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  801ff2:	84 c0                	test   %al,%al
+  801ff4:	75 17                	jne    80200d <devfile_read+0x1ea>
+  801ff6:	83 ec 08             	sub    $0x8,%esp
+  801ff9:	6a 01                	push   $0x1
+  801ffb:	6a 00                	push   $0x0
+  801ffd:	e8 ea ec ff ff       	call   800cec <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  802002:	83 c4 10             	add    $0x10,%esp
+  802005:	85 c0                	test   %eax,%eax
+  802007:	0f 85 4a ff ff ff    	jne    801f57 <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  80200d:	83 ec 04             	sub    $0x4,%esp
+  802010:	68 05 08 00 00       	push   $0x805
+  802015:	ff 75 cc             	push   -0x34(%ebp)
+  802018:	6a 00                	push   $0x0
+  80201a:	56                   	push   %esi
+  80201b:	6a 00                	push   $0x0
+  80201d:	6a 05                	push   $0x5
+  80201f:	68 40 60 80 00       	push   $0x806040
+  802024:	e8 59 f1 ff ff       	call   801182 <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  802029:	c1 e8 1f             	shr    $0x1f,%eax
+  80202c:	08 45 cb             	or     %al,-0x35(%ebp)
+  80202f:	83 c4 20             	add    $0x20,%esp
+  802032:	e9 33 ff ff ff       	jmp    801f6a <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  802037:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  80203a:	83 ec 0c             	sub    $0xc,%esp
+  80203d:	68 40 60 80 00       	push   $0x806040
+  802042:	e8 eb f0 ff ff       	call   801132 <sysbatch_flush>
+  802047:	83 c4 10             	add    $0x10,%esp
+  80204a:	85 c0                	test   %eax,%eax
+  80204c:	78 06                	js     802054 <devfile_read+0x231>
+  80204e:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  802052:	74 14                	je     802068 <devfile_read+0x245>
+    memmove(dst, src, r);
+  802054:	83 ec 04             	sub    $0x4,%esp
+  802057:	ff 75 d4             	push   -0x2c(%ebp)
+  80205a:	ff 75 d0             	push   -0x30(%ebp)
+  80205d:	ff 75 0c             	push   0xc(%ebp)
+  802060:	e8 21 ea ff ff       	call   800a86 <memmove>
+  802065:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  802068:	8b 45 08             	mov    0x8(%ebp),%eax
+  80206b:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  80206e:	e9 11 fe ff ff       	jmp    801e84 <devfile_read+0x61>
+  assert(r <= n);
+  802073:	68 dd 40 80 00       	push   $0x8040dd
+  802078:	68 e4 40 80 00       	push   $0x8040e4
+  80207d:	68 1c 01 00 00       	push   $0x11c
+  802082:	68 d2 40 80 00       	push   $0x8040d2
+  802087:	e8 ab e1 ff ff       	call   800237 <_panic>
+  assert(r <= PGSIZE);
+  80208c:	68 f9 40 80 00       	push   $0x8040f9
+  802091:	68 e4 40 80 00       	push   $0x8040e4
+  802096:	68 1d 01 00 00       	push   $0x11d
+  80209b:	68 d2 40 80 00       	push   $0x8040d2
+  8020a0:	e8 92 e1 ff ff       	call   800237 <_panic>
+
+008020a5 <devfile_write>:
+{
+  8020a5:	55                   	push   %ebp
+  8020a6:	89 e5                	mov    %esp,%ebp
+  8020a8:	57                   	push   %edi
+  8020a9:	56                   	push   %esi
+  8020aa:	53                   	push   %ebx
+  8020ab:	83 ec 1c             	sub    $0x1c,%esp
+  8020ae:	8b 75 08             	mov    0x8(%ebp),%esi
+  8020b1:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  8020b4:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  8020b9:	77 39                	ja     8020f4 <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8020bb:	8b 56 0c             	mov    0xc(%esi),%edx
+  8020be:	89 15 00 70 80 00    	mov    %edx,0x807000
+  fsipcbuf.write.req_n = n;
+  8020c4:	a3 04 70 80 00       	mov    %eax,0x807004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  8020c9:	83 ec 04             	sub    $0x4,%esp
+  8020cc:	50                   	push   %eax
+  8020cd:	ff 75 0c             	push   0xc(%ebp)
+  8020d0:	68 08 70 80 00       	push   $0x807008
+  8020d5:	e8 ac e9 ff ff       	call   800a86 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  8020da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020df:	b8 04 00 00 00       	mov    $0x4,%eax
+  8020e4:	e8 e7 fb ff ff       	call   801cd0 <fsipc>
+  8020e9:	83 c4 10             	add    $0x10,%esp
+}
+  8020ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8020ef:	5b                   	pop    %ebx
+  8020f0:	5e                   	pop    %esi
+  8020f1:	5f                   	pop    %edi
+  8020f2:	5d                   	pop    %ebp
+  8020f3:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  8020f4:	ba 00 00 10 00       	mov    $0x100000,%edx
+  8020f9:	39 d0                	cmp    %edx,%eax
+  8020fb:	89 d3                	mov    %edx,%ebx
+  8020fd:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  802100:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  802106:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  802109:	83 c7 01             	add    $0x1,%edi
+  80210c:	89 f8                	mov    %edi,%eax
+  80210e:	e8 94 fc ff ff       	call   801da7 <fsv_alloc>
+  802113:	85 c0                	test   %eax,%eax
+  802115:	78 d5                	js     8020ec <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  802117:	83 ec 04             	sub    $0x4,%esp
+  80211a:	53                   	push   %ebx
+  80211b:	ff 75 0c             	push   0xc(%ebp)
+  80211e:	68 00 10 c0 9f       	push   $0x9fc01000
+  802123:	e8 5e e9 ff ff       	call   800a86 <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  802128:	8b 46 0c             	mov    0xc(%esi),%eax
+  80212b:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  802130:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  802136:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  80213d:	89 f9                	mov    %edi,%ecx
+  80213f:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  802144:	b8 0d 00 00 00       	mov    $0xd,%eax
+  802149:	e8 69 fa ff ff       	call   801bb7 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  80214e:	6a 00                	push   $0x0
+  802150:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802153:	50                   	push   %eax
+  802154:	6a 00                	push   $0x0
+  802156:	6a 00                	push   $0x0
+  802158:	e8 98 15 00 00       	call   8036f5 <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  80215d:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  802160:	eb 8a                	jmp    8020ec <devfile_write+0x47>
+
+00802162 <open>:
+{
+  802162:	55                   	push   %ebp
+  802163:	89 e5                	mov    %esp,%ebp
+  802165:	56                   	push   %esi
+  802166:	53                   	push   %ebx
+  802167:	83 ec 1c             	sub    $0x1c,%esp
+  80216a:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  80216d:	56                   	push   %esi
+  80216e:	e8 52 e7 ff ff       	call   8008c5 <strlen>
+  802173:	83 c4 10             	add    $0x10,%esp
+  802176:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80217b:	7f 6c                	jg     8021e9 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  80217d:	83 ec 0c             	sub    $0xc,%esp
+  802180:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802183:	50                   	push   %eax
+  802184:	e8 ad f4 ff ff       	call   801636 <fd_alloc>
+  802189:	89 c3                	mov    %eax,%ebx
+  80218b:	83 c4 10             	add    $0x10,%esp
+  80218e:	85 c0                	test   %eax,%eax
+  802190:	78 3c                	js     8021ce <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  802192:	83 ec 08             	sub    $0x8,%esp
+  802195:	56                   	push   %esi
+  802196:	68 00 70 80 00       	push   $0x807000
+  80219b:	e8 60 e7 ff ff       	call   800900 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  8021a0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8021a3:	a3 00 74 80 00       	mov    %eax,0x807400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8021a8:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8021ab:	b8 01 00 00 00       	mov    $0x1,%eax
+  8021b0:	e8 1b fb ff ff       	call   801cd0 <fsipc>
+  8021b5:	89 c3                	mov    %eax,%ebx
+  8021b7:	83 c4 10             	add    $0x10,%esp
+  8021ba:	85 c0                	test   %eax,%eax
+  8021bc:	78 19                	js     8021d7 <open+0x75>
+  return fd2num(fd);
+  8021be:	83 ec 0c             	sub    $0xc,%esp
+  8021c1:	ff 75 f4             	push   -0xc(%ebp)
+  8021c4:	e8 49 f4 ff ff       	call   801612 <fd2num>
+  8021c9:	89 c3                	mov    %eax,%ebx
+  8021cb:	83 c4 10             	add    $0x10,%esp
+}
+  8021ce:	89 d8                	mov    %ebx,%eax
+  8021d0:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8021d3:	5b                   	pop    %ebx
+  8021d4:	5e                   	pop    %esi
+  8021d5:	5d                   	pop    %ebp
+  8021d6:	c3                   	ret
+    fd_close(fd, 0);
+  8021d7:	83 ec 08             	sub    $0x8,%esp
+  8021da:	6a 00                	push   $0x0
+  8021dc:	ff 75 f4             	push   -0xc(%ebp)
+  8021df:	e8 44 f5 ff ff       	call   801728 <fd_close>
+    return r;
+  8021e4:	83 c4 10             	add    $0x10,%esp
+  8021e7:	eb e5                	jmp    8021ce <open+0x6c>
+    return -E_BAD_PATH;
+  8021e9:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8021ee:	eb de                	jmp    8021ce <open+0x6c>
+
+008021f0 <open_read>:
+{
+  8021f0:	55                   	push   %ebp
+  8021f1:	89 e5                	mov    %esp,%ebp
+  8021f3:	57                   	push   %edi
+  8021f4:	56                   	push   %esi
+  8021f5:	53                   	push   %ebx
+  8021f6:	83 ec 28             	sub    $0x28,%esp
+  8021f9:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  8021fc:	57                   	push   %edi
+  8021fd:	e8 c3 e6 ff ff       	call   8008c5 <strlen>
+  802202:	83 c4 10             	add    $0x10,%esp
+  802205:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80220a:	0f 87 f6 00 00 00    	ja     802306 <open_read+0x116>
+  802210:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  802212:	83 ec 0c             	sub    $0xc,%esp
+  802215:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802218:	50                   	push   %eax
+  802219:	e8 18 f4 ff ff       	call   801636 <fd_alloc>
+  80221e:	89 c3                	mov    %eax,%ebx
+  802220:	83 c4 10             	add    $0x10,%esp
+  802223:	85 c0                	test   %eax,%eax
+  802225:	0f 88 b2 00 00 00    	js     8022dd <open_read+0xed>
+  strcpy(req->req_buf, path);
+  80222b:	83 ec 08             	sub    $0x8,%esp
+  80222e:	57                   	push   %edi
+  80222f:	68 e4 70 80 00       	push   $0x8070e4
+  802234:	e8 c7 e6 ff ff       	call   800900 <strcpy>
+  req->req_nops = 2;
+  802239:	c7 05 00 70 80 00 02 	movl   $0x2,0x807000
+  802240:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  802243:	c7 05 04 70 80 00 01 	movl   $0x1,0x807004
+  80224a:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  80224d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802250:	a3 10 70 80 00       	mov    %eax,0x807010
+  req->req_ops[0].op_buf = 0;
+  802255:	c7 05 18 70 80 00 00 	movl   $0x0,0x807018
+  80225c:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  80225f:	c7 05 20 70 80 00 04 	movl   $0x4,0x807020
+  802266:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  802269:	c7 05 24 70 80 00 01 	movl   $0x1,0x807024
+  802270:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  802273:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  802278:	29 f0                	sub    %esi,%eax
+  80227a:	3b 45 14             	cmp    0x14(%ebp),%eax
+  80227d:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  802281:	a3 2c 70 80 00       	mov    %eax,0x80702c
+  req->req_ops[1].op_offset = 0;
+  802286:	c7 05 30 70 80 00 00 	movl   $0x0,0x807030
+  80228d:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  802290:	83 c6 01             	add    $0x1,%esi
+  802293:	89 35 34 70 80 00    	mov    %esi,0x807034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  802299:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  80229c:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8022a1:	e8 2a fa ff ff       	call   801cd0 <fsipc>
+  8022a6:	89 c3                	mov    %eax,%ebx
+  8022a8:	83 c4 10             	add    $0x10,%esp
+  8022ab:	83 f8 01             	cmp    $0x1,%eax
+  8022ae:	7e 37                	jle    8022e7 <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  8022b0:	a1 38 70 80 00       	mov    0x807038,%eax
+  8022b5:	8b 55 18             	mov    0x18(%ebp),%edx
+  8022b8:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  8022ba:	83 ec 04             	sub    $0x4,%esp
+  8022bd:	50                   	push   %eax
+  8022be:	81 c6 e4 70 80 00    	add    $0x8070e4,%esi
+  8022c4:	56                   	push   %esi
+  8022c5:	ff 75 10             	push   0x10(%ebp)
+  8022c8:	e8 b9 e7 ff ff       	call   800a86 <memmove>
+  return fd2num(fd);
+  8022cd:	83 c4 04             	add    $0x4,%esp
+  8022d0:	ff 75 e4             	push   -0x1c(%ebp)
+  8022d3:	e8 3a f3 ff ff       	call   801612 <fd2num>
+  8022d8:	89 c3                	mov    %eax,%ebx
+  8022da:	83 c4 10             	add    $0x10,%esp
+}
+  8022dd:	89 d8                	mov    %ebx,%eax
+  8022df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022e2:	5b                   	pop    %ebx
+  8022e3:	5e                   	pop    %esi
+  8022e4:	5f                   	pop    %edi
+  8022e5:	5d                   	pop    %ebp
+  8022e6:	c3                   	ret
+    fd_close(fd, 0);
+  8022e7:	83 ec 08             	sub    $0x8,%esp
+  8022ea:	6a 00                	push   $0x0
+  8022ec:	ff 75 e4             	push   -0x1c(%ebp)
+  8022ef:	e8 34 f4 ff ff       	call   801728 <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  8022f4:	83 c4 10             	add    $0x10,%esp
+  8022f7:	85 db                	test   %ebx,%ebx
+  8022f9:	78 e2                	js     8022dd <open_read+0xed>
+  8022fb:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  8022fe:	8b 9b 1c 70 80 00    	mov    0x80701c(%ebx),%ebx
+  802304:	eb d7                	jmp    8022dd <open_read+0xed>
+    return -E_BAD_PATH;
+  802306:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  80230b:	eb d0                	jmp    8022dd <open_read+0xed>
+
+0080230d <file_stat>:
+{
+  80230d:	55                   	push   %ebp
+  80230e:	89 e5                	mov    %esp,%ebp
+  802310:	57                   	push   %edi
+  802311:	56                   	push   %esi
+  802312:	53                   	push   %ebx
+  802313:	83 ec 18             	sub    $0x18,%esp
+  802316:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802319:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  80231c:	57                   	push   %edi
+  80231d:	e8 a3 e5 ff ff       	call   8008c5 <strlen>
+  802322:	83 c4 10             	add    $0x10,%esp
+  802325:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80232a:	0f 8f c7 00 00 00    	jg     8023f7 <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  802330:	83 ec 0c             	sub    $0xc,%esp
+  802333:	57                   	push   %edi
+  802334:	e8 8c e5 ff ff       	call   8008c5 <strlen>
+  802339:	8d 58 04             	lea    0x4(%eax),%ebx
+  80233c:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  80233f:	83 c4 08             	add    $0x8,%esp
+  802342:	57                   	push   %edi
+  802343:	68 e4 70 80 00       	push   $0x8070e4
+  802348:	e8 b3 e5 ff ff       	call   800900 <strcpy>
+  req->req_nops = 2;
+  80234d:	c7 05 00 70 80 00 02 	movl   $0x2,0x807000
+  802354:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  802357:	c7 05 04 70 80 00 02 	movl   $0x2,0x807004
+  80235e:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  802361:	c7 05 10 70 80 00 00 	movl   $0x0,0x807010
+  802368:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  80236b:	c7 05 18 70 80 00 00 	movl   $0x0,0x807018
+  802372:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  802375:	c7 05 20 70 80 00 03 	movl   $0x3,0x807020
+  80237c:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  80237f:	c7 05 24 70 80 00 01 	movl   $0x1,0x807024
+  802386:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  802389:	89 1d 34 70 80 00    	mov    %ebx,0x807034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  80238f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802394:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802399:	e8 32 f9 ff ff       	call   801cd0 <fsipc>
+  80239e:	83 c4 10             	add    $0x10,%esp
+  8023a1:	83 f8 01             	cmp    $0x1,%eax
+  8023a4:	7e 42                	jle    8023e8 <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  8023a6:	81 c3 e4 70 80 00    	add    $0x8070e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  8023ac:	83 ec 08             	sub    $0x8,%esp
+  8023af:	53                   	push   %ebx
+  8023b0:	56                   	push   %esi
+  8023b1:	e8 4a e5 ff ff       	call   800900 <strcpy>
+  st->st_size = ret->ret_size;
+  8023b6:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  8023bc:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  8023c2:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  8023c8:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  8023ce:	c7 86 88 00 00 00 04 	movl   $0x805004,0x88(%esi)
+  8023d5:	50 80 00 
+  return 0;
+  8023d8:	83 c4 10             	add    $0x10,%esp
+  8023db:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8023e0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023e3:	5b                   	pop    %ebx
+  8023e4:	5e                   	pop    %esi
+  8023e5:	5f                   	pop    %edi
+  8023e6:	5d                   	pop    %ebp
+  8023e7:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  8023e8:	85 c0                	test   %eax,%eax
+  8023ea:	78 f4                	js     8023e0 <file_stat+0xd3>
+  8023ec:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8023ef:	8b 80 1c 70 80 00    	mov    0x80701c(%eax),%eax
+  8023f5:	eb e9                	jmp    8023e0 <file_stat+0xd3>
+    return -E_BAD_PATH;
+  8023f7:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8023fc:	eb e2                	jmp    8023e0 <file_stat+0xd3>
+
+008023fe <read_map>:
+{
+  8023fe:	55                   	push   %ebp
+  8023ff:	89 e5                	mov    %esp,%ebp
+  802401:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802404:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802407:	50                   	push   %eax
+  802408:	ff 75 08             	push   0x8(%ebp)
+  80240b:	e8 7c f2 ff ff       	call   80168c <fd_lookup>
+  802410:	83 c4 10             	add    $0x10,%esp
+  802413:	85 c0                	test   %eax,%eax
+  802415:	78 2a                	js     802441 <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  802417:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80241a:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  802420:	39 08                	cmp    %ecx,(%eax)
+  802422:	75 1f                	jne    802443 <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  802424:	8b 40 0c             	mov    0xc(%eax),%eax
+  802427:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.read_map.req_offset = offset;
+  80242c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80242f:	a3 04 70 80 00       	mov    %eax,0x807004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  802434:	8b 55 10             	mov    0x10(%ebp),%edx
+  802437:	b8 0b 00 00 00       	mov    $0xb,%eax
+  80243c:	e8 8f f8 ff ff       	call   801cd0 <fsipc>
+}
+  802441:	c9                   	leave
+  802442:	c3                   	ret
+    return -E_INVAL;
+  802443:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802448:	eb f7                	jmp    802441 <read_map+0x43>
+
+0080244a <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80244a:	55                   	push   %ebp
+  80244b:	89 e5                	mov    %esp,%ebp
+  80244d:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  802450:	ba 00 00 00 00       	mov    $0x0,%edx
+  802455:	b8 08 00 00 00       	mov    $0x8,%eax
+  80245a:	e8 71 f8 ff ff       	call   801cd0 <fsipc>
+}
+  80245f:	c9                   	leave
+  802460:	c3                   	ret
+
+00802461 <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  802461:	55                   	push   %ebp
+  802462:	89 e5                	mov    %esp,%ebp
+  802464:	57                   	push   %edi
+  802465:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  802466:	8b 45 08             	mov    0x8(%ebp),%eax
+  802469:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.stats.req_bio_sched = 0;
+  80246e:	c7 05 04 70 80 00 00 	movl   $0x0,0x807004
+  802475:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  802478:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  80247f:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  802482:	ba 00 00 00 00       	mov    $0x0,%edx
+  802487:	b8 09 00 00 00       	mov    $0x9,%eax
+  80248c:	e8 3f f8 ff ff       	call   801cd0 <fsipc>
+  802491:	85 c0                	test   %eax,%eax
+  802493:	78 14                	js     8024a9 <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  802495:	be 00 70 80 00       	mov    $0x807000,%esi
+  80249a:	b9 16 00 00 00       	mov    $0x16,%ecx
+  80249f:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8024a2:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  8024a4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024a9:	5e                   	pop    %esi
+  8024aa:	5f                   	pop    %edi
+  8024ab:	5d                   	pop    %ebp
+  8024ac:	c3                   	ret
+
+008024ad <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  8024ad:	55                   	push   %ebp
+  8024ae:	89 e5                	mov    %esp,%ebp
+  8024b0:	53                   	push   %ebx
+  8024b1:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  8024b4:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8024b7:	50                   	push   %eax
+  8024b8:	6a 00                	push   $0x0
+  8024ba:	e8 a2 ff ff ff       	call   802461 <fs_stats>
+  8024bf:	83 c4 10             	add    $0x10,%esp
+  8024c2:	85 c0                	test   %eax,%eax
+  8024c4:	78 28                	js     8024ee <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  8024c6:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  8024c9:	83 ec 08             	sub    $0x8,%esp
+  8024cc:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8024cf:	50                   	push   %eax
+  8024d0:	6a 20                	push   $0x20
+  8024d2:	e8 8a ff ff ff       	call   802461 <fs_stats>
+  8024d7:	83 c4 10             	add    $0x10,%esp
+  8024da:	85 c0                	test   %eax,%eax
+  8024dc:	78 10                	js     8024ee <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  8024de:	83 ec 08             	sub    $0x8,%esp
+  8024e1:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8024e4:	50                   	push   %eax
+  8024e5:	53                   	push   %ebx
+  8024e6:	e8 76 ff ff ff       	call   802461 <fs_stats>
+  8024eb:	83 c4 10             	add    $0x10,%esp
+}
+  8024ee:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8024f1:	c9                   	leave
+  8024f2:	c3                   	ret
+
+008024f3 <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  8024f3:	55                   	push   %ebp
+  8024f4:	89 e5                	mov    %esp,%ebp
+  8024f6:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  8024f9:	c7 05 00 70 80 00 00 	movl   $0x0,0x807000
+  802500:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  802503:	8b 45 08             	mov    0x8(%ebp),%eax
+  802506:	a3 04 70 80 00       	mov    %eax,0x807004
+  fsipcbuf.stats.req_dcache = 0;
+  80250b:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  802512:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  802515:	ba 00 00 00 00       	mov    $0x0,%edx
+  80251a:	b8 09 00 00 00       	mov    $0x9,%eax
+  80251f:	e8 ac f7 ff ff       	call   801cd0 <fsipc>
+}
+  802524:	c9                   	leave
+  802525:	c3                   	ret
+
+00802526 <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  802526:	55                   	push   %ebp
+  802527:	89 e5                	mov    %esp,%ebp
+  802529:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  80252c:	c7 05 00 70 80 00 00 	movl   $0x0,0x807000
+  802533:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  802536:	c7 05 04 70 80 00 00 	movl   $0x0,0x807004
+  80253d:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  802540:	8b 45 08             	mov    0x8(%ebp),%eax
+  802543:	a3 08 70 80 00       	mov    %eax,0x807008
+  return fsipc(FSREQ_STATS, NULL);
+  802548:	ba 00 00 00 00       	mov    $0x0,%edx
+  80254d:	b8 09 00 00 00       	mov    $0x9,%eax
+  802552:	e8 79 f7 ff ff       	call   801cd0 <fsipc>
+}
+  802557:	c9                   	leave
+  802558:	c3                   	ret
+
+00802559 <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  802559:	55                   	push   %ebp
+  80255a:	89 e5                	mov    %esp,%ebp
+  80255c:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80255f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802562:	50                   	push   %eax
+  802563:	ff 75 08             	push   0x8(%ebp)
+  802566:	e8 21 f1 ff ff       	call   80168c <fd_lookup>
+  80256b:	83 c4 10             	add    $0x10,%esp
+  80256e:	85 c0                	test   %eax,%eax
+  802570:	78 34                	js     8025a6 <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  802572:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802575:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  80257b:	39 08                	cmp    %ecx,(%eax)
+  80257d:	75 29                	jne    8025a8 <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  80257f:	8b 40 0c             	mov    0xc(%eax),%eax
+  802582:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.fallocate.req_offset = offset;
+  802587:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80258a:	a3 04 70 80 00       	mov    %eax,0x807004
+  fsipcbuf.fallocate.req_len = len;
+  80258f:	8b 45 10             	mov    0x10(%ebp),%eax
+  802592:	a3 08 70 80 00       	mov    %eax,0x807008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  802597:	ba 00 00 00 00       	mov    $0x0,%edx
+  80259c:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8025a1:	e8 2a f7 ff ff       	call   801cd0 <fsipc>
+}
+  8025a6:	c9                   	leave
+  8025a7:	c3                   	ret
+    return -E_INVAL;
+  8025a8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8025ad:	eb f7                	jmp    8025a6 <fallocate+0x4d>
+
+008025af <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  8025af:	55                   	push   %ebp
+  8025b0:	89 e5                	mov    %esp,%ebp
+  8025b2:	57                   	push   %edi
+  8025b3:	56                   	push   %esi
+  8025b4:	53                   	push   %ebx
+  8025b5:	83 ec 24             	sub    $0x24,%esp
+  8025b8:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8025bb:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8025be:	50                   	push   %eax
+  8025bf:	ff 75 08             	push   0x8(%ebp)
+  8025c2:	e8 c5 f0 ff ff       	call   80168c <fd_lookup>
+  8025c7:	83 c4 10             	add    $0x10,%esp
+  8025ca:	85 c0                	test   %eax,%eax
+  8025cc:	78 66                	js     802634 <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  8025ce:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8025d1:	8b 0d 04 50 80 00    	mov    0x805004,%ecx
+  8025d7:	39 08                	cmp    %ecx,(%eax)
+  8025d9:	75 61                	jne    80263c <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  8025db:	85 f6                	test   %esi,%esi
+  8025dd:	7e 50                	jle    80262f <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  8025df:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  8025e4:	39 de                	cmp    %ebx,%esi
+  8025e6:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  8025e9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8025ec:	8b 40 0c             	mov    0xc(%eax),%eax
+  8025ef:	a3 00 70 80 00       	mov    %eax,0x807000
+    fsipcbuf.prefetch.req_n = m;
+  8025f4:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  8025fa:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  802601:	83 ec 04             	sub    $0x4,%esp
+  802604:	57                   	push   %edi
+  802605:	ff 75 0c             	push   0xc(%ebp)
+  802608:	68 08 70 80 00       	push   $0x807008
+  80260d:	e8 74 e4 ff ff       	call   800a86 <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  802612:	ba 00 00 00 00       	mov    $0x0,%edx
+  802617:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80261c:	e8 af f6 ff ff       	call   801cd0 <fsipc>
+  802621:	83 c4 10             	add    $0x10,%esp
+  802624:	85 c0                	test   %eax,%eax
+  802626:	78 0c                	js     802634 <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  802628:	01 7d 0c             	add    %edi,0xc(%ebp)
+  80262b:	29 de                	sub    %ebx,%esi
+  80262d:	eb ac                	jmp    8025db <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  80262f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802634:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802637:	5b                   	pop    %ebx
+  802638:	5e                   	pop    %esi
+  802639:	5f                   	pop    %edi
+  80263a:	5d                   	pop    %ebp
+  80263b:	c3                   	ret
+    return -E_INVAL;
+  80263c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802641:	eb f1                	jmp    802634 <prefetch+0x85>
+
+00802643 <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  802643:	55                   	push   %ebp
+  802644:	89 e5                	mov    %esp,%ebp
+  802646:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  802649:	50                   	push   %eax
+  80264a:	e8 d3 ef ff ff       	call   801622 <fd2data>
+  80264f:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  802654:	c9                   	leave
+  802655:	c3                   	ret
+
+00802656 <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  802656:	55                   	push   %ebp
+  802657:	89 e5                	mov    %esp,%ebp
+  802659:	56                   	push   %esi
+  80265a:	53                   	push   %ebx
+  80265b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  80265e:	83 ec 0c             	sub    $0xc,%esp
+  802661:	ff 75 08             	push   0x8(%ebp)
+  802664:	e8 b9 ef ff ff       	call   801622 <fd2data>
+  802669:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  80266b:	83 c4 08             	add    $0x8,%esp
+  80266e:	68 34 41 80 00       	push   $0x804134
+  802673:	53                   	push   %ebx
+  802674:	e8 87 e2 ff ff       	call   800900 <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  802679:	8b 46 04             	mov    0x4(%esi),%eax
+  80267c:	2b 06                	sub    (%esi),%eax
+  80267e:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  802684:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80268b:	00 00 00 
+  stat->st_dev = &devpipe;
+  80268e:	c7 83 88 00 00 00 20 	movl   $0x805020,0x88(%ebx)
+  802695:	50 80 00 
+  return 0;
+}
+  802698:	b8 00 00 00 00       	mov    $0x0,%eax
+  80269d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8026a0:	5b                   	pop    %ebx
+  8026a1:	5e                   	pop    %esi
+  8026a2:	5d                   	pop    %ebp
+  8026a3:	c3                   	ret
+
+008026a4 <pipe_wakeup>:
+{
+  8026a4:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  8026a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026ab:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  8026ae:	85 c0                	test   %eax,%eax
+  8026b0:	75 01                	jne    8026b3 <pipe_wakeup+0xf>
+  8026b2:	c3                   	ret
+{
+  8026b3:	55                   	push   %ebp
+  8026b4:	89 e5                	mov    %esp,%ebp
+  8026b6:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  8026b9:	6a 00                	push   $0x0
+  8026bb:	68 00 00 c0 ee       	push   $0xeec00000
+  8026c0:	52                   	push   %edx
+  8026c1:	e8 c5 e9 ff ff       	call   80108b <sys_chan_wakeup>
+  8026c6:	83 c4 10             	add    $0x10,%esp
+}
+  8026c9:	c9                   	leave
+  8026ca:	c3                   	ret
+
+008026cb <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8026cb:	55                   	push   %ebp
+  8026cc:	89 e5                	mov    %esp,%ebp
+  8026ce:	57                   	push   %edi
+  8026cf:	56                   	push   %esi
+  8026d0:	53                   	push   %ebx
+  8026d1:	83 ec 18             	sub    $0x18,%esp
+  8026d4:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  8026d7:	57                   	push   %edi
+  8026d8:	e8 45 ef ff ff       	call   801622 <fd2data>
+  8026dd:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  8026df:	83 c4 10             	add    $0x10,%esp
+  8026e2:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  8026e6:	74 2a                	je     802712 <devpipe_close+0x47>
+  8026e8:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  8026ed:	89 f8                	mov    %edi,%eax
+  8026ef:	e8 4f ff ff ff       	call   802643 <pipe_ring>
+  8026f4:	83 ec 08             	sub    $0x8,%esp
+  8026f7:	01 d8                	add    %ebx,%eax
+  8026f9:	50                   	push   %eax
+  8026fa:	6a 00                	push   $0x0
+  8026fc:	e8 b3 e6 ff ff       	call   800db4 <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  802701:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802707:	83 c4 10             	add    $0x10,%esp
+  80270a:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  802710:	75 db                	jne    8026ed <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  802712:	83 ec 08             	sub    $0x8,%esp
+  802715:	57                   	push   %edi
+  802716:	6a 00                	push   $0x0
+  802718:	e8 97 e6 ff ff       	call   800db4 <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  80271d:	83 c4 10             	add    $0x10,%esp
+  802720:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  802724:	75 13                	jne    802739 <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  802726:	83 ec 08             	sub    $0x8,%esp
+  802729:	56                   	push   %esi
+  80272a:	6a 00                	push   $0x0
+  80272c:	e8 83 e6 ff ff       	call   800db4 <sys_page_unmap>
+}
+  802731:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802734:	5b                   	pop    %ebx
+  802735:	5e                   	pop    %esi
+  802736:	5f                   	pop    %edi
+  802737:	5d                   	pop    %ebp
+  802738:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802739:	8d 56 04             	lea    0x4(%esi),%edx
+  80273c:	8d 46 2c             	lea    0x2c(%esi),%eax
+  80273f:	e8 60 ff ff ff       	call   8026a4 <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802744:	8d 46 30             	lea    0x30(%esi),%eax
+  802747:	89 f2                	mov    %esi,%edx
+  802749:	e8 56 ff ff ff       	call   8026a4 <pipe_wakeup>
+  80274e:	eb d6                	jmp    802726 <devpipe_close+0x5b>
+
+00802750 <_pipeisclosed>:
+{
+  802750:	55                   	push   %ebp
+  802751:	89 e5                	mov    %esp,%ebp
+  802753:	57                   	push   %edi
+  802754:	56                   	push   %esi
+  802755:	53                   	push   %ebx
+  802756:	83 ec 1c             	sub    $0x1c,%esp
+  802759:	89 c7                	mov    %eax,%edi
+  80275b:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  80275d:	a1 a0 6c 80 00       	mov    0x806ca0,%eax
+  802762:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  802765:	83 ec 0c             	sub    $0xc,%esp
+  802768:	57                   	push   %edi
+  802769:	e8 ea 10 00 00       	call   803858 <pageref>
+  80276e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802771:	89 34 24             	mov    %esi,(%esp)
+  802774:	e8 df 10 00 00       	call   803858 <pageref>
+    nn = thisenv->env_runs;
+  802779:	8b 15 a0 6c 80 00    	mov    0x806ca0,%edx
+  80277f:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  802782:	83 c4 10             	add    $0x10,%esp
+  802785:	39 cb                	cmp    %ecx,%ebx
+  802787:	74 1b                	je     8027a4 <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  802789:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80278c:	75 cf                	jne    80275d <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  80278e:	8b 42 58             	mov    0x58(%edx),%eax
+  802791:	6a 01                	push   $0x1
+  802793:	50                   	push   %eax
+  802794:	53                   	push   %ebx
+  802795:	68 3b 41 80 00       	push   $0x80413b
+  80279a:	e8 73 db ff ff       	call   800312 <cprintf>
+  80279f:	83 c4 10             	add    $0x10,%esp
+  8027a2:	eb b9                	jmp    80275d <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  8027a4:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8027a7:	0f 94 c0             	sete   %al
+  8027aa:	0f b6 c0             	movzbl %al,%eax
+}
+  8027ad:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8027b0:	5b                   	pop    %ebx
+  8027b1:	5e                   	pop    %esi
+  8027b2:	5f                   	pop    %edi
+  8027b3:	5d                   	pop    %ebp
+  8027b4:	c3                   	ret
+
+008027b5 <devpipe_write_bulk>:
+{
+  8027b5:	55                   	push   %ebp
+  8027b6:	89 e5                	mov    %esp,%ebp
+  8027b8:	57                   	push   %edi
+  8027b9:	56                   	push   %esi
+  8027ba:	53                   	push   %ebx
+  8027bb:	83 ec 1c             	sub    $0x1c,%esp
+  8027be:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8027c1:	89 d6                	mov    %edx,%esi
+  8027c3:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  8027c6:	e8 78 fe ff ff       	call   802643 <pipe_ring>
+  8027cb:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  8027ce:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  8027d3:	8d 46 04             	lea    0x4(%esi),%eax
+  8027d6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  8027d9:	eb 75                	jmp    802850 <devpipe_write_bulk+0x9b>
+  8027db:	b8 01 00 00 00       	mov    $0x1,%eax
+  8027e0:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  8027e4:	6a 64                	push   $0x64
+  8027e6:	68 00 00 c0 ee       	push   $0xeec00000
+  8027eb:	53                   	push   %ebx
+  8027ec:	56                   	push   %esi
+  8027ed:	e8 76 e8 ff ff       	call   801068 <sys_chan_sleep>
+      continue;
+  8027f2:	83 c4 10             	add    $0x10,%esp
+  8027f5:	eb 59                	jmp    802850 <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  8027f7:	89 d1                	mov    %edx,%ecx
+  8027f9:	c1 f9 1f             	sar    $0x1f,%ecx
+  8027fc:	c1 e9 11             	shr    $0x11,%ecx
+  8027ff:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802802:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802807:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  802809:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  80280f:	29 d3                	sub    %edx,%ebx
+  802811:	ba 00 80 00 00       	mov    $0x8000,%edx
+  802816:	29 c2                	sub    %eax,%edx
+  802818:	39 d3                	cmp    %edx,%ebx
+  80281a:	0f 47 da             	cmova  %edx,%ebx
+  80281d:	8b 55 08             	mov    0x8(%ebp),%edx
+  802820:	29 fa                	sub    %edi,%edx
+  802822:	39 d3                	cmp    %edx,%ebx
+  802824:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  802827:	83 ec 04             	sub    $0x4,%esp
+  80282a:	53                   	push   %ebx
+  80282b:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80282e:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  802831:	52                   	push   %edx
+  802832:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802835:	01 c8                	add    %ecx,%eax
+  802837:	50                   	push   %eax
+  802838:	e8 ab e2 ff ff       	call   800ae8 <memcpy>
+    i += m;
+  80283d:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  80283f:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802842:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802845:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802848:	e8 57 fe ff ff       	call   8026a4 <pipe_wakeup>
+  80284d:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802850:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802853:	73 2b                	jae    802880 <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  802855:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  802857:	8b 56 04             	mov    0x4(%esi),%edx
+  80285a:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  802860:	39 d0                	cmp    %edx,%eax
+  802862:	7d 93                	jge    8027f7 <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  802864:	89 f2                	mov    %esi,%edx
+  802866:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802869:	e8 e2 fe ff ff       	call   802750 <_pipeisclosed>
+  80286e:	85 c0                	test   %eax,%eax
+  802870:	0f 84 65 ff ff ff    	je     8027db <devpipe_write_bulk+0x26>
+        return i;
+  802876:	89 f8                	mov    %edi,%eax
+}
+  802878:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80287b:	5b                   	pop    %ebx
+  80287c:	5e                   	pop    %esi
+  80287d:	5f                   	pop    %edi
+  80287e:	5d                   	pop    %ebp
+  80287f:	c3                   	ret
+  return i;
+  802880:	89 f8                	mov    %edi,%eax
+  802882:	eb f4                	jmp    802878 <devpipe_write_bulk+0xc3>
+
+00802884 <devpipe_write>:
+{
+  802884:	55                   	push   %ebp
+  802885:	89 e5                	mov    %esp,%ebp
+  802887:	57                   	push   %edi
+  802888:	56                   	push   %esi
+  802889:	53                   	push   %ebx
+  80288a:	83 ec 28             	sub    $0x28,%esp
+  80288d:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  802890:	56                   	push   %esi
+  802891:	e8 8c ed ff ff       	call   801622 <fd2data>
+  802896:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  802898:	8b 78 28             	mov    0x28(%eax),%edi
+  80289b:	83 c4 10             	add    $0x10,%esp
+  80289e:	85 ff                	test   %edi,%edi
+  8028a0:	75 25                	jne    8028c7 <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  8028a2:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8028a5:	74 66                	je     80290d <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8028a7:	8b 43 04             	mov    0x4(%ebx),%eax
+  8028aa:	8b 0b                	mov    (%ebx),%ecx
+  8028ac:	8d 51 20             	lea    0x20(%ecx),%edx
+  8028af:	39 d0                	cmp    %edx,%eax
+  8028b1:	72 2b                	jb     8028de <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  8028b3:	89 da                	mov    %ebx,%edx
+  8028b5:	89 f0                	mov    %esi,%eax
+  8028b7:	e8 94 fe ff ff       	call   802750 <_pipeisclosed>
+  8028bc:	85 c0                	test   %eax,%eax
+  8028be:	75 51                	jne    802911 <devpipe_write+0x8d>
+      sys_yield();
+  8028c0:	e8 08 e4 ff ff       	call   800ccd <sys_yield>
+  8028c5:	eb e0                	jmp    8028a7 <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  8028c7:	83 ec 0c             	sub    $0xc,%esp
+  8028ca:	ff 75 10             	push   0x10(%ebp)
+  8028cd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8028d0:	89 c2                	mov    %eax,%edx
+  8028d2:	89 f0                	mov    %esi,%eax
+  8028d4:	e8 dc fe ff ff       	call   8027b5 <devpipe_write_bulk>
+  8028d9:	83 c4 10             	add    $0x10,%esp
+  8028dc:	eb 38                	jmp    802916 <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8028de:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8028e1:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8028e5:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8028e8:	89 c2                	mov    %eax,%edx
+  8028ea:	c1 fa 1f             	sar    $0x1f,%edx
+  8028ed:	89 d1                	mov    %edx,%ecx
+  8028ef:	c1 e9 1b             	shr    $0x1b,%ecx
+  8028f2:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8028f5:	83 e2 1f             	and    $0x1f,%edx
+  8028f8:	29 ca                	sub    %ecx,%edx
+  8028fa:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  8028fe:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  802902:	83 c0 01             	add    $0x1,%eax
+  802905:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  802908:	83 c7 01             	add    $0x1,%edi
+  80290b:	eb 95                	jmp    8028a2 <devpipe_write+0x1e>
+  return i;
+  80290d:	89 f8                	mov    %edi,%eax
+  80290f:	eb 05                	jmp    802916 <devpipe_write+0x92>
+        return 0;
+  802911:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802916:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802919:	5b                   	pop    %ebx
+  80291a:	5e                   	pop    %esi
+  80291b:	5f                   	pop    %edi
+  80291c:	5d                   	pop    %ebp
+  80291d:	c3                   	ret
+
+0080291e <devpipe_read_bulk>:
+{
+  80291e:	55                   	push   %ebp
+  80291f:	89 e5                	mov    %esp,%ebp
+  802921:	57                   	push   %edi
+  802922:	56                   	push   %esi
+  802923:	53                   	push   %ebx
+  802924:	83 ec 2c             	sub    $0x2c,%esp
+  802927:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80292a:	89 d6                	mov    %edx,%esi
+  80292c:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80292f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  802932:	e8 0c fd ff ff       	call   802643 <pipe_ring>
+  802937:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  80293a:	85 db                	test   %ebx,%ebx
+  80293c:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802941:	0f 45 c3             	cmovne %ebx,%eax
+  802944:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802947:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  80294c:	8d 46 30             	lea    0x30(%esi),%eax
+  80294f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  802952:	eb 50                	jmp    8029a4 <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  802954:	89 d1                	mov    %edx,%ecx
+  802956:	c1 f9 1f             	sar    $0x1f,%ecx
+  802959:	c1 e9 11             	shr    $0x11,%ecx
+  80295c:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  80295f:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802964:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  802966:	29 d3                	sub    %edx,%ebx
+  802968:	ba 00 80 00 00       	mov    $0x8000,%edx
+  80296d:	29 c2                	sub    %eax,%edx
+  80296f:	39 d3                	cmp    %edx,%ebx
+  802971:	0f 47 da             	cmova  %edx,%ebx
+  802974:	8b 55 08             	mov    0x8(%ebp),%edx
+  802977:	29 fa                	sub    %edi,%edx
+  802979:	39 d3                	cmp    %edx,%ebx
+  80297b:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  80297e:	83 ec 04             	sub    $0x4,%esp
+  802981:	53                   	push   %ebx
+  802982:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802985:	01 c8                	add    %ecx,%eax
+  802987:	50                   	push   %eax
+  802988:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  80298b:	01 f8                	add    %edi,%eax
+  80298d:	50                   	push   %eax
+  80298e:	e8 55 e1 ff ff       	call   800ae8 <memcpy>
+    i += m;
+  802993:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  802995:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802997:	89 f2                	mov    %esi,%edx
+  802999:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  80299c:	e8 03 fd ff ff       	call   8026a4 <pipe_wakeup>
+  8029a1:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  8029a4:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  8029a7:	73 51                	jae    8029fa <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  8029a9:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  8029ac:	8b 16                	mov    (%esi),%edx
+  8029ae:	39 da                	cmp    %ebx,%edx
+  8029b0:	75 a2                	jne    802954 <devpipe_read_bulk+0x36>
+      if (i > 0)
+  8029b2:	85 ff                	test   %edi,%edi
+  8029b4:	75 44                	jne    8029fa <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  8029b6:	89 f2                	mov    %esi,%edx
+  8029b8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8029bb:	e8 90 fd ff ff       	call   802750 <_pipeisclosed>
+  8029c0:	85 c0                	test   %eax,%eax
+  8029c2:	75 3a                	jne    8029fe <devpipe_read_bulk+0xe0>
+  8029c4:	b8 01 00 00 00       	mov    $0x1,%eax
+  8029c9:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  8029cd:	6a 64                	push   $0x64
+  8029cf:	ff 75 d4             	push   -0x2c(%ebp)
+  8029d2:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  8029d3:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  8029d6:	50                   	push   %eax
+  8029d7:	e8 8c e6 ff ff       	call   801068 <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  8029dc:	85 c0                	test   %eax,%eax
+  8029de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029e3:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  8029e6:	83 c4 10             	add    $0x10,%esp
+  8029e9:	a8 01                	test   $0x1,%al
+  8029eb:	74 b7                	je     8029a4 <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  8029ed:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  8029f2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8029f5:	5b                   	pop    %ebx
+  8029f6:	5e                   	pop    %esi
+  8029f7:	5f                   	pop    %edi
+  8029f8:	5d                   	pop    %ebp
+  8029f9:	c3                   	ret
+  return i;
+  8029fa:	89 f8                	mov    %edi,%eax
+  8029fc:	eb f4                	jmp    8029f2 <devpipe_read_bulk+0xd4>
+        return 0;
+  8029fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a03:	eb ed                	jmp    8029f2 <devpipe_read_bulk+0xd4>
+
+00802a05 <devpipe_read>:
+{
+  802a05:	55                   	push   %ebp
+  802a06:	89 e5                	mov    %esp,%ebp
+  802a08:	57                   	push   %edi
+  802a09:	56                   	push   %esi
+  802a0a:	53                   	push   %ebx
+  802a0b:	83 ec 18             	sub    $0x18,%esp
+  802a0e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  802a11:	57                   	push   %edi
+  802a12:	e8 0b ec ff ff       	call   801622 <fd2data>
+  802a17:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  802a19:	8b 70 28             	mov    0x28(%eax),%esi
+  802a1c:	83 c4 10             	add    $0x10,%esp
+  802a1f:	85 f6                	test   %esi,%esi
+  802a21:	75 24                	jne    802a47 <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  802a23:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802a26:	74 60                	je     802a88 <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  802a28:	8b 03                	mov    (%ebx),%eax
+  802a2a:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802a2d:	75 3b                	jne    802a6a <devpipe_read+0x65>
+      if (i > 0)
+  802a2f:	85 f6                	test   %esi,%esi
+  802a31:	75 2d                	jne    802a60 <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  802a33:	89 da                	mov    %ebx,%edx
+  802a35:	89 f8                	mov    %edi,%eax
+  802a37:	e8 14 fd ff ff       	call   802750 <_pipeisclosed>
+  802a3c:	85 c0                	test   %eax,%eax
+  802a3e:	75 4c                	jne    802a8c <devpipe_read+0x87>
+      sys_yield();
+  802a40:	e8 88 e2 ff ff       	call   800ccd <sys_yield>
+  802a45:	eb e1                	jmp    802a28 <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  802a47:	83 ec 08             	sub    $0x8,%esp
+  802a4a:	6a 00                	push   $0x0
+  802a4c:	ff 75 10             	push   0x10(%ebp)
+  802a4f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802a52:	89 c2                	mov    %eax,%edx
+  802a54:	89 f8                	mov    %edi,%eax
+  802a56:	e8 c3 fe ff ff       	call   80291e <devpipe_read_bulk>
+  802a5b:	83 c4 10             	add    $0x10,%esp
+  802a5e:	eb 02                	jmp    802a62 <devpipe_read+0x5d>
+        return i;
+  802a60:	89 f0                	mov    %esi,%eax
+}
+  802a62:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a65:	5b                   	pop    %ebx
+  802a66:	5e                   	pop    %esi
+  802a67:	5f                   	pop    %edi
+  802a68:	5d                   	pop    %ebp
+  802a69:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802a6a:	99                   	cltd
+  802a6b:	c1 ea 1b             	shr    $0x1b,%edx
+  802a6e:	01 d0                	add    %edx,%eax
+  802a70:	83 e0 1f             	and    $0x1f,%eax
+  802a73:	29 d0                	sub    %edx,%eax
+  802a75:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802a7a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802a7d:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  802a80:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  802a83:	83 c6 01             	add    $0x1,%esi
+  802a86:	eb 9b                	jmp    802a23 <devpipe_read+0x1e>
+  return i;
+  802a88:	89 f0                	mov    %esi,%eax
+  802a8a:	eb d6                	jmp    802a62 <devpipe_read+0x5d>
+        return 0;
+  802a8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a91:	eb cf                	jmp    802a62 <devpipe_read+0x5d>
+
+00802a93 <pipe2>:
+{
+  802a93:	55                   	push   %ebp
+  802a94:	89 e5                	mov    %esp,%ebp
+  802a96:	57                   	push   %edi
+  802a97:	56                   	push   %esi
+  802a98:	53                   	push   %ebx
+  802a99:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  802a9c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802a9f:	50                   	push   %eax
+  802aa0:	e8 91 eb ff ff       	call   801636 <fd_alloc>
+  802aa5:	89 c3                	mov    %eax,%ebx
+  802aa7:	83 c4 10             	add    $0x10,%esp
+  802aaa:	85 c0                	test   %eax,%eax
+  802aac:	0f 88 fb 01 00 00    	js     802cad <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802ab2:	83 ec 04             	sub    $0x4,%esp
+  802ab5:	68 07 04 00 00       	push   $0x407
+  802aba:	ff 75 e4             	push   -0x1c(%ebp)
+  802abd:	6a 00                	push   $0x0
+  802abf:	e8 6b e2 ff ff       	call   800d2f <sys_page_alloc>
+  802ac4:	89 c3                	mov    %eax,%ebx
+  802ac6:	83 c4 10             	add    $0x10,%esp
+  802ac9:	85 c0                	test   %eax,%eax
+  802acb:	0f 88 dc 01 00 00    	js     802cad <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  802ad1:	83 ec 0c             	sub    $0xc,%esp
+  802ad4:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  802ad7:	50                   	push   %eax
+  802ad8:	e8 59 eb ff ff       	call   801636 <fd_alloc>
+  802add:	89 c3                	mov    %eax,%ebx
+  802adf:	83 c4 10             	add    $0x10,%esp
+  802ae2:	85 c0                	test   %eax,%eax
+  802ae4:	0f 88 b3 01 00 00    	js     802c9d <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802aea:	83 ec 04             	sub    $0x4,%esp
+  802aed:	68 07 04 00 00       	push   $0x407
+  802af2:	ff 75 e0             	push   -0x20(%ebp)
+  802af5:	6a 00                	push   $0x0
+  802af7:	e8 33 e2 ff ff       	call   800d2f <sys_page_alloc>
+  802afc:	89 c3                	mov    %eax,%ebx
+  802afe:	83 c4 10             	add    $0x10,%esp
+  802b01:	85 c0                	test   %eax,%eax
+  802b03:	0f 88 94 01 00 00    	js     802c9d <pipe2+0x20a>
+  va = fd2data(fd0);
+  802b09:	83 ec 0c             	sub    $0xc,%esp
+  802b0c:	ff 75 e4             	push   -0x1c(%ebp)
+  802b0f:	e8 0e eb ff ff       	call   801622 <fd2data>
+  802b14:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802b16:	83 c4 0c             	add    $0xc,%esp
+  802b19:	68 07 04 00 00       	push   $0x407
+  802b1e:	50                   	push   %eax
+  802b1f:	6a 00                	push   $0x0
+  802b21:	e8 09 e2 ff ff       	call   800d2f <sys_page_alloc>
+  802b26:	89 c3                	mov    %eax,%ebx
+  802b28:	83 c4 10             	add    $0x10,%esp
+  802b2b:	85 c0                	test   %eax,%eax
+  802b2d:	0f 88 5a 01 00 00    	js     802c8d <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802b33:	83 ec 0c             	sub    $0xc,%esp
+  802b36:	ff 75 e0             	push   -0x20(%ebp)
+  802b39:	e8 e4 ea ff ff       	call   801622 <fd2data>
+  802b3e:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802b45:	50                   	push   %eax
+  802b46:	6a 00                	push   $0x0
+  802b48:	57                   	push   %edi
+  802b49:	6a 00                	push   $0x0
+  802b4b:	e8 22 e2 ff ff       	call   800d72 <sys_page_map>
+  802b50:	89 c3                	mov    %eax,%ebx
+  802b52:	83 c4 20             	add    $0x20,%esp
+  802b55:	85 c0                	test   %eax,%eax
+  802b57:	0f 88 22 01 00 00    	js     802c7f <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  802b5d:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  802b61:	74 72                	je     802bd5 <pipe2+0x142>
+  802b63:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  802b68:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802b6b:	e8 d3 fa ff ff       	call   802643 <pipe_ring>
+  802b70:	83 ec 04             	sub    $0x4,%esp
+  802b73:	68 07 04 00 00       	push   $0x407
+  802b78:	01 f0                	add    %esi,%eax
+  802b7a:	50                   	push   %eax
+  802b7b:	6a 00                	push   $0x0
+  802b7d:	e8 ad e1 ff ff       	call   800d2f <sys_page_alloc>
+  802b82:	89 c3                	mov    %eax,%ebx
+  802b84:	83 c4 10             	add    $0x10,%esp
+  802b87:	85 c0                	test   %eax,%eax
+  802b89:	0f 88 97 00 00 00    	js     802c26 <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  802b8f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802b92:	e8 ac fa ff ff       	call   802643 <pipe_ring>
+  802b97:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  802b9a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802b9d:	e8 a1 fa ff ff       	call   802643 <pipe_ring>
+  802ba2:	83 ec 0c             	sub    $0xc,%esp
+  802ba5:	68 07 04 00 00       	push   $0x407
+  802baa:	53                   	push   %ebx
+  802bab:	6a 00                	push   $0x0
+  802bad:	01 f0                	add    %esi,%eax
+  802baf:	50                   	push   %eax
+  802bb0:	6a 00                	push   $0x0
+  802bb2:	e8 bb e1 ff ff       	call   800d72 <sys_page_map>
+  802bb7:	89 c3                	mov    %eax,%ebx
+  802bb9:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802bbf:	83 c4 20             	add    $0x20,%esp
+  802bc2:	85 c0                	test   %eax,%eax
+  802bc4:	78 60                	js     802c26 <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  802bc6:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802bcc:	75 9a                	jne    802b68 <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  802bce:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  802bd5:	a1 20 50 80 00       	mov    0x805020,%eax
+  802bda:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802bdd:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  802bdf:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802be2:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  802be9:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802bec:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  802bee:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802bf1:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  802bf8:	83 ec 0c             	sub    $0xc,%esp
+  802bfb:	ff 75 e4             	push   -0x1c(%ebp)
+  802bfe:	e8 0f ea ff ff       	call   801612 <fd2num>
+  802c03:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802c06:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  802c08:	83 c4 04             	add    $0x4,%esp
+  802c0b:	ff 75 e0             	push   -0x20(%ebp)
+  802c0e:	e8 ff e9 ff ff       	call   801612 <fd2num>
+  802c13:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802c16:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  802c19:	83 c4 10             	add    $0x10,%esp
+  802c1c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c21:	e9 87 00 00 00       	jmp    802cad <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802c26:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  802c2b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802c2e:	e8 10 fa ff ff       	call   802643 <pipe_ring>
+  802c33:	83 ec 08             	sub    $0x8,%esp
+  802c36:	01 f0                	add    %esi,%eax
+  802c38:	50                   	push   %eax
+  802c39:	6a 00                	push   $0x0
+  802c3b:	e8 74 e1 ff ff       	call   800db4 <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  802c40:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802c43:	e8 fb f9 ff ff       	call   802643 <pipe_ring>
+  802c48:	83 c4 08             	add    $0x8,%esp
+  802c4b:	01 f0                	add    %esi,%eax
+  802c4d:	50                   	push   %eax
+  802c4e:	6a 00                	push   $0x0
+  802c50:	e8 5f e1 ff ff       	call   800db4 <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802c55:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802c5b:	83 c4 10             	add    $0x10,%esp
+  802c5e:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802c64:	75 c5                	jne    802c2b <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  802c66:	83 ec 0c             	sub    $0xc,%esp
+  802c69:	ff 75 e0             	push   -0x20(%ebp)
+  802c6c:	e8 b1 e9 ff ff       	call   801622 <fd2data>
+  802c71:	83 c4 08             	add    $0x8,%esp
+  802c74:	50                   	push   %eax
+  802c75:	6a 00                	push   $0x0
+  802c77:	e8 38 e1 ff ff       	call   800db4 <sys_page_unmap>
+  802c7c:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  802c7f:	83 ec 08             	sub    $0x8,%esp
+  802c82:	57                   	push   %edi
+  802c83:	6a 00                	push   $0x0
+  802c85:	e8 2a e1 ff ff       	call   800db4 <sys_page_unmap>
+  802c8a:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  802c8d:	83 ec 08             	sub    $0x8,%esp
+  802c90:	ff 75 e0             	push   -0x20(%ebp)
+  802c93:	6a 00                	push   $0x0
+  802c95:	e8 1a e1 ff ff       	call   800db4 <sys_page_unmap>
+  802c9a:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  802c9d:	83 ec 08             	sub    $0x8,%esp
+  802ca0:	ff 75 e4             	push   -0x1c(%ebp)
+  802ca3:	6a 00                	push   $0x0
+  802ca5:	e8 0a e1 ff ff       	call   800db4 <sys_page_unmap>
+  802caa:	83 c4 10             	add    $0x10,%esp
+}
+  802cad:	89 d8                	mov    %ebx,%eax
+  802caf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802cb2:	5b                   	pop    %ebx
+  802cb3:	5e                   	pop    %esi
+  802cb4:	5f                   	pop    %edi
+  802cb5:	5d                   	pop    %ebp
+  802cb6:	c3                   	ret
+
+00802cb7 <pipe>:
+{
+  802cb7:	55                   	push   %ebp
+  802cb8:	89 e5                	mov    %esp,%ebp
+  802cba:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  802cbd:	6a 00                	push   $0x0
+  802cbf:	ff 75 08             	push   0x8(%ebp)
+  802cc2:	e8 cc fd ff ff       	call   802a93 <pipe2>
+}
+  802cc7:	c9                   	leave
+  802cc8:	c3                   	ret
+
+00802cc9 <pipeisclosed>:
+{
+  802cc9:	55                   	push   %ebp
+  802cca:	89 e5                	mov    %esp,%ebp
+  802ccc:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802ccf:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802cd2:	50                   	push   %eax
+  802cd3:	ff 75 08             	push   0x8(%ebp)
+  802cd6:	e8 b1 e9 ff ff       	call   80168c <fd_lookup>
+  802cdb:	83 c4 10             	add    $0x10,%esp
+  802cde:	85 c0                	test   %eax,%eax
+  802ce0:	78 18                	js     802cfa <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  802ce2:	83 ec 0c             	sub    $0xc,%esp
+  802ce5:	ff 75 f4             	push   -0xc(%ebp)
+  802ce8:	e8 35 e9 ff ff       	call   801622 <fd2data>
+  802ced:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  802cef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802cf2:	e8 59 fa ff ff       	call   802750 <_pipeisclosed>
+  802cf7:	83 c4 10             	add    $0x10,%esp
+}
+  802cfa:	c9                   	leave
+  802cfb:	c3                   	ret
+
+00802cfc <pipe_splice>:
+{
+  802cfc:	55                   	push   %ebp
+  802cfd:	89 e5                	mov    %esp,%ebp
+  802cff:	57                   	push   %edi
+  802d00:	56                   	push   %esi
+  802d01:	53                   	push   %ebx
+  802d02:	83 ec 34             	sub    $0x34,%esp
+  802d05:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802d08:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802d0b:	50                   	push   %eax
+  802d0c:	ff 75 08             	push   0x8(%ebp)
+  802d0f:	e8 78 e9 ff ff       	call   80168c <fd_lookup>
+  802d14:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802d17:	83 c4 10             	add    $0x10,%esp
+  802d1a:	85 c0                	test   %eax,%eax
+  802d1c:	0f 88 d7 00 00 00    	js     802df9 <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  802d22:	83 ec 0c             	sub    $0xc,%esp
+  802d25:	ff 75 e4             	push   -0x1c(%ebp)
+  802d28:	e8 f5 e8 ff ff       	call   801622 <fd2data>
+  802d2d:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802d2f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802d32:	83 c4 10             	add    $0x10,%esp
+  802d35:	8b 15 20 50 80 00    	mov    0x805020,%edx
+  802d3b:	39 10                	cmp    %edx,(%eax)
+  802d3d:	0f 85 c1 00 00 00    	jne    802e04 <pipe_splice+0x108>
+  802d43:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  802d47:	0f 84 c0 00 00 00    	je     802e0d <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  802d4d:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802d51:	0f 84 bf 00 00 00    	je     802e16 <pipe_splice+0x11a>
+  802d57:	89 f7                	mov    %esi,%edi
+  802d59:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  802d5f:	0f 85 ba 00 00 00    	jne    802e1f <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802d65:	8d 43 04             	lea    0x4(%ebx),%eax
+  802d68:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802d6b:	eb 38                	jmp    802da5 <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802d6d:	83 ec 0c             	sub    $0xc,%esp
+  802d70:	68 00 10 00 00       	push   $0x1000
+  802d75:	89 f1                	mov    %esi,%ecx
+  802d77:	89 da                	mov    %ebx,%edx
+  802d79:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802d7c:	e8 34 fa ff ff       	call   8027b5 <devpipe_write_bulk>
+  802d81:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802d84:	83 c4 10             	add    $0x10,%esp
+  802d87:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802d8c:	75 53                	jne    802de1 <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  802d8e:	83 ec 08             	sub    $0x8,%esp
+  802d91:	56                   	push   %esi
+  802d92:	6a 00                	push   $0x0
+  802d94:	e8 1b e0 ff ff       	call   800db4 <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  802d99:	83 c7 01             	add    $0x1,%edi
+  802d9c:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802da2:	83 c4 10             	add    $0x10,%esp
+  802da5:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802da8:	74 3a                	je     802de4 <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  802daa:	8b 03                	mov    (%ebx),%eax
+  802dac:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802daf:	75 bc                	jne    802d6d <pipe_splice+0x71>
+  802db1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802db6:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  802dba:	85 c0                	test   %eax,%eax
+  802dbc:	74 af                	je     802d6d <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802dbe:	83 ec 04             	sub    $0x4,%esp
+  802dc1:	6a 07                	push   $0x7
+  802dc3:	56                   	push   %esi
+  802dc4:	ff 75 d0             	push   -0x30(%ebp)
+  802dc7:	e8 bf e2 ff ff       	call   80108b <sys_chan_wakeup>
+  802dcc:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802dcf:	83 c4 10             	add    $0x10,%esp
+  802dd2:	85 c0                	test   %eax,%eax
+  802dd4:	79 b8                	jns    802d8e <pipe_splice+0x92>
+  802dd6:	b8 01 00 00 00       	mov    $0x1,%eax
+  802ddb:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802ddf:	eb 8c                	jmp    802d6d <pipe_splice+0x71>
+  802de1:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  802de4:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802de8:	75 06                	jne    802df0 <pipe_splice+0xf4>
+  802dea:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802dee:	78 09                	js     802df9 <pipe_splice+0xfd>
+  return i * PGSIZE;
+  802df0:	8b 45 10             	mov    0x10(%ebp),%eax
+  802df3:	c1 e0 0c             	shl    $0xc,%eax
+  802df6:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  802df9:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802dfc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802dff:	5b                   	pop    %ebx
+  802e00:	5e                   	pop    %esi
+  802e01:	5f                   	pop    %edi
+  802e02:	5d                   	pop    %ebp
+  802e03:	c3                   	ret
+    return -E_INVAL;
+  802e04:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802e0b:	eb ec                	jmp    802df9 <pipe_splice+0xfd>
+  802e0d:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802e14:	eb e3                	jmp    802df9 <pipe_splice+0xfd>
+  802e16:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802e1d:	eb da                	jmp    802df9 <pipe_splice+0xfd>
+  802e1f:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802e26:	eb d1                	jmp    802df9 <pipe_splice+0xfd>
+
+00802e28 <pipe_splice_read>:
+{
+  802e28:	55                   	push   %ebp
+  802e29:	89 e5                	mov    %esp,%ebp
+  802e2b:	53                   	push   %ebx
+  802e2c:	83 ec 1c             	sub    $0x1c,%esp
+  802e2f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802e32:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802e35:	50                   	push   %eax
+  802e36:	ff 75 08             	push   0x8(%ebp)
+  802e39:	e8 4e e8 ff ff       	call   80168c <fd_lookup>
+  802e3e:	83 c4 10             	add    $0x10,%esp
+  802e41:	85 c0                	test   %eax,%eax
+  802e43:	78 49                	js     802e8e <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  802e45:	83 ec 0c             	sub    $0xc,%esp
+  802e48:	ff 75 f4             	push   -0xc(%ebp)
+  802e4b:	e8 d2 e7 ff ff       	call   801622 <fd2data>
+  802e50:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802e52:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802e55:	83 c4 10             	add    $0x10,%esp
+  802e58:	8b 0d 20 50 80 00    	mov    0x805020,%ecx
+  802e5e:	39 08                	cmp    %ecx,(%eax)
+  802e60:	75 31                	jne    802e93 <pipe_splice_read+0x6b>
+  802e62:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  802e66:	74 32                	je     802e9a <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  802e68:	8b 48 08             	mov    0x8(%eax),%ecx
+  802e6b:	83 e1 03             	and    $0x3,%ecx
+  802e6e:	83 f9 01             	cmp    $0x1,%ecx
+  802e71:	74 2e                	je     802ea1 <pipe_splice_read+0x79>
+  802e73:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  802e79:	75 2d                	jne    802ea8 <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  802e7b:	83 ec 08             	sub    $0x8,%esp
+  802e7e:	53                   	push   %ebx
+  802e7f:	68 00 10 00 00       	push   $0x1000
+  802e84:	89 d9                	mov    %ebx,%ecx
+  802e86:	e8 93 fa ff ff       	call   80291e <devpipe_read_bulk>
+  802e8b:	83 c4 10             	add    $0x10,%esp
+}
+  802e8e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802e91:	c9                   	leave
+  802e92:	c3                   	ret
+    return -E_INVAL;
+  802e93:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e98:	eb f4                	jmp    802e8e <pipe_splice_read+0x66>
+  802e9a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802e9f:	eb ed                	jmp    802e8e <pipe_splice_read+0x66>
+  802ea1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ea6:	eb e6                	jmp    802e8e <pipe_splice_read+0x66>
+  802ea8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ead:	eb df                	jmp    802e8e <pipe_splice_read+0x66>
+
+00802eaf <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  802eaf:	55                   	push   %ebp
+  802eb0:	89 e5                	mov    %esp,%ebp
+  802eb2:	56                   	push   %esi
+  802eb3:	53                   	push   %ebx
+  802eb4:	8b 75 08             	mov    0x8(%ebp),%esi
+  const volatile struct Env *e;
+
+  assert(envid != 0);
+  802eb7:	85 f6                	test   %esi,%esi
+  802eb9:	74 15                	je     802ed0 <wait+0x21>
+  e = &envs[ENVX(envid)];
+  802ebb:	89 f0                	mov    %esi,%eax
+  802ebd:	25 ff 03 00 00       	and    $0x3ff,%eax
+  while (e->env_id == envid && e->env_status != ENV_FREE)
+  802ec2:	8d 1c c0             	lea    (%eax,%eax,8),%ebx
+  802ec5:	c1 e3 04             	shl    $0x4,%ebx
+  802ec8:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  802ece:	eb 1b                	jmp    802eeb <wait+0x3c>
+  assert(envid != 0);
+  802ed0:	68 53 41 80 00       	push   $0x804153
+  802ed5:	68 e4 40 80 00       	push   $0x8040e4
+  802eda:	6a 09                	push   $0x9
+  802edc:	68 5e 41 80 00       	push   $0x80415e
+  802ee1:	e8 51 d3 ff ff       	call   800237 <_panic>
+    sys_yield();
+  802ee6:	e8 e2 dd ff ff       	call   800ccd <sys_yield>
+  while (e->env_id == envid && e->env_status != ENV_FREE)
+  802eeb:	8b 43 48             	mov    0x48(%ebx),%eax
+  802eee:	39 f0                	cmp    %esi,%eax
+  802ef0:	75 07                	jne    802ef9 <wait+0x4a>
+  802ef2:	8b 43 54             	mov    0x54(%ebx),%eax
+  802ef5:	85 c0                	test   %eax,%eax
+  802ef7:	75 ed                	jne    802ee6 <wait+0x37>
+}
+  802ef9:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802efc:	5b                   	pop    %ebx
+  802efd:	5e                   	pop    %esi
+  802efe:	5d                   	pop    %ebp
+  802eff:	c3                   	ret
+
+00802f00 <mmap_find>:
+          utf->utf_eip, utf->utf_err);
+}
+
+static struct Mmap *
+mmap_find(uintptr_t va)
+{
+  802f00:	55                   	push   %ebp
+  802f01:	89 e5                	mov    %esp,%ebp
+  802f03:	56                   	push   %esi
+  802f04:	53                   	push   %ebx
+  int i;
+
+  for (i = 0; i < NMMAP; i++)
+  802f05:	ba 60 67 80 00       	mov    $0x806760,%edx
+  802f0a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802f0f:	eb 0b                	jmp    802f1c <mmap_find+0x1c>
+  802f11:	83 c3 01             	add    $0x1,%ebx
+  802f14:	83 c2 14             	add    $0x14,%edx
+  802f17:	83 fb 10             	cmp    $0x10,%ebx
+  802f1a:	74 1d                	je     802f39 <mmap_find+0x39>
+    if (mmaps[i].mm_va && va >= mmaps[i].mm_va &&
+  802f1c:	8b 0a                	mov    (%edx),%ecx
+  802f1e:	39 c8                	cmp    %ecx,%eax
+  802f20:	72 ef                	jb     802f11 <mmap_find+0x11>
+  802f22:	85 c9                	test   %ecx,%ecx
+  802f24:	74 eb                	je     802f11 <mmap_find+0x11>
+        va < mmaps[i].mm_va + mmaps[i].mm_len)
+  802f26:	03 4a 04             	add    0x4(%edx),%ecx
+    if (mmaps[i].mm_va && va >= mmaps[i].mm_va &&
+  802f29:	39 c8                	cmp    %ecx,%eax
+  802f2b:	73 e4                	jae    802f11 <mmap_find+0x11>
+      return &mmaps[i];
+  802f2d:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  802f30:	8d 04 85 60 67 80 00 	lea    0x806760(,%eax,4),%eax
+  802f37:	eb 05                	jmp    802f3e <mmap_find+0x3e>
+  return NULL;
+  802f39:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802f3e:	5b                   	pop    %ebx
+  802f3f:	5e                   	pop    %esi
+  802f40:	5d                   	pop    %ebp
+  802f41:	c3                   	ret
+
+00802f42 <va_mapped>:
+
+static bool
+va_mapped(uintptr_t va)
+{
+  return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+  802f42:	89 c2                	mov    %eax,%edx
+  802f44:	c1 ea 16             	shr    $0x16,%edx
+  802f47:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  802f4e:	f6 c2 01             	test   $0x1,%dl
+  802f51:	74 11                	je     802f64 <va_mapped+0x22>
+  802f53:	c1 e8 0c             	shr    $0xc,%eax
+  802f56:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  802f5d:	83 e0 01             	and    $0x1,%eax
+  802f60:	83 e0 01             	and    $0x1,%eax
+}
+  802f63:	c3                   	ret
+  return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+  802f64:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f69:	eb f5                	jmp    802f60 <va_mapped+0x1e>
+
+00802f6b <mmap_copy>:
+
+// Replace the page at 'va' with a copy of its first 'n' bytes, the rest
+// zeroed, mapped with 'perm'.
+static void
+mmap_copy(uintptr_t va, size_t n, int perm)
+{
+  802f6b:	55                   	push   %ebp
+  802f6c:	89 e5                	mov    %esp,%ebp
+  802f6e:	57                   	push   %edi
+  802f6f:	56                   	push   %esi
+  802f70:	53                   	push   %ebx
+  802f71:	83 ec 10             	sub    $0x10,%esp
+  802f74:	89 c3                	mov    %eax,%ebx
+  802f76:	89 d7                	mov    %edx,%edi
+  802f78:	89 ce                	mov    %ecx,%esi
+  int r;
+
+  if ((r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  802f7a:	6a 07                	push   $0x7
+  802f7c:	68 00 f0 7f 00       	push   $0x7ff000
+  802f81:	6a 00                	push   $0x0
+  802f83:	e8 a7 dd ff ff       	call   800d2f <sys_page_alloc>
+  802f88:	83 c4 10             	add    $0x10,%esp
+  802f8b:	85 c0                	test   %eax,%eax
+  802f8d:	78 46                	js     802fd5 <mmap_copy+0x6a>
+    panic("mmap: %e", r);
+  memmove(PFTEMP, (void *) va, n);
+  802f8f:	83 ec 04             	sub    $0x4,%esp
+  802f92:	57                   	push   %edi
+  802f93:	53                   	push   %ebx
+  802f94:	68 00 f0 7f 00       	push   $0x7ff000
+  802f99:	e8 e8 da ff ff       	call   800a86 <memmove>
+  if ((r = sys_page_map(0, PFTEMP, 0, (void *) va, perm)) < 0 ||
+  802f9e:	89 34 24             	mov    %esi,(%esp)
+  802fa1:	53                   	push   %ebx
+  802fa2:	6a 00                	push   $0x0
+  802fa4:	68 00 f0 7f 00       	push   $0x7ff000
+  802fa9:	6a 00                	push   $0x0
+  802fab:	e8 c2 dd ff ff       	call   800d72 <sys_page_map>
+  802fb0:	83 c4 20             	add    $0x20,%esp
+  802fb3:	85 c0                	test   %eax,%eax
+  802fb5:	78 30                	js     802fe7 <mmap_copy+0x7c>
+      (r = sys_page_unmap(0, PFTEMP)) < 0)
+  802fb7:	83 ec 08             	sub    $0x8,%esp
+  802fba:	68 00 f0 7f 00       	push   $0x7ff000
+  802fbf:	6a 00                	push   $0x0
+  802fc1:	e8 ee dd ff ff       	call   800db4 <sys_page_unmap>
+  if ((r = sys_page_map(0, PFTEMP, 0, (void *) va, perm)) < 0 ||
+  802fc6:	83 c4 10             	add    $0x10,%esp
+  802fc9:	85 c0                	test   %eax,%eax
+  802fcb:	78 1a                	js     802fe7 <mmap_copy+0x7c>
+    panic("mmap: %e", r);
+}
+  802fcd:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fd0:	5b                   	pop    %ebx
+  802fd1:	5e                   	pop    %esi
+  802fd2:	5f                   	pop    %edi
+  802fd3:	5d                   	pop    %ebp
+  802fd4:	c3                   	ret
+    panic("mmap: %e", r);
+  802fd5:	50                   	push   %eax
+  802fd6:	68 69 41 80 00       	push   $0x804169
+  802fdb:	6a 3e                	push   $0x3e
+  802fdd:	68 72 41 80 00       	push   $0x804172
+  802fe2:	e8 50 d2 ff ff       	call   800237 <_panic>
+    panic("mmap: %e", r);
+  802fe7:	50                   	push   %eax
+  802fe8:	68 69 41 80 00       	push   $0x804169
+  802fed:	6a 42                	push   $0x42
+  802fef:	68 72 41 80 00       	push   $0x804172
+  802ff4:	e8 3e d2 ff ff       	call   800237 <_panic>
+
+00802ff9 <mmap_fault>:
+// Handle a page fault in a mapping, if it is one.  Returns 1 if it was.
+// The fork page fault handlers call this first, so that mappings keep
+// working after a fork.
+bool
+mmap_fault(struct UTrapframe *utf)
+{
+  802ff9:	55                   	push   %ebp
+  802ffa:	89 e5                	mov    %esp,%ebp
+  802ffc:	57                   	push   %edi
+  802ffd:	56                   	push   %esi
+  802ffe:	53                   	push   %ebx
+  802fff:	83 ec 1c             	sub    $0x1c,%esp
+  803002:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Fsreq_read_map saved;
+  struct Mmap *m;
+  uintptr_t va;
+  int perm, r;
+
+  va = ROUNDDOWN(utf->utf_fault_va, PGSIZE);
+  803005:	8b 1f                	mov    (%edi),%ebx
+  803007:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if (va < MMAPBASE || va >= MMAPTOP || (m = mmap_find(va)) == NULL)
+  80300d:	8d 83 00 00 00 60    	lea    0x60000000(%ebx),%eax
+  803013:	3d ff ff ff 2f       	cmp    $0x2fffffff,%eax
+  803018:	0f 87 24 01 00 00    	ja     803142 <mmap_fault+0x149>
+  80301e:	89 d8                	mov    %ebx,%eax
+  803020:	e8 db fe ff ff       	call   802f00 <mmap_find>
+  803025:	89 c6                	mov    %eax,%esi
+  803027:	85 c0                	test   %eax,%eax
+  803029:	0f 84 20 01 00 00    	je     80314f <mmap_fault+0x156>
+    return 0;
+  if ((utf->utf_err & FEC_WR) && m->mm_perm == MAP_RDONLY)
+  80302f:	f6 47 04 02          	testb  $0x2,0x4(%edi)
+  803033:	74 13                	je     803048 <mmap_fault+0x4f>
+  803035:	83 78 10 00          	cmpl   $0x0,0x10(%eax)
+  803039:	0f 84 17 01 00 00    	je     803156 <mmap_fault+0x15d>
+    return 0;
+  perm = PTE_P | PTE_U | (m->mm_perm == MAP_RDONLY ? 0 : PTE_W);
+  80303f:	c7 45 e4 07 00 00 00 	movl   $0x7,-0x1c(%ebp)
+  803046:	eb 0f                	jmp    803057 <mmap_fault+0x5e>
+  803048:	83 78 10 01          	cmpl   $0x1,0x10(%eax)
+  80304c:	19 c0                	sbb    %eax,%eax
+  80304e:	83 e0 fe             	and    $0xfffffffe,%eax
+  803051:	83 c0 07             	add    $0x7,%eax
+  803054:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+
+  if (!va_mapped(va)) {
+  803057:	89 d8                	mov    %ebx,%eax
+  803059:	e8 e4 fe ff ff       	call   802f42 <va_mapped>
+  80305e:	84 c0                	test   %al,%al
+  803060:	74 42                	je     8030a4 <mmap_fault+0xab>
+    }
+  }
+
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+    mmap_copy(va, PGSIZE, perm);
+  return 1;
+  803062:	b8 01 00 00 00       	mov    $0x1,%eax
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+  803067:	f6 47 04 02          	testb  $0x2,0x4(%edi)
+  80306b:	0f 84 d6 00 00 00    	je     803147 <mmap_fault+0x14e>
+  803071:	89 d8                	mov    %ebx,%eax
+  803073:	c1 e8 0c             	shr    $0xc,%eax
+  803076:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  return 1;
+  80307d:	b8 01 00 00 00       	mov    $0x1,%eax
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+  803082:	f6 c2 02             	test   $0x2,%dl
+  803085:	0f 85 bc 00 00 00    	jne    803147 <mmap_fault+0x14e>
+    mmap_copy(va, PGSIZE, perm);
+  80308b:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80308e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803093:	89 d8                	mov    %ebx,%eax
+  803095:	e8 d1 fe ff ff       	call   802f6b <mmap_copy>
+  return 1;
+  80309a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80309f:	e9 a3 00 00 00       	jmp    803147 <mmap_fault+0x14e>
+    saved = fsipcbuf.read_map;
+  8030a4:	a1 00 70 80 00       	mov    0x807000,%eax
+  8030a9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8030ac:	8b 15 04 70 80 00    	mov    0x807004,%edx
+  8030b2:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    r = read_map(m->mm_fd, m->mm_offset + (va - m->mm_va), (void *) va);
+  8030b5:	83 ec 04             	sub    $0x4,%esp
+  8030b8:	53                   	push   %ebx
+  8030b9:	89 d8                	mov    %ebx,%eax
+  8030bb:	03 46 0c             	add    0xc(%esi),%eax
+  8030be:	2b 06                	sub    (%esi),%eax
+  8030c0:	50                   	push   %eax
+  8030c1:	ff 76 08             	push   0x8(%esi)
+  8030c4:	e8 35 f3 ff ff       	call   8023fe <read_map>
+    fsipcbuf.read_map = saved;
+  8030c9:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8030cc:	89 0d 00 70 80 00    	mov    %ecx,0x807000
+  8030d2:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  8030d5:	89 15 04 70 80 00    	mov    %edx,0x807004
+    if (r < 0)
+  8030db:	83 c4 10             	add    $0x10,%esp
+  8030de:	85 c0                	test   %eax,%eax
+  8030e0:	78 20                	js     803102 <mmap_fault+0x109>
+    if (r == 0) {
+  8030e2:	74 30                	je     803114 <mmap_fault+0x11b>
+    if (r < PGSIZE) {
+  8030e4:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  8030e9:	0f 8f 73 ff ff ff    	jg     803062 <mmap_fault+0x69>
+      mmap_copy(va, r, perm);
+  8030ef:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8030f2:	89 c2                	mov    %eax,%edx
+  8030f4:	89 d8                	mov    %ebx,%eax
+  8030f6:	e8 70 fe ff ff       	call   802f6b <mmap_copy>
+      return 1;
+  8030fb:	b8 01 00 00 00       	mov    $0x1,%eax
+  803100:	eb 45                	jmp    803147 <mmap_fault+0x14e>
+      panic("mmap: read_map: %e", r);
+  803102:	50                   	push   %eax
+  803103:	68 7d 41 80 00       	push   $0x80417d
+  803108:	6a 5f                	push   $0x5f
+  80310a:	68 72 41 80 00       	push   $0x804172
+  80310f:	e8 23 d1 ff ff       	call   800237 <_panic>
+      if ((r = sys_page_alloc(0, (void *) va, perm)) < 0)
+  803114:	83 ec 04             	sub    $0x4,%esp
+  803117:	ff 75 e4             	push   -0x1c(%ebp)
+  80311a:	53                   	push   %ebx
+  80311b:	6a 00                	push   $0x0
+  80311d:	e8 0d dc ff ff       	call   800d2f <sys_page_alloc>
+  803122:	83 c4 10             	add    $0x10,%esp
+  803125:	85 c0                	test   %eax,%eax
+  803127:	78 07                	js     803130 <mmap_fault+0x137>
+      return 1;
+  803129:	b8 01 00 00 00       	mov    $0x1,%eax
+  80312e:	eb 17                	jmp    803147 <mmap_fault+0x14e>
+        panic("mmap: %e", r);
+  803130:	50                   	push   %eax
+  803131:	68 69 41 80 00       	push   $0x804169
+  803136:	6a 64                	push   $0x64
+  803138:	68 72 41 80 00       	push   $0x804172
+  80313d:	e8 f5 d0 ff ff       	call   800237 <_panic>
+    return 0;
+  803142:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803147:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80314a:	5b                   	pop    %ebx
+  80314b:	5e                   	pop    %esi
+  80314c:	5f                   	pop    %edi
+  80314d:	5d                   	pop    %ebp
+  80314e:	c3                   	ret
+    return 0;
+  80314f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803154:	eb f1                	jmp    803147 <mmap_fault+0x14e>
+    return 0;
+  803156:	b8 00 00 00 00       	mov    $0x0,%eax
+  80315b:	eb ea                	jmp    803147 <mmap_fault+0x14e>
+
+0080315d <mmap_pgfault>:
+{
+  80315d:	55                   	push   %ebp
+  80315e:	89 e5                	mov    %esp,%ebp
+  803160:	53                   	push   %ebx
+  803161:	83 ec 10             	sub    $0x10,%esp
+  803164:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (!mmap_fault(utf))
+  803167:	53                   	push   %ebx
+  803168:	e8 8c fe ff ff       	call   802ff9 <mmap_fault>
+  80316d:	83 c4 10             	add    $0x10,%esp
+  803170:	84 c0                	test   %al,%al
+  803172:	74 05                	je     803179 <mmap_pgfault+0x1c>
+}
+  803174:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803177:	c9                   	leave
+  803178:	c3                   	ret
+    panic("page fault at %08x, eip %08x, err %04x", utf->utf_fault_va,
+  803179:	83 ec 08             	sub    $0x8,%esp
+  80317c:	ff 73 04             	push   0x4(%ebx)
+  80317f:	ff 73 28             	push   0x28(%ebx)
+  803182:	ff 33                	push   (%ebx)
+  803184:	68 90 41 80 00       	push   $0x804190
+  803189:	6a 20                	push   $0x20
+  80318b:	68 72 41 80 00       	push   $0x804172
+  803190:	e8 a2 d0 ff ff       	call   800237 <_panic>
+
+00803195 <mmap>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_INVAL if offset isn't aligned, len is 0, or perm is unknown
+//	-E_NO_MEM if there's no free slot or address space for it
+int
+mmap(int fdnum, off_t offset, size_t len, int perm, void **addr)
+{
+  803195:	55                   	push   %ebp
+  803196:	89 e5                	mov    %esp,%ebp
+  803198:	57                   	push   %edi
+  803199:	56                   	push   %esi
+  80319a:	53                   	push   %ebx
+  80319b:	83 ec 44             	sub    $0x44,%esp
+  80319e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  struct Fd *fd;
+  uintptr_t va;
+  int i, j, r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8031a1:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8031a4:	50                   	push   %eax
+  8031a5:	ff 75 08             	push   0x8(%ebp)
+  8031a8:	e8 df e4 ff ff       	call   80168c <fd_lookup>
+  8031ad:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8031b0:	83 c4 10             	add    $0x10,%esp
+  8031b3:	85 c0                	test   %eax,%eax
+  8031b5:	0f 88 3e 01 00 00    	js     8032f9 <mmap+0x164>
+    return r;
+  if (offset < 0 || PGOFF(offset) || len == 0 ||
+  8031bb:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8031bf:	0f 88 d1 00 00 00    	js     803296 <mmap+0x101>
+  8031c5:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8031c8:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8031cd:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8031d0:	0f 85 c9 00 00 00    	jne    80329f <mmap+0x10a>
+  8031d6:	85 db                	test   %ebx,%ebx
+  8031d8:	0f 84 ca 00 00 00    	je     8032a8 <mmap+0x113>
+  8031de:	83 7d 14 02          	cmpl   $0x2,0x14(%ebp)
+  8031e2:	0f 87 c0 00 00 00    	ja     8032a8 <mmap+0x113>
+      (perm != MAP_RDONLY && perm != MAP_PRIVATE && perm != MAP_SHARED))
+    return -E_INVAL;
+  len = ROUNDUP(len, PGSIZE);
+  8031e8:	81 c3 ff 0f 00 00    	add    $0xfff,%ebx
+  8031ee:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  8031f4:	89 d9                	mov    %ebx,%ecx
+  8031f6:	89 5d c4             	mov    %ebx,-0x3c(%ebp)
+
+  // First fit: try the start of the region and the end of each
+  // mapping.
+  for (i = -1; i < NMMAP; i++) {
+  8031f9:	bb 4c 67 80 00       	mov    $0x80674c,%ebx
+  8031fe:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+    if (i >= 0 && !mmaps[i].mm_va)
+      continue;
+    va = i < 0 ? MMAPBASE : mmaps[i].mm_va + mmaps[i].mm_len;
+  803203:	bf 00 00 00 a0       	mov    $0xa0000000,%edi
+  803208:	eb 53                	jmp    80325d <mmap+0xc8>
+  80320a:	bf 00 00 00 a0       	mov    $0xa0000000,%edi
+  80320f:	eb 4c                	jmp    80325d <mmap+0xc8>
+    if (len > MMAPTOP - va)
+      continue;
+    for (j = 0; j < NMMAP; j++)
+  803211:	83 c0 01             	add    $0x1,%eax
+  803214:	83 f8 10             	cmp    $0x10,%eax
+  803217:	0f 84 e7 00 00 00    	je     803304 <mmap+0x16f>
+      if (mmaps[j].mm_va && va < mmaps[j].mm_va + mmaps[j].mm_len &&
+  80321d:	8d 34 80             	lea    (%eax,%eax,4),%esi
+  803220:	8b 14 b5 60 67 80 00 	mov    0x806760(,%esi,4),%edx
+  803227:	85 d2                	test   %edx,%edx
+  803229:	74 e6                	je     803211 <mmap+0x7c>
+  80322b:	89 d1                	mov    %edx,%ecx
+  80322d:	03 0c b5 64 67 80 00 	add    0x806764(,%esi,4),%ecx
+  803234:	39 cf                	cmp    %ecx,%edi
+  803236:	73 d9                	jae    803211 <mmap+0x7c>
+  803238:	39 da                	cmp    %ebx,%edx
+  80323a:	73 d5                	jae    803211 <mmap+0x7c>
+  80323c:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  80323f:	8b 55 cc             	mov    -0x34(%ebp),%edx
+  803242:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  for (i = -1; i < NMMAP; i++) {
+  803245:	83 c2 01             	add    $0x1,%edx
+  803248:	83 c3 14             	add    $0x14,%ebx
+  80324b:	83 fa 10             	cmp    $0x10,%edx
+  80324e:	74 2b                	je     80327b <mmap+0xe6>
+    if (i >= 0 && !mmaps[i].mm_va)
+  803250:	85 d2                	test   %edx,%edx
+  803252:	78 b6                	js     80320a <mmap+0x75>
+  803254:	8b 3b                	mov    (%ebx),%edi
+  803256:	85 ff                	test   %edi,%edi
+  803258:	74 eb                	je     803245 <mmap+0xb0>
+    va = i < 0 ? MMAPBASE : mmaps[i].mm_va + mmaps[i].mm_len;
+  80325a:	03 7b 04             	add    0x4(%ebx),%edi
+    if (len > MMAPTOP - va)
+  80325d:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  803262:	29 f8                	sub    %edi,%eax
+  803264:	39 c8                	cmp    %ecx,%eax
+  803266:	72 dd                	jb     803245 <mmap+0xb0>
+    for (j = 0; j < NMMAP; j++)
+  803268:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+          mmaps[j].mm_va < va + len)
+  80326b:	8d 34 0f             	lea    (%edi,%ecx,1),%esi
+  80326e:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  803271:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  803274:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+  803277:	89 f3                	mov    %esi,%ebx
+  803279:	eb a2                	jmp    80321d <mmap+0x88>
+        break;
+    if (j == NMMAP)
+      break;
+  }
+  if (i == NMMAP)
+    return -E_NO_MEM;
+  80327b:	c7 45 d4 fc ff ff ff 	movl   $0xfffffffc,-0x2c(%ebp)
+  803282:	eb 75                	jmp    8032f9 <mmap+0x164>
+    ;
+  if (j == NMMAP)
+    return -E_NO_MEM;
+
+  if (_pgfault_handler == 0)
+    set_pgfault_handler(mmap_pgfault);
+  803284:	83 ec 0c             	sub    $0xc,%esp
+  803287:	68 5d 31 80 00       	push   $0x80315d
+  80328c:	e8 f7 03 00 00       	call   803688 <set_pgfault_handler>
+  803291:	83 c4 10             	add    $0x10,%esp
+  803294:	eb 24                	jmp    8032ba <mmap+0x125>
+    return -E_INVAL;
+  803296:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  80329d:	eb 5a                	jmp    8032f9 <mmap+0x164>
+  80329f:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  8032a6:	eb 51                	jmp    8032f9 <mmap+0x164>
+  8032a8:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  8032af:	eb 48                	jmp    8032f9 <mmap+0x164>
+  if (_pgfault_handler == 0)
+  8032b1:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  8032b8:	74 ca                	je     803284 <mmap+0xef>
+
+  mmaps[j].mm_va = va;
+  8032ba:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  8032c1:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  8032c4:	c1 e2 02             	shl    $0x2,%edx
+  8032c7:	89 ba 60 67 80 00    	mov    %edi,0x806760(%edx)
+  mmaps[j].mm_len = len;
+  8032cd:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  8032d0:	89 b2 64 67 80 00    	mov    %esi,0x806764(%edx)
+  mmaps[j].mm_fd = fdnum;
+  8032d6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8032d9:	89 b2 68 67 80 00    	mov    %esi,0x806768(%edx)
+  mmaps[j].mm_offset = offset;
+  8032df:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8032e2:	89 b2 6c 67 80 00    	mov    %esi,0x80676c(%edx)
+  mmaps[j].mm_perm = perm;
+  8032e8:	01 d8                	add    %ebx,%eax
+  8032ea:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  8032ed:	89 1c 85 70 67 80 00 	mov    %ebx,0x806770(,%eax,4)
+  *addr = (void *) va;
+  8032f4:	8b 45 18             	mov    0x18(%ebp),%eax
+  8032f7:	89 38                	mov    %edi,(%eax)
+  return 0;
+}
+  8032f9:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  8032fc:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8032ff:	5b                   	pop    %ebx
+  803300:	5e                   	pop    %esi
+  803301:	5f                   	pop    %edi
+  803302:	5d                   	pop    %ebp
+  803303:	c3                   	ret
+  if (i == NMMAP)
+  803304:	b8 60 67 80 00       	mov    $0x806760,%eax
+  for (j = 0; j < NMMAP && mmaps[j].mm_va; j++)
+  803309:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+  80330c:	83 c0 14             	add    $0x14,%eax
+  80330f:	83 78 ec 00          	cmpl   $0x0,-0x14(%eax)
+  803313:	74 9c                	je     8032b1 <mmap+0x11c>
+  803315:	83 c3 01             	add    $0x1,%ebx
+  803318:	83 fb 10             	cmp    $0x10,%ebx
+  80331b:	75 ef                	jne    80330c <mmap+0x177>
+    return -E_NO_MEM;
+  80331d:	c7 45 d4 fc ff ff ff 	movl   $0xfffffffc,-0x2c(%ebp)
+  803324:	eb d3                	jmp    8032f9 <mmap+0x164>
+
+00803326 <msync>:
+// nothing for other kinds of mapping.
+//
+// Returns 0 on success, < 0 on error.
+int
+msync(void *addr)
+{
+  803326:	55                   	push   %ebp
+  803327:	89 e5                	mov    %esp,%ebp
+  803329:	57                   	push   %edi
+  80332a:	56                   	push   %esi
+  80332b:	53                   	push   %ebx
+  80332c:	81 ec ac 00 00 00    	sub    $0xac,%esp
+  struct Stat st;
+  off_t saved, off;
+  uintptr_t va;
+  int n, r;
+
+  if ((m = mmap_find((uintptr_t) addr)) == NULL)
+  803332:	8b 45 08             	mov    0x8(%ebp),%eax
+  803335:	e8 c6 fb ff ff       	call   802f00 <mmap_find>
+  80333a:	85 c0                	test   %eax,%eax
+  80333c:	0f 84 58 01 00 00    	je     80349a <msync+0x174>
+  803342:	89 c7                	mov    %eax,%edi
+    return -E_INVAL;
+  if (m->mm_perm != MAP_SHARED)
+    return 0;
+  803344:	bb 00 00 00 00       	mov    $0x0,%ebx
+  if (m->mm_perm != MAP_SHARED)
+  803349:	83 78 10 02          	cmpl   $0x2,0x10(%eax)
+  80334d:	74 0a                	je     803359 <msync+0x33>
+                          PTE_P | PTE_U | PTE_W)) < 0)
+      break;
+  }
+  fd->fd_offset = saved;
+  return r < 0 ? r : 0;
+}
+  80334f:	89 d8                	mov    %ebx,%eax
+  803351:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803354:	5b                   	pop    %ebx
+  803355:	5e                   	pop    %esi
+  803356:	5f                   	pop    %edi
+  803357:	5d                   	pop    %ebp
+  803358:	c3                   	ret
+  if ((r = fd_lookup(m->mm_fd, &fd)) < 0 || (r = fstat(m->mm_fd, &st)) < 0)
+  803359:	83 ec 08             	sub    $0x8,%esp
+  80335c:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80335f:	50                   	push   %eax
+  803360:	ff 77 08             	push   0x8(%edi)
+  803363:	e8 24 e3 ff ff       	call   80168c <fd_lookup>
+  803368:	89 c3                	mov    %eax,%ebx
+  80336a:	83 c4 10             	add    $0x10,%esp
+  80336d:	85 c0                	test   %eax,%eax
+  80336f:	78 de                	js     80334f <msync+0x29>
+  803371:	83 ec 08             	sub    $0x8,%esp
+  803374:	8d 85 58 ff ff ff    	lea    -0xa8(%ebp),%eax
+  80337a:	50                   	push   %eax
+  80337b:	ff 77 08             	push   0x8(%edi)
+  80337e:	e8 ac e7 ff ff       	call   801b2f <fstat>
+  803383:	89 c3                	mov    %eax,%ebx
+  803385:	83 c4 10             	add    $0x10,%esp
+  803388:	85 c0                	test   %eax,%eax
+  80338a:	78 c3                	js     80334f <msync+0x29>
+  saved = fd->fd_offset;
+  80338c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80338f:	8b 40 04             	mov    0x4(%eax),%eax
+  803392:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%ebp)
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE) {
+  803398:	8b 37                	mov    (%edi),%esi
+  80339a:	eb 29                	jmp    8033c5 <msync+0x9f>
+    if ((r = sys_page_map(0, (void *) va, 0, (void *) va,
+  80339c:	83 ec 0c             	sub    $0xc,%esp
+  80339f:	6a 07                	push   $0x7
+  8033a1:	8b 85 50 ff ff ff    	mov    -0xb0(%ebp),%eax
+  8033a7:	50                   	push   %eax
+  8033a8:	6a 00                	push   $0x0
+  8033aa:	50                   	push   %eax
+  8033ab:	6a 00                	push   $0x0
+  8033ad:	e8 c0 d9 ff ff       	call   800d72 <sys_page_map>
+  8033b2:	89 c3                	mov    %eax,%ebx
+  8033b4:	83 c4 20             	add    $0x20,%esp
+  8033b7:	85 c0                	test   %eax,%eax
+  8033b9:	0f 88 c0 00 00 00    	js     80347f <msync+0x159>
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE) {
+  8033bf:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8033c5:	8b 07                	mov    (%edi),%eax
+  8033c7:	89 85 54 ff ff ff    	mov    %eax,-0xac(%ebp)
+  8033cd:	03 47 04             	add    0x4(%edi),%eax
+  8033d0:	39 c6                	cmp    %eax,%esi
+  8033d2:	0f 83 a7 00 00 00    	jae    80347f <msync+0x159>
+    if (!va_mapped(va) || !(uvpt[PGNUM(va)] & PTE_D))
+  8033d8:	89 f0                	mov    %esi,%eax
+  8033da:	e8 63 fb ff ff       	call   802f42 <va_mapped>
+  8033df:	84 c0                	test   %al,%al
+  8033e1:	74 dc                	je     8033bf <msync+0x99>
+  8033e3:	89 f0                	mov    %esi,%eax
+  8033e5:	c1 e8 0c             	shr    $0xc,%eax
+  8033e8:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8033ef:	a8 40                	test   $0x40,%al
+  8033f1:	74 cc                	je     8033bf <msync+0x99>
+    off = m->mm_offset + (va - m->mm_va);
+  8033f3:	8b 47 0c             	mov    0xc(%edi),%eax
+  8033f6:	8b 8d 54 ff ff ff    	mov    -0xac(%ebp),%ecx
+  8033fc:	29 c8                	sub    %ecx,%eax
+  8033fe:	01 f0                	add    %esi,%eax
+    if (off >= st.st_size)
+  803400:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  803403:	39 c2                	cmp    %eax,%edx
+  803405:	7e 78                	jle    80347f <msync+0x159>
+    n = MIN(PGSIZE, st.st_size - off);
+  803407:	29 c2                	sub    %eax,%edx
+  803409:	89 d1                	mov    %edx,%ecx
+  80340b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803410:	39 d1                	cmp    %edx,%ecx
+  803412:	0f 4e d1             	cmovle %ecx,%edx
+  803415:	89 95 54 ff ff ff    	mov    %edx,-0xac(%ebp)
+    if ((r = seek(m->mm_fd, off)) < 0 ||
+  80341b:	83 ec 08             	sub    $0x8,%esp
+  80341e:	50                   	push   %eax
+  80341f:	ff 77 08             	push   0x8(%edi)
+  803422:	e8 60 e6 ff ff       	call   801a87 <seek>
+  803427:	89 c3                	mov    %eax,%ebx
+  803429:	83 c4 10             	add    $0x10,%esp
+  80342c:	85 c0                	test   %eax,%eax
+  80342e:	78 4f                	js     80347f <msync+0x159>
+        (r = write(m->mm_fd, (void *) va, n)) < 0)
+  803430:	89 b5 50 ff ff ff    	mov    %esi,-0xb0(%ebp)
+  803436:	83 ec 04             	sub    $0x4,%esp
+  803439:	ff b5 54 ff ff ff    	push   -0xac(%ebp)
+  80343f:	56                   	push   %esi
+  803440:	ff 77 08             	push   0x8(%edi)
+  803443:	e8 bd e5 ff ff       	call   801a05 <write>
+  803448:	89 c3                	mov    %eax,%ebx
+    if ((r = seek(m->mm_fd, off)) < 0 ||
+  80344a:	83 c4 10             	add    $0x10,%esp
+  80344d:	85 c0                	test   %eax,%eax
+  80344f:	78 2e                	js     80347f <msync+0x159>
+    if (r < n && (r = write(m->mm_fd, (char *) va + r, n - r)) < 0)
+  803451:	8b 95 54 ff ff ff    	mov    -0xac(%ebp),%edx
+  803457:	39 c2                	cmp    %eax,%edx
+  803459:	0f 8e 3d ff ff ff    	jle    80339c <msync+0x76>
+  80345f:	89 d0                	mov    %edx,%eax
+  803461:	29 d8                	sub    %ebx,%eax
+  803463:	01 f3                	add    %esi,%ebx
+  803465:	83 ec 04             	sub    $0x4,%esp
+  803468:	50                   	push   %eax
+  803469:	53                   	push   %ebx
+  80346a:	ff 77 08             	push   0x8(%edi)
+  80346d:	e8 93 e5 ff ff       	call   801a05 <write>
+  803472:	89 c3                	mov    %eax,%ebx
+  803474:	83 c4 10             	add    $0x10,%esp
+  803477:	85 c0                	test   %eax,%eax
+  803479:	0f 89 1d ff ff ff    	jns    80339c <msync+0x76>
+  fd->fd_offset = saved;
+  80347f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803482:	8b 8d 4c ff ff ff    	mov    -0xb4(%ebp),%ecx
+  803488:	89 48 04             	mov    %ecx,0x4(%eax)
+  return r < 0 ? r : 0;
+  80348b:	85 db                	test   %ebx,%ebx
+  80348d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803492:	0f 4f d8             	cmovg  %eax,%ebx
+  803495:	e9 b5 fe ff ff       	jmp    80334f <msync+0x29>
+    return -E_INVAL;
+  80349a:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  80349f:	e9 ab fe ff ff       	jmp    80334f <msync+0x29>
+
+008034a4 <munmap>:
+// Remove the mapping at 'addr', writing a MAP_SHARED one back first.
+//
+// Returns 0 on success, < 0 on error.
+int
+munmap(void *addr)
+{
+  8034a4:	55                   	push   %ebp
+  8034a5:	89 e5                	mov    %esp,%ebp
+  8034a7:	56                   	push   %esi
+  8034a8:	53                   	push   %ebx
+  8034a9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct Mmap *m;
+  uintptr_t va;
+  int r;
+
+  if ((m = mmap_find((uintptr_t) addr)) == NULL)
+  8034ac:	89 d8                	mov    %ebx,%eax
+  8034ae:	e8 4d fa ff ff       	call   802f00 <mmap_find>
+  8034b3:	85 c0                	test   %eax,%eax
+  8034b5:	74 56                	je     80350d <munmap+0x69>
+  8034b7:	89 c6                	mov    %eax,%esi
+    return -E_INVAL;
+  if ((r = msync(addr)) < 0)
+  8034b9:	83 ec 0c             	sub    $0xc,%esp
+  8034bc:	53                   	push   %ebx
+  8034bd:	e8 64 fe ff ff       	call   803326 <msync>
+  8034c2:	83 c4 10             	add    $0x10,%esp
+  8034c5:	85 c0                	test   %eax,%eax
+  8034c7:	78 3d                	js     803506 <munmap+0x62>
+    return r;
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE)
+  8034c9:	8b 1e                	mov    (%esi),%ebx
+  8034cb:	eb 06                	jmp    8034d3 <munmap+0x2f>
+  8034cd:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8034d3:	8b 46 04             	mov    0x4(%esi),%eax
+  8034d6:	03 06                	add    (%esi),%eax
+  8034d8:	39 c3                	cmp    %eax,%ebx
+  8034da:	73 1f                	jae    8034fb <munmap+0x57>
+    if (va_mapped(va) && (r = sys_page_unmap(0, (void *) va)) < 0)
+  8034dc:	89 d8                	mov    %ebx,%eax
+  8034de:	e8 5f fa ff ff       	call   802f42 <va_mapped>
+  8034e3:	84 c0                	test   %al,%al
+  8034e5:	74 e6                	je     8034cd <munmap+0x29>
+  8034e7:	83 ec 08             	sub    $0x8,%esp
+  8034ea:	53                   	push   %ebx
+  8034eb:	6a 00                	push   $0x0
+  8034ed:	e8 c2 d8 ff ff       	call   800db4 <sys_page_unmap>
+  8034f2:	83 c4 10             	add    $0x10,%esp
+  8034f5:	85 c0                	test   %eax,%eax
+  8034f7:	79 d4                	jns    8034cd <munmap+0x29>
+  8034f9:	eb 0b                	jmp    803506 <munmap+0x62>
+      return r;
+  m->mm_va = 0;
+  8034fb:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  return 0;
+  803501:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803506:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803509:	5b                   	pop    %ebx
+  80350a:	5e                   	pop    %esi
+  80350b:	5d                   	pop    %ebp
+  80350c:	c3                   	ret
+    return -E_INVAL;
+  80350d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803512:	eb f2                	jmp    803506 <munmap+0x62>
+
+00803514 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  803514:	b8 00 00 00 00       	mov    $0x0,%eax
+  803519:	c3                   	ret
+
+0080351a <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  80351a:	55                   	push   %ebp
+  80351b:	89 e5                	mov    %esp,%ebp
+  80351d:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  803520:	68 b7 41 80 00       	push   $0x8041b7
+  803525:	ff 75 0c             	push   0xc(%ebp)
+  803528:	e8 d3 d3 ff ff       	call   800900 <strcpy>
+  return 0;
+}
+  80352d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803532:	c9                   	leave
+  803533:	c3                   	ret
+
+00803534 <devcons_write>:
+{
+  803534:	55                   	push   %ebp
+  803535:	89 e5                	mov    %esp,%ebp
+  803537:	57                   	push   %edi
+  803538:	56                   	push   %esi
+  803539:	53                   	push   %ebx
+  80353a:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  803540:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  803545:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  80354b:	eb 2e                	jmp    80357b <devcons_write+0x47>
+    m = n - tot;
+  80354d:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803550:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  803552:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803557:	39 c3                	cmp    %eax,%ebx
+  803559:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  80355c:	83 ec 04             	sub    $0x4,%esp
+  80355f:	53                   	push   %ebx
+  803560:	89 f0                	mov    %esi,%eax
+  803562:	03 45 0c             	add    0xc(%ebp),%eax
+  803565:	50                   	push   %eax
+  803566:	57                   	push   %edi
+  803567:	e8 1a d5 ff ff       	call   800a86 <memmove>
+    sys_cputs(buf, m);
+  80356c:	83 c4 08             	add    $0x8,%esp
+  80356f:	53                   	push   %ebx
+  803570:	57                   	push   %edi
+  803571:	e8 ba d6 ff ff       	call   800c30 <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  803576:	01 de                	add    %ebx,%esi
+  803578:	83 c4 10             	add    $0x10,%esp
+  80357b:	3b 75 10             	cmp    0x10(%ebp),%esi
+  80357e:	72 cd                	jb     80354d <devcons_write+0x19>
+}
+  803580:	89 f0                	mov    %esi,%eax
+  803582:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803585:	5b                   	pop    %ebx
+  803586:	5e                   	pop    %esi
+  803587:	5f                   	pop    %edi
+  803588:	5d                   	pop    %ebp
+  803589:	c3                   	ret
+
+0080358a <devcons_read>:
+{
+  80358a:	55                   	push   %ebp
+  80358b:	89 e5                	mov    %esp,%ebp
+  80358d:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  803590:	b8 00 00 00 00       	mov    $0x0,%eax
+  803595:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803599:	75 07                	jne    8035a2 <devcons_read+0x18>
+  80359b:	eb 1f                	jmp    8035bc <devcons_read+0x32>
+    sys_yield();
+  80359d:	e8 2b d7 ff ff       	call   800ccd <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  8035a2:	e8 a7 d6 ff ff       	call   800c4e <sys_cgetc>
+  8035a7:	85 c0                	test   %eax,%eax
+  8035a9:	74 f2                	je     80359d <devcons_read+0x13>
+  if (c < 0)
+  8035ab:	78 0f                	js     8035bc <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  8035ad:	83 f8 04             	cmp    $0x4,%eax
+  8035b0:	74 0c                	je     8035be <devcons_read+0x34>
+  *(char*)vbuf = c;
+  8035b2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8035b5:	88 02                	mov    %al,(%edx)
+  return 1;
+  8035b7:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8035bc:	c9                   	leave
+  8035bd:	c3                   	ret
+    return 0;
+  8035be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035c3:	eb f7                	jmp    8035bc <devcons_read+0x32>
+
+008035c5 <cputchar>:
+{
+  8035c5:	55                   	push   %ebp
+  8035c6:	89 e5                	mov    %esp,%ebp
+  8035c8:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  8035cb:	8b 45 08             	mov    0x8(%ebp),%eax
+  8035ce:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  8035d1:	6a 01                	push   $0x1
+  8035d3:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8035d6:	50                   	push   %eax
+  8035d7:	e8 54 d6 ff ff       	call   800c30 <sys_cputs>
+}
+  8035dc:	83 c4 10             	add    $0x10,%esp
+  8035df:	c9                   	leave
+  8035e0:	c3                   	ret
+
+008035e1 <getchar>:
+{
+  8035e1:	55                   	push   %ebp
+  8035e2:	89 e5                	mov    %esp,%ebp
+  8035e4:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  8035e7:	6a 01                	push   $0x1
+  8035e9:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8035ec:	50                   	push   %eax
+  8035ed:	6a 00                	push   $0x0
+  8035ef:	e8 43 e3 ff ff       	call   801937 <read>
+  if (r < 0)
+  8035f4:	83 c4 10             	add    $0x10,%esp
+  8035f7:	85 c0                	test   %eax,%eax
+  8035f9:	78 06                	js     803601 <getchar+0x20>
+  if (r < 1)
+  8035fb:	74 06                	je     803603 <getchar+0x22>
+  return c;
+  8035fd:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803601:	c9                   	leave
+  803602:	c3                   	ret
+    return -E_EOF;
+  803603:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803608:	eb f7                	jmp    803601 <getchar+0x20>
+
+0080360a <iscons>:
+{
+  80360a:	55                   	push   %ebp
+  80360b:	89 e5                	mov    %esp,%ebp
+  80360d:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803610:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803613:	50                   	push   %eax
+  803614:	ff 75 08             	push   0x8(%ebp)
+  803617:	e8 70 e0 ff ff       	call   80168c <fd_lookup>
+  80361c:	83 c4 10             	add    $0x10,%esp
+  80361f:	85 c0                	test   %eax,%eax
+  803621:	78 11                	js     803634 <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  803623:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803626:	8b 15 3c 50 80 00    	mov    0x80503c,%edx
+  80362c:	39 10                	cmp    %edx,(%eax)
+  80362e:	0f 94 c0             	sete   %al
+  803631:	0f b6 c0             	movzbl %al,%eax
+}
+  803634:	c9                   	leave
+  803635:	c3                   	ret
+
+00803636 <opencons>:
+{
+  803636:	55                   	push   %ebp
+  803637:	89 e5                	mov    %esp,%ebp
+  803639:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  80363c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80363f:	50                   	push   %eax
+  803640:	e8 f1 df ff ff       	call   801636 <fd_alloc>
+  803645:	83 c4 10             	add    $0x10,%esp
+  803648:	85 c0                	test   %eax,%eax
+  80364a:	78 3a                	js     803686 <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80364c:	83 ec 04             	sub    $0x4,%esp
+  80364f:	68 07 04 00 00       	push   $0x407
+  803654:	ff 75 f4             	push   -0xc(%ebp)
+  803657:	6a 00                	push   $0x0
+  803659:	e8 d1 d6 ff ff       	call   800d2f <sys_page_alloc>
+  80365e:	83 c4 10             	add    $0x10,%esp
+  803661:	85 c0                	test   %eax,%eax
+  803663:	78 21                	js     803686 <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  803665:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803668:	8b 15 3c 50 80 00    	mov    0x80503c,%edx
+  80366e:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  803670:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803673:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  80367a:	83 ec 0c             	sub    $0xc,%esp
+  80367d:	50                   	push   %eax
+  80367e:	e8 8f df ff ff       	call   801612 <fd2num>
+  803683:	83 c4 10             	add    $0x10,%esp
+}
+  803686:	c9                   	leave
+  803687:	c3                   	ret
+
+00803688 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  803688:	55                   	push   %ebp
+  803689:	89 e5                	mov    %esp,%ebp
+  80368b:	53                   	push   %ebx
+  80368c:	83 ec 04             	sub    $0x4,%esp
+  int r;
+
+  if (_pgfault_handler == 0) {
+  80368f:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  803696:	74 0d                	je     8036a5 <set_pgfault_handler+0x1d>
+
+    sys_env_set_pgfault_upcall(id, _pgfault_upcall);
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  803698:	8b 45 08             	mov    0x8(%ebp),%eax
+  80369b:	a3 00 80 80 00       	mov    %eax,0x808000
+}
+  8036a0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8036a3:	c9                   	leave
+  8036a4:	c3                   	ret
+    envid_t id = sys_getenvid();
+  8036a5:	e8 04 d6 ff ff       	call   800cae <sys_getenvid>
+  8036aa:	89 c3                	mov    %eax,%ebx
+    sys_page_alloc(id, (void *) (UXSTACKTOP - PGSIZE), (PTE_P | PTE_U | PTE_W));
+  8036ac:	83 ec 04             	sub    $0x4,%esp
+  8036af:	6a 07                	push   $0x7
+  8036b1:	68 00 f0 bf ee       	push   $0xeebff000
+  8036b6:	50                   	push   %eax
+  8036b7:	e8 73 d6 ff ff       	call   800d2f <sys_page_alloc>
+    sys_env_set_pgfault_upcall(id, _pgfault_upcall);
+  8036bc:	83 c4 08             	add    $0x8,%esp
+  8036bf:	68 cf 36 80 00       	push   $0x8036cf
+  8036c4:	53                   	push   %ebx
+  8036c5:	e8 da d8 ff ff       	call   800fa4 <sys_env_set_pgfault_upcall>
+  8036ca:	83 c4 10             	add    $0x10,%esp
+  8036cd:	eb c9                	jmp    803698 <set_pgfault_handler+0x10>
+
+008036cf <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8036cf:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8036d0:	a1 00 80 80 00       	mov    0x808000,%eax
+	call *%eax
+  8036d5:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8036d7:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+  movl 48(%esp), %eax       // move trap time esp to eax
+  8036da:	8b 44 24 30          	mov    0x30(%esp),%eax
+  subl $4, %eax             // make room for eip on trap time esp
+  8036de:	83 e8 04             	sub    $0x4,%eax
+  movl %eax, 48(%esp)       // move value to esp
+  8036e1:	89 44 24 30          	mov    %eax,0x30(%esp)
+  movl 40(%esp), %ebx       // move trap time eip to ebx
+  8036e5:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+  movl %ebx, 0(%eax)
+  8036e9:	89 18                	mov    %ebx,(%eax)
+
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+  addl $0x08,%esp
+  8036eb:	83 c4 08             	add    $0x8,%esp
+  popal
+  8036ee:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+  addl $4, %esp          // skip tf->eip
+  8036ef:	83 c4 04             	add    $0x4,%esp
+  popf                 // pop stack value into flags register
+  8036f2:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+  popl %esp
+  8036f3:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+  ret
+  8036f4:	c3                   	ret
+
+008036f5 <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  8036f5:	55                   	push   %ebp
+  8036f6:	89 e5                	mov    %esp,%ebp
+  8036f8:	57                   	push   %edi
+  8036f9:	56                   	push   %esi
+  8036fa:	53                   	push   %ebx
+  8036fb:	83 ec 14             	sub    $0x14,%esp
+  8036fe:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803701:	8b 45 0c             	mov    0xc(%ebp),%eax
+  803704:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803707:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  80370a:	85 c0                	test   %eax,%eax
+  80370c:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803711:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  803714:	ff 33                	push   (%ebx)
+  803716:	50                   	push   %eax
+  803717:	e8 eb d8 ff ff       	call   801007 <sys_ipc_recv>
+  80371c:	83 c4 10             	add    $0x10,%esp
+  80371f:	85 c0                	test   %eax,%eax
+  803721:	78 39                	js     80375c <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  803723:	85 ff                	test   %edi,%edi
+  803725:	74 0a                	je     803731 <ipc_recv_pages+0x3c>
+  803727:	a1 a0 6c 80 00       	mov    0x806ca0,%eax
+  80372c:	8b 40 7c             	mov    0x7c(%eax),%eax
+  80372f:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803731:	85 f6                	test   %esi,%esi
+  803733:	74 0d                	je     803742 <ipc_recv_pages+0x4d>
+  803735:	a1 a0 6c 80 00       	mov    0x806ca0,%eax
+  80373a:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  803740:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  803742:	a1 a0 6c 80 00       	mov    0x806ca0,%eax
+  803747:	8b 40 74             	mov    0x74(%eax),%eax
+  80374a:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  80374c:	a1 a0 6c 80 00       	mov    0x806ca0,%eax
+  803751:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  803754:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803757:	5b                   	pop    %ebx
+  803758:	5e                   	pop    %esi
+  803759:	5f                   	pop    %edi
+  80375a:	5d                   	pop    %ebp
+  80375b:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  80375c:	85 ff                	test   %edi,%edi
+  80375e:	74 06                	je     803766 <ipc_recv_pages+0x71>
+  803760:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  803766:	85 f6                	test   %esi,%esi
+  803768:	74 06                	je     803770 <ipc_recv_pages+0x7b>
+  80376a:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  803770:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  803776:	eb dc                	jmp    803754 <ipc_recv_pages+0x5f>
+
+00803778 <ipc_recv>:
+{
+  803778:	55                   	push   %ebp
+  803779:	89 e5                	mov    %esp,%ebp
+  80377b:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  80377e:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  803785:	ff 75 10             	push   0x10(%ebp)
+  803788:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80378b:	50                   	push   %eax
+  80378c:	ff 75 0c             	push   0xc(%ebp)
+  80378f:	ff 75 08             	push   0x8(%ebp)
+  803792:	e8 5e ff ff ff       	call   8036f5 <ipc_recv_pages>
+}
+  803797:	c9                   	leave
+  803798:	c3                   	ret
+
+00803799 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  803799:	55                   	push   %ebp
+  80379a:	89 e5                	mov    %esp,%ebp
+  80379c:	57                   	push   %edi
+  80379d:	56                   	push   %esi
+  80379e:	53                   	push   %ebx
+  80379f:	83 ec 0c             	sub    $0xc,%esp
+  8037a2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8037a5:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8037a8:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  8037ab:	89 c3                	mov    %eax,%ebx
+  8037ad:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  8037b3:	85 c0                	test   %eax,%eax
+  8037b5:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8037ba:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  8037bd:	83 ec 0c             	sub    $0xc,%esp
+  8037c0:	ff 75 14             	push   0x14(%ebp)
+  8037c3:	ff 75 18             	push   0x18(%ebp)
+  8037c6:	53                   	push   %ebx
+  8037c7:	56                   	push   %esi
+  8037c8:	57                   	push   %edi
+  8037c9:	e8 18 d8 ff ff       	call   800fe6 <sys_ipc_try_send>
+  8037ce:	83 c4 20             	add    $0x20,%esp
+  8037d1:	85 c0                	test   %eax,%eax
+  8037d3:	79 1e                	jns    8037f3 <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  8037d5:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8037d8:	75 07                	jne    8037e1 <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  8037da:	e8 ee d4 ff ff       	call   800ccd <sys_yield>
+  8037df:	eb dc                	jmp    8037bd <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  8037e1:	50                   	push   %eax
+  8037e2:	68 c3 41 80 00       	push   $0x8041c3
+  8037e7:	6a 5c                	push   $0x5c
+  8037e9:	68 d0 41 80 00       	push   $0x8041d0
+  8037ee:	e8 44 ca ff ff       	call   800237 <_panic>
+  }
+}
+  8037f3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8037f6:	5b                   	pop    %ebx
+  8037f7:	5e                   	pop    %esi
+  8037f8:	5f                   	pop    %edi
+  8037f9:	5d                   	pop    %ebp
+  8037fa:	c3                   	ret
+
+008037fb <ipc_send>:
+{
+  8037fb:	55                   	push   %ebp
+  8037fc:	89 e5                	mov    %esp,%ebp
+  8037fe:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  803801:	ff 75 14             	push   0x14(%ebp)
+  803804:	6a 01                	push   $0x1
+  803806:	ff 75 10             	push   0x10(%ebp)
+  803809:	ff 75 0c             	push   0xc(%ebp)
+  80380c:	ff 75 08             	push   0x8(%ebp)
+  80380f:	e8 85 ff ff ff       	call   803799 <ipc_send_pages>
+}
+  803814:	83 c4 20             	add    $0x20,%esp
+  803817:	c9                   	leave
+  803818:	c3                   	ret
+
+00803819 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803819:	55                   	push   %ebp
+  80381a:	89 e5                	mov    %esp,%ebp
+  80381c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  80381f:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  803824:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803827:	c1 e0 04             	shl    $0x4,%eax
+  80382a:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80382f:	8b 40 50             	mov    0x50(%eax),%eax
+  803832:	39 c8                	cmp    %ecx,%eax
+  803834:	74 12                	je     803848 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  803836:	83 c2 01             	add    $0x1,%edx
+  803839:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  80383f:	75 e3                	jne    803824 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  803841:	b8 00 00 00 00       	mov    $0x0,%eax
+  803846:	eb 0e                	jmp    803856 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  803848:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80384b:	c1 e0 04             	shl    $0x4,%eax
+  80384e:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803853:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  803856:	5d                   	pop    %ebp
+  803857:	c3                   	ret
+
+00803858 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803858:	55                   	push   %ebp
+  803859:	89 e5                	mov    %esp,%ebp
+  80385b:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  80385e:	89 c2                	mov    %eax,%edx
+  803860:	c1 ea 16             	shr    $0x16,%edx
+  803863:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  80386a:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  80386f:	f6 c1 01             	test   $0x1,%cl
+  803872:	74 1c                	je     803890 <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  803874:	c1 e8 0c             	shr    $0xc,%eax
+  803877:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  80387e:	a8 01                	test   $0x1,%al
+  803880:	74 0e                	je     803890 <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  803882:	c1 e8 0c             	shr    $0xc,%eax
+  803885:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  80388c:	ef 
+  80388d:	0f b7 d2             	movzwl %dx,%edx
+}
+  803890:	89 d0                	mov    %edx,%eax
+  803892:	5d                   	pop    %ebp
+  803893:	c3                   	ret
+
+00803894 <udivmod>:
+  803894:	55                   	push   %ebp
+  803895:	57                   	push   %edi
+  803896:	56                   	push   %esi
+  803897:	53                   	push   %ebx
+  803898:	83 ec 14             	sub    $0x14,%esp
+  80389b:	8b 74 24 28          	mov    0x28(%esp),%esi
+  80389f:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  8038a3:	89 fb                	mov    %edi,%ebx
+  8038a5:	09 f3                	or     %esi,%ebx
+  8038a7:	0f 84 88 00 00 00    	je     803935 <udivmod+0xa1>
+  8038ad:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8038b2:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8038b9:	00 
+  8038ba:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8038c1:	00 
+  8038c2:	89 cd                	mov    %ecx,%ebp
+  8038c4:	89 34 24             	mov    %esi,(%esp)
+  8038c7:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  8038cb:	eb 08                	jmp    8038d5 <udivmod+0x41>
+  8038cd:	83 ed 01             	sub    $0x1,%ebp
+  8038d0:	83 fd ff             	cmp    $0xffffffff,%ebp
+  8038d3:	74 6c                	je     803941 <udivmod+0xad>
+  8038d5:	89 c3                	mov    %eax,%ebx
+  8038d7:	89 d6                	mov    %edx,%esi
+  8038d9:	89 e9                	mov    %ebp,%ecx
+  8038db:	0f ad f3             	shrd   %cl,%esi,%ebx
+  8038de:	d3 ee                	shr    %cl,%esi
+  8038e0:	f6 c1 20             	test   $0x20,%cl
+  8038e3:	74 04                	je     8038e9 <udivmod+0x55>
+  8038e5:	89 f3                	mov    %esi,%ebx
+  8038e7:	31 f6                	xor    %esi,%esi
+  8038e9:	8b 3c 24             	mov    (%esp),%edi
+  8038ec:	39 fb                	cmp    %edi,%ebx
+  8038ee:	89 f7                	mov    %esi,%edi
+  8038f0:	8b 1c 24             	mov    (%esp),%ebx
+  8038f3:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8038f7:	19 f7                	sbb    %esi,%edi
+  8038f9:	72 d2                	jb     8038cd <udivmod+0x39>
+  8038fb:	89 f7                	mov    %esi,%edi
+  8038fd:	89 de                	mov    %ebx,%esi
+  8038ff:	89 e9                	mov    %ebp,%ecx
+  803901:	0f a5 f7             	shld   %cl,%esi,%edi
+  803904:	d3 e6                	shl    %cl,%esi
+  803906:	f6 c1 20             	test   $0x20,%cl
+  803909:	74 04                	je     80390f <udivmod+0x7b>
+  80390b:	89 f7                	mov    %esi,%edi
+  80390d:	31 f6                	xor    %esi,%esi
+  80390f:	29 f0                	sub    %esi,%eax
+  803911:	19 fa                	sbb    %edi,%edx
+  803913:	be 01 00 00 00       	mov    $0x1,%esi
+  803918:	bf 00 00 00 00       	mov    $0x0,%edi
+  80391d:	0f a5 f7             	shld   %cl,%esi,%edi
+  803920:	d3 e6                	shl    %cl,%esi
+  803922:	f6 c1 20             	test   $0x20,%cl
+  803925:	74 04                	je     80392b <udivmod+0x97>
+  803927:	89 f7                	mov    %esi,%edi
+  803929:	31 f6                	xor    %esi,%esi
+  80392b:	09 74 24 08          	or     %esi,0x8(%esp)
+  80392f:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  803933:	eb 98                	jmp    8038cd <udivmod+0x39>
+  803935:	89 f0                	mov    %esi,%eax
+  803937:	89 fa                	mov    %edi,%edx
+  803939:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80393d:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  803941:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  803945:	89 01                	mov    %eax,(%ecx)
+  803947:	89 51 04             	mov    %edx,0x4(%ecx)
+  80394a:	8b 44 24 08          	mov    0x8(%esp),%eax
+  80394e:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803952:	83 c4 14             	add    $0x14,%esp
+  803955:	5b                   	pop    %ebx
+  803956:	5e                   	pop    %esi
+  803957:	5f                   	pop    %edi
+  803958:	5d                   	pop    %ebp
+  803959:	c3                   	ret
+
+0080395a <__udivdi3>:
+  80395a:	83 ec 18             	sub    $0x18,%esp
+  80395d:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803961:	50                   	push   %eax
+  803962:	ff 74 24 2c          	push   0x2c(%esp)
+  803966:	ff 74 24 2c          	push   0x2c(%esp)
+  80396a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80396e:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803972:	e8 1d ff ff ff       	call   803894 <udivmod>
+  803977:	83 c4 24             	add    $0x24,%esp
+  80397a:	c3                   	ret
+
+0080397b <__umoddi3>:
+  80397b:	83 ec 18             	sub    $0x18,%esp
+  80397e:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803982:	50                   	push   %eax
+  803983:	ff 74 24 2c          	push   0x2c(%esp)
+  803987:	ff 74 24 2c          	push   0x2c(%esp)
+  80398b:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80398f:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803993:	e8 fc fe ff ff       	call   803894 <udivmod>
+  803998:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80399c:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  8039a0:	83 c4 24             	add    $0x24,%esp
+  8039a3:	c3                   	ret
+
+008039a4 <__divdi3>:
+  8039a4:	56                   	push   %esi
+  8039a5:	53                   	push   %ebx
+  8039a6:	83 ec 14             	sub    $0x14,%esp
+  8039a9:	8b 44 24 20          	mov    0x20(%esp),%eax
+  8039ad:	8b 54 24 24          	mov    0x24(%esp),%edx
+  8039b1:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  8039b5:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  8039b9:	85 d2                	test   %edx,%edx
+  8039bb:	78 18                	js     8039d5 <__divdi3+0x31>
+  8039bd:	85 db                	test   %ebx,%ebx
+  8039bf:	78 3e                	js     8039ff <__divdi3+0x5b>
+  8039c1:	83 ec 04             	sub    $0x4,%esp
+  8039c4:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8039c8:	56                   	push   %esi
+  8039c9:	53                   	push   %ebx
+  8039ca:	51                   	push   %ecx
+  8039cb:	e8 c4 fe ff ff       	call   803894 <udivmod>
+  8039d0:	83 c4 10             	add    $0x10,%esp
+  8039d3:	eb 24                	jmp    8039f9 <__divdi3+0x55>
+  8039d5:	f7 d8                	neg    %eax
+  8039d7:	83 d2 00             	adc    $0x0,%edx
+  8039da:	f7 da                	neg    %edx
+  8039dc:	85 db                	test   %ebx,%ebx
+  8039de:	78 3a                	js     803a1a <__divdi3+0x76>
+  8039e0:	83 ec 04             	sub    $0x4,%esp
+  8039e3:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8039e7:	56                   	push   %esi
+  8039e8:	53                   	push   %ebx
+  8039e9:	51                   	push   %ecx
+  8039ea:	e8 a5 fe ff ff       	call   803894 <udivmod>
+  8039ef:	83 c4 10             	add    $0x10,%esp
+  8039f2:	f7 d8                	neg    %eax
+  8039f4:	83 d2 00             	adc    $0x0,%edx
+  8039f7:	f7 da                	neg    %edx
+  8039f9:	83 c4 14             	add    $0x14,%esp
+  8039fc:	5b                   	pop    %ebx
+  8039fd:	5e                   	pop    %esi
+  8039fe:	c3                   	ret
+  8039ff:	83 ec 04             	sub    $0x4,%esp
+  803a02:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803a06:	56                   	push   %esi
+  803a07:	f7 d9                	neg    %ecx
+  803a09:	83 d3 00             	adc    $0x0,%ebx
+  803a0c:	f7 db                	neg    %ebx
+  803a0e:	53                   	push   %ebx
+  803a0f:	51                   	push   %ecx
+  803a10:	e8 7f fe ff ff       	call   803894 <udivmod>
+  803a15:	83 c4 10             	add    $0x10,%esp
+  803a18:	eb d8                	jmp    8039f2 <__divdi3+0x4e>
+  803a1a:	83 ec 04             	sub    $0x4,%esp
+  803a1d:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803a21:	56                   	push   %esi
+  803a22:	f7 d9                	neg    %ecx
+  803a24:	83 d3 00             	adc    $0x0,%ebx
+  803a27:	f7 db                	neg    %ebx
+  803a29:	53                   	push   %ebx
+  803a2a:	51                   	push   %ecx
+  803a2b:	e8 64 fe ff ff       	call   803894 <udivmod>
+  803a30:	83 c4 10             	add    $0x10,%esp
+  803a33:	eb c4                	jmp    8039f9 <__divdi3+0x55>
+
+00803a35 <__moddi3>:
+  803a35:	55                   	push   %ebp
+  803a36:	57                   	push   %edi
+  803a37:	56                   	push   %esi
+  803a38:	53                   	push   %ebx
+  803a39:	83 ec 24             	sub    $0x24,%esp
+  803a3c:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803a40:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803a44:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  803a48:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  803a4c:	85 d2                	test   %edx,%edx
+  803a4e:	78 3b                	js     803a8b <__moddi3+0x56>
+  803a50:	83 ec 04             	sub    $0x4,%esp
+  803a53:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803a57:	56                   	push   %esi
+  803a58:	89 ce                	mov    %ecx,%esi
+  803a5a:	f7 de                	neg    %esi
+  803a5c:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803a60:	89 de                	mov    %ebx,%esi
+  803a62:	83 d6 00             	adc    $0x0,%esi
+  803a65:	f7 de                	neg    %esi
+  803a67:	89 74 24 14          	mov    %esi,0x14(%esp)
+  803a6b:	8b 74 24 08          	mov    0x8(%esp),%esi
+  803a6f:	0f 48 f1             	cmovs  %ecx,%esi
+  803a72:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  803a77:	53                   	push   %ebx
+  803a78:	56                   	push   %esi
+  803a79:	e8 16 fe ff ff       	call   803894 <udivmod>
+  803a7e:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803a82:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803a86:	83 c4 10             	add    $0x10,%esp
+  803a89:	eb 47                	jmp    803ad2 <__moddi3+0x9d>
+  803a8b:	f7 d8                	neg    %eax
+  803a8d:	83 d2 00             	adc    $0x0,%edx
+  803a90:	f7 da                	neg    %edx
+  803a92:	83 ec 04             	sub    $0x4,%esp
+  803a95:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803a99:	56                   	push   %esi
+  803a9a:	89 cf                	mov    %ecx,%edi
+  803a9c:	f7 df                	neg    %edi
+  803a9e:	89 de                	mov    %ebx,%esi
+  803aa0:	83 d6 00             	adc    $0x0,%esi
+  803aa3:	f7 de                	neg    %esi
+  803aa5:	0f 49 cf             	cmovns %edi,%ecx
+  803aa8:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  803aac:	0f 49 de             	cmovns %esi,%ebx
+  803aaf:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  803ab3:	ff 74 24 0c          	push   0xc(%esp)
+  803ab7:	ff 74 24 0c          	push   0xc(%esp)
+  803abb:	e8 d4 fd ff ff       	call   803894 <udivmod>
+  803ac0:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803ac4:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803ac8:	f7 d8                	neg    %eax
+  803aca:	83 d2 00             	adc    $0x0,%edx
+  803acd:	f7 da                	neg    %edx
+  803acf:	83 c4 10             	add    $0x10,%esp
+  803ad2:	83 c4 24             	add    $0x24,%esp
+  803ad5:	5b                   	pop    %ebx
+  803ad6:	5e                   	pop    %esi
+  803ad7:	5f                   	pop    %edi
+  803ad8:	5d                   	pop    %ebp
+  803ad9:	c3                   	ret
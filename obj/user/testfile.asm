@@ -0,0 +1,6921 @@
+
+obj/user/testfile.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 4e 06 00 00       	call   80067f <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <xopen>:
+
+#define FVA ((struct Fd*)0xCCCCC000)
+
+static int
+xopen(const char *path, int mode)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 0c             	sub    $0xc,%esp
+  80003a:	89 d3                	mov    %edx,%ebx
+  extern union Fsipc fsipcbuf;
+  envid_t fsenv;
+
+  strcpy(fsipcbuf.open.req_path, path);
+  80003c:	50                   	push   %eax
+  80003d:	68 00 60 80 00       	push   $0x806000
+  800042:	e8 6e 0d 00 00       	call   800db5 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  800047:	89 1d 00 64 80 00    	mov    %ebx,0x806400
+
+  fsenv = ipc_find_env(ENV_TYPE_FS);
+  80004d:	c7 04 24 01 00 00 00 	movl   $0x1,(%esp)
+  800054:	e8 5e 17 00 00       	call   8017b7 <ipc_find_env>
+  ipc_send(fsenv, FSREQ_OPEN, &fsipcbuf, PTE_P | PTE_W | PTE_U);
+  800059:	6a 07                	push   $0x7
+  80005b:	68 00 60 80 00       	push   $0x806000
+  800060:	6a 01                	push   $0x1
+  800062:	50                   	push   %eax
+  800063:	e8 31 17 00 00       	call   801799 <ipc_send>
+  return ipc_recv(NULL, FVA, NULL);
+  800068:	83 c4 1c             	add    $0x1c,%esp
+  80006b:	6a 00                	push   $0x0
+  80006d:	68 00 c0 cc cc       	push   $0xccccc000
+  800072:	6a 00                	push   $0x0
+  800074:	e8 9d 16 00 00       	call   801716 <ipc_recv>
+}
+  800079:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80007c:	c9                   	leave
+  80007d:	c3                   	ret
+
+0080007e <umain>:
+
+void
+umain(int argc, char **argv)
+{
+  80007e:	55                   	push   %ebp
+  80007f:	89 e5                	mov    %esp,%ebp
+  800081:	57                   	push   %edi
+  800082:	56                   	push   %esi
+  800083:	53                   	push   %ebx
+  800084:	81 ec ac 02 00 00    	sub    $0x2ac,%esp
+  struct Fd fdcopy;
+  struct Stat st;
+  char buf[512];
+
+  // We open files manually first, to avoid the FD layer
+  if ((r = xopen("/not-found", O_RDONLY)) < 0 && r != -E_NOT_FOUND)
+  80008a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80008f:	b8 a0 34 80 00       	mov    $0x8034a0,%eax
+  800094:	e8 9a ff ff ff       	call   800033 <xopen>
+  800099:	85 c0                	test   %eax,%eax
+  80009b:	0f 89 fa 03 00 00    	jns    80049b <umain+0x41d>
+  8000a1:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  8000a4:	0f 85 df 03 00 00    	jne    800489 <umain+0x40b>
+    panic("serve_open /not-found: %e", r);
+  else if (r >= 0)
+    panic("serve_open /not-found succeeded!");
+
+  if ((r = xopen("/newmotd", O_RDONLY)) < 0)
+  8000aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000af:	b8 d5 34 80 00       	mov    $0x8034d5,%eax
+  8000b4:	e8 7a ff ff ff       	call   800033 <xopen>
+  8000b9:	85 c0                	test   %eax,%eax
+  8000bb:	0f 88 ee 03 00 00    	js     8004af <umain+0x431>
+    panic("serve_open /newmotd: %e", r);
+  if (FVA->fd_dev_id != 'f' || FVA->fd_offset != 0 || FVA->fd_omode != O_RDONLY)
+  8000c1:	83 3d 00 c0 cc cc 66 	cmpl   $0x66,0xccccc000
+  8000c8:	0f 85 f3 03 00 00    	jne    8004c1 <umain+0x443>
+  8000ce:	83 3d 04 c0 cc cc 00 	cmpl   $0x0,0xccccc004
+  8000d5:	0f 85 e6 03 00 00    	jne    8004c1 <umain+0x443>
+  8000db:	83 3d 08 c0 cc cc 00 	cmpl   $0x0,0xccccc008
+  8000e2:	0f 85 d9 03 00 00    	jne    8004c1 <umain+0x443>
+    panic("serve_open did not fill struct Fd correctly\n");
+  cprintf("serve_open is good\n");
+  8000e8:	83 ec 0c             	sub    $0xc,%esp
+  8000eb:	68 f6 34 80 00       	push   $0x8034f6
+  8000f0:	e8 d2 06 00 00       	call   8007c7 <cprintf>
+
+  if ((r = devfile.dev_stat(FVA, &st)) < 0)
+  8000f5:	83 c4 08             	add    $0x8,%esp
+  8000f8:	8d 85 4c ff ff ff    	lea    -0xb4(%ebp),%eax
+  8000fe:	50                   	push   %eax
+  8000ff:	68 00 c0 cc cc       	push   $0xccccc000
+  800104:	ff 15 1c 40 80 00    	call   *0x80401c
+  80010a:	83 c4 10             	add    $0x10,%esp
+  80010d:	85 c0                	test   %eax,%eax
+  80010f:	0f 88 c0 03 00 00    	js     8004d5 <umain+0x457>
+    panic("file_stat: %e", r);
+  if (strlen(msg) != st.st_size)
+  800115:	83 ec 0c             	sub    $0xc,%esp
+  800118:	ff 35 00 40 80 00    	push   0x804000
+  80011e:	e8 57 0c 00 00       	call   800d7a <strlen>
+  800123:	83 c4 10             	add    $0x10,%esp
+  800126:	3b 45 cc             	cmp    -0x34(%ebp),%eax
+  800129:	0f 85 b8 03 00 00    	jne    8004e7 <umain+0x469>
+    panic("file_stat returned size %d wanted %d\n", st.st_size, strlen(msg));
+  cprintf("file_stat is good\n");
+  80012f:	83 ec 0c             	sub    $0xc,%esp
+  800132:	68 18 35 80 00       	push   $0x803518
+  800137:	e8 8b 06 00 00       	call   8007c7 <cprintf>
+
+  memset(buf, 0, sizeof buf);
+  80013c:	83 c4 0c             	add    $0xc,%esp
+  80013f:	68 00 02 00 00       	push   $0x200
+  800144:	6a 00                	push   $0x0
+  800146:	8d 9d 4c fd ff ff    	lea    -0x2b4(%ebp),%ebx
+  80014c:	53                   	push   %ebx
+  80014d:	e8 b4 0d 00 00       	call   800f06 <memset>
+  if ((r = devfile.dev_read(FVA, buf, sizeof buf)) < 0)
+  800152:	83 c4 0c             	add    $0xc,%esp
+  800155:	68 00 02 00 00       	push   $0x200
+  80015a:	53                   	push   %ebx
+  80015b:	68 00 c0 cc cc       	push   $0xccccc000
+  800160:	ff 15 10 40 80 00    	call   *0x804010
+  800166:	83 c4 10             	add    $0x10,%esp
+  800169:	85 c0                	test   %eax,%eax
+  80016b:	0f 88 9b 03 00 00    	js     80050c <umain+0x48e>
+    panic("file_read: %e", r);
+  if (strcmp(buf, msg) != 0)
+  800171:	83 ec 08             	sub    $0x8,%esp
+  800174:	ff 35 00 40 80 00    	push   0x804000
+  80017a:	8d 85 4c fd ff ff    	lea    -0x2b4(%ebp),%eax
+  800180:	50                   	push   %eax
+  800181:	e8 e0 0c 00 00       	call   800e66 <strcmp>
+  800186:	83 c4 10             	add    $0x10,%esp
+  800189:	85 c0                	test   %eax,%eax
+  80018b:	0f 85 8d 03 00 00    	jne    80051e <umain+0x4a0>
+    panic("file_read returned wrong data");
+  cprintf("file_read is good\n");
+  800191:	83 ec 0c             	sub    $0xc,%esp
+  800194:	68 57 35 80 00       	push   $0x803557
+  800199:	e8 29 06 00 00       	call   8007c7 <cprintf>
+
+  if ((r = devfile.dev_close(FVA)) < 0)
+  80019e:	c7 04 24 00 c0 cc cc 	movl   $0xccccc000,(%esp)
+  8001a5:	ff 15 18 40 80 00    	call   *0x804018
+  8001ab:	83 c4 10             	add    $0x10,%esp
+  8001ae:	85 c0                	test   %eax,%eax
+  8001b0:	0f 88 7c 03 00 00    	js     800532 <umain+0x4b4>
+    panic("file_close: %e", r);
+  cprintf("file_close is good\n");
+  8001b6:	83 ec 0c             	sub    $0xc,%esp
+  8001b9:	68 79 35 80 00       	push   $0x803579
+  8001be:	e8 04 06 00 00       	call   8007c7 <cprintf>
+
+  // We're about to unmap the FD, but still need a way to get
+  // the stale filenum to serve_read, so we make a local copy.
+  // The file server won't think it's stale until we unmap the
+  // FD page.
+  fdcopy = *FVA;
+  8001c3:	a1 00 c0 cc cc       	mov    0xccccc000,%eax
+  8001c8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8001cb:	a1 04 c0 cc cc       	mov    0xccccc004,%eax
+  8001d0:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  8001d3:	a1 08 c0 cc cc       	mov    0xccccc008,%eax
+  8001d8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8001db:	a1 0c c0 cc cc       	mov    0xccccc00c,%eax
+  8001e0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  sys_page_unmap(0, FVA);
+  8001e3:	83 c4 08             	add    $0x8,%esp
+  8001e6:	68 00 c0 cc cc       	push   $0xccccc000
+  8001eb:	6a 00                	push   $0x0
+  8001ed:	e8 77 10 00 00       	call   801269 <sys_page_unmap>
+
+  if ((r = devfile.dev_read(&fdcopy, buf, sizeof buf)) != -E_INVAL)
+  8001f2:	83 c4 0c             	add    $0xc,%esp
+  8001f5:	68 00 02 00 00       	push   $0x200
+  8001fa:	8d 85 4c fd ff ff    	lea    -0x2b4(%ebp),%eax
+  800200:	50                   	push   %eax
+  800201:	8d 45 d8             	lea    -0x28(%ebp),%eax
+  800204:	50                   	push   %eax
+  800205:	ff 15 10 40 80 00    	call   *0x804010
+  80020b:	83 c4 10             	add    $0x10,%esp
+  80020e:	83 f8 fd             	cmp    $0xfffffffd,%eax
+  800211:	0f 85 2d 03 00 00    	jne    800544 <umain+0x4c6>
+    panic("serve_read does not handle stale fileids correctly: %e", r);
+  cprintf("stale fileid is good\n");
+  800217:	83 ec 0c             	sub    $0xc,%esp
+  80021a:	68 8d 35 80 00       	push   $0x80358d
+  80021f:	e8 a3 05 00 00       	call   8007c7 <cprintf>
+
+  // Try writing
+  if ((r = xopen("/new-file", O_RDWR|O_CREAT)) < 0)
+  800224:	ba 02 01 00 00       	mov    $0x102,%edx
+  800229:	b8 a3 35 80 00       	mov    $0x8035a3,%eax
+  80022e:	e8 00 fe ff ff       	call   800033 <xopen>
+  800233:	83 c4 10             	add    $0x10,%esp
+  800236:	85 c0                	test   %eax,%eax
+  800238:	0f 88 18 03 00 00    	js     800556 <umain+0x4d8>
+    panic("serve_open /new-file: %e", r);
+
+  if ((r = devfile.dev_write(FVA, msg, strlen(msg))) != strlen(msg))
+  80023e:	8b 1d 14 40 80 00    	mov    0x804014,%ebx
+  800244:	83 ec 0c             	sub    $0xc,%esp
+  800247:	ff 35 00 40 80 00    	push   0x804000
+  80024d:	e8 28 0b 00 00       	call   800d7a <strlen>
+  800252:	83 c4 0c             	add    $0xc,%esp
+  800255:	50                   	push   %eax
+  800256:	ff 35 00 40 80 00    	push   0x804000
+  80025c:	68 00 c0 cc cc       	push   $0xccccc000
+  800261:	ff d3                	call   *%ebx
+  800263:	89 c3                	mov    %eax,%ebx
+  800265:	83 c4 04             	add    $0x4,%esp
+  800268:	ff 35 00 40 80 00    	push   0x804000
+  80026e:	e8 07 0b 00 00       	call   800d7a <strlen>
+  800273:	83 c4 10             	add    $0x10,%esp
+  800276:	39 d8                	cmp    %ebx,%eax
+  800278:	0f 85 ea 02 00 00    	jne    800568 <umain+0x4ea>
+    panic("file_write: %e", r);
+  cprintf("file_write is good\n");
+  80027e:	83 ec 0c             	sub    $0xc,%esp
+  800281:	68 d5 35 80 00       	push   $0x8035d5
+  800286:	e8 3c 05 00 00       	call   8007c7 <cprintf>
+
+  FVA->fd_offset = 0;
+  80028b:	c7 05 04 c0 cc cc 00 	movl   $0x0,0xccccc004
+  800292:	00 00 00 
+  memset(buf, 0, sizeof buf);
+  800295:	83 c4 0c             	add    $0xc,%esp
+  800298:	68 00 02 00 00       	push   $0x200
+  80029d:	6a 00                	push   $0x0
+  80029f:	8d 9d 4c fd ff ff    	lea    -0x2b4(%ebp),%ebx
+  8002a5:	53                   	push   %ebx
+  8002a6:	e8 5b 0c 00 00       	call   800f06 <memset>
+  if ((r = devfile.dev_read(FVA, buf, sizeof buf)) < 0)
+  8002ab:	83 c4 0c             	add    $0xc,%esp
+  8002ae:	68 00 02 00 00       	push   $0x200
+  8002b3:	53                   	push   %ebx
+  8002b4:	68 00 c0 cc cc       	push   $0xccccc000
+  8002b9:	ff 15 10 40 80 00    	call   *0x804010
+  8002bf:	89 c3                	mov    %eax,%ebx
+  8002c1:	83 c4 10             	add    $0x10,%esp
+  8002c4:	85 c0                	test   %eax,%eax
+  8002c6:	0f 88 ae 02 00 00    	js     80057a <umain+0x4fc>
+    panic("file_read after file_write: %e", r);
+  if (r != strlen(msg))
+  8002cc:	83 ec 0c             	sub    $0xc,%esp
+  8002cf:	ff 35 00 40 80 00    	push   0x804000
+  8002d5:	e8 a0 0a 00 00       	call   800d7a <strlen>
+  8002da:	83 c4 10             	add    $0x10,%esp
+  8002dd:	39 d8                	cmp    %ebx,%eax
+  8002df:	0f 85 a7 02 00 00    	jne    80058c <umain+0x50e>
+    panic("file_read after file_write returned wrong length: %d", r);
+  if (strcmp(buf, msg) != 0)
+  8002e5:	83 ec 08             	sub    $0x8,%esp
+  8002e8:	ff 35 00 40 80 00    	push   0x804000
+  8002ee:	8d 85 4c fd ff ff    	lea    -0x2b4(%ebp),%eax
+  8002f4:	50                   	push   %eax
+  8002f5:	e8 6c 0b 00 00       	call   800e66 <strcmp>
+  8002fa:	83 c4 10             	add    $0x10,%esp
+  8002fd:	85 c0                	test   %eax,%eax
+  8002ff:	0f 85 99 02 00 00    	jne    80059e <umain+0x520>
+    panic("file_read after file_write returned wrong data");
+  cprintf("file_read after file_write is good\n");
+  800305:	83 ec 0c             	sub    $0xc,%esp
+  800308:	68 9c 37 80 00       	push   $0x80379c
+  80030d:	e8 b5 04 00 00       	call   8007c7 <cprintf>
+
+  // Now we'll try out open
+  if ((r = open("/not-found", O_RDONLY)) < 0 && r != -E_NOT_FOUND)
+  800312:	83 c4 08             	add    $0x8,%esp
+  800315:	6a 00                	push   $0x0
+  800317:	68 a0 34 80 00       	push   $0x8034a0
+  80031c:	e8 25 20 00 00       	call   802346 <open>
+  800321:	83 c4 10             	add    $0x10,%esp
+  800324:	85 c0                	test   %eax,%eax
+  800326:	0f 89 98 02 00 00    	jns    8005c4 <umain+0x546>
+  80032c:	83 f8 f5             	cmp    $0xfffffff5,%eax
+  80032f:	0f 85 7d 02 00 00    	jne    8005b2 <umain+0x534>
+    panic("open /not-found: %e", r);
+  else if (r >= 0)
+    panic("open /not-found succeeded!");
+
+  if ((r = open("/newmotd", O_RDONLY)) < 0)
+  800335:	83 ec 08             	sub    $0x8,%esp
+  800338:	6a 00                	push   $0x0
+  80033a:	68 d5 34 80 00       	push   $0x8034d5
+  80033f:	e8 02 20 00 00       	call   802346 <open>
+  800344:	83 c4 10             	add    $0x10,%esp
+  800347:	85 c0                	test   %eax,%eax
+  800349:	0f 88 89 02 00 00    	js     8005d8 <umain+0x55a>
+    panic("open /newmotd: %e", r);
+  fd = (struct Fd*)(0xD0000000 + r*PGSIZE);
+  80034f:	c1 e0 0c             	shl    $0xc,%eax
+  if (fd->fd_dev_id != 'f' || fd->fd_offset != 0 || fd->fd_omode != O_RDONLY)
+  800352:	83 b8 00 00 00 d0 66 	cmpl   $0x66,-0x30000000(%eax)
+  800359:	0f 85 8b 02 00 00    	jne    8005ea <umain+0x56c>
+  80035f:	83 b8 04 00 00 d0 00 	cmpl   $0x0,-0x2ffffffc(%eax)
+  800366:	0f 85 7e 02 00 00    	jne    8005ea <umain+0x56c>
+  80036c:	8b 98 08 00 00 d0    	mov    -0x2ffffff8(%eax),%ebx
+  800372:	85 db                	test   %ebx,%ebx
+  800374:	0f 85 70 02 00 00    	jne    8005ea <umain+0x56c>
+    panic("open did not fill struct Fd correctly\n");
+  cprintf("open is good\n");
+  80037a:	83 ec 0c             	sub    $0xc,%esp
+  80037d:	68 fc 34 80 00       	push   $0x8034fc
+  800382:	e8 40 04 00 00       	call   8007c7 <cprintf>
+
+  // Try files with indirect blocks
+  if ((f = open("/big", O_WRONLY|O_CREAT)) < 0)
+  800387:	83 c4 08             	add    $0x8,%esp
+  80038a:	68 01 01 00 00       	push   $0x101
+  80038f:	68 04 36 80 00       	push   $0x803604
+  800394:	e8 ad 1f 00 00       	call   802346 <open>
+  800399:	89 c7                	mov    %eax,%edi
+  80039b:	83 c4 10             	add    $0x10,%esp
+  80039e:	85 c0                	test   %eax,%eax
+  8003a0:	0f 88 58 02 00 00    	js     8005fe <umain+0x580>
+    panic("creat /big: %e", f);
+  memset(buf, 0, sizeof(buf));
+  8003a6:	83 ec 04             	sub    $0x4,%esp
+  8003a9:	68 00 02 00 00       	push   $0x200
+  8003ae:	6a 00                	push   $0x0
+  8003b0:	8d 85 4c fd ff ff    	lea    -0x2b4(%ebp),%eax
+  8003b6:	50                   	push   %eax
+  8003b7:	e8 4a 0b 00 00       	call   800f06 <memset>
+  8003bc:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < (NDIRECT*3)*BLKSIZE; i += sizeof(buf)) {
+  8003bf:	89 de                	mov    %ebx,%esi
+    *(int*)buf = i;
+  8003c1:	89 b5 4c fd ff ff    	mov    %esi,-0x2b4(%ebp)
+    if ((r = write(f, buf, sizeof(buf))) < 0)
+  8003c7:	83 ec 04             	sub    $0x4,%esp
+  8003ca:	68 00 02 00 00       	push   $0x200
+  8003cf:	8d 85 4c fd ff ff    	lea    -0x2b4(%ebp),%eax
+  8003d5:	50                   	push   %eax
+  8003d6:	57                   	push   %edi
+  8003d7:	e8 0d 18 00 00       	call   801be9 <write>
+  8003dc:	83 c4 10             	add    $0x10,%esp
+  8003df:	85 c0                	test   %eax,%eax
+  8003e1:	0f 88 29 02 00 00    	js     800610 <umain+0x592>
+  for (i = 0; i < (NDIRECT*3)*BLKSIZE; i += sizeof(buf)) {
+  8003e7:	8d 86 00 02 00 00    	lea    0x200(%esi),%eax
+  8003ed:	89 c6                	mov    %eax,%esi
+  8003ef:	3d 00 e0 01 00       	cmp    $0x1e000,%eax
+  8003f4:	75 cb                	jne    8003c1 <umain+0x343>
+      panic("write /big@%d: %e", i, r);
+  }
+  close(f);
+  8003f6:	83 ec 0c             	sub    $0xc,%esp
+  8003f9:	57                   	push   %edi
+  8003fa:	e8 94 15 00 00       	call   801993 <close>
+
+  if ((f = open("/big", O_RDONLY)) < 0)
+  8003ff:	83 c4 08             	add    $0x8,%esp
+  800402:	6a 00                	push   $0x0
+  800404:	68 04 36 80 00       	push   $0x803604
+  800409:	e8 38 1f 00 00       	call   802346 <open>
+  80040e:	89 c6                	mov    %eax,%esi
+  800410:	83 c4 10             	add    $0x10,%esp
+  800413:	85 c0                	test   %eax,%eax
+  800415:	0f 88 0b 02 00 00    	js     800626 <umain+0x5a8>
+    panic("open /big: %e", f);
+  for (i = 0; i < (NDIRECT*3)*BLKSIZE; i += sizeof(buf)) {
+    *(int*)buf = i;
+    if ((r = readn(f, buf, sizeof(buf))) < 0)
+  80041b:	8d bd 4c fd ff ff    	lea    -0x2b4(%ebp),%edi
+    *(int*)buf = i;
+  800421:	89 9d 4c fd ff ff    	mov    %ebx,-0x2b4(%ebp)
+    if ((r = readn(f, buf, sizeof(buf))) < 0)
+  800427:	83 ec 04             	sub    $0x4,%esp
+  80042a:	68 00 02 00 00       	push   $0x200
+  80042f:	57                   	push   %edi
+  800430:	56                   	push   %esi
+  800431:	e8 6c 17 00 00       	call   801ba2 <readn>
+  800436:	83 c4 10             	add    $0x10,%esp
+  800439:	85 c0                	test   %eax,%eax
+  80043b:	0f 88 f7 01 00 00    	js     800638 <umain+0x5ba>
+      panic("read /big@%d: %e", i, r);
+    if (r != sizeof(buf))
+  800441:	3d 00 02 00 00       	cmp    $0x200,%eax
+  800446:	0f 85 02 02 00 00    	jne    80064e <umain+0x5d0>
+      panic("read /big from %d returned %d < %d bytes",
+            i, r, sizeof(buf));
+    if (*(int*)buf != i)
+  80044c:	8b 85 4c fd ff ff    	mov    -0x2b4(%ebp),%eax
+  800452:	39 d8                	cmp    %ebx,%eax
+  800454:	0f 85 0f 02 00 00    	jne    800669 <umain+0x5eb>
+  for (i = 0; i < (NDIRECT*3)*BLKSIZE; i += sizeof(buf)) {
+  80045a:	8d 83 00 02 00 00    	lea    0x200(%ebx),%eax
+  800460:	89 c3                	mov    %eax,%ebx
+  800462:	3d 00 e0 01 00       	cmp    $0x1e000,%eax
+  800467:	75 b8                	jne    800421 <umain+0x3a3>
+      panic("read /big from %d returned bad data %d",
+            i, *(int*)buf);
+  }
+  close(f);
+  800469:	83 ec 0c             	sub    $0xc,%esp
+  80046c:	56                   	push   %esi
+  80046d:	e8 21 15 00 00       	call   801993 <close>
+  cprintf("large file is good\n");
+  800472:	c7 04 24 49 36 80 00 	movl   $0x803649,(%esp)
+  800479:	e8 49 03 00 00       	call   8007c7 <cprintf>
+}
+  80047e:	83 c4 10             	add    $0x10,%esp
+  800481:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800484:	5b                   	pop    %ebx
+  800485:	5e                   	pop    %esi
+  800486:	5f                   	pop    %edi
+  800487:	5d                   	pop    %ebp
+  800488:	c3                   	ret
+    panic("serve_open /not-found: %e", r);
+  800489:	50                   	push   %eax
+  80048a:	68 ab 34 80 00       	push   $0x8034ab
+  80048f:	6a 20                	push   $0x20
+  800491:	68 c5 34 80 00       	push   $0x8034c5
+  800496:	e8 51 02 00 00       	call   8006ec <_panic>
+    panic("serve_open /not-found succeeded!");
+  80049b:	83 ec 04             	sub    $0x4,%esp
+  80049e:	68 60 36 80 00       	push   $0x803660
+  8004a3:	6a 22                	push   $0x22
+  8004a5:	68 c5 34 80 00       	push   $0x8034c5
+  8004aa:	e8 3d 02 00 00       	call   8006ec <_panic>
+    panic("serve_open /newmotd: %e", r);
+  8004af:	50                   	push   %eax
+  8004b0:	68 de 34 80 00       	push   $0x8034de
+  8004b5:	6a 25                	push   $0x25
+  8004b7:	68 c5 34 80 00       	push   $0x8034c5
+  8004bc:	e8 2b 02 00 00       	call   8006ec <_panic>
+    panic("serve_open did not fill struct Fd correctly\n");
+  8004c1:	83 ec 04             	sub    $0x4,%esp
+  8004c4:	68 84 36 80 00       	push   $0x803684
+  8004c9:	6a 27                	push   $0x27
+  8004cb:	68 c5 34 80 00       	push   $0x8034c5
+  8004d0:	e8 17 02 00 00       	call   8006ec <_panic>
+    panic("file_stat: %e", r);
+  8004d5:	50                   	push   %eax
+  8004d6:	68 0a 35 80 00       	push   $0x80350a
+  8004db:	6a 2b                	push   $0x2b
+  8004dd:	68 c5 34 80 00       	push   $0x8034c5
+  8004e2:	e8 05 02 00 00       	call   8006ec <_panic>
+    panic("file_stat returned size %d wanted %d\n", st.st_size, strlen(msg));
+  8004e7:	83 ec 0c             	sub    $0xc,%esp
+  8004ea:	ff 35 00 40 80 00    	push   0x804000
+  8004f0:	e8 85 08 00 00       	call   800d7a <strlen>
+  8004f5:	89 04 24             	mov    %eax,(%esp)
+  8004f8:	ff 75 cc             	push   -0x34(%ebp)
+  8004fb:	68 b4 36 80 00       	push   $0x8036b4
+  800500:	6a 2d                	push   $0x2d
+  800502:	68 c5 34 80 00       	push   $0x8034c5
+  800507:	e8 e0 01 00 00       	call   8006ec <_panic>
+    panic("file_read: %e", r);
+  80050c:	50                   	push   %eax
+  80050d:	68 2b 35 80 00       	push   $0x80352b
+  800512:	6a 32                	push   $0x32
+  800514:	68 c5 34 80 00       	push   $0x8034c5
+  800519:	e8 ce 01 00 00       	call   8006ec <_panic>
+    panic("file_read returned wrong data");
+  80051e:	83 ec 04             	sub    $0x4,%esp
+  800521:	68 39 35 80 00       	push   $0x803539
+  800526:	6a 34                	push   $0x34
+  800528:	68 c5 34 80 00       	push   $0x8034c5
+  80052d:	e8 ba 01 00 00       	call   8006ec <_panic>
+    panic("file_close: %e", r);
+  800532:	50                   	push   %eax
+  800533:	68 6a 35 80 00       	push   $0x80356a
+  800538:	6a 38                	push   $0x38
+  80053a:	68 c5 34 80 00       	push   $0x8034c5
+  80053f:	e8 a8 01 00 00       	call   8006ec <_panic>
+    panic("serve_read does not handle stale fileids correctly: %e", r);
+  800544:	50                   	push   %eax
+  800545:	68 dc 36 80 00       	push   $0x8036dc
+  80054a:	6a 43                	push   $0x43
+  80054c:	68 c5 34 80 00       	push   $0x8034c5
+  800551:	e8 96 01 00 00       	call   8006ec <_panic>
+    panic("serve_open /new-file: %e", r);
+  800556:	50                   	push   %eax
+  800557:	68 ad 35 80 00       	push   $0x8035ad
+  80055c:	6a 48                	push   $0x48
+  80055e:	68 c5 34 80 00       	push   $0x8034c5
+  800563:	e8 84 01 00 00       	call   8006ec <_panic>
+    panic("file_write: %e", r);
+  800568:	53                   	push   %ebx
+  800569:	68 c6 35 80 00       	push   $0x8035c6
+  80056e:	6a 4b                	push   $0x4b
+  800570:	68 c5 34 80 00       	push   $0x8034c5
+  800575:	e8 72 01 00 00       	call   8006ec <_panic>
+    panic("file_read after file_write: %e", r);
+  80057a:	50                   	push   %eax
+  80057b:	68 14 37 80 00       	push   $0x803714
+  800580:	6a 51                	push   $0x51
+  800582:	68 c5 34 80 00       	push   $0x8034c5
+  800587:	e8 60 01 00 00       	call   8006ec <_panic>
+    panic("file_read after file_write returned wrong length: %d", r);
+  80058c:	53                   	push   %ebx
+  80058d:	68 34 37 80 00       	push   $0x803734
+  800592:	6a 53                	push   $0x53
+  800594:	68 c5 34 80 00       	push   $0x8034c5
+  800599:	e8 4e 01 00 00       	call   8006ec <_panic>
+    panic("file_read after file_write returned wrong data");
+  80059e:	83 ec 04             	sub    $0x4,%esp
+  8005a1:	68 6c 37 80 00       	push   $0x80376c
+  8005a6:	6a 55                	push   $0x55
+  8005a8:	68 c5 34 80 00       	push   $0x8034c5
+  8005ad:	e8 3a 01 00 00       	call   8006ec <_panic>
+    panic("open /not-found: %e", r);
+  8005b2:	50                   	push   %eax
+  8005b3:	68 b1 34 80 00       	push   $0x8034b1
+  8005b8:	6a 5a                	push   $0x5a
+  8005ba:	68 c5 34 80 00       	push   $0x8034c5
+  8005bf:	e8 28 01 00 00       	call   8006ec <_panic>
+    panic("open /not-found succeeded!");
+  8005c4:	83 ec 04             	sub    $0x4,%esp
+  8005c7:	68 e9 35 80 00       	push   $0x8035e9
+  8005cc:	6a 5c                	push   $0x5c
+  8005ce:	68 c5 34 80 00       	push   $0x8034c5
+  8005d3:	e8 14 01 00 00       	call   8006ec <_panic>
+    panic("open /newmotd: %e", r);
+  8005d8:	50                   	push   %eax
+  8005d9:	68 e4 34 80 00       	push   $0x8034e4
+  8005de:	6a 5f                	push   $0x5f
+  8005e0:	68 c5 34 80 00       	push   $0x8034c5
+  8005e5:	e8 02 01 00 00       	call   8006ec <_panic>
+    panic("open did not fill struct Fd correctly\n");
+  8005ea:	83 ec 04             	sub    $0x4,%esp
+  8005ed:	68 c0 37 80 00       	push   $0x8037c0
+  8005f2:	6a 62                	push   $0x62
+  8005f4:	68 c5 34 80 00       	push   $0x8034c5
+  8005f9:	e8 ee 00 00 00       	call   8006ec <_panic>
+    panic("creat /big: %e", f);
+  8005fe:	50                   	push   %eax
+  8005ff:	68 09 36 80 00       	push   $0x803609
+  800604:	6a 67                	push   $0x67
+  800606:	68 c5 34 80 00       	push   $0x8034c5
+  80060b:	e8 dc 00 00 00       	call   8006ec <_panic>
+      panic("write /big@%d: %e", i, r);
+  800610:	83 ec 0c             	sub    $0xc,%esp
+  800613:	50                   	push   %eax
+  800614:	56                   	push   %esi
+  800615:	68 18 36 80 00       	push   $0x803618
+  80061a:	6a 6c                	push   $0x6c
+  80061c:	68 c5 34 80 00       	push   $0x8034c5
+  800621:	e8 c6 00 00 00       	call   8006ec <_panic>
+    panic("open /big: %e", f);
+  800626:	50                   	push   %eax
+  800627:	68 2a 36 80 00       	push   $0x80362a
+  80062c:	6a 71                	push   $0x71
+  80062e:	68 c5 34 80 00       	push   $0x8034c5
+  800633:	e8 b4 00 00 00       	call   8006ec <_panic>
+      panic("read /big@%d: %e", i, r);
+  800638:	83 ec 0c             	sub    $0xc,%esp
+  80063b:	50                   	push   %eax
+  80063c:	53                   	push   %ebx
+  80063d:	68 38 36 80 00       	push   $0x803638
+  800642:	6a 75                	push   $0x75
+  800644:	68 c5 34 80 00       	push   $0x8034c5
+  800649:	e8 9e 00 00 00       	call   8006ec <_panic>
+      panic("read /big from %d returned %d < %d bytes",
+  80064e:	83 ec 08             	sub    $0x8,%esp
+  800651:	68 00 02 00 00       	push   $0x200
+  800656:	50                   	push   %eax
+  800657:	53                   	push   %ebx
+  800658:	68 e8 37 80 00       	push   $0x8037e8
+  80065d:	6a 77                	push   $0x77
+  80065f:	68 c5 34 80 00       	push   $0x8034c5
+  800664:	e8 83 00 00 00       	call   8006ec <_panic>
+      panic("read /big from %d returned bad data %d",
+  800669:	83 ec 0c             	sub    $0xc,%esp
+  80066c:	50                   	push   %eax
+  80066d:	53                   	push   %ebx
+  80066e:	68 14 38 80 00       	push   $0x803814
+  800673:	6a 7a                	push   $0x7a
+  800675:	68 c5 34 80 00       	push   $0x8034c5
+  80067a:	e8 6d 00 00 00       	call   8006ec <_panic>
+
+0080067f <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80067f:	55                   	push   %ebp
+  800680:	89 e5                	mov    %esp,%ebp
+  800682:	56                   	push   %esi
+  800683:	53                   	push   %ebx
+  800684:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800687:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  80068a:	c7 05 44 57 80 00 00 	movl   $0x0,0x805744
+  800691:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  800694:	e8 ca 0a 00 00       	call   801163 <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  800699:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80069e:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8006a1:	c1 e0 04             	shl    $0x4,%eax
+  8006a4:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8006a9:	a3 44 57 80 00       	mov    %eax,0x805744
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  8006ae:	85 db                	test   %ebx,%ebx
+  8006b0:	7e 07                	jle    8006b9 <libmain+0x3a>
+    binaryname = argv[0];
+  8006b2:	8b 06                	mov    (%esi),%eax
+  8006b4:	a3 04 40 80 00       	mov    %eax,0x804004
+
+  // call user main routine
+  umain(argc, argv);
+  8006b9:	83 ec 08             	sub    $0x8,%esp
+  8006bc:	56                   	push   %esi
+  8006bd:	53                   	push   %ebx
+  8006be:	e8 bb f9 ff ff       	call   80007e <umain>
+
+  // exit gracefully
+  exit();
+  8006c3:	e8 0a 00 00 00       	call   8006d2 <exit>
+}
+  8006c8:	83 c4 10             	add    $0x10,%esp
+  8006cb:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8006ce:	5b                   	pop    %ebx
+  8006cf:	5e                   	pop    %esi
+  8006d0:	5d                   	pop    %ebp
+  8006d1:	c3                   	ret
+
+008006d2 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8006d2:	55                   	push   %ebp
+  8006d3:	89 e5                	mov    %esp,%ebp
+  8006d5:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  8006d8:	e8 e3 12 00 00       	call   8019c0 <close_all>
+  sys_env_destroy(0);
+  8006dd:	83 ec 0c             	sub    $0xc,%esp
+  8006e0:	6a 00                	push   $0x0
+  8006e2:	e8 3b 0a 00 00       	call   801122 <sys_env_destroy>
+}
+  8006e7:	83 c4 10             	add    $0x10,%esp
+  8006ea:	c9                   	leave
+  8006eb:	c3                   	ret
+
+008006ec <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8006ec:	55                   	push   %ebp
+  8006ed:	89 e5                	mov    %esp,%ebp
+  8006ef:	56                   	push   %esi
+  8006f0:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  8006f1:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  8006f4:	8b 35 04 40 80 00    	mov    0x804004,%esi
+  8006fa:	e8 64 0a 00 00       	call   801163 <sys_getenvid>
+  8006ff:	83 ec 0c             	sub    $0xc,%esp
+  800702:	ff 75 0c             	push   0xc(%ebp)
+  800705:	ff 75 08             	push   0x8(%ebp)
+  800708:	56                   	push   %esi
+  800709:	50                   	push   %eax
+  80070a:	68 6c 38 80 00       	push   $0x80386c
+  80070f:	e8 b3 00 00 00       	call   8007c7 <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  800714:	83 c4 18             	add    $0x18,%esp
+  800717:	53                   	push   %ebx
+  800718:	ff 75 10             	push   0x10(%ebp)
+  80071b:	e8 56 00 00 00       	call   800776 <vcprintf>
+  cprintf("\n");
+  800720:	c7 04 24 f8 3c 80 00 	movl   $0x803cf8,(%esp)
+  800727:	e8 9b 00 00 00       	call   8007c7 <cprintf>
+  80072c:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  80072f:	cc                   	int3
+  while (1)
+  800730:	eb fd                	jmp    80072f <_panic+0x43>
+
+00800732 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800732:	55                   	push   %ebp
+  800733:	89 e5                	mov    %esp,%ebp
+  800735:	53                   	push   %ebx
+  800736:	83 ec 04             	sub    $0x4,%esp
+  800739:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  80073c:	8b 13                	mov    (%ebx),%edx
+  80073e:	8d 42 01             	lea    0x1(%edx),%eax
+  800741:	89 03                	mov    %eax,(%ebx)
+  800743:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800746:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  80074a:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80074f:	74 09                	je     80075a <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  800751:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800755:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800758:	c9                   	leave
+  800759:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  80075a:	83 ec 08             	sub    $0x8,%esp
+  80075d:	68 ff 00 00 00       	push   $0xff
+  800762:	8d 43 08             	lea    0x8(%ebx),%eax
+  800765:	50                   	push   %eax
+  800766:	e8 7a 09 00 00       	call   8010e5 <sys_cputs>
+    b->idx = 0;
+  80076b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  800771:	83 c4 10             	add    $0x10,%esp
+  800774:	eb db                	jmp    800751 <putch+0x1f>
+
+00800776 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800776:	55                   	push   %ebp
+  800777:	89 e5                	mov    %esp,%ebp
+  800779:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  80077f:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800786:	00 00 00 
+  b.cnt = 0;
+  800789:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  800790:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  800793:	ff 75 0c             	push   0xc(%ebp)
+  800796:	ff 75 08             	push   0x8(%ebp)
+  800799:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80079f:	50                   	push   %eax
+  8007a0:	68 32 07 80 00       	push   $0x800732
+  8007a5:	e8 14 01 00 00       	call   8008be <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  8007aa:	83 c4 08             	add    $0x8,%esp
+  8007ad:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  8007b3:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  8007b9:	50                   	push   %eax
+  8007ba:	e8 26 09 00 00       	call   8010e5 <sys_cputs>
+
+  return b.cnt;
+}
+  8007bf:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8007c5:	c9                   	leave
+  8007c6:	c3                   	ret
+
+008007c7 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8007c7:	55                   	push   %ebp
+  8007c8:	89 e5                	mov    %esp,%ebp
+  8007ca:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  8007cd:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  8007d0:	50                   	push   %eax
+  8007d1:	ff 75 08             	push   0x8(%ebp)
+  8007d4:	e8 9d ff ff ff       	call   800776 <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  8007d9:	c9                   	leave
+  8007da:	c3                   	ret
+
+008007db <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  8007db:	55                   	push   %ebp
+  8007dc:	89 e5                	mov    %esp,%ebp
+  8007de:	57                   	push   %edi
+  8007df:	56                   	push   %esi
+  8007e0:	53                   	push   %ebx
+  8007e1:	83 ec 1c             	sub    $0x1c,%esp
+  8007e4:	89 c7                	mov    %eax,%edi
+  8007e6:	89 d6                	mov    %edx,%esi
+  8007e8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8007eb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8007ee:	89 d1                	mov    %edx,%ecx
+  8007f0:	89 c2                	mov    %eax,%edx
+  8007f2:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007f5:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8007f8:	8b 45 10             	mov    0x10(%ebp),%eax
+  8007fb:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  8007fe:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800801:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  800808:	39 c2                	cmp    %eax,%edx
+  80080a:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  80080d:	72 3e                	jb     80084d <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  80080f:	83 ec 0c             	sub    $0xc,%esp
+  800812:	ff 75 18             	push   0x18(%ebp)
+  800815:	83 eb 01             	sub    $0x1,%ebx
+  800818:	53                   	push   %ebx
+  800819:	50                   	push   %eax
+  80081a:	83 ec 08             	sub    $0x8,%esp
+  80081d:	ff 75 e4             	push   -0x1c(%ebp)
+  800820:	ff 75 e0             	push   -0x20(%ebp)
+  800823:	ff 75 dc             	push   -0x24(%ebp)
+  800826:	ff 75 d8             	push   -0x28(%ebp)
+  800829:	e8 db 2a 00 00       	call   803309 <__udivdi3>
+  80082e:	83 c4 18             	add    $0x18,%esp
+  800831:	52                   	push   %edx
+  800832:	50                   	push   %eax
+  800833:	89 f2                	mov    %esi,%edx
+  800835:	89 f8                	mov    %edi,%eax
+  800837:	e8 9f ff ff ff       	call   8007db <printnum>
+  80083c:	83 c4 20             	add    $0x20,%esp
+  80083f:	eb 13                	jmp    800854 <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  800841:	83 ec 08             	sub    $0x8,%esp
+  800844:	56                   	push   %esi
+  800845:	ff 75 18             	push   0x18(%ebp)
+  800848:	ff d7                	call   *%edi
+  80084a:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  80084d:	83 eb 01             	sub    $0x1,%ebx
+  800850:	85 db                	test   %ebx,%ebx
+  800852:	7f ed                	jg     800841 <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  800854:	83 ec 08             	sub    $0x8,%esp
+  800857:	56                   	push   %esi
+  800858:	83 ec 04             	sub    $0x4,%esp
+  80085b:	ff 75 e4             	push   -0x1c(%ebp)
+  80085e:	ff 75 e0             	push   -0x20(%ebp)
+  800861:	ff 75 dc             	push   -0x24(%ebp)
+  800864:	ff 75 d8             	push   -0x28(%ebp)
+  800867:	e8 be 2a 00 00       	call   80332a <__umoddi3>
+  80086c:	83 c4 14             	add    $0x14,%esp
+  80086f:	0f be 80 8f 38 80 00 	movsbl 0x80388f(%eax),%eax
+  800876:	50                   	push   %eax
+  800877:	ff d7                	call   *%edi
+}
+  800879:	83 c4 10             	add    $0x10,%esp
+  80087c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80087f:	5b                   	pop    %ebx
+  800880:	5e                   	pop    %esi
+  800881:	5f                   	pop    %edi
+  800882:	5d                   	pop    %ebp
+  800883:	c3                   	ret
+
+00800884 <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800884:	55                   	push   %ebp
+  800885:	89 e5                	mov    %esp,%ebp
+  800887:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  80088a:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  80088e:	8b 10                	mov    (%eax),%edx
+  800890:	3b 50 04             	cmp    0x4(%eax),%edx
+  800893:	73 0a                	jae    80089f <sprintputch+0x1b>
+    *b->buf++ = ch;
+  800895:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800898:	89 08                	mov    %ecx,(%eax)
+  80089a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80089d:	88 02                	mov    %al,(%edx)
+}
+  80089f:	5d                   	pop    %ebp
+  8008a0:	c3                   	ret
+
+008008a1 <printfmt>:
+{
+  8008a1:	55                   	push   %ebp
+  8008a2:	89 e5                	mov    %esp,%ebp
+  8008a4:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  8008a7:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  8008aa:	50                   	push   %eax
+  8008ab:	ff 75 10             	push   0x10(%ebp)
+  8008ae:	ff 75 0c             	push   0xc(%ebp)
+  8008b1:	ff 75 08             	push   0x8(%ebp)
+  8008b4:	e8 05 00 00 00       	call   8008be <vprintfmt>
+}
+  8008b9:	83 c4 10             	add    $0x10,%esp
+  8008bc:	c9                   	leave
+  8008bd:	c3                   	ret
+
+008008be <vprintfmt>:
+{
+  8008be:	55                   	push   %ebp
+  8008bf:	89 e5                	mov    %esp,%ebp
+  8008c1:	57                   	push   %edi
+  8008c2:	56                   	push   %esi
+  8008c3:	53                   	push   %ebx
+  8008c4:	83 ec 2c             	sub    $0x2c,%esp
+  8008c7:	8b 75 08             	mov    0x8(%ebp),%esi
+  8008ca:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8008cd:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8008d0:	eb 0a                	jmp    8008dc <vprintfmt+0x1e>
+      putch(ch, putdat);
+  8008d2:	83 ec 08             	sub    $0x8,%esp
+  8008d5:	53                   	push   %ebx
+  8008d6:	50                   	push   %eax
+  8008d7:	ff d6                	call   *%esi
+  8008d9:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  8008dc:	83 c7 01             	add    $0x1,%edi
+  8008df:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8008e3:	83 f8 25             	cmp    $0x25,%eax
+  8008e6:	74 0c                	je     8008f4 <vprintfmt+0x36>
+      if (ch == '\0')
+  8008e8:	85 c0                	test   %eax,%eax
+  8008ea:	75 e6                	jne    8008d2 <vprintfmt+0x14>
+}
+  8008ec:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8008ef:	5b                   	pop    %ebx
+  8008f0:	5e                   	pop    %esi
+  8008f1:	5f                   	pop    %edi
+  8008f2:	5d                   	pop    %ebp
+  8008f3:	c3                   	ret
+    padc = ' ';
+  8008f4:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  8008f8:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  8008ff:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  800906:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  80090d:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  800912:	8d 47 01             	lea    0x1(%edi),%eax
+  800915:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800918:	0f b6 17             	movzbl (%edi),%edx
+  80091b:	8d 42 dd             	lea    -0x23(%edx),%eax
+  80091e:	3c 55                	cmp    $0x55,%al
+  800920:	0f 87 cf 03 00 00    	ja     800cf5 <vprintfmt+0x437>
+  800926:	0f b6 c0             	movzbl %al,%eax
+  800929:	ff 24 85 e0 39 80 00 	jmp    *0x8039e0(,%eax,4)
+  800930:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  800933:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800937:	eb d9                	jmp    800912 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  800939:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80093c:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800940:	eb d0                	jmp    800912 <vprintfmt+0x54>
+  800942:	0f b6 d2             	movzbl %dl,%edx
+  800945:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  800948:	b8 00 00 00 00       	mov    $0x0,%eax
+  80094d:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  800950:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  800953:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  800957:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  80095a:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  80095d:	83 f9 09             	cmp    $0x9,%ecx
+  800960:	77 55                	ja     8009b7 <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  800962:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  800965:	eb e9                	jmp    800950 <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  800967:	8b 45 14             	mov    0x14(%ebp),%eax
+  80096a:	8b 00                	mov    (%eax),%eax
+  80096c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80096f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800972:	8d 40 04             	lea    0x4(%eax),%eax
+  800975:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  800978:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  80097b:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80097f:	79 91                	jns    800912 <vprintfmt+0x54>
+        width = precision, precision = -1;
+  800981:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800984:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800987:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80098e:	eb 82                	jmp    800912 <vprintfmt+0x54>
+      if (width < 0)
+  800990:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800993:	85 d2                	test   %edx,%edx
+  800995:	b8 00 00 00 00       	mov    $0x0,%eax
+  80099a:	0f 49 c2             	cmovns %edx,%eax
+  80099d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  8009a0:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  8009a3:	e9 6a ff ff ff       	jmp    800912 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  8009a8:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  8009ab:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  8009b2:	e9 5b ff ff ff       	jmp    800912 <vprintfmt+0x54>
+  8009b7:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8009ba:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8009bd:	eb bc                	jmp    80097b <vprintfmt+0xbd>
+      lflag++;
+  8009bf:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  8009c2:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  8009c5:	e9 48 ff ff ff       	jmp    800912 <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  8009ca:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009cd:	8d 78 04             	lea    0x4(%eax),%edi
+  8009d0:	83 ec 08             	sub    $0x8,%esp
+  8009d3:	53                   	push   %ebx
+  8009d4:	ff 30                	push   (%eax)
+  8009d6:	ff d6                	call   *%esi
+      break;
+  8009d8:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  8009db:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  8009de:	e9 b1 02 00 00       	jmp    800c94 <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  8009e3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8009e6:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  8009e9:	8b 10                	mov    (%eax),%edx
+  8009eb:	89 d0                	mov    %edx,%eax
+  8009ed:	f7 d8                	neg    %eax
+  8009ef:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8009f2:	83 f8 10             	cmp    $0x10,%eax
+  8009f5:	7f 23                	jg     800a1a <vprintfmt+0x15c>
+  8009f7:	8b 14 85 40 3b 80 00 	mov    0x803b40(,%eax,4),%edx
+  8009fe:	85 d2                	test   %edx,%edx
+  800a00:	74 18                	je     800a1a <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  800a02:	52                   	push   %edx
+  800a03:	68 a2 3c 80 00       	push   $0x803ca2
+  800a08:	53                   	push   %ebx
+  800a09:	56                   	push   %esi
+  800a0a:	e8 92 fe ff ff       	call   8008a1 <printfmt>
+  800a0f:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  800a12:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800a15:	e9 7a 02 00 00       	jmp    800c94 <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  800a1a:	50                   	push   %eax
+  800a1b:	68 a7 38 80 00       	push   $0x8038a7
+  800a20:	53                   	push   %ebx
+  800a21:	56                   	push   %esi
+  800a22:	e8 7a fe ff ff       	call   8008a1 <printfmt>
+  800a27:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  800a2a:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  800a2d:	e9 62 02 00 00       	jmp    800c94 <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  800a32:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a35:	83 c0 04             	add    $0x4,%eax
+  800a38:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800a3b:	8b 45 14             	mov    0x14(%ebp),%eax
+  800a3e:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  800a40:	85 c9                	test   %ecx,%ecx
+  800a42:	b8 a0 38 80 00       	mov    $0x8038a0,%eax
+  800a47:	0f 45 c1             	cmovne %ecx,%eax
+  800a4a:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  800a4d:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  800a51:	7e 06                	jle    800a59 <vprintfmt+0x19b>
+  800a53:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800a57:	75 0b                	jne    800a64 <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800a59:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800a5c:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  800a5f:	89 75 08             	mov    %esi,0x8(%ebp)
+  800a62:	eb 5c                	jmp    800ac0 <vprintfmt+0x202>
+  800a64:	83 ec 08             	sub    $0x8,%esp
+  800a67:	ff 75 d0             	push   -0x30(%ebp)
+  800a6a:	ff 75 cc             	push   -0x34(%ebp)
+  800a6d:	e8 20 03 00 00       	call   800d92 <strnlen>
+  800a72:	89 c2                	mov    %eax,%edx
+  800a74:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800a77:	29 d0                	sub    %edx,%eax
+  800a79:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  800a7c:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  800a80:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800a83:	89 75 08             	mov    %esi,0x8(%ebp)
+  800a86:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800a88:	eb 0e                	jmp    800a98 <vprintfmt+0x1da>
+          putch(padc, putdat);
+  800a8a:	83 ec 08             	sub    $0x8,%esp
+  800a8d:	53                   	push   %ebx
+  800a8e:	57                   	push   %edi
+  800a8f:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800a92:	83 ee 01             	sub    $0x1,%esi
+  800a95:	83 c4 10             	add    $0x10,%esp
+  800a98:	85 f6                	test   %esi,%esi
+  800a9a:	7f ee                	jg     800a8a <vprintfmt+0x1cc>
+  800a9c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800a9f:	8b 75 08             	mov    0x8(%ebp),%esi
+  800aa2:	85 c0                	test   %eax,%eax
+  800aa4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800aa9:	0f 49 d0             	cmovns %eax,%edx
+  800aac:	29 d0                	sub    %edx,%eax
+  800aae:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800ab1:	eb a6                	jmp    800a59 <vprintfmt+0x19b>
+          putch(ch, putdat);
+  800ab3:	83 ec 08             	sub    $0x8,%esp
+  800ab6:	53                   	push   %ebx
+  800ab7:	52                   	push   %edx
+  800ab8:	ff 55 08             	call   *0x8(%ebp)
+  800abb:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800abe:	89 f1                	mov    %esi,%ecx
+  800ac0:	8d 71 01             	lea    0x1(%ecx),%esi
+  800ac3:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  800ac7:	0f be d0             	movsbl %al,%edx
+  800aca:	85 d2                	test   %edx,%edx
+  800acc:	74 28                	je     800af6 <vprintfmt+0x238>
+  800ace:	85 ff                	test   %edi,%edi
+  800ad0:	78 05                	js     800ad7 <vprintfmt+0x219>
+  800ad2:	83 ef 01             	sub    $0x1,%edi
+  800ad5:	78 30                	js     800b07 <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  800ad7:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  800adb:	74 d6                	je     800ab3 <vprintfmt+0x1f5>
+  800add:	0f be c0             	movsbl %al,%eax
+  800ae0:	83 e8 20             	sub    $0x20,%eax
+  800ae3:	83 f8 5e             	cmp    $0x5e,%eax
+  800ae6:	76 cb                	jbe    800ab3 <vprintfmt+0x1f5>
+          putch('?', putdat);
+  800ae8:	83 ec 08             	sub    $0x8,%esp
+  800aeb:	53                   	push   %ebx
+  800aec:	6a 3f                	push   $0x3f
+  800aee:	ff 55 08             	call   *0x8(%ebp)
+  800af1:	83 c4 10             	add    $0x10,%esp
+  800af4:	eb c8                	jmp    800abe <vprintfmt+0x200>
+  800af6:	8b 75 08             	mov    0x8(%ebp),%esi
+  800af9:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  800afc:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800aff:	01 d0                	add    %edx,%eax
+  800b01:	29 c8                	sub    %ecx,%eax
+  800b03:	89 c7                	mov    %eax,%edi
+  800b05:	eb 13                	jmp    800b1a <vprintfmt+0x25c>
+  800b07:	8b 75 08             	mov    0x8(%ebp),%esi
+  800b0a:	eb ed                	jmp    800af9 <vprintfmt+0x23b>
+        putch(' ', putdat);
+  800b0c:	83 ec 08             	sub    $0x8,%esp
+  800b0f:	53                   	push   %ebx
+  800b10:	6a 20                	push   $0x20
+  800b12:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  800b14:	83 ef 01             	sub    $0x1,%edi
+  800b17:	83 c4 10             	add    $0x10,%esp
+  800b1a:	85 ff                	test   %edi,%edi
+  800b1c:	7f ee                	jg     800b0c <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  800b1e:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800b21:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b24:	e9 6b 01 00 00       	jmp    800c94 <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  800b29:	83 f9 01             	cmp    $0x1,%ecx
+  800b2c:	7f 1f                	jg     800b4d <vprintfmt+0x28f>
+  else if (lflag)
+  800b2e:	85 c9                	test   %ecx,%ecx
+  800b30:	74 67                	je     800b99 <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  800b32:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b35:	8b 00                	mov    (%eax),%eax
+  800b37:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800b3a:	89 c1                	mov    %eax,%ecx
+  800b3c:	c1 f9 1f             	sar    $0x1f,%ecx
+  800b3f:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800b42:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b45:	8d 40 04             	lea    0x4(%eax),%eax
+  800b48:	89 45 14             	mov    %eax,0x14(%ebp)
+  800b4b:	eb 17                	jmp    800b64 <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  800b4d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b50:	8b 50 04             	mov    0x4(%eax),%edx
+  800b53:	8b 00                	mov    (%eax),%eax
+  800b55:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800b58:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800b5b:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b5e:	8d 40 08             	lea    0x8(%eax),%eax
+  800b61:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  800b64:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800b67:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  800b6a:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  800b6f:	85 c9                	test   %ecx,%ecx
+  800b71:	0f 89 03 01 00 00    	jns    800c7a <vprintfmt+0x3bc>
+        putch('-', putdat);
+  800b77:	83 ec 08             	sub    $0x8,%esp
+  800b7a:	53                   	push   %ebx
+  800b7b:	6a 2d                	push   $0x2d
+  800b7d:	ff d6                	call   *%esi
+        num = -(long long)num;
+  800b7f:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800b82:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800b85:	f7 da                	neg    %edx
+  800b87:	83 d1 00             	adc    $0x0,%ecx
+  800b8a:	f7 d9                	neg    %ecx
+  800b8c:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  800b8f:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800b94:	e9 e1 00 00 00       	jmp    800c7a <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  800b99:	8b 45 14             	mov    0x14(%ebp),%eax
+  800b9c:	8b 00                	mov    (%eax),%eax
+  800b9e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800ba1:	89 c1                	mov    %eax,%ecx
+  800ba3:	c1 f9 1f             	sar    $0x1f,%ecx
+  800ba6:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800ba9:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bac:	8d 40 04             	lea    0x4(%eax),%eax
+  800baf:	89 45 14             	mov    %eax,0x14(%ebp)
+  800bb2:	eb b0                	jmp    800b64 <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  800bb4:	83 f9 01             	cmp    $0x1,%ecx
+  800bb7:	7f 1e                	jg     800bd7 <vprintfmt+0x319>
+  else if (lflag)
+  800bb9:	85 c9                	test   %ecx,%ecx
+  800bbb:	74 32                	je     800bef <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  800bbd:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bc0:	8b 10                	mov    (%eax),%edx
+  800bc2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bc7:	8d 40 04             	lea    0x4(%eax),%eax
+  800bca:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800bcd:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  800bd2:	e9 a3 00 00 00       	jmp    800c7a <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800bd7:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bda:	8b 10                	mov    (%eax),%edx
+  800bdc:	8b 48 04             	mov    0x4(%eax),%ecx
+  800bdf:	8d 40 08             	lea    0x8(%eax),%eax
+  800be2:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800be5:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  800bea:	e9 8b 00 00 00       	jmp    800c7a <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800bef:	8b 45 14             	mov    0x14(%ebp),%eax
+  800bf2:	8b 10                	mov    (%eax),%edx
+  800bf4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800bf9:	8d 40 04             	lea    0x4(%eax),%eax
+  800bfc:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800bff:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  800c04:	eb 74                	jmp    800c7a <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  800c06:	83 f9 01             	cmp    $0x1,%ecx
+  800c09:	7f 1b                	jg     800c26 <vprintfmt+0x368>
+  else if (lflag)
+  800c0b:	85 c9                	test   %ecx,%ecx
+  800c0d:	74 2c                	je     800c3b <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  800c0f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c12:	8b 10                	mov    (%eax),%edx
+  800c14:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c19:	8d 40 04             	lea    0x4(%eax),%eax
+  800c1c:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800c1f:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  800c24:	eb 54                	jmp    800c7a <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800c26:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c29:	8b 10                	mov    (%eax),%edx
+  800c2b:	8b 48 04             	mov    0x4(%eax),%ecx
+  800c2e:	8d 40 08             	lea    0x8(%eax),%eax
+  800c31:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800c34:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  800c39:	eb 3f                	jmp    800c7a <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800c3b:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c3e:	8b 10                	mov    (%eax),%edx
+  800c40:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800c45:	8d 40 04             	lea    0x4(%eax),%eax
+  800c48:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800c4b:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  800c50:	eb 28                	jmp    800c7a <vprintfmt+0x3bc>
+      putch('0', putdat);
+  800c52:	83 ec 08             	sub    $0x8,%esp
+  800c55:	53                   	push   %ebx
+  800c56:	6a 30                	push   $0x30
+  800c58:	ff d6                	call   *%esi
+      putch('x', putdat);
+  800c5a:	83 c4 08             	add    $0x8,%esp
+  800c5d:	53                   	push   %ebx
+  800c5e:	6a 78                	push   $0x78
+  800c60:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  800c62:	8b 45 14             	mov    0x14(%ebp),%eax
+  800c65:	8b 10                	mov    (%eax),%edx
+  800c67:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  800c6c:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  800c6f:	8d 40 04             	lea    0x4(%eax),%eax
+  800c72:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800c75:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  800c7a:	83 ec 0c             	sub    $0xc,%esp
+  800c7d:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  800c81:	50                   	push   %eax
+  800c82:	ff 75 e0             	push   -0x20(%ebp)
+  800c85:	57                   	push   %edi
+  800c86:	51                   	push   %ecx
+  800c87:	52                   	push   %edx
+  800c88:	89 da                	mov    %ebx,%edx
+  800c8a:	89 f0                	mov    %esi,%eax
+  800c8c:	e8 4a fb ff ff       	call   8007db <printnum>
+      break;
+  800c91:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  800c94:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  800c97:	e9 40 fc ff ff       	jmp    8008dc <vprintfmt+0x1e>
+  if (lflag >= 2)
+  800c9c:	83 f9 01             	cmp    $0x1,%ecx
+  800c9f:	7f 1b                	jg     800cbc <vprintfmt+0x3fe>
+  else if (lflag)
+  800ca1:	85 c9                	test   %ecx,%ecx
+  800ca3:	74 2c                	je     800cd1 <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  800ca5:	8b 45 14             	mov    0x14(%ebp),%eax
+  800ca8:	8b 10                	mov    (%eax),%edx
+  800caa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800caf:	8d 40 04             	lea    0x4(%eax),%eax
+  800cb2:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800cb5:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  800cba:	eb be                	jmp    800c7a <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800cbc:	8b 45 14             	mov    0x14(%ebp),%eax
+  800cbf:	8b 10                	mov    (%eax),%edx
+  800cc1:	8b 48 04             	mov    0x4(%eax),%ecx
+  800cc4:	8d 40 08             	lea    0x8(%eax),%eax
+  800cc7:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800cca:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  800ccf:	eb a9                	jmp    800c7a <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800cd1:	8b 45 14             	mov    0x14(%ebp),%eax
+  800cd4:	8b 10                	mov    (%eax),%edx
+  800cd6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800cdb:	8d 40 04             	lea    0x4(%eax),%eax
+  800cde:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800ce1:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  800ce6:	eb 92                	jmp    800c7a <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  800ce8:	83 ec 08             	sub    $0x8,%esp
+  800ceb:	53                   	push   %ebx
+  800cec:	6a 25                	push   $0x25
+  800cee:	ff d6                	call   *%esi
+      break;
+  800cf0:	83 c4 10             	add    $0x10,%esp
+  800cf3:	eb 9f                	jmp    800c94 <vprintfmt+0x3d6>
+      putch('%', putdat);
+  800cf5:	83 ec 08             	sub    $0x8,%esp
+  800cf8:	53                   	push   %ebx
+  800cf9:	6a 25                	push   $0x25
+  800cfb:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  800cfd:	83 c4 10             	add    $0x10,%esp
+  800d00:	89 f8                	mov    %edi,%eax
+  800d02:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800d06:	74 05                	je     800d0d <vprintfmt+0x44f>
+  800d08:	83 e8 01             	sub    $0x1,%eax
+  800d0b:	eb f5                	jmp    800d02 <vprintfmt+0x444>
+  800d0d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800d10:	eb 82                	jmp    800c94 <vprintfmt+0x3d6>
+
+00800d12 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800d12:	55                   	push   %ebp
+  800d13:	89 e5                	mov    %esp,%ebp
+  800d15:	83 ec 18             	sub    $0x18,%esp
+  800d18:	8b 45 08             	mov    0x8(%ebp),%eax
+  800d1b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  800d1e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800d21:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800d25:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800d28:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  800d2f:	85 c0                	test   %eax,%eax
+  800d31:	74 26                	je     800d59 <vsnprintf+0x47>
+  800d33:	85 d2                	test   %edx,%edx
+  800d35:	7e 22                	jle    800d59 <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800d37:	ff 75 14             	push   0x14(%ebp)
+  800d3a:	ff 75 10             	push   0x10(%ebp)
+  800d3d:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800d40:	50                   	push   %eax
+  800d41:	68 84 08 80 00       	push   $0x800884
+  800d46:	e8 73 fb ff ff       	call   8008be <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800d4b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  800d4e:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  800d51:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800d54:	83 c4 10             	add    $0x10,%esp
+}
+  800d57:	c9                   	leave
+  800d58:	c3                   	ret
+    return -E_INVAL;
+  800d59:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d5e:	eb f7                	jmp    800d57 <vsnprintf+0x45>
+
+00800d60 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  800d60:	55                   	push   %ebp
+  800d61:	89 e5                	mov    %esp,%ebp
+  800d63:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  800d66:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  800d69:	50                   	push   %eax
+  800d6a:	ff 75 10             	push   0x10(%ebp)
+  800d6d:	ff 75 0c             	push   0xc(%ebp)
+  800d70:	ff 75 08             	push   0x8(%ebp)
+  800d73:	e8 9a ff ff ff       	call   800d12 <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  800d78:	c9                   	leave
+  800d79:	c3                   	ret
+
+00800d7a <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800d7a:	55                   	push   %ebp
+  800d7b:	89 e5                	mov    %esp,%ebp
+  800d7d:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  800d80:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d85:	eb 03                	jmp    800d8a <strlen+0x10>
+    n++;
+  800d87:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  800d8a:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800d8e:	75 f7                	jne    800d87 <strlen+0xd>
+  return n;
+}
+  800d90:	5d                   	pop    %ebp
+  800d91:	c3                   	ret
+
+00800d92 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800d92:	55                   	push   %ebp
+  800d93:	89 e5                	mov    %esp,%ebp
+  800d95:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800d98:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800d9b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800da0:	eb 03                	jmp    800da5 <strnlen+0x13>
+    n++;
+  800da2:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800da5:	39 d0                	cmp    %edx,%eax
+  800da7:	74 08                	je     800db1 <strnlen+0x1f>
+  800da9:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800dad:	75 f3                	jne    800da2 <strnlen+0x10>
+  800daf:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  800db1:	89 d0                	mov    %edx,%eax
+  800db3:	5d                   	pop    %ebp
+  800db4:	c3                   	ret
+
+00800db5 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800db5:	55                   	push   %ebp
+  800db6:	89 e5                	mov    %esp,%ebp
+  800db8:	53                   	push   %ebx
+  800db9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800dbc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  800dbf:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dc4:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800dc8:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800dcb:	83 c0 01             	add    $0x1,%eax
+  800dce:	84 d2                	test   %dl,%dl
+  800dd0:	75 f2                	jne    800dc4 <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  800dd2:	89 c8                	mov    %ecx,%eax
+  800dd4:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800dd7:	c9                   	leave
+  800dd8:	c3                   	ret
+
+00800dd9 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800dd9:	55                   	push   %ebp
+  800dda:	89 e5                	mov    %esp,%ebp
+  800ddc:	53                   	push   %ebx
+  800ddd:	83 ec 10             	sub    $0x10,%esp
+  800de0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  800de3:	53                   	push   %ebx
+  800de4:	e8 91 ff ff ff       	call   800d7a <strlen>
+  800de9:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  800dec:	ff 75 0c             	push   0xc(%ebp)
+  800def:	01 d8                	add    %ebx,%eax
+  800df1:	50                   	push   %eax
+  800df2:	e8 be ff ff ff       	call   800db5 <strcpy>
+  return dst;
+}
+  800df7:	89 d8                	mov    %ebx,%eax
+  800df9:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800dfc:	c9                   	leave
+  800dfd:	c3                   	ret
+
+00800dfe <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  800dfe:	55                   	push   %ebp
+  800dff:	89 e5                	mov    %esp,%ebp
+  800e01:	56                   	push   %esi
+  800e02:	53                   	push   %ebx
+  800e03:	8b 75 08             	mov    0x8(%ebp),%esi
+  800e06:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  800e09:	89 f3                	mov    %esi,%ebx
+  800e0b:	03 5d 10             	add    0x10(%ebp),%ebx
+  800e0e:	89 f0                	mov    %esi,%eax
+  800e10:	eb 0f                	jmp    800e21 <strncpy+0x23>
+    *dst++ = *src;
+  800e12:	83 c0 01             	add    $0x1,%eax
+  800e15:	0f b6 0a             	movzbl (%edx),%ecx
+  800e18:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  800e1b:	80 f9 01             	cmp    $0x1,%cl
+  800e1e:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  800e21:	39 d8                	cmp    %ebx,%eax
+  800e23:	75 ed                	jne    800e12 <strncpy+0x14>
+  }
+  return ret;
+}
+  800e25:	89 f0                	mov    %esi,%eax
+  800e27:	5b                   	pop    %ebx
+  800e28:	5e                   	pop    %esi
+  800e29:	5d                   	pop    %ebp
+  800e2a:	c3                   	ret
+
+00800e2b <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800e2b:	55                   	push   %ebp
+  800e2c:	89 e5                	mov    %esp,%ebp
+  800e2e:	56                   	push   %esi
+  800e2f:	53                   	push   %ebx
+  800e30:	8b 75 08             	mov    0x8(%ebp),%esi
+  800e33:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e36:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  800e39:	89 f0                	mov    %esi,%eax
+  800e3b:	85 d2                	test   %edx,%edx
+  800e3d:	74 21                	je     800e60 <strlcpy+0x35>
+  800e3f:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800e43:	89 f2                	mov    %esi,%edx
+  800e45:	eb 09                	jmp    800e50 <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  800e47:	83 c1 01             	add    $0x1,%ecx
+  800e4a:	83 c2 01             	add    $0x1,%edx
+  800e4d:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  800e50:	39 c2                	cmp    %eax,%edx
+  800e52:	74 09                	je     800e5d <strlcpy+0x32>
+  800e54:	0f b6 19             	movzbl (%ecx),%ebx
+  800e57:	84 db                	test   %bl,%bl
+  800e59:	75 ec                	jne    800e47 <strlcpy+0x1c>
+  800e5b:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  800e5d:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  800e60:	29 f0                	sub    %esi,%eax
+}
+  800e62:	5b                   	pop    %ebx
+  800e63:	5e                   	pop    %esi
+  800e64:	5d                   	pop    %ebp
+  800e65:	c3                   	ret
+
+00800e66 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800e66:	55                   	push   %ebp
+  800e67:	89 e5                	mov    %esp,%ebp
+  800e69:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800e6c:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  800e6f:	eb 06                	jmp    800e77 <strcmp+0x11>
+    p++, q++;
+  800e71:	83 c1 01             	add    $0x1,%ecx
+  800e74:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  800e77:	0f b6 01             	movzbl (%ecx),%eax
+  800e7a:	84 c0                	test   %al,%al
+  800e7c:	74 04                	je     800e82 <strcmp+0x1c>
+  800e7e:	3a 02                	cmp    (%edx),%al
+  800e80:	74 ef                	je     800e71 <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  800e82:	0f b6 c0             	movzbl %al,%eax
+  800e85:	0f b6 12             	movzbl (%edx),%edx
+  800e88:	29 d0                	sub    %edx,%eax
+}
+  800e8a:	5d                   	pop    %ebp
+  800e8b:	c3                   	ret
+
+00800e8c <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800e8c:	55                   	push   %ebp
+  800e8d:	89 e5                	mov    %esp,%ebp
+  800e8f:	53                   	push   %ebx
+  800e90:	8b 45 08             	mov    0x8(%ebp),%eax
+  800e93:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e96:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  800e99:	eb 09                	jmp    800ea4 <strncmp+0x18>
+    n--, p++, q++;
+  800e9b:	83 ea 01             	sub    $0x1,%edx
+  800e9e:	83 c0 01             	add    $0x1,%eax
+  800ea1:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  800ea4:	85 d2                	test   %edx,%edx
+  800ea6:	74 18                	je     800ec0 <strncmp+0x34>
+  800ea8:	0f b6 18             	movzbl (%eax),%ebx
+  800eab:	84 db                	test   %bl,%bl
+  800ead:	74 04                	je     800eb3 <strncmp+0x27>
+  800eaf:	3a 19                	cmp    (%ecx),%bl
+  800eb1:	74 e8                	je     800e9b <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800eb3:	0f b6 00             	movzbl (%eax),%eax
+  800eb6:	0f b6 11             	movzbl (%ecx),%edx
+  800eb9:	29 d0                	sub    %edx,%eax
+}
+  800ebb:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ebe:	c9                   	leave
+  800ebf:	c3                   	ret
+    return 0;
+  800ec0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ec5:	eb f4                	jmp    800ebb <strncmp+0x2f>
+
+00800ec7 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800ec7:	55                   	push   %ebp
+  800ec8:	89 e5                	mov    %esp,%ebp
+  800eca:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ecd:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800ed1:	eb 03                	jmp    800ed6 <strchr+0xf>
+  800ed3:	83 c0 01             	add    $0x1,%eax
+  800ed6:	0f b6 10             	movzbl (%eax),%edx
+  800ed9:	84 d2                	test   %dl,%dl
+  800edb:	74 06                	je     800ee3 <strchr+0x1c>
+    if (*s == c)
+  800edd:	38 ca                	cmp    %cl,%dl
+  800edf:	75 f2                	jne    800ed3 <strchr+0xc>
+  800ee1:	eb 05                	jmp    800ee8 <strchr+0x21>
+      return (char*)s;
+  return 0;
+  800ee3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ee8:	5d                   	pop    %ebp
+  800ee9:	c3                   	ret
+
+00800eea <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800eea:	55                   	push   %ebp
+  800eeb:	89 e5                	mov    %esp,%ebp
+  800eed:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ef0:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800ef4:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  800ef7:	38 ca                	cmp    %cl,%dl
+  800ef9:	74 09                	je     800f04 <strfind+0x1a>
+  800efb:	84 d2                	test   %dl,%dl
+  800efd:	74 05                	je     800f04 <strfind+0x1a>
+  for (; *s; s++)
+  800eff:	83 c0 01             	add    $0x1,%eax
+  800f02:	eb f0                	jmp    800ef4 <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  800f04:	5d                   	pop    %ebp
+  800f05:	c3                   	ret
+
+00800f06 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800f06:	55                   	push   %ebp
+  800f07:	89 e5                	mov    %esp,%ebp
+  800f09:	57                   	push   %edi
+  800f0a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800f0d:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  800f10:	85 c9                	test   %ecx,%ecx
+  800f12:	74 20                	je     800f34 <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  800f14:	89 f8                	mov    %edi,%eax
+  800f16:	09 c8                	or     %ecx,%eax
+  800f18:	a8 03                	test   $0x3,%al
+  800f1a:	75 12                	jne    800f2e <memset+0x28>
+    c &= 0xFF;
+  800f1c:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800f20:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  800f26:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  800f29:	fc                   	cld
+  800f2a:	f3 ab                	rep stos %eax,%es:(%edi)
+  800f2c:	eb 06                	jmp    800f34 <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  800f2e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800f31:	fc                   	cld
+  800f32:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  800f34:	89 f8                	mov    %edi,%eax
+  800f36:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800f39:	c9                   	leave
+  800f3a:	c3                   	ret
+
+00800f3b <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800f3b:	55                   	push   %ebp
+  800f3c:	89 e5                	mov    %esp,%ebp
+  800f3e:	57                   	push   %edi
+  800f3f:	56                   	push   %esi
+  800f40:	8b 45 08             	mov    0x8(%ebp),%eax
+  800f43:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800f46:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  800f49:	39 c6                	cmp    %eax,%esi
+  800f4b:	73 32                	jae    800f7f <memmove+0x44>
+  800f4d:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800f50:	39 d0                	cmp    %edx,%eax
+  800f52:	73 2b                	jae    800f7f <memmove+0x44>
+    s += n;
+    d += n;
+  800f54:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800f57:	89 d6                	mov    %edx,%esi
+  800f59:	09 fe                	or     %edi,%esi
+  800f5b:	09 ce                	or     %ecx,%esi
+  800f5d:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800f63:	75 0e                	jne    800f73 <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800f65:	83 ef 04             	sub    $0x4,%edi
+  800f68:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800f6b:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  800f6e:	fd                   	std
+  800f6f:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800f71:	eb 09                	jmp    800f7c <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800f73:	83 ef 01             	sub    $0x1,%edi
+  800f76:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  800f79:	fd                   	std
+  800f7a:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  800f7c:	fc                   	cld
+  800f7d:	eb 1a                	jmp    800f99 <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800f7f:	89 f2                	mov    %esi,%edx
+  800f81:	09 c2                	or     %eax,%edx
+  800f83:	09 ca                	or     %ecx,%edx
+  800f85:	f6 c2 03             	test   $0x3,%dl
+  800f88:	75 0a                	jne    800f94 <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800f8a:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  800f8d:	89 c7                	mov    %eax,%edi
+  800f8f:	fc                   	cld
+  800f90:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800f92:	eb 05                	jmp    800f99 <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  800f94:	89 c7                	mov    %eax,%edi
+  800f96:	fc                   	cld
+  800f97:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  800f99:	5e                   	pop    %esi
+  800f9a:	5f                   	pop    %edi
+  800f9b:	5d                   	pop    %ebp
+  800f9c:	c3                   	ret
+
+00800f9d <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800f9d:	55                   	push   %ebp
+  800f9e:	89 e5                	mov    %esp,%ebp
+  800fa0:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  800fa3:	ff 75 10             	push   0x10(%ebp)
+  800fa6:	ff 75 0c             	push   0xc(%ebp)
+  800fa9:	ff 75 08             	push   0x8(%ebp)
+  800fac:	e8 8a ff ff ff       	call   800f3b <memmove>
+}
+  800fb1:	c9                   	leave
+  800fb2:	c3                   	ret
+
+00800fb3 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800fb3:	55                   	push   %ebp
+  800fb4:	89 e5                	mov    %esp,%ebp
+  800fb6:	56                   	push   %esi
+  800fb7:	53                   	push   %ebx
+  800fb8:	8b 45 08             	mov    0x8(%ebp),%eax
+  800fbb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  800fbe:	89 c6                	mov    %eax,%esi
+  800fc0:	03 75 10             	add    0x10(%ebp),%esi
+  800fc3:	eb 06                	jmp    800fcb <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  800fc5:	83 c0 01             	add    $0x1,%eax
+  800fc8:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  800fcb:	39 f0                	cmp    %esi,%eax
+  800fcd:	74 14                	je     800fe3 <memcmp+0x30>
+    if (*s1 != *s2)
+  800fcf:	0f b6 08             	movzbl (%eax),%ecx
+  800fd2:	0f b6 1a             	movzbl (%edx),%ebx
+  800fd5:	38 d9                	cmp    %bl,%cl
+  800fd7:	74 ec                	je     800fc5 <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  800fd9:	0f b6 c1             	movzbl %cl,%eax
+  800fdc:	0f b6 db             	movzbl %bl,%ebx
+  800fdf:	29 d8                	sub    %ebx,%eax
+  800fe1:	eb 05                	jmp    800fe8 <memcmp+0x35>
+  }
+
+  return 0;
+  800fe3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fe8:	5b                   	pop    %ebx
+  800fe9:	5e                   	pop    %esi
+  800fea:	5d                   	pop    %ebp
+  800feb:	c3                   	ret
+
+00800fec <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800fec:	55                   	push   %ebp
+  800fed:	89 e5                	mov    %esp,%ebp
+  800fef:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ff2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  800ff5:	89 c2                	mov    %eax,%edx
+  800ff7:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  800ffa:	eb 03                	jmp    800fff <memfind+0x13>
+  800ffc:	83 c0 01             	add    $0x1,%eax
+  800fff:	39 d0                	cmp    %edx,%eax
+  801001:	73 04                	jae    801007 <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  801003:	38 08                	cmp    %cl,(%eax)
+  801005:	75 f5                	jne    800ffc <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  801007:	5d                   	pop    %ebp
+  801008:	c3                   	ret
+
+00801009 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  801009:	55                   	push   %ebp
+  80100a:	89 e5                	mov    %esp,%ebp
+  80100c:	57                   	push   %edi
+  80100d:	56                   	push   %esi
+  80100e:	53                   	push   %ebx
+  80100f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801012:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  801015:	eb 03                	jmp    80101a <strtol+0x11>
+    s++;
+  801017:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  80101a:	0f b6 02             	movzbl (%edx),%eax
+  80101d:	3c 20                	cmp    $0x20,%al
+  80101f:	74 f6                	je     801017 <strtol+0xe>
+  801021:	3c 09                	cmp    $0x9,%al
+  801023:	74 f2                	je     801017 <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  801025:	3c 2b                	cmp    $0x2b,%al
+  801027:	74 2a                	je     801053 <strtol+0x4a>
+  int neg = 0;
+  801029:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  80102e:	3c 2d                	cmp    $0x2d,%al
+  801030:	74 2b                	je     80105d <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801032:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  801038:	75 0f                	jne    801049 <strtol+0x40>
+  80103a:	80 3a 30             	cmpb   $0x30,(%edx)
+  80103d:	74 28                	je     801067 <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  80103f:	85 db                	test   %ebx,%ebx
+  801041:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801046:	0f 44 d8             	cmove  %eax,%ebx
+  801049:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80104e:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  801051:	eb 46                	jmp    801099 <strtol+0x90>
+    s++;
+  801053:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  801056:	bf 00 00 00 00       	mov    $0x0,%edi
+  80105b:	eb d5                	jmp    801032 <strtol+0x29>
+    s++, neg = 1;
+  80105d:	83 c2 01             	add    $0x1,%edx
+  801060:	bf 01 00 00 00       	mov    $0x1,%edi
+  801065:	eb cb                	jmp    801032 <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  801067:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  80106b:	74 0e                	je     80107b <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  80106d:	85 db                	test   %ebx,%ebx
+  80106f:	75 d8                	jne    801049 <strtol+0x40>
+    s++, base = 8;
+  801071:	83 c2 01             	add    $0x1,%edx
+  801074:	bb 08 00 00 00       	mov    $0x8,%ebx
+  801079:	eb ce                	jmp    801049 <strtol+0x40>
+    s += 2, base = 16;
+  80107b:	83 c2 02             	add    $0x2,%edx
+  80107e:	bb 10 00 00 00       	mov    $0x10,%ebx
+  801083:	eb c4                	jmp    801049 <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  801085:	0f be c0             	movsbl %al,%eax
+  801088:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  80108b:	3b 45 10             	cmp    0x10(%ebp),%eax
+  80108e:	7d 3a                	jge    8010ca <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  801090:	83 c2 01             	add    $0x1,%edx
+  801093:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  801097:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  801099:	0f b6 02             	movzbl (%edx),%eax
+  80109c:	8d 70 d0             	lea    -0x30(%eax),%esi
+  80109f:	89 f3                	mov    %esi,%ebx
+  8010a1:	80 fb 09             	cmp    $0x9,%bl
+  8010a4:	76 df                	jbe    801085 <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  8010a6:	8d 70 9f             	lea    -0x61(%eax),%esi
+  8010a9:	89 f3                	mov    %esi,%ebx
+  8010ab:	80 fb 19             	cmp    $0x19,%bl
+  8010ae:	77 08                	ja     8010b8 <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  8010b0:	0f be c0             	movsbl %al,%eax
+  8010b3:	83 e8 57             	sub    $0x57,%eax
+  8010b6:	eb d3                	jmp    80108b <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  8010b8:	8d 70 bf             	lea    -0x41(%eax),%esi
+  8010bb:	89 f3                	mov    %esi,%ebx
+  8010bd:	80 fb 19             	cmp    $0x19,%bl
+  8010c0:	77 08                	ja     8010ca <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  8010c2:	0f be c0             	movsbl %al,%eax
+  8010c5:	83 e8 37             	sub    $0x37,%eax
+  8010c8:	eb c1                	jmp    80108b <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  8010ca:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8010ce:	74 05                	je     8010d5 <strtol+0xcc>
+    *endptr = (char*)s;
+  8010d0:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8010d3:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  8010d5:	89 c8                	mov    %ecx,%eax
+  8010d7:	f7 d8                	neg    %eax
+  8010d9:	85 ff                	test   %edi,%edi
+  8010db:	0f 45 c8             	cmovne %eax,%ecx
+}
+  8010de:	89 c8                	mov    %ecx,%eax
+  8010e0:	5b                   	pop    %ebx
+  8010e1:	5e                   	pop    %esi
+  8010e2:	5f                   	pop    %edi
+  8010e3:	5d                   	pop    %ebp
+  8010e4:	c3                   	ret
+
+008010e5 <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  8010e5:	55                   	push   %ebp
+  8010e6:	89 e5                	mov    %esp,%ebp
+  8010e8:	57                   	push   %edi
+  8010e9:	56                   	push   %esi
+  8010ea:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8010eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010f0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f3:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010f6:	89 c3                	mov    %eax,%ebx
+  8010f8:	89 c7                	mov    %eax,%edi
+  8010fa:	89 c6                	mov    %eax,%esi
+  8010fc:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  8010fe:	5b                   	pop    %ebx
+  8010ff:	5e                   	pop    %esi
+  801100:	5f                   	pop    %edi
+  801101:	5d                   	pop    %ebp
+  801102:	c3                   	ret
+
+00801103 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  801103:	55                   	push   %ebp
+  801104:	89 e5                	mov    %esp,%ebp
+  801106:	57                   	push   %edi
+  801107:	56                   	push   %esi
+  801108:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801109:	ba 00 00 00 00       	mov    $0x0,%edx
+  80110e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801113:	89 d1                	mov    %edx,%ecx
+  801115:	89 d3                	mov    %edx,%ebx
+  801117:	89 d7                	mov    %edx,%edi
+  801119:	89 d6                	mov    %edx,%esi
+  80111b:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  80111d:	5b                   	pop    %ebx
+  80111e:	5e                   	pop    %esi
+  80111f:	5f                   	pop    %edi
+  801120:	5d                   	pop    %ebp
+  801121:	c3                   	ret
+
+00801122 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  801122:	55                   	push   %ebp
+  801123:	89 e5                	mov    %esp,%ebp
+  801125:	57                   	push   %edi
+  801126:	56                   	push   %esi
+  801127:	53                   	push   %ebx
+  801128:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80112b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801130:	8b 55 08             	mov    0x8(%ebp),%edx
+  801133:	b8 03 00 00 00       	mov    $0x3,%eax
+  801138:	89 cb                	mov    %ecx,%ebx
+  80113a:	89 cf                	mov    %ecx,%edi
+  80113c:	89 ce                	mov    %ecx,%esi
+  80113e:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801140:	85 c0                	test   %eax,%eax
+  801142:	7f 08                	jg     80114c <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  801144:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801147:	5b                   	pop    %ebx
+  801148:	5e                   	pop    %esi
+  801149:	5f                   	pop    %edi
+  80114a:	5d                   	pop    %ebp
+  80114b:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80114c:	83 ec 0c             	sub    $0xc,%esp
+  80114f:	50                   	push   %eax
+  801150:	6a 03                	push   $0x3
+  801152:	68 a3 3b 80 00       	push   $0x803ba3
+  801157:	6a 23                	push   $0x23
+  801159:	68 c0 3b 80 00       	push   $0x803bc0
+  80115e:	e8 89 f5 ff ff       	call   8006ec <_panic>
+
+00801163 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  801163:	55                   	push   %ebp
+  801164:	89 e5                	mov    %esp,%ebp
+  801166:	57                   	push   %edi
+  801167:	56                   	push   %esi
+  801168:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801169:	ba 00 00 00 00       	mov    $0x0,%edx
+  80116e:	b8 02 00 00 00       	mov    $0x2,%eax
+  801173:	89 d1                	mov    %edx,%ecx
+  801175:	89 d3                	mov    %edx,%ebx
+  801177:	89 d7                	mov    %edx,%edi
+  801179:	89 d6                	mov    %edx,%esi
+  80117b:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  80117d:	5b                   	pop    %ebx
+  80117e:	5e                   	pop    %esi
+  80117f:	5f                   	pop    %edi
+  801180:	5d                   	pop    %ebp
+  801181:	c3                   	ret
+
+00801182 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  801182:	55                   	push   %ebp
+  801183:	89 e5                	mov    %esp,%ebp
+  801185:	57                   	push   %edi
+  801186:	56                   	push   %esi
+  801187:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801188:	ba 00 00 00 00       	mov    $0x0,%edx
+  80118d:	b8 0b 00 00 00       	mov    $0xb,%eax
+  801192:	89 d1                	mov    %edx,%ecx
+  801194:	89 d3                	mov    %edx,%ebx
+  801196:	89 d7                	mov    %edx,%edi
+  801198:	89 d6                	mov    %edx,%esi
+  80119a:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  80119c:	5b                   	pop    %ebx
+  80119d:	5e                   	pop    %esi
+  80119e:	5f                   	pop    %edi
+  80119f:	5d                   	pop    %ebp
+  8011a0:	c3                   	ret
+
+008011a1 <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  8011a1:	55                   	push   %ebp
+  8011a2:	89 e5                	mov    %esp,%ebp
+  8011a4:	57                   	push   %edi
+  8011a5:	56                   	push   %esi
+  8011a6:	53                   	push   %ebx
+  8011a7:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  8011aa:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  8011ae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8011b3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011b6:	b8 14 00 00 00       	mov    $0x14,%eax
+  8011bb:	89 df                	mov    %ebx,%edi
+  8011bd:	89 de                	mov    %ebx,%esi
+  8011bf:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8011c1:	85 c0                	test   %eax,%eax
+  8011c3:	7f 08                	jg     8011cd <sys_env_set_cow+0x2c>
+}
+  8011c5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011c8:	5b                   	pop    %ebx
+  8011c9:	5e                   	pop    %esi
+  8011ca:	5f                   	pop    %edi
+  8011cb:	5d                   	pop    %ebp
+  8011cc:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8011cd:	83 ec 0c             	sub    $0xc,%esp
+  8011d0:	50                   	push   %eax
+  8011d1:	6a 14                	push   $0x14
+  8011d3:	68 a3 3b 80 00       	push   $0x803ba3
+  8011d8:	6a 23                	push   $0x23
+  8011da:	68 c0 3b 80 00       	push   $0x803bc0
+  8011df:	e8 08 f5 ff ff       	call   8006ec <_panic>
+
+008011e4 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  8011e4:	55                   	push   %ebp
+  8011e5:	89 e5                	mov    %esp,%ebp
+  8011e7:	57                   	push   %edi
+  8011e8:	56                   	push   %esi
+  8011e9:	53                   	push   %ebx
+  8011ea:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8011ed:	be 00 00 00 00       	mov    $0x0,%esi
+  8011f2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011f5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011f8:	b8 04 00 00 00       	mov    $0x4,%eax
+  8011fd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801200:	89 f7                	mov    %esi,%edi
+  801202:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801204:	85 c0                	test   %eax,%eax
+  801206:	7f 08                	jg     801210 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  801208:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80120b:	5b                   	pop    %ebx
+  80120c:	5e                   	pop    %esi
+  80120d:	5f                   	pop    %edi
+  80120e:	5d                   	pop    %ebp
+  80120f:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801210:	83 ec 0c             	sub    $0xc,%esp
+  801213:	50                   	push   %eax
+  801214:	6a 04                	push   $0x4
+  801216:	68 a3 3b 80 00       	push   $0x803ba3
+  80121b:	6a 23                	push   $0x23
+  80121d:	68 c0 3b 80 00       	push   $0x803bc0
+  801222:	e8 c5 f4 ff ff       	call   8006ec <_panic>
+
+00801227 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  801227:	55                   	push   %ebp
+  801228:	89 e5                	mov    %esp,%ebp
+  80122a:	57                   	push   %edi
+  80122b:	56                   	push   %esi
+  80122c:	53                   	push   %ebx
+  80122d:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801230:	8b 55 08             	mov    0x8(%ebp),%edx
+  801233:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801236:	b8 05 00 00 00       	mov    $0x5,%eax
+  80123b:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80123e:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801241:	8b 75 18             	mov    0x18(%ebp),%esi
+  801244:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801246:	85 c0                	test   %eax,%eax
+  801248:	7f 08                	jg     801252 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  80124a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80124d:	5b                   	pop    %ebx
+  80124e:	5e                   	pop    %esi
+  80124f:	5f                   	pop    %edi
+  801250:	5d                   	pop    %ebp
+  801251:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801252:	83 ec 0c             	sub    $0xc,%esp
+  801255:	50                   	push   %eax
+  801256:	6a 05                	push   $0x5
+  801258:	68 a3 3b 80 00       	push   $0x803ba3
+  80125d:	6a 23                	push   $0x23
+  80125f:	68 c0 3b 80 00       	push   $0x803bc0
+  801264:	e8 83 f4 ff ff       	call   8006ec <_panic>
+
+00801269 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  801269:	55                   	push   %ebp
+  80126a:	89 e5                	mov    %esp,%ebp
+  80126c:	57                   	push   %edi
+  80126d:	56                   	push   %esi
+  80126e:	53                   	push   %ebx
+  80126f:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801272:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801277:	8b 55 08             	mov    0x8(%ebp),%edx
+  80127a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80127d:	b8 06 00 00 00       	mov    $0x6,%eax
+  801282:	89 df                	mov    %ebx,%edi
+  801284:	89 de                	mov    %ebx,%esi
+  801286:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801288:	85 c0                	test   %eax,%eax
+  80128a:	7f 08                	jg     801294 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  80128c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80128f:	5b                   	pop    %ebx
+  801290:	5e                   	pop    %esi
+  801291:	5f                   	pop    %edi
+  801292:	5d                   	pop    %ebp
+  801293:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801294:	83 ec 0c             	sub    $0xc,%esp
+  801297:	50                   	push   %eax
+  801298:	6a 06                	push   $0x6
+  80129a:	68 a3 3b 80 00       	push   $0x803ba3
+  80129f:	6a 23                	push   $0x23
+  8012a1:	68 c0 3b 80 00       	push   $0x803bc0
+  8012a6:	e8 41 f4 ff ff       	call   8006ec <_panic>
+
+008012ab <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  8012ab:	55                   	push   %ebp
+  8012ac:	89 e5                	mov    %esp,%ebp
+  8012ae:	57                   	push   %edi
+  8012af:	56                   	push   %esi
+  8012b0:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8012b1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012b4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012b7:	b8 11 00 00 00       	mov    $0x11,%eax
+  8012bc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012bf:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012c2:	8b 75 18             	mov    0x18(%ebp),%esi
+  8012c5:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  8012c7:	5b                   	pop    %ebx
+  8012c8:	5e                   	pop    %esi
+  8012c9:	5f                   	pop    %edi
+  8012ca:	5d                   	pop    %ebp
+  8012cb:	c3                   	ret
+
+008012cc <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  8012cc:	55                   	push   %ebp
+  8012cd:	89 e5                	mov    %esp,%ebp
+  8012cf:	57                   	push   %edi
+  8012d0:	56                   	push   %esi
+  8012d1:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8012d2:	8b 55 08             	mov    0x8(%ebp),%edx
+  8012d5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8012d8:	b8 12 00 00 00       	mov    $0x12,%eax
+  8012dd:	be 00 00 00 00       	mov    $0x0,%esi
+  8012e2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8012e5:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8012e8:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  8012ea:	5b                   	pop    %ebx
+  8012eb:	5e                   	pop    %esi
+  8012ec:	5f                   	pop    %edi
+  8012ed:	5d                   	pop    %ebp
+  8012ee:	c3                   	ret
+
+008012ef <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  8012ef:	55                   	push   %ebp
+  8012f0:	89 e5                	mov    %esp,%ebp
+  8012f2:	57                   	push   %edi
+  8012f3:	56                   	push   %esi
+  8012f4:	53                   	push   %ebx
+  8012f5:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8012f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012fd:	8b 55 08             	mov    0x8(%ebp),%edx
+  801300:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801303:	b8 16 00 00 00       	mov    $0x16,%eax
+  801308:	89 df                	mov    %ebx,%edi
+  80130a:	89 de                	mov    %ebx,%esi
+  80130c:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80130e:	85 c0                	test   %eax,%eax
+  801310:	7f 08                	jg     80131a <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  801312:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801315:	5b                   	pop    %ebx
+  801316:	5e                   	pop    %esi
+  801317:	5f                   	pop    %edi
+  801318:	5d                   	pop    %ebp
+  801319:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80131a:	83 ec 0c             	sub    $0xc,%esp
+  80131d:	50                   	push   %eax
+  80131e:	6a 16                	push   $0x16
+  801320:	68 a3 3b 80 00       	push   $0x803ba3
+  801325:	6a 23                	push   $0x23
+  801327:	68 c0 3b 80 00       	push   $0x803bc0
+  80132c:	e8 bb f3 ff ff       	call   8006ec <_panic>
+
+00801331 <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  801331:	55                   	push   %ebp
+  801332:	89 e5                	mov    %esp,%ebp
+  801334:	57                   	push   %edi
+  801335:	56                   	push   %esi
+  801336:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801337:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80133c:	8b 55 08             	mov    0x8(%ebp),%edx
+  80133f:	b8 17 00 00 00       	mov    $0x17,%eax
+  801344:	89 cb                	mov    %ecx,%ebx
+  801346:	89 cf                	mov    %ecx,%edi
+  801348:	89 ce                	mov    %ecx,%esi
+  80134a:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  80134c:	5b                   	pop    %ebx
+  80134d:	5e                   	pop    %esi
+  80134e:	5f                   	pop    %edi
+  80134f:	5d                   	pop    %ebp
+  801350:	c3                   	ret
+
+00801351 <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  801351:	55                   	push   %ebp
+  801352:	89 e5                	mov    %esp,%ebp
+  801354:	57                   	push   %edi
+  801355:	56                   	push   %esi
+  801356:	53                   	push   %ebx
+  801357:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80135a:	be 00 00 00 00       	mov    $0x0,%esi
+  80135f:	8b 55 08             	mov    0x8(%ebp),%edx
+  801362:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801365:	b8 18 00 00 00       	mov    $0x18,%eax
+  80136a:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80136d:	89 f7                	mov    %esi,%edi
+  80136f:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801371:	85 c0                	test   %eax,%eax
+  801373:	7f 08                	jg     80137d <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  801375:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801378:	5b                   	pop    %ebx
+  801379:	5e                   	pop    %esi
+  80137a:	5f                   	pop    %edi
+  80137b:	5d                   	pop    %ebp
+  80137c:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80137d:	83 ec 0c             	sub    $0xc,%esp
+  801380:	50                   	push   %eax
+  801381:	6a 18                	push   $0x18
+  801383:	68 a3 3b 80 00       	push   $0x803ba3
+  801388:	6a 23                	push   $0x23
+  80138a:	68 c0 3b 80 00       	push   $0x803bc0
+  80138f:	e8 58 f3 ff ff       	call   8006ec <_panic>
+
+00801394 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  801394:	55                   	push   %ebp
+  801395:	89 e5                	mov    %esp,%ebp
+  801397:	57                   	push   %edi
+  801398:	56                   	push   %esi
+  801399:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80139a:	be 00 00 00 00       	mov    $0x0,%esi
+  80139f:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013a2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013a5:	b8 19 00 00 00       	mov    $0x19,%eax
+  8013aa:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8013ad:	89 f7                	mov    %esi,%edi
+  8013af:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  8013b1:	5b                   	pop    %ebx
+  8013b2:	5e                   	pop    %esi
+  8013b3:	5f                   	pop    %edi
+  8013b4:	5d                   	pop    %ebp
+  8013b5:	c3                   	ret
+
+008013b6 <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  8013b6:	55                   	push   %ebp
+  8013b7:	89 e5                	mov    %esp,%ebp
+  8013b9:	57                   	push   %edi
+  8013ba:	56                   	push   %esi
+  8013bb:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8013bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013c1:	b8 15 00 00 00       	mov    $0x15,%eax
+  8013c6:	89 d1                	mov    %edx,%ecx
+  8013c8:	89 d3                	mov    %edx,%ebx
+  8013ca:	89 d7                	mov    %edx,%edi
+  8013cc:	89 d6                	mov    %edx,%esi
+  8013ce:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  8013d0:	5b                   	pop    %ebx
+  8013d1:	5e                   	pop    %esi
+  8013d2:	5f                   	pop    %edi
+  8013d3:	5d                   	pop    %ebp
+  8013d4:	c3                   	ret
+
+008013d5 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8013d5:	55                   	push   %ebp
+  8013d6:	89 e5                	mov    %esp,%ebp
+  8013d8:	57                   	push   %edi
+  8013d9:	56                   	push   %esi
+  8013da:	53                   	push   %ebx
+  8013db:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8013de:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8013e3:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013e6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8013e9:	b8 08 00 00 00       	mov    $0x8,%eax
+  8013ee:	89 df                	mov    %ebx,%edi
+  8013f0:	89 de                	mov    %ebx,%esi
+  8013f2:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8013f4:	85 c0                	test   %eax,%eax
+  8013f6:	7f 08                	jg     801400 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8013f8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8013fb:	5b                   	pop    %ebx
+  8013fc:	5e                   	pop    %esi
+  8013fd:	5f                   	pop    %edi
+  8013fe:	5d                   	pop    %ebp
+  8013ff:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801400:	83 ec 0c             	sub    $0xc,%esp
+  801403:	50                   	push   %eax
+  801404:	6a 08                	push   $0x8
+  801406:	68 a3 3b 80 00       	push   $0x803ba3
+  80140b:	6a 23                	push   $0x23
+  80140d:	68 c0 3b 80 00       	push   $0x803bc0
+  801412:	e8 d5 f2 ff ff       	call   8006ec <_panic>
+
+00801417 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  801417:	55                   	push   %ebp
+  801418:	89 e5                	mov    %esp,%ebp
+  80141a:	57                   	push   %edi
+  80141b:	56                   	push   %esi
+  80141c:	53                   	push   %ebx
+  80141d:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801420:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801425:	8b 55 08             	mov    0x8(%ebp),%edx
+  801428:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80142b:	b8 09 00 00 00       	mov    $0x9,%eax
+  801430:	89 df                	mov    %ebx,%edi
+  801432:	89 de                	mov    %ebx,%esi
+  801434:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801436:	85 c0                	test   %eax,%eax
+  801438:	7f 08                	jg     801442 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  80143a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80143d:	5b                   	pop    %ebx
+  80143e:	5e                   	pop    %esi
+  80143f:	5f                   	pop    %edi
+  801440:	5d                   	pop    %ebp
+  801441:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801442:	83 ec 0c             	sub    $0xc,%esp
+  801445:	50                   	push   %eax
+  801446:	6a 09                	push   $0x9
+  801448:	68 a3 3b 80 00       	push   $0x803ba3
+  80144d:	6a 23                	push   $0x23
+  80144f:	68 c0 3b 80 00       	push   $0x803bc0
+  801454:	e8 93 f2 ff ff       	call   8006ec <_panic>
+
+00801459 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801459:	55                   	push   %ebp
+  80145a:	89 e5                	mov    %esp,%ebp
+  80145c:	57                   	push   %edi
+  80145d:	56                   	push   %esi
+  80145e:	53                   	push   %ebx
+  80145f:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801462:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801467:	8b 55 08             	mov    0x8(%ebp),%edx
+  80146a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80146d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801472:	89 df                	mov    %ebx,%edi
+  801474:	89 de                	mov    %ebx,%esi
+  801476:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801478:	85 c0                	test   %eax,%eax
+  80147a:	7f 08                	jg     801484 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  80147c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80147f:	5b                   	pop    %ebx
+  801480:	5e                   	pop    %esi
+  801481:	5f                   	pop    %edi
+  801482:	5d                   	pop    %ebp
+  801483:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801484:	83 ec 0c             	sub    $0xc,%esp
+  801487:	50                   	push   %eax
+  801488:	6a 0a                	push   $0xa
+  80148a:	68 a3 3b 80 00       	push   $0x803ba3
+  80148f:	6a 23                	push   $0x23
+  801491:	68 c0 3b 80 00       	push   $0x803bc0
+  801496:	e8 51 f2 ff ff       	call   8006ec <_panic>
+
+0080149b <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  80149b:	55                   	push   %ebp
+  80149c:	89 e5                	mov    %esp,%ebp
+  80149e:	57                   	push   %edi
+  80149f:	56                   	push   %esi
+  8014a0:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8014a1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014a4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014a7:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8014ac:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8014af:	8b 7d 14             	mov    0x14(%ebp),%edi
+  8014b2:	8b 75 18             	mov    0x18(%ebp),%esi
+  8014b5:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  8014b7:	5b                   	pop    %ebx
+  8014b8:	5e                   	pop    %esi
+  8014b9:	5f                   	pop    %edi
+  8014ba:	5d                   	pop    %ebp
+  8014bb:	c3                   	ret
+
+008014bc <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  8014bc:	55                   	push   %ebp
+  8014bd:	89 e5                	mov    %esp,%ebp
+  8014bf:	57                   	push   %edi
+  8014c0:	56                   	push   %esi
+  8014c1:	53                   	push   %ebx
+  8014c2:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8014c5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8014ca:	8b 55 08             	mov    0x8(%ebp),%edx
+  8014cd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8014d0:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8014d5:	89 df                	mov    %ebx,%edi
+  8014d7:	89 de                	mov    %ebx,%esi
+  8014d9:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8014db:	85 c0                	test   %eax,%eax
+  8014dd:	7f 08                	jg     8014e7 <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  8014df:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014e2:	5b                   	pop    %ebx
+  8014e3:	5e                   	pop    %esi
+  8014e4:	5f                   	pop    %edi
+  8014e5:	5d                   	pop    %ebp
+  8014e6:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8014e7:	83 ec 0c             	sub    $0xc,%esp
+  8014ea:	50                   	push   %eax
+  8014eb:	6a 0d                	push   $0xd
+  8014ed:	68 a3 3b 80 00       	push   $0x803ba3
+  8014f2:	6a 23                	push   $0x23
+  8014f4:	68 c0 3b 80 00       	push   $0x803bc0
+  8014f9:	e8 ee f1 ff ff       	call   8006ec <_panic>
+
+008014fe <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  8014fe:	55                   	push   %ebp
+  8014ff:	89 e5                	mov    %esp,%ebp
+  801501:	57                   	push   %edi
+  801502:	56                   	push   %esi
+  801503:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801504:	ba 00 00 00 00       	mov    $0x0,%edx
+  801509:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80150e:	89 d1                	mov    %edx,%ecx
+  801510:	89 d3                	mov    %edx,%ebx
+  801512:	89 d7                	mov    %edx,%edi
+  801514:	89 d6                	mov    %edx,%esi
+  801516:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  801518:	5b                   	pop    %ebx
+  801519:	5e                   	pop    %esi
+  80151a:	5f                   	pop    %edi
+  80151b:	5d                   	pop    %ebp
+  80151c:	c3                   	ret
+
+0080151d <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  80151d:	55                   	push   %ebp
+  80151e:	89 e5                	mov    %esp,%ebp
+  801520:	57                   	push   %edi
+  801521:	56                   	push   %esi
+  801522:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801523:	8b 55 08             	mov    0x8(%ebp),%edx
+  801526:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801529:	b8 0f 00 00 00       	mov    $0xf,%eax
+  80152e:	be 00 00 00 00       	mov    $0x0,%esi
+  801533:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801536:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801539:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  80153b:	5b                   	pop    %ebx
+  80153c:	5e                   	pop    %esi
+  80153d:	5f                   	pop    %edi
+  80153e:	5d                   	pop    %ebp
+  80153f:	c3                   	ret
+
+00801540 <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  801540:	55                   	push   %ebp
+  801541:	89 e5                	mov    %esp,%ebp
+  801543:	57                   	push   %edi
+  801544:	56                   	push   %esi
+  801545:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801546:	be 00 00 00 00       	mov    $0x0,%esi
+  80154b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80154e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801551:	b8 10 00 00 00       	mov    $0x10,%eax
+  801556:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801559:	89 f7                	mov    %esi,%edi
+  80155b:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  80155d:	5b                   	pop    %ebx
+  80155e:	5e                   	pop    %esi
+  80155f:	5f                   	pop    %edi
+  801560:	5d                   	pop    %ebp
+  801561:	c3                   	ret
+
+00801562 <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  801562:	55                   	push   %ebp
+  801563:	89 e5                	mov    %esp,%ebp
+  801565:	57                   	push   %edi
+  801566:	56                   	push   %esi
+  801567:	53                   	push   %ebx
+  801568:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  80156b:	80 3d 48 57 80 00 00 	cmpb   $0x0,0x805748
+  801572:	74 41                	je     8015b5 <sys_batch+0x53>
+  801574:	8b 45 08             	mov    0x8(%ebp),%eax
+  801577:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  80157a:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  801581:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801584:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  801587:	7d 45                	jge    8015ce <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  801589:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80158c:	8b 06                	mov    (%esi),%eax
+  80158e:	8b 56 04             	mov    0x4(%esi),%edx
+  801591:	8b 4e 08             	mov    0x8(%esi),%ecx
+  801594:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  801597:	8b 7e 10             	mov    0x10(%esi),%edi
+  80159a:	8b 76 14             	mov    0x14(%esi),%esi
+  80159d:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  80159f:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8015a2:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  8015a5:	83 c6 1c             	add    $0x1c,%esi
+  8015a8:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  8015ab:	85 c0                	test   %eax,%eax
+  8015ad:	78 1f                	js     8015ce <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  8015af:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  8015b3:	eb cc                	jmp    801581 <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  8015b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8015ba:	b8 13 00 00 00       	mov    $0x13,%eax
+  8015bf:	8b 55 08             	mov    0x8(%ebp),%edx
+  8015c2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8015c5:	89 df                	mov    %ebx,%edi
+  8015c7:	89 de                	mov    %ebx,%esi
+  8015c9:	cd 30                	int    $0x30
+  8015cb:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  8015ce:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8015d1:	83 c4 08             	add    $0x8,%esp
+  8015d4:	5b                   	pop    %ebx
+  8015d5:	5e                   	pop    %esi
+  8015d6:	5f                   	pop    %edi
+  8015d7:	5d                   	pop    %ebp
+  8015d8:	c3                   	ret
+
+008015d9 <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  8015d9:	55                   	push   %ebp
+  8015da:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  8015dc:	8b 45 08             	mov    0x8(%ebp),%eax
+  8015df:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8015e5:	5d                   	pop    %ebp
+  8015e6:	c3                   	ret
+
+008015e7 <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  8015e7:	55                   	push   %ebp
+  8015e8:	89 e5                	mov    %esp,%ebp
+  8015ea:	56                   	push   %esi
+  8015eb:	53                   	push   %ebx
+  8015ec:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  8015ef:	8b 1e                	mov    (%esi),%ebx
+  8015f1:	85 db                	test   %ebx,%ebx
+  8015f3:	75 09                	jne    8015fe <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  8015f5:	89 d8                	mov    %ebx,%eax
+  8015f7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8015fa:	5b                   	pop    %ebx
+  8015fb:	5e                   	pop    %esi
+  8015fc:	5d                   	pop    %ebp
+  8015fd:	c3                   	ret
+  b->sb_n = 0;
+  8015fe:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  801604:	53                   	push   %ebx
+  801605:	8d 46 04             	lea    0x4(%esi),%eax
+  801608:	50                   	push   %eax
+  801609:	e8 54 ff ff ff       	call   801562 <sys_batch>
+  80160e:	83 c4 08             	add    $0x8,%esp
+  801611:	85 c0                	test   %eax,%eax
+  801613:	78 1e                	js     801633 <sysbatch_flush+0x4c>
+  if (r < n)
+  801615:	39 c3                	cmp    %eax,%ebx
+  801617:	7f 07                	jg     801620 <sysbatch_flush+0x39>
+  return 0;
+  801619:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80161e:	eb d5                	jmp    8015f5 <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  801620:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801623:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  801627:	85 db                	test   %ebx,%ebx
+  801629:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80162e:	0f 49 d8             	cmovns %eax,%ebx
+  801631:	eb c2                	jmp    8015f5 <sysbatch_flush+0xe>
+    return r;
+  801633:	89 c3                	mov    %eax,%ebx
+  801635:	eb be                	jmp    8015f5 <sysbatch_flush+0xe>
+
+00801637 <sysbatch_add>:
+{
+  801637:	55                   	push   %ebp
+  801638:	89 e5                	mov    %esp,%ebp
+  80163a:	53                   	push   %ebx
+  80163b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  80163e:	83 3b 40             	cmpl   $0x40,(%ebx)
+  801641:	74 41                	je     801684 <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  801643:	8b 03                	mov    (%ebx),%eax
+  801645:	8d 50 01             	lea    0x1(%eax),%edx
+  801648:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  80164a:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80164d:	01 d8                	add    %ebx,%eax
+  80164f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801652:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  801655:	8b 55 10             	mov    0x10(%ebp),%edx
+  801658:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  80165b:	8b 55 14             	mov    0x14(%ebp),%edx
+  80165e:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  801661:	8b 55 18             	mov    0x18(%ebp),%edx
+  801664:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  801667:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  80166a:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  80166d:	8b 55 20             	mov    0x20(%ebp),%edx
+  801670:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  801673:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  80167a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80167f:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801682:	c9                   	leave
+  801683:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  801684:	53                   	push   %ebx
+  801685:	e8 5d ff ff ff       	call   8015e7 <sysbatch_flush>
+  80168a:	83 c4 04             	add    $0x4,%esp
+  80168d:	85 c0                	test   %eax,%eax
+  80168f:	79 b2                	jns    801643 <sysbatch_add+0xc>
+  801691:	eb ec                	jmp    80167f <sysbatch_add+0x48>
+
+00801693 <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  801693:	55                   	push   %ebp
+  801694:	89 e5                	mov    %esp,%ebp
+  801696:	57                   	push   %edi
+  801697:	56                   	push   %esi
+  801698:	53                   	push   %ebx
+  801699:	83 ec 14             	sub    $0x14,%esp
+  80169c:	8b 7d 08             	mov    0x8(%ebp),%edi
+  80169f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8016a2:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8016a5:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  8016a8:	85 c0                	test   %eax,%eax
+  8016aa:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  8016af:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  8016b2:	ff 33                	push   (%ebx)
+  8016b4:	50                   	push   %eax
+  8016b5:	e8 02 fe ff ff       	call   8014bc <sys_ipc_recv>
+  8016ba:	83 c4 10             	add    $0x10,%esp
+  8016bd:	85 c0                	test   %eax,%eax
+  8016bf:	78 39                	js     8016fa <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  8016c1:	85 ff                	test   %edi,%edi
+  8016c3:	74 0a                	je     8016cf <ipc_recv_pages+0x3c>
+  8016c5:	a1 44 57 80 00       	mov    0x805744,%eax
+  8016ca:	8b 40 7c             	mov    0x7c(%eax),%eax
+  8016cd:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  8016cf:	85 f6                	test   %esi,%esi
+  8016d1:	74 0d                	je     8016e0 <ipc_recv_pages+0x4d>
+  8016d3:	a1 44 57 80 00       	mov    0x805744,%eax
+  8016d8:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  8016de:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  8016e0:	a1 44 57 80 00       	mov    0x805744,%eax
+  8016e5:	8b 40 74             	mov    0x74(%eax),%eax
+  8016e8:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  8016ea:	a1 44 57 80 00       	mov    0x805744,%eax
+  8016ef:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  8016f2:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8016f5:	5b                   	pop    %ebx
+  8016f6:	5e                   	pop    %esi
+  8016f7:	5f                   	pop    %edi
+  8016f8:	5d                   	pop    %ebp
+  8016f9:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  8016fa:	85 ff                	test   %edi,%edi
+  8016fc:	74 06                	je     801704 <ipc_recv_pages+0x71>
+  8016fe:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  801704:	85 f6                	test   %esi,%esi
+  801706:	74 06                	je     80170e <ipc_recv_pages+0x7b>
+  801708:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  80170e:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  801714:	eb dc                	jmp    8016f2 <ipc_recv_pages+0x5f>
+
+00801716 <ipc_recv>:
+{
+  801716:	55                   	push   %ebp
+  801717:	89 e5                	mov    %esp,%ebp
+  801719:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  80171c:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  801723:	ff 75 10             	push   0x10(%ebp)
+  801726:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801729:	50                   	push   %eax
+  80172a:	ff 75 0c             	push   0xc(%ebp)
+  80172d:	ff 75 08             	push   0x8(%ebp)
+  801730:	e8 5e ff ff ff       	call   801693 <ipc_recv_pages>
+}
+  801735:	c9                   	leave
+  801736:	c3                   	ret
+
+00801737 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  801737:	55                   	push   %ebp
+  801738:	89 e5                	mov    %esp,%ebp
+  80173a:	57                   	push   %edi
+  80173b:	56                   	push   %esi
+  80173c:	53                   	push   %ebx
+  80173d:	83 ec 0c             	sub    $0xc,%esp
+  801740:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801743:	8b 75 0c             	mov    0xc(%ebp),%esi
+  801746:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  801749:	89 c3                	mov    %eax,%ebx
+  80174b:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  801751:	85 c0                	test   %eax,%eax
+  801753:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  801758:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  80175b:	83 ec 0c             	sub    $0xc,%esp
+  80175e:	ff 75 14             	push   0x14(%ebp)
+  801761:	ff 75 18             	push   0x18(%ebp)
+  801764:	53                   	push   %ebx
+  801765:	56                   	push   %esi
+  801766:	57                   	push   %edi
+  801767:	e8 2f fd ff ff       	call   80149b <sys_ipc_try_send>
+  80176c:	83 c4 20             	add    $0x20,%esp
+  80176f:	85 c0                	test   %eax,%eax
+  801771:	79 1e                	jns    801791 <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  801773:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801776:	75 07                	jne    80177f <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  801778:	e8 05 fa ff ff       	call   801182 <sys_yield>
+  80177d:	eb dc                	jmp    80175b <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  80177f:	50                   	push   %eax
+  801780:	68 ce 3b 80 00       	push   $0x803bce
+  801785:	6a 5c                	push   $0x5c
+  801787:	68 db 3b 80 00       	push   $0x803bdb
+  80178c:	e8 5b ef ff ff       	call   8006ec <_panic>
+  }
+}
+  801791:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801794:	5b                   	pop    %ebx
+  801795:	5e                   	pop    %esi
+  801796:	5f                   	pop    %edi
+  801797:	5d                   	pop    %ebp
+  801798:	c3                   	ret
+
+00801799 <ipc_send>:
+{
+  801799:	55                   	push   %ebp
+  80179a:	89 e5                	mov    %esp,%ebp
+  80179c:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  80179f:	ff 75 14             	push   0x14(%ebp)
+  8017a2:	6a 01                	push   $0x1
+  8017a4:	ff 75 10             	push   0x10(%ebp)
+  8017a7:	ff 75 0c             	push   0xc(%ebp)
+  8017aa:	ff 75 08             	push   0x8(%ebp)
+  8017ad:	e8 85 ff ff ff       	call   801737 <ipc_send_pages>
+}
+  8017b2:	83 c4 20             	add    $0x20,%esp
+  8017b5:	c9                   	leave
+  8017b6:	c3                   	ret
+
+008017b7 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  8017b7:	55                   	push   %ebp
+  8017b8:	89 e5                	mov    %esp,%ebp
+  8017ba:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  8017bd:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  8017c2:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8017c5:	c1 e0 04             	shl    $0x4,%eax
+  8017c8:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8017cd:	8b 40 50             	mov    0x50(%eax),%eax
+  8017d0:	39 c8                	cmp    %ecx,%eax
+  8017d2:	74 12                	je     8017e6 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  8017d4:	83 c2 01             	add    $0x1,%edx
+  8017d7:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  8017dd:	75 e3                	jne    8017c2 <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  8017df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017e4:	eb 0e                	jmp    8017f4 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  8017e6:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  8017e9:	c1 e0 04             	shl    $0x4,%eax
+  8017ec:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8017f1:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  8017f4:	5d                   	pop    %ebp
+  8017f5:	c3                   	ret
+
+008017f6 <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  8017f6:	55                   	push   %ebp
+  8017f7:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  8017f9:	8b 45 08             	mov    0x8(%ebp),%eax
+  8017fc:	05 00 00 00 30       	add    $0x30000000,%eax
+  801801:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801804:	5d                   	pop    %ebp
+  801805:	c3                   	ret
+
+00801806 <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  801806:	55                   	push   %ebp
+  801807:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801809:	8b 45 08             	mov    0x8(%ebp),%eax
+  80180c:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  80180f:	66 b8 00 00          	mov    $0x0,%ax
+  801813:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801818:	5d                   	pop    %ebp
+  801819:	c3                   	ret
+
+0080181a <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80181a:	55                   	push   %ebp
+  80181b:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  80181d:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801822:	eb 02                	jmp    801826 <fd_alloc+0xc>
+  801824:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  801826:	89 c2                	mov    %eax,%edx
+  801828:	c1 ea 16             	shr    $0x16,%edx
+  80182b:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801832:	f6 c2 01             	test   $0x1,%dl
+  801835:	74 2b                	je     801862 <fd_alloc+0x48>
+  801837:	89 c2                	mov    %eax,%edx
+  801839:	c1 ea 0c             	shr    $0xc,%edx
+  80183c:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801843:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  801849:	f6 c1 01             	test   $0x1,%cl
+  80184c:	74 14                	je     801862 <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  80184e:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801854:	75 ce                	jne    801824 <fd_alloc+0xa>
+  801856:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  80185b:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801860:	eb 05                	jmp    801867 <fd_alloc+0x4d>
+      return 0;
+  801862:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  801867:	8b 55 08             	mov    0x8(%ebp),%edx
+  80186a:	89 02                	mov    %eax,(%edx)
+}
+  80186c:	89 c8                	mov    %ecx,%eax
+  80186e:	5d                   	pop    %ebp
+  80186f:	c3                   	ret
+
+00801870 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801870:	55                   	push   %ebp
+  801871:	89 e5                	mov    %esp,%ebp
+  801873:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  801876:	83 f8 1f             	cmp    $0x1f,%eax
+  801879:	77 30                	ja     8018ab <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  80187b:	c1 e0 0c             	shl    $0xc,%eax
+  80187e:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  801883:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  801889:	f6 c2 01             	test   $0x1,%dl
+  80188c:	74 24                	je     8018b2 <fd_lookup+0x42>
+  80188e:	89 c2                	mov    %eax,%edx
+  801890:	c1 ea 0c             	shr    $0xc,%edx
+  801893:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  80189a:	f6 c2 01             	test   $0x1,%dl
+  80189d:	74 1a                	je     8018b9 <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  80189f:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8018a2:	89 02                	mov    %eax,(%edx)
+  return 0;
+  8018a4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8018a9:	5d                   	pop    %ebp
+  8018aa:	c3                   	ret
+    return -E_INVAL;
+  8018ab:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018b0:	eb f7                	jmp    8018a9 <fd_lookup+0x39>
+    return -E_INVAL;
+  8018b2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018b7:	eb f0                	jmp    8018a9 <fd_lookup+0x39>
+  8018b9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8018be:	eb e9                	jmp    8018a9 <fd_lookup+0x39>
+
+008018c0 <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8018c0:	55                   	push   %ebp
+  8018c1:	89 e5                	mov    %esp,%ebp
+  8018c3:	53                   	push   %ebx
+  8018c4:	83 ec 04             	sub    $0x4,%esp
+  8018c7:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  8018ca:	b8 64 3c 80 00       	mov    $0x803c64,%eax
+  8018cf:	8b 18                	mov    (%eax),%ebx
+  8018d1:	85 db                	test   %ebx,%ebx
+  8018d3:	74 0e                	je     8018e3 <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  8018d5:	83 c0 04             	add    $0x4,%eax
+  8018d8:	39 13                	cmp    %edx,(%ebx)
+  8018da:	75 f3                	jne    8018cf <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  8018dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018e1:	eb 1f                	jmp    801902 <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8018e3:	a1 44 57 80 00       	mov    0x805744,%eax
+  8018e8:	8b 40 48             	mov    0x48(%eax),%eax
+  8018eb:	83 ec 04             	sub    $0x4,%esp
+  8018ee:	52                   	push   %edx
+  8018ef:	50                   	push   %eax
+  8018f0:	68 e8 3b 80 00       	push   $0x803be8
+  8018f5:	e8 cd ee ff ff       	call   8007c7 <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  8018fa:	83 c4 10             	add    $0x10,%esp
+  8018fd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  801902:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801905:	89 1a                	mov    %ebx,(%edx)
+}
+  801907:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80190a:	c9                   	leave
+  80190b:	c3                   	ret
+
+0080190c <fd_close>:
+{
+  80190c:	55                   	push   %ebp
+  80190d:	89 e5                	mov    %esp,%ebp
+  80190f:	57                   	push   %edi
+  801910:	56                   	push   %esi
+  801911:	53                   	push   %ebx
+  801912:	83 ec 24             	sub    $0x24,%esp
+  801915:	8b 75 08             	mov    0x8(%ebp),%esi
+  801918:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80191b:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80191e:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80191f:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801925:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801928:	50                   	push   %eax
+  801929:	e8 42 ff ff ff       	call   801870 <fd_lookup>
+  80192e:	89 c3                	mov    %eax,%ebx
+  801930:	83 c4 10             	add    $0x10,%esp
+  801933:	85 c0                	test   %eax,%eax
+  801935:	78 05                	js     80193c <fd_close+0x30>
+      || fd != fd2)
+  801937:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80193a:	74 16                	je     801952 <fd_close+0x46>
+    return must_exist ? r : 0;
+  80193c:	89 f8                	mov    %edi,%eax
+  80193e:	84 c0                	test   %al,%al
+  801940:	b8 00 00 00 00       	mov    $0x0,%eax
+  801945:	0f 44 d8             	cmove  %eax,%ebx
+}
+  801948:	89 d8                	mov    %ebx,%eax
+  80194a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80194d:	5b                   	pop    %ebx
+  80194e:	5e                   	pop    %esi
+  80194f:	5f                   	pop    %edi
+  801950:	5d                   	pop    %ebp
+  801951:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801952:	83 ec 08             	sub    $0x8,%esp
+  801955:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  801958:	50                   	push   %eax
+  801959:	ff 36                	push   (%esi)
+  80195b:	e8 60 ff ff ff       	call   8018c0 <dev_lookup>
+  801960:	89 c3                	mov    %eax,%ebx
+  801962:	83 c4 10             	add    $0x10,%esp
+  801965:	85 c0                	test   %eax,%eax
+  801967:	78 1a                	js     801983 <fd_close+0x77>
+    if (dev->dev_close)
+  801969:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80196c:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  80196f:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  801974:	85 c0                	test   %eax,%eax
+  801976:	74 0b                	je     801983 <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  801978:	83 ec 0c             	sub    $0xc,%esp
+  80197b:	56                   	push   %esi
+  80197c:	ff d0                	call   *%eax
+  80197e:	89 c3                	mov    %eax,%ebx
+  801980:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  801983:	83 ec 08             	sub    $0x8,%esp
+  801986:	56                   	push   %esi
+  801987:	6a 00                	push   $0x0
+  801989:	e8 db f8 ff ff       	call   801269 <sys_page_unmap>
+  return r;
+  80198e:	83 c4 10             	add    $0x10,%esp
+  801991:	eb b5                	jmp    801948 <fd_close+0x3c>
+
+00801993 <close>:
+
+int
+close(int fdnum)
+{
+  801993:	55                   	push   %ebp
+  801994:	89 e5                	mov    %esp,%ebp
+  801996:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801999:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80199c:	50                   	push   %eax
+  80199d:	ff 75 08             	push   0x8(%ebp)
+  8019a0:	e8 cb fe ff ff       	call   801870 <fd_lookup>
+  8019a5:	83 c4 10             	add    $0x10,%esp
+  8019a8:	85 c0                	test   %eax,%eax
+  8019aa:	79 02                	jns    8019ae <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  8019ac:	c9                   	leave
+  8019ad:	c3                   	ret
+    return fd_close(fd, 1);
+  8019ae:	83 ec 08             	sub    $0x8,%esp
+  8019b1:	6a 01                	push   $0x1
+  8019b3:	ff 75 f4             	push   -0xc(%ebp)
+  8019b6:	e8 51 ff ff ff       	call   80190c <fd_close>
+  8019bb:	83 c4 10             	add    $0x10,%esp
+  8019be:	eb ec                	jmp    8019ac <close+0x19>
+
+008019c0 <close_all>:
+
+void
+close_all(void)
+{
+  8019c0:	55                   	push   %ebp
+  8019c1:	89 e5                	mov    %esp,%ebp
+  8019c3:	53                   	push   %ebx
+  8019c4:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  8019c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  8019cc:	83 ec 0c             	sub    $0xc,%esp
+  8019cf:	53                   	push   %ebx
+  8019d0:	e8 be ff ff ff       	call   801993 <close>
+  for (i = 0; i < MAXFD; i++)
+  8019d5:	83 c3 01             	add    $0x1,%ebx
+  8019d8:	83 c4 10             	add    $0x10,%esp
+  8019db:	83 fb 20             	cmp    $0x20,%ebx
+  8019de:	75 ec                	jne    8019cc <close_all+0xc>
+}
+  8019e0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8019e3:	c9                   	leave
+  8019e4:	c3                   	ret
+
+008019e5 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  8019e5:	55                   	push   %ebp
+  8019e6:	89 e5                	mov    %esp,%ebp
+  8019e8:	57                   	push   %edi
+  8019e9:	56                   	push   %esi
+  8019ea:	53                   	push   %ebx
+  8019eb:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  8019ee:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8019f1:	50                   	push   %eax
+  8019f2:	ff 75 08             	push   0x8(%ebp)
+  8019f5:	e8 76 fe ff ff       	call   801870 <fd_lookup>
+  8019fa:	89 c6                	mov    %eax,%esi
+  8019fc:	83 c4 10             	add    $0x10,%esp
+  8019ff:	85 c0                	test   %eax,%eax
+  801a01:	0f 88 0a 01 00 00    	js     801b11 <dup+0x12c>
+    return r;
+  close(newfdnum);
+  801a07:	83 ec 0c             	sub    $0xc,%esp
+  801a0a:	ff 75 0c             	push   0xc(%ebp)
+  801a0d:	e8 81 ff ff ff       	call   801993 <close>
+
+  newfd = INDEX2FD(newfdnum);
+  801a12:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a15:	c1 e0 0c             	shl    $0xc,%eax
+  801a18:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  801a1e:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  801a21:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801a24:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  801a27:	89 04 24             	mov    %eax,(%esp)
+  801a2a:	e8 d7 fd ff ff       	call   801806 <fd2data>
+  801a2f:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  801a31:	89 3c 24             	mov    %edi,(%esp)
+  801a34:	e8 cd fd ff ff       	call   801806 <fd2data>
+  801a39:	83 c4 10             	add    $0x10,%esp
+  801a3c:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801a3f:	89 f3                	mov    %esi,%ebx
+  801a41:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  801a47:	89 c6                	mov    %eax,%esi
+  801a49:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801a4c:	89 cf                	mov    %ecx,%edi
+  801a4e:	eb 0c                	jmp    801a5c <dup+0x77>
+  801a50:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  801a56:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801a5c:	39 fb                	cmp    %edi,%ebx
+  801a5e:	74 7b                	je     801adb <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  801a60:	89 d8                	mov    %ebx,%eax
+  801a62:	c1 e8 16             	shr    $0x16,%eax
+  801a65:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801a6c:	a8 01                	test   $0x1,%al
+  801a6e:	74 e0                	je     801a50 <dup+0x6b>
+  801a70:	89 d8                	mov    %ebx,%eax
+  801a72:	c1 e8 0c             	shr    $0xc,%eax
+  801a75:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  801a7c:	f6 c2 01             	test   $0x1,%dl
+  801a7f:	74 cf                	je     801a50 <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  801a81:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  801a88:	83 ec 0c             	sub    $0xc,%esp
+  801a8b:	25 07 0e 00 00       	and    $0xe07,%eax
+  801a90:	50                   	push   %eax
+  801a91:	56                   	push   %esi
+  801a92:	6a 00                	push   $0x0
+  801a94:	53                   	push   %ebx
+  801a95:	6a 00                	push   $0x0
+  801a97:	e8 8b f7 ff ff       	call   801227 <sys_page_map>
+  801a9c:	83 c4 20             	add    $0x20,%esp
+  801a9f:	85 c0                	test   %eax,%eax
+  801aa1:	79 ad                	jns    801a50 <dup+0x6b>
+  801aa3:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801aa6:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  801aa8:	83 ec 08             	sub    $0x8,%esp
+  801aab:	ff 75 d4             	push   -0x2c(%ebp)
+  801aae:	6a 00                	push   $0x0
+  801ab0:	e8 b4 f7 ff ff       	call   801269 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801ab5:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  801ab8:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  801abe:	83 c4 10             	add    $0x10,%esp
+  801ac1:	39 df                	cmp    %ebx,%edi
+  801ac3:	74 4c                	je     801b11 <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  801ac5:	83 ec 08             	sub    $0x8,%esp
+  801ac8:	57                   	push   %edi
+  801ac9:	6a 00                	push   $0x0
+  801acb:	e8 99 f7 ff ff       	call   801269 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801ad0:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  801ad6:	83 c4 10             	add    $0x10,%esp
+  801ad9:	eb e6                	jmp    801ac1 <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801adb:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801ade:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  801ae1:	89 c8                	mov    %ecx,%eax
+  801ae3:	c1 e8 0c             	shr    $0xc,%eax
+  801ae6:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801aed:	83 ec 0c             	sub    $0xc,%esp
+  801af0:	25 07 0e 00 00       	and    $0xe07,%eax
+  801af5:	50                   	push   %eax
+  801af6:	ff 75 d4             	push   -0x2c(%ebp)
+  801af9:	6a 00                	push   $0x0
+  801afb:	51                   	push   %ecx
+  801afc:	6a 00                	push   $0x0
+  801afe:	e8 24 f7 ff ff       	call   801227 <sys_page_map>
+  801b03:	89 c6                	mov    %eax,%esi
+  801b05:	83 c4 20             	add    $0x20,%esp
+  801b08:	85 c0                	test   %eax,%eax
+  801b0a:	78 9c                	js     801aa8 <dup+0xc3>
+  return newfdnum;
+  801b0c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801b0f:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  801b11:	89 f0                	mov    %esi,%eax
+  801b13:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b16:	5b                   	pop    %ebx
+  801b17:	5e                   	pop    %esi
+  801b18:	5f                   	pop    %edi
+  801b19:	5d                   	pop    %ebp
+  801b1a:	c3                   	ret
+
+00801b1b <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801b1b:	55                   	push   %ebp
+  801b1c:	89 e5                	mov    %esp,%ebp
+  801b1e:	56                   	push   %esi
+  801b1f:	53                   	push   %ebx
+  801b20:	83 ec 18             	sub    $0x18,%esp
+  801b23:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801b26:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b29:	50                   	push   %eax
+  801b2a:	56                   	push   %esi
+  801b2b:	e8 40 fd ff ff       	call   801870 <fd_lookup>
+  801b30:	83 c4 10             	add    $0x10,%esp
+  801b33:	85 c0                	test   %eax,%eax
+  801b35:	78 3c                	js     801b73 <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801b37:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801b3a:	83 ec 08             	sub    $0x8,%esp
+  801b3d:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b40:	50                   	push   %eax
+  801b41:	ff 33                	push   (%ebx)
+  801b43:	e8 78 fd ff ff       	call   8018c0 <dev_lookup>
+  801b48:	83 c4 10             	add    $0x10,%esp
+  801b4b:	85 c0                	test   %eax,%eax
+  801b4d:	78 24                	js     801b73 <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801b4f:	8b 43 08             	mov    0x8(%ebx),%eax
+  801b52:	83 e0 03             	and    $0x3,%eax
+  801b55:	83 f8 01             	cmp    $0x1,%eax
+  801b58:	74 20                	je     801b7a <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  801b5a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b5d:	8b 40 08             	mov    0x8(%eax),%eax
+  801b60:	85 c0                	test   %eax,%eax
+  801b62:	74 37                	je     801b9b <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  801b64:	83 ec 04             	sub    $0x4,%esp
+  801b67:	ff 75 10             	push   0x10(%ebp)
+  801b6a:	ff 75 0c             	push   0xc(%ebp)
+  801b6d:	53                   	push   %ebx
+  801b6e:	ff d0                	call   *%eax
+  801b70:	83 c4 10             	add    $0x10,%esp
+}
+  801b73:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b76:	5b                   	pop    %ebx
+  801b77:	5e                   	pop    %esi
+  801b78:	5d                   	pop    %ebp
+  801b79:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b7a:	a1 44 57 80 00       	mov    0x805744,%eax
+  801b7f:	8b 40 48             	mov    0x48(%eax),%eax
+  801b82:	83 ec 04             	sub    $0x4,%esp
+  801b85:	56                   	push   %esi
+  801b86:	50                   	push   %eax
+  801b87:	68 29 3c 80 00       	push   $0x803c29
+  801b8c:	e8 36 ec ff ff       	call   8007c7 <cprintf>
+    return -E_INVAL;
+  801b91:	83 c4 10             	add    $0x10,%esp
+  801b94:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b99:	eb d8                	jmp    801b73 <read+0x58>
+    return -E_NOT_SUPP;
+  801b9b:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ba0:	eb d1                	jmp    801b73 <read+0x58>
+
+00801ba2 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801ba2:	55                   	push   %ebp
+  801ba3:	89 e5                	mov    %esp,%ebp
+  801ba5:	57                   	push   %edi
+  801ba6:	56                   	push   %esi
+  801ba7:	53                   	push   %ebx
+  801ba8:	83 ec 0c             	sub    $0xc,%esp
+  801bab:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801bae:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  801bb1:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bb6:	eb 02                	jmp    801bba <readn+0x18>
+  801bb8:	01 c3                	add    %eax,%ebx
+  801bba:	39 f3                	cmp    %esi,%ebx
+  801bbc:	73 21                	jae    801bdf <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  801bbe:	83 ec 04             	sub    $0x4,%esp
+  801bc1:	89 f0                	mov    %esi,%eax
+  801bc3:	29 d8                	sub    %ebx,%eax
+  801bc5:	50                   	push   %eax
+  801bc6:	89 d8                	mov    %ebx,%eax
+  801bc8:	03 45 0c             	add    0xc(%ebp),%eax
+  801bcb:	50                   	push   %eax
+  801bcc:	57                   	push   %edi
+  801bcd:	e8 49 ff ff ff       	call   801b1b <read>
+    if (m < 0)
+  801bd2:	83 c4 10             	add    $0x10,%esp
+  801bd5:	85 c0                	test   %eax,%eax
+  801bd7:	78 04                	js     801bdd <readn+0x3b>
+      return m;
+    if (m == 0)
+  801bd9:	75 dd                	jne    801bb8 <readn+0x16>
+  801bdb:	eb 02                	jmp    801bdf <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  801bdd:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  801bdf:	89 d8                	mov    %ebx,%eax
+  801be1:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801be4:	5b                   	pop    %ebx
+  801be5:	5e                   	pop    %esi
+  801be6:	5f                   	pop    %edi
+  801be7:	5d                   	pop    %ebp
+  801be8:	c3                   	ret
+
+00801be9 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801be9:	55                   	push   %ebp
+  801bea:	89 e5                	mov    %esp,%ebp
+  801bec:	56                   	push   %esi
+  801bed:	53                   	push   %ebx
+  801bee:	83 ec 18             	sub    $0x18,%esp
+  801bf1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801bf4:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801bf7:	50                   	push   %eax
+  801bf8:	53                   	push   %ebx
+  801bf9:	e8 72 fc ff ff       	call   801870 <fd_lookup>
+  801bfe:	83 c4 10             	add    $0x10,%esp
+  801c01:	85 c0                	test   %eax,%eax
+  801c03:	78 37                	js     801c3c <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c05:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801c08:	83 ec 08             	sub    $0x8,%esp
+  801c0b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c0e:	50                   	push   %eax
+  801c0f:	ff 36                	push   (%esi)
+  801c11:	e8 aa fc ff ff       	call   8018c0 <dev_lookup>
+  801c16:	83 c4 10             	add    $0x10,%esp
+  801c19:	85 c0                	test   %eax,%eax
+  801c1b:	78 1f                	js     801c3c <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801c1d:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801c21:	74 20                	je     801c43 <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  801c23:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c26:	8b 40 0c             	mov    0xc(%eax),%eax
+  801c29:	85 c0                	test   %eax,%eax
+  801c2b:	74 37                	je     801c64 <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  801c2d:	83 ec 04             	sub    $0x4,%esp
+  801c30:	ff 75 10             	push   0x10(%ebp)
+  801c33:	ff 75 0c             	push   0xc(%ebp)
+  801c36:	56                   	push   %esi
+  801c37:	ff d0                	call   *%eax
+  801c39:	83 c4 10             	add    $0x10,%esp
+}
+  801c3c:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c3f:	5b                   	pop    %ebx
+  801c40:	5e                   	pop    %esi
+  801c41:	5d                   	pop    %ebp
+  801c42:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c43:	a1 44 57 80 00       	mov    0x805744,%eax
+  801c48:	8b 40 48             	mov    0x48(%eax),%eax
+  801c4b:	83 ec 04             	sub    $0x4,%esp
+  801c4e:	53                   	push   %ebx
+  801c4f:	50                   	push   %eax
+  801c50:	68 45 3c 80 00       	push   $0x803c45
+  801c55:	e8 6d eb ff ff       	call   8007c7 <cprintf>
+    return -E_INVAL;
+  801c5a:	83 c4 10             	add    $0x10,%esp
+  801c5d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c62:	eb d8                	jmp    801c3c <write+0x53>
+    return -E_NOT_SUPP;
+  801c64:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c69:	eb d1                	jmp    801c3c <write+0x53>
+
+00801c6b <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801c6b:	55                   	push   %ebp
+  801c6c:	89 e5                	mov    %esp,%ebp
+  801c6e:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801c71:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c74:	50                   	push   %eax
+  801c75:	ff 75 08             	push   0x8(%ebp)
+  801c78:	e8 f3 fb ff ff       	call   801870 <fd_lookup>
+  801c7d:	83 c4 10             	add    $0x10,%esp
+  801c80:	85 c0                	test   %eax,%eax
+  801c82:	78 0e                	js     801c92 <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  801c84:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801c87:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c8a:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  801c8d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c92:	c9                   	leave
+  801c93:	c3                   	ret
+
+00801c94 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801c94:	55                   	push   %ebp
+  801c95:	89 e5                	mov    %esp,%ebp
+  801c97:	56                   	push   %esi
+  801c98:	53                   	push   %ebx
+  801c99:	83 ec 18             	sub    $0x18,%esp
+  801c9c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c9f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801ca2:	50                   	push   %eax
+  801ca3:	53                   	push   %ebx
+  801ca4:	e8 c7 fb ff ff       	call   801870 <fd_lookup>
+  801ca9:	83 c4 10             	add    $0x10,%esp
+  801cac:	85 c0                	test   %eax,%eax
+  801cae:	78 34                	js     801ce4 <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801cb0:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801cb3:	83 ec 08             	sub    $0x8,%esp
+  801cb6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801cb9:	50                   	push   %eax
+  801cba:	ff 36                	push   (%esi)
+  801cbc:	e8 ff fb ff ff       	call   8018c0 <dev_lookup>
+  801cc1:	83 c4 10             	add    $0x10,%esp
+  801cc4:	85 c0                	test   %eax,%eax
+  801cc6:	78 1c                	js     801ce4 <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801cc8:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801ccc:	74 1d                	je     801ceb <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  801cce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801cd1:	8b 40 18             	mov    0x18(%eax),%eax
+  801cd4:	85 c0                	test   %eax,%eax
+  801cd6:	74 34                	je     801d0c <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  801cd8:	83 ec 08             	sub    $0x8,%esp
+  801cdb:	ff 75 0c             	push   0xc(%ebp)
+  801cde:	56                   	push   %esi
+  801cdf:	ff d0                	call   *%eax
+  801ce1:	83 c4 10             	add    $0x10,%esp
+}
+  801ce4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ce7:	5b                   	pop    %ebx
+  801ce8:	5e                   	pop    %esi
+  801ce9:	5d                   	pop    %ebp
+  801cea:	c3                   	ret
+            thisenv->env_id, fdnum);
+  801ceb:	a1 44 57 80 00       	mov    0x805744,%eax
+  801cf0:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801cf3:	83 ec 04             	sub    $0x4,%esp
+  801cf6:	53                   	push   %ebx
+  801cf7:	50                   	push   %eax
+  801cf8:	68 08 3c 80 00       	push   $0x803c08
+  801cfd:	e8 c5 ea ff ff       	call   8007c7 <cprintf>
+    return -E_INVAL;
+  801d02:	83 c4 10             	add    $0x10,%esp
+  801d05:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d0a:	eb d8                	jmp    801ce4 <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  801d0c:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d11:	eb d1                	jmp    801ce4 <ftruncate+0x50>
+
+00801d13 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801d13:	55                   	push   %ebp
+  801d14:	89 e5                	mov    %esp,%ebp
+  801d16:	56                   	push   %esi
+  801d17:	53                   	push   %ebx
+  801d18:	83 ec 18             	sub    $0x18,%esp
+  801d1b:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801d1e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801d21:	50                   	push   %eax
+  801d22:	ff 75 08             	push   0x8(%ebp)
+  801d25:	e8 46 fb ff ff       	call   801870 <fd_lookup>
+  801d2a:	83 c4 10             	add    $0x10,%esp
+  801d2d:	85 c0                	test   %eax,%eax
+  801d2f:	78 49                	js     801d7a <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801d31:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801d34:	83 ec 08             	sub    $0x8,%esp
+  801d37:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801d3a:	50                   	push   %eax
+  801d3b:	ff 36                	push   (%esi)
+  801d3d:	e8 7e fb ff ff       	call   8018c0 <dev_lookup>
+  801d42:	83 c4 10             	add    $0x10,%esp
+  801d45:	85 c0                	test   %eax,%eax
+  801d47:	78 31                	js     801d7a <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  801d49:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801d4c:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801d50:	74 2f                	je     801d81 <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  801d52:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  801d55:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801d5c:	00 00 00 
+  stat->st_isdir = 0;
+  801d5f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801d66:	00 00 00 
+  stat->st_dev = dev;
+  801d69:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  801d6f:	83 ec 08             	sub    $0x8,%esp
+  801d72:	53                   	push   %ebx
+  801d73:	56                   	push   %esi
+  801d74:	ff 50 14             	call   *0x14(%eax)
+  801d77:	83 c4 10             	add    $0x10,%esp
+}
+  801d7a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801d7d:	5b                   	pop    %ebx
+  801d7e:	5e                   	pop    %esi
+  801d7f:	5d                   	pop    %ebp
+  801d80:	c3                   	ret
+    return -E_NOT_SUPP;
+  801d81:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801d86:	eb f2                	jmp    801d7a <fstat+0x67>
+
+00801d88 <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  801d88:	55                   	push   %ebp
+  801d89:	89 e5                	mov    %esp,%ebp
+  801d8b:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  801d8e:	ff 75 0c             	push   0xc(%ebp)
+  801d91:	ff 75 08             	push   0x8(%ebp)
+  801d94:	e8 58 07 00 00       	call   8024f1 <file_stat>
+}
+  801d99:	c9                   	leave
+  801d9a:	c3                   	ret
+
+00801d9b <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  801d9b:	55                   	push   %ebp
+  801d9c:	89 e5                	mov    %esp,%ebp
+  801d9e:	57                   	push   %edi
+  801d9f:	56                   	push   %esi
+  801da0:	53                   	push   %ebx
+  801da1:	83 ec 1c             	sub    $0x1c,%esp
+  801da4:	89 c7                	mov    %eax,%edi
+  801da6:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801da9:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801dac:	e9 a2 00 00 00       	jmp    801e53 <fsipc_send+0xb8>
+  nfsenvs = 0;
+  801db1:	c7 05 00 50 80 00 00 	movl   $0x0,0x805000
+  801db8:	00 00 00 
+  801dbb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801dc0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801dc5:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801dca:	be 01 00 00 00       	mov    $0x1,%esi
+  801dcf:	eb 0f                	jmp    801de0 <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801dd1:	83 c0 01             	add    $0x1,%eax
+  801dd4:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801dd9:	74 49                	je     801e24 <fsipc_send+0x89>
+  801ddb:	83 f9 07             	cmp    $0x7,%ecx
+  801dde:	7f 50                	jg     801e30 <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  801de0:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801de3:	c1 e2 04             	shl    $0x4,%edx
+  801de6:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801dec:	8b 52 50             	mov    0x50(%edx),%edx
+  801def:	83 fa 01             	cmp    $0x1,%edx
+  801df2:	75 dd                	jne    801dd1 <fsipc_send+0x36>
+  801df4:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801df7:	c1 e2 04             	shl    $0x4,%edx
+  801dfa:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801e00:	8b 52 54             	mov    0x54(%edx),%edx
+  801e03:	85 d2                	test   %edx,%edx
+  801e05:	74 ca                	je     801dd1 <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801e07:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801e0a:	c1 e2 04             	shl    $0x4,%edx
+  801e0d:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801e13:	8b 52 48             	mov    0x48(%edx),%edx
+  801e16:	89 14 8d 20 50 80 00 	mov    %edx,0x805020(,%ecx,4)
+  801e1d:	8d 49 01             	lea    0x1(%ecx),%ecx
+  801e20:	89 f3                	mov    %esi,%ebx
+  801e22:	eb ad                	jmp    801dd1 <fsipc_send+0x36>
+  801e24:	84 db                	test   %bl,%bl
+  801e26:	74 38                	je     801e60 <fsipc_send+0xc5>
+  801e28:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  801e2e:	eb 30                	jmp    801e60 <fsipc_send+0xc5>
+  801e30:	84 db                	test   %bl,%bl
+  801e32:	74 2c                	je     801e60 <fsipc_send+0xc5>
+  801e34:	89 0d 00 50 80 00    	mov    %ecx,0x805000
+  801e3a:	eb 24                	jmp    801e60 <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  801e3c:	50                   	push   %eax
+  801e3d:	68 74 3c 80 00       	push   $0x803c74
+  801e42:	6a 34                	push   $0x34
+  801e44:	68 7e 3c 80 00       	push   $0x803c7e
+  801e49:	e8 9e e8 ff ff       	call   8006ec <_panic>
+    }
+    sys_yield();
+  801e4e:	e8 2f f3 ff ff       	call   801182 <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  801e53:	83 3d 00 50 80 00 03 	cmpl   $0x3,0x805000
+  801e5a:	0f 8e 51 ff ff ff    	jle    801db1 <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  801e60:	a1 44 57 80 00       	mov    0x805744,%eax
+  801e65:	8b 70 48             	mov    0x48(%eax),%esi
+  801e68:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  801e6e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e73:	8b 0d 00 50 80 00    	mov    0x805000,%ecx
+  801e79:	39 d9                	cmp    %ebx,%ecx
+  801e7b:	7e d1                	jle    801e4e <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  801e7d:	83 ec 0c             	sub    $0xc,%esp
+  801e80:	ff 75 e0             	push   -0x20(%ebp)
+  801e83:	6a 07                	push   $0x7
+  801e85:	ff 75 e4             	push   -0x1c(%ebp)
+  801e88:	57                   	push   %edi
+  801e89:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  801e8c:	99                   	cltd
+  801e8d:	f7 f9                	idiv   %ecx
+  801e8f:	ff 34 95 20 50 80 00 	push   0x805020(,%edx,4)
+  801e96:	e8 00 f6 ff ff       	call   80149b <sys_ipc_try_send>
+      if (r == 0)
+  801e9b:	83 c4 20             	add    $0x20,%esp
+  801e9e:	85 c0                	test   %eax,%eax
+  801ea0:	74 0a                	je     801eac <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  801ea2:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801ea5:	75 95                	jne    801e3c <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  801ea7:	83 c3 01             	add    $0x1,%ebx
+  801eaa:	eb c7                	jmp    801e73 <fsipc_send+0xd8>
+  }
+}
+  801eac:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801eaf:	5b                   	pop    %ebx
+  801eb0:	5e                   	pop    %esi
+  801eb1:	5f                   	pop    %edi
+  801eb2:	5d                   	pop    %ebp
+  801eb3:	c3                   	ret
+
+00801eb4 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801eb4:	55                   	push   %ebp
+  801eb5:	89 e5                	mov    %esp,%ebp
+  801eb7:	53                   	push   %ebx
+  801eb8:	83 ec 14             	sub    $0x14,%esp
+  801ebb:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  801ebd:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  801ec4:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801ec9:	ba 00 60 80 00       	mov    $0x806000,%edx
+  801ece:	e8 c8 fe ff ff       	call   801d9b <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801ed3:	6a 00                	push   $0x0
+  801ed5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ed8:	50                   	push   %eax
+  801ed9:	53                   	push   %ebx
+  801eda:	6a 00                	push   $0x0
+  801edc:	e8 b2 f7 ff ff       	call   801693 <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  801ee1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ee4:	c9                   	leave
+  801ee5:	c3                   	ret
+
+00801ee6 <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801ee6:	55                   	push   %ebp
+  801ee7:	89 e5                	mov    %esp,%ebp
+  801ee9:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801eec:	8b 45 08             	mov    0x8(%ebp),%eax
+  801eef:	8b 40 0c             	mov    0xc(%eax),%eax
+  801ef2:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.set_size.req_size = newsize;
+  801ef7:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801efa:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801eff:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f04:	b8 02 00 00 00       	mov    $0x2,%eax
+  801f09:	e8 a6 ff ff ff       	call   801eb4 <fsipc>
+}
+  801f0e:	c9                   	leave
+  801f0f:	c3                   	ret
+
+00801f10 <devfile_flush>:
+{
+  801f10:	55                   	push   %ebp
+  801f11:	89 e5                	mov    %esp,%ebp
+  801f13:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801f16:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f19:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f1c:	a3 00 60 80 00       	mov    %eax,0x806000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801f21:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f26:	b8 06 00 00 00       	mov    $0x6,%eax
+  801f2b:	e8 84 ff ff ff       	call   801eb4 <fsipc>
+}
+  801f30:	c9                   	leave
+  801f31:	c3                   	ret
+
+00801f32 <devfile_stat>:
+{
+  801f32:	55                   	push   %ebp
+  801f33:	89 e5                	mov    %esp,%ebp
+  801f35:	53                   	push   %ebx
+  801f36:	83 ec 04             	sub    $0x4,%esp
+  801f39:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801f3c:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f3f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f42:	a3 00 60 80 00       	mov    %eax,0x806000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801f47:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f4c:	b8 05 00 00 00       	mov    $0x5,%eax
+  801f51:	e8 5e ff ff ff       	call   801eb4 <fsipc>
+  801f56:	85 c0                	test   %eax,%eax
+  801f58:	78 2c                	js     801f86 <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801f5a:	83 ec 08             	sub    $0x8,%esp
+  801f5d:	68 00 60 80 00       	push   $0x806000
+  801f62:	53                   	push   %ebx
+  801f63:	e8 4d ee ff ff       	call   800db5 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  801f68:	a1 80 60 80 00       	mov    0x806080,%eax
+  801f6d:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801f73:	a1 84 60 80 00       	mov    0x806084,%eax
+  801f78:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801f7e:	83 c4 10             	add    $0x10,%esp
+  801f81:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f86:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801f89:	c9                   	leave
+  801f8a:	c3                   	ret
+
+00801f8b <fsv_alloc>:
+{
+  801f8b:	55                   	push   %ebp
+  801f8c:	89 e5                	mov    %esp,%ebp
+  801f8e:	56                   	push   %esi
+  801f8f:	53                   	push   %ebx
+  801f90:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  801f92:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f97:	eb 22                	jmp    801fbb <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  801f99:	83 ec 04             	sub    $0x4,%esp
+  801f9c:	6a 00                	push   $0x0
+  801f9e:	6a 00                	push   $0x0
+  801fa0:	6a 07                	push   $0x7
+  801fa2:	50                   	push   %eax
+  801fa3:	6a 00                	push   $0x0
+  801fa5:	6a 04                	push   $0x4
+  801fa7:	68 40 50 80 00       	push   $0x805040
+  801fac:	e8 86 f6 ff ff       	call   801637 <sysbatch_add>
+  801fb1:	83 c4 20             	add    $0x20,%esp
+  801fb4:	85 c0                	test   %eax,%eax
+  801fb6:	78 48                	js     802000 <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  801fb8:	83 c3 01             	add    $0x1,%ebx
+  801fbb:	39 f3                	cmp    %esi,%ebx
+  801fbd:	74 31                	je     801ff0 <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  801fbf:	89 d8                	mov    %ebx,%eax
+  801fc1:	c1 e0 0c             	shl    $0xc,%eax
+  801fc4:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801fc9:	89 c2                	mov    %eax,%edx
+  801fcb:	c1 ea 16             	shr    $0x16,%edx
+  801fce:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801fd5:	f6 c2 01             	test   $0x1,%dl
+  801fd8:	74 bf                	je     801f99 <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  801fda:	89 c2                	mov    %eax,%edx
+  801fdc:	c1 ea 0c             	shr    $0xc,%edx
+  801fdf:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801fe6:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801fe9:	83 fa 03             	cmp    $0x3,%edx
+  801fec:	75 ab                	jne    801f99 <fsv_alloc+0xe>
+  801fee:	eb c8                	jmp    801fb8 <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  801ff0:	83 ec 0c             	sub    $0xc,%esp
+  801ff3:	68 40 50 80 00       	push   $0x805040
+  801ff8:	e8 ea f5 ff ff       	call   8015e7 <sysbatch_flush>
+  801ffd:	83 c4 10             	add    $0x10,%esp
+}
+  802000:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802003:	5b                   	pop    %ebx
+  802004:	5e                   	pop    %esi
+  802005:	5d                   	pop    %ebp
+  802006:	c3                   	ret
+
+00802007 <devfile_read>:
+{
+  802007:	55                   	push   %ebp
+  802008:	89 e5                	mov    %esp,%ebp
+  80200a:	57                   	push   %edi
+  80200b:	56                   	push   %esi
+  80200c:	53                   	push   %ebx
+  80200d:	83 ec 3c             	sub    $0x3c,%esp
+  802010:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  802013:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  802019:	77 57                	ja     802072 <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80201b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80201e:	8b 40 0c             	mov    0xc(%eax),%eax
+  802021:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read.req_n = n;
+  802026:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  80202c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802031:	b8 03 00 00 00       	mov    $0x3,%eax
+  802036:	e8 79 fe ff ff       	call   801eb4 <fsipc>
+  80203b:	89 c6                	mov    %eax,%esi
+  80203d:	85 c0                	test   %eax,%eax
+  80203f:	78 27                	js     802068 <devfile_read+0x61>
+  assert(r <= n);
+  802041:	39 c3                	cmp    %eax,%ebx
+  802043:	0f 82 0e 02 00 00    	jb     802257 <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  802049:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  80204e:	0f 8f 1c 02 00 00    	jg     802270 <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  802054:	83 ec 04             	sub    $0x4,%esp
+  802057:	50                   	push   %eax
+  802058:	68 00 60 80 00       	push   $0x806000
+  80205d:	ff 75 0c             	push   0xc(%ebp)
+  802060:	e8 d6 ee ff ff       	call   800f3b <memmove>
+  return r;
+  802065:	83 c4 10             	add    $0x10,%esp
+}
+  802068:	89 f0                	mov    %esi,%eax
+  80206a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80206d:	5b                   	pop    %ebx
+  80206e:	5e                   	pop    %esi
+  80206f:	5f                   	pop    %edi
+  802070:	5d                   	pop    %ebp
+  802071:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  802072:	b8 01 00 00 00       	mov    $0x1,%eax
+  802077:	e8 0f ff ff ff       	call   801f8b <fsv_alloc>
+  80207c:	89 c6                	mov    %eax,%esi
+  80207e:	85 c0                	test   %eax,%eax
+  802080:	78 e6                	js     802068 <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  802082:	8b 45 08             	mov    0x8(%ebp),%eax
+  802085:	8b 40 0c             	mov    0xc(%eax),%eax
+  802088:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  80208d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802090:	8b 40 04             	mov    0x4(%eax),%eax
+  802093:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  802098:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  80209e:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  8020a5:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8020aa:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  8020af:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8020b4:	e8 e2 fc ff ff       	call   801d9b <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  8020b9:	6a 00                	push   $0x0
+  8020bb:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8020be:	50                   	push   %eax
+  8020bf:	68 00 10 c0 9f       	push   $0x9fc01000
+  8020c4:	6a 00                	push   $0x0
+  8020c6:	e8 c8 f5 ff ff       	call   801693 <ipc_recv_pages>
+  8020cb:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  8020cd:	83 c4 10             	add    $0x10,%esp
+  8020d0:	85 c0                	test   %eax,%eax
+  8020d2:	7e 94                	jle    802068 <devfile_read+0x61>
+  assert(r <= n);
+  8020d4:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8020d7:	39 c3                	cmp    %eax,%ebx
+  8020d9:	72 2e                	jb     802109 <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  8020db:	8b 45 08             	mov    0x8(%ebp),%eax
+  8020de:	8b 40 04             	mov    0x4(%eax),%eax
+  8020e1:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8020e6:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  8020e9:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8020ec:	c1 e2 0c             	shl    $0xc,%edx
+  8020ef:	39 ca                	cmp    %ecx,%edx
+  8020f1:	72 2f                	jb     802122 <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  8020f3:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  8020f8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  8020fb:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  8020ff:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  802104:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  802107:	eb 52                	jmp    80215b <devfile_read+0x154>
+  assert(r <= n);
+  802109:	68 89 3c 80 00       	push   $0x803c89
+  80210e:	68 90 3c 80 00       	push   $0x803c90
+  802113:	68 49 01 00 00       	push   $0x149
+  802118:	68 7e 3c 80 00       	push   $0x803c7e
+  80211d:	e8 ca e5 ff ff       	call   8006ec <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  802122:	68 b4 3c 80 00       	push   $0x803cb4
+  802127:	68 90 3c 80 00       	push   $0x803c90
+  80212c:	68 4a 01 00 00       	push   $0x14a
+  802131:	68 7e 3c 80 00       	push   $0x803c7e
+  802136:	e8 b1 e5 ff ff       	call   8006ec <_panic>
+      memmove(dst + done, src + done, m);
+  80213b:	83 ec 04             	sub    $0x4,%esp
+  80213e:	53                   	push   %ebx
+  80213f:	56                   	push   %esi
+  802140:	89 f8                	mov    %edi,%eax
+  802142:	03 45 0c             	add    0xc(%ebp),%eax
+  802145:	50                   	push   %eax
+  802146:	e8 f0 ed ff ff       	call   800f3b <memmove>
+  80214b:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  80214e:	01 df                	add    %ebx,%edi
+  802150:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802153:	39 c7                	cmp    %eax,%edi
+  802155:	0f 83 c0 00 00 00    	jae    80221b <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  80215b:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  80215e:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  802161:	89 f0                	mov    %esi,%eax
+  802163:	25 ff 0f 00 00       	and    $0xfff,%eax
+  802168:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  80216d:	29 c3                	sub    %eax,%ebx
+  80216f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802172:	29 f8                	sub    %edi,%eax
+  802174:	39 c3                	cmp    %eax,%ebx
+  802176:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  802179:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  80217f:	75 ba                	jne    80213b <devfile_read+0x134>
+  802181:	89 f9                	mov    %edi,%ecx
+  802183:	03 4d 0c             	add    0xc(%ebp),%ecx
+  802186:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  802189:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  80218f:	75 aa                	jne    80213b <devfile_read+0x134>
+  802191:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  802197:	77 a2                	ja     80213b <devfile_read+0x134>
+  802199:	89 c8                	mov    %ecx,%eax
+  80219b:	c1 e8 16             	shr    $0x16,%eax
+  80219e:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8021a5:	a8 01                	test   $0x1,%al
+  8021a7:	74 92                	je     80213b <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  8021a9:	89 c8                	mov    %ecx,%eax
+  8021ab:	c1 e8 0c             	shr    $0xc,%eax
+  8021ae:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  8021b5:	a8 01                	test   $0x1,%al
+  8021b7:	74 82                	je     80213b <devfile_read+0x134>
+  8021b9:	a9 02 08 00 00       	test   $0x802,%eax
+  8021be:	0f 84 77 ff ff ff    	je     80213b <devfile_read+0x134>
+  8021c4:	f6 c4 04             	test   $0x4,%ah
+  8021c7:	0f 85 6e ff ff ff    	jne    80213b <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  8021cd:	a1 44 57 80 00       	mov    0x805744,%eax
+  8021d2:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  8021d6:	84 c0                	test   %al,%al
+  8021d8:	75 17                	jne    8021f1 <devfile_read+0x1ea>
+  8021da:	83 ec 08             	sub    $0x8,%esp
+  8021dd:	6a 01                	push   $0x1
+  8021df:	6a 00                	push   $0x0
+  8021e1:	e8 bb ef ff ff       	call   8011a1 <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  8021e6:	83 c4 10             	add    $0x10,%esp
+  8021e9:	85 c0                	test   %eax,%eax
+  8021eb:	0f 85 4a ff ff ff    	jne    80213b <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  8021f1:	83 ec 04             	sub    $0x4,%esp
+  8021f4:	68 05 08 00 00       	push   $0x805
+  8021f9:	ff 75 cc             	push   -0x34(%ebp)
+  8021fc:	6a 00                	push   $0x0
+  8021fe:	56                   	push   %esi
+  8021ff:	6a 00                	push   $0x0
+  802201:	6a 05                	push   $0x5
+  802203:	68 40 50 80 00       	push   $0x805040
+  802208:	e8 2a f4 ff ff       	call   801637 <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  80220d:	c1 e8 1f             	shr    $0x1f,%eax
+  802210:	08 45 cb             	or     %al,-0x35(%ebp)
+  802213:	83 c4 20             	add    $0x20,%esp
+  802216:	e9 33 ff ff ff       	jmp    80214e <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  80221b:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  80221e:	83 ec 0c             	sub    $0xc,%esp
+  802221:	68 40 50 80 00       	push   $0x805040
+  802226:	e8 bc f3 ff ff       	call   8015e7 <sysbatch_flush>
+  80222b:	83 c4 10             	add    $0x10,%esp
+  80222e:	85 c0                	test   %eax,%eax
+  802230:	78 06                	js     802238 <devfile_read+0x231>
+  802232:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  802236:	74 14                	je     80224c <devfile_read+0x245>
+    memmove(dst, src, r);
+  802238:	83 ec 04             	sub    $0x4,%esp
+  80223b:	ff 75 d4             	push   -0x2c(%ebp)
+  80223e:	ff 75 d0             	push   -0x30(%ebp)
+  802241:	ff 75 0c             	push   0xc(%ebp)
+  802244:	e8 f2 ec ff ff       	call   800f3b <memmove>
+  802249:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  80224c:	8b 45 08             	mov    0x8(%ebp),%eax
+  80224f:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  802252:	e9 11 fe ff ff       	jmp    802068 <devfile_read+0x61>
+  assert(r <= n);
+  802257:	68 89 3c 80 00       	push   $0x803c89
+  80225c:	68 90 3c 80 00       	push   $0x803c90
+  802261:	68 1c 01 00 00       	push   $0x11c
+  802266:	68 7e 3c 80 00       	push   $0x803c7e
+  80226b:	e8 7c e4 ff ff       	call   8006ec <_panic>
+  assert(r <= PGSIZE);
+  802270:	68 a5 3c 80 00       	push   $0x803ca5
+  802275:	68 90 3c 80 00       	push   $0x803c90
+  80227a:	68 1d 01 00 00       	push   $0x11d
+  80227f:	68 7e 3c 80 00       	push   $0x803c7e
+  802284:	e8 63 e4 ff ff       	call   8006ec <_panic>
+
+00802289 <devfile_write>:
+{
+  802289:	55                   	push   %ebp
+  80228a:	89 e5                	mov    %esp,%ebp
+  80228c:	57                   	push   %edi
+  80228d:	56                   	push   %esi
+  80228e:	53                   	push   %ebx
+  80228f:	83 ec 1c             	sub    $0x1c,%esp
+  802292:	8b 75 08             	mov    0x8(%ebp),%esi
+  802295:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  802298:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  80229d:	77 39                	ja     8022d8 <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80229f:	8b 56 0c             	mov    0xc(%esi),%edx
+  8022a2:	89 15 00 60 80 00    	mov    %edx,0x806000
+  fsipcbuf.write.req_n = n;
+  8022a8:	a3 04 60 80 00       	mov    %eax,0x806004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  8022ad:	83 ec 04             	sub    $0x4,%esp
+  8022b0:	50                   	push   %eax
+  8022b1:	ff 75 0c             	push   0xc(%ebp)
+  8022b4:	68 08 60 80 00       	push   $0x806008
+  8022b9:	e8 7d ec ff ff       	call   800f3b <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  8022be:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022c3:	b8 04 00 00 00       	mov    $0x4,%eax
+  8022c8:	e8 e7 fb ff ff       	call   801eb4 <fsipc>
+  8022cd:	83 c4 10             	add    $0x10,%esp
+}
+  8022d0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8022d3:	5b                   	pop    %ebx
+  8022d4:	5e                   	pop    %esi
+  8022d5:	5f                   	pop    %edi
+  8022d6:	5d                   	pop    %ebp
+  8022d7:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  8022d8:	ba 00 00 10 00       	mov    $0x100000,%edx
+  8022dd:	39 d0                	cmp    %edx,%eax
+  8022df:	89 d3                	mov    %edx,%ebx
+  8022e1:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  8022e4:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  8022ea:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  8022ed:	83 c7 01             	add    $0x1,%edi
+  8022f0:	89 f8                	mov    %edi,%eax
+  8022f2:	e8 94 fc ff ff       	call   801f8b <fsv_alloc>
+  8022f7:	85 c0                	test   %eax,%eax
+  8022f9:	78 d5                	js     8022d0 <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  8022fb:	83 ec 04             	sub    $0x4,%esp
+  8022fe:	53                   	push   %ebx
+  8022ff:	ff 75 0c             	push   0xc(%ebp)
+  802302:	68 00 10 c0 9f       	push   $0x9fc01000
+  802307:	e8 2f ec ff ff       	call   800f3b <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  80230c:	8b 46 0c             	mov    0xc(%esi),%eax
+  80230f:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  802314:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  80231a:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  802321:	89 f9                	mov    %edi,%ecx
+  802323:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  802328:	b8 0d 00 00 00       	mov    $0xd,%eax
+  80232d:	e8 69 fa ff ff       	call   801d9b <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  802332:	6a 00                	push   $0x0
+  802334:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802337:	50                   	push   %eax
+  802338:	6a 00                	push   $0x0
+  80233a:	6a 00                	push   $0x0
+  80233c:	e8 52 f3 ff ff       	call   801693 <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  802341:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  802344:	eb 8a                	jmp    8022d0 <devfile_write+0x47>
+
+00802346 <open>:
+{
+  802346:	55                   	push   %ebp
+  802347:	89 e5                	mov    %esp,%ebp
+  802349:	56                   	push   %esi
+  80234a:	53                   	push   %ebx
+  80234b:	83 ec 1c             	sub    $0x1c,%esp
+  80234e:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  802351:	56                   	push   %esi
+  802352:	e8 23 ea ff ff       	call   800d7a <strlen>
+  802357:	83 c4 10             	add    $0x10,%esp
+  80235a:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80235f:	7f 6c                	jg     8023cd <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  802361:	83 ec 0c             	sub    $0xc,%esp
+  802364:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802367:	50                   	push   %eax
+  802368:	e8 ad f4 ff ff       	call   80181a <fd_alloc>
+  80236d:	89 c3                	mov    %eax,%ebx
+  80236f:	83 c4 10             	add    $0x10,%esp
+  802372:	85 c0                	test   %eax,%eax
+  802374:	78 3c                	js     8023b2 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  802376:	83 ec 08             	sub    $0x8,%esp
+  802379:	56                   	push   %esi
+  80237a:	68 00 60 80 00       	push   $0x806000
+  80237f:	e8 31 ea ff ff       	call   800db5 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  802384:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802387:	a3 00 64 80 00       	mov    %eax,0x806400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  80238c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  80238f:	b8 01 00 00 00       	mov    $0x1,%eax
+  802394:	e8 1b fb ff ff       	call   801eb4 <fsipc>
+  802399:	89 c3                	mov    %eax,%ebx
+  80239b:	83 c4 10             	add    $0x10,%esp
+  80239e:	85 c0                	test   %eax,%eax
+  8023a0:	78 19                	js     8023bb <open+0x75>
+  return fd2num(fd);
+  8023a2:	83 ec 0c             	sub    $0xc,%esp
+  8023a5:	ff 75 f4             	push   -0xc(%ebp)
+  8023a8:	e8 49 f4 ff ff       	call   8017f6 <fd2num>
+  8023ad:	89 c3                	mov    %eax,%ebx
+  8023af:	83 c4 10             	add    $0x10,%esp
+}
+  8023b2:	89 d8                	mov    %ebx,%eax
+  8023b4:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8023b7:	5b                   	pop    %ebx
+  8023b8:	5e                   	pop    %esi
+  8023b9:	5d                   	pop    %ebp
+  8023ba:	c3                   	ret
+    fd_close(fd, 0);
+  8023bb:	83 ec 08             	sub    $0x8,%esp
+  8023be:	6a 00                	push   $0x0
+  8023c0:	ff 75 f4             	push   -0xc(%ebp)
+  8023c3:	e8 44 f5 ff ff       	call   80190c <fd_close>
+    return r;
+  8023c8:	83 c4 10             	add    $0x10,%esp
+  8023cb:	eb e5                	jmp    8023b2 <open+0x6c>
+    return -E_BAD_PATH;
+  8023cd:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8023d2:	eb de                	jmp    8023b2 <open+0x6c>
+
+008023d4 <open_read>:
+{
+  8023d4:	55                   	push   %ebp
+  8023d5:	89 e5                	mov    %esp,%ebp
+  8023d7:	57                   	push   %edi
+  8023d8:	56                   	push   %esi
+  8023d9:	53                   	push   %ebx
+  8023da:	83 ec 28             	sub    $0x28,%esp
+  8023dd:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  8023e0:	57                   	push   %edi
+  8023e1:	e8 94 e9 ff ff       	call   800d7a <strlen>
+  8023e6:	83 c4 10             	add    $0x10,%esp
+  8023e9:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  8023ee:	0f 87 f6 00 00 00    	ja     8024ea <open_read+0x116>
+  8023f4:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  8023f6:	83 ec 0c             	sub    $0xc,%esp
+  8023f9:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8023fc:	50                   	push   %eax
+  8023fd:	e8 18 f4 ff ff       	call   80181a <fd_alloc>
+  802402:	89 c3                	mov    %eax,%ebx
+  802404:	83 c4 10             	add    $0x10,%esp
+  802407:	85 c0                	test   %eax,%eax
+  802409:	0f 88 b2 00 00 00    	js     8024c1 <open_read+0xed>
+  strcpy(req->req_buf, path);
+  80240f:	83 ec 08             	sub    $0x8,%esp
+  802412:	57                   	push   %edi
+  802413:	68 e4 60 80 00       	push   $0x8060e4
+  802418:	e8 98 e9 ff ff       	call   800db5 <strcpy>
+  req->req_nops = 2;
+  80241d:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  802424:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  802427:	c7 05 04 60 80 00 01 	movl   $0x1,0x806004
+  80242e:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  802431:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802434:	a3 10 60 80 00       	mov    %eax,0x806010
+  req->req_ops[0].op_buf = 0;
+  802439:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  802440:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  802443:	c7 05 20 60 80 00 04 	movl   $0x4,0x806020
+  80244a:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  80244d:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  802454:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  802457:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  80245c:	29 f0                	sub    %esi,%eax
+  80245e:	3b 45 14             	cmp    0x14(%ebp),%eax
+  802461:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  802465:	a3 2c 60 80 00       	mov    %eax,0x80602c
+  req->req_ops[1].op_offset = 0;
+  80246a:	c7 05 30 60 80 00 00 	movl   $0x0,0x806030
+  802471:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  802474:	83 c6 01             	add    $0x1,%esi
+  802477:	89 35 34 60 80 00    	mov    %esi,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  80247d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802480:	b8 0e 00 00 00       	mov    $0xe,%eax
+  802485:	e8 2a fa ff ff       	call   801eb4 <fsipc>
+  80248a:	89 c3                	mov    %eax,%ebx
+  80248c:	83 c4 10             	add    $0x10,%esp
+  80248f:	83 f8 01             	cmp    $0x1,%eax
+  802492:	7e 37                	jle    8024cb <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  802494:	a1 38 60 80 00       	mov    0x806038,%eax
+  802499:	8b 55 18             	mov    0x18(%ebp),%edx
+  80249c:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  80249e:	83 ec 04             	sub    $0x4,%esp
+  8024a1:	50                   	push   %eax
+  8024a2:	81 c6 e4 60 80 00    	add    $0x8060e4,%esi
+  8024a8:	56                   	push   %esi
+  8024a9:	ff 75 10             	push   0x10(%ebp)
+  8024ac:	e8 8a ea ff ff       	call   800f3b <memmove>
+  return fd2num(fd);
+  8024b1:	83 c4 04             	add    $0x4,%esp
+  8024b4:	ff 75 e4             	push   -0x1c(%ebp)
+  8024b7:	e8 3a f3 ff ff       	call   8017f6 <fd2num>
+  8024bc:	89 c3                	mov    %eax,%ebx
+  8024be:	83 c4 10             	add    $0x10,%esp
+}
+  8024c1:	89 d8                	mov    %ebx,%eax
+  8024c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024c6:	5b                   	pop    %ebx
+  8024c7:	5e                   	pop    %esi
+  8024c8:	5f                   	pop    %edi
+  8024c9:	5d                   	pop    %ebp
+  8024ca:	c3                   	ret
+    fd_close(fd, 0);
+  8024cb:	83 ec 08             	sub    $0x8,%esp
+  8024ce:	6a 00                	push   $0x0
+  8024d0:	ff 75 e4             	push   -0x1c(%ebp)
+  8024d3:	e8 34 f4 ff ff       	call   80190c <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  8024d8:	83 c4 10             	add    $0x10,%esp
+  8024db:	85 db                	test   %ebx,%ebx
+  8024dd:	78 e2                	js     8024c1 <open_read+0xed>
+  8024df:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  8024e2:	8b 9b 1c 60 80 00    	mov    0x80601c(%ebx),%ebx
+  8024e8:	eb d7                	jmp    8024c1 <open_read+0xed>
+    return -E_BAD_PATH;
+  8024ea:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8024ef:	eb d0                	jmp    8024c1 <open_read+0xed>
+
+008024f1 <file_stat>:
+{
+  8024f1:	55                   	push   %ebp
+  8024f2:	89 e5                	mov    %esp,%ebp
+  8024f4:	57                   	push   %edi
+  8024f5:	56                   	push   %esi
+  8024f6:	53                   	push   %ebx
+  8024f7:	83 ec 18             	sub    $0x18,%esp
+  8024fa:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8024fd:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  802500:	57                   	push   %edi
+  802501:	e8 74 e8 ff ff       	call   800d7a <strlen>
+  802506:	83 c4 10             	add    $0x10,%esp
+  802509:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  80250e:	0f 8f c7 00 00 00    	jg     8025db <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  802514:	83 ec 0c             	sub    $0xc,%esp
+  802517:	57                   	push   %edi
+  802518:	e8 5d e8 ff ff       	call   800d7a <strlen>
+  80251d:	8d 58 04             	lea    0x4(%eax),%ebx
+  802520:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  802523:	83 c4 08             	add    $0x8,%esp
+  802526:	57                   	push   %edi
+  802527:	68 e4 60 80 00       	push   $0x8060e4
+  80252c:	e8 84 e8 ff ff       	call   800db5 <strcpy>
+  req->req_nops = 2;
+  802531:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  802538:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  80253b:	c7 05 04 60 80 00 02 	movl   $0x2,0x806004
+  802542:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  802545:	c7 05 10 60 80 00 00 	movl   $0x0,0x806010
+  80254c:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  80254f:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  802556:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  802559:	c7 05 20 60 80 00 03 	movl   $0x3,0x806020
+  802560:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  802563:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  80256a:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  80256d:	89 1d 34 60 80 00    	mov    %ebx,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  802573:	ba 00 00 00 00       	mov    $0x0,%edx
+  802578:	b8 0e 00 00 00       	mov    $0xe,%eax
+  80257d:	e8 32 f9 ff ff       	call   801eb4 <fsipc>
+  802582:	83 c4 10             	add    $0x10,%esp
+  802585:	83 f8 01             	cmp    $0x1,%eax
+  802588:	7e 42                	jle    8025cc <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  80258a:	81 c3 e4 60 80 00    	add    $0x8060e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  802590:	83 ec 08             	sub    $0x8,%esp
+  802593:	53                   	push   %ebx
+  802594:	56                   	push   %esi
+  802595:	e8 1b e8 ff ff       	call   800db5 <strcpy>
+  st->st_size = ret->ret_size;
+  80259a:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  8025a0:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  8025a6:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  8025ac:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  8025b2:	c7 86 88 00 00 00 08 	movl   $0x804008,0x88(%esi)
+  8025b9:	40 80 00 
+  return 0;
+  8025bc:	83 c4 10             	add    $0x10,%esp
+  8025bf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8025c7:	5b                   	pop    %ebx
+  8025c8:	5e                   	pop    %esi
+  8025c9:	5f                   	pop    %edi
+  8025ca:	5d                   	pop    %ebp
+  8025cb:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  8025cc:	85 c0                	test   %eax,%eax
+  8025ce:	78 f4                	js     8025c4 <file_stat+0xd3>
+  8025d0:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8025d3:	8b 80 1c 60 80 00    	mov    0x80601c(%eax),%eax
+  8025d9:	eb e9                	jmp    8025c4 <file_stat+0xd3>
+    return -E_BAD_PATH;
+  8025db:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  8025e0:	eb e2                	jmp    8025c4 <file_stat+0xd3>
+
+008025e2 <read_map>:
+{
+  8025e2:	55                   	push   %ebp
+  8025e3:	89 e5                	mov    %esp,%ebp
+  8025e5:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8025e8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8025eb:	50                   	push   %eax
+  8025ec:	ff 75 08             	push   0x8(%ebp)
+  8025ef:	e8 7c f2 ff ff       	call   801870 <fd_lookup>
+  8025f4:	83 c4 10             	add    $0x10,%esp
+  8025f7:	85 c0                	test   %eax,%eax
+  8025f9:	78 2a                	js     802625 <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  8025fb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8025fe:	8b 0d 08 40 80 00    	mov    0x804008,%ecx
+  802604:	39 08                	cmp    %ecx,(%eax)
+  802606:	75 1f                	jne    802627 <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  802608:	8b 40 0c             	mov    0xc(%eax),%eax
+  80260b:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read_map.req_offset = offset;
+  802610:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802613:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  802618:	8b 55 10             	mov    0x10(%ebp),%edx
+  80261b:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802620:	e8 8f f8 ff ff       	call   801eb4 <fsipc>
+}
+  802625:	c9                   	leave
+  802626:	c3                   	ret
+    return -E_INVAL;
+  802627:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80262c:	eb f7                	jmp    802625 <read_map+0x43>
+
+0080262e <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  80262e:	55                   	push   %ebp
+  80262f:	89 e5                	mov    %esp,%ebp
+  802631:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  802634:	ba 00 00 00 00       	mov    $0x0,%edx
+  802639:	b8 08 00 00 00       	mov    $0x8,%eax
+  80263e:	e8 71 f8 ff ff       	call   801eb4 <fsipc>
+}
+  802643:	c9                   	leave
+  802644:	c3                   	ret
+
+00802645 <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  802645:	55                   	push   %ebp
+  802646:	89 e5                	mov    %esp,%ebp
+  802648:	57                   	push   %edi
+  802649:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  80264a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80264d:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.stats.req_bio_sched = 0;
+  802652:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  802659:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  80265c:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  802663:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  802666:	ba 00 00 00 00       	mov    $0x0,%edx
+  80266b:	b8 09 00 00 00       	mov    $0x9,%eax
+  802670:	e8 3f f8 ff ff       	call   801eb4 <fsipc>
+  802675:	85 c0                	test   %eax,%eax
+  802677:	78 14                	js     80268d <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  802679:	be 00 60 80 00       	mov    $0x806000,%esi
+  80267e:	b9 16 00 00 00       	mov    $0x16,%ecx
+  802683:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  802686:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  802688:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80268d:	5e                   	pop    %esi
+  80268e:	5f                   	pop    %edi
+  80268f:	5d                   	pop    %ebp
+  802690:	c3                   	ret
+
+00802691 <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  802691:	55                   	push   %ebp
+  802692:	89 e5                	mov    %esp,%ebp
+  802694:	53                   	push   %ebx
+  802695:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  802698:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  80269b:	50                   	push   %eax
+  80269c:	6a 00                	push   $0x0
+  80269e:	e8 a2 ff ff ff       	call   802645 <fs_stats>
+  8026a3:	83 c4 10             	add    $0x10,%esp
+  8026a6:	85 c0                	test   %eax,%eax
+  8026a8:	78 28                	js     8026d2 <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  8026aa:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  8026ad:	83 ec 08             	sub    $0x8,%esp
+  8026b0:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8026b3:	50                   	push   %eax
+  8026b4:	6a 20                	push   $0x20
+  8026b6:	e8 8a ff ff ff       	call   802645 <fs_stats>
+  8026bb:	83 c4 10             	add    $0x10,%esp
+  8026be:	85 c0                	test   %eax,%eax
+  8026c0:	78 10                	js     8026d2 <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  8026c2:	83 ec 08             	sub    $0x8,%esp
+  8026c5:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8026c8:	50                   	push   %eax
+  8026c9:	53                   	push   %ebx
+  8026ca:	e8 76 ff ff ff       	call   802645 <fs_stats>
+  8026cf:	83 c4 10             	add    $0x10,%esp
+}
+  8026d2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8026d5:	c9                   	leave
+  8026d6:	c3                   	ret
+
+008026d7 <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  8026d7:	55                   	push   %ebp
+  8026d8:	89 e5                	mov    %esp,%ebp
+  8026da:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  8026dd:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  8026e4:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  8026e7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8026ea:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.stats.req_dcache = 0;
+  8026ef:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  8026f6:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  8026f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026fe:	b8 09 00 00 00       	mov    $0x9,%eax
+  802703:	e8 ac f7 ff ff       	call   801eb4 <fsipc>
+}
+  802708:	c9                   	leave
+  802709:	c3                   	ret
+
+0080270a <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  80270a:	55                   	push   %ebp
+  80270b:	89 e5                	mov    %esp,%ebp
+  80270d:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  802710:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  802717:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  80271a:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  802721:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  802724:	8b 45 08             	mov    0x8(%ebp),%eax
+  802727:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_STATS, NULL);
+  80272c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802731:	b8 09 00 00 00       	mov    $0x9,%eax
+  802736:	e8 79 f7 ff ff       	call   801eb4 <fsipc>
+}
+  80273b:	c9                   	leave
+  80273c:	c3                   	ret
+
+0080273d <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  80273d:	55                   	push   %ebp
+  80273e:	89 e5                	mov    %esp,%ebp
+  802740:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802743:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802746:	50                   	push   %eax
+  802747:	ff 75 08             	push   0x8(%ebp)
+  80274a:	e8 21 f1 ff ff       	call   801870 <fd_lookup>
+  80274f:	83 c4 10             	add    $0x10,%esp
+  802752:	85 c0                	test   %eax,%eax
+  802754:	78 34                	js     80278a <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  802756:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802759:	8b 0d 08 40 80 00    	mov    0x804008,%ecx
+  80275f:	39 08                	cmp    %ecx,(%eax)
+  802761:	75 29                	jne    80278c <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  802763:	8b 40 0c             	mov    0xc(%eax),%eax
+  802766:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.fallocate.req_offset = offset;
+  80276b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80276e:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.fallocate.req_len = len;
+  802773:	8b 45 10             	mov    0x10(%ebp),%eax
+  802776:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  80277b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802780:	b8 0f 00 00 00       	mov    $0xf,%eax
+  802785:	e8 2a f7 ff ff       	call   801eb4 <fsipc>
+}
+  80278a:	c9                   	leave
+  80278b:	c3                   	ret
+    return -E_INVAL;
+  80278c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802791:	eb f7                	jmp    80278a <fallocate+0x4d>
+
+00802793 <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  802793:	55                   	push   %ebp
+  802794:	89 e5                	mov    %esp,%ebp
+  802796:	57                   	push   %edi
+  802797:	56                   	push   %esi
+  802798:	53                   	push   %ebx
+  802799:	83 ec 24             	sub    $0x24,%esp
+  80279c:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80279f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8027a2:	50                   	push   %eax
+  8027a3:	ff 75 08             	push   0x8(%ebp)
+  8027a6:	e8 c5 f0 ff ff       	call   801870 <fd_lookup>
+  8027ab:	83 c4 10             	add    $0x10,%esp
+  8027ae:	85 c0                	test   %eax,%eax
+  8027b0:	78 66                	js     802818 <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  8027b2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8027b5:	8b 0d 08 40 80 00    	mov    0x804008,%ecx
+  8027bb:	39 08                	cmp    %ecx,(%eax)
+  8027bd:	75 61                	jne    802820 <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  8027bf:	85 f6                	test   %esi,%esi
+  8027c1:	7e 50                	jle    802813 <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  8027c3:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  8027c8:	39 de                	cmp    %ebx,%esi
+  8027ca:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  8027cd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8027d0:	8b 40 0c             	mov    0xc(%eax),%eax
+  8027d3:	a3 00 60 80 00       	mov    %eax,0x806000
+    fsipcbuf.prefetch.req_n = m;
+  8027d8:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  8027de:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  8027e5:	83 ec 04             	sub    $0x4,%esp
+  8027e8:	57                   	push   %edi
+  8027e9:	ff 75 0c             	push   0xc(%ebp)
+  8027ec:	68 08 60 80 00       	push   $0x806008
+  8027f1:	e8 45 e7 ff ff       	call   800f3b <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  8027f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027fb:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802800:	e8 af f6 ff ff       	call   801eb4 <fsipc>
+  802805:	83 c4 10             	add    $0x10,%esp
+  802808:	85 c0                	test   %eax,%eax
+  80280a:	78 0c                	js     802818 <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  80280c:	01 7d 0c             	add    %edi,0xc(%ebp)
+  80280f:	29 de                	sub    %ebx,%esi
+  802811:	eb ac                	jmp    8027bf <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  802813:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802818:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80281b:	5b                   	pop    %ebx
+  80281c:	5e                   	pop    %esi
+  80281d:	5f                   	pop    %edi
+  80281e:	5d                   	pop    %ebp
+  80281f:	c3                   	ret
+    return -E_INVAL;
+  802820:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802825:	eb f1                	jmp    802818 <prefetch+0x85>
+
+00802827 <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  802827:	55                   	push   %ebp
+  802828:	89 e5                	mov    %esp,%ebp
+  80282a:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  80282d:	50                   	push   %eax
+  80282e:	e8 d3 ef ff ff       	call   801806 <fd2data>
+  802833:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  802838:	c9                   	leave
+  802839:	c3                   	ret
+
+0080283a <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80283a:	55                   	push   %ebp
+  80283b:	89 e5                	mov    %esp,%ebp
+  80283d:	56                   	push   %esi
+  80283e:	53                   	push   %ebx
+  80283f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  802842:	83 ec 0c             	sub    $0xc,%esp
+  802845:	ff 75 08             	push   0x8(%ebp)
+  802848:	e8 b9 ef ff ff       	call   801806 <fd2data>
+  80284d:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  80284f:	83 c4 08             	add    $0x8,%esp
+  802852:	68 e0 3c 80 00       	push   $0x803ce0
+  802857:	53                   	push   %ebx
+  802858:	e8 58 e5 ff ff       	call   800db5 <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  80285d:	8b 46 04             	mov    0x4(%esi),%eax
+  802860:	2b 06                	sub    (%esi),%eax
+  802862:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  802868:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  80286f:	00 00 00 
+  stat->st_dev = &devpipe;
+  802872:	c7 83 88 00 00 00 24 	movl   $0x804024,0x88(%ebx)
+  802879:	40 80 00 
+  return 0;
+}
+  80287c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802881:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802884:	5b                   	pop    %ebx
+  802885:	5e                   	pop    %esi
+  802886:	5d                   	pop    %ebp
+  802887:	c3                   	ret
+
+00802888 <pipe_wakeup>:
+{
+  802888:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  80288a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80288f:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  802892:	85 c0                	test   %eax,%eax
+  802894:	75 01                	jne    802897 <pipe_wakeup+0xf>
+  802896:	c3                   	ret
+{
+  802897:	55                   	push   %ebp
+  802898:	89 e5                	mov    %esp,%ebp
+  80289a:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  80289d:	6a 00                	push   $0x0
+  80289f:	68 00 00 c0 ee       	push   $0xeec00000
+  8028a4:	52                   	push   %edx
+  8028a5:	e8 96 ec ff ff       	call   801540 <sys_chan_wakeup>
+  8028aa:	83 c4 10             	add    $0x10,%esp
+}
+  8028ad:	c9                   	leave
+  8028ae:	c3                   	ret
+
+008028af <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8028af:	55                   	push   %ebp
+  8028b0:	89 e5                	mov    %esp,%ebp
+  8028b2:	57                   	push   %edi
+  8028b3:	56                   	push   %esi
+  8028b4:	53                   	push   %ebx
+  8028b5:	83 ec 18             	sub    $0x18,%esp
+  8028b8:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  8028bb:	57                   	push   %edi
+  8028bc:	e8 45 ef ff ff       	call   801806 <fd2data>
+  8028c1:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  8028c3:	83 c4 10             	add    $0x10,%esp
+  8028c6:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  8028ca:	74 2a                	je     8028f6 <devpipe_close+0x47>
+  8028cc:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  8028d1:	89 f8                	mov    %edi,%eax
+  8028d3:	e8 4f ff ff ff       	call   802827 <pipe_ring>
+  8028d8:	83 ec 08             	sub    $0x8,%esp
+  8028db:	01 d8                	add    %ebx,%eax
+  8028dd:	50                   	push   %eax
+  8028de:	6a 00                	push   $0x0
+  8028e0:	e8 84 e9 ff ff       	call   801269 <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  8028e5:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8028eb:	83 c4 10             	add    $0x10,%esp
+  8028ee:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  8028f4:	75 db                	jne    8028d1 <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  8028f6:	83 ec 08             	sub    $0x8,%esp
+  8028f9:	57                   	push   %edi
+  8028fa:	6a 00                	push   $0x0
+  8028fc:	e8 68 e9 ff ff       	call   801269 <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  802901:	83 c4 10             	add    $0x10,%esp
+  802904:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  802908:	75 13                	jne    80291d <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  80290a:	83 ec 08             	sub    $0x8,%esp
+  80290d:	56                   	push   %esi
+  80290e:	6a 00                	push   $0x0
+  802910:	e8 54 e9 ff ff       	call   801269 <sys_page_unmap>
+}
+  802915:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802918:	5b                   	pop    %ebx
+  802919:	5e                   	pop    %esi
+  80291a:	5f                   	pop    %edi
+  80291b:	5d                   	pop    %ebp
+  80291c:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  80291d:	8d 56 04             	lea    0x4(%esi),%edx
+  802920:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802923:	e8 60 ff ff ff       	call   802888 <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802928:	8d 46 30             	lea    0x30(%esi),%eax
+  80292b:	89 f2                	mov    %esi,%edx
+  80292d:	e8 56 ff ff ff       	call   802888 <pipe_wakeup>
+  802932:	eb d6                	jmp    80290a <devpipe_close+0x5b>
+
+00802934 <_pipeisclosed>:
+{
+  802934:	55                   	push   %ebp
+  802935:	89 e5                	mov    %esp,%ebp
+  802937:	57                   	push   %edi
+  802938:	56                   	push   %esi
+  802939:	53                   	push   %ebx
+  80293a:	83 ec 1c             	sub    $0x1c,%esp
+  80293d:	89 c7                	mov    %eax,%edi
+  80293f:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  802941:	a1 44 57 80 00       	mov    0x805744,%eax
+  802946:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  802949:	83 ec 0c             	sub    $0xc,%esp
+  80294c:	57                   	push   %edi
+  80294d:	e8 b5 08 00 00       	call   803207 <pageref>
+  802952:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802955:	89 34 24             	mov    %esi,(%esp)
+  802958:	e8 aa 08 00 00       	call   803207 <pageref>
+    nn = thisenv->env_runs;
+  80295d:	8b 15 44 57 80 00    	mov    0x805744,%edx
+  802963:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  802966:	83 c4 10             	add    $0x10,%esp
+  802969:	39 cb                	cmp    %ecx,%ebx
+  80296b:	74 1b                	je     802988 <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  80296d:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802970:	75 cf                	jne    802941 <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802972:	8b 42 58             	mov    0x58(%edx),%eax
+  802975:	6a 01                	push   $0x1
+  802977:	50                   	push   %eax
+  802978:	53                   	push   %ebx
+  802979:	68 e7 3c 80 00       	push   $0x803ce7
+  80297e:	e8 44 de ff ff       	call   8007c7 <cprintf>
+  802983:	83 c4 10             	add    $0x10,%esp
+  802986:	eb b9                	jmp    802941 <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  802988:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  80298b:	0f 94 c0             	sete   %al
+  80298e:	0f b6 c0             	movzbl %al,%eax
+}
+  802991:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802994:	5b                   	pop    %ebx
+  802995:	5e                   	pop    %esi
+  802996:	5f                   	pop    %edi
+  802997:	5d                   	pop    %ebp
+  802998:	c3                   	ret
+
+00802999 <devpipe_write_bulk>:
+{
+  802999:	55                   	push   %ebp
+  80299a:	89 e5                	mov    %esp,%ebp
+  80299c:	57                   	push   %edi
+  80299d:	56                   	push   %esi
+  80299e:	53                   	push   %ebx
+  80299f:	83 ec 1c             	sub    $0x1c,%esp
+  8029a2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8029a5:	89 d6                	mov    %edx,%esi
+  8029a7:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  8029aa:	e8 78 fe ff ff       	call   802827 <pipe_ring>
+  8029af:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  8029b2:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  8029b7:	8d 46 04             	lea    0x4(%esi),%eax
+  8029ba:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  8029bd:	eb 75                	jmp    802a34 <devpipe_write_bulk+0x9b>
+  8029bf:	b8 01 00 00 00       	mov    $0x1,%eax
+  8029c4:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  8029c8:	6a 64                	push   $0x64
+  8029ca:	68 00 00 c0 ee       	push   $0xeec00000
+  8029cf:	53                   	push   %ebx
+  8029d0:	56                   	push   %esi
+  8029d1:	e8 47 eb ff ff       	call   80151d <sys_chan_sleep>
+      continue;
+  8029d6:	83 c4 10             	add    $0x10,%esp
+  8029d9:	eb 59                	jmp    802a34 <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  8029db:	89 d1                	mov    %edx,%ecx
+  8029dd:	c1 f9 1f             	sar    $0x1f,%ecx
+  8029e0:	c1 e9 11             	shr    $0x11,%ecx
+  8029e3:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  8029e6:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8029eb:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  8029ed:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  8029f3:	29 d3                	sub    %edx,%ebx
+  8029f5:	ba 00 80 00 00       	mov    $0x8000,%edx
+  8029fa:	29 c2                	sub    %eax,%edx
+  8029fc:	39 d3                	cmp    %edx,%ebx
+  8029fe:	0f 47 da             	cmova  %edx,%ebx
+  802a01:	8b 55 08             	mov    0x8(%ebp),%edx
+  802a04:	29 fa                	sub    %edi,%edx
+  802a06:	39 d3                	cmp    %edx,%ebx
+  802a08:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  802a0b:	83 ec 04             	sub    $0x4,%esp
+  802a0e:	53                   	push   %ebx
+  802a0f:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802a12:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  802a15:	52                   	push   %edx
+  802a16:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802a19:	01 c8                	add    %ecx,%eax
+  802a1b:	50                   	push   %eax
+  802a1c:	e8 7c e5 ff ff       	call   800f9d <memcpy>
+    i += m;
+  802a21:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  802a23:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802a26:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802a29:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802a2c:	e8 57 fe ff ff       	call   802888 <pipe_wakeup>
+  802a31:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802a34:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802a37:	73 2b                	jae    802a64 <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  802a39:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  802a3b:	8b 56 04             	mov    0x4(%esi),%edx
+  802a3e:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  802a44:	39 d0                	cmp    %edx,%eax
+  802a46:	7d 93                	jge    8029db <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  802a48:	89 f2                	mov    %esi,%edx
+  802a4a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802a4d:	e8 e2 fe ff ff       	call   802934 <_pipeisclosed>
+  802a52:	85 c0                	test   %eax,%eax
+  802a54:	0f 84 65 ff ff ff    	je     8029bf <devpipe_write_bulk+0x26>
+        return i;
+  802a5a:	89 f8                	mov    %edi,%eax
+}
+  802a5c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a5f:	5b                   	pop    %ebx
+  802a60:	5e                   	pop    %esi
+  802a61:	5f                   	pop    %edi
+  802a62:	5d                   	pop    %ebp
+  802a63:	c3                   	ret
+  return i;
+  802a64:	89 f8                	mov    %edi,%eax
+  802a66:	eb f4                	jmp    802a5c <devpipe_write_bulk+0xc3>
+
+00802a68 <devpipe_write>:
+{
+  802a68:	55                   	push   %ebp
+  802a69:	89 e5                	mov    %esp,%ebp
+  802a6b:	57                   	push   %edi
+  802a6c:	56                   	push   %esi
+  802a6d:	53                   	push   %ebx
+  802a6e:	83 ec 28             	sub    $0x28,%esp
+  802a71:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  802a74:	56                   	push   %esi
+  802a75:	e8 8c ed ff ff       	call   801806 <fd2data>
+  802a7a:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  802a7c:	8b 78 28             	mov    0x28(%eax),%edi
+  802a7f:	83 c4 10             	add    $0x10,%esp
+  802a82:	85 ff                	test   %edi,%edi
+  802a84:	75 25                	jne    802aab <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  802a86:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802a89:	74 66                	je     802af1 <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802a8b:	8b 43 04             	mov    0x4(%ebx),%eax
+  802a8e:	8b 0b                	mov    (%ebx),%ecx
+  802a90:	8d 51 20             	lea    0x20(%ecx),%edx
+  802a93:	39 d0                	cmp    %edx,%eax
+  802a95:	72 2b                	jb     802ac2 <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  802a97:	89 da                	mov    %ebx,%edx
+  802a99:	89 f0                	mov    %esi,%eax
+  802a9b:	e8 94 fe ff ff       	call   802934 <_pipeisclosed>
+  802aa0:	85 c0                	test   %eax,%eax
+  802aa2:	75 51                	jne    802af5 <devpipe_write+0x8d>
+      sys_yield();
+  802aa4:	e8 d9 e6 ff ff       	call   801182 <sys_yield>
+  802aa9:	eb e0                	jmp    802a8b <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  802aab:	83 ec 0c             	sub    $0xc,%esp
+  802aae:	ff 75 10             	push   0x10(%ebp)
+  802ab1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802ab4:	89 c2                	mov    %eax,%edx
+  802ab6:	89 f0                	mov    %esi,%eax
+  802ab8:	e8 dc fe ff ff       	call   802999 <devpipe_write_bulk>
+  802abd:	83 c4 10             	add    $0x10,%esp
+  802ac0:	eb 38                	jmp    802afa <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802ac2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802ac5:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802ac9:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802acc:	89 c2                	mov    %eax,%edx
+  802ace:	c1 fa 1f             	sar    $0x1f,%edx
+  802ad1:	89 d1                	mov    %edx,%ecx
+  802ad3:	c1 e9 1b             	shr    $0x1b,%ecx
+  802ad6:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802ad9:	83 e2 1f             	and    $0x1f,%edx
+  802adc:	29 ca                	sub    %ecx,%edx
+  802ade:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802ae2:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  802ae6:	83 c0 01             	add    $0x1,%eax
+  802ae9:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  802aec:	83 c7 01             	add    $0x1,%edi
+  802aef:	eb 95                	jmp    802a86 <devpipe_write+0x1e>
+  return i;
+  802af1:	89 f8                	mov    %edi,%eax
+  802af3:	eb 05                	jmp    802afa <devpipe_write+0x92>
+        return 0;
+  802af5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802afa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802afd:	5b                   	pop    %ebx
+  802afe:	5e                   	pop    %esi
+  802aff:	5f                   	pop    %edi
+  802b00:	5d                   	pop    %ebp
+  802b01:	c3                   	ret
+
+00802b02 <devpipe_read_bulk>:
+{
+  802b02:	55                   	push   %ebp
+  802b03:	89 e5                	mov    %esp,%ebp
+  802b05:	57                   	push   %edi
+  802b06:	56                   	push   %esi
+  802b07:	53                   	push   %ebx
+  802b08:	83 ec 2c             	sub    $0x2c,%esp
+  802b0b:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802b0e:	89 d6                	mov    %edx,%esi
+  802b10:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802b13:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  802b16:	e8 0c fd ff ff       	call   802827 <pipe_ring>
+  802b1b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  802b1e:	85 db                	test   %ebx,%ebx
+  802b20:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802b25:	0f 45 c3             	cmovne %ebx,%eax
+  802b28:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802b2b:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802b30:	8d 46 30             	lea    0x30(%esi),%eax
+  802b33:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  802b36:	eb 50                	jmp    802b88 <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  802b38:	89 d1                	mov    %edx,%ecx
+  802b3a:	c1 f9 1f             	sar    $0x1f,%ecx
+  802b3d:	c1 e9 11             	shr    $0x11,%ecx
+  802b40:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802b43:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802b48:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  802b4a:	29 d3                	sub    %edx,%ebx
+  802b4c:	ba 00 80 00 00       	mov    $0x8000,%edx
+  802b51:	29 c2                	sub    %eax,%edx
+  802b53:	39 d3                	cmp    %edx,%ebx
+  802b55:	0f 47 da             	cmova  %edx,%ebx
+  802b58:	8b 55 08             	mov    0x8(%ebp),%edx
+  802b5b:	29 fa                	sub    %edi,%edx
+  802b5d:	39 d3                	cmp    %edx,%ebx
+  802b5f:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  802b62:	83 ec 04             	sub    $0x4,%esp
+  802b65:	53                   	push   %ebx
+  802b66:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802b69:	01 c8                	add    %ecx,%eax
+  802b6b:	50                   	push   %eax
+  802b6c:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802b6f:	01 f8                	add    %edi,%eax
+  802b71:	50                   	push   %eax
+  802b72:	e8 26 e4 ff ff       	call   800f9d <memcpy>
+    i += m;
+  802b77:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  802b79:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802b7b:	89 f2                	mov    %esi,%edx
+  802b7d:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802b80:	e8 03 fd ff ff       	call   802888 <pipe_wakeup>
+  802b85:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802b88:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802b8b:	73 51                	jae    802bde <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  802b8d:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  802b90:	8b 16                	mov    (%esi),%edx
+  802b92:	39 da                	cmp    %ebx,%edx
+  802b94:	75 a2                	jne    802b38 <devpipe_read_bulk+0x36>
+      if (i > 0)
+  802b96:	85 ff                	test   %edi,%edi
+  802b98:	75 44                	jne    802bde <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  802b9a:	89 f2                	mov    %esi,%edx
+  802b9c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802b9f:	e8 90 fd ff ff       	call   802934 <_pipeisclosed>
+  802ba4:	85 c0                	test   %eax,%eax
+  802ba6:	75 3a                	jne    802be2 <devpipe_read_bulk+0xe0>
+  802ba8:	b8 01 00 00 00       	mov    $0x1,%eax
+  802bad:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802bb1:	6a 64                	push   $0x64
+  802bb3:	ff 75 d4             	push   -0x2c(%ebp)
+  802bb6:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  802bb7:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802bba:	50                   	push   %eax
+  802bbb:	e8 5d e9 ff ff       	call   80151d <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  802bc0:	85 c0                	test   %eax,%eax
+  802bc2:	ba 00 00 00 00       	mov    $0x0,%edx
+  802bc7:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  802bca:	83 c4 10             	add    $0x10,%esp
+  802bcd:	a8 01                	test   $0x1,%al
+  802bcf:	74 b7                	je     802b88 <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  802bd1:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  802bd6:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802bd9:	5b                   	pop    %ebx
+  802bda:	5e                   	pop    %esi
+  802bdb:	5f                   	pop    %edi
+  802bdc:	5d                   	pop    %ebp
+  802bdd:	c3                   	ret
+  return i;
+  802bde:	89 f8                	mov    %edi,%eax
+  802be0:	eb f4                	jmp    802bd6 <devpipe_read_bulk+0xd4>
+        return 0;
+  802be2:	b8 00 00 00 00       	mov    $0x0,%eax
+  802be7:	eb ed                	jmp    802bd6 <devpipe_read_bulk+0xd4>
+
+00802be9 <devpipe_read>:
+{
+  802be9:	55                   	push   %ebp
+  802bea:	89 e5                	mov    %esp,%ebp
+  802bec:	57                   	push   %edi
+  802bed:	56                   	push   %esi
+  802bee:	53                   	push   %ebx
+  802bef:	83 ec 18             	sub    $0x18,%esp
+  802bf2:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  802bf5:	57                   	push   %edi
+  802bf6:	e8 0b ec ff ff       	call   801806 <fd2data>
+  802bfb:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  802bfd:	8b 70 28             	mov    0x28(%eax),%esi
+  802c00:	83 c4 10             	add    $0x10,%esp
+  802c03:	85 f6                	test   %esi,%esi
+  802c05:	75 24                	jne    802c2b <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  802c07:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802c0a:	74 60                	je     802c6c <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  802c0c:	8b 03                	mov    (%ebx),%eax
+  802c0e:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802c11:	75 3b                	jne    802c4e <devpipe_read+0x65>
+      if (i > 0)
+  802c13:	85 f6                	test   %esi,%esi
+  802c15:	75 2d                	jne    802c44 <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  802c17:	89 da                	mov    %ebx,%edx
+  802c19:	89 f8                	mov    %edi,%eax
+  802c1b:	e8 14 fd ff ff       	call   802934 <_pipeisclosed>
+  802c20:	85 c0                	test   %eax,%eax
+  802c22:	75 4c                	jne    802c70 <devpipe_read+0x87>
+      sys_yield();
+  802c24:	e8 59 e5 ff ff       	call   801182 <sys_yield>
+  802c29:	eb e1                	jmp    802c0c <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  802c2b:	83 ec 08             	sub    $0x8,%esp
+  802c2e:	6a 00                	push   $0x0
+  802c30:	ff 75 10             	push   0x10(%ebp)
+  802c33:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802c36:	89 c2                	mov    %eax,%edx
+  802c38:	89 f8                	mov    %edi,%eax
+  802c3a:	e8 c3 fe ff ff       	call   802b02 <devpipe_read_bulk>
+  802c3f:	83 c4 10             	add    $0x10,%esp
+  802c42:	eb 02                	jmp    802c46 <devpipe_read+0x5d>
+        return i;
+  802c44:	89 f0                	mov    %esi,%eax
+}
+  802c46:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c49:	5b                   	pop    %ebx
+  802c4a:	5e                   	pop    %esi
+  802c4b:	5f                   	pop    %edi
+  802c4c:	5d                   	pop    %ebp
+  802c4d:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802c4e:	99                   	cltd
+  802c4f:	c1 ea 1b             	shr    $0x1b,%edx
+  802c52:	01 d0                	add    %edx,%eax
+  802c54:	83 e0 1f             	and    $0x1f,%eax
+  802c57:	29 d0                	sub    %edx,%eax
+  802c59:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802c5e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802c61:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  802c64:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  802c67:	83 c6 01             	add    $0x1,%esi
+  802c6a:	eb 9b                	jmp    802c07 <devpipe_read+0x1e>
+  return i;
+  802c6c:	89 f0                	mov    %esi,%eax
+  802c6e:	eb d6                	jmp    802c46 <devpipe_read+0x5d>
+        return 0;
+  802c70:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c75:	eb cf                	jmp    802c46 <devpipe_read+0x5d>
+
+00802c77 <pipe2>:
+{
+  802c77:	55                   	push   %ebp
+  802c78:	89 e5                	mov    %esp,%ebp
+  802c7a:	57                   	push   %edi
+  802c7b:	56                   	push   %esi
+  802c7c:	53                   	push   %ebx
+  802c7d:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  802c80:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802c83:	50                   	push   %eax
+  802c84:	e8 91 eb ff ff       	call   80181a <fd_alloc>
+  802c89:	89 c3                	mov    %eax,%ebx
+  802c8b:	83 c4 10             	add    $0x10,%esp
+  802c8e:	85 c0                	test   %eax,%eax
+  802c90:	0f 88 fb 01 00 00    	js     802e91 <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802c96:	83 ec 04             	sub    $0x4,%esp
+  802c99:	68 07 04 00 00       	push   $0x407
+  802c9e:	ff 75 e4             	push   -0x1c(%ebp)
+  802ca1:	6a 00                	push   $0x0
+  802ca3:	e8 3c e5 ff ff       	call   8011e4 <sys_page_alloc>
+  802ca8:	89 c3                	mov    %eax,%ebx
+  802caa:	83 c4 10             	add    $0x10,%esp
+  802cad:	85 c0                	test   %eax,%eax
+  802caf:	0f 88 dc 01 00 00    	js     802e91 <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  802cb5:	83 ec 0c             	sub    $0xc,%esp
+  802cb8:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  802cbb:	50                   	push   %eax
+  802cbc:	e8 59 eb ff ff       	call   80181a <fd_alloc>
+  802cc1:	89 c3                	mov    %eax,%ebx
+  802cc3:	83 c4 10             	add    $0x10,%esp
+  802cc6:	85 c0                	test   %eax,%eax
+  802cc8:	0f 88 b3 01 00 00    	js     802e81 <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802cce:	83 ec 04             	sub    $0x4,%esp
+  802cd1:	68 07 04 00 00       	push   $0x407
+  802cd6:	ff 75 e0             	push   -0x20(%ebp)
+  802cd9:	6a 00                	push   $0x0
+  802cdb:	e8 04 e5 ff ff       	call   8011e4 <sys_page_alloc>
+  802ce0:	89 c3                	mov    %eax,%ebx
+  802ce2:	83 c4 10             	add    $0x10,%esp
+  802ce5:	85 c0                	test   %eax,%eax
+  802ce7:	0f 88 94 01 00 00    	js     802e81 <pipe2+0x20a>
+  va = fd2data(fd0);
+  802ced:	83 ec 0c             	sub    $0xc,%esp
+  802cf0:	ff 75 e4             	push   -0x1c(%ebp)
+  802cf3:	e8 0e eb ff ff       	call   801806 <fd2data>
+  802cf8:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802cfa:	83 c4 0c             	add    $0xc,%esp
+  802cfd:	68 07 04 00 00       	push   $0x407
+  802d02:	50                   	push   %eax
+  802d03:	6a 00                	push   $0x0
+  802d05:	e8 da e4 ff ff       	call   8011e4 <sys_page_alloc>
+  802d0a:	89 c3                	mov    %eax,%ebx
+  802d0c:	83 c4 10             	add    $0x10,%esp
+  802d0f:	85 c0                	test   %eax,%eax
+  802d11:	0f 88 5a 01 00 00    	js     802e71 <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802d17:	83 ec 0c             	sub    $0xc,%esp
+  802d1a:	ff 75 e0             	push   -0x20(%ebp)
+  802d1d:	e8 e4 ea ff ff       	call   801806 <fd2data>
+  802d22:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802d29:	50                   	push   %eax
+  802d2a:	6a 00                	push   $0x0
+  802d2c:	57                   	push   %edi
+  802d2d:	6a 00                	push   $0x0
+  802d2f:	e8 f3 e4 ff ff       	call   801227 <sys_page_map>
+  802d34:	89 c3                	mov    %eax,%ebx
+  802d36:	83 c4 20             	add    $0x20,%esp
+  802d39:	85 c0                	test   %eax,%eax
+  802d3b:	0f 88 22 01 00 00    	js     802e63 <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  802d41:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  802d45:	74 72                	je     802db9 <pipe2+0x142>
+  802d47:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  802d4c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802d4f:	e8 d3 fa ff ff       	call   802827 <pipe_ring>
+  802d54:	83 ec 04             	sub    $0x4,%esp
+  802d57:	68 07 04 00 00       	push   $0x407
+  802d5c:	01 f0                	add    %esi,%eax
+  802d5e:	50                   	push   %eax
+  802d5f:	6a 00                	push   $0x0
+  802d61:	e8 7e e4 ff ff       	call   8011e4 <sys_page_alloc>
+  802d66:	89 c3                	mov    %eax,%ebx
+  802d68:	83 c4 10             	add    $0x10,%esp
+  802d6b:	85 c0                	test   %eax,%eax
+  802d6d:	0f 88 97 00 00 00    	js     802e0a <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  802d73:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802d76:	e8 ac fa ff ff       	call   802827 <pipe_ring>
+  802d7b:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  802d7e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802d81:	e8 a1 fa ff ff       	call   802827 <pipe_ring>
+  802d86:	83 ec 0c             	sub    $0xc,%esp
+  802d89:	68 07 04 00 00       	push   $0x407
+  802d8e:	53                   	push   %ebx
+  802d8f:	6a 00                	push   $0x0
+  802d91:	01 f0                	add    %esi,%eax
+  802d93:	50                   	push   %eax
+  802d94:	6a 00                	push   $0x0
+  802d96:	e8 8c e4 ff ff       	call   801227 <sys_page_map>
+  802d9b:	89 c3                	mov    %eax,%ebx
+  802d9d:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802da3:	83 c4 20             	add    $0x20,%esp
+  802da6:	85 c0                	test   %eax,%eax
+  802da8:	78 60                	js     802e0a <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  802daa:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802db0:	75 9a                	jne    802d4c <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  802db2:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  802db9:	a1 24 40 80 00       	mov    0x804024,%eax
+  802dbe:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802dc1:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  802dc3:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802dc6:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  802dcd:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802dd0:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  802dd2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802dd5:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  802ddc:	83 ec 0c             	sub    $0xc,%esp
+  802ddf:	ff 75 e4             	push   -0x1c(%ebp)
+  802de2:	e8 0f ea ff ff       	call   8017f6 <fd2num>
+  802de7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802dea:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  802dec:	83 c4 04             	add    $0x4,%esp
+  802def:	ff 75 e0             	push   -0x20(%ebp)
+  802df2:	e8 ff e9 ff ff       	call   8017f6 <fd2num>
+  802df7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802dfa:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  802dfd:	83 c4 10             	add    $0x10,%esp
+  802e00:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802e05:	e9 87 00 00 00       	jmp    802e91 <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802e0a:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  802e0f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802e12:	e8 10 fa ff ff       	call   802827 <pipe_ring>
+  802e17:	83 ec 08             	sub    $0x8,%esp
+  802e1a:	01 f0                	add    %esi,%eax
+  802e1c:	50                   	push   %eax
+  802e1d:	6a 00                	push   $0x0
+  802e1f:	e8 45 e4 ff ff       	call   801269 <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  802e24:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802e27:	e8 fb f9 ff ff       	call   802827 <pipe_ring>
+  802e2c:	83 c4 08             	add    $0x8,%esp
+  802e2f:	01 f0                	add    %esi,%eax
+  802e31:	50                   	push   %eax
+  802e32:	6a 00                	push   $0x0
+  802e34:	e8 30 e4 ff ff       	call   801269 <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802e39:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802e3f:	83 c4 10             	add    $0x10,%esp
+  802e42:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802e48:	75 c5                	jne    802e0f <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  802e4a:	83 ec 0c             	sub    $0xc,%esp
+  802e4d:	ff 75 e0             	push   -0x20(%ebp)
+  802e50:	e8 b1 e9 ff ff       	call   801806 <fd2data>
+  802e55:	83 c4 08             	add    $0x8,%esp
+  802e58:	50                   	push   %eax
+  802e59:	6a 00                	push   $0x0
+  802e5b:	e8 09 e4 ff ff       	call   801269 <sys_page_unmap>
+  802e60:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  802e63:	83 ec 08             	sub    $0x8,%esp
+  802e66:	57                   	push   %edi
+  802e67:	6a 00                	push   $0x0
+  802e69:	e8 fb e3 ff ff       	call   801269 <sys_page_unmap>
+  802e6e:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  802e71:	83 ec 08             	sub    $0x8,%esp
+  802e74:	ff 75 e0             	push   -0x20(%ebp)
+  802e77:	6a 00                	push   $0x0
+  802e79:	e8 eb e3 ff ff       	call   801269 <sys_page_unmap>
+  802e7e:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  802e81:	83 ec 08             	sub    $0x8,%esp
+  802e84:	ff 75 e4             	push   -0x1c(%ebp)
+  802e87:	6a 00                	push   $0x0
+  802e89:	e8 db e3 ff ff       	call   801269 <sys_page_unmap>
+  802e8e:	83 c4 10             	add    $0x10,%esp
+}
+  802e91:	89 d8                	mov    %ebx,%eax
+  802e93:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e96:	5b                   	pop    %ebx
+  802e97:	5e                   	pop    %esi
+  802e98:	5f                   	pop    %edi
+  802e99:	5d                   	pop    %ebp
+  802e9a:	c3                   	ret
+
+00802e9b <pipe>:
+{
+  802e9b:	55                   	push   %ebp
+  802e9c:	89 e5                	mov    %esp,%ebp
+  802e9e:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  802ea1:	6a 00                	push   $0x0
+  802ea3:	ff 75 08             	push   0x8(%ebp)
+  802ea6:	e8 cc fd ff ff       	call   802c77 <pipe2>
+}
+  802eab:	c9                   	leave
+  802eac:	c3                   	ret
+
+00802ead <pipeisclosed>:
+{
+  802ead:	55                   	push   %ebp
+  802eae:	89 e5                	mov    %esp,%ebp
+  802eb0:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802eb3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802eb6:	50                   	push   %eax
+  802eb7:	ff 75 08             	push   0x8(%ebp)
+  802eba:	e8 b1 e9 ff ff       	call   801870 <fd_lookup>
+  802ebf:	83 c4 10             	add    $0x10,%esp
+  802ec2:	85 c0                	test   %eax,%eax
+  802ec4:	78 18                	js     802ede <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  802ec6:	83 ec 0c             	sub    $0xc,%esp
+  802ec9:	ff 75 f4             	push   -0xc(%ebp)
+  802ecc:	e8 35 e9 ff ff       	call   801806 <fd2data>
+  802ed1:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  802ed3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802ed6:	e8 59 fa ff ff       	call   802934 <_pipeisclosed>
+  802edb:	83 c4 10             	add    $0x10,%esp
+}
+  802ede:	c9                   	leave
+  802edf:	c3                   	ret
+
+00802ee0 <pipe_splice>:
+{
+  802ee0:	55                   	push   %ebp
+  802ee1:	89 e5                	mov    %esp,%ebp
+  802ee3:	57                   	push   %edi
+  802ee4:	56                   	push   %esi
+  802ee5:	53                   	push   %ebx
+  802ee6:	83 ec 34             	sub    $0x34,%esp
+  802ee9:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802eec:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802eef:	50                   	push   %eax
+  802ef0:	ff 75 08             	push   0x8(%ebp)
+  802ef3:	e8 78 e9 ff ff       	call   801870 <fd_lookup>
+  802ef8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802efb:	83 c4 10             	add    $0x10,%esp
+  802efe:	85 c0                	test   %eax,%eax
+  802f00:	0f 88 d7 00 00 00    	js     802fdd <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  802f06:	83 ec 0c             	sub    $0xc,%esp
+  802f09:	ff 75 e4             	push   -0x1c(%ebp)
+  802f0c:	e8 f5 e8 ff ff       	call   801806 <fd2data>
+  802f11:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802f13:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802f16:	83 c4 10             	add    $0x10,%esp
+  802f19:	8b 15 24 40 80 00    	mov    0x804024,%edx
+  802f1f:	39 10                	cmp    %edx,(%eax)
+  802f21:	0f 85 c1 00 00 00    	jne    802fe8 <pipe_splice+0x108>
+  802f27:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  802f2b:	0f 84 c0 00 00 00    	je     802ff1 <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  802f31:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802f35:	0f 84 bf 00 00 00    	je     802ffa <pipe_splice+0x11a>
+  802f3b:	89 f7                	mov    %esi,%edi
+  802f3d:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  802f43:	0f 85 ba 00 00 00    	jne    803003 <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802f49:	8d 43 04             	lea    0x4(%ebx),%eax
+  802f4c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802f4f:	eb 38                	jmp    802f89 <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802f51:	83 ec 0c             	sub    $0xc,%esp
+  802f54:	68 00 10 00 00       	push   $0x1000
+  802f59:	89 f1                	mov    %esi,%ecx
+  802f5b:	89 da                	mov    %ebx,%edx
+  802f5d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802f60:	e8 34 fa ff ff       	call   802999 <devpipe_write_bulk>
+  802f65:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802f68:	83 c4 10             	add    $0x10,%esp
+  802f6b:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802f70:	75 53                	jne    802fc5 <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  802f72:	83 ec 08             	sub    $0x8,%esp
+  802f75:	56                   	push   %esi
+  802f76:	6a 00                	push   $0x0
+  802f78:	e8 ec e2 ff ff       	call   801269 <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  802f7d:	83 c7 01             	add    $0x1,%edi
+  802f80:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802f86:	83 c4 10             	add    $0x10,%esp
+  802f89:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802f8c:	74 3a                	je     802fc8 <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  802f8e:	8b 03                	mov    (%ebx),%eax
+  802f90:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802f93:	75 bc                	jne    802f51 <pipe_splice+0x71>
+  802f95:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f9a:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  802f9e:	85 c0                	test   %eax,%eax
+  802fa0:	74 af                	je     802f51 <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802fa2:	83 ec 04             	sub    $0x4,%esp
+  802fa5:	6a 07                	push   $0x7
+  802fa7:	56                   	push   %esi
+  802fa8:	ff 75 d0             	push   -0x30(%ebp)
+  802fab:	e8 90 e5 ff ff       	call   801540 <sys_chan_wakeup>
+  802fb0:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802fb3:	83 c4 10             	add    $0x10,%esp
+  802fb6:	85 c0                	test   %eax,%eax
+  802fb8:	79 b8                	jns    802f72 <pipe_splice+0x92>
+  802fba:	b8 01 00 00 00       	mov    $0x1,%eax
+  802fbf:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802fc3:	eb 8c                	jmp    802f51 <pipe_splice+0x71>
+  802fc5:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  802fc8:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802fcc:	75 06                	jne    802fd4 <pipe_splice+0xf4>
+  802fce:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802fd2:	78 09                	js     802fdd <pipe_splice+0xfd>
+  return i * PGSIZE;
+  802fd4:	8b 45 10             	mov    0x10(%ebp),%eax
+  802fd7:	c1 e0 0c             	shl    $0xc,%eax
+  802fda:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  802fdd:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802fe0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802fe3:	5b                   	pop    %ebx
+  802fe4:	5e                   	pop    %esi
+  802fe5:	5f                   	pop    %edi
+  802fe6:	5d                   	pop    %ebp
+  802fe7:	c3                   	ret
+    return -E_INVAL;
+  802fe8:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802fef:	eb ec                	jmp    802fdd <pipe_splice+0xfd>
+  802ff1:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802ff8:	eb e3                	jmp    802fdd <pipe_splice+0xfd>
+  802ffa:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  803001:	eb da                	jmp    802fdd <pipe_splice+0xfd>
+  803003:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  80300a:	eb d1                	jmp    802fdd <pipe_splice+0xfd>
+
+0080300c <pipe_splice_read>:
+{
+  80300c:	55                   	push   %ebp
+  80300d:	89 e5                	mov    %esp,%ebp
+  80300f:	53                   	push   %ebx
+  803010:	83 ec 1c             	sub    $0x1c,%esp
+  803013:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803016:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803019:	50                   	push   %eax
+  80301a:	ff 75 08             	push   0x8(%ebp)
+  80301d:	e8 4e e8 ff ff       	call   801870 <fd_lookup>
+  803022:	83 c4 10             	add    $0x10,%esp
+  803025:	85 c0                	test   %eax,%eax
+  803027:	78 49                	js     803072 <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  803029:	83 ec 0c             	sub    $0xc,%esp
+  80302c:	ff 75 f4             	push   -0xc(%ebp)
+  80302f:	e8 d2 e7 ff ff       	call   801806 <fd2data>
+  803034:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  803036:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803039:	83 c4 10             	add    $0x10,%esp
+  80303c:	8b 0d 24 40 80 00    	mov    0x804024,%ecx
+  803042:	39 08                	cmp    %ecx,(%eax)
+  803044:	75 31                	jne    803077 <pipe_splice_read+0x6b>
+  803046:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  80304a:	74 32                	je     80307e <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  80304c:	8b 48 08             	mov    0x8(%eax),%ecx
+  80304f:	83 e1 03             	and    $0x3,%ecx
+  803052:	83 f9 01             	cmp    $0x1,%ecx
+  803055:	74 2e                	je     803085 <pipe_splice_read+0x79>
+  803057:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  80305d:	75 2d                	jne    80308c <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  80305f:	83 ec 08             	sub    $0x8,%esp
+  803062:	53                   	push   %ebx
+  803063:	68 00 10 00 00       	push   $0x1000
+  803068:	89 d9                	mov    %ebx,%ecx
+  80306a:	e8 93 fa ff ff       	call   802b02 <devpipe_read_bulk>
+  80306f:	83 c4 10             	add    $0x10,%esp
+}
+  803072:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  803075:	c9                   	leave
+  803076:	c3                   	ret
+    return -E_INVAL;
+  803077:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80307c:	eb f4                	jmp    803072 <pipe_splice_read+0x66>
+  80307e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803083:	eb ed                	jmp    803072 <pipe_splice_read+0x66>
+  803085:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80308a:	eb e6                	jmp    803072 <pipe_splice_read+0x66>
+  80308c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803091:	eb df                	jmp    803072 <pipe_splice_read+0x66>
+
+00803093 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  803093:	b8 00 00 00 00       	mov    $0x0,%eax
+  803098:	c3                   	ret
+
+00803099 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803099:	55                   	push   %ebp
+  80309a:	89 e5                	mov    %esp,%ebp
+  80309c:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  80309f:	68 ff 3c 80 00       	push   $0x803cff
+  8030a4:	ff 75 0c             	push   0xc(%ebp)
+  8030a7:	e8 09 dd ff ff       	call   800db5 <strcpy>
+  return 0;
+}
+  8030ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030b1:	c9                   	leave
+  8030b2:	c3                   	ret
+
+008030b3 <devcons_write>:
+{
+  8030b3:	55                   	push   %ebp
+  8030b4:	89 e5                	mov    %esp,%ebp
+  8030b6:	57                   	push   %edi
+  8030b7:	56                   	push   %esi
+  8030b8:	53                   	push   %ebx
+  8030b9:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  8030bf:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  8030c4:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  8030ca:	eb 2e                	jmp    8030fa <devcons_write+0x47>
+    m = n - tot;
+  8030cc:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8030cf:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  8030d1:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8030d6:	39 c3                	cmp    %eax,%ebx
+  8030d8:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  8030db:	83 ec 04             	sub    $0x4,%esp
+  8030de:	53                   	push   %ebx
+  8030df:	89 f0                	mov    %esi,%eax
+  8030e1:	03 45 0c             	add    0xc(%ebp),%eax
+  8030e4:	50                   	push   %eax
+  8030e5:	57                   	push   %edi
+  8030e6:	e8 50 de ff ff       	call   800f3b <memmove>
+    sys_cputs(buf, m);
+  8030eb:	83 c4 08             	add    $0x8,%esp
+  8030ee:	53                   	push   %ebx
+  8030ef:	57                   	push   %edi
+  8030f0:	e8 f0 df ff ff       	call   8010e5 <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  8030f5:	01 de                	add    %ebx,%esi
+  8030f7:	83 c4 10             	add    $0x10,%esp
+  8030fa:	3b 75 10             	cmp    0x10(%ebp),%esi
+  8030fd:	72 cd                	jb     8030cc <devcons_write+0x19>
+}
+  8030ff:	89 f0                	mov    %esi,%eax
+  803101:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803104:	5b                   	pop    %ebx
+  803105:	5e                   	pop    %esi
+  803106:	5f                   	pop    %edi
+  803107:	5d                   	pop    %ebp
+  803108:	c3                   	ret
+
+00803109 <devcons_read>:
+{
+  803109:	55                   	push   %ebp
+  80310a:	89 e5                	mov    %esp,%ebp
+  80310c:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  80310f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803114:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  803118:	75 07                	jne    803121 <devcons_read+0x18>
+  80311a:	eb 1f                	jmp    80313b <devcons_read+0x32>
+    sys_yield();
+  80311c:	e8 61 e0 ff ff       	call   801182 <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  803121:	e8 dd df ff ff       	call   801103 <sys_cgetc>
+  803126:	85 c0                	test   %eax,%eax
+  803128:	74 f2                	je     80311c <devcons_read+0x13>
+  if (c < 0)
+  80312a:	78 0f                	js     80313b <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  80312c:	83 f8 04             	cmp    $0x4,%eax
+  80312f:	74 0c                	je     80313d <devcons_read+0x34>
+  *(char*)vbuf = c;
+  803131:	8b 55 0c             	mov    0xc(%ebp),%edx
+  803134:	88 02                	mov    %al,(%edx)
+  return 1;
+  803136:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80313b:	c9                   	leave
+  80313c:	c3                   	ret
+    return 0;
+  80313d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803142:	eb f7                	jmp    80313b <devcons_read+0x32>
+
+00803144 <cputchar>:
+{
+  803144:	55                   	push   %ebp
+  803145:	89 e5                	mov    %esp,%ebp
+  803147:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  80314a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80314d:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  803150:	6a 01                	push   $0x1
+  803152:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  803155:	50                   	push   %eax
+  803156:	e8 8a df ff ff       	call   8010e5 <sys_cputs>
+}
+  80315b:	83 c4 10             	add    $0x10,%esp
+  80315e:	c9                   	leave
+  80315f:	c3                   	ret
+
+00803160 <getchar>:
+{
+  803160:	55                   	push   %ebp
+  803161:	89 e5                	mov    %esp,%ebp
+  803163:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  803166:	6a 01                	push   $0x1
+  803168:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  80316b:	50                   	push   %eax
+  80316c:	6a 00                	push   $0x0
+  80316e:	e8 a8 e9 ff ff       	call   801b1b <read>
+  if (r < 0)
+  803173:	83 c4 10             	add    $0x10,%esp
+  803176:	85 c0                	test   %eax,%eax
+  803178:	78 06                	js     803180 <getchar+0x20>
+  if (r < 1)
+  80317a:	74 06                	je     803182 <getchar+0x22>
+  return c;
+  80317c:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803180:	c9                   	leave
+  803181:	c3                   	ret
+    return -E_EOF;
+  803182:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803187:	eb f7                	jmp    803180 <getchar+0x20>
+
+00803189 <iscons>:
+{
+  803189:	55                   	push   %ebp
+  80318a:	89 e5                	mov    %esp,%ebp
+  80318c:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80318f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803192:	50                   	push   %eax
+  803193:	ff 75 08             	push   0x8(%ebp)
+  803196:	e8 d5 e6 ff ff       	call   801870 <fd_lookup>
+  80319b:	83 c4 10             	add    $0x10,%esp
+  80319e:	85 c0                	test   %eax,%eax
+  8031a0:	78 11                	js     8031b3 <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  8031a2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8031a5:	8b 15 40 40 80 00    	mov    0x804040,%edx
+  8031ab:	39 10                	cmp    %edx,(%eax)
+  8031ad:	0f 94 c0             	sete   %al
+  8031b0:	0f b6 c0             	movzbl %al,%eax
+}
+  8031b3:	c9                   	leave
+  8031b4:	c3                   	ret
+
+008031b5 <opencons>:
+{
+  8031b5:	55                   	push   %ebp
+  8031b6:	89 e5                	mov    %esp,%ebp
+  8031b8:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  8031bb:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8031be:	50                   	push   %eax
+  8031bf:	e8 56 e6 ff ff       	call   80181a <fd_alloc>
+  8031c4:	83 c4 10             	add    $0x10,%esp
+  8031c7:	85 c0                	test   %eax,%eax
+  8031c9:	78 3a                	js     803205 <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  8031cb:	83 ec 04             	sub    $0x4,%esp
+  8031ce:	68 07 04 00 00       	push   $0x407
+  8031d3:	ff 75 f4             	push   -0xc(%ebp)
+  8031d6:	6a 00                	push   $0x0
+  8031d8:	e8 07 e0 ff ff       	call   8011e4 <sys_page_alloc>
+  8031dd:	83 c4 10             	add    $0x10,%esp
+  8031e0:	85 c0                	test   %eax,%eax
+  8031e2:	78 21                	js     803205 <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  8031e4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8031e7:	8b 15 40 40 80 00    	mov    0x804040,%edx
+  8031ed:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  8031ef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8031f2:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  8031f9:	83 ec 0c             	sub    $0xc,%esp
+  8031fc:	50                   	push   %eax
+  8031fd:	e8 f4 e5 ff ff       	call   8017f6 <fd2num>
+  803202:	83 c4 10             	add    $0x10,%esp
+}
+  803205:	c9                   	leave
+  803206:	c3                   	ret
+
+00803207 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803207:	55                   	push   %ebp
+  803208:	89 e5                	mov    %esp,%ebp
+  80320a:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  80320d:	89 c2                	mov    %eax,%edx
+  80320f:	c1 ea 16             	shr    $0x16,%edx
+  803212:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  803219:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  80321e:	f6 c1 01             	test   $0x1,%cl
+  803221:	74 1c                	je     80323f <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  803223:	c1 e8 0c             	shr    $0xc,%eax
+  803226:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  80322d:	a8 01                	test   $0x1,%al
+  80322f:	74 0e                	je     80323f <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  803231:	c1 e8 0c             	shr    $0xc,%eax
+  803234:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  80323b:	ef 
+  80323c:	0f b7 d2             	movzwl %dx,%edx
+}
+  80323f:	89 d0                	mov    %edx,%eax
+  803241:	5d                   	pop    %ebp
+  803242:	c3                   	ret
+
+00803243 <udivmod>:
+  803243:	55                   	push   %ebp
+  803244:	57                   	push   %edi
+  803245:	56                   	push   %esi
+  803246:	53                   	push   %ebx
+  803247:	83 ec 14             	sub    $0x14,%esp
+  80324a:	8b 74 24 28          	mov    0x28(%esp),%esi
+  80324e:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  803252:	89 fb                	mov    %edi,%ebx
+  803254:	09 f3                	or     %esi,%ebx
+  803256:	0f 84 88 00 00 00    	je     8032e4 <udivmod+0xa1>
+  80325c:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  803261:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  803268:	00 
+  803269:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  803270:	00 
+  803271:	89 cd                	mov    %ecx,%ebp
+  803273:	89 34 24             	mov    %esi,(%esp)
+  803276:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  80327a:	eb 08                	jmp    803284 <udivmod+0x41>
+  80327c:	83 ed 01             	sub    $0x1,%ebp
+  80327f:	83 fd ff             	cmp    $0xffffffff,%ebp
+  803282:	74 6c                	je     8032f0 <udivmod+0xad>
+  803284:	89 c3                	mov    %eax,%ebx
+  803286:	89 d6                	mov    %edx,%esi
+  803288:	89 e9                	mov    %ebp,%ecx
+  80328a:	0f ad f3             	shrd   %cl,%esi,%ebx
+  80328d:	d3 ee                	shr    %cl,%esi
+  80328f:	f6 c1 20             	test   $0x20,%cl
+  803292:	74 04                	je     803298 <udivmod+0x55>
+  803294:	89 f3                	mov    %esi,%ebx
+  803296:	31 f6                	xor    %esi,%esi
+  803298:	8b 3c 24             	mov    (%esp),%edi
+  80329b:	39 fb                	cmp    %edi,%ebx
+  80329d:	89 f7                	mov    %esi,%edi
+  80329f:	8b 1c 24             	mov    (%esp),%ebx
+  8032a2:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8032a6:	19 f7                	sbb    %esi,%edi
+  8032a8:	72 d2                	jb     80327c <udivmod+0x39>
+  8032aa:	89 f7                	mov    %esi,%edi
+  8032ac:	89 de                	mov    %ebx,%esi
+  8032ae:	89 e9                	mov    %ebp,%ecx
+  8032b0:	0f a5 f7             	shld   %cl,%esi,%edi
+  8032b3:	d3 e6                	shl    %cl,%esi
+  8032b5:	f6 c1 20             	test   $0x20,%cl
+  8032b8:	74 04                	je     8032be <udivmod+0x7b>
+  8032ba:	89 f7                	mov    %esi,%edi
+  8032bc:	31 f6                	xor    %esi,%esi
+  8032be:	29 f0                	sub    %esi,%eax
+  8032c0:	19 fa                	sbb    %edi,%edx
+  8032c2:	be 01 00 00 00       	mov    $0x1,%esi
+  8032c7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032cc:	0f a5 f7             	shld   %cl,%esi,%edi
+  8032cf:	d3 e6                	shl    %cl,%esi
+  8032d1:	f6 c1 20             	test   $0x20,%cl
+  8032d4:	74 04                	je     8032da <udivmod+0x97>
+  8032d6:	89 f7                	mov    %esi,%edi
+  8032d8:	31 f6                	xor    %esi,%esi
+  8032da:	09 74 24 08          	or     %esi,0x8(%esp)
+  8032de:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  8032e2:	eb 98                	jmp    80327c <udivmod+0x39>
+  8032e4:	89 f0                	mov    %esi,%eax
+  8032e6:	89 fa                	mov    %edi,%edx
+  8032e8:	89 74 24 08          	mov    %esi,0x8(%esp)
+  8032ec:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  8032f0:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  8032f4:	89 01                	mov    %eax,(%ecx)
+  8032f6:	89 51 04             	mov    %edx,0x4(%ecx)
+  8032f9:	8b 44 24 08          	mov    0x8(%esp),%eax
+  8032fd:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803301:	83 c4 14             	add    $0x14,%esp
+  803304:	5b                   	pop    %ebx
+  803305:	5e                   	pop    %esi
+  803306:	5f                   	pop    %edi
+  803307:	5d                   	pop    %ebp
+  803308:	c3                   	ret
+
+00803309 <__udivdi3>:
+  803309:	83 ec 18             	sub    $0x18,%esp
+  80330c:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803310:	50                   	push   %eax
+  803311:	ff 74 24 2c          	push   0x2c(%esp)
+  803315:	ff 74 24 2c          	push   0x2c(%esp)
+  803319:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80331d:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803321:	e8 1d ff ff ff       	call   803243 <udivmod>
+  803326:	83 c4 24             	add    $0x24,%esp
+  803329:	c3                   	ret
+
+0080332a <__umoddi3>:
+  80332a:	83 ec 18             	sub    $0x18,%esp
+  80332d:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803331:	50                   	push   %eax
+  803332:	ff 74 24 2c          	push   0x2c(%esp)
+  803336:	ff 74 24 2c          	push   0x2c(%esp)
+  80333a:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80333e:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803342:	e8 fc fe ff ff       	call   803243 <udivmod>
+  803347:	8b 44 24 18          	mov    0x18(%esp),%eax
+  80334b:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  80334f:	83 c4 24             	add    $0x24,%esp
+  803352:	c3                   	ret
+
+00803353 <__divdi3>:
+  803353:	56                   	push   %esi
+  803354:	53                   	push   %ebx
+  803355:	83 ec 14             	sub    $0x14,%esp
+  803358:	8b 44 24 20          	mov    0x20(%esp),%eax
+  80335c:	8b 54 24 24          	mov    0x24(%esp),%edx
+  803360:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  803364:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  803368:	85 d2                	test   %edx,%edx
+  80336a:	78 18                	js     803384 <__divdi3+0x31>
+  80336c:	85 db                	test   %ebx,%ebx
+  80336e:	78 3e                	js     8033ae <__divdi3+0x5b>
+  803370:	83 ec 04             	sub    $0x4,%esp
+  803373:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803377:	56                   	push   %esi
+  803378:	53                   	push   %ebx
+  803379:	51                   	push   %ecx
+  80337a:	e8 c4 fe ff ff       	call   803243 <udivmod>
+  80337f:	83 c4 10             	add    $0x10,%esp
+  803382:	eb 24                	jmp    8033a8 <__divdi3+0x55>
+  803384:	f7 d8                	neg    %eax
+  803386:	83 d2 00             	adc    $0x0,%edx
+  803389:	f7 da                	neg    %edx
+  80338b:	85 db                	test   %ebx,%ebx
+  80338d:	78 3a                	js     8033c9 <__divdi3+0x76>
+  80338f:	83 ec 04             	sub    $0x4,%esp
+  803392:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803396:	56                   	push   %esi
+  803397:	53                   	push   %ebx
+  803398:	51                   	push   %ecx
+  803399:	e8 a5 fe ff ff       	call   803243 <udivmod>
+  80339e:	83 c4 10             	add    $0x10,%esp
+  8033a1:	f7 d8                	neg    %eax
+  8033a3:	83 d2 00             	adc    $0x0,%edx
+  8033a6:	f7 da                	neg    %edx
+  8033a8:	83 c4 14             	add    $0x14,%esp
+  8033ab:	5b                   	pop    %ebx
+  8033ac:	5e                   	pop    %esi
+  8033ad:	c3                   	ret
+  8033ae:	83 ec 04             	sub    $0x4,%esp
+  8033b1:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8033b5:	56                   	push   %esi
+  8033b6:	f7 d9                	neg    %ecx
+  8033b8:	83 d3 00             	adc    $0x0,%ebx
+  8033bb:	f7 db                	neg    %ebx
+  8033bd:	53                   	push   %ebx
+  8033be:	51                   	push   %ecx
+  8033bf:	e8 7f fe ff ff       	call   803243 <udivmod>
+  8033c4:	83 c4 10             	add    $0x10,%esp
+  8033c7:	eb d8                	jmp    8033a1 <__divdi3+0x4e>
+  8033c9:	83 ec 04             	sub    $0x4,%esp
+  8033cc:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  8033d0:	56                   	push   %esi
+  8033d1:	f7 d9                	neg    %ecx
+  8033d3:	83 d3 00             	adc    $0x0,%ebx
+  8033d6:	f7 db                	neg    %ebx
+  8033d8:	53                   	push   %ebx
+  8033d9:	51                   	push   %ecx
+  8033da:	e8 64 fe ff ff       	call   803243 <udivmod>
+  8033df:	83 c4 10             	add    $0x10,%esp
+  8033e2:	eb c4                	jmp    8033a8 <__divdi3+0x55>
+
+008033e4 <__moddi3>:
+  8033e4:	55                   	push   %ebp
+  8033e5:	57                   	push   %edi
+  8033e6:	56                   	push   %esi
+  8033e7:	53                   	push   %ebx
+  8033e8:	83 ec 24             	sub    $0x24,%esp
+  8033eb:	8b 44 24 38          	mov    0x38(%esp),%eax
+  8033ef:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  8033f3:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  8033f7:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  8033fb:	85 d2                	test   %edx,%edx
+  8033fd:	78 3b                	js     80343a <__moddi3+0x56>
+  8033ff:	83 ec 04             	sub    $0x4,%esp
+  803402:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803406:	56                   	push   %esi
+  803407:	89 ce                	mov    %ecx,%esi
+  803409:	f7 de                	neg    %esi
+  80340b:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80340f:	89 de                	mov    %ebx,%esi
+  803411:	83 d6 00             	adc    $0x0,%esi
+  803414:	f7 de                	neg    %esi
+  803416:	89 74 24 14          	mov    %esi,0x14(%esp)
+  80341a:	8b 74 24 08          	mov    0x8(%esp),%esi
+  80341e:	0f 48 f1             	cmovs  %ecx,%esi
+  803421:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  803426:	53                   	push   %ebx
+  803427:	56                   	push   %esi
+  803428:	e8 16 fe ff ff       	call   803243 <udivmod>
+  80342d:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803431:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803435:	83 c4 10             	add    $0x10,%esp
+  803438:	eb 47                	jmp    803481 <__moddi3+0x9d>
+  80343a:	f7 d8                	neg    %eax
+  80343c:	83 d2 00             	adc    $0x0,%edx
+  80343f:	f7 da                	neg    %edx
+  803441:	83 ec 04             	sub    $0x4,%esp
+  803444:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803448:	56                   	push   %esi
+  803449:	89 cf                	mov    %ecx,%edi
+  80344b:	f7 df                	neg    %edi
+  80344d:	89 de                	mov    %ebx,%esi
+  80344f:	83 d6 00             	adc    $0x0,%esi
+  803452:	f7 de                	neg    %esi
+  803454:	0f 49 cf             	cmovns %edi,%ecx
+  803457:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  80345b:	0f 49 de             	cmovns %esi,%ebx
+  80345e:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  803462:	ff 74 24 0c          	push   0xc(%esp)
+  803466:	ff 74 24 0c          	push   0xc(%esp)
+  80346a:	e8 d4 fd ff ff       	call   803243 <udivmod>
+  80346f:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803473:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803477:	f7 d8                	neg    %eax
+  803479:	83 d2 00             	adc    $0x0,%edx
+  80347c:	f7 da                	neg    %edx
+  80347e:	83 c4 10             	add    $0x10,%esp
+  803481:	83 c4 24             	add    $0x24,%esp
+  803484:	5b                   	pop    %ebx
+  803485:	5e                   	pop    %esi
+  803486:	5f                   	pop    %edi
+  803487:	5d                   	pop    %ebp
+  803488:	c3                   	ret
@@ -0,0 +1,6746 @@
+
+obj/user/testkbd.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 2a 02 00 00       	call   80025b <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	53                   	push   %ebx
+  800037:	83 ec 04             	sub    $0x4,%esp
+  int i, r;
+
+  // Spin for a bit to let the console quiet
+  for (i = 0; i < 10; ++i)
+  80003a:	bb 0b 00 00 00       	mov    $0xb,%ebx
+  80003f:	eb 05                	jmp    800046 <umain+0x13>
+    sys_yield();
+  800041:	e8 08 0e 00 00       	call   800e4e <sys_yield>
+  for (i = 0; i < 10; ++i)
+  800046:	83 eb 01             	sub    $0x1,%ebx
+  800049:	75 f6                	jne    800041 <umain+0xe>
+
+  close(0);
+  80004b:	83 ec 0c             	sub    $0xc,%esp
+  80004e:	6a 00                	push   $0x0
+  800050:	e8 a7 14 00 00       	call   8014fc <close>
+  if ((r = opencons()) < 0)
+  800055:	e8 af 01 00 00       	call   800209 <opencons>
+  80005a:	83 c4 10             	add    $0x10,%esp
+  80005d:	85 c0                	test   %eax,%eax
+  80005f:	78 14                	js     800075 <umain+0x42>
+    panic("opencons: %e", r);
+  if (r != 0)
+  800061:	74 24                	je     800087 <umain+0x54>
+    panic("first opencons used fd %d", r);
+  800063:	50                   	push   %eax
+  800064:	68 1c 31 80 00       	push   $0x80311c
+  800069:	6a 11                	push   $0x11
+  80006b:	68 0d 31 80 00       	push   $0x80310d
+  800070:	e8 53 02 00 00       	call   8002c8 <_panic>
+    panic("opencons: %e", r);
+  800075:	50                   	push   %eax
+  800076:	68 00 31 80 00       	push   $0x803100
+  80007b:	6a 0f                	push   $0xf
+  80007d:	68 0d 31 80 00       	push   $0x80310d
+  800082:	e8 41 02 00 00       	call   8002c8 <_panic>
+  if ((r = dup(0, 1)) < 0)
+  800087:	83 ec 08             	sub    $0x8,%esp
+  80008a:	6a 01                	push   $0x1
+  80008c:	6a 00                	push   $0x0
+  80008e:	e8 bb 14 00 00       	call   80154e <dup>
+  800093:	83 c4 10             	add    $0x10,%esp
+  800096:	85 c0                	test   %eax,%eax
+  800098:	79 25                	jns    8000bf <umain+0x8c>
+    panic("dup: %e", r);
+  80009a:	50                   	push   %eax
+  80009b:	68 36 31 80 00       	push   $0x803136
+  8000a0:	6a 13                	push   $0x13
+  8000a2:	68 0d 31 80 00       	push   $0x80310d
+  8000a7:	e8 1c 02 00 00       	call   8002c8 <_panic>
+  for (;; ) {
+    char *buf;
+
+    buf = readline("Type a line: ");
+    if (buf != NULL)
+      fprintf(1, "%s\n", buf);
+  8000ac:	83 ec 04             	sub    $0x4,%esp
+  8000af:	50                   	push   %eax
+  8000b0:	68 4c 31 80 00       	push   $0x80314c
+  8000b5:	6a 01                	push   $0x1
+  8000b7:	e8 bb 23 00 00       	call   802477 <fprintf>
+  8000bc:	83 c4 10             	add    $0x10,%esp
+    buf = readline("Type a line: ");
+  8000bf:	83 ec 0c             	sub    $0xc,%esp
+  8000c2:	68 3e 31 80 00       	push   $0x80313e
+  8000c7:	e8 8a 08 00 00       	call   800956 <readline>
+    if (buf != NULL)
+  8000cc:	83 c4 10             	add    $0x10,%esp
+  8000cf:	85 c0                	test   %eax,%eax
+  8000d1:	75 d9                	jne    8000ac <umain+0x79>
+    else
+      fprintf(1, "(end of file received)\n");
+  8000d3:	83 ec 08             	sub    $0x8,%esp
+  8000d6:	68 50 31 80 00       	push   $0x803150
+  8000db:	6a 01                	push   $0x1
+  8000dd:	e8 95 23 00 00       	call   802477 <fprintf>
+  8000e2:	83 c4 10             	add    $0x10,%esp
+  8000e5:	eb d8                	jmp    8000bf <umain+0x8c>
+
+008000e7 <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  8000e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ec:	c3                   	ret
+
+008000ed <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  8000ed:	55                   	push   %ebp
+  8000ee:	89 e5                	mov    %esp,%ebp
+  8000f0:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  8000f3:	68 68 31 80 00       	push   $0x803168
+  8000f8:	ff 75 0c             	push   0xc(%ebp)
+  8000fb:	e8 81 09 00 00       	call   800a81 <strcpy>
+  return 0;
+}
+  800100:	b8 00 00 00 00       	mov    $0x0,%eax
+  800105:	c9                   	leave
+  800106:	c3                   	ret
+
+00800107 <devcons_write>:
+{
+  800107:	55                   	push   %ebp
+  800108:	89 e5                	mov    %esp,%ebp
+  80010a:	57                   	push   %edi
+  80010b:	56                   	push   %esi
+  80010c:	53                   	push   %ebx
+  80010d:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  800113:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  800118:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  80011e:	eb 2e                	jmp    80014e <devcons_write+0x47>
+    m = n - tot;
+  800120:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800123:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  800125:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80012a:	39 c3                	cmp    %eax,%ebx
+  80012c:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  80012f:	83 ec 04             	sub    $0x4,%esp
+  800132:	53                   	push   %ebx
+  800133:	89 f0                	mov    %esi,%eax
+  800135:	03 45 0c             	add    0xc(%ebp),%eax
+  800138:	50                   	push   %eax
+  800139:	57                   	push   %edi
+  80013a:	e8 c8 0a 00 00       	call   800c07 <memmove>
+    sys_cputs(buf, m);
+  80013f:	83 c4 08             	add    $0x8,%esp
+  800142:	53                   	push   %ebx
+  800143:	57                   	push   %edi
+  800144:	e8 68 0c 00 00       	call   800db1 <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  800149:	01 de                	add    %ebx,%esi
+  80014b:	83 c4 10             	add    $0x10,%esp
+  80014e:	3b 75 10             	cmp    0x10(%ebp),%esi
+  800151:	72 cd                	jb     800120 <devcons_write+0x19>
+}
+  800153:	89 f0                	mov    %esi,%eax
+  800155:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800158:	5b                   	pop    %ebx
+  800159:	5e                   	pop    %esi
+  80015a:	5f                   	pop    %edi
+  80015b:	5d                   	pop    %ebp
+  80015c:	c3                   	ret
+
+0080015d <devcons_read>:
+{
+  80015d:	55                   	push   %ebp
+  80015e:	89 e5                	mov    %esp,%ebp
+  800160:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  800163:	b8 00 00 00 00       	mov    $0x0,%eax
+  800168:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  80016c:	75 07                	jne    800175 <devcons_read+0x18>
+  80016e:	eb 1f                	jmp    80018f <devcons_read+0x32>
+    sys_yield();
+  800170:	e8 d9 0c 00 00       	call   800e4e <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  800175:	e8 55 0c 00 00       	call   800dcf <sys_cgetc>
+  80017a:	85 c0                	test   %eax,%eax
+  80017c:	74 f2                	je     800170 <devcons_read+0x13>
+  if (c < 0)
+  80017e:	78 0f                	js     80018f <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  800180:	83 f8 04             	cmp    $0x4,%eax
+  800183:	74 0c                	je     800191 <devcons_read+0x34>
+  *(char*)vbuf = c;
+  800185:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800188:	88 02                	mov    %al,(%edx)
+  return 1;
+  80018a:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  80018f:	c9                   	leave
+  800190:	c3                   	ret
+    return 0;
+  800191:	b8 00 00 00 00       	mov    $0x0,%eax
+  800196:	eb f7                	jmp    80018f <devcons_read+0x32>
+
+00800198 <cputchar>:
+{
+  800198:	55                   	push   %ebp
+  800199:	89 e5                	mov    %esp,%ebp
+  80019b:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  80019e:	8b 45 08             	mov    0x8(%ebp),%eax
+  8001a1:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  8001a4:	6a 01                	push   $0x1
+  8001a6:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8001a9:	50                   	push   %eax
+  8001aa:	e8 02 0c 00 00       	call   800db1 <sys_cputs>
+}
+  8001af:	83 c4 10             	add    $0x10,%esp
+  8001b2:	c9                   	leave
+  8001b3:	c3                   	ret
+
+008001b4 <getchar>:
+{
+  8001b4:	55                   	push   %ebp
+  8001b5:	89 e5                	mov    %esp,%ebp
+  8001b7:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  8001ba:	6a 01                	push   $0x1
+  8001bc:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8001bf:	50                   	push   %eax
+  8001c0:	6a 00                	push   $0x0
+  8001c2:	e8 bd 14 00 00       	call   801684 <read>
+  if (r < 0)
+  8001c7:	83 c4 10             	add    $0x10,%esp
+  8001ca:	85 c0                	test   %eax,%eax
+  8001cc:	78 06                	js     8001d4 <getchar+0x20>
+  if (r < 1)
+  8001ce:	74 06                	je     8001d6 <getchar+0x22>
+  return c;
+  8001d0:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  8001d4:	c9                   	leave
+  8001d5:	c3                   	ret
+    return -E_EOF;
+  8001d6:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  8001db:	eb f7                	jmp    8001d4 <getchar+0x20>
+
+008001dd <iscons>:
+{
+  8001dd:	55                   	push   %ebp
+  8001de:	89 e5                	mov    %esp,%ebp
+  8001e0:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8001e3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8001e6:	50                   	push   %eax
+  8001e7:	ff 75 08             	push   0x8(%ebp)
+  8001ea:	e8 ea 11 00 00       	call   8013d9 <fd_lookup>
+  8001ef:	83 c4 10             	add    $0x10,%esp
+  8001f2:	85 c0                	test   %eax,%eax
+  8001f4:	78 11                	js     800207 <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  8001f6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8001f9:	8b 15 00 40 80 00    	mov    0x804000,%edx
+  8001ff:	39 10                	cmp    %edx,(%eax)
+  800201:	0f 94 c0             	sete   %al
+  800204:	0f b6 c0             	movzbl %al,%eax
+}
+  800207:	c9                   	leave
+  800208:	c3                   	ret
+
+00800209 <opencons>:
+{
+  800209:	55                   	push   %ebp
+  80020a:	89 e5                	mov    %esp,%ebp
+  80020c:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  80020f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  800212:	50                   	push   %eax
+  800213:	e8 6b 11 00 00       	call   801383 <fd_alloc>
+  800218:	83 c4 10             	add    $0x10,%esp
+  80021b:	85 c0                	test   %eax,%eax
+  80021d:	78 3a                	js     800259 <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  80021f:	83 ec 04             	sub    $0x4,%esp
+  800222:	68 07 04 00 00       	push   $0x407
+  800227:	ff 75 f4             	push   -0xc(%ebp)
+  80022a:	6a 00                	push   $0x0
+  80022c:	e8 7f 0c 00 00       	call   800eb0 <sys_page_alloc>
+  800231:	83 c4 10             	add    $0x10,%esp
+  800234:	85 c0                	test   %eax,%eax
+  800236:	78 21                	js     800259 <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  800238:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80023b:	8b 15 00 40 80 00    	mov    0x804000,%edx
+  800241:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  800243:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800246:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  80024d:	83 ec 0c             	sub    $0xc,%esp
+  800250:	50                   	push   %eax
+  800251:	e8 09 11 00 00       	call   80135f <fd2num>
+  800256:	83 c4 10             	add    $0x10,%esp
+}
+  800259:	c9                   	leave
+  80025a:	c3                   	ret
+
+0080025b <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  80025b:	55                   	push   %ebp
+  80025c:	89 e5                	mov    %esp,%ebp
+  80025e:	56                   	push   %esi
+  80025f:	53                   	push   %ebx
+  800260:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  800263:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  800266:	c7 05 44 5b 80 00 00 	movl   $0x0,0x805b44
+  80026d:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  800270:	e8 ba 0b 00 00       	call   800e2f <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  800275:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80027a:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  80027d:	c1 e0 04             	shl    $0x4,%eax
+  800280:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  800285:	a3 44 5b 80 00       	mov    %eax,0x805b44
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  80028a:	85 db                	test   %ebx,%ebx
+  80028c:	7e 07                	jle    800295 <libmain+0x3a>
+    binaryname = argv[0];
+  80028e:	8b 06                	mov    (%esi),%eax
+  800290:	a3 1c 40 80 00       	mov    %eax,0x80401c
+
+  // call user main routine
+  umain(argc, argv);
+  800295:	83 ec 08             	sub    $0x8,%esp
+  800298:	56                   	push   %esi
+  800299:	53                   	push   %ebx
+  80029a:	e8 94 fd ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  80029f:	e8 0a 00 00 00       	call   8002ae <exit>
+}
+  8002a4:	83 c4 10             	add    $0x10,%esp
+  8002a7:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8002aa:	5b                   	pop    %ebx
+  8002ab:	5e                   	pop    %esi
+  8002ac:	5d                   	pop    %ebp
+  8002ad:	c3                   	ret
+
+008002ae <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  8002ae:	55                   	push   %ebp
+  8002af:	89 e5                	mov    %esp,%ebp
+  8002b1:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  8002b4:	e8 70 12 00 00       	call   801529 <close_all>
+  sys_env_destroy(0);
+  8002b9:	83 ec 0c             	sub    $0xc,%esp
+  8002bc:	6a 00                	push   $0x0
+  8002be:	e8 2b 0b 00 00       	call   800dee <sys_env_destroy>
+}
+  8002c3:	83 c4 10             	add    $0x10,%esp
+  8002c6:	c9                   	leave
+  8002c7:	c3                   	ret
+
+008002c8 <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  8002c8:	55                   	push   %ebp
+  8002c9:	89 e5                	mov    %esp,%ebp
+  8002cb:	56                   	push   %esi
+  8002cc:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  8002cd:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  8002d0:	8b 35 1c 40 80 00    	mov    0x80401c,%esi
+  8002d6:	e8 54 0b 00 00       	call   800e2f <sys_getenvid>
+  8002db:	83 ec 0c             	sub    $0xc,%esp
+  8002de:	ff 75 0c             	push   0xc(%ebp)
+  8002e1:	ff 75 08             	push   0x8(%ebp)
+  8002e4:	56                   	push   %esi
+  8002e5:	50                   	push   %eax
+  8002e6:	68 80 31 80 00       	push   $0x803180
+  8002eb:	e8 b3 00 00 00       	call   8003a3 <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  8002f0:	83 c4 18             	add    $0x18,%esp
+  8002f3:	53                   	push   %ebx
+  8002f4:	ff 75 10             	push   0x10(%ebp)
+  8002f7:	e8 56 00 00 00       	call   800352 <vcprintf>
+  cprintf("\n");
+  8002fc:	c7 04 24 66 31 80 00 	movl   $0x803166,(%esp)
+  800303:	e8 9b 00 00 00       	call   8003a3 <cprintf>
+  800308:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  80030b:	cc                   	int3
+  while (1)
+  80030c:	eb fd                	jmp    80030b <_panic+0x43>
+
+0080030e <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  80030e:	55                   	push   %ebp
+  80030f:	89 e5                	mov    %esp,%ebp
+  800311:	53                   	push   %ebx
+  800312:	83 ec 04             	sub    $0x4,%esp
+  800315:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  800318:	8b 13                	mov    (%ebx),%edx
+  80031a:	8d 42 01             	lea    0x1(%edx),%eax
+  80031d:	89 03                	mov    %eax,(%ebx)
+  80031f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800322:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  800326:	3d ff 00 00 00       	cmp    $0xff,%eax
+  80032b:	74 09                	je     800336 <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  80032d:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  800331:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800334:	c9                   	leave
+  800335:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  800336:	83 ec 08             	sub    $0x8,%esp
+  800339:	68 ff 00 00 00       	push   $0xff
+  80033e:	8d 43 08             	lea    0x8(%ebx),%eax
+  800341:	50                   	push   %eax
+  800342:	e8 6a 0a 00 00       	call   800db1 <sys_cputs>
+    b->idx = 0;
+  800347:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  80034d:	83 c4 10             	add    $0x10,%esp
+  800350:	eb db                	jmp    80032d <putch+0x1f>
+
+00800352 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  800352:	55                   	push   %ebp
+  800353:	89 e5                	mov    %esp,%ebp
+  800355:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  80035b:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  800362:	00 00 00 
+  b.cnt = 0;
+  800365:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  80036c:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  80036f:	ff 75 0c             	push   0xc(%ebp)
+  800372:	ff 75 08             	push   0x8(%ebp)
+  800375:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  80037b:	50                   	push   %eax
+  80037c:	68 0e 03 80 00       	push   $0x80030e
+  800381:	e8 14 01 00 00       	call   80049a <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  800386:	83 c4 08             	add    $0x8,%esp
+  800389:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  80038f:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  800395:	50                   	push   %eax
+  800396:	e8 16 0a 00 00       	call   800db1 <sys_cputs>
+
+  return b.cnt;
+}
+  80039b:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  8003a1:	c9                   	leave
+  8003a2:	c3                   	ret
+
+008003a3 <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  8003a3:	55                   	push   %ebp
+  8003a4:	89 e5                	mov    %esp,%ebp
+  8003a6:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  8003a9:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  8003ac:	50                   	push   %eax
+  8003ad:	ff 75 08             	push   0x8(%ebp)
+  8003b0:	e8 9d ff ff ff       	call   800352 <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  8003b5:	c9                   	leave
+  8003b6:	c3                   	ret
+
+008003b7 <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  8003b7:	55                   	push   %ebp
+  8003b8:	89 e5                	mov    %esp,%ebp
+  8003ba:	57                   	push   %edi
+  8003bb:	56                   	push   %esi
+  8003bc:	53                   	push   %ebx
+  8003bd:	83 ec 1c             	sub    $0x1c,%esp
+  8003c0:	89 c7                	mov    %eax,%edi
+  8003c2:	89 d6                	mov    %edx,%esi
+  8003c4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8003c7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8003ca:	89 d1                	mov    %edx,%ecx
+  8003cc:	89 c2                	mov    %eax,%edx
+  8003ce:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8003d1:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8003d4:	8b 45 10             	mov    0x10(%ebp),%eax
+  8003d7:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  8003da:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8003dd:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  8003e4:	39 c2                	cmp    %eax,%edx
+  8003e6:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  8003e9:	72 3e                	jb     800429 <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  8003eb:	83 ec 0c             	sub    $0xc,%esp
+  8003ee:	ff 75 18             	push   0x18(%ebp)
+  8003f1:	83 eb 01             	sub    $0x1,%ebx
+  8003f4:	53                   	push   %ebx
+  8003f5:	50                   	push   %eax
+  8003f6:	83 ec 08             	sub    $0x8,%esp
+  8003f9:	ff 75 e4             	push   -0x1c(%ebp)
+  8003fc:	ff 75 e0             	push   -0x20(%ebp)
+  8003ff:	ff 75 dc             	push   -0x24(%ebp)
+  800402:	ff 75 d8             	push   -0x28(%ebp)
+  800405:	e8 6b 2b 00 00       	call   802f75 <__udivdi3>
+  80040a:	83 c4 18             	add    $0x18,%esp
+  80040d:	52                   	push   %edx
+  80040e:	50                   	push   %eax
+  80040f:	89 f2                	mov    %esi,%edx
+  800411:	89 f8                	mov    %edi,%eax
+  800413:	e8 9f ff ff ff       	call   8003b7 <printnum>
+  800418:	83 c4 20             	add    $0x20,%esp
+  80041b:	eb 13                	jmp    800430 <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  80041d:	83 ec 08             	sub    $0x8,%esp
+  800420:	56                   	push   %esi
+  800421:	ff 75 18             	push   0x18(%ebp)
+  800424:	ff d7                	call   *%edi
+  800426:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  800429:	83 eb 01             	sub    $0x1,%ebx
+  80042c:	85 db                	test   %ebx,%ebx
+  80042e:	7f ed                	jg     80041d <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  800430:	83 ec 08             	sub    $0x8,%esp
+  800433:	56                   	push   %esi
+  800434:	83 ec 04             	sub    $0x4,%esp
+  800437:	ff 75 e4             	push   -0x1c(%ebp)
+  80043a:	ff 75 e0             	push   -0x20(%ebp)
+  80043d:	ff 75 dc             	push   -0x24(%ebp)
+  800440:	ff 75 d8             	push   -0x28(%ebp)
+  800443:	e8 4e 2b 00 00       	call   802f96 <__umoddi3>
+  800448:	83 c4 14             	add    $0x14,%esp
+  80044b:	0f be 80 a3 31 80 00 	movsbl 0x8031a3(%eax),%eax
+  800452:	50                   	push   %eax
+  800453:	ff d7                	call   *%edi
+}
+  800455:	83 c4 10             	add    $0x10,%esp
+  800458:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80045b:	5b                   	pop    %ebx
+  80045c:	5e                   	pop    %esi
+  80045d:	5f                   	pop    %edi
+  80045e:	5d                   	pop    %ebp
+  80045f:	c3                   	ret
+
+00800460 <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  800460:	55                   	push   %ebp
+  800461:	89 e5                	mov    %esp,%ebp
+  800463:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  800466:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  80046a:	8b 10                	mov    (%eax),%edx
+  80046c:	3b 50 04             	cmp    0x4(%eax),%edx
+  80046f:	73 0a                	jae    80047b <sprintputch+0x1b>
+    *b->buf++ = ch;
+  800471:	8d 4a 01             	lea    0x1(%edx),%ecx
+  800474:	89 08                	mov    %ecx,(%eax)
+  800476:	8b 45 08             	mov    0x8(%ebp),%eax
+  800479:	88 02                	mov    %al,(%edx)
+}
+  80047b:	5d                   	pop    %ebp
+  80047c:	c3                   	ret
+
+0080047d <printfmt>:
+{
+  80047d:	55                   	push   %ebp
+  80047e:	89 e5                	mov    %esp,%ebp
+  800480:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  800483:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  800486:	50                   	push   %eax
+  800487:	ff 75 10             	push   0x10(%ebp)
+  80048a:	ff 75 0c             	push   0xc(%ebp)
+  80048d:	ff 75 08             	push   0x8(%ebp)
+  800490:	e8 05 00 00 00       	call   80049a <vprintfmt>
+}
+  800495:	83 c4 10             	add    $0x10,%esp
+  800498:	c9                   	leave
+  800499:	c3                   	ret
+
+0080049a <vprintfmt>:
+{
+  80049a:	55                   	push   %ebp
+  80049b:	89 e5                	mov    %esp,%ebp
+  80049d:	57                   	push   %edi
+  80049e:	56                   	push   %esi
+  80049f:	53                   	push   %ebx
+  8004a0:	83 ec 2c             	sub    $0x2c,%esp
+  8004a3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8004a6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  8004a9:	8b 7d 10             	mov    0x10(%ebp),%edi
+  8004ac:	eb 0a                	jmp    8004b8 <vprintfmt+0x1e>
+      putch(ch, putdat);
+  8004ae:	83 ec 08             	sub    $0x8,%esp
+  8004b1:	53                   	push   %ebx
+  8004b2:	50                   	push   %eax
+  8004b3:	ff d6                	call   *%esi
+  8004b5:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  8004b8:	83 c7 01             	add    $0x1,%edi
+  8004bb:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  8004bf:	83 f8 25             	cmp    $0x25,%eax
+  8004c2:	74 0c                	je     8004d0 <vprintfmt+0x36>
+      if (ch == '\0')
+  8004c4:	85 c0                	test   %eax,%eax
+  8004c6:	75 e6                	jne    8004ae <vprintfmt+0x14>
+}
+  8004c8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004cb:	5b                   	pop    %ebx
+  8004cc:	5e                   	pop    %esi
+  8004cd:	5f                   	pop    %edi
+  8004ce:	5d                   	pop    %ebp
+  8004cf:	c3                   	ret
+    padc = ' ';
+  8004d0:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  8004d4:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  8004db:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  8004e2:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  8004e9:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  8004ee:	8d 47 01             	lea    0x1(%edi),%eax
+  8004f1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8004f4:	0f b6 17             	movzbl (%edi),%edx
+  8004f7:	8d 42 dd             	lea    -0x23(%edx),%eax
+  8004fa:	3c 55                	cmp    $0x55,%al
+  8004fc:	0f 87 cf 03 00 00    	ja     8008d1 <vprintfmt+0x437>
+  800502:	0f b6 c0             	movzbl %al,%eax
+  800505:	ff 24 85 e0 32 80 00 	jmp    *0x8032e0(,%eax,4)
+  80050c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  80050f:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  800513:	eb d9                	jmp    8004ee <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  800515:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  800518:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  80051c:	eb d0                	jmp    8004ee <vprintfmt+0x54>
+  80051e:	0f b6 d2             	movzbl %dl,%edx
+  800521:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  800524:	b8 00 00 00 00       	mov    $0x0,%eax
+  800529:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  80052c:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  80052f:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  800533:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  800536:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  800539:	83 f9 09             	cmp    $0x9,%ecx
+  80053c:	77 55                	ja     800593 <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  80053e:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  800541:	eb e9                	jmp    80052c <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  800543:	8b 45 14             	mov    0x14(%ebp),%eax
+  800546:	8b 00                	mov    (%eax),%eax
+  800548:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  80054b:	8b 45 14             	mov    0x14(%ebp),%eax
+  80054e:	8d 40 04             	lea    0x4(%eax),%eax
+  800551:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  800554:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  800557:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80055b:	79 91                	jns    8004ee <vprintfmt+0x54>
+        width = precision, precision = -1;
+  80055d:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  800560:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800563:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  80056a:	eb 82                	jmp    8004ee <vprintfmt+0x54>
+      if (width < 0)
+  80056c:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  80056f:	85 d2                	test   %edx,%edx
+  800571:	b8 00 00 00 00       	mov    $0x0,%eax
+  800576:	0f 49 c2             	cmovns %edx,%eax
+  800579:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  80057c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  80057f:	e9 6a ff ff ff       	jmp    8004ee <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  800584:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  800587:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  80058e:	e9 5b ff ff ff       	jmp    8004ee <vprintfmt+0x54>
+  800593:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  800596:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800599:	eb bc                	jmp    800557 <vprintfmt+0xbd>
+      lflag++;
+  80059b:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  80059e:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  8005a1:	e9 48 ff ff ff       	jmp    8004ee <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  8005a6:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005a9:	8d 78 04             	lea    0x4(%eax),%edi
+  8005ac:	83 ec 08             	sub    $0x8,%esp
+  8005af:	53                   	push   %ebx
+  8005b0:	ff 30                	push   (%eax)
+  8005b2:	ff d6                	call   *%esi
+      break;
+  8005b4:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  8005b7:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  8005ba:	e9 b1 02 00 00       	jmp    800870 <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  8005bf:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c2:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  8005c5:	8b 10                	mov    (%eax),%edx
+  8005c7:	89 d0                	mov    %edx,%eax
+  8005c9:	f7 d8                	neg    %eax
+  8005cb:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  8005ce:	83 f8 10             	cmp    $0x10,%eax
+  8005d1:	7f 23                	jg     8005f6 <vprintfmt+0x15c>
+  8005d3:	8b 14 85 40 34 80 00 	mov    0x803440(,%eax,4),%edx
+  8005da:	85 d2                	test   %edx,%edx
+  8005dc:	74 18                	je     8005f6 <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  8005de:	52                   	push   %edx
+  8005df:	68 9a 35 80 00       	push   $0x80359a
+  8005e4:	53                   	push   %ebx
+  8005e5:	56                   	push   %esi
+  8005e6:	e8 92 fe ff ff       	call   80047d <printfmt>
+  8005eb:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  8005ee:	89 7d 14             	mov    %edi,0x14(%ebp)
+  8005f1:	e9 7a 02 00 00       	jmp    800870 <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  8005f6:	50                   	push   %eax
+  8005f7:	68 bb 31 80 00       	push   $0x8031bb
+  8005fc:	53                   	push   %ebx
+  8005fd:	56                   	push   %esi
+  8005fe:	e8 7a fe ff ff       	call   80047d <printfmt>
+  800603:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  800606:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  800609:	e9 62 02 00 00       	jmp    800870 <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  80060e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800611:	83 c0 04             	add    $0x4,%eax
+  800614:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  800617:	8b 45 14             	mov    0x14(%ebp),%eax
+  80061a:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  80061c:	85 c9                	test   %ecx,%ecx
+  80061e:	b8 b4 31 80 00       	mov    $0x8031b4,%eax
+  800623:	0f 45 c1             	cmovne %ecx,%eax
+  800626:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  800629:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  80062d:	7e 06                	jle    800635 <vprintfmt+0x19b>
+  80062f:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  800633:	75 0b                	jne    800640 <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800635:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  800638:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80063b:	89 75 08             	mov    %esi,0x8(%ebp)
+  80063e:	eb 5c                	jmp    80069c <vprintfmt+0x202>
+  800640:	83 ec 08             	sub    $0x8,%esp
+  800643:	ff 75 d0             	push   -0x30(%ebp)
+  800646:	ff 75 cc             	push   -0x34(%ebp)
+  800649:	e8 10 04 00 00       	call   800a5e <strnlen>
+  80064e:	89 c2                	mov    %eax,%edx
+  800650:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  800653:	29 d0                	sub    %edx,%eax
+  800655:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  800658:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  80065c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80065f:	89 75 08             	mov    %esi,0x8(%ebp)
+  800662:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  800664:	eb 0e                	jmp    800674 <vprintfmt+0x1da>
+          putch(padc, putdat);
+  800666:	83 ec 08             	sub    $0x8,%esp
+  800669:	53                   	push   %ebx
+  80066a:	57                   	push   %edi
+  80066b:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  80066e:	83 ee 01             	sub    $0x1,%esi
+  800671:	83 c4 10             	add    $0x10,%esp
+  800674:	85 f6                	test   %esi,%esi
+  800676:	7f ee                	jg     800666 <vprintfmt+0x1cc>
+  800678:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  80067b:	8b 75 08             	mov    0x8(%ebp),%esi
+  80067e:	85 c0                	test   %eax,%eax
+  800680:	ba 00 00 00 00       	mov    $0x0,%edx
+  800685:	0f 49 d0             	cmovns %eax,%edx
+  800688:	29 d0                	sub    %edx,%eax
+  80068a:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  80068d:	eb a6                	jmp    800635 <vprintfmt+0x19b>
+          putch(ch, putdat);
+  80068f:	83 ec 08             	sub    $0x8,%esp
+  800692:	53                   	push   %ebx
+  800693:	52                   	push   %edx
+  800694:	ff 55 08             	call   *0x8(%ebp)
+  800697:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  80069a:	89 f1                	mov    %esi,%ecx
+  80069c:	8d 71 01             	lea    0x1(%ecx),%esi
+  80069f:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  8006a3:	0f be d0             	movsbl %al,%edx
+  8006a6:	85 d2                	test   %edx,%edx
+  8006a8:	74 28                	je     8006d2 <vprintfmt+0x238>
+  8006aa:	85 ff                	test   %edi,%edi
+  8006ac:	78 05                	js     8006b3 <vprintfmt+0x219>
+  8006ae:	83 ef 01             	sub    $0x1,%edi
+  8006b1:	78 30                	js     8006e3 <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  8006b3:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  8006b7:	74 d6                	je     80068f <vprintfmt+0x1f5>
+  8006b9:	0f be c0             	movsbl %al,%eax
+  8006bc:	83 e8 20             	sub    $0x20,%eax
+  8006bf:	83 f8 5e             	cmp    $0x5e,%eax
+  8006c2:	76 cb                	jbe    80068f <vprintfmt+0x1f5>
+          putch('?', putdat);
+  8006c4:	83 ec 08             	sub    $0x8,%esp
+  8006c7:	53                   	push   %ebx
+  8006c8:	6a 3f                	push   $0x3f
+  8006ca:	ff 55 08             	call   *0x8(%ebp)
+  8006cd:	83 c4 10             	add    $0x10,%esp
+  8006d0:	eb c8                	jmp    80069a <vprintfmt+0x200>
+  8006d2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006d5:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  8006d8:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8006db:	01 d0                	add    %edx,%eax
+  8006dd:	29 c8                	sub    %ecx,%eax
+  8006df:	89 c7                	mov    %eax,%edi
+  8006e1:	eb 13                	jmp    8006f6 <vprintfmt+0x25c>
+  8006e3:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006e6:	eb ed                	jmp    8006d5 <vprintfmt+0x23b>
+        putch(' ', putdat);
+  8006e8:	83 ec 08             	sub    $0x8,%esp
+  8006eb:	53                   	push   %ebx
+  8006ec:	6a 20                	push   $0x20
+  8006ee:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  8006f0:	83 ef 01             	sub    $0x1,%edi
+  8006f3:	83 c4 10             	add    $0x10,%esp
+  8006f6:	85 ff                	test   %edi,%edi
+  8006f8:	7f ee                	jg     8006e8 <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  8006fa:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  8006fd:	89 45 14             	mov    %eax,0x14(%ebp)
+  800700:	e9 6b 01 00 00       	jmp    800870 <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  800705:	83 f9 01             	cmp    $0x1,%ecx
+  800708:	7f 1f                	jg     800729 <vprintfmt+0x28f>
+  else if (lflag)
+  80070a:	85 c9                	test   %ecx,%ecx
+  80070c:	74 67                	je     800775 <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  80070e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800711:	8b 00                	mov    (%eax),%eax
+  800713:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800716:	89 c1                	mov    %eax,%ecx
+  800718:	c1 f9 1f             	sar    $0x1f,%ecx
+  80071b:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80071e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800721:	8d 40 04             	lea    0x4(%eax),%eax
+  800724:	89 45 14             	mov    %eax,0x14(%ebp)
+  800727:	eb 17                	jmp    800740 <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  800729:	8b 45 14             	mov    0x14(%ebp),%eax
+  80072c:	8b 50 04             	mov    0x4(%eax),%edx
+  80072f:	8b 00                	mov    (%eax),%eax
+  800731:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800734:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  800737:	8b 45 14             	mov    0x14(%ebp),%eax
+  80073a:	8d 40 08             	lea    0x8(%eax),%eax
+  80073d:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  800740:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  800743:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  800746:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  80074b:	85 c9                	test   %ecx,%ecx
+  80074d:	0f 89 03 01 00 00    	jns    800856 <vprintfmt+0x3bc>
+        putch('-', putdat);
+  800753:	83 ec 08             	sub    $0x8,%esp
+  800756:	53                   	push   %ebx
+  800757:	6a 2d                	push   $0x2d
+  800759:	ff d6                	call   *%esi
+        num = -(long long)num;
+  80075b:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80075e:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  800761:	f7 da                	neg    %edx
+  800763:	83 d1 00             	adc    $0x0,%ecx
+  800766:	f7 d9                	neg    %ecx
+  800768:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  80076b:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800770:	e9 e1 00 00 00       	jmp    800856 <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  800775:	8b 45 14             	mov    0x14(%ebp),%eax
+  800778:	8b 00                	mov    (%eax),%eax
+  80077a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80077d:	89 c1                	mov    %eax,%ecx
+  80077f:	c1 f9 1f             	sar    $0x1f,%ecx
+  800782:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800785:	8b 45 14             	mov    0x14(%ebp),%eax
+  800788:	8d 40 04             	lea    0x4(%eax),%eax
+  80078b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80078e:	eb b0                	jmp    800740 <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  800790:	83 f9 01             	cmp    $0x1,%ecx
+  800793:	7f 1e                	jg     8007b3 <vprintfmt+0x319>
+  else if (lflag)
+  800795:	85 c9                	test   %ecx,%ecx
+  800797:	74 32                	je     8007cb <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  800799:	8b 45 14             	mov    0x14(%ebp),%eax
+  80079c:	8b 10                	mov    (%eax),%edx
+  80079e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007a3:	8d 40 04             	lea    0x4(%eax),%eax
+  8007a6:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  8007a9:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  8007ae:	e9 a3 00 00 00       	jmp    800856 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  8007b3:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b6:	8b 10                	mov    (%eax),%edx
+  8007b8:	8b 48 04             	mov    0x4(%eax),%ecx
+  8007bb:	8d 40 08             	lea    0x8(%eax),%eax
+  8007be:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  8007c1:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  8007c6:	e9 8b 00 00 00       	jmp    800856 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8007cb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ce:	8b 10                	mov    (%eax),%edx
+  8007d0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007d5:	8d 40 04             	lea    0x4(%eax),%eax
+  8007d8:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  8007db:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  8007e0:	eb 74                	jmp    800856 <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  8007e2:	83 f9 01             	cmp    $0x1,%ecx
+  8007e5:	7f 1b                	jg     800802 <vprintfmt+0x368>
+  else if (lflag)
+  8007e7:	85 c9                	test   %ecx,%ecx
+  8007e9:	74 2c                	je     800817 <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  8007eb:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ee:	8b 10                	mov    (%eax),%edx
+  8007f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8007f5:	8d 40 04             	lea    0x4(%eax),%eax
+  8007f8:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  8007fb:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  800800:	eb 54                	jmp    800856 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800802:	8b 45 14             	mov    0x14(%ebp),%eax
+  800805:	8b 10                	mov    (%eax),%edx
+  800807:	8b 48 04             	mov    0x4(%eax),%ecx
+  80080a:	8d 40 08             	lea    0x8(%eax),%eax
+  80080d:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800810:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  800815:	eb 3f                	jmp    800856 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800817:	8b 45 14             	mov    0x14(%ebp),%eax
+  80081a:	8b 10                	mov    (%eax),%edx
+  80081c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800821:	8d 40 04             	lea    0x4(%eax),%eax
+  800824:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800827:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  80082c:	eb 28                	jmp    800856 <vprintfmt+0x3bc>
+      putch('0', putdat);
+  80082e:	83 ec 08             	sub    $0x8,%esp
+  800831:	53                   	push   %ebx
+  800832:	6a 30                	push   $0x30
+  800834:	ff d6                	call   *%esi
+      putch('x', putdat);
+  800836:	83 c4 08             	add    $0x8,%esp
+  800839:	53                   	push   %ebx
+  80083a:	6a 78                	push   $0x78
+  80083c:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  80083e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800841:	8b 10                	mov    (%eax),%edx
+  800843:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  800848:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  80084b:	8d 40 04             	lea    0x4(%eax),%eax
+  80084e:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800851:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  800856:	83 ec 0c             	sub    $0xc,%esp
+  800859:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  80085d:	50                   	push   %eax
+  80085e:	ff 75 e0             	push   -0x20(%ebp)
+  800861:	57                   	push   %edi
+  800862:	51                   	push   %ecx
+  800863:	52                   	push   %edx
+  800864:	89 da                	mov    %ebx,%edx
+  800866:	89 f0                	mov    %esi,%eax
+  800868:	e8 4a fb ff ff       	call   8003b7 <printnum>
+      break;
+  80086d:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  800870:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  800873:	e9 40 fc ff ff       	jmp    8004b8 <vprintfmt+0x1e>
+  if (lflag >= 2)
+  800878:	83 f9 01             	cmp    $0x1,%ecx
+  80087b:	7f 1b                	jg     800898 <vprintfmt+0x3fe>
+  else if (lflag)
+  80087d:	85 c9                	test   %ecx,%ecx
+  80087f:	74 2c                	je     8008ad <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  800881:	8b 45 14             	mov    0x14(%ebp),%eax
+  800884:	8b 10                	mov    (%eax),%edx
+  800886:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80088b:	8d 40 04             	lea    0x4(%eax),%eax
+  80088e:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800891:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  800896:	eb be                	jmp    800856 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800898:	8b 45 14             	mov    0x14(%ebp),%eax
+  80089b:	8b 10                	mov    (%eax),%edx
+  80089d:	8b 48 04             	mov    0x4(%eax),%ecx
+  8008a0:	8d 40 08             	lea    0x8(%eax),%eax
+  8008a3:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8008a6:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  8008ab:	eb a9                	jmp    800856 <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  8008ad:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008b0:	8b 10                	mov    (%eax),%edx
+  8008b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8008b7:	8d 40 04             	lea    0x4(%eax),%eax
+  8008ba:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8008bd:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  8008c2:	eb 92                	jmp    800856 <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  8008c4:	83 ec 08             	sub    $0x8,%esp
+  8008c7:	53                   	push   %ebx
+  8008c8:	6a 25                	push   $0x25
+  8008ca:	ff d6                	call   *%esi
+      break;
+  8008cc:	83 c4 10             	add    $0x10,%esp
+  8008cf:	eb 9f                	jmp    800870 <vprintfmt+0x3d6>
+      putch('%', putdat);
+  8008d1:	83 ec 08             	sub    $0x8,%esp
+  8008d4:	53                   	push   %ebx
+  8008d5:	6a 25                	push   $0x25
+  8008d7:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  8008d9:	83 c4 10             	add    $0x10,%esp
+  8008dc:	89 f8                	mov    %edi,%eax
+  8008de:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  8008e2:	74 05                	je     8008e9 <vprintfmt+0x44f>
+  8008e4:	83 e8 01             	sub    $0x1,%eax
+  8008e7:	eb f5                	jmp    8008de <vprintfmt+0x444>
+  8008e9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8008ec:	eb 82                	jmp    800870 <vprintfmt+0x3d6>
+
+008008ee <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  8008ee:	55                   	push   %ebp
+  8008ef:	89 e5                	mov    %esp,%ebp
+  8008f1:	83 ec 18             	sub    $0x18,%esp
+  8008f4:	8b 45 08             	mov    0x8(%ebp),%eax
+  8008f7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  8008fa:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  8008fd:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800901:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  800904:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  80090b:	85 c0                	test   %eax,%eax
+  80090d:	74 26                	je     800935 <vsnprintf+0x47>
+  80090f:	85 d2                	test   %edx,%edx
+  800911:	7e 22                	jle    800935 <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  800913:	ff 75 14             	push   0x14(%ebp)
+  800916:	ff 75 10             	push   0x10(%ebp)
+  800919:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  80091c:	50                   	push   %eax
+  80091d:	68 60 04 80 00       	push   $0x800460
+  800922:	e8 73 fb ff ff       	call   80049a <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  800927:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80092a:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  80092d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  800930:	83 c4 10             	add    $0x10,%esp
+}
+  800933:	c9                   	leave
+  800934:	c3                   	ret
+    return -E_INVAL;
+  800935:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80093a:	eb f7                	jmp    800933 <vsnprintf+0x45>
+
+0080093c <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  80093c:	55                   	push   %ebp
+  80093d:	89 e5                	mov    %esp,%ebp
+  80093f:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  800942:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  800945:	50                   	push   %eax
+  800946:	ff 75 10             	push   0x10(%ebp)
+  800949:	ff 75 0c             	push   0xc(%ebp)
+  80094c:	ff 75 08             	push   0x8(%ebp)
+  80094f:	e8 9a ff ff ff       	call   8008ee <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  800954:	c9                   	leave
+  800955:	c3                   	ret
+
+00800956 <readline>:
+#define BUFLEN 1024
+static char buf[BUFLEN];
+
+char *
+readline(const char *prompt)
+{
+  800956:	55                   	push   %ebp
+  800957:	89 e5                	mov    %esp,%ebp
+  800959:	57                   	push   %edi
+  80095a:	56                   	push   %esi
+  80095b:	53                   	push   %ebx
+  80095c:	83 ec 0c             	sub    $0xc,%esp
+  80095f:	8b 45 08             	mov    0x8(%ebp),%eax
+
+#if JOS_KERNEL
+  if (prompt != NULL)
+    cprintf("%s", prompt);
+#else
+  if (prompt != NULL)
+  800962:	85 c0                	test   %eax,%eax
+  800964:	74 13                	je     800979 <readline+0x23>
+    fprintf(1, "%s", prompt);
+  800966:	83 ec 04             	sub    $0x4,%esp
+  800969:	50                   	push   %eax
+  80096a:	68 9a 35 80 00       	push   $0x80359a
+  80096f:	6a 01                	push   $0x1
+  800971:	e8 01 1b 00 00       	call   802477 <fprintf>
+  800976:	83 c4 10             	add    $0x10,%esp
+#endif
+
+  i = 0;
+  echoing = iscons(0);
+  800979:	83 ec 0c             	sub    $0xc,%esp
+  80097c:	6a 00                	push   $0x0
+  80097e:	e8 5a f8 ff ff       	call   8001dd <iscons>
+  800983:	89 c7                	mov    %eax,%edi
+  800985:	83 c4 10             	add    $0x10,%esp
+  i = 0;
+  800988:	be 00 00 00 00       	mov    $0x0,%esi
+  80098d:	eb 4b                	jmp    8009da <readline+0x84>
+  while (1) {
+    c = getchar();
+    if (c < 0) {
+      if (c != -E_EOF)
+        cprintf("read error: %e\n", c);
+      return NULL;
+  80098f:	b8 00 00 00 00       	mov    $0x0,%eax
+      if (c != -E_EOF)
+  800994:	83 fb f8             	cmp    $0xfffffff8,%ebx
+  800997:	75 08                	jne    8009a1 <readline+0x4b>
+        cputchar('\n');
+      buf[i] = 0;
+      return buf;
+    }
+  }
+}
+  800999:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80099c:	5b                   	pop    %ebx
+  80099d:	5e                   	pop    %esi
+  80099e:	5f                   	pop    %edi
+  80099f:	5d                   	pop    %ebp
+  8009a0:	c3                   	ret
+        cprintf("read error: %e\n", c);
+  8009a1:	83 ec 08             	sub    $0x8,%esp
+  8009a4:	53                   	push   %ebx
+  8009a5:	68 a3 34 80 00       	push   $0x8034a3
+  8009aa:	e8 f4 f9 ff ff       	call   8003a3 <cprintf>
+  8009af:	83 c4 10             	add    $0x10,%esp
+      return NULL;
+  8009b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009b7:	eb e0                	jmp    800999 <readline+0x43>
+      if (echoing)
+  8009b9:	85 ff                	test   %edi,%edi
+  8009bb:	75 05                	jne    8009c2 <readline+0x6c>
+      i--;
+  8009bd:	83 ee 01             	sub    $0x1,%esi
+  8009c0:	eb 18                	jmp    8009da <readline+0x84>
+        cputchar('\b');
+  8009c2:	83 ec 0c             	sub    $0xc,%esp
+  8009c5:	6a 08                	push   $0x8
+  8009c7:	e8 cc f7 ff ff       	call   800198 <cputchar>
+  8009cc:	83 c4 10             	add    $0x10,%esp
+  8009cf:	eb ec                	jmp    8009bd <readline+0x67>
+      buf[i++] = c;
+  8009d1:	88 9e 00 50 80 00    	mov    %bl,0x805000(%esi)
+  8009d7:	8d 76 01             	lea    0x1(%esi),%esi
+    c = getchar();
+  8009da:	e8 d5 f7 ff ff       	call   8001b4 <getchar>
+  8009df:	89 c3                	mov    %eax,%ebx
+    if (c < 0) {
+  8009e1:	85 c0                	test   %eax,%eax
+  8009e3:	78 aa                	js     80098f <readline+0x39>
+    } else if ((c == '\b' || c == '\x7f') && i > 0) {
+  8009e5:	83 f8 08             	cmp    $0x8,%eax
+  8009e8:	0f 94 c0             	sete   %al
+  8009eb:	83 fb 7f             	cmp    $0x7f,%ebx
+  8009ee:	0f 94 c2             	sete   %dl
+  8009f1:	08 d0                	or     %dl,%al
+  8009f3:	74 04                	je     8009f9 <readline+0xa3>
+  8009f5:	85 f6                	test   %esi,%esi
+  8009f7:	7f c0                	jg     8009b9 <readline+0x63>
+    } else if (c >= ' ' && i < BUFLEN-1) {
+  8009f9:	83 fb 1f             	cmp    $0x1f,%ebx
+  8009fc:	7e 1a                	jle    800a18 <readline+0xc2>
+  8009fe:	81 fe fe 03 00 00    	cmp    $0x3fe,%esi
+  800a04:	7f 12                	jg     800a18 <readline+0xc2>
+      if (echoing)
+  800a06:	85 ff                	test   %edi,%edi
+  800a08:	74 c7                	je     8009d1 <readline+0x7b>
+        cputchar(c);
+  800a0a:	83 ec 0c             	sub    $0xc,%esp
+  800a0d:	53                   	push   %ebx
+  800a0e:	e8 85 f7 ff ff       	call   800198 <cputchar>
+  800a13:	83 c4 10             	add    $0x10,%esp
+  800a16:	eb b9                	jmp    8009d1 <readline+0x7b>
+    } else if (c == '\n' || c == '\r') {
+  800a18:	83 fb 0a             	cmp    $0xa,%ebx
+  800a1b:	74 05                	je     800a22 <readline+0xcc>
+  800a1d:	83 fb 0d             	cmp    $0xd,%ebx
+  800a20:	75 b8                	jne    8009da <readline+0x84>
+      if (echoing)
+  800a22:	85 ff                	test   %edi,%edi
+  800a24:	75 11                	jne    800a37 <readline+0xe1>
+      buf[i] = 0;
+  800a26:	c6 86 00 50 80 00 00 	movb   $0x0,0x805000(%esi)
+      return buf;
+  800a2d:	b8 00 50 80 00       	mov    $0x805000,%eax
+  800a32:	e9 62 ff ff ff       	jmp    800999 <readline+0x43>
+        cputchar('\n');
+  800a37:	83 ec 0c             	sub    $0xc,%esp
+  800a3a:	6a 0a                	push   $0xa
+  800a3c:	e8 57 f7 ff ff       	call   800198 <cputchar>
+  800a41:	83 c4 10             	add    $0x10,%esp
+  800a44:	eb e0                	jmp    800a26 <readline+0xd0>
+
+00800a46 <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  800a46:	55                   	push   %ebp
+  800a47:	89 e5                	mov    %esp,%ebp
+  800a49:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  800a4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a51:	eb 03                	jmp    800a56 <strlen+0x10>
+    n++;
+  800a53:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  800a56:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  800a5a:	75 f7                	jne    800a53 <strlen+0xd>
+  return n;
+}
+  800a5c:	5d                   	pop    %ebp
+  800a5d:	c3                   	ret
+
+00800a5e <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  800a5e:	55                   	push   %ebp
+  800a5f:	89 e5                	mov    %esp,%ebp
+  800a61:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a64:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800a67:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a6c:	eb 03                	jmp    800a71 <strnlen+0x13>
+    n++;
+  800a6e:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  800a71:	39 d0                	cmp    %edx,%eax
+  800a73:	74 08                	je     800a7d <strnlen+0x1f>
+  800a75:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800a79:	75 f3                	jne    800a6e <strnlen+0x10>
+  800a7b:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  800a7d:	89 d0                	mov    %edx,%eax
+  800a7f:	5d                   	pop    %ebp
+  800a80:	c3                   	ret
+
+00800a81 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800a81:	55                   	push   %ebp
+  800a82:	89 e5                	mov    %esp,%ebp
+  800a84:	53                   	push   %ebx
+  800a85:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a88:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  800a8b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a90:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800a94:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800a97:	83 c0 01             	add    $0x1,%eax
+  800a9a:	84 d2                	test   %dl,%dl
+  800a9c:	75 f2                	jne    800a90 <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  800a9e:	89 c8                	mov    %ecx,%eax
+  800aa0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800aa3:	c9                   	leave
+  800aa4:	c3                   	ret
+
+00800aa5 <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800aa5:	55                   	push   %ebp
+  800aa6:	89 e5                	mov    %esp,%ebp
+  800aa8:	53                   	push   %ebx
+  800aa9:	83 ec 10             	sub    $0x10,%esp
+  800aac:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  800aaf:	53                   	push   %ebx
+  800ab0:	e8 91 ff ff ff       	call   800a46 <strlen>
+  800ab5:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  800ab8:	ff 75 0c             	push   0xc(%ebp)
+  800abb:	01 d8                	add    %ebx,%eax
+  800abd:	50                   	push   %eax
+  800abe:	e8 be ff ff ff       	call   800a81 <strcpy>
+  return dst;
+}
+  800ac3:	89 d8                	mov    %ebx,%eax
+  800ac5:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800ac8:	c9                   	leave
+  800ac9:	c3                   	ret
+
+00800aca <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  800aca:	55                   	push   %ebp
+  800acb:	89 e5                	mov    %esp,%ebp
+  800acd:	56                   	push   %esi
+  800ace:	53                   	push   %ebx
+  800acf:	8b 75 08             	mov    0x8(%ebp),%esi
+  800ad2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  800ad5:	89 f3                	mov    %esi,%ebx
+  800ad7:	03 5d 10             	add    0x10(%ebp),%ebx
+  800ada:	89 f0                	mov    %esi,%eax
+  800adc:	eb 0f                	jmp    800aed <strncpy+0x23>
+    *dst++ = *src;
+  800ade:	83 c0 01             	add    $0x1,%eax
+  800ae1:	0f b6 0a             	movzbl (%edx),%ecx
+  800ae4:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  800ae7:	80 f9 01             	cmp    $0x1,%cl
+  800aea:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  800aed:	39 d8                	cmp    %ebx,%eax
+  800aef:	75 ed                	jne    800ade <strncpy+0x14>
+  }
+  return ret;
+}
+  800af1:	89 f0                	mov    %esi,%eax
+  800af3:	5b                   	pop    %ebx
+  800af4:	5e                   	pop    %esi
+  800af5:	5d                   	pop    %ebp
+  800af6:	c3                   	ret
+
+00800af7 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800af7:	55                   	push   %ebp
+  800af8:	89 e5                	mov    %esp,%ebp
+  800afa:	56                   	push   %esi
+  800afb:	53                   	push   %ebx
+  800afc:	8b 75 08             	mov    0x8(%ebp),%esi
+  800aff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b02:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  800b05:	89 f0                	mov    %esi,%eax
+  800b07:	85 d2                	test   %edx,%edx
+  800b09:	74 21                	je     800b2c <strlcpy+0x35>
+  800b0b:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800b0f:	89 f2                	mov    %esi,%edx
+  800b11:	eb 09                	jmp    800b1c <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  800b13:	83 c1 01             	add    $0x1,%ecx
+  800b16:	83 c2 01             	add    $0x1,%edx
+  800b19:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  800b1c:	39 c2                	cmp    %eax,%edx
+  800b1e:	74 09                	je     800b29 <strlcpy+0x32>
+  800b20:	0f b6 19             	movzbl (%ecx),%ebx
+  800b23:	84 db                	test   %bl,%bl
+  800b25:	75 ec                	jne    800b13 <strlcpy+0x1c>
+  800b27:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  800b29:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  800b2c:	29 f0                	sub    %esi,%eax
+}
+  800b2e:	5b                   	pop    %ebx
+  800b2f:	5e                   	pop    %esi
+  800b30:	5d                   	pop    %ebp
+  800b31:	c3                   	ret
+
+00800b32 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800b32:	55                   	push   %ebp
+  800b33:	89 e5                	mov    %esp,%ebp
+  800b35:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800b38:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  800b3b:	eb 06                	jmp    800b43 <strcmp+0x11>
+    p++, q++;
+  800b3d:	83 c1 01             	add    $0x1,%ecx
+  800b40:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  800b43:	0f b6 01             	movzbl (%ecx),%eax
+  800b46:	84 c0                	test   %al,%al
+  800b48:	74 04                	je     800b4e <strcmp+0x1c>
+  800b4a:	3a 02                	cmp    (%edx),%al
+  800b4c:	74 ef                	je     800b3d <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  800b4e:	0f b6 c0             	movzbl %al,%eax
+  800b51:	0f b6 12             	movzbl (%edx),%edx
+  800b54:	29 d0                	sub    %edx,%eax
+}
+  800b56:	5d                   	pop    %ebp
+  800b57:	c3                   	ret
+
+00800b58 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800b58:	55                   	push   %ebp
+  800b59:	89 e5                	mov    %esp,%ebp
+  800b5b:	53                   	push   %ebx
+  800b5c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b5f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800b62:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  800b65:	eb 09                	jmp    800b70 <strncmp+0x18>
+    n--, p++, q++;
+  800b67:	83 ea 01             	sub    $0x1,%edx
+  800b6a:	83 c0 01             	add    $0x1,%eax
+  800b6d:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  800b70:	85 d2                	test   %edx,%edx
+  800b72:	74 18                	je     800b8c <strncmp+0x34>
+  800b74:	0f b6 18             	movzbl (%eax),%ebx
+  800b77:	84 db                	test   %bl,%bl
+  800b79:	74 04                	je     800b7f <strncmp+0x27>
+  800b7b:	3a 19                	cmp    (%ecx),%bl
+  800b7d:	74 e8                	je     800b67 <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800b7f:	0f b6 00             	movzbl (%eax),%eax
+  800b82:	0f b6 11             	movzbl (%ecx),%edx
+  800b85:	29 d0                	sub    %edx,%eax
+}
+  800b87:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b8a:	c9                   	leave
+  800b8b:	c3                   	ret
+    return 0;
+  800b8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b91:	eb f4                	jmp    800b87 <strncmp+0x2f>
+
+00800b93 <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800b93:	55                   	push   %ebp
+  800b94:	89 e5                	mov    %esp,%ebp
+  800b96:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b99:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800b9d:	eb 03                	jmp    800ba2 <strchr+0xf>
+  800b9f:	83 c0 01             	add    $0x1,%eax
+  800ba2:	0f b6 10             	movzbl (%eax),%edx
+  800ba5:	84 d2                	test   %dl,%dl
+  800ba7:	74 06                	je     800baf <strchr+0x1c>
+    if (*s == c)
+  800ba9:	38 ca                	cmp    %cl,%dl
+  800bab:	75 f2                	jne    800b9f <strchr+0xc>
+  800bad:	eb 05                	jmp    800bb4 <strchr+0x21>
+      return (char*)s;
+  return 0;
+  800baf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800bb4:	5d                   	pop    %ebp
+  800bb5:	c3                   	ret
+
+00800bb6 <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800bb6:	55                   	push   %ebp
+  800bb7:	89 e5                	mov    %esp,%ebp
+  800bb9:	8b 45 08             	mov    0x8(%ebp),%eax
+  800bbc:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800bc0:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  800bc3:	38 ca                	cmp    %cl,%dl
+  800bc5:	74 09                	je     800bd0 <strfind+0x1a>
+  800bc7:	84 d2                	test   %dl,%dl
+  800bc9:	74 05                	je     800bd0 <strfind+0x1a>
+  for (; *s; s++)
+  800bcb:	83 c0 01             	add    $0x1,%eax
+  800bce:	eb f0                	jmp    800bc0 <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  800bd0:	5d                   	pop    %ebp
+  800bd1:	c3                   	ret
+
+00800bd2 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800bd2:	55                   	push   %ebp
+  800bd3:	89 e5                	mov    %esp,%ebp
+  800bd5:	57                   	push   %edi
+  800bd6:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800bd9:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  800bdc:	85 c9                	test   %ecx,%ecx
+  800bde:	74 20                	je     800c00 <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  800be0:	89 f8                	mov    %edi,%eax
+  800be2:	09 c8                	or     %ecx,%eax
+  800be4:	a8 03                	test   $0x3,%al
+  800be6:	75 12                	jne    800bfa <memset+0x28>
+    c &= 0xFF;
+  800be8:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800bec:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  800bf2:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  800bf5:	fc                   	cld
+  800bf6:	f3 ab                	rep stos %eax,%es:(%edi)
+  800bf8:	eb 06                	jmp    800c00 <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  800bfa:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800bfd:	fc                   	cld
+  800bfe:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  800c00:	89 f8                	mov    %edi,%eax
+  800c02:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800c05:	c9                   	leave
+  800c06:	c3                   	ret
+
+00800c07 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800c07:	55                   	push   %ebp
+  800c08:	89 e5                	mov    %esp,%ebp
+  800c0a:	57                   	push   %edi
+  800c0b:	56                   	push   %esi
+  800c0c:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c0f:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800c12:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  800c15:	39 c6                	cmp    %eax,%esi
+  800c17:	73 32                	jae    800c4b <memmove+0x44>
+  800c19:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800c1c:	39 d0                	cmp    %edx,%eax
+  800c1e:	73 2b                	jae    800c4b <memmove+0x44>
+    s += n;
+    d += n;
+  800c20:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c23:	89 d6                	mov    %edx,%esi
+  800c25:	09 fe                	or     %edi,%esi
+  800c27:	09 ce                	or     %ecx,%esi
+  800c29:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800c2f:	75 0e                	jne    800c3f <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800c31:	83 ef 04             	sub    $0x4,%edi
+  800c34:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800c37:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  800c3a:	fd                   	std
+  800c3b:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c3d:	eb 09                	jmp    800c48 <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800c3f:	83 ef 01             	sub    $0x1,%edi
+  800c42:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  800c45:	fd                   	std
+  800c46:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  800c48:	fc                   	cld
+  800c49:	eb 1a                	jmp    800c65 <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800c4b:	89 f2                	mov    %esi,%edx
+  800c4d:	09 c2                	or     %eax,%edx
+  800c4f:	09 ca                	or     %ecx,%edx
+  800c51:	f6 c2 03             	test   $0x3,%dl
+  800c54:	75 0a                	jne    800c60 <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800c56:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  800c59:	89 c7                	mov    %eax,%edi
+  800c5b:	fc                   	cld
+  800c5c:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800c5e:	eb 05                	jmp    800c65 <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  800c60:	89 c7                	mov    %eax,%edi
+  800c62:	fc                   	cld
+  800c63:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  800c65:	5e                   	pop    %esi
+  800c66:	5f                   	pop    %edi
+  800c67:	5d                   	pop    %ebp
+  800c68:	c3                   	ret
+
+00800c69 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800c69:	55                   	push   %ebp
+  800c6a:	89 e5                	mov    %esp,%ebp
+  800c6c:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  800c6f:	ff 75 10             	push   0x10(%ebp)
+  800c72:	ff 75 0c             	push   0xc(%ebp)
+  800c75:	ff 75 08             	push   0x8(%ebp)
+  800c78:	e8 8a ff ff ff       	call   800c07 <memmove>
+}
+  800c7d:	c9                   	leave
+  800c7e:	c3                   	ret
+
+00800c7f <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800c7f:	55                   	push   %ebp
+  800c80:	89 e5                	mov    %esp,%ebp
+  800c82:	56                   	push   %esi
+  800c83:	53                   	push   %ebx
+  800c84:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c87:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  800c8a:	89 c6                	mov    %eax,%esi
+  800c8c:	03 75 10             	add    0x10(%ebp),%esi
+  800c8f:	eb 06                	jmp    800c97 <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  800c91:	83 c0 01             	add    $0x1,%eax
+  800c94:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  800c97:	39 f0                	cmp    %esi,%eax
+  800c99:	74 14                	je     800caf <memcmp+0x30>
+    if (*s1 != *s2)
+  800c9b:	0f b6 08             	movzbl (%eax),%ecx
+  800c9e:	0f b6 1a             	movzbl (%edx),%ebx
+  800ca1:	38 d9                	cmp    %bl,%cl
+  800ca3:	74 ec                	je     800c91 <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  800ca5:	0f b6 c1             	movzbl %cl,%eax
+  800ca8:	0f b6 db             	movzbl %bl,%ebx
+  800cab:	29 d8                	sub    %ebx,%eax
+  800cad:	eb 05                	jmp    800cb4 <memcmp+0x35>
+  }
+
+  return 0;
+  800caf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800cb4:	5b                   	pop    %ebx
+  800cb5:	5e                   	pop    %esi
+  800cb6:	5d                   	pop    %ebp
+  800cb7:	c3                   	ret
+
+00800cb8 <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800cb8:	55                   	push   %ebp
+  800cb9:	89 e5                	mov    %esp,%ebp
+  800cbb:	8b 45 08             	mov    0x8(%ebp),%eax
+  800cbe:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  800cc1:	89 c2                	mov    %eax,%edx
+  800cc3:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  800cc6:	eb 03                	jmp    800ccb <memfind+0x13>
+  800cc8:	83 c0 01             	add    $0x1,%eax
+  800ccb:	39 d0                	cmp    %edx,%eax
+  800ccd:	73 04                	jae    800cd3 <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  800ccf:	38 08                	cmp    %cl,(%eax)
+  800cd1:	75 f5                	jne    800cc8 <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  800cd3:	5d                   	pop    %ebp
+  800cd4:	c3                   	ret
+
+00800cd5 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800cd5:	55                   	push   %ebp
+  800cd6:	89 e5                	mov    %esp,%ebp
+  800cd8:	57                   	push   %edi
+  800cd9:	56                   	push   %esi
+  800cda:	53                   	push   %ebx
+  800cdb:	8b 55 08             	mov    0x8(%ebp),%edx
+  800cde:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  800ce1:	eb 03                	jmp    800ce6 <strtol+0x11>
+    s++;
+  800ce3:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  800ce6:	0f b6 02             	movzbl (%edx),%eax
+  800ce9:	3c 20                	cmp    $0x20,%al
+  800ceb:	74 f6                	je     800ce3 <strtol+0xe>
+  800ced:	3c 09                	cmp    $0x9,%al
+  800cef:	74 f2                	je     800ce3 <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  800cf1:	3c 2b                	cmp    $0x2b,%al
+  800cf3:	74 2a                	je     800d1f <strtol+0x4a>
+  int neg = 0;
+  800cf5:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  800cfa:	3c 2d                	cmp    $0x2d,%al
+  800cfc:	74 2b                	je     800d29 <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800cfe:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800d04:	75 0f                	jne    800d15 <strtol+0x40>
+  800d06:	80 3a 30             	cmpb   $0x30,(%edx)
+  800d09:	74 28                	je     800d33 <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  800d0b:	85 db                	test   %ebx,%ebx
+  800d0d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800d12:	0f 44 d8             	cmove  %eax,%ebx
+  800d15:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d1a:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800d1d:	eb 46                	jmp    800d65 <strtol+0x90>
+    s++;
+  800d1f:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  800d22:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d27:	eb d5                	jmp    800cfe <strtol+0x29>
+    s++, neg = 1;
+  800d29:	83 c2 01             	add    $0x1,%edx
+  800d2c:	bf 01 00 00 00       	mov    $0x1,%edi
+  800d31:	eb cb                	jmp    800cfe <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800d33:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800d37:	74 0e                	je     800d47 <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  800d39:	85 db                	test   %ebx,%ebx
+  800d3b:	75 d8                	jne    800d15 <strtol+0x40>
+    s++, base = 8;
+  800d3d:	83 c2 01             	add    $0x1,%edx
+  800d40:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800d45:	eb ce                	jmp    800d15 <strtol+0x40>
+    s += 2, base = 16;
+  800d47:	83 c2 02             	add    $0x2,%edx
+  800d4a:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800d4f:	eb c4                	jmp    800d15 <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  800d51:	0f be c0             	movsbl %al,%eax
+  800d54:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  800d57:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800d5a:	7d 3a                	jge    800d96 <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  800d5c:	83 c2 01             	add    $0x1,%edx
+  800d5f:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800d63:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  800d65:	0f b6 02             	movzbl (%edx),%eax
+  800d68:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800d6b:	89 f3                	mov    %esi,%ebx
+  800d6d:	80 fb 09             	cmp    $0x9,%bl
+  800d70:	76 df                	jbe    800d51 <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  800d72:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800d75:	89 f3                	mov    %esi,%ebx
+  800d77:	80 fb 19             	cmp    $0x19,%bl
+  800d7a:	77 08                	ja     800d84 <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  800d7c:	0f be c0             	movsbl %al,%eax
+  800d7f:	83 e8 57             	sub    $0x57,%eax
+  800d82:	eb d3                	jmp    800d57 <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  800d84:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800d87:	89 f3                	mov    %esi,%ebx
+  800d89:	80 fb 19             	cmp    $0x19,%bl
+  800d8c:	77 08                	ja     800d96 <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  800d8e:	0f be c0             	movsbl %al,%eax
+  800d91:	83 e8 37             	sub    $0x37,%eax
+  800d94:	eb c1                	jmp    800d57 <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  800d96:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800d9a:	74 05                	je     800da1 <strtol+0xcc>
+    *endptr = (char*)s;
+  800d9c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d9f:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  800da1:	89 c8                	mov    %ecx,%eax
+  800da3:	f7 d8                	neg    %eax
+  800da5:	85 ff                	test   %edi,%edi
+  800da7:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800daa:	89 c8                	mov    %ecx,%eax
+  800dac:	5b                   	pop    %ebx
+  800dad:	5e                   	pop    %esi
+  800dae:	5f                   	pop    %edi
+  800daf:	5d                   	pop    %ebp
+  800db0:	c3                   	ret
+
+00800db1 <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800db1:	55                   	push   %ebp
+  800db2:	89 e5                	mov    %esp,%ebp
+  800db4:	57                   	push   %edi
+  800db5:	56                   	push   %esi
+  800db6:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800db7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dbc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dbf:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800dc2:	89 c3                	mov    %eax,%ebx
+  800dc4:	89 c7                	mov    %eax,%edi
+  800dc6:	89 c6                	mov    %eax,%esi
+  800dc8:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800dca:	5b                   	pop    %ebx
+  800dcb:	5e                   	pop    %esi
+  800dcc:	5f                   	pop    %edi
+  800dcd:	5d                   	pop    %ebp
+  800dce:	c3                   	ret
+
+00800dcf <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800dcf:	55                   	push   %ebp
+  800dd0:	89 e5                	mov    %esp,%ebp
+  800dd2:	57                   	push   %edi
+  800dd3:	56                   	push   %esi
+  800dd4:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800dd5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dda:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ddf:	89 d1                	mov    %edx,%ecx
+  800de1:	89 d3                	mov    %edx,%ebx
+  800de3:	89 d7                	mov    %edx,%edi
+  800de5:	89 d6                	mov    %edx,%esi
+  800de7:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800de9:	5b                   	pop    %ebx
+  800dea:	5e                   	pop    %esi
+  800deb:	5f                   	pop    %edi
+  800dec:	5d                   	pop    %ebp
+  800ded:	c3                   	ret
+
+00800dee <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800dee:	55                   	push   %ebp
+  800def:	89 e5                	mov    %esp,%ebp
+  800df1:	57                   	push   %edi
+  800df2:	56                   	push   %esi
+  800df3:	53                   	push   %ebx
+  800df4:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800df7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800dfc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800dff:	b8 03 00 00 00       	mov    $0x3,%eax
+  800e04:	89 cb                	mov    %ecx,%ebx
+  800e06:	89 cf                	mov    %ecx,%edi
+  800e08:	89 ce                	mov    %ecx,%esi
+  800e0a:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e0c:	85 c0                	test   %eax,%eax
+  800e0e:	7f 08                	jg     800e18 <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800e10:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e13:	5b                   	pop    %ebx
+  800e14:	5e                   	pop    %esi
+  800e15:	5f                   	pop    %edi
+  800e16:	5d                   	pop    %ebp
+  800e17:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e18:	83 ec 0c             	sub    $0xc,%esp
+  800e1b:	50                   	push   %eax
+  800e1c:	6a 03                	push   $0x3
+  800e1e:	68 b3 34 80 00       	push   $0x8034b3
+  800e23:	6a 23                	push   $0x23
+  800e25:	68 d0 34 80 00       	push   $0x8034d0
+  800e2a:	e8 99 f4 ff ff       	call   8002c8 <_panic>
+
+00800e2f <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800e2f:	55                   	push   %ebp
+  800e30:	89 e5                	mov    %esp,%ebp
+  800e32:	57                   	push   %edi
+  800e33:	56                   	push   %esi
+  800e34:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e35:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e3a:	b8 02 00 00 00       	mov    $0x2,%eax
+  800e3f:	89 d1                	mov    %edx,%ecx
+  800e41:	89 d3                	mov    %edx,%ebx
+  800e43:	89 d7                	mov    %edx,%edi
+  800e45:	89 d6                	mov    %edx,%esi
+  800e47:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800e49:	5b                   	pop    %ebx
+  800e4a:	5e                   	pop    %esi
+  800e4b:	5f                   	pop    %edi
+  800e4c:	5d                   	pop    %ebp
+  800e4d:	c3                   	ret
+
+00800e4e <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800e4e:	55                   	push   %ebp
+  800e4f:	89 e5                	mov    %esp,%ebp
+  800e51:	57                   	push   %edi
+  800e52:	56                   	push   %esi
+  800e53:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800e54:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e59:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800e5e:	89 d1                	mov    %edx,%ecx
+  800e60:	89 d3                	mov    %edx,%ebx
+  800e62:	89 d7                	mov    %edx,%edi
+  800e64:	89 d6                	mov    %edx,%esi
+  800e66:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800e68:	5b                   	pop    %ebx
+  800e69:	5e                   	pop    %esi
+  800e6a:	5f                   	pop    %edi
+  800e6b:	5d                   	pop    %ebp
+  800e6c:	c3                   	ret
+
+00800e6d <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  800e6d:	55                   	push   %ebp
+  800e6e:	89 e5                	mov    %esp,%ebp
+  800e70:	57                   	push   %edi
+  800e71:	56                   	push   %esi
+  800e72:	53                   	push   %ebx
+  800e73:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  800e76:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  800e7a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e7f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e82:	b8 14 00 00 00       	mov    $0x14,%eax
+  800e87:	89 df                	mov    %ebx,%edi
+  800e89:	89 de                	mov    %ebx,%esi
+  800e8b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e8d:	85 c0                	test   %eax,%eax
+  800e8f:	7f 08                	jg     800e99 <sys_env_set_cow+0x2c>
+}
+  800e91:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e94:	5b                   	pop    %ebx
+  800e95:	5e                   	pop    %esi
+  800e96:	5f                   	pop    %edi
+  800e97:	5d                   	pop    %ebp
+  800e98:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e99:	83 ec 0c             	sub    $0xc,%esp
+  800e9c:	50                   	push   %eax
+  800e9d:	6a 14                	push   $0x14
+  800e9f:	68 b3 34 80 00       	push   $0x8034b3
+  800ea4:	6a 23                	push   $0x23
+  800ea6:	68 d0 34 80 00       	push   $0x8034d0
+  800eab:	e8 18 f4 ff ff       	call   8002c8 <_panic>
+
+00800eb0 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800eb0:	55                   	push   %ebp
+  800eb1:	89 e5                	mov    %esp,%ebp
+  800eb3:	57                   	push   %edi
+  800eb4:	56                   	push   %esi
+  800eb5:	53                   	push   %ebx
+  800eb6:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800eb9:	be 00 00 00 00       	mov    $0x0,%esi
+  800ebe:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ec1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ec4:	b8 04 00 00 00       	mov    $0x4,%eax
+  800ec9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800ecc:	89 f7                	mov    %esi,%edi
+  800ece:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800ed0:	85 c0                	test   %eax,%eax
+  800ed2:	7f 08                	jg     800edc <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  800ed4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ed7:	5b                   	pop    %ebx
+  800ed8:	5e                   	pop    %esi
+  800ed9:	5f                   	pop    %edi
+  800eda:	5d                   	pop    %ebp
+  800edb:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800edc:	83 ec 0c             	sub    $0xc,%esp
+  800edf:	50                   	push   %eax
+  800ee0:	6a 04                	push   $0x4
+  800ee2:	68 b3 34 80 00       	push   $0x8034b3
+  800ee7:	6a 23                	push   $0x23
+  800ee9:	68 d0 34 80 00       	push   $0x8034d0
+  800eee:	e8 d5 f3 ff ff       	call   8002c8 <_panic>
+
+00800ef3 <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800ef3:	55                   	push   %ebp
+  800ef4:	89 e5                	mov    %esp,%ebp
+  800ef6:	57                   	push   %edi
+  800ef7:	56                   	push   %esi
+  800ef8:	53                   	push   %ebx
+  800ef9:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800efc:	8b 55 08             	mov    0x8(%ebp),%edx
+  800eff:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f02:	b8 05 00 00 00       	mov    $0x5,%eax
+  800f07:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f0a:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f0d:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f10:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f12:	85 c0                	test   %eax,%eax
+  800f14:	7f 08                	jg     800f1e <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  800f16:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f19:	5b                   	pop    %ebx
+  800f1a:	5e                   	pop    %esi
+  800f1b:	5f                   	pop    %edi
+  800f1c:	5d                   	pop    %ebp
+  800f1d:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f1e:	83 ec 0c             	sub    $0xc,%esp
+  800f21:	50                   	push   %eax
+  800f22:	6a 05                	push   $0x5
+  800f24:	68 b3 34 80 00       	push   $0x8034b3
+  800f29:	6a 23                	push   $0x23
+  800f2b:	68 d0 34 80 00       	push   $0x8034d0
+  800f30:	e8 93 f3 ff ff       	call   8002c8 <_panic>
+
+00800f35 <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800f35:	55                   	push   %ebp
+  800f36:	89 e5                	mov    %esp,%ebp
+  800f38:	57                   	push   %edi
+  800f39:	56                   	push   %esi
+  800f3a:	53                   	push   %ebx
+  800f3b:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f3e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f43:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f46:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f49:	b8 06 00 00 00       	mov    $0x6,%eax
+  800f4e:	89 df                	mov    %ebx,%edi
+  800f50:	89 de                	mov    %ebx,%esi
+  800f52:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f54:	85 c0                	test   %eax,%eax
+  800f56:	7f 08                	jg     800f60 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  800f58:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f5b:	5b                   	pop    %ebx
+  800f5c:	5e                   	pop    %esi
+  800f5d:	5f                   	pop    %edi
+  800f5e:	5d                   	pop    %ebp
+  800f5f:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f60:	83 ec 0c             	sub    $0xc,%esp
+  800f63:	50                   	push   %eax
+  800f64:	6a 06                	push   $0x6
+  800f66:	68 b3 34 80 00       	push   $0x8034b3
+  800f6b:	6a 23                	push   $0x23
+  800f6d:	68 d0 34 80 00       	push   $0x8034d0
+  800f72:	e8 51 f3 ff ff       	call   8002c8 <_panic>
+
+00800f77 <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  800f77:	55                   	push   %ebp
+  800f78:	89 e5                	mov    %esp,%ebp
+  800f7a:	57                   	push   %edi
+  800f7b:	56                   	push   %esi
+  800f7c:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f7d:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f80:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f83:	b8 11 00 00 00       	mov    $0x11,%eax
+  800f88:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f8b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f8e:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f91:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  800f93:	5b                   	pop    %ebx
+  800f94:	5e                   	pop    %esi
+  800f95:	5f                   	pop    %edi
+  800f96:	5d                   	pop    %ebp
+  800f97:	c3                   	ret
+
+00800f98 <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  800f98:	55                   	push   %ebp
+  800f99:	89 e5                	mov    %esp,%ebp
+  800f9b:	57                   	push   %edi
+  800f9c:	56                   	push   %esi
+  800f9d:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f9e:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fa1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fa4:	b8 12 00 00 00       	mov    $0x12,%eax
+  800fa9:	be 00 00 00 00       	mov    $0x0,%esi
+  800fae:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fb1:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800fb4:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  800fb6:	5b                   	pop    %ebx
+  800fb7:	5e                   	pop    %esi
+  800fb8:	5f                   	pop    %edi
+  800fb9:	5d                   	pop    %ebp
+  800fba:	c3                   	ret
+
+00800fbb <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  800fbb:	55                   	push   %ebp
+  800fbc:	89 e5                	mov    %esp,%ebp
+  800fbe:	57                   	push   %edi
+  800fbf:	56                   	push   %esi
+  800fc0:	53                   	push   %ebx
+  800fc1:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800fc4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800fc9:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fcc:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fcf:	b8 16 00 00 00       	mov    $0x16,%eax
+  800fd4:	89 df                	mov    %ebx,%edi
+  800fd6:	89 de                	mov    %ebx,%esi
+  800fd8:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800fda:	85 c0                	test   %eax,%eax
+  800fdc:	7f 08                	jg     800fe6 <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  800fde:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fe1:	5b                   	pop    %ebx
+  800fe2:	5e                   	pop    %esi
+  800fe3:	5f                   	pop    %edi
+  800fe4:	5d                   	pop    %ebp
+  800fe5:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800fe6:	83 ec 0c             	sub    $0xc,%esp
+  800fe9:	50                   	push   %eax
+  800fea:	6a 16                	push   $0x16
+  800fec:	68 b3 34 80 00       	push   $0x8034b3
+  800ff1:	6a 23                	push   $0x23
+  800ff3:	68 d0 34 80 00       	push   $0x8034d0
+  800ff8:	e8 cb f2 ff ff       	call   8002c8 <_panic>
+
+00800ffd <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  800ffd:	55                   	push   %ebp
+  800ffe:	89 e5                	mov    %esp,%ebp
+  801000:	57                   	push   %edi
+  801001:	56                   	push   %esi
+  801002:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801003:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801008:	8b 55 08             	mov    0x8(%ebp),%edx
+  80100b:	b8 17 00 00 00       	mov    $0x17,%eax
+  801010:	89 cb                	mov    %ecx,%ebx
+  801012:	89 cf                	mov    %ecx,%edi
+  801014:	89 ce                	mov    %ecx,%esi
+  801016:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  801018:	5b                   	pop    %ebx
+  801019:	5e                   	pop    %esi
+  80101a:	5f                   	pop    %edi
+  80101b:	5d                   	pop    %ebp
+  80101c:	c3                   	ret
+
+0080101d <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  80101d:	55                   	push   %ebp
+  80101e:	89 e5                	mov    %esp,%ebp
+  801020:	57                   	push   %edi
+  801021:	56                   	push   %esi
+  801022:	53                   	push   %ebx
+  801023:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801026:	be 00 00 00 00       	mov    $0x0,%esi
+  80102b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80102e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801031:	b8 18 00 00 00       	mov    $0x18,%eax
+  801036:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801039:	89 f7                	mov    %esi,%edi
+  80103b:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80103d:	85 c0                	test   %eax,%eax
+  80103f:	7f 08                	jg     801049 <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  801041:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801044:	5b                   	pop    %ebx
+  801045:	5e                   	pop    %esi
+  801046:	5f                   	pop    %edi
+  801047:	5d                   	pop    %ebp
+  801048:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801049:	83 ec 0c             	sub    $0xc,%esp
+  80104c:	50                   	push   %eax
+  80104d:	6a 18                	push   $0x18
+  80104f:	68 b3 34 80 00       	push   $0x8034b3
+  801054:	6a 23                	push   $0x23
+  801056:	68 d0 34 80 00       	push   $0x8034d0
+  80105b:	e8 68 f2 ff ff       	call   8002c8 <_panic>
+
+00801060 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  801060:	55                   	push   %ebp
+  801061:	89 e5                	mov    %esp,%ebp
+  801063:	57                   	push   %edi
+  801064:	56                   	push   %esi
+  801065:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801066:	be 00 00 00 00       	mov    $0x0,%esi
+  80106b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80106e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801071:	b8 19 00 00 00       	mov    $0x19,%eax
+  801076:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801079:	89 f7                	mov    %esi,%edi
+  80107b:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  80107d:	5b                   	pop    %ebx
+  80107e:	5e                   	pop    %esi
+  80107f:	5f                   	pop    %edi
+  801080:	5d                   	pop    %ebp
+  801081:	c3                   	ret
+
+00801082 <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  801082:	55                   	push   %ebp
+  801083:	89 e5                	mov    %esp,%ebp
+  801085:	57                   	push   %edi
+  801086:	56                   	push   %esi
+  801087:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801088:	ba 00 00 00 00       	mov    $0x0,%edx
+  80108d:	b8 15 00 00 00       	mov    $0x15,%eax
+  801092:	89 d1                	mov    %edx,%ecx
+  801094:	89 d3                	mov    %edx,%ebx
+  801096:	89 d7                	mov    %edx,%edi
+  801098:	89 d6                	mov    %edx,%esi
+  80109a:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  80109c:	5b                   	pop    %ebx
+  80109d:	5e                   	pop    %esi
+  80109e:	5f                   	pop    %edi
+  80109f:	5d                   	pop    %ebp
+  8010a0:	c3                   	ret
+
+008010a1 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  8010a1:	55                   	push   %ebp
+  8010a2:	89 e5                	mov    %esp,%ebp
+  8010a4:	57                   	push   %edi
+  8010a5:	56                   	push   %esi
+  8010a6:	53                   	push   %ebx
+  8010a7:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8010aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010af:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010b2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010b5:	b8 08 00 00 00       	mov    $0x8,%eax
+  8010ba:	89 df                	mov    %ebx,%edi
+  8010bc:	89 de                	mov    %ebx,%esi
+  8010be:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8010c0:	85 c0                	test   %eax,%eax
+  8010c2:	7f 08                	jg     8010cc <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  8010c4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010c7:	5b                   	pop    %ebx
+  8010c8:	5e                   	pop    %esi
+  8010c9:	5f                   	pop    %edi
+  8010ca:	5d                   	pop    %ebp
+  8010cb:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8010cc:	83 ec 0c             	sub    $0xc,%esp
+  8010cf:	50                   	push   %eax
+  8010d0:	6a 08                	push   $0x8
+  8010d2:	68 b3 34 80 00       	push   $0x8034b3
+  8010d7:	6a 23                	push   $0x23
+  8010d9:	68 d0 34 80 00       	push   $0x8034d0
+  8010de:	e8 e5 f1 ff ff       	call   8002c8 <_panic>
+
+008010e3 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  8010e3:	55                   	push   %ebp
+  8010e4:	89 e5                	mov    %esp,%ebp
+  8010e6:	57                   	push   %edi
+  8010e7:	56                   	push   %esi
+  8010e8:	53                   	push   %ebx
+  8010e9:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8010ec:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010f1:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f4:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010f7:	b8 09 00 00 00       	mov    $0x9,%eax
+  8010fc:	89 df                	mov    %ebx,%edi
+  8010fe:	89 de                	mov    %ebx,%esi
+  801100:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801102:	85 c0                	test   %eax,%eax
+  801104:	7f 08                	jg     80110e <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  801106:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801109:	5b                   	pop    %ebx
+  80110a:	5e                   	pop    %esi
+  80110b:	5f                   	pop    %edi
+  80110c:	5d                   	pop    %ebp
+  80110d:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80110e:	83 ec 0c             	sub    $0xc,%esp
+  801111:	50                   	push   %eax
+  801112:	6a 09                	push   $0x9
+  801114:	68 b3 34 80 00       	push   $0x8034b3
+  801119:	6a 23                	push   $0x23
+  80111b:	68 d0 34 80 00       	push   $0x8034d0
+  801120:	e8 a3 f1 ff ff       	call   8002c8 <_panic>
+
+00801125 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  801125:	55                   	push   %ebp
+  801126:	89 e5                	mov    %esp,%ebp
+  801128:	57                   	push   %edi
+  801129:	56                   	push   %esi
+  80112a:	53                   	push   %ebx
+  80112b:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  80112e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801133:	8b 55 08             	mov    0x8(%ebp),%edx
+  801136:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801139:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80113e:	89 df                	mov    %ebx,%edi
+  801140:	89 de                	mov    %ebx,%esi
+  801142:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801144:	85 c0                	test   %eax,%eax
+  801146:	7f 08                	jg     801150 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  801148:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80114b:	5b                   	pop    %ebx
+  80114c:	5e                   	pop    %esi
+  80114d:	5f                   	pop    %edi
+  80114e:	5d                   	pop    %ebp
+  80114f:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801150:	83 ec 0c             	sub    $0xc,%esp
+  801153:	50                   	push   %eax
+  801154:	6a 0a                	push   $0xa
+  801156:	68 b3 34 80 00       	push   $0x8034b3
+  80115b:	6a 23                	push   $0x23
+  80115d:	68 d0 34 80 00       	push   $0x8034d0
+  801162:	e8 61 f1 ff ff       	call   8002c8 <_panic>
+
+00801167 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  801167:	55                   	push   %ebp
+  801168:	89 e5                	mov    %esp,%ebp
+  80116a:	57                   	push   %edi
+  80116b:	56                   	push   %esi
+  80116c:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80116d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801170:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801173:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801178:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80117b:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80117e:	8b 75 18             	mov    0x18(%ebp),%esi
+  801181:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  801183:	5b                   	pop    %ebx
+  801184:	5e                   	pop    %esi
+  801185:	5f                   	pop    %edi
+  801186:	5d                   	pop    %ebp
+  801187:	c3                   	ret
+
+00801188 <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  801188:	55                   	push   %ebp
+  801189:	89 e5                	mov    %esp,%ebp
+  80118b:	57                   	push   %edi
+  80118c:	56                   	push   %esi
+  80118d:	53                   	push   %ebx
+  80118e:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801191:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801196:	8b 55 08             	mov    0x8(%ebp),%edx
+  801199:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80119c:	b8 0d 00 00 00       	mov    $0xd,%eax
+  8011a1:	89 df                	mov    %ebx,%edi
+  8011a3:	89 de                	mov    %ebx,%esi
+  8011a5:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8011a7:	85 c0                	test   %eax,%eax
+  8011a9:	7f 08                	jg     8011b3 <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  8011ab:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8011ae:	5b                   	pop    %ebx
+  8011af:	5e                   	pop    %esi
+  8011b0:	5f                   	pop    %edi
+  8011b1:	5d                   	pop    %ebp
+  8011b2:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8011b3:	83 ec 0c             	sub    $0xc,%esp
+  8011b6:	50                   	push   %eax
+  8011b7:	6a 0d                	push   $0xd
+  8011b9:	68 b3 34 80 00       	push   $0x8034b3
+  8011be:	6a 23                	push   $0x23
+  8011c0:	68 d0 34 80 00       	push   $0x8034d0
+  8011c5:	e8 fe f0 ff ff       	call   8002c8 <_panic>
+
+008011ca <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  8011ca:	55                   	push   %ebp
+  8011cb:	89 e5                	mov    %esp,%ebp
+  8011cd:	57                   	push   %edi
+  8011ce:	56                   	push   %esi
+  8011cf:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8011d0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011d5:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8011da:	89 d1                	mov    %edx,%ecx
+  8011dc:	89 d3                	mov    %edx,%ebx
+  8011de:	89 d7                	mov    %edx,%edi
+  8011e0:	89 d6                	mov    %edx,%esi
+  8011e2:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  8011e4:	5b                   	pop    %ebx
+  8011e5:	5e                   	pop    %esi
+  8011e6:	5f                   	pop    %edi
+  8011e7:	5d                   	pop    %ebp
+  8011e8:	c3                   	ret
+
+008011e9 <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  8011e9:	55                   	push   %ebp
+  8011ea:	89 e5                	mov    %esp,%ebp
+  8011ec:	57                   	push   %edi
+  8011ed:	56                   	push   %esi
+  8011ee:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8011ef:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011f2:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011f5:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8011fa:	be 00 00 00 00       	mov    $0x0,%esi
+  8011ff:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801202:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801205:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  801207:	5b                   	pop    %ebx
+  801208:	5e                   	pop    %esi
+  801209:	5f                   	pop    %edi
+  80120a:	5d                   	pop    %ebp
+  80120b:	c3                   	ret
+
+0080120c <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  80120c:	55                   	push   %ebp
+  80120d:	89 e5                	mov    %esp,%ebp
+  80120f:	57                   	push   %edi
+  801210:	56                   	push   %esi
+  801211:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801212:	be 00 00 00 00       	mov    $0x0,%esi
+  801217:	8b 55 08             	mov    0x8(%ebp),%edx
+  80121a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80121d:	b8 10 00 00 00       	mov    $0x10,%eax
+  801222:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801225:	89 f7                	mov    %esi,%edi
+  801227:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  801229:	5b                   	pop    %ebx
+  80122a:	5e                   	pop    %esi
+  80122b:	5f                   	pop    %edi
+  80122c:	5d                   	pop    %ebp
+  80122d:	c3                   	ret
+
+0080122e <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  80122e:	55                   	push   %ebp
+  80122f:	89 e5                	mov    %esp,%ebp
+  801231:	57                   	push   %edi
+  801232:	56                   	push   %esi
+  801233:	53                   	push   %ebx
+  801234:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  801237:	80 3d 48 5b 80 00 00 	cmpb   $0x0,0x805b48
+  80123e:	74 41                	je     801281 <sys_batch+0x53>
+  801240:	8b 45 08             	mov    0x8(%ebp),%eax
+  801243:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  801246:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  80124d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801250:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  801253:	7d 45                	jge    80129a <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  801255:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801258:	8b 06                	mov    (%esi),%eax
+  80125a:	8b 56 04             	mov    0x4(%esi),%edx
+  80125d:	8b 4e 08             	mov    0x8(%esi),%ecx
+  801260:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  801263:	8b 7e 10             	mov    0x10(%esi),%edi
+  801266:	8b 76 14             	mov    0x14(%esi),%esi
+  801269:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  80126b:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80126e:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  801271:	83 c6 1c             	add    $0x1c,%esi
+  801274:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  801277:	85 c0                	test   %eax,%eax
+  801279:	78 1f                	js     80129a <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  80127b:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  80127f:	eb cc                	jmp    80124d <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  801281:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801286:	b8 13 00 00 00       	mov    $0x13,%eax
+  80128b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80128e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801291:	89 df                	mov    %ebx,%edi
+  801293:	89 de                	mov    %ebx,%esi
+  801295:	cd 30                	int    $0x30
+  801297:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  80129a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  80129d:	83 c4 08             	add    $0x8,%esp
+  8012a0:	5b                   	pop    %ebx
+  8012a1:	5e                   	pop    %esi
+  8012a2:	5f                   	pop    %edi
+  8012a3:	5d                   	pop    %ebp
+  8012a4:	c3                   	ret
+
+008012a5 <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  8012a5:	55                   	push   %ebp
+  8012a6:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  8012a8:	8b 45 08             	mov    0x8(%ebp),%eax
+  8012ab:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  8012b1:	5d                   	pop    %ebp
+  8012b2:	c3                   	ret
+
+008012b3 <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  8012b3:	55                   	push   %ebp
+  8012b4:	89 e5                	mov    %esp,%ebp
+  8012b6:	56                   	push   %esi
+  8012b7:	53                   	push   %ebx
+  8012b8:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  8012bb:	8b 1e                	mov    (%esi),%ebx
+  8012bd:	85 db                	test   %ebx,%ebx
+  8012bf:	75 09                	jne    8012ca <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  8012c1:	89 d8                	mov    %ebx,%eax
+  8012c3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8012c6:	5b                   	pop    %ebx
+  8012c7:	5e                   	pop    %esi
+  8012c8:	5d                   	pop    %ebp
+  8012c9:	c3                   	ret
+  b->sb_n = 0;
+  8012ca:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  8012d0:	53                   	push   %ebx
+  8012d1:	8d 46 04             	lea    0x4(%esi),%eax
+  8012d4:	50                   	push   %eax
+  8012d5:	e8 54 ff ff ff       	call   80122e <sys_batch>
+  8012da:	83 c4 08             	add    $0x8,%esp
+  8012dd:	85 c0                	test   %eax,%eax
+  8012df:	78 1e                	js     8012ff <sysbatch_flush+0x4c>
+  if (r < n)
+  8012e1:	39 c3                	cmp    %eax,%ebx
+  8012e3:	7f 07                	jg     8012ec <sysbatch_flush+0x39>
+  return 0;
+  8012e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8012ea:	eb d5                	jmp    8012c1 <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  8012ec:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8012ef:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  8012f3:	85 db                	test   %ebx,%ebx
+  8012f5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8012fa:	0f 49 d8             	cmovns %eax,%ebx
+  8012fd:	eb c2                	jmp    8012c1 <sysbatch_flush+0xe>
+    return r;
+  8012ff:	89 c3                	mov    %eax,%ebx
+  801301:	eb be                	jmp    8012c1 <sysbatch_flush+0xe>
+
+00801303 <sysbatch_add>:
+{
+  801303:	55                   	push   %ebp
+  801304:	89 e5                	mov    %esp,%ebp
+  801306:	53                   	push   %ebx
+  801307:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  80130a:	83 3b 40             	cmpl   $0x40,(%ebx)
+  80130d:	74 41                	je     801350 <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  80130f:	8b 03                	mov    (%ebx),%eax
+  801311:	8d 50 01             	lea    0x1(%eax),%edx
+  801314:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  801316:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801319:	01 d8                	add    %ebx,%eax
+  80131b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80131e:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  801321:	8b 55 10             	mov    0x10(%ebp),%edx
+  801324:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  801327:	8b 55 14             	mov    0x14(%ebp),%edx
+  80132a:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  80132d:	8b 55 18             	mov    0x18(%ebp),%edx
+  801330:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  801333:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  801336:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  801339:	8b 55 20             	mov    0x20(%ebp),%edx
+  80133c:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  80133f:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  801346:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80134b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80134e:	c9                   	leave
+  80134f:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  801350:	53                   	push   %ebx
+  801351:	e8 5d ff ff ff       	call   8012b3 <sysbatch_flush>
+  801356:	83 c4 04             	add    $0x4,%esp
+  801359:	85 c0                	test   %eax,%eax
+  80135b:	79 b2                	jns    80130f <sysbatch_add+0xc>
+  80135d:	eb ec                	jmp    80134b <sysbatch_add+0x48>
+
+0080135f <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80135f:	55                   	push   %ebp
+  801360:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801362:	8b 45 08             	mov    0x8(%ebp),%eax
+  801365:	05 00 00 00 30       	add    $0x30000000,%eax
+  80136a:	c1 e8 0c             	shr    $0xc,%eax
+}
+  80136d:	5d                   	pop    %ebp
+  80136e:	c3                   	ret
+
+0080136f <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80136f:	55                   	push   %ebp
+  801370:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801372:	8b 45 08             	mov    0x8(%ebp),%eax
+  801375:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  801378:	66 b8 00 00          	mov    $0x0,%ax
+  80137c:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  801381:	5d                   	pop    %ebp
+  801382:	c3                   	ret
+
+00801383 <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  801383:	55                   	push   %ebp
+  801384:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  801386:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80138b:	eb 02                	jmp    80138f <fd_alloc+0xc>
+  80138d:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80138f:	89 c2                	mov    %eax,%edx
+  801391:	c1 ea 16             	shr    $0x16,%edx
+  801394:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  80139b:	f6 c2 01             	test   $0x1,%dl
+  80139e:	74 2b                	je     8013cb <fd_alloc+0x48>
+  8013a0:	89 c2                	mov    %eax,%edx
+  8013a2:	c1 ea 0c             	shr    $0xc,%edx
+  8013a5:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  8013ac:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  8013b2:	f6 c1 01             	test   $0x1,%cl
+  8013b5:	74 14                	je     8013cb <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  8013b7:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  8013bd:	75 ce                	jne    80138d <fd_alloc+0xa>
+  8013bf:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  8013c4:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  8013c9:	eb 05                	jmp    8013d0 <fd_alloc+0x4d>
+      return 0;
+  8013cb:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  8013d0:	8b 55 08             	mov    0x8(%ebp),%edx
+  8013d3:	89 02                	mov    %eax,(%edx)
+}
+  8013d5:	89 c8                	mov    %ecx,%eax
+  8013d7:	5d                   	pop    %ebp
+  8013d8:	c3                   	ret
+
+008013d9 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  8013d9:	55                   	push   %ebp
+  8013da:	89 e5                	mov    %esp,%ebp
+  8013dc:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  8013df:	83 f8 1f             	cmp    $0x1f,%eax
+  8013e2:	77 30                	ja     801414 <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  8013e4:	c1 e0 0c             	shl    $0xc,%eax
+  8013e7:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8013ec:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8013f2:	f6 c2 01             	test   $0x1,%dl
+  8013f5:	74 24                	je     80141b <fd_lookup+0x42>
+  8013f7:	89 c2                	mov    %eax,%edx
+  8013f9:	c1 ea 0c             	shr    $0xc,%edx
+  8013fc:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801403:	f6 c2 01             	test   $0x1,%dl
+  801406:	74 1a                	je     801422 <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  801408:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80140b:	89 02                	mov    %eax,(%edx)
+  return 0;
+  80140d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801412:	5d                   	pop    %ebp
+  801413:	c3                   	ret
+    return -E_INVAL;
+  801414:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801419:	eb f7                	jmp    801412 <fd_lookup+0x39>
+    return -E_INVAL;
+  80141b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801420:	eb f0                	jmp    801412 <fd_lookup+0x39>
+  801422:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801427:	eb e9                	jmp    801412 <fd_lookup+0x39>
+
+00801429 <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  801429:	55                   	push   %ebp
+  80142a:	89 e5                	mov    %esp,%ebp
+  80142c:	53                   	push   %ebx
+  80142d:	83 ec 04             	sub    $0x4,%esp
+  801430:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  801433:	b8 5c 35 80 00       	mov    $0x80355c,%eax
+  801438:	8b 18                	mov    (%eax),%ebx
+  80143a:	85 db                	test   %ebx,%ebx
+  80143c:	74 0e                	je     80144c <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  80143e:	83 c0 04             	add    $0x4,%eax
+  801441:	39 13                	cmp    %edx,(%ebx)
+  801443:	75 f3                	jne    801438 <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  801445:	b8 00 00 00 00       	mov    $0x0,%eax
+  80144a:	eb 1f                	jmp    80146b <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80144c:	a1 44 5b 80 00       	mov    0x805b44,%eax
+  801451:	8b 40 48             	mov    0x48(%eax),%eax
+  801454:	83 ec 04             	sub    $0x4,%esp
+  801457:	52                   	push   %edx
+  801458:	50                   	push   %eax
+  801459:	68 e0 34 80 00       	push   $0x8034e0
+  80145e:	e8 40 ef ff ff       	call   8003a3 <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  801463:	83 c4 10             	add    $0x10,%esp
+  801466:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  80146b:	8b 55 0c             	mov    0xc(%ebp),%edx
+  80146e:	89 1a                	mov    %ebx,(%edx)
+}
+  801470:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801473:	c9                   	leave
+  801474:	c3                   	ret
+
+00801475 <fd_close>:
+{
+  801475:	55                   	push   %ebp
+  801476:	89 e5                	mov    %esp,%ebp
+  801478:	57                   	push   %edi
+  801479:	56                   	push   %esi
+  80147a:	53                   	push   %ebx
+  80147b:	83 ec 24             	sub    $0x24,%esp
+  80147e:	8b 75 08             	mov    0x8(%ebp),%esi
+  801481:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801484:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801487:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801488:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  80148e:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  801491:	50                   	push   %eax
+  801492:	e8 42 ff ff ff       	call   8013d9 <fd_lookup>
+  801497:	89 c3                	mov    %eax,%ebx
+  801499:	83 c4 10             	add    $0x10,%esp
+  80149c:	85 c0                	test   %eax,%eax
+  80149e:	78 05                	js     8014a5 <fd_close+0x30>
+      || fd != fd2)
+  8014a0:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  8014a3:	74 16                	je     8014bb <fd_close+0x46>
+    return must_exist ? r : 0;
+  8014a5:	89 f8                	mov    %edi,%eax
+  8014a7:	84 c0                	test   %al,%al
+  8014a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014ae:	0f 44 d8             	cmove  %eax,%ebx
+}
+  8014b1:	89 d8                	mov    %ebx,%eax
+  8014b3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8014b6:	5b                   	pop    %ebx
+  8014b7:	5e                   	pop    %esi
+  8014b8:	5f                   	pop    %edi
+  8014b9:	5d                   	pop    %ebp
+  8014ba:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8014bb:	83 ec 08             	sub    $0x8,%esp
+  8014be:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  8014c1:	50                   	push   %eax
+  8014c2:	ff 36                	push   (%esi)
+  8014c4:	e8 60 ff ff ff       	call   801429 <dev_lookup>
+  8014c9:	89 c3                	mov    %eax,%ebx
+  8014cb:	83 c4 10             	add    $0x10,%esp
+  8014ce:	85 c0                	test   %eax,%eax
+  8014d0:	78 1a                	js     8014ec <fd_close+0x77>
+    if (dev->dev_close)
+  8014d2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8014d5:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  8014d8:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  8014dd:	85 c0                	test   %eax,%eax
+  8014df:	74 0b                	je     8014ec <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  8014e1:	83 ec 0c             	sub    $0xc,%esp
+  8014e4:	56                   	push   %esi
+  8014e5:	ff d0                	call   *%eax
+  8014e7:	89 c3                	mov    %eax,%ebx
+  8014e9:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  8014ec:	83 ec 08             	sub    $0x8,%esp
+  8014ef:	56                   	push   %esi
+  8014f0:	6a 00                	push   $0x0
+  8014f2:	e8 3e fa ff ff       	call   800f35 <sys_page_unmap>
+  return r;
+  8014f7:	83 c4 10             	add    $0x10,%esp
+  8014fa:	eb b5                	jmp    8014b1 <fd_close+0x3c>
+
+008014fc <close>:
+
+int
+close(int fdnum)
+{
+  8014fc:	55                   	push   %ebp
+  8014fd:	89 e5                	mov    %esp,%ebp
+  8014ff:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801502:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801505:	50                   	push   %eax
+  801506:	ff 75 08             	push   0x8(%ebp)
+  801509:	e8 cb fe ff ff       	call   8013d9 <fd_lookup>
+  80150e:	83 c4 10             	add    $0x10,%esp
+  801511:	85 c0                	test   %eax,%eax
+  801513:	79 02                	jns    801517 <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  801515:	c9                   	leave
+  801516:	c3                   	ret
+    return fd_close(fd, 1);
+  801517:	83 ec 08             	sub    $0x8,%esp
+  80151a:	6a 01                	push   $0x1
+  80151c:	ff 75 f4             	push   -0xc(%ebp)
+  80151f:	e8 51 ff ff ff       	call   801475 <fd_close>
+  801524:	83 c4 10             	add    $0x10,%esp
+  801527:	eb ec                	jmp    801515 <close+0x19>
+
+00801529 <close_all>:
+
+void
+close_all(void)
+{
+  801529:	55                   	push   %ebp
+  80152a:	89 e5                	mov    %esp,%ebp
+  80152c:	53                   	push   %ebx
+  80152d:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  801530:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  801535:	83 ec 0c             	sub    $0xc,%esp
+  801538:	53                   	push   %ebx
+  801539:	e8 be ff ff ff       	call   8014fc <close>
+  for (i = 0; i < MAXFD; i++)
+  80153e:	83 c3 01             	add    $0x1,%ebx
+  801541:	83 c4 10             	add    $0x10,%esp
+  801544:	83 fb 20             	cmp    $0x20,%ebx
+  801547:	75 ec                	jne    801535 <close_all+0xc>
+}
+  801549:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80154c:	c9                   	leave
+  80154d:	c3                   	ret
+
+0080154e <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  80154e:	55                   	push   %ebp
+  80154f:	89 e5                	mov    %esp,%ebp
+  801551:	57                   	push   %edi
+  801552:	56                   	push   %esi
+  801553:	53                   	push   %ebx
+  801554:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801557:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80155a:	50                   	push   %eax
+  80155b:	ff 75 08             	push   0x8(%ebp)
+  80155e:	e8 76 fe ff ff       	call   8013d9 <fd_lookup>
+  801563:	89 c6                	mov    %eax,%esi
+  801565:	83 c4 10             	add    $0x10,%esp
+  801568:	85 c0                	test   %eax,%eax
+  80156a:	0f 88 0a 01 00 00    	js     80167a <dup+0x12c>
+    return r;
+  close(newfdnum);
+  801570:	83 ec 0c             	sub    $0xc,%esp
+  801573:	ff 75 0c             	push   0xc(%ebp)
+  801576:	e8 81 ff ff ff       	call   8014fc <close>
+
+  newfd = INDEX2FD(newfdnum);
+  80157b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80157e:	c1 e0 0c             	shl    $0xc,%eax
+  801581:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  801587:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  80158a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80158d:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  801590:	89 04 24             	mov    %eax,(%esp)
+  801593:	e8 d7 fd ff ff       	call   80136f <fd2data>
+  801598:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  80159a:	89 3c 24             	mov    %edi,(%esp)
+  80159d:	e8 cd fd ff ff       	call   80136f <fd2data>
+  8015a2:	83 c4 10             	add    $0x10,%esp
+  8015a5:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8015a8:	89 f3                	mov    %esi,%ebx
+  8015aa:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  8015b0:	89 c6                	mov    %eax,%esi
+  8015b2:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8015b5:	89 cf                	mov    %ecx,%edi
+  8015b7:	eb 0c                	jmp    8015c5 <dup+0x77>
+  8015b9:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8015bf:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8015c5:	39 fb                	cmp    %edi,%ebx
+  8015c7:	74 7b                	je     801644 <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  8015c9:	89 d8                	mov    %ebx,%eax
+  8015cb:	c1 e8 16             	shr    $0x16,%eax
+  8015ce:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8015d5:	a8 01                	test   $0x1,%al
+  8015d7:	74 e0                	je     8015b9 <dup+0x6b>
+  8015d9:	89 d8                	mov    %ebx,%eax
+  8015db:	c1 e8 0c             	shr    $0xc,%eax
+  8015de:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8015e5:	f6 c2 01             	test   $0x1,%dl
+  8015e8:	74 cf                	je     8015b9 <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  8015ea:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  8015f1:	83 ec 0c             	sub    $0xc,%esp
+  8015f4:	25 07 0e 00 00       	and    $0xe07,%eax
+  8015f9:	50                   	push   %eax
+  8015fa:	56                   	push   %esi
+  8015fb:	6a 00                	push   $0x0
+  8015fd:	53                   	push   %ebx
+  8015fe:	6a 00                	push   $0x0
+  801600:	e8 ee f8 ff ff       	call   800ef3 <sys_page_map>
+  801605:	83 c4 20             	add    $0x20,%esp
+  801608:	85 c0                	test   %eax,%eax
+  80160a:	79 ad                	jns    8015b9 <dup+0x6b>
+  80160c:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  80160f:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  801611:	83 ec 08             	sub    $0x8,%esp
+  801614:	ff 75 d4             	push   -0x2c(%ebp)
+  801617:	6a 00                	push   $0x0
+  801619:	e8 17 f9 ff ff       	call   800f35 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  80161e:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  801621:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  801627:	83 c4 10             	add    $0x10,%esp
+  80162a:	39 df                	cmp    %ebx,%edi
+  80162c:	74 4c                	je     80167a <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  80162e:	83 ec 08             	sub    $0x8,%esp
+  801631:	57                   	push   %edi
+  801632:	6a 00                	push   $0x0
+  801634:	e8 fc f8 ff ff       	call   800f35 <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801639:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  80163f:	83 c4 10             	add    $0x10,%esp
+  801642:	eb e6                	jmp    80162a <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  801644:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801647:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  80164a:	89 c8                	mov    %ecx,%eax
+  80164c:	c1 e8 0c             	shr    $0xc,%eax
+  80164f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801656:	83 ec 0c             	sub    $0xc,%esp
+  801659:	25 07 0e 00 00       	and    $0xe07,%eax
+  80165e:	50                   	push   %eax
+  80165f:	ff 75 d4             	push   -0x2c(%ebp)
+  801662:	6a 00                	push   $0x0
+  801664:	51                   	push   %ecx
+  801665:	6a 00                	push   $0x0
+  801667:	e8 87 f8 ff ff       	call   800ef3 <sys_page_map>
+  80166c:	89 c6                	mov    %eax,%esi
+  80166e:	83 c4 20             	add    $0x20,%esp
+  801671:	85 c0                	test   %eax,%eax
+  801673:	78 9c                	js     801611 <dup+0xc3>
+  return newfdnum;
+  801675:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801678:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  80167a:	89 f0                	mov    %esi,%eax
+  80167c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80167f:	5b                   	pop    %ebx
+  801680:	5e                   	pop    %esi
+  801681:	5f                   	pop    %edi
+  801682:	5d                   	pop    %ebp
+  801683:	c3                   	ret
+
+00801684 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801684:	55                   	push   %ebp
+  801685:	89 e5                	mov    %esp,%ebp
+  801687:	56                   	push   %esi
+  801688:	53                   	push   %ebx
+  801689:	83 ec 18             	sub    $0x18,%esp
+  80168c:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  80168f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801692:	50                   	push   %eax
+  801693:	56                   	push   %esi
+  801694:	e8 40 fd ff ff       	call   8013d9 <fd_lookup>
+  801699:	83 c4 10             	add    $0x10,%esp
+  80169c:	85 c0                	test   %eax,%eax
+  80169e:	78 3c                	js     8016dc <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  8016a0:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  8016a3:	83 ec 08             	sub    $0x8,%esp
+  8016a6:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8016a9:	50                   	push   %eax
+  8016aa:	ff 33                	push   (%ebx)
+  8016ac:	e8 78 fd ff ff       	call   801429 <dev_lookup>
+  8016b1:	83 c4 10             	add    $0x10,%esp
+  8016b4:	85 c0                	test   %eax,%eax
+  8016b6:	78 24                	js     8016dc <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  8016b8:	8b 43 08             	mov    0x8(%ebx),%eax
+  8016bb:	83 e0 03             	and    $0x3,%eax
+  8016be:	83 f8 01             	cmp    $0x1,%eax
+  8016c1:	74 20                	je     8016e3 <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  8016c3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8016c6:	8b 40 08             	mov    0x8(%eax),%eax
+  8016c9:	85 c0                	test   %eax,%eax
+  8016cb:	74 37                	je     801704 <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  8016cd:	83 ec 04             	sub    $0x4,%esp
+  8016d0:	ff 75 10             	push   0x10(%ebp)
+  8016d3:	ff 75 0c             	push   0xc(%ebp)
+  8016d6:	53                   	push   %ebx
+  8016d7:	ff d0                	call   *%eax
+  8016d9:	83 c4 10             	add    $0x10,%esp
+}
+  8016dc:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8016df:	5b                   	pop    %ebx
+  8016e0:	5e                   	pop    %esi
+  8016e1:	5d                   	pop    %ebp
+  8016e2:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8016e3:	a1 44 5b 80 00       	mov    0x805b44,%eax
+  8016e8:	8b 40 48             	mov    0x48(%eax),%eax
+  8016eb:	83 ec 04             	sub    $0x4,%esp
+  8016ee:	56                   	push   %esi
+  8016ef:	50                   	push   %eax
+  8016f0:	68 21 35 80 00       	push   $0x803521
+  8016f5:	e8 a9 ec ff ff       	call   8003a3 <cprintf>
+    return -E_INVAL;
+  8016fa:	83 c4 10             	add    $0x10,%esp
+  8016fd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801702:	eb d8                	jmp    8016dc <read+0x58>
+    return -E_NOT_SUPP;
+  801704:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801709:	eb d1                	jmp    8016dc <read+0x58>
+
+0080170b <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  80170b:	55                   	push   %ebp
+  80170c:	89 e5                	mov    %esp,%ebp
+  80170e:	57                   	push   %edi
+  80170f:	56                   	push   %esi
+  801710:	53                   	push   %ebx
+  801711:	83 ec 0c             	sub    $0xc,%esp
+  801714:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801717:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  80171a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80171f:	eb 02                	jmp    801723 <readn+0x18>
+  801721:	01 c3                	add    %eax,%ebx
+  801723:	39 f3                	cmp    %esi,%ebx
+  801725:	73 21                	jae    801748 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  801727:	83 ec 04             	sub    $0x4,%esp
+  80172a:	89 f0                	mov    %esi,%eax
+  80172c:	29 d8                	sub    %ebx,%eax
+  80172e:	50                   	push   %eax
+  80172f:	89 d8                	mov    %ebx,%eax
+  801731:	03 45 0c             	add    0xc(%ebp),%eax
+  801734:	50                   	push   %eax
+  801735:	57                   	push   %edi
+  801736:	e8 49 ff ff ff       	call   801684 <read>
+    if (m < 0)
+  80173b:	83 c4 10             	add    $0x10,%esp
+  80173e:	85 c0                	test   %eax,%eax
+  801740:	78 04                	js     801746 <readn+0x3b>
+      return m;
+    if (m == 0)
+  801742:	75 dd                	jne    801721 <readn+0x16>
+  801744:	eb 02                	jmp    801748 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  801746:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  801748:	89 d8                	mov    %ebx,%eax
+  80174a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80174d:	5b                   	pop    %ebx
+  80174e:	5e                   	pop    %esi
+  80174f:	5f                   	pop    %edi
+  801750:	5d                   	pop    %ebp
+  801751:	c3                   	ret
+
+00801752 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801752:	55                   	push   %ebp
+  801753:	89 e5                	mov    %esp,%ebp
+  801755:	56                   	push   %esi
+  801756:	53                   	push   %ebx
+  801757:	83 ec 18             	sub    $0x18,%esp
+  80175a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  80175d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801760:	50                   	push   %eax
+  801761:	53                   	push   %ebx
+  801762:	e8 72 fc ff ff       	call   8013d9 <fd_lookup>
+  801767:	83 c4 10             	add    $0x10,%esp
+  80176a:	85 c0                	test   %eax,%eax
+  80176c:	78 37                	js     8017a5 <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80176e:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801771:	83 ec 08             	sub    $0x8,%esp
+  801774:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801777:	50                   	push   %eax
+  801778:	ff 36                	push   (%esi)
+  80177a:	e8 aa fc ff ff       	call   801429 <dev_lookup>
+  80177f:	83 c4 10             	add    $0x10,%esp
+  801782:	85 c0                	test   %eax,%eax
+  801784:	78 1f                	js     8017a5 <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801786:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  80178a:	74 20                	je     8017ac <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  80178c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80178f:	8b 40 0c             	mov    0xc(%eax),%eax
+  801792:	85 c0                	test   %eax,%eax
+  801794:	74 37                	je     8017cd <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  801796:	83 ec 04             	sub    $0x4,%esp
+  801799:	ff 75 10             	push   0x10(%ebp)
+  80179c:	ff 75 0c             	push   0xc(%ebp)
+  80179f:	56                   	push   %esi
+  8017a0:	ff d0                	call   *%eax
+  8017a2:	83 c4 10             	add    $0x10,%esp
+}
+  8017a5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8017a8:	5b                   	pop    %ebx
+  8017a9:	5e                   	pop    %esi
+  8017aa:	5d                   	pop    %ebp
+  8017ab:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8017ac:	a1 44 5b 80 00       	mov    0x805b44,%eax
+  8017b1:	8b 40 48             	mov    0x48(%eax),%eax
+  8017b4:	83 ec 04             	sub    $0x4,%esp
+  8017b7:	53                   	push   %ebx
+  8017b8:	50                   	push   %eax
+  8017b9:	68 3d 35 80 00       	push   $0x80353d
+  8017be:	e8 e0 eb ff ff       	call   8003a3 <cprintf>
+    return -E_INVAL;
+  8017c3:	83 c4 10             	add    $0x10,%esp
+  8017c6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017cb:	eb d8                	jmp    8017a5 <write+0x53>
+    return -E_NOT_SUPP;
+  8017cd:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8017d2:	eb d1                	jmp    8017a5 <write+0x53>
+
+008017d4 <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  8017d4:	55                   	push   %ebp
+  8017d5:	89 e5                	mov    %esp,%ebp
+  8017d7:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8017da:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8017dd:	50                   	push   %eax
+  8017de:	ff 75 08             	push   0x8(%ebp)
+  8017e1:	e8 f3 fb ff ff       	call   8013d9 <fd_lookup>
+  8017e6:	83 c4 10             	add    $0x10,%esp
+  8017e9:	85 c0                	test   %eax,%eax
+  8017eb:	78 0e                	js     8017fb <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  8017ed:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8017f0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8017f3:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  8017f6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017fb:	c9                   	leave
+  8017fc:	c3                   	ret
+
+008017fd <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  8017fd:	55                   	push   %ebp
+  8017fe:	89 e5                	mov    %esp,%ebp
+  801800:	56                   	push   %esi
+  801801:	53                   	push   %ebx
+  801802:	83 ec 18             	sub    $0x18,%esp
+  801805:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801808:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80180b:	50                   	push   %eax
+  80180c:	53                   	push   %ebx
+  80180d:	e8 c7 fb ff ff       	call   8013d9 <fd_lookup>
+  801812:	83 c4 10             	add    $0x10,%esp
+  801815:	85 c0                	test   %eax,%eax
+  801817:	78 34                	js     80184d <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801819:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80181c:	83 ec 08             	sub    $0x8,%esp
+  80181f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801822:	50                   	push   %eax
+  801823:	ff 36                	push   (%esi)
+  801825:	e8 ff fb ff ff       	call   801429 <dev_lookup>
+  80182a:	83 c4 10             	add    $0x10,%esp
+  80182d:	85 c0                	test   %eax,%eax
+  80182f:	78 1c                	js     80184d <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801831:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801835:	74 1d                	je     801854 <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  801837:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80183a:	8b 40 18             	mov    0x18(%eax),%eax
+  80183d:	85 c0                	test   %eax,%eax
+  80183f:	74 34                	je     801875 <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  801841:	83 ec 08             	sub    $0x8,%esp
+  801844:	ff 75 0c             	push   0xc(%ebp)
+  801847:	56                   	push   %esi
+  801848:	ff d0                	call   *%eax
+  80184a:	83 c4 10             	add    $0x10,%esp
+}
+  80184d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801850:	5b                   	pop    %ebx
+  801851:	5e                   	pop    %esi
+  801852:	5d                   	pop    %ebp
+  801853:	c3                   	ret
+            thisenv->env_id, fdnum);
+  801854:	a1 44 5b 80 00       	mov    0x805b44,%eax
+  801859:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80185c:	83 ec 04             	sub    $0x4,%esp
+  80185f:	53                   	push   %ebx
+  801860:	50                   	push   %eax
+  801861:	68 00 35 80 00       	push   $0x803500
+  801866:	e8 38 eb ff ff       	call   8003a3 <cprintf>
+    return -E_INVAL;
+  80186b:	83 c4 10             	add    $0x10,%esp
+  80186e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801873:	eb d8                	jmp    80184d <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  801875:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80187a:	eb d1                	jmp    80184d <ftruncate+0x50>
+
+0080187c <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  80187c:	55                   	push   %ebp
+  80187d:	89 e5                	mov    %esp,%ebp
+  80187f:	56                   	push   %esi
+  801880:	53                   	push   %ebx
+  801881:	83 ec 18             	sub    $0x18,%esp
+  801884:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801887:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  80188a:	50                   	push   %eax
+  80188b:	ff 75 08             	push   0x8(%ebp)
+  80188e:	e8 46 fb ff ff       	call   8013d9 <fd_lookup>
+  801893:	83 c4 10             	add    $0x10,%esp
+  801896:	85 c0                	test   %eax,%eax
+  801898:	78 49                	js     8018e3 <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  80189a:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  80189d:	83 ec 08             	sub    $0x8,%esp
+  8018a0:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018a3:	50                   	push   %eax
+  8018a4:	ff 36                	push   (%esi)
+  8018a6:	e8 7e fb ff ff       	call   801429 <dev_lookup>
+  8018ab:	83 c4 10             	add    $0x10,%esp
+  8018ae:	85 c0                	test   %eax,%eax
+  8018b0:	78 31                	js     8018e3 <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  8018b2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8018b5:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  8018b9:	74 2f                	je     8018ea <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  8018bb:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  8018be:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  8018c5:	00 00 00 
+  stat->st_isdir = 0;
+  8018c8:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8018cf:	00 00 00 
+  stat->st_dev = dev;
+  8018d2:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  8018d8:	83 ec 08             	sub    $0x8,%esp
+  8018db:	53                   	push   %ebx
+  8018dc:	56                   	push   %esi
+  8018dd:	ff 50 14             	call   *0x14(%eax)
+  8018e0:	83 c4 10             	add    $0x10,%esp
+}
+  8018e3:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8018e6:	5b                   	pop    %ebx
+  8018e7:	5e                   	pop    %esi
+  8018e8:	5d                   	pop    %ebp
+  8018e9:	c3                   	ret
+    return -E_NOT_SUPP;
+  8018ea:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  8018ef:	eb f2                	jmp    8018e3 <fstat+0x67>
+
+008018f1 <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  8018f1:	55                   	push   %ebp
+  8018f2:	89 e5                	mov    %esp,%ebp
+  8018f4:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  8018f7:	ff 75 0c             	push   0xc(%ebp)
+  8018fa:	ff 75 08             	push   0x8(%ebp)
+  8018fd:	e8 58 07 00 00       	call   80205a <file_stat>
+}
+  801902:	c9                   	leave
+  801903:	c3                   	ret
+
+00801904 <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  801904:	55                   	push   %ebp
+  801905:	89 e5                	mov    %esp,%ebp
+  801907:	57                   	push   %edi
+  801908:	56                   	push   %esi
+  801909:	53                   	push   %ebx
+  80190a:	83 ec 1c             	sub    $0x1c,%esp
+  80190d:	89 c7                	mov    %eax,%edi
+  80190f:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801912:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801915:	e9 a2 00 00 00       	jmp    8019bc <fsipc_send+0xb8>
+  nfsenvs = 0;
+  80191a:	c7 05 00 54 80 00 00 	movl   $0x0,0x805400
+  801921:	00 00 00 
+  801924:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801929:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  80192e:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801933:	be 01 00 00 00       	mov    $0x1,%esi
+  801938:	eb 0f                	jmp    801949 <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  80193a:	83 c0 01             	add    $0x1,%eax
+  80193d:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801942:	74 49                	je     80198d <fsipc_send+0x89>
+  801944:	83 f9 07             	cmp    $0x7,%ecx
+  801947:	7f 50                	jg     801999 <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  801949:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  80194c:	c1 e2 04             	shl    $0x4,%edx
+  80194f:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801955:	8b 52 50             	mov    0x50(%edx),%edx
+  801958:	83 fa 01             	cmp    $0x1,%edx
+  80195b:	75 dd                	jne    80193a <fsipc_send+0x36>
+  80195d:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801960:	c1 e2 04             	shl    $0x4,%edx
+  801963:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801969:	8b 52 54             	mov    0x54(%edx),%edx
+  80196c:	85 d2                	test   %edx,%edx
+  80196e:	74 ca                	je     80193a <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801970:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801973:	c1 e2 04             	shl    $0x4,%edx
+  801976:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  80197c:	8b 52 48             	mov    0x48(%edx),%edx
+  80197f:	89 14 8d 20 54 80 00 	mov    %edx,0x805420(,%ecx,4)
+  801986:	8d 49 01             	lea    0x1(%ecx),%ecx
+  801989:	89 f3                	mov    %esi,%ebx
+  80198b:	eb ad                	jmp    80193a <fsipc_send+0x36>
+  80198d:	84 db                	test   %bl,%bl
+  80198f:	74 38                	je     8019c9 <fsipc_send+0xc5>
+  801991:	89 0d 00 54 80 00    	mov    %ecx,0x805400
+  801997:	eb 30                	jmp    8019c9 <fsipc_send+0xc5>
+  801999:	84 db                	test   %bl,%bl
+  80199b:	74 2c                	je     8019c9 <fsipc_send+0xc5>
+  80199d:	89 0d 00 54 80 00    	mov    %ecx,0x805400
+  8019a3:	eb 24                	jmp    8019c9 <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  8019a5:	50                   	push   %eax
+  8019a6:	68 6c 35 80 00       	push   $0x80356c
+  8019ab:	6a 34                	push   $0x34
+  8019ad:	68 76 35 80 00       	push   $0x803576
+  8019b2:	e8 11 e9 ff ff       	call   8002c8 <_panic>
+    }
+    sys_yield();
+  8019b7:	e8 92 f4 ff ff       	call   800e4e <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  8019bc:	83 3d 00 54 80 00 03 	cmpl   $0x3,0x805400
+  8019c3:	0f 8e 51 ff ff ff    	jle    80191a <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  8019c9:	a1 44 5b 80 00       	mov    0x805b44,%eax
+  8019ce:	8b 70 48             	mov    0x48(%eax),%esi
+  8019d1:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  8019d7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019dc:	8b 0d 00 54 80 00    	mov    0x805400,%ecx
+  8019e2:	39 d9                	cmp    %ebx,%ecx
+  8019e4:	7e d1                	jle    8019b7 <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  8019e6:	83 ec 0c             	sub    $0xc,%esp
+  8019e9:	ff 75 e0             	push   -0x20(%ebp)
+  8019ec:	6a 07                	push   $0x7
+  8019ee:	ff 75 e4             	push   -0x1c(%ebp)
+  8019f1:	57                   	push   %edi
+  8019f2:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  8019f5:	99                   	cltd
+  8019f6:	f7 f9                	idiv   %ecx
+  8019f8:	ff 34 95 20 54 80 00 	push   0x805420(,%edx,4)
+  8019ff:	e8 63 f7 ff ff       	call   801167 <sys_ipc_try_send>
+      if (r == 0)
+  801a04:	83 c4 20             	add    $0x20,%esp
+  801a07:	85 c0                	test   %eax,%eax
+  801a09:	74 0a                	je     801a15 <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  801a0b:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801a0e:	75 95                	jne    8019a5 <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  801a10:	83 c3 01             	add    $0x1,%ebx
+  801a13:	eb c7                	jmp    8019dc <fsipc_send+0xd8>
+  }
+}
+  801a15:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a18:	5b                   	pop    %ebx
+  801a19:	5e                   	pop    %esi
+  801a1a:	5f                   	pop    %edi
+  801a1b:	5d                   	pop    %ebp
+  801a1c:	c3                   	ret
+
+00801a1d <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801a1d:	55                   	push   %ebp
+  801a1e:	89 e5                	mov    %esp,%ebp
+  801a20:	53                   	push   %ebx
+  801a21:	83 ec 14             	sub    $0x14,%esp
+  801a24:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  801a26:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  801a2d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801a32:	ba 00 60 80 00       	mov    $0x806000,%edx
+  801a37:	e8 c8 fe ff ff       	call   801904 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801a3c:	6a 00                	push   $0x0
+  801a3e:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a41:	50                   	push   %eax
+  801a42:	53                   	push   %ebx
+  801a43:	6a 00                	push   $0x0
+  801a45:	e8 c6 12 00 00       	call   802d10 <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  801a4a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801a4d:	c9                   	leave
+  801a4e:	c3                   	ret
+
+00801a4f <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801a4f:	55                   	push   %ebp
+  801a50:	89 e5                	mov    %esp,%ebp
+  801a52:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801a55:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a58:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a5b:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.set_size.req_size = newsize;
+  801a60:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a63:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801a68:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a6d:	b8 02 00 00 00       	mov    $0x2,%eax
+  801a72:	e8 a6 ff ff ff       	call   801a1d <fsipc>
+}
+  801a77:	c9                   	leave
+  801a78:	c3                   	ret
+
+00801a79 <devfile_flush>:
+{
+  801a79:	55                   	push   %ebp
+  801a7a:	89 e5                	mov    %esp,%ebp
+  801a7c:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801a7f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801a82:	8b 40 0c             	mov    0xc(%eax),%eax
+  801a85:	a3 00 60 80 00       	mov    %eax,0x806000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801a8a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a8f:	b8 06 00 00 00       	mov    $0x6,%eax
+  801a94:	e8 84 ff ff ff       	call   801a1d <fsipc>
+}
+  801a99:	c9                   	leave
+  801a9a:	c3                   	ret
+
+00801a9b <devfile_stat>:
+{
+  801a9b:	55                   	push   %ebp
+  801a9c:	89 e5                	mov    %esp,%ebp
+  801a9e:	53                   	push   %ebx
+  801a9f:	83 ec 04             	sub    $0x4,%esp
+  801aa2:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801aa5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801aa8:	8b 40 0c             	mov    0xc(%eax),%eax
+  801aab:	a3 00 60 80 00       	mov    %eax,0x806000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801ab0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ab5:	b8 05 00 00 00       	mov    $0x5,%eax
+  801aba:	e8 5e ff ff ff       	call   801a1d <fsipc>
+  801abf:	85 c0                	test   %eax,%eax
+  801ac1:	78 2c                	js     801aef <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801ac3:	83 ec 08             	sub    $0x8,%esp
+  801ac6:	68 00 60 80 00       	push   $0x806000
+  801acb:	53                   	push   %ebx
+  801acc:	e8 b0 ef ff ff       	call   800a81 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  801ad1:	a1 80 60 80 00       	mov    0x806080,%eax
+  801ad6:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801adc:	a1 84 60 80 00       	mov    0x806084,%eax
+  801ae1:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801ae7:	83 c4 10             	add    $0x10,%esp
+  801aea:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801aef:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801af2:	c9                   	leave
+  801af3:	c3                   	ret
+
+00801af4 <fsv_alloc>:
+{
+  801af4:	55                   	push   %ebp
+  801af5:	89 e5                	mov    %esp,%ebp
+  801af7:	56                   	push   %esi
+  801af8:	53                   	push   %ebx
+  801af9:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  801afb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b00:	eb 22                	jmp    801b24 <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  801b02:	83 ec 04             	sub    $0x4,%esp
+  801b05:	6a 00                	push   $0x0
+  801b07:	6a 00                	push   $0x0
+  801b09:	6a 07                	push   $0x7
+  801b0b:	50                   	push   %eax
+  801b0c:	6a 00                	push   $0x0
+  801b0e:	6a 04                	push   $0x4
+  801b10:	68 40 54 80 00       	push   $0x805440
+  801b15:	e8 e9 f7 ff ff       	call   801303 <sysbatch_add>
+  801b1a:	83 c4 20             	add    $0x20,%esp
+  801b1d:	85 c0                	test   %eax,%eax
+  801b1f:	78 48                	js     801b69 <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  801b21:	83 c3 01             	add    $0x1,%ebx
+  801b24:	39 f3                	cmp    %esi,%ebx
+  801b26:	74 31                	je     801b59 <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  801b28:	89 d8                	mov    %ebx,%eax
+  801b2a:	c1 e0 0c             	shl    $0xc,%eax
+  801b2d:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801b32:	89 c2                	mov    %eax,%edx
+  801b34:	c1 ea 16             	shr    $0x16,%edx
+  801b37:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801b3e:	f6 c2 01             	test   $0x1,%dl
+  801b41:	74 bf                	je     801b02 <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  801b43:	89 c2                	mov    %eax,%edx
+  801b45:	c1 ea 0c             	shr    $0xc,%edx
+  801b48:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801b4f:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801b52:	83 fa 03             	cmp    $0x3,%edx
+  801b55:	75 ab                	jne    801b02 <fsv_alloc+0xe>
+  801b57:	eb c8                	jmp    801b21 <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  801b59:	83 ec 0c             	sub    $0xc,%esp
+  801b5c:	68 40 54 80 00       	push   $0x805440
+  801b61:	e8 4d f7 ff ff       	call   8012b3 <sysbatch_flush>
+  801b66:	83 c4 10             	add    $0x10,%esp
+}
+  801b69:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b6c:	5b                   	pop    %ebx
+  801b6d:	5e                   	pop    %esi
+  801b6e:	5d                   	pop    %ebp
+  801b6f:	c3                   	ret
+
+00801b70 <devfile_read>:
+{
+  801b70:	55                   	push   %ebp
+  801b71:	89 e5                	mov    %esp,%ebp
+  801b73:	57                   	push   %edi
+  801b74:	56                   	push   %esi
+  801b75:	53                   	push   %ebx
+  801b76:	83 ec 3c             	sub    $0x3c,%esp
+  801b79:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  801b7c:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  801b82:	77 57                	ja     801bdb <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801b84:	8b 45 08             	mov    0x8(%ebp),%eax
+  801b87:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b8a:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read.req_n = n;
+  801b8f:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801b95:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b9a:	b8 03 00 00 00       	mov    $0x3,%eax
+  801b9f:	e8 79 fe ff ff       	call   801a1d <fsipc>
+  801ba4:	89 c6                	mov    %eax,%esi
+  801ba6:	85 c0                	test   %eax,%eax
+  801ba8:	78 27                	js     801bd1 <devfile_read+0x61>
+  assert(r <= n);
+  801baa:	39 c3                	cmp    %eax,%ebx
+  801bac:	0f 82 0e 02 00 00    	jb     801dc0 <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  801bb2:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801bb7:	0f 8f 1c 02 00 00    	jg     801dd9 <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801bbd:	83 ec 04             	sub    $0x4,%esp
+  801bc0:	50                   	push   %eax
+  801bc1:	68 00 60 80 00       	push   $0x806000
+  801bc6:	ff 75 0c             	push   0xc(%ebp)
+  801bc9:	e8 39 f0 ff ff       	call   800c07 <memmove>
+  return r;
+  801bce:	83 c4 10             	add    $0x10,%esp
+}
+  801bd1:	89 f0                	mov    %esi,%eax
+  801bd3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801bd6:	5b                   	pop    %ebx
+  801bd7:	5e                   	pop    %esi
+  801bd8:	5f                   	pop    %edi
+  801bd9:	5d                   	pop    %ebp
+  801bda:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  801bdb:	b8 01 00 00 00       	mov    $0x1,%eax
+  801be0:	e8 0f ff ff ff       	call   801af4 <fsv_alloc>
+  801be5:	89 c6                	mov    %eax,%esi
+  801be7:	85 c0                	test   %eax,%eax
+  801be9:	78 e6                	js     801bd1 <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  801beb:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bee:	8b 40 0c             	mov    0xc(%eax),%eax
+  801bf1:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  801bf6:	8b 45 08             	mov    0x8(%ebp),%eax
+  801bf9:	8b 40 04             	mov    0x4(%eax),%eax
+  801bfc:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  801c01:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  801c07:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801c0e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801c13:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801c18:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801c1d:	e8 e2 fc ff ff       	call   801904 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801c22:	6a 00                	push   $0x0
+  801c24:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801c27:	50                   	push   %eax
+  801c28:	68 00 10 c0 9f       	push   $0x9fc01000
+  801c2d:	6a 00                	push   $0x0
+  801c2f:	e8 dc 10 00 00       	call   802d10 <ipc_recv_pages>
+  801c34:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  801c36:	83 c4 10             	add    $0x10,%esp
+  801c39:	85 c0                	test   %eax,%eax
+  801c3b:	7e 94                	jle    801bd1 <devfile_read+0x61>
+  assert(r <= n);
+  801c3d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801c40:	39 c3                	cmp    %eax,%ebx
+  801c42:	72 2e                	jb     801c72 <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801c44:	8b 45 08             	mov    0x8(%ebp),%eax
+  801c47:	8b 40 04             	mov    0x4(%eax),%eax
+  801c4a:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801c4f:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  801c52:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801c55:	c1 e2 0c             	shl    $0xc,%edx
+  801c58:	39 ca                	cmp    %ecx,%edx
+  801c5a:	72 2f                	jb     801c8b <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  801c5c:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  801c61:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  801c64:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  801c68:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801c6d:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  801c70:	eb 52                	jmp    801cc4 <devfile_read+0x154>
+  assert(r <= n);
+  801c72:	68 81 35 80 00       	push   $0x803581
+  801c77:	68 88 35 80 00       	push   $0x803588
+  801c7c:	68 49 01 00 00       	push   $0x149
+  801c81:	68 76 35 80 00       	push   $0x803576
+  801c86:	e8 3d e6 ff ff       	call   8002c8 <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801c8b:	68 ac 35 80 00       	push   $0x8035ac
+  801c90:	68 88 35 80 00       	push   $0x803588
+  801c95:	68 4a 01 00 00       	push   $0x14a
+  801c9a:	68 76 35 80 00       	push   $0x803576
+  801c9f:	e8 24 e6 ff ff       	call   8002c8 <_panic>
+      memmove(dst + done, src + done, m);
+  801ca4:	83 ec 04             	sub    $0x4,%esp
+  801ca7:	53                   	push   %ebx
+  801ca8:	56                   	push   %esi
+  801ca9:	89 f8                	mov    %edi,%eax
+  801cab:	03 45 0c             	add    0xc(%ebp),%eax
+  801cae:	50                   	push   %eax
+  801caf:	e8 53 ef ff ff       	call   800c07 <memmove>
+  801cb4:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  801cb7:	01 df                	add    %ebx,%edi
+  801cb9:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801cbc:	39 c7                	cmp    %eax,%edi
+  801cbe:	0f 83 c0 00 00 00    	jae    801d84 <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  801cc4:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  801cc7:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  801cca:	89 f0                	mov    %esi,%eax
+  801ccc:	25 ff 0f 00 00       	and    $0xfff,%eax
+  801cd1:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  801cd6:	29 c3                	sub    %eax,%ebx
+  801cd8:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  801cdb:	29 f8                	sub    %edi,%eax
+  801cdd:	39 c3                	cmp    %eax,%ebx
+  801cdf:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  801ce2:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  801ce8:	75 ba                	jne    801ca4 <devfile_read+0x134>
+  801cea:	89 f9                	mov    %edi,%ecx
+  801cec:	03 4d 0c             	add    0xc(%ebp),%ecx
+  801cef:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  801cf2:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  801cf8:	75 aa                	jne    801ca4 <devfile_read+0x134>
+  801cfa:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  801d00:	77 a2                	ja     801ca4 <devfile_read+0x134>
+  801d02:	89 c8                	mov    %ecx,%eax
+  801d04:	c1 e8 16             	shr    $0x16,%eax
+  801d07:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801d0e:	a8 01                	test   $0x1,%al
+  801d10:	74 92                	je     801ca4 <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  801d12:	89 c8                	mov    %ecx,%eax
+  801d14:	c1 e8 0c             	shr    $0xc,%eax
+  801d17:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  801d1e:	a8 01                	test   $0x1,%al
+  801d20:	74 82                	je     801ca4 <devfile_read+0x134>
+  801d22:	a9 02 08 00 00       	test   $0x802,%eax
+  801d27:	0f 84 77 ff ff ff    	je     801ca4 <devfile_read+0x134>
+  801d2d:	f6 c4 04             	test   $0x4,%ah
+  801d30:	0f 85 6e ff ff ff    	jne    801ca4 <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  801d36:	a1 44 5b 80 00       	mov    0x805b44,%eax
+  801d3b:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  801d3f:	84 c0                	test   %al,%al
+  801d41:	75 17                	jne    801d5a <devfile_read+0x1ea>
+  801d43:	83 ec 08             	sub    $0x8,%esp
+  801d46:	6a 01                	push   $0x1
+  801d48:	6a 00                	push   $0x0
+  801d4a:	e8 1e f1 ff ff       	call   800e6d <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  801d4f:	83 c4 10             	add    $0x10,%esp
+  801d52:	85 c0                	test   %eax,%eax
+  801d54:	0f 85 4a ff ff ff    	jne    801ca4 <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  801d5a:	83 ec 04             	sub    $0x4,%esp
+  801d5d:	68 05 08 00 00       	push   $0x805
+  801d62:	ff 75 cc             	push   -0x34(%ebp)
+  801d65:	6a 00                	push   $0x0
+  801d67:	56                   	push   %esi
+  801d68:	6a 00                	push   $0x0
+  801d6a:	6a 05                	push   $0x5
+  801d6c:	68 40 54 80 00       	push   $0x805440
+  801d71:	e8 8d f5 ff ff       	call   801303 <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  801d76:	c1 e8 1f             	shr    $0x1f,%eax
+  801d79:	08 45 cb             	or     %al,-0x35(%ebp)
+  801d7c:	83 c4 20             	add    $0x20,%esp
+  801d7f:	e9 33 ff ff ff       	jmp    801cb7 <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  801d84:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  801d87:	83 ec 0c             	sub    $0xc,%esp
+  801d8a:	68 40 54 80 00       	push   $0x805440
+  801d8f:	e8 1f f5 ff ff       	call   8012b3 <sysbatch_flush>
+  801d94:	83 c4 10             	add    $0x10,%esp
+  801d97:	85 c0                	test   %eax,%eax
+  801d99:	78 06                	js     801da1 <devfile_read+0x231>
+  801d9b:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  801d9f:	74 14                	je     801db5 <devfile_read+0x245>
+    memmove(dst, src, r);
+  801da1:	83 ec 04             	sub    $0x4,%esp
+  801da4:	ff 75 d4             	push   -0x2c(%ebp)
+  801da7:	ff 75 d0             	push   -0x30(%ebp)
+  801daa:	ff 75 0c             	push   0xc(%ebp)
+  801dad:	e8 55 ee ff ff       	call   800c07 <memmove>
+  801db2:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  801db5:	8b 45 08             	mov    0x8(%ebp),%eax
+  801db8:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  801dbb:	e9 11 fe ff ff       	jmp    801bd1 <devfile_read+0x61>
+  assert(r <= n);
+  801dc0:	68 81 35 80 00       	push   $0x803581
+  801dc5:	68 88 35 80 00       	push   $0x803588
+  801dca:	68 1c 01 00 00       	push   $0x11c
+  801dcf:	68 76 35 80 00       	push   $0x803576
+  801dd4:	e8 ef e4 ff ff       	call   8002c8 <_panic>
+  assert(r <= PGSIZE);
+  801dd9:	68 9d 35 80 00       	push   $0x80359d
+  801dde:	68 88 35 80 00       	push   $0x803588
+  801de3:	68 1d 01 00 00       	push   $0x11d
+  801de8:	68 76 35 80 00       	push   $0x803576
+  801ded:	e8 d6 e4 ff ff       	call   8002c8 <_panic>
+
+00801df2 <devfile_write>:
+{
+  801df2:	55                   	push   %ebp
+  801df3:	89 e5                	mov    %esp,%ebp
+  801df5:	57                   	push   %edi
+  801df6:	56                   	push   %esi
+  801df7:	53                   	push   %ebx
+  801df8:	83 ec 1c             	sub    $0x1c,%esp
+  801dfb:	8b 75 08             	mov    0x8(%ebp),%esi
+  801dfe:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  801e01:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  801e06:	77 39                	ja     801e41 <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801e08:	8b 56 0c             	mov    0xc(%esi),%edx
+  801e0b:	89 15 00 60 80 00    	mov    %edx,0x806000
+  fsipcbuf.write.req_n = n;
+  801e11:	a3 04 60 80 00       	mov    %eax,0x806004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  801e16:	83 ec 04             	sub    $0x4,%esp
+  801e19:	50                   	push   %eax
+  801e1a:	ff 75 0c             	push   0xc(%ebp)
+  801e1d:	68 08 60 80 00       	push   $0x806008
+  801e22:	e8 e0 ed ff ff       	call   800c07 <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  801e27:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e2c:	b8 04 00 00 00       	mov    $0x4,%eax
+  801e31:	e8 e7 fb ff ff       	call   801a1d <fsipc>
+  801e36:	83 c4 10             	add    $0x10,%esp
+}
+  801e39:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801e3c:	5b                   	pop    %ebx
+  801e3d:	5e                   	pop    %esi
+  801e3e:	5f                   	pop    %edi
+  801e3f:	5d                   	pop    %ebp
+  801e40:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  801e41:	ba 00 00 10 00       	mov    $0x100000,%edx
+  801e46:	39 d0                	cmp    %edx,%eax
+  801e48:	89 d3                	mov    %edx,%ebx
+  801e4a:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  801e4d:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  801e53:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  801e56:	83 c7 01             	add    $0x1,%edi
+  801e59:	89 f8                	mov    %edi,%eax
+  801e5b:	e8 94 fc ff ff       	call   801af4 <fsv_alloc>
+  801e60:	85 c0                	test   %eax,%eax
+  801e62:	78 d5                	js     801e39 <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  801e64:	83 ec 04             	sub    $0x4,%esp
+  801e67:	53                   	push   %ebx
+  801e68:	ff 75 0c             	push   0xc(%ebp)
+  801e6b:	68 00 10 c0 9f       	push   $0x9fc01000
+  801e70:	e8 92 ed ff ff       	call   800c07 <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  801e75:	8b 46 0c             	mov    0xc(%esi),%eax
+  801e78:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  801e7d:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  801e83:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801e8a:	89 f9                	mov    %edi,%ecx
+  801e8c:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801e91:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801e96:	e8 69 fa ff ff       	call   801904 <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801e9b:	6a 00                	push   $0x0
+  801e9d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801ea0:	50                   	push   %eax
+  801ea1:	6a 00                	push   $0x0
+  801ea3:	6a 00                	push   $0x0
+  801ea5:	e8 66 0e 00 00       	call   802d10 <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  801eaa:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  801ead:	eb 8a                	jmp    801e39 <devfile_write+0x47>
+
+00801eaf <open>:
+{
+  801eaf:	55                   	push   %ebp
+  801eb0:	89 e5                	mov    %esp,%ebp
+  801eb2:	56                   	push   %esi
+  801eb3:	53                   	push   %ebx
+  801eb4:	83 ec 1c             	sub    $0x1c,%esp
+  801eb7:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  801eba:	56                   	push   %esi
+  801ebb:	e8 86 eb ff ff       	call   800a46 <strlen>
+  801ec0:	83 c4 10             	add    $0x10,%esp
+  801ec3:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801ec8:	7f 6c                	jg     801f36 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  801eca:	83 ec 0c             	sub    $0xc,%esp
+  801ecd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801ed0:	50                   	push   %eax
+  801ed1:	e8 ad f4 ff ff       	call   801383 <fd_alloc>
+  801ed6:	89 c3                	mov    %eax,%ebx
+  801ed8:	83 c4 10             	add    $0x10,%esp
+  801edb:	85 c0                	test   %eax,%eax
+  801edd:	78 3c                	js     801f1b <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  801edf:	83 ec 08             	sub    $0x8,%esp
+  801ee2:	56                   	push   %esi
+  801ee3:	68 00 60 80 00       	push   $0x806000
+  801ee8:	e8 94 eb ff ff       	call   800a81 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  801eed:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801ef0:	a3 00 64 80 00       	mov    %eax,0x806400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  801ef5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  801ef8:	b8 01 00 00 00       	mov    $0x1,%eax
+  801efd:	e8 1b fb ff ff       	call   801a1d <fsipc>
+  801f02:	89 c3                	mov    %eax,%ebx
+  801f04:	83 c4 10             	add    $0x10,%esp
+  801f07:	85 c0                	test   %eax,%eax
+  801f09:	78 19                	js     801f24 <open+0x75>
+  return fd2num(fd);
+  801f0b:	83 ec 0c             	sub    $0xc,%esp
+  801f0e:	ff 75 f4             	push   -0xc(%ebp)
+  801f11:	e8 49 f4 ff ff       	call   80135f <fd2num>
+  801f16:	89 c3                	mov    %eax,%ebx
+  801f18:	83 c4 10             	add    $0x10,%esp
+}
+  801f1b:	89 d8                	mov    %ebx,%eax
+  801f1d:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f20:	5b                   	pop    %ebx
+  801f21:	5e                   	pop    %esi
+  801f22:	5d                   	pop    %ebp
+  801f23:	c3                   	ret
+    fd_close(fd, 0);
+  801f24:	83 ec 08             	sub    $0x8,%esp
+  801f27:	6a 00                	push   $0x0
+  801f29:	ff 75 f4             	push   -0xc(%ebp)
+  801f2c:	e8 44 f5 ff ff       	call   801475 <fd_close>
+    return r;
+  801f31:	83 c4 10             	add    $0x10,%esp
+  801f34:	eb e5                	jmp    801f1b <open+0x6c>
+    return -E_BAD_PATH;
+  801f36:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  801f3b:	eb de                	jmp    801f1b <open+0x6c>
+
+00801f3d <open_read>:
+{
+  801f3d:	55                   	push   %ebp
+  801f3e:	89 e5                	mov    %esp,%ebp
+  801f40:	57                   	push   %edi
+  801f41:	56                   	push   %esi
+  801f42:	53                   	push   %ebx
+  801f43:	83 ec 28             	sub    $0x28,%esp
+  801f46:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  801f49:	57                   	push   %edi
+  801f4a:	e8 f7 ea ff ff       	call   800a46 <strlen>
+  801f4f:	83 c4 10             	add    $0x10,%esp
+  801f52:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  801f57:	0f 87 f6 00 00 00    	ja     802053 <open_read+0x116>
+  801f5d:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  801f5f:	83 ec 0c             	sub    $0xc,%esp
+  801f62:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801f65:	50                   	push   %eax
+  801f66:	e8 18 f4 ff ff       	call   801383 <fd_alloc>
+  801f6b:	89 c3                	mov    %eax,%ebx
+  801f6d:	83 c4 10             	add    $0x10,%esp
+  801f70:	85 c0                	test   %eax,%eax
+  801f72:	0f 88 b2 00 00 00    	js     80202a <open_read+0xed>
+  strcpy(req->req_buf, path);
+  801f78:	83 ec 08             	sub    $0x8,%esp
+  801f7b:	57                   	push   %edi
+  801f7c:	68 e4 60 80 00       	push   $0x8060e4
+  801f81:	e8 fb ea ff ff       	call   800a81 <strcpy>
+  req->req_nops = 2;
+  801f86:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  801f8d:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  801f90:	c7 05 04 60 80 00 01 	movl   $0x1,0x806004
+  801f97:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  801f9a:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801f9d:	a3 10 60 80 00       	mov    %eax,0x806010
+  req->req_ops[0].op_buf = 0;
+  801fa2:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  801fa9:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  801fac:	c7 05 20 60 80 00 04 	movl   $0x4,0x806020
+  801fb3:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  801fb6:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  801fbd:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  801fc0:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  801fc5:	29 f0                	sub    %esi,%eax
+  801fc7:	3b 45 14             	cmp    0x14(%ebp),%eax
+  801fca:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  801fce:	a3 2c 60 80 00       	mov    %eax,0x80602c
+  req->req_ops[1].op_offset = 0;
+  801fd3:	c7 05 30 60 80 00 00 	movl   $0x0,0x806030
+  801fda:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  801fdd:	83 c6 01             	add    $0x1,%esi
+  801fe0:	89 35 34 60 80 00    	mov    %esi,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  801fe6:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  801fe9:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801fee:	e8 2a fa ff ff       	call   801a1d <fsipc>
+  801ff3:	89 c3                	mov    %eax,%ebx
+  801ff5:	83 c4 10             	add    $0x10,%esp
+  801ff8:	83 f8 01             	cmp    $0x1,%eax
+  801ffb:	7e 37                	jle    802034 <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  801ffd:	a1 38 60 80 00       	mov    0x806038,%eax
+  802002:	8b 55 18             	mov    0x18(%ebp),%edx
+  802005:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  802007:	83 ec 04             	sub    $0x4,%esp
+  80200a:	50                   	push   %eax
+  80200b:	81 c6 e4 60 80 00    	add    $0x8060e4,%esi
+  802011:	56                   	push   %esi
+  802012:	ff 75 10             	push   0x10(%ebp)
+  802015:	e8 ed eb ff ff       	call   800c07 <memmove>
+  return fd2num(fd);
+  80201a:	83 c4 04             	add    $0x4,%esp
+  80201d:	ff 75 e4             	push   -0x1c(%ebp)
+  802020:	e8 3a f3 ff ff       	call   80135f <fd2num>
+  802025:	89 c3                	mov    %eax,%ebx
+  802027:	83 c4 10             	add    $0x10,%esp
+}
+  80202a:	89 d8                	mov    %ebx,%eax
+  80202c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80202f:	5b                   	pop    %ebx
+  802030:	5e                   	pop    %esi
+  802031:	5f                   	pop    %edi
+  802032:	5d                   	pop    %ebp
+  802033:	c3                   	ret
+    fd_close(fd, 0);
+  802034:	83 ec 08             	sub    $0x8,%esp
+  802037:	6a 00                	push   $0x0
+  802039:	ff 75 e4             	push   -0x1c(%ebp)
+  80203c:	e8 34 f4 ff ff       	call   801475 <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  802041:	83 c4 10             	add    $0x10,%esp
+  802044:	85 db                	test   %ebx,%ebx
+  802046:	78 e2                	js     80202a <open_read+0xed>
+  802048:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  80204b:	8b 9b 1c 60 80 00    	mov    0x80601c(%ebx),%ebx
+  802051:	eb d7                	jmp    80202a <open_read+0xed>
+    return -E_BAD_PATH;
+  802053:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802058:	eb d0                	jmp    80202a <open_read+0xed>
+
+0080205a <file_stat>:
+{
+  80205a:	55                   	push   %ebp
+  80205b:	89 e5                	mov    %esp,%ebp
+  80205d:	57                   	push   %edi
+  80205e:	56                   	push   %esi
+  80205f:	53                   	push   %ebx
+  802060:	83 ec 18             	sub    $0x18,%esp
+  802063:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802066:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  802069:	57                   	push   %edi
+  80206a:	e8 d7 e9 ff ff       	call   800a46 <strlen>
+  80206f:	83 c4 10             	add    $0x10,%esp
+  802072:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802077:	0f 8f c7 00 00 00    	jg     802144 <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  80207d:	83 ec 0c             	sub    $0xc,%esp
+  802080:	57                   	push   %edi
+  802081:	e8 c0 e9 ff ff       	call   800a46 <strlen>
+  802086:	8d 58 04             	lea    0x4(%eax),%ebx
+  802089:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  80208c:	83 c4 08             	add    $0x8,%esp
+  80208f:	57                   	push   %edi
+  802090:	68 e4 60 80 00       	push   $0x8060e4
+  802095:	e8 e7 e9 ff ff       	call   800a81 <strcpy>
+  req->req_nops = 2;
+  80209a:	c7 05 00 60 80 00 02 	movl   $0x2,0x806000
+  8020a1:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  8020a4:	c7 05 04 60 80 00 02 	movl   $0x2,0x806004
+  8020ab:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  8020ae:	c7 05 10 60 80 00 00 	movl   $0x0,0x806010
+  8020b5:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  8020b8:	c7 05 18 60 80 00 00 	movl   $0x0,0x806018
+  8020bf:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  8020c2:	c7 05 20 60 80 00 03 	movl   $0x3,0x806020
+  8020c9:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  8020cc:	c7 05 24 60 80 00 01 	movl   $0x1,0x806024
+  8020d3:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  8020d6:	89 1d 34 60 80 00    	mov    %ebx,0x806034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  8020dc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020e1:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8020e6:	e8 32 f9 ff ff       	call   801a1d <fsipc>
+  8020eb:	83 c4 10             	add    $0x10,%esp
+  8020ee:	83 f8 01             	cmp    $0x1,%eax
+  8020f1:	7e 42                	jle    802135 <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  8020f3:	81 c3 e4 60 80 00    	add    $0x8060e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  8020f9:	83 ec 08             	sub    $0x8,%esp
+  8020fc:	53                   	push   %ebx
+  8020fd:	56                   	push   %esi
+  8020fe:	e8 7e e9 ff ff       	call   800a81 <strcpy>
+  st->st_size = ret->ret_size;
+  802103:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  802109:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  80210f:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  802115:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  80211b:	c7 86 88 00 00 00 20 	movl   $0x804020,0x88(%esi)
+  802122:	40 80 00 
+  return 0;
+  802125:	83 c4 10             	add    $0x10,%esp
+  802128:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80212d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802130:	5b                   	pop    %ebx
+  802131:	5e                   	pop    %esi
+  802132:	5f                   	pop    %edi
+  802133:	5d                   	pop    %ebp
+  802134:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  802135:	85 c0                	test   %eax,%eax
+  802137:	78 f4                	js     80212d <file_stat+0xd3>
+  802139:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  80213c:	8b 80 1c 60 80 00    	mov    0x80601c(%eax),%eax
+  802142:	eb e9                	jmp    80212d <file_stat+0xd3>
+    return -E_BAD_PATH;
+  802144:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802149:	eb e2                	jmp    80212d <file_stat+0xd3>
+
+0080214b <read_map>:
+{
+  80214b:	55                   	push   %ebp
+  80214c:	89 e5                	mov    %esp,%ebp
+  80214e:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802151:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802154:	50                   	push   %eax
+  802155:	ff 75 08             	push   0x8(%ebp)
+  802158:	e8 7c f2 ff ff       	call   8013d9 <fd_lookup>
+  80215d:	83 c4 10             	add    $0x10,%esp
+  802160:	85 c0                	test   %eax,%eax
+  802162:	78 2a                	js     80218e <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  802164:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802167:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  80216d:	39 08                	cmp    %ecx,(%eax)
+  80216f:	75 1f                	jne    802190 <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  802171:	8b 40 0c             	mov    0xc(%eax),%eax
+  802174:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.read_map.req_offset = offset;
+  802179:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80217c:	a3 04 60 80 00       	mov    %eax,0x806004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  802181:	8b 55 10             	mov    0x10(%ebp),%edx
+  802184:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802189:	e8 8f f8 ff ff       	call   801a1d <fsipc>
+}
+  80218e:	c9                   	leave
+  80218f:	c3                   	ret
+    return -E_INVAL;
+  802190:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802195:	eb f7                	jmp    80218e <read_map+0x43>
+
+00802197 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802197:	55                   	push   %ebp
+  802198:	89 e5                	mov    %esp,%ebp
+  80219a:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  80219d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021a2:	b8 08 00 00 00       	mov    $0x8,%eax
+  8021a7:	e8 71 f8 ff ff       	call   801a1d <fsipc>
+}
+  8021ac:	c9                   	leave
+  8021ad:	c3                   	ret
+
+008021ae <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  8021ae:	55                   	push   %ebp
+  8021af:	89 e5                	mov    %esp,%ebp
+  8021b1:	57                   	push   %edi
+  8021b2:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  8021b3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8021b6:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.stats.req_bio_sched = 0;
+  8021bb:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  8021c2:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  8021c5:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  8021cc:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  8021cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021d4:	b8 09 00 00 00       	mov    $0x9,%eax
+  8021d9:	e8 3f f8 ff ff       	call   801a1d <fsipc>
+  8021de:	85 c0                	test   %eax,%eax
+  8021e0:	78 14                	js     8021f6 <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  8021e2:	be 00 60 80 00       	mov    $0x806000,%esi
+  8021e7:	b9 16 00 00 00       	mov    $0x16,%ecx
+  8021ec:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8021ef:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  8021f1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8021f6:	5e                   	pop    %esi
+  8021f7:	5f                   	pop    %edi
+  8021f8:	5d                   	pop    %ebp
+  8021f9:	c3                   	ret
+
+008021fa <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  8021fa:	55                   	push   %ebp
+  8021fb:	89 e5                	mov    %esp,%ebp
+  8021fd:	53                   	push   %ebx
+  8021fe:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  802201:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802204:	50                   	push   %eax
+  802205:	6a 00                	push   $0x0
+  802207:	e8 a2 ff ff ff       	call   8021ae <fs_stats>
+  80220c:	83 c4 10             	add    $0x10,%esp
+  80220f:	85 c0                	test   %eax,%eax
+  802211:	78 28                	js     80223b <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  802213:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  802216:	83 ec 08             	sub    $0x8,%esp
+  802219:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  80221c:	50                   	push   %eax
+  80221d:	6a 20                	push   $0x20
+  80221f:	e8 8a ff ff ff       	call   8021ae <fs_stats>
+  802224:	83 c4 10             	add    $0x10,%esp
+  802227:	85 c0                	test   %eax,%eax
+  802229:	78 10                	js     80223b <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  80222b:	83 ec 08             	sub    $0x8,%esp
+  80222e:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  802231:	50                   	push   %eax
+  802232:	53                   	push   %ebx
+  802233:	e8 76 ff ff ff       	call   8021ae <fs_stats>
+  802238:	83 c4 10             	add    $0x10,%esp
+}
+  80223b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80223e:	c9                   	leave
+  80223f:	c3                   	ret
+
+00802240 <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  802240:	55                   	push   %ebp
+  802241:	89 e5                	mov    %esp,%ebp
+  802243:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  802246:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  80224d:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  802250:	8b 45 08             	mov    0x8(%ebp),%eax
+  802253:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.stats.req_dcache = 0;
+  802258:	c7 05 08 60 80 00 00 	movl   $0x0,0x806008
+  80225f:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  802262:	ba 00 00 00 00       	mov    $0x0,%edx
+  802267:	b8 09 00 00 00       	mov    $0x9,%eax
+  80226c:	e8 ac f7 ff ff       	call   801a1d <fsipc>
+}
+  802271:	c9                   	leave
+  802272:	c3                   	ret
+
+00802273 <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  802273:	55                   	push   %ebp
+  802274:	89 e5                	mov    %esp,%ebp
+  802276:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  802279:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  802280:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  802283:	c7 05 04 60 80 00 00 	movl   $0x0,0x806004
+  80228a:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  80228d:	8b 45 08             	mov    0x8(%ebp),%eax
+  802290:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_STATS, NULL);
+  802295:	ba 00 00 00 00       	mov    $0x0,%edx
+  80229a:	b8 09 00 00 00       	mov    $0x9,%eax
+  80229f:	e8 79 f7 ff ff       	call   801a1d <fsipc>
+}
+  8022a4:	c9                   	leave
+  8022a5:	c3                   	ret
+
+008022a6 <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  8022a6:	55                   	push   %ebp
+  8022a7:	89 e5                	mov    %esp,%ebp
+  8022a9:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8022ac:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8022af:	50                   	push   %eax
+  8022b0:	ff 75 08             	push   0x8(%ebp)
+  8022b3:	e8 21 f1 ff ff       	call   8013d9 <fd_lookup>
+  8022b8:	83 c4 10             	add    $0x10,%esp
+  8022bb:	85 c0                	test   %eax,%eax
+  8022bd:	78 34                	js     8022f3 <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  8022bf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8022c2:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  8022c8:	39 08                	cmp    %ecx,(%eax)
+  8022ca:	75 29                	jne    8022f5 <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  8022cc:	8b 40 0c             	mov    0xc(%eax),%eax
+  8022cf:	a3 00 60 80 00       	mov    %eax,0x806000
+  fsipcbuf.fallocate.req_offset = offset;
+  8022d4:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022d7:	a3 04 60 80 00       	mov    %eax,0x806004
+  fsipcbuf.fallocate.req_len = len;
+  8022dc:	8b 45 10             	mov    0x10(%ebp),%eax
+  8022df:	a3 08 60 80 00       	mov    %eax,0x806008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  8022e4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022e9:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8022ee:	e8 2a f7 ff ff       	call   801a1d <fsipc>
+}
+  8022f3:	c9                   	leave
+  8022f4:	c3                   	ret
+    return -E_INVAL;
+  8022f5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8022fa:	eb f7                	jmp    8022f3 <fallocate+0x4d>
+
+008022fc <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  8022fc:	55                   	push   %ebp
+  8022fd:	89 e5                	mov    %esp,%ebp
+  8022ff:	57                   	push   %edi
+  802300:	56                   	push   %esi
+  802301:	53                   	push   %ebx
+  802302:	83 ec 24             	sub    $0x24,%esp
+  802305:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802308:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80230b:	50                   	push   %eax
+  80230c:	ff 75 08             	push   0x8(%ebp)
+  80230f:	e8 c5 f0 ff ff       	call   8013d9 <fd_lookup>
+  802314:	83 c4 10             	add    $0x10,%esp
+  802317:	85 c0                	test   %eax,%eax
+  802319:	78 66                	js     802381 <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  80231b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80231e:	8b 0d 20 40 80 00    	mov    0x804020,%ecx
+  802324:	39 08                	cmp    %ecx,(%eax)
+  802326:	75 61                	jne    802389 <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  802328:	85 f6                	test   %esi,%esi
+  80232a:	7e 50                	jle    80237c <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  80232c:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  802331:	39 de                	cmp    %ebx,%esi
+  802333:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  802336:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802339:	8b 40 0c             	mov    0xc(%eax),%eax
+  80233c:	a3 00 60 80 00       	mov    %eax,0x806000
+    fsipcbuf.prefetch.req_n = m;
+  802341:	89 1d 04 60 80 00    	mov    %ebx,0x806004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  802347:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  80234e:	83 ec 04             	sub    $0x4,%esp
+  802351:	57                   	push   %edi
+  802352:	ff 75 0c             	push   0xc(%ebp)
+  802355:	68 08 60 80 00       	push   $0x806008
+  80235a:	e8 a8 e8 ff ff       	call   800c07 <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  80235f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802364:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802369:	e8 af f6 ff ff       	call   801a1d <fsipc>
+  80236e:	83 c4 10             	add    $0x10,%esp
+  802371:	85 c0                	test   %eax,%eax
+  802373:	78 0c                	js     802381 <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  802375:	01 7d 0c             	add    %edi,0xc(%ebp)
+  802378:	29 de                	sub    %ebx,%esi
+  80237a:	eb ac                	jmp    802328 <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  80237c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802381:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802384:	5b                   	pop    %ebx
+  802385:	5e                   	pop    %esi
+  802386:	5f                   	pop    %edi
+  802387:	5d                   	pop    %ebp
+  802388:	c3                   	ret
+    return -E_INVAL;
+  802389:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80238e:	eb f1                	jmp    802381 <prefetch+0x85>
+
+00802390 <writebuf>:
+
+
+static void
+writebuf(struct printbuf *b)
+{
+  if (b->error > 0) {
+  802390:	83 78 0c 00          	cmpl   $0x0,0xc(%eax)
+  802394:	7f 01                	jg     802397 <writebuf+0x7>
+  802396:	c3                   	ret
+{
+  802397:	55                   	push   %ebp
+  802398:	89 e5                	mov    %esp,%ebp
+  80239a:	53                   	push   %ebx
+  80239b:	83 ec 08             	sub    $0x8,%esp
+  80239e:	89 c3                	mov    %eax,%ebx
+    ssize_t result = write(b->fd, b->buf, b->idx);
+  8023a0:	ff 70 04             	push   0x4(%eax)
+  8023a3:	8d 40 10             	lea    0x10(%eax),%eax
+  8023a6:	50                   	push   %eax
+  8023a7:	ff 33                	push   (%ebx)
+  8023a9:	e8 a4 f3 ff ff       	call   801752 <write>
+    if (result > 0)
+  8023ae:	83 c4 10             	add    $0x10,%esp
+  8023b1:	85 c0                	test   %eax,%eax
+  8023b3:	7e 03                	jle    8023b8 <writebuf+0x28>
+      b->result += result;
+  8023b5:	01 43 08             	add    %eax,0x8(%ebx)
+    if (result != b->idx)             // error, or wrote less than supplied
+  8023b8:	39 43 04             	cmp    %eax,0x4(%ebx)
+  8023bb:	74 0d                	je     8023ca <writebuf+0x3a>
+      b->error = (result < 0 ? result : 0);
+  8023bd:	85 c0                	test   %eax,%eax
+  8023bf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023c4:	0f 4f c2             	cmovg  %edx,%eax
+  8023c7:	89 43 0c             	mov    %eax,0xc(%ebx)
+  }
+}
+  8023ca:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023cd:	c9                   	leave
+  8023ce:	c3                   	ret
+
+008023cf <putch>:
+
+static void
+putch(int ch, void *thunk)
+{
+  8023cf:	55                   	push   %ebp
+  8023d0:	89 e5                	mov    %esp,%ebp
+  8023d2:	53                   	push   %ebx
+  8023d3:	83 ec 04             	sub    $0x4,%esp
+  8023d6:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct printbuf *b = (struct printbuf *)thunk;
+
+  b->buf[b->idx++] = ch;
+  8023d9:	8b 53 04             	mov    0x4(%ebx),%edx
+  8023dc:	8d 42 01             	lea    0x1(%edx),%eax
+  8023df:	89 43 04             	mov    %eax,0x4(%ebx)
+  8023e2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  8023e5:	88 4c 13 10          	mov    %cl,0x10(%ebx,%edx,1)
+  if (b->idx == 256) {
+  8023e9:	3d 00 01 00 00       	cmp    $0x100,%eax
+  8023ee:	74 05                	je     8023f5 <putch+0x26>
+    writebuf(b);
+    b->idx = 0;
+  }
+}
+  8023f0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8023f3:	c9                   	leave
+  8023f4:	c3                   	ret
+    writebuf(b);
+  8023f5:	89 d8                	mov    %ebx,%eax
+  8023f7:	e8 94 ff ff ff       	call   802390 <writebuf>
+    b->idx = 0;
+  8023fc:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%ebx)
+}
+  802403:	eb eb                	jmp    8023f0 <putch+0x21>
+
+00802405 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap)
+{
+  802405:	55                   	push   %ebp
+  802406:	89 e5                	mov    %esp,%ebp
+  802408:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.fd = fd;
+  80240e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802411:	89 85 e8 fe ff ff    	mov    %eax,-0x118(%ebp)
+  b.idx = 0;
+  802417:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%ebp)
+  80241e:	00 00 00 
+  b.result = 0;
+  802421:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  802428:	00 00 00 
+  b.error = 1;
+  80242b:	c7 85 f4 fe ff ff 01 	movl   $0x1,-0x10c(%ebp)
+  802432:	00 00 00 
+  vprintfmt(putch, &b, fmt, ap);
+  802435:	ff 75 10             	push   0x10(%ebp)
+  802438:	ff 75 0c             	push   0xc(%ebp)
+  80243b:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  802441:	50                   	push   %eax
+  802442:	68 cf 23 80 00       	push   $0x8023cf
+  802447:	e8 4e e0 ff ff       	call   80049a <vprintfmt>
+  if (b.idx > 0)
+  80244c:	83 c4 10             	add    $0x10,%esp
+  80244f:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%ebp)
+  802456:	7f 12                	jg     80246a <vfprintf+0x65>
+    writebuf(&b);
+
+  return b.result ? b.result : b.error;
+  802458:	8b 85 f0 fe ff ff    	mov    -0x110(%ebp),%eax
+  80245e:	85 c0                	test   %eax,%eax
+  802460:	75 06                	jne    802468 <vfprintf+0x63>
+  802462:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+}
+  802468:	c9                   	leave
+  802469:	c3                   	ret
+    writebuf(&b);
+  80246a:	8d 85 e8 fe ff ff    	lea    -0x118(%ebp),%eax
+  802470:	e8 1b ff ff ff       	call   802390 <writebuf>
+  802475:	eb e1                	jmp    802458 <vfprintf+0x53>
+
+00802477 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...)
+{
+  802477:	55                   	push   %ebp
+  802478:	89 e5                	mov    %esp,%ebp
+  80247a:	83 ec 0c             	sub    $0xc,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  80247d:	8d 45 10             	lea    0x10(%ebp),%eax
+  cnt = vfprintf(fd, fmt, ap);
+  802480:	50                   	push   %eax
+  802481:	ff 75 0c             	push   0xc(%ebp)
+  802484:	ff 75 08             	push   0x8(%ebp)
+  802487:	e8 79 ff ff ff       	call   802405 <vfprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  80248c:	c9                   	leave
+  80248d:	c3                   	ret
+
+0080248e <printf>:
+
+int
+printf(const char *fmt, ...)
+{
+  80248e:	55                   	push   %ebp
+  80248f:	89 e5                	mov    %esp,%ebp
+  802491:	83 ec 0c             	sub    $0xc,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  802494:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vfprintf(1, fmt, ap);
+  802497:	50                   	push   %eax
+  802498:	ff 75 08             	push   0x8(%ebp)
+  80249b:	6a 01                	push   $0x1
+  80249d:	e8 63 ff ff ff       	call   802405 <vfprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  8024a2:	c9                   	leave
+  8024a3:	c3                   	ret
+
+008024a4 <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  8024a4:	55                   	push   %ebp
+  8024a5:	89 e5                	mov    %esp,%ebp
+  8024a7:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  8024aa:	50                   	push   %eax
+  8024ab:	e8 bf ee ff ff       	call   80136f <fd2data>
+  8024b0:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  8024b5:	c9                   	leave
+  8024b6:	c3                   	ret
+
+008024b7 <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  8024b7:	55                   	push   %ebp
+  8024b8:	89 e5                	mov    %esp,%ebp
+  8024ba:	56                   	push   %esi
+  8024bb:	53                   	push   %ebx
+  8024bc:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  8024bf:	83 ec 0c             	sub    $0xc,%esp
+  8024c2:	ff 75 08             	push   0x8(%ebp)
+  8024c5:	e8 a5 ee ff ff       	call   80136f <fd2data>
+  8024ca:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  8024cc:	83 c4 08             	add    $0x8,%esp
+  8024cf:	68 d8 35 80 00       	push   $0x8035d8
+  8024d4:	53                   	push   %ebx
+  8024d5:	e8 a7 e5 ff ff       	call   800a81 <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  8024da:	8b 46 04             	mov    0x4(%esi),%eax
+  8024dd:	2b 06                	sub    (%esi),%eax
+  8024df:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  8024e5:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  8024ec:	00 00 00 
+  stat->st_dev = &devpipe;
+  8024ef:	c7 83 88 00 00 00 3c 	movl   $0x80403c,0x88(%ebx)
+  8024f6:	40 80 00 
+  return 0;
+}
+  8024f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024fe:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  802501:	5b                   	pop    %ebx
+  802502:	5e                   	pop    %esi
+  802503:	5d                   	pop    %ebp
+  802504:	c3                   	ret
+
+00802505 <pipe_wakeup>:
+{
+  802505:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  802507:	b8 00 00 00 00       	mov    $0x0,%eax
+  80250c:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  80250f:	85 c0                	test   %eax,%eax
+  802511:	75 01                	jne    802514 <pipe_wakeup+0xf>
+  802513:	c3                   	ret
+{
+  802514:	55                   	push   %ebp
+  802515:	89 e5                	mov    %esp,%ebp
+  802517:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  80251a:	6a 00                	push   $0x0
+  80251c:	68 00 00 c0 ee       	push   $0xeec00000
+  802521:	52                   	push   %edx
+  802522:	e8 e5 ec ff ff       	call   80120c <sys_chan_wakeup>
+  802527:	83 c4 10             	add    $0x10,%esp
+}
+  80252a:	c9                   	leave
+  80252b:	c3                   	ret
+
+0080252c <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  80252c:	55                   	push   %ebp
+  80252d:	89 e5                	mov    %esp,%ebp
+  80252f:	57                   	push   %edi
+  802530:	56                   	push   %esi
+  802531:	53                   	push   %ebx
+  802532:	83 ec 18             	sub    $0x18,%esp
+  802535:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  802538:	57                   	push   %edi
+  802539:	e8 31 ee ff ff       	call   80136f <fd2data>
+  80253e:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  802540:	83 c4 10             	add    $0x10,%esp
+  802543:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  802547:	74 2a                	je     802573 <devpipe_close+0x47>
+  802549:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  80254e:	89 f8                	mov    %edi,%eax
+  802550:	e8 4f ff ff ff       	call   8024a4 <pipe_ring>
+  802555:	83 ec 08             	sub    $0x8,%esp
+  802558:	01 d8                	add    %ebx,%eax
+  80255a:	50                   	push   %eax
+  80255b:	6a 00                	push   $0x0
+  80255d:	e8 d3 e9 ff ff       	call   800f35 <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  802562:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  802568:	83 c4 10             	add    $0x10,%esp
+  80256b:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  802571:	75 db                	jne    80254e <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  802573:	83 ec 08             	sub    $0x8,%esp
+  802576:	57                   	push   %edi
+  802577:	6a 00                	push   $0x0
+  802579:	e8 b7 e9 ff ff       	call   800f35 <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  80257e:	83 c4 10             	add    $0x10,%esp
+  802581:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  802585:	75 13                	jne    80259a <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  802587:	83 ec 08             	sub    $0x8,%esp
+  80258a:	56                   	push   %esi
+  80258b:	6a 00                	push   $0x0
+  80258d:	e8 a3 e9 ff ff       	call   800f35 <sys_page_unmap>
+}
+  802592:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802595:	5b                   	pop    %ebx
+  802596:	5e                   	pop    %esi
+  802597:	5f                   	pop    %edi
+  802598:	5d                   	pop    %ebp
+  802599:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  80259a:	8d 56 04             	lea    0x4(%esi),%edx
+  80259d:	8d 46 2c             	lea    0x2c(%esi),%eax
+  8025a0:	e8 60 ff ff ff       	call   802505 <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8025a5:	8d 46 30             	lea    0x30(%esi),%eax
+  8025a8:	89 f2                	mov    %esi,%edx
+  8025aa:	e8 56 ff ff ff       	call   802505 <pipe_wakeup>
+  8025af:	eb d6                	jmp    802587 <devpipe_close+0x5b>
+
+008025b1 <_pipeisclosed>:
+{
+  8025b1:	55                   	push   %ebp
+  8025b2:	89 e5                	mov    %esp,%ebp
+  8025b4:	57                   	push   %edi
+  8025b5:	56                   	push   %esi
+  8025b6:	53                   	push   %ebx
+  8025b7:	83 ec 1c             	sub    $0x1c,%esp
+  8025ba:	89 c7                	mov    %eax,%edi
+  8025bc:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  8025be:	a1 44 5b 80 00       	mov    0x805b44,%eax
+  8025c3:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  8025c6:	83 ec 0c             	sub    $0xc,%esp
+  8025c9:	57                   	push   %edi
+  8025ca:	e8 a4 08 00 00       	call   802e73 <pageref>
+  8025cf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  8025d2:	89 34 24             	mov    %esi,(%esp)
+  8025d5:	e8 99 08 00 00       	call   802e73 <pageref>
+    nn = thisenv->env_runs;
+  8025da:	8b 15 44 5b 80 00    	mov    0x805b44,%edx
+  8025e0:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  8025e3:	83 c4 10             	add    $0x10,%esp
+  8025e6:	39 cb                	cmp    %ecx,%ebx
+  8025e8:	74 1b                	je     802605 <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  8025ea:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8025ed:	75 cf                	jne    8025be <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  8025ef:	8b 42 58             	mov    0x58(%edx),%eax
+  8025f2:	6a 01                	push   $0x1
+  8025f4:	50                   	push   %eax
+  8025f5:	53                   	push   %ebx
+  8025f6:	68 df 35 80 00       	push   $0x8035df
+  8025fb:	e8 a3 dd ff ff       	call   8003a3 <cprintf>
+  802600:	83 c4 10             	add    $0x10,%esp
+  802603:	eb b9                	jmp    8025be <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  802605:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802608:	0f 94 c0             	sete   %al
+  80260b:	0f b6 c0             	movzbl %al,%eax
+}
+  80260e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802611:	5b                   	pop    %ebx
+  802612:	5e                   	pop    %esi
+  802613:	5f                   	pop    %edi
+  802614:	5d                   	pop    %ebp
+  802615:	c3                   	ret
+
+00802616 <devpipe_write_bulk>:
+{
+  802616:	55                   	push   %ebp
+  802617:	89 e5                	mov    %esp,%ebp
+  802619:	57                   	push   %edi
+  80261a:	56                   	push   %esi
+  80261b:	53                   	push   %ebx
+  80261c:	83 ec 1c             	sub    $0x1c,%esp
+  80261f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  802622:	89 d6                	mov    %edx,%esi
+  802624:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  802627:	e8 78 fe ff ff       	call   8024a4 <pipe_ring>
+  80262c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  80262f:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802634:	8d 46 04             	lea    0x4(%esi),%eax
+  802637:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  80263a:	eb 75                	jmp    8026b1 <devpipe_write_bulk+0x9b>
+  80263c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802641:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802645:	6a 64                	push   $0x64
+  802647:	68 00 00 c0 ee       	push   $0xeec00000
+  80264c:	53                   	push   %ebx
+  80264d:	56                   	push   %esi
+  80264e:	e8 96 eb ff ff       	call   8011e9 <sys_chan_sleep>
+      continue;
+  802653:	83 c4 10             	add    $0x10,%esp
+  802656:	eb 59                	jmp    8026b1 <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  802658:	89 d1                	mov    %edx,%ecx
+  80265a:	c1 f9 1f             	sar    $0x1f,%ecx
+  80265d:	c1 e9 11             	shr    $0x11,%ecx
+  802660:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802663:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802668:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  80266a:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  802670:	29 d3                	sub    %edx,%ebx
+  802672:	ba 00 80 00 00       	mov    $0x8000,%edx
+  802677:	29 c2                	sub    %eax,%edx
+  802679:	39 d3                	cmp    %edx,%ebx
+  80267b:	0f 47 da             	cmova  %edx,%ebx
+  80267e:	8b 55 08             	mov    0x8(%ebp),%edx
+  802681:	29 fa                	sub    %edi,%edx
+  802683:	39 d3                	cmp    %edx,%ebx
+  802685:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  802688:	83 ec 04             	sub    $0x4,%esp
+  80268b:	53                   	push   %ebx
+  80268c:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  80268f:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  802692:	52                   	push   %edx
+  802693:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  802696:	01 c8                	add    %ecx,%eax
+  802698:	50                   	push   %eax
+  802699:	e8 cb e5 ff ff       	call   800c69 <memcpy>
+    i += m;
+  80269e:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  8026a0:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  8026a3:	8d 46 2c             	lea    0x2c(%esi),%eax
+  8026a6:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8026a9:	e8 57 fe ff ff       	call   802505 <pipe_wakeup>
+  8026ae:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  8026b1:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  8026b4:	73 2b                	jae    8026e1 <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  8026b6:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  8026b8:	8b 56 04             	mov    0x4(%esi),%edx
+  8026bb:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  8026c1:	39 d0                	cmp    %edx,%eax
+  8026c3:	7d 93                	jge    802658 <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  8026c5:	89 f2                	mov    %esi,%edx
+  8026c7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8026ca:	e8 e2 fe ff ff       	call   8025b1 <_pipeisclosed>
+  8026cf:	85 c0                	test   %eax,%eax
+  8026d1:	0f 84 65 ff ff ff    	je     80263c <devpipe_write_bulk+0x26>
+        return i;
+  8026d7:	89 f8                	mov    %edi,%eax
+}
+  8026d9:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8026dc:	5b                   	pop    %ebx
+  8026dd:	5e                   	pop    %esi
+  8026de:	5f                   	pop    %edi
+  8026df:	5d                   	pop    %ebp
+  8026e0:	c3                   	ret
+  return i;
+  8026e1:	89 f8                	mov    %edi,%eax
+  8026e3:	eb f4                	jmp    8026d9 <devpipe_write_bulk+0xc3>
+
+008026e5 <devpipe_write>:
+{
+  8026e5:	55                   	push   %ebp
+  8026e6:	89 e5                	mov    %esp,%ebp
+  8026e8:	57                   	push   %edi
+  8026e9:	56                   	push   %esi
+  8026ea:	53                   	push   %ebx
+  8026eb:	83 ec 28             	sub    $0x28,%esp
+  8026ee:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  8026f1:	56                   	push   %esi
+  8026f2:	e8 78 ec ff ff       	call   80136f <fd2data>
+  8026f7:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  8026f9:	8b 78 28             	mov    0x28(%eax),%edi
+  8026fc:	83 c4 10             	add    $0x10,%esp
+  8026ff:	85 ff                	test   %edi,%edi
+  802701:	75 25                	jne    802728 <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  802703:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802706:	74 66                	je     80276e <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  802708:	8b 43 04             	mov    0x4(%ebx),%eax
+  80270b:	8b 0b                	mov    (%ebx),%ecx
+  80270d:	8d 51 20             	lea    0x20(%ecx),%edx
+  802710:	39 d0                	cmp    %edx,%eax
+  802712:	72 2b                	jb     80273f <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  802714:	89 da                	mov    %ebx,%edx
+  802716:	89 f0                	mov    %esi,%eax
+  802718:	e8 94 fe ff ff       	call   8025b1 <_pipeisclosed>
+  80271d:	85 c0                	test   %eax,%eax
+  80271f:	75 51                	jne    802772 <devpipe_write+0x8d>
+      sys_yield();
+  802721:	e8 28 e7 ff ff       	call   800e4e <sys_yield>
+  802726:	eb e0                	jmp    802708 <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  802728:	83 ec 0c             	sub    $0xc,%esp
+  80272b:	ff 75 10             	push   0x10(%ebp)
+  80272e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802731:	89 c2                	mov    %eax,%edx
+  802733:	89 f0                	mov    %esi,%eax
+  802735:	e8 dc fe ff ff       	call   802616 <devpipe_write_bulk>
+  80273a:	83 c4 10             	add    $0x10,%esp
+  80273d:	eb 38                	jmp    802777 <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80273f:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802742:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  802746:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  802749:	89 c2                	mov    %eax,%edx
+  80274b:	c1 fa 1f             	sar    $0x1f,%edx
+  80274e:	89 d1                	mov    %edx,%ecx
+  802750:	c1 e9 1b             	shr    $0x1b,%ecx
+  802753:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  802756:	83 e2 1f             	and    $0x1f,%edx
+  802759:	29 ca                	sub    %ecx,%edx
+  80275b:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  80275f:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  802763:	83 c0 01             	add    $0x1,%eax
+  802766:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  802769:	83 c7 01             	add    $0x1,%edi
+  80276c:	eb 95                	jmp    802703 <devpipe_write+0x1e>
+  return i;
+  80276e:	89 f8                	mov    %edi,%eax
+  802770:	eb 05                	jmp    802777 <devpipe_write+0x92>
+        return 0;
+  802772:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802777:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80277a:	5b                   	pop    %ebx
+  80277b:	5e                   	pop    %esi
+  80277c:	5f                   	pop    %edi
+  80277d:	5d                   	pop    %ebp
+  80277e:	c3                   	ret
+
+0080277f <devpipe_read_bulk>:
+{
+  80277f:	55                   	push   %ebp
+  802780:	89 e5                	mov    %esp,%ebp
+  802782:	57                   	push   %edi
+  802783:	56                   	push   %esi
+  802784:	53                   	push   %ebx
+  802785:	83 ec 2c             	sub    $0x2c,%esp
+  802788:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80278b:	89 d6                	mov    %edx,%esi
+  80278d:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802790:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  802793:	e8 0c fd ff ff       	call   8024a4 <pipe_ring>
+  802798:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  80279b:	85 db                	test   %ebx,%ebx
+  80279d:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8027a2:	0f 45 c3             	cmovne %ebx,%eax
+  8027a5:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8027a8:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8027ad:	8d 46 30             	lea    0x30(%esi),%eax
+  8027b0:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  8027b3:	eb 50                	jmp    802805 <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  8027b5:	89 d1                	mov    %edx,%ecx
+  8027b7:	c1 f9 1f             	sar    $0x1f,%ecx
+  8027ba:	c1 e9 11             	shr    $0x11,%ecx
+  8027bd:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  8027c0:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  8027c5:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  8027c7:	29 d3                	sub    %edx,%ebx
+  8027c9:	ba 00 80 00 00       	mov    $0x8000,%edx
+  8027ce:	29 c2                	sub    %eax,%edx
+  8027d0:	39 d3                	cmp    %edx,%ebx
+  8027d2:	0f 47 da             	cmova  %edx,%ebx
+  8027d5:	8b 55 08             	mov    0x8(%ebp),%edx
+  8027d8:	29 fa                	sub    %edi,%edx
+  8027da:	39 d3                	cmp    %edx,%ebx
+  8027dc:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  8027df:	83 ec 04             	sub    $0x4,%esp
+  8027e2:	53                   	push   %ebx
+  8027e3:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8027e6:	01 c8                	add    %ecx,%eax
+  8027e8:	50                   	push   %eax
+  8027e9:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  8027ec:	01 f8                	add    %edi,%eax
+  8027ee:	50                   	push   %eax
+  8027ef:	e8 75 e4 ff ff       	call   800c69 <memcpy>
+    i += m;
+  8027f4:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  8027f6:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  8027f8:	89 f2                	mov    %esi,%edx
+  8027fa:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  8027fd:	e8 03 fd ff ff       	call   802505 <pipe_wakeup>
+  802802:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802805:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802808:	73 51                	jae    80285b <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  80280a:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  80280d:	8b 16                	mov    (%esi),%edx
+  80280f:	39 da                	cmp    %ebx,%edx
+  802811:	75 a2                	jne    8027b5 <devpipe_read_bulk+0x36>
+      if (i > 0)
+  802813:	85 ff                	test   %edi,%edi
+  802815:	75 44                	jne    80285b <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  802817:	89 f2                	mov    %esi,%edx
+  802819:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80281c:	e8 90 fd ff ff       	call   8025b1 <_pipeisclosed>
+  802821:	85 c0                	test   %eax,%eax
+  802823:	75 3a                	jne    80285f <devpipe_read_bulk+0xe0>
+  802825:	b8 01 00 00 00       	mov    $0x1,%eax
+  80282a:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  80282e:	6a 64                	push   $0x64
+  802830:	ff 75 d4             	push   -0x2c(%ebp)
+  802833:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  802834:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802837:	50                   	push   %eax
+  802838:	e8 ac e9 ff ff       	call   8011e9 <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  80283d:	85 c0                	test   %eax,%eax
+  80283f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802844:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  802847:	83 c4 10             	add    $0x10,%esp
+  80284a:	a8 01                	test   $0x1,%al
+  80284c:	74 b7                	je     802805 <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  80284e:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  802853:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802856:	5b                   	pop    %ebx
+  802857:	5e                   	pop    %esi
+  802858:	5f                   	pop    %edi
+  802859:	5d                   	pop    %ebp
+  80285a:	c3                   	ret
+  return i;
+  80285b:	89 f8                	mov    %edi,%eax
+  80285d:	eb f4                	jmp    802853 <devpipe_read_bulk+0xd4>
+        return 0;
+  80285f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802864:	eb ed                	jmp    802853 <devpipe_read_bulk+0xd4>
+
+00802866 <devpipe_read>:
+{
+  802866:	55                   	push   %ebp
+  802867:	89 e5                	mov    %esp,%ebp
+  802869:	57                   	push   %edi
+  80286a:	56                   	push   %esi
+  80286b:	53                   	push   %ebx
+  80286c:	83 ec 18             	sub    $0x18,%esp
+  80286f:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  802872:	57                   	push   %edi
+  802873:	e8 f7 ea ff ff       	call   80136f <fd2data>
+  802878:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  80287a:	8b 70 28             	mov    0x28(%eax),%esi
+  80287d:	83 c4 10             	add    $0x10,%esp
+  802880:	85 f6                	test   %esi,%esi
+  802882:	75 24                	jne    8028a8 <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  802884:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802887:	74 60                	je     8028e9 <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  802889:	8b 03                	mov    (%ebx),%eax
+  80288b:	3b 43 04             	cmp    0x4(%ebx),%eax
+  80288e:	75 3b                	jne    8028cb <devpipe_read+0x65>
+      if (i > 0)
+  802890:	85 f6                	test   %esi,%esi
+  802892:	75 2d                	jne    8028c1 <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  802894:	89 da                	mov    %ebx,%edx
+  802896:	89 f8                	mov    %edi,%eax
+  802898:	e8 14 fd ff ff       	call   8025b1 <_pipeisclosed>
+  80289d:	85 c0                	test   %eax,%eax
+  80289f:	75 4c                	jne    8028ed <devpipe_read+0x87>
+      sys_yield();
+  8028a1:	e8 a8 e5 ff ff       	call   800e4e <sys_yield>
+  8028a6:	eb e1                	jmp    802889 <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  8028a8:	83 ec 08             	sub    $0x8,%esp
+  8028ab:	6a 00                	push   $0x0
+  8028ad:	ff 75 10             	push   0x10(%ebp)
+  8028b0:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8028b3:	89 c2                	mov    %eax,%edx
+  8028b5:	89 f8                	mov    %edi,%eax
+  8028b7:	e8 c3 fe ff ff       	call   80277f <devpipe_read_bulk>
+  8028bc:	83 c4 10             	add    $0x10,%esp
+  8028bf:	eb 02                	jmp    8028c3 <devpipe_read+0x5d>
+        return i;
+  8028c1:	89 f0                	mov    %esi,%eax
+}
+  8028c3:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028c6:	5b                   	pop    %ebx
+  8028c7:	5e                   	pop    %esi
+  8028c8:	5f                   	pop    %edi
+  8028c9:	5d                   	pop    %ebp
+  8028ca:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8028cb:	99                   	cltd
+  8028cc:	c1 ea 1b             	shr    $0x1b,%edx
+  8028cf:	01 d0                	add    %edx,%eax
+  8028d1:	83 e0 1f             	and    $0x1f,%eax
+  8028d4:	29 d0                	sub    %edx,%eax
+  8028d6:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  8028db:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8028de:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  8028e1:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  8028e4:	83 c6 01             	add    $0x1,%esi
+  8028e7:	eb 9b                	jmp    802884 <devpipe_read+0x1e>
+  return i;
+  8028e9:	89 f0                	mov    %esi,%eax
+  8028eb:	eb d6                	jmp    8028c3 <devpipe_read+0x5d>
+        return 0;
+  8028ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028f2:	eb cf                	jmp    8028c3 <devpipe_read+0x5d>
+
+008028f4 <pipe2>:
+{
+  8028f4:	55                   	push   %ebp
+  8028f5:	89 e5                	mov    %esp,%ebp
+  8028f7:	57                   	push   %edi
+  8028f8:	56                   	push   %esi
+  8028f9:	53                   	push   %ebx
+  8028fa:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  8028fd:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802900:	50                   	push   %eax
+  802901:	e8 7d ea ff ff       	call   801383 <fd_alloc>
+  802906:	89 c3                	mov    %eax,%ebx
+  802908:	83 c4 10             	add    $0x10,%esp
+  80290b:	85 c0                	test   %eax,%eax
+  80290d:	0f 88 fb 01 00 00    	js     802b0e <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802913:	83 ec 04             	sub    $0x4,%esp
+  802916:	68 07 04 00 00       	push   $0x407
+  80291b:	ff 75 e4             	push   -0x1c(%ebp)
+  80291e:	6a 00                	push   $0x0
+  802920:	e8 8b e5 ff ff       	call   800eb0 <sys_page_alloc>
+  802925:	89 c3                	mov    %eax,%ebx
+  802927:	83 c4 10             	add    $0x10,%esp
+  80292a:	85 c0                	test   %eax,%eax
+  80292c:	0f 88 dc 01 00 00    	js     802b0e <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  802932:	83 ec 0c             	sub    $0xc,%esp
+  802935:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  802938:	50                   	push   %eax
+  802939:	e8 45 ea ff ff       	call   801383 <fd_alloc>
+  80293e:	89 c3                	mov    %eax,%ebx
+  802940:	83 c4 10             	add    $0x10,%esp
+  802943:	85 c0                	test   %eax,%eax
+  802945:	0f 88 b3 01 00 00    	js     802afe <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  80294b:	83 ec 04             	sub    $0x4,%esp
+  80294e:	68 07 04 00 00       	push   $0x407
+  802953:	ff 75 e0             	push   -0x20(%ebp)
+  802956:	6a 00                	push   $0x0
+  802958:	e8 53 e5 ff ff       	call   800eb0 <sys_page_alloc>
+  80295d:	89 c3                	mov    %eax,%ebx
+  80295f:	83 c4 10             	add    $0x10,%esp
+  802962:	85 c0                	test   %eax,%eax
+  802964:	0f 88 94 01 00 00    	js     802afe <pipe2+0x20a>
+  va = fd2data(fd0);
+  80296a:	83 ec 0c             	sub    $0xc,%esp
+  80296d:	ff 75 e4             	push   -0x1c(%ebp)
+  802970:	e8 fa e9 ff ff       	call   80136f <fd2data>
+  802975:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802977:	83 c4 0c             	add    $0xc,%esp
+  80297a:	68 07 04 00 00       	push   $0x407
+  80297f:	50                   	push   %eax
+  802980:	6a 00                	push   $0x0
+  802982:	e8 29 e5 ff ff       	call   800eb0 <sys_page_alloc>
+  802987:	89 c3                	mov    %eax,%ebx
+  802989:	83 c4 10             	add    $0x10,%esp
+  80298c:	85 c0                	test   %eax,%eax
+  80298e:	0f 88 5a 01 00 00    	js     802aee <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802994:	83 ec 0c             	sub    $0xc,%esp
+  802997:	ff 75 e0             	push   -0x20(%ebp)
+  80299a:	e8 d0 e9 ff ff       	call   80136f <fd2data>
+  80299f:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  8029a6:	50                   	push   %eax
+  8029a7:	6a 00                	push   $0x0
+  8029a9:	57                   	push   %edi
+  8029aa:	6a 00                	push   $0x0
+  8029ac:	e8 42 e5 ff ff       	call   800ef3 <sys_page_map>
+  8029b1:	89 c3                	mov    %eax,%ebx
+  8029b3:	83 c4 20             	add    $0x20,%esp
+  8029b6:	85 c0                	test   %eax,%eax
+  8029b8:	0f 88 22 01 00 00    	js     802ae0 <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  8029be:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  8029c2:	74 72                	je     802a36 <pipe2+0x142>
+  8029c4:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  8029c9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8029cc:	e8 d3 fa ff ff       	call   8024a4 <pipe_ring>
+  8029d1:	83 ec 04             	sub    $0x4,%esp
+  8029d4:	68 07 04 00 00       	push   $0x407
+  8029d9:	01 f0                	add    %esi,%eax
+  8029db:	50                   	push   %eax
+  8029dc:	6a 00                	push   $0x0
+  8029de:	e8 cd e4 ff ff       	call   800eb0 <sys_page_alloc>
+  8029e3:	89 c3                	mov    %eax,%ebx
+  8029e5:	83 c4 10             	add    $0x10,%esp
+  8029e8:	85 c0                	test   %eax,%eax
+  8029ea:	0f 88 97 00 00 00    	js     802a87 <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  8029f0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8029f3:	e8 ac fa ff ff       	call   8024a4 <pipe_ring>
+  8029f8:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  8029fb:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8029fe:	e8 a1 fa ff ff       	call   8024a4 <pipe_ring>
+  802a03:	83 ec 0c             	sub    $0xc,%esp
+  802a06:	68 07 04 00 00       	push   $0x407
+  802a0b:	53                   	push   %ebx
+  802a0c:	6a 00                	push   $0x0
+  802a0e:	01 f0                	add    %esi,%eax
+  802a10:	50                   	push   %eax
+  802a11:	6a 00                	push   $0x0
+  802a13:	e8 db e4 ff ff       	call   800ef3 <sys_page_map>
+  802a18:	89 c3                	mov    %eax,%ebx
+  802a1a:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802a20:	83 c4 20             	add    $0x20,%esp
+  802a23:	85 c0                	test   %eax,%eax
+  802a25:	78 60                	js     802a87 <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  802a27:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802a2d:	75 9a                	jne    8029c9 <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  802a2f:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  802a36:	a1 3c 40 80 00       	mov    0x80403c,%eax
+  802a3b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802a3e:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  802a40:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802a43:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  802a4a:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802a4d:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  802a4f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802a52:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  802a59:	83 ec 0c             	sub    $0xc,%esp
+  802a5c:	ff 75 e4             	push   -0x1c(%ebp)
+  802a5f:	e8 fb e8 ff ff       	call   80135f <fd2num>
+  802a64:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802a67:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  802a69:	83 c4 04             	add    $0x4,%esp
+  802a6c:	ff 75 e0             	push   -0x20(%ebp)
+  802a6f:	e8 eb e8 ff ff       	call   80135f <fd2num>
+  802a74:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802a77:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  802a7a:	83 c4 10             	add    $0x10,%esp
+  802a7d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802a82:	e9 87 00 00 00       	jmp    802b0e <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802a87:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  802a8c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802a8f:	e8 10 fa ff ff       	call   8024a4 <pipe_ring>
+  802a94:	83 ec 08             	sub    $0x8,%esp
+  802a97:	01 f0                	add    %esi,%eax
+  802a99:	50                   	push   %eax
+  802a9a:	6a 00                	push   $0x0
+  802a9c:	e8 94 e4 ff ff       	call   800f35 <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  802aa1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802aa4:	e8 fb f9 ff ff       	call   8024a4 <pipe_ring>
+  802aa9:	83 c4 08             	add    $0x8,%esp
+  802aac:	01 f0                	add    %esi,%eax
+  802aae:	50                   	push   %eax
+  802aaf:	6a 00                	push   $0x0
+  802ab1:	e8 7f e4 ff ff       	call   800f35 <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802ab6:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802abc:	83 c4 10             	add    $0x10,%esp
+  802abf:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802ac5:	75 c5                	jne    802a8c <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  802ac7:	83 ec 0c             	sub    $0xc,%esp
+  802aca:	ff 75 e0             	push   -0x20(%ebp)
+  802acd:	e8 9d e8 ff ff       	call   80136f <fd2data>
+  802ad2:	83 c4 08             	add    $0x8,%esp
+  802ad5:	50                   	push   %eax
+  802ad6:	6a 00                	push   $0x0
+  802ad8:	e8 58 e4 ff ff       	call   800f35 <sys_page_unmap>
+  802add:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  802ae0:	83 ec 08             	sub    $0x8,%esp
+  802ae3:	57                   	push   %edi
+  802ae4:	6a 00                	push   $0x0
+  802ae6:	e8 4a e4 ff ff       	call   800f35 <sys_page_unmap>
+  802aeb:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  802aee:	83 ec 08             	sub    $0x8,%esp
+  802af1:	ff 75 e0             	push   -0x20(%ebp)
+  802af4:	6a 00                	push   $0x0
+  802af6:	e8 3a e4 ff ff       	call   800f35 <sys_page_unmap>
+  802afb:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  802afe:	83 ec 08             	sub    $0x8,%esp
+  802b01:	ff 75 e4             	push   -0x1c(%ebp)
+  802b04:	6a 00                	push   $0x0
+  802b06:	e8 2a e4 ff ff       	call   800f35 <sys_page_unmap>
+  802b0b:	83 c4 10             	add    $0x10,%esp
+}
+  802b0e:	89 d8                	mov    %ebx,%eax
+  802b10:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b13:	5b                   	pop    %ebx
+  802b14:	5e                   	pop    %esi
+  802b15:	5f                   	pop    %edi
+  802b16:	5d                   	pop    %ebp
+  802b17:	c3                   	ret
+
+00802b18 <pipe>:
+{
+  802b18:	55                   	push   %ebp
+  802b19:	89 e5                	mov    %esp,%ebp
+  802b1b:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  802b1e:	6a 00                	push   $0x0
+  802b20:	ff 75 08             	push   0x8(%ebp)
+  802b23:	e8 cc fd ff ff       	call   8028f4 <pipe2>
+}
+  802b28:	c9                   	leave
+  802b29:	c3                   	ret
+
+00802b2a <pipeisclosed>:
+{
+  802b2a:	55                   	push   %ebp
+  802b2b:	89 e5                	mov    %esp,%ebp
+  802b2d:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802b30:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802b33:	50                   	push   %eax
+  802b34:	ff 75 08             	push   0x8(%ebp)
+  802b37:	e8 9d e8 ff ff       	call   8013d9 <fd_lookup>
+  802b3c:	83 c4 10             	add    $0x10,%esp
+  802b3f:	85 c0                	test   %eax,%eax
+  802b41:	78 18                	js     802b5b <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  802b43:	83 ec 0c             	sub    $0xc,%esp
+  802b46:	ff 75 f4             	push   -0xc(%ebp)
+  802b49:	e8 21 e8 ff ff       	call   80136f <fd2data>
+  802b4e:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  802b50:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802b53:	e8 59 fa ff ff       	call   8025b1 <_pipeisclosed>
+  802b58:	83 c4 10             	add    $0x10,%esp
+}
+  802b5b:	c9                   	leave
+  802b5c:	c3                   	ret
+
+00802b5d <pipe_splice>:
+{
+  802b5d:	55                   	push   %ebp
+  802b5e:	89 e5                	mov    %esp,%ebp
+  802b60:	57                   	push   %edi
+  802b61:	56                   	push   %esi
+  802b62:	53                   	push   %ebx
+  802b63:	83 ec 34             	sub    $0x34,%esp
+  802b66:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802b69:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802b6c:	50                   	push   %eax
+  802b6d:	ff 75 08             	push   0x8(%ebp)
+  802b70:	e8 64 e8 ff ff       	call   8013d9 <fd_lookup>
+  802b75:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802b78:	83 c4 10             	add    $0x10,%esp
+  802b7b:	85 c0                	test   %eax,%eax
+  802b7d:	0f 88 d7 00 00 00    	js     802c5a <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  802b83:	83 ec 0c             	sub    $0xc,%esp
+  802b86:	ff 75 e4             	push   -0x1c(%ebp)
+  802b89:	e8 e1 e7 ff ff       	call   80136f <fd2data>
+  802b8e:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802b90:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802b93:	83 c4 10             	add    $0x10,%esp
+  802b96:	8b 15 3c 40 80 00    	mov    0x80403c,%edx
+  802b9c:	39 10                	cmp    %edx,(%eax)
+  802b9e:	0f 85 c1 00 00 00    	jne    802c65 <pipe_splice+0x108>
+  802ba4:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  802ba8:	0f 84 c0 00 00 00    	je     802c6e <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  802bae:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802bb2:	0f 84 bf 00 00 00    	je     802c77 <pipe_splice+0x11a>
+  802bb8:	89 f7                	mov    %esi,%edi
+  802bba:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  802bc0:	0f 85 ba 00 00 00    	jne    802c80 <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802bc6:	8d 43 04             	lea    0x4(%ebx),%eax
+  802bc9:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802bcc:	eb 38                	jmp    802c06 <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802bce:	83 ec 0c             	sub    $0xc,%esp
+  802bd1:	68 00 10 00 00       	push   $0x1000
+  802bd6:	89 f1                	mov    %esi,%ecx
+  802bd8:	89 da                	mov    %ebx,%edx
+  802bda:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802bdd:	e8 34 fa ff ff       	call   802616 <devpipe_write_bulk>
+  802be2:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802be5:	83 c4 10             	add    $0x10,%esp
+  802be8:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802bed:	75 53                	jne    802c42 <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  802bef:	83 ec 08             	sub    $0x8,%esp
+  802bf2:	56                   	push   %esi
+  802bf3:	6a 00                	push   $0x0
+  802bf5:	e8 3b e3 ff ff       	call   800f35 <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  802bfa:	83 c7 01             	add    $0x1,%edi
+  802bfd:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802c03:	83 c4 10             	add    $0x10,%esp
+  802c06:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802c09:	74 3a                	je     802c45 <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  802c0b:	8b 03                	mov    (%ebx),%eax
+  802c0d:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802c10:	75 bc                	jne    802bce <pipe_splice+0x71>
+  802c12:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c17:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  802c1b:	85 c0                	test   %eax,%eax
+  802c1d:	74 af                	je     802bce <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802c1f:	83 ec 04             	sub    $0x4,%esp
+  802c22:	6a 07                	push   $0x7
+  802c24:	56                   	push   %esi
+  802c25:	ff 75 d0             	push   -0x30(%ebp)
+  802c28:	e8 df e5 ff ff       	call   80120c <sys_chan_wakeup>
+  802c2d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802c30:	83 c4 10             	add    $0x10,%esp
+  802c33:	85 c0                	test   %eax,%eax
+  802c35:	79 b8                	jns    802bef <pipe_splice+0x92>
+  802c37:	b8 01 00 00 00       	mov    $0x1,%eax
+  802c3c:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802c40:	eb 8c                	jmp    802bce <pipe_splice+0x71>
+  802c42:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  802c45:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802c49:	75 06                	jne    802c51 <pipe_splice+0xf4>
+  802c4b:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802c4f:	78 09                	js     802c5a <pipe_splice+0xfd>
+  return i * PGSIZE;
+  802c51:	8b 45 10             	mov    0x10(%ebp),%eax
+  802c54:	c1 e0 0c             	shl    $0xc,%eax
+  802c57:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  802c5a:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802c5d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802c60:	5b                   	pop    %ebx
+  802c61:	5e                   	pop    %esi
+  802c62:	5f                   	pop    %edi
+  802c63:	5d                   	pop    %ebp
+  802c64:	c3                   	ret
+    return -E_INVAL;
+  802c65:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802c6c:	eb ec                	jmp    802c5a <pipe_splice+0xfd>
+  802c6e:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802c75:	eb e3                	jmp    802c5a <pipe_splice+0xfd>
+  802c77:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802c7e:	eb da                	jmp    802c5a <pipe_splice+0xfd>
+  802c80:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802c87:	eb d1                	jmp    802c5a <pipe_splice+0xfd>
+
+00802c89 <pipe_splice_read>:
+{
+  802c89:	55                   	push   %ebp
+  802c8a:	89 e5                	mov    %esp,%ebp
+  802c8c:	53                   	push   %ebx
+  802c8d:	83 ec 1c             	sub    $0x1c,%esp
+  802c90:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802c93:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802c96:	50                   	push   %eax
+  802c97:	ff 75 08             	push   0x8(%ebp)
+  802c9a:	e8 3a e7 ff ff       	call   8013d9 <fd_lookup>
+  802c9f:	83 c4 10             	add    $0x10,%esp
+  802ca2:	85 c0                	test   %eax,%eax
+  802ca4:	78 49                	js     802cef <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  802ca6:	83 ec 0c             	sub    $0xc,%esp
+  802ca9:	ff 75 f4             	push   -0xc(%ebp)
+  802cac:	e8 be e6 ff ff       	call   80136f <fd2data>
+  802cb1:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802cb3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802cb6:	83 c4 10             	add    $0x10,%esp
+  802cb9:	8b 0d 3c 40 80 00    	mov    0x80403c,%ecx
+  802cbf:	39 08                	cmp    %ecx,(%eax)
+  802cc1:	75 31                	jne    802cf4 <pipe_splice_read+0x6b>
+  802cc3:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  802cc7:	74 32                	je     802cfb <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  802cc9:	8b 48 08             	mov    0x8(%eax),%ecx
+  802ccc:	83 e1 03             	and    $0x3,%ecx
+  802ccf:	83 f9 01             	cmp    $0x1,%ecx
+  802cd2:	74 2e                	je     802d02 <pipe_splice_read+0x79>
+  802cd4:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  802cda:	75 2d                	jne    802d09 <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  802cdc:	83 ec 08             	sub    $0x8,%esp
+  802cdf:	53                   	push   %ebx
+  802ce0:	68 00 10 00 00       	push   $0x1000
+  802ce5:	89 d9                	mov    %ebx,%ecx
+  802ce7:	e8 93 fa ff ff       	call   80277f <devpipe_read_bulk>
+  802cec:	83 c4 10             	add    $0x10,%esp
+}
+  802cef:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802cf2:	c9                   	leave
+  802cf3:	c3                   	ret
+    return -E_INVAL;
+  802cf4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802cf9:	eb f4                	jmp    802cef <pipe_splice_read+0x66>
+  802cfb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d00:	eb ed                	jmp    802cef <pipe_splice_read+0x66>
+  802d02:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d07:	eb e6                	jmp    802cef <pipe_splice_read+0x66>
+  802d09:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802d0e:	eb df                	jmp    802cef <pipe_splice_read+0x66>
+
+00802d10 <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  802d10:	55                   	push   %ebp
+  802d11:	89 e5                	mov    %esp,%ebp
+  802d13:	57                   	push   %edi
+  802d14:	56                   	push   %esi
+  802d15:	53                   	push   %ebx
+  802d16:	83 ec 14             	sub    $0x14,%esp
+  802d19:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802d1c:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802d1f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  802d22:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  802d25:	85 c0                	test   %eax,%eax
+  802d27:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  802d2c:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  802d2f:	ff 33                	push   (%ebx)
+  802d31:	50                   	push   %eax
+  802d32:	e8 51 e4 ff ff       	call   801188 <sys_ipc_recv>
+  802d37:	83 c4 10             	add    $0x10,%esp
+  802d3a:	85 c0                	test   %eax,%eax
+  802d3c:	78 39                	js     802d77 <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  802d3e:	85 ff                	test   %edi,%edi
+  802d40:	74 0a                	je     802d4c <ipc_recv_pages+0x3c>
+  802d42:	a1 44 5b 80 00       	mov    0x805b44,%eax
+  802d47:	8b 40 7c             	mov    0x7c(%eax),%eax
+  802d4a:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  802d4c:	85 f6                	test   %esi,%esi
+  802d4e:	74 0d                	je     802d5d <ipc_recv_pages+0x4d>
+  802d50:	a1 44 5b 80 00       	mov    0x805b44,%eax
+  802d55:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  802d5b:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  802d5d:	a1 44 5b 80 00       	mov    0x805b44,%eax
+  802d62:	8b 40 74             	mov    0x74(%eax),%eax
+  802d65:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  802d67:	a1 44 5b 80 00       	mov    0x805b44,%eax
+  802d6c:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  802d6f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802d72:	5b                   	pop    %ebx
+  802d73:	5e                   	pop    %esi
+  802d74:	5f                   	pop    %edi
+  802d75:	5d                   	pop    %ebp
+  802d76:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  802d77:	85 ff                	test   %edi,%edi
+  802d79:	74 06                	je     802d81 <ipc_recv_pages+0x71>
+  802d7b:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  802d81:	85 f6                	test   %esi,%esi
+  802d83:	74 06                	je     802d8b <ipc_recv_pages+0x7b>
+  802d85:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  802d8b:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  802d91:	eb dc                	jmp    802d6f <ipc_recv_pages+0x5f>
+
+00802d93 <ipc_recv>:
+{
+  802d93:	55                   	push   %ebp
+  802d94:	89 e5                	mov    %esp,%ebp
+  802d96:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  802d99:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  802da0:	ff 75 10             	push   0x10(%ebp)
+  802da3:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802da6:	50                   	push   %eax
+  802da7:	ff 75 0c             	push   0xc(%ebp)
+  802daa:	ff 75 08             	push   0x8(%ebp)
+  802dad:	e8 5e ff ff ff       	call   802d10 <ipc_recv_pages>
+}
+  802db2:	c9                   	leave
+  802db3:	c3                   	ret
+
+00802db4 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  802db4:	55                   	push   %ebp
+  802db5:	89 e5                	mov    %esp,%ebp
+  802db7:	57                   	push   %edi
+  802db8:	56                   	push   %esi
+  802db9:	53                   	push   %ebx
+  802dba:	83 ec 0c             	sub    $0xc,%esp
+  802dbd:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802dc0:	8b 75 0c             	mov    0xc(%ebp),%esi
+  802dc3:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  802dc6:	89 c3                	mov    %eax,%ebx
+  802dc8:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  802dce:	85 c0                	test   %eax,%eax
+  802dd0:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802dd5:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  802dd8:	83 ec 0c             	sub    $0xc,%esp
+  802ddb:	ff 75 14             	push   0x14(%ebp)
+  802dde:	ff 75 18             	push   0x18(%ebp)
+  802de1:	53                   	push   %ebx
+  802de2:	56                   	push   %esi
+  802de3:	57                   	push   %edi
+  802de4:	e8 7e e3 ff ff       	call   801167 <sys_ipc_try_send>
+  802de9:	83 c4 20             	add    $0x20,%esp
+  802dec:	85 c0                	test   %eax,%eax
+  802dee:	79 1e                	jns    802e0e <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  802df0:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  802df3:	75 07                	jne    802dfc <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  802df5:	e8 54 e0 ff ff       	call   800e4e <sys_yield>
+  802dfa:	eb dc                	jmp    802dd8 <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  802dfc:	50                   	push   %eax
+  802dfd:	68 f7 35 80 00       	push   $0x8035f7
+  802e02:	6a 5c                	push   $0x5c
+  802e04:	68 04 36 80 00       	push   $0x803604
+  802e09:	e8 ba d4 ff ff       	call   8002c8 <_panic>
+  }
+}
+  802e0e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802e11:	5b                   	pop    %ebx
+  802e12:	5e                   	pop    %esi
+  802e13:	5f                   	pop    %edi
+  802e14:	5d                   	pop    %ebp
+  802e15:	c3                   	ret
+
+00802e16 <ipc_send>:
+{
+  802e16:	55                   	push   %ebp
+  802e17:	89 e5                	mov    %esp,%ebp
+  802e19:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  802e1c:	ff 75 14             	push   0x14(%ebp)
+  802e1f:	6a 01                	push   $0x1
+  802e21:	ff 75 10             	push   0x10(%ebp)
+  802e24:	ff 75 0c             	push   0xc(%ebp)
+  802e27:	ff 75 08             	push   0x8(%ebp)
+  802e2a:	e8 85 ff ff ff       	call   802db4 <ipc_send_pages>
+}
+  802e2f:	83 c4 20             	add    $0x20,%esp
+  802e32:	c9                   	leave
+  802e33:	c3                   	ret
+
+00802e34 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  802e34:	55                   	push   %ebp
+  802e35:	89 e5                	mov    %esp,%ebp
+  802e37:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  802e3a:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  802e3f:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802e42:	c1 e0 04             	shl    $0x4,%eax
+  802e45:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802e4a:	8b 40 50             	mov    0x50(%eax),%eax
+  802e4d:	39 c8                	cmp    %ecx,%eax
+  802e4f:	74 12                	je     802e63 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  802e51:	83 c2 01             	add    $0x1,%edx
+  802e54:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  802e5a:	75 e3                	jne    802e3f <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  802e5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e61:	eb 0e                	jmp    802e71 <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  802e63:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  802e66:	c1 e0 04             	shl    $0x4,%eax
+  802e69:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  802e6e:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  802e71:	5d                   	pop    %ebp
+  802e72:	c3                   	ret
+
+00802e73 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  802e73:	55                   	push   %ebp
+  802e74:	89 e5                	mov    %esp,%ebp
+  802e76:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802e79:	89 c2                	mov    %eax,%edx
+  802e7b:	c1 ea 16             	shr    $0x16,%edx
+  802e7e:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  802e85:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  802e8a:	f6 c1 01             	test   $0x1,%cl
+  802e8d:	74 1c                	je     802eab <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  802e8f:	c1 e8 0c             	shr    $0xc,%eax
+  802e92:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  802e99:	a8 01                	test   $0x1,%al
+  802e9b:	74 0e                	je     802eab <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  802e9d:	c1 e8 0c             	shr    $0xc,%eax
+  802ea0:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  802ea7:	ef 
+  802ea8:	0f b7 d2             	movzwl %dx,%edx
+}
+  802eab:	89 d0                	mov    %edx,%eax
+  802ead:	5d                   	pop    %ebp
+  802eae:	c3                   	ret
+
+00802eaf <udivmod>:
+  802eaf:	55                   	push   %ebp
+  802eb0:	57                   	push   %edi
+  802eb1:	56                   	push   %esi
+  802eb2:	53                   	push   %ebx
+  802eb3:	83 ec 14             	sub    $0x14,%esp
+  802eb6:	8b 74 24 28          	mov    0x28(%esp),%esi
+  802eba:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  802ebe:	89 fb                	mov    %edi,%ebx
+  802ec0:	09 f3                	or     %esi,%ebx
+  802ec2:	0f 84 88 00 00 00    	je     802f50 <udivmod+0xa1>
+  802ec8:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  802ecd:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  802ed4:	00 
+  802ed5:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  802edc:	00 
+  802edd:	89 cd                	mov    %ecx,%ebp
+  802edf:	89 34 24             	mov    %esi,(%esp)
+  802ee2:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  802ee6:	eb 08                	jmp    802ef0 <udivmod+0x41>
+  802ee8:	83 ed 01             	sub    $0x1,%ebp
+  802eeb:	83 fd ff             	cmp    $0xffffffff,%ebp
+  802eee:	74 6c                	je     802f5c <udivmod+0xad>
+  802ef0:	89 c3                	mov    %eax,%ebx
+  802ef2:	89 d6                	mov    %edx,%esi
+  802ef4:	89 e9                	mov    %ebp,%ecx
+  802ef6:	0f ad f3             	shrd   %cl,%esi,%ebx
+  802ef9:	d3 ee                	shr    %cl,%esi
+  802efb:	f6 c1 20             	test   $0x20,%cl
+  802efe:	74 04                	je     802f04 <udivmod+0x55>
+  802f00:	89 f3                	mov    %esi,%ebx
+  802f02:	31 f6                	xor    %esi,%esi
+  802f04:	8b 3c 24             	mov    (%esp),%edi
+  802f07:	39 fb                	cmp    %edi,%ebx
+  802f09:	89 f7                	mov    %esi,%edi
+  802f0b:	8b 1c 24             	mov    (%esp),%ebx
+  802f0e:	8b 74 24 04          	mov    0x4(%esp),%esi
+  802f12:	19 f7                	sbb    %esi,%edi
+  802f14:	72 d2                	jb     802ee8 <udivmod+0x39>
+  802f16:	89 f7                	mov    %esi,%edi
+  802f18:	89 de                	mov    %ebx,%esi
+  802f1a:	89 e9                	mov    %ebp,%ecx
+  802f1c:	0f a5 f7             	shld   %cl,%esi,%edi
+  802f1f:	d3 e6                	shl    %cl,%esi
+  802f21:	f6 c1 20             	test   $0x20,%cl
+  802f24:	74 04                	je     802f2a <udivmod+0x7b>
+  802f26:	89 f7                	mov    %esi,%edi
+  802f28:	31 f6                	xor    %esi,%esi
+  802f2a:	29 f0                	sub    %esi,%eax
+  802f2c:	19 fa                	sbb    %edi,%edx
+  802f2e:	be 01 00 00 00       	mov    $0x1,%esi
+  802f33:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f38:	0f a5 f7             	shld   %cl,%esi,%edi
+  802f3b:	d3 e6                	shl    %cl,%esi
+  802f3d:	f6 c1 20             	test   $0x20,%cl
+  802f40:	74 04                	je     802f46 <udivmod+0x97>
+  802f42:	89 f7                	mov    %esi,%edi
+  802f44:	31 f6                	xor    %esi,%esi
+  802f46:	09 74 24 08          	or     %esi,0x8(%esp)
+  802f4a:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  802f4e:	eb 98                	jmp    802ee8 <udivmod+0x39>
+  802f50:	89 f0                	mov    %esi,%eax
+  802f52:	89 fa                	mov    %edi,%edx
+  802f54:	89 74 24 08          	mov    %esi,0x8(%esp)
+  802f58:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  802f5c:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  802f60:	89 01                	mov    %eax,(%ecx)
+  802f62:	89 51 04             	mov    %edx,0x4(%ecx)
+  802f65:	8b 44 24 08          	mov    0x8(%esp),%eax
+  802f69:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  802f6d:	83 c4 14             	add    $0x14,%esp
+  802f70:	5b                   	pop    %ebx
+  802f71:	5e                   	pop    %esi
+  802f72:	5f                   	pop    %edi
+  802f73:	5d                   	pop    %ebp
+  802f74:	c3                   	ret
+
+00802f75 <__udivdi3>:
+  802f75:	83 ec 18             	sub    $0x18,%esp
+  802f78:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802f7c:	50                   	push   %eax
+  802f7d:	ff 74 24 2c          	push   0x2c(%esp)
+  802f81:	ff 74 24 2c          	push   0x2c(%esp)
+  802f85:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802f89:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802f8d:	e8 1d ff ff ff       	call   802eaf <udivmod>
+  802f92:	83 c4 24             	add    $0x24,%esp
+  802f95:	c3                   	ret
+
+00802f96 <__umoddi3>:
+  802f96:	83 ec 18             	sub    $0x18,%esp
+  802f99:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  802f9d:	50                   	push   %eax
+  802f9e:	ff 74 24 2c          	push   0x2c(%esp)
+  802fa2:	ff 74 24 2c          	push   0x2c(%esp)
+  802fa6:	8b 44 24 28          	mov    0x28(%esp),%eax
+  802faa:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  802fae:	e8 fc fe ff ff       	call   802eaf <udivmod>
+  802fb3:	8b 44 24 18          	mov    0x18(%esp),%eax
+  802fb7:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  802fbb:	83 c4 24             	add    $0x24,%esp
+  802fbe:	c3                   	ret
+
+00802fbf <__divdi3>:
+  802fbf:	56                   	push   %esi
+  802fc0:	53                   	push   %ebx
+  802fc1:	83 ec 14             	sub    $0x14,%esp
+  802fc4:	8b 44 24 20          	mov    0x20(%esp),%eax
+  802fc8:	8b 54 24 24          	mov    0x24(%esp),%edx
+  802fcc:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  802fd0:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  802fd4:	85 d2                	test   %edx,%edx
+  802fd6:	78 18                	js     802ff0 <__divdi3+0x31>
+  802fd8:	85 db                	test   %ebx,%ebx
+  802fda:	78 3e                	js     80301a <__divdi3+0x5b>
+  802fdc:	83 ec 04             	sub    $0x4,%esp
+  802fdf:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  802fe3:	56                   	push   %esi
+  802fe4:	53                   	push   %ebx
+  802fe5:	51                   	push   %ecx
+  802fe6:	e8 c4 fe ff ff       	call   802eaf <udivmod>
+  802feb:	83 c4 10             	add    $0x10,%esp
+  802fee:	eb 24                	jmp    803014 <__divdi3+0x55>
+  802ff0:	f7 d8                	neg    %eax
+  802ff2:	83 d2 00             	adc    $0x0,%edx
+  802ff5:	f7 da                	neg    %edx
+  802ff7:	85 db                	test   %ebx,%ebx
+  802ff9:	78 3a                	js     803035 <__divdi3+0x76>
+  802ffb:	83 ec 04             	sub    $0x4,%esp
+  802ffe:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803002:	56                   	push   %esi
+  803003:	53                   	push   %ebx
+  803004:	51                   	push   %ecx
+  803005:	e8 a5 fe ff ff       	call   802eaf <udivmod>
+  80300a:	83 c4 10             	add    $0x10,%esp
+  80300d:	f7 d8                	neg    %eax
+  80300f:	83 d2 00             	adc    $0x0,%edx
+  803012:	f7 da                	neg    %edx
+  803014:	83 c4 14             	add    $0x14,%esp
+  803017:	5b                   	pop    %ebx
+  803018:	5e                   	pop    %esi
+  803019:	c3                   	ret
+  80301a:	83 ec 04             	sub    $0x4,%esp
+  80301d:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803021:	56                   	push   %esi
+  803022:	f7 d9                	neg    %ecx
+  803024:	83 d3 00             	adc    $0x0,%ebx
+  803027:	f7 db                	neg    %ebx
+  803029:	53                   	push   %ebx
+  80302a:	51                   	push   %ecx
+  80302b:	e8 7f fe ff ff       	call   802eaf <udivmod>
+  803030:	83 c4 10             	add    $0x10,%esp
+  803033:	eb d8                	jmp    80300d <__divdi3+0x4e>
+  803035:	83 ec 04             	sub    $0x4,%esp
+  803038:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  80303c:	56                   	push   %esi
+  80303d:	f7 d9                	neg    %ecx
+  80303f:	83 d3 00             	adc    $0x0,%ebx
+  803042:	f7 db                	neg    %ebx
+  803044:	53                   	push   %ebx
+  803045:	51                   	push   %ecx
+  803046:	e8 64 fe ff ff       	call   802eaf <udivmod>
+  80304b:	83 c4 10             	add    $0x10,%esp
+  80304e:	eb c4                	jmp    803014 <__divdi3+0x55>
+
+00803050 <__moddi3>:
+  803050:	55                   	push   %ebp
+  803051:	57                   	push   %edi
+  803052:	56                   	push   %esi
+  803053:	53                   	push   %ebx
+  803054:	83 ec 24             	sub    $0x24,%esp
+  803057:	8b 44 24 38          	mov    0x38(%esp),%eax
+  80305b:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  80305f:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  803063:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  803067:	85 d2                	test   %edx,%edx
+  803069:	78 3b                	js     8030a6 <__moddi3+0x56>
+  80306b:	83 ec 04             	sub    $0x4,%esp
+  80306e:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803072:	56                   	push   %esi
+  803073:	89 ce                	mov    %ecx,%esi
+  803075:	f7 de                	neg    %esi
+  803077:	89 74 24 08          	mov    %esi,0x8(%esp)
+  80307b:	89 de                	mov    %ebx,%esi
+  80307d:	83 d6 00             	adc    $0x0,%esi
+  803080:	f7 de                	neg    %esi
+  803082:	89 74 24 14          	mov    %esi,0x14(%esp)
+  803086:	8b 74 24 08          	mov    0x8(%esp),%esi
+  80308a:	0f 48 f1             	cmovs  %ecx,%esi
+  80308d:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  803092:	53                   	push   %ebx
+  803093:	56                   	push   %esi
+  803094:	e8 16 fe ff ff       	call   802eaf <udivmod>
+  803099:	8b 44 24 28          	mov    0x28(%esp),%eax
+  80309d:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8030a1:	83 c4 10             	add    $0x10,%esp
+  8030a4:	eb 47                	jmp    8030ed <__moddi3+0x9d>
+  8030a6:	f7 d8                	neg    %eax
+  8030a8:	83 d2 00             	adc    $0x0,%edx
+  8030ab:	f7 da                	neg    %edx
+  8030ad:	83 ec 04             	sub    $0x4,%esp
+  8030b0:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  8030b4:	56                   	push   %esi
+  8030b5:	89 cf                	mov    %ecx,%edi
+  8030b7:	f7 df                	neg    %edi
+  8030b9:	89 de                	mov    %ebx,%esi
+  8030bb:	83 d6 00             	adc    $0x0,%esi
+  8030be:	f7 de                	neg    %esi
+  8030c0:	0f 49 cf             	cmovns %edi,%ecx
+  8030c3:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  8030c7:	0f 49 de             	cmovns %esi,%ebx
+  8030ca:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  8030ce:	ff 74 24 0c          	push   0xc(%esp)
+  8030d2:	ff 74 24 0c          	push   0xc(%esp)
+  8030d6:	e8 d4 fd ff ff       	call   802eaf <udivmod>
+  8030db:	8b 44 24 28          	mov    0x28(%esp),%eax
+  8030df:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  8030e3:	f7 d8                	neg    %eax
+  8030e5:	83 d2 00             	adc    $0x0,%edx
+  8030e8:	f7 da                	neg    %edx
+  8030ea:	83 c4 10             	add    $0x10,%esp
+  8030ed:	83 c4 24             	add    $0x24,%esp
+  8030f0:	5b                   	pop    %ebx
+  8030f1:	5e                   	pop    %esi
+  8030f2:	5f                   	pop    %edi
+  8030f3:	5d                   	pop    %ebp
+  8030f4:	c3                   	ret
@@ -0,0 +1,7983 @@
+
+obj/user/testpipe.debug:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00800020 <_start>:
+// starts us running when we are initially loaded into a new environment.
+.text
+.globl _start
+_start:
+	// See if we were started with arguments on the stack
+	cmpl $USTACKTOP, %esp
+  800020:	81 fc 00 e0 bf ee    	cmp    $0xeebfe000,%esp
+	jne args_exist
+  800026:	75 04                	jne    80002c <args_exist>
+
+	// If not, push dummy argc/argv arguments.
+	// This happens when we are loaded by the kernel,
+	// because the kernel does not know about passing arguments.
+	pushl $0
+  800028:	6a 00                	push   $0x0
+	pushl $0
+  80002a:	6a 00                	push   $0x0
+
+0080002c <args_exist>:
+
+args_exist:
+	call libmain
+  80002c:	e8 a1 02 00 00       	call   8002d2 <libmain>
+1:	jmp 1b
+  800031:	eb fe                	jmp    800031 <args_exist+0x5>
+
+00800033 <umain>:
+
+char *msg = "Now is the time for all good men to come to the aid of their party.";
+
+void
+umain(int argc, char **argv)
+{
+  800033:	55                   	push   %ebp
+  800034:	89 e5                	mov    %esp,%ebp
+  800036:	56                   	push   %esi
+  800037:	53                   	push   %ebx
+  800038:	83 ec 7c             	sub    $0x7c,%esp
+  char buf[100];
+  int i, pid, p[2];
+
+  binaryname = "pipereadeof";
+  80003b:	c7 05 04 50 80 00 00 	movl   $0x803c00,0x805004
+  800042:	3c 80 00 
+
+  if ((i = pipe(p)) < 0)
+  800045:	8d 45 8c             	lea    -0x74(%ebp),%eax
+  800048:	50                   	push   %eax
+  800049:	e8 71 2d 00 00       	call   802dbf <pipe>
+  80004e:	89 c6                	mov    %eax,%esi
+  800050:	83 c4 10             	add    $0x10,%esp
+  800053:	85 c0                	test   %eax,%eax
+  800055:	0f 88 1b 01 00 00    	js     800176 <umain+0x143>
+    panic("pipe: %e", i);
+
+  if ((pid = fork()) < 0)
+  80005b:	e8 44 14 00 00       	call   8014a4 <fork>
+  800060:	89 c3                	mov    %eax,%ebx
+  800062:	85 c0                	test   %eax,%eax
+  800064:	0f 88 1e 01 00 00    	js     800188 <umain+0x155>
+    panic("fork: %e", i);
+
+  if (pid == 0) {
+  80006a:	0f 85 56 01 00 00    	jne    8001c6 <umain+0x193>
+    cprintf("[%08x] pipereadeof close %d\n", thisenv->env_id, p[1]);
+  800070:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  800075:	8b 40 48             	mov    0x48(%eax),%eax
+  800078:	83 ec 04             	sub    $0x4,%esp
+  80007b:	ff 75 90             	push   -0x70(%ebp)
+  80007e:	50                   	push   %eax
+  80007f:	68 25 3c 80 00       	push   $0x803c25
+  800084:	e8 91 03 00 00       	call   80041a <cprintf>
+    close(p[1]);
+  800089:	83 c4 04             	add    $0x4,%esp
+  80008c:	ff 75 90             	push   -0x70(%ebp)
+  80008f:	e8 23 18 00 00       	call   8018b7 <close>
+    cprintf("[%08x] pipereadeof readn %d\n", thisenv->env_id, p[0]);
+  800094:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  800099:	8b 40 48             	mov    0x48(%eax),%eax
+  80009c:	83 c4 0c             	add    $0xc,%esp
+  80009f:	ff 75 8c             	push   -0x74(%ebp)
+  8000a2:	50                   	push   %eax
+  8000a3:	68 42 3c 80 00       	push   $0x803c42
+  8000a8:	e8 6d 03 00 00       	call   80041a <cprintf>
+    i = readn(p[0], buf, sizeof buf-1);
+  8000ad:	83 c4 0c             	add    $0xc,%esp
+  8000b0:	6a 63                	push   $0x63
+  8000b2:	8d 45 94             	lea    -0x6c(%ebp),%eax
+  8000b5:	50                   	push   %eax
+  8000b6:	ff 75 8c             	push   -0x74(%ebp)
+  8000b9:	e8 08 1a 00 00       	call   801ac6 <readn>
+  8000be:	89 c6                	mov    %eax,%esi
+    if (i < 0)
+  8000c0:	83 c4 10             	add    $0x10,%esp
+  8000c3:	85 c0                	test   %eax,%eax
+  8000c5:	0f 88 cf 00 00 00    	js     80019a <umain+0x167>
+      panic("read: %e", i);
+    buf[i] = 0;
+  8000cb:	c6 44 05 94 00       	movb   $0x0,-0x6c(%ebp,%eax,1)
+    if (strcmp(buf, msg) == 0)
+  8000d0:	83 ec 08             	sub    $0x8,%esp
+  8000d3:	ff 35 00 50 80 00    	push   0x805000
+  8000d9:	8d 45 94             	lea    -0x6c(%ebp),%eax
+  8000dc:	50                   	push   %eax
+  8000dd:	e8 d7 09 00 00       	call   800ab9 <strcmp>
+  8000e2:	83 c4 10             	add    $0x10,%esp
+  8000e5:	85 c0                	test   %eax,%eax
+  8000e7:	0f 85 bf 00 00 00    	jne    8001ac <umain+0x179>
+      cprintf("\npipe read closed properly\n");
+  8000ed:	83 ec 0c             	sub    $0xc,%esp
+  8000f0:	68 68 3c 80 00       	push   $0x803c68
+  8000f5:	e8 20 03 00 00       	call   80041a <cprintf>
+  8000fa:	83 c4 10             	add    $0x10,%esp
+    else
+      cprintf("\ngot %d bytes: %s\n", i, buf);
+    exit();
+  8000fd:	e8 23 02 00 00       	call   800325 <exit>
+    cprintf("[%08x] pipereadeof write %d\n", thisenv->env_id, p[1]);
+    if ((i = write(p[1], msg, strlen(msg))) != strlen(msg))
+      panic("write: %e", i);
+    close(p[1]);
+  }
+  wait(pid);
+  800102:	83 ec 0c             	sub    $0xc,%esp
+  800105:	53                   	push   %ebx
+  800106:	e8 ac 2e 00 00       	call   802fb7 <wait>
+
+  binaryname = "pipewriteeof";
+  80010b:	c7 05 04 50 80 00 be 	movl   $0x803cbe,0x805004
+  800112:	3c 80 00 
+  if ((i = pipe(p)) < 0)
+  800115:	8d 45 8c             	lea    -0x74(%ebp),%eax
+  800118:	89 04 24             	mov    %eax,(%esp)
+  80011b:	e8 9f 2c 00 00       	call   802dbf <pipe>
+  800120:	89 c6                	mov    %eax,%esi
+  800122:	83 c4 10             	add    $0x10,%esp
+  800125:	85 c0                	test   %eax,%eax
+  800127:	0f 88 32 01 00 00    	js     80025f <umain+0x22c>
+    panic("pipe: %e", i);
+
+  if ((pid = fork()) < 0)
+  80012d:	e8 72 13 00 00       	call   8014a4 <fork>
+  800132:	89 c3                	mov    %eax,%ebx
+  800134:	85 c0                	test   %eax,%eax
+  800136:	0f 88 35 01 00 00    	js     800271 <umain+0x23e>
+    panic("fork: %e", i);
+
+  if (pid == 0) {
+  80013c:	0f 84 41 01 00 00    	je     800283 <umain+0x250>
+        break;
+    }
+    cprintf("\npipe write closed properly\n");
+    exit();
+  }
+  close(p[0]);
+  800142:	83 ec 0c             	sub    $0xc,%esp
+  800145:	ff 75 8c             	push   -0x74(%ebp)
+  800148:	e8 6a 17 00 00       	call   8018b7 <close>
+  close(p[1]);
+  80014d:	83 c4 04             	add    $0x4,%esp
+  800150:	ff 75 90             	push   -0x70(%ebp)
+  800153:	e8 5f 17 00 00       	call   8018b7 <close>
+  wait(pid);
+  800158:	89 1c 24             	mov    %ebx,(%esp)
+  80015b:	e8 57 2e 00 00       	call   802fb7 <wait>
+
+  cprintf("pipe tests passed\n");
+  800160:	c7 04 24 ec 3c 80 00 	movl   $0x803cec,(%esp)
+  800167:	e8 ae 02 00 00       	call   80041a <cprintf>
+}
+  80016c:	83 c4 10             	add    $0x10,%esp
+  80016f:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800172:	5b                   	pop    %ebx
+  800173:	5e                   	pop    %esi
+  800174:	5d                   	pop    %ebp
+  800175:	c3                   	ret
+    panic("pipe: %e", i);
+  800176:	50                   	push   %eax
+  800177:	68 0c 3c 80 00       	push   $0x803c0c
+  80017c:	6a 0e                	push   $0xe
+  80017e:	68 15 3c 80 00       	push   $0x803c15
+  800183:	e8 b7 01 00 00       	call   80033f <_panic>
+    panic("fork: %e", i);
+  800188:	56                   	push   %esi
+  800189:	68 23 41 80 00       	push   $0x804123
+  80018e:	6a 11                	push   $0x11
+  800190:	68 15 3c 80 00       	push   $0x803c15
+  800195:	e8 a5 01 00 00       	call   80033f <_panic>
+      panic("read: %e", i);
+  80019a:	50                   	push   %eax
+  80019b:	68 5f 3c 80 00       	push   $0x803c5f
+  8001a0:	6a 19                	push   $0x19
+  8001a2:	68 15 3c 80 00       	push   $0x803c15
+  8001a7:	e8 93 01 00 00       	call   80033f <_panic>
+      cprintf("\ngot %d bytes: %s\n", i, buf);
+  8001ac:	83 ec 04             	sub    $0x4,%esp
+  8001af:	8d 45 94             	lea    -0x6c(%ebp),%eax
+  8001b2:	50                   	push   %eax
+  8001b3:	56                   	push   %esi
+  8001b4:	68 84 3c 80 00       	push   $0x803c84
+  8001b9:	e8 5c 02 00 00       	call   80041a <cprintf>
+  8001be:	83 c4 10             	add    $0x10,%esp
+  8001c1:	e9 37 ff ff ff       	jmp    8000fd <umain+0xca>
+    cprintf("[%08x] pipereadeof close %d\n", thisenv->env_id, p[0]);
+  8001c6:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  8001cb:	8b 40 48             	mov    0x48(%eax),%eax
+  8001ce:	83 ec 04             	sub    $0x4,%esp
+  8001d1:	ff 75 8c             	push   -0x74(%ebp)
+  8001d4:	50                   	push   %eax
+  8001d5:	68 25 3c 80 00       	push   $0x803c25
+  8001da:	e8 3b 02 00 00       	call   80041a <cprintf>
+    close(p[0]);
+  8001df:	83 c4 04             	add    $0x4,%esp
+  8001e2:	ff 75 8c             	push   -0x74(%ebp)
+  8001e5:	e8 cd 16 00 00       	call   8018b7 <close>
+    cprintf("[%08x] pipereadeof write %d\n", thisenv->env_id, p[1]);
+  8001ea:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  8001ef:	8b 40 48             	mov    0x48(%eax),%eax
+  8001f2:	83 c4 0c             	add    $0xc,%esp
+  8001f5:	ff 75 90             	push   -0x70(%ebp)
+  8001f8:	50                   	push   %eax
+  8001f9:	68 97 3c 80 00       	push   $0x803c97
+  8001fe:	e8 17 02 00 00       	call   80041a <cprintf>
+    if ((i = write(p[1], msg, strlen(msg))) != strlen(msg))
+  800203:	83 c4 04             	add    $0x4,%esp
+  800206:	ff 35 00 50 80 00    	push   0x805000
+  80020c:	e8 bc 07 00 00       	call   8009cd <strlen>
+  800211:	83 c4 0c             	add    $0xc,%esp
+  800214:	50                   	push   %eax
+  800215:	ff 35 00 50 80 00    	push   0x805000
+  80021b:	ff 75 90             	push   -0x70(%ebp)
+  80021e:	e8 ea 18 00 00       	call   801b0d <write>
+  800223:	89 c6                	mov    %eax,%esi
+  800225:	83 c4 04             	add    $0x4,%esp
+  800228:	ff 35 00 50 80 00    	push   0x805000
+  80022e:	e8 9a 07 00 00       	call   8009cd <strlen>
+  800233:	83 c4 10             	add    $0x10,%esp
+  800236:	39 f0                	cmp    %esi,%eax
+  800238:	75 13                	jne    80024d <umain+0x21a>
+    close(p[1]);
+  80023a:	83 ec 0c             	sub    $0xc,%esp
+  80023d:	ff 75 90             	push   -0x70(%ebp)
+  800240:	e8 72 16 00 00       	call   8018b7 <close>
+  800245:	83 c4 10             	add    $0x10,%esp
+  800248:	e9 b5 fe ff ff       	jmp    800102 <umain+0xcf>
+      panic("write: %e", i);
+  80024d:	56                   	push   %esi
+  80024e:	68 b4 3c 80 00       	push   $0x803cb4
+  800253:	6a 25                	push   $0x25
+  800255:	68 15 3c 80 00       	push   $0x803c15
+  80025a:	e8 e0 00 00 00       	call   80033f <_panic>
+    panic("pipe: %e", i);
+  80025f:	50                   	push   %eax
+  800260:	68 0c 3c 80 00       	push   $0x803c0c
+  800265:	6a 2c                	push   $0x2c
+  800267:	68 15 3c 80 00       	push   $0x803c15
+  80026c:	e8 ce 00 00 00       	call   80033f <_panic>
+    panic("fork: %e", i);
+  800271:	56                   	push   %esi
+  800272:	68 23 41 80 00       	push   $0x804123
+  800277:	6a 2f                	push   $0x2f
+  800279:	68 15 3c 80 00       	push   $0x803c15
+  80027e:	e8 bc 00 00 00       	call   80033f <_panic>
+    close(p[0]);
+  800283:	83 ec 0c             	sub    $0xc,%esp
+  800286:	ff 75 8c             	push   -0x74(%ebp)
+  800289:	e8 29 16 00 00       	call   8018b7 <close>
+  80028e:	83 c4 10             	add    $0x10,%esp
+      cprintf(".");
+  800291:	83 ec 0c             	sub    $0xc,%esp
+  800294:	68 cb 3c 80 00       	push   $0x803ccb
+  800299:	e8 7c 01 00 00       	call   80041a <cprintf>
+      if (write(p[1], "x", 1) != 1)
+  80029e:	83 c4 0c             	add    $0xc,%esp
+  8002a1:	6a 01                	push   $0x1
+  8002a3:	68 cd 3c 80 00       	push   $0x803ccd
+  8002a8:	ff 75 90             	push   -0x70(%ebp)
+  8002ab:	e8 5d 18 00 00       	call   801b0d <write>
+  8002b0:	83 c4 10             	add    $0x10,%esp
+  8002b3:	83 f8 01             	cmp    $0x1,%eax
+  8002b6:	74 d9                	je     800291 <umain+0x25e>
+    cprintf("\npipe write closed properly\n");
+  8002b8:	83 ec 0c             	sub    $0xc,%esp
+  8002bb:	68 cf 3c 80 00       	push   $0x803ccf
+  8002c0:	e8 55 01 00 00       	call   80041a <cprintf>
+    exit();
+  8002c5:	e8 5b 00 00 00       	call   800325 <exit>
+  8002ca:	83 c4 10             	add    $0x10,%esp
+  8002cd:	e9 70 fe ff ff       	jmp    800142 <umain+0x10f>
+
+008002d2 <libmain>:
+const volatile struct Env *thisenv;
+const char *binaryname = "<unknown>";
+
+void
+libmain(int argc, char **argv)
+{
+  8002d2:	55                   	push   %ebp
+  8002d3:	89 e5                	mov    %esp,%ebp
+  8002d5:	56                   	push   %esi
+  8002d6:	53                   	push   %ebx
+  8002d7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  8002da:	8b 75 0c             	mov    0xc(%ebp),%esi
+  // set thisenv to point at our Env structure in envs[].
+  // LAB 3: Your code here.
+
+  thisenv = 0;
+  8002dd:	c7 05 a0 68 80 00 00 	movl   $0x0,0x8068a0
+  8002e4:	00 00 00 
+
+  envid_t env_id = sys_getenvid();
+  8002e7:	e8 ca 0a 00 00       	call   800db6 <sys_getenvid>
+  thisenv = &envs[ENVX(env_id)];
+  8002ec:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8002f1:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8002f4:	c1 e0 04             	shl    $0x4,%eax
+  8002f7:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8002fc:	a3 a0 68 80 00       	mov    %eax,0x8068a0
+
+  // save the name of the program so that panic() can use it
+  if (argc > 0)
+  800301:	85 db                	test   %ebx,%ebx
+  800303:	7e 07                	jle    80030c <libmain+0x3a>
+    binaryname = argv[0];
+  800305:	8b 06                	mov    (%esi),%eax
+  800307:	a3 04 50 80 00       	mov    %eax,0x805004
+
+  // call user main routine
+  umain(argc, argv);
+  80030c:	83 ec 08             	sub    $0x8,%esp
+  80030f:	56                   	push   %esi
+  800310:	53                   	push   %ebx
+  800311:	e8 1d fd ff ff       	call   800033 <umain>
+
+  // exit gracefully
+  exit();
+  800316:	e8 0a 00 00 00       	call   800325 <exit>
+}
+  80031b:	83 c4 10             	add    $0x10,%esp
+  80031e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  800321:	5b                   	pop    %ebx
+  800322:	5e                   	pop    %esi
+  800323:	5d                   	pop    %ebp
+  800324:	c3                   	ret
+
+00800325 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void)
+{
+  800325:	55                   	push   %ebp
+  800326:	89 e5                	mov    %esp,%ebp
+  800328:	83 ec 08             	sub    $0x8,%esp
+  close_all();
+  80032b:	e8 b4 15 00 00       	call   8018e4 <close_all>
+  sys_env_destroy(0);
+  800330:	83 ec 0c             	sub    $0xc,%esp
+  800333:	6a 00                	push   $0x0
+  800335:	e8 3b 0a 00 00       	call   800d75 <sys_env_destroy>
+}
+  80033a:	83 c4 10             	add    $0x10,%esp
+  80033d:	c9                   	leave
+  80033e:	c3                   	ret
+
+0080033f <_panic>:
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor.
+ */
+void
+_panic(const char *file, int line, const char *fmt, ...)
+{
+  80033f:	55                   	push   %ebp
+  800340:	89 e5                	mov    %esp,%ebp
+  800342:	56                   	push   %esi
+  800343:	53                   	push   %ebx
+  va_list ap;
+
+  va_start(ap, fmt);
+  800344:	8d 5d 14             	lea    0x14(%ebp),%ebx
+
+  // Print the panic message
+  cprintf("[%08x] user panic in %s at %s:%d: ",
+  800347:	8b 35 04 50 80 00    	mov    0x805004,%esi
+  80034d:	e8 64 0a 00 00       	call   800db6 <sys_getenvid>
+  800352:	83 ec 0c             	sub    $0xc,%esp
+  800355:	ff 75 0c             	push   0xc(%ebp)
+  800358:	ff 75 08             	push   0x8(%ebp)
+  80035b:	56                   	push   %esi
+  80035c:	50                   	push   %eax
+  80035d:	68 50 3d 80 00       	push   $0x803d50
+  800362:	e8 b3 00 00 00       	call   80041a <cprintf>
+          sys_getenvid(), binaryname, file, line);
+  vcprintf(fmt, ap);
+  800367:	83 c4 18             	add    $0x18,%esp
+  80036a:	53                   	push   %ebx
+  80036b:	ff 75 10             	push   0x10(%ebp)
+  80036e:	e8 56 00 00 00       	call   8003c9 <vcprintf>
+  cprintf("\n");
+  800373:	c7 04 24 40 3c 80 00 	movl   $0x803c40,(%esp)
+  80037a:	e8 9b 00 00 00       	call   80041a <cprintf>
+  80037f:	83 c4 10             	add    $0x10,%esp
+
+  // Cause a breakpoint exception
+  while (1)
+    asm volatile ("int3");
+  800382:	cc                   	int3
+  while (1)
+  800383:	eb fd                	jmp    800382 <_panic+0x43>
+
+00800385 <putch>:
+};
+
+
+static void
+putch(int ch, struct printbuf *b)
+{
+  800385:	55                   	push   %ebp
+  800386:	89 e5                	mov    %esp,%ebp
+  800388:	53                   	push   %ebx
+  800389:	83 ec 04             	sub    $0x4,%esp
+  80038c:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  b->buf[b->idx++] = ch;
+  80038f:	8b 13                	mov    (%ebx),%edx
+  800391:	8d 42 01             	lea    0x1(%edx),%eax
+  800394:	89 03                	mov    %eax,(%ebx)
+  800396:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800399:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+  if (b->idx == 256-1) {
+  80039d:	3d ff 00 00 00       	cmp    $0xff,%eax
+  8003a2:	74 09                	je     8003ad <putch+0x28>
+    sys_cputs(b->buf, b->idx);
+    b->idx = 0;
+  }
+  b->cnt++;
+  8003a4:	83 43 04 01          	addl   $0x1,0x4(%ebx)
+}
+  8003a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8003ab:	c9                   	leave
+  8003ac:	c3                   	ret
+    sys_cputs(b->buf, b->idx);
+  8003ad:	83 ec 08             	sub    $0x8,%esp
+  8003b0:	68 ff 00 00 00       	push   $0xff
+  8003b5:	8d 43 08             	lea    0x8(%ebx),%eax
+  8003b8:	50                   	push   %eax
+  8003b9:	e8 7a 09 00 00       	call   800d38 <sys_cputs>
+    b->idx = 0;
+  8003be:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+  8003c4:	83 c4 10             	add    $0x10,%esp
+  8003c7:	eb db                	jmp    8003a4 <putch+0x1f>
+
+008003c9 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap)
+{
+  8003c9:	55                   	push   %ebp
+  8003ca:	89 e5                	mov    %esp,%ebp
+  8003cc:	81 ec 18 01 00 00    	sub    $0x118,%esp
+  struct printbuf b;
+
+  b.idx = 0;
+  8003d2:	c7 85 f0 fe ff ff 00 	movl   $0x0,-0x110(%ebp)
+  8003d9:	00 00 00 
+  b.cnt = 0;
+  8003dc:	c7 85 f4 fe ff ff 00 	movl   $0x0,-0x10c(%ebp)
+  8003e3:	00 00 00 
+  vprintfmt((void*)putch, &b, fmt, ap);
+  8003e6:	ff 75 0c             	push   0xc(%ebp)
+  8003e9:	ff 75 08             	push   0x8(%ebp)
+  8003ec:	8d 85 f0 fe ff ff    	lea    -0x110(%ebp),%eax
+  8003f2:	50                   	push   %eax
+  8003f3:	68 85 03 80 00       	push   $0x800385
+  8003f8:	e8 14 01 00 00       	call   800511 <vprintfmt>
+  sys_cputs(b.buf, b.idx);
+  8003fd:	83 c4 08             	add    $0x8,%esp
+  800400:	ff b5 f0 fe ff ff    	push   -0x110(%ebp)
+  800406:	8d 85 f8 fe ff ff    	lea    -0x108(%ebp),%eax
+  80040c:	50                   	push   %eax
+  80040d:	e8 26 09 00 00       	call   800d38 <sys_cputs>
+
+  return b.cnt;
+}
+  800412:	8b 85 f4 fe ff ff    	mov    -0x10c(%ebp),%eax
+  800418:	c9                   	leave
+  800419:	c3                   	ret
+
+0080041a <cprintf>:
+
+int
+cprintf(const char *fmt, ...)
+{
+  80041a:	55                   	push   %ebp
+  80041b:	89 e5                	mov    %esp,%ebp
+  80041d:	83 ec 10             	sub    $0x10,%esp
+  va_list ap;
+  int cnt;
+
+  va_start(ap, fmt);
+  800420:	8d 45 0c             	lea    0xc(%ebp),%eax
+  cnt = vcprintf(fmt, ap);
+  800423:	50                   	push   %eax
+  800424:	ff 75 08             	push   0x8(%ebp)
+  800427:	e8 9d ff ff ff       	call   8003c9 <vcprintf>
+  va_end(ap);
+
+  return cnt;
+}
+  80042c:	c9                   	leave
+  80042d:	c3                   	ret
+
+0080042e <printnum>:
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+printnum(void (*putch)(int, void*), void *putdat,
+         unsigned long long num, unsigned base, int width, int padc)
+{
+  80042e:	55                   	push   %ebp
+  80042f:	89 e5                	mov    %esp,%ebp
+  800431:	57                   	push   %edi
+  800432:	56                   	push   %esi
+  800433:	53                   	push   %ebx
+  800434:	83 ec 1c             	sub    $0x1c,%esp
+  800437:	89 c7                	mov    %eax,%edi
+  800439:	89 d6                	mov    %edx,%esi
+  80043b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80043e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  800441:	89 d1                	mov    %edx,%ecx
+  800443:	89 c2                	mov    %eax,%edx
+  800445:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  800448:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  80044b:	8b 45 10             	mov    0x10(%ebp),%eax
+  80044e:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  // first recursively print all preceding (more significant) digits
+  if (num >= base)
+  800451:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800454:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  80045b:	39 c2                	cmp    %eax,%edx
+  80045d:	1b 4d e4             	sbb    -0x1c(%ebp),%ecx
+  800460:	72 3e                	jb     8004a0 <printnum+0x72>
+    printnum(putch, putdat, num / base, base, width - 1, padc);
+  800462:	83 ec 0c             	sub    $0xc,%esp
+  800465:	ff 75 18             	push   0x18(%ebp)
+  800468:	83 eb 01             	sub    $0x1,%ebx
+  80046b:	53                   	push   %ebx
+  80046c:	50                   	push   %eax
+  80046d:	83 ec 08             	sub    $0x8,%esp
+  800470:	ff 75 e4             	push   -0x1c(%ebp)
+  800473:	ff 75 e0             	push   -0x20(%ebp)
+  800476:	ff 75 dc             	push   -0x24(%ebp)
+  800479:	ff 75 d8             	push   -0x28(%ebp)
+  80047c:	e8 e1 35 00 00       	call   803a62 <__udivdi3>
+  800481:	83 c4 18             	add    $0x18,%esp
+  800484:	52                   	push   %edx
+  800485:	50                   	push   %eax
+  800486:	89 f2                	mov    %esi,%edx
+  800488:	89 f8                	mov    %edi,%eax
+  80048a:	e8 9f ff ff ff       	call   80042e <printnum>
+  80048f:	83 c4 20             	add    $0x20,%esp
+  800492:	eb 13                	jmp    8004a7 <printnum+0x79>
+  else {
+    // print any needed pad characters before first digit
+    while (--width > 0)
+      putch(padc, putdat);
+  800494:	83 ec 08             	sub    $0x8,%esp
+  800497:	56                   	push   %esi
+  800498:	ff 75 18             	push   0x18(%ebp)
+  80049b:	ff d7                	call   *%edi
+  80049d:	83 c4 10             	add    $0x10,%esp
+    while (--width > 0)
+  8004a0:	83 eb 01             	sub    $0x1,%ebx
+  8004a3:	85 db                	test   %ebx,%ebx
+  8004a5:	7f ed                	jg     800494 <printnum+0x66>
+  }
+
+  // then print this (the least significant) digit
+  putch("0123456789abcdef"[num % base], putdat);
+  8004a7:	83 ec 08             	sub    $0x8,%esp
+  8004aa:	56                   	push   %esi
+  8004ab:	83 ec 04             	sub    $0x4,%esp
+  8004ae:	ff 75 e4             	push   -0x1c(%ebp)
+  8004b1:	ff 75 e0             	push   -0x20(%ebp)
+  8004b4:	ff 75 dc             	push   -0x24(%ebp)
+  8004b7:	ff 75 d8             	push   -0x28(%ebp)
+  8004ba:	e8 c4 35 00 00       	call   803a83 <__umoddi3>
+  8004bf:	83 c4 14             	add    $0x14,%esp
+  8004c2:	0f be 80 73 3d 80 00 	movsbl 0x803d73(%eax),%eax
+  8004c9:	50                   	push   %eax
+  8004ca:	ff d7                	call   *%edi
+}
+  8004cc:	83 c4 10             	add    $0x10,%esp
+  8004cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8004d2:	5b                   	pop    %ebx
+  8004d3:	5e                   	pop    %esi
+  8004d4:	5f                   	pop    %edi
+  8004d5:	5d                   	pop    %ebp
+  8004d6:	c3                   	ret
+
+008004d7 <sprintputch>:
+  int cnt;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *b)
+{
+  8004d7:	55                   	push   %ebp
+  8004d8:	89 e5                	mov    %esp,%ebp
+  8004da:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b->cnt++;
+  8004dd:	83 40 08 01          	addl   $0x1,0x8(%eax)
+  if (b->buf < b->ebuf)
+  8004e1:	8b 10                	mov    (%eax),%edx
+  8004e3:	3b 50 04             	cmp    0x4(%eax),%edx
+  8004e6:	73 0a                	jae    8004f2 <sprintputch+0x1b>
+    *b->buf++ = ch;
+  8004e8:	8d 4a 01             	lea    0x1(%edx),%ecx
+  8004eb:	89 08                	mov    %ecx,(%eax)
+  8004ed:	8b 45 08             	mov    0x8(%ebp),%eax
+  8004f0:	88 02                	mov    %al,(%edx)
+}
+  8004f2:	5d                   	pop    %ebp
+  8004f3:	c3                   	ret
+
+008004f4 <printfmt>:
+{
+  8004f4:	55                   	push   %ebp
+  8004f5:	89 e5                	mov    %esp,%ebp
+  8004f7:	83 ec 08             	sub    $0x8,%esp
+  va_start(ap, fmt);
+  8004fa:	8d 45 14             	lea    0x14(%ebp),%eax
+  vprintfmt(putch, putdat, fmt, ap);
+  8004fd:	50                   	push   %eax
+  8004fe:	ff 75 10             	push   0x10(%ebp)
+  800501:	ff 75 0c             	push   0xc(%ebp)
+  800504:	ff 75 08             	push   0x8(%ebp)
+  800507:	e8 05 00 00 00       	call   800511 <vprintfmt>
+}
+  80050c:	83 c4 10             	add    $0x10,%esp
+  80050f:	c9                   	leave
+  800510:	c3                   	ret
+
+00800511 <vprintfmt>:
+{
+  800511:	55                   	push   %ebp
+  800512:	89 e5                	mov    %esp,%ebp
+  800514:	57                   	push   %edi
+  800515:	56                   	push   %esi
+  800516:	53                   	push   %ebx
+  800517:	83 ec 2c             	sub    $0x2c,%esp
+  80051a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80051d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  800520:	8b 7d 10             	mov    0x10(%ebp),%edi
+  800523:	eb 0a                	jmp    80052f <vprintfmt+0x1e>
+      putch(ch, putdat);
+  800525:	83 ec 08             	sub    $0x8,%esp
+  800528:	53                   	push   %ebx
+  800529:	50                   	push   %eax
+  80052a:	ff d6                	call   *%esi
+  80052c:	83 c4 10             	add    $0x10,%esp
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  80052f:	83 c7 01             	add    $0x1,%edi
+  800532:	0f b6 47 ff          	movzbl -0x1(%edi),%eax
+  800536:	83 f8 25             	cmp    $0x25,%eax
+  800539:	74 0c                	je     800547 <vprintfmt+0x36>
+      if (ch == '\0')
+  80053b:	85 c0                	test   %eax,%eax
+  80053d:	75 e6                	jne    800525 <vprintfmt+0x14>
+}
+  80053f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800542:	5b                   	pop    %ebx
+  800543:	5e                   	pop    %esi
+  800544:	5f                   	pop    %edi
+  800545:	5d                   	pop    %ebp
+  800546:	c3                   	ret
+    padc = ' ';
+  800547:	c6 45 d7 20          	movb   $0x20,-0x29(%ebp)
+    altflag = 0;
+  80054b:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+    precision = -1;
+  800552:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+    width = -1;
+  800559:	c7 45 e0 ff ff ff ff 	movl   $0xffffffff,-0x20(%ebp)
+    lflag = 0;
+  800560:	b9 00 00 00 00       	mov    $0x0,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  800565:	8d 47 01             	lea    0x1(%edi),%eax
+  800568:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  80056b:	0f b6 17             	movzbl (%edi),%edx
+  80056e:	8d 42 dd             	lea    -0x23(%edx),%eax
+  800571:	3c 55                	cmp    $0x55,%al
+  800573:	0f 87 cf 03 00 00    	ja     800948 <vprintfmt+0x437>
+  800579:	0f b6 c0             	movzbl %al,%eax
+  80057c:	ff 24 85 c0 3e 80 00 	jmp    *0x803ec0(,%eax,4)
+  800583:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      padc = '-';
+  800586:	c6 45 d7 2d          	movb   $0x2d,-0x29(%ebp)
+  80058a:	eb d9                	jmp    800565 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  80058c:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+  80058f:	c6 45 d7 30          	movb   $0x30,-0x29(%ebp)
+  800593:	eb d0                	jmp    800565 <vprintfmt+0x54>
+  800595:	0f b6 d2             	movzbl %dl,%edx
+  800598:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      for (precision = 0;; ++fmt) {
+  80059b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005a0:	89 4d e4             	mov    %ecx,-0x1c(%ebp)
+        precision = precision * 10 + ch - '0';
+  8005a3:	8d 04 80             	lea    (%eax,%eax,4),%eax
+  8005a6:	8d 44 42 d0          	lea    -0x30(%edx,%eax,2),%eax
+        ch = *fmt;
+  8005aa:	0f be 17             	movsbl (%edi),%edx
+        if (ch < '0' || ch > '9')
+  8005ad:	8d 4a d0             	lea    -0x30(%edx),%ecx
+  8005b0:	83 f9 09             	cmp    $0x9,%ecx
+  8005b3:	77 55                	ja     80060a <vprintfmt+0xf9>
+      for (precision = 0;; ++fmt) {
+  8005b5:	83 c7 01             	add    $0x1,%edi
+        precision = precision * 10 + ch - '0';
+  8005b8:	eb e9                	jmp    8005a3 <vprintfmt+0x92>
+      precision = va_arg(ap, int);
+  8005ba:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005bd:	8b 00                	mov    (%eax),%eax
+  8005bf:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  8005c2:	8b 45 14             	mov    0x14(%ebp),%eax
+  8005c5:	8d 40 04             	lea    0x4(%eax),%eax
+  8005c8:	89 45 14             	mov    %eax,0x14(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  8005cb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      if (width < 0)
+  8005ce:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8005d2:	79 91                	jns    800565 <vprintfmt+0x54>
+        width = precision, precision = -1;
+  8005d4:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  8005d7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8005da:	c7 45 d0 ff ff ff ff 	movl   $0xffffffff,-0x30(%ebp)
+  8005e1:	eb 82                	jmp    800565 <vprintfmt+0x54>
+      if (width < 0)
+  8005e3:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  8005e6:	85 d2                	test   %edx,%edx
+  8005e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005ed:	0f 49 c2             	cmovns %edx,%eax
+  8005f0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    switch (ch = *(unsigned char*)fmt++) {
+  8005f3:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  8005f6:	e9 6a ff ff ff       	jmp    800565 <vprintfmt+0x54>
+    switch (ch = *(unsigned char*)fmt++) {
+  8005fb:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      altflag = 1;
+  8005fe:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+      goto reswitch;
+  800605:	e9 5b ff ff ff       	jmp    800565 <vprintfmt+0x54>
+  80060a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80060d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  800610:	eb bc                	jmp    8005ce <vprintfmt+0xbd>
+      lflag++;
+  800612:	83 c1 01             	add    $0x1,%ecx
+    switch (ch = *(unsigned char*)fmt++) {
+  800615:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+      goto reswitch;
+  800618:	e9 48 ff ff ff       	jmp    800565 <vprintfmt+0x54>
+      putch(va_arg(ap, int), putdat);
+  80061d:	8b 45 14             	mov    0x14(%ebp),%eax
+  800620:	8d 78 04             	lea    0x4(%eax),%edi
+  800623:	83 ec 08             	sub    $0x8,%esp
+  800626:	53                   	push   %ebx
+  800627:	ff 30                	push   (%eax)
+  800629:	ff d6                	call   *%esi
+      break;
+  80062b:	83 c4 10             	add    $0x10,%esp
+      putch(va_arg(ap, int), putdat);
+  80062e:	89 7d 14             	mov    %edi,0x14(%ebp)
+      break;
+  800631:	e9 b1 02 00 00       	jmp    8008e7 <vprintfmt+0x3d6>
+      err = va_arg(ap, int);
+  800636:	8b 45 14             	mov    0x14(%ebp),%eax
+  800639:	8d 78 04             	lea    0x4(%eax),%edi
+      if (err < 0)
+  80063c:	8b 10                	mov    (%eax),%edx
+  80063e:	89 d0                	mov    %edx,%eax
+  800640:	f7 d8                	neg    %eax
+  800642:	0f 48 c2             	cmovs  %edx,%eax
+      if (err >= MAXERROR || (p = error_string[err]) == NULL)
+  800645:	83 f8 10             	cmp    $0x10,%eax
+  800648:	7f 23                	jg     80066d <vprintfmt+0x15c>
+  80064a:	8b 14 85 20 40 80 00 	mov    0x804020(,%eax,4),%edx
+  800651:	85 d2                	test   %edx,%edx
+  800653:	74 18                	je     80066d <vprintfmt+0x15c>
+        printfmt(putch, putdat, "%s", p);
+  800655:	52                   	push   %edx
+  800656:	68 36 42 80 00       	push   $0x804236
+  80065b:	53                   	push   %ebx
+  80065c:	56                   	push   %esi
+  80065d:	e8 92 fe ff ff       	call   8004f4 <printfmt>
+  800662:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  800665:	89 7d 14             	mov    %edi,0x14(%ebp)
+  800668:	e9 7a 02 00 00       	jmp    8008e7 <vprintfmt+0x3d6>
+        printfmt(putch, putdat, "error %d", err);
+  80066d:	50                   	push   %eax
+  80066e:	68 8b 3d 80 00       	push   $0x803d8b
+  800673:	53                   	push   %ebx
+  800674:	56                   	push   %esi
+  800675:	e8 7a fe ff ff       	call   8004f4 <printfmt>
+  80067a:	83 c4 10             	add    $0x10,%esp
+      err = va_arg(ap, int);
+  80067d:	89 7d 14             	mov    %edi,0x14(%ebp)
+        printfmt(putch, putdat, "error %d", err);
+  800680:	e9 62 02 00 00       	jmp    8008e7 <vprintfmt+0x3d6>
+      if ((p = va_arg(ap, char *)) == NULL)
+  800685:	8b 45 14             	mov    0x14(%ebp),%eax
+  800688:	83 c0 04             	add    $0x4,%eax
+  80068b:	89 45 c8             	mov    %eax,-0x38(%ebp)
+  80068e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800691:	8b 08                	mov    (%eax),%ecx
+        p = "(null)";
+  800693:	85 c9                	test   %ecx,%ecx
+  800695:	b8 84 3d 80 00       	mov    $0x803d84,%eax
+  80069a:	0f 45 c1             	cmovne %ecx,%eax
+  80069d:	89 45 cc             	mov    %eax,-0x34(%ebp)
+      if (width > 0 && padc != '-')
+  8006a0:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  8006a4:	7e 06                	jle    8006ac <vprintfmt+0x19b>
+  8006a6:	80 7d d7 2d          	cmpb   $0x2d,-0x29(%ebp)
+  8006aa:	75 0b                	jne    8006b7 <vprintfmt+0x1a6>
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8006ac:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  8006af:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8006b2:	89 75 08             	mov    %esi,0x8(%ebp)
+  8006b5:	eb 5c                	jmp    800713 <vprintfmt+0x202>
+  8006b7:	83 ec 08             	sub    $0x8,%esp
+  8006ba:	ff 75 d0             	push   -0x30(%ebp)
+  8006bd:	ff 75 cc             	push   -0x34(%ebp)
+  8006c0:	e8 20 03 00 00       	call   8009e5 <strnlen>
+  8006c5:	89 c2                	mov    %eax,%edx
+  8006c7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006ca:	29 d0                	sub    %edx,%eax
+  8006cc:	83 c4 10             	add    $0x10,%esp
+          putch(padc, putdat);
+  8006cf:	0f be 7d d7          	movsbl -0x29(%ebp),%edi
+  8006d3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8006d6:	89 75 08             	mov    %esi,0x8(%ebp)
+  8006d9:	89 c6                	mov    %eax,%esi
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8006db:	eb 0e                	jmp    8006eb <vprintfmt+0x1da>
+          putch(padc, putdat);
+  8006dd:	83 ec 08             	sub    $0x8,%esp
+  8006e0:	53                   	push   %ebx
+  8006e1:	57                   	push   %edi
+  8006e2:	ff 55 08             	call   *0x8(%ebp)
+        for (width -= strnlen(p, precision); width > 0; width--)
+  8006e5:	83 ee 01             	sub    $0x1,%esi
+  8006e8:	83 c4 10             	add    $0x10,%esp
+  8006eb:	85 f6                	test   %esi,%esi
+  8006ed:	7f ee                	jg     8006dd <vprintfmt+0x1cc>
+  8006ef:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  8006f2:	8b 75 08             	mov    0x8(%ebp),%esi
+  8006f5:	85 c0                	test   %eax,%eax
+  8006f7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006fc:	0f 49 d0             	cmovns %eax,%edx
+  8006ff:	29 d0                	sub    %edx,%eax
+  800701:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  800704:	eb a6                	jmp    8006ac <vprintfmt+0x19b>
+          putch(ch, putdat);
+  800706:	83 ec 08             	sub    $0x8,%esp
+  800709:	53                   	push   %ebx
+  80070a:	52                   	push   %edx
+  80070b:	ff 55 08             	call   *0x8(%ebp)
+  80070e:	83 c4 10             	add    $0x10,%esp
+      for (; (ch = *p++) != '\0' && (precision < 0 || --precision >= 0); width--)
+  800711:	89 f1                	mov    %esi,%ecx
+  800713:	8d 71 01             	lea    0x1(%ecx),%esi
+  800716:	0f b6 46 ff          	movzbl -0x1(%esi),%eax
+  80071a:	0f be d0             	movsbl %al,%edx
+  80071d:	85 d2                	test   %edx,%edx
+  80071f:	74 28                	je     800749 <vprintfmt+0x238>
+  800721:	85 ff                	test   %edi,%edi
+  800723:	78 05                	js     80072a <vprintfmt+0x219>
+  800725:	83 ef 01             	sub    $0x1,%edi
+  800728:	78 30                	js     80075a <vprintfmt+0x249>
+        if (altflag && (ch < ' ' || ch > '~'))
+  80072a:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  80072e:	74 d6                	je     800706 <vprintfmt+0x1f5>
+  800730:	0f be c0             	movsbl %al,%eax
+  800733:	83 e8 20             	sub    $0x20,%eax
+  800736:	83 f8 5e             	cmp    $0x5e,%eax
+  800739:	76 cb                	jbe    800706 <vprintfmt+0x1f5>
+          putch('?', putdat);
+  80073b:	83 ec 08             	sub    $0x8,%esp
+  80073e:	53                   	push   %ebx
+  80073f:	6a 3f                	push   $0x3f
+  800741:	ff 55 08             	call   *0x8(%ebp)
+  800744:	83 c4 10             	add    $0x10,%esp
+  800747:	eb c8                	jmp    800711 <vprintfmt+0x200>
+  800749:	8b 75 08             	mov    0x8(%ebp),%esi
+  80074c:	8b 45 cc             	mov    -0x34(%ebp),%eax
+  80074f:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  800752:	01 d0                	add    %edx,%eax
+  800754:	29 c8                	sub    %ecx,%eax
+  800756:	89 c7                	mov    %eax,%edi
+  800758:	eb 13                	jmp    80076d <vprintfmt+0x25c>
+  80075a:	8b 75 08             	mov    0x8(%ebp),%esi
+  80075d:	eb ed                	jmp    80074c <vprintfmt+0x23b>
+        putch(' ', putdat);
+  80075f:	83 ec 08             	sub    $0x8,%esp
+  800762:	53                   	push   %ebx
+  800763:	6a 20                	push   $0x20
+  800765:	ff d6                	call   *%esi
+      for (; width > 0; width--)
+  800767:	83 ef 01             	sub    $0x1,%edi
+  80076a:	83 c4 10             	add    $0x10,%esp
+  80076d:	85 ff                	test   %edi,%edi
+  80076f:	7f ee                	jg     80075f <vprintfmt+0x24e>
+      if ((p = va_arg(ap, char *)) == NULL)
+  800771:	8b 45 c8             	mov    -0x38(%ebp),%eax
+  800774:	89 45 14             	mov    %eax,0x14(%ebp)
+  800777:	e9 6b 01 00 00       	jmp    8008e7 <vprintfmt+0x3d6>
+  if (lflag >= 2)
+  80077c:	83 f9 01             	cmp    $0x1,%ecx
+  80077f:	7f 1f                	jg     8007a0 <vprintfmt+0x28f>
+  else if (lflag)
+  800781:	85 c9                	test   %ecx,%ecx
+  800783:	74 67                	je     8007ec <vprintfmt+0x2db>
+    return va_arg(*ap, long);
+  800785:	8b 45 14             	mov    0x14(%ebp),%eax
+  800788:	8b 00                	mov    (%eax),%eax
+  80078a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  80078d:	89 c1                	mov    %eax,%ecx
+  80078f:	c1 f9 1f             	sar    $0x1f,%ecx
+  800792:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  800795:	8b 45 14             	mov    0x14(%ebp),%eax
+  800798:	8d 40 04             	lea    0x4(%eax),%eax
+  80079b:	89 45 14             	mov    %eax,0x14(%ebp)
+  80079e:	eb 17                	jmp    8007b7 <vprintfmt+0x2a6>
+    return va_arg(*ap, long long);
+  8007a0:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007a3:	8b 50 04             	mov    0x4(%eax),%edx
+  8007a6:	8b 00                	mov    (%eax),%eax
+  8007a8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007ab:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  8007ae:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007b1:	8d 40 08             	lea    0x8(%eax),%eax
+  8007b4:	89 45 14             	mov    %eax,0x14(%ebp)
+      if ((long long)num < 0) {
+  8007b7:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8007ba:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+      base = 10;
+  8007bd:	bf 0a 00 00 00       	mov    $0xa,%edi
+      if ((long long)num < 0) {
+  8007c2:	85 c9                	test   %ecx,%ecx
+  8007c4:	0f 89 03 01 00 00    	jns    8008cd <vprintfmt+0x3bc>
+        putch('-', putdat);
+  8007ca:	83 ec 08             	sub    $0x8,%esp
+  8007cd:	53                   	push   %ebx
+  8007ce:	6a 2d                	push   $0x2d
+  8007d0:	ff d6                	call   *%esi
+        num = -(long long)num;
+  8007d2:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  8007d5:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  8007d8:	f7 da                	neg    %edx
+  8007da:	83 d1 00             	adc    $0x0,%ecx
+  8007dd:	f7 d9                	neg    %ecx
+  8007df:	83 c4 10             	add    $0x10,%esp
+      base = 10;
+  8007e2:	bf 0a 00 00 00       	mov    $0xa,%edi
+  8007e7:	e9 e1 00 00 00       	jmp    8008cd <vprintfmt+0x3bc>
+    return va_arg(*ap, int);
+  8007ec:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ef:	8b 00                	mov    (%eax),%eax
+  8007f1:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  8007f4:	89 c1                	mov    %eax,%ecx
+  8007f6:	c1 f9 1f             	sar    $0x1f,%ecx
+  8007f9:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  8007fc:	8b 45 14             	mov    0x14(%ebp),%eax
+  8007ff:	8d 40 04             	lea    0x4(%eax),%eax
+  800802:	89 45 14             	mov    %eax,0x14(%ebp)
+  800805:	eb b0                	jmp    8007b7 <vprintfmt+0x2a6>
+  if (lflag >= 2)
+  800807:	83 f9 01             	cmp    $0x1,%ecx
+  80080a:	7f 1e                	jg     80082a <vprintfmt+0x319>
+  else if (lflag)
+  80080c:	85 c9                	test   %ecx,%ecx
+  80080e:	74 32                	je     800842 <vprintfmt+0x331>
+    return va_arg(*ap, unsigned long);
+  800810:	8b 45 14             	mov    0x14(%ebp),%eax
+  800813:	8b 10                	mov    (%eax),%edx
+  800815:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80081a:	8d 40 04             	lea    0x4(%eax),%eax
+  80081d:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800820:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long);
+  800825:	e9 a3 00 00 00       	jmp    8008cd <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  80082a:	8b 45 14             	mov    0x14(%ebp),%eax
+  80082d:	8b 10                	mov    (%eax),%edx
+  80082f:	8b 48 04             	mov    0x4(%eax),%ecx
+  800832:	8d 40 08             	lea    0x8(%eax),%eax
+  800835:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800838:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned long long);
+  80083d:	e9 8b 00 00 00       	jmp    8008cd <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800842:	8b 45 14             	mov    0x14(%ebp),%eax
+  800845:	8b 10                	mov    (%eax),%edx
+  800847:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80084c:	8d 40 04             	lea    0x4(%eax),%eax
+  80084f:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 10;
+  800852:	bf 0a 00 00 00       	mov    $0xa,%edi
+    return va_arg(*ap, unsigned int);
+  800857:	eb 74                	jmp    8008cd <vprintfmt+0x3bc>
+  if (lflag >= 2)
+  800859:	83 f9 01             	cmp    $0x1,%ecx
+  80085c:	7f 1b                	jg     800879 <vprintfmt+0x368>
+  else if (lflag)
+  80085e:	85 c9                	test   %ecx,%ecx
+  800860:	74 2c                	je     80088e <vprintfmt+0x37d>
+    return va_arg(*ap, unsigned long);
+  800862:	8b 45 14             	mov    0x14(%ebp),%eax
+  800865:	8b 10                	mov    (%eax),%edx
+  800867:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80086c:	8d 40 04             	lea    0x4(%eax),%eax
+  80086f:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800872:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long);
+  800877:	eb 54                	jmp    8008cd <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  800879:	8b 45 14             	mov    0x14(%ebp),%eax
+  80087c:	8b 10                	mov    (%eax),%edx
+  80087e:	8b 48 04             	mov    0x4(%eax),%ecx
+  800881:	8d 40 08             	lea    0x8(%eax),%eax
+  800884:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  800887:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned long long);
+  80088c:	eb 3f                	jmp    8008cd <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  80088e:	8b 45 14             	mov    0x14(%ebp),%eax
+  800891:	8b 10                	mov    (%eax),%edx
+  800893:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800898:	8d 40 04             	lea    0x4(%eax),%eax
+  80089b:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 8;
+  80089e:	bf 08 00 00 00       	mov    $0x8,%edi
+    return va_arg(*ap, unsigned int);
+  8008a3:	eb 28                	jmp    8008cd <vprintfmt+0x3bc>
+      putch('0', putdat);
+  8008a5:	83 ec 08             	sub    $0x8,%esp
+  8008a8:	53                   	push   %ebx
+  8008a9:	6a 30                	push   $0x30
+  8008ab:	ff d6                	call   *%esi
+      putch('x', putdat);
+  8008ad:	83 c4 08             	add    $0x8,%esp
+  8008b0:	53                   	push   %ebx
+  8008b1:	6a 78                	push   $0x78
+  8008b3:	ff d6                	call   *%esi
+      num = (unsigned long long)
+  8008b5:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008b8:	8b 10                	mov    (%eax),%edx
+  8008ba:	b9 00 00 00 00       	mov    $0x0,%ecx
+      goto number;
+  8008bf:	83 c4 10             	add    $0x10,%esp
+            (uintptr_t)va_arg(ap, void *);
+  8008c2:	8d 40 04             	lea    0x4(%eax),%eax
+  8008c5:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  8008c8:	bf 10 00 00 00       	mov    $0x10,%edi
+      printnum(putch, putdat, num, base, width, padc);
+  8008cd:	83 ec 0c             	sub    $0xc,%esp
+  8008d0:	0f be 45 d7          	movsbl -0x29(%ebp),%eax
+  8008d4:	50                   	push   %eax
+  8008d5:	ff 75 e0             	push   -0x20(%ebp)
+  8008d8:	57                   	push   %edi
+  8008d9:	51                   	push   %ecx
+  8008da:	52                   	push   %edx
+  8008db:	89 da                	mov    %ebx,%edx
+  8008dd:	89 f0                	mov    %esi,%eax
+  8008df:	e8 4a fb ff ff       	call   80042e <printnum>
+      break;
+  8008e4:	83 c4 20             	add    $0x20,%esp
+      err = va_arg(ap, int);
+  8008e7:	8b 7d e4             	mov    -0x1c(%ebp),%edi
+    while ((ch = *(unsigned char*)fmt++) != '%') {
+  8008ea:	e9 40 fc ff ff       	jmp    80052f <vprintfmt+0x1e>
+  if (lflag >= 2)
+  8008ef:	83 f9 01             	cmp    $0x1,%ecx
+  8008f2:	7f 1b                	jg     80090f <vprintfmt+0x3fe>
+  else if (lflag)
+  8008f4:	85 c9                	test   %ecx,%ecx
+  8008f6:	74 2c                	je     800924 <vprintfmt+0x413>
+    return va_arg(*ap, unsigned long);
+  8008f8:	8b 45 14             	mov    0x14(%ebp),%eax
+  8008fb:	8b 10                	mov    (%eax),%edx
+  8008fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800902:	8d 40 04             	lea    0x4(%eax),%eax
+  800905:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800908:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long);
+  80090d:	eb be                	jmp    8008cd <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned long long);
+  80090f:	8b 45 14             	mov    0x14(%ebp),%eax
+  800912:	8b 10                	mov    (%eax),%edx
+  800914:	8b 48 04             	mov    0x4(%eax),%ecx
+  800917:	8d 40 08             	lea    0x8(%eax),%eax
+  80091a:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  80091d:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned long long);
+  800922:	eb a9                	jmp    8008cd <vprintfmt+0x3bc>
+    return va_arg(*ap, unsigned int);
+  800924:	8b 45 14             	mov    0x14(%ebp),%eax
+  800927:	8b 10                	mov    (%eax),%edx
+  800929:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80092e:	8d 40 04             	lea    0x4(%eax),%eax
+  800931:	89 45 14             	mov    %eax,0x14(%ebp)
+      base = 16;
+  800934:	bf 10 00 00 00       	mov    $0x10,%edi
+    return va_arg(*ap, unsigned int);
+  800939:	eb 92                	jmp    8008cd <vprintfmt+0x3bc>
+      putch(ch, putdat);
+  80093b:	83 ec 08             	sub    $0x8,%esp
+  80093e:	53                   	push   %ebx
+  80093f:	6a 25                	push   $0x25
+  800941:	ff d6                	call   *%esi
+      break;
+  800943:	83 c4 10             	add    $0x10,%esp
+  800946:	eb 9f                	jmp    8008e7 <vprintfmt+0x3d6>
+      putch('%', putdat);
+  800948:	83 ec 08             	sub    $0x8,%esp
+  80094b:	53                   	push   %ebx
+  80094c:	6a 25                	push   $0x25
+  80094e:	ff d6                	call   *%esi
+      for (fmt--; fmt[-1] != '%'; fmt--)
+  800950:	83 c4 10             	add    $0x10,%esp
+  800953:	89 f8                	mov    %edi,%eax
+  800955:	80 78 ff 25          	cmpb   $0x25,-0x1(%eax)
+  800959:	74 05                	je     800960 <vprintfmt+0x44f>
+  80095b:	83 e8 01             	sub    $0x1,%eax
+  80095e:	eb f5                	jmp    800955 <vprintfmt+0x444>
+  800960:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  800963:	eb 82                	jmp    8008e7 <vprintfmt+0x3d6>
+
+00800965 <vsnprintf>:
+
+int
+vsnprintf(char *buf, int n, const char *fmt, va_list ap)
+{
+  800965:	55                   	push   %ebp
+  800966:	89 e5                	mov    %esp,%ebp
+  800968:	83 ec 18             	sub    $0x18,%esp
+  80096b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80096e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  struct sprintbuf b = { buf, buf+n-1, 0 };
+  800971:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  800974:	8d 4c 10 ff          	lea    -0x1(%eax,%edx,1),%ecx
+  800978:	89 4d f0             	mov    %ecx,-0x10(%ebp)
+  80097b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+
+  if (buf == NULL || n < 1)
+  800982:	85 c0                	test   %eax,%eax
+  800984:	74 26                	je     8009ac <vsnprintf+0x47>
+  800986:	85 d2                	test   %edx,%edx
+  800988:	7e 22                	jle    8009ac <vsnprintf+0x47>
+    return -E_INVAL;
+
+  // print the string to the buffer
+  vprintfmt((void*)sprintputch, &b, fmt, ap);
+  80098a:	ff 75 14             	push   0x14(%ebp)
+  80098d:	ff 75 10             	push   0x10(%ebp)
+  800990:	8d 45 ec             	lea    -0x14(%ebp),%eax
+  800993:	50                   	push   %eax
+  800994:	68 d7 04 80 00       	push   $0x8004d7
+  800999:	e8 73 fb ff ff       	call   800511 <vprintfmt>
+
+  // null terminate the buffer
+  *b.buf = '\0';
+  80099e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8009a1:	c6 00 00             	movb   $0x0,(%eax)
+
+  return b.cnt;
+  8009a4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  8009a7:	83 c4 10             	add    $0x10,%esp
+}
+  8009aa:	c9                   	leave
+  8009ab:	c3                   	ret
+    return -E_INVAL;
+  8009ac:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8009b1:	eb f7                	jmp    8009aa <vsnprintf+0x45>
+
+008009b3 <snprintf>:
+
+int
+snprintf(char *buf, int n, const char *fmt, ...)
+{
+  8009b3:	55                   	push   %ebp
+  8009b4:	89 e5                	mov    %esp,%ebp
+  8009b6:	83 ec 08             	sub    $0x8,%esp
+  va_list ap;
+  int rc;
+
+  va_start(ap, fmt);
+  8009b9:	8d 45 14             	lea    0x14(%ebp),%eax
+  rc = vsnprintf(buf, n, fmt, ap);
+  8009bc:	50                   	push   %eax
+  8009bd:	ff 75 10             	push   0x10(%ebp)
+  8009c0:	ff 75 0c             	push   0xc(%ebp)
+  8009c3:	ff 75 08             	push   0x8(%ebp)
+  8009c6:	e8 9a ff ff ff       	call   800965 <vsnprintf>
+  va_end(ap);
+
+  return rc;
+}
+  8009cb:	c9                   	leave
+  8009cc:	c3                   	ret
+
+008009cd <strlen>:
+// Primespipe runs 3x faster this way.
+#define ASM 1
+
+int
+strlen(const char *s)
+{
+  8009cd:	55                   	push   %ebp
+  8009ce:	89 e5                	mov    %esp,%ebp
+  8009d0:	8b 55 08             	mov    0x8(%ebp),%edx
+  int n;
+
+  for (n = 0; *s != '\0'; s++)
+  8009d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009d8:	eb 03                	jmp    8009dd <strlen+0x10>
+    n++;
+  8009da:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; *s != '\0'; s++)
+  8009dd:	80 3c 02 00          	cmpb   $0x0,(%edx,%eax,1)
+  8009e1:	75 f7                	jne    8009da <strlen+0xd>
+  return n;
+}
+  8009e3:	5d                   	pop    %ebp
+  8009e4:	c3                   	ret
+
+008009e5 <strnlen>:
+
+int
+strnlen(const char *s, size_t size)
+{
+  8009e5:	55                   	push   %ebp
+  8009e6:	89 e5                	mov    %esp,%ebp
+  8009e8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int n;
+
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8009eb:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8009ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009f3:	eb 03                	jmp    8009f8 <strnlen+0x13>
+    n++;
+  8009f5:	83 c0 01             	add    $0x1,%eax
+  for (n = 0; size > 0 && *s != '\0'; s++, size--)
+  8009f8:	39 d0                	cmp    %edx,%eax
+  8009fa:	74 08                	je     800a04 <strnlen+0x1f>
+  8009fc:	80 3c 01 00          	cmpb   $0x0,(%ecx,%eax,1)
+  800a00:	75 f3                	jne    8009f5 <strnlen+0x10>
+  800a02:	89 c2                	mov    %eax,%edx
+  return n;
+}
+  800a04:	89 d0                	mov    %edx,%eax
+  800a06:	5d                   	pop    %ebp
+  800a07:	c3                   	ret
+
+00800a08 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src)
+{
+  800a08:	55                   	push   %ebp
+  800a09:	89 e5                	mov    %esp,%ebp
+  800a0b:	53                   	push   %ebx
+  800a0c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800a0f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  char *ret;
+
+  ret = dst;
+  while ((*dst++ = *src++) != '\0')
+  800a12:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a17:	0f b6 14 03          	movzbl (%ebx,%eax,1),%edx
+  800a1b:	88 14 01             	mov    %dl,(%ecx,%eax,1)
+  800a1e:	83 c0 01             	add    $0x1,%eax
+  800a21:	84 d2                	test   %dl,%dl
+  800a23:	75 f2                	jne    800a17 <strcpy+0xf>
+    /* do nothing */;
+  return ret;
+}
+  800a25:	89 c8                	mov    %ecx,%eax
+  800a27:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a2a:	c9                   	leave
+  800a2b:	c3                   	ret
+
+00800a2c <strcat>:
+
+char *
+strcat(char *dst, const char *src)
+{
+  800a2c:	55                   	push   %ebp
+  800a2d:	89 e5                	mov    %esp,%ebp
+  800a2f:	53                   	push   %ebx
+  800a30:	83 ec 10             	sub    $0x10,%esp
+  800a33:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int len = strlen(dst);
+  800a36:	53                   	push   %ebx
+  800a37:	e8 91 ff ff ff       	call   8009cd <strlen>
+  800a3c:	83 c4 08             	add    $0x8,%esp
+
+  strcpy(dst + len, src);
+  800a3f:	ff 75 0c             	push   0xc(%ebp)
+  800a42:	01 d8                	add    %ebx,%eax
+  800a44:	50                   	push   %eax
+  800a45:	e8 be ff ff ff       	call   800a08 <strcpy>
+  return dst;
+}
+  800a4a:	89 d8                	mov    %ebx,%eax
+  800a4c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800a4f:	c9                   	leave
+  800a50:	c3                   	ret
+
+00800a51 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size)
+{
+  800a51:	55                   	push   %ebp
+  800a52:	89 e5                	mov    %esp,%ebp
+  800a54:	56                   	push   %esi
+  800a55:	53                   	push   %ebx
+  800a56:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a59:	8b 55 0c             	mov    0xc(%ebp),%edx
+  size_t i;
+  char *ret;
+
+  ret = dst;
+  for (i = 0; i < size; i++) {
+  800a5c:	89 f3                	mov    %esi,%ebx
+  800a5e:	03 5d 10             	add    0x10(%ebp),%ebx
+  800a61:	89 f0                	mov    %esi,%eax
+  800a63:	eb 0f                	jmp    800a74 <strncpy+0x23>
+    *dst++ = *src;
+  800a65:	83 c0 01             	add    $0x1,%eax
+  800a68:	0f b6 0a             	movzbl (%edx),%ecx
+  800a6b:	88 48 ff             	mov    %cl,-0x1(%eax)
+    // If strlen(src) < size, null-pad 'dst' out to 'size' chars
+    if (*src != '\0')
+      src++;
+  800a6e:	80 f9 01             	cmp    $0x1,%cl
+  800a71:	83 da ff             	sbb    $0xffffffff,%edx
+  for (i = 0; i < size; i++) {
+  800a74:	39 d8                	cmp    %ebx,%eax
+  800a76:	75 ed                	jne    800a65 <strncpy+0x14>
+  }
+  return ret;
+}
+  800a78:	89 f0                	mov    %esi,%eax
+  800a7a:	5b                   	pop    %ebx
+  800a7b:	5e                   	pop    %esi
+  800a7c:	5d                   	pop    %ebp
+  800a7d:	c3                   	ret
+
+00800a7e <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+  800a7e:	55                   	push   %ebp
+  800a7f:	89 e5                	mov    %esp,%ebp
+  800a81:	56                   	push   %esi
+  800a82:	53                   	push   %ebx
+  800a83:	8b 75 08             	mov    0x8(%ebp),%esi
+  800a86:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800a89:	8b 55 10             	mov    0x10(%ebp),%edx
+  char *dst_in;
+
+  dst_in = dst;
+  if (size > 0) {
+  800a8c:	89 f0                	mov    %esi,%eax
+  800a8e:	85 d2                	test   %edx,%edx
+  800a90:	74 21                	je     800ab3 <strlcpy+0x35>
+  800a92:	8d 44 16 ff          	lea    -0x1(%esi,%edx,1),%eax
+  800a96:	89 f2                	mov    %esi,%edx
+  800a98:	eb 09                	jmp    800aa3 <strlcpy+0x25>
+    while (--size > 0 && *src != '\0')
+      *dst++ = *src++;
+  800a9a:	83 c1 01             	add    $0x1,%ecx
+  800a9d:	83 c2 01             	add    $0x1,%edx
+  800aa0:	88 5a ff             	mov    %bl,-0x1(%edx)
+    while (--size > 0 && *src != '\0')
+  800aa3:	39 c2                	cmp    %eax,%edx
+  800aa5:	74 09                	je     800ab0 <strlcpy+0x32>
+  800aa7:	0f b6 19             	movzbl (%ecx),%ebx
+  800aaa:	84 db                	test   %bl,%bl
+  800aac:	75 ec                	jne    800a9a <strlcpy+0x1c>
+  800aae:	89 d0                	mov    %edx,%eax
+    *dst = '\0';
+  800ab0:	c6 00 00             	movb   $0x0,(%eax)
+  }
+  return dst - dst_in;
+  800ab3:	29 f0                	sub    %esi,%eax
+}
+  800ab5:	5b                   	pop    %ebx
+  800ab6:	5e                   	pop    %esi
+  800ab7:	5d                   	pop    %ebp
+  800ab8:	c3                   	ret
+
+00800ab9 <strcmp>:
+
+int
+strcmp(const char *p, const char *q)
+{
+  800ab9:	55                   	push   %ebp
+  800aba:	89 e5                	mov    %esp,%ebp
+  800abc:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  800abf:	8b 55 0c             	mov    0xc(%ebp),%edx
+  while (*p && *p == *q)
+  800ac2:	eb 06                	jmp    800aca <strcmp+0x11>
+    p++, q++;
+  800ac4:	83 c1 01             	add    $0x1,%ecx
+  800ac7:	83 c2 01             	add    $0x1,%edx
+  while (*p && *p == *q)
+  800aca:	0f b6 01             	movzbl (%ecx),%eax
+  800acd:	84 c0                	test   %al,%al
+  800acf:	74 04                	je     800ad5 <strcmp+0x1c>
+  800ad1:	3a 02                	cmp    (%edx),%al
+  800ad3:	74 ef                	je     800ac4 <strcmp+0xb>
+  return (int)((unsigned char)*p - (unsigned char)*q);
+  800ad5:	0f b6 c0             	movzbl %al,%eax
+  800ad8:	0f b6 12             	movzbl (%edx),%edx
+  800adb:	29 d0                	sub    %edx,%eax
+}
+  800add:	5d                   	pop    %ebp
+  800ade:	c3                   	ret
+
+00800adf <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n)
+{
+  800adf:	55                   	push   %ebp
+  800ae0:	89 e5                	mov    %esp,%ebp
+  800ae2:	53                   	push   %ebx
+  800ae3:	8b 45 08             	mov    0x8(%ebp),%eax
+  800ae6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ae9:	8b 55 10             	mov    0x10(%ebp),%edx
+  while (n > 0 && *p && *p == *q)
+  800aec:	eb 09                	jmp    800af7 <strncmp+0x18>
+    n--, p++, q++;
+  800aee:	83 ea 01             	sub    $0x1,%edx
+  800af1:	83 c0 01             	add    $0x1,%eax
+  800af4:	83 c1 01             	add    $0x1,%ecx
+  while (n > 0 && *p && *p == *q)
+  800af7:	85 d2                	test   %edx,%edx
+  800af9:	74 18                	je     800b13 <strncmp+0x34>
+  800afb:	0f b6 18             	movzbl (%eax),%ebx
+  800afe:	84 db                	test   %bl,%bl
+  800b00:	74 04                	je     800b06 <strncmp+0x27>
+  800b02:	3a 19                	cmp    (%ecx),%bl
+  800b04:	74 e8                	je     800aee <strncmp+0xf>
+  if (n == 0)
+    return 0;
+  else
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800b06:	0f b6 00             	movzbl (%eax),%eax
+  800b09:	0f b6 11             	movzbl (%ecx),%edx
+  800b0c:	29 d0                	sub    %edx,%eax
+}
+  800b0e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  800b11:	c9                   	leave
+  800b12:	c3                   	ret
+    return 0;
+  800b13:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b18:	eb f4                	jmp    800b0e <strncmp+0x2f>
+
+00800b1a <strchr>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a null pointer if the string has no 'c'.
+char *
+strchr(const char *s, char c)
+{
+  800b1a:	55                   	push   %ebp
+  800b1b:	89 e5                	mov    %esp,%ebp
+  800b1d:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b20:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800b24:	eb 03                	jmp    800b29 <strchr+0xf>
+  800b26:	83 c0 01             	add    $0x1,%eax
+  800b29:	0f b6 10             	movzbl (%eax),%edx
+  800b2c:	84 d2                	test   %dl,%dl
+  800b2e:	74 06                	je     800b36 <strchr+0x1c>
+    if (*s == c)
+  800b30:	38 ca                	cmp    %cl,%dl
+  800b32:	75 f2                	jne    800b26 <strchr+0xc>
+  800b34:	eb 05                	jmp    800b3b <strchr+0x21>
+      return (char*)s;
+  return 0;
+  800b36:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800b3b:	5d                   	pop    %ebp
+  800b3c:	c3                   	ret
+
+00800b3d <strfind>:
+
+// Return a pointer to the first occurrence of 'c' in 's',
+// or a pointer to the string-ending null character if the string has no 'c'.
+char *
+strfind(const char *s, char c)
+{
+  800b3d:	55                   	push   %ebp
+  800b3e:	89 e5                	mov    %esp,%ebp
+  800b40:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b43:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  for (; *s; s++)
+  800b47:	0f b6 10             	movzbl (%eax),%edx
+    if (*s == c)
+  800b4a:	38 ca                	cmp    %cl,%dl
+  800b4c:	74 09                	je     800b57 <strfind+0x1a>
+  800b4e:	84 d2                	test   %dl,%dl
+  800b50:	74 05                	je     800b57 <strfind+0x1a>
+  for (; *s; s++)
+  800b52:	83 c0 01             	add    $0x1,%eax
+  800b55:	eb f0                	jmp    800b47 <strfind+0xa>
+      break;
+  return (char*)s;
+}
+  800b57:	5d                   	pop    %ebp
+  800b58:	c3                   	ret
+
+00800b59 <memset>:
+
+#if ASM
+void *
+memset(void *v, int c, size_t n)
+{
+  800b59:	55                   	push   %ebp
+  800b5a:	89 e5                	mov    %esp,%ebp
+  800b5c:	57                   	push   %edi
+  800b5d:	8b 7d 08             	mov    0x8(%ebp),%edi
+  800b60:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  char *p;
+
+  if (n == 0)
+  800b63:	85 c9                	test   %ecx,%ecx
+  800b65:	74 20                	je     800b87 <memset+0x2e>
+    return v;
+  if ((int)v%4 == 0 && n%4 == 0) {
+  800b67:	89 f8                	mov    %edi,%eax
+  800b69:	09 c8                	or     %ecx,%eax
+  800b6b:	a8 03                	test   $0x3,%al
+  800b6d:	75 12                	jne    800b81 <memset+0x28>
+    c &= 0xFF;
+  800b6f:	0f b6 45 0c          	movzbl 0xc(%ebp),%eax
+  800b73:	69 c0 01 01 01 01    	imul   $0x1010101,%eax,%eax
+    c = (c<<24)|(c<<16)|(c<<8)|c;
+    asm volatile ("cld; rep stosl\n"
+                  :: "D" (v), "a" (c), "c" (n/4)
+  800b79:	c1 e9 02             	shr    $0x2,%ecx
+    asm volatile ("cld; rep stosl\n"
+  800b7c:	fc                   	cld
+  800b7d:	f3 ab                	rep stos %eax,%es:(%edi)
+  800b7f:	eb 06                	jmp    800b87 <memset+0x2e>
+                  : "cc", "memory");
+  } else
+    asm volatile ("cld; rep stosb\n"
+  800b81:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800b84:	fc                   	cld
+  800b85:	f3 aa                	rep stos %al,%es:(%edi)
+                  :: "D" (v), "a" (c), "c" (n)
+                  : "cc", "memory");
+  return v;
+}
+  800b87:	89 f8                	mov    %edi,%eax
+  800b89:	8b 7d fc             	mov    -0x4(%ebp),%edi
+  800b8c:	c9                   	leave
+  800b8d:	c3                   	ret
+
+00800b8e <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n)
+{
+  800b8e:	55                   	push   %ebp
+  800b8f:	89 e5                	mov    %esp,%ebp
+  800b91:	57                   	push   %edi
+  800b92:	56                   	push   %esi
+  800b93:	8b 45 08             	mov    0x8(%ebp),%eax
+  800b96:	8b 75 0c             	mov    0xc(%ebp),%esi
+  800b99:	8b 4d 10             	mov    0x10(%ebp),%ecx
+  const char *s;
+  char *d;
+
+  s = src;
+  d = dst;
+  if (s < d && s + n > d) {
+  800b9c:	39 c6                	cmp    %eax,%esi
+  800b9e:	73 32                	jae    800bd2 <memmove+0x44>
+  800ba0:	8d 14 0e             	lea    (%esi,%ecx,1),%edx
+  800ba3:	39 d0                	cmp    %edx,%eax
+  800ba5:	73 2b                	jae    800bd2 <memmove+0x44>
+    s += n;
+    d += n;
+  800ba7:	8d 3c 08             	lea    (%eax,%ecx,1),%edi
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800baa:	89 d6                	mov    %edx,%esi
+  800bac:	09 fe                	or     %edi,%esi
+  800bae:	09 ce                	or     %ecx,%esi
+  800bb0:	f7 c6 03 00 00 00    	test   $0x3,%esi
+  800bb6:	75 0e                	jne    800bc6 <memmove+0x38>
+      asm volatile ("std; rep movsl\n"
+                    :: "D" (d-4), "S" (s-4), "c" (n/4) : "cc", "memory");
+  800bb8:	83 ef 04             	sub    $0x4,%edi
+  800bbb:	8d 72 fc             	lea    -0x4(%edx),%esi
+  800bbe:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("std; rep movsl\n"
+  800bc1:	fd                   	std
+  800bc2:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800bc4:	eb 09                	jmp    800bcf <memmove+0x41>
+    else
+      asm volatile ("std; rep movsb\n"
+                    :: "D" (d-1), "S" (s-1), "c" (n) : "cc", "memory");
+  800bc6:	83 ef 01             	sub    $0x1,%edi
+  800bc9:	8d 72 ff             	lea    -0x1(%edx),%esi
+      asm volatile ("std; rep movsb\n"
+  800bcc:	fd                   	std
+  800bcd:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+    // Some versions of GCC rely on DF being clear
+    asm volatile ("cld" ::: "cc");
+  800bcf:	fc                   	cld
+  800bd0:	eb 1a                	jmp    800bec <memmove+0x5e>
+  } else {
+    if ((int)s%4 == 0 && (int)d%4 == 0 && n%4 == 0)
+  800bd2:	89 f2                	mov    %esi,%edx
+  800bd4:	09 c2                	or     %eax,%edx
+  800bd6:	09 ca                	or     %ecx,%edx
+  800bd8:	f6 c2 03             	test   $0x3,%dl
+  800bdb:	75 0a                	jne    800be7 <memmove+0x59>
+      asm volatile ("cld; rep movsl\n"
+                    :: "D" (d), "S" (s), "c" (n/4) : "cc", "memory");
+  800bdd:	c1 e9 02             	shr    $0x2,%ecx
+      asm volatile ("cld; rep movsl\n"
+  800be0:	89 c7                	mov    %eax,%edi
+  800be2:	fc                   	cld
+  800be3:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  800be5:	eb 05                	jmp    800bec <memmove+0x5e>
+    else
+      asm volatile ("cld; rep movsb\n"
+  800be7:	89 c7                	mov    %eax,%edi
+  800be9:	fc                   	cld
+  800bea:	f3 a4                	rep movsb %ds:(%esi),%es:(%edi)
+                    :: "D" (d), "S" (s), "c" (n) : "cc", "memory");
+  }
+  return dst;
+}
+  800bec:	5e                   	pop    %esi
+  800bed:	5f                   	pop    %edi
+  800bee:	5d                   	pop    %ebp
+  800bef:	c3                   	ret
+
+00800bf0 <memcpy>:
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n)
+{
+  800bf0:	55                   	push   %ebp
+  800bf1:	89 e5                	mov    %esp,%ebp
+  800bf3:	83 ec 0c             	sub    $0xc,%esp
+  return memmove(dst, src, n);
+  800bf6:	ff 75 10             	push   0x10(%ebp)
+  800bf9:	ff 75 0c             	push   0xc(%ebp)
+  800bfc:	ff 75 08             	push   0x8(%ebp)
+  800bff:	e8 8a ff ff ff       	call   800b8e <memmove>
+}
+  800c04:	c9                   	leave
+  800c05:	c3                   	ret
+
+00800c06 <memcmp>:
+
+int
+memcmp(const void *v1, const void *v2, size_t n)
+{
+  800c06:	55                   	push   %ebp
+  800c07:	89 e5                	mov    %esp,%ebp
+  800c09:	56                   	push   %esi
+  800c0a:	53                   	push   %ebx
+  800c0b:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c0e:	8b 55 0c             	mov    0xc(%ebp),%edx
+  const uint8_t *s1 = (const uint8_t*)v1;
+  const uint8_t *s2 = (const uint8_t*)v2;
+
+  while (n-- > 0) {
+  800c11:	89 c6                	mov    %eax,%esi
+  800c13:	03 75 10             	add    0x10(%ebp),%esi
+  800c16:	eb 06                	jmp    800c1e <memcmp+0x18>
+    if (*s1 != *s2)
+      return (int)*s1 - (int)*s2;
+    s1++, s2++;
+  800c18:	83 c0 01             	add    $0x1,%eax
+  800c1b:	83 c2 01             	add    $0x1,%edx
+  while (n-- > 0) {
+  800c1e:	39 f0                	cmp    %esi,%eax
+  800c20:	74 14                	je     800c36 <memcmp+0x30>
+    if (*s1 != *s2)
+  800c22:	0f b6 08             	movzbl (%eax),%ecx
+  800c25:	0f b6 1a             	movzbl (%edx),%ebx
+  800c28:	38 d9                	cmp    %bl,%cl
+  800c2a:	74 ec                	je     800c18 <memcmp+0x12>
+      return (int)*s1 - (int)*s2;
+  800c2c:	0f b6 c1             	movzbl %cl,%eax
+  800c2f:	0f b6 db             	movzbl %bl,%ebx
+  800c32:	29 d8                	sub    %ebx,%eax
+  800c34:	eb 05                	jmp    800c3b <memcmp+0x35>
+  }
+
+  return 0;
+  800c36:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c3b:	5b                   	pop    %ebx
+  800c3c:	5e                   	pop    %esi
+  800c3d:	5d                   	pop    %ebp
+  800c3e:	c3                   	ret
+
+00800c3f <memfind>:
+
+void *
+memfind(const void *s, int c, size_t n)
+{
+  800c3f:	55                   	push   %ebp
+  800c40:	89 e5                	mov    %esp,%ebp
+  800c42:	8b 45 08             	mov    0x8(%ebp),%eax
+  800c45:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  const void *ends = (const char*)s + n;
+  800c48:	89 c2                	mov    %eax,%edx
+  800c4a:	03 55 10             	add    0x10(%ebp),%edx
+
+  for (; s < ends; s++)
+  800c4d:	eb 03                	jmp    800c52 <memfind+0x13>
+  800c4f:	83 c0 01             	add    $0x1,%eax
+  800c52:	39 d0                	cmp    %edx,%eax
+  800c54:	73 04                	jae    800c5a <memfind+0x1b>
+    if (*(const unsigned char*)s == (unsigned char)c)
+  800c56:	38 08                	cmp    %cl,(%eax)
+  800c58:	75 f5                	jne    800c4f <memfind+0x10>
+      break;
+  return (void*)s;
+}
+  800c5a:	5d                   	pop    %ebp
+  800c5b:	c3                   	ret
+
+00800c5c <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base)
+{
+  800c5c:	55                   	push   %ebp
+  800c5d:	89 e5                	mov    %esp,%ebp
+  800c5f:	57                   	push   %edi
+  800c60:	56                   	push   %esi
+  800c61:	53                   	push   %ebx
+  800c62:	8b 55 08             	mov    0x8(%ebp),%edx
+  800c65:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  int neg = 0;
+  long val = 0;
+
+  // gobble initial whitespace
+  while (*s == ' ' || *s == '\t')
+  800c68:	eb 03                	jmp    800c6d <strtol+0x11>
+    s++;
+  800c6a:	83 c2 01             	add    $0x1,%edx
+  while (*s == ' ' || *s == '\t')
+  800c6d:	0f b6 02             	movzbl (%edx),%eax
+  800c70:	3c 20                	cmp    $0x20,%al
+  800c72:	74 f6                	je     800c6a <strtol+0xe>
+  800c74:	3c 09                	cmp    $0x9,%al
+  800c76:	74 f2                	je     800c6a <strtol+0xe>
+
+  // plus/minus sign
+  if (*s == '+')
+  800c78:	3c 2b                	cmp    $0x2b,%al
+  800c7a:	74 2a                	je     800ca6 <strtol+0x4a>
+  int neg = 0;
+  800c7c:	bf 00 00 00 00       	mov    $0x0,%edi
+    s++;
+  else if (*s == '-')
+  800c81:	3c 2d                	cmp    $0x2d,%al
+  800c83:	74 2b                	je     800cb0 <strtol+0x54>
+    s++, neg = 1;
+
+  // hex or octal base prefix
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800c85:	f7 c3 ef ff ff ff    	test   $0xffffffef,%ebx
+  800c8b:	75 0f                	jne    800c9c <strtol+0x40>
+  800c8d:	80 3a 30             	cmpb   $0x30,(%edx)
+  800c90:	74 28                	je     800cba <strtol+0x5e>
+    s += 2, base = 16;
+  else if (base == 0 && s[0] == '0')
+    s++, base = 8;
+  else if (base == 0)
+    base = 10;
+  800c92:	85 db                	test   %ebx,%ebx
+  800c94:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800c99:	0f 44 d8             	cmove  %eax,%ebx
+  800c9c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ca1:	89 5d 10             	mov    %ebx,0x10(%ebp)
+  800ca4:	eb 46                	jmp    800cec <strtol+0x90>
+    s++;
+  800ca6:	83 c2 01             	add    $0x1,%edx
+  int neg = 0;
+  800ca9:	bf 00 00 00 00       	mov    $0x0,%edi
+  800cae:	eb d5                	jmp    800c85 <strtol+0x29>
+    s++, neg = 1;
+  800cb0:	83 c2 01             	add    $0x1,%edx
+  800cb3:	bf 01 00 00 00       	mov    $0x1,%edi
+  800cb8:	eb cb                	jmp    800c85 <strtol+0x29>
+  if ((base == 0 || base == 16) && (s[0] == '0' && s[1] == 'x'))
+  800cba:	80 7a 01 78          	cmpb   $0x78,0x1(%edx)
+  800cbe:	74 0e                	je     800cce <strtol+0x72>
+  else if (base == 0 && s[0] == '0')
+  800cc0:	85 db                	test   %ebx,%ebx
+  800cc2:	75 d8                	jne    800c9c <strtol+0x40>
+    s++, base = 8;
+  800cc4:	83 c2 01             	add    $0x1,%edx
+  800cc7:	bb 08 00 00 00       	mov    $0x8,%ebx
+  800ccc:	eb ce                	jmp    800c9c <strtol+0x40>
+    s += 2, base = 16;
+  800cce:	83 c2 02             	add    $0x2,%edx
+  800cd1:	bb 10 00 00 00       	mov    $0x10,%ebx
+  800cd6:	eb c4                	jmp    800c9c <strtol+0x40>
+  // digits
+  while (1) {
+    int dig;
+
+    if (*s >= '0' && *s <= '9')
+      dig = *s - '0';
+  800cd8:	0f be c0             	movsbl %al,%eax
+  800cdb:	83 e8 30             	sub    $0x30,%eax
+      dig = *s - 'a' + 10;
+    else if (*s >= 'A' && *s <= 'Z')
+      dig = *s - 'A' + 10;
+    else
+      break;
+    if (dig >= base)
+  800cde:	3b 45 10             	cmp    0x10(%ebp),%eax
+  800ce1:	7d 3a                	jge    800d1d <strtol+0xc1>
+      break;
+    s++, val = (val * base) + dig;
+  800ce3:	83 c2 01             	add    $0x1,%edx
+  800ce6:	0f af 4d 10          	imul   0x10(%ebp),%ecx
+  800cea:	01 c1                	add    %eax,%ecx
+    if (*s >= '0' && *s <= '9')
+  800cec:	0f b6 02             	movzbl (%edx),%eax
+  800cef:	8d 70 d0             	lea    -0x30(%eax),%esi
+  800cf2:	89 f3                	mov    %esi,%ebx
+  800cf4:	80 fb 09             	cmp    $0x9,%bl
+  800cf7:	76 df                	jbe    800cd8 <strtol+0x7c>
+    else if (*s >= 'a' && *s <= 'z')
+  800cf9:	8d 70 9f             	lea    -0x61(%eax),%esi
+  800cfc:	89 f3                	mov    %esi,%ebx
+  800cfe:	80 fb 19             	cmp    $0x19,%bl
+  800d01:	77 08                	ja     800d0b <strtol+0xaf>
+      dig = *s - 'a' + 10;
+  800d03:	0f be c0             	movsbl %al,%eax
+  800d06:	83 e8 57             	sub    $0x57,%eax
+  800d09:	eb d3                	jmp    800cde <strtol+0x82>
+    else if (*s >= 'A' && *s <= 'Z')
+  800d0b:	8d 70 bf             	lea    -0x41(%eax),%esi
+  800d0e:	89 f3                	mov    %esi,%ebx
+  800d10:	80 fb 19             	cmp    $0x19,%bl
+  800d13:	77 08                	ja     800d1d <strtol+0xc1>
+      dig = *s - 'A' + 10;
+  800d15:	0f be c0             	movsbl %al,%eax
+  800d18:	83 e8 37             	sub    $0x37,%eax
+  800d1b:	eb c1                	jmp    800cde <strtol+0x82>
+    // we don't properly detect overflow!
+  }
+
+  if (endptr)
+  800d1d:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  800d21:	74 05                	je     800d28 <strtol+0xcc>
+    *endptr = (char*)s;
+  800d23:	8b 45 0c             	mov    0xc(%ebp),%eax
+  800d26:	89 10                	mov    %edx,(%eax)
+  return neg ? -val : val;
+  800d28:	89 c8                	mov    %ecx,%eax
+  800d2a:	f7 d8                	neg    %eax
+  800d2c:	85 ff                	test   %edi,%edi
+  800d2e:	0f 45 c8             	cmovne %eax,%ecx
+}
+  800d31:	89 c8                	mov    %ecx,%eax
+  800d33:	5b                   	pop    %ebx
+  800d34:	5e                   	pop    %esi
+  800d35:	5f                   	pop    %edi
+  800d36:	5d                   	pop    %ebp
+  800d37:	c3                   	ret
+
+00800d38 <sys_cputs>:
+  return ret;
+}
+
+void
+sys_cputs(const char *s, size_t len)
+{
+  800d38:	55                   	push   %ebp
+  800d39:	89 e5                	mov    %esp,%ebp
+  800d3b:	57                   	push   %edi
+  800d3c:	56                   	push   %esi
+  800d3d:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d3e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d43:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d46:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800d49:	89 c3                	mov    %eax,%ebx
+  800d4b:	89 c7                	mov    %eax,%edi
+  800d4d:	89 c6                	mov    %eax,%esi
+  800d4f:	cd 30                	int    $0x30
+  syscall(SYS_cputs, 0, (uint32_t)s, len, 0, 0, 0);
+}
+  800d51:	5b                   	pop    %ebx
+  800d52:	5e                   	pop    %esi
+  800d53:	5f                   	pop    %edi
+  800d54:	5d                   	pop    %ebp
+  800d55:	c3                   	ret
+
+00800d56 <sys_cgetc>:
+
+int
+sys_cgetc(void)
+{
+  800d56:	55                   	push   %ebp
+  800d57:	89 e5                	mov    %esp,%ebp
+  800d59:	57                   	push   %edi
+  800d5a:	56                   	push   %esi
+  800d5b:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800d5c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d61:	b8 01 00 00 00       	mov    $0x1,%eax
+  800d66:	89 d1                	mov    %edx,%ecx
+  800d68:	89 d3                	mov    %edx,%ebx
+  800d6a:	89 d7                	mov    %edx,%edi
+  800d6c:	89 d6                	mov    %edx,%esi
+  800d6e:	cd 30                	int    $0x30
+  return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0);
+}
+  800d70:	5b                   	pop    %ebx
+  800d71:	5e                   	pop    %esi
+  800d72:	5f                   	pop    %edi
+  800d73:	5d                   	pop    %ebp
+  800d74:	c3                   	ret
+
+00800d75 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid)
+{
+  800d75:	55                   	push   %ebp
+  800d76:	89 e5                	mov    %esp,%ebp
+  800d78:	57                   	push   %edi
+  800d79:	56                   	push   %esi
+  800d7a:	53                   	push   %ebx
+  800d7b:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800d7e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800d83:	8b 55 08             	mov    0x8(%ebp),%edx
+  800d86:	b8 03 00 00 00       	mov    $0x3,%eax
+  800d8b:	89 cb                	mov    %ecx,%ebx
+  800d8d:	89 cf                	mov    %ecx,%edi
+  800d8f:	89 ce                	mov    %ecx,%esi
+  800d91:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800d93:	85 c0                	test   %eax,%eax
+  800d95:	7f 08                	jg     800d9f <sys_env_destroy+0x2a>
+  return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0);
+}
+  800d97:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800d9a:	5b                   	pop    %ebx
+  800d9b:	5e                   	pop    %esi
+  800d9c:	5f                   	pop    %edi
+  800d9d:	5d                   	pop    %ebp
+  800d9e:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800d9f:	83 ec 0c             	sub    $0xc,%esp
+  800da2:	50                   	push   %eax
+  800da3:	6a 03                	push   $0x3
+  800da5:	68 83 40 80 00       	push   $0x804083
+  800daa:	6a 23                	push   $0x23
+  800dac:	68 a0 40 80 00       	push   $0x8040a0
+  800db1:	e8 89 f5 ff ff       	call   80033f <_panic>
+
+00800db6 <sys_getenvid>:
+
+envid_t
+sys_getenvid(void)
+{
+  800db6:	55                   	push   %ebp
+  800db7:	89 e5                	mov    %esp,%ebp
+  800db9:	57                   	push   %edi
+  800dba:	56                   	push   %esi
+  800dbb:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800dbc:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dc1:	b8 02 00 00 00       	mov    $0x2,%eax
+  800dc6:	89 d1                	mov    %edx,%ecx
+  800dc8:	89 d3                	mov    %edx,%ebx
+  800dca:	89 d7                	mov    %edx,%edi
+  800dcc:	89 d6                	mov    %edx,%esi
+  800dce:	cd 30                	int    $0x30
+  return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0);
+}
+  800dd0:	5b                   	pop    %ebx
+  800dd1:	5e                   	pop    %esi
+  800dd2:	5f                   	pop    %edi
+  800dd3:	5d                   	pop    %ebp
+  800dd4:	c3                   	ret
+
+00800dd5 <sys_yield>:
+
+void
+sys_yield(void)
+{
+  800dd5:	55                   	push   %ebp
+  800dd6:	89 e5                	mov    %esp,%ebp
+  800dd8:	57                   	push   %edi
+  800dd9:	56                   	push   %esi
+  800dda:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800ddb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800de0:	b8 0b 00 00 00       	mov    $0xb,%eax
+  800de5:	89 d1                	mov    %edx,%ecx
+  800de7:	89 d3                	mov    %edx,%ebx
+  800de9:	89 d7                	mov    %edx,%edi
+  800deb:	89 d6                	mov    %edx,%esi
+  800ded:	cd 30                	int    $0x30
+  syscall(SYS_yield, 0, 0, 0, 0, 0, 0);
+}
+  800def:	5b                   	pop    %ebx
+  800df0:	5e                   	pop    %esi
+  800df1:	5f                   	pop    %edi
+  800df2:	5d                   	pop    %ebp
+  800df3:	c3                   	ret
+
+00800df4 <sys_env_set_cow>:
+
+int
+sys_env_set_cow(envid_t envid, bool kernel)
+{
+  800df4:	55                   	push   %ebp
+  800df5:	89 e5                	mov    %esp,%ebp
+  800df7:	57                   	push   %edi
+  800df8:	56                   	push   %esi
+  800df9:	53                   	push   %ebx
+  800dfa:	83 ec 0c             	sub    $0xc,%esp
+  return syscall(SYS_env_set_cow, 1, envid, kernel, 0, 0, 0);
+  800dfd:	0f b6 4d 0c          	movzbl 0xc(%ebp),%ecx
+  asm volatile ("int %1\n"
+  800e01:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800e06:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e09:	b8 14 00 00 00       	mov    $0x14,%eax
+  800e0e:	89 df                	mov    %ebx,%edi
+  800e10:	89 de                	mov    %ebx,%esi
+  800e12:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e14:	85 c0                	test   %eax,%eax
+  800e16:	7f 08                	jg     800e20 <sys_env_set_cow+0x2c>
+}
+  800e18:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e1b:	5b                   	pop    %ebx
+  800e1c:	5e                   	pop    %esi
+  800e1d:	5f                   	pop    %edi
+  800e1e:	5d                   	pop    %ebp
+  800e1f:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e20:	83 ec 0c             	sub    $0xc,%esp
+  800e23:	50                   	push   %eax
+  800e24:	6a 14                	push   $0x14
+  800e26:	68 83 40 80 00       	push   $0x804083
+  800e2b:	6a 23                	push   $0x23
+  800e2d:	68 a0 40 80 00       	push   $0x8040a0
+  800e32:	e8 08 f5 ff ff       	call   80033f <_panic>
+
+00800e37 <sys_page_alloc>:
+
+int
+sys_page_alloc(envid_t envid, void *va, int perm)
+{
+  800e37:	55                   	push   %ebp
+  800e38:	89 e5                	mov    %esp,%ebp
+  800e3a:	57                   	push   %edi
+  800e3b:	56                   	push   %esi
+  800e3c:	53                   	push   %ebx
+  800e3d:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e40:	be 00 00 00 00       	mov    $0x0,%esi
+  800e45:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e48:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e4b:	b8 04 00 00 00       	mov    $0x4,%eax
+  800e50:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e53:	89 f7                	mov    %esi,%edi
+  800e55:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e57:	85 c0                	test   %eax,%eax
+  800e59:	7f 08                	jg     800e63 <sys_page_alloc+0x2c>
+  return syscall(SYS_page_alloc, 1, envid, (uint32_t)va, perm, 0, 0);
+}
+  800e5b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800e5e:	5b                   	pop    %ebx
+  800e5f:	5e                   	pop    %esi
+  800e60:	5f                   	pop    %edi
+  800e61:	5d                   	pop    %ebp
+  800e62:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800e63:	83 ec 0c             	sub    $0xc,%esp
+  800e66:	50                   	push   %eax
+  800e67:	6a 04                	push   $0x4
+  800e69:	68 83 40 80 00       	push   $0x804083
+  800e6e:	6a 23                	push   $0x23
+  800e70:	68 a0 40 80 00       	push   $0x8040a0
+  800e75:	e8 c5 f4 ff ff       	call   80033f <_panic>
+
+00800e7a <sys_page_map>:
+
+int
+sys_page_map(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, int perm)
+{
+  800e7a:	55                   	push   %ebp
+  800e7b:	89 e5                	mov    %esp,%ebp
+  800e7d:	57                   	push   %edi
+  800e7e:	56                   	push   %esi
+  800e7f:	53                   	push   %ebx
+  800e80:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800e83:	8b 55 08             	mov    0x8(%ebp),%edx
+  800e86:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800e89:	b8 05 00 00 00       	mov    $0x5,%eax
+  800e8e:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800e91:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800e94:	8b 75 18             	mov    0x18(%ebp),%esi
+  800e97:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800e99:	85 c0                	test   %eax,%eax
+  800e9b:	7f 08                	jg     800ea5 <sys_page_map+0x2b>
+  return syscall(SYS_page_map, 1, srcenv, (uint32_t)srcva, dstenv, (uint32_t)dstva, perm);
+}
+  800e9d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ea0:	5b                   	pop    %ebx
+  800ea1:	5e                   	pop    %esi
+  800ea2:	5f                   	pop    %edi
+  800ea3:	5d                   	pop    %ebp
+  800ea4:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ea5:	83 ec 0c             	sub    $0xc,%esp
+  800ea8:	50                   	push   %eax
+  800ea9:	6a 05                	push   $0x5
+  800eab:	68 83 40 80 00       	push   $0x804083
+  800eb0:	6a 23                	push   $0x23
+  800eb2:	68 a0 40 80 00       	push   $0x8040a0
+  800eb7:	e8 83 f4 ff ff       	call   80033f <_panic>
+
+00800ebc <sys_page_unmap>:
+
+int
+sys_page_unmap(envid_t envid, void *va)
+{
+  800ebc:	55                   	push   %ebp
+  800ebd:	89 e5                	mov    %esp,%ebp
+  800ebf:	57                   	push   %edi
+  800ec0:	56                   	push   %esi
+  800ec1:	53                   	push   %ebx
+  800ec2:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800ec5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800eca:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ecd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ed0:	b8 06 00 00 00       	mov    $0x6,%eax
+  800ed5:	89 df                	mov    %ebx,%edi
+  800ed7:	89 de                	mov    %ebx,%esi
+  800ed9:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800edb:	85 c0                	test   %eax,%eax
+  800edd:	7f 08                	jg     800ee7 <sys_page_unmap+0x2b>
+  return syscall(SYS_page_unmap, 1, envid, (uint32_t)va, 0, 0, 0);
+}
+  800edf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800ee2:	5b                   	pop    %ebx
+  800ee3:	5e                   	pop    %esi
+  800ee4:	5f                   	pop    %edi
+  800ee5:	5d                   	pop    %ebp
+  800ee6:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800ee7:	83 ec 0c             	sub    $0xc,%esp
+  800eea:	50                   	push   %eax
+  800eeb:	6a 06                	push   $0x6
+  800eed:	68 83 40 80 00       	push   $0x804083
+  800ef2:	6a 23                	push   $0x23
+  800ef4:	68 a0 40 80 00       	push   $0x8040a0
+  800ef9:	e8 41 f4 ff ff       	call   80033f <_panic>
+
+00800efe <sys_page_map_range>:
+
+int
+sys_page_map_range(envid_t srcenv, void *va, size_t len, envid_t dstenv, int xform)
+{
+  800efe:	55                   	push   %ebp
+  800eff:	89 e5                	mov    %esp,%ebp
+  800f01:	57                   	push   %edi
+  800f02:	56                   	push   %esi
+  800f03:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f04:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f07:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f0a:	b8 11 00 00 00       	mov    $0x11,%eax
+  800f0f:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f12:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f15:	8b 75 18             	mov    0x18(%ebp),%esi
+  800f18:	cd 30                	int    $0x30
+  return syscall(SYS_page_map_range, 0, srcenv, (uint32_t)va, len, dstenv, xform);
+}
+  800f1a:	5b                   	pop    %ebx
+  800f1b:	5e                   	pop    %esi
+  800f1c:	5f                   	pop    %edi
+  800f1d:	5d                   	pop    %ebp
+  800f1e:	c3                   	ret
+
+00800f1f <sys_page_protect_range>:
+
+int
+sys_page_protect_range(envid_t envid, void *va, size_t len, int xform)
+{
+  800f1f:	55                   	push   %ebp
+  800f20:	89 e5                	mov    %esp,%ebp
+  800f22:	57                   	push   %edi
+  800f23:	56                   	push   %esi
+  800f24:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f25:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f28:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f2b:	b8 12 00 00 00       	mov    $0x12,%eax
+  800f30:	be 00 00 00 00       	mov    $0x0,%esi
+  800f35:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800f38:	8b 7d 14             	mov    0x14(%ebp),%edi
+  800f3b:	cd 30                	int    $0x30
+  return syscall(SYS_page_protect_range, 0, envid, (uint32_t)va, len, xform, 0);
+}
+  800f3d:	5b                   	pop    %ebx
+  800f3e:	5e                   	pop    %esi
+  800f3f:	5f                   	pop    %edi
+  800f40:	5d                   	pop    %ebp
+  800f41:	c3                   	ret
+
+00800f42 <sys_irq_listen>:
+
+int
+sys_irq_listen(int irq, volatile void *chan)
+{
+  800f42:	55                   	push   %ebp
+  800f43:	89 e5                	mov    %esp,%ebp
+  800f45:	57                   	push   %edi
+  800f46:	56                   	push   %esi
+  800f47:	53                   	push   %ebx
+  800f48:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800f4b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800f50:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f53:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800f56:	b8 16 00 00 00       	mov    $0x16,%eax
+  800f5b:	89 df                	mov    %ebx,%edi
+  800f5d:	89 de                	mov    %ebx,%esi
+  800f5f:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800f61:	85 c0                	test   %eax,%eax
+  800f63:	7f 08                	jg     800f6d <sys_irq_listen+0x2b>
+  return syscall(SYS_irq_listen, 1, irq, (uint32_t)chan, 0, 0, 0);
+}
+  800f65:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800f68:	5b                   	pop    %ebx
+  800f69:	5e                   	pop    %esi
+  800f6a:	5f                   	pop    %edi
+  800f6b:	5d                   	pop    %ebp
+  800f6c:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800f6d:	83 ec 0c             	sub    $0xc,%esp
+  800f70:	50                   	push   %eax
+  800f71:	6a 16                	push   $0x16
+  800f73:	68 83 40 80 00       	push   $0x804083
+  800f78:	6a 23                	push   $0x23
+  800f7a:	68 a0 40 80 00       	push   $0x8040a0
+  800f7f:	e8 bb f3 ff ff       	call   80033f <_panic>
+
+00800f84 <sys_page_paddr>:
+
+int
+sys_page_paddr(void *va)
+{
+  800f84:	55                   	push   %ebp
+  800f85:	89 e5                	mov    %esp,%ebp
+  800f87:	57                   	push   %edi
+  800f88:	56                   	push   %esi
+  800f89:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800f8a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f8f:	8b 55 08             	mov    0x8(%ebp),%edx
+  800f92:	b8 17 00 00 00       	mov    $0x17,%eax
+  800f97:	89 cb                	mov    %ecx,%ebx
+  800f99:	89 cf                	mov    %ecx,%edi
+  800f9b:	89 ce                	mov    %ecx,%esi
+  800f9d:	cd 30                	int    $0x30
+  return syscall(SYS_page_paddr, 0, (uint32_t)va, 0, 0, 0, 0);
+}
+  800f9f:	5b                   	pop    %ebx
+  800fa0:	5e                   	pop    %esi
+  800fa1:	5f                   	pop    %edi
+  800fa2:	5d                   	pop    %ebp
+  800fa3:	c3                   	ret
+
+00800fa4 <sys_page_alloc_contig>:
+
+int
+sys_page_alloc_contig(void *va, size_t npages, int perm)
+{
+  800fa4:	55                   	push   %ebp
+  800fa5:	89 e5                	mov    %esp,%ebp
+  800fa7:	57                   	push   %edi
+  800fa8:	56                   	push   %esi
+  800fa9:	53                   	push   %ebx
+  800faa:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  800fad:	be 00 00 00 00       	mov    $0x0,%esi
+  800fb2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800fb5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800fb8:	b8 18 00 00 00       	mov    $0x18,%eax
+  800fbd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  800fc0:	89 f7                	mov    %esi,%edi
+  800fc2:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  800fc4:	85 c0                	test   %eax,%eax
+  800fc6:	7f 08                	jg     800fd0 <sys_page_alloc_contig+0x2c>
+  return syscall(SYS_page_alloc_contig, 1, (uint32_t)va, npages, perm, 0, 0);
+}
+  800fc8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  800fcb:	5b                   	pop    %ebx
+  800fcc:	5e                   	pop    %esi
+  800fcd:	5f                   	pop    %edi
+  800fce:	5d                   	pop    %ebp
+  800fcf:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  800fd0:	83 ec 0c             	sub    $0xc,%esp
+  800fd3:	50                   	push   %eax
+  800fd4:	6a 18                	push   $0x18
+  800fd6:	68 83 40 80 00       	push   $0x804083
+  800fdb:	6a 23                	push   $0x23
+  800fdd:	68 a0 40 80 00       	push   $0x8040a0
+  800fe2:	e8 58 f3 ff ff       	call   80033f <_panic>
+
+00800fe7 <sys_thread_create>:
+
+envid_t
+sys_thread_create(void *eip, void *esp, void *uxstacktop)
+{
+  800fe7:	55                   	push   %ebp
+  800fe8:	89 e5                	mov    %esp,%ebp
+  800fea:	57                   	push   %edi
+  800feb:	56                   	push   %esi
+  800fec:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  800fed:	be 00 00 00 00       	mov    $0x0,%esi
+  800ff2:	8b 55 08             	mov    0x8(%ebp),%edx
+  800ff5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  800ff8:	b8 19 00 00 00       	mov    $0x19,%eax
+  800ffd:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801000:	89 f7                	mov    %esi,%edi
+  801002:	cd 30                	int    $0x30
+  return syscall(SYS_thread_create, 0, (uint32_t)eip, (uint32_t)esp,
+                 (uint32_t)uxstacktop, 0, 0);
+}
+  801004:	5b                   	pop    %ebx
+  801005:	5e                   	pop    %esi
+  801006:	5f                   	pop    %edi
+  801007:	5d                   	pop    %ebp
+  801008:	c3                   	ret
+
+00801009 <sys_fork>:
+
+// sys_exofork is inlined in lib.h
+
+envid_t
+sys_fork(void)
+{
+  801009:	55                   	push   %ebp
+  80100a:	89 e5                	mov    %esp,%ebp
+  80100c:	57                   	push   %edi
+  80100d:	56                   	push   %esi
+  80100e:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  80100f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801014:	b8 15 00 00 00       	mov    $0x15,%eax
+  801019:	89 d1                	mov    %edx,%ecx
+  80101b:	89 d3                	mov    %edx,%ebx
+  80101d:	89 d7                	mov    %edx,%edi
+  80101f:	89 d6                	mov    %edx,%esi
+  801021:	cd 30                	int    $0x30
+  return syscall(SYS_fork, 0, 0, 0, 0, 0, 0);
+}
+  801023:	5b                   	pop    %ebx
+  801024:	5e                   	pop    %esi
+  801025:	5f                   	pop    %edi
+  801026:	5d                   	pop    %ebp
+  801027:	c3                   	ret
+
+00801028 <sys_env_set_status>:
+
+int
+sys_env_set_status(envid_t envid, int status)
+{
+  801028:	55                   	push   %ebp
+  801029:	89 e5                	mov    %esp,%ebp
+  80102b:	57                   	push   %edi
+  80102c:	56                   	push   %esi
+  80102d:	53                   	push   %ebx
+  80102e:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801031:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801036:	8b 55 08             	mov    0x8(%ebp),%edx
+  801039:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80103c:	b8 08 00 00 00       	mov    $0x8,%eax
+  801041:	89 df                	mov    %ebx,%edi
+  801043:	89 de                	mov    %ebx,%esi
+  801045:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801047:	85 c0                	test   %eax,%eax
+  801049:	7f 08                	jg     801053 <sys_env_set_status+0x2b>
+  return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0);
+}
+  80104b:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80104e:	5b                   	pop    %ebx
+  80104f:	5e                   	pop    %esi
+  801050:	5f                   	pop    %edi
+  801051:	5d                   	pop    %ebp
+  801052:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801053:	83 ec 0c             	sub    $0xc,%esp
+  801056:	50                   	push   %eax
+  801057:	6a 08                	push   $0x8
+  801059:	68 83 40 80 00       	push   $0x804083
+  80105e:	6a 23                	push   $0x23
+  801060:	68 a0 40 80 00       	push   $0x8040a0
+  801065:	e8 d5 f2 ff ff       	call   80033f <_panic>
+
+0080106a <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf)
+{
+  80106a:	55                   	push   %ebp
+  80106b:	89 e5                	mov    %esp,%ebp
+  80106d:	57                   	push   %edi
+  80106e:	56                   	push   %esi
+  80106f:	53                   	push   %ebx
+  801070:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801073:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801078:	8b 55 08             	mov    0x8(%ebp),%edx
+  80107b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80107e:	b8 09 00 00 00       	mov    $0x9,%eax
+  801083:	89 df                	mov    %ebx,%edi
+  801085:	89 de                	mov    %ebx,%esi
+  801087:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  801089:	85 c0                	test   %eax,%eax
+  80108b:	7f 08                	jg     801095 <sys_env_set_trapframe+0x2b>
+  return syscall(SYS_env_set_trapframe, 1, envid, (uint32_t)tf, 0, 0, 0);
+}
+  80108d:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801090:	5b                   	pop    %ebx
+  801091:	5e                   	pop    %esi
+  801092:	5f                   	pop    %edi
+  801093:	5d                   	pop    %ebp
+  801094:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  801095:	83 ec 0c             	sub    $0xc,%esp
+  801098:	50                   	push   %eax
+  801099:	6a 09                	push   $0x9
+  80109b:	68 83 40 80 00       	push   $0x804083
+  8010a0:	6a 23                	push   $0x23
+  8010a2:	68 a0 40 80 00       	push   $0x8040a0
+  8010a7:	e8 93 f2 ff ff       	call   80033f <_panic>
+
+008010ac <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall)
+{
+  8010ac:	55                   	push   %ebp
+  8010ad:	89 e5                	mov    %esp,%ebp
+  8010af:	57                   	push   %edi
+  8010b0:	56                   	push   %esi
+  8010b1:	53                   	push   %ebx
+  8010b2:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  8010b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8010ba:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010bd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010c0:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010c5:	89 df                	mov    %ebx,%edi
+  8010c7:	89 de                	mov    %ebx,%esi
+  8010c9:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  8010cb:	85 c0                	test   %eax,%eax
+  8010cd:	7f 08                	jg     8010d7 <sys_env_set_pgfault_upcall+0x2b>
+  return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uint32_t)upcall, 0, 0, 0);
+}
+  8010cf:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8010d2:	5b                   	pop    %ebx
+  8010d3:	5e                   	pop    %esi
+  8010d4:	5f                   	pop    %edi
+  8010d5:	5d                   	pop    %ebp
+  8010d6:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  8010d7:	83 ec 0c             	sub    $0xc,%esp
+  8010da:	50                   	push   %eax
+  8010db:	6a 0a                	push   $0xa
+  8010dd:	68 83 40 80 00       	push   $0x804083
+  8010e2:	6a 23                	push   $0x23
+  8010e4:	68 a0 40 80 00       	push   $0x8040a0
+  8010e9:	e8 51 f2 ff ff       	call   80033f <_panic>
+
+008010ee <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uint32_t value, void *srcva, int perm,
+                 size_t npages)
+{
+  8010ee:	55                   	push   %ebp
+  8010ef:	89 e5                	mov    %esp,%ebp
+  8010f1:	57                   	push   %edi
+  8010f2:	56                   	push   %esi
+  8010f3:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  8010f4:	8b 55 08             	mov    0x8(%ebp),%edx
+  8010f7:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8010fa:	b8 0c 00 00 00       	mov    $0xc,%eax
+  8010ff:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801102:	8b 7d 14             	mov    0x14(%ebp),%edi
+  801105:	8b 75 18             	mov    0x18(%ebp),%esi
+  801108:	cd 30                	int    $0x30
+  return syscall(SYS_ipc_try_send, 0, envid, value, (uint32_t)srcva, perm,
+                 npages);
+}
+  80110a:	5b                   	pop    %ebx
+  80110b:	5e                   	pop    %esi
+  80110c:	5f                   	pop    %edi
+  80110d:	5d                   	pop    %ebp
+  80110e:	c3                   	ret
+
+0080110f <sys_ipc_recv>:
+
+int
+sys_ipc_recv(void *dstva, size_t npages)
+{
+  80110f:	55                   	push   %ebp
+  801110:	89 e5                	mov    %esp,%ebp
+  801112:	57                   	push   %edi
+  801113:	56                   	push   %esi
+  801114:	53                   	push   %ebx
+  801115:	83 ec 0c             	sub    $0xc,%esp
+  asm volatile ("int %1\n"
+  801118:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80111d:	8b 55 08             	mov    0x8(%ebp),%edx
+  801120:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801123:	b8 0d 00 00 00       	mov    $0xd,%eax
+  801128:	89 df                	mov    %ebx,%edi
+  80112a:	89 de                	mov    %ebx,%esi
+  80112c:	cd 30                	int    $0x30
+  if (check && ret > 0)
+  80112e:	85 c0                	test   %eax,%eax
+  801130:	7f 08                	jg     80113a <sys_ipc_recv+0x2b>
+  return syscall(SYS_ipc_recv, 1, (uint32_t)dstva, npages, 0, 0, 0);
+}
+  801132:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801135:	5b                   	pop    %ebx
+  801136:	5e                   	pop    %esi
+  801137:	5f                   	pop    %edi
+  801138:	5d                   	pop    %ebp
+  801139:	c3                   	ret
+    panic("syscall %d returned %d (> 0)", num, ret);
+  80113a:	83 ec 0c             	sub    $0xc,%esp
+  80113d:	50                   	push   %eax
+  80113e:	6a 0d                	push   $0xd
+  801140:	68 83 40 80 00       	push   $0x804083
+  801145:	6a 23                	push   $0x23
+  801147:	68 a0 40 80 00       	push   $0x8040a0
+  80114c:	e8 ee f1 ff ff       	call   80033f <_panic>
+
+00801151 <sys_time_msec>:
+
+
+unsigned int
+sys_time_msec(void)
+{
+  801151:	55                   	push   %ebp
+  801152:	89 e5                	mov    %esp,%ebp
+  801154:	57                   	push   %edi
+  801155:	56                   	push   %esi
+  801156:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801157:	ba 00 00 00 00       	mov    $0x0,%edx
+  80115c:	b8 0e 00 00 00       	mov    $0xe,%eax
+  801161:	89 d1                	mov    %edx,%ecx
+  801163:	89 d3                	mov    %edx,%ebx
+  801165:	89 d7                	mov    %edx,%edi
+  801167:	89 d6                	mov    %edx,%esi
+  801169:	cd 30                	int    $0x30
+  return (unsigned int) syscall(SYS_time_msec, 0, 0, 0, 0, 0, 0);
+}
+  80116b:	5b                   	pop    %ebx
+  80116c:	5e                   	pop    %esi
+  80116d:	5f                   	pop    %edi
+  80116e:	5d                   	pop    %ebp
+  80116f:	c3                   	ret
+
+00801170 <sys_chan_sleep>:
+
+int
+sys_chan_sleep(volatile void *chan, uint32_t val, void *dstva, unsigned timeout)
+{
+  801170:	55                   	push   %ebp
+  801171:	89 e5                	mov    %esp,%ebp
+  801173:	57                   	push   %edi
+  801174:	56                   	push   %esi
+  801175:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801176:	8b 55 08             	mov    0x8(%ebp),%edx
+  801179:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  80117c:	b8 0f 00 00 00       	mov    $0xf,%eax
+  801181:	be 00 00 00 00       	mov    $0x0,%esi
+  801186:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  801189:	8b 7d 14             	mov    0x14(%ebp),%edi
+  80118c:	cd 30                	int    $0x30
+  return syscall(SYS_chan_sleep, 0, (uint32_t)chan, val, (uint32_t)dstva, timeout, 0);
+}
+  80118e:	5b                   	pop    %ebx
+  80118f:	5e                   	pop    %esi
+  801190:	5f                   	pop    %edi
+  801191:	5d                   	pop    %ebp
+  801192:	c3                   	ret
+
+00801193 <sys_chan_wakeup>:
+
+int
+sys_chan_wakeup(volatile void *chan, void *srcva, int perm)
+{
+  801193:	55                   	push   %ebp
+  801194:	89 e5                	mov    %esp,%ebp
+  801196:	57                   	push   %edi
+  801197:	56                   	push   %esi
+  801198:	53                   	push   %ebx
+  asm volatile ("int %1\n"
+  801199:	be 00 00 00 00       	mov    $0x0,%esi
+  80119e:	8b 55 08             	mov    0x8(%ebp),%edx
+  8011a1:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8011a4:	b8 10 00 00 00       	mov    $0x10,%eax
+  8011a9:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  8011ac:	89 f7                	mov    %esi,%edi
+  8011ae:	cd 30                	int    $0x30
+  return syscall(SYS_chan_wakeup, 0, (uint32_t)chan, (uint32_t)srcva, perm, 0, 0);
+}
+  8011b0:	5b                   	pop    %ebx
+  8011b1:	5e                   	pop    %esi
+  8011b2:	5f                   	pop    %edi
+  8011b3:	5d                   	pop    %ebp
+  8011b4:	c3                   	ret
+
+008011b5 <sys_batch>:
+// saving from batching can be measured.
+bool sysbatch_serial;
+
+int
+sys_batch(struct Syscall *calls, int n)
+{
+  8011b5:	55                   	push   %ebp
+  8011b6:	89 e5                	mov    %esp,%ebp
+  8011b8:	57                   	push   %edi
+  8011b9:	56                   	push   %esi
+  8011ba:	53                   	push   %ebx
+  8011bb:	83 ec 08             	sub    $0x8,%esp
+  int i;
+
+  if (!sysbatch_serial)
+  8011be:	80 3d a4 68 80 00 00 	cmpb   $0x0,0x8068a4
+  8011c5:	74 41                	je     801208 <sys_batch+0x53>
+  8011c7:	8b 45 08             	mov    0x8(%ebp),%eax
+  8011ca:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    return syscall(SYS_batch, 0, (uint32_t)calls, n, 0, 0, 0);
+
+  for (i = 0; i < n; i++) {
+  8011cd:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  8011d4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  8011d7:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  8011da:	7d 45                	jge    801221 <sys_batch+0x6c>
+  asm volatile ("int %1\n"
+  8011dc:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8011df:	8b 06                	mov    (%esi),%eax
+  8011e1:	8b 56 04             	mov    0x4(%esi),%edx
+  8011e4:	8b 4e 08             	mov    0x8(%esi),%ecx
+  8011e7:	8b 5e 0c             	mov    0xc(%esi),%ebx
+  8011ea:	8b 7e 10             	mov    0x10(%esi),%edi
+  8011ed:	8b 76 14             	mov    0x14(%esi),%esi
+  8011f0:	cd 30                	int    $0x30
+    calls[i].sc_ret = syscall(calls[i].sc_num, 0,
+  8011f2:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  8011f5:	89 46 18             	mov    %eax,0x18(%esi)
+                              calls[i].sc_args[0], calls[i].sc_args[1],
+                              calls[i].sc_args[2], calls[i].sc_args[3],
+                              calls[i].sc_args[4]);
+    if (calls[i].sc_ret < 0)
+  8011f8:	83 c6 1c             	add    $0x1c,%esi
+  8011fb:	89 75 f0             	mov    %esi,-0x10(%ebp)
+  8011fe:	85 c0                	test   %eax,%eax
+  801200:	78 1f                	js     801221 <sys_batch+0x6c>
+  for (i = 0; i < n; i++) {
+  801202:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  801206:	eb cc                	jmp    8011d4 <sys_batch+0x1f>
+  asm volatile ("int %1\n"
+  801208:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80120d:	b8 13 00 00 00       	mov    $0x13,%eax
+  801212:	8b 55 08             	mov    0x8(%ebp),%edx
+  801215:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  801218:	89 df                	mov    %ebx,%edi
+  80121a:	89 de                	mov    %ebx,%esi
+  80121c:	cd 30                	int    $0x30
+  80121e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      break;
+  }
+  return i;
+}
+  801221:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  801224:	83 c4 08             	add    $0x8,%esp
+  801227:	5b                   	pop    %ebx
+  801228:	5e                   	pop    %esi
+  801229:	5f                   	pop    %edi
+  80122a:	5d                   	pop    %ebp
+  80122b:	c3                   	ret
+
+0080122c <sysbatch_init>:
+
+void
+sysbatch_init(struct SysBatch *b)
+{
+  80122c:	55                   	push   %ebp
+  80122d:	89 e5                	mov    %esp,%ebp
+  b->sb_n = 0;
+  80122f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801232:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+  801238:	5d                   	pop    %ebp
+  801239:	c3                   	ret
+
+0080123a <sysbatch_flush>:
+// Run the queued calls in one trap and empty 'b'.
+// Returns 0, or the error of the first call that failed; later calls
+// were not run.
+int
+sysbatch_flush(struct SysBatch *b)
+{
+  80123a:	55                   	push   %ebp
+  80123b:	89 e5                	mov    %esp,%ebp
+  80123d:	56                   	push   %esi
+  80123e:	53                   	push   %ebx
+  80123f:	8b 75 08             	mov    0x8(%ebp),%esi
+  int n, r;
+
+  if ((n = b->sb_n) == 0)
+  801242:	8b 1e                	mov    (%esi),%ebx
+  801244:	85 db                	test   %ebx,%ebx
+  801246:	75 09                	jne    801251 <sysbatch_flush+0x17>
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+    return r;
+  if (r < n)
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  return 0;
+}
+  801248:	89 d8                	mov    %ebx,%eax
+  80124a:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  80124d:	5b                   	pop    %ebx
+  80124e:	5e                   	pop    %esi
+  80124f:	5d                   	pop    %ebp
+  801250:	c3                   	ret
+  b->sb_n = 0;
+  801251:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  if ((r = sys_batch(b->sb_calls, n)) < 0)
+  801257:	53                   	push   %ebx
+  801258:	8d 46 04             	lea    0x4(%esi),%eax
+  80125b:	50                   	push   %eax
+  80125c:	e8 54 ff ff ff       	call   8011b5 <sys_batch>
+  801261:	83 c4 08             	add    $0x8,%esp
+  801264:	85 c0                	test   %eax,%eax
+  801266:	78 1e                	js     801286 <sysbatch_flush+0x4c>
+  if (r < n)
+  801268:	39 c3                	cmp    %eax,%ebx
+  80126a:	7f 07                	jg     801273 <sysbatch_flush+0x39>
+  return 0;
+  80126c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801271:	eb d5                	jmp    801248 <sysbatch_flush+0xe>
+    return b->sb_calls[r].sc_ret < 0 ? b->sb_calls[r].sc_ret : -E_INVAL;
+  801273:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  801276:	8b 5c 06 1c          	mov    0x1c(%esi,%eax,1),%ebx
+  80127a:	85 db                	test   %ebx,%ebx
+  80127c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801281:	0f 49 d8             	cmovns %eax,%ebx
+  801284:	eb c2                	jmp    801248 <sysbatch_flush+0xe>
+    return r;
+  801286:	89 c3                	mov    %eax,%ebx
+  801288:	eb be                	jmp    801248 <sysbatch_flush+0xe>
+
+0080128a <sysbatch_add>:
+{
+  80128a:	55                   	push   %ebp
+  80128b:	89 e5                	mov    %esp,%ebp
+  80128d:	53                   	push   %ebx
+  80128e:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  801291:	83 3b 40             	cmpl   $0x40,(%ebx)
+  801294:	74 41                	je     8012d7 <sysbatch_add+0x4d>
+  sc = &b->sb_calls[b->sb_n++];
+  801296:	8b 03                	mov    (%ebx),%eax
+  801298:	8d 50 01             	lea    0x1(%eax),%edx
+  80129b:	89 13                	mov    %edx,(%ebx)
+  sc->sc_num = num;
+  80129d:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8012a0:	01 d8                	add    %ebx,%eax
+  8012a2:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8012a5:	89 50 04             	mov    %edx,0x4(%eax)
+  sc->sc_args[0] = a1;
+  8012a8:	8b 55 10             	mov    0x10(%ebp),%edx
+  8012ab:	89 50 08             	mov    %edx,0x8(%eax)
+  sc->sc_args[1] = a2;
+  8012ae:	8b 55 14             	mov    0x14(%ebp),%edx
+  8012b1:	89 50 0c             	mov    %edx,0xc(%eax)
+  sc->sc_args[2] = a3;
+  8012b4:	8b 55 18             	mov    0x18(%ebp),%edx
+  8012b7:	89 50 10             	mov    %edx,0x10(%eax)
+  sc->sc_args[3] = a4;
+  8012ba:	8b 55 1c             	mov    0x1c(%ebp),%edx
+  8012bd:	89 50 14             	mov    %edx,0x14(%eax)
+  sc->sc_args[4] = a5;
+  8012c0:	8b 55 20             	mov    0x20(%ebp),%edx
+  8012c3:	89 50 18             	mov    %edx,0x18(%eax)
+  sc->sc_ret = 0;
+  8012c6:	c7 40 1c 00 00 00 00 	movl   $0x0,0x1c(%eax)
+  return 0;
+  8012cd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8012d2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8012d5:	c9                   	leave
+  8012d6:	c3                   	ret
+  if (b->sb_n == SYSBATCH_MAX && (r = sysbatch_flush(b)) < 0)
+  8012d7:	53                   	push   %ebx
+  8012d8:	e8 5d ff ff ff       	call   80123a <sysbatch_flush>
+  8012dd:	83 c4 04             	add    $0x4,%esp
+  8012e0:	85 c0                	test   %eax,%eax
+  8012e2:	79 b2                	jns    801296 <sysbatch_add+0xc>
+  8012e4:	eb ec                	jmp    8012d2 <sysbatch_add+0x48>
+
+008012e6 <pgfault>:
+// Custom page fault handler - if faulting page is copy-on-write,
+// map in our own private writable copy.
+//
+static void
+pgfault(struct UTrapframe *utf)
+{
+  8012e6:	55                   	push   %ebp
+  8012e7:	89 e5                	mov    %esp,%ebp
+  8012e9:	56                   	push   %esi
+  8012ea:	53                   	push   %ebx
+  8012eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  void *addr = (void*)utf->utf_fault_va;
+  8012ee:	8b 18                	mov    (%eax),%ebx
+  uint32_t err = utf->utf_err;
+  8012f0:	8b 70 04             	mov    0x4(%eax),%esi
+  // Hint:
+  //   Use the read-only page table mappings at uvpt
+  //   (see <inc/memlayout.h>).
+
+  // Faults in file mappings are mmap's to handle.
+  if (mmap_fault(utf))
+  8012f3:	83 ec 0c             	sub    $0xc,%esp
+  8012f6:	50                   	push   %eax
+  8012f7:	e8 05 1e 00 00       	call   803101 <mmap_fault>
+  8012fc:	83 c4 10             	add    $0x10,%esp
+  8012ff:	84 c0                	test   %al,%al
+  801301:	75 7d                	jne    801380 <pgfault+0x9a>
+    return;
+
+  // LAB 4: Your code here.
+  if ( !(err & FEC_WR) ) {
+  801303:	f7 c6 02 00 00 00    	test   $0x2,%esi
+  801309:	74 7c                	je     801387 <pgfault+0xa1>
+    panic("user_pgfault: %e", err);
+  }
+
+  if ( !(uvpt[PGNUM(addr)] & PTE_COW) ) {
+  80130b:	89 d8                	mov    %ebx,%eax
+  80130d:	c1 e8 0c             	shr    $0xc,%eax
+  801310:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801317:	f6 c4 08             	test   $0x8,%ah
+  80131a:	74 7d                	je     801399 <pgfault+0xb3>
+  // page to the old page's address.
+  // Hint:
+  //   You should make three system calls.
+
+  // LAB 4: Your code here.
+  addr = ROUNDDOWN(addr, PGSIZE);
+  80131c:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+
+  // map page to temporary location
+  if ( (r = sys_page_alloc(0, PFTEMP, (PTE_P | PTE_U | PTE_W))) < 0) {
+  801322:	83 ec 04             	sub    $0x4,%esp
+  801325:	6a 07                	push   $0x7
+  801327:	68 00 f0 7f 00       	push   $0x7ff000
+  80132c:	6a 00                	push   $0x0
+  80132e:	e8 04 fb ff ff       	call   800e37 <sys_page_alloc>
+  801333:	83 c4 10             	add    $0x10,%esp
+  801336:	85 c0                	test   %eax,%eax
+  801338:	78 73                	js     8013ad <pgfault+0xc7>
+    panic("sys_page_alloc: %e", r);
+  }
+
+  // copy data from old page to new page
+  memmove(PFTEMP, addr, PGSIZE);
+  80133a:	83 ec 04             	sub    $0x4,%esp
+  80133d:	68 00 10 00 00       	push   $0x1000
+  801342:	53                   	push   %ebx
+  801343:	68 00 f0 7f 00       	push   $0x7ff000
+  801348:	e8 41 f8 ff ff       	call   800b8e <memmove>
+
+  // move new page to old page address
+  if ( (r = sys_page_map(0, PFTEMP, 0, addr, (PTE_P | PTE_U | PTE_W))) < 0) {
+  80134d:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801354:	53                   	push   %ebx
+  801355:	6a 00                	push   $0x0
+  801357:	68 00 f0 7f 00       	push   $0x7ff000
+  80135c:	6a 00                	push   $0x0
+  80135e:	e8 17 fb ff ff       	call   800e7a <sys_page_map>
+  801363:	83 c4 20             	add    $0x20,%esp
+  801366:	85 c0                	test   %eax,%eax
+  801368:	78 55                	js     8013bf <pgfault+0xd9>
+    panic("sys_page_map: %e", r);
+  }
+
+  if ( (r = sys_page_unmap(0, PFTEMP)) < 0) {
+  80136a:	83 ec 08             	sub    $0x8,%esp
+  80136d:	68 00 f0 7f 00       	push   $0x7ff000
+  801372:	6a 00                	push   $0x0
+  801374:	e8 43 fb ff ff       	call   800ebc <sys_page_unmap>
+  801379:	83 c4 10             	add    $0x10,%esp
+  80137c:	85 c0                	test   %eax,%eax
+  80137e:	78 51                	js     8013d1 <pgfault+0xeb>
+    panic("sys_page_unmap: %e", r);
+  }
+}
+  801380:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801383:	5b                   	pop    %ebx
+  801384:	5e                   	pop    %esi
+  801385:	5d                   	pop    %ebp
+  801386:	c3                   	ret
+    panic("user_pgfault: %e", err);
+  801387:	56                   	push   %esi
+  801388:	68 ae 40 80 00       	push   $0x8040ae
+  80138d:	6a 1d                	push   $0x1d
+  80138f:	68 bf 40 80 00       	push   $0x8040bf
+  801394:	e8 a6 ef ff ff       	call   80033f <_panic>
+    panic("user_pgfault: page not COW");
+  801399:	83 ec 04             	sub    $0x4,%esp
+  80139c:	68 ca 40 80 00       	push   $0x8040ca
+  8013a1:	6a 21                	push   $0x21
+  8013a3:	68 bf 40 80 00       	push   $0x8040bf
+  8013a8:	e8 92 ef ff ff       	call   80033f <_panic>
+    panic("sys_page_alloc: %e", r);
+  8013ad:	50                   	push   %eax
+  8013ae:	68 e5 40 80 00       	push   $0x8040e5
+  8013b3:	6a 2f                	push   $0x2f
+  8013b5:	68 bf 40 80 00       	push   $0x8040bf
+  8013ba:	e8 80 ef ff ff       	call   80033f <_panic>
+    panic("sys_page_map: %e", r);
+  8013bf:	50                   	push   %eax
+  8013c0:	68 f8 40 80 00       	push   $0x8040f8
+  8013c5:	6a 37                	push   $0x37
+  8013c7:	68 bf 40 80 00       	push   $0x8040bf
+  8013cc:	e8 6e ef ff ff       	call   80033f <_panic>
+    panic("sys_page_unmap: %e", r);
+  8013d1:	50                   	push   %eax
+  8013d2:	68 09 41 80 00       	push   $0x804109
+  8013d7:	6a 3b                	push   $0x3b
+  8013d9:	68 bf 40 80 00       	push   $0x8040bf
+  8013de:	e8 5c ef ff ff       	call   80033f <_panic>
+
+008013e3 <shared_pgfault>:
+
+// Challenge!
+//
+static void
+shared_pgfault(struct UTrapframe *utf)
+{
+  8013e3:	55                   	push   %ebp
+  8013e4:	89 e5                	mov    %esp,%ebp
+  8013e6:	53                   	push   %ebx
+  8013e7:	83 ec 10             	sub    $0x10,%esp
+  8013ea:	8b 45 08             	mov    0x8(%ebp),%eax
+  // just has fewer error checks
+  
+  void *addr = (void*)utf->utf_fault_va;
+  8013ed:	8b 18                	mov    (%eax),%ebx
+  uint32_t err = utf->utf_err;
+  int r;
+
+  if (mmap_fault(utf))
+  8013ef:	50                   	push   %eax
+  8013f0:	e8 0c 1d 00 00       	call   803101 <mmap_fault>
+  8013f5:	83 c4 10             	add    $0x10,%esp
+  8013f8:	84 c0                	test   %al,%al
+  8013fa:	74 05                	je     801401 <shared_pgfault+0x1e>
+  }
+
+  if ( (r = sys_page_unmap(0, PFTEMP)) < 0) {
+    panic("sys_page_unmap: %e", r);
+  }
+}
+  8013fc:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8013ff:	c9                   	leave
+  801400:	c3                   	ret
+  addr = ROUNDDOWN(addr, PGSIZE);
+  801401:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if ( (r = sys_page_alloc(0, PFTEMP, (PTE_P | PTE_U | PTE_W))) < 0) {
+  801407:	83 ec 04             	sub    $0x4,%esp
+  80140a:	6a 07                	push   $0x7
+  80140c:	68 00 f0 7f 00       	push   $0x7ff000
+  801411:	6a 00                	push   $0x0
+  801413:	e8 1f fa ff ff       	call   800e37 <sys_page_alloc>
+  801418:	83 c4 10             	add    $0x10,%esp
+  80141b:	85 c0                	test   %eax,%eax
+  80141d:	78 5b                	js     80147a <shared_pgfault+0x97>
+  memmove(PFTEMP, addr, PGSIZE);
+  80141f:	83 ec 04             	sub    $0x4,%esp
+  801422:	68 00 10 00 00       	push   $0x1000
+  801427:	53                   	push   %ebx
+  801428:	68 00 f0 7f 00       	push   $0x7ff000
+  80142d:	e8 5c f7 ff ff       	call   800b8e <memmove>
+  if ( (r = sys_page_map(0, PFTEMP, 0, addr, (PTE_P | PTE_U | PTE_W))) < 0) {
+  801432:	c7 04 24 07 00 00 00 	movl   $0x7,(%esp)
+  801439:	53                   	push   %ebx
+  80143a:	6a 00                	push   $0x0
+  80143c:	68 00 f0 7f 00       	push   $0x7ff000
+  801441:	6a 00                	push   $0x0
+  801443:	e8 32 fa ff ff       	call   800e7a <sys_page_map>
+  801448:	83 c4 20             	add    $0x20,%esp
+  80144b:	85 c0                	test   %eax,%eax
+  80144d:	78 40                	js     80148f <shared_pgfault+0xac>
+  if ( (r = sys_page_unmap(0, PFTEMP)) < 0) {
+  80144f:	83 ec 08             	sub    $0x8,%esp
+  801452:	68 00 f0 7f 00       	push   $0x7ff000
+  801457:	6a 00                	push   $0x0
+  801459:	e8 5e fa ff ff       	call   800ebc <sys_page_unmap>
+  80145e:	83 c4 10             	add    $0x10,%esp
+  801461:	85 c0                	test   %eax,%eax
+  801463:	79 97                	jns    8013fc <shared_pgfault+0x19>
+    panic("sys_page_unmap: %e", r);
+  801465:	50                   	push   %eax
+  801466:	68 09 41 80 00       	push   $0x804109
+  80146b:	68 b0 00 00 00       	push   $0xb0
+  801470:	68 bf 40 80 00       	push   $0x8040bf
+  801475:	e8 c5 ee ff ff       	call   80033f <_panic>
+    panic("sys_page_alloc: %e", r);
+  80147a:	50                   	push   %eax
+  80147b:	68 e5 40 80 00       	push   $0x8040e5
+  801480:	68 a4 00 00 00       	push   $0xa4
+  801485:	68 bf 40 80 00       	push   $0x8040bf
+  80148a:	e8 b0 ee ff ff       	call   80033f <_panic>
+    panic("sys_page_map: %e", r);
+  80148f:	50                   	push   %eax
+  801490:	68 f8 40 80 00       	push   $0x8040f8
+  801495:	68 ac 00 00 00       	push   $0xac
+  80149a:	68 bf 40 80 00       	push   $0x8040bf
+  80149f:	e8 9b ee ff ff       	call   80033f <_panic>
+
+008014a4 <fork>:
+{
+  8014a4:	55                   	push   %ebp
+  8014a5:	89 e5                	mov    %esp,%ebp
+  8014a7:	53                   	push   %ebx
+  8014a8:	83 ec 04             	sub    $0x4,%esp
+  parent_id = sys_getenvid();
+  8014ab:	e8 06 f9 ff ff       	call   800db6 <sys_getenvid>
+  set_pgfault_handler(pgfault);
+  8014b0:	83 ec 0c             	sub    $0xc,%esp
+  8014b3:	68 e6 12 80 00       	push   $0x8012e6
+  8014b8:	e8 d3 22 00 00       	call   803790 <set_pgfault_handler>
+// This must be inlined.  Exercise for reader: why?
+static __inline envid_t __attribute__((always_inline))
+sys_exofork(void)
+{
+  envid_t ret;
+  __asm __volatile("int %2"
+  8014bd:	b8 07 00 00 00       	mov    $0x7,%eax
+  8014c2:	cd 30                	int    $0x30
+  8014c4:	89 c3                	mov    %eax,%ebx
+  if (envid < 0) {
+  8014c6:	83 c4 10             	add    $0x10,%esp
+  8014c9:	85 c0                	test   %eax,%eax
+  8014cb:	78 66                	js     801533 <fork+0x8f>
+  } else if (envid == 0) {
+  8014cd:	74 76                	je     801545 <fork+0xa1>
+  if ( (error = sys_page_map_range(0, 0, UXSTACKTOP - PGSIZE,
+  8014cf:	83 ec 0c             	sub    $0xc,%esp
+  8014d2:	6a 01                	push   $0x1
+  8014d4:	50                   	push   %eax
+  8014d5:	68 00 f0 bf ee       	push   $0xeebff000
+  8014da:	6a 00                	push   $0x0
+  8014dc:	6a 00                	push   $0x0
+  8014de:	e8 1b fa ff ff       	call   800efe <sys_page_map_range>
+  8014e3:	83 c4 20             	add    $0x20,%esp
+  8014e6:	85 c0                	test   %eax,%eax
+  8014e8:	78 77                	js     801561 <fork+0xbd>
+  if ( (error = sys_page_alloc(envid,
+  8014ea:	83 ec 04             	sub    $0x4,%esp
+  8014ed:	6a 07                	push   $0x7
+  8014ef:	68 00 f0 bf ee       	push   $0xeebff000
+  8014f4:	53                   	push   %ebx
+  8014f5:	e8 3d f9 ff ff       	call   800e37 <sys_page_alloc>
+  8014fa:	83 c4 10             	add    $0x10,%esp
+  8014fd:	85 c0                	test   %eax,%eax
+  8014ff:	78 72                	js     801573 <fork+0xcf>
+          thisenv->env_pgfault_upcall)) < 0) {
+  801501:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  801506:	8b 40 64             	mov    0x64(%eax),%eax
+  if ( (error = sys_env_set_pgfault_upcall(envid,
+  801509:	83 ec 08             	sub    $0x8,%esp
+  80150c:	50                   	push   %eax
+  80150d:	53                   	push   %ebx
+  80150e:	e8 99 fb ff ff       	call   8010ac <sys_env_set_pgfault_upcall>
+  801513:	83 c4 10             	add    $0x10,%esp
+  801516:	85 c0                	test   %eax,%eax
+  801518:	78 6b                	js     801585 <fork+0xe1>
+  if ( (error = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+  80151a:	83 ec 08             	sub    $0x8,%esp
+  80151d:	6a 02                	push   $0x2
+  80151f:	53                   	push   %ebx
+  801520:	e8 03 fb ff ff       	call   801028 <sys_env_set_status>
+  801525:	83 c4 10             	add    $0x10,%esp
+  801528:	85 c0                	test   %eax,%eax
+  80152a:	78 6b                	js     801597 <fork+0xf3>
+}
+  80152c:	89 d8                	mov    %ebx,%eax
+  80152e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801531:	c9                   	leave
+  801532:	c3                   	ret
+    panic("sys_exofork: %e", envid);
+  801533:	50                   	push   %eax
+  801534:	68 1c 41 80 00       	push   $0x80411c
+  801539:	6a 5e                	push   $0x5e
+  80153b:	68 bf 40 80 00       	push   $0x8040bf
+  801540:	e8 fa ed ff ff       	call   80033f <_panic>
+    thisenv = &envs[ENVX(sys_getenvid())];
+  801545:	e8 6c f8 ff ff       	call   800db6 <sys_getenvid>
+  80154a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80154f:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  801552:	c1 e0 04             	shl    $0x4,%eax
+  801555:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80155a:	a3 a0 68 80 00       	mov    %eax,0x8068a0
+    return 0;
+  80155f:	eb cb                	jmp    80152c <fork+0x88>
+    panic("sys_page_map_range: %e", error);
+  801561:	50                   	push   %eax
+  801562:	68 2c 41 80 00       	push   $0x80412c
+  801567:	6a 69                	push   $0x69
+  801569:	68 bf 40 80 00       	push   $0x8040bf
+  80156e:	e8 cc ed ff ff       	call   80033f <_panic>
+    panic("sys_page_alloc: %e", error);
+  801573:	50                   	push   %eax
+  801574:	68 e5 40 80 00       	push   $0x8040e5
+  801579:	6a 70                	push   $0x70
+  80157b:	68 bf 40 80 00       	push   $0x8040bf
+  801580:	e8 ba ed ff ff       	call   80033f <_panic>
+    panic("sys_env_set_pgfault_upcall: %e", error);
+  801585:	50                   	push   %eax
+  801586:	68 5c 41 80 00       	push   $0x80415c
+  80158b:	6a 76                	push   $0x76
+  80158d:	68 bf 40 80 00       	push   $0x8040bf
+  801592:	e8 a8 ed ff ff       	call   80033f <_panic>
+    panic("sys_env_set_status: %e", error);
+  801597:	50                   	push   %eax
+  801598:	68 43 41 80 00       	push   $0x804143
+  80159d:	6a 7a                	push   $0x7a
+  80159f:	68 bf 40 80 00       	push   $0x8040bf
+  8015a4:	e8 96 ed ff ff       	call   80033f <_panic>
+
+008015a9 <kfork>:
+{
+  8015a9:	55                   	push   %ebp
+  8015aa:	89 e5                	mov    %esp,%ebp
+  8015ac:	53                   	push   %ebx
+  8015ad:	83 ec 10             	sub    $0x10,%esp
+  set_pgfault_handler(pgfault);
+  8015b0:	68 e6 12 80 00       	push   $0x8012e6
+  8015b5:	e8 d6 21 00 00       	call   803790 <set_pgfault_handler>
+  if ((envid = sys_fork()) == 0)
+  8015ba:	e8 4a fa ff ff       	call   801009 <sys_fork>
+  8015bf:	89 c3                	mov    %eax,%ebx
+  8015c1:	83 c4 10             	add    $0x10,%esp
+  8015c4:	85 c0                	test   %eax,%eax
+  8015c6:	74 07                	je     8015cf <kfork+0x26>
+}
+  8015c8:	89 d8                	mov    %ebx,%eax
+  8015ca:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8015cd:	c9                   	leave
+  8015ce:	c3                   	ret
+    thisenv = &envs[ENVX(sys_getenvid())];
+  8015cf:	e8 e2 f7 ff ff       	call   800db6 <sys_getenvid>
+  8015d4:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8015d9:	8d 04 c0             	lea    (%eax,%eax,8),%eax
+  8015dc:	c1 e0 04             	shl    $0x4,%eax
+  8015df:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  8015e4:	a3 a0 68 80 00       	mov    %eax,0x8068a0
+  return envid;
+  8015e9:	eb dd                	jmp    8015c8 <kfork+0x1f>
+
+008015eb <sfork>:
+
+int
+sfork(void)
+{
+  8015eb:	55                   	push   %ebp
+  8015ec:	89 e5                	mov    %esp,%ebp
+  8015ee:	53                   	push   %ebx
+  8015ef:	83 ec 04             	sub    $0x4,%esp
+  envid_t envid, parent_id;
+  int error;
+
+  parent_id = sys_getenvid();
+  8015f2:	e8 bf f7 ff ff       	call   800db6 <sys_getenvid>
+
+  // set up page fault handler
+  set_pgfault_handler(shared_pgfault);
+  8015f7:	83 ec 0c             	sub    $0xc,%esp
+  8015fa:	68 e3 13 80 00       	push   $0x8013e3
+  8015ff:	e8 8c 21 00 00       	call   803790 <set_pgfault_handler>
+  801604:	b8 07 00 00 00       	mov    $0x7,%eax
+  801609:	cd 30                	int    $0x30
+  80160b:	89 c3                	mov    %eax,%ebx
+
+  // create a child with sys_exofork
+  envid = sys_exofork();
+  
+  if (envid < 0) {
+  80160d:	83 c4 10             	add    $0x10,%esp
+  801610:	85 c0                	test   %eax,%eax
+  801612:	78 09                	js     80161d <sfork+0x32>
+    panic("sys_exofork: %e", envid);
+  } else if (envid == 0) {
+  801614:	75 1c                	jne    801632 <sfork+0x47>
+  if ( (error = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+    panic("sys_env_set_status: %e", error);
+  }
+
+  return envid;
+}
+  801616:	89 d8                	mov    %ebx,%eax
+  801618:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80161b:	c9                   	leave
+  80161c:	c3                   	ret
+    panic("sys_exofork: %e", envid);
+  80161d:	50                   	push   %eax
+  80161e:	68 1c 41 80 00       	push   $0x80411c
+  801623:	68 c3 00 00 00       	push   $0xc3
+  801628:	68 bf 40 80 00       	push   $0x8040bf
+  80162d:	e8 0d ed ff ff       	call   80033f <_panic>
+  if ( (error = sys_page_map_range(0, 0, USTACKTOP - PGSIZE,
+  801632:	83 ec 0c             	sub    $0xc,%esp
+  801635:	6a 00                	push   $0x0
+  801637:	50                   	push   %eax
+  801638:	68 00 d0 bf ee       	push   $0xeebfd000
+  80163d:	6a 00                	push   $0x0
+  80163f:	6a 00                	push   $0x0
+  801641:	e8 b8 f8 ff ff       	call   800efe <sys_page_map_range>
+  801646:	83 c4 20             	add    $0x20,%esp
+  801649:	85 c0                	test   %eax,%eax
+  80164b:	78 79                	js     8016c6 <sfork+0xdb>
+  if ( (error = sys_page_map_range(0, (void *) (USTACKTOP - PGSIZE), PGSIZE,
+  80164d:	83 ec 0c             	sub    $0xc,%esp
+  801650:	6a 01                	push   $0x1
+  801652:	53                   	push   %ebx
+  801653:	68 00 10 00 00       	push   $0x1000
+  801658:	68 00 d0 bf ee       	push   $0xeebfd000
+  80165d:	6a 00                	push   $0x0
+  80165f:	e8 9a f8 ff ff       	call   800efe <sys_page_map_range>
+  801664:	83 c4 20             	add    $0x20,%esp
+  801667:	85 c0                	test   %eax,%eax
+  801669:	78 70                	js     8016db <sfork+0xf0>
+  if ( (error = sys_page_alloc(envid,
+  80166b:	83 ec 04             	sub    $0x4,%esp
+  80166e:	6a 07                	push   $0x7
+  801670:	68 00 f0 bf ee       	push   $0xeebff000
+  801675:	53                   	push   %ebx
+  801676:	e8 bc f7 ff ff       	call   800e37 <sys_page_alloc>
+  80167b:	83 c4 10             	add    $0x10,%esp
+  80167e:	85 c0                	test   %eax,%eax
+  801680:	78 6e                	js     8016f0 <sfork+0x105>
+          thisenv->env_pgfault_upcall)) < 0) {
+  801682:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  801687:	8b 40 64             	mov    0x64(%eax),%eax
+  if ( (error = sys_env_set_pgfault_upcall(envid,
+  80168a:	83 ec 08             	sub    $0x8,%esp
+  80168d:	50                   	push   %eax
+  80168e:	53                   	push   %ebx
+  80168f:	e8 18 fa ff ff       	call   8010ac <sys_env_set_pgfault_upcall>
+  801694:	83 c4 10             	add    $0x10,%esp
+  801697:	85 c0                	test   %eax,%eax
+  801699:	78 6a                	js     801705 <sfork+0x11a>
+  if ( (error = sys_env_set_status(envid, ENV_RUNNABLE)) < 0) {
+  80169b:	83 ec 08             	sub    $0x8,%esp
+  80169e:	6a 02                	push   $0x2
+  8016a0:	53                   	push   %ebx
+  8016a1:	e8 82 f9 ff ff       	call   801028 <sys_env_set_status>
+  8016a6:	83 c4 10             	add    $0x10,%esp
+  8016a9:	85 c0                	test   %eax,%eax
+  8016ab:	0f 89 65 ff ff ff    	jns    801616 <sfork+0x2b>
+    panic("sys_env_set_status: %e", error);
+  8016b1:	50                   	push   %eax
+  8016b2:	68 43 41 80 00       	push   $0x804143
+  8016b7:	68 e4 00 00 00       	push   $0xe4
+  8016bc:	68 bf 40 80 00       	push   $0x8040bf
+  8016c1:	e8 79 ec ff ff       	call   80033f <_panic>
+    panic("sys_page_map_range: %e", error);
+  8016c6:	50                   	push   %eax
+  8016c7:	68 2c 41 80 00       	push   $0x80412c
+  8016cc:	68 ce 00 00 00       	push   $0xce
+  8016d1:	68 bf 40 80 00       	push   $0x8040bf
+  8016d6:	e8 64 ec ff ff       	call   80033f <_panic>
+    panic("sys_page_map_range: %e", error);
+  8016db:	50                   	push   %eax
+  8016dc:	68 2c 41 80 00       	push   $0x80412c
+  8016e1:	68 d3 00 00 00       	push   $0xd3
+  8016e6:	68 bf 40 80 00       	push   $0x8040bf
+  8016eb:	e8 4f ec ff ff       	call   80033f <_panic>
+    panic("sys_page_alloc: %e", error);
+  8016f0:	50                   	push   %eax
+  8016f1:	68 e5 40 80 00       	push   $0x8040e5
+  8016f6:	68 da 00 00 00       	push   $0xda
+  8016fb:	68 bf 40 80 00       	push   $0x8040bf
+  801700:	e8 3a ec ff ff       	call   80033f <_panic>
+    panic("sys_env_set_pgfault_upcall: %e", error);
+  801705:	50                   	push   %eax
+  801706:	68 5c 41 80 00       	push   $0x80415c
+  80170b:	68 e0 00 00 00       	push   $0xe0
+  801710:	68 bf 40 80 00       	push   $0x8040bf
+  801715:	e8 25 ec ff ff       	call   80033f <_panic>
+
+0080171a <fd2num>:
+// File descriptor manipulators
+// --------------------------------------------------------------
+
+int
+fd2num(struct Fd *fd)
+{
+  80171a:	55                   	push   %ebp
+  80171b:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80171d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801720:	05 00 00 00 30       	add    $0x30000000,%eax
+  801725:	c1 e8 0c             	shr    $0xc,%eax
+}
+  801728:	5d                   	pop    %ebp
+  801729:	c3                   	ret
+
+0080172a <fd2data>:
+
+char*
+fd2data(struct Fd *fd)
+{
+  80172a:	55                   	push   %ebp
+  80172b:	89 e5                	mov    %esp,%ebp
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  80172d:	8b 45 08             	mov    0x8(%ebp),%eax
+  801730:	c1 e0 04             	shl    $0x4,%eax
+  return INDEX2DATA(fd2num(fd));
+  801733:	66 b8 00 00          	mov    $0x0,%ax
+  801737:	2d 00 00 fe 2f       	sub    $0x2ffe0000,%eax
+}
+  80173c:	5d                   	pop    %ebp
+  80173d:	c3                   	ret
+
+0080173e <fd_alloc>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_MAX_FD: no more file descriptors
+// On error, *fd_store is set to 0.
+int
+fd_alloc(struct Fd **fd_store)
+{
+  80173e:	55                   	push   %ebp
+  80173f:	89 e5                	mov    %esp,%ebp
+  int i;
+  struct Fd *fd;
+
+  for (i = 0; i < MAXFD; i++) {
+  801741:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  801746:	eb 02                	jmp    80174a <fd_alloc+0xc>
+  801748:	89 d0                	mov    %edx,%eax
+    fd = INDEX2FD(i);
+    if ((uvpd[PDX(fd)] & PTE_P) == 0 || (uvpt[PGNUM(fd)] & PTE_P) == 0) {
+  80174a:	89 c2                	mov    %eax,%edx
+  80174c:	c1 ea 16             	shr    $0x16,%edx
+  80174f:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801756:	f6 c2 01             	test   $0x1,%dl
+  801759:	74 2b                	je     801786 <fd_alloc+0x48>
+  80175b:	89 c2                	mov    %eax,%edx
+  80175d:	c1 ea 0c             	shr    $0xc,%edx
+  801760:	8b 0c 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%ecx
+  801767:	8d 90 00 10 00 00    	lea    0x1000(%eax),%edx
+  80176d:	f6 c1 01             	test   $0x1,%cl
+  801770:	74 14                	je     801786 <fd_alloc+0x48>
+  for (i = 0; i < MAXFD; i++) {
+  801772:	81 fa 00 00 02 d0    	cmp    $0xd0020000,%edx
+  801778:	75 ce                	jne    801748 <fd_alloc+0xa>
+  80177a:	b8 00 00 00 00       	mov    $0x0,%eax
+      *fd_store = fd;
+      return 0;
+    }
+  }
+  *fd_store = 0;
+  return -E_MAX_OPEN;
+  80177f:	b9 f6 ff ff ff       	mov    $0xfffffff6,%ecx
+  801784:	eb 05                	jmp    80178b <fd_alloc+0x4d>
+      return 0;
+  801786:	b9 00 00 00 00       	mov    $0x0,%ecx
+      *fd_store = fd;
+  80178b:	8b 55 08             	mov    0x8(%ebp),%edx
+  80178e:	89 02                	mov    %eax,(%edx)
+}
+  801790:	89 c8                	mov    %ecx,%eax
+  801792:	5d                   	pop    %ebp
+  801793:	c3                   	ret
+
+00801794 <fd_lookup>:
+// Returns 0 on success (the page is in range and mapped), < 0 on error.
+// Errors are:
+//	-E_INVAL: fdnum was either not in range or not mapped.
+int
+fd_lookup(int fdnum, struct Fd **fd_store)
+{
+  801794:	55                   	push   %ebp
+  801795:	89 e5                	mov    %esp,%ebp
+  801797:	8b 45 08             	mov    0x8(%ebp),%eax
+  struct Fd *fd;
+
+  if (fdnum < 0 || fdnum >= MAXFD) {
+  80179a:	83 f8 1f             	cmp    $0x1f,%eax
+  80179d:	77 30                	ja     8017cf <fd_lookup+0x3b>
+    if (debug)
+      cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  fd = INDEX2FD(fdnum);
+  80179f:	c1 e0 0c             	shl    $0xc,%eax
+  8017a2:	2d 00 00 00 30       	sub    $0x30000000,%eax
+  if (!(uvpd[PDX(fd)] & PTE_P) || !(uvpt[PGNUM(fd)] & PTE_P)) {
+  8017a7:	8b 15 00 dd 7b ef    	mov    0xef7bdd00,%edx
+  8017ad:	f6 c2 01             	test   $0x1,%dl
+  8017b0:	74 24                	je     8017d6 <fd_lookup+0x42>
+  8017b2:	89 c2                	mov    %eax,%edx
+  8017b4:	c1 ea 0c             	shr    $0xc,%edx
+  8017b7:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  8017be:	f6 c2 01             	test   $0x1,%dl
+  8017c1:	74 1a                	je     8017dd <fd_lookup+0x49>
+    if (debug)
+      cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  *fd_store = fd;
+  8017c3:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8017c6:	89 02                	mov    %eax,(%edx)
+  return 0;
+  8017c8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017cd:	5d                   	pop    %ebp
+  8017ce:	c3                   	ret
+    return -E_INVAL;
+  8017cf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017d4:	eb f7                	jmp    8017cd <fd_lookup+0x39>
+    return -E_INVAL;
+  8017d6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017db:	eb f0                	jmp    8017cd <fd_lookup+0x39>
+  8017dd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017e2:	eb e9                	jmp    8017cd <fd_lookup+0x39>
+
+008017e4 <dev_lookup>:
+  0
+};
+
+int
+dev_lookup(int dev_id, struct Dev **dev)
+{
+  8017e4:	55                   	push   %ebp
+  8017e5:	89 e5                	mov    %esp,%ebp
+  8017e7:	53                   	push   %ebx
+  8017e8:	83 ec 04             	sub    $0x4,%esp
+  8017eb:	8b 55 08             	mov    0x8(%ebp),%edx
+  int i;
+
+  for (i = 0; devtab[i]; i++)
+  8017ee:	b8 f8 41 80 00       	mov    $0x8041f8,%eax
+  8017f3:	8b 18                	mov    (%eax),%ebx
+  8017f5:	85 db                	test   %ebx,%ebx
+  8017f7:	74 0e                	je     801807 <dev_lookup+0x23>
+    if (devtab[i]->dev_id == dev_id) {
+  8017f9:	83 c0 04             	add    $0x4,%eax
+  8017fc:	39 13                	cmp    %edx,(%ebx)
+  8017fe:	75 f3                	jne    8017f3 <dev_lookup+0xf>
+      *dev = devtab[i];
+      return 0;
+  801800:	b8 00 00 00 00       	mov    $0x0,%eax
+  801805:	eb 1f                	jmp    801826 <dev_lookup+0x42>
+    }
+  cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801807:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  80180c:	8b 40 48             	mov    0x48(%eax),%eax
+  80180f:	83 ec 04             	sub    $0x4,%esp
+  801812:	52                   	push   %edx
+  801813:	50                   	push   %eax
+  801814:	68 7c 41 80 00       	push   $0x80417c
+  801819:	e8 fc eb ff ff       	call   80041a <cprintf>
+  *dev = 0;
+  return -E_INVAL;
+  80181e:	83 c4 10             	add    $0x10,%esp
+  801821:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+      *dev = devtab[i];
+  801826:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801829:	89 1a                	mov    %ebx,(%edx)
+}
+  80182b:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80182e:	c9                   	leave
+  80182f:	c3                   	ret
+
+00801830 <fd_close>:
+{
+  801830:	55                   	push   %ebp
+  801831:	89 e5                	mov    %esp,%ebp
+  801833:	57                   	push   %edi
+  801834:	56                   	push   %esi
+  801835:	53                   	push   %ebx
+  801836:	83 ec 24             	sub    $0x24,%esp
+  801839:	8b 75 08             	mov    0x8(%ebp),%esi
+  80183c:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80183f:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801842:	50                   	push   %eax
+  return ((uintptr_t)fd - FDTABLE) / PGSIZE;
+  801843:	8d 86 00 00 00 30    	lea    0x30000000(%esi),%eax
+  801849:	c1 e8 0c             	shr    $0xc,%eax
+  if ((r = fd_lookup(fd2num(fd), &fd2)) < 0
+  80184c:	50                   	push   %eax
+  80184d:	e8 42 ff ff ff       	call   801794 <fd_lookup>
+  801852:	89 c3                	mov    %eax,%ebx
+  801854:	83 c4 10             	add    $0x10,%esp
+  801857:	85 c0                	test   %eax,%eax
+  801859:	78 05                	js     801860 <fd_close+0x30>
+      || fd != fd2)
+  80185b:	39 75 e4             	cmp    %esi,-0x1c(%ebp)
+  80185e:	74 16                	je     801876 <fd_close+0x46>
+    return must_exist ? r : 0;
+  801860:	89 f8                	mov    %edi,%eax
+  801862:	84 c0                	test   %al,%al
+  801864:	b8 00 00 00 00       	mov    $0x0,%eax
+  801869:	0f 44 d8             	cmove  %eax,%ebx
+}
+  80186c:	89 d8                	mov    %ebx,%eax
+  80186e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801871:	5b                   	pop    %ebx
+  801872:	5e                   	pop    %esi
+  801873:	5f                   	pop    %edi
+  801874:	5d                   	pop    %ebp
+  801875:	c3                   	ret
+  if ((r = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801876:	83 ec 08             	sub    $0x8,%esp
+  801879:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  80187c:	50                   	push   %eax
+  80187d:	ff 36                	push   (%esi)
+  80187f:	e8 60 ff ff ff       	call   8017e4 <dev_lookup>
+  801884:	89 c3                	mov    %eax,%ebx
+  801886:	83 c4 10             	add    $0x10,%esp
+  801889:	85 c0                	test   %eax,%eax
+  80188b:	78 1a                	js     8018a7 <fd_close+0x77>
+    if (dev->dev_close)
+  80188d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  801890:	8b 40 10             	mov    0x10(%eax),%eax
+      r = 0;
+  801893:	bb 00 00 00 00       	mov    $0x0,%ebx
+    if (dev->dev_close)
+  801898:	85 c0                	test   %eax,%eax
+  80189a:	74 0b                	je     8018a7 <fd_close+0x77>
+      r = (*dev->dev_close)(fd);
+  80189c:	83 ec 0c             	sub    $0xc,%esp
+  80189f:	56                   	push   %esi
+  8018a0:	ff d0                	call   *%eax
+  8018a2:	89 c3                	mov    %eax,%ebx
+  8018a4:	83 c4 10             	add    $0x10,%esp
+  (void)sys_page_unmap(0, fd);
+  8018a7:	83 ec 08             	sub    $0x8,%esp
+  8018aa:	56                   	push   %esi
+  8018ab:	6a 00                	push   $0x0
+  8018ad:	e8 0a f6 ff ff       	call   800ebc <sys_page_unmap>
+  return r;
+  8018b2:	83 c4 10             	add    $0x10,%esp
+  8018b5:	eb b5                	jmp    80186c <fd_close+0x3c>
+
+008018b7 <close>:
+
+int
+close(int fdnum)
+{
+  8018b7:	55                   	push   %ebp
+  8018b8:	89 e5                	mov    %esp,%ebp
+  8018ba:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8018bd:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  8018c0:	50                   	push   %eax
+  8018c1:	ff 75 08             	push   0x8(%ebp)
+  8018c4:	e8 cb fe ff ff       	call   801794 <fd_lookup>
+  8018c9:	83 c4 10             	add    $0x10,%esp
+  8018cc:	85 c0                	test   %eax,%eax
+  8018ce:	79 02                	jns    8018d2 <close+0x1b>
+    return r;
+  else
+    return fd_close(fd, 1);
+}
+  8018d0:	c9                   	leave
+  8018d1:	c3                   	ret
+    return fd_close(fd, 1);
+  8018d2:	83 ec 08             	sub    $0x8,%esp
+  8018d5:	6a 01                	push   $0x1
+  8018d7:	ff 75 f4             	push   -0xc(%ebp)
+  8018da:	e8 51 ff ff ff       	call   801830 <fd_close>
+  8018df:	83 c4 10             	add    $0x10,%esp
+  8018e2:	eb ec                	jmp    8018d0 <close+0x19>
+
+008018e4 <close_all>:
+
+void
+close_all(void)
+{
+  8018e4:	55                   	push   %ebp
+  8018e5:	89 e5                	mov    %esp,%ebp
+  8018e7:	53                   	push   %ebx
+  8018e8:	83 ec 04             	sub    $0x4,%esp
+  int i;
+
+  for (i = 0; i < MAXFD; i++)
+  8018eb:	bb 00 00 00 00       	mov    $0x0,%ebx
+    close(i);
+  8018f0:	83 ec 0c             	sub    $0xc,%esp
+  8018f3:	53                   	push   %ebx
+  8018f4:	e8 be ff ff ff       	call   8018b7 <close>
+  for (i = 0; i < MAXFD; i++)
+  8018f9:	83 c3 01             	add    $0x1,%ebx
+  8018fc:	83 c4 10             	add    $0x10,%esp
+  8018ff:	83 fb 20             	cmp    $0x20,%ebx
+  801902:	75 ec                	jne    8018f0 <close_all+0xc>
+}
+  801904:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801907:	c9                   	leave
+  801908:	c3                   	ret
+
+00801909 <dup>:
+// file and the file offset of the other.
+// Closes any previously open file descriptor at 'newfdnum'.
+// This is implemented using virtual memory tricks (of course!).
+int
+dup(int oldfdnum, int newfdnum)
+{
+  801909:	55                   	push   %ebp
+  80190a:	89 e5                	mov    %esp,%ebp
+  80190c:	57                   	push   %edi
+  80190d:	56                   	push   %esi
+  80190e:	53                   	push   %ebx
+  80190f:	83 ec 34             	sub    $0x34,%esp
+  char *ova, *nva;
+  size_t off;
+  pte_t pte;
+  struct Fd *oldfd, *newfd;
+
+  if ((r = fd_lookup(oldfdnum, &oldfd)) < 0)
+  801912:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801915:	50                   	push   %eax
+  801916:	ff 75 08             	push   0x8(%ebp)
+  801919:	e8 76 fe ff ff       	call   801794 <fd_lookup>
+  80191e:	89 c6                	mov    %eax,%esi
+  801920:	83 c4 10             	add    $0x10,%esp
+  801923:	85 c0                	test   %eax,%eax
+  801925:	0f 88 0a 01 00 00    	js     801a35 <dup+0x12c>
+    return r;
+  close(newfdnum);
+  80192b:	83 ec 0c             	sub    $0xc,%esp
+  80192e:	ff 75 0c             	push   0xc(%ebp)
+  801931:	e8 81 ff ff ff       	call   8018b7 <close>
+
+  newfd = INDEX2FD(newfdnum);
+  801936:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801939:	c1 e0 0c             	shl    $0xc,%eax
+  80193c:	8d b8 00 00 00 d0    	lea    -0x30000000(%eax),%edi
+  801942:	89 7d d4             	mov    %edi,-0x2c(%ebp)
+  ova = fd2data(oldfd);
+  801945:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  801948:	89 45 cc             	mov    %eax,-0x34(%ebp)
+  80194b:	89 04 24             	mov    %eax,(%esp)
+  80194e:	e8 d7 fd ff ff       	call   80172a <fd2data>
+  801953:	89 c6                	mov    %eax,%esi
+  nva = fd2data(newfd);
+  801955:	89 3c 24             	mov    %edi,(%esp)
+  801958:	e8 cd fd ff ff       	call   80172a <fd2data>
+  80195d:	83 c4 10             	add    $0x10,%esp
+  801960:	89 45 c8             	mov    %eax,-0x38(%ebp)
+
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  801963:	89 f3                	mov    %esi,%ebx
+  801965:	8d 8e 00 00 01 00    	lea    0x10000(%esi),%ecx
+  80196b:	89 c6                	mov    %eax,%esi
+  80196d:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  801970:	89 cf                	mov    %ecx,%edi
+  801972:	eb 0c                	jmp    801980 <dup+0x77>
+  801974:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80197a:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  801980:	39 fb                	cmp    %edi,%ebx
+  801982:	74 7b                	je     8019ff <dup+0xf6>
+    if ((uvpd[PDX(ova + off)] & PTE_P) && (uvpt[PGNUM(ova + off)] & PTE_P))
+  801984:	89 d8                	mov    %ebx,%eax
+  801986:	c1 e8 16             	shr    $0x16,%eax
+  801989:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  801990:	a8 01                	test   $0x1,%al
+  801992:	74 e0                	je     801974 <dup+0x6b>
+  801994:	89 d8                	mov    %ebx,%eax
+  801996:	c1 e8 0c             	shr    $0xc,%eax
+  801999:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  8019a0:	f6 c2 01             	test   $0x1,%dl
+  8019a3:	74 cf                	je     801974 <dup+0x6b>
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+                            uvpt[PGNUM(ova + off)] & PTE_SYSCALL)) < 0)
+  8019a5:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+      if ((r = sys_page_map(0, ova + off, 0, nva + off,
+  8019ac:	83 ec 0c             	sub    $0xc,%esp
+  8019af:	25 07 0e 00 00       	and    $0xe07,%eax
+  8019b4:	50                   	push   %eax
+  8019b5:	56                   	push   %esi
+  8019b6:	6a 00                	push   $0x0
+  8019b8:	53                   	push   %ebx
+  8019b9:	6a 00                	push   $0x0
+  8019bb:	e8 ba f4 ff ff       	call   800e7a <sys_page_map>
+  8019c0:	83 c4 20             	add    $0x20,%esp
+  8019c3:	85 c0                	test   %eax,%eax
+  8019c5:	79 ad                	jns    801974 <dup+0x6b>
+  8019c7:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  8019ca:	89 c6                	mov    %eax,%esi
+    goto err;
+
+  return newfdnum;
+
+err:
+  sys_page_unmap(0, newfd);
+  8019cc:	83 ec 08             	sub    $0x8,%esp
+  8019cf:	ff 75 d4             	push   -0x2c(%ebp)
+  8019d2:	6a 00                	push   $0x0
+  8019d4:	e8 e3 f4 ff ff       	call   800ebc <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8019d9:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  8019dc:	81 c3 00 00 01 00    	add    $0x10000,%ebx
+  8019e2:	83 c4 10             	add    $0x10,%esp
+  8019e5:	39 df                	cmp    %ebx,%edi
+  8019e7:	74 4c                	je     801a35 <dup+0x12c>
+    sys_page_unmap(0, nva + off);
+  8019e9:	83 ec 08             	sub    $0x8,%esp
+  8019ec:	57                   	push   %edi
+  8019ed:	6a 00                	push   $0x0
+  8019ef:	e8 c8 f4 ff ff       	call   800ebc <sys_page_unmap>
+  for (off = 0; off < FDDATASIZE; off += PGSIZE)
+  8019f4:	81 c7 00 10 00 00    	add    $0x1000,%edi
+  8019fa:	83 c4 10             	add    $0x10,%esp
+  8019fd:	eb e6                	jmp    8019e5 <dup+0xdc>
+  if ((r = sys_page_map(0, oldfd, 0, newfd, uvpt[PGNUM(oldfd)] & PTE_SYSCALL)) < 0)
+  8019ff:	8b 7d d0             	mov    -0x30(%ebp),%edi
+  801a02:	8b 4d cc             	mov    -0x34(%ebp),%ecx
+  801a05:	89 c8                	mov    %ecx,%eax
+  801a07:	c1 e8 0c             	shr    $0xc,%eax
+  801a0a:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  801a11:	83 ec 0c             	sub    $0xc,%esp
+  801a14:	25 07 0e 00 00       	and    $0xe07,%eax
+  801a19:	50                   	push   %eax
+  801a1a:	ff 75 d4             	push   -0x2c(%ebp)
+  801a1d:	6a 00                	push   $0x0
+  801a1f:	51                   	push   %ecx
+  801a20:	6a 00                	push   $0x0
+  801a22:	e8 53 f4 ff ff       	call   800e7a <sys_page_map>
+  801a27:	89 c6                	mov    %eax,%esi
+  801a29:	83 c4 20             	add    $0x20,%esp
+  801a2c:	85 c0                	test   %eax,%eax
+  801a2e:	78 9c                	js     8019cc <dup+0xc3>
+  return newfdnum;
+  801a30:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801a33:	89 c6                	mov    %eax,%esi
+  return r;
+}
+  801a35:	89 f0                	mov    %esi,%eax
+  801a37:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801a3a:	5b                   	pop    %ebx
+  801a3b:	5e                   	pop    %esi
+  801a3c:	5f                   	pop    %edi
+  801a3d:	5d                   	pop    %ebp
+  801a3e:	c3                   	ret
+
+00801a3f <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n)
+{
+  801a3f:	55                   	push   %ebp
+  801a40:	89 e5                	mov    %esp,%ebp
+  801a42:	56                   	push   %esi
+  801a43:	53                   	push   %ebx
+  801a44:	83 ec 18             	sub    $0x18,%esp
+  801a47:	8b 75 08             	mov    0x8(%ebp),%esi
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801a4a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801a4d:	50                   	push   %eax
+  801a4e:	56                   	push   %esi
+  801a4f:	e8 40 fd ff ff       	call   801794 <fd_lookup>
+  801a54:	83 c4 10             	add    $0x10,%esp
+  801a57:	85 c0                	test   %eax,%eax
+  801a59:	78 3c                	js     801a97 <read+0x58>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801a5b:	8b 5d f0             	mov    -0x10(%ebp),%ebx
+  801a5e:	83 ec 08             	sub    $0x8,%esp
+  801a61:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801a64:	50                   	push   %eax
+  801a65:	ff 33                	push   (%ebx)
+  801a67:	e8 78 fd ff ff       	call   8017e4 <dev_lookup>
+  801a6c:	83 c4 10             	add    $0x10,%esp
+  801a6f:	85 c0                	test   %eax,%eax
+  801a71:	78 24                	js     801a97 <read+0x58>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801a73:	8b 43 08             	mov    0x8(%ebx),%eax
+  801a76:	83 e0 03             	and    $0x3,%eax
+  801a79:	83 f8 01             	cmp    $0x1,%eax
+  801a7c:	74 20                	je     801a9e <read+0x5f>
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_read)
+  801a7e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801a81:	8b 40 08             	mov    0x8(%eax),%eax
+  801a84:	85 c0                	test   %eax,%eax
+  801a86:	74 37                	je     801abf <read+0x80>
+    return -E_NOT_SUPP;
+  return (*dev->dev_read)(fd, buf, n);
+  801a88:	83 ec 04             	sub    $0x4,%esp
+  801a8b:	ff 75 10             	push   0x10(%ebp)
+  801a8e:	ff 75 0c             	push   0xc(%ebp)
+  801a91:	53                   	push   %ebx
+  801a92:	ff d0                	call   *%eax
+  801a94:	83 c4 10             	add    $0x10,%esp
+}
+  801a97:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801a9a:	5b                   	pop    %ebx
+  801a9b:	5e                   	pop    %esi
+  801a9c:	5d                   	pop    %ebp
+  801a9d:	c3                   	ret
+    cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801a9e:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  801aa3:	8b 40 48             	mov    0x48(%eax),%eax
+  801aa6:	83 ec 04             	sub    $0x4,%esp
+  801aa9:	56                   	push   %esi
+  801aaa:	50                   	push   %eax
+  801aab:	68 bd 41 80 00       	push   $0x8041bd
+  801ab0:	e8 65 e9 ff ff       	call   80041a <cprintf>
+    return -E_INVAL;
+  801ab5:	83 c4 10             	add    $0x10,%esp
+  801ab8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801abd:	eb d8                	jmp    801a97 <read+0x58>
+    return -E_NOT_SUPP;
+  801abf:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801ac4:	eb d1                	jmp    801a97 <read+0x58>
+
+00801ac6 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n)
+{
+  801ac6:	55                   	push   %ebp
+  801ac7:	89 e5                	mov    %esp,%ebp
+  801ac9:	57                   	push   %edi
+  801aca:	56                   	push   %esi
+  801acb:	53                   	push   %ebx
+  801acc:	83 ec 0c             	sub    $0xc,%esp
+  801acf:	8b 7d 08             	mov    0x8(%ebp),%edi
+  801ad2:	8b 75 10             	mov    0x10(%ebp),%esi
+  int m, tot;
+
+  for (tot = 0; tot < n; tot += m) {
+  801ad5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ada:	eb 02                	jmp    801ade <readn+0x18>
+  801adc:	01 c3                	add    %eax,%ebx
+  801ade:	39 f3                	cmp    %esi,%ebx
+  801ae0:	73 21                	jae    801b03 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  801ae2:	83 ec 04             	sub    $0x4,%esp
+  801ae5:	89 f0                	mov    %esi,%eax
+  801ae7:	29 d8                	sub    %ebx,%eax
+  801ae9:	50                   	push   %eax
+  801aea:	89 d8                	mov    %ebx,%eax
+  801aec:	03 45 0c             	add    0xc(%ebp),%eax
+  801aef:	50                   	push   %eax
+  801af0:	57                   	push   %edi
+  801af1:	e8 49 ff ff ff       	call   801a3f <read>
+    if (m < 0)
+  801af6:	83 c4 10             	add    $0x10,%esp
+  801af9:	85 c0                	test   %eax,%eax
+  801afb:	78 04                	js     801b01 <readn+0x3b>
+      return m;
+    if (m == 0)
+  801afd:	75 dd                	jne    801adc <readn+0x16>
+  801aff:	eb 02                	jmp    801b03 <readn+0x3d>
+    m = read(fdnum, (char*)buf + tot, n - tot);
+  801b01:	89 c3                	mov    %eax,%ebx
+      break;
+  }
+  return tot;
+}
+  801b03:	89 d8                	mov    %ebx,%eax
+  801b05:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801b08:	5b                   	pop    %ebx
+  801b09:	5e                   	pop    %esi
+  801b0a:	5f                   	pop    %edi
+  801b0b:	5d                   	pop    %ebp
+  801b0c:	c3                   	ret
+
+00801b0d <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n)
+{
+  801b0d:	55                   	push   %ebp
+  801b0e:	89 e5                	mov    %esp,%ebp
+  801b10:	56                   	push   %esi
+  801b11:	53                   	push   %ebx
+  801b12:	83 ec 18             	sub    $0x18,%esp
+  801b15:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801b18:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801b1b:	50                   	push   %eax
+  801b1c:	53                   	push   %ebx
+  801b1d:	e8 72 fc ff ff       	call   801794 <fd_lookup>
+  801b22:	83 c4 10             	add    $0x10,%esp
+  801b25:	85 c0                	test   %eax,%eax
+  801b27:	78 37                	js     801b60 <write+0x53>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801b29:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801b2c:	83 ec 08             	sub    $0x8,%esp
+  801b2f:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b32:	50                   	push   %eax
+  801b33:	ff 36                	push   (%esi)
+  801b35:	e8 aa fc ff ff       	call   8017e4 <dev_lookup>
+  801b3a:	83 c4 10             	add    $0x10,%esp
+  801b3d:	85 c0                	test   %eax,%eax
+  801b3f:	78 1f                	js     801b60 <write+0x53>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801b41:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801b45:	74 20                	je     801b67 <write+0x5a>
+    return -E_INVAL;
+  }
+  if (debug)
+    cprintf("write %d %p %d via dev %s\n",
+            fdnum, buf, n, dev->dev_name);
+  if (!dev->dev_write)
+  801b47:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801b4a:	8b 40 0c             	mov    0xc(%eax),%eax
+  801b4d:	85 c0                	test   %eax,%eax
+  801b4f:	74 37                	je     801b88 <write+0x7b>
+    return -E_NOT_SUPP;
+  return (*dev->dev_write)(fd, buf, n);
+  801b51:	83 ec 04             	sub    $0x4,%esp
+  801b54:	ff 75 10             	push   0x10(%ebp)
+  801b57:	ff 75 0c             	push   0xc(%ebp)
+  801b5a:	56                   	push   %esi
+  801b5b:	ff d0                	call   *%eax
+  801b5d:	83 c4 10             	add    $0x10,%esp
+}
+  801b60:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801b63:	5b                   	pop    %ebx
+  801b64:	5e                   	pop    %esi
+  801b65:	5d                   	pop    %ebp
+  801b66:	c3                   	ret
+    cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b67:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  801b6c:	8b 40 48             	mov    0x48(%eax),%eax
+  801b6f:	83 ec 04             	sub    $0x4,%esp
+  801b72:	53                   	push   %ebx
+  801b73:	50                   	push   %eax
+  801b74:	68 d9 41 80 00       	push   $0x8041d9
+  801b79:	e8 9c e8 ff ff       	call   80041a <cprintf>
+    return -E_INVAL;
+  801b7e:	83 c4 10             	add    $0x10,%esp
+  801b81:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b86:	eb d8                	jmp    801b60 <write+0x53>
+    return -E_NOT_SUPP;
+  801b88:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801b8d:	eb d1                	jmp    801b60 <write+0x53>
+
+00801b8f <seek>:
+
+int
+seek(int fdnum, off_t offset)
+{
+  801b8f:	55                   	push   %ebp
+  801b90:	89 e5                	mov    %esp,%ebp
+  801b92:	83 ec 20             	sub    $0x20,%esp
+  int r;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  801b95:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801b98:	50                   	push   %eax
+  801b99:	ff 75 08             	push   0x8(%ebp)
+  801b9c:	e8 f3 fb ff ff       	call   801794 <fd_lookup>
+  801ba1:	83 c4 10             	add    $0x10,%esp
+  801ba4:	85 c0                	test   %eax,%eax
+  801ba6:	78 0e                	js     801bb6 <seek+0x27>
+    return r;
+  fd->fd_offset = offset;
+  801ba8:	8b 55 0c             	mov    0xc(%ebp),%edx
+  801bab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bae:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+  801bb1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801bb6:	c9                   	leave
+  801bb7:	c3                   	ret
+
+00801bb8 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize)
+{
+  801bb8:	55                   	push   %ebp
+  801bb9:	89 e5                	mov    %esp,%ebp
+  801bbb:	56                   	push   %esi
+  801bbc:	53                   	push   %ebx
+  801bbd:	83 ec 18             	sub    $0x18,%esp
+  801bc0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801bc3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801bc6:	50                   	push   %eax
+  801bc7:	53                   	push   %ebx
+  801bc8:	e8 c7 fb ff ff       	call   801794 <fd_lookup>
+  801bcd:	83 c4 10             	add    $0x10,%esp
+  801bd0:	85 c0                	test   %eax,%eax
+  801bd2:	78 34                	js     801c08 <ftruncate+0x50>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801bd4:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801bd7:	83 ec 08             	sub    $0x8,%esp
+  801bda:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801bdd:	50                   	push   %eax
+  801bde:	ff 36                	push   (%esi)
+  801be0:	e8 ff fb ff ff       	call   8017e4 <dev_lookup>
+  801be5:	83 c4 10             	add    $0x10,%esp
+  801be8:	85 c0                	test   %eax,%eax
+  801bea:	78 1c                	js     801c08 <ftruncate+0x50>
+    return r;
+  if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801bec:	f6 46 08 03          	testb  $0x3,0x8(%esi)
+  801bf0:	74 1d                	je     801c0f <ftruncate+0x57>
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+            thisenv->env_id, fdnum);
+    return -E_INVAL;
+  }
+  if (!dev->dev_trunc)
+  801bf2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801bf5:	8b 40 18             	mov    0x18(%eax),%eax
+  801bf8:	85 c0                	test   %eax,%eax
+  801bfa:	74 34                	je     801c30 <ftruncate+0x78>
+    return -E_NOT_SUPP;
+  return (*dev->dev_trunc)(fd, newsize);
+  801bfc:	83 ec 08             	sub    $0x8,%esp
+  801bff:	ff 75 0c             	push   0xc(%ebp)
+  801c02:	56                   	push   %esi
+  801c03:	ff d0                	call   *%eax
+  801c05:	83 c4 10             	add    $0x10,%esp
+}
+  801c08:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801c0b:	5b                   	pop    %ebx
+  801c0c:	5e                   	pop    %esi
+  801c0d:	5d                   	pop    %ebp
+  801c0e:	c3                   	ret
+            thisenv->env_id, fdnum);
+  801c0f:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  801c14:	8b 40 48             	mov    0x48(%eax),%eax
+    cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801c17:	83 ec 04             	sub    $0x4,%esp
+  801c1a:	53                   	push   %ebx
+  801c1b:	50                   	push   %eax
+  801c1c:	68 9c 41 80 00       	push   $0x80419c
+  801c21:	e8 f4 e7 ff ff       	call   80041a <cprintf>
+    return -E_INVAL;
+  801c26:	83 c4 10             	add    $0x10,%esp
+  801c29:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c2e:	eb d8                	jmp    801c08 <ftruncate+0x50>
+    return -E_NOT_SUPP;
+  801c30:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801c35:	eb d1                	jmp    801c08 <ftruncate+0x50>
+
+00801c37 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat)
+{
+  801c37:	55                   	push   %ebp
+  801c38:	89 e5                	mov    %esp,%ebp
+  801c3a:	56                   	push   %esi
+  801c3b:	53                   	push   %ebx
+  801c3c:	83 ec 18             	sub    $0x18,%esp
+  801c3f:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  int r;
+  struct Dev *dev;
+  struct Fd *fd;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0
+  801c42:	8d 45 f0             	lea    -0x10(%ebp),%eax
+  801c45:	50                   	push   %eax
+  801c46:	ff 75 08             	push   0x8(%ebp)
+  801c49:	e8 46 fb ff ff       	call   801794 <fd_lookup>
+  801c4e:	83 c4 10             	add    $0x10,%esp
+  801c51:	85 c0                	test   %eax,%eax
+  801c53:	78 49                	js     801c9e <fstat+0x67>
+      || (r = dev_lookup(fd->fd_dev_id, &dev)) < 0)
+  801c55:	8b 75 f0             	mov    -0x10(%ebp),%esi
+  801c58:	83 ec 08             	sub    $0x8,%esp
+  801c5b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801c5e:	50                   	push   %eax
+  801c5f:	ff 36                	push   (%esi)
+  801c61:	e8 7e fb ff ff       	call   8017e4 <dev_lookup>
+  801c66:	83 c4 10             	add    $0x10,%esp
+  801c69:	85 c0                	test   %eax,%eax
+  801c6b:	78 31                	js     801c9e <fstat+0x67>
+    return r;
+  if (!dev->dev_stat)
+  801c6d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  801c70:	83 78 14 00          	cmpl   $0x0,0x14(%eax)
+  801c74:	74 2f                	je     801ca5 <fstat+0x6e>
+    return -E_NOT_SUPP;
+  stat->st_name[0] = 0;
+  801c76:	c6 03 00             	movb   $0x0,(%ebx)
+  stat->st_size = 0;
+  801c79:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%ebx)
+  801c80:	00 00 00 
+  stat->st_isdir = 0;
+  801c83:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  801c8a:	00 00 00 
+  stat->st_dev = dev;
+  801c8d:	89 83 88 00 00 00    	mov    %eax,0x88(%ebx)
+  return (*dev->dev_stat)(fd, stat);
+  801c93:	83 ec 08             	sub    $0x8,%esp
+  801c96:	53                   	push   %ebx
+  801c97:	56                   	push   %esi
+  801c98:	ff 50 14             	call   *0x14(%eax)
+  801c9b:	83 c4 10             	add    $0x10,%esp
+}
+  801c9e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801ca1:	5b                   	pop    %ebx
+  801ca2:	5e                   	pop    %esi
+  801ca3:	5d                   	pop    %ebp
+  801ca4:	c3                   	ret
+    return -E_NOT_SUPP;
+  801ca5:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  801caa:	eb f2                	jmp    801c9e <fstat+0x67>
+
+00801cac <stat>:
+
+// Paths name files, so this is file_stat, in one round trip.
+int
+stat(const char *path, struct Stat *stat)
+{
+  801cac:	55                   	push   %ebp
+  801cad:	89 e5                	mov    %esp,%ebp
+  801caf:	83 ec 10             	sub    $0x10,%esp
+  return file_stat(path, stat);
+  801cb2:	ff 75 0c             	push   0xc(%ebp)
+  801cb5:	ff 75 08             	push   0x8(%ebp)
+  801cb8:	e8 58 07 00 00       	call   802415 <file_stat>
+}
+  801cbd:	c9                   	leave
+  801cbe:	c3                   	ret
+
+00801cbf <fsipc_send>:
+// Send a request to whichever file server worker is waiting for one,
+// trying ours first: each environment prefers a different worker, so
+// clients spread out even when the workers are all idle.
+static void
+fsipc_send(unsigned type, void *req, size_t nsend)
+{
+  801cbf:	55                   	push   %ebp
+  801cc0:	89 e5                	mov    %esp,%ebp
+  801cc2:	57                   	push   %edi
+  801cc3:	56                   	push   %esi
+  801cc4:	53                   	push   %ebx
+  801cc5:	83 ec 1c             	sub    $0x1c,%esp
+  801cc8:	89 c7                	mov    %eax,%edi
+  801cca:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  801ccd:	89 4d e0             	mov    %ecx,-0x20(%ebp)
+  801cd0:	e9 a2 00 00 00       	jmp    801d77 <fsipc_send+0xb8>
+  nfsenvs = 0;
+  801cd5:	c7 05 00 60 80 00 00 	movl   $0x0,0x806000
+  801cdc:	00 00 00 
+  801cdf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ce4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801ce9:	b8 00 00 00 00       	mov    $0x0,%eax
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801cee:	be 01 00 00 00       	mov    $0x1,%esi
+  801cf3:	eb 0f                	jmp    801d04 <fsipc_send+0x45>
+  for (i = 0; i < NENV && nfsenvs < FS_MAXWORKERS; i++)
+  801cf5:	83 c0 01             	add    $0x1,%eax
+  801cf8:	3d 00 04 00 00       	cmp    $0x400,%eax
+  801cfd:	74 49                	je     801d48 <fsipc_send+0x89>
+  801cff:	83 f9 07             	cmp    $0x7,%ecx
+  801d02:	7f 50                	jg     801d54 <fsipc_send+0x95>
+    if (envs[i].env_type == ENV_TYPE_FS && envs[i].env_status != ENV_FREE)
+  801d04:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801d07:	c1 e2 04             	shl    $0x4,%edx
+  801d0a:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801d10:	8b 52 50             	mov    0x50(%edx),%edx
+  801d13:	83 fa 01             	cmp    $0x1,%edx
+  801d16:	75 dd                	jne    801cf5 <fsipc_send+0x36>
+  801d18:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801d1b:	c1 e2 04             	shl    $0x4,%edx
+  801d1e:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801d24:	8b 52 54             	mov    0x54(%edx),%edx
+  801d27:	85 d2                	test   %edx,%edx
+  801d29:	74 ca                	je     801cf5 <fsipc_send+0x36>
+      fsenvs[nfsenvs++] = envs[i].env_id;
+  801d2b:	8d 14 c0             	lea    (%eax,%eax,8),%edx
+  801d2e:	c1 e2 04             	shl    $0x4,%edx
+  801d31:	81 c2 00 00 c0 ee    	add    $0xeec00000,%edx
+  801d37:	8b 52 48             	mov    0x48(%edx),%edx
+  801d3a:	89 14 8d 20 60 80 00 	mov    %edx,0x806020(,%ecx,4)
+  801d41:	8d 49 01             	lea    0x1(%ecx),%ecx
+  801d44:	89 f3                	mov    %esi,%ebx
+  801d46:	eb ad                	jmp    801cf5 <fsipc_send+0x36>
+  801d48:	84 db                	test   %bl,%bl
+  801d4a:	74 38                	je     801d84 <fsipc_send+0xc5>
+  801d4c:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+  801d52:	eb 30                	jmp    801d84 <fsipc_send+0xc5>
+  801d54:	84 db                	test   %bl,%bl
+  801d56:	74 2c                	je     801d84 <fsipc_send+0xc5>
+  801d58:	89 0d 00 60 80 00    	mov    %ecx,0x806000
+  801d5e:	eb 24                	jmp    801d84 <fsipc_send+0xc5>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+                           PTE_P | PTE_W | PTE_U, nsend);
+      if (r == 0)
+        return;
+      if (r != -E_IPC_NOT_RECV)
+        panic("fsipc: %e", r);
+  801d60:	50                   	push   %eax
+  801d61:	68 08 42 80 00       	push   $0x804208
+  801d66:	6a 34                	push   $0x34
+  801d68:	68 12 42 80 00       	push   $0x804212
+  801d6d:	e8 cd e5 ff ff       	call   80033f <_panic>
+    }
+    sys_yield();
+  801d72:	e8 5e f0 ff ff       	call   800dd5 <sys_yield>
+    if (nfsenvs < FS_NWORKERS)
+  801d77:	83 3d 00 60 80 00 03 	cmpl   $0x3,0x806000
+  801d7e:	0f 8e 51 ff ff ff    	jle    801cd5 <fsipc_send+0x16>
+    first = ENVX(thisenv->env_id);
+  801d84:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  801d89:	8b 70 48             	mov    0x48(%eax),%esi
+  801d8c:	81 e6 ff 03 00 00    	and    $0x3ff,%esi
+    for (i = 0; i < nfsenvs; i++) {
+  801d92:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d97:	8b 0d 00 60 80 00    	mov    0x806000,%ecx
+  801d9d:	39 d9                	cmp    %ebx,%ecx
+  801d9f:	7e d1                	jle    801d72 <fsipc_send+0xb3>
+      r = sys_ipc_try_send(fsenvs[(first + i) % nfsenvs], type, req,
+  801da1:	83 ec 0c             	sub    $0xc,%esp
+  801da4:	ff 75 e0             	push   -0x20(%ebp)
+  801da7:	6a 07                	push   $0x7
+  801da9:	ff 75 e4             	push   -0x1c(%ebp)
+  801dac:	57                   	push   %edi
+  801dad:	8d 04 1e             	lea    (%esi,%ebx,1),%eax
+  801db0:	99                   	cltd
+  801db1:	f7 f9                	idiv   %ecx
+  801db3:	ff 34 95 20 60 80 00 	push   0x806020(,%edx,4)
+  801dba:	e8 2f f3 ff ff       	call   8010ee <sys_ipc_try_send>
+      if (r == 0)
+  801dbf:	83 c4 20             	add    $0x20,%esp
+  801dc2:	85 c0                	test   %eax,%eax
+  801dc4:	74 0a                	je     801dd0 <fsipc_send+0x111>
+      if (r != -E_IPC_NOT_RECV)
+  801dc6:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  801dc9:	75 95                	jne    801d60 <fsipc_send+0xa1>
+    for (i = 0; i < nfsenvs; i++) {
+  801dcb:	83 c3 01             	add    $0x1,%ebx
+  801dce:	eb c7                	jmp    801d97 <fsipc_send+0xd8>
+  }
+}
+  801dd0:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801dd3:	5b                   	pop    %ebx
+  801dd4:	5e                   	pop    %esi
+  801dd5:	5f                   	pop    %edi
+  801dd6:	5d                   	pop    %ebp
+  801dd7:	c3                   	ret
+
+00801dd8 <fsipc>:
+// type: request code, passed as the simple integer IPC value.
+// dstva: virtual address at which to receive reply page, 0 if none.
+// Returns result from the file server.
+static int
+fsipc(unsigned type, void *dstva)
+{
+  801dd8:	55                   	push   %ebp
+  801dd9:	89 e5                	mov    %esp,%ebp
+  801ddb:	53                   	push   %ebx
+  801ddc:	83 ec 14             	sub    $0x14,%esp
+  801ddf:	89 d3                	mov    %edx,%ebx
+  size_t npages = 1;
+  801de1:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  fsipc_send(type, req, nsend);
+  801de8:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801ded:	ba 00 70 80 00       	mov    $0x807000,%edx
+  801df2:	e8 c8 fe ff ff       	call   801cbf <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801df7:	6a 00                	push   $0x0
+  801df9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  801dfc:	50                   	push   %eax
+  801dfd:	53                   	push   %ebx
+  801dfe:	6a 00                	push   $0x0
+  801e00:	e8 f8 19 00 00       	call   8037fd <ipc_recv_pages>
+
+  static_assert(sizeof(fsipcbuf) == PGSIZE);
+  return fsipc_pages(type, &fsipcbuf, 1, dstva, &npages);
+}
+  801e05:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801e08:	c9                   	leave
+  801e09:	c3                   	ret
+
+00801e0a <devfile_trunc>:
+}
+
+// Truncate or extend an open file to 'size' bytes
+static int
+devfile_trunc(struct Fd *fd, off_t newsize)
+{
+  801e0a:	55                   	push   %ebp
+  801e0b:	89 e5                	mov    %esp,%ebp
+  801e0d:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801e10:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e13:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e16:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.set_size.req_size = newsize;
+  801e1b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  801e1e:	a3 04 70 80 00       	mov    %eax,0x807004
+  return fsipc(FSREQ_SET_SIZE, NULL);
+  801e23:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e28:	b8 02 00 00 00       	mov    $0x2,%eax
+  801e2d:	e8 a6 ff ff ff       	call   801dd8 <fsipc>
+}
+  801e32:	c9                   	leave
+  801e33:	c3                   	ret
+
+00801e34 <devfile_flush>:
+{
+  801e34:	55                   	push   %ebp
+  801e35:	89 e5                	mov    %esp,%ebp
+  801e37:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801e3a:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e3d:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e40:	a3 00 70 80 00       	mov    %eax,0x807000
+  return fsipc(FSREQ_FLUSH, NULL);
+  801e45:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e4a:	b8 06 00 00 00       	mov    $0x6,%eax
+  801e4f:	e8 84 ff ff ff       	call   801dd8 <fsipc>
+}
+  801e54:	c9                   	leave
+  801e55:	c3                   	ret
+
+00801e56 <devfile_stat>:
+{
+  801e56:	55                   	push   %ebp
+  801e57:	89 e5                	mov    %esp,%ebp
+  801e59:	53                   	push   %ebx
+  801e5a:	83 ec 04             	sub    $0x4,%esp
+  801e5d:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  801e60:	8b 45 08             	mov    0x8(%ebp),%eax
+  801e63:	8b 40 0c             	mov    0xc(%eax),%eax
+  801e66:	a3 00 70 80 00       	mov    %eax,0x807000
+  if ((r = fsipc(FSREQ_STAT, NULL)) < 0)
+  801e6b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e70:	b8 05 00 00 00       	mov    $0x5,%eax
+  801e75:	e8 5e ff ff ff       	call   801dd8 <fsipc>
+  801e7a:	85 c0                	test   %eax,%eax
+  801e7c:	78 2c                	js     801eaa <devfile_stat+0x54>
+  strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  801e7e:	83 ec 08             	sub    $0x8,%esp
+  801e81:	68 00 70 80 00       	push   $0x807000
+  801e86:	53                   	push   %ebx
+  801e87:	e8 7c eb ff ff       	call   800a08 <strcpy>
+  st->st_size = fsipcbuf.statRet.ret_size;
+  801e8c:	a1 80 70 80 00       	mov    0x807080,%eax
+  801e91:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  801e97:	a1 84 70 80 00       	mov    0x807084,%eax
+  801e9c:	89 83 84 00 00 00    	mov    %eax,0x84(%ebx)
+  return 0;
+  801ea2:	83 c4 10             	add    $0x10,%esp
+  801ea5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801eaa:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  801ead:	c9                   	leave
+  801eae:	c3                   	ret
+
+00801eaf <fsv_alloc>:
+{
+  801eaf:	55                   	push   %ebp
+  801eb0:	89 e5                	mov    %esp,%ebp
+  801eb2:	56                   	push   %esi
+  801eb3:	53                   	push   %ebx
+  801eb4:	89 c6                	mov    %eax,%esi
+  for (i = 0; i < npages; i++) {
+  801eb6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ebb:	eb 22                	jmp    801edf <fsv_alloc+0x30>
+    if ((r = sysbatch_add(&fsv_batch, SYS_page_alloc, 0, va,
+  801ebd:	83 ec 04             	sub    $0x4,%esp
+  801ec0:	6a 00                	push   $0x0
+  801ec2:	6a 00                	push   $0x0
+  801ec4:	6a 07                	push   $0x7
+  801ec6:	50                   	push   %eax
+  801ec7:	6a 00                	push   $0x0
+  801ec9:	6a 04                	push   $0x4
+  801ecb:	68 40 60 80 00       	push   $0x806040
+  801ed0:	e8 b5 f3 ff ff       	call   80128a <sysbatch_add>
+  801ed5:	83 c4 20             	add    $0x20,%esp
+  801ed8:	85 c0                	test   %eax,%eax
+  801eda:	78 48                	js     801f24 <fsv_alloc+0x75>
+  for (i = 0; i < npages; i++) {
+  801edc:	83 c3 01             	add    $0x1,%ebx
+  801edf:	39 f3                	cmp    %esi,%ebx
+  801ee1:	74 31                	je     801f14 <fsv_alloc+0x65>
+    va = FSVBUF + i * PGSIZE;
+  801ee3:	89 d8                	mov    %ebx,%eax
+  801ee5:	c1 e0 0c             	shl    $0xc,%eax
+  801ee8:	2d 00 00 40 60       	sub    $0x60400000,%eax
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801eed:	89 c2                	mov    %eax,%edx
+  801eef:	c1 ea 16             	shr    $0x16,%edx
+  801ef2:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  801ef9:	f6 c2 01             	test   $0x1,%dl
+  801efc:	74 bf                	je     801ebd <fsv_alloc+0xe>
+        (uvpt[PGNUM(va)] & (PTE_P | PTE_W)) == (PTE_P | PTE_W))
+  801efe:	89 c2                	mov    %eax,%edx
+  801f00:	c1 ea 0c             	shr    $0xc,%edx
+  801f03:	8b 14 95 00 00 40 ef 	mov    -0x10c00000(,%edx,4),%edx
+  801f0a:	83 e2 03             	and    $0x3,%edx
+    if ((uvpd[PDX(va)] & PTE_P) &&
+  801f0d:	83 fa 03             	cmp    $0x3,%edx
+  801f10:	75 ab                	jne    801ebd <fsv_alloc+0xe>
+  801f12:	eb c8                	jmp    801edc <fsv_alloc+0x2d>
+  return sysbatch_flush(&fsv_batch);
+  801f14:	83 ec 0c             	sub    $0xc,%esp
+  801f17:	68 40 60 80 00       	push   $0x806040
+  801f1c:	e8 19 f3 ff ff       	call   80123a <sysbatch_flush>
+  801f21:	83 c4 10             	add    $0x10,%esp
+}
+  801f24:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  801f27:	5b                   	pop    %ebx
+  801f28:	5e                   	pop    %esi
+  801f29:	5d                   	pop    %ebp
+  801f2a:	c3                   	ret
+
+00801f2b <devfile_read>:
+{
+  801f2b:	55                   	push   %ebp
+  801f2c:	89 e5                	mov    %esp,%ebp
+  801f2e:	57                   	push   %edi
+  801f2f:	56                   	push   %esi
+  801f30:	53                   	push   %ebx
+  801f31:	83 ec 3c             	sub    $0x3c,%esp
+  801f34:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  if (n >= PGSIZE)
+  801f37:	81 fb ff 0f 00 00    	cmp    $0xfff,%ebx
+  801f3d:	77 57                	ja     801f96 <devfile_read+0x6b>
+  fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801f3f:	8b 45 08             	mov    0x8(%ebp),%eax
+  801f42:	8b 40 0c             	mov    0xc(%eax),%eax
+  801f45:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.read.req_n = n;
+  801f4a:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+  if ((r = fsipc(FSREQ_READ, NULL)) < 0)
+  801f50:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f55:	b8 03 00 00 00       	mov    $0x3,%eax
+  801f5a:	e8 79 fe ff ff       	call   801dd8 <fsipc>
+  801f5f:	89 c6                	mov    %eax,%esi
+  801f61:	85 c0                	test   %eax,%eax
+  801f63:	78 27                	js     801f8c <devfile_read+0x61>
+  assert(r <= n);
+  801f65:	39 c3                	cmp    %eax,%ebx
+  801f67:	0f 82 0e 02 00 00    	jb     80217b <devfile_read+0x250>
+  assert(r <= PGSIZE);
+  801f6d:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  801f72:	0f 8f 1c 02 00 00    	jg     802194 <devfile_read+0x269>
+  memmove(buf, fsipcbuf.readRet.ret_buf, r);
+  801f78:	83 ec 04             	sub    $0x4,%esp
+  801f7b:	50                   	push   %eax
+  801f7c:	68 00 70 80 00       	push   $0x807000
+  801f81:	ff 75 0c             	push   0xc(%ebp)
+  801f84:	e8 05 ec ff ff       	call   800b8e <memmove>
+  return r;
+  801f89:	83 c4 10             	add    $0x10,%esp
+}
+  801f8c:	89 f0                	mov    %esi,%eax
+  801f8e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  801f91:	5b                   	pop    %ebx
+  801f92:	5e                   	pop    %esi
+  801f93:	5f                   	pop    %edi
+  801f94:	5d                   	pop    %ebp
+  801f95:	c3                   	ret
+  if ((r = fsv_alloc(1)) < 0)
+  801f96:	b8 01 00 00 00       	mov    $0x1,%eax
+  801f9b:	e8 0f ff ff ff       	call   801eaf <fsv_alloc>
+  801fa0:	89 c6                	mov    %eax,%esi
+  801fa2:	85 c0                	test   %eax,%eax
+  801fa4:	78 e6                	js     801f8c <devfile_read+0x61>
+  fsvreq->readv.req_fileid = fd->fd_file.id;
+  801fa6:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fa9:	8b 40 0c             	mov    0xc(%eax),%eax
+  801fac:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->readv.req_offset = fd->fd_offset;
+  801fb1:	8b 45 08             	mov    0x8(%ebp),%eax
+  801fb4:	8b 40 04             	mov    0x4(%eax),%eax
+  801fb7:	a3 04 00 c0 9f       	mov    %eax,0x9fc00004
+  fsvreq->readv.req_n = n;
+  801fbc:	89 1d 08 00 c0 9f    	mov    %ebx,0x9fc00008
+  npages = FSV_MAXPAGES;
+  801fc2:	c7 45 e4 00 01 00 00 	movl   $0x100,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  801fc9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801fce:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  801fd3:	b8 0c 00 00 00       	mov    $0xc,%eax
+  801fd8:	e8 e2 fc ff ff       	call   801cbf <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  801fdd:	6a 00                	push   $0x0
+  801fdf:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  801fe2:	50                   	push   %eax
+  801fe3:	68 00 10 c0 9f       	push   $0x9fc01000
+  801fe8:	6a 00                	push   $0x0
+  801fea:	e8 0e 18 00 00       	call   8037fd <ipc_recv_pages>
+  801fef:	89 c6                	mov    %eax,%esi
+  if ((r = fsipc_pages(FSREQ_READV, fsvreq, 1, FSVDATA, &npages)) <= 0)
+  801ff1:	83 c4 10             	add    $0x10,%esp
+  801ff4:	85 c0                	test   %eax,%eax
+  801ff6:	7e 94                	jle    801f8c <devfile_read+0x61>
+  assert(r <= n);
+  801ff8:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  801ffb:	39 c3                	cmp    %eax,%ebx
+  801ffd:	72 2e                	jb     80202d <devfile_read+0x102>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  801fff:	8b 45 08             	mov    0x8(%ebp),%eax
+  802002:	8b 40 04             	mov    0x4(%eax),%eax
+  802005:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80200a:	8d 0c 06             	lea    (%esi,%eax,1),%ecx
+  80200d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802010:	c1 e2 0c             	shl    $0xc,%edx
+  802013:	39 ca                	cmp    %ecx,%edx
+  802015:	72 2f                	jb     802046 <devfile_read+0x11b>
+  src = FSVDATA + PGOFF(fd->fd_offset);
+  802017:	2d 00 f0 3f 60       	sub    $0x603ff000,%eax
+  80201c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  failed = 0;
+  80201f:	c6 45 cb 00          	movb   $0x0,-0x35(%ebp)
+  for (done = 0; done < r; done += m) {
+  802023:	bf 00 00 00 00       	mov    $0x0,%edi
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  802028:	89 75 c4             	mov    %esi,-0x3c(%ebp)
+  80202b:	eb 52                	jmp    80207f <devfile_read+0x154>
+  assert(r <= n);
+  80202d:	68 1d 42 80 00       	push   $0x80421d
+  802032:	68 24 42 80 00       	push   $0x804224
+  802037:	68 49 01 00 00       	push   $0x149
+  80203c:	68 12 42 80 00       	push   $0x804212
+  802041:	e8 f9 e2 ff ff       	call   80033f <_panic>
+  assert(PGOFF(fd->fd_offset) + r <= npages * PGSIZE);
+  802046:	68 48 42 80 00       	push   $0x804248
+  80204b:	68 24 42 80 00       	push   $0x804224
+  802050:	68 4a 01 00 00       	push   $0x14a
+  802055:	68 12 42 80 00       	push   $0x804212
+  80205a:	e8 e0 e2 ff ff       	call   80033f <_panic>
+      memmove(dst + done, src + done, m);
+  80205f:	83 ec 04             	sub    $0x4,%esp
+  802062:	53                   	push   %ebx
+  802063:	56                   	push   %esi
+  802064:	89 f8                	mov    %edi,%eax
+  802066:	03 45 0c             	add    0xc(%ebp),%eax
+  802069:	50                   	push   %eax
+  80206a:	e8 1f eb ff ff       	call   800b8e <memmove>
+  80206f:	83 c4 10             	add    $0x10,%esp
+  for (done = 0; done < r; done += m) {
+  802072:	01 df                	add    %ebx,%edi
+  802074:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802077:	39 c7                	cmp    %eax,%edi
+  802079:	0f 83 c0 00 00 00    	jae    80213f <devfile_read+0x214>
+    m = MIN(PGSIZE - PGOFF(src + done), r - done);
+  80207f:	8b 45 d0             	mov    -0x30(%ebp),%eax
+  802082:	8d 34 38             	lea    (%eax,%edi,1),%esi
+  802085:	89 f0                	mov    %esi,%eax
+  802087:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80208c:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  802091:	29 c3                	sub    %eax,%ebx
+  802093:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802096:	29 f8                	sub    %edi,%eax
+  802098:	39 c3                	cmp    %eax,%ebx
+  80209a:	0f 47 d8             	cmova  %eax,%ebx
+    if (m == PGSIZE && can_remap(dst + done))
+  80209d:	81 fb 00 10 00 00    	cmp    $0x1000,%ebx
+  8020a3:	75 ba                	jne    80205f <devfile_read+0x134>
+  8020a5:	89 f9                	mov    %edi,%ecx
+  8020a7:	03 4d 0c             	add    0xc(%ebp),%ecx
+  8020aa:	89 4d cc             	mov    %ecx,-0x34(%ebp)
+  if (PGOFF(buf) || (uintptr_t) buf >= UTOP || !(uvpd[PDX(buf)] & PTE_P))
+  8020ad:	f7 c1 ff 0f 00 00    	test   $0xfff,%ecx
+  8020b3:	75 aa                	jne    80205f <devfile_read+0x134>
+  8020b5:	81 f9 ff ff bf ee    	cmp    $0xeebfffff,%ecx
+  8020bb:	77 a2                	ja     80205f <devfile_read+0x134>
+  8020bd:	89 c8                	mov    %ecx,%eax
+  8020bf:	c1 e8 16             	shr    $0x16,%eax
+  8020c2:	8b 04 85 00 d0 7b ef 	mov    -0x10843000(,%eax,4),%eax
+  8020c9:	a8 01                	test   $0x1,%al
+  8020cb:	74 92                	je     80205f <devfile_read+0x134>
+  pte = uvpt[PGNUM(buf)];
+  8020cd:	89 c8                	mov    %ecx,%eax
+  8020cf:	c1 e8 0c             	shr    $0xc,%eax
+  8020d2:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P) || !(pte & (PTE_W | PTE_COW)) || (pte & PTE_SHARE))
+  8020d9:	a8 01                	test   $0x1,%al
+  8020db:	74 82                	je     80205f <devfile_read+0x134>
+  8020dd:	a9 02 08 00 00       	test   $0x802,%eax
+  8020e2:	0f 84 77 ff ff ff    	je     80205f <devfile_read+0x134>
+  8020e8:	f6 c4 04             	test   $0x4,%ah
+  8020eb:	0f 85 6e ff ff ff    	jne    80205f <devfile_read+0x134>
+  return thisenv->env_kern_cow || sys_env_set_cow(0, 1) == 0;
+  8020f1:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  8020f6:	0f b6 40 6c          	movzbl 0x6c(%eax),%eax
+  8020fa:	84 c0                	test   %al,%al
+  8020fc:	75 17                	jne    802115 <devfile_read+0x1ea>
+  8020fe:	83 ec 08             	sub    $0x8,%esp
+  802101:	6a 01                	push   $0x1
+  802103:	6a 00                	push   $0x0
+  802105:	e8 ea ec ff ff       	call   800df4 <sys_env_set_cow>
+    if (m == PGSIZE && can_remap(dst + done))
+  80210a:	83 c4 10             	add    $0x10,%esp
+  80210d:	85 c0                	test   %eax,%eax
+  80210f:	0f 85 4a ff ff ff    	jne    80205f <devfile_read+0x134>
+      failed |= sysbatch_add(&fsv_batch, SYS_page_map, 0,
+  802115:	83 ec 04             	sub    $0x4,%esp
+  802118:	68 05 08 00 00       	push   $0x805
+  80211d:	ff 75 cc             	push   -0x34(%ebp)
+  802120:	6a 00                	push   $0x0
+  802122:	56                   	push   %esi
+  802123:	6a 00                	push   $0x0
+  802125:	6a 05                	push   $0x5
+  802127:	68 40 60 80 00       	push   $0x806040
+  80212c:	e8 59 f1 ff ff       	call   80128a <sysbatch_add>
+                             PTE_P | PTE_U | PTE_COW) < 0;
+  802131:	c1 e8 1f             	shr    $0x1f,%eax
+  802134:	08 45 cb             	or     %al,-0x35(%ebp)
+  802137:	83 c4 20             	add    $0x20,%esp
+  80213a:	e9 33 ff ff ff       	jmp    802072 <devfile_read+0x147>
+  if (sysbatch_flush(&fsv_batch) < 0 || failed)
+  80213f:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  802142:	83 ec 0c             	sub    $0xc,%esp
+  802145:	68 40 60 80 00       	push   $0x806040
+  80214a:	e8 eb f0 ff ff       	call   80123a <sysbatch_flush>
+  80214f:	83 c4 10             	add    $0x10,%esp
+  802152:	85 c0                	test   %eax,%eax
+  802154:	78 06                	js     80215c <devfile_read+0x231>
+  802156:	80 7d cb 00          	cmpb   $0x0,-0x35(%ebp)
+  80215a:	74 14                	je     802170 <devfile_read+0x245>
+    memmove(dst, src, r);
+  80215c:	83 ec 04             	sub    $0x4,%esp
+  80215f:	ff 75 d4             	push   -0x2c(%ebp)
+  802162:	ff 75 d0             	push   -0x30(%ebp)
+  802165:	ff 75 0c             	push   0xc(%ebp)
+  802168:	e8 21 ea ff ff       	call   800b8e <memmove>
+  80216d:	83 c4 10             	add    $0x10,%esp
+  fd->fd_offset += r;
+  802170:	8b 45 08             	mov    0x8(%ebp),%eax
+  802173:	01 70 04             	add    %esi,0x4(%eax)
+    return devfile_readv(fd, buf, n);
+  802176:	e9 11 fe ff ff       	jmp    801f8c <devfile_read+0x61>
+  assert(r <= n);
+  80217b:	68 1d 42 80 00       	push   $0x80421d
+  802180:	68 24 42 80 00       	push   $0x804224
+  802185:	68 1c 01 00 00       	push   $0x11c
+  80218a:	68 12 42 80 00       	push   $0x804212
+  80218f:	e8 ab e1 ff ff       	call   80033f <_panic>
+  assert(r <= PGSIZE);
+  802194:	68 39 42 80 00       	push   $0x804239
+  802199:	68 24 42 80 00       	push   $0x804224
+  80219e:	68 1d 01 00 00       	push   $0x11d
+  8021a3:	68 12 42 80 00       	push   $0x804212
+  8021a8:	e8 92 e1 ff ff       	call   80033f <_panic>
+
+008021ad <devfile_write>:
+{
+  8021ad:	55                   	push   %ebp
+  8021ae:	89 e5                	mov    %esp,%ebp
+  8021b0:	57                   	push   %edi
+  8021b1:	56                   	push   %esi
+  8021b2:	53                   	push   %ebx
+  8021b3:	83 ec 1c             	sub    $0x1c,%esp
+  8021b6:	8b 75 08             	mov    0x8(%ebp),%esi
+  8021b9:	8b 45 10             	mov    0x10(%ebp),%eax
+  if (n > sizeof(fsipcbuf.write.req_buf))
+  8021bc:	3d f8 0f 00 00       	cmp    $0xff8,%eax
+  8021c1:	77 39                	ja     8021fc <devfile_write+0x4f>
+  fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8021c3:	8b 56 0c             	mov    0xc(%esi),%edx
+  8021c6:	89 15 00 70 80 00    	mov    %edx,0x807000
+  fsipcbuf.write.req_n = n;
+  8021cc:	a3 04 70 80 00       	mov    %eax,0x807004
+  memmove(fsipcbuf.write.req_buf, buf, n);
+  8021d1:	83 ec 04             	sub    $0x4,%esp
+  8021d4:	50                   	push   %eax
+  8021d5:	ff 75 0c             	push   0xc(%ebp)
+  8021d8:	68 08 70 80 00       	push   $0x807008
+  8021dd:	e8 ac e9 ff ff       	call   800b8e <memmove>
+  return fsipc(FSREQ_WRITE, NULL);
+  8021e2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021e7:	b8 04 00 00 00       	mov    $0x4,%eax
+  8021ec:	e8 e7 fb ff ff       	call   801dd8 <fsipc>
+  8021f1:	83 c4 10             	add    $0x10,%esp
+}
+  8021f4:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8021f7:	5b                   	pop    %ebx
+  8021f8:	5e                   	pop    %esi
+  8021f9:	5f                   	pop    %edi
+  8021fa:	5d                   	pop    %ebp
+  8021fb:	c3                   	ret
+  n = MIN(n, FSV_MAXPAGES * PGSIZE);
+  8021fc:	ba 00 00 10 00       	mov    $0x100000,%edx
+  802201:	39 d0                	cmp    %edx,%eax
+  802203:	89 d3                	mov    %edx,%ebx
+  802205:	0f 46 d8             	cmovbe %eax,%ebx
+  npages = ROUNDUP(n, PGSIZE) / PGSIZE;
+  802208:	8d bb ff 0f 00 00    	lea    0xfff(%ebx),%edi
+  80220e:	c1 ef 0c             	shr    $0xc,%edi
+  if ((r = fsv_alloc(1 + npages)) < 0)
+  802211:	83 c7 01             	add    $0x1,%edi
+  802214:	89 f8                	mov    %edi,%eax
+  802216:	e8 94 fc ff ff       	call   801eaf <fsv_alloc>
+  80221b:	85 c0                	test   %eax,%eax
+  80221d:	78 d5                	js     8021f4 <devfile_write+0x47>
+  memmove(FSVDATA, buf, n);
+  80221f:	83 ec 04             	sub    $0x4,%esp
+  802222:	53                   	push   %ebx
+  802223:	ff 75 0c             	push   0xc(%ebp)
+  802226:	68 00 10 c0 9f       	push   $0x9fc01000
+  80222b:	e8 5e e9 ff ff       	call   800b8e <memmove>
+  fsvreq->writev.req_fileid = fd->fd_file.id;
+  802230:	8b 46 0c             	mov    0xc(%esi),%eax
+  802233:	a3 00 00 c0 9f       	mov    %eax,0x9fc00000
+  fsvreq->writev.req_n = n;
+  802238:	89 1d 04 00 c0 9f    	mov    %ebx,0x9fc00004
+  nrecv = 0;
+  80223e:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  fsipc_send(type, req, nsend);
+  802245:	89 f9                	mov    %edi,%ecx
+  802247:	ba 00 00 c0 9f       	mov    $0x9fc00000,%edx
+  80224c:	b8 0d 00 00 00       	mov    $0xd,%eax
+  802251:	e8 69 fa ff ff       	call   801cbf <fsipc_send>
+  return ipc_recv_pages(NULL, dstva, nrecv, NULL);
+  802256:	6a 00                	push   $0x0
+  802258:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  80225b:	50                   	push   %eax
+  80225c:	6a 00                	push   $0x0
+  80225e:	6a 00                	push   $0x0
+  802260:	e8 98 15 00 00       	call   8037fd <ipc_recv_pages>
+  return fsipc_pages(FSREQ_WRITEV, fsvreq, 1 + npages, NULL, &nrecv);
+  802265:	83 c4 20             	add    $0x20,%esp
+    return devfile_writev(fd, buf, n);
+  802268:	eb 8a                	jmp    8021f4 <devfile_write+0x47>
+
+0080226a <open>:
+{
+  80226a:	55                   	push   %ebp
+  80226b:	89 e5                	mov    %esp,%ebp
+  80226d:	56                   	push   %esi
+  80226e:	53                   	push   %ebx
+  80226f:	83 ec 1c             	sub    $0x1c,%esp
+  802272:	8b 75 08             	mov    0x8(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  802275:	56                   	push   %esi
+  802276:	e8 52 e7 ff ff       	call   8009cd <strlen>
+  80227b:	83 c4 10             	add    $0x10,%esp
+  80227e:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802283:	7f 6c                	jg     8022f1 <open+0x87>
+  if ((r = fd_alloc(&fd)) < 0)
+  802285:	83 ec 0c             	sub    $0xc,%esp
+  802288:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80228b:	50                   	push   %eax
+  80228c:	e8 ad f4 ff ff       	call   80173e <fd_alloc>
+  802291:	89 c3                	mov    %eax,%ebx
+  802293:	83 c4 10             	add    $0x10,%esp
+  802296:	85 c0                	test   %eax,%eax
+  802298:	78 3c                	js     8022d6 <open+0x6c>
+  strcpy(fsipcbuf.open.req_path, path);
+  80229a:	83 ec 08             	sub    $0x8,%esp
+  80229d:	56                   	push   %esi
+  80229e:	68 00 70 80 00       	push   $0x807000
+  8022a3:	e8 60 e7 ff ff       	call   800a08 <strcpy>
+  fsipcbuf.open.req_omode = mode;
+  8022a8:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8022ab:	a3 00 74 80 00       	mov    %eax,0x807400
+  if ((r = fsipc(FSREQ_OPEN, fd)) < 0) {
+  8022b0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  8022b3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022b8:	e8 1b fb ff ff       	call   801dd8 <fsipc>
+  8022bd:	89 c3                	mov    %eax,%ebx
+  8022bf:	83 c4 10             	add    $0x10,%esp
+  8022c2:	85 c0                	test   %eax,%eax
+  8022c4:	78 19                	js     8022df <open+0x75>
+  return fd2num(fd);
+  8022c6:	83 ec 0c             	sub    $0xc,%esp
+  8022c9:	ff 75 f4             	push   -0xc(%ebp)
+  8022cc:	e8 49 f4 ff ff       	call   80171a <fd2num>
+  8022d1:	89 c3                	mov    %eax,%ebx
+  8022d3:	83 c4 10             	add    $0x10,%esp
+}
+  8022d6:	89 d8                	mov    %ebx,%eax
+  8022d8:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8022db:	5b                   	pop    %ebx
+  8022dc:	5e                   	pop    %esi
+  8022dd:	5d                   	pop    %ebp
+  8022de:	c3                   	ret
+    fd_close(fd, 0);
+  8022df:	83 ec 08             	sub    $0x8,%esp
+  8022e2:	6a 00                	push   $0x0
+  8022e4:	ff 75 f4             	push   -0xc(%ebp)
+  8022e7:	e8 44 f5 ff ff       	call   801830 <fd_close>
+    return r;
+  8022ec:	83 c4 10             	add    $0x10,%esp
+  8022ef:	eb e5                	jmp    8022d6 <open+0x6c>
+    return -E_BAD_PATH;
+  8022f1:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  8022f6:	eb de                	jmp    8022d6 <open+0x6c>
+
+008022f8 <open_read>:
+{
+  8022f8:	55                   	push   %ebp
+  8022f9:	89 e5                	mov    %esp,%ebp
+  8022fb:	57                   	push   %edi
+  8022fc:	56                   	push   %esi
+  8022fd:	53                   	push   %ebx
+  8022fe:	83 ec 28             	sub    $0x28,%esp
+  802301:	8b 7d 08             	mov    0x8(%ebp),%edi
+  if ((pathlen = strlen(path)) >= MAXPATHLEN)
+  802304:	57                   	push   %edi
+  802305:	e8 c3 e6 ff ff       	call   8009cd <strlen>
+  80230a:	83 c4 10             	add    $0x10,%esp
+  80230d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802312:	0f 87 f6 00 00 00    	ja     80240e <open_read+0x116>
+  802318:	89 c6                	mov    %eax,%esi
+  if ((r = fd_alloc(&fd)) < 0)
+  80231a:	83 ec 0c             	sub    $0xc,%esp
+  80231d:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802320:	50                   	push   %eax
+  802321:	e8 18 f4 ff ff       	call   80173e <fd_alloc>
+  802326:	89 c3                	mov    %eax,%ebx
+  802328:	83 c4 10             	add    $0x10,%esp
+  80232b:	85 c0                	test   %eax,%eax
+  80232d:	0f 88 b2 00 00 00    	js     8023e5 <open_read+0xed>
+  strcpy(req->req_buf, path);
+  802333:	83 ec 08             	sub    $0x8,%esp
+  802336:	57                   	push   %edi
+  802337:	68 e4 70 80 00       	push   $0x8070e4
+  80233c:	e8 c7 e6 ff ff       	call   800a08 <strcpy>
+  req->req_nops = 2;
+  802341:	c7 05 00 70 80 00 02 	movl   $0x2,0x807000
+  802348:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN;
+  80234b:	c7 05 04 70 80 00 01 	movl   $0x1,0x807004
+  802352:	00 00 00 
+  req->req_ops[0].op_arg = mode;
+  802355:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802358:	a3 10 70 80 00       	mov    %eax,0x807010
+  req->req_ops[0].op_buf = 0;
+  80235d:	c7 05 18 70 80 00 00 	movl   $0x0,0x807018
+  802364:	00 00 00 
+  req->req_ops[1].op_type = FSOP_READ;
+  802367:	c7 05 20 70 80 00 04 	movl   $0x4,0x807020
+  80236e:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  802371:	c7 05 24 70 80 00 01 	movl   $0x1,0x807024
+  802378:	00 00 00 
+  n = MIN(n, sizeof(req->req_buf) - (pathlen + 1));
+  80237b:	b8 1b 0f 00 00       	mov    $0xf1b,%eax
+  802380:	29 f0                	sub    %esi,%eax
+  802382:	3b 45 14             	cmp    0x14(%ebp),%eax
+  802385:	0f 47 45 14          	cmova  0x14(%ebp),%eax
+  req->req_ops[1].op_arg = n;
+  802389:	a3 2c 70 80 00       	mov    %eax,0x80702c
+  req->req_ops[1].op_offset = 0;
+  80238e:	c7 05 30 70 80 00 00 	movl   $0x0,0x807030
+  802395:	00 00 00 
+  req->req_ops[1].op_buf = pathlen + 1;
+  802398:	83 c6 01             	add    $0x1,%esi
+  80239b:	89 35 34 70 80 00    	mov    %esi,0x807034
+  if ((r = fsipc(FSREQ_COMPOUND, fd)) < 2) {
+  8023a1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  8023a4:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8023a9:	e8 2a fa ff ff       	call   801dd8 <fsipc>
+  8023ae:	89 c3                	mov    %eax,%ebx
+  8023b0:	83 c4 10             	add    $0x10,%esp
+  8023b3:	83 f8 01             	cmp    $0x1,%eax
+  8023b6:	7e 37                	jle    8023ef <open_read+0xf7>
+  *nread = req->req_ops[1].op_ret;
+  8023b8:	a1 38 70 80 00       	mov    0x807038,%eax
+  8023bd:	8b 55 18             	mov    0x18(%ebp),%edx
+  8023c0:	89 02                	mov    %eax,(%edx)
+  memmove(buf, req->req_buf + pathlen + 1, *nread);
+  8023c2:	83 ec 04             	sub    $0x4,%esp
+  8023c5:	50                   	push   %eax
+  8023c6:	81 c6 e4 70 80 00    	add    $0x8070e4,%esi
+  8023cc:	56                   	push   %esi
+  8023cd:	ff 75 10             	push   0x10(%ebp)
+  8023d0:	e8 b9 e7 ff ff       	call   800b8e <memmove>
+  return fd2num(fd);
+  8023d5:	83 c4 04             	add    $0x4,%esp
+  8023d8:	ff 75 e4             	push   -0x1c(%ebp)
+  8023db:	e8 3a f3 ff ff       	call   80171a <fd2num>
+  8023e0:	89 c3                	mov    %eax,%ebx
+  8023e2:	83 c4 10             	add    $0x10,%esp
+}
+  8023e5:	89 d8                	mov    %ebx,%eax
+  8023e7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8023ea:	5b                   	pop    %ebx
+  8023eb:	5e                   	pop    %esi
+  8023ec:	5f                   	pop    %edi
+  8023ed:	5d                   	pop    %ebp
+  8023ee:	c3                   	ret
+    fd_close(fd, 0);
+  8023ef:	83 ec 08             	sub    $0x8,%esp
+  8023f2:	6a 00                	push   $0x0
+  8023f4:	ff 75 e4             	push   -0x1c(%ebp)
+  8023f7:	e8 34 f4 ff ff       	call   801830 <fd_close>
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  8023fc:	83 c4 10             	add    $0x10,%esp
+  8023ff:	85 db                	test   %ebx,%ebx
+  802401:	78 e2                	js     8023e5 <open_read+0xed>
+  802403:	6b db 1c             	imul   $0x1c,%ebx,%ebx
+  802406:	8b 9b 1c 70 80 00    	mov    0x80701c(%ebx),%ebx
+  80240c:	eb d7                	jmp    8023e5 <open_read+0xed>
+    return -E_BAD_PATH;
+  80240e:	bb f4 ff ff ff       	mov    $0xfffffff4,%ebx
+  802413:	eb d0                	jmp    8023e5 <open_read+0xed>
+
+00802415 <file_stat>:
+{
+  802415:	55                   	push   %ebp
+  802416:	89 e5                	mov    %esp,%ebp
+  802418:	57                   	push   %edi
+  802419:	56                   	push   %esi
+  80241a:	53                   	push   %ebx
+  80241b:	83 ec 18             	sub    $0x18,%esp
+  80241e:	8b 7d 08             	mov    0x8(%ebp),%edi
+  802421:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if (strlen(path) >= MAXPATHLEN)
+  802424:	57                   	push   %edi
+  802425:	e8 a3 e5 ff ff       	call   8009cd <strlen>
+  80242a:	83 c4 10             	add    $0x10,%esp
+  80242d:	3d ff 03 00 00       	cmp    $0x3ff,%eax
+  802432:	0f 8f c7 00 00 00    	jg     8024ff <file_stat+0xea>
+  off = ROUNDUP(strlen(path) + 1, sizeof(uint32_t));
+  802438:	83 ec 0c             	sub    $0xc,%esp
+  80243b:	57                   	push   %edi
+  80243c:	e8 8c e5 ff ff       	call   8009cd <strlen>
+  802441:	8d 58 04             	lea    0x4(%eax),%ebx
+  802444:	83 e3 fc             	and    $0xfffffffc,%ebx
+  strcpy(req->req_buf, path);
+  802447:	83 c4 08             	add    $0x8,%esp
+  80244a:	57                   	push   %edi
+  80244b:	68 e4 70 80 00       	push   $0x8070e4
+  802450:	e8 b3 e5 ff ff       	call   800a08 <strcpy>
+  req->req_nops = 2;
+  802455:	c7 05 00 70 80 00 02 	movl   $0x2,0x807000
+  80245c:	00 00 00 
+  req->req_ops[0].op_type = FSOP_OPEN_TEMP;
+  80245f:	c7 05 04 70 80 00 02 	movl   $0x2,0x807004
+  802466:	00 00 00 
+  req->req_ops[0].op_arg = O_RDONLY;
+  802469:	c7 05 10 70 80 00 00 	movl   $0x0,0x807010
+  802470:	00 00 00 
+  req->req_ops[0].op_buf = 0;
+  802473:	c7 05 18 70 80 00 00 	movl   $0x0,0x807018
+  80247a:	00 00 00 
+  req->req_ops[1].op_type = FSOP_STAT;
+  80247d:	c7 05 20 70 80 00 03 	movl   $0x3,0x807020
+  802484:	00 00 00 
+  req->req_ops[1].op_step = 1;
+  802487:	c7 05 24 70 80 00 01 	movl   $0x1,0x807024
+  80248e:	00 00 00 
+  req->req_ops[1].op_buf = off;
+  802491:	89 1d 34 70 80 00    	mov    %ebx,0x807034
+  if ((r = fsipc(FSREQ_COMPOUND, NULL)) < 2)
+  802497:	ba 00 00 00 00       	mov    $0x0,%edx
+  80249c:	b8 0e 00 00 00       	mov    $0xe,%eax
+  8024a1:	e8 32 f9 ff ff       	call   801dd8 <fsipc>
+  8024a6:	83 c4 10             	add    $0x10,%esp
+  8024a9:	83 f8 01             	cmp    $0x1,%eax
+  8024ac:	7e 42                	jle    8024f0 <file_stat+0xdb>
+  ret = (struct Fsret_stat *) (req->req_buf + off);
+  8024ae:	81 c3 e4 70 80 00    	add    $0x8070e4,%ebx
+  strcpy(st->st_name, ret->ret_name);
+  8024b4:	83 ec 08             	sub    $0x8,%esp
+  8024b7:	53                   	push   %ebx
+  8024b8:	56                   	push   %esi
+  8024b9:	e8 4a e5 ff ff       	call   800a08 <strcpy>
+  st->st_size = ret->ret_size;
+  8024be:	8b 83 80 00 00 00    	mov    0x80(%ebx),%eax
+  8024c4:	89 86 80 00 00 00    	mov    %eax,0x80(%esi)
+  st->st_isdir = ret->ret_isdir;
+  8024ca:	8b 83 84 00 00 00    	mov    0x84(%ebx),%eax
+  8024d0:	89 86 84 00 00 00    	mov    %eax,0x84(%esi)
+  st->st_dev = &devfile;
+  8024d6:	c7 86 88 00 00 00 08 	movl   $0x805008,0x88(%esi)
+  8024dd:	50 80 00 
+  return 0;
+  8024e0:	83 c4 10             	add    $0x10,%esp
+  8024e3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8024e8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8024eb:	5b                   	pop    %ebx
+  8024ec:	5e                   	pop    %esi
+  8024ed:	5f                   	pop    %edi
+  8024ee:	5d                   	pop    %ebp
+  8024ef:	c3                   	ret
+    return r < 0 ? r : req->req_ops[r].op_ret;
+  8024f0:	85 c0                	test   %eax,%eax
+  8024f2:	78 f4                	js     8024e8 <file_stat+0xd3>
+  8024f4:	6b c0 1c             	imul   $0x1c,%eax,%eax
+  8024f7:	8b 80 1c 70 80 00    	mov    0x80701c(%eax),%eax
+  8024fd:	eb e9                	jmp    8024e8 <file_stat+0xd3>
+    return -E_BAD_PATH;
+  8024ff:	b8 f4 ff ff ff       	mov    $0xfffffff4,%eax
+  802504:	eb e2                	jmp    8024e8 <file_stat+0xd3>
+
+00802506 <read_map>:
+{
+  802506:	55                   	push   %ebp
+  802507:	89 e5                	mov    %esp,%ebp
+  802509:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  80250c:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80250f:	50                   	push   %eax
+  802510:	ff 75 08             	push   0x8(%ebp)
+  802513:	e8 7c f2 ff ff       	call   801794 <fd_lookup>
+  802518:	83 c4 10             	add    $0x10,%esp
+  80251b:	85 c0                	test   %eax,%eax
+  80251d:	78 2a                	js     802549 <read_map+0x43>
+  if (fd->fd_dev_id != devfile.dev_id)
+  80251f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802522:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+  802528:	39 08                	cmp    %ecx,(%eax)
+  80252a:	75 1f                	jne    80254b <read_map+0x45>
+  fsipcbuf.read_map.req_fileid = fd->fd_file.id;
+  80252c:	8b 40 0c             	mov    0xc(%eax),%eax
+  80252f:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.read_map.req_offset = offset;
+  802534:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802537:	a3 04 70 80 00       	mov    %eax,0x807004
+  return fsipc(FSREQ_READ_MAP, dstva);
+  80253c:	8b 55 10             	mov    0x10(%ebp),%edx
+  80253f:	b8 0b 00 00 00       	mov    $0xb,%eax
+  802544:	e8 8f f8 ff ff       	call   801dd8 <fsipc>
+}
+  802549:	c9                   	leave
+  80254a:	c3                   	ret
+    return -E_INVAL;
+  80254b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802550:	eb f7                	jmp    802549 <read_map+0x43>
+
+00802552 <sync>:
+
+
+// Synchronize disk with buffer cache
+int
+sync(void)
+{
+  802552:	55                   	push   %ebp
+  802553:	89 e5                	mov    %esp,%ebp
+  802555:	83 ec 08             	sub    $0x8,%esp
+  // Ask the file server to update the disk
+  // by writing any dirty blocks in the buffer cache.
+
+  return fsipc(FSREQ_SYNC, NULL);
+  802558:	ba 00 00 00 00       	mov    $0x0,%edx
+  80255d:	b8 08 00 00 00       	mov    $0x8,%eax
+  802562:	e8 71 f8 ff ff       	call   801dd8 <fsipc>
+}
+  802567:	c9                   	leave
+  802568:	c3                   	ret
+
+00802569 <fs_stats>:
+
+// Get the file server's block cache statistics, first setting the
+// cache's capacity to 'bc_capacity' blocks unless that is 0.
+int
+fs_stats(uint32_t bc_capacity, struct Fsret_stats *st)
+{
+  802569:	55                   	push   %ebp
+  80256a:	89 e5                	mov    %esp,%ebp
+  80256c:	57                   	push   %edi
+  80256d:	56                   	push   %esi
+  int r;
+
+  fsipcbuf.stats.req_bc_capacity = bc_capacity;
+  80256e:	8b 45 08             	mov    0x8(%ebp),%eax
+  802571:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.stats.req_bio_sched = 0;
+  802576:	c7 05 04 70 80 00 00 	movl   $0x0,0x807004
+  80257d:	00 00 00 
+  fsipcbuf.stats.req_dcache = 0;
+  802580:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  802587:	00 00 00 
+  if ((r = fsipc(FSREQ_STATS, NULL)) < 0)
+  80258a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80258f:	b8 09 00 00 00       	mov    $0x9,%eax
+  802594:	e8 3f f8 ff ff       	call   801dd8 <fsipc>
+  802599:	85 c0                	test   %eax,%eax
+  80259b:	78 14                	js     8025b1 <fs_stats+0x48>
+    return r;
+  *st = fsipcbuf.statsRet;
+  80259d:	be 00 70 80 00       	mov    $0x807000,%esi
+  8025a2:	b9 16 00 00 00       	mov    $0x16,%ecx
+  8025a7:	8b 7d 0c             	mov    0xc(%ebp),%edi
+  8025aa:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  return 0;
+  8025ac:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8025b1:	5e                   	pop    %esi
+  8025b2:	5f                   	pop    %edi
+  8025b3:	5d                   	pop    %ebp
+  8025b4:	c3                   	ret
+
+008025b5 <fs_dropcache>:
+// Empty the file server's block cache, by shrinking it to the smallest
+// capacity and putting the capacity back, so that what follows reads
+// from the disk.
+int
+fs_dropcache(void)
+{
+  8025b5:	55                   	push   %ebp
+  8025b6:	89 e5                	mov    %esp,%ebp
+  8025b8:	53                   	push   %ebx
+  8025b9:	83 ec 6c             	sub    $0x6c,%esp
+  struct Fsret_stats st;
+  uint32_t capacity;
+  int r;
+
+  if ((r = fs_stats(0, &st)) < 0)
+  8025bc:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8025bf:	50                   	push   %eax
+  8025c0:	6a 00                	push   $0x0
+  8025c2:	e8 a2 ff ff ff       	call   802569 <fs_stats>
+  8025c7:	83 c4 10             	add    $0x10,%esp
+  8025ca:	85 c0                	test   %eax,%eax
+  8025cc:	78 28                	js     8025f6 <fs_dropcache+0x41>
+    return r;
+  capacity = st.ret_bc_capacity;
+  8025ce:	8b 5d a0             	mov    -0x60(%ebp),%ebx
+  if ((r = fs_stats(BC_MINCAPACITY, &st)) < 0)
+  8025d1:	83 ec 08             	sub    $0x8,%esp
+  8025d4:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8025d7:	50                   	push   %eax
+  8025d8:	6a 20                	push   $0x20
+  8025da:	e8 8a ff ff ff       	call   802569 <fs_stats>
+  8025df:	83 c4 10             	add    $0x10,%esp
+  8025e2:	85 c0                	test   %eax,%eax
+  8025e4:	78 10                	js     8025f6 <fs_dropcache+0x41>
+    return r;
+  return fs_stats(capacity, &st);
+  8025e6:	83 ec 08             	sub    $0x8,%esp
+  8025e9:	8d 45 a0             	lea    -0x60(%ebp),%eax
+  8025ec:	50                   	push   %eax
+  8025ed:	53                   	push   %ebx
+  8025ee:	e8 76 ff ff ff       	call   802569 <fs_stats>
+  8025f3:	83 c4 10             	add    $0x10,%esp
+}
+  8025f6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8025f9:	c9                   	leave
+  8025fa:	c3                   	ret
+
+008025fb <fs_set_sched>:
+
+// Set how the file server orders its disk requests (BIO_SCHED_*).
+int
+fs_set_sched(int sched)
+{
+  8025fb:	55                   	push   %ebp
+  8025fc:	89 e5                	mov    %esp,%ebp
+  8025fe:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  802601:	c7 05 00 70 80 00 00 	movl   $0x0,0x807000
+  802608:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = sched;
+  80260b:	8b 45 08             	mov    0x8(%ebp),%eax
+  80260e:	a3 04 70 80 00       	mov    %eax,0x807004
+  fsipcbuf.stats.req_dcache = 0;
+  802613:	c7 05 08 70 80 00 00 	movl   $0x0,0x807008
+  80261a:	00 00 00 
+  return fsipc(FSREQ_STATS, NULL);
+  80261d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802622:	b8 09 00 00 00       	mov    $0x9,%eax
+  802627:	e8 ac f7 ff ff       	call   801dd8 <fsipc>
+}
+  80262c:	c9                   	leave
+  80262d:	c3                   	ret
+
+0080262e <fs_set_dcache>:
+
+// Turn the file server's path lookup cache on or off (DCACHE_*).
+int
+fs_set_dcache(int setting)
+{
+  80262e:	55                   	push   %ebp
+  80262f:	89 e5                	mov    %esp,%ebp
+  802631:	83 ec 08             	sub    $0x8,%esp
+  fsipcbuf.stats.req_bc_capacity = 0;
+  802634:	c7 05 00 70 80 00 00 	movl   $0x0,0x807000
+  80263b:	00 00 00 
+  fsipcbuf.stats.req_bio_sched = 0;
+  80263e:	c7 05 04 70 80 00 00 	movl   $0x0,0x807004
+  802645:	00 00 00 
+  fsipcbuf.stats.req_dcache = setting;
+  802648:	8b 45 08             	mov    0x8(%ebp),%eax
+  80264b:	a3 08 70 80 00       	mov    %eax,0x807008
+  return fsipc(FSREQ_STATS, NULL);
+  802650:	ba 00 00 00 00       	mov    $0x0,%edx
+  802655:	b8 09 00 00 00       	mov    $0x9,%eax
+  80265a:	e8 79 f7 ff ff       	call   801dd8 <fsipc>
+}
+  80265f:	c9                   	leave
+  802660:	c3                   	ret
+
+00802661 <fallocate>:
+// Reserve disk blocks for bytes [offset, offset+len) of file 'fdnum'
+// without changing its size, so that writing them later is quick and
+// lays them out in one run.
+int
+fallocate(int fdnum, off_t offset, off_t len)
+{
+  802661:	55                   	push   %ebp
+  802662:	89 e5                	mov    %esp,%ebp
+  802664:	83 ec 20             	sub    $0x20,%esp
+  struct Fd *fd;
+  int r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802667:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80266a:	50                   	push   %eax
+  80266b:	ff 75 08             	push   0x8(%ebp)
+  80266e:	e8 21 f1 ff ff       	call   801794 <fd_lookup>
+  802673:	83 c4 10             	add    $0x10,%esp
+  802676:	85 c0                	test   %eax,%eax
+  802678:	78 34                	js     8026ae <fallocate+0x4d>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  80267a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80267d:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+  802683:	39 08                	cmp    %ecx,(%eax)
+  802685:	75 29                	jne    8026b0 <fallocate+0x4f>
+    return -E_INVAL;
+  fsipcbuf.fallocate.req_fileid = fd->fd_file.id;
+  802687:	8b 40 0c             	mov    0xc(%eax),%eax
+  80268a:	a3 00 70 80 00       	mov    %eax,0x807000
+  fsipcbuf.fallocate.req_offset = offset;
+  80268f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  802692:	a3 04 70 80 00       	mov    %eax,0x807004
+  fsipcbuf.fallocate.req_len = len;
+  802697:	8b 45 10             	mov    0x10(%ebp),%eax
+  80269a:	a3 08 70 80 00       	mov    %eax,0x807008
+  return fsipc(FSREQ_FALLOCATE, NULL);
+  80269f:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026a4:	b8 0f 00 00 00       	mov    $0xf,%eax
+  8026a9:	e8 2a f7 ff ff       	call   801dd8 <fsipc>
+}
+  8026ae:	c9                   	leave
+  8026af:	c3                   	ret
+    return -E_INVAL;
+  8026b0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8026b5:	eb f7                	jmp    8026ae <fallocate+0x4d>
+
+008026b7 <prefetch>:
+// Ask the file server to read the blocks of file 'fdnum' holding
+// offsets[0..n-1] into its cache in the background, so that reading
+// them later doesn't wait for the disk.
+int
+prefetch(int fdnum, const off_t *offsets, int n)
+{
+  8026b7:	55                   	push   %ebp
+  8026b8:	89 e5                	mov    %esp,%ebp
+  8026ba:	57                   	push   %edi
+  8026bb:	56                   	push   %esi
+  8026bc:	53                   	push   %ebx
+  8026bd:	83 ec 24             	sub    $0x24,%esp
+  8026c0:	8b 75 10             	mov    0x10(%ebp),%esi
+  struct Fd *fd;
+  int r, m;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8026c3:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8026c6:	50                   	push   %eax
+  8026c7:	ff 75 08             	push   0x8(%ebp)
+  8026ca:	e8 c5 f0 ff ff       	call   801794 <fd_lookup>
+  8026cf:	83 c4 10             	add    $0x10,%esp
+  8026d2:	85 c0                	test   %eax,%eax
+  8026d4:	78 66                	js     80273c <prefetch+0x85>
+    return r;
+  if (fd->fd_dev_id != devfile.dev_id)
+  8026d6:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8026d9:	8b 0d 08 50 80 00    	mov    0x805008,%ecx
+  8026df:	39 08                	cmp    %ecx,(%eax)
+  8026e1:	75 61                	jne    802744 <prefetch+0x8d>
+    return -E_INVAL;
+
+  for (; n > 0; offsets += m, n -= m) {
+  8026e3:	85 f6                	test   %esi,%esi
+  8026e5:	7e 50                	jle    802737 <prefetch+0x80>
+    m = MIN(n, sizeof(fsipcbuf.prefetch.req_offsets) / sizeof(off_t));
+  8026e7:	bb fe 03 00 00       	mov    $0x3fe,%ebx
+  8026ec:	39 de                	cmp    %ebx,%esi
+  8026ee:	0f 46 de             	cmovbe %esi,%ebx
+    fsipcbuf.prefetch.req_fileid = fd->fd_file.id;
+  8026f1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  8026f4:	8b 40 0c             	mov    0xc(%eax),%eax
+  8026f7:	a3 00 70 80 00       	mov    %eax,0x807000
+    fsipcbuf.prefetch.req_n = m;
+  8026fc:	89 1d 04 70 80 00    	mov    %ebx,0x807004
+    memmove(fsipcbuf.prefetch.req_offsets, offsets, m * sizeof(off_t));
+  802702:	8d 3c 9d 00 00 00 00 	lea    0x0(,%ebx,4),%edi
+  802709:	83 ec 04             	sub    $0x4,%esp
+  80270c:	57                   	push   %edi
+  80270d:	ff 75 0c             	push   0xc(%ebp)
+  802710:	68 08 70 80 00       	push   $0x807008
+  802715:	e8 74 e4 ff ff       	call   800b8e <memmove>
+    if ((r = fsipc(FSREQ_PREFETCH, NULL)) < 0)
+  80271a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80271f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  802724:	e8 af f6 ff ff       	call   801dd8 <fsipc>
+  802729:	83 c4 10             	add    $0x10,%esp
+  80272c:	85 c0                	test   %eax,%eax
+  80272e:	78 0c                	js     80273c <prefetch+0x85>
+  for (; n > 0; offsets += m, n -= m) {
+  802730:	01 7d 0c             	add    %edi,0xc(%ebp)
+  802733:	29 de                	sub    %ebx,%esi
+  802735:	eb ac                	jmp    8026e3 <prefetch+0x2c>
+      return r;
+  }
+  return 0;
+  802737:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80273c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80273f:	5b                   	pop    %ebx
+  802740:	5e                   	pop    %esi
+  802741:	5f                   	pop    %edi
+  802742:	5d                   	pop    %ebp
+  802743:	c3                   	ret
+    return -E_INVAL;
+  802744:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802749:	eb f1                	jmp    80273c <prefetch+0x85>
+
+0080274b <pipe_ring>:
+};
+
+// Return the ring buffer of a bulk pipe
+static uint8_t*
+pipe_ring(struct Fd *fd)
+{
+  80274b:	55                   	push   %ebp
+  80274c:	89 e5                	mov    %esp,%ebp
+  80274e:	83 ec 14             	sub    $0x14,%esp
+  return (uint8_t*)fd2data(fd) + PGSIZE;
+  802751:	50                   	push   %eax
+  802752:	e8 d3 ef ff ff       	call   80172a <fd2data>
+  802757:	05 00 10 00 00       	add    $0x1000,%eax
+}
+  80275c:	c9                   	leave
+  80275d:	c3                   	ret
+
+0080275e <devpipe_stat>:
+  return i;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat)
+{
+  80275e:	55                   	push   %ebp
+  80275f:	89 e5                	mov    %esp,%ebp
+  802761:	56                   	push   %esi
+  802762:	53                   	push   %ebx
+  802763:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  802766:	83 ec 0c             	sub    $0xc,%esp
+  802769:	ff 75 08             	push   0x8(%ebp)
+  80276c:	e8 b9 ef ff ff       	call   80172a <fd2data>
+  802771:	89 c6                	mov    %eax,%esi
+
+  strcpy(stat->st_name, "<pipe>");
+  802773:	83 c4 08             	add    $0x8,%esp
+  802776:	68 74 42 80 00       	push   $0x804274
+  80277b:	53                   	push   %ebx
+  80277c:	e8 87 e2 ff ff       	call   800a08 <strcpy>
+  stat->st_size = p->p_wpos - p->p_rpos;
+  802781:	8b 46 04             	mov    0x4(%esi),%eax
+  802784:	2b 06                	sub    (%esi),%eax
+  802786:	89 83 80 00 00 00    	mov    %eax,0x80(%ebx)
+  stat->st_isdir = 0;
+  80278c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%ebx)
+  802793:	00 00 00 
+  stat->st_dev = &devpipe;
+  802796:	c7 83 88 00 00 00 24 	movl   $0x805024,0x88(%ebx)
+  80279d:	50 80 00 
+  return 0;
+}
+  8027a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027a5:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  8027a8:	5b                   	pop    %ebx
+  8027a9:	5e                   	pop    %esi
+  8027aa:	5d                   	pop    %ebp
+  8027ab:	c3                   	ret
+
+008027ac <pipe_wakeup>:
+{
+  8027ac:	89 c1                	mov    %eax,%ecx
+xchg(volatile uint32_t *addr, uint32_t newval)
+{
+  uint32_t result;
+
+  // The + in "+m" denotes a read-modify-write operand.
+  asm volatile ("lock; xchgl %0, %1" :
+  8027ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027b3:	f0 87 01             	lock xchg %eax,(%ecx)
+  if (xchg(flag, 0))
+  8027b6:	85 c0                	test   %eax,%eax
+  8027b8:	75 01                	jne    8027bb <pipe_wakeup+0xf>
+  8027ba:	c3                   	ret
+{
+  8027bb:	55                   	push   %ebp
+  8027bc:	89 e5                	mov    %esp,%ebp
+  8027be:	83 ec 0c             	sub    $0xc,%esp
+    sys_chan_wakeup(pos, (void*) UTOP, 0);
+  8027c1:	6a 00                	push   $0x0
+  8027c3:	68 00 00 c0 ee       	push   $0xeec00000
+  8027c8:	52                   	push   %edx
+  8027c9:	e8 c5 e9 ff ff       	call   801193 <sys_chan_wakeup>
+  8027ce:	83 c4 10             	add    $0x10,%esp
+}
+  8027d1:	c9                   	leave
+  8027d2:	c3                   	ret
+
+008027d3 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd)
+{
+  8027d3:	55                   	push   %ebp
+  8027d4:	89 e5                	mov    %esp,%ebp
+  8027d6:	57                   	push   %edi
+  8027d7:	56                   	push   %esi
+  8027d8:	53                   	push   %ebx
+  8027d9:	83 ec 18             	sub    $0x18,%esp
+  8027dc:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Pipe *p = (struct Pipe*)fd2data(fd);
+  8027df:	57                   	push   %edi
+  8027e0:	e8 45 ef ff ff       	call   80172a <fd2data>
+  8027e5:	89 c6                	mov    %eax,%esi
+  int i;
+
+  if (p->p_bulk) {
+  8027e7:	83 c4 10             	add    $0x10,%esp
+  8027ea:	83 78 28 00          	cmpl   $0x0,0x28(%eax)
+  8027ee:	74 2a                	je     80281a <devpipe_close+0x47>
+  8027f0:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (i = 0; i < PIPERINGPAGES; i++)
+      (void)sys_page_unmap(0, pipe_ring(fd) + i*PGSIZE);
+  8027f5:	89 f8                	mov    %edi,%eax
+  8027f7:	e8 4f ff ff ff       	call   80274b <pipe_ring>
+  8027fc:	83 ec 08             	sub    $0x8,%esp
+  8027ff:	01 d8                	add    %ebx,%eax
+  802801:	50                   	push   %eax
+  802802:	6a 00                	push   $0x0
+  802804:	e8 b3 e6 ff ff       	call   800ebc <sys_page_unmap>
+    for (i = 0; i < PIPERINGPAGES; i++)
+  802809:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  80280f:	83 c4 10             	add    $0x10,%esp
+  802812:	81 fb 00 80 00 00    	cmp    $0x8000,%ebx
+  802818:	75 db                	jne    8027f5 <devpipe_close+0x22>
+  }
+  (void)sys_page_unmap(0, fd);
+  80281a:	83 ec 08             	sub    $0x8,%esp
+  80281d:	57                   	push   %edi
+  80281e:	6a 00                	push   $0x0
+  802820:	e8 97 e6 ff ff       	call   800ebc <sys_page_unmap>
+  // let sleepers on the other end notice we're gone
+  if (p->p_bulk) {
+  802825:	83 c4 10             	add    $0x10,%esp
+  802828:	83 7e 28 00          	cmpl   $0x0,0x28(%esi)
+  80282c:	75 13                	jne    802841 <devpipe_close+0x6e>
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  }
+  return sys_page_unmap(0, p);
+  80282e:	83 ec 08             	sub    $0x8,%esp
+  802831:	56                   	push   %esi
+  802832:	6a 00                	push   $0x0
+  802834:	e8 83 e6 ff ff       	call   800ebc <sys_page_unmap>
+}
+  802839:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80283c:	5b                   	pop    %ebx
+  80283d:	5e                   	pop    %esi
+  80283e:	5f                   	pop    %edi
+  80283f:	5d                   	pop    %ebp
+  802840:	c3                   	ret
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  802841:	8d 56 04             	lea    0x4(%esi),%edx
+  802844:	8d 46 2c             	lea    0x2c(%esi),%eax
+  802847:	e8 60 ff ff ff       	call   8027ac <pipe_wakeup>
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  80284c:	8d 46 30             	lea    0x30(%esi),%eax
+  80284f:	89 f2                	mov    %esi,%edx
+  802851:	e8 56 ff ff ff       	call   8027ac <pipe_wakeup>
+  802856:	eb d6                	jmp    80282e <devpipe_close+0x5b>
+
+00802858 <_pipeisclosed>:
+{
+  802858:	55                   	push   %ebp
+  802859:	89 e5                	mov    %esp,%ebp
+  80285b:	57                   	push   %edi
+  80285c:	56                   	push   %esi
+  80285d:	53                   	push   %ebx
+  80285e:	83 ec 1c             	sub    $0x1c,%esp
+  802861:	89 c7                	mov    %eax,%edi
+  802863:	89 d6                	mov    %edx,%esi
+    n = thisenv->env_runs;
+  802865:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  80286a:	8b 58 58             	mov    0x58(%eax),%ebx
+    ret = pageref(fd) == pageref(p);
+  80286d:	83 ec 0c             	sub    $0xc,%esp
+  802870:	57                   	push   %edi
+  802871:	e8 ea 10 00 00       	call   803960 <pageref>
+  802876:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802879:	89 34 24             	mov    %esi,(%esp)
+  80287c:	e8 df 10 00 00       	call   803960 <pageref>
+    nn = thisenv->env_runs;
+  802881:	8b 15 a0 68 80 00    	mov    0x8068a0,%edx
+  802887:	8b 4a 58             	mov    0x58(%edx),%ecx
+    if (n == nn)
+  80288a:	83 c4 10             	add    $0x10,%esp
+  80288d:	39 cb                	cmp    %ecx,%ebx
+  80288f:	74 1b                	je     8028ac <_pipeisclosed+0x54>
+    if (n != nn && ret == 1)
+  802891:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  802894:	75 cf                	jne    802865 <_pipeisclosed+0xd>
+      cprintf("pipe race avoided\n", n, thisenv->env_runs, ret);
+  802896:	8b 42 58             	mov    0x58(%edx),%eax
+  802899:	6a 01                	push   $0x1
+  80289b:	50                   	push   %eax
+  80289c:	53                   	push   %ebx
+  80289d:	68 7b 42 80 00       	push   $0x80427b
+  8028a2:	e8 73 db ff ff       	call   80041a <cprintf>
+  8028a7:	83 c4 10             	add    $0x10,%esp
+  8028aa:	eb b9                	jmp    802865 <_pipeisclosed+0xd>
+    ret = pageref(fd) == pageref(p);
+  8028ac:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+  8028af:	0f 94 c0             	sete   %al
+  8028b2:	0f b6 c0             	movzbl %al,%eax
+}
+  8028b5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8028b8:	5b                   	pop    %ebx
+  8028b9:	5e                   	pop    %esi
+  8028ba:	5f                   	pop    %edi
+  8028bb:	5d                   	pop    %ebp
+  8028bc:	c3                   	ret
+
+008028bd <devpipe_write_bulk>:
+{
+  8028bd:	55                   	push   %ebp
+  8028be:	89 e5                	mov    %esp,%ebp
+  8028c0:	57                   	push   %edi
+  8028c1:	56                   	push   %esi
+  8028c2:	53                   	push   %ebx
+  8028c3:	83 ec 1c             	sub    $0x1c,%esp
+  8028c6:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8028c9:	89 d6                	mov    %edx,%esi
+  8028cb:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  uint8_t *ring = pipe_ring(fd);
+  8028ce:	e8 78 fe ff ff       	call   80274b <pipe_ring>
+  8028d3:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for (i = 0; i < n; ) {
+  8028d6:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  8028db:	8d 46 04             	lea    0x4(%esi),%eax
+  8028de:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  8028e1:	eb 75                	jmp    802958 <devpipe_write_bulk+0x9b>
+  8028e3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8028e8:	f0 87 46 30          	lock xchg %eax,0x30(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  8028ec:	6a 64                	push   $0x64
+  8028ee:	68 00 00 c0 ee       	push   $0xeec00000
+  8028f3:	53                   	push   %ebx
+  8028f4:	56                   	push   %esi
+  8028f5:	e8 76 e8 ff ff       	call   801170 <sys_chan_sleep>
+      continue;
+  8028fa:	83 c4 10             	add    $0x10,%esp
+  8028fd:	eb 59                	jmp    802958 <devpipe_write_bulk+0x9b>
+    off = p->p_wpos % PIPERINGSIZ;
+  8028ff:	89 d1                	mov    %edx,%ecx
+  802901:	c1 f9 1f             	sar    $0x1f,%ecx
+  802904:	c1 e9 11             	shr    $0x11,%ecx
+  802907:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  80290a:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  80290f:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(rpos + PIPERINGSIZ - p->p_wpos, PIPERINGSIZ - off));
+  802911:	81 c3 00 80 00 00    	add    $0x8000,%ebx
+  802917:	29 d3                	sub    %edx,%ebx
+  802919:	ba 00 80 00 00       	mov    $0x8000,%edx
+  80291e:	29 c2                	sub    %eax,%edx
+  802920:	39 d3                	cmp    %edx,%ebx
+  802922:	0f 47 da             	cmova  %edx,%ebx
+  802925:	8b 55 08             	mov    0x8(%ebp),%edx
+  802928:	29 fa                	sub    %edi,%edx
+  80292a:	39 d3                	cmp    %edx,%ebx
+  80292c:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(ring + off, buf + i, m);
+  80292f:	83 ec 04             	sub    $0x4,%esp
+  802932:	53                   	push   %ebx
+  802933:	8b 4d dc             	mov    -0x24(%ebp),%ecx
+  802936:	8d 14 39             	lea    (%ecx,%edi,1),%edx
+  802939:	52                   	push   %edx
+  80293a:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  80293d:	01 c8                	add    %ecx,%eax
+  80293f:	50                   	push   %eax
+  802940:	e8 ab e2 ff ff       	call   800bf0 <memcpy>
+    i += m;
+  802945:	01 df                	add    %ebx,%edi
+    p->p_wpos += m;
+  802947:	01 5e 04             	add    %ebx,0x4(%esi)
+    pipe_wakeup(&p->p_rsleep, &p->p_wpos);
+  80294a:	8d 46 2c             	lea    0x2c(%esi),%eax
+  80294d:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  802950:	e8 57 fe ff ff       	call   8027ac <pipe_wakeup>
+  802955:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802958:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  80295b:	73 2b                	jae    802988 <devpipe_write_bulk+0xcb>
+    rpos = p->p_rpos;
+  80295d:	8b 1e                	mov    (%esi),%ebx
+    if (p->p_wpos >= rpos + PIPERINGSIZ) {
+  80295f:	8b 56 04             	mov    0x4(%esi),%edx
+  802962:	8d 83 ff 7f 00 00    	lea    0x7fff(%ebx),%eax
+  802968:	39 d0                	cmp    %edx,%eax
+  80296a:	7d 93                	jge    8028ff <devpipe_write_bulk+0x42>
+      if (_pipeisclosed(fd, p))
+  80296c:	89 f2                	mov    %esi,%edx
+  80296e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802971:	e8 e2 fe ff ff       	call   802858 <_pipeisclosed>
+  802976:	85 c0                	test   %eax,%eax
+  802978:	0f 84 65 ff ff ff    	je     8028e3 <devpipe_write_bulk+0x26>
+        return i;
+  80297e:	89 f8                	mov    %edi,%eax
+}
+  802980:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802983:	5b                   	pop    %ebx
+  802984:	5e                   	pop    %esi
+  802985:	5f                   	pop    %edi
+  802986:	5d                   	pop    %ebp
+  802987:	c3                   	ret
+  return i;
+  802988:	89 f8                	mov    %edi,%eax
+  80298a:	eb f4                	jmp    802980 <devpipe_write_bulk+0xc3>
+
+0080298c <devpipe_write>:
+{
+  80298c:	55                   	push   %ebp
+  80298d:	89 e5                	mov    %esp,%ebp
+  80298f:	57                   	push   %edi
+  802990:	56                   	push   %esi
+  802991:	53                   	push   %ebx
+  802992:	83 ec 28             	sub    $0x28,%esp
+  802995:	8b 75 08             	mov    0x8(%ebp),%esi
+  p = (struct Pipe*)fd2data(fd);
+  802998:	56                   	push   %esi
+  802999:	e8 8c ed ff ff       	call   80172a <fd2data>
+  80299e:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  8029a0:	8b 78 28             	mov    0x28(%eax),%edi
+  8029a3:	83 c4 10             	add    $0x10,%esp
+  8029a6:	85 ff                	test   %edi,%edi
+  8029a8:	75 25                	jne    8029cf <devpipe_write+0x43>
+  for (i = 0; i < n; i++) {
+  8029aa:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  8029ad:	74 66                	je     802a15 <devpipe_write+0x89>
+    while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) {
+  8029af:	8b 43 04             	mov    0x4(%ebx),%eax
+  8029b2:	8b 0b                	mov    (%ebx),%ecx
+  8029b4:	8d 51 20             	lea    0x20(%ecx),%edx
+  8029b7:	39 d0                	cmp    %edx,%eax
+  8029b9:	72 2b                	jb     8029e6 <devpipe_write+0x5a>
+      if (_pipeisclosed(fd, p))
+  8029bb:	89 da                	mov    %ebx,%edx
+  8029bd:	89 f0                	mov    %esi,%eax
+  8029bf:	e8 94 fe ff ff       	call   802858 <_pipeisclosed>
+  8029c4:	85 c0                	test   %eax,%eax
+  8029c6:	75 51                	jne    802a19 <devpipe_write+0x8d>
+      sys_yield();
+  8029c8:	e8 08 e4 ff ff       	call   800dd5 <sys_yield>
+  8029cd:	eb e0                	jmp    8029af <devpipe_write+0x23>
+    return devpipe_write_bulk(fd, p, vbuf, n);
+  8029cf:	83 ec 0c             	sub    $0xc,%esp
+  8029d2:	ff 75 10             	push   0x10(%ebp)
+  8029d5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8029d8:	89 c2                	mov    %eax,%edx
+  8029da:	89 f0                	mov    %esi,%eax
+  8029dc:	e8 dc fe ff ff       	call   8028bd <devpipe_write_bulk>
+  8029e1:	83 c4 10             	add    $0x10,%esp
+  8029e4:	eb 38                	jmp    802a1e <devpipe_write+0x92>
+    p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8029e6:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  8029e9:	0f b6 0c 39          	movzbl (%ecx,%edi,1),%ecx
+  8029ed:	88 4d e7             	mov    %cl,-0x19(%ebp)
+  8029f0:	89 c2                	mov    %eax,%edx
+  8029f2:	c1 fa 1f             	sar    $0x1f,%edx
+  8029f5:	89 d1                	mov    %edx,%ecx
+  8029f7:	c1 e9 1b             	shr    $0x1b,%ecx
+  8029fa:	8d 14 08             	lea    (%eax,%ecx,1),%edx
+  8029fd:	83 e2 1f             	and    $0x1f,%edx
+  802a00:	29 ca                	sub    %ecx,%edx
+  802a02:	0f b6 4d e7          	movzbl -0x19(%ebp),%ecx
+  802a06:	88 4c 13 08          	mov    %cl,0x8(%ebx,%edx,1)
+    p->p_wpos++;
+  802a0a:	83 c0 01             	add    $0x1,%eax
+  802a0d:	89 43 04             	mov    %eax,0x4(%ebx)
+  for (i = 0; i < n; i++) {
+  802a10:	83 c7 01             	add    $0x1,%edi
+  802a13:	eb 95                	jmp    8029aa <devpipe_write+0x1e>
+  return i;
+  802a15:	89 f8                	mov    %edi,%eax
+  802a17:	eb 05                	jmp    802a1e <devpipe_write+0x92>
+        return 0;
+  802a19:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a1e:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802a21:	5b                   	pop    %ebx
+  802a22:	5e                   	pop    %esi
+  802a23:	5f                   	pop    %edi
+  802a24:	5d                   	pop    %ebp
+  802a25:	c3                   	ret
+
+00802a26 <devpipe_read_bulk>:
+{
+  802a26:	55                   	push   %ebp
+  802a27:	89 e5                	mov    %esp,%ebp
+  802a29:	57                   	push   %edi
+  802a2a:	56                   	push   %esi
+  802a2b:	53                   	push   %ebx
+  802a2c:	83 ec 2c             	sub    $0x2c,%esp
+  802a2f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  802a32:	89 d6                	mov    %edx,%esi
+  802a34:	89 4d dc             	mov    %ecx,-0x24(%ebp)
+  802a37:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  uint8_t *ring = pipe_ring(fd);
+  802a3a:	e8 0c fd ff ff       	call   80274b <pipe_ring>
+  802a3f:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  for (i = 0; i < n; ) {
+  802a42:	85 db                	test   %ebx,%ebx
+  802a44:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  802a49:	0f 45 c3             	cmovne %ebx,%eax
+  802a4c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802a4f:	bf 00 00 00 00       	mov    $0x0,%edi
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802a54:	8d 46 30             	lea    0x30(%esi),%eax
+  802a57:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  for (i = 0; i < n; ) {
+  802a5a:	eb 50                	jmp    802aac <devpipe_read_bulk+0x86>
+    off = p->p_rpos % PIPERINGSIZ;
+  802a5c:	89 d1                	mov    %edx,%ecx
+  802a5e:	c1 f9 1f             	sar    $0x1f,%ecx
+  802a61:	c1 e9 11             	shr    $0x11,%ecx
+  802a64:	8d 04 0a             	lea    (%edx,%ecx,1),%eax
+  802a67:	25 ff 7f 00 00       	and    $0x7fff,%eax
+  802a6c:	29 c8                	sub    %ecx,%eax
+    m = MIN(n - i, MIN(wpos - p->p_rpos, PIPERINGSIZ - off));
+  802a6e:	29 d3                	sub    %edx,%ebx
+  802a70:	ba 00 80 00 00       	mov    $0x8000,%edx
+  802a75:	29 c2                	sub    %eax,%edx
+  802a77:	39 d3                	cmp    %edx,%ebx
+  802a79:	0f 47 da             	cmova  %edx,%ebx
+  802a7c:	8b 55 08             	mov    0x8(%ebp),%edx
+  802a7f:	29 fa                	sub    %edi,%edx
+  802a81:	39 d3                	cmp    %edx,%ebx
+  802a83:	0f 47 da             	cmova  %edx,%ebx
+    memcpy(buf + i, ring + off, m);
+  802a86:	83 ec 04             	sub    $0x4,%esp
+  802a89:	53                   	push   %ebx
+  802a8a:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  802a8d:	01 c8                	add    %ecx,%eax
+  802a8f:	50                   	push   %eax
+  802a90:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  802a93:	01 f8                	add    %edi,%eax
+  802a95:	50                   	push   %eax
+  802a96:	e8 55 e1 ff ff       	call   800bf0 <memcpy>
+    i += m;
+  802a9b:	01 df                	add    %ebx,%edi
+    p->p_rpos += m;
+  802a9d:	01 1e                	add    %ebx,(%esi)
+    pipe_wakeup(&p->p_wsleep, &p->p_rpos);
+  802a9f:	89 f2                	mov    %esi,%edx
+  802aa1:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  802aa4:	e8 03 fd ff ff       	call   8027ac <pipe_wakeup>
+  802aa9:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < n; ) {
+  802aac:	3b 7d 08             	cmp    0x8(%ebp),%edi
+  802aaf:	73 51                	jae    802b02 <devpipe_read_bulk+0xdc>
+    wpos = p->p_wpos;
+  802ab1:	8b 5e 04             	mov    0x4(%esi),%ebx
+    if (wpos == p->p_rpos) {
+  802ab4:	8b 16                	mov    (%esi),%edx
+  802ab6:	39 da                	cmp    %ebx,%edx
+  802ab8:	75 a2                	jne    802a5c <devpipe_read_bulk+0x36>
+      if (i > 0)
+  802aba:	85 ff                	test   %edi,%edi
+  802abc:	75 44                	jne    802b02 <devpipe_read_bulk+0xdc>
+      if (_pipeisclosed(fd, p))
+  802abe:	89 f2                	mov    %esi,%edx
+  802ac0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802ac3:	e8 90 fd ff ff       	call   802858 <_pipeisclosed>
+  802ac8:	85 c0                	test   %eax,%eax
+  802aca:	75 3a                	jne    802b06 <devpipe_read_bulk+0xe0>
+  802acc:	b8 01 00 00 00       	mov    $0x1,%eax
+  802ad1:	f0 87 46 2c          	lock xchg %eax,0x2c(%esi)
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802ad5:	6a 64                	push   $0x64
+  802ad7:	ff 75 d4             	push   -0x2c(%ebp)
+  802ada:	53                   	push   %ebx
+      perm = pipe_sleep(&p->p_rsleep, &p->p_wpos, wpos, dstva);
+  802adb:	8d 46 04             	lea    0x4(%esi),%eax
+  r = sys_chan_sleep(pos, val, dstva ? dstva : (void*) UTOP, PIPESLEEPMS);
+  802ade:	50                   	push   %eax
+  802adf:	e8 8c e6 ff ff       	call   801170 <sys_chan_sleep>
+  return r < 0 ? 0 : r;
+  802ae4:	85 c0                	test   %eax,%eax
+  802ae6:	ba 00 00 00 00       	mov    $0x0,%edx
+  802aeb:	0f 48 c2             	cmovs  %edx,%eax
+      if (perm & PTE_P)
+  802aee:	83 c4 10             	add    $0x10,%esp
+  802af1:	a8 01                	test   $0x1,%al
+  802af3:	74 b7                	je     802aac <devpipe_read_bulk+0x86>
+        return PGSIZE;
+  802af5:	b8 00 10 00 00       	mov    $0x1000,%eax
+}
+  802afa:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802afd:	5b                   	pop    %ebx
+  802afe:	5e                   	pop    %esi
+  802aff:	5f                   	pop    %edi
+  802b00:	5d                   	pop    %ebp
+  802b01:	c3                   	ret
+  return i;
+  802b02:	89 f8                	mov    %edi,%eax
+  802b04:	eb f4                	jmp    802afa <devpipe_read_bulk+0xd4>
+        return 0;
+  802b06:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b0b:	eb ed                	jmp    802afa <devpipe_read_bulk+0xd4>
+
+00802b0d <devpipe_read>:
+{
+  802b0d:	55                   	push   %ebp
+  802b0e:	89 e5                	mov    %esp,%ebp
+  802b10:	57                   	push   %edi
+  802b11:	56                   	push   %esi
+  802b12:	53                   	push   %ebx
+  802b13:	83 ec 18             	sub    $0x18,%esp
+  802b16:	8b 7d 08             	mov    0x8(%ebp),%edi
+  p = (struct Pipe*)fd2data(fd);
+  802b19:	57                   	push   %edi
+  802b1a:	e8 0b ec ff ff       	call   80172a <fd2data>
+  802b1f:	89 c3                	mov    %eax,%ebx
+  if (p->p_bulk)
+  802b21:	8b 70 28             	mov    0x28(%eax),%esi
+  802b24:	83 c4 10             	add    $0x10,%esp
+  802b27:	85 f6                	test   %esi,%esi
+  802b29:	75 24                	jne    802b4f <devpipe_read+0x42>
+  for (i = 0; i < n; i++) {
+  802b2b:	3b 75 10             	cmp    0x10(%ebp),%esi
+  802b2e:	74 60                	je     802b90 <devpipe_read+0x83>
+    while (p->p_rpos == p->p_wpos) {
+  802b30:	8b 03                	mov    (%ebx),%eax
+  802b32:	3b 43 04             	cmp    0x4(%ebx),%eax
+  802b35:	75 3b                	jne    802b72 <devpipe_read+0x65>
+      if (i > 0)
+  802b37:	85 f6                	test   %esi,%esi
+  802b39:	75 2d                	jne    802b68 <devpipe_read+0x5b>
+      if (_pipeisclosed(fd, p))
+  802b3b:	89 da                	mov    %ebx,%edx
+  802b3d:	89 f8                	mov    %edi,%eax
+  802b3f:	e8 14 fd ff ff       	call   802858 <_pipeisclosed>
+  802b44:	85 c0                	test   %eax,%eax
+  802b46:	75 4c                	jne    802b94 <devpipe_read+0x87>
+      sys_yield();
+  802b48:	e8 88 e2 ff ff       	call   800dd5 <sys_yield>
+  802b4d:	eb e1                	jmp    802b30 <devpipe_read+0x23>
+    return devpipe_read_bulk(fd, p, vbuf, n, NULL);
+  802b4f:	83 ec 08             	sub    $0x8,%esp
+  802b52:	6a 00                	push   $0x0
+  802b54:	ff 75 10             	push   0x10(%ebp)
+  802b57:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802b5a:	89 c2                	mov    %eax,%edx
+  802b5c:	89 f8                	mov    %edi,%eax
+  802b5e:	e8 c3 fe ff ff       	call   802a26 <devpipe_read_bulk>
+  802b63:	83 c4 10             	add    $0x10,%esp
+  802b66:	eb 02                	jmp    802b6a <devpipe_read+0x5d>
+        return i;
+  802b68:	89 f0                	mov    %esi,%eax
+}
+  802b6a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802b6d:	5b                   	pop    %ebx
+  802b6e:	5e                   	pop    %esi
+  802b6f:	5f                   	pop    %edi
+  802b70:	5d                   	pop    %ebp
+  802b71:	c3                   	ret
+    buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802b72:	99                   	cltd
+  802b73:	c1 ea 1b             	shr    $0x1b,%edx
+  802b76:	01 d0                	add    %edx,%eax
+  802b78:	83 e0 1f             	and    $0x1f,%eax
+  802b7b:	29 d0                	sub    %edx,%eax
+  802b7d:	0f b6 44 03 08       	movzbl 0x8(%ebx,%eax,1),%eax
+  802b82:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  802b85:	88 04 31             	mov    %al,(%ecx,%esi,1)
+    p->p_rpos++;
+  802b88:	83 03 01             	addl   $0x1,(%ebx)
+  for (i = 0; i < n; i++) {
+  802b8b:	83 c6 01             	add    $0x1,%esi
+  802b8e:	eb 9b                	jmp    802b2b <devpipe_read+0x1e>
+  return i;
+  802b90:	89 f0                	mov    %esi,%eax
+  802b92:	eb d6                	jmp    802b6a <devpipe_read+0x5d>
+        return 0;
+  802b94:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b99:	eb cf                	jmp    802b6a <devpipe_read+0x5d>
+
+00802b9b <pipe2>:
+{
+  802b9b:	55                   	push   %ebp
+  802b9c:	89 e5                	mov    %esp,%ebp
+  802b9e:	57                   	push   %edi
+  802b9f:	56                   	push   %esi
+  802ba0:	53                   	push   %ebx
+  802ba1:	83 ec 28             	sub    $0x28,%esp
+  if ((r = fd_alloc(&fd0)) < 0
+  802ba4:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802ba7:	50                   	push   %eax
+  802ba8:	e8 91 eb ff ff       	call   80173e <fd_alloc>
+  802bad:	89 c3                	mov    %eax,%ebx
+  802baf:	83 c4 10             	add    $0x10,%esp
+  802bb2:	85 c0                	test   %eax,%eax
+  802bb4:	0f 88 fb 01 00 00    	js     802db5 <pipe2+0x21a>
+      || (r = sys_page_alloc(0, fd0, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802bba:	83 ec 04             	sub    $0x4,%esp
+  802bbd:	68 07 04 00 00       	push   $0x407
+  802bc2:	ff 75 e4             	push   -0x1c(%ebp)
+  802bc5:	6a 00                	push   $0x0
+  802bc7:	e8 6b e2 ff ff       	call   800e37 <sys_page_alloc>
+  802bcc:	89 c3                	mov    %eax,%ebx
+  802bce:	83 c4 10             	add    $0x10,%esp
+  802bd1:	85 c0                	test   %eax,%eax
+  802bd3:	0f 88 dc 01 00 00    	js     802db5 <pipe2+0x21a>
+  if ((r = fd_alloc(&fd1)) < 0
+  802bd9:	83 ec 0c             	sub    $0xc,%esp
+  802bdc:	8d 45 e0             	lea    -0x20(%ebp),%eax
+  802bdf:	50                   	push   %eax
+  802be0:	e8 59 eb ff ff       	call   80173e <fd_alloc>
+  802be5:	89 c3                	mov    %eax,%ebx
+  802be7:	83 c4 10             	add    $0x10,%esp
+  802bea:	85 c0                	test   %eax,%eax
+  802bec:	0f 88 b3 01 00 00    	js     802da5 <pipe2+0x20a>
+      || (r = sys_page_alloc(0, fd1, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802bf2:	83 ec 04             	sub    $0x4,%esp
+  802bf5:	68 07 04 00 00       	push   $0x407
+  802bfa:	ff 75 e0             	push   -0x20(%ebp)
+  802bfd:	6a 00                	push   $0x0
+  802bff:	e8 33 e2 ff ff       	call   800e37 <sys_page_alloc>
+  802c04:	89 c3                	mov    %eax,%ebx
+  802c06:	83 c4 10             	add    $0x10,%esp
+  802c09:	85 c0                	test   %eax,%eax
+  802c0b:	0f 88 94 01 00 00    	js     802da5 <pipe2+0x20a>
+  va = fd2data(fd0);
+  802c11:	83 ec 0c             	sub    $0xc,%esp
+  802c14:	ff 75 e4             	push   -0x1c(%ebp)
+  802c17:	e8 0e eb ff ff       	call   80172a <fd2data>
+  802c1c:	89 c7                	mov    %eax,%edi
+  if ((r = sys_page_alloc(0, va, PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802c1e:	83 c4 0c             	add    $0xc,%esp
+  802c21:	68 07 04 00 00       	push   $0x407
+  802c26:	50                   	push   %eax
+  802c27:	6a 00                	push   $0x0
+  802c29:	e8 09 e2 ff ff       	call   800e37 <sys_page_alloc>
+  802c2e:	89 c3                	mov    %eax,%ebx
+  802c30:	83 c4 10             	add    $0x10,%esp
+  802c33:	85 c0                	test   %eax,%eax
+  802c35:	0f 88 5a 01 00 00    	js     802d95 <pipe2+0x1fa>
+  if ((r = sys_page_map(0, va, 0, fd2data(fd1), PTE_P|PTE_W|PTE_U|PTE_SHARE)) < 0)
+  802c3b:	83 ec 0c             	sub    $0xc,%esp
+  802c3e:	ff 75 e0             	push   -0x20(%ebp)
+  802c41:	e8 e4 ea ff ff       	call   80172a <fd2data>
+  802c46:	c7 04 24 07 04 00 00 	movl   $0x407,(%esp)
+  802c4d:	50                   	push   %eax
+  802c4e:	6a 00                	push   $0x0
+  802c50:	57                   	push   %edi
+  802c51:	6a 00                	push   $0x0
+  802c53:	e8 22 e2 ff ff       	call   800e7a <sys_page_map>
+  802c58:	89 c3                	mov    %eax,%ebx
+  802c5a:	83 c4 20             	add    $0x20,%esp
+  802c5d:	85 c0                	test   %eax,%eax
+  802c5f:	0f 88 22 01 00 00    	js     802d87 <pipe2+0x1ec>
+  if (mode & PIPE_BULK) {
+  802c65:	f6 45 0c 01          	testb  $0x1,0xc(%ebp)
+  802c69:	74 72                	je     802cdd <pipe2+0x142>
+  802c6b:	be 00 00 00 00       	mov    $0x0,%esi
+      if ((r = sys_page_alloc(0, pipe_ring(fd0) + i*PGSIZE,
+  802c70:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802c73:	e8 d3 fa ff ff       	call   80274b <pipe_ring>
+  802c78:	83 ec 04             	sub    $0x4,%esp
+  802c7b:	68 07 04 00 00       	push   $0x407
+  802c80:	01 f0                	add    %esi,%eax
+  802c82:	50                   	push   %eax
+  802c83:	6a 00                	push   $0x0
+  802c85:	e8 ad e1 ff ff       	call   800e37 <sys_page_alloc>
+  802c8a:	89 c3                	mov    %eax,%ebx
+  802c8c:	83 c4 10             	add    $0x10,%esp
+  802c8f:	85 c0                	test   %eax,%eax
+  802c91:	0f 88 97 00 00 00    	js     802d2e <pipe2+0x193>
+                               0, pipe_ring(fd1) + i*PGSIZE,
+  802c97:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802c9a:	e8 ac fa ff ff       	call   80274b <pipe_ring>
+  802c9f:	8d 1c 30             	lea    (%eax,%esi,1),%ebx
+          || (r = sys_page_map(0, pipe_ring(fd0) + i*PGSIZE,
+  802ca2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802ca5:	e8 a1 fa ff ff       	call   80274b <pipe_ring>
+  802caa:	83 ec 0c             	sub    $0xc,%esp
+  802cad:	68 07 04 00 00       	push   $0x407
+  802cb2:	53                   	push   %ebx
+  802cb3:	6a 00                	push   $0x0
+  802cb5:	01 f0                	add    %esi,%eax
+  802cb7:	50                   	push   %eax
+  802cb8:	6a 00                	push   $0x0
+  802cba:	e8 bb e1 ff ff       	call   800e7a <sys_page_map>
+  802cbf:	89 c3                	mov    %eax,%ebx
+  802cc1:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802cc7:	83 c4 20             	add    $0x20,%esp
+  802cca:	85 c0                	test   %eax,%eax
+  802ccc:	78 60                	js     802d2e <pipe2+0x193>
+    for (i = 0; i < PIPERINGPAGES; i++) {
+  802cce:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802cd4:	75 9a                	jne    802c70 <pipe2+0xd5>
+    ((struct Pipe*) va)->p_bulk = 1;
+  802cd6:	c7 47 28 01 00 00 00 	movl   $0x1,0x28(%edi)
+  fd0->fd_dev_id = devpipe.dev_id;
+  802cdd:	a1 24 50 80 00       	mov    0x805024,%eax
+  802ce2:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802ce5:	89 02                	mov    %eax,(%edx)
+  fd0->fd_omode = O_RDONLY;
+  802ce7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  802cea:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%edx)
+  fd1->fd_dev_id = devpipe.dev_id;
+  802cf1:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  802cf4:	89 02                	mov    %eax,(%edx)
+  fd1->fd_omode = O_WRONLY;
+  802cf6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802cf9:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%eax)
+  pfd[0] = fd2num(fd0);
+  802d00:	83 ec 0c             	sub    $0xc,%esp
+  802d03:	ff 75 e4             	push   -0x1c(%ebp)
+  802d06:	e8 0f ea ff ff       	call   80171a <fd2num>
+  802d0b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802d0e:	89 01                	mov    %eax,(%ecx)
+  pfd[1] = fd2num(fd1);
+  802d10:	83 c4 04             	add    $0x4,%esp
+  802d13:	ff 75 e0             	push   -0x20(%ebp)
+  802d16:	e8 ff e9 ff ff       	call   80171a <fd2num>
+  802d1b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  802d1e:	89 41 04             	mov    %eax,0x4(%ecx)
+  return 0;
+  802d21:	83 c4 10             	add    $0x10,%esp
+  802d24:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d29:	e9 87 00 00 00       	jmp    802db5 <pipe2+0x21a>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802d2e:	be 00 00 00 00       	mov    $0x0,%esi
+    sys_page_unmap(0, pipe_ring(fd0) + i*PGSIZE);
+  802d33:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802d36:	e8 10 fa ff ff       	call   80274b <pipe_ring>
+  802d3b:	83 ec 08             	sub    $0x8,%esp
+  802d3e:	01 f0                	add    %esi,%eax
+  802d40:	50                   	push   %eax
+  802d41:	6a 00                	push   $0x0
+  802d43:	e8 74 e1 ff ff       	call   800ebc <sys_page_unmap>
+    sys_page_unmap(0, pipe_ring(fd1) + i*PGSIZE);
+  802d48:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  802d4b:	e8 fb f9 ff ff       	call   80274b <pipe_ring>
+  802d50:	83 c4 08             	add    $0x8,%esp
+  802d53:	01 f0                	add    %esi,%eax
+  802d55:	50                   	push   %eax
+  802d56:	6a 00                	push   $0x0
+  802d58:	e8 5f e1 ff ff       	call   800ebc <sys_page_unmap>
+  for (i = 0; i < PIPERINGPAGES; i++) {
+  802d5d:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802d63:	83 c4 10             	add    $0x10,%esp
+  802d66:	81 fe 00 80 00 00    	cmp    $0x8000,%esi
+  802d6c:	75 c5                	jne    802d33 <pipe2+0x198>
+  sys_page_unmap(0, fd2data(fd1));
+  802d6e:	83 ec 0c             	sub    $0xc,%esp
+  802d71:	ff 75 e0             	push   -0x20(%ebp)
+  802d74:	e8 b1 e9 ff ff       	call   80172a <fd2data>
+  802d79:	83 c4 08             	add    $0x8,%esp
+  802d7c:	50                   	push   %eax
+  802d7d:	6a 00                	push   $0x0
+  802d7f:	e8 38 e1 ff ff       	call   800ebc <sys_page_unmap>
+  802d84:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, va);
+  802d87:	83 ec 08             	sub    $0x8,%esp
+  802d8a:	57                   	push   %edi
+  802d8b:	6a 00                	push   $0x0
+  802d8d:	e8 2a e1 ff ff       	call   800ebc <sys_page_unmap>
+  802d92:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd1);
+  802d95:	83 ec 08             	sub    $0x8,%esp
+  802d98:	ff 75 e0             	push   -0x20(%ebp)
+  802d9b:	6a 00                	push   $0x0
+  802d9d:	e8 1a e1 ff ff       	call   800ebc <sys_page_unmap>
+  802da2:	83 c4 10             	add    $0x10,%esp
+  sys_page_unmap(0, fd0);
+  802da5:	83 ec 08             	sub    $0x8,%esp
+  802da8:	ff 75 e4             	push   -0x1c(%ebp)
+  802dab:	6a 00                	push   $0x0
+  802dad:	e8 0a e1 ff ff       	call   800ebc <sys_page_unmap>
+  802db2:	83 c4 10             	add    $0x10,%esp
+}
+  802db5:	89 d8                	mov    %ebx,%eax
+  802db7:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802dba:	5b                   	pop    %ebx
+  802dbb:	5e                   	pop    %esi
+  802dbc:	5f                   	pop    %edi
+  802dbd:	5d                   	pop    %ebp
+  802dbe:	c3                   	ret
+
+00802dbf <pipe>:
+{
+  802dbf:	55                   	push   %ebp
+  802dc0:	89 e5                	mov    %esp,%ebp
+  802dc2:	83 ec 10             	sub    $0x10,%esp
+  return pipe2(pfd, 0);
+  802dc5:	6a 00                	push   $0x0
+  802dc7:	ff 75 08             	push   0x8(%ebp)
+  802dca:	e8 cc fd ff ff       	call   802b9b <pipe2>
+}
+  802dcf:	c9                   	leave
+  802dd0:	c3                   	ret
+
+00802dd1 <pipeisclosed>:
+{
+  802dd1:	55                   	push   %ebp
+  802dd2:	89 e5                	mov    %esp,%ebp
+  802dd4:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802dd7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802dda:	50                   	push   %eax
+  802ddb:	ff 75 08             	push   0x8(%ebp)
+  802dde:	e8 b1 e9 ff ff       	call   801794 <fd_lookup>
+  802de3:	83 c4 10             	add    $0x10,%esp
+  802de6:	85 c0                	test   %eax,%eax
+  802de8:	78 18                	js     802e02 <pipeisclosed+0x31>
+  p = (struct Pipe*)fd2data(fd);
+  802dea:	83 ec 0c             	sub    $0xc,%esp
+  802ded:	ff 75 f4             	push   -0xc(%ebp)
+  802df0:	e8 35 e9 ff ff       	call   80172a <fd2data>
+  802df5:	89 c2                	mov    %eax,%edx
+  return _pipeisclosed(fd, p);
+  802df7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802dfa:	e8 59 fa ff ff       	call   802858 <_pipeisclosed>
+  802dff:	83 c4 10             	add    $0x10,%esp
+}
+  802e02:	c9                   	leave
+  802e03:	c3                   	ret
+
+00802e04 <pipe_splice>:
+{
+  802e04:	55                   	push   %ebp
+  802e05:	89 e5                	mov    %esp,%ebp
+  802e07:	57                   	push   %edi
+  802e08:	56                   	push   %esi
+  802e09:	53                   	push   %ebx
+  802e0a:	83 ec 34             	sub    $0x34,%esp
+  802e0d:	8b 75 0c             	mov    0xc(%ebp),%esi
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802e10:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  802e13:	50                   	push   %eax
+  802e14:	ff 75 08             	push   0x8(%ebp)
+  802e17:	e8 78 e9 ff ff       	call   801794 <fd_lookup>
+  802e1c:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802e1f:	83 c4 10             	add    $0x10,%esp
+  802e22:	85 c0                	test   %eax,%eax
+  802e24:	0f 88 d7 00 00 00    	js     802f01 <pipe_splice+0xfd>
+  p = (struct Pipe*)fd2data(fd);
+  802e2a:	83 ec 0c             	sub    $0xc,%esp
+  802e2d:	ff 75 e4             	push   -0x1c(%ebp)
+  802e30:	e8 f5 e8 ff ff       	call   80172a <fd2data>
+  802e35:	89 c3                	mov    %eax,%ebx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802e37:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802e3a:	83 c4 10             	add    $0x10,%esp
+  802e3d:	8b 15 24 50 80 00    	mov    0x805024,%edx
+  802e43:	39 10                	cmp    %edx,(%eax)
+  802e45:	0f 85 c1 00 00 00    	jne    802f0c <pipe_splice+0x108>
+  802e4b:	83 7b 28 00          	cmpl   $0x0,0x28(%ebx)
+  802e4f:	0f 84 c0 00 00 00    	je     802f15 <pipe_splice+0x111>
+      || (fd->fd_omode & O_ACCMODE) == O_RDONLY || PGOFF(pg))
+  802e55:	f6 40 08 03          	testb  $0x3,0x8(%eax)
+  802e59:	0f 84 bf 00 00 00    	je     802f1e <pipe_splice+0x11a>
+  802e5f:	89 f7                	mov    %esi,%edi
+  802e61:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  802e67:	0f 85 ba 00 00 00    	jne    802f27 <pipe_splice+0x123>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802e6d:	8d 43 04             	lea    0x4(%ebx),%eax
+  802e70:	89 45 d0             	mov    %eax,-0x30(%ebp)
+  802e73:	eb 38                	jmp    802ead <pipe_splice+0xa9>
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802e75:	83 ec 0c             	sub    $0xc,%esp
+  802e78:	68 00 10 00 00       	push   $0x1000
+  802e7d:	89 f1                	mov    %esi,%ecx
+  802e7f:	89 da                	mov    %ebx,%edx
+  802e81:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  802e84:	e8 34 fa ff ff       	call   8028bd <devpipe_write_bulk>
+  802e89:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802e8c:	83 c4 10             	add    $0x10,%esp
+  802e8f:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  802e94:	75 53                	jne    802ee9 <pipe_splice+0xe5>
+    sys_page_unmap(0, pg);
+  802e96:	83 ec 08             	sub    $0x8,%esp
+  802e99:	56                   	push   %esi
+  802e9a:	6a 00                	push   $0x0
+  802e9c:	e8 1b e0 ff ff       	call   800ebc <sys_page_unmap>
+  for (i = 0; i < npages; i++, pg += PGSIZE) {
+  802ea1:	83 c7 01             	add    $0x1,%edi
+  802ea4:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  802eaa:	83 c4 10             	add    $0x10,%esp
+  802ead:	3b 7d 10             	cmp    0x10(%ebp),%edi
+  802eb0:	74 3a                	je     802eec <pipe_splice+0xe8>
+    if (p->p_wpos == p->p_rpos && xchg(&p->p_rsleep, 0)
+  802eb2:	8b 03                	mov    (%ebx),%eax
+  802eb4:	39 43 04             	cmp    %eax,0x4(%ebx)
+  802eb7:	75 bc                	jne    802e75 <pipe_splice+0x71>
+  802eb9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ebe:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+  802ec2:	85 c0                	test   %eax,%eax
+  802ec4:	74 af                	je     802e75 <pipe_splice+0x71>
+        && (r = sys_chan_wakeup(&p->p_wpos, pg, PTE_P|PTE_U|PTE_W)) < 0)
+  802ec6:	83 ec 04             	sub    $0x4,%esp
+  802ec9:	6a 07                	push   $0x7
+  802ecb:	56                   	push   %esi
+  802ecc:	ff 75 d0             	push   -0x30(%ebp)
+  802ecf:	e8 bf e2 ff ff       	call   801193 <sys_chan_wakeup>
+  802ed4:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  802ed7:	83 c4 10             	add    $0x10,%esp
+  802eda:	85 c0                	test   %eax,%eax
+  802edc:	79 b8                	jns    802e96 <pipe_splice+0x92>
+  802ede:	b8 01 00 00 00       	mov    $0x1,%eax
+  802ee3:	f0 87 43 2c          	lock xchg %eax,0x2c(%ebx)
+    if (r < 0 && (r = devpipe_write_bulk(fd, p, pg, PGSIZE)) != PGSIZE)
+  802ee7:	eb 8c                	jmp    802e75 <pipe_splice+0x71>
+  802ee9:	89 7d 10             	mov    %edi,0x10(%ebp)
+  if (i == 0 && r < 0)
+  802eec:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  802ef0:	75 06                	jne    802ef8 <pipe_splice+0xf4>
+  802ef2:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+  802ef6:	78 09                	js     802f01 <pipe_splice+0xfd>
+  return i * PGSIZE;
+  802ef8:	8b 45 10             	mov    0x10(%ebp),%eax
+  802efb:	c1 e0 0c             	shl    $0xc,%eax
+  802efe:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+}
+  802f01:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  802f04:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  802f07:	5b                   	pop    %ebx
+  802f08:	5e                   	pop    %esi
+  802f09:	5f                   	pop    %edi
+  802f0a:	5d                   	pop    %ebp
+  802f0b:	c3                   	ret
+    return -E_INVAL;
+  802f0c:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802f13:	eb ec                	jmp    802f01 <pipe_splice+0xfd>
+  802f15:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802f1c:	eb e3                	jmp    802f01 <pipe_splice+0xfd>
+  802f1e:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802f25:	eb da                	jmp    802f01 <pipe_splice+0xfd>
+  802f27:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  802f2e:	eb d1                	jmp    802f01 <pipe_splice+0xfd>
+
+00802f30 <pipe_splice_read>:
+{
+  802f30:	55                   	push   %ebp
+  802f31:	89 e5                	mov    %esp,%ebp
+  802f33:	53                   	push   %ebx
+  802f34:	83 ec 1c             	sub    $0x1c,%esp
+  802f37:	8b 5d 0c             	mov    0xc(%ebp),%ebx
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  802f3a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  802f3d:	50                   	push   %eax
+  802f3e:	ff 75 08             	push   0x8(%ebp)
+  802f41:	e8 4e e8 ff ff       	call   801794 <fd_lookup>
+  802f46:	83 c4 10             	add    $0x10,%esp
+  802f49:	85 c0                	test   %eax,%eax
+  802f4b:	78 49                	js     802f96 <pipe_splice_read+0x66>
+  p = (struct Pipe*)fd2data(fd);
+  802f4d:	83 ec 0c             	sub    $0xc,%esp
+  802f50:	ff 75 f4             	push   -0xc(%ebp)
+  802f53:	e8 d2 e7 ff ff       	call   80172a <fd2data>
+  802f58:	89 c2                	mov    %eax,%edx
+  if (fd->fd_dev_id != devpipe.dev_id || !p->p_bulk
+  802f5a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  802f5d:	83 c4 10             	add    $0x10,%esp
+  802f60:	8b 0d 24 50 80 00    	mov    0x805024,%ecx
+  802f66:	39 08                	cmp    %ecx,(%eax)
+  802f68:	75 31                	jne    802f9b <pipe_splice_read+0x6b>
+  802f6a:	83 7a 28 00          	cmpl   $0x0,0x28(%edx)
+  802f6e:	74 32                	je     802fa2 <pipe_splice_read+0x72>
+      || (fd->fd_omode & O_ACCMODE) == O_WRONLY || PGOFF(pg))
+  802f70:	8b 48 08             	mov    0x8(%eax),%ecx
+  802f73:	83 e1 03             	and    $0x3,%ecx
+  802f76:	83 f9 01             	cmp    $0x1,%ecx
+  802f79:	74 2e                	je     802fa9 <pipe_splice_read+0x79>
+  802f7b:	f7 c3 ff 0f 00 00    	test   $0xfff,%ebx
+  802f81:	75 2d                	jne    802fb0 <pipe_splice_read+0x80>
+  return devpipe_read_bulk(fd, p, pg, PGSIZE, pg);
+  802f83:	83 ec 08             	sub    $0x8,%esp
+  802f86:	53                   	push   %ebx
+  802f87:	68 00 10 00 00       	push   $0x1000
+  802f8c:	89 d9                	mov    %ebx,%ecx
+  802f8e:	e8 93 fa ff ff       	call   802a26 <devpipe_read_bulk>
+  802f93:	83 c4 10             	add    $0x10,%esp
+}
+  802f96:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  802f99:	c9                   	leave
+  802f9a:	c3                   	ret
+    return -E_INVAL;
+  802f9b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802fa0:	eb f4                	jmp    802f96 <pipe_splice_read+0x66>
+  802fa2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802fa7:	eb ed                	jmp    802f96 <pipe_splice_read+0x66>
+  802fa9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802fae:	eb e6                	jmp    802f96 <pipe_splice_read+0x66>
+  802fb0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802fb5:	eb df                	jmp    802f96 <pipe_splice_read+0x66>
+
+00802fb7 <wait>:
+#include <inc/lib.h>
+
+// Waits until 'envid' exits.
+void
+wait(envid_t envid)
+{
+  802fb7:	55                   	push   %ebp
+  802fb8:	89 e5                	mov    %esp,%ebp
+  802fba:	56                   	push   %esi
+  802fbb:	53                   	push   %ebx
+  802fbc:	8b 75 08             	mov    0x8(%ebp),%esi
+  const volatile struct Env *e;
+
+  assert(envid != 0);
+  802fbf:	85 f6                	test   %esi,%esi
+  802fc1:	74 15                	je     802fd8 <wait+0x21>
+  e = &envs[ENVX(envid)];
+  802fc3:	89 f0                	mov    %esi,%eax
+  802fc5:	25 ff 03 00 00       	and    $0x3ff,%eax
+  while (e->env_id == envid && e->env_status != ENV_FREE)
+  802fca:	8d 1c c0             	lea    (%eax,%eax,8),%ebx
+  802fcd:	c1 e3 04             	shl    $0x4,%ebx
+  802fd0:	81 c3 00 00 c0 ee    	add    $0xeec00000,%ebx
+  802fd6:	eb 1b                	jmp    802ff3 <wait+0x3c>
+  assert(envid != 0);
+  802fd8:	68 93 42 80 00       	push   $0x804293
+  802fdd:	68 24 42 80 00       	push   $0x804224
+  802fe2:	6a 09                	push   $0x9
+  802fe4:	68 9e 42 80 00       	push   $0x80429e
+  802fe9:	e8 51 d3 ff ff       	call   80033f <_panic>
+    sys_yield();
+  802fee:	e8 e2 dd ff ff       	call   800dd5 <sys_yield>
+  while (e->env_id == envid && e->env_status != ENV_FREE)
+  802ff3:	8b 43 48             	mov    0x48(%ebx),%eax
+  802ff6:	39 f0                	cmp    %esi,%eax
+  802ff8:	75 07                	jne    803001 <wait+0x4a>
+  802ffa:	8b 43 54             	mov    0x54(%ebx),%eax
+  802ffd:	85 c0                	test   %eax,%eax
+  802fff:	75 ed                	jne    802fee <wait+0x37>
+}
+  803001:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803004:	5b                   	pop    %ebx
+  803005:	5e                   	pop    %esi
+  803006:	5d                   	pop    %ebp
+  803007:	c3                   	ret
+
+00803008 <mmap_find>:
+          utf->utf_eip, utf->utf_err);
+}
+
+static struct Mmap *
+mmap_find(uintptr_t va)
+{
+  803008:	55                   	push   %ebp
+  803009:	89 e5                	mov    %esp,%ebp
+  80300b:	56                   	push   %esi
+  80300c:	53                   	push   %ebx
+  int i;
+
+  for (i = 0; i < NMMAP; i++)
+  80300d:	ba 60 67 80 00       	mov    $0x806760,%edx
+  803012:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803017:	eb 0b                	jmp    803024 <mmap_find+0x1c>
+  803019:	83 c3 01             	add    $0x1,%ebx
+  80301c:	83 c2 14             	add    $0x14,%edx
+  80301f:	83 fb 10             	cmp    $0x10,%ebx
+  803022:	74 1d                	je     803041 <mmap_find+0x39>
+    if (mmaps[i].mm_va && va >= mmaps[i].mm_va &&
+  803024:	8b 0a                	mov    (%edx),%ecx
+  803026:	39 c8                	cmp    %ecx,%eax
+  803028:	72 ef                	jb     803019 <mmap_find+0x11>
+  80302a:	85 c9                	test   %ecx,%ecx
+  80302c:	74 eb                	je     803019 <mmap_find+0x11>
+        va < mmaps[i].mm_va + mmaps[i].mm_len)
+  80302e:	03 4a 04             	add    0x4(%edx),%ecx
+    if (mmaps[i].mm_va && va >= mmaps[i].mm_va &&
+  803031:	39 c8                	cmp    %ecx,%eax
+  803033:	73 e4                	jae    803019 <mmap_find+0x11>
+      return &mmaps[i];
+  803035:	8d 04 9b             	lea    (%ebx,%ebx,4),%eax
+  803038:	8d 04 85 60 67 80 00 	lea    0x806760(,%eax,4),%eax
+  80303f:	eb 05                	jmp    803046 <mmap_find+0x3e>
+  return NULL;
+  803041:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803046:	5b                   	pop    %ebx
+  803047:	5e                   	pop    %esi
+  803048:	5d                   	pop    %ebp
+  803049:	c3                   	ret
+
+0080304a <va_mapped>:
+
+static bool
+va_mapped(uintptr_t va)
+{
+  return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+  80304a:	89 c2                	mov    %eax,%edx
+  80304c:	c1 ea 16             	shr    $0x16,%edx
+  80304f:	8b 14 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%edx
+  803056:	f6 c2 01             	test   $0x1,%dl
+  803059:	74 11                	je     80306c <va_mapped+0x22>
+  80305b:	c1 e8 0c             	shr    $0xc,%eax
+  80305e:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  803065:	83 e0 01             	and    $0x1,%eax
+  803068:	83 e0 01             	and    $0x1,%eax
+}
+  80306b:	c3                   	ret
+  return (uvpd[PDX(va)] & PTE_P) && (uvpt[PGNUM(va)] & PTE_P);
+  80306c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803071:	eb f5                	jmp    803068 <va_mapped+0x1e>
+
+00803073 <mmap_copy>:
+
+// Replace the page at 'va' with a copy of its first 'n' bytes, the rest
+// zeroed, mapped with 'perm'.
+static void
+mmap_copy(uintptr_t va, size_t n, int perm)
+{
+  803073:	55                   	push   %ebp
+  803074:	89 e5                	mov    %esp,%ebp
+  803076:	57                   	push   %edi
+  803077:	56                   	push   %esi
+  803078:	53                   	push   %ebx
+  803079:	83 ec 10             	sub    $0x10,%esp
+  80307c:	89 c3                	mov    %eax,%ebx
+  80307e:	89 d7                	mov    %edx,%edi
+  803080:	89 ce                	mov    %ecx,%esi
+  int r;
+
+  if ((r = sys_page_alloc(0, PFTEMP, PTE_P | PTE_U | PTE_W)) < 0)
+  803082:	6a 07                	push   $0x7
+  803084:	68 00 f0 7f 00       	push   $0x7ff000
+  803089:	6a 00                	push   $0x0
+  80308b:	e8 a7 dd ff ff       	call   800e37 <sys_page_alloc>
+  803090:	83 c4 10             	add    $0x10,%esp
+  803093:	85 c0                	test   %eax,%eax
+  803095:	78 46                	js     8030dd <mmap_copy+0x6a>
+    panic("mmap: %e", r);
+  memmove(PFTEMP, (void *) va, n);
+  803097:	83 ec 04             	sub    $0x4,%esp
+  80309a:	57                   	push   %edi
+  80309b:	53                   	push   %ebx
+  80309c:	68 00 f0 7f 00       	push   $0x7ff000
+  8030a1:	e8 e8 da ff ff       	call   800b8e <memmove>
+  if ((r = sys_page_map(0, PFTEMP, 0, (void *) va, perm)) < 0 ||
+  8030a6:	89 34 24             	mov    %esi,(%esp)
+  8030a9:	53                   	push   %ebx
+  8030aa:	6a 00                	push   $0x0
+  8030ac:	68 00 f0 7f 00       	push   $0x7ff000
+  8030b1:	6a 00                	push   $0x0
+  8030b3:	e8 c2 dd ff ff       	call   800e7a <sys_page_map>
+  8030b8:	83 c4 20             	add    $0x20,%esp
+  8030bb:	85 c0                	test   %eax,%eax
+  8030bd:	78 30                	js     8030ef <mmap_copy+0x7c>
+      (r = sys_page_unmap(0, PFTEMP)) < 0)
+  8030bf:	83 ec 08             	sub    $0x8,%esp
+  8030c2:	68 00 f0 7f 00       	push   $0x7ff000
+  8030c7:	6a 00                	push   $0x0
+  8030c9:	e8 ee dd ff ff       	call   800ebc <sys_page_unmap>
+  if ((r = sys_page_map(0, PFTEMP, 0, (void *) va, perm)) < 0 ||
+  8030ce:	83 c4 10             	add    $0x10,%esp
+  8030d1:	85 c0                	test   %eax,%eax
+  8030d3:	78 1a                	js     8030ef <mmap_copy+0x7c>
+    panic("mmap: %e", r);
+}
+  8030d5:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8030d8:	5b                   	pop    %ebx
+  8030d9:	5e                   	pop    %esi
+  8030da:	5f                   	pop    %edi
+  8030db:	5d                   	pop    %ebp
+  8030dc:	c3                   	ret
+    panic("mmap: %e", r);
+  8030dd:	50                   	push   %eax
+  8030de:	68 a9 42 80 00       	push   $0x8042a9
+  8030e3:	6a 3e                	push   $0x3e
+  8030e5:	68 b2 42 80 00       	push   $0x8042b2
+  8030ea:	e8 50 d2 ff ff       	call   80033f <_panic>
+    panic("mmap: %e", r);
+  8030ef:	50                   	push   %eax
+  8030f0:	68 a9 42 80 00       	push   $0x8042a9
+  8030f5:	6a 42                	push   $0x42
+  8030f7:	68 b2 42 80 00       	push   $0x8042b2
+  8030fc:	e8 3e d2 ff ff       	call   80033f <_panic>
+
+00803101 <mmap_fault>:
+// Handle a page fault in a mapping, if it is one.  Returns 1 if it was.
+// The fork page fault handlers call this first, so that mappings keep
+// working after a fork.
+bool
+mmap_fault(struct UTrapframe *utf)
+{
+  803101:	55                   	push   %ebp
+  803102:	89 e5                	mov    %esp,%ebp
+  803104:	57                   	push   %edi
+  803105:	56                   	push   %esi
+  803106:	53                   	push   %ebx
+  803107:	83 ec 1c             	sub    $0x1c,%esp
+  80310a:	8b 7d 08             	mov    0x8(%ebp),%edi
+  struct Fsreq_read_map saved;
+  struct Mmap *m;
+  uintptr_t va;
+  int perm, r;
+
+  va = ROUNDDOWN(utf->utf_fault_va, PGSIZE);
+  80310d:	8b 1f                	mov    (%edi),%ebx
+  80310f:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  if (va < MMAPBASE || va >= MMAPTOP || (m = mmap_find(va)) == NULL)
+  803115:	8d 83 00 00 00 60    	lea    0x60000000(%ebx),%eax
+  80311b:	3d ff ff ff 2f       	cmp    $0x2fffffff,%eax
+  803120:	0f 87 24 01 00 00    	ja     80324a <mmap_fault+0x149>
+  803126:	89 d8                	mov    %ebx,%eax
+  803128:	e8 db fe ff ff       	call   803008 <mmap_find>
+  80312d:	89 c6                	mov    %eax,%esi
+  80312f:	85 c0                	test   %eax,%eax
+  803131:	0f 84 20 01 00 00    	je     803257 <mmap_fault+0x156>
+    return 0;
+  if ((utf->utf_err & FEC_WR) && m->mm_perm == MAP_RDONLY)
+  803137:	f6 47 04 02          	testb  $0x2,0x4(%edi)
+  80313b:	74 13                	je     803150 <mmap_fault+0x4f>
+  80313d:	83 78 10 00          	cmpl   $0x0,0x10(%eax)
+  803141:	0f 84 17 01 00 00    	je     80325e <mmap_fault+0x15d>
+    return 0;
+  perm = PTE_P | PTE_U | (m->mm_perm == MAP_RDONLY ? 0 : PTE_W);
+  803147:	c7 45 e4 07 00 00 00 	movl   $0x7,-0x1c(%ebp)
+  80314e:	eb 0f                	jmp    80315f <mmap_fault+0x5e>
+  803150:	83 78 10 01          	cmpl   $0x1,0x10(%eax)
+  803154:	19 c0                	sbb    %eax,%eax
+  803156:	83 e0 fe             	and    $0xfffffffe,%eax
+  803159:	83 c0 07             	add    $0x7,%eax
+  80315c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+
+  if (!va_mapped(va)) {
+  80315f:	89 d8                	mov    %ebx,%eax
+  803161:	e8 e4 fe ff ff       	call   80304a <va_mapped>
+  803166:	84 c0                	test   %al,%al
+  803168:	74 42                	je     8031ac <mmap_fault+0xab>
+    }
+  }
+
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+    mmap_copy(va, PGSIZE, perm);
+  return 1;
+  80316a:	b8 01 00 00 00       	mov    $0x1,%eax
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+  80316f:	f6 47 04 02          	testb  $0x2,0x4(%edi)
+  803173:	0f 84 d6 00 00 00    	je     80324f <mmap_fault+0x14e>
+  803179:	89 d8                	mov    %ebx,%eax
+  80317b:	c1 e8 0c             	shr    $0xc,%eax
+  80317e:	8b 14 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%edx
+  return 1;
+  803185:	b8 01 00 00 00       	mov    $0x1,%eax
+  if ((utf->utf_err & FEC_WR) && !(uvpt[PGNUM(va)] & PTE_W))
+  80318a:	f6 c2 02             	test   $0x2,%dl
+  80318d:	0f 85 bc 00 00 00    	jne    80324f <mmap_fault+0x14e>
+    mmap_copy(va, PGSIZE, perm);
+  803193:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  803196:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80319b:	89 d8                	mov    %ebx,%eax
+  80319d:	e8 d1 fe ff ff       	call   803073 <mmap_copy>
+  return 1;
+  8031a2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8031a7:	e9 a3 00 00 00       	jmp    80324f <mmap_fault+0x14e>
+    saved = fsipcbuf.read_map;
+  8031ac:	a1 00 70 80 00       	mov    0x807000,%eax
+  8031b1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  8031b4:	8b 15 04 70 80 00    	mov    0x807004,%edx
+  8031ba:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    r = read_map(m->mm_fd, m->mm_offset + (va - m->mm_va), (void *) va);
+  8031bd:	83 ec 04             	sub    $0x4,%esp
+  8031c0:	53                   	push   %ebx
+  8031c1:	89 d8                	mov    %ebx,%eax
+  8031c3:	03 46 0c             	add    0xc(%esi),%eax
+  8031c6:	2b 06                	sub    (%esi),%eax
+  8031c8:	50                   	push   %eax
+  8031c9:	ff 76 08             	push   0x8(%esi)
+  8031cc:	e8 35 f3 ff ff       	call   802506 <read_map>
+    fsipcbuf.read_map = saved;
+  8031d1:	8b 4d e0             	mov    -0x20(%ebp),%ecx
+  8031d4:	89 0d 00 70 80 00    	mov    %ecx,0x807000
+  8031da:	8b 55 dc             	mov    -0x24(%ebp),%edx
+  8031dd:	89 15 04 70 80 00    	mov    %edx,0x807004
+    if (r < 0)
+  8031e3:	83 c4 10             	add    $0x10,%esp
+  8031e6:	85 c0                	test   %eax,%eax
+  8031e8:	78 20                	js     80320a <mmap_fault+0x109>
+    if (r == 0) {
+  8031ea:	74 30                	je     80321c <mmap_fault+0x11b>
+    if (r < PGSIZE) {
+  8031ec:	3d ff 0f 00 00       	cmp    $0xfff,%eax
+  8031f1:	0f 8f 73 ff ff ff    	jg     80316a <mmap_fault+0x69>
+      mmap_copy(va, r, perm);
+  8031f7:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+  8031fa:	89 c2                	mov    %eax,%edx
+  8031fc:	89 d8                	mov    %ebx,%eax
+  8031fe:	e8 70 fe ff ff       	call   803073 <mmap_copy>
+      return 1;
+  803203:	b8 01 00 00 00       	mov    $0x1,%eax
+  803208:	eb 45                	jmp    80324f <mmap_fault+0x14e>
+      panic("mmap: read_map: %e", r);
+  80320a:	50                   	push   %eax
+  80320b:	68 bd 42 80 00       	push   $0x8042bd
+  803210:	6a 5f                	push   $0x5f
+  803212:	68 b2 42 80 00       	push   $0x8042b2
+  803217:	e8 23 d1 ff ff       	call   80033f <_panic>
+      if ((r = sys_page_alloc(0, (void *) va, perm)) < 0)
+  80321c:	83 ec 04             	sub    $0x4,%esp
+  80321f:	ff 75 e4             	push   -0x1c(%ebp)
+  803222:	53                   	push   %ebx
+  803223:	6a 00                	push   $0x0
+  803225:	e8 0d dc ff ff       	call   800e37 <sys_page_alloc>
+  80322a:	83 c4 10             	add    $0x10,%esp
+  80322d:	85 c0                	test   %eax,%eax
+  80322f:	78 07                	js     803238 <mmap_fault+0x137>
+      return 1;
+  803231:	b8 01 00 00 00       	mov    $0x1,%eax
+  803236:	eb 17                	jmp    80324f <mmap_fault+0x14e>
+        panic("mmap: %e", r);
+  803238:	50                   	push   %eax
+  803239:	68 a9 42 80 00       	push   $0x8042a9
+  80323e:	6a 64                	push   $0x64
+  803240:	68 b2 42 80 00       	push   $0x8042b2
+  803245:	e8 f5 d0 ff ff       	call   80033f <_panic>
+    return 0;
+  80324a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80324f:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803252:	5b                   	pop    %ebx
+  803253:	5e                   	pop    %esi
+  803254:	5f                   	pop    %edi
+  803255:	5d                   	pop    %ebp
+  803256:	c3                   	ret
+    return 0;
+  803257:	b8 00 00 00 00       	mov    $0x0,%eax
+  80325c:	eb f1                	jmp    80324f <mmap_fault+0x14e>
+    return 0;
+  80325e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803263:	eb ea                	jmp    80324f <mmap_fault+0x14e>
+
+00803265 <mmap_pgfault>:
+{
+  803265:	55                   	push   %ebp
+  803266:	89 e5                	mov    %esp,%ebp
+  803268:	53                   	push   %ebx
+  803269:	83 ec 10             	sub    $0x10,%esp
+  80326c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  if (!mmap_fault(utf))
+  80326f:	53                   	push   %ebx
+  803270:	e8 8c fe ff ff       	call   803101 <mmap_fault>
+  803275:	83 c4 10             	add    $0x10,%esp
+  803278:	84 c0                	test   %al,%al
+  80327a:	74 05                	je     803281 <mmap_pgfault+0x1c>
+}
+  80327c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  80327f:	c9                   	leave
+  803280:	c3                   	ret
+    panic("page fault at %08x, eip %08x, err %04x", utf->utf_fault_va,
+  803281:	83 ec 08             	sub    $0x8,%esp
+  803284:	ff 73 04             	push   0x4(%ebx)
+  803287:	ff 73 28             	push   0x28(%ebx)
+  80328a:	ff 33                	push   (%ebx)
+  80328c:	68 d0 42 80 00       	push   $0x8042d0
+  803291:	6a 20                	push   $0x20
+  803293:	68 b2 42 80 00       	push   $0x8042b2
+  803298:	e8 a2 d0 ff ff       	call   80033f <_panic>
+
+0080329d <mmap>:
+// Returns 0 on success, < 0 on error.  Errors are:
+//	-E_INVAL if offset isn't aligned, len is 0, or perm is unknown
+//	-E_NO_MEM if there's no free slot or address space for it
+int
+mmap(int fdnum, off_t offset, size_t len, int perm, void **addr)
+{
+  80329d:	55                   	push   %ebp
+  80329e:	89 e5                	mov    %esp,%ebp
+  8032a0:	57                   	push   %edi
+  8032a1:	56                   	push   %esi
+  8032a2:	53                   	push   %ebx
+  8032a3:	83 ec 44             	sub    $0x44,%esp
+  8032a6:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  struct Fd *fd;
+  uintptr_t va;
+  int i, j, r;
+
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  8032a9:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  8032ac:	50                   	push   %eax
+  8032ad:	ff 75 08             	push   0x8(%ebp)
+  8032b0:	e8 df e4 ff ff       	call   801794 <fd_lookup>
+  8032b5:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8032b8:	83 c4 10             	add    $0x10,%esp
+  8032bb:	85 c0                	test   %eax,%eax
+  8032bd:	0f 88 3e 01 00 00    	js     803401 <mmap+0x164>
+    return r;
+  if (offset < 0 || PGOFF(offset) || len == 0 ||
+  8032c3:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+  8032c7:	0f 88 d1 00 00 00    	js     80339e <mmap+0x101>
+  8032cd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  8032d0:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8032d5:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  8032d8:	0f 85 c9 00 00 00    	jne    8033a7 <mmap+0x10a>
+  8032de:	85 db                	test   %ebx,%ebx
+  8032e0:	0f 84 ca 00 00 00    	je     8033b0 <mmap+0x113>
+  8032e6:	83 7d 14 02          	cmpl   $0x2,0x14(%ebp)
+  8032ea:	0f 87 c0 00 00 00    	ja     8033b0 <mmap+0x113>
+      (perm != MAP_RDONLY && perm != MAP_PRIVATE && perm != MAP_SHARED))
+    return -E_INVAL;
+  len = ROUNDUP(len, PGSIZE);
+  8032f0:	81 c3 ff 0f 00 00    	add    $0xfff,%ebx
+  8032f6:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  8032fc:	89 d9                	mov    %ebx,%ecx
+  8032fe:	89 5d c4             	mov    %ebx,-0x3c(%ebp)
+
+  // First fit: try the start of the region and the end of each
+  // mapping.
+  for (i = -1; i < NMMAP; i++) {
+  803301:	bb 4c 67 80 00       	mov    $0x80674c,%ebx
+  803306:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+    if (i >= 0 && !mmaps[i].mm_va)
+      continue;
+    va = i < 0 ? MMAPBASE : mmaps[i].mm_va + mmaps[i].mm_len;
+  80330b:	bf 00 00 00 a0       	mov    $0xa0000000,%edi
+  803310:	eb 53                	jmp    803365 <mmap+0xc8>
+  803312:	bf 00 00 00 a0       	mov    $0xa0000000,%edi
+  803317:	eb 4c                	jmp    803365 <mmap+0xc8>
+    if (len > MMAPTOP - va)
+      continue;
+    for (j = 0; j < NMMAP; j++)
+  803319:	83 c0 01             	add    $0x1,%eax
+  80331c:	83 f8 10             	cmp    $0x10,%eax
+  80331f:	0f 84 e7 00 00 00    	je     80340c <mmap+0x16f>
+      if (mmaps[j].mm_va && va < mmaps[j].mm_va + mmaps[j].mm_len &&
+  803325:	8d 34 80             	lea    (%eax,%eax,4),%esi
+  803328:	8b 14 b5 60 67 80 00 	mov    0x806760(,%esi,4),%edx
+  80332f:	85 d2                	test   %edx,%edx
+  803331:	74 e6                	je     803319 <mmap+0x7c>
+  803333:	89 d1                	mov    %edx,%ecx
+  803335:	03 0c b5 64 67 80 00 	add    0x806764(,%esi,4),%ecx
+  80333c:	39 cf                	cmp    %ecx,%edi
+  80333e:	73 d9                	jae    803319 <mmap+0x7c>
+  803340:	39 da                	cmp    %ebx,%edx
+  803342:	73 d5                	jae    803319 <mmap+0x7c>
+  803344:	8b 4d d0             	mov    -0x30(%ebp),%ecx
+  803347:	8b 55 cc             	mov    -0x34(%ebp),%edx
+  80334a:	8b 5d c8             	mov    -0x38(%ebp),%ebx
+  for (i = -1; i < NMMAP; i++) {
+  80334d:	83 c2 01             	add    $0x1,%edx
+  803350:	83 c3 14             	add    $0x14,%ebx
+  803353:	83 fa 10             	cmp    $0x10,%edx
+  803356:	74 2b                	je     803383 <mmap+0xe6>
+    if (i >= 0 && !mmaps[i].mm_va)
+  803358:	85 d2                	test   %edx,%edx
+  80335a:	78 b6                	js     803312 <mmap+0x75>
+  80335c:	8b 3b                	mov    (%ebx),%edi
+  80335e:	85 ff                	test   %edi,%edi
+  803360:	74 eb                	je     80334d <mmap+0xb0>
+    va = i < 0 ? MMAPBASE : mmaps[i].mm_va + mmaps[i].mm_len;
+  803362:	03 7b 04             	add    0x4(%ebx),%edi
+    if (len > MMAPTOP - va)
+  803365:	b8 00 00 00 d0       	mov    $0xd0000000,%eax
+  80336a:	29 f8                	sub    %edi,%eax
+  80336c:	39 c8                	cmp    %ecx,%eax
+  80336e:	72 dd                	jb     80334d <mmap+0xb0>
+    for (j = 0; j < NMMAP; j++)
+  803370:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+          mmaps[j].mm_va < va + len)
+  803373:	8d 34 0f             	lea    (%edi,%ecx,1),%esi
+  803376:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  803379:	89 55 cc             	mov    %edx,-0x34(%ebp)
+  80337c:	89 5d c8             	mov    %ebx,-0x38(%ebp)
+  80337f:	89 f3                	mov    %esi,%ebx
+  803381:	eb a2                	jmp    803325 <mmap+0x88>
+        break;
+    if (j == NMMAP)
+      break;
+  }
+  if (i == NMMAP)
+    return -E_NO_MEM;
+  803383:	c7 45 d4 fc ff ff ff 	movl   $0xfffffffc,-0x2c(%ebp)
+  80338a:	eb 75                	jmp    803401 <mmap+0x164>
+    ;
+  if (j == NMMAP)
+    return -E_NO_MEM;
+
+  if (_pgfault_handler == 0)
+    set_pgfault_handler(mmap_pgfault);
+  80338c:	83 ec 0c             	sub    $0xc,%esp
+  80338f:	68 65 32 80 00       	push   $0x803265
+  803394:	e8 f7 03 00 00       	call   803790 <set_pgfault_handler>
+  803399:	83 c4 10             	add    $0x10,%esp
+  80339c:	eb 24                	jmp    8033c2 <mmap+0x125>
+    return -E_INVAL;
+  80339e:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  8033a5:	eb 5a                	jmp    803401 <mmap+0x164>
+  8033a7:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  8033ae:	eb 51                	jmp    803401 <mmap+0x164>
+  8033b0:	c7 45 d4 fd ff ff ff 	movl   $0xfffffffd,-0x2c(%ebp)
+  8033b7:	eb 48                	jmp    803401 <mmap+0x164>
+  if (_pgfault_handler == 0)
+  8033b9:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  8033c0:	74 ca                	je     80338c <mmap+0xef>
+
+  mmaps[j].mm_va = va;
+  8033c2:	8d 04 9d 00 00 00 00 	lea    0x0(,%ebx,4),%eax
+  8033c9:	8d 14 18             	lea    (%eax,%ebx,1),%edx
+  8033cc:	c1 e2 02             	shl    $0x2,%edx
+  8033cf:	89 ba 60 67 80 00    	mov    %edi,0x806760(%edx)
+  mmaps[j].mm_len = len;
+  8033d5:	8b 75 c4             	mov    -0x3c(%ebp),%esi
+  8033d8:	89 b2 64 67 80 00    	mov    %esi,0x806764(%edx)
+  mmaps[j].mm_fd = fdnum;
+  8033de:	8b 75 08             	mov    0x8(%ebp),%esi
+  8033e1:	89 b2 68 67 80 00    	mov    %esi,0x806768(%edx)
+  mmaps[j].mm_offset = offset;
+  8033e7:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8033ea:	89 b2 6c 67 80 00    	mov    %esi,0x80676c(%edx)
+  mmaps[j].mm_perm = perm;
+  8033f0:	01 d8                	add    %ebx,%eax
+  8033f2:	8b 5d 14             	mov    0x14(%ebp),%ebx
+  8033f5:	89 1c 85 70 67 80 00 	mov    %ebx,0x806770(,%eax,4)
+  *addr = (void *) va;
+  8033fc:	8b 45 18             	mov    0x18(%ebp),%eax
+  8033ff:	89 38                	mov    %edi,(%eax)
+  return 0;
+}
+  803401:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+  803404:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  803407:	5b                   	pop    %ebx
+  803408:	5e                   	pop    %esi
+  803409:	5f                   	pop    %edi
+  80340a:	5d                   	pop    %ebp
+  80340b:	c3                   	ret
+  if (i == NMMAP)
+  80340c:	b8 60 67 80 00       	mov    $0x806760,%eax
+  for (j = 0; j < NMMAP && mmaps[j].mm_va; j++)
+  803411:	8b 5d d4             	mov    -0x2c(%ebp),%ebx
+  803414:	83 c0 14             	add    $0x14,%eax
+  803417:	83 78 ec 00          	cmpl   $0x0,-0x14(%eax)
+  80341b:	74 9c                	je     8033b9 <mmap+0x11c>
+  80341d:	83 c3 01             	add    $0x1,%ebx
+  803420:	83 fb 10             	cmp    $0x10,%ebx
+  803423:	75 ef                	jne    803414 <mmap+0x177>
+    return -E_NO_MEM;
+  803425:	c7 45 d4 fc ff ff ff 	movl   $0xfffffffc,-0x2c(%ebp)
+  80342c:	eb d3                	jmp    803401 <mmap+0x164>
+
+0080342e <msync>:
+// nothing for other kinds of mapping.
+//
+// Returns 0 on success, < 0 on error.
+int
+msync(void *addr)
+{
+  80342e:	55                   	push   %ebp
+  80342f:	89 e5                	mov    %esp,%ebp
+  803431:	57                   	push   %edi
+  803432:	56                   	push   %esi
+  803433:	53                   	push   %ebx
+  803434:	81 ec ac 00 00 00    	sub    $0xac,%esp
+  struct Stat st;
+  off_t saved, off;
+  uintptr_t va;
+  int n, r;
+
+  if ((m = mmap_find((uintptr_t) addr)) == NULL)
+  80343a:	8b 45 08             	mov    0x8(%ebp),%eax
+  80343d:	e8 c6 fb ff ff       	call   803008 <mmap_find>
+  803442:	85 c0                	test   %eax,%eax
+  803444:	0f 84 58 01 00 00    	je     8035a2 <msync+0x174>
+  80344a:	89 c7                	mov    %eax,%edi
+    return -E_INVAL;
+  if (m->mm_perm != MAP_SHARED)
+    return 0;
+  80344c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  if (m->mm_perm != MAP_SHARED)
+  803451:	83 78 10 02          	cmpl   $0x2,0x10(%eax)
+  803455:	74 0a                	je     803461 <msync+0x33>
+                          PTE_P | PTE_U | PTE_W)) < 0)
+      break;
+  }
+  fd->fd_offset = saved;
+  return r < 0 ? r : 0;
+}
+  803457:	89 d8                	mov    %ebx,%eax
+  803459:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80345c:	5b                   	pop    %ebx
+  80345d:	5e                   	pop    %esi
+  80345e:	5f                   	pop    %edi
+  80345f:	5d                   	pop    %ebp
+  803460:	c3                   	ret
+  if ((r = fd_lookup(m->mm_fd, &fd)) < 0 || (r = fstat(m->mm_fd, &st)) < 0)
+  803461:	83 ec 08             	sub    $0x8,%esp
+  803464:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+  803467:	50                   	push   %eax
+  803468:	ff 77 08             	push   0x8(%edi)
+  80346b:	e8 24 e3 ff ff       	call   801794 <fd_lookup>
+  803470:	89 c3                	mov    %eax,%ebx
+  803472:	83 c4 10             	add    $0x10,%esp
+  803475:	85 c0                	test   %eax,%eax
+  803477:	78 de                	js     803457 <msync+0x29>
+  803479:	83 ec 08             	sub    $0x8,%esp
+  80347c:	8d 85 58 ff ff ff    	lea    -0xa8(%ebp),%eax
+  803482:	50                   	push   %eax
+  803483:	ff 77 08             	push   0x8(%edi)
+  803486:	e8 ac e7 ff ff       	call   801c37 <fstat>
+  80348b:	89 c3                	mov    %eax,%ebx
+  80348d:	83 c4 10             	add    $0x10,%esp
+  803490:	85 c0                	test   %eax,%eax
+  803492:	78 c3                	js     803457 <msync+0x29>
+  saved = fd->fd_offset;
+  803494:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  803497:	8b 40 04             	mov    0x4(%eax),%eax
+  80349a:	89 85 4c ff ff ff    	mov    %eax,-0xb4(%ebp)
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE) {
+  8034a0:	8b 37                	mov    (%edi),%esi
+  8034a2:	eb 29                	jmp    8034cd <msync+0x9f>
+    if ((r = sys_page_map(0, (void *) va, 0, (void *) va,
+  8034a4:	83 ec 0c             	sub    $0xc,%esp
+  8034a7:	6a 07                	push   $0x7
+  8034a9:	8b 85 50 ff ff ff    	mov    -0xb0(%ebp),%eax
+  8034af:	50                   	push   %eax
+  8034b0:	6a 00                	push   $0x0
+  8034b2:	50                   	push   %eax
+  8034b3:	6a 00                	push   $0x0
+  8034b5:	e8 c0 d9 ff ff       	call   800e7a <sys_page_map>
+  8034ba:	89 c3                	mov    %eax,%ebx
+  8034bc:	83 c4 20             	add    $0x20,%esp
+  8034bf:	85 c0                	test   %eax,%eax
+  8034c1:	0f 88 c0 00 00 00    	js     803587 <msync+0x159>
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE) {
+  8034c7:	81 c6 00 10 00 00    	add    $0x1000,%esi
+  8034cd:	8b 07                	mov    (%edi),%eax
+  8034cf:	89 85 54 ff ff ff    	mov    %eax,-0xac(%ebp)
+  8034d5:	03 47 04             	add    0x4(%edi),%eax
+  8034d8:	39 c6                	cmp    %eax,%esi
+  8034da:	0f 83 a7 00 00 00    	jae    803587 <msync+0x159>
+    if (!va_mapped(va) || !(uvpt[PGNUM(va)] & PTE_D))
+  8034e0:	89 f0                	mov    %esi,%eax
+  8034e2:	e8 63 fb ff ff       	call   80304a <va_mapped>
+  8034e7:	84 c0                	test   %al,%al
+  8034e9:	74 dc                	je     8034c7 <msync+0x99>
+  8034eb:	89 f0                	mov    %esi,%eax
+  8034ed:	c1 e8 0c             	shr    $0xc,%eax
+  8034f0:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  8034f7:	a8 40                	test   $0x40,%al
+  8034f9:	74 cc                	je     8034c7 <msync+0x99>
+    off = m->mm_offset + (va - m->mm_va);
+  8034fb:	8b 47 0c             	mov    0xc(%edi),%eax
+  8034fe:	8b 8d 54 ff ff ff    	mov    -0xac(%ebp),%ecx
+  803504:	29 c8                	sub    %ecx,%eax
+  803506:	01 f0                	add    %esi,%eax
+    if (off >= st.st_size)
+  803508:	8b 55 d8             	mov    -0x28(%ebp),%edx
+  80350b:	39 c2                	cmp    %eax,%edx
+  80350d:	7e 78                	jle    803587 <msync+0x159>
+    n = MIN(PGSIZE, st.st_size - off);
+  80350f:	29 c2                	sub    %eax,%edx
+  803511:	89 d1                	mov    %edx,%ecx
+  803513:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803518:	39 d1                	cmp    %edx,%ecx
+  80351a:	0f 4e d1             	cmovle %ecx,%edx
+  80351d:	89 95 54 ff ff ff    	mov    %edx,-0xac(%ebp)
+    if ((r = seek(m->mm_fd, off)) < 0 ||
+  803523:	83 ec 08             	sub    $0x8,%esp
+  803526:	50                   	push   %eax
+  803527:	ff 77 08             	push   0x8(%edi)
+  80352a:	e8 60 e6 ff ff       	call   801b8f <seek>
+  80352f:	89 c3                	mov    %eax,%ebx
+  803531:	83 c4 10             	add    $0x10,%esp
+  803534:	85 c0                	test   %eax,%eax
+  803536:	78 4f                	js     803587 <msync+0x159>
+        (r = write(m->mm_fd, (void *) va, n)) < 0)
+  803538:	89 b5 50 ff ff ff    	mov    %esi,-0xb0(%ebp)
+  80353e:	83 ec 04             	sub    $0x4,%esp
+  803541:	ff b5 54 ff ff ff    	push   -0xac(%ebp)
+  803547:	56                   	push   %esi
+  803548:	ff 77 08             	push   0x8(%edi)
+  80354b:	e8 bd e5 ff ff       	call   801b0d <write>
+  803550:	89 c3                	mov    %eax,%ebx
+    if ((r = seek(m->mm_fd, off)) < 0 ||
+  803552:	83 c4 10             	add    $0x10,%esp
+  803555:	85 c0                	test   %eax,%eax
+  803557:	78 2e                	js     803587 <msync+0x159>
+    if (r < n && (r = write(m->mm_fd, (char *) va + r, n - r)) < 0)
+  803559:	8b 95 54 ff ff ff    	mov    -0xac(%ebp),%edx
+  80355f:	39 c2                	cmp    %eax,%edx
+  803561:	0f 8e 3d ff ff ff    	jle    8034a4 <msync+0x76>
+  803567:	89 d0                	mov    %edx,%eax
+  803569:	29 d8                	sub    %ebx,%eax
+  80356b:	01 f3                	add    %esi,%ebx
+  80356d:	83 ec 04             	sub    $0x4,%esp
+  803570:	50                   	push   %eax
+  803571:	53                   	push   %ebx
+  803572:	ff 77 08             	push   0x8(%edi)
+  803575:	e8 93 e5 ff ff       	call   801b0d <write>
+  80357a:	89 c3                	mov    %eax,%ebx
+  80357c:	83 c4 10             	add    $0x10,%esp
+  80357f:	85 c0                	test   %eax,%eax
+  803581:	0f 89 1d ff ff ff    	jns    8034a4 <msync+0x76>
+  fd->fd_offset = saved;
+  803587:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  80358a:	8b 8d 4c ff ff ff    	mov    -0xb4(%ebp),%ecx
+  803590:	89 48 04             	mov    %ecx,0x4(%eax)
+  return r < 0 ? r : 0;
+  803593:	85 db                	test   %ebx,%ebx
+  803595:	b8 00 00 00 00       	mov    $0x0,%eax
+  80359a:	0f 4f d8             	cmovg  %eax,%ebx
+  80359d:	e9 b5 fe ff ff       	jmp    803457 <msync+0x29>
+    return -E_INVAL;
+  8035a2:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  8035a7:	e9 ab fe ff ff       	jmp    803457 <msync+0x29>
+
+008035ac <munmap>:
+// Remove the mapping at 'addr', writing a MAP_SHARED one back first.
+//
+// Returns 0 on success, < 0 on error.
+int
+munmap(void *addr)
+{
+  8035ac:	55                   	push   %ebp
+  8035ad:	89 e5                	mov    %esp,%ebp
+  8035af:	56                   	push   %esi
+  8035b0:	53                   	push   %ebx
+  8035b1:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  struct Mmap *m;
+  uintptr_t va;
+  int r;
+
+  if ((m = mmap_find((uintptr_t) addr)) == NULL)
+  8035b4:	89 d8                	mov    %ebx,%eax
+  8035b6:	e8 4d fa ff ff       	call   803008 <mmap_find>
+  8035bb:	85 c0                	test   %eax,%eax
+  8035bd:	74 56                	je     803615 <munmap+0x69>
+  8035bf:	89 c6                	mov    %eax,%esi
+    return -E_INVAL;
+  if ((r = msync(addr)) < 0)
+  8035c1:	83 ec 0c             	sub    $0xc,%esp
+  8035c4:	53                   	push   %ebx
+  8035c5:	e8 64 fe ff ff       	call   80342e <msync>
+  8035ca:	83 c4 10             	add    $0x10,%esp
+  8035cd:	85 c0                	test   %eax,%eax
+  8035cf:	78 3d                	js     80360e <munmap+0x62>
+    return r;
+  for (va = m->mm_va; va < m->mm_va + m->mm_len; va += PGSIZE)
+  8035d1:	8b 1e                	mov    (%esi),%ebx
+  8035d3:	eb 06                	jmp    8035db <munmap+0x2f>
+  8035d5:	81 c3 00 10 00 00    	add    $0x1000,%ebx
+  8035db:	8b 46 04             	mov    0x4(%esi),%eax
+  8035de:	03 06                	add    (%esi),%eax
+  8035e0:	39 c3                	cmp    %eax,%ebx
+  8035e2:	73 1f                	jae    803603 <munmap+0x57>
+    if (va_mapped(va) && (r = sys_page_unmap(0, (void *) va)) < 0)
+  8035e4:	89 d8                	mov    %ebx,%eax
+  8035e6:	e8 5f fa ff ff       	call   80304a <va_mapped>
+  8035eb:	84 c0                	test   %al,%al
+  8035ed:	74 e6                	je     8035d5 <munmap+0x29>
+  8035ef:	83 ec 08             	sub    $0x8,%esp
+  8035f2:	53                   	push   %ebx
+  8035f3:	6a 00                	push   $0x0
+  8035f5:	e8 c2 d8 ff ff       	call   800ebc <sys_page_unmap>
+  8035fa:	83 c4 10             	add    $0x10,%esp
+  8035fd:	85 c0                	test   %eax,%eax
+  8035ff:	79 d4                	jns    8035d5 <munmap+0x29>
+  803601:	eb 0b                	jmp    80360e <munmap+0x62>
+      return r;
+  m->mm_va = 0;
+  803603:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+  return 0;
+  803609:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80360e:	8d 65 f8             	lea    -0x8(%ebp),%esp
+  803611:	5b                   	pop    %ebx
+  803612:	5e                   	pop    %esi
+  803613:	5d                   	pop    %ebp
+  803614:	c3                   	ret
+    return -E_INVAL;
+  803615:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80361a:	eb f2                	jmp    80360e <munmap+0x62>
+
+0080361c <devcons_close>:
+devcons_close(struct Fd *fd)
+{
+  USED(fd);
+
+  return 0;
+}
+  80361c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803621:	c3                   	ret
+
+00803622 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat)
+{
+  803622:	55                   	push   %ebp
+  803623:	89 e5                	mov    %esp,%ebp
+  803625:	83 ec 10             	sub    $0x10,%esp
+  strcpy(stat->st_name, "<cons>");
+  803628:	68 f7 42 80 00       	push   $0x8042f7
+  80362d:	ff 75 0c             	push   0xc(%ebp)
+  803630:	e8 d3 d3 ff ff       	call   800a08 <strcpy>
+  return 0;
+}
+  803635:	b8 00 00 00 00       	mov    $0x0,%eax
+  80363a:	c9                   	leave
+  80363b:	c3                   	ret
+
+0080363c <devcons_write>:
+{
+  80363c:	55                   	push   %ebp
+  80363d:	89 e5                	mov    %esp,%ebp
+  80363f:	57                   	push   %edi
+  803640:	56                   	push   %esi
+  803641:	53                   	push   %ebx
+  803642:	81 ec 8c 00 00 00    	sub    $0x8c,%esp
+  for (tot = 0; tot < n; tot += m) {
+  803648:	be 00 00 00 00       	mov    $0x0,%esi
+    memmove(buf, (char*)vbuf + tot, m);
+  80364d:	8d bd 68 ff ff ff    	lea    -0x98(%ebp),%edi
+  for (tot = 0; tot < n; tot += m) {
+  803653:	eb 2e                	jmp    803683 <devcons_write+0x47>
+    m = n - tot;
+  803655:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  803658:	29 f3                	sub    %esi,%ebx
+    if (m > sizeof(buf) - 1)
+  80365a:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80365f:	39 c3                	cmp    %eax,%ebx
+  803661:	0f 47 d8             	cmova  %eax,%ebx
+    memmove(buf, (char*)vbuf + tot, m);
+  803664:	83 ec 04             	sub    $0x4,%esp
+  803667:	53                   	push   %ebx
+  803668:	89 f0                	mov    %esi,%eax
+  80366a:	03 45 0c             	add    0xc(%ebp),%eax
+  80366d:	50                   	push   %eax
+  80366e:	57                   	push   %edi
+  80366f:	e8 1a d5 ff ff       	call   800b8e <memmove>
+    sys_cputs(buf, m);
+  803674:	83 c4 08             	add    $0x8,%esp
+  803677:	53                   	push   %ebx
+  803678:	57                   	push   %edi
+  803679:	e8 ba d6 ff ff       	call   800d38 <sys_cputs>
+  for (tot = 0; tot < n; tot += m) {
+  80367e:	01 de                	add    %ebx,%esi
+  803680:	83 c4 10             	add    $0x10,%esp
+  803683:	3b 75 10             	cmp    0x10(%ebp),%esi
+  803686:	72 cd                	jb     803655 <devcons_write+0x19>
+}
+  803688:	89 f0                	mov    %esi,%eax
+  80368a:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80368d:	5b                   	pop    %ebx
+  80368e:	5e                   	pop    %esi
+  80368f:	5f                   	pop    %edi
+  803690:	5d                   	pop    %ebp
+  803691:	c3                   	ret
+
+00803692 <devcons_read>:
+{
+  803692:	55                   	push   %ebp
+  803693:	89 e5                	mov    %esp,%ebp
+  803695:	83 ec 08             	sub    $0x8,%esp
+  if (n == 0)
+  803698:	b8 00 00 00 00       	mov    $0x0,%eax
+  80369d:	83 7d 10 00          	cmpl   $0x0,0x10(%ebp)
+  8036a1:	75 07                	jne    8036aa <devcons_read+0x18>
+  8036a3:	eb 1f                	jmp    8036c4 <devcons_read+0x32>
+    sys_yield();
+  8036a5:	e8 2b d7 ff ff       	call   800dd5 <sys_yield>
+  while ((c = sys_cgetc()) == 0)
+  8036aa:	e8 a7 d6 ff ff       	call   800d56 <sys_cgetc>
+  8036af:	85 c0                	test   %eax,%eax
+  8036b1:	74 f2                	je     8036a5 <devcons_read+0x13>
+  if (c < 0)
+  8036b3:	78 0f                	js     8036c4 <devcons_read+0x32>
+  if (c == 0x04)        // ctl-d is eof
+  8036b5:	83 f8 04             	cmp    $0x4,%eax
+  8036b8:	74 0c                	je     8036c6 <devcons_read+0x34>
+  *(char*)vbuf = c;
+  8036ba:	8b 55 0c             	mov    0xc(%ebp),%edx
+  8036bd:	88 02                	mov    %al,(%edx)
+  return 1;
+  8036bf:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  8036c4:	c9                   	leave
+  8036c5:	c3                   	ret
+    return 0;
+  8036c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036cb:	eb f7                	jmp    8036c4 <devcons_read+0x32>
+
+008036cd <cputchar>:
+{
+  8036cd:	55                   	push   %ebp
+  8036ce:	89 e5                	mov    %esp,%ebp
+  8036d0:	83 ec 20             	sub    $0x20,%esp
+  char c = ch;
+  8036d3:	8b 45 08             	mov    0x8(%ebp),%eax
+  8036d6:	88 45 f7             	mov    %al,-0x9(%ebp)
+  sys_cputs(&c, 1);
+  8036d9:	6a 01                	push   $0x1
+  8036db:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8036de:	50                   	push   %eax
+  8036df:	e8 54 d6 ff ff       	call   800d38 <sys_cputs>
+}
+  8036e4:	83 c4 10             	add    $0x10,%esp
+  8036e7:	c9                   	leave
+  8036e8:	c3                   	ret
+
+008036e9 <getchar>:
+{
+  8036e9:	55                   	push   %ebp
+  8036ea:	89 e5                	mov    %esp,%ebp
+  8036ec:	83 ec 1c             	sub    $0x1c,%esp
+  r = read(0, &c, 1);
+  8036ef:	6a 01                	push   $0x1
+  8036f1:	8d 45 f7             	lea    -0x9(%ebp),%eax
+  8036f4:	50                   	push   %eax
+  8036f5:	6a 00                	push   $0x0
+  8036f7:	e8 43 e3 ff ff       	call   801a3f <read>
+  if (r < 0)
+  8036fc:	83 c4 10             	add    $0x10,%esp
+  8036ff:	85 c0                	test   %eax,%eax
+  803701:	78 06                	js     803709 <getchar+0x20>
+  if (r < 1)
+  803703:	74 06                	je     80370b <getchar+0x22>
+  return c;
+  803705:	0f b6 45 f7          	movzbl -0x9(%ebp),%eax
+}
+  803709:	c9                   	leave
+  80370a:	c3                   	ret
+    return -E_EOF;
+  80370b:	b8 f8 ff ff ff       	mov    $0xfffffff8,%eax
+  803710:	eb f7                	jmp    803709 <getchar+0x20>
+
+00803712 <iscons>:
+{
+  803712:	55                   	push   %ebp
+  803713:	89 e5                	mov    %esp,%ebp
+  803715:	83 ec 20             	sub    $0x20,%esp
+  if ((r = fd_lookup(fdnum, &fd)) < 0)
+  803718:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  80371b:	50                   	push   %eax
+  80371c:	ff 75 08             	push   0x8(%ebp)
+  80371f:	e8 70 e0 ff ff       	call   801794 <fd_lookup>
+  803724:	83 c4 10             	add    $0x10,%esp
+  803727:	85 c0                	test   %eax,%eax
+  803729:	78 11                	js     80373c <iscons+0x2a>
+  return fd->fd_dev_id == devcons.dev_id;
+  80372b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80372e:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  803734:	39 10                	cmp    %edx,(%eax)
+  803736:	0f 94 c0             	sete   %al
+  803739:	0f b6 c0             	movzbl %al,%eax
+}
+  80373c:	c9                   	leave
+  80373d:	c3                   	ret
+
+0080373e <opencons>:
+{
+  80373e:	55                   	push   %ebp
+  80373f:	89 e5                	mov    %esp,%ebp
+  803741:	83 ec 24             	sub    $0x24,%esp
+  if ((r = fd_alloc(&fd)) < 0)
+  803744:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803747:	50                   	push   %eax
+  803748:	e8 f1 df ff ff       	call   80173e <fd_alloc>
+  80374d:	83 c4 10             	add    $0x10,%esp
+  803750:	85 c0                	test   %eax,%eax
+  803752:	78 3a                	js     80378e <opencons+0x50>
+  if ((r = sys_page_alloc(0, fd, PTE_P|PTE_U|PTE_W|PTE_SHARE)) < 0)
+  803754:	83 ec 04             	sub    $0x4,%esp
+  803757:	68 07 04 00 00       	push   $0x407
+  80375c:	ff 75 f4             	push   -0xc(%ebp)
+  80375f:	6a 00                	push   $0x0
+  803761:	e8 d1 d6 ff ff       	call   800e37 <sys_page_alloc>
+  803766:	83 c4 10             	add    $0x10,%esp
+  803769:	85 c0                	test   %eax,%eax
+  80376b:	78 21                	js     80378e <opencons+0x50>
+  fd->fd_dev_id = devcons.dev_id;
+  80376d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  803770:	8b 15 40 50 80 00    	mov    0x805040,%edx
+  803776:	89 10                	mov    %edx,(%eax)
+  fd->fd_omode = O_RDWR;
+  803778:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  80377b:	c7 40 08 02 00 00 00 	movl   $0x2,0x8(%eax)
+  return fd2num(fd);
+  803782:	83 ec 0c             	sub    $0xc,%esp
+  803785:	50                   	push   %eax
+  803786:	e8 8f df ff ff       	call   80171a <fd2num>
+  80378b:	83 c4 10             	add    $0x10,%esp
+}
+  80378e:	c9                   	leave
+  80378f:	c3                   	ret
+
+00803790 <set_pgfault_handler>:
+// at UXSTACKTOP), and tell the kernel to call the assembly-language
+// _pgfault_upcall routine when a page fault occurs.
+//
+void
+set_pgfault_handler(void (*handler)(struct UTrapframe *utf))
+{
+  803790:	55                   	push   %ebp
+  803791:	89 e5                	mov    %esp,%ebp
+  803793:	53                   	push   %ebx
+  803794:	83 ec 04             	sub    $0x4,%esp
+  int r;
+
+  if (_pgfault_handler == 0) {
+  803797:	83 3d 00 80 80 00 00 	cmpl   $0x0,0x808000
+  80379e:	74 0d                	je     8037ad <set_pgfault_handler+0x1d>
+
+    sys_env_set_pgfault_upcall(id, _pgfault_upcall);
+  }
+
+  // Save handler pointer for assembly to call.
+  _pgfault_handler = handler;
+  8037a0:	8b 45 08             	mov    0x8(%ebp),%eax
+  8037a3:	a3 00 80 80 00       	mov    %eax,0x808000
+}
+  8037a8:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8037ab:	c9                   	leave
+  8037ac:	c3                   	ret
+    envid_t id = sys_getenvid();
+  8037ad:	e8 04 d6 ff ff       	call   800db6 <sys_getenvid>
+  8037b2:	89 c3                	mov    %eax,%ebx
+    sys_page_alloc(id, (void *) (UXSTACKTOP - PGSIZE), (PTE_P | PTE_U | PTE_W));
+  8037b4:	83 ec 04             	sub    $0x4,%esp
+  8037b7:	6a 07                	push   $0x7
+  8037b9:	68 00 f0 bf ee       	push   $0xeebff000
+  8037be:	50                   	push   %eax
+  8037bf:	e8 73 d6 ff ff       	call   800e37 <sys_page_alloc>
+    sys_env_set_pgfault_upcall(id, _pgfault_upcall);
+  8037c4:	83 c4 08             	add    $0x8,%esp
+  8037c7:	68 d7 37 80 00       	push   $0x8037d7
+  8037cc:	53                   	push   %ebx
+  8037cd:	e8 da d8 ff ff       	call   8010ac <sys_env_set_pgfault_upcall>
+  8037d2:	83 c4 10             	add    $0x10,%esp
+  8037d5:	eb c9                	jmp    8037a0 <set_pgfault_handler+0x10>
+
+008037d7 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+	// Call the C page fault handler.
+	pushl %esp			// function argument: pointer to UTF
+  8037d7:	54                   	push   %esp
+	movl _pgfault_handler, %eax
+  8037d8:	a1 00 80 80 00       	mov    0x808000,%eax
+	call *%eax
+  8037dd:	ff d0                	call   *%eax
+	addl $4, %esp			// pop function argument
+  8037df:	83 c4 04             	add    $0x4,%esp
+	// registers are available for intermediate calculations.  You
+	// may find that you have to rearrange your code in non-obvious
+	// ways as registers become unavailable as scratch space.
+	//
+	// LAB 4: Your code here.
+  movl 48(%esp), %eax       // move trap time esp to eax
+  8037e2:	8b 44 24 30          	mov    0x30(%esp),%eax
+  subl $4, %eax             // make room for eip on trap time esp
+  8037e6:	83 e8 04             	sub    $0x4,%eax
+  movl %eax, 48(%esp)       // move value to esp
+  8037e9:	89 44 24 30          	mov    %eax,0x30(%esp)
+  movl 40(%esp), %ebx       // move trap time eip to ebx
+  8037ed:	8b 5c 24 28          	mov    0x28(%esp),%ebx
+  movl %ebx, 0(%eax)
+  8037f1:	89 18                	mov    %ebx,(%eax)
+
+
+	// Restore the trap-time registers.  After you do this, you
+	// can no longer modify any general-purpose registers.
+	// LAB 4: Your code here.
+  addl $0x08,%esp
+  8037f3:	83 c4 08             	add    $0x8,%esp
+  popal
+  8037f6:	61                   	popa
+
+	// Restore eflags from the stack.  After you do this, you can
+	// no longer use arithmetic operations or anything else that
+	// modifies eflags.
+	// LAB 4: Your code here.
+  addl $4, %esp          // skip tf->eip
+  8037f7:	83 c4 04             	add    $0x4,%esp
+  popf                 // pop stack value into flags register
+  8037fa:	9d                   	popf
+
+	// Switch back to the adjusted trap-time stack.
+	// LAB 4: Your code here.
+  popl %esp
+  8037fb:	5c                   	pop    %esp
+
+	// Return to re-execute the instruction that faulted.
+	// LAB 4: Your code here.
+  ret
+  8037fc:	c3                   	ret
+
+008037fd <ipc_recv_pages>:
+// Like ipc_recv, but take up to *npages pages at 'pg' (which may be
+// null if npages is), and set *npages to the number the sender sent.
+int32_t
+ipc_recv_pages(envid_t *from_env_store, void *pg, size_t *npages,
+               int *perm_store)
+{
+  8037fd:	55                   	push   %ebp
+  8037fe:	89 e5                	mov    %esp,%ebp
+  803800:	57                   	push   %edi
+  803801:	56                   	push   %esi
+  803802:	53                   	push   %ebx
+  803803:	83 ec 14             	sub    $0x14,%esp
+  803806:	8b 7d 08             	mov    0x8(%ebp),%edi
+  803809:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80380c:	8b 5d 10             	mov    0x10(%ebp),%ebx
+  80380f:	8b 75 14             	mov    0x14(%ebp),%esi
+  // LAB 4: Your code here.
+  int error;
+
+  if (!pg)
+    pg = (void *) UTOP;
+  803812:	85 c0                	test   %eax,%eax
+  803814:	ba 00 00 c0 ee       	mov    $0xeec00000,%edx
+  803819:	0f 44 c2             	cmove  %edx,%eax
+
+  if ( (error = sys_ipc_recv(pg, *npages)) < 0) {
+  80381c:	ff 33                	push   (%ebx)
+  80381e:	50                   	push   %eax
+  80381f:	e8 eb d8 ff ff       	call   80110f <sys_ipc_recv>
+  803824:	83 c4 10             	add    $0x10,%esp
+  803827:	85 c0                	test   %eax,%eax
+  803829:	78 39                	js     803864 <ipc_recv_pages+0x67>
+    if (perm_store) *perm_store = 0;
+    *npages = 0;
+    return error;
+  }
+
+  if (from_env_store) *from_env_store = thisenv->env_ipc_from;
+  80382b:	85 ff                	test   %edi,%edi
+  80382d:	74 0a                	je     803839 <ipc_recv_pages+0x3c>
+  80382f:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  803834:	8b 40 7c             	mov    0x7c(%eax),%eax
+  803837:	89 07                	mov    %eax,(%edi)
+  if (perm_store) *perm_store = thisenv->env_ipc_perm;
+  803839:	85 f6                	test   %esi,%esi
+  80383b:	74 0d                	je     80384a <ipc_recv_pages+0x4d>
+  80383d:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  803842:	8b 80 80 00 00 00    	mov    0x80(%eax),%eax
+  803848:	89 06                	mov    %eax,(%esi)
+  *npages = thisenv->env_ipc_npages;
+  80384a:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  80384f:	8b 40 74             	mov    0x74(%eax),%eax
+  803852:	89 03                	mov    %eax,(%ebx)
+
+  return thisenv->env_ipc_value;
+  803854:	a1 a0 68 80 00       	mov    0x8068a0,%eax
+  803859:	8b 40 78             	mov    0x78(%eax),%eax
+}
+  80385c:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  80385f:	5b                   	pop    %ebx
+  803860:	5e                   	pop    %esi
+  803861:	5f                   	pop    %edi
+  803862:	5d                   	pop    %ebp
+  803863:	c3                   	ret
+    if (from_env_store) *from_env_store = 0;
+  803864:	85 ff                	test   %edi,%edi
+  803866:	74 06                	je     80386e <ipc_recv_pages+0x71>
+  803868:	c7 07 00 00 00 00    	movl   $0x0,(%edi)
+    if (perm_store) *perm_store = 0;
+  80386e:	85 f6                	test   %esi,%esi
+  803870:	74 06                	je     803878 <ipc_recv_pages+0x7b>
+  803872:	c7 06 00 00 00 00    	movl   $0x0,(%esi)
+    *npages = 0;
+  803878:	c7 03 00 00 00 00    	movl   $0x0,(%ebx)
+    return error;
+  80387e:	eb dc                	jmp    80385c <ipc_recv_pages+0x5f>
+
+00803880 <ipc_recv>:
+{
+  803880:	55                   	push   %ebp
+  803881:	89 e5                	mov    %esp,%ebp
+  803883:	83 ec 18             	sub    $0x18,%esp
+  size_t npages = 1;
+  803886:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  return ipc_recv_pages(from_env_store, pg, &npages, perm_store);
+  80388d:	ff 75 10             	push   0x10(%ebp)
+  803890:	8d 45 f4             	lea    -0xc(%ebp),%eax
+  803893:	50                   	push   %eax
+  803894:	ff 75 0c             	push   0xc(%ebp)
+  803897:	ff 75 08             	push   0x8(%ebp)
+  80389a:	e8 5e ff ff ff       	call   8037fd <ipc_recv_pages>
+}
+  80389f:	c9                   	leave
+  8038a0:	c3                   	ret
+
+008038a1 <ipc_send_pages>:
+// Like ipc_send, but send the 'npages' pages starting at 'pg', or as
+// many of them as the receiver takes.
+void
+ipc_send_pages(envid_t to_env, uint32_t val, void *pg, size_t npages,
+               int perm)
+{
+  8038a1:	55                   	push   %ebp
+  8038a2:	89 e5                	mov    %esp,%ebp
+  8038a4:	57                   	push   %edi
+  8038a5:	56                   	push   %esi
+  8038a6:	53                   	push   %ebx
+  8038a7:	83 ec 0c             	sub    $0xc,%esp
+  8038aa:	8b 7d 08             	mov    0x8(%ebp),%edi
+  8038ad:	8b 75 0c             	mov    0xc(%ebp),%esi
+  8038b0:	8b 45 10             	mov    0x10(%ebp),%eax
+  // LAB 4: Your code here.
+  int error;
+
+  pg = (pg) ? ROUNDDOWN(pg, PGSIZE) : (void *) UTOP;
+  8038b3:	89 c3                	mov    %eax,%ebx
+  8038b5:	81 e3 00 f0 ff ff    	and    $0xfffff000,%ebx
+  8038bb:	85 c0                	test   %eax,%eax
+  8038bd:	b8 00 00 c0 ee       	mov    $0xeec00000,%eax
+  8038c2:	0f 44 d8             	cmove  %eax,%ebx
+  sys_yield();
+
+  return 0;
+  */
+
+  while ( (error = sys_ipc_try_send(to_env, val, pg, perm, npages)) < 0) {
+  8038c5:	83 ec 0c             	sub    $0xc,%esp
+  8038c8:	ff 75 14             	push   0x14(%ebp)
+  8038cb:	ff 75 18             	push   0x18(%ebp)
+  8038ce:	53                   	push   %ebx
+  8038cf:	56                   	push   %esi
+  8038d0:	57                   	push   %edi
+  8038d1:	e8 18 d8 ff ff       	call   8010ee <sys_ipc_try_send>
+  8038d6:	83 c4 20             	add    $0x20,%esp
+  8038d9:	85 c0                	test   %eax,%eax
+  8038db:	79 1e                	jns    8038fb <ipc_send_pages+0x5a>
+    if (error != -E_IPC_NOT_RECV)
+  8038dd:	83 f8 f9             	cmp    $0xfffffff9,%eax
+  8038e0:	75 07                	jne    8038e9 <ipc_send_pages+0x48>
+      panic("ipc_send: %e", error);
+    sys_yield();
+  8038e2:	e8 ee d4 ff ff       	call   800dd5 <sys_yield>
+  8038e7:	eb dc                	jmp    8038c5 <ipc_send_pages+0x24>
+      panic("ipc_send: %e", error);
+  8038e9:	50                   	push   %eax
+  8038ea:	68 03 43 80 00       	push   $0x804303
+  8038ef:	6a 5c                	push   $0x5c
+  8038f1:	68 10 43 80 00       	push   $0x804310
+  8038f6:	e8 44 ca ff ff       	call   80033f <_panic>
+  }
+}
+  8038fb:	8d 65 f4             	lea    -0xc(%ebp),%esp
+  8038fe:	5b                   	pop    %ebx
+  8038ff:	5e                   	pop    %esi
+  803900:	5f                   	pop    %edi
+  803901:	5d                   	pop    %ebp
+  803902:	c3                   	ret
+
+00803903 <ipc_send>:
+{
+  803903:	55                   	push   %ebp
+  803904:	89 e5                	mov    %esp,%ebp
+  803906:	83 ec 14             	sub    $0x14,%esp
+  ipc_send_pages(to_env, val, pg, 1, perm);
+  803909:	ff 75 14             	push   0x14(%ebp)
+  80390c:	6a 01                	push   $0x1
+  80390e:	ff 75 10             	push   0x10(%ebp)
+  803911:	ff 75 0c             	push   0xc(%ebp)
+  803914:	ff 75 08             	push   0x8(%ebp)
+  803917:	e8 85 ff ff ff       	call   8038a1 <ipc_send_pages>
+}
+  80391c:	83 c4 20             	add    $0x20,%esp
+  80391f:	c9                   	leave
+  803920:	c3                   	ret
+
+00803921 <ipc_find_env>:
+// Find the first environment of the given type.  We'll use this to
+// find special environments.
+// Returns 0 if no such environment exists.
+envid_t
+ipc_find_env(enum EnvType type)
+{
+  803921:	55                   	push   %ebp
+  803922:	89 e5                	mov    %esp,%ebp
+  803924:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  int i;
+
+  for (i = 0; i < NENV; i++)
+  803927:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (envs[i].env_type == type)
+  80392c:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  80392f:	c1 e0 04             	shl    $0x4,%eax
+  803932:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  803937:	8b 40 50             	mov    0x50(%eax),%eax
+  80393a:	39 c8                	cmp    %ecx,%eax
+  80393c:	74 12                	je     803950 <ipc_find_env+0x2f>
+  for (i = 0; i < NENV; i++)
+  80393e:	83 c2 01             	add    $0x1,%edx
+  803941:	81 fa 00 04 00 00    	cmp    $0x400,%edx
+  803947:	75 e3                	jne    80392c <ipc_find_env+0xb>
+      return envs[i].env_id;
+  return 0;
+  803949:	b8 00 00 00 00       	mov    $0x0,%eax
+  80394e:	eb 0e                	jmp    80395e <ipc_find_env+0x3d>
+      return envs[i].env_id;
+  803950:	8d 04 d2             	lea    (%edx,%edx,8),%eax
+  803953:	c1 e0 04             	shl    $0x4,%eax
+  803956:	05 00 00 c0 ee       	add    $0xeec00000,%eax
+  80395b:	8b 40 48             	mov    0x48(%eax),%eax
+}
+  80395e:	5d                   	pop    %ebp
+  80395f:	c3                   	ret
+
+00803960 <pageref>:
+#include <inc/lib.h>
+
+int
+pageref(void *v)
+{
+  803960:	55                   	push   %ebp
+  803961:	89 e5                	mov    %esp,%ebp
+  803963:	8b 45 08             	mov    0x8(%ebp),%eax
+  pte_t pte;
+
+  if (!(uvpd[PDX(v)] & PTE_P))
+  803966:	89 c2                	mov    %eax,%edx
+  803968:	c1 ea 16             	shr    $0x16,%edx
+  80396b:	8b 0c 95 00 d0 7b ef 	mov    -0x10843000(,%edx,4),%ecx
+    return 0;
+  803972:	ba 00 00 00 00       	mov    $0x0,%edx
+  if (!(uvpd[PDX(v)] & PTE_P))
+  803977:	f6 c1 01             	test   $0x1,%cl
+  80397a:	74 1c                	je     803998 <pageref+0x38>
+  pte = uvpt[PGNUM(v)];
+  80397c:	c1 e8 0c             	shr    $0xc,%eax
+  80397f:	8b 04 85 00 00 40 ef 	mov    -0x10c00000(,%eax,4),%eax
+  if (!(pte & PTE_P))
+  803986:	a8 01                	test   $0x1,%al
+  803988:	74 0e                	je     803998 <pageref+0x38>
+    return 0;
+  return pages[PGNUM(pte)].pp_ref;
+  80398a:	c1 e8 0c             	shr    $0xc,%eax
+  80398d:	0f b7 14 c5 04 00 00 	movzwl -0x10fffffc(,%eax,8),%edx
+  803994:	ef 
+  803995:	0f b7 d2             	movzwl %dx,%edx
+}
+  803998:	89 d0                	mov    %edx,%eax
+  80399a:	5d                   	pop    %ebp
+  80399b:	c3                   	ret
+
+0080399c <udivmod>:
+  80399c:	55                   	push   %ebp
+  80399d:	57                   	push   %edi
+  80399e:	56                   	push   %esi
+  80399f:	53                   	push   %ebx
+  8039a0:	83 ec 14             	sub    $0x14,%esp
+  8039a3:	8b 74 24 28          	mov    0x28(%esp),%esi
+  8039a7:	8b 7c 24 2c          	mov    0x2c(%esp),%edi
+  8039ab:	89 fb                	mov    %edi,%ebx
+  8039ad:	09 f3                	or     %esi,%ebx
+  8039af:	0f 84 88 00 00 00    	je     803a3d <udivmod+0xa1>
+  8039b5:	b9 3f 00 00 00       	mov    $0x3f,%ecx
+  8039ba:	c7 44 24 08 00 00 00 	movl   $0x0,0x8(%esp)
+  8039c1:	00 
+  8039c2:	c7 44 24 0c 00 00 00 	movl   $0x0,0xc(%esp)
+  8039c9:	00 
+  8039ca:	89 cd                	mov    %ecx,%ebp
+  8039cc:	89 34 24             	mov    %esi,(%esp)
+  8039cf:	89 7c 24 04          	mov    %edi,0x4(%esp)
+  8039d3:	eb 08                	jmp    8039dd <udivmod+0x41>
+  8039d5:	83 ed 01             	sub    $0x1,%ebp
+  8039d8:	83 fd ff             	cmp    $0xffffffff,%ebp
+  8039db:	74 6c                	je     803a49 <udivmod+0xad>
+  8039dd:	89 c3                	mov    %eax,%ebx
+  8039df:	89 d6                	mov    %edx,%esi
+  8039e1:	89 e9                	mov    %ebp,%ecx
+  8039e3:	0f ad f3             	shrd   %cl,%esi,%ebx
+  8039e6:	d3 ee                	shr    %cl,%esi
+  8039e8:	f6 c1 20             	test   $0x20,%cl
+  8039eb:	74 04                	je     8039f1 <udivmod+0x55>
+  8039ed:	89 f3                	mov    %esi,%ebx
+  8039ef:	31 f6                	xor    %esi,%esi
+  8039f1:	8b 3c 24             	mov    (%esp),%edi
+  8039f4:	39 fb                	cmp    %edi,%ebx
+  8039f6:	89 f7                	mov    %esi,%edi
+  8039f8:	8b 1c 24             	mov    (%esp),%ebx
+  8039fb:	8b 74 24 04          	mov    0x4(%esp),%esi
+  8039ff:	19 f7                	sbb    %esi,%edi
+  803a01:	72 d2                	jb     8039d5 <udivmod+0x39>
+  803a03:	89 f7                	mov    %esi,%edi
+  803a05:	89 de                	mov    %ebx,%esi
+  803a07:	89 e9                	mov    %ebp,%ecx
+  803a09:	0f a5 f7             	shld   %cl,%esi,%edi
+  803a0c:	d3 e6                	shl    %cl,%esi
+  803a0e:	f6 c1 20             	test   $0x20,%cl
+  803a11:	74 04                	je     803a17 <udivmod+0x7b>
+  803a13:	89 f7                	mov    %esi,%edi
+  803a15:	31 f6                	xor    %esi,%esi
+  803a17:	29 f0                	sub    %esi,%eax
+  803a19:	19 fa                	sbb    %edi,%edx
+  803a1b:	be 01 00 00 00       	mov    $0x1,%esi
+  803a20:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a25:	0f a5 f7             	shld   %cl,%esi,%edi
+  803a28:	d3 e6                	shl    %cl,%esi
+  803a2a:	f6 c1 20             	test   $0x20,%cl
+  803a2d:	74 04                	je     803a33 <udivmod+0x97>
+  803a2f:	89 f7                	mov    %esi,%edi
+  803a31:	31 f6                	xor    %esi,%esi
+  803a33:	09 74 24 08          	or     %esi,0x8(%esp)
+  803a37:	09 7c 24 0c          	or     %edi,0xc(%esp)
+  803a3b:	eb 98                	jmp    8039d5 <udivmod+0x39>
+  803a3d:	89 f0                	mov    %esi,%eax
+  803a3f:	89 fa                	mov    %edi,%edx
+  803a41:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803a45:	89 7c 24 0c          	mov    %edi,0xc(%esp)
+  803a49:	8b 4c 24 30          	mov    0x30(%esp),%ecx
+  803a4d:	89 01                	mov    %eax,(%ecx)
+  803a4f:	89 51 04             	mov    %edx,0x4(%ecx)
+  803a52:	8b 44 24 08          	mov    0x8(%esp),%eax
+  803a56:	8b 54 24 0c          	mov    0xc(%esp),%edx
+  803a5a:	83 c4 14             	add    $0x14,%esp
+  803a5d:	5b                   	pop    %ebx
+  803a5e:	5e                   	pop    %esi
+  803a5f:	5f                   	pop    %edi
+  803a60:	5d                   	pop    %ebp
+  803a61:	c3                   	ret
+
+00803a62 <__udivdi3>:
+  803a62:	83 ec 18             	sub    $0x18,%esp
+  803a65:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803a69:	50                   	push   %eax
+  803a6a:	ff 74 24 2c          	push   0x2c(%esp)
+  803a6e:	ff 74 24 2c          	push   0x2c(%esp)
+  803a72:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803a76:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803a7a:	e8 1d ff ff ff       	call   80399c <udivmod>
+  803a7f:	83 c4 24             	add    $0x24,%esp
+  803a82:	c3                   	ret
+
+00803a83 <__umoddi3>:
+  803a83:	83 ec 18             	sub    $0x18,%esp
+  803a86:	8d 44 24 0c          	lea    0xc(%esp),%eax
+  803a8a:	50                   	push   %eax
+  803a8b:	ff 74 24 2c          	push   0x2c(%esp)
+  803a8f:	ff 74 24 2c          	push   0x2c(%esp)
+  803a93:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803a97:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803a9b:	e8 fc fe ff ff       	call   80399c <udivmod>
+  803aa0:	8b 44 24 18          	mov    0x18(%esp),%eax
+  803aa4:	8b 54 24 1c          	mov    0x1c(%esp),%edx
+  803aa8:	83 c4 24             	add    $0x24,%esp
+  803aab:	c3                   	ret
+
+00803aac <__divdi3>:
+  803aac:	56                   	push   %esi
+  803aad:	53                   	push   %ebx
+  803aae:	83 ec 14             	sub    $0x14,%esp
+  803ab1:	8b 44 24 20          	mov    0x20(%esp),%eax
+  803ab5:	8b 54 24 24          	mov    0x24(%esp),%edx
+  803ab9:	8b 4c 24 28          	mov    0x28(%esp),%ecx
+  803abd:	8b 5c 24 2c          	mov    0x2c(%esp),%ebx
+  803ac1:	85 d2                	test   %edx,%edx
+  803ac3:	78 18                	js     803add <__divdi3+0x31>
+  803ac5:	85 db                	test   %ebx,%ebx
+  803ac7:	78 3e                	js     803b07 <__divdi3+0x5b>
+  803ac9:	83 ec 04             	sub    $0x4,%esp
+  803acc:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803ad0:	56                   	push   %esi
+  803ad1:	53                   	push   %ebx
+  803ad2:	51                   	push   %ecx
+  803ad3:	e8 c4 fe ff ff       	call   80399c <udivmod>
+  803ad8:	83 c4 10             	add    $0x10,%esp
+  803adb:	eb 24                	jmp    803b01 <__divdi3+0x55>
+  803add:	f7 d8                	neg    %eax
+  803adf:	83 d2 00             	adc    $0x0,%edx
+  803ae2:	f7 da                	neg    %edx
+  803ae4:	85 db                	test   %ebx,%ebx
+  803ae6:	78 3a                	js     803b22 <__divdi3+0x76>
+  803ae8:	83 ec 04             	sub    $0x4,%esp
+  803aeb:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803aef:	56                   	push   %esi
+  803af0:	53                   	push   %ebx
+  803af1:	51                   	push   %ecx
+  803af2:	e8 a5 fe ff ff       	call   80399c <udivmod>
+  803af7:	83 c4 10             	add    $0x10,%esp
+  803afa:	f7 d8                	neg    %eax
+  803afc:	83 d2 00             	adc    $0x0,%edx
+  803aff:	f7 da                	neg    %edx
+  803b01:	83 c4 14             	add    $0x14,%esp
+  803b04:	5b                   	pop    %ebx
+  803b05:	5e                   	pop    %esi
+  803b06:	c3                   	ret
+  803b07:	83 ec 04             	sub    $0x4,%esp
+  803b0a:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803b0e:	56                   	push   %esi
+  803b0f:	f7 d9                	neg    %ecx
+  803b11:	83 d3 00             	adc    $0x0,%ebx
+  803b14:	f7 db                	neg    %ebx
+  803b16:	53                   	push   %ebx
+  803b17:	51                   	push   %ecx
+  803b18:	e8 7f fe ff ff       	call   80399c <udivmod>
+  803b1d:	83 c4 10             	add    $0x10,%esp
+  803b20:	eb d8                	jmp    803afa <__divdi3+0x4e>
+  803b22:	83 ec 04             	sub    $0x4,%esp
+  803b25:	8d 74 24 0c          	lea    0xc(%esp),%esi
+  803b29:	56                   	push   %esi
+  803b2a:	f7 d9                	neg    %ecx
+  803b2c:	83 d3 00             	adc    $0x0,%ebx
+  803b2f:	f7 db                	neg    %ebx
+  803b31:	53                   	push   %ebx
+  803b32:	51                   	push   %ecx
+  803b33:	e8 64 fe ff ff       	call   80399c <udivmod>
+  803b38:	83 c4 10             	add    $0x10,%esp
+  803b3b:	eb c4                	jmp    803b01 <__divdi3+0x55>
+
+00803b3d <__moddi3>:
+  803b3d:	55                   	push   %ebp
+  803b3e:	57                   	push   %edi
+  803b3f:	56                   	push   %esi
+  803b40:	53                   	push   %ebx
+  803b41:	83 ec 24             	sub    $0x24,%esp
+  803b44:	8b 44 24 38          	mov    0x38(%esp),%eax
+  803b48:	8b 54 24 3c          	mov    0x3c(%esp),%edx
+  803b4c:	8b 4c 24 40          	mov    0x40(%esp),%ecx
+  803b50:	8b 5c 24 44          	mov    0x44(%esp),%ebx
+  803b54:	85 d2                	test   %edx,%edx
+  803b56:	78 3b                	js     803b93 <__moddi3+0x56>
+  803b58:	83 ec 04             	sub    $0x4,%esp
+  803b5b:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803b5f:	56                   	push   %esi
+  803b60:	89 ce                	mov    %ecx,%esi
+  803b62:	f7 de                	neg    %esi
+  803b64:	89 74 24 08          	mov    %esi,0x8(%esp)
+  803b68:	89 de                	mov    %ebx,%esi
+  803b6a:	83 d6 00             	adc    $0x0,%esi
+  803b6d:	f7 de                	neg    %esi
+  803b6f:	89 74 24 14          	mov    %esi,0x14(%esp)
+  803b73:	8b 74 24 08          	mov    0x8(%esp),%esi
+  803b77:	0f 48 f1             	cmovs  %ecx,%esi
+  803b7a:	0f 49 5c 24 14       	cmovns 0x14(%esp),%ebx
+  803b7f:	53                   	push   %ebx
+  803b80:	56                   	push   %esi
+  803b81:	e8 16 fe ff ff       	call   80399c <udivmod>
+  803b86:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803b8a:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803b8e:	83 c4 10             	add    $0x10,%esp
+  803b91:	eb 47                	jmp    803bda <__moddi3+0x9d>
+  803b93:	f7 d8                	neg    %eax
+  803b95:	83 d2 00             	adc    $0x0,%edx
+  803b98:	f7 da                	neg    %edx
+  803b9a:	83 ec 04             	sub    $0x4,%esp
+  803b9d:	8d 74 24 1c          	lea    0x1c(%esp),%esi
+  803ba1:	56                   	push   %esi
+  803ba2:	89 cf                	mov    %ecx,%edi
+  803ba4:	f7 df                	neg    %edi
+  803ba6:	89 de                	mov    %ebx,%esi
+  803ba8:	83 d6 00             	adc    $0x0,%esi
+  803bab:	f7 de                	neg    %esi
+  803bad:	0f 49 cf             	cmovns %edi,%ecx
+  803bb0:	89 4c 24 08          	mov    %ecx,0x8(%esp)
+  803bb4:	0f 49 de             	cmovns %esi,%ebx
+  803bb7:	89 5c 24 0c          	mov    %ebx,0xc(%esp)
+  803bbb:	ff 74 24 0c          	push   0xc(%esp)
+  803bbf:	ff 74 24 0c          	push   0xc(%esp)
+  803bc3:	e8 d4 fd ff ff       	call   80399c <udivmod>
+  803bc8:	8b 44 24 28          	mov    0x28(%esp),%eax
+  803bcc:	8b 54 24 2c          	mov    0x2c(%esp),%edx
+  803bd0:	f7 d8                	neg    %eax
+  803bd2:	83 d2 00             	adc    $0x0,%edx
+  803bd5:	f7 da                	neg    %edx
+  803bd7:	83 c4 10             	add    $0x10,%esp
+  803bda:	83 c4 24             	add    $0x24,%esp
+  803bdd:	5b                   	pop    %ebx
+  803bde:	5e                   	pop    %esi
+  803bdf:	5f                   	pop    %edi
+  803be0:	5d                   	pop    %ebp
+  803be1:	c3                   	ret